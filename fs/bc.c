@@ -97,6 +97,33 @@ flush_block(void *addr)
 		panic("in bc_pgfault, sys_page_map: %e", r);	
 }
 
+// Flush the 'nblocks' blocks starting at the one containing VA, like
+// flush_block() does, but clear the PTE_D bits of each run of adjacent
+// flushed blocks with a single sys_batch() operation.
+void
+flush_blocks(void *addr, uint32_t nblocks)
+{
+	struct Batch b;
+	uint32_t blockno, i;
+	int r;
+
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, BLKSIZE);
+	blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+	if (addr < (void*)DISKMAP || nblocks > DISKSIZE / BLKSIZE - blockno)
+		panic("flush_blocks of bad range %08x+%x", addr, nblocks);
+
+	batch_init(&b);
+	for (i = 0; i < nblocks; i++, addr += BLKSIZE) {
+		if (!va_is_mapped(addr) || !va_is_dirty(addr))
+			continue;
+		if ((r = ide_write((blockno + i) * BLKSECTS, addr, BLKSECTS)) < 0)
+			panic("cannot write to dist: %e", r);
+		batch_map(&b, 0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL, 1);
+	}
+	if ((r = batch_flush(&b)) < 0)
+		panic("in flush_blocks, sys_batch: %e", r);
+}
+
 // Test that the block cache works, by smashing the superblock and
 // reading it back.
 static void
@@ -26,6 +26,7 @@ void*	diskaddr(uint32_t blockno);
 bool	va_is_mapped(void *va);
 bool	va_is_dirty(void *va);
 void	flush_block(void *addr);
+void	flush_blocks(void *addr, uint32_t nblocks);
 void	bc_init(void);
 
 /* fs.c */
@@ -0,0 +1,35 @@
+#ifndef JOS_INC_BATCH_H
+#define JOS_INC_BATCH_H
+
+#include <inc/types.h>
+
+// Operations of sys_batch() (see kern/syscall.c).  Page operations act
+// on a range of bo_npages pages (0 meaning 1) starting at the given
+// addresses, with the same rules as the single-page system calls.
+enum {
+	BATCH_PAGE_ALLOC = 0,	// sys_page_alloc(bo_dstenv, bo_dstva, bo_perm)
+	BATCH_PAGE_MAP,		// sys_page_map(bo_srcenv, bo_srcva,
+				//	bo_dstenv, bo_dstva, bo_perm)
+	BATCH_PAGE_UNMAP,	// sys_page_unmap(bo_dstenv, bo_dstva)
+	BATCH_ENV_SET_STATUS,	// sys_env_set_status(bo_dstenv, bo_perm)
+};
+
+struct BatchOp {
+	uint32_t bo_op;
+	int32_t bo_srcenv;
+	void *bo_srcva;
+	int32_t bo_dstenv;
+	void *bo_dstva;
+	uint32_t bo_npages;
+	int bo_perm;		// Page permissions, or the new env status
+};
+
+// sys_batch() returns both the index and the error of the operation
+// that failed in one negative value; these take it apart.  The kernel
+// never writes the array, which the operations may have just made
+// copy-on-write.
+#define BATCH_FAILURE(i, r)	(-(int) (((i) << 8) | -(r)))
+#define BATCH_FAILED_OP(r)	((-(r)) >> 8)
+#define BATCH_FAILED_ERR(r)	(-((-(r)) & 0xFF))
+
+#endif /* !JOS_INC_BATCH_H */
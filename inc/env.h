@@ -6,6 +6,7 @@
 #include <inc/types.h>
 #include <inc/trap.h>
 #include <inc/memlayout.h>
+#include <inc/syscall.h>
 
 typedef int32_t envid_t;
 
@@ -45,6 +46,24 @@ enum EnvType {
 	ENV_TYPE_NS,		// Network server
 };
 
+// Scheduling priorities (see sys_env_set_priority).  Lower values run
+// first.  The scheduler moves an env between its priority and
+// ENV_PRIO_MIN depending on how much of its time slices it uses.
+#define ENV_PRIO_MAX		0
+#define ENV_PRIO_DEFAULT	1
+#define ENV_PRIO_MIN		3
+#define ENV_NPRIO		(ENV_PRIO_MIN + 1)
+
+// CPU accounting, kept up to date by trap() and env_run().
+struct EnvStats {
+	uint64_t es_user_cycles;	// TSC cycles run in user mode
+	uint64_t es_kern_cycles;	// TSC cycles in the kernel for us
+	uint32_t es_vswitches;		// Gave up the CPU (blocked or yielded)
+	uint32_t es_iswitches;		// Preempted while still runnable
+	uint32_t es_pgfaults;		// Page faults
+	uint32_t es_syscalls[NSYSCALLS];	// System calls, by number
+};
+
 struct Env {
 	struct Trapframe env_tf;	// Saved registers
 	struct Env *env_link;		// Next free Env
@@ -55,11 +74,22 @@ struct Env {
 	uint32_t env_runs;		// Number of times environment has run
 	int env_cpunum;			// The CPU that the env is running on
 
+	// Scheduling
+	struct Env *env_rq_next;	// Next env on the run queue
+	struct Env *env_rq_prev;	// Previous env on the run queue
+	int env_rq_cpu;			// CPU whose run queue holds us, or -1
+	int env_priority;		// Best level the env may run at
+	int env_level;			// Current feedback queue level
+	unsigned env_slice;		// Timer ticks left in this time slice
+	uint32_t env_affinity;		// CPUs the env may run on (bit i = CPU i)
+
 	// Address space
 	pde_t *env_pgdir;		// Kernel virtual address of page dir
+	bool env_ksm;			// Idle CPUs may merge its pages
 
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
+	uintptr_t env_xstacktop;	// Top of the exception stack
 	
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
@@ -72,6 +102,10 @@ struct Env {
 	bool env_e1000_receiving; // Is this environment waiting for packet?
     char *env_e1000_packet; // packet storage location
     int env_e1000_size;     // packet storage size/input packet size.
+    struct Env *env_e1000_next; // Next env waiting for a packet
+
+	// Accounting
+	struct EnvStats env_stats;
 };
 
 #endif // !JOS_INC_ENV_H
@@ -29,6 +29,9 @@ enum {
     // E1000 errors
     E_RING_FULL,
     E_RING_EMPTY,
+    
+    // Timed waits
+    E_TIMEOUT,
 
 	MAXERROR
 };
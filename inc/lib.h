@@ -8,6 +8,7 @@
 #define JOS_INC_LIB_H 1
 
 #include <inc/types.h>
+#include <inc/x86.h>
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
 #include <inc/string.h>
@@ -23,6 +24,11 @@
 #include <inc/malloc.h>
 #include <inc/ns.h>
 #include <inc/sb16.h>
+#include <inc/time.h>
+#include <inc/perf.h>
+#include <inc/trace.h>
+#include <inc/batch.h>
+#include <inc/meminfo.h>
 
 #define USED(x)		(void)(x)
 
@@ -31,9 +37,26 @@ void	umain(int argc, char **argv);
 
 // libmain.c or entry.S
 extern const char *binaryname;
-extern const volatile struct Env *thisenv;
+extern const volatile struct Env *mainenv;
 extern const volatile struct Env envs[NENV];
 extern const volatile struct PageInfo pages[];
+extern const volatile struct TimeInfo timeinfo;
+
+// The Env of the running thread.  Threads made by sfork() run on the
+// stacks of their slot in the UTHREADS region (see inc/memlayout.h);
+// anything else is the environment's first thread, 'mainenv'.
+// Only the first thread may fork().
+#define thisenv		(thread_env())
+
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+}
 
 // exit.c
 void	exit(void);
@@ -45,6 +68,7 @@ void	set_pgfault_handler(void (*handler)(struct UTrapframe *utf));
 char*	readline(const char *buf);
 
 // syscall.c
+extern bool syscall_use_int;
 void	sys_cputs(const char *string, size_t len);
 int	sys_cgetc(void);
 envid_t	sys_getenvid(void);
@@ -54,13 +78,29 @@ static envid_t sys_exofork(void);
 int	sys_env_set_status(envid_t env, int status);
 int	sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
+int	sys_env_set_priority(envid_t env, int priority);
+int	sys_env_set_affinity(envid_t env, uint32_t cpumask);
 int	sys_page_alloc(envid_t env, void *pg, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
+int	sys_ipc_recv_until(void *rcv_pg, unsigned deadline);
 unsigned int sys_time_msec(void);
+uint64_t sys_time_nsec(void);
+int	sys_sleep_until(unsigned deadline);
+int	sys_env_print_stats(int limit);
+int	sys_perf(int op, unsigned arg);
+envid_t	sys_fork(void);
+envid_t	sys_thread_create(void *eip, uint32_t a1, uint32_t a2);
+int	sys_region_reserve(envid_t env, void *va, size_t len, int perm);
+int	sys_region_release(envid_t env, void *va, size_t len);
+int	sys_batch(struct BatchOp *ops, size_t n);
+uint32_t sys_trace_ctl(uint32_t mask);
+int	sys_trace_read(int cpu, struct TraceRecord *buf, int n);
+int	sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n);
+int	sys_env_set_ksm(envid_t env, bool on);
 int sys_e1000_transmit(char *packet, size_t len);
 int sys_e1000_receive(char *buffer, size_t len);
 int sys_e1000_read_hwaddr(char *buffer, size_t len);
@@ -84,12 +124,33 @@ sys_exofork(void)
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+int32_t ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+		       unsigned deadline);
 envid_t	ipc_find_env(enum EnvType type);
 
+// batch.c
+#define BATCH_MAXOPS	16
+
+struct Batch {
+	struct BatchOp b_ops[BATCH_MAXOPS];
+	int b_nops;
+	int b_error;		// First error, if any
+};
+
+void	batch_init(struct Batch *b);
+void	batch_reserve(struct Batch *b, int nops);
+void	batch_alloc(struct Batch *b, envid_t env, void *va, int perm,
+		    size_t npages);
+void	batch_map(struct Batch *b, envid_t srcenv, void *srcva,
+		  envid_t dstenv, void *dstva, int perm, size_t npages);
+void	batch_unmap(struct Batch *b, envid_t env, void *va, size_t npages);
+void	batch_set_status(struct Batch *b, envid_t env, int status);
+int	batch_flush(struct Batch *b);
+
 // fork.c
-#define	PTE_SHARE	0x400
 envid_t	fork(void);
-envid_t	sfork(void);	// Challenge!
+envid_t	ufork(void);
+envid_t	sfork(void (*func)(void *), void *arg);
 
 // fd.c
 int	close(int fd);
@@ -147,6 +208,10 @@ int	pipeisclosed(int pipefd);
 // wait.c
 void	wait(envid_t env);
 
+// time.c
+uint64_t time_nsec(void);
+unsigned int time_msec(void);
+
 /* File open modes */
 #define	O_RDONLY	0x0000		/* open for reading only */
 #define	O_WRONLY	0x0001		/* open for writing only */
@@ -0,0 +1,25 @@
+#ifndef JOS_INC_MEMINFO_H
+#define JOS_INC_MEMINFO_H
+
+#include <inc/env.h>
+
+// Physical memory use, as sys_meminfo() reports it.  All counts are in
+// 4KB pages.
+struct MemInfo {
+	uint32_t mi_total;	// Physical pages the kernel manages
+	uint32_t mi_free;	// Pages page_alloc() can still hand out
+	uint32_t mi_zeroed;	// Free pages zeroed ahead of time
+	uint32_t mi_used;	// mi_total - mi_free
+	uint32_t mi_merged;	// Pages same-page merging saves
+};
+
+// The memory of one environment.  Threads share an address space (see
+// sys_thread_create()), so each of them reports all of it.
+struct EnvMemInfo {
+	envid_t em_envid;
+	uint32_t em_resident;	// Pages mapped below UTOP, 4MB pages as 1024
+	uint32_t em_shared;	// Resident pages someone else maps too
+	uint32_t em_ptables;	// The page directory and page tables
+};
+
+#endif /* !JOS_INC_MEMINFO_H */
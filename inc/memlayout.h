@@ -50,6 +50,7 @@
  *    UVPT      ---->  +------------------------------+ 0xef400000
  *                     |          RO PAGES            | R-/R-  PTSIZE
  *    UPAGES    ---->  +------------------------------+ 0xef000000
+ *    UTIME     ---->  |  RO Clock Calibration (page) | R-/R-  PGSIZE
  *                     |           RO ENVS            | R-/R-  PTSIZE
  * UTOP,UENVS ------>  +------------------------------+ 0xeec00000
  * UXSTACKTOP -/       |     User Exception Stack     | RW/RW  PGSIZE
@@ -123,6 +124,9 @@
 #define UPAGES		(UVPT - PTSIZE)
 // Read-only copies of the global env structures
 #define UENVS		(UPAGES - PTSIZE)
+// Read-only TSC calibration (struct TimeInfo), in the last page of
+// the UENVS slot
+#define UTIME		(UPAGES - PGSIZE)
 
 /*
  * Top of user VM. User can manipulate VA from UTOP-1 and down!
@@ -136,6 +140,16 @@
 // Top of normal user stack
 #define USTACKTOP	(UTOP - 2*PGSIZE)
 
+// Threads (see sys_thread_create()) each get a slot of THREADSLOT bytes
+// in [UTHREADS, UTHREADS + NENV*THREADSLOT), at the index of their env.
+// A slot holds, from the top, a one-page exception stack, an invalid
+// guard page and a THREADSTACK-byte stack; the rest is left invalid.
+#define UTHREADS	0xE0000000
+#define THREADSLOT	(16*PGSIZE)
+#define THREADSTACK	(4*PGSIZE)
+#define UTHREADXSTACKTOP(envx)	(UTHREADS + ((envx) + 1) * THREADSLOT)
+#define UTHREADSTACKTOP(envx)	(UTHREADXSTACKTOP(envx) - 2*PGSIZE)
+
 // Where user programs generally begin
 #define UTEXT		(2*PTSIZE)
 
@@ -187,16 +201,34 @@ extern volatile pde_t uvpd[];     // VA of current page directory
  * You can map a struct PageInfo * to the corresponding physical address
  * with page2pa() in kern/pmap.h.
  */
+struct PgdirMem;
+
 struct PageInfo {
-	// Next page on the free list.
+	// Next and previous free block on the free list.
 	struct PageInfo *pp_link;
+	union {
+		struct PageInfo *pp_prev;
+		// The memory counters of the address space, for a page
+		// directory in use (see pgdir_mem_alloc() in kern/pmap.c).
+		struct PgdirMem *pp_mem;
+	};
 
 	// pp_ref is the count of pointers (usually in page table entries)
 	// to this page, for pages allocated using page_alloc.
 	// Pages allocated at boot time using pmap.c's
 	// boot_alloc do not have valid reference count fields.
+	// 32 bits, as a page shared by every env can have more than
+	// 65535 references.
+
+	uint32_t pp_ref;
+
+	// The order of the free block this page starts, -2 in a CPU's
+	// page cache, or -1 (see the buddy allocator in kern/pmap.c).
+	int8_t pp_order;
 
-	uint16_t pp_ref;
+	// Set on the first page of a 4MB page from page_alloc_large(),
+	// which counts the references to all of it.
+	uint8_t pp_large;
 };
 
 #endif /* !__ASSEMBLER__ */
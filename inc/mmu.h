@@ -72,10 +72,15 @@
 // hardware, so user processes are allowed to set them arbitrarily.
 #define PTE_AVAIL	0xE00	// Available for software use
 
+// PTE_AVAIL bits with a meaning to the JOS user library and kernel.
+#define PTE_SHARE	0x400	// Shared, not copied, by fork and spawn
+#define PTE_COW		0x800	// Copy-on-write
+
 // Flags in page table or page directory entry
 #define PTE_FLAGS(pte)	((int) (pte) & 0xFFF)
 
 // Flags in PTE_SYSCALL may be used in system calls.  (Others may not.)
+// sys_page_alloc() also takes PTE_PS, for a 4MB page.
 #define PTE_SYSCALL	(PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
 // Address in page table or page directory entry
@@ -96,6 +101,7 @@
 #define CR0_PG		0x80000000	// Paging
 
 #define CR4_PCE		0x00000100	// Performance counter enable
+#define CR4_PGE		0x00000080	// Page Global Enable
 #define CR4_MCE		0x00000040	// Machine Check Enable
 #define CR4_PSE		0x00000010	// Page Size Extensions
 #define CR4_DE		0x00000008	// Debugging Extensions
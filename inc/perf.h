@@ -0,0 +1,12 @@
+#ifndef JOS_INC_PERF_H
+#define JOS_INC_PERF_H
+
+// Operations of sys_perf() (see kern/perf.c).
+enum {
+	PERF_START = 0,		// start sampling; argument is the rate in Hz,
+				// 0 to sample at the scheduler's own interrupts
+	PERF_STOP,		// stop sampling
+	PERF_REPORT,		// print the 'argument' hottest functions
+};
+
+#endif /* !JOS_INC_PERF_H */
@@ -18,11 +18,26 @@ enum {
 	SYS_ipc_try_send,
 	SYS_ipc_recv,
 	SYS_time_msec,
+	SYS_time_nsec,
+	SYS_sleep_until,
+	SYS_env_print_stats,
     SYS_e1000_transmit,
     SYS_e1000_receive,
     SYS_e1000_read_hwaddr,
     SYS_sb16_read_version,
     SYS_sb16_play,
+	SYS_env_set_priority,
+	SYS_env_set_affinity,
+	SYS_perf,
+	SYS_trace_ctl,
+	SYS_trace_read,
+	SYS_batch,
+	SYS_fork,
+	SYS_thread_create,
+	SYS_region_reserve,
+	SYS_region_release,
+	SYS_meminfo,
+	SYS_env_set_ksm,
 	NSYSCALLS
 };
 
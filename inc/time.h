@@ -0,0 +1,33 @@
+#ifndef JOS_INC_TIME_H
+#define JOS_INC_TIME_H
+
+#include <inc/types.h>
+
+// Calibration data for the time stamp counter, written once at boot
+// and mapped read-only for user environments at UTIME.  With it user
+// code can read the time without entering the kernel (see lib/time.c).
+// The TSCs of all CPUs are assumed to run in step.
+struct TimeInfo {
+	uint64_t ti_tsc_base;		// TSC value at time zero (boot)
+	uint32_t ti_tsc_khz;		// TSC ticks per millisecond
+	uint32_t ti_ns_mult;		// nanoseconds =
+	uint32_t ti_ns_shift;		//	(ticks * ti_ns_mult) >> ti_ns_shift
+	uint32_t ti_ms_mult;		// milliseconds, likewise
+	uint32_t ti_ms_shift;
+};
+
+// Compute (ticks * mult) >> shift without overflowing or calling into
+// libgcc for 64-bit arithmetic.  The low 32 bits of the 96-bit product
+// are dropped before the shift, which costs less than one unit.
+static inline uint64_t
+tsc_scale(uint64_t ticks, uint32_t mult, uint32_t shift)
+{
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+	uint64_t hi = (ticks >> 32) * mult;
+
+	if (shift >= 32)
+		return (hi + (lo >> 32)) >> (shift - 32);
+	return (hi << (32 - shift)) + (lo >> shift);
+}
+
+#endif /* !JOS_INC_TIME_H */
@@ -0,0 +1,32 @@
+#ifndef JOS_INC_TRACE_H
+#define JOS_INC_TRACE_H
+
+#include <inc/env.h>
+
+// Kernel trace records (see kern/trace.c), as sys_trace_read() returns
+// them and user/trace saves them.
+enum {
+	TRACE_SYSCALL_ENTER = 0,	// arg: syscall number, a1, a2
+	TRACE_SYSCALL_EXIT,		// arg: syscall number, result, cycles
+	TRACE_TRAP,			// arg: trap number, eip, error code
+	TRACE_IRQ,			// arg: IRQ number
+	TRACE_SWITCH,			// arg: envid switched to
+	TRACE_IPC_SEND,			// arg: receiver, value, result
+	TRACE_IPC_RECV,			// arg: dstva, deadline
+	TRACE_NTYPES
+};
+
+// Masks for sys_trace_ctl(): bit n enables records of type n.
+#define TRACE_SYSCALL	((1 << TRACE_SYSCALL_ENTER) | (1 << TRACE_SYSCALL_EXIT))
+#define TRACE_IPC	((1 << TRACE_IPC_SEND) | (1 << TRACE_IPC_RECV))
+#define TRACE_ALL	((1 << TRACE_NTYPES) - 1)
+
+struct TraceRecord {
+	uint64_t tr_tsc;		// read_tsc() when the event happened
+	uint16_t tr_type;
+	uint16_t tr_cpu;
+	envid_t tr_envid;		// curenv then, or 0
+	uint32_t tr_arg[3];
+};
+
+#endif /* !JOS_INC_TRACE_H */
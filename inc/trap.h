@@ -40,6 +40,8 @@
 #define IRQ_E1000       11
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
+#define IRQ_WAKEUP      20	// IPI: reschedule (see sched_kick())
+#define IRQ_TLB         21	// IPI: flush the TLB (see tlb_shootdown())
 
 #ifndef __ASSEMBLER__
 
@@ -34,6 +34,18 @@ static __inline uint32_t read_ebp(void) __attribute__((always_inline));
 static __inline uint32_t read_esp(void) __attribute__((always_inline));
 static __inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp);
 static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+static __inline void wrmsr(uint32_t msr, uint64_t val) __attribute__((always_inline));
+
+// CPUID leaf 1 EDX feature flags
+#define CPUID_FEAT_PSE		0x00000008	// 4MB pages
+#define CPUID_FEAT_SEP		0x00000800	// sysenter/sysexit
+#define CPUID_FEAT_PGE		0x00002000	// Global pages
+#define CPUID_FEAT_SSE2		0x04000000	// SSE2 (movnti)
+
+// Model-specific registers
+#define MSR_SYSENTER_CS		0x174
+#define MSR_SYSENTER_ESP	0x175
+#define MSR_SYSENTER_EIP	0x176
 
 static __inline void
 breakpoint(void)
@@ -280,6 +292,12 @@ read_tsc(void)
 	return tsc;
 }
 
+static __inline void
+wrmsr(uint32_t msr, uint64_t val)
+{
+	__asm __volatile("wrmsr" : : "c" (msr), "A" (val));
+}
+
 static inline uint32_t
 xchg(volatile uint32_t *addr, uint32_t newval)
 {
@@ -293,4 +311,15 @@ xchg(volatile uint32_t *addr, uint32_t newval)
 	return result;
 }
 
+// Atomically add 'incr' to *addr and return the old value.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t incr)
+{
+	asm volatile("lock; xaddl %0, %1" :
+			"+r" (incr), "+m" (*addr) :
+			:
+			"cc");
+	return incr;
+}
+
 #endif /* !JOS_INC_X86_H */
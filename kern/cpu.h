@@ -23,6 +23,12 @@ struct CpuInfo {
 	volatile unsigned cpu_status;   // The status of the CPU
 	struct Env *cpu_env;            // The currently-running environment.
 	struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
+	uint64_t cpu_acct_tsc;          // TSC when cpu_env last entered or
+	                                // left user mode (see env_run())
+	bool cpu_yielded;               // cpu_env called sys_yield
+	volatile uint32_t cpu_in_user;  // Running user code, or about to
+	volatile uint32_t cpu_tlb_stale; // Must flush the TLB before that
+	                                // (see tlb_shootdown())
 };
 
 // Initialized in mpconfig.c
@@ -42,5 +48,8 @@ void lapic_init(void);
 void lapic_startap(uint8_t apicid, uint32_t addr);
 void lapic_eoi(void);
 void lapic_ipi(int vector);
+void lapic_ipi_cpu(uint8_t apicid, int vector);
+void lapic_timer_oneshot(unsigned msec);
+unsigned lapic_timer_elapsed(void);
 
 #endif
@@ -6,6 +6,8 @@
 #include <kern/pmap.h>
 #include <kern/picirq.h>
 #include <kern/env.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
 #include <inc/string.h>
 #include <inc/x86.h>
 #include <inc/assert.h>
@@ -28,6 +30,15 @@ physaddr_t e1000addr;
 int e1000len;
 volatile uint32_t *e1000 = NULL;
 
+/**
+ * sys_e1000_transmit runs without the big kernel lock, so the transmit
+ * ring has a lock of its own. The receive side (the waiter queue and the
+ * interrupt handler) still runs under the big kernel lock.
+ */
+static struct spinlock e1000_tx_lock = {
+    .name = "e1000_tx_lock"
+};
+
 
 // Transmit descriptor array, aligned to page (thus also aligned to 16bytes)
 // Note that E1000 reads *physical* addresses.
@@ -321,14 +332,18 @@ e1000_transmit(char *packet, size_t length) {
     // We currently don't allow packets bigger than the size specified by Ethernet.
     assert(length < ETH_MAX_PACKET_SIZE);
     
+    spin_lock(&e1000_tx_lock);
+    
     // get current tx descriptor and descriptor index
     tx_index = e1000r(E1000_TDT);
     tx_desc = &e1000_tx_desc_array[tx_index];
     
     // check if the current tx descriptor isn't taken. if
     // it does, drop the packet. TODO require upgrade.
-    if (! (tx_desc->upper.fields.status & E1000_TXD_STAT_DD))
+    if (! (tx_desc->upper.fields.status & E1000_TXD_STAT_DD)) {
+        spin_unlock(&e1000_tx_lock);
         return -E_RING_FULL;
+    }
     
     // move the packet into the reserved space (so DMA wont cause race conditions?)
     memmove(&e1000_tx_packet_buffers[tx_index], packet, length);
@@ -342,6 +357,7 @@ e1000_transmit(char *packet, size_t length) {
     // Beam me up, scotty 
     e1000_tx_step();
     
+    spin_unlock(&e1000_tx_lock);
     return 0;
 }
 
@@ -393,6 +409,64 @@ e1000_rx_empty() {
     return (! (rx_desc->status & E1000_RXD_STAT_DD));
 }
 
+/**
+ * Environments blocked in sys_e1000_receive, oldest first. Linked through
+ * env_e1000_next so the interrupt handler does not have to scan 'envs'.
+ */
+static struct Env *rx_waiters_head = NULL;
+static struct Env *rx_waiters_tail = NULL;
+
+/**
+ * Queue 'e' to receive the next packet into 'packet' (at most 'len' bytes).
+ * The caller blocks the env; e1000_intr wakes it up.
+ */
+void
+e1000_rx_wait(struct Env *e, char *packet, size_t len) {
+    e->env_e1000_receiving = true;
+    e->env_e1000_packet = packet;
+    e->env_e1000_size = len;
+    e->env_e1000_next = NULL;
+    
+    if (rx_waiters_tail)
+        rx_waiters_tail->env_e1000_next = e;
+    else
+        rx_waiters_head = e;
+    rx_waiters_tail = e;
+}
+
+/**
+ * Remove 'e' from the receive wait queue (the env is being freed).
+ */
+void
+e1000_rx_cancel(struct Env *e) {
+    struct Env **pp, *prev = NULL;
+    
+    for (pp = &rx_waiters_head; *pp; prev = *pp, pp = &(*pp)->env_e1000_next) {
+        if (*pp != e)
+            continue;
+        *pp = e->env_e1000_next;
+        if (rx_waiters_tail == e)
+            rx_waiters_tail = prev;
+        break;
+    }
+    
+    e->env_e1000_receiving = false;
+    e->env_e1000_next = NULL;
+}
+
+/**
+ * Is an environment of the given type waiting for a packet?
+ */
+bool
+e1000_rx_waiting(enum EnvType type) {
+    struct Env *e;
+    
+    for (e = rx_waiters_head; e; e = e->env_e1000_next)
+        if (e->env_type == type)
+            return true;
+    return false;
+}
+
 /**
  * Interrupt handler. We keep it simple and static: the interrupt handler
  * checks for process that is waiting to receive packet, and if there is
@@ -402,7 +476,6 @@ e1000_rx_empty() {
 void
 e1000_intr(void) {
     struct Env *e;
-    int i;
     int r;
     physaddr_t prev_cr3;
     
@@ -411,34 +484,38 @@ e1000_intr(void) {
     e1000r(E1000_ICR);
     
     
-    // search for applicable env.
-    for (i = 0; i < NENV; i++)
-        if (envs[i].env_status != ENV_FREE && envs[i].env_e1000_receiving)
-            break;
-    
-    
-    // if we didn't find one, finish here.
-    if (i == NENV)
+    // the oldest waiting env gets the packet.
+    // if nobody is waiting, finish here.
+    if ((e = rx_waiters_head) == NULL)
         return;
     
+    // keep the env's buffer mapped while we copy into it
+    env_lock(e);
+    
     prev_cr3 = rcr3();
-    lcr3(PADDR(envs[i].env_pgdir));
+    lcr3(PADDR(e->env_pgdir));
 
-    if ((r = e1000_receive(envs[i].env_e1000_packet, envs[i].env_e1000_size)) < 0) {
+    if ((r = e1000_receive(e->env_e1000_packet, e->env_e1000_size)) < 0) {
         if (r != -E_RING_EMPTY) panic("receive error: %e", r);
         lcr3(prev_cr3);
+        env_unlock(e);
         return;
     }
     
     lcr3(prev_cr3);
     
     // If we received the packet successfully, inject it and resume running the env.
-    envs[i].env_status = ENV_RUNNABLE;
-    envs[i].env_e1000_receiving = false;
-    envs[i].env_e1000_size = r;
+    rx_waiters_head = e->env_e1000_next;
+    if (rx_waiters_head == NULL)
+        rx_waiters_tail = NULL;
+    e->env_e1000_next = NULL;
+    e->env_e1000_receiving = false;
+    e->env_e1000_size = r;
     
     // returns the size of the packet
-    envs[i].env_tf.tf_regs.reg_eax = r;
+    e->env_tf.tf_regs.reg_eax = r;
+    sched_wakeup(e);
+    env_unlock(e);
 }
 
 /*
@@ -6,6 +6,7 @@
 #include <kern/pci.h>
 #include <kern/e1000_hw.h>
 #include <inc/types.h>
+#include <inc/env.h>
 
 extern volatile uint32_t *e1000;
 
@@ -40,6 +41,9 @@ int e1000_receive(char *packet, size_t len);
 bool e1000_rx_empty();
 void e1000_read_status(struct e1000_status_t *e1000_status);
 void e1000_intr(void);
+void e1000_rx_wait(struct Env *e, char *packet, size_t len);
+void e1000_rx_cancel(struct Env *e);
+bool e1000_rx_waiting(enum EnvType type);
 void e1000_gen_intr(void);
 uint16_t e1000_read_eeprom(int address);
 void e1000_read_hwaddr(union hwaddr *buffer);
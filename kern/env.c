@@ -14,10 +14,24 @@
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/e1000.h>
+#include <kern/timer.h>
+#include <kern/time.h>
+#include <kern/trace.h>
 
 struct Env *envs = NULL;		// All environments
 static struct Env *env_free_list;	// Free environment list
 					// (linked by Env->env_link)
+static struct spinlock env_table_lock;	// Protects env_free_list
+
+// One lock per slot in 'envs', protecting the address space and the IPC
+// state of the environment in that slot.  These live here rather than in
+// struct Env because struct Env is part of the user-visible ABI.
+static struct spinlock env_locks[NENV];
+
+// A page of zeroes, mapped copy-on-write where demand-zero memory is
+// read before it is written (see env_region_fault()).
+static struct PageInfo *env_zero_page;
 
 #define ENVGENSHIFT	12		// >= LOGNENV
 
@@ -108,6 +122,124 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	return 0;
 }
 
+//
+// Lock the address space and IPC state of environment e.
+// Locks of several environments must be taken in the order of their
+// slots in 'envs' (see env_lock_pair).  The big kernel lock, if needed,
+// must be taken before any environment lock.
+//
+void
+env_lock(struct Env *e)
+{
+	spin_lock(&env_locks[e - envs]);
+}
+
+void
+env_unlock(struct Env *e)
+{
+	spin_unlock(&env_locks[e - envs]);
+}
+
+// Lock two environments, which may be the same one, without deadlocking
+// against a CPU that locks the same pair the other way around.
+void
+env_lock_pair(struct Env *a, struct Env *b)
+{
+	if (a == b)
+		env_lock(a);
+	else if (a < b) {
+		env_lock(a);
+		env_lock(b);
+	} else {
+		env_lock(b);
+		env_lock(a);
+	}
+}
+
+void
+env_unlock_pair(struct Env *a, struct Env *b)
+{
+	env_unlock(a);
+	if (a != b)
+		env_unlock(b);
+}
+
+//
+// Timed waits: sys_sleep_until, and sys_ipc_recv with a deadline.
+// et_armed is protected by the env's lock.  A timer callback that lost
+// the race against a sender (or a newer wait) finds it cleared, or
+// finds that the newer deadline has not passed yet.
+//
+static struct EnvTimeout {
+	struct Timer et_timer;
+	bool et_armed;
+} env_timeouts[NENV];
+
+// How many ENV_TYPE_USER environments have a timeout armed.
+static volatile uint32_t user_timeouts;
+
+static void
+env_disarm(struct Env *e, struct EnvTimeout *et)
+{
+	et->et_armed = false;
+	if (e->env_type == ENV_TYPE_USER)
+		xadd(&user_timeouts, -1);
+}
+
+static void
+env_timeout(void *arg)
+{
+	struct Env *e = arg;
+	struct EnvTimeout *et = &env_timeouts[e - envs];
+
+	env_lock(e);
+	if (et->et_armed && e->env_status == ENV_NOT_RUNNABLE &&
+	    (int) (time_msec() - et->et_timer.tm_expires) >= 0) {
+		env_disarm(e, et);
+		if (e->env_ipc_recving) {
+			e->env_ipc_recving = false;
+			e->env_tf.tf_regs.reg_eax = -E_TIMEOUT;
+		}
+		sched_wakeup(e);
+	}
+	env_unlock(e);
+}
+
+// Make e runnable again at time_msec() 'deadline', unless something
+// else wakes it first.  The caller holds env_lock(e) and is about to
+// block e.
+void
+env_set_timeout(struct Env *e, unsigned deadline)
+{
+	struct EnvTimeout *et = &env_timeouts[e - envs];
+
+	if (!et->et_armed && e->env_type == ENV_TYPE_USER)
+		xadd(&user_timeouts, 1);
+	et->et_armed = true;
+	et->et_timer.tm_func = env_timeout;
+	et->et_timer.tm_arg = e;
+	timer_add(&et->et_timer, deadline);
+}
+
+// Forget e's timeout, if it has one.  The caller holds env_lock(e).
+void
+env_cancel_timeout(struct Env *e)
+{
+	struct EnvTimeout *et = &env_timeouts[e - envs];
+
+	if (!et->et_armed)
+		return;
+	env_disarm(e, et);
+	timer_cancel(&et->et_timer);
+}
+
+// Is some ENV_TYPE_USER environment waiting for a timeout?
+bool
+env_user_timeouts(void)
+{
+	return user_timeouts != 0;
+}
+
 // Mark all environments in 'envs' as free, set their env_ids to 0,
 // and insert them into the env_free_list.
 // Make sure the environments are in the free list in the same order
@@ -122,12 +254,20 @@ env_init(void)
     int i;
     struct Env *next_env = NULL;
     
+    spin_initlock(&env_table_lock);
     for (i = NENV - 1; i >= 0; i--) {
         envs[i].env_link = next_env;
+        envs[i].env_rq_cpu = -1;
         next_env = &envs[i];
+        __spin_initlock(&env_locks[i], "env_lock");
     }
     
     env_free_list = envs;
+
+	if (!(env_zero_page = page_alloc(ALLOC_ZERO)))
+		panic("env_init: no memory for the zero page");
+	env_zero_page->pp_ref++;
+
 	// Per-CPU part of the initialization
 	env_init_percpu();
 }
@@ -191,6 +331,11 @@ env_setup_vm(struct Env *e)
 	//    - The functions in kern/pmap.h are handy.
 
 	// LAB 3: Your code here.
+	if (pgdir_mem_alloc(page2kva(p)) < 0) {
+		page_free(p);
+		return -E_NO_MEM;
+	}
+	p->pp_ref++;
     e->env_pgdir = page2kva(p);
     for (i = 0; i <= 0xFFFFFFFF - UTOP; i += PTSIZE) {
         e->env_pgdir[PDX(UTOP + i)] = kern_pgdir[PDX(UTOP + i)];
@@ -214,14 +359,28 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 {
 	int32_t generation;
 	int r;
-	struct Env *e;
+	struct Env *e, *parent;
 
-	if (!(e = env_free_list))
+	spin_lock(&env_table_lock);
+	if (!(e = env_free_list)) {
+		spin_unlock(&env_table_lock);
 		return -E_NO_FREE_ENV;
+	}
+	env_free_list = e->env_link;
+	spin_unlock(&env_table_lock);
 
 	// Allocate and set up the page directory for this environment.
-	if ((r = env_setup_vm(e)) < 0)
+	if ((r = env_setup_vm(e)) < 0) {
+		spin_lock(&env_table_lock);
+		e->env_link = env_free_list;
+		env_free_list = e;
+		spin_unlock(&env_table_lock);
 		return r;
+	}
+
+	// A system call holding a stale envid for this slot may be waiting
+	// for the slot's lock; it rechecks env_id once it gets it.
+	env_lock(e);
 
 	// Generate an env_id for this environment.
 	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
@@ -232,8 +391,23 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	// Set the basic status variables.
 	e->env_parent_id = parent_id;
 	e->env_type = ENV_TYPE_USER;
-	e->env_status = ENV_RUNNABLE;
 	e->env_runs = 0;
+	e->env_cpunum = cpunum();
+	e->env_priority = e->env_level = ENV_PRIO_DEFAULT;
+	e->env_slice = 0;
+	e->env_affinity = ~0;
+	// Children of an env whose pages are merged have theirs merged too
+	// (see kern/ksm.c).
+	parent = &envs[ENVX(parent_id)];
+	e->env_ksm = parent_id && parent->env_id == parent_id &&
+		     parent->env_ksm;
+	memset(&e->env_stats, 0, sizeof(e->env_stats));
+
+	// The new env is not on any run queue yet.  The caller finishes
+	// setting it up and then makes it runnable with sched_wakeup().
+	e->env_status = ENV_NOT_RUNNABLE;
+
+	env_unlock(e);
 
 	// Clear out all the saved register state,
 	// to prevent the register values
@@ -262,12 +436,11 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
+	e->env_xstacktop = UXSTACKTOP;
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
 
-	// commit the allocation
-	env_free_list = e->env_link;
 	*newenv_store = e;
 
 	cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
@@ -326,6 +499,126 @@ region_alloc(struct Env *e, void *va, size_t len)
     
 }
 
+//
+// Reserve [va, va+len) in e's address space as demand-zero memory with
+// permissions 'perm': page_fault_handler() backs each page with zeroes
+// when it is first touched (see env_region_fault()).  Pages already
+// mapped in the range stay as they are.  The regions belong to the
+// address space, so the threads of e share them.
+//
+// Returns 0 on success, < 0 on error:
+//	-E_INVAL if the range overlaps another region of e.
+//	-E_NO_MEM if e has NENVREGION regions already.
+//
+int
+env_region_reserve(struct Env *e, uintptr_t va, size_t len, int perm)
+{
+	struct EnvRegion *regions = pgdir_mem(e->env_pgdir)->pm_regions;
+	struct EnvRegion *r, *slot = NULL;
+	uintptr_t end = ROUNDUP(va + len, PGSIZE);
+
+	va = ROUNDDOWN(va, PGSIZE);
+	for (r = regions; r < regions + NENVREGION; r++) {
+		if (!r->er_end)
+			slot = slot ? slot : r;
+		else if (va < r->er_end && r->er_start < end)
+			return -E_INVAL;
+	}
+	if (!slot)
+		return -E_NO_MEM;
+
+	env_lock(e);
+	slot->er_start = va;
+	slot->er_perm = perm;
+	slot->er_end = end;
+	env_unlock(e);
+	return 0;
+}
+
+//
+// Forget the demand-zero regions of e inside [va, va+len).  The pages
+// already backing them stay mapped.
+//
+// Returns 0 on success, -E_INVAL if a region of e is only partly inside
+// the range; then none is forgotten.
+//
+int
+env_region_release(struct Env *e, uintptr_t va, size_t len)
+{
+	struct EnvRegion *regions = pgdir_mem(e->env_pgdir)->pm_regions;
+	struct EnvRegion *r;
+	uintptr_t end = va + len;
+
+	for (r = regions; r < regions + NENVREGION; r++)
+		if (r->er_end && va < r->er_end && r->er_start < end &&
+		    (r->er_start < va || end < r->er_end))
+			return -E_INVAL;
+
+	env_lock(e);
+	for (r = regions; r < regions + NENVREGION; r++)
+		if (r->er_end && va <= r->er_start && r->er_end <= end)
+			r->er_end = 0;
+	env_unlock(e);
+	return 0;
+}
+
+// Give 'dst' copies of the demand-zero regions of 'src', for fork.
+void
+env_region_copy(struct Env *dst, struct Env *src)
+{
+	memmove(pgdir_mem(dst->env_pgdir)->pm_regions,
+		pgdir_mem(src->env_pgdir)->pm_regions,
+		sizeof(pgdir_mem(dst->env_pgdir)->pm_regions));
+}
+
+//
+// Back the page at 'va' of a demand-zero region of e.  A write gets a
+// zeroed page of its own.  A read gets the shared zero page, read-only,
+// and copy-on-write if the region is writable, so that memory that is
+// only ever read costs nothing.  If a page was mapped at 'va' meanwhile,
+// it is left alone.
+//
+// Returns 0 on success, < 0 on error:
+//	-E_FAULT if no region of e covers 'va', or 'write' is set and the
+//		region is read-only.
+//	-E_NO_MEM if there is no memory for the page or a page table.
+//
+int
+env_region_fault(struct Env *e, uintptr_t va, bool write)
+{
+	struct EnvRegion *regions = pgdir_mem(e->env_pgdir)->pm_regions;
+	struct EnvRegion *r;
+	struct PageInfo *pp = env_zero_page;
+	int perm, error = 0;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	for (r = regions; r < regions + NENVREGION; r++)
+		if (r->er_start <= va && va < r->er_end)
+			break;
+	if (r == regions + NENVREGION)
+		return -E_FAULT;
+
+	perm = r->er_perm;
+	if (write && !(perm & PTE_W))
+		return -E_FAULT;
+	if (!write && (perm & PTE_W))
+		perm = (perm & ~PTE_W) | PTE_COW;
+	// Zero the page before taking the lock.
+	if (write && !(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+
+	env_lock(e);
+	if (!page_lookup(e->env_pgdir, (void *) va, NULL))
+		error = page_insert(e->env_pgdir, pp, (void *) va, perm);
+	else if (write)
+		page_free(pp);
+	env_unlock(e);
+
+	if (error < 0 && write)
+		page_free(pp);
+	return error;
+}
+
 //
 // Set up the initial program binary, stack, and processor flags
 // for a user process.
@@ -383,6 +676,7 @@ load_icode(struct Env *e, uint8_t *binary)
 	struct Elf *elf;
 	struct Proghdr *ph, *eph;
 	struct Secthdr *sh;
+	uintptr_t bss;
 	
 	elf = (struct Elf *) binary;
 	
@@ -395,11 +689,23 @@ load_icode(struct Env *e, uint8_t *binary)
 	ph = (struct Proghdr *) (binary + elf->e_phoff);
 	eph = ph + elf->e_phnum;
 	
+	// Only the pages with file data are allocated now; the rest of
+	// each segment (the BSS) is demand-zero. A segment with no file
+	// data is demand-zero from its first page on.
 	for (; ph < eph; ph++) {
 		if (ph->p_type != ELF_PROG_LOAD)
 			continue;
-		region_alloc(e, (uint8_t *) ph->p_va, ph->p_memsz);
+		if (ph->p_filesz)
+			region_alloc(e, (uint8_t *) ph->p_va, ph->p_filesz);
 		memcpy((uint8_t *) ph->p_va, binary + ph->p_offset, ph->p_filesz);
+		if (ph->p_filesz)
+			bss = ROUNDUP(ph->p_va + ph->p_filesz, PGSIZE);
+		else
+			bss = ROUNDDOWN(ph->p_va, PGSIZE);
+		if (bss < ph->p_va + ph->p_memsz &&
+		    env_region_reserve(e, bss, ph->p_va + ph->p_memsz - bss,
+				       PTE_P | PTE_U | PTE_W) < 0)
+			panic("load_icode: too many segments");
 	}
 	
 	lcr3(prev_cr3);
@@ -434,12 +740,18 @@ env_create(uint8_t *binary, enum EnvType type)
 	
 	e->env_type = type;
 	
+	// The file and network servers are latency sensitive.
+	if (type != ENV_TYPE_USER)
+		e->env_priority = e->env_level = ENV_PRIO_MAX;
+	
 	load_icode(e, binary);
 
 	// If this is the file server (type == ENV_TYPE_FS) give it I/O privileges.
 	// LAB 5: Your code here.
 	if (type == ENV_TYPE_FS)
 		e->env_tf.tf_eflags = (e->env_tf.tf_eflags & ~FL_IOPL_MASK) | FL_IOPL_3;
+
+	sched_wakeup(e);
 }
 
 //
@@ -448,9 +760,11 @@ env_create(uint8_t *binary, enum EnvType type)
 void
 env_free(struct Env *e)
 {
+	pde_t *pgdir;
 	pte_t *pt;
 	uint32_t pdeno, pteno;
 	physaddr_t pa;
+	uintptr_t va;
 
 	// If freeing the current environment, switch to kern_pgdir
 	// before freeing the page directory, just in case the page
@@ -461,14 +775,32 @@ env_free(struct Env *e)
 	// Note the environment's demise.
 	cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
-	// Flush all mapped pages in the user portion of the address space
+	// Other CPUs may be mapping pages into e or sending it a message
+	// without the big kernel lock.  They see ENV_FREE once we are done.
+	env_lock(e);
+	env_cancel_timeout(e);
+
+	// Threads share their page directory (see sys_thread_create()).
+	// The last one to go frees it; the others only take along the
+	// stacks of their thread slot.
+	if (pgdir_shared(e->env_pgdir))
+		for (va = UTHREADSTACKTOP(ENVX(e->env_id)) - THREADSTACK;
+		     va < UTHREADXSTACKTOP(ENVX(e->env_id)); va += PGSIZE)
+			page_remove(e->env_pgdir, (void *) va);
 	static_assert(UTOP % PTSIZE == 0);
-	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+	for (pdeno = 0; pdeno < PDX(UTOP) && !pgdir_shared(e->env_pgdir);
+	     pdeno++) {
 
 		// only look at mapped page tables
 		if (!(e->env_pgdir[pdeno] & PTE_P))
 			continue;
 
+		// a 4MB page has no page table
+		if (e->env_pgdir[pdeno] & PTE_PS) {
+			page_remove(e->env_pgdir, PGADDR(pdeno, 0, 0));
+			continue;
+		}
+
 		// find the pa and va of the page table
 		pa = PTE_ADDR(e->env_pgdir[pdeno]);
 		pt = (pte_t*) KADDR(pa);
@@ -485,14 +817,23 @@ env_free(struct Env *e)
 	}
 
 	// free the page directory
-	pa = PADDR(e->env_pgdir);
+	pgdir = e->env_pgdir;
 	e->env_pgdir = 0;
-	page_decref(pa2page(pa));
+	pgdir_decref(pgdir);
+
+	// forget about any run queue or device wait the env was on
+	sched_dequeue(e);
+	if (e->env_e1000_receiving)
+		e1000_rx_cancel(e);
 
-	// return the environment to the free list
 	e->env_status = ENV_FREE;
+	env_unlock(e);
+
+	// return the environment to the free list
+	spin_lock(&env_table_lock);
 	e->env_link = env_free_list;
 	env_free_list = e;
+	spin_unlock(&env_table_lock);
 }
 
 //
@@ -503,9 +844,14 @@ env_free(struct Env *e)
 void
 env_destroy(struct Env *e)
 {
+	// Freeing an environment needs the big kernel lock, which system
+	// calls that run without it (see syscall_unlocked()) don't hold.
+	if (!kernel_lock_held())
+		lock_kernel();
+
 	// If e is currently running on other CPUs, we change its state to
 	// ENV_DYING. A zombie environment will be freed the next time
-	// it traps to the kernel.
+	// it traps to the kernel or its CPU calls sched_yield().
 	if (e->env_status == ENV_RUNNING && curenv != e) {
 		e->env_status = ENV_DYING;
 		return;
@@ -520,6 +866,170 @@ env_destroy(struct Env *e)
 }
 
 
+//
+// CPU accounting.  Each CPU remembers in cpu_acct_tsc when its env last
+// entered the kernel or left it.  The cycles between leaving it and the
+// next trap are user time; those between a trap and the next env_run()
+// are kernel time of the env that trapped.  Kernel time spent after
+// curenv is gone (idle, or freeing a dead env) is not charged.
+//
+
+// Called on every trap from user mode.
+void
+env_account_trap(struct Env *e, struct Trapframe *tf)
+{
+	uint64_t now = read_tsc();
+
+	e->env_stats.es_user_cycles += now - thiscpu->cpu_acct_tsc;
+	thiscpu->cpu_acct_tsc = now;
+
+	if (tf->tf_trapno == T_SYSCALL &&
+	    tf->tf_regs.reg_eax < NSYSCALLS)
+		e->env_stats.es_syscalls[tf->tf_regs.reg_eax]++;
+	else if (tf->tf_trapno == T_PGFLT)
+		e->env_stats.es_pgfaults++;
+}
+
+// Called on the way back to user mode, for the env that trapped.
+void
+env_account_kernel(struct Env *e)
+{
+	uint64_t now = read_tsc();
+
+	if (e)
+		e->env_stats.es_kern_cycles += now - thiscpu->cpu_acct_tsc;
+	thiscpu->cpu_acct_tsc = now;
+}
+
+// 'e' is giving up this CPU.  The switch was voluntary if e blocked,
+// died or yielded; otherwise it was preempted.
+void
+env_account_switch(struct Env *e)
+{
+	if (e->env_status == ENV_RUNNING && !thiscpu->cpu_yielded)
+		e->env_stats.es_iswitches++;
+	else
+		e->env_stats.es_vswitches++;
+	thiscpu->cpu_yielded = false;
+}
+
+static uint64_t
+env_total_cycles(struct Env *e)
+{
+	return e->env_stats.es_user_cycles + e->env_stats.es_kern_cycles;
+}
+
+// Print the accounting of the 'limit' environments that used the most
+// CPU time (all of them if limit is 0), busiest first.  Cycle counts are
+// in units of 1024 cycles ("kc"), which printfmt can print.
+void
+env_print_stats(int limit)
+{
+	static const char status_char[] = {
+		[ENV_FREE] = '-', [ENV_DYING] = 'D', [ENV_RUNNABLE] = 'r',
+		[ENV_RUNNING] = 'R', [ENV_NOT_RUNNABLE] = 'B',
+	};
+	static struct Env *order[NENV];
+	struct EnvStats *st;
+	struct Env *e;
+	uint32_t nsys;
+	int i, j, n = 0;
+
+	// Insertion sort of the live envs by total cycles.
+	for (i = 0; i < NENV; i++) {
+		e = &envs[i];
+		if (e->env_status == ENV_FREE)
+			continue;
+		for (j = n++; j > 0 && env_total_cycles(order[j - 1]) <
+			     env_total_cycles(e); j--)
+			order[j] = order[j - 1];
+		order[j] = e;
+	}
+	if (limit > 0 && limit < n)
+		n = limit;
+
+	cprintf("%8s %2s %3s %8s %10s %10s %7s %7s %8s %6s\n", "envid", "st",
+		"cpu", "runs", "user(kc)", "kern(kc)", "vsw", "isw",
+		"syscalls", "faults");
+	for (i = 0; i < n; i++) {
+		e = order[i];
+		st = &e->env_stats;
+		for (nsys = j = 0; j < NSYSCALLS; j++)
+			nsys += st->es_syscalls[j];
+		cprintf("%08x  %c %3d %8u %10u %10u %7u %7u %8u %6u\n",
+			e->env_id, status_char[e->env_status], e->env_cpunum,
+			e->env_runs, (uint32_t) (st->es_user_cycles >> 10),
+			(uint32_t) (st->es_kern_cycles >> 10),
+			st->es_vswitches, st->es_iswitches, nsys,
+			st->es_pgfaults);
+	}
+}
+
+// Fill 'buf' with the memory of up to 'n' live environments, in envs[]
+// order.  Returns the number of live environments, which may be more
+// than 'n'.
+int
+env_meminfo(struct EnvMemInfo *buf, int n)
+{
+	struct Env *e;
+	int i, count = 0;
+
+	for (i = 0; i < NENV; i++) {
+		e = &envs[i];
+		if (e->env_status == ENV_FREE)
+			continue;
+		// env_free() tears down the mappings under the env lock.
+		env_lock(e);
+		if (e->env_status != ENV_FREE && e->env_pgdir) {
+			if (count < n) {
+				pgdir_meminfo(e->env_pgdir, &buf[count]);
+				buf[count].em_envid = e->env_id;
+			}
+			count++;
+		}
+		env_unlock(e);
+	}
+	return count;
+}
+
+// Print the physical memory that is free and used, and how much of it
+// each environment holds, in KB.
+void
+env_print_meminfo(void)
+{
+	static struct EnvMemInfo info[NENV];
+	struct MemInfo mi;
+	int i, n;
+
+	page_meminfo(&mi);
+	cprintf("memory: %uK total, %uK free (%uK zeroed), %uK used\n",
+		mi.mi_total * (PGSIZE / 1024), mi.mi_free * (PGSIZE / 1024),
+		mi.mi_zeroed * (PGSIZE / 1024), mi.mi_used * (PGSIZE / 1024));
+	cprintf("merging identical pages saves %uK\n",
+		mi.mi_merged * (PGSIZE / 1024));
+
+	n = env_meminfo(info, NENV);
+	cprintf("%8s %9s %9s %9s\n", "envid", "resident", "shared",
+		"ptables");
+	for (i = 0; i < n; i++)
+		cprintf("%08x %8uK %8uK %8uK\n", info[i].em_envid,
+			info[i].em_resident * (PGSIZE / 1024),
+			info[i].em_shared * (PGSIZE / 1024),
+			info[i].em_ptables * (PGSIZE / 1024));
+}
+
+// Print how often env 'e' made each system call.
+void
+env_print_syscalls(struct Env *e)
+{
+	int i;
+
+	for (i = 0; i < NSYSCALLS; i++)
+		if (e->env_stats.es_syscalls[i])
+			cprintf("  syscall %2d: %u\n", i,
+				e->env_stats.es_syscalls[i]);
+}
+
 //
 // Restores the register values in the Trapframe with the 'iret' instruction.
 // This exits the kernel and starts executing some environment's code.
@@ -529,9 +1039,6 @@ env_destroy(struct Env *e)
 void
 env_pop_tf(struct Trapframe *tf)
 {
-	// Record the CPU we are running on for user-space debugging
-	curenv->env_cpunum = cpunum();
-	
 	__asm __volatile("movl %0,%%esp\n"
 		"\tpopal\n"
 		"\tpopl %%es\n"
@@ -551,6 +1058,8 @@ env_pop_tf(struct Trapframe *tf)
 void
 env_run(struct Env *e)
 {
+	bool stale = false;
+
 	// Step 1: If this is a context switch (a new environment is running):
 	//	   1. Set the current environment (if any) back to
 	//	      ENV_RUNNABLE if it is ENV_RUNNING (think about
@@ -570,20 +1079,59 @@ env_run(struct Env *e)
 
 	// LAB 3: Your code here.
 
-	if (curenv && e->env_id == curenv->env_id)
+	// The env we run is never left on a run queue.
+	sched_dequeue(e);
+
+	// The kernel time since the last trap was spent for curenv.
+	env_account_kernel(curenv);
+
+	if (curenv && e->env_id == curenv->env_id) {
+		stale = true;
 		goto env_run_no_cs;
+	}
+	trace_event(TRACE_SWITCH, e->env_id, 0, 0);
 	
-	if (curenv && curenv->env_status == ENV_RUNNING)
+	// The env we switch away from goes back to a run queue if it
+	// can still run.
+	if (curenv)
+		env_account_switch(curenv);
+	if (curenv && curenv->env_status == ENV_RUNNING) {
+		env_lock(curenv);
 		curenv->env_status = ENV_RUNNABLE;
+		sched_enqueue(curenv);
+		env_unlock(curenv);
+	}
 	
 	curenv = e;
-	curenv->env_status = ENV_RUNNING;
 	curenv->env_runs++;
 	
 	lcr3(PADDR(curenv->env_pgdir));
 	
 env_run_no_cs:
-	unlock_kernel();
+	// An env picked from a run queue is ENV_RUNNABLE.  If we are only
+	// returning to curenv, leave its status alone: another CPU may have
+	// just marked it ENV_DYING.  Unlocked system calls only change the
+	// mappings of envs that are not running (see env_mappable() in
+	// kern/syscall.c), so wait for them before the env starts running.
+	if (curenv->env_status == ENV_RUNNABLE) {
+		env_lock(curenv);
+		curenv->env_status = ENV_RUNNING;
+		env_unlock(curenv);
+		// Back to curenv after it blocked, with its page directory
+		// still loaded.  A sender may have mapped a page at its
+		// dstva meanwhile, flushing only its own CPU's TLB.
+		if (stale)
+			lcr3(PADDR(curenv->env_pgdir));
+	}
+
+	// Record the CPU we are running on for user-space debugging
+	curenv->env_cpunum = cpunum();
+	thiscpu->cpu_yielded = false;
+
+	// Unlocked system calls return here without the big kernel lock.
+	if (kernel_lock_held())
+		unlock_kernel();
+	tlb_enter_user();
 	env_pop_tf(&curenv->env_tf);
 	
 	panic("env_run not yet implemented");
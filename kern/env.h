@@ -4,6 +4,7 @@
 #define JOS_KERN_ENV_H
 
 #include <inc/env.h>
+#include <inc/meminfo.h>
 #include <kern/cpu.h>
 
 extern struct Env *envs;		// All environments
@@ -18,6 +19,24 @@ void	env_create(uint8_t *binary, enum EnvType type);
 void	env_destroy(struct Env *e);	// Does not return if e == curenv
 
 int	envid2env(envid_t envid, struct Env **env_store, bool checkperm);
+int	env_region_reserve(struct Env *e, uintptr_t va, size_t len, int perm);
+int	env_region_release(struct Env *e, uintptr_t va, size_t len);
+void	env_region_copy(struct Env *dst, struct Env *src);
+int	env_region_fault(struct Env *e, uintptr_t va, bool write);
+void	env_lock(struct Env *e);
+void	env_unlock(struct Env *e);
+void	env_lock_pair(struct Env *a, struct Env *b);
+void	env_unlock_pair(struct Env *a, struct Env *b);
+void	env_set_timeout(struct Env *e, unsigned deadline);
+void	env_cancel_timeout(struct Env *e);
+bool	env_user_timeouts(void);
+void	env_account_trap(struct Env *e, struct Trapframe *tf);
+void	env_account_kernel(struct Env *e);
+void	env_account_switch(struct Env *e);
+void	env_print_stats(int limit);
+void	env_print_syscalls(struct Env *e);
+int	env_meminfo(struct EnvMemInfo *buf, int n);
+void	env_print_meminfo(void);
 // The following two functions do not return
 void	env_run(struct Env *e) __attribute__((noreturn));
 void	env_pop_tf(struct Trapframe *tf) __attribute__((noreturn));
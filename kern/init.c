@@ -17,6 +17,8 @@
 #include <kern/time.h>
 #include <kern/pci.h>
 #include <kern/sb16.h>
+#include <kern/slab.h>
+#include <kern/ksm.h>
 
 static void boot_aps(void);
 
@@ -39,9 +41,12 @@ i386_init(void)
 
 	// Lab 2 memory management initialization functions
 	mem_init();
+	kmem_init();
+	ksm_init();
 
 	// Lab 3 user environment initialization functions
 	env_init();
+	sched_init();
 	trap_init();
 
 	// Lab 4 multiprocessor initialization functions
@@ -130,6 +135,8 @@ void
 mp_main(void)
 {
 	// We are in high EIP now, safe to switch to kern_pgdir 
+	// (which maps memory with 4MB pages if the BSP found PSE).
+	lcr4(rcr4() | (page_pse ? CR4_PSE : 0) | (page_pge ? CR4_PGE : 0));
 	lcr3(PADDR(kern_pgdir));
 	cprintf("SMP: CPU %d starting\n", cpunum());
 
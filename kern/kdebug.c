@@ -112,6 +112,17 @@ stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
 //
 int
 debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+	return debuginfo_eip_env(addr, info, curenv);
+}
+
+// debuginfo_eip_env(addr, info, env)
+//
+//	Like debuginfo_eip(), but look up user addresses in the stabs of
+//	'env', whose address space must be the one loaded.
+//
+int
+debuginfo_eip_env(uintptr_t addr, struct Eipdebuginfo *info, struct Env *env)
 {
 	const struct Stab *stabs, *stab_end;
 	const char *stabstr, *stabstr_end;
@@ -142,6 +153,8 @@ debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
 		// Make sure this memory is valid.
 		// Return -1 if it is not.  Hint: Call user_mem_check.
 		// LAB 3: Your code here.
+		if (!env || user_mem_check(env, usd, sizeof(*usd), PTE_U) < 0)
+			return -1;
 
 		stabs = usd->stabs;
 		stab_end = usd->stab_end;
@@ -150,6 +163,12 @@ debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
 
 		// Make sure the STABS and string table memory is valid.
 		// LAB 3: Your code here.
+		if (stab_end < stabs || stabstr_end < stabstr)
+			return -1;
+		if (user_mem_check(env, stabs, (stab_end - stabs) * sizeof(*stabs),
+				   PTE_U) < 0 ||
+		    user_mem_check(env, stabstr, stabstr_end - stabstr, PTE_U) < 0)
+			return -1;
 	}
 
 	// String table validity checks
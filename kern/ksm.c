@@ -0,0 +1,328 @@
+// Kernel same-page merging.
+//
+// CPUs with nothing to run scan the private pages of the envs that asked
+// for it (see sys_env_set_ksm()) and map identical pages to a single
+// copy, read-only and copy-on-write where they were writable.  The first
+// write to a merged page gets a private copy again, as after fork.
+//
+// A page is hashed and looked up in a table of KSM_NSLOTS slots, indexed
+// by the hash.  A slot remembers either a merged page, which it holds a
+// reference to, or where a page with that hash was last seen.  When the
+// hash of a page finds a merged page with the same contents, the page is
+// replaced with it; when it finds another page with the same contents,
+// that page becomes the merged page and the two are merged.  A merged
+// page is never written in place, since the table's reference keeps
+// every mapping of it copy-on-write.  The table lets go of it once no
+// one else maps it.
+//
+// The scan runs without the big kernel lock, on CPUs about to halt (see
+// sched_halt()).  ksm_lock protects the table and the scan position.
+// An env is only looked at under its env lock, which env_run() takes to
+// make it ENV_RUNNING and every change to its mappings takes.  Envs that
+// are running on some CPU, or waiting for the e1000 to write a packet
+// into their memory, are skipped, as are threads, whose address space
+// other envs change under the big kernel lock, and pages anything else
+// maps: pp_ref must be 1.
+//
+// The scan is rate limited to ksm_rate pages per second, and to
+// KSM_BATCH pages at a time.
+
+#include <inc/assert.h>
+#include <inc/string.h>
+#include <kern/ksm.h>
+#include <kern/pmap.h>
+#include <kern/env.h>
+#include <kern/cpu.h>
+#include <kern/time.h>
+#include <kern/spinlock.h>
+
+#define KSM_NSLOTS	1024		// Slots of the table
+#define KSM_BATCH	16		// Most pages scanned in a row
+#define KSM_LOOKS	64		// Most PTEs or envs skipped per page
+
+struct KsmSlot {
+	uint32_t ks_hash;		// Hash of the page's contents
+	struct PageInfo *ks_page;	// The merged page, or NULL
+	envid_t ks_envid;		// Else where the page was seen, or 0
+	uintptr_t ks_va;
+};
+
+static struct spinlock ksm_lock;
+static struct KsmSlot ksm_slots[KSM_NSLOTS];
+static unsigned ksm_rate = KSM_RATE_DEFAULT;
+static unsigned ksm_tokens;		// Pages that may be scanned now
+static unsigned ksm_last_msec;		// When ksm_tokens was refilled
+
+// The scan position: the env and the address in it.
+static int ksm_envx;
+static uintptr_t ksm_va;
+static int ksm_sweep;			// Next slot to check for release
+
+static uint32_t ksm_scanned;		// Pages hashed
+static uint32_t ksm_merges;		// Pages replaced with merged ones
+
+void
+ksm_init(void)
+{
+	spin_initlock(&ksm_lock);
+}
+
+// Set the scan rate to 'rate' pages per second.  0 stops the scanner.
+void
+ksm_set_rate(unsigned rate)
+{
+	spin_lock(&ksm_lock);
+	ksm_rate = MIN(rate, KSM_RATE_MAX);
+	ksm_tokens = 0;
+	ksm_last_msec = time_msec();
+	spin_unlock(&ksm_lock);
+}
+
+// May another page be scanned now?  Takes it out of the budget.  The
+// caller holds ksm_lock.
+static bool
+ksm_take_token(void)
+{
+	unsigned now, elapsed;
+
+	if (!ksm_tokens) {
+		now = time_msec();
+		elapsed = MIN(now - ksm_last_msec, 1000);
+		if (!(ksm_tokens = MIN(elapsed * ksm_rate / 1000, KSM_BATCH)))
+			return false;
+		ksm_last_msec = now;
+	}
+	ksm_tokens--;
+	return true;
+}
+
+static uint32_t
+ksm_hash(const uint32_t *w)
+{
+	uint32_t h = 2166136261U;
+	int i;
+
+	for (i = 0; i < PGSIZE / 4; i++)
+		h = (h ^ w[i]) * 16777619U;
+	return h;
+}
+
+// Is an env on 'pgdir' running on some CPU?
+static bool
+ksm_pgdir_running(pde_t *pgdir)
+{
+	int i;
+
+	for (i = 0; i < ncpu; i++)
+		if (cpus[i].cpu_env && cpus[i].cpu_env->env_pgdir == pgdir)
+			return true;
+	return false;
+}
+
+// May the pages of 'e' be merged right now?  The caller holds its lock.
+static bool
+ksm_env_ok(struct Env *e)
+{
+	return e->env_ksm && e->env_pgdir && e->env_status != ENV_FREE &&
+	       e->env_status != ENV_DYING && e->env_status != ENV_RUNNING &&
+	       !e->env_e1000_receiving && !pgdir_shared(e->env_pgdir) &&
+	       !ksm_pgdir_running(e->env_pgdir);
+}
+
+// The page of 'e' at 'va', if it could be merged: a private user page.
+// Also stores its PTE in *pte_store.  The caller holds e's lock.
+static struct PageInfo *
+ksm_candidate(struct Env *e, uintptr_t va, pte_t **pte_store)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+
+	pte = pgdir_walk(e->env_pgdir, (void *) va, 0);
+	if (!pte || (*pte & (PTE_P | PTE_U | PTE_SHARE | PTE_PS)) !=
+		    (PTE_P | PTE_U))
+		return NULL;
+	pp = pa2page(PTE_ADDR(*pte));
+	if (pp->pp_ref != 1 || pp->pp_large)
+		return NULL;
+	*pte_store = pte;
+	return pp;
+}
+
+// Make the page of 'e' at 'va' copy-on-write if it is writable.
+static void
+ksm_protect(struct Env *e, uintptr_t va, pte_t *pte)
+{
+	if (*pte & PTE_W) {
+		*pte = (*pte & ~PTE_W) | PTE_COW;
+		tlb_invalidate(e->env_pgdir, (void *) va);
+	}
+}
+
+// Replace the page of 'e' at 'va' with the merged page 'pp'.
+static void
+ksm_map(struct Env *e, uintptr_t va, pte_t *pte, struct PageInfo *pp)
+{
+	int perm = *pte & PTE_SYSCALL;
+
+	if (perm & (PTE_W | PTE_COW))
+		perm = (perm & ~PTE_W) | PTE_COW;
+	// The page table is there, so this cannot fail.
+	if (page_insert(e->env_pgdir, pp, (void *) va, perm) == 0)
+		ksm_merges++;
+}
+
+// Drop the merged page of 's' if the table is all that holds it.
+static void
+ksm_release(struct KsmSlot *s)
+{
+	if (s->ks_page && s->ks_page->pp_ref == 1) {
+		page_decref(s->ks_page);
+		s->ks_page = NULL;
+		s->ks_envid = 0;
+	}
+}
+
+// Hash the page of 'e' at 'va' and merge it if the table knows of an
+// identical one.  The caller holds ksm_lock.
+static void
+ksm_scan(struct Env *e, uintptr_t va)
+{
+	struct KsmSlot *s;
+	struct PageInfo *pp, *up;
+	struct Env *ue;
+	pte_t *pte, *upte;
+	uint32_t hash;
+	bool merged = false;
+
+	env_lock(e);
+	if (!ksm_env_ok(e) || !(pp = ksm_candidate(e, va, &pte))) {
+		env_unlock(e);
+		return;
+	}
+	hash = ksm_hash(page2kva(pp));
+	env_unlock(e);
+	ksm_scanned++;
+
+	s = &ksm_slots[hash % KSM_NSLOTS];
+	ksm_release(s);
+	if (s->ks_hash == hash && s->ks_page) {
+		env_lock(e);
+		if (ksm_env_ok(e) && ksm_candidate(e, va, &pte) == pp &&
+		    memcmp(page2kva(pp), page2kva(s->ks_page), PGSIZE) == 0)
+			ksm_map(e, va, pte, s->ks_page);
+		env_unlock(e);
+		return;
+	}
+	if (s->ks_page)
+		return;
+
+	// Another page of the same hash, maybe: if it is still there and
+	// the same, it becomes the merged page.
+	ue = &envs[ENVX(s->ks_envid)];
+	if (s->ks_hash == hash && s->ks_envid &&
+	    (ue != e || s->ks_va != va)) {
+		env_lock_pair(e, ue);
+		if (ue->env_id == s->ks_envid && ksm_env_ok(e) &&
+		    ksm_env_ok(ue) && ksm_candidate(e, va, &pte) == pp &&
+		    (up = ksm_candidate(ue, s->ks_va, &upte)) &&
+		    memcmp(page2kva(pp), page2kva(up), PGSIZE) == 0) {
+			ksm_protect(ue, s->ks_va, upte);
+			page_incref(up);
+			s->ks_page = up;
+			ksm_map(e, va, pte, up);
+			merged = true;
+		}
+		env_unlock_pair(e, ue);
+	}
+	if (!merged) {
+		s->ks_hash = hash;
+		s->ks_envid = e->env_id;
+		s->ks_va = va;
+	}
+}
+
+//
+// Scan a page of the envs that want theirs merged, if the rate allows.
+// Called by a CPU that has nothing to run, without the big kernel lock.
+// Returns false if there was nothing to do.
+//
+bool
+ksm_idle(void)
+{
+	struct Env *e;
+	pde_t pde;
+	uintptr_t va;
+	int i;
+
+	if (!ksm_rate)
+		return false;
+	spin_lock(&ksm_lock);
+	if (!ksm_take_token()) {
+		spin_unlock(&ksm_lock);
+		return false;
+	}
+
+	// Let go of a merged page no one maps any more.
+	ksm_release(&ksm_slots[ksm_sweep]);
+	ksm_sweep = (ksm_sweep + 1) % KSM_NSLOTS;
+
+	for (i = 0; i < KSM_LOOKS; i++) {
+		e = &envs[ksm_envx];
+		if (ksm_va >= UTOP || !e->env_ksm || !e->env_pgdir ||
+		    e->env_status == ENV_FREE) {
+			ksm_envx = (ksm_envx + 1) % NENV;
+			ksm_va = 0;
+			continue;
+		}
+		// Racy, but ksm_scan() looks again under the lock.
+		pde = e->env_pgdir[PDX(ksm_va)];
+		if (!(pde & PTE_P) || (pde & PTE_PS)) {
+			ksm_va = ROUNDDOWN(ksm_va, PTSIZE) + PTSIZE;
+			continue;
+		}
+		va = ksm_va;
+		ksm_va += PGSIZE;
+		ksm_scan(e, va);
+		spin_unlock(&ksm_lock);
+		return true;
+	}
+	// Nothing found yet; give the token back.
+	ksm_tokens++;
+	spin_unlock(&ksm_lock);
+	return false;
+}
+
+// The pages merging saves: the mappings of the merged pages, less one
+// each for the merged pages themselves.
+uint32_t
+ksm_saved(void)
+{
+	uint32_t saved = 0;
+	int i;
+
+	spin_lock(&ksm_lock);
+	for (i = 0; i < KSM_NSLOTS; i++)
+		if (ksm_slots[i].ks_page && ksm_slots[i].ks_page->pp_ref > 2)
+			saved += ksm_slots[i].ks_page->pp_ref - 2;
+	spin_unlock(&ksm_lock);
+	return saved;
+}
+
+void
+ksm_report(void)
+{
+	uint32_t shared = 0, sharing = 0;
+	int i;
+
+	spin_lock(&ksm_lock);
+	for (i = 0; i < KSM_NSLOTS; i++)
+		if (ksm_slots[i].ks_page && ksm_slots[i].ks_page->pp_ref > 1) {
+			shared++;
+			sharing += ksm_slots[i].ks_page->pp_ref - 1;
+		}
+	spin_unlock(&ksm_lock);
+	cprintf("rate %u pages/s, %u pages scanned, %u merges\n", ksm_rate,
+		ksm_scanned, ksm_merges);
+	cprintf("%u merged pages mapped %u times: %uK saved\n", shared,
+		sharing, ksm_saved() * (PGSIZE / 1024));
+}
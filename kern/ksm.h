@@ -0,0 +1,19 @@
+#ifndef JOS_KERN_KSM_H
+#define JOS_KERN_KSM_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// The default and the highest scan rate, in pages per second.
+#define KSM_RATE_DEFAULT	1000
+#define KSM_RATE_MAX		100000
+
+void	ksm_init(void);
+bool	ksm_idle(void);
+void	ksm_set_rate(unsigned rate);
+uint32_t ksm_saved(void);
+void	ksm_report(void);
+
+#endif /* !JOS_KERN_KSM_H */
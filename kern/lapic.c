@@ -42,6 +42,10 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+// One millisecond in timer counts, and the longest one-shot delay.
+#define MSEC_COUNT	1000000
+#define MAX_MSEC	4000
+
 physaddr_t lapicaddr;        // Initialized in mpconfig.c
 volatile uint32_t *lapic;
 
@@ -69,9 +73,11 @@ lapic_init(void)
 	// from lapic[TICR] and then issues an interrupt.  
 	// If we cared more about precise timekeeping,
 	// TICR would be calibrated using an external time source.
+	// The scheduler switches to one-shot deadlines
+	// (lapic_timer_oneshot()) as soon as it runs an env.
 	lapicw(TDCR, X1);
 	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
-	lapicw(TICR, 10000000); 
+	lapicw(TICR, 10 * MSEC_COUNT); 
 
 	// Leave LINT0 of the BSP enabled so that it can get
 	// interrupts from the 8259A chip.
@@ -127,6 +133,28 @@ lapic_eoi(void)
 		lapicw(EOI, 0);
 }
 
+// Put the timer in one-shot mode and make it interrupt once, 'msec'
+// milliseconds from now (or after MAX_MSEC, whichever is sooner).
+// Zero stops the timer.
+void
+lapic_timer_oneshot(unsigned msec)
+{
+	if (!lapic)
+		return;
+	lapicw(TIMER, IRQ_OFFSET + IRQ_TIMER);
+	lapicw(TICR, MIN(msec, MAX_MSEC) * MSEC_COUNT);
+}
+
+// Whole milliseconds since the timer was last set, or since its last
+// periodic interrupt.
+unsigned
+lapic_timer_elapsed(void)
+{
+	if (!lapic)
+		return 0;
+	return (lapic[TICR] - lapic[TCCR]) / MSEC_COUNT;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 static void
@@ -173,6 +201,16 @@ lapic_startap(uint8_t apicid, uint32_t addr)
 	}
 }
 
+// Send interrupt 'vector' to the CPU whose local APIC ID is 'apicid'.
+void
+lapic_ipi_cpu(uint8_t apicid, int vector)
+{
+	lapicw(ICRHI, apicid << 24);
+	lapicw(ICRLO, FIXED | vector);
+	while (lapic[ICRLO] & DELIVS)
+		;
+}
+
 void
 lapic_ipi(int vector)
 {
@@ -12,6 +12,12 @@
 #include <kern/kdebug.h>
 #include <kern/trap.h>
 #include <kern/pmap.h>
+#include <kern/spinlock.h>
+#include <kern/env.h>
+#include <kern/perf.h>
+#include <kern/trace.h>
+#include <kern/slab.h>
+#include <kern/ksm.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -28,7 +34,15 @@ static struct Command commands[] = {
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
 	{ "showmapping", "showmapping <start_addr> <end_addr>", mon_showmapping },
 	{ "editmapping", "editmapping <va> <pte>", mon_editmapping },
-	{ "backtrace", "backtrace", mon_backtrace }
+	{ "backtrace", "backtrace", mon_backtrace },
+	{ "lockstat", "lockstat [reset] - spinlock contention statistics", mon_lockstat },
+	{ "top", "top [n] | top env <envid> - CPU accounting of environments", mon_top },
+	{ "perf", "perf start [hz] | stop | report [n] - sampling profiler", mon_perf },
+	{ "trace", "trace on [syscall|trap|irq|switch|ipc]... | off | dump [n] - event trace", mon_trace },
+	{ "buddyinfo", "buddyinfo - free physical memory by zone and block size", mon_buddyinfo },
+	{ "slabinfo", "slabinfo - kernel object caches and their usage", mon_slabinfo },
+	{ "meminfo", "meminfo - free and used physical memory, and each env's", mon_meminfo },
+	{ "ksm", "ksm [rate <pages/s>] - same-page merging statistics and scan rate", mon_ksm }
 };
 #define NCOMMANDS (sizeof(commands)/sizeof(commands[0]))
 
@@ -99,8 +113,9 @@ mon_showmapping(int argc, char **argv, struct Trapframe *tf)
 			continue;
 		}
 
+		// a 4MB page maps va by its offset in the page
 		cprintf("%08x => %08x \t|\t P:1 \t|\t U:%d \t|\t W:%d\n", (void *) va,
-			PTE_ADDR(*pte),
+			PTE_ADDR(*pte) + (*pte & PTE_PS ? PTX(va) * PGSIZE : 0),
 			*pte & PTE_U ? 1 : 0,
 			*pte & PTE_W ? 1 : 0
 		);
@@ -166,6 +181,232 @@ mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 }
 
 
+/**
+ * mon_lockstat : contention statistics of all spinlocks.
+ * Locks that share a name (e.g. the per-env and per-CPU locks) are
+ * summed into one line.
+ */
+#define LOCKSTAT_ROWS	32
+
+struct lockstat_row {
+	const char *name;
+	unsigned nlocks;
+	struct spinlock_stats stats;
+};
+
+struct lockstat_table {
+	struct lockstat_row rows[LOCKSTAT_ROWS];
+	int nrows;
+};
+
+static void
+lockstat_add(struct spinlock *lk, void *arg)
+{
+	struct lockstat_table *t = arg;
+	struct lockstat_row *row;
+	const char *name = lk->name ? lk->name : "(unnamed)";
+	int i;
+
+	for (i = 0; i < t->nrows; i++)
+		if (strcmp(t->rows[i].name, name) == 0)
+			break;
+	if (i == t->nrows) {
+		if (t->nrows == LOCKSTAT_ROWS)
+			return;
+		t->nrows++;
+		memset(&t->rows[i], 0, sizeof(t->rows[i]));
+		t->rows[i].name = name;
+	}
+
+	row = &t->rows[i];
+	row->nlocks++;
+	row->stats.acquisitions += lk->stats.acquisitions;
+	row->stats.contended += lk->stats.contended;
+	row->stats.spin_cycles += lk->stats.spin_cycles;
+	if (lk->stats.max_hold > row->stats.max_hold)
+		row->stats.max_hold = lk->stats.max_hold;
+}
+
+static void
+lockstat_reset(struct spinlock *lk, void *arg)
+{
+	memset(&lk->stats, 0, sizeof(lk->stats));
+}
+
+int
+mon_lockstat(int argc, char **argv, struct Trapframe *tf)
+{
+	static struct lockstat_table table;
+	struct lockstat_row *row;
+	int i;
+
+	if (argc == 2 && strcmp(argv[1], "reset") == 0) {
+		spin_foreach(lockstat_reset, NULL);
+		return 0;
+	}
+	if (argc != 1)
+		return 1;
+
+	table.nrows = 0;
+	spin_foreach(lockstat_add, &table);
+
+	// Cycle counts are shown in units of 1024 cycles ("kc"), so that
+	// they fit the 32-bit numbers printfmt can print.
+	cprintf("%-16s %5s %10s %10s %10s %10s\n", "lock", "count",
+		"acquired", "contended", "spin(kc)", "maxhold(kc)");
+	for (i = 0; i < table.nrows; i++) {
+		row = &table.rows[i];
+		if (!row->stats.acquisitions)
+			continue;
+		cprintf("%-16s %5u %10u %10u %10u %10u\n",
+			row->name, row->nlocks,
+			(uint32_t) row->stats.acquisitions,
+			(uint32_t) row->stats.contended,
+			(uint32_t) (row->stats.spin_cycles >> 10),
+			(uint32_t) (row->stats.max_hold >> 10));
+	}
+	return 0;
+}
+
+
+/**
+ * mon_top : CPU accounting of the busiest environments, or the system
+ * calls made by one environment.
+ */
+int
+mon_top(int argc, char **argv, struct Trapframe *tf)
+{
+	struct Env *e;
+
+	if (argc == 3 && strcmp(argv[1], "env") == 0) {
+		if (envid2env(strtol(argv[2], NULL, 16), &e, 0) < 0 || !e) {
+			cprintf("no env %s\n", argv[2]);
+			return 1;
+		}
+		env_print_syscalls(e);
+		return 0;
+	}
+	if (argc > 2)
+		return 1;
+	env_print_stats(argc == 2 ? strtol(argv[1], NULL, 10) : 20);
+	return 0;
+}
+
+/**
+ * mon_perf : start and stop the sampling profiler, and show where the
+ * samples fell.
+ */
+int
+mon_perf(int argc, char **argv, struct Trapframe *tf)
+{
+	if (argc < 2 || argc > 3)
+		return 1;
+	if (strcmp(argv[1], "start") == 0)
+		perf_start(argc == 3 ? strtol(argv[2], NULL, 10) : 0);
+	else if (strcmp(argv[1], "stop") == 0 && argc == 2)
+		perf_stop();
+	else if (strcmp(argv[1], "report") == 0)
+		perf_report(argc == 3 ? strtol(argv[2], NULL, 10) : 20);
+	else
+		return 1;
+	return 0;
+}
+
+/**
+ * mon_trace : switch the kernel event trace on or off, or print its
+ * latest records.
+ */
+int
+mon_trace(int argc, char **argv, struct Trapframe *tf)
+{
+	static const struct {
+		const char *name;
+		uint32_t mask;
+	} types[] = {
+		{ "syscall", TRACE_SYSCALL },
+		{ "trap", 1 << TRACE_TRAP },
+		{ "irq", 1 << TRACE_IRQ },
+		{ "switch", 1 << TRACE_SWITCH },
+		{ "ipc", TRACE_IPC },
+	};
+	const int ntypes = sizeof(types) / sizeof(types[0]);
+	uint32_t mask = 0;
+	int i, j;
+
+	if (argc >= 2 && strcmp(argv[1], "on") == 0) {
+		for (i = 2; i < argc; i++) {
+			for (j = 0; j < ntypes; j++)
+				if (strcmp(argv[i], types[j].name) == 0)
+					break;
+			if (j == ntypes) {
+				cprintf("unknown event type %s\n", argv[i]);
+				return 1;
+			}
+			mask |= types[j].mask;
+		}
+		trace_set(argc == 2 ? TRACE_ALL : mask);
+	} else if (argc == 2 && strcmp(argv[1], "off") == 0)
+		trace_set(0);
+	else if ((argc == 2 || argc == 3) && strcmp(argv[1], "dump") == 0)
+		trace_dump(argc == 3 ? strtol(argv[2], NULL, 10) : 50);
+	else
+		return 1;
+	return 0;
+}
+
+/**
+ * mon_buddyinfo : the free blocks of the page allocator and how
+ * fragmented they are.
+ */
+int
+mon_buddyinfo(int argc, char **argv, struct Trapframe *tf)
+{
+	if (argc != 1)
+		return 1;
+	page_report();
+	return 0;
+}
+
+/*
+ * mon_slabinfo : the object caches of the slab allocator.
+ */
+int
+mon_slabinfo(int argc, char **argv, struct Trapframe *tf)
+{
+	if (argc != 1)
+		return 1;
+	kmem_report();
+	return 0;
+}
+
+/*
+ * mon_meminfo : free and used physical memory, and the memory of each
+ * environment.
+ */
+int
+mon_meminfo(int argc, char **argv, struct Trapframe *tf)
+{
+	if (argc != 1)
+		return 1;
+	env_print_meminfo();
+	return 0;
+}
+
+/*
+ * mon_ksm : what merging identical pages saves, and how fast idle CPUs
+ * scan for them.  A rate of 0 stops the scan.
+ */
+int
+mon_ksm(int argc, char **argv, struct Trapframe *tf)
+{
+	if (argc == 3 && strcmp(argv[1], "rate") == 0)
+		ksm_set_rate(strtol(argv[2], NULL, 10));
+	else if (argc != 1)
+		return 1;
+	ksm_report();
+	return 0;
+}
+
 
 /***** Kernel monitor command interpreter *****/
 
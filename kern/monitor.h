@@ -17,5 +17,13 @@ int mon_kerninfo(int argc, char **argv, struct Trapframe *tf);
 int mon_showmapping(int argc, char **argv, struct Trapframe *tf);
 int mon_editmapping(int argc, char **argv, struct Trapframe *tf);
 int mon_backtrace(int argc, char **argv, struct Trapframe *tf);
+int mon_lockstat(int argc, char **argv, struct Trapframe *tf);
+int mon_top(int argc, char **argv, struct Trapframe *tf);
+int mon_perf(int argc, char **argv, struct Trapframe *tf);
+int mon_trace(int argc, char **argv, struct Trapframe *tf);
+int mon_buddyinfo(int argc, char **argv, struct Trapframe *tf);
+int mon_slabinfo(int argc, char **argv, struct Trapframe *tf);
+int mon_meminfo(int argc, char **argv, struct Trapframe *tf);
+int mon_ksm(int argc, char **argv, struct Trapframe *tf);
 
 #endif	// !JOS_KERN_MONITOR_H
@@ -0,0 +1,202 @@
+// A sampling profiler.
+//
+// While the profiler runs, every LAPIC timer interrupt records the
+// interrupted EIP and environment in a ring of the CPU it arrived on.
+// Only that CPU writes its ring, with interrupts off, so taking a sample
+// needs no lock.  The rings keep the latest PERF_NSAMPLES samples of
+// each CPU.
+//
+// The timers are one-shot (see kern/sched.c), so by default samples come
+// only as often as the scheduler needs an interrupt.  perf_start() with
+// a rate makes every CPU, halted ones included, set its timer no later
+// than the sampling period instead.  The kernel runs with interrupts
+// off except in sched_halt(), so kernel samples are idle time.
+//
+// When the profiler is off, the timer interrupt only tests perf_enabled
+// and perf_timer() only tests perf_period.
+//
+// perf_report() groups the samples by environment and function, using
+// the kernel's stabs and the stabs every user binary carries at
+// USTABDATA.
+
+#include <inc/assert.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+#include <kern/perf.h>
+#include <kern/kdebug.h>
+#include <kern/env.h>
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+
+#define PERF_NSAMPLES	2048		// Samples kept per CPU
+#define PERF_NFUNCS	256		// Functions perf_report() tells apart
+#define PERF_NAMELEN	32
+#define PERF_MAXHZ	1000		// The timers count milliseconds
+
+struct PerfSample {
+	uintptr_t ps_eip;
+	envid_t ps_envid;		// 0 if the kernel was interrupted
+};
+
+struct PerfRing {
+	struct PerfSample pr_samples[PERF_NSAMPLES];
+	volatile uint32_t pr_head;	// Samples ever taken
+};
+
+struct PerfFunc {
+	envid_t pf_envid;
+	uintptr_t pf_addr;
+	unsigned pf_count;
+	char pf_name[PERF_NAMELEN];
+};
+
+volatile bool perf_enabled;
+volatile unsigned perf_period;
+
+static struct PerfRing perf_rings[NCPU];
+static struct PerfFunc perf_funcs[PERF_NFUNCS];
+
+// Record where the timer interrupt 'tf' came from.
+void
+perf_sample(struct Trapframe *tf)
+{
+	struct PerfRing *r = &perf_rings[cpunum()];
+	struct PerfSample *s = &r->pr_samples[r->pr_head % PERF_NSAMPLES];
+
+	s->ps_eip = tf->tf_eip;
+	s->ps_envid = (tf->tf_cs & 3) == 3 && curenv ? curenv->env_id : 0;
+	r->pr_head++;
+}
+
+// Throw away the old samples and start sampling, 'hz' times a second
+// on every CPU, or at the scheduler's timer interrupts if 'hz' is 0.
+void
+perf_start(unsigned hz)
+{
+	int i;
+
+	perf_enabled = false;
+	for (i = 0; i < ncpu; i++)
+		perf_rings[i].pr_head = 0;
+	hz = MIN(hz, PERF_MAXHZ);
+	perf_period = hz ? 1000 / hz : 0;
+	perf_enabled = true;
+
+	// Halted CPUs have stopped their timers; wake them up so that
+	// they set them for the sampling period.
+	if (perf_period)
+		for (i = 0; i < ncpu; i++)
+			if (i != cpunum() && cpus[i].cpu_status == CPU_HALTED)
+				lapic_ipi_cpu(cpus[i].cpu_id,
+					      IRQ_OFFSET + IRQ_WAKEUP);
+}
+
+void
+perf_stop(void)
+{
+	perf_enabled = false;
+	perf_period = 0;
+}
+
+// The function 'eip' of environment 'envid' falls in, or NULL if the
+// table is full.  'e' is the env whose address space is loaded, if any.
+static struct PerfFunc *
+perf_lookup(envid_t envid, uintptr_t eip, struct Env *e, int *nfuncs)
+{
+	struct Eipdebuginfo info;
+	struct PerfFunc *f;
+	const char *name = "<unknown>";
+	uintptr_t addr = 0;
+	int i, len = 9;
+
+	if ((envid == 0 || e) && debuginfo_eip_env(eip, &info, e) == 0) {
+		name = info.eip_fn_name;
+		len = info.eip_fn_namelen;
+		addr = info.eip_fn_addr;
+	}
+
+	for (i = 0; i < *nfuncs; i++) {
+		f = &perf_funcs[i];
+		if (f->pf_envid == envid && f->pf_addr == addr)
+			return f;
+	}
+	if (*nfuncs == PERF_NFUNCS)
+		return NULL;
+
+	f = &perf_funcs[(*nfuncs)++];
+	f->pf_envid = envid;
+	f->pf_addr = addr;
+	f->pf_count = 0;
+	len = MIN(len, PERF_NAMELEN - 1);
+	memmove(f->pf_name, name, len);
+	f->pf_name[len] = '\0';
+	return f;
+}
+
+// Print the 'limit' functions with the most samples (all of them if
+// limit is 0).  User samples are looked up in the address space of
+// their environment, so the samples of envs that have exited since
+// show up as <unknown>.
+void
+perf_report(int limit)
+{
+	struct PerfRing *r;
+	struct PerfSample *s;
+	struct PerfFunc *f, tmp;
+	struct Env *e = NULL;
+	uint32_t cr3 = rcr3(), head;
+	unsigned total = 0, lost = 0;
+	int nfuncs = 0, cpu, i, j, n;
+
+	for (cpu = 0; cpu < ncpu; cpu++) {
+		r = &perf_rings[cpu];
+		head = r->pr_head;
+		n = MIN(head, PERF_NSAMPLES);
+		lost += head - n;
+		for (i = 0; i < n; i++) {
+			s = &r->pr_samples[(head - n + i) % PERF_NSAMPLES];
+
+			// Switch to the sample's address space for its stabs.
+			if (s->ps_envid && (!e || e->env_id != s->ps_envid)) {
+				if (envid2env(s->ps_envid, &e, 0) < 0)
+					e = NULL;
+				else
+					lcr3(PADDR(e->env_pgdir));
+			}
+			if (!(f = perf_lookup(s->ps_envid, s->ps_eip,
+					      s->ps_envid ? e : NULL, &nfuncs))) {
+				lost++;
+				continue;
+			}
+			f->pf_count++;
+			total++;
+		}
+	}
+	lcr3(cr3);
+
+	// Insertion sort by sample count, highest first.
+	for (i = 1; i < nfuncs; i++) {
+		tmp = perf_funcs[i];
+		for (j = i; j > 0 && perf_funcs[j - 1].pf_count < tmp.pf_count; j--)
+			perf_funcs[j] = perf_funcs[j - 1];
+		perf_funcs[j] = tmp;
+	}
+
+	cprintf("perf: %u samples, %u not shown, %s", total, lost,
+		perf_enabled ? "running" : "stopped");
+	if (perf_period)
+		cprintf(" at %u Hz", 1000 / perf_period);
+	cprintf("\n  samples    %%  env       function\n");
+	if (limit <= 0 || limit > nfuncs)
+		limit = nfuncs;
+	for (i = 0; i < limit; i++) {
+		f = &perf_funcs[i];
+		if (f->pf_envid)
+			cprintf("  %7u  %3u  %08x  %s\n", f->pf_count,
+				f->pf_count * 100 / total, f->pf_envid,
+				f->pf_name);
+		else
+			cprintf("  %7u  %3u  kernel    %s\n", f->pf_count,
+				f->pf_count * 100 / total, f->pf_name);
+	}
+}
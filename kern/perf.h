@@ -0,0 +1,30 @@
+#ifndef JOS_KERN_PERF_H
+#define JOS_KERN_PERF_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/trap.h>
+
+extern volatile bool perf_enabled;	// Take a sample on timer interrupts
+extern volatile unsigned perf_period;	// Msec between samples, or 0
+
+void perf_sample(struct Trapframe *tf);
+void perf_start(unsigned hz);
+void perf_stop(void);
+void perf_report(int limit);
+
+// Shorten a one-shot timer of 'ms' milliseconds (0 meaning no timer)
+// to the sampling period while the profiler runs at its own rate.
+static inline unsigned
+perf_timer(unsigned ms)
+{
+	unsigned period = perf_period;
+
+	if (period && (ms == 0 || ms > period))
+		return period;
+	return ms;
+}
+
+#endif /* !JOS_KERN_PERF_H */
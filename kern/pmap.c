@@ -10,6 +10,10 @@
 #include <kern/kclock.h>
 #include <kern/env.h>
 #include <kern/cpu.h>
+#include <kern/spinlock.h>
+#include <kern/time.h>
+#include <kern/slab.h>
+#include <kern/ksm.h>
 
 // These variables are set by i386_detect_memory()
 size_t npages;			// Amount of physical memory (in pages)
@@ -18,7 +22,25 @@ static size_t npages_basemem;	// Amount of base memory (in pages)
 // These variables are set in mem_init()
 pde_t *kern_pgdir;		// Kernel's initial page directory
 struct PageInfo *pages;		// Physical page state array
-static struct PageInfo *page_free_list;	// Free list of physical pages
+bool page_pse;			// CR4.PSE is on: PDEs may map 4MB pages
+bool page_pge;			// CR4.PGE is on: PTE_G mappings outlive lcr3
+
+// Protects the free lists and the pp_ref counts of all pages.  System
+// calls that map or unmap pages run without the big kernel lock, so
+// several CPUs may allocate, share and free pages at the same time.
+static struct spinlock page_lock;
+
+// Pages zeroed ahead of time for page_alloc(ALLOC_ZERO), by CPUs that
+// have nothing to run (see page_zero_idle()).  Up to PZERO_TARGET pages
+// wait on a list of their own, under page_zero_lock.
+#define PZERO_TARGET	512
+
+static struct spinlock page_zero_lock;
+static struct PageInfo *page_zero_list;
+static volatile uint32_t page_nzero;
+static uint32_t page_zero_hits;		// ALLOC_ZERO served from the list
+static uint32_t page_zero_misses;	// ALLOC_ZERO that found it empty
+static bool page_movnti;		// The CPU has non-temporal stores
 
 
 // --------------------------------------------------------------
@@ -60,7 +82,10 @@ i386_detect_memory(void)
 // --------------------------------------------------------------
 
 static void mem_init_mp(void);
+static void page_init_range(size_t first, size_t last);
+static void page_free_locked(struct PageInfo *pp, int order);
 static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
+static int page_insert_large(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
 static void check_page_free_list(bool only_low_memory);
 static void check_page_alloc(void);
 static void check_kern_pgdir(void);
@@ -79,7 +104,7 @@ static void check_page_installed_pgdir(void);
 //
 // If we're out of memory, boot_alloc should panic.
 // This function may ONLY be used during initialization,
-// before the page_free_list list has been set up.
+// before the page allocator has been set up.
 static void *
 boot_alloc(uint32_t n)
 {
@@ -128,10 +153,13 @@ boot_alloc(uint32_t n)
 void
 mem_init(void)
 {
-	uint32_t cr0;
+	uint32_t cr0, edx;
 	size_t n;
 	int pp_idx;
 
+	spin_initlock(&page_lock);
+	spin_initlock(&page_zero_lock);
+
 	// Find out how much memory the machine has (npages & npages_basemem).
 	i386_detect_memory();
 
@@ -168,6 +196,10 @@ mem_init(void)
 	// LAB 3: Your code here.
     envs = (struct Env *) boot_alloc(NENV * sizeof(*envs));
     memset(envs, 0, NENV * sizeof(*envs));
+
+	// The TSC calibration, filled in by time_init().
+	timeinfo = (struct TimeInfo *) boot_alloc(PGSIZE);
+	memset(timeinfo, 0, PGSIZE);
     
     
 	//////////////////////////////////////////////////////////////////////
@@ -192,12 +224,16 @@ mem_init(void)
 	//      (ie. perm = PTE_U | PTE_P)
 	//    - pages itself -- kernel RW, user NONE
 	// Your code goes here:
+	//
+	// Like every mapping above UTOP, this one is the same in all
+	// address spaces, so it is global (PTE_G): loading another page
+	// directory leaves it in the TLB.
 	
 	boot_map_region(kern_pgdir,
 					(intptr_t) UPAGES,
 					PTSIZE,
 					PADDR(pages),
-					PTE_U
+					PTE_U | PTE_G
 	);
 
 	//////////////////////////////////////////////////////////////////////
@@ -208,13 +244,17 @@ mem_init(void)
 	//    - envs itself -- kernel RW, user NONE
 	// LAB 3: Your code here.
     
+    static_assert(UENVS + NENV * sizeof(struct Env) <= UTIME);
     boot_map_region(kern_pgdir,
                     (intptr_t) UENVS,
-                    PTSIZE,
+                    ROUNDUP(NENV * sizeof(struct Env), PGSIZE),
                     PADDR(envs),
-                    PTE_U
+                    PTE_U | PTE_G
     );
 
+	// Map the TSC calibration read-only by the user at UTIME.
+	boot_map_region(kern_pgdir, UTIME, PGSIZE, PADDR(timeinfo), PTE_U | PTE_G);
+
 	//////////////////////////////////////////////////////////////////////
 	// Use the physical memory that 'bootstack' refers to as the kernel
 	// stack.  The kernel stack grows down from virtual address KSTACKTOP.
@@ -231,7 +271,7 @@ mem_init(void)
 					KSTACKTOP - KSTKSIZE, 
 					KSTKSIZE,
 					PADDR((char *) bootstack),
-					PTE_W);
+					PTE_W | PTE_G);
 
 	//////////////////////////////////////////////////////////////////////
 	// Map all of physical memory at KERNBASE.
@@ -241,12 +281,22 @@ mem_init(void)
 	// we just set up the mapping anyway.
 	// Permissions: kernel RW, user NONE
 	// Your code goes here:
+	//
+	// With PSE, this takes 4MB pages rather than 64 page tables.
+	cpuid(1, NULL, NULL, NULL, &edx);
+	page_movnti = edx & CPUID_FEAT_SSE2;
+	if ((page_pse = edx & CPUID_FEAT_PSE))
+		lcr4(rcr4() | CR4_PSE);
+#if !defined(NO_GLOBAL_PAGES)
+	if ((page_pge = edx & CPUID_FEAT_PGE))
+		lcr4(rcr4() | CR4_PGE);
+#endif
 
 	boot_map_region(kern_pgdir, 
 					KERNBASE,
 					0xFFFFFFFF - KERNBASE + 1,
 					(physaddr_t) 0,
-					PTE_W);	
+					PTE_W | PTE_G);	
 	
 	// Initialize the SMP-related parts of the memory map
 	mem_init_mp();
@@ -263,6 +313,8 @@ mem_init(void)
 	// kern_pgdir wrong.
 	lcr3(PADDR(kern_pgdir));
 
+	// All of memory is mapped now.
+	page_init_range(NPTENTRIES, npages);
 	check_page_free_list(0);
 
 	// entry.S set the really important flags in cr0 (including enabling
@@ -304,20 +356,158 @@ mem_init_mp(void)
                         KSTACKTOP - (KSTKSIZE + KSTKGAP) * n - KSTKSIZE, 
                         KSTKSIZE,
                         PADDR(percpu_kstacks[n]),
-                        PTE_W);
+                        PTE_W | PTE_G);
 }
 
 // --------------------------------------------------------------
 // Tracking of physical pages.
 // The 'pages' array has one 'struct PageInfo' entry per physical page.
-// Pages are reference counted, and free pages are kept on a linked list.
+// Pages are reference counted.  Free pages are handed out by a buddy
+// allocator: free memory is kept in blocks of 2^order pages, aligned to
+// their size, for orders up to PAGE_MAXORDER.  A block is split in
+// halves ("buddies") for a smaller allocation, and a freed block is
+// merged with its buddy whenever that is free too.  The first page of a
+// free block records its order in pp_order; all other pages have -1.
+//
+// Memory is divided into zones for devices that only reach part of it:
+// ISA DMA reaches the first 16MB, 32-bit PCI DMA the first 4GB.  Blocks
+// never cross a zone boundary.  Allocations take memory from the
+// highest zone the caller accepts, sparing the low zones.
 // --------------------------------------------------------------
 
+struct PageZone {
+	const char *pz_name;
+	size_t pz_end;				// Zone ends before this page
+	struct PageInfo *pz_free[PAGE_MAXORDER + 1];	// Free blocks
+	size_t pz_nfree[PAGE_MAXORDER + 1];	// Blocks on pz_free[order]
+};
+
+static struct PageZone page_zones[] = {
+	{ "DMA", 0x1000000 / PGSIZE },
+	{ "DMA32", 0x100000 },			// 4GB in pages
+};
+
+#define NZONES	(sizeof(page_zones) / sizeof(page_zones[0]))
+
+// Single pages are allocated and freed through a cache on each CPU, so
+// that most of the time they touch neither page_lock nor the shared free
+// lists.  A cache that runs empty takes PCACHE_BATCH pages from the free
+// lists at once, and one that fills up gives back its PCACHE_BATCH
+// coldest pages.  A CPU takes only its own cache's lock, which nobody
+// else holds, except when the free lists run out: then the allocator
+// empties the caches of all CPUs back into them before it gives up.
+// Cached pages have pp_order PCACHE_ORDER, so freeing one again panics.
+#define PCACHE_SIZE	64
+#define PCACHE_BATCH	32
+#define PCACHE_ORDER	-2
+
+struct PageCache {
+	struct spinlock pc_lock;
+	struct PageInfo *pc_pages[PCACHE_SIZE];	// The newest last
+	int pc_count;
+	uint32_t pc_hits;		// Allocations served from the cache
+	uint32_t pc_refills;		// Batches taken from the free lists
+	uint32_t pc_drains;		// Batches given back
+};
+
+static struct PageCache page_caches[NCPU];
+
+static struct PageZone *
+page_zone(size_t pgnum)
+{
+	struct PageZone *z = page_zones;
+
+	while (pgnum >= z->pz_end)
+		z++;
+	return z;
+}
+
+// Put the free block 'pp' of 2^order pages on its free list.
+static void
+page_block_push(struct PageZone *z, struct PageInfo *pp, int order)
+{
+	pp->pp_order = order;
+	pp->pp_prev = NULL;
+	pp->pp_link = z->pz_free[order];
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp;
+	z->pz_free[order] = pp;
+	z->pz_nfree[order]++;
+}
+
+// Take the free block 'pp' off its free list.
+static void
+page_block_remove(struct PageZone *z, struct PageInfo *pp)
+{
+	int order = pp->pp_order;
+
+	if (pp->pp_prev)
+		pp->pp_prev->pp_link = pp->pp_link;
+	else
+		z->pz_free[order] = pp->pp_link;
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp->pp_prev;
+	pp->pp_link = pp->pp_prev = NULL;
+	pp->pp_order = -1;
+	z->pz_nfree[order]--;
+}
+
+// Is page 'pgnum' free for the allocator, as opposed to in use at boot?
+static bool
+page_boot_free(size_t pgnum)
+{
+	extern char end[];
+	extern char start[];
+	physaddr_t paddr = pgnum * PGSIZE;
+
+	// First physical page is allocated for IDT and BIOS
+	if (pgnum == 0)
+		return false;
+
+	// IO HOLE
+	if (paddr >= IOPHYSMEM && paddr < EXTPHYSMEM)
+		return false;
+
+	// MPENTRY_PADDR - keep 1 page for multi processor initialization
+	if (ROUNDDOWN(paddr, PGSIZE) == ROUNDDOWN(MPENTRY_PADDR, PGSIZE))
+		return false;
+
+	// DONT OVERWRITE THE KERNEL
+	if (paddr >= ROUNDDOWN(PADDR((char *) start), PGSIZE)
+	    && paddr < ROUNDUP(PADDR((char *) end), PGSIZE))
+		return false;
+
+	// Keep previous allocations made using boot_alloc
+	if (paddr >= PADDR(ROUNDUP((char *) end, PGSIZE))
+	    && paddr < PADDR(boot_alloc(0)))
+		return false;
+
+	return true;
+}
+
+// Give the allocator the pages in [first, last) that are free at boot.
+static void
+page_init_range(size_t first, size_t last)
+{
+	size_t i;
+
+	for (i = first; i < last; i++) {
+		if (page_boot_free(i)) {
+			pages[i].pp_ref = 0;
+			page_free(&pages[i]);
+		} else
+			pages[i].pp_ref = 1;
+	}
+}
+
 //
 // Initialize page structure and memory free list.
 // After this is done, NEVER use boot_alloc again.  ONLY use the page
-// allocator functions below to allocate and deallocate physican==0l
-// memory via the page_free_list.
+// allocator functions below to allocate and deallocate physical
+// memory.
+//
+// Only the memory below 4MB, which entry_pgdir maps, is free for now;
+// mem_init() adds the rest once kern_pgdir is loaded.
 //
 void
 page_init(void)
@@ -343,49 +533,228 @@ page_init(void)
 	// Change the code to reflect this.
 	// NB: DO NOT actually touch the physical memory corresponding to
 	// free pages!
-    
-    page_free_list = NULL;
-    extern char end[];
-    extern char start[];
-    size_t i;
-    for (i = 0; i < npages; i++) {
-        physaddr_t paddr = page2pa(&pages[i]);
-        
-        // First physical page is allocated for IDT and BIOS
-        if (i == 0) 
-            goto in_use;
-        
-        // IO HOLE
-        if (paddr >= IOPHYSMEM && paddr < EXTPHYSMEM) 
-            goto in_use;
-
-        // MPENTRY_PADDR - keep 1 page for multi processor initialization
-        if (ROUNDDOWN(paddr, PGSIZE) == ROUNDDOWN(MPENTRY_PADDR, PGSIZE))
-            goto in_use;
-
-        // DONT OVERWRITE THE KERNEL
-        if (paddr >= ROUNDDOWN(PADDR((char *) start), PGSIZE)
-            && paddr < ROUNDUP(PADDR((char *) end), PGSIZE))
-            goto in_use;
-        
-        // Keep previous allocations made using boot_alloc
-        if (paddr >= PADDR(ROUNDUP((char *) end, PGSIZE)) 
-            && paddr < PADDR(boot_alloc(0)))
-            goto in_use;
-        
-//         MMIO physical pages
-//         if (paddr >= npages * PGSIZE - MMIO_SIZE)
-//             goto in_use;
-        
-        pages[i].pp_ref = 0;
-        pages[i].pp_link = page_free_list;
-        page_free_list = &pages[i];
-        continue;
-		
-    in_use:
-        pages[i].pp_ref = 1;
-        pages[i].pp_link = NULL;
-    }
+	size_t i;
+
+	for (i = 0; i < NCPU; i++)
+		__spin_initlock(&page_caches[i].pc_lock, "page_cache");
+	for (i = 0; i < npages; i++)
+		pages[i].pp_order = -1;
+	page_init_range(0, MIN(npages, NPTENTRIES));
+}
+
+// The free list page_alloc_order() takes a block of 2^order pages from,
+// in the highest zone up to 'maxzone' that has one, splitting larger
+// blocks as needed.  The caller holds page_lock.
+static struct PageInfo *
+page_alloc_locked(int order, int maxzone)
+{
+	struct PageZone *z;
+	struct PageInfo *pp;
+	int zi, k;
+
+	for (zi = maxzone; zi >= 0; zi--) {
+		z = &page_zones[zi];
+		for (k = order; k <= PAGE_MAXORDER && !z->pz_free[k]; k++)
+			;
+		if (k > PAGE_MAXORDER)
+			continue;
+
+		pp = z->pz_free[k];
+		page_block_remove(z, pp);
+		// Give back the upper halves we do not need.
+		while (k > order) {
+			k--;
+			page_block_push(z, pp + (1 << k), k);
+		}
+		return pp;
+	}
+	return NULL;
+}
+
+// Take a page from the list of zeroed pages, or NULL if it is empty.
+static struct PageInfo *
+page_zero_take(void)
+{
+	struct PageInfo *pp;
+
+	// Do not bother the lock if the list looks empty.
+	if (!page_nzero)
+		return NULL;
+
+	spin_lock(&page_zero_lock);
+	if ((pp = page_zero_list)) {
+		page_zero_list = pp->pp_link;
+		pp->pp_link = NULL;
+		page_nzero--;
+	}
+	spin_unlock(&page_zero_lock);
+	return pp;
+}
+
+// Allocate a single page from the cache of this CPU.
+static struct PageInfo *
+page_cache_alloc(void)
+{
+	struct PageCache *c = &page_caches[cpunum()];
+	struct PageInfo *pp = NULL;
+
+	spin_lock(&c->pc_lock);
+	if (c->pc_count > 0) {
+		c->pc_hits++;
+	} else {
+		spin_lock(&page_lock);
+		while (c->pc_count < PCACHE_BATCH &&
+		       (pp = page_alloc_locked(0, NZONES - 1))) {
+			pp->pp_order = PCACHE_ORDER;
+			c->pc_pages[c->pc_count++] = pp;
+		}
+		spin_unlock(&page_lock);
+		c->pc_refills++;
+	}
+	if (c->pc_count > 0) {
+		pp = c->pc_pages[--c->pc_count];
+		pp->pp_order = -1;
+	}
+	spin_unlock(&c->pc_lock);
+	return pp;
+}
+
+// Give back the first 'n' pages of cache 'c' to the free lists.  The
+// caller holds c->pc_lock.
+static void
+page_cache_drain(struct PageCache *c, int n)
+{
+	int i;
+
+	spin_lock(&page_lock);
+	for (i = 0; i < n; i++) {
+		c->pc_pages[i]->pp_order = -1;
+		page_free_locked(c->pc_pages[i], 0);
+	}
+	spin_unlock(&page_lock);
+	c->pc_count -= n;
+	memmove(c->pc_pages, c->pc_pages + n,
+		c->pc_count * sizeof(c->pc_pages[0]));
+	c->pc_drains++;
+}
+
+// Give back the pages in the caches of all CPUs, when the free lists
+// have run out.
+//
+// Returns true if there were any.
+static bool
+page_cache_drain_all(void)
+{
+	struct PageCache *c;
+	bool found = false;
+
+	for (c = page_caches; c < page_caches + NCPU; c++) {
+		if (!c->pc_count)
+			continue;
+		spin_lock(&c->pc_lock);
+		if (c->pc_count) {
+			page_cache_drain(c, c->pc_count);
+			found = true;
+		}
+		spin_unlock(&c->pc_lock);
+	}
+	return found;
+}
+
+//
+// Allocates a block of 2^order physically contiguous pages, aligned to
+// its size.  With ALLOC_DMA the block lies below 16MB, with ALLOC_DMA32
+// below 4GB.  If (alloc_flags & ALLOC_ZERO), fills the block with '\0'
+// bytes.  Does NOT increment the reference count of the pages - the
+// caller must do these if necessary.  Free the block with
+// page_free_order() and the same order.
+//
+// Returns NULL if there is no such block free.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags)
+{
+	struct PageInfo *pp;
+	int maxzone = NZONES - 1;
+
+	assert(order >= 0 && order <= PAGE_MAXORDER);
+	if (alloc_flags & ALLOC_DMA)
+		maxzone = 0;
+	else if (alloc_flags & ALLOC_DMA32)
+		maxzone = 1;
+
+	if (order == 0 && maxzone == NZONES - 1) {
+		if (alloc_flags & ALLOC_ZERO) {
+			// (The counters are only statistics, kept unlocked.)
+			if ((pp = page_zero_take())) {
+				page_zero_hits++;
+				return pp;
+			}
+			page_zero_misses++;
+		}
+		// When all else is gone, take a zeroed page anyway.
+		if (!(pp = page_cache_alloc()) && !(pp = page_zero_take()) &&
+		    !(page_cache_drain_all() && (pp = page_cache_alloc())))
+			return NULL;
+	} else {
+		spin_lock(&page_lock);
+		pp = page_alloc_locked(order, maxzone);
+		spin_unlock(&page_lock);
+		if (!pp && page_cache_drain_all()) {
+			spin_lock(&page_lock);
+			pp = page_alloc_locked(order, maxzone);
+			spin_unlock(&page_lock);
+		}
+	}
+
+	if (pp && (alloc_flags & ALLOC_ZERO))
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+
+// Fill the page at 'va' with zeroes.  Non-temporal stores go around the
+// caches, so zeroing a page does not evict other data.
+static void
+page_zero_nt(void *va)
+{
+	uint32_t *p = va, *end = p + PGSIZE / sizeof(*p);
+
+	if (!page_movnti) {
+		memset(va, 0, PGSIZE);
+		return;
+	}
+	for (; p < end; p += 4)
+		asm volatile("movnti %1, (%0)\n\t"
+			     "movnti %1, 4(%0)\n\t"
+			     "movnti %1, 8(%0)\n\t"
+			     "movnti %1, 12(%0)"
+			     : : "r" (p), "r" (0) : "memory");
+	// Make the stores visible before the page is handed out.
+	asm volatile("sfence" : : : "memory");
+}
+
+//
+// Zero a free page for page_alloc(ALLOC_ZERO), if fewer than
+// PZERO_TARGET are waiting.  sched_halt() calls this with interrupts off
+// while the CPU has nothing to run.
+//
+// Returns true if a page was zeroed.
+//
+bool
+page_zero_idle(void)
+{
+	struct PageInfo *pp;
+
+	if (page_nzero >= PZERO_TARGET || !(pp = page_cache_alloc()))
+		return false;
+	page_zero_nt(page2kva(pp));
+
+	spin_lock(&page_zero_lock);
+	pp->pp_link = page_zero_list;
+	page_zero_list = pp;
+	page_nzero++;
+	spin_unlock(&page_zero_lock);
+	return true;
 }
 
 //
@@ -394,34 +763,88 @@ page_init(void)
 // count of the page - the caller must do these if necessary (either explicitly
 // or via page_insert).
 //
-// Be sure to set the pp_link field of the allocated page to NULL so
-// page_free can check for double-free bugs.
-//
 // Returns NULL if out of free memory.
 //
-// Hint: use page2kva and memset
 struct PageInfo *
 page_alloc(int alloc_flags)
 {
-    // Return NULL if out of memory
-    if (page_free_list == NULL)
-        return NULL;
+	return page_alloc_order(0, alloc_flags);
+}
 
-    // Retrieve the last empty page
-    struct PageInfo * allocated_page = page_free_list;
+//
+// Allocates a 4MB page, for a page directory entry with PTE_PS (see
+// page_insert()).  The first page of it stands for the whole: it holds
+// the reference count, and page_decref() frees all of it.
+//
+// Returns NULL if there is no free 4MB block or the CPU lacks PSE.
+//
+struct PageInfo *
+page_alloc_large(int alloc_flags)
+{
+	struct PageInfo *pp;
 
-    // Update the pointer to the last empty page
-    page_free_list = allocated_page->pp_link;
-    
-    // Set link of the allocated page to NULL
-    allocated_page->pp_link = NULL;
-    
-    // Flags checks & actions
-    if (alloc_flags & ALLOC_ZERO) {
-        memset(page2kva(allocated_page), 0, PGSIZE);
-    }
-    
-	return allocated_page;
+	static_assert(PGSIZE << PAGE_MAXORDER == PTSIZE);
+	if (!page_pse || !(pp = page_alloc_order(PAGE_MAXORDER, alloc_flags)))
+		return NULL;
+	pp->pp_large = 1;
+	return pp;
+}
+
+// Return the block of 2^order pages at 'pp' to the allocator, merging it
+// with its buddy as long as that is free.  The caller holds page_lock.
+static void
+page_free_locked(struct PageInfo *pp, int order)
+{
+	size_t pgnum = pp - pages, buddy;
+	struct PageZone *z = page_zone(pgnum);
+
+	if (pp->pp_link != NULL || pp->pp_order != -1)
+		panic("Double free error / freed page has non NULL link field.");
+	if (pgnum % (1 << order) != 0)
+		panic("page_free_order: page %u is not aligned to order %d",
+		      pgnum, order);
+
+	for (; order < PAGE_MAXORDER; order++) {
+		buddy = pgnum ^ (1 << order);
+		if (buddy >= npages || pages[buddy].pp_order != order ||
+		    page_zone(buddy) != z)
+			break;
+		page_block_remove(z, &pages[buddy]);
+		pgnum &= ~(1 << order);
+	}
+	page_block_push(z, &pages[pgnum], order);
+}
+
+// Free a single page to the cache of this CPU.
+static void
+page_cache_free(struct PageInfo *pp)
+{
+	struct PageCache *c = &page_caches[cpunum()];
+
+	if (pp->pp_link != NULL || pp->pp_order != -1)
+		panic("Double free error / freed page has non NULL link field.");
+
+	spin_lock(&c->pc_lock);
+	if (c->pc_count == PCACHE_SIZE)
+		page_cache_drain(c, PCACHE_BATCH);
+	pp->pp_order = PCACHE_ORDER;
+	c->pc_pages[c->pc_count++] = pp;
+	spin_unlock(&c->pc_lock);
+}
+
+//
+// Return a block from page_alloc_order() to the allocator.
+//
+void
+page_free_order(struct PageInfo *pp, int order)
+{
+	if (order == 0) {
+		page_cache_free(pp);
+		return;
+	}
+	spin_lock(&page_lock);
+	page_free_locked(pp, order);
+	spin_unlock(&page_lock);
 }
 
 //
@@ -431,15 +854,99 @@ page_alloc(int alloc_flags)
 void
 page_free(struct PageInfo *pp)
 {
-	// Fill this function in
-	// Hint: You may want to panic if pp->pp_ref is nonzero or
-	// pp->pp_link is not NULL.
-    if (pp->pp_link != NULL)
-        panic("Double free error / freed page has non NULL link field.");
-    
-    pp->pp_link = page_free_list;
-    page_free_list = pp;
-    
+	page_free_order(pp, 0);
+}
+
+// The number of free pages.
+static size_t
+page_nfree(void)
+{
+	size_t n = 0;
+	int zi, k;
+
+	for (zi = 0; zi < NZONES; zi++)
+		for (k = 0; k <= PAGE_MAXORDER; k++)
+			n += page_zones[zi].pz_nfree[k] << k;
+	for (zi = 0; zi < NCPU; zi++)
+		n += page_caches[zi].pc_count;
+	return n + page_nzero;
+}
+
+//
+// Print the free blocks of each zone by order, and how fragmented the
+// free memory is: for each order, the share of free memory in blocks
+// too small for an allocation of that order.  Then the page caches of
+// the CPUs.
+//
+void
+page_report(void)
+{
+	struct PageZone *z;
+	size_t nfree, big;
+	int zi, k;
+
+	spin_lock(&page_lock);
+	cprintf("zone   order:");
+	for (k = 0; k <= PAGE_MAXORDER; k++)
+		cprintf(" %5d", k);
+	cprintf("    free\n");
+	for (zi = 0; zi < NZONES; zi++) {
+		z = &page_zones[zi];
+		if (z > page_zones && z[-1].pz_end >= npages)
+			break;
+		nfree = 0;
+		for (k = 0; k <= PAGE_MAXORDER; k++)
+			nfree += z->pz_nfree[k] << k;
+
+		cprintf("%-6s blocks", z->pz_name);
+		for (k = 0; k <= PAGE_MAXORDER; k++)
+			cprintf(" %5u", z->pz_nfree[k]);
+		cprintf(" %6uK\n", nfree * (PGSIZE / 1024));
+
+		cprintf("       frag%% ");
+		big = nfree;
+		for (k = 0; k <= PAGE_MAXORDER; k++) {
+			cprintf(" %5u", nfree ? (nfree - big) * 100 / nfree : 0);
+			big -= z->pz_nfree[k] << k;
+		}
+		cprintf("\n");
+	}
+	spin_unlock(&page_lock);
+
+	cprintf("cpu  cached       hits  refills   drains\n");
+	for (k = 0; k < ncpu; k++)
+		cprintf("%3d  %6d %10u %8u %8u\n", k, page_caches[k].pc_count,
+			page_caches[k].pc_hits, page_caches[k].pc_refills,
+			page_caches[k].pc_drains);
+	cprintf("zeroed pages: %u, ALLOC_ZERO hits %u, misses %u\n",
+		page_nzero, page_zero_hits, page_zero_misses);
+}
+
+//
+// Fill in how much physical memory is free and used.
+//
+void
+page_meminfo(struct MemInfo *info)
+{
+	spin_lock(&page_lock);
+	info->mi_free = page_nfree();
+	spin_unlock(&page_lock);
+	info->mi_total = npages;
+	info->mi_zeroed = page_nzero;
+	info->mi_used = info->mi_total - info->mi_free;
+	info->mi_merged = ksm_saved();
+}
+
+//
+// Increment the reference count on a page.
+//
+void
+page_incref(struct PageInfo *pp)
+{
+	spin_lock(&page_lock);
+	if (!(pp->pp_ref)++)
+		pp->pp_link = NULL;
+	spin_unlock(&page_lock);
 }
 
 //
@@ -449,7 +956,17 @@ page_free(struct PageInfo *pp)
 void
 page_decref(struct PageInfo* pp)
 {
-	if (--pp->pp_ref == 0)
+	bool free;
+
+	spin_lock(&page_lock);
+	free = --pp->pp_ref == 0;
+	spin_unlock(&page_lock);
+	if (!free)
+		return;
+	if (pp->pp_large) {
+		pp->pp_large = 0;
+		page_free_order(pp, PAGE_MAXORDER);
+	} else
 		page_free(pp);
 }
 
@@ -475,9 +992,15 @@ page_decref(struct PageInfo* pp)
 // Hint 3: look at inc/mmu.h for useful macros that mainipulate page
 // table and page directory entries.
 //
+// If the PDE for 'va' maps a 4MB page (PTE_PS), pgdir_walk returns the
+// PDE itself, whose flags mean the same as a PTE's.
+//
 pte_t *
 pgdir_walk(pde_t *pgdir, const void *va, int create)
 {
+	if (pgdir[PDX(va)] & PTE_PS)
+		return &pgdir[PDX(va)];
+
 	// Check if the PDE is not present
     if(! pgdir[PDX(va)] & PTE_P) {
         // If we don't want to create a new page table,
@@ -491,6 +1014,8 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
         if (allocated_pt == NULL)
             return NULL;
         ++(allocated_pt->pp_ref);
+        if (pgdir_mem(pgdir))
+            pgdir_mem(pgdir)->pm_ptables++;
         
         // Put a link to the fresh page table in the page directory,
         // Mark as present and set flags.
@@ -514,6 +1039,8 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 // mapped pages.
 //
 // Hint: the TA solution uses pgdir_walk
+//
+// With PSE, 4MB-aligned pieces are mapped with 4MB pages.
 static void
 boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm)
 {
@@ -533,6 +1060,16 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 	for(page_idx = 0; page_idx * PGSIZE < size; page_idx++) {
 		curr_va = (char *) va + page_idx * PGSIZE;
 		curr_pa = (char *) pa + page_idx * PGSIZE;
+
+		if (page_pse && (uintptr_t) curr_va % PTSIZE == 0 &&
+		    (uintptr_t) curr_pa % PTSIZE == 0 &&
+		    size - page_idx * PGSIZE >= PTSIZE &&
+		    !(pgdir[PDX(curr_va)] & PTE_P)) {
+			pgdir[PDX(curr_va)] = (physaddr_t) curr_pa | PTE_PS |
+					      PTE_P | perm;
+			page_idx += NPTENTRIES - 1;
+			continue;
+		}
 		
 		if ((pe = pgdir_walk(pgdir, curr_va, 1)) == NULL)
 			panic("boot_map_region: could not allocate page table!");
@@ -567,26 +1104,70 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 // Hint: The TA solution is implemented using pgdir_walk, page_remove,
 // and page2pa.
 //
+// A 4MB page from page_alloc_large() goes in the PDE, with PTE_PS, and
+// replaces everything mapped in its 4MB.  'va' must be aligned to PTSIZE
+// for it, or page_insert returns -E_INVAL.  A 4KB page inserted into a
+// 4MB page unmaps all of it.
+//
 int
 page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
 {
-	pte_t *pe = pgdir_walk(pgdir, va, 1);
-	
-	if (pe == NULL)
+	pte_t *pe;
+
+	if (pp->pp_large)
+		return page_insert_large(pgdir, pp, va, perm);
+	if (pgdir[PDX(va)] & PTE_PS)
+		page_remove(pgdir, va);
+
+	if ((pe = pgdir_walk(pgdir, va, 1)) == NULL)
 		return -E_NO_MEM;
 
-	if (!(pp->pp_ref)++)
-		pp->pp_link = NULL;
+	page_incref(pp);
 
 	if (*pe & PTE_P)
 		page_remove(pgdir, va);
 
 	pte_set_addr(pe, page2pa(pp));
 	pte_set_flags(pe, PTE_P | perm);
+	if (pgdir_mem(pgdir))
+		pgdir_mem(pgdir)->pm_resident++;
 	
 	return 0;
 }
 
+// The part of page_insert() for a 4MB page 'pp'.  Copy-on-write works
+// a 4KB page at a time (see page_cow()), so it cannot be PTE_COW.
+static int
+page_insert_large(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
+{
+	pde_t *pde = &pgdir[PDX(va)];
+	struct PgdirMem *pm = pgdir_mem(pgdir);
+	pte_t *pt;
+	int i;
+
+	if ((uintptr_t) va % PTSIZE != 0 || (perm & PTE_COW))
+		return -E_INVAL;
+
+	page_incref(pp);
+	if (*pde & PTE_PS)
+		page_remove(pgdir, va);
+	else if (*pde & PTE_P) {
+		pt = (pte_t *) KADDR(PTE_ADDR(*pde));
+		for (i = 0; i < NPTENTRIES; i++)
+			if (pt[i] & PTE_P)
+				page_remove(pgdir, (char *) va + i * PGSIZE);
+		page_decref(pa2page(PTE_ADDR(*pde)));
+		if (pm)
+			pm->pm_ptables--;
+	}
+
+	*pde = page2pa(pp) | PTE_PS | PTE_P | (perm & ~PTE_PS);
+	if (pm)
+		pm->pm_resident += NPTENTRIES;
+	tlb_invalidate(pgdir, va);
+	return 0;
+}
+
 //
 // Return the page mapped at virtual address 'va'.
 // If pte_store is not zero, then we store in it the address
@@ -595,6 +1176,8 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
 // but should not be used by most callers.
 //
 // Return NULL if there is no page mapped at va.
+// For a 4MB page this is the page_alloc_large() page, wherever in it
+// 'va' points, and *pte_store is its PDE.
 //
 // Hint: the TA solution uses pgdir_walk and pa2page.
 //
@@ -627,6 +1210,8 @@ page_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
 // Hint: The TA solution is implemented using page_lookup,
 // 	tlb_invalidate, and page_decref.
 //
+// Unmapping any address of a 4MB page unmaps all of it.
+//
 void
 page_remove(pde_t *pgdir, void *va)
 {
@@ -634,6 +1219,8 @@ page_remove(pde_t *pgdir, void *va)
 	struct PageInfo *pp = page_lookup(pgdir, va, &pe);
 	if (pp == NULL)
 		return;
+	if (pgdir_mem(pgdir))
+		pgdir_mem(pgdir)->pm_resident -= *pe & PTE_PS ? NPTENTRIES : 1;
 	*pe = 0; // Sets PTE_P to 0, effectively removing the page from
 			// the virtual memory
 	tlb_invalidate(pgdir, va); // If we changed the current context,
@@ -642,16 +1229,255 @@ page_remove(pde_t *pgdir, void *va)
 	
 }
 
+//
+// Give the new page directory 'pgdir' its memory counters, which
+// page_insert(), page_remove() and pgdir_walk() keep up to date from
+// then on.  They live in the PageInfo of the page directory, where
+// pp_prev is unused while it is allocated.  kern_pgdir has none.
+//
+// Returns 0 on success, -E_NO_MEM if there is no memory for them.
+//
+int
+pgdir_mem_alloc(pde_t *pgdir)
+{
+	struct PgdirMem *pm;
+
+	if (!(pm = kmalloc(sizeof(*pm))))
+		return -E_NO_MEM;
+	pm->pm_resident = 0;
+	pm->pm_ptables = 1;
+	memset(pm->pm_regions, 0, sizeof(pm->pm_regions));
+	pa2page(PADDR(pgdir))->pp_mem = pm;
+	return 0;
+}
+
+//
+// Drop a reference to the page directory 'pgdir' of an env, freeing it
+// and its counters with the last.  Everything below UTOP must be
+// unmapped by then.
+//
+void
+pgdir_decref(pde_t *pgdir)
+{
+	struct PageInfo *pp = pa2page(PADDR(pgdir));
+
+	if (pp->pp_ref == 1 && pp->pp_mem) {
+		kfree(pp->pp_mem);
+		pp->pp_mem = NULL;
+	}
+	page_decref(pp);
+}
+
+//
+// Fill in the memory of the address space 'pgdir' for sys_meminfo()
+// and the meminfo monitor command, all but info->em_envid.  A page is
+// shared when something else holds a reference to it as well: another
+// address space, after fork or through PTE_SHARE, or the kernel, like
+// the zero page of demand-zero regions.  Unlike the other counts, this
+// changes as other envs come and go, so it is counted here.
+//
+// The caller keeps 'pgdir' from changing under it.
+//
+void
+pgdir_meminfo(pde_t *pgdir, struct EnvMemInfo *info)
+{
+	struct PgdirMem *pm = pgdir_mem(pgdir);
+	pte_t *pt;
+	int i, j;
+
+	info->em_resident = pm ? pm->pm_resident : 0;
+	info->em_ptables = pm ? pm->pm_ptables : 0;
+	info->em_shared = 0;
+	for (i = 0; i < PDX(UTOP); i++) {
+		if (!(pgdir[i] & PTE_P))
+			continue;
+		if (pgdir[i] & PTE_PS) {
+			if (pa2page(PTE_ADDR(pgdir[i]))->pp_ref > 1)
+				info->em_shared += NPTENTRIES;
+			continue;
+		}
+		pt = (pte_t *) KADDR(PTE_ADDR(pgdir[i]));
+		for (j = 0; j < NPTENTRIES; j++)
+			if ((pt[j] & PTE_P) &&
+			    pa2page(PTE_ADDR(pt[j]))->pp_ref > 1)
+				info->em_shared++;
+	}
+}
+
+//
+// Map every page 'src' maps below 'end' at the same address in 'dst',
+// for fork.  Writable and copy-on-write pages become copy-on-write in
+// both; PTE_SHARE pages stay shared as they are.  Copy-on-write works a
+// 4KB page at a time, so writable 4MB pages are copied at once instead,
+// unless PTE_SHARE; read-only ones are shared.  Both page directories
+// are walked once, a page table at a time.
+//
+// The caller flushes the TLB if 'src' is loaded.
+//
+// Returns 0 on success, -E_NO_MEM if a page table or a 4MB page could
+// not be allocated.  The pages copied so far stay mapped in 'dst'.
+//
+int
+pgdir_copy_cow(pde_t *dst, pde_t *src, uintptr_t end)
+{
+	struct PgdirMem *pm = pgdir_mem(dst);
+	struct PageInfo *pp;
+	uintptr_t va;
+	pte_t *spt, *dpt;
+	pte_t pte;
+	int i;
+
+	for (va = 0; va < end; va += PTSIZE) {
+		if (!(src[PDX(va)] & PTE_P))
+			continue;
+		if (src[PDX(va)] & PTE_PS) {
+			pp = pa2page(PTE_ADDR(src[PDX(va)]));
+			if ((src[PDX(va)] & (PTE_W | PTE_SHARE)) == PTE_W) {
+				if (!(pp = page_alloc_large(0)))
+					return -E_NO_MEM;
+				memmove(page2kva(pp),
+					KADDR(PTE_ADDR(src[PDX(va)])), PTSIZE);
+			}
+			dst[PDX(va)] = page2pa(pp) |
+				(src[PDX(va)] & (PTE_SYSCALL | PTE_PS));
+			page_incref(pp);
+			if (pm)
+				pm->pm_resident += NPTENTRIES;
+			continue;
+		}
+		spt = (pte_t *) KADDR(PTE_ADDR(src[PDX(va)]));
+		dpt = NULL;
+		for (i = 0; i < NPTENTRIES && va + i * PGSIZE < end; i++) {
+			if (!(spt[i] & PTE_P))
+				continue;
+			// va is the start of the page table, so this is
+			// its first entry.
+			if (!dpt && !(dpt = pgdir_walk(dst, (void *) va, 1)))
+				return -E_NO_MEM;
+			pte = spt[i];
+			if ((pte & (PTE_W | PTE_COW)) && !(pte & PTE_SHARE))
+				spt[i] = pte = (pte & ~PTE_W) | PTE_COW;
+			dpt[i] = PTE_ADDR(pte) | (pte & PTE_SYSCALL);
+			page_incref(pa2page(PTE_ADDR(pte)));
+			if (pm)
+				pm->pm_resident++;
+		}
+	}
+	return 0;
+}
+
+//
+// Resolve a write to the copy-on-write page at 'va' in 'pgdir': give
+// 'pgdir' a private, writable copy of the page, or, if no one else maps
+// it any more, just make it writable.
+//
+// The caller holds the big kernel lock for the running env that owns
+// 'pgdir', or that env's lock, so no one else can map the page
+// meanwhile: a pp_ref of 1 stays 1.
+//
+// Returns 0 on success, < 0 on error:
+//	-E_INVAL if no copy-on-write page is mapped at 'va'.  4MB pages
+//		are never copy-on-write (see page_insert_large()).
+//	-E_NO_MEM if there is no memory for the copy.
+//
+int
+page_cow(pde_t *pgdir, void *va)
+{
+	struct PageInfo *pp, *copy;
+	pte_t *pte;
+	int perm, r;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	if (!(pp = page_lookup(pgdir, va, &pte)) || (*pte & PTE_PS) ||
+	    !(*pte & PTE_COW))
+		return -E_INVAL;
+	perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+
+	if (pp->pp_ref == 1) {
+		*pte = PTE_ADDR(*pte) | perm;
+		tlb_invalidate(pgdir, va);
+		return 0;
+	}
+
+	if (!(copy = page_alloc(0)))
+		return -E_NO_MEM;
+	memmove(page2kva(copy), page2kva(pp), PGSIZE);
+	// This drops our reference to the shared page.
+	if ((r = page_insert(pgdir, copy, va, perm)) < 0)
+		page_free(copy);
+	return r;
+}
+
 //
 // Invalidate a TLB entry, but only if the page tables being
 // edited are the ones currently in use by the processor.
 //
+// The mappings above UTOP are global (PTE_G) and in every address
+// space, so they are flushed whatever is loaded; lcr3 would leave them.
+// The kernel only ever adds such mappings, so other CPUs are left alone.
+//
 void
 tlb_invalidate(pde_t *pgdir, void *va)
 {
 	// Flush the entry only if we're modifying the current address space.
-	if (!curenv || curenv->env_pgdir == pgdir)
+	if (!curenv || curenv->env_pgdir == pgdir || (uintptr_t) va >= UTOP)
 		invlpg(va);
+	// Other CPUs may be running threads on it.
+	if (pgdir != kern_pgdir && pgdir_shared(pgdir))
+		tlb_shootdown(pgdir);
+}
+
+//
+// TLB shootdown.  Make every other CPU running an env on 'pgdir' flush
+// its TLB before it runs user code again.  A CPU that is running user
+// code gets an IRQ_TLB IPI, which trap() answers at once, without the big
+// kernel lock, and we wait for it.  A CPU in the kernel flushes on its
+// way back to user mode (see tlb_enter_user()); waiting for it could
+// deadlock, as the kernel runs with interrupts off and it may be
+// spinning on a lock we hold.
+//
+void
+tlb_shootdown(pde_t *pgdir)
+{
+	struct CpuInfo *c;
+	uint32_t wait = 0;
+	int i;
+
+	for (i = 0; i < ncpu; i++) {
+		c = &cpus[i];
+		if (c == thiscpu || !c->cpu_env || c->cpu_env->env_pgdir != pgdir)
+			continue;
+		// xchg orders this before reading cpu_in_user, against
+		// the opposite order in tlb_enter_user().
+		xchg(&c->cpu_tlb_stale, 1);
+		if (c->cpu_in_user) {
+			lapic_ipi_cpu(c->cpu_id, IRQ_OFFSET + IRQ_TLB);
+			wait |= 1 << i;
+		}
+	}
+	for (i = 0; i < ncpu; i++)
+		if (wait & (1 << i))
+			while (cpus[i].cpu_tlb_stale && cpus[i].cpu_in_user)
+				asm volatile("pause");
+}
+
+// Flush the TLB if tlb_shootdown() asked us to.  Call with interrupts
+// off just before returning to user mode.
+void
+tlb_enter_user(void)
+{
+	xchg(&thiscpu->cpu_in_user, 1);
+	if (thiscpu->cpu_tlb_stale) {
+		thiscpu->cpu_tlb_stale = 0;
+		lcr3(rcr3());
+	}
+}
+
+// Note that we trapped from user mode into the kernel.
+void
+tlb_leave_user(void)
+{
+	thiscpu->cpu_in_user = 0;
 }
 
 //
@@ -696,7 +1522,7 @@ mmio_map_region(physaddr_t pa, size_t size)
                     base, 
                     ROUNDUP(size, PGSIZE), 
                     pa, 
-                    PTE_PCD | PTE_PWT | PTE_W);
+                    PTE_PCD | PTE_PWT | PTE_W | PTE_G);
     
     base = ROUNDUP(base + size, PGSIZE);
     return res;
@@ -729,14 +1555,30 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm)
 	pte_t *p;
 	uintptr_t chkaddr = (uintptr_t) va;
 	uintptr_t chkaddr_last = ROUNDUP((uintptr_t) va + len, PGSIZE);
+	uintptr_t step = PGSIZE;
 	perm = perm | PTE_P;
 	
-	for (; chkaddr < chkaddr_last; chkaddr = ROUNDDOWN(chkaddr + PGSIZE, PGSIZE)) {
+	for (; chkaddr < chkaddr_last; chkaddr = ROUNDDOWN(chkaddr + step, step)) {
 		if (chkaddr >= ULIM)
 			goto umem_check_bad;
 		p = pgdir_walk(env->env_pgdir, (void *) chkaddr, 0);
+		// Fill in demand-zero memory, as a user access would.
+		if ((p == NULL || !(*p & PTE_P)) &&
+		    env_region_fault(env, chkaddr, perm & PTE_W) == 0)
+			p = pgdir_walk(env->env_pgdir, (void *) chkaddr, 0);
+		// And break copy-on-write for a write, as a user write
+		// would: a region page that was read first is the zero page.
+		if (p && (perm & PTE_W) &&
+		    (*p & (PTE_P | PTE_COW)) == (PTE_P | PTE_COW)) {
+			env_lock(env);
+			page_cow(env->env_pgdir, (void *) chkaddr);
+			env_unlock(env);
+			p = pgdir_walk(env->env_pgdir, (void *) chkaddr, 0);
+		}
 		if (p == NULL || (*p & perm) != perm)
 			goto umem_check_bad;
+		// A 4MB page is checked at once.
+		step = *p & PTE_PS ? PTSIZE : PGSIZE;
 	}
 		
 	return 0;
@@ -769,60 +1611,61 @@ user_mem_assert(struct Env *env, const void *va, size_t len, int perm)
 // --------------------------------------------------------------
 
 //
-// Check that the pages on the page_free_list are reasonable.
+// Check that the free pages are reasonable.
 //
 static void
 check_page_free_list(bool only_low_memory)
 {
-	struct PageInfo *pp;
+	struct PageZone *z;
+	struct PageInfo *pp, *blk;
 	unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
 	int nfree_basemem = 0, nfree_extmem = 0;
 	char *first_free_page;
+	int k, j;
 
-	if (!page_free_list)
-		panic("'page_free_list' is a null pointer!");
-
-	if (only_low_memory) {
-		// Move pages with lower addresses first in the free
-		// list, since entry_pgdir does not map all pages.
-		struct PageInfo *pp1, *pp2;
-		struct PageInfo **tp[2] = { &pp1, &pp2 };
-		for (pp = page_free_list; pp; pp = pp->pp_link) {
-			int pagetype = PDX(page2pa(pp)) >= pdx_limit;
-			*tp[pagetype] = pp;
-			tp[pagetype] = &pp->pp_link;
-		}
-		*tp[1] = 0;
-		*tp[0] = pp2;
-		page_free_list = pp1;
-	}
+	if (!page_nfree())
+		panic("no free pages!");
 
-	// if there's a page that shouldn't be on the free list,
-	// try to make sure it eventually causes trouble.
-	for (pp = page_free_list; pp; pp = pp->pp_link)
-		if (PDX(page2pa(pp)) < pdx_limit)
+	first_free_page = (char *) boot_alloc(0);
+	for (z = page_zones; z < page_zones + NZONES; z++)
+	for (k = 0; k <= PAGE_MAXORDER; k++)
+	for (blk = z->pz_free[k]; blk; blk = blk->pp_link) {
+		// check that we didn't corrupt the free lists themselves
+		assert(blk >= pages);
+		assert(blk + (1 << k) <= pages + npages);
+		assert(((char *) blk - (char *) pages) % sizeof(*blk) == 0);
+		assert(blk->pp_order == k);
+		assert((blk - pages) % (1 << k) == 0);
+		assert(page_zone(blk - pages) == z);
+		assert(page_zone(blk - pages + (1 << k) - 1) == z);
+
+		for (j = 0; j < (1 << k); j++) {
+			pp = blk + j;
+			assert(j == 0 || pp->pp_order == -1);
+			assert(pp->pp_ref == 0);
+
+			// Before kern_pgdir, page_init() only frees the
+			// memory entry_pgdir maps.
+			assert(PDX(page2pa(pp)) < pdx_limit);
+
+			// if there's a page that shouldn't be free, try to
+			// make sure it eventually causes trouble.
 			memset(page2kva(pp), 0x97, 128);
 
-	first_free_page = (char *) boot_alloc(0);
-	for (pp = page_free_list; pp; pp = pp->pp_link) {
-		// check that we didn't corrupt the free list itself
-		assert(pp >= pages);
-		assert(pp < pages + npages);
-		assert(((char *) pp - (char *) pages) % sizeof(*pp) == 0);
-
-		// check a few pages that shouldn't be on the free list
-		assert(page2pa(pp) != 0);
-		assert(page2pa(pp) != IOPHYSMEM);
-		assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
-		assert(page2pa(pp) != EXTPHYSMEM);
-		assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
-		// (new test for lab 4)
-		assert(page2pa(pp) != MPENTRY_PADDR);
-
-		if (page2pa(pp) < EXTPHYSMEM)
-			++nfree_basemem;
-		else
-			++nfree_extmem;
+			// check a few pages that shouldn't be free
+			assert(page2pa(pp) != 0);
+			assert(page2pa(pp) != IOPHYSMEM);
+			assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+			assert(page2pa(pp) != EXTPHYSMEM);
+			assert(page2pa(pp) < EXTPHYSMEM || (char *) page2kva(pp) >= first_free_page);
+			// (new test for lab 4)
+			assert(page2pa(pp) != MPENTRY_PADDR);
+
+			if (page2pa(pp) < EXTPHYSMEM)
+				++nfree_basemem;
+			else
+				++nfree_extmem;
+		}
 	}
 
 	assert(nfree_extmem > 0);
@@ -830,6 +1673,33 @@ check_page_free_list(bool only_low_memory)
 	cprintf("check_page_free_list() succeeded!\n");
 }
 
+// Allocate all the free pages, for the checks that need the allocator
+// empty, and return them chained through pp_link.
+static struct PageInfo *
+check_take_free_pages(void)
+{
+	struct PageInfo *fl = NULL, *pp;
+
+	while ((pp = page_alloc(0))) {
+		pp->pp_link = fl;
+		fl = pp;
+	}
+	return fl;
+}
+
+// Free the pages check_take_free_pages() took.
+static void
+check_give_free_pages(struct PageInfo *fl)
+{
+	struct PageInfo *pp;
+
+	while ((pp = fl)) {
+		fl = pp->pp_link;
+		pp->pp_link = NULL;
+		page_free(pp);
+	}
+}
+
 //
 // Check the physical page allocator (page_alloc(), page_free(),
 // and page_init()).
@@ -847,8 +1717,7 @@ check_page_alloc(void)
 		panic("'pages' is a null pointer!");
 
 	// check number of free pages
-	for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
-		++nfree;
+	nfree = page_nfree();
 
 	// should be able to allocate three pages
 	pp0 = pp1 = pp2 = 0;
@@ -864,8 +1733,7 @@ check_page_alloc(void)
 	assert(page2pa(pp2) < npages*PGSIZE);
 
 	// temporarily steal the rest of the free pages
-	fl = page_free_list;
-	page_free_list = 0;
+	fl = check_take_free_pages();
 
 	// should be no free memory
 	assert(!page_alloc(0));
@@ -893,7 +1761,7 @@ check_page_alloc(void)
 		assert(c[i] == 0);
 
 	// give free list back
-	page_free_list = fl;
+	check_give_free_pages(fl);
 
 	// free the pages we took
 	page_free(pp0);
@@ -901,9 +1769,17 @@ check_page_alloc(void)
 	page_free(pp2);
 
 	// number of free pages should be the same
-	for (pp = page_free_list; pp; pp = pp->pp_link)
-		--nfree;
-	assert(nfree == 0);
+	assert(page_nfree() == nfree);
+
+	// blocks are aligned to their size and merge again when freed
+	assert((pp0 = page_alloc_order(3, 0)));
+	assert((pp0 - pages) % 8 == 0);
+	assert((pp1 = page_alloc_order(0, ALLOC_DMA)));
+	assert(page2pa(pp1) < 0x1000000);
+	assert(page_nfree() == nfree - 9);
+	page_free(pp1);
+	page_free_order(pp0, 3);
+	assert(page_nfree() == nfree);
 
 	cprintf("check_page_alloc() succeeded!\n");
 }
@@ -933,6 +1809,7 @@ check_kern_pgdir(void)
 	n = ROUNDUP(NENV*sizeof(struct Env), PGSIZE);
 	for (i = 0; i < n; i += PGSIZE)
 		assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+	assert(check_va2pa(pgdir, UTIME) == PADDR(timeinfo));
 
 	// check phys mem
 	for (i = 0; i < npages * PGSIZE; i += PGSIZE)
@@ -966,6 +1843,8 @@ check_kern_pgdir(void)
 			if (i >= PDX(KERNBASE)) {
 				assert(pgdir[i] & PTE_P);
 				assert(pgdir[i] & PTE_W);
+				assert(!page_pse || (pgdir[i] & (PTE_PS | PTE_G)) ==
+						    (PTE_PS | PTE_G));
 			} else
 				assert(pgdir[i] == 0);
 			break;
@@ -987,6 +1866,8 @@ check_va2pa(pde_t *pgdir, uintptr_t va)
 	pgdir = &pgdir[PDX(va)];
 	if (!(*pgdir & PTE_P))
 		return ~0;
+	if (*pgdir & PTE_PS)
+		return PTE_ADDR(*pgdir) + PTX(va) * PGSIZE;
 	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
 	if (!(p[PTX(va)] & PTE_P))
 		return ~0;
@@ -1017,8 +1898,7 @@ check_page(void)
 	assert(pp2 && pp2 != pp1 && pp2 != pp0);
 
 	// temporarily steal the rest of the free pages
-	fl = page_free_list;
-	page_free_list = 0;
+	fl = check_take_free_pages();
 
 	// should be no free memory
 	assert(!page_alloc(0));
@@ -1138,7 +2018,7 @@ check_page(void)
 	pp0->pp_ref = 0;
 
 	// give free list back
-	page_free_list = fl;
+	check_give_free_pages(fl);
 
 	// free the pages we took
 	page_free(pp0);
@@ -7,6 +7,7 @@
 #endif
 
 #include <inc/memlayout.h>
+#include <inc/meminfo.h>
 #include <inc/assert.h>
 struct Env;
 
@@ -16,6 +17,8 @@ extern struct PageInfo *pages;
 extern size_t npages;
 
 extern pde_t *kern_pgdir;
+extern bool page_pse;
+extern bool page_pge;
 
 
 /* This macro takes a kernel virtual address -- an address that points above
@@ -49,19 +52,42 @@ _kaddr(const char *file, int line, physaddr_t pa)
 enum {
 	// For page_alloc, zero the returned physical page.
 	ALLOC_ZERO = 1<<0,
+	// Allocate memory that ISA DMA can reach (below 16MB).
+	ALLOC_DMA = 1<<1,
+	// Allocate memory that 32-bit DMA can reach (below 4GB).
+	ALLOC_DMA32 = 1<<2,
 };
 
+// The largest block page_alloc_order() hands out is 2^PAGE_MAXORDER
+// pages (4MB).
+#define PAGE_MAXORDER	10
+
 void	mem_init(void);
 
 void	page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
 void	page_free(struct PageInfo *pp);
+struct PageInfo *page_alloc_order(int order, int alloc_flags);
+void	page_free_order(struct PageInfo *pp, int order);
+struct PageInfo *page_alloc_large(int alloc_flags);
+void	page_report(void);
+bool	page_zero_idle(void);
 int	page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
 void	page_remove(pde_t *pgdir, void *va);
 struct PageInfo *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
+void	page_incref(struct PageInfo *pp);
 void	page_decref(struct PageInfo *pp);
 
+int	pgdir_mem_alloc(pde_t *pgdir);
+void	pgdir_decref(pde_t *pgdir);
+void	pgdir_meminfo(pde_t *pgdir, struct EnvMemInfo *info);
+void	page_meminfo(struct MemInfo *info);
+int	pgdir_copy_cow(pde_t *dst, pde_t *src, uintptr_t end);
+int	page_cow(pde_t *pgdir, void *va);
 void	tlb_invalidate(pde_t *pgdir, void *va);
+void	tlb_shootdown(pde_t *pgdir);
+void	tlb_enter_user(void);
+void	tlb_leave_user(void);
 
 void *	mmio_map_region(physaddr_t pa, size_t size);
 
@@ -88,6 +114,39 @@ page2kva(struct PageInfo *pp)
 	return KADDR(page2pa(pp));
 }
 
+// A demand-zero region (see env_region_reserve()).  Its pages are only
+// allocated when first touched.
+#define NENVREGION		8
+
+struct EnvRegion {
+	uintptr_t er_start;		// First address; unused if er_end is 0
+	uintptr_t er_end;		// One past the last address
+	int er_perm;			// Permissions of the pages
+};
+
+// The memory an address space holds, kept up to date as pages and page
+// tables come and go (see pgdir_mem_alloc()), and its demand-zero
+// regions, which all threads on it share.
+struct PgdirMem {
+	uint32_t pm_resident;	// Pages mapped below UTOP
+	uint32_t pm_ptables;	// Page tables, and the page directory
+	struct EnvRegion pm_regions[NENVREGION];	// Demand-zero memory
+};
+
+// The counters of 'pgdir', or NULL for kern_pgdir.
+static inline struct PgdirMem *
+pgdir_mem(pde_t *pgdir)
+{
+	return pa2page(PADDR(pgdir))->pp_mem;
+}
+
+// Is 'pgdir' the address space of more than one env (threads)?
+static inline bool
+pgdir_shared(pde_t *pgdir)
+{
+	return pa2page(PADDR(pgdir))->pp_ref > 1;
+}
+
 // stressed out setters for PTEs
 static inline void
 pte_set_flags(pte_t *pte, int flags) 
@@ -28,6 +28,7 @@
 #include <kern/pmap.h>
 #include <kern/picirq.h>
 #include <kern/env.h>
+#include <kern/sched.h>
 #include <kern/isadma.h>
 #include <inc/string.h>
 #include <inc/x86.h>
@@ -46,10 +47,10 @@ int sb16io_base = 0x220;
 const int waitcycles = 0x100000;
 
 // Buffer for DMA transfers. Must not cross 64kb page bounderies. Must not be bigger
-// than 64kb. For optimal performance (?) we allocate 64kb for this.
-int16_t 
-sb16_buffer[SB16_BUFFER_SIZE_WORDS]
-__attribute__ ((aligned(DMA_BUFFER_SIZE_WORDS << 1)));
+// than 64kb. For optimal performance (?) we allocate 64kb for this, as one
+// block of the page allocator, which is aligned to its size (see sb16_init).
+#define SB16_BUFFER_ORDER 4 // 2^4 pages = 64kb
+int16_t *sb16_buffer;
 
 int16_t *audio_data;
 size_t data_length_words;
@@ -188,10 +189,12 @@ process_audio_data() {
     if (data_length_words <= 0) return;
     
     // heavy part
+    env_lock(locking_environment);
     physaddr_t prev_pgdir = rcr3();
     lcr3(PADDR(locking_environment->env_pgdir));
     memcpy(sb16_buffer, audio_data, MIN(DMA_BUFFER_SIZE_WORDS, data_length_words) << 1);
     lcr3(prev_pgdir);
+    env_unlock(locking_environment);
     
     // initiate playback
     playback(MIN(DMA_BUFFER_SIZE_WORDS, data_length_words));
@@ -233,6 +236,14 @@ fillbuffer() {
 }
 
 void sb16_init(void) {
+    struct PageInfo *pp;
+    
+    static_assert((PGSIZE << SB16_BUFFER_ORDER) == DMA_BUFFER_SIZE_WORDS << 1);
+    if (!(pp = page_alloc_order(SB16_BUFFER_ORDER, ALLOC_DMA)))
+        panic("sb16_init: no memory for the DMA buffer");
+    pp->pp_ref++;
+    sb16_buffer = page2kva(pp);
+    
     sb16dsp_reset();
     struct sb16_version_t version;
     sb16_read_version(&version);
@@ -262,8 +273,10 @@ void sb16_intr(void) {
         return;
     } else {
         // wakeup env
-        locking_environment->env_status = ENV_RUNNABLE;
+        env_lock(locking_environment);
         locking_environment->env_tf.tf_regs.reg_eax = 0;
+        sched_wakeup(locking_environment);
+        env_unlock(locking_environment);
         locking_environment = NULL;
     }
 }
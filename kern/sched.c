@@ -4,94 +4,605 @@
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/monitor.h>
+#include <kern/e1000.h>
+#include <kern/timer.h>
+#include <kern/time.h>
+#include <kern/perf.h>
+#include <kern/ksm.h>
+
+// Per-CPU run queues.
+//
+// Every ENV_RUNNABLE environment sits on exactly one run queue, linked
+// through env_rq_next/env_rq_prev.  Environments that are running,
+// blocked, dying or free are never queued.  Picking the next environment
+// is therefore O(1) no matter how many environments exist, instead of a
+// walk over all of 'envs'.
+//
+// IPC can wake an environment up without the big kernel lock, so every
+// queue has a lock of its own.  Callers that change the status of a
+// blocked environment hold that environment's env_lock(), which is taken
+// before any run queue lock.
+//
+// Each run queue is a multilevel feedback queue with ENV_NPRIO levels;
+// an env waits at level env_level and the best non-empty level runs
+// first.  An env that uses up its time slice drops a level, and one that
+// blocks before the slice ends climbs back towards its env_priority.
+// Lower levels get longer slices.  Every SCHED_BOOST_TICKS each CPU
+// lifts its envs back to their priority so nothing starves.
+//
+// There is no periodic timer tick.  Each CPU sets a one-shot timer for
+// the end of the running env's slice and stops it while it is idle.
+// CPU 0 also wakes up for the kernel timers (kern/timer.c).  (The clock
+// is the TSC, see kern/time.c.)  Whoever queues an env wakes
+// up a halted CPU with an IPI (sched_kick()) instead of waiting for it
+// to notice on a tick.
+struct RunLevel {
+	struct Env *rl_head;		// Next env to run
+	struct Env *rl_tail;		// Most recently queued env
+};
+
+struct RunQueue {
+	struct spinlock rq_lock;
+	struct RunLevel rq_levels[ENV_NPRIO];
+	unsigned rq_len;		// Number of queued envs
+	unsigned rq_nuser;		// How many of them are ENV_TYPE_USER
+	unsigned rq_ticks;		// Timer ticks seen by this CPU
+	unsigned rq_charged;		// Msecs of the timer deadline seen
+	unsigned rq_partial;		// Msecs not charged as a whole tick
+};
+
+static struct RunQueue runqueues[NCPU];
+
+#define SCHED_TICK_MS		10	// Time slices come in 10ms ticks
+#define SCHED_BOOST_TICKS	100	// 1 second
+
+// Length of a time slice at 'level', in timer ticks.
+static unsigned
+sched_slice(int level)
+{
+	return 1 << level;
+}
 
 void sched_halt(void);
 
+void
+sched_init(void)
+{
+	int i;
+
+	for (i = 0; i < NCPU; i++)
+		__spin_initlock(&runqueues[i].rq_lock, "runqueue");
+}
+
+static void
+runqueue_push(struct RunQueue *rq, struct Env *e)
+{
+	struct RunLevel *rl = &rq->rq_levels[e->env_level];
+
+	e->env_rq_next = NULL;
+	e->env_rq_prev = rl->rl_tail;
+	if (rl->rl_tail)
+		rl->rl_tail->env_rq_next = e;
+	else
+		rl->rl_head = e;
+	rl->rl_tail = e;
+
+	rq->rq_len++;
+	if (e->env_type == ENV_TYPE_USER)
+		rq->rq_nuser++;
+}
+
+static void
+runqueue_remove(struct RunQueue *rq, struct Env *e)
+{
+	struct RunLevel *rl = &rq->rq_levels[e->env_level];
+
+	if (e->env_rq_prev)
+		e->env_rq_prev->env_rq_next = e->env_rq_next;
+	else
+		rl->rl_head = e->env_rq_next;
+	if (e->env_rq_next)
+		e->env_rq_next->env_rq_prev = e->env_rq_prev;
+	else
+		rl->rl_tail = e->env_rq_prev;
+	e->env_rq_next = e->env_rq_prev = NULL;
+	e->env_rq_cpu = -1;
+
+	rq->rq_len--;
+	if (e->env_type == ENV_TYPE_USER)
+		rq->rq_nuser--;
+}
+
+// The best non-empty level of 'rq', or ENV_NPRIO if it is empty.
+static int
+runqueue_best_level(struct RunQueue *rq)
+{
+	int level;
+
+	for (level = 0; level < ENV_NPRIO; level++)
+		if (rq->rq_levels[level].rl_head)
+			break;
+	return level;
+}
+
+// Lift every queued env back to its priority (see SCHED_BOOST_TICKS).
+static void
+runqueue_boost(struct RunQueue *rq)
+{
+	struct Env *e, *next;
+	int level;
+
+	for (level = 1; level < ENV_NPRIO; level++) {
+		for (e = rq->rq_levels[level].rl_head; e; e = next) {
+			next = e->env_rq_next;
+			if (e->env_priority >= level)
+				continue;
+			runqueue_remove(rq, e);
+			e->env_level = e->env_priority;
+			e->env_slice = sched_slice(e->env_level);
+			e->env_rq_cpu = rq - runqueues;
+			runqueue_push(rq, e);
+		}
+	}
+}
+
+// May 'e' run on 'cpu'?  (See sys_env_set_affinity.)
+static bool
+sched_allowed(struct Env *e, int cpu)
+{
+	return (e->env_affinity >> cpu) & 1;
+}
+
+// Timer ticks that have passed on this CPU and not been charged yet.
+// Leftover milliseconds carry over to the next call.
+static unsigned
+sched_elapsed(struct RunQueue *rq)
+{
+	unsigned ms = lapic_timer_elapsed() - rq->rq_charged;
+
+	rq->rq_charged += ms;
+	rq->rq_partial += ms;
+	ms = rq->rq_partial / SCHED_TICK_MS;
+	rq->rq_partial %= SCHED_TICK_MS;
+	return ms;
+}
+
+// Charge 'n' timer ticks to this CPU's queue and to curenv's time
+// slice.  Returns true if curenv used up its slice.  The caller holds
+// rq->rq_lock.
+static bool
+sched_charge(struct RunQueue *rq, unsigned n)
+{
+	struct Env *e = curenv;
+	bool expired = false;
+
+	if (n == 0)
+		return false;
+
+	if (rq->rq_ticks % SCHED_BOOST_TICKS + n >= SCHED_BOOST_TICKS) {
+		runqueue_boost(rq);
+		if (e)
+			e->env_level = e->env_priority;
+	}
+	rq->rq_ticks += n;
+
+	if (e && e->env_status == ENV_RUNNING) {
+		e->env_slice -= MIN(n, e->env_slice);
+		if (e->env_slice == 0) {
+			if (e->env_level < ENV_PRIO_MIN)
+				e->env_level++;
+			e->env_slice = sched_slice(e->env_level);
+			expired = true;
+		}
+	}
+	return expired;
+}
+
+// Milliseconds until the first kernel timer may be due, or 0 if there
+// is none.  Only CPU 0 waits for kernel timers.
+static unsigned
+sched_timer_wait(void)
+{
+	unsigned deadline;
+	int ms;
+
+	if (cpunum() != 0 || !timer_deadline(&deadline))
+		return 0;
+	ms = deadline - time_msec();
+	return MAX(ms, 1);
+}
+
+// Set this CPU's timer for the end of e's time slice, or for the next
+// boost of its run queue or the next kernel timer if that comes first.
+static void
+sched_arm(struct Env *e)
+{
+	struct RunQueue *rq = &runqueues[cpunum()];
+	unsigned n, ms, wait;
+
+	n = MAX(e->env_slice, 1);
+	n = MIN(n, SCHED_BOOST_TICKS - rq->rq_ticks % SCHED_BOOST_TICKS);
+	ms = MAX(n * SCHED_TICK_MS - rq->rq_partial, 1);
+	if ((wait = sched_timer_wait()))
+		ms = MIN(ms, wait);
+	rq->rq_charged = 0;
+	lapic_timer_oneshot(perf_timer(ms));
+}
+
+static void
+sched_ipi(int cpu)
+{
+	lapic_ipi_cpu(cpus[cpu].cpu_id, IRQ_OFFSET + IRQ_WAKEUP);
+}
+
+// 'e' was just queued on 'cpu'.  Make sure some CPU notices without
+// waiting for a timer: wake 'cpu' if it is halted, or make it
+// reschedule if e belongs ahead of the env it is running.  Otherwise
+// wake a halted CPU that may run e, so that it steals e.
+//
+// Statuses are read without locks.  A CPU that is about to halt looks
+// at its own queue again after marking itself CPU_HALTED (see
+// sched_halt()), so it cannot miss an env queued there.
+static void
+sched_kick(struct Env *e, int cpu)
+{
+	struct Env *running;
+	int i;
+
+	if (cpu != cpunum()) {
+		if (cpus[cpu].cpu_status == CPU_HALTED) {
+			sched_ipi(cpu);
+			return;
+		}
+		running = cpus[cpu].cpu_env;
+		if (running && e->env_level < running->env_level) {
+			sched_ipi(cpu);
+			return;
+		}
+	} else if (!curenv)
+		return;		// we are about to pick e ourselves
+
+	for (i = 0; i < ncpu; i++)
+		if (i != cpunum() && sched_allowed(e, i) &&
+		    cpus[i].cpu_status == CPU_HALTED) {
+			sched_ipi(i);
+			return;
+		}
+}
+
+// Put a runnable environment at the tail of a run queue.
+// Environments go back to the CPU they last ran on (new environments
+// start out on the CPU that created them), so that they find their cache
+// and TLB still warm.  If the env may not run there, it goes to the
+// least loaded CPU it may use.  Idle CPUs steal work from the busiest
+// queue.
+void
+sched_enqueue(struct Env *e)
+{
+	struct RunQueue *rq;
+	int cpu, i;
+
+	assert(e->env_status == ENV_RUNNABLE);
+	if (e->env_rq_cpu >= 0)
+		return;
+
+	cpu = e->env_cpunum;
+	if (cpu < 0 || cpu >= ncpu || !sched_allowed(e, cpu)) {
+		cpu = -1;
+		for (i = 0; i < ncpu; i++)
+			if (sched_allowed(e, i) && (cpu < 0 ||
+			    runqueues[i].rq_len < runqueues[cpu].rq_len))
+				cpu = i;
+		assert(cpu >= 0);
+	}
+	rq = &runqueues[cpu];
+
+	spin_lock(&rq->rq_lock);
+	e->env_rq_cpu = cpu;
+	runqueue_push(rq, e);
+	spin_unlock(&rq->rq_lock);
+
+	sched_kick(e, cpu);
+}
+
+// Take an environment off its run queue, if it is on one.
+void
+sched_dequeue(struct Env *e)
+{
+	struct RunQueue *rq;
+	int cpu = e->env_rq_cpu;
+
+	if (cpu < 0)
+		return;
+
+	rq = &runqueues[cpu];
+	spin_lock(&rq->rq_lock);
+	if (e->env_rq_cpu == cpu)
+		runqueue_remove(rq, e);
+	spin_unlock(&rq->rq_lock);
+}
+
+// Make a blocked environment runnable again.
+// Environments that are already runnable, running or dying are left alone.
+// The caller holds env_lock(e) unless e is not visible to anyone else yet.
+//
+// The file and network servers (and their helpers) spend their lives
+// waiting for requests, so they go straight back to their priority and
+// get ahead of batch work.
+void
+sched_wakeup(struct Env *e)
+{
+	if (e->env_status != ENV_NOT_RUNNABLE)
+		return;
+	if (e->env_type != ENV_TYPE_USER)
+		e->env_level = e->env_priority;
+	e->env_slice = sched_slice(e->env_level);
+	e->env_status = ENV_RUNNABLE;
+	sched_enqueue(e);
+}
+
+// Block an environment until someone calls sched_wakeup() on it.
+// If the environment is running on another CPU, that CPU will notice
+// the status change the next time the environment enters the kernel.
+// The caller holds env_lock(e).
+//
+// An env that blocks (an IPC receiver, say) before using half of its
+// time slice is interactive rather than CPU-bound, so it climbs a level.
+void
+sched_block(struct Env *e)
+{
+	if (e->env_status == ENV_DYING)
+		return;
+	sched_dequeue(e);
+	if (e->env_slice * 2 > sched_slice(e->env_level) &&
+	    e->env_level > e->env_priority)
+		e->env_level--;
+	e->env_status = ENV_NOT_RUNNABLE;
+}
+
+// Change the priority of an environment and move it to that level.
+// The caller holds env_lock(e).
+void
+sched_set_priority(struct Env *e, int priority)
+{
+	bool queued = e->env_rq_cpu >= 0;
+
+	if (queued)
+		sched_dequeue(e);
+	e->env_priority = e->env_level = priority;
+	e->env_slice = sched_slice(priority);
+	if (queued)
+		sched_enqueue(e);
+}
+
+// Restrict the CPUs 'e' may run on to 'mask'.  The caller holds
+// env_lock(e) and has checked that mask names some CPU that exists.
+// A queued env moves to a CPU it may use at once; a running one when
+// it is next preempted.
+void
+sched_set_affinity(struct Env *e, uint32_t mask)
+{
+	bool queued = e->env_rq_cpu >= 0;
+
+	if (queued)
+		sched_dequeue(e);
+	e->env_affinity = mask;
+	if (queued)
+		sched_enqueue(e);
+}
+
+// Called from the timer interrupt.  Run the kernel timers that are
+// due, charge the ticks since the timer was set to curenv's time slice
+// and return true if curenv should keep the CPU.  When the slice runs
+// out curenv drops a level and makes way for envs of its new level; it
+// always makes way for an env of a better level waiting on this CPU.
+bool
+sched_tick(void)
+{
+	struct RunQueue *rq = &runqueues[cpunum()];
+	struct Env *e = curenv;
+	bool keep = false, expired;
+	int best;
+
+	timer_run();
+
+	spin_lock(&rq->rq_lock);
+	expired = sched_charge(rq, sched_elapsed(rq));
+	if (e && e->env_status == ENV_RUNNING && sched_allowed(e, cpunum())) {
+		best = runqueue_best_level(rq);
+		keep = best > e->env_level ||
+			(best == e->env_level && !expired);
+	}
+	spin_unlock(&rq->rq_lock);
+
+	if (keep)
+		sched_arm(e);
+	return keep;
+}
+
+// Steal an environment from the busiest other run queue.
+// If 'keep' is set this CPU still has a runnable environment of its own,
+// so only steal from queues with more than one waiting environment.
+static struct Env *
+sched_steal(bool keep)
+{
+	struct RunQueue *rq, *victim = NULL;
+	struct Env *e = NULL;
+	int i, level;
+
+	// Queue lengths are read without the queue locks; they only pick
+	// the victim and are checked again under its lock.
+	for (i = 0; i < ncpu; i++) {
+		rq = &runqueues[i];
+		if (i == cpunum() || !rq->rq_len)
+			continue;
+		if (!victim || rq->rq_len > victim->rq_len)
+			victim = rq;
+	}
+
+	if (!victim)
+		return NULL;
+
+	// Take the env from the tail of the victim's best level: it is the
+	// most important env there, and the victim would run it last.
+	// Skip envs that may not run on this CPU.
+	spin_lock(&victim->rq_lock);
+	if (victim->rq_len >= (keep ? 2 : 1)) {
+		for (level = 0; level < ENV_NPRIO && !e; level++)
+			for (e = victim->rq_levels[level].rl_tail; e; e = e->env_rq_prev)
+				if (sched_allowed(e, cpunum()))
+					break;
+		if (e)
+			runqueue_remove(victim, e);
+	}
+	spin_unlock(&victim->rq_lock);
+	return e;
+}
+
 // Choose a user environment to run and run it.
 void
 sched_yield(void)
 {
-	int start, i, index;
-
-	// Implement simple round-robin scheduling.
-	//
-	// Search through 'envs' for an ENV_RUNNABLE environment in
-	// circular fashion starting just after the env this CPU was
-	// last running.  Switch to the first such environment found.
-	//
-	// If no envs are runnable, but the environment previously
-	// running on this CPU is still ENV_RUNNING, it's okay to
-	// choose that environment.
-	//
-	// Never choose an environment that's currently running on
-	// another CPU (env_status == ENV_RUNNING). If there are
-	// no runnable environments, simply drop through to the code
-	// below to halt the cpu.
-
-	// LAB 4: Your code here.
-	
-	// This round robin scheduling is done by round-robining the 'envs'
-	// array. we dont care about the environments ids!
-	start = -1;
-	if (curenv != NULL)
-		start = curenv - envs; // it works because of pointer arithmetics
-		
-	for (i = start + 1; i < start + NENV; i++) {
-		// index for 'envs'. we do a cyclic iteration, from 'curenv'
-		// or from the first env if curenv == NULL.
-		index = i % NENV; 
-		
-		// If we found a runnable env, run it. env_run will not return.
-		if (envs[index].env_status == ENV_RUNNABLE)
-			env_run(&envs[index]);
+	struct RunQueue *rq = &runqueues[cpunum()];
+	struct Env *e;
+	bool keep;
+
+	// System calls that run without the big kernel lock end up here
+	// when the calling env blocks or dies.
+	if (!kernel_lock_held())
+		lock_kernel();
+
+	// Another CPU may have marked curenv ENV_DYING while it was in such
+	// a system call; nobody else will free it.
+	if (curenv && curenv->env_status == ENV_DYING) {
+		env_free(curenv);
+		curenv = NULL;
+	}
+
+	// curenv may no longer be allowed on this CPU (see
+	// sys_env_set_affinity).  Then it is not kept: env_run() or
+	// sched_halt() hands it to a CPU it may use once we have switched
+	// away from it.
+	keep = curenv && curenv->env_status == ENV_RUNNING &&
+	       sched_allowed(curenv, cpunum());
+
+	// Run the first env of the best level of this CPU's queue.  If the
+	// queue is empty, try to take work from another CPU.  env_run()
+	// puts the env we were running (if it is still ENV_RUNNING) at the
+	// tail of its level, which gives round-robin order within a level.
+	spin_lock(&rq->rq_lock);
+	sched_charge(rq, sched_elapsed(rq));
+	if (rq->rq_len) {
+		e = rq->rq_levels[runqueue_best_level(rq)].rl_head;
+		runqueue_remove(rq, e);
+	} else
+		e = NULL;
+	spin_unlock(&rq->rq_lock);
+	if (!e)
+		e = sched_steal(keep);
+
+	if (e) {
+		sched_arm(e);
+		env_run(e);
+	}
+
+	// Nothing else wants this CPU: keep running the current env.
+	if (keep) {
+		sched_arm(curenv);
+		env_run(curenv);
 	}
-	
-	if (start >= 0 && envs[start].env_status == ENV_RUNNING)
-		env_run(&envs[start]);
 
 	// we have nothing to do.
 	// sched_halt never returns
 	sched_halt();
 }
 
-// Halt this CPU when there is nothing to do. Wait until the
-// timer interrupt wakes it up. This function never returns.
+// Return true if some ENV_TYPE_USER environment can still make progress.
+// Only looks at the run queues, the CPUs and the envs waiting for the
+// network card, so the cost does not depend on NENV.
+static bool
+sched_user_active(void)
+{
+	struct Env *e;
+	int i;
+
+	for (i = 0; i < ncpu; i++) {
+		if (runqueues[i].rq_nuser)
+			return true;
+
+		e = cpus[i].cpu_env;
+		if (e && e->env_type == ENV_TYPE_USER &&
+		    (e->env_status == ENV_RUNNING || e->env_status == ENV_DYING))
+			return true;
+	}
+
+	return e1000_rx_waiting(ENV_TYPE_USER) || env_user_timeouts();
+}
+
+// Halt this CPU when there is nothing to do. Wait until an interrupt
+// (say an IPI from sched_kick()) wakes it up.
+// This function never returns.
 //
 void
 sched_halt(void)
 {
-	int i;
+	struct Env *prev = curenv;
+	struct RunQueue *rq;
 
 	// For debugging and testing purposes, if there are no runnable
 	// environments in the system, then drop into the kernel monitor.
-	for (i = 0; i < NENV; i++) {
-		if ((
-            envs[i].env_e1000_receiving ||
-            envs[i].env_status == ENV_RUNNABLE ||
-		     envs[i].env_status == ENV_RUNNING ||
-		     envs[i].env_status == ENV_DYING
-		     ) && envs[i].env_type == ENV_TYPE_USER)
-			break;
-	}
-    
-	if (i == NENV) {
+	if (!sched_user_active()) {
 		cprintf("No runnable environments in the system!\n");
 		while (1)
 			monitor(NULL);
 	}
 
 	// Mark that no environment is running on this CPU
+	if (curenv) {
+		env_account_kernel(curenv);
+		env_account_switch(curenv);
+	}
 	curenv = NULL;
 	lcr3(PADDR(kern_pgdir));
 
+	// An env that may no longer run here (see sched_yield()) goes to a
+	// CPU it may use, now that it is not loaded here any more.
+	if (prev && prev->env_status == ENV_RUNNING) {
+		env_lock(prev);
+		prev->env_status = ENV_RUNNABLE;
+		sched_enqueue(prev);
+		env_unlock(prev);
+	}
+
+	// No slice to time: stop the timer until there is work again,
+	// unless this CPU has to wake up for a kernel timer or a sample.
+	rq = &runqueues[cpunum()];
+	rq->rq_charged = 0;
+	lapic_timer_oneshot(perf_timer(sched_timer_wait()));
+
 	// Mark that this CPU is in the HALT state, so that when
 	// timer interupts come in, we know we should re-acquire the
 	// big kernel lock
 	xchg(&thiscpu->cpu_status, CPU_HALTED);
 
+	// sched_kick() only wakes CPUs that are halted, so check for an
+	// env queued here since sched_yield() looked.
+	if (runqueues[cpunum()].rq_len) {
+		xchg(&thiscpu->cpu_status, CPU_STARTED);
+		sched_yield();
+	}
+
 	// Release the big kernel lock as if we were "leaving" the kernel
 	unlock_kernel();
 
+	// Merge identical pages of the envs that want it, a few at a time
+	// while nothing is queued here (see kern/ksm.c), then zero free
+	// pages for page_alloc(ALLOC_ZERO) until there is work.
+	while (!rq->rq_len && ksm_idle())
+		;
+	while (!rq->rq_len && page_zero_idle())
+		;
+
 	// Reset stack pointer, enable interrupts and then halt.
 	asm volatile (
 		"movl $0, %%ebp\n"
@@ -6,7 +6,21 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/types.h>
+
+struct Env;
+
+void sched_init(void);
+
 // This function does not return.
 void sched_yield(void) __attribute__((noreturn));
 
+void sched_enqueue(struct Env *e);
+void sched_dequeue(struct Env *e);
+void sched_wakeup(struct Env *e);
+void sched_block(struct Env *e);
+void sched_set_priority(struct Env *e, int priority);
+void sched_set_affinity(struct Env *e, uint32_t mask);
+bool sched_tick(void);
+
 #endif	// !JOS_KERN_SCHED_H
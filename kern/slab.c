@@ -0,0 +1,444 @@
+// A slab allocator for small kernel objects.
+//
+// Each object cache hands out objects of one size, carved out of slabs:
+// single pages from page_alloc() with a header in front.  The header
+// keeps the indices of the free objects on a stack, so a free object
+// stays as the constructor left it, and an object finds its slab, and so
+// its cache, by rounding its address down to the page.
+//
+// In front of the slabs, every CPU keeps a few free objects of each
+// cache, like the page caches in kern/pmap.c.  Only that CPU uses them,
+// with interrupts off, so the common case takes no lock; they are
+// refilled from and drained to the slabs KMEM_CPU_BATCH at a time, under
+// the cache's lock.  A cache keeps at most one empty slab and gives the
+// pages of the others back.
+//
+// kmalloc() serves any size up to KMEM_MAXSIZE from a set of caches of
+// power-of-two sizes.
+
+#include <inc/assert.h>
+#include <inc/string.h>
+#include <kern/slab.h>
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+#define KMEM_NCACHES	32
+#define KMEM_NAMELEN	16
+#define KMEM_ALIGN	8		// Objects are aligned to this
+#define KMEM_CPU_SIZE	16		// Free objects each CPU keeps
+#define KMEM_CPU_BATCH	8		// Objects moved to or from the slabs
+
+#define KMALLOC_MINSHIFT	4	// kmalloc-16 ...
+#define KMALLOC_MAXSHIFT	10	// ... to kmalloc-1024
+
+struct Slab {
+	struct KmemCache *sl_cache;
+	struct Slab *sl_next;		// Next slab on the same list
+	struct Slab *sl_prev;
+	uint16_t sl_nfree;		// Free objects
+	uint16_t sl_free[];		// Their indices, as a stack
+};
+
+struct KmemCpu {
+	void *kcc_objs[KMEM_CPU_SIZE];
+	int kcc_count;
+	uint32_t kcc_allocs;		// (Unlocked statistics)
+	uint32_t kcc_hits;		// ... served from kcc_objs
+	uint32_t kcc_frees;
+};
+
+struct KmemCache {
+	char kc_name[KMEM_NAMELEN];
+	size_t kc_size;			// 0 if the slot is unused
+	unsigned kc_perslab;		// Objects per slab
+	unsigned kc_offset;		// Offset of the first object in a slab
+	void (*kc_ctor)(void *obj);
+
+	struct spinlock kc_lock;	// Protects the slab lists
+	struct Slab *kc_partial;	// Slabs with free and used objects
+	struct Slab *kc_full;		// Slabs with no free object
+	struct Slab *kc_empty;		// At most one slab with no used object
+	unsigned kc_nslabs;
+	uint32_t kc_grows;		// Slabs ever allocated
+	uint32_t kc_shrinks;		// ... and given back
+
+	struct KmemCpu kc_cpu[NCPU];
+};
+
+static struct spinlock kmem_lock;	// Protects kmem_caches
+static struct KmemCache kmem_caches[KMEM_NCACHES];
+static struct KmemCache *kmalloc_caches[KMALLOC_MAXSHIFT + 1];
+
+static void check_kmem(void);
+
+static void
+slab_push(struct Slab **list, struct Slab *s)
+{
+	s->sl_prev = NULL;
+	s->sl_next = *list;
+	if (*list)
+		(*list)->sl_prev = s;
+	*list = s;
+}
+
+static void
+slab_unlink(struct Slab **list, struct Slab *s)
+{
+	if (s->sl_prev)
+		s->sl_prev->sl_next = s->sl_next;
+	else
+		*list = s->sl_next;
+	if (s->sl_next)
+		s->sl_next->sl_prev = s->sl_prev;
+}
+
+static void *
+slab_obj(struct KmemCache *c, struct Slab *s, unsigned i)
+{
+	return (char *) s + c->kc_offset + i * c->kc_size;
+}
+
+// Allocate and construct a new slab for 'c'.  The caller holds its lock.
+static struct Slab *
+kmem_grow(struct KmemCache *c)
+{
+	struct PageInfo *pp;
+	struct Slab *s;
+	unsigned i;
+
+	if (!(pp = page_alloc(0)))
+		return NULL;
+	s = page2kva(pp);
+	s->sl_cache = c;
+	s->sl_nfree = c->kc_perslab;
+	// Hand out the objects in address order.
+	for (i = 0; i < c->kc_perslab; i++) {
+		s->sl_free[i] = c->kc_perslab - 1 - i;
+		if (c->kc_ctor)
+			c->kc_ctor(slab_obj(c, s, i));
+	}
+	c->kc_nslabs++;
+	c->kc_grows++;
+	return s;
+}
+
+// Take a free object from the slabs of 'c', growing it if there is
+// none.  The caller holds its lock.
+static void *
+kmem_take(struct KmemCache *c)
+{
+	struct Slab *s;
+
+	if (!(s = c->kc_partial)) {
+		if ((s = c->kc_empty))
+			slab_unlink(&c->kc_empty, s);
+		else if (!(s = kmem_grow(c)))
+			return NULL;
+		slab_push(&c->kc_partial, s);
+	}
+	if (--s->sl_nfree == 0) {
+		slab_unlink(&c->kc_partial, s);
+		slab_push(&c->kc_full, s);
+	}
+	return slab_obj(c, s, s->sl_free[s->sl_nfree]);
+}
+
+// Return 'obj' to its slab in 'c'.  The caller holds its lock.
+static void
+kmem_put(struct KmemCache *c, void *obj)
+{
+	struct Slab *s = ROUNDDOWN(obj, PGSIZE);
+
+	if (s->sl_nfree == 0) {
+		slab_unlink(&c->kc_full, s);
+		slab_push(&c->kc_partial, s);
+	}
+	s->sl_free[s->sl_nfree++] =
+		((char *) obj - (char *) s - c->kc_offset) / c->kc_size;
+	if (s->sl_nfree < c->kc_perslab)
+		return;
+
+	slab_unlink(&c->kc_partial, s);
+	if (!c->kc_empty) {
+		slab_push(&c->kc_empty, s);
+		return;
+	}
+	page_free(pa2page(PADDR(s)));
+	c->kc_nslabs--;
+	c->kc_shrinks++;
+}
+
+//
+// Create a cache of objects of 'size' bytes, named 'name' (for
+// kmem_report()).  If 'ctor' is not NULL, it is called on each object
+// when its slab is allocated, and not again: objects must be freed in
+// their constructed state.
+//
+// Returns NULL if size is 0 or more than KMEM_MAXSIZE, or if there are
+// KMEM_NCACHES caches already.
+//
+struct KmemCache *
+kmem_cache_create(const char *name, size_t size, void (*ctor)(void *obj))
+{
+	struct KmemCache *c;
+	unsigned n;
+
+	if (size == 0 || size > KMEM_MAXSIZE)
+		return NULL;
+
+	spin_lock(&kmem_lock);
+	for (c = kmem_caches; c < kmem_caches + KMEM_NCACHES; c++)
+		if (!c->kc_size)
+			break;
+	if (c == kmem_caches + KMEM_NCACHES) {
+		spin_unlock(&kmem_lock);
+		return NULL;
+	}
+
+	// The slot may have been used before, so keep its lock on the list
+	// of locks (see kern/spinlock.c) rather than clearing it.
+	memset(c->kc_name, 0, KMEM_NAMELEN);
+	strncpy(c->kc_name, name, KMEM_NAMELEN - 1);
+	c->kc_size = ROUNDUP(size, KMEM_ALIGN);
+	c->kc_ctor = ctor;
+	__spin_initlock(&c->kc_lock, c->kc_name);
+	c->kc_partial = c->kc_full = c->kc_empty = NULL;
+	c->kc_nslabs = c->kc_grows = c->kc_shrinks = 0;
+	memset(c->kc_cpu, 0, sizeof(c->kc_cpu));
+
+	// As many objects as fit after the header and its index stack.
+	n = (PGSIZE - sizeof(struct Slab)) / (c->kc_size + sizeof(uint16_t));
+	while (ROUNDUP(sizeof(struct Slab) + n * sizeof(uint16_t), KMEM_ALIGN) +
+	       n * c->kc_size > PGSIZE)
+		n--;
+	c->kc_perslab = n;
+	c->kc_offset = ROUNDUP(sizeof(struct Slab) + n * sizeof(uint16_t),
+			       KMEM_ALIGN);
+	spin_unlock(&kmem_lock);
+	return c;
+}
+
+//
+// Destroy cache 'c' and give back its slabs.  Every object must have
+// been freed to it, and no one may use it any more.
+//
+void
+kmem_cache_destroy(struct KmemCache *c)
+{
+	struct KmemCpu *cc;
+	int i;
+
+	spin_lock(&c->kc_lock);
+	for (cc = c->kc_cpu; cc < c->kc_cpu + NCPU; cc++) {
+		for (i = 0; i < cc->kcc_count; i++)
+			kmem_put(c, cc->kcc_objs[i]);
+		cc->kcc_count = 0;
+	}
+	if (c->kc_partial || c->kc_full)
+		panic("kmem_cache_destroy: %s has objects in use", c->kc_name);
+	if (c->kc_empty)
+		page_free(pa2page(PADDR(c->kc_empty)));
+	c->kc_empty = NULL;
+	c->kc_nslabs = 0;
+	spin_unlock(&c->kc_lock);
+
+	spin_lock(&kmem_lock);
+	c->kc_size = 0;
+	spin_unlock(&kmem_lock);
+}
+
+//
+// Allocate an object from cache 'c'.  Its contents are as the
+// constructor, or the last user, left them.
+//
+// Returns NULL if out of memory.
+//
+void *
+kmem_cache_alloc(struct KmemCache *c)
+{
+	struct KmemCpu *cc = &c->kc_cpu[cpunum()];
+	void *obj;
+
+	cc->kcc_allocs++;
+	if (cc->kcc_count > 0) {
+		cc->kcc_hits++;
+		return cc->kcc_objs[--cc->kcc_count];
+	}
+
+	spin_lock(&c->kc_lock);
+	while (cc->kcc_count < KMEM_CPU_BATCH && (obj = kmem_take(c)))
+		cc->kcc_objs[cc->kcc_count++] = obj;
+	spin_unlock(&c->kc_lock);
+	return cc->kcc_count > 0 ? cc->kcc_objs[--cc->kcc_count] : NULL;
+}
+
+//
+// Return 'obj', from kmem_cache_alloc(c), to cache 'c'.
+//
+void
+kmem_cache_free(struct KmemCache *c, void *obj)
+{
+	struct KmemCpu *cc = &c->kc_cpu[cpunum()];
+	struct Slab *s = ROUNDDOWN(obj, PGSIZE);
+	int i;
+
+	if (s->sl_cache != c)
+		panic("kmem_cache_free: %p is not from cache %s", obj,
+		      c->kc_name);
+	cc->kcc_frees++;
+
+	// Give the slabs back the objects that have been here longest.
+	if (cc->kcc_count == KMEM_CPU_SIZE) {
+		spin_lock(&c->kc_lock);
+		for (i = 0; i < KMEM_CPU_BATCH; i++)
+			kmem_put(c, cc->kcc_objs[i]);
+		spin_unlock(&c->kc_lock);
+		cc->kcc_count -= KMEM_CPU_BATCH;
+		memmove(cc->kcc_objs, cc->kcc_objs + KMEM_CPU_BATCH,
+			cc->kcc_count * sizeof(cc->kcc_objs[0]));
+	}
+	cc->kcc_objs[cc->kcc_count++] = obj;
+}
+
+//
+// Allocate 'size' bytes, not zeroed.
+//
+// Returns NULL if out of memory or size is more than KMEM_MAXSIZE.
+//
+void *
+kmalloc(size_t size)
+{
+	int shift = KMALLOC_MINSHIFT;
+
+	if (size > KMEM_MAXSIZE)
+		return NULL;
+	while ((1U << shift) < size)
+		shift++;
+	return kmem_cache_alloc(kmalloc_caches[shift]);
+}
+
+//
+// Free 'obj', from kmalloc() or any cache.  Does nothing if obj is NULL.
+//
+void
+kfree(void *obj)
+{
+	struct Slab *s = ROUNDDOWN(obj, PGSIZE);
+
+	if (!obj)
+		return;
+	if (s->sl_cache < kmem_caches ||
+	    s->sl_cache >= kmem_caches + KMEM_NCACHES)
+		panic("kfree: %p was not allocated here", obj);
+	kmem_cache_free(s->sl_cache, obj);
+}
+
+// Print the usage of every cache.  Objects in the CPUs' caches count as
+// free.
+void
+kmem_report(void)
+{
+	struct KmemCache *c;
+	struct Slab *s;
+	unsigned free, allocs, hits, i;
+
+	cprintf("cache            size  objs/slab  slabs   active     free"
+		"     allocs  hit%%  grows  shrinks\n");
+	for (c = kmem_caches; c < kmem_caches + KMEM_NCACHES; c++) {
+		if (!c->kc_size)
+			continue;
+		free = allocs = hits = 0;
+		spin_lock(&c->kc_lock);
+		for (s = c->kc_partial; s; s = s->sl_next)
+			free += s->sl_nfree;
+		if (c->kc_empty)
+			free += c->kc_perslab;
+		for (i = 0; i < ncpu; i++) {
+			free += c->kc_cpu[i].kcc_count;
+			allocs += c->kc_cpu[i].kcc_allocs;
+			hits += c->kc_cpu[i].kcc_hits;
+		}
+		cprintf("%-15s %5u  %9u  %5u  %7u  %7u %10u  %4u  %5u  %7u\n",
+			c->kc_name, c->kc_size, c->kc_perslab, c->kc_nslabs,
+			c->kc_nslabs * c->kc_perslab - free, free, allocs,
+			allocs ? hits * 100 / allocs : 0, c->kc_grows,
+			c->kc_shrinks);
+		spin_unlock(&c->kc_lock);
+	}
+}
+
+// Set up the kmalloc() caches.
+void
+kmem_init(void)
+{
+	static char names[KMALLOC_MAXSHIFT + 1][KMEM_NAMELEN];
+	int shift;
+
+	spin_initlock(&kmem_lock);
+	for (shift = KMALLOC_MINSHIFT; shift <= KMALLOC_MAXSHIFT; shift++) {
+		snprintf(names[shift], KMEM_NAMELEN, "kmalloc-%d", 1 << shift);
+		if (!(kmalloc_caches[shift] =
+		      kmem_cache_create(names[shift], 1 << shift, NULL)))
+			panic("kmem_init: cannot create %s", names[shift]);
+	}
+	check_kmem();
+}
+
+// --------------------------------------------------------------
+// Checking functions.
+// --------------------------------------------------------------
+
+#define CHECK_NOBJS	200
+
+static void
+check_ctor(void *obj)
+{
+	*(uint32_t *) obj = 0xC0FFEE;
+}
+
+static void
+check_kmem(void)
+{
+	static void *objs[CHECK_NOBJS];
+	struct KmemCache *c;
+	unsigned nslabs;
+	int i, j;
+
+	// Objects are constructed, distinct, and come back as freed.
+	assert((c = kmem_cache_create("kmem_check", 100, check_ctor)));
+	assert(c->kc_size == 104 && c->kc_perslab > 1);
+	for (i = 0; i < CHECK_NOBJS; i++) {
+		assert((objs[i] = kmem_cache_alloc(c)));
+		assert((uintptr_t) objs[i] % KMEM_ALIGN == 0);
+		assert(*(uint32_t *) objs[i] == 0xC0FFEE);
+		for (j = 0; j < i; j++)
+			assert(objs[i] != objs[j]);
+		memset((char *) objs[i] + 4, i, c->kc_size - 4);
+	}
+	nslabs = c->kc_nslabs;
+	assert(nslabs >= CHECK_NOBJS / c->kc_perslab);
+	for (i = 0; i < CHECK_NOBJS; i++)
+		kmem_cache_free(c, objs[i]);
+	// Only one empty slab is kept, and this CPU a few objects.
+	assert(c->kc_nslabs < nslabs && c->kc_nslabs <= 1 + KMEM_CPU_SIZE);
+	assert(c->kc_shrinks == c->kc_grows - c->kc_nslabs);
+
+	// A destroyed cache gives back its slot and its last slab.
+	kmem_cache_destroy(c);
+	assert(!c->kc_size);
+	assert(kmem_cache_create("kmem_check", 8, NULL) == c);
+	kmem_cache_destroy(c);
+
+	// kmalloc() picks a big enough size.
+	assert(!kmalloc(KMEM_MAXSIZE + 1));
+	for (i = 1; i <= KMEM_MAXSIZE; i = i * 3 + 1) {
+		assert((objs[0] = kmalloc(i)));
+		assert(((struct Slab *) ROUNDDOWN(objs[0], PGSIZE))->sl_cache->kc_size >= i);
+		memset(objs[0], 0, i);
+		kfree(objs[0]);
+	}
+	kfree(NULL);
+
+	cprintf("check_kmem() succeeded!\n");
+}
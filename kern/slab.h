@@ -0,0 +1,25 @@
+#ifndef JOS_KERN_SLAB_H
+#define JOS_KERN_SLAB_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// The largest object a cache can hold, and kmalloc() hands out.  Bigger
+// allocations come from page_alloc_order().
+#define KMEM_MAXSIZE	1024
+
+struct KmemCache;
+
+void	kmem_init(void);
+struct KmemCache *kmem_cache_create(const char *name, size_t size,
+				    void (*ctor)(void *obj));
+void	kmem_cache_destroy(struct KmemCache *c);
+void *	kmem_cache_alloc(struct KmemCache *c);
+void	kmem_cache_free(struct KmemCache *c, void *obj);
+void *	kmalloc(size_t size);
+void	kfree(void *obj);
+void	kmem_report(void);
+
+#endif /* !JOS_KERN_SLAB_H */
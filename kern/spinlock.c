@@ -11,11 +11,38 @@
 
 // The big kernel lock
 struct spinlock kernel_lock = {
-#ifdef DEBUG_SPINLOCK
 	.name = "kernel_lock"
-#endif
 };
 
+// Every lock that was initialized or taken at least once, for the
+// 'lockstat' monitor command.  The list has its own bare xchg lock
+// because a spinlock cannot protect the list of spinlocks.
+static struct spinlock *lock_list;
+static volatile uint32_t lock_list_busy;
+
+static void
+spin_register(struct spinlock *lk)
+{
+	while (xchg(&lock_list_busy, 1) != 0)
+		asm volatile ("pause");
+	if (!lk->registered) {
+		lk->registered = 1;
+		lk->lk_link = lock_list;
+		lock_list = lk;
+	}
+	xchg(&lock_list_busy, 0);
+}
+
+// Call fn on every registered lock.
+void
+spin_foreach(void (*fn)(struct spinlock *lk, void *arg), void *arg)
+{
+	struct spinlock *lk;
+
+	for (lk = lock_list; lk; lk = lk->lk_link)
+		fn(lk, arg);
+}
+
 #ifdef DEBUG_SPINLOCK
 // Record the current call stack in pcs[] by following the %ebp chain.
 static void
@@ -34,23 +61,23 @@ get_caller_pcs(uint32_t pcs[])
 	for (; i < 10; i++)
 		pcs[i] = 0;
 }
+#endif
 
 // Check whether this CPU is holding the lock.
-static int
-holding(struct spinlock *lock)
+int
+spin_holding(struct spinlock *lock)
 {
-	return lock->locked && lock->cpu == thiscpu;
+	return lock->owner != lock->next && lock->cpu == thiscpu;
 }
-#endif
 
 void
 __spin_initlock(struct spinlock *lk, char *name)
 {
-	lk->locked = 0;
-#ifdef DEBUG_SPINLOCK
-	lk->name = name;
+	lk->next = lk->owner = 0;
 	lk->cpu = 0;
-#endif
+	lk->name = name;
+	memset(&lk->stats, 0, sizeof(lk->stats));
+	spin_register(lk);
 }
 
 // Acquire the lock.
@@ -60,20 +87,36 @@ __spin_initlock(struct spinlock *lk, char *name)
 void
 spin_lock(struct spinlock *lk)
 {
+	uint32_t ticket;
+	uint64_t start, now;
+
 #ifdef DEBUG_SPINLOCK
-	if (holding(lk))
+	if (spin_holding(lk))
 		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
 #endif
 
-	// The xchg is atomic.
+	// Take a ticket and wait until it is served.  The xadd is atomic.
 	// It also serializes, so that reads after acquire are not
 	// reordered before it. 
-	while (xchg(&lk->locked, 1) != 0)
-		asm volatile ("pause");
+	start = read_tsc();
+	ticket = xadd(&lk->next, 1);
+	if (lk->owner != ticket) {
+		while (lk->owner != ticket)
+			asm volatile ("pause");
+		now = read_tsc();
+		lk->stats.contended++;
+		lk->stats.spin_cycles += now - start;
+	} else
+		now = start;
+
+	lk->cpu = thiscpu;
+	lk->acquired_at = now;
+	lk->stats.acquisitions++;
+	if (!lk->registered)
+		spin_register(lk);
 
 	// Record info about lock acquisition for debugging.
 #ifdef DEBUG_SPINLOCK
-	lk->cpu = thiscpu;
 	get_caller_pcs(lk->pcs);
 #endif
 }
@@ -82,8 +125,10 @@ spin_lock(struct spinlock *lk)
 void
 spin_unlock(struct spinlock *lk)
 {
+	uint64_t hold;
+
 #ifdef DEBUG_SPINLOCK
-	if (!holding(lk)) {
+	if (!spin_holding(lk)) {
 		int i;
 		uint32_t pcs[10];
 		// Nab the acquiring EIP chain before it gets released
@@ -104,17 +149,21 @@ spin_unlock(struct spinlock *lk)
 	}
 
 	lk->pcs[0] = 0;
-	lk->cpu = 0;
 #endif
+	hold = read_tsc() - lk->acquired_at;
+	if (hold > lk->stats.max_hold)
+		lk->stats.max_hold = hold;
+	lk->cpu = 0;
 
+	// Serve the next ticket.  Only the holder writes 'owner'.
 	// The xchg serializes, so that reads before release are 
 	// not reordered after it.  The 1996 PentiumPro manual (Volume 3,
 	// 7.2) says reads can be carried out speculatively and in
 	// any order, which implies we need to serialize here.
 	// But the 2007 Intel 64 Architecture Memory Ordering White
 	// Paper says that Intel 64 and IA-32 will not move a load
-	// after a store. So lock->locked = 0 would work here.
+	// after a store. So a plain increment would work here.
 	// The xchg being asm volatile ensures gcc emits it after
 	// the above assignments (and after the critical section).
-	xchg(&lk->locked, 0);
+	xchg(&lk->owner, lk->owner + 1);
 }
@@ -6,14 +6,33 @@
 // Comment this to disable spinlock debugging
 #define DEBUG_SPINLOCK
 
+// Contention statistics, kept for every lock whether or not
+// DEBUG_SPINLOCK is defined.  Times are in TSC cycles.  They are only
+// updated by the lock holder, so they need no atomic operations.
+struct spinlock_stats {
+	uint64_t acquisitions;	// Times the lock was taken
+	uint64_t contended;	// ... of which we had to wait for it
+	uint64_t spin_cycles;	// Total time spent waiting
+	uint64_t max_hold;	// Longest time the lock was held
+};
+
 // Mutual exclusion lock.
+// A ticket lock: CPUs get the lock in the order they asked for it, and
+// waiters only read 'owner', so the cache line is not written while
+// they spin.
 struct spinlock {
-	unsigned locked;       // Is the lock held?
+	volatile uint32_t next;	// Next ticket to hand out
+	volatile uint32_t owner;	// Ticket of the current holder
+	struct CpuInfo *cpu;   // The CPU holding the lock.
+	char *name;            // Name of lock.
+
+	struct spinlock_stats stats;
+	uint64_t acquired_at;	// TSC when the holder got the lock
+	bool registered;	// On the list that spin_foreach walks?
+	struct spinlock *lk_link;	// Next lock on that list
 
 #ifdef DEBUG_SPINLOCK
 	// For debugging:
-	char *name;            // Name of lock.
-	struct CpuInfo *cpu;   // The CPU holding the lock.
 	uintptr_t pcs[10];     // The call stack (an array of program counters)
 	                       // that locked the lock.
 #endif
@@ -22,6 +41,8 @@ struct spinlock {
 void __spin_initlock(struct spinlock *lk, char *name);
 void spin_lock(struct spinlock *lk);
 void spin_unlock(struct spinlock *lk);
+int spin_holding(struct spinlock *lk);
+void spin_foreach(void (*fn)(struct spinlock *lk, void *arg), void *arg);
 
 #define spin_initlock(lock)   __spin_initlock(lock, #lock)
 
@@ -45,4 +66,13 @@ unlock_kernel(void)
 	asm volatile("pause");
 }
 
+// Some system calls run without the big kernel lock (see
+// syscall_unlocked() in kern/syscall.c), so code shared with them has to
+// ask before taking or releasing it.
+static inline int
+kernel_lock_held(void)
+{
+	return spin_holding(&kernel_lock);
+}
+
 #endif
@@ -14,7 +14,54 @@
 #include <kern/time.h>
 #include <kern/e1000.h>
 #include <kern/sb16.h>
+#include <kern/spinlock.h>
+#include <kern/perf.h>
+#include <kern/trace.h>
 #include <inc/sb16.h>
+#include <inc/perf.h>
+#include <inc/batch.h>
+
+// After locking an environment that envid2env() looked up without any
+// lock, make sure it was not freed (and its slot reused) in between.
+// 'envid' is the env_id the lookup returned.
+static int
+env_check_locked(struct Env *e, envid_t envid)
+{
+	if (e->env_status == ENV_FREE || e->env_id != envid)
+		return -E_BAD_ENV;
+	return 0;
+}
+
+// Can a system call running without the big kernel lock change the
+// page mappings of 'e'?  Not if e is running on another CPU: that CPU
+// may be reading or writing e's memory under the big kernel lock (in
+// sys_cputs, or when it pushes a page fault frame).  env_run() takes the
+// env lock to make an env ENV_RUNNING, so the answer stays valid while
+// we hold env_lock(e).  Threads share their address space with envs
+// that may be running, so they always need the big kernel lock.
+static bool
+env_mappable(struct Env *e)
+{
+	if (e->env_pgdir && pgdir_shared(e->env_pgdir))
+		return false;
+	return e == curenv ||
+		(e->env_status != ENV_RUNNING && e->env_status != ENV_DYING);
+}
+
+// Lock the address spaces of 'a' and 'b' (which may be the same env)
+// for a page system call, taking the big kernel lock first if one of
+// them belongs to an env running on another CPU.
+static void
+env_lock_mappings(struct Env *a, struct Env *b)
+{
+	env_lock_pair(a, b);
+	if (kernel_lock_held() || (env_mappable(a) && env_mappable(b)))
+		return;
+
+	env_unlock_pair(a, b);
+	lock_kernel();
+	env_lock_pair(a, b);
+}
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -75,10 +122,13 @@ sys_env_destroy(envid_t envid)
 static void
 sys_yield(void)
 {
+	thiscpu->cpu_yielded = true;
 	sched_yield();
 }
 
-// Allocate a new environment.
+// Allocate a new environment.  It gets copies of our demand-zero
+// regions (see sys_region_reserve()), so that a fork made with it keeps
+// the BSS; spawn() drops them again with sys_region_release().
 // Returns envid of new environment, or < 0 on error.  Errors are:
 //	-E_NO_FREE_ENV if no free environment is available.
 //	-E_NO_MEM on memory exhaustion.
@@ -101,18 +151,20 @@ sys_exofork(void)
 	// copy the register state (whole tf)
 	memcpy(&e->env_tf, &curenv->env_tf, sizeof (struct Trapframe));
 	
-	// set status to not-runnalbe
-	e->env_status = ENV_NOT_RUNNABLE;
+	// env_alloc leaves the env not-runnable, which is what we want
 	
 	// set return value in child to 0
 	e->env_tf.tf_regs.reg_eax = 0;
     
-    cprintf("exofork from %d -> %x\n", curenv->env_type, e->env_id);
-    
     // TODO Ask Igor.
     // This fixes ns_output/ns_input not counting as NS environments.
     e->env_type = curenv->env_type;
+    
+    // The child inherits the parent's scheduling priority and CPU mask.
+    e->env_priority = e->env_level = curenv->env_priority;
+    e->env_affinity = curenv->env_affinity;
 
+	env_region_copy(e, curenv);
 	return e->env_id;
 }
 
@@ -142,7 +194,94 @@ sys_env_set_status(envid_t envid, int status)
 	if ((error = envid2env(envid, &e, 1)) < 0)
 		return error;
 	
-	e->env_status = status;
+	env_lock(e);
+	if (status == ENV_RUNNABLE)
+		sched_wakeup(e);
+	else
+		sched_block(e);
+	env_unlock(e);
+	return 0;
+}
+
+// Set the scheduling priority of envid to 'priority', between
+// ENV_PRIO_MAX (runs first) and ENV_PRIO_MIN.  See inc/env.h.
+// An env may lower its own priority, but only raise a child's, and not
+// above its own: otherwise anyone could run ahead of the servers.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if priority is out of range, or would raise our own
+//		priority or a child's above ours.
+static int
+sys_env_set_priority(envid_t envid, int priority)
+{
+	struct Env *e;
+	int error;
+	
+	if (priority < ENV_PRIO_MAX || priority > ENV_PRIO_MIN)
+		return -E_INVAL;
+	
+	if ((error = envid2env(envid, &e, 1)) < 0)
+		return error;
+	
+	if (priority < e->env_priority &&
+	    (e == curenv || priority < curenv->env_priority))
+		return -E_INVAL;
+	
+	env_lock(e);
+	sched_set_priority(e, priority);
+	env_unlock(e);
+	return 0;
+}
+
+// Allow envid to run only on the CPUs in 'cpumask' (bit i stands for
+// CPU i).  The env otherwise prefers the CPU it last ran on.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if cpumask names no CPU of this machine.
+static int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+	struct Env *e;
+	int error;
+	
+	if (ncpu < 32)
+		cpumask &= (1U << ncpu) - 1;
+	if (cpumask == 0)
+		return -E_INVAL;
+	
+	if ((error = envid2env(envid, &e, 1)) < 0)
+		return error;
+	
+	env_lock(e);
+	sched_set_affinity(e, cpumask);
+	env_unlock(e);
+	return 0;
+}
+
+// Let idle CPUs merge the private pages of envid with identical pages
+// of its own and of other envs that allow it, if 'on', or stop them.
+// Merged pages are copy-on-write.  Children created afterwards inherit
+// the setting.  See kern/ksm.c.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+static int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+	struct Env *e;
+	int error;
+
+	if ((error = envid2env(envid, &e, 1)) < 0)
+		return error;
+
+	env_lock(e);
+	e->env_ksm = on;
+	env_unlock(e);
 	return 0;
 }
 
@@ -211,6 +350,12 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 // perm -- PTE_U | PTE_P must be set, PTE_AVAIL | PTE_W may or may not be set,
 //         but no other bits may be set.  See PTE_SYSCALL in inc/mmu.h.
 //
+// With PTE_PS in perm, the page is a 4MB page of contiguous physical
+// memory instead, and va must be 4MB-aligned.  It replaces everything
+// mapped in [va, va+PTSIZE).  A 4MB page can be mapped elsewhere, by
+// its first address only, and is copied at once by fork unless it is
+// read-only or PTE_SHARE.  It is never PTE_COW.
+//
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
 //		or the caller doesn't have permission to change envid.
@@ -239,23 +384,136 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 	if ((perm & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
 		return -E_INVAL;
 	
-	if ((perm & (~(PTE_P | PTE_U | PTE_W | PTE_AVAIL))) > 0)
+	if ((perm & (~(PTE_P | PTE_U | PTE_W | PTE_AVAIL | PTE_PS))) > 0)
+		return -E_INVAL;
+
+	if ((perm & PTE_PS) && (!page_pse || (uintptr_t) va % PTSIZE != 0))
 		return -E_INVAL;
 	
 	if ((error = envid2env(envid, &e, 1)) < 0)
 		return error;
+	envid = e->env_id;
 	
-	if ((pp = page_alloc(ALLOC_ZERO)) == NULL)
+	// Zero the page before taking any lock.
+	if (perm & PTE_PS)
+		pp = page_alloc_large(ALLOC_ZERO);
+	else
+		pp = page_alloc(ALLOC_ZERO);
+	if (pp == NULL)
 		return -E_NO_MEM;
 	
-	if ((error = page_insert(e->env_pgdir, pp, va, perm)) < 0) {
-		page_free(pp);
+	env_lock_mappings(e, e);
+	if ((error = env_check_locked(e, envid)) == 0)
+		error = page_insert(e->env_pgdir, pp, va, perm);
+	env_unlock(e);
+	
+	if (error < 0) {
+		if (pp->pp_large) {
+			pp->pp_large = 0;
+			page_free_order(pp, PAGE_MAXORDER);
+		} else
+			page_free(pp);
 		return error;
 	}
 	
 	return 0;
 }
 
+// Reserve [va, va+len) in the address space of 'envid' as demand-zero
+// memory with permission 'perm': the kernel gives each page a zeroed
+// page the first time it is touched, without a page fault upcall.  A
+// read maps a shared page of zeroes copy-on-write, so memory that is
+// never written costs nothing.  Pages already mapped in the range stay.
+// Each address space has up to NENVREGION regions, which its threads
+// share; sys_exofork and fork copy them.
+//
+// perm -- as in sys_page_alloc, without PTE_PS.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va is not page-aligned, len is 0, or the range is not
+//		below UTOP or overlaps another region.
+//	-E_INVAL if perm is inappropriate.
+//	-E_NO_MEM if the env has no region left.
+static int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+	struct Env *e;
+	int error;
+
+	if ((uintptr_t) va % PGSIZE != 0 || len == 0 ||
+	    len > UTOP || (uintptr_t) va > UTOP - len)
+		return -E_INVAL;
+
+	if ((perm & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+		return -E_INVAL;
+
+	if ((perm & (~(PTE_P | PTE_U | PTE_W | PTE_AVAIL))) > 0)
+		return -E_INVAL;
+
+	if ((error = envid2env(envid, &e, 1)) < 0)
+		return error;
+
+	return env_region_reserve(e, (uintptr_t) va, len, perm);
+}
+
+// Forget the demand-zero regions inside [va, va+len) in the address
+// space of 'envid'.  Pages already mapped in them stay.  spawn() uses
+// this on the regions the child got from sys_exofork.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va is not page-aligned, the range is not below UTOP,
+//		or a region is only partly inside it.
+static int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+	struct Env *e;
+	int error;
+
+	if ((uintptr_t) va % PGSIZE != 0 ||
+	    len > UTOP || (uintptr_t) va > UTOP - len)
+		return -E_INVAL;
+
+	if ((error = envid2env(envid, &e, 1)) < 0)
+		return error;
+
+	return env_region_release(e, (uintptr_t) va, len);
+}
+
+// The part of sys_page_map that runs with both environments locked.
+static int
+sys_page_map_locked(struct Env *srcenv, envid_t srcenvid, void *srcva,
+		    struct Env *dstenv, envid_t dstenvid, void *dstva, int perm)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+	int error;
+
+	if ((error = env_check_locked(srcenv, srcenvid)) < 0 ||
+	    (error = env_check_locked(dstenv, dstenvid)) < 0)
+		return error;
+
+	//	-E_INVAL is srcva is not mapped in srcenvid's address space.
+	//	lookup the 'srcva' physical page.
+	if ((pp = page_lookup(srcenv->env_pgdir, srcva, &pte)) == NULL)
+		return -E_INVAL;
+	if (pp->pp_large && ((uintptr_t) srcva % PTSIZE != 0 ||
+			     (perm & PTE_COW)))
+		return -E_INVAL;
+
+	//	-E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
+	//		address space.	
+	if ((perm & PTE_W) && !(*pte & PTE_W))
+		return -E_INVAL;
+	
+	//	-E_NO_MEM if there's no memory to allocate any necessary page tables.
+	//	map the physical page at 'dstva'
+	return page_insert(dstenv->env_pgdir, pp, dstva, perm);
+}
+
 // Map the page of memory at 'srcva' in srcenvid's address space
 // at 'dstva' in dstenvid's address space with permission 'perm'.
 // Perm has the same restrictions as in sys_page_alloc, except
@@ -284,8 +542,6 @@ sys_page_map(envid_t srcenvid, void *srcva,
 	//   check the current permissions on the page.
 	// LAB 4: Your code here.
 	struct Env *srcenv, *dstenv;
-	struct PageInfo *pp;
-	pte_t *pte;
 	int error;
 	
 	//	-E_BAD_ENV if srcenvid and/or dstenvid doesn't currently exist,
@@ -304,29 +560,20 @@ sys_page_map(envid_t srcenvid, void *srcva,
 	if ((uintptr_t) dstva >= UTOP || (uintptr_t) dstva % PGSIZE != 0)
 		return -E_INVAL;
 
-	//	-E_INVAL is srcva is not mapped in srcenvid's address space.
-	//	lookup the 'srcva' physical page.
-	if ((pp = page_lookup(srcenv->env_pgdir, srcva, &pte)) == NULL)
-		return -E_INVAL;
-
 	//	-E_INVAL if perm is inappropriate (see sys_page_alloc).
 	if ((perm & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
 		return -E_INVAL;
 
-	//	-E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
-	//		address space.	
 	if ((perm & (~(PTE_P | PTE_U | PTE_W | PTE_AVAIL))) > 0)
 		return -E_INVAL;
-	
-	if ((perm & PTE_W) && !(*pte & PTE_W))
-		return -E_INVAL;
-	
-	//	-E_NO_MEM if there's no memory to allocate any necessary page tables.
-	//	map the physical page at 'dstva'
-	if ((error = page_insert(dstenv->env_pgdir, pp, dstva, perm)) < 0)
-		return error;
-	
-	return 0;
+
+	srcenvid = srcenv->env_id;
+	dstenvid = dstenv->env_id;
+	env_lock_mappings(srcenv, dstenv);
+	error = sys_page_map_locked(srcenv, srcenvid, srcva,
+				    dstenv, dstenvid, dstva, perm);
+	env_unlock_pair(srcenv, dstenv);
+	return error;
 }
 
 // Unmap the page of memory at 'va' in the address space of 'envid'.
@@ -351,7 +598,246 @@ sys_page_unmap(envid_t envid, void *va)
 	if ((uintptr_t) va >= UTOP || (uintptr_t) va % PGSIZE != 0)
 		return -E_INVAL;
 
-	page_remove(e->env_pgdir, va);
+	envid = e->env_id;
+	env_lock_mappings(e, e);
+	if ((error = env_check_locked(e, envid)) == 0)
+		page_remove(e->env_pgdir, va);
+	env_unlock(e);
+	
+	return error;
+}
+
+// Run one operation of sys_batch().
+static int
+sys_batch_op(struct BatchOp *op)
+{
+	uint32_t i, n = MAX(op->bo_npages, 1);
+	int r = 0;
+
+	switch (op->bo_op) {
+	case BATCH_PAGE_ALLOC:
+		for (i = 0; i < n && r == 0; i++)
+			r = sys_page_alloc(op->bo_dstenv,
+					   op->bo_dstva + i * PGSIZE, op->bo_perm);
+		return r;
+	case BATCH_PAGE_MAP:
+		for (i = 0; i < n && r == 0; i++)
+			r = sys_page_map(op->bo_srcenv, op->bo_srcva + i * PGSIZE,
+					 op->bo_dstenv, op->bo_dstva + i * PGSIZE,
+					 op->bo_perm);
+		return r;
+	case BATCH_PAGE_UNMAP:
+		for (i = 0; i < n && r == 0; i++)
+			r = sys_page_unmap(op->bo_dstenv,
+					   op->bo_dstva + i * PGSIZE);
+		return r;
+	case BATCH_ENV_SET_STATUS:
+		// The page operations only need the env locks, but this
+		// needs the big kernel lock.
+		if (!kernel_lock_held())
+			lock_kernel();
+		return sys_env_set_status(op->bo_dstenv, op->bo_perm);
+	default:
+		return -E_INVAL;
+	}
+}
+
+// Run the 'n' operations in 'ops' (see inc/batch.h) in order, stopping
+// at the first that fails.  A page range stops at its first failing
+// page.
+//
+// Returns 0 on success, or BATCH_FAILURE(i, error) if operation 'i'
+// failed with 'error', -E_FAULT meaning 'ops[i]' is not user memory.
+static int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+	struct BatchOp op;
+	size_t i;
+	int r;
+
+	for (i = 0; i < n; i++) {
+		// An operation may have unmapped the array.
+		if (user_mem_check(curenv, &ops[i], sizeof(ops[i]), PTE_U) < 0)
+			return BATCH_FAILURE(i, -E_FAULT);
+		op = ops[i];
+		if ((r = sys_batch_op(&op)) < 0)
+			return BATCH_FAILURE(i, r);
+	}
+	return 0;
+}
+
+// Fork the current environment with copy-on-write.  The child gets the
+// parent's registers (returning 0), page fault upcall, demand-zero
+// regions and, copy-on-write, every page below USTACKTOP (see
+// pgdir_copy_cow()).  It gets a fresh exception stack and is made
+// runnable.  The kernel resolves the copy-on-write faults itself (see
+// page_cow()); the page fault upcall only sees those it had no memory
+// for.
+//
+// Returns the envid of the child, or < 0 on error:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork(void)
+{
+	struct Env *e;
+	envid_t envid;
+	int r;
+
+	if ((envid = sys_exofork()) < 0)
+		return envid;
+	e = &envs[ENVX(envid)];
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+				PTE_P | PTE_U | PTE_W)) < 0)
+		goto fail;
+
+	env_lock_mappings(curenv, e);
+	r = pgdir_copy_cow(e->env_pgdir, curenv->env_pgdir, USTACKTOP);
+	env_unlock_pair(curenv, e);
+	// Our writable pages are read-only now.
+	tlbflush();
+	if (pgdir_shared(curenv->env_pgdir))
+		tlb_shootdown(curenv->env_pgdir);
+	if (r < 0)
+		goto fail;
+
+	env_lock(e);
+	sched_wakeup(e);
+	env_unlock(e);
+	return envid;
+
+fail:
+	env_destroy(e);
+	return r;
+}
+
+// Create a thread of the current environment: a child env that shares
+// our address space.  It starts at 'eip' as if called as eip(a1, a2),
+// on a stack in its slot of the UTHREADS region (see inc/memlayout.h),
+// and takes its page faults on the exception stack of that slot.  Both
+// stacks are freshly allocated.  The thread shares our demand-zero
+// regions with the address space.  It is runnable at once.
+//
+// The page directory is reference counted: env_free() frees the address
+// space with the last of the envs that share it, and the thread's stacks
+// with the thread, also when we fail half way.
+//
+// Returns the envid of the thread, or < 0 on error:
+//	-E_INVAL if eip is not below UTOP.
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_thread_create(uintptr_t eip, uint32_t a1, uint32_t a2)
+{
+	struct PageInfo *pp;
+	struct Env *e;
+	envid_t envid;
+	uintptr_t va;
+	uint32_t *sp;
+	int r;
+
+	if (eip >= UTOP)
+		return -E_INVAL;
+	if ((envid = sys_exofork()) < 0)
+		return envid;
+	e = &envs[ENVX(envid)];
+
+	// Trade the fresh page directory for ours.
+	pgdir_decref(e->env_pgdir);
+	e->env_pgdir = curenv->env_pgdir;
+	page_incref(pa2page(PADDR(e->env_pgdir)));
+
+	// The stack, with the arguments and a null return address on top,
+	// and the exception stack.
+	for (va = UTHREADSTACKTOP(ENVX(envid)) - THREADSTACK;
+	     va < UTHREADXSTACKTOP(ENVX(envid)); va += PGSIZE) {
+		if (va == UTHREADSTACKTOP(ENVX(envid)))
+			continue;
+		if (!(pp = page_alloc(ALLOC_ZERO))) {
+			r = -E_NO_MEM;
+			goto fail;
+		}
+		if ((r = page_insert(e->env_pgdir, pp, (void *) va,
+				     PTE_P | PTE_U | PTE_W)) < 0) {
+			page_free(pp);
+			goto fail;
+		}
+		if (va == UTHREADSTACKTOP(ENVX(envid)) - PGSIZE) {
+			sp = (uint32_t *) ((char *) page2kva(pp) + PGSIZE) - 3;
+			sp[1] = a1;
+			sp[2] = a2;
+		}
+	}
+
+	e->env_tf.tf_eip = eip;
+	e->env_tf.tf_esp = UTHREADSTACKTOP(ENVX(envid)) - 3 * sizeof(uint32_t);
+	e->env_xstacktop = UTHREADXSTACKTOP(ENVX(envid));
+	e->env_pgfault_upcall = curenv->env_pgfault_upcall;
+
+	env_lock(e);
+	sched_wakeup(e);
+	env_unlock(e);
+	return envid;
+
+fail:
+	env_destroy(e);
+	return r;
+}
+
+// The part of sys_ipc_try_send that runs with the sender and the target
+// locked.
+static int
+sys_ipc_try_send_locked(struct Env *e, envid_t envid, uint32_t value,
+			void *srcva, unsigned perm)
+{
+	struct PageInfo *pp;
+	pte_t *pte;
+	int error;
+	
+	if ((error = env_check_locked(e, envid)) < 0)
+		return error;
+	
+	if (! e->env_ipc_recving)
+		return -E_IPC_NOT_RECV;
+	
+	e->env_ipc_perm = 0;
+	
+	if ((uintptr_t) srcva < UTOP && (uintptr_t) e->env_ipc_dstva < UTOP) {
+		if ((uintptr_t) srcva % PGSIZE > 0)
+			return -E_INVAL;
+		
+		if ((perm & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+			return -E_INVAL;
+        
+		if ((perm & (~(PTE_P | PTE_U | PTE_W | PTE_AVAIL))) > 0)
+			return -E_INVAL;
+        
+		if ((pp = page_lookup(curenv->env_pgdir, srcva, &pte)) == NULL)
+			return -E_INVAL;
+		if (pp->pp_large && (uintptr_t) srcva % PTSIZE != 0)
+			return -E_INVAL;
+        
+		if ((perm & PTE_W) && ! (*pte & PTE_W))
+			return -E_INVAL;
+			
+		if ((error = page_insert(e->env_pgdir, pp, e->env_ipc_dstva, perm)) < 0)
+			return error;
+		
+		e->env_ipc_perm = perm;
+	}
+	
+	e->env_ipc_from = curenv->env_id;
+	e->env_ipc_value = value;
+	e->env_ipc_recving = false;
+	env_cancel_timeout(e);
+	
+	// set return value to 0
+	e->env_tf.tf_regs.reg_eax = 0;
+	
+	// set environment to runnable again
+	sched_wakeup(e);
 	
 	return 0;
 }
@@ -399,51 +885,20 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 {
 	// LAB 4: Your code here.
 	struct Env *e;
-	struct PageInfo *pp;
-	pte_t *pte;
 	int error;
 	
 	if ((error = envid2env(envid, &e, 0)) < 0)
 		return error;
+	envid = e->env_id;
 	
-	if (! e->env_ipc_recving)
-		return -E_IPC_NOT_RECV;
-	
-	e->env_ipc_perm = 0;
-	
-	if ((uintptr_t) srcva < UTOP && (uintptr_t) e->env_ipc_dstva < UTOP) {
-		if ((uintptr_t) srcva % PGSIZE > 0)
-			return -E_INVAL;
-		
-		if ((perm & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
-			return -E_INVAL;
-        
-		if ((perm & (~(PTE_P | PTE_U | PTE_W | PTE_AVAIL))) > 0)
-			return -E_INVAL;
-        
-		if ((pp = page_lookup(curenv->env_pgdir, srcva, &pte)) == NULL)
-			return -E_INVAL;
-        
-		if ((perm & PTE_W) && ! (*pte & PTE_W))
-			return -E_INVAL;
-			
-		if ((error = page_insert(e->env_pgdir, pp, e->env_ipc_dstva, perm) < 0) < 0)
-			return error;
-		
-		e->env_ipc_perm = perm;
-	}
-	
-	e->env_ipc_from = curenv->env_id;
-	e->env_ipc_value = value;
-	e->env_ipc_recving = false;
-	
-	// set environment to runnable again
-	e->env_status = ENV_RUNNABLE;
-	
-	// set return value to 0
-	e->env_tf.tf_regs.reg_eax = 0;
-	
-	return 0;
+	// An env waiting in sys_ipc_recv is blocked, not running, so its
+	// address space can be changed without the big kernel lock,
+	// unless it is a thread (see env_mappable()).
+	env_lock_mappings(curenv, e);
+	error = sys_ipc_try_send_locked(e, envid, value, srcva, perm);
+	env_unlock_pair(curenv, e);
+	trace_event(TRACE_IPC_SEND, envid, value, error);
+	return error;
 }
 
 // Block until a value is ready.  Record that you want to receive
@@ -453,20 +908,31 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 // If 'dstva' is < UTOP, then you are willing to receive a page of data.
 // 'dstva' is the virtual address at which the sent page should be mapped.
 //
+// If 'deadline' is not 0, give up at time_msec() 'deadline'.
+//
 // This function only returns on error, but the system call will eventually
 // return 0 on success.
 // Return < 0 on error.  Errors are:
 //	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_TIMEOUT if no message arrived before the deadline.
 static int
-sys_ipc_recv(void *dstva)
+sys_ipc_recv(void *dstva, unsigned deadline)
 {
 	// LAB 4: Your code here.
 	if ((uintptr_t) dstva < UTOP && (uintptr_t) dstva % PGSIZE > 0)
 		return -E_INVAL;
+	if (deadline && (int) (deadline - time_msec()) <= 0)
+		return -E_TIMEOUT;
+	trace_event(TRACE_IPC_RECV, (uintptr_t) dstva, deadline, 0);
 	
+	env_lock(curenv);
 	curenv->env_ipc_recving = true;
 	curenv->env_ipc_dstva = dstva;
-	curenv->env_status = ENV_NOT_RUNNABLE;
+	env_cancel_timeout(curenv);
+	if (deadline)
+		env_set_timeout(curenv, deadline);
+	sched_block(curenv);
+	env_unlock(curenv);
 	
 	sched_yield();
 	
@@ -474,6 +940,94 @@ sys_ipc_recv(void *dstva)
 	return 0;
 }
 
+// Block until time_msec() reaches 'deadline'.
+// Returns 0 (at once if the deadline has passed).
+static int
+sys_sleep_until(unsigned deadline)
+{
+	if ((int) (deadline - time_msec()) <= 0)
+		return 0;
+
+	env_lock(curenv);
+	curenv->env_tf.tf_regs.reg_eax = 0;
+	env_set_timeout(curenv, deadline);
+	sched_block(curenv);
+	env_unlock(curenv);
+
+	sched_yield();
+
+	// for compilers. this function won't actually return.
+	return 0;
+}
+
+// Print the CPU accounting table of the 'limit' busiest environments
+// (all of them if limit is 0) to the console, like the monitor's 'top'.
+static int
+sys_env_print_stats(int limit)
+{
+	env_print_stats(limit);
+	return 0;
+}
+
+// Control the sampling profiler like the monitor's 'perf':
+// PERF_START samples 'arg' times a second (0 for the scheduler's own
+// timer interrupts), PERF_STOP stops and PERF_REPORT prints the 'arg'
+// hottest functions to the console.
+//
+// Returns 0 on success, -E_INVAL for an unknown operation.
+static int
+sys_perf(int op, unsigned arg)
+{
+	switch (op) {
+	case PERF_START:
+		perf_start(arg);
+		return 0;
+	case PERF_STOP:
+		perf_stop();
+		return 0;
+	case PERF_REPORT:
+		perf_report(arg);
+		return 0;
+	default:
+		return -E_INVAL;
+	}
+}
+
+// Trace the record types in 'mask' (see inc/trace.h) from now on.
+// Returns the previous mask.
+static int
+sys_trace_ctl(uint32_t mask)
+{
+	return trace_set(mask);
+}
+
+// Copy the latest 'n' trace records of CPU 'cpu' to 'buf', oldest
+// first.  No more than TRACE_NRECORDS are kept, so 'n' is cut to that.
+// Returns the number of records copied.
+// Returns -E_INVAL if there is no such CPU.
+static int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+	n = MIN(MAX(n, 0), TRACE_NRECORDS);
+	if (n > 0)
+		user_mem_assert(curenv, buf, n * sizeof(*buf), PTE_U | PTE_W);
+	return trace_read(cpu, buf, n);
+}
+
+// Fill in how much physical memory is free and used, and the memory of
+// up to 'n' live environments in 'envs'.  Returns the number of live
+// environments, which may be more than 'n'.
+static int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+	n = MIN(MAX(n, 0), NENV);
+	user_mem_assert(curenv, info, sizeof(*info), PTE_U | PTE_W);
+	if (n > 0)
+		user_mem_assert(curenv, envs, n * sizeof(*envs), PTE_U | PTE_W);
+	page_meminfo(info);
+	return env_meminfo(envs, n);
+}
+
 // Return the current time.
 static int
 sys_time_msec(void)
@@ -482,6 +1036,17 @@ sys_time_msec(void)
 	return time_msec();
 }
 
+// Store the nanoseconds since boot at 'nsp'.
+// User environments can also compute this themselves from the page
+// at UTIME (see lib/time.c).
+static int
+sys_time_nsec(uint64_t *nsp)
+{
+	user_mem_assert(curenv, nsp, sizeof(*nsp), PTE_U | PTE_W);
+	*nsp = time_nsec();
+	return 0;
+}
+
 // Transmits a raw single packet from the e1000 device.
 //
 // return 0 on success, < 0 on error.
@@ -491,12 +1056,24 @@ static int
 sys_e1000_transmit(char *packet, size_t len) {
     int r;
     
-    user_mem_assert(curenv, packet, len, PTE_U);
-    
     if (len >= ETH_MAX_PACKET_SIZE)
         return -E_INVAL;
     
-    if ((r = e1000_transmit(packet, len)) < 0)
+    // Fill in demand-zero pages first: that takes our env lock.
+    user_mem_assert(curenv, packet, len, PTE_U);
+
+    // This runs without the big kernel lock, so hold our own env lock
+    // to keep the packet mapped while the driver copies it.
+    env_lock(curenv);
+    if ((r = user_mem_check(curenv, packet, len, PTE_U)) == 0)
+        r = e1000_transmit(packet, len);
+    env_unlock(curenv);
+    
+    // Destroys the environment (user_mem_check fails with -E_FAULT).
+    if (r == -E_FAULT)
+        user_mem_assert(curenv, packet, len, PTE_U);
+    
+    if (r < 0)
         return r;
     
     return 0;
@@ -512,16 +1089,17 @@ sys_e1000_receive(char *buffer, size_t len) {
     user_mem_assert(curenv, buffer, len, PTE_U );
     
     
-    // store arguments in the env structure
-    curenv->env_e1000_receiving = true;
-    curenv->env_e1000_packet = buffer;
-    curenv->env_e1000_size = len;
+    // store arguments in the env structure and wait in line for a packet
+    e1000_rx_wait(curenv, buffer, len);
     
     // apply a packet timer interrupt to combat the lost-wakeup problem
     e1000_gen_intr();
     
-    // sleep
-    curenv->env_status = ENV_NOT_RUNNABLE;
+    // sleep, with no timeout left over to wake us while still in line
+    env_lock(curenv);
+    env_cancel_timeout(curenv);
+    sched_block(curenv);
+    env_unlock(curenv);
     sched_yield();
     
     // for compilers (this function does not return)
@@ -570,16 +1148,46 @@ sys_sb16_play(int16_t *audio_pcm, size_t len_words) {
     if((r = sb16_play(curenv, audio_pcm, len_words)) < 0)
         return r;
     
-    curenv->env_status = ENV_NOT_RUNNABLE;
+    env_lock(curenv);
+    env_cancel_timeout(curenv);
+    sched_block(curenv);
+    env_unlock(curenv);
     sched_yield();
     
     // does not return
     return 0;
 }
 
+// System calls that trap() runs without the big kernel lock.  They only
+// touch the caller and the environments they name, under env_lock(), and
+// subsystems with locks of their own: the page allocator, the run queues
+// and the e1000 transmit ring.  Anything that may block, destroy an
+// environment or drive other hardware still runs under the big kernel
+// lock.
+bool
+syscall_unlocked(uint32_t syscallno)
+{
+	switch (syscallno) {
+	case SYS_getenvid:
+	case SYS_time_msec:
+		return true;
+	case SYS_page_alloc:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_ipc_try_send:
+	case SYS_batch:
+	case SYS_e1000_transmit:
+		// These use user memory, which the threads of curenv may
+		// be changing under the big kernel lock on other CPUs.
+		return !pgdir_shared(curenv->env_pgdir);
+	default:
+		return false;
+	}
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
-int32_t
-syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+static int32_t
+syscall_dispatch(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
 	// Call the function corresponding to the 'syscallno' parameter.
 	// Return any appropriate return value.
@@ -598,7 +1206,7 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	case SYS_env_destroy:
 		return sys_env_destroy((envid_t) a1);
 	case SYS_yield:
-		sched_yield();
+		sys_yield();
 		return 0;
 	case SYS_exofork:
 		return (int32_t) sys_exofork();
@@ -615,11 +1223,17 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 	case SYS_ipc_try_send:
 		return (int32_t) sys_ipc_try_send((envid_t) a1, a2, (void *) a3, (int) a4);
 	case SYS_ipc_recv:
-		return (int32_t) sys_ipc_recv((void *) a1);
+		return (int32_t) sys_ipc_recv((void *) a1, a2);
 	case SYS_env_set_trapframe:
 		return (int32_t) sys_env_set_trapframe((envid_t) a1, (struct Trapframe *) a2);
     case SYS_time_msec:
         return (int32_t) sys_time_msec();
+	case SYS_time_nsec:
+		return (int32_t) sys_time_nsec((uint64_t *) a1);
+	case SYS_sleep_until:
+		return (int32_t) sys_sleep_until(a1);
+	case SYS_env_print_stats:
+		return (int32_t) sys_env_print_stats((int) a1);
     case SYS_e1000_transmit:
         return (int32_t) sys_e1000_transmit((char *) a1, (size_t) a2);
     case SYS_e1000_receive:
@@ -630,8 +1244,51 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
         return (int32_t) sys_sb16_read_version((struct sb16_version_t *) a1);
     case SYS_sb16_play:
         return (int32_t) sys_sb16_play((int16_t *) a1, (size_t) a2);
+	case SYS_env_set_priority:
+		return (int32_t) sys_env_set_priority((envid_t) a1, (int) a2);
+	case SYS_env_set_affinity:
+		return (int32_t) sys_env_set_affinity((envid_t) a1, a2);
+	case SYS_perf:
+		return (int32_t) sys_perf((int) a1, a2);
+	case SYS_batch:
+		return (int32_t) sys_batch((struct BatchOp *) a1, a2);
+	case SYS_fork:
+		return (int32_t) sys_fork();
+	case SYS_thread_create:
+		return (int32_t) sys_thread_create(a1, a2, a3);
+	case SYS_region_reserve:
+		return (int32_t) sys_region_reserve((envid_t) a1, (void *) a2, a3, (int) a4);
+	case SYS_region_release:
+		return (int32_t) sys_region_release((envid_t) a1, (void *) a2, a3);
+	case SYS_trace_ctl:
+		return (int32_t) sys_trace_ctl(a1);
+	case SYS_trace_read:
+		return (int32_t) sys_trace_read((int) a1, (struct TraceRecord *) a2, (int) a3);
+	case SYS_meminfo:
+		return (int32_t) sys_meminfo((struct MemInfo *) a1, (struct EnvMemInfo *) a2, (int) a3);
+	case SYS_env_set_ksm:
+		return (int32_t) sys_env_set_ksm((envid_t) a1, a2 != 0);
 	default:
 		return -E_INVAL;
 	}
 }
 
+// Run a system call, tracing its entry and exit.  System calls that
+// block, like sys_ipc_recv, do not return here and leave no exit record.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	uint64_t start;
+	int32_t r;
+
+	if (!trace_enabled(TRACE_SYSCALL_ENTER) &&
+	    !trace_enabled(TRACE_SYSCALL_EXIT))
+		return syscall_dispatch(syscallno, a1, a2, a3, a4, a5);
+
+	start = read_tsc();
+	trace_event(TRACE_SYSCALL_ENTER, syscallno, a1, a2);
+	r = syscall_dispatch(syscallno, a1, a2, a3, a4, a5);
+	trace_event(TRACE_SYSCALL_EXIT, syscallno, r, read_tsc() - start);
+	return r;
+}
+
@@ -1,26 +1,96 @@
-#include <kern/time.h>
+#include <inc/x86.h>
 #include <inc/assert.h>
+#include <kern/time.h>
+
+// The time stamp counter, calibrated against the PIT at boot, is the
+// clock.  The calibration is in 'timeinfo', which mem_init() allocates
+// and maps at UTIME.
+struct TimeInfo *timeinfo;
+
+#define PIT_HZ		1193182		// PIT input clock
+#define CAL_MSEC	10		// Length of the calibration
+
+// n / d, for a 64-bit n, without libgcc's __udivdi3.
+static uint64_t
+udiv64(uint64_t n, uint32_t d)
+{
+	uint32_t hi = n >> 32, lo = n, qlo, r;
+
+	r = hi % d;
+	asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+	return ((uint64_t) (hi / d) << 32) | qlo;
+}
+
+// Count TSC ticks over CAL_MSEC milliseconds, timed with PIT channel 2
+// (the speaker channel, whose output can be read in port 0x61).
+static uint32_t
+tsc_calibrate(void)
+{
+	uint32_t latch = PIT_HZ * CAL_MSEC / 1000;
+	uint64_t t0, t1;
+
+	// Gate channel 2 on, speaker off; mode 0 counts down once.
+	outb(0x61, (inb(0x61) & ~0x02) | 0x01);
+	outb(0x43, 0xB0);
+	outb(0x42, latch & 0xFF);
+	outb(0x42, latch >> 8);
 
-static unsigned int ticks;
+	t0 = read_tsc();
+	while (!(inb(0x61) & 0x20))
+		;
+	t1 = read_tsc();
+
+	return (uint32_t) (t1 - t0) / CAL_MSEC;
+}
+
+// Find the largest shift for which (per_ms << shift) / khz still fits
+// in 32 bits, so that ticks * mult >> shift = ticks * per_ms / khz.
+static void
+time_scale_init(uint32_t per_ms, uint32_t khz, uint32_t *mult, uint32_t *shift)
+{
+	uint64_t m = 0;
+	uint32_t s;
+
+	for (s = 63; s > 0; s--) {
+		if (((uint64_t) per_ms << s) >> s != per_ms)
+			continue;
+		m = udiv64((uint64_t) per_ms << s, khz);
+		if (m <= 0xFFFFFFFF)
+			break;
+	}
+	*mult = m;
+	*shift = s;
+}
 
 void
 time_init(void)
 {
-	ticks = 0;
+	uint32_t khz = tsc_calibrate();
+
+	if (khz == 0)
+		panic("time_init: TSC is not running");
+
+	timeinfo->ti_tsc_khz = khz;
+	time_scale_init(1000000, khz, &timeinfo->ti_ns_mult,
+			&timeinfo->ti_ns_shift);
+	time_scale_init(1, khz, &timeinfo->ti_ms_mult, &timeinfo->ti_ms_shift);
+	timeinfo->ti_tsc_base = read_tsc();
+
+	cprintf("TSC: %u kHz\n", khz);
 }
 
-// This should be called once per timer interrupt.  A timer interrupt
-// fires every 10 ms.
-void
-time_tick(void)
+// Nanoseconds since boot.
+uint64_t
+time_nsec(void)
 {
-	ticks++;
-	if (ticks * 10 < ticks)
-		panic("time_tick: time overflowed"); //are you kidding me
+	return tsc_scale(read_tsc() - timeinfo->ti_tsc_base,
+			 timeinfo->ti_ns_mult, timeinfo->ti_ns_shift);
 }
 
+// Milliseconds since boot.
 unsigned int
 time_msec(void)
 {
-	return ticks * 10;
+	return tsc_scale(read_tsc() - timeinfo->ti_tsc_base,
+			 timeinfo->ti_ms_mult, timeinfo->ti_ms_shift);
 }
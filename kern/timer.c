@@ -0,0 +1,204 @@
+// Kernel timers on a hierarchical timer wheel.
+//
+// The wheel counts milliseconds.  Level 0 has one slot per millisecond
+// for the next 64ms, level 1 one slot per 64ms for the next 4s, and so
+// on; a timer sits at the lowest level that reaches its expiry.  When
+// the wheel passes the start of a level-n slot, the timers in it are
+// cascaded into the finer levels.  Adding and cancelling a timer are
+// O(1), and the wheel only does work in proportion to the timers that
+// are due.
+//
+// There is no periodic tick (see kern/sched.c).  CPU 0 sets its one-shot
+// timer no later than timer_deadline(), and every timer interrupt runs
+// the due timers.
+
+#include <inc/assert.h>
+#include <kern/timer.h>
+#include <kern/time.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+#define WHEEL_BITS	6
+#define WHEEL_SIZE	(1 << WHEEL_BITS)
+#define WHEEL_MASK	(WHEEL_SIZE - 1)
+#define WHEEL_LEVELS	4
+#define WHEEL_SPAN	(1U << (WHEEL_BITS * WHEEL_LEVELS))
+
+static struct spinlock timer_lock = {.name = "timer_lock"};
+static struct Timer *wheel[WHEEL_LEVELS][WHEEL_SIZE];
+static unsigned wheel_now;	// The next millisecond the wheel will run
+static unsigned wheel_count;	// Timers on the wheel
+static unsigned wheel_armed;	// Deadline CPU 0's timer is set for
+static bool wheel_is_armed;
+
+// Put 't' in the slot for its expiry, relative to wheel_now.
+// Timers further away than the wheel reaches go to the last level and
+// are cascaded down again when their slot comes round.
+static void
+wheel_insert(struct Timer *t)
+{
+	struct Timer **slot;
+	unsigned expires = t->tm_expires;
+	int delta = expires - wheel_now;
+	int level;
+
+	if (delta < 0)
+		expires = wheel_now;
+	else if ((unsigned) delta >= WHEEL_SPAN)
+		expires = wheel_now + WHEEL_SPAN - 1;
+
+	for (level = 0; level < WHEEL_LEVELS - 1; level++)
+		if (expires - wheel_now < 1U << (WHEEL_BITS * (level + 1)))
+			break;
+	slot = &wheel[level][(expires >> (WHEEL_BITS * level)) & WHEEL_MASK];
+
+	t->tm_next = *slot;
+	if (t->tm_next)
+		t->tm_next->tm_pprev = &t->tm_next;
+	t->tm_pprev = slot;
+	*slot = t;
+}
+
+static void
+wheel_remove(struct Timer *t)
+{
+	*t->tm_pprev = t->tm_next;
+	if (t->tm_next)
+		t->tm_next->tm_pprev = t->tm_pprev;
+	t->tm_next = NULL;
+	t->tm_pprev = NULL;
+}
+
+// wheel_now has reached the start of a level-1 slot: move the timers
+// of the slots that start now down a level (or more).
+static void
+wheel_cascade(void)
+{
+	struct Timer *t;
+	int level, idx;
+
+	for (level = 1; level < WHEEL_LEVELS; level++) {
+		idx = (wheel_now >> (WHEEL_BITS * level)) & WHEEL_MASK;
+		while ((t = wheel[level][idx])) {
+			wheel_remove(t);
+			wheel_insert(t);
+		}
+		if (idx != 0)
+			break;
+	}
+}
+
+// Arrange for t->tm_func(t->tm_arg) to be called at time_msec()
+// 'expires'.  If 't' is already pending it is moved.
+void
+timer_add(struct Timer *t, unsigned expires)
+{
+	bool kick;
+
+	spin_lock(&timer_lock);
+	if (t->tm_pprev) {
+		wheel_remove(t);
+		wheel_count--;
+	}
+	t->tm_expires = expires;
+	wheel_insert(t);
+	wheel_count++;
+	kick = cpunum() != 0 &&
+		(!wheel_is_armed || (int) (expires - wheel_armed) < 0);
+	spin_unlock(&timer_lock);
+
+	// CPU 0 has to set its timer for the new deadline.  If we are
+	// CPU 0 we will, on our way back to user mode.
+	if (kick)
+		lapic_ipi_cpu(cpus[0].cpu_id, IRQ_OFFSET + IRQ_WAKEUP);
+}
+
+// Take 't' off the wheel, if it is on it.
+void
+timer_cancel(struct Timer *t)
+{
+	spin_lock(&timer_lock);
+	if (t->tm_pprev) {
+		wheel_remove(t);
+		wheel_count--;
+	}
+	spin_unlock(&timer_lock);
+}
+
+// Take the next timer that is due at 'now' off the wheel, or return NULL.
+static struct Timer *
+wheel_pop(unsigned now)
+{
+	struct Timer *t;
+
+	if (!wheel_count) {
+		wheel_now = now + 1;
+		return NULL;
+	}
+
+	while ((int) (now - wheel_now) >= 0) {
+		if ((t = wheel[0][wheel_now & WHEEL_MASK])) {
+			wheel_remove(t);
+			wheel_count--;
+			return t;
+		}
+		wheel_now++;
+		if ((wheel_now & WHEEL_MASK) == 0)
+			wheel_cascade();
+	}
+	return NULL;
+}
+
+// Run the callbacks of all timers that are due.  Called from the timer
+// interrupt.
+void
+timer_run(void)
+{
+	unsigned now = time_msec();
+	struct Timer *t;
+
+	for (;;) {
+		spin_lock(&timer_lock);
+		t = wheel_pop(now);
+		spin_unlock(&timer_lock);
+		if (!t)
+			break;
+		t->tm_func(t->tm_arg);
+	}
+}
+
+// Find when the earliest pending timer may fire.  Returns false if no
+// timer is pending.  The answer may be early for timers on the higher
+// levels (it is the time their slot is cascaded), but never late.
+// Only CPU 0 calls this: it also records the deadline CPU 0 is about
+// to set its timer for, which timer_add() compares against.
+bool
+timer_deadline(unsigned *deadline)
+{
+	unsigned start, slot, when = 0;
+	bool found = false;
+	int level, i;
+
+	// Timers on level 0 are due in the slot they sit in; those on
+	// higher levels no earlier than the start of their slot.
+	spin_lock(&timer_lock);
+	for (level = 0; level < WHEEL_LEVELS && wheel_count; level++) {
+		start = wheel_now >> (WHEEL_BITS * level);
+		for (i = level ? 1 : 0; i < WHEEL_SIZE + (level ? 1 : 0); i++) {
+			if (!wheel[level][(start + i) & WHEEL_MASK])
+				continue;
+			slot = (start + i) << (WHEEL_BITS * level);
+			if (!found || (int) (slot - when) < 0)
+				when = slot;
+			found = true;
+			break;
+		}
+	}
+
+	wheel_is_armed = found;
+	wheel_armed = when;
+	spin_unlock(&timer_lock);
+
+	*deadline = when;
+	return found;
+}
@@ -0,0 +1,26 @@
+#ifndef JOS_KERN_TIMER_H
+#define JOS_KERN_TIMER_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// A kernel timer: calls tm_func(tm_arg) from the timer interrupt once
+// time_msec() reaches tm_expires.  The callback runs without the timer
+// lock and may race with timer_cancel(), so it must check for itself
+// that it is still wanted.
+struct Timer {
+	unsigned tm_expires;		// time_msec() at which to fire
+	void (*tm_func)(void *arg);
+	void *tm_arg;
+	struct Timer *tm_next;		// Next timer in the same wheel slot
+	struct Timer **tm_pprev;	// Link pointing at us, or NULL if idle
+};
+
+void timer_add(struct Timer *t, unsigned expires);
+void timer_cancel(struct Timer *t);
+void timer_run(void);
+bool timer_deadline(unsigned *deadline);
+
+#endif /* !JOS_KERN_TIMER_H */
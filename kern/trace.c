@@ -0,0 +1,184 @@
+// A kernel event trace.
+//
+// Tracepoints in trap(), syscall(), env_run() and the IPC system calls
+// append binary records to a ring of the CPU they run on.  Only that CPU
+// writes its ring, and the kernel runs with interrupts off, so recording
+// takes no lock.  Each ring keeps the latest TRACE_NRECORDS records.
+//
+// trace_mask selects the record types to keep.  A tracepoint whose type
+// is switched off only tests its bit (see trace_event()).
+//
+// The TSCs of all CPUs are assumed to run in step (see inc/time.h), so
+// trace_dump() merges the rings by timestamp.
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+#include <kern/trace.h>
+#include <kern/time.h>
+#include <kern/env.h>
+#include <kern/cpu.h>
+
+struct TraceBuf {
+	struct TraceRecord tb_records[TRACE_NRECORDS];
+	volatile uint32_t tb_head;	// Records ever written
+};
+
+volatile uint32_t trace_mask;
+
+static struct TraceBuf trace_bufs[NCPU];
+
+void
+trace_record(int type, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+	struct TraceBuf *b = &trace_bufs[cpunum()];
+	struct TraceRecord *r = &b->tb_records[b->tb_head % TRACE_NRECORDS];
+
+	r->tr_tsc = read_tsc();
+	r->tr_type = type;
+	r->tr_cpu = cpunum();
+	r->tr_envid = curenv ? curenv->env_id : 0;
+	r->tr_arg[0] = a0;
+	r->tr_arg[1] = a1;
+	r->tr_arg[2] = a2;
+	b->tb_head++;
+}
+
+// Trace the record types in 'mask' from now on (none if it is 0).
+// Returns the previous mask.
+uint32_t
+trace_set(uint32_t mask)
+{
+	return xchg(&trace_mask, mask & TRACE_ALL);
+}
+
+// Copy the latest 'n' records of 'cpu', oldest first, to 'buf'.
+// Records written meanwhile may be torn, so stop tracing first for a
+// clean copy.  Returns the number of records copied, or -E_INVAL if
+// there is no such CPU.
+int
+trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+	struct TraceBuf *b;
+	uint32_t head, i;
+
+	if (cpu < 0 || cpu >= ncpu || n < 0)
+		return -E_INVAL;
+	b = &trace_bufs[cpu];
+	head = b->tb_head;
+	n = MIN(n, MIN(head, TRACE_NRECORDS));
+	for (i = 0; i < n; i++)
+		buf[i] = b->tb_records[(head - n + i) % TRACE_NRECORDS];
+	return n;
+}
+
+// Print 'tsc' as milliseconds since boot, to the nanosecond.
+static void
+trace_print_time(uint64_t tsc)
+{
+	uint64_t ticks = tsc - timeinfo->ti_tsc_base;
+	uint32_t khz = timeinfo->ti_tsc_khz;
+	uint32_t ms;
+	int64_t rem;
+
+	ms = tsc_scale(ticks, timeinfo->ti_ms_mult, timeinfo->ti_ms_shift);
+	rem = ticks - (uint64_t) ms * khz;
+	for (; rem < 0; rem += khz)
+		ms--;
+	for (; rem >= khz; rem -= khz)
+		ms++;
+	cprintf("%6u.%06u", ms, (uint32_t) tsc_scale(rem, timeinfo->ti_ns_mult,
+						      timeinfo->ti_ns_shift));
+}
+
+static void
+trace_print(struct TraceRecord *r)
+{
+	const uint32_t *a = r->tr_arg;
+
+	trace_print_time(r->tr_tsc);
+	cprintf("  %2u  %08x  ", r->tr_cpu, r->tr_envid);
+	switch (r->tr_type) {
+	case TRACE_SYSCALL_ENTER:
+		cprintf("syscall %u (%x, %x)\n", a[0], a[1], a[2]);
+		break;
+	case TRACE_SYSCALL_EXIT:
+		cprintf("syscall %u = %d, %u ns\n", a[0], a[1],
+			(uint32_t) tsc_scale(a[2], timeinfo->ti_ns_mult,
+					     timeinfo->ti_ns_shift));
+		break;
+	case TRACE_TRAP:
+		cprintf("trap %u at %08x, err %x\n", a[0], a[1], a[2]);
+		break;
+	case TRACE_IRQ:
+		cprintf("irq %u\n", a[0]);
+		break;
+	case TRACE_SWITCH:
+		cprintf("switch to %08x\n", a[0]);
+		break;
+	case TRACE_IPC_SEND:
+		cprintf("ipc send to %08x value %x: %d\n", a[0], a[1], a[2]);
+		break;
+	case TRACE_IPC_RECV:
+		cprintf("ipc recv at %08x, deadline %u\n", a[0], a[1]);
+		break;
+	default:
+		cprintf("type %u\n", r->tr_type);
+		break;
+	}
+}
+
+// Print the latest 'n' records of all CPUs in time order.  Tracing
+// stops while the rings are read.
+void
+trace_dump(int n)
+{
+	uint32_t first[NCPU], pos[NCPU], head[NCPU], mask;
+	struct TraceRecord *r, *best;
+	int cpu, bcpu = 0, i;
+
+	mask = trace_set(0);
+	for (cpu = 0; cpu < ncpu; cpu++) {
+		head[cpu] = trace_bufs[cpu].tb_head;
+		first[cpu] = head[cpu] - MIN(head[cpu], TRACE_NRECORDS);
+		pos[cpu] = head[cpu];
+	}
+
+	// Walk back from the newest record to the n-th newest...
+	for (i = 0; i < n; i++) {
+		best = NULL;
+		for (cpu = 0; cpu < ncpu; cpu++) {
+			if (pos[cpu] == first[cpu])
+				continue;
+			r = &trace_bufs[cpu].tb_records[(pos[cpu] - 1) % TRACE_NRECORDS];
+			if (!best || r->tr_tsc > best->tr_tsc) {
+				best = r;
+				bcpu = cpu;
+			}
+		}
+		if (!best)
+			break;
+		pos[bcpu]--;
+	}
+
+	// ...and print forwards from there.
+	cprintf("      msec          cpu  env       event\n");
+	for (;;) {
+		best = NULL;
+		for (cpu = 0; cpu < ncpu; cpu++) {
+			if (pos[cpu] == head[cpu])
+				continue;
+			r = &trace_bufs[cpu].tb_records[pos[cpu] % TRACE_NRECORDS];
+			if (!best || r->tr_tsc < best->tr_tsc) {
+				best = r;
+				bcpu = cpu;
+			}
+		}
+		if (!best)
+			break;
+		trace_print(best);
+		pos[bcpu]++;
+	}
+	trace_set(mask);
+}
@@ -0,0 +1,32 @@
+#ifndef JOS_KERN_TRACE_H
+#define JOS_KERN_TRACE_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/trace.h>
+
+#define TRACE_NRECORDS	1024		// Records kept per CPU
+
+extern volatile uint32_t trace_mask;	// Record types being traced
+
+void trace_record(int type, uint32_t a0, uint32_t a1, uint32_t a2);
+uint32_t trace_set(uint32_t mask);
+int trace_read(int cpu, struct TraceRecord *buf, int n);
+void trace_dump(int n);
+
+static inline bool
+trace_enabled(int type)
+{
+	return trace_mask & (1 << type);
+}
+
+// A tracepoint.  While its type is switched off it costs a load and a
+// branch.
+#define trace_event(type, a0, a1, a2)					\
+	do {								\
+		if (trace_enabled(type))				\
+			trace_record(type, a0, a1, a2);			\
+	} while (0)
+
+#endif /* !JOS_KERN_TRACE_H */
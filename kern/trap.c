@@ -14,6 +14,8 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/perf.h>
+#include <kern/trace.h>
 #include <kern/e1000.h>
 #include <kern/picirq.h>
 #include <kern/sb16.h>
@@ -142,6 +144,9 @@ trap_init_percpu(void)
 	// user space on that CPU.
 	//
 	// LAB 4: Your code here:
+	extern void sysenter_handler(void);
+	uint32_t edx;
+
 	thiscpu->cpu_ts.ts_esp0 = KSTACKTOPN(thiscpu->cpu_id);
 	thiscpu->cpu_ts.ts_ss0 = GD_KD;
 	gdt[(GD_TSS0 >> 3) + thiscpu->cpu_id] = SEG16(
@@ -156,6 +161,15 @@ trap_init_percpu(void)
 	ltr(GD_TSS0  + (thiscpu->cpu_id << 3));
 	// Load the IDT
 	lidt(&idt_pd);
+
+	// Set up fast system calls (see sysenter_handler).  sysenter
+	// takes its kernel stack from an MSR rather than the TSS.
+	cpuid(1, NULL, NULL, NULL, &edx);
+	if (edx & CPUID_FEAT_SEP) {
+		wrmsr(MSR_SYSENTER_CS, GD_KT);
+		wrmsr(MSR_SYSENTER_ESP, KSTACKTOPN(thiscpu->cpu_id));
+		wrmsr(MSR_SYSENTER_EIP, (uintptr_t) sysenter_handler);
+	}
 }
 
 void
@@ -237,16 +251,24 @@ trap_dispatch(struct Trapframe *tf)
 	}
 
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
-        // Add time tick increment to clock interrupts.
-        // Be careful! In multiprocessors, clock interrupts are
-        // triggered on every CPU.
-        // LAB 6: Your code here.
-        if (thiscpu->cpu_id == 0) 
-            time_tick();
+        // The time comes from the TSC (see kern/time.c), so no CPU
+        // has to count clock ticks.
 
         // Handle clock interrupts. Don't forget to acknowledge the
         // interrupt using lapic_eoi() before calling the scheduler!
         // LAB 4: Your code here.        
+		lapic_eoi();
+		if (perf_enabled)
+			perf_sample(tf);
+
+		// Let curenv run on until its time slice is used up.
+		if (sched_tick())
+			return;
+		sched_yield();
+	}
+
+	// Another CPU queued an env that this one should run.
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_WAKEUP) {
 		lapic_eoi();
 		sched_yield();
 	}
@@ -306,6 +328,26 @@ trap(struct Trapframe *tf)
 	if (panicstr)
 		asm volatile("hlt");
 
+	// Answer TLB shootdowns at once: the CPU asking may hold the big
+	// kernel lock (see tlb_shootdown()).
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TLB) {
+		lapic_eoi();
+		lcr3(rcr3());
+		thiscpu->cpu_tlb_stale = 0;
+		env_pop_tf(tf);
+	}
+
+	// sysenter leaves EFLAGS.TF set, so an env single-stepping into a
+	// fast system call traps again at the first instruction of
+	// sysenter_handler, in kernel mode.  Clear TF and go on with the
+	// system call; the env stops single-stepping there.
+	extern void sysenter_handler(void);
+	if (tf->tf_trapno == T_DEBUG && (tf->tf_cs & 3) == 0 &&
+	    tf->tf_eip == (uintptr_t) sysenter_handler) {
+		tf->tf_eflags &= ~FL_TF;
+		env_pop_tf(tf);
+	}
+
 	//cprintf("Incoming TRAP frame at %p\n", tf);
 	
 	//cprintf("[%s]\n", trapname(tf->tf_trapno)); 
@@ -319,18 +361,30 @@ trap(struct Trapframe *tf)
 	// the interrupt path.
 	assert(!(read_eflags() & FL_IF));
 
+	// System calls are traced in syscall().
+	if (tf->tf_trapno < IRQ_OFFSET)
+		trace_event(TRACE_TRAP, tf->tf_trapno, tf->tf_eip, tf->tf_err);
+	else if (tf->tf_trapno != T_SYSCALL)
+		trace_event(TRACE_IRQ, tf->tf_trapno - IRQ_OFFSET, 0, 0);
 
 
 	if ((tf->tf_cs & 3) == 3) {
 		assert(curenv);
+		tlb_leave_user();
+		env_account_trap(curenv, tf);
 		// Trapped from user mode.
 		// Acquire the big kernel lock before doing any
-		// serious kernel work.
+		// serious kernel work.  System calls that only need
+		// the env and page locks run without it.
 		// LAB 4: Your code here.
-		lock_kernel();
+		if (tf->tf_trapno != T_SYSCALL ||
+		    !syscall_unlocked(tf->tf_regs.reg_eax))
+			lock_kernel();
 
 		// Garbage collect if current enviroment is a zombie
 		if (curenv->env_status == ENV_DYING) {
+			if (!kernel_lock_held())
+				lock_kernel();
 			env_free(curenv);
 			curenv = NULL;
 			sched_yield();
@@ -360,13 +414,75 @@ trap(struct Trapframe *tf)
 		sched_yield();
 }
 
+// System calls made with sysenter come here from sysenter_handler in
+// kern/trapentry.S, which returns the result to user mode with sysexit.
+// The user stub (see lib/syscall.c) passes its return address in SI and
+// its stack pointer in BP and treats SI, CX and DX as clobbered.
+//
+// sysenter saves no user state, so first record in curenv->env_tf all
+// that trap() would have saved, for the case that we do not come back
+// here: the system call blocks, yields or forks (sys_exofork() copies
+// the whole frame), and the env later resumes through env_run().
+// sysenter cleared IF, which user mode always runs with.
+int32_t
+syscall_fast(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3,
+	     uint32_t a4, uintptr_t eip, uintptr_t esp, uint32_t eflags)
+{
+	struct Trapframe *tf;
+	int32_t r;
+
+	assert(curenv);
+	tlb_leave_user();
+	tf = &curenv->env_tf;
+	tf->tf_trapno = T_SYSCALL;
+	tf->tf_regs.reg_eax = syscallno;
+	tf->tf_regs.reg_edx = a1;
+	tf->tf_regs.reg_ecx = a2;
+	tf->tf_regs.reg_ebx = a3;
+	tf->tf_regs.reg_edi = a4;
+	tf->tf_regs.reg_esi = eip;
+	tf->tf_regs.reg_ebp = esp;
+	tf->tf_eip = eip;
+	tf->tf_esp = esp;
+	tf->tf_eflags = eflags | FL_IF;
+	env_account_trap(curenv, tf);
+
+	// From here on as in trap().
+	if (!syscall_unlocked(syscallno))
+		lock_kernel();
+	if (curenv->env_status == ENV_DYING) {
+		if (!kernel_lock_held())
+			lock_kernel();
+		env_free(curenv);
+		curenv = NULL;
+		sched_yield();
+	}
+	last_tf = tf;
+
+	r = syscall(syscallno, a1, a2, a3, a4, 0);
+	if (!curenv || curenv->env_status != ENV_RUNNING) {
+		if (curenv)
+			tf->tf_regs.reg_eax = r;
+		sched_yield();
+	}
+
+	// Return straight to curenv, like env_run() does without a
+	// context switch.
+	env_account_kernel(curenv);
+	thiscpu->cpu_yielded = false;
+	if (kernel_lock_held())
+		unlock_kernel();
+	tlb_enter_user();
+	return r;
+}
+
 
 void
 page_fault_handler(struct Trapframe *tf)
 {
 	uint32_t fault_va;
 	struct UTrapframe *utf;
-	uintptr_t tt_esp;
+	uintptr_t tt_esp, xstacktop;
 
 	// Read processor's CR2 register to find the faulting address
 	fault_va = rcr2();
@@ -382,6 +498,18 @@ page_fault_handler(struct Trapframe *tf)
 	// We've already handled kernel-mode exceptions, so if we get here,
 	// the page fault happened in user mode.
 
+	// Resolve copy-on-write faults right here, without a round trip
+	// through the upcall.  If there is no memory for the copy, the
+	// upcall gets the fault as before.
+	if ((tf->tf_err & (FEC_PR | FEC_WR)) == (FEC_PR | FEC_WR) &&
+	    page_cow(curenv->env_pgdir, (void *) fault_va) == 0)
+		return;
+
+	// Likewise fill in demand-zero memory (see sys_region_reserve()).
+	if (!(tf->tf_err & FEC_PR) &&
+	    env_region_fault(curenv, fault_va, tf->tf_err & FEC_WR) == 0)
+		return;
+
 	// Call the environment's page fault upcall, if one exists.  Set up a
 	// page fault stack frame on the user exception stack (below
 	// UXSTACKTOP), then branch to curenv->env_pgfault_upcall.
@@ -414,15 +542,17 @@ page_fault_handler(struct Trapframe *tf)
 	if (!curenv->env_pgfault_upcall)
 		goto destroy;
 	
-	user_mem_assert(curenv, (void *) (UXSTACKTOP - 1), 1, PTE_W);
+	// Threads have exception stacks of their own.
+	xstacktop = curenv->env_xstacktop;
+	user_mem_assert(curenv, (void *) (xstacktop - 1), 1, PTE_W);
 	user_mem_assert(curenv, curenv->env_pgfault_upcall, 1, 0);
 	
 	// Record the trap-time esp, before we ruin it.
 	tt_esp = tf->tf_esp;
 	
 	// If we are not already in the Xstack, move there.
-	if (tf->tf_esp <= USTACKTOP) {
-		tf->tf_esp = UXSTACKTOP;
+	if (tf->tf_esp <= xstacktop - PGSIZE || tf->tf_esp > xstacktop) {
+		tf->tf_esp = xstacktop;
 	}
 	
 	// Free up a scratch space of 32 bit. (only relevant in recursion)
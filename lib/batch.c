@@ -0,0 +1,127 @@
+// Queue page system calls and make them with one sys_batch() call.
+//
+// Consecutive operations of the same kind on adjacent pages with the
+// same permissions are merged into one ranged operation.
+
+#include <inc/lib.h>
+
+static struct BatchOp *
+batch_next(struct Batch *b)
+{
+	struct BatchOp *op;
+
+	if (b->b_nops == BATCH_MAXOPS)
+		batch_flush(b);
+	op = &b->b_ops[b->b_nops++];
+	memset(op, 0, sizeof(*op));
+	return op;
+}
+
+// The last queued operation, if it is an 'opcode' that the page at
+// 'srcva'/'dstva' would extend.
+static struct BatchOp *
+batch_last(struct Batch *b, uint32_t opcode, envid_t srcenv, void *srcva,
+	   envid_t dstenv, void *dstva, int perm)
+{
+	struct BatchOp *op;
+	size_t len;
+
+	if (b->b_nops == 0)
+		return NULL;
+	op = &b->b_ops[b->b_nops - 1];
+	len = op->bo_npages * PGSIZE;
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+		return op;
+	return NULL;
+}
+
+static void
+batch_page(struct Batch *b, uint32_t opcode, envid_t srcenv, void *srcva,
+	   envid_t dstenv, void *dstva, int perm, size_t npages)
+{
+	struct BatchOp *op;
+
+	if ((op = batch_last(b, opcode, srcenv, srcva, dstenv, dstva, perm))) {
+		op->bo_npages += npages;
+		return;
+	}
+	op = batch_next(b);
+	op->bo_op = opcode;
+	op->bo_srcenv = srcenv;
+	op->bo_srcva = srcva;
+	op->bo_dstenv = dstenv;
+	op->bo_dstva = dstva;
+	op->bo_perm = perm;
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+	b->b_nops = 0;
+	b->b_error = 0;
+}
+
+// Make sure that the next 'nops' operations are made in the same
+// sys_batch() call.
+void
+batch_reserve(struct Batch *b, int nops)
+{
+	if (b->b_nops + nops > BATCH_MAXOPS)
+		batch_flush(b);
+}
+
+// Queue sys_page_alloc(env, va + i * PGSIZE, perm) for each of 'npages'
+// pages.
+void
+batch_alloc(struct Batch *b, envid_t env, void *va, int perm, size_t npages)
+{
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+}
+
+// Queue sys_page_map(srcenv, srcva + i * PGSIZE, dstenv,
+// dstva + i * PGSIZE, perm) for each of 'npages' pages.
+void
+batch_map(struct Batch *b, envid_t srcenv, void *srcva,
+	  envid_t dstenv, void *dstva, int perm, size_t npages)
+{
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+		   npages);
+}
+
+// Queue sys_page_unmap(env, va + i * PGSIZE) for each of 'npages' pages.
+void
+batch_unmap(struct Batch *b, envid_t env, void *va, size_t npages)
+{
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+}
+
+// Queue sys_env_set_status(env, status).
+void
+batch_set_status(struct Batch *b, envid_t env, int status)
+{
+	struct BatchOp *op = batch_next(b);
+
+	op->bo_op = BATCH_ENV_SET_STATUS;
+	op->bo_dstenv = env;
+	op->bo_perm = status;
+}
+
+// Make the queued system calls.  After an operation fails, the rest of
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+	return b->b_error;
+}
@@ -3,13 +3,11 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
+// The kernel resolves copy-on-write faults itself (see page_cow()), so
+// this only sees those it had no memory for.
 //
 static void
 pgfault(struct UTrapframe *utf)
@@ -27,7 +25,8 @@ pgfault(struct UTrapframe *utf)
 	// LAB 4: Your code here.
 	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
 	
-	if (!(err & FEC_WR) || ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
 		panic("pgfault on non-COW page.");
 	
 	// Allocate a new page, map it at a temporary location (PFTEMP),
@@ -47,25 +46,12 @@ pgfault(struct UTrapframe *utf)
 		panic("pgfault handler couldn't remap the address : %e", r);
 }
 
-//
-// Map our virtual page pn (address pn*PGSIZE) into the target envid
-// at the same virtual address.  If the page is writable or copy-on-write,
-// the new mapping must be created copy-on-write, and then our mapping must be
-// marked copy-on-write as well.  (Exercise: Why do we need to mark ours
-// copy-on-write again if it was already copy-on-write at the beginning of
-// this function?)
-//
-// Returns: 0 on success, < 0 on error.
-// It is also OK to panic on error.
-//
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
 static int
-duppage(envid_t envid, unsigned pn)
+dupperm(unsigned pn)
 {
-	int r;
-	
-	
-	// LAB 4: Your code here.
-	r = PTE_U | PTE_P;
+	int r = PTE_U | PTE_P;
 	
 	// Assert that a page is not COW and also shared.
 	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
@@ -81,20 +67,76 @@ duppage(envid_t envid, unsigned pn)
 	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
 		r |= PTE_W;
 	
-	
+	return r;
+}
+
+//
+// Map our virtual pages [pn, pn + npages) (address pn*PGSIZE), which
+// all have the same dupperm(), into the target envid at the same virtual
+// address.  If the pages are writable or copy-on-write, the new mappings
+// must be created copy-on-write, and then our mappings must be marked
+// copy-on-write as well.  (Exercise: Why do we need to mark ours
+// copy-on-write again if it was already copy-on-write at the beginning of
+// this function?)
+//
+// The mappings are queued in 'b'.  Both halves go into the same
+// sys_batch() call, so we cannot write to the pages in between.
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(struct Batch *b, envid_t envid, unsigned pn, unsigned npages)
+{
+	void *va = (void *) (pn * PGSIZE);
+	int perm = dupperm(pn);
+
+	// LAB 4: Your code here.
+	batch_reserve(b, 2);
 	
 	// Map child
-	if (sys_page_map(0, (void *) (pn * PGSIZE), envid, (void *) (pn * PGSIZE), r) < 0)
-		panic("duppage cannot map new page");
+	batch_map(b, 0, va, envid, va, perm, npages);
 	
 	// Remap current mapping
-	if (sys_page_map(envid, (void *) (pn * PGSIZE), 0, (void *) (pn * PGSIZE), r) < 0)
-		panic("duppage cannot remap old page");
-	
+	batch_map(b, 0, va, 0, va, perm, npages);
 	
 	return 0;
 }
 
+//
+// Give the target envid the 4MB page at our page pn.  A writable page
+// that is not PTE_SHARE is copied through UTEMP at once, as it cannot be
+// copy-on-write; any other is shared.
+//
+static void
+dupbigpage(struct Batch *b, envid_t envid, unsigned pn)
+{
+	void *va = (void *) (pn * PGSIZE);
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+	int r;
+
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+		batch_map(b, 0, va, envid, va, perm, 1);
+		return;
+	}
+
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, va, PTSIZE);
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+		panic("sys_page_unmap: %e", r);
+}
+
+// Is page pn mapped, by a page table?
+static bool
+pn_mapped(unsigned pn)
+{
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+	       (uvpt[pn] & PTE_P);
+}
+
 //
 // User-level fork with copy-on-write.
 // Set up our page fault handler appropriately.
@@ -111,10 +153,15 @@ duppage(envid_t envid, unsigned pn)
 //   Neither user exception stack should ever be marked copy-on-write,
 //   so you must allocate a new page for the child's user exception stack.
 //
+// fork() below has the kernel copy the address space instead, in one
+// system call; this version is kept to compare against (see
+// user/forkbench.c).
+//
 envid_t
-fork(void)
+ufork(void)
 {
-	int pid, i;
+	struct Batch b;
+	int pid, i, j, r;
 	
 	// Assembly language pgfault entrypoint defined in lib/pfentry.S.
 	extern void _pgfault_upcall(void);
@@ -130,36 +177,85 @@ fork(void)
 		// to the stack, meaning he can't call set_pgfault_handler.
 		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
 		
+		// The page system calls go in batches (see lib/batch.c).
+		batch_init(&b);
+		
 		// allocate Xstack for child
-		if(sys_page_alloc(pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
-									  PTE_W | PTE_P | PTE_U) < 0)
-			panic("fork: cannot allocate page for Xstack");
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+			    PTE_W | PTE_P | PTE_U, 1);
 		
-		for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
-			if (! (uvpd[i / NPTENTRIES] & PTE_P))
+		// Copy each run of mapped pages with the same permissions
+		// at once.
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+				j = ROUNDUP(i + 1, NPTENTRIES);
 				continue;
+			}
+
+			// 4MB pages are never copy-on-write (see
+			// sys_page_alloc()).
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+				dupbigpage(&b, pid, i);
+				j = ROUNDUP(i + 1, NPTENTRIES);
+				continue;
+			}
 			
+			j = i + 1;
 			if (! (uvpt[i] & PTE_P))
 				continue;
 			
-			duppage(pid, i);
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+			       dupperm(j) == dupperm(i))
+				j++;
+			duppage(&b, pid, i, j - i);
 		}
 		
-		if(sys_env_set_status(pid, ENV_RUNNABLE) < 0)
-			panic("fork: cannot set child status");
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+		if ((r = batch_flush(&b)) < 0)
+			panic("fork: %e", r);
 		
 		return pid;
 		
 	} else {
-		thisenv = &envs[ENVX(sys_getenvid())];
+		mainenv = &envs[ENVX(sys_getenvid())];
 		return 0;
 	}
 }
 
-// Challenge!
-int
-sfork(void)
+//
+// Fork with copy-on-write, with the address space duplicated by the
+// kernel (see sys_fork()).  The child gets the same page fault handler,
+// which resolves its copy-on-write faults just as the parent's.
+//
+envid_t
+fork(void)
+{
+	envid_t pid;
+
+	set_pgfault_handler(pgfault);
+	if ((pid = sys_fork()) < 0)
+		panic("cannot fork: %e", pid);
+	if (pid == 0)
+		mainenv = &envs[ENVX(sys_getenvid())];
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+	func(arg);
+	sys_env_destroy(0);
+}
+
+//
+// Start a thread running func(arg): an environment that shares our whole
+// address space, but has stacks of its own (see sys_thread_create()).
+// The thread exits when func returns.
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
 {
-	panic("sfork not implemented");
-	return -E_INVAL;
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
 }
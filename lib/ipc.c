@@ -21,13 +21,22 @@
 //   a perfectly valid place to map a page.)
 int32_t
 ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+}
+
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
 {
 	// LAB 4: Your code here.
 	int error;
 	
 	if (pg == 0)
 		pg = (void *) UTOP;
-	if ((error = sys_ipc_recv(pg)) < 0) {
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
 		if (from_env_store)
 			*from_env_store = 0;
 		
@@ -2,31 +2,36 @@
 // entry.S already took care of defining envs, pages, uvpd, and uvpt.
 
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 extern void umain(int argc, char **argv);
 
-const volatile struct Env *thisenv;
+const volatile struct Env *mainenv;
 const char *binaryname = "<unknown>";
 
 void
 libmain(int argc, char **argv)
 {
-	// set thisenv to point at our Env structure in envs[].
+	// set mainenv (our thisenv) to point at our Env structure in envs[].
 	// LAB 3: Your code here.
 	int i;
 	envid_t envid;
+	uint32_t features;
 	
-	thisenv = NULL;
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+
+	mainenv = NULL;
 	envid = sys_getenvid();
 	
 	for (i = 0; i < NENV; i++) {
 		if(envs[i].env_id == envid) {
-			thisenv = &envs[i];
+			mainenv = &envs[i];
 			break;
 		}
 	}
 	
-	if (thisenv == NULL)
+	if (mainenv == NULL)
 		panic("libmain can't find the environment");
 	
 
@@ -101,6 +101,10 @@ spawn(const char *prog, const char **argv)
 		return r;
 	child = r;
 
+	// The child's memory is its own, not our demand-zero regions.
+	if ((r = sys_region_release(child, 0, UTOP)) < 0)
+		goto error;
+
 	// Set up trap frame, including initial stack.
 	child_tf = envs[ENVX(child)].env_tf;
 	child_tf.tf_eip = elf->e_entry;
@@ -257,12 +261,15 @@ error:
 	return r;
 }
 
+// Pages map_segment() reads from the file at a time, at UTEMP.
+#define SEGMENT_CHUNK	64
+
 static int
 map_segment(envid_t child, uintptr_t va, size_t memsz,
 	int fd, size_t filesz, off_t fileoffset, int perm)
 {
-	int i, r;
-	void *blk;
+	int i, n, r;
+	struct Batch b;
 
 	//cprintf("map_segment %x+%x\n", va, memsz);
 
@@ -273,24 +280,29 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
 		fileoffset -= i;
 	}
 
-	for (i = 0; i < memsz; i += PGSIZE) {
-		if (i >= filesz) {
-			// allocate a blank page
-			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
-				return r;
-		} else {
-			// from file
-			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
-				return r;
-			if ((r = seek(fd, fileoffset + i)) < 0)
-				return r;
-			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
-				return r;
-			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
-				panic("spawn: sys_page_map data: %e", r);
-			sys_page_unmap(0, UTEMP);
-		}
+	// The pages that come from the file, a chunk at a time: allocate
+	// the chunk at UTEMP, read it in, and move it to the child.
+	batch_init(&b);
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+			SEGMENT_CHUNK);
+		batch_alloc(&b, 0, UTEMP, PTE_P|PTE_U|PTE_W, n);
+		if ((r = batch_flush(&b)) < 0)
+			return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+			return r;
+		batch_map(&b, 0, UTEMP, child, (void*) (va + i), perm, n);
+		batch_unmap(&b, 0, UTEMP, n);
+		if ((r = batch_flush(&b)) < 0)
+			panic("spawn: sys_page_map data: %e", r);
 	}
+
+	// the blank pages are demand-zero
+	if (i < memsz)
+		return sys_region_reserve(child, (void*) (va + i), memsz - i,
+					  perm);
 	return 0;
 }
 
@@ -299,13 +311,26 @@ static int
 copy_shared_pages(envid_t child)
 {
 	// LAB 5: Your code here.
+	struct Batch b;
 	int i, r;
 	cprintf("copy_shared_pages(%x);\n", child);
 	
+	batch_init(&b);
+	
 	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
 		// We want to make sure the page table exists
 		if (! (uvpd[i / NPTENTRIES] & PTE_P))
 			continue;
+
+		// A 4MB page has no page table
+		if (uvpd[i / NPTENTRIES] & PTE_PS) {
+			if (uvpd[i / NPTENTRIES] & PTE_SHARE)
+				batch_map(&b, 0, (void *) (i * PGSIZE), child,
+					  (void *) (i * PGSIZE),
+					  uvpd[i / NPTENTRIES] & PTE_SYSCALL, 1);
+			i = ROUNDUP(i + 1, NPTENTRIES) - 1;
+			continue;
+		}
 		
 		// Make sure the PTE exists
 		if (! (uvpt[i] & PTE_P))
@@ -319,10 +344,11 @@ copy_shared_pages(envid_t child)
 		assert(uvpt[i] & PTE_U);
 		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
 		
-		// Map page
-		if((r = sys_page_map(0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r)) < 0)
-			panic("cannot map page: %e", r);
+		// Map page (adjacent pages are mapped with one operation)
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
 	}
+	if ((r = batch_flush(&b)) < 0)
+		panic("cannot map page: %e", r);
 	return 0;
 }
 
@@ -3,11 +3,38 @@
 #include <inc/syscall.h>
 #include <inc/lib.h>
 
+// Make every system call with 'int T_SYSCALL' rather than sysenter.
+// libmain() sets this on CPUs without sysenter.
+bool syscall_use_int;
+
 static inline int32_t
 syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
 	int32_t ret;
 
+	// Fast system call: pass system call number in AX and up to four
+	// parameters in DX, CX, BX, DI, and enter the kernel with
+	// sysenter.  The kernel returns with sysexit to the EIP in SI and
+	// the ESP in BP, and leaves garbage in CX and DX.  BP is saved on
+	// the stack around the call.
+	if (a5 == 0 && !syscall_use_int) {
+		uint32_t edx = a1, ecx = a2;
+
+		asm volatile("pushl %%ebp\n\t"
+			     "movl %%esp, %%ebp\n\t"
+			     "leal 1f, %%esi\n\t"
+			     "sysenter\n"
+			     "1:\tpopl %%ebp"
+			: "=a" (ret),
+			  "+d" (edx),
+			  "+c" (ecx)
+			: "a" (num),
+			  "b" (a3),
+			  "D" (a4)
+			: "esi", "cc", "memory");
+		goto out;
+	}
+
 	// Generic system call: pass system call number in AX,
 	// up to five parameters in DX, CX, BX, DI, SI.
 	// Interrupt kernel with T_SYSCALL.
@@ -31,6 +58,7 @@ syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		  "S" (a5)
 		: "cc", "memory");
 
+out:
 	if(check && ret > 0)
 		panic("syscall %d returned %d (> 0)", num, ret);
 
@@ -105,6 +133,18 @@ sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
 	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
 }
 
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+
 int
 sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
 {
@@ -117,12 +157,99 @@ sys_ipc_recv(void *dstva)
 	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
 }
 
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+
 unsigned int
 sys_time_msec(void)
 {
 	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
 }
 
+int
+sys_sleep_until(unsigned deadline)
+{
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+
+int
+sys_env_print_stats(int limit)
+{
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+
+int
+sys_perf(int op, unsigned arg)
+{
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+}
+
+uint64_t
+sys_time_nsec(void)
+{
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+	return ns;
+}
+
 int
 sys_e1000_transmit(char *packet, size_t len)
 {
@@ -0,0 +1,6627 @@
+
+obj/audio/audio:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f1 03 00 00       	call   800422 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_wait_ready>:
+
+static int diskno = 0;
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	89 c3                	mov    %eax,%ebx
+
+static __inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800039:	ba 77 01 00 00       	mov    $0x177,%edx
+  80003e:	ec                   	in     (%dx),%al
+	int r;
+
+	while (((r = inb(0x177)) & IDE_BSY))
+  80003f:	84 c0                	test   %al,%al
+  800041:	78 fb                	js     80003e <ide_wait_ready+0xb>
+}
+
+static __inline void
+outb(int port, uint8_t data)
+{
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800043:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  800048:	ba 76 01 00 00       	mov    $0x176,%edx
+  80004d:	ee                   	out    %al,(%dx)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80004e:	ba 77 01 00 00       	mov    $0x177,%edx
+  800053:	ec                   	in     (%dx),%al
+		/* do nothing */;
+    
+    // choose diskno before polling for drive rdy bit.
+    outb(0x176, 0xE0 | ((diskno)<<4));
+
+    while (((r = inb(0x177)) & (IDE_BSY | IDE_DRDY)) != IDE_DRDY)
+  800054:	89 c1                	mov    %eax,%ecx
+  800056:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800059:	80 f9 40             	cmp    $0x40,%cl
+  80005c:	75 f5                	jne    800053 <ide_wait_ready+0x20>
+		/* do nothing */;
+    
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+		return -1;
+	return 0;
+  80005e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  800063:	84 db                	test   %bl,%bl
+  800065:	74 0a                	je     800071 <ide_wait_ready+0x3e>
+  800067:	a8 21                	test   $0x21,%al
+  800069:	0f 95 c2             	setne  %dl
+  80006c:	0f b6 d2             	movzbl %dl,%edx
+  80006f:	f7 da                	neg    %edx
+}
+  800071:	89 d0                	mov    %edx,%eax
+  800073:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800076:	c9                   	leave
+  800077:	c3                   	ret
+
+00800078 <ide_read>:
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  800078:	55                   	push   %ebp
+  800079:	89 e5                	mov    %esp,%ebp
+  80007b:	57                   	push   %edi
+  80007c:	56                   	push   %esi
+  80007d:	53                   	push   %ebx
+  80007e:	83 ec 0c             	sub    $0xc,%esp
+  800081:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800084:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800087:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	assert(nsecs <= 256);
+  80008a:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  800090:	77 7a                	ja     80010c <ide_read+0x94>
+
+	ide_wait_ready(0);
+  800092:	b8 00 00 00 00       	mov    $0x0,%eax
+  800097:	e8 97 ff ff ff       	call   800033 <ide_wait_ready>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80009c:	ba 72 01 00 00       	mov    $0x172,%edx
+  8000a1:	89 f0                	mov    %esi,%eax
+  8000a3:	ee                   	out    %al,(%dx)
+  8000a4:	ba 73 01 00 00       	mov    $0x173,%edx
+  8000a9:	89 f8                	mov    %edi,%eax
+  8000ab:	ee                   	out    %al,(%dx)
+
+	outb(0x172, nsecs);
+	outb(0x173, secno & 0xFF);
+	outb(0x174, (secno >> 8) & 0xFF);
+  8000ac:	89 f8                	mov    %edi,%eax
+  8000ae:	c1 e8 08             	shr    $0x8,%eax
+  8000b1:	ba 74 01 00 00       	mov    $0x174,%edx
+  8000b6:	ee                   	out    %al,(%dx)
+	outb(0x175, (secno >> 16) & 0xFF);
+  8000b7:	89 f8                	mov    %edi,%eax
+  8000b9:	c1 e8 10             	shr    $0x10,%eax
+  8000bc:	ba 75 01 00 00       	mov    $0x175,%edx
+  8000c1:	ee                   	out    %al,(%dx)
+	outb(0x176, 0xE0 | ((diskno)<<4) | ((secno>>24)&0x0F));
+  8000c2:	89 f8                	mov    %edi,%eax
+  8000c4:	c1 e8 18             	shr    $0x18,%eax
+  8000c7:	83 e0 0f             	and    $0xf,%eax
+  8000ca:	83 c8 e0             	or     $0xffffffe0,%eax
+  8000cd:	ba 76 01 00 00       	mov    $0x176,%edx
+  8000d2:	ee                   	out    %al,(%dx)
+  8000d3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8000d8:	ba 77 01 00 00       	mov    $0x177,%edx
+  8000dd:	ee                   	out    %al,(%dx)
+  8000de:	c1 e6 09             	shl    $0x9,%esi
+  8000e1:	01 de                	add    %ebx,%esi
+	outb(0x177, 0x20);	// CMD 0x20 means read sector
+
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8000e3:	39 de                	cmp    %ebx,%esi
+  8000e5:	74 3b                	je     800122 <ide_read+0xaa>
+		if ((r = ide_wait_ready(1)) < 0)
+  8000e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ec:	e8 42 ff ff ff       	call   800033 <ide_wait_ready>
+  8000f1:	85 c0                	test   %eax,%eax
+  8000f3:	78 32                	js     800127 <ide_read+0xaf>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+  8000f5:	89 df                	mov    %ebx,%edi
+  8000f7:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8000fc:	ba 70 01 00 00       	mov    $0x170,%edx
+  800101:	fc                   	cld
+  800102:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  800104:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  80010a:	eb d7                	jmp    8000e3 <ide_read+0x6b>
+	assert(nsecs <= 256);
+  80010c:	68 40 2f 80 00       	push   $0x802f40
+  800111:	68 4d 2f 80 00       	push   $0x802f4d
+  800116:	6a 2a                	push   $0x2a
+  800118:	68 62 2f 80 00       	push   $0x802f62
+  80011d:	e8 c4 03 00 00       	call   8004e6 <_panic>
+			return r;
+		insl(0x170, dst, SECTSIZE/4);
+	}
+
+	return 0;
+  800122:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80012a:	5b                   	pop    %ebx
+  80012b:	5e                   	pop    %esi
+  80012c:	5f                   	pop    %edi
+  80012d:	5d                   	pop    %ebp
+  80012e:	c3                   	ret
+
+0080012f <check_format>:
+    uint32_t byterate;
+    uint16_t blockalign;
+    uint16_t bitespersample;
+};
+
+void check_format(struct fmt *w) {
+  80012f:	55                   	push   %ebp
+  800130:	89 e5                	mov    %esp,%ebp
+  800132:	83 ec 08             	sub    $0x8,%esp
+  800135:	8b 45 08             	mov    0x8(%ebp),%eax
+    if (w->samplerate != 44100) panic("sample rate invalid");
+  800138:	81 78 0c 44 ac 00 00 	cmpl   $0xac44,0xc(%eax)
+  80013f:	75 17                	jne    800158 <check_format+0x29>
+    if (w->numchannels != 1) panic("more than one channel");
+  800141:	66 83 78 0a 01       	cmpw   $0x1,0xa(%eax)
+  800146:	75 24                	jne    80016c <check_format+0x3d>
+    if (w->bitespersample != 16) panic("must be 16 bits per sample");
+  800148:	66 83 78 16 10       	cmpw   $0x10,0x16(%eax)
+  80014d:	75 31                	jne    800180 <check_format+0x51>
+    if (w->audioformat != 1) panic("cannot handle compressed files");
+  80014f:	66 83 78 08 01       	cmpw   $0x1,0x8(%eax)
+  800154:	75 3e                	jne    800194 <check_format+0x65>
+}
+  800156:	c9                   	leave
+  800157:	c3                   	ret
+    if (w->samplerate != 44100) panic("sample rate invalid");
+  800158:	83 ec 04             	sub    $0x4,%esp
+  80015b:	68 6f 2f 80 00       	push   $0x802f6f
+  800160:	6a 60                	push   $0x60
+  800162:	68 62 2f 80 00       	push   $0x802f62
+  800167:	e8 7a 03 00 00       	call   8004e6 <_panic>
+    if (w->numchannels != 1) panic("more than one channel");
+  80016c:	83 ec 04             	sub    $0x4,%esp
+  80016f:	68 83 2f 80 00       	push   $0x802f83
+  800174:	6a 61                	push   $0x61
+  800176:	68 62 2f 80 00       	push   $0x802f62
+  80017b:	e8 66 03 00 00       	call   8004e6 <_panic>
+    if (w->bitespersample != 16) panic("must be 16 bits per sample");
+  800180:	83 ec 04             	sub    $0x4,%esp
+  800183:	68 99 2f 80 00       	push   $0x802f99
+  800188:	6a 62                	push   $0x62
+  80018a:	68 62 2f 80 00       	push   $0x802f62
+  80018f:	e8 52 03 00 00       	call   8004e6 <_panic>
+    if (w->audioformat != 1) panic("cannot handle compressed files");
+  800194:	83 ec 04             	sub    $0x4,%esp
+  800197:	68 e0 2f 80 00       	push   $0x802fe0
+  80019c:	6a 63                	push   $0x63
+  80019e:	68 62 2f 80 00       	push   $0x802f62
+  8001a3:	e8 3e 03 00 00       	call   8004e6 <_panic>
+
+008001a8 <print_chunk_id>:
+
+
+void print_chunk_id(struct chunk *c) {
+  8001a8:	55                   	push   %ebp
+  8001a9:	89 e5                	mov    %esp,%ebp
+  8001ab:	53                   	push   %ebx
+  8001ac:	83 ec 10             	sub    $0x10,%esp
+  8001af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    cprintf("chunk id: ");
+  8001b2:	68 b4 2f 80 00       	push   $0x802fb4
+  8001b7:	e8 05 04 00 00       	call   8005c1 <cprintf>
+    cprintf("%c", (char) (c->chunkid >> 0) & 0xFF);
+  8001bc:	83 c4 08             	add    $0x8,%esp
+  8001bf:	0f b6 03             	movzbl (%ebx),%eax
+  8001c2:	50                   	push   %eax
+  8001c3:	68 bf 2f 80 00       	push   $0x802fbf
+  8001c8:	e8 f4 03 00 00       	call   8005c1 <cprintf>
+    cprintf("%c", (char) (c->chunkid >> 8) & 0xFF);
+  8001cd:	83 c4 08             	add    $0x8,%esp
+  8001d0:	8b 03                	mov    (%ebx),%eax
+  8001d2:	0f b6 c4             	movzbl %ah,%eax
+  8001d5:	50                   	push   %eax
+  8001d6:	68 bf 2f 80 00       	push   $0x802fbf
+  8001db:	e8 e1 03 00 00       	call   8005c1 <cprintf>
+    cprintf("%c", (char) (c->chunkid >> 16) & 0xFF);
+  8001e0:	83 c4 08             	add    $0x8,%esp
+  8001e3:	0f b6 43 02          	movzbl 0x2(%ebx),%eax
+  8001e7:	50                   	push   %eax
+  8001e8:	68 bf 2f 80 00       	push   $0x802fbf
+  8001ed:	e8 cf 03 00 00       	call   8005c1 <cprintf>
+    cprintf("%c ", (char) (c->chunkid >> 24) & 0xFF);
+  8001f2:	83 c4 08             	add    $0x8,%esp
+  8001f5:	8b 03                	mov    (%ebx),%eax
+  8001f7:	c1 e8 18             	shr    $0x18,%eax
+  8001fa:	50                   	push   %eax
+  8001fb:	68 c2 2f 80 00       	push   $0x802fc2
+  800200:	e8 bc 03 00 00       	call   8005c1 <cprintf>
+    cprintf("(%x)\n", c->chunkid);
+  800205:	83 c4 08             	add    $0x8,%esp
+  800208:	ff 33                	push   (%ebx)
+  80020a:	68 c6 2f 80 00       	push   $0x802fc6
+  80020f:	e8 ad 03 00 00       	call   8005c1 <cprintf>
+    
+}
+  800214:	83 c4 10             	add    $0x10,%esp
+  800217:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80021a:	c9                   	leave
+  80021b:	c3                   	ret
+
+0080021c <next_chunk>:
+
+void next_chunk(struct chunk **c) {
+  80021c:	55                   	push   %ebp
+  80021d:	89 e5                	mov    %esp,%ebp
+  80021f:	8b 45 08             	mov    0x8(%ebp),%eax
+    *c = (struct chunk *)((int8_t *)(*c) + ((*c)->chunksize + sizeof(struct chunk)));
+  800222:	8b 10                	mov    (%eax),%edx
+  800224:	8b 4a 04             	mov    0x4(%edx),%ecx
+  800227:	8d 54 0a 08          	lea    0x8(%edx,%ecx,1),%edx
+  80022b:	89 10                	mov    %edx,(%eax)
+}
+  80022d:	5d                   	pop    %ebp
+  80022e:	c3                   	ret
+
+0080022f <umain>:
+#define BUFFER_SIZE (1 << 15)
+int16_t b[BUFFER_SIZE];
+
+void
+umain(int argc, char **argv)
+{
+  80022f:	55                   	push   %ebp
+  800230:	89 e5                	mov    %esp,%ebp
+  800232:	56                   	push   %esi
+  800233:	53                   	push   %ebx
+    int i, numsect, numsamples;
+    
+    cprintf("############################### AUDIO SERVER START ###############################\n");
+  800234:	83 ec 0c             	sub    $0xc,%esp
+  800237:	68 00 30 80 00       	push   $0x803000
+  80023c:	e8 80 03 00 00       	call   8005c1 <cprintf>
+  800241:	83 c4 10             	add    $0x10,%esp
+    // Construct square wave
+    for (i = 0; i < BUFFER_SIZE; i++) {
+  800244:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if ((i /200) % 2) b[i] = 0xFFF;
+  800249:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+  80024e:	89 c8                	mov    %ecx,%eax
+  800250:	f7 eb                	imul   %ebx
+  800252:	c1 fa 06             	sar    $0x6,%edx
+  800255:	89 c8                	mov    %ecx,%eax
+  800257:	c1 f8 1f             	sar    $0x1f,%eax
+  80025a:	29 c2                	sub    %eax,%edx
+  80025c:	83 e2 01             	and    $0x1,%edx
+  80025f:	83 fa 01             	cmp    $0x1,%edx
+  800262:	19 c0                	sbb    %eax,%eax
+  800264:	66 25 02 e0          	and    $0xe002,%ax
+  800268:	66 05 ff 0f          	add    $0xfff,%ax
+  80026c:	66 89 84 09 20 50 80 	mov    %ax,0x2805020(%ecx,%ecx,1)
+  800273:	02 
+    for (i = 0; i < BUFFER_SIZE; i++) {
+  800274:	83 c1 01             	add    $0x1,%ecx
+  800277:	81 f9 00 80 00 00    	cmp    $0x8000,%ecx
+  80027d:	75 cf                	jne    80024e <umain+0x1f>
+        else b[i] = -0xFFF;
+    }
+    
+    // play the square wave (beep). Blocks until done.
+    sys_sb16_play(b, BUFFER_SIZE);
+  80027f:	83 ec 08             	sub    $0x8,%esp
+  800282:	68 00 80 00 00       	push   $0x8000
+  800287:	68 20 50 80 02       	push   $0x2805020
+  80028c:	e8 9c 18 00 00       	call   801b2d <sys_sb16_play>
+    
+    
+    // Read first sector of HDC, verify the wav file
+    ide_read(0, b, 1);
+  800291:	83 c4 0c             	add    $0xc,%esp
+  800294:	6a 01                	push   $0x1
+  800296:	68 20 50 80 02       	push   $0x2805020
+  80029b:	6a 00                	push   $0x0
+  80029d:	e8 d6 fd ff ff       	call   800078 <ide_read>
+    if (AS_CHUNKP(b)->chunkid != RIFF_CHUNK_ID)
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	81 3d 20 50 80 02 52 	cmpl   $0x46464952,0x2805020
+  8002ac:	49 46 46 
+  8002af:	75 47                	jne    8002f8 <umain+0xc9>
+        panic("hdc does not contain a valid wav file!");
+    
+    // Get wav file length
+    numsect = ROUNDUP(((struct chunk *) b)->chunksize, SECTSIZE) / SECTSIZE;
+  8002b1:	a1 24 50 80 02       	mov    0x2805024,%eax
+  8002b6:	05 ff 01 00 00       	add    $0x1ff,%eax
+  8002bb:	89 c6                	mov    %eax,%esi
+  8002bd:	c1 ee 09             	shr    $0x9,%esi
+    cprintf("WAV file size: %d sectors (%d mb)\n", numsect, (numsect * SECTSIZE) >> 20);
+  8002c0:	83 ec 04             	sub    $0x4,%esp
+  8002c3:	c1 f8 14             	sar    $0x14,%eax
+  8002c6:	50                   	push   %eax
+  8002c7:	56                   	push   %esi
+  8002c8:	68 7c 30 80 00       	push   $0x80307c
+  8002cd:	e8 ef 02 00 00       	call   8005c1 <cprintf>
+    if (WAV_BUFFER_SIZE < ((struct chunk *) b)->chunksize)
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	81 3d 24 50 80 02 00 	cmpl   $0x2000000,0x2805024
+  8002dc:	00 00 02 
+  8002df:	77 2e                	ja     80030f <umain+0xe0>
+        panic("wav file is too big");
+    
+    // Copy the wav file to the big buffer
+    cprintf("Copying WAV file to memory...\n");
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	68 a0 30 80 00       	push   $0x8030a0
+  8002e9:	e8 d3 02 00 00       	call   8005c1 <cprintf>
+    for (i = 0; i < numsect; i++)
+  8002ee:	83 c4 10             	add    $0x10,%esp
+  8002f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f6:	eb 4b                	jmp    800343 <umain+0x114>
+        panic("hdc does not contain a valid wav file!");
+  8002f8:	83 ec 04             	sub    $0x4,%esp
+  8002fb:	68 54 30 80 00       	push   $0x803054
+  800300:	68 8d 00 00 00       	push   $0x8d
+  800305:	68 62 2f 80 00       	push   $0x802f62
+  80030a:	e8 d7 01 00 00       	call   8004e6 <_panic>
+        panic("wav file is too big");
+  80030f:	83 ec 04             	sub    $0x4,%esp
+  800312:	68 cc 2f 80 00       	push   $0x802fcc
+  800317:	68 93 00 00 00       	push   $0x93
+  80031c:	68 62 2f 80 00       	push   $0x802f62
+  800321:	e8 c0 01 00 00       	call   8004e6 <_panic>
+        ide_read(i, wavhead + i * SECTSIZE, 1);
+  800326:	83 ec 04             	sub    $0x4,%esp
+  800329:	6a 01                	push   $0x1
+  80032b:	89 d8                	mov    %ebx,%eax
+  80032d:	c1 e0 09             	shl    $0x9,%eax
+  800330:	03 05 00 40 80 00    	add    0x804000,%eax
+  800336:	50                   	push   %eax
+  800337:	53                   	push   %ebx
+  800338:	e8 3b fd ff ff       	call   800078 <ide_read>
+    for (i = 0; i < numsect; i++)
+  80033d:	83 c3 01             	add    $0x1,%ebx
+  800340:	83 c4 10             	add    $0x10,%esp
+  800343:	39 f3                	cmp    %esi,%ebx
+  800345:	7c df                	jl     800326 <umain+0xf7>
+    
+    // Procceed to the fmt subchunk
+    cprintf("Copying complete. Locating 'fmt' subchunk..\n");
+  800347:	83 ec 0c             	sub    $0xc,%esp
+  80034a:	68 c0 30 80 00       	push   $0x8030c0
+  80034f:	e8 6d 02 00 00       	call   8005c1 <cprintf>
+    wavhead = AS_BYTEP(wavbuff) + 12; // strip RIFF header (it has 3 fields of 32bits each)
+  800354:	c7 05 00 40 80 00 2c 	movl   $0x80502c,0x804000
+  80035b:	50 80 00 
+    while (AS_CHUNKP(wavhead)->chunkid != FMT_CHUNK_ID) {
+  80035e:	83 c4 10             	add    $0x10,%esp
+  800361:	eb 10                	jmp    800373 <umain+0x144>
+        next_chunk((struct chunk **)(&wavhead));
+  800363:	83 ec 0c             	sub    $0xc,%esp
+  800366:	68 00 40 80 00       	push   $0x804000
+  80036b:	e8 ac fe ff ff       	call   80021c <next_chunk>
+  800370:	83 c4 10             	add    $0x10,%esp
+    while (AS_CHUNKP(wavhead)->chunkid != FMT_CHUNK_ID) {
+  800373:	a1 00 40 80 00       	mov    0x804000,%eax
+  800378:	81 38 66 6d 74 20    	cmpl   $0x20746d66,(%eax)
+  80037e:	75 e3                	jne    800363 <umain+0x134>
+    }
+    
+    // Validate fmt subchunk
+    cprintf("Found 'fmt' subchunk. Validating...\n");
+  800380:	83 ec 0c             	sub    $0xc,%esp
+  800383:	68 f0 30 80 00       	push   $0x8030f0
+  800388:	e8 34 02 00 00       	call   8005c1 <cprintf>
+    check_format(AS_FMTP(wavhead));
+  80038d:	83 c4 04             	add    $0x4,%esp
+  800390:	ff 35 00 40 80 00    	push   0x804000
+  800396:	e8 94 fd ff ff       	call   80012f <check_format>
+    
+    // Procceed to data subchunk
+    cprintf("Format is good. Locating 'data' subchunk...\n");
+  80039b:	c7 04 24 18 31 80 00 	movl   $0x803118,(%esp)
+  8003a2:	e8 1a 02 00 00       	call   8005c1 <cprintf>
+    while (AS_CHUNKP(wavhead)->chunkid != DATA_CHUNK_ID) {
+  8003a7:	83 c4 10             	add    $0x10,%esp
+  8003aa:	eb 10                	jmp    8003bc <umain+0x18d>
+        next_chunk((struct chunk **)(&wavhead));
+  8003ac:	83 ec 0c             	sub    $0xc,%esp
+  8003af:	68 00 40 80 00       	push   $0x804000
+  8003b4:	e8 63 fe ff ff       	call   80021c <next_chunk>
+  8003b9:	83 c4 10             	add    $0x10,%esp
+    while (AS_CHUNKP(wavhead)->chunkid != DATA_CHUNK_ID) {
+  8003bc:	a1 00 40 80 00       	mov    0x804000,%eax
+  8003c1:	81 38 64 61 74 61    	cmpl   $0x61746164,(%eax)
+  8003c7:	75 e3                	jne    8003ac <umain+0x17d>
+    }
+    
+    // Read the length of the data
+    numsamples = AS_CHUNKP(wavhead)->chunksize / 2;
+  8003c9:	8b 40 04             	mov    0x4(%eax),%eax
+  8003cc:	89 c3                	mov    %eax,%ebx
+  8003ce:	d1 eb                	shr    %ebx
+    cprintf("Located data chunk. PCM data length: %dB\n", (numsamples * 2));
+  8003d0:	83 ec 08             	sub    $0x8,%esp
+  8003d3:	83 e0 fe             	and    $0xfffffffe,%eax
+  8003d6:	50                   	push   %eax
+  8003d7:	68 48 31 80 00       	push   $0x803148
+  8003dc:	e8 e0 01 00 00       	call   8005c1 <cprintf>
+    
+    // Play!
+    wavhead += 8; // Strip data chunk header (8 bytes)
+  8003e1:	a1 00 40 80 00       	mov    0x804000,%eax
+  8003e6:	83 c0 08             	add    $0x8,%eax
+  8003e9:	a3 00 40 80 00       	mov    %eax,0x804000
+    cprintf("Starting playback from %x, playing %d samples\n", wavhead, numsamples);
+  8003ee:	83 c4 0c             	add    $0xc,%esp
+  8003f1:	53                   	push   %ebx
+  8003f2:	50                   	push   %eax
+  8003f3:	68 74 31 80 00       	push   $0x803174
+  8003f8:	e8 c4 01 00 00       	call   8005c1 <cprintf>
+    sys_sb16_play((int16_t *) wavhead, numsamples);
+  8003fd:	83 c4 08             	add    $0x8,%esp
+  800400:	53                   	push   %ebx
+  800401:	ff 35 00 40 80 00    	push   0x804000
+  800407:	e8 21 17 00 00       	call   801b2d <sys_sb16_play>
+    
+    cprintf("############################### AUDIO SERVER FINISHED ###############################\n");
+  80040c:	c7 04 24 a4 31 80 00 	movl   $0x8031a4,(%esp)
+  800413:	e8 a9 01 00 00       	call   8005c1 <cprintf>
+    
+    return;
+  800418:	83 c4 10             	add    $0x10,%esp
+}
+  80041b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80041e:	5b                   	pop    %ebx
+  80041f:	5e                   	pop    %esi
+  800420:	5d                   	pop    %ebp
+  800421:	c3                   	ret
+
+00800422 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800422:	55                   	push   %ebp
+  800423:	89 e5                	mov    %esp,%ebp
+  800425:	57                   	push   %edi
+  800426:	56                   	push   %esi
+  800427:	53                   	push   %ebx
+  800428:	83 ec 0c             	sub    $0xc,%esp
+  80042b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80042e:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800431:	b8 01 00 00 00       	mov    $0x1,%eax
+  800436:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800438:	c1 ea 0b             	shr    $0xb,%edx
+  80043b:	83 f2 01             	xor    $0x1,%edx
+  80043e:	83 e2 01             	and    $0x1,%edx
+  800441:	88 15 24 50 81 02    	mov    %dl,0x2815024
+
+	mainenv = NULL;
+  800447:	c7 05 20 50 81 02 00 	movl   $0x0,0x2815020
+  80044e:	00 00 00 
+	envid = sys_getenvid();
+  800451:	e8 1f 0c 00 00       	call   801075 <sys_getenvid>
+  800456:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800458:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80045d:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800463:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800469:	8b 52 48             	mov    0x48(%edx),%edx
+  80046c:	39 ca                	cmp    %ecx,%edx
+  80046e:	74 27                	je     800497 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800470:	83 c0 01             	add    $0x1,%eax
+  800473:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800478:	75 e3                	jne    80045d <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80047a:	83 3d 20 50 81 02 00 	cmpl   $0x0,0x2815020
+  800481:	75 24                	jne    8004a7 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800483:	83 ec 04             	sub    $0x4,%esp
+  800486:	68 fc 31 80 00       	push   $0x8031fc
+  80048b:	6a 23                	push   $0x23
+  80048d:	68 1f 32 80 00       	push   $0x80321f
+  800492:	e8 4f 00 00 00       	call   8004e6 <_panic>
+			mainenv = &envs[i];
+  800497:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80049d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004a2:	a3 20 50 81 02       	mov    %eax,0x2815020
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004a7:	85 ff                	test   %edi,%edi
+  8004a9:	7e 07                	jle    8004b2 <libmain+0x90>
+		binaryname = argv[0];
+  8004ab:	8b 06                	mov    (%esi),%eax
+  8004ad:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  8004b2:	83 ec 08             	sub    $0x8,%esp
+  8004b5:	56                   	push   %esi
+  8004b6:	57                   	push   %edi
+  8004b7:	e8 73 fd ff ff       	call   80022f <umain>
+
+	// exit gracefully
+	exit();
+  8004bc:	e8 0b 00 00 00       	call   8004cc <exit>
+}
+  8004c1:	83 c4 10             	add    $0x10,%esp
+  8004c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c7:	5b                   	pop    %ebx
+  8004c8:	5e                   	pop    %esi
+  8004c9:	5f                   	pop    %edi
+  8004ca:	5d                   	pop    %ebp
+  8004cb:	c3                   	ret
+
+008004cc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004cc:	55                   	push   %ebp
+  8004cd:	89 e5                	mov    %esp,%ebp
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8004d2:	e8 94 18 00 00       	call   801d6b <close_all>
+	sys_env_destroy(0);
+  8004d7:	83 ec 0c             	sub    $0xc,%esp
+  8004da:	6a 00                	push   $0x0
+  8004dc:	e8 2b 0b 00 00       	call   80100c <sys_env_destroy>
+}
+  8004e1:	83 c4 10             	add    $0x10,%esp
+  8004e4:	c9                   	leave
+  8004e5:	c3                   	ret
+
+008004e6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004e6:	55                   	push   %ebp
+  8004e7:	89 e5                	mov    %esp,%ebp
+  8004e9:	56                   	push   %esi
+  8004ea:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004eb:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004ee:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8004f4:	e8 7c 0b 00 00       	call   801075 <sys_getenvid>
+  8004f9:	83 ec 0c             	sub    $0xc,%esp
+  8004fc:	ff 75 0c             	push   0xc(%ebp)
+  8004ff:	ff 75 08             	push   0x8(%ebp)
+  800502:	56                   	push   %esi
+  800503:	50                   	push   %eax
+  800504:	68 38 32 80 00       	push   $0x803238
+  800509:	e8 b3 00 00 00       	call   8005c1 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80050e:	83 c4 18             	add    $0x18,%esp
+  800511:	53                   	push   %ebx
+  800512:	ff 75 10             	push   0x10(%ebp)
+  800515:	e8 56 00 00 00       	call   800570 <vcprintf>
+	cprintf("\n");
+  80051a:	c7 04 24 ca 2f 80 00 	movl   $0x802fca,(%esp)
+  800521:	e8 9b 00 00 00       	call   8005c1 <cprintf>
+  800526:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800529:	cc                   	int3
+	while (1)
+  80052a:	eb fd                	jmp    800529 <_panic+0x43>
+
+0080052c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80052c:	55                   	push   %ebp
+  80052d:	89 e5                	mov    %esp,%ebp
+  80052f:	53                   	push   %ebx
+  800530:	83 ec 04             	sub    $0x4,%esp
+  800533:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800536:	8b 13                	mov    (%ebx),%edx
+  800538:	8d 42 01             	lea    0x1(%edx),%eax
+  80053b:	89 03                	mov    %eax,(%ebx)
+  80053d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800540:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800544:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800549:	74 09                	je     800554 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80054b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80054f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800552:	c9                   	leave
+  800553:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800554:	83 ec 08             	sub    $0x8,%esp
+  800557:	68 ff 00 00 00       	push   $0xff
+  80055c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80055f:	50                   	push   %eax
+  800560:	e8 1d 0a 00 00       	call   800f82 <sys_cputs>
+		b->idx = 0;
+  800565:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80056b:	83 c4 10             	add    $0x10,%esp
+  80056e:	eb db                	jmp    80054b <putch+0x1f>
+
+00800570 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800570:	55                   	push   %ebp
+  800571:	89 e5                	mov    %esp,%ebp
+  800573:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800579:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800580:	00 00 00 
+	b.cnt = 0;
+  800583:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80058a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80058d:	ff 75 0c             	push   0xc(%ebp)
+  800590:	ff 75 08             	push   0x8(%ebp)
+  800593:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800599:	50                   	push   %eax
+  80059a:	68 2c 05 80 00       	push   $0x80052c
+  80059f:	e8 fb 00 00 00       	call   80069f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005a4:	83 c4 08             	add    $0x8,%esp
+  8005a7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005ad:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005b3:	50                   	push   %eax
+  8005b4:	e8 c9 09 00 00       	call   800f82 <sys_cputs>
+
+	return b.cnt;
+}
+  8005b9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005bf:	c9                   	leave
+  8005c0:	c3                   	ret
+
+008005c1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005c1:	55                   	push   %ebp
+  8005c2:	89 e5                	mov    %esp,%ebp
+  8005c4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005c7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005ca:	50                   	push   %eax
+  8005cb:	ff 75 08             	push   0x8(%ebp)
+  8005ce:	e8 9d ff ff ff       	call   800570 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005d3:	c9                   	leave
+  8005d4:	c3                   	ret
+
+008005d5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8005d5:	55                   	push   %ebp
+  8005d6:	89 e5                	mov    %esp,%ebp
+  8005d8:	57                   	push   %edi
+  8005d9:	56                   	push   %esi
+  8005da:	53                   	push   %ebx
+  8005db:	83 ec 1c             	sub    $0x1c,%esp
+  8005de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005e1:	89 d6                	mov    %edx,%esi
+  8005e3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8005e6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005e9:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8005ec:	73 0b                	jae    8005f9 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8005ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8005f1:	c1 e7 08             	shl    $0x8,%edi
+  8005f4:	0b 7d 10             	or     0x10(%ebp),%edi
+  8005f7:	eb 36                	jmp    80062f <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8005f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800601:	f7 75 08             	divl   0x8(%ebp)
+  800604:	89 c1                	mov    %eax,%ecx
+  800606:	ff 75 14             	push   0x14(%ebp)
+  800609:	ff 75 10             	push   0x10(%ebp)
+  80060c:	83 eb 01             	sub    $0x1,%ebx
+  80060f:	53                   	push   %ebx
+  800610:	ff 75 08             	push   0x8(%ebp)
+  800613:	89 f2                	mov    %esi,%edx
+  800615:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800618:	e8 b8 ff ff ff       	call   8005d5 <printnum>
+  80061d:	83 c4 10             	add    $0x10,%esp
+  800620:	eb 14                	jmp    800636 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800622:	83 ec 08             	sub    $0x8,%esp
+  800625:	56                   	push   %esi
+  800626:	57                   	push   %edi
+  800627:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80062a:	ff d0                	call   *%eax
+  80062c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80062f:	83 eb 01             	sub    $0x1,%ebx
+  800632:	85 db                	test   %ebx,%ebx
+  800634:	7f ec                	jg     800622 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800636:	83 ec 08             	sub    $0x8,%esp
+  800639:	56                   	push   %esi
+  80063a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80063d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800642:	f7 75 08             	divl   0x8(%ebp)
+  800645:	0f be 92 5b 32 80 00 	movsbl 0x80325b(%edx),%edx
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	c1 e0 08             	shl    $0x8,%eax
+  800652:	09 d0                	or     %edx,%eax
+  800654:	50                   	push   %eax
+  800655:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800658:	ff d0                	call   *%eax
+}
+  80065a:	83 c4 10             	add    $0x10,%esp
+  80065d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800660:	5b                   	pop    %ebx
+  800661:	5e                   	pop    %esi
+  800662:	5f                   	pop    %edi
+  800663:	5d                   	pop    %ebp
+  800664:	c3                   	ret
+
+00800665 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800665:	55                   	push   %ebp
+  800666:	89 e5                	mov    %esp,%ebp
+  800668:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80066b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	3b 50 04             	cmp    0x4(%eax),%edx
+  800674:	73 0a                	jae    800680 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800676:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800679:	89 08                	mov    %ecx,(%eax)
+  80067b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80067e:	88 02                	mov    %al,(%edx)
+}
+  800680:	5d                   	pop    %ebp
+  800681:	c3                   	ret
+
+00800682 <printfmt>:
+{
+  800682:	55                   	push   %ebp
+  800683:	89 e5                	mov    %esp,%ebp
+  800685:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800688:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80068b:	50                   	push   %eax
+  80068c:	ff 75 10             	push   0x10(%ebp)
+  80068f:	ff 75 0c             	push   0xc(%ebp)
+  800692:	ff 75 08             	push   0x8(%ebp)
+  800695:	e8 05 00 00 00       	call   80069f <vprintfmt>
+}
+  80069a:	83 c4 10             	add    $0x10,%esp
+  80069d:	c9                   	leave
+  80069e:	c3                   	ret
+
+0080069f <vprintfmt>:
+{
+  80069f:	55                   	push   %ebp
+  8006a0:	89 e5                	mov    %esp,%ebp
+  8006a2:	57                   	push   %edi
+  8006a3:	56                   	push   %esi
+  8006a4:	53                   	push   %ebx
+  8006a5:	83 ec 3c             	sub    $0x3c,%esp
+  8006a8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006ab:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8006ae:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8006b5:	eb 16                	jmp    8006cd <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	ff 75 0c             	push   0xc(%ebp)
+  8006bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8006c0:	c1 e2 08             	shl    $0x8,%edx
+  8006c3:	09 d0                	or     %edx,%eax
+  8006c5:	50                   	push   %eax
+  8006c6:	ff d7                	call   *%edi
+  8006c8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006cb:	89 de                	mov    %ebx,%esi
+  8006cd:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8006d0:	0f b6 06             	movzbl (%esi),%eax
+  8006d3:	83 f8 25             	cmp    $0x25,%eax
+  8006d6:	74 0c                	je     8006e4 <vprintfmt+0x45>
+			if (ch == '\0')
+  8006d8:	85 c0                	test   %eax,%eax
+  8006da:	75 db                	jne    8006b7 <vprintfmt+0x18>
+}
+  8006dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006df:	5b                   	pop    %ebx
+  8006e0:	5e                   	pop    %esi
+  8006e1:	5f                   	pop    %edi
+  8006e2:	5d                   	pop    %ebp
+  8006e3:	c3                   	ret
+		padc = ' ';
+  8006e4:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8006e8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006ef:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8006f6:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8006fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800702:	8d 73 01             	lea    0x1(%ebx),%esi
+  800705:	0f b6 13             	movzbl (%ebx),%edx
+  800708:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80070b:	3c 55                	cmp    $0x55,%al
+  80070d:	0f 87 2c 04 00 00    	ja     800b3f <vprintfmt+0x4a0>
+  800713:	0f b6 c0             	movzbl %al,%eax
+  800716:	ff 24 85 a0 33 80 00 	jmp    *0x8033a0(,%eax,4)
+  80071d:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80071f:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800723:	eb dd                	jmp    800702 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800725:	89 f3                	mov    %esi,%ebx
+  800727:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80072b:	eb d5                	jmp    800702 <vprintfmt+0x63>
+  80072d:	0f b6 d2             	movzbl %dl,%edx
+  800730:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800732:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800737:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80073a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80073e:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800741:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800744:	83 fe 09             	cmp    $0x9,%esi
+  800747:	0f 87 8a 00 00 00    	ja     8007d7 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80074d:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800750:	eb e5                	jmp    800737 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800752:	8b 45 14             	mov    0x14(%ebp),%eax
+  800755:	8b 00                	mov    (%eax),%eax
+  800757:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80075a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075d:	8d 40 04             	lea    0x4(%eax),%eax
+  800760:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800763:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800765:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800769:	79 97                	jns    800702 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80076b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80076e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800771:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800778:	eb 88                	jmp    800702 <vprintfmt+0x63>
+			if (width < 0)
+  80077a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80077d:	85 db                	test   %ebx,%ebx
+  80077f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800784:	0f 49 c3             	cmovns %ebx,%eax
+  800787:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80078a:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80078c:	e9 71 ff ff ff       	jmp    800702 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800791:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800793:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80079a:	e9 63 ff ff ff       	jmp    800702 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80079f:	8d 73 02             	lea    0x2(%ebx),%esi
+  8007a2:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8007a6:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8007ad:	3c 67                	cmp    $0x67,%al
+  8007af:	0f 84 18 ff ff ff    	je     8006cd <vprintfmt+0x2e>
+					attrib = 0x04;
+  8007b5:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8007bc:	3c 72                	cmp    $0x72,%al
+  8007be:	0f 84 09 ff ff ff    	je     8006cd <vprintfmt+0x2e>
+					attrib = 0x00;
+  8007c4:	3c 62                	cmp    $0x62,%al
+  8007c6:	0f 94 c0             	sete   %al
+  8007c9:	0f b6 c0             	movzbl %al,%eax
+  8007cc:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8007cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007d2:	e9 f6 fe ff ff       	jmp    8006cd <vprintfmt+0x2e>
+  8007d7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007da:	eb 89                	jmp    800765 <vprintfmt+0xc6>
+			lflag++;
+  8007dc:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007df:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8007e1:	e9 1c ff ff ff       	jmp    800702 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8d 58 04             	lea    0x4(%eax),%ebx
+  8007ec:	83 ec 08             	sub    $0x8,%esp
+  8007ef:	ff 75 0c             	push   0xc(%ebp)
+  8007f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007f5:	c1 e0 08             	shl    $0x8,%eax
+  8007f8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007fb:	0b 01                	or     (%ecx),%eax
+  8007fd:	50                   	push   %eax
+  8007fe:	ff d7                	call   *%edi
+			break;
+  800800:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800803:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800806:	e9 c2 fe ff ff       	jmp    8006cd <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80080b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080e:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800811:	8b 10                	mov    (%eax),%edx
+  800813:	89 d0                	mov    %edx,%eax
+  800815:	f7 d8                	neg    %eax
+  800817:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80081a:	83 f8 12             	cmp    $0x12,%eax
+  80081d:	7f 25                	jg     800844 <vprintfmt+0x1a5>
+  80081f:	8b 14 85 00 35 80 00 	mov    0x803500(,%eax,4),%edx
+  800826:	85 d2                	test   %edx,%edx
+  800828:	74 1a                	je     800844 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80082a:	52                   	push   %edx
+  80082b:	68 5f 2f 80 00       	push   $0x802f5f
+  800830:	ff 75 0c             	push   0xc(%ebp)
+  800833:	57                   	push   %edi
+  800834:	e8 49 fe ff ff       	call   800682 <printfmt>
+  800839:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80083c:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80083f:	e9 89 fe ff ff       	jmp    8006cd <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800844:	50                   	push   %eax
+  800845:	68 73 32 80 00       	push   $0x803273
+  80084a:	ff 75 0c             	push   0xc(%ebp)
+  80084d:	57                   	push   %edi
+  80084e:	e8 2f fe ff ff       	call   800682 <printfmt>
+  800853:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800856:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800859:	e9 6f fe ff ff       	jmp    8006cd <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80085e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800861:	83 c0 04             	add    $0x4,%eax
+  800864:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800867:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80086c:	85 c9                	test   %ecx,%ecx
+  80086e:	b8 6c 32 80 00       	mov    $0x80326c,%eax
+  800873:	0f 45 c1             	cmovne %ecx,%eax
+  800876:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800879:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80087d:	7e 06                	jle    800885 <vprintfmt+0x1e6>
+  80087f:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800883:	75 1a                	jne    80089f <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800885:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800888:	c1 e0 08             	shl    $0x8,%eax
+  80088b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80088e:	83 c8 3f             	or     $0x3f,%eax
+  800891:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800894:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800897:	89 75 10             	mov    %esi,0x10(%ebp)
+  80089a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80089d:	eb 6d                	jmp    80090c <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80089f:	83 ec 08             	sub    $0x8,%esp
+  8008a2:	ff 75 d0             	push   -0x30(%ebp)
+  8008a5:	ff 75 c8             	push   -0x38(%ebp)
+  8008a8:	e8 39 03 00 00       	call   800be6 <strnlen>
+  8008ad:	89 c2                	mov    %eax,%edx
+  8008af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008b2:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8008b4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8008b7:	c1 e1 08             	shl    $0x8,%ecx
+  8008ba:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8008be:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008c0:	83 c4 10             	add    $0x10,%esp
+  8008c3:	89 c3                	mov    %eax,%ebx
+  8008c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008c8:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008cb:	89 ce                	mov    %ecx,%esi
+  8008cd:	eb 0f                	jmp    8008de <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8008cf:	83 ec 08             	sub    $0x8,%esp
+  8008d2:	ff 75 0c             	push   0xc(%ebp)
+  8008d5:	56                   	push   %esi
+  8008d6:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008d8:	83 eb 01             	sub    $0x1,%ebx
+  8008db:	83 c4 10             	add    $0x10,%esp
+  8008de:	85 db                	test   %ebx,%ebx
+  8008e0:	7f ed                	jg     8008cf <vprintfmt+0x230>
+  8008e2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008e5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008e8:	85 c0                	test   %eax,%eax
+  8008ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008ef:	0f 49 d0             	cmovns %eax,%edx
+  8008f2:	29 d0                	sub    %edx,%eax
+  8008f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008f7:	eb 8c                	jmp    800885 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8008f9:	83 ec 08             	sub    $0x8,%esp
+  8008fc:	ff 75 0c             	push   0xc(%ebp)
+  8008ff:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800902:	09 c2                	or     %eax,%edx
+  800904:	52                   	push   %edx
+  800905:	ff d7                	call   *%edi
+  800907:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80090a:	89 d9                	mov    %ebx,%ecx
+  80090c:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80090f:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800913:	0f be d0             	movsbl %al,%edx
+  800916:	85 d2                	test   %edx,%edx
+  800918:	74 2a                	je     800944 <vprintfmt+0x2a5>
+  80091a:	85 f6                	test   %esi,%esi
+  80091c:	78 05                	js     800923 <vprintfmt+0x284>
+  80091e:	83 ee 01             	sub    $0x1,%esi
+  800921:	78 3b                	js     80095e <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800923:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800927:	74 d0                	je     8008f9 <vprintfmt+0x25a>
+  800929:	0f be c0             	movsbl %al,%eax
+  80092c:	83 e8 20             	sub    $0x20,%eax
+  80092f:	83 f8 5e             	cmp    $0x5e,%eax
+  800932:	76 c5                	jbe    8008f9 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800934:	83 ec 08             	sub    $0x8,%esp
+  800937:	ff 75 0c             	push   0xc(%ebp)
+  80093a:	ff 75 cc             	push   -0x34(%ebp)
+  80093d:	ff d7                	call   *%edi
+  80093f:	83 c4 10             	add    $0x10,%esp
+  800942:	eb c6                	jmp    80090a <vprintfmt+0x26b>
+  800944:	8b 75 10             	mov    0x10(%ebp),%esi
+  800947:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80094a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80094d:	01 c3                	add    %eax,%ebx
+  80094f:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800951:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800954:	83 c8 20             	or     $0x20,%eax
+  800957:	89 75 10             	mov    %esi,0x10(%ebp)
+  80095a:	89 c6                	mov    %eax,%esi
+  80095c:	eb 14                	jmp    800972 <vprintfmt+0x2d3>
+  80095e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800961:	eb e4                	jmp    800947 <vprintfmt+0x2a8>
+  800963:	83 ec 08             	sub    $0x8,%esp
+  800966:	ff 75 0c             	push   0xc(%ebp)
+  800969:	56                   	push   %esi
+  80096a:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80096c:	83 eb 01             	sub    $0x1,%ebx
+  80096f:	83 c4 10             	add    $0x10,%esp
+  800972:	85 db                	test   %ebx,%ebx
+  800974:	7f ed                	jg     800963 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800976:	8b 75 10             	mov    0x10(%ebp),%esi
+  800979:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80097c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097f:	e9 49 fd ff ff       	jmp    8006cd <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800984:	83 f9 01             	cmp    $0x1,%ecx
+  800987:	7f 1f                	jg     8009a8 <vprintfmt+0x309>
+	else if (lflag)
+  800989:	85 c9                	test   %ecx,%ecx
+  80098b:	74 69                	je     8009f6 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80098d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800990:	8b 00                	mov    (%eax),%eax
+  800992:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800995:	89 c1                	mov    %eax,%ecx
+  800997:	c1 f9 1f             	sar    $0x1f,%ecx
+  80099a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80099d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a6:	eb 17                	jmp    8009bf <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8009a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ab:	8b 50 04             	mov    0x4(%eax),%edx
+  8009ae:	8b 00                	mov    (%eax),%eax
+  8009b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009b3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8009b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b9:	8d 40 08             	lea    0x8(%eax),%eax
+  8009bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8009bf:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8009c2:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8009c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8009ca:	85 db                	test   %ebx,%ebx
+  8009cc:	0f 89 f6 00 00 00    	jns    800ac8 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8009d2:	83 ec 08             	sub    $0x8,%esp
+  8009d5:	ff 75 0c             	push   0xc(%ebp)
+  8009d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009db:	c1 e0 08             	shl    $0x8,%eax
+  8009de:	83 c8 2d             	or     $0x2d,%eax
+  8009e1:	50                   	push   %eax
+  8009e2:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8009e4:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8009e7:	f7 d9                	neg    %ecx
+  8009e9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009f1:	e9 d2 00 00 00       	jmp    800ac8 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8009f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f9:	8b 00                	mov    (%eax),%eax
+  8009fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009fe:	89 c1                	mov    %eax,%ecx
+  800a00:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a03:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a09:	8d 40 04             	lea    0x4(%eax),%eax
+  800a0c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a0f:	eb ae                	jmp    8009bf <vprintfmt+0x320>
+	if (lflag >= 2)
+  800a11:	83 f9 01             	cmp    $0x1,%ecx
+  800a14:	7f 19                	jg     800a2f <vprintfmt+0x390>
+	else if (lflag)
+  800a16:	85 c9                	test   %ecx,%ecx
+  800a18:	74 2a                	je     800a44 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800a1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1d:	8b 08                	mov    (%eax),%ecx
+  800a1f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a22:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a25:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800a2a:	e9 99 00 00 00       	jmp    800ac8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a32:	8b 08                	mov    (%eax),%ecx
+  800a34:	8d 40 08             	lea    0x8(%eax),%eax
+  800a37:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a3a:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800a3f:	e9 84 00 00 00       	jmp    800ac8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a44:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a47:	8b 08                	mov    (%eax),%ecx
+  800a49:	8d 40 04             	lea    0x4(%eax),%eax
+  800a4c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a4f:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800a54:	eb 72                	jmp    800ac8 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800a56:	83 f9 01             	cmp    $0x1,%ecx
+  800a59:	7f 16                	jg     800a71 <vprintfmt+0x3d2>
+	else if (lflag)
+  800a5b:	85 c9                	test   %ecx,%ecx
+  800a5d:	74 24                	je     800a83 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800a5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a62:	8b 08                	mov    (%eax),%ecx
+  800a64:	8d 40 04             	lea    0x4(%eax),%eax
+  800a67:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a6a:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800a6f:	eb 57                	jmp    800ac8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a74:	8b 08                	mov    (%eax),%ecx
+  800a76:	8d 40 08             	lea    0x8(%eax),%eax
+  800a79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a7c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800a81:	eb 45                	jmp    800ac8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a86:	8b 08                	mov    (%eax),%ecx
+  800a88:	8d 40 04             	lea    0x4(%eax),%eax
+  800a8b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a8e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800a93:	eb 33                	jmp    800ac8 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800a95:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a98:	c1 e3 08             	shl    $0x8,%ebx
+  800a9b:	83 ec 08             	sub    $0x8,%esp
+  800a9e:	ff 75 0c             	push   0xc(%ebp)
+  800aa1:	89 d8                	mov    %ebx,%eax
+  800aa3:	83 c8 30             	or     $0x30,%eax
+  800aa6:	50                   	push   %eax
+  800aa7:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800aa9:	83 c4 08             	add    $0x8,%esp
+  800aac:	ff 75 0c             	push   0xc(%ebp)
+  800aaf:	83 cb 78             	or     $0x78,%ebx
+  800ab2:	53                   	push   %ebx
+  800ab3:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800ab5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab8:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800aba:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800abd:	8d 40 04             	lea    0x4(%eax),%eax
+  800ac0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ac3:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800ac8:	ff 75 e4             	push   -0x1c(%ebp)
+  800acb:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800acf:	52                   	push   %edx
+  800ad0:	ff 75 e0             	push   -0x20(%ebp)
+  800ad3:	50                   	push   %eax
+  800ad4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad7:	89 f8                	mov    %edi,%eax
+  800ad9:	e8 f7 fa ff ff       	call   8005d5 <printnum>
+			break;
+  800ade:	83 c4 10             	add    $0x10,%esp
+  800ae1:	e9 e7 fb ff ff       	jmp    8006cd <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800ae6:	83 f9 01             	cmp    $0x1,%ecx
+  800ae9:	7f 16                	jg     800b01 <vprintfmt+0x462>
+	else if (lflag)
+  800aeb:	85 c9                	test   %ecx,%ecx
+  800aed:	74 24                	je     800b13 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800aef:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af2:	8b 08                	mov    (%eax),%ecx
+  800af4:	8d 40 04             	lea    0x4(%eax),%eax
+  800af7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800afa:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800aff:	eb c7                	jmp    800ac8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800b01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b04:	8b 08                	mov    (%eax),%ecx
+  800b06:	8d 40 08             	lea    0x8(%eax),%eax
+  800b09:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b0c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800b11:	eb b5                	jmp    800ac8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800b13:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b16:	8b 08                	mov    (%eax),%ecx
+  800b18:	8d 40 04             	lea    0x4(%eax),%eax
+  800b1b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b1e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800b23:	eb a3                	jmp    800ac8 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800b25:	83 ec 08             	sub    $0x8,%esp
+  800b28:	ff 75 0c             	push   0xc(%ebp)
+  800b2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b2e:	c1 e0 08             	shl    $0x8,%eax
+  800b31:	83 c8 25             	or     $0x25,%eax
+  800b34:	50                   	push   %eax
+  800b35:	ff d7                	call   *%edi
+			break;
+  800b37:	83 c4 10             	add    $0x10,%esp
+  800b3a:	e9 8e fb ff ff       	jmp    8006cd <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800b3f:	83 ec 08             	sub    $0x8,%esp
+  800b42:	ff 75 0c             	push   0xc(%ebp)
+  800b45:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b48:	c1 e0 08             	shl    $0x8,%eax
+  800b4b:	83 c8 25             	or     $0x25,%eax
+  800b4e:	50                   	push   %eax
+  800b4f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b51:	83 c4 10             	add    $0x10,%esp
+  800b54:	89 de                	mov    %ebx,%esi
+  800b56:	eb 03                	jmp    800b5b <vprintfmt+0x4bc>
+  800b58:	83 ee 01             	sub    $0x1,%esi
+  800b5b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800b5f:	75 f7                	jne    800b58 <vprintfmt+0x4b9>
+  800b61:	e9 67 fb ff ff       	jmp    8006cd <vprintfmt+0x2e>
+
+00800b66 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b66:	55                   	push   %ebp
+  800b67:	89 e5                	mov    %esp,%ebp
+  800b69:	83 ec 18             	sub    $0x18,%esp
+  800b6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b72:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b75:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b79:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b7c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b83:	85 c0                	test   %eax,%eax
+  800b85:	74 26                	je     800bad <vsnprintf+0x47>
+  800b87:	85 d2                	test   %edx,%edx
+  800b89:	7e 22                	jle    800bad <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b8b:	ff 75 14             	push   0x14(%ebp)
+  800b8e:	ff 75 10             	push   0x10(%ebp)
+  800b91:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b94:	50                   	push   %eax
+  800b95:	68 65 06 80 00       	push   $0x800665
+  800b9a:	e8 00 fb ff ff       	call   80069f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b9f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ba2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ba5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ba8:	83 c4 10             	add    $0x10,%esp
+}
+  800bab:	c9                   	leave
+  800bac:	c3                   	ret
+		return -E_INVAL;
+  800bad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb2:	eb f7                	jmp    800bab <vsnprintf+0x45>
+
+00800bb4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800bb4:	55                   	push   %ebp
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800bba:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800bbd:	50                   	push   %eax
+  800bbe:	ff 75 10             	push   0x10(%ebp)
+  800bc1:	ff 75 0c             	push   0xc(%ebp)
+  800bc4:	ff 75 08             	push   0x8(%ebp)
+  800bc7:	e8 9a ff ff ff       	call   800b66 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800bcc:	c9                   	leave
+  800bcd:	c3                   	ret
+
+00800bce <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd9:	eb 03                	jmp    800bde <strlen+0x10>
+		n++;
+  800bdb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800bde:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800be2:	75 f7                	jne    800bdb <strlen+0xd>
+	return n;
+}
+  800be4:	5d                   	pop    %ebp
+  800be5:	c3                   	ret
+
+00800be6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800be6:	55                   	push   %ebp
+  800be7:	89 e5                	mov    %esp,%ebp
+  800be9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf4:	eb 03                	jmp    800bf9 <strnlen+0x13>
+		n++;
+  800bf6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bf9:	39 d0                	cmp    %edx,%eax
+  800bfb:	74 08                	je     800c05 <strnlen+0x1f>
+  800bfd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c01:	75 f3                	jne    800bf6 <strnlen+0x10>
+  800c03:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800c05:	89 d0                	mov    %edx,%eax
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+
+00800c09 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	53                   	push   %ebx
+  800c0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c18:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c1c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c1f:	83 c0 01             	add    $0x1,%eax
+  800c22:	84 d2                	test   %dl,%dl
+  800c24:	75 f2                	jne    800c18 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c26:	89 c8                	mov    %ecx,%eax
+  800c28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c2b:	c9                   	leave
+  800c2c:	c3                   	ret
+
+00800c2d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	53                   	push   %ebx
+  800c31:	83 ec 10             	sub    $0x10,%esp
+  800c34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c37:	53                   	push   %ebx
+  800c38:	e8 91 ff ff ff       	call   800bce <strlen>
+  800c3d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c40:	ff 75 0c             	push   0xc(%ebp)
+  800c43:	01 d8                	add    %ebx,%eax
+  800c45:	50                   	push   %eax
+  800c46:	e8 be ff ff ff       	call   800c09 <strcpy>
+	return dst;
+}
+  800c4b:	89 d8                	mov    %ebx,%eax
+  800c4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c50:	c9                   	leave
+  800c51:	c3                   	ret
+
+00800c52 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	56                   	push   %esi
+  800c56:	53                   	push   %ebx
+  800c57:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c5d:	89 f3                	mov    %esi,%ebx
+  800c5f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c62:	89 f0                	mov    %esi,%eax
+  800c64:	eb 0f                	jmp    800c75 <strncpy+0x23>
+		*dst++ = *src;
+  800c66:	83 c0 01             	add    $0x1,%eax
+  800c69:	0f b6 0a             	movzbl (%edx),%ecx
+  800c6c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c6f:	80 f9 01             	cmp    $0x1,%cl
+  800c72:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c75:	39 d8                	cmp    %ebx,%eax
+  800c77:	75 ed                	jne    800c66 <strncpy+0x14>
+	}
+	return ret;
+}
+  800c79:	89 f0                	mov    %esi,%eax
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5d                   	pop    %ebp
+  800c7e:	c3                   	ret
+
+00800c7f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  800c84:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c8d:	89 f0                	mov    %esi,%eax
+  800c8f:	85 d2                	test   %edx,%edx
+  800c91:	74 21                	je     800cb4 <strlcpy+0x35>
+  800c93:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c97:	89 f2                	mov    %esi,%edx
+  800c99:	eb 09                	jmp    800ca4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c9b:	83 c1 01             	add    $0x1,%ecx
+  800c9e:	83 c2 01             	add    $0x1,%edx
+  800ca1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ca4:	39 c2                	cmp    %eax,%edx
+  800ca6:	74 09                	je     800cb1 <strlcpy+0x32>
+  800ca8:	0f b6 19             	movzbl (%ecx),%ebx
+  800cab:	84 db                	test   %bl,%bl
+  800cad:	75 ec                	jne    800c9b <strlcpy+0x1c>
+  800caf:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800cb1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800cb4:	29 f0                	sub    %esi,%eax
+}
+  800cb6:	5b                   	pop    %ebx
+  800cb7:	5e                   	pop    %esi
+  800cb8:	5d                   	pop    %ebp
+  800cb9:	c3                   	ret
+
+00800cba <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800cba:	55                   	push   %ebp
+  800cbb:	89 e5                	mov    %esp,%ebp
+  800cbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800cc3:	eb 06                	jmp    800ccb <strcmp+0x11>
+		p++, q++;
+  800cc5:	83 c1 01             	add    $0x1,%ecx
+  800cc8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ccb:	0f b6 01             	movzbl (%ecx),%eax
+  800cce:	84 c0                	test   %al,%al
+  800cd0:	74 04                	je     800cd6 <strcmp+0x1c>
+  800cd2:	3a 02                	cmp    (%edx),%al
+  800cd4:	74 ef                	je     800cc5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cd6:	0f b6 c0             	movzbl %al,%eax
+  800cd9:	0f b6 12             	movzbl (%edx),%edx
+  800cdc:	29 d0                	sub    %edx,%eax
+}
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+
+00800ce0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	53                   	push   %ebx
+  800ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cea:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ced:	eb 09                	jmp    800cf8 <strncmp+0x18>
+		n--, p++, q++;
+  800cef:	83 ea 01             	sub    $0x1,%edx
+  800cf2:	83 c0 01             	add    $0x1,%eax
+  800cf5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800cf8:	85 d2                	test   %edx,%edx
+  800cfa:	74 18                	je     800d14 <strncmp+0x34>
+  800cfc:	0f b6 18             	movzbl (%eax),%ebx
+  800cff:	84 db                	test   %bl,%bl
+  800d01:	74 04                	je     800d07 <strncmp+0x27>
+  800d03:	3a 19                	cmp    (%ecx),%bl
+  800d05:	74 e8                	je     800cef <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d07:	0f b6 00             	movzbl (%eax),%eax
+  800d0a:	0f b6 11             	movzbl (%ecx),%edx
+  800d0d:	29 d0                	sub    %edx,%eax
+}
+  800d0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d12:	c9                   	leave
+  800d13:	c3                   	ret
+		return 0;
+  800d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d19:	eb f4                	jmp    800d0f <strncmp+0x2f>
+
+00800d1b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d1b:	55                   	push   %ebp
+  800d1c:	89 e5                	mov    %esp,%ebp
+  800d1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d21:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d25:	eb 03                	jmp    800d2a <strchr+0xf>
+  800d27:	83 c0 01             	add    $0x1,%eax
+  800d2a:	0f b6 10             	movzbl (%eax),%edx
+  800d2d:	84 d2                	test   %dl,%dl
+  800d2f:	74 06                	je     800d37 <strchr+0x1c>
+		if (*s == c)
+  800d31:	38 ca                	cmp    %cl,%dl
+  800d33:	75 f2                	jne    800d27 <strchr+0xc>
+  800d35:	eb 05                	jmp    800d3c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+
+00800d3e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d44:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d48:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d4b:	38 ca                	cmp    %cl,%dl
+  800d4d:	74 09                	je     800d58 <strfind+0x1a>
+  800d4f:	84 d2                	test   %dl,%dl
+  800d51:	74 05                	je     800d58 <strfind+0x1a>
+	for (; *s; s++)
+  800d53:	83 c0 01             	add    $0x1,%eax
+  800d56:	eb f0                	jmp    800d48 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+
+00800d5a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	57                   	push   %edi
+  800d5e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d61:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d64:	85 c9                	test   %ecx,%ecx
+  800d66:	74 20                	je     800d88 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d68:	89 f8                	mov    %edi,%eax
+  800d6a:	09 c8                	or     %ecx,%eax
+  800d6c:	a8 03                	test   $0x3,%al
+  800d6e:	75 12                	jne    800d82 <memset+0x28>
+		c &= 0xFF;
+  800d70:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d74:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d7a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d7d:	fc                   	cld
+  800d7e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d80:	eb 06                	jmp    800d88 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d85:	fc                   	cld
+  800d86:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d88:	89 f8                	mov    %edi,%eax
+  800d8a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d8d:	c9                   	leave
+  800d8e:	c3                   	ret
+
+00800d8f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d97:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d9a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d9d:	39 c6                	cmp    %eax,%esi
+  800d9f:	73 32                	jae    800dd3 <memmove+0x44>
+  800da1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800da4:	39 d0                	cmp    %edx,%eax
+  800da6:	73 2b                	jae    800dd3 <memmove+0x44>
+		s += n;
+		d += n;
+  800da8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dab:	89 d6                	mov    %edx,%esi
+  800dad:	09 fe                	or     %edi,%esi
+  800daf:	09 ce                	or     %ecx,%esi
+  800db1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800db7:	75 0e                	jne    800dc7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800db9:	83 ef 04             	sub    $0x4,%edi
+  800dbc:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800dbf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800dc2:	fd                   	std
+  800dc3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dc5:	eb 09                	jmp    800dd0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dc7:	83 ef 01             	sub    $0x1,%edi
+  800dca:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800dcd:	fd                   	std
+  800dce:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dd0:	fc                   	cld
+  800dd1:	eb 1a                	jmp    800ded <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dd3:	89 f2                	mov    %esi,%edx
+  800dd5:	09 c2                	or     %eax,%edx
+  800dd7:	09 ca                	or     %ecx,%edx
+  800dd9:	f6 c2 03             	test   $0x3,%dl
+  800ddc:	75 0a                	jne    800de8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800dde:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800de1:	89 c7                	mov    %eax,%edi
+  800de3:	fc                   	cld
+  800de4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800de6:	eb 05                	jmp    800ded <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800de8:	89 c7                	mov    %eax,%edi
+  800dea:	fc                   	cld
+  800deb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ded:	5e                   	pop    %esi
+  800dee:	5f                   	pop    %edi
+  800def:	5d                   	pop    %ebp
+  800df0:	c3                   	ret
+
+00800df1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800df7:	ff 75 10             	push   0x10(%ebp)
+  800dfa:	ff 75 0c             	push   0xc(%ebp)
+  800dfd:	ff 75 08             	push   0x8(%ebp)
+  800e00:	e8 8a ff ff ff       	call   800d8f <memmove>
+}
+  800e05:	c9                   	leave
+  800e06:	c3                   	ret
+
+00800e07 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e07:	55                   	push   %ebp
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	56                   	push   %esi
+  800e0b:	53                   	push   %ebx
+  800e0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e12:	89 c6                	mov    %eax,%esi
+  800e14:	03 75 10             	add    0x10(%ebp),%esi
+  800e17:	eb 06                	jmp    800e1f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e19:	83 c0 01             	add    $0x1,%eax
+  800e1c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e1f:	39 f0                	cmp    %esi,%eax
+  800e21:	74 14                	je     800e37 <memcmp+0x30>
+		if (*s1 != *s2)
+  800e23:	0f b6 08             	movzbl (%eax),%ecx
+  800e26:	0f b6 1a             	movzbl (%edx),%ebx
+  800e29:	38 d9                	cmp    %bl,%cl
+  800e2b:	74 ec                	je     800e19 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800e2d:	0f b6 c1             	movzbl %cl,%eax
+  800e30:	0f b6 db             	movzbl %bl,%ebx
+  800e33:	29 d8                	sub    %ebx,%eax
+  800e35:	eb 05                	jmp    800e3c <memcmp+0x35>
+	}
+
+	return 0;
+  800e37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e3c:	5b                   	pop    %ebx
+  800e3d:	5e                   	pop    %esi
+  800e3e:	5d                   	pop    %ebp
+  800e3f:	c3                   	ret
+
+00800e40 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e49:	89 c2                	mov    %eax,%edx
+  800e4b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e4e:	eb 03                	jmp    800e53 <memfind+0x13>
+  800e50:	83 c0 01             	add    $0x1,%eax
+  800e53:	39 d0                	cmp    %edx,%eax
+  800e55:	73 04                	jae    800e5b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e57:	38 08                	cmp    %cl,(%eax)
+  800e59:	75 f5                	jne    800e50 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+
+00800e5d <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	57                   	push   %edi
+  800e61:	56                   	push   %esi
+  800e62:	53                   	push   %ebx
+  800e63:	83 ec 1c             	sub    $0x1c,%esp
+  800e66:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e69:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e6c:	eb 03                	jmp    800e71 <strtol+0x14>
+		s++;
+  800e6e:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800e71:	0f b6 06             	movzbl (%esi),%eax
+  800e74:	3c 20                	cmp    $0x20,%al
+  800e76:	74 f6                	je     800e6e <strtol+0x11>
+  800e78:	3c 09                	cmp    $0x9,%al
+  800e7a:	74 f2                	je     800e6e <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e7c:	3c 2b                	cmp    $0x2b,%al
+  800e7e:	74 43                	je     800ec3 <strtol+0x66>
+	int neg = 0;
+  800e80:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800e85:	3c 2d                	cmp    $0x2d,%al
+  800e87:	74 44                	je     800ecd <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e89:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800e8f:	75 0f                	jne    800ea0 <strtol+0x43>
+  800e91:	80 3e 30             	cmpb   $0x30,(%esi)
+  800e94:	74 41                	je     800ed7 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e96:	85 ff                	test   %edi,%edi
+  800e98:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e9d:	0f 44 f8             	cmove  %eax,%edi
+  800ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea5:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800eaa:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ead:	89 fb                	mov    %edi,%ebx
+  800eaf:	c1 fb 1f             	sar    $0x1f,%ebx
+  800eb2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800eb5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800eb8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ebb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800ebe:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ec1:	eb 67                	jmp    800f2a <strtol+0xcd>
+		s++;
+  800ec3:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800ec6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ecb:	eb bc                	jmp    800e89 <strtol+0x2c>
+		s++, neg = 1;
+  800ecd:	83 c6 01             	add    $0x1,%esi
+  800ed0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ed5:	eb b2                	jmp    800e89 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ed7:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800edb:	74 0e                	je     800eeb <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800edd:	85 ff                	test   %edi,%edi
+  800edf:	75 bf                	jne    800ea0 <strtol+0x43>
+		s++, base = 8;
+  800ee1:	83 c6 01             	add    $0x1,%esi
+  800ee4:	bf 08 00 00 00       	mov    $0x8,%edi
+  800ee9:	eb b5                	jmp    800ea0 <strtol+0x43>
+		s += 2, base = 16;
+  800eeb:	83 c6 02             	add    $0x2,%esi
+  800eee:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ef3:	eb ab                	jmp    800ea0 <strtol+0x43>
+			dig = *s - '0';
+  800ef5:	0f be c9             	movsbl %cl,%ecx
+  800ef8:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800efb:	39 f9                	cmp    %edi,%ecx
+  800efd:	7d 59                	jge    800f58 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800eff:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800f03:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800f06:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f09:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800f0c:	0f af d8             	imul   %eax,%ebx
+  800f0f:	0f af d7             	imul   %edi,%edx
+  800f12:	01 d3                	add    %edx,%ebx
+  800f14:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f17:	f7 e7                	mul    %edi
+  800f19:	01 da                	add    %ebx,%edx
+  800f1b:	89 cb                	mov    %ecx,%ebx
+  800f1d:	c1 fb 1f             	sar    $0x1f,%ebx
+  800f20:	01 c8                	add    %ecx,%eax
+  800f22:	11 da                	adc    %ebx,%edx
+  800f24:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800f27:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f2d:	0f b6 08             	movzbl (%eax),%ecx
+  800f30:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800f33:	80 fb 09             	cmp    $0x9,%bl
+  800f36:	76 bd                	jbe    800ef5 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800f38:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800f3b:	80 fb 19             	cmp    $0x19,%bl
+  800f3e:	77 08                	ja     800f48 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800f40:	0f be c9             	movsbl %cl,%ecx
+  800f43:	83 e9 57             	sub    $0x57,%ecx
+  800f46:	eb b3                	jmp    800efb <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f48:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800f4b:	80 fb 19             	cmp    $0x19,%bl
+  800f4e:	77 08                	ja     800f58 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800f50:	0f be c9             	movsbl %cl,%ecx
+  800f53:	83 e9 37             	sub    $0x37,%ecx
+  800f56:	eb a3                	jmp    800efb <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f58:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800f5b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f5e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800f61:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f64:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f68:	74 05                	je     800f6f <strtol+0x112>
+		*endptr = (char *) s;
+  800f6a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800f6d:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800f6f:	85 c9                	test   %ecx,%ecx
+  800f71:	74 07                	je     800f7a <strtol+0x11d>
+  800f73:	f7 d8                	neg    %eax
+  800f75:	83 d2 00             	adc    $0x0,%edx
+  800f78:	f7 da                	neg    %edx
+}
+  800f7a:	83 c4 1c             	add    $0x1c,%esp
+  800f7d:	5b                   	pop    %ebx
+  800f7e:	5e                   	pop    %esi
+  800f7f:	5f                   	pop    %edi
+  800f80:	5d                   	pop    %ebp
+  800f81:	c3                   	ret
+
+00800f82 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	57                   	push   %edi
+  800f86:	56                   	push   %esi
+  800f87:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f88:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  800f8f:	74 18                	je     800fa9 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	89 c3                	mov    %eax,%ebx
+  800f9e:	89 c7                	mov    %eax,%edi
+  800fa0:	89 c6                	mov    %eax,%esi
+  800fa2:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800fa4:	5b                   	pop    %ebx
+  800fa5:	5e                   	pop    %esi
+  800fa6:	5f                   	pop    %edi
+  800fa7:	5d                   	pop    %ebp
+  800fa8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb4:	89 c3                	mov    %eax,%ebx
+  800fb6:	89 c7                	mov    %eax,%edi
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	8d 35 c3 0f 80 00    	lea    0x800fc3,%esi
+  800fc1:	0f 34                	sysenter
+  800fc3:	5d                   	pop    %ebp
+		goto out;
+  800fc4:	eb de                	jmp    800fa4 <sys_cputs+0x22>
+
+00800fc6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	57                   	push   %edi
+  800fca:	56                   	push   %esi
+  800fcb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fcc:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  800fd3:	74 19                	je     800fee <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800fd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fda:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fdf:	89 d1                	mov    %edx,%ecx
+  800fe1:	89 d3                	mov    %edx,%ebx
+  800fe3:	89 d7                	mov    %edx,%edi
+  800fe5:	89 d6                	mov    %edx,%esi
+  800fe7:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ff8:	89 d1                	mov    %edx,%ecx
+  800ffa:	89 d3                	mov    %edx,%ebx
+  800ffc:	89 d7                	mov    %edx,%edi
+  800ffe:	55                   	push   %ebp
+  800fff:	89 e5                	mov    %esp,%ebp
+  801001:	8d 35 09 10 80 00    	lea    0x801009,%esi
+  801007:	0f 34                	sysenter
+  801009:	5d                   	pop    %ebp
+		goto out;
+  80100a:	eb dd                	jmp    800fe9 <sys_cgetc+0x23>
+
+0080100c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	57                   	push   %edi
+  801010:	56                   	push   %esi
+  801011:	53                   	push   %ebx
+  801012:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801015:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80101c:	74 21                	je     80103f <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  80101e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801023:	b8 03 00 00 00       	mov    $0x3,%eax
+  801028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102b:	89 cb                	mov    %ecx,%ebx
+  80102d:	89 cf                	mov    %ecx,%edi
+  80102f:	89 ce                	mov    %ecx,%esi
+  801031:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801033:	85 c0                	test   %eax,%eax
+  801035:	7f 27                	jg     80105e <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801037:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103a:	5b                   	pop    %ebx
+  80103b:	5e                   	pop    %esi
+  80103c:	5f                   	pop    %edi
+  80103d:	5d                   	pop    %ebp
+  80103e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801047:	b8 03 00 00 00       	mov    $0x3,%eax
+  80104c:	89 cb                	mov    %ecx,%ebx
+  80104e:	89 cf                	mov    %ecx,%edi
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+  801053:	8d 35 5b 10 80 00    	lea    0x80105b,%esi
+  801059:	0f 34                	sysenter
+  80105b:	5d                   	pop    %ebp
+		goto out;
+  80105c:	eb d5                	jmp    801033 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105e:	83 ec 0c             	sub    $0xc,%esp
+  801061:	50                   	push   %eax
+  801062:	6a 03                	push   $0x3
+  801064:	68 6b 35 80 00       	push   $0x80356b
+  801069:	6a 3f                	push   $0x3f
+  80106b:	68 88 35 80 00       	push   $0x803588
+  801070:	e8 71 f4 ff ff       	call   8004e6 <_panic>
+
+00801075 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	57                   	push   %edi
+  801079:	56                   	push   %esi
+  80107a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80107b:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801082:	74 19                	je     80109d <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  801084:	ba 00 00 00 00       	mov    $0x0,%edx
+  801089:	b8 02 00 00 00       	mov    $0x2,%eax
+  80108e:	89 d1                	mov    %edx,%ecx
+  801090:	89 d3                	mov    %edx,%ebx
+  801092:	89 d7                	mov    %edx,%edi
+  801094:	89 d6                	mov    %edx,%esi
+  801096:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801098:	5b                   	pop    %ebx
+  801099:	5e                   	pop    %esi
+  80109a:	5f                   	pop    %edi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80109d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010a7:	89 d1                	mov    %edx,%ecx
+  8010a9:	89 d3                	mov    %edx,%ebx
+  8010ab:	89 d7                	mov    %edx,%edi
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	8d 35 b8 10 80 00    	lea    0x8010b8,%esi
+  8010b6:	0f 34                	sysenter
+  8010b8:	5d                   	pop    %ebp
+		goto out;
+  8010b9:	eb dd                	jmp    801098 <sys_getenvid+0x23>
+
+008010bb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	57                   	push   %edi
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010c1:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8010c8:	74 19                	je     8010e3 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  8010ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010d4:	89 d1                	mov    %edx,%ecx
+  8010d6:	89 d3                	mov    %edx,%ebx
+  8010d8:	89 d7                	mov    %edx,%edi
+  8010da:	89 d6                	mov    %edx,%esi
+  8010dc:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010de:	5b                   	pop    %ebx
+  8010df:	5e                   	pop    %esi
+  8010e0:	5f                   	pop    %edi
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010ed:	89 d1                	mov    %edx,%ecx
+  8010ef:	89 d3                	mov    %edx,%ebx
+  8010f1:	89 d7                	mov    %edx,%edi
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	8d 35 fe 10 80 00    	lea    0x8010fe,%esi
+  8010fc:	0f 34                	sysenter
+  8010fe:	5d                   	pop    %ebp
+		goto out;
+  8010ff:	eb dd                	jmp    8010de <sys_yield+0x23>
+
+00801101 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	57                   	push   %edi
+  801105:	56                   	push   %esi
+  801106:	53                   	push   %ebx
+  801107:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80110a:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801111:	74 23                	je     801136 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  801113:	be 00 00 00 00       	mov    $0x0,%esi
+  801118:	b8 04 00 00 00       	mov    $0x4,%eax
+  80111d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801120:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801123:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801126:	89 f7                	mov    %esi,%edi
+  801128:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80112a:	85 c0                	test   %eax,%eax
+  80112c:	7f 29                	jg     801157 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80112e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801131:	5b                   	pop    %ebx
+  801132:	5e                   	pop    %esi
+  801133:	5f                   	pop    %edi
+  801134:	5d                   	pop    %ebp
+  801135:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801136:	8b 55 08             	mov    0x8(%ebp),%edx
+  801139:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801141:	bf 00 00 00 00       	mov    $0x0,%edi
+  801146:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	8d 35 54 11 80 00    	lea    0x801154,%esi
+  801152:	0f 34                	sysenter
+  801154:	5d                   	pop    %ebp
+		goto out;
+  801155:	eb d3                	jmp    80112a <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801157:	83 ec 0c             	sub    $0xc,%esp
+  80115a:	50                   	push   %eax
+  80115b:	6a 04                	push   $0x4
+  80115d:	68 6b 35 80 00       	push   $0x80356b
+  801162:	6a 3f                	push   $0x3f
+  801164:	68 88 35 80 00       	push   $0x803588
+  801169:	e8 78 f3 ff ff       	call   8004e6 <_panic>
+
+0080116e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	57                   	push   %edi
+  801172:	56                   	push   %esi
+  801173:	53                   	push   %ebx
+  801174:	83 ec 0c             	sub    $0xc,%esp
+  801177:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  80117a:	85 f6                	test   %esi,%esi
+  80117c:	75 09                	jne    801187 <sys_page_map+0x19>
+  80117e:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801185:	74 1f                	je     8011a6 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  801187:	b8 05 00 00 00       	mov    $0x5,%eax
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801195:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801198:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80119a:	85 c0                	test   %eax,%eax
+  80119c:	7f 27                	jg     8011c5 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80119e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5f                   	pop    %edi
+  8011a4:	5d                   	pop    %ebp
+  8011a5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ac:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	8d 35 c2 11 80 00    	lea    0x8011c2,%esi
+  8011c0:	0f 34                	sysenter
+  8011c2:	5d                   	pop    %ebp
+		goto out;
+  8011c3:	eb d5                	jmp    80119a <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c5:	83 ec 0c             	sub    $0xc,%esp
+  8011c8:	50                   	push   %eax
+  8011c9:	6a 05                	push   $0x5
+  8011cb:	68 6b 35 80 00       	push   $0x80356b
+  8011d0:	6a 3f                	push   $0x3f
+  8011d2:	68 88 35 80 00       	push   $0x803588
+  8011d7:	e8 0a f3 ff ff       	call   8004e6 <_panic>
+
+008011dc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	57                   	push   %edi
+  8011e0:	56                   	push   %esi
+  8011e1:	53                   	push   %ebx
+  8011e2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011e5:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8011ec:	74 22                	je     801210 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  8011ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fe:	89 df                	mov    %ebx,%edi
+  801200:	89 de                	mov    %ebx,%esi
+  801202:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801204:	85 c0                	test   %eax,%eax
+  801206:	7f 28                	jg     801230 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120b:	5b                   	pop    %ebx
+  80120c:	5e                   	pop    %esi
+  80120d:	5f                   	pop    %edi
+  80120e:	5d                   	pop    %ebp
+  80120f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801215:	8b 55 08             	mov    0x8(%ebp),%edx
+  801218:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801220:	89 df                	mov    %ebx,%edi
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	8d 35 2d 12 80 00    	lea    0x80122d,%esi
+  80122b:	0f 34                	sysenter
+  80122d:	5d                   	pop    %ebp
+		goto out;
+  80122e:	eb d4                	jmp    801204 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801230:	83 ec 0c             	sub    $0xc,%esp
+  801233:	50                   	push   %eax
+  801234:	6a 06                	push   $0x6
+  801236:	68 6b 35 80 00       	push   $0x80356b
+  80123b:	6a 3f                	push   $0x3f
+  80123d:	68 88 35 80 00       	push   $0x803588
+  801242:	e8 9f f2 ff ff       	call   8004e6 <_panic>
+
+00801247 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	57                   	push   %edi
+  80124b:	56                   	push   %esi
+  80124c:	53                   	push   %ebx
+  80124d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801250:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801257:	74 22                	je     80127b <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801259:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801269:	89 df                	mov    %ebx,%edi
+  80126b:	89 de                	mov    %ebx,%esi
+  80126d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	7f 28                	jg     80129b <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801276:	5b                   	pop    %ebx
+  801277:	5e                   	pop    %esi
+  801278:	5f                   	pop    %edi
+  801279:	5d                   	pop    %ebp
+  80127a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80127b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801280:	8b 55 08             	mov    0x8(%ebp),%edx
+  801283:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801286:	b8 08 00 00 00       	mov    $0x8,%eax
+  80128b:	89 df                	mov    %ebx,%edi
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	8d 35 98 12 80 00    	lea    0x801298,%esi
+  801296:	0f 34                	sysenter
+  801298:	5d                   	pop    %ebp
+		goto out;
+  801299:	eb d4                	jmp    80126f <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129b:	83 ec 0c             	sub    $0xc,%esp
+  80129e:	50                   	push   %eax
+  80129f:	6a 08                	push   $0x8
+  8012a1:	68 6b 35 80 00       	push   $0x80356b
+  8012a6:	6a 3f                	push   $0x3f
+  8012a8:	68 88 35 80 00       	push   $0x803588
+  8012ad:	e8 34 f2 ff ff       	call   8004e6 <_panic>
+
+008012b2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	57                   	push   %edi
+  8012b6:	56                   	push   %esi
+  8012b7:	53                   	push   %ebx
+  8012b8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012bb:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8012c2:	74 22                	je     8012e6 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  8012c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d4:	89 df                	mov    %ebx,%edi
+  8012d6:	89 de                	mov    %ebx,%esi
+  8012d8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012da:	85 c0                	test   %eax,%eax
+  8012dc:	7f 28                	jg     801306 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8012de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e1:	5b                   	pop    %ebx
+  8012e2:	5e                   	pop    %esi
+  8012e3:	5f                   	pop    %edi
+  8012e4:	5d                   	pop    %ebp
+  8012e5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012f6:	89 df                	mov    %ebx,%edi
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	8d 35 03 13 80 00    	lea    0x801303,%esi
+  801301:	0f 34                	sysenter
+  801303:	5d                   	pop    %ebp
+		goto out;
+  801304:	eb d4                	jmp    8012da <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801306:	83 ec 0c             	sub    $0xc,%esp
+  801309:	50                   	push   %eax
+  80130a:	6a 09                	push   $0x9
+  80130c:	68 6b 35 80 00       	push   $0x80356b
+  801311:	6a 3f                	push   $0x3f
+  801313:	68 88 35 80 00       	push   $0x803588
+  801318:	e8 c9 f1 ff ff       	call   8004e6 <_panic>
+
+0080131d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80131d:	55                   	push   %ebp
+  80131e:	89 e5                	mov    %esp,%ebp
+  801320:	57                   	push   %edi
+  801321:	56                   	push   %esi
+  801322:	53                   	push   %ebx
+  801323:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801326:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80132d:	74 22                	je     801351 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80132f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801334:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801339:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133f:	89 df                	mov    %ebx,%edi
+  801341:	89 de                	mov    %ebx,%esi
+  801343:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801345:	85 c0                	test   %eax,%eax
+  801347:	7f 28                	jg     801371 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801351:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801356:	8b 55 08             	mov    0x8(%ebp),%edx
+  801359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801361:	89 df                	mov    %ebx,%edi
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	8d 35 6e 13 80 00    	lea    0x80136e,%esi
+  80136c:	0f 34                	sysenter
+  80136e:	5d                   	pop    %ebp
+		goto out;
+  80136f:	eb d4                	jmp    801345 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801371:	83 ec 0c             	sub    $0xc,%esp
+  801374:	50                   	push   %eax
+  801375:	6a 0a                	push   $0xa
+  801377:	68 6b 35 80 00       	push   $0x80356b
+  80137c:	6a 3f                	push   $0x3f
+  80137e:	68 88 35 80 00       	push   $0x803588
+  801383:	e8 5e f1 ff ff       	call   8004e6 <_panic>
+
+00801388 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	57                   	push   %edi
+  80138c:	56                   	push   %esi
+  80138d:	53                   	push   %ebx
+  80138e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801391:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801398:	74 22                	je     8013bc <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80139a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139f:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013aa:	89 df                	mov    %ebx,%edi
+  8013ac:	89 de                	mov    %ebx,%esi
+  8013ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013b0:	85 c0                	test   %eax,%eax
+  8013b2:	7f 28                	jg     8013dc <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8013b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013b7:	5b                   	pop    %ebx
+  8013b8:	5e                   	pop    %esi
+  8013b9:	5f                   	pop    %edi
+  8013ba:	5d                   	pop    %ebp
+  8013bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c7:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013cc:	89 df                	mov    %ebx,%edi
+  8013ce:	55                   	push   %ebp
+  8013cf:	89 e5                	mov    %esp,%ebp
+  8013d1:	8d 35 d9 13 80 00    	lea    0x8013d9,%esi
+  8013d7:	0f 34                	sysenter
+  8013d9:	5d                   	pop    %ebp
+		goto out;
+  8013da:	eb d4                	jmp    8013b0 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013dc:	83 ec 0c             	sub    $0xc,%esp
+  8013df:	50                   	push   %eax
+  8013e0:	6a 17                	push   $0x17
+  8013e2:	68 6b 35 80 00       	push   $0x80356b
+  8013e7:	6a 3f                	push   $0x3f
+  8013e9:	68 88 35 80 00       	push   $0x803588
+  8013ee:	e8 f3 f0 ff ff       	call   8004e6 <_panic>
+
+008013f3 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8013f3:	55                   	push   %ebp
+  8013f4:	89 e5                	mov    %esp,%ebp
+  8013f6:	57                   	push   %edi
+  8013f7:	56                   	push   %esi
+  8013f8:	53                   	push   %ebx
+  8013f9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013fc:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801403:	74 22                	je     801427 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801405:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80140f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801412:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801415:	89 df                	mov    %ebx,%edi
+  801417:	89 de                	mov    %ebx,%esi
+  801419:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	7f 28                	jg     801447 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80141f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801422:	5b                   	pop    %ebx
+  801423:	5e                   	pop    %esi
+  801424:	5f                   	pop    %edi
+  801425:	5d                   	pop    %ebp
+  801426:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801427:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801432:	b8 18 00 00 00       	mov    $0x18,%eax
+  801437:	89 df                	mov    %ebx,%edi
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	8d 35 44 14 80 00    	lea    0x801444,%esi
+  801442:	0f 34                	sysenter
+  801444:	5d                   	pop    %ebp
+		goto out;
+  801445:	eb d4                	jmp    80141b <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801447:	83 ec 0c             	sub    $0xc,%esp
+  80144a:	50                   	push   %eax
+  80144b:	6a 18                	push   $0x18
+  80144d:	68 6b 35 80 00       	push   $0x80356b
+  801452:	6a 3f                	push   $0x3f
+  801454:	68 88 35 80 00       	push   $0x803588
+  801459:	e8 88 f0 ff ff       	call   8004e6 <_panic>
+
+0080145e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80145e:	55                   	push   %ebp
+  80145f:	89 e5                	mov    %esp,%ebp
+  801461:	57                   	push   %edi
+  801462:	56                   	push   %esi
+  801463:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801464:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80146b:	74 1d                	je     80148a <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80146d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801472:	be 00 00 00 00       	mov    $0x0,%esi
+  801477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801480:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801483:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5f                   	pop    %edi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80148a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801490:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801495:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801498:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	8d 35 a6 14 80 00    	lea    0x8014a6,%esi
+  8014a4:	0f 34                	sysenter
+  8014a6:	5d                   	pop    %ebp
+		goto out;
+  8014a7:	eb dc                	jmp    801485 <sys_ipc_try_send+0x27>
+
+008014a9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8014a9:	55                   	push   %ebp
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	57                   	push   %edi
+  8014ad:	56                   	push   %esi
+  8014ae:	53                   	push   %ebx
+  8014af:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014b2:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8014b9:	74 21                	je     8014dc <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8014bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c8:	89 cb                	mov    %ecx,%ebx
+  8014ca:	89 cf                	mov    %ecx,%edi
+  8014cc:	89 ce                	mov    %ecx,%esi
+  8014ce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	7f 27                	jg     8014fb <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8014d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d7:	5b                   	pop    %ebx
+  8014d8:	5e                   	pop    %esi
+  8014d9:	5f                   	pop    %edi
+  8014da:	5d                   	pop    %ebp
+  8014db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014e9:	89 cb                	mov    %ecx,%ebx
+  8014eb:	89 cf                	mov    %ecx,%edi
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	8d 35 f8 14 80 00    	lea    0x8014f8,%esi
+  8014f6:	0f 34                	sysenter
+  8014f8:	5d                   	pop    %ebp
+		goto out;
+  8014f9:	eb d5                	jmp    8014d0 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014fb:	83 ec 0c             	sub    $0xc,%esp
+  8014fe:	50                   	push   %eax
+  8014ff:	6a 0d                	push   $0xd
+  801501:	68 6b 35 80 00       	push   $0x80356b
+  801506:	6a 3f                	push   $0x3f
+  801508:	68 88 35 80 00       	push   $0x803588
+  80150d:	e8 d4 ef ff ff       	call   8004e6 <_panic>
+
+00801512 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	57                   	push   %edi
+  801516:	56                   	push   %esi
+  801517:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801518:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80151f:	74 1b                	je     80153c <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801526:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80152b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801531:	89 df                	mov    %ebx,%edi
+  801533:	89 de                	mov    %ebx,%esi
+  801535:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801537:	5b                   	pop    %ebx
+  801538:	5e                   	pop    %esi
+  801539:	5f                   	pop    %edi
+  80153a:	5d                   	pop    %ebp
+  80153b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80153c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801541:	8b 55 08             	mov    0x8(%ebp),%edx
+  801544:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801547:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80154c:	89 df                	mov    %ebx,%edi
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	8d 35 59 15 80 00    	lea    0x801559,%esi
+  801557:	0f 34                	sysenter
+  801559:	5d                   	pop    %ebp
+		goto out;
+  80155a:	eb db                	jmp    801537 <sys_ipc_recv_until+0x25>
+
+0080155c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80155c:	55                   	push   %ebp
+  80155d:	89 e5                	mov    %esp,%ebp
+  80155f:	57                   	push   %edi
+  801560:	56                   	push   %esi
+  801561:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801562:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801569:	74 19                	je     801584 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80156b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801570:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801575:	89 d1                	mov    %edx,%ecx
+  801577:	89 d3                	mov    %edx,%ebx
+  801579:	89 d7                	mov    %edx,%edi
+  80157b:	89 d6                	mov    %edx,%esi
+  80157d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80157f:	5b                   	pop    %ebx
+  801580:	5e                   	pop    %esi
+  801581:	5f                   	pop    %edi
+  801582:	5d                   	pop    %ebp
+  801583:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801584:	ba 00 00 00 00       	mov    $0x0,%edx
+  801589:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80158e:	89 d1                	mov    %edx,%ecx
+  801590:	89 d3                	mov    %edx,%ebx
+  801592:	89 d7                	mov    %edx,%edi
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	8d 35 9f 15 80 00    	lea    0x80159f,%esi
+  80159d:	0f 34                	sysenter
+  80159f:	5d                   	pop    %ebp
+		goto out;
+  8015a0:	eb dd                	jmp    80157f <sys_time_msec+0x23>
+
+008015a2 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	57                   	push   %edi
+  8015a6:	56                   	push   %esi
+  8015a7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015a8:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8015af:	74 1a                	je     8015cb <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8015b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b6:	b8 10 00 00 00       	mov    $0x10,%eax
+  8015bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015be:	89 cb                	mov    %ecx,%ebx
+  8015c0:	89 cf                	mov    %ecx,%edi
+  8015c2:	89 ce                	mov    %ecx,%esi
+  8015c4:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8015c6:	5b                   	pop    %ebx
+  8015c7:	5e                   	pop    %esi
+  8015c8:	5f                   	pop    %edi
+  8015c9:	5d                   	pop    %ebp
+  8015ca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8015d8:	89 cb                	mov    %ecx,%ebx
+  8015da:	89 cf                	mov    %ecx,%edi
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	8d 35 e7 15 80 00    	lea    0x8015e7,%esi
+  8015e5:	0f 34                	sysenter
+  8015e7:	5d                   	pop    %ebp
+		goto out;
+  8015e8:	eb dc                	jmp    8015c6 <sys_sleep_until+0x24>
+
+008015ea <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8015ea:	55                   	push   %ebp
+  8015eb:	89 e5                	mov    %esp,%ebp
+  8015ed:	57                   	push   %edi
+  8015ee:	56                   	push   %esi
+  8015ef:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015f0:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8015f7:	74 1a                	je     801613 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8015f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fe:	b8 11 00 00 00       	mov    $0x11,%eax
+  801603:	8b 55 08             	mov    0x8(%ebp),%edx
+  801606:	89 cb                	mov    %ecx,%ebx
+  801608:	89 cf                	mov    %ecx,%edi
+  80160a:	89 ce                	mov    %ecx,%esi
+  80160c:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80160e:	5b                   	pop    %ebx
+  80160f:	5e                   	pop    %esi
+  801610:	5f                   	pop    %edi
+  801611:	5d                   	pop    %ebp
+  801612:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801613:	8b 55 08             	mov    0x8(%ebp),%edx
+  801616:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80161b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801620:	89 cb                	mov    %ecx,%ebx
+  801622:	89 cf                	mov    %ecx,%edi
+  801624:	55                   	push   %ebp
+  801625:	89 e5                	mov    %esp,%ebp
+  801627:	8d 35 2f 16 80 00    	lea    0x80162f,%esi
+  80162d:	0f 34                	sysenter
+  80162f:	5d                   	pop    %ebp
+		goto out;
+  801630:	eb dc                	jmp    80160e <sys_env_print_stats+0x24>
+
+00801632 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801632:	55                   	push   %ebp
+  801633:	89 e5                	mov    %esp,%ebp
+  801635:	57                   	push   %edi
+  801636:	56                   	push   %esi
+  801637:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801638:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80163f:	74 1b                	je     80165c <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801641:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801646:	b8 19 00 00 00       	mov    $0x19,%eax
+  80164b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801651:	89 df                	mov    %ebx,%edi
+  801653:	89 de                	mov    %ebx,%esi
+  801655:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801657:	5b                   	pop    %ebx
+  801658:	5e                   	pop    %esi
+  801659:	5f                   	pop    %edi
+  80165a:	5d                   	pop    %ebp
+  80165b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80165c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801661:	8b 55 08             	mov    0x8(%ebp),%edx
+  801664:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801667:	b8 19 00 00 00       	mov    $0x19,%eax
+  80166c:	89 df                	mov    %ebx,%edi
+  80166e:	55                   	push   %ebp
+  80166f:	89 e5                	mov    %esp,%ebp
+  801671:	8d 35 79 16 80 00    	lea    0x801679,%esi
+  801677:	0f 34                	sysenter
+  801679:	5d                   	pop    %ebp
+		goto out;
+  80167a:	eb db                	jmp    801657 <sys_perf+0x25>
+
+0080167c <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80167c:	55                   	push   %ebp
+  80167d:	89 e5                	mov    %esp,%ebp
+  80167f:	57                   	push   %edi
+  801680:	56                   	push   %esi
+  801681:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801682:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801689:	74 19                	je     8016a4 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80168b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801690:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801695:	89 d1                	mov    %edx,%ecx
+  801697:	89 d3                	mov    %edx,%ebx
+  801699:	89 d7                	mov    %edx,%edi
+  80169b:	89 d6                	mov    %edx,%esi
+  80169d:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80169f:	5b                   	pop    %ebx
+  8016a0:	5e                   	pop    %esi
+  8016a1:	5f                   	pop    %edi
+  8016a2:	5d                   	pop    %ebp
+  8016a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016ae:	89 d1                	mov    %edx,%ecx
+  8016b0:	89 d3                	mov    %edx,%ebx
+  8016b2:	89 d7                	mov    %edx,%edi
+  8016b4:	55                   	push   %ebp
+  8016b5:	89 e5                	mov    %esp,%ebp
+  8016b7:	8d 35 bf 16 80 00    	lea    0x8016bf,%esi
+  8016bd:	0f 34                	sysenter
+  8016bf:	5d                   	pop    %ebp
+		goto out;
+  8016c0:	eb dd                	jmp    80169f <sys_fork+0x23>
+
+008016c2 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8016c2:	55                   	push   %ebp
+  8016c3:	89 e5                	mov    %esp,%ebp
+  8016c5:	57                   	push   %edi
+  8016c6:	56                   	push   %esi
+  8016c7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016c8:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8016cf:	74 1c                	je     8016ed <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8016d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8016db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e4:	89 f7                	mov    %esi,%edi
+  8016e6:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5f                   	pop    %edi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8016f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801700:	55                   	push   %ebp
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	8d 35 0b 17 80 00    	lea    0x80170b,%esi
+  801709:	0f 34                	sysenter
+  80170b:	5d                   	pop    %ebp
+		goto out;
+  80170c:	eb da                	jmp    8016e8 <sys_thread_create+0x26>
+
+0080170e <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	57                   	push   %edi
+  801712:	56                   	push   %esi
+  801713:	53                   	push   %ebx
+  801714:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801717:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80171e:	74 24                	je     801744 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801720:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801725:	be 00 00 00 00       	mov    $0x0,%esi
+  80172a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801730:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801733:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801736:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801738:	85 c0                	test   %eax,%eax
+  80173a:	7f 27                	jg     801763 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80173c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173f:	5b                   	pop    %ebx
+  801740:	5e                   	pop    %esi
+  801741:	5f                   	pop    %edi
+  801742:	5d                   	pop    %ebp
+  801743:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801744:	8b 55 08             	mov    0x8(%ebp),%edx
+  801747:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80174f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801752:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	8d 35 60 17 80 00    	lea    0x801760,%esi
+  80175e:	0f 34                	sysenter
+  801760:	5d                   	pop    %ebp
+		goto out;
+  801761:	eb d5                	jmp    801738 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801763:	83 ec 0c             	sub    $0xc,%esp
+  801766:	50                   	push   %eax
+  801767:	6a 1f                	push   $0x1f
+  801769:	68 6b 35 80 00       	push   $0x80356b
+  80176e:	6a 3f                	push   $0x3f
+  801770:	68 88 35 80 00       	push   $0x803588
+  801775:	e8 6c ed ff ff       	call   8004e6 <_panic>
+
+0080177a <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80177a:	55                   	push   %ebp
+  80177b:	89 e5                	mov    %esp,%ebp
+  80177d:	57                   	push   %edi
+  80177e:	56                   	push   %esi
+  80177f:	53                   	push   %ebx
+  801780:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801783:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80178a:	74 23                	je     8017af <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80178c:	be 00 00 00 00       	mov    $0x0,%esi
+  801791:	b8 20 00 00 00       	mov    $0x20,%eax
+  801796:	8b 55 08             	mov    0x8(%ebp),%edx
+  801799:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80179c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80179f:	89 f7                	mov    %esi,%edi
+  8017a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	7f 29                	jg     8017d0 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8017a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017aa:	5b                   	pop    %ebx
+  8017ab:	5e                   	pop    %esi
+  8017ac:	5f                   	pop    %edi
+  8017ad:	5d                   	pop    %ebp
+  8017ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b5:	b8 20 00 00 00       	mov    $0x20,%eax
+  8017ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	8d 35 cd 17 80 00    	lea    0x8017cd,%esi
+  8017cb:	0f 34                	sysenter
+  8017cd:	5d                   	pop    %ebp
+		goto out;
+  8017ce:	eb d3                	jmp    8017a3 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017d0:	83 ec 0c             	sub    $0xc,%esp
+  8017d3:	50                   	push   %eax
+  8017d4:	6a 20                	push   $0x20
+  8017d6:	68 6b 35 80 00       	push   $0x80356b
+  8017db:	6a 3f                	push   $0x3f
+  8017dd:	68 88 35 80 00       	push   $0x803588
+  8017e2:	e8 ff ec ff ff       	call   8004e6 <_panic>
+
+008017e7 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	57                   	push   %edi
+  8017eb:	56                   	push   %esi
+  8017ec:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ed:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8017f4:	74 1b                	je     801811 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8017f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801800:	8b 55 08             	mov    0x8(%ebp),%edx
+  801803:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801806:	89 df                	mov    %ebx,%edi
+  801808:	89 de                	mov    %ebx,%esi
+  80180a:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80180c:	5b                   	pop    %ebx
+  80180d:	5e                   	pop    %esi
+  80180e:	5f                   	pop    %edi
+  80180f:	5d                   	pop    %ebp
+  801810:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801816:	8b 55 08             	mov    0x8(%ebp),%edx
+  801819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801821:	89 df                	mov    %ebx,%edi
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	8d 35 2e 18 80 00    	lea    0x80182e,%esi
+  80182c:	0f 34                	sysenter
+  80182e:	5d                   	pop    %ebp
+		goto out;
+  80182f:	eb db                	jmp    80180c <sys_batch+0x25>
+
+00801831 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	57                   	push   %edi
+  801835:	56                   	push   %esi
+  801836:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801837:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80183e:	74 1a                	je     80185a <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801840:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801845:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80184a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184d:	89 cb                	mov    %ecx,%ebx
+  80184f:	89 cf                	mov    %ecx,%edi
+  801851:	89 ce                	mov    %ecx,%esi
+  801853:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801855:	5b                   	pop    %ebx
+  801856:	5e                   	pop    %esi
+  801857:	5f                   	pop    %edi
+  801858:	5d                   	pop    %ebp
+  801859:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80185a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801862:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801867:	89 cb                	mov    %ecx,%ebx
+  801869:	89 cf                	mov    %ecx,%edi
+  80186b:	55                   	push   %ebp
+  80186c:	89 e5                	mov    %esp,%ebp
+  80186e:	8d 35 76 18 80 00    	lea    0x801876,%esi
+  801874:	0f 34                	sysenter
+  801876:	5d                   	pop    %ebp
+		goto out;
+  801877:	eb dc                	jmp    801855 <sys_trace_ctl+0x24>
+
+00801879 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801879:	55                   	push   %ebp
+  80187a:	89 e5                	mov    %esp,%ebp
+  80187c:	57                   	push   %edi
+  80187d:	56                   	push   %esi
+  80187e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80187f:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801886:	74 1c                	je     8018a4 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801888:	be 00 00 00 00       	mov    $0x0,%esi
+  80188d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801892:	8b 55 08             	mov    0x8(%ebp),%edx
+  801895:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801898:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80189b:	89 f7                	mov    %esi,%edi
+  80189d:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80189f:	5b                   	pop    %ebx
+  8018a0:	5e                   	pop    %esi
+  8018a1:	5f                   	pop    %edi
+  8018a2:	5d                   	pop    %ebp
+  8018a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018aa:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8018af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018b7:	55                   	push   %ebp
+  8018b8:	89 e5                	mov    %esp,%ebp
+  8018ba:	8d 35 c2 18 80 00    	lea    0x8018c2,%esi
+  8018c0:	0f 34                	sysenter
+  8018c2:	5d                   	pop    %ebp
+		goto out;
+  8018c3:	eb da                	jmp    80189f <sys_trace_read+0x26>
+
+008018c5 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8018c5:	55                   	push   %ebp
+  8018c6:	89 e5                	mov    %esp,%ebp
+  8018c8:	57                   	push   %edi
+  8018c9:	56                   	push   %esi
+  8018ca:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018cb:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8018d2:	74 1c                	je     8018f0 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8018d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018d9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8018de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018e7:	89 f7                	mov    %esi,%edi
+  8018e9:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8018eb:	5b                   	pop    %ebx
+  8018ec:	5e                   	pop    %esi
+  8018ed:	5f                   	pop    %edi
+  8018ee:	5d                   	pop    %ebp
+  8018ef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8018fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801900:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801903:	55                   	push   %ebp
+  801904:	89 e5                	mov    %esp,%ebp
+  801906:	8d 35 0e 19 80 00    	lea    0x80190e,%esi
+  80190c:	0f 34                	sysenter
+  80190e:	5d                   	pop    %ebp
+		goto out;
+  80190f:	eb da                	jmp    8018eb <sys_meminfo+0x26>
+
+00801911 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+  801914:	57                   	push   %edi
+  801915:	56                   	push   %esi
+  801916:	53                   	push   %ebx
+  801917:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80191a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80191e:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801925:	74 1f                	je     801946 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801927:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192c:	b8 22 00 00 00       	mov    $0x22,%eax
+  801931:	8b 55 08             	mov    0x8(%ebp),%edx
+  801934:	89 df                	mov    %ebx,%edi
+  801936:	89 de                	mov    %ebx,%esi
+  801938:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80193a:	85 c0                	test   %eax,%eax
+  80193c:	7f 25                	jg     801963 <sys_env_set_ksm+0x52>
+}
+  80193e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801941:	5b                   	pop    %ebx
+  801942:	5e                   	pop    %esi
+  801943:	5f                   	pop    %edi
+  801944:	5d                   	pop    %ebp
+  801945:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801946:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801953:	89 df                	mov    %ebx,%edi
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	8d 35 60 19 80 00    	lea    0x801960,%esi
+  80195e:	0f 34                	sysenter
+  801960:	5d                   	pop    %ebp
+		goto out;
+  801961:	eb d7                	jmp    80193a <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801963:	83 ec 0c             	sub    $0xc,%esp
+  801966:	50                   	push   %eax
+  801967:	6a 22                	push   $0x22
+  801969:	68 6b 35 80 00       	push   $0x80356b
+  80196e:	6a 3f                	push   $0x3f
+  801970:	68 88 35 80 00       	push   $0x803588
+  801975:	e8 6c eb ff ff       	call   8004e6 <_panic>
+
+0080197a <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	57                   	push   %edi
+  80197e:	56                   	push   %esi
+  80197f:	53                   	push   %ebx
+  801980:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801983:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801986:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  80198d:	74 24                	je     8019b3 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80198f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801994:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801999:	89 cb                	mov    %ecx,%ebx
+  80199b:	89 cf                	mov    %ecx,%edi
+  80199d:	89 ce                	mov    %ecx,%esi
+  80199f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019a1:	85 c0                	test   %eax,%eax
+  8019a3:	7f 2a                	jg     8019cf <sys_time_nsec+0x55>
+	return ns;
+}
+  8019a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019a8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8019ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ae:	5b                   	pop    %ebx
+  8019af:	5e                   	pop    %esi
+  8019b0:	5f                   	pop    %edi
+  8019b1:	5d                   	pop    %ebp
+  8019b2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8019bd:	89 cb                	mov    %ecx,%ebx
+  8019bf:	89 cf                	mov    %ecx,%edi
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	8d 35 cc 19 80 00    	lea    0x8019cc,%esi
+  8019ca:	0f 34                	sysenter
+  8019cc:	5d                   	pop    %ebp
+		goto out;
+  8019cd:	eb d2                	jmp    8019a1 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019cf:	83 ec 0c             	sub    $0xc,%esp
+  8019d2:	50                   	push   %eax
+  8019d3:	6a 0f                	push   $0xf
+  8019d5:	68 6b 35 80 00       	push   $0x80356b
+  8019da:	6a 3f                	push   $0x3f
+  8019dc:	68 88 35 80 00       	push   $0x803588
+  8019e1:	e8 00 eb ff ff       	call   8004e6 <_panic>
+
+008019e6 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8019e6:	55                   	push   %ebp
+  8019e7:	89 e5                	mov    %esp,%ebp
+  8019e9:	57                   	push   %edi
+  8019ea:	56                   	push   %esi
+  8019eb:	53                   	push   %ebx
+  8019ec:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8019ef:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  8019f6:	74 22                	je     801a1a <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8019f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019fd:	b8 12 00 00 00       	mov    $0x12,%eax
+  801a02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a08:	89 df                	mov    %ebx,%edi
+  801a0a:	89 de                	mov    %ebx,%esi
+  801a0c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	7f 28                	jg     801a3a <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a15:	5b                   	pop    %ebx
+  801a16:	5e                   	pop    %esi
+  801a17:	5f                   	pop    %edi
+  801a18:	5d                   	pop    %ebp
+  801a19:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a25:	b8 12 00 00 00       	mov    $0x12,%eax
+  801a2a:	89 df                	mov    %ebx,%edi
+  801a2c:	55                   	push   %ebp
+  801a2d:	89 e5                	mov    %esp,%ebp
+  801a2f:	8d 35 37 1a 80 00    	lea    0x801a37,%esi
+  801a35:	0f 34                	sysenter
+  801a37:	5d                   	pop    %ebp
+		goto out;
+  801a38:	eb d4                	jmp    801a0e <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a3a:	83 ec 0c             	sub    $0xc,%esp
+  801a3d:	50                   	push   %eax
+  801a3e:	6a 12                	push   $0x12
+  801a40:	68 6b 35 80 00       	push   $0x80356b
+  801a45:	6a 3f                	push   $0x3f
+  801a47:	68 88 35 80 00       	push   $0x803588
+  801a4c:	e8 95 ea ff ff       	call   8004e6 <_panic>
+
+00801a51 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801a51:	55                   	push   %ebp
+  801a52:	89 e5                	mov    %esp,%ebp
+  801a54:	57                   	push   %edi
+  801a55:	56                   	push   %esi
+  801a56:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a57:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801a5e:	74 1b                	je     801a7b <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801a60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a65:	b8 13 00 00 00       	mov    $0x13,%eax
+  801a6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a70:	89 df                	mov    %ebx,%edi
+  801a72:	89 de                	mov    %ebx,%esi
+  801a74:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801a76:	5b                   	pop    %ebx
+  801a77:	5e                   	pop    %esi
+  801a78:	5f                   	pop    %edi
+  801a79:	5d                   	pop    %ebp
+  801a7a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a86:	b8 13 00 00 00       	mov    $0x13,%eax
+  801a8b:	89 df                	mov    %ebx,%edi
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	8d 35 98 1a 80 00    	lea    0x801a98,%esi
+  801a96:	0f 34                	sysenter
+  801a98:	5d                   	pop    %ebp
+		goto out;
+  801a99:	eb db                	jmp    801a76 <sys_e1000_receive+0x25>
+
+00801a9b <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	57                   	push   %edi
+  801a9f:	56                   	push   %esi
+  801aa0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801aa1:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801aa8:	74 1b                	je     801ac5 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801aaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aaf:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ab4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aba:	89 df                	mov    %ebx,%edi
+  801abc:	89 de                	mov    %ebx,%esi
+  801abe:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801ac0:	5b                   	pop    %ebx
+  801ac1:	5e                   	pop    %esi
+  801ac2:	5f                   	pop    %edi
+  801ac3:	5d                   	pop    %ebp
+  801ac4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ac5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aca:	8b 55 08             	mov    0x8(%ebp),%edx
+  801acd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad0:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ad5:	89 df                	mov    %ebx,%edi
+  801ad7:	55                   	push   %ebp
+  801ad8:	89 e5                	mov    %esp,%ebp
+  801ada:	8d 35 e2 1a 80 00    	lea    0x801ae2,%esi
+  801ae0:	0f 34                	sysenter
+  801ae2:	5d                   	pop    %ebp
+		goto out;
+  801ae3:	eb db                	jmp    801ac0 <sys_e1000_read_hwaddr+0x25>
+
+00801ae5 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+  801ae8:	57                   	push   %edi
+  801ae9:	56                   	push   %esi
+  801aea:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801aeb:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801af2:	74 1a                	je     801b0e <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801af4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801af9:	b8 15 00 00 00       	mov    $0x15,%eax
+  801afe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b01:	89 cb                	mov    %ecx,%ebx
+  801b03:	89 cf                	mov    %ecx,%edi
+  801b05:	89 ce                	mov    %ecx,%esi
+  801b07:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801b09:	5b                   	pop    %ebx
+  801b0a:	5e                   	pop    %esi
+  801b0b:	5f                   	pop    %edi
+  801b0c:	5d                   	pop    %ebp
+  801b0d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b16:	b8 15 00 00 00       	mov    $0x15,%eax
+  801b1b:	89 cb                	mov    %ecx,%ebx
+  801b1d:	89 cf                	mov    %ecx,%edi
+  801b1f:	55                   	push   %ebp
+  801b20:	89 e5                	mov    %esp,%ebp
+  801b22:	8d 35 2a 1b 80 00    	lea    0x801b2a,%esi
+  801b28:	0f 34                	sysenter
+  801b2a:	5d                   	pop    %ebp
+		goto out;
+  801b2b:	eb dc                	jmp    801b09 <sys_sb16_read_version+0x24>
+
+00801b2d <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	57                   	push   %edi
+  801b31:	56                   	push   %esi
+  801b32:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b33:	80 3d 24 50 81 02 00 	cmpb   $0x0,0x2815024
+  801b3a:	74 1b                	je     801b57 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801b3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b41:	b8 16 00 00 00       	mov    $0x16,%eax
+  801b46:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b4c:	89 df                	mov    %ebx,%edi
+  801b4e:	89 de                	mov    %ebx,%esi
+  801b50:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801b52:	5b                   	pop    %ebx
+  801b53:	5e                   	pop    %esi
+  801b54:	5f                   	pop    %edi
+  801b55:	5d                   	pop    %ebp
+  801b56:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b62:	b8 16 00 00 00       	mov    $0x16,%eax
+  801b67:	89 df                	mov    %ebx,%edi
+  801b69:	55                   	push   %ebp
+  801b6a:	89 e5                	mov    %esp,%ebp
+  801b6c:	8d 35 74 1b 80 00    	lea    0x801b74,%esi
+  801b72:	0f 34                	sysenter
+  801b74:	5d                   	pop    %ebp
+		goto out;
+  801b75:	eb db                	jmp    801b52 <sys_sb16_play+0x25>
+
+00801b77 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801b77:	55                   	push   %ebp
+  801b78:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b7d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b82:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801b85:	5d                   	pop    %ebp
+  801b86:	c3                   	ret
+
+00801b87 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801b87:	55                   	push   %ebp
+  801b88:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b8d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801b92:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b97:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801b9c:	5d                   	pop    %ebp
+  801b9d:	c3                   	ret
+
+00801b9e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b9e:	55                   	push   %ebp
+  801b9f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801ba1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801ba6:	eb 02                	jmp    801baa <fd_alloc+0xc>
+  801ba8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801baa:	89 c2                	mov    %eax,%edx
+  801bac:	c1 ea 16             	shr    $0x16,%edx
+  801baf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bb6:	f6 c2 01             	test   $0x1,%dl
+  801bb9:	74 2b                	je     801be6 <fd_alloc+0x48>
+  801bbb:	89 c2                	mov    %eax,%edx
+  801bbd:	c1 ea 0c             	shr    $0xc,%edx
+  801bc0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801bc7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801bcd:	f6 c1 01             	test   $0x1,%cl
+  801bd0:	74 14                	je     801be6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801bd2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801bd8:	75 ce                	jne    801ba8 <fd_alloc+0xa>
+  801bda:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801bdf:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801be4:	eb 05                	jmp    801beb <fd_alloc+0x4d>
+			return 0;
+  801be6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801beb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bee:	89 02                	mov    %eax,(%edx)
+}
+  801bf0:	89 c8                	mov    %ecx,%eax
+  801bf2:	5d                   	pop    %ebp
+  801bf3:	c3                   	ret
+
+00801bf4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801bf4:	55                   	push   %ebp
+  801bf5:	89 e5                	mov    %esp,%ebp
+  801bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801bfa:	83 f8 1f             	cmp    $0x1f,%eax
+  801bfd:	77 30                	ja     801c2f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801bff:	c1 e0 0c             	shl    $0xc,%eax
+  801c02:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801c07:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c0d:	f6 c2 01             	test   $0x1,%dl
+  801c10:	74 24                	je     801c36 <fd_lookup+0x42>
+  801c12:	89 c2                	mov    %eax,%edx
+  801c14:	c1 ea 0c             	shr    $0xc,%edx
+  801c17:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c1e:	f6 c2 01             	test   $0x1,%dl
+  801c21:	74 1a                	je     801c3d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c23:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c26:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c2d:	5d                   	pop    %ebp
+  801c2e:	c3                   	ret
+		return -E_INVAL;
+  801c2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c34:	eb f7                	jmp    801c2d <fd_lookup+0x39>
+		return -E_INVAL;
+  801c36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3b:	eb f0                	jmp    801c2d <fd_lookup+0x39>
+  801c3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c42:	eb e9                	jmp    801c2d <fd_lookup+0x39>
+
+00801c44 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	53                   	push   %ebx
+  801c48:	83 ec 04             	sub    $0x4,%esp
+  801c4b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c53:	eb 03                	jmp    801c58 <dev_lookup+0x14>
+  801c55:	83 c0 01             	add    $0x1,%eax
+  801c58:	8b 1c 85 14 36 80 00 	mov    0x803614(,%eax,4),%ebx
+  801c5f:	85 db                	test   %ebx,%ebx
+  801c61:	74 0b                	je     801c6e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801c63:	39 13                	cmp    %edx,(%ebx)
+  801c65:	75 ee                	jne    801c55 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6c:	eb 2e                	jmp    801c9c <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801c6e:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c70:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801c75:	8b 0d 20 50 81 02    	mov    0x2815020,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c7b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c80:	76 24                	jbe    801ca6 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c82:	8b 41 48             	mov    0x48(%ecx),%eax
+  801c85:	83 ec 04             	sub    $0x4,%esp
+  801c88:	52                   	push   %edx
+  801c89:	50                   	push   %eax
+  801c8a:	68 98 35 80 00       	push   $0x803598
+  801c8f:	e8 2d e9 ff ff       	call   8005c1 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801c94:	83 c4 10             	add    $0x10,%esp
+  801c97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801c9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c9f:	89 1a                	mov    %ebx,(%edx)
+}
+  801ca1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca4:	c9                   	leave
+  801ca5:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ca6:	c1 e8 10             	shr    $0x10,%eax
+  801ca9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801caf:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801cb5:	eb cb                	jmp    801c82 <dev_lookup+0x3e>
+
+00801cb7 <fd_close>:
+{
+  801cb7:	55                   	push   %ebp
+  801cb8:	89 e5                	mov    %esp,%ebp
+  801cba:	57                   	push   %edi
+  801cbb:	56                   	push   %esi
+  801cbc:	53                   	push   %ebx
+  801cbd:	83 ec 24             	sub    $0x24,%esp
+  801cc0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801cc6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cc9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801cca:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801cd0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801cd3:	50                   	push   %eax
+  801cd4:	e8 1b ff ff ff       	call   801bf4 <fd_lookup>
+  801cd9:	89 c3                	mov    %eax,%ebx
+  801cdb:	83 c4 10             	add    $0x10,%esp
+  801cde:	85 c0                	test   %eax,%eax
+  801ce0:	78 05                	js     801ce7 <fd_close+0x30>
+	    || fd != fd2)
+  801ce2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ce5:	74 16                	je     801cfd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ce7:	89 f8                	mov    %edi,%eax
+  801ce9:	84 c0                	test   %al,%al
+  801ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801cf3:	89 d8                	mov    %ebx,%eax
+  801cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf8:	5b                   	pop    %ebx
+  801cf9:	5e                   	pop    %esi
+  801cfa:	5f                   	pop    %edi
+  801cfb:	5d                   	pop    %ebp
+  801cfc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cfd:	83 ec 08             	sub    $0x8,%esp
+  801d00:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d03:	50                   	push   %eax
+  801d04:	ff 36                	push   (%esi)
+  801d06:	e8 39 ff ff ff       	call   801c44 <dev_lookup>
+  801d0b:	89 c3                	mov    %eax,%ebx
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	78 1a                	js     801d2e <fd_close+0x77>
+		if (dev->dev_close)
+  801d14:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d17:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	74 0b                	je     801d2e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801d23:	83 ec 0c             	sub    $0xc,%esp
+  801d26:	56                   	push   %esi
+  801d27:	ff d0                	call   *%eax
+  801d29:	89 c3                	mov    %eax,%ebx
+  801d2b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d2e:	83 ec 08             	sub    $0x8,%esp
+  801d31:	56                   	push   %esi
+  801d32:	6a 00                	push   $0x0
+  801d34:	e8 a3 f4 ff ff       	call   8011dc <sys_page_unmap>
+	return r;
+  801d39:	83 c4 10             	add    $0x10,%esp
+  801d3c:	eb b5                	jmp    801cf3 <fd_close+0x3c>
+
+00801d3e <close>:
+
+int
+close(int fdnum)
+{
+  801d3e:	55                   	push   %ebp
+  801d3f:	89 e5                	mov    %esp,%ebp
+  801d41:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d47:	50                   	push   %eax
+  801d48:	ff 75 08             	push   0x8(%ebp)
+  801d4b:	e8 a4 fe ff ff       	call   801bf4 <fd_lookup>
+  801d50:	83 c4 10             	add    $0x10,%esp
+  801d53:	85 c0                	test   %eax,%eax
+  801d55:	79 02                	jns    801d59 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+		return fd_close(fd, 1);
+  801d59:	83 ec 08             	sub    $0x8,%esp
+  801d5c:	6a 01                	push   $0x1
+  801d5e:	ff 75 f4             	push   -0xc(%ebp)
+  801d61:	e8 51 ff ff ff       	call   801cb7 <fd_close>
+  801d66:	83 c4 10             	add    $0x10,%esp
+  801d69:	eb ec                	jmp    801d57 <close+0x19>
+
+00801d6b <close_all>:
+
+void
+close_all(void)
+{
+  801d6b:	55                   	push   %ebp
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	53                   	push   %ebx
+  801d6f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801d72:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801d77:	83 ec 0c             	sub    $0xc,%esp
+  801d7a:	53                   	push   %ebx
+  801d7b:	e8 be ff ff ff       	call   801d3e <close>
+	for (i = 0; i < MAXFD; i++)
+  801d80:	83 c3 01             	add    $0x1,%ebx
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	83 fb 20             	cmp    $0x20,%ebx
+  801d89:	75 ec                	jne    801d77 <close_all+0xc>
+}
+  801d8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d8e:	c9                   	leave
+  801d8f:	c3                   	ret
+
+00801d90 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801d90:	55                   	push   %ebp
+  801d91:	89 e5                	mov    %esp,%ebp
+  801d93:	57                   	push   %edi
+  801d94:	56                   	push   %esi
+  801d95:	53                   	push   %ebx
+  801d96:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d99:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d9c:	50                   	push   %eax
+  801d9d:	ff 75 08             	push   0x8(%ebp)
+  801da0:	e8 4f fe ff ff       	call   801bf4 <fd_lookup>
+  801da5:	89 c3                	mov    %eax,%ebx
+  801da7:	83 c4 10             	add    $0x10,%esp
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 7f                	js     801e2d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801dae:	83 ec 0c             	sub    $0xc,%esp
+  801db1:	ff 75 0c             	push   0xc(%ebp)
+  801db4:	e8 85 ff ff ff       	call   801d3e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801db9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801dbc:	c1 e6 0c             	shl    $0xc,%esi
+  801dbf:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801dc5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801dc8:	89 3c 24             	mov    %edi,(%esp)
+  801dcb:	e8 b7 fd ff ff       	call   801b87 <fd2data>
+  801dd0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801dd2:	89 34 24             	mov    %esi,(%esp)
+  801dd5:	e8 ad fd ff ff       	call   801b87 <fd2data>
+  801dda:	83 c4 10             	add    $0x10,%esp
+  801ddd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801de0:	89 d8                	mov    %ebx,%eax
+  801de2:	c1 e8 16             	shr    $0x16,%eax
+  801de5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801dec:	a8 01                	test   $0x1,%al
+  801dee:	74 11                	je     801e01 <dup+0x71>
+  801df0:	89 d8                	mov    %ebx,%eax
+  801df2:	c1 e8 0c             	shr    $0xc,%eax
+  801df5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801dfc:	f6 c2 01             	test   $0x1,%dl
+  801dff:	75 36                	jne    801e37 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e01:	89 f8                	mov    %edi,%eax
+  801e03:	c1 e8 0c             	shr    $0xc,%eax
+  801e06:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e0d:	83 ec 0c             	sub    $0xc,%esp
+  801e10:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e15:	50                   	push   %eax
+  801e16:	56                   	push   %esi
+  801e17:	6a 00                	push   $0x0
+  801e19:	57                   	push   %edi
+  801e1a:	6a 00                	push   $0x0
+  801e1c:	e8 4d f3 ff ff       	call   80116e <sys_page_map>
+  801e21:	89 c3                	mov    %eax,%ebx
+  801e23:	83 c4 20             	add    $0x20,%esp
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 33                	js     801e5d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e2a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e2d:	89 d8                	mov    %ebx,%eax
+  801e2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e32:	5b                   	pop    %ebx
+  801e33:	5e                   	pop    %esi
+  801e34:	5f                   	pop    %edi
+  801e35:	5d                   	pop    %ebp
+  801e36:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e37:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e3e:	83 ec 0c             	sub    $0xc,%esp
+  801e41:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e46:	50                   	push   %eax
+  801e47:	ff 75 d4             	push   -0x2c(%ebp)
+  801e4a:	6a 00                	push   $0x0
+  801e4c:	53                   	push   %ebx
+  801e4d:	6a 00                	push   $0x0
+  801e4f:	e8 1a f3 ff ff       	call   80116e <sys_page_map>
+  801e54:	89 c3                	mov    %eax,%ebx
+  801e56:	83 c4 20             	add    $0x20,%esp
+  801e59:	85 c0                	test   %eax,%eax
+  801e5b:	79 a4                	jns    801e01 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e5d:	83 ec 08             	sub    $0x8,%esp
+  801e60:	56                   	push   %esi
+  801e61:	6a 00                	push   $0x0
+  801e63:	e8 74 f3 ff ff       	call   8011dc <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e68:	83 c4 08             	add    $0x8,%esp
+  801e6b:	ff 75 d4             	push   -0x2c(%ebp)
+  801e6e:	6a 00                	push   $0x0
+  801e70:	e8 67 f3 ff ff       	call   8011dc <sys_page_unmap>
+	return r;
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	eb b3                	jmp    801e2d <dup+0x9d>
+
+00801e7a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e7a:	55                   	push   %ebp
+  801e7b:	89 e5                	mov    %esp,%ebp
+  801e7d:	56                   	push   %esi
+  801e7e:	53                   	push   %ebx
+  801e7f:	83 ec 18             	sub    $0x18,%esp
+  801e82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e85:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e88:	50                   	push   %eax
+  801e89:	53                   	push   %ebx
+  801e8a:	e8 65 fd ff ff       	call   801bf4 <fd_lookup>
+  801e8f:	83 c4 10             	add    $0x10,%esp
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	78 3c                	js     801ed2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e96:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e99:	83 ec 08             	sub    $0x8,%esp
+  801e9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e9f:	50                   	push   %eax
+  801ea0:	ff 36                	push   (%esi)
+  801ea2:	e8 9d fd ff ff       	call   801c44 <dev_lookup>
+  801ea7:	83 c4 10             	add    $0x10,%esp
+  801eaa:	85 c0                	test   %eax,%eax
+  801eac:	78 24                	js     801ed2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801eae:	8b 46 08             	mov    0x8(%esi),%eax
+  801eb1:	83 e0 03             	and    $0x3,%eax
+  801eb4:	83 f8 01             	cmp    $0x1,%eax
+  801eb7:	74 20                	je     801ed9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801eb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ebc:	8b 40 08             	mov    0x8(%eax),%eax
+  801ebf:	85 c0                	test   %eax,%eax
+  801ec1:	74 57                	je     801f1a <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ec3:	83 ec 04             	sub    $0x4,%esp
+  801ec6:	ff 75 10             	push   0x10(%ebp)
+  801ec9:	ff 75 0c             	push   0xc(%ebp)
+  801ecc:	56                   	push   %esi
+  801ecd:	ff d0                	call   *%eax
+  801ecf:	83 c4 10             	add    $0x10,%esp
+}
+  801ed2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed5:	5b                   	pop    %ebx
+  801ed6:	5e                   	pop    %esi
+  801ed7:	5d                   	pop    %ebp
+  801ed8:	c3                   	ret
+  801ed9:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801edb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ee0:	8b 15 20 50 81 02    	mov    0x2815020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ee6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801eeb:	76 1c                	jbe    801f09 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eed:	8b 42 48             	mov    0x48(%edx),%eax
+  801ef0:	83 ec 04             	sub    $0x4,%esp
+  801ef3:	53                   	push   %ebx
+  801ef4:	50                   	push   %eax
+  801ef5:	68 d9 35 80 00       	push   $0x8035d9
+  801efa:	e8 c2 e6 ff ff       	call   8005c1 <cprintf>
+		return -E_INVAL;
+  801eff:	83 c4 10             	add    $0x10,%esp
+  801f02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f07:	eb c9                	jmp    801ed2 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801f09:	c1 e8 10             	shr    $0x10,%eax
+  801f0c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f12:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f18:	eb d3                	jmp    801eed <read+0x73>
+		return -E_NOT_SUPP;
+  801f1a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f1f:	eb b1                	jmp    801ed2 <read+0x58>
+
+00801f21 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	57                   	push   %edi
+  801f25:	56                   	push   %esi
+  801f26:	53                   	push   %ebx
+  801f27:	83 ec 0c             	sub    $0xc,%esp
+  801f2a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f2d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f35:	eb 02                	jmp    801f39 <readn+0x18>
+  801f37:	01 c3                	add    %eax,%ebx
+  801f39:	39 f3                	cmp    %esi,%ebx
+  801f3b:	73 21                	jae    801f5e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f3d:	83 ec 04             	sub    $0x4,%esp
+  801f40:	89 f0                	mov    %esi,%eax
+  801f42:	29 d8                	sub    %ebx,%eax
+  801f44:	50                   	push   %eax
+  801f45:	89 d8                	mov    %ebx,%eax
+  801f47:	03 45 0c             	add    0xc(%ebp),%eax
+  801f4a:	50                   	push   %eax
+  801f4b:	57                   	push   %edi
+  801f4c:	e8 29 ff ff ff       	call   801e7a <read>
+		if (m < 0)
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	78 04                	js     801f5c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801f58:	75 dd                	jne    801f37 <readn+0x16>
+  801f5a:	eb 02                	jmp    801f5e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f5c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801f5e:	89 d8                	mov    %ebx,%eax
+  801f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f63:	5b                   	pop    %ebx
+  801f64:	5e                   	pop    %esi
+  801f65:	5f                   	pop    %edi
+  801f66:	5d                   	pop    %ebp
+  801f67:	c3                   	ret
+
+00801f68 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f68:	55                   	push   %ebp
+  801f69:	89 e5                	mov    %esp,%ebp
+  801f6b:	56                   	push   %esi
+  801f6c:	53                   	push   %ebx
+  801f6d:	83 ec 18             	sub    $0x18,%esp
+  801f70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f73:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f76:	50                   	push   %eax
+  801f77:	53                   	push   %ebx
+  801f78:	e8 77 fc ff ff       	call   801bf4 <fd_lookup>
+  801f7d:	83 c4 10             	add    $0x10,%esp
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	78 37                	js     801fbb <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f84:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f87:	83 ec 08             	sub    $0x8,%esp
+  801f8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f8d:	50                   	push   %eax
+  801f8e:	ff 36                	push   (%esi)
+  801f90:	e8 af fc ff ff       	call   801c44 <dev_lookup>
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	78 1f                	js     801fbb <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f9c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fa0:	74 20                	je     801fc2 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801fa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fa5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	74 57                	je     802003 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801fac:	83 ec 04             	sub    $0x4,%esp
+  801faf:	ff 75 10             	push   0x10(%ebp)
+  801fb2:	ff 75 0c             	push   0xc(%ebp)
+  801fb5:	56                   	push   %esi
+  801fb6:	ff d0                	call   *%eax
+  801fb8:	83 c4 10             	add    $0x10,%esp
+}
+  801fbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fbe:	5b                   	pop    %ebx
+  801fbf:	5e                   	pop    %esi
+  801fc0:	5d                   	pop    %ebp
+  801fc1:	c3                   	ret
+  801fc2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fc4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801fc9:	8b 15 20 50 81 02    	mov    0x2815020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fcf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801fd4:	76 1c                	jbe    801ff2 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fd6:	8b 42 48             	mov    0x48(%edx),%eax
+  801fd9:	83 ec 04             	sub    $0x4,%esp
+  801fdc:	53                   	push   %ebx
+  801fdd:	50                   	push   %eax
+  801fde:	68 f5 35 80 00       	push   $0x8035f5
+  801fe3:	e8 d9 e5 ff ff       	call   8005c1 <cprintf>
+		return -E_INVAL;
+  801fe8:	83 c4 10             	add    $0x10,%esp
+  801feb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ff0:	eb c9                	jmp    801fbb <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ff2:	c1 e8 10             	shr    $0x10,%eax
+  801ff5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ffb:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802001:	eb d3                	jmp    801fd6 <write+0x6e>
+		return -E_NOT_SUPP;
+  802003:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802008:	eb b1                	jmp    801fbb <write+0x53>
+
+0080200a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802010:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802013:	50                   	push   %eax
+  802014:	ff 75 08             	push   0x8(%ebp)
+  802017:	e8 d8 fb ff ff       	call   801bf4 <fd_lookup>
+  80201c:	83 c4 10             	add    $0x10,%esp
+  80201f:	85 c0                	test   %eax,%eax
+  802021:	78 0e                	js     802031 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802023:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802026:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802029:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80202c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802031:	c9                   	leave
+  802032:	c3                   	ret
+
+00802033 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802033:	55                   	push   %ebp
+  802034:	89 e5                	mov    %esp,%ebp
+  802036:	56                   	push   %esi
+  802037:	53                   	push   %ebx
+  802038:	83 ec 18             	sub    $0x18,%esp
+  80203b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80203e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802041:	50                   	push   %eax
+  802042:	53                   	push   %ebx
+  802043:	e8 ac fb ff ff       	call   801bf4 <fd_lookup>
+  802048:	83 c4 10             	add    $0x10,%esp
+  80204b:	85 c0                	test   %eax,%eax
+  80204d:	78 34                	js     802083 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80204f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802052:	83 ec 08             	sub    $0x8,%esp
+  802055:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802058:	50                   	push   %eax
+  802059:	ff 36                	push   (%esi)
+  80205b:	e8 e4 fb ff ff       	call   801c44 <dev_lookup>
+  802060:	83 c4 10             	add    $0x10,%esp
+  802063:	85 c0                	test   %eax,%eax
+  802065:	78 1c                	js     802083 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802067:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80206b:	74 1d                	je     80208a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80206d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802070:	8b 40 18             	mov    0x18(%eax),%eax
+  802073:	85 c0                	test   %eax,%eax
+  802075:	74 54                	je     8020cb <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802077:	83 ec 08             	sub    $0x8,%esp
+  80207a:	ff 75 0c             	push   0xc(%ebp)
+  80207d:	56                   	push   %esi
+  80207e:	ff d0                	call   *%eax
+  802080:	83 c4 10             	add    $0x10,%esp
+}
+  802083:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802086:	5b                   	pop    %ebx
+  802087:	5e                   	pop    %esi
+  802088:	5d                   	pop    %ebp
+  802089:	c3                   	ret
+  80208a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80208c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802091:	8b 15 20 50 81 02    	mov    0x2815020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802097:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80209c:	76 1c                	jbe    8020ba <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  80209e:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020a1:	83 ec 04             	sub    $0x4,%esp
+  8020a4:	53                   	push   %ebx
+  8020a5:	50                   	push   %eax
+  8020a6:	68 b8 35 80 00       	push   $0x8035b8
+  8020ab:	e8 11 e5 ff ff       	call   8005c1 <cprintf>
+		return -E_INVAL;
+  8020b0:	83 c4 10             	add    $0x10,%esp
+  8020b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b8:	eb c9                	jmp    802083 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8020ba:	c1 e8 10             	shr    $0x10,%eax
+  8020bd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8020c3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8020c9:	eb d3                	jmp    80209e <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8020cb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020d0:	eb b1                	jmp    802083 <ftruncate+0x50>
+
+008020d2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8020d2:	55                   	push   %ebp
+  8020d3:	89 e5                	mov    %esp,%ebp
+  8020d5:	56                   	push   %esi
+  8020d6:	53                   	push   %ebx
+  8020d7:	83 ec 18             	sub    $0x18,%esp
+  8020da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020dd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020e0:	50                   	push   %eax
+  8020e1:	ff 75 08             	push   0x8(%ebp)
+  8020e4:	e8 0b fb ff ff       	call   801bf4 <fd_lookup>
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	85 c0                	test   %eax,%eax
+  8020ee:	78 49                	js     802139 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020f0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020f3:	83 ec 08             	sub    $0x8,%esp
+  8020f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f9:	50                   	push   %eax
+  8020fa:	ff 36                	push   (%esi)
+  8020fc:	e8 43 fb ff ff       	call   801c44 <dev_lookup>
+  802101:	83 c4 10             	add    $0x10,%esp
+  802104:	85 c0                	test   %eax,%eax
+  802106:	78 31                	js     802139 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802108:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80210b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80210f:	74 2f                	je     802140 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802111:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802114:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80211b:	00 00 00 
+	stat->st_isdir = 0;
+  80211e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802125:	00 00 00 
+	stat->st_dev = dev;
+  802128:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80212e:	83 ec 08             	sub    $0x8,%esp
+  802131:	53                   	push   %ebx
+  802132:	56                   	push   %esi
+  802133:	ff 50 14             	call   *0x14(%eax)
+  802136:	83 c4 10             	add    $0x10,%esp
+}
+  802139:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80213c:	5b                   	pop    %ebx
+  80213d:	5e                   	pop    %esi
+  80213e:	5d                   	pop    %ebp
+  80213f:	c3                   	ret
+		return -E_NOT_SUPP;
+  802140:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802145:	eb f2                	jmp    802139 <fstat+0x67>
+
+00802147 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802147:	55                   	push   %ebp
+  802148:	89 e5                	mov    %esp,%ebp
+  80214a:	56                   	push   %esi
+  80214b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80214c:	83 ec 08             	sub    $0x8,%esp
+  80214f:	6a 00                	push   $0x0
+  802151:	ff 75 08             	push   0x8(%ebp)
+  802154:	e8 e4 01 00 00       	call   80233d <open>
+  802159:	89 c3                	mov    %eax,%ebx
+  80215b:	83 c4 10             	add    $0x10,%esp
+  80215e:	85 c0                	test   %eax,%eax
+  802160:	78 1b                	js     80217d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802162:	83 ec 08             	sub    $0x8,%esp
+  802165:	ff 75 0c             	push   0xc(%ebp)
+  802168:	50                   	push   %eax
+  802169:	e8 64 ff ff ff       	call   8020d2 <fstat>
+  80216e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802170:	89 1c 24             	mov    %ebx,(%esp)
+  802173:	e8 c6 fb ff ff       	call   801d3e <close>
+	return r;
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	89 f3                	mov    %esi,%ebx
+}
+  80217d:	89 d8                	mov    %ebx,%eax
+  80217f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802182:	5b                   	pop    %ebx
+  802183:	5e                   	pop    %esi
+  802184:	5d                   	pop    %ebp
+  802185:	c3                   	ret
+
+00802186 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802186:	55                   	push   %ebp
+  802187:	89 e5                	mov    %esp,%ebp
+  802189:	56                   	push   %esi
+  80218a:	53                   	push   %ebx
+  80218b:	89 c6                	mov    %eax,%esi
+  80218d:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80218f:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  802196:	74 27                	je     8021bf <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802198:	6a 07                	push   $0x7
+  80219a:	68 00 60 81 02       	push   $0x2816000
+  80219f:	56                   	push   %esi
+  8021a0:	ff 35 00 50 80 00    	push   0x805000
+  8021a6:	e8 b2 0c 00 00       	call   802e5d <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8021ab:	83 c4 0c             	add    $0xc,%esp
+  8021ae:	6a 00                	push   $0x0
+  8021b0:	53                   	push   %ebx
+  8021b1:	6a 00                	push   $0x0
+  8021b3:	e8 8d 0c 00 00       	call   802e45 <ipc_recv>
+}
+  8021b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021bb:	5b                   	pop    %ebx
+  8021bc:	5e                   	pop    %esi
+  8021bd:	5d                   	pop    %ebp
+  8021be:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021bf:	83 ec 0c             	sub    $0xc,%esp
+  8021c2:	6a 01                	push   $0x1
+  8021c4:	e8 e8 0c 00 00       	call   802eb1 <ipc_find_env>
+  8021c9:	a3 00 50 80 00       	mov    %eax,0x805000
+  8021ce:	83 c4 10             	add    $0x10,%esp
+  8021d1:	eb c5                	jmp    802198 <fsipc+0x12>
+
+008021d3 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8021d3:	55                   	push   %ebp
+  8021d4:	89 e5                	mov    %esp,%ebp
+  8021d6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021dc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021df:	a3 00 60 81 02       	mov    %eax,0x2816000
+	fsipcbuf.set_size.req_size = newsize;
+  8021e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021e7:	a3 04 60 81 02       	mov    %eax,0x2816004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8021ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021f6:	e8 8b ff ff ff       	call   802186 <fsipc>
+}
+  8021fb:	c9                   	leave
+  8021fc:	c3                   	ret
+
+008021fd <devfile_flush>:
+{
+  8021fd:	55                   	push   %ebp
+  8021fe:	89 e5                	mov    %esp,%ebp
+  802200:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802203:	8b 45 08             	mov    0x8(%ebp),%eax
+  802206:	8b 40 0c             	mov    0xc(%eax),%eax
+  802209:	a3 00 60 81 02       	mov    %eax,0x2816000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80220e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802213:	b8 06 00 00 00       	mov    $0x6,%eax
+  802218:	e8 69 ff ff ff       	call   802186 <fsipc>
+}
+  80221d:	c9                   	leave
+  80221e:	c3                   	ret
+
+0080221f <devfile_stat>:
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	53                   	push   %ebx
+  802223:	83 ec 04             	sub    $0x4,%esp
+  802226:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80222f:	a3 00 60 81 02       	mov    %eax,0x2816000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802234:	ba 00 00 00 00       	mov    $0x0,%edx
+  802239:	b8 05 00 00 00       	mov    $0x5,%eax
+  80223e:	e8 43 ff ff ff       	call   802186 <fsipc>
+  802243:	85 c0                	test   %eax,%eax
+  802245:	78 2c                	js     802273 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802247:	83 ec 08             	sub    $0x8,%esp
+  80224a:	68 00 60 81 02       	push   $0x2816000
+  80224f:	53                   	push   %ebx
+  802250:	e8 b4 e9 ff ff       	call   800c09 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802255:	a1 80 60 81 02       	mov    0x2816080,%eax
+  80225a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802260:	a1 84 60 81 02       	mov    0x2816084,%eax
+  802265:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80226b:	83 c4 10             	add    $0x10,%esp
+  80226e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802273:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802276:	c9                   	leave
+  802277:	c3                   	ret
+
+00802278 <devfile_write>:
+{
+  802278:	55                   	push   %ebp
+  802279:	89 e5                	mov    %esp,%ebp
+  80227b:	83 ec 0c             	sub    $0xc,%esp
+  80227e:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802281:	8b 55 08             	mov    0x8(%ebp),%edx
+  802284:	8b 52 0c             	mov    0xc(%edx),%edx
+  802287:	89 15 00 60 81 02    	mov    %edx,0x2816000
+	fsipcbuf.write.req_n = n;
+  80228d:	a3 04 60 81 02       	mov    %eax,0x2816004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  802292:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802297:	39 d0                	cmp    %edx,%eax
+  802299:	0f 47 c2             	cmova  %edx,%eax
+  80229c:	50                   	push   %eax
+  80229d:	ff 75 0c             	push   0xc(%ebp)
+  8022a0:	68 08 60 81 02       	push   $0x2816008
+  8022a5:	e8 e5 ea ff ff       	call   800d8f <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8022aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022af:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022b4:	e8 cd fe ff ff       	call   802186 <fsipc>
+}
+  8022b9:	c9                   	leave
+  8022ba:	c3                   	ret
+
+008022bb <devfile_read>:
+{
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	56                   	push   %esi
+  8022bf:	53                   	push   %ebx
+  8022c0:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c9:	a3 00 60 81 02       	mov    %eax,0x2816000
+	fsipcbuf.read.req_n = n;
+  8022ce:	89 35 04 60 81 02    	mov    %esi,0x2816004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8022d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022de:	e8 a3 fe ff ff       	call   802186 <fsipc>
+  8022e3:	89 c3                	mov    %eax,%ebx
+  8022e5:	85 c0                	test   %eax,%eax
+  8022e7:	78 1f                	js     802308 <devfile_read+0x4d>
+	assert(r <= n);
+  8022e9:	39 c6                	cmp    %eax,%esi
+  8022eb:	72 24                	jb     802311 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8022ed:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022f2:	7f 33                	jg     802327 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022f4:	83 ec 04             	sub    $0x4,%esp
+  8022f7:	50                   	push   %eax
+  8022f8:	68 00 60 81 02       	push   $0x2816000
+  8022fd:	ff 75 0c             	push   0xc(%ebp)
+  802300:	e8 8a ea ff ff       	call   800d8f <memmove>
+	return r;
+  802305:	83 c4 10             	add    $0x10,%esp
+}
+  802308:	89 d8                	mov    %ebx,%eax
+  80230a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80230d:	5b                   	pop    %ebx
+  80230e:	5e                   	pop    %esi
+  80230f:	5d                   	pop    %ebp
+  802310:	c3                   	ret
+	assert(r <= n);
+  802311:	68 28 36 80 00       	push   $0x803628
+  802316:	68 4d 2f 80 00       	push   $0x802f4d
+  80231b:	6a 76                	push   $0x76
+  80231d:	68 2f 36 80 00       	push   $0x80362f
+  802322:	e8 bf e1 ff ff       	call   8004e6 <_panic>
+	assert(r <= PGSIZE);
+  802327:	68 3a 36 80 00       	push   $0x80363a
+  80232c:	68 4d 2f 80 00       	push   $0x802f4d
+  802331:	6a 77                	push   $0x77
+  802333:	68 2f 36 80 00       	push   $0x80362f
+  802338:	e8 a9 e1 ff ff       	call   8004e6 <_panic>
+
+0080233d <open>:
+{
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	56                   	push   %esi
+  802341:	53                   	push   %ebx
+  802342:	83 ec 1c             	sub    $0x1c,%esp
+  802345:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802348:	56                   	push   %esi
+  802349:	e8 80 e8 ff ff       	call   800bce <strlen>
+  80234e:	83 c4 10             	add    $0x10,%esp
+  802351:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802356:	7f 6c                	jg     8023c4 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802358:	83 ec 0c             	sub    $0xc,%esp
+  80235b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80235e:	50                   	push   %eax
+  80235f:	e8 3a f8 ff ff       	call   801b9e <fd_alloc>
+  802364:	89 c3                	mov    %eax,%ebx
+  802366:	83 c4 10             	add    $0x10,%esp
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	78 3c                	js     8023a9 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80236d:	83 ec 08             	sub    $0x8,%esp
+  802370:	56                   	push   %esi
+  802371:	68 00 60 81 02       	push   $0x2816000
+  802376:	e8 8e e8 ff ff       	call   800c09 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80237b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80237e:	a3 00 64 81 02       	mov    %eax,0x2816400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802383:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802386:	b8 01 00 00 00       	mov    $0x1,%eax
+  80238b:	e8 f6 fd ff ff       	call   802186 <fsipc>
+  802390:	89 c3                	mov    %eax,%ebx
+  802392:	83 c4 10             	add    $0x10,%esp
+  802395:	85 c0                	test   %eax,%eax
+  802397:	78 19                	js     8023b2 <open+0x75>
+	return fd2num(fd);
+  802399:	83 ec 0c             	sub    $0xc,%esp
+  80239c:	ff 75 f4             	push   -0xc(%ebp)
+  80239f:	e8 d3 f7 ff ff       	call   801b77 <fd2num>
+  8023a4:	89 c3                	mov    %eax,%ebx
+  8023a6:	83 c4 10             	add    $0x10,%esp
+}
+  8023a9:	89 d8                	mov    %ebx,%eax
+  8023ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ae:	5b                   	pop    %ebx
+  8023af:	5e                   	pop    %esi
+  8023b0:	5d                   	pop    %ebp
+  8023b1:	c3                   	ret
+		fd_close(fd, 0);
+  8023b2:	83 ec 08             	sub    $0x8,%esp
+  8023b5:	6a 00                	push   $0x0
+  8023b7:	ff 75 f4             	push   -0xc(%ebp)
+  8023ba:	e8 f8 f8 ff ff       	call   801cb7 <fd_close>
+		return r;
+  8023bf:	83 c4 10             	add    $0x10,%esp
+  8023c2:	eb e5                	jmp    8023a9 <open+0x6c>
+		return -E_BAD_PATH;
+  8023c4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023c9:	eb de                	jmp    8023a9 <open+0x6c>
+
+008023cb <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8023d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023db:	e8 a6 fd ff ff       	call   802186 <fsipc>
+}
+  8023e0:	c9                   	leave
+  8023e1:	c3                   	ret
+
+008023e2 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023e2:	55                   	push   %ebp
+  8023e3:	89 e5                	mov    %esp,%ebp
+  8023e5:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8023e8:	68 46 36 80 00       	push   $0x803646
+  8023ed:	ff 75 0c             	push   0xc(%ebp)
+  8023f0:	e8 14 e8 ff ff       	call   800c09 <strcpy>
+	return 0;
+}
+  8023f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fa:	c9                   	leave
+  8023fb:	c3                   	ret
+
+008023fc <devsock_close>:
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	53                   	push   %ebx
+  802400:	83 ec 10             	sub    $0x10,%esp
+  802403:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802406:	53                   	push   %ebx
+  802407:	e8 e4 0a 00 00       	call   802ef0 <pageref>
+  80240c:	89 c2                	mov    %eax,%edx
+  80240e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802411:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802416:	83 fa 01             	cmp    $0x1,%edx
+  802419:	74 05                	je     802420 <devsock_close+0x24>
+}
+  80241b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80241e:	c9                   	leave
+  80241f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802420:	83 ec 0c             	sub    $0xc,%esp
+  802423:	ff 73 0c             	push   0xc(%ebx)
+  802426:	e8 b7 02 00 00       	call   8026e2 <nsipc_close>
+  80242b:	83 c4 10             	add    $0x10,%esp
+  80242e:	eb eb                	jmp    80241b <devsock_close+0x1f>
+
+00802430 <devsock_write>:
+{
+  802430:	55                   	push   %ebp
+  802431:	89 e5                	mov    %esp,%ebp
+  802433:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802436:	6a 00                	push   $0x0
+  802438:	ff 75 10             	push   0x10(%ebp)
+  80243b:	ff 75 0c             	push   0xc(%ebp)
+  80243e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802441:	ff 70 0c             	push   0xc(%eax)
+  802444:	e8 79 03 00 00       	call   8027c2 <nsipc_send>
+}
+  802449:	c9                   	leave
+  80244a:	c3                   	ret
+
+0080244b <devsock_read>:
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802451:	6a 00                	push   $0x0
+  802453:	ff 75 10             	push   0x10(%ebp)
+  802456:	ff 75 0c             	push   0xc(%ebp)
+  802459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245c:	ff 70 0c             	push   0xc(%eax)
+  80245f:	e8 ef 02 00 00       	call   802753 <nsipc_recv>
+}
+  802464:	c9                   	leave
+  802465:	c3                   	ret
+
+00802466 <fd2sockid>:
+{
+  802466:	55                   	push   %ebp
+  802467:	89 e5                	mov    %esp,%ebp
+  802469:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80246c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80246f:	52                   	push   %edx
+  802470:	50                   	push   %eax
+  802471:	e8 7e f7 ff ff       	call   801bf4 <fd_lookup>
+  802476:	83 c4 10             	add    $0x10,%esp
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	78 10                	js     80248d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80247d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802480:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  802486:	39 08                	cmp    %ecx,(%eax)
+  802488:	75 05                	jne    80248f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80248a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80248d:	c9                   	leave
+  80248e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80248f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802494:	eb f7                	jmp    80248d <fd2sockid+0x27>
+
+00802496 <alloc_sockfd>:
+{
+  802496:	55                   	push   %ebp
+  802497:	89 e5                	mov    %esp,%ebp
+  802499:	56                   	push   %esi
+  80249a:	53                   	push   %ebx
+  80249b:	83 ec 1c             	sub    $0x1c,%esp
+  80249e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8024a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024a3:	50                   	push   %eax
+  8024a4:	e8 f5 f6 ff ff       	call   801b9e <fd_alloc>
+  8024a9:	89 c3                	mov    %eax,%ebx
+  8024ab:	83 c4 10             	add    $0x10,%esp
+  8024ae:	85 c0                	test   %eax,%eax
+  8024b0:	78 43                	js     8024f5 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8024b2:	83 ec 04             	sub    $0x4,%esp
+  8024b5:	68 07 04 00 00       	push   $0x407
+  8024ba:	ff 75 f4             	push   -0xc(%ebp)
+  8024bd:	6a 00                	push   $0x0
+  8024bf:	e8 3d ec ff ff       	call   801101 <sys_page_alloc>
+  8024c4:	89 c3                	mov    %eax,%ebx
+  8024c6:	83 c4 10             	add    $0x10,%esp
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	78 28                	js     8024f5 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8024cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d0:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  8024d6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8024d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024db:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8024e2:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8024e5:	83 ec 0c             	sub    $0xc,%esp
+  8024e8:	50                   	push   %eax
+  8024e9:	e8 89 f6 ff ff       	call   801b77 <fd2num>
+  8024ee:	89 c3                	mov    %eax,%ebx
+  8024f0:	83 c4 10             	add    $0x10,%esp
+  8024f3:	eb 0c                	jmp    802501 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8024f5:	83 ec 0c             	sub    $0xc,%esp
+  8024f8:	56                   	push   %esi
+  8024f9:	e8 e4 01 00 00       	call   8026e2 <nsipc_close>
+		return r;
+  8024fe:	83 c4 10             	add    $0x10,%esp
+}
+  802501:	89 d8                	mov    %ebx,%eax
+  802503:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802506:	5b                   	pop    %ebx
+  802507:	5e                   	pop    %esi
+  802508:	5d                   	pop    %ebp
+  802509:	c3                   	ret
+
+0080250a <accept>:
+{
+  80250a:	55                   	push   %ebp
+  80250b:	89 e5                	mov    %esp,%ebp
+  80250d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802510:	8b 45 08             	mov    0x8(%ebp),%eax
+  802513:	e8 4e ff ff ff       	call   802466 <fd2sockid>
+  802518:	85 c0                	test   %eax,%eax
+  80251a:	78 1b                	js     802537 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80251c:	83 ec 04             	sub    $0x4,%esp
+  80251f:	ff 75 10             	push   0x10(%ebp)
+  802522:	ff 75 0c             	push   0xc(%ebp)
+  802525:	50                   	push   %eax
+  802526:	e8 0e 01 00 00       	call   802639 <nsipc_accept>
+  80252b:	83 c4 10             	add    $0x10,%esp
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	78 05                	js     802537 <accept+0x2d>
+	return alloc_sockfd(r);
+  802532:	e8 5f ff ff ff       	call   802496 <alloc_sockfd>
+}
+  802537:	c9                   	leave
+  802538:	c3                   	ret
+
+00802539 <bind>:
+{
+  802539:	55                   	push   %ebp
+  80253a:	89 e5                	mov    %esp,%ebp
+  80253c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80253f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802542:	e8 1f ff ff ff       	call   802466 <fd2sockid>
+  802547:	85 c0                	test   %eax,%eax
+  802549:	78 12                	js     80255d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80254b:	83 ec 04             	sub    $0x4,%esp
+  80254e:	ff 75 10             	push   0x10(%ebp)
+  802551:	ff 75 0c             	push   0xc(%ebp)
+  802554:	50                   	push   %eax
+  802555:	e8 31 01 00 00       	call   80268b <nsipc_bind>
+  80255a:	83 c4 10             	add    $0x10,%esp
+}
+  80255d:	c9                   	leave
+  80255e:	c3                   	ret
+
+0080255f <shutdown>:
+{
+  80255f:	55                   	push   %ebp
+  802560:	89 e5                	mov    %esp,%ebp
+  802562:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802565:	8b 45 08             	mov    0x8(%ebp),%eax
+  802568:	e8 f9 fe ff ff       	call   802466 <fd2sockid>
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	78 0f                	js     802580 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802571:	83 ec 08             	sub    $0x8,%esp
+  802574:	ff 75 0c             	push   0xc(%ebp)
+  802577:	50                   	push   %eax
+  802578:	e8 43 01 00 00       	call   8026c0 <nsipc_shutdown>
+  80257d:	83 c4 10             	add    $0x10,%esp
+}
+  802580:	c9                   	leave
+  802581:	c3                   	ret
+
+00802582 <connect>:
+{
+  802582:	55                   	push   %ebp
+  802583:	89 e5                	mov    %esp,%ebp
+  802585:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802588:	8b 45 08             	mov    0x8(%ebp),%eax
+  80258b:	e8 d6 fe ff ff       	call   802466 <fd2sockid>
+  802590:	85 c0                	test   %eax,%eax
+  802592:	78 12                	js     8025a6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802594:	83 ec 04             	sub    $0x4,%esp
+  802597:	ff 75 10             	push   0x10(%ebp)
+  80259a:	ff 75 0c             	push   0xc(%ebp)
+  80259d:	50                   	push   %eax
+  80259e:	e8 59 01 00 00       	call   8026fc <nsipc_connect>
+  8025a3:	83 c4 10             	add    $0x10,%esp
+}
+  8025a6:	c9                   	leave
+  8025a7:	c3                   	ret
+
+008025a8 <listen>:
+{
+  8025a8:	55                   	push   %ebp
+  8025a9:	89 e5                	mov    %esp,%ebp
+  8025ab:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b1:	e8 b0 fe ff ff       	call   802466 <fd2sockid>
+  8025b6:	85 c0                	test   %eax,%eax
+  8025b8:	78 0f                	js     8025c9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8025ba:	83 ec 08             	sub    $0x8,%esp
+  8025bd:	ff 75 0c             	push   0xc(%ebp)
+  8025c0:	50                   	push   %eax
+  8025c1:	e8 6b 01 00 00       	call   802731 <nsipc_listen>
+  8025c6:	83 c4 10             	add    $0x10,%esp
+}
+  8025c9:	c9                   	leave
+  8025ca:	c3                   	ret
+
+008025cb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8025cb:	55                   	push   %ebp
+  8025cc:	89 e5                	mov    %esp,%ebp
+  8025ce:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8025d1:	ff 75 10             	push   0x10(%ebp)
+  8025d4:	ff 75 0c             	push   0xc(%ebp)
+  8025d7:	ff 75 08             	push   0x8(%ebp)
+  8025da:	e8 41 02 00 00       	call   802820 <nsipc_socket>
+  8025df:	83 c4 10             	add    $0x10,%esp
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	78 05                	js     8025eb <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8025e6:	e8 ab fe ff ff       	call   802496 <alloc_sockfd>
+}
+  8025eb:	c9                   	leave
+  8025ec:	c3                   	ret
+
+008025ed <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8025ed:	55                   	push   %ebp
+  8025ee:	89 e5                	mov    %esp,%ebp
+  8025f0:	53                   	push   %ebx
+  8025f1:	83 ec 04             	sub    $0x4,%esp
+  8025f4:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8025f6:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8025fd:	74 26                	je     802625 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8025ff:	6a 07                	push   $0x7
+  802601:	68 00 70 81 02       	push   $0x2817000
+  802606:	53                   	push   %ebx
+  802607:	ff 35 04 50 80 00    	push   0x805004
+  80260d:	e8 4b 08 00 00       	call   802e5d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802612:	83 c4 0c             	add    $0xc,%esp
+  802615:	6a 00                	push   $0x0
+  802617:	6a 00                	push   $0x0
+  802619:	6a 00                	push   $0x0
+  80261b:	e8 25 08 00 00       	call   802e45 <ipc_recv>
+}
+  802620:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802623:	c9                   	leave
+  802624:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802625:	83 ec 0c             	sub    $0xc,%esp
+  802628:	6a 02                	push   $0x2
+  80262a:	e8 82 08 00 00       	call   802eb1 <ipc_find_env>
+  80262f:	a3 04 50 80 00       	mov    %eax,0x805004
+  802634:	83 c4 10             	add    $0x10,%esp
+  802637:	eb c6                	jmp    8025ff <nsipc+0x12>
+
+00802639 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802639:	55                   	push   %ebp
+  80263a:	89 e5                	mov    %esp,%ebp
+  80263c:	56                   	push   %esi
+  80263d:	53                   	push   %ebx
+  80263e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802641:	8b 45 08             	mov    0x8(%ebp),%eax
+  802644:	a3 00 70 81 02       	mov    %eax,0x2817000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802649:	8b 06                	mov    (%esi),%eax
+  80264b:	a3 04 70 81 02       	mov    %eax,0x2817004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802650:	b8 01 00 00 00       	mov    $0x1,%eax
+  802655:	e8 93 ff ff ff       	call   8025ed <nsipc>
+  80265a:	89 c3                	mov    %eax,%ebx
+  80265c:	85 c0                	test   %eax,%eax
+  80265e:	79 09                	jns    802669 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802660:	89 d8                	mov    %ebx,%eax
+  802662:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802665:	5b                   	pop    %ebx
+  802666:	5e                   	pop    %esi
+  802667:	5d                   	pop    %ebp
+  802668:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802669:	83 ec 04             	sub    $0x4,%esp
+  80266c:	ff 35 10 70 81 02    	push   0x2817010
+  802672:	68 00 70 81 02       	push   $0x2817000
+  802677:	ff 75 0c             	push   0xc(%ebp)
+  80267a:	e8 10 e7 ff ff       	call   800d8f <memmove>
+		*addrlen = ret->ret_addrlen;
+  80267f:	a1 10 70 81 02       	mov    0x2817010,%eax
+  802684:	89 06                	mov    %eax,(%esi)
+  802686:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802689:	eb d5                	jmp    802660 <nsipc_accept+0x27>
+
+0080268b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80268b:	55                   	push   %ebp
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	53                   	push   %ebx
+  80268f:	83 ec 08             	sub    $0x8,%esp
+  802692:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802695:	8b 45 08             	mov    0x8(%ebp),%eax
+  802698:	a3 00 70 81 02       	mov    %eax,0x2817000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80269d:	53                   	push   %ebx
+  80269e:	ff 75 0c             	push   0xc(%ebp)
+  8026a1:	68 04 70 81 02       	push   $0x2817004
+  8026a6:	e8 e4 e6 ff ff       	call   800d8f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8026ab:	89 1d 14 70 81 02    	mov    %ebx,0x2817014
+	return nsipc(NSREQ_BIND);
+  8026b1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8026b6:	e8 32 ff ff ff       	call   8025ed <nsipc>
+}
+  8026bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026be:	c9                   	leave
+  8026bf:	c3                   	ret
+
+008026c0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8026c0:	55                   	push   %ebp
+  8026c1:	89 e5                	mov    %esp,%ebp
+  8026c3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8026c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c9:	a3 00 70 81 02       	mov    %eax,0x2817000
+	nsipcbuf.shutdown.req_how = how;
+  8026ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026d1:	a3 04 70 81 02       	mov    %eax,0x2817004
+	return nsipc(NSREQ_SHUTDOWN);
+  8026d6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026db:	e8 0d ff ff ff       	call   8025ed <nsipc>
+}
+  8026e0:	c9                   	leave
+  8026e1:	c3                   	ret
+
+008026e2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8026e2:	55                   	push   %ebp
+  8026e3:	89 e5                	mov    %esp,%ebp
+  8026e5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8026e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026eb:	a3 00 70 81 02       	mov    %eax,0x2817000
+	return nsipc(NSREQ_CLOSE);
+  8026f0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026f5:	e8 f3 fe ff ff       	call   8025ed <nsipc>
+}
+  8026fa:	c9                   	leave
+  8026fb:	c3                   	ret
+
+008026fc <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8026fc:	55                   	push   %ebp
+  8026fd:	89 e5                	mov    %esp,%ebp
+  8026ff:	53                   	push   %ebx
+  802700:	83 ec 08             	sub    $0x8,%esp
+  802703:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802706:	8b 45 08             	mov    0x8(%ebp),%eax
+  802709:	a3 00 70 81 02       	mov    %eax,0x2817000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80270e:	53                   	push   %ebx
+  80270f:	ff 75 0c             	push   0xc(%ebp)
+  802712:	68 04 70 81 02       	push   $0x2817004
+  802717:	e8 73 e6 ff ff       	call   800d8f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80271c:	89 1d 14 70 81 02    	mov    %ebx,0x2817014
+	return nsipc(NSREQ_CONNECT);
+  802722:	b8 05 00 00 00       	mov    $0x5,%eax
+  802727:	e8 c1 fe ff ff       	call   8025ed <nsipc>
+}
+  80272c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272f:	c9                   	leave
+  802730:	c3                   	ret
+
+00802731 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802731:	55                   	push   %ebp
+  802732:	89 e5                	mov    %esp,%ebp
+  802734:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802737:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273a:	a3 00 70 81 02       	mov    %eax,0x2817000
+	nsipcbuf.listen.req_backlog = backlog;
+  80273f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802742:	a3 04 70 81 02       	mov    %eax,0x2817004
+	return nsipc(NSREQ_LISTEN);
+  802747:	b8 06 00 00 00       	mov    $0x6,%eax
+  80274c:	e8 9c fe ff ff       	call   8025ed <nsipc>
+}
+  802751:	c9                   	leave
+  802752:	c3                   	ret
+
+00802753 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802753:	55                   	push   %ebp
+  802754:	89 e5                	mov    %esp,%ebp
+  802756:	56                   	push   %esi
+  802757:	53                   	push   %ebx
+  802758:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80275b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275e:	a3 00 70 81 02       	mov    %eax,0x2817000
+	nsipcbuf.recv.req_len = len;
+  802763:	89 35 04 70 81 02    	mov    %esi,0x2817004
+	nsipcbuf.recv.req_flags = flags;
+  802769:	8b 45 14             	mov    0x14(%ebp),%eax
+  80276c:	a3 08 70 81 02       	mov    %eax,0x2817008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802771:	b8 07 00 00 00       	mov    $0x7,%eax
+  802776:	e8 72 fe ff ff       	call   8025ed <nsipc>
+  80277b:	89 c3                	mov    %eax,%ebx
+  80277d:	85 c0                	test   %eax,%eax
+  80277f:	78 22                	js     8027a3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802781:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802786:	39 c6                	cmp    %eax,%esi
+  802788:	0f 4e c6             	cmovle %esi,%eax
+  80278b:	39 c3                	cmp    %eax,%ebx
+  80278d:	7f 1d                	jg     8027ac <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80278f:	83 ec 04             	sub    $0x4,%esp
+  802792:	53                   	push   %ebx
+  802793:	68 00 70 81 02       	push   $0x2817000
+  802798:	ff 75 0c             	push   0xc(%ebp)
+  80279b:	e8 ef e5 ff ff       	call   800d8f <memmove>
+  8027a0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8027a3:	89 d8                	mov    %ebx,%eax
+  8027a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a8:	5b                   	pop    %ebx
+  8027a9:	5e                   	pop    %esi
+  8027aa:	5d                   	pop    %ebp
+  8027ab:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8027ac:	68 52 36 80 00       	push   $0x803652
+  8027b1:	68 4d 2f 80 00       	push   $0x802f4d
+  8027b6:	6a 62                	push   $0x62
+  8027b8:	68 67 36 80 00       	push   $0x803667
+  8027bd:	e8 24 dd ff ff       	call   8004e6 <_panic>
+
+008027c2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8027c2:	55                   	push   %ebp
+  8027c3:	89 e5                	mov    %esp,%ebp
+  8027c5:	53                   	push   %ebx
+  8027c6:	83 ec 04             	sub    $0x4,%esp
+  8027c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8027cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027cf:	a3 00 70 81 02       	mov    %eax,0x2817000
+	assert(size < 1600);
+  8027d4:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8027da:	7f 2e                	jg     80280a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8027dc:	83 ec 04             	sub    $0x4,%esp
+  8027df:	53                   	push   %ebx
+  8027e0:	ff 75 0c             	push   0xc(%ebp)
+  8027e3:	68 0c 70 81 02       	push   $0x281700c
+  8027e8:	e8 a2 e5 ff ff       	call   800d8f <memmove>
+	nsipcbuf.send.req_size = size;
+  8027ed:	89 1d 04 70 81 02    	mov    %ebx,0x2817004
+	nsipcbuf.send.req_flags = flags;
+  8027f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027f6:	a3 08 70 81 02       	mov    %eax,0x2817008
+	return nsipc(NSREQ_SEND);
+  8027fb:	b8 08 00 00 00       	mov    $0x8,%eax
+  802800:	e8 e8 fd ff ff       	call   8025ed <nsipc>
+}
+  802805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802808:	c9                   	leave
+  802809:	c3                   	ret
+	assert(size < 1600);
+  80280a:	68 73 36 80 00       	push   $0x803673
+  80280f:	68 4d 2f 80 00       	push   $0x802f4d
+  802814:	6a 6d                	push   $0x6d
+  802816:	68 67 36 80 00       	push   $0x803667
+  80281b:	e8 c6 dc ff ff       	call   8004e6 <_panic>
+
+00802820 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802820:	55                   	push   %ebp
+  802821:	89 e5                	mov    %esp,%ebp
+  802823:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802826:	8b 45 08             	mov    0x8(%ebp),%eax
+  802829:	a3 00 70 81 02       	mov    %eax,0x2817000
+	nsipcbuf.socket.req_type = type;
+  80282e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802831:	a3 04 70 81 02       	mov    %eax,0x2817004
+	nsipcbuf.socket.req_protocol = protocol;
+  802836:	8b 45 10             	mov    0x10(%ebp),%eax
+  802839:	a3 08 70 81 02       	mov    %eax,0x2817008
+	return nsipc(NSREQ_SOCKET);
+  80283e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802843:	e8 a5 fd ff ff       	call   8025ed <nsipc>
+}
+  802848:	c9                   	leave
+  802849:	c3                   	ret
+
+0080284a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80284a:	55                   	push   %ebp
+  80284b:	89 e5                	mov    %esp,%ebp
+  80284d:	56                   	push   %esi
+  80284e:	53                   	push   %ebx
+  80284f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802852:	83 ec 0c             	sub    $0xc,%esp
+  802855:	ff 75 08             	push   0x8(%ebp)
+  802858:	e8 2a f3 ff ff       	call   801b87 <fd2data>
+  80285d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80285f:	83 c4 08             	add    $0x8,%esp
+  802862:	68 7f 36 80 00       	push   $0x80367f
+  802867:	53                   	push   %ebx
+  802868:	e8 9c e3 ff ff       	call   800c09 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80286d:	8b 46 04             	mov    0x4(%esi),%eax
+  802870:	2b 06                	sub    (%esi),%eax
+  802872:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802878:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80287f:	00 00 00 
+	stat->st_dev = &devpipe;
+  802882:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  802889:	40 80 00 
+	return 0;
+}
+  80288c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802891:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802894:	5b                   	pop    %ebx
+  802895:	5e                   	pop    %esi
+  802896:	5d                   	pop    %ebp
+  802897:	c3                   	ret
+
+00802898 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802898:	55                   	push   %ebp
+  802899:	89 e5                	mov    %esp,%ebp
+  80289b:	53                   	push   %ebx
+  80289c:	83 ec 0c             	sub    $0xc,%esp
+  80289f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8028a2:	53                   	push   %ebx
+  8028a3:	6a 00                	push   $0x0
+  8028a5:	e8 32 e9 ff ff       	call   8011dc <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8028aa:	89 1c 24             	mov    %ebx,(%esp)
+  8028ad:	e8 d5 f2 ff ff       	call   801b87 <fd2data>
+  8028b2:	83 c4 08             	add    $0x8,%esp
+  8028b5:	50                   	push   %eax
+  8028b6:	6a 00                	push   $0x0
+  8028b8:	e8 1f e9 ff ff       	call   8011dc <sys_page_unmap>
+}
+  8028bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028c0:	c9                   	leave
+  8028c1:	c3                   	ret
+
+008028c2 <_pipeisclosed>:
+{
+  8028c2:	55                   	push   %ebp
+  8028c3:	89 e5                	mov    %esp,%ebp
+  8028c5:	57                   	push   %edi
+  8028c6:	56                   	push   %esi
+  8028c7:	53                   	push   %ebx
+  8028c8:	83 ec 1c             	sub    $0x1c,%esp
+  8028cb:	89 c7                	mov    %eax,%edi
+  8028cd:	89 d6                	mov    %edx,%esi
+  8028cf:	eb 3c                	jmp    80290d <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8028d1:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8028d4:	83 ec 0c             	sub    $0xc,%esp
+  8028d7:	57                   	push   %edi
+  8028d8:	e8 13 06 00 00       	call   802ef0 <pageref>
+  8028dd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028e0:	89 34 24             	mov    %esi,(%esp)
+  8028e3:	e8 08 06 00 00       	call   802ef0 <pageref>
+  8028e8:	89 c2                	mov    %eax,%edx
+  8028ea:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8028ec:	05 00 00 00 20       	add    $0x20000000,%eax
+  8028f1:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8028f4:	8b 0d 20 50 81 02    	mov    0x2815020,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8028fa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8028ff:	76 31                	jbe    802932 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802901:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802904:	39 c3                	cmp    %eax,%ebx
+  802906:	74 76                	je     80297e <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802908:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80290b:	74 36                	je     802943 <_pipeisclosed+0x81>
+  80290d:	89 e0                	mov    %esp,%eax
+  80290f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802914:	8b 15 20 50 81 02    	mov    0x2815020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80291a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80291f:	77 b0                	ja     8028d1 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802921:	c1 e8 10             	shr    $0x10,%eax
+  802924:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80292a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802930:	eb 9f                	jmp    8028d1 <_pipeisclosed+0xf>
+  802932:	c1 e8 10             	shr    $0x10,%eax
+  802935:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80293b:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802941:	eb be                	jmp    802901 <_pipeisclosed+0x3f>
+  802943:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802945:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80294a:	8b 15 20 50 81 02    	mov    0x2815020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802950:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802955:	76 16                	jbe    80296d <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802957:	8b 42 58             	mov    0x58(%edx),%eax
+  80295a:	6a 01                	push   $0x1
+  80295c:	50                   	push   %eax
+  80295d:	53                   	push   %ebx
+  80295e:	68 86 36 80 00       	push   $0x803686
+  802963:	e8 59 dc ff ff       	call   8005c1 <cprintf>
+  802968:	83 c4 10             	add    $0x10,%esp
+  80296b:	eb a0                	jmp    80290d <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80296d:	c1 e8 10             	shr    $0x10,%eax
+  802970:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802976:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80297c:	eb d9                	jmp    802957 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80297e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802981:	0f 94 c0             	sete   %al
+  802984:	0f b6 c0             	movzbl %al,%eax
+}
+  802987:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80298a:	5b                   	pop    %ebx
+  80298b:	5e                   	pop    %esi
+  80298c:	5f                   	pop    %edi
+  80298d:	5d                   	pop    %ebp
+  80298e:	c3                   	ret
+
+0080298f <devpipe_write>:
+{
+  80298f:	55                   	push   %ebp
+  802990:	89 e5                	mov    %esp,%ebp
+  802992:	57                   	push   %edi
+  802993:	56                   	push   %esi
+  802994:	53                   	push   %ebx
+  802995:	83 ec 28             	sub    $0x28,%esp
+  802998:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80299b:	56                   	push   %esi
+  80299c:	e8 e6 f1 ff ff       	call   801b87 <fd2data>
+  8029a1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8029a3:	83 c4 10             	add    $0x10,%esp
+  8029a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ab:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8029ae:	75 09                	jne    8029b9 <devpipe_write+0x2a>
+	return i;
+  8029b0:	89 f8                	mov    %edi,%eax
+  8029b2:	eb 23                	jmp    8029d7 <devpipe_write+0x48>
+			sys_yield();
+  8029b4:	e8 02 e7 ff ff       	call   8010bb <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8029b9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029bc:	8b 0b                	mov    (%ebx),%ecx
+  8029be:	8d 51 20             	lea    0x20(%ecx),%edx
+  8029c1:	39 d0                	cmp    %edx,%eax
+  8029c3:	72 1a                	jb     8029df <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8029c5:	89 da                	mov    %ebx,%edx
+  8029c7:	89 f0                	mov    %esi,%eax
+  8029c9:	e8 f4 fe ff ff       	call   8028c2 <_pipeisclosed>
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	74 e2                	je     8029b4 <devpipe_write+0x25>
+				return 0;
+  8029d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029da:	5b                   	pop    %ebx
+  8029db:	5e                   	pop    %esi
+  8029dc:	5f                   	pop    %edi
+  8029dd:	5d                   	pop    %ebp
+  8029de:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8029df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029e2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8029e6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8029e9:	89 c2                	mov    %eax,%edx
+  8029eb:	c1 fa 1f             	sar    $0x1f,%edx
+  8029ee:	89 d1                	mov    %edx,%ecx
+  8029f0:	c1 e9 1b             	shr    $0x1b,%ecx
+  8029f3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8029f6:	83 e2 1f             	and    $0x1f,%edx
+  8029f9:	29 ca                	sub    %ecx,%edx
+  8029fb:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8029ff:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802a03:	83 c0 01             	add    $0x1,%eax
+  802a06:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802a09:	83 c7 01             	add    $0x1,%edi
+  802a0c:	eb 9d                	jmp    8029ab <devpipe_write+0x1c>
+
+00802a0e <devpipe_read>:
+{
+  802a0e:	55                   	push   %ebp
+  802a0f:	89 e5                	mov    %esp,%ebp
+  802a11:	57                   	push   %edi
+  802a12:	56                   	push   %esi
+  802a13:	53                   	push   %ebx
+  802a14:	83 ec 18             	sub    $0x18,%esp
+  802a17:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802a1a:	57                   	push   %edi
+  802a1b:	e8 67 f1 ff ff       	call   801b87 <fd2data>
+  802a20:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802a22:	83 c4 10             	add    $0x10,%esp
+  802a25:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a2d:	75 13                	jne    802a42 <devpipe_read+0x34>
+	return i;
+  802a2f:	89 f0                	mov    %esi,%eax
+  802a31:	eb 02                	jmp    802a35 <devpipe_read+0x27>
+				return i;
+  802a33:	89 f0                	mov    %esi,%eax
+}
+  802a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a38:	5b                   	pop    %ebx
+  802a39:	5e                   	pop    %esi
+  802a3a:	5f                   	pop    %edi
+  802a3b:	5d                   	pop    %ebp
+  802a3c:	c3                   	ret
+			sys_yield();
+  802a3d:	e8 79 e6 ff ff       	call   8010bb <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802a42:	8b 03                	mov    (%ebx),%eax
+  802a44:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a47:	75 18                	jne    802a61 <devpipe_read+0x53>
+			if (i > 0)
+  802a49:	85 f6                	test   %esi,%esi
+  802a4b:	75 e6                	jne    802a33 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802a4d:	89 da                	mov    %ebx,%edx
+  802a4f:	89 f8                	mov    %edi,%eax
+  802a51:	e8 6c fe ff ff       	call   8028c2 <_pipeisclosed>
+  802a56:	85 c0                	test   %eax,%eax
+  802a58:	74 e3                	je     802a3d <devpipe_read+0x2f>
+				return 0;
+  802a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5f:	eb d4                	jmp    802a35 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a61:	99                   	cltd
+  802a62:	c1 ea 1b             	shr    $0x1b,%edx
+  802a65:	01 d0                	add    %edx,%eax
+  802a67:	83 e0 1f             	and    $0x1f,%eax
+  802a6a:	29 d0                	sub    %edx,%eax
+  802a6c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a74:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802a77:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802a7a:	83 c6 01             	add    $0x1,%esi
+  802a7d:	eb ab                	jmp    802a2a <devpipe_read+0x1c>
+
+00802a7f <pipe>:
+{
+  802a7f:	55                   	push   %ebp
+  802a80:	89 e5                	mov    %esp,%ebp
+  802a82:	56                   	push   %esi
+  802a83:	53                   	push   %ebx
+  802a84:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802a87:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a8a:	50                   	push   %eax
+  802a8b:	e8 0e f1 ff ff       	call   801b9e <fd_alloc>
+  802a90:	89 c3                	mov    %eax,%ebx
+  802a92:	83 c4 10             	add    $0x10,%esp
+  802a95:	85 c0                	test   %eax,%eax
+  802a97:	0f 88 23 01 00 00    	js     802bc0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a9d:	83 ec 04             	sub    $0x4,%esp
+  802aa0:	68 07 04 00 00       	push   $0x407
+  802aa5:	ff 75 f4             	push   -0xc(%ebp)
+  802aa8:	6a 00                	push   $0x0
+  802aaa:	e8 52 e6 ff ff       	call   801101 <sys_page_alloc>
+  802aaf:	89 c3                	mov    %eax,%ebx
+  802ab1:	83 c4 10             	add    $0x10,%esp
+  802ab4:	85 c0                	test   %eax,%eax
+  802ab6:	0f 88 04 01 00 00    	js     802bc0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802abc:	83 ec 0c             	sub    $0xc,%esp
+  802abf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ac2:	50                   	push   %eax
+  802ac3:	e8 d6 f0 ff ff       	call   801b9e <fd_alloc>
+  802ac8:	89 c3                	mov    %eax,%ebx
+  802aca:	83 c4 10             	add    $0x10,%esp
+  802acd:	85 c0                	test   %eax,%eax
+  802acf:	0f 88 db 00 00 00    	js     802bb0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ad5:	83 ec 04             	sub    $0x4,%esp
+  802ad8:	68 07 04 00 00       	push   $0x407
+  802add:	ff 75 f0             	push   -0x10(%ebp)
+  802ae0:	6a 00                	push   $0x0
+  802ae2:	e8 1a e6 ff ff       	call   801101 <sys_page_alloc>
+  802ae7:	89 c3                	mov    %eax,%ebx
+  802ae9:	83 c4 10             	add    $0x10,%esp
+  802aec:	85 c0                	test   %eax,%eax
+  802aee:	0f 88 bc 00 00 00    	js     802bb0 <pipe+0x131>
+	va = fd2data(fd0);
+  802af4:	83 ec 0c             	sub    $0xc,%esp
+  802af7:	ff 75 f4             	push   -0xc(%ebp)
+  802afa:	e8 88 f0 ff ff       	call   801b87 <fd2data>
+  802aff:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b01:	83 c4 0c             	add    $0xc,%esp
+  802b04:	68 07 04 00 00       	push   $0x407
+  802b09:	50                   	push   %eax
+  802b0a:	6a 00                	push   $0x0
+  802b0c:	e8 f0 e5 ff ff       	call   801101 <sys_page_alloc>
+  802b11:	89 c3                	mov    %eax,%ebx
+  802b13:	83 c4 10             	add    $0x10,%esp
+  802b16:	85 c0                	test   %eax,%eax
+  802b18:	0f 88 82 00 00 00    	js     802ba0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b1e:	83 ec 0c             	sub    $0xc,%esp
+  802b21:	ff 75 f0             	push   -0x10(%ebp)
+  802b24:	e8 5e f0 ff ff       	call   801b87 <fd2data>
+  802b29:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b30:	50                   	push   %eax
+  802b31:	6a 00                	push   $0x0
+  802b33:	56                   	push   %esi
+  802b34:	6a 00                	push   $0x0
+  802b36:	e8 33 e6 ff ff       	call   80116e <sys_page_map>
+  802b3b:	89 c3                	mov    %eax,%ebx
+  802b3d:	83 c4 20             	add    $0x20,%esp
+  802b40:	85 c0                	test   %eax,%eax
+  802b42:	78 4e                	js     802b92 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802b44:	a1 40 40 80 00       	mov    0x804040,%eax
+  802b49:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b4c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802b4e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b51:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802b58:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802b5b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802b5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802b60:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802b67:	83 ec 0c             	sub    $0xc,%esp
+  802b6a:	ff 75 f4             	push   -0xc(%ebp)
+  802b6d:	e8 05 f0 ff ff       	call   801b77 <fd2num>
+  802b72:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b75:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802b77:	83 c4 04             	add    $0x4,%esp
+  802b7a:	ff 75 f0             	push   -0x10(%ebp)
+  802b7d:	e8 f5 ef ff ff       	call   801b77 <fd2num>
+  802b82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b85:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802b88:	83 c4 10             	add    $0x10,%esp
+  802b8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b90:	eb 2e                	jmp    802bc0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802b92:	83 ec 08             	sub    $0x8,%esp
+  802b95:	56                   	push   %esi
+  802b96:	6a 00                	push   $0x0
+  802b98:	e8 3f e6 ff ff       	call   8011dc <sys_page_unmap>
+  802b9d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802ba0:	83 ec 08             	sub    $0x8,%esp
+  802ba3:	ff 75 f0             	push   -0x10(%ebp)
+  802ba6:	6a 00                	push   $0x0
+  802ba8:	e8 2f e6 ff ff       	call   8011dc <sys_page_unmap>
+  802bad:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802bb0:	83 ec 08             	sub    $0x8,%esp
+  802bb3:	ff 75 f4             	push   -0xc(%ebp)
+  802bb6:	6a 00                	push   $0x0
+  802bb8:	e8 1f e6 ff ff       	call   8011dc <sys_page_unmap>
+  802bbd:	83 c4 10             	add    $0x10,%esp
+}
+  802bc0:	89 d8                	mov    %ebx,%eax
+  802bc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bc5:	5b                   	pop    %ebx
+  802bc6:	5e                   	pop    %esi
+  802bc7:	5d                   	pop    %ebp
+  802bc8:	c3                   	ret
+
+00802bc9 <pipeisclosed>:
+{
+  802bc9:	55                   	push   %ebp
+  802bca:	89 e5                	mov    %esp,%ebp
+  802bcc:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bcf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bd2:	50                   	push   %eax
+  802bd3:	ff 75 08             	push   0x8(%ebp)
+  802bd6:	e8 19 f0 ff ff       	call   801bf4 <fd_lookup>
+  802bdb:	83 c4 10             	add    $0x10,%esp
+  802bde:	85 c0                	test   %eax,%eax
+  802be0:	78 18                	js     802bfa <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802be2:	83 ec 0c             	sub    $0xc,%esp
+  802be5:	ff 75 f4             	push   -0xc(%ebp)
+  802be8:	e8 9a ef ff ff       	call   801b87 <fd2data>
+  802bed:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802bef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bf2:	e8 cb fc ff ff       	call   8028c2 <_pipeisclosed>
+  802bf7:	83 c4 10             	add    $0x10,%esp
+}
+  802bfa:	c9                   	leave
+  802bfb:	c3                   	ret
+
+00802bfc <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c01:	c3                   	ret
+
+00802c02 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802c08:	68 9e 36 80 00       	push   $0x80369e
+  802c0d:	ff 75 0c             	push   0xc(%ebp)
+  802c10:	e8 f4 df ff ff       	call   800c09 <strcpy>
+	return 0;
+}
+  802c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1a:	c9                   	leave
+  802c1b:	c3                   	ret
+
+00802c1c <devcons_write>:
+{
+  802c1c:	55                   	push   %ebp
+  802c1d:	89 e5                	mov    %esp,%ebp
+  802c1f:	57                   	push   %edi
+  802c20:	56                   	push   %esi
+  802c21:	53                   	push   %ebx
+  802c22:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802c28:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802c2d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802c33:	eb 2e                	jmp    802c63 <devcons_write+0x47>
+		m = n - tot;
+  802c35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c38:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802c3a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c3f:	39 c3                	cmp    %eax,%ebx
+  802c41:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802c44:	83 ec 04             	sub    $0x4,%esp
+  802c47:	53                   	push   %ebx
+  802c48:	89 f0                	mov    %esi,%eax
+  802c4a:	03 45 0c             	add    0xc(%ebp),%eax
+  802c4d:	50                   	push   %eax
+  802c4e:	57                   	push   %edi
+  802c4f:	e8 3b e1 ff ff       	call   800d8f <memmove>
+		sys_cputs(buf, m);
+  802c54:	83 c4 08             	add    $0x8,%esp
+  802c57:	53                   	push   %ebx
+  802c58:	57                   	push   %edi
+  802c59:	e8 24 e3 ff ff       	call   800f82 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802c5e:	01 de                	add    %ebx,%esi
+  802c60:	83 c4 10             	add    $0x10,%esp
+  802c63:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c66:	72 cd                	jb     802c35 <devcons_write+0x19>
+}
+  802c68:	89 f0                	mov    %esi,%eax
+  802c6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c6d:	5b                   	pop    %ebx
+  802c6e:	5e                   	pop    %esi
+  802c6f:	5f                   	pop    %edi
+  802c70:	5d                   	pop    %ebp
+  802c71:	c3                   	ret
+
+00802c72 <devcons_read>:
+{
+  802c72:	55                   	push   %ebp
+  802c73:	89 e5                	mov    %esp,%ebp
+  802c75:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c81:	75 07                	jne    802c8a <devcons_read+0x18>
+  802c83:	eb 1f                	jmp    802ca4 <devcons_read+0x32>
+		sys_yield();
+  802c85:	e8 31 e4 ff ff       	call   8010bb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802c8a:	e8 37 e3 ff ff       	call   800fc6 <sys_cgetc>
+  802c8f:	85 c0                	test   %eax,%eax
+  802c91:	74 f2                	je     802c85 <devcons_read+0x13>
+	if (c < 0)
+  802c93:	78 0f                	js     802ca4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802c95:	83 f8 04             	cmp    $0x4,%eax
+  802c98:	74 0c                	je     802ca6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802c9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c9d:	88 02                	mov    %al,(%edx)
+	return 1;
+  802c9f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+		return 0;
+  802ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cab:	eb f7                	jmp    802ca4 <devcons_read+0x32>
+
+00802cad <cputchar>:
+{
+  802cad:	55                   	push   %ebp
+  802cae:	89 e5                	mov    %esp,%ebp
+  802cb0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802cb9:	6a 01                	push   $0x1
+  802cbb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cbe:	50                   	push   %eax
+  802cbf:	e8 be e2 ff ff       	call   800f82 <sys_cputs>
+}
+  802cc4:	83 c4 10             	add    $0x10,%esp
+  802cc7:	c9                   	leave
+  802cc8:	c3                   	ret
+
+00802cc9 <getchar>:
+{
+  802cc9:	55                   	push   %ebp
+  802cca:	89 e5                	mov    %esp,%ebp
+  802ccc:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802ccf:	6a 01                	push   $0x1
+  802cd1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cd4:	50                   	push   %eax
+  802cd5:	6a 00                	push   $0x0
+  802cd7:	e8 9e f1 ff ff       	call   801e7a <read>
+	if (r < 0)
+  802cdc:	83 c4 10             	add    $0x10,%esp
+  802cdf:	85 c0                	test   %eax,%eax
+  802ce1:	78 06                	js     802ce9 <getchar+0x20>
+	if (r < 1)
+  802ce3:	74 06                	je     802ceb <getchar+0x22>
+	return c;
+  802ce5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802ce9:	c9                   	leave
+  802cea:	c3                   	ret
+		return -E_EOF;
+  802ceb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cf0:	eb f7                	jmp    802ce9 <getchar+0x20>
+
+00802cf2 <iscons>:
+{
+  802cf2:	55                   	push   %ebp
+  802cf3:	89 e5                	mov    %esp,%ebp
+  802cf5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cf8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cfb:	50                   	push   %eax
+  802cfc:	ff 75 08             	push   0x8(%ebp)
+  802cff:	e8 f0 ee ff ff       	call   801bf4 <fd_lookup>
+  802d04:	83 c4 10             	add    $0x10,%esp
+  802d07:	85 c0                	test   %eax,%eax
+  802d09:	78 11                	js     802d1c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802d0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d0e:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802d14:	39 10                	cmp    %edx,(%eax)
+  802d16:	0f 94 c0             	sete   %al
+  802d19:	0f b6 c0             	movzbl %al,%eax
+}
+  802d1c:	c9                   	leave
+  802d1d:	c3                   	ret
+
+00802d1e <opencons>:
+{
+  802d1e:	55                   	push   %ebp
+  802d1f:	89 e5                	mov    %esp,%ebp
+  802d21:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802d24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d27:	50                   	push   %eax
+  802d28:	e8 71 ee ff ff       	call   801b9e <fd_alloc>
+  802d2d:	83 c4 10             	add    $0x10,%esp
+  802d30:	85 c0                	test   %eax,%eax
+  802d32:	78 3a                	js     802d6e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802d34:	83 ec 04             	sub    $0x4,%esp
+  802d37:	68 07 04 00 00       	push   $0x407
+  802d3c:	ff 75 f4             	push   -0xc(%ebp)
+  802d3f:	6a 00                	push   $0x0
+  802d41:	e8 bb e3 ff ff       	call   801101 <sys_page_alloc>
+  802d46:	83 c4 10             	add    $0x10,%esp
+  802d49:	85 c0                	test   %eax,%eax
+  802d4b:	78 21                	js     802d6e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802d4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d50:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802d56:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802d58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d5b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802d62:	83 ec 0c             	sub    $0xc,%esp
+  802d65:	50                   	push   %eax
+  802d66:	e8 0c ee ff ff       	call   801b77 <fd2num>
+  802d6b:	83 c4 10             	add    $0x10,%esp
+}
+  802d6e:	c9                   	leave
+  802d6f:	c3                   	ret
+
+00802d70 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802d70:	55                   	push   %ebp
+  802d71:	89 e5                	mov    %esp,%ebp
+  802d73:	56                   	push   %esi
+  802d74:	53                   	push   %ebx
+  802d75:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802d7e:	85 c0                	test   %eax,%eax
+  802d80:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802d85:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802d88:	83 ec 08             	sub    $0x8,%esp
+  802d8b:	ff 75 14             	push   0x14(%ebp)
+  802d8e:	50                   	push   %eax
+  802d8f:	e8 7e e7 ff ff       	call   801512 <sys_ipc_recv_until>
+  802d94:	83 c4 10             	add    $0x10,%esp
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	78 61                	js     802dfc <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802d9b:	85 f6                	test   %esi,%esi
+  802d9d:	74 1c                	je     802dbb <ipc_recv_until+0x4b>
+  802d9f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802da1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802da6:	8b 15 20 50 81 02    	mov    0x2815020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802dac:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802db1:	76 5f                	jbe    802e12 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802db3:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802db9:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802dbb:	85 db                	test   %ebx,%ebx
+  802dbd:	74 1c                	je     802ddb <ipc_recv_until+0x6b>
+  802dbf:	89 e0                	mov    %esp,%eax
+  802dc1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802dc6:	8b 15 20 50 81 02    	mov    0x2815020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802dcc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802dd1:	76 50                	jbe    802e23 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802dd3:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802dd9:	89 03                	mov    %eax,(%ebx)
+  802ddb:	89 e0                	mov    %esp,%eax
+  802ddd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802de2:	8b 15 20 50 81 02    	mov    0x2815020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802de8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ded:	76 45                	jbe    802e34 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802def:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802df5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802df8:	5b                   	pop    %ebx
+  802df9:	5e                   	pop    %esi
+  802dfa:	5d                   	pop    %ebp
+  802dfb:	c3                   	ret
+		if (from_env_store)
+  802dfc:	85 f6                	test   %esi,%esi
+  802dfe:	74 06                	je     802e06 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802e00:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802e06:	85 db                	test   %ebx,%ebx
+  802e08:	74 eb                	je     802df5 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802e0a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802e10:	eb e3                	jmp    802df5 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e12:	c1 e8 10             	shr    $0x10,%eax
+  802e15:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e1b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e21:	eb 90                	jmp    802db3 <ipc_recv_until+0x43>
+  802e23:	c1 e8 10             	shr    $0x10,%eax
+  802e26:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e2c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e32:	eb 9f                	jmp    802dd3 <ipc_recv_until+0x63>
+  802e34:	c1 e8 10             	shr    $0x10,%eax
+  802e37:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e3d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e43:	eb aa                	jmp    802def <ipc_recv_until+0x7f>
+
+00802e45 <ipc_recv>:
+{
+  802e45:	55                   	push   %ebp
+  802e46:	89 e5                	mov    %esp,%ebp
+  802e48:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802e4b:	6a 00                	push   $0x0
+  802e4d:	ff 75 10             	push   0x10(%ebp)
+  802e50:	ff 75 0c             	push   0xc(%ebp)
+  802e53:	ff 75 08             	push   0x8(%ebp)
+  802e56:	e8 15 ff ff ff       	call   802d70 <ipc_recv_until>
+}
+  802e5b:	c9                   	leave
+  802e5c:	c3                   	ret
+
+00802e5d <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802e5d:	55                   	push   %ebp
+  802e5e:	89 e5                	mov    %esp,%ebp
+  802e60:	57                   	push   %edi
+  802e61:	56                   	push   %esi
+  802e62:	53                   	push   %ebx
+  802e63:	83 ec 0c             	sub    $0xc,%esp
+  802e66:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e69:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802e6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802e6f:	85 db                	test   %ebx,%ebx
+  802e71:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e76:	0f 44 d8             	cmove  %eax,%ebx
+  802e79:	eb 05                	jmp    802e80 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802e7b:	e8 3b e2 ff ff       	call   8010bb <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802e80:	ff 75 14             	push   0x14(%ebp)
+  802e83:	53                   	push   %ebx
+  802e84:	56                   	push   %esi
+  802e85:	57                   	push   %edi
+  802e86:	e8 d3 e5 ff ff       	call   80145e <sys_ipc_try_send>
+  802e8b:	83 c4 10             	add    $0x10,%esp
+  802e8e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e91:	74 e8                	je     802e7b <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802e93:	85 c0                	test   %eax,%eax
+  802e95:	78 08                	js     802e9f <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e9a:	5b                   	pop    %ebx
+  802e9b:	5e                   	pop    %esi
+  802e9c:	5f                   	pop    %edi
+  802e9d:	5d                   	pop    %ebp
+  802e9e:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802e9f:	50                   	push   %eax
+  802ea0:	68 aa 36 80 00       	push   $0x8036aa
+  802ea5:	6a 4f                	push   $0x4f
+  802ea7:	68 bd 36 80 00       	push   $0x8036bd
+  802eac:	e8 35 d6 ff ff       	call   8004e6 <_panic>
+
+00802eb1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802eb1:	55                   	push   %ebp
+  802eb2:	89 e5                	mov    %esp,%ebp
+  802eb4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ebc:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802ec2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ec8:	8b 52 50             	mov    0x50(%edx),%edx
+  802ecb:	39 ca                	cmp    %ecx,%edx
+  802ecd:	74 11                	je     802ee0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802ecf:	83 c0 01             	add    $0x1,%eax
+  802ed2:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802ed7:	75 e3                	jne    802ebc <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ede:	eb 0e                	jmp    802eee <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802ee0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ee6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802eeb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802eee:	5d                   	pop    %ebp
+  802eef:	c3                   	ret
+
+00802ef0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802ef0:	55                   	push   %ebp
+  802ef1:	89 e5                	mov    %esp,%ebp
+  802ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802ef6:	89 c2                	mov    %eax,%edx
+  802ef8:	c1 ea 16             	shr    $0x16,%edx
+  802efb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802f02:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802f07:	f6 c1 01             	test   $0x1,%cl
+  802f0a:	74 1a                	je     802f26 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802f0c:	c1 e8 0c             	shr    $0xc,%eax
+  802f0f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802f16:	a8 01                	test   $0x1,%al
+  802f18:	74 0c                	je     802f26 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802f1a:	c1 e8 0c             	shr    $0xc,%eax
+  802f1d:	c1 e0 04             	shl    $0x4,%eax
+  802f20:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802f26:	89 d0                	mov    %edx,%eax
+  802f28:	5d                   	pop    %ebp
+  802f29:	c3                   	ret
@@ -0,0 +1,9589 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 80 1a 00 00       	call   801ab1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_wait_ready>:
+
+static int diskno = 1;
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	89 c3                	mov    %eax,%ebx
+
+static __inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800039:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80003e:	ec                   	in     (%dx),%al
+	int r;
+
+	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  80003f:	89 c1                	mov    %eax,%ecx
+  800041:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800044:	80 f9 40             	cmp    $0x40,%cl
+  800047:	75 f5                	jne    80003e <ide_wait_ready+0xb>
+		/* do nothing */;
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+		return -1;
+	return 0;
+  800049:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  80004e:	84 db                	test   %bl,%bl
+  800050:	74 0a                	je     80005c <ide_wait_ready+0x29>
+  800052:	a8 21                	test   $0x21,%al
+  800054:	0f 95 c2             	setne  %dl
+  800057:	0f b6 d2             	movzbl %dl,%edx
+  80005a:	f7 da                	neg    %edx
+}
+  80005c:	89 d0                	mov    %edx,%eax
+  80005e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800061:	c9                   	leave
+  800062:	c3                   	ret
+
+00800063 <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void)
+{
+  800063:	55                   	push   %ebp
+  800064:	89 e5                	mov    %esp,%ebp
+  800066:	53                   	push   %ebx
+  800067:	83 ec 04             	sub    $0x4,%esp
+	int r, x;
+
+	// wait for Device 0 to be ready
+	ide_wait_ready(0);
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	e8 bf ff ff ff       	call   800033 <ide_wait_ready>
+}
+
+static __inline void
+outb(int port, uint8_t data)
+{
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800074:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  800079:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80007e:	ee                   	out    %al,(%dx)
+
+	// switch to Device 1
+	outb(0x1F6, 0xE0 | (1<<4));
+
+	// check for Device 1 to be ready for a while
+	for (x = 0;
+  80007f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800084:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800089:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  80008a:	a8 a1                	test   $0xa1,%al
+  80008c:	74 0b                	je     800099 <ide_probe_disk1+0x36>
+	     x++)
+  80008e:	83 c1 01             	add    $0x1,%ecx
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800091:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800097:	75 f0                	jne    800089 <ide_probe_disk1+0x26>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800099:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  80009e:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8000a3:	ee                   	out    %al,(%dx)
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(0x1F6, 0xE0 | (0<<4));
+
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  8000a4:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000aa:	0f 9e c3             	setle  %bl
+  8000ad:	83 ec 08             	sub    $0x8,%esp
+  8000b0:	0f b6 c3             	movzbl %bl,%eax
+  8000b3:	50                   	push   %eax
+  8000b4:	68 80 48 80 00       	push   $0x804880
+  8000b9:	e8 92 1b 00 00       	call   801c50 <cprintf>
+	return (x < 1000);
+}
+  8000be:	89 d8                	mov    %ebx,%eax
+  8000c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000c3:	c9                   	leave
+  8000c4:	c3                   	ret
+
+008000c5 <ide_set_disk>:
+
+void
+ide_set_disk(int d)
+{
+  8000c5:	55                   	push   %ebp
+  8000c6:	89 e5                	mov    %esp,%ebp
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (d != 0 && d != 1)
+  8000ce:	83 f8 01             	cmp    $0x1,%eax
+  8000d1:	77 07                	ja     8000da <ide_set_disk+0x15>
+		panic("bad disk number");
+	diskno = d;
+  8000d3:	a3 00 60 80 00       	mov    %eax,0x806000
+}
+  8000d8:	c9                   	leave
+  8000d9:	c3                   	ret
+		panic("bad disk number");
+  8000da:	83 ec 04             	sub    $0x4,%esp
+  8000dd:	68 97 48 80 00       	push   $0x804897
+  8000e2:	6a 3a                	push   $0x3a
+  8000e4:	68 a7 48 80 00       	push   $0x8048a7
+  8000e9:	e8 87 1a 00 00       	call   801b75 <_panic>
+
+008000ee <ide_read>:
+
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  8000ee:	55                   	push   %ebp
+  8000ef:	89 e5                	mov    %esp,%ebp
+  8000f1:	57                   	push   %edi
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8000fd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	assert(nsecs <= 256);
+  800100:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  800106:	0f 87 87 00 00 00    	ja     800193 <ide_read+0xa5>
+
+	ide_wait_ready(0);
+  80010c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800111:	e8 1d ff ff ff       	call   800033 <ide_wait_ready>
+  800116:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  80011b:	89 f0                	mov    %esi,%eax
+  80011d:	ee                   	out    %al,(%dx)
+  80011e:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  800123:	89 f8                	mov    %edi,%eax
+  800125:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  800126:	89 f8                	mov    %edi,%eax
+  800128:	c1 e8 08             	shr    $0x8,%eax
+  80012b:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800130:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  800131:	89 f8                	mov    %edi,%eax
+  800133:	c1 e8 10             	shr    $0x10,%eax
+  800136:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  80013b:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  80013c:	0f b6 05 00 60 80 00 	movzbl 0x806000,%eax
+  800143:	c1 e0 04             	shl    $0x4,%eax
+  800146:	83 e0 10             	and    $0x10,%eax
+  800149:	c1 ef 18             	shr    $0x18,%edi
+  80014c:	83 e7 0f             	and    $0xf,%edi
+  80014f:	09 f8                	or     %edi,%eax
+  800151:	83 c8 e0             	or     $0xffffffe0,%eax
+  800154:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800159:	ee                   	out    %al,(%dx)
+  80015a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80015f:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800164:	ee                   	out    %al,(%dx)
+  800165:	c1 e6 09             	shl    $0x9,%esi
+  800168:	01 de                	add    %ebx,%esi
+	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  80016a:	39 f3                	cmp    %esi,%ebx
+  80016c:	74 3b                	je     8001a9 <ide_read+0xbb>
+		if ((r = ide_wait_ready(1)) < 0)
+  80016e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800173:	e8 bb fe ff ff       	call   800033 <ide_wait_ready>
+  800178:	85 c0                	test   %eax,%eax
+  80017a:	78 32                	js     8001ae <ide_read+0xc0>
+	__asm __volatile("cld\n\trepne\n\tinsl"			:
+  80017c:	89 df                	mov    %ebx,%edi
+  80017e:	b9 80 00 00 00       	mov    $0x80,%ecx
+  800183:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800188:	fc                   	cld
+  800189:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  80018b:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800191:	eb d7                	jmp    80016a <ide_read+0x7c>
+	assert(nsecs <= 256);
+  800193:	68 b0 48 80 00       	push   $0x8048b0
+  800198:	68 bd 48 80 00       	push   $0x8048bd
+  80019d:	6a 44                	push   $0x44
+  80019f:	68 a7 48 80 00       	push   $0x8048a7
+  8001a4:	e8 cc 19 00 00       	call   801b75 <_panic>
+			return r;
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+
+	return 0;
+  8001a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b1:	5b                   	pop    %ebx
+  8001b2:	5e                   	pop    %esi
+  8001b3:	5f                   	pop    %edi
+  8001b4:	5d                   	pop    %ebp
+  8001b5:	c3                   	ret
+
+008001b6 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  8001b6:	55                   	push   %ebp
+  8001b7:	89 e5                	mov    %esp,%ebp
+  8001b9:	57                   	push   %edi
+  8001ba:	56                   	push   %esi
+  8001bb:	53                   	push   %ebx
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8001c5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int r;
+
+	assert(nsecs <= 256);
+  8001c8:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  8001ce:	0f 87 87 00 00 00    	ja     80025b <ide_write+0xa5>
+
+	ide_wait_ready(0);
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	e8 55 fe ff ff       	call   800033 <ide_wait_ready>
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8001de:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  8001e3:	89 f8                	mov    %edi,%eax
+  8001e5:	ee                   	out    %al,(%dx)
+  8001e6:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  8001eb:	89 f0                	mov    %esi,%eax
+  8001ed:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  8001ee:	89 f0                	mov    %esi,%eax
+  8001f0:	c1 e8 08             	shr    $0x8,%eax
+  8001f3:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  8001f8:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  8001f9:	89 f0                	mov    %esi,%eax
+  8001fb:	c1 e8 10             	shr    $0x10,%eax
+  8001fe:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800203:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800204:	0f b6 05 00 60 80 00 	movzbl 0x806000,%eax
+  80020b:	c1 e0 04             	shl    $0x4,%eax
+  80020e:	83 e0 10             	and    $0x10,%eax
+  800211:	c1 ee 18             	shr    $0x18,%esi
+  800214:	83 e6 0f             	and    $0xf,%esi
+  800217:	09 f0                	or     %esi,%eax
+  800219:	83 c8 e0             	or     $0xffffffe0,%eax
+  80021c:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800221:	ee                   	out    %al,(%dx)
+  800222:	b8 30 00 00 00       	mov    $0x30,%eax
+  800227:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80022c:	ee                   	out    %al,(%dx)
+  80022d:	c1 e7 09             	shl    $0x9,%edi
+  800230:	01 df                	add    %ebx,%edi
+	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800232:	39 fb                	cmp    %edi,%ebx
+  800234:	74 3b                	je     800271 <ide_write+0xbb>
+		if ((r = ide_wait_ready(1)) < 0)
+  800236:	b8 01 00 00 00       	mov    $0x1,%eax
+  80023b:	e8 f3 fd ff ff       	call   800033 <ide_wait_ready>
+  800240:	85 c0                	test   %eax,%eax
+  800242:	78 32                	js     800276 <ide_write+0xc0>
+}
+
+static __inline void
+outsl(int port, const void *addr, int cnt)
+{
+	__asm __volatile("cld\n\trepne\n\toutsl"		:
+  800244:	89 de                	mov    %ebx,%esi
+  800246:	b9 80 00 00 00       	mov    $0x80,%ecx
+  80024b:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800250:	fc                   	cld
+  800251:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800253:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  800259:	eb d7                	jmp    800232 <ide_write+0x7c>
+	assert(nsecs <= 256);
+  80025b:	68 b0 48 80 00       	push   $0x8048b0
+  800260:	68 bd 48 80 00       	push   $0x8048bd
+  800265:	6a 5d                	push   $0x5d
+  800267:	68 a7 48 80 00       	push   $0x8048a7
+  80026c:	e8 04 19 00 00       	call   801b75 <_panic>
+			return r;
+		outsl(0x1F0, src, SECTSIZE/4);
+	}
+
+	return 0;
+  800271:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800279:	5b                   	pop    %ebx
+  80027a:	5e                   	pop    %esi
+  80027b:	5f                   	pop    %edi
+  80027c:	5d                   	pop    %ebp
+  80027d:	c3                   	ret
+
+0080027e <bc_pgfault>:
+
+// Fault any disk block that is read in to memory by
+// loading it from disk.
+static void
+bc_pgfault(struct UTrapframe *utf)
+{
+  80027e:	55                   	push   %ebp
+  80027f:	89 e5                	mov    %esp,%ebp
+  800281:	56                   	push   %esi
+  800282:	53                   	push   %ebx
+  800283:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  800286:	8b 1a                	mov    (%edx),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800288:	8d 83 00 00 00 f0    	lea    -0x10000000(%ebx),%eax
+  80028e:	89 c6                	mov    %eax,%esi
+  800290:	c1 ee 0c             	shr    $0xc,%esi
+	int r;
+
+	// Check that the fault was within the block cache region
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  800293:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  800298:	0f 87 95 00 00 00    	ja     800333 <bc_pgfault+0xb5>
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+		      utf->utf_eip, addr, utf->utf_err);
+
+	// Sanity check the block number.
+	if (super && blockno >= super->s_nblocks)
+  80029e:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8002a3:	85 c0                	test   %eax,%eax
+  8002a5:	74 09                	je     8002b0 <bc_pgfault+0x32>
+  8002a7:	3b 70 04             	cmp    0x4(%eax),%esi
+  8002aa:	0f 83 9e 00 00 00    	jae    80034e <bc_pgfault+0xd0>
+	// of the block from the disk into that page.
+	// Hint: first round addr to page boundary. fs/ide.c has code to read
+	// the disk.
+	//
+	// LAB 5: you code here:
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, BLKSIZE);
+  8002b0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	
+	if ((r = sys_page_alloc(0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8002b6:	83 ec 04             	sub    $0x4,%esp
+  8002b9:	6a 07                	push   $0x7
+  8002bb:	53                   	push   %ebx
+  8002bc:	6a 00                	push   $0x0
+  8002be:	e8 cd 24 00 00       	call   802790 <sys_page_alloc>
+  8002c3:	83 c4 10             	add    $0x10,%esp
+  8002c6:	85 c0                	test   %eax,%eax
+  8002c8:	0f 88 92 00 00 00    	js     800360 <bc_pgfault+0xe2>
+		panic("error when allocating page: %e");
+	
+	if ((r = ide_read(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
+  8002ce:	83 ec 04             	sub    $0x4,%esp
+  8002d1:	6a 08                	push   $0x8
+  8002d3:	53                   	push   %ebx
+  8002d4:	8d 04 f5 00 00 00 00 	lea    0x0(,%esi,8),%eax
+  8002db:	50                   	push   %eax
+  8002dc:	e8 0d fe ff ff       	call   8000ee <ide_read>
+  8002e1:	83 c4 10             	add    $0x10,%esp
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	0f 88 88 00 00 00    	js     800374 <bc_pgfault+0xf6>
+		panic("cannot read from dist: %e", r);
+	
+	// Clear the dirty bit for the disk block page since we just read the
+	// block from disk
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+  8002ec:	89 d8                	mov    %ebx,%eax
+  8002ee:	c1 e8 0c             	shr    $0xc,%eax
+  8002f1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	25 07 0e 00 00       	and    $0xe07,%eax
+  800300:	50                   	push   %eax
+  800301:	53                   	push   %ebx
+  800302:	6a 00                	push   $0x0
+  800304:	53                   	push   %ebx
+  800305:	6a 00                	push   $0x0
+  800307:	e8 f1 24 00 00       	call   8027fd <sys_page_map>
+  80030c:	83 c4 20             	add    $0x20,%esp
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 73                	js     800386 <bc_pgfault+0x108>
+		panic("in bc_pgfault, sys_page_map: %e", r);
+
+	// Check that the block we read was allocated. (exercise for
+	// the reader: why do we do this *after* reading the block
+	// in?)
+	if (bitmap && block_is_free(blockno))
+  800313:	83 3d 08 b0 80 00 00 	cmpl   $0x0,0x80b008
+  80031a:	74 10                	je     80032c <bc_pgfault+0xae>
+  80031c:	83 ec 0c             	sub    $0xc,%esp
+  80031f:	56                   	push   %esi
+  800320:	e8 ea 04 00 00       	call   80080f <block_is_free>
+  800325:	83 c4 10             	add    $0x10,%esp
+  800328:	84 c0                	test   %al,%al
+  80032a:	75 6c                	jne    800398 <bc_pgfault+0x11a>
+		panic("reading free block %08x\n", blockno);
+}
+  80032c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80032f:	5b                   	pop    %ebx
+  800330:	5e                   	pop    %esi
+  800331:	5d                   	pop    %ebp
+  800332:	c3                   	ret
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	ff 72 04             	push   0x4(%edx)
+  800339:	53                   	push   %ebx
+  80033a:	ff 72 28             	push   0x28(%edx)
+  80033d:	68 d4 48 80 00       	push   $0x8048d4
+  800342:	6a 26                	push   $0x26
+  800344:	68 f4 49 80 00       	push   $0x8049f4
+  800349:	e8 27 18 00 00       	call   801b75 <_panic>
+		panic("reading non-existent block %08x\n", blockno);
+  80034e:	56                   	push   %esi
+  80034f:	68 04 49 80 00       	push   $0x804904
+  800354:	6a 2b                	push   $0x2b
+  800356:	68 f4 49 80 00       	push   $0x8049f4
+  80035b:	e8 15 18 00 00       	call   801b75 <_panic>
+		panic("error when allocating page: %e");
+  800360:	83 ec 04             	sub    $0x4,%esp
+  800363:	68 28 49 80 00       	push   $0x804928
+  800368:	6a 36                	push   $0x36
+  80036a:	68 f4 49 80 00       	push   $0x8049f4
+  80036f:	e8 01 18 00 00       	call   801b75 <_panic>
+		panic("cannot read from dist: %e", r);
+  800374:	50                   	push   %eax
+  800375:	68 fc 49 80 00       	push   $0x8049fc
+  80037a:	6a 39                	push   $0x39
+  80037c:	68 f4 49 80 00       	push   $0x8049f4
+  800381:	e8 ef 17 00 00       	call   801b75 <_panic>
+		panic("in bc_pgfault, sys_page_map: %e", r);
+  800386:	50                   	push   %eax
+  800387:	68 48 49 80 00       	push   $0x804948
+  80038c:	6a 3e                	push   $0x3e
+  80038e:	68 f4 49 80 00       	push   $0x8049f4
+  800393:	e8 dd 17 00 00       	call   801b75 <_panic>
+		panic("reading free block %08x\n", blockno);
+  800398:	56                   	push   %esi
+  800399:	68 16 4a 80 00       	push   $0x804a16
+  80039e:	6a 44                	push   $0x44
+  8003a0:	68 f4 49 80 00       	push   $0x8049f4
+  8003a5:	e8 cb 17 00 00       	call   801b75 <_panic>
+
+008003aa <diskaddr>:
+{
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	83 ec 08             	sub    $0x8,%esp
+  8003b0:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  8003b3:	85 c0                	test   %eax,%eax
+  8003b5:	74 19                	je     8003d0 <diskaddr+0x26>
+  8003b7:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  8003bd:	85 d2                	test   %edx,%edx
+  8003bf:	74 05                	je     8003c6 <diskaddr+0x1c>
+  8003c1:	3b 42 04             	cmp    0x4(%edx),%eax
+  8003c4:	73 0a                	jae    8003d0 <diskaddr+0x26>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8003c6:	05 00 00 01 00       	add    $0x10000,%eax
+  8003cb:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8003ce:	c9                   	leave
+  8003cf:	c3                   	ret
+		panic("bad block number %08x in diskaddr", blockno);
+  8003d0:	50                   	push   %eax
+  8003d1:	68 68 49 80 00       	push   $0x804968
+  8003d6:	6a 09                	push   $0x9
+  8003d8:	68 f4 49 80 00       	push   $0x8049f4
+  8003dd:	e8 93 17 00 00       	call   801b75 <_panic>
+
+008003e2 <va_is_mapped>:
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8003e8:	89 d0                	mov    %edx,%eax
+  8003ea:	c1 e8 16             	shr    $0x16,%eax
+  8003ed:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8003f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f9:	f6 c1 01             	test   $0x1,%cl
+  8003fc:	74 0d                	je     80040b <va_is_mapped+0x29>
+  8003fe:	c1 ea 0c             	shr    $0xc,%edx
+  800401:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  800408:	83 e0 01             	and    $0x1,%eax
+  80040b:	83 e0 01             	and    $0x1,%eax
+}
+  80040e:	5d                   	pop    %ebp
+  80040f:	c3                   	ret
+
+00800410 <va_is_dirty>:
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+	return (uvpt[PGNUM(va)] & PTE_D) != 0;
+  800413:	8b 45 08             	mov    0x8(%ebp),%eax
+  800416:	c1 e8 0c             	shr    $0xc,%eax
+  800419:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800420:	c1 e8 06             	shr    $0x6,%eax
+  800423:	83 e0 01             	and    $0x1,%eax
+}
+  800426:	5d                   	pop    %ebp
+  800427:	c3                   	ret
+
+00800428 <flush_block>:
+// Hint: Use va_is_mapped, va_is_dirty, and ide_write.
+// Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
+// Hint: Don't forget to round addr down.
+void
+flush_block(void *addr)
+{
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+  80042b:	56                   	push   %esi
+  80042c:	53                   	push   %ebx
+  80042d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800430:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+	int r;
+	
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  800436:	81 fe ff ff ff bf    	cmp    $0xbfffffff,%esi
+  80043c:	77 1d                	ja     80045b <flush_block+0x33>
+		panic("flush_block of bad va %08x", addr);
+
+	// LAB 5: Your code here.
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, BLKSIZE);
+  80043e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	
+	if (!va_is_mapped(addr) || !va_is_dirty(addr))
+  800444:	83 ec 0c             	sub    $0xc,%esp
+  800447:	53                   	push   %ebx
+  800448:	e8 95 ff ff ff       	call   8003e2 <va_is_mapped>
+  80044d:	83 c4 10             	add    $0x10,%esp
+  800450:	84 c0                	test   %al,%al
+  800452:	75 19                	jne    80046d <flush_block+0x45>
+	if ((r = ide_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
+		panic("cannot write to dist: %e", r);
+
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+		panic("in bc_pgfault, sys_page_map: %e", r);	
+}
+  800454:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800457:	5b                   	pop    %ebx
+  800458:	5e                   	pop    %esi
+  800459:	5d                   	pop    %ebp
+  80045a:	c3                   	ret
+		panic("flush_block of bad va %08x", addr);
+  80045b:	53                   	push   %ebx
+  80045c:	68 2f 4a 80 00       	push   $0x804a2f
+  800461:	6a 55                	push   $0x55
+  800463:	68 f4 49 80 00       	push   $0x8049f4
+  800468:	e8 08 17 00 00       	call   801b75 <_panic>
+	if (!va_is_mapped(addr) || !va_is_dirty(addr))
+  80046d:	83 ec 0c             	sub    $0xc,%esp
+  800470:	53                   	push   %ebx
+  800471:	e8 9a ff ff ff       	call   800410 <va_is_dirty>
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	84 c0                	test   %al,%al
+  80047b:	74 d7                	je     800454 <flush_block+0x2c>
+	if ((r = ide_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
+  80047d:	83 ec 04             	sub    $0x4,%esp
+  800480:	6a 08                	push   $0x8
+  800482:	53                   	push   %ebx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  800483:	c1 ee 0c             	shr    $0xc,%esi
+	if ((r = ide_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
+  800486:	c1 e6 03             	shl    $0x3,%esi
+  800489:	56                   	push   %esi
+  80048a:	e8 27 fd ff ff       	call   8001b6 <ide_write>
+  80048f:	83 c4 10             	add    $0x10,%esp
+  800492:	85 c0                	test   %eax,%eax
+  800494:	78 39                	js     8004cf <flush_block+0xa7>
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+  800496:	89 d8                	mov    %ebx,%eax
+  800498:	c1 e8 0c             	shr    $0xc,%eax
+  80049b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8004a2:	83 ec 0c             	sub    $0xc,%esp
+  8004a5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8004aa:	50                   	push   %eax
+  8004ab:	53                   	push   %ebx
+  8004ac:	6a 00                	push   $0x0
+  8004ae:	53                   	push   %ebx
+  8004af:	6a 00                	push   $0x0
+  8004b1:	e8 47 23 00 00       	call   8027fd <sys_page_map>
+  8004b6:	83 c4 20             	add    $0x20,%esp
+  8004b9:	85 c0                	test   %eax,%eax
+  8004bb:	79 97                	jns    800454 <flush_block+0x2c>
+		panic("in bc_pgfault, sys_page_map: %e", r);	
+  8004bd:	50                   	push   %eax
+  8004be:	68 48 49 80 00       	push   $0x804948
+  8004c3:	6a 61                	push   $0x61
+  8004c5:	68 f4 49 80 00       	push   $0x8049f4
+  8004ca:	e8 a6 16 00 00       	call   801b75 <_panic>
+		panic("cannot write to dist: %e", r);
+  8004cf:	50                   	push   %eax
+  8004d0:	68 4a 4a 80 00       	push   $0x804a4a
+  8004d5:	6a 5e                	push   $0x5e
+  8004d7:	68 f4 49 80 00       	push   $0x8049f4
+  8004dc:	e8 94 16 00 00       	call   801b75 <_panic>
+
+008004e1 <flush_blocks>:
+// Flush the 'nblocks' blocks starting at the one containing VA, like
+// flush_block() does, but clear the PTE_D bits of each run of adjacent
+// flushed blocks with a single sys_batch() operation.
+void
+flush_blocks(void *addr, uint32_t nblocks)
+{
+  8004e1:	55                   	push   %ebp
+  8004e2:	89 e5                	mov    %esp,%ebp
+  8004e4:	57                   	push   %edi
+  8004e5:	56                   	push   %esi
+  8004e6:	53                   	push   %ebx
+  8004e7:	81 ec dc 01 00 00    	sub    $0x1dc,%esp
+	struct Batch b;
+	uint32_t blockno, i;
+	int r;
+
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, BLKSIZE);
+  8004ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8004f5:	8d b8 00 00 00 f0    	lea    -0x10000000(%eax),%edi
+  8004fb:	c1 ef 0c             	shr    $0xc,%edi
+	if (addr < (void*)DISKMAP || nblocks > DISKSIZE / BLKSIZE - blockno)
+  8004fe:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  800503:	76 2a                	jbe    80052f <flush_blocks+0x4e>
+  800505:	89 c3                	mov    %eax,%ebx
+  800507:	ba 00 00 0c 00       	mov    $0xc0000,%edx
+  80050c:	29 fa                	sub    %edi,%edx
+  80050e:	3b 55 0c             	cmp    0xc(%ebp),%edx
+  800511:	72 1c                	jb     80052f <flush_blocks+0x4e>
+		panic("flush_blocks of bad range %08x+%x", addr, nblocks);
+
+	batch_init(&b);
+  800513:	83 ec 0c             	sub    $0xc,%esp
+  800516:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  80051c:	50                   	push   %eax
+  80051d:	e8 f3 2e 00 00       	call   803415 <batch_init>
+	for (i = 0; i < nblocks; i++, addr += BLKSIZE) {
+  800522:	c1 e7 03             	shl    $0x3,%edi
+  800525:	83 c4 10             	add    $0x10,%esp
+  800528:	be 00 00 00 00       	mov    $0x0,%esi
+  80052d:	eb 36                	jmp    800565 <flush_blocks+0x84>
+		panic("flush_blocks of bad range %08x+%x", addr, nblocks);
+  80052f:	83 ec 0c             	sub    $0xc,%esp
+  800532:	ff 75 0c             	push   0xc(%ebp)
+  800535:	50                   	push   %eax
+  800536:	68 8c 49 80 00       	push   $0x80498c
+  80053b:	6a 71                	push   $0x71
+  80053d:	68 f4 49 80 00       	push   $0x8049f4
+  800542:	e8 2e 16 00 00       	call   801b75 <_panic>
+		if (!va_is_mapped(addr) || !va_is_dirty(addr))
+			continue;
+		if ((r = ide_write((blockno + i) * BLKSECTS, addr, BLKSECTS)) < 0)
+			panic("cannot write to dist: %e", r);
+  800547:	50                   	push   %eax
+  800548:	68 4a 4a 80 00       	push   $0x804a4a
+  80054d:	6a 78                	push   $0x78
+  80054f:	68 f4 49 80 00       	push   $0x8049f4
+  800554:	e8 1c 16 00 00       	call   801b75 <_panic>
+	for (i = 0; i < nblocks; i++, addr += BLKSIZE) {
+  800559:	83 c6 01             	add    $0x1,%esi
+  80055c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800562:	83 c7 08             	add    $0x8,%edi
+  800565:	3b 75 0c             	cmp    0xc(%ebp),%esi
+  800568:	74 61                	je     8005cb <flush_blocks+0xea>
+		if (!va_is_mapped(addr) || !va_is_dirty(addr))
+  80056a:	83 ec 0c             	sub    $0xc,%esp
+  80056d:	53                   	push   %ebx
+  80056e:	e8 6f fe ff ff       	call   8003e2 <va_is_mapped>
+  800573:	83 c4 10             	add    $0x10,%esp
+  800576:	84 c0                	test   %al,%al
+  800578:	74 df                	je     800559 <flush_blocks+0x78>
+  80057a:	83 ec 0c             	sub    $0xc,%esp
+  80057d:	53                   	push   %ebx
+  80057e:	e8 8d fe ff ff       	call   800410 <va_is_dirty>
+  800583:	83 c4 10             	add    $0x10,%esp
+  800586:	84 c0                	test   %al,%al
+  800588:	74 cf                	je     800559 <flush_blocks+0x78>
+		if ((r = ide_write((blockno + i) * BLKSECTS, addr, BLKSECTS)) < 0)
+  80058a:	83 ec 04             	sub    $0x4,%esp
+  80058d:	6a 08                	push   $0x8
+  80058f:	53                   	push   %ebx
+  800590:	57                   	push   %edi
+  800591:	e8 20 fc ff ff       	call   8001b6 <ide_write>
+  800596:	83 c4 10             	add    $0x10,%esp
+  800599:	85 c0                	test   %eax,%eax
+  80059b:	78 aa                	js     800547 <flush_blocks+0x66>
+		batch_map(&b, 0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL, 1);
+  80059d:	89 d8                	mov    %ebx,%eax
+  80059f:	c1 e8 0c             	shr    $0xc,%eax
+  8005a2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8005a9:	83 ec 04             	sub    $0x4,%esp
+  8005ac:	6a 01                	push   $0x1
+  8005ae:	25 07 0e 00 00       	and    $0xe07,%eax
+  8005b3:	50                   	push   %eax
+  8005b4:	53                   	push   %ebx
+  8005b5:	6a 00                	push   $0x0
+  8005b7:	53                   	push   %ebx
+  8005b8:	6a 00                	push   $0x0
+  8005ba:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  8005c0:	50                   	push   %eax
+  8005c1:	e8 fb 2f 00 00       	call   8035c1 <batch_map>
+  8005c6:	83 c4 20             	add    $0x20,%esp
+  8005c9:	eb 8e                	jmp    800559 <flush_blocks+0x78>
+	}
+	if ((r = batch_flush(&b)) < 0)
+  8005cb:	83 ec 0c             	sub    $0xc,%esp
+  8005ce:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  8005d4:	50                   	push   %eax
+  8005d5:	e8 57 2e 00 00       	call   803431 <batch_flush>
+  8005da:	83 c4 10             	add    $0x10,%esp
+  8005dd:	85 c0                	test   %eax,%eax
+  8005df:	78 08                	js     8005e9 <flush_blocks+0x108>
+		panic("in flush_blocks, sys_batch: %e", r);
+}
+  8005e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005e4:	5b                   	pop    %ebx
+  8005e5:	5e                   	pop    %esi
+  8005e6:	5f                   	pop    %edi
+  8005e7:	5d                   	pop    %ebp
+  8005e8:	c3                   	ret
+		panic("in flush_blocks, sys_batch: %e", r);
+  8005e9:	50                   	push   %eax
+  8005ea:	68 b0 49 80 00       	push   $0x8049b0
+  8005ef:	6a 7c                	push   $0x7c
+  8005f1:	68 f4 49 80 00       	push   $0x8049f4
+  8005f6:	e8 7a 15 00 00       	call   801b75 <_panic>
+
+008005fb <bc_init>:
+	cprintf("block cache is good\n");
+}
+
+void
+bc_init(void)
+{
+  8005fb:	55                   	push   %ebp
+  8005fc:	89 e5                	mov    %esp,%ebp
+  8005fe:	81 ec 24 02 00 00    	sub    $0x224,%esp
+	struct Super super;
+	set_pgfault_handler(bc_pgfault);
+  800604:	68 7e 02 80 00       	push   $0x80027e
+  800609:	e8 f8 2b 00 00       	call   803206 <set_pgfault_handler>
+	memmove(&backup, diskaddr(1), sizeof backup);
+  80060e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800615:	e8 90 fd ff ff       	call   8003aa <diskaddr>
+  80061a:	83 c4 0c             	add    $0xc,%esp
+  80061d:	68 08 01 00 00       	push   $0x108
+  800622:	50                   	push   %eax
+  800623:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  800629:	50                   	push   %eax
+  80062a:	e8 ef 1d 00 00       	call   80241e <memmove>
+	strcpy(diskaddr(1), "OOPS!\n");
+  80062f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800636:	e8 6f fd ff ff       	call   8003aa <diskaddr>
+  80063b:	83 c4 08             	add    $0x8,%esp
+  80063e:	68 63 4a 80 00       	push   $0x804a63
+  800643:	50                   	push   %eax
+  800644:	e8 4f 1c 00 00       	call   802298 <strcpy>
+	flush_block(diskaddr(1));
+  800649:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800650:	e8 55 fd ff ff       	call   8003aa <diskaddr>
+  800655:	89 04 24             	mov    %eax,(%esp)
+  800658:	e8 cb fd ff ff       	call   800428 <flush_block>
+	assert(va_is_mapped(diskaddr(1)));
+  80065d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800664:	e8 41 fd ff ff       	call   8003aa <diskaddr>
+  800669:	89 04 24             	mov    %eax,(%esp)
+  80066c:	e8 71 fd ff ff       	call   8003e2 <va_is_mapped>
+  800671:	83 c4 10             	add    $0x10,%esp
+  800674:	84 c0                	test   %al,%al
+  800676:	0f 84 d9 00 00 00    	je     800755 <bc_init+0x15a>
+	assert(!va_is_dirty(diskaddr(1)));
+  80067c:	83 ec 0c             	sub    $0xc,%esp
+  80067f:	6a 01                	push   $0x1
+  800681:	e8 24 fd ff ff       	call   8003aa <diskaddr>
+  800686:	89 04 24             	mov    %eax,(%esp)
+  800689:	e8 82 fd ff ff       	call   800410 <va_is_dirty>
+  80068e:	83 c4 10             	add    $0x10,%esp
+  800691:	84 c0                	test   %al,%al
+  800693:	0f 85 d5 00 00 00    	jne    80076e <bc_init+0x173>
+	sys_page_unmap(0, diskaddr(1));
+  800699:	83 ec 0c             	sub    $0xc,%esp
+  80069c:	6a 01                	push   $0x1
+  80069e:	e8 07 fd ff ff       	call   8003aa <diskaddr>
+  8006a3:	83 c4 08             	add    $0x8,%esp
+  8006a6:	50                   	push   %eax
+  8006a7:	6a 00                	push   $0x0
+  8006a9:	e8 bd 21 00 00       	call   80286b <sys_page_unmap>
+	assert(!va_is_mapped(diskaddr(1)));
+  8006ae:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8006b5:	e8 f0 fc ff ff       	call   8003aa <diskaddr>
+  8006ba:	89 04 24             	mov    %eax,(%esp)
+  8006bd:	e8 20 fd ff ff       	call   8003e2 <va_is_mapped>
+  8006c2:	83 c4 10             	add    $0x10,%esp
+  8006c5:	84 c0                	test   %al,%al
+  8006c7:	0f 85 ba 00 00 00    	jne    800787 <bc_init+0x18c>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8006cd:	83 ec 0c             	sub    $0xc,%esp
+  8006d0:	6a 01                	push   $0x1
+  8006d2:	e8 d3 fc ff ff       	call   8003aa <diskaddr>
+  8006d7:	83 c4 08             	add    $0x8,%esp
+  8006da:	68 63 4a 80 00       	push   $0x804a63
+  8006df:	50                   	push   %eax
+  8006e0:	e8 64 1c 00 00       	call   802349 <strcmp>
+  8006e5:	83 c4 10             	add    $0x10,%esp
+  8006e8:	85 c0                	test   %eax,%eax
+  8006ea:	0f 85 b0 00 00 00    	jne    8007a0 <bc_init+0x1a5>
+	memmove(diskaddr(1), &backup, sizeof backup);
+  8006f0:	83 ec 0c             	sub    $0xc,%esp
+  8006f3:	6a 01                	push   $0x1
+  8006f5:	e8 b0 fc ff ff       	call   8003aa <diskaddr>
+  8006fa:	83 c4 0c             	add    $0xc,%esp
+  8006fd:	68 08 01 00 00       	push   $0x108
+  800702:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+  800708:	52                   	push   %edx
+  800709:	50                   	push   %eax
+  80070a:	e8 0f 1d 00 00       	call   80241e <memmove>
+	flush_block(diskaddr(1));
+  80070f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800716:	e8 8f fc ff ff       	call   8003aa <diskaddr>
+  80071b:	89 04 24             	mov    %eax,(%esp)
+  80071e:	e8 05 fd ff ff       	call   800428 <flush_block>
+	cprintf("block cache is good\n");
+  800723:	c7 04 24 9f 4a 80 00 	movl   $0x804a9f,(%esp)
+  80072a:	e8 21 15 00 00       	call   801c50 <cprintf>
+	check_bc();
+
+	// cache the super block by reading it once
+	memmove(&super, diskaddr(1), sizeof super);
+  80072f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800736:	e8 6f fc ff ff       	call   8003aa <diskaddr>
+  80073b:	83 c4 0c             	add    $0xc,%esp
+  80073e:	68 08 01 00 00       	push   $0x108
+  800743:	50                   	push   %eax
+  800744:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80074a:	50                   	push   %eax
+  80074b:	e8 ce 1c 00 00       	call   80241e <memmove>
+}
+  800750:	83 c4 10             	add    $0x10,%esp
+  800753:	c9                   	leave
+  800754:	c3                   	ret
+	assert(va_is_mapped(diskaddr(1)));
+  800755:	68 85 4a 80 00       	push   $0x804a85
+  80075a:	68 bd 48 80 00       	push   $0x8048bd
+  80075f:	68 8c 00 00 00       	push   $0x8c
+  800764:	68 f4 49 80 00       	push   $0x8049f4
+  800769:	e8 07 14 00 00       	call   801b75 <_panic>
+	assert(!va_is_dirty(diskaddr(1)));
+  80076e:	68 6a 4a 80 00       	push   $0x804a6a
+  800773:	68 bd 48 80 00       	push   $0x8048bd
+  800778:	68 8d 00 00 00       	push   $0x8d
+  80077d:	68 f4 49 80 00       	push   $0x8049f4
+  800782:	e8 ee 13 00 00       	call   801b75 <_panic>
+	assert(!va_is_mapped(diskaddr(1)));
+  800787:	68 84 4a 80 00       	push   $0x804a84
+  80078c:	68 bd 48 80 00       	push   $0x8048bd
+  800791:	68 91 00 00 00       	push   $0x91
+  800796:	68 f4 49 80 00       	push   $0x8049f4
+  80079b:	e8 d5 13 00 00       	call   801b75 <_panic>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8007a0:	68 d0 49 80 00       	push   $0x8049d0
+  8007a5:	68 bd 48 80 00       	push   $0x8048bd
+  8007aa:	68 94 00 00 00       	push   $0x94
+  8007af:	68 f4 49 80 00       	push   $0x8049f4
+  8007b4:	e8 bc 13 00 00       	call   801b75 <_panic>
+
+008007b9 <check_super>:
+// --------------------------------------------------------------
+
+// Validate the file system super-block.
+void
+check_super(void)
+{
+  8007b9:	55                   	push   %ebp
+  8007ba:	89 e5                	mov    %esp,%ebp
+  8007bc:	83 ec 08             	sub    $0x8,%esp
+	if (super->s_magic != FS_MAGIC)
+  8007bf:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8007c4:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  8007ca:	75 1b                	jne    8007e7 <check_super+0x2e>
+		panic("bad file system magic number");
+
+	if (super->s_nblocks > DISKSIZE/BLKSIZE)
+  8007cc:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  8007d3:	77 26                	ja     8007fb <check_super+0x42>
+		panic("file system is too large");
+
+	cprintf("superblock is good\n");
+  8007d5:	83 ec 0c             	sub    $0xc,%esp
+  8007d8:	68 f2 4a 80 00       	push   $0x804af2
+  8007dd:	e8 6e 14 00 00       	call   801c50 <cprintf>
+}
+  8007e2:	83 c4 10             	add    $0x10,%esp
+  8007e5:	c9                   	leave
+  8007e6:	c3                   	ret
+		panic("bad file system magic number");
+  8007e7:	83 ec 04             	sub    $0x4,%esp
+  8007ea:	68 b4 4a 80 00       	push   $0x804ab4
+  8007ef:	6a 0f                	push   $0xf
+  8007f1:	68 d1 4a 80 00       	push   $0x804ad1
+  8007f6:	e8 7a 13 00 00       	call   801b75 <_panic>
+		panic("file system is too large");
+  8007fb:	83 ec 04             	sub    $0x4,%esp
+  8007fe:	68 d9 4a 80 00       	push   $0x804ad9
+  800803:	6a 12                	push   $0x12
+  800805:	68 d1 4a 80 00       	push   $0x804ad1
+  80080a:	e8 66 13 00 00       	call   801b75 <_panic>
+
+0080080f <block_is_free>:
+
+// Check to see if the block bitmap indicates that block 'blockno' is free.
+// Return 1 if the block is free, 0 if not.
+bool
+block_is_free(uint32_t blockno)
+{
+  80080f:	55                   	push   %ebp
+  800810:	89 e5                	mov    %esp,%ebp
+  800812:	53                   	push   %ebx
+  800813:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (super == 0 || blockno >= super->s_nblocks)
+  800816:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  80081b:	85 c0                	test   %eax,%eax
+  80081d:	74 29                	je     800848 <block_is_free+0x39>
+		return 0;
+  80081f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (super == 0 || blockno >= super->s_nblocks)
+  800824:	3b 48 04             	cmp    0x4(%eax),%ecx
+  800827:	73 18                	jae    800841 <block_is_free+0x32>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  800829:	89 cb                	mov    %ecx,%ebx
+  80082b:	c1 eb 05             	shr    $0x5,%ebx
+  80082e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800833:	d3 e0                	shl    %cl,%eax
+  800835:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  80083b:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  80083e:	0f 95 c2             	setne  %dl
+		return 1;
+	return 0;
+}
+  800841:	89 d0                	mov    %edx,%eax
+  800843:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800846:	c9                   	leave
+  800847:	c3                   	ret
+		return 0;
+  800848:	ba 00 00 00 00       	mov    $0x0,%edx
+  80084d:	eb f2                	jmp    800841 <block_is_free+0x32>
+
+0080084f <free_block>:
+
+// Mark a block free in the bitmap
+void
+free_block(uint32_t blockno)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	53                   	push   %ebx
+  800853:	83 ec 04             	sub    $0x4,%esp
+  800856:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	// Blockno zero is the null pointer of block numbers.
+	if (blockno == 0)
+  800859:	85 c9                	test   %ecx,%ecx
+  80085b:	74 1a                	je     800877 <free_block+0x28>
+		panic("attempt to free zero block");
+	bitmap[blockno/32] |= 1<<(blockno%32);
+  80085d:	89 cb                	mov    %ecx,%ebx
+  80085f:	c1 eb 05             	shr    $0x5,%ebx
+  800862:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  800868:	b8 01 00 00 00       	mov    $0x1,%eax
+  80086d:	d3 e0                	shl    %cl,%eax
+  80086f:	09 04 9a             	or     %eax,(%edx,%ebx,4)
+}
+  800872:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800875:	c9                   	leave
+  800876:	c3                   	ret
+		panic("attempt to free zero block");
+  800877:	83 ec 04             	sub    $0x4,%esp
+  80087a:	68 06 4b 80 00       	push   $0x804b06
+  80087f:	6a 2d                	push   $0x2d
+  800881:	68 d1 4a 80 00       	push   $0x804ad1
+  800886:	e8 ea 12 00 00       	call   801b75 <_panic>
+
+0080088b <alloc_block>:
+// -E_NO_DISK if we are out of blocks.
+//
+// Hint: use free_block as an example for manipulating the bitmap.
+int
+alloc_block(void)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	56                   	push   %esi
+  80088f:	53                   	push   %ebx
+
+	// LAB 5: Your code here.
+	int blockno;
+	
+	// Make sure the super block exists.
+	if (!super)
+  800890:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  800895:	85 c0                	test   %eax,%eax
+  800897:	74 21                	je     8008ba <alloc_block+0x2f>
+  800899:	8b 70 04             	mov    0x4(%eax),%esi
+		panic("no super block found");
+	
+	for (blockno = 0; blockno < super->s_nblocks; blockno++)
+  80089c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008a1:	39 f3                	cmp    %esi,%ebx
+  8008a3:	74 5e                	je     800903 <alloc_block+0x78>
+		if (block_is_free(blockno)) goto alloc_block_found;
+  8008a5:	83 ec 0c             	sub    $0xc,%esp
+  8008a8:	53                   	push   %ebx
+  8008a9:	e8 61 ff ff ff       	call   80080f <block_is_free>
+  8008ae:	83 c4 10             	add    $0x10,%esp
+  8008b1:	84 c0                	test   %al,%al
+  8008b3:	75 19                	jne    8008ce <alloc_block+0x43>
+	for (blockno = 0; blockno < super->s_nblocks; blockno++)
+  8008b5:	83 c3 01             	add    $0x1,%ebx
+  8008b8:	eb e7                	jmp    8008a1 <alloc_block+0x16>
+		panic("no super block found");
+  8008ba:	83 ec 04             	sub    $0x4,%esp
+  8008bd:	68 21 4b 80 00       	push   $0x804b21
+  8008c2:	6a 45                	push   $0x45
+  8008c4:	68 d1 4a 80 00       	push   $0x804ad1
+  8008c9:	e8 a7 12 00 00       	call   801b75 <_panic>
+		
+	return -E_NO_DISK;
+	
+alloc_block_found:
+	bitmap[blockno/32] &= ~(1<<(blockno%32));
+  8008ce:	8d 43 1f             	lea    0x1f(%ebx),%eax
+  8008d1:	85 db                	test   %ebx,%ebx
+  8008d3:	0f 49 c3             	cmovns %ebx,%eax
+  8008d6:	c1 f8 05             	sar    $0x5,%eax
+  8008d9:	c1 e0 02             	shl    $0x2,%eax
+  8008dc:	89 c6                	mov    %eax,%esi
+  8008de:	03 35 08 b0 80 00    	add    0x80b008,%esi
+  8008e4:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+  8008e9:	89 d9                	mov    %ebx,%ecx
+  8008eb:	d3 c2                	rol    %cl,%edx
+  8008ed:	21 16                	and    %edx,(%esi)
+	flush_block(&bitmap[blockno/32]);
+  8008ef:	83 ec 0c             	sub    $0xc,%esp
+  8008f2:	03 05 08 b0 80 00    	add    0x80b008,%eax
+  8008f8:	50                   	push   %eax
+  8008f9:	e8 2a fb ff ff       	call   800428 <flush_block>
+	return blockno;
+  8008fe:	83 c4 10             	add    $0x10,%esp
+  800901:	eb 05                	jmp    800908 <alloc_block+0x7d>
+	return -E_NO_DISK;
+  800903:	bb f7 ff ff ff       	mov    $0xfffffff7,%ebx
+}
+  800908:	89 d8                	mov    %ebx,%eax
+  80090a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80090d:	5b                   	pop    %ebx
+  80090e:	5e                   	pop    %esi
+  80090f:	5d                   	pop    %ebp
+  800910:	c3                   	ret
+
+00800911 <file_block_walk>:
+//
+// Analogy: This is like pgdir_walk for files.
+// Hint: Don't forget to clear any block you allocate.
+static int
+file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
+{
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	57                   	push   %edi
+  800915:	56                   	push   %esi
+  800916:	53                   	push   %ebx
+  800917:	83 ec 0c             	sub    $0xc,%esp
+  80091a:	89 c3                	mov    %eax,%ebx
+  80091c:	8b 45 08             	mov    0x8(%ebp),%eax
+	// LAB 5: Your code here.
+	uintptr_t b;
+	uint32_t *result;
+	
+	// Simple NULL check
+	if (!f)
+  80091f:	85 db                	test   %ebx,%ebx
+  800921:	74 2b                	je     80094e <file_block_walk+0x3d>
+  800923:	89 d6                	mov    %edx,%esi
+  800925:	89 cf                	mov    %ecx,%edi
+		panic("no file supplied");
+	
+	// Check if filebno is over the limit
+	if (filebno >= NDIRECT + NINDIRECT)
+  800927:	81 fa 09 04 00 00    	cmp    $0x409,%edx
+  80092d:	77 77                	ja     8009a6 <file_block_walk+0x95>
+		return -E_INVAL;
+	
+	// Code path for when the indirect block is not allocated
+	if (filebno >= NDIRECT && !f->f_indirect) {
+  80092f:	83 fa 09             	cmp    $0x9,%edx
+  800932:	77 31                	ja     800965 <file_block_walk+0x54>
+        
+        flush_block(&f->f_indirect);
+	}
+	
+	if (filebno < NDIRECT)
+		result = &f->f_direct[filebno];
+  800934:	8d 94 93 88 00 00 00 	lea    0x88(%ebx,%edx,4),%edx
+		result = &((uint32_t *) diskaddr(f->f_indirect))[filebno - NDIRECT];
+	
+	if (ppdiskbno)
+		*ppdiskbno = result;
+	
+	return 0;
+  80093b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ppdiskbno)
+  800940:	85 ff                	test   %edi,%edi
+  800942:	74 02                	je     800946 <file_block_walk+0x35>
+		*ppdiskbno = result;
+  800944:	89 17                	mov    %edx,(%edi)
+	
+}
+  800946:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800949:	5b                   	pop    %ebx
+  80094a:	5e                   	pop    %esi
+  80094b:	5f                   	pop    %edi
+  80094c:	5d                   	pop    %ebp
+  80094d:	c3                   	ret
+		panic("no file supplied");
+  80094e:	83 ec 04             	sub    $0x4,%esp
+  800951:	68 36 4b 80 00       	push   $0x804b36
+  800956:	68 9c 00 00 00       	push   $0x9c
+  80095b:	68 d1 4a 80 00       	push   $0x804ad1
+  800960:	e8 10 12 00 00       	call   801b75 <_panic>
+	if (filebno >= NDIRECT && !f->f_indirect) {
+  800965:	83 bb b0 00 00 00 00 	cmpl   $0x0,0xb0(%ebx)
+  80096c:	75 21                	jne    80098f <file_block_walk+0x7e>
+		if (!alloc)
+  80096e:	84 c0                	test   %al,%al
+  800970:	74 3b                	je     8009ad <file_block_walk+0x9c>
+		if ((b = alloc_block()) < 0)
+  800972:	e8 14 ff ff ff       	call   80088b <alloc_block>
+		f->f_indirect = b;
+  800977:	89 83 b0 00 00 00    	mov    %eax,0xb0(%ebx)
+        flush_block(&f->f_indirect);
+  80097d:	83 ec 0c             	sub    $0xc,%esp
+  800980:	8d 83 b0 00 00 00    	lea    0xb0(%ebx),%eax
+  800986:	50                   	push   %eax
+  800987:	e8 9c fa ff ff       	call   800428 <flush_block>
+  80098c:	83 c4 10             	add    $0x10,%esp
+		result = &((uint32_t *) diskaddr(f->f_indirect))[filebno - NDIRECT];
+  80098f:	83 ec 0c             	sub    $0xc,%esp
+  800992:	ff b3 b0 00 00 00    	push   0xb0(%ebx)
+  800998:	e8 0d fa ff ff       	call   8003aa <diskaddr>
+  80099d:	8d 54 b0 d8          	lea    -0x28(%eax,%esi,4),%edx
+  8009a1:	83 c4 10             	add    $0x10,%esp
+  8009a4:	eb 95                	jmp    80093b <file_block_walk+0x2a>
+		return -E_INVAL;
+  8009a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009ab:	eb 99                	jmp    800946 <file_block_walk+0x35>
+			return -E_NOT_FOUND;
+  8009ad:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8009b2:	eb 92                	jmp    800946 <file_block_walk+0x35>
+
+008009b4 <check_bitmap>:
+{
+  8009b4:	55                   	push   %ebp
+  8009b5:	89 e5                	mov    %esp,%ebp
+  8009b7:	56                   	push   %esi
+  8009b8:	53                   	push   %ebx
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8009b9:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8009be:	8b 70 04             	mov    0x4(%eax),%esi
+  8009c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009c6:	89 d8                	mov    %ebx,%eax
+  8009c8:	c1 e0 0f             	shl    $0xf,%eax
+  8009cb:	39 f0                	cmp    %esi,%eax
+  8009cd:	73 2e                	jae    8009fd <check_bitmap+0x49>
+		assert(!block_is_free(2+i));
+  8009cf:	83 ec 0c             	sub    $0xc,%esp
+  8009d2:	8d 43 02             	lea    0x2(%ebx),%eax
+  8009d5:	50                   	push   %eax
+  8009d6:	e8 34 fe ff ff       	call   80080f <block_is_free>
+  8009db:	83 c4 10             	add    $0x10,%esp
+  8009de:	84 c0                	test   %al,%al
+  8009e0:	75 05                	jne    8009e7 <check_bitmap+0x33>
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8009e2:	83 c3 01             	add    $0x1,%ebx
+  8009e5:	eb df                	jmp    8009c6 <check_bitmap+0x12>
+		assert(!block_is_free(2+i));
+  8009e7:	68 47 4b 80 00       	push   $0x804b47
+  8009ec:	68 bd 48 80 00       	push   $0x8048bd
+  8009f1:	6a 5d                	push   $0x5d
+  8009f3:	68 d1 4a 80 00       	push   $0x804ad1
+  8009f8:	e8 78 11 00 00       	call   801b75 <_panic>
+	assert(!block_is_free(0));
+  8009fd:	83 ec 0c             	sub    $0xc,%esp
+  800a00:	6a 00                	push   $0x0
+  800a02:	e8 08 fe ff ff       	call   80080f <block_is_free>
+  800a07:	83 c4 10             	add    $0x10,%esp
+  800a0a:	84 c0                	test   %al,%al
+  800a0c:	75 28                	jne    800a36 <check_bitmap+0x82>
+	assert(!block_is_free(1));
+  800a0e:	83 ec 0c             	sub    $0xc,%esp
+  800a11:	6a 01                	push   $0x1
+  800a13:	e8 f7 fd ff ff       	call   80080f <block_is_free>
+  800a18:	83 c4 10             	add    $0x10,%esp
+  800a1b:	84 c0                	test   %al,%al
+  800a1d:	75 2d                	jne    800a4c <check_bitmap+0x98>
+	cprintf("bitmap is good\n");
+  800a1f:	83 ec 0c             	sub    $0xc,%esp
+  800a22:	68 7f 4b 80 00       	push   $0x804b7f
+  800a27:	e8 24 12 00 00       	call   801c50 <cprintf>
+}
+  800a2c:	83 c4 10             	add    $0x10,%esp
+  800a2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a32:	5b                   	pop    %ebx
+  800a33:	5e                   	pop    %esi
+  800a34:	5d                   	pop    %ebp
+  800a35:	c3                   	ret
+	assert(!block_is_free(0));
+  800a36:	68 5b 4b 80 00       	push   $0x804b5b
+  800a3b:	68 bd 48 80 00       	push   $0x8048bd
+  800a40:	6a 60                	push   $0x60
+  800a42:	68 d1 4a 80 00       	push   $0x804ad1
+  800a47:	e8 29 11 00 00       	call   801b75 <_panic>
+	assert(!block_is_free(1));
+  800a4c:	68 6d 4b 80 00       	push   $0x804b6d
+  800a51:	68 bd 48 80 00       	push   $0x8048bd
+  800a56:	6a 61                	push   $0x61
+  800a58:	68 d1 4a 80 00       	push   $0x804ad1
+  800a5d:	e8 13 11 00 00       	call   801b75 <_panic>
+
+00800a62 <fs_init>:
+{
+  800a62:	55                   	push   %ebp
+  800a63:	89 e5                	mov    %esp,%ebp
+  800a65:	83 ec 08             	sub    $0x8,%esp
+       if (ide_probe_disk1())
+  800a68:	e8 f6 f5 ff ff       	call   800063 <ide_probe_disk1>
+  800a6d:	84 c0                	test   %al,%al
+  800a6f:	74 41                	je     800ab2 <fs_init+0x50>
+               ide_set_disk(1);
+  800a71:	83 ec 0c             	sub    $0xc,%esp
+  800a74:	6a 01                	push   $0x1
+  800a76:	e8 4a f6 ff ff       	call   8000c5 <ide_set_disk>
+  800a7b:	83 c4 10             	add    $0x10,%esp
+	bc_init();
+  800a7e:	e8 78 fb ff ff       	call   8005fb <bc_init>
+	super = diskaddr(1);
+  800a83:	83 ec 0c             	sub    $0xc,%esp
+  800a86:	6a 01                	push   $0x1
+  800a88:	e8 1d f9 ff ff       	call   8003aa <diskaddr>
+  800a8d:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	check_super();
+  800a92:	e8 22 fd ff ff       	call   8007b9 <check_super>
+	bitmap = diskaddr(2);
+  800a97:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  800a9e:	e8 07 f9 ff ff       	call   8003aa <diskaddr>
+  800aa3:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	check_bitmap();
+  800aa8:	e8 07 ff ff ff       	call   8009b4 <check_bitmap>
+}
+  800aad:	83 c4 10             	add    $0x10,%esp
+  800ab0:	c9                   	leave
+  800ab1:	c3                   	ret
+               ide_set_disk(0);
+  800ab2:	83 ec 0c             	sub    $0xc,%esp
+  800ab5:	6a 00                	push   $0x0
+  800ab7:	e8 09 f6 ff ff       	call   8000c5 <ide_set_disk>
+  800abc:	83 c4 10             	add    $0x10,%esp
+  800abf:	eb bd                	jmp    800a7e <fs_init+0x1c>
+
+00800ac1 <file_get_block>:
+//	-E_INVAL if filebno is out of range.
+//
+// Hint: Use file_block_walk and alloc_block.
+int
+file_get_block(struct File *f, uint32_t filebno, char **blk)
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	56                   	push   %esi
+  800ac5:	53                   	push   %ebx
+  800ac6:	83 ec 1c             	sub    $0x1c,%esp
+  800ac9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 5: Your code here.
+	int r;
+	uint32_t *ppdiskbno;
+	
+	if ((r = file_block_walk(f, filebno, &ppdiskbno, 1)) < 0)
+  800acc:	6a 01                	push   $0x1
+  800ace:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800ad1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad7:	e8 35 fe ff ff       	call   800911 <file_block_walk>
+  800adc:	83 c4 10             	add    $0x10,%esp
+  800adf:	85 c0                	test   %eax,%eax
+  800ae1:	78 27                	js     800b0a <file_get_block+0x49>
+		panic("cannot get block offset: %e", r);
+	
+	if (!*ppdiskbno) {
+  800ae3:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  800ae6:	83 3e 00             	cmpl   $0x0,(%esi)
+  800ae9:	74 34                	je     800b1f <file_get_block+0x5e>
+        if ((*ppdiskbno = alloc_block()) < 0)
+            return -E_NO_DISK;
+        flush_block(ppdiskbno);
+    }
+    
+	if (blk)
+  800aeb:	85 db                	test   %ebx,%ebx
+  800aed:	74 0f                	je     800afe <file_get_block+0x3d>
+		*blk = (char *) diskaddr(*ppdiskbno);
+  800aef:	83 ec 0c             	sub    $0xc,%esp
+  800af2:	ff 36                	push   (%esi)
+  800af4:	e8 b1 f8 ff ff       	call   8003aa <diskaddr>
+  800af9:	89 03                	mov    %eax,(%ebx)
+  800afb:	83 c4 10             	add    $0x10,%esp
+	
+	return 0;
+}
+  800afe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b06:	5b                   	pop    %ebx
+  800b07:	5e                   	pop    %esi
+  800b08:	5d                   	pop    %ebp
+  800b09:	c3                   	ret
+		panic("cannot get block offset: %e", r);
+  800b0a:	50                   	push   %eax
+  800b0b:	68 8f 4b 80 00       	push   $0x804b8f
+  800b10:	68 cb 00 00 00       	push   $0xcb
+  800b15:	68 d1 4a 80 00       	push   $0x804ad1
+  800b1a:	e8 56 10 00 00       	call   801b75 <_panic>
+        if ((*ppdiskbno = alloc_block()) < 0)
+  800b1f:	e8 67 fd ff ff       	call   80088b <alloc_block>
+  800b24:	89 06                	mov    %eax,(%esi)
+        flush_block(ppdiskbno);
+  800b26:	83 ec 0c             	sub    $0xc,%esp
+  800b29:	56                   	push   %esi
+  800b2a:	e8 f9 f8 ff ff       	call   800428 <flush_block>
+  800b2f:	83 c4 10             	add    $0x10,%esp
+  800b32:	eb b7                	jmp    800aeb <file_get_block+0x2a>
+
+00800b34 <walk_path>:
+// If we cannot find the file but find the directory
+// it should be in, set *pdir and copy the final path
+// element into lastelem.
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem)
+{
+  800b34:	55                   	push   %ebp
+  800b35:	89 e5                	mov    %esp,%ebp
+  800b37:	57                   	push   %edi
+  800b38:	56                   	push   %esi
+  800b39:	53                   	push   %ebx
+  800b3a:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  800b40:	89 95 40 ff ff ff    	mov    %edx,-0xc0(%ebp)
+  800b46:	89 8d 3c ff ff ff    	mov    %ecx,-0xc4(%ebp)
+	while (*p == '/')
+  800b4c:	eb 03                	jmp    800b51 <walk_path+0x1d>
+		p++;
+  800b4e:	83 c0 01             	add    $0x1,%eax
+	while (*p == '/')
+  800b51:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800b54:	74 f8                	je     800b4e <walk_path+0x1a>
+	int r;
+
+	// if (*path != '/')
+	//	return -E_BAD_PATH;
+	path = skip_slash(path);
+	f = &super->s_root;
+  800b56:	8b 0d 0c b0 80 00    	mov    0x80b00c,%ecx
+  800b5c:	83 c1 08             	add    $0x8,%ecx
+  800b5f:	89 8d 4c ff ff ff    	mov    %ecx,-0xb4(%ebp)
+	dir = 0;
+	name[0] = 0;
+  800b65:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+
+	if (pdir)
+  800b6c:	8b 8d 40 ff ff ff    	mov    -0xc0(%ebp),%ecx
+  800b72:	85 c9                	test   %ecx,%ecx
+  800b74:	74 06                	je     800b7c <walk_path+0x48>
+		*pdir = 0;
+  800b76:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	*pf = 0;
+  800b7c:	8b 8d 3c ff ff ff    	mov    -0xc4(%ebp),%ecx
+  800b82:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	dir = 0;
+  800b88:	ba 00 00 00 00       	mov    $0x0,%edx
+		p = path;
+		while (*path != '/' && *path != '\0')
+			path++;
+		if (path - p >= MAXNAMELEN)
+			return -E_BAD_PATH;
+		memmove(name, p, path - p);
+  800b8d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	while (*path != '\0') {
+  800b93:	e9 03 01 00 00       	jmp    800c9b <walk_path+0x167>
+			path++;
+  800b98:	83 c3 01             	add    $0x1,%ebx
+		while (*path != '/' && *path != '\0')
+  800b9b:	0f b6 13             	movzbl (%ebx),%edx
+  800b9e:	80 fa 2f             	cmp    $0x2f,%dl
+  800ba1:	74 04                	je     800ba7 <walk_path+0x73>
+  800ba3:	84 d2                	test   %dl,%dl
+  800ba5:	75 f1                	jne    800b98 <walk_path+0x64>
+		if (path - p >= MAXNAMELEN)
+  800ba7:	89 de                	mov    %ebx,%esi
+  800ba9:	29 c6                	sub    %eax,%esi
+  800bab:	83 fe 7f             	cmp    $0x7f,%esi
+  800bae:	0f 8f 9f 01 00 00    	jg     800d53 <walk_path+0x21f>
+		memmove(name, p, path - p);
+  800bb4:	83 ec 04             	sub    $0x4,%esp
+  800bb7:	56                   	push   %esi
+  800bb8:	50                   	push   %eax
+  800bb9:	57                   	push   %edi
+  800bba:	e8 5f 18 00 00       	call   80241e <memmove>
+		name[path - p] = '\0';
+  800bbf:	c6 84 35 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%esi,1)
+  800bc6:	00 
+	while (*p == '/')
+  800bc7:	83 c4 10             	add    $0x10,%esp
+  800bca:	eb 03                	jmp    800bcf <walk_path+0x9b>
+		p++;
+  800bcc:	83 c3 01             	add    $0x1,%ebx
+	while (*p == '/')
+  800bcf:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  800bd2:	74 f8                	je     800bcc <walk_path+0x98>
+		path = skip_slash(path);
+
+		if (dir->f_type != FTYPE_DIR)
+  800bd4:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  800bda:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  800be1:	0f 85 73 01 00 00    	jne    800d5a <walk_path+0x226>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800be7:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  800bed:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  800bf2:	0f 85 b3 00 00 00    	jne    800cab <walk_path+0x177>
+	nblock = dir->f_size / BLKSIZE;
+  800bf8:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  800bfe:	85 c0                	test   %eax,%eax
+  800c00:	0f 48 c2             	cmovs  %edx,%eax
+  800c03:	c1 f8 0c             	sar    $0xc,%eax
+  800c06:	89 85 48 ff ff ff    	mov    %eax,-0xb8(%ebp)
+	for (i = 0; i < nblock; i++) {
+  800c0c:	c7 85 50 ff ff ff 00 	movl   $0x0,-0xb0(%ebp)
+  800c13:	00 00 00 
+  800c16:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+  800c1c:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  800c22:	39 8d 48 ff ff ff    	cmp    %ecx,-0xb8(%ebp)
+  800c28:	0f 84 a2 00 00 00    	je     800cd0 <walk_path+0x19c>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  800c2e:	83 ec 04             	sub    $0x4,%esp
+  800c31:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+  800c37:	50                   	push   %eax
+  800c38:	ff b5 50 ff ff ff    	push   -0xb0(%ebp)
+  800c3e:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  800c44:	e8 78 fe ff ff       	call   800ac1 <file_get_block>
+  800c49:	83 c4 10             	add    $0x10,%esp
+  800c4c:	85 c0                	test   %eax,%eax
+  800c4e:	0f 88 cc 00 00 00    	js     800d20 <walk_path+0x1ec>
+		for (j = 0; j < BLKFILES; j++)
+  800c54:	8b 9d 64 ff ff ff    	mov    -0x9c(%ebp),%ebx
+  800c5a:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  800c60:	39 f3                	cmp    %esi,%ebx
+  800c62:	74 60                	je     800cc4 <walk_path+0x190>
+			if (strcmp(f[j].f_name, name) == 0) {
+  800c64:	89 9d 54 ff ff ff    	mov    %ebx,-0xac(%ebp)
+  800c6a:	83 ec 08             	sub    $0x8,%esp
+  800c6d:	57                   	push   %edi
+  800c6e:	53                   	push   %ebx
+  800c6f:	e8 d5 16 00 00       	call   802349 <strcmp>
+  800c74:	81 c3 00 01 00 00    	add    $0x100,%ebx
+  800c7a:	83 c4 10             	add    $0x10,%esp
+  800c7d:	85 c0                	test   %eax,%eax
+  800c7f:	75 df                	jne    800c60 <walk_path+0x12c>
+  800c81:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800c87:	8b 95 4c ff ff ff    	mov    -0xb4(%ebp),%edx
+  800c8d:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  800c93:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800c99:	89 d8                	mov    %ebx,%eax
+	while (*path != '\0') {
+  800c9b:	80 38 00             	cmpb   $0x0,(%eax)
+  800c9e:	0f 84 86 00 00 00    	je     800d2a <walk_path+0x1f6>
+  800ca4:	89 c3                	mov    %eax,%ebx
+  800ca6:	e9 f0 fe ff ff       	jmp    800b9b <walk_path+0x67>
+	assert((dir->f_size % BLKSIZE) == 0);
+  800cab:	68 ab 4b 80 00       	push   $0x804bab
+  800cb0:	68 bd 48 80 00       	push   $0x8048bd
+  800cb5:	68 e8 00 00 00       	push   $0xe8
+  800cba:	68 d1 4a 80 00       	push   $0x804ad1
+  800cbf:	e8 b1 0e 00 00       	call   801b75 <_panic>
+	for (i = 0; i < nblock; i++) {
+  800cc4:	83 85 50 ff ff ff 01 	addl   $0x1,-0xb0(%ebp)
+  800ccb:	e9 4c ff ff ff       	jmp    800c1c <walk_path+0xe8>
+	return -E_NOT_FOUND;
+  800cd0:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800cd6:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+			return -E_NOT_FOUND;
+
+		if ((r = dir_lookup(dir, name, &f)) < 0) {
+			if (r == -E_NOT_FOUND && *path == '\0') {
+  800cdb:	83 fe f5             	cmp    $0xfffffff5,%esi
+  800cde:	75 69                	jne    800d49 <walk_path+0x215>
+  800ce0:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800ce3:	75 64                	jne    800d49 <walk_path+0x215>
+				if (pdir)
+  800ce5:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800ceb:	85 c0                	test   %eax,%eax
+  800ced:	74 08                	je     800cf7 <walk_path+0x1c3>
+					*pdir = dir;
+  800cef:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  800cf5:	89 08                	mov    %ecx,(%eax)
+				if (lastelem)
+  800cf7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800cfb:	74 15                	je     800d12 <walk_path+0x1de>
+					strcpy(lastelem, name);
+  800cfd:	83 ec 08             	sub    $0x8,%esp
+  800d00:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800d06:	50                   	push   %eax
+  800d07:	ff 75 08             	push   0x8(%ebp)
+  800d0a:	e8 89 15 00 00       	call   802298 <strcpy>
+  800d0f:	83 c4 10             	add    $0x10,%esp
+				*pf = 0;
+  800d12:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+  800d18:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  800d1e:	eb 29                	jmp    800d49 <walk_path+0x215>
+  800d20:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  800d26:	89 c6                	mov    %eax,%esi
+  800d28:	eb b1                	jmp    800cdb <walk_path+0x1a7>
+			}
+			return r;
+		}
+	}
+
+	if (pdir)
+  800d2a:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  800d30:	85 c0                	test   %eax,%eax
+  800d32:	74 02                	je     800d36 <walk_path+0x202>
+		*pdir = dir;
+  800d34:	89 10                	mov    %edx,(%eax)
+	*pf = f;
+  800d36:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+  800d3c:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  800d42:	89 08                	mov    %ecx,(%eax)
+	return 0;
+  800d44:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  800d49:	89 f0                	mov    %esi,%eax
+  800d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4e:	5b                   	pop    %ebx
+  800d4f:	5e                   	pop    %esi
+  800d50:	5f                   	pop    %edi
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+			return -E_BAD_PATH;
+  800d53:	be f4 ff ff ff       	mov    $0xfffffff4,%esi
+  800d58:	eb ef                	jmp    800d49 <walk_path+0x215>
+			return -E_NOT_FOUND;
+  800d5a:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+  800d5f:	eb e8                	jmp    800d49 <walk_path+0x215>
+
+00800d61 <file_open>:
+
+// Open "path".  On success set *pf to point at the file and return 0.
+// On error return < 0.
+int
+file_open(const char *path, struct File **pf)
+{
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	83 ec 14             	sub    $0x14,%esp
+	return walk_path(path, 0, pf, 0);
+  800d67:	6a 00                	push   $0x0
+  800d69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d74:	e8 bb fd ff ff       	call   800b34 <walk_path>
+}
+  800d79:	c9                   	leave
+  800d7a:	c3                   	ret
+
+00800d7b <file_read>:
+// Read count bytes from f into buf, starting from seek position
+// offset.  This meant to mimic the standard pread function.
+// Returns the number of bytes read, < 0 on error.
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset)
+{
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	57                   	push   %edi
+  800d7f:	56                   	push   %esi
+  800d80:	53                   	push   %ebx
+  800d81:	83 ec 2c             	sub    $0x2c,%esp
+  800d84:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8a:	8b 55 14             	mov    0x14(%ebp),%edx
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	if (offset >= f->f_size)
+  800d8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d90:	8b 88 80 00 00 00    	mov    0x80(%eax),%ecx
+		return 0;
+  800d96:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (offset >= f->f_size)
+  800d9b:	39 d1                	cmp    %edx,%ecx
+  800d9d:	0f 8e 81 00 00 00    	jle    800e24 <file_read+0xa9>
+
+	count = MIN(count, f->f_size - offset);
+  800da3:	29 d1                	sub    %edx,%ecx
+  800da5:	39 d9                	cmp    %ebx,%ecx
+  800da7:	0f 47 cb             	cmova  %ebx,%ecx
+
+	for (pos = offset; pos < offset + count; ) {
+  800daa:	89 d3                	mov    %edx,%ebx
+  800dac:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  800daf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800db2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  800db5:	89 de                	mov    %ebx,%esi
+  800db7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800dba:	39 c3                	cmp    %eax,%ebx
+  800dbc:	73 61                	jae    800e1f <file_read+0xa4>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  800dbe:	83 ec 04             	sub    $0x4,%esp
+  800dc1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800dc4:	50                   	push   %eax
+  800dc5:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800dcb:	85 db                	test   %ebx,%ebx
+  800dcd:	0f 49 c3             	cmovns %ebx,%eax
+  800dd0:	c1 f8 0c             	sar    $0xc,%eax
+  800dd3:	50                   	push   %eax
+  800dd4:	ff 75 08             	push   0x8(%ebp)
+  800dd7:	e8 e5 fc ff ff       	call   800ac1 <file_get_block>
+  800ddc:	83 c4 10             	add    $0x10,%esp
+  800ddf:	85 c0                	test   %eax,%eax
+  800de1:	78 41                	js     800e24 <file_read+0xa9>
+			return r;
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800de3:	89 da                	mov    %ebx,%edx
+  800de5:	c1 fa 1f             	sar    $0x1f,%edx
+  800de8:	c1 ea 14             	shr    $0x14,%edx
+  800deb:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800dee:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800df3:	29 d0                	sub    %edx,%eax
+  800df5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800dfa:	29 c2                	sub    %eax,%edx
+  800dfc:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  800dff:	29 f1                	sub    %esi,%ecx
+  800e01:	39 ca                	cmp    %ecx,%edx
+  800e03:	89 ce                	mov    %ecx,%esi
+  800e05:	0f 46 f2             	cmovbe %edx,%esi
+		memmove(buf, blk + pos % BLKSIZE, bn);
+  800e08:	83 ec 04             	sub    $0x4,%esp
+  800e0b:	56                   	push   %esi
+  800e0c:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800e0f:	50                   	push   %eax
+  800e10:	57                   	push   %edi
+  800e11:	e8 08 16 00 00       	call   80241e <memmove>
+		pos += bn;
+  800e16:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  800e18:	01 f7                	add    %esi,%edi
+  800e1a:	83 c4 10             	add    $0x10,%esp
+  800e1d:	eb 96                	jmp    800db5 <file_read+0x3a>
+	}
+
+	return count;
+  800e1f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800e22:	89 c8                	mov    %ecx,%eax
+}
+  800e24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e27:	5b                   	pop    %ebx
+  800e28:	5e                   	pop    %esi
+  800e29:	5f                   	pop    %edi
+  800e2a:	5d                   	pop    %ebp
+  800e2b:	c3                   	ret
+
+00800e2c <file_set_size>:
+}
+
+// Set the size of file f, truncating or extending as necessary.
+int
+file_set_size(struct File *f, off_t newsize)
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	57                   	push   %edi
+  800e30:	56                   	push   %esi
+  800e31:	53                   	push   %ebx
+  800e32:	83 ec 2c             	sub    $0x2c,%esp
+  800e35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e38:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (f->f_size > newsize)
+  800e3b:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+  800e41:	39 f8                	cmp    %edi,%eax
+  800e43:	7f 1c                	jg     800e61 <file_set_size+0x35>
+		file_truncate_blocks(f, newsize);
+	f->f_size = newsize;
+  800e45:	89 be 80 00 00 00    	mov    %edi,0x80(%esi)
+	flush_block(f);
+  800e4b:	83 ec 0c             	sub    $0xc,%esp
+  800e4e:	56                   	push   %esi
+  800e4f:	e8 d4 f5 ff ff       	call   800428 <flush_block>
+	return 0;
+}
+  800e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  800e61:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+  800e67:	05 ff 0f 00 00       	add    $0xfff,%eax
+  800e6c:	0f 48 c2             	cmovs  %edx,%eax
+  800e6f:	c1 f8 0c             	sar    $0xc,%eax
+  800e72:	89 c1                	mov    %eax,%ecx
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  800e74:	8d 97 fe 1f 00 00    	lea    0x1ffe(%edi),%edx
+  800e7a:	89 f8                	mov    %edi,%eax
+  800e7c:	05 ff 0f 00 00       	add    $0xfff,%eax
+  800e81:	0f 49 d0             	cmovns %eax,%edx
+  800e84:	c1 fa 0c             	sar    $0xc,%edx
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  800e87:	89 d3                	mov    %edx,%ebx
+  800e89:	89 ce                	mov    %ecx,%esi
+  800e8b:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  800e8e:	eb 44                	jmp    800ed4 <file_set_size+0xa8>
+	if (new_nblocks <= NDIRECT && f->f_indirect) {
+  800e90:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e96:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800e99:	83 fa 0a             	cmp    $0xa,%edx
+  800e9c:	77 a7                	ja     800e45 <file_set_size+0x19>
+  800e9e:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  800ea4:	85 c0                	test   %eax,%eax
+  800ea6:	74 9d                	je     800e45 <file_set_size+0x19>
+		free_block(f->f_indirect);
+  800ea8:	83 ec 0c             	sub    $0xc,%esp
+  800eab:	50                   	push   %eax
+  800eac:	e8 9e f9 ff ff       	call   80084f <free_block>
+		f->f_indirect = 0;
+  800eb1:	c7 86 b0 00 00 00 00 	movl   $0x0,0xb0(%esi)
+  800eb8:	00 00 00 
+  800ebb:	83 c4 10             	add    $0x10,%esp
+  800ebe:	eb 85                	jmp    800e45 <file_set_size+0x19>
+			cprintf("warning: file_free_block: %e", r);
+  800ec0:	83 ec 08             	sub    $0x8,%esp
+  800ec3:	50                   	push   %eax
+  800ec4:	68 c8 4b 80 00       	push   $0x804bc8
+  800ec9:	e8 82 0d 00 00       	call   801c50 <cprintf>
+  800ece:	83 c4 10             	add    $0x10,%esp
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  800ed1:	83 c3 01             	add    $0x1,%ebx
+  800ed4:	39 f3                	cmp    %esi,%ebx
+  800ed6:	73 b8                	jae    800e90 <file_set_size+0x64>
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	6a 00                	push   $0x0
+  800edd:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  800ee0:	89 da                	mov    %ebx,%edx
+  800ee2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee5:	e8 27 fa ff ff       	call   800911 <file_block_walk>
+  800eea:	83 c4 10             	add    $0x10,%esp
+  800eed:	85 c0                	test   %eax,%eax
+  800eef:	78 cf                	js     800ec0 <file_set_size+0x94>
+	if (*ptr) {
+  800ef1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800ef4:	8b 07                	mov    (%edi),%eax
+  800ef6:	85 c0                	test   %eax,%eax
+  800ef8:	74 d7                	je     800ed1 <file_set_size+0xa5>
+		free_block(*ptr);
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	50                   	push   %eax
+  800efe:	e8 4c f9 ff ff       	call   80084f <free_block>
+		*ptr = 0;
+  800f03:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  800f09:	83 c4 10             	add    $0x10,%esp
+  800f0c:	eb c3                	jmp    800ed1 <file_set_size+0xa5>
+
+00800f0e <file_write>:
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	56                   	push   %esi
+  800f13:	53                   	push   %ebx
+  800f14:	83 ec 2c             	sub    $0x2c,%esp
+  800f17:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if (offset + count > f->f_size)
+  800f1a:	89 df                	mov    %ebx,%edi
+  800f1c:	03 7d 10             	add    0x10(%ebp),%edi
+  800f1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f22:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+  800f28:	72 70                	jb     800f9a <file_write+0x8c>
+  800f2a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  800f2d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (pos = offset; pos < offset + count; ) {
+  800f30:	89 de                	mov    %ebx,%esi
+  800f32:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800f35:	39 c3                	cmp    %eax,%ebx
+  800f37:	73 78                	jae    800fb1 <file_write+0xa3>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  800f39:	83 ec 04             	sub    $0x4,%esp
+  800f3c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f3f:	50                   	push   %eax
+  800f40:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800f46:	85 db                	test   %ebx,%ebx
+  800f48:	0f 49 c3             	cmovns %ebx,%eax
+  800f4b:	c1 f8 0c             	sar    $0xc,%eax
+  800f4e:	50                   	push   %eax
+  800f4f:	ff 75 08             	push   0x8(%ebp)
+  800f52:	e8 6a fb ff ff       	call   800ac1 <file_get_block>
+  800f57:	83 c4 10             	add    $0x10,%esp
+  800f5a:	85 c0                	test   %eax,%eax
+  800f5c:	78 56                	js     800fb4 <file_write+0xa6>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  800f5e:	89 da                	mov    %ebx,%edx
+  800f60:	c1 fa 1f             	sar    $0x1f,%edx
+  800f63:	c1 ea 14             	shr    $0x14,%edx
+  800f66:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  800f69:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f6e:	29 d0                	sub    %edx,%eax
+  800f70:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800f75:	29 c1                	sub    %eax,%ecx
+  800f77:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  800f7a:	29 f2                	sub    %esi,%edx
+  800f7c:	39 d1                	cmp    %edx,%ecx
+  800f7e:	89 d6                	mov    %edx,%esi
+  800f80:	0f 46 f1             	cmovbe %ecx,%esi
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  800f83:	83 ec 04             	sub    $0x4,%esp
+  800f86:	56                   	push   %esi
+  800f87:	57                   	push   %edi
+  800f88:	03 45 e4             	add    -0x1c(%ebp),%eax
+  800f8b:	50                   	push   %eax
+  800f8c:	e8 8d 14 00 00       	call   80241e <memmove>
+		pos += bn;
+  800f91:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  800f93:	01 f7                	add    %esi,%edi
+  800f95:	83 c4 10             	add    $0x10,%esp
+  800f98:	eb 96                	jmp    800f30 <file_write+0x22>
+		if ((r = file_set_size(f, offset + count)) < 0)
+  800f9a:	83 ec 08             	sub    $0x8,%esp
+  800f9d:	57                   	push   %edi
+  800f9e:	50                   	push   %eax
+  800f9f:	e8 88 fe ff ff       	call   800e2c <file_set_size>
+  800fa4:	83 c4 10             	add    $0x10,%esp
+  800fa7:	85 c0                	test   %eax,%eax
+  800fa9:	0f 89 7b ff ff ff    	jns    800f2a <file_write+0x1c>
+  800faf:	eb 03                	jmp    800fb4 <file_write+0xa6>
+	return count;
+  800fb1:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+  800fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb7:	5b                   	pop    %ebx
+  800fb8:	5e                   	pop    %esi
+  800fb9:	5f                   	pop    %edi
+  800fba:	5d                   	pop    %ebp
+  800fbb:	c3                   	ret
+
+00800fbc <file_flush>:
+// Loop over all the blocks in file.
+// Translate the file block number into a disk block number
+// and then check whether that disk block is dirty.  If so, write it out.
+void
+file_flush(struct File *f)
+{
+  800fbc:	55                   	push   %ebp
+  800fbd:	89 e5                	mov    %esp,%ebp
+  800fbf:	56                   	push   %esi
+  800fc0:	53                   	push   %ebx
+  800fc1:	83 ec 10             	sub    $0x10,%esp
+  800fc4:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i;
+	uint32_t *pdiskbno;
+
+	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
+  800fc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcc:	eb 03                	jmp    800fd1 <file_flush+0x15>
+  800fce:	83 c3 01             	add    $0x1,%ebx
+  800fd1:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+  800fd7:	8d 82 fe 1f 00 00    	lea    0x1ffe(%edx),%eax
+  800fdd:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  800fe3:	0f 49 c2             	cmovns %edx,%eax
+  800fe6:	c1 f8 0c             	sar    $0xc,%eax
+  800fe9:	39 d8                	cmp    %ebx,%eax
+  800feb:	7e 3b                	jle    801028 <file_flush+0x6c>
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+  800ff0:	6a 00                	push   $0x0
+  800ff2:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  800ff5:	89 da                	mov    %ebx,%edx
+  800ff7:	89 f0                	mov    %esi,%eax
+  800ff9:	e8 13 f9 ff ff       	call   800911 <file_block_walk>
+  800ffe:	83 c4 10             	add    $0x10,%esp
+  801001:	85 c0                	test   %eax,%eax
+  801003:	78 c9                	js     800fce <file_flush+0x12>
+		    pdiskbno == NULL || *pdiskbno == 0)
+  801005:	8b 45 f4             	mov    -0xc(%ebp),%eax
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  801008:	85 c0                	test   %eax,%eax
+  80100a:	74 c2                	je     800fce <file_flush+0x12>
+		    pdiskbno == NULL || *pdiskbno == 0)
+  80100c:	8b 00                	mov    (%eax),%eax
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	74 bc                	je     800fce <file_flush+0x12>
+			continue;
+		flush_block(diskaddr(*pdiskbno));
+  801012:	83 ec 0c             	sub    $0xc,%esp
+  801015:	50                   	push   %eax
+  801016:	e8 8f f3 ff ff       	call   8003aa <diskaddr>
+  80101b:	89 04 24             	mov    %eax,(%esp)
+  80101e:	e8 05 f4 ff ff       	call   800428 <flush_block>
+  801023:	83 c4 10             	add    $0x10,%esp
+  801026:	eb a6                	jmp    800fce <file_flush+0x12>
+	}
+	flush_block(f);
+  801028:	83 ec 0c             	sub    $0xc,%esp
+  80102b:	56                   	push   %esi
+  80102c:	e8 f7 f3 ff ff       	call   800428 <flush_block>
+	if (f->f_indirect)
+  801031:	8b 86 b0 00 00 00    	mov    0xb0(%esi),%eax
+  801037:	83 c4 10             	add    $0x10,%esp
+  80103a:	85 c0                	test   %eax,%eax
+  80103c:	75 07                	jne    801045 <file_flush+0x89>
+		flush_block(diskaddr(f->f_indirect));
+}
+  80103e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5d                   	pop    %ebp
+  801044:	c3                   	ret
+		flush_block(diskaddr(f->f_indirect));
+  801045:	83 ec 0c             	sub    $0xc,%esp
+  801048:	50                   	push   %eax
+  801049:	e8 5c f3 ff ff       	call   8003aa <diskaddr>
+  80104e:	89 04 24             	mov    %eax,(%esp)
+  801051:	e8 d2 f3 ff ff       	call   800428 <flush_block>
+  801056:	83 c4 10             	add    $0x10,%esp
+}
+  801059:	eb e3                	jmp    80103e <file_flush+0x82>
+
+0080105b <file_create>:
+{
+  80105b:	55                   	push   %ebp
+  80105c:	89 e5                	mov    %esp,%ebp
+  80105e:	57                   	push   %edi
+  80105f:	56                   	push   %esi
+  801060:	53                   	push   %ebx
+  801061:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  801067:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80106d:	50                   	push   %eax
+  80106e:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  801074:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  80107a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80107d:	e8 b2 fa ff ff       	call   800b34 <walk_path>
+  801082:	83 c4 10             	add    $0x10,%esp
+  801085:	85 c0                	test   %eax,%eax
+  801087:	0f 84 cd 00 00 00    	je     80115a <file_create+0xff>
+  80108d:	89 c3                	mov    %eax,%ebx
+	if (r != -E_NOT_FOUND || dir == 0)
+  80108f:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801092:	0f 85 f1 00 00 00    	jne    801189 <file_create+0x12e>
+  801098:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+  80109e:	85 ff                	test   %edi,%edi
+  8010a0:	0f 84 e3 00 00 00    	je     801189 <file_create+0x12e>
+	assert((dir->f_size % BLKSIZE) == 0);
+  8010a6:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+  8010ac:	89 c3                	mov    %eax,%ebx
+  8010ae:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8010b4:	75 58                	jne    80110e <file_create+0xb3>
+	nblock = dir->f_size / BLKSIZE;
+  8010b6:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  8010bc:	85 c0                	test   %eax,%eax
+  8010be:	0f 48 c2             	cmovs  %edx,%eax
+  8010c1:	c1 f8 0c             	sar    $0xc,%eax
+  8010c4:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+	for (i = 0; i < nblock; i++) {
+  8010ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cf:	39 b5 54 ff ff ff    	cmp    %esi,-0xac(%ebp)
+  8010d5:	74 55                	je     80112c <file_create+0xd1>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  8010d7:	83 ec 04             	sub    $0x4,%esp
+  8010da:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  8010e0:	50                   	push   %eax
+  8010e1:	56                   	push   %esi
+  8010e2:	57                   	push   %edi
+  8010e3:	e8 d9 f9 ff ff       	call   800ac1 <file_get_block>
+  8010e8:	83 c4 10             	add    $0x10,%esp
+  8010eb:	85 c0                	test   %eax,%eax
+  8010ed:	78 67                	js     801156 <file_create+0xfb>
+		for (j = 0; j < BLKFILES; j++)
+  8010ef:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  8010f5:	8d 88 00 10 00 00    	lea    0x1000(%eax),%ecx
+  8010fb:	39 c8                	cmp    %ecx,%eax
+  8010fd:	74 28                	je     801127 <file_create+0xcc>
+			if (f[j].f_name[0] == '\0') {
+  8010ff:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+  801105:	80 38 00             	cmpb   $0x0,(%eax)
+  801108:	74 57                	je     801161 <file_create+0x106>
+  80110a:	89 d0                	mov    %edx,%eax
+  80110c:	eb ed                	jmp    8010fb <file_create+0xa0>
+	assert((dir->f_size % BLKSIZE) == 0);
+  80110e:	68 ab 4b 80 00       	push   $0x804bab
+  801113:	68 bd 48 80 00       	push   $0x8048bd
+  801118:	68 01 01 00 00       	push   $0x101
+  80111d:	68 d1 4a 80 00       	push   $0x804ad1
+  801122:	e8 4e 0a 00 00       	call   801b75 <_panic>
+	for (i = 0; i < nblock; i++) {
+  801127:	83 c6 01             	add    $0x1,%esi
+  80112a:	eb a3                	jmp    8010cf <file_create+0x74>
+	dir->f_size += BLKSIZE;
+  80112c:	81 87 80 00 00 00 00 	addl   $0x1000,0x80(%edi)
+  801133:	10 00 00 
+	if ((r = file_get_block(dir, i, &blk)) < 0)
+  801136:	83 ec 04             	sub    $0x4,%esp
+  801139:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  80113f:	50                   	push   %eax
+  801140:	56                   	push   %esi
+  801141:	57                   	push   %edi
+  801142:	e8 7a f9 ff ff       	call   800ac1 <file_get_block>
+  801147:	83 c4 10             	add    $0x10,%esp
+  80114a:	85 c0                	test   %eax,%eax
+  80114c:	78 45                	js     801193 <file_create+0x138>
+	f = (struct File*) blk;
+  80114e:	8b b5 5c ff ff ff    	mov    -0xa4(%ebp),%esi
+	return 0;
+  801154:	eb 0d                	jmp    801163 <file_create+0x108>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  801156:	89 c3                	mov    %eax,%ebx
+  801158:	eb 2f                	jmp    801189 <file_create+0x12e>
+		return -E_FILE_EXISTS;
+  80115a:	bb f3 ff ff ff       	mov    $0xfffffff3,%ebx
+  80115f:	eb 28                	jmp    801189 <file_create+0x12e>
+			if (f[j].f_name[0] == '\0') {
+  801161:	89 c6                	mov    %eax,%esi
+	*file = &f[0];
+  801163:	89 b5 60 ff ff ff    	mov    %esi,-0xa0(%ebp)
+	strcpy(f->f_name, name);
+  801169:	83 ec 08             	sub    $0x8,%esp
+  80116c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  801172:	50                   	push   %eax
+  801173:	56                   	push   %esi
+  801174:	e8 1f 11 00 00       	call   802298 <strcpy>
+	*pf = f;
+  801179:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80117c:	89 30                	mov    %esi,(%eax)
+	file_flush(dir);
+  80117e:	89 3c 24             	mov    %edi,(%esp)
+  801181:	e8 36 fe ff ff       	call   800fbc <file_flush>
+	return 0;
+  801186:	83 c4 10             	add    $0x10,%esp
+}
+  801189:	89 d8                	mov    %ebx,%eax
+  80118b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118e:	5b                   	pop    %ebx
+  80118f:	5e                   	pop    %esi
+  801190:	5f                   	pop    %edi
+  801191:	5d                   	pop    %ebp
+  801192:	c3                   	ret
+		return r;
+  801193:	89 c3                	mov    %eax,%ebx
+  801195:	eb f2                	jmp    801189 <file_create+0x12e>
+
+00801197 <fs_sync>:
+
+
+// Sync the entire file system.  A big hammer.
+void
+fs_sync(void)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	53                   	push   %ebx
+  80119b:	83 ec 10             	sub    $0x10,%esp
+	flush_blocks(diskaddr(1), super->s_nblocks - 1);
+  80119e:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8011a3:	8b 58 04             	mov    0x4(%eax),%ebx
+  8011a6:	83 eb 01             	sub    $0x1,%ebx
+  8011a9:	6a 01                	push   $0x1
+  8011ab:	e8 fa f1 ff ff       	call   8003aa <diskaddr>
+  8011b0:	83 c4 08             	add    $0x8,%esp
+  8011b3:	53                   	push   %ebx
+  8011b4:	50                   	push   %eax
+  8011b5:	e8 27 f3 ff ff       	call   8004e1 <flush_blocks>
+}
+  8011ba:	83 c4 10             	add    $0x10,%esp
+  8011bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011c0:	c9                   	leave
+  8011c1:	c3                   	ret
+
+008011c2 <serve_sync>:
+}
+
+
+int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+  8011c2:	55                   	push   %ebp
+  8011c3:	89 e5                	mov    %esp,%ebp
+  8011c5:	83 ec 08             	sub    $0x8,%esp
+	fs_sync();
+  8011c8:	e8 ca ff ff ff       	call   801197 <fs_sync>
+	return 0;
+}
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d2:	c9                   	leave
+  8011d3:	c3                   	ret
+
+008011d4 <serve_init>:
+	for (i = 0; i < MAXOPEN; i++) {
+  8011d4:	ba 60 60 80 00       	mov    $0x806060,%edx
+	uintptr_t va = FILEVA;
+  8011d9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  8011de:	b9 00 00 00 00       	mov    $0x0,%ecx
+		opentab[i].o_fileid = i;
+  8011e3:	89 0a                	mov    %ecx,(%edx)
+		opentab[i].o_fd = (struct Fd*) va;
+  8011e5:	89 42 0c             	mov    %eax,0xc(%edx)
+		va += PGSIZE;
+  8011e8:	05 00 10 00 00       	add    $0x1000,%eax
+	for (i = 0; i < MAXOPEN; i++) {
+  8011ed:	83 c1 01             	add    $0x1,%ecx
+  8011f0:	83 c2 10             	add    $0x10,%edx
+  8011f3:	3d 00 00 40 d0       	cmp    $0xd0400000,%eax
+  8011f8:	75 e9                	jne    8011e3 <serve_init+0xf>
+}
+  8011fa:	c3                   	ret
+
+008011fb <openfile_alloc>:
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+  801201:	83 ec 0c             	sub    $0xc,%esp
+  801204:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (i = 0; i < MAXOPEN; i++) {
+  801207:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch (pageref(opentab[i].o_fd)) {
+  80120c:	89 de                	mov    %ebx,%esi
+  80120e:	c1 e6 04             	shl    $0x4,%esi
+  801211:	83 ec 0c             	sub    $0xc,%esp
+  801214:	ff b6 6c 60 80 00    	push   0x80606c(%esi)
+  80121a:	e8 83 2c 00 00       	call   803ea2 <pageref>
+  80121f:	83 c4 10             	add    $0x10,%esp
+  801222:	85 c0                	test   %eax,%eax
+  801224:	74 17                	je     80123d <openfile_alloc+0x42>
+  801226:	83 f8 01             	cmp    $0x1,%eax
+  801229:	74 30                	je     80125b <openfile_alloc+0x60>
+	for (i = 0; i < MAXOPEN; i++) {
+  80122b:	83 c3 01             	add    $0x1,%ebx
+  80122e:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  801234:	75 d6                	jne    80120c <openfile_alloc+0x11>
+	return -E_MAX_OPEN;
+  801236:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80123b:	eb 4f                	jmp    80128c <openfile_alloc+0x91>
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W)) < 0)
+  80123d:	83 ec 04             	sub    $0x4,%esp
+  801240:	6a 07                	push   $0x7
+  801242:	89 d8                	mov    %ebx,%eax
+  801244:	c1 e0 04             	shl    $0x4,%eax
+  801247:	ff b0 6c 60 80 00    	push   0x80606c(%eax)
+  80124d:	6a 00                	push   $0x0
+  80124f:	e8 3c 15 00 00       	call   802790 <sys_page_alloc>
+  801254:	83 c4 10             	add    $0x10,%esp
+  801257:	85 c0                	test   %eax,%eax
+  801259:	78 31                	js     80128c <openfile_alloc+0x91>
+			opentab[i].o_fileid += MAXOPEN;
+  80125b:	c1 e3 04             	shl    $0x4,%ebx
+  80125e:	81 83 60 60 80 00 00 	addl   $0x400,0x806060(%ebx)
+  801265:	04 00 00 
+			*o = &opentab[i];
+  801268:	81 c6 60 60 80 00    	add    $0x806060,%esi
+  80126e:	89 37                	mov    %esi,(%edi)
+			memset(opentab[i].o_fd, 0, PGSIZE);
+  801270:	83 ec 04             	sub    $0x4,%esp
+  801273:	68 00 10 00 00       	push   $0x1000
+  801278:	6a 00                	push   $0x0
+  80127a:	ff b3 6c 60 80 00    	push   0x80606c(%ebx)
+  801280:	e8 64 11 00 00       	call   8023e9 <memset>
+			return (*o)->o_fileid;
+  801285:	8b 07                	mov    (%edi),%eax
+  801287:	8b 00                	mov    (%eax),%eax
+  801289:	83 c4 10             	add    $0x10,%esp
+}
+  80128c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128f:	5b                   	pop    %ebx
+  801290:	5e                   	pop    %esi
+  801291:	5f                   	pop    %edi
+  801292:	5d                   	pop    %ebp
+  801293:	c3                   	ret
+
+00801294 <openfile_lookup>:
+{
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+  801297:	57                   	push   %edi
+  801298:	56                   	push   %esi
+  801299:	53                   	push   %ebx
+  80129a:	83 ec 18             	sub    $0x18,%esp
+  80129d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	o = &opentab[fileid % MAXOPEN];
+  8012a0:	89 fb                	mov    %edi,%ebx
+  8012a2:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8012a8:	89 de                	mov    %ebx,%esi
+  8012aa:	c1 e6 04             	shl    $0x4,%esi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  8012ad:	ff b6 6c 60 80 00    	push   0x80606c(%esi)
+	o = &opentab[fileid % MAXOPEN];
+  8012b3:	81 c6 60 60 80 00    	add    $0x806060,%esi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  8012b9:	e8 e4 2b 00 00       	call   803ea2 <pageref>
+  8012be:	83 c4 10             	add    $0x10,%esp
+  8012c1:	83 f8 01             	cmp    $0x1,%eax
+  8012c4:	7e 1d                	jle    8012e3 <openfile_lookup+0x4f>
+  8012c6:	c1 e3 04             	shl    $0x4,%ebx
+  8012c9:	39 bb 60 60 80 00    	cmp    %edi,0x806060(%ebx)
+  8012cf:	75 19                	jne    8012ea <openfile_lookup+0x56>
+	*po = o;
+  8012d1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8012d4:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8012d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012de:	5b                   	pop    %ebx
+  8012df:	5e                   	pop    %esi
+  8012e0:	5f                   	pop    %edi
+  8012e1:	5d                   	pop    %ebp
+  8012e2:	c3                   	ret
+		return -E_INVAL;
+  8012e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e8:	eb f1                	jmp    8012db <openfile_lookup+0x47>
+  8012ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ef:	eb ea                	jmp    8012db <openfile_lookup+0x47>
+
+008012f1 <serve_set_size>:
+{
+  8012f1:	55                   	push   %ebp
+  8012f2:	89 e5                	mov    %esp,%ebp
+  8012f4:	53                   	push   %ebx
+  8012f5:	83 ec 18             	sub    $0x18,%esp
+  8012f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8012fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012fe:	50                   	push   %eax
+  8012ff:	ff 33                	push   (%ebx)
+  801301:	ff 75 08             	push   0x8(%ebp)
+  801304:	e8 8b ff ff ff       	call   801294 <openfile_lookup>
+  801309:	83 c4 10             	add    $0x10,%esp
+  80130c:	85 c0                	test   %eax,%eax
+  80130e:	78 14                	js     801324 <serve_set_size+0x33>
+	return file_set_size(o->o_file, req->req_size);
+  801310:	83 ec 08             	sub    $0x8,%esp
+  801313:	ff 73 04             	push   0x4(%ebx)
+  801316:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801319:	ff 70 04             	push   0x4(%eax)
+  80131c:	e8 0b fb ff ff       	call   800e2c <file_set_size>
+  801321:	83 c4 10             	add    $0x10,%esp
+}
+  801324:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801327:	c9                   	leave
+  801328:	c3                   	ret
+
+00801329 <serve_read>:
+{
+  801329:	55                   	push   %ebp
+  80132a:	89 e5                	mov    %esp,%ebp
+  80132c:	56                   	push   %esi
+  80132d:	53                   	push   %ebx
+  80132e:	83 ec 14             	sub    $0x14,%esp
+  801331:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801334:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801337:	50                   	push   %eax
+  801338:	ff 33                	push   (%ebx)
+  80133a:	ff 75 08             	push   0x8(%ebp)
+  80133d:	e8 52 ff ff ff       	call   801294 <openfile_lookup>
+  801342:	83 c4 10             	add    $0x10,%esp
+  801345:	85 c0                	test   %eax,%eax
+  801347:	78 2d                	js     801376 <serve_read+0x4d>
+	if ((b = file_read(o->o_file, ret->ret_buf, MIN(req->req_n, PGSIZE), o->o_fd->fd_offset)) < 0)
+  801349:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80134c:	8b 46 0c             	mov    0xc(%esi),%eax
+  80134f:	ff 70 04             	push   0x4(%eax)
+  801352:	8b 43 04             	mov    0x4(%ebx),%eax
+  801355:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80135a:	39 d0                	cmp    %edx,%eax
+  80135c:	0f 47 c2             	cmova  %edx,%eax
+  80135f:	50                   	push   %eax
+  801360:	53                   	push   %ebx
+  801361:	ff 76 04             	push   0x4(%esi)
+  801364:	e8 12 fa ff ff       	call   800d7b <file_read>
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	85 c0                	test   %eax,%eax
+  80136e:	78 06                	js     801376 <serve_read+0x4d>
+	o->o_fd->fd_offset += b;
+  801370:	8b 56 0c             	mov    0xc(%esi),%edx
+  801373:	01 42 04             	add    %eax,0x4(%edx)
+}
+  801376:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801379:	5b                   	pop    %ebx
+  80137a:	5e                   	pop    %esi
+  80137b:	5d                   	pop    %ebp
+  80137c:	c3                   	ret
+
+0080137d <serve_write>:
+{
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+  801380:	56                   	push   %esi
+  801381:	53                   	push   %ebx
+  801382:	83 ec 14             	sub    $0x14,%esp
+  801385:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  801388:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80138b:	50                   	push   %eax
+  80138c:	ff 33                	push   (%ebx)
+  80138e:	ff 75 08             	push   0x8(%ebp)
+  801391:	e8 fe fe ff ff       	call   801294 <openfile_lookup>
+  801396:	83 c4 10             	add    $0x10,%esp
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	78 30                	js     8013cd <serve_write+0x50>
+	if ((b = file_write(o->o_file, req->req_buf, MIN(req->req_n, sizeof(req->req_buf)), o->o_fd->fd_offset)) < 0)
+  80139d:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8013a0:	8b 46 0c             	mov    0xc(%esi),%eax
+  8013a3:	ff 70 04             	push   0x4(%eax)
+  8013a6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8013a9:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8013ae:	39 d0                	cmp    %edx,%eax
+  8013b0:	0f 47 c2             	cmova  %edx,%eax
+  8013b3:	50                   	push   %eax
+  8013b4:	83 c3 08             	add    $0x8,%ebx
+  8013b7:	53                   	push   %ebx
+  8013b8:	ff 76 04             	push   0x4(%esi)
+  8013bb:	e8 4e fb ff ff       	call   800f0e <file_write>
+  8013c0:	83 c4 10             	add    $0x10,%esp
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	78 06                	js     8013cd <serve_write+0x50>
+	o->o_fd->fd_offset += b;
+  8013c7:	8b 56 0c             	mov    0xc(%esi),%edx
+  8013ca:	01 42 04             	add    %eax,0x4(%edx)
+}
+  8013cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013d0:	5b                   	pop    %ebx
+  8013d1:	5e                   	pop    %esi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+
+008013d4 <serve_stat>:
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	56                   	push   %esi
+  8013d8:	53                   	push   %ebx
+  8013d9:	83 ec 14             	sub    $0x14,%esp
+  8013dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8013df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e2:	50                   	push   %eax
+  8013e3:	ff 33                	push   (%ebx)
+  8013e5:	ff 75 08             	push   0x8(%ebp)
+  8013e8:	e8 a7 fe ff ff       	call   801294 <openfile_lookup>
+  8013ed:	83 c4 10             	add    $0x10,%esp
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	78 3c                	js     801430 <serve_stat+0x5c>
+	strcpy(ret->ret_name, o->o_file->f_name);
+  8013f4:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8013f7:	83 ec 08             	sub    $0x8,%esp
+  8013fa:	ff 76 04             	push   0x4(%esi)
+  8013fd:	53                   	push   %ebx
+  8013fe:	e8 95 0e 00 00       	call   802298 <strcpy>
+	ret->ret_size = o->o_file->f_size;
+  801403:	8b 46 04             	mov    0x4(%esi),%eax
+  801406:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80140c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  801412:	8b 46 04             	mov    0x4(%esi),%eax
+  801415:	83 c4 10             	add    $0x10,%esp
+  801418:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  80141f:	0f 94 c0             	sete   %al
+  801422:	0f b6 c0             	movzbl %al,%eax
+  801425:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80142b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801430:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801433:	5b                   	pop    %ebx
+  801434:	5e                   	pop    %esi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+
+00801437 <serve_flush>:
+{
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  80143d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801440:	50                   	push   %eax
+  801441:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801444:	ff 30                	push   (%eax)
+  801446:	ff 75 08             	push   0x8(%ebp)
+  801449:	e8 46 fe ff ff       	call   801294 <openfile_lookup>
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	85 c0                	test   %eax,%eax
+  801453:	78 16                	js     80146b <serve_flush+0x34>
+	file_flush(o->o_file);
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145b:	ff 70 04             	push   0x4(%eax)
+  80145e:	e8 59 fb ff ff       	call   800fbc <file_flush>
+	return 0;
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80146b:	c9                   	leave
+  80146c:	c3                   	ret
+
+0080146d <serve_open>:
+{
+  80146d:	55                   	push   %ebp
+  80146e:	89 e5                	mov    %esp,%ebp
+  801470:	53                   	push   %ebx
+  801471:	81 ec 18 04 00 00    	sub    $0x418,%esp
+  801477:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	memmove(path, req->req_path, MAXPATHLEN);
+  80147a:	68 00 04 00 00       	push   $0x400
+  80147f:	53                   	push   %ebx
+  801480:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  801486:	50                   	push   %eax
+  801487:	e8 92 0f 00 00       	call   80241e <memmove>
+	path[MAXPATHLEN-1] = 0;
+  80148c:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if ((r = openfile_alloc(&o)) < 0) {
+  801490:	8d 85 f0 fb ff ff    	lea    -0x410(%ebp),%eax
+  801496:	89 04 24             	mov    %eax,(%esp)
+  801499:	e8 5d fd ff ff       	call   8011fb <openfile_alloc>
+  80149e:	83 c4 10             	add    $0x10,%esp
+  8014a1:	85 c0                	test   %eax,%eax
+  8014a3:	0f 88 ea 00 00 00    	js     801593 <serve_open+0x126>
+	if (req->req_omode & O_CREAT) {
+  8014a9:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%ebx)
+  8014b0:	74 33                	je     8014e5 <serve_open+0x78>
+		if ((r = file_create(path, &f)) < 0) {
+  8014b2:	83 ec 08             	sub    $0x8,%esp
+  8014b5:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8014bb:	50                   	push   %eax
+  8014bc:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8014c2:	50                   	push   %eax
+  8014c3:	e8 93 fb ff ff       	call   80105b <file_create>
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	79 37                	jns    801506 <serve_open+0x99>
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  8014cf:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%ebx)
+  8014d6:	0f 85 b7 00 00 00    	jne    801593 <serve_open+0x126>
+  8014dc:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  8014df:	0f 85 ae 00 00 00    	jne    801593 <serve_open+0x126>
+		if ((r = file_open(path, &f)) < 0) {
+  8014e5:	83 ec 08             	sub    $0x8,%esp
+  8014e8:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  8014ee:	50                   	push   %eax
+  8014ef:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  8014f5:	50                   	push   %eax
+  8014f6:	e8 66 f8 ff ff       	call   800d61 <file_open>
+  8014fb:	83 c4 10             	add    $0x10,%esp
+  8014fe:	85 c0                	test   %eax,%eax
+  801500:	0f 88 8d 00 00 00    	js     801593 <serve_open+0x126>
+	if (req->req_omode & O_TRUNC) {
+  801506:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%ebx)
+  80150d:	74 17                	je     801526 <serve_open+0xb9>
+		if ((r = file_set_size(f, 0)) < 0) {
+  80150f:	83 ec 08             	sub    $0x8,%esp
+  801512:	6a 00                	push   $0x0
+  801514:	ff b5 f4 fb ff ff    	push   -0x40c(%ebp)
+  80151a:	e8 0d f9 ff ff       	call   800e2c <file_set_size>
+  80151f:	83 c4 10             	add    $0x10,%esp
+  801522:	85 c0                	test   %eax,%eax
+  801524:	78 6d                	js     801593 <serve_open+0x126>
+	if ((r = file_open(path, &f)) < 0) {
+  801526:	83 ec 08             	sub    $0x8,%esp
+  801529:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  80152f:	50                   	push   %eax
+  801530:	8d 85 f8 fb ff ff    	lea    -0x408(%ebp),%eax
+  801536:	50                   	push   %eax
+  801537:	e8 25 f8 ff ff       	call   800d61 <file_open>
+  80153c:	83 c4 10             	add    $0x10,%esp
+  80153f:	85 c0                	test   %eax,%eax
+  801541:	78 50                	js     801593 <serve_open+0x126>
+	o->o_file = f;
+  801543:	8b 85 f0 fb ff ff    	mov    -0x410(%ebp),%eax
+  801549:	8b 95 f4 fb ff ff    	mov    -0x40c(%ebp),%edx
+  80154f:	89 50 04             	mov    %edx,0x4(%eax)
+	o->o_fd->fd_file.id = o->o_fileid;
+  801552:	8b 50 0c             	mov    0xc(%eax),%edx
+  801555:	8b 08                	mov    (%eax),%ecx
+  801557:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  80155a:	8b 48 0c             	mov    0xc(%eax),%ecx
+  80155d:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  801563:	83 e2 03             	and    $0x3,%edx
+  801566:	89 51 08             	mov    %edx,0x8(%ecx)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  801569:	8b 50 0c             	mov    0xc(%eax),%edx
+  80156c:	8b 0d 64 a0 80 00    	mov    0x80a064,%ecx
+  801572:	89 0a                	mov    %ecx,(%edx)
+	o->o_mode = req->req_omode;
+  801574:	8b 93 00 04 00 00    	mov    0x400(%ebx),%edx
+  80157a:	89 50 08             	mov    %edx,0x8(%eax)
+	*pg_store = o->o_fd;
+  80157d:	8b 50 0c             	mov    0xc(%eax),%edx
+  801580:	8b 45 10             	mov    0x10(%ebp),%eax
+  801583:	89 10                	mov    %edx,(%eax)
+	*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+  801585:	8b 45 14             	mov    0x14(%ebp),%eax
+  801588:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+	return 0;
+  80158e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801593:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801596:	c9                   	leave
+  801597:	c3                   	ret
+
+00801598 <serve>:
+};
+#define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
+
+void
+serve(void)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	56                   	push   %esi
+  80159c:	53                   	push   %ebx
+  80159d:	83 ec 10             	sub    $0x10,%esp
+	int perm, r;
+	void *pg;
+
+	while (1) {
+		perm = 0;
+		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  8015a0:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+  8015a3:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  8015a6:	eb 13                	jmp    8015bb <serve+0x23>
+			cprintf("fs req %d from %08x [page %08x: %s]\n",
+				req, whom, uvpt[PGNUM(fsreq)], fsreq);
+
+		// All requests must contain an argument page
+		if (!(perm & PTE_P)) {
+			cprintf("Invalid request from %08x: no argument page\n",
+  8015a8:	83 ec 08             	sub    $0x8,%esp
+  8015ab:	ff 75 f4             	push   -0xc(%ebp)
+  8015ae:	68 e8 4b 80 00       	push   $0x804be8
+  8015b3:	e8 98 06 00 00       	call   801c50 <cprintf>
+				whom);
+			continue; // just leave it hanging...
+  8015b8:	83 c4 10             	add    $0x10,%esp
+		perm = 0;
+  8015bb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+  8015c2:	83 ec 04             	sub    $0x4,%esp
+  8015c5:	53                   	push   %ebx
+  8015c6:	ff 35 44 60 80 00    	push   0x806044
+  8015cc:	56                   	push   %esi
+  8015cd:	e8 98 1d 00 00       	call   80336a <ipc_recv>
+		if (!(perm & PTE_P)) {
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	f6 45 f0 01          	testb  $0x1,-0x10(%ebp)
+  8015d9:	74 cd                	je     8015a8 <serve+0x10>
+		}
+
+		pg = NULL;
+  8015db:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+		if (req == FSREQ_OPEN) {
+  8015e2:	83 f8 01             	cmp    $0x1,%eax
+  8015e5:	74 23                	je     80160a <serve+0x72>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+		} else if (req < NHANDLERS && handlers[req]) {
+  8015e7:	83 f8 08             	cmp    $0x8,%eax
+  8015ea:	77 36                	ja     801622 <serve+0x8a>
+  8015ec:	8b 14 85 20 60 80 00 	mov    0x806020(,%eax,4),%edx
+  8015f3:	85 d2                	test   %edx,%edx
+  8015f5:	74 2b                	je     801622 <serve+0x8a>
+			r = handlers[req](whom, fsreq);
+  8015f7:	83 ec 08             	sub    $0x8,%esp
+  8015fa:	ff 35 44 60 80 00    	push   0x806044
+  801600:	ff 75 f4             	push   -0xc(%ebp)
+  801603:	ff d2                	call   *%edx
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	eb 31                	jmp    80163b <serve+0xa3>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+  80160a:	53                   	push   %ebx
+  80160b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80160e:	50                   	push   %eax
+  80160f:	ff 35 44 60 80 00    	push   0x806044
+  801615:	ff 75 f4             	push   -0xc(%ebp)
+  801618:	e8 50 fe ff ff       	call   80146d <serve_open>
+  80161d:	83 c4 10             	add    $0x10,%esp
+  801620:	eb 19                	jmp    80163b <serve+0xa3>
+		} else {
+			cprintf("Invalid request code %d from %08x\n", req, whom);
+  801622:	83 ec 04             	sub    $0x4,%esp
+  801625:	ff 75 f4             	push   -0xc(%ebp)
+  801628:	50                   	push   %eax
+  801629:	68 18 4c 80 00       	push   $0x804c18
+  80162e:	e8 1d 06 00 00       	call   801c50 <cprintf>
+  801633:	83 c4 10             	add    $0x10,%esp
+			r = -E_INVAL;
+  801636:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+		}
+		ipc_send(whom, r, pg, perm);
+  80163b:	ff 75 f0             	push   -0x10(%ebp)
+  80163e:	ff 75 ec             	push   -0x14(%ebp)
+  801641:	50                   	push   %eax
+  801642:	ff 75 f4             	push   -0xc(%ebp)
+  801645:	e8 38 1d 00 00       	call   803382 <ipc_send>
+		sys_page_unmap(0, fsreq);
+  80164a:	83 c4 08             	add    $0x8,%esp
+  80164d:	ff 35 44 60 80 00    	push   0x806044
+  801653:	6a 00                	push   $0x0
+  801655:	e8 11 12 00 00       	call   80286b <sys_page_unmap>
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	e9 59 ff ff ff       	jmp    8015bb <serve+0x23>
+
+00801662 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  801662:	55                   	push   %ebp
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	83 ec 14             	sub    $0x14,%esp
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  801668:	c7 05 60 a0 80 00 3b 	movl   $0x804c3b,0x80a060
+  80166f:	4c 80 00 
+	cprintf("FS is running\n");
+  801672:	68 3e 4c 80 00       	push   $0x804c3e
+  801677:	e8 d4 05 00 00       	call   801c50 <cprintf>
+	__asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  80167c:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  801681:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  801686:	66 ef                	out    %ax,(%dx)
+
+	// Check that we are able to do I/O
+	outw(0x8A00, 0x8A00);
+	cprintf("FS can do I/O\n");
+  801688:	c7 04 24 4d 4c 80 00 	movl   $0x804c4d,(%esp)
+  80168f:	e8 bc 05 00 00       	call   801c50 <cprintf>
+
+	serve_init();
+  801694:	e8 3b fb ff ff       	call   8011d4 <serve_init>
+	fs_init();
+  801699:	e8 c4 f3 ff ff       	call   800a62 <fs_init>
+	serve();
+  80169e:	e8 f5 fe ff ff       	call   801598 <serve>
+
+008016a3 <fs_test>:
+
+static char *msg = "This is the NEW message of the day!\n\n";
+
+void
+fs_test(void)
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	char *blk;
+	uint32_t *bits;
+
+	// back up bitmap
+	if ((r = sys_page_alloc(0, (void*) PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  8016a9:	6a 07                	push   $0x7
+  8016ab:	68 00 10 00 00       	push   $0x1000
+  8016b0:	6a 00                	push   $0x0
+  8016b2:	e8 d9 10 00 00       	call   802790 <sys_page_alloc>
+  8016b7:	83 c4 10             	add    $0x10,%esp
+  8016ba:	85 c0                	test   %eax,%eax
+  8016bc:	0f 88 52 02 00 00    	js     801914 <fs_test+0x271>
+		panic("sys_page_alloc: %e", r);
+	bits = (uint32_t*) PGSIZE;
+	memmove(bits, bitmap, PGSIZE);
+  8016c2:	83 ec 04             	sub    $0x4,%esp
+  8016c5:	68 00 10 00 00       	push   $0x1000
+  8016ca:	ff 35 08 b0 80 00    	push   0x80b008
+  8016d0:	68 00 10 00 00       	push   $0x1000
+  8016d5:	e8 44 0d 00 00       	call   80241e <memmove>
+	// allocate block
+	if ((r = alloc_block()) < 0)
+  8016da:	e8 ac f1 ff ff       	call   80088b <alloc_block>
+  8016df:	89 c1                	mov    %eax,%ecx
+  8016e1:	83 c4 10             	add    $0x10,%esp
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	0f 88 3a 02 00 00    	js     801926 <fs_test+0x283>
+		panic("alloc_block: %e", r);
+	// check that block was free
+	assert(bits[r/32] & (1 << (r%32)));
+  8016ec:	8d 40 1f             	lea    0x1f(%eax),%eax
+  8016ef:	0f 49 c1             	cmovns %ecx,%eax
+  8016f2:	c1 f8 05             	sar    $0x5,%eax
+  8016f5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8016fa:	d3 e2                	shl    %cl,%edx
+  8016fc:	89 d1                	mov    %edx,%ecx
+  8016fe:	23 0c 85 00 10 00 00 	and    0x1000(,%eax,4),%ecx
+  801705:	0f 84 2d 02 00 00    	je     801938 <fs_test+0x295>
+	// and is not free any more
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  80170b:	8b 0d 08 b0 80 00    	mov    0x80b008,%ecx
+  801711:	23 14 81             	and    (%ecx,%eax,4),%edx
+  801714:	0f 85 34 02 00 00    	jne    80194e <fs_test+0x2ab>
+	cprintf("alloc_block is good\n");
+  80171a:	83 ec 0c             	sub    $0xc,%esp
+  80171d:	68 a4 4c 80 00       	push   $0x804ca4
+  801722:	e8 29 05 00 00       	call   801c50 <cprintf>
+
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  801727:	83 c4 08             	add    $0x8,%esp
+  80172a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80172d:	50                   	push   %eax
+  80172e:	68 b9 4c 80 00       	push   $0x804cb9
+  801733:	e8 29 f6 ff ff       	call   800d61 <file_open>
+  801738:	83 c4 10             	add    $0x10,%esp
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	0f 88 21 02 00 00    	js     801964 <fs_test+0x2c1>
+		panic("file_open /not-found: %e", r);
+	else if (r == 0)
+  801743:	0f 84 36 02 00 00    	je     80197f <fs_test+0x2dc>
+		panic("file_open /not-found succeeded!");
+	if ((r = file_open("/newmotd", &f)) < 0)
+  801749:	83 ec 08             	sub    $0x8,%esp
+  80174c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174f:	50                   	push   %eax
+  801750:	68 dd 4c 80 00       	push   $0x804cdd
+  801755:	e8 07 f6 ff ff       	call   800d61 <file_open>
+  80175a:	83 c4 10             	add    $0x10,%esp
+  80175d:	85 c0                	test   %eax,%eax
+  80175f:	0f 88 2e 02 00 00    	js     801993 <fs_test+0x2f0>
+		panic("file_open /newmotd: %e", r);
+	cprintf("file_open is good\n");
+  801765:	83 ec 0c             	sub    $0xc,%esp
+  801768:	68 fd 4c 80 00       	push   $0x804cfd
+  80176d:	e8 de 04 00 00       	call   801c50 <cprintf>
+
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  801772:	83 c4 0c             	add    $0xc,%esp
+  801775:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801778:	50                   	push   %eax
+  801779:	6a 00                	push   $0x0
+  80177b:	ff 75 f4             	push   -0xc(%ebp)
+  80177e:	e8 3e f3 ff ff       	call   800ac1 <file_get_block>
+  801783:	83 c4 10             	add    $0x10,%esp
+  801786:	85 c0                	test   %eax,%eax
+  801788:	0f 88 17 02 00 00    	js     8019a5 <fs_test+0x302>
+		panic("file_get_block: %e", r);
+	if (strcmp(blk, msg) != 0)
+  80178e:	83 ec 08             	sub    $0x8,%esp
+  801791:	68 44 4e 80 00       	push   $0x804e44
+  801796:	ff 75 f0             	push   -0x10(%ebp)
+  801799:	e8 ab 0b 00 00       	call   802349 <strcmp>
+  80179e:	83 c4 10             	add    $0x10,%esp
+  8017a1:	85 c0                	test   %eax,%eax
+  8017a3:	0f 85 0e 02 00 00    	jne    8019b7 <fs_test+0x314>
+		panic("file_get_block returned wrong data");
+	cprintf("file_get_block is good\n");
+  8017a9:	83 ec 0c             	sub    $0xc,%esp
+  8017ac:	68 23 4d 80 00       	push   $0x804d23
+  8017b1:	e8 9a 04 00 00       	call   801c50 <cprintf>
+
+	*(volatile char*)blk = *(volatile char*)blk;
+  8017b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8017b9:	0f b6 10             	movzbl (%eax),%edx
+  8017bc:	88 10                	mov    %dl,(%eax)
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  8017be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8017c1:	c1 e8 0c             	shr    $0xc,%eax
+  8017c4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017cb:	83 c4 10             	add    $0x10,%esp
+  8017ce:	a8 40                	test   $0x40,%al
+  8017d0:	0f 84 f5 01 00 00    	je     8019cb <fs_test+0x328>
+	file_flush(f);
+  8017d6:	83 ec 0c             	sub    $0xc,%esp
+  8017d9:	ff 75 f4             	push   -0xc(%ebp)
+  8017dc:	e8 db f7 ff ff       	call   800fbc <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  8017e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8017e4:	c1 e8 0c             	shr    $0xc,%eax
+  8017e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017ee:	83 c4 10             	add    $0x10,%esp
+  8017f1:	a8 40                	test   $0x40,%al
+  8017f3:	0f 85 e8 01 00 00    	jne    8019e1 <fs_test+0x33e>
+	cprintf("file_flush is good\n");
+  8017f9:	83 ec 0c             	sub    $0xc,%esp
+  8017fc:	68 57 4d 80 00       	push   $0x804d57
+  801801:	e8 4a 04 00 00       	call   801c50 <cprintf>
+
+	if ((r = file_set_size(f, 0)) < 0)
+  801806:	83 c4 08             	add    $0x8,%esp
+  801809:	6a 00                	push   $0x0
+  80180b:	ff 75 f4             	push   -0xc(%ebp)
+  80180e:	e8 19 f6 ff ff       	call   800e2c <file_set_size>
+  801813:	83 c4 10             	add    $0x10,%esp
+  801816:	85 c0                	test   %eax,%eax
+  801818:	0f 88 d9 01 00 00    	js     8019f7 <fs_test+0x354>
+		panic("file_set_size: %e", r);
+	assert(f->f_direct[0] == 0);
+  80181e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801821:	83 b8 88 00 00 00 00 	cmpl   $0x0,0x88(%eax)
+  801828:	0f 85 db 01 00 00    	jne    801a09 <fs_test+0x366>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  80182e:	c1 e8 0c             	shr    $0xc,%eax
+  801831:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801838:	a8 40                	test   $0x40,%al
+  80183a:	0f 85 df 01 00 00    	jne    801a1f <fs_test+0x37c>
+	cprintf("file_truncate is good\n");
+  801840:	83 ec 0c             	sub    $0xc,%esp
+  801843:	68 ab 4d 80 00       	push   $0x804dab
+  801848:	e8 03 04 00 00       	call   801c50 <cprintf>
+
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+  80184d:	c7 04 24 44 4e 80 00 	movl   $0x804e44,(%esp)
+  801854:	e8 04 0a 00 00       	call   80225d <strlen>
+  801859:	83 c4 08             	add    $0x8,%esp
+  80185c:	50                   	push   %eax
+  80185d:	ff 75 f4             	push   -0xc(%ebp)
+  801860:	e8 c7 f5 ff ff       	call   800e2c <file_set_size>
+  801865:	83 c4 10             	add    $0x10,%esp
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	0f 88 c5 01 00 00    	js     801a35 <fs_test+0x392>
+		panic("file_set_size 2: %e", r);
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801870:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801873:	89 c2                	mov    %eax,%edx
+  801875:	c1 ea 0c             	shr    $0xc,%edx
+  801878:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80187f:	f6 c2 40             	test   $0x40,%dl
+  801882:	0f 85 bf 01 00 00    	jne    801a47 <fs_test+0x3a4>
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  801888:	83 ec 04             	sub    $0x4,%esp
+  80188b:	8d 55 f0             	lea    -0x10(%ebp),%edx
+  80188e:	52                   	push   %edx
+  80188f:	6a 00                	push   $0x0
+  801891:	50                   	push   %eax
+  801892:	e8 2a f2 ff ff       	call   800ac1 <file_get_block>
+  801897:	83 c4 10             	add    $0x10,%esp
+  80189a:	85 c0                	test   %eax,%eax
+  80189c:	0f 88 bb 01 00 00    	js     801a5d <fs_test+0x3ba>
+		panic("file_get_block 2: %e", r);
+	strcpy(blk, msg);
+  8018a2:	83 ec 08             	sub    $0x8,%esp
+  8018a5:	68 44 4e 80 00       	push   $0x804e44
+  8018aa:	ff 75 f0             	push   -0x10(%ebp)
+  8018ad:	e8 e6 09 00 00       	call   802298 <strcpy>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  8018b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8018b5:	c1 e8 0c             	shr    $0xc,%eax
+  8018b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	a8 40                	test   $0x40,%al
+  8018c4:	0f 84 a5 01 00 00    	je     801a6f <fs_test+0x3cc>
+	file_flush(f);
+  8018ca:	83 ec 0c             	sub    $0xc,%esp
+  8018cd:	ff 75 f4             	push   -0xc(%ebp)
+  8018d0:	e8 e7 f6 ff ff       	call   800fbc <file_flush>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  8018d5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8018d8:	c1 e8 0c             	shr    $0xc,%eax
+  8018db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	a8 40                	test   $0x40,%al
+  8018e7:	0f 85 98 01 00 00    	jne    801a85 <fs_test+0x3e2>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  8018ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f0:	c1 e8 0c             	shr    $0xc,%eax
+  8018f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018fa:	a8 40                	test   $0x40,%al
+  8018fc:	0f 85 99 01 00 00    	jne    801a9b <fs_test+0x3f8>
+	cprintf("file rewrite is good\n");
+  801902:	83 ec 0c             	sub    $0xc,%esp
+  801905:	68 eb 4d 80 00       	push   $0x804deb
+  80190a:	e8 41 03 00 00       	call   801c50 <cprintf>
+}
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	c9                   	leave
+  801913:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  801914:	50                   	push   %eax
+  801915:	68 5c 4c 80 00       	push   $0x804c5c
+  80191a:	6a 12                	push   $0x12
+  80191c:	68 6f 4c 80 00       	push   $0x804c6f
+  801921:	e8 4f 02 00 00       	call   801b75 <_panic>
+		panic("alloc_block: %e", r);
+  801926:	50                   	push   %eax
+  801927:	68 79 4c 80 00       	push   $0x804c79
+  80192c:	6a 17                	push   $0x17
+  80192e:	68 6f 4c 80 00       	push   $0x804c6f
+  801933:	e8 3d 02 00 00       	call   801b75 <_panic>
+	assert(bits[r/32] & (1 << (r%32)));
+  801938:	68 89 4c 80 00       	push   $0x804c89
+  80193d:	68 bd 48 80 00       	push   $0x8048bd
+  801942:	6a 19                	push   $0x19
+  801944:	68 6f 4c 80 00       	push   $0x804c6f
+  801949:	e8 27 02 00 00       	call   801b75 <_panic>
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  80194e:	68 04 4e 80 00       	push   $0x804e04
+  801953:	68 bd 48 80 00       	push   $0x8048bd
+  801958:	6a 1b                	push   $0x1b
+  80195a:	68 6f 4c 80 00       	push   $0x804c6f
+  80195f:	e8 11 02 00 00       	call   801b75 <_panic>
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  801964:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801967:	0f 84 dc fd ff ff    	je     801749 <fs_test+0xa6>
+		panic("file_open /not-found: %e", r);
+  80196d:	50                   	push   %eax
+  80196e:	68 c4 4c 80 00       	push   $0x804cc4
+  801973:	6a 1f                	push   $0x1f
+  801975:	68 6f 4c 80 00       	push   $0x804c6f
+  80197a:	e8 f6 01 00 00       	call   801b75 <_panic>
+		panic("file_open /not-found succeeded!");
+  80197f:	83 ec 04             	sub    $0x4,%esp
+  801982:	68 24 4e 80 00       	push   $0x804e24
+  801987:	6a 21                	push   $0x21
+  801989:	68 6f 4c 80 00       	push   $0x804c6f
+  80198e:	e8 e2 01 00 00       	call   801b75 <_panic>
+		panic("file_open /newmotd: %e", r);
+  801993:	50                   	push   %eax
+  801994:	68 e6 4c 80 00       	push   $0x804ce6
+  801999:	6a 23                	push   $0x23
+  80199b:	68 6f 4c 80 00       	push   $0x804c6f
+  8019a0:	e8 d0 01 00 00       	call   801b75 <_panic>
+		panic("file_get_block: %e", r);
+  8019a5:	50                   	push   %eax
+  8019a6:	68 10 4d 80 00       	push   $0x804d10
+  8019ab:	6a 27                	push   $0x27
+  8019ad:	68 6f 4c 80 00       	push   $0x804c6f
+  8019b2:	e8 be 01 00 00       	call   801b75 <_panic>
+		panic("file_get_block returned wrong data");
+  8019b7:	83 ec 04             	sub    $0x4,%esp
+  8019ba:	68 6c 4e 80 00       	push   $0x804e6c
+  8019bf:	6a 29                	push   $0x29
+  8019c1:	68 6f 4c 80 00       	push   $0x804c6f
+  8019c6:	e8 aa 01 00 00       	call   801b75 <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  8019cb:	68 3c 4d 80 00       	push   $0x804d3c
+  8019d0:	68 bd 48 80 00       	push   $0x8048bd
+  8019d5:	6a 2d                	push   $0x2d
+  8019d7:	68 6f 4c 80 00       	push   $0x804c6f
+  8019dc:	e8 94 01 00 00       	call   801b75 <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  8019e1:	68 3b 4d 80 00       	push   $0x804d3b
+  8019e6:	68 bd 48 80 00       	push   $0x8048bd
+  8019eb:	6a 2f                	push   $0x2f
+  8019ed:	68 6f 4c 80 00       	push   $0x804c6f
+  8019f2:	e8 7e 01 00 00       	call   801b75 <_panic>
+		panic("file_set_size: %e", r);
+  8019f7:	50                   	push   %eax
+  8019f8:	68 6b 4d 80 00       	push   $0x804d6b
+  8019fd:	6a 33                	push   $0x33
+  8019ff:	68 6f 4c 80 00       	push   $0x804c6f
+  801a04:	e8 6c 01 00 00       	call   801b75 <_panic>
+	assert(f->f_direct[0] == 0);
+  801a09:	68 7d 4d 80 00       	push   $0x804d7d
+  801a0e:	68 bd 48 80 00       	push   $0x8048bd
+  801a13:	6a 34                	push   $0x34
+  801a15:	68 6f 4c 80 00       	push   $0x804c6f
+  801a1a:	e8 56 01 00 00       	call   801b75 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801a1f:	68 91 4d 80 00       	push   $0x804d91
+  801a24:	68 bd 48 80 00       	push   $0x8048bd
+  801a29:	6a 35                	push   $0x35
+  801a2b:	68 6f 4c 80 00       	push   $0x804c6f
+  801a30:	e8 40 01 00 00       	call   801b75 <_panic>
+		panic("file_set_size 2: %e", r);
+  801a35:	50                   	push   %eax
+  801a36:	68 c2 4d 80 00       	push   $0x804dc2
+  801a3b:	6a 39                	push   $0x39
+  801a3d:	68 6f 4c 80 00       	push   $0x804c6f
+  801a42:	e8 2e 01 00 00       	call   801b75 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801a47:	68 91 4d 80 00       	push   $0x804d91
+  801a4c:	68 bd 48 80 00       	push   $0x8048bd
+  801a51:	6a 3a                	push   $0x3a
+  801a53:	68 6f 4c 80 00       	push   $0x804c6f
+  801a58:	e8 18 01 00 00       	call   801b75 <_panic>
+		panic("file_get_block 2: %e", r);
+  801a5d:	50                   	push   %eax
+  801a5e:	68 d6 4d 80 00       	push   $0x804dd6
+  801a63:	6a 3c                	push   $0x3c
+  801a65:	68 6f 4c 80 00       	push   $0x804c6f
+  801a6a:	e8 06 01 00 00       	call   801b75 <_panic>
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  801a6f:	68 3c 4d 80 00       	push   $0x804d3c
+  801a74:	68 bd 48 80 00       	push   $0x8048bd
+  801a79:	6a 3e                	push   $0x3e
+  801a7b:	68 6f 4c 80 00       	push   $0x804c6f
+  801a80:	e8 f0 00 00 00       	call   801b75 <_panic>
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  801a85:	68 3b 4d 80 00       	push   $0x804d3b
+  801a8a:	68 bd 48 80 00       	push   $0x8048bd
+  801a8f:	6a 40                	push   $0x40
+  801a91:	68 6f 4c 80 00       	push   $0x804c6f
+  801a96:	e8 da 00 00 00       	call   801b75 <_panic>
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  801a9b:	68 91 4d 80 00       	push   $0x804d91
+  801aa0:	68 bd 48 80 00       	push   $0x8048bd
+  801aa5:	6a 41                	push   $0x41
+  801aa7:	68 6f 4c 80 00       	push   $0x804c6f
+  801aac:	e8 c4 00 00 00       	call   801b75 <_panic>
+
+00801ab1 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  801ab1:	55                   	push   %ebp
+  801ab2:	89 e5                	mov    %esp,%ebp
+  801ab4:	57                   	push   %edi
+  801ab5:	56                   	push   %esi
+  801ab6:	53                   	push   %ebx
+  801ab7:	83 ec 0c             	sub    $0xc,%esp
+  801aba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801abd:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  801ac0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ac5:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  801ac7:	c1 ea 0b             	shr    $0xb,%edx
+  801aca:	83 f2 01             	xor    $0x1,%edx
+  801acd:	83 e2 01             	and    $0x1,%edx
+  801ad0:	88 15 14 b0 80 00    	mov    %dl,0x80b014
+
+	mainenv = NULL;
+  801ad6:	c7 05 10 b0 80 00 00 	movl   $0x0,0x80b010
+  801add:	00 00 00 
+	envid = sys_getenvid();
+  801ae0:	e8 1f 0c 00 00       	call   802704 <sys_getenvid>
+  801ae5:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  801ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  801aec:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801af2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801af8:	8b 52 48             	mov    0x48(%edx),%edx
+  801afb:	39 ca                	cmp    %ecx,%edx
+  801afd:	74 27                	je     801b26 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  801aff:	83 c0 01             	add    $0x1,%eax
+  801b02:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801b07:	75 e3                	jne    801aec <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  801b09:	83 3d 10 b0 80 00 00 	cmpl   $0x0,0x80b010
+  801b10:	75 24                	jne    801b36 <libmain+0x85>
+		panic("libmain can't find the environment");
+  801b12:	83 ec 04             	sub    $0x4,%esp
+  801b15:	68 90 4e 80 00       	push   $0x804e90
+  801b1a:	6a 23                	push   $0x23
+  801b1c:	68 b3 4e 80 00       	push   $0x804eb3
+  801b21:	e8 4f 00 00 00       	call   801b75 <_panic>
+			mainenv = &envs[i];
+  801b26:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b2c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b31:	a3 10 b0 80 00       	mov    %eax,0x80b010
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  801b36:	85 ff                	test   %edi,%edi
+  801b38:	7e 07                	jle    801b41 <libmain+0x90>
+		binaryname = argv[0];
+  801b3a:	8b 06                	mov    (%esi),%eax
+  801b3c:	a3 60 a0 80 00       	mov    %eax,0x80a060
+
+	// call user main routine
+	umain(argc, argv);
+  801b41:	83 ec 08             	sub    $0x8,%esp
+  801b44:	56                   	push   %esi
+  801b45:	57                   	push   %edi
+  801b46:	e8 17 fb ff ff       	call   801662 <umain>
+
+	// exit gracefully
+	exit();
+  801b4b:	e8 0b 00 00 00       	call   801b5b <exit>
+}
+  801b50:	83 c4 10             	add    $0x10,%esp
+  801b53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b56:	5b                   	pop    %ebx
+  801b57:	5e                   	pop    %esi
+  801b58:	5f                   	pop    %edi
+  801b59:	5d                   	pop    %ebp
+  801b5a:	c3                   	ret
+
+00801b5b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  801b5b:	55                   	push   %ebp
+  801b5c:	89 e5                	mov    %esp,%ebp
+  801b5e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  801b61:	e8 c5 1c 00 00       	call   80382b <close_all>
+	sys_env_destroy(0);
+  801b66:	83 ec 0c             	sub    $0xc,%esp
+  801b69:	6a 00                	push   $0x0
+  801b6b:	e8 2b 0b 00 00       	call   80269b <sys_env_destroy>
+}
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	c9                   	leave
+  801b74:	c3                   	ret
+
+00801b75 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	56                   	push   %esi
+  801b79:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  801b7a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801b7d:	8b 35 60 a0 80 00    	mov    0x80a060,%esi
+  801b83:	e8 7c 0b 00 00       	call   802704 <sys_getenvid>
+  801b88:	83 ec 0c             	sub    $0xc,%esp
+  801b8b:	ff 75 0c             	push   0xc(%ebp)
+  801b8e:	ff 75 08             	push   0x8(%ebp)
+  801b91:	56                   	push   %esi
+  801b92:	50                   	push   %eax
+  801b93:	68 cc 4e 80 00       	push   $0x804ecc
+  801b98:	e8 b3 00 00 00       	call   801c50 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  801b9d:	83 c4 18             	add    $0x18,%esp
+  801ba0:	53                   	push   %ebx
+  801ba1:	ff 75 10             	push   0x10(%ebp)
+  801ba4:	e8 56 00 00 00       	call   801bff <vcprintf>
+	cprintf("\n");
+  801ba9:	c7 04 24 68 4a 80 00 	movl   $0x804a68,(%esp)
+  801bb0:	e8 9b 00 00 00       	call   801c50 <cprintf>
+  801bb5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801bb8:	cc                   	int3
+	while (1)
+  801bb9:	eb fd                	jmp    801bb8 <_panic+0x43>
+
+00801bbb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  801bbb:	55                   	push   %ebp
+  801bbc:	89 e5                	mov    %esp,%ebp
+  801bbe:	53                   	push   %ebx
+  801bbf:	83 ec 04             	sub    $0x4,%esp
+  801bc2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  801bc5:	8b 13                	mov    (%ebx),%edx
+  801bc7:	8d 42 01             	lea    0x1(%edx),%eax
+  801bca:	89 03                	mov    %eax,(%ebx)
+  801bcc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bcf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  801bd3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801bd8:	74 09                	je     801be3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  801bda:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  801bde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be1:	c9                   	leave
+  801be2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  801be3:	83 ec 08             	sub    $0x8,%esp
+  801be6:	68 ff 00 00 00       	push   $0xff
+  801beb:	8d 43 08             	lea    0x8(%ebx),%eax
+  801bee:	50                   	push   %eax
+  801bef:	e8 1d 0a 00 00       	call   802611 <sys_cputs>
+		b->idx = 0;
+  801bf4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801bfa:	83 c4 10             	add    $0x10,%esp
+  801bfd:	eb db                	jmp    801bda <putch+0x1f>
+
+00801bff <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+  801c02:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  801c08:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801c0f:	00 00 00 
+	b.cnt = 0;
+  801c12:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  801c19:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  801c1c:	ff 75 0c             	push   0xc(%ebp)
+  801c1f:	ff 75 08             	push   0x8(%ebp)
+  801c22:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  801c28:	50                   	push   %eax
+  801c29:	68 bb 1b 80 00       	push   $0x801bbb
+  801c2e:	e8 fb 00 00 00       	call   801d2e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  801c33:	83 c4 08             	add    $0x8,%esp
+  801c36:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  801c3c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  801c42:	50                   	push   %eax
+  801c43:	e8 c9 09 00 00       	call   802611 <sys_cputs>
+
+	return b.cnt;
+}
+  801c48:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  801c4e:	c9                   	leave
+  801c4f:	c3                   	ret
+
+00801c50 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  801c50:	55                   	push   %ebp
+  801c51:	89 e5                	mov    %esp,%ebp
+  801c53:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801c56:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  801c59:	50                   	push   %eax
+  801c5a:	ff 75 08             	push   0x8(%ebp)
+  801c5d:	e8 9d ff ff ff       	call   801bff <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801c62:	c9                   	leave
+  801c63:	c3                   	ret
+
+00801c64 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	57                   	push   %edi
+  801c68:	56                   	push   %esi
+  801c69:	53                   	push   %ebx
+  801c6a:	83 ec 1c             	sub    $0x1c,%esp
+  801c6d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c70:	89 d6                	mov    %edx,%esi
+  801c72:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801c75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801c78:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  801c7b:	73 0b                	jae    801c88 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  801c7d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c80:	c1 e7 08             	shl    $0x8,%edi
+  801c83:	0b 7d 10             	or     0x10(%ebp),%edi
+  801c86:	eb 36                	jmp    801cbe <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  801c88:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c90:	f7 75 08             	divl   0x8(%ebp)
+  801c93:	89 c1                	mov    %eax,%ecx
+  801c95:	ff 75 14             	push   0x14(%ebp)
+  801c98:	ff 75 10             	push   0x10(%ebp)
+  801c9b:	83 eb 01             	sub    $0x1,%ebx
+  801c9e:	53                   	push   %ebx
+  801c9f:	ff 75 08             	push   0x8(%ebp)
+  801ca2:	89 f2                	mov    %esi,%edx
+  801ca4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ca7:	e8 b8 ff ff ff       	call   801c64 <printnum>
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	eb 14                	jmp    801cc5 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  801cb1:	83 ec 08             	sub    $0x8,%esp
+  801cb4:	56                   	push   %esi
+  801cb5:	57                   	push   %edi
+  801cb6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801cb9:	ff d0                	call   *%eax
+  801cbb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  801cbe:	83 eb 01             	sub    $0x1,%ebx
+  801cc1:	85 db                	test   %ebx,%ebx
+  801cc3:	7f ec                	jg     801cb1 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  801cc5:	83 ec 08             	sub    $0x8,%esp
+  801cc8:	56                   	push   %esi
+  801cc9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd1:	f7 75 08             	divl   0x8(%ebp)
+  801cd4:	0f be 92 ef 4e 80 00 	movsbl 0x804eef(%edx),%edx
+  801cdb:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cde:	c1 e0 08             	shl    $0x8,%eax
+  801ce1:	09 d0                	or     %edx,%eax
+  801ce3:	50                   	push   %eax
+  801ce4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ce7:	ff d0                	call   *%eax
+}
+  801ce9:	83 c4 10             	add    $0x10,%esp
+  801cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cef:	5b                   	pop    %ebx
+  801cf0:	5e                   	pop    %esi
+  801cf1:	5f                   	pop    %edi
+  801cf2:	5d                   	pop    %ebp
+  801cf3:	c3                   	ret
+
+00801cf4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801cf4:	55                   	push   %ebp
+  801cf5:	89 e5                	mov    %esp,%ebp
+  801cf7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  801cfa:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  801cfe:	8b 10                	mov    (%eax),%edx
+  801d00:	3b 50 04             	cmp    0x4(%eax),%edx
+  801d03:	73 0a                	jae    801d0f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  801d05:	8d 4a 01             	lea    0x1(%edx),%ecx
+  801d08:	89 08                	mov    %ecx,(%eax)
+  801d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d0d:	88 02                	mov    %al,(%edx)
+}
+  801d0f:	5d                   	pop    %ebp
+  801d10:	c3                   	ret
+
+00801d11 <printfmt>:
+{
+  801d11:	55                   	push   %ebp
+  801d12:	89 e5                	mov    %esp,%ebp
+  801d14:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  801d17:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  801d1a:	50                   	push   %eax
+  801d1b:	ff 75 10             	push   0x10(%ebp)
+  801d1e:	ff 75 0c             	push   0xc(%ebp)
+  801d21:	ff 75 08             	push   0x8(%ebp)
+  801d24:	e8 05 00 00 00       	call   801d2e <vprintfmt>
+}
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	c9                   	leave
+  801d2d:	c3                   	ret
+
+00801d2e <vprintfmt>:
+{
+  801d2e:	55                   	push   %ebp
+  801d2f:	89 e5                	mov    %esp,%ebp
+  801d31:	57                   	push   %edi
+  801d32:	56                   	push   %esi
+  801d33:	53                   	push   %ebx
+  801d34:	83 ec 3c             	sub    $0x3c,%esp
+  801d37:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d3a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  801d3d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801d44:	eb 16                	jmp    801d5c <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  801d46:	83 ec 08             	sub    $0x8,%esp
+  801d49:	ff 75 0c             	push   0xc(%ebp)
+  801d4c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d4f:	c1 e2 08             	shl    $0x8,%edx
+  801d52:	09 d0                	or     %edx,%eax
+  801d54:	50                   	push   %eax
+  801d55:	ff d7                	call   *%edi
+  801d57:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801d5a:	89 de                	mov    %ebx,%esi
+  801d5c:	8d 5e 01             	lea    0x1(%esi),%ebx
+  801d5f:	0f b6 06             	movzbl (%esi),%eax
+  801d62:	83 f8 25             	cmp    $0x25,%eax
+  801d65:	74 0c                	je     801d73 <vprintfmt+0x45>
+			if (ch == '\0')
+  801d67:	85 c0                	test   %eax,%eax
+  801d69:	75 db                	jne    801d46 <vprintfmt+0x18>
+}
+  801d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d6e:	5b                   	pop    %ebx
+  801d6f:	5e                   	pop    %esi
+  801d70:	5f                   	pop    %edi
+  801d71:	5d                   	pop    %ebp
+  801d72:	c3                   	ret
+		padc = ' ';
+  801d73:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  801d77:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  801d7e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  801d85:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  801d8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801d91:	8d 73 01             	lea    0x1(%ebx),%esi
+  801d94:	0f b6 13             	movzbl (%ebx),%edx
+  801d97:	8d 42 dd             	lea    -0x23(%edx),%eax
+  801d9a:	3c 55                	cmp    $0x55,%al
+  801d9c:	0f 87 2c 04 00 00    	ja     8021ce <vprintfmt+0x4a0>
+  801da2:	0f b6 c0             	movzbl %al,%eax
+  801da5:	ff 24 85 40 50 80 00 	jmp    *0x805040(,%eax,4)
+  801dac:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  801dae:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  801db2:	eb dd                	jmp    801d91 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  801db4:	89 f3                	mov    %esi,%ebx
+  801db6:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  801dba:	eb d5                	jmp    801d91 <vprintfmt+0x63>
+  801dbc:	0f b6 d2             	movzbl %dl,%edx
+  801dbf:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  801dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  801dc6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801dc9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  801dcd:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  801dd0:	8d 72 d0             	lea    -0x30(%edx),%esi
+  801dd3:	83 fe 09             	cmp    $0x9,%esi
+  801dd6:	0f 87 8a 00 00 00    	ja     801e66 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  801ddc:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  801ddf:	eb e5                	jmp    801dc6 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  801de1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801de4:	8b 00                	mov    (%eax),%eax
+  801de6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801de9:	8b 45 14             	mov    0x14(%ebp),%eax
+  801dec:	8d 40 04             	lea    0x4(%eax),%eax
+  801def:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801df2:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  801df4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801df8:	79 97                	jns    801d91 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  801dfa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801dfd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801e00:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  801e07:	eb 88                	jmp    801d91 <vprintfmt+0x63>
+			if (width < 0)
+  801e09:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801e0c:	85 db                	test   %ebx,%ebx
+  801e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e13:	0f 49 c3             	cmovns %ebx,%eax
+  801e16:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  801e19:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  801e1b:	e9 71 ff ff ff       	jmp    801d91 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  801e20:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  801e22:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  801e29:	e9 63 ff ff ff       	jmp    801d91 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  801e2e:	8d 73 02             	lea    0x2(%ebx),%esi
+  801e31:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  801e35:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  801e3c:	3c 67                	cmp    $0x67,%al
+  801e3e:	0f 84 18 ff ff ff    	je     801d5c <vprintfmt+0x2e>
+					attrib = 0x04;
+  801e44:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  801e4b:	3c 72                	cmp    $0x72,%al
+  801e4d:	0f 84 09 ff ff ff    	je     801d5c <vprintfmt+0x2e>
+					attrib = 0x00;
+  801e53:	3c 62                	cmp    $0x62,%al
+  801e55:	0f 94 c0             	sete   %al
+  801e58:	0f b6 c0             	movzbl %al,%eax
+  801e5b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801e5e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e61:	e9 f6 fe ff ff       	jmp    801d5c <vprintfmt+0x2e>
+  801e66:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801e69:	eb 89                	jmp    801df4 <vprintfmt+0xc6>
+			lflag++;
+  801e6b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  801e6e:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  801e70:	e9 1c ff ff ff       	jmp    801d91 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  801e75:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e78:	8d 58 04             	lea    0x4(%eax),%ebx
+  801e7b:	83 ec 08             	sub    $0x8,%esp
+  801e7e:	ff 75 0c             	push   0xc(%ebp)
+  801e81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e84:	c1 e0 08             	shl    $0x8,%eax
+  801e87:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  801e8a:	0b 01                	or     (%ecx),%eax
+  801e8c:	50                   	push   %eax
+  801e8d:	ff d7                	call   *%edi
+			break;
+  801e8f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  801e92:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  801e95:	e9 c2 fe ff ff       	jmp    801d5c <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  801e9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e9d:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  801ea0:	8b 10                	mov    (%eax),%edx
+  801ea2:	89 d0                	mov    %edx,%eax
+  801ea4:	f7 d8                	neg    %eax
+  801ea6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801ea9:	83 f8 12             	cmp    $0x12,%eax
+  801eac:	7f 25                	jg     801ed3 <vprintfmt+0x1a5>
+  801eae:	8b 14 85 a0 51 80 00 	mov    0x8051a0(,%eax,4),%edx
+  801eb5:	85 d2                	test   %edx,%edx
+  801eb7:	74 1a                	je     801ed3 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  801eb9:	52                   	push   %edx
+  801eba:	68 cf 48 80 00       	push   $0x8048cf
+  801ebf:	ff 75 0c             	push   0xc(%ebp)
+  801ec2:	57                   	push   %edi
+  801ec3:	e8 49 fe ff ff       	call   801d11 <printfmt>
+  801ec8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ecb:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  801ece:	e9 89 fe ff ff       	jmp    801d5c <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  801ed3:	50                   	push   %eax
+  801ed4:	68 07 4f 80 00       	push   $0x804f07
+  801ed9:	ff 75 0c             	push   0xc(%ebp)
+  801edc:	57                   	push   %edi
+  801edd:	e8 2f fe ff ff       	call   801d11 <printfmt>
+  801ee2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  801ee5:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  801ee8:	e9 6f fe ff ff       	jmp    801d5c <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801eed:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ef0:	83 c0 04             	add    $0x4,%eax
+  801ef3:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  801ef6:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ef9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  801efb:	85 c9                	test   %ecx,%ecx
+  801efd:	b8 00 4f 80 00       	mov    $0x804f00,%eax
+  801f02:	0f 45 c1             	cmovne %ecx,%eax
+  801f05:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  801f08:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  801f0c:	7e 06                	jle    801f14 <vprintfmt+0x1e6>
+  801f0e:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  801f12:	75 1a                	jne    801f2e <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  801f14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f17:	c1 e0 08             	shl    $0x8,%eax
+  801f1a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  801f1d:	83 c8 3f             	or     $0x3f,%eax
+  801f20:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801f23:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  801f26:	89 75 10             	mov    %esi,0x10(%ebp)
+  801f29:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  801f2c:	eb 6d                	jmp    801f9b <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f2e:	83 ec 08             	sub    $0x8,%esp
+  801f31:	ff 75 d0             	push   -0x30(%ebp)
+  801f34:	ff 75 c8             	push   -0x38(%ebp)
+  801f37:	e8 39 03 00 00       	call   802275 <strnlen>
+  801f3c:	89 c2                	mov    %eax,%edx
+  801f3e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f41:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  801f43:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f46:	c1 e1 08             	shl    $0x8,%ecx
+  801f49:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  801f4d:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f4f:	83 c4 10             	add    $0x10,%esp
+  801f52:	89 c3                	mov    %eax,%ebx
+  801f54:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f57:	89 75 10             	mov    %esi,0x10(%ebp)
+  801f5a:	89 ce                	mov    %ecx,%esi
+  801f5c:	eb 0f                	jmp    801f6d <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  801f5e:	83 ec 08             	sub    $0x8,%esp
+  801f61:	ff 75 0c             	push   0xc(%ebp)
+  801f64:	56                   	push   %esi
+  801f65:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801f67:	83 eb 01             	sub    $0x1,%ebx
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	85 db                	test   %ebx,%ebx
+  801f6f:	7f ed                	jg     801f5e <vprintfmt+0x230>
+  801f71:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f74:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f77:	85 c0                	test   %eax,%eax
+  801f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7e:	0f 49 d0             	cmovns %eax,%edx
+  801f81:	29 d0                	sub    %edx,%eax
+  801f83:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801f86:	eb 8c                	jmp    801f14 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  801f88:	83 ec 08             	sub    $0x8,%esp
+  801f8b:	ff 75 0c             	push   0xc(%ebp)
+  801f8e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f91:	09 c2                	or     %eax,%edx
+  801f93:	52                   	push   %edx
+  801f94:	ff d7                	call   *%edi
+  801f96:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801f99:	89 d9                	mov    %ebx,%ecx
+  801f9b:	8d 59 01             	lea    0x1(%ecx),%ebx
+  801f9e:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  801fa2:	0f be d0             	movsbl %al,%edx
+  801fa5:	85 d2                	test   %edx,%edx
+  801fa7:	74 2a                	je     801fd3 <vprintfmt+0x2a5>
+  801fa9:	85 f6                	test   %esi,%esi
+  801fab:	78 05                	js     801fb2 <vprintfmt+0x284>
+  801fad:	83 ee 01             	sub    $0x1,%esi
+  801fb0:	78 3b                	js     801fed <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801fb2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  801fb6:	74 d0                	je     801f88 <vprintfmt+0x25a>
+  801fb8:	0f be c0             	movsbl %al,%eax
+  801fbb:	83 e8 20             	sub    $0x20,%eax
+  801fbe:	83 f8 5e             	cmp    $0x5e,%eax
+  801fc1:	76 c5                	jbe    801f88 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  801fc3:	83 ec 08             	sub    $0x8,%esp
+  801fc6:	ff 75 0c             	push   0xc(%ebp)
+  801fc9:	ff 75 cc             	push   -0x34(%ebp)
+  801fcc:	ff d7                	call   *%edi
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	eb c6                	jmp    801f99 <vprintfmt+0x26b>
+  801fd3:	8b 75 10             	mov    0x10(%ebp),%esi
+  801fd6:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801fd9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fdc:	01 c3                	add    %eax,%ebx
+  801fde:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  801fe0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fe3:	83 c8 20             	or     $0x20,%eax
+  801fe6:	89 75 10             	mov    %esi,0x10(%ebp)
+  801fe9:	89 c6                	mov    %eax,%esi
+  801feb:	eb 14                	jmp    802001 <vprintfmt+0x2d3>
+  801fed:	8b 75 10             	mov    0x10(%ebp),%esi
+  801ff0:	eb e4                	jmp    801fd6 <vprintfmt+0x2a8>
+  801ff2:	83 ec 08             	sub    $0x8,%esp
+  801ff5:	ff 75 0c             	push   0xc(%ebp)
+  801ff8:	56                   	push   %esi
+  801ff9:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  801ffb:	83 eb 01             	sub    $0x1,%ebx
+  801ffe:	83 c4 10             	add    $0x10,%esp
+  802001:	85 db                	test   %ebx,%ebx
+  802003:	7f ed                	jg     801ff2 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802005:	8b 75 10             	mov    0x10(%ebp),%esi
+  802008:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80200b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80200e:	e9 49 fd ff ff       	jmp    801d5c <vprintfmt+0x2e>
+	if (lflag >= 2)
+  802013:	83 f9 01             	cmp    $0x1,%ecx
+  802016:	7f 1f                	jg     802037 <vprintfmt+0x309>
+	else if (lflag)
+  802018:	85 c9                	test   %ecx,%ecx
+  80201a:	74 69                	je     802085 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80201c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80201f:	8b 00                	mov    (%eax),%eax
+  802021:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802024:	89 c1                	mov    %eax,%ecx
+  802026:	c1 f9 1f             	sar    $0x1f,%ecx
+  802029:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80202c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80202f:	8d 40 04             	lea    0x4(%eax),%eax
+  802032:	89 45 14             	mov    %eax,0x14(%ebp)
+  802035:	eb 17                	jmp    80204e <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  802037:	8b 45 14             	mov    0x14(%ebp),%eax
+  80203a:	8b 50 04             	mov    0x4(%eax),%edx
+  80203d:	8b 00                	mov    (%eax),%eax
+  80203f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802042:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802045:	8b 45 14             	mov    0x14(%ebp),%eax
+  802048:	8d 40 08             	lea    0x8(%eax),%eax
+  80204b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80204e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802051:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  802054:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  802059:	85 db                	test   %ebx,%ebx
+  80205b:	0f 89 f6 00 00 00    	jns    802157 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  802061:	83 ec 08             	sub    $0x8,%esp
+  802064:	ff 75 0c             	push   0xc(%ebp)
+  802067:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80206a:	c1 e0 08             	shl    $0x8,%eax
+  80206d:	83 c8 2d             	or     $0x2d,%eax
+  802070:	50                   	push   %eax
+  802071:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802073:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802076:	f7 d9                	neg    %ecx
+  802078:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80207b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802080:	e9 d2 00 00 00       	jmp    802157 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  802085:	8b 45 14             	mov    0x14(%ebp),%eax
+  802088:	8b 00                	mov    (%eax),%eax
+  80208a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80208d:	89 c1                	mov    %eax,%ecx
+  80208f:	c1 f9 1f             	sar    $0x1f,%ecx
+  802092:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802095:	8b 45 14             	mov    0x14(%ebp),%eax
+  802098:	8d 40 04             	lea    0x4(%eax),%eax
+  80209b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80209e:	eb ae                	jmp    80204e <vprintfmt+0x320>
+	if (lflag >= 2)
+  8020a0:	83 f9 01             	cmp    $0x1,%ecx
+  8020a3:	7f 19                	jg     8020be <vprintfmt+0x390>
+	else if (lflag)
+  8020a5:	85 c9                	test   %ecx,%ecx
+  8020a7:	74 2a                	je     8020d3 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8020a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020ac:	8b 08                	mov    (%eax),%ecx
+  8020ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8020b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8020b9:	e9 99 00 00 00       	jmp    802157 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8020be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020c1:	8b 08                	mov    (%eax),%ecx
+  8020c3:	8d 40 08             	lea    0x8(%eax),%eax
+  8020c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8020ce:	e9 84 00 00 00       	jmp    802157 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8020d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020d6:	8b 08                	mov    (%eax),%ecx
+  8020d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8020db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8020de:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8020e3:	eb 72                	jmp    802157 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8020e5:	83 f9 01             	cmp    $0x1,%ecx
+  8020e8:	7f 16                	jg     802100 <vprintfmt+0x3d2>
+	else if (lflag)
+  8020ea:	85 c9                	test   %ecx,%ecx
+  8020ec:	74 24                	je     802112 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8020ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020f1:	8b 08                	mov    (%eax),%ecx
+  8020f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8020f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8020f9:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8020fe:	eb 57                	jmp    802157 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  802100:	8b 45 14             	mov    0x14(%ebp),%eax
+  802103:	8b 08                	mov    (%eax),%ecx
+  802105:	8d 40 08             	lea    0x8(%eax),%eax
+  802108:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80210b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  802110:	eb 45                	jmp    802157 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  802112:	8b 45 14             	mov    0x14(%ebp),%eax
+  802115:	8b 08                	mov    (%eax),%ecx
+  802117:	8d 40 04             	lea    0x4(%eax),%eax
+  80211a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80211d:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  802122:	eb 33                	jmp    802157 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  802124:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802127:	c1 e3 08             	shl    $0x8,%ebx
+  80212a:	83 ec 08             	sub    $0x8,%esp
+  80212d:	ff 75 0c             	push   0xc(%ebp)
+  802130:	89 d8                	mov    %ebx,%eax
+  802132:	83 c8 30             	or     $0x30,%eax
+  802135:	50                   	push   %eax
+  802136:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  802138:	83 c4 08             	add    $0x8,%esp
+  80213b:	ff 75 0c             	push   0xc(%ebp)
+  80213e:	83 cb 78             	or     $0x78,%ebx
+  802141:	53                   	push   %ebx
+  802142:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802144:	8b 45 14             	mov    0x14(%ebp),%eax
+  802147:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  802149:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80214c:	8d 40 04             	lea    0x4(%eax),%eax
+  80214f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802152:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  802157:	ff 75 e4             	push   -0x1c(%ebp)
+  80215a:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80215e:	52                   	push   %edx
+  80215f:	ff 75 e0             	push   -0x20(%ebp)
+  802162:	50                   	push   %eax
+  802163:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802166:	89 f8                	mov    %edi,%eax
+  802168:	e8 f7 fa ff ff       	call   801c64 <printnum>
+			break;
+  80216d:	83 c4 10             	add    $0x10,%esp
+  802170:	e9 e7 fb ff ff       	jmp    801d5c <vprintfmt+0x2e>
+	if (lflag >= 2)
+  802175:	83 f9 01             	cmp    $0x1,%ecx
+  802178:	7f 16                	jg     802190 <vprintfmt+0x462>
+	else if (lflag)
+  80217a:	85 c9                	test   %ecx,%ecx
+  80217c:	74 24                	je     8021a2 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80217e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802181:	8b 08                	mov    (%eax),%ecx
+  802183:	8d 40 04             	lea    0x4(%eax),%eax
+  802186:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802189:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80218e:	eb c7                	jmp    802157 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  802190:	8b 45 14             	mov    0x14(%ebp),%eax
+  802193:	8b 08                	mov    (%eax),%ecx
+  802195:	8d 40 08             	lea    0x8(%eax),%eax
+  802198:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80219b:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8021a0:	eb b5                	jmp    802157 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8021a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021a5:	8b 08                	mov    (%eax),%ecx
+  8021a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8021aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8021ad:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8021b2:	eb a3                	jmp    802157 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8021b4:	83 ec 08             	sub    $0x8,%esp
+  8021b7:	ff 75 0c             	push   0xc(%ebp)
+  8021ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021bd:	c1 e0 08             	shl    $0x8,%eax
+  8021c0:	83 c8 25             	or     $0x25,%eax
+  8021c3:	50                   	push   %eax
+  8021c4:	ff d7                	call   *%edi
+			break;
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  8021c9:	e9 8e fb ff ff       	jmp    801d5c <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8021ce:	83 ec 08             	sub    $0x8,%esp
+  8021d1:	ff 75 0c             	push   0xc(%ebp)
+  8021d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021d7:	c1 e0 08             	shl    $0x8,%eax
+  8021da:	83 c8 25             	or     $0x25,%eax
+  8021dd:	50                   	push   %eax
+  8021de:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8021e0:	83 c4 10             	add    $0x10,%esp
+  8021e3:	89 de                	mov    %ebx,%esi
+  8021e5:	eb 03                	jmp    8021ea <vprintfmt+0x4bc>
+  8021e7:	83 ee 01             	sub    $0x1,%esi
+  8021ea:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8021ee:	75 f7                	jne    8021e7 <vprintfmt+0x4b9>
+  8021f0:	e9 67 fb ff ff       	jmp    801d5c <vprintfmt+0x2e>
+
+008021f5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8021f5:	55                   	push   %ebp
+  8021f6:	89 e5                	mov    %esp,%ebp
+  8021f8:	83 ec 18             	sub    $0x18,%esp
+  8021fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  802201:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802204:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802208:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80220b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  802212:	85 c0                	test   %eax,%eax
+  802214:	74 26                	je     80223c <vsnprintf+0x47>
+  802216:	85 d2                	test   %edx,%edx
+  802218:	7e 22                	jle    80223c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80221a:	ff 75 14             	push   0x14(%ebp)
+  80221d:	ff 75 10             	push   0x10(%ebp)
+  802220:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802223:	50                   	push   %eax
+  802224:	68 f4 1c 80 00       	push   $0x801cf4
+  802229:	e8 00 fb ff ff       	call   801d2e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80222e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802231:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  802234:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802237:	83 c4 10             	add    $0x10,%esp
+}
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+		return -E_INVAL;
+  80223c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802241:	eb f7                	jmp    80223a <vsnprintf+0x45>
+
+00802243 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802243:	55                   	push   %ebp
+  802244:	89 e5                	mov    %esp,%ebp
+  802246:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  802249:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80224c:	50                   	push   %eax
+  80224d:	ff 75 10             	push   0x10(%ebp)
+  802250:	ff 75 0c             	push   0xc(%ebp)
+  802253:	ff 75 08             	push   0x8(%ebp)
+  802256:	e8 9a ff ff ff       	call   8021f5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80225b:	c9                   	leave
+  80225c:	c3                   	ret
+
+0080225d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802263:	b8 00 00 00 00       	mov    $0x0,%eax
+  802268:	eb 03                	jmp    80226d <strlen+0x10>
+		n++;
+  80226a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80226d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802271:	75 f7                	jne    80226a <strlen+0xd>
+	return n;
+}
+  802273:	5d                   	pop    %ebp
+  802274:	c3                   	ret
+
+00802275 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802275:	55                   	push   %ebp
+  802276:	89 e5                	mov    %esp,%ebp
+  802278:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80227b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80227e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802283:	eb 03                	jmp    802288 <strnlen+0x13>
+		n++;
+  802285:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802288:	39 d0                	cmp    %edx,%eax
+  80228a:	74 08                	je     802294 <strnlen+0x1f>
+  80228c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802290:	75 f3                	jne    802285 <strnlen+0x10>
+  802292:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  802294:	89 d0                	mov    %edx,%eax
+  802296:	5d                   	pop    %ebp
+  802297:	c3                   	ret
+
+00802298 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802298:	55                   	push   %ebp
+  802299:	89 e5                	mov    %esp,%ebp
+  80229b:	53                   	push   %ebx
+  80229c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80229f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8022a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8022ab:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8022ae:	83 c0 01             	add    $0x1,%eax
+  8022b1:	84 d2                	test   %dl,%dl
+  8022b3:	75 f2                	jne    8022a7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8022b5:	89 c8                	mov    %ecx,%eax
+  8022b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ba:	c9                   	leave
+  8022bb:	c3                   	ret
+
+008022bc <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8022bc:	55                   	push   %ebp
+  8022bd:	89 e5                	mov    %esp,%ebp
+  8022bf:	53                   	push   %ebx
+  8022c0:	83 ec 10             	sub    $0x10,%esp
+  8022c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8022c6:	53                   	push   %ebx
+  8022c7:	e8 91 ff ff ff       	call   80225d <strlen>
+  8022cc:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8022cf:	ff 75 0c             	push   0xc(%ebp)
+  8022d2:	01 d8                	add    %ebx,%eax
+  8022d4:	50                   	push   %eax
+  8022d5:	e8 be ff ff ff       	call   802298 <strcpy>
+	return dst;
+}
+  8022da:	89 d8                	mov    %ebx,%eax
+  8022dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022df:	c9                   	leave
+  8022e0:	c3                   	ret
+
+008022e1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022e1:	55                   	push   %ebp
+  8022e2:	89 e5                	mov    %esp,%ebp
+  8022e4:	56                   	push   %esi
+  8022e5:	53                   	push   %ebx
+  8022e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8022ec:	89 f3                	mov    %esi,%ebx
+  8022ee:	03 5d 10             	add    0x10(%ebp),%ebx
+  8022f1:	89 f0                	mov    %esi,%eax
+  8022f3:	eb 0f                	jmp    802304 <strncpy+0x23>
+		*dst++ = *src;
+  8022f5:	83 c0 01             	add    $0x1,%eax
+  8022f8:	0f b6 0a             	movzbl (%edx),%ecx
+  8022fb:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8022fe:	80 f9 01             	cmp    $0x1,%cl
+  802301:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  802304:	39 d8                	cmp    %ebx,%eax
+  802306:	75 ed                	jne    8022f5 <strncpy+0x14>
+	}
+	return ret;
+}
+  802308:	89 f0                	mov    %esi,%eax
+  80230a:	5b                   	pop    %ebx
+  80230b:	5e                   	pop    %esi
+  80230c:	5d                   	pop    %ebp
+  80230d:	c3                   	ret
+
+0080230e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	56                   	push   %esi
+  802312:	53                   	push   %ebx
+  802313:	8b 75 08             	mov    0x8(%ebp),%esi
+  802316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802319:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80231c:	89 f0                	mov    %esi,%eax
+  80231e:	85 d2                	test   %edx,%edx
+  802320:	74 21                	je     802343 <strlcpy+0x35>
+  802322:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  802326:	89 f2                	mov    %esi,%edx
+  802328:	eb 09                	jmp    802333 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80232a:	83 c1 01             	add    $0x1,%ecx
+  80232d:	83 c2 01             	add    $0x1,%edx
+  802330:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  802333:	39 c2                	cmp    %eax,%edx
+  802335:	74 09                	je     802340 <strlcpy+0x32>
+  802337:	0f b6 19             	movzbl (%ecx),%ebx
+  80233a:	84 db                	test   %bl,%bl
+  80233c:	75 ec                	jne    80232a <strlcpy+0x1c>
+  80233e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  802340:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  802343:	29 f0                	sub    %esi,%eax
+}
+  802345:	5b                   	pop    %ebx
+  802346:	5e                   	pop    %esi
+  802347:	5d                   	pop    %ebp
+  802348:	c3                   	ret
+
+00802349 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80234f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  802352:	eb 06                	jmp    80235a <strcmp+0x11>
+		p++, q++;
+  802354:	83 c1 01             	add    $0x1,%ecx
+  802357:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80235a:	0f b6 01             	movzbl (%ecx),%eax
+  80235d:	84 c0                	test   %al,%al
+  80235f:	74 04                	je     802365 <strcmp+0x1c>
+  802361:	3a 02                	cmp    (%edx),%al
+  802363:	74 ef                	je     802354 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802365:	0f b6 c0             	movzbl %al,%eax
+  802368:	0f b6 12             	movzbl (%edx),%edx
+  80236b:	29 d0                	sub    %edx,%eax
+}
+  80236d:	5d                   	pop    %ebp
+  80236e:	c3                   	ret
+
+0080236f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80236f:	55                   	push   %ebp
+  802370:	89 e5                	mov    %esp,%ebp
+  802372:	53                   	push   %ebx
+  802373:	8b 45 08             	mov    0x8(%ebp),%eax
+  802376:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802379:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80237c:	eb 09                	jmp    802387 <strncmp+0x18>
+		n--, p++, q++;
+  80237e:	83 ea 01             	sub    $0x1,%edx
+  802381:	83 c0 01             	add    $0x1,%eax
+  802384:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  802387:	85 d2                	test   %edx,%edx
+  802389:	74 18                	je     8023a3 <strncmp+0x34>
+  80238b:	0f b6 18             	movzbl (%eax),%ebx
+  80238e:	84 db                	test   %bl,%bl
+  802390:	74 04                	je     802396 <strncmp+0x27>
+  802392:	3a 19                	cmp    (%ecx),%bl
+  802394:	74 e8                	je     80237e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802396:	0f b6 00             	movzbl (%eax),%eax
+  802399:	0f b6 11             	movzbl (%ecx),%edx
+  80239c:	29 d0                	sub    %edx,%eax
+}
+  80239e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023a1:	c9                   	leave
+  8023a2:	c3                   	ret
+		return 0;
+  8023a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a8:	eb f4                	jmp    80239e <strncmp+0x2f>
+
+008023aa <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8023aa:	55                   	push   %ebp
+  8023ab:	89 e5                	mov    %esp,%ebp
+  8023ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023b4:	eb 03                	jmp    8023b9 <strchr+0xf>
+  8023b6:	83 c0 01             	add    $0x1,%eax
+  8023b9:	0f b6 10             	movzbl (%eax),%edx
+  8023bc:	84 d2                	test   %dl,%dl
+  8023be:	74 06                	je     8023c6 <strchr+0x1c>
+		if (*s == c)
+  8023c0:	38 ca                	cmp    %cl,%dl
+  8023c2:	75 f2                	jne    8023b6 <strchr+0xc>
+  8023c4:	eb 05                	jmp    8023cb <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8023c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023cb:	5d                   	pop    %ebp
+  8023cc:	c3                   	ret
+
+008023cd <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8023cd:	55                   	push   %ebp
+  8023ce:	89 e5                	mov    %esp,%ebp
+  8023d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8023d7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8023da:	38 ca                	cmp    %cl,%dl
+  8023dc:	74 09                	je     8023e7 <strfind+0x1a>
+  8023de:	84 d2                	test   %dl,%dl
+  8023e0:	74 05                	je     8023e7 <strfind+0x1a>
+	for (; *s; s++)
+  8023e2:	83 c0 01             	add    $0x1,%eax
+  8023e5:	eb f0                	jmp    8023d7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8023e7:	5d                   	pop    %ebp
+  8023e8:	c3                   	ret
+
+008023e9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8023e9:	55                   	push   %ebp
+  8023ea:	89 e5                	mov    %esp,%ebp
+  8023ec:	57                   	push   %edi
+  8023ed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023f0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8023f3:	85 c9                	test   %ecx,%ecx
+  8023f5:	74 20                	je     802417 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8023f7:	89 f8                	mov    %edi,%eax
+  8023f9:	09 c8                	or     %ecx,%eax
+  8023fb:	a8 03                	test   $0x3,%al
+  8023fd:	75 12                	jne    802411 <memset+0x28>
+		c &= 0xFF;
+  8023ff:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802403:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  802409:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80240c:	fc                   	cld
+  80240d:	f3 ab                	rep stos %eax,%es:(%edi)
+  80240f:	eb 06                	jmp    802417 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802411:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802414:	fc                   	cld
+  802415:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  802417:	89 f8                	mov    %edi,%eax
+  802419:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80241c:	c9                   	leave
+  80241d:	c3                   	ret
+
+0080241e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80241e:	55                   	push   %ebp
+  80241f:	89 e5                	mov    %esp,%ebp
+  802421:	57                   	push   %edi
+  802422:	56                   	push   %esi
+  802423:	8b 45 08             	mov    0x8(%ebp),%eax
+  802426:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802429:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80242c:	39 c6                	cmp    %eax,%esi
+  80242e:	73 32                	jae    802462 <memmove+0x44>
+  802430:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  802433:	39 d0                	cmp    %edx,%eax
+  802435:	73 2b                	jae    802462 <memmove+0x44>
+		s += n;
+		d += n;
+  802437:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80243a:	89 d6                	mov    %edx,%esi
+  80243c:	09 fe                	or     %edi,%esi
+  80243e:	09 ce                	or     %ecx,%esi
+  802440:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802446:	75 0e                	jne    802456 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802448:	83 ef 04             	sub    $0x4,%edi
+  80244b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80244e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  802451:	fd                   	std
+  802452:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802454:	eb 09                	jmp    80245f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802456:	83 ef 01             	sub    $0x1,%edi
+  802459:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80245c:	fd                   	std
+  80245d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80245f:	fc                   	cld
+  802460:	eb 1a                	jmp    80247c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802462:	89 f2                	mov    %esi,%edx
+  802464:	09 c2                	or     %eax,%edx
+  802466:	09 ca                	or     %ecx,%edx
+  802468:	f6 c2 03             	test   $0x3,%dl
+  80246b:	75 0a                	jne    802477 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80246d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  802470:	89 c7                	mov    %eax,%edi
+  802472:	fc                   	cld
+  802473:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802475:	eb 05                	jmp    80247c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  802477:	89 c7                	mov    %eax,%edi
+  802479:	fc                   	cld
+  80247a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80247c:	5e                   	pop    %esi
+  80247d:	5f                   	pop    %edi
+  80247e:	5d                   	pop    %ebp
+  80247f:	c3                   	ret
+
+00802480 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802480:	55                   	push   %ebp
+  802481:	89 e5                	mov    %esp,%ebp
+  802483:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  802486:	ff 75 10             	push   0x10(%ebp)
+  802489:	ff 75 0c             	push   0xc(%ebp)
+  80248c:	ff 75 08             	push   0x8(%ebp)
+  80248f:	e8 8a ff ff ff       	call   80241e <memmove>
+}
+  802494:	c9                   	leave
+  802495:	c3                   	ret
+
+00802496 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802496:	55                   	push   %ebp
+  802497:	89 e5                	mov    %esp,%ebp
+  802499:	56                   	push   %esi
+  80249a:	53                   	push   %ebx
+  80249b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8024a1:	89 c6                	mov    %eax,%esi
+  8024a3:	03 75 10             	add    0x10(%ebp),%esi
+  8024a6:	eb 06                	jmp    8024ae <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8024a8:	83 c0 01             	add    $0x1,%eax
+  8024ab:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8024ae:	39 f0                	cmp    %esi,%eax
+  8024b0:	74 14                	je     8024c6 <memcmp+0x30>
+		if (*s1 != *s2)
+  8024b2:	0f b6 08             	movzbl (%eax),%ecx
+  8024b5:	0f b6 1a             	movzbl (%edx),%ebx
+  8024b8:	38 d9                	cmp    %bl,%cl
+  8024ba:	74 ec                	je     8024a8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8024bc:	0f b6 c1             	movzbl %cl,%eax
+  8024bf:	0f b6 db             	movzbl %bl,%ebx
+  8024c2:	29 d8                	sub    %ebx,%eax
+  8024c4:	eb 05                	jmp    8024cb <memcmp+0x35>
+	}
+
+	return 0;
+  8024c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024cb:	5b                   	pop    %ebx
+  8024cc:	5e                   	pop    %esi
+  8024cd:	5d                   	pop    %ebp
+  8024ce:	c3                   	ret
+
+008024cf <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8024cf:	55                   	push   %ebp
+  8024d0:	89 e5                	mov    %esp,%ebp
+  8024d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8024d8:	89 c2                	mov    %eax,%edx
+  8024da:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8024dd:	eb 03                	jmp    8024e2 <memfind+0x13>
+  8024df:	83 c0 01             	add    $0x1,%eax
+  8024e2:	39 d0                	cmp    %edx,%eax
+  8024e4:	73 04                	jae    8024ea <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024e6:	38 08                	cmp    %cl,(%eax)
+  8024e8:	75 f5                	jne    8024df <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8024ea:	5d                   	pop    %ebp
+  8024eb:	c3                   	ret
+
+008024ec <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  8024ec:	55                   	push   %ebp
+  8024ed:	89 e5                	mov    %esp,%ebp
+  8024ef:	57                   	push   %edi
+  8024f0:	56                   	push   %esi
+  8024f1:	53                   	push   %ebx
+  8024f2:	83 ec 1c             	sub    $0x1c,%esp
+  8024f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024f8:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8024fb:	eb 03                	jmp    802500 <strtol+0x14>
+		s++;
+  8024fd:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  802500:	0f b6 06             	movzbl (%esi),%eax
+  802503:	3c 20                	cmp    $0x20,%al
+  802505:	74 f6                	je     8024fd <strtol+0x11>
+  802507:	3c 09                	cmp    $0x9,%al
+  802509:	74 f2                	je     8024fd <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  80250b:	3c 2b                	cmp    $0x2b,%al
+  80250d:	74 43                	je     802552 <strtol+0x66>
+	int neg = 0;
+  80250f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  802514:	3c 2d                	cmp    $0x2d,%al
+  802516:	74 44                	je     80255c <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802518:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  80251e:	75 0f                	jne    80252f <strtol+0x43>
+  802520:	80 3e 30             	cmpb   $0x30,(%esi)
+  802523:	74 41                	je     802566 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  802525:	85 ff                	test   %edi,%edi
+  802527:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80252c:	0f 44 f8             	cmove  %eax,%edi
+  80252f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802534:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  802539:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80253c:	89 fb                	mov    %edi,%ebx
+  80253e:	c1 fb 1f             	sar    $0x1f,%ebx
+  802541:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802544:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802547:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  80254a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80254d:	89 75 08             	mov    %esi,0x8(%ebp)
+  802550:	eb 67                	jmp    8025b9 <strtol+0xcd>
+		s++;
+  802552:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  802555:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80255a:	eb bc                	jmp    802518 <strtol+0x2c>
+		s++, neg = 1;
+  80255c:	83 c6 01             	add    $0x1,%esi
+  80255f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802564:	eb b2                	jmp    802518 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802566:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  80256a:	74 0e                	je     80257a <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  80256c:	85 ff                	test   %edi,%edi
+  80256e:	75 bf                	jne    80252f <strtol+0x43>
+		s++, base = 8;
+  802570:	83 c6 01             	add    $0x1,%esi
+  802573:	bf 08 00 00 00       	mov    $0x8,%edi
+  802578:	eb b5                	jmp    80252f <strtol+0x43>
+		s += 2, base = 16;
+  80257a:	83 c6 02             	add    $0x2,%esi
+  80257d:	bf 10 00 00 00       	mov    $0x10,%edi
+  802582:	eb ab                	jmp    80252f <strtol+0x43>
+			dig = *s - '0';
+  802584:	0f be c9             	movsbl %cl,%ecx
+  802587:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  80258a:	39 f9                	cmp    %edi,%ecx
+  80258c:	7d 59                	jge    8025e7 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  80258e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  802592:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802595:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802598:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  80259b:	0f af d8             	imul   %eax,%ebx
+  80259e:	0f af d7             	imul   %edi,%edx
+  8025a1:	01 d3                	add    %edx,%ebx
+  8025a3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8025a6:	f7 e7                	mul    %edi
+  8025a8:	01 da                	add    %ebx,%edx
+  8025aa:	89 cb                	mov    %ecx,%ebx
+  8025ac:	c1 fb 1f             	sar    $0x1f,%ebx
+  8025af:	01 c8                	add    %ecx,%eax
+  8025b1:	11 da                	adc    %ebx,%edx
+  8025b3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  8025b6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  8025b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025bc:	0f b6 08             	movzbl (%eax),%ecx
+  8025bf:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  8025c2:	80 fb 09             	cmp    $0x9,%bl
+  8025c5:	76 bd                	jbe    802584 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  8025c7:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  8025ca:	80 fb 19             	cmp    $0x19,%bl
+  8025cd:	77 08                	ja     8025d7 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  8025cf:	0f be c9             	movsbl %cl,%ecx
+  8025d2:	83 e9 57             	sub    $0x57,%ecx
+  8025d5:	eb b3                	jmp    80258a <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  8025d7:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  8025da:	80 fb 19             	cmp    $0x19,%bl
+  8025dd:	77 08                	ja     8025e7 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  8025df:	0f be c9             	movsbl %cl,%ecx
+  8025e2:	83 e9 37             	sub    $0x37,%ecx
+  8025e5:	eb a3                	jmp    80258a <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8025e7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8025ea:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8025ed:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  8025f0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025f3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8025f7:	74 05                	je     8025fe <strtol+0x112>
+		*endptr = (char *) s;
+  8025f9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8025fc:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  8025fe:	85 c9                	test   %ecx,%ecx
+  802600:	74 07                	je     802609 <strtol+0x11d>
+  802602:	f7 d8                	neg    %eax
+  802604:	83 d2 00             	adc    $0x0,%edx
+  802607:	f7 da                	neg    %edx
+}
+  802609:	83 c4 1c             	add    $0x1c,%esp
+  80260c:	5b                   	pop    %ebx
+  80260d:	5e                   	pop    %esi
+  80260e:	5f                   	pop    %edi
+  80260f:	5d                   	pop    %ebp
+  802610:	c3                   	ret
+
+00802611 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802611:	55                   	push   %ebp
+  802612:	89 e5                	mov    %esp,%ebp
+  802614:	57                   	push   %edi
+  802615:	56                   	push   %esi
+  802616:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802617:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  80261e:	74 18                	je     802638 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  802620:	b8 00 00 00 00       	mov    $0x0,%eax
+  802625:	8b 55 08             	mov    0x8(%ebp),%edx
+  802628:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80262b:	89 c3                	mov    %eax,%ebx
+  80262d:	89 c7                	mov    %eax,%edi
+  80262f:	89 c6                	mov    %eax,%esi
+  802631:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  802633:	5b                   	pop    %ebx
+  802634:	5e                   	pop    %esi
+  802635:	5f                   	pop    %edi
+  802636:	5d                   	pop    %ebp
+  802637:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802640:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802643:	89 c3                	mov    %eax,%ebx
+  802645:	89 c7                	mov    %eax,%edi
+  802647:	55                   	push   %ebp
+  802648:	89 e5                	mov    %esp,%ebp
+  80264a:	8d 35 52 26 80 00    	lea    0x802652,%esi
+  802650:	0f 34                	sysenter
+  802652:	5d                   	pop    %ebp
+		goto out;
+  802653:	eb de                	jmp    802633 <sys_cputs+0x22>
+
+00802655 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802655:	55                   	push   %ebp
+  802656:	89 e5                	mov    %esp,%ebp
+  802658:	57                   	push   %edi
+  802659:	56                   	push   %esi
+  80265a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80265b:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802662:	74 19                	je     80267d <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  802664:	ba 00 00 00 00       	mov    $0x0,%edx
+  802669:	b8 01 00 00 00       	mov    $0x1,%eax
+  80266e:	89 d1                	mov    %edx,%ecx
+  802670:	89 d3                	mov    %edx,%ebx
+  802672:	89 d7                	mov    %edx,%edi
+  802674:	89 d6                	mov    %edx,%esi
+  802676:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  802678:	5b                   	pop    %ebx
+  802679:	5e                   	pop    %esi
+  80267a:	5f                   	pop    %edi
+  80267b:	5d                   	pop    %ebp
+  80267c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80267d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802682:	b8 01 00 00 00       	mov    $0x1,%eax
+  802687:	89 d1                	mov    %edx,%ecx
+  802689:	89 d3                	mov    %edx,%ebx
+  80268b:	89 d7                	mov    %edx,%edi
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	8d 35 98 26 80 00    	lea    0x802698,%esi
+  802696:	0f 34                	sysenter
+  802698:	5d                   	pop    %ebp
+		goto out;
+  802699:	eb dd                	jmp    802678 <sys_cgetc+0x23>
+
+0080269b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80269b:	55                   	push   %ebp
+  80269c:	89 e5                	mov    %esp,%ebp
+  80269e:	57                   	push   %edi
+  80269f:	56                   	push   %esi
+  8026a0:	53                   	push   %ebx
+  8026a1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8026a4:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  8026ab:	74 21                	je     8026ce <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  8026ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026b2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026ba:	89 cb                	mov    %ecx,%ebx
+  8026bc:	89 cf                	mov    %ecx,%edi
+  8026be:	89 ce                	mov    %ecx,%esi
+  8026c0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	7f 27                	jg     8026ed <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8026c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c9:	5b                   	pop    %ebx
+  8026ca:	5e                   	pop    %esi
+  8026cb:	5f                   	pop    %edi
+  8026cc:	5d                   	pop    %ebp
+  8026cd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8026ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026db:	89 cb                	mov    %ecx,%ebx
+  8026dd:	89 cf                	mov    %ecx,%edi
+  8026df:	55                   	push   %ebp
+  8026e0:	89 e5                	mov    %esp,%ebp
+  8026e2:	8d 35 ea 26 80 00    	lea    0x8026ea,%esi
+  8026e8:	0f 34                	sysenter
+  8026ea:	5d                   	pop    %ebp
+		goto out;
+  8026eb:	eb d5                	jmp    8026c2 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8026ed:	83 ec 0c             	sub    $0xc,%esp
+  8026f0:	50                   	push   %eax
+  8026f1:	6a 03                	push   $0x3
+  8026f3:	68 0b 52 80 00       	push   $0x80520b
+  8026f8:	6a 3f                	push   $0x3f
+  8026fa:	68 28 52 80 00       	push   $0x805228
+  8026ff:	e8 71 f4 ff ff       	call   801b75 <_panic>
+
+00802704 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802704:	55                   	push   %ebp
+  802705:	89 e5                	mov    %esp,%ebp
+  802707:	57                   	push   %edi
+  802708:	56                   	push   %esi
+  802709:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80270a:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802711:	74 19                	je     80272c <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  802713:	ba 00 00 00 00       	mov    $0x0,%edx
+  802718:	b8 02 00 00 00       	mov    $0x2,%eax
+  80271d:	89 d1                	mov    %edx,%ecx
+  80271f:	89 d3                	mov    %edx,%ebx
+  802721:	89 d7                	mov    %edx,%edi
+  802723:	89 d6                	mov    %edx,%esi
+  802725:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  802727:	5b                   	pop    %ebx
+  802728:	5e                   	pop    %esi
+  802729:	5f                   	pop    %edi
+  80272a:	5d                   	pop    %ebp
+  80272b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80272c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802731:	b8 02 00 00 00       	mov    $0x2,%eax
+  802736:	89 d1                	mov    %edx,%ecx
+  802738:	89 d3                	mov    %edx,%ebx
+  80273a:	89 d7                	mov    %edx,%edi
+  80273c:	55                   	push   %ebp
+  80273d:	89 e5                	mov    %esp,%ebp
+  80273f:	8d 35 47 27 80 00    	lea    0x802747,%esi
+  802745:	0f 34                	sysenter
+  802747:	5d                   	pop    %ebp
+		goto out;
+  802748:	eb dd                	jmp    802727 <sys_getenvid+0x23>
+
+0080274a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80274a:	55                   	push   %ebp
+  80274b:	89 e5                	mov    %esp,%ebp
+  80274d:	57                   	push   %edi
+  80274e:	56                   	push   %esi
+  80274f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802750:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802757:	74 19                	je     802772 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  802759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802763:	89 d1                	mov    %edx,%ecx
+  802765:	89 d3                	mov    %edx,%ebx
+  802767:	89 d7                	mov    %edx,%edi
+  802769:	89 d6                	mov    %edx,%esi
+  80276b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80276d:	5b                   	pop    %ebx
+  80276e:	5e                   	pop    %esi
+  80276f:	5f                   	pop    %edi
+  802770:	5d                   	pop    %ebp
+  802771:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802772:	ba 00 00 00 00       	mov    $0x0,%edx
+  802777:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80277c:	89 d1                	mov    %edx,%ecx
+  80277e:	89 d3                	mov    %edx,%ebx
+  802780:	89 d7                	mov    %edx,%edi
+  802782:	55                   	push   %ebp
+  802783:	89 e5                	mov    %esp,%ebp
+  802785:	8d 35 8d 27 80 00    	lea    0x80278d,%esi
+  80278b:	0f 34                	sysenter
+  80278d:	5d                   	pop    %ebp
+		goto out;
+  80278e:	eb dd                	jmp    80276d <sys_yield+0x23>
+
+00802790 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802790:	55                   	push   %ebp
+  802791:	89 e5                	mov    %esp,%ebp
+  802793:	57                   	push   %edi
+  802794:	56                   	push   %esi
+  802795:	53                   	push   %ebx
+  802796:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  802799:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  8027a0:	74 23                	je     8027c5 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  8027a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8027b5:	89 f7                	mov    %esi,%edi
+  8027b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8027b9:	85 c0                	test   %eax,%eax
+  8027bb:	7f 29                	jg     8027e6 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8027bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c0:	5b                   	pop    %ebx
+  8027c1:	5e                   	pop    %esi
+  8027c2:	5f                   	pop    %edi
+  8027c3:	5d                   	pop    %ebp
+  8027c4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8027c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027cb:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8027d8:	55                   	push   %ebp
+  8027d9:	89 e5                	mov    %esp,%ebp
+  8027db:	8d 35 e3 27 80 00    	lea    0x8027e3,%esi
+  8027e1:	0f 34                	sysenter
+  8027e3:	5d                   	pop    %ebp
+		goto out;
+  8027e4:	eb d3                	jmp    8027b9 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8027e6:	83 ec 0c             	sub    $0xc,%esp
+  8027e9:	50                   	push   %eax
+  8027ea:	6a 04                	push   $0x4
+  8027ec:	68 0b 52 80 00       	push   $0x80520b
+  8027f1:	6a 3f                	push   $0x3f
+  8027f3:	68 28 52 80 00       	push   $0x805228
+  8027f8:	e8 78 f3 ff ff       	call   801b75 <_panic>
+
+008027fd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8027fd:	55                   	push   %ebp
+  8027fe:	89 e5                	mov    %esp,%ebp
+  802800:	57                   	push   %edi
+  802801:	56                   	push   %esi
+  802802:	53                   	push   %ebx
+  802803:	83 ec 0c             	sub    $0xc,%esp
+  802806:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  802809:	85 f6                	test   %esi,%esi
+  80280b:	75 09                	jne    802816 <sys_page_map+0x19>
+  80280d:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802814:	74 1f                	je     802835 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  802816:	b8 05 00 00 00       	mov    $0x5,%eax
+  80281b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80281e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802821:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802824:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802827:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802829:	85 c0                	test   %eax,%eax
+  80282b:	7f 27                	jg     802854 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80282d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802830:	5b                   	pop    %ebx
+  802831:	5e                   	pop    %esi
+  802832:	5f                   	pop    %edi
+  802833:	5d                   	pop    %ebp
+  802834:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802835:	8b 55 08             	mov    0x8(%ebp),%edx
+  802838:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80283b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802840:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802843:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802846:	55                   	push   %ebp
+  802847:	89 e5                	mov    %esp,%ebp
+  802849:	8d 35 51 28 80 00    	lea    0x802851,%esi
+  80284f:	0f 34                	sysenter
+  802851:	5d                   	pop    %ebp
+		goto out;
+  802852:	eb d5                	jmp    802829 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802854:	83 ec 0c             	sub    $0xc,%esp
+  802857:	50                   	push   %eax
+  802858:	6a 05                	push   $0x5
+  80285a:	68 0b 52 80 00       	push   $0x80520b
+  80285f:	6a 3f                	push   $0x3f
+  802861:	68 28 52 80 00       	push   $0x805228
+  802866:	e8 0a f3 ff ff       	call   801b75 <_panic>
+
+0080286b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80286b:	55                   	push   %ebp
+  80286c:	89 e5                	mov    %esp,%ebp
+  80286e:	57                   	push   %edi
+  80286f:	56                   	push   %esi
+  802870:	53                   	push   %ebx
+  802871:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  802874:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  80287b:	74 22                	je     80289f <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  80287d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802882:	b8 06 00 00 00       	mov    $0x6,%eax
+  802887:	8b 55 08             	mov    0x8(%ebp),%edx
+  80288a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80288d:	89 df                	mov    %ebx,%edi
+  80288f:	89 de                	mov    %ebx,%esi
+  802891:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802893:	85 c0                	test   %eax,%eax
+  802895:	7f 28                	jg     8028bf <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  802897:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80289a:	5b                   	pop    %ebx
+  80289b:	5e                   	pop    %esi
+  80289c:	5f                   	pop    %edi
+  80289d:	5d                   	pop    %ebp
+  80289e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80289f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028aa:	b8 06 00 00 00       	mov    $0x6,%eax
+  8028af:	89 df                	mov    %ebx,%edi
+  8028b1:	55                   	push   %ebp
+  8028b2:	89 e5                	mov    %esp,%ebp
+  8028b4:	8d 35 bc 28 80 00    	lea    0x8028bc,%esi
+  8028ba:	0f 34                	sysenter
+  8028bc:	5d                   	pop    %ebp
+		goto out;
+  8028bd:	eb d4                	jmp    802893 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8028bf:	83 ec 0c             	sub    $0xc,%esp
+  8028c2:	50                   	push   %eax
+  8028c3:	6a 06                	push   $0x6
+  8028c5:	68 0b 52 80 00       	push   $0x80520b
+  8028ca:	6a 3f                	push   $0x3f
+  8028cc:	68 28 52 80 00       	push   $0x805228
+  8028d1:	e8 9f f2 ff ff       	call   801b75 <_panic>
+
+008028d6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	57                   	push   %edi
+  8028da:	56                   	push   %esi
+  8028db:	53                   	push   %ebx
+  8028dc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8028df:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  8028e6:	74 22                	je     80290a <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8028e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028ed:	b8 08 00 00 00       	mov    $0x8,%eax
+  8028f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028f8:	89 df                	mov    %ebx,%edi
+  8028fa:	89 de                	mov    %ebx,%esi
+  8028fc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8028fe:	85 c0                	test   %eax,%eax
+  802900:	7f 28                	jg     80292a <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  802902:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802905:	5b                   	pop    %ebx
+  802906:	5e                   	pop    %esi
+  802907:	5f                   	pop    %edi
+  802908:	5d                   	pop    %ebp
+  802909:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80290a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802912:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802915:	b8 08 00 00 00       	mov    $0x8,%eax
+  80291a:	89 df                	mov    %ebx,%edi
+  80291c:	55                   	push   %ebp
+  80291d:	89 e5                	mov    %esp,%ebp
+  80291f:	8d 35 27 29 80 00    	lea    0x802927,%esi
+  802925:	0f 34                	sysenter
+  802927:	5d                   	pop    %ebp
+		goto out;
+  802928:	eb d4                	jmp    8028fe <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80292a:	83 ec 0c             	sub    $0xc,%esp
+  80292d:	50                   	push   %eax
+  80292e:	6a 08                	push   $0x8
+  802930:	68 0b 52 80 00       	push   $0x80520b
+  802935:	6a 3f                	push   $0x3f
+  802937:	68 28 52 80 00       	push   $0x805228
+  80293c:	e8 34 f2 ff ff       	call   801b75 <_panic>
+
+00802941 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802941:	55                   	push   %ebp
+  802942:	89 e5                	mov    %esp,%ebp
+  802944:	57                   	push   %edi
+  802945:	56                   	push   %esi
+  802946:	53                   	push   %ebx
+  802947:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80294a:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802951:	74 22                	je     802975 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  802953:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802958:	b8 09 00 00 00       	mov    $0x9,%eax
+  80295d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802960:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802963:	89 df                	mov    %ebx,%edi
+  802965:	89 de                	mov    %ebx,%esi
+  802967:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802969:	85 c0                	test   %eax,%eax
+  80296b:	7f 28                	jg     802995 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80296d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802970:	5b                   	pop    %ebx
+  802971:	5e                   	pop    %esi
+  802972:	5f                   	pop    %edi
+  802973:	5d                   	pop    %ebp
+  802974:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802975:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80297a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80297d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802980:	b8 09 00 00 00       	mov    $0x9,%eax
+  802985:	89 df                	mov    %ebx,%edi
+  802987:	55                   	push   %ebp
+  802988:	89 e5                	mov    %esp,%ebp
+  80298a:	8d 35 92 29 80 00    	lea    0x802992,%esi
+  802990:	0f 34                	sysenter
+  802992:	5d                   	pop    %ebp
+		goto out;
+  802993:	eb d4                	jmp    802969 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802995:	83 ec 0c             	sub    $0xc,%esp
+  802998:	50                   	push   %eax
+  802999:	6a 09                	push   $0x9
+  80299b:	68 0b 52 80 00       	push   $0x80520b
+  8029a0:	6a 3f                	push   $0x3f
+  8029a2:	68 28 52 80 00       	push   $0x805228
+  8029a7:	e8 c9 f1 ff ff       	call   801b75 <_panic>
+
+008029ac <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8029ac:	55                   	push   %ebp
+  8029ad:	89 e5                	mov    %esp,%ebp
+  8029af:	57                   	push   %edi
+  8029b0:	56                   	push   %esi
+  8029b1:	53                   	push   %ebx
+  8029b2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8029b5:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  8029bc:	74 22                	je     8029e0 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8029be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029ce:	89 df                	mov    %ebx,%edi
+  8029d0:	89 de                	mov    %ebx,%esi
+  8029d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	7f 28                	jg     802a00 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8029d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029db:	5b                   	pop    %ebx
+  8029dc:	5e                   	pop    %esi
+  8029dd:	5f                   	pop    %edi
+  8029de:	5d                   	pop    %ebp
+  8029df:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8029e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029f0:	89 df                	mov    %ebx,%edi
+  8029f2:	55                   	push   %ebp
+  8029f3:	89 e5                	mov    %esp,%ebp
+  8029f5:	8d 35 fd 29 80 00    	lea    0x8029fd,%esi
+  8029fb:	0f 34                	sysenter
+  8029fd:	5d                   	pop    %ebp
+		goto out;
+  8029fe:	eb d4                	jmp    8029d4 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802a00:	83 ec 0c             	sub    $0xc,%esp
+  802a03:	50                   	push   %eax
+  802a04:	6a 0a                	push   $0xa
+  802a06:	68 0b 52 80 00       	push   $0x80520b
+  802a0b:	6a 3f                	push   $0x3f
+  802a0d:	68 28 52 80 00       	push   $0x805228
+  802a12:	e8 5e f1 ff ff       	call   801b75 <_panic>
+
+00802a17 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  802a17:	55                   	push   %ebp
+  802a18:	89 e5                	mov    %esp,%ebp
+  802a1a:	57                   	push   %edi
+  802a1b:	56                   	push   %esi
+  802a1c:	53                   	push   %ebx
+  802a1d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  802a20:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802a27:	74 22                	je     802a4b <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  802a29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a2e:	b8 17 00 00 00       	mov    $0x17,%eax
+  802a33:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a39:	89 df                	mov    %ebx,%edi
+  802a3b:	89 de                	mov    %ebx,%esi
+  802a3d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802a3f:	85 c0                	test   %eax,%eax
+  802a41:	7f 28                	jg     802a6b <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  802a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a46:	5b                   	pop    %ebx
+  802a47:	5e                   	pop    %esi
+  802a48:	5f                   	pop    %edi
+  802a49:	5d                   	pop    %ebp
+  802a4a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802a4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a50:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a56:	b8 17 00 00 00       	mov    $0x17,%eax
+  802a5b:	89 df                	mov    %ebx,%edi
+  802a5d:	55                   	push   %ebp
+  802a5e:	89 e5                	mov    %esp,%ebp
+  802a60:	8d 35 68 2a 80 00    	lea    0x802a68,%esi
+  802a66:	0f 34                	sysenter
+  802a68:	5d                   	pop    %ebp
+		goto out;
+  802a69:	eb d4                	jmp    802a3f <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802a6b:	83 ec 0c             	sub    $0xc,%esp
+  802a6e:	50                   	push   %eax
+  802a6f:	6a 17                	push   $0x17
+  802a71:	68 0b 52 80 00       	push   $0x80520b
+  802a76:	6a 3f                	push   $0x3f
+  802a78:	68 28 52 80 00       	push   $0x805228
+  802a7d:	e8 f3 f0 ff ff       	call   801b75 <_panic>
+
+00802a82 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  802a82:	55                   	push   %ebp
+  802a83:	89 e5                	mov    %esp,%ebp
+  802a85:	57                   	push   %edi
+  802a86:	56                   	push   %esi
+  802a87:	53                   	push   %ebx
+  802a88:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  802a8b:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802a92:	74 22                	je     802ab6 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  802a94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a99:	b8 18 00 00 00       	mov    $0x18,%eax
+  802a9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802aa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802aa4:	89 df                	mov    %ebx,%edi
+  802aa6:	89 de                	mov    %ebx,%esi
+  802aa8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802aaa:	85 c0                	test   %eax,%eax
+  802aac:	7f 28                	jg     802ad6 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  802aae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ab1:	5b                   	pop    %ebx
+  802ab2:	5e                   	pop    %esi
+  802ab3:	5f                   	pop    %edi
+  802ab4:	5d                   	pop    %ebp
+  802ab5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802ab6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802abb:	8b 55 08             	mov    0x8(%ebp),%edx
+  802abe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ac1:	b8 18 00 00 00       	mov    $0x18,%eax
+  802ac6:	89 df                	mov    %ebx,%edi
+  802ac8:	55                   	push   %ebp
+  802ac9:	89 e5                	mov    %esp,%ebp
+  802acb:	8d 35 d3 2a 80 00    	lea    0x802ad3,%esi
+  802ad1:	0f 34                	sysenter
+  802ad3:	5d                   	pop    %ebp
+		goto out;
+  802ad4:	eb d4                	jmp    802aaa <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802ad6:	83 ec 0c             	sub    $0xc,%esp
+  802ad9:	50                   	push   %eax
+  802ada:	6a 18                	push   $0x18
+  802adc:	68 0b 52 80 00       	push   $0x80520b
+  802ae1:	6a 3f                	push   $0x3f
+  802ae3:	68 28 52 80 00       	push   $0x805228
+  802ae8:	e8 88 f0 ff ff       	call   801b75 <_panic>
+
+00802aed <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  802aed:	55                   	push   %ebp
+  802aee:	89 e5                	mov    %esp,%ebp
+  802af0:	57                   	push   %edi
+  802af1:	56                   	push   %esi
+  802af2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802af3:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802afa:	74 1d                	je     802b19 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  802afc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802b01:	be 00 00 00 00       	mov    $0x0,%esi
+  802b06:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b0f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b12:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  802b14:	5b                   	pop    %ebx
+  802b15:	5e                   	pop    %esi
+  802b16:	5f                   	pop    %edi
+  802b17:	5d                   	pop    %ebp
+  802b18:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802b19:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b1f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802b24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b27:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	8d 35 35 2b 80 00    	lea    0x802b35,%esi
+  802b33:	0f 34                	sysenter
+  802b35:	5d                   	pop    %ebp
+		goto out;
+  802b36:	eb dc                	jmp    802b14 <sys_ipc_try_send+0x27>
+
+00802b38 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802b38:	55                   	push   %ebp
+  802b39:	89 e5                	mov    %esp,%ebp
+  802b3b:	57                   	push   %edi
+  802b3c:	56                   	push   %esi
+  802b3d:	53                   	push   %ebx
+  802b3e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  802b41:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802b48:	74 21                	je     802b6b <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  802b4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b4f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802b54:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b57:	89 cb                	mov    %ecx,%ebx
+  802b59:	89 cf                	mov    %ecx,%edi
+  802b5b:	89 ce                	mov    %ecx,%esi
+  802b5d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	7f 27                	jg     802b8a <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  802b63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b66:	5b                   	pop    %ebx
+  802b67:	5e                   	pop    %esi
+  802b68:	5f                   	pop    %edi
+  802b69:	5d                   	pop    %ebp
+  802b6a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802b6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b73:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802b78:	89 cb                	mov    %ecx,%ebx
+  802b7a:	89 cf                	mov    %ecx,%edi
+  802b7c:	55                   	push   %ebp
+  802b7d:	89 e5                	mov    %esp,%ebp
+  802b7f:	8d 35 87 2b 80 00    	lea    0x802b87,%esi
+  802b85:	0f 34                	sysenter
+  802b87:	5d                   	pop    %ebp
+		goto out;
+  802b88:	eb d5                	jmp    802b5f <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802b8a:	83 ec 0c             	sub    $0xc,%esp
+  802b8d:	50                   	push   %eax
+  802b8e:	6a 0d                	push   $0xd
+  802b90:	68 0b 52 80 00       	push   $0x80520b
+  802b95:	6a 3f                	push   $0x3f
+  802b97:	68 28 52 80 00       	push   $0x805228
+  802b9c:	e8 d4 ef ff ff       	call   801b75 <_panic>
+
+00802ba1 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  802ba1:	55                   	push   %ebp
+  802ba2:	89 e5                	mov    %esp,%ebp
+  802ba4:	57                   	push   %edi
+  802ba5:	56                   	push   %esi
+  802ba6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802ba7:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802bae:	74 1b                	je     802bcb <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  802bb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bb5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802bba:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bc0:	89 df                	mov    %ebx,%edi
+  802bc2:	89 de                	mov    %ebx,%esi
+  802bc4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  802bc6:	5b                   	pop    %ebx
+  802bc7:	5e                   	pop    %esi
+  802bc8:	5f                   	pop    %edi
+  802bc9:	5d                   	pop    %ebp
+  802bca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802bcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bd6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802bdb:	89 df                	mov    %ebx,%edi
+  802bdd:	55                   	push   %ebp
+  802bde:	89 e5                	mov    %esp,%ebp
+  802be0:	8d 35 e8 2b 80 00    	lea    0x802be8,%esi
+  802be6:	0f 34                	sysenter
+  802be8:	5d                   	pop    %ebp
+		goto out;
+  802be9:	eb db                	jmp    802bc6 <sys_ipc_recv_until+0x25>
+
+00802beb <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802beb:	55                   	push   %ebp
+  802bec:	89 e5                	mov    %esp,%ebp
+  802bee:	57                   	push   %edi
+  802bef:	56                   	push   %esi
+  802bf0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802bf1:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802bf8:	74 19                	je     802c13 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  802bfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bff:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802c04:	89 d1                	mov    %edx,%ecx
+  802c06:	89 d3                	mov    %edx,%ebx
+  802c08:	89 d7                	mov    %edx,%edi
+  802c0a:	89 d6                	mov    %edx,%esi
+  802c0c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  802c0e:	5b                   	pop    %ebx
+  802c0f:	5e                   	pop    %esi
+  802c10:	5f                   	pop    %edi
+  802c11:	5d                   	pop    %ebp
+  802c12:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c18:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802c1d:	89 d1                	mov    %edx,%ecx
+  802c1f:	89 d3                	mov    %edx,%ebx
+  802c21:	89 d7                	mov    %edx,%edi
+  802c23:	55                   	push   %ebp
+  802c24:	89 e5                	mov    %esp,%ebp
+  802c26:	8d 35 2e 2c 80 00    	lea    0x802c2e,%esi
+  802c2c:	0f 34                	sysenter
+  802c2e:	5d                   	pop    %ebp
+		goto out;
+  802c2f:	eb dd                	jmp    802c0e <sys_time_msec+0x23>
+
+00802c31 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  802c31:	55                   	push   %ebp
+  802c32:	89 e5                	mov    %esp,%ebp
+  802c34:	57                   	push   %edi
+  802c35:	56                   	push   %esi
+  802c36:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802c37:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802c3e:	74 1a                	je     802c5a <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  802c40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c45:	b8 10 00 00 00       	mov    $0x10,%eax
+  802c4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c4d:	89 cb                	mov    %ecx,%ebx
+  802c4f:	89 cf                	mov    %ecx,%edi
+  802c51:	89 ce                	mov    %ecx,%esi
+  802c53:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  802c55:	5b                   	pop    %ebx
+  802c56:	5e                   	pop    %esi
+  802c57:	5f                   	pop    %edi
+  802c58:	5d                   	pop    %ebp
+  802c59:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802c5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c62:	b8 10 00 00 00       	mov    $0x10,%eax
+  802c67:	89 cb                	mov    %ecx,%ebx
+  802c69:	89 cf                	mov    %ecx,%edi
+  802c6b:	55                   	push   %ebp
+  802c6c:	89 e5                	mov    %esp,%ebp
+  802c6e:	8d 35 76 2c 80 00    	lea    0x802c76,%esi
+  802c74:	0f 34                	sysenter
+  802c76:	5d                   	pop    %ebp
+		goto out;
+  802c77:	eb dc                	jmp    802c55 <sys_sleep_until+0x24>
+
+00802c79 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  802c79:	55                   	push   %ebp
+  802c7a:	89 e5                	mov    %esp,%ebp
+  802c7c:	57                   	push   %edi
+  802c7d:	56                   	push   %esi
+  802c7e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802c7f:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802c86:	74 1a                	je     802ca2 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  802c88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c8d:	b8 11 00 00 00       	mov    $0x11,%eax
+  802c92:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c95:	89 cb                	mov    %ecx,%ebx
+  802c97:	89 cf                	mov    %ecx,%edi
+  802c99:	89 ce                	mov    %ecx,%esi
+  802c9b:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  802c9d:	5b                   	pop    %ebx
+  802c9e:	5e                   	pop    %esi
+  802c9f:	5f                   	pop    %edi
+  802ca0:	5d                   	pop    %ebp
+  802ca1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802ca2:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ca5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802caa:	b8 11 00 00 00       	mov    $0x11,%eax
+  802caf:	89 cb                	mov    %ecx,%ebx
+  802cb1:	89 cf                	mov    %ecx,%edi
+  802cb3:	55                   	push   %ebp
+  802cb4:	89 e5                	mov    %esp,%ebp
+  802cb6:	8d 35 be 2c 80 00    	lea    0x802cbe,%esi
+  802cbc:	0f 34                	sysenter
+  802cbe:	5d                   	pop    %ebp
+		goto out;
+  802cbf:	eb dc                	jmp    802c9d <sys_env_print_stats+0x24>
+
+00802cc1 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  802cc1:	55                   	push   %ebp
+  802cc2:	89 e5                	mov    %esp,%ebp
+  802cc4:	57                   	push   %edi
+  802cc5:	56                   	push   %esi
+  802cc6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802cc7:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802cce:	74 1b                	je     802ceb <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  802cd0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cd5:	b8 19 00 00 00       	mov    $0x19,%eax
+  802cda:	8b 55 08             	mov    0x8(%ebp),%edx
+  802cdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ce0:	89 df                	mov    %ebx,%edi
+  802ce2:	89 de                	mov    %ebx,%esi
+  802ce4:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  802ce6:	5b                   	pop    %ebx
+  802ce7:	5e                   	pop    %esi
+  802ce8:	5f                   	pop    %edi
+  802ce9:	5d                   	pop    %ebp
+  802cea:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802ceb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  802cf3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cf6:	b8 19 00 00 00       	mov    $0x19,%eax
+  802cfb:	89 df                	mov    %ebx,%edi
+  802cfd:	55                   	push   %ebp
+  802cfe:	89 e5                	mov    %esp,%ebp
+  802d00:	8d 35 08 2d 80 00    	lea    0x802d08,%esi
+  802d06:	0f 34                	sysenter
+  802d08:	5d                   	pop    %ebp
+		goto out;
+  802d09:	eb db                	jmp    802ce6 <sys_perf+0x25>
+
+00802d0b <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	57                   	push   %edi
+  802d0f:	56                   	push   %esi
+  802d10:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802d11:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802d18:	74 19                	je     802d33 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  802d1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d1f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  802d24:	89 d1                	mov    %edx,%ecx
+  802d26:	89 d3                	mov    %edx,%ebx
+  802d28:	89 d7                	mov    %edx,%edi
+  802d2a:	89 d6                	mov    %edx,%esi
+  802d2c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  802d2e:	5b                   	pop    %ebx
+  802d2f:	5e                   	pop    %esi
+  802d30:	5f                   	pop    %edi
+  802d31:	5d                   	pop    %ebp
+  802d32:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802d33:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d38:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  802d3d:	89 d1                	mov    %edx,%ecx
+  802d3f:	89 d3                	mov    %edx,%ebx
+  802d41:	89 d7                	mov    %edx,%edi
+  802d43:	55                   	push   %ebp
+  802d44:	89 e5                	mov    %esp,%ebp
+  802d46:	8d 35 4e 2d 80 00    	lea    0x802d4e,%esi
+  802d4c:	0f 34                	sysenter
+  802d4e:	5d                   	pop    %ebp
+		goto out;
+  802d4f:	eb dd                	jmp    802d2e <sys_fork+0x23>
+
+00802d51 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  802d51:	55                   	push   %ebp
+  802d52:	89 e5                	mov    %esp,%ebp
+  802d54:	57                   	push   %edi
+  802d55:	56                   	push   %esi
+  802d56:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802d57:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802d5e:	74 1c                	je     802d7c <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  802d60:	be 00 00 00 00       	mov    $0x0,%esi
+  802d65:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  802d6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d70:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d73:	89 f7                	mov    %esi,%edi
+  802d75:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  802d77:	5b                   	pop    %ebx
+  802d78:	5e                   	pop    %esi
+  802d79:	5f                   	pop    %edi
+  802d7a:	5d                   	pop    %ebp
+  802d7b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d82:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  802d87:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d8f:	55                   	push   %ebp
+  802d90:	89 e5                	mov    %esp,%ebp
+  802d92:	8d 35 9a 2d 80 00    	lea    0x802d9a,%esi
+  802d98:	0f 34                	sysenter
+  802d9a:	5d                   	pop    %ebp
+		goto out;
+  802d9b:	eb da                	jmp    802d77 <sys_thread_create+0x26>
+
+00802d9d <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  802d9d:	55                   	push   %ebp
+  802d9e:	89 e5                	mov    %esp,%ebp
+  802da0:	57                   	push   %edi
+  802da1:	56                   	push   %esi
+  802da2:	53                   	push   %ebx
+  802da3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  802da6:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802dad:	74 24                	je     802dd3 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  802daf:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  802db4:	be 00 00 00 00       	mov    $0x0,%esi
+  802db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  802dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dc2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802dc5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802dc7:	85 c0                	test   %eax,%eax
+  802dc9:	7f 27                	jg     802df2 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  802dcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dce:	5b                   	pop    %ebx
+  802dcf:	5e                   	pop    %esi
+  802dd0:	5f                   	pop    %edi
+  802dd1:	5d                   	pop    %ebp
+  802dd2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802dd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802dd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dd9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  802dde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802de1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802de4:	55                   	push   %ebp
+  802de5:	89 e5                	mov    %esp,%ebp
+  802de7:	8d 35 ef 2d 80 00    	lea    0x802def,%esi
+  802ded:	0f 34                	sysenter
+  802def:	5d                   	pop    %ebp
+		goto out;
+  802df0:	eb d5                	jmp    802dc7 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802df2:	83 ec 0c             	sub    $0xc,%esp
+  802df5:	50                   	push   %eax
+  802df6:	6a 1f                	push   $0x1f
+  802df8:	68 0b 52 80 00       	push   $0x80520b
+  802dfd:	6a 3f                	push   $0x3f
+  802dff:	68 28 52 80 00       	push   $0x805228
+  802e04:	e8 6c ed ff ff       	call   801b75 <_panic>
+
+00802e09 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	57                   	push   %edi
+  802e0d:	56                   	push   %esi
+  802e0e:	53                   	push   %ebx
+  802e0f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  802e12:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802e19:	74 23                	je     802e3e <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  802e1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e20:	b8 20 00 00 00       	mov    $0x20,%eax
+  802e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e2e:	89 f7                	mov    %esi,%edi
+  802e30:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802e32:	85 c0                	test   %eax,%eax
+  802e34:	7f 29                	jg     802e5f <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  802e36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e39:	5b                   	pop    %ebx
+  802e3a:	5e                   	pop    %esi
+  802e3b:	5f                   	pop    %edi
+  802e3c:	5d                   	pop    %ebp
+  802e3d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e44:	b8 20 00 00 00       	mov    $0x20,%eax
+  802e49:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e51:	55                   	push   %ebp
+  802e52:	89 e5                	mov    %esp,%ebp
+  802e54:	8d 35 5c 2e 80 00    	lea    0x802e5c,%esi
+  802e5a:	0f 34                	sysenter
+  802e5c:	5d                   	pop    %ebp
+		goto out;
+  802e5d:	eb d3                	jmp    802e32 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802e5f:	83 ec 0c             	sub    $0xc,%esp
+  802e62:	50                   	push   %eax
+  802e63:	6a 20                	push   $0x20
+  802e65:	68 0b 52 80 00       	push   $0x80520b
+  802e6a:	6a 3f                	push   $0x3f
+  802e6c:	68 28 52 80 00       	push   $0x805228
+  802e71:	e8 ff ec ff ff       	call   801b75 <_panic>
+
+00802e76 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  802e76:	55                   	push   %ebp
+  802e77:	89 e5                	mov    %esp,%ebp
+  802e79:	57                   	push   %edi
+  802e7a:	56                   	push   %esi
+  802e7b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802e7c:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802e83:	74 1b                	je     802ea0 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  802e85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e8a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  802e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e95:	89 df                	mov    %ebx,%edi
+  802e97:	89 de                	mov    %ebx,%esi
+  802e99:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  802e9b:	5b                   	pop    %ebx
+  802e9c:	5e                   	pop    %esi
+  802e9d:	5f                   	pop    %edi
+  802e9e:	5d                   	pop    %ebp
+  802e9f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802eab:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  802eb0:	89 df                	mov    %ebx,%edi
+  802eb2:	55                   	push   %ebp
+  802eb3:	89 e5                	mov    %esp,%ebp
+  802eb5:	8d 35 bd 2e 80 00    	lea    0x802ebd,%esi
+  802ebb:	0f 34                	sysenter
+  802ebd:	5d                   	pop    %ebp
+		goto out;
+  802ebe:	eb db                	jmp    802e9b <sys_batch+0x25>
+
+00802ec0 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  802ec0:	55                   	push   %ebp
+  802ec1:	89 e5                	mov    %esp,%ebp
+  802ec3:	57                   	push   %edi
+  802ec4:	56                   	push   %esi
+  802ec5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802ec6:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802ecd:	74 1a                	je     802ee9 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  802ecf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ed4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  802ed9:	8b 55 08             	mov    0x8(%ebp),%edx
+  802edc:	89 cb                	mov    %ecx,%ebx
+  802ede:	89 cf                	mov    %ecx,%edi
+  802ee0:	89 ce                	mov    %ecx,%esi
+  802ee2:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  802ee4:	5b                   	pop    %ebx
+  802ee5:	5e                   	pop    %esi
+  802ee6:	5f                   	pop    %edi
+  802ee7:	5d                   	pop    %ebp
+  802ee8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  802eec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ef1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  802ef6:	89 cb                	mov    %ecx,%ebx
+  802ef8:	89 cf                	mov    %ecx,%edi
+  802efa:	55                   	push   %ebp
+  802efb:	89 e5                	mov    %esp,%ebp
+  802efd:	8d 35 05 2f 80 00    	lea    0x802f05,%esi
+  802f03:	0f 34                	sysenter
+  802f05:	5d                   	pop    %ebp
+		goto out;
+  802f06:	eb dc                	jmp    802ee4 <sys_trace_ctl+0x24>
+
+00802f08 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  802f08:	55                   	push   %ebp
+  802f09:	89 e5                	mov    %esp,%ebp
+  802f0b:	57                   	push   %edi
+  802f0c:	56                   	push   %esi
+  802f0d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802f0e:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802f15:	74 1c                	je     802f33 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  802f17:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  802f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f2a:	89 f7                	mov    %esi,%edi
+  802f2c:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  802f2e:	5b                   	pop    %ebx
+  802f2f:	5e                   	pop    %esi
+  802f30:	5f                   	pop    %edi
+  802f31:	5d                   	pop    %ebp
+  802f32:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802f33:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f39:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  802f3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f46:	55                   	push   %ebp
+  802f47:	89 e5                	mov    %esp,%ebp
+  802f49:	8d 35 51 2f 80 00    	lea    0x802f51,%esi
+  802f4f:	0f 34                	sysenter
+  802f51:	5d                   	pop    %ebp
+		goto out;
+  802f52:	eb da                	jmp    802f2e <sys_trace_read+0x26>
+
+00802f54 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  802f54:	55                   	push   %ebp
+  802f55:	89 e5                	mov    %esp,%ebp
+  802f57:	57                   	push   %edi
+  802f58:	56                   	push   %esi
+  802f59:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802f5a:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802f61:	74 1c                	je     802f7f <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  802f63:	be 00 00 00 00       	mov    $0x0,%esi
+  802f68:	b8 21 00 00 00       	mov    $0x21,%eax
+  802f6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f76:	89 f7                	mov    %esi,%edi
+  802f78:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  802f7a:	5b                   	pop    %ebx
+  802f7b:	5e                   	pop    %esi
+  802f7c:	5f                   	pop    %edi
+  802f7d:	5d                   	pop    %ebp
+  802f7e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802f7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f85:	b8 21 00 00 00       	mov    $0x21,%eax
+  802f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f92:	55                   	push   %ebp
+  802f93:	89 e5                	mov    %esp,%ebp
+  802f95:	8d 35 9d 2f 80 00    	lea    0x802f9d,%esi
+  802f9b:	0f 34                	sysenter
+  802f9d:	5d                   	pop    %ebp
+		goto out;
+  802f9e:	eb da                	jmp    802f7a <sys_meminfo+0x26>
+
+00802fa0 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  802fa0:	55                   	push   %ebp
+  802fa1:	89 e5                	mov    %esp,%ebp
+  802fa3:	57                   	push   %edi
+  802fa4:	56                   	push   %esi
+  802fa5:	53                   	push   %ebx
+  802fa6:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  802fa9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  802fad:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  802fb4:	74 1f                	je     802fd5 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  802fb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fbb:	b8 22 00 00 00       	mov    $0x22,%eax
+  802fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  802fc3:	89 df                	mov    %ebx,%edi
+  802fc5:	89 de                	mov    %ebx,%esi
+  802fc7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802fc9:	85 c0                	test   %eax,%eax
+  802fcb:	7f 25                	jg     802ff2 <sys_env_set_ksm+0x52>
+}
+  802fcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd0:	5b                   	pop    %ebx
+  802fd1:	5e                   	pop    %esi
+  802fd2:	5f                   	pop    %edi
+  802fd3:	5d                   	pop    %ebp
+  802fd4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802fd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fda:	8b 55 08             	mov    0x8(%ebp),%edx
+  802fdd:	b8 22 00 00 00       	mov    $0x22,%eax
+  802fe2:	89 df                	mov    %ebx,%edi
+  802fe4:	55                   	push   %ebp
+  802fe5:	89 e5                	mov    %esp,%ebp
+  802fe7:	8d 35 ef 2f 80 00    	lea    0x802fef,%esi
+  802fed:	0f 34                	sysenter
+  802fef:	5d                   	pop    %ebp
+		goto out;
+  802ff0:	eb d7                	jmp    802fc9 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802ff2:	83 ec 0c             	sub    $0xc,%esp
+  802ff5:	50                   	push   %eax
+  802ff6:	6a 22                	push   $0x22
+  802ff8:	68 0b 52 80 00       	push   $0x80520b
+  802ffd:	6a 3f                	push   $0x3f
+  802fff:	68 28 52 80 00       	push   $0x805228
+  803004:	e8 6c eb ff ff       	call   801b75 <_panic>
+
+00803009 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  803009:	55                   	push   %ebp
+  80300a:	89 e5                	mov    %esp,%ebp
+  80300c:	57                   	push   %edi
+  80300d:	56                   	push   %esi
+  80300e:	53                   	push   %ebx
+  80300f:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  803012:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  803015:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  80301c:	74 24                	je     803042 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80301e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803023:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803028:	89 cb                	mov    %ecx,%ebx
+  80302a:	89 cf                	mov    %ecx,%edi
+  80302c:	89 ce                	mov    %ecx,%esi
+  80302e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  803030:	85 c0                	test   %eax,%eax
+  803032:	7f 2a                	jg     80305e <sys_time_nsec+0x55>
+	return ns;
+}
+  803034:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803037:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80303a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80303d:	5b                   	pop    %ebx
+  80303e:	5e                   	pop    %esi
+  80303f:	5f                   	pop    %edi
+  803040:	5d                   	pop    %ebp
+  803041:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  803042:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803047:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80304c:	89 cb                	mov    %ecx,%ebx
+  80304e:	89 cf                	mov    %ecx,%edi
+  803050:	55                   	push   %ebp
+  803051:	89 e5                	mov    %esp,%ebp
+  803053:	8d 35 5b 30 80 00    	lea    0x80305b,%esi
+  803059:	0f 34                	sysenter
+  80305b:	5d                   	pop    %ebp
+		goto out;
+  80305c:	eb d2                	jmp    803030 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80305e:	83 ec 0c             	sub    $0xc,%esp
+  803061:	50                   	push   %eax
+  803062:	6a 0f                	push   $0xf
+  803064:	68 0b 52 80 00       	push   $0x80520b
+  803069:	6a 3f                	push   $0x3f
+  80306b:	68 28 52 80 00       	push   $0x805228
+  803070:	e8 00 eb ff ff       	call   801b75 <_panic>
+
+00803075 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  803075:	55                   	push   %ebp
+  803076:	89 e5                	mov    %esp,%ebp
+  803078:	57                   	push   %edi
+  803079:	56                   	push   %esi
+  80307a:	53                   	push   %ebx
+  80307b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80307e:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  803085:	74 22                	je     8030a9 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  803087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80308c:	b8 12 00 00 00       	mov    $0x12,%eax
+  803091:	8b 55 08             	mov    0x8(%ebp),%edx
+  803094:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803097:	89 df                	mov    %ebx,%edi
+  803099:	89 de                	mov    %ebx,%esi
+  80309b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80309d:	85 c0                	test   %eax,%eax
+  80309f:	7f 28                	jg     8030c9 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8030a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030a4:	5b                   	pop    %ebx
+  8030a5:	5e                   	pop    %esi
+  8030a6:	5f                   	pop    %edi
+  8030a7:	5d                   	pop    %ebp
+  8030a8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8030a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030b4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8030b9:	89 df                	mov    %ebx,%edi
+  8030bb:	55                   	push   %ebp
+  8030bc:	89 e5                	mov    %esp,%ebp
+  8030be:	8d 35 c6 30 80 00    	lea    0x8030c6,%esi
+  8030c4:	0f 34                	sysenter
+  8030c6:	5d                   	pop    %ebp
+		goto out;
+  8030c7:	eb d4                	jmp    80309d <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8030c9:	83 ec 0c             	sub    $0xc,%esp
+  8030cc:	50                   	push   %eax
+  8030cd:	6a 12                	push   $0x12
+  8030cf:	68 0b 52 80 00       	push   $0x80520b
+  8030d4:	6a 3f                	push   $0x3f
+  8030d6:	68 28 52 80 00       	push   $0x805228
+  8030db:	e8 95 ea ff ff       	call   801b75 <_panic>
+
+008030e0 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8030e0:	55                   	push   %ebp
+  8030e1:	89 e5                	mov    %esp,%ebp
+  8030e3:	57                   	push   %edi
+  8030e4:	56                   	push   %esi
+  8030e5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8030e6:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  8030ed:	74 1b                	je     80310a <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8030ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030f4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8030f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030ff:	89 df                	mov    %ebx,%edi
+  803101:	89 de                	mov    %ebx,%esi
+  803103:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  803105:	5b                   	pop    %ebx
+  803106:	5e                   	pop    %esi
+  803107:	5f                   	pop    %edi
+  803108:	5d                   	pop    %ebp
+  803109:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80310a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80310f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803112:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803115:	b8 13 00 00 00       	mov    $0x13,%eax
+  80311a:	89 df                	mov    %ebx,%edi
+  80311c:	55                   	push   %ebp
+  80311d:	89 e5                	mov    %esp,%ebp
+  80311f:	8d 35 27 31 80 00    	lea    0x803127,%esi
+  803125:	0f 34                	sysenter
+  803127:	5d                   	pop    %ebp
+		goto out;
+  803128:	eb db                	jmp    803105 <sys_e1000_receive+0x25>
+
+0080312a <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80312a:	55                   	push   %ebp
+  80312b:	89 e5                	mov    %esp,%ebp
+  80312d:	57                   	push   %edi
+  80312e:	56                   	push   %esi
+  80312f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  803130:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  803137:	74 1b                	je     803154 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  803139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80313e:	b8 14 00 00 00       	mov    $0x14,%eax
+  803143:	8b 55 08             	mov    0x8(%ebp),%edx
+  803146:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803149:	89 df                	mov    %ebx,%edi
+  80314b:	89 de                	mov    %ebx,%esi
+  80314d:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80314f:	5b                   	pop    %ebx
+  803150:	5e                   	pop    %esi
+  803151:	5f                   	pop    %edi
+  803152:	5d                   	pop    %ebp
+  803153:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  803154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80315c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80315f:	b8 14 00 00 00       	mov    $0x14,%eax
+  803164:	89 df                	mov    %ebx,%edi
+  803166:	55                   	push   %ebp
+  803167:	89 e5                	mov    %esp,%ebp
+  803169:	8d 35 71 31 80 00    	lea    0x803171,%esi
+  80316f:	0f 34                	sysenter
+  803171:	5d                   	pop    %ebp
+		goto out;
+  803172:	eb db                	jmp    80314f <sys_e1000_read_hwaddr+0x25>
+
+00803174 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  803174:	55                   	push   %ebp
+  803175:	89 e5                	mov    %esp,%ebp
+  803177:	57                   	push   %edi
+  803178:	56                   	push   %esi
+  803179:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80317a:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  803181:	74 1a                	je     80319d <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  803183:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803188:	b8 15 00 00 00       	mov    $0x15,%eax
+  80318d:	8b 55 08             	mov    0x8(%ebp),%edx
+  803190:	89 cb                	mov    %ecx,%ebx
+  803192:	89 cf                	mov    %ecx,%edi
+  803194:	89 ce                	mov    %ecx,%esi
+  803196:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  803198:	5b                   	pop    %ebx
+  803199:	5e                   	pop    %esi
+  80319a:	5f                   	pop    %edi
+  80319b:	5d                   	pop    %ebp
+  80319c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80319d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8031a5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8031aa:	89 cb                	mov    %ecx,%ebx
+  8031ac:	89 cf                	mov    %ecx,%edi
+  8031ae:	55                   	push   %ebp
+  8031af:	89 e5                	mov    %esp,%ebp
+  8031b1:	8d 35 b9 31 80 00    	lea    0x8031b9,%esi
+  8031b7:	0f 34                	sysenter
+  8031b9:	5d                   	pop    %ebp
+		goto out;
+  8031ba:	eb dc                	jmp    803198 <sys_sb16_read_version+0x24>
+
+008031bc <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8031bc:	55                   	push   %ebp
+  8031bd:	89 e5                	mov    %esp,%ebp
+  8031bf:	57                   	push   %edi
+  8031c0:	56                   	push   %esi
+  8031c1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8031c2:	80 3d 14 b0 80 00 00 	cmpb   $0x0,0x80b014
+  8031c9:	74 1b                	je     8031e6 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8031cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031d0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8031d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031db:	89 df                	mov    %ebx,%edi
+  8031dd:	89 de                	mov    %ebx,%esi
+  8031df:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8031e1:	5b                   	pop    %ebx
+  8031e2:	5e                   	pop    %esi
+  8031e3:	5f                   	pop    %edi
+  8031e4:	5d                   	pop    %ebp
+  8031e5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8031e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8031ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031f1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8031f6:	89 df                	mov    %ebx,%edi
+  8031f8:	55                   	push   %ebp
+  8031f9:	89 e5                	mov    %esp,%ebp
+  8031fb:	8d 35 03 32 80 00    	lea    0x803203,%esi
+  803201:	0f 34                	sysenter
+  803203:	5d                   	pop    %ebp
+		goto out;
+  803204:	eb db                	jmp    8031e1 <sys_sb16_play+0x25>
+
+00803206 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803206:	55                   	push   %ebp
+  803207:	89 e5                	mov    %esp,%ebp
+  803209:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  80320c:	83 3d 18 b0 80 00 00 	cmpl   $0x0,0x80b018
+  803213:	74 0a                	je     80321f <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803215:	8b 45 08             	mov    0x8(%ebp),%eax
+  803218:	a3 18 b0 80 00       	mov    %eax,0x80b018
+}
+  80321d:	c9                   	leave
+  80321e:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  80321f:	83 ec 04             	sub    $0x4,%esp
+  803222:	6a 07                	push   $0x7
+  803224:	68 00 f0 bf ee       	push   $0xeebff000
+  803229:	6a 00                	push   $0x0
+  80322b:	e8 60 f5 ff ff       	call   802790 <sys_page_alloc>
+  803230:	83 c4 10             	add    $0x10,%esp
+  803233:	85 c0                	test   %eax,%eax
+  803235:	78 14                	js     80324b <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803237:	83 ec 08             	sub    $0x8,%esp
+  80323a:	68 6d 32 80 00       	push   $0x80326d
+  80323f:	6a 00                	push   $0x0
+  803241:	e8 66 f7 ff ff       	call   8029ac <sys_env_set_pgfault_upcall>
+  803246:	83 c4 10             	add    $0x10,%esp
+  803249:	eb ca                	jmp    803215 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  80324b:	83 ec 08             	sub    $0x8,%esp
+  80324e:	50                   	push   %eax
+  80324f:	68 36 52 80 00       	push   $0x805236
+  803254:	e8 f7 e9 ff ff       	call   801c50 <cprintf>
+			panic("set_pgfault_handler error");
+  803259:	83 c4 0c             	add    $0xc,%esp
+  80325c:	68 41 52 80 00       	push   $0x805241
+  803261:	6a 24                	push   $0x24
+  803263:	68 5b 52 80 00       	push   $0x80525b
+  803268:	e8 08 e9 ff ff       	call   801b75 <_panic>
+
+0080326d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80326d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80326e:	a1 18 b0 80 00       	mov    0x80b018,%eax
+	call *%eax
+  803273:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803275:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803278:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80327c:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  80327f:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803283:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803285:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803289:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  80328a:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  80328e:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  80328f:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803290:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803294:	c3                   	ret
+
+00803295 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  803295:	55                   	push   %ebp
+  803296:	89 e5                	mov    %esp,%ebp
+  803298:	56                   	push   %esi
+  803299:	53                   	push   %ebx
+  80329a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80329d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8032a3:	85 c0                	test   %eax,%eax
+  8032a5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8032aa:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8032ad:	83 ec 08             	sub    $0x8,%esp
+  8032b0:	ff 75 14             	push   0x14(%ebp)
+  8032b3:	50                   	push   %eax
+  8032b4:	e8 e8 f8 ff ff       	call   802ba1 <sys_ipc_recv_until>
+  8032b9:	83 c4 10             	add    $0x10,%esp
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	78 61                	js     803321 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8032c0:	85 f6                	test   %esi,%esi
+  8032c2:	74 1c                	je     8032e0 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8032c4:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8032c6:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8032cb:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8032d1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8032d6:	76 5f                	jbe    803337 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8032d8:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8032de:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8032e0:	85 db                	test   %ebx,%ebx
+  8032e2:	74 1c                	je     803300 <ipc_recv_until+0x6b>
+  8032e4:	89 e0                	mov    %esp,%eax
+  8032e6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8032eb:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8032f1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8032f6:	76 50                	jbe    803348 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8032f8:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8032fe:	89 03                	mov    %eax,(%ebx)
+  803300:	89 e0                	mov    %esp,%eax
+  803302:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803307:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80330d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803312:	76 45                	jbe    803359 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803314:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80331a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80331d:	5b                   	pop    %ebx
+  80331e:	5e                   	pop    %esi
+  80331f:	5d                   	pop    %ebp
+  803320:	c3                   	ret
+		if (from_env_store)
+  803321:	85 f6                	test   %esi,%esi
+  803323:	74 06                	je     80332b <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803325:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  80332b:	85 db                	test   %ebx,%ebx
+  80332d:	74 eb                	je     80331a <ipc_recv_until+0x85>
+			*perm_store = 0;
+  80332f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803335:	eb e3                	jmp    80331a <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803337:	c1 e8 10             	shr    $0x10,%eax
+  80333a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803340:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803346:	eb 90                	jmp    8032d8 <ipc_recv_until+0x43>
+  803348:	c1 e8 10             	shr    $0x10,%eax
+  80334b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803351:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803357:	eb 9f                	jmp    8032f8 <ipc_recv_until+0x63>
+  803359:	c1 e8 10             	shr    $0x10,%eax
+  80335c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803362:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803368:	eb aa                	jmp    803314 <ipc_recv_until+0x7f>
+
+0080336a <ipc_recv>:
+{
+  80336a:	55                   	push   %ebp
+  80336b:	89 e5                	mov    %esp,%ebp
+  80336d:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803370:	6a 00                	push   $0x0
+  803372:	ff 75 10             	push   0x10(%ebp)
+  803375:	ff 75 0c             	push   0xc(%ebp)
+  803378:	ff 75 08             	push   0x8(%ebp)
+  80337b:	e8 15 ff ff ff       	call   803295 <ipc_recv_until>
+}
+  803380:	c9                   	leave
+  803381:	c3                   	ret
+
+00803382 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803382:	55                   	push   %ebp
+  803383:	89 e5                	mov    %esp,%ebp
+  803385:	57                   	push   %edi
+  803386:	56                   	push   %esi
+  803387:	53                   	push   %ebx
+  803388:	83 ec 0c             	sub    $0xc,%esp
+  80338b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80338e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803391:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803394:	85 db                	test   %ebx,%ebx
+  803396:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80339b:	0f 44 d8             	cmove  %eax,%ebx
+  80339e:	eb 05                	jmp    8033a5 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8033a0:	e8 a5 f3 ff ff       	call   80274a <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8033a5:	ff 75 14             	push   0x14(%ebp)
+  8033a8:	53                   	push   %ebx
+  8033a9:	56                   	push   %esi
+  8033aa:	57                   	push   %edi
+  8033ab:	e8 3d f7 ff ff       	call   802aed <sys_ipc_try_send>
+  8033b0:	83 c4 10             	add    $0x10,%esp
+  8033b3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033b6:	74 e8                	je     8033a0 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8033b8:	85 c0                	test   %eax,%eax
+  8033ba:	78 08                	js     8033c4 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8033bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033bf:	5b                   	pop    %ebx
+  8033c0:	5e                   	pop    %esi
+  8033c1:	5f                   	pop    %edi
+  8033c2:	5d                   	pop    %ebp
+  8033c3:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8033c4:	50                   	push   %eax
+  8033c5:	68 69 52 80 00       	push   $0x805269
+  8033ca:	6a 4f                	push   $0x4f
+  8033cc:	68 7c 52 80 00       	push   $0x80527c
+  8033d1:	e8 9f e7 ff ff       	call   801b75 <_panic>
+
+008033d6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033d6:	55                   	push   %ebp
+  8033d7:	89 e5                	mov    %esp,%ebp
+  8033d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8033dc:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8033e1:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8033e7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8033ed:	8b 52 50             	mov    0x50(%edx),%edx
+  8033f0:	39 ca                	cmp    %ecx,%edx
+  8033f2:	74 11                	je     803405 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8033f4:	83 c0 01             	add    $0x1,%eax
+  8033f7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8033fc:	75 e3                	jne    8033e1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8033fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803403:	eb 0e                	jmp    803413 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803405:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80340b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803410:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803413:	5d                   	pop    %ebp
+  803414:	c3                   	ret
+
+00803415 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  803415:	55                   	push   %ebp
+  803416:	89 e5                	mov    %esp,%ebp
+  803418:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  80341b:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  803422:	00 00 00 
+	b->b_error = 0;
+  803425:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  80342c:	00 00 00 
+}
+  80342f:	5d                   	pop    %ebp
+  803430:	c3                   	ret
+
+00803431 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  803431:	55                   	push   %ebp
+  803432:	89 e5                	mov    %esp,%ebp
+  803434:	53                   	push   %ebx
+  803435:	83 ec 04             	sub    $0x4,%esp
+  803438:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  80343b:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  803441:	85 c0                	test   %eax,%eax
+  803443:	7e 09                	jle    80344e <batch_flush+0x1d>
+  803445:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  80344c:	74 15                	je     803463 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  80344e:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  803455:	00 00 00 
+	return b->b_error;
+  803458:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  80345e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803461:	c9                   	leave
+  803462:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  803463:	83 ec 08             	sub    $0x8,%esp
+  803466:	50                   	push   %eax
+  803467:	53                   	push   %ebx
+  803468:	e8 09 fa ff ff       	call   802e76 <sys_batch>
+  80346d:	83 c4 10             	add    $0x10,%esp
+  803470:	85 c0                	test   %eax,%eax
+  803472:	79 da                	jns    80344e <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  803474:	f7 d8                	neg    %eax
+  803476:	0f b6 c0             	movzbl %al,%eax
+  803479:	f7 d8                	neg    %eax
+  80347b:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  803481:	eb cb                	jmp    80344e <batch_flush+0x1d>
+
+00803483 <batch_reserve>:
+{
+  803483:	55                   	push   %ebp
+  803484:	89 e5                	mov    %esp,%ebp
+  803486:	83 ec 08             	sub    $0x8,%esp
+  803489:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  80348c:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  803492:	03 45 0c             	add    0xc(%ebp),%eax
+  803495:	83 f8 10             	cmp    $0x10,%eax
+  803498:	7f 02                	jg     80349c <batch_reserve+0x19>
+}
+  80349a:	c9                   	leave
+  80349b:	c3                   	ret
+		batch_flush(b);
+  80349c:	83 ec 0c             	sub    $0xc,%esp
+  80349f:	52                   	push   %edx
+  8034a0:	e8 8c ff ff ff       	call   803431 <batch_flush>
+  8034a5:	83 c4 10             	add    $0x10,%esp
+}
+  8034a8:	eb f0                	jmp    80349a <batch_reserve+0x17>
+
+008034aa <batch_next>:
+{
+  8034aa:	55                   	push   %ebp
+  8034ab:	89 e5                	mov    %esp,%ebp
+  8034ad:	53                   	push   %ebx
+  8034ae:	83 ec 04             	sub    $0x4,%esp
+  8034b1:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  8034b3:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  8034ba:	74 28                	je     8034e4 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  8034bc:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8034c2:	8d 50 01             	lea    0x1(%eax),%edx
+  8034c5:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  8034cb:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8034ce:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  8034d0:	83 ec 04             	sub    $0x4,%esp
+  8034d3:	6a 1c                	push   $0x1c
+  8034d5:	6a 00                	push   $0x0
+  8034d7:	53                   	push   %ebx
+  8034d8:	e8 0c ef ff ff       	call   8023e9 <memset>
+}
+  8034dd:	89 d8                	mov    %ebx,%eax
+  8034df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034e2:	c9                   	leave
+  8034e3:	c3                   	ret
+		batch_flush(b);
+  8034e4:	83 ec 0c             	sub    $0xc,%esp
+  8034e7:	50                   	push   %eax
+  8034e8:	e8 44 ff ff ff       	call   803431 <batch_flush>
+  8034ed:	83 c4 10             	add    $0x10,%esp
+  8034f0:	eb ca                	jmp    8034bc <batch_next+0x12>
+
+008034f2 <batch_page>:
+{
+  8034f2:	55                   	push   %ebp
+  8034f3:	89 e5                	mov    %esp,%ebp
+  8034f5:	57                   	push   %edi
+  8034f6:	56                   	push   %esi
+  8034f7:	53                   	push   %ebx
+  8034f8:	83 ec 1c             	sub    $0x1c,%esp
+  8034fb:	89 d3                	mov    %edx,%ebx
+  8034fd:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  8034ff:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  803505:	85 d2                	test   %edx,%edx
+  803507:	74 50                	je     803559 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  803509:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  80350c:	01 c1                	add    %eax,%ecx
+  80350e:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  803511:	75 46                	jne    803559 <batch_page+0x67>
+  803513:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  803516:	75 41                	jne    803559 <batch_page+0x67>
+  803518:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  80351b:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  80351e:	75 39                	jne    803559 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  803520:	83 ea 01             	sub    $0x1,%edx
+  803523:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  803526:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  803529:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  80352d:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  803530:	75 27                	jne    803559 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  803532:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  803535:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  803539:	89 fa                	mov    %edi,%edx
+  80353b:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  80353e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803541:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  803544:	39 55 08             	cmp    %edx,0x8(%ebp)
+  803547:	75 10                	jne    803559 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  803549:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  80354d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803550:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  803554:	39 55 10             	cmp    %edx,0x10(%ebp)
+  803557:	74 2a                	je     803583 <batch_page+0x91>
+	op = batch_next(b);
+  803559:	e8 4c ff ff ff       	call   8034aa <batch_next>
+	op->bo_op = opcode;
+  80355e:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  803560:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  803563:	8b 75 08             	mov    0x8(%ebp),%esi
+  803566:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  803569:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80356c:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  80356f:	8b 75 10             	mov    0x10(%ebp),%esi
+  803572:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  803575:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803578:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  80357b:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80357e:	89 78 14             	mov    %edi,0x14(%eax)
+  803581:	eb 0b                	jmp    80358e <batch_page+0x9c>
+		op->bo_npages += npages;
+  803583:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  803587:	03 7d 18             	add    0x18(%ebp),%edi
+  80358a:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  80358e:	83 c4 1c             	add    $0x1c,%esp
+  803591:	5b                   	pop    %ebx
+  803592:	5e                   	pop    %esi
+  803593:	5f                   	pop    %edi
+  803594:	5d                   	pop    %ebp
+  803595:	c3                   	ret
+
+00803596 <batch_alloc>:
+{
+  803596:	55                   	push   %ebp
+  803597:	89 e5                	mov    %esp,%ebp
+  803599:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  80359c:	ff 75 18             	push   0x18(%ebp)
+  80359f:	ff 75 14             	push   0x14(%ebp)
+  8035a2:	ff 75 10             	push   0x10(%ebp)
+  8035a5:	ff 75 0c             	push   0xc(%ebp)
+  8035a8:	6a 00                	push   $0x0
+  8035aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b7:	e8 36 ff ff ff       	call   8034f2 <batch_page>
+}
+  8035bc:	83 c4 20             	add    $0x20,%esp
+  8035bf:	c9                   	leave
+  8035c0:	c3                   	ret
+
+008035c1 <batch_map>:
+{
+  8035c1:	55                   	push   %ebp
+  8035c2:	89 e5                	mov    %esp,%ebp
+  8035c4:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  8035c7:	ff 75 20             	push   0x20(%ebp)
+  8035ca:	ff 75 1c             	push   0x1c(%ebp)
+  8035cd:	ff 75 18             	push   0x18(%ebp)
+  8035d0:	ff 75 14             	push   0x14(%ebp)
+  8035d3:	ff 75 10             	push   0x10(%ebp)
+  8035d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8035d9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035e1:	e8 0c ff ff ff       	call   8034f2 <batch_page>
+}
+  8035e6:	83 c4 20             	add    $0x20,%esp
+  8035e9:	c9                   	leave
+  8035ea:	c3                   	ret
+
+008035eb <batch_unmap>:
+{
+  8035eb:	55                   	push   %ebp
+  8035ec:	89 e5                	mov    %esp,%ebp
+  8035ee:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  8035f1:	ff 75 14             	push   0x14(%ebp)
+  8035f4:	6a 00                	push   $0x0
+  8035f6:	ff 75 10             	push   0x10(%ebp)
+  8035f9:	ff 75 0c             	push   0xc(%ebp)
+  8035fc:	6a 00                	push   $0x0
+  8035fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803603:	ba 02 00 00 00       	mov    $0x2,%edx
+  803608:	8b 45 08             	mov    0x8(%ebp),%eax
+  80360b:	e8 e2 fe ff ff       	call   8034f2 <batch_page>
+}
+  803610:	83 c4 20             	add    $0x20,%esp
+  803613:	c9                   	leave
+  803614:	c3                   	ret
+
+00803615 <batch_set_status>:
+{
+  803615:	55                   	push   %ebp
+  803616:	89 e5                	mov    %esp,%ebp
+  803618:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  80361b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80361e:	e8 87 fe ff ff       	call   8034aa <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  803623:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  803629:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80362c:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  80362f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803632:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  803635:	c9                   	leave
+  803636:	c3                   	ret
+
+00803637 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  803637:	55                   	push   %ebp
+  803638:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80363a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80363d:	05 00 00 00 30       	add    $0x30000000,%eax
+  803642:	c1 e8 0c             	shr    $0xc,%eax
+}
+  803645:	5d                   	pop    %ebp
+  803646:	c3                   	ret
+
+00803647 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803647:	55                   	push   %ebp
+  803648:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80364a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80364d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  803652:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803657:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80365c:	5d                   	pop    %ebp
+  80365d:	c3                   	ret
+
+0080365e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80365e:	55                   	push   %ebp
+  80365f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803661:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803666:	eb 02                	jmp    80366a <fd_alloc+0xc>
+  803668:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80366a:	89 c2                	mov    %eax,%edx
+  80366c:	c1 ea 16             	shr    $0x16,%edx
+  80366f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803676:	f6 c2 01             	test   $0x1,%dl
+  803679:	74 2b                	je     8036a6 <fd_alloc+0x48>
+  80367b:	89 c2                	mov    %eax,%edx
+  80367d:	c1 ea 0c             	shr    $0xc,%edx
+  803680:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  803687:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80368d:	f6 c1 01             	test   $0x1,%cl
+  803690:	74 14                	je     8036a6 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  803692:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  803698:	75 ce                	jne    803668 <fd_alloc+0xa>
+  80369a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80369f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8036a4:	eb 05                	jmp    8036ab <fd_alloc+0x4d>
+			return 0;
+  8036a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8036ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8036ae:	89 02                	mov    %eax,(%edx)
+}
+  8036b0:	89 c8                	mov    %ecx,%eax
+  8036b2:	5d                   	pop    %ebp
+  8036b3:	c3                   	ret
+
+008036b4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8036b4:	55                   	push   %ebp
+  8036b5:	89 e5                	mov    %esp,%ebp
+  8036b7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8036ba:	83 f8 1f             	cmp    $0x1f,%eax
+  8036bd:	77 30                	ja     8036ef <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8036bf:	c1 e0 0c             	shl    $0xc,%eax
+  8036c2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8036c7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8036cd:	f6 c2 01             	test   $0x1,%dl
+  8036d0:	74 24                	je     8036f6 <fd_lookup+0x42>
+  8036d2:	89 c2                	mov    %eax,%edx
+  8036d4:	c1 ea 0c             	shr    $0xc,%edx
+  8036d7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8036de:	f6 c2 01             	test   $0x1,%dl
+  8036e1:	74 1a                	je     8036fd <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8036e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036e6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8036e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036ed:	5d                   	pop    %ebp
+  8036ee:	c3                   	ret
+		return -E_INVAL;
+  8036ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036f4:	eb f7                	jmp    8036ed <fd_lookup+0x39>
+		return -E_INVAL;
+  8036f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036fb:	eb f0                	jmp    8036ed <fd_lookup+0x39>
+  8036fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803702:	eb e9                	jmp    8036ed <fd_lookup+0x39>
+
+00803704 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803704:	55                   	push   %ebp
+  803705:	89 e5                	mov    %esp,%ebp
+  803707:	53                   	push   %ebx
+  803708:	83 ec 04             	sub    $0x4,%esp
+  80370b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80370e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803713:	eb 03                	jmp    803718 <dev_lookup+0x14>
+  803715:	83 c0 01             	add    $0x1,%eax
+  803718:	8b 1c 85 04 53 80 00 	mov    0x805304(,%eax,4),%ebx
+  80371f:	85 db                	test   %ebx,%ebx
+  803721:	74 0b                	je     80372e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  803723:	39 13                	cmp    %edx,(%ebx)
+  803725:	75 ee                	jne    803715 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  803727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372c:	eb 2e                	jmp    80375c <dev_lookup+0x58>
+  80372e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803730:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803735:	8b 0d 10 b0 80 00    	mov    0x80b010,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80373b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803740:	76 24                	jbe    803766 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803742:	8b 41 48             	mov    0x48(%ecx),%eax
+  803745:	83 ec 04             	sub    $0x4,%esp
+  803748:	52                   	push   %edx
+  803749:	50                   	push   %eax
+  80374a:	68 88 52 80 00       	push   $0x805288
+  80374f:	e8 fc e4 ff ff       	call   801c50 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  803754:	83 c4 10             	add    $0x10,%esp
+  803757:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80375c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80375f:	89 1a                	mov    %ebx,(%edx)
+}
+  803761:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803764:	c9                   	leave
+  803765:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803766:	c1 e8 10             	shr    $0x10,%eax
+  803769:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80376f:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  803775:	eb cb                	jmp    803742 <dev_lookup+0x3e>
+
+00803777 <fd_close>:
+{
+  803777:	55                   	push   %ebp
+  803778:	89 e5                	mov    %esp,%ebp
+  80377a:	57                   	push   %edi
+  80377b:	56                   	push   %esi
+  80377c:	53                   	push   %ebx
+  80377d:	83 ec 24             	sub    $0x24,%esp
+  803780:	8b 75 08             	mov    0x8(%ebp),%esi
+  803783:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803786:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803789:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80378a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  803790:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803793:	50                   	push   %eax
+  803794:	e8 1b ff ff ff       	call   8036b4 <fd_lookup>
+  803799:	89 c3                	mov    %eax,%ebx
+  80379b:	83 c4 10             	add    $0x10,%esp
+  80379e:	85 c0                	test   %eax,%eax
+  8037a0:	78 05                	js     8037a7 <fd_close+0x30>
+	    || fd != fd2)
+  8037a2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8037a5:	74 16                	je     8037bd <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8037a7:	89 f8                	mov    %edi,%eax
+  8037a9:	84 c0                	test   %al,%al
+  8037ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8037b3:	89 d8                	mov    %ebx,%eax
+  8037b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b8:	5b                   	pop    %ebx
+  8037b9:	5e                   	pop    %esi
+  8037ba:	5f                   	pop    %edi
+  8037bb:	5d                   	pop    %ebp
+  8037bc:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8037bd:	83 ec 08             	sub    $0x8,%esp
+  8037c0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8037c3:	50                   	push   %eax
+  8037c4:	ff 36                	push   (%esi)
+  8037c6:	e8 39 ff ff ff       	call   803704 <dev_lookup>
+  8037cb:	89 c3                	mov    %eax,%ebx
+  8037cd:	83 c4 10             	add    $0x10,%esp
+  8037d0:	85 c0                	test   %eax,%eax
+  8037d2:	78 1a                	js     8037ee <fd_close+0x77>
+		if (dev->dev_close)
+  8037d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8037d7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8037da:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8037df:	85 c0                	test   %eax,%eax
+  8037e1:	74 0b                	je     8037ee <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8037e3:	83 ec 0c             	sub    $0xc,%esp
+  8037e6:	56                   	push   %esi
+  8037e7:	ff d0                	call   *%eax
+  8037e9:	89 c3                	mov    %eax,%ebx
+  8037eb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8037ee:	83 ec 08             	sub    $0x8,%esp
+  8037f1:	56                   	push   %esi
+  8037f2:	6a 00                	push   $0x0
+  8037f4:	e8 72 f0 ff ff       	call   80286b <sys_page_unmap>
+	return r;
+  8037f9:	83 c4 10             	add    $0x10,%esp
+  8037fc:	eb b5                	jmp    8037b3 <fd_close+0x3c>
+
+008037fe <close>:
+
+int
+close(int fdnum)
+{
+  8037fe:	55                   	push   %ebp
+  8037ff:	89 e5                	mov    %esp,%ebp
+  803801:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803804:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803807:	50                   	push   %eax
+  803808:	ff 75 08             	push   0x8(%ebp)
+  80380b:	e8 a4 fe ff ff       	call   8036b4 <fd_lookup>
+  803810:	83 c4 10             	add    $0x10,%esp
+  803813:	85 c0                	test   %eax,%eax
+  803815:	79 02                	jns    803819 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  803817:	c9                   	leave
+  803818:	c3                   	ret
+		return fd_close(fd, 1);
+  803819:	83 ec 08             	sub    $0x8,%esp
+  80381c:	6a 01                	push   $0x1
+  80381e:	ff 75 f4             	push   -0xc(%ebp)
+  803821:	e8 51 ff ff ff       	call   803777 <fd_close>
+  803826:	83 c4 10             	add    $0x10,%esp
+  803829:	eb ec                	jmp    803817 <close+0x19>
+
+0080382b <close_all>:
+
+void
+close_all(void)
+{
+  80382b:	55                   	push   %ebp
+  80382c:	89 e5                	mov    %esp,%ebp
+  80382e:	53                   	push   %ebx
+  80382f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803832:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  803837:	83 ec 0c             	sub    $0xc,%esp
+  80383a:	53                   	push   %ebx
+  80383b:	e8 be ff ff ff       	call   8037fe <close>
+	for (i = 0; i < MAXFD; i++)
+  803840:	83 c3 01             	add    $0x1,%ebx
+  803843:	83 c4 10             	add    $0x10,%esp
+  803846:	83 fb 20             	cmp    $0x20,%ebx
+  803849:	75 ec                	jne    803837 <close_all+0xc>
+}
+  80384b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80384e:	c9                   	leave
+  80384f:	c3                   	ret
+
+00803850 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803850:	55                   	push   %ebp
+  803851:	89 e5                	mov    %esp,%ebp
+  803853:	57                   	push   %edi
+  803854:	56                   	push   %esi
+  803855:	53                   	push   %ebx
+  803856:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803859:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80385c:	50                   	push   %eax
+  80385d:	ff 75 08             	push   0x8(%ebp)
+  803860:	e8 4f fe ff ff       	call   8036b4 <fd_lookup>
+  803865:	89 c3                	mov    %eax,%ebx
+  803867:	83 c4 10             	add    $0x10,%esp
+  80386a:	85 c0                	test   %eax,%eax
+  80386c:	78 7f                	js     8038ed <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80386e:	83 ec 0c             	sub    $0xc,%esp
+  803871:	ff 75 0c             	push   0xc(%ebp)
+  803874:	e8 85 ff ff ff       	call   8037fe <close>
+
+	newfd = INDEX2FD(newfdnum);
+  803879:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80387c:	c1 e6 0c             	shl    $0xc,%esi
+  80387f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  803885:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803888:	89 3c 24             	mov    %edi,(%esp)
+  80388b:	e8 b7 fd ff ff       	call   803647 <fd2data>
+  803890:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  803892:	89 34 24             	mov    %esi,(%esp)
+  803895:	e8 ad fd ff ff       	call   803647 <fd2data>
+  80389a:	83 c4 10             	add    $0x10,%esp
+  80389d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8038a0:	89 d8                	mov    %ebx,%eax
+  8038a2:	c1 e8 16             	shr    $0x16,%eax
+  8038a5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8038ac:	a8 01                	test   $0x1,%al
+  8038ae:	74 11                	je     8038c1 <dup+0x71>
+  8038b0:	89 d8                	mov    %ebx,%eax
+  8038b2:	c1 e8 0c             	shr    $0xc,%eax
+  8038b5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8038bc:	f6 c2 01             	test   $0x1,%dl
+  8038bf:	75 36                	jne    8038f7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8038c1:	89 f8                	mov    %edi,%eax
+  8038c3:	c1 e8 0c             	shr    $0xc,%eax
+  8038c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8038cd:	83 ec 0c             	sub    $0xc,%esp
+  8038d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8038d5:	50                   	push   %eax
+  8038d6:	56                   	push   %esi
+  8038d7:	6a 00                	push   $0x0
+  8038d9:	57                   	push   %edi
+  8038da:	6a 00                	push   $0x0
+  8038dc:	e8 1c ef ff ff       	call   8027fd <sys_page_map>
+  8038e1:	89 c3                	mov    %eax,%ebx
+  8038e3:	83 c4 20             	add    $0x20,%esp
+  8038e6:	85 c0                	test   %eax,%eax
+  8038e8:	78 33                	js     80391d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8038ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8038ed:	89 d8                	mov    %ebx,%eax
+  8038ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038f2:	5b                   	pop    %ebx
+  8038f3:	5e                   	pop    %esi
+  8038f4:	5f                   	pop    %edi
+  8038f5:	5d                   	pop    %ebp
+  8038f6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8038f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8038fe:	83 ec 0c             	sub    $0xc,%esp
+  803901:	25 07 0e 00 00       	and    $0xe07,%eax
+  803906:	50                   	push   %eax
+  803907:	ff 75 d4             	push   -0x2c(%ebp)
+  80390a:	6a 00                	push   $0x0
+  80390c:	53                   	push   %ebx
+  80390d:	6a 00                	push   $0x0
+  80390f:	e8 e9 ee ff ff       	call   8027fd <sys_page_map>
+  803914:	89 c3                	mov    %eax,%ebx
+  803916:	83 c4 20             	add    $0x20,%esp
+  803919:	85 c0                	test   %eax,%eax
+  80391b:	79 a4                	jns    8038c1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80391d:	83 ec 08             	sub    $0x8,%esp
+  803920:	56                   	push   %esi
+  803921:	6a 00                	push   $0x0
+  803923:	e8 43 ef ff ff       	call   80286b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  803928:	83 c4 08             	add    $0x8,%esp
+  80392b:	ff 75 d4             	push   -0x2c(%ebp)
+  80392e:	6a 00                	push   $0x0
+  803930:	e8 36 ef ff ff       	call   80286b <sys_page_unmap>
+	return r;
+  803935:	83 c4 10             	add    $0x10,%esp
+  803938:	eb b3                	jmp    8038ed <dup+0x9d>
+
+0080393a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80393a:	55                   	push   %ebp
+  80393b:	89 e5                	mov    %esp,%ebp
+  80393d:	56                   	push   %esi
+  80393e:	53                   	push   %ebx
+  80393f:	83 ec 18             	sub    $0x18,%esp
+  803942:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803945:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803948:	50                   	push   %eax
+  803949:	53                   	push   %ebx
+  80394a:	e8 65 fd ff ff       	call   8036b4 <fd_lookup>
+  80394f:	83 c4 10             	add    $0x10,%esp
+  803952:	85 c0                	test   %eax,%eax
+  803954:	78 3c                	js     803992 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803956:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803959:	83 ec 08             	sub    $0x8,%esp
+  80395c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80395f:	50                   	push   %eax
+  803960:	ff 36                	push   (%esi)
+  803962:	e8 9d fd ff ff       	call   803704 <dev_lookup>
+  803967:	83 c4 10             	add    $0x10,%esp
+  80396a:	85 c0                	test   %eax,%eax
+  80396c:	78 24                	js     803992 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80396e:	8b 46 08             	mov    0x8(%esi),%eax
+  803971:	83 e0 03             	and    $0x3,%eax
+  803974:	83 f8 01             	cmp    $0x1,%eax
+  803977:	74 20                	je     803999 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  803979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80397c:	8b 40 08             	mov    0x8(%eax),%eax
+  80397f:	85 c0                	test   %eax,%eax
+  803981:	74 57                	je     8039da <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  803983:	83 ec 04             	sub    $0x4,%esp
+  803986:	ff 75 10             	push   0x10(%ebp)
+  803989:	ff 75 0c             	push   0xc(%ebp)
+  80398c:	56                   	push   %esi
+  80398d:	ff d0                	call   *%eax
+  80398f:	83 c4 10             	add    $0x10,%esp
+}
+  803992:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803995:	5b                   	pop    %ebx
+  803996:	5e                   	pop    %esi
+  803997:	5d                   	pop    %ebp
+  803998:	c3                   	ret
+  803999:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80399b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8039a0:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8039a6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8039ab:	76 1c                	jbe    8039c9 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8039ad:	8b 42 48             	mov    0x48(%edx),%eax
+  8039b0:	83 ec 04             	sub    $0x4,%esp
+  8039b3:	53                   	push   %ebx
+  8039b4:	50                   	push   %eax
+  8039b5:	68 c9 52 80 00       	push   $0x8052c9
+  8039ba:	e8 91 e2 ff ff       	call   801c50 <cprintf>
+		return -E_INVAL;
+  8039bf:	83 c4 10             	add    $0x10,%esp
+  8039c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039c7:	eb c9                	jmp    803992 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8039c9:	c1 e8 10             	shr    $0x10,%eax
+  8039cc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8039d2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8039d8:	eb d3                	jmp    8039ad <read+0x73>
+		return -E_NOT_SUPP;
+  8039da:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8039df:	eb b1                	jmp    803992 <read+0x58>
+
+008039e1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8039e1:	55                   	push   %ebp
+  8039e2:	89 e5                	mov    %esp,%ebp
+  8039e4:	57                   	push   %edi
+  8039e5:	56                   	push   %esi
+  8039e6:	53                   	push   %ebx
+  8039e7:	83 ec 0c             	sub    $0xc,%esp
+  8039ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039ed:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8039f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039f5:	eb 02                	jmp    8039f9 <readn+0x18>
+  8039f7:	01 c3                	add    %eax,%ebx
+  8039f9:	39 f3                	cmp    %esi,%ebx
+  8039fb:	73 21                	jae    803a1e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8039fd:	83 ec 04             	sub    $0x4,%esp
+  803a00:	89 f0                	mov    %esi,%eax
+  803a02:	29 d8                	sub    %ebx,%eax
+  803a04:	50                   	push   %eax
+  803a05:	89 d8                	mov    %ebx,%eax
+  803a07:	03 45 0c             	add    0xc(%ebp),%eax
+  803a0a:	50                   	push   %eax
+  803a0b:	57                   	push   %edi
+  803a0c:	e8 29 ff ff ff       	call   80393a <read>
+		if (m < 0)
+  803a11:	83 c4 10             	add    $0x10,%esp
+  803a14:	85 c0                	test   %eax,%eax
+  803a16:	78 04                	js     803a1c <readn+0x3b>
+			return m;
+		if (m == 0)
+  803a18:	75 dd                	jne    8039f7 <readn+0x16>
+  803a1a:	eb 02                	jmp    803a1e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803a1c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  803a1e:	89 d8                	mov    %ebx,%eax
+  803a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a23:	5b                   	pop    %ebx
+  803a24:	5e                   	pop    %esi
+  803a25:	5f                   	pop    %edi
+  803a26:	5d                   	pop    %ebp
+  803a27:	c3                   	ret
+
+00803a28 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803a28:	55                   	push   %ebp
+  803a29:	89 e5                	mov    %esp,%ebp
+  803a2b:	56                   	push   %esi
+  803a2c:	53                   	push   %ebx
+  803a2d:	83 ec 18             	sub    $0x18,%esp
+  803a30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803a33:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803a36:	50                   	push   %eax
+  803a37:	53                   	push   %ebx
+  803a38:	e8 77 fc ff ff       	call   8036b4 <fd_lookup>
+  803a3d:	83 c4 10             	add    $0x10,%esp
+  803a40:	85 c0                	test   %eax,%eax
+  803a42:	78 37                	js     803a7b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803a44:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803a47:	83 ec 08             	sub    $0x8,%esp
+  803a4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a4d:	50                   	push   %eax
+  803a4e:	ff 36                	push   (%esi)
+  803a50:	e8 af fc ff ff       	call   803704 <dev_lookup>
+  803a55:	83 c4 10             	add    $0x10,%esp
+  803a58:	85 c0                	test   %eax,%eax
+  803a5a:	78 1f                	js     803a7b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803a5c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  803a60:	74 20                	je     803a82 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803a62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a65:	8b 40 0c             	mov    0xc(%eax),%eax
+  803a68:	85 c0                	test   %eax,%eax
+  803a6a:	74 57                	je     803ac3 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  803a6c:	83 ec 04             	sub    $0x4,%esp
+  803a6f:	ff 75 10             	push   0x10(%ebp)
+  803a72:	ff 75 0c             	push   0xc(%ebp)
+  803a75:	56                   	push   %esi
+  803a76:	ff d0                	call   *%eax
+  803a78:	83 c4 10             	add    $0x10,%esp
+}
+  803a7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a7e:	5b                   	pop    %ebx
+  803a7f:	5e                   	pop    %esi
+  803a80:	5d                   	pop    %ebp
+  803a81:	c3                   	ret
+  803a82:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803a84:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803a89:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803a8f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803a94:	76 1c                	jbe    803ab2 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803a96:	8b 42 48             	mov    0x48(%edx),%eax
+  803a99:	83 ec 04             	sub    $0x4,%esp
+  803a9c:	53                   	push   %ebx
+  803a9d:	50                   	push   %eax
+  803a9e:	68 e5 52 80 00       	push   $0x8052e5
+  803aa3:	e8 a8 e1 ff ff       	call   801c50 <cprintf>
+		return -E_INVAL;
+  803aa8:	83 c4 10             	add    $0x10,%esp
+  803aab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ab0:	eb c9                	jmp    803a7b <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803ab2:	c1 e8 10             	shr    $0x10,%eax
+  803ab5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803abb:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803ac1:	eb d3                	jmp    803a96 <write+0x6e>
+		return -E_NOT_SUPP;
+  803ac3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ac8:	eb b1                	jmp    803a7b <write+0x53>
+
+00803aca <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803aca:	55                   	push   %ebp
+  803acb:	89 e5                	mov    %esp,%ebp
+  803acd:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ad0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ad3:	50                   	push   %eax
+  803ad4:	ff 75 08             	push   0x8(%ebp)
+  803ad7:	e8 d8 fb ff ff       	call   8036b4 <fd_lookup>
+  803adc:	83 c4 10             	add    $0x10,%esp
+  803adf:	85 c0                	test   %eax,%eax
+  803ae1:	78 0e                	js     803af1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  803ae3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ae6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ae9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  803aec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803af1:	c9                   	leave
+  803af2:	c3                   	ret
+
+00803af3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803af3:	55                   	push   %ebp
+  803af4:	89 e5                	mov    %esp,%ebp
+  803af6:	56                   	push   %esi
+  803af7:	53                   	push   %ebx
+  803af8:	83 ec 18             	sub    $0x18,%esp
+  803afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803afe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b01:	50                   	push   %eax
+  803b02:	53                   	push   %ebx
+  803b03:	e8 ac fb ff ff       	call   8036b4 <fd_lookup>
+  803b08:	83 c4 10             	add    $0x10,%esp
+  803b0b:	85 c0                	test   %eax,%eax
+  803b0d:	78 34                	js     803b43 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b0f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803b12:	83 ec 08             	sub    $0x8,%esp
+  803b15:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b18:	50                   	push   %eax
+  803b19:	ff 36                	push   (%esi)
+  803b1b:	e8 e4 fb ff ff       	call   803704 <dev_lookup>
+  803b20:	83 c4 10             	add    $0x10,%esp
+  803b23:	85 c0                	test   %eax,%eax
+  803b25:	78 1c                	js     803b43 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803b27:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  803b2b:	74 1d                	je     803b4a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  803b2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b30:	8b 40 18             	mov    0x18(%eax),%eax
+  803b33:	85 c0                	test   %eax,%eax
+  803b35:	74 54                	je     803b8b <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  803b37:	83 ec 08             	sub    $0x8,%esp
+  803b3a:	ff 75 0c             	push   0xc(%ebp)
+  803b3d:	56                   	push   %esi
+  803b3e:	ff d0                	call   *%eax
+  803b40:	83 c4 10             	add    $0x10,%esp
+}
+  803b43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b46:	5b                   	pop    %ebx
+  803b47:	5e                   	pop    %esi
+  803b48:	5d                   	pop    %ebp
+  803b49:	c3                   	ret
+  803b4a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803b4c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803b51:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803b57:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803b5c:	76 1c                	jbe    803b7a <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  803b5e:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803b61:	83 ec 04             	sub    $0x4,%esp
+  803b64:	53                   	push   %ebx
+  803b65:	50                   	push   %eax
+  803b66:	68 a8 52 80 00       	push   $0x8052a8
+  803b6b:	e8 e0 e0 ff ff       	call   801c50 <cprintf>
+		return -E_INVAL;
+  803b70:	83 c4 10             	add    $0x10,%esp
+  803b73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b78:	eb c9                	jmp    803b43 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803b7a:	c1 e8 10             	shr    $0x10,%eax
+  803b7d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803b83:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803b89:	eb d3                	jmp    803b5e <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  803b8b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803b90:	eb b1                	jmp    803b43 <ftruncate+0x50>
+
+00803b92 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803b92:	55                   	push   %ebp
+  803b93:	89 e5                	mov    %esp,%ebp
+  803b95:	56                   	push   %esi
+  803b96:	53                   	push   %ebx
+  803b97:	83 ec 18             	sub    $0x18,%esp
+  803b9a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803b9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803ba0:	50                   	push   %eax
+  803ba1:	ff 75 08             	push   0x8(%ebp)
+  803ba4:	e8 0b fb ff ff       	call   8036b4 <fd_lookup>
+  803ba9:	83 c4 10             	add    $0x10,%esp
+  803bac:	85 c0                	test   %eax,%eax
+  803bae:	78 49                	js     803bf9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803bb0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  803bb3:	83 ec 08             	sub    $0x8,%esp
+  803bb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bb9:	50                   	push   %eax
+  803bba:	ff 36                	push   (%esi)
+  803bbc:	e8 43 fb ff ff       	call   803704 <dev_lookup>
+  803bc1:	83 c4 10             	add    $0x10,%esp
+  803bc4:	85 c0                	test   %eax,%eax
+  803bc6:	78 31                	js     803bf9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  803bc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bcb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  803bcf:	74 2f                	je     803c00 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  803bd1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  803bd4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  803bdb:	00 00 00 
+	stat->st_isdir = 0;
+  803bde:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803be5:	00 00 00 
+	stat->st_dev = dev;
+  803be8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  803bee:	83 ec 08             	sub    $0x8,%esp
+  803bf1:	53                   	push   %ebx
+  803bf2:	56                   	push   %esi
+  803bf3:	ff 50 14             	call   *0x14(%eax)
+  803bf6:	83 c4 10             	add    $0x10,%esp
+}
+  803bf9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bfc:	5b                   	pop    %ebx
+  803bfd:	5e                   	pop    %esi
+  803bfe:	5d                   	pop    %ebp
+  803bff:	c3                   	ret
+		return -E_NOT_SUPP;
+  803c00:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803c05:	eb f2                	jmp    803bf9 <fstat+0x67>
+
+00803c07 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803c07:	55                   	push   %ebp
+  803c08:	89 e5                	mov    %esp,%ebp
+  803c0a:	56                   	push   %esi
+  803c0b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803c0c:	83 ec 08             	sub    $0x8,%esp
+  803c0f:	6a 00                	push   $0x0
+  803c11:	ff 75 08             	push   0x8(%ebp)
+  803c14:	e8 e4 01 00 00       	call   803dfd <open>
+  803c19:	89 c3                	mov    %eax,%ebx
+  803c1b:	83 c4 10             	add    $0x10,%esp
+  803c1e:	85 c0                	test   %eax,%eax
+  803c20:	78 1b                	js     803c3d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  803c22:	83 ec 08             	sub    $0x8,%esp
+  803c25:	ff 75 0c             	push   0xc(%ebp)
+  803c28:	50                   	push   %eax
+  803c29:	e8 64 ff ff ff       	call   803b92 <fstat>
+  803c2e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  803c30:	89 1c 24             	mov    %ebx,(%esp)
+  803c33:	e8 c6 fb ff ff       	call   8037fe <close>
+	return r;
+  803c38:	83 c4 10             	add    $0x10,%esp
+  803c3b:	89 f3                	mov    %esi,%ebx
+}
+  803c3d:	89 d8                	mov    %ebx,%eax
+  803c3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c42:	5b                   	pop    %ebx
+  803c43:	5e                   	pop    %esi
+  803c44:	5d                   	pop    %ebp
+  803c45:	c3                   	ret
+
+00803c46 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803c46:	55                   	push   %ebp
+  803c47:	89 e5                	mov    %esp,%ebp
+  803c49:	56                   	push   %esi
+  803c4a:	53                   	push   %ebx
+  803c4b:	89 c6                	mov    %eax,%esi
+  803c4d:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  803c4f:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  803c56:	74 27                	je     803c7f <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803c58:	6a 07                	push   $0x7
+  803c5a:	68 00 c0 80 00       	push   $0x80c000
+  803c5f:	56                   	push   %esi
+  803c60:	ff 35 00 b0 80 00    	push   0x80b000
+  803c66:	e8 17 f7 ff ff       	call   803382 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  803c6b:	83 c4 0c             	add    $0xc,%esp
+  803c6e:	6a 00                	push   $0x0
+  803c70:	53                   	push   %ebx
+  803c71:	6a 00                	push   $0x0
+  803c73:	e8 f2 f6 ff ff       	call   80336a <ipc_recv>
+}
+  803c78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c7b:	5b                   	pop    %ebx
+  803c7c:	5e                   	pop    %esi
+  803c7d:	5d                   	pop    %ebp
+  803c7e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803c7f:	83 ec 0c             	sub    $0xc,%esp
+  803c82:	6a 01                	push   $0x1
+  803c84:	e8 4d f7 ff ff       	call   8033d6 <ipc_find_env>
+  803c89:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  803c8e:	83 c4 10             	add    $0x10,%esp
+  803c91:	eb c5                	jmp    803c58 <fsipc+0x12>
+
+00803c93 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803c93:	55                   	push   %ebp
+  803c94:	89 e5                	mov    %esp,%ebp
+  803c96:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c9c:	8b 40 0c             	mov    0xc(%eax),%eax
+  803c9f:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	fsipcbuf.set_size.req_size = newsize;
+  803ca4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ca7:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  803cac:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cb1:	b8 02 00 00 00       	mov    $0x2,%eax
+  803cb6:	e8 8b ff ff ff       	call   803c46 <fsipc>
+}
+  803cbb:	c9                   	leave
+  803cbc:	c3                   	ret
+
+00803cbd <devfile_flush>:
+{
+  803cbd:	55                   	push   %ebp
+  803cbe:	89 e5                	mov    %esp,%ebp
+  803cc0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cc6:	8b 40 0c             	mov    0xc(%eax),%eax
+  803cc9:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return fsipc(FSREQ_FLUSH, NULL);
+  803cce:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cd3:	b8 06 00 00 00       	mov    $0x6,%eax
+  803cd8:	e8 69 ff ff ff       	call   803c46 <fsipc>
+}
+  803cdd:	c9                   	leave
+  803cde:	c3                   	ret
+
+00803cdf <devfile_stat>:
+{
+  803cdf:	55                   	push   %ebp
+  803ce0:	89 e5                	mov    %esp,%ebp
+  803ce2:	53                   	push   %ebx
+  803ce3:	83 ec 04             	sub    $0x4,%esp
+  803ce6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cec:	8b 40 0c             	mov    0xc(%eax),%eax
+  803cef:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803cf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cf9:	b8 05 00 00 00       	mov    $0x5,%eax
+  803cfe:	e8 43 ff ff ff       	call   803c46 <fsipc>
+  803d03:	85 c0                	test   %eax,%eax
+  803d05:	78 2c                	js     803d33 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d07:	83 ec 08             	sub    $0x8,%esp
+  803d0a:	68 00 c0 80 00       	push   $0x80c000
+  803d0f:	53                   	push   %ebx
+  803d10:	e8 83 e5 ff ff       	call   802298 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803d15:	a1 80 c0 80 00       	mov    0x80c080,%eax
+  803d1a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d20:	a1 84 c0 80 00       	mov    0x80c084,%eax
+  803d25:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  803d2b:	83 c4 10             	add    $0x10,%esp
+  803d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d36:	c9                   	leave
+  803d37:	c3                   	ret
+
+00803d38 <devfile_write>:
+{
+  803d38:	55                   	push   %ebp
+  803d39:	89 e5                	mov    %esp,%ebp
+  803d3b:	83 ec 0c             	sub    $0xc,%esp
+  803d3e:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803d41:	8b 55 08             	mov    0x8(%ebp),%edx
+  803d44:	8b 52 0c             	mov    0xc(%edx),%edx
+  803d47:	89 15 00 c0 80 00    	mov    %edx,0x80c000
+	fsipcbuf.write.req_n = n;
+  803d4d:	a3 04 c0 80 00       	mov    %eax,0x80c004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803d52:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  803d57:	39 d0                	cmp    %edx,%eax
+  803d59:	0f 47 c2             	cmova  %edx,%eax
+  803d5c:	50                   	push   %eax
+  803d5d:	ff 75 0c             	push   0xc(%ebp)
+  803d60:	68 08 c0 80 00       	push   $0x80c008
+  803d65:	e8 b4 e6 ff ff       	call   80241e <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  803d6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d6f:	b8 04 00 00 00       	mov    $0x4,%eax
+  803d74:	e8 cd fe ff ff       	call   803c46 <fsipc>
+}
+  803d79:	c9                   	leave
+  803d7a:	c3                   	ret
+
+00803d7b <devfile_read>:
+{
+  803d7b:	55                   	push   %ebp
+  803d7c:	89 e5                	mov    %esp,%ebp
+  803d7e:	56                   	push   %esi
+  803d7f:	53                   	push   %ebx
+  803d80:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d86:	8b 40 0c             	mov    0xc(%eax),%eax
+  803d89:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	fsipcbuf.read.req_n = n;
+  803d8e:	89 35 04 c0 80 00    	mov    %esi,0x80c004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  803d94:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d99:	b8 03 00 00 00       	mov    $0x3,%eax
+  803d9e:	e8 a3 fe ff ff       	call   803c46 <fsipc>
+  803da3:	89 c3                	mov    %eax,%ebx
+  803da5:	85 c0                	test   %eax,%eax
+  803da7:	78 1f                	js     803dc8 <devfile_read+0x4d>
+	assert(r <= n);
+  803da9:	39 c6                	cmp    %eax,%esi
+  803dab:	72 24                	jb     803dd1 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  803dad:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803db2:	7f 33                	jg     803de7 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  803db4:	83 ec 04             	sub    $0x4,%esp
+  803db7:	50                   	push   %eax
+  803db8:	68 00 c0 80 00       	push   $0x80c000
+  803dbd:	ff 75 0c             	push   0xc(%ebp)
+  803dc0:	e8 59 e6 ff ff       	call   80241e <memmove>
+	return r;
+  803dc5:	83 c4 10             	add    $0x10,%esp
+}
+  803dc8:	89 d8                	mov    %ebx,%eax
+  803dca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dcd:	5b                   	pop    %ebx
+  803dce:	5e                   	pop    %esi
+  803dcf:	5d                   	pop    %ebp
+  803dd0:	c3                   	ret
+	assert(r <= n);
+  803dd1:	68 18 53 80 00       	push   $0x805318
+  803dd6:	68 bd 48 80 00       	push   $0x8048bd
+  803ddb:	6a 76                	push   $0x76
+  803ddd:	68 1f 53 80 00       	push   $0x80531f
+  803de2:	e8 8e dd ff ff       	call   801b75 <_panic>
+	assert(r <= PGSIZE);
+  803de7:	68 2a 53 80 00       	push   $0x80532a
+  803dec:	68 bd 48 80 00       	push   $0x8048bd
+  803df1:	6a 77                	push   $0x77
+  803df3:	68 1f 53 80 00       	push   $0x80531f
+  803df8:	e8 78 dd ff ff       	call   801b75 <_panic>
+
+00803dfd <open>:
+{
+  803dfd:	55                   	push   %ebp
+  803dfe:	89 e5                	mov    %esp,%ebp
+  803e00:	56                   	push   %esi
+  803e01:	53                   	push   %ebx
+  803e02:	83 ec 1c             	sub    $0x1c,%esp
+  803e05:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  803e08:	56                   	push   %esi
+  803e09:	e8 4f e4 ff ff       	call   80225d <strlen>
+  803e0e:	83 c4 10             	add    $0x10,%esp
+  803e11:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803e16:	7f 6c                	jg     803e84 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  803e18:	83 ec 0c             	sub    $0xc,%esp
+  803e1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e1e:	50                   	push   %eax
+  803e1f:	e8 3a f8 ff ff       	call   80365e <fd_alloc>
+  803e24:	89 c3                	mov    %eax,%ebx
+  803e26:	83 c4 10             	add    $0x10,%esp
+  803e29:	85 c0                	test   %eax,%eax
+  803e2b:	78 3c                	js     803e69 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  803e2d:	83 ec 08             	sub    $0x8,%esp
+  803e30:	56                   	push   %esi
+  803e31:	68 00 c0 80 00       	push   $0x80c000
+  803e36:	e8 5d e4 ff ff       	call   802298 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  803e3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803e3e:	a3 00 c4 80 00       	mov    %eax,0x80c400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803e43:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803e46:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e4b:	e8 f6 fd ff ff       	call   803c46 <fsipc>
+  803e50:	89 c3                	mov    %eax,%ebx
+  803e52:	83 c4 10             	add    $0x10,%esp
+  803e55:	85 c0                	test   %eax,%eax
+  803e57:	78 19                	js     803e72 <open+0x75>
+	return fd2num(fd);
+  803e59:	83 ec 0c             	sub    $0xc,%esp
+  803e5c:	ff 75 f4             	push   -0xc(%ebp)
+  803e5f:	e8 d3 f7 ff ff       	call   803637 <fd2num>
+  803e64:	89 c3                	mov    %eax,%ebx
+  803e66:	83 c4 10             	add    $0x10,%esp
+}
+  803e69:	89 d8                	mov    %ebx,%eax
+  803e6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e6e:	5b                   	pop    %ebx
+  803e6f:	5e                   	pop    %esi
+  803e70:	5d                   	pop    %ebp
+  803e71:	c3                   	ret
+		fd_close(fd, 0);
+  803e72:	83 ec 08             	sub    $0x8,%esp
+  803e75:	6a 00                	push   $0x0
+  803e77:	ff 75 f4             	push   -0xc(%ebp)
+  803e7a:	e8 f8 f8 ff ff       	call   803777 <fd_close>
+		return r;
+  803e7f:	83 c4 10             	add    $0x10,%esp
+  803e82:	eb e5                	jmp    803e69 <open+0x6c>
+		return -E_BAD_PATH;
+  803e84:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  803e89:	eb de                	jmp    803e69 <open+0x6c>
+
+00803e8b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803e8b:	55                   	push   %ebp
+  803e8c:	89 e5                	mov    %esp,%ebp
+  803e8e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  803e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e96:	b8 08 00 00 00       	mov    $0x8,%eax
+  803e9b:	e8 a6 fd ff ff       	call   803c46 <fsipc>
+}
+  803ea0:	c9                   	leave
+  803ea1:	c3                   	ret
+
+00803ea2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803ea2:	55                   	push   %ebp
+  803ea3:	89 e5                	mov    %esp,%ebp
+  803ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803ea8:	89 c2                	mov    %eax,%edx
+  803eaa:	c1 ea 16             	shr    $0x16,%edx
+  803ead:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803eb4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803eb9:	f6 c1 01             	test   $0x1,%cl
+  803ebc:	74 1a                	je     803ed8 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803ebe:	c1 e8 0c             	shr    $0xc,%eax
+  803ec1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803ec8:	a8 01                	test   $0x1,%al
+  803eca:	74 0c                	je     803ed8 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803ecc:	c1 e8 0c             	shr    $0xc,%eax
+  803ecf:	c1 e0 04             	shl    $0x4,%eax
+  803ed2:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803ed8:	89 d0                	mov    %edx,%eax
+  803eda:	5d                   	pop    %ebp
+  803edb:	c3                   	ret
+
+00803edc <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803edc:	55                   	push   %ebp
+  803edd:	89 e5                	mov    %esp,%ebp
+  803edf:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803ee2:	68 36 53 80 00       	push   $0x805336
+  803ee7:	ff 75 0c             	push   0xc(%ebp)
+  803eea:	e8 a9 e3 ff ff       	call   802298 <strcpy>
+	return 0;
+}
+  803eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef4:	c9                   	leave
+  803ef5:	c3                   	ret
+
+00803ef6 <devsock_close>:
+{
+  803ef6:	55                   	push   %ebp
+  803ef7:	89 e5                	mov    %esp,%ebp
+  803ef9:	53                   	push   %ebx
+  803efa:	83 ec 10             	sub    $0x10,%esp
+  803efd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803f00:	53                   	push   %ebx
+  803f01:	e8 9c ff ff ff       	call   803ea2 <pageref>
+  803f06:	89 c2                	mov    %eax,%edx
+  803f08:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803f10:	83 fa 01             	cmp    $0x1,%edx
+  803f13:	74 05                	je     803f1a <devsock_close+0x24>
+}
+  803f15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f18:	c9                   	leave
+  803f19:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803f1a:	83 ec 0c             	sub    $0xc,%esp
+  803f1d:	ff 73 0c             	push   0xc(%ebx)
+  803f20:	e8 b7 02 00 00       	call   8041dc <nsipc_close>
+  803f25:	83 c4 10             	add    $0x10,%esp
+  803f28:	eb eb                	jmp    803f15 <devsock_close+0x1f>
+
+00803f2a <devsock_write>:
+{
+  803f2a:	55                   	push   %ebp
+  803f2b:	89 e5                	mov    %esp,%ebp
+  803f2d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803f30:	6a 00                	push   $0x0
+  803f32:	ff 75 10             	push   0x10(%ebp)
+  803f35:	ff 75 0c             	push   0xc(%ebp)
+  803f38:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f3b:	ff 70 0c             	push   0xc(%eax)
+  803f3e:	e8 79 03 00 00       	call   8042bc <nsipc_send>
+}
+  803f43:	c9                   	leave
+  803f44:	c3                   	ret
+
+00803f45 <devsock_read>:
+{
+  803f45:	55                   	push   %ebp
+  803f46:	89 e5                	mov    %esp,%ebp
+  803f48:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803f4b:	6a 00                	push   $0x0
+  803f4d:	ff 75 10             	push   0x10(%ebp)
+  803f50:	ff 75 0c             	push   0xc(%ebp)
+  803f53:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f56:	ff 70 0c             	push   0xc(%eax)
+  803f59:	e8 ef 02 00 00       	call   80424d <nsipc_recv>
+}
+  803f5e:	c9                   	leave
+  803f5f:	c3                   	ret
+
+00803f60 <fd2sockid>:
+{
+  803f60:	55                   	push   %ebp
+  803f61:	89 e5                	mov    %esp,%ebp
+  803f63:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803f66:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f69:	52                   	push   %edx
+  803f6a:	50                   	push   %eax
+  803f6b:	e8 44 f7 ff ff       	call   8036b4 <fd_lookup>
+  803f70:	83 c4 10             	add    $0x10,%esp
+  803f73:	85 c0                	test   %eax,%eax
+  803f75:	78 10                	js     803f87 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803f77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f7a:	8b 0d 80 a0 80 00    	mov    0x80a080,%ecx
+  803f80:	39 08                	cmp    %ecx,(%eax)
+  803f82:	75 05                	jne    803f89 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803f84:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803f87:	c9                   	leave
+  803f88:	c3                   	ret
+		return -E_NOT_SUPP;
+  803f89:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803f8e:	eb f7                	jmp    803f87 <fd2sockid+0x27>
+
+00803f90 <alloc_sockfd>:
+{
+  803f90:	55                   	push   %ebp
+  803f91:	89 e5                	mov    %esp,%ebp
+  803f93:	56                   	push   %esi
+  803f94:	53                   	push   %ebx
+  803f95:	83 ec 1c             	sub    $0x1c,%esp
+  803f98:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803f9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f9d:	50                   	push   %eax
+  803f9e:	e8 bb f6 ff ff       	call   80365e <fd_alloc>
+  803fa3:	89 c3                	mov    %eax,%ebx
+  803fa5:	83 c4 10             	add    $0x10,%esp
+  803fa8:	85 c0                	test   %eax,%eax
+  803faa:	78 43                	js     803fef <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803fac:	83 ec 04             	sub    $0x4,%esp
+  803faf:	68 07 04 00 00       	push   $0x407
+  803fb4:	ff 75 f4             	push   -0xc(%ebp)
+  803fb7:	6a 00                	push   $0x0
+  803fb9:	e8 d2 e7 ff ff       	call   802790 <sys_page_alloc>
+  803fbe:	89 c3                	mov    %eax,%ebx
+  803fc0:	83 c4 10             	add    $0x10,%esp
+  803fc3:	85 c0                	test   %eax,%eax
+  803fc5:	78 28                	js     803fef <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803fc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fca:	8b 15 80 a0 80 00    	mov    0x80a080,%edx
+  803fd0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803fd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fd5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803fdc:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803fdf:	83 ec 0c             	sub    $0xc,%esp
+  803fe2:	50                   	push   %eax
+  803fe3:	e8 4f f6 ff ff       	call   803637 <fd2num>
+  803fe8:	89 c3                	mov    %eax,%ebx
+  803fea:	83 c4 10             	add    $0x10,%esp
+  803fed:	eb 0c                	jmp    803ffb <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803fef:	83 ec 0c             	sub    $0xc,%esp
+  803ff2:	56                   	push   %esi
+  803ff3:	e8 e4 01 00 00       	call   8041dc <nsipc_close>
+		return r;
+  803ff8:	83 c4 10             	add    $0x10,%esp
+}
+  803ffb:	89 d8                	mov    %ebx,%eax
+  803ffd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804000:	5b                   	pop    %ebx
+  804001:	5e                   	pop    %esi
+  804002:	5d                   	pop    %ebp
+  804003:	c3                   	ret
+
+00804004 <accept>:
+{
+  804004:	55                   	push   %ebp
+  804005:	89 e5                	mov    %esp,%ebp
+  804007:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80400a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80400d:	e8 4e ff ff ff       	call   803f60 <fd2sockid>
+  804012:	85 c0                	test   %eax,%eax
+  804014:	78 1b                	js     804031 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804016:	83 ec 04             	sub    $0x4,%esp
+  804019:	ff 75 10             	push   0x10(%ebp)
+  80401c:	ff 75 0c             	push   0xc(%ebp)
+  80401f:	50                   	push   %eax
+  804020:	e8 0e 01 00 00       	call   804133 <nsipc_accept>
+  804025:	83 c4 10             	add    $0x10,%esp
+  804028:	85 c0                	test   %eax,%eax
+  80402a:	78 05                	js     804031 <accept+0x2d>
+	return alloc_sockfd(r);
+  80402c:	e8 5f ff ff ff       	call   803f90 <alloc_sockfd>
+}
+  804031:	c9                   	leave
+  804032:	c3                   	ret
+
+00804033 <bind>:
+{
+  804033:	55                   	push   %ebp
+  804034:	89 e5                	mov    %esp,%ebp
+  804036:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  804039:	8b 45 08             	mov    0x8(%ebp),%eax
+  80403c:	e8 1f ff ff ff       	call   803f60 <fd2sockid>
+  804041:	85 c0                	test   %eax,%eax
+  804043:	78 12                	js     804057 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  804045:	83 ec 04             	sub    $0x4,%esp
+  804048:	ff 75 10             	push   0x10(%ebp)
+  80404b:	ff 75 0c             	push   0xc(%ebp)
+  80404e:	50                   	push   %eax
+  80404f:	e8 31 01 00 00       	call   804185 <nsipc_bind>
+  804054:	83 c4 10             	add    $0x10,%esp
+}
+  804057:	c9                   	leave
+  804058:	c3                   	ret
+
+00804059 <shutdown>:
+{
+  804059:	55                   	push   %ebp
+  80405a:	89 e5                	mov    %esp,%ebp
+  80405c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80405f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804062:	e8 f9 fe ff ff       	call   803f60 <fd2sockid>
+  804067:	85 c0                	test   %eax,%eax
+  804069:	78 0f                	js     80407a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80406b:	83 ec 08             	sub    $0x8,%esp
+  80406e:	ff 75 0c             	push   0xc(%ebp)
+  804071:	50                   	push   %eax
+  804072:	e8 43 01 00 00       	call   8041ba <nsipc_shutdown>
+  804077:	83 c4 10             	add    $0x10,%esp
+}
+  80407a:	c9                   	leave
+  80407b:	c3                   	ret
+
+0080407c <connect>:
+{
+  80407c:	55                   	push   %ebp
+  80407d:	89 e5                	mov    %esp,%ebp
+  80407f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  804082:	8b 45 08             	mov    0x8(%ebp),%eax
+  804085:	e8 d6 fe ff ff       	call   803f60 <fd2sockid>
+  80408a:	85 c0                	test   %eax,%eax
+  80408c:	78 12                	js     8040a0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80408e:	83 ec 04             	sub    $0x4,%esp
+  804091:	ff 75 10             	push   0x10(%ebp)
+  804094:	ff 75 0c             	push   0xc(%ebp)
+  804097:	50                   	push   %eax
+  804098:	e8 59 01 00 00       	call   8041f6 <nsipc_connect>
+  80409d:	83 c4 10             	add    $0x10,%esp
+}
+  8040a0:	c9                   	leave
+  8040a1:	c3                   	ret
+
+008040a2 <listen>:
+{
+  8040a2:	55                   	push   %ebp
+  8040a3:	89 e5                	mov    %esp,%ebp
+  8040a5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8040a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040ab:	e8 b0 fe ff ff       	call   803f60 <fd2sockid>
+  8040b0:	85 c0                	test   %eax,%eax
+  8040b2:	78 0f                	js     8040c3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8040b4:	83 ec 08             	sub    $0x8,%esp
+  8040b7:	ff 75 0c             	push   0xc(%ebp)
+  8040ba:	50                   	push   %eax
+  8040bb:	e8 6b 01 00 00       	call   80422b <nsipc_listen>
+  8040c0:	83 c4 10             	add    $0x10,%esp
+}
+  8040c3:	c9                   	leave
+  8040c4:	c3                   	ret
+
+008040c5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8040c5:	55                   	push   %ebp
+  8040c6:	89 e5                	mov    %esp,%ebp
+  8040c8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8040cb:	ff 75 10             	push   0x10(%ebp)
+  8040ce:	ff 75 0c             	push   0xc(%ebp)
+  8040d1:	ff 75 08             	push   0x8(%ebp)
+  8040d4:	e8 41 02 00 00       	call   80431a <nsipc_socket>
+  8040d9:	83 c4 10             	add    $0x10,%esp
+  8040dc:	85 c0                	test   %eax,%eax
+  8040de:	78 05                	js     8040e5 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8040e0:	e8 ab fe ff ff       	call   803f90 <alloc_sockfd>
+}
+  8040e5:	c9                   	leave
+  8040e6:	c3                   	ret
+
+008040e7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8040e7:	55                   	push   %ebp
+  8040e8:	89 e5                	mov    %esp,%ebp
+  8040ea:	53                   	push   %ebx
+  8040eb:	83 ec 04             	sub    $0x4,%esp
+  8040ee:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8040f0:	83 3d 04 b0 80 00 00 	cmpl   $0x0,0x80b004
+  8040f7:	74 26                	je     80411f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8040f9:	6a 07                	push   $0x7
+  8040fb:	68 00 d0 80 00       	push   $0x80d000
+  804100:	53                   	push   %ebx
+  804101:	ff 35 04 b0 80 00    	push   0x80b004
+  804107:	e8 76 f2 ff ff       	call   803382 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80410c:	83 c4 0c             	add    $0xc,%esp
+  80410f:	6a 00                	push   $0x0
+  804111:	6a 00                	push   $0x0
+  804113:	6a 00                	push   $0x0
+  804115:	e8 50 f2 ff ff       	call   80336a <ipc_recv>
+}
+  80411a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80411d:	c9                   	leave
+  80411e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80411f:	83 ec 0c             	sub    $0xc,%esp
+  804122:	6a 02                	push   $0x2
+  804124:	e8 ad f2 ff ff       	call   8033d6 <ipc_find_env>
+  804129:	a3 04 b0 80 00       	mov    %eax,0x80b004
+  80412e:	83 c4 10             	add    $0x10,%esp
+  804131:	eb c6                	jmp    8040f9 <nsipc+0x12>
+
+00804133 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804133:	55                   	push   %ebp
+  804134:	89 e5                	mov    %esp,%ebp
+  804136:	56                   	push   %esi
+  804137:	53                   	push   %ebx
+  804138:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80413b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80413e:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  804143:	8b 06                	mov    (%esi),%eax
+  804145:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80414a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80414f:	e8 93 ff ff ff       	call   8040e7 <nsipc>
+  804154:	89 c3                	mov    %eax,%ebx
+  804156:	85 c0                	test   %eax,%eax
+  804158:	79 09                	jns    804163 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80415a:	89 d8                	mov    %ebx,%eax
+  80415c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80415f:	5b                   	pop    %ebx
+  804160:	5e                   	pop    %esi
+  804161:	5d                   	pop    %ebp
+  804162:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804163:	83 ec 04             	sub    $0x4,%esp
+  804166:	ff 35 10 d0 80 00    	push   0x80d010
+  80416c:	68 00 d0 80 00       	push   $0x80d000
+  804171:	ff 75 0c             	push   0xc(%ebp)
+  804174:	e8 a5 e2 ff ff       	call   80241e <memmove>
+		*addrlen = ret->ret_addrlen;
+  804179:	a1 10 d0 80 00       	mov    0x80d010,%eax
+  80417e:	89 06                	mov    %eax,(%esi)
+  804180:	83 c4 10             	add    $0x10,%esp
+	return r;
+  804183:	eb d5                	jmp    80415a <nsipc_accept+0x27>
+
+00804185 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804185:	55                   	push   %ebp
+  804186:	89 e5                	mov    %esp,%ebp
+  804188:	53                   	push   %ebx
+  804189:	83 ec 08             	sub    $0x8,%esp
+  80418c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80418f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804192:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804197:	53                   	push   %ebx
+  804198:	ff 75 0c             	push   0xc(%ebp)
+  80419b:	68 04 d0 80 00       	push   $0x80d004
+  8041a0:	e8 79 e2 ff ff       	call   80241e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8041a5:	89 1d 14 d0 80 00    	mov    %ebx,0x80d014
+	return nsipc(NSREQ_BIND);
+  8041ab:	b8 02 00 00 00       	mov    $0x2,%eax
+  8041b0:	e8 32 ff ff ff       	call   8040e7 <nsipc>
+}
+  8041b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041b8:	c9                   	leave
+  8041b9:	c3                   	ret
+
+008041ba <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8041ba:	55                   	push   %ebp
+  8041bb:	89 e5                	mov    %esp,%ebp
+  8041bd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8041c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041c3:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.shutdown.req_how = how;
+  8041c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041cb:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	return nsipc(NSREQ_SHUTDOWN);
+  8041d0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8041d5:	e8 0d ff ff ff       	call   8040e7 <nsipc>
+}
+  8041da:	c9                   	leave
+  8041db:	c3                   	ret
+
+008041dc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8041dc:	55                   	push   %ebp
+  8041dd:	89 e5                	mov    %esp,%ebp
+  8041df:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8041e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041e5:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	return nsipc(NSREQ_CLOSE);
+  8041ea:	b8 04 00 00 00       	mov    $0x4,%eax
+  8041ef:	e8 f3 fe ff ff       	call   8040e7 <nsipc>
+}
+  8041f4:	c9                   	leave
+  8041f5:	c3                   	ret
+
+008041f6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8041f6:	55                   	push   %ebp
+  8041f7:	89 e5                	mov    %esp,%ebp
+  8041f9:	53                   	push   %ebx
+  8041fa:	83 ec 08             	sub    $0x8,%esp
+  8041fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  804200:	8b 45 08             	mov    0x8(%ebp),%eax
+  804203:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804208:	53                   	push   %ebx
+  804209:	ff 75 0c             	push   0xc(%ebp)
+  80420c:	68 04 d0 80 00       	push   $0x80d004
+  804211:	e8 08 e2 ff ff       	call   80241e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  804216:	89 1d 14 d0 80 00    	mov    %ebx,0x80d014
+	return nsipc(NSREQ_CONNECT);
+  80421c:	b8 05 00 00 00       	mov    $0x5,%eax
+  804221:	e8 c1 fe ff ff       	call   8040e7 <nsipc>
+}
+  804226:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804229:	c9                   	leave
+  80422a:	c3                   	ret
+
+0080422b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80422b:	55                   	push   %ebp
+  80422c:	89 e5                	mov    %esp,%ebp
+  80422e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  804231:	8b 45 08             	mov    0x8(%ebp),%eax
+  804234:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.listen.req_backlog = backlog;
+  804239:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80423c:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	return nsipc(NSREQ_LISTEN);
+  804241:	b8 06 00 00 00       	mov    $0x6,%eax
+  804246:	e8 9c fe ff ff       	call   8040e7 <nsipc>
+}
+  80424b:	c9                   	leave
+  80424c:	c3                   	ret
+
+0080424d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80424d:	55                   	push   %ebp
+  80424e:	89 e5                	mov    %esp,%ebp
+  804250:	56                   	push   %esi
+  804251:	53                   	push   %ebx
+  804252:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804255:	8b 45 08             	mov    0x8(%ebp),%eax
+  804258:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.recv.req_len = len;
+  80425d:	89 35 04 d0 80 00    	mov    %esi,0x80d004
+	nsipcbuf.recv.req_flags = flags;
+  804263:	8b 45 14             	mov    0x14(%ebp),%eax
+  804266:	a3 08 d0 80 00       	mov    %eax,0x80d008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80426b:	b8 07 00 00 00       	mov    $0x7,%eax
+  804270:	e8 72 fe ff ff       	call   8040e7 <nsipc>
+  804275:	89 c3                	mov    %eax,%ebx
+  804277:	85 c0                	test   %eax,%eax
+  804279:	78 22                	js     80429d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80427b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  804280:	39 c6                	cmp    %eax,%esi
+  804282:	0f 4e c6             	cmovle %esi,%eax
+  804285:	39 c3                	cmp    %eax,%ebx
+  804287:	7f 1d                	jg     8042a6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804289:	83 ec 04             	sub    $0x4,%esp
+  80428c:	53                   	push   %ebx
+  80428d:	68 00 d0 80 00       	push   $0x80d000
+  804292:	ff 75 0c             	push   0xc(%ebp)
+  804295:	e8 84 e1 ff ff       	call   80241e <memmove>
+  80429a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80429d:	89 d8                	mov    %ebx,%eax
+  80429f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8042a2:	5b                   	pop    %ebx
+  8042a3:	5e                   	pop    %esi
+  8042a4:	5d                   	pop    %ebp
+  8042a5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8042a6:	68 42 53 80 00       	push   $0x805342
+  8042ab:	68 bd 48 80 00       	push   $0x8048bd
+  8042b0:	6a 62                	push   $0x62
+  8042b2:	68 57 53 80 00       	push   $0x805357
+  8042b7:	e8 b9 d8 ff ff       	call   801b75 <_panic>
+
+008042bc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8042bc:	55                   	push   %ebp
+  8042bd:	89 e5                	mov    %esp,%ebp
+  8042bf:	53                   	push   %ebx
+  8042c0:	83 ec 04             	sub    $0x4,%esp
+  8042c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8042c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042c9:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	assert(size < 1600);
+  8042ce:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8042d4:	7f 2e                	jg     804304 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8042d6:	83 ec 04             	sub    $0x4,%esp
+  8042d9:	53                   	push   %ebx
+  8042da:	ff 75 0c             	push   0xc(%ebp)
+  8042dd:	68 0c d0 80 00       	push   $0x80d00c
+  8042e2:	e8 37 e1 ff ff       	call   80241e <memmove>
+	nsipcbuf.send.req_size = size;
+  8042e7:	89 1d 04 d0 80 00    	mov    %ebx,0x80d004
+	nsipcbuf.send.req_flags = flags;
+  8042ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8042f0:	a3 08 d0 80 00       	mov    %eax,0x80d008
+	return nsipc(NSREQ_SEND);
+  8042f5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8042fa:	e8 e8 fd ff ff       	call   8040e7 <nsipc>
+}
+  8042ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804302:	c9                   	leave
+  804303:	c3                   	ret
+	assert(size < 1600);
+  804304:	68 63 53 80 00       	push   $0x805363
+  804309:	68 bd 48 80 00       	push   $0x8048bd
+  80430e:	6a 6d                	push   $0x6d
+  804310:	68 57 53 80 00       	push   $0x805357
+  804315:	e8 5b d8 ff ff       	call   801b75 <_panic>
+
+0080431a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80431a:	55                   	push   %ebp
+  80431b:	89 e5                	mov    %esp,%ebp
+  80431d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  804320:	8b 45 08             	mov    0x8(%ebp),%eax
+  804323:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	nsipcbuf.socket.req_type = type;
+  804328:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80432b:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	nsipcbuf.socket.req_protocol = protocol;
+  804330:	8b 45 10             	mov    0x10(%ebp),%eax
+  804333:	a3 08 d0 80 00       	mov    %eax,0x80d008
+	return nsipc(NSREQ_SOCKET);
+  804338:	b8 09 00 00 00       	mov    $0x9,%eax
+  80433d:	e8 a5 fd ff ff       	call   8040e7 <nsipc>
+}
+  804342:	c9                   	leave
+  804343:	c3                   	ret
+
+00804344 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  804344:	55                   	push   %ebp
+  804345:	89 e5                	mov    %esp,%ebp
+  804347:	56                   	push   %esi
+  804348:	53                   	push   %ebx
+  804349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80434c:	83 ec 0c             	sub    $0xc,%esp
+  80434f:	ff 75 08             	push   0x8(%ebp)
+  804352:	e8 f0 f2 ff ff       	call   803647 <fd2data>
+  804357:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  804359:	83 c4 08             	add    $0x8,%esp
+  80435c:	68 6f 53 80 00       	push   $0x80536f
+  804361:	53                   	push   %ebx
+  804362:	e8 31 df ff ff       	call   802298 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  804367:	8b 46 04             	mov    0x4(%esi),%eax
+  80436a:	2b 06                	sub    (%esi),%eax
+  80436c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  804372:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804379:	00 00 00 
+	stat->st_dev = &devpipe;
+  80437c:	c7 83 88 00 00 00 9c 	movl   $0x80a09c,0x88(%ebx)
+  804383:	a0 80 00 
+	return 0;
+}
+  804386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80438b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80438e:	5b                   	pop    %ebx
+  80438f:	5e                   	pop    %esi
+  804390:	5d                   	pop    %ebp
+  804391:	c3                   	ret
+
+00804392 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  804392:	55                   	push   %ebp
+  804393:	89 e5                	mov    %esp,%ebp
+  804395:	53                   	push   %ebx
+  804396:	83 ec 0c             	sub    $0xc,%esp
+  804399:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80439c:	53                   	push   %ebx
+  80439d:	6a 00                	push   $0x0
+  80439f:	e8 c7 e4 ff ff       	call   80286b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8043a4:	89 1c 24             	mov    %ebx,(%esp)
+  8043a7:	e8 9b f2 ff ff       	call   803647 <fd2data>
+  8043ac:	83 c4 08             	add    $0x8,%esp
+  8043af:	50                   	push   %eax
+  8043b0:	6a 00                	push   $0x0
+  8043b2:	e8 b4 e4 ff ff       	call   80286b <sys_page_unmap>
+}
+  8043b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8043ba:	c9                   	leave
+  8043bb:	c3                   	ret
+
+008043bc <_pipeisclosed>:
+{
+  8043bc:	55                   	push   %ebp
+  8043bd:	89 e5                	mov    %esp,%ebp
+  8043bf:	57                   	push   %edi
+  8043c0:	56                   	push   %esi
+  8043c1:	53                   	push   %ebx
+  8043c2:	83 ec 1c             	sub    $0x1c,%esp
+  8043c5:	89 c7                	mov    %eax,%edi
+  8043c7:	89 d6                	mov    %edx,%esi
+  8043c9:	eb 3c                	jmp    804407 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8043cb:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8043ce:	83 ec 0c             	sub    $0xc,%esp
+  8043d1:	57                   	push   %edi
+  8043d2:	e8 cb fa ff ff       	call   803ea2 <pageref>
+  8043d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8043da:	89 34 24             	mov    %esi,(%esp)
+  8043dd:	e8 c0 fa ff ff       	call   803ea2 <pageref>
+  8043e2:	89 c2                	mov    %eax,%edx
+  8043e4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8043e6:	05 00 00 00 20       	add    $0x20000000,%eax
+  8043eb:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8043ee:	8b 0d 10 b0 80 00    	mov    0x80b010,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8043f4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8043f9:	76 31                	jbe    80442c <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8043fb:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8043fe:	39 c3                	cmp    %eax,%ebx
+  804400:	74 76                	je     804478 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  804402:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  804405:	74 36                	je     80443d <_pipeisclosed+0x81>
+  804407:	89 e0                	mov    %esp,%eax
+  804409:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80440e:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  804414:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  804419:	77 b0                	ja     8043cb <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80441b:	c1 e8 10             	shr    $0x10,%eax
+  80441e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  804424:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80442a:	eb 9f                	jmp    8043cb <_pipeisclosed+0xf>
+  80442c:	c1 e8 10             	shr    $0x10,%eax
+  80442f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  804435:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80443b:	eb be                	jmp    8043fb <_pipeisclosed+0x3f>
+  80443d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80443f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  804444:	8b 15 10 b0 80 00    	mov    0x80b010,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80444a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80444f:	76 16                	jbe    804467 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804451:	8b 42 58             	mov    0x58(%edx),%eax
+  804454:	6a 01                	push   $0x1
+  804456:	50                   	push   %eax
+  804457:	53                   	push   %ebx
+  804458:	68 76 53 80 00       	push   $0x805376
+  80445d:	e8 ee d7 ff ff       	call   801c50 <cprintf>
+  804462:	83 c4 10             	add    $0x10,%esp
+  804465:	eb a0                	jmp    804407 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  804467:	c1 e8 10             	shr    $0x10,%eax
+  80446a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  804470:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  804476:	eb d9                	jmp    804451 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  804478:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80447b:	0f 94 c0             	sete   %al
+  80447e:	0f b6 c0             	movzbl %al,%eax
+}
+  804481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804484:	5b                   	pop    %ebx
+  804485:	5e                   	pop    %esi
+  804486:	5f                   	pop    %edi
+  804487:	5d                   	pop    %ebp
+  804488:	c3                   	ret
+
+00804489 <devpipe_write>:
+{
+  804489:	55                   	push   %ebp
+  80448a:	89 e5                	mov    %esp,%ebp
+  80448c:	57                   	push   %edi
+  80448d:	56                   	push   %esi
+  80448e:	53                   	push   %ebx
+  80448f:	83 ec 28             	sub    $0x28,%esp
+  804492:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  804495:	56                   	push   %esi
+  804496:	e8 ac f1 ff ff       	call   803647 <fd2data>
+  80449b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80449d:	83 c4 10             	add    $0x10,%esp
+  8044a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8044a8:	75 09                	jne    8044b3 <devpipe_write+0x2a>
+	return i;
+  8044aa:	89 f8                	mov    %edi,%eax
+  8044ac:	eb 23                	jmp    8044d1 <devpipe_write+0x48>
+			sys_yield();
+  8044ae:	e8 97 e2 ff ff       	call   80274a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8044b3:	8b 43 04             	mov    0x4(%ebx),%eax
+  8044b6:	8b 0b                	mov    (%ebx),%ecx
+  8044b8:	8d 51 20             	lea    0x20(%ecx),%edx
+  8044bb:	39 d0                	cmp    %edx,%eax
+  8044bd:	72 1a                	jb     8044d9 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8044bf:	89 da                	mov    %ebx,%edx
+  8044c1:	89 f0                	mov    %esi,%eax
+  8044c3:	e8 f4 fe ff ff       	call   8043bc <_pipeisclosed>
+  8044c8:	85 c0                	test   %eax,%eax
+  8044ca:	74 e2                	je     8044ae <devpipe_write+0x25>
+				return 0;
+  8044cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044d4:	5b                   	pop    %ebx
+  8044d5:	5e                   	pop    %esi
+  8044d6:	5f                   	pop    %edi
+  8044d7:	5d                   	pop    %ebp
+  8044d8:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8044d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8044dc:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8044e0:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8044e3:	89 c2                	mov    %eax,%edx
+  8044e5:	c1 fa 1f             	sar    $0x1f,%edx
+  8044e8:	89 d1                	mov    %edx,%ecx
+  8044ea:	c1 e9 1b             	shr    $0x1b,%ecx
+  8044ed:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8044f0:	83 e2 1f             	and    $0x1f,%edx
+  8044f3:	29 ca                	sub    %ecx,%edx
+  8044f5:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8044f9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8044fd:	83 c0 01             	add    $0x1,%eax
+  804500:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  804503:	83 c7 01             	add    $0x1,%edi
+  804506:	eb 9d                	jmp    8044a5 <devpipe_write+0x1c>
+
+00804508 <devpipe_read>:
+{
+  804508:	55                   	push   %ebp
+  804509:	89 e5                	mov    %esp,%ebp
+  80450b:	57                   	push   %edi
+  80450c:	56                   	push   %esi
+  80450d:	53                   	push   %ebx
+  80450e:	83 ec 18             	sub    $0x18,%esp
+  804511:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  804514:	57                   	push   %edi
+  804515:	e8 2d f1 ff ff       	call   803647 <fd2data>
+  80451a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80451c:	83 c4 10             	add    $0x10,%esp
+  80451f:	be 00 00 00 00       	mov    $0x0,%esi
+  804524:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804527:	75 13                	jne    80453c <devpipe_read+0x34>
+	return i;
+  804529:	89 f0                	mov    %esi,%eax
+  80452b:	eb 02                	jmp    80452f <devpipe_read+0x27>
+				return i;
+  80452d:	89 f0                	mov    %esi,%eax
+}
+  80452f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804532:	5b                   	pop    %ebx
+  804533:	5e                   	pop    %esi
+  804534:	5f                   	pop    %edi
+  804535:	5d                   	pop    %ebp
+  804536:	c3                   	ret
+			sys_yield();
+  804537:	e8 0e e2 ff ff       	call   80274a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80453c:	8b 03                	mov    (%ebx),%eax
+  80453e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  804541:	75 18                	jne    80455b <devpipe_read+0x53>
+			if (i > 0)
+  804543:	85 f6                	test   %esi,%esi
+  804545:	75 e6                	jne    80452d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  804547:	89 da                	mov    %ebx,%edx
+  804549:	89 f8                	mov    %edi,%eax
+  80454b:	e8 6c fe ff ff       	call   8043bc <_pipeisclosed>
+  804550:	85 c0                	test   %eax,%eax
+  804552:	74 e3                	je     804537 <devpipe_read+0x2f>
+				return 0;
+  804554:	b8 00 00 00 00       	mov    $0x0,%eax
+  804559:	eb d4                	jmp    80452f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80455b:	99                   	cltd
+  80455c:	c1 ea 1b             	shr    $0x1b,%edx
+  80455f:	01 d0                	add    %edx,%eax
+  804561:	83 e0 1f             	and    $0x1f,%eax
+  804564:	29 d0                	sub    %edx,%eax
+  804566:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80456b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80456e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  804571:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  804574:	83 c6 01             	add    $0x1,%esi
+  804577:	eb ab                	jmp    804524 <devpipe_read+0x1c>
+
+00804579 <pipe>:
+{
+  804579:	55                   	push   %ebp
+  80457a:	89 e5                	mov    %esp,%ebp
+  80457c:	56                   	push   %esi
+  80457d:	53                   	push   %ebx
+  80457e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804581:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804584:	50                   	push   %eax
+  804585:	e8 d4 f0 ff ff       	call   80365e <fd_alloc>
+  80458a:	89 c3                	mov    %eax,%ebx
+  80458c:	83 c4 10             	add    $0x10,%esp
+  80458f:	85 c0                	test   %eax,%eax
+  804591:	0f 88 23 01 00 00    	js     8046ba <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804597:	83 ec 04             	sub    $0x4,%esp
+  80459a:	68 07 04 00 00       	push   $0x407
+  80459f:	ff 75 f4             	push   -0xc(%ebp)
+  8045a2:	6a 00                	push   $0x0
+  8045a4:	e8 e7 e1 ff ff       	call   802790 <sys_page_alloc>
+  8045a9:	89 c3                	mov    %eax,%ebx
+  8045ab:	83 c4 10             	add    $0x10,%esp
+  8045ae:	85 c0                	test   %eax,%eax
+  8045b0:	0f 88 04 01 00 00    	js     8046ba <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8045b6:	83 ec 0c             	sub    $0xc,%esp
+  8045b9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8045bc:	50                   	push   %eax
+  8045bd:	e8 9c f0 ff ff       	call   80365e <fd_alloc>
+  8045c2:	89 c3                	mov    %eax,%ebx
+  8045c4:	83 c4 10             	add    $0x10,%esp
+  8045c7:	85 c0                	test   %eax,%eax
+  8045c9:	0f 88 db 00 00 00    	js     8046aa <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8045cf:	83 ec 04             	sub    $0x4,%esp
+  8045d2:	68 07 04 00 00       	push   $0x407
+  8045d7:	ff 75 f0             	push   -0x10(%ebp)
+  8045da:	6a 00                	push   $0x0
+  8045dc:	e8 af e1 ff ff       	call   802790 <sys_page_alloc>
+  8045e1:	89 c3                	mov    %eax,%ebx
+  8045e3:	83 c4 10             	add    $0x10,%esp
+  8045e6:	85 c0                	test   %eax,%eax
+  8045e8:	0f 88 bc 00 00 00    	js     8046aa <pipe+0x131>
+	va = fd2data(fd0);
+  8045ee:	83 ec 0c             	sub    $0xc,%esp
+  8045f1:	ff 75 f4             	push   -0xc(%ebp)
+  8045f4:	e8 4e f0 ff ff       	call   803647 <fd2data>
+  8045f9:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8045fb:	83 c4 0c             	add    $0xc,%esp
+  8045fe:	68 07 04 00 00       	push   $0x407
+  804603:	50                   	push   %eax
+  804604:	6a 00                	push   $0x0
+  804606:	e8 85 e1 ff ff       	call   802790 <sys_page_alloc>
+  80460b:	89 c3                	mov    %eax,%ebx
+  80460d:	83 c4 10             	add    $0x10,%esp
+  804610:	85 c0                	test   %eax,%eax
+  804612:	0f 88 82 00 00 00    	js     80469a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804618:	83 ec 0c             	sub    $0xc,%esp
+  80461b:	ff 75 f0             	push   -0x10(%ebp)
+  80461e:	e8 24 f0 ff ff       	call   803647 <fd2data>
+  804623:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80462a:	50                   	push   %eax
+  80462b:	6a 00                	push   $0x0
+  80462d:	56                   	push   %esi
+  80462e:	6a 00                	push   $0x0
+  804630:	e8 c8 e1 ff ff       	call   8027fd <sys_page_map>
+  804635:	89 c3                	mov    %eax,%ebx
+  804637:	83 c4 20             	add    $0x20,%esp
+  80463a:	85 c0                	test   %eax,%eax
+  80463c:	78 4e                	js     80468c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80463e:	a1 9c a0 80 00       	mov    0x80a09c,%eax
+  804643:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804646:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  804648:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80464b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  804652:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804655:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  804657:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80465a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804661:	83 ec 0c             	sub    $0xc,%esp
+  804664:	ff 75 f4             	push   -0xc(%ebp)
+  804667:	e8 cb ef ff ff       	call   803637 <fd2num>
+  80466c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80466f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804671:	83 c4 04             	add    $0x4,%esp
+  804674:	ff 75 f0             	push   -0x10(%ebp)
+  804677:	e8 bb ef ff ff       	call   803637 <fd2num>
+  80467c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80467f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804682:	83 c4 10             	add    $0x10,%esp
+  804685:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80468a:	eb 2e                	jmp    8046ba <pipe+0x141>
+	sys_page_unmap(0, va);
+  80468c:	83 ec 08             	sub    $0x8,%esp
+  80468f:	56                   	push   %esi
+  804690:	6a 00                	push   $0x0
+  804692:	e8 d4 e1 ff ff       	call   80286b <sys_page_unmap>
+  804697:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80469a:	83 ec 08             	sub    $0x8,%esp
+  80469d:	ff 75 f0             	push   -0x10(%ebp)
+  8046a0:	6a 00                	push   $0x0
+  8046a2:	e8 c4 e1 ff ff       	call   80286b <sys_page_unmap>
+  8046a7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8046aa:	83 ec 08             	sub    $0x8,%esp
+  8046ad:	ff 75 f4             	push   -0xc(%ebp)
+  8046b0:	6a 00                	push   $0x0
+  8046b2:	e8 b4 e1 ff ff       	call   80286b <sys_page_unmap>
+  8046b7:	83 c4 10             	add    $0x10,%esp
+}
+  8046ba:	89 d8                	mov    %ebx,%eax
+  8046bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8046bf:	5b                   	pop    %ebx
+  8046c0:	5e                   	pop    %esi
+  8046c1:	5d                   	pop    %ebp
+  8046c2:	c3                   	ret
+
+008046c3 <pipeisclosed>:
+{
+  8046c3:	55                   	push   %ebp
+  8046c4:	89 e5                	mov    %esp,%ebp
+  8046c6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8046c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8046cc:	50                   	push   %eax
+  8046cd:	ff 75 08             	push   0x8(%ebp)
+  8046d0:	e8 df ef ff ff       	call   8036b4 <fd_lookup>
+  8046d5:	83 c4 10             	add    $0x10,%esp
+  8046d8:	85 c0                	test   %eax,%eax
+  8046da:	78 18                	js     8046f4 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8046dc:	83 ec 0c             	sub    $0xc,%esp
+  8046df:	ff 75 f4             	push   -0xc(%ebp)
+  8046e2:	e8 60 ef ff ff       	call   803647 <fd2data>
+  8046e7:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8046e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8046ec:	e8 cb fc ff ff       	call   8043bc <_pipeisclosed>
+  8046f1:	83 c4 10             	add    $0x10,%esp
+}
+  8046f4:	c9                   	leave
+  8046f5:	c3                   	ret
+
+008046f6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8046f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fb:	c3                   	ret
+
+008046fc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8046fc:	55                   	push   %ebp
+  8046fd:	89 e5                	mov    %esp,%ebp
+  8046ff:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804702:	68 8e 53 80 00       	push   $0x80538e
+  804707:	ff 75 0c             	push   0xc(%ebp)
+  80470a:	e8 89 db ff ff       	call   802298 <strcpy>
+	return 0;
+}
+  80470f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804714:	c9                   	leave
+  804715:	c3                   	ret
+
+00804716 <devcons_write>:
+{
+  804716:	55                   	push   %ebp
+  804717:	89 e5                	mov    %esp,%ebp
+  804719:	57                   	push   %edi
+  80471a:	56                   	push   %esi
+  80471b:	53                   	push   %ebx
+  80471c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804722:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804727:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80472d:	eb 2e                	jmp    80475d <devcons_write+0x47>
+		m = n - tot;
+  80472f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804732:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804734:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804739:	39 c3                	cmp    %eax,%ebx
+  80473b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80473e:	83 ec 04             	sub    $0x4,%esp
+  804741:	53                   	push   %ebx
+  804742:	89 f0                	mov    %esi,%eax
+  804744:	03 45 0c             	add    0xc(%ebp),%eax
+  804747:	50                   	push   %eax
+  804748:	57                   	push   %edi
+  804749:	e8 d0 dc ff ff       	call   80241e <memmove>
+		sys_cputs(buf, m);
+  80474e:	83 c4 08             	add    $0x8,%esp
+  804751:	53                   	push   %ebx
+  804752:	57                   	push   %edi
+  804753:	e8 b9 de ff ff       	call   802611 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804758:	01 de                	add    %ebx,%esi
+  80475a:	83 c4 10             	add    $0x10,%esp
+  80475d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804760:	72 cd                	jb     80472f <devcons_write+0x19>
+}
+  804762:	89 f0                	mov    %esi,%eax
+  804764:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804767:	5b                   	pop    %ebx
+  804768:	5e                   	pop    %esi
+  804769:	5f                   	pop    %edi
+  80476a:	5d                   	pop    %ebp
+  80476b:	c3                   	ret
+
+0080476c <devcons_read>:
+{
+  80476c:	55                   	push   %ebp
+  80476d:	89 e5                	mov    %esp,%ebp
+  80476f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804772:	b8 00 00 00 00       	mov    $0x0,%eax
+  804777:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80477b:	75 07                	jne    804784 <devcons_read+0x18>
+  80477d:	eb 1f                	jmp    80479e <devcons_read+0x32>
+		sys_yield();
+  80477f:	e8 c6 df ff ff       	call   80274a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804784:	e8 cc de ff ff       	call   802655 <sys_cgetc>
+  804789:	85 c0                	test   %eax,%eax
+  80478b:	74 f2                	je     80477f <devcons_read+0x13>
+	if (c < 0)
+  80478d:	78 0f                	js     80479e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80478f:	83 f8 04             	cmp    $0x4,%eax
+  804792:	74 0c                	je     8047a0 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804794:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804797:	88 02                	mov    %al,(%edx)
+	return 1;
+  804799:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80479e:	c9                   	leave
+  80479f:	c3                   	ret
+		return 0;
+  8047a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a5:	eb f7                	jmp    80479e <devcons_read+0x32>
+
+008047a7 <cputchar>:
+{
+  8047a7:	55                   	push   %ebp
+  8047a8:	89 e5                	mov    %esp,%ebp
+  8047aa:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8047ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047b0:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8047b3:	6a 01                	push   $0x1
+  8047b5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8047b8:	50                   	push   %eax
+  8047b9:	e8 53 de ff ff       	call   802611 <sys_cputs>
+}
+  8047be:	83 c4 10             	add    $0x10,%esp
+  8047c1:	c9                   	leave
+  8047c2:	c3                   	ret
+
+008047c3 <getchar>:
+{
+  8047c3:	55                   	push   %ebp
+  8047c4:	89 e5                	mov    %esp,%ebp
+  8047c6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8047c9:	6a 01                	push   $0x1
+  8047cb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8047ce:	50                   	push   %eax
+  8047cf:	6a 00                	push   $0x0
+  8047d1:	e8 64 f1 ff ff       	call   80393a <read>
+	if (r < 0)
+  8047d6:	83 c4 10             	add    $0x10,%esp
+  8047d9:	85 c0                	test   %eax,%eax
+  8047db:	78 06                	js     8047e3 <getchar+0x20>
+	if (r < 1)
+  8047dd:	74 06                	je     8047e5 <getchar+0x22>
+	return c;
+  8047df:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8047e3:	c9                   	leave
+  8047e4:	c3                   	ret
+		return -E_EOF;
+  8047e5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8047ea:	eb f7                	jmp    8047e3 <getchar+0x20>
+
+008047ec <iscons>:
+{
+  8047ec:	55                   	push   %ebp
+  8047ed:	89 e5                	mov    %esp,%ebp
+  8047ef:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8047f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8047f5:	50                   	push   %eax
+  8047f6:	ff 75 08             	push   0x8(%ebp)
+  8047f9:	e8 b6 ee ff ff       	call   8036b4 <fd_lookup>
+  8047fe:	83 c4 10             	add    $0x10,%esp
+  804801:	85 c0                	test   %eax,%eax
+  804803:	78 11                	js     804816 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804805:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804808:	8b 15 b8 a0 80 00    	mov    0x80a0b8,%edx
+  80480e:	39 10                	cmp    %edx,(%eax)
+  804810:	0f 94 c0             	sete   %al
+  804813:	0f b6 c0             	movzbl %al,%eax
+}
+  804816:	c9                   	leave
+  804817:	c3                   	ret
+
+00804818 <opencons>:
+{
+  804818:	55                   	push   %ebp
+  804819:	89 e5                	mov    %esp,%ebp
+  80481b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80481e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804821:	50                   	push   %eax
+  804822:	e8 37 ee ff ff       	call   80365e <fd_alloc>
+  804827:	83 c4 10             	add    $0x10,%esp
+  80482a:	85 c0                	test   %eax,%eax
+  80482c:	78 3a                	js     804868 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80482e:	83 ec 04             	sub    $0x4,%esp
+  804831:	68 07 04 00 00       	push   $0x407
+  804836:	ff 75 f4             	push   -0xc(%ebp)
+  804839:	6a 00                	push   $0x0
+  80483b:	e8 50 df ff ff       	call   802790 <sys_page_alloc>
+  804840:	83 c4 10             	add    $0x10,%esp
+  804843:	85 c0                	test   %eax,%eax
+  804845:	78 21                	js     804868 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804847:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80484a:	8b 15 b8 a0 80 00    	mov    0x80a0b8,%edx
+  804850:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804852:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804855:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80485c:	83 ec 0c             	sub    $0xc,%esp
+  80485f:	50                   	push   %eax
+  804860:	e8 d2 ed ff ff       	call   803637 <fd2num>
+  804865:	83 c4 10             	add    $0x10,%esp
+}
+  804868:	c9                   	leave
+  804869:	c3                   	ret
@@ -0,0 +1,8284 @@
+
+obj/net/testinput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f0 08 00 00       	call   800921 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 7c             	sub    $0x7c,%esp
+	envid_t ns_envid = sys_getenvid();
+  80003c:	e8 33 15 00 00       	call   801574 <sys_getenvid>
+  800041:	89 c3                	mov    %eax,%ebx
+	int i, r, first = 1;
+
+	binaryname = "testinput";
+  800043:	c7 05 00 50 80 00 20 	movl   $0x803d20,0x805000
+  80004a:	3d 80 00 
+
+	output_envid = fork();
+  80004d:	e8 99 24 00 00       	call   8024eb <fork>
+  800052:	a3 04 60 80 00       	mov    %eax,0x806004
+	if (output_envid < 0)
+  800057:	85 c0                	test   %eax,%eax
+  800059:	0f 88 88 01 00 00    	js     8001e7 <umain+0x1b4>
+		panic("error forking");
+	else if (output_envid == 0) {
+  80005f:	0f 84 96 01 00 00    	je     8001fb <umain+0x1c8>
+		output(ns_envid);
+		return;
+	}
+
+	input_envid = fork();
+  800065:	e8 81 24 00 00       	call   8024eb <fork>
+  80006a:	a3 00 60 80 00       	mov    %eax,0x806000
+	if (input_envid < 0)
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	0f 88 98 01 00 00    	js     80020f <umain+0x1dc>
+		panic("error forking");
+	else if (input_envid == 0) {
+  800077:	0f 84 a6 01 00 00    	je     800223 <umain+0x1f0>
+		input(ns_envid);
+		return;
+	}
+
+	cprintf("Sending ARP announcement...\n");
+  80007d:	83 ec 0c             	sub    $0xc,%esp
+  800080:	68 48 3d 80 00       	push   $0x803d48
+  800085:	e8 36 0a 00 00       	call   800ac0 <cprintf>
+	uint8_t mac[6] = {0x52, 0x54, 0x00, 0x12, 0x34, 0x56};
+  80008a:	c7 45 98 52 54 00 12 	movl   $0x12005452,-0x68(%ebp)
+  800091:	66 c7 45 9c 34 56    	movw   $0x5634,-0x64(%ebp)
+    sys_e1000_read_hwaddr((char *) mac, 6);
+  800097:	83 c4 08             	add    $0x8,%esp
+  80009a:	6a 06                	push   $0x6
+  80009c:	8d 45 98             	lea    -0x68(%ebp),%eax
+  80009f:	50                   	push   %eax
+  8000a0:	e8 f5 1e 00 00       	call   801f9a <sys_e1000_read_hwaddr>
+	uint32_t myip = inet_addr(IP);
+  8000a5:	c7 04 24 65 3d 80 00 	movl   $0x803d65,(%esp)
+  8000ac:	e8 36 08 00 00       	call   8008e7 <inet_addr>
+  8000b1:	89 45 90             	mov    %eax,-0x70(%ebp)
+	uint32_t gwip = inet_addr(DEFAULT);
+  8000b4:	c7 04 24 6f 3d 80 00 	movl   $0x803d6f,(%esp)
+  8000bb:	e8 27 08 00 00       	call   8008e7 <inet_addr>
+  8000c0:	89 45 94             	mov    %eax,-0x6c(%ebp)
+	if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  8000c3:	83 c4 0c             	add    $0xc,%esp
+  8000c6:	6a 07                	push   $0x7
+  8000c8:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000cd:	6a 00                	push   $0x0
+  8000cf:	e8 2c 15 00 00       	call   801600 <sys_page_alloc>
+  8000d4:	83 c4 10             	add    $0x10,%esp
+  8000d7:	85 c0                	test   %eax,%eax
+  8000d9:	0f 88 52 01 00 00    	js     800231 <umain+0x1fe>
+	pkt->jp_len = sizeof(*arp);
+  8000df:	c7 05 00 b0 fe 0f 2a 	movl   $0x2a,0xffeb000
+  8000e6:	00 00 00 
+	memset(arp->ethhdr.dest.addr, 0xff, ETHARP_HWADDR_LEN);
+  8000e9:	83 ec 04             	sub    $0x4,%esp
+  8000ec:	6a 06                	push   $0x6
+  8000ee:	68 ff 00 00 00       	push   $0xff
+  8000f3:	68 04 b0 fe 0f       	push   $0xffeb004
+  8000f8:	e8 5c 11 00 00       	call   801259 <memset>
+	memcpy(arp->ethhdr.src.addr,  mac,  ETHARP_HWADDR_LEN);
+  8000fd:	83 c4 0c             	add    $0xc,%esp
+  800100:	6a 06                	push   $0x6
+  800102:	8d 5d 98             	lea    -0x68(%ebp),%ebx
+  800105:	53                   	push   %ebx
+  800106:	68 0a b0 fe 0f       	push   $0xffeb00a
+  80010b:	e8 e0 11 00 00       	call   8012f0 <memcpy>
+	arp->ethhdr.type = htons(ETHTYPE_ARP);
+  800110:	c7 04 24 06 08 00 00 	movl   $0x806,(%esp)
+  800117:	e8 ad 05 00 00       	call   8006c9 <htons>
+  80011c:	66 a3 10 b0 fe 0f    	mov    %ax,0xffeb010
+	arp->hwtype = htons(1); // Ethernet
+  800122:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800129:	e8 9b 05 00 00       	call   8006c9 <htons>
+  80012e:	66 a3 12 b0 fe 0f    	mov    %ax,0xffeb012
+	arp->proto = htons(ETHTYPE_IP);
+  800134:	c7 04 24 00 08 00 00 	movl   $0x800,(%esp)
+  80013b:	e8 89 05 00 00       	call   8006c9 <htons>
+  800140:	66 a3 14 b0 fe 0f    	mov    %ax,0xffeb014
+	arp->_hwlen_protolen = htons((ETHARP_HWADDR_LEN << 8) | 4);
+  800146:	c7 04 24 04 06 00 00 	movl   $0x604,(%esp)
+  80014d:	e8 77 05 00 00       	call   8006c9 <htons>
+  800152:	66 a3 16 b0 fe 0f    	mov    %ax,0xffeb016
+	arp->opcode = htons(ARP_REQUEST);
+  800158:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80015f:	e8 65 05 00 00       	call   8006c9 <htons>
+  800164:	66 a3 18 b0 fe 0f    	mov    %ax,0xffeb018
+	memcpy(arp->shwaddr.addr,  mac,   ETHARP_HWADDR_LEN);
+  80016a:	83 c4 0c             	add    $0xc,%esp
+  80016d:	6a 06                	push   $0x6
+  80016f:	53                   	push   %ebx
+  800170:	68 1a b0 fe 0f       	push   $0xffeb01a
+  800175:	e8 76 11 00 00       	call   8012f0 <memcpy>
+	memcpy(arp->sipaddr.addrw, &myip, 4);
+  80017a:	83 c4 0c             	add    $0xc,%esp
+  80017d:	6a 04                	push   $0x4
+  80017f:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800182:	50                   	push   %eax
+  800183:	68 20 b0 fe 0f       	push   $0xffeb020
+  800188:	e8 63 11 00 00       	call   8012f0 <memcpy>
+	memset(arp->dhwaddr.addr,  0x00,  ETHARP_HWADDR_LEN);
+  80018d:	83 c4 0c             	add    $0xc,%esp
+  800190:	6a 06                	push   $0x6
+  800192:	6a 00                	push   $0x0
+  800194:	68 24 b0 fe 0f       	push   $0xffeb024
+  800199:	e8 bb 10 00 00       	call   801259 <memset>
+	memcpy(arp->dipaddr.addrw, &gwip, 4);
+  80019e:	83 c4 0c             	add    $0xc,%esp
+  8001a1:	6a 04                	push   $0x4
+  8001a3:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8001a6:	50                   	push   %eax
+  8001a7:	68 2a b0 fe 0f       	push   $0xffeb02a
+  8001ac:	e8 3f 11 00 00       	call   8012f0 <memcpy>
+	ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8001b1:	6a 07                	push   $0x7
+  8001b3:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001b8:	6a 0b                	push   $0xb
+  8001ba:	ff 35 04 60 80 00    	push   0x806004
+  8001c0:	e8 84 24 00 00       	call   802649 <ipc_send>
+	sys_page_unmap(0, pkt);
+  8001c5:	83 c4 18             	add    $0x18,%esp
+  8001c8:	68 00 b0 fe 0f       	push   $0xffeb000
+  8001cd:	6a 00                	push   $0x0
+  8001cf:	e8 07 15 00 00       	call   8016db <sys_page_unmap>
+}
+  8001d4:	83 c4 10             	add    $0x10,%esp
+	int i, r, first = 1;
+  8001d7:	bf 01 00 00 00       	mov    $0x1,%edi
+			out = buf + snprintf(buf, end - buf,
+  8001dc:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%ebp)
+}
+  8001e2:	e9 65 01 00 00       	jmp    80034c <umain+0x319>
+		panic("error forking");
+  8001e7:	83 ec 04             	sub    $0x4,%esp
+  8001ea:	68 2a 3d 80 00       	push   $0x803d2a
+  8001ef:	6a 51                	push   $0x51
+  8001f1:	68 38 3d 80 00       	push   $0x803d38
+  8001f6:	e8 ea 07 00 00       	call   8009e5 <_panic>
+		output(ns_envid);
+  8001fb:	83 ec 0c             	sub    $0xc,%esp
+  8001fe:	53                   	push   %ebx
+  8001ff:	e8 15 03 00 00       	call   800519 <output>
+		return;
+  800204:	83 c4 10             	add    $0x10,%esp
+		// we've received the ARP reply
+		if (first)
+			cprintf("Waiting for packets...\n");
+		first = 0;
+	}
+}
+  800207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020a:	5b                   	pop    %ebx
+  80020b:	5e                   	pop    %esi
+  80020c:	5f                   	pop    %edi
+  80020d:	5d                   	pop    %ebp
+  80020e:	c3                   	ret
+		panic("error forking");
+  80020f:	83 ec 04             	sub    $0x4,%esp
+  800212:	68 2a 3d 80 00       	push   $0x803d2a
+  800217:	6a 59                	push   $0x59
+  800219:	68 38 3d 80 00       	push   $0x803d38
+  80021e:	e8 c2 07 00 00       	call   8009e5 <_panic>
+		input(ns_envid);
+  800223:	83 ec 0c             	sub    $0xc,%esp
+  800226:	53                   	push   %ebx
+  800227:	e8 f8 01 00 00       	call   800424 <input>
+		return;
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	eb d6                	jmp    800207 <umain+0x1d4>
+		panic("sys_page_map: %e", r);
+  800231:	50                   	push   %eax
+  800232:	68 78 3d 80 00       	push   $0x803d78
+  800237:	6a 1d                	push   $0x1d
+  800239:	68 38 3d 80 00       	push   $0x803d38
+  80023e:	e8 a2 07 00 00       	call   8009e5 <_panic>
+			panic("ipc_recv: %e", req);
+  800243:	50                   	push   %eax
+  800244:	68 89 3d 80 00       	push   $0x803d89
+  800249:	6a 68                	push   $0x68
+  80024b:	68 38 3d 80 00       	push   $0x803d38
+  800250:	e8 90 07 00 00       	call   8009e5 <_panic>
+			panic("IPC from unexpected environment %08x", whom);
+  800255:	52                   	push   %edx
+  800256:	68 e0 3d 80 00       	push   $0x803de0
+  80025b:	6a 6a                	push   $0x6a
+  80025d:	68 38 3d 80 00       	push   $0x803d38
+  800262:	e8 7e 07 00 00       	call   8009e5 <_panic>
+			panic("Unexpected IPC %d", req);
+  800267:	50                   	push   %eax
+  800268:	68 96 3d 80 00       	push   $0x803d96
+  80026d:	6a 6c                	push   $0x6c
+  80026f:	68 38 3d 80 00       	push   $0x803d38
+  800274:	e8 6c 07 00 00       	call   8009e5 <_panic>
+			out = buf + snprintf(buf, end - buf,
+  800279:	83 ec 0c             	sub    $0xc,%esp
+  80027c:	53                   	push   %ebx
+  80027d:	68 a8 3d 80 00       	push   $0x803da8
+  800282:	68 b0 3d 80 00       	push   $0x803db0
+  800287:	6a 50                	push   $0x50
+  800289:	8d 45 98             	lea    -0x68(%ebp),%eax
+  80028c:	50                   	push   %eax
+  80028d:	e8 21 0e 00 00       	call   8010b3 <snprintf>
+  800292:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  800295:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+  800298:	83 c4 20             	add    $0x20,%esp
+  80029b:	eb 40                	jmp    8002dd <umain+0x2aa>
+			cprintf("%.*s\n", out - buf, buf);
+  80029d:	83 ec 04             	sub    $0x4,%esp
+  8002a0:	8d 45 98             	lea    -0x68(%ebp),%eax
+  8002a3:	50                   	push   %eax
+  8002a4:	89 f0                	mov    %esi,%eax
+  8002a6:	8d 4d 98             	lea    -0x68(%ebp),%ecx
+  8002a9:	29 c8                	sub    %ecx,%eax
+  8002ab:	50                   	push   %eax
+  8002ac:	68 bf 3d 80 00       	push   $0x803dbf
+  8002b1:	e8 0a 08 00 00       	call   800ac0 <cprintf>
+  8002b6:	83 c4 10             	add    $0x10,%esp
+		if (i % 2 == 1)
+  8002b9:	89 da                	mov    %ebx,%edx
+  8002bb:	c1 ea 1f             	shr    $0x1f,%edx
+  8002be:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  8002c1:	83 e0 01             	and    $0x1,%eax
+  8002c4:	29 d0                	sub    %edx,%eax
+  8002c6:	83 f8 01             	cmp    $0x1,%eax
+  8002c9:	74 4e                	je     800319 <umain+0x2e6>
+		if (i % 16 == 7)
+  8002cb:	83 ff 07             	cmp    $0x7,%edi
+  8002ce:	74 51                	je     800321 <umain+0x2ee>
+	for (i = 0; i < len; i++) {
+  8002d0:	83 c3 01             	add    $0x1,%ebx
+  8002d3:	39 5d 84             	cmp    %ebx,-0x7c(%ebp)
+  8002d6:	7e 51                	jle    800329 <umain+0x2f6>
+		if (i % 16 == 0)
+  8002d8:	f6 c3 0f             	test   $0xf,%bl
+  8002db:	74 9c                	je     800279 <umain+0x246>
+		out += snprintf(out, end - out, "%02x", ((uint8_t*)data)[i]);
+  8002dd:	0f b6 83 04 b0 fe 0f 	movzbl 0xffeb004(%ebx),%eax
+  8002e4:	50                   	push   %eax
+  8002e5:	68 ba 3d 80 00       	push   $0x803dba
+  8002ea:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  8002ed:	29 f0                	sub    %esi,%eax
+  8002ef:	50                   	push   %eax
+  8002f0:	56                   	push   %esi
+  8002f1:	e8 bd 0d 00 00       	call   8010b3 <snprintf>
+  8002f6:	01 c6                	add    %eax,%esi
+		if (i % 16 == 15 || i == len - 1)
+  8002f8:	89 d8                	mov    %ebx,%eax
+  8002fa:	c1 f8 1f             	sar    $0x1f,%eax
+  8002fd:	c1 e8 1c             	shr    $0x1c,%eax
+  800300:	8d 3c 03             	lea    (%ebx,%eax,1),%edi
+  800303:	83 e7 0f             	and    $0xf,%edi
+  800306:	29 c7                	sub    %eax,%edi
+  800308:	83 c4 10             	add    $0x10,%esp
+  80030b:	83 ff 0f             	cmp    $0xf,%edi
+  80030e:	74 8d                	je     80029d <umain+0x26a>
+  800310:	8b 45 80             	mov    -0x80(%ebp),%eax
+  800313:	39 c3                	cmp    %eax,%ebx
+  800315:	75 a2                	jne    8002b9 <umain+0x286>
+  800317:	eb 84                	jmp    80029d <umain+0x26a>
+			*(out++) = ' ';
+  800319:	c6 06 20             	movb   $0x20,(%esi)
+  80031c:	8d 76 01             	lea    0x1(%esi),%esi
+  80031f:	eb aa                	jmp    8002cb <umain+0x298>
+			*(out++) = ' ';
+  800321:	c6 06 20             	movb   $0x20,(%esi)
+  800324:	8d 76 01             	lea    0x1(%esi),%esi
+  800327:	eb a7                	jmp    8002d0 <umain+0x29d>
+		cprintf("\n");
+  800329:	83 ec 0c             	sub    $0xc,%esp
+  80032c:	68 db 3d 80 00       	push   $0x803ddb
+  800331:	e8 8a 07 00 00       	call   800ac0 <cprintf>
+		if (first)
+  800336:	83 c4 10             	add    $0x10,%esp
+  800339:	83 bd 7c ff ff ff 00 	cmpl   $0x0,-0x84(%ebp)
+  800340:	75 60                	jne    8003a2 <umain+0x36f>
+		first = 0;
+  800342:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+  800349:	00 00 00 
+		int32_t req = ipc_recv((int32_t *)&whom, pkt, &perm);
+  80034c:	83 ec 04             	sub    $0x4,%esp
+  80034f:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800352:	50                   	push   %eax
+  800353:	68 00 b0 fe 0f       	push   $0xffeb000
+  800358:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80035b:	50                   	push   %eax
+  80035c:	e8 d0 22 00 00       	call   802631 <ipc_recv>
+		if (req < 0)
+  800361:	83 c4 10             	add    $0x10,%esp
+  800364:	85 c0                	test   %eax,%eax
+  800366:	0f 88 d7 fe ff ff    	js     800243 <umain+0x210>
+		if (whom != input_envid)
+  80036c:	8b 55 90             	mov    -0x70(%ebp),%edx
+  80036f:	3b 15 00 60 80 00    	cmp    0x806000,%edx
+  800375:	0f 85 da fe ff ff    	jne    800255 <umain+0x222>
+		if (req != NSREQ_INPUT)
+  80037b:	83 f8 0a             	cmp    $0xa,%eax
+  80037e:	0f 85 e3 fe ff ff    	jne    800267 <umain+0x234>
+		hexdump("input: ", pkt->jp_data, pkt->jp_len);
+  800384:	8b 0d 00 b0 fe 0f    	mov    0xffeb000,%ecx
+	char *out = NULL;
+  80038a:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < len; i++) {
+  80038f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (i % 16 == 15 || i == len - 1)
+  800394:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  800397:	89 45 80             	mov    %eax,-0x80(%ebp)
+  80039a:	89 4d 84             	mov    %ecx,-0x7c(%ebp)
+	for (i = 0; i < len; i++) {
+  80039d:	e9 31 ff ff ff       	jmp    8002d3 <umain+0x2a0>
+			cprintf("Waiting for packets...\n");
+  8003a2:	83 ec 0c             	sub    $0xc,%esp
+  8003a5:	68 c5 3d 80 00       	push   $0x803dc5
+  8003aa:	e8 11 07 00 00       	call   800ac0 <cprintf>
+  8003af:	83 c4 10             	add    $0x10,%esp
+  8003b2:	eb 8e                	jmp    800342 <umain+0x30f>
+
+008003b4 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  8003b4:	55                   	push   %ebp
+  8003b5:	89 e5                	mov    %esp,%ebp
+  8003b7:	57                   	push   %edi
+  8003b8:	56                   	push   %esi
+  8003b9:	53                   	push   %ebx
+  8003ba:	83 ec 1c             	sub    $0x1c,%esp
+  8003bd:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t stop = time_msec() + initial_to;
+  8003c0:	e8 61 36 00 00       	call   803a26 <time_msec>
+  8003c5:	03 45 0c             	add    0xc(%ebp),%eax
+  8003c8:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  8003ca:	c7 05 00 50 80 00 05 	movl   $0x803e05,0x805000
+  8003d1:	3e 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  8003d4:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  8003d7:	eb 07                	jmp    8003e0 <timer+0x2c>
+			if (whom != ns_envid) {
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = time_msec() + to;
+  8003d9:	e8 48 36 00 00       	call   803a26 <time_msec>
+  8003de:	01 c3                	add    %eax,%ebx
+		sys_sleep_until(stop);
+  8003e0:	83 ec 0c             	sub    $0xc,%esp
+  8003e3:	53                   	push   %ebx
+  8003e4:	e8 b8 16 00 00       	call   801aa1 <sys_sleep_until>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  8003e9:	6a 00                	push   $0x0
+  8003eb:	6a 00                	push   $0x0
+  8003ed:	6a 0c                	push   $0xc
+  8003ef:	56                   	push   %esi
+  8003f0:	e8 54 22 00 00       	call   802649 <ipc_send>
+  8003f5:	83 c4 20             	add    $0x20,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  8003f8:	83 ec 04             	sub    $0x4,%esp
+  8003fb:	6a 00                	push   $0x0
+  8003fd:	6a 00                	push   $0x0
+  8003ff:	57                   	push   %edi
+  800400:	e8 2c 22 00 00       	call   802631 <ipc_recv>
+  800405:	89 c3                	mov    %eax,%ebx
+			if (whom != ns_envid) {
+  800407:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80040a:	83 c4 10             	add    $0x10,%esp
+  80040d:	39 f0                	cmp    %esi,%eax
+  80040f:	74 c8                	je     8003d9 <timer+0x25>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	50                   	push   %eax
+  800415:	68 10 3e 80 00       	push   $0x803e10
+  80041a:	e8 a1 06 00 00       	call   800ac0 <cprintf>
+				continue;
+  80041f:	83 c4 10             	add    $0x10,%esp
+  800422:	eb d4                	jmp    8003f8 <timer+0x44>
+
+00800424 <input>:
+
+union Nsipc nsipcbufs[NUM_INPUT_PAGES] __attribute__((aligned(PGSIZE)));
+
+void
+input(envid_t ns_envid)
+{
+  800424:	55                   	push   %ebp
+  800425:	89 e5                	mov    %esp,%ebp
+  800427:	57                   	push   %edi
+  800428:	56                   	push   %esi
+  800429:	53                   	push   %ebx
+  80042a:	83 ec 0c             	sub    $0xc,%esp
+  80042d:	8b 75 08             	mov    0x8(%ebp),%esi
+	binaryname = "ns_input";
+  800430:	c7 05 00 50 80 00 4b 	movl   $0x803e4b,0x805000
+  800437:	3e 80 00 
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80043a:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80043c:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  800441:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800447:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80044c:	76 1b                	jbe    800469 <input+0x45>
+    int r;
+    envid_t whom;
+    int idx = 0;
+    
+    cprintf("ns_input env type = %d\n", thisenv->env_type);
+  80044e:	8b 42 50             	mov    0x50(%edx),%eax
+  800451:	83 ec 08             	sub    $0x8,%esp
+  800454:	50                   	push   %eax
+  800455:	68 54 3e 80 00       	push   $0x803e54
+  80045a:	e8 61 06 00 00       	call   800ac0 <cprintf>
+  80045f:	83 c4 10             	add    $0x10,%esp
+    int idx = 0;
+  800462:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800467:	eb 61                	jmp    8004ca <input+0xa6>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800469:	c1 e8 10             	shr    $0x10,%eax
+  80046c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800472:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800478:	eb d4                	jmp    80044e <input+0x2a>
+        
+        nsipcbufs[idx].pkt.jp_data[0] = 0;
+        
+        // Receive packet from device
+        if ((r = sys_e1000_receive(nsipcbufs[idx].pkt.jp_data, PGSIZE - sizeof (size_t))) < 0) {
+            panic("error on receive");
+  80047a:	83 ec 04             	sub    $0x4,%esp
+  80047d:	68 6c 3e 80 00       	push   $0x803e6c
+  800482:	6a 1f                	push   $0x1f
+  800484:	68 7d 3e 80 00       	push   $0x803e7d
+  800489:	e8 57 05 00 00       	call   8009e5 <_panic>
+        }
+        r = thisenv->env_e1000_size;
+  80048e:	8b 92 a8 00 00 00    	mov    0xa8(%edx),%edx
+        
+         // Set the length
+        nsipcbufs[idx].pkt.jp_len = r;
+  800494:	89 d8                	mov    %ebx,%eax
+  800496:	c1 e0 0c             	shl    $0xc,%eax
+  800499:	89 90 00 70 80 00    	mov    %edx,0x807000(%eax)
+        
+        // Set input to network server
+        ipc_send(ns_envid, NSREQ_INPUT, &nsipcbufs[idx], PTE_U | PTE_W | PTE_P);
+  80049f:	6a 07                	push   $0x7
+  8004a1:	81 c7 00 70 80 00    	add    $0x807000,%edi
+  8004a7:	57                   	push   %edi
+  8004a8:	6a 0a                	push   $0xa
+  8004aa:	56                   	push   %esi
+  8004ab:	e8 99 21 00 00       	call   802649 <ipc_send>
+        
+        idx = (idx + 1) % NUM_INPUT_PAGES;
+  8004b0:	83 c3 01             	add    $0x1,%ebx
+  8004b3:	89 d8                	mov    %ebx,%eax
+  8004b5:	c1 f8 1f             	sar    $0x1f,%eax
+  8004b8:	c1 e8 1a             	shr    $0x1a,%eax
+  8004bb:	01 c3                	add    %eax,%ebx
+  8004bd:	83 e3 3f             	and    $0x3f,%ebx
+  8004c0:	29 c3                	sub    %eax,%ebx
+        
+        sys_yield();
+  8004c2:	e8 f3 10 00 00       	call   8015ba <sys_yield>
+        nsipcbufs[idx].pkt.jp_data[0] = 0;
+  8004c7:	83 c4 10             	add    $0x10,%esp
+  8004ca:	89 df                	mov    %ebx,%edi
+  8004cc:	c1 e7 0c             	shl    $0xc,%edi
+  8004cf:	c6 87 04 70 80 00 00 	movb   $0x0,0x807004(%edi)
+        if ((r = sys_e1000_receive(nsipcbufs[idx].pkt.jp_data, PGSIZE - sizeof (size_t))) < 0) {
+  8004d6:	83 ec 08             	sub    $0x8,%esp
+  8004d9:	68 fc 0f 00 00       	push   $0xffc
+  8004de:	8d 87 04 70 80 00    	lea    0x807004(%edi),%eax
+  8004e4:	50                   	push   %eax
+  8004e5:	e8 66 1a 00 00       	call   801f50 <sys_e1000_receive>
+  8004ea:	83 c4 10             	add    $0x10,%esp
+  8004ed:	85 c0                	test   %eax,%eax
+  8004ef:	78 89                	js     80047a <input+0x56>
+  8004f1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8004f3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8004f8:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8004fe:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800503:	77 89                	ja     80048e <input+0x6a>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800505:	c1 e8 10             	shr    $0x10,%eax
+  800508:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80050e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800514:	e9 75 ff ff ff       	jmp    80048e <input+0x6a>
+
+00800519 <output>:
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid)
+{
+  800519:	55                   	push   %ebp
+  80051a:	89 e5                	mov    %esp,%ebp
+  80051c:	56                   	push   %esi
+  80051d:	53                   	push   %ebx
+  80051e:	83 ec 10             	sub    $0x10,%esp
+  800521:	8b 75 08             	mov    0x8(%ebp),%esi
+    envid_t envid;
+    int value;
+    int r;
+    
+    
+	binaryname = "ns_output";
+  800524:	c7 05 00 50 80 00 89 	movl   $0x803e89,0x805000
+  80052b:	3e 80 00 
+  80052e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800530:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  800535:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80053b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800540:	0f 86 8b 00 00 00    	jbe    8005d1 <output+0xb8>
+    
+    cprintf("%s -> %x\n", binaryname, thisenv->env_id);
+  800546:	8b 42 48             	mov    0x48(%edx),%eax
+  800549:	83 ec 04             	sub    $0x4,%esp
+  80054c:	50                   	push   %eax
+  80054d:	68 89 3e 80 00       	push   $0x803e89
+  800552:	68 93 3e 80 00       	push   $0x803e93
+  800557:	e8 64 05 00 00       	call   800ac0 <cprintf>
+  80055c:	89 e0                	mov    %esp,%eax
+  80055e:	05 00 00 00 20       	add    $0x20000000,%eax
+  800563:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  800566:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80056c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800571:	76 72                	jbe    8005e5 <output+0xcc>
+    
+    cprintf("ns_output env type = %d\n", thisenv->env_type);
+  800573:	8b 42 50             	mov    0x50(%edx),%eax
+  800576:	83 ec 08             	sub    $0x8,%esp
+  800579:	50                   	push   %eax
+  80057a:	68 9d 3e 80 00       	push   $0x803e9d
+  80057f:	e8 3c 05 00 00       	call   800ac0 <cprintf>
+  800584:	83 c4 10             	add    $0x10,%esp
+	// LAB 6: Your code here:
+	// 	- read a packet from the network server
+	//	- send the packet to the device driver
+    while (true) {
+        // Wait for IPC input.
+        if ((value = ipc_recv(&envid, &nsipcbuf, NULL)) < 0)
+  800587:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  80058a:	83 ec 04             	sub    $0x4,%esp
+  80058d:	6a 00                	push   $0x0
+  80058f:	68 00 90 84 00       	push   $0x849000
+  800594:	53                   	push   %ebx
+  800595:	e8 97 20 00 00       	call   802631 <ipc_recv>
+  80059a:	83 c4 10             	add    $0x10,%esp
+  80059d:	85 c0                	test   %eax,%eax
+  80059f:	78 58                	js     8005f9 <output+0xe0>
+        
+        // If we received something not from the ns, ignore it.
+        if (envid != ns_envid)
+            continue;
+        
+        if (value != NSREQ_OUTPUT)
+  8005a1:	39 75 f4             	cmp    %esi,-0xc(%ebp)
+  8005a4:	75 e4                	jne    80058a <output+0x71>
+  8005a6:	83 f8 0b             	cmp    $0xb,%eax
+  8005a9:	75 df                	jne    80058a <output+0x71>
+            continue;
+        
+        // beam me up, Scotty
+        while ((r = sys_e1000_transmit(nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len)) < 0) {
+  8005ab:	83 ec 08             	sub    $0x8,%esp
+  8005ae:	ff 35 00 90 84 00    	push   0x849000
+  8005b4:	68 04 90 84 00       	push   $0x849004
+  8005b9:	e8 27 19 00 00       	call   801ee5 <sys_e1000_transmit>
+  8005be:	83 c4 10             	add    $0x10,%esp
+  8005c1:	85 c0                	test   %eax,%eax
+  8005c3:	79 c5                	jns    80058a <output+0x71>
+            if (r != -E_RING_FULL)
+  8005c5:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8005c8:	75 43                	jne    80060d <output+0xf4>
+                panic("net/output: transmit error");
+            
+            sys_yield();
+  8005ca:	e8 eb 0f 00 00       	call   8015ba <sys_yield>
+  8005cf:	eb da                	jmp    8005ab <output+0x92>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8005d1:	c1 e8 10             	shr    $0x10,%eax
+  8005d4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8005da:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8005e0:	e9 61 ff ff ff       	jmp    800546 <output+0x2d>
+  8005e5:	c1 e8 10             	shr    $0x10,%eax
+  8005e8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8005ee:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8005f4:	e9 7a ff ff ff       	jmp    800573 <output+0x5a>
+            panic("net/output: cannot recv");
+  8005f9:	83 ec 04             	sub    $0x4,%esp
+  8005fc:	68 b6 3e 80 00       	push   $0x803eb6
+  800601:	6a 1b                	push   $0x1b
+  800603:	68 ce 3e 80 00       	push   $0x803ece
+  800608:	e8 d8 03 00 00       	call   8009e5 <_panic>
+                panic("net/output: transmit error");
+  80060d:	83 ec 04             	sub    $0x4,%esp
+  800610:	68 db 3e 80 00       	push   $0x803edb
+  800615:	6a 27                	push   $0x27
+  800617:	68 ce 3e 80 00       	push   $0x803ece
+  80061c:	e8 c4 03 00 00       	call   8009e5 <_panic>
+
+00800621 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  800621:	55                   	push   %ebp
+  800622:	89 e5                	mov    %esp,%ebp
+  800624:	57                   	push   %edi
+  800625:	56                   	push   %esi
+  800626:	53                   	push   %ebx
+  800627:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  80062a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80062d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  800630:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800633:	b9 08 60 80 00       	mov    $0x806008,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  800638:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  80063d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800640:	eb 31                	jmp    800673 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800642:	0f b6 c8             	movzbl %al,%ecx
+  800645:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  80064a:	88 0a                	mov    %cl,(%edx)
+  80064c:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  80064f:	83 e8 01             	sub    $0x1,%eax
+  800652:	3c ff                	cmp    $0xff,%al
+  800654:	75 ec                	jne    800642 <inet_ntoa+0x21>
+  800656:	0f b6 db             	movzbl %bl,%ebx
+  800659:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80065c:	01 d8                	add    %ebx,%eax
+  80065e:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800660:	8d 40 01             	lea    0x1(%eax),%eax
+  800663:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800666:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800669:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80066c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80066f:	39 c7                	cmp    %eax,%edi
+  800671:	74 46                	je     8006b9 <inet_ntoa+0x98>
+  800673:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800676:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80067b:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80067e:	89 f0                	mov    %esi,%eax
+  800680:	f6 e2                	mul    %dl
+  800682:	66 c1 e8 0b          	shr    $0xb,%ax
+  800686:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800689:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80068c:	01 c9                	add    %ecx,%ecx
+  80068e:	89 d0                	mov    %edx,%eax
+  800690:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800692:	89 d7                	mov    %edx,%edi
+  800694:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800698:	89 d9                	mov    %ebx,%ecx
+  80069a:	83 c3 01             	add    $0x1,%ebx
+  80069d:	0f b6 c9             	movzbl %cl,%ecx
+  8006a0:	83 c0 30             	add    $0x30,%eax
+  8006a3:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  8006a7:	89 f8                	mov    %edi,%eax
+  8006a9:	3c 09                	cmp    $0x9,%al
+  8006ab:	77 d1                	ja     80067e <inet_ntoa+0x5d>
+  8006ad:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8006b0:	88 17                	mov    %dl,(%edi)
+  8006b2:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  8006b5:	89 d8                	mov    %ebx,%eax
+  8006b7:	eb 96                	jmp    80064f <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  8006b9:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  8006bc:	b8 08 60 80 00       	mov    $0x806008,%eax
+  8006c1:	83 c4 1c             	add    $0x1c,%esp
+  8006c4:	5b                   	pop    %ebx
+  8006c5:	5e                   	pop    %esi
+  8006c6:	5f                   	pop    %edi
+  8006c7:	5d                   	pop    %ebp
+  8006c8:	c3                   	ret
+
+008006c9 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  8006c9:	55                   	push   %ebp
+  8006ca:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8006cc:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8006d0:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8006d4:	5d                   	pop    %ebp
+  8006d5:	c3                   	ret
+
+008006d6 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8006d6:	55                   	push   %ebp
+  8006d7:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8006d9:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8006dd:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8006e1:	5d                   	pop    %ebp
+  8006e2:	c3                   	ret
+
+008006e3 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8006e3:	55                   	push   %ebp
+  8006e4:	89 e5                	mov    %esp,%ebp
+  8006e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8006e9:	89 d0                	mov    %edx,%eax
+  8006eb:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8006ee:	89 d1                	mov    %edx,%ecx
+  8006f0:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8006f3:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8006f5:	89 d1                	mov    %edx,%ecx
+  8006f7:	c1 e1 08             	shl    $0x8,%ecx
+  8006fa:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  800700:	09 c8                	or     %ecx,%eax
+  800702:	c1 ea 08             	shr    $0x8,%edx
+  800705:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  80070b:	09 d0                	or     %edx,%eax
+}
+  80070d:	5d                   	pop    %ebp
+  80070e:	c3                   	ret
+
+0080070f <inet_aton>:
+{
+  80070f:	55                   	push   %ebp
+  800710:	89 e5                	mov    %esp,%ebp
+  800712:	57                   	push   %edi
+  800713:	56                   	push   %esi
+  800714:	53                   	push   %ebx
+  800715:	83 ec 2c             	sub    $0x2c,%esp
+  800718:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  80071b:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  80071e:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  800721:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  800724:	e9 9b 00 00 00       	jmp    8007c4 <inet_aton+0xb5>
+      c = *++cp;
+  800729:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  80072d:	89 c1                	mov    %eax,%ecx
+  80072f:	83 e1 df             	and    $0xffffffdf,%ecx
+  800732:	80 f9 58             	cmp    $0x58,%cl
+  800735:	74 10                	je     800747 <inet_aton+0x38>
+      c = *++cp;
+  800737:	83 c2 01             	add    $0x1,%edx
+  80073a:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  80073d:	bf 08 00 00 00       	mov    $0x8,%edi
+  800742:	e9 97 00 00 00       	jmp    8007de <inet_aton+0xcf>
+        c = *++cp;
+  800747:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  80074b:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  80074e:	bf 10 00 00 00       	mov    $0x10,%edi
+  800753:	e9 86 00 00 00       	jmp    8007de <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  800758:	0f af d7             	imul   %edi,%edx
+  80075b:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  80075f:	0f be 01             	movsbl (%ecx),%eax
+  800762:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800765:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800768:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  80076b:	80 fb 09             	cmp    $0x9,%bl
+  80076e:	76 e8                	jbe    800758 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800770:	83 ff 10             	cmp    $0x10,%edi
+  800773:	75 2e                	jne    8007a3 <inet_aton+0x94>
+  800775:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800779:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80077c:	83 e3 df             	and    $0xffffffdf,%ebx
+  80077f:	83 eb 41             	sub    $0x41,%ebx
+  800782:	80 fb 05             	cmp    $0x5,%bl
+  800785:	77 1c                	ja     8007a3 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800787:	c1 e2 04             	shl    $0x4,%edx
+  80078a:	83 c0 0a             	add    $0xa,%eax
+  80078d:	89 f3                	mov    %esi,%ebx
+  80078f:	80 fb 1a             	cmp    $0x1a,%bl
+  800792:	19 db                	sbb    %ebx,%ebx
+  800794:	83 e3 20             	and    $0x20,%ebx
+  800797:	83 c3 41             	add    $0x41,%ebx
+  80079a:	29 d8                	sub    %ebx,%eax
+  80079c:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80079e:	0f be 01             	movsbl (%ecx),%eax
+  8007a1:	eb bf                	jmp    800762 <inet_aton+0x53>
+    if (c == '.') {
+  8007a3:	83 f8 2e             	cmp    $0x2e,%eax
+  8007a6:	75 43                	jne    8007eb <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  8007a8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007ab:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8007ae:	39 f0                	cmp    %esi,%eax
+  8007b0:	0f 84 22 01 00 00    	je     8008d8 <inet_aton+0x1c9>
+      *pp++ = val;
+  8007b6:	83 c0 04             	add    $0x4,%eax
+  8007b9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007bc:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  8007bf:	89 ca                	mov    %ecx,%edx
+  8007c1:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  8007c4:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8007c7:	80 f9 09             	cmp    $0x9,%cl
+  8007ca:	0f 87 01 01 00 00    	ja     8008d1 <inet_aton+0x1c2>
+    base = 10;
+  8007d0:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8007d5:	83 f8 30             	cmp    $0x30,%eax
+  8007d8:	0f 84 4b ff ff ff    	je     800729 <inet_aton+0x1a>
+  8007de:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8007e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007e6:	e9 7a ff ff ff       	jmp    800765 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8007eb:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8007ef:	89 d6                	mov    %edx,%esi
+  8007f1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8007f4:	85 c0                	test   %eax,%eax
+  8007f6:	74 2e                	je     800826 <inet_aton+0x117>
+    return (0);
+  8007f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8007fd:	89 fa                	mov    %edi,%edx
+  8007ff:	80 fa 1f             	cmp    $0x1f,%dl
+  800802:	0f 86 d5 00 00 00    	jbe    8008dd <inet_aton+0x1ce>
+  800808:	84 c0                	test   %al,%al
+  80080a:	0f 88 cd 00 00 00    	js     8008dd <inet_aton+0x1ce>
+  800810:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  800813:	83 f9 04             	cmp    $0x4,%ecx
+  800816:	76 0e                	jbe    800826 <inet_aton+0x117>
+    return (0);
+  800818:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80081d:	83 f8 20             	cmp    $0x20,%eax
+  800820:	0f 85 b7 00 00 00    	jne    8008dd <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  800826:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  800829:	89 d8                	mov    %ebx,%eax
+  80082b:	29 c8                	sub    %ecx,%eax
+  80082d:	c1 f8 02             	sar    $0x2,%eax
+  800830:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800833:	83 f8 02             	cmp    $0x2,%eax
+  800836:	74 7a                	je     8008b2 <inet_aton+0x1a3>
+  800838:	83 f9 03             	cmp    $0x3,%ecx
+  80083b:	7f 49                	jg     800886 <inet_aton+0x177>
+  80083d:	85 c9                	test   %ecx,%ecx
+  80083f:	0f 84 98 00 00 00    	je     8008dd <inet_aton+0x1ce>
+  800845:	83 f9 02             	cmp    $0x2,%ecx
+  800848:	75 19                	jne    800863 <inet_aton+0x154>
+      return (0);
+  80084a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  80084f:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800855:	0f 87 82 00 00 00    	ja     8008dd <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  80085b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80085e:	c1 e0 18             	shl    $0x18,%eax
+  800861:	09 c6                	or     %eax,%esi
+  return (1);
+  800863:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800868:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80086c:	74 6f                	je     8008dd <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  80086e:	83 ec 0c             	sub    $0xc,%esp
+  800871:	56                   	push   %esi
+  800872:	e8 6c fe ff ff       	call   8006e3 <htonl>
+  800877:	83 c4 10             	add    $0x10,%esp
+  80087a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80087d:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80087f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800884:	eb 57                	jmp    8008dd <inet_aton+0x1ce>
+  switch (n) {
+  800886:	83 f9 04             	cmp    $0x4,%ecx
+  800889:	75 d8                	jne    800863 <inet_aton+0x154>
+      return (0);
+  80088b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800890:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800896:	77 45                	ja     8008dd <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800898:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80089b:	c1 e0 18             	shl    $0x18,%eax
+  80089e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008a1:	c1 e1 10             	shl    $0x10,%ecx
+  8008a4:	09 c8                	or     %ecx,%eax
+  8008a6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8008a9:	c1 e1 08             	shl    $0x8,%ecx
+  8008ac:	09 c8                	or     %ecx,%eax
+  8008ae:	09 c6                	or     %eax,%esi
+    break;
+  8008b0:	eb b1                	jmp    800863 <inet_aton+0x154>
+      return (0);
+  8008b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  8008b7:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  8008bd:	77 1e                	ja     8008dd <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  8008bf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8008c2:	c1 e0 18             	shl    $0x18,%eax
+  8008c5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008c8:	c1 e1 10             	shl    $0x10,%ecx
+  8008cb:	09 c8                	or     %ecx,%eax
+  8008cd:	09 c6                	or     %eax,%esi
+    break;
+  8008cf:	eb 92                	jmp    800863 <inet_aton+0x154>
+      return (0);
+  8008d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d6:	eb 05                	jmp    8008dd <inet_aton+0x1ce>
+        return (0);
+  8008d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8008dd:	89 c8                	mov    %ecx,%eax
+  8008df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008e2:	5b                   	pop    %ebx
+  8008e3:	5e                   	pop    %esi
+  8008e4:	5f                   	pop    %edi
+  8008e5:	5d                   	pop    %ebp
+  8008e6:	c3                   	ret
+
+008008e7 <inet_addr>:
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8008ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8008f0:	50                   	push   %eax
+  8008f1:	ff 75 08             	push   0x8(%ebp)
+  8008f4:	e8 16 fe ff ff       	call   80070f <inet_aton>
+  8008f9:	89 c2                	mov    %eax,%edx
+  8008fb:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8008fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  800903:	85 d2                	test   %edx,%edx
+  800905:	75 02                	jne    800909 <inet_addr+0x22>
+}
+  800907:	c9                   	leave
+  800908:	c3                   	ret
+    return (val.s_addr);
+  800909:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80090c:	eb f9                	jmp    800907 <inet_addr+0x20>
+
+0080090e <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  800914:	ff 75 08             	push   0x8(%ebp)
+  800917:	e8 c7 fd ff ff       	call   8006e3 <htonl>
+  80091c:	83 c4 10             	add    $0x10,%esp
+}
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+
+00800921 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800921:	55                   	push   %ebp
+  800922:	89 e5                	mov    %esp,%ebp
+  800924:	57                   	push   %edi
+  800925:	56                   	push   %esi
+  800926:	53                   	push   %ebx
+  800927:	83 ec 0c             	sub    $0xc,%esp
+  80092a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80092d:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800930:	b8 01 00 00 00       	mov    $0x1,%eax
+  800935:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800937:	c1 ea 0b             	shr    $0xb,%edx
+  80093a:	83 f2 01             	xor    $0x1,%edx
+  80093d:	83 e2 01             	and    $0x1,%edx
+  800940:	88 15 04 70 84 00    	mov    %dl,0x847004
+
+	mainenv = NULL;
+  800946:	c7 05 00 70 84 00 00 	movl   $0x0,0x847000
+  80094d:	00 00 00 
+	envid = sys_getenvid();
+  800950:	e8 1f 0c 00 00       	call   801574 <sys_getenvid>
+  800955:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800957:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80095c:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800962:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800968:	8b 52 48             	mov    0x48(%edx),%edx
+  80096b:	39 ca                	cmp    %ecx,%edx
+  80096d:	74 27                	je     800996 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80096f:	83 c0 01             	add    $0x1,%eax
+  800972:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800977:	75 e3                	jne    80095c <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800979:	83 3d 00 70 84 00 00 	cmpl   $0x0,0x847000
+  800980:	75 24                	jne    8009a6 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800982:	83 ec 04             	sub    $0x4,%esp
+  800985:	68 f8 3e 80 00       	push   $0x803ef8
+  80098a:	6a 23                	push   $0x23
+  80098c:	68 1b 3f 80 00       	push   $0x803f1b
+  800991:	e8 4f 00 00 00       	call   8009e5 <_panic>
+			mainenv = &envs[i];
+  800996:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80099c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8009a1:	a3 00 70 84 00       	mov    %eax,0x847000
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8009a6:	85 ff                	test   %edi,%edi
+  8009a8:	7e 07                	jle    8009b1 <libmain+0x90>
+		binaryname = argv[0];
+  8009aa:	8b 06                	mov    (%esi),%eax
+  8009ac:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8009b1:	83 ec 08             	sub    $0x8,%esp
+  8009b4:	56                   	push   %esi
+  8009b5:	57                   	push   %edi
+  8009b6:	e8 78 f6 ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8009bb:	e8 0b 00 00 00       	call   8009cb <exit>
+}
+  8009c0:	83 c4 10             	add    $0x10,%esp
+  8009c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009c6:	5b                   	pop    %ebx
+  8009c7:	5e                   	pop    %esi
+  8009c8:	5f                   	pop    %edi
+  8009c9:	5d                   	pop    %ebp
+  8009ca:	c3                   	ret
+
+008009cb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8009cb:	55                   	push   %ebp
+  8009cc:	89 e5                	mov    %esp,%ebp
+  8009ce:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8009d1:	e8 1c 21 00 00       	call   802af2 <close_all>
+	sys_env_destroy(0);
+  8009d6:	83 ec 0c             	sub    $0xc,%esp
+  8009d9:	6a 00                	push   $0x0
+  8009db:	e8 2b 0b 00 00       	call   80150b <sys_env_destroy>
+}
+  8009e0:	83 c4 10             	add    $0x10,%esp
+  8009e3:	c9                   	leave
+  8009e4:	c3                   	ret
+
+008009e5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	56                   	push   %esi
+  8009e9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8009ea:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8009ed:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8009f3:	e8 7c 0b 00 00       	call   801574 <sys_getenvid>
+  8009f8:	83 ec 0c             	sub    $0xc,%esp
+  8009fb:	ff 75 0c             	push   0xc(%ebp)
+  8009fe:	ff 75 08             	push   0x8(%ebp)
+  800a01:	56                   	push   %esi
+  800a02:	50                   	push   %eax
+  800a03:	68 34 3f 80 00       	push   $0x803f34
+  800a08:	e8 b3 00 00 00       	call   800ac0 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800a0d:	83 c4 18             	add    $0x18,%esp
+  800a10:	53                   	push   %ebx
+  800a11:	ff 75 10             	push   0x10(%ebp)
+  800a14:	e8 56 00 00 00       	call   800a6f <vcprintf>
+	cprintf("\n");
+  800a19:	c7 04 24 db 3d 80 00 	movl   $0x803ddb,(%esp)
+  800a20:	e8 9b 00 00 00       	call   800ac0 <cprintf>
+  800a25:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800a28:	cc                   	int3
+	while (1)
+  800a29:	eb fd                	jmp    800a28 <_panic+0x43>
+
+00800a2b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	53                   	push   %ebx
+  800a2f:	83 ec 04             	sub    $0x4,%esp
+  800a32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800a35:	8b 13                	mov    (%ebx),%edx
+  800a37:	8d 42 01             	lea    0x1(%edx),%eax
+  800a3a:	89 03                	mov    %eax,(%ebx)
+  800a3c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a3f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800a43:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800a48:	74 09                	je     800a53 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800a4a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800a4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a51:	c9                   	leave
+  800a52:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800a53:	83 ec 08             	sub    $0x8,%esp
+  800a56:	68 ff 00 00 00       	push   $0xff
+  800a5b:	8d 43 08             	lea    0x8(%ebx),%eax
+  800a5e:	50                   	push   %eax
+  800a5f:	e8 1d 0a 00 00       	call   801481 <sys_cputs>
+		b->idx = 0;
+  800a64:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800a6a:	83 c4 10             	add    $0x10,%esp
+  800a6d:	eb db                	jmp    800a4a <putch+0x1f>
+
+00800a6f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800a6f:	55                   	push   %ebp
+  800a70:	89 e5                	mov    %esp,%ebp
+  800a72:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800a78:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800a7f:	00 00 00 
+	b.cnt = 0;
+  800a82:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800a89:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800a8c:	ff 75 0c             	push   0xc(%ebp)
+  800a8f:	ff 75 08             	push   0x8(%ebp)
+  800a92:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800a98:	50                   	push   %eax
+  800a99:	68 2b 0a 80 00       	push   $0x800a2b
+  800a9e:	e8 fb 00 00 00       	call   800b9e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800aa3:	83 c4 08             	add    $0x8,%esp
+  800aa6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800aac:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800ab2:	50                   	push   %eax
+  800ab3:	e8 c9 09 00 00       	call   801481 <sys_cputs>
+
+	return b.cnt;
+}
+  800ab8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800abe:	c9                   	leave
+  800abf:	c3                   	ret
+
+00800ac0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800ac6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800ac9:	50                   	push   %eax
+  800aca:	ff 75 08             	push   0x8(%ebp)
+  800acd:	e8 9d ff ff ff       	call   800a6f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800ad2:	c9                   	leave
+  800ad3:	c3                   	ret
+
+00800ad4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	57                   	push   %edi
+  800ad8:	56                   	push   %esi
+  800ad9:	53                   	push   %ebx
+  800ada:	83 ec 1c             	sub    $0x1c,%esp
+  800add:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ae0:	89 d6                	mov    %edx,%esi
+  800ae2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800ae5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800ae8:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800aeb:	73 0b                	jae    800af8 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800aed:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800af0:	c1 e7 08             	shl    $0x8,%edi
+  800af3:	0b 7d 10             	or     0x10(%ebp),%edi
+  800af6:	eb 36                	jmp    800b2e <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800af8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800afb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b00:	f7 75 08             	divl   0x8(%ebp)
+  800b03:	89 c1                	mov    %eax,%ecx
+  800b05:	ff 75 14             	push   0x14(%ebp)
+  800b08:	ff 75 10             	push   0x10(%ebp)
+  800b0b:	83 eb 01             	sub    $0x1,%ebx
+  800b0e:	53                   	push   %ebx
+  800b0f:	ff 75 08             	push   0x8(%ebp)
+  800b12:	89 f2                	mov    %esi,%edx
+  800b14:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b17:	e8 b8 ff ff ff       	call   800ad4 <printnum>
+  800b1c:	83 c4 10             	add    $0x10,%esp
+  800b1f:	eb 14                	jmp    800b35 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800b21:	83 ec 08             	sub    $0x8,%esp
+  800b24:	56                   	push   %esi
+  800b25:	57                   	push   %edi
+  800b26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b29:	ff d0                	call   *%eax
+  800b2b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800b2e:	83 eb 01             	sub    $0x1,%ebx
+  800b31:	85 db                	test   %ebx,%ebx
+  800b33:	7f ec                	jg     800b21 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800b35:	83 ec 08             	sub    $0x8,%esp
+  800b38:	56                   	push   %esi
+  800b39:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b41:	f7 75 08             	divl   0x8(%ebp)
+  800b44:	0f be 92 57 3f 80 00 	movsbl 0x803f57(%edx),%edx
+  800b4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4e:	c1 e0 08             	shl    $0x8,%eax
+  800b51:	09 d0                	or     %edx,%eax
+  800b53:	50                   	push   %eax
+  800b54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b57:	ff d0                	call   *%eax
+}
+  800b59:	83 c4 10             	add    $0x10,%esp
+  800b5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b5f:	5b                   	pop    %ebx
+  800b60:	5e                   	pop    %esi
+  800b61:	5f                   	pop    %edi
+  800b62:	5d                   	pop    %ebp
+  800b63:	c3                   	ret
+
+00800b64 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800b64:	55                   	push   %ebp
+  800b65:	89 e5                	mov    %esp,%ebp
+  800b67:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800b6a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800b6e:	8b 10                	mov    (%eax),%edx
+  800b70:	3b 50 04             	cmp    0x4(%eax),%edx
+  800b73:	73 0a                	jae    800b7f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800b75:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800b78:	89 08                	mov    %ecx,(%eax)
+  800b7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7d:	88 02                	mov    %al,(%edx)
+}
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <printfmt>:
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800b87:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800b8a:	50                   	push   %eax
+  800b8b:	ff 75 10             	push   0x10(%ebp)
+  800b8e:	ff 75 0c             	push   0xc(%ebp)
+  800b91:	ff 75 08             	push   0x8(%ebp)
+  800b94:	e8 05 00 00 00       	call   800b9e <vprintfmt>
+}
+  800b99:	83 c4 10             	add    $0x10,%esp
+  800b9c:	c9                   	leave
+  800b9d:	c3                   	ret
+
+00800b9e <vprintfmt>:
+{
+  800b9e:	55                   	push   %ebp
+  800b9f:	89 e5                	mov    %esp,%ebp
+  800ba1:	57                   	push   %edi
+  800ba2:	56                   	push   %esi
+  800ba3:	53                   	push   %ebx
+  800ba4:	83 ec 3c             	sub    $0x3c,%esp
+  800ba7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800baa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800bad:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800bb4:	eb 16                	jmp    800bcc <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800bb6:	83 ec 08             	sub    $0x8,%esp
+  800bb9:	ff 75 0c             	push   0xc(%ebp)
+  800bbc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800bbf:	c1 e2 08             	shl    $0x8,%edx
+  800bc2:	09 d0                	or     %edx,%eax
+  800bc4:	50                   	push   %eax
+  800bc5:	ff d7                	call   *%edi
+  800bc7:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800bca:	89 de                	mov    %ebx,%esi
+  800bcc:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800bcf:	0f b6 06             	movzbl (%esi),%eax
+  800bd2:	83 f8 25             	cmp    $0x25,%eax
+  800bd5:	74 0c                	je     800be3 <vprintfmt+0x45>
+			if (ch == '\0')
+  800bd7:	85 c0                	test   %eax,%eax
+  800bd9:	75 db                	jne    800bb6 <vprintfmt+0x18>
+}
+  800bdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bde:	5b                   	pop    %ebx
+  800bdf:	5e                   	pop    %esi
+  800be0:	5f                   	pop    %edi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+		padc = ' ';
+  800be3:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800be7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800bee:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800bf5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800bfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800c01:	8d 73 01             	lea    0x1(%ebx),%esi
+  800c04:	0f b6 13             	movzbl (%ebx),%edx
+  800c07:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800c0a:	3c 55                	cmp    $0x55,%al
+  800c0c:	0f 87 2c 04 00 00    	ja     80103e <vprintfmt+0x4a0>
+  800c12:	0f b6 c0             	movzbl %al,%eax
+  800c15:	ff 24 85 a0 40 80 00 	jmp    *0x8040a0(,%eax,4)
+  800c1c:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800c1e:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800c22:	eb dd                	jmp    800c01 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800c24:	89 f3                	mov    %esi,%ebx
+  800c26:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800c2a:	eb d5                	jmp    800c01 <vprintfmt+0x63>
+  800c2c:	0f b6 d2             	movzbl %dl,%edx
+  800c2f:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800c31:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800c36:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800c39:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800c3d:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800c40:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800c43:	83 fe 09             	cmp    $0x9,%esi
+  800c46:	0f 87 8a 00 00 00    	ja     800cd6 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800c4c:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800c4f:	eb e5                	jmp    800c36 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800c51:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c54:	8b 00                	mov    (%eax),%eax
+  800c56:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800c59:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c5c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c5f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800c62:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800c64:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800c68:	79 97                	jns    800c01 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800c6a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800c6d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c70:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800c77:	eb 88                	jmp    800c01 <vprintfmt+0x63>
+			if (width < 0)
+  800c79:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800c7c:	85 db                	test   %ebx,%ebx
+  800c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c83:	0f 49 c3             	cmovns %ebx,%eax
+  800c86:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800c89:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800c8b:	e9 71 ff ff ff       	jmp    800c01 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800c90:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800c92:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800c99:	e9 63 ff ff ff       	jmp    800c01 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800c9e:	8d 73 02             	lea    0x2(%ebx),%esi
+  800ca1:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800ca5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800cac:	3c 67                	cmp    $0x67,%al
+  800cae:	0f 84 18 ff ff ff    	je     800bcc <vprintfmt+0x2e>
+					attrib = 0x04;
+  800cb4:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800cbb:	3c 72                	cmp    $0x72,%al
+  800cbd:	0f 84 09 ff ff ff    	je     800bcc <vprintfmt+0x2e>
+					attrib = 0x00;
+  800cc3:	3c 62                	cmp    $0x62,%al
+  800cc5:	0f 94 c0             	sete   %al
+  800cc8:	0f b6 c0             	movzbl %al,%eax
+  800ccb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800cce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800cd1:	e9 f6 fe ff ff       	jmp    800bcc <vprintfmt+0x2e>
+  800cd6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800cd9:	eb 89                	jmp    800c64 <vprintfmt+0xc6>
+			lflag++;
+  800cdb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800cde:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800ce0:	e9 1c ff ff ff       	jmp    800c01 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800ce5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce8:	8d 58 04             	lea    0x4(%eax),%ebx
+  800ceb:	83 ec 08             	sub    $0x8,%esp
+  800cee:	ff 75 0c             	push   0xc(%ebp)
+  800cf1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800cf4:	c1 e0 08             	shl    $0x8,%eax
+  800cf7:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800cfa:	0b 01                	or     (%ecx),%eax
+  800cfc:	50                   	push   %eax
+  800cfd:	ff d7                	call   *%edi
+			break;
+  800cff:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800d02:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800d05:	e9 c2 fe ff ff       	jmp    800bcc <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800d0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d0d:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800d10:	8b 10                	mov    (%eax),%edx
+  800d12:	89 d0                	mov    %edx,%eax
+  800d14:	f7 d8                	neg    %eax
+  800d16:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d19:	83 f8 12             	cmp    $0x12,%eax
+  800d1c:	7f 25                	jg     800d43 <vprintfmt+0x1a5>
+  800d1e:	8b 14 85 00 42 80 00 	mov    0x804200(,%eax,4),%edx
+  800d25:	85 d2                	test   %edx,%edx
+  800d27:	74 1a                	je     800d43 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800d29:	52                   	push   %edx
+  800d2a:	68 42 43 80 00       	push   $0x804342
+  800d2f:	ff 75 0c             	push   0xc(%ebp)
+  800d32:	57                   	push   %edi
+  800d33:	e8 49 fe ff ff       	call   800b81 <printfmt>
+  800d38:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800d3b:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800d3e:	e9 89 fe ff ff       	jmp    800bcc <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800d43:	50                   	push   %eax
+  800d44:	68 6f 3f 80 00       	push   $0x803f6f
+  800d49:	ff 75 0c             	push   0xc(%ebp)
+  800d4c:	57                   	push   %edi
+  800d4d:	e8 2f fe ff ff       	call   800b81 <printfmt>
+  800d52:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800d55:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800d58:	e9 6f fe ff ff       	jmp    800bcc <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800d5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d60:	83 c0 04             	add    $0x4,%eax
+  800d63:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800d66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d69:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800d6b:	85 c9                	test   %ecx,%ecx
+  800d6d:	b8 68 3f 80 00       	mov    $0x803f68,%eax
+  800d72:	0f 45 c1             	cmovne %ecx,%eax
+  800d75:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800d78:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800d7c:	7e 06                	jle    800d84 <vprintfmt+0x1e6>
+  800d7e:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800d82:	75 1a                	jne    800d9e <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800d84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800d87:	c1 e0 08             	shl    $0x8,%eax
+  800d8a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800d8d:	83 c8 3f             	or     $0x3f,%eax
+  800d90:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800d93:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800d96:	89 75 10             	mov    %esi,0x10(%ebp)
+  800d99:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800d9c:	eb 6d                	jmp    800e0b <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d9e:	83 ec 08             	sub    $0x8,%esp
+  800da1:	ff 75 d0             	push   -0x30(%ebp)
+  800da4:	ff 75 c8             	push   -0x38(%ebp)
+  800da7:	e8 39 03 00 00       	call   8010e5 <strnlen>
+  800dac:	89 c2                	mov    %eax,%edx
+  800dae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800db1:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800db3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800db6:	c1 e1 08             	shl    $0x8,%ecx
+  800db9:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800dbd:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dbf:	83 c4 10             	add    $0x10,%esp
+  800dc2:	89 c3                	mov    %eax,%ebx
+  800dc4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800dc7:	89 75 10             	mov    %esi,0x10(%ebp)
+  800dca:	89 ce                	mov    %ecx,%esi
+  800dcc:	eb 0f                	jmp    800ddd <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800dce:	83 ec 08             	sub    $0x8,%esp
+  800dd1:	ff 75 0c             	push   0xc(%ebp)
+  800dd4:	56                   	push   %esi
+  800dd5:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dd7:	83 eb 01             	sub    $0x1,%ebx
+  800dda:	83 c4 10             	add    $0x10,%esp
+  800ddd:	85 db                	test   %ebx,%ebx
+  800ddf:	7f ed                	jg     800dce <vprintfmt+0x230>
+  800de1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800de4:	8b 75 10             	mov    0x10(%ebp),%esi
+  800de7:	85 c0                	test   %eax,%eax
+  800de9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dee:	0f 49 d0             	cmovns %eax,%edx
+  800df1:	29 d0                	sub    %edx,%eax
+  800df3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800df6:	eb 8c                	jmp    800d84 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800df8:	83 ec 08             	sub    $0x8,%esp
+  800dfb:	ff 75 0c             	push   0xc(%ebp)
+  800dfe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800e01:	09 c2                	or     %eax,%edx
+  800e03:	52                   	push   %edx
+  800e04:	ff d7                	call   *%edi
+  800e06:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e09:	89 d9                	mov    %ebx,%ecx
+  800e0b:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800e0e:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800e12:	0f be d0             	movsbl %al,%edx
+  800e15:	85 d2                	test   %edx,%edx
+  800e17:	74 2a                	je     800e43 <vprintfmt+0x2a5>
+  800e19:	85 f6                	test   %esi,%esi
+  800e1b:	78 05                	js     800e22 <vprintfmt+0x284>
+  800e1d:	83 ee 01             	sub    $0x1,%esi
+  800e20:	78 3b                	js     800e5d <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e22:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e26:	74 d0                	je     800df8 <vprintfmt+0x25a>
+  800e28:	0f be c0             	movsbl %al,%eax
+  800e2b:	83 e8 20             	sub    $0x20,%eax
+  800e2e:	83 f8 5e             	cmp    $0x5e,%eax
+  800e31:	76 c5                	jbe    800df8 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800e33:	83 ec 08             	sub    $0x8,%esp
+  800e36:	ff 75 0c             	push   0xc(%ebp)
+  800e39:	ff 75 cc             	push   -0x34(%ebp)
+  800e3c:	ff d7                	call   *%edi
+  800e3e:	83 c4 10             	add    $0x10,%esp
+  800e41:	eb c6                	jmp    800e09 <vprintfmt+0x26b>
+  800e43:	8b 75 10             	mov    0x10(%ebp),%esi
+  800e46:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800e49:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800e4c:	01 c3                	add    %eax,%ebx
+  800e4e:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800e50:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800e53:	83 c8 20             	or     $0x20,%eax
+  800e56:	89 75 10             	mov    %esi,0x10(%ebp)
+  800e59:	89 c6                	mov    %eax,%esi
+  800e5b:	eb 14                	jmp    800e71 <vprintfmt+0x2d3>
+  800e5d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800e60:	eb e4                	jmp    800e46 <vprintfmt+0x2a8>
+  800e62:	83 ec 08             	sub    $0x8,%esp
+  800e65:	ff 75 0c             	push   0xc(%ebp)
+  800e68:	56                   	push   %esi
+  800e69:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800e6b:	83 eb 01             	sub    $0x1,%ebx
+  800e6e:	83 c4 10             	add    $0x10,%esp
+  800e71:	85 db                	test   %ebx,%ebx
+  800e73:	7f ed                	jg     800e62 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800e75:	8b 75 10             	mov    0x10(%ebp),%esi
+  800e78:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800e7b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e7e:	e9 49 fd ff ff       	jmp    800bcc <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800e83:	83 f9 01             	cmp    $0x1,%ecx
+  800e86:	7f 1f                	jg     800ea7 <vprintfmt+0x309>
+	else if (lflag)
+  800e88:	85 c9                	test   %ecx,%ecx
+  800e8a:	74 69                	je     800ef5 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800e8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e8f:	8b 00                	mov    (%eax),%eax
+  800e91:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e94:	89 c1                	mov    %eax,%ecx
+  800e96:	c1 f9 1f             	sar    $0x1f,%ecx
+  800e99:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e9f:	8d 40 04             	lea    0x4(%eax),%eax
+  800ea2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ea5:	eb 17                	jmp    800ebe <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800ea7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eaa:	8b 50 04             	mov    0x4(%eax),%edx
+  800ead:	8b 00                	mov    (%eax),%eax
+  800eaf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800eb2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800eb5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eb8:	8d 40 08             	lea    0x8(%eax),%eax
+  800ebb:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800ebe:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800ec1:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800ec4:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800ec9:	85 db                	test   %ebx,%ebx
+  800ecb:	0f 89 f6 00 00 00    	jns    800fc7 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800ed1:	83 ec 08             	sub    $0x8,%esp
+  800ed4:	ff 75 0c             	push   0xc(%ebp)
+  800ed7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800eda:	c1 e0 08             	shl    $0x8,%eax
+  800edd:	83 c8 2d             	or     $0x2d,%eax
+  800ee0:	50                   	push   %eax
+  800ee1:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800ee3:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800ee6:	f7 d9                	neg    %ecx
+  800ee8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800eeb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ef0:	e9 d2 00 00 00       	jmp    800fc7 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800ef5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef8:	8b 00                	mov    (%eax),%eax
+  800efa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800efd:	89 c1                	mov    %eax,%ecx
+  800eff:	c1 f9 1f             	sar    $0x1f,%ecx
+  800f02:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800f05:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f08:	8d 40 04             	lea    0x4(%eax),%eax
+  800f0b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f0e:	eb ae                	jmp    800ebe <vprintfmt+0x320>
+	if (lflag >= 2)
+  800f10:	83 f9 01             	cmp    $0x1,%ecx
+  800f13:	7f 19                	jg     800f2e <vprintfmt+0x390>
+	else if (lflag)
+  800f15:	85 c9                	test   %ecx,%ecx
+  800f17:	74 2a                	je     800f43 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800f19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f1c:	8b 08                	mov    (%eax),%ecx
+  800f1e:	8d 40 04             	lea    0x4(%eax),%eax
+  800f21:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f24:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800f29:	e9 99 00 00 00       	jmp    800fc7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800f2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f31:	8b 08                	mov    (%eax),%ecx
+  800f33:	8d 40 08             	lea    0x8(%eax),%eax
+  800f36:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f39:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800f3e:	e9 84 00 00 00       	jmp    800fc7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800f43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f46:	8b 08                	mov    (%eax),%ecx
+  800f48:	8d 40 04             	lea    0x4(%eax),%eax
+  800f4b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f4e:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800f53:	eb 72                	jmp    800fc7 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800f55:	83 f9 01             	cmp    $0x1,%ecx
+  800f58:	7f 16                	jg     800f70 <vprintfmt+0x3d2>
+	else if (lflag)
+  800f5a:	85 c9                	test   %ecx,%ecx
+  800f5c:	74 24                	je     800f82 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800f5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f61:	8b 08                	mov    (%eax),%ecx
+  800f63:	8d 40 04             	lea    0x4(%eax),%eax
+  800f66:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f69:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800f6e:	eb 57                	jmp    800fc7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800f70:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f73:	8b 08                	mov    (%eax),%ecx
+  800f75:	8d 40 08             	lea    0x8(%eax),%eax
+  800f78:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f7b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800f80:	eb 45                	jmp    800fc7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800f82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f85:	8b 08                	mov    (%eax),%ecx
+  800f87:	8d 40 04             	lea    0x4(%eax),%eax
+  800f8a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f8d:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800f92:	eb 33                	jmp    800fc7 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800f94:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800f97:	c1 e3 08             	shl    $0x8,%ebx
+  800f9a:	83 ec 08             	sub    $0x8,%esp
+  800f9d:	ff 75 0c             	push   0xc(%ebp)
+  800fa0:	89 d8                	mov    %ebx,%eax
+  800fa2:	83 c8 30             	or     $0x30,%eax
+  800fa5:	50                   	push   %eax
+  800fa6:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800fa8:	83 c4 08             	add    $0x8,%esp
+  800fab:	ff 75 0c             	push   0xc(%ebp)
+  800fae:	83 cb 78             	or     $0x78,%ebx
+  800fb1:	53                   	push   %ebx
+  800fb2:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800fb4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fb7:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800fb9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800fbc:	8d 40 04             	lea    0x4(%eax),%eax
+  800fbf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800fc2:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800fc7:	ff 75 e4             	push   -0x1c(%ebp)
+  800fca:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800fce:	52                   	push   %edx
+  800fcf:	ff 75 e0             	push   -0x20(%ebp)
+  800fd2:	50                   	push   %eax
+  800fd3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fd6:	89 f8                	mov    %edi,%eax
+  800fd8:	e8 f7 fa ff ff       	call   800ad4 <printnum>
+			break;
+  800fdd:	83 c4 10             	add    $0x10,%esp
+  800fe0:	e9 e7 fb ff ff       	jmp    800bcc <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800fe5:	83 f9 01             	cmp    $0x1,%ecx
+  800fe8:	7f 16                	jg     801000 <vprintfmt+0x462>
+	else if (lflag)
+  800fea:	85 c9                	test   %ecx,%ecx
+  800fec:	74 24                	je     801012 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800fee:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ff1:	8b 08                	mov    (%eax),%ecx
+  800ff3:	8d 40 04             	lea    0x4(%eax),%eax
+  800ff6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ff9:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800ffe:	eb c7                	jmp    800fc7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  801000:	8b 45 14             	mov    0x14(%ebp),%eax
+  801003:	8b 08                	mov    (%eax),%ecx
+  801005:	8d 40 08             	lea    0x8(%eax),%eax
+  801008:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80100b:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  801010:	eb b5                	jmp    800fc7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  801012:	8b 45 14             	mov    0x14(%ebp),%eax
+  801015:	8b 08                	mov    (%eax),%ecx
+  801017:	8d 40 04             	lea    0x4(%eax),%eax
+  80101a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80101d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  801022:	eb a3                	jmp    800fc7 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  801024:	83 ec 08             	sub    $0x8,%esp
+  801027:	ff 75 0c             	push   0xc(%ebp)
+  80102a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80102d:	c1 e0 08             	shl    $0x8,%eax
+  801030:	83 c8 25             	or     $0x25,%eax
+  801033:	50                   	push   %eax
+  801034:	ff d7                	call   *%edi
+			break;
+  801036:	83 c4 10             	add    $0x10,%esp
+  801039:	e9 8e fb ff ff       	jmp    800bcc <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80103e:	83 ec 08             	sub    $0x8,%esp
+  801041:	ff 75 0c             	push   0xc(%ebp)
+  801044:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801047:	c1 e0 08             	shl    $0x8,%eax
+  80104a:	83 c8 25             	or     $0x25,%eax
+  80104d:	50                   	push   %eax
+  80104e:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801050:	83 c4 10             	add    $0x10,%esp
+  801053:	89 de                	mov    %ebx,%esi
+  801055:	eb 03                	jmp    80105a <vprintfmt+0x4bc>
+  801057:	83 ee 01             	sub    $0x1,%esi
+  80105a:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80105e:	75 f7                	jne    801057 <vprintfmt+0x4b9>
+  801060:	e9 67 fb ff ff       	jmp    800bcc <vprintfmt+0x2e>
+
+00801065 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	83 ec 18             	sub    $0x18,%esp
+  80106b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80106e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801071:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801074:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801078:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80107b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801082:	85 c0                	test   %eax,%eax
+  801084:	74 26                	je     8010ac <vsnprintf+0x47>
+  801086:	85 d2                	test   %edx,%edx
+  801088:	7e 22                	jle    8010ac <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80108a:	ff 75 14             	push   0x14(%ebp)
+  80108d:	ff 75 10             	push   0x10(%ebp)
+  801090:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801093:	50                   	push   %eax
+  801094:	68 64 0b 80 00       	push   $0x800b64
+  801099:	e8 00 fb ff ff       	call   800b9e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80109e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010a1:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8010a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010a7:	83 c4 10             	add    $0x10,%esp
+}
+  8010aa:	c9                   	leave
+  8010ab:	c3                   	ret
+		return -E_INVAL;
+  8010ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010b1:	eb f7                	jmp    8010aa <vsnprintf+0x45>
+
+008010b3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8010b9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8010bc:	50                   	push   %eax
+  8010bd:	ff 75 10             	push   0x10(%ebp)
+  8010c0:	ff 75 0c             	push   0xc(%ebp)
+  8010c3:	ff 75 08             	push   0x8(%ebp)
+  8010c6:	e8 9a ff ff ff       	call   801065 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8010cb:	c9                   	leave
+  8010cc:	c3                   	ret
+
+008010cd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8010cd:	55                   	push   %ebp
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8010d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d8:	eb 03                	jmp    8010dd <strlen+0x10>
+		n++;
+  8010da:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8010dd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8010e1:	75 f7                	jne    8010da <strlen+0xd>
+	return n;
+}
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+
+008010e5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f3:	eb 03                	jmp    8010f8 <strnlen+0x13>
+		n++;
+  8010f5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010f8:	39 d0                	cmp    %edx,%eax
+  8010fa:	74 08                	je     801104 <strnlen+0x1f>
+  8010fc:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801100:	75 f3                	jne    8010f5 <strnlen+0x10>
+  801102:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  801104:	89 d0                	mov    %edx,%eax
+  801106:	5d                   	pop    %ebp
+  801107:	c3                   	ret
+
+00801108 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801108:	55                   	push   %ebp
+  801109:	89 e5                	mov    %esp,%ebp
+  80110b:	53                   	push   %ebx
+  80110c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80110f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801112:	b8 00 00 00 00       	mov    $0x0,%eax
+  801117:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80111b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80111e:	83 c0 01             	add    $0x1,%eax
+  801121:	84 d2                	test   %dl,%dl
+  801123:	75 f2                	jne    801117 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801125:	89 c8                	mov    %ecx,%eax
+  801127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80112a:	c9                   	leave
+  80112b:	c3                   	ret
+
+0080112c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80112c:	55                   	push   %ebp
+  80112d:	89 e5                	mov    %esp,%ebp
+  80112f:	53                   	push   %ebx
+  801130:	83 ec 10             	sub    $0x10,%esp
+  801133:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801136:	53                   	push   %ebx
+  801137:	e8 91 ff ff ff       	call   8010cd <strlen>
+  80113c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80113f:	ff 75 0c             	push   0xc(%ebp)
+  801142:	01 d8                	add    %ebx,%eax
+  801144:	50                   	push   %eax
+  801145:	e8 be ff ff ff       	call   801108 <strcpy>
+	return dst;
+}
+  80114a:	89 d8                	mov    %ebx,%eax
+  80114c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80114f:	c9                   	leave
+  801150:	c3                   	ret
+
+00801151 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801151:	55                   	push   %ebp
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	56                   	push   %esi
+  801155:	53                   	push   %ebx
+  801156:	8b 75 08             	mov    0x8(%ebp),%esi
+  801159:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80115c:	89 f3                	mov    %esi,%ebx
+  80115e:	03 5d 10             	add    0x10(%ebp),%ebx
+  801161:	89 f0                	mov    %esi,%eax
+  801163:	eb 0f                	jmp    801174 <strncpy+0x23>
+		*dst++ = *src;
+  801165:	83 c0 01             	add    $0x1,%eax
+  801168:	0f b6 0a             	movzbl (%edx),%ecx
+  80116b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80116e:	80 f9 01             	cmp    $0x1,%cl
+  801171:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801174:	39 d8                	cmp    %ebx,%eax
+  801176:	75 ed                	jne    801165 <strncpy+0x14>
+	}
+	return ret;
+}
+  801178:	89 f0                	mov    %esi,%eax
+  80117a:	5b                   	pop    %ebx
+  80117b:	5e                   	pop    %esi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+
+0080117e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	8b 75 08             	mov    0x8(%ebp),%esi
+  801186:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801189:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80118c:	89 f0                	mov    %esi,%eax
+  80118e:	85 d2                	test   %edx,%edx
+  801190:	74 21                	je     8011b3 <strlcpy+0x35>
+  801192:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801196:	89 f2                	mov    %esi,%edx
+  801198:	eb 09                	jmp    8011a3 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80119a:	83 c1 01             	add    $0x1,%ecx
+  80119d:	83 c2 01             	add    $0x1,%edx
+  8011a0:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8011a3:	39 c2                	cmp    %eax,%edx
+  8011a5:	74 09                	je     8011b0 <strlcpy+0x32>
+  8011a7:	0f b6 19             	movzbl (%ecx),%ebx
+  8011aa:	84 db                	test   %bl,%bl
+  8011ac:	75 ec                	jne    80119a <strlcpy+0x1c>
+  8011ae:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8011b0:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8011b3:	29 f0                	sub    %esi,%eax
+}
+  8011b5:	5b                   	pop    %ebx
+  8011b6:	5e                   	pop    %esi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+
+008011b9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8011bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8011c2:	eb 06                	jmp    8011ca <strcmp+0x11>
+		p++, q++;
+  8011c4:	83 c1 01             	add    $0x1,%ecx
+  8011c7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8011ca:	0f b6 01             	movzbl (%ecx),%eax
+  8011cd:	84 c0                	test   %al,%al
+  8011cf:	74 04                	je     8011d5 <strcmp+0x1c>
+  8011d1:	3a 02                	cmp    (%edx),%al
+  8011d3:	74 ef                	je     8011c4 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8011d5:	0f b6 c0             	movzbl %al,%eax
+  8011d8:	0f b6 12             	movzbl (%edx),%edx
+  8011db:	29 d0                	sub    %edx,%eax
+}
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	53                   	push   %ebx
+  8011e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e9:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8011ec:	eb 09                	jmp    8011f7 <strncmp+0x18>
+		n--, p++, q++;
+  8011ee:	83 ea 01             	sub    $0x1,%edx
+  8011f1:	83 c0 01             	add    $0x1,%eax
+  8011f4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8011f7:	85 d2                	test   %edx,%edx
+  8011f9:	74 18                	je     801213 <strncmp+0x34>
+  8011fb:	0f b6 18             	movzbl (%eax),%ebx
+  8011fe:	84 db                	test   %bl,%bl
+  801200:	74 04                	je     801206 <strncmp+0x27>
+  801202:	3a 19                	cmp    (%ecx),%bl
+  801204:	74 e8                	je     8011ee <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801206:	0f b6 00             	movzbl (%eax),%eax
+  801209:	0f b6 11             	movzbl (%ecx),%edx
+  80120c:	29 d0                	sub    %edx,%eax
+}
+  80120e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801211:	c9                   	leave
+  801212:	c3                   	ret
+		return 0;
+  801213:	b8 00 00 00 00       	mov    $0x0,%eax
+  801218:	eb f4                	jmp    80120e <strncmp+0x2f>
+
+0080121a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801220:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801224:	eb 03                	jmp    801229 <strchr+0xf>
+  801226:	83 c0 01             	add    $0x1,%eax
+  801229:	0f b6 10             	movzbl (%eax),%edx
+  80122c:	84 d2                	test   %dl,%dl
+  80122e:	74 06                	je     801236 <strchr+0x1c>
+		if (*s == c)
+  801230:	38 ca                	cmp    %cl,%dl
+  801232:	75 f2                	jne    801226 <strchr+0xc>
+  801234:	eb 05                	jmp    80123b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801236:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80123b:	5d                   	pop    %ebp
+  80123c:	c3                   	ret
+
+0080123d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	8b 45 08             	mov    0x8(%ebp),%eax
+  801243:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801247:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80124a:	38 ca                	cmp    %cl,%dl
+  80124c:	74 09                	je     801257 <strfind+0x1a>
+  80124e:	84 d2                	test   %dl,%dl
+  801250:	74 05                	je     801257 <strfind+0x1a>
+	for (; *s; s++)
+  801252:	83 c0 01             	add    $0x1,%eax
+  801255:	eb f0                	jmp    801247 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801257:	5d                   	pop    %ebp
+  801258:	c3                   	ret
+
+00801259 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	57                   	push   %edi
+  80125d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801260:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801263:	85 c9                	test   %ecx,%ecx
+  801265:	74 20                	je     801287 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801267:	89 f8                	mov    %edi,%eax
+  801269:	09 c8                	or     %ecx,%eax
+  80126b:	a8 03                	test   $0x3,%al
+  80126d:	75 12                	jne    801281 <memset+0x28>
+		c &= 0xFF;
+  80126f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801273:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801279:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80127c:	fc                   	cld
+  80127d:	f3 ab                	rep stos %eax,%es:(%edi)
+  80127f:	eb 06                	jmp    801287 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801281:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801284:	fc                   	cld
+  801285:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801287:	89 f8                	mov    %edi,%eax
+  801289:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80128c:	c9                   	leave
+  80128d:	c3                   	ret
+
+0080128e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80128e:	55                   	push   %ebp
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	57                   	push   %edi
+  801292:	56                   	push   %esi
+  801293:	8b 45 08             	mov    0x8(%ebp),%eax
+  801296:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801299:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80129c:	39 c6                	cmp    %eax,%esi
+  80129e:	73 32                	jae    8012d2 <memmove+0x44>
+  8012a0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8012a3:	39 d0                	cmp    %edx,%eax
+  8012a5:	73 2b                	jae    8012d2 <memmove+0x44>
+		s += n;
+		d += n;
+  8012a7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8012aa:	89 d6                	mov    %edx,%esi
+  8012ac:	09 fe                	or     %edi,%esi
+  8012ae:	09 ce                	or     %ecx,%esi
+  8012b0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8012b6:	75 0e                	jne    8012c6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8012b8:	83 ef 04             	sub    $0x4,%edi
+  8012bb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8012be:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8012c1:	fd                   	std
+  8012c2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8012c4:	eb 09                	jmp    8012cf <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8012c6:	83 ef 01             	sub    $0x1,%edi
+  8012c9:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8012cc:	fd                   	std
+  8012cd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8012cf:	fc                   	cld
+  8012d0:	eb 1a                	jmp    8012ec <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8012d2:	89 f2                	mov    %esi,%edx
+  8012d4:	09 c2                	or     %eax,%edx
+  8012d6:	09 ca                	or     %ecx,%edx
+  8012d8:	f6 c2 03             	test   $0x3,%dl
+  8012db:	75 0a                	jne    8012e7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8012dd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8012e0:	89 c7                	mov    %eax,%edi
+  8012e2:	fc                   	cld
+  8012e3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8012e5:	eb 05                	jmp    8012ec <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8012e7:	89 c7                	mov    %eax,%edi
+  8012e9:	fc                   	cld
+  8012ea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8012ec:	5e                   	pop    %esi
+  8012ed:	5f                   	pop    %edi
+  8012ee:	5d                   	pop    %ebp
+  8012ef:	c3                   	ret
+
+008012f0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8012f0:	55                   	push   %ebp
+  8012f1:	89 e5                	mov    %esp,%ebp
+  8012f3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8012f6:	ff 75 10             	push   0x10(%ebp)
+  8012f9:	ff 75 0c             	push   0xc(%ebp)
+  8012fc:	ff 75 08             	push   0x8(%ebp)
+  8012ff:	e8 8a ff ff ff       	call   80128e <memmove>
+}
+  801304:	c9                   	leave
+  801305:	c3                   	ret
+
+00801306 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+  80130b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80130e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801311:	89 c6                	mov    %eax,%esi
+  801313:	03 75 10             	add    0x10(%ebp),%esi
+  801316:	eb 06                	jmp    80131e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801318:	83 c0 01             	add    $0x1,%eax
+  80131b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80131e:	39 f0                	cmp    %esi,%eax
+  801320:	74 14                	je     801336 <memcmp+0x30>
+		if (*s1 != *s2)
+  801322:	0f b6 08             	movzbl (%eax),%ecx
+  801325:	0f b6 1a             	movzbl (%edx),%ebx
+  801328:	38 d9                	cmp    %bl,%cl
+  80132a:	74 ec                	je     801318 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80132c:	0f b6 c1             	movzbl %cl,%eax
+  80132f:	0f b6 db             	movzbl %bl,%ebx
+  801332:	29 d8                	sub    %ebx,%eax
+  801334:	eb 05                	jmp    80133b <memcmp+0x35>
+	}
+
+	return 0;
+  801336:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80133b:	5b                   	pop    %ebx
+  80133c:	5e                   	pop    %esi
+  80133d:	5d                   	pop    %ebp
+  80133e:	c3                   	ret
+
+0080133f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80133f:	55                   	push   %ebp
+  801340:	89 e5                	mov    %esp,%ebp
+  801342:	8b 45 08             	mov    0x8(%ebp),%eax
+  801345:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801348:	89 c2                	mov    %eax,%edx
+  80134a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80134d:	eb 03                	jmp    801352 <memfind+0x13>
+  80134f:	83 c0 01             	add    $0x1,%eax
+  801352:	39 d0                	cmp    %edx,%eax
+  801354:	73 04                	jae    80135a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801356:	38 08                	cmp    %cl,(%eax)
+  801358:	75 f5                	jne    80134f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  80135a:	5d                   	pop    %ebp
+  80135b:	c3                   	ret
+
+0080135c <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	57                   	push   %edi
+  801360:	56                   	push   %esi
+  801361:	53                   	push   %ebx
+  801362:	83 ec 1c             	sub    $0x1c,%esp
+  801365:	8b 75 08             	mov    0x8(%ebp),%esi
+  801368:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80136b:	eb 03                	jmp    801370 <strtol+0x14>
+		s++;
+  80136d:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  801370:	0f b6 06             	movzbl (%esi),%eax
+  801373:	3c 20                	cmp    $0x20,%al
+  801375:	74 f6                	je     80136d <strtol+0x11>
+  801377:	3c 09                	cmp    $0x9,%al
+  801379:	74 f2                	je     80136d <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  80137b:	3c 2b                	cmp    $0x2b,%al
+  80137d:	74 43                	je     8013c2 <strtol+0x66>
+	int neg = 0;
+  80137f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  801384:	3c 2d                	cmp    $0x2d,%al
+  801386:	74 44                	je     8013cc <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801388:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  80138e:	75 0f                	jne    80139f <strtol+0x43>
+  801390:	80 3e 30             	cmpb   $0x30,(%esi)
+  801393:	74 41                	je     8013d6 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801395:	85 ff                	test   %edi,%edi
+  801397:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80139c:	0f 44 f8             	cmove  %eax,%edi
+  80139f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a4:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  8013a9:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8013ac:	89 fb                	mov    %edi,%ebx
+  8013ae:	c1 fb 1f             	sar    $0x1f,%ebx
+  8013b1:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8013b4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8013b7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  8013ba:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  8013bd:	89 75 08             	mov    %esi,0x8(%ebp)
+  8013c0:	eb 67                	jmp    801429 <strtol+0xcd>
+		s++;
+  8013c2:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  8013c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ca:	eb bc                	jmp    801388 <strtol+0x2c>
+		s++, neg = 1;
+  8013cc:	83 c6 01             	add    $0x1,%esi
+  8013cf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8013d4:	eb b2                	jmp    801388 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8013d6:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  8013da:	74 0e                	je     8013ea <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  8013dc:	85 ff                	test   %edi,%edi
+  8013de:	75 bf                	jne    80139f <strtol+0x43>
+		s++, base = 8;
+  8013e0:	83 c6 01             	add    $0x1,%esi
+  8013e3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8013e8:	eb b5                	jmp    80139f <strtol+0x43>
+		s += 2, base = 16;
+  8013ea:	83 c6 02             	add    $0x2,%esi
+  8013ed:	bf 10 00 00 00       	mov    $0x10,%edi
+  8013f2:	eb ab                	jmp    80139f <strtol+0x43>
+			dig = *s - '0';
+  8013f4:	0f be c9             	movsbl %cl,%ecx
+  8013f7:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  8013fa:	39 f9                	cmp    %edi,%ecx
+  8013fc:	7d 59                	jge    801457 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  8013fe:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  801402:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801405:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801408:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  80140b:	0f af d8             	imul   %eax,%ebx
+  80140e:	0f af d7             	imul   %edi,%edx
+  801411:	01 d3                	add    %edx,%ebx
+  801413:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801416:	f7 e7                	mul    %edi
+  801418:	01 da                	add    %ebx,%edx
+  80141a:	89 cb                	mov    %ecx,%ebx
+  80141c:	c1 fb 1f             	sar    $0x1f,%ebx
+  80141f:	01 c8                	add    %ecx,%eax
+  801421:	11 da                	adc    %ebx,%edx
+  801423:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  801426:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  801429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80142c:	0f b6 08             	movzbl (%eax),%ecx
+  80142f:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  801432:	80 fb 09             	cmp    $0x9,%bl
+  801435:	76 bd                	jbe    8013f4 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  801437:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  80143a:	80 fb 19             	cmp    $0x19,%bl
+  80143d:	77 08                	ja     801447 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  80143f:	0f be c9             	movsbl %cl,%ecx
+  801442:	83 e9 57             	sub    $0x57,%ecx
+  801445:	eb b3                	jmp    8013fa <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801447:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  80144a:	80 fb 19             	cmp    $0x19,%bl
+  80144d:	77 08                	ja     801457 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  80144f:	0f be c9             	movsbl %cl,%ecx
+  801452:	83 e9 37             	sub    $0x37,%ecx
+  801455:	eb a3                	jmp    8013fa <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801457:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80145a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80145d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  801460:	8b 75 08             	mov    0x8(%ebp),%esi
+  801463:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801467:	74 05                	je     80146e <strtol+0x112>
+		*endptr = (char *) s;
+  801469:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80146c:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  80146e:	85 c9                	test   %ecx,%ecx
+  801470:	74 07                	je     801479 <strtol+0x11d>
+  801472:	f7 d8                	neg    %eax
+  801474:	83 d2 00             	adc    $0x0,%edx
+  801477:	f7 da                	neg    %edx
+}
+  801479:	83 c4 1c             	add    $0x1c,%esp
+  80147c:	5b                   	pop    %ebx
+  80147d:	5e                   	pop    %esi
+  80147e:	5f                   	pop    %edi
+  80147f:	5d                   	pop    %ebp
+  801480:	c3                   	ret
+
+00801481 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801481:	55                   	push   %ebp
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	57                   	push   %edi
+  801485:	56                   	push   %esi
+  801486:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801487:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  80148e:	74 18                	je     8014a8 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  801490:	b8 00 00 00 00       	mov    $0x0,%eax
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149b:	89 c3                	mov    %eax,%ebx
+  80149d:	89 c7                	mov    %eax,%edi
+  80149f:	89 c6                	mov    %eax,%esi
+  8014a1:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8014a3:	5b                   	pop    %ebx
+  8014a4:	5e                   	pop    %esi
+  8014a5:	5f                   	pop    %edi
+  8014a6:	5d                   	pop    %ebp
+  8014a7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b3:	89 c3                	mov    %eax,%ebx
+  8014b5:	89 c7                	mov    %eax,%edi
+  8014b7:	55                   	push   %ebp
+  8014b8:	89 e5                	mov    %esp,%ebp
+  8014ba:	8d 35 c2 14 80 00    	lea    0x8014c2,%esi
+  8014c0:	0f 34                	sysenter
+  8014c2:	5d                   	pop    %ebp
+		goto out;
+  8014c3:	eb de                	jmp    8014a3 <sys_cputs+0x22>
+
+008014c5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  8014c8:	57                   	push   %edi
+  8014c9:	56                   	push   %esi
+  8014ca:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014cb:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  8014d2:	74 19                	je     8014ed <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  8014d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014de:	89 d1                	mov    %edx,%ecx
+  8014e0:	89 d3                	mov    %edx,%ebx
+  8014e2:	89 d7                	mov    %edx,%edi
+  8014e4:	89 d6                	mov    %edx,%esi
+  8014e6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5f                   	pop    %edi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014f7:	89 d1                	mov    %edx,%ecx
+  8014f9:	89 d3                	mov    %edx,%ebx
+  8014fb:	89 d7                	mov    %edx,%edi
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	8d 35 08 15 80 00    	lea    0x801508,%esi
+  801506:	0f 34                	sysenter
+  801508:	5d                   	pop    %ebp
+		goto out;
+  801509:	eb dd                	jmp    8014e8 <sys_cgetc+0x23>
+
+0080150b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	57                   	push   %edi
+  80150f:	56                   	push   %esi
+  801510:	53                   	push   %ebx
+  801511:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801514:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  80151b:	74 21                	je     80153e <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  80151d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801522:	b8 03 00 00 00       	mov    $0x3,%eax
+  801527:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152a:	89 cb                	mov    %ecx,%ebx
+  80152c:	89 cf                	mov    %ecx,%edi
+  80152e:	89 ce                	mov    %ecx,%esi
+  801530:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801532:	85 c0                	test   %eax,%eax
+  801534:	7f 27                	jg     80155d <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801536:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801539:	5b                   	pop    %ebx
+  80153a:	5e                   	pop    %esi
+  80153b:	5f                   	pop    %edi
+  80153c:	5d                   	pop    %ebp
+  80153d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80153e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801541:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801546:	b8 03 00 00 00       	mov    $0x3,%eax
+  80154b:	89 cb                	mov    %ecx,%ebx
+  80154d:	89 cf                	mov    %ecx,%edi
+  80154f:	55                   	push   %ebp
+  801550:	89 e5                	mov    %esp,%ebp
+  801552:	8d 35 5a 15 80 00    	lea    0x80155a,%esi
+  801558:	0f 34                	sysenter
+  80155a:	5d                   	pop    %ebp
+		goto out;
+  80155b:	eb d5                	jmp    801532 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80155d:	83 ec 0c             	sub    $0xc,%esp
+  801560:	50                   	push   %eax
+  801561:	6a 03                	push   $0x3
+  801563:	68 6b 42 80 00       	push   $0x80426b
+  801568:	6a 3f                	push   $0x3f
+  80156a:	68 88 42 80 00       	push   $0x804288
+  80156f:	e8 71 f4 ff ff       	call   8009e5 <_panic>
+
+00801574 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	57                   	push   %edi
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80157a:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801581:	74 19                	je     80159c <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  801583:	ba 00 00 00 00       	mov    $0x0,%edx
+  801588:	b8 02 00 00 00       	mov    $0x2,%eax
+  80158d:	89 d1                	mov    %edx,%ecx
+  80158f:	89 d3                	mov    %edx,%ebx
+  801591:	89 d7                	mov    %edx,%edi
+  801593:	89 d6                	mov    %edx,%esi
+  801595:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801597:	5b                   	pop    %ebx
+  801598:	5e                   	pop    %esi
+  801599:	5f                   	pop    %edi
+  80159a:	5d                   	pop    %ebp
+  80159b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80159c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015a6:	89 d1                	mov    %edx,%ecx
+  8015a8:	89 d3                	mov    %edx,%ebx
+  8015aa:	89 d7                	mov    %edx,%edi
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	8d 35 b7 15 80 00    	lea    0x8015b7,%esi
+  8015b5:	0f 34                	sysenter
+  8015b7:	5d                   	pop    %ebp
+		goto out;
+  8015b8:	eb dd                	jmp    801597 <sys_getenvid+0x23>
+
+008015ba <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8015ba:	55                   	push   %ebp
+  8015bb:	89 e5                	mov    %esp,%ebp
+  8015bd:	57                   	push   %edi
+  8015be:	56                   	push   %esi
+  8015bf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015c0:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  8015c7:	74 19                	je     8015e2 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  8015c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ce:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015d3:	89 d1                	mov    %edx,%ecx
+  8015d5:	89 d3                	mov    %edx,%ebx
+  8015d7:	89 d7                	mov    %edx,%edi
+  8015d9:	89 d6                	mov    %edx,%esi
+  8015db:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8015dd:	5b                   	pop    %ebx
+  8015de:	5e                   	pop    %esi
+  8015df:	5f                   	pop    %edi
+  8015e0:	5d                   	pop    %ebp
+  8015e1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015ec:	89 d1                	mov    %edx,%ecx
+  8015ee:	89 d3                	mov    %edx,%ebx
+  8015f0:	89 d7                	mov    %edx,%edi
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	8d 35 fd 15 80 00    	lea    0x8015fd,%esi
+  8015fb:	0f 34                	sysenter
+  8015fd:	5d                   	pop    %ebp
+		goto out;
+  8015fe:	eb dd                	jmp    8015dd <sys_yield+0x23>
+
+00801600 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801600:	55                   	push   %ebp
+  801601:	89 e5                	mov    %esp,%ebp
+  801603:	57                   	push   %edi
+  801604:	56                   	push   %esi
+  801605:	53                   	push   %ebx
+  801606:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801609:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801610:	74 23                	je     801635 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  801612:	be 00 00 00 00       	mov    $0x0,%esi
+  801617:	b8 04 00 00 00       	mov    $0x4,%eax
+  80161c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801622:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801625:	89 f7                	mov    %esi,%edi
+  801627:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801629:	85 c0                	test   %eax,%eax
+  80162b:	7f 29                	jg     801656 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80162d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801630:	5b                   	pop    %ebx
+  801631:	5e                   	pop    %esi
+  801632:	5f                   	pop    %edi
+  801633:	5d                   	pop    %ebp
+  801634:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801635:	8b 55 08             	mov    0x8(%ebp),%edx
+  801638:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801640:	bf 00 00 00 00       	mov    $0x0,%edi
+  801645:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	8d 35 53 16 80 00    	lea    0x801653,%esi
+  801651:	0f 34                	sysenter
+  801653:	5d                   	pop    %ebp
+		goto out;
+  801654:	eb d3                	jmp    801629 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801656:	83 ec 0c             	sub    $0xc,%esp
+  801659:	50                   	push   %eax
+  80165a:	6a 04                	push   $0x4
+  80165c:	68 6b 42 80 00       	push   $0x80426b
+  801661:	6a 3f                	push   $0x3f
+  801663:	68 88 42 80 00       	push   $0x804288
+  801668:	e8 78 f3 ff ff       	call   8009e5 <_panic>
+
+0080166d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	57                   	push   %edi
+  801671:	56                   	push   %esi
+  801672:	53                   	push   %ebx
+  801673:	83 ec 0c             	sub    $0xc,%esp
+  801676:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  801679:	85 f6                	test   %esi,%esi
+  80167b:	75 09                	jne    801686 <sys_page_map+0x19>
+  80167d:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801684:	74 1f                	je     8016a5 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  801686:	b8 05 00 00 00       	mov    $0x5,%eax
+  80168b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801691:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801694:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801697:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	7f 27                	jg     8016c4 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80169d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a0:	5b                   	pop    %ebx
+  8016a1:	5e                   	pop    %esi
+  8016a2:	5f                   	pop    %edi
+  8016a3:	5d                   	pop    %ebp
+  8016a4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ab:	b8 05 00 00 00       	mov    $0x5,%eax
+  8016b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016b6:	55                   	push   %ebp
+  8016b7:	89 e5                	mov    %esp,%ebp
+  8016b9:	8d 35 c1 16 80 00    	lea    0x8016c1,%esi
+  8016bf:	0f 34                	sysenter
+  8016c1:	5d                   	pop    %ebp
+		goto out;
+  8016c2:	eb d5                	jmp    801699 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016c4:	83 ec 0c             	sub    $0xc,%esp
+  8016c7:	50                   	push   %eax
+  8016c8:	6a 05                	push   $0x5
+  8016ca:	68 6b 42 80 00       	push   $0x80426b
+  8016cf:	6a 3f                	push   $0x3f
+  8016d1:	68 88 42 80 00       	push   $0x804288
+  8016d6:	e8 0a f3 ff ff       	call   8009e5 <_panic>
+
+008016db <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8016db:	55                   	push   %ebp
+  8016dc:	89 e5                	mov    %esp,%ebp
+  8016de:	57                   	push   %edi
+  8016df:	56                   	push   %esi
+  8016e0:	53                   	push   %ebx
+  8016e1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016e4:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  8016eb:	74 22                	je     80170f <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  8016ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8016f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fd:	89 df                	mov    %ebx,%edi
+  8016ff:	89 de                	mov    %ebx,%esi
+  801701:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801703:	85 c0                	test   %eax,%eax
+  801705:	7f 28                	jg     80172f <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801707:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170a:	5b                   	pop    %ebx
+  80170b:	5e                   	pop    %esi
+  80170c:	5f                   	pop    %edi
+  80170d:	5d                   	pop    %ebp
+  80170e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80170f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801714:	8b 55 08             	mov    0x8(%ebp),%edx
+  801717:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80171f:	89 df                	mov    %ebx,%edi
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	8d 35 2c 17 80 00    	lea    0x80172c,%esi
+  80172a:	0f 34                	sysenter
+  80172c:	5d                   	pop    %ebp
+		goto out;
+  80172d:	eb d4                	jmp    801703 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80172f:	83 ec 0c             	sub    $0xc,%esp
+  801732:	50                   	push   %eax
+  801733:	6a 06                	push   $0x6
+  801735:	68 6b 42 80 00       	push   $0x80426b
+  80173a:	6a 3f                	push   $0x3f
+  80173c:	68 88 42 80 00       	push   $0x804288
+  801741:	e8 9f f2 ff ff       	call   8009e5 <_panic>
+
+00801746 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801746:	55                   	push   %ebp
+  801747:	89 e5                	mov    %esp,%ebp
+  801749:	57                   	push   %edi
+  80174a:	56                   	push   %esi
+  80174b:	53                   	push   %ebx
+  80174c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80174f:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801756:	74 22                	je     80177a <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801758:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801762:	8b 55 08             	mov    0x8(%ebp),%edx
+  801765:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801768:	89 df                	mov    %ebx,%edi
+  80176a:	89 de                	mov    %ebx,%esi
+  80176c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80176e:	85 c0                	test   %eax,%eax
+  801770:	7f 28                	jg     80179a <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801772:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801775:	5b                   	pop    %ebx
+  801776:	5e                   	pop    %esi
+  801777:	5f                   	pop    %edi
+  801778:	5d                   	pop    %ebp
+  801779:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80177a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801782:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801785:	b8 08 00 00 00       	mov    $0x8,%eax
+  80178a:	89 df                	mov    %ebx,%edi
+  80178c:	55                   	push   %ebp
+  80178d:	89 e5                	mov    %esp,%ebp
+  80178f:	8d 35 97 17 80 00    	lea    0x801797,%esi
+  801795:	0f 34                	sysenter
+  801797:	5d                   	pop    %ebp
+		goto out;
+  801798:	eb d4                	jmp    80176e <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80179a:	83 ec 0c             	sub    $0xc,%esp
+  80179d:	50                   	push   %eax
+  80179e:	6a 08                	push   $0x8
+  8017a0:	68 6b 42 80 00       	push   $0x80426b
+  8017a5:	6a 3f                	push   $0x3f
+  8017a7:	68 88 42 80 00       	push   $0x804288
+  8017ac:	e8 34 f2 ff ff       	call   8009e5 <_panic>
+
+008017b1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	57                   	push   %edi
+  8017b5:	56                   	push   %esi
+  8017b6:	53                   	push   %ebx
+  8017b7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017ba:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  8017c1:	74 22                	je     8017e5 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  8017c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d3:	89 df                	mov    %ebx,%edi
+  8017d5:	89 de                	mov    %ebx,%esi
+  8017d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017d9:	85 c0                	test   %eax,%eax
+  8017db:	7f 28                	jg     801805 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8017dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e0:	5b                   	pop    %ebx
+  8017e1:	5e                   	pop    %esi
+  8017e2:	5f                   	pop    %edi
+  8017e3:	5d                   	pop    %ebp
+  8017e4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8017f5:	89 df                	mov    %ebx,%edi
+  8017f7:	55                   	push   %ebp
+  8017f8:	89 e5                	mov    %esp,%ebp
+  8017fa:	8d 35 02 18 80 00    	lea    0x801802,%esi
+  801800:	0f 34                	sysenter
+  801802:	5d                   	pop    %ebp
+		goto out;
+  801803:	eb d4                	jmp    8017d9 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801805:	83 ec 0c             	sub    $0xc,%esp
+  801808:	50                   	push   %eax
+  801809:	6a 09                	push   $0x9
+  80180b:	68 6b 42 80 00       	push   $0x80426b
+  801810:	6a 3f                	push   $0x3f
+  801812:	68 88 42 80 00       	push   $0x804288
+  801817:	e8 c9 f1 ff ff       	call   8009e5 <_panic>
+
+0080181c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80181c:	55                   	push   %ebp
+  80181d:	89 e5                	mov    %esp,%ebp
+  80181f:	57                   	push   %edi
+  801820:	56                   	push   %esi
+  801821:	53                   	push   %ebx
+  801822:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801825:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  80182c:	74 22                	je     801850 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80182e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801833:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801838:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80183e:	89 df                	mov    %ebx,%edi
+  801840:	89 de                	mov    %ebx,%esi
+  801842:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801844:	85 c0                	test   %eax,%eax
+  801846:	7f 28                	jg     801870 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801848:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80184b:	5b                   	pop    %ebx
+  80184c:	5e                   	pop    %esi
+  80184d:	5f                   	pop    %edi
+  80184e:	5d                   	pop    %ebp
+  80184f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801850:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801855:	8b 55 08             	mov    0x8(%ebp),%edx
+  801858:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801860:	89 df                	mov    %ebx,%edi
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	8d 35 6d 18 80 00    	lea    0x80186d,%esi
+  80186b:	0f 34                	sysenter
+  80186d:	5d                   	pop    %ebp
+		goto out;
+  80186e:	eb d4                	jmp    801844 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801870:	83 ec 0c             	sub    $0xc,%esp
+  801873:	50                   	push   %eax
+  801874:	6a 0a                	push   $0xa
+  801876:	68 6b 42 80 00       	push   $0x80426b
+  80187b:	6a 3f                	push   $0x3f
+  80187d:	68 88 42 80 00       	push   $0x804288
+  801882:	e8 5e f1 ff ff       	call   8009e5 <_panic>
+
+00801887 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	57                   	push   %edi
+  80188b:	56                   	push   %esi
+  80188c:	53                   	push   %ebx
+  80188d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801890:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801897:	74 22                	je     8018bb <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801899:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189e:	b8 17 00 00 00       	mov    $0x17,%eax
+  8018a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a9:	89 df                	mov    %ebx,%edi
+  8018ab:	89 de                	mov    %ebx,%esi
+  8018ad:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018af:	85 c0                	test   %eax,%eax
+  8018b1:	7f 28                	jg     8018db <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8018b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b6:	5b                   	pop    %ebx
+  8018b7:	5e                   	pop    %esi
+  8018b8:	5f                   	pop    %edi
+  8018b9:	5d                   	pop    %ebp
+  8018ba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8018cb:	89 df                	mov    %ebx,%edi
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+  8018d0:	8d 35 d8 18 80 00    	lea    0x8018d8,%esi
+  8018d6:	0f 34                	sysenter
+  8018d8:	5d                   	pop    %ebp
+		goto out;
+  8018d9:	eb d4                	jmp    8018af <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018db:	83 ec 0c             	sub    $0xc,%esp
+  8018de:	50                   	push   %eax
+  8018df:	6a 17                	push   $0x17
+  8018e1:	68 6b 42 80 00       	push   $0x80426b
+  8018e6:	6a 3f                	push   $0x3f
+  8018e8:	68 88 42 80 00       	push   $0x804288
+  8018ed:	e8 f3 f0 ff ff       	call   8009e5 <_panic>
+
+008018f2 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8018f2:	55                   	push   %ebp
+  8018f3:	89 e5                	mov    %esp,%ebp
+  8018f5:	57                   	push   %edi
+  8018f6:	56                   	push   %esi
+  8018f7:	53                   	push   %ebx
+  8018f8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8018fb:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801902:	74 22                	je     801926 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801904:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801909:	b8 18 00 00 00       	mov    $0x18,%eax
+  80190e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801911:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801914:	89 df                	mov    %ebx,%edi
+  801916:	89 de                	mov    %ebx,%esi
+  801918:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80191a:	85 c0                	test   %eax,%eax
+  80191c:	7f 28                	jg     801946 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80191e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801921:	5b                   	pop    %ebx
+  801922:	5e                   	pop    %esi
+  801923:	5f                   	pop    %edi
+  801924:	5d                   	pop    %ebp
+  801925:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801926:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801931:	b8 18 00 00 00       	mov    $0x18,%eax
+  801936:	89 df                	mov    %ebx,%edi
+  801938:	55                   	push   %ebp
+  801939:	89 e5                	mov    %esp,%ebp
+  80193b:	8d 35 43 19 80 00    	lea    0x801943,%esi
+  801941:	0f 34                	sysenter
+  801943:	5d                   	pop    %ebp
+		goto out;
+  801944:	eb d4                	jmp    80191a <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801946:	83 ec 0c             	sub    $0xc,%esp
+  801949:	50                   	push   %eax
+  80194a:	6a 18                	push   $0x18
+  80194c:	68 6b 42 80 00       	push   $0x80426b
+  801951:	6a 3f                	push   $0x3f
+  801953:	68 88 42 80 00       	push   $0x804288
+  801958:	e8 88 f0 ff ff       	call   8009e5 <_panic>
+
+0080195d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80195d:	55                   	push   %ebp
+  80195e:	89 e5                	mov    %esp,%ebp
+  801960:	57                   	push   %edi
+  801961:	56                   	push   %esi
+  801962:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801963:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  80196a:	74 1d                	je     801989 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80196c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801971:	be 00 00 00 00       	mov    $0x0,%esi
+  801976:	8b 55 08             	mov    0x8(%ebp),%edx
+  801979:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80197c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80197f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801982:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801984:	5b                   	pop    %ebx
+  801985:	5e                   	pop    %esi
+  801986:	5f                   	pop    %edi
+  801987:	5d                   	pop    %ebp
+  801988:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801989:	8b 55 08             	mov    0x8(%ebp),%edx
+  80198c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80198f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801994:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801997:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80199a:	55                   	push   %ebp
+  80199b:	89 e5                	mov    %esp,%ebp
+  80199d:	8d 35 a5 19 80 00    	lea    0x8019a5,%esi
+  8019a3:	0f 34                	sysenter
+  8019a5:	5d                   	pop    %ebp
+		goto out;
+  8019a6:	eb dc                	jmp    801984 <sys_ipc_try_send+0x27>
+
+008019a8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8019a8:	55                   	push   %ebp
+  8019a9:	89 e5                	mov    %esp,%ebp
+  8019ab:	57                   	push   %edi
+  8019ac:	56                   	push   %esi
+  8019ad:	53                   	push   %ebx
+  8019ae:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8019b1:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  8019b8:	74 21                	je     8019db <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8019ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019bf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c7:	89 cb                	mov    %ecx,%ebx
+  8019c9:	89 cf                	mov    %ecx,%edi
+  8019cb:	89 ce                	mov    %ecx,%esi
+  8019cd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019cf:	85 c0                	test   %eax,%eax
+  8019d1:	7f 27                	jg     8019fa <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8019d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d6:	5b                   	pop    %ebx
+  8019d7:	5e                   	pop    %esi
+  8019d8:	5f                   	pop    %edi
+  8019d9:	5d                   	pop    %ebp
+  8019da:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8019e8:	89 cb                	mov    %ecx,%ebx
+  8019ea:	89 cf                	mov    %ecx,%edi
+  8019ec:	55                   	push   %ebp
+  8019ed:	89 e5                	mov    %esp,%ebp
+  8019ef:	8d 35 f7 19 80 00    	lea    0x8019f7,%esi
+  8019f5:	0f 34                	sysenter
+  8019f7:	5d                   	pop    %ebp
+		goto out;
+  8019f8:	eb d5                	jmp    8019cf <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019fa:	83 ec 0c             	sub    $0xc,%esp
+  8019fd:	50                   	push   %eax
+  8019fe:	6a 0d                	push   $0xd
+  801a00:	68 6b 42 80 00       	push   $0x80426b
+  801a05:	6a 3f                	push   $0x3f
+  801a07:	68 88 42 80 00       	push   $0x804288
+  801a0c:	e8 d4 ef ff ff       	call   8009e5 <_panic>
+
+00801a11 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	57                   	push   %edi
+  801a15:	56                   	push   %esi
+  801a16:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a17:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801a1e:	74 1b                	je     801a3b <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801a20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a25:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a30:	89 df                	mov    %ebx,%edi
+  801a32:	89 de                	mov    %ebx,%esi
+  801a34:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801a36:	5b                   	pop    %ebx
+  801a37:	5e                   	pop    %esi
+  801a38:	5f                   	pop    %edi
+  801a39:	5d                   	pop    %ebp
+  801a3a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a40:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a46:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801a4b:	89 df                	mov    %ebx,%edi
+  801a4d:	55                   	push   %ebp
+  801a4e:	89 e5                	mov    %esp,%ebp
+  801a50:	8d 35 58 1a 80 00    	lea    0x801a58,%esi
+  801a56:	0f 34                	sysenter
+  801a58:	5d                   	pop    %ebp
+		goto out;
+  801a59:	eb db                	jmp    801a36 <sys_ipc_recv_until+0x25>
+
+00801a5b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801a5b:	55                   	push   %ebp
+  801a5c:	89 e5                	mov    %esp,%ebp
+  801a5e:	57                   	push   %edi
+  801a5f:	56                   	push   %esi
+  801a60:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a61:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801a68:	74 19                	je     801a83 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801a74:	89 d1                	mov    %edx,%ecx
+  801a76:	89 d3                	mov    %edx,%ebx
+  801a78:	89 d7                	mov    %edx,%edi
+  801a7a:	89 d6                	mov    %edx,%esi
+  801a7c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801a7e:	5b                   	pop    %ebx
+  801a7f:	5e                   	pop    %esi
+  801a80:	5f                   	pop    %edi
+  801a81:	5d                   	pop    %ebp
+  801a82:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a88:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801a8d:	89 d1                	mov    %edx,%ecx
+  801a8f:	89 d3                	mov    %edx,%ebx
+  801a91:	89 d7                	mov    %edx,%edi
+  801a93:	55                   	push   %ebp
+  801a94:	89 e5                	mov    %esp,%ebp
+  801a96:	8d 35 9e 1a 80 00    	lea    0x801a9e,%esi
+  801a9c:	0f 34                	sysenter
+  801a9e:	5d                   	pop    %ebp
+		goto out;
+  801a9f:	eb dd                	jmp    801a7e <sys_time_msec+0x23>
+
+00801aa1 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801aa1:	55                   	push   %ebp
+  801aa2:	89 e5                	mov    %esp,%ebp
+  801aa4:	57                   	push   %edi
+  801aa5:	56                   	push   %esi
+  801aa6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801aa7:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801aae:	74 1a                	je     801aca <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ab5:	b8 10 00 00 00       	mov    $0x10,%eax
+  801aba:	8b 55 08             	mov    0x8(%ebp),%edx
+  801abd:	89 cb                	mov    %ecx,%ebx
+  801abf:	89 cf                	mov    %ecx,%edi
+  801ac1:	89 ce                	mov    %ecx,%esi
+  801ac3:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801ac5:	5b                   	pop    %ebx
+  801ac6:	5e                   	pop    %esi
+  801ac7:	5f                   	pop    %edi
+  801ac8:	5d                   	pop    %ebp
+  801ac9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801aca:	8b 55 08             	mov    0x8(%ebp),%edx
+  801acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ad2:	b8 10 00 00 00       	mov    $0x10,%eax
+  801ad7:	89 cb                	mov    %ecx,%ebx
+  801ad9:	89 cf                	mov    %ecx,%edi
+  801adb:	55                   	push   %ebp
+  801adc:	89 e5                	mov    %esp,%ebp
+  801ade:	8d 35 e6 1a 80 00    	lea    0x801ae6,%esi
+  801ae4:	0f 34                	sysenter
+  801ae6:	5d                   	pop    %ebp
+		goto out;
+  801ae7:	eb dc                	jmp    801ac5 <sys_sleep_until+0x24>
+
+00801ae9 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801ae9:	55                   	push   %ebp
+  801aea:	89 e5                	mov    %esp,%ebp
+  801aec:	57                   	push   %edi
+  801aed:	56                   	push   %esi
+  801aee:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801aef:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801af6:	74 1a                	je     801b12 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801af8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801afd:	b8 11 00 00 00       	mov    $0x11,%eax
+  801b02:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b05:	89 cb                	mov    %ecx,%ebx
+  801b07:	89 cf                	mov    %ecx,%edi
+  801b09:	89 ce                	mov    %ecx,%esi
+  801b0b:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801b0d:	5b                   	pop    %ebx
+  801b0e:	5e                   	pop    %esi
+  801b0f:	5f                   	pop    %edi
+  801b10:	5d                   	pop    %ebp
+  801b11:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b12:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b1a:	b8 11 00 00 00       	mov    $0x11,%eax
+  801b1f:	89 cb                	mov    %ecx,%ebx
+  801b21:	89 cf                	mov    %ecx,%edi
+  801b23:	55                   	push   %ebp
+  801b24:	89 e5                	mov    %esp,%ebp
+  801b26:	8d 35 2e 1b 80 00    	lea    0x801b2e,%esi
+  801b2c:	0f 34                	sysenter
+  801b2e:	5d                   	pop    %ebp
+		goto out;
+  801b2f:	eb dc                	jmp    801b0d <sys_env_print_stats+0x24>
+
+00801b31 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801b31:	55                   	push   %ebp
+  801b32:	89 e5                	mov    %esp,%ebp
+  801b34:	57                   	push   %edi
+  801b35:	56                   	push   %esi
+  801b36:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b37:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801b3e:	74 1b                	je     801b5b <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801b40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b45:	b8 19 00 00 00       	mov    $0x19,%eax
+  801b4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b50:	89 df                	mov    %ebx,%edi
+  801b52:	89 de                	mov    %ebx,%esi
+  801b54:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801b56:	5b                   	pop    %ebx
+  801b57:	5e                   	pop    %esi
+  801b58:	5f                   	pop    %edi
+  801b59:	5d                   	pop    %ebp
+  801b5a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b60:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b66:	b8 19 00 00 00       	mov    $0x19,%eax
+  801b6b:	89 df                	mov    %ebx,%edi
+  801b6d:	55                   	push   %ebp
+  801b6e:	89 e5                	mov    %esp,%ebp
+  801b70:	8d 35 78 1b 80 00    	lea    0x801b78,%esi
+  801b76:	0f 34                	sysenter
+  801b78:	5d                   	pop    %ebp
+		goto out;
+  801b79:	eb db                	jmp    801b56 <sys_perf+0x25>
+
+00801b7b <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	57                   	push   %edi
+  801b7f:	56                   	push   %esi
+  801b80:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b81:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801b88:	74 19                	je     801ba3 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801b94:	89 d1                	mov    %edx,%ecx
+  801b96:	89 d3                	mov    %edx,%ebx
+  801b98:	89 d7                	mov    %edx,%edi
+  801b9a:	89 d6                	mov    %edx,%esi
+  801b9c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801b9e:	5b                   	pop    %ebx
+  801b9f:	5e                   	pop    %esi
+  801ba0:	5f                   	pop    %edi
+  801ba1:	5d                   	pop    %ebp
+  801ba2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ba3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801bad:	89 d1                	mov    %edx,%ecx
+  801baf:	89 d3                	mov    %edx,%ebx
+  801bb1:	89 d7                	mov    %edx,%edi
+  801bb3:	55                   	push   %ebp
+  801bb4:	89 e5                	mov    %esp,%ebp
+  801bb6:	8d 35 be 1b 80 00    	lea    0x801bbe,%esi
+  801bbc:	0f 34                	sysenter
+  801bbe:	5d                   	pop    %ebp
+		goto out;
+  801bbf:	eb dd                	jmp    801b9e <sys_fork+0x23>
+
+00801bc1 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801bc1:	55                   	push   %ebp
+  801bc2:	89 e5                	mov    %esp,%ebp
+  801bc4:	57                   	push   %edi
+  801bc5:	56                   	push   %esi
+  801bc6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801bc7:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801bce:	74 1c                	je     801bec <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801bd0:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801bda:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801be0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801be3:	89 f7                	mov    %esi,%edi
+  801be5:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801be7:	5b                   	pop    %ebx
+  801be8:	5e                   	pop    %esi
+  801be9:	5f                   	pop    %edi
+  801bea:	5d                   	pop    %ebp
+  801beb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801bec:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bf2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801bf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bfc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+  801c02:	8d 35 0a 1c 80 00    	lea    0x801c0a,%esi
+  801c08:	0f 34                	sysenter
+  801c0a:	5d                   	pop    %ebp
+		goto out;
+  801c0b:	eb da                	jmp    801be7 <sys_thread_create+0x26>
+
+00801c0d <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801c0d:	55                   	push   %ebp
+  801c0e:	89 e5                	mov    %esp,%ebp
+  801c10:	57                   	push   %edi
+  801c11:	56                   	push   %esi
+  801c12:	53                   	push   %ebx
+  801c13:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801c16:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801c1d:	74 24                	je     801c43 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801c1f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c24:	be 00 00 00 00       	mov    $0x0,%esi
+  801c29:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c32:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c35:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	7f 27                	jg     801c62 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801c3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3e:	5b                   	pop    %ebx
+  801c3f:	5e                   	pop    %esi
+  801c40:	5f                   	pop    %edi
+  801c41:	5d                   	pop    %ebp
+  801c42:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c43:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c49:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801c4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c51:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	8d 35 5f 1c 80 00    	lea    0x801c5f,%esi
+  801c5d:	0f 34                	sysenter
+  801c5f:	5d                   	pop    %ebp
+		goto out;
+  801c60:	eb d5                	jmp    801c37 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c62:	83 ec 0c             	sub    $0xc,%esp
+  801c65:	50                   	push   %eax
+  801c66:	6a 1f                	push   $0x1f
+  801c68:	68 6b 42 80 00       	push   $0x80426b
+  801c6d:	6a 3f                	push   $0x3f
+  801c6f:	68 88 42 80 00       	push   $0x804288
+  801c74:	e8 6c ed ff ff       	call   8009e5 <_panic>
+
+00801c79 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801c79:	55                   	push   %ebp
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	57                   	push   %edi
+  801c7d:	56                   	push   %esi
+  801c7e:	53                   	push   %ebx
+  801c7f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801c82:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801c89:	74 23                	je     801cae <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801c8b:	be 00 00 00 00       	mov    $0x0,%esi
+  801c90:	b8 20 00 00 00       	mov    $0x20,%eax
+  801c95:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c9e:	89 f7                	mov    %esi,%edi
+  801ca0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	7f 29                	jg     801ccf <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca9:	5b                   	pop    %ebx
+  801caa:	5e                   	pop    %esi
+  801cab:	5f                   	pop    %edi
+  801cac:	5d                   	pop    %ebp
+  801cad:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801cae:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cb4:	b8 20 00 00 00       	mov    $0x20,%eax
+  801cb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	8d 35 cc 1c 80 00    	lea    0x801ccc,%esi
+  801cca:	0f 34                	sysenter
+  801ccc:	5d                   	pop    %ebp
+		goto out;
+  801ccd:	eb d3                	jmp    801ca2 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ccf:	83 ec 0c             	sub    $0xc,%esp
+  801cd2:	50                   	push   %eax
+  801cd3:	6a 20                	push   $0x20
+  801cd5:	68 6b 42 80 00       	push   $0x80426b
+  801cda:	6a 3f                	push   $0x3f
+  801cdc:	68 88 42 80 00       	push   $0x804288
+  801ce1:	e8 ff ec ff ff       	call   8009e5 <_panic>
+
+00801ce6 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	57                   	push   %edi
+  801cea:	56                   	push   %esi
+  801ceb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801cec:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801cf3:	74 1b                	je     801d10 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801cf5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cfa:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801cff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d05:	89 df                	mov    %ebx,%edi
+  801d07:	89 de                	mov    %ebx,%esi
+  801d09:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801d0b:	5b                   	pop    %ebx
+  801d0c:	5e                   	pop    %esi
+  801d0d:	5f                   	pop    %edi
+  801d0e:	5d                   	pop    %ebp
+  801d0f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d1b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801d20:	89 df                	mov    %ebx,%edi
+  801d22:	55                   	push   %ebp
+  801d23:	89 e5                	mov    %esp,%ebp
+  801d25:	8d 35 2d 1d 80 00    	lea    0x801d2d,%esi
+  801d2b:	0f 34                	sysenter
+  801d2d:	5d                   	pop    %ebp
+		goto out;
+  801d2e:	eb db                	jmp    801d0b <sys_batch+0x25>
+
+00801d30 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801d30:	55                   	push   %ebp
+  801d31:	89 e5                	mov    %esp,%ebp
+  801d33:	57                   	push   %edi
+  801d34:	56                   	push   %esi
+  801d35:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801d36:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801d3d:	74 1a                	je     801d59 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801d3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d44:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801d49:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d4c:	89 cb                	mov    %ecx,%ebx
+  801d4e:	89 cf                	mov    %ecx,%edi
+  801d50:	89 ce                	mov    %ecx,%esi
+  801d52:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801d54:	5b                   	pop    %ebx
+  801d55:	5e                   	pop    %esi
+  801d56:	5f                   	pop    %edi
+  801d57:	5d                   	pop    %ebp
+  801d58:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801d59:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d61:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801d66:	89 cb                	mov    %ecx,%ebx
+  801d68:	89 cf                	mov    %ecx,%edi
+  801d6a:	55                   	push   %ebp
+  801d6b:	89 e5                	mov    %esp,%ebp
+  801d6d:	8d 35 75 1d 80 00    	lea    0x801d75,%esi
+  801d73:	0f 34                	sysenter
+  801d75:	5d                   	pop    %ebp
+		goto out;
+  801d76:	eb dc                	jmp    801d54 <sys_trace_ctl+0x24>
+
+00801d78 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801d78:	55                   	push   %ebp
+  801d79:	89 e5                	mov    %esp,%ebp
+  801d7b:	57                   	push   %edi
+  801d7c:	56                   	push   %esi
+  801d7d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801d7e:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801d85:	74 1c                	je     801da3 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801d87:	be 00 00 00 00       	mov    $0x0,%esi
+  801d8c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801d91:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801d9a:	89 f7                	mov    %esi,%edi
+  801d9c:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801d9e:	5b                   	pop    %ebx
+  801d9f:	5e                   	pop    %esi
+  801da0:	5f                   	pop    %edi
+  801da1:	5d                   	pop    %ebp
+  801da2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801da9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801dae:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801db6:	55                   	push   %ebp
+  801db7:	89 e5                	mov    %esp,%ebp
+  801db9:	8d 35 c1 1d 80 00    	lea    0x801dc1,%esi
+  801dbf:	0f 34                	sysenter
+  801dc1:	5d                   	pop    %ebp
+		goto out;
+  801dc2:	eb da                	jmp    801d9e <sys_trace_read+0x26>
+
+00801dc4 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801dc4:	55                   	push   %ebp
+  801dc5:	89 e5                	mov    %esp,%ebp
+  801dc7:	57                   	push   %edi
+  801dc8:	56                   	push   %esi
+  801dc9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801dca:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801dd1:	74 1c                	je     801def <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801dd3:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd8:	b8 21 00 00 00       	mov    $0x21,%eax
+  801ddd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801de0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801de3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801de6:	89 f7                	mov    %esi,%edi
+  801de8:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801dea:	5b                   	pop    %ebx
+  801deb:	5e                   	pop    %esi
+  801dec:	5f                   	pop    %edi
+  801ded:	5d                   	pop    %ebp
+  801dee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801def:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801df5:	b8 21 00 00 00       	mov    $0x21,%eax
+  801dfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e02:	55                   	push   %ebp
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	8d 35 0d 1e 80 00    	lea    0x801e0d,%esi
+  801e0b:	0f 34                	sysenter
+  801e0d:	5d                   	pop    %ebp
+		goto out;
+  801e0e:	eb da                	jmp    801dea <sys_meminfo+0x26>
+
+00801e10 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801e10:	55                   	push   %ebp
+  801e11:	89 e5                	mov    %esp,%ebp
+  801e13:	57                   	push   %edi
+  801e14:	56                   	push   %esi
+  801e15:	53                   	push   %ebx
+  801e16:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801e19:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801e1d:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801e24:	74 1f                	je     801e45 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801e26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e2b:	b8 22 00 00 00       	mov    $0x22,%eax
+  801e30:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e33:	89 df                	mov    %ebx,%edi
+  801e35:	89 de                	mov    %ebx,%esi
+  801e37:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801e39:	85 c0                	test   %eax,%eax
+  801e3b:	7f 25                	jg     801e62 <sys_env_set_ksm+0x52>
+}
+  801e3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e40:	5b                   	pop    %ebx
+  801e41:	5e                   	pop    %esi
+  801e42:	5f                   	pop    %edi
+  801e43:	5d                   	pop    %ebp
+  801e44:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801e45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e4d:	b8 22 00 00 00       	mov    $0x22,%eax
+  801e52:	89 df                	mov    %ebx,%edi
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	8d 35 5f 1e 80 00    	lea    0x801e5f,%esi
+  801e5d:	0f 34                	sysenter
+  801e5f:	5d                   	pop    %ebp
+		goto out;
+  801e60:	eb d7                	jmp    801e39 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	50                   	push   %eax
+  801e66:	6a 22                	push   $0x22
+  801e68:	68 6b 42 80 00       	push   $0x80426b
+  801e6d:	6a 3f                	push   $0x3f
+  801e6f:	68 88 42 80 00       	push   $0x804288
+  801e74:	e8 6c eb ff ff       	call   8009e5 <_panic>
+
+00801e79 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	57                   	push   %edi
+  801e7d:	56                   	push   %esi
+  801e7e:	53                   	push   %ebx
+  801e7f:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801e82:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801e85:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801e8c:	74 24                	je     801eb2 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801e8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e93:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801e98:	89 cb                	mov    %ecx,%ebx
+  801e9a:	89 cf                	mov    %ecx,%edi
+  801e9c:	89 ce                	mov    %ecx,%esi
+  801e9e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	7f 2a                	jg     801ece <sys_time_nsec+0x55>
+	return ns;
+}
+  801ea4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ea7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801eaa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ead:	5b                   	pop    %ebx
+  801eae:	5e                   	pop    %esi
+  801eaf:	5f                   	pop    %edi
+  801eb0:	5d                   	pop    %ebp
+  801eb1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801eb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eb7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ebc:	89 cb                	mov    %ecx,%ebx
+  801ebe:	89 cf                	mov    %ecx,%edi
+  801ec0:	55                   	push   %ebp
+  801ec1:	89 e5                	mov    %esp,%ebp
+  801ec3:	8d 35 cb 1e 80 00    	lea    0x801ecb,%esi
+  801ec9:	0f 34                	sysenter
+  801ecb:	5d                   	pop    %ebp
+		goto out;
+  801ecc:	eb d2                	jmp    801ea0 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ece:	83 ec 0c             	sub    $0xc,%esp
+  801ed1:	50                   	push   %eax
+  801ed2:	6a 0f                	push   $0xf
+  801ed4:	68 6b 42 80 00       	push   $0x80426b
+  801ed9:	6a 3f                	push   $0x3f
+  801edb:	68 88 42 80 00       	push   $0x804288
+  801ee0:	e8 00 eb ff ff       	call   8009e5 <_panic>
+
+00801ee5 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801ee5:	55                   	push   %ebp
+  801ee6:	89 e5                	mov    %esp,%ebp
+  801ee8:	57                   	push   %edi
+  801ee9:	56                   	push   %esi
+  801eea:	53                   	push   %ebx
+  801eeb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801eee:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801ef5:	74 22                	je     801f19 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801efc:	b8 12 00 00 00       	mov    $0x12,%eax
+  801f01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f07:	89 df                	mov    %ebx,%edi
+  801f09:	89 de                	mov    %ebx,%esi
+  801f0b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	7f 28                	jg     801f39 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801f11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f14:	5b                   	pop    %ebx
+  801f15:	5e                   	pop    %esi
+  801f16:	5f                   	pop    %edi
+  801f17:	5d                   	pop    %ebp
+  801f18:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801f19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f24:	b8 12 00 00 00       	mov    $0x12,%eax
+  801f29:	89 df                	mov    %ebx,%edi
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	8d 35 36 1f 80 00    	lea    0x801f36,%esi
+  801f34:	0f 34                	sysenter
+  801f36:	5d                   	pop    %ebp
+		goto out;
+  801f37:	eb d4                	jmp    801f0d <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f39:	83 ec 0c             	sub    $0xc,%esp
+  801f3c:	50                   	push   %eax
+  801f3d:	6a 12                	push   $0x12
+  801f3f:	68 6b 42 80 00       	push   $0x80426b
+  801f44:	6a 3f                	push   $0x3f
+  801f46:	68 88 42 80 00       	push   $0x804288
+  801f4b:	e8 95 ea ff ff       	call   8009e5 <_panic>
+
+00801f50 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801f50:	55                   	push   %ebp
+  801f51:	89 e5                	mov    %esp,%ebp
+  801f53:	57                   	push   %edi
+  801f54:	56                   	push   %esi
+  801f55:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801f56:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801f5d:	74 1b                	je     801f7a <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801f5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f64:	b8 13 00 00 00       	mov    $0x13,%eax
+  801f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f6f:	89 df                	mov    %ebx,%edi
+  801f71:	89 de                	mov    %ebx,%esi
+  801f73:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801f75:	5b                   	pop    %ebx
+  801f76:	5e                   	pop    %esi
+  801f77:	5f                   	pop    %edi
+  801f78:	5d                   	pop    %ebp
+  801f79:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801f7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f85:	b8 13 00 00 00       	mov    $0x13,%eax
+  801f8a:	89 df                	mov    %ebx,%edi
+  801f8c:	55                   	push   %ebp
+  801f8d:	89 e5                	mov    %esp,%ebp
+  801f8f:	8d 35 97 1f 80 00    	lea    0x801f97,%esi
+  801f95:	0f 34                	sysenter
+  801f97:	5d                   	pop    %ebp
+		goto out;
+  801f98:	eb db                	jmp    801f75 <sys_e1000_receive+0x25>
+
+00801f9a <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801f9a:	55                   	push   %ebp
+  801f9b:	89 e5                	mov    %esp,%ebp
+  801f9d:	57                   	push   %edi
+  801f9e:	56                   	push   %esi
+  801f9f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801fa0:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801fa7:	74 1b                	je     801fc4 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801fa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fae:	b8 14 00 00 00       	mov    $0x14,%eax
+  801fb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fb9:	89 df                	mov    %ebx,%edi
+  801fbb:	89 de                	mov    %ebx,%esi
+  801fbd:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801fbf:	5b                   	pop    %ebx
+  801fc0:	5e                   	pop    %esi
+  801fc1:	5f                   	pop    %edi
+  801fc2:	5d                   	pop    %ebp
+  801fc3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801fc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fcf:	b8 14 00 00 00       	mov    $0x14,%eax
+  801fd4:	89 df                	mov    %ebx,%edi
+  801fd6:	55                   	push   %ebp
+  801fd7:	89 e5                	mov    %esp,%ebp
+  801fd9:	8d 35 e1 1f 80 00    	lea    0x801fe1,%esi
+  801fdf:	0f 34                	sysenter
+  801fe1:	5d                   	pop    %ebp
+		goto out;
+  801fe2:	eb db                	jmp    801fbf <sys_e1000_read_hwaddr+0x25>
+
+00801fe4 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801fe4:	55                   	push   %ebp
+  801fe5:	89 e5                	mov    %esp,%ebp
+  801fe7:	57                   	push   %edi
+  801fe8:	56                   	push   %esi
+  801fe9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801fea:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  801ff1:	74 1a                	je     80200d <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801ff3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff8:	b8 15 00 00 00       	mov    $0x15,%eax
+  801ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  802000:	89 cb                	mov    %ecx,%ebx
+  802002:	89 cf                	mov    %ecx,%edi
+  802004:	89 ce                	mov    %ecx,%esi
+  802006:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  802008:	5b                   	pop    %ebx
+  802009:	5e                   	pop    %esi
+  80200a:	5f                   	pop    %edi
+  80200b:	5d                   	pop    %ebp
+  80200c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80200d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802010:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802015:	b8 15 00 00 00       	mov    $0x15,%eax
+  80201a:	89 cb                	mov    %ecx,%ebx
+  80201c:	89 cf                	mov    %ecx,%edi
+  80201e:	55                   	push   %ebp
+  80201f:	89 e5                	mov    %esp,%ebp
+  802021:	8d 35 29 20 80 00    	lea    0x802029,%esi
+  802027:	0f 34                	sysenter
+  802029:	5d                   	pop    %ebp
+		goto out;
+  80202a:	eb dc                	jmp    802008 <sys_sb16_read_version+0x24>
+
+0080202c <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	57                   	push   %edi
+  802030:	56                   	push   %esi
+  802031:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802032:	80 3d 04 70 84 00 00 	cmpb   $0x0,0x847004
+  802039:	74 1b                	je     802056 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80203b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802040:	b8 16 00 00 00       	mov    $0x16,%eax
+  802045:	8b 55 08             	mov    0x8(%ebp),%edx
+  802048:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80204b:	89 df                	mov    %ebx,%edi
+  80204d:	89 de                	mov    %ebx,%esi
+  80204f:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  802051:	5b                   	pop    %ebx
+  802052:	5e                   	pop    %esi
+  802053:	5f                   	pop    %edi
+  802054:	5d                   	pop    %ebp
+  802055:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802056:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80205b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80205e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802061:	b8 16 00 00 00       	mov    $0x16,%eax
+  802066:	89 df                	mov    %ebx,%edi
+  802068:	55                   	push   %ebp
+  802069:	89 e5                	mov    %esp,%ebp
+  80206b:	8d 35 73 20 80 00    	lea    0x802073,%esi
+  802071:	0f 34                	sysenter
+  802073:	5d                   	pop    %ebp
+		goto out;
+  802074:	eb db                	jmp    802051 <sys_sb16_play+0x25>
+
+00802076 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  802076:	55                   	push   %ebp
+  802077:	89 e5                	mov    %esp,%ebp
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 04             	sub    $0x4,%esp
+  80207d:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  80207f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802086:	f6 c4 04             	test   $0x4,%ah
+  802089:	74 0c                	je     802097 <dupperm+0x21>
+  80208b:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  802092:	f6 c4 08             	test   $0x8,%ah
+  802095:	75 62                	jne    8020f9 <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  802097:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  80209e:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  8020a3:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8020a9:	74 19                	je     8020c4 <dupperm+0x4e>
+  8020ab:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8020b2:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  8020b7:	83 f8 01             	cmp    $0x1,%eax
+  8020ba:	19 c0                	sbb    %eax,%eax
+  8020bc:	25 00 08 00 00       	and    $0x800,%eax
+  8020c1:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  8020c4:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  8020cb:	89 c1                	mov    %eax,%ecx
+  8020cd:	80 cd 04             	or     $0x4,%ch
+  8020d0:	f6 c7 04             	test   $0x4,%bh
+  8020d3:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  8020d6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8020dd:	f6 c1 02             	test   $0x2,%cl
+  8020e0:	74 12                	je     8020f4 <dupperm+0x7e>
+  8020e2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  8020e9:	89 c2                	mov    %eax,%edx
+  8020eb:	83 ca 02             	or     $0x2,%edx
+  8020ee:	f6 c5 04             	test   $0x4,%ch
+  8020f1:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  8020f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8020f9:	68 98 42 80 00       	push   $0x804298
+  8020fe:	68 30 43 80 00       	push   $0x804330
+  802103:	6a 39                	push   $0x39
+  802105:	68 45 43 80 00       	push   $0x804345
+  80210a:	e8 d6 e8 ff ff       	call   8009e5 <_panic>
+
+0080210f <pgfault>:
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	53                   	push   %ebx
+  802113:	83 ec 04             	sub    $0x4,%esp
+  802116:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  802119:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80211b:	89 c3                	mov    %eax,%ebx
+  80211d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  802123:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  802127:	74 6d                	je     802196 <pgfault+0x87>
+  802129:	89 da                	mov    %ebx,%edx
+  80212b:	c1 ea 16             	shr    $0x16,%edx
+  80212e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802135:	f6 c2 80             	test   $0x80,%dl
+  802138:	75 5c                	jne    802196 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  80213a:	c1 e8 0c             	shr    $0xc,%eax
+  80213d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  802144:	f6 c4 08             	test   $0x8,%ah
+  802147:	74 4d                	je     802196 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802149:	83 ec 04             	sub    $0x4,%esp
+  80214c:	6a 07                	push   $0x7
+  80214e:	68 00 f0 7f 00       	push   $0x7ff000
+  802153:	6a 00                	push   $0x0
+  802155:	e8 a6 f4 ff ff       	call   801600 <sys_page_alloc>
+  80215a:	83 c4 10             	add    $0x10,%esp
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 49                	js     8021aa <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802161:	83 ec 04             	sub    $0x4,%esp
+  802164:	68 00 10 00 00       	push   $0x1000
+  802169:	53                   	push   %ebx
+  80216a:	68 00 f0 7f 00       	push   $0x7ff000
+  80216f:	e8 1a f1 ff ff       	call   80128e <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802174:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80217b:	53                   	push   %ebx
+  80217c:	6a 00                	push   $0x0
+  80217e:	68 00 f0 7f 00       	push   $0x7ff000
+  802183:	6a 00                	push   $0x0
+  802185:	e8 e3 f4 ff ff       	call   80166d <sys_page_map>
+  80218a:	83 c4 20             	add    $0x20,%esp
+  80218d:	85 c0                	test   %eax,%eax
+  80218f:	78 2d                	js     8021be <pgfault+0xaf>
+}
+  802191:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802194:	c9                   	leave
+  802195:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  802196:	83 ec 04             	sub    $0x4,%esp
+  802199:	68 50 43 80 00       	push   $0x804350
+  80219e:	6a 1e                	push   $0x1e
+  8021a0:	68 45 43 80 00       	push   $0x804345
+  8021a5:	e8 3b e8 ff ff       	call   8009e5 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  8021aa:	83 ec 04             	sub    $0x4,%esp
+  8021ad:	68 cc 42 80 00       	push   $0x8042cc
+  8021b2:	6a 29                	push   $0x29
+  8021b4:	68 45 43 80 00       	push   $0x804345
+  8021b9:	e8 27 e8 ff ff       	call   8009e5 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  8021be:	50                   	push   %eax
+  8021bf:	68 00 43 80 00       	push   $0x804300
+  8021c4:	6a 2e                	push   $0x2e
+  8021c6:	68 45 43 80 00       	push   $0x804345
+  8021cb:	e8 15 e8 ff ff       	call   8009e5 <_panic>
+
+008021d0 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  8021d0:	55                   	push   %ebp
+  8021d1:	89 e5                	mov    %esp,%ebp
+  8021d3:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  8021d6:	ff 75 0c             	push   0xc(%ebp)
+  8021d9:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8021dc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8021e3:	e8 23 f3 ff ff       	call   80150b <sys_env_destroy>
+}
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	c9                   	leave
+  8021ec:	c3                   	ret
+
+008021ed <ufork>:
+{
+  8021ed:	55                   	push   %ebp
+  8021ee:	89 e5                	mov    %esp,%ebp
+  8021f0:	57                   	push   %edi
+  8021f1:	56                   	push   %esi
+  8021f2:	53                   	push   %ebx
+  8021f3:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8021f9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021fe:	cd 30                	int    $0x30
+  802200:	89 c6                	mov    %eax,%esi
+  802202:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	78 56                	js     802262 <ufork+0x75>
+	if (pid > 0) {
+  80220c:	0f 8e b3 02 00 00    	jle    8024c5 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  802212:	83 ec 0c             	sub    $0xc,%esp
+  802215:	68 0f 21 80 00       	push   $0x80210f
+  80221a:	e8 1c 1a 00 00       	call   803c3b <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  80221f:	83 c4 08             	add    $0x8,%esp
+  802222:	68 a2 3c 80 00       	push   $0x803ca2
+  802227:	56                   	push   %esi
+  802228:	e8 ef f5 ff ff       	call   80181c <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  80222d:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  802233:	89 1c 24             	mov    %ebx,(%esp)
+  802236:	e8 a1 04 00 00       	call   8026dc <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  80223b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802242:	6a 07                	push   $0x7
+  802244:	68 00 f0 bf ee       	push   $0xeebff000
+  802249:	56                   	push   %esi
+  80224a:	53                   	push   %ebx
+  80224b:	e8 0d 06 00 00       	call   80285d <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  802250:	83 c4 20             	add    $0x20,%esp
+  802253:	bf 00 00 00 00       	mov    $0x0,%edi
+  802258:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  80225e:	89 fe                	mov    %edi,%esi
+  802260:	eb 22                	jmp    802284 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  802262:	50                   	push   %eax
+  802263:	68 69 43 80 00       	push   $0x804369
+  802268:	68 a9 00 00 00       	push   $0xa9
+  80226d:	68 45 43 80 00       	push   $0x804345
+  802272:	e8 6e e7 ff ff       	call   8009e5 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  802277:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  80227d:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  802282:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  802284:	89 f7                	mov    %esi,%edi
+  802286:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  80228c:	0f 87 e9 01 00 00    	ja     80247b <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  802292:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  802298:	85 f6                	test   %esi,%esi
+  80229a:	0f 49 d6             	cmovns %esi,%edx
+  80229d:	c1 fa 0a             	sar    $0xa,%edx
+  8022a0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  8022a7:	f6 c1 01             	test   $0x1,%cl
+  8022aa:	74 cb                	je     802277 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  8022ac:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8022b3:	f6 c2 80             	test   $0x80,%dl
+  8022b6:	75 17                	jne    8022cf <ufork+0xe2>
+			j = i + 1;
+  8022b8:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  8022bb:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  8022c2:	f6 c2 01             	test   $0x1,%dl
+  8022c5:	0f 85 f3 00 00 00    	jne    8023be <ufork+0x1d1>
+			j = i + 1;
+  8022cb:	89 de                	mov    %ebx,%esi
+  8022cd:	eb b5                	jmp    802284 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  8022cf:	89 fb                	mov    %edi,%ebx
+  8022d1:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  8022d4:	89 d8                	mov    %ebx,%eax
+  8022d6:	c1 e8 16             	shr    $0x16,%eax
+  8022d9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8022e0:	89 c2                	mov    %eax,%edx
+  8022e2:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  8022e8:	25 02 04 00 00       	and    $0x402,%eax
+  8022ed:	83 f8 02             	cmp    $0x2,%eax
+  8022f0:	74 31                	je     802323 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  8022f2:	83 ec 04             	sub    $0x4,%esp
+  8022f5:	6a 01                	push   $0x1
+  8022f7:	52                   	push   %edx
+  8022f8:	53                   	push   %ebx
+  8022f9:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  8022ff:	53                   	push   %ebx
+  802300:	6a 00                	push   $0x0
+  802302:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  802308:	50                   	push   %eax
+  802309:	e8 7a 05 00 00       	call   802888 <batch_map>
+		return;
+  80230e:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  802311:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  802317:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  80231c:	89 c6                	mov    %eax,%esi
+				continue;
+  80231e:	e9 61 ff ff ff       	jmp    802284 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  802323:	83 ec 04             	sub    $0x4,%esp
+  802326:	80 ca 80             	or     $0x80,%dl
+  802329:	52                   	push   %edx
+  80232a:	53                   	push   %ebx
+  80232b:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  802331:	e8 ca f2 ff ff       	call   801600 <sys_page_alloc>
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	78 5d                	js     80239a <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  80233d:	83 ec 0c             	sub    $0xc,%esp
+  802340:	6a 07                	push   $0x7
+  802342:	68 00 00 40 00       	push   $0x400000
+  802347:	6a 00                	push   $0x0
+  802349:	53                   	push   %ebx
+  80234a:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  802350:	e8 18 f3 ff ff       	call   80166d <sys_page_map>
+  802355:	83 c4 20             	add    $0x20,%esp
+  802358:	85 c0                	test   %eax,%eax
+  80235a:	78 50                	js     8023ac <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  80235c:	83 ec 04             	sub    $0x4,%esp
+  80235f:	68 00 00 40 00       	push   $0x400000
+  802364:	53                   	push   %ebx
+  802365:	68 00 00 40 00       	push   $0x400000
+  80236a:	e8 1f ef ff ff       	call   80128e <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80236f:	83 c4 08             	add    $0x8,%esp
+  802372:	68 00 00 40 00       	push   $0x400000
+  802377:	6a 00                	push   $0x0
+  802379:	e8 5d f3 ff ff       	call   8016db <sys_page_unmap>
+  80237e:	83 c4 10             	add    $0x10,%esp
+  802381:	85 c0                	test   %eax,%eax
+  802383:	79 8c                	jns    802311 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  802385:	50                   	push   %eax
+  802386:	68 8c 43 80 00       	push   $0x80438c
+  80238b:	68 81 00 00 00       	push   $0x81
+  802390:	68 45 43 80 00       	push   $0x804345
+  802395:	e8 4b e6 ff ff       	call   8009e5 <_panic>
+		panic("sys_page_alloc: %e", r);
+  80239a:	50                   	push   %eax
+  80239b:	68 79 43 80 00       	push   $0x804379
+  8023a0:	6a 7c                	push   $0x7c
+  8023a2:	68 45 43 80 00       	push   $0x804345
+  8023a7:	e8 39 e6 ff ff       	call   8009e5 <_panic>
+		panic("sys_page_map: %e", r);
+  8023ac:	50                   	push   %eax
+  8023ad:	68 78 3d 80 00       	push   $0x803d78
+  8023b2:	6a 7e                	push   $0x7e
+  8023b4:	68 45 43 80 00       	push   $0x804345
+  8023b9:	e8 27 e6 ff ff       	call   8009e5 <_panic>
+  8023be:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  8023c4:	eb 22                	jmp    8023e8 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  8023c6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  8023cd:	a8 01                	test   $0x1,%al
+  8023cf:	74 35                	je     802406 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  8023d1:	89 d8                	mov    %ebx,%eax
+  8023d3:	e8 9e fc ff ff       	call   802076 <dupperm>
+  8023d8:	89 c6                	mov    %eax,%esi
+  8023da:	89 f8                	mov    %edi,%eax
+  8023dc:	e8 95 fc ff ff       	call   802076 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  8023e1:	39 c6                	cmp    %eax,%esi
+  8023e3:	75 21                	jne    802406 <ufork+0x219>
+				j++;
+  8023e5:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  8023e8:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  8023ee:	74 16                	je     802406 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  8023f0:	89 d8                	mov    %ebx,%eax
+  8023f2:	c1 e8 0a             	shr    $0xa,%eax
+  8023f5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8023fc:	25 81 00 00 00       	and    $0x81,%eax
+  802401:	83 f8 01             	cmp    $0x1,%eax
+  802404:	74 c0                	je     8023c6 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  802406:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  80240c:	89 d8                	mov    %ebx,%eax
+  80240e:	29 f0                	sub    %esi,%eax
+  802410:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  802416:	89 fe                	mov    %edi,%esi
+  802418:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  80241b:	89 f8                	mov    %edi,%eax
+  80241d:	e8 54 fc ff ff       	call   802076 <dupperm>
+  802422:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  802424:	83 ec 08             	sub    $0x8,%esp
+  802427:	6a 02                	push   $0x2
+  802429:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  80242f:	51                   	push   %ecx
+  802430:	e8 15 03 00 00       	call   80274a <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  802435:	83 c4 0c             	add    $0xc,%esp
+  802438:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  80243e:	57                   	push   %edi
+  80243f:	56                   	push   %esi
+  802440:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  802446:	56                   	push   %esi
+  802447:	6a 00                	push   $0x0
+  802449:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  80244f:	51                   	push   %ecx
+  802450:	e8 33 04 00 00       	call   802888 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  802455:	83 c4 1c             	add    $0x1c,%esp
+  802458:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  80245e:	57                   	push   %edi
+  80245f:	56                   	push   %esi
+  802460:	6a 00                	push   $0x0
+  802462:	56                   	push   %esi
+  802463:	6a 00                	push   $0x0
+  802465:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  80246b:	50                   	push   %eax
+  80246c:	e8 17 04 00 00       	call   802888 <batch_map>
+	return 0;
+  802471:	83 c4 20             	add    $0x20,%esp
+  802474:	89 de                	mov    %ebx,%esi
+  802476:	e9 09 fe ff ff       	jmp    802284 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  80247b:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  802481:	83 ec 04             	sub    $0x4,%esp
+  802484:	6a 02                	push   $0x2
+  802486:	56                   	push   %esi
+  802487:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  80248d:	53                   	push   %ebx
+  80248e:	e8 49 04 00 00       	call   8028dc <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  802493:	89 1c 24             	mov    %ebx,(%esp)
+  802496:	e8 5d 02 00 00       	call   8026f8 <batch_flush>
+  80249b:	83 c4 10             	add    $0x10,%esp
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	78 0e                	js     8024b0 <ufork+0x2c3>
+}
+  8024a2:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  8024a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ab:	5b                   	pop    %ebx
+  8024ac:	5e                   	pop    %esi
+  8024ad:	5f                   	pop    %edi
+  8024ae:	5d                   	pop    %ebp
+  8024af:	c3                   	ret
+			panic("fork: %e", r);
+  8024b0:	50                   	push   %eax
+  8024b1:	68 70 43 80 00       	push   $0x804370
+  8024b6:	68 d7 00 00 00       	push   $0xd7
+  8024bb:	68 45 43 80 00       	push   $0x804345
+  8024c0:	e8 20 e5 ff ff       	call   8009e5 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  8024c5:	e8 aa f0 ff ff       	call   801574 <sys_getenvid>
+  8024ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8024cf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8024d5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024da:	a3 00 70 84 00       	mov    %eax,0x847000
+		return 0;
+  8024df:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  8024e6:	00 00 00 
+  8024e9:	eb b7                	jmp    8024a2 <ufork+0x2b5>
+
+008024eb <fork>:
+{
+  8024eb:	55                   	push   %ebp
+  8024ec:	89 e5                	mov    %esp,%ebp
+  8024ee:	53                   	push   %ebx
+  8024ef:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  8024f2:	68 0f 21 80 00       	push   $0x80210f
+  8024f7:	e8 3f 17 00 00       	call   803c3b <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  8024fc:	e8 7a f6 ff ff       	call   801b7b <sys_fork>
+  802501:	89 c3                	mov    %eax,%ebx
+  802503:	83 c4 10             	add    $0x10,%esp
+  802506:	85 c0                	test   %eax,%eax
+  802508:	78 09                	js     802513 <fork+0x28>
+	if (pid == 0)
+  80250a:	74 1c                	je     802528 <fork+0x3d>
+}
+  80250c:	89 d8                	mov    %ebx,%eax
+  80250e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802511:	c9                   	leave
+  802512:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  802513:	50                   	push   %eax
+  802514:	68 69 43 80 00       	push   $0x804369
+  802519:	68 ed 00 00 00       	push   $0xed
+  80251e:	68 45 43 80 00       	push   $0x804345
+  802523:	e8 bd e4 ff ff       	call   8009e5 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  802528:	e8 47 f0 ff ff       	call   801574 <sys_getenvid>
+  80252d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802532:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802538:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80253d:	a3 00 70 84 00       	mov    %eax,0x847000
+	return pid;
+  802542:	eb c8                	jmp    80250c <fork+0x21>
+
+00802544 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  802544:	55                   	push   %ebp
+  802545:	89 e5                	mov    %esp,%ebp
+  802547:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  80254a:	ff 75 0c             	push   0xc(%ebp)
+  80254d:	ff 75 08             	push   0x8(%ebp)
+  802550:	68 d0 21 80 00       	push   $0x8021d0
+  802555:	e8 67 f6 ff ff       	call   801bc1 <sys_thread_create>
+}
+  80255a:	c9                   	leave
+  80255b:	c3                   	ret
+
+0080255c <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  80255c:	55                   	push   %ebp
+  80255d:	89 e5                	mov    %esp,%ebp
+  80255f:	56                   	push   %esi
+  802560:	53                   	push   %ebx
+  802561:	8b 75 08             	mov    0x8(%ebp),%esi
+  802564:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802567:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80256a:	85 c0                	test   %eax,%eax
+  80256c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802571:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802574:	83 ec 08             	sub    $0x8,%esp
+  802577:	ff 75 14             	push   0x14(%ebp)
+  80257a:	50                   	push   %eax
+  80257b:	e8 91 f4 ff ff       	call   801a11 <sys_ipc_recv_until>
+  802580:	83 c4 10             	add    $0x10,%esp
+  802583:	85 c0                	test   %eax,%eax
+  802585:	78 61                	js     8025e8 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802587:	85 f6                	test   %esi,%esi
+  802589:	74 1c                	je     8025a7 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80258b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80258d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802592:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802598:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80259d:	76 5f                	jbe    8025fe <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  80259f:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8025a5:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8025a7:	85 db                	test   %ebx,%ebx
+  8025a9:	74 1c                	je     8025c7 <ipc_recv_until+0x6b>
+  8025ab:	89 e0                	mov    %esp,%eax
+  8025ad:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025b2:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025b8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025bd:	76 50                	jbe    80260f <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8025bf:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8025c5:	89 03                	mov    %eax,(%ebx)
+  8025c7:	89 e0                	mov    %esp,%eax
+  8025c9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025ce:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025d4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025d9:	76 45                	jbe    802620 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  8025db:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  8025e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025e4:	5b                   	pop    %ebx
+  8025e5:	5e                   	pop    %esi
+  8025e6:	5d                   	pop    %ebp
+  8025e7:	c3                   	ret
+		if (from_env_store)
+  8025e8:	85 f6                	test   %esi,%esi
+  8025ea:	74 06                	je     8025f2 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  8025ec:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8025f2:	85 db                	test   %ebx,%ebx
+  8025f4:	74 eb                	je     8025e1 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  8025f6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8025fc:	eb e3                	jmp    8025e1 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025fe:	c1 e8 10             	shr    $0x10,%eax
+  802601:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802607:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80260d:	eb 90                	jmp    80259f <ipc_recv_until+0x43>
+  80260f:	c1 e8 10             	shr    $0x10,%eax
+  802612:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802618:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80261e:	eb 9f                	jmp    8025bf <ipc_recv_until+0x63>
+  802620:	c1 e8 10             	shr    $0x10,%eax
+  802623:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802629:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80262f:	eb aa                	jmp    8025db <ipc_recv_until+0x7f>
+
+00802631 <ipc_recv>:
+{
+  802631:	55                   	push   %ebp
+  802632:	89 e5                	mov    %esp,%ebp
+  802634:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802637:	6a 00                	push   $0x0
+  802639:	ff 75 10             	push   0x10(%ebp)
+  80263c:	ff 75 0c             	push   0xc(%ebp)
+  80263f:	ff 75 08             	push   0x8(%ebp)
+  802642:	e8 15 ff ff ff       	call   80255c <ipc_recv_until>
+}
+  802647:	c9                   	leave
+  802648:	c3                   	ret
+
+00802649 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802649:	55                   	push   %ebp
+  80264a:	89 e5                	mov    %esp,%ebp
+  80264c:	57                   	push   %edi
+  80264d:	56                   	push   %esi
+  80264e:	53                   	push   %ebx
+  80264f:	83 ec 0c             	sub    $0xc,%esp
+  802652:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802655:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802658:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80265b:	85 db                	test   %ebx,%ebx
+  80265d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802662:	0f 44 d8             	cmove  %eax,%ebx
+  802665:	eb 05                	jmp    80266c <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802667:	e8 4e ef ff ff       	call   8015ba <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  80266c:	ff 75 14             	push   0x14(%ebp)
+  80266f:	53                   	push   %ebx
+  802670:	56                   	push   %esi
+  802671:	57                   	push   %edi
+  802672:	e8 e6 f2 ff ff       	call   80195d <sys_ipc_try_send>
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80267d:	74 e8                	je     802667 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  80267f:	85 c0                	test   %eax,%eax
+  802681:	78 08                	js     80268b <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802683:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802686:	5b                   	pop    %ebx
+  802687:	5e                   	pop    %esi
+  802688:	5f                   	pop    %edi
+  802689:	5d                   	pop    %ebp
+  80268a:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  80268b:	50                   	push   %eax
+  80268c:	68 9f 43 80 00       	push   $0x80439f
+  802691:	6a 4f                	push   $0x4f
+  802693:	68 b2 43 80 00       	push   $0x8043b2
+  802698:	e8 48 e3 ff ff       	call   8009e5 <_panic>
+
+0080269d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80269d:	55                   	push   %ebp
+  80269e:	89 e5                	mov    %esp,%ebp
+  8026a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8026a3:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8026a8:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8026ae:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8026b4:	8b 52 50             	mov    0x50(%edx),%edx
+  8026b7:	39 ca                	cmp    %ecx,%edx
+  8026b9:	74 11                	je     8026cc <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8026bb:	83 c0 01             	add    $0x1,%eax
+  8026be:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8026c3:	75 e3                	jne    8026a8 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8026c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ca:	eb 0e                	jmp    8026da <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8026cc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026d2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8026d7:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8026da:	5d                   	pop    %ebp
+  8026db:	c3                   	ret
+
+008026dc <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  8026dc:	55                   	push   %ebp
+  8026dd:	89 e5                	mov    %esp,%ebp
+  8026df:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  8026e2:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  8026e9:	00 00 00 
+	b->b_error = 0;
+  8026ec:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  8026f3:	00 00 00 
+}
+  8026f6:	5d                   	pop    %ebp
+  8026f7:	c3                   	ret
+
+008026f8 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  8026f8:	55                   	push   %ebp
+  8026f9:	89 e5                	mov    %esp,%ebp
+  8026fb:	53                   	push   %ebx
+  8026fc:	83 ec 04             	sub    $0x4,%esp
+  8026ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  802702:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	7e 09                	jle    802715 <batch_flush+0x1d>
+  80270c:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  802713:	74 15                	je     80272a <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  802715:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  80271c:	00 00 00 
+	return b->b_error;
+  80271f:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  802725:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802728:	c9                   	leave
+  802729:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  80272a:	83 ec 08             	sub    $0x8,%esp
+  80272d:	50                   	push   %eax
+  80272e:	53                   	push   %ebx
+  80272f:	e8 b2 f5 ff ff       	call   801ce6 <sys_batch>
+  802734:	83 c4 10             	add    $0x10,%esp
+  802737:	85 c0                	test   %eax,%eax
+  802739:	79 da                	jns    802715 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  80273b:	f7 d8                	neg    %eax
+  80273d:	0f b6 c0             	movzbl %al,%eax
+  802740:	f7 d8                	neg    %eax
+  802742:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  802748:	eb cb                	jmp    802715 <batch_flush+0x1d>
+
+0080274a <batch_reserve>:
+{
+  80274a:	55                   	push   %ebp
+  80274b:	89 e5                	mov    %esp,%ebp
+  80274d:	83 ec 08             	sub    $0x8,%esp
+  802750:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  802753:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  802759:	03 45 0c             	add    0xc(%ebp),%eax
+  80275c:	83 f8 10             	cmp    $0x10,%eax
+  80275f:	7f 02                	jg     802763 <batch_reserve+0x19>
+}
+  802761:	c9                   	leave
+  802762:	c3                   	ret
+		batch_flush(b);
+  802763:	83 ec 0c             	sub    $0xc,%esp
+  802766:	52                   	push   %edx
+  802767:	e8 8c ff ff ff       	call   8026f8 <batch_flush>
+  80276c:	83 c4 10             	add    $0x10,%esp
+}
+  80276f:	eb f0                	jmp    802761 <batch_reserve+0x17>
+
+00802771 <batch_next>:
+{
+  802771:	55                   	push   %ebp
+  802772:	89 e5                	mov    %esp,%ebp
+  802774:	53                   	push   %ebx
+  802775:	83 ec 04             	sub    $0x4,%esp
+  802778:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  80277a:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  802781:	74 28                	je     8027ab <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  802783:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  802789:	8d 50 01             	lea    0x1(%eax),%edx
+  80278c:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  802792:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802795:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  802797:	83 ec 04             	sub    $0x4,%esp
+  80279a:	6a 1c                	push   $0x1c
+  80279c:	6a 00                	push   $0x0
+  80279e:	53                   	push   %ebx
+  80279f:	e8 b5 ea ff ff       	call   801259 <memset>
+}
+  8027a4:	89 d8                	mov    %ebx,%eax
+  8027a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027a9:	c9                   	leave
+  8027aa:	c3                   	ret
+		batch_flush(b);
+  8027ab:	83 ec 0c             	sub    $0xc,%esp
+  8027ae:	50                   	push   %eax
+  8027af:	e8 44 ff ff ff       	call   8026f8 <batch_flush>
+  8027b4:	83 c4 10             	add    $0x10,%esp
+  8027b7:	eb ca                	jmp    802783 <batch_next+0x12>
+
+008027b9 <batch_page>:
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	57                   	push   %edi
+  8027bd:	56                   	push   %esi
+  8027be:	53                   	push   %ebx
+  8027bf:	83 ec 1c             	sub    $0x1c,%esp
+  8027c2:	89 d3                	mov    %edx,%ebx
+  8027c4:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  8027c6:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  8027cc:	85 d2                	test   %edx,%edx
+  8027ce:	74 50                	je     802820 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  8027d0:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  8027d3:	01 c1                	add    %eax,%ecx
+  8027d5:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  8027d8:	75 46                	jne    802820 <batch_page+0x67>
+  8027da:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  8027dd:	75 41                	jne    802820 <batch_page+0x67>
+  8027df:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  8027e2:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  8027e5:	75 39                	jne    802820 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  8027e7:	83 ea 01             	sub    $0x1,%edx
+  8027ea:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8027ed:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8027f0:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  8027f4:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8027f7:	75 27                	jne    802820 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8027f9:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8027fc:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  802800:	89 fa                	mov    %edi,%edx
+  802802:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802805:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802808:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  80280b:	39 55 08             	cmp    %edx,0x8(%ebp)
+  80280e:	75 10                	jne    802820 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802810:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  802814:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802817:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  80281b:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80281e:	74 2a                	je     80284a <batch_page+0x91>
+	op = batch_next(b);
+  802820:	e8 4c ff ff ff       	call   802771 <batch_next>
+	op->bo_op = opcode;
+  802825:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  802827:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  80282a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80282d:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802830:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802833:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  802836:	8b 75 10             	mov    0x10(%ebp),%esi
+  802839:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  80283c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80283f:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802842:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802845:	89 78 14             	mov    %edi,0x14(%eax)
+  802848:	eb 0b                	jmp    802855 <batch_page+0x9c>
+		op->bo_npages += npages;
+  80284a:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  80284e:	03 7d 18             	add    0x18(%ebp),%edi
+  802851:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802855:	83 c4 1c             	add    $0x1c,%esp
+  802858:	5b                   	pop    %ebx
+  802859:	5e                   	pop    %esi
+  80285a:	5f                   	pop    %edi
+  80285b:	5d                   	pop    %ebp
+  80285c:	c3                   	ret
+
+0080285d <batch_alloc>:
+{
+  80285d:	55                   	push   %ebp
+  80285e:	89 e5                	mov    %esp,%ebp
+  802860:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802863:	ff 75 18             	push   0x18(%ebp)
+  802866:	ff 75 14             	push   0x14(%ebp)
+  802869:	ff 75 10             	push   0x10(%ebp)
+  80286c:	ff 75 0c             	push   0xc(%ebp)
+  80286f:	6a 00                	push   $0x0
+  802871:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287e:	e8 36 ff ff ff       	call   8027b9 <batch_page>
+}
+  802883:	83 c4 20             	add    $0x20,%esp
+  802886:	c9                   	leave
+  802887:	c3                   	ret
+
+00802888 <batch_map>:
+{
+  802888:	55                   	push   %ebp
+  802889:	89 e5                	mov    %esp,%ebp
+  80288b:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  80288e:	ff 75 20             	push   0x20(%ebp)
+  802891:	ff 75 1c             	push   0x1c(%ebp)
+  802894:	ff 75 18             	push   0x18(%ebp)
+  802897:	ff 75 14             	push   0x14(%ebp)
+  80289a:	ff 75 10             	push   0x10(%ebp)
+  80289d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028a0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8028a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a8:	e8 0c ff ff ff       	call   8027b9 <batch_page>
+}
+  8028ad:	83 c4 20             	add    $0x20,%esp
+  8028b0:	c9                   	leave
+  8028b1:	c3                   	ret
+
+008028b2 <batch_unmap>:
+{
+  8028b2:	55                   	push   %ebp
+  8028b3:	89 e5                	mov    %esp,%ebp
+  8028b5:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  8028b8:	ff 75 14             	push   0x14(%ebp)
+  8028bb:	6a 00                	push   $0x0
+  8028bd:	ff 75 10             	push   0x10(%ebp)
+  8028c0:	ff 75 0c             	push   0xc(%ebp)
+  8028c3:	6a 00                	push   $0x0
+  8028c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ca:	ba 02 00 00 00       	mov    $0x2,%edx
+  8028cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d2:	e8 e2 fe ff ff       	call   8027b9 <batch_page>
+}
+  8028d7:	83 c4 20             	add    $0x20,%esp
+  8028da:	c9                   	leave
+  8028db:	c3                   	ret
+
+008028dc <batch_set_status>:
+{
+  8028dc:	55                   	push   %ebp
+  8028dd:	89 e5                	mov    %esp,%ebp
+  8028df:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8028e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e5:	e8 87 fe ff ff       	call   802771 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8028ea:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8028f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028f3:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8028f6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8028f9:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8028fc:	c9                   	leave
+  8028fd:	c3                   	ret
+
+008028fe <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8028fe:	55                   	push   %ebp
+  8028ff:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802901:	8b 45 08             	mov    0x8(%ebp),%eax
+  802904:	05 00 00 00 30       	add    $0x30000000,%eax
+  802909:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80290c:	5d                   	pop    %ebp
+  80290d:	c3                   	ret
+
+0080290e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80290e:	55                   	push   %ebp
+  80290f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802911:	8b 45 08             	mov    0x8(%ebp),%eax
+  802914:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802919:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80291e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802923:	5d                   	pop    %ebp
+  802924:	c3                   	ret
+
+00802925 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802925:	55                   	push   %ebp
+  802926:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802928:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80292d:	eb 02                	jmp    802931 <fd_alloc+0xc>
+  80292f:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802931:	89 c2                	mov    %eax,%edx
+  802933:	c1 ea 16             	shr    $0x16,%edx
+  802936:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80293d:	f6 c2 01             	test   $0x1,%dl
+  802940:	74 2b                	je     80296d <fd_alloc+0x48>
+  802942:	89 c2                	mov    %eax,%edx
+  802944:	c1 ea 0c             	shr    $0xc,%edx
+  802947:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80294e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802954:	f6 c1 01             	test   $0x1,%cl
+  802957:	74 14                	je     80296d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802959:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80295f:	75 ce                	jne    80292f <fd_alloc+0xa>
+  802961:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802966:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80296b:	eb 05                	jmp    802972 <fd_alloc+0x4d>
+			return 0;
+  80296d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802972:	8b 55 08             	mov    0x8(%ebp),%edx
+  802975:	89 02                	mov    %eax,(%edx)
+}
+  802977:	89 c8                	mov    %ecx,%eax
+  802979:	5d                   	pop    %ebp
+  80297a:	c3                   	ret
+
+0080297b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80297b:	55                   	push   %ebp
+  80297c:	89 e5                	mov    %esp,%ebp
+  80297e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802981:	83 f8 1f             	cmp    $0x1f,%eax
+  802984:	77 30                	ja     8029b6 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802986:	c1 e0 0c             	shl    $0xc,%eax
+  802989:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80298e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802994:	f6 c2 01             	test   $0x1,%dl
+  802997:	74 24                	je     8029bd <fd_lookup+0x42>
+  802999:	89 c2                	mov    %eax,%edx
+  80299b:	c1 ea 0c             	shr    $0xc,%edx
+  80299e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8029a5:	f6 c2 01             	test   $0x1,%dl
+  8029a8:	74 1a                	je     8029c4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8029aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029ad:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8029af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029b4:	5d                   	pop    %ebp
+  8029b5:	c3                   	ret
+		return -E_INVAL;
+  8029b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029bb:	eb f7                	jmp    8029b4 <fd_lookup+0x39>
+		return -E_INVAL;
+  8029bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029c2:	eb f0                	jmp    8029b4 <fd_lookup+0x39>
+  8029c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029c9:	eb e9                	jmp    8029b4 <fd_lookup+0x39>
+
+008029cb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8029cb:	55                   	push   %ebp
+  8029cc:	89 e5                	mov    %esp,%ebp
+  8029ce:	53                   	push   %ebx
+  8029cf:	83 ec 04             	sub    $0x4,%esp
+  8029d2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8029d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029da:	eb 03                	jmp    8029df <dev_lookup+0x14>
+  8029dc:	83 c0 01             	add    $0x1,%eax
+  8029df:	8b 1c 85 38 44 80 00 	mov    0x804438(,%eax,4),%ebx
+  8029e6:	85 db                	test   %ebx,%ebx
+  8029e8:	74 0b                	je     8029f5 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8029ea:	39 13                	cmp    %edx,(%ebx)
+  8029ec:	75 ee                	jne    8029dc <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8029ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f3:	eb 2e                	jmp    802a23 <dev_lookup+0x58>
+  8029f5:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029f7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029fc:	8b 0d 00 70 84 00    	mov    0x847000,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a02:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a07:	76 24                	jbe    802a2d <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802a09:	8b 41 48             	mov    0x48(%ecx),%eax
+  802a0c:	83 ec 04             	sub    $0x4,%esp
+  802a0f:	52                   	push   %edx
+  802a10:	50                   	push   %eax
+  802a11:	68 bc 43 80 00       	push   $0x8043bc
+  802a16:	e8 a5 e0 ff ff       	call   800ac0 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802a1b:	83 c4 10             	add    $0x10,%esp
+  802a1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802a23:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a26:	89 1a                	mov    %ebx,(%edx)
+}
+  802a28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a2b:	c9                   	leave
+  802a2c:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a2d:	c1 e8 10             	shr    $0x10,%eax
+  802a30:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a36:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802a3c:	eb cb                	jmp    802a09 <dev_lookup+0x3e>
+
+00802a3e <fd_close>:
+{
+  802a3e:	55                   	push   %ebp
+  802a3f:	89 e5                	mov    %esp,%ebp
+  802a41:	57                   	push   %edi
+  802a42:	56                   	push   %esi
+  802a43:	53                   	push   %ebx
+  802a44:	83 ec 24             	sub    $0x24,%esp
+  802a47:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a4a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802a4d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a50:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802a51:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802a57:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802a5a:	50                   	push   %eax
+  802a5b:	e8 1b ff ff ff       	call   80297b <fd_lookup>
+  802a60:	89 c3                	mov    %eax,%ebx
+  802a62:	83 c4 10             	add    $0x10,%esp
+  802a65:	85 c0                	test   %eax,%eax
+  802a67:	78 05                	js     802a6e <fd_close+0x30>
+	    || fd != fd2)
+  802a69:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802a6c:	74 16                	je     802a84 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802a6e:	89 f8                	mov    %edi,%eax
+  802a70:	84 c0                	test   %al,%al
+  802a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a77:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802a7a:	89 d8                	mov    %ebx,%eax
+  802a7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a7f:	5b                   	pop    %ebx
+  802a80:	5e                   	pop    %esi
+  802a81:	5f                   	pop    %edi
+  802a82:	5d                   	pop    %ebp
+  802a83:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802a84:	83 ec 08             	sub    $0x8,%esp
+  802a87:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802a8a:	50                   	push   %eax
+  802a8b:	ff 36                	push   (%esi)
+  802a8d:	e8 39 ff ff ff       	call   8029cb <dev_lookup>
+  802a92:	89 c3                	mov    %eax,%ebx
+  802a94:	83 c4 10             	add    $0x10,%esp
+  802a97:	85 c0                	test   %eax,%eax
+  802a99:	78 1a                	js     802ab5 <fd_close+0x77>
+		if (dev->dev_close)
+  802a9b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a9e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802aa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802aa6:	85 c0                	test   %eax,%eax
+  802aa8:	74 0b                	je     802ab5 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802aaa:	83 ec 0c             	sub    $0xc,%esp
+  802aad:	56                   	push   %esi
+  802aae:	ff d0                	call   *%eax
+  802ab0:	89 c3                	mov    %eax,%ebx
+  802ab2:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802ab5:	83 ec 08             	sub    $0x8,%esp
+  802ab8:	56                   	push   %esi
+  802ab9:	6a 00                	push   $0x0
+  802abb:	e8 1b ec ff ff       	call   8016db <sys_page_unmap>
+	return r;
+  802ac0:	83 c4 10             	add    $0x10,%esp
+  802ac3:	eb b5                	jmp    802a7a <fd_close+0x3c>
+
+00802ac5 <close>:
+
+int
+close(int fdnum)
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802acb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ace:	50                   	push   %eax
+  802acf:	ff 75 08             	push   0x8(%ebp)
+  802ad2:	e8 a4 fe ff ff       	call   80297b <fd_lookup>
+  802ad7:	83 c4 10             	add    $0x10,%esp
+  802ada:	85 c0                	test   %eax,%eax
+  802adc:	79 02                	jns    802ae0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+		return fd_close(fd, 1);
+  802ae0:	83 ec 08             	sub    $0x8,%esp
+  802ae3:	6a 01                	push   $0x1
+  802ae5:	ff 75 f4             	push   -0xc(%ebp)
+  802ae8:	e8 51 ff ff ff       	call   802a3e <fd_close>
+  802aed:	83 c4 10             	add    $0x10,%esp
+  802af0:	eb ec                	jmp    802ade <close+0x19>
+
+00802af2 <close_all>:
+
+void
+close_all(void)
+{
+  802af2:	55                   	push   %ebp
+  802af3:	89 e5                	mov    %esp,%ebp
+  802af5:	53                   	push   %ebx
+  802af6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802af9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802afe:	83 ec 0c             	sub    $0xc,%esp
+  802b01:	53                   	push   %ebx
+  802b02:	e8 be ff ff ff       	call   802ac5 <close>
+	for (i = 0; i < MAXFD; i++)
+  802b07:	83 c3 01             	add    $0x1,%ebx
+  802b0a:	83 c4 10             	add    $0x10,%esp
+  802b0d:	83 fb 20             	cmp    $0x20,%ebx
+  802b10:	75 ec                	jne    802afe <close_all+0xc>
+}
+  802b12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	57                   	push   %edi
+  802b1b:	56                   	push   %esi
+  802b1c:	53                   	push   %ebx
+  802b1d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802b20:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b23:	50                   	push   %eax
+  802b24:	ff 75 08             	push   0x8(%ebp)
+  802b27:	e8 4f fe ff ff       	call   80297b <fd_lookup>
+  802b2c:	89 c3                	mov    %eax,%ebx
+  802b2e:	83 c4 10             	add    $0x10,%esp
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	78 7f                	js     802bb4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802b35:	83 ec 0c             	sub    $0xc,%esp
+  802b38:	ff 75 0c             	push   0xc(%ebp)
+  802b3b:	e8 85 ff ff ff       	call   802ac5 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802b40:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b43:	c1 e6 0c             	shl    $0xc,%esi
+  802b46:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802b4c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802b4f:	89 3c 24             	mov    %edi,(%esp)
+  802b52:	e8 b7 fd ff ff       	call   80290e <fd2data>
+  802b57:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802b59:	89 34 24             	mov    %esi,(%esp)
+  802b5c:	e8 ad fd ff ff       	call   80290e <fd2data>
+  802b61:	83 c4 10             	add    $0x10,%esp
+  802b64:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802b67:	89 d8                	mov    %ebx,%eax
+  802b69:	c1 e8 16             	shr    $0x16,%eax
+  802b6c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802b73:	a8 01                	test   $0x1,%al
+  802b75:	74 11                	je     802b88 <dup+0x71>
+  802b77:	89 d8                	mov    %ebx,%eax
+  802b79:	c1 e8 0c             	shr    $0xc,%eax
+  802b7c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802b83:	f6 c2 01             	test   $0x1,%dl
+  802b86:	75 36                	jne    802bbe <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802b88:	89 f8                	mov    %edi,%eax
+  802b8a:	c1 e8 0c             	shr    $0xc,%eax
+  802b8d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802b94:	83 ec 0c             	sub    $0xc,%esp
+  802b97:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b9c:	50                   	push   %eax
+  802b9d:	56                   	push   %esi
+  802b9e:	6a 00                	push   $0x0
+  802ba0:	57                   	push   %edi
+  802ba1:	6a 00                	push   $0x0
+  802ba3:	e8 c5 ea ff ff       	call   80166d <sys_page_map>
+  802ba8:	89 c3                	mov    %eax,%ebx
+  802baa:	83 c4 20             	add    $0x20,%esp
+  802bad:	85 c0                	test   %eax,%eax
+  802baf:	78 33                	js     802be4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802bb1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802bb4:	89 d8                	mov    %ebx,%eax
+  802bb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb9:	5b                   	pop    %ebx
+  802bba:	5e                   	pop    %esi
+  802bbb:	5f                   	pop    %edi
+  802bbc:	5d                   	pop    %ebp
+  802bbd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802bbe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802bc5:	83 ec 0c             	sub    $0xc,%esp
+  802bc8:	25 07 0e 00 00       	and    $0xe07,%eax
+  802bcd:	50                   	push   %eax
+  802bce:	ff 75 d4             	push   -0x2c(%ebp)
+  802bd1:	6a 00                	push   $0x0
+  802bd3:	53                   	push   %ebx
+  802bd4:	6a 00                	push   $0x0
+  802bd6:	e8 92 ea ff ff       	call   80166d <sys_page_map>
+  802bdb:	89 c3                	mov    %eax,%ebx
+  802bdd:	83 c4 20             	add    $0x20,%esp
+  802be0:	85 c0                	test   %eax,%eax
+  802be2:	79 a4                	jns    802b88 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802be4:	83 ec 08             	sub    $0x8,%esp
+  802be7:	56                   	push   %esi
+  802be8:	6a 00                	push   $0x0
+  802bea:	e8 ec ea ff ff       	call   8016db <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802bef:	83 c4 08             	add    $0x8,%esp
+  802bf2:	ff 75 d4             	push   -0x2c(%ebp)
+  802bf5:	6a 00                	push   $0x0
+  802bf7:	e8 df ea ff ff       	call   8016db <sys_page_unmap>
+	return r;
+  802bfc:	83 c4 10             	add    $0x10,%esp
+  802bff:	eb b3                	jmp    802bb4 <dup+0x9d>
+
+00802c01 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802c01:	55                   	push   %ebp
+  802c02:	89 e5                	mov    %esp,%ebp
+  802c04:	56                   	push   %esi
+  802c05:	53                   	push   %ebx
+  802c06:	83 ec 18             	sub    $0x18,%esp
+  802c09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802c0c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802c0f:	50                   	push   %eax
+  802c10:	53                   	push   %ebx
+  802c11:	e8 65 fd ff ff       	call   80297b <fd_lookup>
+  802c16:	83 c4 10             	add    $0x10,%esp
+  802c19:	85 c0                	test   %eax,%eax
+  802c1b:	78 3c                	js     802c59 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802c1d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802c20:	83 ec 08             	sub    $0x8,%esp
+  802c23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c26:	50                   	push   %eax
+  802c27:	ff 36                	push   (%esi)
+  802c29:	e8 9d fd ff ff       	call   8029cb <dev_lookup>
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	85 c0                	test   %eax,%eax
+  802c33:	78 24                	js     802c59 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802c35:	8b 46 08             	mov    0x8(%esi),%eax
+  802c38:	83 e0 03             	and    $0x3,%eax
+  802c3b:	83 f8 01             	cmp    $0x1,%eax
+  802c3e:	74 20                	je     802c60 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802c40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c43:	8b 40 08             	mov    0x8(%eax),%eax
+  802c46:	85 c0                	test   %eax,%eax
+  802c48:	74 57                	je     802ca1 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802c4a:	83 ec 04             	sub    $0x4,%esp
+  802c4d:	ff 75 10             	push   0x10(%ebp)
+  802c50:	ff 75 0c             	push   0xc(%ebp)
+  802c53:	56                   	push   %esi
+  802c54:	ff d0                	call   *%eax
+  802c56:	83 c4 10             	add    $0x10,%esp
+}
+  802c59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c5c:	5b                   	pop    %ebx
+  802c5d:	5e                   	pop    %esi
+  802c5e:	5d                   	pop    %ebp
+  802c5f:	c3                   	ret
+  802c60:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c62:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c67:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c6d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c72:	76 1c                	jbe    802c90 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802c74:	8b 42 48             	mov    0x48(%edx),%eax
+  802c77:	83 ec 04             	sub    $0x4,%esp
+  802c7a:	53                   	push   %ebx
+  802c7b:	50                   	push   %eax
+  802c7c:	68 fd 43 80 00       	push   $0x8043fd
+  802c81:	e8 3a de ff ff       	call   800ac0 <cprintf>
+		return -E_INVAL;
+  802c86:	83 c4 10             	add    $0x10,%esp
+  802c89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c8e:	eb c9                	jmp    802c59 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802c90:	c1 e8 10             	shr    $0x10,%eax
+  802c93:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c99:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c9f:	eb d3                	jmp    802c74 <read+0x73>
+		return -E_NOT_SUPP;
+  802ca1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ca6:	eb b1                	jmp    802c59 <read+0x58>
+
+00802ca8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802ca8:	55                   	push   %ebp
+  802ca9:	89 e5                	mov    %esp,%ebp
+  802cab:	57                   	push   %edi
+  802cac:	56                   	push   %esi
+  802cad:	53                   	push   %ebx
+  802cae:	83 ec 0c             	sub    $0xc,%esp
+  802cb1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cb4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802cb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cbc:	eb 02                	jmp    802cc0 <readn+0x18>
+  802cbe:	01 c3                	add    %eax,%ebx
+  802cc0:	39 f3                	cmp    %esi,%ebx
+  802cc2:	73 21                	jae    802ce5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802cc4:	83 ec 04             	sub    $0x4,%esp
+  802cc7:	89 f0                	mov    %esi,%eax
+  802cc9:	29 d8                	sub    %ebx,%eax
+  802ccb:	50                   	push   %eax
+  802ccc:	89 d8                	mov    %ebx,%eax
+  802cce:	03 45 0c             	add    0xc(%ebp),%eax
+  802cd1:	50                   	push   %eax
+  802cd2:	57                   	push   %edi
+  802cd3:	e8 29 ff ff ff       	call   802c01 <read>
+		if (m < 0)
+  802cd8:	83 c4 10             	add    $0x10,%esp
+  802cdb:	85 c0                	test   %eax,%eax
+  802cdd:	78 04                	js     802ce3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802cdf:	75 dd                	jne    802cbe <readn+0x16>
+  802ce1:	eb 02                	jmp    802ce5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802ce3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802ce5:	89 d8                	mov    %ebx,%eax
+  802ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cea:	5b                   	pop    %ebx
+  802ceb:	5e                   	pop    %esi
+  802cec:	5f                   	pop    %edi
+  802ced:	5d                   	pop    %ebp
+  802cee:	c3                   	ret
+
+00802cef <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	56                   	push   %esi
+  802cf3:	53                   	push   %ebx
+  802cf4:	83 ec 18             	sub    $0x18,%esp
+  802cf7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802cfa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802cfd:	50                   	push   %eax
+  802cfe:	53                   	push   %ebx
+  802cff:	e8 77 fc ff ff       	call   80297b <fd_lookup>
+  802d04:	83 c4 10             	add    $0x10,%esp
+  802d07:	85 c0                	test   %eax,%eax
+  802d09:	78 37                	js     802d42 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802d0b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802d0e:	83 ec 08             	sub    $0x8,%esp
+  802d11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d14:	50                   	push   %eax
+  802d15:	ff 36                	push   (%esi)
+  802d17:	e8 af fc ff ff       	call   8029cb <dev_lookup>
+  802d1c:	83 c4 10             	add    $0x10,%esp
+  802d1f:	85 c0                	test   %eax,%eax
+  802d21:	78 1f                	js     802d42 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802d23:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802d27:	74 20                	je     802d49 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802d29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  802d2f:	85 c0                	test   %eax,%eax
+  802d31:	74 57                	je     802d8a <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802d33:	83 ec 04             	sub    $0x4,%esp
+  802d36:	ff 75 10             	push   0x10(%ebp)
+  802d39:	ff 75 0c             	push   0xc(%ebp)
+  802d3c:	56                   	push   %esi
+  802d3d:	ff d0                	call   *%eax
+  802d3f:	83 c4 10             	add    $0x10,%esp
+}
+  802d42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d45:	5b                   	pop    %ebx
+  802d46:	5e                   	pop    %esi
+  802d47:	5d                   	pop    %ebp
+  802d48:	c3                   	ret
+  802d49:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d4b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d50:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d56:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d5b:	76 1c                	jbe    802d79 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d5d:	8b 42 48             	mov    0x48(%edx),%eax
+  802d60:	83 ec 04             	sub    $0x4,%esp
+  802d63:	53                   	push   %ebx
+  802d64:	50                   	push   %eax
+  802d65:	68 19 44 80 00       	push   $0x804419
+  802d6a:	e8 51 dd ff ff       	call   800ac0 <cprintf>
+		return -E_INVAL;
+  802d6f:	83 c4 10             	add    $0x10,%esp
+  802d72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d77:	eb c9                	jmp    802d42 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d79:	c1 e8 10             	shr    $0x10,%eax
+  802d7c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d82:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d88:	eb d3                	jmp    802d5d <write+0x6e>
+		return -E_NOT_SUPP;
+  802d8a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802d8f:	eb b1                	jmp    802d42 <write+0x53>
+
+00802d91 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802d91:	55                   	push   %ebp
+  802d92:	89 e5                	mov    %esp,%ebp
+  802d94:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d9a:	50                   	push   %eax
+  802d9b:	ff 75 08             	push   0x8(%ebp)
+  802d9e:	e8 d8 fb ff ff       	call   80297b <fd_lookup>
+  802da3:	83 c4 10             	add    $0x10,%esp
+  802da6:	85 c0                	test   %eax,%eax
+  802da8:	78 0e                	js     802db8 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802daa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802dad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802db0:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802db3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802db8:	c9                   	leave
+  802db9:	c3                   	ret
+
+00802dba <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802dba:	55                   	push   %ebp
+  802dbb:	89 e5                	mov    %esp,%ebp
+  802dbd:	56                   	push   %esi
+  802dbe:	53                   	push   %ebx
+  802dbf:	83 ec 18             	sub    $0x18,%esp
+  802dc2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802dc5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802dc8:	50                   	push   %eax
+  802dc9:	53                   	push   %ebx
+  802dca:	e8 ac fb ff ff       	call   80297b <fd_lookup>
+  802dcf:	83 c4 10             	add    $0x10,%esp
+  802dd2:	85 c0                	test   %eax,%eax
+  802dd4:	78 34                	js     802e0a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802dd6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802dd9:	83 ec 08             	sub    $0x8,%esp
+  802ddc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ddf:	50                   	push   %eax
+  802de0:	ff 36                	push   (%esi)
+  802de2:	e8 e4 fb ff ff       	call   8029cb <dev_lookup>
+  802de7:	83 c4 10             	add    $0x10,%esp
+  802dea:	85 c0                	test   %eax,%eax
+  802dec:	78 1c                	js     802e0a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802dee:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802df2:	74 1d                	je     802e11 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802df4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802df7:	8b 40 18             	mov    0x18(%eax),%eax
+  802dfa:	85 c0                	test   %eax,%eax
+  802dfc:	74 54                	je     802e52 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802dfe:	83 ec 08             	sub    $0x8,%esp
+  802e01:	ff 75 0c             	push   0xc(%ebp)
+  802e04:	56                   	push   %esi
+  802e05:	ff d0                	call   *%eax
+  802e07:	83 c4 10             	add    $0x10,%esp
+}
+  802e0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e0d:	5b                   	pop    %ebx
+  802e0e:	5e                   	pop    %esi
+  802e0f:	5d                   	pop    %ebp
+  802e10:	c3                   	ret
+  802e11:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e13:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e18:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e1e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e23:	76 1c                	jbe    802e41 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802e25:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802e28:	83 ec 04             	sub    $0x4,%esp
+  802e2b:	53                   	push   %ebx
+  802e2c:	50                   	push   %eax
+  802e2d:	68 dc 43 80 00       	push   $0x8043dc
+  802e32:	e8 89 dc ff ff       	call   800ac0 <cprintf>
+		return -E_INVAL;
+  802e37:	83 c4 10             	add    $0x10,%esp
+  802e3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e3f:	eb c9                	jmp    802e0a <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e41:	c1 e8 10             	shr    $0x10,%eax
+  802e44:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e4a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e50:	eb d3                	jmp    802e25 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802e52:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802e57:	eb b1                	jmp    802e0a <ftruncate+0x50>
+
+00802e59 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802e59:	55                   	push   %ebp
+  802e5a:	89 e5                	mov    %esp,%ebp
+  802e5c:	56                   	push   %esi
+  802e5d:	53                   	push   %ebx
+  802e5e:	83 ec 18             	sub    $0x18,%esp
+  802e61:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802e64:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e67:	50                   	push   %eax
+  802e68:	ff 75 08             	push   0x8(%ebp)
+  802e6b:	e8 0b fb ff ff       	call   80297b <fd_lookup>
+  802e70:	83 c4 10             	add    $0x10,%esp
+  802e73:	85 c0                	test   %eax,%eax
+  802e75:	78 49                	js     802ec0 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e77:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802e7a:	83 ec 08             	sub    $0x8,%esp
+  802e7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e80:	50                   	push   %eax
+  802e81:	ff 36                	push   (%esi)
+  802e83:	e8 43 fb ff ff       	call   8029cb <dev_lookup>
+  802e88:	83 c4 10             	add    $0x10,%esp
+  802e8b:	85 c0                	test   %eax,%eax
+  802e8d:	78 31                	js     802ec0 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802e8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e92:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802e96:	74 2f                	je     802ec7 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802e98:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802e9b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802ea2:	00 00 00 
+	stat->st_isdir = 0;
+  802ea5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802eac:	00 00 00 
+	stat->st_dev = dev;
+  802eaf:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802eb5:	83 ec 08             	sub    $0x8,%esp
+  802eb8:	53                   	push   %ebx
+  802eb9:	56                   	push   %esi
+  802eba:	ff 50 14             	call   *0x14(%eax)
+  802ebd:	83 c4 10             	add    $0x10,%esp
+}
+  802ec0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ec3:	5b                   	pop    %ebx
+  802ec4:	5e                   	pop    %esi
+  802ec5:	5d                   	pop    %ebp
+  802ec6:	c3                   	ret
+		return -E_NOT_SUPP;
+  802ec7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ecc:	eb f2                	jmp    802ec0 <fstat+0x67>
+
+00802ece <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802ece:	55                   	push   %ebp
+  802ecf:	89 e5                	mov    %esp,%ebp
+  802ed1:	56                   	push   %esi
+  802ed2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802ed3:	83 ec 08             	sub    $0x8,%esp
+  802ed6:	6a 00                	push   $0x0
+  802ed8:	ff 75 08             	push   0x8(%ebp)
+  802edb:	e8 e4 01 00 00       	call   8030c4 <open>
+  802ee0:	89 c3                	mov    %eax,%ebx
+  802ee2:	83 c4 10             	add    $0x10,%esp
+  802ee5:	85 c0                	test   %eax,%eax
+  802ee7:	78 1b                	js     802f04 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802ee9:	83 ec 08             	sub    $0x8,%esp
+  802eec:	ff 75 0c             	push   0xc(%ebp)
+  802eef:	50                   	push   %eax
+  802ef0:	e8 64 ff ff ff       	call   802e59 <fstat>
+  802ef5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802ef7:	89 1c 24             	mov    %ebx,(%esp)
+  802efa:	e8 c6 fb ff ff       	call   802ac5 <close>
+	return r;
+  802eff:	83 c4 10             	add    $0x10,%esp
+  802f02:	89 f3                	mov    %esi,%ebx
+}
+  802f04:	89 d8                	mov    %ebx,%eax
+  802f06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f09:	5b                   	pop    %ebx
+  802f0a:	5e                   	pop    %esi
+  802f0b:	5d                   	pop    %ebp
+  802f0c:	c3                   	ret
+
+00802f0d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802f0d:	55                   	push   %ebp
+  802f0e:	89 e5                	mov    %esp,%ebp
+  802f10:	56                   	push   %esi
+  802f11:	53                   	push   %ebx
+  802f12:	89 c6                	mov    %eax,%esi
+  802f14:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802f16:	83 3d 18 60 80 00 00 	cmpl   $0x0,0x806018
+  802f1d:	74 27                	je     802f46 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802f1f:	6a 07                	push   $0x7
+  802f21:	68 00 80 84 00       	push   $0x848000
+  802f26:	56                   	push   %esi
+  802f27:	ff 35 18 60 80 00    	push   0x806018
+  802f2d:	e8 17 f7 ff ff       	call   802649 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802f32:	83 c4 0c             	add    $0xc,%esp
+  802f35:	6a 00                	push   $0x0
+  802f37:	53                   	push   %ebx
+  802f38:	6a 00                	push   $0x0
+  802f3a:	e8 f2 f6 ff ff       	call   802631 <ipc_recv>
+}
+  802f3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f42:	5b                   	pop    %ebx
+  802f43:	5e                   	pop    %esi
+  802f44:	5d                   	pop    %ebp
+  802f45:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802f46:	83 ec 0c             	sub    $0xc,%esp
+  802f49:	6a 01                	push   $0x1
+  802f4b:	e8 4d f7 ff ff       	call   80269d <ipc_find_env>
+  802f50:	a3 18 60 80 00       	mov    %eax,0x806018
+  802f55:	83 c4 10             	add    $0x10,%esp
+  802f58:	eb c5                	jmp    802f1f <fsipc+0x12>
+
+00802f5a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802f5a:	55                   	push   %ebp
+  802f5b:	89 e5                	mov    %esp,%ebp
+  802f5d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f63:	8b 40 0c             	mov    0xc(%eax),%eax
+  802f66:	a3 00 80 84 00       	mov    %eax,0x848000
+	fsipcbuf.set_size.req_size = newsize;
+  802f6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f6e:	a3 04 80 84 00       	mov    %eax,0x848004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802f73:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f78:	b8 02 00 00 00       	mov    $0x2,%eax
+  802f7d:	e8 8b ff ff ff       	call   802f0d <fsipc>
+}
+  802f82:	c9                   	leave
+  802f83:	c3                   	ret
+
+00802f84 <devfile_flush>:
+{
+  802f84:	55                   	push   %ebp
+  802f85:	89 e5                	mov    %esp,%ebp
+  802f87:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f8d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802f90:	a3 00 80 84 00       	mov    %eax,0x848000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9a:	b8 06 00 00 00       	mov    $0x6,%eax
+  802f9f:	e8 69 ff ff ff       	call   802f0d <fsipc>
+}
+  802fa4:	c9                   	leave
+  802fa5:	c3                   	ret
+
+00802fa6 <devfile_stat>:
+{
+  802fa6:	55                   	push   %ebp
+  802fa7:	89 e5                	mov    %esp,%ebp
+  802fa9:	53                   	push   %ebx
+  802faa:	83 ec 04             	sub    $0x4,%esp
+  802fad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802fb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb3:	8b 40 0c             	mov    0xc(%eax),%eax
+  802fb6:	a3 00 80 84 00       	mov    %eax,0x848000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc0:	b8 05 00 00 00       	mov    $0x5,%eax
+  802fc5:	e8 43 ff ff ff       	call   802f0d <fsipc>
+  802fca:	85 c0                	test   %eax,%eax
+  802fcc:	78 2c                	js     802ffa <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802fce:	83 ec 08             	sub    $0x8,%esp
+  802fd1:	68 00 80 84 00       	push   $0x848000
+  802fd6:	53                   	push   %ebx
+  802fd7:	e8 2c e1 ff ff       	call   801108 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802fdc:	a1 80 80 84 00       	mov    0x848080,%eax
+  802fe1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802fe7:	a1 84 80 84 00       	mov    0x848084,%eax
+  802fec:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802ff2:	83 c4 10             	add    $0x10,%esp
+  802ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ffa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ffd:	c9                   	leave
+  802ffe:	c3                   	ret
+
+00802fff <devfile_write>:
+{
+  802fff:	55                   	push   %ebp
+  803000:	89 e5                	mov    %esp,%ebp
+  803002:	83 ec 0c             	sub    $0xc,%esp
+  803005:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803008:	8b 55 08             	mov    0x8(%ebp),%edx
+  80300b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80300e:	89 15 00 80 84 00    	mov    %edx,0x848000
+	fsipcbuf.write.req_n = n;
+  803014:	a3 04 80 84 00       	mov    %eax,0x848004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803019:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80301e:	39 d0                	cmp    %edx,%eax
+  803020:	0f 47 c2             	cmova  %edx,%eax
+  803023:	50                   	push   %eax
+  803024:	ff 75 0c             	push   0xc(%ebp)
+  803027:	68 08 80 84 00       	push   $0x848008
+  80302c:	e8 5d e2 ff ff       	call   80128e <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  803031:	ba 00 00 00 00       	mov    $0x0,%edx
+  803036:	b8 04 00 00 00       	mov    $0x4,%eax
+  80303b:	e8 cd fe ff ff       	call   802f0d <fsipc>
+}
+  803040:	c9                   	leave
+  803041:	c3                   	ret
+
+00803042 <devfile_read>:
+{
+  803042:	55                   	push   %ebp
+  803043:	89 e5                	mov    %esp,%ebp
+  803045:	56                   	push   %esi
+  803046:	53                   	push   %ebx
+  803047:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80304a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80304d:	8b 40 0c             	mov    0xc(%eax),%eax
+  803050:	a3 00 80 84 00       	mov    %eax,0x848000
+	fsipcbuf.read.req_n = n;
+  803055:	89 35 04 80 84 00    	mov    %esi,0x848004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80305b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803060:	b8 03 00 00 00       	mov    $0x3,%eax
+  803065:	e8 a3 fe ff ff       	call   802f0d <fsipc>
+  80306a:	89 c3                	mov    %eax,%ebx
+  80306c:	85 c0                	test   %eax,%eax
+  80306e:	78 1f                	js     80308f <devfile_read+0x4d>
+	assert(r <= n);
+  803070:	39 c6                	cmp    %eax,%esi
+  803072:	72 24                	jb     803098 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  803074:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803079:	7f 33                	jg     8030ae <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80307b:	83 ec 04             	sub    $0x4,%esp
+  80307e:	50                   	push   %eax
+  80307f:	68 00 80 84 00       	push   $0x848000
+  803084:	ff 75 0c             	push   0xc(%ebp)
+  803087:	e8 02 e2 ff ff       	call   80128e <memmove>
+	return r;
+  80308c:	83 c4 10             	add    $0x10,%esp
+}
+  80308f:	89 d8                	mov    %ebx,%eax
+  803091:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803094:	5b                   	pop    %ebx
+  803095:	5e                   	pop    %esi
+  803096:	5d                   	pop    %ebp
+  803097:	c3                   	ret
+	assert(r <= n);
+  803098:	68 4c 44 80 00       	push   $0x80444c
+  80309d:	68 30 43 80 00       	push   $0x804330
+  8030a2:	6a 76                	push   $0x76
+  8030a4:	68 53 44 80 00       	push   $0x804453
+  8030a9:	e8 37 d9 ff ff       	call   8009e5 <_panic>
+	assert(r <= PGSIZE);
+  8030ae:	68 5e 44 80 00       	push   $0x80445e
+  8030b3:	68 30 43 80 00       	push   $0x804330
+  8030b8:	6a 77                	push   $0x77
+  8030ba:	68 53 44 80 00       	push   $0x804453
+  8030bf:	e8 21 d9 ff ff       	call   8009e5 <_panic>
+
+008030c4 <open>:
+{
+  8030c4:	55                   	push   %ebp
+  8030c5:	89 e5                	mov    %esp,%ebp
+  8030c7:	56                   	push   %esi
+  8030c8:	53                   	push   %ebx
+  8030c9:	83 ec 1c             	sub    $0x1c,%esp
+  8030cc:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8030cf:	56                   	push   %esi
+  8030d0:	e8 f8 df ff ff       	call   8010cd <strlen>
+  8030d5:	83 c4 10             	add    $0x10,%esp
+  8030d8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8030dd:	7f 6c                	jg     80314b <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8030df:	83 ec 0c             	sub    $0xc,%esp
+  8030e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030e5:	50                   	push   %eax
+  8030e6:	e8 3a f8 ff ff       	call   802925 <fd_alloc>
+  8030eb:	89 c3                	mov    %eax,%ebx
+  8030ed:	83 c4 10             	add    $0x10,%esp
+  8030f0:	85 c0                	test   %eax,%eax
+  8030f2:	78 3c                	js     803130 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8030f4:	83 ec 08             	sub    $0x8,%esp
+  8030f7:	56                   	push   %esi
+  8030f8:	68 00 80 84 00       	push   $0x848000
+  8030fd:	e8 06 e0 ff ff       	call   801108 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  803102:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803105:	a3 00 84 84 00       	mov    %eax,0x848400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80310a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80310d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803112:	e8 f6 fd ff ff       	call   802f0d <fsipc>
+  803117:	89 c3                	mov    %eax,%ebx
+  803119:	83 c4 10             	add    $0x10,%esp
+  80311c:	85 c0                	test   %eax,%eax
+  80311e:	78 19                	js     803139 <open+0x75>
+	return fd2num(fd);
+  803120:	83 ec 0c             	sub    $0xc,%esp
+  803123:	ff 75 f4             	push   -0xc(%ebp)
+  803126:	e8 d3 f7 ff ff       	call   8028fe <fd2num>
+  80312b:	89 c3                	mov    %eax,%ebx
+  80312d:	83 c4 10             	add    $0x10,%esp
+}
+  803130:	89 d8                	mov    %ebx,%eax
+  803132:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803135:	5b                   	pop    %ebx
+  803136:	5e                   	pop    %esi
+  803137:	5d                   	pop    %ebp
+  803138:	c3                   	ret
+		fd_close(fd, 0);
+  803139:	83 ec 08             	sub    $0x8,%esp
+  80313c:	6a 00                	push   $0x0
+  80313e:	ff 75 f4             	push   -0xc(%ebp)
+  803141:	e8 f8 f8 ff ff       	call   802a3e <fd_close>
+		return r;
+  803146:	83 c4 10             	add    $0x10,%esp
+  803149:	eb e5                	jmp    803130 <open+0x6c>
+		return -E_BAD_PATH;
+  80314b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  803150:	eb de                	jmp    803130 <open+0x6c>
+
+00803152 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803152:	55                   	push   %ebp
+  803153:	89 e5                	mov    %esp,%ebp
+  803155:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  803158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80315d:	b8 08 00 00 00       	mov    $0x8,%eax
+  803162:	e8 a6 fd ff ff       	call   802f0d <fsipc>
+}
+  803167:	c9                   	leave
+  803168:	c3                   	ret
+
+00803169 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803169:	55                   	push   %ebp
+  80316a:	89 e5                	mov    %esp,%ebp
+  80316c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80316f:	68 6a 44 80 00       	push   $0x80446a
+  803174:	ff 75 0c             	push   0xc(%ebp)
+  803177:	e8 8c df ff ff       	call   801108 <strcpy>
+	return 0;
+}
+  80317c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803181:	c9                   	leave
+  803182:	c3                   	ret
+
+00803183 <devsock_close>:
+{
+  803183:	55                   	push   %ebp
+  803184:	89 e5                	mov    %esp,%ebp
+  803186:	53                   	push   %ebx
+  803187:	83 ec 10             	sub    $0x10,%esp
+  80318a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80318d:	53                   	push   %ebx
+  80318e:	e8 37 0b 00 00       	call   803cca <pageref>
+  803193:	89 c2                	mov    %eax,%edx
+  803195:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803198:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80319d:	83 fa 01             	cmp    $0x1,%edx
+  8031a0:	74 05                	je     8031a7 <devsock_close+0x24>
+}
+  8031a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031a5:	c9                   	leave
+  8031a6:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8031a7:	83 ec 0c             	sub    $0xc,%esp
+  8031aa:	ff 73 0c             	push   0xc(%ebx)
+  8031ad:	e8 b7 02 00 00       	call   803469 <nsipc_close>
+  8031b2:	83 c4 10             	add    $0x10,%esp
+  8031b5:	eb eb                	jmp    8031a2 <devsock_close+0x1f>
+
+008031b7 <devsock_write>:
+{
+  8031b7:	55                   	push   %ebp
+  8031b8:	89 e5                	mov    %esp,%ebp
+  8031ba:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8031bd:	6a 00                	push   $0x0
+  8031bf:	ff 75 10             	push   0x10(%ebp)
+  8031c2:	ff 75 0c             	push   0xc(%ebp)
+  8031c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031c8:	ff 70 0c             	push   0xc(%eax)
+  8031cb:	e8 79 03 00 00       	call   803549 <nsipc_send>
+}
+  8031d0:	c9                   	leave
+  8031d1:	c3                   	ret
+
+008031d2 <devsock_read>:
+{
+  8031d2:	55                   	push   %ebp
+  8031d3:	89 e5                	mov    %esp,%ebp
+  8031d5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8031d8:	6a 00                	push   $0x0
+  8031da:	ff 75 10             	push   0x10(%ebp)
+  8031dd:	ff 75 0c             	push   0xc(%ebp)
+  8031e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031e3:	ff 70 0c             	push   0xc(%eax)
+  8031e6:	e8 ef 02 00 00       	call   8034da <nsipc_recv>
+}
+  8031eb:	c9                   	leave
+  8031ec:	c3                   	ret
+
+008031ed <fd2sockid>:
+{
+  8031ed:	55                   	push   %ebp
+  8031ee:	89 e5                	mov    %esp,%ebp
+  8031f0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8031f3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8031f6:	52                   	push   %edx
+  8031f7:	50                   	push   %eax
+  8031f8:	e8 7e f7 ff ff       	call   80297b <fd_lookup>
+  8031fd:	83 c4 10             	add    $0x10,%esp
+  803200:	85 c0                	test   %eax,%eax
+  803202:	78 10                	js     803214 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803204:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803207:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  80320d:	39 08                	cmp    %ecx,(%eax)
+  80320f:	75 05                	jne    803216 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803211:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803214:	c9                   	leave
+  803215:	c3                   	ret
+		return -E_NOT_SUPP;
+  803216:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80321b:	eb f7                	jmp    803214 <fd2sockid+0x27>
+
+0080321d <alloc_sockfd>:
+{
+  80321d:	55                   	push   %ebp
+  80321e:	89 e5                	mov    %esp,%ebp
+  803220:	56                   	push   %esi
+  803221:	53                   	push   %ebx
+  803222:	83 ec 1c             	sub    $0x1c,%esp
+  803225:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803227:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80322a:	50                   	push   %eax
+  80322b:	e8 f5 f6 ff ff       	call   802925 <fd_alloc>
+  803230:	89 c3                	mov    %eax,%ebx
+  803232:	83 c4 10             	add    $0x10,%esp
+  803235:	85 c0                	test   %eax,%eax
+  803237:	78 43                	js     80327c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803239:	83 ec 04             	sub    $0x4,%esp
+  80323c:	68 07 04 00 00       	push   $0x407
+  803241:	ff 75 f4             	push   -0xc(%ebp)
+  803244:	6a 00                	push   $0x0
+  803246:	e8 b5 e3 ff ff       	call   801600 <sys_page_alloc>
+  80324b:	89 c3                	mov    %eax,%ebx
+  80324d:	83 c4 10             	add    $0x10,%esp
+  803250:	85 c0                	test   %eax,%eax
+  803252:	78 28                	js     80327c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803254:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803257:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80325d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80325f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803262:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803269:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80326c:	83 ec 0c             	sub    $0xc,%esp
+  80326f:	50                   	push   %eax
+  803270:	e8 89 f6 ff ff       	call   8028fe <fd2num>
+  803275:	89 c3                	mov    %eax,%ebx
+  803277:	83 c4 10             	add    $0x10,%esp
+  80327a:	eb 0c                	jmp    803288 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80327c:	83 ec 0c             	sub    $0xc,%esp
+  80327f:	56                   	push   %esi
+  803280:	e8 e4 01 00 00       	call   803469 <nsipc_close>
+		return r;
+  803285:	83 c4 10             	add    $0x10,%esp
+}
+  803288:	89 d8                	mov    %ebx,%eax
+  80328a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80328d:	5b                   	pop    %ebx
+  80328e:	5e                   	pop    %esi
+  80328f:	5d                   	pop    %ebp
+  803290:	c3                   	ret
+
+00803291 <accept>:
+{
+  803291:	55                   	push   %ebp
+  803292:	89 e5                	mov    %esp,%ebp
+  803294:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803297:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329a:	e8 4e ff ff ff       	call   8031ed <fd2sockid>
+  80329f:	85 c0                	test   %eax,%eax
+  8032a1:	78 1b                	js     8032be <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8032a3:	83 ec 04             	sub    $0x4,%esp
+  8032a6:	ff 75 10             	push   0x10(%ebp)
+  8032a9:	ff 75 0c             	push   0xc(%ebp)
+  8032ac:	50                   	push   %eax
+  8032ad:	e8 0e 01 00 00       	call   8033c0 <nsipc_accept>
+  8032b2:	83 c4 10             	add    $0x10,%esp
+  8032b5:	85 c0                	test   %eax,%eax
+  8032b7:	78 05                	js     8032be <accept+0x2d>
+	return alloc_sockfd(r);
+  8032b9:	e8 5f ff ff ff       	call   80321d <alloc_sockfd>
+}
+  8032be:	c9                   	leave
+  8032bf:	c3                   	ret
+
+008032c0 <bind>:
+{
+  8032c0:	55                   	push   %ebp
+  8032c1:	89 e5                	mov    %esp,%ebp
+  8032c3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c9:	e8 1f ff ff ff       	call   8031ed <fd2sockid>
+  8032ce:	85 c0                	test   %eax,%eax
+  8032d0:	78 12                	js     8032e4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8032d2:	83 ec 04             	sub    $0x4,%esp
+  8032d5:	ff 75 10             	push   0x10(%ebp)
+  8032d8:	ff 75 0c             	push   0xc(%ebp)
+  8032db:	50                   	push   %eax
+  8032dc:	e8 31 01 00 00       	call   803412 <nsipc_bind>
+  8032e1:	83 c4 10             	add    $0x10,%esp
+}
+  8032e4:	c9                   	leave
+  8032e5:	c3                   	ret
+
+008032e6 <shutdown>:
+{
+  8032e6:	55                   	push   %ebp
+  8032e7:	89 e5                	mov    %esp,%ebp
+  8032e9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ef:	e8 f9 fe ff ff       	call   8031ed <fd2sockid>
+  8032f4:	85 c0                	test   %eax,%eax
+  8032f6:	78 0f                	js     803307 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8032f8:	83 ec 08             	sub    $0x8,%esp
+  8032fb:	ff 75 0c             	push   0xc(%ebp)
+  8032fe:	50                   	push   %eax
+  8032ff:	e8 43 01 00 00       	call   803447 <nsipc_shutdown>
+  803304:	83 c4 10             	add    $0x10,%esp
+}
+  803307:	c9                   	leave
+  803308:	c3                   	ret
+
+00803309 <connect>:
+{
+  803309:	55                   	push   %ebp
+  80330a:	89 e5                	mov    %esp,%ebp
+  80330c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80330f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803312:	e8 d6 fe ff ff       	call   8031ed <fd2sockid>
+  803317:	85 c0                	test   %eax,%eax
+  803319:	78 12                	js     80332d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80331b:	83 ec 04             	sub    $0x4,%esp
+  80331e:	ff 75 10             	push   0x10(%ebp)
+  803321:	ff 75 0c             	push   0xc(%ebp)
+  803324:	50                   	push   %eax
+  803325:	e8 59 01 00 00       	call   803483 <nsipc_connect>
+  80332a:	83 c4 10             	add    $0x10,%esp
+}
+  80332d:	c9                   	leave
+  80332e:	c3                   	ret
+
+0080332f <listen>:
+{
+  80332f:	55                   	push   %ebp
+  803330:	89 e5                	mov    %esp,%ebp
+  803332:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803335:	8b 45 08             	mov    0x8(%ebp),%eax
+  803338:	e8 b0 fe ff ff       	call   8031ed <fd2sockid>
+  80333d:	85 c0                	test   %eax,%eax
+  80333f:	78 0f                	js     803350 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803341:	83 ec 08             	sub    $0x8,%esp
+  803344:	ff 75 0c             	push   0xc(%ebp)
+  803347:	50                   	push   %eax
+  803348:	e8 6b 01 00 00       	call   8034b8 <nsipc_listen>
+  80334d:	83 c4 10             	add    $0x10,%esp
+}
+  803350:	c9                   	leave
+  803351:	c3                   	ret
+
+00803352 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803352:	55                   	push   %ebp
+  803353:	89 e5                	mov    %esp,%ebp
+  803355:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803358:	ff 75 10             	push   0x10(%ebp)
+  80335b:	ff 75 0c             	push   0xc(%ebp)
+  80335e:	ff 75 08             	push   0x8(%ebp)
+  803361:	e8 41 02 00 00       	call   8035a7 <nsipc_socket>
+  803366:	83 c4 10             	add    $0x10,%esp
+  803369:	85 c0                	test   %eax,%eax
+  80336b:	78 05                	js     803372 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80336d:	e8 ab fe ff ff       	call   80321d <alloc_sockfd>
+}
+  803372:	c9                   	leave
+  803373:	c3                   	ret
+
+00803374 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803374:	55                   	push   %ebp
+  803375:	89 e5                	mov    %esp,%ebp
+  803377:	53                   	push   %ebx
+  803378:	83 ec 04             	sub    $0x4,%esp
+  80337b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80337d:	83 3d 1c 60 80 00 00 	cmpl   $0x0,0x80601c
+  803384:	74 26                	je     8033ac <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803386:	6a 07                	push   $0x7
+  803388:	68 00 90 84 00       	push   $0x849000
+  80338d:	53                   	push   %ebx
+  80338e:	ff 35 1c 60 80 00    	push   0x80601c
+  803394:	e8 b0 f2 ff ff       	call   802649 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803399:	83 c4 0c             	add    $0xc,%esp
+  80339c:	6a 00                	push   $0x0
+  80339e:	6a 00                	push   $0x0
+  8033a0:	6a 00                	push   $0x0
+  8033a2:	e8 8a f2 ff ff       	call   802631 <ipc_recv>
+}
+  8033a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033aa:	c9                   	leave
+  8033ab:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8033ac:	83 ec 0c             	sub    $0xc,%esp
+  8033af:	6a 02                	push   $0x2
+  8033b1:	e8 e7 f2 ff ff       	call   80269d <ipc_find_env>
+  8033b6:	a3 1c 60 80 00       	mov    %eax,0x80601c
+  8033bb:	83 c4 10             	add    $0x10,%esp
+  8033be:	eb c6                	jmp    803386 <nsipc+0x12>
+
+008033c0 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8033c0:	55                   	push   %ebp
+  8033c1:	89 e5                	mov    %esp,%ebp
+  8033c3:	56                   	push   %esi
+  8033c4:	53                   	push   %ebx
+  8033c5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8033c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033cb:	a3 00 90 84 00       	mov    %eax,0x849000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8033d0:	8b 06                	mov    (%esi),%eax
+  8033d2:	a3 04 90 84 00       	mov    %eax,0x849004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8033d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8033dc:	e8 93 ff ff ff       	call   803374 <nsipc>
+  8033e1:	89 c3                	mov    %eax,%ebx
+  8033e3:	85 c0                	test   %eax,%eax
+  8033e5:	79 09                	jns    8033f0 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8033e7:	89 d8                	mov    %ebx,%eax
+  8033e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033ec:	5b                   	pop    %ebx
+  8033ed:	5e                   	pop    %esi
+  8033ee:	5d                   	pop    %ebp
+  8033ef:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8033f0:	83 ec 04             	sub    $0x4,%esp
+  8033f3:	ff 35 10 90 84 00    	push   0x849010
+  8033f9:	68 00 90 84 00       	push   $0x849000
+  8033fe:	ff 75 0c             	push   0xc(%ebp)
+  803401:	e8 88 de ff ff       	call   80128e <memmove>
+		*addrlen = ret->ret_addrlen;
+  803406:	a1 10 90 84 00       	mov    0x849010,%eax
+  80340b:	89 06                	mov    %eax,(%esi)
+  80340d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803410:	eb d5                	jmp    8033e7 <nsipc_accept+0x27>
+
+00803412 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803412:	55                   	push   %ebp
+  803413:	89 e5                	mov    %esp,%ebp
+  803415:	53                   	push   %ebx
+  803416:	83 ec 08             	sub    $0x8,%esp
+  803419:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80341c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80341f:	a3 00 90 84 00       	mov    %eax,0x849000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803424:	53                   	push   %ebx
+  803425:	ff 75 0c             	push   0xc(%ebp)
+  803428:	68 04 90 84 00       	push   $0x849004
+  80342d:	e8 5c de ff ff       	call   80128e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803432:	89 1d 14 90 84 00    	mov    %ebx,0x849014
+	return nsipc(NSREQ_BIND);
+  803438:	b8 02 00 00 00       	mov    $0x2,%eax
+  80343d:	e8 32 ff ff ff       	call   803374 <nsipc>
+}
+  803442:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803445:	c9                   	leave
+  803446:	c3                   	ret
+
+00803447 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80344d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803450:	a3 00 90 84 00       	mov    %eax,0x849000
+	nsipcbuf.shutdown.req_how = how;
+  803455:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803458:	a3 04 90 84 00       	mov    %eax,0x849004
+	return nsipc(NSREQ_SHUTDOWN);
+  80345d:	b8 03 00 00 00       	mov    $0x3,%eax
+  803462:	e8 0d ff ff ff       	call   803374 <nsipc>
+}
+  803467:	c9                   	leave
+  803468:	c3                   	ret
+
+00803469 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803469:	55                   	push   %ebp
+  80346a:	89 e5                	mov    %esp,%ebp
+  80346c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80346f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803472:	a3 00 90 84 00       	mov    %eax,0x849000
+	return nsipc(NSREQ_CLOSE);
+  803477:	b8 04 00 00 00       	mov    $0x4,%eax
+  80347c:	e8 f3 fe ff ff       	call   803374 <nsipc>
+}
+  803481:	c9                   	leave
+  803482:	c3                   	ret
+
+00803483 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803483:	55                   	push   %ebp
+  803484:	89 e5                	mov    %esp,%ebp
+  803486:	53                   	push   %ebx
+  803487:	83 ec 08             	sub    $0x8,%esp
+  80348a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80348d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803490:	a3 00 90 84 00       	mov    %eax,0x849000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803495:	53                   	push   %ebx
+  803496:	ff 75 0c             	push   0xc(%ebp)
+  803499:	68 04 90 84 00       	push   $0x849004
+  80349e:	e8 eb dd ff ff       	call   80128e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8034a3:	89 1d 14 90 84 00    	mov    %ebx,0x849014
+	return nsipc(NSREQ_CONNECT);
+  8034a9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8034ae:	e8 c1 fe ff ff       	call   803374 <nsipc>
+}
+  8034b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034b6:	c9                   	leave
+  8034b7:	c3                   	ret
+
+008034b8 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8034b8:	55                   	push   %ebp
+  8034b9:	89 e5                	mov    %esp,%ebp
+  8034bb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8034be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034c1:	a3 00 90 84 00       	mov    %eax,0x849000
+	nsipcbuf.listen.req_backlog = backlog;
+  8034c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034c9:	a3 04 90 84 00       	mov    %eax,0x849004
+	return nsipc(NSREQ_LISTEN);
+  8034ce:	b8 06 00 00 00       	mov    $0x6,%eax
+  8034d3:	e8 9c fe ff ff       	call   803374 <nsipc>
+}
+  8034d8:	c9                   	leave
+  8034d9:	c3                   	ret
+
+008034da <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8034da:	55                   	push   %ebp
+  8034db:	89 e5                	mov    %esp,%ebp
+  8034dd:	56                   	push   %esi
+  8034de:	53                   	push   %ebx
+  8034df:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8034e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e5:	a3 00 90 84 00       	mov    %eax,0x849000
+	nsipcbuf.recv.req_len = len;
+  8034ea:	89 35 04 90 84 00    	mov    %esi,0x849004
+	nsipcbuf.recv.req_flags = flags;
+  8034f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8034f3:	a3 08 90 84 00       	mov    %eax,0x849008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8034f8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8034fd:	e8 72 fe ff ff       	call   803374 <nsipc>
+  803502:	89 c3                	mov    %eax,%ebx
+  803504:	85 c0                	test   %eax,%eax
+  803506:	78 22                	js     80352a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803508:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80350d:	39 c6                	cmp    %eax,%esi
+  80350f:	0f 4e c6             	cmovle %esi,%eax
+  803512:	39 c3                	cmp    %eax,%ebx
+  803514:	7f 1d                	jg     803533 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803516:	83 ec 04             	sub    $0x4,%esp
+  803519:	53                   	push   %ebx
+  80351a:	68 00 90 84 00       	push   $0x849000
+  80351f:	ff 75 0c             	push   0xc(%ebp)
+  803522:	e8 67 dd ff ff       	call   80128e <memmove>
+  803527:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80352a:	89 d8                	mov    %ebx,%eax
+  80352c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80352f:	5b                   	pop    %ebx
+  803530:	5e                   	pop    %esi
+  803531:	5d                   	pop    %ebp
+  803532:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803533:	68 76 44 80 00       	push   $0x804476
+  803538:	68 30 43 80 00       	push   $0x804330
+  80353d:	6a 62                	push   $0x62
+  80353f:	68 8b 44 80 00       	push   $0x80448b
+  803544:	e8 9c d4 ff ff       	call   8009e5 <_panic>
+
+00803549 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803549:	55                   	push   %ebp
+  80354a:	89 e5                	mov    %esp,%ebp
+  80354c:	53                   	push   %ebx
+  80354d:	83 ec 04             	sub    $0x4,%esp
+  803550:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803553:	8b 45 08             	mov    0x8(%ebp),%eax
+  803556:	a3 00 90 84 00       	mov    %eax,0x849000
+	assert(size < 1600);
+  80355b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803561:	7f 2e                	jg     803591 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803563:	83 ec 04             	sub    $0x4,%esp
+  803566:	53                   	push   %ebx
+  803567:	ff 75 0c             	push   0xc(%ebp)
+  80356a:	68 0c 90 84 00       	push   $0x84900c
+  80356f:	e8 1a dd ff ff       	call   80128e <memmove>
+	nsipcbuf.send.req_size = size;
+  803574:	89 1d 04 90 84 00    	mov    %ebx,0x849004
+	nsipcbuf.send.req_flags = flags;
+  80357a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80357d:	a3 08 90 84 00       	mov    %eax,0x849008
+	return nsipc(NSREQ_SEND);
+  803582:	b8 08 00 00 00       	mov    $0x8,%eax
+  803587:	e8 e8 fd ff ff       	call   803374 <nsipc>
+}
+  80358c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80358f:	c9                   	leave
+  803590:	c3                   	ret
+	assert(size < 1600);
+  803591:	68 97 44 80 00       	push   $0x804497
+  803596:	68 30 43 80 00       	push   $0x804330
+  80359b:	6a 6d                	push   $0x6d
+  80359d:	68 8b 44 80 00       	push   $0x80448b
+  8035a2:	e8 3e d4 ff ff       	call   8009e5 <_panic>
+
+008035a7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8035a7:	55                   	push   %ebp
+  8035a8:	89 e5                	mov    %esp,%ebp
+  8035aa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8035ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b0:	a3 00 90 84 00       	mov    %eax,0x849000
+	nsipcbuf.socket.req_type = type;
+  8035b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035b8:	a3 04 90 84 00       	mov    %eax,0x849004
+	nsipcbuf.socket.req_protocol = protocol;
+  8035bd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035c0:	a3 08 90 84 00       	mov    %eax,0x849008
+	return nsipc(NSREQ_SOCKET);
+  8035c5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8035ca:	e8 a5 fd ff ff       	call   803374 <nsipc>
+}
+  8035cf:	c9                   	leave
+  8035d0:	c3                   	ret
+
+008035d1 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8035d1:	55                   	push   %ebp
+  8035d2:	89 e5                	mov    %esp,%ebp
+  8035d4:	56                   	push   %esi
+  8035d5:	53                   	push   %ebx
+  8035d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8035d9:	83 ec 0c             	sub    $0xc,%esp
+  8035dc:	ff 75 08             	push   0x8(%ebp)
+  8035df:	e8 2a f3 ff ff       	call   80290e <fd2data>
+  8035e4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8035e6:	83 c4 08             	add    $0x8,%esp
+  8035e9:	68 a3 44 80 00       	push   $0x8044a3
+  8035ee:	53                   	push   %ebx
+  8035ef:	e8 14 db ff ff       	call   801108 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8035f4:	8b 46 04             	mov    0x4(%esi),%eax
+  8035f7:	2b 06                	sub    (%esi),%eax
+  8035f9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8035ff:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803606:	00 00 00 
+	stat->st_dev = &devpipe;
+  803609:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  803610:	50 80 00 
+	return 0;
+}
+  803613:	b8 00 00 00 00       	mov    $0x0,%eax
+  803618:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80361b:	5b                   	pop    %ebx
+  80361c:	5e                   	pop    %esi
+  80361d:	5d                   	pop    %ebp
+  80361e:	c3                   	ret
+
+0080361f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80361f:	55                   	push   %ebp
+  803620:	89 e5                	mov    %esp,%ebp
+  803622:	53                   	push   %ebx
+  803623:	83 ec 0c             	sub    $0xc,%esp
+  803626:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803629:	53                   	push   %ebx
+  80362a:	6a 00                	push   $0x0
+  80362c:	e8 aa e0 ff ff       	call   8016db <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803631:	89 1c 24             	mov    %ebx,(%esp)
+  803634:	e8 d5 f2 ff ff       	call   80290e <fd2data>
+  803639:	83 c4 08             	add    $0x8,%esp
+  80363c:	50                   	push   %eax
+  80363d:	6a 00                	push   $0x0
+  80363f:	e8 97 e0 ff ff       	call   8016db <sys_page_unmap>
+}
+  803644:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803647:	c9                   	leave
+  803648:	c3                   	ret
+
+00803649 <_pipeisclosed>:
+{
+  803649:	55                   	push   %ebp
+  80364a:	89 e5                	mov    %esp,%ebp
+  80364c:	57                   	push   %edi
+  80364d:	56                   	push   %esi
+  80364e:	53                   	push   %ebx
+  80364f:	83 ec 1c             	sub    $0x1c,%esp
+  803652:	89 c7                	mov    %eax,%edi
+  803654:	89 d6                	mov    %edx,%esi
+  803656:	eb 3c                	jmp    803694 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  803658:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  80365b:	83 ec 0c             	sub    $0xc,%esp
+  80365e:	57                   	push   %edi
+  80365f:	e8 66 06 00 00       	call   803cca <pageref>
+  803664:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803667:	89 34 24             	mov    %esi,(%esp)
+  80366a:	e8 5b 06 00 00       	call   803cca <pageref>
+  80366f:	89 c2                	mov    %eax,%edx
+  803671:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803673:	05 00 00 00 20       	add    $0x20000000,%eax
+  803678:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80367b:	8b 0d 00 70 84 00    	mov    0x847000,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803681:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803686:	76 31                	jbe    8036b9 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  803688:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80368b:	39 c3                	cmp    %eax,%ebx
+  80368d:	74 76                	je     803705 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80368f:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  803692:	74 36                	je     8036ca <_pipeisclosed+0x81>
+  803694:	89 e0                	mov    %esp,%eax
+  803696:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80369b:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8036a1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8036a6:	77 b0                	ja     803658 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8036a8:	c1 e8 10             	shr    $0x10,%eax
+  8036ab:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8036b1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8036b7:	eb 9f                	jmp    803658 <_pipeisclosed+0xf>
+  8036b9:	c1 e8 10             	shr    $0x10,%eax
+  8036bc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8036c2:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8036c8:	eb be                	jmp    803688 <_pipeisclosed+0x3f>
+  8036ca:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8036cc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8036d1:	8b 15 00 70 84 00    	mov    0x847000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8036d7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8036dc:	76 16                	jbe    8036f4 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8036de:	8b 42 58             	mov    0x58(%edx),%eax
+  8036e1:	6a 01                	push   $0x1
+  8036e3:	50                   	push   %eax
+  8036e4:	53                   	push   %ebx
+  8036e5:	68 aa 44 80 00       	push   $0x8044aa
+  8036ea:	e8 d1 d3 ff ff       	call   800ac0 <cprintf>
+  8036ef:	83 c4 10             	add    $0x10,%esp
+  8036f2:	eb a0                	jmp    803694 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8036f4:	c1 e8 10             	shr    $0x10,%eax
+  8036f7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8036fd:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803703:	eb d9                	jmp    8036de <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  803705:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  803708:	0f 94 c0             	sete   %al
+  80370b:	0f b6 c0             	movzbl %al,%eax
+}
+  80370e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803711:	5b                   	pop    %ebx
+  803712:	5e                   	pop    %esi
+  803713:	5f                   	pop    %edi
+  803714:	5d                   	pop    %ebp
+  803715:	c3                   	ret
+
+00803716 <devpipe_write>:
+{
+  803716:	55                   	push   %ebp
+  803717:	89 e5                	mov    %esp,%ebp
+  803719:	57                   	push   %edi
+  80371a:	56                   	push   %esi
+  80371b:	53                   	push   %ebx
+  80371c:	83 ec 28             	sub    $0x28,%esp
+  80371f:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803722:	56                   	push   %esi
+  803723:	e8 e6 f1 ff ff       	call   80290e <fd2data>
+  803728:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80372a:	83 c4 10             	add    $0x10,%esp
+  80372d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803732:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803735:	75 09                	jne    803740 <devpipe_write+0x2a>
+	return i;
+  803737:	89 f8                	mov    %edi,%eax
+  803739:	eb 23                	jmp    80375e <devpipe_write+0x48>
+			sys_yield();
+  80373b:	e8 7a de ff ff       	call   8015ba <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803740:	8b 43 04             	mov    0x4(%ebx),%eax
+  803743:	8b 0b                	mov    (%ebx),%ecx
+  803745:	8d 51 20             	lea    0x20(%ecx),%edx
+  803748:	39 d0                	cmp    %edx,%eax
+  80374a:	72 1a                	jb     803766 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80374c:	89 da                	mov    %ebx,%edx
+  80374e:	89 f0                	mov    %esi,%eax
+  803750:	e8 f4 fe ff ff       	call   803649 <_pipeisclosed>
+  803755:	85 c0                	test   %eax,%eax
+  803757:	74 e2                	je     80373b <devpipe_write+0x25>
+				return 0;
+  803759:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80375e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803761:	5b                   	pop    %ebx
+  803762:	5e                   	pop    %esi
+  803763:	5f                   	pop    %edi
+  803764:	5d                   	pop    %ebp
+  803765:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803766:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803769:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80376d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803770:	89 c2                	mov    %eax,%edx
+  803772:	c1 fa 1f             	sar    $0x1f,%edx
+  803775:	89 d1                	mov    %edx,%ecx
+  803777:	c1 e9 1b             	shr    $0x1b,%ecx
+  80377a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80377d:	83 e2 1f             	and    $0x1f,%edx
+  803780:	29 ca                	sub    %ecx,%edx
+  803782:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803786:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80378a:	83 c0 01             	add    $0x1,%eax
+  80378d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803790:	83 c7 01             	add    $0x1,%edi
+  803793:	eb 9d                	jmp    803732 <devpipe_write+0x1c>
+
+00803795 <devpipe_read>:
+{
+  803795:	55                   	push   %ebp
+  803796:	89 e5                	mov    %esp,%ebp
+  803798:	57                   	push   %edi
+  803799:	56                   	push   %esi
+  80379a:	53                   	push   %ebx
+  80379b:	83 ec 18             	sub    $0x18,%esp
+  80379e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8037a1:	57                   	push   %edi
+  8037a2:	e8 67 f1 ff ff       	call   80290e <fd2data>
+  8037a7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8037a9:	83 c4 10             	add    $0x10,%esp
+  8037ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8037b1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037b4:	75 13                	jne    8037c9 <devpipe_read+0x34>
+	return i;
+  8037b6:	89 f0                	mov    %esi,%eax
+  8037b8:	eb 02                	jmp    8037bc <devpipe_read+0x27>
+				return i;
+  8037ba:	89 f0                	mov    %esi,%eax
+}
+  8037bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037bf:	5b                   	pop    %ebx
+  8037c0:	5e                   	pop    %esi
+  8037c1:	5f                   	pop    %edi
+  8037c2:	5d                   	pop    %ebp
+  8037c3:	c3                   	ret
+			sys_yield();
+  8037c4:	e8 f1 dd ff ff       	call   8015ba <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8037c9:	8b 03                	mov    (%ebx),%eax
+  8037cb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8037ce:	75 18                	jne    8037e8 <devpipe_read+0x53>
+			if (i > 0)
+  8037d0:	85 f6                	test   %esi,%esi
+  8037d2:	75 e6                	jne    8037ba <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8037d4:	89 da                	mov    %ebx,%edx
+  8037d6:	89 f8                	mov    %edi,%eax
+  8037d8:	e8 6c fe ff ff       	call   803649 <_pipeisclosed>
+  8037dd:	85 c0                	test   %eax,%eax
+  8037df:	74 e3                	je     8037c4 <devpipe_read+0x2f>
+				return 0;
+  8037e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e6:	eb d4                	jmp    8037bc <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8037e8:	99                   	cltd
+  8037e9:	c1 ea 1b             	shr    $0x1b,%edx
+  8037ec:	01 d0                	add    %edx,%eax
+  8037ee:	83 e0 1f             	and    $0x1f,%eax
+  8037f1:	29 d0                	sub    %edx,%eax
+  8037f3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8037f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8037fb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8037fe:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803801:	83 c6 01             	add    $0x1,%esi
+  803804:	eb ab                	jmp    8037b1 <devpipe_read+0x1c>
+
+00803806 <pipe>:
+{
+  803806:	55                   	push   %ebp
+  803807:	89 e5                	mov    %esp,%ebp
+  803809:	56                   	push   %esi
+  80380a:	53                   	push   %ebx
+  80380b:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80380e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803811:	50                   	push   %eax
+  803812:	e8 0e f1 ff ff       	call   802925 <fd_alloc>
+  803817:	89 c3                	mov    %eax,%ebx
+  803819:	83 c4 10             	add    $0x10,%esp
+  80381c:	85 c0                	test   %eax,%eax
+  80381e:	0f 88 23 01 00 00    	js     803947 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803824:	83 ec 04             	sub    $0x4,%esp
+  803827:	68 07 04 00 00       	push   $0x407
+  80382c:	ff 75 f4             	push   -0xc(%ebp)
+  80382f:	6a 00                	push   $0x0
+  803831:	e8 ca dd ff ff       	call   801600 <sys_page_alloc>
+  803836:	89 c3                	mov    %eax,%ebx
+  803838:	83 c4 10             	add    $0x10,%esp
+  80383b:	85 c0                	test   %eax,%eax
+  80383d:	0f 88 04 01 00 00    	js     803947 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803843:	83 ec 0c             	sub    $0xc,%esp
+  803846:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803849:	50                   	push   %eax
+  80384a:	e8 d6 f0 ff ff       	call   802925 <fd_alloc>
+  80384f:	89 c3                	mov    %eax,%ebx
+  803851:	83 c4 10             	add    $0x10,%esp
+  803854:	85 c0                	test   %eax,%eax
+  803856:	0f 88 db 00 00 00    	js     803937 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80385c:	83 ec 04             	sub    $0x4,%esp
+  80385f:	68 07 04 00 00       	push   $0x407
+  803864:	ff 75 f0             	push   -0x10(%ebp)
+  803867:	6a 00                	push   $0x0
+  803869:	e8 92 dd ff ff       	call   801600 <sys_page_alloc>
+  80386e:	89 c3                	mov    %eax,%ebx
+  803870:	83 c4 10             	add    $0x10,%esp
+  803873:	85 c0                	test   %eax,%eax
+  803875:	0f 88 bc 00 00 00    	js     803937 <pipe+0x131>
+	va = fd2data(fd0);
+  80387b:	83 ec 0c             	sub    $0xc,%esp
+  80387e:	ff 75 f4             	push   -0xc(%ebp)
+  803881:	e8 88 f0 ff ff       	call   80290e <fd2data>
+  803886:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803888:	83 c4 0c             	add    $0xc,%esp
+  80388b:	68 07 04 00 00       	push   $0x407
+  803890:	50                   	push   %eax
+  803891:	6a 00                	push   $0x0
+  803893:	e8 68 dd ff ff       	call   801600 <sys_page_alloc>
+  803898:	89 c3                	mov    %eax,%ebx
+  80389a:	83 c4 10             	add    $0x10,%esp
+  80389d:	85 c0                	test   %eax,%eax
+  80389f:	0f 88 82 00 00 00    	js     803927 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038a5:	83 ec 0c             	sub    $0xc,%esp
+  8038a8:	ff 75 f0             	push   -0x10(%ebp)
+  8038ab:	e8 5e f0 ff ff       	call   80290e <fd2data>
+  8038b0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8038b7:	50                   	push   %eax
+  8038b8:	6a 00                	push   $0x0
+  8038ba:	56                   	push   %esi
+  8038bb:	6a 00                	push   $0x0
+  8038bd:	e8 ab dd ff ff       	call   80166d <sys_page_map>
+  8038c2:	89 c3                	mov    %eax,%ebx
+  8038c4:	83 c4 20             	add    $0x20,%esp
+  8038c7:	85 c0                	test   %eax,%eax
+  8038c9:	78 4e                	js     803919 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8038cb:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  8038d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038d3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8038d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038d8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8038df:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8038e2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8038e4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8038e7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8038ee:	83 ec 0c             	sub    $0xc,%esp
+  8038f1:	ff 75 f4             	push   -0xc(%ebp)
+  8038f4:	e8 05 f0 ff ff       	call   8028fe <fd2num>
+  8038f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038fc:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8038fe:	83 c4 04             	add    $0x4,%esp
+  803901:	ff 75 f0             	push   -0x10(%ebp)
+  803904:	e8 f5 ef ff ff       	call   8028fe <fd2num>
+  803909:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80390c:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80390f:	83 c4 10             	add    $0x10,%esp
+  803912:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803917:	eb 2e                	jmp    803947 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803919:	83 ec 08             	sub    $0x8,%esp
+  80391c:	56                   	push   %esi
+  80391d:	6a 00                	push   $0x0
+  80391f:	e8 b7 dd ff ff       	call   8016db <sys_page_unmap>
+  803924:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803927:	83 ec 08             	sub    $0x8,%esp
+  80392a:	ff 75 f0             	push   -0x10(%ebp)
+  80392d:	6a 00                	push   $0x0
+  80392f:	e8 a7 dd ff ff       	call   8016db <sys_page_unmap>
+  803934:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803937:	83 ec 08             	sub    $0x8,%esp
+  80393a:	ff 75 f4             	push   -0xc(%ebp)
+  80393d:	6a 00                	push   $0x0
+  80393f:	e8 97 dd ff ff       	call   8016db <sys_page_unmap>
+  803944:	83 c4 10             	add    $0x10,%esp
+}
+  803947:	89 d8                	mov    %ebx,%eax
+  803949:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80394c:	5b                   	pop    %ebx
+  80394d:	5e                   	pop    %esi
+  80394e:	5d                   	pop    %ebp
+  80394f:	c3                   	ret
+
+00803950 <pipeisclosed>:
+{
+  803950:	55                   	push   %ebp
+  803951:	89 e5                	mov    %esp,%ebp
+  803953:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803956:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803959:	50                   	push   %eax
+  80395a:	ff 75 08             	push   0x8(%ebp)
+  80395d:	e8 19 f0 ff ff       	call   80297b <fd_lookup>
+  803962:	83 c4 10             	add    $0x10,%esp
+  803965:	85 c0                	test   %eax,%eax
+  803967:	78 18                	js     803981 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803969:	83 ec 0c             	sub    $0xc,%esp
+  80396c:	ff 75 f4             	push   -0xc(%ebp)
+  80396f:	e8 9a ef ff ff       	call   80290e <fd2data>
+  803974:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803976:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803979:	e8 cb fc ff ff       	call   803649 <_pipeisclosed>
+  80397e:	83 c4 10             	add    $0x10,%esp
+}
+  803981:	c9                   	leave
+  803982:	c3                   	ret
+
+00803983 <time_nsec>:
+#include <inc/x86.h>
+
+// Nanoseconds since boot.
+uint64_t
+time_nsec(void)
+{
+  803983:	55                   	push   %ebp
+  803984:	89 e5                	mov    %esp,%ebp
+  803986:	57                   	push   %edi
+  803987:	56                   	push   %esi
+  803988:	53                   	push   %ebx
+  803989:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ns_mult, timeinfo.ti_ns_shift);
+  80398c:	a1 10 f0 ff ee       	mov    0xeefff010,%eax
+  803991:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  803994:	8b 3d 0c f0 ff ee    	mov    0xeefff00c,%edi
+  80399a:	89 7d ec             	mov    %edi,-0x14(%ebp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  80399d:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  80399f:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  8039a5:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  8039ab:	29 f0                	sub    %esi,%eax
+  8039ad:	19 fa                	sbb    %edi,%edx
+  8039af:	89 c1                	mov    %eax,%ecx
+  8039b1:	89 d3                	mov    %edx,%ebx
+// libgcc for 64-bit arithmetic.  The low 32 bits of the 96-bit product
+// are dropped before the shift, which costs less than one unit.
+static inline uint64_t
+tsc_scale(uint64_t ticks, uint32_t mult, uint32_t shift)
+{
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  8039b3:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  8039b6:	6b f7 00             	imul   $0x0,%edi,%esi
+  8039b9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8039bc:	89 f8                	mov    %edi,%eax
+  8039be:	f7 e1                	mul    %ecx
+  8039c0:	89 c6                	mov    %eax,%esi
+  8039c2:	89 d7                	mov    %edx,%edi
+  8039c4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8039c7:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  8039c9:	89 d8                	mov    %ebx,%eax
+  8039cb:	f7 65 ec             	mull   -0x14(%ebp)
+
+	if (shift >= 32)
+  8039ce:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  8039d2:	77 34                	ja     803a08 <time_nsec+0x85>
+		return (hi + (lo >> 32)) >> (shift - 32);
+	return (hi << (32 - shift)) + (lo >> shift);
+  8039d4:	b9 20 00 00 00       	mov    $0x20,%ecx
+  8039d9:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  8039dc:	29 d9                	sub    %ebx,%ecx
+  8039de:	0f a5 c2             	shld   %cl,%eax,%edx
+  8039e1:	d3 e0                	shl    %cl,%eax
+  8039e3:	f6 c1 20             	test   $0x20,%cl
+  8039e6:	74 04                	je     8039ec <time_nsec+0x69>
+  8039e8:	89 c2                	mov    %eax,%edx
+  8039ea:	31 c0                	xor    %eax,%eax
+  8039ec:	89 d9                	mov    %ebx,%ecx
+  8039ee:	0f ad fe             	shrd   %cl,%edi,%esi
+  8039f1:	d3 ef                	shr    %cl,%edi
+  8039f3:	f6 c1 20             	test   $0x20,%cl
+  8039f6:	74 04                	je     8039fc <time_nsec+0x79>
+  8039f8:	89 fe                	mov    %edi,%esi
+  8039fa:	31 ff                	xor    %edi,%edi
+  8039fc:	01 f0                	add    %esi,%eax
+  8039fe:	11 fa                	adc    %edi,%edx
+}
+  803a00:	83 c4 14             	add    $0x14,%esp
+  803a03:	5b                   	pop    %ebx
+  803a04:	5e                   	pop    %esi
+  803a05:	5f                   	pop    %edi
+  803a06:	5d                   	pop    %ebp
+  803a07:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  803a08:	89 fe                	mov    %edi,%esi
+  803a0a:	31 ff                	xor    %edi,%edi
+  803a0c:	01 f0                	add    %esi,%eax
+  803a0e:	11 fa                	adc    %edi,%edx
+  803a10:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  803a13:	83 e9 20             	sub    $0x20,%ecx
+  803a16:	0f ad d0             	shrd   %cl,%edx,%eax
+  803a19:	d3 ea                	shr    %cl,%edx
+  803a1b:	f6 c1 20             	test   $0x20,%cl
+  803a1e:	74 04                	je     803a24 <time_nsec+0xa1>
+  803a20:	89 d0                	mov    %edx,%eax
+  803a22:	31 d2                	xor    %edx,%edx
+  803a24:	eb da                	jmp    803a00 <time_nsec+0x7d>
+
+00803a26 <time_msec>:
+
+// Milliseconds since boot; the same clock as sys_time_msec().
+unsigned int
+time_msec(void)
+{
+  803a26:	55                   	push   %ebp
+  803a27:	89 e5                	mov    %esp,%ebp
+  803a29:	57                   	push   %edi
+  803a2a:	56                   	push   %esi
+  803a2b:	53                   	push   %ebx
+  803a2c:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ms_mult, timeinfo.ti_ms_shift);
+  803a2f:	a1 18 f0 ff ee       	mov    0xeefff018,%eax
+  803a34:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  803a37:	8b 3d 14 f0 ff ee    	mov    0xeefff014,%edi
+  803a3d:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803a40:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  803a42:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  803a48:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  803a4e:	29 f0                	sub    %esi,%eax
+  803a50:	19 fa                	sbb    %edi,%edx
+  803a52:	89 c1                	mov    %eax,%ecx
+  803a54:	89 d3                	mov    %edx,%ebx
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  803a56:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  803a59:	6b f7 00             	imul   $0x0,%edi,%esi
+  803a5c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803a5f:	89 f8                	mov    %edi,%eax
+  803a61:	f7 e1                	mul    %ecx
+  803a63:	89 c6                	mov    %eax,%esi
+  803a65:	89 d7                	mov    %edx,%edi
+  803a67:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803a6a:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  803a6c:	89 d8                	mov    %ebx,%eax
+  803a6e:	f7 65 ec             	mull   -0x14(%ebp)
+	if (shift >= 32)
+  803a71:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  803a75:	77 32                	ja     803aa9 <time_msec+0x83>
+	return (hi << (32 - shift)) + (lo >> shift);
+  803a77:	b9 20 00 00 00       	mov    $0x20,%ecx
+  803a7c:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  803a7f:	29 d9                	sub    %ebx,%ecx
+  803a81:	0f a5 c2             	shld   %cl,%eax,%edx
+  803a84:	d3 e0                	shl    %cl,%eax
+  803a86:	f6 c1 20             	test   $0x20,%cl
+  803a89:	74 04                	je     803a8f <time_msec+0x69>
+  803a8b:	89 c2                	mov    %eax,%edx
+  803a8d:	31 c0                	xor    %eax,%eax
+  803a8f:	89 d9                	mov    %ebx,%ecx
+  803a91:	0f ad fe             	shrd   %cl,%edi,%esi
+  803a94:	d3 ef                	shr    %cl,%edi
+  803a96:	f6 c1 20             	test   $0x20,%cl
+  803a99:	74 04                	je     803a9f <time_msec+0x79>
+  803a9b:	89 fe                	mov    %edi,%esi
+  803a9d:	31 ff                	xor    %edi,%edi
+  803a9f:	01 f0                	add    %esi,%eax
+}
+  803aa1:	83 c4 14             	add    $0x14,%esp
+  803aa4:	5b                   	pop    %ebx
+  803aa5:	5e                   	pop    %esi
+  803aa6:	5f                   	pop    %edi
+  803aa7:	5d                   	pop    %ebp
+  803aa8:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  803aa9:	89 fe                	mov    %edi,%esi
+  803aab:	31 ff                	xor    %edi,%edi
+  803aad:	01 f0                	add    %esi,%eax
+  803aaf:	11 fa                	adc    %edi,%edx
+  803ab1:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  803ab4:	83 e9 20             	sub    $0x20,%ecx
+  803ab7:	0f ad d0             	shrd   %cl,%edx,%eax
+  803aba:	d3 ea                	shr    %cl,%edx
+  803abc:	f6 c1 20             	test   $0x20,%cl
+  803abf:	74 04                	je     803ac5 <time_msec+0x9f>
+  803ac1:	89 d0                	mov    %edx,%eax
+  803ac3:	31 d2                	xor    %edx,%edx
+  803ac5:	eb da                	jmp    803aa1 <time_msec+0x7b>
+
+00803ac7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803acc:	c3                   	ret
+
+00803acd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803acd:	55                   	push   %ebp
+  803ace:	89 e5                	mov    %esp,%ebp
+  803ad0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803ad3:	68 c2 44 80 00       	push   $0x8044c2
+  803ad8:	ff 75 0c             	push   0xc(%ebp)
+  803adb:	e8 28 d6 ff ff       	call   801108 <strcpy>
+	return 0;
+}
+  803ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ae5:	c9                   	leave
+  803ae6:	c3                   	ret
+
+00803ae7 <devcons_write>:
+{
+  803ae7:	55                   	push   %ebp
+  803ae8:	89 e5                	mov    %esp,%ebp
+  803aea:	57                   	push   %edi
+  803aeb:	56                   	push   %esi
+  803aec:	53                   	push   %ebx
+  803aed:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803af3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803af8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803afe:	eb 2e                	jmp    803b2e <devcons_write+0x47>
+		m = n - tot;
+  803b00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803b03:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803b05:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803b0a:	39 c3                	cmp    %eax,%ebx
+  803b0c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803b0f:	83 ec 04             	sub    $0x4,%esp
+  803b12:	53                   	push   %ebx
+  803b13:	89 f0                	mov    %esi,%eax
+  803b15:	03 45 0c             	add    0xc(%ebp),%eax
+  803b18:	50                   	push   %eax
+  803b19:	57                   	push   %edi
+  803b1a:	e8 6f d7 ff ff       	call   80128e <memmove>
+		sys_cputs(buf, m);
+  803b1f:	83 c4 08             	add    $0x8,%esp
+  803b22:	53                   	push   %ebx
+  803b23:	57                   	push   %edi
+  803b24:	e8 58 d9 ff ff       	call   801481 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803b29:	01 de                	add    %ebx,%esi
+  803b2b:	83 c4 10             	add    $0x10,%esp
+  803b2e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803b31:	72 cd                	jb     803b00 <devcons_write+0x19>
+}
+  803b33:	89 f0                	mov    %esi,%eax
+  803b35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b38:	5b                   	pop    %ebx
+  803b39:	5e                   	pop    %esi
+  803b3a:	5f                   	pop    %edi
+  803b3b:	5d                   	pop    %ebp
+  803b3c:	c3                   	ret
+
+00803b3d <devcons_read>:
+{
+  803b3d:	55                   	push   %ebp
+  803b3e:	89 e5                	mov    %esp,%ebp
+  803b40:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b48:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b4c:	75 07                	jne    803b55 <devcons_read+0x18>
+  803b4e:	eb 1f                	jmp    803b6f <devcons_read+0x32>
+		sys_yield();
+  803b50:	e8 65 da ff ff       	call   8015ba <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803b55:	e8 6b d9 ff ff       	call   8014c5 <sys_cgetc>
+  803b5a:	85 c0                	test   %eax,%eax
+  803b5c:	74 f2                	je     803b50 <devcons_read+0x13>
+	if (c < 0)
+  803b5e:	78 0f                	js     803b6f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803b60:	83 f8 04             	cmp    $0x4,%eax
+  803b63:	74 0c                	je     803b71 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803b65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b68:	88 02                	mov    %al,(%edx)
+	return 1;
+  803b6a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803b6f:	c9                   	leave
+  803b70:	c3                   	ret
+		return 0;
+  803b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b76:	eb f7                	jmp    803b6f <devcons_read+0x32>
+
+00803b78 <cputchar>:
+{
+  803b78:	55                   	push   %ebp
+  803b79:	89 e5                	mov    %esp,%ebp
+  803b7b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b81:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803b84:	6a 01                	push   $0x1
+  803b86:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b89:	50                   	push   %eax
+  803b8a:	e8 f2 d8 ff ff       	call   801481 <sys_cputs>
+}
+  803b8f:	83 c4 10             	add    $0x10,%esp
+  803b92:	c9                   	leave
+  803b93:	c3                   	ret
+
+00803b94 <getchar>:
+{
+  803b94:	55                   	push   %ebp
+  803b95:	89 e5                	mov    %esp,%ebp
+  803b97:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803b9a:	6a 01                	push   $0x1
+  803b9c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803b9f:	50                   	push   %eax
+  803ba0:	6a 00                	push   $0x0
+  803ba2:	e8 5a f0 ff ff       	call   802c01 <read>
+	if (r < 0)
+  803ba7:	83 c4 10             	add    $0x10,%esp
+  803baa:	85 c0                	test   %eax,%eax
+  803bac:	78 06                	js     803bb4 <getchar+0x20>
+	if (r < 1)
+  803bae:	74 06                	je     803bb6 <getchar+0x22>
+	return c;
+  803bb0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803bb4:	c9                   	leave
+  803bb5:	c3                   	ret
+		return -E_EOF;
+  803bb6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803bbb:	eb f7                	jmp    803bb4 <getchar+0x20>
+
+00803bbd <iscons>:
+{
+  803bbd:	55                   	push   %ebp
+  803bbe:	89 e5                	mov    %esp,%ebp
+  803bc0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803bc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bc6:	50                   	push   %eax
+  803bc7:	ff 75 08             	push   0x8(%ebp)
+  803bca:	e8 ac ed ff ff       	call   80297b <fd_lookup>
+  803bcf:	83 c4 10             	add    $0x10,%esp
+  803bd2:	85 c0                	test   %eax,%eax
+  803bd4:	78 11                	js     803be7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803bd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bd9:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803bdf:	39 10                	cmp    %edx,(%eax)
+  803be1:	0f 94 c0             	sete   %al
+  803be4:	0f b6 c0             	movzbl %al,%eax
+}
+  803be7:	c9                   	leave
+  803be8:	c3                   	ret
+
+00803be9 <opencons>:
+{
+  803be9:	55                   	push   %ebp
+  803bea:	89 e5                	mov    %esp,%ebp
+  803bec:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803bef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bf2:	50                   	push   %eax
+  803bf3:	e8 2d ed ff ff       	call   802925 <fd_alloc>
+  803bf8:	83 c4 10             	add    $0x10,%esp
+  803bfb:	85 c0                	test   %eax,%eax
+  803bfd:	78 3a                	js     803c39 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803bff:	83 ec 04             	sub    $0x4,%esp
+  803c02:	68 07 04 00 00       	push   $0x407
+  803c07:	ff 75 f4             	push   -0xc(%ebp)
+  803c0a:	6a 00                	push   $0x0
+  803c0c:	e8 ef d9 ff ff       	call   801600 <sys_page_alloc>
+  803c11:	83 c4 10             	add    $0x10,%esp
+  803c14:	85 c0                	test   %eax,%eax
+  803c16:	78 21                	js     803c39 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803c18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c1b:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803c21:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803c23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c26:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803c2d:	83 ec 0c             	sub    $0xc,%esp
+  803c30:	50                   	push   %eax
+  803c31:	e8 c8 ec ff ff       	call   8028fe <fd2num>
+  803c36:	83 c4 10             	add    $0x10,%esp
+}
+  803c39:	c9                   	leave
+  803c3a:	c3                   	ret
+
+00803c3b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803c3b:	55                   	push   %ebp
+  803c3c:	89 e5                	mov    %esp,%ebp
+  803c3e:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803c41:	83 3d 00 a0 84 00 00 	cmpl   $0x0,0x84a000
+  803c48:	74 0a                	je     803c54 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803c4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c4d:	a3 00 a0 84 00       	mov    %eax,0x84a000
+}
+  803c52:	c9                   	leave
+  803c53:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803c54:	83 ec 04             	sub    $0x4,%esp
+  803c57:	6a 07                	push   $0x7
+  803c59:	68 00 f0 bf ee       	push   $0xeebff000
+  803c5e:	6a 00                	push   $0x0
+  803c60:	e8 9b d9 ff ff       	call   801600 <sys_page_alloc>
+  803c65:	83 c4 10             	add    $0x10,%esp
+  803c68:	85 c0                	test   %eax,%eax
+  803c6a:	78 14                	js     803c80 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803c6c:	83 ec 08             	sub    $0x8,%esp
+  803c6f:	68 a2 3c 80 00       	push   $0x803ca2
+  803c74:	6a 00                	push   $0x0
+  803c76:	e8 a1 db ff ff       	call   80181c <sys_env_set_pgfault_upcall>
+  803c7b:	83 c4 10             	add    $0x10,%esp
+  803c7e:	eb ca                	jmp    803c4a <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  803c80:	83 ec 08             	sub    $0x8,%esp
+  803c83:	50                   	push   %eax
+  803c84:	68 ce 44 80 00       	push   $0x8044ce
+  803c89:	e8 32 ce ff ff       	call   800ac0 <cprintf>
+			panic("set_pgfault_handler error");
+  803c8e:	83 c4 0c             	add    $0xc,%esp
+  803c91:	68 d9 44 80 00       	push   $0x8044d9
+  803c96:	6a 24                	push   $0x24
+  803c98:	68 f3 44 80 00       	push   $0x8044f3
+  803c9d:	e8 43 cd ff ff       	call   8009e5 <_panic>
+
+00803ca2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803ca2:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803ca3:	a1 00 a0 84 00       	mov    0x84a000,%eax
+	call *%eax
+  803ca8:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803caa:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803cad:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  803cb1:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803cb4:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803cb8:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803cba:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803cbe:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803cbf:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803cc3:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803cc4:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803cc5:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803cc9:	c3                   	ret
+
+00803cca <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803cca:	55                   	push   %ebp
+  803ccb:	89 e5                	mov    %esp,%ebp
+  803ccd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803cd0:	89 c2                	mov    %eax,%edx
+  803cd2:	c1 ea 16             	shr    $0x16,%edx
+  803cd5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803cdc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803ce1:	f6 c1 01             	test   $0x1,%cl
+  803ce4:	74 1a                	je     803d00 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803ce6:	c1 e8 0c             	shr    $0xc,%eax
+  803ce9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803cf0:	a8 01                	test   $0x1,%al
+  803cf2:	74 0c                	je     803d00 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803cf4:	c1 e8 0c             	shr    $0xc,%eax
+  803cf7:	c1 e0 04             	shl    $0x4,%eax
+  803cfa:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803d00:	89 d0                	mov    %edx,%eax
+  803d02:	5d                   	pop    %ebp
+  803d03:	c3                   	ret
@@ -0,0 +1,7636 @@
+
+obj/net/testoutput:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5c 03 00 00       	call   80038d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+static struct jif_pkt *pkt = (struct jif_pkt*)REQVA;
+
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	envid_t ns_envid = sys_getenvid();
+  800038:	e8 a3 0f 00 00       	call   800fe0 <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+	int i, r;
+
+	binaryname = "testoutput";
+  80003f:	c7 05 00 40 80 00 80 	movl   $0x803780,0x804000
+  800046:	37 80 00 
+
+	output_envid = fork();
+  800049:	e8 09 1f 00 00       	call   801f57 <fork>
+  80004e:	a3 00 50 80 00       	mov    %eax,0x805000
+	if (output_envid < 0)
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 80 00 00 00    	js     8000db <umain+0xa8>
+	else if (output_envid == 0) {
+		output(ns_envid);
+		return;
+	}
+
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  80005b:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (output_envid == 0) {
+  800060:	0f 84 89 00 00 00    	je     8000ef <umain+0xbc>
+		if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  800066:	83 ec 04             	sub    $0x4,%esp
+  800069:	6a 07                	push   $0x7
+  80006b:	68 00 b0 fe 0f       	push   $0xffeb000
+  800070:	6a 00                	push   $0x0
+  800072:	e8 f5 0f 00 00       	call   80106c <sys_page_alloc>
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	78 7f                	js     8000fd <umain+0xca>
+			panic("sys_page_alloc: %e", r);
+		pkt->jp_len = snprintf(pkt->jp_data,
+  80007e:	53                   	push   %ebx
+  80007f:	68 bd 37 80 00       	push   $0x8037bd
+  800084:	68 fc 0f 00 00       	push   $0xffc
+  800089:	68 04 b0 fe 0f       	push   $0xffeb004
+  80008e:	e8 8c 0a 00 00       	call   800b1f <snprintf>
+  800093:	a3 00 b0 fe 0f       	mov    %eax,0xffeb000
+				       PGSIZE - sizeof(pkt->jp_len),
+				       "Packet %02d", i);
+		cprintf("Transmitting packet %d\n", i);
+  800098:	83 c4 08             	add    $0x8,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	68 c9 37 80 00       	push   $0x8037c9
+  8000a1:	e8 86 04 00 00       	call   80052c <cprintf>
+		ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8000a6:	6a 07                	push   $0x7
+  8000a8:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000ad:	6a 0b                	push   $0xb
+  8000af:	ff 35 00 50 80 00    	push   0x805000
+  8000b5:	e8 fb 1f 00 00       	call   8020b5 <ipc_send>
+		sys_page_unmap(0, pkt);
+  8000ba:	83 c4 18             	add    $0x18,%esp
+  8000bd:	68 00 b0 fe 0f       	push   $0xffeb000
+  8000c2:	6a 00                	push   $0x0
+  8000c4:	e8 7e 10 00 00       	call   801147 <sys_page_unmap>
+	for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  8000c9:	83 c3 01             	add    $0x1,%ebx
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	83 fb 0a             	cmp    $0xa,%ebx
+  8000d2:	75 92                	jne    800066 <umain+0x33>
+  8000d4:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8000d9:	eb 39                	jmp    800114 <umain+0xe1>
+		panic("error forking");
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	68 8b 37 80 00       	push   $0x80378b
+  8000e3:	6a 16                	push   $0x16
+  8000e5:	68 99 37 80 00       	push   $0x803799
+  8000ea:	e8 62 03 00 00       	call   800451 <_panic>
+		output(ns_envid);
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+  8000f2:	56                   	push   %esi
+  8000f3:	e8 8d 01 00 00       	call   800285 <output>
+		return;
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	eb 1c                	jmp    800119 <umain+0xe6>
+			panic("sys_page_alloc: %e", r);
+  8000fd:	50                   	push   %eax
+  8000fe:	68 aa 37 80 00       	push   $0x8037aa
+  800103:	6a 1e                	push   $0x1e
+  800105:	68 99 37 80 00       	push   $0x803799
+  80010a:	e8 42 03 00 00       	call   800451 <_panic>
+	}
+
+	// Spin for a while, just in case IPC's or packets need to be flushed
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+		sys_yield();
+  80010f:	e8 12 0f 00 00       	call   801026 <sys_yield>
+	for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+  800114:	83 eb 01             	sub    $0x1,%ebx
+  800117:	75 f6                	jne    80010f <umain+0xdc>
+    
+}
+  800119:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011c:	5b                   	pop    %ebx
+  80011d:	5e                   	pop    %esi
+  80011e:	5d                   	pop    %ebp
+  80011f:	c3                   	ret
+
+00800120 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  800120:	55                   	push   %ebp
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	57                   	push   %edi
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  800126:	83 ec 1c             	sub    $0x1c,%esp
+  800129:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t stop = time_msec() + initial_to;
+  80012c:	e8 61 33 00 00       	call   803492 <time_msec>
+  800131:	03 45 0c             	add    0xc(%ebp),%eax
+  800134:	89 c3                	mov    %eax,%ebx
+
+	binaryname = "ns_timer";
+  800136:	c7 05 00 40 80 00 e1 	movl   $0x8037e1,0x804000
+  80013d:	37 80 00 
+
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+
+		while (1) {
+			uint32_t to, whom;
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800140:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  800143:	eb 07                	jmp    80014c <timer+0x2c>
+			if (whom != ns_envid) {
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+				continue;
+			}
+
+			stop = time_msec() + to;
+  800145:	e8 48 33 00 00       	call   803492 <time_msec>
+  80014a:	01 c3                	add    %eax,%ebx
+		sys_sleep_until(stop);
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	53                   	push   %ebx
+  800150:	e8 b8 13 00 00       	call   80150d <sys_sleep_until>
+		ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  800155:	6a 00                	push   $0x0
+  800157:	6a 00                	push   $0x0
+  800159:	6a 0c                	push   $0xc
+  80015b:	56                   	push   %esi
+  80015c:	e8 54 1f 00 00       	call   8020b5 <ipc_send>
+  800161:	83 c4 20             	add    $0x20,%esp
+			to = ipc_recv((int32_t *) &whom, 0, 0);
+  800164:	83 ec 04             	sub    $0x4,%esp
+  800167:	6a 00                	push   $0x0
+  800169:	6a 00                	push   $0x0
+  80016b:	57                   	push   %edi
+  80016c:	e8 2c 1f 00 00       	call   80209d <ipc_recv>
+  800171:	89 c3                	mov    %eax,%ebx
+			if (whom != ns_envid) {
+  800173:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800176:	83 c4 10             	add    $0x10,%esp
+  800179:	39 f0                	cmp    %esi,%eax
+  80017b:	74 c8                	je     800145 <timer+0x25>
+				cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  80017d:	83 ec 08             	sub    $0x8,%esp
+  800180:	50                   	push   %eax
+  800181:	68 ec 37 80 00       	push   $0x8037ec
+  800186:	e8 a1 03 00 00       	call   80052c <cprintf>
+				continue;
+  80018b:	83 c4 10             	add    $0x10,%esp
+  80018e:	eb d4                	jmp    800164 <timer+0x44>
+
+00800190 <input>:
+
+union Nsipc nsipcbufs[NUM_INPUT_PAGES] __attribute__((aligned(PGSIZE)));
+
+void
+input(envid_t ns_envid)
+{
+  800190:	55                   	push   %ebp
+  800191:	89 e5                	mov    %esp,%ebp
+  800193:	57                   	push   %edi
+  800194:	56                   	push   %esi
+  800195:	53                   	push   %ebx
+  800196:	83 ec 0c             	sub    $0xc,%esp
+  800199:	8b 75 08             	mov    0x8(%ebp),%esi
+	binaryname = "ns_input";
+  80019c:	c7 05 00 40 80 00 27 	movl   $0x803827,0x804000
+  8001a3:	38 80 00 
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8001a6:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8001a8:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8001ad:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8001b3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8001b8:	76 1b                	jbe    8001d5 <input+0x45>
+    int r;
+    envid_t whom;
+    int idx = 0;
+    
+    cprintf("ns_input env type = %d\n", thisenv->env_type);
+  8001ba:	8b 42 50             	mov    0x50(%edx),%eax
+  8001bd:	83 ec 08             	sub    $0x8,%esp
+  8001c0:	50                   	push   %eax
+  8001c1:	68 30 38 80 00       	push   $0x803830
+  8001c6:	e8 61 03 00 00       	call   80052c <cprintf>
+  8001cb:	83 c4 10             	add    $0x10,%esp
+    int idx = 0;
+  8001ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d3:	eb 61                	jmp    800236 <input+0xa6>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8001d5:	c1 e8 10             	shr    $0x10,%eax
+  8001d8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001de:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8001e4:	eb d4                	jmp    8001ba <input+0x2a>
+        
+        nsipcbufs[idx].pkt.jp_data[0] = 0;
+        
+        // Receive packet from device
+        if ((r = sys_e1000_receive(nsipcbufs[idx].pkt.jp_data, PGSIZE - sizeof (size_t))) < 0) {
+            panic("error on receive");
+  8001e6:	83 ec 04             	sub    $0x4,%esp
+  8001e9:	68 48 38 80 00       	push   $0x803848
+  8001ee:	6a 1f                	push   $0x1f
+  8001f0:	68 59 38 80 00       	push   $0x803859
+  8001f5:	e8 57 02 00 00       	call   800451 <_panic>
+        }
+        r = thisenv->env_e1000_size;
+  8001fa:	8b 92 a8 00 00 00    	mov    0xa8(%edx),%edx
+        
+         // Set the length
+        nsipcbufs[idx].pkt.jp_len = r;
+  800200:	89 d8                	mov    %ebx,%eax
+  800202:	c1 e0 0c             	shl    $0xc,%eax
+  800205:	89 90 00 60 80 00    	mov    %edx,0x806000(%eax)
+        
+        // Set input to network server
+        ipc_send(ns_envid, NSREQ_INPUT, &nsipcbufs[idx], PTE_U | PTE_W | PTE_P);
+  80020b:	6a 07                	push   $0x7
+  80020d:	81 c7 00 60 80 00    	add    $0x806000,%edi
+  800213:	57                   	push   %edi
+  800214:	6a 0a                	push   $0xa
+  800216:	56                   	push   %esi
+  800217:	e8 99 1e 00 00       	call   8020b5 <ipc_send>
+        
+        idx = (idx + 1) % NUM_INPUT_PAGES;
+  80021c:	83 c3 01             	add    $0x1,%ebx
+  80021f:	89 d8                	mov    %ebx,%eax
+  800221:	c1 f8 1f             	sar    $0x1f,%eax
+  800224:	c1 e8 1a             	shr    $0x1a,%eax
+  800227:	01 c3                	add    %eax,%ebx
+  800229:	83 e3 3f             	and    $0x3f,%ebx
+  80022c:	29 c3                	sub    %eax,%ebx
+        
+        sys_yield();
+  80022e:	e8 f3 0d 00 00       	call   801026 <sys_yield>
+        nsipcbufs[idx].pkt.jp_data[0] = 0;
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	89 df                	mov    %ebx,%edi
+  800238:	c1 e7 0c             	shl    $0xc,%edi
+  80023b:	c6 87 04 60 80 00 00 	movb   $0x0,0x806004(%edi)
+        if ((r = sys_e1000_receive(nsipcbufs[idx].pkt.jp_data, PGSIZE - sizeof (size_t))) < 0) {
+  800242:	83 ec 08             	sub    $0x8,%esp
+  800245:	68 fc 0f 00 00       	push   $0xffc
+  80024a:	8d 87 04 60 80 00    	lea    0x806004(%edi),%eax
+  800250:	50                   	push   %eax
+  800251:	e8 66 17 00 00       	call   8019bc <sys_e1000_receive>
+  800256:	83 c4 10             	add    $0x10,%esp
+  800259:	85 c0                	test   %eax,%eax
+  80025b:	78 89                	js     8001e6 <input+0x56>
+  80025d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80025f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  800264:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80026a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80026f:	77 89                	ja     8001fa <input+0x6a>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800271:	c1 e8 10             	shr    $0x10,%eax
+  800274:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80027a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800280:	e9 75 ff ff ff       	jmp    8001fa <input+0x6a>
+
+00800285 <output>:
+
+extern union Nsipc nsipcbuf;
+
+void
+output(envid_t ns_envid)
+{
+  800285:	55                   	push   %ebp
+  800286:	89 e5                	mov    %esp,%ebp
+  800288:	56                   	push   %esi
+  800289:	53                   	push   %ebx
+  80028a:	83 ec 10             	sub    $0x10,%esp
+  80028d:	8b 75 08             	mov    0x8(%ebp),%esi
+    envid_t envid;
+    int value;
+    int r;
+    
+    
+	binaryname = "ns_output";
+  800290:	c7 05 00 40 80 00 65 	movl   $0x803865,0x804000
+  800297:	38 80 00 
+  80029a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80029c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8002a1:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8002a7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8002ac:	0f 86 8b 00 00 00    	jbe    80033d <output+0xb8>
+    
+    cprintf("%s -> %x\n", binaryname, thisenv->env_id);
+  8002b2:	8b 42 48             	mov    0x48(%edx),%eax
+  8002b5:	83 ec 04             	sub    $0x4,%esp
+  8002b8:	50                   	push   %eax
+  8002b9:	68 65 38 80 00       	push   $0x803865
+  8002be:	68 6f 38 80 00       	push   $0x80386f
+  8002c3:	e8 64 02 00 00       	call   80052c <cprintf>
+  8002c8:	89 e0                	mov    %esp,%eax
+  8002ca:	05 00 00 00 20       	add    $0x20000000,%eax
+  8002cf:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8002d2:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8002d8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8002dd:	76 72                	jbe    800351 <output+0xcc>
+    
+    cprintf("ns_output env type = %d\n", thisenv->env_type);
+  8002df:	8b 42 50             	mov    0x50(%edx),%eax
+  8002e2:	83 ec 08             	sub    $0x8,%esp
+  8002e5:	50                   	push   %eax
+  8002e6:	68 79 38 80 00       	push   $0x803879
+  8002eb:	e8 3c 02 00 00       	call   80052c <cprintf>
+  8002f0:	83 c4 10             	add    $0x10,%esp
+	// LAB 6: Your code here:
+	// 	- read a packet from the network server
+	//	- send the packet to the device driver
+    while (true) {
+        // Wait for IPC input.
+        if ((value = ipc_recv(&envid, &nsipcbuf, NULL)) < 0)
+  8002f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8002f6:	83 ec 04             	sub    $0x4,%esp
+  8002f9:	6a 00                	push   $0x0
+  8002fb:	68 00 80 84 00       	push   $0x848000
+  800300:	53                   	push   %ebx
+  800301:	e8 97 1d 00 00       	call   80209d <ipc_recv>
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	85 c0                	test   %eax,%eax
+  80030b:	78 58                	js     800365 <output+0xe0>
+        
+        // If we received something not from the ns, ignore it.
+        if (envid != ns_envid)
+            continue;
+        
+        if (value != NSREQ_OUTPUT)
+  80030d:	39 75 f4             	cmp    %esi,-0xc(%ebp)
+  800310:	75 e4                	jne    8002f6 <output+0x71>
+  800312:	83 f8 0b             	cmp    $0xb,%eax
+  800315:	75 df                	jne    8002f6 <output+0x71>
+            continue;
+        
+        // beam me up, Scotty
+        while ((r = sys_e1000_transmit(nsipcbuf.pkt.jp_data, nsipcbuf.pkt.jp_len)) < 0) {
+  800317:	83 ec 08             	sub    $0x8,%esp
+  80031a:	ff 35 00 80 84 00    	push   0x848000
+  800320:	68 04 80 84 00       	push   $0x848004
+  800325:	e8 27 16 00 00       	call   801951 <sys_e1000_transmit>
+  80032a:	83 c4 10             	add    $0x10,%esp
+  80032d:	85 c0                	test   %eax,%eax
+  80032f:	79 c5                	jns    8002f6 <output+0x71>
+            if (r != -E_RING_FULL)
+  800331:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  800334:	75 43                	jne    800379 <output+0xf4>
+                panic("net/output: transmit error");
+            
+            sys_yield();
+  800336:	e8 eb 0c 00 00       	call   801026 <sys_yield>
+  80033b:	eb da                	jmp    800317 <output+0x92>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80033d:	c1 e8 10             	shr    $0x10,%eax
+  800340:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800346:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80034c:	e9 61 ff ff ff       	jmp    8002b2 <output+0x2d>
+  800351:	c1 e8 10             	shr    $0x10,%eax
+  800354:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80035a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800360:	e9 7a ff ff ff       	jmp    8002df <output+0x5a>
+            panic("net/output: cannot recv");
+  800365:	83 ec 04             	sub    $0x4,%esp
+  800368:	68 92 38 80 00       	push   $0x803892
+  80036d:	6a 1b                	push   $0x1b
+  80036f:	68 aa 38 80 00       	push   $0x8038aa
+  800374:	e8 d8 00 00 00       	call   800451 <_panic>
+                panic("net/output: transmit error");
+  800379:	83 ec 04             	sub    $0x4,%esp
+  80037c:	68 b7 38 80 00       	push   $0x8038b7
+  800381:	6a 27                	push   $0x27
+  800383:	68 aa 38 80 00       	push   $0x8038aa
+  800388:	e8 c4 00 00 00       	call   800451 <_panic>
+
+0080038d <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80038d:	55                   	push   %ebp
+  80038e:	89 e5                	mov    %esp,%ebp
+  800390:	57                   	push   %edi
+  800391:	56                   	push   %esi
+  800392:	53                   	push   %ebx
+  800393:	83 ec 0c             	sub    $0xc,%esp
+  800396:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800399:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80039c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a1:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8003a3:	c1 ea 0b             	shr    $0xb,%edx
+  8003a6:	83 f2 01             	xor    $0x1,%edx
+  8003a9:	83 e2 01             	and    $0x1,%edx
+  8003ac:	88 15 04 60 84 00    	mov    %dl,0x846004
+
+	mainenv = NULL;
+  8003b2:	c7 05 00 60 84 00 00 	movl   $0x0,0x846000
+  8003b9:	00 00 00 
+	envid = sys_getenvid();
+  8003bc:	e8 1f 0c 00 00       	call   800fe0 <sys_getenvid>
+  8003c1:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8003c3:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8003c8:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8003ce:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8003d4:	8b 52 48             	mov    0x48(%edx),%edx
+  8003d7:	39 ca                	cmp    %ecx,%edx
+  8003d9:	74 27                	je     800402 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8003db:	83 c0 01             	add    $0x1,%eax
+  8003de:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8003e3:	75 e3                	jne    8003c8 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8003e5:	83 3d 00 60 84 00 00 	cmpl   $0x0,0x846000
+  8003ec:	75 24                	jne    800412 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8003ee:	83 ec 04             	sub    $0x4,%esp
+  8003f1:	68 d4 38 80 00       	push   $0x8038d4
+  8003f6:	6a 23                	push   $0x23
+  8003f8:	68 f7 38 80 00       	push   $0x8038f7
+  8003fd:	e8 4f 00 00 00       	call   800451 <_panic>
+			mainenv = &envs[i];
+  800402:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800408:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80040d:	a3 00 60 84 00       	mov    %eax,0x846000
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800412:	85 ff                	test   %edi,%edi
+  800414:	7e 07                	jle    80041d <libmain+0x90>
+		binaryname = argv[0];
+  800416:	8b 06                	mov    (%esi),%eax
+  800418:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80041d:	83 ec 08             	sub    $0x8,%esp
+  800420:	56                   	push   %esi
+  800421:	57                   	push   %edi
+  800422:	e8 0c fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800427:	e8 0b 00 00 00       	call   800437 <exit>
+}
+  80042c:	83 c4 10             	add    $0x10,%esp
+  80042f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800432:	5b                   	pop    %ebx
+  800433:	5e                   	pop    %esi
+  800434:	5f                   	pop    %edi
+  800435:	5d                   	pop    %ebp
+  800436:	c3                   	ret
+
+00800437 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80043d:	e8 1c 21 00 00       	call   80255e <close_all>
+	sys_env_destroy(0);
+  800442:	83 ec 0c             	sub    $0xc,%esp
+  800445:	6a 00                	push   $0x0
+  800447:	e8 2b 0b 00 00       	call   800f77 <sys_env_destroy>
+}
+  80044c:	83 c4 10             	add    $0x10,%esp
+  80044f:	c9                   	leave
+  800450:	c3                   	ret
+
+00800451 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800451:	55                   	push   %ebp
+  800452:	89 e5                	mov    %esp,%ebp
+  800454:	56                   	push   %esi
+  800455:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800456:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800459:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80045f:	e8 7c 0b 00 00       	call   800fe0 <sys_getenvid>
+  800464:	83 ec 0c             	sub    $0xc,%esp
+  800467:	ff 75 0c             	push   0xc(%ebp)
+  80046a:	ff 75 08             	push   0x8(%ebp)
+  80046d:	56                   	push   %esi
+  80046e:	50                   	push   %eax
+  80046f:	68 10 39 80 00       	push   $0x803910
+  800474:	e8 b3 00 00 00       	call   80052c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800479:	83 c4 18             	add    $0x18,%esp
+  80047c:	53                   	push   %ebx
+  80047d:	ff 75 10             	push   0x10(%ebp)
+  800480:	e8 56 00 00 00       	call   8004db <vcprintf>
+	cprintf("\n");
+  800485:	c7 04 24 46 38 80 00 	movl   $0x803846,(%esp)
+  80048c:	e8 9b 00 00 00       	call   80052c <cprintf>
+  800491:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800494:	cc                   	int3
+	while (1)
+  800495:	eb fd                	jmp    800494 <_panic+0x43>
+
+00800497 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800497:	55                   	push   %ebp
+  800498:	89 e5                	mov    %esp,%ebp
+  80049a:	53                   	push   %ebx
+  80049b:	83 ec 04             	sub    $0x4,%esp
+  80049e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8004a1:	8b 13                	mov    (%ebx),%edx
+  8004a3:	8d 42 01             	lea    0x1(%edx),%eax
+  8004a6:	89 03                	mov    %eax,(%ebx)
+  8004a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004ab:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8004af:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004b4:	74 09                	je     8004bf <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8004b6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8004ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004bd:	c9                   	leave
+  8004be:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8004bf:	83 ec 08             	sub    $0x8,%esp
+  8004c2:	68 ff 00 00 00       	push   $0xff
+  8004c7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004ca:	50                   	push   %eax
+  8004cb:	e8 1d 0a 00 00       	call   800eed <sys_cputs>
+		b->idx = 0;
+  8004d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004d6:	83 c4 10             	add    $0x10,%esp
+  8004d9:	eb db                	jmp    8004b6 <putch+0x1f>
+
+008004db <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004db:	55                   	push   %ebp
+  8004dc:	89 e5                	mov    %esp,%ebp
+  8004de:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004e4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004eb:	00 00 00 
+	b.cnt = 0;
+  8004ee:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004f5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004f8:	ff 75 0c             	push   0xc(%ebp)
+  8004fb:	ff 75 08             	push   0x8(%ebp)
+  8004fe:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800504:	50                   	push   %eax
+  800505:	68 97 04 80 00       	push   $0x800497
+  80050a:	e8 fb 00 00 00       	call   80060a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80050f:	83 c4 08             	add    $0x8,%esp
+  800512:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800518:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80051e:	50                   	push   %eax
+  80051f:	e8 c9 09 00 00       	call   800eed <sys_cputs>
+
+	return b.cnt;
+}
+  800524:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80052a:	c9                   	leave
+  80052b:	c3                   	ret
+
+0080052c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80052c:	55                   	push   %ebp
+  80052d:	89 e5                	mov    %esp,%ebp
+  80052f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800532:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800535:	50                   	push   %eax
+  800536:	ff 75 08             	push   0x8(%ebp)
+  800539:	e8 9d ff ff ff       	call   8004db <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80053e:	c9                   	leave
+  80053f:	c3                   	ret
+
+00800540 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800540:	55                   	push   %ebp
+  800541:	89 e5                	mov    %esp,%ebp
+  800543:	57                   	push   %edi
+  800544:	56                   	push   %esi
+  800545:	53                   	push   %ebx
+  800546:	83 ec 1c             	sub    $0x1c,%esp
+  800549:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80054c:	89 d6                	mov    %edx,%esi
+  80054e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800551:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800554:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800557:	73 0b                	jae    800564 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800559:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80055c:	c1 e7 08             	shl    $0x8,%edi
+  80055f:	0b 7d 10             	or     0x10(%ebp),%edi
+  800562:	eb 36                	jmp    80059a <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800564:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800567:	ba 00 00 00 00       	mov    $0x0,%edx
+  80056c:	f7 75 08             	divl   0x8(%ebp)
+  80056f:	89 c1                	mov    %eax,%ecx
+  800571:	ff 75 14             	push   0x14(%ebp)
+  800574:	ff 75 10             	push   0x10(%ebp)
+  800577:	83 eb 01             	sub    $0x1,%ebx
+  80057a:	53                   	push   %ebx
+  80057b:	ff 75 08             	push   0x8(%ebp)
+  80057e:	89 f2                	mov    %esi,%edx
+  800580:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800583:	e8 b8 ff ff ff       	call   800540 <printnum>
+  800588:	83 c4 10             	add    $0x10,%esp
+  80058b:	eb 14                	jmp    8005a1 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80058d:	83 ec 08             	sub    $0x8,%esp
+  800590:	56                   	push   %esi
+  800591:	57                   	push   %edi
+  800592:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800595:	ff d0                	call   *%eax
+  800597:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80059a:	83 eb 01             	sub    $0x1,%ebx
+  80059d:	85 db                	test   %ebx,%ebx
+  80059f:	7f ec                	jg     80058d <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8005a1:	83 ec 08             	sub    $0x8,%esp
+  8005a4:	56                   	push   %esi
+  8005a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ad:	f7 75 08             	divl   0x8(%ebp)
+  8005b0:	0f be 92 33 39 80 00 	movsbl 0x803933(%edx),%edx
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	c1 e0 08             	shl    $0x8,%eax
+  8005bd:	09 d0                	or     %edx,%eax
+  8005bf:	50                   	push   %eax
+  8005c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005c3:	ff d0                	call   *%eax
+}
+  8005c5:	83 c4 10             	add    $0x10,%esp
+  8005c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005cb:	5b                   	pop    %ebx
+  8005cc:	5e                   	pop    %esi
+  8005cd:	5f                   	pop    %edi
+  8005ce:	5d                   	pop    %ebp
+  8005cf:	c3                   	ret
+
+008005d0 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005d0:	55                   	push   %ebp
+  8005d1:	89 e5                	mov    %esp,%ebp
+  8005d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005d6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005da:	8b 10                	mov    (%eax),%edx
+  8005dc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005df:	73 0a                	jae    8005eb <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005e1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005e4:	89 08                	mov    %ecx,(%eax)
+  8005e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005e9:	88 02                	mov    %al,(%edx)
+}
+  8005eb:	5d                   	pop    %ebp
+  8005ec:	c3                   	ret
+
+008005ed <printfmt>:
+{
+  8005ed:	55                   	push   %ebp
+  8005ee:	89 e5                	mov    %esp,%ebp
+  8005f0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005f3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005f6:	50                   	push   %eax
+  8005f7:	ff 75 10             	push   0x10(%ebp)
+  8005fa:	ff 75 0c             	push   0xc(%ebp)
+  8005fd:	ff 75 08             	push   0x8(%ebp)
+  800600:	e8 05 00 00 00       	call   80060a <vprintfmt>
+}
+  800605:	83 c4 10             	add    $0x10,%esp
+  800608:	c9                   	leave
+  800609:	c3                   	ret
+
+0080060a <vprintfmt>:
+{
+  80060a:	55                   	push   %ebp
+  80060b:	89 e5                	mov    %esp,%ebp
+  80060d:	57                   	push   %edi
+  80060e:	56                   	push   %esi
+  80060f:	53                   	push   %ebx
+  800610:	83 ec 3c             	sub    $0x3c,%esp
+  800613:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800616:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800619:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800620:	eb 16                	jmp    800638 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800622:	83 ec 08             	sub    $0x8,%esp
+  800625:	ff 75 0c             	push   0xc(%ebp)
+  800628:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80062b:	c1 e2 08             	shl    $0x8,%edx
+  80062e:	09 d0                	or     %edx,%eax
+  800630:	50                   	push   %eax
+  800631:	ff d7                	call   *%edi
+  800633:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800636:	89 de                	mov    %ebx,%esi
+  800638:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80063b:	0f b6 06             	movzbl (%esi),%eax
+  80063e:	83 f8 25             	cmp    $0x25,%eax
+  800641:	74 0c                	je     80064f <vprintfmt+0x45>
+			if (ch == '\0')
+  800643:	85 c0                	test   %eax,%eax
+  800645:	75 db                	jne    800622 <vprintfmt+0x18>
+}
+  800647:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80064a:	5b                   	pop    %ebx
+  80064b:	5e                   	pop    %esi
+  80064c:	5f                   	pop    %edi
+  80064d:	5d                   	pop    %ebp
+  80064e:	c3                   	ret
+		padc = ' ';
+  80064f:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800653:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80065a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800661:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800668:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80066d:	8d 73 01             	lea    0x1(%ebx),%esi
+  800670:	0f b6 13             	movzbl (%ebx),%edx
+  800673:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800676:	3c 55                	cmp    $0x55,%al
+  800678:	0f 87 2c 04 00 00    	ja     800aaa <vprintfmt+0x4a0>
+  80067e:	0f b6 c0             	movzbl %al,%eax
+  800681:	ff 24 85 80 3a 80 00 	jmp    *0x803a80(,%eax,4)
+  800688:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80068a:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80068e:	eb dd                	jmp    80066d <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800690:	89 f3                	mov    %esi,%ebx
+  800692:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800696:	eb d5                	jmp    80066d <vprintfmt+0x63>
+  800698:	0f b6 d2             	movzbl %dl,%edx
+  80069b:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80069d:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8006a2:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8006a5:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8006a9:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8006ac:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8006af:	83 fe 09             	cmp    $0x9,%esi
+  8006b2:	0f 87 8a 00 00 00    	ja     800742 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8006b8:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8006bb:	eb e5                	jmp    8006a2 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8b 00                	mov    (%eax),%eax
+  8006c2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cb:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ce:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8006d0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006d4:	79 97                	jns    80066d <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8006d6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006dc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006e3:	eb 88                	jmp    80066d <vprintfmt+0x63>
+			if (width < 0)
+  8006e5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8006e8:	85 db                	test   %ebx,%ebx
+  8006ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ef:	0f 49 c3             	cmovns %ebx,%eax
+  8006f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f5:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8006f7:	e9 71 ff ff ff       	jmp    80066d <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006fc:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8006fe:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800705:	e9 63 ff ff ff       	jmp    80066d <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80070a:	8d 73 02             	lea    0x2(%ebx),%esi
+  80070d:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800711:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800718:	3c 67                	cmp    $0x67,%al
+  80071a:	0f 84 18 ff ff ff    	je     800638 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800720:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800727:	3c 72                	cmp    $0x72,%al
+  800729:	0f 84 09 ff ff ff    	je     800638 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80072f:	3c 62                	cmp    $0x62,%al
+  800731:	0f 94 c0             	sete   %al
+  800734:	0f b6 c0             	movzbl %al,%eax
+  800737:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80073a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80073d:	e9 f6 fe ff ff       	jmp    800638 <vprintfmt+0x2e>
+  800742:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800745:	eb 89                	jmp    8006d0 <vprintfmt+0xc6>
+			lflag++;
+  800747:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80074a:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80074c:	e9 1c ff ff ff       	jmp    80066d <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8d 58 04             	lea    0x4(%eax),%ebx
+  800757:	83 ec 08             	sub    $0x8,%esp
+  80075a:	ff 75 0c             	push   0xc(%ebp)
+  80075d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800760:	c1 e0 08             	shl    $0x8,%eax
+  800763:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800766:	0b 01                	or     (%ecx),%eax
+  800768:	50                   	push   %eax
+  800769:	ff d7                	call   *%edi
+			break;
+  80076b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80076e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800771:	e9 c2 fe ff ff       	jmp    800638 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800776:	8b 45 14             	mov    0x14(%ebp),%eax
+  800779:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80077c:	8b 10                	mov    (%eax),%edx
+  80077e:	89 d0                	mov    %edx,%eax
+  800780:	f7 d8                	neg    %eax
+  800782:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800785:	83 f8 12             	cmp    $0x12,%eax
+  800788:	7f 25                	jg     8007af <vprintfmt+0x1a5>
+  80078a:	8b 14 85 e0 3b 80 00 	mov    0x803be0(,%eax,4),%edx
+  800791:	85 d2                	test   %edx,%edx
+  800793:	74 1a                	je     8007af <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800795:	52                   	push   %edx
+  800796:	68 22 3d 80 00       	push   $0x803d22
+  80079b:	ff 75 0c             	push   0xc(%ebp)
+  80079e:	57                   	push   %edi
+  80079f:	e8 49 fe ff ff       	call   8005ed <printfmt>
+  8007a4:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007a7:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8007aa:	e9 89 fe ff ff       	jmp    800638 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8007af:	50                   	push   %eax
+  8007b0:	68 4b 39 80 00       	push   $0x80394b
+  8007b5:	ff 75 0c             	push   0xc(%ebp)
+  8007b8:	57                   	push   %edi
+  8007b9:	e8 2f fe ff ff       	call   8005ed <printfmt>
+  8007be:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007c1:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8007c4:	e9 6f fe ff ff       	jmp    800638 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cc:	83 c0 04             	add    $0x4,%eax
+  8007cf:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8007d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d5:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8007d7:	85 c9                	test   %ecx,%ecx
+  8007d9:	b8 44 39 80 00       	mov    $0x803944,%eax
+  8007de:	0f 45 c1             	cmovne %ecx,%eax
+  8007e1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8007e4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007e8:	7e 06                	jle    8007f0 <vprintfmt+0x1e6>
+  8007ea:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8007ee:	75 1a                	jne    80080a <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8007f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007f3:	c1 e0 08             	shl    $0x8,%eax
+  8007f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8007f9:	83 c8 3f             	or     $0x3f,%eax
+  8007fc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8007ff:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800802:	89 75 10             	mov    %esi,0x10(%ebp)
+  800805:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800808:	eb 6d                	jmp    800877 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80080a:	83 ec 08             	sub    $0x8,%esp
+  80080d:	ff 75 d0             	push   -0x30(%ebp)
+  800810:	ff 75 c8             	push   -0x38(%ebp)
+  800813:	e8 39 03 00 00       	call   800b51 <strnlen>
+  800818:	89 c2                	mov    %eax,%edx
+  80081a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80081d:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80081f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800822:	c1 e1 08             	shl    $0x8,%ecx
+  800825:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800829:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80082b:	83 c4 10             	add    $0x10,%esp
+  80082e:	89 c3                	mov    %eax,%ebx
+  800830:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800833:	89 75 10             	mov    %esi,0x10(%ebp)
+  800836:	89 ce                	mov    %ecx,%esi
+  800838:	eb 0f                	jmp    800849 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80083a:	83 ec 08             	sub    $0x8,%esp
+  80083d:	ff 75 0c             	push   0xc(%ebp)
+  800840:	56                   	push   %esi
+  800841:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800843:	83 eb 01             	sub    $0x1,%ebx
+  800846:	83 c4 10             	add    $0x10,%esp
+  800849:	85 db                	test   %ebx,%ebx
+  80084b:	7f ed                	jg     80083a <vprintfmt+0x230>
+  80084d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800850:	8b 75 10             	mov    0x10(%ebp),%esi
+  800853:	85 c0                	test   %eax,%eax
+  800855:	ba 00 00 00 00       	mov    $0x0,%edx
+  80085a:	0f 49 d0             	cmovns %eax,%edx
+  80085d:	29 d0                	sub    %edx,%eax
+  80085f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800862:	eb 8c                	jmp    8007f0 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800864:	83 ec 08             	sub    $0x8,%esp
+  800867:	ff 75 0c             	push   0xc(%ebp)
+  80086a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80086d:	09 c2                	or     %eax,%edx
+  80086f:	52                   	push   %edx
+  800870:	ff d7                	call   *%edi
+  800872:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800875:	89 d9                	mov    %ebx,%ecx
+  800877:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80087a:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80087e:	0f be d0             	movsbl %al,%edx
+  800881:	85 d2                	test   %edx,%edx
+  800883:	74 2a                	je     8008af <vprintfmt+0x2a5>
+  800885:	85 f6                	test   %esi,%esi
+  800887:	78 05                	js     80088e <vprintfmt+0x284>
+  800889:	83 ee 01             	sub    $0x1,%esi
+  80088c:	78 3b                	js     8008c9 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80088e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800892:	74 d0                	je     800864 <vprintfmt+0x25a>
+  800894:	0f be c0             	movsbl %al,%eax
+  800897:	83 e8 20             	sub    $0x20,%eax
+  80089a:	83 f8 5e             	cmp    $0x5e,%eax
+  80089d:	76 c5                	jbe    800864 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80089f:	83 ec 08             	sub    $0x8,%esp
+  8008a2:	ff 75 0c             	push   0xc(%ebp)
+  8008a5:	ff 75 cc             	push   -0x34(%ebp)
+  8008a8:	ff d7                	call   *%edi
+  8008aa:	83 c4 10             	add    $0x10,%esp
+  8008ad:	eb c6                	jmp    800875 <vprintfmt+0x26b>
+  8008af:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008b2:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8008b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008b8:	01 c3                	add    %eax,%ebx
+  8008ba:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8008bc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8008bf:	83 c8 20             	or     $0x20,%eax
+  8008c2:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008c5:	89 c6                	mov    %eax,%esi
+  8008c7:	eb 14                	jmp    8008dd <vprintfmt+0x2d3>
+  8008c9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008cc:	eb e4                	jmp    8008b2 <vprintfmt+0x2a8>
+  8008ce:	83 ec 08             	sub    $0x8,%esp
+  8008d1:	ff 75 0c             	push   0xc(%ebp)
+  8008d4:	56                   	push   %esi
+  8008d5:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8008d7:	83 eb 01             	sub    $0x1,%ebx
+  8008da:	83 c4 10             	add    $0x10,%esp
+  8008dd:	85 db                	test   %ebx,%ebx
+  8008df:	7f ed                	jg     8008ce <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008e1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008e4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8008e7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ea:	e9 49 fd ff ff       	jmp    800638 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008ef:	83 f9 01             	cmp    $0x1,%ecx
+  8008f2:	7f 1f                	jg     800913 <vprintfmt+0x309>
+	else if (lflag)
+  8008f4:	85 c9                	test   %ecx,%ecx
+  8008f6:	74 69                	je     800961 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8008f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fb:	8b 00                	mov    (%eax),%eax
+  8008fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800900:	89 c1                	mov    %eax,%ecx
+  800902:	c1 f9 1f             	sar    $0x1f,%ecx
+  800905:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800908:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090b:	8d 40 04             	lea    0x4(%eax),%eax
+  80090e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800911:	eb 17                	jmp    80092a <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800913:	8b 45 14             	mov    0x14(%ebp),%eax
+  800916:	8b 50 04             	mov    0x4(%eax),%edx
+  800919:	8b 00                	mov    (%eax),%eax
+  80091b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80091e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800921:	8b 45 14             	mov    0x14(%ebp),%eax
+  800924:	8d 40 08             	lea    0x8(%eax),%eax
+  800927:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80092a:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80092d:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800930:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800935:	85 db                	test   %ebx,%ebx
+  800937:	0f 89 f6 00 00 00    	jns    800a33 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80093d:	83 ec 08             	sub    $0x8,%esp
+  800940:	ff 75 0c             	push   0xc(%ebp)
+  800943:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800946:	c1 e0 08             	shl    $0x8,%eax
+  800949:	83 c8 2d             	or     $0x2d,%eax
+  80094c:	50                   	push   %eax
+  80094d:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80094f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800952:	f7 d9                	neg    %ecx
+  800954:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800957:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80095c:	e9 d2 00 00 00       	jmp    800a33 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800961:	8b 45 14             	mov    0x14(%ebp),%eax
+  800964:	8b 00                	mov    (%eax),%eax
+  800966:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800969:	89 c1                	mov    %eax,%ecx
+  80096b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80096e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800971:	8b 45 14             	mov    0x14(%ebp),%eax
+  800974:	8d 40 04             	lea    0x4(%eax),%eax
+  800977:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097a:	eb ae                	jmp    80092a <vprintfmt+0x320>
+	if (lflag >= 2)
+  80097c:	83 f9 01             	cmp    $0x1,%ecx
+  80097f:	7f 19                	jg     80099a <vprintfmt+0x390>
+	else if (lflag)
+  800981:	85 c9                	test   %ecx,%ecx
+  800983:	74 2a                	je     8009af <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800985:	8b 45 14             	mov    0x14(%ebp),%eax
+  800988:	8b 08                	mov    (%eax),%ecx
+  80098a:	8d 40 04             	lea    0x4(%eax),%eax
+  80098d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800990:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800995:	e9 99 00 00 00       	jmp    800a33 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80099a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099d:	8b 08                	mov    (%eax),%ecx
+  80099f:	8d 40 08             	lea    0x8(%eax),%eax
+  8009a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009a5:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8009aa:	e9 84 00 00 00       	jmp    800a33 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8009af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b2:	8b 08                	mov    (%eax),%ecx
+  8009b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8009bf:	eb 72                	jmp    800a33 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8009c1:	83 f9 01             	cmp    $0x1,%ecx
+  8009c4:	7f 16                	jg     8009dc <vprintfmt+0x3d2>
+	else if (lflag)
+  8009c6:	85 c9                	test   %ecx,%ecx
+  8009c8:	74 24                	je     8009ee <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8009ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cd:	8b 08                	mov    (%eax),%ecx
+  8009cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009d5:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8009da:	eb 57                	jmp    800a33 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8009dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009df:	8b 08                	mov    (%eax),%ecx
+  8009e1:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009e7:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8009ec:	eb 45                	jmp    800a33 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8009ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f1:	8b 08                	mov    (%eax),%ecx
+  8009f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009f9:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8009fe:	eb 33                	jmp    800a33 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800a00:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a03:	c1 e3 08             	shl    $0x8,%ebx
+  800a06:	83 ec 08             	sub    $0x8,%esp
+  800a09:	ff 75 0c             	push   0xc(%ebp)
+  800a0c:	89 d8                	mov    %ebx,%eax
+  800a0e:	83 c8 30             	or     $0x30,%eax
+  800a11:	50                   	push   %eax
+  800a12:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800a14:	83 c4 08             	add    $0x8,%esp
+  800a17:	ff 75 0c             	push   0xc(%ebp)
+  800a1a:	83 cb 78             	or     $0x78,%ebx
+  800a1d:	53                   	push   %ebx
+  800a1e:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800a20:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a23:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800a25:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a28:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a2e:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800a33:	ff 75 e4             	push   -0x1c(%ebp)
+  800a36:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800a3a:	52                   	push   %edx
+  800a3b:	ff 75 e0             	push   -0x20(%ebp)
+  800a3e:	50                   	push   %eax
+  800a3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a42:	89 f8                	mov    %edi,%eax
+  800a44:	e8 f7 fa ff ff       	call   800540 <printnum>
+			break;
+  800a49:	83 c4 10             	add    $0x10,%esp
+  800a4c:	e9 e7 fb ff ff       	jmp    800638 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800a51:	83 f9 01             	cmp    $0x1,%ecx
+  800a54:	7f 16                	jg     800a6c <vprintfmt+0x462>
+	else if (lflag)
+  800a56:	85 c9                	test   %ecx,%ecx
+  800a58:	74 24                	je     800a7e <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800a5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5d:	8b 08                	mov    (%eax),%ecx
+  800a5f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a62:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a65:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800a6a:	eb c7                	jmp    800a33 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6f:	8b 08                	mov    (%eax),%ecx
+  800a71:	8d 40 08             	lea    0x8(%eax),%eax
+  800a74:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a77:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800a7c:	eb b5                	jmp    800a33 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a81:	8b 08                	mov    (%eax),%ecx
+  800a83:	8d 40 04             	lea    0x4(%eax),%eax
+  800a86:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a89:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800a8e:	eb a3                	jmp    800a33 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800a90:	83 ec 08             	sub    $0x8,%esp
+  800a93:	ff 75 0c             	push   0xc(%ebp)
+  800a96:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a99:	c1 e0 08             	shl    $0x8,%eax
+  800a9c:	83 c8 25             	or     $0x25,%eax
+  800a9f:	50                   	push   %eax
+  800aa0:	ff d7                	call   *%edi
+			break;
+  800aa2:	83 c4 10             	add    $0x10,%esp
+  800aa5:	e9 8e fb ff ff       	jmp    800638 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800aaa:	83 ec 08             	sub    $0x8,%esp
+  800aad:	ff 75 0c             	push   0xc(%ebp)
+  800ab0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800ab3:	c1 e0 08             	shl    $0x8,%eax
+  800ab6:	83 c8 25             	or     $0x25,%eax
+  800ab9:	50                   	push   %eax
+  800aba:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800abc:	83 c4 10             	add    $0x10,%esp
+  800abf:	89 de                	mov    %ebx,%esi
+  800ac1:	eb 03                	jmp    800ac6 <vprintfmt+0x4bc>
+  800ac3:	83 ee 01             	sub    $0x1,%esi
+  800ac6:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800aca:	75 f7                	jne    800ac3 <vprintfmt+0x4b9>
+  800acc:	e9 67 fb ff ff       	jmp    800638 <vprintfmt+0x2e>
+
+00800ad1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	83 ec 18             	sub    $0x18,%esp
+  800ad7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ada:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800add:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ae0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ae4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ae7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800aee:	85 c0                	test   %eax,%eax
+  800af0:	74 26                	je     800b18 <vsnprintf+0x47>
+  800af2:	85 d2                	test   %edx,%edx
+  800af4:	7e 22                	jle    800b18 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800af6:	ff 75 14             	push   0x14(%ebp)
+  800af9:	ff 75 10             	push   0x10(%ebp)
+  800afc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800aff:	50                   	push   %eax
+  800b00:	68 d0 05 80 00       	push   $0x8005d0
+  800b05:	e8 00 fb ff ff       	call   80060a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b0a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b0d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b13:	83 c4 10             	add    $0x10,%esp
+}
+  800b16:	c9                   	leave
+  800b17:	c3                   	ret
+		return -E_INVAL;
+  800b18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b1d:	eb f7                	jmp    800b16 <vsnprintf+0x45>
+
+00800b1f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800b25:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b28:	50                   	push   %eax
+  800b29:	ff 75 10             	push   0x10(%ebp)
+  800b2c:	ff 75 0c             	push   0xc(%ebp)
+  800b2f:	ff 75 08             	push   0x8(%ebp)
+  800b32:	e8 9a ff ff ff       	call   800ad1 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b37:	c9                   	leave
+  800b38:	c3                   	ret
+
+00800b39 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b44:	eb 03                	jmp    800b49 <strlen+0x10>
+		n++;
+  800b46:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b49:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b4d:	75 f7                	jne    800b46 <strlen+0xd>
+	return n;
+}
+  800b4f:	5d                   	pop    %ebp
+  800b50:	c3                   	ret
+
+00800b51 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b57:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5f:	eb 03                	jmp    800b64 <strnlen+0x13>
+		n++;
+  800b61:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b64:	39 d0                	cmp    %edx,%eax
+  800b66:	74 08                	je     800b70 <strnlen+0x1f>
+  800b68:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b6c:	75 f3                	jne    800b61 <strnlen+0x10>
+  800b6e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b70:	89 d0                	mov    %edx,%eax
+  800b72:	5d                   	pop    %ebp
+  800b73:	c3                   	ret
+
+00800b74 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b74:	55                   	push   %ebp
+  800b75:	89 e5                	mov    %esp,%ebp
+  800b77:	53                   	push   %ebx
+  800b78:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b7b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b83:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b87:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b8a:	83 c0 01             	add    $0x1,%eax
+  800b8d:	84 d2                	test   %dl,%dl
+  800b8f:	75 f2                	jne    800b83 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b91:	89 c8                	mov    %ecx,%eax
+  800b93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b96:	c9                   	leave
+  800b97:	c3                   	ret
+
+00800b98 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b98:	55                   	push   %ebp
+  800b99:	89 e5                	mov    %esp,%ebp
+  800b9b:	53                   	push   %ebx
+  800b9c:	83 ec 10             	sub    $0x10,%esp
+  800b9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ba2:	53                   	push   %ebx
+  800ba3:	e8 91 ff ff ff       	call   800b39 <strlen>
+  800ba8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bab:	ff 75 0c             	push   0xc(%ebp)
+  800bae:	01 d8                	add    %ebx,%eax
+  800bb0:	50                   	push   %eax
+  800bb1:	e8 be ff ff ff       	call   800b74 <strcpy>
+	return dst;
+}
+  800bb6:	89 d8                	mov    %ebx,%eax
+  800bb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bbb:	c9                   	leave
+  800bbc:	c3                   	ret
+
+00800bbd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bbd:	55                   	push   %ebp
+  800bbe:	89 e5                	mov    %esp,%ebp
+  800bc0:	56                   	push   %esi
+  800bc1:	53                   	push   %ebx
+  800bc2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bc8:	89 f3                	mov    %esi,%ebx
+  800bca:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bcd:	89 f0                	mov    %esi,%eax
+  800bcf:	eb 0f                	jmp    800be0 <strncpy+0x23>
+		*dst++ = *src;
+  800bd1:	83 c0 01             	add    $0x1,%eax
+  800bd4:	0f b6 0a             	movzbl (%edx),%ecx
+  800bd7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bda:	80 f9 01             	cmp    $0x1,%cl
+  800bdd:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800be0:	39 d8                	cmp    %ebx,%eax
+  800be2:	75 ed                	jne    800bd1 <strncpy+0x14>
+	}
+	return ret;
+}
+  800be4:	89 f0                	mov    %esi,%eax
+  800be6:	5b                   	pop    %ebx
+  800be7:	5e                   	pop    %esi
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+
+00800bea <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	56                   	push   %esi
+  800bee:	53                   	push   %ebx
+  800bef:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf5:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bf8:	89 f0                	mov    %esi,%eax
+  800bfa:	85 d2                	test   %edx,%edx
+  800bfc:	74 21                	je     800c1f <strlcpy+0x35>
+  800bfe:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c02:	89 f2                	mov    %esi,%edx
+  800c04:	eb 09                	jmp    800c0f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c06:	83 c1 01             	add    $0x1,%ecx
+  800c09:	83 c2 01             	add    $0x1,%edx
+  800c0c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c0f:	39 c2                	cmp    %eax,%edx
+  800c11:	74 09                	je     800c1c <strlcpy+0x32>
+  800c13:	0f b6 19             	movzbl (%ecx),%ebx
+  800c16:	84 db                	test   %bl,%bl
+  800c18:	75 ec                	jne    800c06 <strlcpy+0x1c>
+  800c1a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c1c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c1f:	29 f0                	sub    %esi,%eax
+}
+  800c21:	5b                   	pop    %ebx
+  800c22:	5e                   	pop    %esi
+  800c23:	5d                   	pop    %ebp
+  800c24:	c3                   	ret
+
+00800c25 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c25:	55                   	push   %ebp
+  800c26:	89 e5                	mov    %esp,%ebp
+  800c28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c2e:	eb 06                	jmp    800c36 <strcmp+0x11>
+		p++, q++;
+  800c30:	83 c1 01             	add    $0x1,%ecx
+  800c33:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c36:	0f b6 01             	movzbl (%ecx),%eax
+  800c39:	84 c0                	test   %al,%al
+  800c3b:	74 04                	je     800c41 <strcmp+0x1c>
+  800c3d:	3a 02                	cmp    (%edx),%al
+  800c3f:	74 ef                	je     800c30 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c41:	0f b6 c0             	movzbl %al,%eax
+  800c44:	0f b6 12             	movzbl (%edx),%edx
+  800c47:	29 d0                	sub    %edx,%eax
+}
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+
+00800c4b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	53                   	push   %ebx
+  800c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c55:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c58:	eb 09                	jmp    800c63 <strncmp+0x18>
+		n--, p++, q++;
+  800c5a:	83 ea 01             	sub    $0x1,%edx
+  800c5d:	83 c0 01             	add    $0x1,%eax
+  800c60:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c63:	85 d2                	test   %edx,%edx
+  800c65:	74 18                	je     800c7f <strncmp+0x34>
+  800c67:	0f b6 18             	movzbl (%eax),%ebx
+  800c6a:	84 db                	test   %bl,%bl
+  800c6c:	74 04                	je     800c72 <strncmp+0x27>
+  800c6e:	3a 19                	cmp    (%ecx),%bl
+  800c70:	74 e8                	je     800c5a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c72:	0f b6 00             	movzbl (%eax),%eax
+  800c75:	0f b6 11             	movzbl (%ecx),%edx
+  800c78:	29 d0                	sub    %edx,%eax
+}
+  800c7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c7d:	c9                   	leave
+  800c7e:	c3                   	ret
+		return 0;
+  800c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c84:	eb f4                	jmp    800c7a <strncmp+0x2f>
+
+00800c86 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c90:	eb 03                	jmp    800c95 <strchr+0xf>
+  800c92:	83 c0 01             	add    $0x1,%eax
+  800c95:	0f b6 10             	movzbl (%eax),%edx
+  800c98:	84 d2                	test   %dl,%dl
+  800c9a:	74 06                	je     800ca2 <strchr+0x1c>
+		if (*s == c)
+  800c9c:	38 ca                	cmp    %cl,%dl
+  800c9e:	75 f2                	jne    800c92 <strchr+0xc>
+  800ca0:	eb 05                	jmp    800ca7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	c3                   	ret
+
+00800ca9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ca9:	55                   	push   %ebp
+  800caa:	89 e5                	mov    %esp,%ebp
+  800cac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800caf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cb3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cb6:	38 ca                	cmp    %cl,%dl
+  800cb8:	74 09                	je     800cc3 <strfind+0x1a>
+  800cba:	84 d2                	test   %dl,%dl
+  800cbc:	74 05                	je     800cc3 <strfind+0x1a>
+	for (; *s; s++)
+  800cbe:	83 c0 01             	add    $0x1,%eax
+  800cc1:	eb f0                	jmp    800cb3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+
+00800cc5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	57                   	push   %edi
+  800cc9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ccc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ccf:	85 c9                	test   %ecx,%ecx
+  800cd1:	74 20                	je     800cf3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cd3:	89 f8                	mov    %edi,%eax
+  800cd5:	09 c8                	or     %ecx,%eax
+  800cd7:	a8 03                	test   $0x3,%al
+  800cd9:	75 12                	jne    800ced <memset+0x28>
+		c &= 0xFF;
+  800cdb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cdf:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ce5:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ce8:	fc                   	cld
+  800ce9:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ceb:	eb 06                	jmp    800cf3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ced:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cf0:	fc                   	cld
+  800cf1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cf3:	89 f8                	mov    %edi,%eax
+  800cf5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cf8:	c9                   	leave
+  800cf9:	c3                   	ret
+
+00800cfa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cfa:	55                   	push   %ebp
+  800cfb:	89 e5                	mov    %esp,%ebp
+  800cfd:	57                   	push   %edi
+  800cfe:	56                   	push   %esi
+  800cff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d02:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d05:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d08:	39 c6                	cmp    %eax,%esi
+  800d0a:	73 32                	jae    800d3e <memmove+0x44>
+  800d0c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d0f:	39 d0                	cmp    %edx,%eax
+  800d11:	73 2b                	jae    800d3e <memmove+0x44>
+		s += n;
+		d += n;
+  800d13:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d16:	89 d6                	mov    %edx,%esi
+  800d18:	09 fe                	or     %edi,%esi
+  800d1a:	09 ce                	or     %ecx,%esi
+  800d1c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d22:	75 0e                	jne    800d32 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d24:	83 ef 04             	sub    $0x4,%edi
+  800d27:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d2a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d2d:	fd                   	std
+  800d2e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d30:	eb 09                	jmp    800d3b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d32:	83 ef 01             	sub    $0x1,%edi
+  800d35:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d38:	fd                   	std
+  800d39:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d3b:	fc                   	cld
+  800d3c:	eb 1a                	jmp    800d58 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d3e:	89 f2                	mov    %esi,%edx
+  800d40:	09 c2                	or     %eax,%edx
+  800d42:	09 ca                	or     %ecx,%edx
+  800d44:	f6 c2 03             	test   $0x3,%dl
+  800d47:	75 0a                	jne    800d53 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d49:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d4c:	89 c7                	mov    %eax,%edi
+  800d4e:	fc                   	cld
+  800d4f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d51:	eb 05                	jmp    800d58 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d53:	89 c7                	mov    %eax,%edi
+  800d55:	fc                   	cld
+  800d56:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d58:	5e                   	pop    %esi
+  800d59:	5f                   	pop    %edi
+  800d5a:	5d                   	pop    %ebp
+  800d5b:	c3                   	ret
+
+00800d5c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d62:	ff 75 10             	push   0x10(%ebp)
+  800d65:	ff 75 0c             	push   0xc(%ebp)
+  800d68:	ff 75 08             	push   0x8(%ebp)
+  800d6b:	e8 8a ff ff ff       	call   800cfa <memmove>
+}
+  800d70:	c9                   	leave
+  800d71:	c3                   	ret
+
+00800d72 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	56                   	push   %esi
+  800d76:	53                   	push   %ebx
+  800d77:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d7d:	89 c6                	mov    %eax,%esi
+  800d7f:	03 75 10             	add    0x10(%ebp),%esi
+  800d82:	eb 06                	jmp    800d8a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d84:	83 c0 01             	add    $0x1,%eax
+  800d87:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d8a:	39 f0                	cmp    %esi,%eax
+  800d8c:	74 14                	je     800da2 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d8e:	0f b6 08             	movzbl (%eax),%ecx
+  800d91:	0f b6 1a             	movzbl (%edx),%ebx
+  800d94:	38 d9                	cmp    %bl,%cl
+  800d96:	74 ec                	je     800d84 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d98:	0f b6 c1             	movzbl %cl,%eax
+  800d9b:	0f b6 db             	movzbl %bl,%ebx
+  800d9e:	29 d8                	sub    %ebx,%eax
+  800da0:	eb 05                	jmp    800da7 <memcmp+0x35>
+	}
+
+	return 0;
+  800da2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da7:	5b                   	pop    %ebx
+  800da8:	5e                   	pop    %esi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+
+00800dab <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800db4:	89 c2                	mov    %eax,%edx
+  800db6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800db9:	eb 03                	jmp    800dbe <memfind+0x13>
+  800dbb:	83 c0 01             	add    $0x1,%eax
+  800dbe:	39 d0                	cmp    %edx,%eax
+  800dc0:	73 04                	jae    800dc6 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dc2:	38 08                	cmp    %cl,(%eax)
+  800dc4:	75 f5                	jne    800dbb <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+
+00800dc8 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800dc8:	55                   	push   %ebp
+  800dc9:	89 e5                	mov    %esp,%ebp
+  800dcb:	57                   	push   %edi
+  800dcc:	56                   	push   %esi
+  800dcd:	53                   	push   %ebx
+  800dce:	83 ec 1c             	sub    $0x1c,%esp
+  800dd1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dd4:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800dd7:	eb 03                	jmp    800ddc <strtol+0x14>
+		s++;
+  800dd9:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800ddc:	0f b6 06             	movzbl (%esi),%eax
+  800ddf:	3c 20                	cmp    $0x20,%al
+  800de1:	74 f6                	je     800dd9 <strtol+0x11>
+  800de3:	3c 09                	cmp    $0x9,%al
+  800de5:	74 f2                	je     800dd9 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800de7:	3c 2b                	cmp    $0x2b,%al
+  800de9:	74 43                	je     800e2e <strtol+0x66>
+	int neg = 0;
+  800deb:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800df0:	3c 2d                	cmp    $0x2d,%al
+  800df2:	74 44                	je     800e38 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800df4:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800dfa:	75 0f                	jne    800e0b <strtol+0x43>
+  800dfc:	80 3e 30             	cmpb   $0x30,(%esi)
+  800dff:	74 41                	je     800e42 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e01:	85 ff                	test   %edi,%edi
+  800e03:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e08:	0f 44 f8             	cmove  %eax,%edi
+  800e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e10:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e15:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800e18:	89 fb                	mov    %edi,%ebx
+  800e1a:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e1d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800e20:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e23:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e26:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800e29:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e2c:	eb 67                	jmp    800e95 <strtol+0xcd>
+		s++;
+  800e2e:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800e31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e36:	eb bc                	jmp    800df4 <strtol+0x2c>
+		s++, neg = 1;
+  800e38:	83 c6 01             	add    $0x1,%esi
+  800e3b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e40:	eb b2                	jmp    800df4 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e42:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800e46:	74 0e                	je     800e56 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800e48:	85 ff                	test   %edi,%edi
+  800e4a:	75 bf                	jne    800e0b <strtol+0x43>
+		s++, base = 8;
+  800e4c:	83 c6 01             	add    $0x1,%esi
+  800e4f:	bf 08 00 00 00       	mov    $0x8,%edi
+  800e54:	eb b5                	jmp    800e0b <strtol+0x43>
+		s += 2, base = 16;
+  800e56:	83 c6 02             	add    $0x2,%esi
+  800e59:	bf 10 00 00 00       	mov    $0x10,%edi
+  800e5e:	eb ab                	jmp    800e0b <strtol+0x43>
+			dig = *s - '0';
+  800e60:	0f be c9             	movsbl %cl,%ecx
+  800e63:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800e66:	39 f9                	cmp    %edi,%ecx
+  800e68:	7d 59                	jge    800ec3 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800e6a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800e6e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e71:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e74:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800e77:	0f af d8             	imul   %eax,%ebx
+  800e7a:	0f af d7             	imul   %edi,%edx
+  800e7d:	01 d3                	add    %edx,%ebx
+  800e7f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e82:	f7 e7                	mul    %edi
+  800e84:	01 da                	add    %ebx,%edx
+  800e86:	89 cb                	mov    %ecx,%ebx
+  800e88:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e8b:	01 c8                	add    %ecx,%eax
+  800e8d:	11 da                	adc    %ebx,%edx
+  800e8f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e92:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800e95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e98:	0f b6 08             	movzbl (%eax),%ecx
+  800e9b:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800e9e:	80 fb 09             	cmp    $0x9,%bl
+  800ea1:	76 bd                	jbe    800e60 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800ea3:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800ea6:	80 fb 19             	cmp    $0x19,%bl
+  800ea9:	77 08                	ja     800eb3 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800eab:	0f be c9             	movsbl %cl,%ecx
+  800eae:	83 e9 57             	sub    $0x57,%ecx
+  800eb1:	eb b3                	jmp    800e66 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800eb3:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800eb6:	80 fb 19             	cmp    $0x19,%bl
+  800eb9:	77 08                	ja     800ec3 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800ebb:	0f be c9             	movsbl %cl,%ecx
+  800ebe:	83 e9 37             	sub    $0x37,%ecx
+  800ec1:	eb a3                	jmp    800e66 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ec3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ec6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ec9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800ecc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ecf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ed3:	74 05                	je     800eda <strtol+0x112>
+		*endptr = (char *) s;
+  800ed5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ed8:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800eda:	85 c9                	test   %ecx,%ecx
+  800edc:	74 07                	je     800ee5 <strtol+0x11d>
+  800ede:	f7 d8                	neg    %eax
+  800ee0:	83 d2 00             	adc    $0x0,%edx
+  800ee3:	f7 da                	neg    %edx
+}
+  800ee5:	83 c4 1c             	add    $0x1c,%esp
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5e                   	pop    %esi
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+
+00800eed <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800eed:	55                   	push   %ebp
+  800eee:	89 e5                	mov    %esp,%ebp
+  800ef0:	57                   	push   %edi
+  800ef1:	56                   	push   %esi
+  800ef2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ef3:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  800efa:	74 18                	je     800f14 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f07:	89 c3                	mov    %eax,%ebx
+  800f09:	89 c7                	mov    %eax,%edi
+  800f0b:	89 c6                	mov    %eax,%esi
+  800f0d:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f0f:	5b                   	pop    %ebx
+  800f10:	5e                   	pop    %esi
+  800f11:	5f                   	pop    %edi
+  800f12:	5d                   	pop    %ebp
+  800f13:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1f:	89 c3                	mov    %eax,%ebx
+  800f21:	89 c7                	mov    %eax,%edi
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	8d 35 2e 0f 80 00    	lea    0x800f2e,%esi
+  800f2c:	0f 34                	sysenter
+  800f2e:	5d                   	pop    %ebp
+		goto out;
+  800f2f:	eb de                	jmp    800f0f <sys_cputs+0x22>
+
+00800f31 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	57                   	push   %edi
+  800f35:	56                   	push   %esi
+  800f36:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f37:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  800f3e:	74 19                	je     800f59 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f45:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f4a:	89 d1                	mov    %edx,%ecx
+  800f4c:	89 d3                	mov    %edx,%ebx
+  800f4e:	89 d7                	mov    %edx,%edi
+  800f50:	89 d6                	mov    %edx,%esi
+  800f52:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f54:	5b                   	pop    %ebx
+  800f55:	5e                   	pop    %esi
+  800f56:	5f                   	pop    %edi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f63:	89 d1                	mov    %edx,%ecx
+  800f65:	89 d3                	mov    %edx,%ebx
+  800f67:	89 d7                	mov    %edx,%edi
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	8d 35 74 0f 80 00    	lea    0x800f74,%esi
+  800f72:	0f 34                	sysenter
+  800f74:	5d                   	pop    %ebp
+		goto out;
+  800f75:	eb dd                	jmp    800f54 <sys_cgetc+0x23>
+
+00800f77 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	57                   	push   %edi
+  800f7b:	56                   	push   %esi
+  800f7c:	53                   	push   %ebx
+  800f7d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f80:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  800f87:	74 21                	je     800faa <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800f89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f96:	89 cb                	mov    %ecx,%ebx
+  800f98:	89 cf                	mov    %ecx,%edi
+  800f9a:	89 ce                	mov    %ecx,%esi
+  800f9c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9e:	85 c0                	test   %eax,%eax
+  800fa0:	7f 27                	jg     800fc9 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa5:	5b                   	pop    %ebx
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800faa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fb7:	89 cb                	mov    %ecx,%ebx
+  800fb9:	89 cf                	mov    %ecx,%edi
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	8d 35 c6 0f 80 00    	lea    0x800fc6,%esi
+  800fc4:	0f 34                	sysenter
+  800fc6:	5d                   	pop    %ebp
+		goto out;
+  800fc7:	eb d5                	jmp    800f9e <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc9:	83 ec 0c             	sub    $0xc,%esp
+  800fcc:	50                   	push   %eax
+  800fcd:	6a 03                	push   $0x3
+  800fcf:	68 4b 3c 80 00       	push   $0x803c4b
+  800fd4:	6a 3f                	push   $0x3f
+  800fd6:	68 68 3c 80 00       	push   $0x803c68
+  800fdb:	e8 71 f4 ff ff       	call   800451 <_panic>
+
+00800fe0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	57                   	push   %edi
+  800fe4:	56                   	push   %esi
+  800fe5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fe6:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  800fed:	74 19                	je     801008 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800fef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ff9:	89 d1                	mov    %edx,%ecx
+  800ffb:	89 d3                	mov    %edx,%ebx
+  800ffd:	89 d7                	mov    %edx,%edi
+  800fff:	89 d6                	mov    %edx,%esi
+  801001:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801003:	5b                   	pop    %ebx
+  801004:	5e                   	pop    %esi
+  801005:	5f                   	pop    %edi
+  801006:	5d                   	pop    %ebp
+  801007:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801008:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801012:	89 d1                	mov    %edx,%ecx
+  801014:	89 d3                	mov    %edx,%ebx
+  801016:	89 d7                	mov    %edx,%edi
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	8d 35 23 10 80 00    	lea    0x801023,%esi
+  801021:	0f 34                	sysenter
+  801023:	5d                   	pop    %ebp
+		goto out;
+  801024:	eb dd                	jmp    801003 <sys_getenvid+0x23>
+
+00801026 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801026:	55                   	push   %ebp
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	57                   	push   %edi
+  80102a:	56                   	push   %esi
+  80102b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80102c:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801033:	74 19                	je     80104e <sys_yield+0x28>
+	asm volatile("int %1\n"
+  801035:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80103f:	89 d1                	mov    %edx,%ecx
+  801041:	89 d3                	mov    %edx,%ebx
+  801043:	89 d7                	mov    %edx,%edi
+  801045:	89 d6                	mov    %edx,%esi
+  801047:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801049:	5b                   	pop    %ebx
+  80104a:	5e                   	pop    %esi
+  80104b:	5f                   	pop    %edi
+  80104c:	5d                   	pop    %ebp
+  80104d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80104e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801053:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801058:	89 d1                	mov    %edx,%ecx
+  80105a:	89 d3                	mov    %edx,%ebx
+  80105c:	89 d7                	mov    %edx,%edi
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	8d 35 69 10 80 00    	lea    0x801069,%esi
+  801067:	0f 34                	sysenter
+  801069:	5d                   	pop    %ebp
+		goto out;
+  80106a:	eb dd                	jmp    801049 <sys_yield+0x23>
+
+0080106c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80106c:	55                   	push   %ebp
+  80106d:	89 e5                	mov    %esp,%ebp
+  80106f:	57                   	push   %edi
+  801070:	56                   	push   %esi
+  801071:	53                   	push   %ebx
+  801072:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801075:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  80107c:	74 23                	je     8010a1 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  80107e:	be 00 00 00 00       	mov    $0x0,%esi
+  801083:	b8 04 00 00 00       	mov    $0x4,%eax
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801091:	89 f7                	mov    %esi,%edi
+  801093:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801095:	85 c0                	test   %eax,%eax
+  801097:	7f 29                	jg     8010c2 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801099:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109c:	5b                   	pop    %ebx
+  80109d:	5e                   	pop    %esi
+  80109e:	5f                   	pop    %edi
+  80109f:	5d                   	pop    %ebp
+  8010a0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	8d 35 bf 10 80 00    	lea    0x8010bf,%esi
+  8010bd:	0f 34                	sysenter
+  8010bf:	5d                   	pop    %ebp
+		goto out;
+  8010c0:	eb d3                	jmp    801095 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c2:	83 ec 0c             	sub    $0xc,%esp
+  8010c5:	50                   	push   %eax
+  8010c6:	6a 04                	push   $0x4
+  8010c8:	68 4b 3c 80 00       	push   $0x803c4b
+  8010cd:	6a 3f                	push   $0x3f
+  8010cf:	68 68 3c 80 00       	push   $0x803c68
+  8010d4:	e8 78 f3 ff ff       	call   800451 <_panic>
+
+008010d9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	57                   	push   %edi
+  8010dd:	56                   	push   %esi
+  8010de:	53                   	push   %ebx
+  8010df:	83 ec 0c             	sub    $0xc,%esp
+  8010e2:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  8010e5:	85 f6                	test   %esi,%esi
+  8010e7:	75 09                	jne    8010f2 <sys_page_map+0x19>
+  8010e9:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8010f0:	74 1f                	je     801111 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  8010f2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801100:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801103:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801105:	85 c0                	test   %eax,%eax
+  801107:	7f 27                	jg     801130 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801111:	8b 55 08             	mov    0x8(%ebp),%edx
+  801114:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801117:	b8 05 00 00 00       	mov    $0x5,%eax
+  80111c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	8d 35 2d 11 80 00    	lea    0x80112d,%esi
+  80112b:	0f 34                	sysenter
+  80112d:	5d                   	pop    %ebp
+		goto out;
+  80112e:	eb d5                	jmp    801105 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801130:	83 ec 0c             	sub    $0xc,%esp
+  801133:	50                   	push   %eax
+  801134:	6a 05                	push   $0x5
+  801136:	68 4b 3c 80 00       	push   $0x803c4b
+  80113b:	6a 3f                	push   $0x3f
+  80113d:	68 68 3c 80 00       	push   $0x803c68
+  801142:	e8 0a f3 ff ff       	call   800451 <_panic>
+
+00801147 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801147:	55                   	push   %ebp
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	57                   	push   %edi
+  80114b:	56                   	push   %esi
+  80114c:	53                   	push   %ebx
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801150:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801157:	74 22                	je     80117b <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801159:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801163:	8b 55 08             	mov    0x8(%ebp),%edx
+  801166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801169:	89 df                	mov    %ebx,%edi
+  80116b:	89 de                	mov    %ebx,%esi
+  80116d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116f:	85 c0                	test   %eax,%eax
+  801171:	7f 28                	jg     80119b <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801176:	5b                   	pop    %ebx
+  801177:	5e                   	pop    %esi
+  801178:	5f                   	pop    %edi
+  801179:	5d                   	pop    %ebp
+  80117a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80117b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801180:	8b 55 08             	mov    0x8(%ebp),%edx
+  801183:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801186:	b8 06 00 00 00       	mov    $0x6,%eax
+  80118b:	89 df                	mov    %ebx,%edi
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	8d 35 98 11 80 00    	lea    0x801198,%esi
+  801196:	0f 34                	sysenter
+  801198:	5d                   	pop    %ebp
+		goto out;
+  801199:	eb d4                	jmp    80116f <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	50                   	push   %eax
+  80119f:	6a 06                	push   $0x6
+  8011a1:	68 4b 3c 80 00       	push   $0x803c4b
+  8011a6:	6a 3f                	push   $0x3f
+  8011a8:	68 68 3c 80 00       	push   $0x803c68
+  8011ad:	e8 9f f2 ff ff       	call   800451 <_panic>
+
+008011b2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	56                   	push   %esi
+  8011b7:	53                   	push   %ebx
+  8011b8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011bb:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8011c2:	74 22                	je     8011e6 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8011c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	89 df                	mov    %ebx,%edi
+  8011d6:	89 de                	mov    %ebx,%esi
+  8011d8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011da:	85 c0                	test   %eax,%eax
+  8011dc:	7f 28                	jg     801206 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e1:	5b                   	pop    %ebx
+  8011e2:	5e                   	pop    %esi
+  8011e3:	5f                   	pop    %edi
+  8011e4:	5d                   	pop    %ebp
+  8011e5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011f6:	89 df                	mov    %ebx,%edi
+  8011f8:	55                   	push   %ebp
+  8011f9:	89 e5                	mov    %esp,%ebp
+  8011fb:	8d 35 03 12 80 00    	lea    0x801203,%esi
+  801201:	0f 34                	sysenter
+  801203:	5d                   	pop    %ebp
+		goto out;
+  801204:	eb d4                	jmp    8011da <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801206:	83 ec 0c             	sub    $0xc,%esp
+  801209:	50                   	push   %eax
+  80120a:	6a 08                	push   $0x8
+  80120c:	68 4b 3c 80 00       	push   $0x803c4b
+  801211:	6a 3f                	push   $0x3f
+  801213:	68 68 3c 80 00       	push   $0x803c68
+  801218:	e8 34 f2 ff ff       	call   800451 <_panic>
+
+0080121d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+  801223:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801226:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  80122d:	74 22                	je     801251 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80122f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801234:	b8 09 00 00 00       	mov    $0x9,%eax
+  801239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123f:	89 df                	mov    %ebx,%edi
+  801241:	89 de                	mov    %ebx,%esi
+  801243:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801245:	85 c0                	test   %eax,%eax
+  801247:	7f 28                	jg     801271 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124c:	5b                   	pop    %ebx
+  80124d:	5e                   	pop    %esi
+  80124e:	5f                   	pop    %edi
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801251:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801256:	8b 55 08             	mov    0x8(%ebp),%edx
+  801259:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801261:	89 df                	mov    %ebx,%edi
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	8d 35 6e 12 80 00    	lea    0x80126e,%esi
+  80126c:	0f 34                	sysenter
+  80126e:	5d                   	pop    %ebp
+		goto out;
+  80126f:	eb d4                	jmp    801245 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801271:	83 ec 0c             	sub    $0xc,%esp
+  801274:	50                   	push   %eax
+  801275:	6a 09                	push   $0x9
+  801277:	68 4b 3c 80 00       	push   $0x803c4b
+  80127c:	6a 3f                	push   $0x3f
+  80127e:	68 68 3c 80 00       	push   $0x803c68
+  801283:	e8 c9 f1 ff ff       	call   800451 <_panic>
+
+00801288 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801288:	55                   	push   %ebp
+  801289:	89 e5                	mov    %esp,%ebp
+  80128b:	57                   	push   %edi
+  80128c:	56                   	push   %esi
+  80128d:	53                   	push   %ebx
+  80128e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801291:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801298:	74 22                	je     8012bc <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80129a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012aa:	89 df                	mov    %ebx,%edi
+  8012ac:	89 de                	mov    %ebx,%esi
+  8012ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	7f 28                	jg     8012dc <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b7:	5b                   	pop    %ebx
+  8012b8:	5e                   	pop    %esi
+  8012b9:	5f                   	pop    %edi
+  8012ba:	5d                   	pop    %ebp
+  8012bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012cc:	89 df                	mov    %ebx,%edi
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	8d 35 d9 12 80 00    	lea    0x8012d9,%esi
+  8012d7:	0f 34                	sysenter
+  8012d9:	5d                   	pop    %ebp
+		goto out;
+  8012da:	eb d4                	jmp    8012b0 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012dc:	83 ec 0c             	sub    $0xc,%esp
+  8012df:	50                   	push   %eax
+  8012e0:	6a 0a                	push   $0xa
+  8012e2:	68 4b 3c 80 00       	push   $0x803c4b
+  8012e7:	6a 3f                	push   $0x3f
+  8012e9:	68 68 3c 80 00       	push   $0x803c68
+  8012ee:	e8 5e f1 ff ff       	call   800451 <_panic>
+
+008012f3 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  8012f6:	57                   	push   %edi
+  8012f7:	56                   	push   %esi
+  8012f8:	53                   	push   %ebx
+  8012f9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012fc:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801303:	74 22                	je     801327 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801305:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80130f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801312:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801315:	89 df                	mov    %ebx,%edi
+  801317:	89 de                	mov    %ebx,%esi
+  801319:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80131b:	85 c0                	test   %eax,%eax
+  80131d:	7f 28                	jg     801347 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80131f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801322:	5b                   	pop    %ebx
+  801323:	5e                   	pop    %esi
+  801324:	5f                   	pop    %edi
+  801325:	5d                   	pop    %ebp
+  801326:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801327:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801332:	b8 17 00 00 00       	mov    $0x17,%eax
+  801337:	89 df                	mov    %ebx,%edi
+  801339:	55                   	push   %ebp
+  80133a:	89 e5                	mov    %esp,%ebp
+  80133c:	8d 35 44 13 80 00    	lea    0x801344,%esi
+  801342:	0f 34                	sysenter
+  801344:	5d                   	pop    %ebp
+		goto out;
+  801345:	eb d4                	jmp    80131b <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801347:	83 ec 0c             	sub    $0xc,%esp
+  80134a:	50                   	push   %eax
+  80134b:	6a 17                	push   $0x17
+  80134d:	68 4b 3c 80 00       	push   $0x803c4b
+  801352:	6a 3f                	push   $0x3f
+  801354:	68 68 3c 80 00       	push   $0x803c68
+  801359:	e8 f3 f0 ff ff       	call   800451 <_panic>
+
+0080135e <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	57                   	push   %edi
+  801362:	56                   	push   %esi
+  801363:	53                   	push   %ebx
+  801364:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801367:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  80136e:	74 22                	je     801392 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801370:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801375:	b8 18 00 00 00       	mov    $0x18,%eax
+  80137a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801380:	89 df                	mov    %ebx,%edi
+  801382:	89 de                	mov    %ebx,%esi
+  801384:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801386:	85 c0                	test   %eax,%eax
+  801388:	7f 28                	jg     8013b2 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80138a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5f                   	pop    %edi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013a2:	89 df                	mov    %ebx,%edi
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+  8013a7:	8d 35 af 13 80 00    	lea    0x8013af,%esi
+  8013ad:	0f 34                	sysenter
+  8013af:	5d                   	pop    %ebp
+		goto out;
+  8013b0:	eb d4                	jmp    801386 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+  8013b5:	50                   	push   %eax
+  8013b6:	6a 18                	push   $0x18
+  8013b8:	68 4b 3c 80 00       	push   $0x803c4b
+  8013bd:	6a 3f                	push   $0x3f
+  8013bf:	68 68 3c 80 00       	push   $0x803c68
+  8013c4:	e8 88 f0 ff ff       	call   800451 <_panic>
+
+008013c9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	57                   	push   %edi
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013cf:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8013d6:	74 1d                	je     8013f5 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8013d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013ee:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8013f0:	5b                   	pop    %ebx
+  8013f1:	5e                   	pop    %esi
+  8013f2:	5f                   	pop    %edi
+  8013f3:	5d                   	pop    %ebp
+  8013f4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801400:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801403:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801406:	55                   	push   %ebp
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	8d 35 11 14 80 00    	lea    0x801411,%esi
+  80140f:	0f 34                	sysenter
+  801411:	5d                   	pop    %ebp
+		goto out;
+  801412:	eb dc                	jmp    8013f0 <sys_ipc_try_send+0x27>
+
+00801414 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+  801417:	57                   	push   %edi
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+  80141a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80141d:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801424:	74 21                	je     801447 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801426:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80142b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801430:	8b 55 08             	mov    0x8(%ebp),%edx
+  801433:	89 cb                	mov    %ecx,%ebx
+  801435:	89 cf                	mov    %ecx,%edi
+  801437:	89 ce                	mov    %ecx,%esi
+  801439:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80143b:	85 c0                	test   %eax,%eax
+  80143d:	7f 27                	jg     801466 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80143f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801442:	5b                   	pop    %ebx
+  801443:	5e                   	pop    %esi
+  801444:	5f                   	pop    %edi
+  801445:	5d                   	pop    %ebp
+  801446:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801447:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80144f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801454:	89 cb                	mov    %ecx,%ebx
+  801456:	89 cf                	mov    %ecx,%edi
+  801458:	55                   	push   %ebp
+  801459:	89 e5                	mov    %esp,%ebp
+  80145b:	8d 35 63 14 80 00    	lea    0x801463,%esi
+  801461:	0f 34                	sysenter
+  801463:	5d                   	pop    %ebp
+		goto out;
+  801464:	eb d5                	jmp    80143b <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	50                   	push   %eax
+  80146a:	6a 0d                	push   $0xd
+  80146c:	68 4b 3c 80 00       	push   $0x803c4b
+  801471:	6a 3f                	push   $0x3f
+  801473:	68 68 3c 80 00       	push   $0x803c68
+  801478:	e8 d4 ef ff ff       	call   800451 <_panic>
+
+0080147d <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	57                   	push   %edi
+  801481:	56                   	push   %esi
+  801482:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801483:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  80148a:	74 1b                	je     8014a7 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80148c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801491:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801496:	8b 55 08             	mov    0x8(%ebp),%edx
+  801499:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149c:	89 df                	mov    %ebx,%edi
+  80149e:	89 de                	mov    %ebx,%esi
+  8014a0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8014a2:	5b                   	pop    %ebx
+  8014a3:	5e                   	pop    %esi
+  8014a4:	5f                   	pop    %edi
+  8014a5:	5d                   	pop    %ebp
+  8014a6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014b7:	89 df                	mov    %ebx,%edi
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	8d 35 c4 14 80 00    	lea    0x8014c4,%esi
+  8014c2:	0f 34                	sysenter
+  8014c4:	5d                   	pop    %ebp
+		goto out;
+  8014c5:	eb db                	jmp    8014a2 <sys_ipc_recv_until+0x25>
+
+008014c7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8014c7:	55                   	push   %ebp
+  8014c8:	89 e5                	mov    %esp,%ebp
+  8014ca:	57                   	push   %edi
+  8014cb:	56                   	push   %esi
+  8014cc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014cd:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8014d4:	74 19                	je     8014ef <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8014d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014db:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014e0:	89 d1                	mov    %edx,%ecx
+  8014e2:	89 d3                	mov    %edx,%ebx
+  8014e4:	89 d7                	mov    %edx,%edi
+  8014e6:	89 d6                	mov    %edx,%esi
+  8014e8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014ea:	5b                   	pop    %ebx
+  8014eb:	5e                   	pop    %esi
+  8014ec:	5f                   	pop    %edi
+  8014ed:	5d                   	pop    %ebp
+  8014ee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014f9:	89 d1                	mov    %edx,%ecx
+  8014fb:	89 d3                	mov    %edx,%ebx
+  8014fd:	89 d7                	mov    %edx,%edi
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	8d 35 0a 15 80 00    	lea    0x80150a,%esi
+  801508:	0f 34                	sysenter
+  80150a:	5d                   	pop    %ebp
+		goto out;
+  80150b:	eb dd                	jmp    8014ea <sys_time_msec+0x23>
+
+0080150d <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80150d:	55                   	push   %ebp
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	57                   	push   %edi
+  801511:	56                   	push   %esi
+  801512:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801513:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  80151a:	74 1a                	je     801536 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80151c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801521:	b8 10 00 00 00       	mov    $0x10,%eax
+  801526:	8b 55 08             	mov    0x8(%ebp),%edx
+  801529:	89 cb                	mov    %ecx,%ebx
+  80152b:	89 cf                	mov    %ecx,%edi
+  80152d:	89 ce                	mov    %ecx,%esi
+  80152f:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801531:	5b                   	pop    %ebx
+  801532:	5e                   	pop    %esi
+  801533:	5f                   	pop    %edi
+  801534:	5d                   	pop    %ebp
+  801535:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801536:	8b 55 08             	mov    0x8(%ebp),%edx
+  801539:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80153e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801543:	89 cb                	mov    %ecx,%ebx
+  801545:	89 cf                	mov    %ecx,%edi
+  801547:	55                   	push   %ebp
+  801548:	89 e5                	mov    %esp,%ebp
+  80154a:	8d 35 52 15 80 00    	lea    0x801552,%esi
+  801550:	0f 34                	sysenter
+  801552:	5d                   	pop    %ebp
+		goto out;
+  801553:	eb dc                	jmp    801531 <sys_sleep_until+0x24>
+
+00801555 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801555:	55                   	push   %ebp
+  801556:	89 e5                	mov    %esp,%ebp
+  801558:	57                   	push   %edi
+  801559:	56                   	push   %esi
+  80155a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80155b:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801562:	74 1a                	je     80157e <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801564:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801569:	b8 11 00 00 00       	mov    $0x11,%eax
+  80156e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801571:	89 cb                	mov    %ecx,%ebx
+  801573:	89 cf                	mov    %ecx,%edi
+  801575:	89 ce                	mov    %ecx,%esi
+  801577:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801579:	5b                   	pop    %ebx
+  80157a:	5e                   	pop    %esi
+  80157b:	5f                   	pop    %edi
+  80157c:	5d                   	pop    %ebp
+  80157d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80157e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801581:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801586:	b8 11 00 00 00       	mov    $0x11,%eax
+  80158b:	89 cb                	mov    %ecx,%ebx
+  80158d:	89 cf                	mov    %ecx,%edi
+  80158f:	55                   	push   %ebp
+  801590:	89 e5                	mov    %esp,%ebp
+  801592:	8d 35 9a 15 80 00    	lea    0x80159a,%esi
+  801598:	0f 34                	sysenter
+  80159a:	5d                   	pop    %ebp
+		goto out;
+  80159b:	eb dc                	jmp    801579 <sys_env_print_stats+0x24>
+
+0080159d <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80159d:	55                   	push   %ebp
+  80159e:	89 e5                	mov    %esp,%ebp
+  8015a0:	57                   	push   %edi
+  8015a1:	56                   	push   %esi
+  8015a2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015a3:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8015aa:	74 1b                	je     8015c7 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8015ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bc:	89 df                	mov    %ebx,%edi
+  8015be:	89 de                	mov    %ebx,%esi
+  8015c0:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5f                   	pop    %edi
+  8015c5:	5d                   	pop    %ebp
+  8015c6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015d7:	89 df                	mov    %ebx,%edi
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	8d 35 e4 15 80 00    	lea    0x8015e4,%esi
+  8015e2:	0f 34                	sysenter
+  8015e4:	5d                   	pop    %ebp
+		goto out;
+  8015e5:	eb db                	jmp    8015c2 <sys_perf+0x25>
+
+008015e7 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	57                   	push   %edi
+  8015eb:	56                   	push   %esi
+  8015ec:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015ed:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8015f4:	74 19                	je     80160f <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8015f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801600:	89 d1                	mov    %edx,%ecx
+  801602:	89 d3                	mov    %edx,%ebx
+  801604:	89 d7                	mov    %edx,%edi
+  801606:	89 d6                	mov    %edx,%esi
+  801608:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80160a:	5b                   	pop    %ebx
+  80160b:	5e                   	pop    %esi
+  80160c:	5f                   	pop    %edi
+  80160d:	5d                   	pop    %ebp
+  80160e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80160f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801614:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801619:	89 d1                	mov    %edx,%ecx
+  80161b:	89 d3                	mov    %edx,%ebx
+  80161d:	89 d7                	mov    %edx,%edi
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	8d 35 2a 16 80 00    	lea    0x80162a,%esi
+  801628:	0f 34                	sysenter
+  80162a:	5d                   	pop    %ebp
+		goto out;
+  80162b:	eb dd                	jmp    80160a <sys_fork+0x23>
+
+0080162d <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80162d:	55                   	push   %ebp
+  80162e:	89 e5                	mov    %esp,%ebp
+  801630:	57                   	push   %edi
+  801631:	56                   	push   %esi
+  801632:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801633:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  80163a:	74 1c                	je     801658 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80163c:	be 00 00 00 00       	mov    $0x0,%esi
+  801641:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801646:	8b 55 08             	mov    0x8(%ebp),%edx
+  801649:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80164f:	89 f7                	mov    %esi,%edi
+  801651:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801653:	5b                   	pop    %ebx
+  801654:	5e                   	pop    %esi
+  801655:	5f                   	pop    %edi
+  801656:	5d                   	pop    %ebp
+  801657:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801658:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801663:	bf 00 00 00 00       	mov    $0x0,%edi
+  801668:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80166b:	55                   	push   %ebp
+  80166c:	89 e5                	mov    %esp,%ebp
+  80166e:	8d 35 76 16 80 00    	lea    0x801676,%esi
+  801674:	0f 34                	sysenter
+  801676:	5d                   	pop    %ebp
+		goto out;
+  801677:	eb da                	jmp    801653 <sys_thread_create+0x26>
+
+00801679 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	57                   	push   %edi
+  80167d:	56                   	push   %esi
+  80167e:	53                   	push   %ebx
+  80167f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801682:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801689:	74 24                	je     8016af <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80168b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801690:	be 00 00 00 00       	mov    $0x0,%esi
+  801695:	8b 55 08             	mov    0x8(%ebp),%edx
+  801698:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80169e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	7f 27                	jg     8016ce <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8016a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016aa:	5b                   	pop    %ebx
+  8016ab:	5e                   	pop    %esi
+  8016ac:	5f                   	pop    %edi
+  8016ad:	5d                   	pop    %ebp
+  8016ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8016ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016c0:	55                   	push   %ebp
+  8016c1:	89 e5                	mov    %esp,%ebp
+  8016c3:	8d 35 cb 16 80 00    	lea    0x8016cb,%esi
+  8016c9:	0f 34                	sysenter
+  8016cb:	5d                   	pop    %ebp
+		goto out;
+  8016cc:	eb d5                	jmp    8016a3 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016ce:	83 ec 0c             	sub    $0xc,%esp
+  8016d1:	50                   	push   %eax
+  8016d2:	6a 1f                	push   $0x1f
+  8016d4:	68 4b 3c 80 00       	push   $0x803c4b
+  8016d9:	6a 3f                	push   $0x3f
+  8016db:	68 68 3c 80 00       	push   $0x803c68
+  8016e0:	e8 6c ed ff ff       	call   800451 <_panic>
+
+008016e5 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8016e5:	55                   	push   %ebp
+  8016e6:	89 e5                	mov    %esp,%ebp
+  8016e8:	57                   	push   %edi
+  8016e9:	56                   	push   %esi
+  8016ea:	53                   	push   %ebx
+  8016eb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016ee:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8016f5:	74 23                	je     80171a <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8016f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fc:	b8 20 00 00 00       	mov    $0x20,%eax
+  801701:	8b 55 08             	mov    0x8(%ebp),%edx
+  801704:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801707:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170a:	89 f7                	mov    %esi,%edi
+  80170c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	7f 29                	jg     80173b <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801712:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801715:	5b                   	pop    %ebx
+  801716:	5e                   	pop    %esi
+  801717:	5f                   	pop    %edi
+  801718:	5d                   	pop    %ebp
+  801719:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80171a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801720:	b8 20 00 00 00       	mov    $0x20,%eax
+  801725:	bf 00 00 00 00       	mov    $0x0,%edi
+  80172a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80172d:	55                   	push   %ebp
+  80172e:	89 e5                	mov    %esp,%ebp
+  801730:	8d 35 38 17 80 00    	lea    0x801738,%esi
+  801736:	0f 34                	sysenter
+  801738:	5d                   	pop    %ebp
+		goto out;
+  801739:	eb d3                	jmp    80170e <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80173b:	83 ec 0c             	sub    $0xc,%esp
+  80173e:	50                   	push   %eax
+  80173f:	6a 20                	push   $0x20
+  801741:	68 4b 3c 80 00       	push   $0x803c4b
+  801746:	6a 3f                	push   $0x3f
+  801748:	68 68 3c 80 00       	push   $0x803c68
+  80174d:	e8 ff ec ff ff       	call   800451 <_panic>
+
+00801752 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801752:	55                   	push   %ebp
+  801753:	89 e5                	mov    %esp,%ebp
+  801755:	57                   	push   %edi
+  801756:	56                   	push   %esi
+  801757:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801758:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  80175f:	74 1b                	je     80177c <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801761:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801766:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80176b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801771:	89 df                	mov    %ebx,%edi
+  801773:	89 de                	mov    %ebx,%esi
+  801775:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801777:	5b                   	pop    %ebx
+  801778:	5e                   	pop    %esi
+  801779:	5f                   	pop    %edi
+  80177a:	5d                   	pop    %ebp
+  80177b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80177c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801781:	8b 55 08             	mov    0x8(%ebp),%edx
+  801784:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801787:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80178c:	89 df                	mov    %ebx,%edi
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	8d 35 99 17 80 00    	lea    0x801799,%esi
+  801797:	0f 34                	sysenter
+  801799:	5d                   	pop    %ebp
+		goto out;
+  80179a:	eb db                	jmp    801777 <sys_batch+0x25>
+
+0080179c <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80179c:	55                   	push   %ebp
+  80179d:	89 e5                	mov    %esp,%ebp
+  80179f:	57                   	push   %edi
+  8017a0:	56                   	push   %esi
+  8017a1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017a2:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8017a9:	74 1a                	je     8017c5 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8017ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b8:	89 cb                	mov    %ecx,%ebx
+  8017ba:	89 cf                	mov    %ecx,%edi
+  8017bc:	89 ce                	mov    %ecx,%esi
+  8017be:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8017c0:	5b                   	pop    %ebx
+  8017c1:	5e                   	pop    %esi
+  8017c2:	5f                   	pop    %edi
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017cd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017d2:	89 cb                	mov    %ecx,%ebx
+  8017d4:	89 cf                	mov    %ecx,%edi
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	8d 35 e1 17 80 00    	lea    0x8017e1,%esi
+  8017df:	0f 34                	sysenter
+  8017e1:	5d                   	pop    %ebp
+		goto out;
+  8017e2:	eb dc                	jmp    8017c0 <sys_trace_ctl+0x24>
+
+008017e4 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	57                   	push   %edi
+  8017e8:	56                   	push   %esi
+  8017e9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ea:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8017f1:	74 1c                	je     80180f <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8017f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8017fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801800:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801803:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801806:	89 f7                	mov    %esi,%edi
+  801808:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80180a:	5b                   	pop    %ebx
+  80180b:	5e                   	pop    %esi
+  80180c:	5f                   	pop    %edi
+  80180d:	5d                   	pop    %ebp
+  80180e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80180f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801812:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801815:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80181a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80181f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801822:	55                   	push   %ebp
+  801823:	89 e5                	mov    %esp,%ebp
+  801825:	8d 35 2d 18 80 00    	lea    0x80182d,%esi
+  80182b:	0f 34                	sysenter
+  80182d:	5d                   	pop    %ebp
+		goto out;
+  80182e:	eb da                	jmp    80180a <sys_trace_read+0x26>
+
+00801830 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801830:	55                   	push   %ebp
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	57                   	push   %edi
+  801834:	56                   	push   %esi
+  801835:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801836:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  80183d:	74 1c                	je     80185b <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80183f:	be 00 00 00 00       	mov    $0x0,%esi
+  801844:	b8 21 00 00 00       	mov    $0x21,%eax
+  801849:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80184f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801852:	89 f7                	mov    %esi,%edi
+  801854:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801856:	5b                   	pop    %ebx
+  801857:	5e                   	pop    %esi
+  801858:	5f                   	pop    %edi
+  801859:	5d                   	pop    %ebp
+  80185a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80185b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801861:	b8 21 00 00 00       	mov    $0x21,%eax
+  801866:	bf 00 00 00 00       	mov    $0x0,%edi
+  80186b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	8d 35 79 18 80 00    	lea    0x801879,%esi
+  801877:	0f 34                	sysenter
+  801879:	5d                   	pop    %ebp
+		goto out;
+  80187a:	eb da                	jmp    801856 <sys_meminfo+0x26>
+
+0080187c <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80187c:	55                   	push   %ebp
+  80187d:	89 e5                	mov    %esp,%ebp
+  80187f:	57                   	push   %edi
+  801880:	56                   	push   %esi
+  801881:	53                   	push   %ebx
+  801882:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801885:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801889:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801890:	74 1f                	je     8018b1 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801892:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801897:	b8 22 00 00 00       	mov    $0x22,%eax
+  80189c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189f:	89 df                	mov    %ebx,%edi
+  8018a1:	89 de                	mov    %ebx,%esi
+  8018a3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018a5:	85 c0                	test   %eax,%eax
+  8018a7:	7f 25                	jg     8018ce <sys_env_set_ksm+0x52>
+}
+  8018a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ac:	5b                   	pop    %ebx
+  8018ad:	5e                   	pop    %esi
+  8018ae:	5f                   	pop    %edi
+  8018af:	5d                   	pop    %ebp
+  8018b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b9:	b8 22 00 00 00       	mov    $0x22,%eax
+  8018be:	89 df                	mov    %ebx,%edi
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	8d 35 cb 18 80 00    	lea    0x8018cb,%esi
+  8018c9:	0f 34                	sysenter
+  8018cb:	5d                   	pop    %ebp
+		goto out;
+  8018cc:	eb d7                	jmp    8018a5 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018ce:	83 ec 0c             	sub    $0xc,%esp
+  8018d1:	50                   	push   %eax
+  8018d2:	6a 22                	push   $0x22
+  8018d4:	68 4b 3c 80 00       	push   $0x803c4b
+  8018d9:	6a 3f                	push   $0x3f
+  8018db:	68 68 3c 80 00       	push   $0x803c68
+  8018e0:	e8 6c eb ff ff       	call   800451 <_panic>
+
+008018e5 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8018e5:	55                   	push   %ebp
+  8018e6:	89 e5                	mov    %esp,%ebp
+  8018e8:	57                   	push   %edi
+  8018e9:	56                   	push   %esi
+  8018ea:	53                   	push   %ebx
+  8018eb:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8018ee:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8018f1:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8018f8:	74 24                	je     80191e <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8018fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801904:	89 cb                	mov    %ecx,%ebx
+  801906:	89 cf                	mov    %ecx,%edi
+  801908:	89 ce                	mov    %ecx,%esi
+  80190a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80190c:	85 c0                	test   %eax,%eax
+  80190e:	7f 2a                	jg     80193a <sys_time_nsec+0x55>
+	return ns;
+}
+  801910:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801913:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801916:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801919:	5b                   	pop    %ebx
+  80191a:	5e                   	pop    %esi
+  80191b:	5f                   	pop    %edi
+  80191c:	5d                   	pop    %ebp
+  80191d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80191e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801923:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801928:	89 cb                	mov    %ecx,%ebx
+  80192a:	89 cf                	mov    %ecx,%edi
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	8d 35 37 19 80 00    	lea    0x801937,%esi
+  801935:	0f 34                	sysenter
+  801937:	5d                   	pop    %ebp
+		goto out;
+  801938:	eb d2                	jmp    80190c <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80193a:	83 ec 0c             	sub    $0xc,%esp
+  80193d:	50                   	push   %eax
+  80193e:	6a 0f                	push   $0xf
+  801940:	68 4b 3c 80 00       	push   $0x803c4b
+  801945:	6a 3f                	push   $0x3f
+  801947:	68 68 3c 80 00       	push   $0x803c68
+  80194c:	e8 00 eb ff ff       	call   800451 <_panic>
+
+00801951 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	57                   	push   %edi
+  801955:	56                   	push   %esi
+  801956:	53                   	push   %ebx
+  801957:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80195a:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801961:	74 22                	je     801985 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801963:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801968:	b8 12 00 00 00       	mov    $0x12,%eax
+  80196d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801970:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801973:	89 df                	mov    %ebx,%edi
+  801975:	89 de                	mov    %ebx,%esi
+  801977:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	7f 28                	jg     8019a5 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80197d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801980:	5b                   	pop    %ebx
+  801981:	5e                   	pop    %esi
+  801982:	5f                   	pop    %edi
+  801983:	5d                   	pop    %ebp
+  801984:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801985:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80198d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801990:	b8 12 00 00 00       	mov    $0x12,%eax
+  801995:	89 df                	mov    %ebx,%edi
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	8d 35 a2 19 80 00    	lea    0x8019a2,%esi
+  8019a0:	0f 34                	sysenter
+  8019a2:	5d                   	pop    %ebp
+		goto out;
+  8019a3:	eb d4                	jmp    801979 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019a5:	83 ec 0c             	sub    $0xc,%esp
+  8019a8:	50                   	push   %eax
+  8019a9:	6a 12                	push   $0x12
+  8019ab:	68 4b 3c 80 00       	push   $0x803c4b
+  8019b0:	6a 3f                	push   $0x3f
+  8019b2:	68 68 3c 80 00       	push   $0x803c68
+  8019b7:	e8 95 ea ff ff       	call   800451 <_panic>
+
+008019bc <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8019bc:	55                   	push   %ebp
+  8019bd:	89 e5                	mov    %esp,%ebp
+  8019bf:	57                   	push   %edi
+  8019c0:	56                   	push   %esi
+  8019c1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019c2:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  8019c9:	74 1b                	je     8019e6 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8019cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019db:	89 df                	mov    %ebx,%edi
+  8019dd:	89 de                	mov    %ebx,%esi
+  8019df:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8019e1:	5b                   	pop    %ebx
+  8019e2:	5e                   	pop    %esi
+  8019e3:	5f                   	pop    %edi
+  8019e4:	5d                   	pop    %ebp
+  8019e5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019f6:	89 df                	mov    %ebx,%edi
+  8019f8:	55                   	push   %ebp
+  8019f9:	89 e5                	mov    %esp,%ebp
+  8019fb:	8d 35 03 1a 80 00    	lea    0x801a03,%esi
+  801a01:	0f 34                	sysenter
+  801a03:	5d                   	pop    %ebp
+		goto out;
+  801a04:	eb db                	jmp    8019e1 <sys_e1000_receive+0x25>
+
+00801a06 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801a06:	55                   	push   %ebp
+  801a07:	89 e5                	mov    %esp,%ebp
+  801a09:	57                   	push   %edi
+  801a0a:	56                   	push   %esi
+  801a0b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a0c:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801a13:	74 1b                	je     801a30 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801a15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1a:	b8 14 00 00 00       	mov    $0x14,%eax
+  801a1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a25:	89 df                	mov    %ebx,%edi
+  801a27:	89 de                	mov    %ebx,%esi
+  801a29:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801a2b:	5b                   	pop    %ebx
+  801a2c:	5e                   	pop    %esi
+  801a2d:	5f                   	pop    %edi
+  801a2e:	5d                   	pop    %ebp
+  801a2f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a3b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801a40:	89 df                	mov    %ebx,%edi
+  801a42:	55                   	push   %ebp
+  801a43:	89 e5                	mov    %esp,%ebp
+  801a45:	8d 35 4d 1a 80 00    	lea    0x801a4d,%esi
+  801a4b:	0f 34                	sysenter
+  801a4d:	5d                   	pop    %ebp
+		goto out;
+  801a4e:	eb db                	jmp    801a2b <sys_e1000_read_hwaddr+0x25>
+
+00801a50 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	57                   	push   %edi
+  801a54:	56                   	push   %esi
+  801a55:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a56:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801a5d:	74 1a                	je     801a79 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801a5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a64:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a69:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6c:	89 cb                	mov    %ecx,%ebx
+  801a6e:	89 cf                	mov    %ecx,%edi
+  801a70:	89 ce                	mov    %ecx,%esi
+  801a72:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801a74:	5b                   	pop    %ebx
+  801a75:	5e                   	pop    %esi
+  801a76:	5f                   	pop    %edi
+  801a77:	5d                   	pop    %ebp
+  801a78:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a79:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a81:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a86:	89 cb                	mov    %ecx,%ebx
+  801a88:	89 cf                	mov    %ecx,%edi
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	8d 35 95 1a 80 00    	lea    0x801a95,%esi
+  801a93:	0f 34                	sysenter
+  801a95:	5d                   	pop    %ebp
+		goto out;
+  801a96:	eb dc                	jmp    801a74 <sys_sb16_read_version+0x24>
+
+00801a98 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801a98:	55                   	push   %ebp
+  801a99:	89 e5                	mov    %esp,%ebp
+  801a9b:	57                   	push   %edi
+  801a9c:	56                   	push   %esi
+  801a9d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a9e:	80 3d 04 60 84 00 00 	cmpb   $0x0,0x846004
+  801aa5:	74 1b                	je     801ac2 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801aa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aac:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ab1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ab7:	89 df                	mov    %ebx,%edi
+  801ab9:	89 de                	mov    %ebx,%esi
+  801abb:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801abd:	5b                   	pop    %ebx
+  801abe:	5e                   	pop    %esi
+  801abf:	5f                   	pop    %edi
+  801ac0:	5d                   	pop    %ebp
+  801ac1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ac2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801acd:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ad2:	89 df                	mov    %ebx,%edi
+  801ad4:	55                   	push   %ebp
+  801ad5:	89 e5                	mov    %esp,%ebp
+  801ad7:	8d 35 df 1a 80 00    	lea    0x801adf,%esi
+  801add:	0f 34                	sysenter
+  801adf:	5d                   	pop    %ebp
+		goto out;
+  801ae0:	eb db                	jmp    801abd <sys_sb16_play+0x25>
+
+00801ae2 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801ae2:	55                   	push   %ebp
+  801ae3:	89 e5                	mov    %esp,%ebp
+  801ae5:	53                   	push   %ebx
+  801ae6:	83 ec 04             	sub    $0x4,%esp
+  801ae9:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801aeb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801af2:	f6 c4 04             	test   $0x4,%ah
+  801af5:	74 0c                	je     801b03 <dupperm+0x21>
+  801af7:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801afe:	f6 c4 08             	test   $0x8,%ah
+  801b01:	75 62                	jne    801b65 <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801b03:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801b0a:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801b0f:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801b15:	74 19                	je     801b30 <dupperm+0x4e>
+  801b17:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801b1e:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801b23:	83 f8 01             	cmp    $0x1,%eax
+  801b26:	19 c0                	sbb    %eax,%eax
+  801b28:	25 00 08 00 00       	and    $0x800,%eax
+  801b2d:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801b30:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  801b37:	89 c1                	mov    %eax,%ecx
+  801b39:	80 cd 04             	or     $0x4,%ch
+  801b3c:	f6 c7 04             	test   $0x4,%bh
+  801b3f:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801b42:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801b49:	f6 c1 02             	test   $0x2,%cl
+  801b4c:	74 12                	je     801b60 <dupperm+0x7e>
+  801b4e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801b55:	89 c2                	mov    %eax,%edx
+  801b57:	83 ca 02             	or     $0x2,%edx
+  801b5a:	f6 c5 04             	test   $0x4,%ch
+  801b5d:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801b60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b63:	c9                   	leave
+  801b64:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801b65:	68 78 3c 80 00       	push   $0x803c78
+  801b6a:	68 10 3d 80 00       	push   $0x803d10
+  801b6f:	6a 39                	push   $0x39
+  801b71:	68 25 3d 80 00       	push   $0x803d25
+  801b76:	e8 d6 e8 ff ff       	call   800451 <_panic>
+
+00801b7b <pgfault>:
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	53                   	push   %ebx
+  801b7f:	83 ec 04             	sub    $0x4,%esp
+  801b82:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801b85:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b87:	89 c3                	mov    %eax,%ebx
+  801b89:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801b8f:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801b93:	74 6d                	je     801c02 <pgfault+0x87>
+  801b95:	89 da                	mov    %ebx,%edx
+  801b97:	c1 ea 16             	shr    $0x16,%edx
+  801b9a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ba1:	f6 c2 80             	test   $0x80,%dl
+  801ba4:	75 5c                	jne    801c02 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801ba6:	c1 e8 0c             	shr    $0xc,%eax
+  801ba9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801bb0:	f6 c4 08             	test   $0x8,%ah
+  801bb3:	74 4d                	je     801c02 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801bb5:	83 ec 04             	sub    $0x4,%esp
+  801bb8:	6a 07                	push   $0x7
+  801bba:	68 00 f0 7f 00       	push   $0x7ff000
+  801bbf:	6a 00                	push   $0x0
+  801bc1:	e8 a6 f4 ff ff       	call   80106c <sys_page_alloc>
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	78 49                	js     801c16 <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801bcd:	83 ec 04             	sub    $0x4,%esp
+  801bd0:	68 00 10 00 00       	push   $0x1000
+  801bd5:	53                   	push   %ebx
+  801bd6:	68 00 f0 7f 00       	push   $0x7ff000
+  801bdb:	e8 1a f1 ff ff       	call   800cfa <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801be0:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801be7:	53                   	push   %ebx
+  801be8:	6a 00                	push   $0x0
+  801bea:	68 00 f0 7f 00       	push   $0x7ff000
+  801bef:	6a 00                	push   $0x0
+  801bf1:	e8 e3 f4 ff ff       	call   8010d9 <sys_page_map>
+  801bf6:	83 c4 20             	add    $0x20,%esp
+  801bf9:	85 c0                	test   %eax,%eax
+  801bfb:	78 2d                	js     801c2a <pgfault+0xaf>
+}
+  801bfd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c00:	c9                   	leave
+  801c01:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801c02:	83 ec 04             	sub    $0x4,%esp
+  801c05:	68 30 3d 80 00       	push   $0x803d30
+  801c0a:	6a 1e                	push   $0x1e
+  801c0c:	68 25 3d 80 00       	push   $0x803d25
+  801c11:	e8 3b e8 ff ff       	call   800451 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801c16:	83 ec 04             	sub    $0x4,%esp
+  801c19:	68 ac 3c 80 00       	push   $0x803cac
+  801c1e:	6a 29                	push   $0x29
+  801c20:	68 25 3d 80 00       	push   $0x803d25
+  801c25:	e8 27 e8 ff ff       	call   800451 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801c2a:	50                   	push   %eax
+  801c2b:	68 e0 3c 80 00       	push   $0x803ce0
+  801c30:	6a 2e                	push   $0x2e
+  801c32:	68 25 3d 80 00       	push   $0x803d25
+  801c37:	e8 15 e8 ff ff       	call   800451 <_panic>
+
+00801c3c <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+  801c3f:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801c42:	ff 75 0c             	push   0xc(%ebp)
+  801c45:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801c48:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801c4f:	e8 23 f3 ff ff       	call   800f77 <sys_env_destroy>
+}
+  801c54:	83 c4 10             	add    $0x10,%esp
+  801c57:	c9                   	leave
+  801c58:	c3                   	ret
+
+00801c59 <ufork>:
+{
+  801c59:	55                   	push   %ebp
+  801c5a:	89 e5                	mov    %esp,%ebp
+  801c5c:	57                   	push   %edi
+  801c5d:	56                   	push   %esi
+  801c5e:	53                   	push   %ebx
+  801c5f:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801c65:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c6a:	cd 30                	int    $0x30
+  801c6c:	89 c6                	mov    %eax,%esi
+  801c6e:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801c74:	85 c0                	test   %eax,%eax
+  801c76:	78 56                	js     801cce <ufork+0x75>
+	if (pid > 0) {
+  801c78:	0f 8e b3 02 00 00    	jle    801f31 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801c7e:	83 ec 0c             	sub    $0xc,%esp
+  801c81:	68 7b 1b 80 00       	push   $0x801b7b
+  801c86:	e8 1c 1a 00 00       	call   8036a7 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801c8b:	83 c4 08             	add    $0x8,%esp
+  801c8e:	68 0e 37 80 00       	push   $0x80370e
+  801c93:	56                   	push   %esi
+  801c94:	e8 ef f5 ff ff       	call   801288 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801c99:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801c9f:	89 1c 24             	mov    %ebx,(%esp)
+  801ca2:	e8 a1 04 00 00       	call   802148 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801ca7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801cae:	6a 07                	push   $0x7
+  801cb0:	68 00 f0 bf ee       	push   $0xeebff000
+  801cb5:	56                   	push   %esi
+  801cb6:	53                   	push   %ebx
+  801cb7:	e8 0d 06 00 00       	call   8022c9 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801cbc:	83 c4 20             	add    $0x20,%esp
+  801cbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc4:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801cca:	89 fe                	mov    %edi,%esi
+  801ccc:	eb 22                	jmp    801cf0 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801cce:	50                   	push   %eax
+  801ccf:	68 49 3d 80 00       	push   $0x803d49
+  801cd4:	68 a9 00 00 00       	push   $0xa9
+  801cd9:	68 25 3d 80 00       	push   $0x803d25
+  801cde:	e8 6e e7 ff ff       	call   800451 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801ce3:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801ce9:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801cee:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801cf0:	89 f7                	mov    %esi,%edi
+  801cf2:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801cf8:	0f 87 e9 01 00 00    	ja     801ee7 <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801cfe:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801d04:	85 f6                	test   %esi,%esi
+  801d06:	0f 49 d6             	cmovns %esi,%edx
+  801d09:	c1 fa 0a             	sar    $0xa,%edx
+  801d0c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801d13:	f6 c1 01             	test   $0x1,%cl
+  801d16:	74 cb                	je     801ce3 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801d18:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d1f:	f6 c2 80             	test   $0x80,%dl
+  801d22:	75 17                	jne    801d3b <ufork+0xe2>
+			j = i + 1;
+  801d24:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801d27:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801d2e:	f6 c2 01             	test   $0x1,%dl
+  801d31:	0f 85 f3 00 00 00    	jne    801e2a <ufork+0x1d1>
+			j = i + 1;
+  801d37:	89 de                	mov    %ebx,%esi
+  801d39:	eb b5                	jmp    801cf0 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801d3b:	89 fb                	mov    %edi,%ebx
+  801d3d:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801d40:	89 d8                	mov    %ebx,%eax
+  801d42:	c1 e8 16             	shr    $0x16,%eax
+  801d45:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d4c:	89 c2                	mov    %eax,%edx
+  801d4e:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801d54:	25 02 04 00 00       	and    $0x402,%eax
+  801d59:	83 f8 02             	cmp    $0x2,%eax
+  801d5c:	74 31                	je     801d8f <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801d5e:	83 ec 04             	sub    $0x4,%esp
+  801d61:	6a 01                	push   $0x1
+  801d63:	52                   	push   %edx
+  801d64:	53                   	push   %ebx
+  801d65:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801d6b:	53                   	push   %ebx
+  801d6c:	6a 00                	push   $0x0
+  801d6e:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d74:	50                   	push   %eax
+  801d75:	e8 7a 05 00 00       	call   8022f4 <batch_map>
+		return;
+  801d7a:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801d7d:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801d83:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801d88:	89 c6                	mov    %eax,%esi
+				continue;
+  801d8a:	e9 61 ff ff ff       	jmp    801cf0 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801d8f:	83 ec 04             	sub    $0x4,%esp
+  801d92:	80 ca 80             	or     $0x80,%dl
+  801d95:	52                   	push   %edx
+  801d96:	53                   	push   %ebx
+  801d97:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801d9d:	e8 ca f2 ff ff       	call   80106c <sys_page_alloc>
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	78 5d                	js     801e06 <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801da9:	83 ec 0c             	sub    $0xc,%esp
+  801dac:	6a 07                	push   $0x7
+  801dae:	68 00 00 40 00       	push   $0x400000
+  801db3:	6a 00                	push   $0x0
+  801db5:	53                   	push   %ebx
+  801db6:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801dbc:	e8 18 f3 ff ff       	call   8010d9 <sys_page_map>
+  801dc1:	83 c4 20             	add    $0x20,%esp
+  801dc4:	85 c0                	test   %eax,%eax
+  801dc6:	78 50                	js     801e18 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801dc8:	83 ec 04             	sub    $0x4,%esp
+  801dcb:	68 00 00 40 00       	push   $0x400000
+  801dd0:	53                   	push   %ebx
+  801dd1:	68 00 00 40 00       	push   $0x400000
+  801dd6:	e8 1f ef ff ff       	call   800cfa <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801ddb:	83 c4 08             	add    $0x8,%esp
+  801dde:	68 00 00 40 00       	push   $0x400000
+  801de3:	6a 00                	push   $0x0
+  801de5:	e8 5d f3 ff ff       	call   801147 <sys_page_unmap>
+  801dea:	83 c4 10             	add    $0x10,%esp
+  801ded:	85 c0                	test   %eax,%eax
+  801def:	79 8c                	jns    801d7d <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801df1:	50                   	push   %eax
+  801df2:	68 6a 3d 80 00       	push   $0x803d6a
+  801df7:	68 81 00 00 00       	push   $0x81
+  801dfc:	68 25 3d 80 00       	push   $0x803d25
+  801e01:	e8 4b e6 ff ff       	call   800451 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801e06:	50                   	push   %eax
+  801e07:	68 aa 37 80 00       	push   $0x8037aa
+  801e0c:	6a 7c                	push   $0x7c
+  801e0e:	68 25 3d 80 00       	push   $0x803d25
+  801e13:	e8 39 e6 ff ff       	call   800451 <_panic>
+		panic("sys_page_map: %e", r);
+  801e18:	50                   	push   %eax
+  801e19:	68 59 3d 80 00       	push   $0x803d59
+  801e1e:	6a 7e                	push   $0x7e
+  801e20:	68 25 3d 80 00       	push   $0x803d25
+  801e25:	e8 27 e6 ff ff       	call   800451 <_panic>
+  801e2a:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801e30:	eb 22                	jmp    801e54 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801e32:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801e39:	a8 01                	test   $0x1,%al
+  801e3b:	74 35                	je     801e72 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801e3d:	89 d8                	mov    %ebx,%eax
+  801e3f:	e8 9e fc ff ff       	call   801ae2 <dupperm>
+  801e44:	89 c6                	mov    %eax,%esi
+  801e46:	89 f8                	mov    %edi,%eax
+  801e48:	e8 95 fc ff ff       	call   801ae2 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801e4d:	39 c6                	cmp    %eax,%esi
+  801e4f:	75 21                	jne    801e72 <ufork+0x219>
+				j++;
+  801e51:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801e54:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801e5a:	74 16                	je     801e72 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801e5c:	89 d8                	mov    %ebx,%eax
+  801e5e:	c1 e8 0a             	shr    $0xa,%eax
+  801e61:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e68:	25 81 00 00 00       	and    $0x81,%eax
+  801e6d:	83 f8 01             	cmp    $0x1,%eax
+  801e70:	74 c0                	je     801e32 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801e72:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801e78:	89 d8                	mov    %ebx,%eax
+  801e7a:	29 f0                	sub    %esi,%eax
+  801e7c:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801e82:	89 fe                	mov    %edi,%esi
+  801e84:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801e87:	89 f8                	mov    %edi,%eax
+  801e89:	e8 54 fc ff ff       	call   801ae2 <dupperm>
+  801e8e:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801e90:	83 ec 08             	sub    $0x8,%esp
+  801e93:	6a 02                	push   $0x2
+  801e95:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801e9b:	51                   	push   %ecx
+  801e9c:	e8 15 03 00 00       	call   8021b6 <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801ea1:	83 c4 0c             	add    $0xc,%esp
+  801ea4:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801eaa:	57                   	push   %edi
+  801eab:	56                   	push   %esi
+  801eac:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801eb2:	56                   	push   %esi
+  801eb3:	6a 00                	push   $0x0
+  801eb5:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801ebb:	51                   	push   %ecx
+  801ebc:	e8 33 04 00 00       	call   8022f4 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801ec1:	83 c4 1c             	add    $0x1c,%esp
+  801ec4:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801eca:	57                   	push   %edi
+  801ecb:	56                   	push   %esi
+  801ecc:	6a 00                	push   $0x0
+  801ece:	56                   	push   %esi
+  801ecf:	6a 00                	push   $0x0
+  801ed1:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801ed7:	50                   	push   %eax
+  801ed8:	e8 17 04 00 00       	call   8022f4 <batch_map>
+	return 0;
+  801edd:	83 c4 20             	add    $0x20,%esp
+  801ee0:	89 de                	mov    %ebx,%esi
+  801ee2:	e9 09 fe ff ff       	jmp    801cf0 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801ee7:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801eed:	83 ec 04             	sub    $0x4,%esp
+  801ef0:	6a 02                	push   $0x2
+  801ef2:	56                   	push   %esi
+  801ef3:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801ef9:	53                   	push   %ebx
+  801efa:	e8 49 04 00 00       	call   802348 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801eff:	89 1c 24             	mov    %ebx,(%esp)
+  801f02:	e8 5d 02 00 00       	call   802164 <batch_flush>
+  801f07:	83 c4 10             	add    $0x10,%esp
+  801f0a:	85 c0                	test   %eax,%eax
+  801f0c:	78 0e                	js     801f1c <ufork+0x2c3>
+}
+  801f0e:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801f14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f17:	5b                   	pop    %ebx
+  801f18:	5e                   	pop    %esi
+  801f19:	5f                   	pop    %edi
+  801f1a:	5d                   	pop    %ebp
+  801f1b:	c3                   	ret
+			panic("fork: %e", r);
+  801f1c:	50                   	push   %eax
+  801f1d:	68 50 3d 80 00       	push   $0x803d50
+  801f22:	68 d7 00 00 00       	push   $0xd7
+  801f27:	68 25 3d 80 00       	push   $0x803d25
+  801f2c:	e8 20 e5 ff ff       	call   800451 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801f31:	e8 aa f0 ff ff       	call   800fe0 <sys_getenvid>
+  801f36:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f3b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f41:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801f46:	a3 00 60 84 00       	mov    %eax,0x846000
+		return 0;
+  801f4b:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801f52:	00 00 00 
+  801f55:	eb b7                	jmp    801f0e <ufork+0x2b5>
+
+00801f57 <fork>:
+{
+  801f57:	55                   	push   %ebp
+  801f58:	89 e5                	mov    %esp,%ebp
+  801f5a:	53                   	push   %ebx
+  801f5b:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801f5e:	68 7b 1b 80 00       	push   $0x801b7b
+  801f63:	e8 3f 17 00 00       	call   8036a7 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801f68:	e8 7a f6 ff ff       	call   8015e7 <sys_fork>
+  801f6d:	89 c3                	mov    %eax,%ebx
+  801f6f:	83 c4 10             	add    $0x10,%esp
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	78 09                	js     801f7f <fork+0x28>
+	if (pid == 0)
+  801f76:	74 1c                	je     801f94 <fork+0x3d>
+}
+  801f78:	89 d8                	mov    %ebx,%eax
+  801f7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f7d:	c9                   	leave
+  801f7e:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801f7f:	50                   	push   %eax
+  801f80:	68 49 3d 80 00       	push   $0x803d49
+  801f85:	68 ed 00 00 00       	push   $0xed
+  801f8a:	68 25 3d 80 00       	push   $0x803d25
+  801f8f:	e8 bd e4 ff ff       	call   800451 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801f94:	e8 47 f0 ff ff       	call   800fe0 <sys_getenvid>
+  801f99:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f9e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801fa4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fa9:	a3 00 60 84 00       	mov    %eax,0x846000
+	return pid;
+  801fae:	eb c8                	jmp    801f78 <fork+0x21>
+
+00801fb0 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801fb6:	ff 75 0c             	push   0xc(%ebp)
+  801fb9:	ff 75 08             	push   0x8(%ebp)
+  801fbc:	68 3c 1c 80 00       	push   $0x801c3c
+  801fc1:	e8 67 f6 ff ff       	call   80162d <sys_thread_create>
+}
+  801fc6:	c9                   	leave
+  801fc7:	c3                   	ret
+
+00801fc8 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801fc8:	55                   	push   %ebp
+  801fc9:	89 e5                	mov    %esp,%ebp
+  801fcb:	56                   	push   %esi
+  801fcc:	53                   	push   %ebx
+  801fcd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fd0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801fd6:	85 c0                	test   %eax,%eax
+  801fd8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801fdd:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801fe0:	83 ec 08             	sub    $0x8,%esp
+  801fe3:	ff 75 14             	push   0x14(%ebp)
+  801fe6:	50                   	push   %eax
+  801fe7:	e8 91 f4 ff ff       	call   80147d <sys_ipc_recv_until>
+  801fec:	83 c4 10             	add    $0x10,%esp
+  801fef:	85 c0                	test   %eax,%eax
+  801ff1:	78 61                	js     802054 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801ff3:	85 f6                	test   %esi,%esi
+  801ff5:	74 1c                	je     802013 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801ff7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ff9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ffe:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802004:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802009:	76 5f                	jbe    80206a <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  80200b:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802011:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802013:	85 db                	test   %ebx,%ebx
+  802015:	74 1c                	je     802033 <ipc_recv_until+0x6b>
+  802017:	89 e0                	mov    %esp,%eax
+  802019:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80201e:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802024:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802029:	76 50                	jbe    80207b <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80202b:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802031:	89 03                	mov    %eax,(%ebx)
+  802033:	89 e0                	mov    %esp,%eax
+  802035:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80203a:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802040:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802045:	76 45                	jbe    80208c <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802047:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80204d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802050:	5b                   	pop    %ebx
+  802051:	5e                   	pop    %esi
+  802052:	5d                   	pop    %ebp
+  802053:	c3                   	ret
+		if (from_env_store)
+  802054:	85 f6                	test   %esi,%esi
+  802056:	74 06                	je     80205e <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802058:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  80205e:	85 db                	test   %ebx,%ebx
+  802060:	74 eb                	je     80204d <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802062:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802068:	eb e3                	jmp    80204d <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80206a:	c1 e8 10             	shr    $0x10,%eax
+  80206d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802073:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802079:	eb 90                	jmp    80200b <ipc_recv_until+0x43>
+  80207b:	c1 e8 10             	shr    $0x10,%eax
+  80207e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802084:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80208a:	eb 9f                	jmp    80202b <ipc_recv_until+0x63>
+  80208c:	c1 e8 10             	shr    $0x10,%eax
+  80208f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802095:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80209b:	eb aa                	jmp    802047 <ipc_recv_until+0x7f>
+
+0080209d <ipc_recv>:
+{
+  80209d:	55                   	push   %ebp
+  80209e:	89 e5                	mov    %esp,%ebp
+  8020a0:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8020a3:	6a 00                	push   $0x0
+  8020a5:	ff 75 10             	push   0x10(%ebp)
+  8020a8:	ff 75 0c             	push   0xc(%ebp)
+  8020ab:	ff 75 08             	push   0x8(%ebp)
+  8020ae:	e8 15 ff ff ff       	call   801fc8 <ipc_recv_until>
+}
+  8020b3:	c9                   	leave
+  8020b4:	c3                   	ret
+
+008020b5 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8020b5:	55                   	push   %ebp
+  8020b6:	89 e5                	mov    %esp,%ebp
+  8020b8:	57                   	push   %edi
+  8020b9:	56                   	push   %esi
+  8020ba:	53                   	push   %ebx
+  8020bb:	83 ec 0c             	sub    $0xc,%esp
+  8020be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8020c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8020c7:	85 db                	test   %ebx,%ebx
+  8020c9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8020ce:	0f 44 d8             	cmove  %eax,%ebx
+  8020d1:	eb 05                	jmp    8020d8 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8020d3:	e8 4e ef ff ff       	call   801026 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8020d8:	ff 75 14             	push   0x14(%ebp)
+  8020db:	53                   	push   %ebx
+  8020dc:	56                   	push   %esi
+  8020dd:	57                   	push   %edi
+  8020de:	e8 e6 f2 ff ff       	call   8013c9 <sys_ipc_try_send>
+  8020e3:	83 c4 10             	add    $0x10,%esp
+  8020e6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8020e9:	74 e8                	je     8020d3 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 08                	js     8020f7 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8020ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020f2:	5b                   	pop    %ebx
+  8020f3:	5e                   	pop    %esi
+  8020f4:	5f                   	pop    %edi
+  8020f5:	5d                   	pop    %ebp
+  8020f6:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8020f7:	50                   	push   %eax
+  8020f8:	68 7d 3d 80 00       	push   $0x803d7d
+  8020fd:	6a 4f                	push   $0x4f
+  8020ff:	68 90 3d 80 00       	push   $0x803d90
+  802104:	e8 48 e3 ff ff       	call   800451 <_panic>
+
+00802109 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802109:	55                   	push   %ebp
+  80210a:	89 e5                	mov    %esp,%ebp
+  80210c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80210f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802114:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80211a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802120:	8b 52 50             	mov    0x50(%edx),%edx
+  802123:	39 ca                	cmp    %ecx,%edx
+  802125:	74 11                	je     802138 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802127:	83 c0 01             	add    $0x1,%eax
+  80212a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80212f:	75 e3                	jne    802114 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802131:	b8 00 00 00 00       	mov    $0x0,%eax
+  802136:	eb 0e                	jmp    802146 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802138:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80213e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802143:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802146:	5d                   	pop    %ebp
+  802147:	c3                   	ret
+
+00802148 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  80214e:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  802155:	00 00 00 
+	b->b_error = 0;
+  802158:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  80215f:	00 00 00 
+}
+  802162:	5d                   	pop    %ebp
+  802163:	c3                   	ret
+
+00802164 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	53                   	push   %ebx
+  802168:	83 ec 04             	sub    $0x4,%esp
+  80216b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  80216e:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  802174:	85 c0                	test   %eax,%eax
+  802176:	7e 09                	jle    802181 <batch_flush+0x1d>
+  802178:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  80217f:	74 15                	je     802196 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  802181:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  802188:	00 00 00 
+	return b->b_error;
+  80218b:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  802191:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802194:	c9                   	leave
+  802195:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  802196:	83 ec 08             	sub    $0x8,%esp
+  802199:	50                   	push   %eax
+  80219a:	53                   	push   %ebx
+  80219b:	e8 b2 f5 ff ff       	call   801752 <sys_batch>
+  8021a0:	83 c4 10             	add    $0x10,%esp
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	79 da                	jns    802181 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  8021a7:	f7 d8                	neg    %eax
+  8021a9:	0f b6 c0             	movzbl %al,%eax
+  8021ac:	f7 d8                	neg    %eax
+  8021ae:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  8021b4:	eb cb                	jmp    802181 <batch_flush+0x1d>
+
+008021b6 <batch_reserve>:
+{
+  8021b6:	55                   	push   %ebp
+  8021b7:	89 e5                	mov    %esp,%ebp
+  8021b9:	83 ec 08             	sub    $0x8,%esp
+  8021bc:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  8021bf:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  8021c5:	03 45 0c             	add    0xc(%ebp),%eax
+  8021c8:	83 f8 10             	cmp    $0x10,%eax
+  8021cb:	7f 02                	jg     8021cf <batch_reserve+0x19>
+}
+  8021cd:	c9                   	leave
+  8021ce:	c3                   	ret
+		batch_flush(b);
+  8021cf:	83 ec 0c             	sub    $0xc,%esp
+  8021d2:	52                   	push   %edx
+  8021d3:	e8 8c ff ff ff       	call   802164 <batch_flush>
+  8021d8:	83 c4 10             	add    $0x10,%esp
+}
+  8021db:	eb f0                	jmp    8021cd <batch_reserve+0x17>
+
+008021dd <batch_next>:
+{
+  8021dd:	55                   	push   %ebp
+  8021de:	89 e5                	mov    %esp,%ebp
+  8021e0:	53                   	push   %ebx
+  8021e1:	83 ec 04             	sub    $0x4,%esp
+  8021e4:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  8021e6:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  8021ed:	74 28                	je     802217 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  8021ef:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8021f5:	8d 50 01             	lea    0x1(%eax),%edx
+  8021f8:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  8021fe:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802201:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  802203:	83 ec 04             	sub    $0x4,%esp
+  802206:	6a 1c                	push   $0x1c
+  802208:	6a 00                	push   $0x0
+  80220a:	53                   	push   %ebx
+  80220b:	e8 b5 ea ff ff       	call   800cc5 <memset>
+}
+  802210:	89 d8                	mov    %ebx,%eax
+  802212:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802215:	c9                   	leave
+  802216:	c3                   	ret
+		batch_flush(b);
+  802217:	83 ec 0c             	sub    $0xc,%esp
+  80221a:	50                   	push   %eax
+  80221b:	e8 44 ff ff ff       	call   802164 <batch_flush>
+  802220:	83 c4 10             	add    $0x10,%esp
+  802223:	eb ca                	jmp    8021ef <batch_next+0x12>
+
+00802225 <batch_page>:
+{
+  802225:	55                   	push   %ebp
+  802226:	89 e5                	mov    %esp,%ebp
+  802228:	57                   	push   %edi
+  802229:	56                   	push   %esi
+  80222a:	53                   	push   %ebx
+  80222b:	83 ec 1c             	sub    $0x1c,%esp
+  80222e:	89 d3                	mov    %edx,%ebx
+  802230:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  802232:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  802238:	85 d2                	test   %edx,%edx
+  80223a:	74 50                	je     80228c <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  80223c:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  80223f:	01 c1                	add    %eax,%ecx
+  802241:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  802244:	75 46                	jne    80228c <batch_page+0x67>
+  802246:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  802249:	75 41                	jne    80228c <batch_page+0x67>
+  80224b:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  80224e:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  802251:	75 39                	jne    80228c <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  802253:	83 ea 01             	sub    $0x1,%edx
+  802256:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  802259:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  80225c:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  802260:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  802263:	75 27                	jne    80228c <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  802265:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  802268:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  80226c:	89 fa                	mov    %edi,%edx
+  80226e:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802271:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802274:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  802277:	39 55 08             	cmp    %edx,0x8(%ebp)
+  80227a:	75 10                	jne    80228c <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  80227c:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  802280:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802283:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  802287:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80228a:	74 2a                	je     8022b6 <batch_page+0x91>
+	op = batch_next(b);
+  80228c:	e8 4c ff ff ff       	call   8021dd <batch_next>
+	op->bo_op = opcode;
+  802291:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  802293:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  802296:	8b 75 08             	mov    0x8(%ebp),%esi
+  802299:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  80229c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80229f:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  8022a2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8022a5:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  8022a8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8022ab:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  8022ae:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8022b1:	89 78 14             	mov    %edi,0x14(%eax)
+  8022b4:	eb 0b                	jmp    8022c1 <batch_page+0x9c>
+		op->bo_npages += npages;
+  8022b6:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  8022ba:	03 7d 18             	add    0x18(%ebp),%edi
+  8022bd:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  8022c1:	83 c4 1c             	add    $0x1c,%esp
+  8022c4:	5b                   	pop    %ebx
+  8022c5:	5e                   	pop    %esi
+  8022c6:	5f                   	pop    %edi
+  8022c7:	5d                   	pop    %ebp
+  8022c8:	c3                   	ret
+
+008022c9 <batch_alloc>:
+{
+  8022c9:	55                   	push   %ebp
+  8022ca:	89 e5                	mov    %esp,%ebp
+  8022cc:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  8022cf:	ff 75 18             	push   0x18(%ebp)
+  8022d2:	ff 75 14             	push   0x14(%ebp)
+  8022d5:	ff 75 10             	push   0x10(%ebp)
+  8022d8:	ff 75 0c             	push   0xc(%ebp)
+  8022db:	6a 00                	push   $0x0
+  8022dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ea:	e8 36 ff ff ff       	call   802225 <batch_page>
+}
+  8022ef:	83 c4 20             	add    $0x20,%esp
+  8022f2:	c9                   	leave
+  8022f3:	c3                   	ret
+
+008022f4 <batch_map>:
+{
+  8022f4:	55                   	push   %ebp
+  8022f5:	89 e5                	mov    %esp,%ebp
+  8022f7:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  8022fa:	ff 75 20             	push   0x20(%ebp)
+  8022fd:	ff 75 1c             	push   0x1c(%ebp)
+  802300:	ff 75 18             	push   0x18(%ebp)
+  802303:	ff 75 14             	push   0x14(%ebp)
+  802306:	ff 75 10             	push   0x10(%ebp)
+  802309:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80230c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802311:	8b 45 08             	mov    0x8(%ebp),%eax
+  802314:	e8 0c ff ff ff       	call   802225 <batch_page>
+}
+  802319:	83 c4 20             	add    $0x20,%esp
+  80231c:	c9                   	leave
+  80231d:	c3                   	ret
+
+0080231e <batch_unmap>:
+{
+  80231e:	55                   	push   %ebp
+  80231f:	89 e5                	mov    %esp,%ebp
+  802321:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  802324:	ff 75 14             	push   0x14(%ebp)
+  802327:	6a 00                	push   $0x0
+  802329:	ff 75 10             	push   0x10(%ebp)
+  80232c:	ff 75 0c             	push   0xc(%ebp)
+  80232f:	6a 00                	push   $0x0
+  802331:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802336:	ba 02 00 00 00       	mov    $0x2,%edx
+  80233b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233e:	e8 e2 fe ff ff       	call   802225 <batch_page>
+}
+  802343:	83 c4 20             	add    $0x20,%esp
+  802346:	c9                   	leave
+  802347:	c3                   	ret
+
+00802348 <batch_set_status>:
+{
+  802348:	55                   	push   %ebp
+  802349:	89 e5                	mov    %esp,%ebp
+  80234b:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  80234e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802351:	e8 87 fe ff ff       	call   8021dd <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  802356:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  80235c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80235f:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  802362:	8b 55 10             	mov    0x10(%ebp),%edx
+  802365:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  802368:	c9                   	leave
+  802369:	c3                   	ret
+
+0080236a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80236a:	55                   	push   %ebp
+  80236b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80236d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802370:	05 00 00 00 30       	add    $0x30000000,%eax
+  802375:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802378:	5d                   	pop    %ebp
+  802379:	c3                   	ret
+
+0080237a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80237a:	55                   	push   %ebp
+  80237b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80237d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802380:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802385:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80238a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80238f:	5d                   	pop    %ebp
+  802390:	c3                   	ret
+
+00802391 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802391:	55                   	push   %ebp
+  802392:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802394:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802399:	eb 02                	jmp    80239d <fd_alloc+0xc>
+  80239b:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80239d:	89 c2                	mov    %eax,%edx
+  80239f:	c1 ea 16             	shr    $0x16,%edx
+  8023a2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8023a9:	f6 c2 01             	test   $0x1,%dl
+  8023ac:	74 2b                	je     8023d9 <fd_alloc+0x48>
+  8023ae:	89 c2                	mov    %eax,%edx
+  8023b0:	c1 ea 0c             	shr    $0xc,%edx
+  8023b3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8023ba:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8023c0:	f6 c1 01             	test   $0x1,%cl
+  8023c3:	74 14                	je     8023d9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8023c5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8023cb:	75 ce                	jne    80239b <fd_alloc+0xa>
+  8023cd:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8023d2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8023d7:	eb 05                	jmp    8023de <fd_alloc+0x4d>
+			return 0;
+  8023d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8023de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023e1:	89 02                	mov    %eax,(%edx)
+}
+  8023e3:	89 c8                	mov    %ecx,%eax
+  8023e5:	5d                   	pop    %ebp
+  8023e6:	c3                   	ret
+
+008023e7 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8023ed:	83 f8 1f             	cmp    $0x1f,%eax
+  8023f0:	77 30                	ja     802422 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8023f2:	c1 e0 0c             	shl    $0xc,%eax
+  8023f5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8023fa:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802400:	f6 c2 01             	test   $0x1,%dl
+  802403:	74 24                	je     802429 <fd_lookup+0x42>
+  802405:	89 c2                	mov    %eax,%edx
+  802407:	c1 ea 0c             	shr    $0xc,%edx
+  80240a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802411:	f6 c2 01             	test   $0x1,%dl
+  802414:	74 1a                	je     802430 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802416:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802419:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80241b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802420:	5d                   	pop    %ebp
+  802421:	c3                   	ret
+		return -E_INVAL;
+  802422:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802427:	eb f7                	jmp    802420 <fd_lookup+0x39>
+		return -E_INVAL;
+  802429:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80242e:	eb f0                	jmp    802420 <fd_lookup+0x39>
+  802430:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802435:	eb e9                	jmp    802420 <fd_lookup+0x39>
+
+00802437 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	53                   	push   %ebx
+  80243b:	83 ec 04             	sub    $0x4,%esp
+  80243e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+  802446:	eb 03                	jmp    80244b <dev_lookup+0x14>
+  802448:	83 c0 01             	add    $0x1,%eax
+  80244b:	8b 1c 85 18 3e 80 00 	mov    0x803e18(,%eax,4),%ebx
+  802452:	85 db                	test   %ebx,%ebx
+  802454:	74 0b                	je     802461 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802456:	39 13                	cmp    %edx,(%ebx)
+  802458:	75 ee                	jne    802448 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80245a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245f:	eb 2e                	jmp    80248f <dev_lookup+0x58>
+  802461:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802463:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802468:	8b 0d 00 60 84 00    	mov    0x846000,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80246e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802473:	76 24                	jbe    802499 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802475:	8b 41 48             	mov    0x48(%ecx),%eax
+  802478:	83 ec 04             	sub    $0x4,%esp
+  80247b:	52                   	push   %edx
+  80247c:	50                   	push   %eax
+  80247d:	68 9c 3d 80 00       	push   $0x803d9c
+  802482:	e8 a5 e0 ff ff       	call   80052c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802487:	83 c4 10             	add    $0x10,%esp
+  80248a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80248f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802492:	89 1a                	mov    %ebx,(%edx)
+}
+  802494:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802497:	c9                   	leave
+  802498:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802499:	c1 e8 10             	shr    $0x10,%eax
+  80249c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8024a2:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8024a8:	eb cb                	jmp    802475 <dev_lookup+0x3e>
+
+008024aa <fd_close>:
+{
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	57                   	push   %edi
+  8024ae:	56                   	push   %esi
+  8024af:	53                   	push   %ebx
+  8024b0:	83 ec 24             	sub    $0x24,%esp
+  8024b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024b6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8024b9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024bc:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8024bd:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8024c3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8024c6:	50                   	push   %eax
+  8024c7:	e8 1b ff ff ff       	call   8023e7 <fd_lookup>
+  8024cc:	89 c3                	mov    %eax,%ebx
+  8024ce:	83 c4 10             	add    $0x10,%esp
+  8024d1:	85 c0                	test   %eax,%eax
+  8024d3:	78 05                	js     8024da <fd_close+0x30>
+	    || fd != fd2)
+  8024d5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8024d8:	74 16                	je     8024f0 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8024da:	89 f8                	mov    %edi,%eax
+  8024dc:	84 c0                	test   %al,%al
+  8024de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8024e6:	89 d8                	mov    %ebx,%eax
+  8024e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024eb:	5b                   	pop    %ebx
+  8024ec:	5e                   	pop    %esi
+  8024ed:	5f                   	pop    %edi
+  8024ee:	5d                   	pop    %ebp
+  8024ef:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8024f0:	83 ec 08             	sub    $0x8,%esp
+  8024f3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8024f6:	50                   	push   %eax
+  8024f7:	ff 36                	push   (%esi)
+  8024f9:	e8 39 ff ff ff       	call   802437 <dev_lookup>
+  8024fe:	89 c3                	mov    %eax,%ebx
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	85 c0                	test   %eax,%eax
+  802505:	78 1a                	js     802521 <fd_close+0x77>
+		if (dev->dev_close)
+  802507:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80250a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80250d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802512:	85 c0                	test   %eax,%eax
+  802514:	74 0b                	je     802521 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802516:	83 ec 0c             	sub    $0xc,%esp
+  802519:	56                   	push   %esi
+  80251a:	ff d0                	call   *%eax
+  80251c:	89 c3                	mov    %eax,%ebx
+  80251e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802521:	83 ec 08             	sub    $0x8,%esp
+  802524:	56                   	push   %esi
+  802525:	6a 00                	push   $0x0
+  802527:	e8 1b ec ff ff       	call   801147 <sys_page_unmap>
+	return r;
+  80252c:	83 c4 10             	add    $0x10,%esp
+  80252f:	eb b5                	jmp    8024e6 <fd_close+0x3c>
+
+00802531 <close>:
+
+int
+close(int fdnum)
+{
+  802531:	55                   	push   %ebp
+  802532:	89 e5                	mov    %esp,%ebp
+  802534:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802537:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80253a:	50                   	push   %eax
+  80253b:	ff 75 08             	push   0x8(%ebp)
+  80253e:	e8 a4 fe ff ff       	call   8023e7 <fd_lookup>
+  802543:	83 c4 10             	add    $0x10,%esp
+  802546:	85 c0                	test   %eax,%eax
+  802548:	79 02                	jns    80254c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80254a:	c9                   	leave
+  80254b:	c3                   	ret
+		return fd_close(fd, 1);
+  80254c:	83 ec 08             	sub    $0x8,%esp
+  80254f:	6a 01                	push   $0x1
+  802551:	ff 75 f4             	push   -0xc(%ebp)
+  802554:	e8 51 ff ff ff       	call   8024aa <fd_close>
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	eb ec                	jmp    80254a <close+0x19>
+
+0080255e <close_all>:
+
+void
+close_all(void)
+{
+  80255e:	55                   	push   %ebp
+  80255f:	89 e5                	mov    %esp,%ebp
+  802561:	53                   	push   %ebx
+  802562:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802565:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80256a:	83 ec 0c             	sub    $0xc,%esp
+  80256d:	53                   	push   %ebx
+  80256e:	e8 be ff ff ff       	call   802531 <close>
+	for (i = 0; i < MAXFD; i++)
+  802573:	83 c3 01             	add    $0x1,%ebx
+  802576:	83 c4 10             	add    $0x10,%esp
+  802579:	83 fb 20             	cmp    $0x20,%ebx
+  80257c:	75 ec                	jne    80256a <close_all+0xc>
+}
+  80257e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802581:	c9                   	leave
+  802582:	c3                   	ret
+
+00802583 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802583:	55                   	push   %ebp
+  802584:	89 e5                	mov    %esp,%ebp
+  802586:	57                   	push   %edi
+  802587:	56                   	push   %esi
+  802588:	53                   	push   %ebx
+  802589:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80258c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80258f:	50                   	push   %eax
+  802590:	ff 75 08             	push   0x8(%ebp)
+  802593:	e8 4f fe ff ff       	call   8023e7 <fd_lookup>
+  802598:	89 c3                	mov    %eax,%ebx
+  80259a:	83 c4 10             	add    $0x10,%esp
+  80259d:	85 c0                	test   %eax,%eax
+  80259f:	78 7f                	js     802620 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8025a1:	83 ec 0c             	sub    $0xc,%esp
+  8025a4:	ff 75 0c             	push   0xc(%ebp)
+  8025a7:	e8 85 ff ff ff       	call   802531 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8025ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8025af:	c1 e6 0c             	shl    $0xc,%esi
+  8025b2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8025b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8025bb:	89 3c 24             	mov    %edi,(%esp)
+  8025be:	e8 b7 fd ff ff       	call   80237a <fd2data>
+  8025c3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8025c5:	89 34 24             	mov    %esi,(%esp)
+  8025c8:	e8 ad fd ff ff       	call   80237a <fd2data>
+  8025cd:	83 c4 10             	add    $0x10,%esp
+  8025d0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8025d3:	89 d8                	mov    %ebx,%eax
+  8025d5:	c1 e8 16             	shr    $0x16,%eax
+  8025d8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8025df:	a8 01                	test   $0x1,%al
+  8025e1:	74 11                	je     8025f4 <dup+0x71>
+  8025e3:	89 d8                	mov    %ebx,%eax
+  8025e5:	c1 e8 0c             	shr    $0xc,%eax
+  8025e8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8025ef:	f6 c2 01             	test   $0x1,%dl
+  8025f2:	75 36                	jne    80262a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8025f4:	89 f8                	mov    %edi,%eax
+  8025f6:	c1 e8 0c             	shr    $0xc,%eax
+  8025f9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802600:	83 ec 0c             	sub    $0xc,%esp
+  802603:	25 07 0e 00 00       	and    $0xe07,%eax
+  802608:	50                   	push   %eax
+  802609:	56                   	push   %esi
+  80260a:	6a 00                	push   $0x0
+  80260c:	57                   	push   %edi
+  80260d:	6a 00                	push   $0x0
+  80260f:	e8 c5 ea ff ff       	call   8010d9 <sys_page_map>
+  802614:	89 c3                	mov    %eax,%ebx
+  802616:	83 c4 20             	add    $0x20,%esp
+  802619:	85 c0                	test   %eax,%eax
+  80261b:	78 33                	js     802650 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80261d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802620:	89 d8                	mov    %ebx,%eax
+  802622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802625:	5b                   	pop    %ebx
+  802626:	5e                   	pop    %esi
+  802627:	5f                   	pop    %edi
+  802628:	5d                   	pop    %ebp
+  802629:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80262a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802631:	83 ec 0c             	sub    $0xc,%esp
+  802634:	25 07 0e 00 00       	and    $0xe07,%eax
+  802639:	50                   	push   %eax
+  80263a:	ff 75 d4             	push   -0x2c(%ebp)
+  80263d:	6a 00                	push   $0x0
+  80263f:	53                   	push   %ebx
+  802640:	6a 00                	push   $0x0
+  802642:	e8 92 ea ff ff       	call   8010d9 <sys_page_map>
+  802647:	89 c3                	mov    %eax,%ebx
+  802649:	83 c4 20             	add    $0x20,%esp
+  80264c:	85 c0                	test   %eax,%eax
+  80264e:	79 a4                	jns    8025f4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802650:	83 ec 08             	sub    $0x8,%esp
+  802653:	56                   	push   %esi
+  802654:	6a 00                	push   $0x0
+  802656:	e8 ec ea ff ff       	call   801147 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80265b:	83 c4 08             	add    $0x8,%esp
+  80265e:	ff 75 d4             	push   -0x2c(%ebp)
+  802661:	6a 00                	push   $0x0
+  802663:	e8 df ea ff ff       	call   801147 <sys_page_unmap>
+	return r;
+  802668:	83 c4 10             	add    $0x10,%esp
+  80266b:	eb b3                	jmp    802620 <dup+0x9d>
+
+0080266d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80266d:	55                   	push   %ebp
+  80266e:	89 e5                	mov    %esp,%ebp
+  802670:	56                   	push   %esi
+  802671:	53                   	push   %ebx
+  802672:	83 ec 18             	sub    $0x18,%esp
+  802675:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802678:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80267b:	50                   	push   %eax
+  80267c:	53                   	push   %ebx
+  80267d:	e8 65 fd ff ff       	call   8023e7 <fd_lookup>
+  802682:	83 c4 10             	add    $0x10,%esp
+  802685:	85 c0                	test   %eax,%eax
+  802687:	78 3c                	js     8026c5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802689:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80268c:	83 ec 08             	sub    $0x8,%esp
+  80268f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802692:	50                   	push   %eax
+  802693:	ff 36                	push   (%esi)
+  802695:	e8 9d fd ff ff       	call   802437 <dev_lookup>
+  80269a:	83 c4 10             	add    $0x10,%esp
+  80269d:	85 c0                	test   %eax,%eax
+  80269f:	78 24                	js     8026c5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8026a1:	8b 46 08             	mov    0x8(%esi),%eax
+  8026a4:	83 e0 03             	and    $0x3,%eax
+  8026a7:	83 f8 01             	cmp    $0x1,%eax
+  8026aa:	74 20                	je     8026cc <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8026ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026af:	8b 40 08             	mov    0x8(%eax),%eax
+  8026b2:	85 c0                	test   %eax,%eax
+  8026b4:	74 57                	je     80270d <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8026b6:	83 ec 04             	sub    $0x4,%esp
+  8026b9:	ff 75 10             	push   0x10(%ebp)
+  8026bc:	ff 75 0c             	push   0xc(%ebp)
+  8026bf:	56                   	push   %esi
+  8026c0:	ff d0                	call   *%eax
+  8026c2:	83 c4 10             	add    $0x10,%esp
+}
+  8026c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026c8:	5b                   	pop    %ebx
+  8026c9:	5e                   	pop    %esi
+  8026ca:	5d                   	pop    %ebp
+  8026cb:	c3                   	ret
+  8026cc:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026ce:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026d3:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026d9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026de:	76 1c                	jbe    8026fc <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026e0:	8b 42 48             	mov    0x48(%edx),%eax
+  8026e3:	83 ec 04             	sub    $0x4,%esp
+  8026e6:	53                   	push   %ebx
+  8026e7:	50                   	push   %eax
+  8026e8:	68 dd 3d 80 00       	push   $0x803ddd
+  8026ed:	e8 3a de ff ff       	call   80052c <cprintf>
+		return -E_INVAL;
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  8026f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026fa:	eb c9                	jmp    8026c5 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8026fc:	c1 e8 10             	shr    $0x10,%eax
+  8026ff:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802705:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80270b:	eb d3                	jmp    8026e0 <read+0x73>
+		return -E_NOT_SUPP;
+  80270d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802712:	eb b1                	jmp    8026c5 <read+0x58>
+
+00802714 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802714:	55                   	push   %ebp
+  802715:	89 e5                	mov    %esp,%ebp
+  802717:	57                   	push   %edi
+  802718:	56                   	push   %esi
+  802719:	53                   	push   %ebx
+  80271a:	83 ec 0c             	sub    $0xc,%esp
+  80271d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802720:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802723:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802728:	eb 02                	jmp    80272c <readn+0x18>
+  80272a:	01 c3                	add    %eax,%ebx
+  80272c:	39 f3                	cmp    %esi,%ebx
+  80272e:	73 21                	jae    802751 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802730:	83 ec 04             	sub    $0x4,%esp
+  802733:	89 f0                	mov    %esi,%eax
+  802735:	29 d8                	sub    %ebx,%eax
+  802737:	50                   	push   %eax
+  802738:	89 d8                	mov    %ebx,%eax
+  80273a:	03 45 0c             	add    0xc(%ebp),%eax
+  80273d:	50                   	push   %eax
+  80273e:	57                   	push   %edi
+  80273f:	e8 29 ff ff ff       	call   80266d <read>
+		if (m < 0)
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	85 c0                	test   %eax,%eax
+  802749:	78 04                	js     80274f <readn+0x3b>
+			return m;
+		if (m == 0)
+  80274b:	75 dd                	jne    80272a <readn+0x16>
+  80274d:	eb 02                	jmp    802751 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80274f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802751:	89 d8                	mov    %ebx,%eax
+  802753:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802756:	5b                   	pop    %ebx
+  802757:	5e                   	pop    %esi
+  802758:	5f                   	pop    %edi
+  802759:	5d                   	pop    %ebp
+  80275a:	c3                   	ret
+
+0080275b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80275b:	55                   	push   %ebp
+  80275c:	89 e5                	mov    %esp,%ebp
+  80275e:	56                   	push   %esi
+  80275f:	53                   	push   %ebx
+  802760:	83 ec 18             	sub    $0x18,%esp
+  802763:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802766:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802769:	50                   	push   %eax
+  80276a:	53                   	push   %ebx
+  80276b:	e8 77 fc ff ff       	call   8023e7 <fd_lookup>
+  802770:	83 c4 10             	add    $0x10,%esp
+  802773:	85 c0                	test   %eax,%eax
+  802775:	78 37                	js     8027ae <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802777:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80277a:	83 ec 08             	sub    $0x8,%esp
+  80277d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802780:	50                   	push   %eax
+  802781:	ff 36                	push   (%esi)
+  802783:	e8 af fc ff ff       	call   802437 <dev_lookup>
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	85 c0                	test   %eax,%eax
+  80278d:	78 1f                	js     8027ae <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80278f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802793:	74 20                	je     8027b5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802798:	8b 40 0c             	mov    0xc(%eax),%eax
+  80279b:	85 c0                	test   %eax,%eax
+  80279d:	74 57                	je     8027f6 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80279f:	83 ec 04             	sub    $0x4,%esp
+  8027a2:	ff 75 10             	push   0x10(%ebp)
+  8027a5:	ff 75 0c             	push   0xc(%ebp)
+  8027a8:	56                   	push   %esi
+  8027a9:	ff d0                	call   *%eax
+  8027ab:	83 c4 10             	add    $0x10,%esp
+}
+  8027ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027b1:	5b                   	pop    %ebx
+  8027b2:	5e                   	pop    %esi
+  8027b3:	5d                   	pop    %ebp
+  8027b4:	c3                   	ret
+  8027b5:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027b7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8027bc:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027c2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8027c7:	76 1c                	jbe    8027e5 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8027c9:	8b 42 48             	mov    0x48(%edx),%eax
+  8027cc:	83 ec 04             	sub    $0x4,%esp
+  8027cf:	53                   	push   %ebx
+  8027d0:	50                   	push   %eax
+  8027d1:	68 f9 3d 80 00       	push   $0x803df9
+  8027d6:	e8 51 dd ff ff       	call   80052c <cprintf>
+		return -E_INVAL;
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027e3:	eb c9                	jmp    8027ae <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8027e5:	c1 e8 10             	shr    $0x10,%eax
+  8027e8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027ee:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8027f4:	eb d3                	jmp    8027c9 <write+0x6e>
+		return -E_NOT_SUPP;
+  8027f6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027fb:	eb b1                	jmp    8027ae <write+0x53>
+
+008027fd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8027fd:	55                   	push   %ebp
+  8027fe:	89 e5                	mov    %esp,%ebp
+  802800:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802803:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802806:	50                   	push   %eax
+  802807:	ff 75 08             	push   0x8(%ebp)
+  80280a:	e8 d8 fb ff ff       	call   8023e7 <fd_lookup>
+  80280f:	83 c4 10             	add    $0x10,%esp
+  802812:	85 c0                	test   %eax,%eax
+  802814:	78 0e                	js     802824 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802816:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802819:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80281f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802824:	c9                   	leave
+  802825:	c3                   	ret
+
+00802826 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802826:	55                   	push   %ebp
+  802827:	89 e5                	mov    %esp,%ebp
+  802829:	56                   	push   %esi
+  80282a:	53                   	push   %ebx
+  80282b:	83 ec 18             	sub    $0x18,%esp
+  80282e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802831:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802834:	50                   	push   %eax
+  802835:	53                   	push   %ebx
+  802836:	e8 ac fb ff ff       	call   8023e7 <fd_lookup>
+  80283b:	83 c4 10             	add    $0x10,%esp
+  80283e:	85 c0                	test   %eax,%eax
+  802840:	78 34                	js     802876 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802842:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802845:	83 ec 08             	sub    $0x8,%esp
+  802848:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80284b:	50                   	push   %eax
+  80284c:	ff 36                	push   (%esi)
+  80284e:	e8 e4 fb ff ff       	call   802437 <dev_lookup>
+  802853:	83 c4 10             	add    $0x10,%esp
+  802856:	85 c0                	test   %eax,%eax
+  802858:	78 1c                	js     802876 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80285a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80285e:	74 1d                	je     80287d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802860:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802863:	8b 40 18             	mov    0x18(%eax),%eax
+  802866:	85 c0                	test   %eax,%eax
+  802868:	74 54                	je     8028be <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80286a:	83 ec 08             	sub    $0x8,%esp
+  80286d:	ff 75 0c             	push   0xc(%ebp)
+  802870:	56                   	push   %esi
+  802871:	ff d0                	call   *%eax
+  802873:	83 c4 10             	add    $0x10,%esp
+}
+  802876:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802879:	5b                   	pop    %ebx
+  80287a:	5e                   	pop    %esi
+  80287b:	5d                   	pop    %ebp
+  80287c:	c3                   	ret
+  80287d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80287f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802884:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80288a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80288f:	76 1c                	jbe    8028ad <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802891:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802894:	83 ec 04             	sub    $0x4,%esp
+  802897:	53                   	push   %ebx
+  802898:	50                   	push   %eax
+  802899:	68 bc 3d 80 00       	push   $0x803dbc
+  80289e:	e8 89 dc ff ff       	call   80052c <cprintf>
+		return -E_INVAL;
+  8028a3:	83 c4 10             	add    $0x10,%esp
+  8028a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028ab:	eb c9                	jmp    802876 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8028ad:	c1 e8 10             	shr    $0x10,%eax
+  8028b0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8028b6:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8028bc:	eb d3                	jmp    802891 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8028be:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028c3:	eb b1                	jmp    802876 <ftruncate+0x50>
+
+008028c5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	56                   	push   %esi
+  8028c9:	53                   	push   %ebx
+  8028ca:	83 ec 18             	sub    $0x18,%esp
+  8028cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8028d0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8028d3:	50                   	push   %eax
+  8028d4:	ff 75 08             	push   0x8(%ebp)
+  8028d7:	e8 0b fb ff ff       	call   8023e7 <fd_lookup>
+  8028dc:	83 c4 10             	add    $0x10,%esp
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	78 49                	js     80292c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8028e3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8028e6:	83 ec 08             	sub    $0x8,%esp
+  8028e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028ec:	50                   	push   %eax
+  8028ed:	ff 36                	push   (%esi)
+  8028ef:	e8 43 fb ff ff       	call   802437 <dev_lookup>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	78 31                	js     80292c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8028fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028fe:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802902:	74 2f                	je     802933 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802904:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802907:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80290e:	00 00 00 
+	stat->st_isdir = 0;
+  802911:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802918:	00 00 00 
+	stat->st_dev = dev;
+  80291b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802921:	83 ec 08             	sub    $0x8,%esp
+  802924:	53                   	push   %ebx
+  802925:	56                   	push   %esi
+  802926:	ff 50 14             	call   *0x14(%eax)
+  802929:	83 c4 10             	add    $0x10,%esp
+}
+  80292c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80292f:	5b                   	pop    %ebx
+  802930:	5e                   	pop    %esi
+  802931:	5d                   	pop    %ebp
+  802932:	c3                   	ret
+		return -E_NOT_SUPP;
+  802933:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802938:	eb f2                	jmp    80292c <fstat+0x67>
+
+0080293a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80293a:	55                   	push   %ebp
+  80293b:	89 e5                	mov    %esp,%ebp
+  80293d:	56                   	push   %esi
+  80293e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80293f:	83 ec 08             	sub    $0x8,%esp
+  802942:	6a 00                	push   $0x0
+  802944:	ff 75 08             	push   0x8(%ebp)
+  802947:	e8 e4 01 00 00       	call   802b30 <open>
+  80294c:	89 c3                	mov    %eax,%ebx
+  80294e:	83 c4 10             	add    $0x10,%esp
+  802951:	85 c0                	test   %eax,%eax
+  802953:	78 1b                	js     802970 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802955:	83 ec 08             	sub    $0x8,%esp
+  802958:	ff 75 0c             	push   0xc(%ebp)
+  80295b:	50                   	push   %eax
+  80295c:	e8 64 ff ff ff       	call   8028c5 <fstat>
+  802961:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802963:	89 1c 24             	mov    %ebx,(%esp)
+  802966:	e8 c6 fb ff ff       	call   802531 <close>
+	return r;
+  80296b:	83 c4 10             	add    $0x10,%esp
+  80296e:	89 f3                	mov    %esi,%ebx
+}
+  802970:	89 d8                	mov    %ebx,%eax
+  802972:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802975:	5b                   	pop    %ebx
+  802976:	5e                   	pop    %esi
+  802977:	5d                   	pop    %ebp
+  802978:	c3                   	ret
+
+00802979 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802979:	55                   	push   %ebp
+  80297a:	89 e5                	mov    %esp,%ebp
+  80297c:	56                   	push   %esi
+  80297d:	53                   	push   %ebx
+  80297e:	89 c6                	mov    %eax,%esi
+  802980:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802982:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802989:	74 27                	je     8029b2 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80298b:	6a 07                	push   $0x7
+  80298d:	68 00 70 84 00       	push   $0x847000
+  802992:	56                   	push   %esi
+  802993:	ff 35 04 50 80 00    	push   0x805004
+  802999:	e8 17 f7 ff ff       	call   8020b5 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80299e:	83 c4 0c             	add    $0xc,%esp
+  8029a1:	6a 00                	push   $0x0
+  8029a3:	53                   	push   %ebx
+  8029a4:	6a 00                	push   $0x0
+  8029a6:	e8 f2 f6 ff ff       	call   80209d <ipc_recv>
+}
+  8029ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029ae:	5b                   	pop    %ebx
+  8029af:	5e                   	pop    %esi
+  8029b0:	5d                   	pop    %ebp
+  8029b1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8029b2:	83 ec 0c             	sub    $0xc,%esp
+  8029b5:	6a 01                	push   $0x1
+  8029b7:	e8 4d f7 ff ff       	call   802109 <ipc_find_env>
+  8029bc:	a3 04 50 80 00       	mov    %eax,0x805004
+  8029c1:	83 c4 10             	add    $0x10,%esp
+  8029c4:	eb c5                	jmp    80298b <fsipc+0x12>
+
+008029c6 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8029c6:	55                   	push   %ebp
+  8029c7:	89 e5                	mov    %esp,%ebp
+  8029c9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8029cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029cf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029d2:	a3 00 70 84 00       	mov    %eax,0x847000
+	fsipcbuf.set_size.req_size = newsize;
+  8029d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029da:	a3 04 70 84 00       	mov    %eax,0x847004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8029df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029e9:	e8 8b ff ff ff       	call   802979 <fsipc>
+}
+  8029ee:	c9                   	leave
+  8029ef:	c3                   	ret
+
+008029f0 <devfile_flush>:
+{
+  8029f0:	55                   	push   %ebp
+  8029f1:	89 e5                	mov    %esp,%ebp
+  8029f3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8029f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029fc:	a3 00 70 84 00       	mov    %eax,0x847000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802a01:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a06:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a0b:	e8 69 ff ff ff       	call   802979 <fsipc>
+}
+  802a10:	c9                   	leave
+  802a11:	c3                   	ret
+
+00802a12 <devfile_stat>:
+{
+  802a12:	55                   	push   %ebp
+  802a13:	89 e5                	mov    %esp,%ebp
+  802a15:	53                   	push   %ebx
+  802a16:	83 ec 04             	sub    $0x4,%esp
+  802a19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a22:	a3 00 70 84 00       	mov    %eax,0x847000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802a27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a2c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a31:	e8 43 ff ff ff       	call   802979 <fsipc>
+  802a36:	85 c0                	test   %eax,%eax
+  802a38:	78 2c                	js     802a66 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a3a:	83 ec 08             	sub    $0x8,%esp
+  802a3d:	68 00 70 84 00       	push   $0x847000
+  802a42:	53                   	push   %ebx
+  802a43:	e8 2c e1 ff ff       	call   800b74 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802a48:	a1 80 70 84 00       	mov    0x847080,%eax
+  802a4d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a53:	a1 84 70 84 00       	mov    0x847084,%eax
+  802a58:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802a5e:	83 c4 10             	add    $0x10,%esp
+  802a61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a69:	c9                   	leave
+  802a6a:	c3                   	ret
+
+00802a6b <devfile_write>:
+{
+  802a6b:	55                   	push   %ebp
+  802a6c:	89 e5                	mov    %esp,%ebp
+  802a6e:	83 ec 0c             	sub    $0xc,%esp
+  802a71:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a74:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a77:	8b 52 0c             	mov    0xc(%edx),%edx
+  802a7a:	89 15 00 70 84 00    	mov    %edx,0x847000
+	fsipcbuf.write.req_n = n;
+  802a80:	a3 04 70 84 00       	mov    %eax,0x847004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  802a85:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802a8a:	39 d0                	cmp    %edx,%eax
+  802a8c:	0f 47 c2             	cmova  %edx,%eax
+  802a8f:	50                   	push   %eax
+  802a90:	ff 75 0c             	push   0xc(%ebp)
+  802a93:	68 08 70 84 00       	push   $0x847008
+  802a98:	e8 5d e2 ff ff       	call   800cfa <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802a9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa2:	b8 04 00 00 00       	mov    $0x4,%eax
+  802aa7:	e8 cd fe ff ff       	call   802979 <fsipc>
+}
+  802aac:	c9                   	leave
+  802aad:	c3                   	ret
+
+00802aae <devfile_read>:
+{
+  802aae:	55                   	push   %ebp
+  802aaf:	89 e5                	mov    %esp,%ebp
+  802ab1:	56                   	push   %esi
+  802ab2:	53                   	push   %ebx
+  802ab3:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab9:	8b 40 0c             	mov    0xc(%eax),%eax
+  802abc:	a3 00 70 84 00       	mov    %eax,0x847000
+	fsipcbuf.read.req_n = n;
+  802ac1:	89 35 04 70 84 00    	mov    %esi,0x847004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802ac7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802acc:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ad1:	e8 a3 fe ff ff       	call   802979 <fsipc>
+  802ad6:	89 c3                	mov    %eax,%ebx
+  802ad8:	85 c0                	test   %eax,%eax
+  802ada:	78 1f                	js     802afb <devfile_read+0x4d>
+	assert(r <= n);
+  802adc:	39 c6                	cmp    %eax,%esi
+  802ade:	72 24                	jb     802b04 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802ae0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802ae5:	7f 33                	jg     802b1a <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802ae7:	83 ec 04             	sub    $0x4,%esp
+  802aea:	50                   	push   %eax
+  802aeb:	68 00 70 84 00       	push   $0x847000
+  802af0:	ff 75 0c             	push   0xc(%ebp)
+  802af3:	e8 02 e2 ff ff       	call   800cfa <memmove>
+	return r;
+  802af8:	83 c4 10             	add    $0x10,%esp
+}
+  802afb:	89 d8                	mov    %ebx,%eax
+  802afd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b00:	5b                   	pop    %ebx
+  802b01:	5e                   	pop    %esi
+  802b02:	5d                   	pop    %ebp
+  802b03:	c3                   	ret
+	assert(r <= n);
+  802b04:	68 2c 3e 80 00       	push   $0x803e2c
+  802b09:	68 10 3d 80 00       	push   $0x803d10
+  802b0e:	6a 76                	push   $0x76
+  802b10:	68 33 3e 80 00       	push   $0x803e33
+  802b15:	e8 37 d9 ff ff       	call   800451 <_panic>
+	assert(r <= PGSIZE);
+  802b1a:	68 3e 3e 80 00       	push   $0x803e3e
+  802b1f:	68 10 3d 80 00       	push   $0x803d10
+  802b24:	6a 77                	push   $0x77
+  802b26:	68 33 3e 80 00       	push   $0x803e33
+  802b2b:	e8 21 d9 ff ff       	call   800451 <_panic>
+
+00802b30 <open>:
+{
+  802b30:	55                   	push   %ebp
+  802b31:	89 e5                	mov    %esp,%ebp
+  802b33:	56                   	push   %esi
+  802b34:	53                   	push   %ebx
+  802b35:	83 ec 1c             	sub    $0x1c,%esp
+  802b38:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802b3b:	56                   	push   %esi
+  802b3c:	e8 f8 df ff ff       	call   800b39 <strlen>
+  802b41:	83 c4 10             	add    $0x10,%esp
+  802b44:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b49:	7f 6c                	jg     802bb7 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802b4b:	83 ec 0c             	sub    $0xc,%esp
+  802b4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b51:	50                   	push   %eax
+  802b52:	e8 3a f8 ff ff       	call   802391 <fd_alloc>
+  802b57:	89 c3                	mov    %eax,%ebx
+  802b59:	83 c4 10             	add    $0x10,%esp
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	78 3c                	js     802b9c <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802b60:	83 ec 08             	sub    $0x8,%esp
+  802b63:	56                   	push   %esi
+  802b64:	68 00 70 84 00       	push   $0x847000
+  802b69:	e8 06 e0 ff ff       	call   800b74 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802b6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b71:	a3 00 74 84 00       	mov    %eax,0x847400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802b76:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b79:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b7e:	e8 f6 fd ff ff       	call   802979 <fsipc>
+  802b83:	89 c3                	mov    %eax,%ebx
+  802b85:	83 c4 10             	add    $0x10,%esp
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	78 19                	js     802ba5 <open+0x75>
+	return fd2num(fd);
+  802b8c:	83 ec 0c             	sub    $0xc,%esp
+  802b8f:	ff 75 f4             	push   -0xc(%ebp)
+  802b92:	e8 d3 f7 ff ff       	call   80236a <fd2num>
+  802b97:	89 c3                	mov    %eax,%ebx
+  802b99:	83 c4 10             	add    $0x10,%esp
+}
+  802b9c:	89 d8                	mov    %ebx,%eax
+  802b9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ba1:	5b                   	pop    %ebx
+  802ba2:	5e                   	pop    %esi
+  802ba3:	5d                   	pop    %ebp
+  802ba4:	c3                   	ret
+		fd_close(fd, 0);
+  802ba5:	83 ec 08             	sub    $0x8,%esp
+  802ba8:	6a 00                	push   $0x0
+  802baa:	ff 75 f4             	push   -0xc(%ebp)
+  802bad:	e8 f8 f8 ff ff       	call   8024aa <fd_close>
+		return r;
+  802bb2:	83 c4 10             	add    $0x10,%esp
+  802bb5:	eb e5                	jmp    802b9c <open+0x6c>
+		return -E_BAD_PATH;
+  802bb7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802bbc:	eb de                	jmp    802b9c <open+0x6c>
+
+00802bbe <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802bbe:	55                   	push   %ebp
+  802bbf:	89 e5                	mov    %esp,%ebp
+  802bc1:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc9:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bce:	e8 a6 fd ff ff       	call   802979 <fsipc>
+}
+  802bd3:	c9                   	leave
+  802bd4:	c3                   	ret
+
+00802bd5 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802bd5:	55                   	push   %ebp
+  802bd6:	89 e5                	mov    %esp,%ebp
+  802bd8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802bdb:	68 4a 3e 80 00       	push   $0x803e4a
+  802be0:	ff 75 0c             	push   0xc(%ebp)
+  802be3:	e8 8c df ff ff       	call   800b74 <strcpy>
+	return 0;
+}
+  802be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bed:	c9                   	leave
+  802bee:	c3                   	ret
+
+00802bef <devsock_close>:
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	53                   	push   %ebx
+  802bf3:	83 ec 10             	sub    $0x10,%esp
+  802bf6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802bf9:	53                   	push   %ebx
+  802bfa:	e8 37 0b 00 00       	call   803736 <pageref>
+  802bff:	89 c2                	mov    %eax,%edx
+  802c01:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802c04:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802c09:	83 fa 01             	cmp    $0x1,%edx
+  802c0c:	74 05                	je     802c13 <devsock_close+0x24>
+}
+  802c0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c11:	c9                   	leave
+  802c12:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802c13:	83 ec 0c             	sub    $0xc,%esp
+  802c16:	ff 73 0c             	push   0xc(%ebx)
+  802c19:	e8 b7 02 00 00       	call   802ed5 <nsipc_close>
+  802c1e:	83 c4 10             	add    $0x10,%esp
+  802c21:	eb eb                	jmp    802c0e <devsock_close+0x1f>
+
+00802c23 <devsock_write>:
+{
+  802c23:	55                   	push   %ebp
+  802c24:	89 e5                	mov    %esp,%ebp
+  802c26:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802c29:	6a 00                	push   $0x0
+  802c2b:	ff 75 10             	push   0x10(%ebp)
+  802c2e:	ff 75 0c             	push   0xc(%ebp)
+  802c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c34:	ff 70 0c             	push   0xc(%eax)
+  802c37:	e8 79 03 00 00       	call   802fb5 <nsipc_send>
+}
+  802c3c:	c9                   	leave
+  802c3d:	c3                   	ret
+
+00802c3e <devsock_read>:
+{
+  802c3e:	55                   	push   %ebp
+  802c3f:	89 e5                	mov    %esp,%ebp
+  802c41:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802c44:	6a 00                	push   $0x0
+  802c46:	ff 75 10             	push   0x10(%ebp)
+  802c49:	ff 75 0c             	push   0xc(%ebp)
+  802c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4f:	ff 70 0c             	push   0xc(%eax)
+  802c52:	e8 ef 02 00 00       	call   802f46 <nsipc_recv>
+}
+  802c57:	c9                   	leave
+  802c58:	c3                   	ret
+
+00802c59 <fd2sockid>:
+{
+  802c59:	55                   	push   %ebp
+  802c5a:	89 e5                	mov    %esp,%ebp
+  802c5c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802c5f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802c62:	52                   	push   %edx
+  802c63:	50                   	push   %eax
+  802c64:	e8 7e f7 ff ff       	call   8023e7 <fd_lookup>
+  802c69:	83 c4 10             	add    $0x10,%esp
+  802c6c:	85 c0                	test   %eax,%eax
+  802c6e:	78 10                	js     802c80 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802c70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c73:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802c79:	39 08                	cmp    %ecx,(%eax)
+  802c7b:	75 05                	jne    802c82 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802c7d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802c80:	c9                   	leave
+  802c81:	c3                   	ret
+		return -E_NOT_SUPP;
+  802c82:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802c87:	eb f7                	jmp    802c80 <fd2sockid+0x27>
+
+00802c89 <alloc_sockfd>:
+{
+  802c89:	55                   	push   %ebp
+  802c8a:	89 e5                	mov    %esp,%ebp
+  802c8c:	56                   	push   %esi
+  802c8d:	53                   	push   %ebx
+  802c8e:	83 ec 1c             	sub    $0x1c,%esp
+  802c91:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802c93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c96:	50                   	push   %eax
+  802c97:	e8 f5 f6 ff ff       	call   802391 <fd_alloc>
+  802c9c:	89 c3                	mov    %eax,%ebx
+  802c9e:	83 c4 10             	add    $0x10,%esp
+  802ca1:	85 c0                	test   %eax,%eax
+  802ca3:	78 43                	js     802ce8 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802ca5:	83 ec 04             	sub    $0x4,%esp
+  802ca8:	68 07 04 00 00       	push   $0x407
+  802cad:	ff 75 f4             	push   -0xc(%ebp)
+  802cb0:	6a 00                	push   $0x0
+  802cb2:	e8 b5 e3 ff ff       	call   80106c <sys_page_alloc>
+  802cb7:	89 c3                	mov    %eax,%ebx
+  802cb9:	83 c4 10             	add    $0x10,%esp
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	78 28                	js     802ce8 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802cc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cc3:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802cc9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802ccb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cce:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802cd5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802cd8:	83 ec 0c             	sub    $0xc,%esp
+  802cdb:	50                   	push   %eax
+  802cdc:	e8 89 f6 ff ff       	call   80236a <fd2num>
+  802ce1:	89 c3                	mov    %eax,%ebx
+  802ce3:	83 c4 10             	add    $0x10,%esp
+  802ce6:	eb 0c                	jmp    802cf4 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802ce8:	83 ec 0c             	sub    $0xc,%esp
+  802ceb:	56                   	push   %esi
+  802cec:	e8 e4 01 00 00       	call   802ed5 <nsipc_close>
+		return r;
+  802cf1:	83 c4 10             	add    $0x10,%esp
+}
+  802cf4:	89 d8                	mov    %ebx,%eax
+  802cf6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cf9:	5b                   	pop    %ebx
+  802cfa:	5e                   	pop    %esi
+  802cfb:	5d                   	pop    %ebp
+  802cfc:	c3                   	ret
+
+00802cfd <accept>:
+{
+  802cfd:	55                   	push   %ebp
+  802cfe:	89 e5                	mov    %esp,%ebp
+  802d00:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d06:	e8 4e ff ff ff       	call   802c59 <fd2sockid>
+  802d0b:	85 c0                	test   %eax,%eax
+  802d0d:	78 1b                	js     802d2a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802d0f:	83 ec 04             	sub    $0x4,%esp
+  802d12:	ff 75 10             	push   0x10(%ebp)
+  802d15:	ff 75 0c             	push   0xc(%ebp)
+  802d18:	50                   	push   %eax
+  802d19:	e8 0e 01 00 00       	call   802e2c <nsipc_accept>
+  802d1e:	83 c4 10             	add    $0x10,%esp
+  802d21:	85 c0                	test   %eax,%eax
+  802d23:	78 05                	js     802d2a <accept+0x2d>
+	return alloc_sockfd(r);
+  802d25:	e8 5f ff ff ff       	call   802c89 <alloc_sockfd>
+}
+  802d2a:	c9                   	leave
+  802d2b:	c3                   	ret
+
+00802d2c <bind>:
+{
+  802d2c:	55                   	push   %ebp
+  802d2d:	89 e5                	mov    %esp,%ebp
+  802d2f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d32:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d35:	e8 1f ff ff ff       	call   802c59 <fd2sockid>
+  802d3a:	85 c0                	test   %eax,%eax
+  802d3c:	78 12                	js     802d50 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802d3e:	83 ec 04             	sub    $0x4,%esp
+  802d41:	ff 75 10             	push   0x10(%ebp)
+  802d44:	ff 75 0c             	push   0xc(%ebp)
+  802d47:	50                   	push   %eax
+  802d48:	e8 31 01 00 00       	call   802e7e <nsipc_bind>
+  802d4d:	83 c4 10             	add    $0x10,%esp
+}
+  802d50:	c9                   	leave
+  802d51:	c3                   	ret
+
+00802d52 <shutdown>:
+{
+  802d52:	55                   	push   %ebp
+  802d53:	89 e5                	mov    %esp,%ebp
+  802d55:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5b:	e8 f9 fe ff ff       	call   802c59 <fd2sockid>
+  802d60:	85 c0                	test   %eax,%eax
+  802d62:	78 0f                	js     802d73 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802d64:	83 ec 08             	sub    $0x8,%esp
+  802d67:	ff 75 0c             	push   0xc(%ebp)
+  802d6a:	50                   	push   %eax
+  802d6b:	e8 43 01 00 00       	call   802eb3 <nsipc_shutdown>
+  802d70:	83 c4 10             	add    $0x10,%esp
+}
+  802d73:	c9                   	leave
+  802d74:	c3                   	ret
+
+00802d75 <connect>:
+{
+  802d75:	55                   	push   %ebp
+  802d76:	89 e5                	mov    %esp,%ebp
+  802d78:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d7e:	e8 d6 fe ff ff       	call   802c59 <fd2sockid>
+  802d83:	85 c0                	test   %eax,%eax
+  802d85:	78 12                	js     802d99 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802d87:	83 ec 04             	sub    $0x4,%esp
+  802d8a:	ff 75 10             	push   0x10(%ebp)
+  802d8d:	ff 75 0c             	push   0xc(%ebp)
+  802d90:	50                   	push   %eax
+  802d91:	e8 59 01 00 00       	call   802eef <nsipc_connect>
+  802d96:	83 c4 10             	add    $0x10,%esp
+}
+  802d99:	c9                   	leave
+  802d9a:	c3                   	ret
+
+00802d9b <listen>:
+{
+  802d9b:	55                   	push   %ebp
+  802d9c:	89 e5                	mov    %esp,%ebp
+  802d9e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802da1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da4:	e8 b0 fe ff ff       	call   802c59 <fd2sockid>
+  802da9:	85 c0                	test   %eax,%eax
+  802dab:	78 0f                	js     802dbc <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802dad:	83 ec 08             	sub    $0x8,%esp
+  802db0:	ff 75 0c             	push   0xc(%ebp)
+  802db3:	50                   	push   %eax
+  802db4:	e8 6b 01 00 00       	call   802f24 <nsipc_listen>
+  802db9:	83 c4 10             	add    $0x10,%esp
+}
+  802dbc:	c9                   	leave
+  802dbd:	c3                   	ret
+
+00802dbe <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802dbe:	55                   	push   %ebp
+  802dbf:	89 e5                	mov    %esp,%ebp
+  802dc1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802dc4:	ff 75 10             	push   0x10(%ebp)
+  802dc7:	ff 75 0c             	push   0xc(%ebp)
+  802dca:	ff 75 08             	push   0x8(%ebp)
+  802dcd:	e8 41 02 00 00       	call   803013 <nsipc_socket>
+  802dd2:	83 c4 10             	add    $0x10,%esp
+  802dd5:	85 c0                	test   %eax,%eax
+  802dd7:	78 05                	js     802dde <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802dd9:	e8 ab fe ff ff       	call   802c89 <alloc_sockfd>
+}
+  802dde:	c9                   	leave
+  802ddf:	c3                   	ret
+
+00802de0 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802de0:	55                   	push   %ebp
+  802de1:	89 e5                	mov    %esp,%ebp
+  802de3:	53                   	push   %ebx
+  802de4:	83 ec 04             	sub    $0x4,%esp
+  802de7:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802de9:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  802df0:	74 26                	je     802e18 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802df2:	6a 07                	push   $0x7
+  802df4:	68 00 80 84 00       	push   $0x848000
+  802df9:	53                   	push   %ebx
+  802dfa:	ff 35 08 50 80 00    	push   0x805008
+  802e00:	e8 b0 f2 ff ff       	call   8020b5 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802e05:	83 c4 0c             	add    $0xc,%esp
+  802e08:	6a 00                	push   $0x0
+  802e0a:	6a 00                	push   $0x0
+  802e0c:	6a 00                	push   $0x0
+  802e0e:	e8 8a f2 ff ff       	call   80209d <ipc_recv>
+}
+  802e13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e16:	c9                   	leave
+  802e17:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802e18:	83 ec 0c             	sub    $0xc,%esp
+  802e1b:	6a 02                	push   $0x2
+  802e1d:	e8 e7 f2 ff ff       	call   802109 <ipc_find_env>
+  802e22:	a3 08 50 80 00       	mov    %eax,0x805008
+  802e27:	83 c4 10             	add    $0x10,%esp
+  802e2a:	eb c6                	jmp    802df2 <nsipc+0x12>
+
+00802e2c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802e2c:	55                   	push   %ebp
+  802e2d:	89 e5                	mov    %esp,%ebp
+  802e2f:	56                   	push   %esi
+  802e30:	53                   	push   %ebx
+  802e31:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802e34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e37:	a3 00 80 84 00       	mov    %eax,0x848000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802e3c:	8b 06                	mov    (%esi),%eax
+  802e3e:	a3 04 80 84 00       	mov    %eax,0x848004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802e43:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e48:	e8 93 ff ff ff       	call   802de0 <nsipc>
+  802e4d:	89 c3                	mov    %eax,%ebx
+  802e4f:	85 c0                	test   %eax,%eax
+  802e51:	79 09                	jns    802e5c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802e53:	89 d8                	mov    %ebx,%eax
+  802e55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e58:	5b                   	pop    %ebx
+  802e59:	5e                   	pop    %esi
+  802e5a:	5d                   	pop    %ebp
+  802e5b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802e5c:	83 ec 04             	sub    $0x4,%esp
+  802e5f:	ff 35 10 80 84 00    	push   0x848010
+  802e65:	68 00 80 84 00       	push   $0x848000
+  802e6a:	ff 75 0c             	push   0xc(%ebp)
+  802e6d:	e8 88 de ff ff       	call   800cfa <memmove>
+		*addrlen = ret->ret_addrlen;
+  802e72:	a1 10 80 84 00       	mov    0x848010,%eax
+  802e77:	89 06                	mov    %eax,(%esi)
+  802e79:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802e7c:	eb d5                	jmp    802e53 <nsipc_accept+0x27>
+
+00802e7e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802e7e:	55                   	push   %ebp
+  802e7f:	89 e5                	mov    %esp,%ebp
+  802e81:	53                   	push   %ebx
+  802e82:	83 ec 08             	sub    $0x8,%esp
+  802e85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802e88:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8b:	a3 00 80 84 00       	mov    %eax,0x848000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802e90:	53                   	push   %ebx
+  802e91:	ff 75 0c             	push   0xc(%ebp)
+  802e94:	68 04 80 84 00       	push   $0x848004
+  802e99:	e8 5c de ff ff       	call   800cfa <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802e9e:	89 1d 14 80 84 00    	mov    %ebx,0x848014
+	return nsipc(NSREQ_BIND);
+  802ea4:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ea9:	e8 32 ff ff ff       	call   802de0 <nsipc>
+}
+  802eae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eb1:	c9                   	leave
+  802eb2:	c3                   	ret
+
+00802eb3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802eb3:	55                   	push   %ebp
+  802eb4:	89 e5                	mov    %esp,%ebp
+  802eb6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebc:	a3 00 80 84 00       	mov    %eax,0x848000
+	nsipcbuf.shutdown.req_how = how;
+  802ec1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ec4:	a3 04 80 84 00       	mov    %eax,0x848004
+	return nsipc(NSREQ_SHUTDOWN);
+  802ec9:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ece:	e8 0d ff ff ff       	call   802de0 <nsipc>
+}
+  802ed3:	c9                   	leave
+  802ed4:	c3                   	ret
+
+00802ed5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802ed5:	55                   	push   %ebp
+  802ed6:	89 e5                	mov    %esp,%ebp
+  802ed8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802edb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ede:	a3 00 80 84 00       	mov    %eax,0x848000
+	return nsipc(NSREQ_CLOSE);
+  802ee3:	b8 04 00 00 00       	mov    $0x4,%eax
+  802ee8:	e8 f3 fe ff ff       	call   802de0 <nsipc>
+}
+  802eed:	c9                   	leave
+  802eee:	c3                   	ret
+
+00802eef <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802eef:	55                   	push   %ebp
+  802ef0:	89 e5                	mov    %esp,%ebp
+  802ef2:	53                   	push   %ebx
+  802ef3:	83 ec 08             	sub    $0x8,%esp
+  802ef6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efc:	a3 00 80 84 00       	mov    %eax,0x848000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802f01:	53                   	push   %ebx
+  802f02:	ff 75 0c             	push   0xc(%ebp)
+  802f05:	68 04 80 84 00       	push   $0x848004
+  802f0a:	e8 eb dd ff ff       	call   800cfa <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802f0f:	89 1d 14 80 84 00    	mov    %ebx,0x848014
+	return nsipc(NSREQ_CONNECT);
+  802f15:	b8 05 00 00 00       	mov    $0x5,%eax
+  802f1a:	e8 c1 fe ff ff       	call   802de0 <nsipc>
+}
+  802f1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f22:	c9                   	leave
+  802f23:	c3                   	ret
+
+00802f24 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802f24:	55                   	push   %ebp
+  802f25:	89 e5                	mov    %esp,%ebp
+  802f27:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2d:	a3 00 80 84 00       	mov    %eax,0x848000
+	nsipcbuf.listen.req_backlog = backlog;
+  802f32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f35:	a3 04 80 84 00       	mov    %eax,0x848004
+	return nsipc(NSREQ_LISTEN);
+  802f3a:	b8 06 00 00 00       	mov    $0x6,%eax
+  802f3f:	e8 9c fe ff ff       	call   802de0 <nsipc>
+}
+  802f44:	c9                   	leave
+  802f45:	c3                   	ret
+
+00802f46 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802f46:	55                   	push   %ebp
+  802f47:	89 e5                	mov    %esp,%ebp
+  802f49:	56                   	push   %esi
+  802f4a:	53                   	push   %ebx
+  802f4b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f51:	a3 00 80 84 00       	mov    %eax,0x848000
+	nsipcbuf.recv.req_len = len;
+  802f56:	89 35 04 80 84 00    	mov    %esi,0x848004
+	nsipcbuf.recv.req_flags = flags;
+  802f5c:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f5f:	a3 08 80 84 00       	mov    %eax,0x848008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802f64:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f69:	e8 72 fe ff ff       	call   802de0 <nsipc>
+  802f6e:	89 c3                	mov    %eax,%ebx
+  802f70:	85 c0                	test   %eax,%eax
+  802f72:	78 22                	js     802f96 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802f74:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802f79:	39 c6                	cmp    %eax,%esi
+  802f7b:	0f 4e c6             	cmovle %esi,%eax
+  802f7e:	39 c3                	cmp    %eax,%ebx
+  802f80:	7f 1d                	jg     802f9f <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802f82:	83 ec 04             	sub    $0x4,%esp
+  802f85:	53                   	push   %ebx
+  802f86:	68 00 80 84 00       	push   $0x848000
+  802f8b:	ff 75 0c             	push   0xc(%ebp)
+  802f8e:	e8 67 dd ff ff       	call   800cfa <memmove>
+  802f93:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802f96:	89 d8                	mov    %ebx,%eax
+  802f98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f9b:	5b                   	pop    %ebx
+  802f9c:	5e                   	pop    %esi
+  802f9d:	5d                   	pop    %ebp
+  802f9e:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802f9f:	68 56 3e 80 00       	push   $0x803e56
+  802fa4:	68 10 3d 80 00       	push   $0x803d10
+  802fa9:	6a 62                	push   $0x62
+  802fab:	68 6b 3e 80 00       	push   $0x803e6b
+  802fb0:	e8 9c d4 ff ff       	call   800451 <_panic>
+
+00802fb5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802fb5:	55                   	push   %ebp
+  802fb6:	89 e5                	mov    %esp,%ebp
+  802fb8:	53                   	push   %ebx
+  802fb9:	83 ec 04             	sub    $0x4,%esp
+  802fbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802fbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fc2:	a3 00 80 84 00       	mov    %eax,0x848000
+	assert(size < 1600);
+  802fc7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802fcd:	7f 2e                	jg     802ffd <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802fcf:	83 ec 04             	sub    $0x4,%esp
+  802fd2:	53                   	push   %ebx
+  802fd3:	ff 75 0c             	push   0xc(%ebp)
+  802fd6:	68 0c 80 84 00       	push   $0x84800c
+  802fdb:	e8 1a dd ff ff       	call   800cfa <memmove>
+	nsipcbuf.send.req_size = size;
+  802fe0:	89 1d 04 80 84 00    	mov    %ebx,0x848004
+	nsipcbuf.send.req_flags = flags;
+  802fe6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fe9:	a3 08 80 84 00       	mov    %eax,0x848008
+	return nsipc(NSREQ_SEND);
+  802fee:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ff3:	e8 e8 fd ff ff       	call   802de0 <nsipc>
+}
+  802ff8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ffb:	c9                   	leave
+  802ffc:	c3                   	ret
+	assert(size < 1600);
+  802ffd:	68 77 3e 80 00       	push   $0x803e77
+  803002:	68 10 3d 80 00       	push   $0x803d10
+  803007:	6a 6d                	push   $0x6d
+  803009:	68 6b 3e 80 00       	push   $0x803e6b
+  80300e:	e8 3e d4 ff ff       	call   800451 <_panic>
+
+00803013 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803013:	55                   	push   %ebp
+  803014:	89 e5                	mov    %esp,%ebp
+  803016:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803019:	8b 45 08             	mov    0x8(%ebp),%eax
+  80301c:	a3 00 80 84 00       	mov    %eax,0x848000
+	nsipcbuf.socket.req_type = type;
+  803021:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803024:	a3 04 80 84 00       	mov    %eax,0x848004
+	nsipcbuf.socket.req_protocol = protocol;
+  803029:	8b 45 10             	mov    0x10(%ebp),%eax
+  80302c:	a3 08 80 84 00       	mov    %eax,0x848008
+	return nsipc(NSREQ_SOCKET);
+  803031:	b8 09 00 00 00       	mov    $0x9,%eax
+  803036:	e8 a5 fd ff ff       	call   802de0 <nsipc>
+}
+  80303b:	c9                   	leave
+  80303c:	c3                   	ret
+
+0080303d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80303d:	55                   	push   %ebp
+  80303e:	89 e5                	mov    %esp,%ebp
+  803040:	56                   	push   %esi
+  803041:	53                   	push   %ebx
+  803042:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803045:	83 ec 0c             	sub    $0xc,%esp
+  803048:	ff 75 08             	push   0x8(%ebp)
+  80304b:	e8 2a f3 ff ff       	call   80237a <fd2data>
+  803050:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803052:	83 c4 08             	add    $0x8,%esp
+  803055:	68 83 3e 80 00       	push   $0x803e83
+  80305a:	53                   	push   %ebx
+  80305b:	e8 14 db ff ff       	call   800b74 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803060:	8b 46 04             	mov    0x4(%esi),%eax
+  803063:	2b 06                	sub    (%esi),%eax
+  803065:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80306b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803072:	00 00 00 
+	stat->st_dev = &devpipe;
+  803075:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80307c:	40 80 00 
+	return 0;
+}
+  80307f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803084:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803087:	5b                   	pop    %ebx
+  803088:	5e                   	pop    %esi
+  803089:	5d                   	pop    %ebp
+  80308a:	c3                   	ret
+
+0080308b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80308b:	55                   	push   %ebp
+  80308c:	89 e5                	mov    %esp,%ebp
+  80308e:	53                   	push   %ebx
+  80308f:	83 ec 0c             	sub    $0xc,%esp
+  803092:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803095:	53                   	push   %ebx
+  803096:	6a 00                	push   $0x0
+  803098:	e8 aa e0 ff ff       	call   801147 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80309d:	89 1c 24             	mov    %ebx,(%esp)
+  8030a0:	e8 d5 f2 ff ff       	call   80237a <fd2data>
+  8030a5:	83 c4 08             	add    $0x8,%esp
+  8030a8:	50                   	push   %eax
+  8030a9:	6a 00                	push   $0x0
+  8030ab:	e8 97 e0 ff ff       	call   801147 <sys_page_unmap>
+}
+  8030b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030b3:	c9                   	leave
+  8030b4:	c3                   	ret
+
+008030b5 <_pipeisclosed>:
+{
+  8030b5:	55                   	push   %ebp
+  8030b6:	89 e5                	mov    %esp,%ebp
+  8030b8:	57                   	push   %edi
+  8030b9:	56                   	push   %esi
+  8030ba:	53                   	push   %ebx
+  8030bb:	83 ec 1c             	sub    $0x1c,%esp
+  8030be:	89 c7                	mov    %eax,%edi
+  8030c0:	89 d6                	mov    %edx,%esi
+  8030c2:	eb 3c                	jmp    803100 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8030c4:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8030c7:	83 ec 0c             	sub    $0xc,%esp
+  8030ca:	57                   	push   %edi
+  8030cb:	e8 66 06 00 00       	call   803736 <pageref>
+  8030d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030d3:	89 34 24             	mov    %esi,(%esp)
+  8030d6:	e8 5b 06 00 00       	call   803736 <pageref>
+  8030db:	89 c2                	mov    %eax,%edx
+  8030dd:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8030df:	05 00 00 00 20       	add    $0x20000000,%eax
+  8030e4:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8030e7:	8b 0d 00 60 84 00    	mov    0x846000,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8030ed:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8030f2:	76 31                	jbe    803125 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8030f4:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8030f7:	39 c3                	cmp    %eax,%ebx
+  8030f9:	74 76                	je     803171 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8030fb:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8030fe:	74 36                	je     803136 <_pipeisclosed+0x81>
+  803100:	89 e0                	mov    %esp,%eax
+  803102:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803107:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80310d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803112:	77 b0                	ja     8030c4 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803114:	c1 e8 10             	shr    $0x10,%eax
+  803117:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80311d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803123:	eb 9f                	jmp    8030c4 <_pipeisclosed+0xf>
+  803125:	c1 e8 10             	shr    $0x10,%eax
+  803128:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80312e:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  803134:	eb be                	jmp    8030f4 <_pipeisclosed+0x3f>
+  803136:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803138:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80313d:	8b 15 00 60 84 00    	mov    0x846000,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803143:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803148:	76 16                	jbe    803160 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80314a:	8b 42 58             	mov    0x58(%edx),%eax
+  80314d:	6a 01                	push   $0x1
+  80314f:	50                   	push   %eax
+  803150:	53                   	push   %ebx
+  803151:	68 8a 3e 80 00       	push   $0x803e8a
+  803156:	e8 d1 d3 ff ff       	call   80052c <cprintf>
+  80315b:	83 c4 10             	add    $0x10,%esp
+  80315e:	eb a0                	jmp    803100 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803160:	c1 e8 10             	shr    $0x10,%eax
+  803163:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803169:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80316f:	eb d9                	jmp    80314a <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  803171:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  803174:	0f 94 c0             	sete   %al
+  803177:	0f b6 c0             	movzbl %al,%eax
+}
+  80317a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80317d:	5b                   	pop    %ebx
+  80317e:	5e                   	pop    %esi
+  80317f:	5f                   	pop    %edi
+  803180:	5d                   	pop    %ebp
+  803181:	c3                   	ret
+
+00803182 <devpipe_write>:
+{
+  803182:	55                   	push   %ebp
+  803183:	89 e5                	mov    %esp,%ebp
+  803185:	57                   	push   %edi
+  803186:	56                   	push   %esi
+  803187:	53                   	push   %ebx
+  803188:	83 ec 28             	sub    $0x28,%esp
+  80318b:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80318e:	56                   	push   %esi
+  80318f:	e8 e6 f1 ff ff       	call   80237a <fd2data>
+  803194:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803196:	83 c4 10             	add    $0x10,%esp
+  803199:	bf 00 00 00 00       	mov    $0x0,%edi
+  80319e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8031a1:	75 09                	jne    8031ac <devpipe_write+0x2a>
+	return i;
+  8031a3:	89 f8                	mov    %edi,%eax
+  8031a5:	eb 23                	jmp    8031ca <devpipe_write+0x48>
+			sys_yield();
+  8031a7:	e8 7a de ff ff       	call   801026 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8031ac:	8b 43 04             	mov    0x4(%ebx),%eax
+  8031af:	8b 0b                	mov    (%ebx),%ecx
+  8031b1:	8d 51 20             	lea    0x20(%ecx),%edx
+  8031b4:	39 d0                	cmp    %edx,%eax
+  8031b6:	72 1a                	jb     8031d2 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8031b8:	89 da                	mov    %ebx,%edx
+  8031ba:	89 f0                	mov    %esi,%eax
+  8031bc:	e8 f4 fe ff ff       	call   8030b5 <_pipeisclosed>
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	74 e2                	je     8031a7 <devpipe_write+0x25>
+				return 0;
+  8031c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031cd:	5b                   	pop    %ebx
+  8031ce:	5e                   	pop    %esi
+  8031cf:	5f                   	pop    %edi
+  8031d0:	5d                   	pop    %ebp
+  8031d1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8031d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031d5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8031d9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8031dc:	89 c2                	mov    %eax,%edx
+  8031de:	c1 fa 1f             	sar    $0x1f,%edx
+  8031e1:	89 d1                	mov    %edx,%ecx
+  8031e3:	c1 e9 1b             	shr    $0x1b,%ecx
+  8031e6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8031e9:	83 e2 1f             	and    $0x1f,%edx
+  8031ec:	29 ca                	sub    %ecx,%edx
+  8031ee:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8031f2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8031f6:	83 c0 01             	add    $0x1,%eax
+  8031f9:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8031fc:	83 c7 01             	add    $0x1,%edi
+  8031ff:	eb 9d                	jmp    80319e <devpipe_write+0x1c>
+
+00803201 <devpipe_read>:
+{
+  803201:	55                   	push   %ebp
+  803202:	89 e5                	mov    %esp,%ebp
+  803204:	57                   	push   %edi
+  803205:	56                   	push   %esi
+  803206:	53                   	push   %ebx
+  803207:	83 ec 18             	sub    $0x18,%esp
+  80320a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80320d:	57                   	push   %edi
+  80320e:	e8 67 f1 ff ff       	call   80237a <fd2data>
+  803213:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803215:	83 c4 10             	add    $0x10,%esp
+  803218:	be 00 00 00 00       	mov    $0x0,%esi
+  80321d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803220:	75 13                	jne    803235 <devpipe_read+0x34>
+	return i;
+  803222:	89 f0                	mov    %esi,%eax
+  803224:	eb 02                	jmp    803228 <devpipe_read+0x27>
+				return i;
+  803226:	89 f0                	mov    %esi,%eax
+}
+  803228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80322b:	5b                   	pop    %ebx
+  80322c:	5e                   	pop    %esi
+  80322d:	5f                   	pop    %edi
+  80322e:	5d                   	pop    %ebp
+  80322f:	c3                   	ret
+			sys_yield();
+  803230:	e8 f1 dd ff ff       	call   801026 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803235:	8b 03                	mov    (%ebx),%eax
+  803237:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80323a:	75 18                	jne    803254 <devpipe_read+0x53>
+			if (i > 0)
+  80323c:	85 f6                	test   %esi,%esi
+  80323e:	75 e6                	jne    803226 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803240:	89 da                	mov    %ebx,%edx
+  803242:	89 f8                	mov    %edi,%eax
+  803244:	e8 6c fe ff ff       	call   8030b5 <_pipeisclosed>
+  803249:	85 c0                	test   %eax,%eax
+  80324b:	74 e3                	je     803230 <devpipe_read+0x2f>
+				return 0;
+  80324d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803252:	eb d4                	jmp    803228 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803254:	99                   	cltd
+  803255:	c1 ea 1b             	shr    $0x1b,%edx
+  803258:	01 d0                	add    %edx,%eax
+  80325a:	83 e0 1f             	and    $0x1f,%eax
+  80325d:	29 d0                	sub    %edx,%eax
+  80325f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803264:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803267:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80326a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80326d:	83 c6 01             	add    $0x1,%esi
+  803270:	eb ab                	jmp    80321d <devpipe_read+0x1c>
+
+00803272 <pipe>:
+{
+  803272:	55                   	push   %ebp
+  803273:	89 e5                	mov    %esp,%ebp
+  803275:	56                   	push   %esi
+  803276:	53                   	push   %ebx
+  803277:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80327a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80327d:	50                   	push   %eax
+  80327e:	e8 0e f1 ff ff       	call   802391 <fd_alloc>
+  803283:	89 c3                	mov    %eax,%ebx
+  803285:	83 c4 10             	add    $0x10,%esp
+  803288:	85 c0                	test   %eax,%eax
+  80328a:	0f 88 23 01 00 00    	js     8033b3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803290:	83 ec 04             	sub    $0x4,%esp
+  803293:	68 07 04 00 00       	push   $0x407
+  803298:	ff 75 f4             	push   -0xc(%ebp)
+  80329b:	6a 00                	push   $0x0
+  80329d:	e8 ca dd ff ff       	call   80106c <sys_page_alloc>
+  8032a2:	89 c3                	mov    %eax,%ebx
+  8032a4:	83 c4 10             	add    $0x10,%esp
+  8032a7:	85 c0                	test   %eax,%eax
+  8032a9:	0f 88 04 01 00 00    	js     8033b3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8032af:	83 ec 0c             	sub    $0xc,%esp
+  8032b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8032b5:	50                   	push   %eax
+  8032b6:	e8 d6 f0 ff ff       	call   802391 <fd_alloc>
+  8032bb:	89 c3                	mov    %eax,%ebx
+  8032bd:	83 c4 10             	add    $0x10,%esp
+  8032c0:	85 c0                	test   %eax,%eax
+  8032c2:	0f 88 db 00 00 00    	js     8033a3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032c8:	83 ec 04             	sub    $0x4,%esp
+  8032cb:	68 07 04 00 00       	push   $0x407
+  8032d0:	ff 75 f0             	push   -0x10(%ebp)
+  8032d3:	6a 00                	push   $0x0
+  8032d5:	e8 92 dd ff ff       	call   80106c <sys_page_alloc>
+  8032da:	89 c3                	mov    %eax,%ebx
+  8032dc:	83 c4 10             	add    $0x10,%esp
+  8032df:	85 c0                	test   %eax,%eax
+  8032e1:	0f 88 bc 00 00 00    	js     8033a3 <pipe+0x131>
+	va = fd2data(fd0);
+  8032e7:	83 ec 0c             	sub    $0xc,%esp
+  8032ea:	ff 75 f4             	push   -0xc(%ebp)
+  8032ed:	e8 88 f0 ff ff       	call   80237a <fd2data>
+  8032f2:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032f4:	83 c4 0c             	add    $0xc,%esp
+  8032f7:	68 07 04 00 00       	push   $0x407
+  8032fc:	50                   	push   %eax
+  8032fd:	6a 00                	push   $0x0
+  8032ff:	e8 68 dd ff ff       	call   80106c <sys_page_alloc>
+  803304:	89 c3                	mov    %eax,%ebx
+  803306:	83 c4 10             	add    $0x10,%esp
+  803309:	85 c0                	test   %eax,%eax
+  80330b:	0f 88 82 00 00 00    	js     803393 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803311:	83 ec 0c             	sub    $0xc,%esp
+  803314:	ff 75 f0             	push   -0x10(%ebp)
+  803317:	e8 5e f0 ff ff       	call   80237a <fd2data>
+  80331c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803323:	50                   	push   %eax
+  803324:	6a 00                	push   $0x0
+  803326:	56                   	push   %esi
+  803327:	6a 00                	push   $0x0
+  803329:	e8 ab dd ff ff       	call   8010d9 <sys_page_map>
+  80332e:	89 c3                	mov    %eax,%ebx
+  803330:	83 c4 20             	add    $0x20,%esp
+  803333:	85 c0                	test   %eax,%eax
+  803335:	78 4e                	js     803385 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803337:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80333c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80333f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803341:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803344:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80334b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80334e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803350:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803353:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80335a:	83 ec 0c             	sub    $0xc,%esp
+  80335d:	ff 75 f4             	push   -0xc(%ebp)
+  803360:	e8 05 f0 ff ff       	call   80236a <fd2num>
+  803365:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803368:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80336a:	83 c4 04             	add    $0x4,%esp
+  80336d:	ff 75 f0             	push   -0x10(%ebp)
+  803370:	e8 f5 ef ff ff       	call   80236a <fd2num>
+  803375:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803378:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80337b:	83 c4 10             	add    $0x10,%esp
+  80337e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803383:	eb 2e                	jmp    8033b3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803385:	83 ec 08             	sub    $0x8,%esp
+  803388:	56                   	push   %esi
+  803389:	6a 00                	push   $0x0
+  80338b:	e8 b7 dd ff ff       	call   801147 <sys_page_unmap>
+  803390:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803393:	83 ec 08             	sub    $0x8,%esp
+  803396:	ff 75 f0             	push   -0x10(%ebp)
+  803399:	6a 00                	push   $0x0
+  80339b:	e8 a7 dd ff ff       	call   801147 <sys_page_unmap>
+  8033a0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8033a3:	83 ec 08             	sub    $0x8,%esp
+  8033a6:	ff 75 f4             	push   -0xc(%ebp)
+  8033a9:	6a 00                	push   $0x0
+  8033ab:	e8 97 dd ff ff       	call   801147 <sys_page_unmap>
+  8033b0:	83 c4 10             	add    $0x10,%esp
+}
+  8033b3:	89 d8                	mov    %ebx,%eax
+  8033b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033b8:	5b                   	pop    %ebx
+  8033b9:	5e                   	pop    %esi
+  8033ba:	5d                   	pop    %ebp
+  8033bb:	c3                   	ret
+
+008033bc <pipeisclosed>:
+{
+  8033bc:	55                   	push   %ebp
+  8033bd:	89 e5                	mov    %esp,%ebp
+  8033bf:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033c5:	50                   	push   %eax
+  8033c6:	ff 75 08             	push   0x8(%ebp)
+  8033c9:	e8 19 f0 ff ff       	call   8023e7 <fd_lookup>
+  8033ce:	83 c4 10             	add    $0x10,%esp
+  8033d1:	85 c0                	test   %eax,%eax
+  8033d3:	78 18                	js     8033ed <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8033d5:	83 ec 0c             	sub    $0xc,%esp
+  8033d8:	ff 75 f4             	push   -0xc(%ebp)
+  8033db:	e8 9a ef ff ff       	call   80237a <fd2data>
+  8033e0:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8033e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033e5:	e8 cb fc ff ff       	call   8030b5 <_pipeisclosed>
+  8033ea:	83 c4 10             	add    $0x10,%esp
+}
+  8033ed:	c9                   	leave
+  8033ee:	c3                   	ret
+
+008033ef <time_nsec>:
+#include <inc/x86.h>
+
+// Nanoseconds since boot.
+uint64_t
+time_nsec(void)
+{
+  8033ef:	55                   	push   %ebp
+  8033f0:	89 e5                	mov    %esp,%ebp
+  8033f2:	57                   	push   %edi
+  8033f3:	56                   	push   %esi
+  8033f4:	53                   	push   %ebx
+  8033f5:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ns_mult, timeinfo.ti_ns_shift);
+  8033f8:	a1 10 f0 ff ee       	mov    0xeefff010,%eax
+  8033fd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  803400:	8b 3d 0c f0 ff ee    	mov    0xeefff00c,%edi
+  803406:	89 7d ec             	mov    %edi,-0x14(%ebp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  803409:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  80340b:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  803411:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  803417:	29 f0                	sub    %esi,%eax
+  803419:	19 fa                	sbb    %edi,%edx
+  80341b:	89 c1                	mov    %eax,%ecx
+  80341d:	89 d3                	mov    %edx,%ebx
+// libgcc for 64-bit arithmetic.  The low 32 bits of the 96-bit product
+// are dropped before the shift, which costs less than one unit.
+static inline uint64_t
+tsc_scale(uint64_t ticks, uint32_t mult, uint32_t shift)
+{
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  80341f:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  803422:	6b f7 00             	imul   $0x0,%edi,%esi
+  803425:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803428:	89 f8                	mov    %edi,%eax
+  80342a:	f7 e1                	mul    %ecx
+  80342c:	89 c6                	mov    %eax,%esi
+  80342e:	89 d7                	mov    %edx,%edi
+  803430:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803433:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  803435:	89 d8                	mov    %ebx,%eax
+  803437:	f7 65 ec             	mull   -0x14(%ebp)
+
+	if (shift >= 32)
+  80343a:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  80343e:	77 34                	ja     803474 <time_nsec+0x85>
+		return (hi + (lo >> 32)) >> (shift - 32);
+	return (hi << (32 - shift)) + (lo >> shift);
+  803440:	b9 20 00 00 00       	mov    $0x20,%ecx
+  803445:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  803448:	29 d9                	sub    %ebx,%ecx
+  80344a:	0f a5 c2             	shld   %cl,%eax,%edx
+  80344d:	d3 e0                	shl    %cl,%eax
+  80344f:	f6 c1 20             	test   $0x20,%cl
+  803452:	74 04                	je     803458 <time_nsec+0x69>
+  803454:	89 c2                	mov    %eax,%edx
+  803456:	31 c0                	xor    %eax,%eax
+  803458:	89 d9                	mov    %ebx,%ecx
+  80345a:	0f ad fe             	shrd   %cl,%edi,%esi
+  80345d:	d3 ef                	shr    %cl,%edi
+  80345f:	f6 c1 20             	test   $0x20,%cl
+  803462:	74 04                	je     803468 <time_nsec+0x79>
+  803464:	89 fe                	mov    %edi,%esi
+  803466:	31 ff                	xor    %edi,%edi
+  803468:	01 f0                	add    %esi,%eax
+  80346a:	11 fa                	adc    %edi,%edx
+}
+  80346c:	83 c4 14             	add    $0x14,%esp
+  80346f:	5b                   	pop    %ebx
+  803470:	5e                   	pop    %esi
+  803471:	5f                   	pop    %edi
+  803472:	5d                   	pop    %ebp
+  803473:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  803474:	89 fe                	mov    %edi,%esi
+  803476:	31 ff                	xor    %edi,%edi
+  803478:	01 f0                	add    %esi,%eax
+  80347a:	11 fa                	adc    %edi,%edx
+  80347c:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  80347f:	83 e9 20             	sub    $0x20,%ecx
+  803482:	0f ad d0             	shrd   %cl,%edx,%eax
+  803485:	d3 ea                	shr    %cl,%edx
+  803487:	f6 c1 20             	test   $0x20,%cl
+  80348a:	74 04                	je     803490 <time_nsec+0xa1>
+  80348c:	89 d0                	mov    %edx,%eax
+  80348e:	31 d2                	xor    %edx,%edx
+  803490:	eb da                	jmp    80346c <time_nsec+0x7d>
+
+00803492 <time_msec>:
+
+// Milliseconds since boot; the same clock as sys_time_msec().
+unsigned int
+time_msec(void)
+{
+  803492:	55                   	push   %ebp
+  803493:	89 e5                	mov    %esp,%ebp
+  803495:	57                   	push   %edi
+  803496:	56                   	push   %esi
+  803497:	53                   	push   %ebx
+  803498:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ms_mult, timeinfo.ti_ms_shift);
+  80349b:	a1 18 f0 ff ee       	mov    0xeefff018,%eax
+  8034a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  8034a3:	8b 3d 14 f0 ff ee    	mov    0xeefff014,%edi
+  8034a9:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8034ac:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  8034ae:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  8034b4:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  8034ba:	29 f0                	sub    %esi,%eax
+  8034bc:	19 fa                	sbb    %edi,%edx
+  8034be:	89 c1                	mov    %eax,%ecx
+  8034c0:	89 d3                	mov    %edx,%ebx
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  8034c2:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  8034c5:	6b f7 00             	imul   $0x0,%edi,%esi
+  8034c8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8034cb:	89 f8                	mov    %edi,%eax
+  8034cd:	f7 e1                	mul    %ecx
+  8034cf:	89 c6                	mov    %eax,%esi
+  8034d1:	89 d7                	mov    %edx,%edi
+  8034d3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8034d6:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  8034d8:	89 d8                	mov    %ebx,%eax
+  8034da:	f7 65 ec             	mull   -0x14(%ebp)
+	if (shift >= 32)
+  8034dd:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  8034e1:	77 32                	ja     803515 <time_msec+0x83>
+	return (hi << (32 - shift)) + (lo >> shift);
+  8034e3:	b9 20 00 00 00       	mov    $0x20,%ecx
+  8034e8:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  8034eb:	29 d9                	sub    %ebx,%ecx
+  8034ed:	0f a5 c2             	shld   %cl,%eax,%edx
+  8034f0:	d3 e0                	shl    %cl,%eax
+  8034f2:	f6 c1 20             	test   $0x20,%cl
+  8034f5:	74 04                	je     8034fb <time_msec+0x69>
+  8034f7:	89 c2                	mov    %eax,%edx
+  8034f9:	31 c0                	xor    %eax,%eax
+  8034fb:	89 d9                	mov    %ebx,%ecx
+  8034fd:	0f ad fe             	shrd   %cl,%edi,%esi
+  803500:	d3 ef                	shr    %cl,%edi
+  803502:	f6 c1 20             	test   $0x20,%cl
+  803505:	74 04                	je     80350b <time_msec+0x79>
+  803507:	89 fe                	mov    %edi,%esi
+  803509:	31 ff                	xor    %edi,%edi
+  80350b:	01 f0                	add    %esi,%eax
+}
+  80350d:	83 c4 14             	add    $0x14,%esp
+  803510:	5b                   	pop    %ebx
+  803511:	5e                   	pop    %esi
+  803512:	5f                   	pop    %edi
+  803513:	5d                   	pop    %ebp
+  803514:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  803515:	89 fe                	mov    %edi,%esi
+  803517:	31 ff                	xor    %edi,%edi
+  803519:	01 f0                	add    %esi,%eax
+  80351b:	11 fa                	adc    %edi,%edx
+  80351d:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  803520:	83 e9 20             	sub    $0x20,%ecx
+  803523:	0f ad d0             	shrd   %cl,%edx,%eax
+  803526:	d3 ea                	shr    %cl,%edx
+  803528:	f6 c1 20             	test   $0x20,%cl
+  80352b:	74 04                	je     803531 <time_msec+0x9f>
+  80352d:	89 d0                	mov    %edx,%eax
+  80352f:	31 d2                	xor    %edx,%edx
+  803531:	eb da                	jmp    80350d <time_msec+0x7b>
+
+00803533 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803533:	b8 00 00 00 00       	mov    $0x0,%eax
+  803538:	c3                   	ret
+
+00803539 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803539:	55                   	push   %ebp
+  80353a:	89 e5                	mov    %esp,%ebp
+  80353c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80353f:	68 a2 3e 80 00       	push   $0x803ea2
+  803544:	ff 75 0c             	push   0xc(%ebp)
+  803547:	e8 28 d6 ff ff       	call   800b74 <strcpy>
+	return 0;
+}
+  80354c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803551:	c9                   	leave
+  803552:	c3                   	ret
+
+00803553 <devcons_write>:
+{
+  803553:	55                   	push   %ebp
+  803554:	89 e5                	mov    %esp,%ebp
+  803556:	57                   	push   %edi
+  803557:	56                   	push   %esi
+  803558:	53                   	push   %ebx
+  803559:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80355f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803564:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80356a:	eb 2e                	jmp    80359a <devcons_write+0x47>
+		m = n - tot;
+  80356c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80356f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803571:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803576:	39 c3                	cmp    %eax,%ebx
+  803578:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80357b:	83 ec 04             	sub    $0x4,%esp
+  80357e:	53                   	push   %ebx
+  80357f:	89 f0                	mov    %esi,%eax
+  803581:	03 45 0c             	add    0xc(%ebp),%eax
+  803584:	50                   	push   %eax
+  803585:	57                   	push   %edi
+  803586:	e8 6f d7 ff ff       	call   800cfa <memmove>
+		sys_cputs(buf, m);
+  80358b:	83 c4 08             	add    $0x8,%esp
+  80358e:	53                   	push   %ebx
+  80358f:	57                   	push   %edi
+  803590:	e8 58 d9 ff ff       	call   800eed <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803595:	01 de                	add    %ebx,%esi
+  803597:	83 c4 10             	add    $0x10,%esp
+  80359a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80359d:	72 cd                	jb     80356c <devcons_write+0x19>
+}
+  80359f:	89 f0                	mov    %esi,%eax
+  8035a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035a4:	5b                   	pop    %ebx
+  8035a5:	5e                   	pop    %esi
+  8035a6:	5f                   	pop    %edi
+  8035a7:	5d                   	pop    %ebp
+  8035a8:	c3                   	ret
+
+008035a9 <devcons_read>:
+{
+  8035a9:	55                   	push   %ebp
+  8035aa:	89 e5                	mov    %esp,%ebp
+  8035ac:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8035af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035b8:	75 07                	jne    8035c1 <devcons_read+0x18>
+  8035ba:	eb 1f                	jmp    8035db <devcons_read+0x32>
+		sys_yield();
+  8035bc:	e8 65 da ff ff       	call   801026 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8035c1:	e8 6b d9 ff ff       	call   800f31 <sys_cgetc>
+  8035c6:	85 c0                	test   %eax,%eax
+  8035c8:	74 f2                	je     8035bc <devcons_read+0x13>
+	if (c < 0)
+  8035ca:	78 0f                	js     8035db <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8035cc:	83 f8 04             	cmp    $0x4,%eax
+  8035cf:	74 0c                	je     8035dd <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8035d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035d4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8035d6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8035db:	c9                   	leave
+  8035dc:	c3                   	ret
+		return 0;
+  8035dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e2:	eb f7                	jmp    8035db <devcons_read+0x32>
+
+008035e4 <cputchar>:
+{
+  8035e4:	55                   	push   %ebp
+  8035e5:	89 e5                	mov    %esp,%ebp
+  8035e7:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8035ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ed:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8035f0:	6a 01                	push   $0x1
+  8035f2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035f5:	50                   	push   %eax
+  8035f6:	e8 f2 d8 ff ff       	call   800eed <sys_cputs>
+}
+  8035fb:	83 c4 10             	add    $0x10,%esp
+  8035fe:	c9                   	leave
+  8035ff:	c3                   	ret
+
+00803600 <getchar>:
+{
+  803600:	55                   	push   %ebp
+  803601:	89 e5                	mov    %esp,%ebp
+  803603:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803606:	6a 01                	push   $0x1
+  803608:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80360b:	50                   	push   %eax
+  80360c:	6a 00                	push   $0x0
+  80360e:	e8 5a f0 ff ff       	call   80266d <read>
+	if (r < 0)
+  803613:	83 c4 10             	add    $0x10,%esp
+  803616:	85 c0                	test   %eax,%eax
+  803618:	78 06                	js     803620 <getchar+0x20>
+	if (r < 1)
+  80361a:	74 06                	je     803622 <getchar+0x22>
+	return c;
+  80361c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803620:	c9                   	leave
+  803621:	c3                   	ret
+		return -E_EOF;
+  803622:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803627:	eb f7                	jmp    803620 <getchar+0x20>
+
+00803629 <iscons>:
+{
+  803629:	55                   	push   %ebp
+  80362a:	89 e5                	mov    %esp,%ebp
+  80362c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80362f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803632:	50                   	push   %eax
+  803633:	ff 75 08             	push   0x8(%ebp)
+  803636:	e8 ac ed ff ff       	call   8023e7 <fd_lookup>
+  80363b:	83 c4 10             	add    $0x10,%esp
+  80363e:	85 c0                	test   %eax,%eax
+  803640:	78 11                	js     803653 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803642:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803645:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80364b:	39 10                	cmp    %edx,(%eax)
+  80364d:	0f 94 c0             	sete   %al
+  803650:	0f b6 c0             	movzbl %al,%eax
+}
+  803653:	c9                   	leave
+  803654:	c3                   	ret
+
+00803655 <opencons>:
+{
+  803655:	55                   	push   %ebp
+  803656:	89 e5                	mov    %esp,%ebp
+  803658:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80365b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80365e:	50                   	push   %eax
+  80365f:	e8 2d ed ff ff       	call   802391 <fd_alloc>
+  803664:	83 c4 10             	add    $0x10,%esp
+  803667:	85 c0                	test   %eax,%eax
+  803669:	78 3a                	js     8036a5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80366b:	83 ec 04             	sub    $0x4,%esp
+  80366e:	68 07 04 00 00       	push   $0x407
+  803673:	ff 75 f4             	push   -0xc(%ebp)
+  803676:	6a 00                	push   $0x0
+  803678:	e8 ef d9 ff ff       	call   80106c <sys_page_alloc>
+  80367d:	83 c4 10             	add    $0x10,%esp
+  803680:	85 c0                	test   %eax,%eax
+  803682:	78 21                	js     8036a5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803684:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803687:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80368d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80368f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803692:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803699:	83 ec 0c             	sub    $0xc,%esp
+  80369c:	50                   	push   %eax
+  80369d:	e8 c8 ec ff ff       	call   80236a <fd2num>
+  8036a2:	83 c4 10             	add    $0x10,%esp
+}
+  8036a5:	c9                   	leave
+  8036a6:	c3                   	ret
+
+008036a7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8036a7:	55                   	push   %ebp
+  8036a8:	89 e5                	mov    %esp,%ebp
+  8036aa:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8036ad:	83 3d 00 90 84 00 00 	cmpl   $0x0,0x849000
+  8036b4:	74 0a                	je     8036c0 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8036b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036b9:	a3 00 90 84 00       	mov    %eax,0x849000
+}
+  8036be:	c9                   	leave
+  8036bf:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8036c0:	83 ec 04             	sub    $0x4,%esp
+  8036c3:	6a 07                	push   $0x7
+  8036c5:	68 00 f0 bf ee       	push   $0xeebff000
+  8036ca:	6a 00                	push   $0x0
+  8036cc:	e8 9b d9 ff ff       	call   80106c <sys_page_alloc>
+  8036d1:	83 c4 10             	add    $0x10,%esp
+  8036d4:	85 c0                	test   %eax,%eax
+  8036d6:	78 14                	js     8036ec <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8036d8:	83 ec 08             	sub    $0x8,%esp
+  8036db:	68 0e 37 80 00       	push   $0x80370e
+  8036e0:	6a 00                	push   $0x0
+  8036e2:	e8 a1 db ff ff       	call   801288 <sys_env_set_pgfault_upcall>
+  8036e7:	83 c4 10             	add    $0x10,%esp
+  8036ea:	eb ca                	jmp    8036b6 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8036ec:	83 ec 08             	sub    $0x8,%esp
+  8036ef:	50                   	push   %eax
+  8036f0:	68 ae 3e 80 00       	push   $0x803eae
+  8036f5:	e8 32 ce ff ff       	call   80052c <cprintf>
+			panic("set_pgfault_handler error");
+  8036fa:	83 c4 0c             	add    $0xc,%esp
+  8036fd:	68 b9 3e 80 00       	push   $0x803eb9
+  803702:	6a 24                	push   $0x24
+  803704:	68 d3 3e 80 00       	push   $0x803ed3
+  803709:	e8 43 cd ff ff       	call   800451 <_panic>
+
+0080370e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80370e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80370f:	a1 00 90 84 00       	mov    0x849000,%eax
+	call *%eax
+  803714:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803716:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803719:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80371d:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803720:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803724:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803726:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  80372a:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  80372b:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  80372f:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803730:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803731:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803735:	c3                   	ret
+
+00803736 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803736:	55                   	push   %ebp
+  803737:	89 e5                	mov    %esp,%ebp
+  803739:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80373c:	89 c2                	mov    %eax,%edx
+  80373e:	c1 ea 16             	shr    $0x16,%edx
+  803741:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803748:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80374d:	f6 c1 01             	test   $0x1,%cl
+  803750:	74 1a                	je     80376c <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803752:	c1 e8 0c             	shr    $0xc,%eax
+  803755:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80375c:	a8 01                	test   $0x1,%al
+  80375e:	74 0c                	je     80376c <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803760:	c1 e8 0c             	shr    $0xc,%eax
+  803763:	c1 e0 04             	shl    $0x4,%eax
+  803766:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80376c:	89 d0                	mov    %edx,%eax
+  80376e:	5d                   	pop    %ebp
+  80376f:	c3                   	ret
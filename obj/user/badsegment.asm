@@ -0,0 +1,6151 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+	// Try to load the kernel's TSS selector into the DS register.
+	asm volatile("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	57                   	push   %edi
+  80003e:	56                   	push   %esi
+  80003f:	53                   	push   %ebx
+  800040:	83 ec 0c             	sub    $0xc,%esp
+  800043:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800049:	b8 01 00 00 00       	mov    $0x1,%eax
+  80004e:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800050:	c1 ea 0b             	shr    $0xb,%edx
+  800053:	83 f2 01             	xor    $0x1,%edx
+  800056:	83 e2 01             	and    $0x1,%edx
+  800059:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80005f:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800066:	00 00 00 
+	envid = sys_getenvid();
+  800069:	e8 1f 0c 00 00       	call   800c8d <sys_getenvid>
+  80006e:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800070:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800075:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80007b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800081:	8b 52 48             	mov    0x48(%edx),%edx
+  800084:	39 ca                	cmp    %ecx,%edx
+  800086:	74 27                	je     8000af <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800088:	83 c0 01             	add    $0x1,%eax
+  80008b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800090:	75 e3                	jne    800075 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800092:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800099:	75 24                	jne    8000bf <libmain+0x85>
+		panic("libmain can't find the environment");
+  80009b:	83 ec 04             	sub    $0x4,%esp
+  80009e:	68 60 2b 80 00       	push   $0x802b60
+  8000a3:	6a 23                	push   $0x23
+  8000a5:	68 83 2b 80 00       	push   $0x802b83
+  8000aa:	e8 4f 00 00 00       	call   8000fe <_panic>
+			mainenv = &envs[i];
+  8000af:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ba:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bf:	85 ff                	test   %edi,%edi
+  8000c1:	7e 07                	jle    8000ca <libmain+0x90>
+		binaryname = argv[0];
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	57                   	push   %edi
+  8000cf:	e8 5f ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d4:	e8 0b 00 00 00       	call   8000e4 <exit>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5f                   	pop    %edi
+  8000e2:	5d                   	pop    %ebp
+  8000e3:	c3                   	ret
+
+008000e4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ea:	e8 94 18 00 00       	call   801983 <close_all>
+	sys_env_destroy(0);
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+  8000f2:	6a 00                	push   $0x0
+  8000f4:	e8 2b 0b 00 00       	call   800c24 <sys_env_destroy>
+}
+  8000f9:	83 c4 10             	add    $0x10,%esp
+  8000fc:	c9                   	leave
+  8000fd:	c3                   	ret
+
+008000fe <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	56                   	push   %esi
+  800102:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800103:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800106:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80010c:	e8 7c 0b 00 00       	call   800c8d <sys_getenvid>
+  800111:	83 ec 0c             	sub    $0xc,%esp
+  800114:	ff 75 0c             	push   0xc(%ebp)
+  800117:	ff 75 08             	push   0x8(%ebp)
+  80011a:	56                   	push   %esi
+  80011b:	50                   	push   %eax
+  80011c:	68 9c 2b 80 00       	push   $0x802b9c
+  800121:	e8 b3 00 00 00       	call   8001d9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800126:	83 c4 18             	add    $0x18,%esp
+  800129:	53                   	push   %ebx
+  80012a:	ff 75 10             	push   0x10(%ebp)
+  80012d:	e8 56 00 00 00       	call   800188 <vcprintf>
+	cprintf("\n");
+  800132:	c7 04 24 0c 30 80 00 	movl   $0x80300c,(%esp)
+  800139:	e8 9b 00 00 00       	call   8001d9 <cprintf>
+  80013e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800141:	cc                   	int3
+	while (1)
+  800142:	eb fd                	jmp    800141 <_panic+0x43>
+
+00800144 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	53                   	push   %ebx
+  800148:	83 ec 04             	sub    $0x4,%esp
+  80014b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80014e:	8b 13                	mov    (%ebx),%edx
+  800150:	8d 42 01             	lea    0x1(%edx),%eax
+  800153:	89 03                	mov    %eax,(%ebx)
+  800155:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800158:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80015c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800161:	74 09                	je     80016c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800163:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800167:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80016a:	c9                   	leave
+  80016b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80016c:	83 ec 08             	sub    $0x8,%esp
+  80016f:	68 ff 00 00 00       	push   $0xff
+  800174:	8d 43 08             	lea    0x8(%ebx),%eax
+  800177:	50                   	push   %eax
+  800178:	e8 1d 0a 00 00       	call   800b9a <sys_cputs>
+		b->idx = 0;
+  80017d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	eb db                	jmp    800163 <putch+0x1f>
+
+00800188 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800188:	55                   	push   %ebp
+  800189:	89 e5                	mov    %esp,%ebp
+  80018b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800191:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800198:	00 00 00 
+	b.cnt = 0;
+  80019b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001a2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a5:	ff 75 0c             	push   0xc(%ebp)
+  8001a8:	ff 75 08             	push   0x8(%ebp)
+  8001ab:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001b1:	50                   	push   %eax
+  8001b2:	68 44 01 80 00       	push   $0x800144
+  8001b7:	e8 fb 00 00 00       	call   8002b7 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001bc:	83 c4 08             	add    $0x8,%esp
+  8001bf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001cb:	50                   	push   %eax
+  8001cc:	e8 c9 09 00 00       	call   800b9a <sys_cputs>
+
+	return b.cnt;
+}
+  8001d1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d7:	c9                   	leave
+  8001d8:	c3                   	ret
+
+008001d9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001d9:	55                   	push   %ebp
+  8001da:	89 e5                	mov    %esp,%ebp
+  8001dc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001df:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001e2:	50                   	push   %eax
+  8001e3:	ff 75 08             	push   0x8(%ebp)
+  8001e6:	e8 9d ff ff ff       	call   800188 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001eb:	c9                   	leave
+  8001ec:	c3                   	ret
+
+008001ed <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	57                   	push   %edi
+  8001f1:	56                   	push   %esi
+  8001f2:	53                   	push   %ebx
+  8001f3:	83 ec 1c             	sub    $0x1c,%esp
+  8001f6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8001f9:	89 d6                	mov    %edx,%esi
+  8001fb:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8001fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800201:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800204:	73 0b                	jae    800211 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800206:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800209:	c1 e7 08             	shl    $0x8,%edi
+  80020c:	0b 7d 10             	or     0x10(%ebp),%edi
+  80020f:	eb 36                	jmp    800247 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800211:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800214:	ba 00 00 00 00       	mov    $0x0,%edx
+  800219:	f7 75 08             	divl   0x8(%ebp)
+  80021c:	89 c1                	mov    %eax,%ecx
+  80021e:	ff 75 14             	push   0x14(%ebp)
+  800221:	ff 75 10             	push   0x10(%ebp)
+  800224:	83 eb 01             	sub    $0x1,%ebx
+  800227:	53                   	push   %ebx
+  800228:	ff 75 08             	push   0x8(%ebp)
+  80022b:	89 f2                	mov    %esi,%edx
+  80022d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800230:	e8 b8 ff ff ff       	call   8001ed <printnum>
+  800235:	83 c4 10             	add    $0x10,%esp
+  800238:	eb 14                	jmp    80024e <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80023a:	83 ec 08             	sub    $0x8,%esp
+  80023d:	56                   	push   %esi
+  80023e:	57                   	push   %edi
+  80023f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800242:	ff d0                	call   *%eax
+  800244:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800247:	83 eb 01             	sub    $0x1,%ebx
+  80024a:	85 db                	test   %ebx,%ebx
+  80024c:	7f ec                	jg     80023a <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80024e:	83 ec 08             	sub    $0x8,%esp
+  800251:	56                   	push   %esi
+  800252:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800255:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025a:	f7 75 08             	divl   0x8(%ebp)
+  80025d:	0f be 92 bf 2b 80 00 	movsbl 0x802bbf(%edx),%edx
+  800264:	8b 45 14             	mov    0x14(%ebp),%eax
+  800267:	c1 e0 08             	shl    $0x8,%eax
+  80026a:	09 d0                	or     %edx,%eax
+  80026c:	50                   	push   %eax
+  80026d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800270:	ff d0                	call   *%eax
+}
+  800272:	83 c4 10             	add    $0x10,%esp
+  800275:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800278:	5b                   	pop    %ebx
+  800279:	5e                   	pop    %esi
+  80027a:	5f                   	pop    %edi
+  80027b:	5d                   	pop    %ebp
+  80027c:	c3                   	ret
+
+0080027d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800283:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800287:	8b 10                	mov    (%eax),%edx
+  800289:	3b 50 04             	cmp    0x4(%eax),%edx
+  80028c:	73 0a                	jae    800298 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80028e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800291:	89 08                	mov    %ecx,(%eax)
+  800293:	8b 45 08             	mov    0x8(%ebp),%eax
+  800296:	88 02                	mov    %al,(%edx)
+}
+  800298:	5d                   	pop    %ebp
+  800299:	c3                   	ret
+
+0080029a <printfmt>:
+{
+  80029a:	55                   	push   %ebp
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002a0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002a3:	50                   	push   %eax
+  8002a4:	ff 75 10             	push   0x10(%ebp)
+  8002a7:	ff 75 0c             	push   0xc(%ebp)
+  8002aa:	ff 75 08             	push   0x8(%ebp)
+  8002ad:	e8 05 00 00 00       	call   8002b7 <vprintfmt>
+}
+  8002b2:	83 c4 10             	add    $0x10,%esp
+  8002b5:	c9                   	leave
+  8002b6:	c3                   	ret
+
+008002b7 <vprintfmt>:
+{
+  8002b7:	55                   	push   %ebp
+  8002b8:	89 e5                	mov    %esp,%ebp
+  8002ba:	57                   	push   %edi
+  8002bb:	56                   	push   %esi
+  8002bc:	53                   	push   %ebx
+  8002bd:	83 ec 3c             	sub    $0x3c,%esp
+  8002c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002c3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002c6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002cd:	eb 16                	jmp    8002e5 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002cf:	83 ec 08             	sub    $0x8,%esp
+  8002d2:	ff 75 0c             	push   0xc(%ebp)
+  8002d5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002d8:	c1 e2 08             	shl    $0x8,%edx
+  8002db:	09 d0                	or     %edx,%eax
+  8002dd:	50                   	push   %eax
+  8002de:	ff d7                	call   *%edi
+  8002e0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002e3:	89 de                	mov    %ebx,%esi
+  8002e5:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8002e8:	0f b6 06             	movzbl (%esi),%eax
+  8002eb:	83 f8 25             	cmp    $0x25,%eax
+  8002ee:	74 0c                	je     8002fc <vprintfmt+0x45>
+			if (ch == '\0')
+  8002f0:	85 c0                	test   %eax,%eax
+  8002f2:	75 db                	jne    8002cf <vprintfmt+0x18>
+}
+  8002f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f7:	5b                   	pop    %ebx
+  8002f8:	5e                   	pop    %esi
+  8002f9:	5f                   	pop    %edi
+  8002fa:	5d                   	pop    %ebp
+  8002fb:	c3                   	ret
+		padc = ' ';
+  8002fc:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800300:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800307:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80030e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800315:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80031a:	8d 73 01             	lea    0x1(%ebx),%esi
+  80031d:	0f b6 13             	movzbl (%ebx),%edx
+  800320:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800323:	3c 55                	cmp    $0x55,%al
+  800325:	0f 87 2c 04 00 00    	ja     800757 <vprintfmt+0x4a0>
+  80032b:	0f b6 c0             	movzbl %al,%eax
+  80032e:	ff 24 85 00 2d 80 00 	jmp    *0x802d00(,%eax,4)
+  800335:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800337:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80033b:	eb dd                	jmp    80031a <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80033d:	89 f3                	mov    %esi,%ebx
+  80033f:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800343:	eb d5                	jmp    80031a <vprintfmt+0x63>
+  800345:	0f b6 d2             	movzbl %dl,%edx
+  800348:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80034a:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80034f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800352:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800356:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800359:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80035c:	83 fe 09             	cmp    $0x9,%esi
+  80035f:	0f 87 8a 00 00 00    	ja     8003ef <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800365:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800368:	eb e5                	jmp    80034f <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80036a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036d:	8b 00                	mov    (%eax),%eax
+  80036f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800372:	8b 45 14             	mov    0x14(%ebp),%eax
+  800375:	8d 40 04             	lea    0x4(%eax),%eax
+  800378:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80037b:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80037d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800381:	79 97                	jns    80031a <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800383:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800386:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800389:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800390:	eb 88                	jmp    80031a <vprintfmt+0x63>
+			if (width < 0)
+  800392:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800395:	85 db                	test   %ebx,%ebx
+  800397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039c:	0f 49 c3             	cmovns %ebx,%eax
+  80039f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a2:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003a4:	e9 71 ff ff ff       	jmp    80031a <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a9:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003ab:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003b2:	e9 63 ff ff ff       	jmp    80031a <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003b7:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003ba:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003be:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003c5:	3c 67                	cmp    $0x67,%al
+  8003c7:	0f 84 18 ff ff ff    	je     8002e5 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003cd:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003d4:	3c 72                	cmp    $0x72,%al
+  8003d6:	0f 84 09 ff ff ff    	je     8002e5 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003dc:	3c 62                	cmp    $0x62,%al
+  8003de:	0f 94 c0             	sete   %al
+  8003e1:	0f b6 c0             	movzbl %al,%eax
+  8003e4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ea:	e9 f6 fe ff ff       	jmp    8002e5 <vprintfmt+0x2e>
+  8003ef:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f2:	eb 89                	jmp    80037d <vprintfmt+0xc6>
+			lflag++;
+  8003f4:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f7:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003f9:	e9 1c ff ff ff       	jmp    80031a <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8003fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800401:	8d 58 04             	lea    0x4(%eax),%ebx
+  800404:	83 ec 08             	sub    $0x8,%esp
+  800407:	ff 75 0c             	push   0xc(%ebp)
+  80040a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80040d:	c1 e0 08             	shl    $0x8,%eax
+  800410:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800413:	0b 01                	or     (%ecx),%eax
+  800415:	50                   	push   %eax
+  800416:	ff d7                	call   *%edi
+			break;
+  800418:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80041b:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80041e:	e9 c2 fe ff ff       	jmp    8002e5 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800423:	8b 45 14             	mov    0x14(%ebp),%eax
+  800426:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800429:	8b 10                	mov    (%eax),%edx
+  80042b:	89 d0                	mov    %edx,%eax
+  80042d:	f7 d8                	neg    %eax
+  80042f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800432:	83 f8 12             	cmp    $0x12,%eax
+  800435:	7f 25                	jg     80045c <vprintfmt+0x1a5>
+  800437:	8b 14 85 60 2e 80 00 	mov    0x802e60(,%eax,4),%edx
+  80043e:	85 d2                	test   %edx,%edx
+  800440:	74 1a                	je     80045c <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800442:	52                   	push   %edx
+  800443:	68 a1 2f 80 00       	push   $0x802fa1
+  800448:	ff 75 0c             	push   0xc(%ebp)
+  80044b:	57                   	push   %edi
+  80044c:	e8 49 fe ff ff       	call   80029a <printfmt>
+  800451:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800454:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800457:	e9 89 fe ff ff       	jmp    8002e5 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80045c:	50                   	push   %eax
+  80045d:	68 d7 2b 80 00       	push   $0x802bd7
+  800462:	ff 75 0c             	push   0xc(%ebp)
+  800465:	57                   	push   %edi
+  800466:	e8 2f fe ff ff       	call   80029a <printfmt>
+  80046b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800471:	e9 6f fe ff ff       	jmp    8002e5 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800476:	8b 45 14             	mov    0x14(%ebp),%eax
+  800479:	83 c0 04             	add    $0x4,%eax
+  80047c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80047f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800482:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800484:	85 c9                	test   %ecx,%ecx
+  800486:	b8 d0 2b 80 00       	mov    $0x802bd0,%eax
+  80048b:	0f 45 c1             	cmovne %ecx,%eax
+  80048e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800491:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800495:	7e 06                	jle    80049d <vprintfmt+0x1e6>
+  800497:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80049b:	75 1a                	jne    8004b7 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80049d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004a0:	c1 e0 08             	shl    $0x8,%eax
+  8004a3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004a6:	83 c8 3f             	or     $0x3f,%eax
+  8004a9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004ac:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004af:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004b2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004b5:	eb 6d                	jmp    800524 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	ff 75 d0             	push   -0x30(%ebp)
+  8004bd:	ff 75 c8             	push   -0x38(%ebp)
+  8004c0:	e8 39 03 00 00       	call   8007fe <strnlen>
+  8004c5:	89 c2                	mov    %eax,%edx
+  8004c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ca:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004cc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004cf:	c1 e1 08             	shl    $0x8,%ecx
+  8004d2:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004d6:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d8:	83 c4 10             	add    $0x10,%esp
+  8004db:	89 c3                	mov    %eax,%ebx
+  8004dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004e3:	89 ce                	mov    %ecx,%esi
+  8004e5:	eb 0f                	jmp    8004f6 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+  8004ea:	ff 75 0c             	push   0xc(%ebp)
+  8004ed:	56                   	push   %esi
+  8004ee:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f0:	83 eb 01             	sub    $0x1,%ebx
+  8004f3:	83 c4 10             	add    $0x10,%esp
+  8004f6:	85 db                	test   %ebx,%ebx
+  8004f8:	7f ed                	jg     8004e7 <vprintfmt+0x230>
+  8004fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004fd:	8b 75 10             	mov    0x10(%ebp),%esi
+  800500:	85 c0                	test   %eax,%eax
+  800502:	ba 00 00 00 00       	mov    $0x0,%edx
+  800507:	0f 49 d0             	cmovns %eax,%edx
+  80050a:	29 d0                	sub    %edx,%eax
+  80050c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050f:	eb 8c                	jmp    80049d <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800511:	83 ec 08             	sub    $0x8,%esp
+  800514:	ff 75 0c             	push   0xc(%ebp)
+  800517:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80051a:	09 c2                	or     %eax,%edx
+  80051c:	52                   	push   %edx
+  80051d:	ff d7                	call   *%edi
+  80051f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800522:	89 d9                	mov    %ebx,%ecx
+  800524:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800527:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80052b:	0f be d0             	movsbl %al,%edx
+  80052e:	85 d2                	test   %edx,%edx
+  800530:	74 2a                	je     80055c <vprintfmt+0x2a5>
+  800532:	85 f6                	test   %esi,%esi
+  800534:	78 05                	js     80053b <vprintfmt+0x284>
+  800536:	83 ee 01             	sub    $0x1,%esi
+  800539:	78 3b                	js     800576 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80053b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80053f:	74 d0                	je     800511 <vprintfmt+0x25a>
+  800541:	0f be c0             	movsbl %al,%eax
+  800544:	83 e8 20             	sub    $0x20,%eax
+  800547:	83 f8 5e             	cmp    $0x5e,%eax
+  80054a:	76 c5                	jbe    800511 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80054c:	83 ec 08             	sub    $0x8,%esp
+  80054f:	ff 75 0c             	push   0xc(%ebp)
+  800552:	ff 75 cc             	push   -0x34(%ebp)
+  800555:	ff d7                	call   *%edi
+  800557:	83 c4 10             	add    $0x10,%esp
+  80055a:	eb c6                	jmp    800522 <vprintfmt+0x26b>
+  80055c:	8b 75 10             	mov    0x10(%ebp),%esi
+  80055f:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800562:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800565:	01 c3                	add    %eax,%ebx
+  800567:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800569:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80056c:	83 c8 20             	or     $0x20,%eax
+  80056f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800572:	89 c6                	mov    %eax,%esi
+  800574:	eb 14                	jmp    80058a <vprintfmt+0x2d3>
+  800576:	8b 75 10             	mov    0x10(%ebp),%esi
+  800579:	eb e4                	jmp    80055f <vprintfmt+0x2a8>
+  80057b:	83 ec 08             	sub    $0x8,%esp
+  80057e:	ff 75 0c             	push   0xc(%ebp)
+  800581:	56                   	push   %esi
+  800582:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800584:	83 eb 01             	sub    $0x1,%ebx
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	85 db                	test   %ebx,%ebx
+  80058c:	7f ed                	jg     80057b <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80058e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800591:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800594:	89 45 14             	mov    %eax,0x14(%ebp)
+  800597:	e9 49 fd ff ff       	jmp    8002e5 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80059c:	83 f9 01             	cmp    $0x1,%ecx
+  80059f:	7f 1f                	jg     8005c0 <vprintfmt+0x309>
+	else if (lflag)
+  8005a1:	85 c9                	test   %ecx,%ecx
+  8005a3:	74 69                	je     80060e <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8b 00                	mov    (%eax),%eax
+  8005aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ad:	89 c1                	mov    %eax,%ecx
+  8005af:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005be:	eb 17                	jmp    8005d7 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c3:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c6:	8b 00                	mov    (%eax),%eax
+  8005c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005d7:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005da:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005e2:	85 db                	test   %ebx,%ebx
+  8005e4:	0f 89 f6 00 00 00    	jns    8006e0 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8005ea:	83 ec 08             	sub    $0x8,%esp
+  8005ed:	ff 75 0c             	push   0xc(%ebp)
+  8005f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005f3:	c1 e0 08             	shl    $0x8,%eax
+  8005f6:	83 c8 2d             	or     $0x2d,%eax
+  8005f9:	50                   	push   %eax
+  8005fa:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8005fc:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005ff:	f7 d9                	neg    %ecx
+  800601:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800604:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800609:	e9 d2 00 00 00       	jmp    8006e0 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	8b 00                	mov    (%eax),%eax
+  800613:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800616:	89 c1                	mov    %eax,%ecx
+  800618:	c1 f9 1f             	sar    $0x1f,%ecx
+  80061b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80061e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800621:	8d 40 04             	lea    0x4(%eax),%eax
+  800624:	89 45 14             	mov    %eax,0x14(%ebp)
+  800627:	eb ae                	jmp    8005d7 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800629:	83 f9 01             	cmp    $0x1,%ecx
+  80062c:	7f 19                	jg     800647 <vprintfmt+0x390>
+	else if (lflag)
+  80062e:	85 c9                	test   %ecx,%ecx
+  800630:	74 2a                	je     80065c <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8b 08                	mov    (%eax),%ecx
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063d:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800642:	e9 99 00 00 00       	jmp    8006e0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 08                	mov    (%eax),%ecx
+  80064c:	8d 40 08             	lea    0x8(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800652:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800657:	e9 84 00 00 00       	jmp    8006e0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80065c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065f:	8b 08                	mov    (%eax),%ecx
+  800661:	8d 40 04             	lea    0x4(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800667:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  80066c:	eb 72                	jmp    8006e0 <vprintfmt+0x429>
+	if (lflag >= 2)
+  80066e:	83 f9 01             	cmp    $0x1,%ecx
+  800671:	7f 16                	jg     800689 <vprintfmt+0x3d2>
+	else if (lflag)
+  800673:	85 c9                	test   %ecx,%ecx
+  800675:	74 24                	je     80069b <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 08                	mov    (%eax),%ecx
+  80067c:	8d 40 04             	lea    0x4(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800682:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800687:	eb 57                	jmp    8006e0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800689:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068c:	8b 08                	mov    (%eax),%ecx
+  80068e:	8d 40 08             	lea    0x8(%eax),%eax
+  800691:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800694:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800699:	eb 45                	jmp    8006e0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8b 08                	mov    (%eax),%ecx
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a6:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006ab:	eb 33                	jmp    8006e0 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006ad:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006b0:	c1 e3 08             	shl    $0x8,%ebx
+  8006b3:	83 ec 08             	sub    $0x8,%esp
+  8006b6:	ff 75 0c             	push   0xc(%ebp)
+  8006b9:	89 d8                	mov    %ebx,%eax
+  8006bb:	83 c8 30             	or     $0x30,%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006c1:	83 c4 08             	add    $0x8,%esp
+  8006c4:	ff 75 0c             	push   0xc(%ebp)
+  8006c7:	83 cb 78             	or     $0x78,%ebx
+  8006ca:	53                   	push   %ebx
+  8006cb:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006d2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006db:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8006e3:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006e7:	52                   	push   %edx
+  8006e8:	ff 75 e0             	push   -0x20(%ebp)
+  8006eb:	50                   	push   %eax
+  8006ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ef:	89 f8                	mov    %edi,%eax
+  8006f1:	e8 f7 fa ff ff       	call   8001ed <printnum>
+			break;
+  8006f6:	83 c4 10             	add    $0x10,%esp
+  8006f9:	e9 e7 fb ff ff       	jmp    8002e5 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006fe:	83 f9 01             	cmp    $0x1,%ecx
+  800701:	7f 16                	jg     800719 <vprintfmt+0x462>
+	else if (lflag)
+  800703:	85 c9                	test   %ecx,%ecx
+  800705:	74 24                	je     80072b <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 08                	mov    (%eax),%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800712:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800717:	eb c7                	jmp    8006e0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 08                	mov    (%eax),%ecx
+  80071e:	8d 40 08             	lea    0x8(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800724:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800729:	eb b5                	jmp    8006e0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80072b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072e:	8b 08                	mov    (%eax),%ecx
+  800730:	8d 40 04             	lea    0x4(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800736:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80073b:	eb a3                	jmp    8006e0 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80073d:	83 ec 08             	sub    $0x8,%esp
+  800740:	ff 75 0c             	push   0xc(%ebp)
+  800743:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800746:	c1 e0 08             	shl    $0x8,%eax
+  800749:	83 c8 25             	or     $0x25,%eax
+  80074c:	50                   	push   %eax
+  80074d:	ff d7                	call   *%edi
+			break;
+  80074f:	83 c4 10             	add    $0x10,%esp
+  800752:	e9 8e fb ff ff       	jmp    8002e5 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800757:	83 ec 08             	sub    $0x8,%esp
+  80075a:	ff 75 0c             	push   0xc(%ebp)
+  80075d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800760:	c1 e0 08             	shl    $0x8,%eax
+  800763:	83 c8 25             	or     $0x25,%eax
+  800766:	50                   	push   %eax
+  800767:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800769:	83 c4 10             	add    $0x10,%esp
+  80076c:	89 de                	mov    %ebx,%esi
+  80076e:	eb 03                	jmp    800773 <vprintfmt+0x4bc>
+  800770:	83 ee 01             	sub    $0x1,%esi
+  800773:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800777:	75 f7                	jne    800770 <vprintfmt+0x4b9>
+  800779:	e9 67 fb ff ff       	jmp    8002e5 <vprintfmt+0x2e>
+
+0080077e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	83 ec 18             	sub    $0x18,%esp
+  800784:	8b 45 08             	mov    0x8(%ebp),%eax
+  800787:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80078a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80078d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800791:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800794:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80079b:	85 c0                	test   %eax,%eax
+  80079d:	74 26                	je     8007c5 <vsnprintf+0x47>
+  80079f:	85 d2                	test   %edx,%edx
+  8007a1:	7e 22                	jle    8007c5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007a3:	ff 75 14             	push   0x14(%ebp)
+  8007a6:	ff 75 10             	push   0x10(%ebp)
+  8007a9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007ac:	50                   	push   %eax
+  8007ad:	68 7d 02 80 00       	push   $0x80027d
+  8007b2:	e8 00 fb ff ff       	call   8002b7 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007b7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ba:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007c0:	83 c4 10             	add    $0x10,%esp
+}
+  8007c3:	c9                   	leave
+  8007c4:	c3                   	ret
+		return -E_INVAL;
+  8007c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ca:	eb f7                	jmp    8007c3 <vsnprintf+0x45>
+
+008007cc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007cc:	55                   	push   %ebp
+  8007cd:	89 e5                	mov    %esp,%ebp
+  8007cf:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007d2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d5:	50                   	push   %eax
+  8007d6:	ff 75 10             	push   0x10(%ebp)
+  8007d9:	ff 75 0c             	push   0xc(%ebp)
+  8007dc:	ff 75 08             	push   0x8(%ebp)
+  8007df:	e8 9a ff ff ff       	call   80077e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007e4:	c9                   	leave
+  8007e5:	c3                   	ret
+
+008007e6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f1:	eb 03                	jmp    8007f6 <strlen+0x10>
+		n++;
+  8007f3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007f6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007fa:	75 f7                	jne    8007f3 <strlen+0xd>
+	return n;
+}
+  8007fc:	5d                   	pop    %ebp
+  8007fd:	c3                   	ret
+
+008007fe <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007fe:	55                   	push   %ebp
+  8007ff:	89 e5                	mov    %esp,%ebp
+  800801:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800804:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080c:	eb 03                	jmp    800811 <strnlen+0x13>
+		n++;
+  80080e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800811:	39 d0                	cmp    %edx,%eax
+  800813:	74 08                	je     80081d <strnlen+0x1f>
+  800815:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800819:	75 f3                	jne    80080e <strnlen+0x10>
+  80081b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80081d:	89 d0                	mov    %edx,%eax
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+
+00800821 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800821:	55                   	push   %ebp
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	53                   	push   %ebx
+  800825:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800828:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800834:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800837:	83 c0 01             	add    $0x1,%eax
+  80083a:	84 d2                	test   %dl,%dl
+  80083c:	75 f2                	jne    800830 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80083e:	89 c8                	mov    %ecx,%eax
+  800840:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800843:	c9                   	leave
+  800844:	c3                   	ret
+
+00800845 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800845:	55                   	push   %ebp
+  800846:	89 e5                	mov    %esp,%ebp
+  800848:	53                   	push   %ebx
+  800849:	83 ec 10             	sub    $0x10,%esp
+  80084c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80084f:	53                   	push   %ebx
+  800850:	e8 91 ff ff ff       	call   8007e6 <strlen>
+  800855:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800858:	ff 75 0c             	push   0xc(%ebp)
+  80085b:	01 d8                	add    %ebx,%eax
+  80085d:	50                   	push   %eax
+  80085e:	e8 be ff ff ff       	call   800821 <strcpy>
+	return dst;
+}
+  800863:	89 d8                	mov    %ebx,%eax
+  800865:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800868:	c9                   	leave
+  800869:	c3                   	ret
+
+0080086a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80086a:	55                   	push   %ebp
+  80086b:	89 e5                	mov    %esp,%ebp
+  80086d:	56                   	push   %esi
+  80086e:	53                   	push   %ebx
+  80086f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800872:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800875:	89 f3                	mov    %esi,%ebx
+  800877:	03 5d 10             	add    0x10(%ebp),%ebx
+  80087a:	89 f0                	mov    %esi,%eax
+  80087c:	eb 0f                	jmp    80088d <strncpy+0x23>
+		*dst++ = *src;
+  80087e:	83 c0 01             	add    $0x1,%eax
+  800881:	0f b6 0a             	movzbl (%edx),%ecx
+  800884:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800887:	80 f9 01             	cmp    $0x1,%cl
+  80088a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80088d:	39 d8                	cmp    %ebx,%eax
+  80088f:	75 ed                	jne    80087e <strncpy+0x14>
+	}
+	return ret;
+}
+  800891:	89 f0                	mov    %esi,%eax
+  800893:	5b                   	pop    %ebx
+  800894:	5e                   	pop    %esi
+  800895:	5d                   	pop    %ebp
+  800896:	c3                   	ret
+
+00800897 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800897:	55                   	push   %ebp
+  800898:	89 e5                	mov    %esp,%ebp
+  80089a:	56                   	push   %esi
+  80089b:	53                   	push   %ebx
+  80089c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a5:	89 f0                	mov    %esi,%eax
+  8008a7:	85 d2                	test   %edx,%edx
+  8008a9:	74 21                	je     8008cc <strlcpy+0x35>
+  8008ab:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008af:	89 f2                	mov    %esi,%edx
+  8008b1:	eb 09                	jmp    8008bc <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008b3:	83 c1 01             	add    $0x1,%ecx
+  8008b6:	83 c2 01             	add    $0x1,%edx
+  8008b9:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008bc:	39 c2                	cmp    %eax,%edx
+  8008be:	74 09                	je     8008c9 <strlcpy+0x32>
+  8008c0:	0f b6 19             	movzbl (%ecx),%ebx
+  8008c3:	84 db                	test   %bl,%bl
+  8008c5:	75 ec                	jne    8008b3 <strlcpy+0x1c>
+  8008c7:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008c9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008cc:	29 f0                	sub    %esi,%eax
+}
+  8008ce:	5b                   	pop    %ebx
+  8008cf:	5e                   	pop    %esi
+  8008d0:	5d                   	pop    %ebp
+  8008d1:	c3                   	ret
+
+008008d2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008d2:	55                   	push   %ebp
+  8008d3:	89 e5                	mov    %esp,%ebp
+  8008d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008db:	eb 06                	jmp    8008e3 <strcmp+0x11>
+		p++, q++;
+  8008dd:	83 c1 01             	add    $0x1,%ecx
+  8008e0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008e3:	0f b6 01             	movzbl (%ecx),%eax
+  8008e6:	84 c0                	test   %al,%al
+  8008e8:	74 04                	je     8008ee <strcmp+0x1c>
+  8008ea:	3a 02                	cmp    (%edx),%al
+  8008ec:	74 ef                	je     8008dd <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ee:	0f b6 c0             	movzbl %al,%eax
+  8008f1:	0f b6 12             	movzbl (%edx),%edx
+  8008f4:	29 d0                	sub    %edx,%eax
+}
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+
+008008f8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	53                   	push   %ebx
+  8008fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800902:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800905:	eb 09                	jmp    800910 <strncmp+0x18>
+		n--, p++, q++;
+  800907:	83 ea 01             	sub    $0x1,%edx
+  80090a:	83 c0 01             	add    $0x1,%eax
+  80090d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800910:	85 d2                	test   %edx,%edx
+  800912:	74 18                	je     80092c <strncmp+0x34>
+  800914:	0f b6 18             	movzbl (%eax),%ebx
+  800917:	84 db                	test   %bl,%bl
+  800919:	74 04                	je     80091f <strncmp+0x27>
+  80091b:	3a 19                	cmp    (%ecx),%bl
+  80091d:	74 e8                	je     800907 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80091f:	0f b6 00             	movzbl (%eax),%eax
+  800922:	0f b6 11             	movzbl (%ecx),%edx
+  800925:	29 d0                	sub    %edx,%eax
+}
+  800927:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092a:	c9                   	leave
+  80092b:	c3                   	ret
+		return 0;
+  80092c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800931:	eb f4                	jmp    800927 <strncmp+0x2f>
+
+00800933 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	8b 45 08             	mov    0x8(%ebp),%eax
+  800939:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80093d:	eb 03                	jmp    800942 <strchr+0xf>
+  80093f:	83 c0 01             	add    $0x1,%eax
+  800942:	0f b6 10             	movzbl (%eax),%edx
+  800945:	84 d2                	test   %dl,%dl
+  800947:	74 06                	je     80094f <strchr+0x1c>
+		if (*s == c)
+  800949:	38 ca                	cmp    %cl,%dl
+  80094b:	75 f2                	jne    80093f <strchr+0xc>
+  80094d:	eb 05                	jmp    800954 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80094f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800954:	5d                   	pop    %ebp
+  800955:	c3                   	ret
+
+00800956 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800960:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800963:	38 ca                	cmp    %cl,%dl
+  800965:	74 09                	je     800970 <strfind+0x1a>
+  800967:	84 d2                	test   %dl,%dl
+  800969:	74 05                	je     800970 <strfind+0x1a>
+	for (; *s; s++)
+  80096b:	83 c0 01             	add    $0x1,%eax
+  80096e:	eb f0                	jmp    800960 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800970:	5d                   	pop    %ebp
+  800971:	c3                   	ret
+
+00800972 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800972:	55                   	push   %ebp
+  800973:	89 e5                	mov    %esp,%ebp
+  800975:	57                   	push   %edi
+  800976:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800979:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80097c:	85 c9                	test   %ecx,%ecx
+  80097e:	74 20                	je     8009a0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800980:	89 f8                	mov    %edi,%eax
+  800982:	09 c8                	or     %ecx,%eax
+  800984:	a8 03                	test   $0x3,%al
+  800986:	75 12                	jne    80099a <memset+0x28>
+		c &= 0xFF;
+  800988:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80098c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800992:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800995:	fc                   	cld
+  800996:	f3 ab                	rep stos %eax,%es:(%edi)
+  800998:	eb 06                	jmp    8009a0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80099a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80099d:	fc                   	cld
+  80099e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009a0:	89 f8                	mov    %edi,%eax
+  8009a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a5:	c9                   	leave
+  8009a6:	c3                   	ret
+
+008009a7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	57                   	push   %edi
+  8009ab:	56                   	push   %esi
+  8009ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009af:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009b2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b5:	39 c6                	cmp    %eax,%esi
+  8009b7:	73 32                	jae    8009eb <memmove+0x44>
+  8009b9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009bc:	39 d0                	cmp    %edx,%eax
+  8009be:	73 2b                	jae    8009eb <memmove+0x44>
+		s += n;
+		d += n;
+  8009c0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c3:	89 d6                	mov    %edx,%esi
+  8009c5:	09 fe                	or     %edi,%esi
+  8009c7:	09 ce                	or     %ecx,%esi
+  8009c9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009cf:	75 0e                	jne    8009df <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009d1:	83 ef 04             	sub    $0x4,%edi
+  8009d4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009d7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009da:	fd                   	std
+  8009db:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009dd:	eb 09                	jmp    8009e8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009df:	83 ef 01             	sub    $0x1,%edi
+  8009e2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e5:	fd                   	std
+  8009e6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009e8:	fc                   	cld
+  8009e9:	eb 1a                	jmp    800a05 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009eb:	89 f2                	mov    %esi,%edx
+  8009ed:	09 c2                	or     %eax,%edx
+  8009ef:	09 ca                	or     %ecx,%edx
+  8009f1:	f6 c2 03             	test   $0x3,%dl
+  8009f4:	75 0a                	jne    800a00 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009f9:	89 c7                	mov    %eax,%edi
+  8009fb:	fc                   	cld
+  8009fc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009fe:	eb 05                	jmp    800a05 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a00:	89 c7                	mov    %eax,%edi
+  800a02:	fc                   	cld
+  800a03:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a05:	5e                   	pop    %esi
+  800a06:	5f                   	pop    %edi
+  800a07:	5d                   	pop    %ebp
+  800a08:	c3                   	ret
+
+00800a09 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a0f:	ff 75 10             	push   0x10(%ebp)
+  800a12:	ff 75 0c             	push   0xc(%ebp)
+  800a15:	ff 75 08             	push   0x8(%ebp)
+  800a18:	e8 8a ff ff ff       	call   8009a7 <memmove>
+}
+  800a1d:	c9                   	leave
+  800a1e:	c3                   	ret
+
+00800a1f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	56                   	push   %esi
+  800a23:	53                   	push   %ebx
+  800a24:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a27:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a2a:	89 c6                	mov    %eax,%esi
+  800a2c:	03 75 10             	add    0x10(%ebp),%esi
+  800a2f:	eb 06                	jmp    800a37 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a31:	83 c0 01             	add    $0x1,%eax
+  800a34:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a37:	39 f0                	cmp    %esi,%eax
+  800a39:	74 14                	je     800a4f <memcmp+0x30>
+		if (*s1 != *s2)
+  800a3b:	0f b6 08             	movzbl (%eax),%ecx
+  800a3e:	0f b6 1a             	movzbl (%edx),%ebx
+  800a41:	38 d9                	cmp    %bl,%cl
+  800a43:	74 ec                	je     800a31 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a45:	0f b6 c1             	movzbl %cl,%eax
+  800a48:	0f b6 db             	movzbl %bl,%ebx
+  800a4b:	29 d8                	sub    %ebx,%eax
+  800a4d:	eb 05                	jmp    800a54 <memcmp+0x35>
+	}
+
+	return 0;
+  800a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a54:	5b                   	pop    %ebx
+  800a55:	5e                   	pop    %esi
+  800a56:	5d                   	pop    %ebp
+  800a57:	c3                   	ret
+
+00800a58 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a66:	eb 03                	jmp    800a6b <memfind+0x13>
+  800a68:	83 c0 01             	add    $0x1,%eax
+  800a6b:	39 d0                	cmp    %edx,%eax
+  800a6d:	73 04                	jae    800a73 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a6f:	38 08                	cmp    %cl,(%eax)
+  800a71:	75 f5                	jne    800a68 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a73:	5d                   	pop    %ebp
+  800a74:	c3                   	ret
+
+00800a75 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	57                   	push   %edi
+  800a79:	56                   	push   %esi
+  800a7a:	53                   	push   %ebx
+  800a7b:	83 ec 1c             	sub    $0x1c,%esp
+  800a7e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a81:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a84:	eb 03                	jmp    800a89 <strtol+0x14>
+		s++;
+  800a86:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800a89:	0f b6 06             	movzbl (%esi),%eax
+  800a8c:	3c 20                	cmp    $0x20,%al
+  800a8e:	74 f6                	je     800a86 <strtol+0x11>
+  800a90:	3c 09                	cmp    $0x9,%al
+  800a92:	74 f2                	je     800a86 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a94:	3c 2b                	cmp    $0x2b,%al
+  800a96:	74 43                	je     800adb <strtol+0x66>
+	int neg = 0;
+  800a98:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800a9d:	3c 2d                	cmp    $0x2d,%al
+  800a9f:	74 44                	je     800ae5 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa1:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800aa7:	75 0f                	jne    800ab8 <strtol+0x43>
+  800aa9:	80 3e 30             	cmpb   $0x30,(%esi)
+  800aac:	74 41                	je     800aef <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aae:	85 ff                	test   %edi,%edi
+  800ab0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab5:	0f 44 f8             	cmove  %eax,%edi
+  800ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abd:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800ac2:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ac5:	89 fb                	mov    %edi,%ebx
+  800ac7:	c1 fb 1f             	sar    $0x1f,%ebx
+  800aca:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800acd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ad0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ad3:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800ad6:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ad9:	eb 67                	jmp    800b42 <strtol+0xcd>
+		s++;
+  800adb:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800ade:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae3:	eb bc                	jmp    800aa1 <strtol+0x2c>
+		s++, neg = 1;
+  800ae5:	83 c6 01             	add    $0x1,%esi
+  800ae8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800aed:	eb b2                	jmp    800aa1 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aef:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800af3:	74 0e                	je     800b03 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800af5:	85 ff                	test   %edi,%edi
+  800af7:	75 bf                	jne    800ab8 <strtol+0x43>
+		s++, base = 8;
+  800af9:	83 c6 01             	add    $0x1,%esi
+  800afc:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b01:	eb b5                	jmp    800ab8 <strtol+0x43>
+		s += 2, base = 16;
+  800b03:	83 c6 02             	add    $0x2,%esi
+  800b06:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b0b:	eb ab                	jmp    800ab8 <strtol+0x43>
+			dig = *s - '0';
+  800b0d:	0f be c9             	movsbl %cl,%ecx
+  800b10:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b13:	39 f9                	cmp    %edi,%ecx
+  800b15:	7d 59                	jge    800b70 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b17:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b1b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b1e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b21:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b24:	0f af d8             	imul   %eax,%ebx
+  800b27:	0f af d7             	imul   %edi,%edx
+  800b2a:	01 d3                	add    %edx,%ebx
+  800b2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b2f:	f7 e7                	mul    %edi
+  800b31:	01 da                	add    %ebx,%edx
+  800b33:	89 cb                	mov    %ecx,%ebx
+  800b35:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b38:	01 c8                	add    %ecx,%eax
+  800b3a:	11 da                	adc    %ebx,%edx
+  800b3c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b3f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b45:	0f b6 08             	movzbl (%eax),%ecx
+  800b48:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b4b:	80 fb 09             	cmp    $0x9,%bl
+  800b4e:	76 bd                	jbe    800b0d <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b50:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b53:	80 fb 19             	cmp    $0x19,%bl
+  800b56:	77 08                	ja     800b60 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b58:	0f be c9             	movsbl %cl,%ecx
+  800b5b:	83 e9 57             	sub    $0x57,%ecx
+  800b5e:	eb b3                	jmp    800b13 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b60:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b63:	80 fb 19             	cmp    $0x19,%bl
+  800b66:	77 08                	ja     800b70 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b68:	0f be c9             	movsbl %cl,%ecx
+  800b6b:	83 e9 37             	sub    $0x37,%ecx
+  800b6e:	eb a3                	jmp    800b13 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b70:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b73:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b76:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b79:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b7c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b80:	74 05                	je     800b87 <strtol+0x112>
+		*endptr = (char *) s;
+  800b82:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b85:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800b87:	85 c9                	test   %ecx,%ecx
+  800b89:	74 07                	je     800b92 <strtol+0x11d>
+  800b8b:	f7 d8                	neg    %eax
+  800b8d:	83 d2 00             	adc    $0x0,%edx
+  800b90:	f7 da                	neg    %edx
+}
+  800b92:	83 c4 1c             	add    $0x1c,%esp
+  800b95:	5b                   	pop    %ebx
+  800b96:	5e                   	pop    %esi
+  800b97:	5f                   	pop    %edi
+  800b98:	5d                   	pop    %ebp
+  800b99:	c3                   	ret
+
+00800b9a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	57                   	push   %edi
+  800b9e:	56                   	push   %esi
+  800b9f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ba0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ba7:	74 18                	je     800bc1 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb4:	89 c3                	mov    %eax,%ebx
+  800bb6:	89 c7                	mov    %eax,%edi
+  800bb8:	89 c6                	mov    %eax,%esi
+  800bba:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bbc:	5b                   	pop    %ebx
+  800bbd:	5e                   	pop    %esi
+  800bbe:	5f                   	pop    %edi
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcc:	89 c3                	mov    %eax,%ebx
+  800bce:	89 c7                	mov    %eax,%edi
+  800bd0:	55                   	push   %ebp
+  800bd1:	89 e5                	mov    %esp,%ebp
+  800bd3:	8d 35 db 0b 80 00    	lea    0x800bdb,%esi
+  800bd9:	0f 34                	sysenter
+  800bdb:	5d                   	pop    %ebp
+		goto out;
+  800bdc:	eb de                	jmp    800bbc <sys_cputs+0x22>
+
+00800bde <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	57                   	push   %edi
+  800be2:	56                   	push   %esi
+  800be3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800be4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800beb:	74 19                	je     800c06 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800bed:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bf7:	89 d1                	mov    %edx,%ecx
+  800bf9:	89 d3                	mov    %edx,%ebx
+  800bfb:	89 d7                	mov    %edx,%edi
+  800bfd:	89 d6                	mov    %edx,%esi
+  800bff:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c01:	5b                   	pop    %ebx
+  800c02:	5e                   	pop    %esi
+  800c03:	5f                   	pop    %edi
+  800c04:	5d                   	pop    %ebp
+  800c05:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c10:	89 d1                	mov    %edx,%ecx
+  800c12:	89 d3                	mov    %edx,%ebx
+  800c14:	89 d7                	mov    %edx,%edi
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	8d 35 21 0c 80 00    	lea    0x800c21,%esi
+  800c1f:	0f 34                	sysenter
+  800c21:	5d                   	pop    %ebp
+		goto out;
+  800c22:	eb dd                	jmp    800c01 <sys_cgetc+0x23>
+
+00800c24 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c2d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c34:	74 21                	je     800c57 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c43:	89 cb                	mov    %ecx,%ebx
+  800c45:	89 cf                	mov    %ecx,%edi
+  800c47:	89 ce                	mov    %ecx,%esi
+  800c49:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c4b:	85 c0                	test   %eax,%eax
+  800c4d:	7f 27                	jg     800c76 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c52:	5b                   	pop    %ebx
+  800c53:	5e                   	pop    %esi
+  800c54:	5f                   	pop    %edi
+  800c55:	5d                   	pop    %ebp
+  800c56:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c64:	89 cb                	mov    %ecx,%ebx
+  800c66:	89 cf                	mov    %ecx,%edi
+  800c68:	55                   	push   %ebp
+  800c69:	89 e5                	mov    %esp,%ebp
+  800c6b:	8d 35 73 0c 80 00    	lea    0x800c73,%esi
+  800c71:	0f 34                	sysenter
+  800c73:	5d                   	pop    %ebp
+		goto out;
+  800c74:	eb d5                	jmp    800c4b <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c76:	83 ec 0c             	sub    $0xc,%esp
+  800c79:	50                   	push   %eax
+  800c7a:	6a 03                	push   $0x3
+  800c7c:	68 cb 2e 80 00       	push   $0x802ecb
+  800c81:	6a 3f                	push   $0x3f
+  800c83:	68 e8 2e 80 00       	push   $0x802ee8
+  800c88:	e8 71 f4 ff ff       	call   8000fe <_panic>
+
+00800c8d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	57                   	push   %edi
+  800c91:	56                   	push   %esi
+  800c92:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c93:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c9a:	74 19                	je     800cb5 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800c9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ca6:	89 d1                	mov    %edx,%ecx
+  800ca8:	89 d3                	mov    %edx,%ebx
+  800caa:	89 d7                	mov    %edx,%edi
+  800cac:	89 d6                	mov    %edx,%esi
+  800cae:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cb0:	5b                   	pop    %ebx
+  800cb1:	5e                   	pop    %esi
+  800cb2:	5f                   	pop    %edi
+  800cb3:	5d                   	pop    %ebp
+  800cb4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cba:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cbf:	89 d1                	mov    %edx,%ecx
+  800cc1:	89 d3                	mov    %edx,%ebx
+  800cc3:	89 d7                	mov    %edx,%edi
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	8d 35 d0 0c 80 00    	lea    0x800cd0,%esi
+  800cce:	0f 34                	sysenter
+  800cd0:	5d                   	pop    %ebp
+		goto out;
+  800cd1:	eb dd                	jmp    800cb0 <sys_getenvid+0x23>
+
+00800cd3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cd3:	55                   	push   %ebp
+  800cd4:	89 e5                	mov    %esp,%ebp
+  800cd6:	57                   	push   %edi
+  800cd7:	56                   	push   %esi
+  800cd8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cd9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ce0:	74 19                	je     800cfb <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cec:	89 d1                	mov    %edx,%ecx
+  800cee:	89 d3                	mov    %edx,%ebx
+  800cf0:	89 d7                	mov    %edx,%edi
+  800cf2:	89 d6                	mov    %edx,%esi
+  800cf4:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cf6:	5b                   	pop    %ebx
+  800cf7:	5e                   	pop    %esi
+  800cf8:	5f                   	pop    %edi
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d00:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d05:	89 d1                	mov    %edx,%ecx
+  800d07:	89 d3                	mov    %edx,%ebx
+  800d09:	89 d7                	mov    %edx,%edi
+  800d0b:	55                   	push   %ebp
+  800d0c:	89 e5                	mov    %esp,%ebp
+  800d0e:	8d 35 16 0d 80 00    	lea    0x800d16,%esi
+  800d14:	0f 34                	sysenter
+  800d16:	5d                   	pop    %ebp
+		goto out;
+  800d17:	eb dd                	jmp    800cf6 <sys_yield+0x23>
+
+00800d19 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	57                   	push   %edi
+  800d1d:	56                   	push   %esi
+  800d1e:	53                   	push   %ebx
+  800d1f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d22:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d29:	74 23                	je     800d4e <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d30:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3e:	89 f7                	mov    %esi,%edi
+  800d40:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d42:	85 c0                	test   %eax,%eax
+  800d44:	7f 29                	jg     800d6f <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d49:	5b                   	pop    %ebx
+  800d4a:	5e                   	pop    %esi
+  800d4b:	5f                   	pop    %edi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d54:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d59:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	8d 35 6c 0d 80 00    	lea    0x800d6c,%esi
+  800d6a:	0f 34                	sysenter
+  800d6c:	5d                   	pop    %ebp
+		goto out;
+  800d6d:	eb d3                	jmp    800d42 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  800d72:	50                   	push   %eax
+  800d73:	6a 04                	push   $0x4
+  800d75:	68 cb 2e 80 00       	push   $0x802ecb
+  800d7a:	6a 3f                	push   $0x3f
+  800d7c:	68 e8 2e 80 00       	push   $0x802ee8
+  800d81:	e8 78 f3 ff ff       	call   8000fe <_panic>
+
+00800d86 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  800d8f:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800d92:	85 f6                	test   %esi,%esi
+  800d94:	75 09                	jne    800d9f <sys_page_map+0x19>
+  800d96:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d9d:	74 1f                	je     800dbe <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800d9f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800daa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db2:	85 c0                	test   %eax,%eax
+  800db4:	7f 27                	jg     800ddd <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800db6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dcf:	55                   	push   %ebp
+  800dd0:	89 e5                	mov    %esp,%ebp
+  800dd2:	8d 35 da 0d 80 00    	lea    0x800dda,%esi
+  800dd8:	0f 34                	sysenter
+  800dda:	5d                   	pop    %ebp
+		goto out;
+  800ddb:	eb d5                	jmp    800db2 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddd:	83 ec 0c             	sub    $0xc,%esp
+  800de0:	50                   	push   %eax
+  800de1:	6a 05                	push   $0x5
+  800de3:	68 cb 2e 80 00       	push   $0x802ecb
+  800de8:	6a 3f                	push   $0x3f
+  800dea:	68 e8 2e 80 00       	push   $0x802ee8
+  800def:	e8 0a f3 ff ff       	call   8000fe <_panic>
+
+00800df4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dfd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e04:	74 22                	je     800e28 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e16:	89 df                	mov    %ebx,%edi
+  800e18:	89 de                	mov    %ebx,%esi
+  800e1a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e1c:	85 c0                	test   %eax,%eax
+  800e1e:	7f 28                	jg     800e48 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e23:	5b                   	pop    %ebx
+  800e24:	5e                   	pop    %esi
+  800e25:	5f                   	pop    %edi
+  800e26:	5d                   	pop    %ebp
+  800e27:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e33:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e38:	89 df                	mov    %ebx,%edi
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	8d 35 45 0e 80 00    	lea    0x800e45,%esi
+  800e43:	0f 34                	sysenter
+  800e45:	5d                   	pop    %ebp
+		goto out;
+  800e46:	eb d4                	jmp    800e1c <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e48:	83 ec 0c             	sub    $0xc,%esp
+  800e4b:	50                   	push   %eax
+  800e4c:	6a 06                	push   $0x6
+  800e4e:	68 cb 2e 80 00       	push   $0x802ecb
+  800e53:	6a 3f                	push   $0x3f
+  800e55:	68 e8 2e 80 00       	push   $0x802ee8
+  800e5a:	e8 9f f2 ff ff       	call   8000fe <_panic>
+
+00800e5f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e5f:	55                   	push   %ebp
+  800e60:	89 e5                	mov    %esp,%ebp
+  800e62:	57                   	push   %edi
+  800e63:	56                   	push   %esi
+  800e64:	53                   	push   %ebx
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e68:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e6f:	74 22                	je     800e93 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e76:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e81:	89 df                	mov    %ebx,%edi
+  800e83:	89 de                	mov    %ebx,%esi
+  800e85:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e87:	85 c0                	test   %eax,%eax
+  800e89:	7f 28                	jg     800eb3 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ea3:	89 df                	mov    %ebx,%edi
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	8d 35 b0 0e 80 00    	lea    0x800eb0,%esi
+  800eae:	0f 34                	sysenter
+  800eb0:	5d                   	pop    %ebp
+		goto out;
+  800eb1:	eb d4                	jmp    800e87 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+  800eb6:	50                   	push   %eax
+  800eb7:	6a 08                	push   $0x8
+  800eb9:	68 cb 2e 80 00       	push   $0x802ecb
+  800ebe:	6a 3f                	push   $0x3f
+  800ec0:	68 e8 2e 80 00       	push   $0x802ee8
+  800ec5:	e8 34 f2 ff ff       	call   8000fe <_panic>
+
+00800eca <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	57                   	push   %edi
+  800ece:	56                   	push   %esi
+  800ecf:	53                   	push   %ebx
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ed3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eda:	74 22                	je     800efe <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800edc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ee6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eec:	89 df                	mov    %ebx,%edi
+  800eee:	89 de                	mov    %ebx,%esi
+  800ef0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef2:	85 c0                	test   %eax,%eax
+  800ef4:	7f 28                	jg     800f1e <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ef6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef9:	5b                   	pop    %ebx
+  800efa:	5e                   	pop    %esi
+  800efb:	5f                   	pop    %edi
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f0e:	89 df                	mov    %ebx,%edi
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	8d 35 1b 0f 80 00    	lea    0x800f1b,%esi
+  800f19:	0f 34                	sysenter
+  800f1b:	5d                   	pop    %ebp
+		goto out;
+  800f1c:	eb d4                	jmp    800ef2 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1e:	83 ec 0c             	sub    $0xc,%esp
+  800f21:	50                   	push   %eax
+  800f22:	6a 09                	push   $0x9
+  800f24:	68 cb 2e 80 00       	push   $0x802ecb
+  800f29:	6a 3f                	push   $0x3f
+  800f2b:	68 e8 2e 80 00       	push   $0x802ee8
+  800f30:	e8 c9 f1 ff ff       	call   8000fe <_panic>
+
+00800f35 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	56                   	push   %esi
+  800f3a:	53                   	push   %ebx
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f3e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f45:	74 22                	je     800f69 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f57:	89 df                	mov    %ebx,%edi
+  800f59:	89 de                	mov    %ebx,%esi
+  800f5b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5d:	85 c0                	test   %eax,%eax
+  800f5f:	7f 28                	jg     800f89 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f64:	5b                   	pop    %ebx
+  800f65:	5e                   	pop    %esi
+  800f66:	5f                   	pop    %edi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f74:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f79:	89 df                	mov    %ebx,%edi
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	8d 35 86 0f 80 00    	lea    0x800f86,%esi
+  800f84:	0f 34                	sysenter
+  800f86:	5d                   	pop    %ebp
+		goto out;
+  800f87:	eb d4                	jmp    800f5d <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	6a 0a                	push   $0xa
+  800f8f:	68 cb 2e 80 00       	push   $0x802ecb
+  800f94:	6a 3f                	push   $0x3f
+  800f96:	68 e8 2e 80 00       	push   $0x802ee8
+  800f9b:	e8 5e f1 ff ff       	call   8000fe <_panic>
+
+00800fa0 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+  800fa6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fa9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fb0:	74 22                	je     800fd4 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb7:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc2:	89 df                	mov    %ebx,%edi
+  800fc4:	89 de                	mov    %ebx,%esi
+  800fc6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc8:	85 c0                	test   %eax,%eax
+  800fca:	7f 28                	jg     800ff4 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5f                   	pop    %edi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fe4:	89 df                	mov    %ebx,%edi
+  800fe6:	55                   	push   %ebp
+  800fe7:	89 e5                	mov    %esp,%ebp
+  800fe9:	8d 35 f1 0f 80 00    	lea    0x800ff1,%esi
+  800fef:	0f 34                	sysenter
+  800ff1:	5d                   	pop    %ebp
+		goto out;
+  800ff2:	eb d4                	jmp    800fc8 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff4:	83 ec 0c             	sub    $0xc,%esp
+  800ff7:	50                   	push   %eax
+  800ff8:	6a 17                	push   $0x17
+  800ffa:	68 cb 2e 80 00       	push   $0x802ecb
+  800fff:	6a 3f                	push   $0x3f
+  801001:	68 e8 2e 80 00       	push   $0x802ee8
+  801006:	e8 f3 f0 ff ff       	call   8000fe <_panic>
+
+0080100b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	57                   	push   %edi
+  80100f:	56                   	push   %esi
+  801010:	53                   	push   %ebx
+  801011:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801014:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80101b:	74 22                	je     80103f <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80101d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801022:	b8 18 00 00 00       	mov    $0x18,%eax
+  801027:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102d:	89 df                	mov    %ebx,%edi
+  80102f:	89 de                	mov    %ebx,%esi
+  801031:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801033:	85 c0                	test   %eax,%eax
+  801035:	7f 28                	jg     80105f <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801037:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103a:	5b                   	pop    %ebx
+  80103b:	5e                   	pop    %esi
+  80103c:	5f                   	pop    %edi
+  80103d:	5d                   	pop    %ebp
+  80103e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80103f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80104f:	89 df                	mov    %ebx,%edi
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	8d 35 5c 10 80 00    	lea    0x80105c,%esi
+  80105a:	0f 34                	sysenter
+  80105c:	5d                   	pop    %ebp
+		goto out;
+  80105d:	eb d4                	jmp    801033 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105f:	83 ec 0c             	sub    $0xc,%esp
+  801062:	50                   	push   %eax
+  801063:	6a 18                	push   $0x18
+  801065:	68 cb 2e 80 00       	push   $0x802ecb
+  80106a:	6a 3f                	push   $0x3f
+  80106c:	68 e8 2e 80 00       	push   $0x802ee8
+  801071:	e8 88 f0 ff ff       	call   8000fe <_panic>
+
+00801076 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801076:	55                   	push   %ebp
+  801077:	89 e5                	mov    %esp,%ebp
+  801079:	57                   	push   %edi
+  80107a:	56                   	push   %esi
+  80107b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80107c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801083:	74 1d                	je     8010a2 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801085:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80108a:	be 00 00 00 00       	mov    $0x0,%esi
+  80108f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801092:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801095:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801098:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80109b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	8d 35 be 10 80 00    	lea    0x8010be,%esi
+  8010bc:	0f 34                	sysenter
+  8010be:	5d                   	pop    %ebp
+		goto out;
+  8010bf:	eb dc                	jmp    80109d <sys_ipc_try_send+0x27>
+
+008010c1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	57                   	push   %edi
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+  8010c7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010ca:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010d1:	74 21                	je     8010f4 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	89 cb                	mov    %ecx,%ebx
+  8010e2:	89 cf                	mov    %ecx,%edi
+  8010e4:	89 ce                	mov    %ecx,%esi
+  8010e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e8:	85 c0                	test   %eax,%eax
+  8010ea:	7f 27                	jg     801113 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ef:	5b                   	pop    %ebx
+  8010f0:	5e                   	pop    %esi
+  8010f1:	5f                   	pop    %edi
+  8010f2:	5d                   	pop    %ebp
+  8010f3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010fc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801101:	89 cb                	mov    %ecx,%ebx
+  801103:	89 cf                	mov    %ecx,%edi
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	8d 35 10 11 80 00    	lea    0x801110,%esi
+  80110e:	0f 34                	sysenter
+  801110:	5d                   	pop    %ebp
+		goto out;
+  801111:	eb d5                	jmp    8010e8 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801113:	83 ec 0c             	sub    $0xc,%esp
+  801116:	50                   	push   %eax
+  801117:	6a 0d                	push   $0xd
+  801119:	68 cb 2e 80 00       	push   $0x802ecb
+  80111e:	6a 3f                	push   $0x3f
+  801120:	68 e8 2e 80 00       	push   $0x802ee8
+  801125:	e8 d4 ef ff ff       	call   8000fe <_panic>
+
+0080112a <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	57                   	push   %edi
+  80112e:	56                   	push   %esi
+  80112f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801130:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801137:	74 1b                	je     801154 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801143:	8b 55 08             	mov    0x8(%ebp),%edx
+  801146:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801149:	89 df                	mov    %ebx,%edi
+  80114b:	89 de                	mov    %ebx,%esi
+  80114d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80114f:	5b                   	pop    %ebx
+  801150:	5e                   	pop    %esi
+  801151:	5f                   	pop    %edi
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801164:	89 df                	mov    %ebx,%edi
+  801166:	55                   	push   %ebp
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	8d 35 71 11 80 00    	lea    0x801171,%esi
+  80116f:	0f 34                	sysenter
+  801171:	5d                   	pop    %ebp
+		goto out;
+  801172:	eb db                	jmp    80114f <sys_ipc_recv_until+0x25>
+
+00801174 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801174:	55                   	push   %ebp
+  801175:	89 e5                	mov    %esp,%ebp
+  801177:	57                   	push   %edi
+  801178:	56                   	push   %esi
+  801179:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80117a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801181:	74 19                	je     80119c <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801183:	ba 00 00 00 00       	mov    $0x0,%edx
+  801188:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80118d:	89 d1                	mov    %edx,%ecx
+  80118f:	89 d3                	mov    %edx,%ebx
+  801191:	89 d7                	mov    %edx,%edi
+  801193:	89 d6                	mov    %edx,%esi
+  801195:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80119c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a6:	89 d1                	mov    %edx,%ecx
+  8011a8:	89 d3                	mov    %edx,%ebx
+  8011aa:	89 d7                	mov    %edx,%edi
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	8d 35 b7 11 80 00    	lea    0x8011b7,%esi
+  8011b5:	0f 34                	sysenter
+  8011b7:	5d                   	pop    %ebp
+		goto out;
+  8011b8:	eb dd                	jmp    801197 <sys_time_msec+0x23>
+
+008011ba <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011c0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011c7:	74 1a                	je     8011e3 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ce:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d6:	89 cb                	mov    %ecx,%ebx
+  8011d8:	89 cf                	mov    %ecx,%edi
+  8011da:	89 ce                	mov    %ecx,%esi
+  8011dc:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011de:	5b                   	pop    %ebx
+  8011df:	5e                   	pop    %esi
+  8011e0:	5f                   	pop    %edi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011eb:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011f0:	89 cb                	mov    %ecx,%ebx
+  8011f2:	89 cf                	mov    %ecx,%edi
+  8011f4:	55                   	push   %ebp
+  8011f5:	89 e5                	mov    %esp,%ebp
+  8011f7:	8d 35 ff 11 80 00    	lea    0x8011ff,%esi
+  8011fd:	0f 34                	sysenter
+  8011ff:	5d                   	pop    %ebp
+		goto out;
+  801200:	eb dc                	jmp    8011de <sys_sleep_until+0x24>
+
+00801202 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	57                   	push   %edi
+  801206:	56                   	push   %esi
+  801207:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801208:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80120f:	74 1a                	je     80122b <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801211:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801216:	b8 11 00 00 00       	mov    $0x11,%eax
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	89 cb                	mov    %ecx,%ebx
+  801220:	89 cf                	mov    %ecx,%edi
+  801222:	89 ce                	mov    %ecx,%esi
+  801224:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801226:	5b                   	pop    %ebx
+  801227:	5e                   	pop    %esi
+  801228:	5f                   	pop    %edi
+  801229:	5d                   	pop    %ebp
+  80122a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801233:	b8 11 00 00 00       	mov    $0x11,%eax
+  801238:	89 cb                	mov    %ecx,%ebx
+  80123a:	89 cf                	mov    %ecx,%edi
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	8d 35 47 12 80 00    	lea    0x801247,%esi
+  801245:	0f 34                	sysenter
+  801247:	5d                   	pop    %ebp
+		goto out;
+  801248:	eb dc                	jmp    801226 <sys_env_print_stats+0x24>
+
+0080124a <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	57                   	push   %edi
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801250:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801257:	74 1b                	je     801274 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801259:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801269:	89 df                	mov    %ebx,%edi
+  80126b:	89 de                	mov    %ebx,%esi
+  80126d:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80126f:	5b                   	pop    %ebx
+  801270:	5e                   	pop    %esi
+  801271:	5f                   	pop    %edi
+  801272:	5d                   	pop    %ebp
+  801273:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801274:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801284:	89 df                	mov    %ebx,%edi
+  801286:	55                   	push   %ebp
+  801287:	89 e5                	mov    %esp,%ebp
+  801289:	8d 35 91 12 80 00    	lea    0x801291,%esi
+  80128f:	0f 34                	sysenter
+  801291:	5d                   	pop    %ebp
+		goto out;
+  801292:	eb db                	jmp    80126f <sys_perf+0x25>
+
+00801294 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+  801297:	57                   	push   %edi
+  801298:	56                   	push   %esi
+  801299:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80129a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012a1:	74 19                	je     8012bc <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012ad:	89 d1                	mov    %edx,%ecx
+  8012af:	89 d3                	mov    %edx,%ebx
+  8012b1:	89 d7                	mov    %edx,%edi
+  8012b3:	89 d6                	mov    %edx,%esi
+  8012b5:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012b7:	5b                   	pop    %ebx
+  8012b8:	5e                   	pop    %esi
+  8012b9:	5f                   	pop    %edi
+  8012ba:	5d                   	pop    %ebp
+  8012bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012c6:	89 d1                	mov    %edx,%ecx
+  8012c8:	89 d3                	mov    %edx,%ebx
+  8012ca:	89 d7                	mov    %edx,%edi
+  8012cc:	55                   	push   %ebp
+  8012cd:	89 e5                	mov    %esp,%ebp
+  8012cf:	8d 35 d7 12 80 00    	lea    0x8012d7,%esi
+  8012d5:	0f 34                	sysenter
+  8012d7:	5d                   	pop    %ebp
+		goto out;
+  8012d8:	eb dd                	jmp    8012b7 <sys_fork+0x23>
+
+008012da <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	57                   	push   %edi
+  8012de:	56                   	push   %esi
+  8012df:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012e0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012e7:	74 1c                	je     801305 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8012e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ee:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8012f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fc:	89 f7                	mov    %esi,%edi
+  8012fe:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801300:	5b                   	pop    %ebx
+  801301:	5e                   	pop    %esi
+  801302:	5f                   	pop    %edi
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801305:	8b 55 08             	mov    0x8(%ebp),%edx
+  801308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801310:	bf 00 00 00 00       	mov    $0x0,%edi
+  801315:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801318:	55                   	push   %ebp
+  801319:	89 e5                	mov    %esp,%ebp
+  80131b:	8d 35 23 13 80 00    	lea    0x801323,%esi
+  801321:	0f 34                	sysenter
+  801323:	5d                   	pop    %ebp
+		goto out;
+  801324:	eb da                	jmp    801300 <sys_thread_create+0x26>
+
+00801326 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	57                   	push   %edi
+  80132a:	56                   	push   %esi
+  80132b:	53                   	push   %ebx
+  80132c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80132f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801336:	74 24                	je     80135c <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801338:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80133d:	be 00 00 00 00       	mov    $0x0,%esi
+  801342:	8b 55 08             	mov    0x8(%ebp),%edx
+  801345:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801348:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80134e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801350:	85 c0                	test   %eax,%eax
+  801352:	7f 27                	jg     80137b <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801354:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801357:	5b                   	pop    %ebx
+  801358:	5e                   	pop    %esi
+  801359:	5f                   	pop    %edi
+  80135a:	5d                   	pop    %ebp
+  80135b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80135c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801362:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801367:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	8d 35 78 13 80 00    	lea    0x801378,%esi
+  801376:	0f 34                	sysenter
+  801378:	5d                   	pop    %ebp
+		goto out;
+  801379:	eb d5                	jmp    801350 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80137b:	83 ec 0c             	sub    $0xc,%esp
+  80137e:	50                   	push   %eax
+  80137f:	6a 1f                	push   $0x1f
+  801381:	68 cb 2e 80 00       	push   $0x802ecb
+  801386:	6a 3f                	push   $0x3f
+  801388:	68 e8 2e 80 00       	push   $0x802ee8
+  80138d:	e8 6c ed ff ff       	call   8000fe <_panic>
+
+00801392 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	57                   	push   %edi
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+  801398:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80139b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013a2:	74 23                	je     8013c7 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a9:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b7:	89 f7                	mov    %esi,%edi
+  8013b9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013bb:	85 c0                	test   %eax,%eax
+  8013bd:	7f 29                	jg     8013e8 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c2:	5b                   	pop    %ebx
+  8013c3:	5e                   	pop    %esi
+  8013c4:	5f                   	pop    %edi
+  8013c5:	5d                   	pop    %ebp
+  8013c6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cd:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	8d 35 e5 13 80 00    	lea    0x8013e5,%esi
+  8013e3:	0f 34                	sysenter
+  8013e5:	5d                   	pop    %ebp
+		goto out;
+  8013e6:	eb d3                	jmp    8013bb <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013e8:	83 ec 0c             	sub    $0xc,%esp
+  8013eb:	50                   	push   %eax
+  8013ec:	6a 20                	push   $0x20
+  8013ee:	68 cb 2e 80 00       	push   $0x802ecb
+  8013f3:	6a 3f                	push   $0x3f
+  8013f5:	68 e8 2e 80 00       	push   $0x802ee8
+  8013fa:	e8 ff ec ff ff       	call   8000fe <_panic>
+
+008013ff <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8013ff:	55                   	push   %ebp
+  801400:	89 e5                	mov    %esp,%ebp
+  801402:	57                   	push   %edi
+  801403:	56                   	push   %esi
+  801404:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801405:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80140c:	74 1b                	je     801429 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80140e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801413:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141e:	89 df                	mov    %ebx,%edi
+  801420:	89 de                	mov    %ebx,%esi
+  801422:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801424:	5b                   	pop    %ebx
+  801425:	5e                   	pop    %esi
+  801426:	5f                   	pop    %edi
+  801427:	5d                   	pop    %ebp
+  801428:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801429:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801434:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801439:	89 df                	mov    %ebx,%edi
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	8d 35 46 14 80 00    	lea    0x801446,%esi
+  801444:	0f 34                	sysenter
+  801446:	5d                   	pop    %ebp
+		goto out;
+  801447:	eb db                	jmp    801424 <sys_batch+0x25>
+
+00801449 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801449:	55                   	push   %ebp
+  80144a:	89 e5                	mov    %esp,%ebp
+  80144c:	57                   	push   %edi
+  80144d:	56                   	push   %esi
+  80144e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80144f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801456:	74 1a                	je     801472 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801458:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80145d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801462:	8b 55 08             	mov    0x8(%ebp),%edx
+  801465:	89 cb                	mov    %ecx,%ebx
+  801467:	89 cf                	mov    %ecx,%edi
+  801469:	89 ce                	mov    %ecx,%esi
+  80146b:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80146d:	5b                   	pop    %ebx
+  80146e:	5e                   	pop    %esi
+  80146f:	5f                   	pop    %edi
+  801470:	5d                   	pop    %ebp
+  801471:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801472:	8b 55 08             	mov    0x8(%ebp),%edx
+  801475:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80147a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80147f:	89 cb                	mov    %ecx,%ebx
+  801481:	89 cf                	mov    %ecx,%edi
+  801483:	55                   	push   %ebp
+  801484:	89 e5                	mov    %esp,%ebp
+  801486:	8d 35 8e 14 80 00    	lea    0x80148e,%esi
+  80148c:	0f 34                	sysenter
+  80148e:	5d                   	pop    %ebp
+		goto out;
+  80148f:	eb dc                	jmp    80146d <sys_trace_ctl+0x24>
+
+00801491 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801491:	55                   	push   %ebp
+  801492:	89 e5                	mov    %esp,%ebp
+  801494:	57                   	push   %edi
+  801495:	56                   	push   %esi
+  801496:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801497:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80149e:	74 1c                	je     8014bc <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b3:	89 f7                	mov    %esi,%edi
+  8014b5:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014b7:	5b                   	pop    %ebx
+  8014b8:	5e                   	pop    %esi
+  8014b9:	5f                   	pop    %edi
+  8014ba:	5d                   	pop    %ebp
+  8014bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	8d 35 da 14 80 00    	lea    0x8014da,%esi
+  8014d8:	0f 34                	sysenter
+  8014da:	5d                   	pop    %ebp
+		goto out;
+  8014db:	eb da                	jmp    8014b7 <sys_trace_read+0x26>
+
+008014dd <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014dd:	55                   	push   %ebp
+  8014de:	89 e5                	mov    %esp,%ebp
+  8014e0:	57                   	push   %edi
+  8014e1:	56                   	push   %esi
+  8014e2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014e3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ea:	74 1c                	je     801508 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8014ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f1:	b8 21 00 00 00       	mov    $0x21,%eax
+  8014f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ff:	89 f7                	mov    %esi,%edi
+  801501:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801503:	5b                   	pop    %ebx
+  801504:	5e                   	pop    %esi
+  801505:	5f                   	pop    %edi
+  801506:	5d                   	pop    %ebp
+  801507:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801508:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150e:	b8 21 00 00 00       	mov    $0x21,%eax
+  801513:	bf 00 00 00 00       	mov    $0x0,%edi
+  801518:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	8d 35 26 15 80 00    	lea    0x801526,%esi
+  801524:	0f 34                	sysenter
+  801526:	5d                   	pop    %ebp
+		goto out;
+  801527:	eb da                	jmp    801503 <sys_meminfo+0x26>
+
+00801529 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801529:	55                   	push   %ebp
+  80152a:	89 e5                	mov    %esp,%ebp
+  80152c:	57                   	push   %edi
+  80152d:	56                   	push   %esi
+  80152e:	53                   	push   %ebx
+  80152f:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801532:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801536:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80153d:	74 1f                	je     80155e <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80153f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801544:	b8 22 00 00 00       	mov    $0x22,%eax
+  801549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154c:	89 df                	mov    %ebx,%edi
+  80154e:	89 de                	mov    %ebx,%esi
+  801550:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801552:	85 c0                	test   %eax,%eax
+  801554:	7f 25                	jg     80157b <sys_env_set_ksm+0x52>
+}
+  801556:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801559:	5b                   	pop    %ebx
+  80155a:	5e                   	pop    %esi
+  80155b:	5f                   	pop    %edi
+  80155c:	5d                   	pop    %ebp
+  80155d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80155e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801563:	8b 55 08             	mov    0x8(%ebp),%edx
+  801566:	b8 22 00 00 00       	mov    $0x22,%eax
+  80156b:	89 df                	mov    %ebx,%edi
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	8d 35 78 15 80 00    	lea    0x801578,%esi
+  801576:	0f 34                	sysenter
+  801578:	5d                   	pop    %ebp
+		goto out;
+  801579:	eb d7                	jmp    801552 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80157b:	83 ec 0c             	sub    $0xc,%esp
+  80157e:	50                   	push   %eax
+  80157f:	6a 22                	push   $0x22
+  801581:	68 cb 2e 80 00       	push   $0x802ecb
+  801586:	6a 3f                	push   $0x3f
+  801588:	68 e8 2e 80 00       	push   $0x802ee8
+  80158d:	e8 6c eb ff ff       	call   8000fe <_panic>
+
+00801592 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801592:	55                   	push   %ebp
+  801593:	89 e5                	mov    %esp,%ebp
+  801595:	57                   	push   %edi
+  801596:	56                   	push   %esi
+  801597:	53                   	push   %ebx
+  801598:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80159b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80159e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015a5:	74 24                	je     8015cb <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015b1:	89 cb                	mov    %ecx,%ebx
+  8015b3:	89 cf                	mov    %ecx,%edi
+  8015b5:	89 ce                	mov    %ecx,%esi
+  8015b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015b9:	85 c0                	test   %eax,%eax
+  8015bb:	7f 2a                	jg     8015e7 <sys_time_nsec+0x55>
+	return ns;
+}
+  8015bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015c0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c6:	5b                   	pop    %ebx
+  8015c7:	5e                   	pop    %esi
+  8015c8:	5f                   	pop    %edi
+  8015c9:	5d                   	pop    %ebp
+  8015ca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015d5:	89 cb                	mov    %ecx,%ebx
+  8015d7:	89 cf                	mov    %ecx,%edi
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	8d 35 e4 15 80 00    	lea    0x8015e4,%esi
+  8015e2:	0f 34                	sysenter
+  8015e4:	5d                   	pop    %ebp
+		goto out;
+  8015e5:	eb d2                	jmp    8015b9 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015e7:	83 ec 0c             	sub    $0xc,%esp
+  8015ea:	50                   	push   %eax
+  8015eb:	6a 0f                	push   $0xf
+  8015ed:	68 cb 2e 80 00       	push   $0x802ecb
+  8015f2:	6a 3f                	push   $0x3f
+  8015f4:	68 e8 2e 80 00       	push   $0x802ee8
+  8015f9:	e8 00 eb ff ff       	call   8000fe <_panic>
+
+008015fe <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8015fe:	55                   	push   %ebp
+  8015ff:	89 e5                	mov    %esp,%ebp
+  801601:	57                   	push   %edi
+  801602:	56                   	push   %esi
+  801603:	53                   	push   %ebx
+  801604:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801607:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80160e:	74 22                	je     801632 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801610:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801615:	b8 12 00 00 00       	mov    $0x12,%eax
+  80161a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801620:	89 df                	mov    %ebx,%edi
+  801622:	89 de                	mov    %ebx,%esi
+  801624:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801626:	85 c0                	test   %eax,%eax
+  801628:	7f 28                	jg     801652 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80162a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162d:	5b                   	pop    %ebx
+  80162e:	5e                   	pop    %esi
+  80162f:	5f                   	pop    %edi
+  801630:	5d                   	pop    %ebp
+  801631:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801632:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801637:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801642:	89 df                	mov    %ebx,%edi
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	8d 35 4f 16 80 00    	lea    0x80164f,%esi
+  80164d:	0f 34                	sysenter
+  80164f:	5d                   	pop    %ebp
+		goto out;
+  801650:	eb d4                	jmp    801626 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801652:	83 ec 0c             	sub    $0xc,%esp
+  801655:	50                   	push   %eax
+  801656:	6a 12                	push   $0x12
+  801658:	68 cb 2e 80 00       	push   $0x802ecb
+  80165d:	6a 3f                	push   $0x3f
+  80165f:	68 e8 2e 80 00       	push   $0x802ee8
+  801664:	e8 95 ea ff ff       	call   8000fe <_panic>
+
+00801669 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801669:	55                   	push   %ebp
+  80166a:	89 e5                	mov    %esp,%ebp
+  80166c:	57                   	push   %edi
+  80166d:	56                   	push   %esi
+  80166e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80166f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801676:	74 1b                	je     801693 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801678:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801682:	8b 55 08             	mov    0x8(%ebp),%edx
+  801685:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801688:	89 df                	mov    %ebx,%edi
+  80168a:	89 de                	mov    %ebx,%esi
+  80168c:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80168e:	5b                   	pop    %ebx
+  80168f:	5e                   	pop    %esi
+  801690:	5f                   	pop    %edi
+  801691:	5d                   	pop    %ebp
+  801692:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801693:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801698:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169e:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016a3:	89 df                	mov    %ebx,%edi
+  8016a5:	55                   	push   %ebp
+  8016a6:	89 e5                	mov    %esp,%ebp
+  8016a8:	8d 35 b0 16 80 00    	lea    0x8016b0,%esi
+  8016ae:	0f 34                	sysenter
+  8016b0:	5d                   	pop    %ebp
+		goto out;
+  8016b1:	eb db                	jmp    80168e <sys_e1000_receive+0x25>
+
+008016b3 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016b3:	55                   	push   %ebp
+  8016b4:	89 e5                	mov    %esp,%ebp
+  8016b6:	57                   	push   %edi
+  8016b7:	56                   	push   %esi
+  8016b8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016b9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016c0:	74 1b                	je     8016dd <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d2:	89 df                	mov    %ebx,%edi
+  8016d4:	89 de                	mov    %ebx,%esi
+  8016d6:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016d8:	5b                   	pop    %ebx
+  8016d9:	5e                   	pop    %esi
+  8016da:	5f                   	pop    %edi
+  8016db:	5d                   	pop    %ebp
+  8016dc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016ed:	89 df                	mov    %ebx,%edi
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	8d 35 fa 16 80 00    	lea    0x8016fa,%esi
+  8016f8:	0f 34                	sysenter
+  8016fa:	5d                   	pop    %ebp
+		goto out;
+  8016fb:	eb db                	jmp    8016d8 <sys_e1000_read_hwaddr+0x25>
+
+008016fd <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8016fd:	55                   	push   %ebp
+  8016fe:	89 e5                	mov    %esp,%ebp
+  801700:	57                   	push   %edi
+  801701:	56                   	push   %esi
+  801702:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801703:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80170a:	74 1a                	je     801726 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80170c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801711:	b8 15 00 00 00       	mov    $0x15,%eax
+  801716:	8b 55 08             	mov    0x8(%ebp),%edx
+  801719:	89 cb                	mov    %ecx,%ebx
+  80171b:	89 cf                	mov    %ecx,%edi
+  80171d:	89 ce                	mov    %ecx,%esi
+  80171f:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801721:	5b                   	pop    %ebx
+  801722:	5e                   	pop    %esi
+  801723:	5f                   	pop    %edi
+  801724:	5d                   	pop    %ebp
+  801725:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801726:	8b 55 08             	mov    0x8(%ebp),%edx
+  801729:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80172e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801733:	89 cb                	mov    %ecx,%ebx
+  801735:	89 cf                	mov    %ecx,%edi
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	8d 35 42 17 80 00    	lea    0x801742,%esi
+  801740:	0f 34                	sysenter
+  801742:	5d                   	pop    %ebp
+		goto out;
+  801743:	eb dc                	jmp    801721 <sys_sb16_read_version+0x24>
+
+00801745 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801745:	55                   	push   %ebp
+  801746:	89 e5                	mov    %esp,%ebp
+  801748:	57                   	push   %edi
+  801749:	56                   	push   %esi
+  80174a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80174b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801752:	74 1b                	je     80176f <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801754:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801759:	b8 16 00 00 00       	mov    $0x16,%eax
+  80175e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801761:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801764:	89 df                	mov    %ebx,%edi
+  801766:	89 de                	mov    %ebx,%esi
+  801768:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80176a:	5b                   	pop    %ebx
+  80176b:	5e                   	pop    %esi
+  80176c:	5f                   	pop    %edi
+  80176d:	5d                   	pop    %ebp
+  80176e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80176f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801774:	8b 55 08             	mov    0x8(%ebp),%edx
+  801777:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80177f:	89 df                	mov    %ebx,%edi
+  801781:	55                   	push   %ebp
+  801782:	89 e5                	mov    %esp,%ebp
+  801784:	8d 35 8c 17 80 00    	lea    0x80178c,%esi
+  80178a:	0f 34                	sysenter
+  80178c:	5d                   	pop    %ebp
+		goto out;
+  80178d:	eb db                	jmp    80176a <sys_sb16_play+0x25>
+
+0080178f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80178f:	55                   	push   %ebp
+  801790:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801792:	8b 45 08             	mov    0x8(%ebp),%eax
+  801795:	05 00 00 00 30       	add    $0x30000000,%eax
+  80179a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80179d:	5d                   	pop    %ebp
+  80179e:	c3                   	ret
+
+0080179f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80179f:	55                   	push   %ebp
+  8017a0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017aa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017af:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017b4:	5d                   	pop    %ebp
+  8017b5:	c3                   	ret
+
+008017b6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017b9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017be:	eb 02                	jmp    8017c2 <fd_alloc+0xc>
+  8017c0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017c2:	89 c2                	mov    %eax,%edx
+  8017c4:	c1 ea 16             	shr    $0x16,%edx
+  8017c7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017ce:	f6 c2 01             	test   $0x1,%dl
+  8017d1:	74 2b                	je     8017fe <fd_alloc+0x48>
+  8017d3:	89 c2                	mov    %eax,%edx
+  8017d5:	c1 ea 0c             	shr    $0xc,%edx
+  8017d8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017df:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017e5:	f6 c1 01             	test   $0x1,%cl
+  8017e8:	74 14                	je     8017fe <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017ea:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017f0:	75 ce                	jne    8017c0 <fd_alloc+0xa>
+  8017f2:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8017f7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8017fc:	eb 05                	jmp    801803 <fd_alloc+0x4d>
+			return 0;
+  8017fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801803:	8b 55 08             	mov    0x8(%ebp),%edx
+  801806:	89 02                	mov    %eax,(%edx)
+}
+  801808:	89 c8                	mov    %ecx,%eax
+  80180a:	5d                   	pop    %ebp
+  80180b:	c3                   	ret
+
+0080180c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80180c:	55                   	push   %ebp
+  80180d:	89 e5                	mov    %esp,%ebp
+  80180f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801812:	83 f8 1f             	cmp    $0x1f,%eax
+  801815:	77 30                	ja     801847 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801817:	c1 e0 0c             	shl    $0xc,%eax
+  80181a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80181f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801825:	f6 c2 01             	test   $0x1,%dl
+  801828:	74 24                	je     80184e <fd_lookup+0x42>
+  80182a:	89 c2                	mov    %eax,%edx
+  80182c:	c1 ea 0c             	shr    $0xc,%edx
+  80182f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801836:	f6 c2 01             	test   $0x1,%dl
+  801839:	74 1a                	je     801855 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80183b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80183e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801840:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801845:	5d                   	pop    %ebp
+  801846:	c3                   	ret
+		return -E_INVAL;
+  801847:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184c:	eb f7                	jmp    801845 <fd_lookup+0x39>
+		return -E_INVAL;
+  80184e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801853:	eb f0                	jmp    801845 <fd_lookup+0x39>
+  801855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185a:	eb e9                	jmp    801845 <fd_lookup+0x39>
+
+0080185c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80185c:	55                   	push   %ebp
+  80185d:	89 e5                	mov    %esp,%ebp
+  80185f:	53                   	push   %ebx
+  801860:	83 ec 04             	sub    $0x4,%esp
+  801863:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801866:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186b:	eb 03                	jmp    801870 <dev_lookup+0x14>
+  80186d:	83 c0 01             	add    $0x1,%eax
+  801870:	8b 1c 85 74 2f 80 00 	mov    0x802f74(,%eax,4),%ebx
+  801877:	85 db                	test   %ebx,%ebx
+  801879:	74 0b                	je     801886 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80187b:	39 13                	cmp    %edx,(%ebx)
+  80187d:	75 ee                	jne    80186d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80187f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801884:	eb 2e                	jmp    8018b4 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801886:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801888:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80188d:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801893:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801898:	76 24                	jbe    8018be <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80189a:	8b 41 48             	mov    0x48(%ecx),%eax
+  80189d:	83 ec 04             	sub    $0x4,%esp
+  8018a0:	52                   	push   %edx
+  8018a1:	50                   	push   %eax
+  8018a2:	68 f8 2e 80 00       	push   $0x802ef8
+  8018a7:	e8 2d e9 ff ff       	call   8001d9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018ac:	83 c4 10             	add    $0x10,%esp
+  8018af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018b7:	89 1a                	mov    %ebx,(%edx)
+}
+  8018b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018bc:	c9                   	leave
+  8018bd:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018be:	c1 e8 10             	shr    $0x10,%eax
+  8018c1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018c7:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018cd:	eb cb                	jmp    80189a <dev_lookup+0x3e>
+
+008018cf <fd_close>:
+{
+  8018cf:	55                   	push   %ebp
+  8018d0:	89 e5                	mov    %esp,%ebp
+  8018d2:	57                   	push   %edi
+  8018d3:	56                   	push   %esi
+  8018d4:	53                   	push   %ebx
+  8018d5:	83 ec 24             	sub    $0x24,%esp
+  8018d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018de:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018e1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018e2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018e8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018eb:	50                   	push   %eax
+  8018ec:	e8 1b ff ff ff       	call   80180c <fd_lookup>
+  8018f1:	89 c3                	mov    %eax,%ebx
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	85 c0                	test   %eax,%eax
+  8018f8:	78 05                	js     8018ff <fd_close+0x30>
+	    || fd != fd2)
+  8018fa:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018fd:	74 16                	je     801915 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8018ff:	89 f8                	mov    %edi,%eax
+  801901:	84 c0                	test   %al,%al
+  801903:	b8 00 00 00 00       	mov    $0x0,%eax
+  801908:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80190b:	89 d8                	mov    %ebx,%eax
+  80190d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801910:	5b                   	pop    %ebx
+  801911:	5e                   	pop    %esi
+  801912:	5f                   	pop    %edi
+  801913:	5d                   	pop    %ebp
+  801914:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801915:	83 ec 08             	sub    $0x8,%esp
+  801918:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80191b:	50                   	push   %eax
+  80191c:	ff 36                	push   (%esi)
+  80191e:	e8 39 ff ff ff       	call   80185c <dev_lookup>
+  801923:	89 c3                	mov    %eax,%ebx
+  801925:	83 c4 10             	add    $0x10,%esp
+  801928:	85 c0                	test   %eax,%eax
+  80192a:	78 1a                	js     801946 <fd_close+0x77>
+		if (dev->dev_close)
+  80192c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80192f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801932:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801937:	85 c0                	test   %eax,%eax
+  801939:	74 0b                	je     801946 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80193b:	83 ec 0c             	sub    $0xc,%esp
+  80193e:	56                   	push   %esi
+  80193f:	ff d0                	call   *%eax
+  801941:	89 c3                	mov    %eax,%ebx
+  801943:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801946:	83 ec 08             	sub    $0x8,%esp
+  801949:	56                   	push   %esi
+  80194a:	6a 00                	push   $0x0
+  80194c:	e8 a3 f4 ff ff       	call   800df4 <sys_page_unmap>
+	return r;
+  801951:	83 c4 10             	add    $0x10,%esp
+  801954:	eb b5                	jmp    80190b <fd_close+0x3c>
+
+00801956 <close>:
+
+int
+close(int fdnum)
+{
+  801956:	55                   	push   %ebp
+  801957:	89 e5                	mov    %esp,%ebp
+  801959:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80195c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80195f:	50                   	push   %eax
+  801960:	ff 75 08             	push   0x8(%ebp)
+  801963:	e8 a4 fe ff ff       	call   80180c <fd_lookup>
+  801968:	83 c4 10             	add    $0x10,%esp
+  80196b:	85 c0                	test   %eax,%eax
+  80196d:	79 02                	jns    801971 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80196f:	c9                   	leave
+  801970:	c3                   	ret
+		return fd_close(fd, 1);
+  801971:	83 ec 08             	sub    $0x8,%esp
+  801974:	6a 01                	push   $0x1
+  801976:	ff 75 f4             	push   -0xc(%ebp)
+  801979:	e8 51 ff ff ff       	call   8018cf <fd_close>
+  80197e:	83 c4 10             	add    $0x10,%esp
+  801981:	eb ec                	jmp    80196f <close+0x19>
+
+00801983 <close_all>:
+
+void
+close_all(void)
+{
+  801983:	55                   	push   %ebp
+  801984:	89 e5                	mov    %esp,%ebp
+  801986:	53                   	push   %ebx
+  801987:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80198a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80198f:	83 ec 0c             	sub    $0xc,%esp
+  801992:	53                   	push   %ebx
+  801993:	e8 be ff ff ff       	call   801956 <close>
+	for (i = 0; i < MAXFD; i++)
+  801998:	83 c3 01             	add    $0x1,%ebx
+  80199b:	83 c4 10             	add    $0x10,%esp
+  80199e:	83 fb 20             	cmp    $0x20,%ebx
+  8019a1:	75 ec                	jne    80198f <close_all+0xc>
+}
+  8019a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a6:	c9                   	leave
+  8019a7:	c3                   	ret
+
+008019a8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019a8:	55                   	push   %ebp
+  8019a9:	89 e5                	mov    %esp,%ebp
+  8019ab:	57                   	push   %edi
+  8019ac:	56                   	push   %esi
+  8019ad:	53                   	push   %ebx
+  8019ae:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019b1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019b4:	50                   	push   %eax
+  8019b5:	ff 75 08             	push   0x8(%ebp)
+  8019b8:	e8 4f fe ff ff       	call   80180c <fd_lookup>
+  8019bd:	89 c3                	mov    %eax,%ebx
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 7f                	js     801a45 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019c6:	83 ec 0c             	sub    $0xc,%esp
+  8019c9:	ff 75 0c             	push   0xc(%ebp)
+  8019cc:	e8 85 ff ff ff       	call   801956 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019d4:	c1 e6 0c             	shl    $0xc,%esi
+  8019d7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019e0:	89 3c 24             	mov    %edi,(%esp)
+  8019e3:	e8 b7 fd ff ff       	call   80179f <fd2data>
+  8019e8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019ea:	89 34 24             	mov    %esi,(%esp)
+  8019ed:	e8 ad fd ff ff       	call   80179f <fd2data>
+  8019f2:	83 c4 10             	add    $0x10,%esp
+  8019f5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8019f8:	89 d8                	mov    %ebx,%eax
+  8019fa:	c1 e8 16             	shr    $0x16,%eax
+  8019fd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a04:	a8 01                	test   $0x1,%al
+  801a06:	74 11                	je     801a19 <dup+0x71>
+  801a08:	89 d8                	mov    %ebx,%eax
+  801a0a:	c1 e8 0c             	shr    $0xc,%eax
+  801a0d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a14:	f6 c2 01             	test   $0x1,%dl
+  801a17:	75 36                	jne    801a4f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a19:	89 f8                	mov    %edi,%eax
+  801a1b:	c1 e8 0c             	shr    $0xc,%eax
+  801a1e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a25:	83 ec 0c             	sub    $0xc,%esp
+  801a28:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a2d:	50                   	push   %eax
+  801a2e:	56                   	push   %esi
+  801a2f:	6a 00                	push   $0x0
+  801a31:	57                   	push   %edi
+  801a32:	6a 00                	push   $0x0
+  801a34:	e8 4d f3 ff ff       	call   800d86 <sys_page_map>
+  801a39:	89 c3                	mov    %eax,%ebx
+  801a3b:	83 c4 20             	add    $0x20,%esp
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 33                	js     801a75 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a42:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a45:	89 d8                	mov    %ebx,%eax
+  801a47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4a:	5b                   	pop    %ebx
+  801a4b:	5e                   	pop    %esi
+  801a4c:	5f                   	pop    %edi
+  801a4d:	5d                   	pop    %ebp
+  801a4e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a4f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a56:	83 ec 0c             	sub    $0xc,%esp
+  801a59:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a5e:	50                   	push   %eax
+  801a5f:	ff 75 d4             	push   -0x2c(%ebp)
+  801a62:	6a 00                	push   $0x0
+  801a64:	53                   	push   %ebx
+  801a65:	6a 00                	push   $0x0
+  801a67:	e8 1a f3 ff ff       	call   800d86 <sys_page_map>
+  801a6c:	89 c3                	mov    %eax,%ebx
+  801a6e:	83 c4 20             	add    $0x20,%esp
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	79 a4                	jns    801a19 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a75:	83 ec 08             	sub    $0x8,%esp
+  801a78:	56                   	push   %esi
+  801a79:	6a 00                	push   $0x0
+  801a7b:	e8 74 f3 ff ff       	call   800df4 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a80:	83 c4 08             	add    $0x8,%esp
+  801a83:	ff 75 d4             	push   -0x2c(%ebp)
+  801a86:	6a 00                	push   $0x0
+  801a88:	e8 67 f3 ff ff       	call   800df4 <sys_page_unmap>
+	return r;
+  801a8d:	83 c4 10             	add    $0x10,%esp
+  801a90:	eb b3                	jmp    801a45 <dup+0x9d>
+
+00801a92 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a92:	55                   	push   %ebp
+  801a93:	89 e5                	mov    %esp,%ebp
+  801a95:	56                   	push   %esi
+  801a96:	53                   	push   %ebx
+  801a97:	83 ec 18             	sub    $0x18,%esp
+  801a9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aa0:	50                   	push   %eax
+  801aa1:	53                   	push   %ebx
+  801aa2:	e8 65 fd ff ff       	call   80180c <fd_lookup>
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	78 3c                	js     801aea <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ab1:	83 ec 08             	sub    $0x8,%esp
+  801ab4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab7:	50                   	push   %eax
+  801ab8:	ff 36                	push   (%esi)
+  801aba:	e8 9d fd ff ff       	call   80185c <dev_lookup>
+  801abf:	83 c4 10             	add    $0x10,%esp
+  801ac2:	85 c0                	test   %eax,%eax
+  801ac4:	78 24                	js     801aea <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ac6:	8b 46 08             	mov    0x8(%esi),%eax
+  801ac9:	83 e0 03             	and    $0x3,%eax
+  801acc:	83 f8 01             	cmp    $0x1,%eax
+  801acf:	74 20                	je     801af1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ad1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad4:	8b 40 08             	mov    0x8(%eax),%eax
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	74 57                	je     801b32 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801adb:	83 ec 04             	sub    $0x4,%esp
+  801ade:	ff 75 10             	push   0x10(%ebp)
+  801ae1:	ff 75 0c             	push   0xc(%ebp)
+  801ae4:	56                   	push   %esi
+  801ae5:	ff d0                	call   *%eax
+  801ae7:	83 c4 10             	add    $0x10,%esp
+}
+  801aea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aed:	5b                   	pop    %ebx
+  801aee:	5e                   	pop    %esi
+  801aef:	5d                   	pop    %ebp
+  801af0:	c3                   	ret
+  801af1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801af3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801af8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801afe:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b03:	76 1c                	jbe    801b21 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b05:	8b 42 48             	mov    0x48(%edx),%eax
+  801b08:	83 ec 04             	sub    $0x4,%esp
+  801b0b:	53                   	push   %ebx
+  801b0c:	50                   	push   %eax
+  801b0d:	68 39 2f 80 00       	push   $0x802f39
+  801b12:	e8 c2 e6 ff ff       	call   8001d9 <cprintf>
+		return -E_INVAL;
+  801b17:	83 c4 10             	add    $0x10,%esp
+  801b1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b1f:	eb c9                	jmp    801aea <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b21:	c1 e8 10             	shr    $0x10,%eax
+  801b24:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b2a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b30:	eb d3                	jmp    801b05 <read+0x73>
+		return -E_NOT_SUPP;
+  801b32:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b37:	eb b1                	jmp    801aea <read+0x58>
+
+00801b39 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b39:	55                   	push   %ebp
+  801b3a:	89 e5                	mov    %esp,%ebp
+  801b3c:	57                   	push   %edi
+  801b3d:	56                   	push   %esi
+  801b3e:	53                   	push   %ebx
+  801b3f:	83 ec 0c             	sub    $0xc,%esp
+  801b42:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b45:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4d:	eb 02                	jmp    801b51 <readn+0x18>
+  801b4f:	01 c3                	add    %eax,%ebx
+  801b51:	39 f3                	cmp    %esi,%ebx
+  801b53:	73 21                	jae    801b76 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b55:	83 ec 04             	sub    $0x4,%esp
+  801b58:	89 f0                	mov    %esi,%eax
+  801b5a:	29 d8                	sub    %ebx,%eax
+  801b5c:	50                   	push   %eax
+  801b5d:	89 d8                	mov    %ebx,%eax
+  801b5f:	03 45 0c             	add    0xc(%ebp),%eax
+  801b62:	50                   	push   %eax
+  801b63:	57                   	push   %edi
+  801b64:	e8 29 ff ff ff       	call   801a92 <read>
+		if (m < 0)
+  801b69:	83 c4 10             	add    $0x10,%esp
+  801b6c:	85 c0                	test   %eax,%eax
+  801b6e:	78 04                	js     801b74 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b70:	75 dd                	jne    801b4f <readn+0x16>
+  801b72:	eb 02                	jmp    801b76 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b74:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b76:	89 d8                	mov    %ebx,%eax
+  801b78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b7b:	5b                   	pop    %ebx
+  801b7c:	5e                   	pop    %esi
+  801b7d:	5f                   	pop    %edi
+  801b7e:	5d                   	pop    %ebp
+  801b7f:	c3                   	ret
+
+00801b80 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+  801b83:	56                   	push   %esi
+  801b84:	53                   	push   %ebx
+  801b85:	83 ec 18             	sub    $0x18,%esp
+  801b88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b8b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b8e:	50                   	push   %eax
+  801b8f:	53                   	push   %ebx
+  801b90:	e8 77 fc ff ff       	call   80180c <fd_lookup>
+  801b95:	83 c4 10             	add    $0x10,%esp
+  801b98:	85 c0                	test   %eax,%eax
+  801b9a:	78 37                	js     801bd3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b9c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b9f:	83 ec 08             	sub    $0x8,%esp
+  801ba2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba5:	50                   	push   %eax
+  801ba6:	ff 36                	push   (%esi)
+  801ba8:	e8 af fc ff ff       	call   80185c <dev_lookup>
+  801bad:	83 c4 10             	add    $0x10,%esp
+  801bb0:	85 c0                	test   %eax,%eax
+  801bb2:	78 1f                	js     801bd3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bb4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bb8:	74 20                	je     801bda <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bbd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	74 57                	je     801c1b <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bc4:	83 ec 04             	sub    $0x4,%esp
+  801bc7:	ff 75 10             	push   0x10(%ebp)
+  801bca:	ff 75 0c             	push   0xc(%ebp)
+  801bcd:	56                   	push   %esi
+  801bce:	ff d0                	call   *%eax
+  801bd0:	83 c4 10             	add    $0x10,%esp
+}
+  801bd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd6:	5b                   	pop    %ebx
+  801bd7:	5e                   	pop    %esi
+  801bd8:	5d                   	pop    %ebp
+  801bd9:	c3                   	ret
+  801bda:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bdc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801be1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801be7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bec:	76 1c                	jbe    801c0a <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bee:	8b 42 48             	mov    0x48(%edx),%eax
+  801bf1:	83 ec 04             	sub    $0x4,%esp
+  801bf4:	53                   	push   %ebx
+  801bf5:	50                   	push   %eax
+  801bf6:	68 55 2f 80 00       	push   $0x802f55
+  801bfb:	e8 d9 e5 ff ff       	call   8001d9 <cprintf>
+		return -E_INVAL;
+  801c00:	83 c4 10             	add    $0x10,%esp
+  801c03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c08:	eb c9                	jmp    801bd3 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c0a:	c1 e8 10             	shr    $0x10,%eax
+  801c0d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c13:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c19:	eb d3                	jmp    801bee <write+0x6e>
+		return -E_NOT_SUPP;
+  801c1b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c20:	eb b1                	jmp    801bd3 <write+0x53>
+
+00801c22 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c2b:	50                   	push   %eax
+  801c2c:	ff 75 08             	push   0x8(%ebp)
+  801c2f:	e8 d8 fb ff ff       	call   80180c <fd_lookup>
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	78 0e                	js     801c49 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c41:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c49:	c9                   	leave
+  801c4a:	c3                   	ret
+
+00801c4b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c4b:	55                   	push   %ebp
+  801c4c:	89 e5                	mov    %esp,%ebp
+  801c4e:	56                   	push   %esi
+  801c4f:	53                   	push   %ebx
+  801c50:	83 ec 18             	sub    $0x18,%esp
+  801c53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c56:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c59:	50                   	push   %eax
+  801c5a:	53                   	push   %ebx
+  801c5b:	e8 ac fb ff ff       	call   80180c <fd_lookup>
+  801c60:	83 c4 10             	add    $0x10,%esp
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	78 34                	js     801c9b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c67:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c6a:	83 ec 08             	sub    $0x8,%esp
+  801c6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c70:	50                   	push   %eax
+  801c71:	ff 36                	push   (%esi)
+  801c73:	e8 e4 fb ff ff       	call   80185c <dev_lookup>
+  801c78:	83 c4 10             	add    $0x10,%esp
+  801c7b:	85 c0                	test   %eax,%eax
+  801c7d:	78 1c                	js     801c9b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c7f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c83:	74 1d                	je     801ca2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c88:	8b 40 18             	mov    0x18(%eax),%eax
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	74 54                	je     801ce3 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c8f:	83 ec 08             	sub    $0x8,%esp
+  801c92:	ff 75 0c             	push   0xc(%ebp)
+  801c95:	56                   	push   %esi
+  801c96:	ff d0                	call   *%eax
+  801c98:	83 c4 10             	add    $0x10,%esp
+}
+  801c9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c9e:	5b                   	pop    %ebx
+  801c9f:	5e                   	pop    %esi
+  801ca0:	5d                   	pop    %ebp
+  801ca1:	c3                   	ret
+  801ca2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ca4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ca9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801caf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cb4:	76 1c                	jbe    801cd2 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cb6:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cb9:	83 ec 04             	sub    $0x4,%esp
+  801cbc:	53                   	push   %ebx
+  801cbd:	50                   	push   %eax
+  801cbe:	68 18 2f 80 00       	push   $0x802f18
+  801cc3:	e8 11 e5 ff ff       	call   8001d9 <cprintf>
+		return -E_INVAL;
+  801cc8:	83 c4 10             	add    $0x10,%esp
+  801ccb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cd0:	eb c9                	jmp    801c9b <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cd2:	c1 e8 10             	shr    $0x10,%eax
+  801cd5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cdb:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ce1:	eb d3                	jmp    801cb6 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801ce3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce8:	eb b1                	jmp    801c9b <ftruncate+0x50>
+
+00801cea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	56                   	push   %esi
+  801cee:	53                   	push   %ebx
+  801cef:	83 ec 18             	sub    $0x18,%esp
+  801cf2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cf5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cf8:	50                   	push   %eax
+  801cf9:	ff 75 08             	push   0x8(%ebp)
+  801cfc:	e8 0b fb ff ff       	call   80180c <fd_lookup>
+  801d01:	83 c4 10             	add    $0x10,%esp
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	78 49                	js     801d51 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d08:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d0b:	83 ec 08             	sub    $0x8,%esp
+  801d0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d11:	50                   	push   %eax
+  801d12:	ff 36                	push   (%esi)
+  801d14:	e8 43 fb ff ff       	call   80185c <dev_lookup>
+  801d19:	83 c4 10             	add    $0x10,%esp
+  801d1c:	85 c0                	test   %eax,%eax
+  801d1e:	78 31                	js     801d51 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d23:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d27:	74 2f                	je     801d58 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d29:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d2c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d33:	00 00 00 
+	stat->st_isdir = 0;
+  801d36:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d3d:	00 00 00 
+	stat->st_dev = dev;
+  801d40:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d46:	83 ec 08             	sub    $0x8,%esp
+  801d49:	53                   	push   %ebx
+  801d4a:	56                   	push   %esi
+  801d4b:	ff 50 14             	call   *0x14(%eax)
+  801d4e:	83 c4 10             	add    $0x10,%esp
+}
+  801d51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d54:	5b                   	pop    %ebx
+  801d55:	5e                   	pop    %esi
+  801d56:	5d                   	pop    %ebp
+  801d57:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d58:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d5d:	eb f2                	jmp    801d51 <fstat+0x67>
+
+00801d5f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d5f:	55                   	push   %ebp
+  801d60:	89 e5                	mov    %esp,%ebp
+  801d62:	56                   	push   %esi
+  801d63:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d64:	83 ec 08             	sub    $0x8,%esp
+  801d67:	6a 00                	push   $0x0
+  801d69:	ff 75 08             	push   0x8(%ebp)
+  801d6c:	e8 e4 01 00 00       	call   801f55 <open>
+  801d71:	89 c3                	mov    %eax,%ebx
+  801d73:	83 c4 10             	add    $0x10,%esp
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 1b                	js     801d95 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+  801d7d:	ff 75 0c             	push   0xc(%ebp)
+  801d80:	50                   	push   %eax
+  801d81:	e8 64 ff ff ff       	call   801cea <fstat>
+  801d86:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d88:	89 1c 24             	mov    %ebx,(%esp)
+  801d8b:	e8 c6 fb ff ff       	call   801956 <close>
+	return r;
+  801d90:	83 c4 10             	add    $0x10,%esp
+  801d93:	89 f3                	mov    %esi,%ebx
+}
+  801d95:	89 d8                	mov    %ebx,%eax
+  801d97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9a:	5b                   	pop    %ebx
+  801d9b:	5e                   	pop    %esi
+  801d9c:	5d                   	pop    %ebp
+  801d9d:	c3                   	ret
+
+00801d9e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d9e:	55                   	push   %ebp
+  801d9f:	89 e5                	mov    %esp,%ebp
+  801da1:	56                   	push   %esi
+  801da2:	53                   	push   %ebx
+  801da3:	89 c6                	mov    %eax,%esi
+  801da5:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801da7:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801dae:	74 27                	je     801dd7 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801db0:	6a 07                	push   $0x7
+  801db2:	68 00 60 80 00       	push   $0x806000
+  801db7:	56                   	push   %esi
+  801db8:	ff 35 00 50 80 00    	push   0x805000
+  801dbe:	e8 b2 0c 00 00       	call   802a75 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801dc3:	83 c4 0c             	add    $0xc,%esp
+  801dc6:	6a 00                	push   $0x0
+  801dc8:	53                   	push   %ebx
+  801dc9:	6a 00                	push   $0x0
+  801dcb:	e8 8d 0c 00 00       	call   802a5d <ipc_recv>
+}
+  801dd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd3:	5b                   	pop    %ebx
+  801dd4:	5e                   	pop    %esi
+  801dd5:	5d                   	pop    %ebp
+  801dd6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dd7:	83 ec 0c             	sub    $0xc,%esp
+  801dda:	6a 01                	push   $0x1
+  801ddc:	e8 e8 0c 00 00       	call   802ac9 <ipc_find_env>
+  801de1:	a3 00 50 80 00       	mov    %eax,0x805000
+  801de6:	83 c4 10             	add    $0x10,%esp
+  801de9:	eb c5                	jmp    801db0 <fsipc+0x12>
+
+00801deb <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801deb:	55                   	push   %ebp
+  801dec:	89 e5                	mov    %esp,%ebp
+  801dee:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801df1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801df7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801dfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dff:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e09:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e0e:	e8 8b ff ff ff       	call   801d9e <fsipc>
+}
+  801e13:	c9                   	leave
+  801e14:	c3                   	ret
+
+00801e15 <devfile_flush>:
+{
+  801e15:	55                   	push   %ebp
+  801e16:	89 e5                	mov    %esp,%ebp
+  801e18:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e21:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e30:	e8 69 ff ff ff       	call   801d9e <fsipc>
+}
+  801e35:	c9                   	leave
+  801e36:	c3                   	ret
+
+00801e37 <devfile_stat>:
+{
+  801e37:	55                   	push   %ebp
+  801e38:	89 e5                	mov    %esp,%ebp
+  801e3a:	53                   	push   %ebx
+  801e3b:	83 ec 04             	sub    $0x4,%esp
+  801e3e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e44:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e47:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e51:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e56:	e8 43 ff ff ff       	call   801d9e <fsipc>
+  801e5b:	85 c0                	test   %eax,%eax
+  801e5d:	78 2c                	js     801e8b <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+  801e62:	68 00 60 80 00       	push   $0x806000
+  801e67:	53                   	push   %ebx
+  801e68:	e8 b4 e9 ff ff       	call   800821 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e6d:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e72:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e78:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e7d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e8e:	c9                   	leave
+  801e8f:	c3                   	ret
+
+00801e90 <devfile_write>:
+{
+  801e90:	55                   	push   %ebp
+  801e91:	89 e5                	mov    %esp,%ebp
+  801e93:	83 ec 0c             	sub    $0xc,%esp
+  801e96:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e99:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e9c:	8b 52 0c             	mov    0xc(%edx),%edx
+  801e9f:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801ea5:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801eaa:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801eaf:	39 d0                	cmp    %edx,%eax
+  801eb1:	0f 47 c2             	cmova  %edx,%eax
+  801eb4:	50                   	push   %eax
+  801eb5:	ff 75 0c             	push   0xc(%ebp)
+  801eb8:	68 08 60 80 00       	push   $0x806008
+  801ebd:	e8 e5 ea ff ff       	call   8009a7 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801ec2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec7:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ecc:	e8 cd fe ff ff       	call   801d9e <fsipc>
+}
+  801ed1:	c9                   	leave
+  801ed2:	c3                   	ret
+
+00801ed3 <devfile_read>:
+{
+  801ed3:	55                   	push   %ebp
+  801ed4:	89 e5                	mov    %esp,%ebp
+  801ed6:	56                   	push   %esi
+  801ed7:	53                   	push   %ebx
+  801ed8:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801edb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ede:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ee6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801eec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef1:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ef6:	e8 a3 fe ff ff       	call   801d9e <fsipc>
+  801efb:	89 c3                	mov    %eax,%ebx
+  801efd:	85 c0                	test   %eax,%eax
+  801eff:	78 1f                	js     801f20 <devfile_read+0x4d>
+	assert(r <= n);
+  801f01:	39 c6                	cmp    %eax,%esi
+  801f03:	72 24                	jb     801f29 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f05:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f0a:	7f 33                	jg     801f3f <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f0c:	83 ec 04             	sub    $0x4,%esp
+  801f0f:	50                   	push   %eax
+  801f10:	68 00 60 80 00       	push   $0x806000
+  801f15:	ff 75 0c             	push   0xc(%ebp)
+  801f18:	e8 8a ea ff ff       	call   8009a7 <memmove>
+	return r;
+  801f1d:	83 c4 10             	add    $0x10,%esp
+}
+  801f20:	89 d8                	mov    %ebx,%eax
+  801f22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f25:	5b                   	pop    %ebx
+  801f26:	5e                   	pop    %esi
+  801f27:	5d                   	pop    %ebp
+  801f28:	c3                   	ret
+	assert(r <= n);
+  801f29:	68 88 2f 80 00       	push   $0x802f88
+  801f2e:	68 8f 2f 80 00       	push   $0x802f8f
+  801f33:	6a 76                	push   $0x76
+  801f35:	68 a4 2f 80 00       	push   $0x802fa4
+  801f3a:	e8 bf e1 ff ff       	call   8000fe <_panic>
+	assert(r <= PGSIZE);
+  801f3f:	68 af 2f 80 00       	push   $0x802faf
+  801f44:	68 8f 2f 80 00       	push   $0x802f8f
+  801f49:	6a 77                	push   $0x77
+  801f4b:	68 a4 2f 80 00       	push   $0x802fa4
+  801f50:	e8 a9 e1 ff ff       	call   8000fe <_panic>
+
+00801f55 <open>:
+{
+  801f55:	55                   	push   %ebp
+  801f56:	89 e5                	mov    %esp,%ebp
+  801f58:	56                   	push   %esi
+  801f59:	53                   	push   %ebx
+  801f5a:	83 ec 1c             	sub    $0x1c,%esp
+  801f5d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f60:	56                   	push   %esi
+  801f61:	e8 80 e8 ff ff       	call   8007e6 <strlen>
+  801f66:	83 c4 10             	add    $0x10,%esp
+  801f69:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f6e:	7f 6c                	jg     801fdc <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f70:	83 ec 0c             	sub    $0xc,%esp
+  801f73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f76:	50                   	push   %eax
+  801f77:	e8 3a f8 ff ff       	call   8017b6 <fd_alloc>
+  801f7c:	89 c3                	mov    %eax,%ebx
+  801f7e:	83 c4 10             	add    $0x10,%esp
+  801f81:	85 c0                	test   %eax,%eax
+  801f83:	78 3c                	js     801fc1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f85:	83 ec 08             	sub    $0x8,%esp
+  801f88:	56                   	push   %esi
+  801f89:	68 00 60 80 00       	push   $0x806000
+  801f8e:	e8 8e e8 ff ff       	call   800821 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f93:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f96:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f9b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fa3:	e8 f6 fd ff ff       	call   801d9e <fsipc>
+  801fa8:	89 c3                	mov    %eax,%ebx
+  801faa:	83 c4 10             	add    $0x10,%esp
+  801fad:	85 c0                	test   %eax,%eax
+  801faf:	78 19                	js     801fca <open+0x75>
+	return fd2num(fd);
+  801fb1:	83 ec 0c             	sub    $0xc,%esp
+  801fb4:	ff 75 f4             	push   -0xc(%ebp)
+  801fb7:	e8 d3 f7 ff ff       	call   80178f <fd2num>
+  801fbc:	89 c3                	mov    %eax,%ebx
+  801fbe:	83 c4 10             	add    $0x10,%esp
+}
+  801fc1:	89 d8                	mov    %ebx,%eax
+  801fc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc6:	5b                   	pop    %ebx
+  801fc7:	5e                   	pop    %esi
+  801fc8:	5d                   	pop    %ebp
+  801fc9:	c3                   	ret
+		fd_close(fd, 0);
+  801fca:	83 ec 08             	sub    $0x8,%esp
+  801fcd:	6a 00                	push   $0x0
+  801fcf:	ff 75 f4             	push   -0xc(%ebp)
+  801fd2:	e8 f8 f8 ff ff       	call   8018cf <fd_close>
+		return r;
+  801fd7:	83 c4 10             	add    $0x10,%esp
+  801fda:	eb e5                	jmp    801fc1 <open+0x6c>
+		return -E_BAD_PATH;
+  801fdc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fe1:	eb de                	jmp    801fc1 <open+0x6c>
+
+00801fe3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fee:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ff3:	e8 a6 fd ff ff       	call   801d9e <fsipc>
+}
+  801ff8:	c9                   	leave
+  801ff9:	c3                   	ret
+
+00801ffa <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ffa:	55                   	push   %ebp
+  801ffb:	89 e5                	mov    %esp,%ebp
+  801ffd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802000:	68 bb 2f 80 00       	push   $0x802fbb
+  802005:	ff 75 0c             	push   0xc(%ebp)
+  802008:	e8 14 e8 ff ff       	call   800821 <strcpy>
+	return 0;
+}
+  80200d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802012:	c9                   	leave
+  802013:	c3                   	ret
+
+00802014 <devsock_close>:
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	53                   	push   %ebx
+  802018:	83 ec 10             	sub    $0x10,%esp
+  80201b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80201e:	53                   	push   %ebx
+  80201f:	e8 e4 0a 00 00       	call   802b08 <pageref>
+  802024:	89 c2                	mov    %eax,%edx
+  802026:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802029:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80202e:	83 fa 01             	cmp    $0x1,%edx
+  802031:	74 05                	je     802038 <devsock_close+0x24>
+}
+  802033:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802036:	c9                   	leave
+  802037:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802038:	83 ec 0c             	sub    $0xc,%esp
+  80203b:	ff 73 0c             	push   0xc(%ebx)
+  80203e:	e8 b7 02 00 00       	call   8022fa <nsipc_close>
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	eb eb                	jmp    802033 <devsock_close+0x1f>
+
+00802048 <devsock_write>:
+{
+  802048:	55                   	push   %ebp
+  802049:	89 e5                	mov    %esp,%ebp
+  80204b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80204e:	6a 00                	push   $0x0
+  802050:	ff 75 10             	push   0x10(%ebp)
+  802053:	ff 75 0c             	push   0xc(%ebp)
+  802056:	8b 45 08             	mov    0x8(%ebp),%eax
+  802059:	ff 70 0c             	push   0xc(%eax)
+  80205c:	e8 79 03 00 00       	call   8023da <nsipc_send>
+}
+  802061:	c9                   	leave
+  802062:	c3                   	ret
+
+00802063 <devsock_read>:
+{
+  802063:	55                   	push   %ebp
+  802064:	89 e5                	mov    %esp,%ebp
+  802066:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802069:	6a 00                	push   $0x0
+  80206b:	ff 75 10             	push   0x10(%ebp)
+  80206e:	ff 75 0c             	push   0xc(%ebp)
+  802071:	8b 45 08             	mov    0x8(%ebp),%eax
+  802074:	ff 70 0c             	push   0xc(%eax)
+  802077:	e8 ef 02 00 00       	call   80236b <nsipc_recv>
+}
+  80207c:	c9                   	leave
+  80207d:	c3                   	ret
+
+0080207e <fd2sockid>:
+{
+  80207e:	55                   	push   %ebp
+  80207f:	89 e5                	mov    %esp,%ebp
+  802081:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802084:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802087:	52                   	push   %edx
+  802088:	50                   	push   %eax
+  802089:	e8 7e f7 ff ff       	call   80180c <fd_lookup>
+  80208e:	83 c4 10             	add    $0x10,%esp
+  802091:	85 c0                	test   %eax,%eax
+  802093:	78 10                	js     8020a5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802095:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802098:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80209e:	39 08                	cmp    %ecx,(%eax)
+  8020a0:	75 05                	jne    8020a7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020a2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020a5:	c9                   	leave
+  8020a6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020ac:	eb f7                	jmp    8020a5 <fd2sockid+0x27>
+
+008020ae <alloc_sockfd>:
+{
+  8020ae:	55                   	push   %ebp
+  8020af:	89 e5                	mov    %esp,%ebp
+  8020b1:	56                   	push   %esi
+  8020b2:	53                   	push   %ebx
+  8020b3:	83 ec 1c             	sub    $0x1c,%esp
+  8020b6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020bb:	50                   	push   %eax
+  8020bc:	e8 f5 f6 ff ff       	call   8017b6 <fd_alloc>
+  8020c1:	89 c3                	mov    %eax,%ebx
+  8020c3:	83 c4 10             	add    $0x10,%esp
+  8020c6:	85 c0                	test   %eax,%eax
+  8020c8:	78 43                	js     80210d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020ca:	83 ec 04             	sub    $0x4,%esp
+  8020cd:	68 07 04 00 00       	push   $0x407
+  8020d2:	ff 75 f4             	push   -0xc(%ebp)
+  8020d5:	6a 00                	push   $0x0
+  8020d7:	e8 3d ec ff ff       	call   800d19 <sys_page_alloc>
+  8020dc:	89 c3                	mov    %eax,%ebx
+  8020de:	83 c4 10             	add    $0x10,%esp
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	78 28                	js     80210d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e8:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8020ee:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8020f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8020fa:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8020fd:	83 ec 0c             	sub    $0xc,%esp
+  802100:	50                   	push   %eax
+  802101:	e8 89 f6 ff ff       	call   80178f <fd2num>
+  802106:	89 c3                	mov    %eax,%ebx
+  802108:	83 c4 10             	add    $0x10,%esp
+  80210b:	eb 0c                	jmp    802119 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80210d:	83 ec 0c             	sub    $0xc,%esp
+  802110:	56                   	push   %esi
+  802111:	e8 e4 01 00 00       	call   8022fa <nsipc_close>
+		return r;
+  802116:	83 c4 10             	add    $0x10,%esp
+}
+  802119:	89 d8                	mov    %ebx,%eax
+  80211b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211e:	5b                   	pop    %ebx
+  80211f:	5e                   	pop    %esi
+  802120:	5d                   	pop    %ebp
+  802121:	c3                   	ret
+
+00802122 <accept>:
+{
+  802122:	55                   	push   %ebp
+  802123:	89 e5                	mov    %esp,%ebp
+  802125:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802128:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212b:	e8 4e ff ff ff       	call   80207e <fd2sockid>
+  802130:	85 c0                	test   %eax,%eax
+  802132:	78 1b                	js     80214f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802134:	83 ec 04             	sub    $0x4,%esp
+  802137:	ff 75 10             	push   0x10(%ebp)
+  80213a:	ff 75 0c             	push   0xc(%ebp)
+  80213d:	50                   	push   %eax
+  80213e:	e8 0e 01 00 00       	call   802251 <nsipc_accept>
+  802143:	83 c4 10             	add    $0x10,%esp
+  802146:	85 c0                	test   %eax,%eax
+  802148:	78 05                	js     80214f <accept+0x2d>
+	return alloc_sockfd(r);
+  80214a:	e8 5f ff ff ff       	call   8020ae <alloc_sockfd>
+}
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+
+00802151 <bind>:
+{
+  802151:	55                   	push   %ebp
+  802152:	89 e5                	mov    %esp,%ebp
+  802154:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802157:	8b 45 08             	mov    0x8(%ebp),%eax
+  80215a:	e8 1f ff ff ff       	call   80207e <fd2sockid>
+  80215f:	85 c0                	test   %eax,%eax
+  802161:	78 12                	js     802175 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802163:	83 ec 04             	sub    $0x4,%esp
+  802166:	ff 75 10             	push   0x10(%ebp)
+  802169:	ff 75 0c             	push   0xc(%ebp)
+  80216c:	50                   	push   %eax
+  80216d:	e8 31 01 00 00       	call   8022a3 <nsipc_bind>
+  802172:	83 c4 10             	add    $0x10,%esp
+}
+  802175:	c9                   	leave
+  802176:	c3                   	ret
+
+00802177 <shutdown>:
+{
+  802177:	55                   	push   %ebp
+  802178:	89 e5                	mov    %esp,%ebp
+  80217a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80217d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802180:	e8 f9 fe ff ff       	call   80207e <fd2sockid>
+  802185:	85 c0                	test   %eax,%eax
+  802187:	78 0f                	js     802198 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802189:	83 ec 08             	sub    $0x8,%esp
+  80218c:	ff 75 0c             	push   0xc(%ebp)
+  80218f:	50                   	push   %eax
+  802190:	e8 43 01 00 00       	call   8022d8 <nsipc_shutdown>
+  802195:	83 c4 10             	add    $0x10,%esp
+}
+  802198:	c9                   	leave
+  802199:	c3                   	ret
+
+0080219a <connect>:
+{
+  80219a:	55                   	push   %ebp
+  80219b:	89 e5                	mov    %esp,%ebp
+  80219d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a3:	e8 d6 fe ff ff       	call   80207e <fd2sockid>
+  8021a8:	85 c0                	test   %eax,%eax
+  8021aa:	78 12                	js     8021be <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021ac:	83 ec 04             	sub    $0x4,%esp
+  8021af:	ff 75 10             	push   0x10(%ebp)
+  8021b2:	ff 75 0c             	push   0xc(%ebp)
+  8021b5:	50                   	push   %eax
+  8021b6:	e8 59 01 00 00       	call   802314 <nsipc_connect>
+  8021bb:	83 c4 10             	add    $0x10,%esp
+}
+  8021be:	c9                   	leave
+  8021bf:	c3                   	ret
+
+008021c0 <listen>:
+{
+  8021c0:	55                   	push   %ebp
+  8021c1:	89 e5                	mov    %esp,%ebp
+  8021c3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c9:	e8 b0 fe ff ff       	call   80207e <fd2sockid>
+  8021ce:	85 c0                	test   %eax,%eax
+  8021d0:	78 0f                	js     8021e1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021d2:	83 ec 08             	sub    $0x8,%esp
+  8021d5:	ff 75 0c             	push   0xc(%ebp)
+  8021d8:	50                   	push   %eax
+  8021d9:	e8 6b 01 00 00       	call   802349 <nsipc_listen>
+  8021de:	83 c4 10             	add    $0x10,%esp
+}
+  8021e1:	c9                   	leave
+  8021e2:	c3                   	ret
+
+008021e3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021e3:	55                   	push   %ebp
+  8021e4:	89 e5                	mov    %esp,%ebp
+  8021e6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021e9:	ff 75 10             	push   0x10(%ebp)
+  8021ec:	ff 75 0c             	push   0xc(%ebp)
+  8021ef:	ff 75 08             	push   0x8(%ebp)
+  8021f2:	e8 41 02 00 00       	call   802438 <nsipc_socket>
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	85 c0                	test   %eax,%eax
+  8021fc:	78 05                	js     802203 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8021fe:	e8 ab fe ff ff       	call   8020ae <alloc_sockfd>
+}
+  802203:	c9                   	leave
+  802204:	c3                   	ret
+
+00802205 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802205:	55                   	push   %ebp
+  802206:	89 e5                	mov    %esp,%ebp
+  802208:	53                   	push   %ebx
+  802209:	83 ec 04             	sub    $0x4,%esp
+  80220c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80220e:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802215:	74 26                	je     80223d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802217:	6a 07                	push   $0x7
+  802219:	68 00 70 80 00       	push   $0x807000
+  80221e:	53                   	push   %ebx
+  80221f:	ff 35 04 50 80 00    	push   0x805004
+  802225:	e8 4b 08 00 00       	call   802a75 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80222a:	83 c4 0c             	add    $0xc,%esp
+  80222d:	6a 00                	push   $0x0
+  80222f:	6a 00                	push   $0x0
+  802231:	6a 00                	push   $0x0
+  802233:	e8 25 08 00 00       	call   802a5d <ipc_recv>
+}
+  802238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223b:	c9                   	leave
+  80223c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80223d:	83 ec 0c             	sub    $0xc,%esp
+  802240:	6a 02                	push   $0x2
+  802242:	e8 82 08 00 00       	call   802ac9 <ipc_find_env>
+  802247:	a3 04 50 80 00       	mov    %eax,0x805004
+  80224c:	83 c4 10             	add    $0x10,%esp
+  80224f:	eb c6                	jmp    802217 <nsipc+0x12>
+
+00802251 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802251:	55                   	push   %ebp
+  802252:	89 e5                	mov    %esp,%ebp
+  802254:	56                   	push   %esi
+  802255:	53                   	push   %ebx
+  802256:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802259:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802261:	8b 06                	mov    (%esi),%eax
+  802263:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802268:	b8 01 00 00 00       	mov    $0x1,%eax
+  80226d:	e8 93 ff ff ff       	call   802205 <nsipc>
+  802272:	89 c3                	mov    %eax,%ebx
+  802274:	85 c0                	test   %eax,%eax
+  802276:	79 09                	jns    802281 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802278:	89 d8                	mov    %ebx,%eax
+  80227a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80227d:	5b                   	pop    %ebx
+  80227e:	5e                   	pop    %esi
+  80227f:	5d                   	pop    %ebp
+  802280:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802281:	83 ec 04             	sub    $0x4,%esp
+  802284:	ff 35 10 70 80 00    	push   0x807010
+  80228a:	68 00 70 80 00       	push   $0x807000
+  80228f:	ff 75 0c             	push   0xc(%ebp)
+  802292:	e8 10 e7 ff ff       	call   8009a7 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802297:	a1 10 70 80 00       	mov    0x807010,%eax
+  80229c:	89 06                	mov    %eax,(%esi)
+  80229e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022a1:	eb d5                	jmp    802278 <nsipc_accept+0x27>
+
+008022a3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022a3:	55                   	push   %ebp
+  8022a4:	89 e5                	mov    %esp,%ebp
+  8022a6:	53                   	push   %ebx
+  8022a7:	83 ec 08             	sub    $0x8,%esp
+  8022aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b0:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022b5:	53                   	push   %ebx
+  8022b6:	ff 75 0c             	push   0xc(%ebp)
+  8022b9:	68 04 70 80 00       	push   $0x807004
+  8022be:	e8 e4 e6 ff ff       	call   8009a7 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022c3:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022c9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022ce:	e8 32 ff ff ff       	call   802205 <nsipc>
+}
+  8022d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d6:	c9                   	leave
+  8022d7:	c3                   	ret
+
+008022d8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022d8:	55                   	push   %ebp
+  8022d9:	89 e5                	mov    %esp,%ebp
+  8022db:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8022e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022e9:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8022ee:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022f3:	e8 0d ff ff ff       	call   802205 <nsipc>
+}
+  8022f8:	c9                   	leave
+  8022f9:	c3                   	ret
+
+008022fa <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8022fa:	55                   	push   %ebp
+  8022fb:	89 e5                	mov    %esp,%ebp
+  8022fd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802300:	8b 45 08             	mov    0x8(%ebp),%eax
+  802303:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802308:	b8 04 00 00 00       	mov    $0x4,%eax
+  80230d:	e8 f3 fe ff ff       	call   802205 <nsipc>
+}
+  802312:	c9                   	leave
+  802313:	c3                   	ret
+
+00802314 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802314:	55                   	push   %ebp
+  802315:	89 e5                	mov    %esp,%ebp
+  802317:	53                   	push   %ebx
+  802318:	83 ec 08             	sub    $0x8,%esp
+  80231b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80231e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802321:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802326:	53                   	push   %ebx
+  802327:	ff 75 0c             	push   0xc(%ebp)
+  80232a:	68 04 70 80 00       	push   $0x807004
+  80232f:	e8 73 e6 ff ff       	call   8009a7 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802334:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80233a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80233f:	e8 c1 fe ff ff       	call   802205 <nsipc>
+}
+  802344:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802347:	c9                   	leave
+  802348:	c3                   	ret
+
+00802349 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80234f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802352:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802357:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80235a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80235f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802364:	e8 9c fe ff ff       	call   802205 <nsipc>
+}
+  802369:	c9                   	leave
+  80236a:	c3                   	ret
+
+0080236b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80236b:	55                   	push   %ebp
+  80236c:	89 e5                	mov    %esp,%ebp
+  80236e:	56                   	push   %esi
+  80236f:	53                   	push   %ebx
+  802370:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802373:	8b 45 08             	mov    0x8(%ebp),%eax
+  802376:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80237b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802381:	8b 45 14             	mov    0x14(%ebp),%eax
+  802384:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802389:	b8 07 00 00 00       	mov    $0x7,%eax
+  80238e:	e8 72 fe ff ff       	call   802205 <nsipc>
+  802393:	89 c3                	mov    %eax,%ebx
+  802395:	85 c0                	test   %eax,%eax
+  802397:	78 22                	js     8023bb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802399:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80239e:	39 c6                	cmp    %eax,%esi
+  8023a0:	0f 4e c6             	cmovle %esi,%eax
+  8023a3:	39 c3                	cmp    %eax,%ebx
+  8023a5:	7f 1d                	jg     8023c4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023a7:	83 ec 04             	sub    $0x4,%esp
+  8023aa:	53                   	push   %ebx
+  8023ab:	68 00 70 80 00       	push   $0x807000
+  8023b0:	ff 75 0c             	push   0xc(%ebp)
+  8023b3:	e8 ef e5 ff ff       	call   8009a7 <memmove>
+  8023b8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023bb:	89 d8                	mov    %ebx,%eax
+  8023bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c0:	5b                   	pop    %ebx
+  8023c1:	5e                   	pop    %esi
+  8023c2:	5d                   	pop    %ebp
+  8023c3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023c4:	68 c7 2f 80 00       	push   $0x802fc7
+  8023c9:	68 8f 2f 80 00       	push   $0x802f8f
+  8023ce:	6a 62                	push   $0x62
+  8023d0:	68 dc 2f 80 00       	push   $0x802fdc
+  8023d5:	e8 24 dd ff ff       	call   8000fe <_panic>
+
+008023da <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023da:	55                   	push   %ebp
+  8023db:	89 e5                	mov    %esp,%ebp
+  8023dd:	53                   	push   %ebx
+  8023de:	83 ec 04             	sub    $0x4,%esp
+  8023e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e7:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8023ec:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8023f2:	7f 2e                	jg     802422 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8023f4:	83 ec 04             	sub    $0x4,%esp
+  8023f7:	53                   	push   %ebx
+  8023f8:	ff 75 0c             	push   0xc(%ebp)
+  8023fb:	68 0c 70 80 00       	push   $0x80700c
+  802400:	e8 a2 e5 ff ff       	call   8009a7 <memmove>
+	nsipcbuf.send.req_size = size;
+  802405:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80240b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80240e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802413:	b8 08 00 00 00       	mov    $0x8,%eax
+  802418:	e8 e8 fd ff ff       	call   802205 <nsipc>
+}
+  80241d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802420:	c9                   	leave
+  802421:	c3                   	ret
+	assert(size < 1600);
+  802422:	68 e8 2f 80 00       	push   $0x802fe8
+  802427:	68 8f 2f 80 00       	push   $0x802f8f
+  80242c:	6a 6d                	push   $0x6d
+  80242e:	68 dc 2f 80 00       	push   $0x802fdc
+  802433:	e8 c6 dc ff ff       	call   8000fe <_panic>
+
+00802438 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802438:	55                   	push   %ebp
+  802439:	89 e5                	mov    %esp,%ebp
+  80243b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80243e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802441:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802446:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802449:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80244e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802451:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802456:	b8 09 00 00 00       	mov    $0x9,%eax
+  80245b:	e8 a5 fd ff ff       	call   802205 <nsipc>
+}
+  802460:	c9                   	leave
+  802461:	c3                   	ret
+
+00802462 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802462:	55                   	push   %ebp
+  802463:	89 e5                	mov    %esp,%ebp
+  802465:	56                   	push   %esi
+  802466:	53                   	push   %ebx
+  802467:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80246a:	83 ec 0c             	sub    $0xc,%esp
+  80246d:	ff 75 08             	push   0x8(%ebp)
+  802470:	e8 2a f3 ff ff       	call   80179f <fd2data>
+  802475:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802477:	83 c4 08             	add    $0x8,%esp
+  80247a:	68 f4 2f 80 00       	push   $0x802ff4
+  80247f:	53                   	push   %ebx
+  802480:	e8 9c e3 ff ff       	call   800821 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802485:	8b 46 04             	mov    0x4(%esi),%eax
+  802488:	2b 06                	sub    (%esi),%eax
+  80248a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802490:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802497:	00 00 00 
+	stat->st_dev = &devpipe;
+  80249a:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024a1:	40 80 00 
+	return 0;
+}
+  8024a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024ac:	5b                   	pop    %ebx
+  8024ad:	5e                   	pop    %esi
+  8024ae:	5d                   	pop    %ebp
+  8024af:	c3                   	ret
+
+008024b0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024b0:	55                   	push   %ebp
+  8024b1:	89 e5                	mov    %esp,%ebp
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 0c             	sub    $0xc,%esp
+  8024b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024ba:	53                   	push   %ebx
+  8024bb:	6a 00                	push   $0x0
+  8024bd:	e8 32 e9 ff ff       	call   800df4 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024c2:	89 1c 24             	mov    %ebx,(%esp)
+  8024c5:	e8 d5 f2 ff ff       	call   80179f <fd2data>
+  8024ca:	83 c4 08             	add    $0x8,%esp
+  8024cd:	50                   	push   %eax
+  8024ce:	6a 00                	push   $0x0
+  8024d0:	e8 1f e9 ff ff       	call   800df4 <sys_page_unmap>
+}
+  8024d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024d8:	c9                   	leave
+  8024d9:	c3                   	ret
+
+008024da <_pipeisclosed>:
+{
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	57                   	push   %edi
+  8024de:	56                   	push   %esi
+  8024df:	53                   	push   %ebx
+  8024e0:	83 ec 1c             	sub    $0x1c,%esp
+  8024e3:	89 c7                	mov    %eax,%edi
+  8024e5:	89 d6                	mov    %edx,%esi
+  8024e7:	eb 3c                	jmp    802525 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8024e9:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8024ec:	83 ec 0c             	sub    $0xc,%esp
+  8024ef:	57                   	push   %edi
+  8024f0:	e8 13 06 00 00       	call   802b08 <pageref>
+  8024f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024f8:	89 34 24             	mov    %esi,(%esp)
+  8024fb:	e8 08 06 00 00       	call   802b08 <pageref>
+  802500:	89 c2                	mov    %eax,%edx
+  802502:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802504:	05 00 00 00 20       	add    $0x20000000,%eax
+  802509:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80250c:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802512:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802517:	76 31                	jbe    80254a <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802519:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80251c:	39 c3                	cmp    %eax,%ebx
+  80251e:	74 76                	je     802596 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802520:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802523:	74 36                	je     80255b <_pipeisclosed+0x81>
+  802525:	89 e0                	mov    %esp,%eax
+  802527:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80252c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802532:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802537:	77 b0                	ja     8024e9 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802539:	c1 e8 10             	shr    $0x10,%eax
+  80253c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802542:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802548:	eb 9f                	jmp    8024e9 <_pipeisclosed+0xf>
+  80254a:	c1 e8 10             	shr    $0x10,%eax
+  80254d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802553:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802559:	eb be                	jmp    802519 <_pipeisclosed+0x3f>
+  80255b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80255d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802562:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802568:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80256d:	76 16                	jbe    802585 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80256f:	8b 42 58             	mov    0x58(%edx),%eax
+  802572:	6a 01                	push   $0x1
+  802574:	50                   	push   %eax
+  802575:	53                   	push   %ebx
+  802576:	68 fb 2f 80 00       	push   $0x802ffb
+  80257b:	e8 59 dc ff ff       	call   8001d9 <cprintf>
+  802580:	83 c4 10             	add    $0x10,%esp
+  802583:	eb a0                	jmp    802525 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802585:	c1 e8 10             	shr    $0x10,%eax
+  802588:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80258e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802594:	eb d9                	jmp    80256f <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802596:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802599:	0f 94 c0             	sete   %al
+  80259c:	0f b6 c0             	movzbl %al,%eax
+}
+  80259f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025a2:	5b                   	pop    %ebx
+  8025a3:	5e                   	pop    %esi
+  8025a4:	5f                   	pop    %edi
+  8025a5:	5d                   	pop    %ebp
+  8025a6:	c3                   	ret
+
+008025a7 <devpipe_write>:
+{
+  8025a7:	55                   	push   %ebp
+  8025a8:	89 e5                	mov    %esp,%ebp
+  8025aa:	57                   	push   %edi
+  8025ab:	56                   	push   %esi
+  8025ac:	53                   	push   %ebx
+  8025ad:	83 ec 28             	sub    $0x28,%esp
+  8025b0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025b3:	56                   	push   %esi
+  8025b4:	e8 e6 f1 ff ff       	call   80179f <fd2data>
+  8025b9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025bb:	83 c4 10             	add    $0x10,%esp
+  8025be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025c6:	75 09                	jne    8025d1 <devpipe_write+0x2a>
+	return i;
+  8025c8:	89 f8                	mov    %edi,%eax
+  8025ca:	eb 23                	jmp    8025ef <devpipe_write+0x48>
+			sys_yield();
+  8025cc:	e8 02 e7 ff ff       	call   800cd3 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025d1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025d4:	8b 0b                	mov    (%ebx),%ecx
+  8025d6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025d9:	39 d0                	cmp    %edx,%eax
+  8025db:	72 1a                	jb     8025f7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025dd:	89 da                	mov    %ebx,%edx
+  8025df:	89 f0                	mov    %esi,%eax
+  8025e1:	e8 f4 fe ff ff       	call   8024da <_pipeisclosed>
+  8025e6:	85 c0                	test   %eax,%eax
+  8025e8:	74 e2                	je     8025cc <devpipe_write+0x25>
+				return 0;
+  8025ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025f2:	5b                   	pop    %ebx
+  8025f3:	5e                   	pop    %esi
+  8025f4:	5f                   	pop    %edi
+  8025f5:	5d                   	pop    %ebp
+  8025f6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025fa:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025fe:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802601:	89 c2                	mov    %eax,%edx
+  802603:	c1 fa 1f             	sar    $0x1f,%edx
+  802606:	89 d1                	mov    %edx,%ecx
+  802608:	c1 e9 1b             	shr    $0x1b,%ecx
+  80260b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80260e:	83 e2 1f             	and    $0x1f,%edx
+  802611:	29 ca                	sub    %ecx,%edx
+  802613:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802617:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80261b:	83 c0 01             	add    $0x1,%eax
+  80261e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802621:	83 c7 01             	add    $0x1,%edi
+  802624:	eb 9d                	jmp    8025c3 <devpipe_write+0x1c>
+
+00802626 <devpipe_read>:
+{
+  802626:	55                   	push   %ebp
+  802627:	89 e5                	mov    %esp,%ebp
+  802629:	57                   	push   %edi
+  80262a:	56                   	push   %esi
+  80262b:	53                   	push   %ebx
+  80262c:	83 ec 18             	sub    $0x18,%esp
+  80262f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802632:	57                   	push   %edi
+  802633:	e8 67 f1 ff ff       	call   80179f <fd2data>
+  802638:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80263a:	83 c4 10             	add    $0x10,%esp
+  80263d:	be 00 00 00 00       	mov    $0x0,%esi
+  802642:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802645:	75 13                	jne    80265a <devpipe_read+0x34>
+	return i;
+  802647:	89 f0                	mov    %esi,%eax
+  802649:	eb 02                	jmp    80264d <devpipe_read+0x27>
+				return i;
+  80264b:	89 f0                	mov    %esi,%eax
+}
+  80264d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802650:	5b                   	pop    %ebx
+  802651:	5e                   	pop    %esi
+  802652:	5f                   	pop    %edi
+  802653:	5d                   	pop    %ebp
+  802654:	c3                   	ret
+			sys_yield();
+  802655:	e8 79 e6 ff ff       	call   800cd3 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80265a:	8b 03                	mov    (%ebx),%eax
+  80265c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80265f:	75 18                	jne    802679 <devpipe_read+0x53>
+			if (i > 0)
+  802661:	85 f6                	test   %esi,%esi
+  802663:	75 e6                	jne    80264b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802665:	89 da                	mov    %ebx,%edx
+  802667:	89 f8                	mov    %edi,%eax
+  802669:	e8 6c fe ff ff       	call   8024da <_pipeisclosed>
+  80266e:	85 c0                	test   %eax,%eax
+  802670:	74 e3                	je     802655 <devpipe_read+0x2f>
+				return 0;
+  802672:	b8 00 00 00 00       	mov    $0x0,%eax
+  802677:	eb d4                	jmp    80264d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802679:	99                   	cltd
+  80267a:	c1 ea 1b             	shr    $0x1b,%edx
+  80267d:	01 d0                	add    %edx,%eax
+  80267f:	83 e0 1f             	and    $0x1f,%eax
+  802682:	29 d0                	sub    %edx,%eax
+  802684:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802689:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80268c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80268f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802692:	83 c6 01             	add    $0x1,%esi
+  802695:	eb ab                	jmp    802642 <devpipe_read+0x1c>
+
+00802697 <pipe>:
+{
+  802697:	55                   	push   %ebp
+  802698:	89 e5                	mov    %esp,%ebp
+  80269a:	56                   	push   %esi
+  80269b:	53                   	push   %ebx
+  80269c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80269f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026a2:	50                   	push   %eax
+  8026a3:	e8 0e f1 ff ff       	call   8017b6 <fd_alloc>
+  8026a8:	89 c3                	mov    %eax,%ebx
+  8026aa:	83 c4 10             	add    $0x10,%esp
+  8026ad:	85 c0                	test   %eax,%eax
+  8026af:	0f 88 23 01 00 00    	js     8027d8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026b5:	83 ec 04             	sub    $0x4,%esp
+  8026b8:	68 07 04 00 00       	push   $0x407
+  8026bd:	ff 75 f4             	push   -0xc(%ebp)
+  8026c0:	6a 00                	push   $0x0
+  8026c2:	e8 52 e6 ff ff       	call   800d19 <sys_page_alloc>
+  8026c7:	89 c3                	mov    %eax,%ebx
+  8026c9:	83 c4 10             	add    $0x10,%esp
+  8026cc:	85 c0                	test   %eax,%eax
+  8026ce:	0f 88 04 01 00 00    	js     8027d8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026d4:	83 ec 0c             	sub    $0xc,%esp
+  8026d7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026da:	50                   	push   %eax
+  8026db:	e8 d6 f0 ff ff       	call   8017b6 <fd_alloc>
+  8026e0:	89 c3                	mov    %eax,%ebx
+  8026e2:	83 c4 10             	add    $0x10,%esp
+  8026e5:	85 c0                	test   %eax,%eax
+  8026e7:	0f 88 db 00 00 00    	js     8027c8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026ed:	83 ec 04             	sub    $0x4,%esp
+  8026f0:	68 07 04 00 00       	push   $0x407
+  8026f5:	ff 75 f0             	push   -0x10(%ebp)
+  8026f8:	6a 00                	push   $0x0
+  8026fa:	e8 1a e6 ff ff       	call   800d19 <sys_page_alloc>
+  8026ff:	89 c3                	mov    %eax,%ebx
+  802701:	83 c4 10             	add    $0x10,%esp
+  802704:	85 c0                	test   %eax,%eax
+  802706:	0f 88 bc 00 00 00    	js     8027c8 <pipe+0x131>
+	va = fd2data(fd0);
+  80270c:	83 ec 0c             	sub    $0xc,%esp
+  80270f:	ff 75 f4             	push   -0xc(%ebp)
+  802712:	e8 88 f0 ff ff       	call   80179f <fd2data>
+  802717:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802719:	83 c4 0c             	add    $0xc,%esp
+  80271c:	68 07 04 00 00       	push   $0x407
+  802721:	50                   	push   %eax
+  802722:	6a 00                	push   $0x0
+  802724:	e8 f0 e5 ff ff       	call   800d19 <sys_page_alloc>
+  802729:	89 c3                	mov    %eax,%ebx
+  80272b:	83 c4 10             	add    $0x10,%esp
+  80272e:	85 c0                	test   %eax,%eax
+  802730:	0f 88 82 00 00 00    	js     8027b8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802736:	83 ec 0c             	sub    $0xc,%esp
+  802739:	ff 75 f0             	push   -0x10(%ebp)
+  80273c:	e8 5e f0 ff ff       	call   80179f <fd2data>
+  802741:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802748:	50                   	push   %eax
+  802749:	6a 00                	push   $0x0
+  80274b:	56                   	push   %esi
+  80274c:	6a 00                	push   $0x0
+  80274e:	e8 33 e6 ff ff       	call   800d86 <sys_page_map>
+  802753:	89 c3                	mov    %eax,%ebx
+  802755:	83 c4 20             	add    $0x20,%esp
+  802758:	85 c0                	test   %eax,%eax
+  80275a:	78 4e                	js     8027aa <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80275c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802761:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802764:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802766:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802769:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802770:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802773:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802775:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802778:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80277f:	83 ec 0c             	sub    $0xc,%esp
+  802782:	ff 75 f4             	push   -0xc(%ebp)
+  802785:	e8 05 f0 ff ff       	call   80178f <fd2num>
+  80278a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80278d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80278f:	83 c4 04             	add    $0x4,%esp
+  802792:	ff 75 f0             	push   -0x10(%ebp)
+  802795:	e8 f5 ef ff ff       	call   80178f <fd2num>
+  80279a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80279d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027a0:	83 c4 10             	add    $0x10,%esp
+  8027a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027a8:	eb 2e                	jmp    8027d8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027aa:	83 ec 08             	sub    $0x8,%esp
+  8027ad:	56                   	push   %esi
+  8027ae:	6a 00                	push   $0x0
+  8027b0:	e8 3f e6 ff ff       	call   800df4 <sys_page_unmap>
+  8027b5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027b8:	83 ec 08             	sub    $0x8,%esp
+  8027bb:	ff 75 f0             	push   -0x10(%ebp)
+  8027be:	6a 00                	push   $0x0
+  8027c0:	e8 2f e6 ff ff       	call   800df4 <sys_page_unmap>
+  8027c5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027c8:	83 ec 08             	sub    $0x8,%esp
+  8027cb:	ff 75 f4             	push   -0xc(%ebp)
+  8027ce:	6a 00                	push   $0x0
+  8027d0:	e8 1f e6 ff ff       	call   800df4 <sys_page_unmap>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+}
+  8027d8:	89 d8                	mov    %ebx,%eax
+  8027da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027dd:	5b                   	pop    %ebx
+  8027de:	5e                   	pop    %esi
+  8027df:	5d                   	pop    %ebp
+  8027e0:	c3                   	ret
+
+008027e1 <pipeisclosed>:
+{
+  8027e1:	55                   	push   %ebp
+  8027e2:	89 e5                	mov    %esp,%ebp
+  8027e4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027ea:	50                   	push   %eax
+  8027eb:	ff 75 08             	push   0x8(%ebp)
+  8027ee:	e8 19 f0 ff ff       	call   80180c <fd_lookup>
+  8027f3:	83 c4 10             	add    $0x10,%esp
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 18                	js     802812 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027fa:	83 ec 0c             	sub    $0xc,%esp
+  8027fd:	ff 75 f4             	push   -0xc(%ebp)
+  802800:	e8 9a ef ff ff       	call   80179f <fd2data>
+  802805:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802807:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80280a:	e8 cb fc ff ff       	call   8024da <_pipeisclosed>
+  80280f:	83 c4 10             	add    $0x10,%esp
+}
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+
+00802814 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802814:	b8 00 00 00 00       	mov    $0x0,%eax
+  802819:	c3                   	ret
+
+0080281a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80281a:	55                   	push   %ebp
+  80281b:	89 e5                	mov    %esp,%ebp
+  80281d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802820:	68 13 30 80 00       	push   $0x803013
+  802825:	ff 75 0c             	push   0xc(%ebp)
+  802828:	e8 f4 df ff ff       	call   800821 <strcpy>
+	return 0;
+}
+  80282d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802832:	c9                   	leave
+  802833:	c3                   	ret
+
+00802834 <devcons_write>:
+{
+  802834:	55                   	push   %ebp
+  802835:	89 e5                	mov    %esp,%ebp
+  802837:	57                   	push   %edi
+  802838:	56                   	push   %esi
+  802839:	53                   	push   %ebx
+  80283a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802840:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802845:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80284b:	eb 2e                	jmp    80287b <devcons_write+0x47>
+		m = n - tot;
+  80284d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802850:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802852:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802857:	39 c3                	cmp    %eax,%ebx
+  802859:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80285c:	83 ec 04             	sub    $0x4,%esp
+  80285f:	53                   	push   %ebx
+  802860:	89 f0                	mov    %esi,%eax
+  802862:	03 45 0c             	add    0xc(%ebp),%eax
+  802865:	50                   	push   %eax
+  802866:	57                   	push   %edi
+  802867:	e8 3b e1 ff ff       	call   8009a7 <memmove>
+		sys_cputs(buf, m);
+  80286c:	83 c4 08             	add    $0x8,%esp
+  80286f:	53                   	push   %ebx
+  802870:	57                   	push   %edi
+  802871:	e8 24 e3 ff ff       	call   800b9a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802876:	01 de                	add    %ebx,%esi
+  802878:	83 c4 10             	add    $0x10,%esp
+  80287b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80287e:	72 cd                	jb     80284d <devcons_write+0x19>
+}
+  802880:	89 f0                	mov    %esi,%eax
+  802882:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802885:	5b                   	pop    %ebx
+  802886:	5e                   	pop    %esi
+  802887:	5f                   	pop    %edi
+  802888:	5d                   	pop    %ebp
+  802889:	c3                   	ret
+
+0080288a <devcons_read>:
+{
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802890:	b8 00 00 00 00       	mov    $0x0,%eax
+  802895:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802899:	75 07                	jne    8028a2 <devcons_read+0x18>
+  80289b:	eb 1f                	jmp    8028bc <devcons_read+0x32>
+		sys_yield();
+  80289d:	e8 31 e4 ff ff       	call   800cd3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028a2:	e8 37 e3 ff ff       	call   800bde <sys_cgetc>
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	74 f2                	je     80289d <devcons_read+0x13>
+	if (c < 0)
+  8028ab:	78 0f                	js     8028bc <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028ad:	83 f8 04             	cmp    $0x4,%eax
+  8028b0:	74 0c                	je     8028be <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028b5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028b7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028bc:	c9                   	leave
+  8028bd:	c3                   	ret
+		return 0;
+  8028be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c3:	eb f7                	jmp    8028bc <devcons_read+0x32>
+
+008028c5 <cputchar>:
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ce:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028d1:	6a 01                	push   $0x1
+  8028d3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028d6:	50                   	push   %eax
+  8028d7:	e8 be e2 ff ff       	call   800b9a <sys_cputs>
+}
+  8028dc:	83 c4 10             	add    $0x10,%esp
+  8028df:	c9                   	leave
+  8028e0:	c3                   	ret
+
+008028e1 <getchar>:
+{
+  8028e1:	55                   	push   %ebp
+  8028e2:	89 e5                	mov    %esp,%ebp
+  8028e4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028e7:	6a 01                	push   $0x1
+  8028e9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028ec:	50                   	push   %eax
+  8028ed:	6a 00                	push   $0x0
+  8028ef:	e8 9e f1 ff ff       	call   801a92 <read>
+	if (r < 0)
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	78 06                	js     802901 <getchar+0x20>
+	if (r < 1)
+  8028fb:	74 06                	je     802903 <getchar+0x22>
+	return c;
+  8028fd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802901:	c9                   	leave
+  802902:	c3                   	ret
+		return -E_EOF;
+  802903:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802908:	eb f7                	jmp    802901 <getchar+0x20>
+
+0080290a <iscons>:
+{
+  80290a:	55                   	push   %ebp
+  80290b:	89 e5                	mov    %esp,%ebp
+  80290d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802910:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802913:	50                   	push   %eax
+  802914:	ff 75 08             	push   0x8(%ebp)
+  802917:	e8 f0 ee ff ff       	call   80180c <fd_lookup>
+  80291c:	83 c4 10             	add    $0x10,%esp
+  80291f:	85 c0                	test   %eax,%eax
+  802921:	78 11                	js     802934 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802923:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802926:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80292c:	39 10                	cmp    %edx,(%eax)
+  80292e:	0f 94 c0             	sete   %al
+  802931:	0f b6 c0             	movzbl %al,%eax
+}
+  802934:	c9                   	leave
+  802935:	c3                   	ret
+
+00802936 <opencons>:
+{
+  802936:	55                   	push   %ebp
+  802937:	89 e5                	mov    %esp,%ebp
+  802939:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80293c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80293f:	50                   	push   %eax
+  802940:	e8 71 ee ff ff       	call   8017b6 <fd_alloc>
+  802945:	83 c4 10             	add    $0x10,%esp
+  802948:	85 c0                	test   %eax,%eax
+  80294a:	78 3a                	js     802986 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80294c:	83 ec 04             	sub    $0x4,%esp
+  80294f:	68 07 04 00 00       	push   $0x407
+  802954:	ff 75 f4             	push   -0xc(%ebp)
+  802957:	6a 00                	push   $0x0
+  802959:	e8 bb e3 ff ff       	call   800d19 <sys_page_alloc>
+  80295e:	83 c4 10             	add    $0x10,%esp
+  802961:	85 c0                	test   %eax,%eax
+  802963:	78 21                	js     802986 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802965:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802968:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80296e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802973:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80297a:	83 ec 0c             	sub    $0xc,%esp
+  80297d:	50                   	push   %eax
+  80297e:	e8 0c ee ff ff       	call   80178f <fd2num>
+  802983:	83 c4 10             	add    $0x10,%esp
+}
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+00802988 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	56                   	push   %esi
+  80298c:	53                   	push   %ebx
+  80298d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802990:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802993:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802996:	85 c0                	test   %eax,%eax
+  802998:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80299d:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8029a0:	83 ec 08             	sub    $0x8,%esp
+  8029a3:	ff 75 14             	push   0x14(%ebp)
+  8029a6:	50                   	push   %eax
+  8029a7:	e8 7e e7 ff ff       	call   80112a <sys_ipc_recv_until>
+  8029ac:	83 c4 10             	add    $0x10,%esp
+  8029af:	85 c0                	test   %eax,%eax
+  8029b1:	78 61                	js     802a14 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029b3:	85 f6                	test   %esi,%esi
+  8029b5:	74 1c                	je     8029d3 <ipc_recv_until+0x4b>
+  8029b7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029b9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029be:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029c4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029c9:	76 5f                	jbe    802a2a <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029cb:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029d1:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029d3:	85 db                	test   %ebx,%ebx
+  8029d5:	74 1c                	je     8029f3 <ipc_recv_until+0x6b>
+  8029d7:	89 e0                	mov    %esp,%eax
+  8029d9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029de:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029e4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029e9:	76 50                	jbe    802a3b <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8029eb:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8029f1:	89 03                	mov    %eax,(%ebx)
+  8029f3:	89 e0                	mov    %esp,%eax
+  8029f5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029fa:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a00:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a05:	76 45                	jbe    802a4c <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a07:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a10:	5b                   	pop    %ebx
+  802a11:	5e                   	pop    %esi
+  802a12:	5d                   	pop    %ebp
+  802a13:	c3                   	ret
+		if (from_env_store)
+  802a14:	85 f6                	test   %esi,%esi
+  802a16:	74 06                	je     802a1e <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a18:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a1e:	85 db                	test   %ebx,%ebx
+  802a20:	74 eb                	je     802a0d <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a22:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a28:	eb e3                	jmp    802a0d <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a2a:	c1 e8 10             	shr    $0x10,%eax
+  802a2d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a33:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a39:	eb 90                	jmp    8029cb <ipc_recv_until+0x43>
+  802a3b:	c1 e8 10             	shr    $0x10,%eax
+  802a3e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a44:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a4a:	eb 9f                	jmp    8029eb <ipc_recv_until+0x63>
+  802a4c:	c1 e8 10             	shr    $0x10,%eax
+  802a4f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a55:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a5b:	eb aa                	jmp    802a07 <ipc_recv_until+0x7f>
+
+00802a5d <ipc_recv>:
+{
+  802a5d:	55                   	push   %ebp
+  802a5e:	89 e5                	mov    %esp,%ebp
+  802a60:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a63:	6a 00                	push   $0x0
+  802a65:	ff 75 10             	push   0x10(%ebp)
+  802a68:	ff 75 0c             	push   0xc(%ebp)
+  802a6b:	ff 75 08             	push   0x8(%ebp)
+  802a6e:	e8 15 ff ff ff       	call   802988 <ipc_recv_until>
+}
+  802a73:	c9                   	leave
+  802a74:	c3                   	ret
+
+00802a75 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a75:	55                   	push   %ebp
+  802a76:	89 e5                	mov    %esp,%ebp
+  802a78:	57                   	push   %edi
+  802a79:	56                   	push   %esi
+  802a7a:	53                   	push   %ebx
+  802a7b:	83 ec 0c             	sub    $0xc,%esp
+  802a7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a81:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a87:	85 db                	test   %ebx,%ebx
+  802a89:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a8e:	0f 44 d8             	cmove  %eax,%ebx
+  802a91:	eb 05                	jmp    802a98 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802a93:	e8 3b e2 ff ff       	call   800cd3 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802a98:	ff 75 14             	push   0x14(%ebp)
+  802a9b:	53                   	push   %ebx
+  802a9c:	56                   	push   %esi
+  802a9d:	57                   	push   %edi
+  802a9e:	e8 d3 e5 ff ff       	call   801076 <sys_ipc_try_send>
+  802aa3:	83 c4 10             	add    $0x10,%esp
+  802aa6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802aa9:	74 e8                	je     802a93 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802aab:	85 c0                	test   %eax,%eax
+  802aad:	78 08                	js     802ab7 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802aaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ab2:	5b                   	pop    %ebx
+  802ab3:	5e                   	pop    %esi
+  802ab4:	5f                   	pop    %edi
+  802ab5:	5d                   	pop    %ebp
+  802ab6:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802ab7:	50                   	push   %eax
+  802ab8:	68 1f 30 80 00       	push   $0x80301f
+  802abd:	6a 4f                	push   $0x4f
+  802abf:	68 32 30 80 00       	push   $0x803032
+  802ac4:	e8 35 d6 ff ff       	call   8000fe <_panic>
+
+00802ac9 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ac9:	55                   	push   %ebp
+  802aca:	89 e5                	mov    %esp,%ebp
+  802acc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802acf:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ad4:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802ada:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ae0:	8b 52 50             	mov    0x50(%edx),%edx
+  802ae3:	39 ca                	cmp    %ecx,%edx
+  802ae5:	74 11                	je     802af8 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802ae7:	83 c0 01             	add    $0x1,%eax
+  802aea:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802aef:	75 e3                	jne    802ad4 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802af1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af6:	eb 0e                	jmp    802b06 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802af8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802afe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b03:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b06:	5d                   	pop    %ebp
+  802b07:	c3                   	ret
+
+00802b08 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b08:	55                   	push   %ebp
+  802b09:	89 e5                	mov    %esp,%ebp
+  802b0b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b0e:	89 c2                	mov    %eax,%edx
+  802b10:	c1 ea 16             	shr    $0x16,%edx
+  802b13:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b1f:	f6 c1 01             	test   $0x1,%cl
+  802b22:	74 1a                	je     802b3e <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b24:	c1 e8 0c             	shr    $0xc,%eax
+  802b27:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b2e:	a8 01                	test   $0x1,%al
+  802b30:	74 0c                	je     802b3e <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b32:	c1 e8 0c             	shr    $0xc,%eax
+  802b35:	c1 e0 04             	shl    $0x4,%eax
+  802b38:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b3e:	89 d0                	mov    %edx,%eax
+  802b40:	5d                   	pop    %ebp
+  802b41:	c3                   	ret
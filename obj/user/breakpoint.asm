@@ -0,0 +1,6150 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $3");
+  800033:	cc                   	int3
+}
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 0c             	sub    $0xc,%esp
+  80003e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800041:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800044:	b8 01 00 00 00       	mov    $0x1,%eax
+  800049:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80004b:	c1 ea 0b             	shr    $0xb,%edx
+  80004e:	83 f2 01             	xor    $0x1,%edx
+  800051:	83 e2 01             	and    $0x1,%edx
+  800054:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80005a:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800061:	00 00 00 
+	envid = sys_getenvid();
+  800064:	e8 1f 0c 00 00       	call   800c88 <sys_getenvid>
+  800069:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80006b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800070:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800076:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80007c:	8b 52 48             	mov    0x48(%edx),%edx
+  80007f:	39 ca                	cmp    %ecx,%edx
+  800081:	74 27                	je     8000aa <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80008b:	75 e3                	jne    800070 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80008d:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800094:	75 24                	jne    8000ba <libmain+0x85>
+		panic("libmain can't find the environment");
+  800096:	83 ec 04             	sub    $0x4,%esp
+  800099:	68 40 2b 80 00       	push   $0x802b40
+  80009e:	6a 23                	push   $0x23
+  8000a0:	68 63 2b 80 00       	push   $0x802b63
+  8000a5:	e8 4f 00 00 00       	call   8000f9 <_panic>
+			mainenv = &envs[i];
+  8000aa:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000b0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b5:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000ba:	85 ff                	test   %edi,%edi
+  8000bc:	7e 07                	jle    8000c5 <libmain+0x90>
+		binaryname = argv[0];
+  8000be:	8b 06                	mov    (%esi),%eax
+  8000c0:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000c5:	83 ec 08             	sub    $0x8,%esp
+  8000c8:	56                   	push   %esi
+  8000c9:	57                   	push   %edi
+  8000ca:	e8 64 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000cf:	e8 0b 00 00 00       	call   8000df <exit>
+}
+  8000d4:	83 c4 10             	add    $0x10,%esp
+  8000d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000da:	5b                   	pop    %ebx
+  8000db:	5e                   	pop    %esi
+  8000dc:	5f                   	pop    %edi
+  8000dd:	5d                   	pop    %ebp
+  8000de:	c3                   	ret
+
+008000df <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000df:	55                   	push   %ebp
+  8000e0:	89 e5                	mov    %esp,%ebp
+  8000e2:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e5:	e8 94 18 00 00       	call   80197e <close_all>
+	sys_env_destroy(0);
+  8000ea:	83 ec 0c             	sub    $0xc,%esp
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	e8 2b 0b 00 00       	call   800c1f <sys_env_destroy>
+}
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	c9                   	leave
+  8000f8:	c3                   	ret
+
+008000f9 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000f9:	55                   	push   %ebp
+  8000fa:	89 e5                	mov    %esp,%ebp
+  8000fc:	56                   	push   %esi
+  8000fd:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8000fe:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800101:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800107:	e8 7c 0b 00 00       	call   800c88 <sys_getenvid>
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	ff 75 0c             	push   0xc(%ebp)
+  800112:	ff 75 08             	push   0x8(%ebp)
+  800115:	56                   	push   %esi
+  800116:	50                   	push   %eax
+  800117:	68 7c 2b 80 00       	push   $0x802b7c
+  80011c:	e8 b3 00 00 00       	call   8001d4 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800121:	83 c4 18             	add    $0x18,%esp
+  800124:	53                   	push   %ebx
+  800125:	ff 75 10             	push   0x10(%ebp)
+  800128:	e8 56 00 00 00       	call   800183 <vcprintf>
+	cprintf("\n");
+  80012d:	c7 04 24 ec 2f 80 00 	movl   $0x802fec,(%esp)
+  800134:	e8 9b 00 00 00       	call   8001d4 <cprintf>
+  800139:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80013c:	cc                   	int3
+	while (1)
+  80013d:	eb fd                	jmp    80013c <_panic+0x43>
+
+0080013f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	53                   	push   %ebx
+  800143:	83 ec 04             	sub    $0x4,%esp
+  800146:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800149:	8b 13                	mov    (%ebx),%edx
+  80014b:	8d 42 01             	lea    0x1(%edx),%eax
+  80014e:	89 03                	mov    %eax,(%ebx)
+  800150:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800153:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800157:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80015c:	74 09                	je     800167 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80015e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800162:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800165:	c9                   	leave
+  800166:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800167:	83 ec 08             	sub    $0x8,%esp
+  80016a:	68 ff 00 00 00       	push   $0xff
+  80016f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800172:	50                   	push   %eax
+  800173:	e8 1d 0a 00 00       	call   800b95 <sys_cputs>
+		b->idx = 0;
+  800178:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80017e:	83 c4 10             	add    $0x10,%esp
+  800181:	eb db                	jmp    80015e <putch+0x1f>
+
+00800183 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800183:	55                   	push   %ebp
+  800184:	89 e5                	mov    %esp,%ebp
+  800186:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80018c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800193:	00 00 00 
+	b.cnt = 0;
+  800196:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80019d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a0:	ff 75 0c             	push   0xc(%ebp)
+  8001a3:	ff 75 08             	push   0x8(%ebp)
+  8001a6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001ac:	50                   	push   %eax
+  8001ad:	68 3f 01 80 00       	push   $0x80013f
+  8001b2:	e8 fb 00 00 00       	call   8002b2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001b7:	83 c4 08             	add    $0x8,%esp
+  8001ba:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c0:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001c6:	50                   	push   %eax
+  8001c7:	e8 c9 09 00 00       	call   800b95 <sys_cputs>
+
+	return b.cnt;
+}
+  8001cc:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d2:	c9                   	leave
+  8001d3:	c3                   	ret
+
+008001d4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001d4:	55                   	push   %ebp
+  8001d5:	89 e5                	mov    %esp,%ebp
+  8001d7:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001da:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001dd:	50                   	push   %eax
+  8001de:	ff 75 08             	push   0x8(%ebp)
+  8001e1:	e8 9d ff ff ff       	call   800183 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001e6:	c9                   	leave
+  8001e7:	c3                   	ret
+
+008001e8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8001e8:	55                   	push   %ebp
+  8001e9:	89 e5                	mov    %esp,%ebp
+  8001eb:	57                   	push   %edi
+  8001ec:	56                   	push   %esi
+  8001ed:	53                   	push   %ebx
+  8001ee:	83 ec 1c             	sub    $0x1c,%esp
+  8001f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8001f4:	89 d6                	mov    %edx,%esi
+  8001f6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8001f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001fc:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8001ff:	73 0b                	jae    80020c <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800201:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800204:	c1 e7 08             	shl    $0x8,%edi
+  800207:	0b 7d 10             	or     0x10(%ebp),%edi
+  80020a:	eb 36                	jmp    800242 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80020c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80020f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800214:	f7 75 08             	divl   0x8(%ebp)
+  800217:	89 c1                	mov    %eax,%ecx
+  800219:	ff 75 14             	push   0x14(%ebp)
+  80021c:	ff 75 10             	push   0x10(%ebp)
+  80021f:	83 eb 01             	sub    $0x1,%ebx
+  800222:	53                   	push   %ebx
+  800223:	ff 75 08             	push   0x8(%ebp)
+  800226:	89 f2                	mov    %esi,%edx
+  800228:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80022b:	e8 b8 ff ff ff       	call   8001e8 <printnum>
+  800230:	83 c4 10             	add    $0x10,%esp
+  800233:	eb 14                	jmp    800249 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800235:	83 ec 08             	sub    $0x8,%esp
+  800238:	56                   	push   %esi
+  800239:	57                   	push   %edi
+  80023a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80023d:	ff d0                	call   *%eax
+  80023f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800242:	83 eb 01             	sub    $0x1,%ebx
+  800245:	85 db                	test   %ebx,%ebx
+  800247:	7f ec                	jg     800235 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800249:	83 ec 08             	sub    $0x8,%esp
+  80024c:	56                   	push   %esi
+  80024d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800250:	ba 00 00 00 00       	mov    $0x0,%edx
+  800255:	f7 75 08             	divl   0x8(%ebp)
+  800258:	0f be 92 9f 2b 80 00 	movsbl 0x802b9f(%edx),%edx
+  80025f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800262:	c1 e0 08             	shl    $0x8,%eax
+  800265:	09 d0                	or     %edx,%eax
+  800267:	50                   	push   %eax
+  800268:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80026b:	ff d0                	call   *%eax
+}
+  80026d:	83 c4 10             	add    $0x10,%esp
+  800270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800273:	5b                   	pop    %ebx
+  800274:	5e                   	pop    %esi
+  800275:	5f                   	pop    %edi
+  800276:	5d                   	pop    %ebp
+  800277:	c3                   	ret
+
+00800278 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800278:	55                   	push   %ebp
+  800279:	89 e5                	mov    %esp,%ebp
+  80027b:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800282:	8b 10                	mov    (%eax),%edx
+  800284:	3b 50 04             	cmp    0x4(%eax),%edx
+  800287:	73 0a                	jae    800293 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800289:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80028c:	89 08                	mov    %ecx,(%eax)
+  80028e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800291:	88 02                	mov    %al,(%edx)
+}
+  800293:	5d                   	pop    %ebp
+  800294:	c3                   	ret
+
+00800295 <printfmt>:
+{
+  800295:	55                   	push   %ebp
+  800296:	89 e5                	mov    %esp,%ebp
+  800298:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80029b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029e:	50                   	push   %eax
+  80029f:	ff 75 10             	push   0x10(%ebp)
+  8002a2:	ff 75 0c             	push   0xc(%ebp)
+  8002a5:	ff 75 08             	push   0x8(%ebp)
+  8002a8:	e8 05 00 00 00       	call   8002b2 <vprintfmt>
+}
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	c9                   	leave
+  8002b1:	c3                   	ret
+
+008002b2 <vprintfmt>:
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	57                   	push   %edi
+  8002b6:	56                   	push   %esi
+  8002b7:	53                   	push   %ebx
+  8002b8:	83 ec 3c             	sub    $0x3c,%esp
+  8002bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002be:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002c1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002c8:	eb 16                	jmp    8002e0 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002ca:	83 ec 08             	sub    $0x8,%esp
+  8002cd:	ff 75 0c             	push   0xc(%ebp)
+  8002d0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002d3:	c1 e2 08             	shl    $0x8,%edx
+  8002d6:	09 d0                	or     %edx,%eax
+  8002d8:	50                   	push   %eax
+  8002d9:	ff d7                	call   *%edi
+  8002db:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002de:	89 de                	mov    %ebx,%esi
+  8002e0:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8002e3:	0f b6 06             	movzbl (%esi),%eax
+  8002e6:	83 f8 25             	cmp    $0x25,%eax
+  8002e9:	74 0c                	je     8002f7 <vprintfmt+0x45>
+			if (ch == '\0')
+  8002eb:	85 c0                	test   %eax,%eax
+  8002ed:	75 db                	jne    8002ca <vprintfmt+0x18>
+}
+  8002ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f2:	5b                   	pop    %ebx
+  8002f3:	5e                   	pop    %esi
+  8002f4:	5f                   	pop    %edi
+  8002f5:	5d                   	pop    %ebp
+  8002f6:	c3                   	ret
+		padc = ' ';
+  8002f7:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8002fb:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800302:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800309:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800310:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800315:	8d 73 01             	lea    0x1(%ebx),%esi
+  800318:	0f b6 13             	movzbl (%ebx),%edx
+  80031b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80031e:	3c 55                	cmp    $0x55,%al
+  800320:	0f 87 2c 04 00 00    	ja     800752 <vprintfmt+0x4a0>
+  800326:	0f b6 c0             	movzbl %al,%eax
+  800329:	ff 24 85 e0 2c 80 00 	jmp    *0x802ce0(,%eax,4)
+  800330:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800332:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800336:	eb dd                	jmp    800315 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800338:	89 f3                	mov    %esi,%ebx
+  80033a:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80033e:	eb d5                	jmp    800315 <vprintfmt+0x63>
+  800340:	0f b6 d2             	movzbl %dl,%edx
+  800343:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80034a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80034d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800351:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800354:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800357:	83 fe 09             	cmp    $0x9,%esi
+  80035a:	0f 87 8a 00 00 00    	ja     8003ea <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800360:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800363:	eb e5                	jmp    80034a <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800365:	8b 45 14             	mov    0x14(%ebp),%eax
+  800368:	8b 00                	mov    (%eax),%eax
+  80036a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800370:	8d 40 04             	lea    0x4(%eax),%eax
+  800373:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800376:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800378:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80037c:	79 97                	jns    800315 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80037e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800381:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800384:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80038b:	eb 88                	jmp    800315 <vprintfmt+0x63>
+			if (width < 0)
+  80038d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800390:	85 db                	test   %ebx,%ebx
+  800392:	b8 00 00 00 00       	mov    $0x0,%eax
+  800397:	0f 49 c3             	cmovns %ebx,%eax
+  80039a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80039d:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80039f:	e9 71 ff ff ff       	jmp    800315 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a4:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003a6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003ad:	e9 63 ff ff ff       	jmp    800315 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003b2:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003b5:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003b9:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003c0:	3c 67                	cmp    $0x67,%al
+  8003c2:	0f 84 18 ff ff ff    	je     8002e0 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003c8:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003cf:	3c 72                	cmp    $0x72,%al
+  8003d1:	0f 84 09 ff ff ff    	je     8002e0 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003d7:	3c 62                	cmp    $0x62,%al
+  8003d9:	0f 94 c0             	sete   %al
+  8003dc:	0f b6 c0             	movzbl %al,%eax
+  8003df:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003e5:	e9 f6 fe ff ff       	jmp    8002e0 <vprintfmt+0x2e>
+  8003ea:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ed:	eb 89                	jmp    800378 <vprintfmt+0xc6>
+			lflag++;
+  8003ef:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f2:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003f4:	e9 1c ff ff ff       	jmp    800315 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8003f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fc:	8d 58 04             	lea    0x4(%eax),%ebx
+  8003ff:	83 ec 08             	sub    $0x8,%esp
+  800402:	ff 75 0c             	push   0xc(%ebp)
+  800405:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800408:	c1 e0 08             	shl    $0x8,%eax
+  80040b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80040e:	0b 01                	or     (%ecx),%eax
+  800410:	50                   	push   %eax
+  800411:	ff d7                	call   *%edi
+			break;
+  800413:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800416:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800419:	e9 c2 fe ff ff       	jmp    8002e0 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80041e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800421:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800424:	8b 10                	mov    (%eax),%edx
+  800426:	89 d0                	mov    %edx,%eax
+  800428:	f7 d8                	neg    %eax
+  80042a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80042d:	83 f8 12             	cmp    $0x12,%eax
+  800430:	7f 25                	jg     800457 <vprintfmt+0x1a5>
+  800432:	8b 14 85 40 2e 80 00 	mov    0x802e40(,%eax,4),%edx
+  800439:	85 d2                	test   %edx,%edx
+  80043b:	74 1a                	je     800457 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80043d:	52                   	push   %edx
+  80043e:	68 81 2f 80 00       	push   $0x802f81
+  800443:	ff 75 0c             	push   0xc(%ebp)
+  800446:	57                   	push   %edi
+  800447:	e8 49 fe ff ff       	call   800295 <printfmt>
+  80044c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80044f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800452:	e9 89 fe ff ff       	jmp    8002e0 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800457:	50                   	push   %eax
+  800458:	68 b7 2b 80 00       	push   $0x802bb7
+  80045d:	ff 75 0c             	push   0xc(%ebp)
+  800460:	57                   	push   %edi
+  800461:	e8 2f fe ff ff       	call   800295 <printfmt>
+  800466:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800469:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046c:	e9 6f fe ff ff       	jmp    8002e0 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800471:	8b 45 14             	mov    0x14(%ebp),%eax
+  800474:	83 c0 04             	add    $0x4,%eax
+  800477:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80047a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80047f:	85 c9                	test   %ecx,%ecx
+  800481:	b8 b0 2b 80 00       	mov    $0x802bb0,%eax
+  800486:	0f 45 c1             	cmovne %ecx,%eax
+  800489:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80048c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800490:	7e 06                	jle    800498 <vprintfmt+0x1e6>
+  800492:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800496:	75 1a                	jne    8004b2 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800498:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80049b:	c1 e0 08             	shl    $0x8,%eax
+  80049e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004a1:	83 c8 3f             	or     $0x3f,%eax
+  8004a4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004a7:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004aa:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004ad:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004b0:	eb 6d                	jmp    80051f <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b2:	83 ec 08             	sub    $0x8,%esp
+  8004b5:	ff 75 d0             	push   -0x30(%ebp)
+  8004b8:	ff 75 c8             	push   -0x38(%ebp)
+  8004bb:	e8 39 03 00 00       	call   8007f9 <strnlen>
+  8004c0:	89 c2                	mov    %eax,%edx
+  8004c2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c5:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004c7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004ca:	c1 e1 08             	shl    $0x8,%ecx
+  8004cd:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004d1:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d3:	83 c4 10             	add    $0x10,%esp
+  8004d6:	89 c3                	mov    %eax,%ebx
+  8004d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004db:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004de:	89 ce                	mov    %ecx,%esi
+  8004e0:	eb 0f                	jmp    8004f1 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8004e2:	83 ec 08             	sub    $0x8,%esp
+  8004e5:	ff 75 0c             	push   0xc(%ebp)
+  8004e8:	56                   	push   %esi
+  8004e9:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004eb:	83 eb 01             	sub    $0x1,%ebx
+  8004ee:	83 c4 10             	add    $0x10,%esp
+  8004f1:	85 db                	test   %ebx,%ebx
+  8004f3:	7f ed                	jg     8004e2 <vprintfmt+0x230>
+  8004f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8004fb:	85 c0                	test   %eax,%eax
+  8004fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800502:	0f 49 d0             	cmovns %eax,%edx
+  800505:	29 d0                	sub    %edx,%eax
+  800507:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050a:	eb 8c                	jmp    800498 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80050c:	83 ec 08             	sub    $0x8,%esp
+  80050f:	ff 75 0c             	push   0xc(%ebp)
+  800512:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800515:	09 c2                	or     %eax,%edx
+  800517:	52                   	push   %edx
+  800518:	ff d7                	call   *%edi
+  80051a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80051d:	89 d9                	mov    %ebx,%ecx
+  80051f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800522:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800526:	0f be d0             	movsbl %al,%edx
+  800529:	85 d2                	test   %edx,%edx
+  80052b:	74 2a                	je     800557 <vprintfmt+0x2a5>
+  80052d:	85 f6                	test   %esi,%esi
+  80052f:	78 05                	js     800536 <vprintfmt+0x284>
+  800531:	83 ee 01             	sub    $0x1,%esi
+  800534:	78 3b                	js     800571 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800536:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80053a:	74 d0                	je     80050c <vprintfmt+0x25a>
+  80053c:	0f be c0             	movsbl %al,%eax
+  80053f:	83 e8 20             	sub    $0x20,%eax
+  800542:	83 f8 5e             	cmp    $0x5e,%eax
+  800545:	76 c5                	jbe    80050c <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800547:	83 ec 08             	sub    $0x8,%esp
+  80054a:	ff 75 0c             	push   0xc(%ebp)
+  80054d:	ff 75 cc             	push   -0x34(%ebp)
+  800550:	ff d7                	call   *%edi
+  800552:	83 c4 10             	add    $0x10,%esp
+  800555:	eb c6                	jmp    80051d <vprintfmt+0x26b>
+  800557:	8b 75 10             	mov    0x10(%ebp),%esi
+  80055a:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80055d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800560:	01 c3                	add    %eax,%ebx
+  800562:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800564:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800567:	83 c8 20             	or     $0x20,%eax
+  80056a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80056d:	89 c6                	mov    %eax,%esi
+  80056f:	eb 14                	jmp    800585 <vprintfmt+0x2d3>
+  800571:	8b 75 10             	mov    0x10(%ebp),%esi
+  800574:	eb e4                	jmp    80055a <vprintfmt+0x2a8>
+  800576:	83 ec 08             	sub    $0x8,%esp
+  800579:	ff 75 0c             	push   0xc(%ebp)
+  80057c:	56                   	push   %esi
+  80057d:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80057f:	83 eb 01             	sub    $0x1,%ebx
+  800582:	83 c4 10             	add    $0x10,%esp
+  800585:	85 db                	test   %ebx,%ebx
+  800587:	7f ed                	jg     800576 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800589:	8b 75 10             	mov    0x10(%ebp),%esi
+  80058c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80058f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800592:	e9 49 fd ff ff       	jmp    8002e0 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800597:	83 f9 01             	cmp    $0x1,%ecx
+  80059a:	7f 1f                	jg     8005bb <vprintfmt+0x309>
+	else if (lflag)
+  80059c:	85 c9                	test   %ecx,%ecx
+  80059e:	74 69                	je     800609 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8b 00                	mov    (%eax),%eax
+  8005a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a8:	89 c1                	mov    %eax,%ecx
+  8005aa:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ad:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b9:	eb 17                	jmp    8005d2 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005be:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c1:	8b 00                	mov    (%eax),%eax
+  8005c3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8d 40 08             	lea    0x8(%eax),%eax
+  8005cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005d2:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005d5:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005dd:	85 db                	test   %ebx,%ebx
+  8005df:	0f 89 f6 00 00 00    	jns    8006db <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8005e5:	83 ec 08             	sub    $0x8,%esp
+  8005e8:	ff 75 0c             	push   0xc(%ebp)
+  8005eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005ee:	c1 e0 08             	shl    $0x8,%eax
+  8005f1:	83 c8 2d             	or     $0x2d,%eax
+  8005f4:	50                   	push   %eax
+  8005f5:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8005f7:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005fa:	f7 d9                	neg    %ecx
+  8005fc:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800604:	e9 d2 00 00 00       	jmp    8006db <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060c:	8b 00                	mov    (%eax),%eax
+  80060e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800611:	89 c1                	mov    %eax,%ecx
+  800613:	c1 f9 1f             	sar    $0x1f,%ecx
+  800616:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8d 40 04             	lea    0x4(%eax),%eax
+  80061f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800622:	eb ae                	jmp    8005d2 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800624:	83 f9 01             	cmp    $0x1,%ecx
+  800627:	7f 19                	jg     800642 <vprintfmt+0x390>
+	else if (lflag)
+  800629:	85 c9                	test   %ecx,%ecx
+  80062b:	74 2a                	je     800657 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 08                	mov    (%eax),%ecx
+  800632:	8d 40 04             	lea    0x4(%eax),%eax
+  800635:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800638:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80063d:	e9 99 00 00 00       	jmp    8006db <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800642:	8b 45 14             	mov    0x14(%ebp),%eax
+  800645:	8b 08                	mov    (%eax),%ecx
+  800647:	8d 40 08             	lea    0x8(%eax),%eax
+  80064a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064d:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800652:	e9 84 00 00 00       	jmp    8006db <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 08                	mov    (%eax),%ecx
+  80065c:	8d 40 04             	lea    0x4(%eax),%eax
+  80065f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800662:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800667:	eb 72                	jmp    8006db <vprintfmt+0x429>
+	if (lflag >= 2)
+  800669:	83 f9 01             	cmp    $0x1,%ecx
+  80066c:	7f 16                	jg     800684 <vprintfmt+0x3d2>
+	else if (lflag)
+  80066e:	85 c9                	test   %ecx,%ecx
+  800670:	74 24                	je     800696 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 08                	mov    (%eax),%ecx
+  800677:	8d 40 04             	lea    0x4(%eax),%eax
+  80067a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067d:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800682:	eb 57                	jmp    8006db <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 08                	mov    (%eax),%ecx
+  800689:	8d 40 08             	lea    0x8(%eax),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80068f:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800694:	eb 45                	jmp    8006db <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 08                	mov    (%eax),%ecx
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a1:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006a6:	eb 33                	jmp    8006db <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006a8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006ab:	c1 e3 08             	shl    $0x8,%ebx
+  8006ae:	83 ec 08             	sub    $0x8,%esp
+  8006b1:	ff 75 0c             	push   0xc(%ebp)
+  8006b4:	89 d8                	mov    %ebx,%eax
+  8006b6:	83 c8 30             	or     $0x30,%eax
+  8006b9:	50                   	push   %eax
+  8006ba:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006bc:	83 c4 08             	add    $0x8,%esp
+  8006bf:	ff 75 0c             	push   0xc(%ebp)
+  8006c2:	83 cb 78             	or     $0x78,%ebx
+  8006c5:	53                   	push   %ebx
+  8006c6:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006cd:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d6:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006db:	ff 75 e4             	push   -0x1c(%ebp)
+  8006de:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006e2:	52                   	push   %edx
+  8006e3:	ff 75 e0             	push   -0x20(%ebp)
+  8006e6:	50                   	push   %eax
+  8006e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ea:	89 f8                	mov    %edi,%eax
+  8006ec:	e8 f7 fa ff ff       	call   8001e8 <printnum>
+			break;
+  8006f1:	83 c4 10             	add    $0x10,%esp
+  8006f4:	e9 e7 fb ff ff       	jmp    8002e0 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006f9:	83 f9 01             	cmp    $0x1,%ecx
+  8006fc:	7f 16                	jg     800714 <vprintfmt+0x462>
+	else if (lflag)
+  8006fe:	85 c9                	test   %ecx,%ecx
+  800700:	74 24                	je     800726 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 08                	mov    (%eax),%ecx
+  800707:	8d 40 04             	lea    0x4(%eax),%eax
+  80070a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800712:	eb c7                	jmp    8006db <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8b 08                	mov    (%eax),%ecx
+  800719:	8d 40 08             	lea    0x8(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071f:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800724:	eb b5                	jmp    8006db <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 08                	mov    (%eax),%ecx
+  80072b:	8d 40 04             	lea    0x4(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800731:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800736:	eb a3                	jmp    8006db <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800738:	83 ec 08             	sub    $0x8,%esp
+  80073b:	ff 75 0c             	push   0xc(%ebp)
+  80073e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800741:	c1 e0 08             	shl    $0x8,%eax
+  800744:	83 c8 25             	or     $0x25,%eax
+  800747:	50                   	push   %eax
+  800748:	ff d7                	call   *%edi
+			break;
+  80074a:	83 c4 10             	add    $0x10,%esp
+  80074d:	e9 8e fb ff ff       	jmp    8002e0 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800752:	83 ec 08             	sub    $0x8,%esp
+  800755:	ff 75 0c             	push   0xc(%ebp)
+  800758:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80075b:	c1 e0 08             	shl    $0x8,%eax
+  80075e:	83 c8 25             	or     $0x25,%eax
+  800761:	50                   	push   %eax
+  800762:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800764:	83 c4 10             	add    $0x10,%esp
+  800767:	89 de                	mov    %ebx,%esi
+  800769:	eb 03                	jmp    80076e <vprintfmt+0x4bc>
+  80076b:	83 ee 01             	sub    $0x1,%esi
+  80076e:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800772:	75 f7                	jne    80076b <vprintfmt+0x4b9>
+  800774:	e9 67 fb ff ff       	jmp    8002e0 <vprintfmt+0x2e>
+
+00800779 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800779:	55                   	push   %ebp
+  80077a:	89 e5                	mov    %esp,%ebp
+  80077c:	83 ec 18             	sub    $0x18,%esp
+  80077f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800782:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800785:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800788:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80078c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80078f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800796:	85 c0                	test   %eax,%eax
+  800798:	74 26                	je     8007c0 <vsnprintf+0x47>
+  80079a:	85 d2                	test   %edx,%edx
+  80079c:	7e 22                	jle    8007c0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80079e:	ff 75 14             	push   0x14(%ebp)
+  8007a1:	ff 75 10             	push   0x10(%ebp)
+  8007a4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007a7:	50                   	push   %eax
+  8007a8:	68 78 02 80 00       	push   $0x800278
+  8007ad:	e8 00 fb ff ff       	call   8002b2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007b2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007b5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007bb:	83 c4 10             	add    $0x10,%esp
+}
+  8007be:	c9                   	leave
+  8007bf:	c3                   	ret
+		return -E_INVAL;
+  8007c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c5:	eb f7                	jmp    8007be <vsnprintf+0x45>
+
+008007c7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007c7:	55                   	push   %ebp
+  8007c8:	89 e5                	mov    %esp,%ebp
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007cd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d0:	50                   	push   %eax
+  8007d1:	ff 75 10             	push   0x10(%ebp)
+  8007d4:	ff 75 0c             	push   0xc(%ebp)
+  8007d7:	ff 75 08             	push   0x8(%ebp)
+  8007da:	e8 9a ff ff ff       	call   800779 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007df:	c9                   	leave
+  8007e0:	c3                   	ret
+
+008007e1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e1:	55                   	push   %ebp
+  8007e2:	89 e5                	mov    %esp,%ebp
+  8007e4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ec:	eb 03                	jmp    8007f1 <strlen+0x10>
+		n++;
+  8007ee:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007f1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007f5:	75 f7                	jne    8007ee <strlen+0xd>
+	return n;
+}
+  8007f7:	5d                   	pop    %ebp
+  8007f8:	c3                   	ret
+
+008007f9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800802:	b8 00 00 00 00       	mov    $0x0,%eax
+  800807:	eb 03                	jmp    80080c <strnlen+0x13>
+		n++;
+  800809:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80080c:	39 d0                	cmp    %edx,%eax
+  80080e:	74 08                	je     800818 <strnlen+0x1f>
+  800810:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800814:	75 f3                	jne    800809 <strnlen+0x10>
+  800816:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800818:	89 d0                	mov    %edx,%eax
+  80081a:	5d                   	pop    %ebp
+  80081b:	c3                   	ret
+
+0080081c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80081c:	55                   	push   %ebp
+  80081d:	89 e5                	mov    %esp,%ebp
+  80081f:	53                   	push   %ebx
+  800820:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800823:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800826:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80082f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800832:	83 c0 01             	add    $0x1,%eax
+  800835:	84 d2                	test   %dl,%dl
+  800837:	75 f2                	jne    80082b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800839:	89 c8                	mov    %ecx,%eax
+  80083b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083e:	c9                   	leave
+  80083f:	c3                   	ret
+
+00800840 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800840:	55                   	push   %ebp
+  800841:	89 e5                	mov    %esp,%ebp
+  800843:	53                   	push   %ebx
+  800844:	83 ec 10             	sub    $0x10,%esp
+  800847:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80084a:	53                   	push   %ebx
+  80084b:	e8 91 ff ff ff       	call   8007e1 <strlen>
+  800850:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800853:	ff 75 0c             	push   0xc(%ebp)
+  800856:	01 d8                	add    %ebx,%eax
+  800858:	50                   	push   %eax
+  800859:	e8 be ff ff ff       	call   80081c <strcpy>
+	return dst;
+}
+  80085e:	89 d8                	mov    %ebx,%eax
+  800860:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800863:	c9                   	leave
+  800864:	c3                   	ret
+
+00800865 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800865:	55                   	push   %ebp
+  800866:	89 e5                	mov    %esp,%ebp
+  800868:	56                   	push   %esi
+  800869:	53                   	push   %ebx
+  80086a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800870:	89 f3                	mov    %esi,%ebx
+  800872:	03 5d 10             	add    0x10(%ebp),%ebx
+  800875:	89 f0                	mov    %esi,%eax
+  800877:	eb 0f                	jmp    800888 <strncpy+0x23>
+		*dst++ = *src;
+  800879:	83 c0 01             	add    $0x1,%eax
+  80087c:	0f b6 0a             	movzbl (%edx),%ecx
+  80087f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800882:	80 f9 01             	cmp    $0x1,%cl
+  800885:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800888:	39 d8                	cmp    %ebx,%eax
+  80088a:	75 ed                	jne    800879 <strncpy+0x14>
+	}
+	return ret;
+}
+  80088c:	89 f0                	mov    %esi,%eax
+  80088e:	5b                   	pop    %ebx
+  80088f:	5e                   	pop    %esi
+  800890:	5d                   	pop    %ebp
+  800891:	c3                   	ret
+
+00800892 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	56                   	push   %esi
+  800896:	53                   	push   %ebx
+  800897:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80089d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a0:	89 f0                	mov    %esi,%eax
+  8008a2:	85 d2                	test   %edx,%edx
+  8008a4:	74 21                	je     8008c7 <strlcpy+0x35>
+  8008a6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008aa:	89 f2                	mov    %esi,%edx
+  8008ac:	eb 09                	jmp    8008b7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008ae:	83 c1 01             	add    $0x1,%ecx
+  8008b1:	83 c2 01             	add    $0x1,%edx
+  8008b4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008b7:	39 c2                	cmp    %eax,%edx
+  8008b9:	74 09                	je     8008c4 <strlcpy+0x32>
+  8008bb:	0f b6 19             	movzbl (%ecx),%ebx
+  8008be:	84 db                	test   %bl,%bl
+  8008c0:	75 ec                	jne    8008ae <strlcpy+0x1c>
+  8008c2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008c4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008c7:	29 f0                	sub    %esi,%eax
+}
+  8008c9:	5b                   	pop    %ebx
+  8008ca:	5e                   	pop    %esi
+  8008cb:	5d                   	pop    %ebp
+  8008cc:	c3                   	ret
+
+008008cd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008cd:	55                   	push   %ebp
+  8008ce:	89 e5                	mov    %esp,%ebp
+  8008d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008d6:	eb 06                	jmp    8008de <strcmp+0x11>
+		p++, q++;
+  8008d8:	83 c1 01             	add    $0x1,%ecx
+  8008db:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008de:	0f b6 01             	movzbl (%ecx),%eax
+  8008e1:	84 c0                	test   %al,%al
+  8008e3:	74 04                	je     8008e9 <strcmp+0x1c>
+  8008e5:	3a 02                	cmp    (%edx),%al
+  8008e7:	74 ef                	je     8008d8 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008e9:	0f b6 c0             	movzbl %al,%eax
+  8008ec:	0f b6 12             	movzbl (%edx),%edx
+  8008ef:	29 d0                	sub    %edx,%eax
+}
+  8008f1:	5d                   	pop    %ebp
+  8008f2:	c3                   	ret
+
+008008f3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f3:	55                   	push   %ebp
+  8008f4:	89 e5                	mov    %esp,%ebp
+  8008f6:	53                   	push   %ebx
+  8008f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008fd:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800900:	eb 09                	jmp    80090b <strncmp+0x18>
+		n--, p++, q++;
+  800902:	83 ea 01             	sub    $0x1,%edx
+  800905:	83 c0 01             	add    $0x1,%eax
+  800908:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80090b:	85 d2                	test   %edx,%edx
+  80090d:	74 18                	je     800927 <strncmp+0x34>
+  80090f:	0f b6 18             	movzbl (%eax),%ebx
+  800912:	84 db                	test   %bl,%bl
+  800914:	74 04                	je     80091a <strncmp+0x27>
+  800916:	3a 19                	cmp    (%ecx),%bl
+  800918:	74 e8                	je     800902 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80091a:	0f b6 00             	movzbl (%eax),%eax
+  80091d:	0f b6 11             	movzbl (%ecx),%edx
+  800920:	29 d0                	sub    %edx,%eax
+}
+  800922:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800925:	c9                   	leave
+  800926:	c3                   	ret
+		return 0;
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	eb f4                	jmp    800922 <strncmp+0x2f>
+
+0080092e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80092e:	55                   	push   %ebp
+  80092f:	89 e5                	mov    %esp,%ebp
+  800931:	8b 45 08             	mov    0x8(%ebp),%eax
+  800934:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800938:	eb 03                	jmp    80093d <strchr+0xf>
+  80093a:	83 c0 01             	add    $0x1,%eax
+  80093d:	0f b6 10             	movzbl (%eax),%edx
+  800940:	84 d2                	test   %dl,%dl
+  800942:	74 06                	je     80094a <strchr+0x1c>
+		if (*s == c)
+  800944:	38 ca                	cmp    %cl,%dl
+  800946:	75 f2                	jne    80093a <strchr+0xc>
+  800948:	eb 05                	jmp    80094f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80094a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80094f:	5d                   	pop    %ebp
+  800950:	c3                   	ret
+
+00800951 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	8b 45 08             	mov    0x8(%ebp),%eax
+  800957:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80095b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80095e:	38 ca                	cmp    %cl,%dl
+  800960:	74 09                	je     80096b <strfind+0x1a>
+  800962:	84 d2                	test   %dl,%dl
+  800964:	74 05                	je     80096b <strfind+0x1a>
+	for (; *s; s++)
+  800966:	83 c0 01             	add    $0x1,%eax
+  800969:	eb f0                	jmp    80095b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80096b:	5d                   	pop    %ebp
+  80096c:	c3                   	ret
+
+0080096d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	57                   	push   %edi
+  800971:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800974:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800977:	85 c9                	test   %ecx,%ecx
+  800979:	74 20                	je     80099b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80097b:	89 f8                	mov    %edi,%eax
+  80097d:	09 c8                	or     %ecx,%eax
+  80097f:	a8 03                	test   $0x3,%al
+  800981:	75 12                	jne    800995 <memset+0x28>
+		c &= 0xFF;
+  800983:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800987:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80098d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800990:	fc                   	cld
+  800991:	f3 ab                	rep stos %eax,%es:(%edi)
+  800993:	eb 06                	jmp    80099b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800995:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800998:	fc                   	cld
+  800999:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80099b:	89 f8                	mov    %edi,%eax
+  80099d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a0:	c9                   	leave
+  8009a1:	c3                   	ret
+
+008009a2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	57                   	push   %edi
+  8009a6:	56                   	push   %esi
+  8009a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009aa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b0:	39 c6                	cmp    %eax,%esi
+  8009b2:	73 32                	jae    8009e6 <memmove+0x44>
+  8009b4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009b7:	39 d0                	cmp    %edx,%eax
+  8009b9:	73 2b                	jae    8009e6 <memmove+0x44>
+		s += n;
+		d += n;
+  8009bb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009be:	89 d6                	mov    %edx,%esi
+  8009c0:	09 fe                	or     %edi,%esi
+  8009c2:	09 ce                	or     %ecx,%esi
+  8009c4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009ca:	75 0e                	jne    8009da <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009cc:	83 ef 04             	sub    $0x4,%edi
+  8009cf:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009d2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009d5:	fd                   	std
+  8009d6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d8:	eb 09                	jmp    8009e3 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009da:	83 ef 01             	sub    $0x1,%edi
+  8009dd:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e0:	fd                   	std
+  8009e1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009e3:	fc                   	cld
+  8009e4:	eb 1a                	jmp    800a00 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e6:	89 f2                	mov    %esi,%edx
+  8009e8:	09 c2                	or     %eax,%edx
+  8009ea:	09 ca                	or     %ecx,%edx
+  8009ec:	f6 c2 03             	test   $0x3,%dl
+  8009ef:	75 0a                	jne    8009fb <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009f4:	89 c7                	mov    %eax,%edi
+  8009f6:	fc                   	cld
+  8009f7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f9:	eb 05                	jmp    800a00 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009fb:	89 c7                	mov    %eax,%edi
+  8009fd:	fc                   	cld
+  8009fe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a00:	5e                   	pop    %esi
+  800a01:	5f                   	pop    %edi
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+
+00800a04 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a0a:	ff 75 10             	push   0x10(%ebp)
+  800a0d:	ff 75 0c             	push   0xc(%ebp)
+  800a10:	ff 75 08             	push   0x8(%ebp)
+  800a13:	e8 8a ff ff ff       	call   8009a2 <memmove>
+}
+  800a18:	c9                   	leave
+  800a19:	c3                   	ret
+
+00800a1a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	56                   	push   %esi
+  800a1e:	53                   	push   %ebx
+  800a1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a22:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a25:	89 c6                	mov    %eax,%esi
+  800a27:	03 75 10             	add    0x10(%ebp),%esi
+  800a2a:	eb 06                	jmp    800a32 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a2c:	83 c0 01             	add    $0x1,%eax
+  800a2f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a32:	39 f0                	cmp    %esi,%eax
+  800a34:	74 14                	je     800a4a <memcmp+0x30>
+		if (*s1 != *s2)
+  800a36:	0f b6 08             	movzbl (%eax),%ecx
+  800a39:	0f b6 1a             	movzbl (%edx),%ebx
+  800a3c:	38 d9                	cmp    %bl,%cl
+  800a3e:	74 ec                	je     800a2c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a40:	0f b6 c1             	movzbl %cl,%eax
+  800a43:	0f b6 db             	movzbl %bl,%ebx
+  800a46:	29 d8                	sub    %ebx,%eax
+  800a48:	eb 05                	jmp    800a4f <memcmp+0x35>
+	}
+
+	return 0;
+  800a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a4f:	5b                   	pop    %ebx
+  800a50:	5e                   	pop    %esi
+  800a51:	5d                   	pop    %ebp
+  800a52:	c3                   	ret
+
+00800a53 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a5c:	89 c2                	mov    %eax,%edx
+  800a5e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a61:	eb 03                	jmp    800a66 <memfind+0x13>
+  800a63:	83 c0 01             	add    $0x1,%eax
+  800a66:	39 d0                	cmp    %edx,%eax
+  800a68:	73 04                	jae    800a6e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a6a:	38 08                	cmp    %cl,(%eax)
+  800a6c:	75 f5                	jne    800a63 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a6e:	5d                   	pop    %ebp
+  800a6f:	c3                   	ret
+
+00800a70 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	57                   	push   %edi
+  800a74:	56                   	push   %esi
+  800a75:	53                   	push   %ebx
+  800a76:	83 ec 1c             	sub    $0x1c,%esp
+  800a79:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a7f:	eb 03                	jmp    800a84 <strtol+0x14>
+		s++;
+  800a81:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800a84:	0f b6 06             	movzbl (%esi),%eax
+  800a87:	3c 20                	cmp    $0x20,%al
+  800a89:	74 f6                	je     800a81 <strtol+0x11>
+  800a8b:	3c 09                	cmp    $0x9,%al
+  800a8d:	74 f2                	je     800a81 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a8f:	3c 2b                	cmp    $0x2b,%al
+  800a91:	74 43                	je     800ad6 <strtol+0x66>
+	int neg = 0;
+  800a93:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800a98:	3c 2d                	cmp    $0x2d,%al
+  800a9a:	74 44                	je     800ae0 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9c:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800aa2:	75 0f                	jne    800ab3 <strtol+0x43>
+  800aa4:	80 3e 30             	cmpb   $0x30,(%esi)
+  800aa7:	74 41                	je     800aea <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aa9:	85 ff                	test   %edi,%edi
+  800aab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab0:	0f 44 f8             	cmove  %eax,%edi
+  800ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab8:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800abd:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ac0:	89 fb                	mov    %edi,%ebx
+  800ac2:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ac5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ac8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800acb:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ace:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800ad1:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ad4:	eb 67                	jmp    800b3d <strtol+0xcd>
+		s++;
+  800ad6:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800ad9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ade:	eb bc                	jmp    800a9c <strtol+0x2c>
+		s++, neg = 1;
+  800ae0:	83 c6 01             	add    $0x1,%esi
+  800ae3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ae8:	eb b2                	jmp    800a9c <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aea:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800aee:	74 0e                	je     800afe <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800af0:	85 ff                	test   %edi,%edi
+  800af2:	75 bf                	jne    800ab3 <strtol+0x43>
+		s++, base = 8;
+  800af4:	83 c6 01             	add    $0x1,%esi
+  800af7:	bf 08 00 00 00       	mov    $0x8,%edi
+  800afc:	eb b5                	jmp    800ab3 <strtol+0x43>
+		s += 2, base = 16;
+  800afe:	83 c6 02             	add    $0x2,%esi
+  800b01:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b06:	eb ab                	jmp    800ab3 <strtol+0x43>
+			dig = *s - '0';
+  800b08:	0f be c9             	movsbl %cl,%ecx
+  800b0b:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b0e:	39 f9                	cmp    %edi,%ecx
+  800b10:	7d 59                	jge    800b6b <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b12:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b16:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b19:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b1c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b1f:	0f af d8             	imul   %eax,%ebx
+  800b22:	0f af d7             	imul   %edi,%edx
+  800b25:	01 d3                	add    %edx,%ebx
+  800b27:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b2a:	f7 e7                	mul    %edi
+  800b2c:	01 da                	add    %ebx,%edx
+  800b2e:	89 cb                	mov    %ecx,%ebx
+  800b30:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b33:	01 c8                	add    %ecx,%eax
+  800b35:	11 da                	adc    %ebx,%edx
+  800b37:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b3a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b40:	0f b6 08             	movzbl (%eax),%ecx
+  800b43:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b46:	80 fb 09             	cmp    $0x9,%bl
+  800b49:	76 bd                	jbe    800b08 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b4b:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b4e:	80 fb 19             	cmp    $0x19,%bl
+  800b51:	77 08                	ja     800b5b <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b53:	0f be c9             	movsbl %cl,%ecx
+  800b56:	83 e9 57             	sub    $0x57,%ecx
+  800b59:	eb b3                	jmp    800b0e <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b5b:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b5e:	80 fb 19             	cmp    $0x19,%bl
+  800b61:	77 08                	ja     800b6b <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b63:	0f be c9             	movsbl %cl,%ecx
+  800b66:	83 e9 37             	sub    $0x37,%ecx
+  800b69:	eb a3                	jmp    800b0e <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b6b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b6e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b71:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b74:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b77:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b7b:	74 05                	je     800b82 <strtol+0x112>
+		*endptr = (char *) s;
+  800b7d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b80:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800b82:	85 c9                	test   %ecx,%ecx
+  800b84:	74 07                	je     800b8d <strtol+0x11d>
+  800b86:	f7 d8                	neg    %eax
+  800b88:	83 d2 00             	adc    $0x0,%edx
+  800b8b:	f7 da                	neg    %edx
+}
+  800b8d:	83 c4 1c             	add    $0x1c,%esp
+  800b90:	5b                   	pop    %ebx
+  800b91:	5e                   	pop    %esi
+  800b92:	5f                   	pop    %edi
+  800b93:	5d                   	pop    %ebp
+  800b94:	c3                   	ret
+
+00800b95 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	57                   	push   %edi
+  800b99:	56                   	push   %esi
+  800b9a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800b9b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ba2:	74 18                	je     800bbc <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800baf:	89 c3                	mov    %eax,%ebx
+  800bb1:	89 c7                	mov    %eax,%edi
+  800bb3:	89 c6                	mov    %eax,%esi
+  800bb5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bb7:	5b                   	pop    %ebx
+  800bb8:	5e                   	pop    %esi
+  800bb9:	5f                   	pop    %edi
+  800bba:	5d                   	pop    %ebp
+  800bbb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc7:	89 c3                	mov    %eax,%ebx
+  800bc9:	89 c7                	mov    %eax,%edi
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	8d 35 d6 0b 80 00    	lea    0x800bd6,%esi
+  800bd4:	0f 34                	sysenter
+  800bd6:	5d                   	pop    %ebp
+		goto out;
+  800bd7:	eb de                	jmp    800bb7 <sys_cputs+0x22>
+
+00800bd9 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	57                   	push   %edi
+  800bdd:	56                   	push   %esi
+  800bde:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bdf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800be6:	74 19                	je     800c01 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bed:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bf2:	89 d1                	mov    %edx,%ecx
+  800bf4:	89 d3                	mov    %edx,%ebx
+  800bf6:	89 d7                	mov    %edx,%edi
+  800bf8:	89 d6                	mov    %edx,%esi
+  800bfa:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bfc:	5b                   	pop    %ebx
+  800bfd:	5e                   	pop    %esi
+  800bfe:	5f                   	pop    %edi
+  800bff:	5d                   	pop    %ebp
+  800c00:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c06:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c0b:	89 d1                	mov    %edx,%ecx
+  800c0d:	89 d3                	mov    %edx,%ebx
+  800c0f:	89 d7                	mov    %edx,%edi
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	8d 35 1c 0c 80 00    	lea    0x800c1c,%esi
+  800c1a:	0f 34                	sysenter
+  800c1c:	5d                   	pop    %ebp
+		goto out;
+  800c1d:	eb dd                	jmp    800bfc <sys_cgetc+0x23>
+
+00800c1f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	57                   	push   %edi
+  800c23:	56                   	push   %esi
+  800c24:	53                   	push   %ebx
+  800c25:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c28:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c2f:	74 21                	je     800c52 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c36:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3e:	89 cb                	mov    %ecx,%ebx
+  800c40:	89 cf                	mov    %ecx,%edi
+  800c42:	89 ce                	mov    %ecx,%esi
+  800c44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c46:	85 c0                	test   %eax,%eax
+  800c48:	7f 27                	jg     800c71 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4d:	5b                   	pop    %ebx
+  800c4e:	5e                   	pop    %esi
+  800c4f:	5f                   	pop    %edi
+  800c50:	5d                   	pop    %ebp
+  800c51:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c5f:	89 cb                	mov    %ecx,%ebx
+  800c61:	89 cf                	mov    %ecx,%edi
+  800c63:	55                   	push   %ebp
+  800c64:	89 e5                	mov    %esp,%ebp
+  800c66:	8d 35 6e 0c 80 00    	lea    0x800c6e,%esi
+  800c6c:	0f 34                	sysenter
+  800c6e:	5d                   	pop    %ebp
+		goto out;
+  800c6f:	eb d5                	jmp    800c46 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c71:	83 ec 0c             	sub    $0xc,%esp
+  800c74:	50                   	push   %eax
+  800c75:	6a 03                	push   $0x3
+  800c77:	68 ab 2e 80 00       	push   $0x802eab
+  800c7c:	6a 3f                	push   $0x3f
+  800c7e:	68 c8 2e 80 00       	push   $0x802ec8
+  800c83:	e8 71 f4 ff ff       	call   8000f9 <_panic>
+
+00800c88 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	57                   	push   %edi
+  800c8c:	56                   	push   %esi
+  800c8d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c8e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c95:	74 19                	je     800cb0 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800c97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ca1:	89 d1                	mov    %edx,%ecx
+  800ca3:	89 d3                	mov    %edx,%ebx
+  800ca5:	89 d7                	mov    %edx,%edi
+  800ca7:	89 d6                	mov    %edx,%esi
+  800ca9:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cab:	5b                   	pop    %ebx
+  800cac:	5e                   	pop    %esi
+  800cad:	5f                   	pop    %edi
+  800cae:	5d                   	pop    %ebp
+  800caf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cba:	89 d1                	mov    %edx,%ecx
+  800cbc:	89 d3                	mov    %edx,%ebx
+  800cbe:	89 d7                	mov    %edx,%edi
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	8d 35 cb 0c 80 00    	lea    0x800ccb,%esi
+  800cc9:	0f 34                	sysenter
+  800ccb:	5d                   	pop    %ebp
+		goto out;
+  800ccc:	eb dd                	jmp    800cab <sys_getenvid+0x23>
+
+00800cce <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cce:	55                   	push   %ebp
+  800ccf:	89 e5                	mov    %esp,%ebp
+  800cd1:	57                   	push   %edi
+  800cd2:	56                   	push   %esi
+  800cd3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cd4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cdb:	74 19                	je     800cf6 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ce7:	89 d1                	mov    %edx,%ecx
+  800ce9:	89 d3                	mov    %edx,%ebx
+  800ceb:	89 d7                	mov    %edx,%edi
+  800ced:	89 d6                	mov    %edx,%esi
+  800cef:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5f                   	pop    %edi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cfb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d00:	89 d1                	mov    %edx,%ecx
+  800d02:	89 d3                	mov    %edx,%ebx
+  800d04:	89 d7                	mov    %edx,%edi
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	8d 35 11 0d 80 00    	lea    0x800d11,%esi
+  800d0f:	0f 34                	sysenter
+  800d11:	5d                   	pop    %ebp
+		goto out;
+  800d12:	eb dd                	jmp    800cf1 <sys_yield+0x23>
+
+00800d14 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d14:	55                   	push   %ebp
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	57                   	push   %edi
+  800d18:	56                   	push   %esi
+  800d19:	53                   	push   %ebx
+  800d1a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d1d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d24:	74 23                	je     800d49 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d26:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d39:	89 f7                	mov    %esi,%edi
+  800d3b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	7f 29                	jg     800d6a <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d54:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5c:	55                   	push   %ebp
+  800d5d:	89 e5                	mov    %esp,%ebp
+  800d5f:	8d 35 67 0d 80 00    	lea    0x800d67,%esi
+  800d65:	0f 34                	sysenter
+  800d67:	5d                   	pop    %ebp
+		goto out;
+  800d68:	eb d3                	jmp    800d3d <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6a:	83 ec 0c             	sub    $0xc,%esp
+  800d6d:	50                   	push   %eax
+  800d6e:	6a 04                	push   $0x4
+  800d70:	68 ab 2e 80 00       	push   $0x802eab
+  800d75:	6a 3f                	push   $0x3f
+  800d77:	68 c8 2e 80 00       	push   $0x802ec8
+  800d7c:	e8 78 f3 ff ff       	call   8000f9 <_panic>
+
+00800d81 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d81:	55                   	push   %ebp
+  800d82:	89 e5                	mov    %esp,%ebp
+  800d84:	57                   	push   %edi
+  800d85:	56                   	push   %esi
+  800d86:	53                   	push   %ebx
+  800d87:	83 ec 0c             	sub    $0xc,%esp
+  800d8a:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800d8d:	85 f6                	test   %esi,%esi
+  800d8f:	75 09                	jne    800d9a <sys_page_map+0x19>
+  800d91:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d98:	74 1f                	je     800db9 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800d9a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dad:	85 c0                	test   %eax,%eax
+  800daf:	7f 27                	jg     800dd8 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db4:	5b                   	pop    %ebx
+  800db5:	5e                   	pop    %esi
+  800db6:	5f                   	pop    %edi
+  800db7:	5d                   	pop    %ebp
+  800db8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	8d 35 d5 0d 80 00    	lea    0x800dd5,%esi
+  800dd3:	0f 34                	sysenter
+  800dd5:	5d                   	pop    %ebp
+		goto out;
+  800dd6:	eb d5                	jmp    800dad <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd8:	83 ec 0c             	sub    $0xc,%esp
+  800ddb:	50                   	push   %eax
+  800ddc:	6a 05                	push   $0x5
+  800dde:	68 ab 2e 80 00       	push   $0x802eab
+  800de3:	6a 3f                	push   $0x3f
+  800de5:	68 c8 2e 80 00       	push   $0x802ec8
+  800dea:	e8 0a f3 ff ff       	call   8000f9 <_panic>
+
+00800def <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800def:	55                   	push   %ebp
+  800df0:	89 e5                	mov    %esp,%ebp
+  800df2:	57                   	push   %edi
+  800df3:	56                   	push   %esi
+  800df4:	53                   	push   %ebx
+  800df5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800df8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dff:	74 22                	je     800e23 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e06:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e11:	89 df                	mov    %ebx,%edi
+  800e13:	89 de                	mov    %ebx,%esi
+  800e15:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	7f 28                	jg     800e43 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1e:	5b                   	pop    %ebx
+  800e1f:	5e                   	pop    %esi
+  800e20:	5f                   	pop    %edi
+  800e21:	5d                   	pop    %ebp
+  800e22:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e33:	89 df                	mov    %ebx,%edi
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	8d 35 40 0e 80 00    	lea    0x800e40,%esi
+  800e3e:	0f 34                	sysenter
+  800e40:	5d                   	pop    %ebp
+		goto out;
+  800e41:	eb d4                	jmp    800e17 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e43:	83 ec 0c             	sub    $0xc,%esp
+  800e46:	50                   	push   %eax
+  800e47:	6a 06                	push   $0x6
+  800e49:	68 ab 2e 80 00       	push   $0x802eab
+  800e4e:	6a 3f                	push   $0x3f
+  800e50:	68 c8 2e 80 00       	push   $0x802ec8
+  800e55:	e8 9f f2 ff ff       	call   8000f9 <_panic>
+
+00800e5a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e5a:	55                   	push   %ebp
+  800e5b:	89 e5                	mov    %esp,%ebp
+  800e5d:	57                   	push   %edi
+  800e5e:	56                   	push   %esi
+  800e5f:	53                   	push   %ebx
+  800e60:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e63:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e6a:	74 22                	je     800e8e <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e71:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	89 df                	mov    %ebx,%edi
+  800e7e:	89 de                	mov    %ebx,%esi
+  800e80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e82:	85 c0                	test   %eax,%eax
+  800e84:	7f 28                	jg     800eae <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e89:	5b                   	pop    %ebx
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5f                   	pop    %edi
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e99:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e9e:	89 df                	mov    %ebx,%edi
+  800ea0:	55                   	push   %ebp
+  800ea1:	89 e5                	mov    %esp,%ebp
+  800ea3:	8d 35 ab 0e 80 00    	lea    0x800eab,%esi
+  800ea9:	0f 34                	sysenter
+  800eab:	5d                   	pop    %ebp
+		goto out;
+  800eac:	eb d4                	jmp    800e82 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	50                   	push   %eax
+  800eb2:	6a 08                	push   $0x8
+  800eb4:	68 ab 2e 80 00       	push   $0x802eab
+  800eb9:	6a 3f                	push   $0x3f
+  800ebb:	68 c8 2e 80 00       	push   $0x802ec8
+  800ec0:	e8 34 f2 ff ff       	call   8000f9 <_panic>
+
+00800ec5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ece:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ed5:	74 22                	je     800ef9 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ed7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edc:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ee1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee7:	89 df                	mov    %ebx,%edi
+  800ee9:	89 de                	mov    %ebx,%esi
+  800eeb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eed:	85 c0                	test   %eax,%eax
+  800eef:	7f 28                	jg     800f19 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ef1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef4:	5b                   	pop    %ebx
+  800ef5:	5e                   	pop    %esi
+  800ef6:	5f                   	pop    %edi
+  800ef7:	5d                   	pop    %ebp
+  800ef8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f09:	89 df                	mov    %ebx,%edi
+  800f0b:	55                   	push   %ebp
+  800f0c:	89 e5                	mov    %esp,%ebp
+  800f0e:	8d 35 16 0f 80 00    	lea    0x800f16,%esi
+  800f14:	0f 34                	sysenter
+  800f16:	5d                   	pop    %ebp
+		goto out;
+  800f17:	eb d4                	jmp    800eed <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+  800f1c:	50                   	push   %eax
+  800f1d:	6a 09                	push   $0x9
+  800f1f:	68 ab 2e 80 00       	push   $0x802eab
+  800f24:	6a 3f                	push   $0x3f
+  800f26:	68 c8 2e 80 00       	push   $0x802ec8
+  800f2b:	e8 c9 f1 ff ff       	call   8000f9 <_panic>
+
+00800f30 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+  800f36:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f39:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f40:	74 22                	je     800f64 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f47:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f52:	89 df                	mov    %ebx,%edi
+  800f54:	89 de                	mov    %ebx,%esi
+  800f56:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f58:	85 c0                	test   %eax,%eax
+  800f5a:	7f 28                	jg     800f84 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f74:	89 df                	mov    %ebx,%edi
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	8d 35 81 0f 80 00    	lea    0x800f81,%esi
+  800f7f:	0f 34                	sysenter
+  800f81:	5d                   	pop    %ebp
+		goto out;
+  800f82:	eb d4                	jmp    800f58 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f84:	83 ec 0c             	sub    $0xc,%esp
+  800f87:	50                   	push   %eax
+  800f88:	6a 0a                	push   $0xa
+  800f8a:	68 ab 2e 80 00       	push   $0x802eab
+  800f8f:	6a 3f                	push   $0x3f
+  800f91:	68 c8 2e 80 00       	push   $0x802ec8
+  800f96:	e8 5e f1 ff ff       	call   8000f9 <_panic>
+
+00800f9b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+  800fa1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fa4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fab:	74 22                	je     800fcf <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb2:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbd:	89 df                	mov    %ebx,%edi
+  800fbf:	89 de                	mov    %ebx,%esi
+  800fc1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc3:	85 c0                	test   %eax,%eax
+  800fc5:	7f 28                	jg     800fef <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fca:	5b                   	pop    %ebx
+  800fcb:	5e                   	pop    %esi
+  800fcc:	5f                   	pop    %edi
+  800fcd:	5d                   	pop    %ebp
+  800fce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fda:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fdf:	89 df                	mov    %ebx,%edi
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	8d 35 ec 0f 80 00    	lea    0x800fec,%esi
+  800fea:	0f 34                	sysenter
+  800fec:	5d                   	pop    %ebp
+		goto out;
+  800fed:	eb d4                	jmp    800fc3 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fef:	83 ec 0c             	sub    $0xc,%esp
+  800ff2:	50                   	push   %eax
+  800ff3:	6a 17                	push   $0x17
+  800ff5:	68 ab 2e 80 00       	push   $0x802eab
+  800ffa:	6a 3f                	push   $0x3f
+  800ffc:	68 c8 2e 80 00       	push   $0x802ec8
+  801001:	e8 f3 f0 ff ff       	call   8000f9 <_panic>
+
+00801006 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801006:	55                   	push   %ebp
+  801007:	89 e5                	mov    %esp,%ebp
+  801009:	57                   	push   %edi
+  80100a:	56                   	push   %esi
+  80100b:	53                   	push   %ebx
+  80100c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80100f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801016:	74 22                	je     80103a <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801018:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801022:	8b 55 08             	mov    0x8(%ebp),%edx
+  801025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801028:	89 df                	mov    %ebx,%edi
+  80102a:	89 de                	mov    %ebx,%esi
+  80102c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102e:	85 c0                	test   %eax,%eax
+  801030:	7f 28                	jg     80105a <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801032:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801035:	5b                   	pop    %ebx
+  801036:	5e                   	pop    %esi
+  801037:	5f                   	pop    %edi
+  801038:	5d                   	pop    %ebp
+  801039:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	b8 18 00 00 00       	mov    $0x18,%eax
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	55                   	push   %ebp
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	8d 35 57 10 80 00    	lea    0x801057,%esi
+  801055:	0f 34                	sysenter
+  801057:	5d                   	pop    %ebp
+		goto out;
+  801058:	eb d4                	jmp    80102e <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105a:	83 ec 0c             	sub    $0xc,%esp
+  80105d:	50                   	push   %eax
+  80105e:	6a 18                	push   $0x18
+  801060:	68 ab 2e 80 00       	push   $0x802eab
+  801065:	6a 3f                	push   $0x3f
+  801067:	68 c8 2e 80 00       	push   $0x802ec8
+  80106c:	e8 88 f0 ff ff       	call   8000f9 <_panic>
+
+00801071 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801071:	55                   	push   %ebp
+  801072:	89 e5                	mov    %esp,%ebp
+  801074:	57                   	push   %edi
+  801075:	56                   	push   %esi
+  801076:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801077:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80107e:	74 1d                	je     80109d <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801080:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801085:	be 00 00 00 00       	mov    $0x0,%esi
+  80108a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801090:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801093:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801096:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801098:	5b                   	pop    %ebx
+  801099:	5e                   	pop    %esi
+  80109a:	5f                   	pop    %edi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+  8010b1:	8d 35 b9 10 80 00    	lea    0x8010b9,%esi
+  8010b7:	0f 34                	sysenter
+  8010b9:	5d                   	pop    %ebp
+		goto out;
+  8010ba:	eb dc                	jmp    801098 <sys_ipc_try_send+0x27>
+
+008010bc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+  8010c2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010c5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010cc:	74 21                	je     8010ef <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010db:	89 cb                	mov    %ecx,%ebx
+  8010dd:	89 cf                	mov    %ecx,%edi
+  8010df:	89 ce                	mov    %ecx,%esi
+  8010e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e3:	85 c0                	test   %eax,%eax
+  8010e5:	7f 27                	jg     80110e <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ea:	5b                   	pop    %ebx
+  8010eb:	5e                   	pop    %esi
+  8010ec:	5f                   	pop    %edi
+  8010ed:	5d                   	pop    %ebp
+  8010ee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010fc:	89 cb                	mov    %ecx,%ebx
+  8010fe:	89 cf                	mov    %ecx,%edi
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	8d 35 0b 11 80 00    	lea    0x80110b,%esi
+  801109:	0f 34                	sysenter
+  80110b:	5d                   	pop    %ebp
+		goto out;
+  80110c:	eb d5                	jmp    8010e3 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	50                   	push   %eax
+  801112:	6a 0d                	push   $0xd
+  801114:	68 ab 2e 80 00       	push   $0x802eab
+  801119:	6a 3f                	push   $0x3f
+  80111b:	68 c8 2e 80 00       	push   $0x802ec8
+  801120:	e8 d4 ef ff ff       	call   8000f9 <_panic>
+
+00801125 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80112b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801132:	74 1b                	je     80114f <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801139:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80113e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801141:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801144:	89 df                	mov    %ebx,%edi
+  801146:	89 de                	mov    %ebx,%esi
+  801148:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80114a:	5b                   	pop    %ebx
+  80114b:	5e                   	pop    %esi
+  80114c:	5f                   	pop    %edi
+  80114d:	5d                   	pop    %ebp
+  80114e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80114f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80115f:	89 df                	mov    %ebx,%edi
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	8d 35 6c 11 80 00    	lea    0x80116c,%esi
+  80116a:	0f 34                	sysenter
+  80116c:	5d                   	pop    %ebp
+		goto out;
+  80116d:	eb db                	jmp    80114a <sys_ipc_recv_until+0x25>
+
+0080116f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	57                   	push   %edi
+  801173:	56                   	push   %esi
+  801174:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801175:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80117c:	74 19                	je     801197 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80117e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801183:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801188:	89 d1                	mov    %edx,%ecx
+  80118a:	89 d3                	mov    %edx,%ebx
+  80118c:	89 d7                	mov    %edx,%edi
+  80118e:	89 d6                	mov    %edx,%esi
+  801190:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801192:	5b                   	pop    %ebx
+  801193:	5e                   	pop    %esi
+  801194:	5f                   	pop    %edi
+  801195:	5d                   	pop    %ebp
+  801196:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a1:	89 d1                	mov    %edx,%ecx
+  8011a3:	89 d3                	mov    %edx,%ebx
+  8011a5:	89 d7                	mov    %edx,%edi
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	8d 35 b2 11 80 00    	lea    0x8011b2,%esi
+  8011b0:	0f 34                	sysenter
+  8011b2:	5d                   	pop    %ebp
+		goto out;
+  8011b3:	eb dd                	jmp    801192 <sys_time_msec+0x23>
+
+008011b5 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	57                   	push   %edi
+  8011b9:	56                   	push   %esi
+  8011ba:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011bb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011c2:	74 1a                	je     8011de <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	89 cb                	mov    %ecx,%ebx
+  8011d3:	89 cf                	mov    %ecx,%edi
+  8011d5:	89 ce                	mov    %ecx,%esi
+  8011d7:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011d9:	5b                   	pop    %ebx
+  8011da:	5e                   	pop    %esi
+  8011db:	5f                   	pop    %edi
+  8011dc:	5d                   	pop    %ebp
+  8011dd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e6:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011eb:	89 cb                	mov    %ecx,%ebx
+  8011ed:	89 cf                	mov    %ecx,%edi
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	8d 35 fa 11 80 00    	lea    0x8011fa,%esi
+  8011f8:	0f 34                	sysenter
+  8011fa:	5d                   	pop    %ebp
+		goto out;
+  8011fb:	eb dc                	jmp    8011d9 <sys_sleep_until+0x24>
+
+008011fd <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	57                   	push   %edi
+  801201:	56                   	push   %esi
+  801202:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801203:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80120a:	74 1a                	je     801226 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80120c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801211:	b8 11 00 00 00       	mov    $0x11,%eax
+  801216:	8b 55 08             	mov    0x8(%ebp),%edx
+  801219:	89 cb                	mov    %ecx,%ebx
+  80121b:	89 cf                	mov    %ecx,%edi
+  80121d:	89 ce                	mov    %ecx,%esi
+  80121f:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801221:	5b                   	pop    %ebx
+  801222:	5e                   	pop    %esi
+  801223:	5f                   	pop    %edi
+  801224:	5d                   	pop    %ebp
+  801225:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801226:	8b 55 08             	mov    0x8(%ebp),%edx
+  801229:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80122e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801233:	89 cb                	mov    %ecx,%ebx
+  801235:	89 cf                	mov    %ecx,%edi
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	8d 35 42 12 80 00    	lea    0x801242,%esi
+  801240:	0f 34                	sysenter
+  801242:	5d                   	pop    %ebp
+		goto out;
+  801243:	eb dc                	jmp    801221 <sys_env_print_stats+0x24>
+
+00801245 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	57                   	push   %edi
+  801249:	56                   	push   %esi
+  80124a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80124b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801252:	74 1b                	je     80126f <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801259:	b8 19 00 00 00       	mov    $0x19,%eax
+  80125e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801261:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801264:	89 df                	mov    %ebx,%edi
+  801266:	89 de                	mov    %ebx,%esi
+  801268:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80126a:	5b                   	pop    %ebx
+  80126b:	5e                   	pop    %esi
+  80126c:	5f                   	pop    %edi
+  80126d:	5d                   	pop    %ebp
+  80126e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80126f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801274:	8b 55 08             	mov    0x8(%ebp),%edx
+  801277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80127f:	89 df                	mov    %ebx,%edi
+  801281:	55                   	push   %ebp
+  801282:	89 e5                	mov    %esp,%ebp
+  801284:	8d 35 8c 12 80 00    	lea    0x80128c,%esi
+  80128a:	0f 34                	sysenter
+  80128c:	5d                   	pop    %ebp
+		goto out;
+  80128d:	eb db                	jmp    80126a <sys_perf+0x25>
+
+0080128f <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	57                   	push   %edi
+  801293:	56                   	push   %esi
+  801294:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801295:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80129c:	74 19                	je     8012b7 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80129e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012a8:	89 d1                	mov    %edx,%ecx
+  8012aa:	89 d3                	mov    %edx,%ebx
+  8012ac:	89 d7                	mov    %edx,%edi
+  8012ae:	89 d6                	mov    %edx,%esi
+  8012b0:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012b2:	5b                   	pop    %ebx
+  8012b3:	5e                   	pop    %esi
+  8012b4:	5f                   	pop    %edi
+  8012b5:	5d                   	pop    %ebp
+  8012b6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012c1:	89 d1                	mov    %edx,%ecx
+  8012c3:	89 d3                	mov    %edx,%ebx
+  8012c5:	89 d7                	mov    %edx,%edi
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+  8012ca:	8d 35 d2 12 80 00    	lea    0x8012d2,%esi
+  8012d0:	0f 34                	sysenter
+  8012d2:	5d                   	pop    %ebp
+		goto out;
+  8012d3:	eb dd                	jmp    8012b2 <sys_fork+0x23>
+
+008012d5 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	57                   	push   %edi
+  8012d9:	56                   	push   %esi
+  8012da:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012db:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012e2:	74 1c                	je     801300 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8012e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8012ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f7:	89 f7                	mov    %esi,%edi
+  8012f9:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8012fb:	5b                   	pop    %ebx
+  8012fc:	5e                   	pop    %esi
+  8012fd:	5f                   	pop    %edi
+  8012fe:	5d                   	pop    %ebp
+  8012ff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801300:	8b 55 08             	mov    0x8(%ebp),%edx
+  801303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801306:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80130b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801310:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  801316:	8d 35 1e 13 80 00    	lea    0x80131e,%esi
+  80131c:	0f 34                	sysenter
+  80131e:	5d                   	pop    %ebp
+		goto out;
+  80131f:	eb da                	jmp    8012fb <sys_thread_create+0x26>
+
+00801321 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+  801324:	57                   	push   %edi
+  801325:	56                   	push   %esi
+  801326:	53                   	push   %ebx
+  801327:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80132a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801331:	74 24                	je     801357 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801333:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801338:	be 00 00 00 00       	mov    $0x0,%esi
+  80133d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801340:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801343:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801346:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801349:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80134b:	85 c0                	test   %eax,%eax
+  80134d:	7f 27                	jg     801376 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80134f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801352:	5b                   	pop    %ebx
+  801353:	5e                   	pop    %esi
+  801354:	5f                   	pop    %edi
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801357:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801365:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801368:	55                   	push   %ebp
+  801369:	89 e5                	mov    %esp,%ebp
+  80136b:	8d 35 73 13 80 00    	lea    0x801373,%esi
+  801371:	0f 34                	sysenter
+  801373:	5d                   	pop    %ebp
+		goto out;
+  801374:	eb d5                	jmp    80134b <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801376:	83 ec 0c             	sub    $0xc,%esp
+  801379:	50                   	push   %eax
+  80137a:	6a 1f                	push   $0x1f
+  80137c:	68 ab 2e 80 00       	push   $0x802eab
+  801381:	6a 3f                	push   $0x3f
+  801383:	68 c8 2e 80 00       	push   $0x802ec8
+  801388:	e8 6c ed ff ff       	call   8000f9 <_panic>
+
+0080138d <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	57                   	push   %edi
+  801391:	56                   	push   %esi
+  801392:	53                   	push   %ebx
+  801393:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801396:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80139d:	74 23                	je     8013c2 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80139f:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b2:	89 f7                	mov    %esi,%edi
+  8013b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013b6:	85 c0                	test   %eax,%eax
+  8013b8:	7f 29                	jg     8013e3 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bd:	5b                   	pop    %ebx
+  8013be:	5e                   	pop    %esi
+  8013bf:	5f                   	pop    %edi
+  8013c0:	5d                   	pop    %ebp
+  8013c1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d5:	55                   	push   %ebp
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	8d 35 e0 13 80 00    	lea    0x8013e0,%esi
+  8013de:	0f 34                	sysenter
+  8013e0:	5d                   	pop    %ebp
+		goto out;
+  8013e1:	eb d3                	jmp    8013b6 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+  8013e6:	50                   	push   %eax
+  8013e7:	6a 20                	push   $0x20
+  8013e9:	68 ab 2e 80 00       	push   $0x802eab
+  8013ee:	6a 3f                	push   $0x3f
+  8013f0:	68 c8 2e 80 00       	push   $0x802ec8
+  8013f5:	e8 ff ec ff ff       	call   8000f9 <_panic>
+
+008013fa <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8013fa:	55                   	push   %ebp
+  8013fb:	89 e5                	mov    %esp,%ebp
+  8013fd:	57                   	push   %edi
+  8013fe:	56                   	push   %esi
+  8013ff:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801400:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801407:	74 1b                	je     801424 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801409:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801413:	8b 55 08             	mov    0x8(%ebp),%edx
+  801416:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801419:	89 df                	mov    %ebx,%edi
+  80141b:	89 de                	mov    %ebx,%esi
+  80141d:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80141f:	5b                   	pop    %ebx
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801424:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801429:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801434:	89 df                	mov    %ebx,%edi
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+  801439:	8d 35 41 14 80 00    	lea    0x801441,%esi
+  80143f:	0f 34                	sysenter
+  801441:	5d                   	pop    %ebp
+		goto out;
+  801442:	eb db                	jmp    80141f <sys_batch+0x25>
+
+00801444 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801444:	55                   	push   %ebp
+  801445:	89 e5                	mov    %esp,%ebp
+  801447:	57                   	push   %edi
+  801448:	56                   	push   %esi
+  801449:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80144a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801451:	74 1a                	je     80146d <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801453:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801458:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80145d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801460:	89 cb                	mov    %ecx,%ebx
+  801462:	89 cf                	mov    %ecx,%edi
+  801464:	89 ce                	mov    %ecx,%esi
+  801466:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801468:	5b                   	pop    %ebx
+  801469:	5e                   	pop    %esi
+  80146a:	5f                   	pop    %edi
+  80146b:	5d                   	pop    %ebp
+  80146c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80146d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801470:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801475:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80147a:	89 cb                	mov    %ecx,%ebx
+  80147c:	89 cf                	mov    %ecx,%edi
+  80147e:	55                   	push   %ebp
+  80147f:	89 e5                	mov    %esp,%ebp
+  801481:	8d 35 89 14 80 00    	lea    0x801489,%esi
+  801487:	0f 34                	sysenter
+  801489:	5d                   	pop    %ebp
+		goto out;
+  80148a:	eb dc                	jmp    801468 <sys_trace_ctl+0x24>
+
+0080148c <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	57                   	push   %edi
+  801490:	56                   	push   %esi
+  801491:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801492:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801499:	74 1c                	je     8014b7 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80149b:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ae:	89 f7                	mov    %esi,%edi
+  8014b0:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014b2:	5b                   	pop    %ebx
+  8014b3:	5e                   	pop    %esi
+  8014b4:	5f                   	pop    %edi
+  8014b5:	5d                   	pop    %ebp
+  8014b6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014bd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	8d 35 d5 14 80 00    	lea    0x8014d5,%esi
+  8014d3:	0f 34                	sysenter
+  8014d5:	5d                   	pop    %ebp
+		goto out;
+  8014d6:	eb da                	jmp    8014b2 <sys_trace_read+0x26>
+
+008014d8 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014d8:	55                   	push   %ebp
+  8014d9:	89 e5                	mov    %esp,%ebp
+  8014db:	57                   	push   %edi
+  8014dc:	56                   	push   %esi
+  8014dd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014de:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e5:	74 1c                	je     801503 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8014e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ec:	b8 21 00 00 00       	mov    $0x21,%eax
+  8014f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fa:	89 f7                	mov    %esi,%edi
+  8014fc:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8014fe:	5b                   	pop    %ebx
+  8014ff:	5e                   	pop    %esi
+  801500:	5f                   	pop    %edi
+  801501:	5d                   	pop    %ebp
+  801502:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801503:	8b 55 08             	mov    0x8(%ebp),%edx
+  801506:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801509:	b8 21 00 00 00       	mov    $0x21,%eax
+  80150e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801513:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801516:	55                   	push   %ebp
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	8d 35 21 15 80 00    	lea    0x801521,%esi
+  80151f:	0f 34                	sysenter
+  801521:	5d                   	pop    %ebp
+		goto out;
+  801522:	eb da                	jmp    8014fe <sys_meminfo+0x26>
+
+00801524 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801524:	55                   	push   %ebp
+  801525:	89 e5                	mov    %esp,%ebp
+  801527:	57                   	push   %edi
+  801528:	56                   	push   %esi
+  801529:	53                   	push   %ebx
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80152d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801531:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801538:	74 1f                	je     801559 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80153a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153f:	b8 22 00 00 00       	mov    $0x22,%eax
+  801544:	8b 55 08             	mov    0x8(%ebp),%edx
+  801547:	89 df                	mov    %ebx,%edi
+  801549:	89 de                	mov    %ebx,%esi
+  80154b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	7f 25                	jg     801576 <sys_env_set_ksm+0x52>
+}
+  801551:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801554:	5b                   	pop    %ebx
+  801555:	5e                   	pop    %esi
+  801556:	5f                   	pop    %edi
+  801557:	5d                   	pop    %ebp
+  801558:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801561:	b8 22 00 00 00       	mov    $0x22,%eax
+  801566:	89 df                	mov    %ebx,%edi
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	8d 35 73 15 80 00    	lea    0x801573,%esi
+  801571:	0f 34                	sysenter
+  801573:	5d                   	pop    %ebp
+		goto out;
+  801574:	eb d7                	jmp    80154d <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801576:	83 ec 0c             	sub    $0xc,%esp
+  801579:	50                   	push   %eax
+  80157a:	6a 22                	push   $0x22
+  80157c:	68 ab 2e 80 00       	push   $0x802eab
+  801581:	6a 3f                	push   $0x3f
+  801583:	68 c8 2e 80 00       	push   $0x802ec8
+  801588:	e8 6c eb ff ff       	call   8000f9 <_panic>
+
+0080158d <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80158d:	55                   	push   %ebp
+  80158e:	89 e5                	mov    %esp,%ebp
+  801590:	57                   	push   %edi
+  801591:	56                   	push   %esi
+  801592:	53                   	push   %ebx
+  801593:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801596:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801599:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015a0:	74 24                	je     8015c6 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015ac:	89 cb                	mov    %ecx,%ebx
+  8015ae:	89 cf                	mov    %ecx,%edi
+  8015b0:	89 ce                	mov    %ecx,%esi
+  8015b2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015b4:	85 c0                	test   %eax,%eax
+  8015b6:	7f 2a                	jg     8015e2 <sys_time_nsec+0x55>
+	return ns;
+}
+  8015b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015bb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c1:	5b                   	pop    %ebx
+  8015c2:	5e                   	pop    %esi
+  8015c3:	5f                   	pop    %edi
+  8015c4:	5d                   	pop    %ebp
+  8015c5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015d0:	89 cb                	mov    %ecx,%ebx
+  8015d2:	89 cf                	mov    %ecx,%edi
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	8d 35 df 15 80 00    	lea    0x8015df,%esi
+  8015dd:	0f 34                	sysenter
+  8015df:	5d                   	pop    %ebp
+		goto out;
+  8015e0:	eb d2                	jmp    8015b4 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015e2:	83 ec 0c             	sub    $0xc,%esp
+  8015e5:	50                   	push   %eax
+  8015e6:	6a 0f                	push   $0xf
+  8015e8:	68 ab 2e 80 00       	push   $0x802eab
+  8015ed:	6a 3f                	push   $0x3f
+  8015ef:	68 c8 2e 80 00       	push   $0x802ec8
+  8015f4:	e8 00 eb ff ff       	call   8000f9 <_panic>
+
+008015f9 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8015f9:	55                   	push   %ebp
+  8015fa:	89 e5                	mov    %esp,%ebp
+  8015fc:	57                   	push   %edi
+  8015fd:	56                   	push   %esi
+  8015fe:	53                   	push   %ebx
+  8015ff:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801602:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801609:	74 22                	je     80162d <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80160b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801610:	b8 12 00 00 00       	mov    $0x12,%eax
+  801615:	8b 55 08             	mov    0x8(%ebp),%edx
+  801618:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161b:	89 df                	mov    %ebx,%edi
+  80161d:	89 de                	mov    %ebx,%esi
+  80161f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801621:	85 c0                	test   %eax,%eax
+  801623:	7f 28                	jg     80164d <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801625:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801628:	5b                   	pop    %ebx
+  801629:	5e                   	pop    %esi
+  80162a:	5f                   	pop    %edi
+  80162b:	5d                   	pop    %ebp
+  80162c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80162d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801632:	8b 55 08             	mov    0x8(%ebp),%edx
+  801635:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801638:	b8 12 00 00 00       	mov    $0x12,%eax
+  80163d:	89 df                	mov    %ebx,%edi
+  80163f:	55                   	push   %ebp
+  801640:	89 e5                	mov    %esp,%ebp
+  801642:	8d 35 4a 16 80 00    	lea    0x80164a,%esi
+  801648:	0f 34                	sysenter
+  80164a:	5d                   	pop    %ebp
+		goto out;
+  80164b:	eb d4                	jmp    801621 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80164d:	83 ec 0c             	sub    $0xc,%esp
+  801650:	50                   	push   %eax
+  801651:	6a 12                	push   $0x12
+  801653:	68 ab 2e 80 00       	push   $0x802eab
+  801658:	6a 3f                	push   $0x3f
+  80165a:	68 c8 2e 80 00       	push   $0x802ec8
+  80165f:	e8 95 ea ff ff       	call   8000f9 <_panic>
+
+00801664 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801664:	55                   	push   %ebp
+  801665:	89 e5                	mov    %esp,%ebp
+  801667:	57                   	push   %edi
+  801668:	56                   	push   %esi
+  801669:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80166a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801671:	74 1b                	je     80168e <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801673:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801678:	b8 13 00 00 00       	mov    $0x13,%eax
+  80167d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801680:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801683:	89 df                	mov    %ebx,%edi
+  801685:	89 de                	mov    %ebx,%esi
+  801687:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801689:	5b                   	pop    %ebx
+  80168a:	5e                   	pop    %esi
+  80168b:	5f                   	pop    %edi
+  80168c:	5d                   	pop    %ebp
+  80168d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80168e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801693:	8b 55 08             	mov    0x8(%ebp),%edx
+  801696:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801699:	b8 13 00 00 00       	mov    $0x13,%eax
+  80169e:	89 df                	mov    %ebx,%edi
+  8016a0:	55                   	push   %ebp
+  8016a1:	89 e5                	mov    %esp,%ebp
+  8016a3:	8d 35 ab 16 80 00    	lea    0x8016ab,%esi
+  8016a9:	0f 34                	sysenter
+  8016ab:	5d                   	pop    %ebp
+		goto out;
+  8016ac:	eb db                	jmp    801689 <sys_e1000_receive+0x25>
+
+008016ae <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016ae:	55                   	push   %ebp
+  8016af:	89 e5                	mov    %esp,%ebp
+  8016b1:	57                   	push   %edi
+  8016b2:	56                   	push   %esi
+  8016b3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016b4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016bb:	74 1b                	je     8016d8 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016cd:	89 df                	mov    %ebx,%edi
+  8016cf:	89 de                	mov    %ebx,%esi
+  8016d1:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016d3:	5b                   	pop    %ebx
+  8016d4:	5e                   	pop    %esi
+  8016d5:	5f                   	pop    %edi
+  8016d6:	5d                   	pop    %ebp
+  8016d7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016e8:	89 df                	mov    %ebx,%edi
+  8016ea:	55                   	push   %ebp
+  8016eb:	89 e5                	mov    %esp,%ebp
+  8016ed:	8d 35 f5 16 80 00    	lea    0x8016f5,%esi
+  8016f3:	0f 34                	sysenter
+  8016f5:	5d                   	pop    %ebp
+		goto out;
+  8016f6:	eb db                	jmp    8016d3 <sys_e1000_read_hwaddr+0x25>
+
+008016f8 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8016f8:	55                   	push   %ebp
+  8016f9:	89 e5                	mov    %esp,%ebp
+  8016fb:	57                   	push   %edi
+  8016fc:	56                   	push   %esi
+  8016fd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016fe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801705:	74 1a                	je     801721 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80170c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801711:	8b 55 08             	mov    0x8(%ebp),%edx
+  801714:	89 cb                	mov    %ecx,%ebx
+  801716:	89 cf                	mov    %ecx,%edi
+  801718:	89 ce                	mov    %ecx,%esi
+  80171a:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80171c:	5b                   	pop    %ebx
+  80171d:	5e                   	pop    %esi
+  80171e:	5f                   	pop    %edi
+  80171f:	5d                   	pop    %ebp
+  801720:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801721:	8b 55 08             	mov    0x8(%ebp),%edx
+  801724:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801729:	b8 15 00 00 00       	mov    $0x15,%eax
+  80172e:	89 cb                	mov    %ecx,%ebx
+  801730:	89 cf                	mov    %ecx,%edi
+  801732:	55                   	push   %ebp
+  801733:	89 e5                	mov    %esp,%ebp
+  801735:	8d 35 3d 17 80 00    	lea    0x80173d,%esi
+  80173b:	0f 34                	sysenter
+  80173d:	5d                   	pop    %ebp
+		goto out;
+  80173e:	eb dc                	jmp    80171c <sys_sb16_read_version+0x24>
+
+00801740 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801740:	55                   	push   %ebp
+  801741:	89 e5                	mov    %esp,%ebp
+  801743:	57                   	push   %edi
+  801744:	56                   	push   %esi
+  801745:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801746:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80174d:	74 1b                	je     80176a <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80174f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801754:	b8 16 00 00 00       	mov    $0x16,%eax
+  801759:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175f:	89 df                	mov    %ebx,%edi
+  801761:	89 de                	mov    %ebx,%esi
+  801763:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801765:	5b                   	pop    %ebx
+  801766:	5e                   	pop    %esi
+  801767:	5f                   	pop    %edi
+  801768:	5d                   	pop    %ebp
+  801769:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80176a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801772:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801775:	b8 16 00 00 00       	mov    $0x16,%eax
+  80177a:	89 df                	mov    %ebx,%edi
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	8d 35 87 17 80 00    	lea    0x801787,%esi
+  801785:	0f 34                	sysenter
+  801787:	5d                   	pop    %ebp
+		goto out;
+  801788:	eb db                	jmp    801765 <sys_sb16_play+0x25>
+
+0080178a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80178d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801790:	05 00 00 00 30       	add    $0x30000000,%eax
+  801795:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801798:	5d                   	pop    %ebp
+  801799:	c3                   	ret
+
+0080179a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80179d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017a5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017aa:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017af:	5d                   	pop    %ebp
+  8017b0:	c3                   	ret
+
+008017b1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017b4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017b9:	eb 02                	jmp    8017bd <fd_alloc+0xc>
+  8017bb:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017bd:	89 c2                	mov    %eax,%edx
+  8017bf:	c1 ea 16             	shr    $0x16,%edx
+  8017c2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017c9:	f6 c2 01             	test   $0x1,%dl
+  8017cc:	74 2b                	je     8017f9 <fd_alloc+0x48>
+  8017ce:	89 c2                	mov    %eax,%edx
+  8017d0:	c1 ea 0c             	shr    $0xc,%edx
+  8017d3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017da:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017e0:	f6 c1 01             	test   $0x1,%cl
+  8017e3:	74 14                	je     8017f9 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017e5:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017eb:	75 ce                	jne    8017bb <fd_alloc+0xa>
+  8017ed:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8017f2:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8017f7:	eb 05                	jmp    8017fe <fd_alloc+0x4d>
+			return 0;
+  8017f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8017fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801801:	89 02                	mov    %eax,(%edx)
+}
+  801803:	89 c8                	mov    %ecx,%eax
+  801805:	5d                   	pop    %ebp
+  801806:	c3                   	ret
+
+00801807 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801807:	55                   	push   %ebp
+  801808:	89 e5                	mov    %esp,%ebp
+  80180a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80180d:	83 f8 1f             	cmp    $0x1f,%eax
+  801810:	77 30                	ja     801842 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801812:	c1 e0 0c             	shl    $0xc,%eax
+  801815:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80181a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801820:	f6 c2 01             	test   $0x1,%dl
+  801823:	74 24                	je     801849 <fd_lookup+0x42>
+  801825:	89 c2                	mov    %eax,%edx
+  801827:	c1 ea 0c             	shr    $0xc,%edx
+  80182a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801831:	f6 c2 01             	test   $0x1,%dl
+  801834:	74 1a                	je     801850 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801836:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801839:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80183b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801840:	5d                   	pop    %ebp
+  801841:	c3                   	ret
+		return -E_INVAL;
+  801842:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801847:	eb f7                	jmp    801840 <fd_lookup+0x39>
+		return -E_INVAL;
+  801849:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184e:	eb f0                	jmp    801840 <fd_lookup+0x39>
+  801850:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801855:	eb e9                	jmp    801840 <fd_lookup+0x39>
+
+00801857 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	53                   	push   %ebx
+  80185b:	83 ec 04             	sub    $0x4,%esp
+  80185e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801861:	b8 00 00 00 00       	mov    $0x0,%eax
+  801866:	eb 03                	jmp    80186b <dev_lookup+0x14>
+  801868:	83 c0 01             	add    $0x1,%eax
+  80186b:	8b 1c 85 54 2f 80 00 	mov    0x802f54(,%eax,4),%ebx
+  801872:	85 db                	test   %ebx,%ebx
+  801874:	74 0b                	je     801881 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801876:	39 13                	cmp    %edx,(%ebx)
+  801878:	75 ee                	jne    801868 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80187a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187f:	eb 2e                	jmp    8018af <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801881:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801883:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801888:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80188e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801893:	76 24                	jbe    8018b9 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801895:	8b 41 48             	mov    0x48(%ecx),%eax
+  801898:	83 ec 04             	sub    $0x4,%esp
+  80189b:	52                   	push   %edx
+  80189c:	50                   	push   %eax
+  80189d:	68 d8 2e 80 00       	push   $0x802ed8
+  8018a2:	e8 2d e9 ff ff       	call   8001d4 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018a7:	83 c4 10             	add    $0x10,%esp
+  8018aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018b2:	89 1a                	mov    %ebx,(%edx)
+}
+  8018b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b7:	c9                   	leave
+  8018b8:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018b9:	c1 e8 10             	shr    $0x10,%eax
+  8018bc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018c2:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018c8:	eb cb                	jmp    801895 <dev_lookup+0x3e>
+
+008018ca <fd_close>:
+{
+  8018ca:	55                   	push   %ebp
+  8018cb:	89 e5                	mov    %esp,%ebp
+  8018cd:	57                   	push   %edi
+  8018ce:	56                   	push   %esi
+  8018cf:	53                   	push   %ebx
+  8018d0:	83 ec 24             	sub    $0x24,%esp
+  8018d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018d6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018d9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018dc:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018dd:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018e3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018e6:	50                   	push   %eax
+  8018e7:	e8 1b ff ff ff       	call   801807 <fd_lookup>
+  8018ec:	89 c3                	mov    %eax,%ebx
+  8018ee:	83 c4 10             	add    $0x10,%esp
+  8018f1:	85 c0                	test   %eax,%eax
+  8018f3:	78 05                	js     8018fa <fd_close+0x30>
+	    || fd != fd2)
+  8018f5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018f8:	74 16                	je     801910 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8018fa:	89 f8                	mov    %edi,%eax
+  8018fc:	84 c0                	test   %al,%al
+  8018fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801903:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801906:	89 d8                	mov    %ebx,%eax
+  801908:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190b:	5b                   	pop    %ebx
+  80190c:	5e                   	pop    %esi
+  80190d:	5f                   	pop    %edi
+  80190e:	5d                   	pop    %ebp
+  80190f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801910:	83 ec 08             	sub    $0x8,%esp
+  801913:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801916:	50                   	push   %eax
+  801917:	ff 36                	push   (%esi)
+  801919:	e8 39 ff ff ff       	call   801857 <dev_lookup>
+  80191e:	89 c3                	mov    %eax,%ebx
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 1a                	js     801941 <fd_close+0x77>
+		if (dev->dev_close)
+  801927:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80192a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80192d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801932:	85 c0                	test   %eax,%eax
+  801934:	74 0b                	je     801941 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801936:	83 ec 0c             	sub    $0xc,%esp
+  801939:	56                   	push   %esi
+  80193a:	ff d0                	call   *%eax
+  80193c:	89 c3                	mov    %eax,%ebx
+  80193e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801941:	83 ec 08             	sub    $0x8,%esp
+  801944:	56                   	push   %esi
+  801945:	6a 00                	push   $0x0
+  801947:	e8 a3 f4 ff ff       	call   800def <sys_page_unmap>
+	return r;
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	eb b5                	jmp    801906 <fd_close+0x3c>
+
+00801951 <close>:
+
+int
+close(int fdnum)
+{
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801957:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80195a:	50                   	push   %eax
+  80195b:	ff 75 08             	push   0x8(%ebp)
+  80195e:	e8 a4 fe ff ff       	call   801807 <fd_lookup>
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	85 c0                	test   %eax,%eax
+  801968:	79 02                	jns    80196c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80196a:	c9                   	leave
+  80196b:	c3                   	ret
+		return fd_close(fd, 1);
+  80196c:	83 ec 08             	sub    $0x8,%esp
+  80196f:	6a 01                	push   $0x1
+  801971:	ff 75 f4             	push   -0xc(%ebp)
+  801974:	e8 51 ff ff ff       	call   8018ca <fd_close>
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	eb ec                	jmp    80196a <close+0x19>
+
+0080197e <close_all>:
+
+void
+close_all(void)
+{
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	53                   	push   %ebx
+  801982:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801985:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80198a:	83 ec 0c             	sub    $0xc,%esp
+  80198d:	53                   	push   %ebx
+  80198e:	e8 be ff ff ff       	call   801951 <close>
+	for (i = 0; i < MAXFD; i++)
+  801993:	83 c3 01             	add    $0x1,%ebx
+  801996:	83 c4 10             	add    $0x10,%esp
+  801999:	83 fb 20             	cmp    $0x20,%ebx
+  80199c:	75 ec                	jne    80198a <close_all+0xc>
+}
+  80199e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a1:	c9                   	leave
+  8019a2:	c3                   	ret
+
+008019a3 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	57                   	push   %edi
+  8019a7:	56                   	push   %esi
+  8019a8:	53                   	push   %ebx
+  8019a9:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019ac:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019af:	50                   	push   %eax
+  8019b0:	ff 75 08             	push   0x8(%ebp)
+  8019b3:	e8 4f fe ff ff       	call   801807 <fd_lookup>
+  8019b8:	89 c3                	mov    %eax,%ebx
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	78 7f                	js     801a40 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019c1:	83 ec 0c             	sub    $0xc,%esp
+  8019c4:	ff 75 0c             	push   0xc(%ebp)
+  8019c7:	e8 85 ff ff ff       	call   801951 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019cf:	c1 e6 0c             	shl    $0xc,%esi
+  8019d2:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019d8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019db:	89 3c 24             	mov    %edi,(%esp)
+  8019de:	e8 b7 fd ff ff       	call   80179a <fd2data>
+  8019e3:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019e5:	89 34 24             	mov    %esi,(%esp)
+  8019e8:	e8 ad fd ff ff       	call   80179a <fd2data>
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8019f3:	89 d8                	mov    %ebx,%eax
+  8019f5:	c1 e8 16             	shr    $0x16,%eax
+  8019f8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019ff:	a8 01                	test   $0x1,%al
+  801a01:	74 11                	je     801a14 <dup+0x71>
+  801a03:	89 d8                	mov    %ebx,%eax
+  801a05:	c1 e8 0c             	shr    $0xc,%eax
+  801a08:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a0f:	f6 c2 01             	test   $0x1,%dl
+  801a12:	75 36                	jne    801a4a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a14:	89 f8                	mov    %edi,%eax
+  801a16:	c1 e8 0c             	shr    $0xc,%eax
+  801a19:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a20:	83 ec 0c             	sub    $0xc,%esp
+  801a23:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a28:	50                   	push   %eax
+  801a29:	56                   	push   %esi
+  801a2a:	6a 00                	push   $0x0
+  801a2c:	57                   	push   %edi
+  801a2d:	6a 00                	push   $0x0
+  801a2f:	e8 4d f3 ff ff       	call   800d81 <sys_page_map>
+  801a34:	89 c3                	mov    %eax,%ebx
+  801a36:	83 c4 20             	add    $0x20,%esp
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	78 33                	js     801a70 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a3d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a40:	89 d8                	mov    %ebx,%eax
+  801a42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a45:	5b                   	pop    %ebx
+  801a46:	5e                   	pop    %esi
+  801a47:	5f                   	pop    %edi
+  801a48:	5d                   	pop    %ebp
+  801a49:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a4a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a51:	83 ec 0c             	sub    $0xc,%esp
+  801a54:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a59:	50                   	push   %eax
+  801a5a:	ff 75 d4             	push   -0x2c(%ebp)
+  801a5d:	6a 00                	push   $0x0
+  801a5f:	53                   	push   %ebx
+  801a60:	6a 00                	push   $0x0
+  801a62:	e8 1a f3 ff ff       	call   800d81 <sys_page_map>
+  801a67:	89 c3                	mov    %eax,%ebx
+  801a69:	83 c4 20             	add    $0x20,%esp
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	79 a4                	jns    801a14 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a70:	83 ec 08             	sub    $0x8,%esp
+  801a73:	56                   	push   %esi
+  801a74:	6a 00                	push   $0x0
+  801a76:	e8 74 f3 ff ff       	call   800def <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a7b:	83 c4 08             	add    $0x8,%esp
+  801a7e:	ff 75 d4             	push   -0x2c(%ebp)
+  801a81:	6a 00                	push   $0x0
+  801a83:	e8 67 f3 ff ff       	call   800def <sys_page_unmap>
+	return r;
+  801a88:	83 c4 10             	add    $0x10,%esp
+  801a8b:	eb b3                	jmp    801a40 <dup+0x9d>
+
+00801a8d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	56                   	push   %esi
+  801a91:	53                   	push   %ebx
+  801a92:	83 ec 18             	sub    $0x18,%esp
+  801a95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a98:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a9b:	50                   	push   %eax
+  801a9c:	53                   	push   %ebx
+  801a9d:	e8 65 fd ff ff       	call   801807 <fd_lookup>
+  801aa2:	83 c4 10             	add    $0x10,%esp
+  801aa5:	85 c0                	test   %eax,%eax
+  801aa7:	78 3c                	js     801ae5 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aa9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aac:	83 ec 08             	sub    $0x8,%esp
+  801aaf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab2:	50                   	push   %eax
+  801ab3:	ff 36                	push   (%esi)
+  801ab5:	e8 9d fd ff ff       	call   801857 <dev_lookup>
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	78 24                	js     801ae5 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ac1:	8b 46 08             	mov    0x8(%esi),%eax
+  801ac4:	83 e0 03             	and    $0x3,%eax
+  801ac7:	83 f8 01             	cmp    $0x1,%eax
+  801aca:	74 20                	je     801aec <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801acf:	8b 40 08             	mov    0x8(%eax),%eax
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	74 57                	je     801b2d <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ad6:	83 ec 04             	sub    $0x4,%esp
+  801ad9:	ff 75 10             	push   0x10(%ebp)
+  801adc:	ff 75 0c             	push   0xc(%ebp)
+  801adf:	56                   	push   %esi
+  801ae0:	ff d0                	call   *%eax
+  801ae2:	83 c4 10             	add    $0x10,%esp
+}
+  801ae5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae8:	5b                   	pop    %ebx
+  801ae9:	5e                   	pop    %esi
+  801aea:	5d                   	pop    %ebp
+  801aeb:	c3                   	ret
+  801aec:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801aee:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801af3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801af9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801afe:	76 1c                	jbe    801b1c <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b00:	8b 42 48             	mov    0x48(%edx),%eax
+  801b03:	83 ec 04             	sub    $0x4,%esp
+  801b06:	53                   	push   %ebx
+  801b07:	50                   	push   %eax
+  801b08:	68 19 2f 80 00       	push   $0x802f19
+  801b0d:	e8 c2 e6 ff ff       	call   8001d4 <cprintf>
+		return -E_INVAL;
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b1a:	eb c9                	jmp    801ae5 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b1c:	c1 e8 10             	shr    $0x10,%eax
+  801b1f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b25:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b2b:	eb d3                	jmp    801b00 <read+0x73>
+		return -E_NOT_SUPP;
+  801b2d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b32:	eb b1                	jmp    801ae5 <read+0x58>
+
+00801b34 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b34:	55                   	push   %ebp
+  801b35:	89 e5                	mov    %esp,%ebp
+  801b37:	57                   	push   %edi
+  801b38:	56                   	push   %esi
+  801b39:	53                   	push   %ebx
+  801b3a:	83 ec 0c             	sub    $0xc,%esp
+  801b3d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b40:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b48:	eb 02                	jmp    801b4c <readn+0x18>
+  801b4a:	01 c3                	add    %eax,%ebx
+  801b4c:	39 f3                	cmp    %esi,%ebx
+  801b4e:	73 21                	jae    801b71 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b50:	83 ec 04             	sub    $0x4,%esp
+  801b53:	89 f0                	mov    %esi,%eax
+  801b55:	29 d8                	sub    %ebx,%eax
+  801b57:	50                   	push   %eax
+  801b58:	89 d8                	mov    %ebx,%eax
+  801b5a:	03 45 0c             	add    0xc(%ebp),%eax
+  801b5d:	50                   	push   %eax
+  801b5e:	57                   	push   %edi
+  801b5f:	e8 29 ff ff ff       	call   801a8d <read>
+		if (m < 0)
+  801b64:	83 c4 10             	add    $0x10,%esp
+  801b67:	85 c0                	test   %eax,%eax
+  801b69:	78 04                	js     801b6f <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b6b:	75 dd                	jne    801b4a <readn+0x16>
+  801b6d:	eb 02                	jmp    801b71 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b6f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b71:	89 d8                	mov    %ebx,%eax
+  801b73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b76:	5b                   	pop    %ebx
+  801b77:	5e                   	pop    %esi
+  801b78:	5f                   	pop    %edi
+  801b79:	5d                   	pop    %ebp
+  801b7a:	c3                   	ret
+
+00801b7b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	56                   	push   %esi
+  801b7f:	53                   	push   %ebx
+  801b80:	83 ec 18             	sub    $0x18,%esp
+  801b83:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b86:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b89:	50                   	push   %eax
+  801b8a:	53                   	push   %ebx
+  801b8b:	e8 77 fc ff ff       	call   801807 <fd_lookup>
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	78 37                	js     801bce <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b97:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b9a:	83 ec 08             	sub    $0x8,%esp
+  801b9d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba0:	50                   	push   %eax
+  801ba1:	ff 36                	push   (%esi)
+  801ba3:	e8 af fc ff ff       	call   801857 <dev_lookup>
+  801ba8:	83 c4 10             	add    $0x10,%esp
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	78 1f                	js     801bce <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801baf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bb3:	74 20                	je     801bd5 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bb8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	74 57                	je     801c16 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bbf:	83 ec 04             	sub    $0x4,%esp
+  801bc2:	ff 75 10             	push   0x10(%ebp)
+  801bc5:	ff 75 0c             	push   0xc(%ebp)
+  801bc8:	56                   	push   %esi
+  801bc9:	ff d0                	call   *%eax
+  801bcb:	83 c4 10             	add    $0x10,%esp
+}
+  801bce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd1:	5b                   	pop    %ebx
+  801bd2:	5e                   	pop    %esi
+  801bd3:	5d                   	pop    %ebp
+  801bd4:	c3                   	ret
+  801bd5:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bd7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bdc:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801be2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801be7:	76 1c                	jbe    801c05 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801be9:	8b 42 48             	mov    0x48(%edx),%eax
+  801bec:	83 ec 04             	sub    $0x4,%esp
+  801bef:	53                   	push   %ebx
+  801bf0:	50                   	push   %eax
+  801bf1:	68 35 2f 80 00       	push   $0x802f35
+  801bf6:	e8 d9 e5 ff ff       	call   8001d4 <cprintf>
+		return -E_INVAL;
+  801bfb:	83 c4 10             	add    $0x10,%esp
+  801bfe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c03:	eb c9                	jmp    801bce <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c05:	c1 e8 10             	shr    $0x10,%eax
+  801c08:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c0e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c14:	eb d3                	jmp    801be9 <write+0x6e>
+		return -E_NOT_SUPP;
+  801c16:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c1b:	eb b1                	jmp    801bce <write+0x53>
+
+00801c1d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c1d:	55                   	push   %ebp
+  801c1e:	89 e5                	mov    %esp,%ebp
+  801c20:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c26:	50                   	push   %eax
+  801c27:	ff 75 08             	push   0x8(%ebp)
+  801c2a:	e8 d8 fb ff ff       	call   801807 <fd_lookup>
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	78 0e                	js     801c44 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c3c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c44:	c9                   	leave
+  801c45:	c3                   	ret
+
+00801c46 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c46:	55                   	push   %ebp
+  801c47:	89 e5                	mov    %esp,%ebp
+  801c49:	56                   	push   %esi
+  801c4a:	53                   	push   %ebx
+  801c4b:	83 ec 18             	sub    $0x18,%esp
+  801c4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c51:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c54:	50                   	push   %eax
+  801c55:	53                   	push   %ebx
+  801c56:	e8 ac fb ff ff       	call   801807 <fd_lookup>
+  801c5b:	83 c4 10             	add    $0x10,%esp
+  801c5e:	85 c0                	test   %eax,%eax
+  801c60:	78 34                	js     801c96 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c62:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c65:	83 ec 08             	sub    $0x8,%esp
+  801c68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6b:	50                   	push   %eax
+  801c6c:	ff 36                	push   (%esi)
+  801c6e:	e8 e4 fb ff ff       	call   801857 <dev_lookup>
+  801c73:	83 c4 10             	add    $0x10,%esp
+  801c76:	85 c0                	test   %eax,%eax
+  801c78:	78 1c                	js     801c96 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c7a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c7e:	74 1d                	je     801c9d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c83:	8b 40 18             	mov    0x18(%eax),%eax
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	74 54                	je     801cde <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c8a:	83 ec 08             	sub    $0x8,%esp
+  801c8d:	ff 75 0c             	push   0xc(%ebp)
+  801c90:	56                   	push   %esi
+  801c91:	ff d0                	call   *%eax
+  801c93:	83 c4 10             	add    $0x10,%esp
+}
+  801c96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c99:	5b                   	pop    %ebx
+  801c9a:	5e                   	pop    %esi
+  801c9b:	5d                   	pop    %ebp
+  801c9c:	c3                   	ret
+  801c9d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c9f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ca4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801caa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801caf:	76 1c                	jbe    801ccd <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cb1:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cb4:	83 ec 04             	sub    $0x4,%esp
+  801cb7:	53                   	push   %ebx
+  801cb8:	50                   	push   %eax
+  801cb9:	68 f8 2e 80 00       	push   $0x802ef8
+  801cbe:	e8 11 e5 ff ff       	call   8001d4 <cprintf>
+		return -E_INVAL;
+  801cc3:	83 c4 10             	add    $0x10,%esp
+  801cc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ccb:	eb c9                	jmp    801c96 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ccd:	c1 e8 10             	shr    $0x10,%eax
+  801cd0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cd6:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cdc:	eb d3                	jmp    801cb1 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801cde:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce3:	eb b1                	jmp    801c96 <ftruncate+0x50>
+
+00801ce5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ce5:	55                   	push   %ebp
+  801ce6:	89 e5                	mov    %esp,%ebp
+  801ce8:	56                   	push   %esi
+  801ce9:	53                   	push   %ebx
+  801cea:	83 ec 18             	sub    $0x18,%esp
+  801ced:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cf0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cf3:	50                   	push   %eax
+  801cf4:	ff 75 08             	push   0x8(%ebp)
+  801cf7:	e8 0b fb ff ff       	call   801807 <fd_lookup>
+  801cfc:	83 c4 10             	add    $0x10,%esp
+  801cff:	85 c0                	test   %eax,%eax
+  801d01:	78 49                	js     801d4c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d03:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d06:	83 ec 08             	sub    $0x8,%esp
+  801d09:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d0c:	50                   	push   %eax
+  801d0d:	ff 36                	push   (%esi)
+  801d0f:	e8 43 fb ff ff       	call   801857 <dev_lookup>
+  801d14:	83 c4 10             	add    $0x10,%esp
+  801d17:	85 c0                	test   %eax,%eax
+  801d19:	78 31                	js     801d4c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d22:	74 2f                	je     801d53 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d24:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d27:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d2e:	00 00 00 
+	stat->st_isdir = 0;
+  801d31:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d38:	00 00 00 
+	stat->st_dev = dev;
+  801d3b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d41:	83 ec 08             	sub    $0x8,%esp
+  801d44:	53                   	push   %ebx
+  801d45:	56                   	push   %esi
+  801d46:	ff 50 14             	call   *0x14(%eax)
+  801d49:	83 c4 10             	add    $0x10,%esp
+}
+  801d4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d4f:	5b                   	pop    %ebx
+  801d50:	5e                   	pop    %esi
+  801d51:	5d                   	pop    %ebp
+  801d52:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d53:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d58:	eb f2                	jmp    801d4c <fstat+0x67>
+
+00801d5a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d5a:	55                   	push   %ebp
+  801d5b:	89 e5                	mov    %esp,%ebp
+  801d5d:	56                   	push   %esi
+  801d5e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d5f:	83 ec 08             	sub    $0x8,%esp
+  801d62:	6a 00                	push   $0x0
+  801d64:	ff 75 08             	push   0x8(%ebp)
+  801d67:	e8 e4 01 00 00       	call   801f50 <open>
+  801d6c:	89 c3                	mov    %eax,%ebx
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 1b                	js     801d90 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d75:	83 ec 08             	sub    $0x8,%esp
+  801d78:	ff 75 0c             	push   0xc(%ebp)
+  801d7b:	50                   	push   %eax
+  801d7c:	e8 64 ff ff ff       	call   801ce5 <fstat>
+  801d81:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d83:	89 1c 24             	mov    %ebx,(%esp)
+  801d86:	e8 c6 fb ff ff       	call   801951 <close>
+	return r;
+  801d8b:	83 c4 10             	add    $0x10,%esp
+  801d8e:	89 f3                	mov    %esi,%ebx
+}
+  801d90:	89 d8                	mov    %ebx,%eax
+  801d92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d95:	5b                   	pop    %ebx
+  801d96:	5e                   	pop    %esi
+  801d97:	5d                   	pop    %ebp
+  801d98:	c3                   	ret
+
+00801d99 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	56                   	push   %esi
+  801d9d:	53                   	push   %ebx
+  801d9e:	89 c6                	mov    %eax,%esi
+  801da0:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801da2:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801da9:	74 27                	je     801dd2 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dab:	6a 07                	push   $0x7
+  801dad:	68 00 60 80 00       	push   $0x806000
+  801db2:	56                   	push   %esi
+  801db3:	ff 35 00 50 80 00    	push   0x805000
+  801db9:	e8 b2 0c 00 00       	call   802a70 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801dbe:	83 c4 0c             	add    $0xc,%esp
+  801dc1:	6a 00                	push   $0x0
+  801dc3:	53                   	push   %ebx
+  801dc4:	6a 00                	push   $0x0
+  801dc6:	e8 8d 0c 00 00       	call   802a58 <ipc_recv>
+}
+  801dcb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dce:	5b                   	pop    %ebx
+  801dcf:	5e                   	pop    %esi
+  801dd0:	5d                   	pop    %ebp
+  801dd1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dd2:	83 ec 0c             	sub    $0xc,%esp
+  801dd5:	6a 01                	push   $0x1
+  801dd7:	e8 e8 0c 00 00       	call   802ac4 <ipc_find_env>
+  801ddc:	a3 00 50 80 00       	mov    %eax,0x805000
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	eb c5                	jmp    801dab <fsipc+0x12>
+
+00801de6 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801de6:	55                   	push   %ebp
+  801de7:	89 e5                	mov    %esp,%ebp
+  801de9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dec:	8b 45 08             	mov    0x8(%ebp),%eax
+  801def:	8b 40 0c             	mov    0xc(%eax),%eax
+  801df2:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801df7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dfa:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801dff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e04:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e09:	e8 8b ff ff ff       	call   801d99 <fsipc>
+}
+  801e0e:	c9                   	leave
+  801e0f:	c3                   	ret
+
+00801e10 <devfile_flush>:
+{
+  801e10:	55                   	push   %ebp
+  801e11:	89 e5                	mov    %esp,%ebp
+  801e13:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e19:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e1c:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e26:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e2b:	e8 69 ff ff ff       	call   801d99 <fsipc>
+}
+  801e30:	c9                   	leave
+  801e31:	c3                   	ret
+
+00801e32 <devfile_stat>:
+{
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	53                   	push   %ebx
+  801e36:	83 ec 04             	sub    $0x4,%esp
+  801e39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e42:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e51:	e8 43 ff ff ff       	call   801d99 <fsipc>
+  801e56:	85 c0                	test   %eax,%eax
+  801e58:	78 2c                	js     801e86 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e5a:	83 ec 08             	sub    $0x8,%esp
+  801e5d:	68 00 60 80 00       	push   $0x806000
+  801e62:	53                   	push   %ebx
+  801e63:	e8 b4 e9 ff ff       	call   80081c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e68:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e6d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e73:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e78:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e7e:	83 c4 10             	add    $0x10,%esp
+  801e81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e89:	c9                   	leave
+  801e8a:	c3                   	ret
+
+00801e8b <devfile_write>:
+{
+  801e8b:	55                   	push   %ebp
+  801e8c:	89 e5                	mov    %esp,%ebp
+  801e8e:	83 ec 0c             	sub    $0xc,%esp
+  801e91:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e97:	8b 52 0c             	mov    0xc(%edx),%edx
+  801e9a:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801ea0:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801ea5:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801eaa:	39 d0                	cmp    %edx,%eax
+  801eac:	0f 47 c2             	cmova  %edx,%eax
+  801eaf:	50                   	push   %eax
+  801eb0:	ff 75 0c             	push   0xc(%ebp)
+  801eb3:	68 08 60 80 00       	push   $0x806008
+  801eb8:	e8 e5 ea ff ff       	call   8009a2 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801ebd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ec7:	e8 cd fe ff ff       	call   801d99 <fsipc>
+}
+  801ecc:	c9                   	leave
+  801ecd:	c3                   	ret
+
+00801ece <devfile_read>:
+{
+  801ece:	55                   	push   %ebp
+  801ecf:	89 e5                	mov    %esp,%ebp
+  801ed1:	56                   	push   %esi
+  801ed2:	53                   	push   %ebx
+  801ed3:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ed6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ed9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801edc:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ee1:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ee7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eec:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ef1:	e8 a3 fe ff ff       	call   801d99 <fsipc>
+  801ef6:	89 c3                	mov    %eax,%ebx
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	78 1f                	js     801f1b <devfile_read+0x4d>
+	assert(r <= n);
+  801efc:	39 c6                	cmp    %eax,%esi
+  801efe:	72 24                	jb     801f24 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f00:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f05:	7f 33                	jg     801f3a <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f07:	83 ec 04             	sub    $0x4,%esp
+  801f0a:	50                   	push   %eax
+  801f0b:	68 00 60 80 00       	push   $0x806000
+  801f10:	ff 75 0c             	push   0xc(%ebp)
+  801f13:	e8 8a ea ff ff       	call   8009a2 <memmove>
+	return r;
+  801f18:	83 c4 10             	add    $0x10,%esp
+}
+  801f1b:	89 d8                	mov    %ebx,%eax
+  801f1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f20:	5b                   	pop    %ebx
+  801f21:	5e                   	pop    %esi
+  801f22:	5d                   	pop    %ebp
+  801f23:	c3                   	ret
+	assert(r <= n);
+  801f24:	68 68 2f 80 00       	push   $0x802f68
+  801f29:	68 6f 2f 80 00       	push   $0x802f6f
+  801f2e:	6a 76                	push   $0x76
+  801f30:	68 84 2f 80 00       	push   $0x802f84
+  801f35:	e8 bf e1 ff ff       	call   8000f9 <_panic>
+	assert(r <= PGSIZE);
+  801f3a:	68 8f 2f 80 00       	push   $0x802f8f
+  801f3f:	68 6f 2f 80 00       	push   $0x802f6f
+  801f44:	6a 77                	push   $0x77
+  801f46:	68 84 2f 80 00       	push   $0x802f84
+  801f4b:	e8 a9 e1 ff ff       	call   8000f9 <_panic>
+
+00801f50 <open>:
+{
+  801f50:	55                   	push   %ebp
+  801f51:	89 e5                	mov    %esp,%ebp
+  801f53:	56                   	push   %esi
+  801f54:	53                   	push   %ebx
+  801f55:	83 ec 1c             	sub    $0x1c,%esp
+  801f58:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f5b:	56                   	push   %esi
+  801f5c:	e8 80 e8 ff ff       	call   8007e1 <strlen>
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f69:	7f 6c                	jg     801fd7 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f6b:	83 ec 0c             	sub    $0xc,%esp
+  801f6e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f71:	50                   	push   %eax
+  801f72:	e8 3a f8 ff ff       	call   8017b1 <fd_alloc>
+  801f77:	89 c3                	mov    %eax,%ebx
+  801f79:	83 c4 10             	add    $0x10,%esp
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	78 3c                	js     801fbc <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f80:	83 ec 08             	sub    $0x8,%esp
+  801f83:	56                   	push   %esi
+  801f84:	68 00 60 80 00       	push   $0x806000
+  801f89:	e8 8e e8 ff ff       	call   80081c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f91:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f99:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9e:	e8 f6 fd ff ff       	call   801d99 <fsipc>
+  801fa3:	89 c3                	mov    %eax,%ebx
+  801fa5:	83 c4 10             	add    $0x10,%esp
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	78 19                	js     801fc5 <open+0x75>
+	return fd2num(fd);
+  801fac:	83 ec 0c             	sub    $0xc,%esp
+  801faf:	ff 75 f4             	push   -0xc(%ebp)
+  801fb2:	e8 d3 f7 ff ff       	call   80178a <fd2num>
+  801fb7:	89 c3                	mov    %eax,%ebx
+  801fb9:	83 c4 10             	add    $0x10,%esp
+}
+  801fbc:	89 d8                	mov    %ebx,%eax
+  801fbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc1:	5b                   	pop    %ebx
+  801fc2:	5e                   	pop    %esi
+  801fc3:	5d                   	pop    %ebp
+  801fc4:	c3                   	ret
+		fd_close(fd, 0);
+  801fc5:	83 ec 08             	sub    $0x8,%esp
+  801fc8:	6a 00                	push   $0x0
+  801fca:	ff 75 f4             	push   -0xc(%ebp)
+  801fcd:	e8 f8 f8 ff ff       	call   8018ca <fd_close>
+		return r;
+  801fd2:	83 c4 10             	add    $0x10,%esp
+  801fd5:	eb e5                	jmp    801fbc <open+0x6c>
+		return -E_BAD_PATH;
+  801fd7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fdc:	eb de                	jmp    801fbc <open+0x6c>
+
+00801fde <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801fde:	55                   	push   %ebp
+  801fdf:	89 e5                	mov    %esp,%ebp
+  801fe1:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801fe4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe9:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fee:	e8 a6 fd ff ff       	call   801d99 <fsipc>
+}
+  801ff3:	c9                   	leave
+  801ff4:	c3                   	ret
+
+00801ff5 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ff5:	55                   	push   %ebp
+  801ff6:	89 e5                	mov    %esp,%ebp
+  801ff8:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ffb:	68 9b 2f 80 00       	push   $0x802f9b
+  802000:	ff 75 0c             	push   0xc(%ebp)
+  802003:	e8 14 e8 ff ff       	call   80081c <strcpy>
+	return 0;
+}
+  802008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200d:	c9                   	leave
+  80200e:	c3                   	ret
+
+0080200f <devsock_close>:
+{
+  80200f:	55                   	push   %ebp
+  802010:	89 e5                	mov    %esp,%ebp
+  802012:	53                   	push   %ebx
+  802013:	83 ec 10             	sub    $0x10,%esp
+  802016:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802019:	53                   	push   %ebx
+  80201a:	e8 e4 0a 00 00       	call   802b03 <pageref>
+  80201f:	89 c2                	mov    %eax,%edx
+  802021:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802024:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802029:	83 fa 01             	cmp    $0x1,%edx
+  80202c:	74 05                	je     802033 <devsock_close+0x24>
+}
+  80202e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802031:	c9                   	leave
+  802032:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802033:	83 ec 0c             	sub    $0xc,%esp
+  802036:	ff 73 0c             	push   0xc(%ebx)
+  802039:	e8 b7 02 00 00       	call   8022f5 <nsipc_close>
+  80203e:	83 c4 10             	add    $0x10,%esp
+  802041:	eb eb                	jmp    80202e <devsock_close+0x1f>
+
+00802043 <devsock_write>:
+{
+  802043:	55                   	push   %ebp
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802049:	6a 00                	push   $0x0
+  80204b:	ff 75 10             	push   0x10(%ebp)
+  80204e:	ff 75 0c             	push   0xc(%ebp)
+  802051:	8b 45 08             	mov    0x8(%ebp),%eax
+  802054:	ff 70 0c             	push   0xc(%eax)
+  802057:	e8 79 03 00 00       	call   8023d5 <nsipc_send>
+}
+  80205c:	c9                   	leave
+  80205d:	c3                   	ret
+
+0080205e <devsock_read>:
+{
+  80205e:	55                   	push   %ebp
+  80205f:	89 e5                	mov    %esp,%ebp
+  802061:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802064:	6a 00                	push   $0x0
+  802066:	ff 75 10             	push   0x10(%ebp)
+  802069:	ff 75 0c             	push   0xc(%ebp)
+  80206c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206f:	ff 70 0c             	push   0xc(%eax)
+  802072:	e8 ef 02 00 00       	call   802366 <nsipc_recv>
+}
+  802077:	c9                   	leave
+  802078:	c3                   	ret
+
+00802079 <fd2sockid>:
+{
+  802079:	55                   	push   %ebp
+  80207a:	89 e5                	mov    %esp,%ebp
+  80207c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80207f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802082:	52                   	push   %edx
+  802083:	50                   	push   %eax
+  802084:	e8 7e f7 ff ff       	call   801807 <fd_lookup>
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	78 10                	js     8020a0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802090:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802093:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802099:	39 08                	cmp    %ecx,(%eax)
+  80209b:	75 05                	jne    8020a2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80209d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020a0:	c9                   	leave
+  8020a1:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020a7:	eb f7                	jmp    8020a0 <fd2sockid+0x27>
+
+008020a9 <alloc_sockfd>:
+{
+  8020a9:	55                   	push   %ebp
+  8020aa:	89 e5                	mov    %esp,%ebp
+  8020ac:	56                   	push   %esi
+  8020ad:	53                   	push   %ebx
+  8020ae:	83 ec 1c             	sub    $0x1c,%esp
+  8020b1:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020b6:	50                   	push   %eax
+  8020b7:	e8 f5 f6 ff ff       	call   8017b1 <fd_alloc>
+  8020bc:	89 c3                	mov    %eax,%ebx
+  8020be:	83 c4 10             	add    $0x10,%esp
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	78 43                	js     802108 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020c5:	83 ec 04             	sub    $0x4,%esp
+  8020c8:	68 07 04 00 00       	push   $0x407
+  8020cd:	ff 75 f4             	push   -0xc(%ebp)
+  8020d0:	6a 00                	push   $0x0
+  8020d2:	e8 3d ec ff ff       	call   800d14 <sys_page_alloc>
+  8020d7:	89 c3                	mov    %eax,%ebx
+  8020d9:	83 c4 10             	add    $0x10,%esp
+  8020dc:	85 c0                	test   %eax,%eax
+  8020de:	78 28                	js     802108 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e3:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8020e9:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8020eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ee:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8020f5:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8020f8:	83 ec 0c             	sub    $0xc,%esp
+  8020fb:	50                   	push   %eax
+  8020fc:	e8 89 f6 ff ff       	call   80178a <fd2num>
+  802101:	89 c3                	mov    %eax,%ebx
+  802103:	83 c4 10             	add    $0x10,%esp
+  802106:	eb 0c                	jmp    802114 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802108:	83 ec 0c             	sub    $0xc,%esp
+  80210b:	56                   	push   %esi
+  80210c:	e8 e4 01 00 00       	call   8022f5 <nsipc_close>
+		return r;
+  802111:	83 c4 10             	add    $0x10,%esp
+}
+  802114:	89 d8                	mov    %ebx,%eax
+  802116:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802119:	5b                   	pop    %ebx
+  80211a:	5e                   	pop    %esi
+  80211b:	5d                   	pop    %ebp
+  80211c:	c3                   	ret
+
+0080211d <accept>:
+{
+  80211d:	55                   	push   %ebp
+  80211e:	89 e5                	mov    %esp,%ebp
+  802120:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802123:	8b 45 08             	mov    0x8(%ebp),%eax
+  802126:	e8 4e ff ff ff       	call   802079 <fd2sockid>
+  80212b:	85 c0                	test   %eax,%eax
+  80212d:	78 1b                	js     80214a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80212f:	83 ec 04             	sub    $0x4,%esp
+  802132:	ff 75 10             	push   0x10(%ebp)
+  802135:	ff 75 0c             	push   0xc(%ebp)
+  802138:	50                   	push   %eax
+  802139:	e8 0e 01 00 00       	call   80224c <nsipc_accept>
+  80213e:	83 c4 10             	add    $0x10,%esp
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 05                	js     80214a <accept+0x2d>
+	return alloc_sockfd(r);
+  802145:	e8 5f ff ff ff       	call   8020a9 <alloc_sockfd>
+}
+  80214a:	c9                   	leave
+  80214b:	c3                   	ret
+
+0080214c <bind>:
+{
+  80214c:	55                   	push   %ebp
+  80214d:	89 e5                	mov    %esp,%ebp
+  80214f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802152:	8b 45 08             	mov    0x8(%ebp),%eax
+  802155:	e8 1f ff ff ff       	call   802079 <fd2sockid>
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	78 12                	js     802170 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80215e:	83 ec 04             	sub    $0x4,%esp
+  802161:	ff 75 10             	push   0x10(%ebp)
+  802164:	ff 75 0c             	push   0xc(%ebp)
+  802167:	50                   	push   %eax
+  802168:	e8 31 01 00 00       	call   80229e <nsipc_bind>
+  80216d:	83 c4 10             	add    $0x10,%esp
+}
+  802170:	c9                   	leave
+  802171:	c3                   	ret
+
+00802172 <shutdown>:
+{
+  802172:	55                   	push   %ebp
+  802173:	89 e5                	mov    %esp,%ebp
+  802175:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802178:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217b:	e8 f9 fe ff ff       	call   802079 <fd2sockid>
+  802180:	85 c0                	test   %eax,%eax
+  802182:	78 0f                	js     802193 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802184:	83 ec 08             	sub    $0x8,%esp
+  802187:	ff 75 0c             	push   0xc(%ebp)
+  80218a:	50                   	push   %eax
+  80218b:	e8 43 01 00 00       	call   8022d3 <nsipc_shutdown>
+  802190:	83 c4 10             	add    $0x10,%esp
+}
+  802193:	c9                   	leave
+  802194:	c3                   	ret
+
+00802195 <connect>:
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80219b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219e:	e8 d6 fe ff ff       	call   802079 <fd2sockid>
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	78 12                	js     8021b9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021a7:	83 ec 04             	sub    $0x4,%esp
+  8021aa:	ff 75 10             	push   0x10(%ebp)
+  8021ad:	ff 75 0c             	push   0xc(%ebp)
+  8021b0:	50                   	push   %eax
+  8021b1:	e8 59 01 00 00       	call   80230f <nsipc_connect>
+  8021b6:	83 c4 10             	add    $0x10,%esp
+}
+  8021b9:	c9                   	leave
+  8021ba:	c3                   	ret
+
+008021bb <listen>:
+{
+  8021bb:	55                   	push   %ebp
+  8021bc:	89 e5                	mov    %esp,%ebp
+  8021be:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c4:	e8 b0 fe ff ff       	call   802079 <fd2sockid>
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	78 0f                	js     8021dc <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021cd:	83 ec 08             	sub    $0x8,%esp
+  8021d0:	ff 75 0c             	push   0xc(%ebp)
+  8021d3:	50                   	push   %eax
+  8021d4:	e8 6b 01 00 00       	call   802344 <nsipc_listen>
+  8021d9:	83 c4 10             	add    $0x10,%esp
+}
+  8021dc:	c9                   	leave
+  8021dd:	c3                   	ret
+
+008021de <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021de:	55                   	push   %ebp
+  8021df:	89 e5                	mov    %esp,%ebp
+  8021e1:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021e4:	ff 75 10             	push   0x10(%ebp)
+  8021e7:	ff 75 0c             	push   0xc(%ebp)
+  8021ea:	ff 75 08             	push   0x8(%ebp)
+  8021ed:	e8 41 02 00 00       	call   802433 <nsipc_socket>
+  8021f2:	83 c4 10             	add    $0x10,%esp
+  8021f5:	85 c0                	test   %eax,%eax
+  8021f7:	78 05                	js     8021fe <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8021f9:	e8 ab fe ff ff       	call   8020a9 <alloc_sockfd>
+}
+  8021fe:	c9                   	leave
+  8021ff:	c3                   	ret
+
+00802200 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802200:	55                   	push   %ebp
+  802201:	89 e5                	mov    %esp,%ebp
+  802203:	53                   	push   %ebx
+  802204:	83 ec 04             	sub    $0x4,%esp
+  802207:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802209:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802210:	74 26                	je     802238 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802212:	6a 07                	push   $0x7
+  802214:	68 00 70 80 00       	push   $0x807000
+  802219:	53                   	push   %ebx
+  80221a:	ff 35 04 50 80 00    	push   0x805004
+  802220:	e8 4b 08 00 00       	call   802a70 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802225:	83 c4 0c             	add    $0xc,%esp
+  802228:	6a 00                	push   $0x0
+  80222a:	6a 00                	push   $0x0
+  80222c:	6a 00                	push   $0x0
+  80222e:	e8 25 08 00 00       	call   802a58 <ipc_recv>
+}
+  802233:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802236:	c9                   	leave
+  802237:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802238:	83 ec 0c             	sub    $0xc,%esp
+  80223b:	6a 02                	push   $0x2
+  80223d:	e8 82 08 00 00       	call   802ac4 <ipc_find_env>
+  802242:	a3 04 50 80 00       	mov    %eax,0x805004
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	eb c6                	jmp    802212 <nsipc+0x12>
+
+0080224c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	56                   	push   %esi
+  802250:	53                   	push   %ebx
+  802251:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802254:	8b 45 08             	mov    0x8(%ebp),%eax
+  802257:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80225c:	8b 06                	mov    (%esi),%eax
+  80225e:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802263:	b8 01 00 00 00       	mov    $0x1,%eax
+  802268:	e8 93 ff ff ff       	call   802200 <nsipc>
+  80226d:	89 c3                	mov    %eax,%ebx
+  80226f:	85 c0                	test   %eax,%eax
+  802271:	79 09                	jns    80227c <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802273:	89 d8                	mov    %ebx,%eax
+  802275:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802278:	5b                   	pop    %ebx
+  802279:	5e                   	pop    %esi
+  80227a:	5d                   	pop    %ebp
+  80227b:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80227c:	83 ec 04             	sub    $0x4,%esp
+  80227f:	ff 35 10 70 80 00    	push   0x807010
+  802285:	68 00 70 80 00       	push   $0x807000
+  80228a:	ff 75 0c             	push   0xc(%ebp)
+  80228d:	e8 10 e7 ff ff       	call   8009a2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802292:	a1 10 70 80 00       	mov    0x807010,%eax
+  802297:	89 06                	mov    %eax,(%esi)
+  802299:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80229c:	eb d5                	jmp    802273 <nsipc_accept+0x27>
+
+0080229e <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	53                   	push   %ebx
+  8022a2:	83 ec 08             	sub    $0x8,%esp
+  8022a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ab:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022b0:	53                   	push   %ebx
+  8022b1:	ff 75 0c             	push   0xc(%ebp)
+  8022b4:	68 04 70 80 00       	push   $0x807004
+  8022b9:	e8 e4 e6 ff ff       	call   8009a2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022be:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022c4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022c9:	e8 32 ff ff ff       	call   802200 <nsipc>
+}
+  8022ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d1:	c9                   	leave
+  8022d2:	c3                   	ret
+
+008022d3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022d3:	55                   	push   %ebp
+  8022d4:	89 e5                	mov    %esp,%ebp
+  8022d6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022dc:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8022e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022e4:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8022e9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022ee:	e8 0d ff ff ff       	call   802200 <nsipc>
+}
+  8022f3:	c9                   	leave
+  8022f4:	c3                   	ret
+
+008022f5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8022f5:	55                   	push   %ebp
+  8022f6:	89 e5                	mov    %esp,%ebp
+  8022f8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8022fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fe:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802303:	b8 04 00 00 00       	mov    $0x4,%eax
+  802308:	e8 f3 fe ff ff       	call   802200 <nsipc>
+}
+  80230d:	c9                   	leave
+  80230e:	c3                   	ret
+
+0080230f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80230f:	55                   	push   %ebp
+  802310:	89 e5                	mov    %esp,%ebp
+  802312:	53                   	push   %ebx
+  802313:	83 ec 08             	sub    $0x8,%esp
+  802316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802319:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231c:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802321:	53                   	push   %ebx
+  802322:	ff 75 0c             	push   0xc(%ebp)
+  802325:	68 04 70 80 00       	push   $0x807004
+  80232a:	e8 73 e6 ff ff       	call   8009a2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80232f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802335:	b8 05 00 00 00       	mov    $0x5,%eax
+  80233a:	e8 c1 fe ff ff       	call   802200 <nsipc>
+}
+  80233f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802342:	c9                   	leave
+  802343:	c3                   	ret
+
+00802344 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802344:	55                   	push   %ebp
+  802345:	89 e5                	mov    %esp,%ebp
+  802347:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80234a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802352:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802355:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80235a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80235f:	e8 9c fe ff ff       	call   802200 <nsipc>
+}
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+
+00802366 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802366:	55                   	push   %ebp
+  802367:	89 e5                	mov    %esp,%ebp
+  802369:	56                   	push   %esi
+  80236a:	53                   	push   %ebx
+  80236b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80236e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802371:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802376:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80237c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80237f:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802384:	b8 07 00 00 00       	mov    $0x7,%eax
+  802389:	e8 72 fe ff ff       	call   802200 <nsipc>
+  80238e:	89 c3                	mov    %eax,%ebx
+  802390:	85 c0                	test   %eax,%eax
+  802392:	78 22                	js     8023b6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802394:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802399:	39 c6                	cmp    %eax,%esi
+  80239b:	0f 4e c6             	cmovle %esi,%eax
+  80239e:	39 c3                	cmp    %eax,%ebx
+  8023a0:	7f 1d                	jg     8023bf <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023a2:	83 ec 04             	sub    $0x4,%esp
+  8023a5:	53                   	push   %ebx
+  8023a6:	68 00 70 80 00       	push   $0x807000
+  8023ab:	ff 75 0c             	push   0xc(%ebp)
+  8023ae:	e8 ef e5 ff ff       	call   8009a2 <memmove>
+  8023b3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023b6:	89 d8                	mov    %ebx,%eax
+  8023b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023bb:	5b                   	pop    %ebx
+  8023bc:	5e                   	pop    %esi
+  8023bd:	5d                   	pop    %ebp
+  8023be:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023bf:	68 a7 2f 80 00       	push   $0x802fa7
+  8023c4:	68 6f 2f 80 00       	push   $0x802f6f
+  8023c9:	6a 62                	push   $0x62
+  8023cb:	68 bc 2f 80 00       	push   $0x802fbc
+  8023d0:	e8 24 dd ff ff       	call   8000f9 <_panic>
+
+008023d5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023d5:	55                   	push   %ebp
+  8023d6:	89 e5                	mov    %esp,%ebp
+  8023d8:	53                   	push   %ebx
+  8023d9:	83 ec 04             	sub    $0x4,%esp
+  8023dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e2:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8023e7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8023ed:	7f 2e                	jg     80241d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8023ef:	83 ec 04             	sub    $0x4,%esp
+  8023f2:	53                   	push   %ebx
+  8023f3:	ff 75 0c             	push   0xc(%ebp)
+  8023f6:	68 0c 70 80 00       	push   $0x80700c
+  8023fb:	e8 a2 e5 ff ff       	call   8009a2 <memmove>
+	nsipcbuf.send.req_size = size;
+  802400:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802406:	8b 45 14             	mov    0x14(%ebp),%eax
+  802409:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80240e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802413:	e8 e8 fd ff ff       	call   802200 <nsipc>
+}
+  802418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80241b:	c9                   	leave
+  80241c:	c3                   	ret
+	assert(size < 1600);
+  80241d:	68 c8 2f 80 00       	push   $0x802fc8
+  802422:	68 6f 2f 80 00       	push   $0x802f6f
+  802427:	6a 6d                	push   $0x6d
+  802429:	68 bc 2f 80 00       	push   $0x802fbc
+  80242e:	e8 c6 dc ff ff       	call   8000f9 <_panic>
+
+00802433 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802433:	55                   	push   %ebp
+  802434:	89 e5                	mov    %esp,%ebp
+  802436:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802439:	8b 45 08             	mov    0x8(%ebp),%eax
+  80243c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802441:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802444:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802449:	8b 45 10             	mov    0x10(%ebp),%eax
+  80244c:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802451:	b8 09 00 00 00       	mov    $0x9,%eax
+  802456:	e8 a5 fd ff ff       	call   802200 <nsipc>
+}
+  80245b:	c9                   	leave
+  80245c:	c3                   	ret
+
+0080245d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80245d:	55                   	push   %ebp
+  80245e:	89 e5                	mov    %esp,%ebp
+  802460:	56                   	push   %esi
+  802461:	53                   	push   %ebx
+  802462:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802465:	83 ec 0c             	sub    $0xc,%esp
+  802468:	ff 75 08             	push   0x8(%ebp)
+  80246b:	e8 2a f3 ff ff       	call   80179a <fd2data>
+  802470:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802472:	83 c4 08             	add    $0x8,%esp
+  802475:	68 d4 2f 80 00       	push   $0x802fd4
+  80247a:	53                   	push   %ebx
+  80247b:	e8 9c e3 ff ff       	call   80081c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802480:	8b 46 04             	mov    0x4(%esi),%eax
+  802483:	2b 06                	sub    (%esi),%eax
+  802485:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80248b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802492:	00 00 00 
+	stat->st_dev = &devpipe;
+  802495:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80249c:	40 80 00 
+	return 0;
+}
+  80249f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024a7:	5b                   	pop    %ebx
+  8024a8:	5e                   	pop    %esi
+  8024a9:	5d                   	pop    %ebp
+  8024aa:	c3                   	ret
+
+008024ab <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024ab:	55                   	push   %ebp
+  8024ac:	89 e5                	mov    %esp,%ebp
+  8024ae:	53                   	push   %ebx
+  8024af:	83 ec 0c             	sub    $0xc,%esp
+  8024b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024b5:	53                   	push   %ebx
+  8024b6:	6a 00                	push   $0x0
+  8024b8:	e8 32 e9 ff ff       	call   800def <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024bd:	89 1c 24             	mov    %ebx,(%esp)
+  8024c0:	e8 d5 f2 ff ff       	call   80179a <fd2data>
+  8024c5:	83 c4 08             	add    $0x8,%esp
+  8024c8:	50                   	push   %eax
+  8024c9:	6a 00                	push   $0x0
+  8024cb:	e8 1f e9 ff ff       	call   800def <sys_page_unmap>
+}
+  8024d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024d3:	c9                   	leave
+  8024d4:	c3                   	ret
+
+008024d5 <_pipeisclosed>:
+{
+  8024d5:	55                   	push   %ebp
+  8024d6:	89 e5                	mov    %esp,%ebp
+  8024d8:	57                   	push   %edi
+  8024d9:	56                   	push   %esi
+  8024da:	53                   	push   %ebx
+  8024db:	83 ec 1c             	sub    $0x1c,%esp
+  8024de:	89 c7                	mov    %eax,%edi
+  8024e0:	89 d6                	mov    %edx,%esi
+  8024e2:	eb 3c                	jmp    802520 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8024e4:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8024e7:	83 ec 0c             	sub    $0xc,%esp
+  8024ea:	57                   	push   %edi
+  8024eb:	e8 13 06 00 00       	call   802b03 <pageref>
+  8024f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024f3:	89 34 24             	mov    %esi,(%esp)
+  8024f6:	e8 08 06 00 00       	call   802b03 <pageref>
+  8024fb:	89 c2                	mov    %eax,%edx
+  8024fd:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024ff:	05 00 00 00 20       	add    $0x20000000,%eax
+  802504:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802507:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80250d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802512:	76 31                	jbe    802545 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802514:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802517:	39 c3                	cmp    %eax,%ebx
+  802519:	74 76                	je     802591 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80251b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80251e:	74 36                	je     802556 <_pipeisclosed+0x81>
+  802520:	89 e0                	mov    %esp,%eax
+  802522:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802527:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80252d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802532:	77 b0                	ja     8024e4 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802534:	c1 e8 10             	shr    $0x10,%eax
+  802537:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80253d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802543:	eb 9f                	jmp    8024e4 <_pipeisclosed+0xf>
+  802545:	c1 e8 10             	shr    $0x10,%eax
+  802548:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80254e:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802554:	eb be                	jmp    802514 <_pipeisclosed+0x3f>
+  802556:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802558:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80255d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802563:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802568:	76 16                	jbe    802580 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80256a:	8b 42 58             	mov    0x58(%edx),%eax
+  80256d:	6a 01                	push   $0x1
+  80256f:	50                   	push   %eax
+  802570:	53                   	push   %ebx
+  802571:	68 db 2f 80 00       	push   $0x802fdb
+  802576:	e8 59 dc ff ff       	call   8001d4 <cprintf>
+  80257b:	83 c4 10             	add    $0x10,%esp
+  80257e:	eb a0                	jmp    802520 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802580:	c1 e8 10             	shr    $0x10,%eax
+  802583:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802589:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80258f:	eb d9                	jmp    80256a <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802591:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802594:	0f 94 c0             	sete   %al
+  802597:	0f b6 c0             	movzbl %al,%eax
+}
+  80259a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+
+008025a2 <devpipe_write>:
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	57                   	push   %edi
+  8025a6:	56                   	push   %esi
+  8025a7:	53                   	push   %ebx
+  8025a8:	83 ec 28             	sub    $0x28,%esp
+  8025ab:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025ae:	56                   	push   %esi
+  8025af:	e8 e6 f1 ff ff       	call   80179a <fd2data>
+  8025b4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025be:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025c1:	75 09                	jne    8025cc <devpipe_write+0x2a>
+	return i;
+  8025c3:	89 f8                	mov    %edi,%eax
+  8025c5:	eb 23                	jmp    8025ea <devpipe_write+0x48>
+			sys_yield();
+  8025c7:	e8 02 e7 ff ff       	call   800cce <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025cc:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025cf:	8b 0b                	mov    (%ebx),%ecx
+  8025d1:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025d4:	39 d0                	cmp    %edx,%eax
+  8025d6:	72 1a                	jb     8025f2 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025d8:	89 da                	mov    %ebx,%edx
+  8025da:	89 f0                	mov    %esi,%eax
+  8025dc:	e8 f4 fe ff ff       	call   8024d5 <_pipeisclosed>
+  8025e1:	85 c0                	test   %eax,%eax
+  8025e3:	74 e2                	je     8025c7 <devpipe_write+0x25>
+				return 0;
+  8025e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ed:	5b                   	pop    %ebx
+  8025ee:	5e                   	pop    %esi
+  8025ef:	5f                   	pop    %edi
+  8025f0:	5d                   	pop    %ebp
+  8025f1:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025f5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025f9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8025fc:	89 c2                	mov    %eax,%edx
+  8025fe:	c1 fa 1f             	sar    $0x1f,%edx
+  802601:	89 d1                	mov    %edx,%ecx
+  802603:	c1 e9 1b             	shr    $0x1b,%ecx
+  802606:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802609:	83 e2 1f             	and    $0x1f,%edx
+  80260c:	29 ca                	sub    %ecx,%edx
+  80260e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802612:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802616:	83 c0 01             	add    $0x1,%eax
+  802619:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80261c:	83 c7 01             	add    $0x1,%edi
+  80261f:	eb 9d                	jmp    8025be <devpipe_write+0x1c>
+
+00802621 <devpipe_read>:
+{
+  802621:	55                   	push   %ebp
+  802622:	89 e5                	mov    %esp,%ebp
+  802624:	57                   	push   %edi
+  802625:	56                   	push   %esi
+  802626:	53                   	push   %ebx
+  802627:	83 ec 18             	sub    $0x18,%esp
+  80262a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80262d:	57                   	push   %edi
+  80262e:	e8 67 f1 ff ff       	call   80179a <fd2data>
+  802633:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802635:	83 c4 10             	add    $0x10,%esp
+  802638:	be 00 00 00 00       	mov    $0x0,%esi
+  80263d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802640:	75 13                	jne    802655 <devpipe_read+0x34>
+	return i;
+  802642:	89 f0                	mov    %esi,%eax
+  802644:	eb 02                	jmp    802648 <devpipe_read+0x27>
+				return i;
+  802646:	89 f0                	mov    %esi,%eax
+}
+  802648:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264b:	5b                   	pop    %ebx
+  80264c:	5e                   	pop    %esi
+  80264d:	5f                   	pop    %edi
+  80264e:	5d                   	pop    %ebp
+  80264f:	c3                   	ret
+			sys_yield();
+  802650:	e8 79 e6 ff ff       	call   800cce <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802655:	8b 03                	mov    (%ebx),%eax
+  802657:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80265a:	75 18                	jne    802674 <devpipe_read+0x53>
+			if (i > 0)
+  80265c:	85 f6                	test   %esi,%esi
+  80265e:	75 e6                	jne    802646 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802660:	89 da                	mov    %ebx,%edx
+  802662:	89 f8                	mov    %edi,%eax
+  802664:	e8 6c fe ff ff       	call   8024d5 <_pipeisclosed>
+  802669:	85 c0                	test   %eax,%eax
+  80266b:	74 e3                	je     802650 <devpipe_read+0x2f>
+				return 0;
+  80266d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802672:	eb d4                	jmp    802648 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802674:	99                   	cltd
+  802675:	c1 ea 1b             	shr    $0x1b,%edx
+  802678:	01 d0                	add    %edx,%eax
+  80267a:	83 e0 1f             	and    $0x1f,%eax
+  80267d:	29 d0                	sub    %edx,%eax
+  80267f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802684:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802687:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80268a:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80268d:	83 c6 01             	add    $0x1,%esi
+  802690:	eb ab                	jmp    80263d <devpipe_read+0x1c>
+
+00802692 <pipe>:
+{
+  802692:	55                   	push   %ebp
+  802693:	89 e5                	mov    %esp,%ebp
+  802695:	56                   	push   %esi
+  802696:	53                   	push   %ebx
+  802697:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80269a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80269d:	50                   	push   %eax
+  80269e:	e8 0e f1 ff ff       	call   8017b1 <fd_alloc>
+  8026a3:	89 c3                	mov    %eax,%ebx
+  8026a5:	83 c4 10             	add    $0x10,%esp
+  8026a8:	85 c0                	test   %eax,%eax
+  8026aa:	0f 88 23 01 00 00    	js     8027d3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026b0:	83 ec 04             	sub    $0x4,%esp
+  8026b3:	68 07 04 00 00       	push   $0x407
+  8026b8:	ff 75 f4             	push   -0xc(%ebp)
+  8026bb:	6a 00                	push   $0x0
+  8026bd:	e8 52 e6 ff ff       	call   800d14 <sys_page_alloc>
+  8026c2:	89 c3                	mov    %eax,%ebx
+  8026c4:	83 c4 10             	add    $0x10,%esp
+  8026c7:	85 c0                	test   %eax,%eax
+  8026c9:	0f 88 04 01 00 00    	js     8027d3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026cf:	83 ec 0c             	sub    $0xc,%esp
+  8026d2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026d5:	50                   	push   %eax
+  8026d6:	e8 d6 f0 ff ff       	call   8017b1 <fd_alloc>
+  8026db:	89 c3                	mov    %eax,%ebx
+  8026dd:	83 c4 10             	add    $0x10,%esp
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	0f 88 db 00 00 00    	js     8027c3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026e8:	83 ec 04             	sub    $0x4,%esp
+  8026eb:	68 07 04 00 00       	push   $0x407
+  8026f0:	ff 75 f0             	push   -0x10(%ebp)
+  8026f3:	6a 00                	push   $0x0
+  8026f5:	e8 1a e6 ff ff       	call   800d14 <sys_page_alloc>
+  8026fa:	89 c3                	mov    %eax,%ebx
+  8026fc:	83 c4 10             	add    $0x10,%esp
+  8026ff:	85 c0                	test   %eax,%eax
+  802701:	0f 88 bc 00 00 00    	js     8027c3 <pipe+0x131>
+	va = fd2data(fd0);
+  802707:	83 ec 0c             	sub    $0xc,%esp
+  80270a:	ff 75 f4             	push   -0xc(%ebp)
+  80270d:	e8 88 f0 ff ff       	call   80179a <fd2data>
+  802712:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802714:	83 c4 0c             	add    $0xc,%esp
+  802717:	68 07 04 00 00       	push   $0x407
+  80271c:	50                   	push   %eax
+  80271d:	6a 00                	push   $0x0
+  80271f:	e8 f0 e5 ff ff       	call   800d14 <sys_page_alloc>
+  802724:	89 c3                	mov    %eax,%ebx
+  802726:	83 c4 10             	add    $0x10,%esp
+  802729:	85 c0                	test   %eax,%eax
+  80272b:	0f 88 82 00 00 00    	js     8027b3 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802731:	83 ec 0c             	sub    $0xc,%esp
+  802734:	ff 75 f0             	push   -0x10(%ebp)
+  802737:	e8 5e f0 ff ff       	call   80179a <fd2data>
+  80273c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802743:	50                   	push   %eax
+  802744:	6a 00                	push   $0x0
+  802746:	56                   	push   %esi
+  802747:	6a 00                	push   $0x0
+  802749:	e8 33 e6 ff ff       	call   800d81 <sys_page_map>
+  80274e:	89 c3                	mov    %eax,%ebx
+  802750:	83 c4 20             	add    $0x20,%esp
+  802753:	85 c0                	test   %eax,%eax
+  802755:	78 4e                	js     8027a5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802757:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80275c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80275f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802761:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802764:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80276b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80276e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802770:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802773:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80277a:	83 ec 0c             	sub    $0xc,%esp
+  80277d:	ff 75 f4             	push   -0xc(%ebp)
+  802780:	e8 05 f0 ff ff       	call   80178a <fd2num>
+  802785:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802788:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80278a:	83 c4 04             	add    $0x4,%esp
+  80278d:	ff 75 f0             	push   -0x10(%ebp)
+  802790:	e8 f5 ef ff ff       	call   80178a <fd2num>
+  802795:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802798:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80279b:	83 c4 10             	add    $0x10,%esp
+  80279e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027a3:	eb 2e                	jmp    8027d3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027a5:	83 ec 08             	sub    $0x8,%esp
+  8027a8:	56                   	push   %esi
+  8027a9:	6a 00                	push   $0x0
+  8027ab:	e8 3f e6 ff ff       	call   800def <sys_page_unmap>
+  8027b0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027b3:	83 ec 08             	sub    $0x8,%esp
+  8027b6:	ff 75 f0             	push   -0x10(%ebp)
+  8027b9:	6a 00                	push   $0x0
+  8027bb:	e8 2f e6 ff ff       	call   800def <sys_page_unmap>
+  8027c0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027c3:	83 ec 08             	sub    $0x8,%esp
+  8027c6:	ff 75 f4             	push   -0xc(%ebp)
+  8027c9:	6a 00                	push   $0x0
+  8027cb:	e8 1f e6 ff ff       	call   800def <sys_page_unmap>
+  8027d0:	83 c4 10             	add    $0x10,%esp
+}
+  8027d3:	89 d8                	mov    %ebx,%eax
+  8027d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027d8:	5b                   	pop    %ebx
+  8027d9:	5e                   	pop    %esi
+  8027da:	5d                   	pop    %ebp
+  8027db:	c3                   	ret
+
+008027dc <pipeisclosed>:
+{
+  8027dc:	55                   	push   %ebp
+  8027dd:	89 e5                	mov    %esp,%ebp
+  8027df:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027e5:	50                   	push   %eax
+  8027e6:	ff 75 08             	push   0x8(%ebp)
+  8027e9:	e8 19 f0 ff ff       	call   801807 <fd_lookup>
+  8027ee:	83 c4 10             	add    $0x10,%esp
+  8027f1:	85 c0                	test   %eax,%eax
+  8027f3:	78 18                	js     80280d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027f5:	83 ec 0c             	sub    $0xc,%esp
+  8027f8:	ff 75 f4             	push   -0xc(%ebp)
+  8027fb:	e8 9a ef ff ff       	call   80179a <fd2data>
+  802800:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802802:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802805:	e8 cb fc ff ff       	call   8024d5 <_pipeisclosed>
+  80280a:	83 c4 10             	add    $0x10,%esp
+}
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+
+0080280f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80280f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802814:	c3                   	ret
+
+00802815 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802815:	55                   	push   %ebp
+  802816:	89 e5                	mov    %esp,%ebp
+  802818:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80281b:	68 f3 2f 80 00       	push   $0x802ff3
+  802820:	ff 75 0c             	push   0xc(%ebp)
+  802823:	e8 f4 df ff ff       	call   80081c <strcpy>
+	return 0;
+}
+  802828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282d:	c9                   	leave
+  80282e:	c3                   	ret
+
+0080282f <devcons_write>:
+{
+  80282f:	55                   	push   %ebp
+  802830:	89 e5                	mov    %esp,%ebp
+  802832:	57                   	push   %edi
+  802833:	56                   	push   %esi
+  802834:	53                   	push   %ebx
+  802835:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80283b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802840:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802846:	eb 2e                	jmp    802876 <devcons_write+0x47>
+		m = n - tot;
+  802848:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80284b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80284d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802852:	39 c3                	cmp    %eax,%ebx
+  802854:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802857:	83 ec 04             	sub    $0x4,%esp
+  80285a:	53                   	push   %ebx
+  80285b:	89 f0                	mov    %esi,%eax
+  80285d:	03 45 0c             	add    0xc(%ebp),%eax
+  802860:	50                   	push   %eax
+  802861:	57                   	push   %edi
+  802862:	e8 3b e1 ff ff       	call   8009a2 <memmove>
+		sys_cputs(buf, m);
+  802867:	83 c4 08             	add    $0x8,%esp
+  80286a:	53                   	push   %ebx
+  80286b:	57                   	push   %edi
+  80286c:	e8 24 e3 ff ff       	call   800b95 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802871:	01 de                	add    %ebx,%esi
+  802873:	83 c4 10             	add    $0x10,%esp
+  802876:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802879:	72 cd                	jb     802848 <devcons_write+0x19>
+}
+  80287b:	89 f0                	mov    %esi,%eax
+  80287d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802880:	5b                   	pop    %ebx
+  802881:	5e                   	pop    %esi
+  802882:	5f                   	pop    %edi
+  802883:	5d                   	pop    %ebp
+  802884:	c3                   	ret
+
+00802885 <devcons_read>:
+{
+  802885:	55                   	push   %ebp
+  802886:	89 e5                	mov    %esp,%ebp
+  802888:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80288b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802890:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802894:	75 07                	jne    80289d <devcons_read+0x18>
+  802896:	eb 1f                	jmp    8028b7 <devcons_read+0x32>
+		sys_yield();
+  802898:	e8 31 e4 ff ff       	call   800cce <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80289d:	e8 37 e3 ff ff       	call   800bd9 <sys_cgetc>
+  8028a2:	85 c0                	test   %eax,%eax
+  8028a4:	74 f2                	je     802898 <devcons_read+0x13>
+	if (c < 0)
+  8028a6:	78 0f                	js     8028b7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028a8:	83 f8 04             	cmp    $0x4,%eax
+  8028ab:	74 0c                	je     8028b9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028b0:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028b2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028b7:	c9                   	leave
+  8028b8:	c3                   	ret
+		return 0;
+  8028b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028be:	eb f7                	jmp    8028b7 <devcons_read+0x32>
+
+008028c0 <cputchar>:
+{
+  8028c0:	55                   	push   %ebp
+  8028c1:	89 e5                	mov    %esp,%ebp
+  8028c3:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028c9:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028cc:	6a 01                	push   $0x1
+  8028ce:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028d1:	50                   	push   %eax
+  8028d2:	e8 be e2 ff ff       	call   800b95 <sys_cputs>
+}
+  8028d7:	83 c4 10             	add    $0x10,%esp
+  8028da:	c9                   	leave
+  8028db:	c3                   	ret
+
+008028dc <getchar>:
+{
+  8028dc:	55                   	push   %ebp
+  8028dd:	89 e5                	mov    %esp,%ebp
+  8028df:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028e2:	6a 01                	push   $0x1
+  8028e4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028e7:	50                   	push   %eax
+  8028e8:	6a 00                	push   $0x0
+  8028ea:	e8 9e f1 ff ff       	call   801a8d <read>
+	if (r < 0)
+  8028ef:	83 c4 10             	add    $0x10,%esp
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	78 06                	js     8028fc <getchar+0x20>
+	if (r < 1)
+  8028f6:	74 06                	je     8028fe <getchar+0x22>
+	return c;
+  8028f8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8028fc:	c9                   	leave
+  8028fd:	c3                   	ret
+		return -E_EOF;
+  8028fe:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802903:	eb f7                	jmp    8028fc <getchar+0x20>
+
+00802905 <iscons>:
+{
+  802905:	55                   	push   %ebp
+  802906:	89 e5                	mov    %esp,%ebp
+  802908:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80290b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80290e:	50                   	push   %eax
+  80290f:	ff 75 08             	push   0x8(%ebp)
+  802912:	e8 f0 ee ff ff       	call   801807 <fd_lookup>
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	78 11                	js     80292f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80291e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802921:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802927:	39 10                	cmp    %edx,(%eax)
+  802929:	0f 94 c0             	sete   %al
+  80292c:	0f b6 c0             	movzbl %al,%eax
+}
+  80292f:	c9                   	leave
+  802930:	c3                   	ret
+
+00802931 <opencons>:
+{
+  802931:	55                   	push   %ebp
+  802932:	89 e5                	mov    %esp,%ebp
+  802934:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802937:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80293a:	50                   	push   %eax
+  80293b:	e8 71 ee ff ff       	call   8017b1 <fd_alloc>
+  802940:	83 c4 10             	add    $0x10,%esp
+  802943:	85 c0                	test   %eax,%eax
+  802945:	78 3a                	js     802981 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802947:	83 ec 04             	sub    $0x4,%esp
+  80294a:	68 07 04 00 00       	push   $0x407
+  80294f:	ff 75 f4             	push   -0xc(%ebp)
+  802952:	6a 00                	push   $0x0
+  802954:	e8 bb e3 ff ff       	call   800d14 <sys_page_alloc>
+  802959:	83 c4 10             	add    $0x10,%esp
+  80295c:	85 c0                	test   %eax,%eax
+  80295e:	78 21                	js     802981 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802960:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802963:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802969:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80296b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80296e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802975:	83 ec 0c             	sub    $0xc,%esp
+  802978:	50                   	push   %eax
+  802979:	e8 0c ee ff ff       	call   80178a <fd2num>
+  80297e:	83 c4 10             	add    $0x10,%esp
+}
+  802981:	c9                   	leave
+  802982:	c3                   	ret
+
+00802983 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	56                   	push   %esi
+  802987:	53                   	push   %ebx
+  802988:	8b 75 08             	mov    0x8(%ebp),%esi
+  80298b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80298e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802991:	85 c0                	test   %eax,%eax
+  802993:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802998:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  80299b:	83 ec 08             	sub    $0x8,%esp
+  80299e:	ff 75 14             	push   0x14(%ebp)
+  8029a1:	50                   	push   %eax
+  8029a2:	e8 7e e7 ff ff       	call   801125 <sys_ipc_recv_until>
+  8029a7:	83 c4 10             	add    $0x10,%esp
+  8029aa:	85 c0                	test   %eax,%eax
+  8029ac:	78 61                	js     802a0f <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029ae:	85 f6                	test   %esi,%esi
+  8029b0:	74 1c                	je     8029ce <ipc_recv_until+0x4b>
+  8029b2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029b4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029b9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029bf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029c4:	76 5f                	jbe    802a25 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029c6:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029cc:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029ce:	85 db                	test   %ebx,%ebx
+  8029d0:	74 1c                	je     8029ee <ipc_recv_until+0x6b>
+  8029d2:	89 e0                	mov    %esp,%eax
+  8029d4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029d9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029df:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029e4:	76 50                	jbe    802a36 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8029e6:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8029ec:	89 03                	mov    %eax,(%ebx)
+  8029ee:	89 e0                	mov    %esp,%eax
+  8029f0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029f5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029fb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a00:	76 45                	jbe    802a47 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a02:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a0b:	5b                   	pop    %ebx
+  802a0c:	5e                   	pop    %esi
+  802a0d:	5d                   	pop    %ebp
+  802a0e:	c3                   	ret
+		if (from_env_store)
+  802a0f:	85 f6                	test   %esi,%esi
+  802a11:	74 06                	je     802a19 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a13:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a19:	85 db                	test   %ebx,%ebx
+  802a1b:	74 eb                	je     802a08 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a1d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a23:	eb e3                	jmp    802a08 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a25:	c1 e8 10             	shr    $0x10,%eax
+  802a28:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a2e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a34:	eb 90                	jmp    8029c6 <ipc_recv_until+0x43>
+  802a36:	c1 e8 10             	shr    $0x10,%eax
+  802a39:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a3f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a45:	eb 9f                	jmp    8029e6 <ipc_recv_until+0x63>
+  802a47:	c1 e8 10             	shr    $0x10,%eax
+  802a4a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a50:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a56:	eb aa                	jmp    802a02 <ipc_recv_until+0x7f>
+
+00802a58 <ipc_recv>:
+{
+  802a58:	55                   	push   %ebp
+  802a59:	89 e5                	mov    %esp,%ebp
+  802a5b:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a5e:	6a 00                	push   $0x0
+  802a60:	ff 75 10             	push   0x10(%ebp)
+  802a63:	ff 75 0c             	push   0xc(%ebp)
+  802a66:	ff 75 08             	push   0x8(%ebp)
+  802a69:	e8 15 ff ff ff       	call   802983 <ipc_recv_until>
+}
+  802a6e:	c9                   	leave
+  802a6f:	c3                   	ret
+
+00802a70 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a70:	55                   	push   %ebp
+  802a71:	89 e5                	mov    %esp,%ebp
+  802a73:	57                   	push   %edi
+  802a74:	56                   	push   %esi
+  802a75:	53                   	push   %ebx
+  802a76:	83 ec 0c             	sub    $0xc,%esp
+  802a79:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a7c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a82:	85 db                	test   %ebx,%ebx
+  802a84:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a89:	0f 44 d8             	cmove  %eax,%ebx
+  802a8c:	eb 05                	jmp    802a93 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802a8e:	e8 3b e2 ff ff       	call   800cce <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802a93:	ff 75 14             	push   0x14(%ebp)
+  802a96:	53                   	push   %ebx
+  802a97:	56                   	push   %esi
+  802a98:	57                   	push   %edi
+  802a99:	e8 d3 e5 ff ff       	call   801071 <sys_ipc_try_send>
+  802a9e:	83 c4 10             	add    $0x10,%esp
+  802aa1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802aa4:	74 e8                	je     802a8e <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802aa6:	85 c0                	test   %eax,%eax
+  802aa8:	78 08                	js     802ab2 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802aaa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aad:	5b                   	pop    %ebx
+  802aae:	5e                   	pop    %esi
+  802aaf:	5f                   	pop    %edi
+  802ab0:	5d                   	pop    %ebp
+  802ab1:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802ab2:	50                   	push   %eax
+  802ab3:	68 ff 2f 80 00       	push   $0x802fff
+  802ab8:	6a 4f                	push   $0x4f
+  802aba:	68 12 30 80 00       	push   $0x803012
+  802abf:	e8 35 d6 ff ff       	call   8000f9 <_panic>
+
+00802ac4 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ac4:	55                   	push   %ebp
+  802ac5:	89 e5                	mov    %esp,%ebp
+  802ac7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802aca:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802acf:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802ad5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802adb:	8b 52 50             	mov    0x50(%edx),%edx
+  802ade:	39 ca                	cmp    %ecx,%edx
+  802ae0:	74 11                	je     802af3 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802ae2:	83 c0 01             	add    $0x1,%eax
+  802ae5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802aea:	75 e3                	jne    802acf <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af1:	eb 0e                	jmp    802b01 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802af3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802af9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802afe:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b01:	5d                   	pop    %ebp
+  802b02:	c3                   	ret
+
+00802b03 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b03:	55                   	push   %ebp
+  802b04:	89 e5                	mov    %esp,%ebp
+  802b06:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b09:	89 c2                	mov    %eax,%edx
+  802b0b:	c1 ea 16             	shr    $0x16,%edx
+  802b0e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b15:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b1a:	f6 c1 01             	test   $0x1,%cl
+  802b1d:	74 1a                	je     802b39 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b1f:	c1 e8 0c             	shr    $0xc,%eax
+  802b22:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b29:	a8 01                	test   $0x1,%al
+  802b2b:	74 0c                	je     802b39 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b2d:	c1 e8 0c             	shr    $0xc,%eax
+  802b30:	c1 e0 04             	shl    $0x4,%eax
+  802b33:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b39:	89 d0                	mov    %edx,%eax
+  802b3b:	5d                   	pop    %ebp
+  802b3c:	c3                   	ret
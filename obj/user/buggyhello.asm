@@ -0,0 +1,6158 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_cputs((char*)1, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 65 0b 00 00       	call   800ba7 <sys_cputs>
+}
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	57                   	push   %edi
+  80004b:	56                   	push   %esi
+  80004c:	53                   	push   %ebx
+  80004d:	83 ec 0c             	sub    $0xc,%esp
+  800050:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800053:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800056:	b8 01 00 00 00       	mov    $0x1,%eax
+  80005b:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80005d:	c1 ea 0b             	shr    $0xb,%edx
+  800060:	83 f2 01             	xor    $0x1,%edx
+  800063:	83 e2 01             	and    $0x1,%edx
+  800066:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80006c:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800073:	00 00 00 
+	envid = sys_getenvid();
+  800076:	e8 1f 0c 00 00       	call   800c9a <sys_getenvid>
+  80007b:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800082:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800088:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80008e:	8b 52 48             	mov    0x48(%edx),%edx
+  800091:	39 ca                	cmp    %ecx,%edx
+  800093:	74 27                	je     8000bc <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800095:	83 c0 01             	add    $0x1,%eax
+  800098:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80009d:	75 e3                	jne    800082 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80009f:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000a6:	75 24                	jne    8000cc <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000a8:	83 ec 04             	sub    $0x4,%esp
+  8000ab:	68 60 2b 80 00       	push   $0x802b60
+  8000b0:	6a 23                	push   $0x23
+  8000b2:	68 83 2b 80 00       	push   $0x802b83
+  8000b7:	e8 4f 00 00 00       	call   80010b <_panic>
+			mainenv = &envs[i];
+  8000bc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000c2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c7:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000cc:	85 ff                	test   %edi,%edi
+  8000ce:	7e 07                	jle    8000d7 <libmain+0x90>
+		binaryname = argv[0];
+  8000d0:	8b 06                	mov    (%esi),%eax
+  8000d2:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000d7:	83 ec 08             	sub    $0x8,%esp
+  8000da:	56                   	push   %esi
+  8000db:	57                   	push   %edi
+  8000dc:	e8 52 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000e1:	e8 0b 00 00 00       	call   8000f1 <exit>
+}
+  8000e6:	83 c4 10             	add    $0x10,%esp
+  8000e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ec:	5b                   	pop    %ebx
+  8000ed:	5e                   	pop    %esi
+  8000ee:	5f                   	pop    %edi
+  8000ef:	5d                   	pop    %ebp
+  8000f0:	c3                   	ret
+
+008000f1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000f1:	55                   	push   %ebp
+  8000f2:	89 e5                	mov    %esp,%ebp
+  8000f4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000f7:	e8 94 18 00 00       	call   801990 <close_all>
+	sys_env_destroy(0);
+  8000fc:	83 ec 0c             	sub    $0xc,%esp
+  8000ff:	6a 00                	push   $0x0
+  800101:	e8 2b 0b 00 00       	call   800c31 <sys_env_destroy>
+}
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	c9                   	leave
+  80010a:	c3                   	ret
+
+0080010b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80010b:	55                   	push   %ebp
+  80010c:	89 e5                	mov    %esp,%ebp
+  80010e:	56                   	push   %esi
+  80010f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800110:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800113:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800119:	e8 7c 0b 00 00       	call   800c9a <sys_getenvid>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	ff 75 0c             	push   0xc(%ebp)
+  800124:	ff 75 08             	push   0x8(%ebp)
+  800127:	56                   	push   %esi
+  800128:	50                   	push   %eax
+  800129:	68 9c 2b 80 00       	push   $0x802b9c
+  80012e:	e8 b3 00 00 00       	call   8001e6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800133:	83 c4 18             	add    $0x18,%esp
+  800136:	53                   	push   %ebx
+  800137:	ff 75 10             	push   0x10(%ebp)
+  80013a:	e8 56 00 00 00       	call   800195 <vcprintf>
+	cprintf("\n");
+  80013f:	c7 04 24 0c 30 80 00 	movl   $0x80300c,(%esp)
+  800146:	e8 9b 00 00 00       	call   8001e6 <cprintf>
+  80014b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80014e:	cc                   	int3
+	while (1)
+  80014f:	eb fd                	jmp    80014e <_panic+0x43>
+
+00800151 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800151:	55                   	push   %ebp
+  800152:	89 e5                	mov    %esp,%ebp
+  800154:	53                   	push   %ebx
+  800155:	83 ec 04             	sub    $0x4,%esp
+  800158:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80015b:	8b 13                	mov    (%ebx),%edx
+  80015d:	8d 42 01             	lea    0x1(%edx),%eax
+  800160:	89 03                	mov    %eax,(%ebx)
+  800162:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800165:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800169:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80016e:	74 09                	je     800179 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800170:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800174:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800177:	c9                   	leave
+  800178:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800179:	83 ec 08             	sub    $0x8,%esp
+  80017c:	68 ff 00 00 00       	push   $0xff
+  800181:	8d 43 08             	lea    0x8(%ebx),%eax
+  800184:	50                   	push   %eax
+  800185:	e8 1d 0a 00 00       	call   800ba7 <sys_cputs>
+		b->idx = 0;
+  80018a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800190:	83 c4 10             	add    $0x10,%esp
+  800193:	eb db                	jmp    800170 <putch+0x1f>
+
+00800195 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800195:	55                   	push   %ebp
+  800196:	89 e5                	mov    %esp,%ebp
+  800198:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80019e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001a5:	00 00 00 
+	b.cnt = 0;
+  8001a8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001af:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001b2:	ff 75 0c             	push   0xc(%ebp)
+  8001b5:	ff 75 08             	push   0x8(%ebp)
+  8001b8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001be:	50                   	push   %eax
+  8001bf:	68 51 01 80 00       	push   $0x800151
+  8001c4:	e8 fb 00 00 00       	call   8002c4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001c9:	83 c4 08             	add    $0x8,%esp
+  8001cc:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001d2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001d8:	50                   	push   %eax
+  8001d9:	e8 c9 09 00 00       	call   800ba7 <sys_cputs>
+
+	return b.cnt;
+}
+  8001de:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001e4:	c9                   	leave
+  8001e5:	c3                   	ret
+
+008001e6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001e6:	55                   	push   %ebp
+  8001e7:	89 e5                	mov    %esp,%ebp
+  8001e9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001ec:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001ef:	50                   	push   %eax
+  8001f0:	ff 75 08             	push   0x8(%ebp)
+  8001f3:	e8 9d ff ff ff       	call   800195 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001f8:	c9                   	leave
+  8001f9:	c3                   	ret
+
+008001fa <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	83 ec 1c             	sub    $0x1c,%esp
+  800203:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800206:	89 d6                	mov    %edx,%esi
+  800208:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80020b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80020e:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800211:	73 0b                	jae    80021e <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800213:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800216:	c1 e7 08             	shl    $0x8,%edi
+  800219:	0b 7d 10             	or     0x10(%ebp),%edi
+  80021c:	eb 36                	jmp    800254 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80021e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800221:	ba 00 00 00 00       	mov    $0x0,%edx
+  800226:	f7 75 08             	divl   0x8(%ebp)
+  800229:	89 c1                	mov    %eax,%ecx
+  80022b:	ff 75 14             	push   0x14(%ebp)
+  80022e:	ff 75 10             	push   0x10(%ebp)
+  800231:	83 eb 01             	sub    $0x1,%ebx
+  800234:	53                   	push   %ebx
+  800235:	ff 75 08             	push   0x8(%ebp)
+  800238:	89 f2                	mov    %esi,%edx
+  80023a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80023d:	e8 b8 ff ff ff       	call   8001fa <printnum>
+  800242:	83 c4 10             	add    $0x10,%esp
+  800245:	eb 14                	jmp    80025b <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	56                   	push   %esi
+  80024b:	57                   	push   %edi
+  80024c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80024f:	ff d0                	call   *%eax
+  800251:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800254:	83 eb 01             	sub    $0x1,%ebx
+  800257:	85 db                	test   %ebx,%ebx
+  800259:	7f ec                	jg     800247 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80025b:	83 ec 08             	sub    $0x8,%esp
+  80025e:	56                   	push   %esi
+  80025f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800262:	ba 00 00 00 00       	mov    $0x0,%edx
+  800267:	f7 75 08             	divl   0x8(%ebp)
+  80026a:	0f be 92 bf 2b 80 00 	movsbl 0x802bbf(%edx),%edx
+  800271:	8b 45 14             	mov    0x14(%ebp),%eax
+  800274:	c1 e0 08             	shl    $0x8,%eax
+  800277:	09 d0                	or     %edx,%eax
+  800279:	50                   	push   %eax
+  80027a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80027d:	ff d0                	call   *%eax
+}
+  80027f:	83 c4 10             	add    $0x10,%esp
+  800282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800285:	5b                   	pop    %ebx
+  800286:	5e                   	pop    %esi
+  800287:	5f                   	pop    %edi
+  800288:	5d                   	pop    %ebp
+  800289:	c3                   	ret
+
+0080028a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80028a:	55                   	push   %ebp
+  80028b:	89 e5                	mov    %esp,%ebp
+  80028d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800290:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800294:	8b 10                	mov    (%eax),%edx
+  800296:	3b 50 04             	cmp    0x4(%eax),%edx
+  800299:	73 0a                	jae    8002a5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80029b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80029e:	89 08                	mov    %ecx,(%eax)
+  8002a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002a3:	88 02                	mov    %al,(%edx)
+}
+  8002a5:	5d                   	pop    %ebp
+  8002a6:	c3                   	ret
+
+008002a7 <printfmt>:
+{
+  8002a7:	55                   	push   %ebp
+  8002a8:	89 e5                	mov    %esp,%ebp
+  8002aa:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002ad:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002b0:	50                   	push   %eax
+  8002b1:	ff 75 10             	push   0x10(%ebp)
+  8002b4:	ff 75 0c             	push   0xc(%ebp)
+  8002b7:	ff 75 08             	push   0x8(%ebp)
+  8002ba:	e8 05 00 00 00       	call   8002c4 <vprintfmt>
+}
+  8002bf:	83 c4 10             	add    $0x10,%esp
+  8002c2:	c9                   	leave
+  8002c3:	c3                   	ret
+
+008002c4 <vprintfmt>:
+{
+  8002c4:	55                   	push   %ebp
+  8002c5:	89 e5                	mov    %esp,%ebp
+  8002c7:	57                   	push   %edi
+  8002c8:	56                   	push   %esi
+  8002c9:	53                   	push   %ebx
+  8002ca:	83 ec 3c             	sub    $0x3c,%esp
+  8002cd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002d0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002da:	eb 16                	jmp    8002f2 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002dc:	83 ec 08             	sub    $0x8,%esp
+  8002df:	ff 75 0c             	push   0xc(%ebp)
+  8002e2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002e5:	c1 e2 08             	shl    $0x8,%edx
+  8002e8:	09 d0                	or     %edx,%eax
+  8002ea:	50                   	push   %eax
+  8002eb:	ff d7                	call   *%edi
+  8002ed:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002f0:	89 de                	mov    %ebx,%esi
+  8002f2:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8002f5:	0f b6 06             	movzbl (%esi),%eax
+  8002f8:	83 f8 25             	cmp    $0x25,%eax
+  8002fb:	74 0c                	je     800309 <vprintfmt+0x45>
+			if (ch == '\0')
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	75 db                	jne    8002dc <vprintfmt+0x18>
+}
+  800301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800304:	5b                   	pop    %ebx
+  800305:	5e                   	pop    %esi
+  800306:	5f                   	pop    %edi
+  800307:	5d                   	pop    %ebp
+  800308:	c3                   	ret
+		padc = ' ';
+  800309:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80030d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800314:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80031b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800322:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800327:	8d 73 01             	lea    0x1(%ebx),%esi
+  80032a:	0f b6 13             	movzbl (%ebx),%edx
+  80032d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800330:	3c 55                	cmp    $0x55,%al
+  800332:	0f 87 2c 04 00 00    	ja     800764 <vprintfmt+0x4a0>
+  800338:	0f b6 c0             	movzbl %al,%eax
+  80033b:	ff 24 85 00 2d 80 00 	jmp    *0x802d00(,%eax,4)
+  800342:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800344:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800348:	eb dd                	jmp    800327 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80034a:	89 f3                	mov    %esi,%ebx
+  80034c:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800350:	eb d5                	jmp    800327 <vprintfmt+0x63>
+  800352:	0f b6 d2             	movzbl %dl,%edx
+  800355:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800357:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80035c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80035f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800363:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800366:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800369:	83 fe 09             	cmp    $0x9,%esi
+  80036c:	0f 87 8a 00 00 00    	ja     8003fc <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800372:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800375:	eb e5                	jmp    80035c <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800377:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037a:	8b 00                	mov    (%eax),%eax
+  80037c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80037f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800382:	8d 40 04             	lea    0x4(%eax),%eax
+  800385:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800388:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80038a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80038e:	79 97                	jns    800327 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800390:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800393:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800396:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80039d:	eb 88                	jmp    800327 <vprintfmt+0x63>
+			if (width < 0)
+  80039f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003a2:	85 db                	test   %ebx,%ebx
+  8003a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a9:	0f 49 c3             	cmovns %ebx,%eax
+  8003ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003af:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003b1:	e9 71 ff ff ff       	jmp    800327 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b6:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003b8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003bf:	e9 63 ff ff ff       	jmp    800327 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003c4:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003c7:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003cb:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003d2:	3c 67                	cmp    $0x67,%al
+  8003d4:	0f 84 18 ff ff ff    	je     8002f2 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003da:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003e1:	3c 72                	cmp    $0x72,%al
+  8003e3:	0f 84 09 ff ff ff    	je     8002f2 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003e9:	3c 62                	cmp    $0x62,%al
+  8003eb:	0f 94 c0             	sete   %al
+  8003ee:	0f b6 c0             	movzbl %al,%eax
+  8003f1:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003f7:	e9 f6 fe ff ff       	jmp    8002f2 <vprintfmt+0x2e>
+  8003fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ff:	eb 89                	jmp    80038a <vprintfmt+0xc6>
+			lflag++;
+  800401:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800406:	e9 1c ff ff ff       	jmp    800327 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80040b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040e:	8d 58 04             	lea    0x4(%eax),%ebx
+  800411:	83 ec 08             	sub    $0x8,%esp
+  800414:	ff 75 0c             	push   0xc(%ebp)
+  800417:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80041a:	c1 e0 08             	shl    $0x8,%eax
+  80041d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800420:	0b 01                	or     (%ecx),%eax
+  800422:	50                   	push   %eax
+  800423:	ff d7                	call   *%edi
+			break;
+  800425:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800428:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80042b:	e9 c2 fe ff ff       	jmp    8002f2 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800430:	8b 45 14             	mov    0x14(%ebp),%eax
+  800433:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800436:	8b 10                	mov    (%eax),%edx
+  800438:	89 d0                	mov    %edx,%eax
+  80043a:	f7 d8                	neg    %eax
+  80043c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80043f:	83 f8 12             	cmp    $0x12,%eax
+  800442:	7f 25                	jg     800469 <vprintfmt+0x1a5>
+  800444:	8b 14 85 60 2e 80 00 	mov    0x802e60(,%eax,4),%edx
+  80044b:	85 d2                	test   %edx,%edx
+  80044d:	74 1a                	je     800469 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80044f:	52                   	push   %edx
+  800450:	68 a1 2f 80 00       	push   $0x802fa1
+  800455:	ff 75 0c             	push   0xc(%ebp)
+  800458:	57                   	push   %edi
+  800459:	e8 49 fe ff ff       	call   8002a7 <printfmt>
+  80045e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800461:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800464:	e9 89 fe ff ff       	jmp    8002f2 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800469:	50                   	push   %eax
+  80046a:	68 d7 2b 80 00       	push   $0x802bd7
+  80046f:	ff 75 0c             	push   0xc(%ebp)
+  800472:	57                   	push   %edi
+  800473:	e8 2f fe ff ff       	call   8002a7 <printfmt>
+  800478:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047b:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80047e:	e9 6f fe ff ff       	jmp    8002f2 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800483:	8b 45 14             	mov    0x14(%ebp),%eax
+  800486:	83 c0 04             	add    $0x4,%eax
+  800489:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80048c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800491:	85 c9                	test   %ecx,%ecx
+  800493:	b8 d0 2b 80 00       	mov    $0x802bd0,%eax
+  800498:	0f 45 c1             	cmovne %ecx,%eax
+  80049b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80049e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a2:	7e 06                	jle    8004aa <vprintfmt+0x1e6>
+  8004a4:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004a8:	75 1a                	jne    8004c4 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004ad:	c1 e0 08             	shl    $0x8,%eax
+  8004b0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004b3:	83 c8 3f             	or     $0x3f,%eax
+  8004b6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004b9:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004bc:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004bf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004c2:	eb 6d                	jmp    800531 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c4:	83 ec 08             	sub    $0x8,%esp
+  8004c7:	ff 75 d0             	push   -0x30(%ebp)
+  8004ca:	ff 75 c8             	push   -0x38(%ebp)
+  8004cd:	e8 39 03 00 00       	call   80080b <strnlen>
+  8004d2:	89 c2                	mov    %eax,%edx
+  8004d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d7:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004d9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004dc:	c1 e1 08             	shl    $0x8,%ecx
+  8004df:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004e3:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e5:	83 c4 10             	add    $0x10,%esp
+  8004e8:	89 c3                	mov    %eax,%ebx
+  8004ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ed:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004f0:	89 ce                	mov    %ecx,%esi
+  8004f2:	eb 0f                	jmp    800503 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	ff 75 0c             	push   0xc(%ebp)
+  8004fa:	56                   	push   %esi
+  8004fb:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	83 eb 01             	sub    $0x1,%ebx
+  800500:	83 c4 10             	add    $0x10,%esp
+  800503:	85 db                	test   %ebx,%ebx
+  800505:	7f ed                	jg     8004f4 <vprintfmt+0x230>
+  800507:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80050d:	85 c0                	test   %eax,%eax
+  80050f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800514:	0f 49 d0             	cmovns %eax,%edx
+  800517:	29 d0                	sub    %edx,%eax
+  800519:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051c:	eb 8c                	jmp    8004aa <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80051e:	83 ec 08             	sub    $0x8,%esp
+  800521:	ff 75 0c             	push   0xc(%ebp)
+  800524:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800527:	09 c2                	or     %eax,%edx
+  800529:	52                   	push   %edx
+  80052a:	ff d7                	call   *%edi
+  80052c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80052f:	89 d9                	mov    %ebx,%ecx
+  800531:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800534:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800538:	0f be d0             	movsbl %al,%edx
+  80053b:	85 d2                	test   %edx,%edx
+  80053d:	74 2a                	je     800569 <vprintfmt+0x2a5>
+  80053f:	85 f6                	test   %esi,%esi
+  800541:	78 05                	js     800548 <vprintfmt+0x284>
+  800543:	83 ee 01             	sub    $0x1,%esi
+  800546:	78 3b                	js     800583 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800548:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80054c:	74 d0                	je     80051e <vprintfmt+0x25a>
+  80054e:	0f be c0             	movsbl %al,%eax
+  800551:	83 e8 20             	sub    $0x20,%eax
+  800554:	83 f8 5e             	cmp    $0x5e,%eax
+  800557:	76 c5                	jbe    80051e <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800559:	83 ec 08             	sub    $0x8,%esp
+  80055c:	ff 75 0c             	push   0xc(%ebp)
+  80055f:	ff 75 cc             	push   -0x34(%ebp)
+  800562:	ff d7                	call   *%edi
+  800564:	83 c4 10             	add    $0x10,%esp
+  800567:	eb c6                	jmp    80052f <vprintfmt+0x26b>
+  800569:	8b 75 10             	mov    0x10(%ebp),%esi
+  80056c:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80056f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800572:	01 c3                	add    %eax,%ebx
+  800574:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800576:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800579:	83 c8 20             	or     $0x20,%eax
+  80057c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80057f:	89 c6                	mov    %eax,%esi
+  800581:	eb 14                	jmp    800597 <vprintfmt+0x2d3>
+  800583:	8b 75 10             	mov    0x10(%ebp),%esi
+  800586:	eb e4                	jmp    80056c <vprintfmt+0x2a8>
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	ff 75 0c             	push   0xc(%ebp)
+  80058e:	56                   	push   %esi
+  80058f:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800591:	83 eb 01             	sub    $0x1,%ebx
+  800594:	83 c4 10             	add    $0x10,%esp
+  800597:	85 db                	test   %ebx,%ebx
+  800599:	7f ed                	jg     800588 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80059b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80059e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a4:	e9 49 fd ff ff       	jmp    8002f2 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005a9:	83 f9 01             	cmp    $0x1,%ecx
+  8005ac:	7f 1f                	jg     8005cd <vprintfmt+0x309>
+	else if (lflag)
+  8005ae:	85 c9                	test   %ecx,%ecx
+  8005b0:	74 69                	je     80061b <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 00                	mov    (%eax),%eax
+  8005b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ba:	89 c1                	mov    %eax,%ecx
+  8005bc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005bf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005cb:	eb 17                	jmp    8005e4 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8b 50 04             	mov    0x4(%eax),%edx
+  8005d3:	8b 00                	mov    (%eax),%eax
+  8005d5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005e4:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005e7:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005ef:	85 db                	test   %ebx,%ebx
+  8005f1:	0f 89 f6 00 00 00    	jns    8006ed <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8005f7:	83 ec 08             	sub    $0x8,%esp
+  8005fa:	ff 75 0c             	push   0xc(%ebp)
+  8005fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800600:	c1 e0 08             	shl    $0x8,%eax
+  800603:	83 c8 2d             	or     $0x2d,%eax
+  800606:	50                   	push   %eax
+  800607:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800609:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80060c:	f7 d9                	neg    %ecx
+  80060e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800611:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800616:	e9 d2 00 00 00       	jmp    8006ed <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80061b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061e:	8b 00                	mov    (%eax),%eax
+  800620:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800623:	89 c1                	mov    %eax,%ecx
+  800625:	c1 f9 1f             	sar    $0x1f,%ecx
+  800628:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8d 40 04             	lea    0x4(%eax),%eax
+  800631:	89 45 14             	mov    %eax,0x14(%ebp)
+  800634:	eb ae                	jmp    8005e4 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800636:	83 f9 01             	cmp    $0x1,%ecx
+  800639:	7f 19                	jg     800654 <vprintfmt+0x390>
+	else if (lflag)
+  80063b:	85 c9                	test   %ecx,%ecx
+  80063d:	74 2a                	je     800669 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8b 08                	mov    (%eax),%ecx
+  800644:	8d 40 04             	lea    0x4(%eax),%eax
+  800647:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064a:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80064f:	e9 99 00 00 00       	jmp    8006ed <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 08                	mov    (%eax),%ecx
+  800659:	8d 40 08             	lea    0x8(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80065f:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800664:	e9 84 00 00 00       	jmp    8006ed <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800669:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066c:	8b 08                	mov    (%eax),%ecx
+  80066e:	8d 40 04             	lea    0x4(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800674:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800679:	eb 72                	jmp    8006ed <vprintfmt+0x429>
+	if (lflag >= 2)
+  80067b:	83 f9 01             	cmp    $0x1,%ecx
+  80067e:	7f 16                	jg     800696 <vprintfmt+0x3d2>
+	else if (lflag)
+  800680:	85 c9                	test   %ecx,%ecx
+  800682:	74 24                	je     8006a8 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 08                	mov    (%eax),%ecx
+  800689:	8d 40 04             	lea    0x4(%eax),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80068f:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800694:	eb 57                	jmp    8006ed <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 08                	mov    (%eax),%ecx
+  80069b:	8d 40 08             	lea    0x8(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a1:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006a6:	eb 45                	jmp    8006ed <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8b 08                	mov    (%eax),%ecx
+  8006ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b3:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006b8:	eb 33                	jmp    8006ed <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006ba:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006bd:	c1 e3 08             	shl    $0x8,%ebx
+  8006c0:	83 ec 08             	sub    $0x8,%esp
+  8006c3:	ff 75 0c             	push   0xc(%ebp)
+  8006c6:	89 d8                	mov    %ebx,%eax
+  8006c8:	83 c8 30             	or     $0x30,%eax
+  8006cb:	50                   	push   %eax
+  8006cc:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006ce:	83 c4 08             	add    $0x8,%esp
+  8006d1:	ff 75 0c             	push   0xc(%ebp)
+  8006d4:	83 cb 78             	or     $0x78,%ebx
+  8006d7:	53                   	push   %ebx
+  8006d8:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006df:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e8:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8006f0:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006f4:	52                   	push   %edx
+  8006f5:	ff 75 e0             	push   -0x20(%ebp)
+  8006f8:	50                   	push   %eax
+  8006f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006fc:	89 f8                	mov    %edi,%eax
+  8006fe:	e8 f7 fa ff ff       	call   8001fa <printnum>
+			break;
+  800703:	83 c4 10             	add    $0x10,%esp
+  800706:	e9 e7 fb ff ff       	jmp    8002f2 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80070b:	83 f9 01             	cmp    $0x1,%ecx
+  80070e:	7f 16                	jg     800726 <vprintfmt+0x462>
+	else if (lflag)
+  800710:	85 c9                	test   %ecx,%ecx
+  800712:	74 24                	je     800738 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8b 08                	mov    (%eax),%ecx
+  800719:	8d 40 04             	lea    0x4(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80071f:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800724:	eb c7                	jmp    8006ed <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 08                	mov    (%eax),%ecx
+  80072b:	8d 40 08             	lea    0x8(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800731:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800736:	eb b5                	jmp    8006ed <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800738:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073b:	8b 08                	mov    (%eax),%ecx
+  80073d:	8d 40 04             	lea    0x4(%eax),%eax
+  800740:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800743:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800748:	eb a3                	jmp    8006ed <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80074a:	83 ec 08             	sub    $0x8,%esp
+  80074d:	ff 75 0c             	push   0xc(%ebp)
+  800750:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800753:	c1 e0 08             	shl    $0x8,%eax
+  800756:	83 c8 25             	or     $0x25,%eax
+  800759:	50                   	push   %eax
+  80075a:	ff d7                	call   *%edi
+			break;
+  80075c:	83 c4 10             	add    $0x10,%esp
+  80075f:	e9 8e fb ff ff       	jmp    8002f2 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800764:	83 ec 08             	sub    $0x8,%esp
+  800767:	ff 75 0c             	push   0xc(%ebp)
+  80076a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80076d:	c1 e0 08             	shl    $0x8,%eax
+  800770:	83 c8 25             	or     $0x25,%eax
+  800773:	50                   	push   %eax
+  800774:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800776:	83 c4 10             	add    $0x10,%esp
+  800779:	89 de                	mov    %ebx,%esi
+  80077b:	eb 03                	jmp    800780 <vprintfmt+0x4bc>
+  80077d:	83 ee 01             	sub    $0x1,%esi
+  800780:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800784:	75 f7                	jne    80077d <vprintfmt+0x4b9>
+  800786:	e9 67 fb ff ff       	jmp    8002f2 <vprintfmt+0x2e>
+
+0080078b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80078b:	55                   	push   %ebp
+  80078c:	89 e5                	mov    %esp,%ebp
+  80078e:	83 ec 18             	sub    $0x18,%esp
+  800791:	8b 45 08             	mov    0x8(%ebp),%eax
+  800794:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800797:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80079a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80079e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007a8:	85 c0                	test   %eax,%eax
+  8007aa:	74 26                	je     8007d2 <vsnprintf+0x47>
+  8007ac:	85 d2                	test   %edx,%edx
+  8007ae:	7e 22                	jle    8007d2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007b0:	ff 75 14             	push   0x14(%ebp)
+  8007b3:	ff 75 10             	push   0x10(%ebp)
+  8007b6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007b9:	50                   	push   %eax
+  8007ba:	68 8a 02 80 00       	push   $0x80028a
+  8007bf:	e8 00 fb ff ff       	call   8002c4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007c7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007cd:	83 c4 10             	add    $0x10,%esp
+}
+  8007d0:	c9                   	leave
+  8007d1:	c3                   	ret
+		return -E_INVAL;
+  8007d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007d7:	eb f7                	jmp    8007d0 <vsnprintf+0x45>
+
+008007d9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007d9:	55                   	push   %ebp
+  8007da:	89 e5                	mov    %esp,%ebp
+  8007dc:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007df:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007e2:	50                   	push   %eax
+  8007e3:	ff 75 10             	push   0x10(%ebp)
+  8007e6:	ff 75 0c             	push   0xc(%ebp)
+  8007e9:	ff 75 08             	push   0x8(%ebp)
+  8007ec:	e8 9a ff ff ff       	call   80078b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007f1:	c9                   	leave
+  8007f2:	c3                   	ret
+
+008007f3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007f3:	55                   	push   %ebp
+  8007f4:	89 e5                	mov    %esp,%ebp
+  8007f6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fe:	eb 03                	jmp    800803 <strlen+0x10>
+		n++;
+  800800:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800803:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800807:	75 f7                	jne    800800 <strlen+0xd>
+	return n;
+}
+  800809:	5d                   	pop    %ebp
+  80080a:	c3                   	ret
+
+0080080b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80080b:	55                   	push   %ebp
+  80080c:	89 e5                	mov    %esp,%ebp
+  80080e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800811:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800814:	b8 00 00 00 00       	mov    $0x0,%eax
+  800819:	eb 03                	jmp    80081e <strnlen+0x13>
+		n++;
+  80081b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081e:	39 d0                	cmp    %edx,%eax
+  800820:	74 08                	je     80082a <strnlen+0x1f>
+  800822:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800826:	75 f3                	jne    80081b <strnlen+0x10>
+  800828:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80082a:	89 d0                	mov    %edx,%eax
+  80082c:	5d                   	pop    %ebp
+  80082d:	c3                   	ret
+
+0080082e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80082e:	55                   	push   %ebp
+  80082f:	89 e5                	mov    %esp,%ebp
+  800831:	53                   	push   %ebx
+  800832:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800835:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800841:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800844:	83 c0 01             	add    $0x1,%eax
+  800847:	84 d2                	test   %dl,%dl
+  800849:	75 f2                	jne    80083d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80084b:	89 c8                	mov    %ecx,%eax
+  80084d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800850:	c9                   	leave
+  800851:	c3                   	ret
+
+00800852 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800852:	55                   	push   %ebp
+  800853:	89 e5                	mov    %esp,%ebp
+  800855:	53                   	push   %ebx
+  800856:	83 ec 10             	sub    $0x10,%esp
+  800859:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80085c:	53                   	push   %ebx
+  80085d:	e8 91 ff ff ff       	call   8007f3 <strlen>
+  800862:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800865:	ff 75 0c             	push   0xc(%ebp)
+  800868:	01 d8                	add    %ebx,%eax
+  80086a:	50                   	push   %eax
+  80086b:	e8 be ff ff ff       	call   80082e <strcpy>
+	return dst;
+}
+  800870:	89 d8                	mov    %ebx,%eax
+  800872:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800875:	c9                   	leave
+  800876:	c3                   	ret
+
+00800877 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	56                   	push   %esi
+  80087b:	53                   	push   %ebx
+  80087c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800882:	89 f3                	mov    %esi,%ebx
+  800884:	03 5d 10             	add    0x10(%ebp),%ebx
+  800887:	89 f0                	mov    %esi,%eax
+  800889:	eb 0f                	jmp    80089a <strncpy+0x23>
+		*dst++ = *src;
+  80088b:	83 c0 01             	add    $0x1,%eax
+  80088e:	0f b6 0a             	movzbl (%edx),%ecx
+  800891:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800894:	80 f9 01             	cmp    $0x1,%cl
+  800897:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80089a:	39 d8                	cmp    %ebx,%eax
+  80089c:	75 ed                	jne    80088b <strncpy+0x14>
+	}
+	return ret;
+}
+  80089e:	89 f0                	mov    %esi,%eax
+  8008a0:	5b                   	pop    %ebx
+  8008a1:	5e                   	pop    %esi
+  8008a2:	5d                   	pop    %ebp
+  8008a3:	c3                   	ret
+
+008008a4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008a4:	55                   	push   %ebp
+  8008a5:	89 e5                	mov    %esp,%ebp
+  8008a7:	56                   	push   %esi
+  8008a8:	53                   	push   %ebx
+  8008a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008af:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008b2:	89 f0                	mov    %esi,%eax
+  8008b4:	85 d2                	test   %edx,%edx
+  8008b6:	74 21                	je     8008d9 <strlcpy+0x35>
+  8008b8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008bc:	89 f2                	mov    %esi,%edx
+  8008be:	eb 09                	jmp    8008c9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008c0:	83 c1 01             	add    $0x1,%ecx
+  8008c3:	83 c2 01             	add    $0x1,%edx
+  8008c6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008c9:	39 c2                	cmp    %eax,%edx
+  8008cb:	74 09                	je     8008d6 <strlcpy+0x32>
+  8008cd:	0f b6 19             	movzbl (%ecx),%ebx
+  8008d0:	84 db                	test   %bl,%bl
+  8008d2:	75 ec                	jne    8008c0 <strlcpy+0x1c>
+  8008d4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008d6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008d9:	29 f0                	sub    %esi,%eax
+}
+  8008db:	5b                   	pop    %ebx
+  8008dc:	5e                   	pop    %esi
+  8008dd:	5d                   	pop    %ebp
+  8008de:	c3                   	ret
+
+008008df <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008e8:	eb 06                	jmp    8008f0 <strcmp+0x11>
+		p++, q++;
+  8008ea:	83 c1 01             	add    $0x1,%ecx
+  8008ed:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008f0:	0f b6 01             	movzbl (%ecx),%eax
+  8008f3:	84 c0                	test   %al,%al
+  8008f5:	74 04                	je     8008fb <strcmp+0x1c>
+  8008f7:	3a 02                	cmp    (%edx),%al
+  8008f9:	74 ef                	je     8008ea <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008fb:	0f b6 c0             	movzbl %al,%eax
+  8008fe:	0f b6 12             	movzbl (%edx),%edx
+  800901:	29 d0                	sub    %edx,%eax
+}
+  800903:	5d                   	pop    %ebp
+  800904:	c3                   	ret
+
+00800905 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800905:	55                   	push   %ebp
+  800906:	89 e5                	mov    %esp,%ebp
+  800908:	53                   	push   %ebx
+  800909:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800912:	eb 09                	jmp    80091d <strncmp+0x18>
+		n--, p++, q++;
+  800914:	83 ea 01             	sub    $0x1,%edx
+  800917:	83 c0 01             	add    $0x1,%eax
+  80091a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80091d:	85 d2                	test   %edx,%edx
+  80091f:	74 18                	je     800939 <strncmp+0x34>
+  800921:	0f b6 18             	movzbl (%eax),%ebx
+  800924:	84 db                	test   %bl,%bl
+  800926:	74 04                	je     80092c <strncmp+0x27>
+  800928:	3a 19                	cmp    (%ecx),%bl
+  80092a:	74 e8                	je     800914 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80092c:	0f b6 00             	movzbl (%eax),%eax
+  80092f:	0f b6 11             	movzbl (%ecx),%edx
+  800932:	29 d0                	sub    %edx,%eax
+}
+  800934:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800937:	c9                   	leave
+  800938:	c3                   	ret
+		return 0;
+  800939:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093e:	eb f4                	jmp    800934 <strncmp+0x2f>
+
+00800940 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	8b 45 08             	mov    0x8(%ebp),%eax
+  800946:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80094a:	eb 03                	jmp    80094f <strchr+0xf>
+  80094c:	83 c0 01             	add    $0x1,%eax
+  80094f:	0f b6 10             	movzbl (%eax),%edx
+  800952:	84 d2                	test   %dl,%dl
+  800954:	74 06                	je     80095c <strchr+0x1c>
+		if (*s == c)
+  800956:	38 ca                	cmp    %cl,%dl
+  800958:	75 f2                	jne    80094c <strchr+0xc>
+  80095a:	eb 05                	jmp    800961 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80095c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800961:	5d                   	pop    %ebp
+  800962:	c3                   	ret
+
+00800963 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	8b 45 08             	mov    0x8(%ebp),%eax
+  800969:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80096d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800970:	38 ca                	cmp    %cl,%dl
+  800972:	74 09                	je     80097d <strfind+0x1a>
+  800974:	84 d2                	test   %dl,%dl
+  800976:	74 05                	je     80097d <strfind+0x1a>
+	for (; *s; s++)
+  800978:	83 c0 01             	add    $0x1,%eax
+  80097b:	eb f0                	jmp    80096d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80097d:	5d                   	pop    %ebp
+  80097e:	c3                   	ret
+
+0080097f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80097f:	55                   	push   %ebp
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	57                   	push   %edi
+  800983:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800986:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800989:	85 c9                	test   %ecx,%ecx
+  80098b:	74 20                	je     8009ad <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80098d:	89 f8                	mov    %edi,%eax
+  80098f:	09 c8                	or     %ecx,%eax
+  800991:	a8 03                	test   $0x3,%al
+  800993:	75 12                	jne    8009a7 <memset+0x28>
+		c &= 0xFF;
+  800995:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800999:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80099f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009a2:	fc                   	cld
+  8009a3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009a5:	eb 06                	jmp    8009ad <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009aa:	fc                   	cld
+  8009ab:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009ad:	89 f8                	mov    %edi,%eax
+  8009af:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009b2:	c9                   	leave
+  8009b3:	c3                   	ret
+
+008009b4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009b4:	55                   	push   %ebp
+  8009b5:	89 e5                	mov    %esp,%ebp
+  8009b7:	57                   	push   %edi
+  8009b8:	56                   	push   %esi
+  8009b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009bf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009c2:	39 c6                	cmp    %eax,%esi
+  8009c4:	73 32                	jae    8009f8 <memmove+0x44>
+  8009c6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009c9:	39 d0                	cmp    %edx,%eax
+  8009cb:	73 2b                	jae    8009f8 <memmove+0x44>
+		s += n;
+		d += n;
+  8009cd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009d0:	89 d6                	mov    %edx,%esi
+  8009d2:	09 fe                	or     %edi,%esi
+  8009d4:	09 ce                	or     %ecx,%esi
+  8009d6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009dc:	75 0e                	jne    8009ec <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009de:	83 ef 04             	sub    $0x4,%edi
+  8009e1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009e4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009e7:	fd                   	std
+  8009e8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ea:	eb 09                	jmp    8009f5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009ec:	83 ef 01             	sub    $0x1,%edi
+  8009ef:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009f2:	fd                   	std
+  8009f3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009f5:	fc                   	cld
+  8009f6:	eb 1a                	jmp    800a12 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f8:	89 f2                	mov    %esi,%edx
+  8009fa:	09 c2                	or     %eax,%edx
+  8009fc:	09 ca                	or     %ecx,%edx
+  8009fe:	f6 c2 03             	test   $0x3,%dl
+  800a01:	75 0a                	jne    800a0d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a03:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a06:	89 c7                	mov    %eax,%edi
+  800a08:	fc                   	cld
+  800a09:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a0b:	eb 05                	jmp    800a12 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a0d:	89 c7                	mov    %eax,%edi
+  800a0f:	fc                   	cld
+  800a10:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a12:	5e                   	pop    %esi
+  800a13:	5f                   	pop    %edi
+  800a14:	5d                   	pop    %ebp
+  800a15:	c3                   	ret
+
+00800a16 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a1c:	ff 75 10             	push   0x10(%ebp)
+  800a1f:	ff 75 0c             	push   0xc(%ebp)
+  800a22:	ff 75 08             	push   0x8(%ebp)
+  800a25:	e8 8a ff ff ff       	call   8009b4 <memmove>
+}
+  800a2a:	c9                   	leave
+  800a2b:	c3                   	ret
+
+00800a2c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	56                   	push   %esi
+  800a30:	53                   	push   %ebx
+  800a31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a34:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a37:	89 c6                	mov    %eax,%esi
+  800a39:	03 75 10             	add    0x10(%ebp),%esi
+  800a3c:	eb 06                	jmp    800a44 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a3e:	83 c0 01             	add    $0x1,%eax
+  800a41:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a44:	39 f0                	cmp    %esi,%eax
+  800a46:	74 14                	je     800a5c <memcmp+0x30>
+		if (*s1 != *s2)
+  800a48:	0f b6 08             	movzbl (%eax),%ecx
+  800a4b:	0f b6 1a             	movzbl (%edx),%ebx
+  800a4e:	38 d9                	cmp    %bl,%cl
+  800a50:	74 ec                	je     800a3e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a52:	0f b6 c1             	movzbl %cl,%eax
+  800a55:	0f b6 db             	movzbl %bl,%ebx
+  800a58:	29 d8                	sub    %ebx,%eax
+  800a5a:	eb 05                	jmp    800a61 <memcmp+0x35>
+	}
+
+	return 0;
+  800a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a61:	5b                   	pop    %ebx
+  800a62:	5e                   	pop    %esi
+  800a63:	5d                   	pop    %ebp
+  800a64:	c3                   	ret
+
+00800a65 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a6e:	89 c2                	mov    %eax,%edx
+  800a70:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a73:	eb 03                	jmp    800a78 <memfind+0x13>
+  800a75:	83 c0 01             	add    $0x1,%eax
+  800a78:	39 d0                	cmp    %edx,%eax
+  800a7a:	73 04                	jae    800a80 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a7c:	38 08                	cmp    %cl,(%eax)
+  800a7e:	75 f5                	jne    800a75 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a80:	5d                   	pop    %ebp
+  800a81:	c3                   	ret
+
+00800a82 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a82:	55                   	push   %ebp
+  800a83:	89 e5                	mov    %esp,%ebp
+  800a85:	57                   	push   %edi
+  800a86:	56                   	push   %esi
+  800a87:	53                   	push   %ebx
+  800a88:	83 ec 1c             	sub    $0x1c,%esp
+  800a8b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a8e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a91:	eb 03                	jmp    800a96 <strtol+0x14>
+		s++;
+  800a93:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800a96:	0f b6 06             	movzbl (%esi),%eax
+  800a99:	3c 20                	cmp    $0x20,%al
+  800a9b:	74 f6                	je     800a93 <strtol+0x11>
+  800a9d:	3c 09                	cmp    $0x9,%al
+  800a9f:	74 f2                	je     800a93 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aa1:	3c 2b                	cmp    $0x2b,%al
+  800aa3:	74 43                	je     800ae8 <strtol+0x66>
+	int neg = 0;
+  800aa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800aaa:	3c 2d                	cmp    $0x2d,%al
+  800aac:	74 44                	je     800af2 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aae:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ab4:	75 0f                	jne    800ac5 <strtol+0x43>
+  800ab6:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ab9:	74 41                	je     800afc <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800abb:	85 ff                	test   %edi,%edi
+  800abd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ac2:	0f 44 f8             	cmove  %eax,%edi
+  800ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aca:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800acf:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ad2:	89 fb                	mov    %edi,%ebx
+  800ad4:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ad7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ada:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800add:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ae0:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800ae3:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ae6:	eb 67                	jmp    800b4f <strtol+0xcd>
+		s++;
+  800ae8:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800aeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af0:	eb bc                	jmp    800aae <strtol+0x2c>
+		s++, neg = 1;
+  800af2:	83 c6 01             	add    $0x1,%esi
+  800af5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800afa:	eb b2                	jmp    800aae <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800afc:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b00:	74 0e                	je     800b10 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b02:	85 ff                	test   %edi,%edi
+  800b04:	75 bf                	jne    800ac5 <strtol+0x43>
+		s++, base = 8;
+  800b06:	83 c6 01             	add    $0x1,%esi
+  800b09:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b0e:	eb b5                	jmp    800ac5 <strtol+0x43>
+		s += 2, base = 16;
+  800b10:	83 c6 02             	add    $0x2,%esi
+  800b13:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b18:	eb ab                	jmp    800ac5 <strtol+0x43>
+			dig = *s - '0';
+  800b1a:	0f be c9             	movsbl %cl,%ecx
+  800b1d:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b20:	39 f9                	cmp    %edi,%ecx
+  800b22:	7d 59                	jge    800b7d <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b24:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b28:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b2b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b2e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b31:	0f af d8             	imul   %eax,%ebx
+  800b34:	0f af d7             	imul   %edi,%edx
+  800b37:	01 d3                	add    %edx,%ebx
+  800b39:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b3c:	f7 e7                	mul    %edi
+  800b3e:	01 da                	add    %ebx,%edx
+  800b40:	89 cb                	mov    %ecx,%ebx
+  800b42:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b45:	01 c8                	add    %ecx,%eax
+  800b47:	11 da                	adc    %ebx,%edx
+  800b49:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b4c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b52:	0f b6 08             	movzbl (%eax),%ecx
+  800b55:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b58:	80 fb 09             	cmp    $0x9,%bl
+  800b5b:	76 bd                	jbe    800b1a <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b5d:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b60:	80 fb 19             	cmp    $0x19,%bl
+  800b63:	77 08                	ja     800b6d <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b65:	0f be c9             	movsbl %cl,%ecx
+  800b68:	83 e9 57             	sub    $0x57,%ecx
+  800b6b:	eb b3                	jmp    800b20 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b6d:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b70:	80 fb 19             	cmp    $0x19,%bl
+  800b73:	77 08                	ja     800b7d <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b75:	0f be c9             	movsbl %cl,%ecx
+  800b78:	83 e9 37             	sub    $0x37,%ecx
+  800b7b:	eb a3                	jmp    800b20 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b7d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b80:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b83:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b86:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b89:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b8d:	74 05                	je     800b94 <strtol+0x112>
+		*endptr = (char *) s;
+  800b8f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b92:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800b94:	85 c9                	test   %ecx,%ecx
+  800b96:	74 07                	je     800b9f <strtol+0x11d>
+  800b98:	f7 d8                	neg    %eax
+  800b9a:	83 d2 00             	adc    $0x0,%edx
+  800b9d:	f7 da                	neg    %edx
+}
+  800b9f:	83 c4 1c             	add    $0x1c,%esp
+  800ba2:	5b                   	pop    %ebx
+  800ba3:	5e                   	pop    %esi
+  800ba4:	5f                   	pop    %edi
+  800ba5:	5d                   	pop    %ebp
+  800ba6:	c3                   	ret
+
+00800ba7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ba7:	55                   	push   %ebp
+  800ba8:	89 e5                	mov    %esp,%ebp
+  800baa:	57                   	push   %edi
+  800bab:	56                   	push   %esi
+  800bac:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bad:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bb4:	74 18                	je     800bce <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc1:	89 c3                	mov    %eax,%ebx
+  800bc3:	89 c7                	mov    %eax,%edi
+  800bc5:	89 c6                	mov    %eax,%esi
+  800bc7:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5f                   	pop    %edi
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bce:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd9:	89 c3                	mov    %eax,%ebx
+  800bdb:	89 c7                	mov    %eax,%edi
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	8d 35 e8 0b 80 00    	lea    0x800be8,%esi
+  800be6:	0f 34                	sysenter
+  800be8:	5d                   	pop    %ebp
+		goto out;
+  800be9:	eb de                	jmp    800bc9 <sys_cputs+0x22>
+
+00800beb <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800beb:	55                   	push   %ebp
+  800bec:	89 e5                	mov    %esp,%ebp
+  800bee:	57                   	push   %edi
+  800bef:	56                   	push   %esi
+  800bf0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bf1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bf8:	74 19                	je     800c13 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800bfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c04:	89 d1                	mov    %edx,%ecx
+  800c06:	89 d3                	mov    %edx,%ebx
+  800c08:	89 d7                	mov    %edx,%edi
+  800c0a:	89 d6                	mov    %edx,%esi
+  800c0c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c0e:	5b                   	pop    %ebx
+  800c0f:	5e                   	pop    %esi
+  800c10:	5f                   	pop    %edi
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c18:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c1d:	89 d1                	mov    %edx,%ecx
+  800c1f:	89 d3                	mov    %edx,%ebx
+  800c21:	89 d7                	mov    %edx,%edi
+  800c23:	55                   	push   %ebp
+  800c24:	89 e5                	mov    %esp,%ebp
+  800c26:	8d 35 2e 0c 80 00    	lea    0x800c2e,%esi
+  800c2c:	0f 34                	sysenter
+  800c2e:	5d                   	pop    %ebp
+		goto out;
+  800c2f:	eb dd                	jmp    800c0e <sys_cgetc+0x23>
+
+00800c31 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	57                   	push   %edi
+  800c35:	56                   	push   %esi
+  800c36:	53                   	push   %ebx
+  800c37:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c3a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c41:	74 21                	je     800c64 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c48:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c50:	89 cb                	mov    %ecx,%ebx
+  800c52:	89 cf                	mov    %ecx,%edi
+  800c54:	89 ce                	mov    %ecx,%esi
+  800c56:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c58:	85 c0                	test   %eax,%eax
+  800c5a:	7f 27                	jg     800c83 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5f:	5b                   	pop    %ebx
+  800c60:	5e                   	pop    %esi
+  800c61:	5f                   	pop    %edi
+  800c62:	5d                   	pop    %ebp
+  800c63:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c6c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c71:	89 cb                	mov    %ecx,%ebx
+  800c73:	89 cf                	mov    %ecx,%edi
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	8d 35 80 0c 80 00    	lea    0x800c80,%esi
+  800c7e:	0f 34                	sysenter
+  800c80:	5d                   	pop    %ebp
+		goto out;
+  800c81:	eb d5                	jmp    800c58 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c83:	83 ec 0c             	sub    $0xc,%esp
+  800c86:	50                   	push   %eax
+  800c87:	6a 03                	push   $0x3
+  800c89:	68 cb 2e 80 00       	push   $0x802ecb
+  800c8e:	6a 3f                	push   $0x3f
+  800c90:	68 e8 2e 80 00       	push   $0x802ee8
+  800c95:	e8 71 f4 ff ff       	call   80010b <_panic>
+
+00800c9a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c9a:	55                   	push   %ebp
+  800c9b:	89 e5                	mov    %esp,%ebp
+  800c9d:	57                   	push   %edi
+  800c9e:	56                   	push   %esi
+  800c9f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ca0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ca7:	74 19                	je     800cc2 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800ca9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cae:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cb3:	89 d1                	mov    %edx,%ecx
+  800cb5:	89 d3                	mov    %edx,%ebx
+  800cb7:	89 d7                	mov    %edx,%edi
+  800cb9:	89 d6                	mov    %edx,%esi
+  800cbb:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ccc:	89 d1                	mov    %edx,%ecx
+  800cce:	89 d3                	mov    %edx,%ebx
+  800cd0:	89 d7                	mov    %edx,%edi
+  800cd2:	55                   	push   %ebp
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	8d 35 dd 0c 80 00    	lea    0x800cdd,%esi
+  800cdb:	0f 34                	sysenter
+  800cdd:	5d                   	pop    %ebp
+		goto out;
+  800cde:	eb dd                	jmp    800cbd <sys_getenvid+0x23>
+
+00800ce0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ce6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ced:	74 19                	je     800d08 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf9:	89 d1                	mov    %edx,%ecx
+  800cfb:	89 d3                	mov    %edx,%ebx
+  800cfd:	89 d7                	mov    %edx,%edi
+  800cff:	89 d6                	mov    %edx,%esi
+  800d01:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d03:	5b                   	pop    %ebx
+  800d04:	5e                   	pop    %esi
+  800d05:	5f                   	pop    %edi
+  800d06:	5d                   	pop    %ebp
+  800d07:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d0d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d12:	89 d1                	mov    %edx,%ecx
+  800d14:	89 d3                	mov    %edx,%ebx
+  800d16:	89 d7                	mov    %edx,%edi
+  800d18:	55                   	push   %ebp
+  800d19:	89 e5                	mov    %esp,%ebp
+  800d1b:	8d 35 23 0d 80 00    	lea    0x800d23,%esi
+  800d21:	0f 34                	sysenter
+  800d23:	5d                   	pop    %ebp
+		goto out;
+  800d24:	eb dd                	jmp    800d03 <sys_yield+0x23>
+
+00800d26 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d2f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d36:	74 23                	je     800d5b <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d38:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4b:	89 f7                	mov    %esi,%edi
+  800d4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d4f:	85 c0                	test   %eax,%eax
+  800d51:	7f 29                	jg     800d7c <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d56:	5b                   	pop    %ebx
+  800d57:	5e                   	pop    %esi
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d61:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d66:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	8d 35 79 0d 80 00    	lea    0x800d79,%esi
+  800d77:	0f 34                	sysenter
+  800d79:	5d                   	pop    %ebp
+		goto out;
+  800d7a:	eb d3                	jmp    800d4f <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7c:	83 ec 0c             	sub    $0xc,%esp
+  800d7f:	50                   	push   %eax
+  800d80:	6a 04                	push   $0x4
+  800d82:	68 cb 2e 80 00       	push   $0x802ecb
+  800d87:	6a 3f                	push   $0x3f
+  800d89:	68 e8 2e 80 00       	push   $0x802ee8
+  800d8e:	e8 78 f3 ff ff       	call   80010b <_panic>
+
+00800d93 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d93:	55                   	push   %ebp
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	57                   	push   %edi
+  800d97:	56                   	push   %esi
+  800d98:	53                   	push   %ebx
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+  800d9c:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800d9f:	85 f6                	test   %esi,%esi
+  800da1:	75 09                	jne    800dac <sys_page_map+0x19>
+  800da3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800daa:	74 1f                	je     800dcb <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800dac:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dbd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	7f 27                	jg     800dea <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5f                   	pop    %edi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd1:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ddc:	55                   	push   %ebp
+  800ddd:	89 e5                	mov    %esp,%ebp
+  800ddf:	8d 35 e7 0d 80 00    	lea    0x800de7,%esi
+  800de5:	0f 34                	sysenter
+  800de7:	5d                   	pop    %ebp
+		goto out;
+  800de8:	eb d5                	jmp    800dbf <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+  800ded:	50                   	push   %eax
+  800dee:	6a 05                	push   $0x5
+  800df0:	68 cb 2e 80 00       	push   $0x802ecb
+  800df5:	6a 3f                	push   $0x3f
+  800df7:	68 e8 2e 80 00       	push   $0x802ee8
+  800dfc:	e8 0a f3 ff ff       	call   80010b <_panic>
+
+00800e01 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e0a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e11:	74 22                	je     800e35 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e18:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	89 df                	mov    %ebx,%edi
+  800e25:	89 de                	mov    %ebx,%esi
+  800e27:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e29:	85 c0                	test   %eax,%eax
+  800e2b:	7f 28                	jg     800e55 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e30:	5b                   	pop    %ebx
+  800e31:	5e                   	pop    %esi
+  800e32:	5f                   	pop    %edi
+  800e33:	5d                   	pop    %ebp
+  800e34:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e45:	89 df                	mov    %ebx,%edi
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	8d 35 52 0e 80 00    	lea    0x800e52,%esi
+  800e50:	0f 34                	sysenter
+  800e52:	5d                   	pop    %ebp
+		goto out;
+  800e53:	eb d4                	jmp    800e29 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e55:	83 ec 0c             	sub    $0xc,%esp
+  800e58:	50                   	push   %eax
+  800e59:	6a 06                	push   $0x6
+  800e5b:	68 cb 2e 80 00       	push   $0x802ecb
+  800e60:	6a 3f                	push   $0x3f
+  800e62:	68 e8 2e 80 00       	push   $0x802ee8
+  800e67:	e8 9f f2 ff ff       	call   80010b <_panic>
+
+00800e6c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e6c:	55                   	push   %ebp
+  800e6d:	89 e5                	mov    %esp,%ebp
+  800e6f:	57                   	push   %edi
+  800e70:	56                   	push   %esi
+  800e71:	53                   	push   %ebx
+  800e72:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e75:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e7c:	74 22                	je     800ea0 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e83:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8e:	89 df                	mov    %ebx,%edi
+  800e90:	89 de                	mov    %ebx,%esi
+  800e92:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e94:	85 c0                	test   %eax,%eax
+  800e96:	7f 28                	jg     800ec0 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9b:	5b                   	pop    %ebx
+  800e9c:	5e                   	pop    %esi
+  800e9d:	5f                   	pop    %edi
+  800e9e:	5d                   	pop    %ebp
+  800e9f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eab:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eb0:	89 df                	mov    %ebx,%edi
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	8d 35 bd 0e 80 00    	lea    0x800ebd,%esi
+  800ebb:	0f 34                	sysenter
+  800ebd:	5d                   	pop    %ebp
+		goto out;
+  800ebe:	eb d4                	jmp    800e94 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec0:	83 ec 0c             	sub    $0xc,%esp
+  800ec3:	50                   	push   %eax
+  800ec4:	6a 08                	push   $0x8
+  800ec6:	68 cb 2e 80 00       	push   $0x802ecb
+  800ecb:	6a 3f                	push   $0x3f
+  800ecd:	68 e8 2e 80 00       	push   $0x802ee8
+  800ed2:	e8 34 f2 ff ff       	call   80010b <_panic>
+
+00800ed7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	57                   	push   %edi
+  800edb:	56                   	push   %esi
+  800edc:	53                   	push   %ebx
+  800edd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ee0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ee7:	74 22                	je     800f0b <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ee9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eee:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ef3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef9:	89 df                	mov    %ebx,%edi
+  800efb:	89 de                	mov    %ebx,%esi
+  800efd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eff:	85 c0                	test   %eax,%eax
+  800f01:	7f 28                	jg     800f2b <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f06:	5b                   	pop    %ebx
+  800f07:	5e                   	pop    %esi
+  800f08:	5f                   	pop    %edi
+  800f09:	5d                   	pop    %ebp
+  800f0a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f16:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f1b:	89 df                	mov    %ebx,%edi
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	8d 35 28 0f 80 00    	lea    0x800f28,%esi
+  800f26:	0f 34                	sysenter
+  800f28:	5d                   	pop    %ebp
+		goto out;
+  800f29:	eb d4                	jmp    800eff <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2b:	83 ec 0c             	sub    $0xc,%esp
+  800f2e:	50                   	push   %eax
+  800f2f:	6a 09                	push   $0x9
+  800f31:	68 cb 2e 80 00       	push   $0x802ecb
+  800f36:	6a 3f                	push   $0x3f
+  800f38:	68 e8 2e 80 00       	push   $0x802ee8
+  800f3d:	e8 c9 f1 ff ff       	call   80010b <_panic>
+
+00800f42 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	57                   	push   %edi
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+  800f48:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f4b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f52:	74 22                	je     800f76 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f59:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f64:	89 df                	mov    %ebx,%edi
+  800f66:	89 de                	mov    %ebx,%esi
+  800f68:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6a:	85 c0                	test   %eax,%eax
+  800f6c:	7f 28                	jg     800f96 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5f                   	pop    %edi
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f81:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f86:	89 df                	mov    %ebx,%edi
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	8d 35 93 0f 80 00    	lea    0x800f93,%esi
+  800f91:	0f 34                	sysenter
+  800f93:	5d                   	pop    %ebp
+		goto out;
+  800f94:	eb d4                	jmp    800f6a <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f96:	83 ec 0c             	sub    $0xc,%esp
+  800f99:	50                   	push   %eax
+  800f9a:	6a 0a                	push   $0xa
+  800f9c:	68 cb 2e 80 00       	push   $0x802ecb
+  800fa1:	6a 3f                	push   $0x3f
+  800fa3:	68 e8 2e 80 00       	push   $0x802ee8
+  800fa8:	e8 5e f1 ff ff       	call   80010b <_panic>
+
+00800fad <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  800fb3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fb6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fbd:	74 22                	je     800fe1 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc4:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcf:	89 df                	mov    %ebx,%edi
+  800fd1:	89 de                	mov    %ebx,%esi
+  800fd3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd5:	85 c0                	test   %eax,%eax
+  800fd7:	7f 28                	jg     801001 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdc:	5b                   	pop    %ebx
+  800fdd:	5e                   	pop    %esi
+  800fde:	5f                   	pop    %edi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fe1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fec:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ff1:	89 df                	mov    %ebx,%edi
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	8d 35 fe 0f 80 00    	lea    0x800ffe,%esi
+  800ffc:	0f 34                	sysenter
+  800ffe:	5d                   	pop    %ebp
+		goto out;
+  800fff:	eb d4                	jmp    800fd5 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801001:	83 ec 0c             	sub    $0xc,%esp
+  801004:	50                   	push   %eax
+  801005:	6a 17                	push   $0x17
+  801007:	68 cb 2e 80 00       	push   $0x802ecb
+  80100c:	6a 3f                	push   $0x3f
+  80100e:	68 e8 2e 80 00       	push   $0x802ee8
+  801013:	e8 f3 f0 ff ff       	call   80010b <_panic>
+
+00801018 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	57                   	push   %edi
+  80101c:	56                   	push   %esi
+  80101d:	53                   	push   %ebx
+  80101e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801021:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801028:	74 22                	je     80104c <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80102a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801034:	8b 55 08             	mov    0x8(%ebp),%edx
+  801037:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103a:	89 df                	mov    %ebx,%edi
+  80103c:	89 de                	mov    %ebx,%esi
+  80103e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801040:	85 c0                	test   %eax,%eax
+  801042:	7f 28                	jg     80106c <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801044:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801047:	5b                   	pop    %ebx
+  801048:	5e                   	pop    %esi
+  801049:	5f                   	pop    %edi
+  80104a:	5d                   	pop    %ebp
+  80104b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80104c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801051:	8b 55 08             	mov    0x8(%ebp),%edx
+  801054:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801057:	b8 18 00 00 00       	mov    $0x18,%eax
+  80105c:	89 df                	mov    %ebx,%edi
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	8d 35 69 10 80 00    	lea    0x801069,%esi
+  801067:	0f 34                	sysenter
+  801069:	5d                   	pop    %ebp
+		goto out;
+  80106a:	eb d4                	jmp    801040 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106c:	83 ec 0c             	sub    $0xc,%esp
+  80106f:	50                   	push   %eax
+  801070:	6a 18                	push   $0x18
+  801072:	68 cb 2e 80 00       	push   $0x802ecb
+  801077:	6a 3f                	push   $0x3f
+  801079:	68 e8 2e 80 00       	push   $0x802ee8
+  80107e:	e8 88 f0 ff ff       	call   80010b <_panic>
+
+00801083 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	56                   	push   %esi
+  801088:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801089:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801090:	74 1d                	je     8010af <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801092:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801097:	be 00 00 00 00       	mov    $0x0,%esi
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	8d 35 cb 10 80 00    	lea    0x8010cb,%esi
+  8010c9:	0f 34                	sysenter
+  8010cb:	5d                   	pop    %ebp
+		goto out;
+  8010cc:	eb dc                	jmp    8010aa <sys_ipc_try_send+0x27>
+
+008010ce <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	57                   	push   %edi
+  8010d2:	56                   	push   %esi
+  8010d3:	53                   	push   %ebx
+  8010d4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010d7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010de:	74 21                	je     801101 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ed:	89 cb                	mov    %ecx,%ebx
+  8010ef:	89 cf                	mov    %ecx,%edi
+  8010f1:	89 ce                	mov    %ecx,%esi
+  8010f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	7f 27                	jg     801120 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5e                   	pop    %esi
+  8010fe:	5f                   	pop    %edi
+  8010ff:	5d                   	pop    %ebp
+  801100:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801101:	8b 55 08             	mov    0x8(%ebp),%edx
+  801104:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801109:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80110e:	89 cb                	mov    %ecx,%ebx
+  801110:	89 cf                	mov    %ecx,%edi
+  801112:	55                   	push   %ebp
+  801113:	89 e5                	mov    %esp,%ebp
+  801115:	8d 35 1d 11 80 00    	lea    0x80111d,%esi
+  80111b:	0f 34                	sysenter
+  80111d:	5d                   	pop    %ebp
+		goto out;
+  80111e:	eb d5                	jmp    8010f5 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801120:	83 ec 0c             	sub    $0xc,%esp
+  801123:	50                   	push   %eax
+  801124:	6a 0d                	push   $0xd
+  801126:	68 cb 2e 80 00       	push   $0x802ecb
+  80112b:	6a 3f                	push   $0x3f
+  80112d:	68 e8 2e 80 00       	push   $0x802ee8
+  801132:	e8 d4 ef ff ff       	call   80010b <_panic>
+
+00801137 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	56                   	push   %esi
+  80113c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80113d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801144:	74 1b                	je     801161 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801146:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801150:	8b 55 08             	mov    0x8(%ebp),%edx
+  801153:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801156:	89 df                	mov    %ebx,%edi
+  801158:	89 de                	mov    %ebx,%esi
+  80115a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80115c:	5b                   	pop    %ebx
+  80115d:	5e                   	pop    %esi
+  80115e:	5f                   	pop    %edi
+  80115f:	5d                   	pop    %ebp
+  801160:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801161:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801166:	8b 55 08             	mov    0x8(%ebp),%edx
+  801169:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801171:	89 df                	mov    %ebx,%edi
+  801173:	55                   	push   %ebp
+  801174:	89 e5                	mov    %esp,%ebp
+  801176:	8d 35 7e 11 80 00    	lea    0x80117e,%esi
+  80117c:	0f 34                	sysenter
+  80117e:	5d                   	pop    %ebp
+		goto out;
+  80117f:	eb db                	jmp    80115c <sys_ipc_recv_until+0x25>
+
+00801181 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801181:	55                   	push   %ebp
+  801182:	89 e5                	mov    %esp,%ebp
+  801184:	57                   	push   %edi
+  801185:	56                   	push   %esi
+  801186:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801187:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80118e:	74 19                	je     8011a9 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801190:	ba 00 00 00 00       	mov    $0x0,%edx
+  801195:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80119a:	89 d1                	mov    %edx,%ecx
+  80119c:	89 d3                	mov    %edx,%ebx
+  80119e:	89 d7                	mov    %edx,%edi
+  8011a0:	89 d6                	mov    %edx,%esi
+  8011a2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ae:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011b3:	89 d1                	mov    %edx,%ecx
+  8011b5:	89 d3                	mov    %edx,%ebx
+  8011b7:	89 d7                	mov    %edx,%edi
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	8d 35 c4 11 80 00    	lea    0x8011c4,%esi
+  8011c2:	0f 34                	sysenter
+  8011c4:	5d                   	pop    %ebp
+		goto out;
+  8011c5:	eb dd                	jmp    8011a4 <sys_time_msec+0x23>
+
+008011c7 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	57                   	push   %edi
+  8011cb:	56                   	push   %esi
+  8011cc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011cd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011d4:	74 1a                	je     8011f0 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011db:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e3:	89 cb                	mov    %ecx,%ebx
+  8011e5:	89 cf                	mov    %ecx,%edi
+  8011e7:	89 ce                	mov    %ecx,%esi
+  8011e9:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011eb:	5b                   	pop    %ebx
+  8011ec:	5e                   	pop    %esi
+  8011ed:	5f                   	pop    %edi
+  8011ee:	5d                   	pop    %ebp
+  8011ef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011fd:	89 cb                	mov    %ecx,%ebx
+  8011ff:	89 cf                	mov    %ecx,%edi
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	8d 35 0c 12 80 00    	lea    0x80120c,%esi
+  80120a:	0f 34                	sysenter
+  80120c:	5d                   	pop    %ebp
+		goto out;
+  80120d:	eb dc                	jmp    8011eb <sys_sleep_until+0x24>
+
+0080120f <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	57                   	push   %edi
+  801213:	56                   	push   %esi
+  801214:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801215:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80121c:	74 1a                	je     801238 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80121e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801223:	b8 11 00 00 00       	mov    $0x11,%eax
+  801228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122b:	89 cb                	mov    %ecx,%ebx
+  80122d:	89 cf                	mov    %ecx,%edi
+  80122f:	89 ce                	mov    %ecx,%esi
+  801231:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801233:	5b                   	pop    %ebx
+  801234:	5e                   	pop    %esi
+  801235:	5f                   	pop    %edi
+  801236:	5d                   	pop    %ebp
+  801237:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801238:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801240:	b8 11 00 00 00       	mov    $0x11,%eax
+  801245:	89 cb                	mov    %ecx,%ebx
+  801247:	89 cf                	mov    %ecx,%edi
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	8d 35 54 12 80 00    	lea    0x801254,%esi
+  801252:	0f 34                	sysenter
+  801254:	5d                   	pop    %ebp
+		goto out;
+  801255:	eb dc                	jmp    801233 <sys_env_print_stats+0x24>
+
+00801257 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	57                   	push   %edi
+  80125b:	56                   	push   %esi
+  80125c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80125d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801264:	74 1b                	je     801281 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801266:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801270:	8b 55 08             	mov    0x8(%ebp),%edx
+  801273:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801276:	89 df                	mov    %ebx,%edi
+  801278:	89 de                	mov    %ebx,%esi
+  80127a:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80127c:	5b                   	pop    %ebx
+  80127d:	5e                   	pop    %esi
+  80127e:	5f                   	pop    %edi
+  80127f:	5d                   	pop    %ebp
+  801280:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801281:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801286:	8b 55 08             	mov    0x8(%ebp),%edx
+  801289:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801291:	89 df                	mov    %ebx,%edi
+  801293:	55                   	push   %ebp
+  801294:	89 e5                	mov    %esp,%ebp
+  801296:	8d 35 9e 12 80 00    	lea    0x80129e,%esi
+  80129c:	0f 34                	sysenter
+  80129e:	5d                   	pop    %ebp
+		goto out;
+  80129f:	eb db                	jmp    80127c <sys_perf+0x25>
+
+008012a1 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	57                   	push   %edi
+  8012a5:	56                   	push   %esi
+  8012a6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012a7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012ae:	74 19                	je     8012c9 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012ba:	89 d1                	mov    %edx,%ecx
+  8012bc:	89 d3                	mov    %edx,%ebx
+  8012be:	89 d7                	mov    %edx,%edi
+  8012c0:	89 d6                	mov    %edx,%esi
+  8012c2:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012c4:	5b                   	pop    %ebx
+  8012c5:	5e                   	pop    %esi
+  8012c6:	5f                   	pop    %edi
+  8012c7:	5d                   	pop    %ebp
+  8012c8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ce:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012d3:	89 d1                	mov    %edx,%ecx
+  8012d5:	89 d3                	mov    %edx,%ebx
+  8012d7:	89 d7                	mov    %edx,%edi
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	8d 35 e4 12 80 00    	lea    0x8012e4,%esi
+  8012e2:	0f 34                	sysenter
+  8012e4:	5d                   	pop    %ebp
+		goto out;
+  8012e5:	eb dd                	jmp    8012c4 <sys_fork+0x23>
+
+008012e7 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	57                   	push   %edi
+  8012eb:	56                   	push   %esi
+  8012ec:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012ed:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012f4:	74 1c                	je     801312 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8012f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801300:	8b 55 08             	mov    0x8(%ebp),%edx
+  801303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801306:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801309:	89 f7                	mov    %esi,%edi
+  80130b:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80130d:	5b                   	pop    %ebx
+  80130e:	5e                   	pop    %esi
+  80130f:	5f                   	pop    %edi
+  801310:	5d                   	pop    %ebp
+  801311:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801312:	8b 55 08             	mov    0x8(%ebp),%edx
+  801315:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801318:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80131d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801322:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801325:	55                   	push   %ebp
+  801326:	89 e5                	mov    %esp,%ebp
+  801328:	8d 35 30 13 80 00    	lea    0x801330,%esi
+  80132e:	0f 34                	sysenter
+  801330:	5d                   	pop    %ebp
+		goto out;
+  801331:	eb da                	jmp    80130d <sys_thread_create+0x26>
+
+00801333 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801333:	55                   	push   %ebp
+  801334:	89 e5                	mov    %esp,%ebp
+  801336:	57                   	push   %edi
+  801337:	56                   	push   %esi
+  801338:	53                   	push   %ebx
+  801339:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80133c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801343:	74 24                	je     801369 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801345:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80134a:	be 00 00 00 00       	mov    $0x0,%esi
+  80134f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801352:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801355:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801358:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80135b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	7f 27                	jg     801388 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801369:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801374:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801377:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	8d 35 85 13 80 00    	lea    0x801385,%esi
+  801383:	0f 34                	sysenter
+  801385:	5d                   	pop    %ebp
+		goto out;
+  801386:	eb d5                	jmp    80135d <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801388:	83 ec 0c             	sub    $0xc,%esp
+  80138b:	50                   	push   %eax
+  80138c:	6a 1f                	push   $0x1f
+  80138e:	68 cb 2e 80 00       	push   $0x802ecb
+  801393:	6a 3f                	push   $0x3f
+  801395:	68 e8 2e 80 00       	push   $0x802ee8
+  80139a:	e8 6c ed ff ff       	call   80010b <_panic>
+
+0080139f <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+  8013a2:	57                   	push   %edi
+  8013a3:	56                   	push   %esi
+  8013a4:	53                   	push   %ebx
+  8013a5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013a8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013af:	74 23                	je     8013d4 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b6:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c4:	89 f7                	mov    %esi,%edi
+  8013c6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013c8:	85 c0                	test   %eax,%eax
+  8013ca:	7f 29                	jg     8013f5 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013cf:	5b                   	pop    %ebx
+  8013d0:	5e                   	pop    %esi
+  8013d1:	5f                   	pop    %edi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013da:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	8d 35 f2 13 80 00    	lea    0x8013f2,%esi
+  8013f0:	0f 34                	sysenter
+  8013f2:	5d                   	pop    %ebp
+		goto out;
+  8013f3:	eb d3                	jmp    8013c8 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f5:	83 ec 0c             	sub    $0xc,%esp
+  8013f8:	50                   	push   %eax
+  8013f9:	6a 20                	push   $0x20
+  8013fb:	68 cb 2e 80 00       	push   $0x802ecb
+  801400:	6a 3f                	push   $0x3f
+  801402:	68 e8 2e 80 00       	push   $0x802ee8
+  801407:	e8 ff ec ff ff       	call   80010b <_panic>
+
+0080140c <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80140c:	55                   	push   %ebp
+  80140d:	89 e5                	mov    %esp,%ebp
+  80140f:	57                   	push   %edi
+  801410:	56                   	push   %esi
+  801411:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801412:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801419:	74 1b                	je     801436 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80141b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801420:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801425:	8b 55 08             	mov    0x8(%ebp),%edx
+  801428:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142b:	89 df                	mov    %ebx,%edi
+  80142d:	89 de                	mov    %ebx,%esi
+  80142f:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801431:	5b                   	pop    %ebx
+  801432:	5e                   	pop    %esi
+  801433:	5f                   	pop    %edi
+  801434:	5d                   	pop    %ebp
+  801435:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801436:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801441:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801446:	89 df                	mov    %ebx,%edi
+  801448:	55                   	push   %ebp
+  801449:	89 e5                	mov    %esp,%ebp
+  80144b:	8d 35 53 14 80 00    	lea    0x801453,%esi
+  801451:	0f 34                	sysenter
+  801453:	5d                   	pop    %ebp
+		goto out;
+  801454:	eb db                	jmp    801431 <sys_batch+0x25>
+
+00801456 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801456:	55                   	push   %ebp
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	57                   	push   %edi
+  80145a:	56                   	push   %esi
+  80145b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80145c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801463:	74 1a                	je     80147f <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801465:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80146f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801472:	89 cb                	mov    %ecx,%ebx
+  801474:	89 cf                	mov    %ecx,%edi
+  801476:	89 ce                	mov    %ecx,%esi
+  801478:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80147a:	5b                   	pop    %ebx
+  80147b:	5e                   	pop    %esi
+  80147c:	5f                   	pop    %edi
+  80147d:	5d                   	pop    %ebp
+  80147e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80147f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801482:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801487:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80148c:	89 cb                	mov    %ecx,%ebx
+  80148e:	89 cf                	mov    %ecx,%edi
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	8d 35 9b 14 80 00    	lea    0x80149b,%esi
+  801499:	0f 34                	sysenter
+  80149b:	5d                   	pop    %ebp
+		goto out;
+  80149c:	eb dc                	jmp    80147a <sys_trace_ctl+0x24>
+
+0080149e <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	57                   	push   %edi
+  8014a2:	56                   	push   %esi
+  8014a3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014a4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ab:	74 1c                	je     8014c9 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c0:	89 f7                	mov    %esi,%edi
+  8014c2:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014c4:	5b                   	pop    %ebx
+  8014c5:	5e                   	pop    %esi
+  8014c6:	5f                   	pop    %edi
+  8014c7:	5d                   	pop    %ebp
+  8014c8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014dc:	55                   	push   %ebp
+  8014dd:	89 e5                	mov    %esp,%ebp
+  8014df:	8d 35 e7 14 80 00    	lea    0x8014e7,%esi
+  8014e5:	0f 34                	sysenter
+  8014e7:	5d                   	pop    %ebp
+		goto out;
+  8014e8:	eb da                	jmp    8014c4 <sys_trace_read+0x26>
+
+008014ea <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014ea:	55                   	push   %ebp
+  8014eb:	89 e5                	mov    %esp,%ebp
+  8014ed:	57                   	push   %edi
+  8014ee:	56                   	push   %esi
+  8014ef:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014f0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014f7:	74 1c                	je     801515 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8014f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fe:	b8 21 00 00 00       	mov    $0x21,%eax
+  801503:	8b 55 08             	mov    0x8(%ebp),%edx
+  801506:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801509:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80150c:	89 f7                	mov    %esi,%edi
+  80150e:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801510:	5b                   	pop    %ebx
+  801511:	5e                   	pop    %esi
+  801512:	5f                   	pop    %edi
+  801513:	5d                   	pop    %ebp
+  801514:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801515:	8b 55 08             	mov    0x8(%ebp),%edx
+  801518:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801520:	bf 00 00 00 00       	mov    $0x0,%edi
+  801525:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801528:	55                   	push   %ebp
+  801529:	89 e5                	mov    %esp,%ebp
+  80152b:	8d 35 33 15 80 00    	lea    0x801533,%esi
+  801531:	0f 34                	sysenter
+  801533:	5d                   	pop    %ebp
+		goto out;
+  801534:	eb da                	jmp    801510 <sys_meminfo+0x26>
+
+00801536 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801536:	55                   	push   %ebp
+  801537:	89 e5                	mov    %esp,%ebp
+  801539:	57                   	push   %edi
+  80153a:	56                   	push   %esi
+  80153b:	53                   	push   %ebx
+  80153c:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80153f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801543:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80154a:	74 1f                	je     80156b <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80154c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801551:	b8 22 00 00 00       	mov    $0x22,%eax
+  801556:	8b 55 08             	mov    0x8(%ebp),%edx
+  801559:	89 df                	mov    %ebx,%edi
+  80155b:	89 de                	mov    %ebx,%esi
+  80155d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	7f 25                	jg     801588 <sys_env_set_ksm+0x52>
+}
+  801563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801566:	5b                   	pop    %ebx
+  801567:	5e                   	pop    %esi
+  801568:	5f                   	pop    %edi
+  801569:	5d                   	pop    %ebp
+  80156a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80156b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801570:	8b 55 08             	mov    0x8(%ebp),%edx
+  801573:	b8 22 00 00 00       	mov    $0x22,%eax
+  801578:	89 df                	mov    %ebx,%edi
+  80157a:	55                   	push   %ebp
+  80157b:	89 e5                	mov    %esp,%ebp
+  80157d:	8d 35 85 15 80 00    	lea    0x801585,%esi
+  801583:	0f 34                	sysenter
+  801585:	5d                   	pop    %ebp
+		goto out;
+  801586:	eb d7                	jmp    80155f <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801588:	83 ec 0c             	sub    $0xc,%esp
+  80158b:	50                   	push   %eax
+  80158c:	6a 22                	push   $0x22
+  80158e:	68 cb 2e 80 00       	push   $0x802ecb
+  801593:	6a 3f                	push   $0x3f
+  801595:	68 e8 2e 80 00       	push   $0x802ee8
+  80159a:	e8 6c eb ff ff       	call   80010b <_panic>
+
+0080159f <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80159f:	55                   	push   %ebp
+  8015a0:	89 e5                	mov    %esp,%ebp
+  8015a2:	57                   	push   %edi
+  8015a3:	56                   	push   %esi
+  8015a4:	53                   	push   %ebx
+  8015a5:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015a8:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015ab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015b2:	74 24                	je     8015d8 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015be:	89 cb                	mov    %ecx,%ebx
+  8015c0:	89 cf                	mov    %ecx,%edi
+  8015c2:	89 ce                	mov    %ecx,%esi
+  8015c4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015c6:	85 c0                	test   %eax,%eax
+  8015c8:	7f 2a                	jg     8015f4 <sys_time_nsec+0x55>
+	return ns;
+}
+  8015ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015cd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d3:	5b                   	pop    %ebx
+  8015d4:	5e                   	pop    %esi
+  8015d5:	5f                   	pop    %edi
+  8015d6:	5d                   	pop    %ebp
+  8015d7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015e2:	89 cb                	mov    %ecx,%ebx
+  8015e4:	89 cf                	mov    %ecx,%edi
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	8d 35 f1 15 80 00    	lea    0x8015f1,%esi
+  8015ef:	0f 34                	sysenter
+  8015f1:	5d                   	pop    %ebp
+		goto out;
+  8015f2:	eb d2                	jmp    8015c6 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015f4:	83 ec 0c             	sub    $0xc,%esp
+  8015f7:	50                   	push   %eax
+  8015f8:	6a 0f                	push   $0xf
+  8015fa:	68 cb 2e 80 00       	push   $0x802ecb
+  8015ff:	6a 3f                	push   $0x3f
+  801601:	68 e8 2e 80 00       	push   $0x802ee8
+  801606:	e8 00 eb ff ff       	call   80010b <_panic>
+
+0080160b <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	57                   	push   %edi
+  80160f:	56                   	push   %esi
+  801610:	53                   	push   %ebx
+  801611:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801614:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80161b:	74 22                	je     80163f <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80161d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801622:	b8 12 00 00 00       	mov    $0x12,%eax
+  801627:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80162d:	89 df                	mov    %ebx,%edi
+  80162f:	89 de                	mov    %ebx,%esi
+  801631:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801633:	85 c0                	test   %eax,%eax
+  801635:	7f 28                	jg     80165f <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801637:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163a:	5b                   	pop    %ebx
+  80163b:	5e                   	pop    %esi
+  80163c:	5f                   	pop    %edi
+  80163d:	5d                   	pop    %ebp
+  80163e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80163f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801644:	8b 55 08             	mov    0x8(%ebp),%edx
+  801647:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80164f:	89 df                	mov    %ebx,%edi
+  801651:	55                   	push   %ebp
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	8d 35 5c 16 80 00    	lea    0x80165c,%esi
+  80165a:	0f 34                	sysenter
+  80165c:	5d                   	pop    %ebp
+		goto out;
+  80165d:	eb d4                	jmp    801633 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80165f:	83 ec 0c             	sub    $0xc,%esp
+  801662:	50                   	push   %eax
+  801663:	6a 12                	push   $0x12
+  801665:	68 cb 2e 80 00       	push   $0x802ecb
+  80166a:	6a 3f                	push   $0x3f
+  80166c:	68 e8 2e 80 00       	push   $0x802ee8
+  801671:	e8 95 ea ff ff       	call   80010b <_panic>
+
+00801676 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801676:	55                   	push   %ebp
+  801677:	89 e5                	mov    %esp,%ebp
+  801679:	57                   	push   %edi
+  80167a:	56                   	push   %esi
+  80167b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80167c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801683:	74 1b                	je     8016a0 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801685:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80168f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801692:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801695:	89 df                	mov    %ebx,%edi
+  801697:	89 de                	mov    %ebx,%esi
+  801699:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80169b:	5b                   	pop    %ebx
+  80169c:	5e                   	pop    %esi
+  80169d:	5f                   	pop    %edi
+  80169e:	5d                   	pop    %ebp
+  80169f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ab:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016b0:	89 df                	mov    %ebx,%edi
+  8016b2:	55                   	push   %ebp
+  8016b3:	89 e5                	mov    %esp,%ebp
+  8016b5:	8d 35 bd 16 80 00    	lea    0x8016bd,%esi
+  8016bb:	0f 34                	sysenter
+  8016bd:	5d                   	pop    %ebp
+		goto out;
+  8016be:	eb db                	jmp    80169b <sys_e1000_receive+0x25>
+
+008016c0 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016c0:	55                   	push   %ebp
+  8016c1:	89 e5                	mov    %esp,%ebp
+  8016c3:	57                   	push   %edi
+  8016c4:	56                   	push   %esi
+  8016c5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016c6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016cd:	74 1b                	je     8016ea <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016df:	89 df                	mov    %ebx,%edi
+  8016e1:	89 de                	mov    %ebx,%esi
+  8016e3:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016e5:	5b                   	pop    %ebx
+  8016e6:	5e                   	pop    %esi
+  8016e7:	5f                   	pop    %edi
+  8016e8:	5d                   	pop    %ebp
+  8016e9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f5:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016fa:	89 df                	mov    %ebx,%edi
+  8016fc:	55                   	push   %ebp
+  8016fd:	89 e5                	mov    %esp,%ebp
+  8016ff:	8d 35 07 17 80 00    	lea    0x801707,%esi
+  801705:	0f 34                	sysenter
+  801707:	5d                   	pop    %ebp
+		goto out;
+  801708:	eb db                	jmp    8016e5 <sys_e1000_read_hwaddr+0x25>
+
+0080170a <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	57                   	push   %edi
+  80170e:	56                   	push   %esi
+  80170f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801710:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801717:	74 1a                	je     801733 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801719:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80171e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801723:	8b 55 08             	mov    0x8(%ebp),%edx
+  801726:	89 cb                	mov    %ecx,%ebx
+  801728:	89 cf                	mov    %ecx,%edi
+  80172a:	89 ce                	mov    %ecx,%esi
+  80172c:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80172e:	5b                   	pop    %ebx
+  80172f:	5e                   	pop    %esi
+  801730:	5f                   	pop    %edi
+  801731:	5d                   	pop    %ebp
+  801732:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801733:	8b 55 08             	mov    0x8(%ebp),%edx
+  801736:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801740:	89 cb                	mov    %ecx,%ebx
+  801742:	89 cf                	mov    %ecx,%edi
+  801744:	55                   	push   %ebp
+  801745:	89 e5                	mov    %esp,%ebp
+  801747:	8d 35 4f 17 80 00    	lea    0x80174f,%esi
+  80174d:	0f 34                	sysenter
+  80174f:	5d                   	pop    %ebp
+		goto out;
+  801750:	eb dc                	jmp    80172e <sys_sb16_read_version+0x24>
+
+00801752 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801752:	55                   	push   %ebp
+  801753:	89 e5                	mov    %esp,%ebp
+  801755:	57                   	push   %edi
+  801756:	56                   	push   %esi
+  801757:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801758:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80175f:	74 1b                	je     80177c <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801761:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801766:	b8 16 00 00 00       	mov    $0x16,%eax
+  80176b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801771:	89 df                	mov    %ebx,%edi
+  801773:	89 de                	mov    %ebx,%esi
+  801775:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801777:	5b                   	pop    %ebx
+  801778:	5e                   	pop    %esi
+  801779:	5f                   	pop    %edi
+  80177a:	5d                   	pop    %ebp
+  80177b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80177c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801781:	8b 55 08             	mov    0x8(%ebp),%edx
+  801784:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801787:	b8 16 00 00 00       	mov    $0x16,%eax
+  80178c:	89 df                	mov    %ebx,%edi
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	8d 35 99 17 80 00    	lea    0x801799,%esi
+  801797:	0f 34                	sysenter
+  801799:	5d                   	pop    %ebp
+		goto out;
+  80179a:	eb db                	jmp    801777 <sys_sb16_play+0x25>
+
+0080179c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80179c:	55                   	push   %ebp
+  80179d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80179f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a2:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017a7:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017aa:	5d                   	pop    %ebp
+  8017ab:	c3                   	ret
+
+008017ac <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b2:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017b7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017bc:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017c1:	5d                   	pop    %ebp
+  8017c2:	c3                   	ret
+
+008017c3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017c3:	55                   	push   %ebp
+  8017c4:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017c6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017cb:	eb 02                	jmp    8017cf <fd_alloc+0xc>
+  8017cd:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017cf:	89 c2                	mov    %eax,%edx
+  8017d1:	c1 ea 16             	shr    $0x16,%edx
+  8017d4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017db:	f6 c2 01             	test   $0x1,%dl
+  8017de:	74 2b                	je     80180b <fd_alloc+0x48>
+  8017e0:	89 c2                	mov    %eax,%edx
+  8017e2:	c1 ea 0c             	shr    $0xc,%edx
+  8017e5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017ec:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017f2:	f6 c1 01             	test   $0x1,%cl
+  8017f5:	74 14                	je     80180b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017f7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017fd:	75 ce                	jne    8017cd <fd_alloc+0xa>
+  8017ff:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801804:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801809:	eb 05                	jmp    801810 <fd_alloc+0x4d>
+			return 0;
+  80180b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801810:	8b 55 08             	mov    0x8(%ebp),%edx
+  801813:	89 02                	mov    %eax,(%edx)
+}
+  801815:	89 c8                	mov    %ecx,%eax
+  801817:	5d                   	pop    %ebp
+  801818:	c3                   	ret
+
+00801819 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80181f:	83 f8 1f             	cmp    $0x1f,%eax
+  801822:	77 30                	ja     801854 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801824:	c1 e0 0c             	shl    $0xc,%eax
+  801827:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80182c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801832:	f6 c2 01             	test   $0x1,%dl
+  801835:	74 24                	je     80185b <fd_lookup+0x42>
+  801837:	89 c2                	mov    %eax,%edx
+  801839:	c1 ea 0c             	shr    $0xc,%edx
+  80183c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801843:	f6 c2 01             	test   $0x1,%dl
+  801846:	74 1a                	je     801862 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801848:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80184b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80184d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801852:	5d                   	pop    %ebp
+  801853:	c3                   	ret
+		return -E_INVAL;
+  801854:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801859:	eb f7                	jmp    801852 <fd_lookup+0x39>
+		return -E_INVAL;
+  80185b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801860:	eb f0                	jmp    801852 <fd_lookup+0x39>
+  801862:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801867:	eb e9                	jmp    801852 <fd_lookup+0x39>
+
+00801869 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801869:	55                   	push   %ebp
+  80186a:	89 e5                	mov    %esp,%ebp
+  80186c:	53                   	push   %ebx
+  80186d:	83 ec 04             	sub    $0x4,%esp
+  801870:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801873:	b8 00 00 00 00       	mov    $0x0,%eax
+  801878:	eb 03                	jmp    80187d <dev_lookup+0x14>
+  80187a:	83 c0 01             	add    $0x1,%eax
+  80187d:	8b 1c 85 74 2f 80 00 	mov    0x802f74(,%eax,4),%ebx
+  801884:	85 db                	test   %ebx,%ebx
+  801886:	74 0b                	je     801893 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801888:	39 13                	cmp    %edx,(%ebx)
+  80188a:	75 ee                	jne    80187a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80188c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801891:	eb 2e                	jmp    8018c1 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801893:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801895:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80189a:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018a0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018a5:	76 24                	jbe    8018cb <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018a7:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018aa:	83 ec 04             	sub    $0x4,%esp
+  8018ad:	52                   	push   %edx
+  8018ae:	50                   	push   %eax
+  8018af:	68 f8 2e 80 00       	push   $0x802ef8
+  8018b4:	e8 2d e9 ff ff       	call   8001e6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018b9:	83 c4 10             	add    $0x10,%esp
+  8018bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018c4:	89 1a                	mov    %ebx,(%edx)
+}
+  8018c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018cb:	c1 e8 10             	shr    $0x10,%eax
+  8018ce:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018d4:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018da:	eb cb                	jmp    8018a7 <dev_lookup+0x3e>
+
+008018dc <fd_close>:
+{
+  8018dc:	55                   	push   %ebp
+  8018dd:	89 e5                	mov    %esp,%ebp
+  8018df:	57                   	push   %edi
+  8018e0:	56                   	push   %esi
+  8018e1:	53                   	push   %ebx
+  8018e2:	83 ec 24             	sub    $0x24,%esp
+  8018e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018e8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018eb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018ee:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018ef:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018f5:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018f8:	50                   	push   %eax
+  8018f9:	e8 1b ff ff ff       	call   801819 <fd_lookup>
+  8018fe:	89 c3                	mov    %eax,%ebx
+  801900:	83 c4 10             	add    $0x10,%esp
+  801903:	85 c0                	test   %eax,%eax
+  801905:	78 05                	js     80190c <fd_close+0x30>
+	    || fd != fd2)
+  801907:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80190a:	74 16                	je     801922 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80190c:	89 f8                	mov    %edi,%eax
+  80190e:	84 c0                	test   %al,%al
+  801910:	b8 00 00 00 00       	mov    $0x0,%eax
+  801915:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801918:	89 d8                	mov    %ebx,%eax
+  80191a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191d:	5b                   	pop    %ebx
+  80191e:	5e                   	pop    %esi
+  80191f:	5f                   	pop    %edi
+  801920:	5d                   	pop    %ebp
+  801921:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801922:	83 ec 08             	sub    $0x8,%esp
+  801925:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801928:	50                   	push   %eax
+  801929:	ff 36                	push   (%esi)
+  80192b:	e8 39 ff ff ff       	call   801869 <dev_lookup>
+  801930:	89 c3                	mov    %eax,%ebx
+  801932:	83 c4 10             	add    $0x10,%esp
+  801935:	85 c0                	test   %eax,%eax
+  801937:	78 1a                	js     801953 <fd_close+0x77>
+		if (dev->dev_close)
+  801939:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80193c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80193f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801944:	85 c0                	test   %eax,%eax
+  801946:	74 0b                	je     801953 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801948:	83 ec 0c             	sub    $0xc,%esp
+  80194b:	56                   	push   %esi
+  80194c:	ff d0                	call   *%eax
+  80194e:	89 c3                	mov    %eax,%ebx
+  801950:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801953:	83 ec 08             	sub    $0x8,%esp
+  801956:	56                   	push   %esi
+  801957:	6a 00                	push   $0x0
+  801959:	e8 a3 f4 ff ff       	call   800e01 <sys_page_unmap>
+	return r;
+  80195e:	83 c4 10             	add    $0x10,%esp
+  801961:	eb b5                	jmp    801918 <fd_close+0x3c>
+
+00801963 <close>:
+
+int
+close(int fdnum)
+{
+  801963:	55                   	push   %ebp
+  801964:	89 e5                	mov    %esp,%ebp
+  801966:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801969:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80196c:	50                   	push   %eax
+  80196d:	ff 75 08             	push   0x8(%ebp)
+  801970:	e8 a4 fe ff ff       	call   801819 <fd_lookup>
+  801975:	83 c4 10             	add    $0x10,%esp
+  801978:	85 c0                	test   %eax,%eax
+  80197a:	79 02                	jns    80197e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80197c:	c9                   	leave
+  80197d:	c3                   	ret
+		return fd_close(fd, 1);
+  80197e:	83 ec 08             	sub    $0x8,%esp
+  801981:	6a 01                	push   $0x1
+  801983:	ff 75 f4             	push   -0xc(%ebp)
+  801986:	e8 51 ff ff ff       	call   8018dc <fd_close>
+  80198b:	83 c4 10             	add    $0x10,%esp
+  80198e:	eb ec                	jmp    80197c <close+0x19>
+
+00801990 <close_all>:
+
+void
+close_all(void)
+{
+  801990:	55                   	push   %ebp
+  801991:	89 e5                	mov    %esp,%ebp
+  801993:	53                   	push   %ebx
+  801994:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801997:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80199c:	83 ec 0c             	sub    $0xc,%esp
+  80199f:	53                   	push   %ebx
+  8019a0:	e8 be ff ff ff       	call   801963 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019a5:	83 c3 01             	add    $0x1,%ebx
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	83 fb 20             	cmp    $0x20,%ebx
+  8019ae:	75 ec                	jne    80199c <close_all+0xc>
+}
+  8019b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b3:	c9                   	leave
+  8019b4:	c3                   	ret
+
+008019b5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019b5:	55                   	push   %ebp
+  8019b6:	89 e5                	mov    %esp,%ebp
+  8019b8:	57                   	push   %edi
+  8019b9:	56                   	push   %esi
+  8019ba:	53                   	push   %ebx
+  8019bb:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019be:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019c1:	50                   	push   %eax
+  8019c2:	ff 75 08             	push   0x8(%ebp)
+  8019c5:	e8 4f fe ff ff       	call   801819 <fd_lookup>
+  8019ca:	89 c3                	mov    %eax,%ebx
+  8019cc:	83 c4 10             	add    $0x10,%esp
+  8019cf:	85 c0                	test   %eax,%eax
+  8019d1:	78 7f                	js     801a52 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019d3:	83 ec 0c             	sub    $0xc,%esp
+  8019d6:	ff 75 0c             	push   0xc(%ebp)
+  8019d9:	e8 85 ff ff ff       	call   801963 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019de:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019e1:	c1 e6 0c             	shl    $0xc,%esi
+  8019e4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019ed:	89 3c 24             	mov    %edi,(%esp)
+  8019f0:	e8 b7 fd ff ff       	call   8017ac <fd2data>
+  8019f5:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019f7:	89 34 24             	mov    %esi,(%esp)
+  8019fa:	e8 ad fd ff ff       	call   8017ac <fd2data>
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a05:	89 d8                	mov    %ebx,%eax
+  801a07:	c1 e8 16             	shr    $0x16,%eax
+  801a0a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a11:	a8 01                	test   $0x1,%al
+  801a13:	74 11                	je     801a26 <dup+0x71>
+  801a15:	89 d8                	mov    %ebx,%eax
+  801a17:	c1 e8 0c             	shr    $0xc,%eax
+  801a1a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a21:	f6 c2 01             	test   $0x1,%dl
+  801a24:	75 36                	jne    801a5c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a26:	89 f8                	mov    %edi,%eax
+  801a28:	c1 e8 0c             	shr    $0xc,%eax
+  801a2b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a32:	83 ec 0c             	sub    $0xc,%esp
+  801a35:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a3a:	50                   	push   %eax
+  801a3b:	56                   	push   %esi
+  801a3c:	6a 00                	push   $0x0
+  801a3e:	57                   	push   %edi
+  801a3f:	6a 00                	push   $0x0
+  801a41:	e8 4d f3 ff ff       	call   800d93 <sys_page_map>
+  801a46:	89 c3                	mov    %eax,%ebx
+  801a48:	83 c4 20             	add    $0x20,%esp
+  801a4b:	85 c0                	test   %eax,%eax
+  801a4d:	78 33                	js     801a82 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a4f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a52:	89 d8                	mov    %ebx,%eax
+  801a54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a57:	5b                   	pop    %ebx
+  801a58:	5e                   	pop    %esi
+  801a59:	5f                   	pop    %edi
+  801a5a:	5d                   	pop    %ebp
+  801a5b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a5c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a63:	83 ec 0c             	sub    $0xc,%esp
+  801a66:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a6b:	50                   	push   %eax
+  801a6c:	ff 75 d4             	push   -0x2c(%ebp)
+  801a6f:	6a 00                	push   $0x0
+  801a71:	53                   	push   %ebx
+  801a72:	6a 00                	push   $0x0
+  801a74:	e8 1a f3 ff ff       	call   800d93 <sys_page_map>
+  801a79:	89 c3                	mov    %eax,%ebx
+  801a7b:	83 c4 20             	add    $0x20,%esp
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	79 a4                	jns    801a26 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a82:	83 ec 08             	sub    $0x8,%esp
+  801a85:	56                   	push   %esi
+  801a86:	6a 00                	push   $0x0
+  801a88:	e8 74 f3 ff ff       	call   800e01 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a8d:	83 c4 08             	add    $0x8,%esp
+  801a90:	ff 75 d4             	push   -0x2c(%ebp)
+  801a93:	6a 00                	push   $0x0
+  801a95:	e8 67 f3 ff ff       	call   800e01 <sys_page_unmap>
+	return r;
+  801a9a:	83 c4 10             	add    $0x10,%esp
+  801a9d:	eb b3                	jmp    801a52 <dup+0x9d>
+
+00801a9f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a9f:	55                   	push   %ebp
+  801aa0:	89 e5                	mov    %esp,%ebp
+  801aa2:	56                   	push   %esi
+  801aa3:	53                   	push   %ebx
+  801aa4:	83 ec 18             	sub    $0x18,%esp
+  801aa7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aaa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aad:	50                   	push   %eax
+  801aae:	53                   	push   %ebx
+  801aaf:	e8 65 fd ff ff       	call   801819 <fd_lookup>
+  801ab4:	83 c4 10             	add    $0x10,%esp
+  801ab7:	85 c0                	test   %eax,%eax
+  801ab9:	78 3c                	js     801af7 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801abb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801abe:	83 ec 08             	sub    $0x8,%esp
+  801ac1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac4:	50                   	push   %eax
+  801ac5:	ff 36                	push   (%esi)
+  801ac7:	e8 9d fd ff ff       	call   801869 <dev_lookup>
+  801acc:	83 c4 10             	add    $0x10,%esp
+  801acf:	85 c0                	test   %eax,%eax
+  801ad1:	78 24                	js     801af7 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ad3:	8b 46 08             	mov    0x8(%esi),%eax
+  801ad6:	83 e0 03             	and    $0x3,%eax
+  801ad9:	83 f8 01             	cmp    $0x1,%eax
+  801adc:	74 20                	je     801afe <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ade:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae1:	8b 40 08             	mov    0x8(%eax),%eax
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	74 57                	je     801b3f <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ae8:	83 ec 04             	sub    $0x4,%esp
+  801aeb:	ff 75 10             	push   0x10(%ebp)
+  801aee:	ff 75 0c             	push   0xc(%ebp)
+  801af1:	56                   	push   %esi
+  801af2:	ff d0                	call   *%eax
+  801af4:	83 c4 10             	add    $0x10,%esp
+}
+  801af7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afa:	5b                   	pop    %ebx
+  801afb:	5e                   	pop    %esi
+  801afc:	5d                   	pop    %ebp
+  801afd:	c3                   	ret
+  801afe:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b00:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b05:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b0b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b10:	76 1c                	jbe    801b2e <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b12:	8b 42 48             	mov    0x48(%edx),%eax
+  801b15:	83 ec 04             	sub    $0x4,%esp
+  801b18:	53                   	push   %ebx
+  801b19:	50                   	push   %eax
+  801b1a:	68 39 2f 80 00       	push   $0x802f39
+  801b1f:	e8 c2 e6 ff ff       	call   8001e6 <cprintf>
+		return -E_INVAL;
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2c:	eb c9                	jmp    801af7 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b2e:	c1 e8 10             	shr    $0x10,%eax
+  801b31:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b37:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b3d:	eb d3                	jmp    801b12 <read+0x73>
+		return -E_NOT_SUPP;
+  801b3f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b44:	eb b1                	jmp    801af7 <read+0x58>
+
+00801b46 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b46:	55                   	push   %ebp
+  801b47:	89 e5                	mov    %esp,%ebp
+  801b49:	57                   	push   %edi
+  801b4a:	56                   	push   %esi
+  801b4b:	53                   	push   %ebx
+  801b4c:	83 ec 0c             	sub    $0xc,%esp
+  801b4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b52:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b5a:	eb 02                	jmp    801b5e <readn+0x18>
+  801b5c:	01 c3                	add    %eax,%ebx
+  801b5e:	39 f3                	cmp    %esi,%ebx
+  801b60:	73 21                	jae    801b83 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b62:	83 ec 04             	sub    $0x4,%esp
+  801b65:	89 f0                	mov    %esi,%eax
+  801b67:	29 d8                	sub    %ebx,%eax
+  801b69:	50                   	push   %eax
+  801b6a:	89 d8                	mov    %ebx,%eax
+  801b6c:	03 45 0c             	add    0xc(%ebp),%eax
+  801b6f:	50                   	push   %eax
+  801b70:	57                   	push   %edi
+  801b71:	e8 29 ff ff ff       	call   801a9f <read>
+		if (m < 0)
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	85 c0                	test   %eax,%eax
+  801b7b:	78 04                	js     801b81 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b7d:	75 dd                	jne    801b5c <readn+0x16>
+  801b7f:	eb 02                	jmp    801b83 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b81:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b83:	89 d8                	mov    %ebx,%eax
+  801b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b88:	5b                   	pop    %ebx
+  801b89:	5e                   	pop    %esi
+  801b8a:	5f                   	pop    %edi
+  801b8b:	5d                   	pop    %ebp
+  801b8c:	c3                   	ret
+
+00801b8d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b8d:	55                   	push   %ebp
+  801b8e:	89 e5                	mov    %esp,%ebp
+  801b90:	56                   	push   %esi
+  801b91:	53                   	push   %ebx
+  801b92:	83 ec 18             	sub    $0x18,%esp
+  801b95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b98:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b9b:	50                   	push   %eax
+  801b9c:	53                   	push   %ebx
+  801b9d:	e8 77 fc ff ff       	call   801819 <fd_lookup>
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	78 37                	js     801be0 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ba9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bac:	83 ec 08             	sub    $0x8,%esp
+  801baf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb2:	50                   	push   %eax
+  801bb3:	ff 36                	push   (%esi)
+  801bb5:	e8 af fc ff ff       	call   801869 <dev_lookup>
+  801bba:	83 c4 10             	add    $0x10,%esp
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	78 1f                	js     801be0 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bc1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bc5:	74 20                	je     801be7 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bca:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bcd:	85 c0                	test   %eax,%eax
+  801bcf:	74 57                	je     801c28 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bd1:	83 ec 04             	sub    $0x4,%esp
+  801bd4:	ff 75 10             	push   0x10(%ebp)
+  801bd7:	ff 75 0c             	push   0xc(%ebp)
+  801bda:	56                   	push   %esi
+  801bdb:	ff d0                	call   *%eax
+  801bdd:	83 c4 10             	add    $0x10,%esp
+}
+  801be0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be3:	5b                   	pop    %ebx
+  801be4:	5e                   	pop    %esi
+  801be5:	5d                   	pop    %ebp
+  801be6:	c3                   	ret
+  801be7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801be9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bee:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bf4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bf9:	76 1c                	jbe    801c17 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bfb:	8b 42 48             	mov    0x48(%edx),%eax
+  801bfe:	83 ec 04             	sub    $0x4,%esp
+  801c01:	53                   	push   %ebx
+  801c02:	50                   	push   %eax
+  801c03:	68 55 2f 80 00       	push   $0x802f55
+  801c08:	e8 d9 e5 ff ff       	call   8001e6 <cprintf>
+		return -E_INVAL;
+  801c0d:	83 c4 10             	add    $0x10,%esp
+  801c10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c15:	eb c9                	jmp    801be0 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c17:	c1 e8 10             	shr    $0x10,%eax
+  801c1a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c20:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c26:	eb d3                	jmp    801bfb <write+0x6e>
+		return -E_NOT_SUPP;
+  801c28:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c2d:	eb b1                	jmp    801be0 <write+0x53>
+
+00801c2f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c2f:	55                   	push   %ebp
+  801c30:	89 e5                	mov    %esp,%ebp
+  801c32:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c38:	50                   	push   %eax
+  801c39:	ff 75 08             	push   0x8(%ebp)
+  801c3c:	e8 d8 fb ff ff       	call   801819 <fd_lookup>
+  801c41:	83 c4 10             	add    $0x10,%esp
+  801c44:	85 c0                	test   %eax,%eax
+  801c46:	78 0e                	js     801c56 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c4e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c56:	c9                   	leave
+  801c57:	c3                   	ret
+
+00801c58 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c58:	55                   	push   %ebp
+  801c59:	89 e5                	mov    %esp,%ebp
+  801c5b:	56                   	push   %esi
+  801c5c:	53                   	push   %ebx
+  801c5d:	83 ec 18             	sub    $0x18,%esp
+  801c60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c63:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c66:	50                   	push   %eax
+  801c67:	53                   	push   %ebx
+  801c68:	e8 ac fb ff ff       	call   801819 <fd_lookup>
+  801c6d:	83 c4 10             	add    $0x10,%esp
+  801c70:	85 c0                	test   %eax,%eax
+  801c72:	78 34                	js     801ca8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c74:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c77:	83 ec 08             	sub    $0x8,%esp
+  801c7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c7d:	50                   	push   %eax
+  801c7e:	ff 36                	push   (%esi)
+  801c80:	e8 e4 fb ff ff       	call   801869 <dev_lookup>
+  801c85:	83 c4 10             	add    $0x10,%esp
+  801c88:	85 c0                	test   %eax,%eax
+  801c8a:	78 1c                	js     801ca8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c8c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c90:	74 1d                	je     801caf <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c95:	8b 40 18             	mov    0x18(%eax),%eax
+  801c98:	85 c0                	test   %eax,%eax
+  801c9a:	74 54                	je     801cf0 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c9c:	83 ec 08             	sub    $0x8,%esp
+  801c9f:	ff 75 0c             	push   0xc(%ebp)
+  801ca2:	56                   	push   %esi
+  801ca3:	ff d0                	call   *%eax
+  801ca5:	83 c4 10             	add    $0x10,%esp
+}
+  801ca8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cab:	5b                   	pop    %ebx
+  801cac:	5e                   	pop    %esi
+  801cad:	5d                   	pop    %ebp
+  801cae:	c3                   	ret
+  801caf:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cb1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cb6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cbc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cc1:	76 1c                	jbe    801cdf <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cc3:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cc6:	83 ec 04             	sub    $0x4,%esp
+  801cc9:	53                   	push   %ebx
+  801cca:	50                   	push   %eax
+  801ccb:	68 18 2f 80 00       	push   $0x802f18
+  801cd0:	e8 11 e5 ff ff       	call   8001e6 <cprintf>
+		return -E_INVAL;
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cdd:	eb c9                	jmp    801ca8 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cdf:	c1 e8 10             	shr    $0x10,%eax
+  801ce2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ce8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cee:	eb d3                	jmp    801cc3 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801cf0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cf5:	eb b1                	jmp    801ca8 <ftruncate+0x50>
+
+00801cf7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cf7:	55                   	push   %ebp
+  801cf8:	89 e5                	mov    %esp,%ebp
+  801cfa:	56                   	push   %esi
+  801cfb:	53                   	push   %ebx
+  801cfc:	83 ec 18             	sub    $0x18,%esp
+  801cff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d02:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d05:	50                   	push   %eax
+  801d06:	ff 75 08             	push   0x8(%ebp)
+  801d09:	e8 0b fb ff ff       	call   801819 <fd_lookup>
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	85 c0                	test   %eax,%eax
+  801d13:	78 49                	js     801d5e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d15:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d18:	83 ec 08             	sub    $0x8,%esp
+  801d1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d1e:	50                   	push   %eax
+  801d1f:	ff 36                	push   (%esi)
+  801d21:	e8 43 fb ff ff       	call   801869 <dev_lookup>
+  801d26:	83 c4 10             	add    $0x10,%esp
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	78 31                	js     801d5e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d30:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d34:	74 2f                	je     801d65 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d36:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d39:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d40:	00 00 00 
+	stat->st_isdir = 0;
+  801d43:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d4a:	00 00 00 
+	stat->st_dev = dev;
+  801d4d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d53:	83 ec 08             	sub    $0x8,%esp
+  801d56:	53                   	push   %ebx
+  801d57:	56                   	push   %esi
+  801d58:	ff 50 14             	call   *0x14(%eax)
+  801d5b:	83 c4 10             	add    $0x10,%esp
+}
+  801d5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d61:	5b                   	pop    %ebx
+  801d62:	5e                   	pop    %esi
+  801d63:	5d                   	pop    %ebp
+  801d64:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d65:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d6a:	eb f2                	jmp    801d5e <fstat+0x67>
+
+00801d6c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d6c:	55                   	push   %ebp
+  801d6d:	89 e5                	mov    %esp,%ebp
+  801d6f:	56                   	push   %esi
+  801d70:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d71:	83 ec 08             	sub    $0x8,%esp
+  801d74:	6a 00                	push   $0x0
+  801d76:	ff 75 08             	push   0x8(%ebp)
+  801d79:	e8 e4 01 00 00       	call   801f62 <open>
+  801d7e:	89 c3                	mov    %eax,%ebx
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 1b                	js     801da2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d87:	83 ec 08             	sub    $0x8,%esp
+  801d8a:	ff 75 0c             	push   0xc(%ebp)
+  801d8d:	50                   	push   %eax
+  801d8e:	e8 64 ff ff ff       	call   801cf7 <fstat>
+  801d93:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d95:	89 1c 24             	mov    %ebx,(%esp)
+  801d98:	e8 c6 fb ff ff       	call   801963 <close>
+	return r;
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	89 f3                	mov    %esi,%ebx
+}
+  801da2:	89 d8                	mov    %ebx,%eax
+  801da4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da7:	5b                   	pop    %ebx
+  801da8:	5e                   	pop    %esi
+  801da9:	5d                   	pop    %ebp
+  801daa:	c3                   	ret
+
+00801dab <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801dab:	55                   	push   %ebp
+  801dac:	89 e5                	mov    %esp,%ebp
+  801dae:	56                   	push   %esi
+  801daf:	53                   	push   %ebx
+  801db0:	89 c6                	mov    %eax,%esi
+  801db2:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801db4:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801dbb:	74 27                	je     801de4 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dbd:	6a 07                	push   $0x7
+  801dbf:	68 00 60 80 00       	push   $0x806000
+  801dc4:	56                   	push   %esi
+  801dc5:	ff 35 00 50 80 00    	push   0x805000
+  801dcb:	e8 b2 0c 00 00       	call   802a82 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801dd0:	83 c4 0c             	add    $0xc,%esp
+  801dd3:	6a 00                	push   $0x0
+  801dd5:	53                   	push   %ebx
+  801dd6:	6a 00                	push   $0x0
+  801dd8:	e8 8d 0c 00 00       	call   802a6a <ipc_recv>
+}
+  801ddd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de0:	5b                   	pop    %ebx
+  801de1:	5e                   	pop    %esi
+  801de2:	5d                   	pop    %ebp
+  801de3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801de4:	83 ec 0c             	sub    $0xc,%esp
+  801de7:	6a 01                	push   $0x1
+  801de9:	e8 e8 0c 00 00       	call   802ad6 <ipc_find_env>
+  801dee:	a3 00 50 80 00       	mov    %eax,0x805000
+  801df3:	83 c4 10             	add    $0x10,%esp
+  801df6:	eb c5                	jmp    801dbd <fsipc+0x12>
+
+00801df8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801df8:	55                   	push   %ebp
+  801df9:	89 e5                	mov    %esp,%ebp
+  801dfb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e01:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e04:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e09:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e0c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e16:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e1b:	e8 8b ff ff ff       	call   801dab <fsipc>
+}
+  801e20:	c9                   	leave
+  801e21:	c3                   	ret
+
+00801e22 <devfile_flush>:
+{
+  801e22:	55                   	push   %ebp
+  801e23:	89 e5                	mov    %esp,%ebp
+  801e25:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e2e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e38:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e3d:	e8 69 ff ff ff       	call   801dab <fsipc>
+}
+  801e42:	c9                   	leave
+  801e43:	c3                   	ret
+
+00801e44 <devfile_stat>:
+{
+  801e44:	55                   	push   %ebp
+  801e45:	89 e5                	mov    %esp,%ebp
+  801e47:	53                   	push   %ebx
+  801e48:	83 ec 04             	sub    $0x4,%esp
+  801e4b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e51:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e54:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e5e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e63:	e8 43 ff ff ff       	call   801dab <fsipc>
+  801e68:	85 c0                	test   %eax,%eax
+  801e6a:	78 2c                	js     801e98 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e6c:	83 ec 08             	sub    $0x8,%esp
+  801e6f:	68 00 60 80 00       	push   $0x806000
+  801e74:	53                   	push   %ebx
+  801e75:	e8 b4 e9 ff ff       	call   80082e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e7a:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e7f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e85:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e8a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e90:	83 c4 10             	add    $0x10,%esp
+  801e93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e9b:	c9                   	leave
+  801e9c:	c3                   	ret
+
+00801e9d <devfile_write>:
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	83 ec 0c             	sub    $0xc,%esp
+  801ea3:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ea6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ea9:	8b 52 0c             	mov    0xc(%edx),%edx
+  801eac:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801eb2:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801eb7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ebc:	39 d0                	cmp    %edx,%eax
+  801ebe:	0f 47 c2             	cmova  %edx,%eax
+  801ec1:	50                   	push   %eax
+  801ec2:	ff 75 0c             	push   0xc(%ebp)
+  801ec5:	68 08 60 80 00       	push   $0x806008
+  801eca:	e8 e5 ea ff ff       	call   8009b4 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed4:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ed9:	e8 cd fe ff ff       	call   801dab <fsipc>
+}
+  801ede:	c9                   	leave
+  801edf:	c3                   	ret
+
+00801ee0 <devfile_read>:
+{
+  801ee0:	55                   	push   %ebp
+  801ee1:	89 e5                	mov    %esp,%ebp
+  801ee3:	56                   	push   %esi
+  801ee4:	53                   	push   %ebx
+  801ee5:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eeb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eee:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ef3:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ef9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801efe:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f03:	e8 a3 fe ff ff       	call   801dab <fsipc>
+  801f08:	89 c3                	mov    %eax,%ebx
+  801f0a:	85 c0                	test   %eax,%eax
+  801f0c:	78 1f                	js     801f2d <devfile_read+0x4d>
+	assert(r <= n);
+  801f0e:	39 c6                	cmp    %eax,%esi
+  801f10:	72 24                	jb     801f36 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f12:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f17:	7f 33                	jg     801f4c <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f19:	83 ec 04             	sub    $0x4,%esp
+  801f1c:	50                   	push   %eax
+  801f1d:	68 00 60 80 00       	push   $0x806000
+  801f22:	ff 75 0c             	push   0xc(%ebp)
+  801f25:	e8 8a ea ff ff       	call   8009b4 <memmove>
+	return r;
+  801f2a:	83 c4 10             	add    $0x10,%esp
+}
+  801f2d:	89 d8                	mov    %ebx,%eax
+  801f2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f32:	5b                   	pop    %ebx
+  801f33:	5e                   	pop    %esi
+  801f34:	5d                   	pop    %ebp
+  801f35:	c3                   	ret
+	assert(r <= n);
+  801f36:	68 88 2f 80 00       	push   $0x802f88
+  801f3b:	68 8f 2f 80 00       	push   $0x802f8f
+  801f40:	6a 76                	push   $0x76
+  801f42:	68 a4 2f 80 00       	push   $0x802fa4
+  801f47:	e8 bf e1 ff ff       	call   80010b <_panic>
+	assert(r <= PGSIZE);
+  801f4c:	68 af 2f 80 00       	push   $0x802faf
+  801f51:	68 8f 2f 80 00       	push   $0x802f8f
+  801f56:	6a 77                	push   $0x77
+  801f58:	68 a4 2f 80 00       	push   $0x802fa4
+  801f5d:	e8 a9 e1 ff ff       	call   80010b <_panic>
+
+00801f62 <open>:
+{
+  801f62:	55                   	push   %ebp
+  801f63:	89 e5                	mov    %esp,%ebp
+  801f65:	56                   	push   %esi
+  801f66:	53                   	push   %ebx
+  801f67:	83 ec 1c             	sub    $0x1c,%esp
+  801f6a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f6d:	56                   	push   %esi
+  801f6e:	e8 80 e8 ff ff       	call   8007f3 <strlen>
+  801f73:	83 c4 10             	add    $0x10,%esp
+  801f76:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f7b:	7f 6c                	jg     801fe9 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f7d:	83 ec 0c             	sub    $0xc,%esp
+  801f80:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f83:	50                   	push   %eax
+  801f84:	e8 3a f8 ff ff       	call   8017c3 <fd_alloc>
+  801f89:	89 c3                	mov    %eax,%ebx
+  801f8b:	83 c4 10             	add    $0x10,%esp
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	78 3c                	js     801fce <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f92:	83 ec 08             	sub    $0x8,%esp
+  801f95:	56                   	push   %esi
+  801f96:	68 00 60 80 00       	push   $0x806000
+  801f9b:	e8 8e e8 ff ff       	call   80082e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801fa0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa3:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fa8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fab:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb0:	e8 f6 fd ff ff       	call   801dab <fsipc>
+  801fb5:	89 c3                	mov    %eax,%ebx
+  801fb7:	83 c4 10             	add    $0x10,%esp
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 19                	js     801fd7 <open+0x75>
+	return fd2num(fd);
+  801fbe:	83 ec 0c             	sub    $0xc,%esp
+  801fc1:	ff 75 f4             	push   -0xc(%ebp)
+  801fc4:	e8 d3 f7 ff ff       	call   80179c <fd2num>
+  801fc9:	89 c3                	mov    %eax,%ebx
+  801fcb:	83 c4 10             	add    $0x10,%esp
+}
+  801fce:	89 d8                	mov    %ebx,%eax
+  801fd0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd3:	5b                   	pop    %ebx
+  801fd4:	5e                   	pop    %esi
+  801fd5:	5d                   	pop    %ebp
+  801fd6:	c3                   	ret
+		fd_close(fd, 0);
+  801fd7:	83 ec 08             	sub    $0x8,%esp
+  801fda:	6a 00                	push   $0x0
+  801fdc:	ff 75 f4             	push   -0xc(%ebp)
+  801fdf:	e8 f8 f8 ff ff       	call   8018dc <fd_close>
+		return r;
+  801fe4:	83 c4 10             	add    $0x10,%esp
+  801fe7:	eb e5                	jmp    801fce <open+0x6c>
+		return -E_BAD_PATH;
+  801fe9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fee:	eb de                	jmp    801fce <open+0x6c>
+
+00801ff0 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ff0:	55                   	push   %ebp
+  801ff1:	89 e5                	mov    %esp,%ebp
+  801ff3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffb:	b8 08 00 00 00       	mov    $0x8,%eax
+  802000:	e8 a6 fd ff ff       	call   801dab <fsipc>
+}
+  802005:	c9                   	leave
+  802006:	c3                   	ret
+
+00802007 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802007:	55                   	push   %ebp
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80200d:	68 bb 2f 80 00       	push   $0x802fbb
+  802012:	ff 75 0c             	push   0xc(%ebp)
+  802015:	e8 14 e8 ff ff       	call   80082e <strcpy>
+	return 0;
+}
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201f:	c9                   	leave
+  802020:	c3                   	ret
+
+00802021 <devsock_close>:
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	53                   	push   %ebx
+  802025:	83 ec 10             	sub    $0x10,%esp
+  802028:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80202b:	53                   	push   %ebx
+  80202c:	e8 e4 0a 00 00       	call   802b15 <pageref>
+  802031:	89 c2                	mov    %eax,%edx
+  802033:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802036:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80203b:	83 fa 01             	cmp    $0x1,%edx
+  80203e:	74 05                	je     802045 <devsock_close+0x24>
+}
+  802040:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802043:	c9                   	leave
+  802044:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802045:	83 ec 0c             	sub    $0xc,%esp
+  802048:	ff 73 0c             	push   0xc(%ebx)
+  80204b:	e8 b7 02 00 00       	call   802307 <nsipc_close>
+  802050:	83 c4 10             	add    $0x10,%esp
+  802053:	eb eb                	jmp    802040 <devsock_close+0x1f>
+
+00802055 <devsock_write>:
+{
+  802055:	55                   	push   %ebp
+  802056:	89 e5                	mov    %esp,%ebp
+  802058:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80205b:	6a 00                	push   $0x0
+  80205d:	ff 75 10             	push   0x10(%ebp)
+  802060:	ff 75 0c             	push   0xc(%ebp)
+  802063:	8b 45 08             	mov    0x8(%ebp),%eax
+  802066:	ff 70 0c             	push   0xc(%eax)
+  802069:	e8 79 03 00 00       	call   8023e7 <nsipc_send>
+}
+  80206e:	c9                   	leave
+  80206f:	c3                   	ret
+
+00802070 <devsock_read>:
+{
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802076:	6a 00                	push   $0x0
+  802078:	ff 75 10             	push   0x10(%ebp)
+  80207b:	ff 75 0c             	push   0xc(%ebp)
+  80207e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802081:	ff 70 0c             	push   0xc(%eax)
+  802084:	e8 ef 02 00 00       	call   802378 <nsipc_recv>
+}
+  802089:	c9                   	leave
+  80208a:	c3                   	ret
+
+0080208b <fd2sockid>:
+{
+  80208b:	55                   	push   %ebp
+  80208c:	89 e5                	mov    %esp,%ebp
+  80208e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802091:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802094:	52                   	push   %edx
+  802095:	50                   	push   %eax
+  802096:	e8 7e f7 ff ff       	call   801819 <fd_lookup>
+  80209b:	83 c4 10             	add    $0x10,%esp
+  80209e:	85 c0                	test   %eax,%eax
+  8020a0:	78 10                	js     8020b2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a5:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8020ab:	39 08                	cmp    %ecx,(%eax)
+  8020ad:	75 05                	jne    8020b4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020af:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020b2:	c9                   	leave
+  8020b3:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020b4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020b9:	eb f7                	jmp    8020b2 <fd2sockid+0x27>
+
+008020bb <alloc_sockfd>:
+{
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	56                   	push   %esi
+  8020bf:	53                   	push   %ebx
+  8020c0:	83 ec 1c             	sub    $0x1c,%esp
+  8020c3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020c8:	50                   	push   %eax
+  8020c9:	e8 f5 f6 ff ff       	call   8017c3 <fd_alloc>
+  8020ce:	89 c3                	mov    %eax,%ebx
+  8020d0:	83 c4 10             	add    $0x10,%esp
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 43                	js     80211a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020d7:	83 ec 04             	sub    $0x4,%esp
+  8020da:	68 07 04 00 00       	push   $0x407
+  8020df:	ff 75 f4             	push   -0xc(%ebp)
+  8020e2:	6a 00                	push   $0x0
+  8020e4:	e8 3d ec ff ff       	call   800d26 <sys_page_alloc>
+  8020e9:	89 c3                	mov    %eax,%ebx
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	78 28                	js     80211a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f5:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8020fb:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8020fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802100:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802107:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80210a:	83 ec 0c             	sub    $0xc,%esp
+  80210d:	50                   	push   %eax
+  80210e:	e8 89 f6 ff ff       	call   80179c <fd2num>
+  802113:	89 c3                	mov    %eax,%ebx
+  802115:	83 c4 10             	add    $0x10,%esp
+  802118:	eb 0c                	jmp    802126 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80211a:	83 ec 0c             	sub    $0xc,%esp
+  80211d:	56                   	push   %esi
+  80211e:	e8 e4 01 00 00       	call   802307 <nsipc_close>
+		return r;
+  802123:	83 c4 10             	add    $0x10,%esp
+}
+  802126:	89 d8                	mov    %ebx,%eax
+  802128:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80212b:	5b                   	pop    %ebx
+  80212c:	5e                   	pop    %esi
+  80212d:	5d                   	pop    %ebp
+  80212e:	c3                   	ret
+
+0080212f <accept>:
+{
+  80212f:	55                   	push   %ebp
+  802130:	89 e5                	mov    %esp,%ebp
+  802132:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802135:	8b 45 08             	mov    0x8(%ebp),%eax
+  802138:	e8 4e ff ff ff       	call   80208b <fd2sockid>
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	78 1b                	js     80215c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802141:	83 ec 04             	sub    $0x4,%esp
+  802144:	ff 75 10             	push   0x10(%ebp)
+  802147:	ff 75 0c             	push   0xc(%ebp)
+  80214a:	50                   	push   %eax
+  80214b:	e8 0e 01 00 00       	call   80225e <nsipc_accept>
+  802150:	83 c4 10             	add    $0x10,%esp
+  802153:	85 c0                	test   %eax,%eax
+  802155:	78 05                	js     80215c <accept+0x2d>
+	return alloc_sockfd(r);
+  802157:	e8 5f ff ff ff       	call   8020bb <alloc_sockfd>
+}
+  80215c:	c9                   	leave
+  80215d:	c3                   	ret
+
+0080215e <bind>:
+{
+  80215e:	55                   	push   %ebp
+  80215f:	89 e5                	mov    %esp,%ebp
+  802161:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802164:	8b 45 08             	mov    0x8(%ebp),%eax
+  802167:	e8 1f ff ff ff       	call   80208b <fd2sockid>
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	78 12                	js     802182 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802170:	83 ec 04             	sub    $0x4,%esp
+  802173:	ff 75 10             	push   0x10(%ebp)
+  802176:	ff 75 0c             	push   0xc(%ebp)
+  802179:	50                   	push   %eax
+  80217a:	e8 31 01 00 00       	call   8022b0 <nsipc_bind>
+  80217f:	83 c4 10             	add    $0x10,%esp
+}
+  802182:	c9                   	leave
+  802183:	c3                   	ret
+
+00802184 <shutdown>:
+{
+  802184:	55                   	push   %ebp
+  802185:	89 e5                	mov    %esp,%ebp
+  802187:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80218a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218d:	e8 f9 fe ff ff       	call   80208b <fd2sockid>
+  802192:	85 c0                	test   %eax,%eax
+  802194:	78 0f                	js     8021a5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802196:	83 ec 08             	sub    $0x8,%esp
+  802199:	ff 75 0c             	push   0xc(%ebp)
+  80219c:	50                   	push   %eax
+  80219d:	e8 43 01 00 00       	call   8022e5 <nsipc_shutdown>
+  8021a2:	83 c4 10             	add    $0x10,%esp
+}
+  8021a5:	c9                   	leave
+  8021a6:	c3                   	ret
+
+008021a7 <connect>:
+{
+  8021a7:	55                   	push   %ebp
+  8021a8:	89 e5                	mov    %esp,%ebp
+  8021aa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b0:	e8 d6 fe ff ff       	call   80208b <fd2sockid>
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	78 12                	js     8021cb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021b9:	83 ec 04             	sub    $0x4,%esp
+  8021bc:	ff 75 10             	push   0x10(%ebp)
+  8021bf:	ff 75 0c             	push   0xc(%ebp)
+  8021c2:	50                   	push   %eax
+  8021c3:	e8 59 01 00 00       	call   802321 <nsipc_connect>
+  8021c8:	83 c4 10             	add    $0x10,%esp
+}
+  8021cb:	c9                   	leave
+  8021cc:	c3                   	ret
+
+008021cd <listen>:
+{
+  8021cd:	55                   	push   %ebp
+  8021ce:	89 e5                	mov    %esp,%ebp
+  8021d0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d6:	e8 b0 fe ff ff       	call   80208b <fd2sockid>
+  8021db:	85 c0                	test   %eax,%eax
+  8021dd:	78 0f                	js     8021ee <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021df:	83 ec 08             	sub    $0x8,%esp
+  8021e2:	ff 75 0c             	push   0xc(%ebp)
+  8021e5:	50                   	push   %eax
+  8021e6:	e8 6b 01 00 00       	call   802356 <nsipc_listen>
+  8021eb:	83 c4 10             	add    $0x10,%esp
+}
+  8021ee:	c9                   	leave
+  8021ef:	c3                   	ret
+
+008021f0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021f0:	55                   	push   %ebp
+  8021f1:	89 e5                	mov    %esp,%ebp
+  8021f3:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021f6:	ff 75 10             	push   0x10(%ebp)
+  8021f9:	ff 75 0c             	push   0xc(%ebp)
+  8021fc:	ff 75 08             	push   0x8(%ebp)
+  8021ff:	e8 41 02 00 00       	call   802445 <nsipc_socket>
+  802204:	83 c4 10             	add    $0x10,%esp
+  802207:	85 c0                	test   %eax,%eax
+  802209:	78 05                	js     802210 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80220b:	e8 ab fe ff ff       	call   8020bb <alloc_sockfd>
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+
+00802212 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	53                   	push   %ebx
+  802216:	83 ec 04             	sub    $0x4,%esp
+  802219:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80221b:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802222:	74 26                	je     80224a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802224:	6a 07                	push   $0x7
+  802226:	68 00 70 80 00       	push   $0x807000
+  80222b:	53                   	push   %ebx
+  80222c:	ff 35 04 50 80 00    	push   0x805004
+  802232:	e8 4b 08 00 00       	call   802a82 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802237:	83 c4 0c             	add    $0xc,%esp
+  80223a:	6a 00                	push   $0x0
+  80223c:	6a 00                	push   $0x0
+  80223e:	6a 00                	push   $0x0
+  802240:	e8 25 08 00 00       	call   802a6a <ipc_recv>
+}
+  802245:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802248:	c9                   	leave
+  802249:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80224a:	83 ec 0c             	sub    $0xc,%esp
+  80224d:	6a 02                	push   $0x2
+  80224f:	e8 82 08 00 00       	call   802ad6 <ipc_find_env>
+  802254:	a3 04 50 80 00       	mov    %eax,0x805004
+  802259:	83 c4 10             	add    $0x10,%esp
+  80225c:	eb c6                	jmp    802224 <nsipc+0x12>
+
+0080225e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80225e:	55                   	push   %ebp
+  80225f:	89 e5                	mov    %esp,%ebp
+  802261:	56                   	push   %esi
+  802262:	53                   	push   %ebx
+  802263:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802266:	8b 45 08             	mov    0x8(%ebp),%eax
+  802269:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80226e:	8b 06                	mov    (%esi),%eax
+  802270:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802275:	b8 01 00 00 00       	mov    $0x1,%eax
+  80227a:	e8 93 ff ff ff       	call   802212 <nsipc>
+  80227f:	89 c3                	mov    %eax,%ebx
+  802281:	85 c0                	test   %eax,%eax
+  802283:	79 09                	jns    80228e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802285:	89 d8                	mov    %ebx,%eax
+  802287:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80228a:	5b                   	pop    %ebx
+  80228b:	5e                   	pop    %esi
+  80228c:	5d                   	pop    %ebp
+  80228d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80228e:	83 ec 04             	sub    $0x4,%esp
+  802291:	ff 35 10 70 80 00    	push   0x807010
+  802297:	68 00 70 80 00       	push   $0x807000
+  80229c:	ff 75 0c             	push   0xc(%ebp)
+  80229f:	e8 10 e7 ff ff       	call   8009b4 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022a4:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022a9:	89 06                	mov    %eax,(%esi)
+  8022ab:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022ae:	eb d5                	jmp    802285 <nsipc_accept+0x27>
+
+008022b0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022b0:	55                   	push   %ebp
+  8022b1:	89 e5                	mov    %esp,%ebp
+  8022b3:	53                   	push   %ebx
+  8022b4:	83 ec 08             	sub    $0x8,%esp
+  8022b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022bd:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022c2:	53                   	push   %ebx
+  8022c3:	ff 75 0c             	push   0xc(%ebp)
+  8022c6:	68 04 70 80 00       	push   $0x807004
+  8022cb:	e8 e4 e6 ff ff       	call   8009b4 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022d0:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022d6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022db:	e8 32 ff ff ff       	call   802212 <nsipc>
+}
+  8022e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e3:	c9                   	leave
+  8022e4:	c3                   	ret
+
+008022e5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022e5:	55                   	push   %ebp
+  8022e6:	89 e5                	mov    %esp,%ebp
+  8022e8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ee:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8022f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022f6:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8022fb:	b8 03 00 00 00       	mov    $0x3,%eax
+  802300:	e8 0d ff ff ff       	call   802212 <nsipc>
+}
+  802305:	c9                   	leave
+  802306:	c3                   	ret
+
+00802307 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802307:	55                   	push   %ebp
+  802308:	89 e5                	mov    %esp,%ebp
+  80230a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80230d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802310:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802315:	b8 04 00 00 00       	mov    $0x4,%eax
+  80231a:	e8 f3 fe ff ff       	call   802212 <nsipc>
+}
+  80231f:	c9                   	leave
+  802320:	c3                   	ret
+
+00802321 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802321:	55                   	push   %ebp
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	53                   	push   %ebx
+  802325:	83 ec 08             	sub    $0x8,%esp
+  802328:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80232b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802333:	53                   	push   %ebx
+  802334:	ff 75 0c             	push   0xc(%ebp)
+  802337:	68 04 70 80 00       	push   $0x807004
+  80233c:	e8 73 e6 ff ff       	call   8009b4 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802341:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802347:	b8 05 00 00 00       	mov    $0x5,%eax
+  80234c:	e8 c1 fe ff ff       	call   802212 <nsipc>
+}
+  802351:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+00802356 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802356:	55                   	push   %ebp
+  802357:	89 e5                	mov    %esp,%ebp
+  802359:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80235c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802364:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802367:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80236c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802371:	e8 9c fe ff ff       	call   802212 <nsipc>
+}
+  802376:	c9                   	leave
+  802377:	c3                   	ret
+
+00802378 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	56                   	push   %esi
+  80237c:	53                   	push   %ebx
+  80237d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802380:	8b 45 08             	mov    0x8(%ebp),%eax
+  802383:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802388:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80238e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802391:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802396:	b8 07 00 00 00       	mov    $0x7,%eax
+  80239b:	e8 72 fe ff ff       	call   802212 <nsipc>
+  8023a0:	89 c3                	mov    %eax,%ebx
+  8023a2:	85 c0                	test   %eax,%eax
+  8023a4:	78 22                	js     8023c8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023a6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023ab:	39 c6                	cmp    %eax,%esi
+  8023ad:	0f 4e c6             	cmovle %esi,%eax
+  8023b0:	39 c3                	cmp    %eax,%ebx
+  8023b2:	7f 1d                	jg     8023d1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023b4:	83 ec 04             	sub    $0x4,%esp
+  8023b7:	53                   	push   %ebx
+  8023b8:	68 00 70 80 00       	push   $0x807000
+  8023bd:	ff 75 0c             	push   0xc(%ebp)
+  8023c0:	e8 ef e5 ff ff       	call   8009b4 <memmove>
+  8023c5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023c8:	89 d8                	mov    %ebx,%eax
+  8023ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023cd:	5b                   	pop    %ebx
+  8023ce:	5e                   	pop    %esi
+  8023cf:	5d                   	pop    %ebp
+  8023d0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023d1:	68 c7 2f 80 00       	push   $0x802fc7
+  8023d6:	68 8f 2f 80 00       	push   $0x802f8f
+  8023db:	6a 62                	push   $0x62
+  8023dd:	68 dc 2f 80 00       	push   $0x802fdc
+  8023e2:	e8 24 dd ff ff       	call   80010b <_panic>
+
+008023e7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	53                   	push   %ebx
+  8023eb:	83 ec 04             	sub    $0x4,%esp
+  8023ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f4:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8023f9:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8023ff:	7f 2e                	jg     80242f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802401:	83 ec 04             	sub    $0x4,%esp
+  802404:	53                   	push   %ebx
+  802405:	ff 75 0c             	push   0xc(%ebp)
+  802408:	68 0c 70 80 00       	push   $0x80700c
+  80240d:	e8 a2 e5 ff ff       	call   8009b4 <memmove>
+	nsipcbuf.send.req_size = size;
+  802412:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80241b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802420:	b8 08 00 00 00       	mov    $0x8,%eax
+  802425:	e8 e8 fd ff ff       	call   802212 <nsipc>
+}
+  80242a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80242d:	c9                   	leave
+  80242e:	c3                   	ret
+	assert(size < 1600);
+  80242f:	68 e8 2f 80 00       	push   $0x802fe8
+  802434:	68 8f 2f 80 00       	push   $0x802f8f
+  802439:	6a 6d                	push   $0x6d
+  80243b:	68 dc 2f 80 00       	push   $0x802fdc
+  802440:	e8 c6 dc ff ff       	call   80010b <_panic>
+
+00802445 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802445:	55                   	push   %ebp
+  802446:	89 e5                	mov    %esp,%ebp
+  802448:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80244b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802453:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802456:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80245b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80245e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802463:	b8 09 00 00 00       	mov    $0x9,%eax
+  802468:	e8 a5 fd ff ff       	call   802212 <nsipc>
+}
+  80246d:	c9                   	leave
+  80246e:	c3                   	ret
+
+0080246f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80246f:	55                   	push   %ebp
+  802470:	89 e5                	mov    %esp,%ebp
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802477:	83 ec 0c             	sub    $0xc,%esp
+  80247a:	ff 75 08             	push   0x8(%ebp)
+  80247d:	e8 2a f3 ff ff       	call   8017ac <fd2data>
+  802482:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802484:	83 c4 08             	add    $0x8,%esp
+  802487:	68 f4 2f 80 00       	push   $0x802ff4
+  80248c:	53                   	push   %ebx
+  80248d:	e8 9c e3 ff ff       	call   80082e <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802492:	8b 46 04             	mov    0x4(%esi),%eax
+  802495:	2b 06                	sub    (%esi),%eax
+  802497:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80249d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024a4:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024a7:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024ae:	40 80 00 
+	return 0;
+}
+  8024b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024b9:	5b                   	pop    %ebx
+  8024ba:	5e                   	pop    %esi
+  8024bb:	5d                   	pop    %ebp
+  8024bc:	c3                   	ret
+
+008024bd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024bd:	55                   	push   %ebp
+  8024be:	89 e5                	mov    %esp,%ebp
+  8024c0:	53                   	push   %ebx
+  8024c1:	83 ec 0c             	sub    $0xc,%esp
+  8024c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024c7:	53                   	push   %ebx
+  8024c8:	6a 00                	push   $0x0
+  8024ca:	e8 32 e9 ff ff       	call   800e01 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024cf:	89 1c 24             	mov    %ebx,(%esp)
+  8024d2:	e8 d5 f2 ff ff       	call   8017ac <fd2data>
+  8024d7:	83 c4 08             	add    $0x8,%esp
+  8024da:	50                   	push   %eax
+  8024db:	6a 00                	push   $0x0
+  8024dd:	e8 1f e9 ff ff       	call   800e01 <sys_page_unmap>
+}
+  8024e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+
+008024e7 <_pipeisclosed>:
+{
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	57                   	push   %edi
+  8024eb:	56                   	push   %esi
+  8024ec:	53                   	push   %ebx
+  8024ed:	83 ec 1c             	sub    $0x1c,%esp
+  8024f0:	89 c7                	mov    %eax,%edi
+  8024f2:	89 d6                	mov    %edx,%esi
+  8024f4:	eb 3c                	jmp    802532 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8024f6:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8024f9:	83 ec 0c             	sub    $0xc,%esp
+  8024fc:	57                   	push   %edi
+  8024fd:	e8 13 06 00 00       	call   802b15 <pageref>
+  802502:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802505:	89 34 24             	mov    %esi,(%esp)
+  802508:	e8 08 06 00 00       	call   802b15 <pageref>
+  80250d:	89 c2                	mov    %eax,%edx
+  80250f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802511:	05 00 00 00 20       	add    $0x20000000,%eax
+  802516:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802519:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80251f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802524:	76 31                	jbe    802557 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802526:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802529:	39 c3                	cmp    %eax,%ebx
+  80252b:	74 76                	je     8025a3 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80252d:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802530:	74 36                	je     802568 <_pipeisclosed+0x81>
+  802532:	89 e0                	mov    %esp,%eax
+  802534:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802539:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80253f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802544:	77 b0                	ja     8024f6 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802546:	c1 e8 10             	shr    $0x10,%eax
+  802549:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80254f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802555:	eb 9f                	jmp    8024f6 <_pipeisclosed+0xf>
+  802557:	c1 e8 10             	shr    $0x10,%eax
+  80255a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802560:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802566:	eb be                	jmp    802526 <_pipeisclosed+0x3f>
+  802568:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80256a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80256f:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802575:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80257a:	76 16                	jbe    802592 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80257c:	8b 42 58             	mov    0x58(%edx),%eax
+  80257f:	6a 01                	push   $0x1
+  802581:	50                   	push   %eax
+  802582:	53                   	push   %ebx
+  802583:	68 fb 2f 80 00       	push   $0x802ffb
+  802588:	e8 59 dc ff ff       	call   8001e6 <cprintf>
+  80258d:	83 c4 10             	add    $0x10,%esp
+  802590:	eb a0                	jmp    802532 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802592:	c1 e8 10             	shr    $0x10,%eax
+  802595:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80259b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025a1:	eb d9                	jmp    80257c <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8025a3:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025a6:	0f 94 c0             	sete   %al
+  8025a9:	0f b6 c0             	movzbl %al,%eax
+}
+  8025ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025af:	5b                   	pop    %ebx
+  8025b0:	5e                   	pop    %esi
+  8025b1:	5f                   	pop    %edi
+  8025b2:	5d                   	pop    %ebp
+  8025b3:	c3                   	ret
+
+008025b4 <devpipe_write>:
+{
+  8025b4:	55                   	push   %ebp
+  8025b5:	89 e5                	mov    %esp,%ebp
+  8025b7:	57                   	push   %edi
+  8025b8:	56                   	push   %esi
+  8025b9:	53                   	push   %ebx
+  8025ba:	83 ec 28             	sub    $0x28,%esp
+  8025bd:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025c0:	56                   	push   %esi
+  8025c1:	e8 e6 f1 ff ff       	call   8017ac <fd2data>
+  8025c6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025c8:	83 c4 10             	add    $0x10,%esp
+  8025cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025d3:	75 09                	jne    8025de <devpipe_write+0x2a>
+	return i;
+  8025d5:	89 f8                	mov    %edi,%eax
+  8025d7:	eb 23                	jmp    8025fc <devpipe_write+0x48>
+			sys_yield();
+  8025d9:	e8 02 e7 ff ff       	call   800ce0 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025de:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025e1:	8b 0b                	mov    (%ebx),%ecx
+  8025e3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025e6:	39 d0                	cmp    %edx,%eax
+  8025e8:	72 1a                	jb     802604 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025ea:	89 da                	mov    %ebx,%edx
+  8025ec:	89 f0                	mov    %esi,%eax
+  8025ee:	e8 f4 fe ff ff       	call   8024e7 <_pipeisclosed>
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	74 e2                	je     8025d9 <devpipe_write+0x25>
+				return 0;
+  8025f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ff:	5b                   	pop    %ebx
+  802600:	5e                   	pop    %esi
+  802601:	5f                   	pop    %edi
+  802602:	5d                   	pop    %ebp
+  802603:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802604:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802607:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80260b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80260e:	89 c2                	mov    %eax,%edx
+  802610:	c1 fa 1f             	sar    $0x1f,%edx
+  802613:	89 d1                	mov    %edx,%ecx
+  802615:	c1 e9 1b             	shr    $0x1b,%ecx
+  802618:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80261b:	83 e2 1f             	and    $0x1f,%edx
+  80261e:	29 ca                	sub    %ecx,%edx
+  802620:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802624:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802628:	83 c0 01             	add    $0x1,%eax
+  80262b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80262e:	83 c7 01             	add    $0x1,%edi
+  802631:	eb 9d                	jmp    8025d0 <devpipe_write+0x1c>
+
+00802633 <devpipe_read>:
+{
+  802633:	55                   	push   %ebp
+  802634:	89 e5                	mov    %esp,%ebp
+  802636:	57                   	push   %edi
+  802637:	56                   	push   %esi
+  802638:	53                   	push   %ebx
+  802639:	83 ec 18             	sub    $0x18,%esp
+  80263c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80263f:	57                   	push   %edi
+  802640:	e8 67 f1 ff ff       	call   8017ac <fd2data>
+  802645:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802647:	83 c4 10             	add    $0x10,%esp
+  80264a:	be 00 00 00 00       	mov    $0x0,%esi
+  80264f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802652:	75 13                	jne    802667 <devpipe_read+0x34>
+	return i;
+  802654:	89 f0                	mov    %esi,%eax
+  802656:	eb 02                	jmp    80265a <devpipe_read+0x27>
+				return i;
+  802658:	89 f0                	mov    %esi,%eax
+}
+  80265a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80265d:	5b                   	pop    %ebx
+  80265e:	5e                   	pop    %esi
+  80265f:	5f                   	pop    %edi
+  802660:	5d                   	pop    %ebp
+  802661:	c3                   	ret
+			sys_yield();
+  802662:	e8 79 e6 ff ff       	call   800ce0 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802667:	8b 03                	mov    (%ebx),%eax
+  802669:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80266c:	75 18                	jne    802686 <devpipe_read+0x53>
+			if (i > 0)
+  80266e:	85 f6                	test   %esi,%esi
+  802670:	75 e6                	jne    802658 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802672:	89 da                	mov    %ebx,%edx
+  802674:	89 f8                	mov    %edi,%eax
+  802676:	e8 6c fe ff ff       	call   8024e7 <_pipeisclosed>
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	74 e3                	je     802662 <devpipe_read+0x2f>
+				return 0;
+  80267f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802684:	eb d4                	jmp    80265a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802686:	99                   	cltd
+  802687:	c1 ea 1b             	shr    $0x1b,%edx
+  80268a:	01 d0                	add    %edx,%eax
+  80268c:	83 e0 1f             	and    $0x1f,%eax
+  80268f:	29 d0                	sub    %edx,%eax
+  802691:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802696:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802699:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80269c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80269f:	83 c6 01             	add    $0x1,%esi
+  8026a2:	eb ab                	jmp    80264f <devpipe_read+0x1c>
+
+008026a4 <pipe>:
+{
+  8026a4:	55                   	push   %ebp
+  8026a5:	89 e5                	mov    %esp,%ebp
+  8026a7:	56                   	push   %esi
+  8026a8:	53                   	push   %ebx
+  8026a9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026af:	50                   	push   %eax
+  8026b0:	e8 0e f1 ff ff       	call   8017c3 <fd_alloc>
+  8026b5:	89 c3                	mov    %eax,%ebx
+  8026b7:	83 c4 10             	add    $0x10,%esp
+  8026ba:	85 c0                	test   %eax,%eax
+  8026bc:	0f 88 23 01 00 00    	js     8027e5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026c2:	83 ec 04             	sub    $0x4,%esp
+  8026c5:	68 07 04 00 00       	push   $0x407
+  8026ca:	ff 75 f4             	push   -0xc(%ebp)
+  8026cd:	6a 00                	push   $0x0
+  8026cf:	e8 52 e6 ff ff       	call   800d26 <sys_page_alloc>
+  8026d4:	89 c3                	mov    %eax,%ebx
+  8026d6:	83 c4 10             	add    $0x10,%esp
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	0f 88 04 01 00 00    	js     8027e5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026e1:	83 ec 0c             	sub    $0xc,%esp
+  8026e4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026e7:	50                   	push   %eax
+  8026e8:	e8 d6 f0 ff ff       	call   8017c3 <fd_alloc>
+  8026ed:	89 c3                	mov    %eax,%ebx
+  8026ef:	83 c4 10             	add    $0x10,%esp
+  8026f2:	85 c0                	test   %eax,%eax
+  8026f4:	0f 88 db 00 00 00    	js     8027d5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026fa:	83 ec 04             	sub    $0x4,%esp
+  8026fd:	68 07 04 00 00       	push   $0x407
+  802702:	ff 75 f0             	push   -0x10(%ebp)
+  802705:	6a 00                	push   $0x0
+  802707:	e8 1a e6 ff ff       	call   800d26 <sys_page_alloc>
+  80270c:	89 c3                	mov    %eax,%ebx
+  80270e:	83 c4 10             	add    $0x10,%esp
+  802711:	85 c0                	test   %eax,%eax
+  802713:	0f 88 bc 00 00 00    	js     8027d5 <pipe+0x131>
+	va = fd2data(fd0);
+  802719:	83 ec 0c             	sub    $0xc,%esp
+  80271c:	ff 75 f4             	push   -0xc(%ebp)
+  80271f:	e8 88 f0 ff ff       	call   8017ac <fd2data>
+  802724:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802726:	83 c4 0c             	add    $0xc,%esp
+  802729:	68 07 04 00 00       	push   $0x407
+  80272e:	50                   	push   %eax
+  80272f:	6a 00                	push   $0x0
+  802731:	e8 f0 e5 ff ff       	call   800d26 <sys_page_alloc>
+  802736:	89 c3                	mov    %eax,%ebx
+  802738:	83 c4 10             	add    $0x10,%esp
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	0f 88 82 00 00 00    	js     8027c5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802743:	83 ec 0c             	sub    $0xc,%esp
+  802746:	ff 75 f0             	push   -0x10(%ebp)
+  802749:	e8 5e f0 ff ff       	call   8017ac <fd2data>
+  80274e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802755:	50                   	push   %eax
+  802756:	6a 00                	push   $0x0
+  802758:	56                   	push   %esi
+  802759:	6a 00                	push   $0x0
+  80275b:	e8 33 e6 ff ff       	call   800d93 <sys_page_map>
+  802760:	89 c3                	mov    %eax,%ebx
+  802762:	83 c4 20             	add    $0x20,%esp
+  802765:	85 c0                	test   %eax,%eax
+  802767:	78 4e                	js     8027b7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802769:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80276e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802771:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802773:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802776:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80277d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802780:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802782:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802785:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80278c:	83 ec 0c             	sub    $0xc,%esp
+  80278f:	ff 75 f4             	push   -0xc(%ebp)
+  802792:	e8 05 f0 ff ff       	call   80179c <fd2num>
+  802797:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80279a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80279c:	83 c4 04             	add    $0x4,%esp
+  80279f:	ff 75 f0             	push   -0x10(%ebp)
+  8027a2:	e8 f5 ef ff ff       	call   80179c <fd2num>
+  8027a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027aa:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027ad:	83 c4 10             	add    $0x10,%esp
+  8027b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b5:	eb 2e                	jmp    8027e5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027b7:	83 ec 08             	sub    $0x8,%esp
+  8027ba:	56                   	push   %esi
+  8027bb:	6a 00                	push   $0x0
+  8027bd:	e8 3f e6 ff ff       	call   800e01 <sys_page_unmap>
+  8027c2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027c5:	83 ec 08             	sub    $0x8,%esp
+  8027c8:	ff 75 f0             	push   -0x10(%ebp)
+  8027cb:	6a 00                	push   $0x0
+  8027cd:	e8 2f e6 ff ff       	call   800e01 <sys_page_unmap>
+  8027d2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027d5:	83 ec 08             	sub    $0x8,%esp
+  8027d8:	ff 75 f4             	push   -0xc(%ebp)
+  8027db:	6a 00                	push   $0x0
+  8027dd:	e8 1f e6 ff ff       	call   800e01 <sys_page_unmap>
+  8027e2:	83 c4 10             	add    $0x10,%esp
+}
+  8027e5:	89 d8                	mov    %ebx,%eax
+  8027e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ea:	5b                   	pop    %ebx
+  8027eb:	5e                   	pop    %esi
+  8027ec:	5d                   	pop    %ebp
+  8027ed:	c3                   	ret
+
+008027ee <pipeisclosed>:
+{
+  8027ee:	55                   	push   %ebp
+  8027ef:	89 e5                	mov    %esp,%ebp
+  8027f1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027f7:	50                   	push   %eax
+  8027f8:	ff 75 08             	push   0x8(%ebp)
+  8027fb:	e8 19 f0 ff ff       	call   801819 <fd_lookup>
+  802800:	83 c4 10             	add    $0x10,%esp
+  802803:	85 c0                	test   %eax,%eax
+  802805:	78 18                	js     80281f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802807:	83 ec 0c             	sub    $0xc,%esp
+  80280a:	ff 75 f4             	push   -0xc(%ebp)
+  80280d:	e8 9a ef ff ff       	call   8017ac <fd2data>
+  802812:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802814:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802817:	e8 cb fc ff ff       	call   8024e7 <_pipeisclosed>
+  80281c:	83 c4 10             	add    $0x10,%esp
+}
+  80281f:	c9                   	leave
+  802820:	c3                   	ret
+
+00802821 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802821:	b8 00 00 00 00       	mov    $0x0,%eax
+  802826:	c3                   	ret
+
+00802827 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802827:	55                   	push   %ebp
+  802828:	89 e5                	mov    %esp,%ebp
+  80282a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80282d:	68 13 30 80 00       	push   $0x803013
+  802832:	ff 75 0c             	push   0xc(%ebp)
+  802835:	e8 f4 df ff ff       	call   80082e <strcpy>
+	return 0;
+}
+  80283a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283f:	c9                   	leave
+  802840:	c3                   	ret
+
+00802841 <devcons_write>:
+{
+  802841:	55                   	push   %ebp
+  802842:	89 e5                	mov    %esp,%ebp
+  802844:	57                   	push   %edi
+  802845:	56                   	push   %esi
+  802846:	53                   	push   %ebx
+  802847:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80284d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802852:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802858:	eb 2e                	jmp    802888 <devcons_write+0x47>
+		m = n - tot;
+  80285a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80285d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80285f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802864:	39 c3                	cmp    %eax,%ebx
+  802866:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802869:	83 ec 04             	sub    $0x4,%esp
+  80286c:	53                   	push   %ebx
+  80286d:	89 f0                	mov    %esi,%eax
+  80286f:	03 45 0c             	add    0xc(%ebp),%eax
+  802872:	50                   	push   %eax
+  802873:	57                   	push   %edi
+  802874:	e8 3b e1 ff ff       	call   8009b4 <memmove>
+		sys_cputs(buf, m);
+  802879:	83 c4 08             	add    $0x8,%esp
+  80287c:	53                   	push   %ebx
+  80287d:	57                   	push   %edi
+  80287e:	e8 24 e3 ff ff       	call   800ba7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802883:	01 de                	add    %ebx,%esi
+  802885:	83 c4 10             	add    $0x10,%esp
+  802888:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80288b:	72 cd                	jb     80285a <devcons_write+0x19>
+}
+  80288d:	89 f0                	mov    %esi,%eax
+  80288f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802892:	5b                   	pop    %ebx
+  802893:	5e                   	pop    %esi
+  802894:	5f                   	pop    %edi
+  802895:	5d                   	pop    %ebp
+  802896:	c3                   	ret
+
+00802897 <devcons_read>:
+{
+  802897:	55                   	push   %ebp
+  802898:	89 e5                	mov    %esp,%ebp
+  80289a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80289d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028a6:	75 07                	jne    8028af <devcons_read+0x18>
+  8028a8:	eb 1f                	jmp    8028c9 <devcons_read+0x32>
+		sys_yield();
+  8028aa:	e8 31 e4 ff ff       	call   800ce0 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028af:	e8 37 e3 ff ff       	call   800beb <sys_cgetc>
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	74 f2                	je     8028aa <devcons_read+0x13>
+	if (c < 0)
+  8028b8:	78 0f                	js     8028c9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028ba:	83 f8 04             	cmp    $0x4,%eax
+  8028bd:	74 0c                	je     8028cb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028c2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028c4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028c9:	c9                   	leave
+  8028ca:	c3                   	ret
+		return 0;
+  8028cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d0:	eb f7                	jmp    8028c9 <devcons_read+0x32>
+
+008028d2 <cputchar>:
+{
+  8028d2:	55                   	push   %ebp
+  8028d3:	89 e5                	mov    %esp,%ebp
+  8028d5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028db:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028de:	6a 01                	push   $0x1
+  8028e0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028e3:	50                   	push   %eax
+  8028e4:	e8 be e2 ff ff       	call   800ba7 <sys_cputs>
+}
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	c9                   	leave
+  8028ed:	c3                   	ret
+
+008028ee <getchar>:
+{
+  8028ee:	55                   	push   %ebp
+  8028ef:	89 e5                	mov    %esp,%ebp
+  8028f1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028f4:	6a 01                	push   $0x1
+  8028f6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028f9:	50                   	push   %eax
+  8028fa:	6a 00                	push   $0x0
+  8028fc:	e8 9e f1 ff ff       	call   801a9f <read>
+	if (r < 0)
+  802901:	83 c4 10             	add    $0x10,%esp
+  802904:	85 c0                	test   %eax,%eax
+  802906:	78 06                	js     80290e <getchar+0x20>
+	if (r < 1)
+  802908:	74 06                	je     802910 <getchar+0x22>
+	return c;
+  80290a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80290e:	c9                   	leave
+  80290f:	c3                   	ret
+		return -E_EOF;
+  802910:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802915:	eb f7                	jmp    80290e <getchar+0x20>
+
+00802917 <iscons>:
+{
+  802917:	55                   	push   %ebp
+  802918:	89 e5                	mov    %esp,%ebp
+  80291a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80291d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802920:	50                   	push   %eax
+  802921:	ff 75 08             	push   0x8(%ebp)
+  802924:	e8 f0 ee ff ff       	call   801819 <fd_lookup>
+  802929:	83 c4 10             	add    $0x10,%esp
+  80292c:	85 c0                	test   %eax,%eax
+  80292e:	78 11                	js     802941 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802930:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802933:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802939:	39 10                	cmp    %edx,(%eax)
+  80293b:	0f 94 c0             	sete   %al
+  80293e:	0f b6 c0             	movzbl %al,%eax
+}
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+00802943 <opencons>:
+{
+  802943:	55                   	push   %ebp
+  802944:	89 e5                	mov    %esp,%ebp
+  802946:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802949:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80294c:	50                   	push   %eax
+  80294d:	e8 71 ee ff ff       	call   8017c3 <fd_alloc>
+  802952:	83 c4 10             	add    $0x10,%esp
+  802955:	85 c0                	test   %eax,%eax
+  802957:	78 3a                	js     802993 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802959:	83 ec 04             	sub    $0x4,%esp
+  80295c:	68 07 04 00 00       	push   $0x407
+  802961:	ff 75 f4             	push   -0xc(%ebp)
+  802964:	6a 00                	push   $0x0
+  802966:	e8 bb e3 ff ff       	call   800d26 <sys_page_alloc>
+  80296b:	83 c4 10             	add    $0x10,%esp
+  80296e:	85 c0                	test   %eax,%eax
+  802970:	78 21                	js     802993 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802972:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802975:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80297b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80297d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802980:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802987:	83 ec 0c             	sub    $0xc,%esp
+  80298a:	50                   	push   %eax
+  80298b:	e8 0c ee ff ff       	call   80179c <fd2num>
+  802990:	83 c4 10             	add    $0x10,%esp
+}
+  802993:	c9                   	leave
+  802994:	c3                   	ret
+
+00802995 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802995:	55                   	push   %ebp
+  802996:	89 e5                	mov    %esp,%ebp
+  802998:	56                   	push   %esi
+  802999:	53                   	push   %ebx
+  80299a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80299d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8029a3:	85 c0                	test   %eax,%eax
+  8029a5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029aa:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8029ad:	83 ec 08             	sub    $0x8,%esp
+  8029b0:	ff 75 14             	push   0x14(%ebp)
+  8029b3:	50                   	push   %eax
+  8029b4:	e8 7e e7 ff ff       	call   801137 <sys_ipc_recv_until>
+  8029b9:	83 c4 10             	add    $0x10,%esp
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	78 61                	js     802a21 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029c0:	85 f6                	test   %esi,%esi
+  8029c2:	74 1c                	je     8029e0 <ipc_recv_until+0x4b>
+  8029c4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029c6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029cb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029d1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029d6:	76 5f                	jbe    802a37 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029d8:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029de:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029e0:	85 db                	test   %ebx,%ebx
+  8029e2:	74 1c                	je     802a00 <ipc_recv_until+0x6b>
+  8029e4:	89 e0                	mov    %esp,%eax
+  8029e6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029eb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029f1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029f6:	76 50                	jbe    802a48 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8029f8:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8029fe:	89 03                	mov    %eax,(%ebx)
+  802a00:	89 e0                	mov    %esp,%eax
+  802a02:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a07:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a0d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a12:	76 45                	jbe    802a59 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a14:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a1d:	5b                   	pop    %ebx
+  802a1e:	5e                   	pop    %esi
+  802a1f:	5d                   	pop    %ebp
+  802a20:	c3                   	ret
+		if (from_env_store)
+  802a21:	85 f6                	test   %esi,%esi
+  802a23:	74 06                	je     802a2b <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a25:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a2b:	85 db                	test   %ebx,%ebx
+  802a2d:	74 eb                	je     802a1a <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a2f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a35:	eb e3                	jmp    802a1a <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a37:	c1 e8 10             	shr    $0x10,%eax
+  802a3a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a40:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a46:	eb 90                	jmp    8029d8 <ipc_recv_until+0x43>
+  802a48:	c1 e8 10             	shr    $0x10,%eax
+  802a4b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a51:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a57:	eb 9f                	jmp    8029f8 <ipc_recv_until+0x63>
+  802a59:	c1 e8 10             	shr    $0x10,%eax
+  802a5c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a62:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a68:	eb aa                	jmp    802a14 <ipc_recv_until+0x7f>
+
+00802a6a <ipc_recv>:
+{
+  802a6a:	55                   	push   %ebp
+  802a6b:	89 e5                	mov    %esp,%ebp
+  802a6d:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a70:	6a 00                	push   $0x0
+  802a72:	ff 75 10             	push   0x10(%ebp)
+  802a75:	ff 75 0c             	push   0xc(%ebp)
+  802a78:	ff 75 08             	push   0x8(%ebp)
+  802a7b:	e8 15 ff ff ff       	call   802995 <ipc_recv_until>
+}
+  802a80:	c9                   	leave
+  802a81:	c3                   	ret
+
+00802a82 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a82:	55                   	push   %ebp
+  802a83:	89 e5                	mov    %esp,%ebp
+  802a85:	57                   	push   %edi
+  802a86:	56                   	push   %esi
+  802a87:	53                   	push   %ebx
+  802a88:	83 ec 0c             	sub    $0xc,%esp
+  802a8b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a94:	85 db                	test   %ebx,%ebx
+  802a96:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a9b:	0f 44 d8             	cmove  %eax,%ebx
+  802a9e:	eb 05                	jmp    802aa5 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802aa0:	e8 3b e2 ff ff       	call   800ce0 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802aa5:	ff 75 14             	push   0x14(%ebp)
+  802aa8:	53                   	push   %ebx
+  802aa9:	56                   	push   %esi
+  802aaa:	57                   	push   %edi
+  802aab:	e8 d3 e5 ff ff       	call   801083 <sys_ipc_try_send>
+  802ab0:	83 c4 10             	add    $0x10,%esp
+  802ab3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ab6:	74 e8                	je     802aa0 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802ab8:	85 c0                	test   %eax,%eax
+  802aba:	78 08                	js     802ac4 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802abc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802abf:	5b                   	pop    %ebx
+  802ac0:	5e                   	pop    %esi
+  802ac1:	5f                   	pop    %edi
+  802ac2:	5d                   	pop    %ebp
+  802ac3:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802ac4:	50                   	push   %eax
+  802ac5:	68 1f 30 80 00       	push   $0x80301f
+  802aca:	6a 4f                	push   $0x4f
+  802acc:	68 32 30 80 00       	push   $0x803032
+  802ad1:	e8 35 d6 ff ff       	call   80010b <_panic>
+
+00802ad6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ad6:	55                   	push   %ebp
+  802ad7:	89 e5                	mov    %esp,%ebp
+  802ad9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802adc:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ae1:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802ae7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802aed:	8b 52 50             	mov    0x50(%edx),%edx
+  802af0:	39 ca                	cmp    %ecx,%edx
+  802af2:	74 11                	je     802b05 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802af4:	83 c0 01             	add    $0x1,%eax
+  802af7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802afc:	75 e3                	jne    802ae1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802afe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b03:	eb 0e                	jmp    802b13 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802b05:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b0b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b10:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b13:	5d                   	pop    %ebp
+  802b14:	c3                   	ret
+
+00802b15 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b15:	55                   	push   %ebp
+  802b16:	89 e5                	mov    %esp,%ebp
+  802b18:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b1b:	89 c2                	mov    %eax,%edx
+  802b1d:	c1 ea 16             	shr    $0x16,%edx
+  802b20:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b27:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b2c:	f6 c1 01             	test   $0x1,%cl
+  802b2f:	74 1a                	je     802b4b <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b31:	c1 e8 0c             	shr    $0xc,%eax
+  802b34:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b3b:	a8 01                	test   $0x1,%al
+  802b3d:	74 0c                	je     802b4b <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b3f:	c1 e8 0c             	shr    $0xc,%eax
+  802b42:	c1 e0 04             	shl    $0x4,%eax
+  802b45:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b4b:	89 d0                	mov    %edx,%eax
+  802b4d:	5d                   	pop    %ebp
+  802b4e:	c3                   	ret
@@ -0,0 +1,6449 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fc 00 00 00       	call   80012d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <cat>:
+
+char buf[8192];
+
+void
+cat(int f, char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	68 00 20 00 00       	push   $0x2000
+  800043:	68 20 50 80 00       	push   $0x805020
+  800048:	56                   	push   %esi
+  800049:	e8 37 1b 00 00       	call   801b85 <read>
+  80004e:	89 c3                	mov    %eax,%ebx
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	7e 2f                	jle    800086 <cat+0x53>
+		if ((r = write(1, buf, n)) != n)
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	53                   	push   %ebx
+  80005b:	68 20 50 80 00       	push   $0x805020
+  800060:	6a 01                	push   $0x1
+  800062:	e8 0c 1c 00 00       	call   801c73 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c3                	cmp    %eax,%ebx
+  80006c:	74 cd                	je     80003b <cat+0x8>
+			panic("write error copying %s: %e", s, r);
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	50                   	push   %eax
+  800072:	ff 75 0c             	push   0xc(%ebp)
+  800075:	68 60 2d 80 00       	push   $0x802d60
+  80007a:	6a 0d                	push   $0xd
+  80007c:	68 7b 2d 80 00       	push   $0x802d7b
+  800081:	e8 6b 01 00 00       	call   8001f1 <_panic>
+	if (n < 0)
+  800086:	78 07                	js     80008f <cat+0x5c>
+		panic("error reading %s: %e", s, n);
+}
+  800088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5d                   	pop    %ebp
+  80008e:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	50                   	push   %eax
+  800093:	ff 75 0c             	push   0xc(%ebp)
+  800096:	68 86 2d 80 00       	push   $0x802d86
+  80009b:	6a 0f                	push   $0xf
+  80009d:	68 7b 2d 80 00       	push   $0x802d7b
+  8000a2:	e8 4a 01 00 00       	call   8001f1 <_panic>
+
+008000a7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int f, i;
+
+	binaryname = "cat";
+  8000b3:	c7 05 00 40 80 00 9b 	movl   $0x802d9b,0x804000
+  8000ba:	2d 80 00 
+	if (argc == 1)
+		cat(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  8000bd:	be 01 00 00 00       	mov    $0x1,%esi
+	if (argc == 1)
+  8000c2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c6:	75 31                	jne    8000f9 <umain+0x52>
+		cat(0, "<stdin>");
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 9f 2d 80 00       	push   $0x802d9f
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	e8 5c ff ff ff       	call   800033 <cat>
+  8000d7:	83 c4 10             	add    $0x10,%esp
+			else {
+				cat(f, argv[i]);
+				close(f);
+			}
+		}
+}
+  8000da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000dd:	5b                   	pop    %ebx
+  8000de:	5e                   	pop    %esi
+  8000df:	5f                   	pop    %edi
+  8000e0:	5d                   	pop    %ebp
+  8000e1:	c3                   	ret
+				printf("can't open %s: %e\n", argv[i], f);
+  8000e2:	83 ec 04             	sub    $0x4,%esp
+  8000e5:	50                   	push   %eax
+  8000e6:	ff 34 b7             	push   (%edi,%esi,4)
+  8000e9:	68 a7 2d 80 00       	push   $0x802da7
+  8000ee:	e8 f8 20 00 00       	call   8021eb <printf>
+  8000f3:	83 c4 10             	add    $0x10,%esp
+		for (i = 1; i < argc; i++) {
+  8000f6:	83 c6 01             	add    $0x1,%esi
+  8000f9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8000fc:	7d dc                	jge    8000da <umain+0x33>
+			f = open(argv[i], O_RDONLY);
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+  800101:	6a 00                	push   $0x0
+  800103:	ff 34 b7             	push   (%edi,%esi,4)
+  800106:	e8 3d 1f 00 00       	call   802048 <open>
+  80010b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	78 ce                	js     8000e2 <umain+0x3b>
+				cat(f, argv[i]);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	ff 34 b7             	push   (%edi,%esi,4)
+  80011a:	50                   	push   %eax
+  80011b:	e8 13 ff ff ff       	call   800033 <cat>
+				close(f);
+  800120:	89 1c 24             	mov    %ebx,(%esp)
+  800123:	e8 21 19 00 00       	call   801a49 <close>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	eb c9                	jmp    8000f6 <umain+0x4f>
+
+0080012d <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	57                   	push   %edi
+  800131:	56                   	push   %esi
+  800132:	53                   	push   %ebx
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800139:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80013c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800141:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800143:	c1 ea 0b             	shr    $0xb,%edx
+  800146:	83 f2 01             	xor    $0x1,%edx
+  800149:	83 e2 01             	and    $0x1,%edx
+  80014c:	88 15 24 70 80 00    	mov    %dl,0x807024
+
+	mainenv = NULL;
+  800152:	c7 05 20 70 80 00 00 	movl   $0x0,0x807020
+  800159:	00 00 00 
+	envid = sys_getenvid();
+  80015c:	e8 1f 0c 00 00       	call   800d80 <sys_getenvid>
+  800161:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800168:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80016e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800174:	8b 52 48             	mov    0x48(%edx),%edx
+  800177:	39 ca                	cmp    %ecx,%edx
+  800179:	74 27                	je     8001a2 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80017b:	83 c0 01             	add    $0x1,%eax
+  80017e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800183:	75 e3                	jne    800168 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800185:	83 3d 20 70 80 00 00 	cmpl   $0x0,0x807020
+  80018c:	75 24                	jne    8001b2 <libmain+0x85>
+		panic("libmain can't find the environment");
+  80018e:	83 ec 04             	sub    $0x4,%esp
+  800191:	68 bc 2d 80 00       	push   $0x802dbc
+  800196:	6a 23                	push   $0x23
+  800198:	68 df 2d 80 00       	push   $0x802ddf
+  80019d:	e8 4f 00 00 00       	call   8001f1 <_panic>
+			mainenv = &envs[i];
+  8001a2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001a8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ad:	a3 20 70 80 00       	mov    %eax,0x807020
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001b2:	85 ff                	test   %edi,%edi
+  8001b4:	7e 07                	jle    8001bd <libmain+0x90>
+		binaryname = argv[0];
+  8001b6:	8b 06                	mov    (%esi),%eax
+  8001b8:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001bd:	83 ec 08             	sub    $0x8,%esp
+  8001c0:	56                   	push   %esi
+  8001c1:	57                   	push   %edi
+  8001c2:	e8 e0 fe ff ff       	call   8000a7 <umain>
+
+	// exit gracefully
+	exit();
+  8001c7:	e8 0b 00 00 00       	call   8001d7 <exit>
+}
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5e                   	pop    %esi
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+
+008001d7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001dd:	e8 94 18 00 00       	call   801a76 <close_all>
+	sys_env_destroy(0);
+  8001e2:	83 ec 0c             	sub    $0xc,%esp
+  8001e5:	6a 00                	push   $0x0
+  8001e7:	e8 2b 0b 00 00       	call   800d17 <sys_env_destroy>
+}
+  8001ec:	83 c4 10             	add    $0x10,%esp
+  8001ef:	c9                   	leave
+  8001f0:	c3                   	ret
+
+008001f1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f1:	55                   	push   %ebp
+  8001f2:	89 e5                	mov    %esp,%ebp
+  8001f4:	56                   	push   %esi
+  8001f5:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001f6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001f9:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001ff:	e8 7c 0b 00 00       	call   800d80 <sys_getenvid>
+  800204:	83 ec 0c             	sub    $0xc,%esp
+  800207:	ff 75 0c             	push   0xc(%ebp)
+  80020a:	ff 75 08             	push   0x8(%ebp)
+  80020d:	56                   	push   %esi
+  80020e:	50                   	push   %eax
+  80020f:	68 f8 2d 80 00       	push   $0x802df8
+  800214:	e8 b3 00 00 00       	call   8002cc <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800219:	83 c4 18             	add    $0x18,%esp
+  80021c:	53                   	push   %ebx
+  80021d:	ff 75 10             	push   0x10(%ebp)
+  800220:	e8 56 00 00 00       	call   80027b <vcprintf>
+	cprintf("\n");
+  800225:	c7 04 24 6c 32 80 00 	movl   $0x80326c,(%esp)
+  80022c:	e8 9b 00 00 00       	call   8002cc <cprintf>
+  800231:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800234:	cc                   	int3
+	while (1)
+  800235:	eb fd                	jmp    800234 <_panic+0x43>
+
+00800237 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	53                   	push   %ebx
+  80023b:	83 ec 04             	sub    $0x4,%esp
+  80023e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800241:	8b 13                	mov    (%ebx),%edx
+  800243:	8d 42 01             	lea    0x1(%edx),%eax
+  800246:	89 03                	mov    %eax,(%ebx)
+  800248:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80024b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80024f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800254:	74 09                	je     80025f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800256:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80025a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80025d:	c9                   	leave
+  80025e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80025f:	83 ec 08             	sub    $0x8,%esp
+  800262:	68 ff 00 00 00       	push   $0xff
+  800267:	8d 43 08             	lea    0x8(%ebx),%eax
+  80026a:	50                   	push   %eax
+  80026b:	e8 1d 0a 00 00       	call   800c8d <sys_cputs>
+		b->idx = 0;
+  800270:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	eb db                	jmp    800256 <putch+0x1f>
+
+0080027b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80027b:	55                   	push   %ebp
+  80027c:	89 e5                	mov    %esp,%ebp
+  80027e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800284:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80028b:	00 00 00 
+	b.cnt = 0;
+  80028e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800295:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800298:	ff 75 0c             	push   0xc(%ebp)
+  80029b:	ff 75 08             	push   0x8(%ebp)
+  80029e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002a4:	50                   	push   %eax
+  8002a5:	68 37 02 80 00       	push   $0x800237
+  8002aa:	e8 fb 00 00 00       	call   8003aa <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002af:	83 c4 08             	add    $0x8,%esp
+  8002b2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002b8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002be:	50                   	push   %eax
+  8002bf:	e8 c9 09 00 00       	call   800c8d <sys_cputs>
+
+	return b.cnt;
+}
+  8002c4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002ca:	c9                   	leave
+  8002cb:	c3                   	ret
+
+008002cc <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002d2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002d5:	50                   	push   %eax
+  8002d6:	ff 75 08             	push   0x8(%ebp)
+  8002d9:	e8 9d ff ff ff       	call   80027b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002de:	c9                   	leave
+  8002df:	c3                   	ret
+
+008002e0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	57                   	push   %edi
+  8002e4:	56                   	push   %esi
+  8002e5:	53                   	push   %ebx
+  8002e6:	83 ec 1c             	sub    $0x1c,%esp
+  8002e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002ec:	89 d6                	mov    %edx,%esi
+  8002ee:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002f4:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002f7:	73 0b                	jae    800304 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002fc:	c1 e7 08             	shl    $0x8,%edi
+  8002ff:	0b 7d 10             	or     0x10(%ebp),%edi
+  800302:	eb 36                	jmp    80033a <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800304:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800307:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030c:	f7 75 08             	divl   0x8(%ebp)
+  80030f:	89 c1                	mov    %eax,%ecx
+  800311:	ff 75 14             	push   0x14(%ebp)
+  800314:	ff 75 10             	push   0x10(%ebp)
+  800317:	83 eb 01             	sub    $0x1,%ebx
+  80031a:	53                   	push   %ebx
+  80031b:	ff 75 08             	push   0x8(%ebp)
+  80031e:	89 f2                	mov    %esi,%edx
+  800320:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800323:	e8 b8 ff ff ff       	call   8002e0 <printnum>
+  800328:	83 c4 10             	add    $0x10,%esp
+  80032b:	eb 14                	jmp    800341 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80032d:	83 ec 08             	sub    $0x8,%esp
+  800330:	56                   	push   %esi
+  800331:	57                   	push   %edi
+  800332:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800335:	ff d0                	call   *%eax
+  800337:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80033a:	83 eb 01             	sub    $0x1,%ebx
+  80033d:	85 db                	test   %ebx,%ebx
+  80033f:	7f ec                	jg     80032d <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800341:	83 ec 08             	sub    $0x8,%esp
+  800344:	56                   	push   %esi
+  800345:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034d:	f7 75 08             	divl   0x8(%ebp)
+  800350:	0f be 92 1b 2e 80 00 	movsbl 0x802e1b(%edx),%edx
+  800357:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035a:	c1 e0 08             	shl    $0x8,%eax
+  80035d:	09 d0                	or     %edx,%eax
+  80035f:	50                   	push   %eax
+  800360:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800363:	ff d0                	call   *%eax
+}
+  800365:	83 c4 10             	add    $0x10,%esp
+  800368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80036b:	5b                   	pop    %ebx
+  80036c:	5e                   	pop    %esi
+  80036d:	5f                   	pop    %edi
+  80036e:	5d                   	pop    %ebp
+  80036f:	c3                   	ret
+
+00800370 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800370:	55                   	push   %ebp
+  800371:	89 e5                	mov    %esp,%ebp
+  800373:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800376:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80037a:	8b 10                	mov    (%eax),%edx
+  80037c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80037f:	73 0a                	jae    80038b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800381:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800384:	89 08                	mov    %ecx,(%eax)
+  800386:	8b 45 08             	mov    0x8(%ebp),%eax
+  800389:	88 02                	mov    %al,(%edx)
+}
+  80038b:	5d                   	pop    %ebp
+  80038c:	c3                   	ret
+
+0080038d <printfmt>:
+{
+  80038d:	55                   	push   %ebp
+  80038e:	89 e5                	mov    %esp,%ebp
+  800390:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800393:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800396:	50                   	push   %eax
+  800397:	ff 75 10             	push   0x10(%ebp)
+  80039a:	ff 75 0c             	push   0xc(%ebp)
+  80039d:	ff 75 08             	push   0x8(%ebp)
+  8003a0:	e8 05 00 00 00       	call   8003aa <vprintfmt>
+}
+  8003a5:	83 c4 10             	add    $0x10,%esp
+  8003a8:	c9                   	leave
+  8003a9:	c3                   	ret
+
+008003aa <vprintfmt>:
+{
+  8003aa:	55                   	push   %ebp
+  8003ab:	89 e5                	mov    %esp,%ebp
+  8003ad:	57                   	push   %edi
+  8003ae:	56                   	push   %esi
+  8003af:	53                   	push   %ebx
+  8003b0:	83 ec 3c             	sub    $0x3c,%esp
+  8003b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8003b6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8003b9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003c0:	eb 16                	jmp    8003d8 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8003c2:	83 ec 08             	sub    $0x8,%esp
+  8003c5:	ff 75 0c             	push   0xc(%ebp)
+  8003c8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003cb:	c1 e2 08             	shl    $0x8,%edx
+  8003ce:	09 d0                	or     %edx,%eax
+  8003d0:	50                   	push   %eax
+  8003d1:	ff d7                	call   *%edi
+  8003d3:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003d6:	89 de                	mov    %ebx,%esi
+  8003d8:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003db:	0f b6 06             	movzbl (%esi),%eax
+  8003de:	83 f8 25             	cmp    $0x25,%eax
+  8003e1:	74 0c                	je     8003ef <vprintfmt+0x45>
+			if (ch == '\0')
+  8003e3:	85 c0                	test   %eax,%eax
+  8003e5:	75 db                	jne    8003c2 <vprintfmt+0x18>
+}
+  8003e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ea:	5b                   	pop    %ebx
+  8003eb:	5e                   	pop    %esi
+  8003ec:	5f                   	pop    %edi
+  8003ed:	5d                   	pop    %ebp
+  8003ee:	c3                   	ret
+		padc = ' ';
+  8003ef:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003f3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003fa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800401:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800408:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80040d:	8d 73 01             	lea    0x1(%ebx),%esi
+  800410:	0f b6 13             	movzbl (%ebx),%edx
+  800413:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800416:	3c 55                	cmp    $0x55,%al
+  800418:	0f 87 2c 04 00 00    	ja     80084a <vprintfmt+0x4a0>
+  80041e:	0f b6 c0             	movzbl %al,%eax
+  800421:	ff 24 85 60 2f 80 00 	jmp    *0x802f60(,%eax,4)
+  800428:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80042a:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80042e:	eb dd                	jmp    80040d <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800430:	89 f3                	mov    %esi,%ebx
+  800432:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800436:	eb d5                	jmp    80040d <vprintfmt+0x63>
+  800438:	0f b6 d2             	movzbl %dl,%edx
+  80043b:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80043d:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800442:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800445:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800449:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80044c:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80044f:	83 fe 09             	cmp    $0x9,%esi
+  800452:	0f 87 8a 00 00 00    	ja     8004e2 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800458:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80045b:	eb e5                	jmp    800442 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80045d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800460:	8b 00                	mov    (%eax),%eax
+  800462:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800465:	8b 45 14             	mov    0x14(%ebp),%eax
+  800468:	8d 40 04             	lea    0x4(%eax),%eax
+  80046b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80046e:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800470:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800474:	79 97                	jns    80040d <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800476:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800479:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800483:	eb 88                	jmp    80040d <vprintfmt+0x63>
+			if (width < 0)
+  800485:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800488:	85 db                	test   %ebx,%ebx
+  80048a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048f:	0f 49 c3             	cmovns %ebx,%eax
+  800492:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800495:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800497:	e9 71 ff ff ff       	jmp    80040d <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049c:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80049e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004a5:	e9 63 ff ff ff       	jmp    80040d <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8004aa:	8d 73 02             	lea    0x2(%ebx),%esi
+  8004ad:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8004b1:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8004b8:	3c 67                	cmp    $0x67,%al
+  8004ba:	0f 84 18 ff ff ff    	je     8003d8 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8004c0:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8004c7:	3c 72                	cmp    $0x72,%al
+  8004c9:	0f 84 09 ff ff ff    	je     8003d8 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004cf:	3c 62                	cmp    $0x62,%al
+  8004d1:	0f 94 c0             	sete   %al
+  8004d4:	0f b6 c0             	movzbl %al,%eax
+  8004d7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004da:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004dd:	e9 f6 fe ff ff       	jmp    8003d8 <vprintfmt+0x2e>
+  8004e2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004e5:	eb 89                	jmp    800470 <vprintfmt+0xc6>
+			lflag++;
+  8004e7:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ea:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004ec:	e9 1c ff ff ff       	jmp    80040d <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f4:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004f7:	83 ec 08             	sub    $0x8,%esp
+  8004fa:	ff 75 0c             	push   0xc(%ebp)
+  8004fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800500:	c1 e0 08             	shl    $0x8,%eax
+  800503:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800506:	0b 01                	or     (%ecx),%eax
+  800508:	50                   	push   %eax
+  800509:	ff d7                	call   *%edi
+			break;
+  80050b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80050e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800511:	e9 c2 fe ff ff       	jmp    8003d8 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800516:	8b 45 14             	mov    0x14(%ebp),%eax
+  800519:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80051c:	8b 10                	mov    (%eax),%edx
+  80051e:	89 d0                	mov    %edx,%eax
+  800520:	f7 d8                	neg    %eax
+  800522:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800525:	83 f8 12             	cmp    $0x12,%eax
+  800528:	7f 25                	jg     80054f <vprintfmt+0x1a5>
+  80052a:	8b 14 85 c0 30 80 00 	mov    0x8030c0(,%eax,4),%edx
+  800531:	85 d2                	test   %edx,%edx
+  800533:	74 1a                	je     80054f <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800535:	52                   	push   %edx
+  800536:	68 01 32 80 00       	push   $0x803201
+  80053b:	ff 75 0c             	push   0xc(%ebp)
+  80053e:	57                   	push   %edi
+  80053f:	e8 49 fe ff ff       	call   80038d <printfmt>
+  800544:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800547:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80054a:	e9 89 fe ff ff       	jmp    8003d8 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80054f:	50                   	push   %eax
+  800550:	68 33 2e 80 00       	push   $0x802e33
+  800555:	ff 75 0c             	push   0xc(%ebp)
+  800558:	57                   	push   %edi
+  800559:	e8 2f fe ff ff       	call   80038d <printfmt>
+  80055e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800561:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800564:	e9 6f fe ff ff       	jmp    8003d8 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800569:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056c:	83 c0 04             	add    $0x4,%eax
+  80056f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800572:	8b 45 14             	mov    0x14(%ebp),%eax
+  800575:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800577:	85 c9                	test   %ecx,%ecx
+  800579:	b8 2c 2e 80 00       	mov    $0x802e2c,%eax
+  80057e:	0f 45 c1             	cmovne %ecx,%eax
+  800581:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800584:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800588:	7e 06                	jle    800590 <vprintfmt+0x1e6>
+  80058a:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80058e:	75 1a                	jne    8005aa <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800590:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800593:	c1 e0 08             	shl    $0x8,%eax
+  800596:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800599:	83 c8 3f             	or     $0x3f,%eax
+  80059c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80059f:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8005a2:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005a5:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8005a8:	eb 6d                	jmp    800617 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005aa:	83 ec 08             	sub    $0x8,%esp
+  8005ad:	ff 75 d0             	push   -0x30(%ebp)
+  8005b0:	ff 75 c8             	push   -0x38(%ebp)
+  8005b3:	e8 39 03 00 00       	call   8008f1 <strnlen>
+  8005b8:	89 c2                	mov    %eax,%edx
+  8005ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005bd:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8005bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005c2:	c1 e1 08             	shl    $0x8,%ecx
+  8005c5:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8005c9:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cb:	83 c4 10             	add    $0x10,%esp
+  8005ce:	89 c3                	mov    %eax,%ebx
+  8005d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005d6:	89 ce                	mov    %ecx,%esi
+  8005d8:	eb 0f                	jmp    8005e9 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005da:	83 ec 08             	sub    $0x8,%esp
+  8005dd:	ff 75 0c             	push   0xc(%ebp)
+  8005e0:	56                   	push   %esi
+  8005e1:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005e3:	83 eb 01             	sub    $0x1,%ebx
+  8005e6:	83 c4 10             	add    $0x10,%esp
+  8005e9:	85 db                	test   %ebx,%ebx
+  8005eb:	7f ed                	jg     8005da <vprintfmt+0x230>
+  8005ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005f3:	85 c0                	test   %eax,%eax
+  8005f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005fa:	0f 49 d0             	cmovns %eax,%edx
+  8005fd:	29 d0                	sub    %edx,%eax
+  8005ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800602:	eb 8c                	jmp    800590 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800604:	83 ec 08             	sub    $0x8,%esp
+  800607:	ff 75 0c             	push   0xc(%ebp)
+  80060a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80060d:	09 c2                	or     %eax,%edx
+  80060f:	52                   	push   %edx
+  800610:	ff d7                	call   *%edi
+  800612:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800615:	89 d9                	mov    %ebx,%ecx
+  800617:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80061a:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80061e:	0f be d0             	movsbl %al,%edx
+  800621:	85 d2                	test   %edx,%edx
+  800623:	74 2a                	je     80064f <vprintfmt+0x2a5>
+  800625:	85 f6                	test   %esi,%esi
+  800627:	78 05                	js     80062e <vprintfmt+0x284>
+  800629:	83 ee 01             	sub    $0x1,%esi
+  80062c:	78 3b                	js     800669 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80062e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800632:	74 d0                	je     800604 <vprintfmt+0x25a>
+  800634:	0f be c0             	movsbl %al,%eax
+  800637:	83 e8 20             	sub    $0x20,%eax
+  80063a:	83 f8 5e             	cmp    $0x5e,%eax
+  80063d:	76 c5                	jbe    800604 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80063f:	83 ec 08             	sub    $0x8,%esp
+  800642:	ff 75 0c             	push   0xc(%ebp)
+  800645:	ff 75 cc             	push   -0x34(%ebp)
+  800648:	ff d7                	call   *%edi
+  80064a:	83 c4 10             	add    $0x10,%esp
+  80064d:	eb c6                	jmp    800615 <vprintfmt+0x26b>
+  80064f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800652:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800655:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800658:	01 c3                	add    %eax,%ebx
+  80065a:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80065c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80065f:	83 c8 20             	or     $0x20,%eax
+  800662:	89 75 10             	mov    %esi,0x10(%ebp)
+  800665:	89 c6                	mov    %eax,%esi
+  800667:	eb 14                	jmp    80067d <vprintfmt+0x2d3>
+  800669:	8b 75 10             	mov    0x10(%ebp),%esi
+  80066c:	eb e4                	jmp    800652 <vprintfmt+0x2a8>
+  80066e:	83 ec 08             	sub    $0x8,%esp
+  800671:	ff 75 0c             	push   0xc(%ebp)
+  800674:	56                   	push   %esi
+  800675:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800677:	83 eb 01             	sub    $0x1,%ebx
+  80067a:	83 c4 10             	add    $0x10,%esp
+  80067d:	85 db                	test   %ebx,%ebx
+  80067f:	7f ed                	jg     80066e <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800681:	8b 75 10             	mov    0x10(%ebp),%esi
+  800684:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800687:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068a:	e9 49 fd ff ff       	jmp    8003d8 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80068f:	83 f9 01             	cmp    $0x1,%ecx
+  800692:	7f 1f                	jg     8006b3 <vprintfmt+0x309>
+	else if (lflag)
+  800694:	85 c9                	test   %ecx,%ecx
+  800696:	74 69                	je     800701 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 00                	mov    (%eax),%eax
+  80069d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a0:	89 c1                	mov    %eax,%ecx
+  8006a2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006a5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ae:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b1:	eb 17                	jmp    8006ca <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8b 50 04             	mov    0x4(%eax),%edx
+  8006b9:	8b 00                	mov    (%eax),%eax
+  8006bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006be:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ca:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006cd:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006d5:	85 db                	test   %ebx,%ebx
+  8006d7:	0f 89 f6 00 00 00    	jns    8007d3 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006dd:	83 ec 08             	sub    $0x8,%esp
+  8006e0:	ff 75 0c             	push   0xc(%ebp)
+  8006e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006e6:	c1 e0 08             	shl    $0x8,%eax
+  8006e9:	83 c8 2d             	or     $0x2d,%eax
+  8006ec:	50                   	push   %eax
+  8006ed:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006ef:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006f2:	f7 d9                	neg    %ecx
+  8006f4:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006fc:	e9 d2 00 00 00       	jmp    8007d3 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 00                	mov    (%eax),%eax
+  800706:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800709:	89 c1                	mov    %eax,%ecx
+  80070b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80070e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8d 40 04             	lea    0x4(%eax),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071a:	eb ae                	jmp    8006ca <vprintfmt+0x320>
+	if (lflag >= 2)
+  80071c:	83 f9 01             	cmp    $0x1,%ecx
+  80071f:	7f 19                	jg     80073a <vprintfmt+0x390>
+	else if (lflag)
+  800721:	85 c9                	test   %ecx,%ecx
+  800723:	74 2a                	je     80074f <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800725:	8b 45 14             	mov    0x14(%ebp),%eax
+  800728:	8b 08                	mov    (%eax),%ecx
+  80072a:	8d 40 04             	lea    0x4(%eax),%eax
+  80072d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800730:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800735:	e9 99 00 00 00       	jmp    8007d3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80073a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073d:	8b 08                	mov    (%eax),%ecx
+  80073f:	8d 40 08             	lea    0x8(%eax),%eax
+  800742:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800745:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80074a:	e9 84 00 00 00       	jmp    8007d3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80074f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800752:	8b 08                	mov    (%eax),%ecx
+  800754:	8d 40 04             	lea    0x4(%eax),%eax
+  800757:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80075a:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  80075f:	eb 72                	jmp    8007d3 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800761:	83 f9 01             	cmp    $0x1,%ecx
+  800764:	7f 16                	jg     80077c <vprintfmt+0x3d2>
+	else if (lflag)
+  800766:	85 c9                	test   %ecx,%ecx
+  800768:	74 24                	je     80078e <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80076a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076d:	8b 08                	mov    (%eax),%ecx
+  80076f:	8d 40 04             	lea    0x4(%eax),%eax
+  800772:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800775:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80077a:	eb 57                	jmp    8007d3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8b 08                	mov    (%eax),%ecx
+  800781:	8d 40 08             	lea    0x8(%eax),%eax
+  800784:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800787:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80078c:	eb 45                	jmp    8007d3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80078e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800791:	8b 08                	mov    (%eax),%ecx
+  800793:	8d 40 04             	lea    0x4(%eax),%eax
+  800796:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800799:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80079e:	eb 33                	jmp    8007d3 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8007a0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007a3:	c1 e3 08             	shl    $0x8,%ebx
+  8007a6:	83 ec 08             	sub    $0x8,%esp
+  8007a9:	ff 75 0c             	push   0xc(%ebp)
+  8007ac:	89 d8                	mov    %ebx,%eax
+  8007ae:	83 c8 30             	or     $0x30,%eax
+  8007b1:	50                   	push   %eax
+  8007b2:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8007b4:	83 c4 08             	add    $0x8,%esp
+  8007b7:	ff 75 0c             	push   0xc(%ebp)
+  8007ba:	83 cb 78             	or     $0x78,%ebx
+  8007bd:	53                   	push   %ebx
+  8007be:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c3:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8007c5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ce:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007d3:	ff 75 e4             	push   -0x1c(%ebp)
+  8007d6:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007da:	52                   	push   %edx
+  8007db:	ff 75 e0             	push   -0x20(%ebp)
+  8007de:	50                   	push   %eax
+  8007df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e2:	89 f8                	mov    %edi,%eax
+  8007e4:	e8 f7 fa ff ff       	call   8002e0 <printnum>
+			break;
+  8007e9:	83 c4 10             	add    $0x10,%esp
+  8007ec:	e9 e7 fb ff ff       	jmp    8003d8 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007f1:	83 f9 01             	cmp    $0x1,%ecx
+  8007f4:	7f 16                	jg     80080c <vprintfmt+0x462>
+	else if (lflag)
+  8007f6:	85 c9                	test   %ecx,%ecx
+  8007f8:	74 24                	je     80081e <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fd:	8b 08                	mov    (%eax),%ecx
+  8007ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800802:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800805:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80080a:	eb c7                	jmp    8007d3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80080c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080f:	8b 08                	mov    (%eax),%ecx
+  800811:	8d 40 08             	lea    0x8(%eax),%eax
+  800814:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800817:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80081c:	eb b5                	jmp    8007d3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80081e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800821:	8b 08                	mov    (%eax),%ecx
+  800823:	8d 40 04             	lea    0x4(%eax),%eax
+  800826:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800829:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80082e:	eb a3                	jmp    8007d3 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800830:	83 ec 08             	sub    $0x8,%esp
+  800833:	ff 75 0c             	push   0xc(%ebp)
+  800836:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800839:	c1 e0 08             	shl    $0x8,%eax
+  80083c:	83 c8 25             	or     $0x25,%eax
+  80083f:	50                   	push   %eax
+  800840:	ff d7                	call   *%edi
+			break;
+  800842:	83 c4 10             	add    $0x10,%esp
+  800845:	e9 8e fb ff ff       	jmp    8003d8 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80084a:	83 ec 08             	sub    $0x8,%esp
+  80084d:	ff 75 0c             	push   0xc(%ebp)
+  800850:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800853:	c1 e0 08             	shl    $0x8,%eax
+  800856:	83 c8 25             	or     $0x25,%eax
+  800859:	50                   	push   %eax
+  80085a:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80085c:	83 c4 10             	add    $0x10,%esp
+  80085f:	89 de                	mov    %ebx,%esi
+  800861:	eb 03                	jmp    800866 <vprintfmt+0x4bc>
+  800863:	83 ee 01             	sub    $0x1,%esi
+  800866:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80086a:	75 f7                	jne    800863 <vprintfmt+0x4b9>
+  80086c:	e9 67 fb ff ff       	jmp    8003d8 <vprintfmt+0x2e>
+
+00800871 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800871:	55                   	push   %ebp
+  800872:	89 e5                	mov    %esp,%ebp
+  800874:	83 ec 18             	sub    $0x18,%esp
+  800877:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80087d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800880:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800884:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800887:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80088e:	85 c0                	test   %eax,%eax
+  800890:	74 26                	je     8008b8 <vsnprintf+0x47>
+  800892:	85 d2                	test   %edx,%edx
+  800894:	7e 22                	jle    8008b8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800896:	ff 75 14             	push   0x14(%ebp)
+  800899:	ff 75 10             	push   0x10(%ebp)
+  80089c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80089f:	50                   	push   %eax
+  8008a0:	68 70 03 80 00       	push   $0x800370
+  8008a5:	e8 00 fb ff ff       	call   8003aa <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008ad:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008b3:	83 c4 10             	add    $0x10,%esp
+}
+  8008b6:	c9                   	leave
+  8008b7:	c3                   	ret
+		return -E_INVAL;
+  8008b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008bd:	eb f7                	jmp    8008b6 <vsnprintf+0x45>
+
+008008bf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8008c5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008c8:	50                   	push   %eax
+  8008c9:	ff 75 10             	push   0x10(%ebp)
+  8008cc:	ff 75 0c             	push   0xc(%ebp)
+  8008cf:	ff 75 08             	push   0x8(%ebp)
+  8008d2:	e8 9a ff ff ff       	call   800871 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008d7:	c9                   	leave
+  8008d8:	c3                   	ret
+
+008008d9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e4:	eb 03                	jmp    8008e9 <strlen+0x10>
+		n++;
+  8008e6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008e9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008ed:	75 f7                	jne    8008e6 <strlen+0xd>
+	return n;
+}
+  8008ef:	5d                   	pop    %ebp
+  8008f0:	c3                   	ret
+
+008008f1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008f1:	55                   	push   %ebp
+  8008f2:	89 e5                	mov    %esp,%ebp
+  8008f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ff:	eb 03                	jmp    800904 <strnlen+0x13>
+		n++;
+  800901:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800904:	39 d0                	cmp    %edx,%eax
+  800906:	74 08                	je     800910 <strnlen+0x1f>
+  800908:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80090c:	75 f3                	jne    800901 <strnlen+0x10>
+  80090e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800910:	89 d0                	mov    %edx,%eax
+  800912:	5d                   	pop    %ebp
+  800913:	c3                   	ret
+
+00800914 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800914:	55                   	push   %ebp
+  800915:	89 e5                	mov    %esp,%ebp
+  800917:	53                   	push   %ebx
+  800918:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80091e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800923:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800927:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80092a:	83 c0 01             	add    $0x1,%eax
+  80092d:	84 d2                	test   %dl,%dl
+  80092f:	75 f2                	jne    800923 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800931:	89 c8                	mov    %ecx,%eax
+  800933:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800936:	c9                   	leave
+  800937:	c3                   	ret
+
+00800938 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	53                   	push   %ebx
+  80093c:	83 ec 10             	sub    $0x10,%esp
+  80093f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800942:	53                   	push   %ebx
+  800943:	e8 91 ff ff ff       	call   8008d9 <strlen>
+  800948:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80094b:	ff 75 0c             	push   0xc(%ebp)
+  80094e:	01 d8                	add    %ebx,%eax
+  800950:	50                   	push   %eax
+  800951:	e8 be ff ff ff       	call   800914 <strcpy>
+	return dst;
+}
+  800956:	89 d8                	mov    %ebx,%eax
+  800958:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095b:	c9                   	leave
+  80095c:	c3                   	ret
+
+0080095d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80095d:	55                   	push   %ebp
+  80095e:	89 e5                	mov    %esp,%ebp
+  800960:	56                   	push   %esi
+  800961:	53                   	push   %ebx
+  800962:	8b 75 08             	mov    0x8(%ebp),%esi
+  800965:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800968:	89 f3                	mov    %esi,%ebx
+  80096a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80096d:	89 f0                	mov    %esi,%eax
+  80096f:	eb 0f                	jmp    800980 <strncpy+0x23>
+		*dst++ = *src;
+  800971:	83 c0 01             	add    $0x1,%eax
+  800974:	0f b6 0a             	movzbl (%edx),%ecx
+  800977:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80097a:	80 f9 01             	cmp    $0x1,%cl
+  80097d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800980:	39 d8                	cmp    %ebx,%eax
+  800982:	75 ed                	jne    800971 <strncpy+0x14>
+	}
+	return ret;
+}
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	5b                   	pop    %ebx
+  800987:	5e                   	pop    %esi
+  800988:	5d                   	pop    %ebp
+  800989:	c3                   	ret
+
+0080098a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	56                   	push   %esi
+  80098e:	53                   	push   %ebx
+  80098f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800992:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800995:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800998:	89 f0                	mov    %esi,%eax
+  80099a:	85 d2                	test   %edx,%edx
+  80099c:	74 21                	je     8009bf <strlcpy+0x35>
+  80099e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009a2:	89 f2                	mov    %esi,%edx
+  8009a4:	eb 09                	jmp    8009af <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009a6:	83 c1 01             	add    $0x1,%ecx
+  8009a9:	83 c2 01             	add    $0x1,%edx
+  8009ac:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009af:	39 c2                	cmp    %eax,%edx
+  8009b1:	74 09                	je     8009bc <strlcpy+0x32>
+  8009b3:	0f b6 19             	movzbl (%ecx),%ebx
+  8009b6:	84 db                	test   %bl,%bl
+  8009b8:	75 ec                	jne    8009a6 <strlcpy+0x1c>
+  8009ba:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009bc:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009bf:	29 f0                	sub    %esi,%eax
+}
+  8009c1:	5b                   	pop    %ebx
+  8009c2:	5e                   	pop    %esi
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+
+008009c5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ce:	eb 06                	jmp    8009d6 <strcmp+0x11>
+		p++, q++;
+  8009d0:	83 c1 01             	add    $0x1,%ecx
+  8009d3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009d6:	0f b6 01             	movzbl (%ecx),%eax
+  8009d9:	84 c0                	test   %al,%al
+  8009db:	74 04                	je     8009e1 <strcmp+0x1c>
+  8009dd:	3a 02                	cmp    (%edx),%al
+  8009df:	74 ef                	je     8009d0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e1:	0f b6 c0             	movzbl %al,%eax
+  8009e4:	0f b6 12             	movzbl (%edx),%edx
+  8009e7:	29 d0                	sub    %edx,%eax
+}
+  8009e9:	5d                   	pop    %ebp
+  8009ea:	c3                   	ret
+
+008009eb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009eb:	55                   	push   %ebp
+  8009ec:	89 e5                	mov    %esp,%ebp
+  8009ee:	53                   	push   %ebx
+  8009ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f5:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009f8:	eb 09                	jmp    800a03 <strncmp+0x18>
+		n--, p++, q++;
+  8009fa:	83 ea 01             	sub    $0x1,%edx
+  8009fd:	83 c0 01             	add    $0x1,%eax
+  800a00:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a03:	85 d2                	test   %edx,%edx
+  800a05:	74 18                	je     800a1f <strncmp+0x34>
+  800a07:	0f b6 18             	movzbl (%eax),%ebx
+  800a0a:	84 db                	test   %bl,%bl
+  800a0c:	74 04                	je     800a12 <strncmp+0x27>
+  800a0e:	3a 19                	cmp    (%ecx),%bl
+  800a10:	74 e8                	je     8009fa <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a12:	0f b6 00             	movzbl (%eax),%eax
+  800a15:	0f b6 11             	movzbl (%ecx),%edx
+  800a18:	29 d0                	sub    %edx,%eax
+}
+  800a1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a1d:	c9                   	leave
+  800a1e:	c3                   	ret
+		return 0;
+  800a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a24:	eb f4                	jmp    800a1a <strncmp+0x2f>
+
+00800a26 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a30:	eb 03                	jmp    800a35 <strchr+0xf>
+  800a32:	83 c0 01             	add    $0x1,%eax
+  800a35:	0f b6 10             	movzbl (%eax),%edx
+  800a38:	84 d2                	test   %dl,%dl
+  800a3a:	74 06                	je     800a42 <strchr+0x1c>
+		if (*s == c)
+  800a3c:	38 ca                	cmp    %cl,%dl
+  800a3e:	75 f2                	jne    800a32 <strchr+0xc>
+  800a40:	eb 05                	jmp    800a47 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a47:	5d                   	pop    %ebp
+  800a48:	c3                   	ret
+
+00800a49 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a49:	55                   	push   %ebp
+  800a4a:	89 e5                	mov    %esp,%ebp
+  800a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a53:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a56:	38 ca                	cmp    %cl,%dl
+  800a58:	74 09                	je     800a63 <strfind+0x1a>
+  800a5a:	84 d2                	test   %dl,%dl
+  800a5c:	74 05                	je     800a63 <strfind+0x1a>
+	for (; *s; s++)
+  800a5e:	83 c0 01             	add    $0x1,%eax
+  800a61:	eb f0                	jmp    800a53 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a63:	5d                   	pop    %ebp
+  800a64:	c3                   	ret
+
+00800a65 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	57                   	push   %edi
+  800a69:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a6c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a6f:	85 c9                	test   %ecx,%ecx
+  800a71:	74 20                	je     800a93 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a73:	89 f8                	mov    %edi,%eax
+  800a75:	09 c8                	or     %ecx,%eax
+  800a77:	a8 03                	test   $0x3,%al
+  800a79:	75 12                	jne    800a8d <memset+0x28>
+		c &= 0xFF;
+  800a7b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a7f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a85:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a88:	fc                   	cld
+  800a89:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a8b:	eb 06                	jmp    800a93 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a90:	fc                   	cld
+  800a91:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a93:	89 f8                	mov    %edi,%eax
+  800a95:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a98:	c9                   	leave
+  800a99:	c3                   	ret
+
+00800a9a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	57                   	push   %edi
+  800a9e:	56                   	push   %esi
+  800a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aa5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aa8:	39 c6                	cmp    %eax,%esi
+  800aaa:	73 32                	jae    800ade <memmove+0x44>
+  800aac:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aaf:	39 d0                	cmp    %edx,%eax
+  800ab1:	73 2b                	jae    800ade <memmove+0x44>
+		s += n;
+		d += n;
+  800ab3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab6:	89 d6                	mov    %edx,%esi
+  800ab8:	09 fe                	or     %edi,%esi
+  800aba:	09 ce                	or     %ecx,%esi
+  800abc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ac2:	75 0e                	jne    800ad2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ac4:	83 ef 04             	sub    $0x4,%edi
+  800ac7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aca:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800acd:	fd                   	std
+  800ace:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad0:	eb 09                	jmp    800adb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ad2:	83 ef 01             	sub    $0x1,%edi
+  800ad5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ad8:	fd                   	std
+  800ad9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800adb:	fc                   	cld
+  800adc:	eb 1a                	jmp    800af8 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ade:	89 f2                	mov    %esi,%edx
+  800ae0:	09 c2                	or     %eax,%edx
+  800ae2:	09 ca                	or     %ecx,%edx
+  800ae4:	f6 c2 03             	test   $0x3,%dl
+  800ae7:	75 0a                	jne    800af3 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ae9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800aec:	89 c7                	mov    %eax,%edi
+  800aee:	fc                   	cld
+  800aef:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af1:	eb 05                	jmp    800af8 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800af3:	89 c7                	mov    %eax,%edi
+  800af5:	fc                   	cld
+  800af6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800af8:	5e                   	pop    %esi
+  800af9:	5f                   	pop    %edi
+  800afa:	5d                   	pop    %ebp
+  800afb:	c3                   	ret
+
+00800afc <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b02:	ff 75 10             	push   0x10(%ebp)
+  800b05:	ff 75 0c             	push   0xc(%ebp)
+  800b08:	ff 75 08             	push   0x8(%ebp)
+  800b0b:	e8 8a ff ff ff       	call   800a9a <memmove>
+}
+  800b10:	c9                   	leave
+  800b11:	c3                   	ret
+
+00800b12 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+  800b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b1d:	89 c6                	mov    %eax,%esi
+  800b1f:	03 75 10             	add    0x10(%ebp),%esi
+  800b22:	eb 06                	jmp    800b2a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b24:	83 c0 01             	add    $0x1,%eax
+  800b27:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b2a:	39 f0                	cmp    %esi,%eax
+  800b2c:	74 14                	je     800b42 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b2e:	0f b6 08             	movzbl (%eax),%ecx
+  800b31:	0f b6 1a             	movzbl (%edx),%ebx
+  800b34:	38 d9                	cmp    %bl,%cl
+  800b36:	74 ec                	je     800b24 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b38:	0f b6 c1             	movzbl %cl,%eax
+  800b3b:	0f b6 db             	movzbl %bl,%ebx
+  800b3e:	29 d8                	sub    %ebx,%eax
+  800b40:	eb 05                	jmp    800b47 <memcmp+0x35>
+	}
+
+	return 0;
+  800b42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b47:	5b                   	pop    %ebx
+  800b48:	5e                   	pop    %esi
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b54:	89 c2                	mov    %eax,%edx
+  800b56:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b59:	eb 03                	jmp    800b5e <memfind+0x13>
+  800b5b:	83 c0 01             	add    $0x1,%eax
+  800b5e:	39 d0                	cmp    %edx,%eax
+  800b60:	73 04                	jae    800b66 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b62:	38 08                	cmp    %cl,(%eax)
+  800b64:	75 f5                	jne    800b5b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b66:	5d                   	pop    %ebp
+  800b67:	c3                   	ret
+
+00800b68 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b68:	55                   	push   %ebp
+  800b69:	89 e5                	mov    %esp,%ebp
+  800b6b:	57                   	push   %edi
+  800b6c:	56                   	push   %esi
+  800b6d:	53                   	push   %ebx
+  800b6e:	83 ec 1c             	sub    $0x1c,%esp
+  800b71:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b74:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b77:	eb 03                	jmp    800b7c <strtol+0x14>
+		s++;
+  800b79:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b7c:	0f b6 06             	movzbl (%esi),%eax
+  800b7f:	3c 20                	cmp    $0x20,%al
+  800b81:	74 f6                	je     800b79 <strtol+0x11>
+  800b83:	3c 09                	cmp    $0x9,%al
+  800b85:	74 f2                	je     800b79 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b87:	3c 2b                	cmp    $0x2b,%al
+  800b89:	74 43                	je     800bce <strtol+0x66>
+	int neg = 0;
+  800b8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b90:	3c 2d                	cmp    $0x2d,%al
+  800b92:	74 44                	je     800bd8 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b94:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b9a:	75 0f                	jne    800bab <strtol+0x43>
+  800b9c:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b9f:	74 41                	je     800be2 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ba1:	85 ff                	test   %edi,%edi
+  800ba3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ba8:	0f 44 f8             	cmove  %eax,%edi
+  800bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb0:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800bb5:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800bb8:	89 fb                	mov    %edi,%ebx
+  800bba:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bbd:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800bc0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bc3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bc6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800bc9:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bcc:	eb 67                	jmp    800c35 <strtol+0xcd>
+		s++;
+  800bce:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800bd1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd6:	eb bc                	jmp    800b94 <strtol+0x2c>
+		s++, neg = 1;
+  800bd8:	83 c6 01             	add    $0x1,%esi
+  800bdb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be0:	eb b2                	jmp    800b94 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be2:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800be6:	74 0e                	je     800bf6 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800be8:	85 ff                	test   %edi,%edi
+  800bea:	75 bf                	jne    800bab <strtol+0x43>
+		s++, base = 8;
+  800bec:	83 c6 01             	add    $0x1,%esi
+  800bef:	bf 08 00 00 00       	mov    $0x8,%edi
+  800bf4:	eb b5                	jmp    800bab <strtol+0x43>
+		s += 2, base = 16;
+  800bf6:	83 c6 02             	add    $0x2,%esi
+  800bf9:	bf 10 00 00 00       	mov    $0x10,%edi
+  800bfe:	eb ab                	jmp    800bab <strtol+0x43>
+			dig = *s - '0';
+  800c00:	0f be c9             	movsbl %cl,%ecx
+  800c03:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c06:	39 f9                	cmp    %edi,%ecx
+  800c08:	7d 59                	jge    800c63 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c0a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c0e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c11:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c14:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c17:	0f af d8             	imul   %eax,%ebx
+  800c1a:	0f af d7             	imul   %edi,%edx
+  800c1d:	01 d3                	add    %edx,%ebx
+  800c1f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c22:	f7 e7                	mul    %edi
+  800c24:	01 da                	add    %ebx,%edx
+  800c26:	89 cb                	mov    %ecx,%ebx
+  800c28:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c2b:	01 c8                	add    %ecx,%eax
+  800c2d:	11 da                	adc    %ebx,%edx
+  800c2f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c32:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c38:	0f b6 08             	movzbl (%eax),%ecx
+  800c3b:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c3e:	80 fb 09             	cmp    $0x9,%bl
+  800c41:	76 bd                	jbe    800c00 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c43:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c46:	80 fb 19             	cmp    $0x19,%bl
+  800c49:	77 08                	ja     800c53 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c4b:	0f be c9             	movsbl %cl,%ecx
+  800c4e:	83 e9 57             	sub    $0x57,%ecx
+  800c51:	eb b3                	jmp    800c06 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c53:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c56:	80 fb 19             	cmp    $0x19,%bl
+  800c59:	77 08                	ja     800c63 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c5b:	0f be c9             	movsbl %cl,%ecx
+  800c5e:	83 e9 37             	sub    $0x37,%ecx
+  800c61:	eb a3                	jmp    800c06 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c63:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c66:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c69:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c6f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c73:	74 05                	je     800c7a <strtol+0x112>
+		*endptr = (char *) s;
+  800c75:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c78:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c7a:	85 c9                	test   %ecx,%ecx
+  800c7c:	74 07                	je     800c85 <strtol+0x11d>
+  800c7e:	f7 d8                	neg    %eax
+  800c80:	83 d2 00             	adc    $0x0,%edx
+  800c83:	f7 da                	neg    %edx
+}
+  800c85:	83 c4 1c             	add    $0x1c,%esp
+  800c88:	5b                   	pop    %ebx
+  800c89:	5e                   	pop    %esi
+  800c8a:	5f                   	pop    %edi
+  800c8b:	5d                   	pop    %ebp
+  800c8c:	c3                   	ret
+
+00800c8d <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c8d:	55                   	push   %ebp
+  800c8e:	89 e5                	mov    %esp,%ebp
+  800c90:	57                   	push   %edi
+  800c91:	56                   	push   %esi
+  800c92:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c93:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800c9a:	74 18                	je     800cb4 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca7:	89 c3                	mov    %eax,%ebx
+  800ca9:	89 c7                	mov    %eax,%edi
+  800cab:	89 c6                	mov    %eax,%esi
+  800cad:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800caf:	5b                   	pop    %ebx
+  800cb0:	5e                   	pop    %esi
+  800cb1:	5f                   	pop    %edi
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbf:	89 c3                	mov    %eax,%ebx
+  800cc1:	89 c7                	mov    %eax,%edi
+  800cc3:	55                   	push   %ebp
+  800cc4:	89 e5                	mov    %esp,%ebp
+  800cc6:	8d 35 ce 0c 80 00    	lea    0x800cce,%esi
+  800ccc:	0f 34                	sysenter
+  800cce:	5d                   	pop    %ebp
+		goto out;
+  800ccf:	eb de                	jmp    800caf <sys_cputs+0x22>
+
+00800cd1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	57                   	push   %edi
+  800cd5:	56                   	push   %esi
+  800cd6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cd7:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800cde:	74 19                	je     800cf9 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800ce0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cea:	89 d1                	mov    %edx,%ecx
+  800cec:	89 d3                	mov    %edx,%ebx
+  800cee:	89 d7                	mov    %edx,%edi
+  800cf0:	89 d6                	mov    %edx,%esi
+  800cf2:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cf4:	5b                   	pop    %ebx
+  800cf5:	5e                   	pop    %esi
+  800cf6:	5f                   	pop    %edi
+  800cf7:	5d                   	pop    %ebp
+  800cf8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cf9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cfe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d03:	89 d1                	mov    %edx,%ecx
+  800d05:	89 d3                	mov    %edx,%ebx
+  800d07:	89 d7                	mov    %edx,%edi
+  800d09:	55                   	push   %ebp
+  800d0a:	89 e5                	mov    %esp,%ebp
+  800d0c:	8d 35 14 0d 80 00    	lea    0x800d14,%esi
+  800d12:	0f 34                	sysenter
+  800d14:	5d                   	pop    %ebp
+		goto out;
+  800d15:	eb dd                	jmp    800cf4 <sys_cgetc+0x23>
+
+00800d17 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  800d1d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d20:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800d27:	74 21                	je     800d4a <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d2e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	89 cb                	mov    %ecx,%ebx
+  800d38:	89 cf                	mov    %ecx,%edi
+  800d3a:	89 ce                	mov    %ecx,%esi
+  800d3c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3e:	85 c0                	test   %eax,%eax
+  800d40:	7f 27                	jg     800d69 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d52:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d57:	89 cb                	mov    %ecx,%ebx
+  800d59:	89 cf                	mov    %ecx,%edi
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	8d 35 66 0d 80 00    	lea    0x800d66,%esi
+  800d64:	0f 34                	sysenter
+  800d66:	5d                   	pop    %ebp
+		goto out;
+  800d67:	eb d5                	jmp    800d3e <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d69:	83 ec 0c             	sub    $0xc,%esp
+  800d6c:	50                   	push   %eax
+  800d6d:	6a 03                	push   $0x3
+  800d6f:	68 2b 31 80 00       	push   $0x80312b
+  800d74:	6a 3f                	push   $0x3f
+  800d76:	68 48 31 80 00       	push   $0x803148
+  800d7b:	e8 71 f4 ff ff       	call   8001f1 <_panic>
+
+00800d80 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	57                   	push   %edi
+  800d84:	56                   	push   %esi
+  800d85:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d86:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800d8d:	74 19                	je     800da8 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d94:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d99:	89 d1                	mov    %edx,%ecx
+  800d9b:	89 d3                	mov    %edx,%ebx
+  800d9d:	89 d7                	mov    %edx,%edi
+  800d9f:	89 d6                	mov    %edx,%esi
+  800da1:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800da3:	5b                   	pop    %ebx
+  800da4:	5e                   	pop    %esi
+  800da5:	5f                   	pop    %edi
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dad:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db2:	89 d1                	mov    %edx,%ecx
+  800db4:	89 d3                	mov    %edx,%ebx
+  800db6:	89 d7                	mov    %edx,%edi
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	8d 35 c3 0d 80 00    	lea    0x800dc3,%esi
+  800dc1:	0f 34                	sysenter
+  800dc3:	5d                   	pop    %ebp
+		goto out;
+  800dc4:	eb dd                	jmp    800da3 <sys_getenvid+0x23>
+
+00800dc6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dc6:	55                   	push   %ebp
+  800dc7:	89 e5                	mov    %esp,%ebp
+  800dc9:	57                   	push   %edi
+  800dca:	56                   	push   %esi
+  800dcb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dcc:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800dd3:	74 19                	je     800dee <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800dd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dda:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ddf:	89 d1                	mov    %edx,%ecx
+  800de1:	89 d3                	mov    %edx,%ebx
+  800de3:	89 d7                	mov    %edx,%edi
+  800de5:	89 d6                	mov    %edx,%esi
+  800de7:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800de9:	5b                   	pop    %ebx
+  800dea:	5e                   	pop    %esi
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800df8:	89 d1                	mov    %edx,%ecx
+  800dfa:	89 d3                	mov    %edx,%ebx
+  800dfc:	89 d7                	mov    %edx,%edi
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	8d 35 09 0e 80 00    	lea    0x800e09,%esi
+  800e07:	0f 34                	sysenter
+  800e09:	5d                   	pop    %ebp
+		goto out;
+  800e0a:	eb dd                	jmp    800de9 <sys_yield+0x23>
+
+00800e0c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	57                   	push   %edi
+  800e10:	56                   	push   %esi
+  800e11:	53                   	push   %ebx
+  800e12:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e15:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800e1c:	74 23                	je     800e41 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e23:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e31:	89 f7                	mov    %esi,%edi
+  800e33:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e35:	85 c0                	test   %eax,%eax
+  800e37:	7f 29                	jg     800e62 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3c:	5b                   	pop    %ebx
+  800e3d:	5e                   	pop    %esi
+  800e3e:	5f                   	pop    %edi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e47:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	8d 35 5f 0e 80 00    	lea    0x800e5f,%esi
+  800e5d:	0f 34                	sysenter
+  800e5f:	5d                   	pop    %ebp
+		goto out;
+  800e60:	eb d3                	jmp    800e35 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e62:	83 ec 0c             	sub    $0xc,%esp
+  800e65:	50                   	push   %eax
+  800e66:	6a 04                	push   $0x4
+  800e68:	68 2b 31 80 00       	push   $0x80312b
+  800e6d:	6a 3f                	push   $0x3f
+  800e6f:	68 48 31 80 00       	push   $0x803148
+  800e74:	e8 78 f3 ff ff       	call   8001f1 <_panic>
+
+00800e79 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e79:	55                   	push   %ebp
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	57                   	push   %edi
+  800e7d:	56                   	push   %esi
+  800e7e:	53                   	push   %ebx
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+  800e82:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e85:	85 f6                	test   %esi,%esi
+  800e87:	75 09                	jne    800e92 <sys_page_map+0x19>
+  800e89:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800e90:	74 1f                	je     800eb1 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e92:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea5:	85 c0                	test   %eax,%eax
+  800ea7:	7f 27                	jg     800ed0 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ea9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eac:	5b                   	pop    %ebx
+  800ead:	5e                   	pop    %esi
+  800eae:	5f                   	pop    %edi
+  800eaf:	5d                   	pop    %ebp
+  800eb0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ebc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec2:	55                   	push   %ebp
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	8d 35 cd 0e 80 00    	lea    0x800ecd,%esi
+  800ecb:	0f 34                	sysenter
+  800ecd:	5d                   	pop    %ebp
+		goto out;
+  800ece:	eb d5                	jmp    800ea5 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+  800ed3:	50                   	push   %eax
+  800ed4:	6a 05                	push   $0x5
+  800ed6:	68 2b 31 80 00       	push   $0x80312b
+  800edb:	6a 3f                	push   $0x3f
+  800edd:	68 48 31 80 00       	push   $0x803148
+  800ee2:	e8 0a f3 ff ff       	call   8001f1 <_panic>
+
+00800ee7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	56                   	push   %esi
+  800eec:	53                   	push   %ebx
+  800eed:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ef0:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800ef7:	74 22                	je     800f1b <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efe:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	89 df                	mov    %ebx,%edi
+  800f0b:	89 de                	mov    %ebx,%esi
+  800f0d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0f:	85 c0                	test   %eax,%eax
+  800f11:	7f 28                	jg     800f3b <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f16:	5b                   	pop    %ebx
+  800f17:	5e                   	pop    %esi
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f2b:	89 df                	mov    %ebx,%edi
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	8d 35 38 0f 80 00    	lea    0x800f38,%esi
+  800f36:	0f 34                	sysenter
+  800f38:	5d                   	pop    %ebp
+		goto out;
+  800f39:	eb d4                	jmp    800f0f <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+  800f3e:	50                   	push   %eax
+  800f3f:	6a 06                	push   $0x6
+  800f41:	68 2b 31 80 00       	push   $0x80312b
+  800f46:	6a 3f                	push   $0x3f
+  800f48:	68 48 31 80 00       	push   $0x803148
+  800f4d:	e8 9f f2 ff ff       	call   8001f1 <_panic>
+
+00800f52 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	56                   	push   %esi
+  800f57:	53                   	push   %ebx
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f5b:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800f62:	74 22                	je     800f86 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f74:	89 df                	mov    %ebx,%edi
+  800f76:	89 de                	mov    %ebx,%esi
+  800f78:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	7f 28                	jg     800fa6 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f91:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f96:	89 df                	mov    %ebx,%edi
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	8d 35 a3 0f 80 00    	lea    0x800fa3,%esi
+  800fa1:	0f 34                	sysenter
+  800fa3:	5d                   	pop    %ebp
+		goto out;
+  800fa4:	eb d4                	jmp    800f7a <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa6:	83 ec 0c             	sub    $0xc,%esp
+  800fa9:	50                   	push   %eax
+  800faa:	6a 08                	push   $0x8
+  800fac:	68 2b 31 80 00       	push   $0x80312b
+  800fb1:	6a 3f                	push   $0x3f
+  800fb3:	68 48 31 80 00       	push   $0x803148
+  800fb8:	e8 34 f2 ff ff       	call   8001f1 <_panic>
+
+00800fbd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+  800fc3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fc6:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  800fcd:	74 22                	je     800ff1 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800fcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	89 df                	mov    %ebx,%edi
+  800fe1:	89 de                	mov    %ebx,%esi
+  800fe3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe5:	85 c0                	test   %eax,%eax
+  800fe7:	7f 28                	jg     801011 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fec:	5b                   	pop    %ebx
+  800fed:	5e                   	pop    %esi
+  800fee:	5f                   	pop    %edi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ff1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffc:	b8 09 00 00 00       	mov    $0x9,%eax
+  801001:	89 df                	mov    %ebx,%edi
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	8d 35 0e 10 80 00    	lea    0x80100e,%esi
+  80100c:	0f 34                	sysenter
+  80100e:	5d                   	pop    %ebp
+		goto out;
+  80100f:	eb d4                	jmp    800fe5 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801011:	83 ec 0c             	sub    $0xc,%esp
+  801014:	50                   	push   %eax
+  801015:	6a 09                	push   $0x9
+  801017:	68 2b 31 80 00       	push   $0x80312b
+  80101c:	6a 3f                	push   $0x3f
+  80101e:	68 48 31 80 00       	push   $0x803148
+  801023:	e8 c9 f1 ff ff       	call   8001f1 <_panic>
+
+00801028 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	57                   	push   %edi
+  80102c:	56                   	push   %esi
+  80102d:	53                   	push   %ebx
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801031:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801038:	74 22                	je     80105c <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	89 de                	mov    %ebx,%esi
+  80104e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801050:	85 c0                	test   %eax,%eax
+  801052:	7f 28                	jg     80107c <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5f                   	pop    %edi
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801067:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	8d 35 79 10 80 00    	lea    0x801079,%esi
+  801077:	0f 34                	sysenter
+  801079:	5d                   	pop    %ebp
+		goto out;
+  80107a:	eb d4                	jmp    801050 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107c:	83 ec 0c             	sub    $0xc,%esp
+  80107f:	50                   	push   %eax
+  801080:	6a 0a                	push   $0xa
+  801082:	68 2b 31 80 00       	push   $0x80312b
+  801087:	6a 3f                	push   $0x3f
+  801089:	68 48 31 80 00       	push   $0x803148
+  80108e:	e8 5e f1 ff ff       	call   8001f1 <_panic>
+
+00801093 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+  801099:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80109c:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  8010a3:	74 22                	je     8010c7 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8010a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010aa:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	89 df                	mov    %ebx,%edi
+  8010b7:	89 de                	mov    %ebx,%esi
+  8010b9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010bb:	85 c0                	test   %eax,%eax
+  8010bd:	7f 28                	jg     8010e7 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8010bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010d7:	89 df                	mov    %ebx,%edi
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	8d 35 e4 10 80 00    	lea    0x8010e4,%esi
+  8010e2:	0f 34                	sysenter
+  8010e4:	5d                   	pop    %ebp
+		goto out;
+  8010e5:	eb d4                	jmp    8010bb <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e7:	83 ec 0c             	sub    $0xc,%esp
+  8010ea:	50                   	push   %eax
+  8010eb:	6a 17                	push   $0x17
+  8010ed:	68 2b 31 80 00       	push   $0x80312b
+  8010f2:	6a 3f                	push   $0x3f
+  8010f4:	68 48 31 80 00       	push   $0x803148
+  8010f9:	e8 f3 f0 ff ff       	call   8001f1 <_panic>
+
+008010fe <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+  801104:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801107:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  80110e:	74 22                	je     801132 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801110:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801115:	b8 18 00 00 00       	mov    $0x18,%eax
+  80111a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801120:	89 df                	mov    %ebx,%edi
+  801122:	89 de                	mov    %ebx,%esi
+  801124:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801126:	85 c0                	test   %eax,%eax
+  801128:	7f 28                	jg     801152 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80112a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801137:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801142:	89 df                	mov    %ebx,%edi
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	8d 35 4f 11 80 00    	lea    0x80114f,%esi
+  80114d:	0f 34                	sysenter
+  80114f:	5d                   	pop    %ebp
+		goto out;
+  801150:	eb d4                	jmp    801126 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801152:	83 ec 0c             	sub    $0xc,%esp
+  801155:	50                   	push   %eax
+  801156:	6a 18                	push   $0x18
+  801158:	68 2b 31 80 00       	push   $0x80312b
+  80115d:	6a 3f                	push   $0x3f
+  80115f:	68 48 31 80 00       	push   $0x803148
+  801164:	e8 88 f0 ff ff       	call   8001f1 <_panic>
+
+00801169 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	57                   	push   %edi
+  80116d:	56                   	push   %esi
+  80116e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80116f:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801176:	74 1d                	je     801195 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801178:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80117d:	be 00 00 00 00       	mov    $0x0,%esi
+  801182:	8b 55 08             	mov    0x8(%ebp),%edx
+  801185:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801188:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80118e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801190:	5b                   	pop    %ebx
+  801191:	5e                   	pop    %esi
+  801192:	5f                   	pop    %edi
+  801193:	5d                   	pop    %ebp
+  801194:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	8d 35 b1 11 80 00    	lea    0x8011b1,%esi
+  8011af:	0f 34                	sysenter
+  8011b1:	5d                   	pop    %ebp
+		goto out;
+  8011b2:	eb dc                	jmp    801190 <sys_ipc_try_send+0x27>
+
+008011b4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+  8011ba:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011bd:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  8011c4:	74 21                	je     8011e7 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8011c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d3:	89 cb                	mov    %ecx,%ebx
+  8011d5:	89 cf                	mov    %ecx,%edi
+  8011d7:	89 ce                	mov    %ecx,%esi
+  8011d9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011db:	85 c0                	test   %eax,%eax
+  8011dd:	7f 27                	jg     801206 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e2:	5b                   	pop    %ebx
+  8011e3:	5e                   	pop    %esi
+  8011e4:	5f                   	pop    %edi
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ef:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011f4:	89 cb                	mov    %ecx,%ebx
+  8011f6:	89 cf                	mov    %ecx,%edi
+  8011f8:	55                   	push   %ebp
+  8011f9:	89 e5                	mov    %esp,%ebp
+  8011fb:	8d 35 03 12 80 00    	lea    0x801203,%esi
+  801201:	0f 34                	sysenter
+  801203:	5d                   	pop    %ebp
+		goto out;
+  801204:	eb d5                	jmp    8011db <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801206:	83 ec 0c             	sub    $0xc,%esp
+  801209:	50                   	push   %eax
+  80120a:	6a 0d                	push   $0xd
+  80120c:	68 2b 31 80 00       	push   $0x80312b
+  801211:	6a 3f                	push   $0x3f
+  801213:	68 48 31 80 00       	push   $0x803148
+  801218:	e8 d4 ef ff ff       	call   8001f1 <_panic>
+
+0080121d <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801223:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  80122a:	74 1b                	je     801247 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80122c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801231:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801236:	8b 55 08             	mov    0x8(%ebp),%edx
+  801239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123c:	89 df                	mov    %ebx,%edi
+  80123e:	89 de                	mov    %ebx,%esi
+  801240:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801242:	5b                   	pop    %ebx
+  801243:	5e                   	pop    %esi
+  801244:	5f                   	pop    %edi
+  801245:	5d                   	pop    %ebp
+  801246:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801247:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801252:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801257:	89 df                	mov    %ebx,%edi
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	8d 35 64 12 80 00    	lea    0x801264,%esi
+  801262:	0f 34                	sysenter
+  801264:	5d                   	pop    %ebp
+		goto out;
+  801265:	eb db                	jmp    801242 <sys_ipc_recv_until+0x25>
+
+00801267 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801267:	55                   	push   %ebp
+  801268:	89 e5                	mov    %esp,%ebp
+  80126a:	57                   	push   %edi
+  80126b:	56                   	push   %esi
+  80126c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80126d:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801274:	74 19                	je     80128f <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801280:	89 d1                	mov    %edx,%ecx
+  801282:	89 d3                	mov    %edx,%ebx
+  801284:	89 d7                	mov    %edx,%edi
+  801286:	89 d6                	mov    %edx,%esi
+  801288:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80128a:	5b                   	pop    %ebx
+  80128b:	5e                   	pop    %esi
+  80128c:	5f                   	pop    %edi
+  80128d:	5d                   	pop    %ebp
+  80128e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80128f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801294:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801299:	89 d1                	mov    %edx,%ecx
+  80129b:	89 d3                	mov    %edx,%ebx
+  80129d:	89 d7                	mov    %edx,%edi
+  80129f:	55                   	push   %ebp
+  8012a0:	89 e5                	mov    %esp,%ebp
+  8012a2:	8d 35 aa 12 80 00    	lea    0x8012aa,%esi
+  8012a8:	0f 34                	sysenter
+  8012aa:	5d                   	pop    %ebp
+		goto out;
+  8012ab:	eb dd                	jmp    80128a <sys_time_msec+0x23>
+
+008012ad <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8012ad:	55                   	push   %ebp
+  8012ae:	89 e5                	mov    %esp,%ebp
+  8012b0:	57                   	push   %edi
+  8012b1:	56                   	push   %esi
+  8012b2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012b3:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  8012ba:	74 1a                	je     8012d6 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8012bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c9:	89 cb                	mov    %ecx,%ebx
+  8012cb:	89 cf                	mov    %ecx,%edi
+  8012cd:	89 ce                	mov    %ecx,%esi
+  8012cf:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012de:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012e3:	89 cb                	mov    %ecx,%ebx
+  8012e5:	89 cf                	mov    %ecx,%edi
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	8d 35 f2 12 80 00    	lea    0x8012f2,%esi
+  8012f0:	0f 34                	sysenter
+  8012f2:	5d                   	pop    %ebp
+		goto out;
+  8012f3:	eb dc                	jmp    8012d1 <sys_sleep_until+0x24>
+
+008012f5 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012fb:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801302:	74 1a                	je     80131e <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801304:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801309:	b8 11 00 00 00       	mov    $0x11,%eax
+  80130e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801311:	89 cb                	mov    %ecx,%ebx
+  801313:	89 cf                	mov    %ecx,%edi
+  801315:	89 ce                	mov    %ecx,%esi
+  801317:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5f                   	pop    %edi
+  80131c:	5d                   	pop    %ebp
+  80131d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80131e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801321:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801326:	b8 11 00 00 00       	mov    $0x11,%eax
+  80132b:	89 cb                	mov    %ecx,%ebx
+  80132d:	89 cf                	mov    %ecx,%edi
+  80132f:	55                   	push   %ebp
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	8d 35 3a 13 80 00    	lea    0x80133a,%esi
+  801338:	0f 34                	sysenter
+  80133a:	5d                   	pop    %ebp
+		goto out;
+  80133b:	eb dc                	jmp    801319 <sys_env_print_stats+0x24>
+
+0080133d <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80133d:	55                   	push   %ebp
+  80133e:	89 e5                	mov    %esp,%ebp
+  801340:	57                   	push   %edi
+  801341:	56                   	push   %esi
+  801342:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801343:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  80134a:	74 1b                	je     801367 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80134c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801351:	b8 19 00 00 00       	mov    $0x19,%eax
+  801356:	8b 55 08             	mov    0x8(%ebp),%edx
+  801359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135c:	89 df                	mov    %ebx,%edi
+  80135e:	89 de                	mov    %ebx,%esi
+  801360:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801362:	5b                   	pop    %ebx
+  801363:	5e                   	pop    %esi
+  801364:	5f                   	pop    %edi
+  801365:	5d                   	pop    %ebp
+  801366:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801367:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801372:	b8 19 00 00 00       	mov    $0x19,%eax
+  801377:	89 df                	mov    %ebx,%edi
+  801379:	55                   	push   %ebp
+  80137a:	89 e5                	mov    %esp,%ebp
+  80137c:	8d 35 84 13 80 00    	lea    0x801384,%esi
+  801382:	0f 34                	sysenter
+  801384:	5d                   	pop    %ebp
+		goto out;
+  801385:	eb db                	jmp    801362 <sys_perf+0x25>
+
+00801387 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80138d:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801394:	74 19                	je     8013af <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801396:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013a0:	89 d1                	mov    %edx,%ecx
+  8013a2:	89 d3                	mov    %edx,%ebx
+  8013a4:	89 d7                	mov    %edx,%edi
+  8013a6:	89 d6                	mov    %edx,%esi
+  8013a8:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013aa:	5b                   	pop    %ebx
+  8013ab:	5e                   	pop    %esi
+  8013ac:	5f                   	pop    %edi
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013b9:	89 d1                	mov    %edx,%ecx
+  8013bb:	89 d3                	mov    %edx,%ebx
+  8013bd:	89 d7                	mov    %edx,%edi
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+  8013c2:	8d 35 ca 13 80 00    	lea    0x8013ca,%esi
+  8013c8:	0f 34                	sysenter
+  8013ca:	5d                   	pop    %ebp
+		goto out;
+  8013cb:	eb dd                	jmp    8013aa <sys_fork+0x23>
+
+008013cd <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8013cd:	55                   	push   %ebp
+  8013ce:	89 e5                	mov    %esp,%ebp
+  8013d0:	57                   	push   %edi
+  8013d1:	56                   	push   %esi
+  8013d2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013d3:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  8013da:	74 1c                	je     8013f8 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ef:	89 f7                	mov    %esi,%edi
+  8013f1:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013f3:	5b                   	pop    %ebx
+  8013f4:	5e                   	pop    %esi
+  8013f5:	5f                   	pop    %edi
+  8013f6:	5d                   	pop    %ebp
+  8013f7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fe:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801403:	bf 00 00 00 00       	mov    $0x0,%edi
+  801408:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+  80140e:	8d 35 16 14 80 00    	lea    0x801416,%esi
+  801414:	0f 34                	sysenter
+  801416:	5d                   	pop    %ebp
+		goto out;
+  801417:	eb da                	jmp    8013f3 <sys_thread_create+0x26>
+
+00801419 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	57                   	push   %edi
+  80141d:	56                   	push   %esi
+  80141e:	53                   	push   %ebx
+  80141f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801422:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801429:	74 24                	je     80144f <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80142b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801430:	be 00 00 00 00       	mov    $0x0,%esi
+  801435:	8b 55 08             	mov    0x8(%ebp),%edx
+  801438:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801441:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801443:	85 c0                	test   %eax,%eax
+  801445:	7f 27                	jg     80146e <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144a:	5b                   	pop    %ebx
+  80144b:	5e                   	pop    %esi
+  80144c:	5f                   	pop    %edi
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80144f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801452:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801455:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80145a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80145d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	8d 35 6b 14 80 00    	lea    0x80146b,%esi
+  801469:	0f 34                	sysenter
+  80146b:	5d                   	pop    %ebp
+		goto out;
+  80146c:	eb d5                	jmp    801443 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80146e:	83 ec 0c             	sub    $0xc,%esp
+  801471:	50                   	push   %eax
+  801472:	6a 1f                	push   $0x1f
+  801474:	68 2b 31 80 00       	push   $0x80312b
+  801479:	6a 3f                	push   $0x3f
+  80147b:	68 48 31 80 00       	push   $0x803148
+  801480:	e8 6c ed ff ff       	call   8001f1 <_panic>
+
+00801485 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	57                   	push   %edi
+  801489:	56                   	push   %esi
+  80148a:	53                   	push   %ebx
+  80148b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80148e:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801495:	74 23                	je     8014ba <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801497:	be 00 00 00 00       	mov    $0x0,%esi
+  80149c:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014aa:	89 f7                	mov    %esi,%edi
+  8014ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014ae:	85 c0                	test   %eax,%eax
+  8014b0:	7f 29                	jg     8014db <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8014b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b5:	5b                   	pop    %ebx
+  8014b6:	5e                   	pop    %esi
+  8014b7:	5f                   	pop    %edi
+  8014b8:	5d                   	pop    %ebp
+  8014b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c0:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014cd:	55                   	push   %ebp
+  8014ce:	89 e5                	mov    %esp,%ebp
+  8014d0:	8d 35 d8 14 80 00    	lea    0x8014d8,%esi
+  8014d6:	0f 34                	sysenter
+  8014d8:	5d                   	pop    %ebp
+		goto out;
+  8014d9:	eb d3                	jmp    8014ae <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014db:	83 ec 0c             	sub    $0xc,%esp
+  8014de:	50                   	push   %eax
+  8014df:	6a 20                	push   $0x20
+  8014e1:	68 2b 31 80 00       	push   $0x80312b
+  8014e6:	6a 3f                	push   $0x3f
+  8014e8:	68 48 31 80 00       	push   $0x803148
+  8014ed:	e8 ff ec ff ff       	call   8001f1 <_panic>
+
+008014f2 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014f2:	55                   	push   %ebp
+  8014f3:	89 e5                	mov    %esp,%ebp
+  8014f5:	57                   	push   %edi
+  8014f6:	56                   	push   %esi
+  8014f7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014f8:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  8014ff:	74 1b                	je     80151c <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801501:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801506:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80150b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801511:	89 df                	mov    %ebx,%edi
+  801513:	89 de                	mov    %ebx,%esi
+  801515:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801517:	5b                   	pop    %ebx
+  801518:	5e                   	pop    %esi
+  801519:	5f                   	pop    %edi
+  80151a:	5d                   	pop    %ebp
+  80151b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80151c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801521:	8b 55 08             	mov    0x8(%ebp),%edx
+  801524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801527:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80152c:	89 df                	mov    %ebx,%edi
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	8d 35 39 15 80 00    	lea    0x801539,%esi
+  801537:	0f 34                	sysenter
+  801539:	5d                   	pop    %ebp
+		goto out;
+  80153a:	eb db                	jmp    801517 <sys_batch+0x25>
+
+0080153c <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80153c:	55                   	push   %ebp
+  80153d:	89 e5                	mov    %esp,%ebp
+  80153f:	57                   	push   %edi
+  801540:	56                   	push   %esi
+  801541:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801542:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801549:	74 1a                	je     801565 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80154b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801550:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801555:	8b 55 08             	mov    0x8(%ebp),%edx
+  801558:	89 cb                	mov    %ecx,%ebx
+  80155a:	89 cf                	mov    %ecx,%edi
+  80155c:	89 ce                	mov    %ecx,%esi
+  80155e:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5f                   	pop    %edi
+  801563:	5d                   	pop    %ebp
+  801564:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801565:	8b 55 08             	mov    0x8(%ebp),%edx
+  801568:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80156d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801572:	89 cb                	mov    %ecx,%ebx
+  801574:	89 cf                	mov    %ecx,%edi
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	8d 35 81 15 80 00    	lea    0x801581,%esi
+  80157f:	0f 34                	sysenter
+  801581:	5d                   	pop    %ebp
+		goto out;
+  801582:	eb dc                	jmp    801560 <sys_trace_ctl+0x24>
+
+00801584 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801584:	55                   	push   %ebp
+  801585:	89 e5                	mov    %esp,%ebp
+  801587:	57                   	push   %edi
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80158a:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801591:	74 1c                	je     8015af <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801593:	be 00 00 00 00       	mov    $0x0,%esi
+  801598:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80159d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a6:	89 f7                	mov    %esi,%edi
+  8015a8:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8015aa:	5b                   	pop    %ebx
+  8015ab:	5e                   	pop    %esi
+  8015ac:	5f                   	pop    %edi
+  8015ad:	5d                   	pop    %ebp
+  8015ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	8d 35 cd 15 80 00    	lea    0x8015cd,%esi
+  8015cb:	0f 34                	sysenter
+  8015cd:	5d                   	pop    %ebp
+		goto out;
+  8015ce:	eb da                	jmp    8015aa <sys_trace_read+0x26>
+
+008015d0 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015d0:	55                   	push   %ebp
+  8015d1:	89 e5                	mov    %esp,%ebp
+  8015d3:	57                   	push   %edi
+  8015d4:	56                   	push   %esi
+  8015d5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015d6:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  8015dd:	74 1c                	je     8015fb <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8015df:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e4:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f2:	89 f7                	mov    %esi,%edi
+  8015f4:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015f6:	5b                   	pop    %ebx
+  8015f7:	5e                   	pop    %esi
+  8015f8:	5f                   	pop    %edi
+  8015f9:	5d                   	pop    %ebp
+  8015fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801601:	b8 21 00 00 00       	mov    $0x21,%eax
+  801606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80160b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80160e:	55                   	push   %ebp
+  80160f:	89 e5                	mov    %esp,%ebp
+  801611:	8d 35 19 16 80 00    	lea    0x801619,%esi
+  801617:	0f 34                	sysenter
+  801619:	5d                   	pop    %ebp
+		goto out;
+  80161a:	eb da                	jmp    8015f6 <sys_meminfo+0x26>
+
+0080161c <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	57                   	push   %edi
+  801620:	56                   	push   %esi
+  801621:	53                   	push   %ebx
+  801622:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801625:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801629:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801630:	74 1f                	je     801651 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801632:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801637:	b8 22 00 00 00       	mov    $0x22,%eax
+  80163c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163f:	89 df                	mov    %ebx,%edi
+  801641:	89 de                	mov    %ebx,%esi
+  801643:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801645:	85 c0                	test   %eax,%eax
+  801647:	7f 25                	jg     80166e <sys_env_set_ksm+0x52>
+}
+  801649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164c:	5b                   	pop    %ebx
+  80164d:	5e                   	pop    %esi
+  80164e:	5f                   	pop    %edi
+  80164f:	5d                   	pop    %ebp
+  801650:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801651:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801656:	8b 55 08             	mov    0x8(%ebp),%edx
+  801659:	b8 22 00 00 00       	mov    $0x22,%eax
+  80165e:	89 df                	mov    %ebx,%edi
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	8d 35 6b 16 80 00    	lea    0x80166b,%esi
+  801669:	0f 34                	sysenter
+  80166b:	5d                   	pop    %ebp
+		goto out;
+  80166c:	eb d7                	jmp    801645 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80166e:	83 ec 0c             	sub    $0xc,%esp
+  801671:	50                   	push   %eax
+  801672:	6a 22                	push   $0x22
+  801674:	68 2b 31 80 00       	push   $0x80312b
+  801679:	6a 3f                	push   $0x3f
+  80167b:	68 48 31 80 00       	push   $0x803148
+  801680:	e8 6c eb ff ff       	call   8001f1 <_panic>
+
+00801685 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	57                   	push   %edi
+  801689:	56                   	push   %esi
+  80168a:	53                   	push   %ebx
+  80168b:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80168e:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801691:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801698:	74 24                	je     8016be <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80169a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80169f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016a4:	89 cb                	mov    %ecx,%ebx
+  8016a6:	89 cf                	mov    %ecx,%edi
+  8016a8:	89 ce                	mov    %ecx,%esi
+  8016aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	7f 2a                	jg     8016da <sys_time_nsec+0x55>
+	return ns;
+}
+  8016b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016b3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b9:	5b                   	pop    %ebx
+  8016ba:	5e                   	pop    %esi
+  8016bb:	5f                   	pop    %edi
+  8016bc:	5d                   	pop    %ebp
+  8016bd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016c8:	89 cb                	mov    %ecx,%ebx
+  8016ca:	89 cf                	mov    %ecx,%edi
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	8d 35 d7 16 80 00    	lea    0x8016d7,%esi
+  8016d5:	0f 34                	sysenter
+  8016d7:	5d                   	pop    %ebp
+		goto out;
+  8016d8:	eb d2                	jmp    8016ac <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016da:	83 ec 0c             	sub    $0xc,%esp
+  8016dd:	50                   	push   %eax
+  8016de:	6a 0f                	push   $0xf
+  8016e0:	68 2b 31 80 00       	push   $0x80312b
+  8016e5:	6a 3f                	push   $0x3f
+  8016e7:	68 48 31 80 00       	push   $0x803148
+  8016ec:	e8 00 eb ff ff       	call   8001f1 <_panic>
+
+008016f1 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	57                   	push   %edi
+  8016f5:	56                   	push   %esi
+  8016f6:	53                   	push   %ebx
+  8016f7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016fa:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801701:	74 22                	je     801725 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801703:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801708:	b8 12 00 00 00       	mov    $0x12,%eax
+  80170d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801710:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801713:	89 df                	mov    %ebx,%edi
+  801715:	89 de                	mov    %ebx,%esi
+  801717:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	7f 28                	jg     801745 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80171d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5f                   	pop    %edi
+  801723:	5d                   	pop    %ebp
+  801724:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801725:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801730:	b8 12 00 00 00       	mov    $0x12,%eax
+  801735:	89 df                	mov    %ebx,%edi
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	8d 35 42 17 80 00    	lea    0x801742,%esi
+  801740:	0f 34                	sysenter
+  801742:	5d                   	pop    %ebp
+		goto out;
+  801743:	eb d4                	jmp    801719 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801745:	83 ec 0c             	sub    $0xc,%esp
+  801748:	50                   	push   %eax
+  801749:	6a 12                	push   $0x12
+  80174b:	68 2b 31 80 00       	push   $0x80312b
+  801750:	6a 3f                	push   $0x3f
+  801752:	68 48 31 80 00       	push   $0x803148
+  801757:	e8 95 ea ff ff       	call   8001f1 <_panic>
+
+0080175c <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	57                   	push   %edi
+  801760:	56                   	push   %esi
+  801761:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801762:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801769:	74 1b                	je     801786 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80176b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801770:	b8 13 00 00 00       	mov    $0x13,%eax
+  801775:	8b 55 08             	mov    0x8(%ebp),%edx
+  801778:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177b:	89 df                	mov    %ebx,%edi
+  80177d:	89 de                	mov    %ebx,%esi
+  80177f:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801781:	5b                   	pop    %ebx
+  801782:	5e                   	pop    %esi
+  801783:	5f                   	pop    %edi
+  801784:	5d                   	pop    %ebp
+  801785:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801786:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801791:	b8 13 00 00 00       	mov    $0x13,%eax
+  801796:	89 df                	mov    %ebx,%edi
+  801798:	55                   	push   %ebp
+  801799:	89 e5                	mov    %esp,%ebp
+  80179b:	8d 35 a3 17 80 00    	lea    0x8017a3,%esi
+  8017a1:	0f 34                	sysenter
+  8017a3:	5d                   	pop    %ebp
+		goto out;
+  8017a4:	eb db                	jmp    801781 <sys_e1000_receive+0x25>
+
+008017a6 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	57                   	push   %edi
+  8017aa:	56                   	push   %esi
+  8017ab:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ac:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  8017b3:	74 1b                	je     8017d0 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8017b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ba:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c5:	89 df                	mov    %ebx,%edi
+  8017c7:	89 de                	mov    %ebx,%esi
+  8017c9:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017cb:	5b                   	pop    %ebx
+  8017cc:	5e                   	pop    %esi
+  8017cd:	5f                   	pop    %edi
+  8017ce:	5d                   	pop    %ebp
+  8017cf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017db:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017e0:	89 df                	mov    %ebx,%edi
+  8017e2:	55                   	push   %ebp
+  8017e3:	89 e5                	mov    %esp,%ebp
+  8017e5:	8d 35 ed 17 80 00    	lea    0x8017ed,%esi
+  8017eb:	0f 34                	sysenter
+  8017ed:	5d                   	pop    %ebp
+		goto out;
+  8017ee:	eb db                	jmp    8017cb <sys_e1000_read_hwaddr+0x25>
+
+008017f0 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017f0:	55                   	push   %ebp
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	57                   	push   %edi
+  8017f4:	56                   	push   %esi
+  8017f5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017f6:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  8017fd:	74 1a                	je     801819 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8017ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801804:	b8 15 00 00 00       	mov    $0x15,%eax
+  801809:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180c:	89 cb                	mov    %ecx,%ebx
+  80180e:	89 cf                	mov    %ecx,%edi
+  801810:	89 ce                	mov    %ecx,%esi
+  801812:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801814:	5b                   	pop    %ebx
+  801815:	5e                   	pop    %esi
+  801816:	5f                   	pop    %edi
+  801817:	5d                   	pop    %ebp
+  801818:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801819:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801821:	b8 15 00 00 00       	mov    $0x15,%eax
+  801826:	89 cb                	mov    %ecx,%ebx
+  801828:	89 cf                	mov    %ecx,%edi
+  80182a:	55                   	push   %ebp
+  80182b:	89 e5                	mov    %esp,%ebp
+  80182d:	8d 35 35 18 80 00    	lea    0x801835,%esi
+  801833:	0f 34                	sysenter
+  801835:	5d                   	pop    %ebp
+		goto out;
+  801836:	eb dc                	jmp    801814 <sys_sb16_read_version+0x24>
+
+00801838 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	57                   	push   %edi
+  80183c:	56                   	push   %esi
+  80183d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80183e:	80 3d 24 70 80 00 00 	cmpb   $0x0,0x807024
+  801845:	74 1b                	je     801862 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801847:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801851:	8b 55 08             	mov    0x8(%ebp),%edx
+  801854:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801857:	89 df                	mov    %ebx,%edi
+  801859:	89 de                	mov    %ebx,%esi
+  80185b:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80185d:	5b                   	pop    %ebx
+  80185e:	5e                   	pop    %esi
+  80185f:	5f                   	pop    %edi
+  801860:	5d                   	pop    %ebp
+  801861:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801862:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801867:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80186d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801872:	89 df                	mov    %ebx,%edi
+  801874:	55                   	push   %ebp
+  801875:	89 e5                	mov    %esp,%ebp
+  801877:	8d 35 7f 18 80 00    	lea    0x80187f,%esi
+  80187d:	0f 34                	sysenter
+  80187f:	5d                   	pop    %ebp
+		goto out;
+  801880:	eb db                	jmp    80185d <sys_sb16_play+0x25>
+
+00801882 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801885:	8b 45 08             	mov    0x8(%ebp),%eax
+  801888:	05 00 00 00 30       	add    $0x30000000,%eax
+  80188d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801890:	5d                   	pop    %ebp
+  801891:	c3                   	ret
+
+00801892 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801892:	55                   	push   %ebp
+  801893:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801895:	8b 45 08             	mov    0x8(%ebp),%eax
+  801898:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80189d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018a2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018a7:	5d                   	pop    %ebp
+  8018a8:	c3                   	ret
+
+008018a9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018ac:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018b1:	eb 02                	jmp    8018b5 <fd_alloc+0xc>
+  8018b3:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018b5:	89 c2                	mov    %eax,%edx
+  8018b7:	c1 ea 16             	shr    $0x16,%edx
+  8018ba:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018c1:	f6 c2 01             	test   $0x1,%dl
+  8018c4:	74 2b                	je     8018f1 <fd_alloc+0x48>
+  8018c6:	89 c2                	mov    %eax,%edx
+  8018c8:	c1 ea 0c             	shr    $0xc,%edx
+  8018cb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018d2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018d8:	f6 c1 01             	test   $0x1,%cl
+  8018db:	74 14                	je     8018f1 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018dd:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018e3:	75 ce                	jne    8018b3 <fd_alloc+0xa>
+  8018e5:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018ea:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018ef:	eb 05                	jmp    8018f6 <fd_alloc+0x4d>
+			return 0;
+  8018f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f9:	89 02                	mov    %eax,(%edx)
+}
+  8018fb:	89 c8                	mov    %ecx,%eax
+  8018fd:	5d                   	pop    %ebp
+  8018fe:	c3                   	ret
+
+008018ff <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+  801902:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801905:	83 f8 1f             	cmp    $0x1f,%eax
+  801908:	77 30                	ja     80193a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80190a:	c1 e0 0c             	shl    $0xc,%eax
+  80190d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801912:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801918:	f6 c2 01             	test   $0x1,%dl
+  80191b:	74 24                	je     801941 <fd_lookup+0x42>
+  80191d:	89 c2                	mov    %eax,%edx
+  80191f:	c1 ea 0c             	shr    $0xc,%edx
+  801922:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801929:	f6 c2 01             	test   $0x1,%dl
+  80192c:	74 1a                	je     801948 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80192e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801931:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801933:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801938:	5d                   	pop    %ebp
+  801939:	c3                   	ret
+		return -E_INVAL;
+  80193a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193f:	eb f7                	jmp    801938 <fd_lookup+0x39>
+		return -E_INVAL;
+  801941:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801946:	eb f0                	jmp    801938 <fd_lookup+0x39>
+  801948:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194d:	eb e9                	jmp    801938 <fd_lookup+0x39>
+
+0080194f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80194f:	55                   	push   %ebp
+  801950:	89 e5                	mov    %esp,%ebp
+  801952:	53                   	push   %ebx
+  801953:	83 ec 04             	sub    $0x4,%esp
+  801956:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195e:	eb 03                	jmp    801963 <dev_lookup+0x14>
+  801960:	83 c0 01             	add    $0x1,%eax
+  801963:	8b 1c 85 d4 31 80 00 	mov    0x8031d4(,%eax,4),%ebx
+  80196a:	85 db                	test   %ebx,%ebx
+  80196c:	74 0b                	je     801979 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80196e:	39 13                	cmp    %edx,(%ebx)
+  801970:	75 ee                	jne    801960 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801972:	b8 00 00 00 00       	mov    $0x0,%eax
+  801977:	eb 2e                	jmp    8019a7 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801979:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80197b:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801980:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801986:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80198b:	76 24                	jbe    8019b1 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80198d:	8b 41 48             	mov    0x48(%ecx),%eax
+  801990:	83 ec 04             	sub    $0x4,%esp
+  801993:	52                   	push   %edx
+  801994:	50                   	push   %eax
+  801995:	68 58 31 80 00       	push   $0x803158
+  80199a:	e8 2d e9 ff ff       	call   8002cc <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80199f:	83 c4 10             	add    $0x10,%esp
+  8019a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019aa:	89 1a                	mov    %ebx,(%edx)
+}
+  8019ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019af:	c9                   	leave
+  8019b0:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8019b1:	c1 e8 10             	shr    $0x10,%eax
+  8019b4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8019ba:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8019c0:	eb cb                	jmp    80198d <dev_lookup+0x3e>
+
+008019c2 <fd_close>:
+{
+  8019c2:	55                   	push   %ebp
+  8019c3:	89 e5                	mov    %esp,%ebp
+  8019c5:	57                   	push   %edi
+  8019c6:	56                   	push   %esi
+  8019c7:	53                   	push   %ebx
+  8019c8:	83 ec 24             	sub    $0x24,%esp
+  8019cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019ce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019d1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019d4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019d5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019db:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019de:	50                   	push   %eax
+  8019df:	e8 1b ff ff ff       	call   8018ff <fd_lookup>
+  8019e4:	89 c3                	mov    %eax,%ebx
+  8019e6:	83 c4 10             	add    $0x10,%esp
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	78 05                	js     8019f2 <fd_close+0x30>
+	    || fd != fd2)
+  8019ed:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019f0:	74 16                	je     801a08 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019f2:	89 f8                	mov    %edi,%eax
+  8019f4:	84 c0                	test   %al,%al
+  8019f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fb:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019fe:	89 d8                	mov    %ebx,%eax
+  801a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a03:	5b                   	pop    %ebx
+  801a04:	5e                   	pop    %esi
+  801a05:	5f                   	pop    %edi
+  801a06:	5d                   	pop    %ebp
+  801a07:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a08:	83 ec 08             	sub    $0x8,%esp
+  801a0b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a0e:	50                   	push   %eax
+  801a0f:	ff 36                	push   (%esi)
+  801a11:	e8 39 ff ff ff       	call   80194f <dev_lookup>
+  801a16:	89 c3                	mov    %eax,%ebx
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	78 1a                	js     801a39 <fd_close+0x77>
+		if (dev->dev_close)
+  801a1f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a22:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a25:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a2a:	85 c0                	test   %eax,%eax
+  801a2c:	74 0b                	je     801a39 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a2e:	83 ec 0c             	sub    $0xc,%esp
+  801a31:	56                   	push   %esi
+  801a32:	ff d0                	call   *%eax
+  801a34:	89 c3                	mov    %eax,%ebx
+  801a36:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a39:	83 ec 08             	sub    $0x8,%esp
+  801a3c:	56                   	push   %esi
+  801a3d:	6a 00                	push   $0x0
+  801a3f:	e8 a3 f4 ff ff       	call   800ee7 <sys_page_unmap>
+	return r;
+  801a44:	83 c4 10             	add    $0x10,%esp
+  801a47:	eb b5                	jmp    8019fe <fd_close+0x3c>
+
+00801a49 <close>:
+
+int
+close(int fdnum)
+{
+  801a49:	55                   	push   %ebp
+  801a4a:	89 e5                	mov    %esp,%ebp
+  801a4c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a52:	50                   	push   %eax
+  801a53:	ff 75 08             	push   0x8(%ebp)
+  801a56:	e8 a4 fe ff ff       	call   8018ff <fd_lookup>
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	85 c0                	test   %eax,%eax
+  801a60:	79 02                	jns    801a64 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a62:	c9                   	leave
+  801a63:	c3                   	ret
+		return fd_close(fd, 1);
+  801a64:	83 ec 08             	sub    $0x8,%esp
+  801a67:	6a 01                	push   $0x1
+  801a69:	ff 75 f4             	push   -0xc(%ebp)
+  801a6c:	e8 51 ff ff ff       	call   8019c2 <fd_close>
+  801a71:	83 c4 10             	add    $0x10,%esp
+  801a74:	eb ec                	jmp    801a62 <close+0x19>
+
+00801a76 <close_all>:
+
+void
+close_all(void)
+{
+  801a76:	55                   	push   %ebp
+  801a77:	89 e5                	mov    %esp,%ebp
+  801a79:	53                   	push   %ebx
+  801a7a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a82:	83 ec 0c             	sub    $0xc,%esp
+  801a85:	53                   	push   %ebx
+  801a86:	e8 be ff ff ff       	call   801a49 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a8b:	83 c3 01             	add    $0x1,%ebx
+  801a8e:	83 c4 10             	add    $0x10,%esp
+  801a91:	83 fb 20             	cmp    $0x20,%ebx
+  801a94:	75 ec                	jne    801a82 <close_all+0xc>
+}
+  801a96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a99:	c9                   	leave
+  801a9a:	c3                   	ret
+
+00801a9b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	57                   	push   %edi
+  801a9f:	56                   	push   %esi
+  801aa0:	53                   	push   %ebx
+  801aa1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801aa4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801aa7:	50                   	push   %eax
+  801aa8:	ff 75 08             	push   0x8(%ebp)
+  801aab:	e8 4f fe ff ff       	call   8018ff <fd_lookup>
+  801ab0:	89 c3                	mov    %eax,%ebx
+  801ab2:	83 c4 10             	add    $0x10,%esp
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	78 7f                	js     801b38 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ab9:	83 ec 0c             	sub    $0xc,%esp
+  801abc:	ff 75 0c             	push   0xc(%ebp)
+  801abf:	e8 85 ff ff ff       	call   801a49 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801ac4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ac7:	c1 e6 0c             	shl    $0xc,%esi
+  801aca:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ad0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ad3:	89 3c 24             	mov    %edi,(%esp)
+  801ad6:	e8 b7 fd ff ff       	call   801892 <fd2data>
+  801adb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801add:	89 34 24             	mov    %esi,(%esp)
+  801ae0:	e8 ad fd ff ff       	call   801892 <fd2data>
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801aeb:	89 d8                	mov    %ebx,%eax
+  801aed:	c1 e8 16             	shr    $0x16,%eax
+  801af0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801af7:	a8 01                	test   $0x1,%al
+  801af9:	74 11                	je     801b0c <dup+0x71>
+  801afb:	89 d8                	mov    %ebx,%eax
+  801afd:	c1 e8 0c             	shr    $0xc,%eax
+  801b00:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b07:	f6 c2 01             	test   $0x1,%dl
+  801b0a:	75 36                	jne    801b42 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b0c:	89 f8                	mov    %edi,%eax
+  801b0e:	c1 e8 0c             	shr    $0xc,%eax
+  801b11:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b18:	83 ec 0c             	sub    $0xc,%esp
+  801b1b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b20:	50                   	push   %eax
+  801b21:	56                   	push   %esi
+  801b22:	6a 00                	push   $0x0
+  801b24:	57                   	push   %edi
+  801b25:	6a 00                	push   $0x0
+  801b27:	e8 4d f3 ff ff       	call   800e79 <sys_page_map>
+  801b2c:	89 c3                	mov    %eax,%ebx
+  801b2e:	83 c4 20             	add    $0x20,%esp
+  801b31:	85 c0                	test   %eax,%eax
+  801b33:	78 33                	js     801b68 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b38:	89 d8                	mov    %ebx,%eax
+  801b3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b3d:	5b                   	pop    %ebx
+  801b3e:	5e                   	pop    %esi
+  801b3f:	5f                   	pop    %edi
+  801b40:	5d                   	pop    %ebp
+  801b41:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b42:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b49:	83 ec 0c             	sub    $0xc,%esp
+  801b4c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b51:	50                   	push   %eax
+  801b52:	ff 75 d4             	push   -0x2c(%ebp)
+  801b55:	6a 00                	push   $0x0
+  801b57:	53                   	push   %ebx
+  801b58:	6a 00                	push   $0x0
+  801b5a:	e8 1a f3 ff ff       	call   800e79 <sys_page_map>
+  801b5f:	89 c3                	mov    %eax,%ebx
+  801b61:	83 c4 20             	add    $0x20,%esp
+  801b64:	85 c0                	test   %eax,%eax
+  801b66:	79 a4                	jns    801b0c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b68:	83 ec 08             	sub    $0x8,%esp
+  801b6b:	56                   	push   %esi
+  801b6c:	6a 00                	push   $0x0
+  801b6e:	e8 74 f3 ff ff       	call   800ee7 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b73:	83 c4 08             	add    $0x8,%esp
+  801b76:	ff 75 d4             	push   -0x2c(%ebp)
+  801b79:	6a 00                	push   $0x0
+  801b7b:	e8 67 f3 ff ff       	call   800ee7 <sys_page_unmap>
+	return r;
+  801b80:	83 c4 10             	add    $0x10,%esp
+  801b83:	eb b3                	jmp    801b38 <dup+0x9d>
+
+00801b85 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b85:	55                   	push   %ebp
+  801b86:	89 e5                	mov    %esp,%ebp
+  801b88:	56                   	push   %esi
+  801b89:	53                   	push   %ebx
+  801b8a:	83 ec 18             	sub    $0x18,%esp
+  801b8d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b90:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b93:	50                   	push   %eax
+  801b94:	53                   	push   %ebx
+  801b95:	e8 65 fd ff ff       	call   8018ff <fd_lookup>
+  801b9a:	83 c4 10             	add    $0x10,%esp
+  801b9d:	85 c0                	test   %eax,%eax
+  801b9f:	78 3c                	js     801bdd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ba1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ba4:	83 ec 08             	sub    $0x8,%esp
+  801ba7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801baa:	50                   	push   %eax
+  801bab:	ff 36                	push   (%esi)
+  801bad:	e8 9d fd ff ff       	call   80194f <dev_lookup>
+  801bb2:	83 c4 10             	add    $0x10,%esp
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	78 24                	js     801bdd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bb9:	8b 46 08             	mov    0x8(%esi),%eax
+  801bbc:	83 e0 03             	and    $0x3,%eax
+  801bbf:	83 f8 01             	cmp    $0x1,%eax
+  801bc2:	74 20                	je     801be4 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801bc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc7:	8b 40 08             	mov    0x8(%eax),%eax
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	74 57                	je     801c25 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bce:	83 ec 04             	sub    $0x4,%esp
+  801bd1:	ff 75 10             	push   0x10(%ebp)
+  801bd4:	ff 75 0c             	push   0xc(%ebp)
+  801bd7:	56                   	push   %esi
+  801bd8:	ff d0                	call   *%eax
+  801bda:	83 c4 10             	add    $0x10,%esp
+}
+  801bdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be0:	5b                   	pop    %ebx
+  801be1:	5e                   	pop    %esi
+  801be2:	5d                   	pop    %ebp
+  801be3:	c3                   	ret
+  801be4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801be6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801beb:	8b 15 20 70 80 00    	mov    0x807020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bf1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bf6:	76 1c                	jbe    801c14 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf8:	8b 42 48             	mov    0x48(%edx),%eax
+  801bfb:	83 ec 04             	sub    $0x4,%esp
+  801bfe:	53                   	push   %ebx
+  801bff:	50                   	push   %eax
+  801c00:	68 99 31 80 00       	push   $0x803199
+  801c05:	e8 c2 e6 ff ff       	call   8002cc <cprintf>
+		return -E_INVAL;
+  801c0a:	83 c4 10             	add    $0x10,%esp
+  801c0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c12:	eb c9                	jmp    801bdd <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c14:	c1 e8 10             	shr    $0x10,%eax
+  801c17:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c1d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c23:	eb d3                	jmp    801bf8 <read+0x73>
+		return -E_NOT_SUPP;
+  801c25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c2a:	eb b1                	jmp    801bdd <read+0x58>
+
+00801c2c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c2c:	55                   	push   %ebp
+  801c2d:	89 e5                	mov    %esp,%ebp
+  801c2f:	57                   	push   %edi
+  801c30:	56                   	push   %esi
+  801c31:	53                   	push   %ebx
+  801c32:	83 ec 0c             	sub    $0xc,%esp
+  801c35:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c38:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c40:	eb 02                	jmp    801c44 <readn+0x18>
+  801c42:	01 c3                	add    %eax,%ebx
+  801c44:	39 f3                	cmp    %esi,%ebx
+  801c46:	73 21                	jae    801c69 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c48:	83 ec 04             	sub    $0x4,%esp
+  801c4b:	89 f0                	mov    %esi,%eax
+  801c4d:	29 d8                	sub    %ebx,%eax
+  801c4f:	50                   	push   %eax
+  801c50:	89 d8                	mov    %ebx,%eax
+  801c52:	03 45 0c             	add    0xc(%ebp),%eax
+  801c55:	50                   	push   %eax
+  801c56:	57                   	push   %edi
+  801c57:	e8 29 ff ff ff       	call   801b85 <read>
+		if (m < 0)
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 04                	js     801c67 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c63:	75 dd                	jne    801c42 <readn+0x16>
+  801c65:	eb 02                	jmp    801c69 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c67:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c69:	89 d8                	mov    %ebx,%eax
+  801c6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c6e:	5b                   	pop    %ebx
+  801c6f:	5e                   	pop    %esi
+  801c70:	5f                   	pop    %edi
+  801c71:	5d                   	pop    %ebp
+  801c72:	c3                   	ret
+
+00801c73 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	56                   	push   %esi
+  801c77:	53                   	push   %ebx
+  801c78:	83 ec 18             	sub    $0x18,%esp
+  801c7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c7e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c81:	50                   	push   %eax
+  801c82:	53                   	push   %ebx
+  801c83:	e8 77 fc ff ff       	call   8018ff <fd_lookup>
+  801c88:	83 c4 10             	add    $0x10,%esp
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 37                	js     801cc6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c8f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c92:	83 ec 08             	sub    $0x8,%esp
+  801c95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c98:	50                   	push   %eax
+  801c99:	ff 36                	push   (%esi)
+  801c9b:	e8 af fc ff ff       	call   80194f <dev_lookup>
+  801ca0:	83 c4 10             	add    $0x10,%esp
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 1f                	js     801cc6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ca7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cab:	74 20                	je     801ccd <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	74 57                	je     801d0e <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801cb7:	83 ec 04             	sub    $0x4,%esp
+  801cba:	ff 75 10             	push   0x10(%ebp)
+  801cbd:	ff 75 0c             	push   0xc(%ebp)
+  801cc0:	56                   	push   %esi
+  801cc1:	ff d0                	call   *%eax
+  801cc3:	83 c4 10             	add    $0x10,%esp
+}
+  801cc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cc9:	5b                   	pop    %ebx
+  801cca:	5e                   	pop    %esi
+  801ccb:	5d                   	pop    %ebp
+  801ccc:	c3                   	ret
+  801ccd:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ccf:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cd4:	8b 15 20 70 80 00    	mov    0x807020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cda:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cdf:	76 1c                	jbe    801cfd <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ce1:	8b 42 48             	mov    0x48(%edx),%eax
+  801ce4:	83 ec 04             	sub    $0x4,%esp
+  801ce7:	53                   	push   %ebx
+  801ce8:	50                   	push   %eax
+  801ce9:	68 b5 31 80 00       	push   $0x8031b5
+  801cee:	e8 d9 e5 ff ff       	call   8002cc <cprintf>
+		return -E_INVAL;
+  801cf3:	83 c4 10             	add    $0x10,%esp
+  801cf6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cfb:	eb c9                	jmp    801cc6 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cfd:	c1 e8 10             	shr    $0x10,%eax
+  801d00:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d06:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d0c:	eb d3                	jmp    801ce1 <write+0x6e>
+		return -E_NOT_SUPP;
+  801d0e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d13:	eb b1                	jmp    801cc6 <write+0x53>
+
+00801d15 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d15:	55                   	push   %ebp
+  801d16:	89 e5                	mov    %esp,%ebp
+  801d18:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d1e:	50                   	push   %eax
+  801d1f:	ff 75 08             	push   0x8(%ebp)
+  801d22:	e8 d8 fb ff ff       	call   8018ff <fd_lookup>
+  801d27:	83 c4 10             	add    $0x10,%esp
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	78 0e                	js     801d3c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d34:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d3c:	c9                   	leave
+  801d3d:	c3                   	ret
+
+00801d3e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d3e:	55                   	push   %ebp
+  801d3f:	89 e5                	mov    %esp,%ebp
+  801d41:	56                   	push   %esi
+  801d42:	53                   	push   %ebx
+  801d43:	83 ec 18             	sub    $0x18,%esp
+  801d46:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d49:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d4c:	50                   	push   %eax
+  801d4d:	53                   	push   %ebx
+  801d4e:	e8 ac fb ff ff       	call   8018ff <fd_lookup>
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 34                	js     801d8e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d5a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d5d:	83 ec 08             	sub    $0x8,%esp
+  801d60:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d63:	50                   	push   %eax
+  801d64:	ff 36                	push   (%esi)
+  801d66:	e8 e4 fb ff ff       	call   80194f <dev_lookup>
+  801d6b:	83 c4 10             	add    $0x10,%esp
+  801d6e:	85 c0                	test   %eax,%eax
+  801d70:	78 1c                	js     801d8e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d72:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d76:	74 1d                	je     801d95 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d7b:	8b 40 18             	mov    0x18(%eax),%eax
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	74 54                	je     801dd6 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d82:	83 ec 08             	sub    $0x8,%esp
+  801d85:	ff 75 0c             	push   0xc(%ebp)
+  801d88:	56                   	push   %esi
+  801d89:	ff d0                	call   *%eax
+  801d8b:	83 c4 10             	add    $0x10,%esp
+}
+  801d8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d91:	5b                   	pop    %ebx
+  801d92:	5e                   	pop    %esi
+  801d93:	5d                   	pop    %ebp
+  801d94:	c3                   	ret
+  801d95:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d97:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d9c:	8b 15 20 70 80 00    	mov    0x807020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801da2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801da7:	76 1c                	jbe    801dc5 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801da9:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dac:	83 ec 04             	sub    $0x4,%esp
+  801daf:	53                   	push   %ebx
+  801db0:	50                   	push   %eax
+  801db1:	68 78 31 80 00       	push   $0x803178
+  801db6:	e8 11 e5 ff ff       	call   8002cc <cprintf>
+		return -E_INVAL;
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dc3:	eb c9                	jmp    801d8e <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801dc5:	c1 e8 10             	shr    $0x10,%eax
+  801dc8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dce:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801dd4:	eb d3                	jmp    801da9 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801dd6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ddb:	eb b1                	jmp    801d8e <ftruncate+0x50>
+
+00801ddd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ddd:	55                   	push   %ebp
+  801dde:	89 e5                	mov    %esp,%ebp
+  801de0:	56                   	push   %esi
+  801de1:	53                   	push   %ebx
+  801de2:	83 ec 18             	sub    $0x18,%esp
+  801de5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801de8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801deb:	50                   	push   %eax
+  801dec:	ff 75 08             	push   0x8(%ebp)
+  801def:	e8 0b fb ff ff       	call   8018ff <fd_lookup>
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	78 49                	js     801e44 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dfb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dfe:	83 ec 08             	sub    $0x8,%esp
+  801e01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e04:	50                   	push   %eax
+  801e05:	ff 36                	push   (%esi)
+  801e07:	e8 43 fb ff ff       	call   80194f <dev_lookup>
+  801e0c:	83 c4 10             	add    $0x10,%esp
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	78 31                	js     801e44 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e16:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e1a:	74 2f                	je     801e4b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e1c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e1f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e26:	00 00 00 
+	stat->st_isdir = 0;
+  801e29:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e30:	00 00 00 
+	stat->st_dev = dev;
+  801e33:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e39:	83 ec 08             	sub    $0x8,%esp
+  801e3c:	53                   	push   %ebx
+  801e3d:	56                   	push   %esi
+  801e3e:	ff 50 14             	call   *0x14(%eax)
+  801e41:	83 c4 10             	add    $0x10,%esp
+}
+  801e44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e47:	5b                   	pop    %ebx
+  801e48:	5e                   	pop    %esi
+  801e49:	5d                   	pop    %ebp
+  801e4a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e4b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e50:	eb f2                	jmp    801e44 <fstat+0x67>
+
+00801e52 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e52:	55                   	push   %ebp
+  801e53:	89 e5                	mov    %esp,%ebp
+  801e55:	56                   	push   %esi
+  801e56:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e57:	83 ec 08             	sub    $0x8,%esp
+  801e5a:	6a 00                	push   $0x0
+  801e5c:	ff 75 08             	push   0x8(%ebp)
+  801e5f:	e8 e4 01 00 00       	call   802048 <open>
+  801e64:	89 c3                	mov    %eax,%ebx
+  801e66:	83 c4 10             	add    $0x10,%esp
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	78 1b                	js     801e88 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e6d:	83 ec 08             	sub    $0x8,%esp
+  801e70:	ff 75 0c             	push   0xc(%ebp)
+  801e73:	50                   	push   %eax
+  801e74:	e8 64 ff ff ff       	call   801ddd <fstat>
+  801e79:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e7b:	89 1c 24             	mov    %ebx,(%esp)
+  801e7e:	e8 c6 fb ff ff       	call   801a49 <close>
+	return r;
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	89 f3                	mov    %esi,%ebx
+}
+  801e88:	89 d8                	mov    %ebx,%eax
+  801e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8d:	5b                   	pop    %ebx
+  801e8e:	5e                   	pop    %esi
+  801e8f:	5d                   	pop    %ebp
+  801e90:	c3                   	ret
+
+00801e91 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e91:	55                   	push   %ebp
+  801e92:	89 e5                	mov    %esp,%ebp
+  801e94:	56                   	push   %esi
+  801e95:	53                   	push   %ebx
+  801e96:	89 c6                	mov    %eax,%esi
+  801e98:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e9a:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801ea1:	74 27                	je     801eca <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ea3:	6a 07                	push   $0x7
+  801ea5:	68 00 80 80 00       	push   $0x808000
+  801eaa:	56                   	push   %esi
+  801eab:	ff 35 00 50 80 00    	push   0x805000
+  801eb1:	e8 c6 0d 00 00       	call   802c7c <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801eb6:	83 c4 0c             	add    $0xc,%esp
+  801eb9:	6a 00                	push   $0x0
+  801ebb:	53                   	push   %ebx
+  801ebc:	6a 00                	push   $0x0
+  801ebe:	e8 a1 0d 00 00       	call   802c64 <ipc_recv>
+}
+  801ec3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec6:	5b                   	pop    %ebx
+  801ec7:	5e                   	pop    %esi
+  801ec8:	5d                   	pop    %ebp
+  801ec9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801eca:	83 ec 0c             	sub    $0xc,%esp
+  801ecd:	6a 01                	push   $0x1
+  801ecf:	e8 fc 0d 00 00       	call   802cd0 <ipc_find_env>
+  801ed4:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ed9:	83 c4 10             	add    $0x10,%esp
+  801edc:	eb c5                	jmp    801ea3 <fsipc+0x12>
+
+00801ede <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ede:	55                   	push   %ebp
+  801edf:	89 e5                	mov    %esp,%ebp
+  801ee1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ee4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eea:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801eef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ef2:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ef7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801efc:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f01:	e8 8b ff ff ff       	call   801e91 <fsipc>
+}
+  801f06:	c9                   	leave
+  801f07:	c3                   	ret
+
+00801f08 <devfile_flush>:
+{
+  801f08:	55                   	push   %ebp
+  801f09:	89 e5                	mov    %esp,%ebp
+  801f0b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f11:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f14:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f23:	e8 69 ff ff ff       	call   801e91 <fsipc>
+}
+  801f28:	c9                   	leave
+  801f29:	c3                   	ret
+
+00801f2a <devfile_stat>:
+{
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	53                   	push   %ebx
+  801f2e:	83 ec 04             	sub    $0x4,%esp
+  801f31:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f34:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f37:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f3a:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f44:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f49:	e8 43 ff ff ff       	call   801e91 <fsipc>
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	78 2c                	js     801f7e <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f52:	83 ec 08             	sub    $0x8,%esp
+  801f55:	68 00 80 80 00       	push   $0x808000
+  801f5a:	53                   	push   %ebx
+  801f5b:	e8 b4 e9 ff ff       	call   800914 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f60:	a1 80 80 80 00       	mov    0x808080,%eax
+  801f65:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f6b:	a1 84 80 80 00       	mov    0x808084,%eax
+  801f70:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f76:	83 c4 10             	add    $0x10,%esp
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f81:	c9                   	leave
+  801f82:	c3                   	ret
+
+00801f83 <devfile_write>:
+{
+  801f83:	55                   	push   %ebp
+  801f84:	89 e5                	mov    %esp,%ebp
+  801f86:	83 ec 0c             	sub    $0xc,%esp
+  801f89:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f8f:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f92:	89 15 00 80 80 00    	mov    %edx,0x808000
+	fsipcbuf.write.req_n = n;
+  801f98:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801f9d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fa2:	39 d0                	cmp    %edx,%eax
+  801fa4:	0f 47 c2             	cmova  %edx,%eax
+  801fa7:	50                   	push   %eax
+  801fa8:	ff 75 0c             	push   0xc(%ebp)
+  801fab:	68 08 80 80 00       	push   $0x808008
+  801fb0:	e8 e5 ea ff ff       	call   800a9a <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801fb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fba:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fbf:	e8 cd fe ff ff       	call   801e91 <fsipc>
+}
+  801fc4:	c9                   	leave
+  801fc5:	c3                   	ret
+
+00801fc6 <devfile_read>:
+{
+  801fc6:	55                   	push   %ebp
+  801fc7:	89 e5                	mov    %esp,%ebp
+  801fc9:	56                   	push   %esi
+  801fca:	53                   	push   %ebx
+  801fcb:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fce:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fd4:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801fd9:	89 35 04 80 80 00    	mov    %esi,0x808004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fe9:	e8 a3 fe ff ff       	call   801e91 <fsipc>
+  801fee:	89 c3                	mov    %eax,%ebx
+  801ff0:	85 c0                	test   %eax,%eax
+  801ff2:	78 1f                	js     802013 <devfile_read+0x4d>
+	assert(r <= n);
+  801ff4:	39 c6                	cmp    %eax,%esi
+  801ff6:	72 24                	jb     80201c <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801ff8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ffd:	7f 33                	jg     802032 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fff:	83 ec 04             	sub    $0x4,%esp
+  802002:	50                   	push   %eax
+  802003:	68 00 80 80 00       	push   $0x808000
+  802008:	ff 75 0c             	push   0xc(%ebp)
+  80200b:	e8 8a ea ff ff       	call   800a9a <memmove>
+	return r;
+  802010:	83 c4 10             	add    $0x10,%esp
+}
+  802013:	89 d8                	mov    %ebx,%eax
+  802015:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802018:	5b                   	pop    %ebx
+  802019:	5e                   	pop    %esi
+  80201a:	5d                   	pop    %ebp
+  80201b:	c3                   	ret
+	assert(r <= n);
+  80201c:	68 e8 31 80 00       	push   $0x8031e8
+  802021:	68 ef 31 80 00       	push   $0x8031ef
+  802026:	6a 76                	push   $0x76
+  802028:	68 04 32 80 00       	push   $0x803204
+  80202d:	e8 bf e1 ff ff       	call   8001f1 <_panic>
+	assert(r <= PGSIZE);
+  802032:	68 0f 32 80 00       	push   $0x80320f
+  802037:	68 ef 31 80 00       	push   $0x8031ef
+  80203c:	6a 77                	push   $0x77
+  80203e:	68 04 32 80 00       	push   $0x803204
+  802043:	e8 a9 e1 ff ff       	call   8001f1 <_panic>
+
+00802048 <open>:
+{
+  802048:	55                   	push   %ebp
+  802049:	89 e5                	mov    %esp,%ebp
+  80204b:	56                   	push   %esi
+  80204c:	53                   	push   %ebx
+  80204d:	83 ec 1c             	sub    $0x1c,%esp
+  802050:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802053:	56                   	push   %esi
+  802054:	e8 80 e8 ff ff       	call   8008d9 <strlen>
+  802059:	83 c4 10             	add    $0x10,%esp
+  80205c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802061:	7f 6c                	jg     8020cf <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802063:	83 ec 0c             	sub    $0xc,%esp
+  802066:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802069:	50                   	push   %eax
+  80206a:	e8 3a f8 ff ff       	call   8018a9 <fd_alloc>
+  80206f:	89 c3                	mov    %eax,%ebx
+  802071:	83 c4 10             	add    $0x10,%esp
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 3c                	js     8020b4 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802078:	83 ec 08             	sub    $0x8,%esp
+  80207b:	56                   	push   %esi
+  80207c:	68 00 80 80 00       	push   $0x808000
+  802081:	e8 8e e8 ff ff       	call   800914 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802086:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802089:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80208e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802091:	b8 01 00 00 00       	mov    $0x1,%eax
+  802096:	e8 f6 fd ff ff       	call   801e91 <fsipc>
+  80209b:	89 c3                	mov    %eax,%ebx
+  80209d:	83 c4 10             	add    $0x10,%esp
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	78 19                	js     8020bd <open+0x75>
+	return fd2num(fd);
+  8020a4:	83 ec 0c             	sub    $0xc,%esp
+  8020a7:	ff 75 f4             	push   -0xc(%ebp)
+  8020aa:	e8 d3 f7 ff ff       	call   801882 <fd2num>
+  8020af:	89 c3                	mov    %eax,%ebx
+  8020b1:	83 c4 10             	add    $0x10,%esp
+}
+  8020b4:	89 d8                	mov    %ebx,%eax
+  8020b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b9:	5b                   	pop    %ebx
+  8020ba:	5e                   	pop    %esi
+  8020bb:	5d                   	pop    %ebp
+  8020bc:	c3                   	ret
+		fd_close(fd, 0);
+  8020bd:	83 ec 08             	sub    $0x8,%esp
+  8020c0:	6a 00                	push   $0x0
+  8020c2:	ff 75 f4             	push   -0xc(%ebp)
+  8020c5:	e8 f8 f8 ff ff       	call   8019c2 <fd_close>
+		return r;
+  8020ca:	83 c4 10             	add    $0x10,%esp
+  8020cd:	eb e5                	jmp    8020b4 <open+0x6c>
+		return -E_BAD_PATH;
+  8020cf:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020d4:	eb de                	jmp    8020b4 <open+0x6c>
+
+008020d6 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020d6:	55                   	push   %ebp
+  8020d7:	89 e5                	mov    %esp,%ebp
+  8020d9:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020e6:	e8 a6 fd ff ff       	call   801e91 <fsipc>
+}
+  8020eb:	c9                   	leave
+  8020ec:	c3                   	ret
+
+008020ed <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8020ed:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8020f1:	7f 01                	jg     8020f4 <writebuf+0x7>
+  8020f3:	c3                   	ret
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	53                   	push   %ebx
+  8020f8:	83 ec 08             	sub    $0x8,%esp
+  8020fb:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8020fd:	ff 70 04             	push   0x4(%eax)
+  802100:	8d 40 10             	lea    0x10(%eax),%eax
+  802103:	50                   	push   %eax
+  802104:	ff 33                	push   (%ebx)
+  802106:	e8 68 fb ff ff       	call   801c73 <write>
+		if (result > 0)
+  80210b:	83 c4 10             	add    $0x10,%esp
+  80210e:	85 c0                	test   %eax,%eax
+  802110:	7e 03                	jle    802115 <writebuf+0x28>
+			b->result += result;
+  802112:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802115:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802118:	74 0d                	je     802127 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  80211a:	85 c0                	test   %eax,%eax
+  80211c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802121:	0f 4f c2             	cmovg  %edx,%eax
+  802124:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802127:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80212a:	c9                   	leave
+  80212b:	c3                   	ret
+
+0080212c <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80212c:	55                   	push   %ebp
+  80212d:	89 e5                	mov    %esp,%ebp
+  80212f:	53                   	push   %ebx
+  802130:	83 ec 04             	sub    $0x4,%esp
+  802133:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802136:	8b 53 04             	mov    0x4(%ebx),%edx
+  802139:	8d 42 01             	lea    0x1(%edx),%eax
+  80213c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80213f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802142:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802146:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80214b:	74 05                	je     802152 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80214d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802150:	c9                   	leave
+  802151:	c3                   	ret
+		writebuf(b);
+  802152:	89 d8                	mov    %ebx,%eax
+  802154:	e8 94 ff ff ff       	call   8020ed <writebuf>
+		b->idx = 0;
+  802159:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802160:	eb eb                	jmp    80214d <putch+0x21>
+
+00802162 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802162:	55                   	push   %ebp
+  802163:	89 e5                	mov    %esp,%ebp
+  802165:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80216b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216e:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802174:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80217b:	00 00 00 
+	b.result = 0;
+  80217e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802185:	00 00 00 
+	b.error = 1;
+  802188:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80218f:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  802192:	ff 75 10             	push   0x10(%ebp)
+  802195:	ff 75 0c             	push   0xc(%ebp)
+  802198:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80219e:	50                   	push   %eax
+  80219f:	68 2c 21 80 00       	push   $0x80212c
+  8021a4:	e8 01 e2 ff ff       	call   8003aa <vprintfmt>
+	if (b.idx > 0)
+  8021a9:	83 c4 10             	add    $0x10,%esp
+  8021ac:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8021b3:	7f 12                	jg     8021c7 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8021b5:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8021bb:	85 c0                	test   %eax,%eax
+  8021bd:	75 06                	jne    8021c5 <vfprintf+0x63>
+  8021bf:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8021c5:	c9                   	leave
+  8021c6:	c3                   	ret
+		writebuf(&b);
+  8021c7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8021cd:	e8 1b ff ff ff       	call   8020ed <writebuf>
+  8021d2:	eb e1                	jmp    8021b5 <vfprintf+0x53>
+
+008021d4 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8021d4:	55                   	push   %ebp
+  8021d5:	89 e5                	mov    %esp,%ebp
+  8021d7:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8021da:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8021dd:	50                   	push   %eax
+  8021de:	ff 75 0c             	push   0xc(%ebp)
+  8021e1:	ff 75 08             	push   0x8(%ebp)
+  8021e4:	e8 79 ff ff ff       	call   802162 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+
+008021eb <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8021eb:	55                   	push   %ebp
+  8021ec:	89 e5                	mov    %esp,%ebp
+  8021ee:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8021f1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8021f4:	50                   	push   %eax
+  8021f5:	ff 75 08             	push   0x8(%ebp)
+  8021f8:	6a 01                	push   $0x1
+  8021fa:	e8 63 ff ff ff       	call   802162 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8021ff:	c9                   	leave
+  802200:	c3                   	ret
+
+00802201 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802201:	55                   	push   %ebp
+  802202:	89 e5                	mov    %esp,%ebp
+  802204:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802207:	68 1b 32 80 00       	push   $0x80321b
+  80220c:	ff 75 0c             	push   0xc(%ebp)
+  80220f:	e8 00 e7 ff ff       	call   800914 <strcpy>
+	return 0;
+}
+  802214:	b8 00 00 00 00       	mov    $0x0,%eax
+  802219:	c9                   	leave
+  80221a:	c3                   	ret
+
+0080221b <devsock_close>:
+{
+  80221b:	55                   	push   %ebp
+  80221c:	89 e5                	mov    %esp,%ebp
+  80221e:	53                   	push   %ebx
+  80221f:	83 ec 10             	sub    $0x10,%esp
+  802222:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802225:	53                   	push   %ebx
+  802226:	e8 e4 0a 00 00       	call   802d0f <pageref>
+  80222b:	89 c2                	mov    %eax,%edx
+  80222d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802230:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802235:	83 fa 01             	cmp    $0x1,%edx
+  802238:	74 05                	je     80223f <devsock_close+0x24>
+}
+  80223a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223d:	c9                   	leave
+  80223e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80223f:	83 ec 0c             	sub    $0xc,%esp
+  802242:	ff 73 0c             	push   0xc(%ebx)
+  802245:	e8 b7 02 00 00       	call   802501 <nsipc_close>
+  80224a:	83 c4 10             	add    $0x10,%esp
+  80224d:	eb eb                	jmp    80223a <devsock_close+0x1f>
+
+0080224f <devsock_write>:
+{
+  80224f:	55                   	push   %ebp
+  802250:	89 e5                	mov    %esp,%ebp
+  802252:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802255:	6a 00                	push   $0x0
+  802257:	ff 75 10             	push   0x10(%ebp)
+  80225a:	ff 75 0c             	push   0xc(%ebp)
+  80225d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802260:	ff 70 0c             	push   0xc(%eax)
+  802263:	e8 79 03 00 00       	call   8025e1 <nsipc_send>
+}
+  802268:	c9                   	leave
+  802269:	c3                   	ret
+
+0080226a <devsock_read>:
+{
+  80226a:	55                   	push   %ebp
+  80226b:	89 e5                	mov    %esp,%ebp
+  80226d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802270:	6a 00                	push   $0x0
+  802272:	ff 75 10             	push   0x10(%ebp)
+  802275:	ff 75 0c             	push   0xc(%ebp)
+  802278:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227b:	ff 70 0c             	push   0xc(%eax)
+  80227e:	e8 ef 02 00 00       	call   802572 <nsipc_recv>
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+00802285 <fd2sockid>:
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80228b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80228e:	52                   	push   %edx
+  80228f:	50                   	push   %eax
+  802290:	e8 6a f6 ff ff       	call   8018ff <fd_lookup>
+  802295:	83 c4 10             	add    $0x10,%esp
+  802298:	85 c0                	test   %eax,%eax
+  80229a:	78 10                	js     8022ac <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80229c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80229f:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022a5:	39 08                	cmp    %ecx,(%eax)
+  8022a7:	75 05                	jne    8022ae <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8022a9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8022ac:	c9                   	leave
+  8022ad:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022ae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022b3:	eb f7                	jmp    8022ac <fd2sockid+0x27>
+
+008022b5 <alloc_sockfd>:
+{
+  8022b5:	55                   	push   %ebp
+  8022b6:	89 e5                	mov    %esp,%ebp
+  8022b8:	56                   	push   %esi
+  8022b9:	53                   	push   %ebx
+  8022ba:	83 ec 1c             	sub    $0x1c,%esp
+  8022bd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8022bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c2:	50                   	push   %eax
+  8022c3:	e8 e1 f5 ff ff       	call   8018a9 <fd_alloc>
+  8022c8:	89 c3                	mov    %eax,%ebx
+  8022ca:	83 c4 10             	add    $0x10,%esp
+  8022cd:	85 c0                	test   %eax,%eax
+  8022cf:	78 43                	js     802314 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8022d1:	83 ec 04             	sub    $0x4,%esp
+  8022d4:	68 07 04 00 00       	push   $0x407
+  8022d9:	ff 75 f4             	push   -0xc(%ebp)
+  8022dc:	6a 00                	push   $0x0
+  8022de:	e8 29 eb ff ff       	call   800e0c <sys_page_alloc>
+  8022e3:	89 c3                	mov    %eax,%ebx
+  8022e5:	83 c4 10             	add    $0x10,%esp
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	78 28                	js     802314 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8022ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ef:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8022f5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8022f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022fa:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802301:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802304:	83 ec 0c             	sub    $0xc,%esp
+  802307:	50                   	push   %eax
+  802308:	e8 75 f5 ff ff       	call   801882 <fd2num>
+  80230d:	89 c3                	mov    %eax,%ebx
+  80230f:	83 c4 10             	add    $0x10,%esp
+  802312:	eb 0c                	jmp    802320 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802314:	83 ec 0c             	sub    $0xc,%esp
+  802317:	56                   	push   %esi
+  802318:	e8 e4 01 00 00       	call   802501 <nsipc_close>
+		return r;
+  80231d:	83 c4 10             	add    $0x10,%esp
+}
+  802320:	89 d8                	mov    %ebx,%eax
+  802322:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802325:	5b                   	pop    %ebx
+  802326:	5e                   	pop    %esi
+  802327:	5d                   	pop    %ebp
+  802328:	c3                   	ret
+
+00802329 <accept>:
+{
+  802329:	55                   	push   %ebp
+  80232a:	89 e5                	mov    %esp,%ebp
+  80232c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80232f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802332:	e8 4e ff ff ff       	call   802285 <fd2sockid>
+  802337:	85 c0                	test   %eax,%eax
+  802339:	78 1b                	js     802356 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80233b:	83 ec 04             	sub    $0x4,%esp
+  80233e:	ff 75 10             	push   0x10(%ebp)
+  802341:	ff 75 0c             	push   0xc(%ebp)
+  802344:	50                   	push   %eax
+  802345:	e8 0e 01 00 00       	call   802458 <nsipc_accept>
+  80234a:	83 c4 10             	add    $0x10,%esp
+  80234d:	85 c0                	test   %eax,%eax
+  80234f:	78 05                	js     802356 <accept+0x2d>
+	return alloc_sockfd(r);
+  802351:	e8 5f ff ff ff       	call   8022b5 <alloc_sockfd>
+}
+  802356:	c9                   	leave
+  802357:	c3                   	ret
+
+00802358 <bind>:
+{
+  802358:	55                   	push   %ebp
+  802359:	89 e5                	mov    %esp,%ebp
+  80235b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80235e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802361:	e8 1f ff ff ff       	call   802285 <fd2sockid>
+  802366:	85 c0                	test   %eax,%eax
+  802368:	78 12                	js     80237c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80236a:	83 ec 04             	sub    $0x4,%esp
+  80236d:	ff 75 10             	push   0x10(%ebp)
+  802370:	ff 75 0c             	push   0xc(%ebp)
+  802373:	50                   	push   %eax
+  802374:	e8 31 01 00 00       	call   8024aa <nsipc_bind>
+  802379:	83 c4 10             	add    $0x10,%esp
+}
+  80237c:	c9                   	leave
+  80237d:	c3                   	ret
+
+0080237e <shutdown>:
+{
+  80237e:	55                   	push   %ebp
+  80237f:	89 e5                	mov    %esp,%ebp
+  802381:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802384:	8b 45 08             	mov    0x8(%ebp),%eax
+  802387:	e8 f9 fe ff ff       	call   802285 <fd2sockid>
+  80238c:	85 c0                	test   %eax,%eax
+  80238e:	78 0f                	js     80239f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802390:	83 ec 08             	sub    $0x8,%esp
+  802393:	ff 75 0c             	push   0xc(%ebp)
+  802396:	50                   	push   %eax
+  802397:	e8 43 01 00 00       	call   8024df <nsipc_shutdown>
+  80239c:	83 c4 10             	add    $0x10,%esp
+}
+  80239f:	c9                   	leave
+  8023a0:	c3                   	ret
+
+008023a1 <connect>:
+{
+  8023a1:	55                   	push   %ebp
+  8023a2:	89 e5                	mov    %esp,%ebp
+  8023a4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023aa:	e8 d6 fe ff ff       	call   802285 <fd2sockid>
+  8023af:	85 c0                	test   %eax,%eax
+  8023b1:	78 12                	js     8023c5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8023b3:	83 ec 04             	sub    $0x4,%esp
+  8023b6:	ff 75 10             	push   0x10(%ebp)
+  8023b9:	ff 75 0c             	push   0xc(%ebp)
+  8023bc:	50                   	push   %eax
+  8023bd:	e8 59 01 00 00       	call   80251b <nsipc_connect>
+  8023c2:	83 c4 10             	add    $0x10,%esp
+}
+  8023c5:	c9                   	leave
+  8023c6:	c3                   	ret
+
+008023c7 <listen>:
+{
+  8023c7:	55                   	push   %ebp
+  8023c8:	89 e5                	mov    %esp,%ebp
+  8023ca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d0:	e8 b0 fe ff ff       	call   802285 <fd2sockid>
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	78 0f                	js     8023e8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8023d9:	83 ec 08             	sub    $0x8,%esp
+  8023dc:	ff 75 0c             	push   0xc(%ebp)
+  8023df:	50                   	push   %eax
+  8023e0:	e8 6b 01 00 00       	call   802550 <nsipc_listen>
+  8023e5:	83 c4 10             	add    $0x10,%esp
+}
+  8023e8:	c9                   	leave
+  8023e9:	c3                   	ret
+
+008023ea <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8023f0:	ff 75 10             	push   0x10(%ebp)
+  8023f3:	ff 75 0c             	push   0xc(%ebp)
+  8023f6:	ff 75 08             	push   0x8(%ebp)
+  8023f9:	e8 41 02 00 00       	call   80263f <nsipc_socket>
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	85 c0                	test   %eax,%eax
+  802403:	78 05                	js     80240a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802405:	e8 ab fe ff ff       	call   8022b5 <alloc_sockfd>
+}
+  80240a:	c9                   	leave
+  80240b:	c3                   	ret
+
+0080240c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80240c:	55                   	push   %ebp
+  80240d:	89 e5                	mov    %esp,%ebp
+  80240f:	53                   	push   %ebx
+  802410:	83 ec 04             	sub    $0x4,%esp
+  802413:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802415:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80241c:	74 26                	je     802444 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80241e:	6a 07                	push   $0x7
+  802420:	68 00 90 80 00       	push   $0x809000
+  802425:	53                   	push   %ebx
+  802426:	ff 35 04 50 80 00    	push   0x805004
+  80242c:	e8 4b 08 00 00       	call   802c7c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802431:	83 c4 0c             	add    $0xc,%esp
+  802434:	6a 00                	push   $0x0
+  802436:	6a 00                	push   $0x0
+  802438:	6a 00                	push   $0x0
+  80243a:	e8 25 08 00 00       	call   802c64 <ipc_recv>
+}
+  80243f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802442:	c9                   	leave
+  802443:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802444:	83 ec 0c             	sub    $0xc,%esp
+  802447:	6a 02                	push   $0x2
+  802449:	e8 82 08 00 00       	call   802cd0 <ipc_find_env>
+  80244e:	a3 04 50 80 00       	mov    %eax,0x805004
+  802453:	83 c4 10             	add    $0x10,%esp
+  802456:	eb c6                	jmp    80241e <nsipc+0x12>
+
+00802458 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802458:	55                   	push   %ebp
+  802459:	89 e5                	mov    %esp,%ebp
+  80245b:	56                   	push   %esi
+  80245c:	53                   	push   %ebx
+  80245d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802460:	8b 45 08             	mov    0x8(%ebp),%eax
+  802463:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802468:	8b 06                	mov    (%esi),%eax
+  80246a:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80246f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802474:	e8 93 ff ff ff       	call   80240c <nsipc>
+  802479:	89 c3                	mov    %eax,%ebx
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	79 09                	jns    802488 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80247f:	89 d8                	mov    %ebx,%eax
+  802481:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802484:	5b                   	pop    %ebx
+  802485:	5e                   	pop    %esi
+  802486:	5d                   	pop    %ebp
+  802487:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802488:	83 ec 04             	sub    $0x4,%esp
+  80248b:	ff 35 10 90 80 00    	push   0x809010
+  802491:	68 00 90 80 00       	push   $0x809000
+  802496:	ff 75 0c             	push   0xc(%ebp)
+  802499:	e8 fc e5 ff ff       	call   800a9a <memmove>
+		*addrlen = ret->ret_addrlen;
+  80249e:	a1 10 90 80 00       	mov    0x809010,%eax
+  8024a3:	89 06                	mov    %eax,(%esi)
+  8024a5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8024a8:	eb d5                	jmp    80247f <nsipc_accept+0x27>
+
+008024aa <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	53                   	push   %ebx
+  8024ae:	83 ec 08             	sub    $0x8,%esp
+  8024b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8024b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b7:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8024bc:	53                   	push   %ebx
+  8024bd:	ff 75 0c             	push   0xc(%ebp)
+  8024c0:	68 04 90 80 00       	push   $0x809004
+  8024c5:	e8 d0 e5 ff ff       	call   800a9a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8024ca:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  8024d0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024d5:	e8 32 ff ff ff       	call   80240c <nsipc>
+}
+  8024da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024dd:	c9                   	leave
+  8024de:	c3                   	ret
+
+008024df <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8024df:	55                   	push   %ebp
+  8024e0:	89 e5                	mov    %esp,%ebp
+  8024e2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8024e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e8:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  8024ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024f0:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  8024f5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024fa:	e8 0d ff ff ff       	call   80240c <nsipc>
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+
+00802501 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802501:	55                   	push   %ebp
+  802502:	89 e5                	mov    %esp,%ebp
+  802504:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802507:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250a:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80250f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802514:	e8 f3 fe ff ff       	call   80240c <nsipc>
+}
+  802519:	c9                   	leave
+  80251a:	c3                   	ret
+
+0080251b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80251b:	55                   	push   %ebp
+  80251c:	89 e5                	mov    %esp,%ebp
+  80251e:	53                   	push   %ebx
+  80251f:	83 ec 08             	sub    $0x8,%esp
+  802522:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802525:	8b 45 08             	mov    0x8(%ebp),%eax
+  802528:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80252d:	53                   	push   %ebx
+  80252e:	ff 75 0c             	push   0xc(%ebp)
+  802531:	68 04 90 80 00       	push   $0x809004
+  802536:	e8 5f e5 ff ff       	call   800a9a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80253b:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802541:	b8 05 00 00 00       	mov    $0x5,%eax
+  802546:	e8 c1 fe ff ff       	call   80240c <nsipc>
+}
+  80254b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80254e:	c9                   	leave
+  80254f:	c3                   	ret
+
+00802550 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802556:	8b 45 08             	mov    0x8(%ebp),%eax
+  802559:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  80255e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802561:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802566:	b8 06 00 00 00       	mov    $0x6,%eax
+  80256b:	e8 9c fe ff ff       	call   80240c <nsipc>
+}
+  802570:	c9                   	leave
+  802571:	c3                   	ret
+
+00802572 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802572:	55                   	push   %ebp
+  802573:	89 e5                	mov    %esp,%ebp
+  802575:	56                   	push   %esi
+  802576:	53                   	push   %ebx
+  802577:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80257a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802582:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80258b:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802590:	b8 07 00 00 00       	mov    $0x7,%eax
+  802595:	e8 72 fe ff ff       	call   80240c <nsipc>
+  80259a:	89 c3                	mov    %eax,%ebx
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 22                	js     8025c2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8025a0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8025a5:	39 c6                	cmp    %eax,%esi
+  8025a7:	0f 4e c6             	cmovle %esi,%eax
+  8025aa:	39 c3                	cmp    %eax,%ebx
+  8025ac:	7f 1d                	jg     8025cb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8025ae:	83 ec 04             	sub    $0x4,%esp
+  8025b1:	53                   	push   %ebx
+  8025b2:	68 00 90 80 00       	push   $0x809000
+  8025b7:	ff 75 0c             	push   0xc(%ebp)
+  8025ba:	e8 db e4 ff ff       	call   800a9a <memmove>
+  8025bf:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8025c2:	89 d8                	mov    %ebx,%eax
+  8025c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c7:	5b                   	pop    %ebx
+  8025c8:	5e                   	pop    %esi
+  8025c9:	5d                   	pop    %ebp
+  8025ca:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8025cb:	68 27 32 80 00       	push   $0x803227
+  8025d0:	68 ef 31 80 00       	push   $0x8031ef
+  8025d5:	6a 62                	push   $0x62
+  8025d7:	68 3c 32 80 00       	push   $0x80323c
+  8025dc:	e8 10 dc ff ff       	call   8001f1 <_panic>
+
+008025e1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8025e1:	55                   	push   %ebp
+  8025e2:	89 e5                	mov    %esp,%ebp
+  8025e4:	53                   	push   %ebx
+  8025e5:	83 ec 04             	sub    $0x4,%esp
+  8025e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8025eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ee:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  8025f3:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8025f9:	7f 2e                	jg     802629 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8025fb:	83 ec 04             	sub    $0x4,%esp
+  8025fe:	53                   	push   %ebx
+  8025ff:	ff 75 0c             	push   0xc(%ebp)
+  802602:	68 0c 90 80 00       	push   $0x80900c
+  802607:	e8 8e e4 ff ff       	call   800a9a <memmove>
+	nsipcbuf.send.req_size = size;
+  80260c:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802612:	8b 45 14             	mov    0x14(%ebp),%eax
+  802615:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  80261a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80261f:	e8 e8 fd ff ff       	call   80240c <nsipc>
+}
+  802624:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802627:	c9                   	leave
+  802628:	c3                   	ret
+	assert(size < 1600);
+  802629:	68 48 32 80 00       	push   $0x803248
+  80262e:	68 ef 31 80 00       	push   $0x8031ef
+  802633:	6a 6d                	push   $0x6d
+  802635:	68 3c 32 80 00       	push   $0x80323c
+  80263a:	e8 b2 db ff ff       	call   8001f1 <_panic>
+
+0080263f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80263f:	55                   	push   %ebp
+  802640:	89 e5                	mov    %esp,%ebp
+  802642:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802645:	8b 45 08             	mov    0x8(%ebp),%eax
+  802648:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  80264d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802650:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802655:	8b 45 10             	mov    0x10(%ebp),%eax
+  802658:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  80265d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802662:	e8 a5 fd ff ff       	call   80240c <nsipc>
+}
+  802667:	c9                   	leave
+  802668:	c3                   	ret
+
+00802669 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802669:	55                   	push   %ebp
+  80266a:	89 e5                	mov    %esp,%ebp
+  80266c:	56                   	push   %esi
+  80266d:	53                   	push   %ebx
+  80266e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802671:	83 ec 0c             	sub    $0xc,%esp
+  802674:	ff 75 08             	push   0x8(%ebp)
+  802677:	e8 16 f2 ff ff       	call   801892 <fd2data>
+  80267c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80267e:	83 c4 08             	add    $0x8,%esp
+  802681:	68 54 32 80 00       	push   $0x803254
+  802686:	53                   	push   %ebx
+  802687:	e8 88 e2 ff ff       	call   800914 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80268c:	8b 46 04             	mov    0x4(%esi),%eax
+  80268f:	2b 06                	sub    (%esi),%eax
+  802691:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802697:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80269e:	00 00 00 
+	stat->st_dev = &devpipe;
+  8026a1:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8026a8:	40 80 00 
+	return 0;
+}
+  8026ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b3:	5b                   	pop    %ebx
+  8026b4:	5e                   	pop    %esi
+  8026b5:	5d                   	pop    %ebp
+  8026b6:	c3                   	ret
+
+008026b7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8026b7:	55                   	push   %ebp
+  8026b8:	89 e5                	mov    %esp,%ebp
+  8026ba:	53                   	push   %ebx
+  8026bb:	83 ec 0c             	sub    $0xc,%esp
+  8026be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8026c1:	53                   	push   %ebx
+  8026c2:	6a 00                	push   $0x0
+  8026c4:	e8 1e e8 ff ff       	call   800ee7 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8026c9:	89 1c 24             	mov    %ebx,(%esp)
+  8026cc:	e8 c1 f1 ff ff       	call   801892 <fd2data>
+  8026d1:	83 c4 08             	add    $0x8,%esp
+  8026d4:	50                   	push   %eax
+  8026d5:	6a 00                	push   $0x0
+  8026d7:	e8 0b e8 ff ff       	call   800ee7 <sys_page_unmap>
+}
+  8026dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026df:	c9                   	leave
+  8026e0:	c3                   	ret
+
+008026e1 <_pipeisclosed>:
+{
+  8026e1:	55                   	push   %ebp
+  8026e2:	89 e5                	mov    %esp,%ebp
+  8026e4:	57                   	push   %edi
+  8026e5:	56                   	push   %esi
+  8026e6:	53                   	push   %ebx
+  8026e7:	83 ec 1c             	sub    $0x1c,%esp
+  8026ea:	89 c7                	mov    %eax,%edi
+  8026ec:	89 d6                	mov    %edx,%esi
+  8026ee:	eb 3c                	jmp    80272c <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8026f0:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8026f3:	83 ec 0c             	sub    $0xc,%esp
+  8026f6:	57                   	push   %edi
+  8026f7:	e8 13 06 00 00       	call   802d0f <pageref>
+  8026fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026ff:	89 34 24             	mov    %esi,(%esp)
+  802702:	e8 08 06 00 00       	call   802d0f <pageref>
+  802707:	89 c2                	mov    %eax,%edx
+  802709:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80270b:	05 00 00 00 20       	add    $0x20000000,%eax
+  802710:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802713:	8b 0d 20 70 80 00    	mov    0x807020,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802719:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80271e:	76 31                	jbe    802751 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802720:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802723:	39 c3                	cmp    %eax,%ebx
+  802725:	74 76                	je     80279d <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802727:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80272a:	74 36                	je     802762 <_pipeisclosed+0x81>
+  80272c:	89 e0                	mov    %esp,%eax
+  80272e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802733:	8b 15 20 70 80 00    	mov    0x807020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802739:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80273e:	77 b0                	ja     8026f0 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802740:	c1 e8 10             	shr    $0x10,%eax
+  802743:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802749:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80274f:	eb 9f                	jmp    8026f0 <_pipeisclosed+0xf>
+  802751:	c1 e8 10             	shr    $0x10,%eax
+  802754:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80275a:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802760:	eb be                	jmp    802720 <_pipeisclosed+0x3f>
+  802762:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802764:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802769:	8b 15 20 70 80 00    	mov    0x807020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80276f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802774:	76 16                	jbe    80278c <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802776:	8b 42 58             	mov    0x58(%edx),%eax
+  802779:	6a 01                	push   $0x1
+  80277b:	50                   	push   %eax
+  80277c:	53                   	push   %ebx
+  80277d:	68 5b 32 80 00       	push   $0x80325b
+  802782:	e8 45 db ff ff       	call   8002cc <cprintf>
+  802787:	83 c4 10             	add    $0x10,%esp
+  80278a:	eb a0                	jmp    80272c <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80278c:	c1 e8 10             	shr    $0x10,%eax
+  80278f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802795:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80279b:	eb d9                	jmp    802776 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80279d:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8027a0:	0f 94 c0             	sete   %al
+  8027a3:	0f b6 c0             	movzbl %al,%eax
+}
+  8027a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027a9:	5b                   	pop    %ebx
+  8027aa:	5e                   	pop    %esi
+  8027ab:	5f                   	pop    %edi
+  8027ac:	5d                   	pop    %ebp
+  8027ad:	c3                   	ret
+
+008027ae <devpipe_write>:
+{
+  8027ae:	55                   	push   %ebp
+  8027af:	89 e5                	mov    %esp,%ebp
+  8027b1:	57                   	push   %edi
+  8027b2:	56                   	push   %esi
+  8027b3:	53                   	push   %ebx
+  8027b4:	83 ec 28             	sub    $0x28,%esp
+  8027b7:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8027ba:	56                   	push   %esi
+  8027bb:	e8 d2 f0 ff ff       	call   801892 <fd2data>
+  8027c0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8027c2:	83 c4 10             	add    $0x10,%esp
+  8027c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ca:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027cd:	75 09                	jne    8027d8 <devpipe_write+0x2a>
+	return i;
+  8027cf:	89 f8                	mov    %edi,%eax
+  8027d1:	eb 23                	jmp    8027f6 <devpipe_write+0x48>
+			sys_yield();
+  8027d3:	e8 ee e5 ff ff       	call   800dc6 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8027d8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027db:	8b 0b                	mov    (%ebx),%ecx
+  8027dd:	8d 51 20             	lea    0x20(%ecx),%edx
+  8027e0:	39 d0                	cmp    %edx,%eax
+  8027e2:	72 1a                	jb     8027fe <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8027e4:	89 da                	mov    %ebx,%edx
+  8027e6:	89 f0                	mov    %esi,%eax
+  8027e8:	e8 f4 fe ff ff       	call   8026e1 <_pipeisclosed>
+  8027ed:	85 c0                	test   %eax,%eax
+  8027ef:	74 e2                	je     8027d3 <devpipe_write+0x25>
+				return 0;
+  8027f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f9:	5b                   	pop    %ebx
+  8027fa:	5e                   	pop    %esi
+  8027fb:	5f                   	pop    %edi
+  8027fc:	5d                   	pop    %ebp
+  8027fd:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8027fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802801:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802805:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802808:	89 c2                	mov    %eax,%edx
+  80280a:	c1 fa 1f             	sar    $0x1f,%edx
+  80280d:	89 d1                	mov    %edx,%ecx
+  80280f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802812:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802815:	83 e2 1f             	and    $0x1f,%edx
+  802818:	29 ca                	sub    %ecx,%edx
+  80281a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80281e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802822:	83 c0 01             	add    $0x1,%eax
+  802825:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802828:	83 c7 01             	add    $0x1,%edi
+  80282b:	eb 9d                	jmp    8027ca <devpipe_write+0x1c>
+
+0080282d <devpipe_read>:
+{
+  80282d:	55                   	push   %ebp
+  80282e:	89 e5                	mov    %esp,%ebp
+  802830:	57                   	push   %edi
+  802831:	56                   	push   %esi
+  802832:	53                   	push   %ebx
+  802833:	83 ec 18             	sub    $0x18,%esp
+  802836:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802839:	57                   	push   %edi
+  80283a:	e8 53 f0 ff ff       	call   801892 <fd2data>
+  80283f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802841:	83 c4 10             	add    $0x10,%esp
+  802844:	be 00 00 00 00       	mov    $0x0,%esi
+  802849:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80284c:	75 13                	jne    802861 <devpipe_read+0x34>
+	return i;
+  80284e:	89 f0                	mov    %esi,%eax
+  802850:	eb 02                	jmp    802854 <devpipe_read+0x27>
+				return i;
+  802852:	89 f0                	mov    %esi,%eax
+}
+  802854:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802857:	5b                   	pop    %ebx
+  802858:	5e                   	pop    %esi
+  802859:	5f                   	pop    %edi
+  80285a:	5d                   	pop    %ebp
+  80285b:	c3                   	ret
+			sys_yield();
+  80285c:	e8 65 e5 ff ff       	call   800dc6 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802861:	8b 03                	mov    (%ebx),%eax
+  802863:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802866:	75 18                	jne    802880 <devpipe_read+0x53>
+			if (i > 0)
+  802868:	85 f6                	test   %esi,%esi
+  80286a:	75 e6                	jne    802852 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80286c:	89 da                	mov    %ebx,%edx
+  80286e:	89 f8                	mov    %edi,%eax
+  802870:	e8 6c fe ff ff       	call   8026e1 <_pipeisclosed>
+  802875:	85 c0                	test   %eax,%eax
+  802877:	74 e3                	je     80285c <devpipe_read+0x2f>
+				return 0;
+  802879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287e:	eb d4                	jmp    802854 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802880:	99                   	cltd
+  802881:	c1 ea 1b             	shr    $0x1b,%edx
+  802884:	01 d0                	add    %edx,%eax
+  802886:	83 e0 1f             	and    $0x1f,%eax
+  802889:	29 d0                	sub    %edx,%eax
+  80288b:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802890:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802893:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802896:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802899:	83 c6 01             	add    $0x1,%esi
+  80289c:	eb ab                	jmp    802849 <devpipe_read+0x1c>
+
+0080289e <pipe>:
+{
+  80289e:	55                   	push   %ebp
+  80289f:	89 e5                	mov    %esp,%ebp
+  8028a1:	56                   	push   %esi
+  8028a2:	53                   	push   %ebx
+  8028a3:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8028a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028a9:	50                   	push   %eax
+  8028aa:	e8 fa ef ff ff       	call   8018a9 <fd_alloc>
+  8028af:	89 c3                	mov    %eax,%ebx
+  8028b1:	83 c4 10             	add    $0x10,%esp
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	0f 88 23 01 00 00    	js     8029df <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028bc:	83 ec 04             	sub    $0x4,%esp
+  8028bf:	68 07 04 00 00       	push   $0x407
+  8028c4:	ff 75 f4             	push   -0xc(%ebp)
+  8028c7:	6a 00                	push   $0x0
+  8028c9:	e8 3e e5 ff ff       	call   800e0c <sys_page_alloc>
+  8028ce:	89 c3                	mov    %eax,%ebx
+  8028d0:	83 c4 10             	add    $0x10,%esp
+  8028d3:	85 c0                	test   %eax,%eax
+  8028d5:	0f 88 04 01 00 00    	js     8029df <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8028db:	83 ec 0c             	sub    $0xc,%esp
+  8028de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8028e1:	50                   	push   %eax
+  8028e2:	e8 c2 ef ff ff       	call   8018a9 <fd_alloc>
+  8028e7:	89 c3                	mov    %eax,%ebx
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	0f 88 db 00 00 00    	js     8029cf <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028f4:	83 ec 04             	sub    $0x4,%esp
+  8028f7:	68 07 04 00 00       	push   $0x407
+  8028fc:	ff 75 f0             	push   -0x10(%ebp)
+  8028ff:	6a 00                	push   $0x0
+  802901:	e8 06 e5 ff ff       	call   800e0c <sys_page_alloc>
+  802906:	89 c3                	mov    %eax,%ebx
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	0f 88 bc 00 00 00    	js     8029cf <pipe+0x131>
+	va = fd2data(fd0);
+  802913:	83 ec 0c             	sub    $0xc,%esp
+  802916:	ff 75 f4             	push   -0xc(%ebp)
+  802919:	e8 74 ef ff ff       	call   801892 <fd2data>
+  80291e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802920:	83 c4 0c             	add    $0xc,%esp
+  802923:	68 07 04 00 00       	push   $0x407
+  802928:	50                   	push   %eax
+  802929:	6a 00                	push   $0x0
+  80292b:	e8 dc e4 ff ff       	call   800e0c <sys_page_alloc>
+  802930:	89 c3                	mov    %eax,%ebx
+  802932:	83 c4 10             	add    $0x10,%esp
+  802935:	85 c0                	test   %eax,%eax
+  802937:	0f 88 82 00 00 00    	js     8029bf <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80293d:	83 ec 0c             	sub    $0xc,%esp
+  802940:	ff 75 f0             	push   -0x10(%ebp)
+  802943:	e8 4a ef ff ff       	call   801892 <fd2data>
+  802948:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80294f:	50                   	push   %eax
+  802950:	6a 00                	push   $0x0
+  802952:	56                   	push   %esi
+  802953:	6a 00                	push   $0x0
+  802955:	e8 1f e5 ff ff       	call   800e79 <sys_page_map>
+  80295a:	89 c3                	mov    %eax,%ebx
+  80295c:	83 c4 20             	add    $0x20,%esp
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	78 4e                	js     8029b1 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802963:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802968:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80296b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80296d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802970:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802977:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80297a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80297c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80297f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802986:	83 ec 0c             	sub    $0xc,%esp
+  802989:	ff 75 f4             	push   -0xc(%ebp)
+  80298c:	e8 f1 ee ff ff       	call   801882 <fd2num>
+  802991:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802994:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802996:	83 c4 04             	add    $0x4,%esp
+  802999:	ff 75 f0             	push   -0x10(%ebp)
+  80299c:	e8 e1 ee ff ff       	call   801882 <fd2num>
+  8029a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029a4:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8029a7:	83 c4 10             	add    $0x10,%esp
+  8029aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029af:	eb 2e                	jmp    8029df <pipe+0x141>
+	sys_page_unmap(0, va);
+  8029b1:	83 ec 08             	sub    $0x8,%esp
+  8029b4:	56                   	push   %esi
+  8029b5:	6a 00                	push   $0x0
+  8029b7:	e8 2b e5 ff ff       	call   800ee7 <sys_page_unmap>
+  8029bc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8029bf:	83 ec 08             	sub    $0x8,%esp
+  8029c2:	ff 75 f0             	push   -0x10(%ebp)
+  8029c5:	6a 00                	push   $0x0
+  8029c7:	e8 1b e5 ff ff       	call   800ee7 <sys_page_unmap>
+  8029cc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8029cf:	83 ec 08             	sub    $0x8,%esp
+  8029d2:	ff 75 f4             	push   -0xc(%ebp)
+  8029d5:	6a 00                	push   $0x0
+  8029d7:	e8 0b e5 ff ff       	call   800ee7 <sys_page_unmap>
+  8029dc:	83 c4 10             	add    $0x10,%esp
+}
+  8029df:	89 d8                	mov    %ebx,%eax
+  8029e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029e4:	5b                   	pop    %ebx
+  8029e5:	5e                   	pop    %esi
+  8029e6:	5d                   	pop    %ebp
+  8029e7:	c3                   	ret
+
+008029e8 <pipeisclosed>:
+{
+  8029e8:	55                   	push   %ebp
+  8029e9:	89 e5                	mov    %esp,%ebp
+  8029eb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029f1:	50                   	push   %eax
+  8029f2:	ff 75 08             	push   0x8(%ebp)
+  8029f5:	e8 05 ef ff ff       	call   8018ff <fd_lookup>
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 18                	js     802a19 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802a01:	83 ec 0c             	sub    $0xc,%esp
+  802a04:	ff 75 f4             	push   -0xc(%ebp)
+  802a07:	e8 86 ee ff ff       	call   801892 <fd2data>
+  802a0c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802a0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a11:	e8 cb fc ff ff       	call   8026e1 <_pipeisclosed>
+  802a16:	83 c4 10             	add    $0x10,%esp
+}
+  802a19:	c9                   	leave
+  802a1a:	c3                   	ret
+
+00802a1b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a20:	c3                   	ret
+
+00802a21 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802a27:	68 73 32 80 00       	push   $0x803273
+  802a2c:	ff 75 0c             	push   0xc(%ebp)
+  802a2f:	e8 e0 de ff ff       	call   800914 <strcpy>
+	return 0;
+}
+  802a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a39:	c9                   	leave
+  802a3a:	c3                   	ret
+
+00802a3b <devcons_write>:
+{
+  802a3b:	55                   	push   %ebp
+  802a3c:	89 e5                	mov    %esp,%ebp
+  802a3e:	57                   	push   %edi
+  802a3f:	56                   	push   %esi
+  802a40:	53                   	push   %ebx
+  802a41:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802a47:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802a4c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802a52:	eb 2e                	jmp    802a82 <devcons_write+0x47>
+		m = n - tot;
+  802a54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a57:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802a59:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a5e:	39 c3                	cmp    %eax,%ebx
+  802a60:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802a63:	83 ec 04             	sub    $0x4,%esp
+  802a66:	53                   	push   %ebx
+  802a67:	89 f0                	mov    %esi,%eax
+  802a69:	03 45 0c             	add    0xc(%ebp),%eax
+  802a6c:	50                   	push   %eax
+  802a6d:	57                   	push   %edi
+  802a6e:	e8 27 e0 ff ff       	call   800a9a <memmove>
+		sys_cputs(buf, m);
+  802a73:	83 c4 08             	add    $0x8,%esp
+  802a76:	53                   	push   %ebx
+  802a77:	57                   	push   %edi
+  802a78:	e8 10 e2 ff ff       	call   800c8d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802a7d:	01 de                	add    %ebx,%esi
+  802a7f:	83 c4 10             	add    $0x10,%esp
+  802a82:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a85:	72 cd                	jb     802a54 <devcons_write+0x19>
+}
+  802a87:	89 f0                	mov    %esi,%eax
+  802a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a8c:	5b                   	pop    %ebx
+  802a8d:	5e                   	pop    %esi
+  802a8e:	5f                   	pop    %edi
+  802a8f:	5d                   	pop    %ebp
+  802a90:	c3                   	ret
+
+00802a91 <devcons_read>:
+{
+  802a91:	55                   	push   %ebp
+  802a92:	89 e5                	mov    %esp,%ebp
+  802a94:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802aa0:	75 07                	jne    802aa9 <devcons_read+0x18>
+  802aa2:	eb 1f                	jmp    802ac3 <devcons_read+0x32>
+		sys_yield();
+  802aa4:	e8 1d e3 ff ff       	call   800dc6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802aa9:	e8 23 e2 ff ff       	call   800cd1 <sys_cgetc>
+  802aae:	85 c0                	test   %eax,%eax
+  802ab0:	74 f2                	je     802aa4 <devcons_read+0x13>
+	if (c < 0)
+  802ab2:	78 0f                	js     802ac3 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802ab4:	83 f8 04             	cmp    $0x4,%eax
+  802ab7:	74 0c                	je     802ac5 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802abc:	88 02                	mov    %al,(%edx)
+	return 1;
+  802abe:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+		return 0;
+  802ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aca:	eb f7                	jmp    802ac3 <devcons_read+0x32>
+
+00802acc <cputchar>:
+{
+  802acc:	55                   	push   %ebp
+  802acd:	89 e5                	mov    %esp,%ebp
+  802acf:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802ad8:	6a 01                	push   $0x1
+  802ada:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802add:	50                   	push   %eax
+  802ade:	e8 aa e1 ff ff       	call   800c8d <sys_cputs>
+}
+  802ae3:	83 c4 10             	add    $0x10,%esp
+  802ae6:	c9                   	leave
+  802ae7:	c3                   	ret
+
+00802ae8 <getchar>:
+{
+  802ae8:	55                   	push   %ebp
+  802ae9:	89 e5                	mov    %esp,%ebp
+  802aeb:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802aee:	6a 01                	push   $0x1
+  802af0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802af3:	50                   	push   %eax
+  802af4:	6a 00                	push   $0x0
+  802af6:	e8 8a f0 ff ff       	call   801b85 <read>
+	if (r < 0)
+  802afb:	83 c4 10             	add    $0x10,%esp
+  802afe:	85 c0                	test   %eax,%eax
+  802b00:	78 06                	js     802b08 <getchar+0x20>
+	if (r < 1)
+  802b02:	74 06                	je     802b0a <getchar+0x22>
+	return c;
+  802b04:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802b08:	c9                   	leave
+  802b09:	c3                   	ret
+		return -E_EOF;
+  802b0a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802b0f:	eb f7                	jmp    802b08 <getchar+0x20>
+
+00802b11 <iscons>:
+{
+  802b11:	55                   	push   %ebp
+  802b12:	89 e5                	mov    %esp,%ebp
+  802b14:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b1a:	50                   	push   %eax
+  802b1b:	ff 75 08             	push   0x8(%ebp)
+  802b1e:	e8 dc ed ff ff       	call   8018ff <fd_lookup>
+  802b23:	83 c4 10             	add    $0x10,%esp
+  802b26:	85 c0                	test   %eax,%eax
+  802b28:	78 11                	js     802b3b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802b2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b2d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b33:	39 10                	cmp    %edx,(%eax)
+  802b35:	0f 94 c0             	sete   %al
+  802b38:	0f b6 c0             	movzbl %al,%eax
+}
+  802b3b:	c9                   	leave
+  802b3c:	c3                   	ret
+
+00802b3d <opencons>:
+{
+  802b3d:	55                   	push   %ebp
+  802b3e:	89 e5                	mov    %esp,%ebp
+  802b40:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802b43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b46:	50                   	push   %eax
+  802b47:	e8 5d ed ff ff       	call   8018a9 <fd_alloc>
+  802b4c:	83 c4 10             	add    $0x10,%esp
+  802b4f:	85 c0                	test   %eax,%eax
+  802b51:	78 3a                	js     802b8d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802b53:	83 ec 04             	sub    $0x4,%esp
+  802b56:	68 07 04 00 00       	push   $0x407
+  802b5b:	ff 75 f4             	push   -0xc(%ebp)
+  802b5e:	6a 00                	push   $0x0
+  802b60:	e8 a7 e2 ff ff       	call   800e0c <sys_page_alloc>
+  802b65:	83 c4 10             	add    $0x10,%esp
+  802b68:	85 c0                	test   %eax,%eax
+  802b6a:	78 21                	js     802b8d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802b6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b6f:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b75:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802b77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b7a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802b81:	83 ec 0c             	sub    $0xc,%esp
+  802b84:	50                   	push   %eax
+  802b85:	e8 f8 ec ff ff       	call   801882 <fd2num>
+  802b8a:	83 c4 10             	add    $0x10,%esp
+}
+  802b8d:	c9                   	leave
+  802b8e:	c3                   	ret
+
+00802b8f <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802b8f:	55                   	push   %ebp
+  802b90:	89 e5                	mov    %esp,%ebp
+  802b92:	56                   	push   %esi
+  802b93:	53                   	push   %ebx
+  802b94:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802ba4:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802ba7:	83 ec 08             	sub    $0x8,%esp
+  802baa:	ff 75 14             	push   0x14(%ebp)
+  802bad:	50                   	push   %eax
+  802bae:	e8 6a e6 ff ff       	call   80121d <sys_ipc_recv_until>
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	85 c0                	test   %eax,%eax
+  802bb8:	78 61                	js     802c1b <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802bba:	85 f6                	test   %esi,%esi
+  802bbc:	74 1c                	je     802bda <ipc_recv_until+0x4b>
+  802bbe:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802bc0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802bc5:	8b 15 20 70 80 00    	mov    0x807020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802bcb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802bd0:	76 5f                	jbe    802c31 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802bd2:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802bd8:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802bda:	85 db                	test   %ebx,%ebx
+  802bdc:	74 1c                	je     802bfa <ipc_recv_until+0x6b>
+  802bde:	89 e0                	mov    %esp,%eax
+  802be0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802be5:	8b 15 20 70 80 00    	mov    0x807020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802beb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802bf0:	76 50                	jbe    802c42 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802bf2:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802bf8:	89 03                	mov    %eax,(%ebx)
+  802bfa:	89 e0                	mov    %esp,%eax
+  802bfc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c01:	8b 15 20 70 80 00    	mov    0x807020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c07:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c0c:	76 45                	jbe    802c53 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802c0e:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802c14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c17:	5b                   	pop    %ebx
+  802c18:	5e                   	pop    %esi
+  802c19:	5d                   	pop    %ebp
+  802c1a:	c3                   	ret
+		if (from_env_store)
+  802c1b:	85 f6                	test   %esi,%esi
+  802c1d:	74 06                	je     802c25 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802c1f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802c25:	85 db                	test   %ebx,%ebx
+  802c27:	74 eb                	je     802c14 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802c29:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802c2f:	eb e3                	jmp    802c14 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802c31:	c1 e8 10             	shr    $0x10,%eax
+  802c34:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c3a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c40:	eb 90                	jmp    802bd2 <ipc_recv_until+0x43>
+  802c42:	c1 e8 10             	shr    $0x10,%eax
+  802c45:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c4b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c51:	eb 9f                	jmp    802bf2 <ipc_recv_until+0x63>
+  802c53:	c1 e8 10             	shr    $0x10,%eax
+  802c56:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c5c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c62:	eb aa                	jmp    802c0e <ipc_recv_until+0x7f>
+
+00802c64 <ipc_recv>:
+{
+  802c64:	55                   	push   %ebp
+  802c65:	89 e5                	mov    %esp,%ebp
+  802c67:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802c6a:	6a 00                	push   $0x0
+  802c6c:	ff 75 10             	push   0x10(%ebp)
+  802c6f:	ff 75 0c             	push   0xc(%ebp)
+  802c72:	ff 75 08             	push   0x8(%ebp)
+  802c75:	e8 15 ff ff ff       	call   802b8f <ipc_recv_until>
+}
+  802c7a:	c9                   	leave
+  802c7b:	c3                   	ret
+
+00802c7c <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	57                   	push   %edi
+  802c80:	56                   	push   %esi
+  802c81:	53                   	push   %ebx
+  802c82:	83 ec 0c             	sub    $0xc,%esp
+  802c85:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c88:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802c8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802c8e:	85 db                	test   %ebx,%ebx
+  802c90:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c95:	0f 44 d8             	cmove  %eax,%ebx
+  802c98:	eb 05                	jmp    802c9f <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802c9a:	e8 27 e1 ff ff       	call   800dc6 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802c9f:	ff 75 14             	push   0x14(%ebp)
+  802ca2:	53                   	push   %ebx
+  802ca3:	56                   	push   %esi
+  802ca4:	57                   	push   %edi
+  802ca5:	e8 bf e4 ff ff       	call   801169 <sys_ipc_try_send>
+  802caa:	83 c4 10             	add    $0x10,%esp
+  802cad:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802cb0:	74 e8                	je     802c9a <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802cb2:	85 c0                	test   %eax,%eax
+  802cb4:	78 08                	js     802cbe <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802cb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb9:	5b                   	pop    %ebx
+  802cba:	5e                   	pop    %esi
+  802cbb:	5f                   	pop    %edi
+  802cbc:	5d                   	pop    %ebp
+  802cbd:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802cbe:	50                   	push   %eax
+  802cbf:	68 7f 32 80 00       	push   $0x80327f
+  802cc4:	6a 4f                	push   $0x4f
+  802cc6:	68 92 32 80 00       	push   $0x803292
+  802ccb:	e8 21 d5 ff ff       	call   8001f1 <_panic>
+
+00802cd0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802cd0:	55                   	push   %ebp
+  802cd1:	89 e5                	mov    %esp,%ebp
+  802cd3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802cdb:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802ce1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ce7:	8b 52 50             	mov    0x50(%edx),%edx
+  802cea:	39 ca                	cmp    %ecx,%edx
+  802cec:	74 11                	je     802cff <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802cee:	83 c0 01             	add    $0x1,%eax
+  802cf1:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802cf6:	75 e3                	jne    802cdb <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfd:	eb 0e                	jmp    802d0d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802cff:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d05:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d0a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802d0d:	5d                   	pop    %ebp
+  802d0e:	c3                   	ret
+
+00802d0f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d0f:	55                   	push   %ebp
+  802d10:	89 e5                	mov    %esp,%ebp
+  802d12:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d15:	89 c2                	mov    %eax,%edx
+  802d17:	c1 ea 16             	shr    $0x16,%edx
+  802d1a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802d21:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d26:	f6 c1 01             	test   $0x1,%cl
+  802d29:	74 1a                	je     802d45 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802d2b:	c1 e8 0c             	shr    $0xc,%eax
+  802d2e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802d35:	a8 01                	test   $0x1,%al
+  802d37:	74 0c                	je     802d45 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802d39:	c1 e8 0c             	shr    $0xc,%eax
+  802d3c:	c1 e0 04             	shl    $0x4,%eax
+  802d3f:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802d45:	89 d0                	mov    %edx,%eax
+  802d47:	5d                   	pop    %ebp
+  802d48:	c3                   	ret
@@ -0,0 +1,7240 @@
+
+obj/user/ctxbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 21 01 00 00       	call   800152 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <bounce>:
+		ipc_send(who, i, NULL, 0);
+}
+
+static void
+bounce(envid_t child, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c7                	mov    %eax,%edi
+  80003e:	89 d6                	mov    %edx,%esi
+	int i;
+
+	for (i = 0; i < n; i++) {
+  800040:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800045:	39 f3                	cmp    %esi,%ebx
+  800047:	7d 39                	jge    800082 <bounce+0x4f>
+		ipc_send(child, i, NULL, 0);
+  800049:	6a 00                	push   $0x0
+  80004b:	6a 00                	push   $0x0
+  80004d:	53                   	push   %ebx
+  80004e:	57                   	push   %edi
+  80004f:	e8 26 1e 00 00       	call   801e7a <ipc_send>
+		if (ipc_recv(NULL, NULL, NULL) != i)
+  800054:	83 c4 0c             	add    $0xc,%esp
+  800057:	6a 00                	push   $0x0
+  800059:	6a 00                	push   $0x0
+  80005b:	6a 00                	push   $0x0
+  80005d:	e8 00 1e 00 00       	call   801e62 <ipc_recv>
+  800062:	83 c4 10             	add    $0x10,%esp
+  800065:	39 d8                	cmp    %ebx,%eax
+  800067:	75 05                	jne    80006e <bounce+0x3b>
+	for (i = 0; i < n; i++) {
+  800069:	83 c3 01             	add    $0x1,%ebx
+  80006c:	eb d7                	jmp    800045 <bounce+0x12>
+			panic("ctxbench: lost count");
+  80006e:	83 ec 04             	sub    $0x4,%esp
+  800071:	68 60 34 80 00       	push   $0x803460
+  800076:	6a 26                	push   $0x26
+  800078:	68 75 34 80 00       	push   $0x803475
+  80007d:	e8 94 01 00 00       	call   800216 <_panic>
+	}
+}
+  800082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800085:	5b                   	pop    %ebx
+  800086:	5e                   	pop    %esi
+  800087:	5f                   	pop    %edi
+  800088:	5d                   	pop    %ebp
+  800089:	c3                   	ret
+
+0080008a <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80008a:	55                   	push   %ebp
+  80008b:	89 e5                	mov    %esp,%ebp
+  80008d:	57                   	push   %edi
+  80008e:	56                   	push   %esi
+  80008f:	53                   	push   %ebx
+  800090:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t child;
+	uint64_t start, total;
+
+	if ((child = fork()) < 0)
+  800093:	e8 84 1c 00 00       	call   801d1c <fork>
+  800098:	89 c3                	mov    %eax,%ebx
+  80009a:	85 c0                	test   %eax,%eax
+  80009c:	78 76                	js     800114 <umain+0x8a>
+		panic("fork: %e", child);
+	if (child == 0) {
+  80009e:	0f 84 82 00 00 00    	je     800126 <umain+0x9c>
+		echo();
+		return;
+	}
+
+	bounce(child, NWARMUP);
+  8000a4:	ba 00 04 00 00       	mov    $0x400,%edx
+  8000a9:	e8 85 ff ff ff       	call   800033 <bounce>
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  8000ae:	0f 31                	rdtsc
+  8000b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8000b3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	start = read_tsc();
+	bounce(child, NROUNDS);
+  8000b6:	ba 00 20 00 00       	mov    $0x2000,%edx
+  8000bb:	89 d8                	mov    %ebx,%eax
+  8000bd:	e8 71 ff ff ff       	call   800033 <bounce>
+  8000c2:	0f 31                	rdtsc
+	total = read_tsc() - start;
+  8000c4:	89 c6                	mov    %eax,%esi
+  8000c6:	89 d7                	mov    %edx,%edi
+  8000c8:	2b 75 d0             	sub    -0x30(%ebp),%esi
+  8000cb:	1b 7d d4             	sbb    -0x2c(%ebp),%edi
+	ipc_send(child, STOP, NULL, 0);
+  8000ce:	6a 00                	push   $0x0
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	6a ff                	push   $0xffffffff
+  8000d4:	53                   	push   %ebx
+  8000d5:	e8 a0 1d 00 00       	call   801e7a <ipc_send>
+	wait(child);
+  8000da:	89 1c 24             	mov    %ebx,(%esp)
+  8000dd:	e8 d2 30 00 00       	call   8031b4 <wait>
+
+	cprintf("ctxbench: %u round trips, %u cycles each, %u per switch\n",
+		NROUNDS, (uint32_t) (total >> NROUNDS_SHIFT),
+		(uint32_t) (total >> (NROUNDS_SHIFT + 1)));
+  8000e2:	89 f0                	mov    %esi,%eax
+  8000e4:	89 fa                	mov    %edi,%edx
+  8000e6:	0f ac d0 0e          	shrd   $0xe,%edx,%eax
+  8000ea:	c1 ea 0e             	shr    $0xe,%edx
+	cprintf("ctxbench: %u round trips, %u cycles each, %u per switch\n",
+  8000ed:	50                   	push   %eax
+		NROUNDS, (uint32_t) (total >> NROUNDS_SHIFT),
+  8000ee:	89 f0                	mov    %esi,%eax
+  8000f0:	89 fa                	mov    %edi,%edx
+  8000f2:	0f ac d0 0d          	shrd   $0xd,%edx,%eax
+  8000f6:	c1 ea 0d             	shr    $0xd,%edx
+	cprintf("ctxbench: %u round trips, %u cycles each, %u per switch\n",
+  8000f9:	50                   	push   %eax
+  8000fa:	68 00 20 00 00       	push   $0x2000
+  8000ff:	68 88 34 80 00       	push   $0x803488
+  800104:	e8 e8 01 00 00       	call   8002f1 <cprintf>
+  800109:	83 c4 20             	add    $0x20,%esp
+}
+  80010c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010f:	5b                   	pop    %ebx
+  800110:	5e                   	pop    %esi
+  800111:	5f                   	pop    %edi
+  800112:	5d                   	pop    %ebp
+  800113:	c3                   	ret
+		panic("fork: %e", child);
+  800114:	50                   	push   %eax
+  800115:	68 30 39 80 00       	push   $0x803930
+  80011a:	6a 31                	push   $0x31
+  80011c:	68 75 34 80 00       	push   $0x803475
+  800121:	e8 f0 00 00 00       	call   800216 <_panic>
+	while ((i = ipc_recv(&who, NULL, NULL)) != STOP)
+  800126:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+  800129:	eb 10                	jmp    80013b <umain+0xb1>
+		ipc_send(who, i, NULL, 0);
+  80012b:	6a 00                	push   $0x0
+  80012d:	6a 00                	push   $0x0
+  80012f:	50                   	push   %eax
+  800130:	ff 75 e4             	push   -0x1c(%ebp)
+  800133:	e8 42 1d 00 00       	call   801e7a <ipc_send>
+  800138:	83 c4 10             	add    $0x10,%esp
+	while ((i = ipc_recv(&who, NULL, NULL)) != STOP)
+  80013b:	83 ec 04             	sub    $0x4,%esp
+  80013e:	6a 00                	push   $0x0
+  800140:	6a 00                	push   $0x0
+  800142:	53                   	push   %ebx
+  800143:	e8 1a 1d 00 00       	call   801e62 <ipc_recv>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80014e:	75 db                	jne    80012b <umain+0xa1>
+  800150:	eb ba                	jmp    80010c <umain+0x82>
+
+00800152 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800152:	55                   	push   %ebp
+  800153:	89 e5                	mov    %esp,%ebp
+  800155:	57                   	push   %edi
+  800156:	56                   	push   %esi
+  800157:	53                   	push   %ebx
+  800158:	83 ec 0c             	sub    $0xc,%esp
+  80015b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80015e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	asm volatile("cpuid"
+  800161:	b8 01 00 00 00       	mov    $0x1,%eax
+  800166:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800168:	c1 ea 0b             	shr    $0xb,%edx
+  80016b:	83 f2 01             	xor    $0x1,%edx
+  80016e:	83 e2 01             	and    $0x1,%edx
+  800171:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800177:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80017e:	00 00 00 
+	envid = sys_getenvid();
+  800181:	e8 1f 0c 00 00       	call   800da5 <sys_getenvid>
+  800186:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800188:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80018d:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800193:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800199:	8b 52 48             	mov    0x48(%edx),%edx
+  80019c:	39 ca                	cmp    %ecx,%edx
+  80019e:	74 27                	je     8001c7 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8001a0:	83 c0 01             	add    $0x1,%eax
+  8001a3:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001a8:	75 e3                	jne    80018d <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8001aa:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8001b1:	75 24                	jne    8001d7 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8001b3:	83 ec 04             	sub    $0x4,%esp
+  8001b6:	68 c4 34 80 00       	push   $0x8034c4
+  8001bb:	6a 23                	push   $0x23
+  8001bd:	68 e7 34 80 00       	push   $0x8034e7
+  8001c2:	e8 4f 00 00 00       	call   800216 <_panic>
+			mainenv = &envs[i];
+  8001c7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001cd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001d2:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001d7:	85 ff                	test   %edi,%edi
+  8001d9:	7e 07                	jle    8001e2 <libmain+0x90>
+		binaryname = argv[0];
+  8001db:	8b 06                	mov    (%esi),%eax
+  8001dd:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001e2:	83 ec 08             	sub    $0x8,%esp
+  8001e5:	56                   	push   %esi
+  8001e6:	57                   	push   %edi
+  8001e7:	e8 9e fe ff ff       	call   80008a <umain>
+
+	// exit gracefully
+	exit();
+  8001ec:	e8 0b 00 00 00       	call   8001fc <exit>
+}
+  8001f1:	83 c4 10             	add    $0x10,%esp
+  8001f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f7:	5b                   	pop    %ebx
+  8001f8:	5e                   	pop    %esi
+  8001f9:	5f                   	pop    %edi
+  8001fa:	5d                   	pop    %ebp
+  8001fb:	c3                   	ret
+
+008001fc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001fc:	55                   	push   %ebp
+  8001fd:	89 e5                	mov    %esp,%ebp
+  8001ff:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800202:	e8 1c 21 00 00       	call   802323 <close_all>
+	sys_env_destroy(0);
+  800207:	83 ec 0c             	sub    $0xc,%esp
+  80020a:	6a 00                	push   $0x0
+  80020c:	e8 2b 0b 00 00       	call   800d3c <sys_env_destroy>
+}
+  800211:	83 c4 10             	add    $0x10,%esp
+  800214:	c9                   	leave
+  800215:	c3                   	ret
+
+00800216 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800216:	55                   	push   %ebp
+  800217:	89 e5                	mov    %esp,%ebp
+  800219:	56                   	push   %esi
+  80021a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80021b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80021e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800224:	e8 7c 0b 00 00       	call   800da5 <sys_getenvid>
+  800229:	83 ec 0c             	sub    $0xc,%esp
+  80022c:	ff 75 0c             	push   0xc(%ebp)
+  80022f:	ff 75 08             	push   0x8(%ebp)
+  800232:	56                   	push   %esi
+  800233:	50                   	push   %eax
+  800234:	68 00 35 80 00       	push   $0x803500
+  800239:	e8 b3 00 00 00       	call   8002f1 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80023e:	83 c4 18             	add    $0x18,%esp
+  800241:	53                   	push   %ebx
+  800242:	ff 75 10             	push   0x10(%ebp)
+  800245:	e8 56 00 00 00       	call   8002a0 <vcprintf>
+	cprintf("\n");
+  80024a:	c7 04 24 8f 3a 80 00 	movl   $0x803a8f,(%esp)
+  800251:	e8 9b 00 00 00       	call   8002f1 <cprintf>
+  800256:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800259:	cc                   	int3
+	while (1)
+  80025a:	eb fd                	jmp    800259 <_panic+0x43>
+
+0080025c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80025c:	55                   	push   %ebp
+  80025d:	89 e5                	mov    %esp,%ebp
+  80025f:	53                   	push   %ebx
+  800260:	83 ec 04             	sub    $0x4,%esp
+  800263:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800266:	8b 13                	mov    (%ebx),%edx
+  800268:	8d 42 01             	lea    0x1(%edx),%eax
+  80026b:	89 03                	mov    %eax,(%ebx)
+  80026d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800270:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800274:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800279:	74 09                	je     800284 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80027b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80027f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800282:	c9                   	leave
+  800283:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800284:	83 ec 08             	sub    $0x8,%esp
+  800287:	68 ff 00 00 00       	push   $0xff
+  80028c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80028f:	50                   	push   %eax
+  800290:	e8 1d 0a 00 00       	call   800cb2 <sys_cputs>
+		b->idx = 0;
+  800295:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80029b:	83 c4 10             	add    $0x10,%esp
+  80029e:	eb db                	jmp    80027b <putch+0x1f>
+
+008002a0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002a0:	55                   	push   %ebp
+  8002a1:	89 e5                	mov    %esp,%ebp
+  8002a3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002a9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002b0:	00 00 00 
+	b.cnt = 0;
+  8002b3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002ba:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002bd:	ff 75 0c             	push   0xc(%ebp)
+  8002c0:	ff 75 08             	push   0x8(%ebp)
+  8002c3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	68 5c 02 80 00       	push   $0x80025c
+  8002cf:	e8 fb 00 00 00       	call   8003cf <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002d4:	83 c4 08             	add    $0x8,%esp
+  8002d7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002dd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002e3:	50                   	push   %eax
+  8002e4:	e8 c9 09 00 00       	call   800cb2 <sys_cputs>
+
+	return b.cnt;
+}
+  8002e9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002ef:	c9                   	leave
+  8002f0:	c3                   	ret
+
+008002f1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002f1:	55                   	push   %ebp
+  8002f2:	89 e5                	mov    %esp,%ebp
+  8002f4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002f7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002fa:	50                   	push   %eax
+  8002fb:	ff 75 08             	push   0x8(%ebp)
+  8002fe:	e8 9d ff ff ff       	call   8002a0 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800303:	c9                   	leave
+  800304:	c3                   	ret
+
+00800305 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	57                   	push   %edi
+  800309:	56                   	push   %esi
+  80030a:	53                   	push   %ebx
+  80030b:	83 ec 1c             	sub    $0x1c,%esp
+  80030e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800311:	89 d6                	mov    %edx,%esi
+  800313:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800316:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800319:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80031c:	73 0b                	jae    800329 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80031e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800321:	c1 e7 08             	shl    $0x8,%edi
+  800324:	0b 7d 10             	or     0x10(%ebp),%edi
+  800327:	eb 36                	jmp    80035f <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800329:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80032c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800331:	f7 75 08             	divl   0x8(%ebp)
+  800334:	89 c1                	mov    %eax,%ecx
+  800336:	ff 75 14             	push   0x14(%ebp)
+  800339:	ff 75 10             	push   0x10(%ebp)
+  80033c:	83 eb 01             	sub    $0x1,%ebx
+  80033f:	53                   	push   %ebx
+  800340:	ff 75 08             	push   0x8(%ebp)
+  800343:	89 f2                	mov    %esi,%edx
+  800345:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800348:	e8 b8 ff ff ff       	call   800305 <printnum>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	eb 14                	jmp    800366 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800352:	83 ec 08             	sub    $0x8,%esp
+  800355:	56                   	push   %esi
+  800356:	57                   	push   %edi
+  800357:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80035a:	ff d0                	call   *%eax
+  80035c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80035f:	83 eb 01             	sub    $0x1,%ebx
+  800362:	85 db                	test   %ebx,%ebx
+  800364:	7f ec                	jg     800352 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800366:	83 ec 08             	sub    $0x8,%esp
+  800369:	56                   	push   %esi
+  80036a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80036d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800372:	f7 75 08             	divl   0x8(%ebp)
+  800375:	0f be 92 23 35 80 00 	movsbl 0x803523(%edx),%edx
+  80037c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037f:	c1 e0 08             	shl    $0x8,%eax
+  800382:	09 d0                	or     %edx,%eax
+  800384:	50                   	push   %eax
+  800385:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800388:	ff d0                	call   *%eax
+}
+  80038a:	83 c4 10             	add    $0x10,%esp
+  80038d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800390:	5b                   	pop    %ebx
+  800391:	5e                   	pop    %esi
+  800392:	5f                   	pop    %edi
+  800393:	5d                   	pop    %ebp
+  800394:	c3                   	ret
+
+00800395 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800395:	55                   	push   %ebp
+  800396:	89 e5                	mov    %esp,%ebp
+  800398:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80039b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80039f:	8b 10                	mov    (%eax),%edx
+  8003a1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003a4:	73 0a                	jae    8003b0 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003a6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a9:	89 08                	mov    %ecx,(%eax)
+  8003ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ae:	88 02                	mov    %al,(%edx)
+}
+  8003b0:	5d                   	pop    %ebp
+  8003b1:	c3                   	ret
+
+008003b2 <printfmt>:
+{
+  8003b2:	55                   	push   %ebp
+  8003b3:	89 e5                	mov    %esp,%ebp
+  8003b5:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b8:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003bb:	50                   	push   %eax
+  8003bc:	ff 75 10             	push   0x10(%ebp)
+  8003bf:	ff 75 0c             	push   0xc(%ebp)
+  8003c2:	ff 75 08             	push   0x8(%ebp)
+  8003c5:	e8 05 00 00 00       	call   8003cf <vprintfmt>
+}
+  8003ca:	83 c4 10             	add    $0x10,%esp
+  8003cd:	c9                   	leave
+  8003ce:	c3                   	ret
+
+008003cf <vprintfmt>:
+{
+  8003cf:	55                   	push   %ebp
+  8003d0:	89 e5                	mov    %esp,%ebp
+  8003d2:	57                   	push   %edi
+  8003d3:	56                   	push   %esi
+  8003d4:	53                   	push   %ebx
+  8003d5:	83 ec 3c             	sub    $0x3c,%esp
+  8003d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8003db:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8003de:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003e5:	eb 16                	jmp    8003fd <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	ff 75 0c             	push   0xc(%ebp)
+  8003ed:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003f0:	c1 e2 08             	shl    $0x8,%edx
+  8003f3:	09 d0                	or     %edx,%eax
+  8003f5:	50                   	push   %eax
+  8003f6:	ff d7                	call   *%edi
+  8003f8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003fb:	89 de                	mov    %ebx,%esi
+  8003fd:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800400:	0f b6 06             	movzbl (%esi),%eax
+  800403:	83 f8 25             	cmp    $0x25,%eax
+  800406:	74 0c                	je     800414 <vprintfmt+0x45>
+			if (ch == '\0')
+  800408:	85 c0                	test   %eax,%eax
+  80040a:	75 db                	jne    8003e7 <vprintfmt+0x18>
+}
+  80040c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040f:	5b                   	pop    %ebx
+  800410:	5e                   	pop    %esi
+  800411:	5f                   	pop    %edi
+  800412:	5d                   	pop    %ebp
+  800413:	c3                   	ret
+		padc = ' ';
+  800414:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800418:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80041f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800426:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80042d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800432:	8d 73 01             	lea    0x1(%ebx),%esi
+  800435:	0f b6 13             	movzbl (%ebx),%edx
+  800438:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80043b:	3c 55                	cmp    $0x55,%al
+  80043d:	0f 87 2c 04 00 00    	ja     80086f <vprintfmt+0x4a0>
+  800443:	0f b6 c0             	movzbl %al,%eax
+  800446:	ff 24 85 60 36 80 00 	jmp    *0x803660(,%eax,4)
+  80044d:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80044f:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800453:	eb dd                	jmp    800432 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800455:	89 f3                	mov    %esi,%ebx
+  800457:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80045b:	eb d5                	jmp    800432 <vprintfmt+0x63>
+  80045d:	0f b6 d2             	movzbl %dl,%edx
+  800460:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800462:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800467:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80046a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80046e:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800471:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800474:	83 fe 09             	cmp    $0x9,%esi
+  800477:	0f 87 8a 00 00 00    	ja     800507 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80047d:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800480:	eb e5                	jmp    800467 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800482:	8b 45 14             	mov    0x14(%ebp),%eax
+  800485:	8b 00                	mov    (%eax),%eax
+  800487:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80048a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048d:	8d 40 04             	lea    0x4(%eax),%eax
+  800490:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800493:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800495:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800499:	79 97                	jns    800432 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80049b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80049e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004a8:	eb 88                	jmp    800432 <vprintfmt+0x63>
+			if (width < 0)
+  8004aa:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8004ad:	85 db                	test   %ebx,%ebx
+  8004af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b4:	0f 49 c3             	cmovns %ebx,%eax
+  8004b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ba:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004bc:	e9 71 ff ff ff       	jmp    800432 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c1:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8004c3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004ca:	e9 63 ff ff ff       	jmp    800432 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8004cf:	8d 73 02             	lea    0x2(%ebx),%esi
+  8004d2:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8004d6:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8004dd:	3c 67                	cmp    $0x67,%al
+  8004df:	0f 84 18 ff ff ff    	je     8003fd <vprintfmt+0x2e>
+					attrib = 0x04;
+  8004e5:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8004ec:	3c 72                	cmp    $0x72,%al
+  8004ee:	0f 84 09 ff ff ff    	je     8003fd <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004f4:	3c 62                	cmp    $0x62,%al
+  8004f6:	0f 94 c0             	sete   %al
+  8004f9:	0f b6 c0             	movzbl %al,%eax
+  8004fc:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800502:	e9 f6 fe ff ff       	jmp    8003fd <vprintfmt+0x2e>
+  800507:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80050a:	eb 89                	jmp    800495 <vprintfmt+0xc6>
+			lflag++;
+  80050c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80050f:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800511:	e9 1c ff ff ff       	jmp    800432 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800516:	8b 45 14             	mov    0x14(%ebp),%eax
+  800519:	8d 58 04             	lea    0x4(%eax),%ebx
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	ff 75 0c             	push   0xc(%ebp)
+  800522:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800525:	c1 e0 08             	shl    $0x8,%eax
+  800528:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80052b:	0b 01                	or     (%ecx),%eax
+  80052d:	50                   	push   %eax
+  80052e:	ff d7                	call   *%edi
+			break;
+  800530:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800533:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800536:	e9 c2 fe ff ff       	jmp    8003fd <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80053b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053e:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800541:	8b 10                	mov    (%eax),%edx
+  800543:	89 d0                	mov    %edx,%eax
+  800545:	f7 d8                	neg    %eax
+  800547:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80054a:	83 f8 12             	cmp    $0x12,%eax
+  80054d:	7f 25                	jg     800574 <vprintfmt+0x1a5>
+  80054f:	8b 14 85 c0 37 80 00 	mov    0x8037c0(,%eax,4),%edx
+  800556:	85 d2                	test   %edx,%edx
+  800558:	74 1a                	je     800574 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80055a:	52                   	push   %edx
+  80055b:	68 02 39 80 00       	push   $0x803902
+  800560:	ff 75 0c             	push   0xc(%ebp)
+  800563:	57                   	push   %edi
+  800564:	e8 49 fe ff ff       	call   8003b2 <printfmt>
+  800569:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80056c:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80056f:	e9 89 fe ff ff       	jmp    8003fd <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800574:	50                   	push   %eax
+  800575:	68 3b 35 80 00       	push   $0x80353b
+  80057a:	ff 75 0c             	push   0xc(%ebp)
+  80057d:	57                   	push   %edi
+  80057e:	e8 2f fe ff ff       	call   8003b2 <printfmt>
+  800583:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800586:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800589:	e9 6f fe ff ff       	jmp    8003fd <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	83 c0 04             	add    $0x4,%eax
+  800594:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80059c:	85 c9                	test   %ecx,%ecx
+  80059e:	b8 34 35 80 00       	mov    $0x803534,%eax
+  8005a3:	0f 45 c1             	cmovne %ecx,%eax
+  8005a6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8005a9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ad:	7e 06                	jle    8005b5 <vprintfmt+0x1e6>
+  8005af:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8005b3:	75 1a                	jne    8005cf <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8005b5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005b8:	c1 e0 08             	shl    $0x8,%eax
+  8005bb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8005be:	83 c8 3f             	or     $0x3f,%eax
+  8005c1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005c4:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8005c7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005ca:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8005cd:	eb 6d                	jmp    80063c <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cf:	83 ec 08             	sub    $0x8,%esp
+  8005d2:	ff 75 d0             	push   -0x30(%ebp)
+  8005d5:	ff 75 c8             	push   -0x38(%ebp)
+  8005d8:	e8 39 03 00 00       	call   800916 <strnlen>
+  8005dd:	89 c2                	mov    %eax,%edx
+  8005df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e2:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8005e4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005e7:	c1 e1 08             	shl    $0x8,%ecx
+  8005ea:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8005ee:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f0:	83 c4 10             	add    $0x10,%esp
+  8005f3:	89 c3                	mov    %eax,%ebx
+  8005f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f8:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005fb:	89 ce                	mov    %ecx,%esi
+  8005fd:	eb 0f                	jmp    80060e <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005ff:	83 ec 08             	sub    $0x8,%esp
+  800602:	ff 75 0c             	push   0xc(%ebp)
+  800605:	56                   	push   %esi
+  800606:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800608:	83 eb 01             	sub    $0x1,%ebx
+  80060b:	83 c4 10             	add    $0x10,%esp
+  80060e:	85 db                	test   %ebx,%ebx
+  800610:	7f ed                	jg     8005ff <vprintfmt+0x230>
+  800612:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800615:	8b 75 10             	mov    0x10(%ebp),%esi
+  800618:	85 c0                	test   %eax,%eax
+  80061a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061f:	0f 49 d0             	cmovns %eax,%edx
+  800622:	29 d0                	sub    %edx,%eax
+  800624:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800627:	eb 8c                	jmp    8005b5 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800629:	83 ec 08             	sub    $0x8,%esp
+  80062c:	ff 75 0c             	push   0xc(%ebp)
+  80062f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800632:	09 c2                	or     %eax,%edx
+  800634:	52                   	push   %edx
+  800635:	ff d7                	call   *%edi
+  800637:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80063a:	89 d9                	mov    %ebx,%ecx
+  80063c:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80063f:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800643:	0f be d0             	movsbl %al,%edx
+  800646:	85 d2                	test   %edx,%edx
+  800648:	74 2a                	je     800674 <vprintfmt+0x2a5>
+  80064a:	85 f6                	test   %esi,%esi
+  80064c:	78 05                	js     800653 <vprintfmt+0x284>
+  80064e:	83 ee 01             	sub    $0x1,%esi
+  800651:	78 3b                	js     80068e <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800653:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800657:	74 d0                	je     800629 <vprintfmt+0x25a>
+  800659:	0f be c0             	movsbl %al,%eax
+  80065c:	83 e8 20             	sub    $0x20,%eax
+  80065f:	83 f8 5e             	cmp    $0x5e,%eax
+  800662:	76 c5                	jbe    800629 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800664:	83 ec 08             	sub    $0x8,%esp
+  800667:	ff 75 0c             	push   0xc(%ebp)
+  80066a:	ff 75 cc             	push   -0x34(%ebp)
+  80066d:	ff d7                	call   *%edi
+  80066f:	83 c4 10             	add    $0x10,%esp
+  800672:	eb c6                	jmp    80063a <vprintfmt+0x26b>
+  800674:	8b 75 10             	mov    0x10(%ebp),%esi
+  800677:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80067a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80067d:	01 c3                	add    %eax,%ebx
+  80067f:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800681:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800684:	83 c8 20             	or     $0x20,%eax
+  800687:	89 75 10             	mov    %esi,0x10(%ebp)
+  80068a:	89 c6                	mov    %eax,%esi
+  80068c:	eb 14                	jmp    8006a2 <vprintfmt+0x2d3>
+  80068e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800691:	eb e4                	jmp    800677 <vprintfmt+0x2a8>
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	ff 75 0c             	push   0xc(%ebp)
+  800699:	56                   	push   %esi
+  80069a:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80069c:	83 eb 01             	sub    $0x1,%ebx
+  80069f:	83 c4 10             	add    $0x10,%esp
+  8006a2:	85 db                	test   %ebx,%ebx
+  8006a4:	7f ed                	jg     800693 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006a6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006a9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8006ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006af:	e9 49 fd ff ff       	jmp    8003fd <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006b4:	83 f9 01             	cmp    $0x1,%ecx
+  8006b7:	7f 1f                	jg     8006d8 <vprintfmt+0x309>
+	else if (lflag)
+  8006b9:	85 c9                	test   %ecx,%ecx
+  8006bb:	74 69                	je     800726 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8b 00                	mov    (%eax),%eax
+  8006c2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c5:	89 c1                	mov    %eax,%ecx
+  8006c7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d6:	eb 17                	jmp    8006ef <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 50 04             	mov    0x4(%eax),%edx
+  8006de:	8b 00                	mov    (%eax),%eax
+  8006e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ef:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006f2:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006fa:	85 db                	test   %ebx,%ebx
+  8006fc:	0f 89 f6 00 00 00    	jns    8007f8 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800702:	83 ec 08             	sub    $0x8,%esp
+  800705:	ff 75 0c             	push   0xc(%ebp)
+  800708:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80070b:	c1 e0 08             	shl    $0x8,%eax
+  80070e:	83 c8 2d             	or     $0x2d,%eax
+  800711:	50                   	push   %eax
+  800712:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800714:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800717:	f7 d9                	neg    %ecx
+  800719:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80071c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800721:	e9 d2 00 00 00       	jmp    8007f8 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 00                	mov    (%eax),%eax
+  80072b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80072e:	89 c1                	mov    %eax,%ecx
+  800730:	c1 f9 1f             	sar    $0x1f,%ecx
+  800733:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800736:	8b 45 14             	mov    0x14(%ebp),%eax
+  800739:	8d 40 04             	lea    0x4(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073f:	eb ae                	jmp    8006ef <vprintfmt+0x320>
+	if (lflag >= 2)
+  800741:	83 f9 01             	cmp    $0x1,%ecx
+  800744:	7f 19                	jg     80075f <vprintfmt+0x390>
+	else if (lflag)
+  800746:	85 c9                	test   %ecx,%ecx
+  800748:	74 2a                	je     800774 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8b 08                	mov    (%eax),%ecx
+  80074f:	8d 40 04             	lea    0x4(%eax),%eax
+  800752:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800755:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80075a:	e9 99 00 00 00       	jmp    8007f8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8b 08                	mov    (%eax),%ecx
+  800764:	8d 40 08             	lea    0x8(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80076a:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80076f:	e9 84 00 00 00       	jmp    8007f8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800774:	8b 45 14             	mov    0x14(%ebp),%eax
+  800777:	8b 08                	mov    (%eax),%ecx
+  800779:	8d 40 04             	lea    0x4(%eax),%eax
+  80077c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80077f:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800784:	eb 72                	jmp    8007f8 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800786:	83 f9 01             	cmp    $0x1,%ecx
+  800789:	7f 16                	jg     8007a1 <vprintfmt+0x3d2>
+	else if (lflag)
+  80078b:	85 c9                	test   %ecx,%ecx
+  80078d:	74 24                	je     8007b3 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 08                	mov    (%eax),%ecx
+  800794:	8d 40 04             	lea    0x4(%eax),%eax
+  800797:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80079a:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80079f:	eb 57                	jmp    8007f8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 08                	mov    (%eax),%ecx
+  8007a6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ac:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8007b1:	eb 45                	jmp    8007f8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 08                	mov    (%eax),%ecx
+  8007b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007be:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8007c3:	eb 33                	jmp    8007f8 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8007c5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007c8:	c1 e3 08             	shl    $0x8,%ebx
+  8007cb:	83 ec 08             	sub    $0x8,%esp
+  8007ce:	ff 75 0c             	push   0xc(%ebp)
+  8007d1:	89 d8                	mov    %ebx,%eax
+  8007d3:	83 c8 30             	or     $0x30,%eax
+  8007d6:	50                   	push   %eax
+  8007d7:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8007d9:	83 c4 08             	add    $0x8,%esp
+  8007dc:	ff 75 0c             	push   0xc(%ebp)
+  8007df:	83 cb 78             	or     $0x78,%ebx
+  8007e2:	53                   	push   %ebx
+  8007e3:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e8:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8007ea:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f3:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8007fb:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007ff:	52                   	push   %edx
+  800800:	ff 75 e0             	push   -0x20(%ebp)
+  800803:	50                   	push   %eax
+  800804:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800807:	89 f8                	mov    %edi,%eax
+  800809:	e8 f7 fa ff ff       	call   800305 <printnum>
+			break;
+  80080e:	83 c4 10             	add    $0x10,%esp
+  800811:	e9 e7 fb ff ff       	jmp    8003fd <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800816:	83 f9 01             	cmp    $0x1,%ecx
+  800819:	7f 16                	jg     800831 <vprintfmt+0x462>
+	else if (lflag)
+  80081b:	85 c9                	test   %ecx,%ecx
+  80081d:	74 24                	je     800843 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80081f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800822:	8b 08                	mov    (%eax),%ecx
+  800824:	8d 40 04             	lea    0x4(%eax),%eax
+  800827:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082a:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80082f:	eb c7                	jmp    8007f8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800831:	8b 45 14             	mov    0x14(%ebp),%eax
+  800834:	8b 08                	mov    (%eax),%ecx
+  800836:	8d 40 08             	lea    0x8(%eax),%eax
+  800839:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80083c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800841:	eb b5                	jmp    8007f8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800843:	8b 45 14             	mov    0x14(%ebp),%eax
+  800846:	8b 08                	mov    (%eax),%ecx
+  800848:	8d 40 04             	lea    0x4(%eax),%eax
+  80084b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80084e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800853:	eb a3                	jmp    8007f8 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800855:	83 ec 08             	sub    $0x8,%esp
+  800858:	ff 75 0c             	push   0xc(%ebp)
+  80085b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80085e:	c1 e0 08             	shl    $0x8,%eax
+  800861:	83 c8 25             	or     $0x25,%eax
+  800864:	50                   	push   %eax
+  800865:	ff d7                	call   *%edi
+			break;
+  800867:	83 c4 10             	add    $0x10,%esp
+  80086a:	e9 8e fb ff ff       	jmp    8003fd <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80086f:	83 ec 08             	sub    $0x8,%esp
+  800872:	ff 75 0c             	push   0xc(%ebp)
+  800875:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800878:	c1 e0 08             	shl    $0x8,%eax
+  80087b:	83 c8 25             	or     $0x25,%eax
+  80087e:	50                   	push   %eax
+  80087f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800881:	83 c4 10             	add    $0x10,%esp
+  800884:	89 de                	mov    %ebx,%esi
+  800886:	eb 03                	jmp    80088b <vprintfmt+0x4bc>
+  800888:	83 ee 01             	sub    $0x1,%esi
+  80088b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80088f:	75 f7                	jne    800888 <vprintfmt+0x4b9>
+  800891:	e9 67 fb ff ff       	jmp    8003fd <vprintfmt+0x2e>
+
+00800896 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800896:	55                   	push   %ebp
+  800897:	89 e5                	mov    %esp,%ebp
+  800899:	83 ec 18             	sub    $0x18,%esp
+  80089c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008a5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008a9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008b3:	85 c0                	test   %eax,%eax
+  8008b5:	74 26                	je     8008dd <vsnprintf+0x47>
+  8008b7:	85 d2                	test   %edx,%edx
+  8008b9:	7e 22                	jle    8008dd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008bb:	ff 75 14             	push   0x14(%ebp)
+  8008be:	ff 75 10             	push   0x10(%ebp)
+  8008c1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008c4:	50                   	push   %eax
+  8008c5:	68 95 03 80 00       	push   $0x800395
+  8008ca:	e8 00 fb ff ff       	call   8003cf <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008d2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d8:	83 c4 10             	add    $0x10,%esp
+}
+  8008db:	c9                   	leave
+  8008dc:	c3                   	ret
+		return -E_INVAL;
+  8008dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008e2:	eb f7                	jmp    8008db <vsnprintf+0x45>
+
+008008e4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8008ea:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008ed:	50                   	push   %eax
+  8008ee:	ff 75 10             	push   0x10(%ebp)
+  8008f1:	ff 75 0c             	push   0xc(%ebp)
+  8008f4:	ff 75 08             	push   0x8(%ebp)
+  8008f7:	e8 9a ff ff ff       	call   800896 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008fc:	c9                   	leave
+  8008fd:	c3                   	ret
+
+008008fe <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008fe:	55                   	push   %ebp
+  8008ff:	89 e5                	mov    %esp,%ebp
+  800901:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800904:	b8 00 00 00 00       	mov    $0x0,%eax
+  800909:	eb 03                	jmp    80090e <strlen+0x10>
+		n++;
+  80090b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80090e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800912:	75 f7                	jne    80090b <strlen+0xd>
+	return n;
+}
+  800914:	5d                   	pop    %ebp
+  800915:	c3                   	ret
+
+00800916 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800916:	55                   	push   %ebp
+  800917:	89 e5                	mov    %esp,%ebp
+  800919:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80091c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80091f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800924:	eb 03                	jmp    800929 <strnlen+0x13>
+		n++;
+  800926:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800929:	39 d0                	cmp    %edx,%eax
+  80092b:	74 08                	je     800935 <strnlen+0x1f>
+  80092d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800931:	75 f3                	jne    800926 <strnlen+0x10>
+  800933:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800935:	89 d0                	mov    %edx,%eax
+  800937:	5d                   	pop    %ebp
+  800938:	c3                   	ret
+
+00800939 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	53                   	push   %ebx
+  80093d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800940:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800943:	b8 00 00 00 00       	mov    $0x0,%eax
+  800948:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80094c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80094f:	83 c0 01             	add    $0x1,%eax
+  800952:	84 d2                	test   %dl,%dl
+  800954:	75 f2                	jne    800948 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800956:	89 c8                	mov    %ecx,%eax
+  800958:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095b:	c9                   	leave
+  80095c:	c3                   	ret
+
+0080095d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80095d:	55                   	push   %ebp
+  80095e:	89 e5                	mov    %esp,%ebp
+  800960:	53                   	push   %ebx
+  800961:	83 ec 10             	sub    $0x10,%esp
+  800964:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800967:	53                   	push   %ebx
+  800968:	e8 91 ff ff ff       	call   8008fe <strlen>
+  80096d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800970:	ff 75 0c             	push   0xc(%ebp)
+  800973:	01 d8                	add    %ebx,%eax
+  800975:	50                   	push   %eax
+  800976:	e8 be ff ff ff       	call   800939 <strcpy>
+	return dst;
+}
+  80097b:	89 d8                	mov    %ebx,%eax
+  80097d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800980:	c9                   	leave
+  800981:	c3                   	ret
+
+00800982 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	56                   	push   %esi
+  800986:	53                   	push   %ebx
+  800987:	8b 75 08             	mov    0x8(%ebp),%esi
+  80098a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80098d:	89 f3                	mov    %esi,%ebx
+  80098f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800992:	89 f0                	mov    %esi,%eax
+  800994:	eb 0f                	jmp    8009a5 <strncpy+0x23>
+		*dst++ = *src;
+  800996:	83 c0 01             	add    $0x1,%eax
+  800999:	0f b6 0a             	movzbl (%edx),%ecx
+  80099c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80099f:	80 f9 01             	cmp    $0x1,%cl
+  8009a2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009a5:	39 d8                	cmp    %ebx,%eax
+  8009a7:	75 ed                	jne    800996 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009a9:	89 f0                	mov    %esi,%eax
+  8009ab:	5b                   	pop    %ebx
+  8009ac:	5e                   	pop    %esi
+  8009ad:	5d                   	pop    %ebp
+  8009ae:	c3                   	ret
+
+008009af <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	56                   	push   %esi
+  8009b3:	53                   	push   %ebx
+  8009b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ba:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009bd:	89 f0                	mov    %esi,%eax
+  8009bf:	85 d2                	test   %edx,%edx
+  8009c1:	74 21                	je     8009e4 <strlcpy+0x35>
+  8009c3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009c7:	89 f2                	mov    %esi,%edx
+  8009c9:	eb 09                	jmp    8009d4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009cb:	83 c1 01             	add    $0x1,%ecx
+  8009ce:	83 c2 01             	add    $0x1,%edx
+  8009d1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009d4:	39 c2                	cmp    %eax,%edx
+  8009d6:	74 09                	je     8009e1 <strlcpy+0x32>
+  8009d8:	0f b6 19             	movzbl (%ecx),%ebx
+  8009db:	84 db                	test   %bl,%bl
+  8009dd:	75 ec                	jne    8009cb <strlcpy+0x1c>
+  8009df:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009e1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009e4:	29 f0                	sub    %esi,%eax
+}
+  8009e6:	5b                   	pop    %ebx
+  8009e7:	5e                   	pop    %esi
+  8009e8:	5d                   	pop    %ebp
+  8009e9:	c3                   	ret
+
+008009ea <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009ea:	55                   	push   %ebp
+  8009eb:	89 e5                	mov    %esp,%ebp
+  8009ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009f3:	eb 06                	jmp    8009fb <strcmp+0x11>
+		p++, q++;
+  8009f5:	83 c1 01             	add    $0x1,%ecx
+  8009f8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009fb:	0f b6 01             	movzbl (%ecx),%eax
+  8009fe:	84 c0                	test   %al,%al
+  800a00:	74 04                	je     800a06 <strcmp+0x1c>
+  800a02:	3a 02                	cmp    (%edx),%al
+  800a04:	74 ef                	je     8009f5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a06:	0f b6 c0             	movzbl %al,%eax
+  800a09:	0f b6 12             	movzbl (%edx),%edx
+  800a0c:	29 d0                	sub    %edx,%eax
+}
+  800a0e:	5d                   	pop    %ebp
+  800a0f:	c3                   	ret
+
+00800a10 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a10:	55                   	push   %ebp
+  800a11:	89 e5                	mov    %esp,%ebp
+  800a13:	53                   	push   %ebx
+  800a14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a1a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a1d:	eb 09                	jmp    800a28 <strncmp+0x18>
+		n--, p++, q++;
+  800a1f:	83 ea 01             	sub    $0x1,%edx
+  800a22:	83 c0 01             	add    $0x1,%eax
+  800a25:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a28:	85 d2                	test   %edx,%edx
+  800a2a:	74 18                	je     800a44 <strncmp+0x34>
+  800a2c:	0f b6 18             	movzbl (%eax),%ebx
+  800a2f:	84 db                	test   %bl,%bl
+  800a31:	74 04                	je     800a37 <strncmp+0x27>
+  800a33:	3a 19                	cmp    (%ecx),%bl
+  800a35:	74 e8                	je     800a1f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a37:	0f b6 00             	movzbl (%eax),%eax
+  800a3a:	0f b6 11             	movzbl (%ecx),%edx
+  800a3d:	29 d0                	sub    %edx,%eax
+}
+  800a3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a42:	c9                   	leave
+  800a43:	c3                   	ret
+		return 0;
+  800a44:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a49:	eb f4                	jmp    800a3f <strncmp+0x2f>
+
+00800a4b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a51:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a55:	eb 03                	jmp    800a5a <strchr+0xf>
+  800a57:	83 c0 01             	add    $0x1,%eax
+  800a5a:	0f b6 10             	movzbl (%eax),%edx
+  800a5d:	84 d2                	test   %dl,%dl
+  800a5f:	74 06                	je     800a67 <strchr+0x1c>
+		if (*s == c)
+  800a61:	38 ca                	cmp    %cl,%dl
+  800a63:	75 f2                	jne    800a57 <strchr+0xc>
+  800a65:	eb 05                	jmp    800a6c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a6c:	5d                   	pop    %ebp
+  800a6d:	c3                   	ret
+
+00800a6e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a6e:	55                   	push   %ebp
+  800a6f:	89 e5                	mov    %esp,%ebp
+  800a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a74:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a78:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a7b:	38 ca                	cmp    %cl,%dl
+  800a7d:	74 09                	je     800a88 <strfind+0x1a>
+  800a7f:	84 d2                	test   %dl,%dl
+  800a81:	74 05                	je     800a88 <strfind+0x1a>
+	for (; *s; s++)
+  800a83:	83 c0 01             	add    $0x1,%eax
+  800a86:	eb f0                	jmp    800a78 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a88:	5d                   	pop    %ebp
+  800a89:	c3                   	ret
+
+00800a8a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a8a:	55                   	push   %ebp
+  800a8b:	89 e5                	mov    %esp,%ebp
+  800a8d:	57                   	push   %edi
+  800a8e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a94:	85 c9                	test   %ecx,%ecx
+  800a96:	74 20                	je     800ab8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a98:	89 f8                	mov    %edi,%eax
+  800a9a:	09 c8                	or     %ecx,%eax
+  800a9c:	a8 03                	test   $0x3,%al
+  800a9e:	75 12                	jne    800ab2 <memset+0x28>
+		c &= 0xFF;
+  800aa0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800aa4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800aaa:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800aad:	fc                   	cld
+  800aae:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ab0:	eb 06                	jmp    800ab8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ab2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab5:	fc                   	cld
+  800ab6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ab8:	89 f8                	mov    %edi,%eax
+  800aba:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800abd:	c9                   	leave
+  800abe:	c3                   	ret
+
+00800abf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	57                   	push   %edi
+  800ac3:	56                   	push   %esi
+  800ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800acd:	39 c6                	cmp    %eax,%esi
+  800acf:	73 32                	jae    800b03 <memmove+0x44>
+  800ad1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ad4:	39 d0                	cmp    %edx,%eax
+  800ad6:	73 2b                	jae    800b03 <memmove+0x44>
+		s += n;
+		d += n;
+  800ad8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800adb:	89 d6                	mov    %edx,%esi
+  800add:	09 fe                	or     %edi,%esi
+  800adf:	09 ce                	or     %ecx,%esi
+  800ae1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ae7:	75 0e                	jne    800af7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ae9:	83 ef 04             	sub    $0x4,%edi
+  800aec:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aef:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800af2:	fd                   	std
+  800af3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af5:	eb 09                	jmp    800b00 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800af7:	83 ef 01             	sub    $0x1,%edi
+  800afa:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800afd:	fd                   	std
+  800afe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b00:	fc                   	cld
+  800b01:	eb 1a                	jmp    800b1d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b03:	89 f2                	mov    %esi,%edx
+  800b05:	09 c2                	or     %eax,%edx
+  800b07:	09 ca                	or     %ecx,%edx
+  800b09:	f6 c2 03             	test   $0x3,%dl
+  800b0c:	75 0a                	jne    800b18 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b0e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b11:	89 c7                	mov    %eax,%edi
+  800b13:	fc                   	cld
+  800b14:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b16:	eb 05                	jmp    800b1d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b18:	89 c7                	mov    %eax,%edi
+  800b1a:	fc                   	cld
+  800b1b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b1d:	5e                   	pop    %esi
+  800b1e:	5f                   	pop    %edi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b27:	ff 75 10             	push   0x10(%ebp)
+  800b2a:	ff 75 0c             	push   0xc(%ebp)
+  800b2d:	ff 75 08             	push   0x8(%ebp)
+  800b30:	e8 8a ff ff ff       	call   800abf <memmove>
+}
+  800b35:	c9                   	leave
+  800b36:	c3                   	ret
+
+00800b37 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	56                   	push   %esi
+  800b3b:	53                   	push   %ebx
+  800b3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b42:	89 c6                	mov    %eax,%esi
+  800b44:	03 75 10             	add    0x10(%ebp),%esi
+  800b47:	eb 06                	jmp    800b4f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b49:	83 c0 01             	add    $0x1,%eax
+  800b4c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b4f:	39 f0                	cmp    %esi,%eax
+  800b51:	74 14                	je     800b67 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b53:	0f b6 08             	movzbl (%eax),%ecx
+  800b56:	0f b6 1a             	movzbl (%edx),%ebx
+  800b59:	38 d9                	cmp    %bl,%cl
+  800b5b:	74 ec                	je     800b49 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b5d:	0f b6 c1             	movzbl %cl,%eax
+  800b60:	0f b6 db             	movzbl %bl,%ebx
+  800b63:	29 d8                	sub    %ebx,%eax
+  800b65:	eb 05                	jmp    800b6c <memcmp+0x35>
+	}
+
+	return 0;
+  800b67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b6c:	5b                   	pop    %ebx
+  800b6d:	5e                   	pop    %esi
+  800b6e:	5d                   	pop    %ebp
+  800b6f:	c3                   	ret
+
+00800b70 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b70:	55                   	push   %ebp
+  800b71:	89 e5                	mov    %esp,%ebp
+  800b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b79:	89 c2                	mov    %eax,%edx
+  800b7b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b7e:	eb 03                	jmp    800b83 <memfind+0x13>
+  800b80:	83 c0 01             	add    $0x1,%eax
+  800b83:	39 d0                	cmp    %edx,%eax
+  800b85:	73 04                	jae    800b8b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b87:	38 08                	cmp    %cl,(%eax)
+  800b89:	75 f5                	jne    800b80 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b8b:	5d                   	pop    %ebp
+  800b8c:	c3                   	ret
+
+00800b8d <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b8d:	55                   	push   %ebp
+  800b8e:	89 e5                	mov    %esp,%ebp
+  800b90:	57                   	push   %edi
+  800b91:	56                   	push   %esi
+  800b92:	53                   	push   %ebx
+  800b93:	83 ec 1c             	sub    $0x1c,%esp
+  800b96:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b99:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b9c:	eb 03                	jmp    800ba1 <strtol+0x14>
+		s++;
+  800b9e:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800ba1:	0f b6 06             	movzbl (%esi),%eax
+  800ba4:	3c 20                	cmp    $0x20,%al
+  800ba6:	74 f6                	je     800b9e <strtol+0x11>
+  800ba8:	3c 09                	cmp    $0x9,%al
+  800baa:	74 f2                	je     800b9e <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bac:	3c 2b                	cmp    $0x2b,%al
+  800bae:	74 43                	je     800bf3 <strtol+0x66>
+	int neg = 0;
+  800bb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800bb5:	3c 2d                	cmp    $0x2d,%al
+  800bb7:	74 44                	je     800bfd <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb9:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800bbf:	75 0f                	jne    800bd0 <strtol+0x43>
+  800bc1:	80 3e 30             	cmpb   $0x30,(%esi)
+  800bc4:	74 41                	je     800c07 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bc6:	85 ff                	test   %edi,%edi
+  800bc8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bcd:	0f 44 f8             	cmove  %eax,%edi
+  800bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd5:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800bda:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800bdd:	89 fb                	mov    %edi,%ebx
+  800bdf:	c1 fb 1f             	sar    $0x1f,%ebx
+  800be2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800be5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800be8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800beb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800bee:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bf1:	eb 67                	jmp    800c5a <strtol+0xcd>
+		s++;
+  800bf3:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800bf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bfb:	eb bc                	jmp    800bb9 <strtol+0x2c>
+		s++, neg = 1;
+  800bfd:	83 c6 01             	add    $0x1,%esi
+  800c00:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c05:	eb b2                	jmp    800bb9 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c07:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c0b:	74 0e                	je     800c1b <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c0d:	85 ff                	test   %edi,%edi
+  800c0f:	75 bf                	jne    800bd0 <strtol+0x43>
+		s++, base = 8;
+  800c11:	83 c6 01             	add    $0x1,%esi
+  800c14:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c19:	eb b5                	jmp    800bd0 <strtol+0x43>
+		s += 2, base = 16;
+  800c1b:	83 c6 02             	add    $0x2,%esi
+  800c1e:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c23:	eb ab                	jmp    800bd0 <strtol+0x43>
+			dig = *s - '0';
+  800c25:	0f be c9             	movsbl %cl,%ecx
+  800c28:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c2b:	39 f9                	cmp    %edi,%ecx
+  800c2d:	7d 59                	jge    800c88 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c2f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c33:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c36:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c39:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c3c:	0f af d8             	imul   %eax,%ebx
+  800c3f:	0f af d7             	imul   %edi,%edx
+  800c42:	01 d3                	add    %edx,%ebx
+  800c44:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c47:	f7 e7                	mul    %edi
+  800c49:	01 da                	add    %ebx,%edx
+  800c4b:	89 cb                	mov    %ecx,%ebx
+  800c4d:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c50:	01 c8                	add    %ecx,%eax
+  800c52:	11 da                	adc    %ebx,%edx
+  800c54:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c57:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5d:	0f b6 08             	movzbl (%eax),%ecx
+  800c60:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c63:	80 fb 09             	cmp    $0x9,%bl
+  800c66:	76 bd                	jbe    800c25 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c68:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c6b:	80 fb 19             	cmp    $0x19,%bl
+  800c6e:	77 08                	ja     800c78 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c70:	0f be c9             	movsbl %cl,%ecx
+  800c73:	83 e9 57             	sub    $0x57,%ecx
+  800c76:	eb b3                	jmp    800c2b <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c78:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c7b:	80 fb 19             	cmp    $0x19,%bl
+  800c7e:	77 08                	ja     800c88 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c80:	0f be c9             	movsbl %cl,%ecx
+  800c83:	83 e9 37             	sub    $0x37,%ecx
+  800c86:	eb a3                	jmp    800c2b <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c88:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c8b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c8e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c91:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c94:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c98:	74 05                	je     800c9f <strtol+0x112>
+		*endptr = (char *) s;
+  800c9a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c9d:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c9f:	85 c9                	test   %ecx,%ecx
+  800ca1:	74 07                	je     800caa <strtol+0x11d>
+  800ca3:	f7 d8                	neg    %eax
+  800ca5:	83 d2 00             	adc    $0x0,%edx
+  800ca8:	f7 da                	neg    %edx
+}
+  800caa:	83 c4 1c             	add    $0x1c,%esp
+  800cad:	5b                   	pop    %ebx
+  800cae:	5e                   	pop    %esi
+  800caf:	5f                   	pop    %edi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	c3                   	ret
+
+00800cb2 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	57                   	push   %edi
+  800cb6:	56                   	push   %esi
+  800cb7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cb8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cbf:	74 18                	je     800cd9 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccc:	89 c3                	mov    %eax,%ebx
+  800cce:	89 c7                	mov    %eax,%edi
+  800cd0:	89 c6                	mov    %eax,%esi
+  800cd2:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cd4:	5b                   	pop    %ebx
+  800cd5:	5e                   	pop    %esi
+  800cd6:	5f                   	pop    %edi
+  800cd7:	5d                   	pop    %ebp
+  800cd8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce4:	89 c3                	mov    %eax,%ebx
+  800ce6:	89 c7                	mov    %eax,%edi
+  800ce8:	55                   	push   %ebp
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	8d 35 f3 0c 80 00    	lea    0x800cf3,%esi
+  800cf1:	0f 34                	sysenter
+  800cf3:	5d                   	pop    %ebp
+		goto out;
+  800cf4:	eb de                	jmp    800cd4 <sys_cputs+0x22>
+
+00800cf6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	57                   	push   %edi
+  800cfa:	56                   	push   %esi
+  800cfb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cfc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d03:	74 19                	je     800d1e <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d0f:	89 d1                	mov    %edx,%ecx
+  800d11:	89 d3                	mov    %edx,%ebx
+  800d13:	89 d7                	mov    %edx,%edi
+  800d15:	89 d6                	mov    %edx,%esi
+  800d17:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5f                   	pop    %edi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d23:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d28:	89 d1                	mov    %edx,%ecx
+  800d2a:	89 d3                	mov    %edx,%ebx
+  800d2c:	89 d7                	mov    %edx,%edi
+  800d2e:	55                   	push   %ebp
+  800d2f:	89 e5                	mov    %esp,%ebp
+  800d31:	8d 35 39 0d 80 00    	lea    0x800d39,%esi
+  800d37:	0f 34                	sysenter
+  800d39:	5d                   	pop    %ebp
+		goto out;
+  800d3a:	eb dd                	jmp    800d19 <sys_cgetc+0x23>
+
+00800d3c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d45:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d4c:	74 21                	je     800d6f <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d53:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5b:	89 cb                	mov    %ecx,%ebx
+  800d5d:	89 cf                	mov    %ecx,%edi
+  800d5f:	89 ce                	mov    %ecx,%esi
+  800d61:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	7f 27                	jg     800d8e <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d77:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d7c:	89 cb                	mov    %ecx,%ebx
+  800d7e:	89 cf                	mov    %ecx,%edi
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	8d 35 8b 0d 80 00    	lea    0x800d8b,%esi
+  800d89:	0f 34                	sysenter
+  800d8b:	5d                   	pop    %ebp
+		goto out;
+  800d8c:	eb d5                	jmp    800d63 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8e:	83 ec 0c             	sub    $0xc,%esp
+  800d91:	50                   	push   %eax
+  800d92:	6a 03                	push   $0x3
+  800d94:	68 2b 38 80 00       	push   $0x80382b
+  800d99:	6a 3f                	push   $0x3f
+  800d9b:	68 48 38 80 00       	push   $0x803848
+  800da0:	e8 71 f4 ff ff       	call   800216 <_panic>
+
+00800da5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	57                   	push   %edi
+  800da9:	56                   	push   %esi
+  800daa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800db2:	74 19                	je     800dcd <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800db4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dbe:	89 d1                	mov    %edx,%ecx
+  800dc0:	89 d3                	mov    %edx,%ebx
+  800dc2:	89 d7                	mov    %edx,%edi
+  800dc4:	89 d6                	mov    %edx,%esi
+  800dc6:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc8:	5b                   	pop    %ebx
+  800dc9:	5e                   	pop    %esi
+  800dca:	5f                   	pop    %edi
+  800dcb:	5d                   	pop    %ebp
+  800dcc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd7:	89 d1                	mov    %edx,%ecx
+  800dd9:	89 d3                	mov    %edx,%ebx
+  800ddb:	89 d7                	mov    %edx,%edi
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	8d 35 e8 0d 80 00    	lea    0x800de8,%esi
+  800de6:	0f 34                	sysenter
+  800de8:	5d                   	pop    %ebp
+		goto out;
+  800de9:	eb dd                	jmp    800dc8 <sys_getenvid+0x23>
+
+00800deb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	57                   	push   %edi
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800df1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800df8:	74 19                	je     800e13 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dff:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e04:	89 d1                	mov    %edx,%ecx
+  800e06:	89 d3                	mov    %edx,%ebx
+  800e08:	89 d7                	mov    %edx,%edi
+  800e0a:	89 d6                	mov    %edx,%esi
+  800e0c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e18:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e1d:	89 d1                	mov    %edx,%ecx
+  800e1f:	89 d3                	mov    %edx,%ebx
+  800e21:	89 d7                	mov    %edx,%edi
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	8d 35 2e 0e 80 00    	lea    0x800e2e,%esi
+  800e2c:	0f 34                	sysenter
+  800e2e:	5d                   	pop    %ebp
+		goto out;
+  800e2f:	eb dd                	jmp    800e0e <sys_yield+0x23>
+
+00800e31 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e3a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e41:	74 23                	je     800e66 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e43:	be 00 00 00 00       	mov    $0x0,%esi
+  800e48:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e56:	89 f7                	mov    %esi,%edi
+  800e58:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e5a:	85 c0                	test   %eax,%eax
+  800e5c:	7f 29                	jg     800e87 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e61:	5b                   	pop    %ebx
+  800e62:	5e                   	pop    %esi
+  800e63:	5f                   	pop    %edi
+  800e64:	5d                   	pop    %ebp
+  800e65:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e71:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e79:	55                   	push   %ebp
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	8d 35 84 0e 80 00    	lea    0x800e84,%esi
+  800e82:	0f 34                	sysenter
+  800e84:	5d                   	pop    %ebp
+		goto out;
+  800e85:	eb d3                	jmp    800e5a <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e87:	83 ec 0c             	sub    $0xc,%esp
+  800e8a:	50                   	push   %eax
+  800e8b:	6a 04                	push   $0x4
+  800e8d:	68 2b 38 80 00       	push   $0x80382b
+  800e92:	6a 3f                	push   $0x3f
+  800e94:	68 48 38 80 00       	push   $0x803848
+  800e99:	e8 78 f3 ff ff       	call   800216 <_panic>
+
+00800e9e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	57                   	push   %edi
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  800ea4:	83 ec 0c             	sub    $0xc,%esp
+  800ea7:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800eaa:	85 f6                	test   %esi,%esi
+  800eac:	75 09                	jne    800eb7 <sys_page_map+0x19>
+  800eae:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eb5:	74 1f                	je     800ed6 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800eb7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ebc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eca:	85 c0                	test   %eax,%eax
+  800ecc:	7f 27                	jg     800ef5 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ed6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edc:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ee1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	8d 35 f2 0e 80 00    	lea    0x800ef2,%esi
+  800ef0:	0f 34                	sysenter
+  800ef2:	5d                   	pop    %ebp
+		goto out;
+  800ef3:	eb d5                	jmp    800eca <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef5:	83 ec 0c             	sub    $0xc,%esp
+  800ef8:	50                   	push   %eax
+  800ef9:	6a 05                	push   $0x5
+  800efb:	68 2b 38 80 00       	push   $0x80382b
+  800f00:	6a 3f                	push   $0x3f
+  800f02:	68 48 38 80 00       	push   $0x803848
+  800f07:	e8 0a f3 ff ff       	call   800216 <_panic>
+
+00800f0c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	57                   	push   %edi
+  800f10:	56                   	push   %esi
+  800f11:	53                   	push   %ebx
+  800f12:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f15:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f1c:	74 22                	je     800f40 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f23:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2e:	89 df                	mov    %ebx,%edi
+  800f30:	89 de                	mov    %ebx,%esi
+  800f32:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f34:	85 c0                	test   %eax,%eax
+  800f36:	7f 28                	jg     800f60 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3b:	5b                   	pop    %ebx
+  800f3c:	5e                   	pop    %esi
+  800f3d:	5f                   	pop    %edi
+  800f3e:	5d                   	pop    %ebp
+  800f3f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f50:	89 df                	mov    %ebx,%edi
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	8d 35 5d 0f 80 00    	lea    0x800f5d,%esi
+  800f5b:	0f 34                	sysenter
+  800f5d:	5d                   	pop    %ebp
+		goto out;
+  800f5e:	eb d4                	jmp    800f34 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f60:	83 ec 0c             	sub    $0xc,%esp
+  800f63:	50                   	push   %eax
+  800f64:	6a 06                	push   $0x6
+  800f66:	68 2b 38 80 00       	push   $0x80382b
+  800f6b:	6a 3f                	push   $0x3f
+  800f6d:	68 48 38 80 00       	push   $0x803848
+  800f72:	e8 9f f2 ff ff       	call   800216 <_panic>
+
+00800f77 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	57                   	push   %edi
+  800f7b:	56                   	push   %esi
+  800f7c:	53                   	push   %ebx
+  800f7d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f80:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f87:	74 22                	je     800fab <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f99:	89 df                	mov    %ebx,%edi
+  800f9b:	89 de                	mov    %ebx,%esi
+  800f9d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9f:	85 c0                	test   %eax,%eax
+  800fa1:	7f 28                	jg     800fcb <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa6:	5b                   	pop    %ebx
+  800fa7:	5e                   	pop    %esi
+  800fa8:	5f                   	pop    %edi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb6:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fbb:	89 df                	mov    %ebx,%edi
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	8d 35 c8 0f 80 00    	lea    0x800fc8,%esi
+  800fc6:	0f 34                	sysenter
+  800fc8:	5d                   	pop    %ebp
+		goto out;
+  800fc9:	eb d4                	jmp    800f9f <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+  800fce:	50                   	push   %eax
+  800fcf:	6a 08                	push   $0x8
+  800fd1:	68 2b 38 80 00       	push   $0x80382b
+  800fd6:	6a 3f                	push   $0x3f
+  800fd8:	68 48 38 80 00       	push   $0x803848
+  800fdd:	e8 34 f2 ff ff       	call   800216 <_panic>
+
+00800fe2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	57                   	push   %edi
+  800fe6:	56                   	push   %esi
+  800fe7:	53                   	push   %ebx
+  800fe8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800feb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ff2:	74 22                	je     801016 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ff4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801001:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801004:	89 df                	mov    %ebx,%edi
+  801006:	89 de                	mov    %ebx,%esi
+  801008:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100a:	85 c0                	test   %eax,%eax
+  80100c:	7f 28                	jg     801036 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80100e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801016:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801021:	b8 09 00 00 00       	mov    $0x9,%eax
+  801026:	89 df                	mov    %ebx,%edi
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	8d 35 33 10 80 00    	lea    0x801033,%esi
+  801031:	0f 34                	sysenter
+  801033:	5d                   	pop    %ebp
+		goto out;
+  801034:	eb d4                	jmp    80100a <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801036:	83 ec 0c             	sub    $0xc,%esp
+  801039:	50                   	push   %eax
+  80103a:	6a 09                	push   $0x9
+  80103c:	68 2b 38 80 00       	push   $0x80382b
+  801041:	6a 3f                	push   $0x3f
+  801043:	68 48 38 80 00       	push   $0x803848
+  801048:	e8 c9 f1 ff ff       	call   800216 <_panic>
+
+0080104d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	57                   	push   %edi
+  801051:	56                   	push   %esi
+  801052:	53                   	push   %ebx
+  801053:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801056:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80105d:	74 22                	je     801081 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80105f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801064:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106f:	89 df                	mov    %ebx,%edi
+  801071:	89 de                	mov    %ebx,%esi
+  801073:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801075:	85 c0                	test   %eax,%eax
+  801077:	7f 28                	jg     8010a1 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801079:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107c:	5b                   	pop    %ebx
+  80107d:	5e                   	pop    %esi
+  80107e:	5f                   	pop    %edi
+  80107f:	5d                   	pop    %ebp
+  801080:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801081:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801086:	8b 55 08             	mov    0x8(%ebp),%edx
+  801089:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801091:	89 df                	mov    %ebx,%edi
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	8d 35 9e 10 80 00    	lea    0x80109e,%esi
+  80109c:	0f 34                	sysenter
+  80109e:	5d                   	pop    %ebp
+		goto out;
+  80109f:	eb d4                	jmp    801075 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a1:	83 ec 0c             	sub    $0xc,%esp
+  8010a4:	50                   	push   %eax
+  8010a5:	6a 0a                	push   $0xa
+  8010a7:	68 2b 38 80 00       	push   $0x80382b
+  8010ac:	6a 3f                	push   $0x3f
+  8010ae:	68 48 38 80 00       	push   $0x803848
+  8010b3:	e8 5e f1 ff ff       	call   800216 <_panic>
+
+008010b8 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	57                   	push   %edi
+  8010bc:	56                   	push   %esi
+  8010bd:	53                   	push   %ebx
+  8010be:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010c1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010c8:	74 22                	je     8010ec <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8010ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cf:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010da:	89 df                	mov    %ebx,%edi
+  8010dc:	89 de                	mov    %ebx,%esi
+  8010de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e0:	85 c0                	test   %eax,%eax
+  8010e2:	7f 28                	jg     80110c <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8010e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e7:	5b                   	pop    %ebx
+  8010e8:	5e                   	pop    %esi
+  8010e9:	5f                   	pop    %edi
+  8010ea:	5d                   	pop    %ebp
+  8010eb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010fc:	89 df                	mov    %ebx,%edi
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	8d 35 09 11 80 00    	lea    0x801109,%esi
+  801107:	0f 34                	sysenter
+  801109:	5d                   	pop    %ebp
+		goto out;
+  80110a:	eb d4                	jmp    8010e0 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110c:	83 ec 0c             	sub    $0xc,%esp
+  80110f:	50                   	push   %eax
+  801110:	6a 17                	push   $0x17
+  801112:	68 2b 38 80 00       	push   $0x80382b
+  801117:	6a 3f                	push   $0x3f
+  801119:	68 48 38 80 00       	push   $0x803848
+  80111e:	e8 f3 f0 ff ff       	call   800216 <_panic>
+
+00801123 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801123:	55                   	push   %ebp
+  801124:	89 e5                	mov    %esp,%ebp
+  801126:	57                   	push   %edi
+  801127:	56                   	push   %esi
+  801128:	53                   	push   %ebx
+  801129:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80112c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801133:	74 22                	je     801157 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801135:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80113f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801142:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801145:	89 df                	mov    %ebx,%edi
+  801147:	89 de                	mov    %ebx,%esi
+  801149:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80114b:	85 c0                	test   %eax,%eax
+  80114d:	7f 28                	jg     801177 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80114f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801152:	5b                   	pop    %ebx
+  801153:	5e                   	pop    %esi
+  801154:	5f                   	pop    %edi
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801157:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801162:	b8 18 00 00 00       	mov    $0x18,%eax
+  801167:	89 df                	mov    %ebx,%edi
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	8d 35 74 11 80 00    	lea    0x801174,%esi
+  801172:	0f 34                	sysenter
+  801174:	5d                   	pop    %ebp
+		goto out;
+  801175:	eb d4                	jmp    80114b <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801177:	83 ec 0c             	sub    $0xc,%esp
+  80117a:	50                   	push   %eax
+  80117b:	6a 18                	push   $0x18
+  80117d:	68 2b 38 80 00       	push   $0x80382b
+  801182:	6a 3f                	push   $0x3f
+  801184:	68 48 38 80 00       	push   $0x803848
+  801189:	e8 88 f0 ff ff       	call   800216 <_panic>
+
+0080118e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801194:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80119b:	74 1d                	je     8011ba <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80119d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011b5:	5b                   	pop    %ebx
+  8011b6:	5e                   	pop    %esi
+  8011b7:	5f                   	pop    %edi
+  8011b8:	5d                   	pop    %ebp
+  8011b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+  8011ce:	8d 35 d6 11 80 00    	lea    0x8011d6,%esi
+  8011d4:	0f 34                	sysenter
+  8011d6:	5d                   	pop    %ebp
+		goto out;
+  8011d7:	eb dc                	jmp    8011b5 <sys_ipc_try_send+0x27>
+
+008011d9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011d9:	55                   	push   %ebp
+  8011da:	89 e5                	mov    %esp,%ebp
+  8011dc:	57                   	push   %edi
+  8011dd:	56                   	push   %esi
+  8011de:	53                   	push   %ebx
+  8011df:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011e2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011e9:	74 21                	je     80120c <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8011eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f8:	89 cb                	mov    %ecx,%ebx
+  8011fa:	89 cf                	mov    %ecx,%edi
+  8011fc:	89 ce                	mov    %ecx,%esi
+  8011fe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801200:	85 c0                	test   %eax,%eax
+  801202:	7f 27                	jg     80122b <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801204:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801207:	5b                   	pop    %ebx
+  801208:	5e                   	pop    %esi
+  801209:	5f                   	pop    %edi
+  80120a:	5d                   	pop    %ebp
+  80120b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801214:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801219:	89 cb                	mov    %ecx,%ebx
+  80121b:	89 cf                	mov    %ecx,%edi
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	8d 35 28 12 80 00    	lea    0x801228,%esi
+  801226:	0f 34                	sysenter
+  801228:	5d                   	pop    %ebp
+		goto out;
+  801229:	eb d5                	jmp    801200 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80122b:	83 ec 0c             	sub    $0xc,%esp
+  80122e:	50                   	push   %eax
+  80122f:	6a 0d                	push   $0xd
+  801231:	68 2b 38 80 00       	push   $0x80382b
+  801236:	6a 3f                	push   $0x3f
+  801238:	68 48 38 80 00       	push   $0x803848
+  80123d:	e8 d4 ef ff ff       	call   800216 <_panic>
+
+00801242 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801242:	55                   	push   %ebp
+  801243:	89 e5                	mov    %esp,%ebp
+  801245:	57                   	push   %edi
+  801246:	56                   	push   %esi
+  801247:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801248:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80124f:	74 1b                	je     80126c <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801251:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801256:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80125b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801261:	89 df                	mov    %ebx,%edi
+  801263:	89 de                	mov    %ebx,%esi
+  801265:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801267:	5b                   	pop    %ebx
+  801268:	5e                   	pop    %esi
+  801269:	5f                   	pop    %edi
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80126c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80127c:	89 df                	mov    %ebx,%edi
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	8d 35 89 12 80 00    	lea    0x801289,%esi
+  801287:	0f 34                	sysenter
+  801289:	5d                   	pop    %ebp
+		goto out;
+  80128a:	eb db                	jmp    801267 <sys_ipc_recv_until+0x25>
+
+0080128c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	57                   	push   %edi
+  801290:	56                   	push   %esi
+  801291:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801292:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801299:	74 19                	je     8012b4 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80129b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012a5:	89 d1                	mov    %edx,%ecx
+  8012a7:	89 d3                	mov    %edx,%ebx
+  8012a9:	89 d7                	mov    %edx,%edi
+  8012ab:	89 d6                	mov    %edx,%esi
+  8012ad:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012af:	5b                   	pop    %ebx
+  8012b0:	5e                   	pop    %esi
+  8012b1:	5f                   	pop    %edi
+  8012b2:	5d                   	pop    %ebp
+  8012b3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012be:	89 d1                	mov    %edx,%ecx
+  8012c0:	89 d3                	mov    %edx,%ebx
+  8012c2:	89 d7                	mov    %edx,%edi
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	8d 35 cf 12 80 00    	lea    0x8012cf,%esi
+  8012cd:	0f 34                	sysenter
+  8012cf:	5d                   	pop    %ebp
+		goto out;
+  8012d0:	eb dd                	jmp    8012af <sys_time_msec+0x23>
+
+008012d2 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8012d2:	55                   	push   %ebp
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	57                   	push   %edi
+  8012d6:	56                   	push   %esi
+  8012d7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012d8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012df:	74 1a                	je     8012fb <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8012e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e6:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ee:	89 cb                	mov    %ecx,%ebx
+  8012f0:	89 cf                	mov    %ecx,%edi
+  8012f2:	89 ce                	mov    %ecx,%esi
+  8012f4:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012f6:	5b                   	pop    %ebx
+  8012f7:	5e                   	pop    %esi
+  8012f8:	5f                   	pop    %edi
+  8012f9:	5d                   	pop    %ebp
+  8012fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801303:	b8 10 00 00 00       	mov    $0x10,%eax
+  801308:	89 cb                	mov    %ecx,%ebx
+  80130a:	89 cf                	mov    %ecx,%edi
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	8d 35 17 13 80 00    	lea    0x801317,%esi
+  801315:	0f 34                	sysenter
+  801317:	5d                   	pop    %ebp
+		goto out;
+  801318:	eb dc                	jmp    8012f6 <sys_sleep_until+0x24>
+
+0080131a <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80131a:	55                   	push   %ebp
+  80131b:	89 e5                	mov    %esp,%ebp
+  80131d:	57                   	push   %edi
+  80131e:	56                   	push   %esi
+  80131f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801320:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801327:	74 1a                	je     801343 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801329:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80132e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801333:	8b 55 08             	mov    0x8(%ebp),%edx
+  801336:	89 cb                	mov    %ecx,%ebx
+  801338:	89 cf                	mov    %ecx,%edi
+  80133a:	89 ce                	mov    %ecx,%esi
+  80133c:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80133e:	5b                   	pop    %ebx
+  80133f:	5e                   	pop    %esi
+  801340:	5f                   	pop    %edi
+  801341:	5d                   	pop    %ebp
+  801342:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801343:	8b 55 08             	mov    0x8(%ebp),%edx
+  801346:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80134b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801350:	89 cb                	mov    %ecx,%ebx
+  801352:	89 cf                	mov    %ecx,%edi
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  801357:	8d 35 5f 13 80 00    	lea    0x80135f,%esi
+  80135d:	0f 34                	sysenter
+  80135f:	5d                   	pop    %ebp
+		goto out;
+  801360:	eb dc                	jmp    80133e <sys_env_print_stats+0x24>
+
+00801362 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801362:	55                   	push   %ebp
+  801363:	89 e5                	mov    %esp,%ebp
+  801365:	57                   	push   %edi
+  801366:	56                   	push   %esi
+  801367:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801368:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80136f:	74 1b                	je     80138c <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801371:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801376:	b8 19 00 00 00       	mov    $0x19,%eax
+  80137b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801381:	89 df                	mov    %ebx,%edi
+  801383:	89 de                	mov    %ebx,%esi
+  801385:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801387:	5b                   	pop    %ebx
+  801388:	5e                   	pop    %esi
+  801389:	5f                   	pop    %edi
+  80138a:	5d                   	pop    %ebp
+  80138b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80138c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801391:	8b 55 08             	mov    0x8(%ebp),%edx
+  801394:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801397:	b8 19 00 00 00       	mov    $0x19,%eax
+  80139c:	89 df                	mov    %ebx,%edi
+  80139e:	55                   	push   %ebp
+  80139f:	89 e5                	mov    %esp,%ebp
+  8013a1:	8d 35 a9 13 80 00    	lea    0x8013a9,%esi
+  8013a7:	0f 34                	sysenter
+  8013a9:	5d                   	pop    %ebp
+		goto out;
+  8013aa:	eb db                	jmp    801387 <sys_perf+0x25>
+
+008013ac <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	57                   	push   %edi
+  8013b0:	56                   	push   %esi
+  8013b1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013b2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013b9:	74 19                	je     8013d4 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8013bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013c5:	89 d1                	mov    %edx,%ecx
+  8013c7:	89 d3                	mov    %edx,%ebx
+  8013c9:	89 d7                	mov    %edx,%edi
+  8013cb:	89 d6                	mov    %edx,%esi
+  8013cd:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013cf:	5b                   	pop    %ebx
+  8013d0:	5e                   	pop    %esi
+  8013d1:	5f                   	pop    %edi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013de:	89 d1                	mov    %edx,%ecx
+  8013e0:	89 d3                	mov    %edx,%ebx
+  8013e2:	89 d7                	mov    %edx,%edi
+  8013e4:	55                   	push   %ebp
+  8013e5:	89 e5                	mov    %esp,%ebp
+  8013e7:	8d 35 ef 13 80 00    	lea    0x8013ef,%esi
+  8013ed:	0f 34                	sysenter
+  8013ef:	5d                   	pop    %ebp
+		goto out;
+  8013f0:	eb dd                	jmp    8013cf <sys_fork+0x23>
+
+008013f2 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8013f2:	55                   	push   %ebp
+  8013f3:	89 e5                	mov    %esp,%ebp
+  8013f5:	57                   	push   %edi
+  8013f6:	56                   	push   %esi
+  8013f7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013f8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013ff:	74 1c                	je     80141d <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801401:	be 00 00 00 00       	mov    $0x0,%esi
+  801406:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80140b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801411:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801414:	89 f7                	mov    %esi,%edi
+  801416:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801418:	5b                   	pop    %ebx
+  801419:	5e                   	pop    %esi
+  80141a:	5f                   	pop    %edi
+  80141b:	5d                   	pop    %ebp
+  80141c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80141d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801420:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801423:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801428:	bf 00 00 00 00       	mov    $0x0,%edi
+  80142d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801430:	55                   	push   %ebp
+  801431:	89 e5                	mov    %esp,%ebp
+  801433:	8d 35 3b 14 80 00    	lea    0x80143b,%esi
+  801439:	0f 34                	sysenter
+  80143b:	5d                   	pop    %ebp
+		goto out;
+  80143c:	eb da                	jmp    801418 <sys_thread_create+0x26>
+
+0080143e <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	57                   	push   %edi
+  801442:	56                   	push   %esi
+  801443:	53                   	push   %ebx
+  801444:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801447:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80144e:	74 24                	je     801474 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801450:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801455:	be 00 00 00 00       	mov    $0x0,%esi
+  80145a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801460:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801463:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801466:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801468:	85 c0                	test   %eax,%eax
+  80146a:	7f 27                	jg     801493 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80146c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146f:	5b                   	pop    %ebx
+  801470:	5e                   	pop    %esi
+  801471:	5f                   	pop    %edi
+  801472:	5d                   	pop    %ebp
+  801473:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801474:	8b 55 08             	mov    0x8(%ebp),%edx
+  801477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80147f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801482:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	8d 35 90 14 80 00    	lea    0x801490,%esi
+  80148e:	0f 34                	sysenter
+  801490:	5d                   	pop    %ebp
+		goto out;
+  801491:	eb d5                	jmp    801468 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801493:	83 ec 0c             	sub    $0xc,%esp
+  801496:	50                   	push   %eax
+  801497:	6a 1f                	push   $0x1f
+  801499:	68 2b 38 80 00       	push   $0x80382b
+  80149e:	6a 3f                	push   $0x3f
+  8014a0:	68 48 38 80 00       	push   $0x803848
+  8014a5:	e8 6c ed ff ff       	call   800216 <_panic>
+
+008014aa <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8014aa:	55                   	push   %ebp
+  8014ab:	89 e5                	mov    %esp,%ebp
+  8014ad:	57                   	push   %edi
+  8014ae:	56                   	push   %esi
+  8014af:	53                   	push   %ebx
+  8014b0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014b3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ba:	74 23                	je     8014df <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8014bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c1:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014cf:	89 f7                	mov    %esi,%edi
+  8014d1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014d3:	85 c0                	test   %eax,%eax
+  8014d5:	7f 29                	jg     801500 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8014d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014da:	5b                   	pop    %ebx
+  8014db:	5e                   	pop    %esi
+  8014dc:	5f                   	pop    %edi
+  8014dd:	5d                   	pop    %ebp
+  8014de:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e5:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f2:	55                   	push   %ebp
+  8014f3:	89 e5                	mov    %esp,%ebp
+  8014f5:	8d 35 fd 14 80 00    	lea    0x8014fd,%esi
+  8014fb:	0f 34                	sysenter
+  8014fd:	5d                   	pop    %ebp
+		goto out;
+  8014fe:	eb d3                	jmp    8014d3 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801500:	83 ec 0c             	sub    $0xc,%esp
+  801503:	50                   	push   %eax
+  801504:	6a 20                	push   $0x20
+  801506:	68 2b 38 80 00       	push   $0x80382b
+  80150b:	6a 3f                	push   $0x3f
+  80150d:	68 48 38 80 00       	push   $0x803848
+  801512:	e8 ff ec ff ff       	call   800216 <_panic>
+
+00801517 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801517:	55                   	push   %ebp
+  801518:	89 e5                	mov    %esp,%ebp
+  80151a:	57                   	push   %edi
+  80151b:	56                   	push   %esi
+  80151c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80151d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801524:	74 1b                	je     801541 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801526:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801530:	8b 55 08             	mov    0x8(%ebp),%edx
+  801533:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801536:	89 df                	mov    %ebx,%edi
+  801538:	89 de                	mov    %ebx,%esi
+  80153a:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80153c:	5b                   	pop    %ebx
+  80153d:	5e                   	pop    %esi
+  80153e:	5f                   	pop    %edi
+  80153f:	5d                   	pop    %ebp
+  801540:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801541:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801546:	8b 55 08             	mov    0x8(%ebp),%edx
+  801549:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801551:	89 df                	mov    %ebx,%edi
+  801553:	55                   	push   %ebp
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	8d 35 5e 15 80 00    	lea    0x80155e,%esi
+  80155c:	0f 34                	sysenter
+  80155e:	5d                   	pop    %ebp
+		goto out;
+  80155f:	eb db                	jmp    80153c <sys_batch+0x25>
+
+00801561 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	57                   	push   %edi
+  801565:	56                   	push   %esi
+  801566:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801567:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80156e:	74 1a                	je     80158a <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801575:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80157a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157d:	89 cb                	mov    %ecx,%ebx
+  80157f:	89 cf                	mov    %ecx,%edi
+  801581:	89 ce                	mov    %ecx,%esi
+  801583:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801585:	5b                   	pop    %ebx
+  801586:	5e                   	pop    %esi
+  801587:	5f                   	pop    %edi
+  801588:	5d                   	pop    %ebp
+  801589:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80158a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801592:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801597:	89 cb                	mov    %ecx,%ebx
+  801599:	89 cf                	mov    %ecx,%edi
+  80159b:	55                   	push   %ebp
+  80159c:	89 e5                	mov    %esp,%ebp
+  80159e:	8d 35 a6 15 80 00    	lea    0x8015a6,%esi
+  8015a4:	0f 34                	sysenter
+  8015a6:	5d                   	pop    %ebp
+		goto out;
+  8015a7:	eb dc                	jmp    801585 <sys_trace_ctl+0x24>
+
+008015a9 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	57                   	push   %edi
+  8015ad:	56                   	push   %esi
+  8015ae:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015af:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015b6:	74 1c                	je     8015d4 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8015b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015cb:	89 f7                	mov    %esi,%edi
+  8015cd:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8015cf:	5b                   	pop    %ebx
+  8015d0:	5e                   	pop    %esi
+  8015d1:	5f                   	pop    %edi
+  8015d2:	5d                   	pop    %ebp
+  8015d3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015da:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	8d 35 f2 15 80 00    	lea    0x8015f2,%esi
+  8015f0:	0f 34                	sysenter
+  8015f2:	5d                   	pop    %ebp
+		goto out;
+  8015f3:	eb da                	jmp    8015cf <sys_trace_read+0x26>
+
+008015f5 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	57                   	push   %edi
+  8015f9:	56                   	push   %esi
+  8015fa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015fb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801602:	74 1c                	je     801620 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801604:	be 00 00 00 00       	mov    $0x0,%esi
+  801609:	b8 21 00 00 00       	mov    $0x21,%eax
+  80160e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801611:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801614:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801617:	89 f7                	mov    %esi,%edi
+  801619:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80161b:	5b                   	pop    %ebx
+  80161c:	5e                   	pop    %esi
+  80161d:	5f                   	pop    %edi
+  80161e:	5d                   	pop    %ebp
+  80161f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801620:	8b 55 08             	mov    0x8(%ebp),%edx
+  801623:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801626:	b8 21 00 00 00       	mov    $0x21,%eax
+  80162b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801630:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801633:	55                   	push   %ebp
+  801634:	89 e5                	mov    %esp,%ebp
+  801636:	8d 35 3e 16 80 00    	lea    0x80163e,%esi
+  80163c:	0f 34                	sysenter
+  80163e:	5d                   	pop    %ebp
+		goto out;
+  80163f:	eb da                	jmp    80161b <sys_meminfo+0x26>
+
+00801641 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801641:	55                   	push   %ebp
+  801642:	89 e5                	mov    %esp,%ebp
+  801644:	57                   	push   %edi
+  801645:	56                   	push   %esi
+  801646:	53                   	push   %ebx
+  801647:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80164a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80164e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801655:	74 1f                	je     801676 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801657:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165c:	b8 22 00 00 00       	mov    $0x22,%eax
+  801661:	8b 55 08             	mov    0x8(%ebp),%edx
+  801664:	89 df                	mov    %ebx,%edi
+  801666:	89 de                	mov    %ebx,%esi
+  801668:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	7f 25                	jg     801693 <sys_env_set_ksm+0x52>
+}
+  80166e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801671:	5b                   	pop    %ebx
+  801672:	5e                   	pop    %esi
+  801673:	5f                   	pop    %edi
+  801674:	5d                   	pop    %ebp
+  801675:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801676:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801683:	89 df                	mov    %ebx,%edi
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	8d 35 90 16 80 00    	lea    0x801690,%esi
+  80168e:	0f 34                	sysenter
+  801690:	5d                   	pop    %ebp
+		goto out;
+  801691:	eb d7                	jmp    80166a <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801693:	83 ec 0c             	sub    $0xc,%esp
+  801696:	50                   	push   %eax
+  801697:	6a 22                	push   $0x22
+  801699:	68 2b 38 80 00       	push   $0x80382b
+  80169e:	6a 3f                	push   $0x3f
+  8016a0:	68 48 38 80 00       	push   $0x803848
+  8016a5:	e8 6c eb ff ff       	call   800216 <_panic>
+
+008016aa <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	57                   	push   %edi
+  8016ae:	56                   	push   %esi
+  8016af:	53                   	push   %ebx
+  8016b0:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8016b3:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8016b6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016bd:	74 24                	je     8016e3 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8016bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016c9:	89 cb                	mov    %ecx,%ebx
+  8016cb:	89 cf                	mov    %ecx,%edi
+  8016cd:	89 ce                	mov    %ecx,%esi
+  8016cf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016d1:	85 c0                	test   %eax,%eax
+  8016d3:	7f 2a                	jg     8016ff <sys_time_nsec+0x55>
+	return ns;
+}
+  8016d5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016d8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016de:	5b                   	pop    %ebx
+  8016df:	5e                   	pop    %esi
+  8016e0:	5f                   	pop    %edi
+  8016e1:	5d                   	pop    %ebp
+  8016e2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016ed:	89 cb                	mov    %ecx,%ebx
+  8016ef:	89 cf                	mov    %ecx,%edi
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	8d 35 fc 16 80 00    	lea    0x8016fc,%esi
+  8016fa:	0f 34                	sysenter
+  8016fc:	5d                   	pop    %ebp
+		goto out;
+  8016fd:	eb d2                	jmp    8016d1 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016ff:	83 ec 0c             	sub    $0xc,%esp
+  801702:	50                   	push   %eax
+  801703:	6a 0f                	push   $0xf
+  801705:	68 2b 38 80 00       	push   $0x80382b
+  80170a:	6a 3f                	push   $0x3f
+  80170c:	68 48 38 80 00       	push   $0x803848
+  801711:	e8 00 eb ff ff       	call   800216 <_panic>
+
+00801716 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	57                   	push   %edi
+  80171a:	56                   	push   %esi
+  80171b:	53                   	push   %ebx
+  80171c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80171f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801726:	74 22                	je     80174a <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801728:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801732:	8b 55 08             	mov    0x8(%ebp),%edx
+  801735:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801738:	89 df                	mov    %ebx,%edi
+  80173a:	89 de                	mov    %ebx,%esi
+  80173c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	7f 28                	jg     80176a <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801742:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801745:	5b                   	pop    %ebx
+  801746:	5e                   	pop    %esi
+  801747:	5f                   	pop    %edi
+  801748:	5d                   	pop    %ebp
+  801749:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80174a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801752:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801755:	b8 12 00 00 00       	mov    $0x12,%eax
+  80175a:	89 df                	mov    %ebx,%edi
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	8d 35 67 17 80 00    	lea    0x801767,%esi
+  801765:	0f 34                	sysenter
+  801767:	5d                   	pop    %ebp
+		goto out;
+  801768:	eb d4                	jmp    80173e <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80176a:	83 ec 0c             	sub    $0xc,%esp
+  80176d:	50                   	push   %eax
+  80176e:	6a 12                	push   $0x12
+  801770:	68 2b 38 80 00       	push   $0x80382b
+  801775:	6a 3f                	push   $0x3f
+  801777:	68 48 38 80 00       	push   $0x803848
+  80177c:	e8 95 ea ff ff       	call   800216 <_panic>
+
+00801781 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801781:	55                   	push   %ebp
+  801782:	89 e5                	mov    %esp,%ebp
+  801784:	57                   	push   %edi
+  801785:	56                   	push   %esi
+  801786:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801787:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80178e:	74 1b                	je     8017ab <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801790:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801795:	b8 13 00 00 00       	mov    $0x13,%eax
+  80179a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a0:	89 df                	mov    %ebx,%edi
+  8017a2:	89 de                	mov    %ebx,%esi
+  8017a4:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017a6:	5b                   	pop    %ebx
+  8017a7:	5e                   	pop    %esi
+  8017a8:	5f                   	pop    %edi
+  8017a9:	5d                   	pop    %ebp
+  8017aa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017bb:	89 df                	mov    %ebx,%edi
+  8017bd:	55                   	push   %ebp
+  8017be:	89 e5                	mov    %esp,%ebp
+  8017c0:	8d 35 c8 17 80 00    	lea    0x8017c8,%esi
+  8017c6:	0f 34                	sysenter
+  8017c8:	5d                   	pop    %ebp
+		goto out;
+  8017c9:	eb db                	jmp    8017a6 <sys_e1000_receive+0x25>
+
+008017cb <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8017cb:	55                   	push   %ebp
+  8017cc:	89 e5                	mov    %esp,%ebp
+  8017ce:	57                   	push   %edi
+  8017cf:	56                   	push   %esi
+  8017d0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017d1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017d8:	74 1b                	je     8017f5 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8017da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017df:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ea:	89 df                	mov    %ebx,%edi
+  8017ec:	89 de                	mov    %ebx,%esi
+  8017ee:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017f0:	5b                   	pop    %ebx
+  8017f1:	5e                   	pop    %esi
+  8017f2:	5f                   	pop    %edi
+  8017f3:	5d                   	pop    %ebp
+  8017f4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801800:	b8 14 00 00 00       	mov    $0x14,%eax
+  801805:	89 df                	mov    %ebx,%edi
+  801807:	55                   	push   %ebp
+  801808:	89 e5                	mov    %esp,%ebp
+  80180a:	8d 35 12 18 80 00    	lea    0x801812,%esi
+  801810:	0f 34                	sysenter
+  801812:	5d                   	pop    %ebp
+		goto out;
+  801813:	eb db                	jmp    8017f0 <sys_e1000_read_hwaddr+0x25>
+
+00801815 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	57                   	push   %edi
+  801819:	56                   	push   %esi
+  80181a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80181b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801822:	74 1a                	je     80183e <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801824:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801829:	b8 15 00 00 00       	mov    $0x15,%eax
+  80182e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801831:	89 cb                	mov    %ecx,%ebx
+  801833:	89 cf                	mov    %ecx,%edi
+  801835:	89 ce                	mov    %ecx,%esi
+  801837:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801839:	5b                   	pop    %ebx
+  80183a:	5e                   	pop    %esi
+  80183b:	5f                   	pop    %edi
+  80183c:	5d                   	pop    %ebp
+  80183d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80183e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801841:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801846:	b8 15 00 00 00       	mov    $0x15,%eax
+  80184b:	89 cb                	mov    %ecx,%ebx
+  80184d:	89 cf                	mov    %ecx,%edi
+  80184f:	55                   	push   %ebp
+  801850:	89 e5                	mov    %esp,%ebp
+  801852:	8d 35 5a 18 80 00    	lea    0x80185a,%esi
+  801858:	0f 34                	sysenter
+  80185a:	5d                   	pop    %ebp
+		goto out;
+  80185b:	eb dc                	jmp    801839 <sys_sb16_read_version+0x24>
+
+0080185d <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80185d:	55                   	push   %ebp
+  80185e:	89 e5                	mov    %esp,%ebp
+  801860:	57                   	push   %edi
+  801861:	56                   	push   %esi
+  801862:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801863:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80186a:	74 1b                	je     801887 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80186c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801871:	b8 16 00 00 00       	mov    $0x16,%eax
+  801876:	8b 55 08             	mov    0x8(%ebp),%edx
+  801879:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187c:	89 df                	mov    %ebx,%edi
+  80187e:	89 de                	mov    %ebx,%esi
+  801880:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801882:	5b                   	pop    %ebx
+  801883:	5e                   	pop    %esi
+  801884:	5f                   	pop    %edi
+  801885:	5d                   	pop    %ebp
+  801886:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801887:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801892:	b8 16 00 00 00       	mov    $0x16,%eax
+  801897:	89 df                	mov    %ebx,%edi
+  801899:	55                   	push   %ebp
+  80189a:	89 e5                	mov    %esp,%ebp
+  80189c:	8d 35 a4 18 80 00    	lea    0x8018a4,%esi
+  8018a2:	0f 34                	sysenter
+  8018a4:	5d                   	pop    %ebp
+		goto out;
+  8018a5:	eb db                	jmp    801882 <sys_sb16_play+0x25>
+
+008018a7 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	53                   	push   %ebx
+  8018ab:	83 ec 04             	sub    $0x4,%esp
+  8018ae:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8018b0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018b7:	f6 c4 04             	test   $0x4,%ah
+  8018ba:	74 0c                	je     8018c8 <dupperm+0x21>
+  8018bc:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8018c3:	f6 c4 08             	test   $0x8,%ah
+  8018c6:	75 62                	jne    80192a <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  8018c8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  8018cf:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  8018d4:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8018da:	74 19                	je     8018f5 <dupperm+0x4e>
+  8018dc:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8018e3:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  8018e8:	83 f8 01             	cmp    $0x1,%eax
+  8018eb:	19 c0                	sbb    %eax,%eax
+  8018ed:	25 00 08 00 00       	and    $0x800,%eax
+  8018f2:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  8018f5:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  8018fc:	89 c1                	mov    %eax,%ecx
+  8018fe:	80 cd 04             	or     $0x4,%ch
+  801901:	f6 c7 04             	test   $0x4,%bh
+  801904:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801907:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80190e:	f6 c1 02             	test   $0x2,%cl
+  801911:	74 12                	je     801925 <dupperm+0x7e>
+  801913:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  80191a:	89 c2                	mov    %eax,%edx
+  80191c:	83 ca 02             	or     $0x2,%edx
+  80191f:	f6 c5 04             	test   $0x4,%ch
+  801922:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801928:	c9                   	leave
+  801929:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  80192a:	68 58 38 80 00       	push   $0x803858
+  80192f:	68 f0 38 80 00       	push   $0x8038f0
+  801934:	6a 39                	push   $0x39
+  801936:	68 05 39 80 00       	push   $0x803905
+  80193b:	e8 d6 e8 ff ff       	call   800216 <_panic>
+
+00801940 <pgfault>:
+{
+  801940:	55                   	push   %ebp
+  801941:	89 e5                	mov    %esp,%ebp
+  801943:	53                   	push   %ebx
+  801944:	83 ec 04             	sub    $0x4,%esp
+  801947:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80194a:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80194c:	89 c3                	mov    %eax,%ebx
+  80194e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801954:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801958:	74 6d                	je     8019c7 <pgfault+0x87>
+  80195a:	89 da                	mov    %ebx,%edx
+  80195c:	c1 ea 16             	shr    $0x16,%edx
+  80195f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801966:	f6 c2 80             	test   $0x80,%dl
+  801969:	75 5c                	jne    8019c7 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  80196b:	c1 e8 0c             	shr    $0xc,%eax
+  80196e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801975:	f6 c4 08             	test   $0x8,%ah
+  801978:	74 4d                	je     8019c7 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  80197a:	83 ec 04             	sub    $0x4,%esp
+  80197d:	6a 07                	push   $0x7
+  80197f:	68 00 f0 7f 00       	push   $0x7ff000
+  801984:	6a 00                	push   $0x0
+  801986:	e8 a6 f4 ff ff       	call   800e31 <sys_page_alloc>
+  80198b:	83 c4 10             	add    $0x10,%esp
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 49                	js     8019db <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801992:	83 ec 04             	sub    $0x4,%esp
+  801995:	68 00 10 00 00       	push   $0x1000
+  80199a:	53                   	push   %ebx
+  80199b:	68 00 f0 7f 00       	push   $0x7ff000
+  8019a0:	e8 1a f1 ff ff       	call   800abf <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8019a5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8019ac:	53                   	push   %ebx
+  8019ad:	6a 00                	push   $0x0
+  8019af:	68 00 f0 7f 00       	push   $0x7ff000
+  8019b4:	6a 00                	push   $0x0
+  8019b6:	e8 e3 f4 ff ff       	call   800e9e <sys_page_map>
+  8019bb:	83 c4 20             	add    $0x20,%esp
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	78 2d                	js     8019ef <pgfault+0xaf>
+}
+  8019c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c5:	c9                   	leave
+  8019c6:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  8019c7:	83 ec 04             	sub    $0x4,%esp
+  8019ca:	68 10 39 80 00       	push   $0x803910
+  8019cf:	6a 1e                	push   $0x1e
+  8019d1:	68 05 39 80 00       	push   $0x803905
+  8019d6:	e8 3b e8 ff ff       	call   800216 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  8019db:	83 ec 04             	sub    $0x4,%esp
+  8019de:	68 8c 38 80 00       	push   $0x80388c
+  8019e3:	6a 29                	push   $0x29
+  8019e5:	68 05 39 80 00       	push   $0x803905
+  8019ea:	e8 27 e8 ff ff       	call   800216 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  8019ef:	50                   	push   %eax
+  8019f0:	68 c0 38 80 00       	push   $0x8038c0
+  8019f5:	6a 2e                	push   $0x2e
+  8019f7:	68 05 39 80 00       	push   $0x803905
+  8019fc:	e8 15 e8 ff ff       	call   800216 <_panic>
+
+00801a01 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801a01:	55                   	push   %ebp
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801a07:	ff 75 0c             	push   0xc(%ebp)
+  801a0a:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801a0d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a14:	e8 23 f3 ff ff       	call   800d3c <sys_env_destroy>
+}
+  801a19:	83 c4 10             	add    $0x10,%esp
+  801a1c:	c9                   	leave
+  801a1d:	c3                   	ret
+
+00801a1e <ufork>:
+{
+  801a1e:	55                   	push   %ebp
+  801a1f:	89 e5                	mov    %esp,%ebp
+  801a21:	57                   	push   %edi
+  801a22:	56                   	push   %esi
+  801a23:	53                   	push   %ebx
+  801a24:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801a2a:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a2f:	cd 30                	int    $0x30
+  801a31:	89 c6                	mov    %eax,%esi
+  801a33:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801a39:	85 c0                	test   %eax,%eax
+  801a3b:	78 56                	js     801a93 <ufork+0x75>
+	if (pid > 0) {
+  801a3d:	0f 8e b3 02 00 00    	jle    801cf6 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801a43:	83 ec 0c             	sub    $0xc,%esp
+  801a46:	68 40 19 80 00       	push   $0x801940
+  801a4b:	e8 2a 19 00 00       	call   80337a <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801a50:	83 c4 08             	add    $0x8,%esp
+  801a53:	68 e1 33 80 00       	push   $0x8033e1
+  801a58:	56                   	push   %esi
+  801a59:	e8 ef f5 ff ff       	call   80104d <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801a5e:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801a64:	89 1c 24             	mov    %ebx,(%esp)
+  801a67:	e8 a1 04 00 00       	call   801f0d <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801a6c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801a73:	6a 07                	push   $0x7
+  801a75:	68 00 f0 bf ee       	push   $0xeebff000
+  801a7a:	56                   	push   %esi
+  801a7b:	53                   	push   %ebx
+  801a7c:	e8 0d 06 00 00       	call   80208e <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a81:	83 c4 20             	add    $0x20,%esp
+  801a84:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a89:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801a8f:	89 fe                	mov    %edi,%esi
+  801a91:	eb 22                	jmp    801ab5 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801a93:	50                   	push   %eax
+  801a94:	68 29 39 80 00       	push   $0x803929
+  801a99:	68 a9 00 00 00       	push   $0xa9
+  801a9e:	68 05 39 80 00       	push   $0x803905
+  801aa3:	e8 6e e7 ff ff       	call   800216 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801aa8:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801aae:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801ab3:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801ab5:	89 f7                	mov    %esi,%edi
+  801ab7:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801abd:	0f 87 e9 01 00 00    	ja     801cac <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801ac3:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801ac9:	85 f6                	test   %esi,%esi
+  801acb:	0f 49 d6             	cmovns %esi,%edx
+  801ace:	c1 fa 0a             	sar    $0xa,%edx
+  801ad1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801ad8:	f6 c1 01             	test   $0x1,%cl
+  801adb:	74 cb                	je     801aa8 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801add:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ae4:	f6 c2 80             	test   $0x80,%dl
+  801ae7:	75 17                	jne    801b00 <ufork+0xe2>
+			j = i + 1;
+  801ae9:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801aec:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801af3:	f6 c2 01             	test   $0x1,%dl
+  801af6:	0f 85 f3 00 00 00    	jne    801bef <ufork+0x1d1>
+			j = i + 1;
+  801afc:	89 de                	mov    %ebx,%esi
+  801afe:	eb b5                	jmp    801ab5 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801b00:	89 fb                	mov    %edi,%ebx
+  801b02:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801b05:	89 d8                	mov    %ebx,%eax
+  801b07:	c1 e8 16             	shr    $0x16,%eax
+  801b0a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b11:	89 c2                	mov    %eax,%edx
+  801b13:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801b19:	25 02 04 00 00       	and    $0x402,%eax
+  801b1e:	83 f8 02             	cmp    $0x2,%eax
+  801b21:	74 31                	je     801b54 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801b23:	83 ec 04             	sub    $0x4,%esp
+  801b26:	6a 01                	push   $0x1
+  801b28:	52                   	push   %edx
+  801b29:	53                   	push   %ebx
+  801b2a:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b30:	53                   	push   %ebx
+  801b31:	6a 00                	push   $0x0
+  801b33:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801b39:	50                   	push   %eax
+  801b3a:	e8 7a 05 00 00       	call   8020b9 <batch_map>
+		return;
+  801b3f:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b42:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b48:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b4d:	89 c6                	mov    %eax,%esi
+				continue;
+  801b4f:	e9 61 ff ff ff       	jmp    801ab5 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801b54:	83 ec 04             	sub    $0x4,%esp
+  801b57:	80 ca 80             	or     $0x80,%dl
+  801b5a:	52                   	push   %edx
+  801b5b:	53                   	push   %ebx
+  801b5c:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b62:	e8 ca f2 ff ff       	call   800e31 <sys_page_alloc>
+  801b67:	83 c4 10             	add    $0x10,%esp
+  801b6a:	85 c0                	test   %eax,%eax
+  801b6c:	78 5d                	js     801bcb <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801b6e:	83 ec 0c             	sub    $0xc,%esp
+  801b71:	6a 07                	push   $0x7
+  801b73:	68 00 00 40 00       	push   $0x400000
+  801b78:	6a 00                	push   $0x0
+  801b7a:	53                   	push   %ebx
+  801b7b:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b81:	e8 18 f3 ff ff       	call   800e9e <sys_page_map>
+  801b86:	83 c4 20             	add    $0x20,%esp
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 50                	js     801bdd <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801b8d:	83 ec 04             	sub    $0x4,%esp
+  801b90:	68 00 00 40 00       	push   $0x400000
+  801b95:	53                   	push   %ebx
+  801b96:	68 00 00 40 00       	push   $0x400000
+  801b9b:	e8 1f ef ff ff       	call   800abf <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801ba0:	83 c4 08             	add    $0x8,%esp
+  801ba3:	68 00 00 40 00       	push   $0x400000
+  801ba8:	6a 00                	push   $0x0
+  801baa:	e8 5d f3 ff ff       	call   800f0c <sys_page_unmap>
+  801baf:	83 c4 10             	add    $0x10,%esp
+  801bb2:	85 c0                	test   %eax,%eax
+  801bb4:	79 8c                	jns    801b42 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801bb6:	50                   	push   %eax
+  801bb7:	68 5d 39 80 00       	push   $0x80395d
+  801bbc:	68 81 00 00 00       	push   $0x81
+  801bc1:	68 05 39 80 00       	push   $0x803905
+  801bc6:	e8 4b e6 ff ff       	call   800216 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801bcb:	50                   	push   %eax
+  801bcc:	68 39 39 80 00       	push   $0x803939
+  801bd1:	6a 7c                	push   $0x7c
+  801bd3:	68 05 39 80 00       	push   $0x803905
+  801bd8:	e8 39 e6 ff ff       	call   800216 <_panic>
+		panic("sys_page_map: %e", r);
+  801bdd:	50                   	push   %eax
+  801bde:	68 4c 39 80 00       	push   $0x80394c
+  801be3:	6a 7e                	push   $0x7e
+  801be5:	68 05 39 80 00       	push   $0x803905
+  801bea:	e8 27 e6 ff ff       	call   800216 <_panic>
+  801bef:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801bf5:	eb 22                	jmp    801c19 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801bf7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801bfe:	a8 01                	test   $0x1,%al
+  801c00:	74 35                	je     801c37 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801c02:	89 d8                	mov    %ebx,%eax
+  801c04:	e8 9e fc ff ff       	call   8018a7 <dupperm>
+  801c09:	89 c6                	mov    %eax,%esi
+  801c0b:	89 f8                	mov    %edi,%eax
+  801c0d:	e8 95 fc ff ff       	call   8018a7 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c12:	39 c6                	cmp    %eax,%esi
+  801c14:	75 21                	jne    801c37 <ufork+0x219>
+				j++;
+  801c16:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c19:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801c1f:	74 16                	je     801c37 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801c21:	89 d8                	mov    %ebx,%eax
+  801c23:	c1 e8 0a             	shr    $0xa,%eax
+  801c26:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c2d:	25 81 00 00 00       	and    $0x81,%eax
+  801c32:	83 f8 01             	cmp    $0x1,%eax
+  801c35:	74 c0                	je     801bf7 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801c37:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801c3d:	89 d8                	mov    %ebx,%eax
+  801c3f:	29 f0                	sub    %esi,%eax
+  801c41:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801c47:	89 fe                	mov    %edi,%esi
+  801c49:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801c4c:	89 f8                	mov    %edi,%eax
+  801c4e:	e8 54 fc ff ff       	call   8018a7 <dupperm>
+  801c53:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801c55:	83 ec 08             	sub    $0x8,%esp
+  801c58:	6a 02                	push   $0x2
+  801c5a:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801c60:	51                   	push   %ecx
+  801c61:	e8 15 03 00 00       	call   801f7b <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801c66:	83 c4 0c             	add    $0xc,%esp
+  801c69:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801c6f:	57                   	push   %edi
+  801c70:	56                   	push   %esi
+  801c71:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c77:	56                   	push   %esi
+  801c78:	6a 00                	push   $0x0
+  801c7a:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801c80:	51                   	push   %ecx
+  801c81:	e8 33 04 00 00       	call   8020b9 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801c86:	83 c4 1c             	add    $0x1c,%esp
+  801c89:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801c8f:	57                   	push   %edi
+  801c90:	56                   	push   %esi
+  801c91:	6a 00                	push   $0x0
+  801c93:	56                   	push   %esi
+  801c94:	6a 00                	push   $0x0
+  801c96:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801c9c:	50                   	push   %eax
+  801c9d:	e8 17 04 00 00       	call   8020b9 <batch_map>
+	return 0;
+  801ca2:	83 c4 20             	add    $0x20,%esp
+  801ca5:	89 de                	mov    %ebx,%esi
+  801ca7:	e9 09 fe ff ff       	jmp    801ab5 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801cac:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801cb2:	83 ec 04             	sub    $0x4,%esp
+  801cb5:	6a 02                	push   $0x2
+  801cb7:	56                   	push   %esi
+  801cb8:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801cbe:	53                   	push   %ebx
+  801cbf:	e8 49 04 00 00       	call   80210d <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801cc4:	89 1c 24             	mov    %ebx,(%esp)
+  801cc7:	e8 5d 02 00 00       	call   801f29 <batch_flush>
+  801ccc:	83 c4 10             	add    $0x10,%esp
+  801ccf:	85 c0                	test   %eax,%eax
+  801cd1:	78 0e                	js     801ce1 <ufork+0x2c3>
+}
+  801cd3:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cdc:	5b                   	pop    %ebx
+  801cdd:	5e                   	pop    %esi
+  801cde:	5f                   	pop    %edi
+  801cdf:	5d                   	pop    %ebp
+  801ce0:	c3                   	ret
+			panic("fork: %e", r);
+  801ce1:	50                   	push   %eax
+  801ce2:	68 30 39 80 00       	push   $0x803930
+  801ce7:	68 d7 00 00 00       	push   $0xd7
+  801cec:	68 05 39 80 00       	push   $0x803905
+  801cf1:	e8 20 e5 ff ff       	call   800216 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801cf6:	e8 aa f0 ff ff       	call   800da5 <sys_getenvid>
+  801cfb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d00:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d06:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d0b:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801d10:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801d17:	00 00 00 
+  801d1a:	eb b7                	jmp    801cd3 <ufork+0x2b5>
+
+00801d1c <fork>:
+{
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	53                   	push   %ebx
+  801d20:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801d23:	68 40 19 80 00       	push   $0x801940
+  801d28:	e8 4d 16 00 00       	call   80337a <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801d2d:	e8 7a f6 ff ff       	call   8013ac <sys_fork>
+  801d32:	89 c3                	mov    %eax,%ebx
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	78 09                	js     801d44 <fork+0x28>
+	if (pid == 0)
+  801d3b:	74 1c                	je     801d59 <fork+0x3d>
+}
+  801d3d:	89 d8                	mov    %ebx,%eax
+  801d3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d42:	c9                   	leave
+  801d43:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801d44:	50                   	push   %eax
+  801d45:	68 29 39 80 00       	push   $0x803929
+  801d4a:	68 ed 00 00 00       	push   $0xed
+  801d4f:	68 05 39 80 00       	push   $0x803905
+  801d54:	e8 bd e4 ff ff       	call   800216 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d59:	e8 47 f0 ff ff       	call   800da5 <sys_getenvid>
+  801d5e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d63:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d69:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d6e:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801d73:	eb c8                	jmp    801d3d <fork+0x21>
+
+00801d75 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801d75:	55                   	push   %ebp
+  801d76:	89 e5                	mov    %esp,%ebp
+  801d78:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801d7b:	ff 75 0c             	push   0xc(%ebp)
+  801d7e:	ff 75 08             	push   0x8(%ebp)
+  801d81:	68 01 1a 80 00       	push   $0x801a01
+  801d86:	e8 67 f6 ff ff       	call   8013f2 <sys_thread_create>
+}
+  801d8b:	c9                   	leave
+  801d8c:	c3                   	ret
+
+00801d8d <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801d8d:	55                   	push   %ebp
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	56                   	push   %esi
+  801d91:	53                   	push   %ebx
+  801d92:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801da2:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801da5:	83 ec 08             	sub    $0x8,%esp
+  801da8:	ff 75 14             	push   0x14(%ebp)
+  801dab:	50                   	push   %eax
+  801dac:	e8 91 f4 ff ff       	call   801242 <sys_ipc_recv_until>
+  801db1:	83 c4 10             	add    $0x10,%esp
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 61                	js     801e19 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801db8:	85 f6                	test   %esi,%esi
+  801dba:	74 1c                	je     801dd8 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801dbc:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dbe:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801dc3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dc9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801dce:	76 5f                	jbe    801e2f <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801dd0:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801dd6:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801dd8:	85 db                	test   %ebx,%ebx
+  801dda:	74 1c                	je     801df8 <ipc_recv_until+0x6b>
+  801ddc:	89 e0                	mov    %esp,%eax
+  801dde:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801de3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801de9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801dee:	76 50                	jbe    801e40 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801df0:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801df6:	89 03                	mov    %eax,(%ebx)
+  801df8:	89 e0                	mov    %esp,%eax
+  801dfa:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801dff:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e05:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e0a:	76 45                	jbe    801e51 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801e0c:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801e12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e15:	5b                   	pop    %ebx
+  801e16:	5e                   	pop    %esi
+  801e17:	5d                   	pop    %ebp
+  801e18:	c3                   	ret
+		if (from_env_store)
+  801e19:	85 f6                	test   %esi,%esi
+  801e1b:	74 06                	je     801e23 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801e1d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801e23:	85 db                	test   %ebx,%ebx
+  801e25:	74 eb                	je     801e12 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801e27:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801e2d:	eb e3                	jmp    801e12 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e2f:	c1 e8 10             	shr    $0x10,%eax
+  801e32:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e38:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e3e:	eb 90                	jmp    801dd0 <ipc_recv_until+0x43>
+  801e40:	c1 e8 10             	shr    $0x10,%eax
+  801e43:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e49:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e4f:	eb 9f                	jmp    801df0 <ipc_recv_until+0x63>
+  801e51:	c1 e8 10             	shr    $0x10,%eax
+  801e54:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e5a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e60:	eb aa                	jmp    801e0c <ipc_recv_until+0x7f>
+
+00801e62 <ipc_recv>:
+{
+  801e62:	55                   	push   %ebp
+  801e63:	89 e5                	mov    %esp,%ebp
+  801e65:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801e68:	6a 00                	push   $0x0
+  801e6a:	ff 75 10             	push   0x10(%ebp)
+  801e6d:	ff 75 0c             	push   0xc(%ebp)
+  801e70:	ff 75 08             	push   0x8(%ebp)
+  801e73:	e8 15 ff ff ff       	call   801d8d <ipc_recv_until>
+}
+  801e78:	c9                   	leave
+  801e79:	c3                   	ret
+
+00801e7a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801e7a:	55                   	push   %ebp
+  801e7b:	89 e5                	mov    %esp,%ebp
+  801e7d:	57                   	push   %edi
+  801e7e:	56                   	push   %esi
+  801e7f:	53                   	push   %ebx
+  801e80:	83 ec 0c             	sub    $0xc,%esp
+  801e83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e86:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801e8c:	85 db                	test   %ebx,%ebx
+  801e8e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801e93:	0f 44 d8             	cmove  %eax,%ebx
+  801e96:	eb 05                	jmp    801e9d <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801e98:	e8 4e ef ff ff       	call   800deb <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801e9d:	ff 75 14             	push   0x14(%ebp)
+  801ea0:	53                   	push   %ebx
+  801ea1:	56                   	push   %esi
+  801ea2:	57                   	push   %edi
+  801ea3:	e8 e6 f2 ff ff       	call   80118e <sys_ipc_try_send>
+  801ea8:	83 c4 10             	add    $0x10,%esp
+  801eab:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801eae:	74 e8                	je     801e98 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801eb0:	85 c0                	test   %eax,%eax
+  801eb2:	78 08                	js     801ebc <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801eb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb7:	5b                   	pop    %ebx
+  801eb8:	5e                   	pop    %esi
+  801eb9:	5f                   	pop    %edi
+  801eba:	5d                   	pop    %ebp
+  801ebb:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801ebc:	50                   	push   %eax
+  801ebd:	68 70 39 80 00       	push   $0x803970
+  801ec2:	6a 4f                	push   $0x4f
+  801ec4:	68 83 39 80 00       	push   $0x803983
+  801ec9:	e8 48 e3 ff ff       	call   800216 <_panic>
+
+00801ece <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801ece:	55                   	push   %ebp
+  801ecf:	89 e5                	mov    %esp,%ebp
+  801ed1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801ed9:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801edf:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801ee5:	8b 52 50             	mov    0x50(%edx),%edx
+  801ee8:	39 ca                	cmp    %ecx,%edx
+  801eea:	74 11                	je     801efd <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801eec:	83 c0 01             	add    $0x1,%eax
+  801eef:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801ef4:	75 e3                	jne    801ed9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efb:	eb 0e                	jmp    801f0b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801efd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f03:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801f08:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801f0b:	5d                   	pop    %ebp
+  801f0c:	c3                   	ret
+
+00801f0d <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801f13:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801f1a:	00 00 00 
+	b->b_error = 0;
+  801f1d:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801f24:	00 00 00 
+}
+  801f27:	5d                   	pop    %ebp
+  801f28:	c3                   	ret
+
+00801f29 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	53                   	push   %ebx
+  801f2d:	83 ec 04             	sub    $0x4,%esp
+  801f30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801f33:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801f39:	85 c0                	test   %eax,%eax
+  801f3b:	7e 09                	jle    801f46 <batch_flush+0x1d>
+  801f3d:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801f44:	74 15                	je     801f5b <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801f46:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801f4d:	00 00 00 
+	return b->b_error;
+  801f50:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801f56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f59:	c9                   	leave
+  801f5a:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801f5b:	83 ec 08             	sub    $0x8,%esp
+  801f5e:	50                   	push   %eax
+  801f5f:	53                   	push   %ebx
+  801f60:	e8 b2 f5 ff ff       	call   801517 <sys_batch>
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	79 da                	jns    801f46 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801f6c:	f7 d8                	neg    %eax
+  801f6e:	0f b6 c0             	movzbl %al,%eax
+  801f71:	f7 d8                	neg    %eax
+  801f73:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801f79:	eb cb                	jmp    801f46 <batch_flush+0x1d>
+
+00801f7b <batch_reserve>:
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	83 ec 08             	sub    $0x8,%esp
+  801f81:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801f84:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801f8a:	03 45 0c             	add    0xc(%ebp),%eax
+  801f8d:	83 f8 10             	cmp    $0x10,%eax
+  801f90:	7f 02                	jg     801f94 <batch_reserve+0x19>
+}
+  801f92:	c9                   	leave
+  801f93:	c3                   	ret
+		batch_flush(b);
+  801f94:	83 ec 0c             	sub    $0xc,%esp
+  801f97:	52                   	push   %edx
+  801f98:	e8 8c ff ff ff       	call   801f29 <batch_flush>
+  801f9d:	83 c4 10             	add    $0x10,%esp
+}
+  801fa0:	eb f0                	jmp    801f92 <batch_reserve+0x17>
+
+00801fa2 <batch_next>:
+{
+  801fa2:	55                   	push   %ebp
+  801fa3:	89 e5                	mov    %esp,%ebp
+  801fa5:	53                   	push   %ebx
+  801fa6:	83 ec 04             	sub    $0x4,%esp
+  801fa9:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801fab:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801fb2:	74 28                	je     801fdc <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801fb4:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801fba:	8d 50 01             	lea    0x1(%eax),%edx
+  801fbd:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801fc3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801fc6:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801fc8:	83 ec 04             	sub    $0x4,%esp
+  801fcb:	6a 1c                	push   $0x1c
+  801fcd:	6a 00                	push   $0x0
+  801fcf:	53                   	push   %ebx
+  801fd0:	e8 b5 ea ff ff       	call   800a8a <memset>
+}
+  801fd5:	89 d8                	mov    %ebx,%eax
+  801fd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fda:	c9                   	leave
+  801fdb:	c3                   	ret
+		batch_flush(b);
+  801fdc:	83 ec 0c             	sub    $0xc,%esp
+  801fdf:	50                   	push   %eax
+  801fe0:	e8 44 ff ff ff       	call   801f29 <batch_flush>
+  801fe5:	83 c4 10             	add    $0x10,%esp
+  801fe8:	eb ca                	jmp    801fb4 <batch_next+0x12>
+
+00801fea <batch_page>:
+{
+  801fea:	55                   	push   %ebp
+  801feb:	89 e5                	mov    %esp,%ebp
+  801fed:	57                   	push   %edi
+  801fee:	56                   	push   %esi
+  801fef:	53                   	push   %ebx
+  801ff0:	83 ec 1c             	sub    $0x1c,%esp
+  801ff3:	89 d3                	mov    %edx,%ebx
+  801ff5:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801ff7:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801ffd:	85 d2                	test   %edx,%edx
+  801fff:	74 50                	je     802051 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  802001:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  802004:	01 c1                	add    %eax,%ecx
+  802006:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  802009:	75 46                	jne    802051 <batch_page+0x67>
+  80200b:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  80200e:	75 41                	jne    802051 <batch_page+0x67>
+  802010:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  802013:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  802016:	75 39                	jne    802051 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  802018:	83 ea 01             	sub    $0x1,%edx
+  80201b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  80201e:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  802021:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  802025:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  802028:	75 27                	jne    802051 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  80202a:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  80202d:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  802031:	89 fa                	mov    %edi,%edx
+  802033:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802036:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802039:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  80203c:	39 55 08             	cmp    %edx,0x8(%ebp)
+  80203f:	75 10                	jne    802051 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802041:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  802045:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802048:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  80204c:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80204f:	74 2a                	je     80207b <batch_page+0x91>
+	op = batch_next(b);
+  802051:	e8 4c ff ff ff       	call   801fa2 <batch_next>
+	op->bo_op = opcode;
+  802056:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  802058:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  80205b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80205e:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802061:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802064:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  802067:	8b 75 10             	mov    0x10(%ebp),%esi
+  80206a:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  80206d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802070:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802073:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802076:	89 78 14             	mov    %edi,0x14(%eax)
+  802079:	eb 0b                	jmp    802086 <batch_page+0x9c>
+		op->bo_npages += npages;
+  80207b:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  80207f:	03 7d 18             	add    0x18(%ebp),%edi
+  802082:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802086:	83 c4 1c             	add    $0x1c,%esp
+  802089:	5b                   	pop    %ebx
+  80208a:	5e                   	pop    %esi
+  80208b:	5f                   	pop    %edi
+  80208c:	5d                   	pop    %ebp
+  80208d:	c3                   	ret
+
+0080208e <batch_alloc>:
+{
+  80208e:	55                   	push   %ebp
+  80208f:	89 e5                	mov    %esp,%ebp
+  802091:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802094:	ff 75 18             	push   0x18(%ebp)
+  802097:	ff 75 14             	push   0x14(%ebp)
+  80209a:	ff 75 10             	push   0x10(%ebp)
+  80209d:	ff 75 0c             	push   0xc(%ebp)
+  8020a0:	6a 00                	push   $0x0
+  8020a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020af:	e8 36 ff ff ff       	call   801fea <batch_page>
+}
+  8020b4:	83 c4 20             	add    $0x20,%esp
+  8020b7:	c9                   	leave
+  8020b8:	c3                   	ret
+
+008020b9 <batch_map>:
+{
+  8020b9:	55                   	push   %ebp
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  8020bf:	ff 75 20             	push   0x20(%ebp)
+  8020c2:	ff 75 1c             	push   0x1c(%ebp)
+  8020c5:	ff 75 18             	push   0x18(%ebp)
+  8020c8:	ff 75 14             	push   0x14(%ebp)
+  8020cb:	ff 75 10             	push   0x10(%ebp)
+  8020ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8020d1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d9:	e8 0c ff ff ff       	call   801fea <batch_page>
+}
+  8020de:	83 c4 20             	add    $0x20,%esp
+  8020e1:	c9                   	leave
+  8020e2:	c3                   	ret
+
+008020e3 <batch_unmap>:
+{
+  8020e3:	55                   	push   %ebp
+  8020e4:	89 e5                	mov    %esp,%ebp
+  8020e6:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  8020e9:	ff 75 14             	push   0x14(%ebp)
+  8020ec:	6a 00                	push   $0x0
+  8020ee:	ff 75 10             	push   0x10(%ebp)
+  8020f1:	ff 75 0c             	push   0xc(%ebp)
+  8020f4:	6a 00                	push   $0x0
+  8020f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020fb:	ba 02 00 00 00       	mov    $0x2,%edx
+  802100:	8b 45 08             	mov    0x8(%ebp),%eax
+  802103:	e8 e2 fe ff ff       	call   801fea <batch_page>
+}
+  802108:	83 c4 20             	add    $0x20,%esp
+  80210b:	c9                   	leave
+  80210c:	c3                   	ret
+
+0080210d <batch_set_status>:
+{
+  80210d:	55                   	push   %ebp
+  80210e:	89 e5                	mov    %esp,%ebp
+  802110:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  802113:	8b 45 08             	mov    0x8(%ebp),%eax
+  802116:	e8 87 fe ff ff       	call   801fa2 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  80211b:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  802121:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802124:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  802127:	8b 55 10             	mov    0x10(%ebp),%edx
+  80212a:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  80212d:	c9                   	leave
+  80212e:	c3                   	ret
+
+0080212f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80212f:	55                   	push   %ebp
+  802130:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802132:	8b 45 08             	mov    0x8(%ebp),%eax
+  802135:	05 00 00 00 30       	add    $0x30000000,%eax
+  80213a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80213d:	5d                   	pop    %ebp
+  80213e:	c3                   	ret
+
+0080213f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80213f:	55                   	push   %ebp
+  802140:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802142:	8b 45 08             	mov    0x8(%ebp),%eax
+  802145:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80214a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80214f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802154:	5d                   	pop    %ebp
+  802155:	c3                   	ret
+
+00802156 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802159:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80215e:	eb 02                	jmp    802162 <fd_alloc+0xc>
+  802160:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802162:	89 c2                	mov    %eax,%edx
+  802164:	c1 ea 16             	shr    $0x16,%edx
+  802167:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80216e:	f6 c2 01             	test   $0x1,%dl
+  802171:	74 2b                	je     80219e <fd_alloc+0x48>
+  802173:	89 c2                	mov    %eax,%edx
+  802175:	c1 ea 0c             	shr    $0xc,%edx
+  802178:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80217f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802185:	f6 c1 01             	test   $0x1,%cl
+  802188:	74 14                	je     80219e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80218a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802190:	75 ce                	jne    802160 <fd_alloc+0xa>
+  802192:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802197:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80219c:	eb 05                	jmp    8021a3 <fd_alloc+0x4d>
+			return 0;
+  80219e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8021a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021a6:	89 02                	mov    %eax,(%edx)
+}
+  8021a8:	89 c8                	mov    %ecx,%eax
+  8021aa:	5d                   	pop    %ebp
+  8021ab:	c3                   	ret
+
+008021ac <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8021b2:	83 f8 1f             	cmp    $0x1f,%eax
+  8021b5:	77 30                	ja     8021e7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8021b7:	c1 e0 0c             	shl    $0xc,%eax
+  8021ba:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8021bf:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8021c5:	f6 c2 01             	test   $0x1,%dl
+  8021c8:	74 24                	je     8021ee <fd_lookup+0x42>
+  8021ca:	89 c2                	mov    %eax,%edx
+  8021cc:	c1 ea 0c             	shr    $0xc,%edx
+  8021cf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8021d6:	f6 c2 01             	test   $0x1,%dl
+  8021d9:	74 1a                	je     8021f5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8021db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021de:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8021e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021e5:	5d                   	pop    %ebp
+  8021e6:	c3                   	ret
+		return -E_INVAL;
+  8021e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ec:	eb f7                	jmp    8021e5 <fd_lookup+0x39>
+		return -E_INVAL;
+  8021ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f3:	eb f0                	jmp    8021e5 <fd_lookup+0x39>
+  8021f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021fa:	eb e9                	jmp    8021e5 <fd_lookup+0x39>
+
+008021fc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8021fc:	55                   	push   %ebp
+  8021fd:	89 e5                	mov    %esp,%ebp
+  8021ff:	53                   	push   %ebx
+  802200:	83 ec 04             	sub    $0x4,%esp
+  802203:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220b:	eb 03                	jmp    802210 <dev_lookup+0x14>
+  80220d:	83 c0 01             	add    $0x1,%eax
+  802210:	8b 1c 85 0c 3a 80 00 	mov    0x803a0c(,%eax,4),%ebx
+  802217:	85 db                	test   %ebx,%ebx
+  802219:	74 0b                	je     802226 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80221b:	39 13                	cmp    %edx,(%ebx)
+  80221d:	75 ee                	jne    80220d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80221f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802224:	eb 2e                	jmp    802254 <dev_lookup+0x58>
+  802226:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802228:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80222d:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802233:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802238:	76 24                	jbe    80225e <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80223a:	8b 41 48             	mov    0x48(%ecx),%eax
+  80223d:	83 ec 04             	sub    $0x4,%esp
+  802240:	52                   	push   %edx
+  802241:	50                   	push   %eax
+  802242:	68 90 39 80 00       	push   $0x803990
+  802247:	e8 a5 e0 ff ff       	call   8002f1 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80224c:	83 c4 10             	add    $0x10,%esp
+  80224f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802254:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802257:	89 1a                	mov    %ebx,(%edx)
+}
+  802259:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225c:	c9                   	leave
+  80225d:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80225e:	c1 e8 10             	shr    $0x10,%eax
+  802261:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802267:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80226d:	eb cb                	jmp    80223a <dev_lookup+0x3e>
+
+0080226f <fd_close>:
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	57                   	push   %edi
+  802273:	56                   	push   %esi
+  802274:	53                   	push   %ebx
+  802275:	83 ec 24             	sub    $0x24,%esp
+  802278:	8b 75 08             	mov    0x8(%ebp),%esi
+  80227b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80227e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802281:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802282:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802288:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80228b:	50                   	push   %eax
+  80228c:	e8 1b ff ff ff       	call   8021ac <fd_lookup>
+  802291:	89 c3                	mov    %eax,%ebx
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	85 c0                	test   %eax,%eax
+  802298:	78 05                	js     80229f <fd_close+0x30>
+	    || fd != fd2)
+  80229a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80229d:	74 16                	je     8022b5 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80229f:	89 f8                	mov    %edi,%eax
+  8022a1:	84 c0                	test   %al,%al
+  8022a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8022ab:	89 d8                	mov    %ebx,%eax
+  8022ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022b0:	5b                   	pop    %ebx
+  8022b1:	5e                   	pop    %esi
+  8022b2:	5f                   	pop    %edi
+  8022b3:	5d                   	pop    %ebp
+  8022b4:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8022b5:	83 ec 08             	sub    $0x8,%esp
+  8022b8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8022bb:	50                   	push   %eax
+  8022bc:	ff 36                	push   (%esi)
+  8022be:	e8 39 ff ff ff       	call   8021fc <dev_lookup>
+  8022c3:	89 c3                	mov    %eax,%ebx
+  8022c5:	83 c4 10             	add    $0x10,%esp
+  8022c8:	85 c0                	test   %eax,%eax
+  8022ca:	78 1a                	js     8022e6 <fd_close+0x77>
+		if (dev->dev_close)
+  8022cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8022cf:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8022d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	74 0b                	je     8022e6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	56                   	push   %esi
+  8022df:	ff d0                	call   *%eax
+  8022e1:	89 c3                	mov    %eax,%ebx
+  8022e3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8022e6:	83 ec 08             	sub    $0x8,%esp
+  8022e9:	56                   	push   %esi
+  8022ea:	6a 00                	push   $0x0
+  8022ec:	e8 1b ec ff ff       	call   800f0c <sys_page_unmap>
+	return r;
+  8022f1:	83 c4 10             	add    $0x10,%esp
+  8022f4:	eb b5                	jmp    8022ab <fd_close+0x3c>
+
+008022f6 <close>:
+
+int
+close(int fdnum)
+{
+  8022f6:	55                   	push   %ebp
+  8022f7:	89 e5                	mov    %esp,%ebp
+  8022f9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ff:	50                   	push   %eax
+  802300:	ff 75 08             	push   0x8(%ebp)
+  802303:	e8 a4 fe ff ff       	call   8021ac <fd_lookup>
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	79 02                	jns    802311 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80230f:	c9                   	leave
+  802310:	c3                   	ret
+		return fd_close(fd, 1);
+  802311:	83 ec 08             	sub    $0x8,%esp
+  802314:	6a 01                	push   $0x1
+  802316:	ff 75 f4             	push   -0xc(%ebp)
+  802319:	e8 51 ff ff ff       	call   80226f <fd_close>
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	eb ec                	jmp    80230f <close+0x19>
+
+00802323 <close_all>:
+
+void
+close_all(void)
+{
+  802323:	55                   	push   %ebp
+  802324:	89 e5                	mov    %esp,%ebp
+  802326:	53                   	push   %ebx
+  802327:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80232a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80232f:	83 ec 0c             	sub    $0xc,%esp
+  802332:	53                   	push   %ebx
+  802333:	e8 be ff ff ff       	call   8022f6 <close>
+	for (i = 0; i < MAXFD; i++)
+  802338:	83 c3 01             	add    $0x1,%ebx
+  80233b:	83 c4 10             	add    $0x10,%esp
+  80233e:	83 fb 20             	cmp    $0x20,%ebx
+  802341:	75 ec                	jne    80232f <close_all+0xc>
+}
+  802343:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802346:	c9                   	leave
+  802347:	c3                   	ret
+
+00802348 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802348:	55                   	push   %ebp
+  802349:	89 e5                	mov    %esp,%ebp
+  80234b:	57                   	push   %edi
+  80234c:	56                   	push   %esi
+  80234d:	53                   	push   %ebx
+  80234e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802351:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802354:	50                   	push   %eax
+  802355:	ff 75 08             	push   0x8(%ebp)
+  802358:	e8 4f fe ff ff       	call   8021ac <fd_lookup>
+  80235d:	89 c3                	mov    %eax,%ebx
+  80235f:	83 c4 10             	add    $0x10,%esp
+  802362:	85 c0                	test   %eax,%eax
+  802364:	78 7f                	js     8023e5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802366:	83 ec 0c             	sub    $0xc,%esp
+  802369:	ff 75 0c             	push   0xc(%ebp)
+  80236c:	e8 85 ff ff ff       	call   8022f6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802371:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802374:	c1 e6 0c             	shl    $0xc,%esi
+  802377:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80237d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802380:	89 3c 24             	mov    %edi,(%esp)
+  802383:	e8 b7 fd ff ff       	call   80213f <fd2data>
+  802388:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80238a:	89 34 24             	mov    %esi,(%esp)
+  80238d:	e8 ad fd ff ff       	call   80213f <fd2data>
+  802392:	83 c4 10             	add    $0x10,%esp
+  802395:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802398:	89 d8                	mov    %ebx,%eax
+  80239a:	c1 e8 16             	shr    $0x16,%eax
+  80239d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8023a4:	a8 01                	test   $0x1,%al
+  8023a6:	74 11                	je     8023b9 <dup+0x71>
+  8023a8:	89 d8                	mov    %ebx,%eax
+  8023aa:	c1 e8 0c             	shr    $0xc,%eax
+  8023ad:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8023b4:	f6 c2 01             	test   $0x1,%dl
+  8023b7:	75 36                	jne    8023ef <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8023b9:	89 f8                	mov    %edi,%eax
+  8023bb:	c1 e8 0c             	shr    $0xc,%eax
+  8023be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8023c5:	83 ec 0c             	sub    $0xc,%esp
+  8023c8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023cd:	50                   	push   %eax
+  8023ce:	56                   	push   %esi
+  8023cf:	6a 00                	push   $0x0
+  8023d1:	57                   	push   %edi
+  8023d2:	6a 00                	push   $0x0
+  8023d4:	e8 c5 ea ff ff       	call   800e9e <sys_page_map>
+  8023d9:	89 c3                	mov    %eax,%ebx
+  8023db:	83 c4 20             	add    $0x20,%esp
+  8023de:	85 c0                	test   %eax,%eax
+  8023e0:	78 33                	js     802415 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8023e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8023e5:	89 d8                	mov    %ebx,%eax
+  8023e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ea:	5b                   	pop    %ebx
+  8023eb:	5e                   	pop    %esi
+  8023ec:	5f                   	pop    %edi
+  8023ed:	5d                   	pop    %ebp
+  8023ee:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8023ef:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8023f6:	83 ec 0c             	sub    $0xc,%esp
+  8023f9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023fe:	50                   	push   %eax
+  8023ff:	ff 75 d4             	push   -0x2c(%ebp)
+  802402:	6a 00                	push   $0x0
+  802404:	53                   	push   %ebx
+  802405:	6a 00                	push   $0x0
+  802407:	e8 92 ea ff ff       	call   800e9e <sys_page_map>
+  80240c:	89 c3                	mov    %eax,%ebx
+  80240e:	83 c4 20             	add    $0x20,%esp
+  802411:	85 c0                	test   %eax,%eax
+  802413:	79 a4                	jns    8023b9 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802415:	83 ec 08             	sub    $0x8,%esp
+  802418:	56                   	push   %esi
+  802419:	6a 00                	push   $0x0
+  80241b:	e8 ec ea ff ff       	call   800f0c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802420:	83 c4 08             	add    $0x8,%esp
+  802423:	ff 75 d4             	push   -0x2c(%ebp)
+  802426:	6a 00                	push   $0x0
+  802428:	e8 df ea ff ff       	call   800f0c <sys_page_unmap>
+	return r;
+  80242d:	83 c4 10             	add    $0x10,%esp
+  802430:	eb b3                	jmp    8023e5 <dup+0x9d>
+
+00802432 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802432:	55                   	push   %ebp
+  802433:	89 e5                	mov    %esp,%ebp
+  802435:	56                   	push   %esi
+  802436:	53                   	push   %ebx
+  802437:	83 ec 18             	sub    $0x18,%esp
+  80243a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80243d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802440:	50                   	push   %eax
+  802441:	53                   	push   %ebx
+  802442:	e8 65 fd ff ff       	call   8021ac <fd_lookup>
+  802447:	83 c4 10             	add    $0x10,%esp
+  80244a:	85 c0                	test   %eax,%eax
+  80244c:	78 3c                	js     80248a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80244e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802451:	83 ec 08             	sub    $0x8,%esp
+  802454:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802457:	50                   	push   %eax
+  802458:	ff 36                	push   (%esi)
+  80245a:	e8 9d fd ff ff       	call   8021fc <dev_lookup>
+  80245f:	83 c4 10             	add    $0x10,%esp
+  802462:	85 c0                	test   %eax,%eax
+  802464:	78 24                	js     80248a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802466:	8b 46 08             	mov    0x8(%esi),%eax
+  802469:	83 e0 03             	and    $0x3,%eax
+  80246c:	83 f8 01             	cmp    $0x1,%eax
+  80246f:	74 20                	je     802491 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802471:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802474:	8b 40 08             	mov    0x8(%eax),%eax
+  802477:	85 c0                	test   %eax,%eax
+  802479:	74 57                	je     8024d2 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80247b:	83 ec 04             	sub    $0x4,%esp
+  80247e:	ff 75 10             	push   0x10(%ebp)
+  802481:	ff 75 0c             	push   0xc(%ebp)
+  802484:	56                   	push   %esi
+  802485:	ff d0                	call   *%eax
+  802487:	83 c4 10             	add    $0x10,%esp
+}
+  80248a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80248d:	5b                   	pop    %ebx
+  80248e:	5e                   	pop    %esi
+  80248f:	5d                   	pop    %ebp
+  802490:	c3                   	ret
+  802491:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802493:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802498:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80249e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8024a3:	76 1c                	jbe    8024c1 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024a5:	8b 42 48             	mov    0x48(%edx),%eax
+  8024a8:	83 ec 04             	sub    $0x4,%esp
+  8024ab:	53                   	push   %ebx
+  8024ac:	50                   	push   %eax
+  8024ad:	68 d1 39 80 00       	push   $0x8039d1
+  8024b2:	e8 3a de ff ff       	call   8002f1 <cprintf>
+		return -E_INVAL;
+  8024b7:	83 c4 10             	add    $0x10,%esp
+  8024ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024bf:	eb c9                	jmp    80248a <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8024c1:	c1 e8 10             	shr    $0x10,%eax
+  8024c4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8024ca:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8024d0:	eb d3                	jmp    8024a5 <read+0x73>
+		return -E_NOT_SUPP;
+  8024d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024d7:	eb b1                	jmp    80248a <read+0x58>
+
+008024d9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8024d9:	55                   	push   %ebp
+  8024da:	89 e5                	mov    %esp,%ebp
+  8024dc:	57                   	push   %edi
+  8024dd:	56                   	push   %esi
+  8024de:	53                   	push   %ebx
+  8024df:	83 ec 0c             	sub    $0xc,%esp
+  8024e2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024e5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8024e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024ed:	eb 02                	jmp    8024f1 <readn+0x18>
+  8024ef:	01 c3                	add    %eax,%ebx
+  8024f1:	39 f3                	cmp    %esi,%ebx
+  8024f3:	73 21                	jae    802516 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8024f5:	83 ec 04             	sub    $0x4,%esp
+  8024f8:	89 f0                	mov    %esi,%eax
+  8024fa:	29 d8                	sub    %ebx,%eax
+  8024fc:	50                   	push   %eax
+  8024fd:	89 d8                	mov    %ebx,%eax
+  8024ff:	03 45 0c             	add    0xc(%ebp),%eax
+  802502:	50                   	push   %eax
+  802503:	57                   	push   %edi
+  802504:	e8 29 ff ff ff       	call   802432 <read>
+		if (m < 0)
+  802509:	83 c4 10             	add    $0x10,%esp
+  80250c:	85 c0                	test   %eax,%eax
+  80250e:	78 04                	js     802514 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802510:	75 dd                	jne    8024ef <readn+0x16>
+  802512:	eb 02                	jmp    802516 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802514:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802516:	89 d8                	mov    %ebx,%eax
+  802518:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80251b:	5b                   	pop    %ebx
+  80251c:	5e                   	pop    %esi
+  80251d:	5f                   	pop    %edi
+  80251e:	5d                   	pop    %ebp
+  80251f:	c3                   	ret
+
+00802520 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802520:	55                   	push   %ebp
+  802521:	89 e5                	mov    %esp,%ebp
+  802523:	56                   	push   %esi
+  802524:	53                   	push   %ebx
+  802525:	83 ec 18             	sub    $0x18,%esp
+  802528:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80252b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80252e:	50                   	push   %eax
+  80252f:	53                   	push   %ebx
+  802530:	e8 77 fc ff ff       	call   8021ac <fd_lookup>
+  802535:	83 c4 10             	add    $0x10,%esp
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	78 37                	js     802573 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80253c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80253f:	83 ec 08             	sub    $0x8,%esp
+  802542:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802545:	50                   	push   %eax
+  802546:	ff 36                	push   (%esi)
+  802548:	e8 af fc ff ff       	call   8021fc <dev_lookup>
+  80254d:	83 c4 10             	add    $0x10,%esp
+  802550:	85 c0                	test   %eax,%eax
+  802552:	78 1f                	js     802573 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802554:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802558:	74 20                	je     80257a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80255a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80255d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802560:	85 c0                	test   %eax,%eax
+  802562:	74 57                	je     8025bb <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802564:	83 ec 04             	sub    $0x4,%esp
+  802567:	ff 75 10             	push   0x10(%ebp)
+  80256a:	ff 75 0c             	push   0xc(%ebp)
+  80256d:	56                   	push   %esi
+  80256e:	ff d0                	call   *%eax
+  802570:	83 c4 10             	add    $0x10,%esp
+}
+  802573:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802576:	5b                   	pop    %ebx
+  802577:	5e                   	pop    %esi
+  802578:	5d                   	pop    %ebp
+  802579:	c3                   	ret
+  80257a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80257c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802581:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802587:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80258c:	76 1c                	jbe    8025aa <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80258e:	8b 42 48             	mov    0x48(%edx),%eax
+  802591:	83 ec 04             	sub    $0x4,%esp
+  802594:	53                   	push   %ebx
+  802595:	50                   	push   %eax
+  802596:	68 ed 39 80 00       	push   $0x8039ed
+  80259b:	e8 51 dd ff ff       	call   8002f1 <cprintf>
+		return -E_INVAL;
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025a8:	eb c9                	jmp    802573 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025aa:	c1 e8 10             	shr    $0x10,%eax
+  8025ad:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025b3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025b9:	eb d3                	jmp    80258e <write+0x6e>
+		return -E_NOT_SUPP;
+  8025bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025c0:	eb b1                	jmp    802573 <write+0x53>
+
+008025c2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8025c2:	55                   	push   %ebp
+  8025c3:	89 e5                	mov    %esp,%ebp
+  8025c5:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025cb:	50                   	push   %eax
+  8025cc:	ff 75 08             	push   0x8(%ebp)
+  8025cf:	e8 d8 fb ff ff       	call   8021ac <fd_lookup>
+  8025d4:	83 c4 10             	add    $0x10,%esp
+  8025d7:	85 c0                	test   %eax,%eax
+  8025d9:	78 0e                	js     8025e9 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8025db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e1:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8025e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e9:	c9                   	leave
+  8025ea:	c3                   	ret
+
+008025eb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8025eb:	55                   	push   %ebp
+  8025ec:	89 e5                	mov    %esp,%ebp
+  8025ee:	56                   	push   %esi
+  8025ef:	53                   	push   %ebx
+  8025f0:	83 ec 18             	sub    $0x18,%esp
+  8025f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025f6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025f9:	50                   	push   %eax
+  8025fa:	53                   	push   %ebx
+  8025fb:	e8 ac fb ff ff       	call   8021ac <fd_lookup>
+  802600:	83 c4 10             	add    $0x10,%esp
+  802603:	85 c0                	test   %eax,%eax
+  802605:	78 34                	js     80263b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802607:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80260a:	83 ec 08             	sub    $0x8,%esp
+  80260d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802610:	50                   	push   %eax
+  802611:	ff 36                	push   (%esi)
+  802613:	e8 e4 fb ff ff       	call   8021fc <dev_lookup>
+  802618:	83 c4 10             	add    $0x10,%esp
+  80261b:	85 c0                	test   %eax,%eax
+  80261d:	78 1c                	js     80263b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80261f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802623:	74 1d                	je     802642 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802625:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802628:	8b 40 18             	mov    0x18(%eax),%eax
+  80262b:	85 c0                	test   %eax,%eax
+  80262d:	74 54                	je     802683 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80262f:	83 ec 08             	sub    $0x8,%esp
+  802632:	ff 75 0c             	push   0xc(%ebp)
+  802635:	56                   	push   %esi
+  802636:	ff d0                	call   *%eax
+  802638:	83 c4 10             	add    $0x10,%esp
+}
+  80263b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80263e:	5b                   	pop    %ebx
+  80263f:	5e                   	pop    %esi
+  802640:	5d                   	pop    %ebp
+  802641:	c3                   	ret
+  802642:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802644:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802649:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80264f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802654:	76 1c                	jbe    802672 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802656:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802659:	83 ec 04             	sub    $0x4,%esp
+  80265c:	53                   	push   %ebx
+  80265d:	50                   	push   %eax
+  80265e:	68 b0 39 80 00       	push   $0x8039b0
+  802663:	e8 89 dc ff ff       	call   8002f1 <cprintf>
+		return -E_INVAL;
+  802668:	83 c4 10             	add    $0x10,%esp
+  80266b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802670:	eb c9                	jmp    80263b <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802672:	c1 e8 10             	shr    $0x10,%eax
+  802675:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80267b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802681:	eb d3                	jmp    802656 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802683:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802688:	eb b1                	jmp    80263b <ftruncate+0x50>
+
+0080268a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80268a:	55                   	push   %ebp
+  80268b:	89 e5                	mov    %esp,%ebp
+  80268d:	56                   	push   %esi
+  80268e:	53                   	push   %ebx
+  80268f:	83 ec 18             	sub    $0x18,%esp
+  802692:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802695:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802698:	50                   	push   %eax
+  802699:	ff 75 08             	push   0x8(%ebp)
+  80269c:	e8 0b fb ff ff       	call   8021ac <fd_lookup>
+  8026a1:	83 c4 10             	add    $0x10,%esp
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	78 49                	js     8026f1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026a8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026ab:	83 ec 08             	sub    $0x8,%esp
+  8026ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b1:	50                   	push   %eax
+  8026b2:	ff 36                	push   (%esi)
+  8026b4:	e8 43 fb ff ff       	call   8021fc <dev_lookup>
+  8026b9:	83 c4 10             	add    $0x10,%esp
+  8026bc:	85 c0                	test   %eax,%eax
+  8026be:	78 31                	js     8026f1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8026c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026c3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8026c7:	74 2f                	je     8026f8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8026c9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8026cc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8026d3:	00 00 00 
+	stat->st_isdir = 0;
+  8026d6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026dd:	00 00 00 
+	stat->st_dev = dev;
+  8026e0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8026e6:	83 ec 08             	sub    $0x8,%esp
+  8026e9:	53                   	push   %ebx
+  8026ea:	56                   	push   %esi
+  8026eb:	ff 50 14             	call   *0x14(%eax)
+  8026ee:	83 c4 10             	add    $0x10,%esp
+}
+  8026f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026f4:	5b                   	pop    %ebx
+  8026f5:	5e                   	pop    %esi
+  8026f6:	5d                   	pop    %ebp
+  8026f7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026f8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026fd:	eb f2                	jmp    8026f1 <fstat+0x67>
+
+008026ff <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8026ff:	55                   	push   %ebp
+  802700:	89 e5                	mov    %esp,%ebp
+  802702:	56                   	push   %esi
+  802703:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802704:	83 ec 08             	sub    $0x8,%esp
+  802707:	6a 00                	push   $0x0
+  802709:	ff 75 08             	push   0x8(%ebp)
+  80270c:	e8 e4 01 00 00       	call   8028f5 <open>
+  802711:	89 c3                	mov    %eax,%ebx
+  802713:	83 c4 10             	add    $0x10,%esp
+  802716:	85 c0                	test   %eax,%eax
+  802718:	78 1b                	js     802735 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80271a:	83 ec 08             	sub    $0x8,%esp
+  80271d:	ff 75 0c             	push   0xc(%ebp)
+  802720:	50                   	push   %eax
+  802721:	e8 64 ff ff ff       	call   80268a <fstat>
+  802726:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802728:	89 1c 24             	mov    %ebx,(%esp)
+  80272b:	e8 c6 fb ff ff       	call   8022f6 <close>
+	return r;
+  802730:	83 c4 10             	add    $0x10,%esp
+  802733:	89 f3                	mov    %esi,%ebx
+}
+  802735:	89 d8                	mov    %ebx,%eax
+  802737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80273a:	5b                   	pop    %ebx
+  80273b:	5e                   	pop    %esi
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+
+0080273e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80273e:	55                   	push   %ebp
+  80273f:	89 e5                	mov    %esp,%ebp
+  802741:	56                   	push   %esi
+  802742:	53                   	push   %ebx
+  802743:	89 c6                	mov    %eax,%esi
+  802745:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802747:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80274e:	74 27                	je     802777 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802750:	6a 07                	push   $0x7
+  802752:	68 00 60 80 00       	push   $0x806000
+  802757:	56                   	push   %esi
+  802758:	ff 35 00 50 80 00    	push   0x805000
+  80275e:	e8 17 f7 ff ff       	call   801e7a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802763:	83 c4 0c             	add    $0xc,%esp
+  802766:	6a 00                	push   $0x0
+  802768:	53                   	push   %ebx
+  802769:	6a 00                	push   $0x0
+  80276b:	e8 f2 f6 ff ff       	call   801e62 <ipc_recv>
+}
+  802770:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802773:	5b                   	pop    %ebx
+  802774:	5e                   	pop    %esi
+  802775:	5d                   	pop    %ebp
+  802776:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802777:	83 ec 0c             	sub    $0xc,%esp
+  80277a:	6a 01                	push   $0x1
+  80277c:	e8 4d f7 ff ff       	call   801ece <ipc_find_env>
+  802781:	a3 00 50 80 00       	mov    %eax,0x805000
+  802786:	83 c4 10             	add    $0x10,%esp
+  802789:	eb c5                	jmp    802750 <fsipc+0x12>
+
+0080278b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80278b:	55                   	push   %ebp
+  80278c:	89 e5                	mov    %esp,%ebp
+  80278e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802791:	8b 45 08             	mov    0x8(%ebp),%eax
+  802794:	8b 40 0c             	mov    0xc(%eax),%eax
+  802797:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80279c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80279f:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8027a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8027ae:	e8 8b ff ff ff       	call   80273e <fsipc>
+}
+  8027b3:	c9                   	leave
+  8027b4:	c3                   	ret
+
+008027b5 <devfile_flush>:
+{
+  8027b5:	55                   	push   %ebp
+  8027b6:	89 e5                	mov    %esp,%ebp
+  8027b8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027c1:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8027c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027cb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8027d0:	e8 69 ff ff ff       	call   80273e <fsipc>
+}
+  8027d5:	c9                   	leave
+  8027d6:	c3                   	ret
+
+008027d7 <devfile_stat>:
+{
+  8027d7:	55                   	push   %ebp
+  8027d8:	89 e5                	mov    %esp,%ebp
+  8027da:	53                   	push   %ebx
+  8027db:	83 ec 04             	sub    $0x4,%esp
+  8027de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027e7:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8027ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027f6:	e8 43 ff ff ff       	call   80273e <fsipc>
+  8027fb:	85 c0                	test   %eax,%eax
+  8027fd:	78 2c                	js     80282b <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8027ff:	83 ec 08             	sub    $0x8,%esp
+  802802:	68 00 60 80 00       	push   $0x806000
+  802807:	53                   	push   %ebx
+  802808:	e8 2c e1 ff ff       	call   800939 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80280d:	a1 80 60 80 00       	mov    0x806080,%eax
+  802812:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802818:	a1 84 60 80 00       	mov    0x806084,%eax
+  80281d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802823:	83 c4 10             	add    $0x10,%esp
+  802826:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80282b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80282e:	c9                   	leave
+  80282f:	c3                   	ret
+
+00802830 <devfile_write>:
+{
+  802830:	55                   	push   %ebp
+  802831:	89 e5                	mov    %esp,%ebp
+  802833:	83 ec 0c             	sub    $0xc,%esp
+  802836:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802839:	8b 55 08             	mov    0x8(%ebp),%edx
+  80283c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80283f:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802845:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80284a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80284f:	39 d0                	cmp    %edx,%eax
+  802851:	0f 47 c2             	cmova  %edx,%eax
+  802854:	50                   	push   %eax
+  802855:	ff 75 0c             	push   0xc(%ebp)
+  802858:	68 08 60 80 00       	push   $0x806008
+  80285d:	e8 5d e2 ff ff       	call   800abf <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802862:	ba 00 00 00 00       	mov    $0x0,%edx
+  802867:	b8 04 00 00 00       	mov    $0x4,%eax
+  80286c:	e8 cd fe ff ff       	call   80273e <fsipc>
+}
+  802871:	c9                   	leave
+  802872:	c3                   	ret
+
+00802873 <devfile_read>:
+{
+  802873:	55                   	push   %ebp
+  802874:	89 e5                	mov    %esp,%ebp
+  802876:	56                   	push   %esi
+  802877:	53                   	push   %ebx
+  802878:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80287b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802881:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802886:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80288c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802891:	b8 03 00 00 00       	mov    $0x3,%eax
+  802896:	e8 a3 fe ff ff       	call   80273e <fsipc>
+  80289b:	89 c3                	mov    %eax,%ebx
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	78 1f                	js     8028c0 <devfile_read+0x4d>
+	assert(r <= n);
+  8028a1:	39 c6                	cmp    %eax,%esi
+  8028a3:	72 24                	jb     8028c9 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8028a5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8028aa:	7f 33                	jg     8028df <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8028ac:	83 ec 04             	sub    $0x4,%esp
+  8028af:	50                   	push   %eax
+  8028b0:	68 00 60 80 00       	push   $0x806000
+  8028b5:	ff 75 0c             	push   0xc(%ebp)
+  8028b8:	e8 02 e2 ff ff       	call   800abf <memmove>
+	return r;
+  8028bd:	83 c4 10             	add    $0x10,%esp
+}
+  8028c0:	89 d8                	mov    %ebx,%eax
+  8028c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c5:	5b                   	pop    %ebx
+  8028c6:	5e                   	pop    %esi
+  8028c7:	5d                   	pop    %ebp
+  8028c8:	c3                   	ret
+	assert(r <= n);
+  8028c9:	68 20 3a 80 00       	push   $0x803a20
+  8028ce:	68 f0 38 80 00       	push   $0x8038f0
+  8028d3:	6a 76                	push   $0x76
+  8028d5:	68 27 3a 80 00       	push   $0x803a27
+  8028da:	e8 37 d9 ff ff       	call   800216 <_panic>
+	assert(r <= PGSIZE);
+  8028df:	68 32 3a 80 00       	push   $0x803a32
+  8028e4:	68 f0 38 80 00       	push   $0x8038f0
+  8028e9:	6a 77                	push   $0x77
+  8028eb:	68 27 3a 80 00       	push   $0x803a27
+  8028f0:	e8 21 d9 ff ff       	call   800216 <_panic>
+
+008028f5 <open>:
+{
+  8028f5:	55                   	push   %ebp
+  8028f6:	89 e5                	mov    %esp,%ebp
+  8028f8:	56                   	push   %esi
+  8028f9:	53                   	push   %ebx
+  8028fa:	83 ec 1c             	sub    $0x1c,%esp
+  8028fd:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802900:	56                   	push   %esi
+  802901:	e8 f8 df ff ff       	call   8008fe <strlen>
+  802906:	83 c4 10             	add    $0x10,%esp
+  802909:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80290e:	7f 6c                	jg     80297c <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802910:	83 ec 0c             	sub    $0xc,%esp
+  802913:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802916:	50                   	push   %eax
+  802917:	e8 3a f8 ff ff       	call   802156 <fd_alloc>
+  80291c:	89 c3                	mov    %eax,%ebx
+  80291e:	83 c4 10             	add    $0x10,%esp
+  802921:	85 c0                	test   %eax,%eax
+  802923:	78 3c                	js     802961 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802925:	83 ec 08             	sub    $0x8,%esp
+  802928:	56                   	push   %esi
+  802929:	68 00 60 80 00       	push   $0x806000
+  80292e:	e8 06 e0 ff ff       	call   800939 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802933:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802936:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80293b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80293e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802943:	e8 f6 fd ff ff       	call   80273e <fsipc>
+  802948:	89 c3                	mov    %eax,%ebx
+  80294a:	83 c4 10             	add    $0x10,%esp
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	78 19                	js     80296a <open+0x75>
+	return fd2num(fd);
+  802951:	83 ec 0c             	sub    $0xc,%esp
+  802954:	ff 75 f4             	push   -0xc(%ebp)
+  802957:	e8 d3 f7 ff ff       	call   80212f <fd2num>
+  80295c:	89 c3                	mov    %eax,%ebx
+  80295e:	83 c4 10             	add    $0x10,%esp
+}
+  802961:	89 d8                	mov    %ebx,%eax
+  802963:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802966:	5b                   	pop    %ebx
+  802967:	5e                   	pop    %esi
+  802968:	5d                   	pop    %ebp
+  802969:	c3                   	ret
+		fd_close(fd, 0);
+  80296a:	83 ec 08             	sub    $0x8,%esp
+  80296d:	6a 00                	push   $0x0
+  80296f:	ff 75 f4             	push   -0xc(%ebp)
+  802972:	e8 f8 f8 ff ff       	call   80226f <fd_close>
+		return r;
+  802977:	83 c4 10             	add    $0x10,%esp
+  80297a:	eb e5                	jmp    802961 <open+0x6c>
+		return -E_BAD_PATH;
+  80297c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802981:	eb de                	jmp    802961 <open+0x6c>
+
+00802983 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802989:	ba 00 00 00 00       	mov    $0x0,%edx
+  80298e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802993:	e8 a6 fd ff ff       	call   80273e <fsipc>
+}
+  802998:	c9                   	leave
+  802999:	c3                   	ret
+
+0080299a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80299a:	55                   	push   %ebp
+  80299b:	89 e5                	mov    %esp,%ebp
+  80299d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8029a0:	68 3e 3a 80 00       	push   $0x803a3e
+  8029a5:	ff 75 0c             	push   0xc(%ebp)
+  8029a8:	e8 8c df ff ff       	call   800939 <strcpy>
+	return 0;
+}
+  8029ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b2:	c9                   	leave
+  8029b3:	c3                   	ret
+
+008029b4 <devsock_close>:
+{
+  8029b4:	55                   	push   %ebp
+  8029b5:	89 e5                	mov    %esp,%ebp
+  8029b7:	53                   	push   %ebx
+  8029b8:	83 ec 10             	sub    $0x10,%esp
+  8029bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8029be:	53                   	push   %ebx
+  8029bf:	e8 45 0a 00 00       	call   803409 <pageref>
+  8029c4:	89 c2                	mov    %eax,%edx
+  8029c6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8029c9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8029ce:	83 fa 01             	cmp    $0x1,%edx
+  8029d1:	74 05                	je     8029d8 <devsock_close+0x24>
+}
+  8029d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029d6:	c9                   	leave
+  8029d7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8029d8:	83 ec 0c             	sub    $0xc,%esp
+  8029db:	ff 73 0c             	push   0xc(%ebx)
+  8029de:	e8 b7 02 00 00       	call   802c9a <nsipc_close>
+  8029e3:	83 c4 10             	add    $0x10,%esp
+  8029e6:	eb eb                	jmp    8029d3 <devsock_close+0x1f>
+
+008029e8 <devsock_write>:
+{
+  8029e8:	55                   	push   %ebp
+  8029e9:	89 e5                	mov    %esp,%ebp
+  8029eb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8029ee:	6a 00                	push   $0x0
+  8029f0:	ff 75 10             	push   0x10(%ebp)
+  8029f3:	ff 75 0c             	push   0xc(%ebp)
+  8029f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f9:	ff 70 0c             	push   0xc(%eax)
+  8029fc:	e8 79 03 00 00       	call   802d7a <nsipc_send>
+}
+  802a01:	c9                   	leave
+  802a02:	c3                   	ret
+
+00802a03 <devsock_read>:
+{
+  802a03:	55                   	push   %ebp
+  802a04:	89 e5                	mov    %esp,%ebp
+  802a06:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802a09:	6a 00                	push   $0x0
+  802a0b:	ff 75 10             	push   0x10(%ebp)
+  802a0e:	ff 75 0c             	push   0xc(%ebp)
+  802a11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a14:	ff 70 0c             	push   0xc(%eax)
+  802a17:	e8 ef 02 00 00       	call   802d0b <nsipc_recv>
+}
+  802a1c:	c9                   	leave
+  802a1d:	c3                   	ret
+
+00802a1e <fd2sockid>:
+{
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802a24:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a27:	52                   	push   %edx
+  802a28:	50                   	push   %eax
+  802a29:	e8 7e f7 ff ff       	call   8021ac <fd_lookup>
+  802a2e:	83 c4 10             	add    $0x10,%esp
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	78 10                	js     802a45 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802a35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a38:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a3e:	39 08                	cmp    %ecx,(%eax)
+  802a40:	75 05                	jne    802a47 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802a42:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802a45:	c9                   	leave
+  802a46:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a47:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a4c:	eb f7                	jmp    802a45 <fd2sockid+0x27>
+
+00802a4e <alloc_sockfd>:
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	56                   	push   %esi
+  802a52:	53                   	push   %ebx
+  802a53:	83 ec 1c             	sub    $0x1c,%esp
+  802a56:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802a58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a5b:	50                   	push   %eax
+  802a5c:	e8 f5 f6 ff ff       	call   802156 <fd_alloc>
+  802a61:	89 c3                	mov    %eax,%ebx
+  802a63:	83 c4 10             	add    $0x10,%esp
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	78 43                	js     802aad <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802a6a:	83 ec 04             	sub    $0x4,%esp
+  802a6d:	68 07 04 00 00       	push   $0x407
+  802a72:	ff 75 f4             	push   -0xc(%ebp)
+  802a75:	6a 00                	push   $0x0
+  802a77:	e8 b5 e3 ff ff       	call   800e31 <sys_page_alloc>
+  802a7c:	89 c3                	mov    %eax,%ebx
+  802a7e:	83 c4 10             	add    $0x10,%esp
+  802a81:	85 c0                	test   %eax,%eax
+  802a83:	78 28                	js     802aad <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802a85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a88:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a8e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802a90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a93:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802a9a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802a9d:	83 ec 0c             	sub    $0xc,%esp
+  802aa0:	50                   	push   %eax
+  802aa1:	e8 89 f6 ff ff       	call   80212f <fd2num>
+  802aa6:	89 c3                	mov    %eax,%ebx
+  802aa8:	83 c4 10             	add    $0x10,%esp
+  802aab:	eb 0c                	jmp    802ab9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802aad:	83 ec 0c             	sub    $0xc,%esp
+  802ab0:	56                   	push   %esi
+  802ab1:	e8 e4 01 00 00       	call   802c9a <nsipc_close>
+		return r;
+  802ab6:	83 c4 10             	add    $0x10,%esp
+}
+  802ab9:	89 d8                	mov    %ebx,%eax
+  802abb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802abe:	5b                   	pop    %ebx
+  802abf:	5e                   	pop    %esi
+  802ac0:	5d                   	pop    %ebp
+  802ac1:	c3                   	ret
+
+00802ac2 <accept>:
+{
+  802ac2:	55                   	push   %ebp
+  802ac3:	89 e5                	mov    %esp,%ebp
+  802ac5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ac8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802acb:	e8 4e ff ff ff       	call   802a1e <fd2sockid>
+  802ad0:	85 c0                	test   %eax,%eax
+  802ad2:	78 1b                	js     802aef <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802ad4:	83 ec 04             	sub    $0x4,%esp
+  802ad7:	ff 75 10             	push   0x10(%ebp)
+  802ada:	ff 75 0c             	push   0xc(%ebp)
+  802add:	50                   	push   %eax
+  802ade:	e8 0e 01 00 00       	call   802bf1 <nsipc_accept>
+  802ae3:	83 c4 10             	add    $0x10,%esp
+  802ae6:	85 c0                	test   %eax,%eax
+  802ae8:	78 05                	js     802aef <accept+0x2d>
+	return alloc_sockfd(r);
+  802aea:	e8 5f ff ff ff       	call   802a4e <alloc_sockfd>
+}
+  802aef:	c9                   	leave
+  802af0:	c3                   	ret
+
+00802af1 <bind>:
+{
+  802af1:	55                   	push   %ebp
+  802af2:	89 e5                	mov    %esp,%ebp
+  802af4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802af7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afa:	e8 1f ff ff ff       	call   802a1e <fd2sockid>
+  802aff:	85 c0                	test   %eax,%eax
+  802b01:	78 12                	js     802b15 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802b03:	83 ec 04             	sub    $0x4,%esp
+  802b06:	ff 75 10             	push   0x10(%ebp)
+  802b09:	ff 75 0c             	push   0xc(%ebp)
+  802b0c:	50                   	push   %eax
+  802b0d:	e8 31 01 00 00       	call   802c43 <nsipc_bind>
+  802b12:	83 c4 10             	add    $0x10,%esp
+}
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <shutdown>:
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b20:	e8 f9 fe ff ff       	call   802a1e <fd2sockid>
+  802b25:	85 c0                	test   %eax,%eax
+  802b27:	78 0f                	js     802b38 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802b29:	83 ec 08             	sub    $0x8,%esp
+  802b2c:	ff 75 0c             	push   0xc(%ebp)
+  802b2f:	50                   	push   %eax
+  802b30:	e8 43 01 00 00       	call   802c78 <nsipc_shutdown>
+  802b35:	83 c4 10             	add    $0x10,%esp
+}
+  802b38:	c9                   	leave
+  802b39:	c3                   	ret
+
+00802b3a <connect>:
+{
+  802b3a:	55                   	push   %ebp
+  802b3b:	89 e5                	mov    %esp,%ebp
+  802b3d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b40:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b43:	e8 d6 fe ff ff       	call   802a1e <fd2sockid>
+  802b48:	85 c0                	test   %eax,%eax
+  802b4a:	78 12                	js     802b5e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b4c:	83 ec 04             	sub    $0x4,%esp
+  802b4f:	ff 75 10             	push   0x10(%ebp)
+  802b52:	ff 75 0c             	push   0xc(%ebp)
+  802b55:	50                   	push   %eax
+  802b56:	e8 59 01 00 00       	call   802cb4 <nsipc_connect>
+  802b5b:	83 c4 10             	add    $0x10,%esp
+}
+  802b5e:	c9                   	leave
+  802b5f:	c3                   	ret
+
+00802b60 <listen>:
+{
+  802b60:	55                   	push   %ebp
+  802b61:	89 e5                	mov    %esp,%ebp
+  802b63:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b69:	e8 b0 fe ff ff       	call   802a1e <fd2sockid>
+  802b6e:	85 c0                	test   %eax,%eax
+  802b70:	78 0f                	js     802b81 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802b72:	83 ec 08             	sub    $0x8,%esp
+  802b75:	ff 75 0c             	push   0xc(%ebp)
+  802b78:	50                   	push   %eax
+  802b79:	e8 6b 01 00 00       	call   802ce9 <nsipc_listen>
+  802b7e:	83 c4 10             	add    $0x10,%esp
+}
+  802b81:	c9                   	leave
+  802b82:	c3                   	ret
+
+00802b83 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802b83:	55                   	push   %ebp
+  802b84:	89 e5                	mov    %esp,%ebp
+  802b86:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802b89:	ff 75 10             	push   0x10(%ebp)
+  802b8c:	ff 75 0c             	push   0xc(%ebp)
+  802b8f:	ff 75 08             	push   0x8(%ebp)
+  802b92:	e8 41 02 00 00       	call   802dd8 <nsipc_socket>
+  802b97:	83 c4 10             	add    $0x10,%esp
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	78 05                	js     802ba3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b9e:	e8 ab fe ff ff       	call   802a4e <alloc_sockfd>
+}
+  802ba3:	c9                   	leave
+  802ba4:	c3                   	ret
+
+00802ba5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802ba5:	55                   	push   %ebp
+  802ba6:	89 e5                	mov    %esp,%ebp
+  802ba8:	53                   	push   %ebx
+  802ba9:	83 ec 04             	sub    $0x4,%esp
+  802bac:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802bae:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802bb5:	74 26                	je     802bdd <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802bb7:	6a 07                	push   $0x7
+  802bb9:	68 00 70 80 00       	push   $0x807000
+  802bbe:	53                   	push   %ebx
+  802bbf:	ff 35 04 50 80 00    	push   0x805004
+  802bc5:	e8 b0 f2 ff ff       	call   801e7a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802bca:	83 c4 0c             	add    $0xc,%esp
+  802bcd:	6a 00                	push   $0x0
+  802bcf:	6a 00                	push   $0x0
+  802bd1:	6a 00                	push   $0x0
+  802bd3:	e8 8a f2 ff ff       	call   801e62 <ipc_recv>
+}
+  802bd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bdb:	c9                   	leave
+  802bdc:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bdd:	83 ec 0c             	sub    $0xc,%esp
+  802be0:	6a 02                	push   $0x2
+  802be2:	e8 e7 f2 ff ff       	call   801ece <ipc_find_env>
+  802be7:	a3 04 50 80 00       	mov    %eax,0x805004
+  802bec:	83 c4 10             	add    $0x10,%esp
+  802bef:	eb c6                	jmp    802bb7 <nsipc+0x12>
+
+00802bf1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+  802bf4:	56                   	push   %esi
+  802bf5:	53                   	push   %ebx
+  802bf6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfc:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802c01:	8b 06                	mov    (%esi),%eax
+  802c03:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c08:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c0d:	e8 93 ff ff ff       	call   802ba5 <nsipc>
+  802c12:	89 c3                	mov    %eax,%ebx
+  802c14:	85 c0                	test   %eax,%eax
+  802c16:	79 09                	jns    802c21 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c18:	89 d8                	mov    %ebx,%eax
+  802c1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c1d:	5b                   	pop    %ebx
+  802c1e:	5e                   	pop    %esi
+  802c1f:	5d                   	pop    %ebp
+  802c20:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c21:	83 ec 04             	sub    $0x4,%esp
+  802c24:	ff 35 10 70 80 00    	push   0x807010
+  802c2a:	68 00 70 80 00       	push   $0x807000
+  802c2f:	ff 75 0c             	push   0xc(%ebp)
+  802c32:	e8 88 de ff ff       	call   800abf <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c37:	a1 10 70 80 00       	mov    0x807010,%eax
+  802c3c:	89 06                	mov    %eax,(%esi)
+  802c3e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c41:	eb d5                	jmp    802c18 <nsipc_accept+0x27>
+
+00802c43 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	53                   	push   %ebx
+  802c47:	83 ec 08             	sub    $0x8,%esp
+  802c4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c50:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c55:	53                   	push   %ebx
+  802c56:	ff 75 0c             	push   0xc(%ebp)
+  802c59:	68 04 70 80 00       	push   $0x807004
+  802c5e:	e8 5c de ff ff       	call   800abf <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c63:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802c69:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c6e:	e8 32 ff ff ff       	call   802ba5 <nsipc>
+}
+  802c73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c76:	c9                   	leave
+  802c77:	c3                   	ret
+
+00802c78 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c78:	55                   	push   %ebp
+  802c79:	89 e5                	mov    %esp,%ebp
+  802c7b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c81:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802c86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c89:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c8e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c93:	e8 0d ff ff ff       	call   802ba5 <nsipc>
+}
+  802c98:	c9                   	leave
+  802c99:	c3                   	ret
+
+00802c9a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c9a:	55                   	push   %ebp
+  802c9b:	89 e5                	mov    %esp,%ebp
+  802c9d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca3:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802ca8:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cad:	e8 f3 fe ff ff       	call   802ba5 <nsipc>
+}
+  802cb2:	c9                   	leave
+  802cb3:	c3                   	ret
+
+00802cb4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802cb4:	55                   	push   %ebp
+  802cb5:	89 e5                	mov    %esp,%ebp
+  802cb7:	53                   	push   %ebx
+  802cb8:	83 ec 08             	sub    $0x8,%esp
+  802cbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802cbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc1:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802cc6:	53                   	push   %ebx
+  802cc7:	ff 75 0c             	push   0xc(%ebp)
+  802cca:	68 04 70 80 00       	push   $0x807004
+  802ccf:	e8 eb dd ff ff       	call   800abf <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802cd4:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802cda:	b8 05 00 00 00       	mov    $0x5,%eax
+  802cdf:	e8 c1 fe ff ff       	call   802ba5 <nsipc>
+}
+  802ce4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ce7:	c9                   	leave
+  802ce8:	c3                   	ret
+
+00802ce9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ce9:	55                   	push   %ebp
+  802cea:	89 e5                	mov    %esp,%ebp
+  802cec:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802cef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802cf7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cfa:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802cff:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d04:	e8 9c fe ff ff       	call   802ba5 <nsipc>
+}
+  802d09:	c9                   	leave
+  802d0a:	c3                   	ret
+
+00802d0b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	56                   	push   %esi
+  802d0f:	53                   	push   %ebx
+  802d10:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d16:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802d1b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802d21:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d24:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d29:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d2e:	e8 72 fe ff ff       	call   802ba5 <nsipc>
+  802d33:	89 c3                	mov    %eax,%ebx
+  802d35:	85 c0                	test   %eax,%eax
+  802d37:	78 22                	js     802d5b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d39:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d3e:	39 c6                	cmp    %eax,%esi
+  802d40:	0f 4e c6             	cmovle %esi,%eax
+  802d43:	39 c3                	cmp    %eax,%ebx
+  802d45:	7f 1d                	jg     802d64 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d47:	83 ec 04             	sub    $0x4,%esp
+  802d4a:	53                   	push   %ebx
+  802d4b:	68 00 70 80 00       	push   $0x807000
+  802d50:	ff 75 0c             	push   0xc(%ebp)
+  802d53:	e8 67 dd ff ff       	call   800abf <memmove>
+  802d58:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d5b:	89 d8                	mov    %ebx,%eax
+  802d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d60:	5b                   	pop    %ebx
+  802d61:	5e                   	pop    %esi
+  802d62:	5d                   	pop    %ebp
+  802d63:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d64:	68 4a 3a 80 00       	push   $0x803a4a
+  802d69:	68 f0 38 80 00       	push   $0x8038f0
+  802d6e:	6a 62                	push   $0x62
+  802d70:	68 5f 3a 80 00       	push   $0x803a5f
+  802d75:	e8 9c d4 ff ff       	call   800216 <_panic>
+
+00802d7a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d7a:	55                   	push   %ebp
+  802d7b:	89 e5                	mov    %esp,%ebp
+  802d7d:	53                   	push   %ebx
+  802d7e:	83 ec 04             	sub    $0x4,%esp
+  802d81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d84:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d87:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802d8c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d92:	7f 2e                	jg     802dc2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d94:	83 ec 04             	sub    $0x4,%esp
+  802d97:	53                   	push   %ebx
+  802d98:	ff 75 0c             	push   0xc(%ebp)
+  802d9b:	68 0c 70 80 00       	push   $0x80700c
+  802da0:	e8 1a dd ff ff       	call   800abf <memmove>
+	nsipcbuf.send.req_size = size;
+  802da5:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802dab:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dae:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802db3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802db8:	e8 e8 fd ff ff       	call   802ba5 <nsipc>
+}
+  802dbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc0:	c9                   	leave
+  802dc1:	c3                   	ret
+	assert(size < 1600);
+  802dc2:	68 6b 3a 80 00       	push   $0x803a6b
+  802dc7:	68 f0 38 80 00       	push   $0x8038f0
+  802dcc:	6a 6d                	push   $0x6d
+  802dce:	68 5f 3a 80 00       	push   $0x803a5f
+  802dd3:	e8 3e d4 ff ff       	call   800216 <_panic>
+
+00802dd8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802dde:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802de6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802de9:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802dee:	8b 45 10             	mov    0x10(%ebp),%eax
+  802df1:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802df6:	b8 09 00 00 00       	mov    $0x9,%eax
+  802dfb:	e8 a5 fd ff ff       	call   802ba5 <nsipc>
+}
+  802e00:	c9                   	leave
+  802e01:	c3                   	ret
+
+00802e02 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e02:	55                   	push   %ebp
+  802e03:	89 e5                	mov    %esp,%ebp
+  802e05:	56                   	push   %esi
+  802e06:	53                   	push   %ebx
+  802e07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e0a:	83 ec 0c             	sub    $0xc,%esp
+  802e0d:	ff 75 08             	push   0x8(%ebp)
+  802e10:	e8 2a f3 ff ff       	call   80213f <fd2data>
+  802e15:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e17:	83 c4 08             	add    $0x8,%esp
+  802e1a:	68 77 3a 80 00       	push   $0x803a77
+  802e1f:	53                   	push   %ebx
+  802e20:	e8 14 db ff ff       	call   800939 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e25:	8b 46 04             	mov    0x4(%esi),%eax
+  802e28:	2b 06                	sub    (%esi),%eax
+  802e2a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e30:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e37:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e3a:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802e41:	40 80 00 
+	return 0;
+}
+  802e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e4c:	5b                   	pop    %ebx
+  802e4d:	5e                   	pop    %esi
+  802e4e:	5d                   	pop    %ebp
+  802e4f:	c3                   	ret
+
+00802e50 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e50:	55                   	push   %ebp
+  802e51:	89 e5                	mov    %esp,%ebp
+  802e53:	53                   	push   %ebx
+  802e54:	83 ec 0c             	sub    $0xc,%esp
+  802e57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e5a:	53                   	push   %ebx
+  802e5b:	6a 00                	push   $0x0
+  802e5d:	e8 aa e0 ff ff       	call   800f0c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e62:	89 1c 24             	mov    %ebx,(%esp)
+  802e65:	e8 d5 f2 ff ff       	call   80213f <fd2data>
+  802e6a:	83 c4 08             	add    $0x8,%esp
+  802e6d:	50                   	push   %eax
+  802e6e:	6a 00                	push   $0x0
+  802e70:	e8 97 e0 ff ff       	call   800f0c <sys_page_unmap>
+}
+  802e75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e78:	c9                   	leave
+  802e79:	c3                   	ret
+
+00802e7a <_pipeisclosed>:
+{
+  802e7a:	55                   	push   %ebp
+  802e7b:	89 e5                	mov    %esp,%ebp
+  802e7d:	57                   	push   %edi
+  802e7e:	56                   	push   %esi
+  802e7f:	53                   	push   %ebx
+  802e80:	83 ec 1c             	sub    $0x1c,%esp
+  802e83:	89 c7                	mov    %eax,%edi
+  802e85:	89 d6                	mov    %edx,%esi
+  802e87:	eb 3c                	jmp    802ec5 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802e89:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e8c:	83 ec 0c             	sub    $0xc,%esp
+  802e8f:	57                   	push   %edi
+  802e90:	e8 74 05 00 00       	call   803409 <pageref>
+  802e95:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e98:	89 34 24             	mov    %esi,(%esp)
+  802e9b:	e8 69 05 00 00       	call   803409 <pageref>
+  802ea0:	89 c2                	mov    %eax,%edx
+  802ea2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ea4:	05 00 00 00 20       	add    $0x20000000,%eax
+  802ea9:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802eac:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802eb2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802eb7:	76 31                	jbe    802eea <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802eb9:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802ebc:	39 c3                	cmp    %eax,%ebx
+  802ebe:	74 76                	je     802f36 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802ec0:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802ec3:	74 36                	je     802efb <_pipeisclosed+0x81>
+  802ec5:	89 e0                	mov    %esp,%eax
+  802ec7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ecc:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ed2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ed7:	77 b0                	ja     802e89 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ed9:	c1 e8 10             	shr    $0x10,%eax
+  802edc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ee2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ee8:	eb 9f                	jmp    802e89 <_pipeisclosed+0xf>
+  802eea:	c1 e8 10             	shr    $0x10,%eax
+  802eed:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ef3:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802ef9:	eb be                	jmp    802eb9 <_pipeisclosed+0x3f>
+  802efb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802efd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f02:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f08:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f0d:	76 16                	jbe    802f25 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f0f:	8b 42 58             	mov    0x58(%edx),%eax
+  802f12:	6a 01                	push   $0x1
+  802f14:	50                   	push   %eax
+  802f15:	53                   	push   %ebx
+  802f16:	68 7e 3a 80 00       	push   $0x803a7e
+  802f1b:	e8 d1 d3 ff ff       	call   8002f1 <cprintf>
+  802f20:	83 c4 10             	add    $0x10,%esp
+  802f23:	eb a0                	jmp    802ec5 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f25:	c1 e8 10             	shr    $0x10,%eax
+  802f28:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f2e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f34:	eb d9                	jmp    802f0f <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802f36:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f39:	0f 94 c0             	sete   %al
+  802f3c:	0f b6 c0             	movzbl %al,%eax
+}
+  802f3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f42:	5b                   	pop    %ebx
+  802f43:	5e                   	pop    %esi
+  802f44:	5f                   	pop    %edi
+  802f45:	5d                   	pop    %ebp
+  802f46:	c3                   	ret
+
+00802f47 <devpipe_write>:
+{
+  802f47:	55                   	push   %ebp
+  802f48:	89 e5                	mov    %esp,%ebp
+  802f4a:	57                   	push   %edi
+  802f4b:	56                   	push   %esi
+  802f4c:	53                   	push   %ebx
+  802f4d:	83 ec 28             	sub    $0x28,%esp
+  802f50:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802f53:	56                   	push   %esi
+  802f54:	e8 e6 f1 ff ff       	call   80213f <fd2data>
+  802f59:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f5b:	83 c4 10             	add    $0x10,%esp
+  802f5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f63:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802f66:	75 09                	jne    802f71 <devpipe_write+0x2a>
+	return i;
+  802f68:	89 f8                	mov    %edi,%eax
+  802f6a:	eb 23                	jmp    802f8f <devpipe_write+0x48>
+			sys_yield();
+  802f6c:	e8 7a de ff ff       	call   800deb <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f71:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f74:	8b 0b                	mov    (%ebx),%ecx
+  802f76:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f79:	39 d0                	cmp    %edx,%eax
+  802f7b:	72 1a                	jb     802f97 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802f7d:	89 da                	mov    %ebx,%edx
+  802f7f:	89 f0                	mov    %esi,%eax
+  802f81:	e8 f4 fe ff ff       	call   802e7a <_pipeisclosed>
+  802f86:	85 c0                	test   %eax,%eax
+  802f88:	74 e2                	je     802f6c <devpipe_write+0x25>
+				return 0;
+  802f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f92:	5b                   	pop    %ebx
+  802f93:	5e                   	pop    %esi
+  802f94:	5f                   	pop    %edi
+  802f95:	5d                   	pop    %ebp
+  802f96:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f9a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f9e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802fa1:	89 c2                	mov    %eax,%edx
+  802fa3:	c1 fa 1f             	sar    $0x1f,%edx
+  802fa6:	89 d1                	mov    %edx,%ecx
+  802fa8:	c1 e9 1b             	shr    $0x1b,%ecx
+  802fab:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802fae:	83 e2 1f             	and    $0x1f,%edx
+  802fb1:	29 ca                	sub    %ecx,%edx
+  802fb3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802fb7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802fbb:	83 c0 01             	add    $0x1,%eax
+  802fbe:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802fc1:	83 c7 01             	add    $0x1,%edi
+  802fc4:	eb 9d                	jmp    802f63 <devpipe_write+0x1c>
+
+00802fc6 <devpipe_read>:
+{
+  802fc6:	55                   	push   %ebp
+  802fc7:	89 e5                	mov    %esp,%ebp
+  802fc9:	57                   	push   %edi
+  802fca:	56                   	push   %esi
+  802fcb:	53                   	push   %ebx
+  802fcc:	83 ec 18             	sub    $0x18,%esp
+  802fcf:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802fd2:	57                   	push   %edi
+  802fd3:	e8 67 f1 ff ff       	call   80213f <fd2data>
+  802fd8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fda:	83 c4 10             	add    $0x10,%esp
+  802fdd:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802fe5:	75 13                	jne    802ffa <devpipe_read+0x34>
+	return i;
+  802fe7:	89 f0                	mov    %esi,%eax
+  802fe9:	eb 02                	jmp    802fed <devpipe_read+0x27>
+				return i;
+  802feb:	89 f0                	mov    %esi,%eax
+}
+  802fed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff0:	5b                   	pop    %ebx
+  802ff1:	5e                   	pop    %esi
+  802ff2:	5f                   	pop    %edi
+  802ff3:	5d                   	pop    %ebp
+  802ff4:	c3                   	ret
+			sys_yield();
+  802ff5:	e8 f1 dd ff ff       	call   800deb <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802ffa:	8b 03                	mov    (%ebx),%eax
+  802ffc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fff:	75 18                	jne    803019 <devpipe_read+0x53>
+			if (i > 0)
+  803001:	85 f6                	test   %esi,%esi
+  803003:	75 e6                	jne    802feb <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803005:	89 da                	mov    %ebx,%edx
+  803007:	89 f8                	mov    %edi,%eax
+  803009:	e8 6c fe ff ff       	call   802e7a <_pipeisclosed>
+  80300e:	85 c0                	test   %eax,%eax
+  803010:	74 e3                	je     802ff5 <devpipe_read+0x2f>
+				return 0;
+  803012:	b8 00 00 00 00       	mov    $0x0,%eax
+  803017:	eb d4                	jmp    802fed <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803019:	99                   	cltd
+  80301a:	c1 ea 1b             	shr    $0x1b,%edx
+  80301d:	01 d0                	add    %edx,%eax
+  80301f:	83 e0 1f             	and    $0x1f,%eax
+  803022:	29 d0                	sub    %edx,%eax
+  803024:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803029:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80302c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80302f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803032:	83 c6 01             	add    $0x1,%esi
+  803035:	eb ab                	jmp    802fe2 <devpipe_read+0x1c>
+
+00803037 <pipe>:
+{
+  803037:	55                   	push   %ebp
+  803038:	89 e5                	mov    %esp,%ebp
+  80303a:	56                   	push   %esi
+  80303b:	53                   	push   %ebx
+  80303c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80303f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803042:	50                   	push   %eax
+  803043:	e8 0e f1 ff ff       	call   802156 <fd_alloc>
+  803048:	89 c3                	mov    %eax,%ebx
+  80304a:	83 c4 10             	add    $0x10,%esp
+  80304d:	85 c0                	test   %eax,%eax
+  80304f:	0f 88 23 01 00 00    	js     803178 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803055:	83 ec 04             	sub    $0x4,%esp
+  803058:	68 07 04 00 00       	push   $0x407
+  80305d:	ff 75 f4             	push   -0xc(%ebp)
+  803060:	6a 00                	push   $0x0
+  803062:	e8 ca dd ff ff       	call   800e31 <sys_page_alloc>
+  803067:	89 c3                	mov    %eax,%ebx
+  803069:	83 c4 10             	add    $0x10,%esp
+  80306c:	85 c0                	test   %eax,%eax
+  80306e:	0f 88 04 01 00 00    	js     803178 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803074:	83 ec 0c             	sub    $0xc,%esp
+  803077:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80307a:	50                   	push   %eax
+  80307b:	e8 d6 f0 ff ff       	call   802156 <fd_alloc>
+  803080:	89 c3                	mov    %eax,%ebx
+  803082:	83 c4 10             	add    $0x10,%esp
+  803085:	85 c0                	test   %eax,%eax
+  803087:	0f 88 db 00 00 00    	js     803168 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80308d:	83 ec 04             	sub    $0x4,%esp
+  803090:	68 07 04 00 00       	push   $0x407
+  803095:	ff 75 f0             	push   -0x10(%ebp)
+  803098:	6a 00                	push   $0x0
+  80309a:	e8 92 dd ff ff       	call   800e31 <sys_page_alloc>
+  80309f:	89 c3                	mov    %eax,%ebx
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	85 c0                	test   %eax,%eax
+  8030a6:	0f 88 bc 00 00 00    	js     803168 <pipe+0x131>
+	va = fd2data(fd0);
+  8030ac:	83 ec 0c             	sub    $0xc,%esp
+  8030af:	ff 75 f4             	push   -0xc(%ebp)
+  8030b2:	e8 88 f0 ff ff       	call   80213f <fd2data>
+  8030b7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030b9:	83 c4 0c             	add    $0xc,%esp
+  8030bc:	68 07 04 00 00       	push   $0x407
+  8030c1:	50                   	push   %eax
+  8030c2:	6a 00                	push   $0x0
+  8030c4:	e8 68 dd ff ff       	call   800e31 <sys_page_alloc>
+  8030c9:	89 c3                	mov    %eax,%ebx
+  8030cb:	83 c4 10             	add    $0x10,%esp
+  8030ce:	85 c0                	test   %eax,%eax
+  8030d0:	0f 88 82 00 00 00    	js     803158 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030d6:	83 ec 0c             	sub    $0xc,%esp
+  8030d9:	ff 75 f0             	push   -0x10(%ebp)
+  8030dc:	e8 5e f0 ff ff       	call   80213f <fd2data>
+  8030e1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030e8:	50                   	push   %eax
+  8030e9:	6a 00                	push   $0x0
+  8030eb:	56                   	push   %esi
+  8030ec:	6a 00                	push   $0x0
+  8030ee:	e8 ab dd ff ff       	call   800e9e <sys_page_map>
+  8030f3:	89 c3                	mov    %eax,%ebx
+  8030f5:	83 c4 20             	add    $0x20,%esp
+  8030f8:	85 c0                	test   %eax,%eax
+  8030fa:	78 4e                	js     80314a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8030fc:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  803101:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803104:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803106:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803109:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803110:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803113:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803115:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803118:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80311f:	83 ec 0c             	sub    $0xc,%esp
+  803122:	ff 75 f4             	push   -0xc(%ebp)
+  803125:	e8 05 f0 ff ff       	call   80212f <fd2num>
+  80312a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80312d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80312f:	83 c4 04             	add    $0x4,%esp
+  803132:	ff 75 f0             	push   -0x10(%ebp)
+  803135:	e8 f5 ef ff ff       	call   80212f <fd2num>
+  80313a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80313d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803140:	83 c4 10             	add    $0x10,%esp
+  803143:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803148:	eb 2e                	jmp    803178 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80314a:	83 ec 08             	sub    $0x8,%esp
+  80314d:	56                   	push   %esi
+  80314e:	6a 00                	push   $0x0
+  803150:	e8 b7 dd ff ff       	call   800f0c <sys_page_unmap>
+  803155:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803158:	83 ec 08             	sub    $0x8,%esp
+  80315b:	ff 75 f0             	push   -0x10(%ebp)
+  80315e:	6a 00                	push   $0x0
+  803160:	e8 a7 dd ff ff       	call   800f0c <sys_page_unmap>
+  803165:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803168:	83 ec 08             	sub    $0x8,%esp
+  80316b:	ff 75 f4             	push   -0xc(%ebp)
+  80316e:	6a 00                	push   $0x0
+  803170:	e8 97 dd ff ff       	call   800f0c <sys_page_unmap>
+  803175:	83 c4 10             	add    $0x10,%esp
+}
+  803178:	89 d8                	mov    %ebx,%eax
+  80317a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80317d:	5b                   	pop    %ebx
+  80317e:	5e                   	pop    %esi
+  80317f:	5d                   	pop    %ebp
+  803180:	c3                   	ret
+
+00803181 <pipeisclosed>:
+{
+  803181:	55                   	push   %ebp
+  803182:	89 e5                	mov    %esp,%ebp
+  803184:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803187:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80318a:	50                   	push   %eax
+  80318b:	ff 75 08             	push   0x8(%ebp)
+  80318e:	e8 19 f0 ff ff       	call   8021ac <fd_lookup>
+  803193:	83 c4 10             	add    $0x10,%esp
+  803196:	85 c0                	test   %eax,%eax
+  803198:	78 18                	js     8031b2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80319a:	83 ec 0c             	sub    $0xc,%esp
+  80319d:	ff 75 f4             	push   -0xc(%ebp)
+  8031a0:	e8 9a ef ff ff       	call   80213f <fd2data>
+  8031a5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8031a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031aa:	e8 cb fc ff ff       	call   802e7a <_pipeisclosed>
+  8031af:	83 c4 10             	add    $0x10,%esp
+}
+  8031b2:	c9                   	leave
+  8031b3:	c3                   	ret
+
+008031b4 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8031b4:	55                   	push   %ebp
+  8031b5:	89 e5                	mov    %esp,%ebp
+  8031b7:	56                   	push   %esi
+  8031b8:	53                   	push   %ebx
+  8031b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8031bc:	85 f6                	test   %esi,%esi
+  8031be:	74 16                	je     8031d6 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  8031c0:	89 f3                	mov    %esi,%ebx
+  8031c2:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8031c8:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  8031ce:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8031d4:	eb 1b                	jmp    8031f1 <wait+0x3d>
+	assert(envid != 0);
+  8031d6:	68 96 3a 80 00       	push   $0x803a96
+  8031db:	68 f0 38 80 00       	push   $0x8038f0
+  8031e0:	6a 09                	push   $0x9
+  8031e2:	68 a1 3a 80 00       	push   $0x803aa1
+  8031e7:	e8 2a d0 ff ff       	call   800216 <_panic>
+		sys_yield();
+  8031ec:	e8 fa db ff ff       	call   800deb <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8031f1:	8b 43 48             	mov    0x48(%ebx),%eax
+  8031f4:	39 f0                	cmp    %esi,%eax
+  8031f6:	75 07                	jne    8031ff <wait+0x4b>
+  8031f8:	8b 43 54             	mov    0x54(%ebx),%eax
+  8031fb:	85 c0                	test   %eax,%eax
+  8031fd:	75 ed                	jne    8031ec <wait+0x38>
+}
+  8031ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803202:	5b                   	pop    %ebx
+  803203:	5e                   	pop    %esi
+  803204:	5d                   	pop    %ebp
+  803205:	c3                   	ret
+
+00803206 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320b:	c3                   	ret
+
+0080320c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80320c:	55                   	push   %ebp
+  80320d:	89 e5                	mov    %esp,%ebp
+  80320f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803212:	68 ac 3a 80 00       	push   $0x803aac
+  803217:	ff 75 0c             	push   0xc(%ebp)
+  80321a:	e8 1a d7 ff ff       	call   800939 <strcpy>
+	return 0;
+}
+  80321f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803224:	c9                   	leave
+  803225:	c3                   	ret
+
+00803226 <devcons_write>:
+{
+  803226:	55                   	push   %ebp
+  803227:	89 e5                	mov    %esp,%ebp
+  803229:	57                   	push   %edi
+  80322a:	56                   	push   %esi
+  80322b:	53                   	push   %ebx
+  80322c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803232:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803237:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80323d:	eb 2e                	jmp    80326d <devcons_write+0x47>
+		m = n - tot;
+  80323f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803242:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803244:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803249:	39 c3                	cmp    %eax,%ebx
+  80324b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80324e:	83 ec 04             	sub    $0x4,%esp
+  803251:	53                   	push   %ebx
+  803252:	89 f0                	mov    %esi,%eax
+  803254:	03 45 0c             	add    0xc(%ebp),%eax
+  803257:	50                   	push   %eax
+  803258:	57                   	push   %edi
+  803259:	e8 61 d8 ff ff       	call   800abf <memmove>
+		sys_cputs(buf, m);
+  80325e:	83 c4 08             	add    $0x8,%esp
+  803261:	53                   	push   %ebx
+  803262:	57                   	push   %edi
+  803263:	e8 4a da ff ff       	call   800cb2 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803268:	01 de                	add    %ebx,%esi
+  80326a:	83 c4 10             	add    $0x10,%esp
+  80326d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803270:	72 cd                	jb     80323f <devcons_write+0x19>
+}
+  803272:	89 f0                	mov    %esi,%eax
+  803274:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803277:	5b                   	pop    %ebx
+  803278:	5e                   	pop    %esi
+  803279:	5f                   	pop    %edi
+  80327a:	5d                   	pop    %ebp
+  80327b:	c3                   	ret
+
+0080327c <devcons_read>:
+{
+  80327c:	55                   	push   %ebp
+  80327d:	89 e5                	mov    %esp,%ebp
+  80327f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803282:	b8 00 00 00 00       	mov    $0x0,%eax
+  803287:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80328b:	75 07                	jne    803294 <devcons_read+0x18>
+  80328d:	eb 1f                	jmp    8032ae <devcons_read+0x32>
+		sys_yield();
+  80328f:	e8 57 db ff ff       	call   800deb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803294:	e8 5d da ff ff       	call   800cf6 <sys_cgetc>
+  803299:	85 c0                	test   %eax,%eax
+  80329b:	74 f2                	je     80328f <devcons_read+0x13>
+	if (c < 0)
+  80329d:	78 0f                	js     8032ae <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80329f:	83 f8 04             	cmp    $0x4,%eax
+  8032a2:	74 0c                	je     8032b0 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8032a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032a7:	88 02                	mov    %al,(%edx)
+	return 1;
+  8032a9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8032ae:	c9                   	leave
+  8032af:	c3                   	ret
+		return 0;
+  8032b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b5:	eb f7                	jmp    8032ae <devcons_read+0x32>
+
+008032b7 <cputchar>:
+{
+  8032b7:	55                   	push   %ebp
+  8032b8:	89 e5                	mov    %esp,%ebp
+  8032ba:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8032bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c0:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8032c3:	6a 01                	push   $0x1
+  8032c5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032c8:	50                   	push   %eax
+  8032c9:	e8 e4 d9 ff ff       	call   800cb2 <sys_cputs>
+}
+  8032ce:	83 c4 10             	add    $0x10,%esp
+  8032d1:	c9                   	leave
+  8032d2:	c3                   	ret
+
+008032d3 <getchar>:
+{
+  8032d3:	55                   	push   %ebp
+  8032d4:	89 e5                	mov    %esp,%ebp
+  8032d6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8032d9:	6a 01                	push   $0x1
+  8032db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032de:	50                   	push   %eax
+  8032df:	6a 00                	push   $0x0
+  8032e1:	e8 4c f1 ff ff       	call   802432 <read>
+	if (r < 0)
+  8032e6:	83 c4 10             	add    $0x10,%esp
+  8032e9:	85 c0                	test   %eax,%eax
+  8032eb:	78 06                	js     8032f3 <getchar+0x20>
+	if (r < 1)
+  8032ed:	74 06                	je     8032f5 <getchar+0x22>
+	return c;
+  8032ef:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8032f3:	c9                   	leave
+  8032f4:	c3                   	ret
+		return -E_EOF;
+  8032f5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8032fa:	eb f7                	jmp    8032f3 <getchar+0x20>
+
+008032fc <iscons>:
+{
+  8032fc:	55                   	push   %ebp
+  8032fd:	89 e5                	mov    %esp,%ebp
+  8032ff:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803302:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803305:	50                   	push   %eax
+  803306:	ff 75 08             	push   0x8(%ebp)
+  803309:	e8 9e ee ff ff       	call   8021ac <fd_lookup>
+  80330e:	83 c4 10             	add    $0x10,%esp
+  803311:	85 c0                	test   %eax,%eax
+  803313:	78 11                	js     803326 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803315:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803318:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80331e:	39 10                	cmp    %edx,(%eax)
+  803320:	0f 94 c0             	sete   %al
+  803323:	0f b6 c0             	movzbl %al,%eax
+}
+  803326:	c9                   	leave
+  803327:	c3                   	ret
+
+00803328 <opencons>:
+{
+  803328:	55                   	push   %ebp
+  803329:	89 e5                	mov    %esp,%ebp
+  80332b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80332e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803331:	50                   	push   %eax
+  803332:	e8 1f ee ff ff       	call   802156 <fd_alloc>
+  803337:	83 c4 10             	add    $0x10,%esp
+  80333a:	85 c0                	test   %eax,%eax
+  80333c:	78 3a                	js     803378 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80333e:	83 ec 04             	sub    $0x4,%esp
+  803341:	68 07 04 00 00       	push   $0x407
+  803346:	ff 75 f4             	push   -0xc(%ebp)
+  803349:	6a 00                	push   $0x0
+  80334b:	e8 e1 da ff ff       	call   800e31 <sys_page_alloc>
+  803350:	83 c4 10             	add    $0x10,%esp
+  803353:	85 c0                	test   %eax,%eax
+  803355:	78 21                	js     803378 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803357:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80335a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803360:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803362:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803365:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80336c:	83 ec 0c             	sub    $0xc,%esp
+  80336f:	50                   	push   %eax
+  803370:	e8 ba ed ff ff       	call   80212f <fd2num>
+  803375:	83 c4 10             	add    $0x10,%esp
+}
+  803378:	c9                   	leave
+  803379:	c3                   	ret
+
+0080337a <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80337a:	55                   	push   %ebp
+  80337b:	89 e5                	mov    %esp,%ebp
+  80337d:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803380:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803387:	74 0a                	je     803393 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803389:	8b 45 08             	mov    0x8(%ebp),%eax
+  80338c:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803391:	c9                   	leave
+  803392:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803393:	83 ec 04             	sub    $0x4,%esp
+  803396:	6a 07                	push   $0x7
+  803398:	68 00 f0 bf ee       	push   $0xeebff000
+  80339d:	6a 00                	push   $0x0
+  80339f:	e8 8d da ff ff       	call   800e31 <sys_page_alloc>
+  8033a4:	83 c4 10             	add    $0x10,%esp
+  8033a7:	85 c0                	test   %eax,%eax
+  8033a9:	78 14                	js     8033bf <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8033ab:	83 ec 08             	sub    $0x8,%esp
+  8033ae:	68 e1 33 80 00       	push   $0x8033e1
+  8033b3:	6a 00                	push   $0x0
+  8033b5:	e8 93 dc ff ff       	call   80104d <sys_env_set_pgfault_upcall>
+  8033ba:	83 c4 10             	add    $0x10,%esp
+  8033bd:	eb ca                	jmp    803389 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8033bf:	83 ec 08             	sub    $0x8,%esp
+  8033c2:	50                   	push   %eax
+  8033c3:	68 b8 3a 80 00       	push   $0x803ab8
+  8033c8:	e8 24 cf ff ff       	call   8002f1 <cprintf>
+			panic("set_pgfault_handler error");
+  8033cd:	83 c4 0c             	add    $0xc,%esp
+  8033d0:	68 c3 3a 80 00       	push   $0x803ac3
+  8033d5:	6a 24                	push   $0x24
+  8033d7:	68 dd 3a 80 00       	push   $0x803add
+  8033dc:	e8 35 ce ff ff       	call   800216 <_panic>
+
+008033e1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8033e1:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8033e2:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8033e7:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8033e9:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8033ec:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  8033f0:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  8033f3:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  8033f7:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  8033f9:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  8033fd:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8033fe:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803402:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803403:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803404:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803408:	c3                   	ret
+
+00803409 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803409:	55                   	push   %ebp
+  80340a:	89 e5                	mov    %esp,%ebp
+  80340c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80340f:	89 c2                	mov    %eax,%edx
+  803411:	c1 ea 16             	shr    $0x16,%edx
+  803414:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80341b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803420:	f6 c1 01             	test   $0x1,%cl
+  803423:	74 1a                	je     80343f <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803425:	c1 e8 0c             	shr    $0xc,%eax
+  803428:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80342f:	a8 01                	test   $0x1,%al
+  803431:	74 0c                	je     80343f <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803433:	c1 e8 0c             	shr    $0xc,%eax
+  803436:	c1 e0 04             	shl    $0x4,%eax
+  803439:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80343f:	89 d0                	mov    %edx,%eax
+  803441:	5d                   	pop    %ebp
+  803442:	c3                   	ret
@@ -0,0 +1,6161 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	zero = 0;
+  800039:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800040:	00 00 00 
+	cprintf("1/0 is %08x!\n", 1/zero);
+  800043:	6a 00                	push   $0x0
+  800045:	68 60 2b 80 00       	push   $0x802b60
+  80004a:	e8 a4 01 00 00       	call   8001f3 <cprintf>
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	57                   	push   %edi
+  800058:	56                   	push   %esi
+  800059:	53                   	push   %ebx
+  80005a:	83 ec 0c             	sub    $0xc,%esp
+  80005d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800060:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800063:	b8 01 00 00 00       	mov    $0x1,%eax
+  800068:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80006a:	c1 ea 0b             	shr    $0xb,%edx
+  80006d:	83 f2 01             	xor    $0x1,%edx
+  800070:	83 e2 01             	and    $0x1,%edx
+  800073:	88 15 10 50 80 00    	mov    %dl,0x805010
+
+	mainenv = NULL;
+  800079:	c7 05 0c 50 80 00 00 	movl   $0x0,0x80500c
+  800080:	00 00 00 
+	envid = sys_getenvid();
+  800083:	e8 1f 0c 00 00       	call   800ca7 <sys_getenvid>
+  800088:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80008a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80008f:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800095:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80009b:	8b 52 48             	mov    0x48(%edx),%edx
+  80009e:	39 ca                	cmp    %ecx,%edx
+  8000a0:	74 27                	je     8000c9 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8000a2:	83 c0 01             	add    $0x1,%eax
+  8000a5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000aa:	75 e3                	jne    80008f <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000ac:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8000b3:	75 24                	jne    8000d9 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000b5:	83 ec 04             	sub    $0x4,%esp
+  8000b8:	68 70 2b 80 00       	push   $0x802b70
+  8000bd:	6a 23                	push   $0x23
+  8000bf:	68 93 2b 80 00       	push   $0x802b93
+  8000c4:	e8 4f 00 00 00       	call   800118 <_panic>
+			mainenv = &envs[i];
+  8000c9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d4:	a3 0c 50 80 00       	mov    %eax,0x80500c
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000d9:	85 ff                	test   %edi,%edi
+  8000db:	7e 07                	jle    8000e4 <libmain+0x90>
+		binaryname = argv[0];
+  8000dd:	8b 06                	mov    (%esi),%eax
+  8000df:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e4:	83 ec 08             	sub    $0x8,%esp
+  8000e7:	56                   	push   %esi
+  8000e8:	57                   	push   %edi
+  8000e9:	e8 45 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000ee:	e8 0b 00 00 00       	call   8000fe <exit>
+}
+  8000f3:	83 c4 10             	add    $0x10,%esp
+  8000f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f9:	5b                   	pop    %ebx
+  8000fa:	5e                   	pop    %esi
+  8000fb:	5f                   	pop    %edi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800104:	e8 94 18 00 00       	call   80199d <close_all>
+	sys_env_destroy(0);
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 2b 0b 00 00       	call   800c3e <sys_env_destroy>
+}
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	56                   	push   %esi
+  80011c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80011d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800120:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800126:	e8 7c 0b 00 00       	call   800ca7 <sys_getenvid>
+  80012b:	83 ec 0c             	sub    $0xc,%esp
+  80012e:	ff 75 0c             	push   0xc(%ebp)
+  800131:	ff 75 08             	push   0x8(%ebp)
+  800134:	56                   	push   %esi
+  800135:	50                   	push   %eax
+  800136:	68 ac 2b 80 00       	push   $0x802bac
+  80013b:	e8 b3 00 00 00       	call   8001f3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800140:	83 c4 18             	add    $0x18,%esp
+  800143:	53                   	push   %ebx
+  800144:	ff 75 10             	push   0x10(%ebp)
+  800147:	e8 56 00 00 00       	call   8001a2 <vcprintf>
+	cprintf("\n");
+  80014c:	c7 04 24 6c 2b 80 00 	movl   $0x802b6c,(%esp)
+  800153:	e8 9b 00 00 00       	call   8001f3 <cprintf>
+  800158:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80015b:	cc                   	int3
+	while (1)
+  80015c:	eb fd                	jmp    80015b <_panic+0x43>
+
+0080015e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	53                   	push   %ebx
+  800162:	83 ec 04             	sub    $0x4,%esp
+  800165:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800168:	8b 13                	mov    (%ebx),%edx
+  80016a:	8d 42 01             	lea    0x1(%edx),%eax
+  80016d:	89 03                	mov    %eax,(%ebx)
+  80016f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800172:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800176:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80017b:	74 09                	je     800186 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800186:	83 ec 08             	sub    $0x8,%esp
+  800189:	68 ff 00 00 00       	push   $0xff
+  80018e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800191:	50                   	push   %eax
+  800192:	e8 1d 0a 00 00       	call   800bb4 <sys_cputs>
+		b->idx = 0;
+  800197:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	eb db                	jmp    80017d <putch+0x1f>
+
+008001a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b2:	00 00 00 
+	b.cnt = 0;
+  8001b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001bf:	ff 75 0c             	push   0xc(%ebp)
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001cb:	50                   	push   %eax
+  8001cc:	68 5e 01 80 00       	push   $0x80015e
+  8001d1:	e8 fb 00 00 00       	call   8002d1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d6:	83 c4 08             	add    $0x8,%esp
+  8001d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	e8 c9 09 00 00       	call   800bb4 <sys_cputs>
+
+	return b.cnt;
+}
+  8001eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+008001f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f3:	55                   	push   %ebp
+  8001f4:	89 e5                	mov    %esp,%ebp
+  8001f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001fc:	50                   	push   %eax
+  8001fd:	ff 75 08             	push   0x8(%ebp)
+  800200:	e8 9d ff ff ff       	call   8001a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	57                   	push   %edi
+  80020b:	56                   	push   %esi
+  80020c:	53                   	push   %ebx
+  80020d:	83 ec 1c             	sub    $0x1c,%esp
+  800210:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800213:	89 d6                	mov    %edx,%esi
+  800215:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800218:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80021b:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80021e:	73 0b                	jae    80022b <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800220:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800223:	c1 e7 08             	shl    $0x8,%edi
+  800226:	0b 7d 10             	or     0x10(%ebp),%edi
+  800229:	eb 36                	jmp    800261 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80022b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80022e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800233:	f7 75 08             	divl   0x8(%ebp)
+  800236:	89 c1                	mov    %eax,%ecx
+  800238:	ff 75 14             	push   0x14(%ebp)
+  80023b:	ff 75 10             	push   0x10(%ebp)
+  80023e:	83 eb 01             	sub    $0x1,%ebx
+  800241:	53                   	push   %ebx
+  800242:	ff 75 08             	push   0x8(%ebp)
+  800245:	89 f2                	mov    %esi,%edx
+  800247:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80024a:	e8 b8 ff ff ff       	call   800207 <printnum>
+  80024f:	83 c4 10             	add    $0x10,%esp
+  800252:	eb 14                	jmp    800268 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800254:	83 ec 08             	sub    $0x8,%esp
+  800257:	56                   	push   %esi
+  800258:	57                   	push   %edi
+  800259:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80025c:	ff d0                	call   *%eax
+  80025e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800261:	83 eb 01             	sub    $0x1,%ebx
+  800264:	85 db                	test   %ebx,%ebx
+  800266:	7f ec                	jg     800254 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800268:	83 ec 08             	sub    $0x8,%esp
+  80026b:	56                   	push   %esi
+  80026c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80026f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800274:	f7 75 08             	divl   0x8(%ebp)
+  800277:	0f be 92 cf 2b 80 00 	movsbl 0x802bcf(%edx),%edx
+  80027e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800281:	c1 e0 08             	shl    $0x8,%eax
+  800284:	09 d0                	or     %edx,%eax
+  800286:	50                   	push   %eax
+  800287:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80028a:	ff d0                	call   *%eax
+}
+  80028c:	83 c4 10             	add    $0x10,%esp
+  80028f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800292:	5b                   	pop    %ebx
+  800293:	5e                   	pop    %esi
+  800294:	5f                   	pop    %edi
+  800295:	5d                   	pop    %ebp
+  800296:	c3                   	ret
+
+00800297 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80029d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002a1:	8b 10                	mov    (%eax),%edx
+  8002a3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a6:	73 0a                	jae    8002b2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ab:	89 08                	mov    %ecx,(%eax)
+  8002ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002b0:	88 02                	mov    %al,(%edx)
+}
+  8002b2:	5d                   	pop    %ebp
+  8002b3:	c3                   	ret
+
+008002b4 <printfmt>:
+{
+  8002b4:	55                   	push   %ebp
+  8002b5:	89 e5                	mov    %esp,%ebp
+  8002b7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002ba:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002bd:	50                   	push   %eax
+  8002be:	ff 75 10             	push   0x10(%ebp)
+  8002c1:	ff 75 0c             	push   0xc(%ebp)
+  8002c4:	ff 75 08             	push   0x8(%ebp)
+  8002c7:	e8 05 00 00 00       	call   8002d1 <vprintfmt>
+}
+  8002cc:	83 c4 10             	add    $0x10,%esp
+  8002cf:	c9                   	leave
+  8002d0:	c3                   	ret
+
+008002d1 <vprintfmt>:
+{
+  8002d1:	55                   	push   %ebp
+  8002d2:	89 e5                	mov    %esp,%ebp
+  8002d4:	57                   	push   %edi
+  8002d5:	56                   	push   %esi
+  8002d6:	53                   	push   %ebx
+  8002d7:	83 ec 3c             	sub    $0x3c,%esp
+  8002da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002dd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002e0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002e7:	eb 16                	jmp    8002ff <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002e9:	83 ec 08             	sub    $0x8,%esp
+  8002ec:	ff 75 0c             	push   0xc(%ebp)
+  8002ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002f2:	c1 e2 08             	shl    $0x8,%edx
+  8002f5:	09 d0                	or     %edx,%eax
+  8002f7:	50                   	push   %eax
+  8002f8:	ff d7                	call   *%edi
+  8002fa:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002fd:	89 de                	mov    %ebx,%esi
+  8002ff:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800302:	0f b6 06             	movzbl (%esi),%eax
+  800305:	83 f8 25             	cmp    $0x25,%eax
+  800308:	74 0c                	je     800316 <vprintfmt+0x45>
+			if (ch == '\0')
+  80030a:	85 c0                	test   %eax,%eax
+  80030c:	75 db                	jne    8002e9 <vprintfmt+0x18>
+}
+  80030e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800311:	5b                   	pop    %ebx
+  800312:	5e                   	pop    %esi
+  800313:	5f                   	pop    %edi
+  800314:	5d                   	pop    %ebp
+  800315:	c3                   	ret
+		padc = ' ';
+  800316:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80031a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800321:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800328:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80032f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800334:	8d 73 01             	lea    0x1(%ebx),%esi
+  800337:	0f b6 13             	movzbl (%ebx),%edx
+  80033a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80033d:	3c 55                	cmp    $0x55,%al
+  80033f:	0f 87 2c 04 00 00    	ja     800771 <vprintfmt+0x4a0>
+  800345:	0f b6 c0             	movzbl %al,%eax
+  800348:	ff 24 85 20 2d 80 00 	jmp    *0x802d20(,%eax,4)
+  80034f:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800351:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800355:	eb dd                	jmp    800334 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800357:	89 f3                	mov    %esi,%ebx
+  800359:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80035d:	eb d5                	jmp    800334 <vprintfmt+0x63>
+  80035f:	0f b6 d2             	movzbl %dl,%edx
+  800362:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800364:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800369:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80036c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800370:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800373:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800376:	83 fe 09             	cmp    $0x9,%esi
+  800379:	0f 87 8a 00 00 00    	ja     800409 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80037f:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800382:	eb e5                	jmp    800369 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800384:	8b 45 14             	mov    0x14(%ebp),%eax
+  800387:	8b 00                	mov    (%eax),%eax
+  800389:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80038f:	8d 40 04             	lea    0x4(%eax),%eax
+  800392:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800395:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800397:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80039b:	79 97                	jns    800334 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80039d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003a3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003aa:	eb 88                	jmp    800334 <vprintfmt+0x63>
+			if (width < 0)
+  8003ac:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003af:	85 db                	test   %ebx,%ebx
+  8003b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b6:	0f 49 c3             	cmovns %ebx,%eax
+  8003b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003be:	e9 71 ff ff ff       	jmp    800334 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c3:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003c5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003cc:	e9 63 ff ff ff       	jmp    800334 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003d1:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003d4:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003d8:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003df:	3c 67                	cmp    $0x67,%al
+  8003e1:	0f 84 18 ff ff ff    	je     8002ff <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003e7:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003ee:	3c 72                	cmp    $0x72,%al
+  8003f0:	0f 84 09 ff ff ff    	je     8002ff <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003f6:	3c 62                	cmp    $0x62,%al
+  8003f8:	0f 94 c0             	sete   %al
+  8003fb:	0f b6 c0             	movzbl %al,%eax
+  8003fe:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800401:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800404:	e9 f6 fe ff ff       	jmp    8002ff <vprintfmt+0x2e>
+  800409:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80040c:	eb 89                	jmp    800397 <vprintfmt+0xc6>
+			lflag++;
+  80040e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800411:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800413:	e9 1c ff ff ff       	jmp    800334 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041b:	8d 58 04             	lea    0x4(%eax),%ebx
+  80041e:	83 ec 08             	sub    $0x8,%esp
+  800421:	ff 75 0c             	push   0xc(%ebp)
+  800424:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800427:	c1 e0 08             	shl    $0x8,%eax
+  80042a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80042d:	0b 01                	or     (%ecx),%eax
+  80042f:	50                   	push   %eax
+  800430:	ff d7                	call   *%edi
+			break;
+  800432:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800435:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800438:	e9 c2 fe ff ff       	jmp    8002ff <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80043d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800440:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800443:	8b 10                	mov    (%eax),%edx
+  800445:	89 d0                	mov    %edx,%eax
+  800447:	f7 d8                	neg    %eax
+  800449:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80044c:	83 f8 12             	cmp    $0x12,%eax
+  80044f:	7f 25                	jg     800476 <vprintfmt+0x1a5>
+  800451:	8b 14 85 80 2e 80 00 	mov    0x802e80(,%eax,4),%edx
+  800458:	85 d2                	test   %edx,%edx
+  80045a:	74 1a                	je     800476 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80045c:	52                   	push   %edx
+  80045d:	68 c1 2f 80 00       	push   $0x802fc1
+  800462:	ff 75 0c             	push   0xc(%ebp)
+  800465:	57                   	push   %edi
+  800466:	e8 49 fe ff ff       	call   8002b4 <printfmt>
+  80046b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800471:	e9 89 fe ff ff       	jmp    8002ff <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800476:	50                   	push   %eax
+  800477:	68 e7 2b 80 00       	push   $0x802be7
+  80047c:	ff 75 0c             	push   0xc(%ebp)
+  80047f:	57                   	push   %edi
+  800480:	e8 2f fe ff ff       	call   8002b4 <printfmt>
+  800485:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800488:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80048b:	e9 6f fe ff ff       	jmp    8002ff <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800490:	8b 45 14             	mov    0x14(%ebp),%eax
+  800493:	83 c0 04             	add    $0x4,%eax
+  800496:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800499:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80049e:	85 c9                	test   %ecx,%ecx
+  8004a0:	b8 e0 2b 80 00       	mov    $0x802be0,%eax
+  8004a5:	0f 45 c1             	cmovne %ecx,%eax
+  8004a8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004ab:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004af:	7e 06                	jle    8004b7 <vprintfmt+0x1e6>
+  8004b1:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004b5:	75 1a                	jne    8004d1 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004ba:	c1 e0 08             	shl    $0x8,%eax
+  8004bd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004c0:	83 c8 3f             	or     $0x3f,%eax
+  8004c3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004c6:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004c9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004cc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004cf:	eb 6d                	jmp    80053e <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	ff 75 d0             	push   -0x30(%ebp)
+  8004d7:	ff 75 c8             	push   -0x38(%ebp)
+  8004da:	e8 39 03 00 00       	call   800818 <strnlen>
+  8004df:	89 c2                	mov    %eax,%edx
+  8004e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e4:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004e6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004e9:	c1 e1 08             	shl    $0x8,%ecx
+  8004ec:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004f0:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f2:	83 c4 10             	add    $0x10,%esp
+  8004f5:	89 c3                	mov    %eax,%ebx
+  8004f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fa:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004fd:	89 ce                	mov    %ecx,%esi
+  8004ff:	eb 0f                	jmp    800510 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800501:	83 ec 08             	sub    $0x8,%esp
+  800504:	ff 75 0c             	push   0xc(%ebp)
+  800507:	56                   	push   %esi
+  800508:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80050a:	83 eb 01             	sub    $0x1,%ebx
+  80050d:	83 c4 10             	add    $0x10,%esp
+  800510:	85 db                	test   %ebx,%ebx
+  800512:	7f ed                	jg     800501 <vprintfmt+0x230>
+  800514:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800517:	8b 75 10             	mov    0x10(%ebp),%esi
+  80051a:	85 c0                	test   %eax,%eax
+  80051c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800521:	0f 49 d0             	cmovns %eax,%edx
+  800524:	29 d0                	sub    %edx,%eax
+  800526:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800529:	eb 8c                	jmp    8004b7 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80052b:	83 ec 08             	sub    $0x8,%esp
+  80052e:	ff 75 0c             	push   0xc(%ebp)
+  800531:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800534:	09 c2                	or     %eax,%edx
+  800536:	52                   	push   %edx
+  800537:	ff d7                	call   *%edi
+  800539:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80053c:	89 d9                	mov    %ebx,%ecx
+  80053e:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800541:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800545:	0f be d0             	movsbl %al,%edx
+  800548:	85 d2                	test   %edx,%edx
+  80054a:	74 2a                	je     800576 <vprintfmt+0x2a5>
+  80054c:	85 f6                	test   %esi,%esi
+  80054e:	78 05                	js     800555 <vprintfmt+0x284>
+  800550:	83 ee 01             	sub    $0x1,%esi
+  800553:	78 3b                	js     800590 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800555:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800559:	74 d0                	je     80052b <vprintfmt+0x25a>
+  80055b:	0f be c0             	movsbl %al,%eax
+  80055e:	83 e8 20             	sub    $0x20,%eax
+  800561:	83 f8 5e             	cmp    $0x5e,%eax
+  800564:	76 c5                	jbe    80052b <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800566:	83 ec 08             	sub    $0x8,%esp
+  800569:	ff 75 0c             	push   0xc(%ebp)
+  80056c:	ff 75 cc             	push   -0x34(%ebp)
+  80056f:	ff d7                	call   *%edi
+  800571:	83 c4 10             	add    $0x10,%esp
+  800574:	eb c6                	jmp    80053c <vprintfmt+0x26b>
+  800576:	8b 75 10             	mov    0x10(%ebp),%esi
+  800579:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80057c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80057f:	01 c3                	add    %eax,%ebx
+  800581:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800583:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800586:	83 c8 20             	or     $0x20,%eax
+  800589:	89 75 10             	mov    %esi,0x10(%ebp)
+  80058c:	89 c6                	mov    %eax,%esi
+  80058e:	eb 14                	jmp    8005a4 <vprintfmt+0x2d3>
+  800590:	8b 75 10             	mov    0x10(%ebp),%esi
+  800593:	eb e4                	jmp    800579 <vprintfmt+0x2a8>
+  800595:	83 ec 08             	sub    $0x8,%esp
+  800598:	ff 75 0c             	push   0xc(%ebp)
+  80059b:	56                   	push   %esi
+  80059c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80059e:	83 eb 01             	sub    $0x1,%ebx
+  8005a1:	83 c4 10             	add    $0x10,%esp
+  8005a4:	85 db                	test   %ebx,%ebx
+  8005a6:	7f ed                	jg     800595 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005ab:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005ae:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b1:	e9 49 fd ff ff       	jmp    8002ff <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005b6:	83 f9 01             	cmp    $0x1,%ecx
+  8005b9:	7f 1f                	jg     8005da <vprintfmt+0x309>
+	else if (lflag)
+  8005bb:	85 c9                	test   %ecx,%ecx
+  8005bd:	74 69                	je     800628 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8b 00                	mov    (%eax),%eax
+  8005c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c7:	89 c1                	mov    %eax,%ecx
+  8005c9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005cc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d8:	eb 17                	jmp    8005f1 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 50 04             	mov    0x4(%eax),%edx
+  8005e0:	8b 00                	mov    (%eax),%eax
+  8005e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005f1:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005f4:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005fc:	85 db                	test   %ebx,%ebx
+  8005fe:	0f 89 f6 00 00 00    	jns    8006fa <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800604:	83 ec 08             	sub    $0x8,%esp
+  800607:	ff 75 0c             	push   0xc(%ebp)
+  80060a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80060d:	c1 e0 08             	shl    $0x8,%eax
+  800610:	83 c8 2d             	or     $0x2d,%eax
+  800613:	50                   	push   %eax
+  800614:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800616:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800619:	f7 d9                	neg    %ecx
+  80061b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80061e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800623:	e9 d2 00 00 00       	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 00                	mov    (%eax),%eax
+  80062d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800630:	89 c1                	mov    %eax,%ecx
+  800632:	c1 f9 1f             	sar    $0x1f,%ecx
+  800635:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8d 40 04             	lea    0x4(%eax),%eax
+  80063e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800641:	eb ae                	jmp    8005f1 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800643:	83 f9 01             	cmp    $0x1,%ecx
+  800646:	7f 19                	jg     800661 <vprintfmt+0x390>
+	else if (lflag)
+  800648:	85 c9                	test   %ecx,%ecx
+  80064a:	74 2a                	je     800676 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 08                	mov    (%eax),%ecx
+  800651:	8d 40 04             	lea    0x4(%eax),%eax
+  800654:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800657:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80065c:	e9 99 00 00 00       	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 08                	mov    (%eax),%ecx
+  800666:	8d 40 08             	lea    0x8(%eax),%eax
+  800669:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800671:	e9 84 00 00 00       	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8b 08                	mov    (%eax),%ecx
+  80067b:	8d 40 04             	lea    0x4(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800681:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800686:	eb 72                	jmp    8006fa <vprintfmt+0x429>
+	if (lflag >= 2)
+  800688:	83 f9 01             	cmp    $0x1,%ecx
+  80068b:	7f 16                	jg     8006a3 <vprintfmt+0x3d2>
+	else if (lflag)
+  80068d:	85 c9                	test   %ecx,%ecx
+  80068f:	74 24                	je     8006b5 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800691:	8b 45 14             	mov    0x14(%ebp),%eax
+  800694:	8b 08                	mov    (%eax),%ecx
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80069c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8006a1:	eb 57                	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 08                	mov    (%eax),%ecx
+  8006a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ae:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006b3:	eb 45                	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8b 08                	mov    (%eax),%ecx
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c0:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006c5:	eb 33                	jmp    8006fa <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006c7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006ca:	c1 e3 08             	shl    $0x8,%ebx
+  8006cd:	83 ec 08             	sub    $0x8,%esp
+  8006d0:	ff 75 0c             	push   0xc(%ebp)
+  8006d3:	89 d8                	mov    %ebx,%eax
+  8006d5:	83 c8 30             	or     $0x30,%eax
+  8006d8:	50                   	push   %eax
+  8006d9:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006db:	83 c4 08             	add    $0x8,%esp
+  8006de:	ff 75 0c             	push   0xc(%ebp)
+  8006e1:	83 cb 78             	or     $0x78,%ebx
+  8006e4:	53                   	push   %ebx
+  8006e5:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ea:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006ec:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f5:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006fa:	ff 75 e4             	push   -0x1c(%ebp)
+  8006fd:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800701:	52                   	push   %edx
+  800702:	ff 75 e0             	push   -0x20(%ebp)
+  800705:	50                   	push   %eax
+  800706:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800709:	89 f8                	mov    %edi,%eax
+  80070b:	e8 f7 fa ff ff       	call   800207 <printnum>
+			break;
+  800710:	83 c4 10             	add    $0x10,%esp
+  800713:	e9 e7 fb ff ff       	jmp    8002ff <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800718:	83 f9 01             	cmp    $0x1,%ecx
+  80071b:	7f 16                	jg     800733 <vprintfmt+0x462>
+	else if (lflag)
+  80071d:	85 c9                	test   %ecx,%ecx
+  80071f:	74 24                	je     800745 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 08                	mov    (%eax),%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800731:	eb c7                	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 08                	mov    (%eax),%ecx
+  800738:	8d 40 08             	lea    0x8(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800743:	eb b5                	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 08                	mov    (%eax),%ecx
+  80074a:	8d 40 04             	lea    0x4(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800750:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800755:	eb a3                	jmp    8006fa <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800757:	83 ec 08             	sub    $0x8,%esp
+  80075a:	ff 75 0c             	push   0xc(%ebp)
+  80075d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800760:	c1 e0 08             	shl    $0x8,%eax
+  800763:	83 c8 25             	or     $0x25,%eax
+  800766:	50                   	push   %eax
+  800767:	ff d7                	call   *%edi
+			break;
+  800769:	83 c4 10             	add    $0x10,%esp
+  80076c:	e9 8e fb ff ff       	jmp    8002ff <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800771:	83 ec 08             	sub    $0x8,%esp
+  800774:	ff 75 0c             	push   0xc(%ebp)
+  800777:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80077a:	c1 e0 08             	shl    $0x8,%eax
+  80077d:	83 c8 25             	or     $0x25,%eax
+  800780:	50                   	push   %eax
+  800781:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800783:	83 c4 10             	add    $0x10,%esp
+  800786:	89 de                	mov    %ebx,%esi
+  800788:	eb 03                	jmp    80078d <vprintfmt+0x4bc>
+  80078a:	83 ee 01             	sub    $0x1,%esi
+  80078d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800791:	75 f7                	jne    80078a <vprintfmt+0x4b9>
+  800793:	e9 67 fb ff ff       	jmp    8002ff <vprintfmt+0x2e>
+
+00800798 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800798:	55                   	push   %ebp
+  800799:	89 e5                	mov    %esp,%ebp
+  80079b:	83 ec 18             	sub    $0x18,%esp
+  80079e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007a4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007a7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007ab:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007ae:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007b5:	85 c0                	test   %eax,%eax
+  8007b7:	74 26                	je     8007df <vsnprintf+0x47>
+  8007b9:	85 d2                	test   %edx,%edx
+  8007bb:	7e 22                	jle    8007df <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007bd:	ff 75 14             	push   0x14(%ebp)
+  8007c0:	ff 75 10             	push   0x10(%ebp)
+  8007c3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007c6:	50                   	push   %eax
+  8007c7:	68 97 02 80 00       	push   $0x800297
+  8007cc:	e8 00 fb ff ff       	call   8002d1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007d1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007d4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007da:	83 c4 10             	add    $0x10,%esp
+}
+  8007dd:	c9                   	leave
+  8007de:	c3                   	ret
+		return -E_INVAL;
+  8007df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e4:	eb f7                	jmp    8007dd <vsnprintf+0x45>
+
+008007e6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007ec:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007ef:	50                   	push   %eax
+  8007f0:	ff 75 10             	push   0x10(%ebp)
+  8007f3:	ff 75 0c             	push   0xc(%ebp)
+  8007f6:	ff 75 08             	push   0x8(%ebp)
+  8007f9:	e8 9a ff ff ff       	call   800798 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007fe:	c9                   	leave
+  8007ff:	c3                   	ret
+
+00800800 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080b:	eb 03                	jmp    800810 <strlen+0x10>
+		n++;
+  80080d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800810:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800814:	75 f7                	jne    80080d <strlen+0xd>
+	return n;
+}
+  800816:	5d                   	pop    %ebp
+  800817:	c3                   	ret
+
+00800818 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800818:	55                   	push   %ebp
+  800819:	89 e5                	mov    %esp,%ebp
+  80081b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800821:	b8 00 00 00 00       	mov    $0x0,%eax
+  800826:	eb 03                	jmp    80082b <strnlen+0x13>
+		n++;
+  800828:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80082b:	39 d0                	cmp    %edx,%eax
+  80082d:	74 08                	je     800837 <strnlen+0x1f>
+  80082f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800833:	75 f3                	jne    800828 <strnlen+0x10>
+  800835:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800837:	89 d0                	mov    %edx,%eax
+  800839:	5d                   	pop    %ebp
+  80083a:	c3                   	ret
+
+0080083b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80083b:	55                   	push   %ebp
+  80083c:	89 e5                	mov    %esp,%ebp
+  80083e:	53                   	push   %ebx
+  80083f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800842:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80084e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800851:	83 c0 01             	add    $0x1,%eax
+  800854:	84 d2                	test   %dl,%dl
+  800856:	75 f2                	jne    80084a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800858:	89 c8                	mov    %ecx,%eax
+  80085a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80085d:	c9                   	leave
+  80085e:	c3                   	ret
+
+0080085f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	53                   	push   %ebx
+  800863:	83 ec 10             	sub    $0x10,%esp
+  800866:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800869:	53                   	push   %ebx
+  80086a:	e8 91 ff ff ff       	call   800800 <strlen>
+  80086f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800872:	ff 75 0c             	push   0xc(%ebp)
+  800875:	01 d8                	add    %ebx,%eax
+  800877:	50                   	push   %eax
+  800878:	e8 be ff ff ff       	call   80083b <strcpy>
+	return dst;
+}
+  80087d:	89 d8                	mov    %ebx,%eax
+  80087f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800882:	c9                   	leave
+  800883:	c3                   	ret
+
+00800884 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	56                   	push   %esi
+  800888:	53                   	push   %ebx
+  800889:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80088f:	89 f3                	mov    %esi,%ebx
+  800891:	03 5d 10             	add    0x10(%ebp),%ebx
+  800894:	89 f0                	mov    %esi,%eax
+  800896:	eb 0f                	jmp    8008a7 <strncpy+0x23>
+		*dst++ = *src;
+  800898:	83 c0 01             	add    $0x1,%eax
+  80089b:	0f b6 0a             	movzbl (%edx),%ecx
+  80089e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008a1:	80 f9 01             	cmp    $0x1,%cl
+  8008a4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008a7:	39 d8                	cmp    %ebx,%eax
+  8008a9:	75 ed                	jne    800898 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008ab:	89 f0                	mov    %esi,%eax
+  8008ad:	5b                   	pop    %ebx
+  8008ae:	5e                   	pop    %esi
+  8008af:	5d                   	pop    %ebp
+  8008b0:	c3                   	ret
+
+008008b1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	56                   	push   %esi
+  8008b5:	53                   	push   %ebx
+  8008b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008bc:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008bf:	89 f0                	mov    %esi,%eax
+  8008c1:	85 d2                	test   %edx,%edx
+  8008c3:	74 21                	je     8008e6 <strlcpy+0x35>
+  8008c5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008c9:	89 f2                	mov    %esi,%edx
+  8008cb:	eb 09                	jmp    8008d6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008cd:	83 c1 01             	add    $0x1,%ecx
+  8008d0:	83 c2 01             	add    $0x1,%edx
+  8008d3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008d6:	39 c2                	cmp    %eax,%edx
+  8008d8:	74 09                	je     8008e3 <strlcpy+0x32>
+  8008da:	0f b6 19             	movzbl (%ecx),%ebx
+  8008dd:	84 db                	test   %bl,%bl
+  8008df:	75 ec                	jne    8008cd <strlcpy+0x1c>
+  8008e1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008e3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008e6:	29 f0                	sub    %esi,%eax
+}
+  8008e8:	5b                   	pop    %ebx
+  8008e9:	5e                   	pop    %esi
+  8008ea:	5d                   	pop    %ebp
+  8008eb:	c3                   	ret
+
+008008ec <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008f5:	eb 06                	jmp    8008fd <strcmp+0x11>
+		p++, q++;
+  8008f7:	83 c1 01             	add    $0x1,%ecx
+  8008fa:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008fd:	0f b6 01             	movzbl (%ecx),%eax
+  800900:	84 c0                	test   %al,%al
+  800902:	74 04                	je     800908 <strcmp+0x1c>
+  800904:	3a 02                	cmp    (%edx),%al
+  800906:	74 ef                	je     8008f7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800908:	0f b6 c0             	movzbl %al,%eax
+  80090b:	0f b6 12             	movzbl (%edx),%edx
+  80090e:	29 d0                	sub    %edx,%eax
+}
+  800910:	5d                   	pop    %ebp
+  800911:	c3                   	ret
+
+00800912 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	53                   	push   %ebx
+  800916:	8b 45 08             	mov    0x8(%ebp),%eax
+  800919:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80091c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80091f:	eb 09                	jmp    80092a <strncmp+0x18>
+		n--, p++, q++;
+  800921:	83 ea 01             	sub    $0x1,%edx
+  800924:	83 c0 01             	add    $0x1,%eax
+  800927:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80092a:	85 d2                	test   %edx,%edx
+  80092c:	74 18                	je     800946 <strncmp+0x34>
+  80092e:	0f b6 18             	movzbl (%eax),%ebx
+  800931:	84 db                	test   %bl,%bl
+  800933:	74 04                	je     800939 <strncmp+0x27>
+  800935:	3a 19                	cmp    (%ecx),%bl
+  800937:	74 e8                	je     800921 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800939:	0f b6 00             	movzbl (%eax),%eax
+  80093c:	0f b6 11             	movzbl (%ecx),%edx
+  80093f:	29 d0                	sub    %edx,%eax
+}
+  800941:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800944:	c9                   	leave
+  800945:	c3                   	ret
+		return 0;
+  800946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094b:	eb f4                	jmp    800941 <strncmp+0x2f>
+
+0080094d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80094d:	55                   	push   %ebp
+  80094e:	89 e5                	mov    %esp,%ebp
+  800950:	8b 45 08             	mov    0x8(%ebp),%eax
+  800953:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800957:	eb 03                	jmp    80095c <strchr+0xf>
+  800959:	83 c0 01             	add    $0x1,%eax
+  80095c:	0f b6 10             	movzbl (%eax),%edx
+  80095f:	84 d2                	test   %dl,%dl
+  800961:	74 06                	je     800969 <strchr+0x1c>
+		if (*s == c)
+  800963:	38 ca                	cmp    %cl,%dl
+  800965:	75 f2                	jne    800959 <strchr+0xc>
+  800967:	eb 05                	jmp    80096e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800969:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+
+00800970 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800970:	55                   	push   %ebp
+  800971:	89 e5                	mov    %esp,%ebp
+  800973:	8b 45 08             	mov    0x8(%ebp),%eax
+  800976:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80097a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80097d:	38 ca                	cmp    %cl,%dl
+  80097f:	74 09                	je     80098a <strfind+0x1a>
+  800981:	84 d2                	test   %dl,%dl
+  800983:	74 05                	je     80098a <strfind+0x1a>
+	for (; *s; s++)
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	eb f0                	jmp    80097a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80098a:	5d                   	pop    %ebp
+  80098b:	c3                   	ret
+
+0080098c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80098c:	55                   	push   %ebp
+  80098d:	89 e5                	mov    %esp,%ebp
+  80098f:	57                   	push   %edi
+  800990:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800993:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800996:	85 c9                	test   %ecx,%ecx
+  800998:	74 20                	je     8009ba <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80099a:	89 f8                	mov    %edi,%eax
+  80099c:	09 c8                	or     %ecx,%eax
+  80099e:	a8 03                	test   $0x3,%al
+  8009a0:	75 12                	jne    8009b4 <memset+0x28>
+		c &= 0xFF;
+  8009a2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009a6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009ac:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009af:	fc                   	cld
+  8009b0:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009b2:	eb 06                	jmp    8009ba <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009b7:	fc                   	cld
+  8009b8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009ba:	89 f8                	mov    %edi,%eax
+  8009bc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009bf:	c9                   	leave
+  8009c0:	c3                   	ret
+
+008009c1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	57                   	push   %edi
+  8009c5:	56                   	push   %esi
+  8009c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009cc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009cf:	39 c6                	cmp    %eax,%esi
+  8009d1:	73 32                	jae    800a05 <memmove+0x44>
+  8009d3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009d6:	39 d0                	cmp    %edx,%eax
+  8009d8:	73 2b                	jae    800a05 <memmove+0x44>
+		s += n;
+		d += n;
+  8009da:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009dd:	89 d6                	mov    %edx,%esi
+  8009df:	09 fe                	or     %edi,%esi
+  8009e1:	09 ce                	or     %ecx,%esi
+  8009e3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009e9:	75 0e                	jne    8009f9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009eb:	83 ef 04             	sub    $0x4,%edi
+  8009ee:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009f1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009f4:	fd                   	std
+  8009f5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f7:	eb 09                	jmp    800a02 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009f9:	83 ef 01             	sub    $0x1,%edi
+  8009fc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009ff:	fd                   	std
+  800a00:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a02:	fc                   	cld
+  800a03:	eb 1a                	jmp    800a1f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a05:	89 f2                	mov    %esi,%edx
+  800a07:	09 c2                	or     %eax,%edx
+  800a09:	09 ca                	or     %ecx,%edx
+  800a0b:	f6 c2 03             	test   $0x3,%dl
+  800a0e:	75 0a                	jne    800a1a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a10:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a13:	89 c7                	mov    %eax,%edi
+  800a15:	fc                   	cld
+  800a16:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a18:	eb 05                	jmp    800a1f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a1a:	89 c7                	mov    %eax,%edi
+  800a1c:	fc                   	cld
+  800a1d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a1f:	5e                   	pop    %esi
+  800a20:	5f                   	pop    %edi
+  800a21:	5d                   	pop    %ebp
+  800a22:	c3                   	ret
+
+00800a23 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a29:	ff 75 10             	push   0x10(%ebp)
+  800a2c:	ff 75 0c             	push   0xc(%ebp)
+  800a2f:	ff 75 08             	push   0x8(%ebp)
+  800a32:	e8 8a ff ff ff       	call   8009c1 <memmove>
+}
+  800a37:	c9                   	leave
+  800a38:	c3                   	ret
+
+00800a39 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	56                   	push   %esi
+  800a3d:	53                   	push   %ebx
+  800a3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a41:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a44:	89 c6                	mov    %eax,%esi
+  800a46:	03 75 10             	add    0x10(%ebp),%esi
+  800a49:	eb 06                	jmp    800a51 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a4b:	83 c0 01             	add    $0x1,%eax
+  800a4e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a51:	39 f0                	cmp    %esi,%eax
+  800a53:	74 14                	je     800a69 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a55:	0f b6 08             	movzbl (%eax),%ecx
+  800a58:	0f b6 1a             	movzbl (%edx),%ebx
+  800a5b:	38 d9                	cmp    %bl,%cl
+  800a5d:	74 ec                	je     800a4b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a5f:	0f b6 c1             	movzbl %cl,%eax
+  800a62:	0f b6 db             	movzbl %bl,%ebx
+  800a65:	29 d8                	sub    %ebx,%eax
+  800a67:	eb 05                	jmp    800a6e <memcmp+0x35>
+	}
+
+	return 0;
+  800a69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a6e:	5b                   	pop    %ebx
+  800a6f:	5e                   	pop    %esi
+  800a70:	5d                   	pop    %ebp
+  800a71:	c3                   	ret
+
+00800a72 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a7b:	89 c2                	mov    %eax,%edx
+  800a7d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a80:	eb 03                	jmp    800a85 <memfind+0x13>
+  800a82:	83 c0 01             	add    $0x1,%eax
+  800a85:	39 d0                	cmp    %edx,%eax
+  800a87:	73 04                	jae    800a8d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a89:	38 08                	cmp    %cl,(%eax)
+  800a8b:	75 f5                	jne    800a82 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+
+00800a8f <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	57                   	push   %edi
+  800a93:	56                   	push   %esi
+  800a94:	53                   	push   %ebx
+  800a95:	83 ec 1c             	sub    $0x1c,%esp
+  800a98:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a9b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a9e:	eb 03                	jmp    800aa3 <strtol+0x14>
+		s++;
+  800aa0:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800aa3:	0f b6 06             	movzbl (%esi),%eax
+  800aa6:	3c 20                	cmp    $0x20,%al
+  800aa8:	74 f6                	je     800aa0 <strtol+0x11>
+  800aaa:	3c 09                	cmp    $0x9,%al
+  800aac:	74 f2                	je     800aa0 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aae:	3c 2b                	cmp    $0x2b,%al
+  800ab0:	74 43                	je     800af5 <strtol+0x66>
+	int neg = 0;
+  800ab2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800ab7:	3c 2d                	cmp    $0x2d,%al
+  800ab9:	74 44                	je     800aff <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800abb:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ac1:	75 0f                	jne    800ad2 <strtol+0x43>
+  800ac3:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ac6:	74 41                	je     800b09 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ac8:	85 ff                	test   %edi,%edi
+  800aca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800acf:	0f 44 f8             	cmove  %eax,%edi
+  800ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad7:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800adc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800adf:	89 fb                	mov    %edi,%ebx
+  800ae1:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ae4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ae7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800aea:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800aed:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800af0:	89 75 08             	mov    %esi,0x8(%ebp)
+  800af3:	eb 67                	jmp    800b5c <strtol+0xcd>
+		s++;
+  800af5:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800af8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afd:	eb bc                	jmp    800abb <strtol+0x2c>
+		s++, neg = 1;
+  800aff:	83 c6 01             	add    $0x1,%esi
+  800b02:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b07:	eb b2                	jmp    800abb <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b09:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b0d:	74 0e                	je     800b1d <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b0f:	85 ff                	test   %edi,%edi
+  800b11:	75 bf                	jne    800ad2 <strtol+0x43>
+		s++, base = 8;
+  800b13:	83 c6 01             	add    $0x1,%esi
+  800b16:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b1b:	eb b5                	jmp    800ad2 <strtol+0x43>
+		s += 2, base = 16;
+  800b1d:	83 c6 02             	add    $0x2,%esi
+  800b20:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b25:	eb ab                	jmp    800ad2 <strtol+0x43>
+			dig = *s - '0';
+  800b27:	0f be c9             	movsbl %cl,%ecx
+  800b2a:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b2d:	39 f9                	cmp    %edi,%ecx
+  800b2f:	7d 59                	jge    800b8a <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b31:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b35:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b38:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b3b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b3e:	0f af d8             	imul   %eax,%ebx
+  800b41:	0f af d7             	imul   %edi,%edx
+  800b44:	01 d3                	add    %edx,%ebx
+  800b46:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b49:	f7 e7                	mul    %edi
+  800b4b:	01 da                	add    %ebx,%edx
+  800b4d:	89 cb                	mov    %ecx,%ebx
+  800b4f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b52:	01 c8                	add    %ecx,%eax
+  800b54:	11 da                	adc    %ebx,%edx
+  800b56:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b59:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5f:	0f b6 08             	movzbl (%eax),%ecx
+  800b62:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b65:	80 fb 09             	cmp    $0x9,%bl
+  800b68:	76 bd                	jbe    800b27 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b6a:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b6d:	80 fb 19             	cmp    $0x19,%bl
+  800b70:	77 08                	ja     800b7a <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b72:	0f be c9             	movsbl %cl,%ecx
+  800b75:	83 e9 57             	sub    $0x57,%ecx
+  800b78:	eb b3                	jmp    800b2d <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b7a:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b7d:	80 fb 19             	cmp    $0x19,%bl
+  800b80:	77 08                	ja     800b8a <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b82:	0f be c9             	movsbl %cl,%ecx
+  800b85:	83 e9 37             	sub    $0x37,%ecx
+  800b88:	eb a3                	jmp    800b2d <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b8a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b8d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b90:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b93:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b96:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b9a:	74 05                	je     800ba1 <strtol+0x112>
+		*endptr = (char *) s;
+  800b9c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b9f:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800ba1:	85 c9                	test   %ecx,%ecx
+  800ba3:	74 07                	je     800bac <strtol+0x11d>
+  800ba5:	f7 d8                	neg    %eax
+  800ba7:	83 d2 00             	adc    $0x0,%edx
+  800baa:	f7 da                	neg    %edx
+}
+  800bac:	83 c4 1c             	add    $0x1c,%esp
+  800baf:	5b                   	pop    %ebx
+  800bb0:	5e                   	pop    %esi
+  800bb1:	5f                   	pop    %edi
+  800bb2:	5d                   	pop    %ebp
+  800bb3:	c3                   	ret
+
+00800bb4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bb4:	55                   	push   %ebp
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	57                   	push   %edi
+  800bb8:	56                   	push   %esi
+  800bb9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bba:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800bc1:	74 18                	je     800bdb <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bce:	89 c3                	mov    %eax,%ebx
+  800bd0:	89 c7                	mov    %eax,%edi
+  800bd2:	89 c6                	mov    %eax,%esi
+  800bd4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bd6:	5b                   	pop    %ebx
+  800bd7:	5e                   	pop    %esi
+  800bd8:	5f                   	pop    %edi
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be6:	89 c3                	mov    %eax,%ebx
+  800be8:	89 c7                	mov    %eax,%edi
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	8d 35 f5 0b 80 00    	lea    0x800bf5,%esi
+  800bf3:	0f 34                	sysenter
+  800bf5:	5d                   	pop    %ebp
+		goto out;
+  800bf6:	eb de                	jmp    800bd6 <sys_cputs+0x22>
+
+00800bf8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	57                   	push   %edi
+  800bfc:	56                   	push   %esi
+  800bfd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bfe:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800c05:	74 19                	je     800c20 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c11:	89 d1                	mov    %edx,%ecx
+  800c13:	89 d3                	mov    %edx,%ebx
+  800c15:	89 d7                	mov    %edx,%edi
+  800c17:	89 d6                	mov    %edx,%esi
+  800c19:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c1b:	5b                   	pop    %ebx
+  800c1c:	5e                   	pop    %esi
+  800c1d:	5f                   	pop    %edi
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c25:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c2a:	89 d1                	mov    %edx,%ecx
+  800c2c:	89 d3                	mov    %edx,%ebx
+  800c2e:	89 d7                	mov    %edx,%edi
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	8d 35 3b 0c 80 00    	lea    0x800c3b,%esi
+  800c39:	0f 34                	sysenter
+  800c3b:	5d                   	pop    %ebp
+		goto out;
+  800c3c:	eb dd                	jmp    800c1b <sys_cgetc+0x23>
+
+00800c3e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	57                   	push   %edi
+  800c42:	56                   	push   %esi
+  800c43:	53                   	push   %ebx
+  800c44:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c47:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800c4e:	74 21                	je     800c71 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c55:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5d:	89 cb                	mov    %ecx,%ebx
+  800c5f:	89 cf                	mov    %ecx,%edi
+  800c61:	89 ce                	mov    %ecx,%esi
+  800c63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c65:	85 c0                	test   %eax,%eax
+  800c67:	7f 27                	jg     800c90 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6c:	5b                   	pop    %ebx
+  800c6d:	5e                   	pop    %esi
+  800c6e:	5f                   	pop    %edi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c79:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c7e:	89 cb                	mov    %ecx,%ebx
+  800c80:	89 cf                	mov    %ecx,%edi
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	8d 35 8d 0c 80 00    	lea    0x800c8d,%esi
+  800c8b:	0f 34                	sysenter
+  800c8d:	5d                   	pop    %ebp
+		goto out;
+  800c8e:	eb d5                	jmp    800c65 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c90:	83 ec 0c             	sub    $0xc,%esp
+  800c93:	50                   	push   %eax
+  800c94:	6a 03                	push   $0x3
+  800c96:	68 eb 2e 80 00       	push   $0x802eeb
+  800c9b:	6a 3f                	push   $0x3f
+  800c9d:	68 08 2f 80 00       	push   $0x802f08
+  800ca2:	e8 71 f4 ff ff       	call   800118 <_panic>
+
+00800ca7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ca7:	55                   	push   %ebp
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	57                   	push   %edi
+  800cab:	56                   	push   %esi
+  800cac:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cad:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800cb4:	74 19                	je     800ccf <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800cb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cc0:	89 d1                	mov    %edx,%ecx
+  800cc2:	89 d3                	mov    %edx,%ebx
+  800cc4:	89 d7                	mov    %edx,%edi
+  800cc6:	89 d6                	mov    %edx,%esi
+  800cc8:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ccf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd9:	89 d1                	mov    %edx,%ecx
+  800cdb:	89 d3                	mov    %edx,%ebx
+  800cdd:	89 d7                	mov    %edx,%edi
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	8d 35 ea 0c 80 00    	lea    0x800cea,%esi
+  800ce8:	0f 34                	sysenter
+  800cea:	5d                   	pop    %ebp
+		goto out;
+  800ceb:	eb dd                	jmp    800cca <sys_getenvid+0x23>
+
+00800ced <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cf3:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800cfa:	74 19                	je     800d15 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d01:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d06:	89 d1                	mov    %edx,%ecx
+  800d08:	89 d3                	mov    %edx,%ebx
+  800d0a:	89 d7                	mov    %edx,%edi
+  800d0c:	89 d6                	mov    %edx,%esi
+  800d0e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5f                   	pop    %edi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d1f:	89 d1                	mov    %edx,%ecx
+  800d21:	89 d3                	mov    %edx,%ebx
+  800d23:	89 d7                	mov    %edx,%edi
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	8d 35 30 0d 80 00    	lea    0x800d30,%esi
+  800d2e:	0f 34                	sysenter
+  800d30:	5d                   	pop    %ebp
+		goto out;
+  800d31:	eb dd                	jmp    800d10 <sys_yield+0x23>
+
+00800d33 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d33:	55                   	push   %ebp
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	57                   	push   %edi
+  800d37:	56                   	push   %esi
+  800d38:	53                   	push   %ebx
+  800d39:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d3c:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800d43:	74 23                	je     800d68 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d45:	be 00 00 00 00       	mov    $0x0,%esi
+  800d4a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d58:	89 f7                	mov    %esi,%edi
+  800d5a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d5c:	85 c0                	test   %eax,%eax
+  800d5e:	7f 29                	jg     800d89 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d63:	5b                   	pop    %ebx
+  800d64:	5e                   	pop    %esi
+  800d65:	5f                   	pop    %edi
+  800d66:	5d                   	pop    %ebp
+  800d67:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	8d 35 86 0d 80 00    	lea    0x800d86,%esi
+  800d84:	0f 34                	sysenter
+  800d86:	5d                   	pop    %ebp
+		goto out;
+  800d87:	eb d3                	jmp    800d5c <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d89:	83 ec 0c             	sub    $0xc,%esp
+  800d8c:	50                   	push   %eax
+  800d8d:	6a 04                	push   $0x4
+  800d8f:	68 eb 2e 80 00       	push   $0x802eeb
+  800d94:	6a 3f                	push   $0x3f
+  800d96:	68 08 2f 80 00       	push   $0x802f08
+  800d9b:	e8 78 f3 ff ff       	call   800118 <_panic>
+
+00800da0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800da0:	55                   	push   %ebp
+  800da1:	89 e5                	mov    %esp,%ebp
+  800da3:	57                   	push   %edi
+  800da4:	56                   	push   %esi
+  800da5:	53                   	push   %ebx
+  800da6:	83 ec 0c             	sub    $0xc,%esp
+  800da9:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800dac:	85 f6                	test   %esi,%esi
+  800dae:	75 09                	jne    800db9 <sys_page_map+0x19>
+  800db0:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800db7:	74 1f                	je     800dd8 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800db9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcc:	85 c0                	test   %eax,%eax
+  800dce:	7f 27                	jg     800df7 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5e                   	pop    %esi
+  800dd5:	5f                   	pop    %edi
+  800dd6:	5d                   	pop    %ebp
+  800dd7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dde:	b8 05 00 00 00       	mov    $0x5,%eax
+  800de3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	8d 35 f4 0d 80 00    	lea    0x800df4,%esi
+  800df2:	0f 34                	sysenter
+  800df4:	5d                   	pop    %ebp
+		goto out;
+  800df5:	eb d5                	jmp    800dcc <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df7:	83 ec 0c             	sub    $0xc,%esp
+  800dfa:	50                   	push   %eax
+  800dfb:	6a 05                	push   $0x5
+  800dfd:	68 eb 2e 80 00       	push   $0x802eeb
+  800e02:	6a 3f                	push   $0x3f
+  800e04:	68 08 2f 80 00       	push   $0x802f08
+  800e09:	e8 0a f3 ff ff       	call   800118 <_panic>
+
+00800e0e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e17:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e1e:	74 22                	je     800e42 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e25:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	89 df                	mov    %ebx,%edi
+  800e32:	89 de                	mov    %ebx,%esi
+  800e34:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e36:	85 c0                	test   %eax,%eax
+  800e38:	7f 28                	jg     800e62 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3d:	5b                   	pop    %ebx
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5f                   	pop    %edi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e52:	89 df                	mov    %ebx,%edi
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	8d 35 5f 0e 80 00    	lea    0x800e5f,%esi
+  800e5d:	0f 34                	sysenter
+  800e5f:	5d                   	pop    %ebp
+		goto out;
+  800e60:	eb d4                	jmp    800e36 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e62:	83 ec 0c             	sub    $0xc,%esp
+  800e65:	50                   	push   %eax
+  800e66:	6a 06                	push   $0x6
+  800e68:	68 eb 2e 80 00       	push   $0x802eeb
+  800e6d:	6a 3f                	push   $0x3f
+  800e6f:	68 08 2f 80 00       	push   $0x802f08
+  800e74:	e8 9f f2 ff ff       	call   800118 <_panic>
+
+00800e79 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e79:	55                   	push   %ebp
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	57                   	push   %edi
+  800e7d:	56                   	push   %esi
+  800e7e:	53                   	push   %ebx
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e82:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e89:	74 22                	je     800ead <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e90:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9b:	89 df                	mov    %ebx,%edi
+  800e9d:	89 de                	mov    %ebx,%esi
+  800e9f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea1:	85 c0                	test   %eax,%eax
+  800ea3:	7f 28                	jg     800ecd <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ea5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea8:	5b                   	pop    %ebx
+  800ea9:	5e                   	pop    %esi
+  800eaa:	5f                   	pop    %edi
+  800eab:	5d                   	pop    %ebp
+  800eac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ead:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ebd:	89 df                	mov    %ebx,%edi
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	8d 35 ca 0e 80 00    	lea    0x800eca,%esi
+  800ec8:	0f 34                	sysenter
+  800eca:	5d                   	pop    %ebp
+		goto out;
+  800ecb:	eb d4                	jmp    800ea1 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecd:	83 ec 0c             	sub    $0xc,%esp
+  800ed0:	50                   	push   %eax
+  800ed1:	6a 08                	push   $0x8
+  800ed3:	68 eb 2e 80 00       	push   $0x802eeb
+  800ed8:	6a 3f                	push   $0x3f
+  800eda:	68 08 2f 80 00       	push   $0x802f08
+  800edf:	e8 34 f2 ff ff       	call   800118 <_panic>
+
+00800ee4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eed:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800ef4:	74 22                	je     800f18 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ef6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f06:	89 df                	mov    %ebx,%edi
+  800f08:	89 de                	mov    %ebx,%esi
+  800f0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0c:	85 c0                	test   %eax,%eax
+  800f0e:	7f 28                	jg     800f38 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5f                   	pop    %edi
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f28:	89 df                	mov    %ebx,%edi
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	8d 35 35 0f 80 00    	lea    0x800f35,%esi
+  800f33:	0f 34                	sysenter
+  800f35:	5d                   	pop    %ebp
+		goto out;
+  800f36:	eb d4                	jmp    800f0c <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f38:	83 ec 0c             	sub    $0xc,%esp
+  800f3b:	50                   	push   %eax
+  800f3c:	6a 09                	push   $0x9
+  800f3e:	68 eb 2e 80 00       	push   $0x802eeb
+  800f43:	6a 3f                	push   $0x3f
+  800f45:	68 08 2f 80 00       	push   $0x802f08
+  800f4a:	e8 c9 f1 ff ff       	call   800118 <_panic>
+
+00800f4f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	57                   	push   %edi
+  800f53:	56                   	push   %esi
+  800f54:	53                   	push   %ebx
+  800f55:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f58:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800f5f:	74 22                	je     800f83 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f66:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f71:	89 df                	mov    %ebx,%edi
+  800f73:	89 de                	mov    %ebx,%esi
+  800f75:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f77:	85 c0                	test   %eax,%eax
+  800f79:	7f 28                	jg     800fa3 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7e:	5b                   	pop    %ebx
+  800f7f:	5e                   	pop    %esi
+  800f80:	5f                   	pop    %edi
+  800f81:	5d                   	pop    %ebp
+  800f82:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f93:	89 df                	mov    %ebx,%edi
+  800f95:	55                   	push   %ebp
+  800f96:	89 e5                	mov    %esp,%ebp
+  800f98:	8d 35 a0 0f 80 00    	lea    0x800fa0,%esi
+  800f9e:	0f 34                	sysenter
+  800fa0:	5d                   	pop    %ebp
+		goto out;
+  800fa1:	eb d4                	jmp    800f77 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa3:	83 ec 0c             	sub    $0xc,%esp
+  800fa6:	50                   	push   %eax
+  800fa7:	6a 0a                	push   $0xa
+  800fa9:	68 eb 2e 80 00       	push   $0x802eeb
+  800fae:	6a 3f                	push   $0x3f
+  800fb0:	68 08 2f 80 00       	push   $0x802f08
+  800fb5:	e8 5e f1 ff ff       	call   800118 <_panic>
+
+00800fba <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+  800fc0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fc3:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800fca:	74 22                	je     800fee <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd1:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdc:	89 df                	mov    %ebx,%edi
+  800fde:	89 de                	mov    %ebx,%esi
+  800fe0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe2:	85 c0                	test   %eax,%eax
+  800fe4:	7f 28                	jg     80100e <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fe6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff9:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ffe:	89 df                	mov    %ebx,%edi
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	8d 35 0b 10 80 00    	lea    0x80100b,%esi
+  801009:	0f 34                	sysenter
+  80100b:	5d                   	pop    %ebp
+		goto out;
+  80100c:	eb d4                	jmp    800fe2 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+  801011:	50                   	push   %eax
+  801012:	6a 17                	push   $0x17
+  801014:	68 eb 2e 80 00       	push   $0x802eeb
+  801019:	6a 3f                	push   $0x3f
+  80101b:	68 08 2f 80 00       	push   $0x802f08
+  801020:	e8 f3 f0 ff ff       	call   800118 <_panic>
+
+00801025 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	57                   	push   %edi
+  801029:	56                   	push   %esi
+  80102a:	53                   	push   %ebx
+  80102b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80102e:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801035:	74 22                	je     801059 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801037:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	89 df                	mov    %ebx,%edi
+  801049:	89 de                	mov    %ebx,%esi
+  80104b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104d:	85 c0                	test   %eax,%eax
+  80104f:	7f 28                	jg     801079 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801051:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801054:	5b                   	pop    %ebx
+  801055:	5e                   	pop    %esi
+  801056:	5f                   	pop    %edi
+  801057:	5d                   	pop    %ebp
+  801058:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801059:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801061:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801064:	b8 18 00 00 00       	mov    $0x18,%eax
+  801069:	89 df                	mov    %ebx,%edi
+  80106b:	55                   	push   %ebp
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	8d 35 76 10 80 00    	lea    0x801076,%esi
+  801074:	0f 34                	sysenter
+  801076:	5d                   	pop    %ebp
+		goto out;
+  801077:	eb d4                	jmp    80104d <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801079:	83 ec 0c             	sub    $0xc,%esp
+  80107c:	50                   	push   %eax
+  80107d:	6a 18                	push   $0x18
+  80107f:	68 eb 2e 80 00       	push   $0x802eeb
+  801084:	6a 3f                	push   $0x3f
+  801086:	68 08 2f 80 00       	push   $0x802f08
+  80108b:	e8 88 f0 ff ff       	call   800118 <_panic>
+
+00801090 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	57                   	push   %edi
+  801094:	56                   	push   %esi
+  801095:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801096:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80109d:	74 1d                	je     8010bc <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80109f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010b7:	5b                   	pop    %ebx
+  8010b8:	5e                   	pop    %esi
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ca:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010cd:	55                   	push   %ebp
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	8d 35 d8 10 80 00    	lea    0x8010d8,%esi
+  8010d6:	0f 34                	sysenter
+  8010d8:	5d                   	pop    %ebp
+		goto out;
+  8010d9:	eb dc                	jmp    8010b7 <sys_ipc_try_send+0x27>
+
+008010db <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010e4:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8010eb:	74 21                	je     80110e <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fa:	89 cb                	mov    %ecx,%ebx
+  8010fc:	89 cf                	mov    %ecx,%edi
+  8010fe:	89 ce                	mov    %ecx,%esi
+  801100:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801102:	85 c0                	test   %eax,%eax
+  801104:	7f 27                	jg     80112d <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80110e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801111:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801116:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80111b:	89 cb                	mov    %ecx,%ebx
+  80111d:	89 cf                	mov    %ecx,%edi
+  80111f:	55                   	push   %ebp
+  801120:	89 e5                	mov    %esp,%ebp
+  801122:	8d 35 2a 11 80 00    	lea    0x80112a,%esi
+  801128:	0f 34                	sysenter
+  80112a:	5d                   	pop    %ebp
+		goto out;
+  80112b:	eb d5                	jmp    801102 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112d:	83 ec 0c             	sub    $0xc,%esp
+  801130:	50                   	push   %eax
+  801131:	6a 0d                	push   $0xd
+  801133:	68 eb 2e 80 00       	push   $0x802eeb
+  801138:	6a 3f                	push   $0x3f
+  80113a:	68 08 2f 80 00       	push   $0x802f08
+  80113f:	e8 d4 ef ff ff       	call   800118 <_panic>
+
+00801144 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	57                   	push   %edi
+  801148:	56                   	push   %esi
+  801149:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80114a:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801151:	74 1b                	je     80116e <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801153:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801158:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801163:	89 df                	mov    %ebx,%edi
+  801165:	89 de                	mov    %ebx,%esi
+  801167:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801169:	5b                   	pop    %ebx
+  80116a:	5e                   	pop    %esi
+  80116b:	5f                   	pop    %edi
+  80116c:	5d                   	pop    %ebp
+  80116d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80116e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801173:	8b 55 08             	mov    0x8(%ebp),%edx
+  801176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801179:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80117e:	89 df                	mov    %ebx,%edi
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	8d 35 8b 11 80 00    	lea    0x80118b,%esi
+  801189:	0f 34                	sysenter
+  80118b:	5d                   	pop    %ebp
+		goto out;
+  80118c:	eb db                	jmp    801169 <sys_ipc_recv_until+0x25>
+
+0080118e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801194:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80119b:	74 19                	je     8011b6 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80119d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a7:	89 d1                	mov    %edx,%ecx
+  8011a9:	89 d3                	mov    %edx,%ebx
+  8011ab:	89 d7                	mov    %edx,%edi
+  8011ad:	89 d6                	mov    %edx,%esi
+  8011af:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011b1:	5b                   	pop    %ebx
+  8011b2:	5e                   	pop    %esi
+  8011b3:	5f                   	pop    %edi
+  8011b4:	5d                   	pop    %ebp
+  8011b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011c0:	89 d1                	mov    %edx,%ecx
+  8011c2:	89 d3                	mov    %edx,%ebx
+  8011c4:	89 d7                	mov    %edx,%edi
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	8d 35 d1 11 80 00    	lea    0x8011d1,%esi
+  8011cf:	0f 34                	sysenter
+  8011d1:	5d                   	pop    %ebp
+		goto out;
+  8011d2:	eb dd                	jmp    8011b1 <sys_time_msec+0x23>
+
+008011d4 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011da:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8011e1:	74 1a                	je     8011fd <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f0:	89 cb                	mov    %ecx,%ebx
+  8011f2:	89 cf                	mov    %ecx,%edi
+  8011f4:	89 ce                	mov    %ecx,%esi
+  8011f6:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5f                   	pop    %edi
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801200:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801205:	b8 10 00 00 00       	mov    $0x10,%eax
+  80120a:	89 cb                	mov    %ecx,%ebx
+  80120c:	89 cf                	mov    %ecx,%edi
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	8d 35 19 12 80 00    	lea    0x801219,%esi
+  801217:	0f 34                	sysenter
+  801219:	5d                   	pop    %ebp
+		goto out;
+  80121a:	eb dc                	jmp    8011f8 <sys_sleep_until+0x24>
+
+0080121c <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	57                   	push   %edi
+  801220:	56                   	push   %esi
+  801221:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801222:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801229:	74 1a                	je     801245 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80122b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801230:	b8 11 00 00 00       	mov    $0x11,%eax
+  801235:	8b 55 08             	mov    0x8(%ebp),%edx
+  801238:	89 cb                	mov    %ecx,%ebx
+  80123a:	89 cf                	mov    %ecx,%edi
+  80123c:	89 ce                	mov    %ecx,%esi
+  80123e:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801240:	5b                   	pop    %ebx
+  801241:	5e                   	pop    %esi
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801245:	8b 55 08             	mov    0x8(%ebp),%edx
+  801248:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801252:	89 cb                	mov    %ecx,%ebx
+  801254:	89 cf                	mov    %ecx,%edi
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	8d 35 61 12 80 00    	lea    0x801261,%esi
+  80125f:	0f 34                	sysenter
+  801261:	5d                   	pop    %ebp
+		goto out;
+  801262:	eb dc                	jmp    801240 <sys_env_print_stats+0x24>
+
+00801264 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80126a:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801271:	74 1b                	je     80128e <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801278:	b8 19 00 00 00       	mov    $0x19,%eax
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	89 df                	mov    %ebx,%edi
+  801285:	89 de                	mov    %ebx,%esi
+  801287:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801289:	5b                   	pop    %ebx
+  80128a:	5e                   	pop    %esi
+  80128b:	5f                   	pop    %edi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80128e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801293:	8b 55 08             	mov    0x8(%ebp),%edx
+  801296:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801299:	b8 19 00 00 00       	mov    $0x19,%eax
+  80129e:	89 df                	mov    %ebx,%edi
+  8012a0:	55                   	push   %ebp
+  8012a1:	89 e5                	mov    %esp,%ebp
+  8012a3:	8d 35 ab 12 80 00    	lea    0x8012ab,%esi
+  8012a9:	0f 34                	sysenter
+  8012ab:	5d                   	pop    %ebp
+		goto out;
+  8012ac:	eb db                	jmp    801289 <sys_perf+0x25>
+
+008012ae <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	57                   	push   %edi
+  8012b2:	56                   	push   %esi
+  8012b3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012b4:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8012bb:	74 19                	je     8012d6 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012c7:	89 d1                	mov    %edx,%ecx
+  8012c9:	89 d3                	mov    %edx,%ebx
+  8012cb:	89 d7                	mov    %edx,%edi
+  8012cd:	89 d6                	mov    %edx,%esi
+  8012cf:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012e0:	89 d1                	mov    %edx,%ecx
+  8012e2:	89 d3                	mov    %edx,%ebx
+  8012e4:	89 d7                	mov    %edx,%edi
+  8012e6:	55                   	push   %ebp
+  8012e7:	89 e5                	mov    %esp,%ebp
+  8012e9:	8d 35 f1 12 80 00    	lea    0x8012f1,%esi
+  8012ef:	0f 34                	sysenter
+  8012f1:	5d                   	pop    %ebp
+		goto out;
+  8012f2:	eb dd                	jmp    8012d1 <sys_fork+0x23>
+
+008012f4 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012f4:	55                   	push   %ebp
+  8012f5:	89 e5                	mov    %esp,%ebp
+  8012f7:	57                   	push   %edi
+  8012f8:	56                   	push   %esi
+  8012f9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012fa:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801301:	74 1c                	je     80131f <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801303:	be 00 00 00 00       	mov    $0x0,%esi
+  801308:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80130d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801313:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801316:	89 f7                	mov    %esi,%edi
+  801318:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80131a:	5b                   	pop    %ebx
+  80131b:	5e                   	pop    %esi
+  80131c:	5f                   	pop    %edi
+  80131d:	5d                   	pop    %ebp
+  80131e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80131f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801322:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801325:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80132a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80132f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	8d 35 3d 13 80 00    	lea    0x80133d,%esi
+  80133b:	0f 34                	sysenter
+  80133d:	5d                   	pop    %ebp
+		goto out;
+  80133e:	eb da                	jmp    80131a <sys_thread_create+0x26>
+
+00801340 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	57                   	push   %edi
+  801344:	56                   	push   %esi
+  801345:	53                   	push   %ebx
+  801346:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801349:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801350:	74 24                	je     801376 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801352:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801357:	be 00 00 00 00       	mov    $0x0,%esi
+  80135c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801365:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801368:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80136a:	85 c0                	test   %eax,%eax
+  80136c:	7f 27                	jg     801395 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80136e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801371:	5b                   	pop    %ebx
+  801372:	5e                   	pop    %esi
+  801373:	5f                   	pop    %edi
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801376:	8b 55 08             	mov    0x8(%ebp),%edx
+  801379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801381:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801384:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	8d 35 92 13 80 00    	lea    0x801392,%esi
+  801390:	0f 34                	sysenter
+  801392:	5d                   	pop    %ebp
+		goto out;
+  801393:	eb d5                	jmp    80136a <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801395:	83 ec 0c             	sub    $0xc,%esp
+  801398:	50                   	push   %eax
+  801399:	6a 1f                	push   $0x1f
+  80139b:	68 eb 2e 80 00       	push   $0x802eeb
+  8013a0:	6a 3f                	push   $0x3f
+  8013a2:	68 08 2f 80 00       	push   $0x802f08
+  8013a7:	e8 6c ed ff ff       	call   800118 <_panic>
+
+008013ac <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	57                   	push   %edi
+  8013b0:	56                   	push   %esi
+  8013b1:	53                   	push   %ebx
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013b5:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8013bc:	74 23                	je     8013e1 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013be:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d1:	89 f7                	mov    %esi,%edi
+  8013d3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	7f 29                	jg     801402 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013dc:	5b                   	pop    %ebx
+  8013dd:	5e                   	pop    %esi
+  8013de:	5f                   	pop    %edi
+  8013df:	5d                   	pop    %ebp
+  8013e0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f4:	55                   	push   %ebp
+  8013f5:	89 e5                	mov    %esp,%ebp
+  8013f7:	8d 35 ff 13 80 00    	lea    0x8013ff,%esi
+  8013fd:	0f 34                	sysenter
+  8013ff:	5d                   	pop    %ebp
+		goto out;
+  801400:	eb d3                	jmp    8013d5 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801402:	83 ec 0c             	sub    $0xc,%esp
+  801405:	50                   	push   %eax
+  801406:	6a 20                	push   $0x20
+  801408:	68 eb 2e 80 00       	push   $0x802eeb
+  80140d:	6a 3f                	push   $0x3f
+  80140f:	68 08 2f 80 00       	push   $0x802f08
+  801414:	e8 ff ec ff ff       	call   800118 <_panic>
+
+00801419 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	57                   	push   %edi
+  80141d:	56                   	push   %esi
+  80141e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80141f:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801426:	74 1b                	je     801443 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801432:	8b 55 08             	mov    0x8(%ebp),%edx
+  801435:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801438:	89 df                	mov    %ebx,%edi
+  80143a:	89 de                	mov    %ebx,%esi
+  80143c:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80143e:	5b                   	pop    %ebx
+  80143f:	5e                   	pop    %esi
+  801440:	5f                   	pop    %edi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801443:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801448:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801453:	89 df                	mov    %ebx,%edi
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	8d 35 60 14 80 00    	lea    0x801460,%esi
+  80145e:	0f 34                	sysenter
+  801460:	5d                   	pop    %ebp
+		goto out;
+  801461:	eb db                	jmp    80143e <sys_batch+0x25>
+
+00801463 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801463:	55                   	push   %ebp
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	57                   	push   %edi
+  801467:	56                   	push   %esi
+  801468:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801469:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801470:	74 1a                	je     80148c <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801472:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801477:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80147c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147f:	89 cb                	mov    %ecx,%ebx
+  801481:	89 cf                	mov    %ecx,%edi
+  801483:	89 ce                	mov    %ecx,%esi
+  801485:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801487:	5b                   	pop    %ebx
+  801488:	5e                   	pop    %esi
+  801489:	5f                   	pop    %edi
+  80148a:	5d                   	pop    %ebp
+  80148b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80148c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801494:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801499:	89 cb                	mov    %ecx,%ebx
+  80149b:	89 cf                	mov    %ecx,%edi
+  80149d:	55                   	push   %ebp
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	8d 35 a8 14 80 00    	lea    0x8014a8,%esi
+  8014a6:	0f 34                	sysenter
+  8014a8:	5d                   	pop    %ebp
+		goto out;
+  8014a9:	eb dc                	jmp    801487 <sys_trace_ctl+0x24>
+
+008014ab <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+  8014ae:	57                   	push   %edi
+  8014af:	56                   	push   %esi
+  8014b0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014b1:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8014b8:	74 1c                	je     8014d6 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014cd:	89 f7                	mov    %esi,%edi
+  8014cf:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014d1:	5b                   	pop    %ebx
+  8014d2:	5e                   	pop    %esi
+  8014d3:	5f                   	pop    %edi
+  8014d4:	5d                   	pop    %ebp
+  8014d5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014dc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e9:	55                   	push   %ebp
+  8014ea:	89 e5                	mov    %esp,%ebp
+  8014ec:	8d 35 f4 14 80 00    	lea    0x8014f4,%esi
+  8014f2:	0f 34                	sysenter
+  8014f4:	5d                   	pop    %ebp
+		goto out;
+  8014f5:	eb da                	jmp    8014d1 <sys_trace_read+0x26>
+
+008014f7 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	57                   	push   %edi
+  8014fb:	56                   	push   %esi
+  8014fc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014fd:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801504:	74 1c                	je     801522 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801506:	be 00 00 00 00       	mov    $0x0,%esi
+  80150b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801510:	8b 55 08             	mov    0x8(%ebp),%edx
+  801513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801516:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801519:	89 f7                	mov    %esi,%edi
+  80151b:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80151d:	5b                   	pop    %ebx
+  80151e:	5e                   	pop    %esi
+  80151f:	5f                   	pop    %edi
+  801520:	5d                   	pop    %ebp
+  801521:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801522:	8b 55 08             	mov    0x8(%ebp),%edx
+  801525:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801528:	b8 21 00 00 00       	mov    $0x21,%eax
+  80152d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801532:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	8d 35 40 15 80 00    	lea    0x801540,%esi
+  80153e:	0f 34                	sysenter
+  801540:	5d                   	pop    %ebp
+		goto out;
+  801541:	eb da                	jmp    80151d <sys_meminfo+0x26>
+
+00801543 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	57                   	push   %edi
+  801547:	56                   	push   %esi
+  801548:	53                   	push   %ebx
+  801549:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80154c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801550:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801557:	74 1f                	je     801578 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801563:	8b 55 08             	mov    0x8(%ebp),%edx
+  801566:	89 df                	mov    %ebx,%edi
+  801568:	89 de                	mov    %ebx,%esi
+  80156a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80156c:	85 c0                	test   %eax,%eax
+  80156e:	7f 25                	jg     801595 <sys_env_set_ksm+0x52>
+}
+  801570:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801573:	5b                   	pop    %ebx
+  801574:	5e                   	pop    %esi
+  801575:	5f                   	pop    %edi
+  801576:	5d                   	pop    %ebp
+  801577:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801578:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801580:	b8 22 00 00 00       	mov    $0x22,%eax
+  801585:	89 df                	mov    %ebx,%edi
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	8d 35 92 15 80 00    	lea    0x801592,%esi
+  801590:	0f 34                	sysenter
+  801592:	5d                   	pop    %ebp
+		goto out;
+  801593:	eb d7                	jmp    80156c <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801595:	83 ec 0c             	sub    $0xc,%esp
+  801598:	50                   	push   %eax
+  801599:	6a 22                	push   $0x22
+  80159b:	68 eb 2e 80 00       	push   $0x802eeb
+  8015a0:	6a 3f                	push   $0x3f
+  8015a2:	68 08 2f 80 00       	push   $0x802f08
+  8015a7:	e8 6c eb ff ff       	call   800118 <_panic>
+
+008015ac <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	57                   	push   %edi
+  8015b0:	56                   	push   %esi
+  8015b1:	53                   	push   %ebx
+  8015b2:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015b5:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015b8:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8015bf:	74 24                	je     8015e5 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015cb:	89 cb                	mov    %ecx,%ebx
+  8015cd:	89 cf                	mov    %ecx,%edi
+  8015cf:	89 ce                	mov    %ecx,%esi
+  8015d1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015d3:	85 c0                	test   %eax,%eax
+  8015d5:	7f 2a                	jg     801601 <sys_time_nsec+0x55>
+	return ns;
+}
+  8015d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e0:	5b                   	pop    %ebx
+  8015e1:	5e                   	pop    %esi
+  8015e2:	5f                   	pop    %edi
+  8015e3:	5d                   	pop    %ebp
+  8015e4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015ef:	89 cb                	mov    %ecx,%ebx
+  8015f1:	89 cf                	mov    %ecx,%edi
+  8015f3:	55                   	push   %ebp
+  8015f4:	89 e5                	mov    %esp,%ebp
+  8015f6:	8d 35 fe 15 80 00    	lea    0x8015fe,%esi
+  8015fc:	0f 34                	sysenter
+  8015fe:	5d                   	pop    %ebp
+		goto out;
+  8015ff:	eb d2                	jmp    8015d3 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801601:	83 ec 0c             	sub    $0xc,%esp
+  801604:	50                   	push   %eax
+  801605:	6a 0f                	push   $0xf
+  801607:	68 eb 2e 80 00       	push   $0x802eeb
+  80160c:	6a 3f                	push   $0x3f
+  80160e:	68 08 2f 80 00       	push   $0x802f08
+  801613:	e8 00 eb ff ff       	call   800118 <_panic>
+
+00801618 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	57                   	push   %edi
+  80161c:	56                   	push   %esi
+  80161d:	53                   	push   %ebx
+  80161e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801621:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801628:	74 22                	je     80164c <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801634:	8b 55 08             	mov    0x8(%ebp),%edx
+  801637:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163a:	89 df                	mov    %ebx,%edi
+  80163c:	89 de                	mov    %ebx,%esi
+  80163e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801640:	85 c0                	test   %eax,%eax
+  801642:	7f 28                	jg     80166c <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801644:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801647:	5b                   	pop    %ebx
+  801648:	5e                   	pop    %esi
+  801649:	5f                   	pop    %edi
+  80164a:	5d                   	pop    %ebp
+  80164b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80164c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801651:	8b 55 08             	mov    0x8(%ebp),%edx
+  801654:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801657:	b8 12 00 00 00       	mov    $0x12,%eax
+  80165c:	89 df                	mov    %ebx,%edi
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	8d 35 69 16 80 00    	lea    0x801669,%esi
+  801667:	0f 34                	sysenter
+  801669:	5d                   	pop    %ebp
+		goto out;
+  80166a:	eb d4                	jmp    801640 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80166c:	83 ec 0c             	sub    $0xc,%esp
+  80166f:	50                   	push   %eax
+  801670:	6a 12                	push   $0x12
+  801672:	68 eb 2e 80 00       	push   $0x802eeb
+  801677:	6a 3f                	push   $0x3f
+  801679:	68 08 2f 80 00       	push   $0x802f08
+  80167e:	e8 95 ea ff ff       	call   800118 <_panic>
+
+00801683 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801683:	55                   	push   %ebp
+  801684:	89 e5                	mov    %esp,%ebp
+  801686:	57                   	push   %edi
+  801687:	56                   	push   %esi
+  801688:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801689:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801690:	74 1b                	je     8016ad <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801692:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801697:	b8 13 00 00 00       	mov    $0x13,%eax
+  80169c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a2:	89 df                	mov    %ebx,%edi
+  8016a4:	89 de                	mov    %ebx,%esi
+  8016a6:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016a8:	5b                   	pop    %ebx
+  8016a9:	5e                   	pop    %esi
+  8016aa:	5f                   	pop    %edi
+  8016ab:	5d                   	pop    %ebp
+  8016ac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016bd:	89 df                	mov    %ebx,%edi
+  8016bf:	55                   	push   %ebp
+  8016c0:	89 e5                	mov    %esp,%ebp
+  8016c2:	8d 35 ca 16 80 00    	lea    0x8016ca,%esi
+  8016c8:	0f 34                	sysenter
+  8016ca:	5d                   	pop    %ebp
+		goto out;
+  8016cb:	eb db                	jmp    8016a8 <sys_e1000_receive+0x25>
+
+008016cd <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	57                   	push   %edi
+  8016d1:	56                   	push   %esi
+  8016d2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016d3:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8016da:	74 1b                	je     8016f7 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ec:	89 df                	mov    %ebx,%edi
+  8016ee:	89 de                	mov    %ebx,%esi
+  8016f0:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5f                   	pop    %edi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801702:	b8 14 00 00 00       	mov    $0x14,%eax
+  801707:	89 df                	mov    %ebx,%edi
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	8d 35 14 17 80 00    	lea    0x801714,%esi
+  801712:	0f 34                	sysenter
+  801714:	5d                   	pop    %ebp
+		goto out;
+  801715:	eb db                	jmp    8016f2 <sys_e1000_read_hwaddr+0x25>
+
+00801717 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	57                   	push   %edi
+  80171b:	56                   	push   %esi
+  80171c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80171d:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801724:	74 1a                	je     801740 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801726:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80172b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801730:	8b 55 08             	mov    0x8(%ebp),%edx
+  801733:	89 cb                	mov    %ecx,%ebx
+  801735:	89 cf                	mov    %ecx,%edi
+  801737:	89 ce                	mov    %ecx,%esi
+  801739:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80173b:	5b                   	pop    %ebx
+  80173c:	5e                   	pop    %esi
+  80173d:	5f                   	pop    %edi
+  80173e:	5d                   	pop    %ebp
+  80173f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801740:	8b 55 08             	mov    0x8(%ebp),%edx
+  801743:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801748:	b8 15 00 00 00       	mov    $0x15,%eax
+  80174d:	89 cb                	mov    %ecx,%ebx
+  80174f:	89 cf                	mov    %ecx,%edi
+  801751:	55                   	push   %ebp
+  801752:	89 e5                	mov    %esp,%ebp
+  801754:	8d 35 5c 17 80 00    	lea    0x80175c,%esi
+  80175a:	0f 34                	sysenter
+  80175c:	5d                   	pop    %ebp
+		goto out;
+  80175d:	eb dc                	jmp    80173b <sys_sb16_read_version+0x24>
+
+0080175f <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80175f:	55                   	push   %ebp
+  801760:	89 e5                	mov    %esp,%ebp
+  801762:	57                   	push   %edi
+  801763:	56                   	push   %esi
+  801764:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801765:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80176c:	74 1b                	je     801789 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80176e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801773:	b8 16 00 00 00       	mov    $0x16,%eax
+  801778:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177e:	89 df                	mov    %ebx,%edi
+  801780:	89 de                	mov    %ebx,%esi
+  801782:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801784:	5b                   	pop    %ebx
+  801785:	5e                   	pop    %esi
+  801786:	5f                   	pop    %edi
+  801787:	5d                   	pop    %ebp
+  801788:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801789:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801791:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801794:	b8 16 00 00 00       	mov    $0x16,%eax
+  801799:	89 df                	mov    %ebx,%edi
+  80179b:	55                   	push   %ebp
+  80179c:	89 e5                	mov    %esp,%ebp
+  80179e:	8d 35 a6 17 80 00    	lea    0x8017a6,%esi
+  8017a4:	0f 34                	sysenter
+  8017a6:	5d                   	pop    %ebp
+		goto out;
+  8017a7:	eb db                	jmp    801784 <sys_sb16_play+0x25>
+
+008017a9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017af:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017b4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017b7:	5d                   	pop    %ebp
+  8017b8:	c3                   	ret
+
+008017b9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017b9:	55                   	push   %ebp
+  8017ba:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017bf:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017c4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017c9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017ce:	5d                   	pop    %ebp
+  8017cf:	c3                   	ret
+
+008017d0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017d3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017d8:	eb 02                	jmp    8017dc <fd_alloc+0xc>
+  8017da:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017dc:	89 c2                	mov    %eax,%edx
+  8017de:	c1 ea 16             	shr    $0x16,%edx
+  8017e1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017e8:	f6 c2 01             	test   $0x1,%dl
+  8017eb:	74 2b                	je     801818 <fd_alloc+0x48>
+  8017ed:	89 c2                	mov    %eax,%edx
+  8017ef:	c1 ea 0c             	shr    $0xc,%edx
+  8017f2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017f9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017ff:	f6 c1 01             	test   $0x1,%cl
+  801802:	74 14                	je     801818 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801804:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80180a:	75 ce                	jne    8017da <fd_alloc+0xa>
+  80180c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801811:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801816:	eb 05                	jmp    80181d <fd_alloc+0x4d>
+			return 0;
+  801818:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80181d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801820:	89 02                	mov    %eax,(%edx)
+}
+  801822:	89 c8                	mov    %ecx,%eax
+  801824:	5d                   	pop    %ebp
+  801825:	c3                   	ret
+
+00801826 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80182c:	83 f8 1f             	cmp    $0x1f,%eax
+  80182f:	77 30                	ja     801861 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801831:	c1 e0 0c             	shl    $0xc,%eax
+  801834:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801839:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80183f:	f6 c2 01             	test   $0x1,%dl
+  801842:	74 24                	je     801868 <fd_lookup+0x42>
+  801844:	89 c2                	mov    %eax,%edx
+  801846:	c1 ea 0c             	shr    $0xc,%edx
+  801849:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801850:	f6 c2 01             	test   $0x1,%dl
+  801853:	74 1a                	je     80186f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801855:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801858:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80185a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80185f:	5d                   	pop    %ebp
+  801860:	c3                   	ret
+		return -E_INVAL;
+  801861:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801866:	eb f7                	jmp    80185f <fd_lookup+0x39>
+		return -E_INVAL;
+  801868:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80186d:	eb f0                	jmp    80185f <fd_lookup+0x39>
+  80186f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801874:	eb e9                	jmp    80185f <fd_lookup+0x39>
+
+00801876 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801876:	55                   	push   %ebp
+  801877:	89 e5                	mov    %esp,%ebp
+  801879:	53                   	push   %ebx
+  80187a:	83 ec 04             	sub    $0x4,%esp
+  80187d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801880:	b8 00 00 00 00       	mov    $0x0,%eax
+  801885:	eb 03                	jmp    80188a <dev_lookup+0x14>
+  801887:	83 c0 01             	add    $0x1,%eax
+  80188a:	8b 1c 85 94 2f 80 00 	mov    0x802f94(,%eax,4),%ebx
+  801891:	85 db                	test   %ebx,%ebx
+  801893:	74 0b                	je     8018a0 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801895:	39 13                	cmp    %edx,(%ebx)
+  801897:	75 ee                	jne    801887 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189e:	eb 2e                	jmp    8018ce <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8018a0:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018a2:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8018a7:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018ad:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018b2:	76 24                	jbe    8018d8 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018b4:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018b7:	83 ec 04             	sub    $0x4,%esp
+  8018ba:	52                   	push   %edx
+  8018bb:	50                   	push   %eax
+  8018bc:	68 18 2f 80 00       	push   $0x802f18
+  8018c1:	e8 2d e9 ff ff       	call   8001f3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018c6:	83 c4 10             	add    $0x10,%esp
+  8018c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018d1:	89 1a                	mov    %ebx,(%edx)
+}
+  8018d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d6:	c9                   	leave
+  8018d7:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018d8:	c1 e8 10             	shr    $0x10,%eax
+  8018db:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018e1:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018e7:	eb cb                	jmp    8018b4 <dev_lookup+0x3e>
+
+008018e9 <fd_close>:
+{
+  8018e9:	55                   	push   %ebp
+  8018ea:	89 e5                	mov    %esp,%ebp
+  8018ec:	57                   	push   %edi
+  8018ed:	56                   	push   %esi
+  8018ee:	53                   	push   %ebx
+  8018ef:	83 ec 24             	sub    $0x24,%esp
+  8018f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018f5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018f8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018fb:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018fc:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801902:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801905:	50                   	push   %eax
+  801906:	e8 1b ff ff ff       	call   801826 <fd_lookup>
+  80190b:	89 c3                	mov    %eax,%ebx
+  80190d:	83 c4 10             	add    $0x10,%esp
+  801910:	85 c0                	test   %eax,%eax
+  801912:	78 05                	js     801919 <fd_close+0x30>
+	    || fd != fd2)
+  801914:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801917:	74 16                	je     80192f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801919:	89 f8                	mov    %edi,%eax
+  80191b:	84 c0                	test   %al,%al
+  80191d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801922:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801925:	89 d8                	mov    %ebx,%eax
+  801927:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80192a:	5b                   	pop    %ebx
+  80192b:	5e                   	pop    %esi
+  80192c:	5f                   	pop    %edi
+  80192d:	5d                   	pop    %ebp
+  80192e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80192f:	83 ec 08             	sub    $0x8,%esp
+  801932:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801935:	50                   	push   %eax
+  801936:	ff 36                	push   (%esi)
+  801938:	e8 39 ff ff ff       	call   801876 <dev_lookup>
+  80193d:	89 c3                	mov    %eax,%ebx
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	85 c0                	test   %eax,%eax
+  801944:	78 1a                	js     801960 <fd_close+0x77>
+		if (dev->dev_close)
+  801946:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801949:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80194c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801951:	85 c0                	test   %eax,%eax
+  801953:	74 0b                	je     801960 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801955:	83 ec 0c             	sub    $0xc,%esp
+  801958:	56                   	push   %esi
+  801959:	ff d0                	call   *%eax
+  80195b:	89 c3                	mov    %eax,%ebx
+  80195d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801960:	83 ec 08             	sub    $0x8,%esp
+  801963:	56                   	push   %esi
+  801964:	6a 00                	push   $0x0
+  801966:	e8 a3 f4 ff ff       	call   800e0e <sys_page_unmap>
+	return r;
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	eb b5                	jmp    801925 <fd_close+0x3c>
+
+00801970 <close>:
+
+int
+close(int fdnum)
+{
+  801970:	55                   	push   %ebp
+  801971:	89 e5                	mov    %esp,%ebp
+  801973:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801976:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801979:	50                   	push   %eax
+  80197a:	ff 75 08             	push   0x8(%ebp)
+  80197d:	e8 a4 fe ff ff       	call   801826 <fd_lookup>
+  801982:	83 c4 10             	add    $0x10,%esp
+  801985:	85 c0                	test   %eax,%eax
+  801987:	79 02                	jns    80198b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801989:	c9                   	leave
+  80198a:	c3                   	ret
+		return fd_close(fd, 1);
+  80198b:	83 ec 08             	sub    $0x8,%esp
+  80198e:	6a 01                	push   $0x1
+  801990:	ff 75 f4             	push   -0xc(%ebp)
+  801993:	e8 51 ff ff ff       	call   8018e9 <fd_close>
+  801998:	83 c4 10             	add    $0x10,%esp
+  80199b:	eb ec                	jmp    801989 <close+0x19>
+
+0080199d <close_all>:
+
+void
+close_all(void)
+{
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	53                   	push   %ebx
+  8019a1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019a9:	83 ec 0c             	sub    $0xc,%esp
+  8019ac:	53                   	push   %ebx
+  8019ad:	e8 be ff ff ff       	call   801970 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019b2:	83 c3 01             	add    $0x1,%ebx
+  8019b5:	83 c4 10             	add    $0x10,%esp
+  8019b8:	83 fb 20             	cmp    $0x20,%ebx
+  8019bb:	75 ec                	jne    8019a9 <close_all+0xc>
+}
+  8019bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c0:	c9                   	leave
+  8019c1:	c3                   	ret
+
+008019c2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019c2:	55                   	push   %ebp
+  8019c3:	89 e5                	mov    %esp,%ebp
+  8019c5:	57                   	push   %edi
+  8019c6:	56                   	push   %esi
+  8019c7:	53                   	push   %ebx
+  8019c8:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019cb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019ce:	50                   	push   %eax
+  8019cf:	ff 75 08             	push   0x8(%ebp)
+  8019d2:	e8 4f fe ff ff       	call   801826 <fd_lookup>
+  8019d7:	89 c3                	mov    %eax,%ebx
+  8019d9:	83 c4 10             	add    $0x10,%esp
+  8019dc:	85 c0                	test   %eax,%eax
+  8019de:	78 7f                	js     801a5f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019e0:	83 ec 0c             	sub    $0xc,%esp
+  8019e3:	ff 75 0c             	push   0xc(%ebp)
+  8019e6:	e8 85 ff ff ff       	call   801970 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019ee:	c1 e6 0c             	shl    $0xc,%esi
+  8019f1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019fa:	89 3c 24             	mov    %edi,(%esp)
+  8019fd:	e8 b7 fd ff ff       	call   8017b9 <fd2data>
+  801a02:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a04:	89 34 24             	mov    %esi,(%esp)
+  801a07:	e8 ad fd ff ff       	call   8017b9 <fd2data>
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a12:	89 d8                	mov    %ebx,%eax
+  801a14:	c1 e8 16             	shr    $0x16,%eax
+  801a17:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a1e:	a8 01                	test   $0x1,%al
+  801a20:	74 11                	je     801a33 <dup+0x71>
+  801a22:	89 d8                	mov    %ebx,%eax
+  801a24:	c1 e8 0c             	shr    $0xc,%eax
+  801a27:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a2e:	f6 c2 01             	test   $0x1,%dl
+  801a31:	75 36                	jne    801a69 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a33:	89 f8                	mov    %edi,%eax
+  801a35:	c1 e8 0c             	shr    $0xc,%eax
+  801a38:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a3f:	83 ec 0c             	sub    $0xc,%esp
+  801a42:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a47:	50                   	push   %eax
+  801a48:	56                   	push   %esi
+  801a49:	6a 00                	push   $0x0
+  801a4b:	57                   	push   %edi
+  801a4c:	6a 00                	push   $0x0
+  801a4e:	e8 4d f3 ff ff       	call   800da0 <sys_page_map>
+  801a53:	89 c3                	mov    %eax,%ebx
+  801a55:	83 c4 20             	add    $0x20,%esp
+  801a58:	85 c0                	test   %eax,%eax
+  801a5a:	78 33                	js     801a8f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a5c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a5f:	89 d8                	mov    %ebx,%eax
+  801a61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a64:	5b                   	pop    %ebx
+  801a65:	5e                   	pop    %esi
+  801a66:	5f                   	pop    %edi
+  801a67:	5d                   	pop    %ebp
+  801a68:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a69:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a70:	83 ec 0c             	sub    $0xc,%esp
+  801a73:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a78:	50                   	push   %eax
+  801a79:	ff 75 d4             	push   -0x2c(%ebp)
+  801a7c:	6a 00                	push   $0x0
+  801a7e:	53                   	push   %ebx
+  801a7f:	6a 00                	push   $0x0
+  801a81:	e8 1a f3 ff ff       	call   800da0 <sys_page_map>
+  801a86:	89 c3                	mov    %eax,%ebx
+  801a88:	83 c4 20             	add    $0x20,%esp
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	79 a4                	jns    801a33 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a8f:	83 ec 08             	sub    $0x8,%esp
+  801a92:	56                   	push   %esi
+  801a93:	6a 00                	push   $0x0
+  801a95:	e8 74 f3 ff ff       	call   800e0e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a9a:	83 c4 08             	add    $0x8,%esp
+  801a9d:	ff 75 d4             	push   -0x2c(%ebp)
+  801aa0:	6a 00                	push   $0x0
+  801aa2:	e8 67 f3 ff ff       	call   800e0e <sys_page_unmap>
+	return r;
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	eb b3                	jmp    801a5f <dup+0x9d>
+
+00801aac <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801aac:	55                   	push   %ebp
+  801aad:	89 e5                	mov    %esp,%ebp
+  801aaf:	56                   	push   %esi
+  801ab0:	53                   	push   %ebx
+  801ab1:	83 ec 18             	sub    $0x18,%esp
+  801ab4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ab7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aba:	50                   	push   %eax
+  801abb:	53                   	push   %ebx
+  801abc:	e8 65 fd ff ff       	call   801826 <fd_lookup>
+  801ac1:	83 c4 10             	add    $0x10,%esp
+  801ac4:	85 c0                	test   %eax,%eax
+  801ac6:	78 3c                	js     801b04 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ac8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801acb:	83 ec 08             	sub    $0x8,%esp
+  801ace:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad1:	50                   	push   %eax
+  801ad2:	ff 36                	push   (%esi)
+  801ad4:	e8 9d fd ff ff       	call   801876 <dev_lookup>
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	78 24                	js     801b04 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ae0:	8b 46 08             	mov    0x8(%esi),%eax
+  801ae3:	83 e0 03             	and    $0x3,%eax
+  801ae6:	83 f8 01             	cmp    $0x1,%eax
+  801ae9:	74 20                	je     801b0b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801aeb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aee:	8b 40 08             	mov    0x8(%eax),%eax
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	74 57                	je     801b4c <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801af5:	83 ec 04             	sub    $0x4,%esp
+  801af8:	ff 75 10             	push   0x10(%ebp)
+  801afb:	ff 75 0c             	push   0xc(%ebp)
+  801afe:	56                   	push   %esi
+  801aff:	ff d0                	call   *%eax
+  801b01:	83 c4 10             	add    $0x10,%esp
+}
+  801b04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b07:	5b                   	pop    %ebx
+  801b08:	5e                   	pop    %esi
+  801b09:	5d                   	pop    %ebp
+  801b0a:	c3                   	ret
+  801b0b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b0d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b12:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b18:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b1d:	76 1c                	jbe    801b3b <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b1f:	8b 42 48             	mov    0x48(%edx),%eax
+  801b22:	83 ec 04             	sub    $0x4,%esp
+  801b25:	53                   	push   %ebx
+  801b26:	50                   	push   %eax
+  801b27:	68 59 2f 80 00       	push   $0x802f59
+  801b2c:	e8 c2 e6 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b39:	eb c9                	jmp    801b04 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b3b:	c1 e8 10             	shr    $0x10,%eax
+  801b3e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b44:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b4a:	eb d3                	jmp    801b1f <read+0x73>
+		return -E_NOT_SUPP;
+  801b4c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b51:	eb b1                	jmp    801b04 <read+0x58>
+
+00801b53 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b53:	55                   	push   %ebp
+  801b54:	89 e5                	mov    %esp,%ebp
+  801b56:	57                   	push   %edi
+  801b57:	56                   	push   %esi
+  801b58:	53                   	push   %ebx
+  801b59:	83 ec 0c             	sub    $0xc,%esp
+  801b5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b5f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b67:	eb 02                	jmp    801b6b <readn+0x18>
+  801b69:	01 c3                	add    %eax,%ebx
+  801b6b:	39 f3                	cmp    %esi,%ebx
+  801b6d:	73 21                	jae    801b90 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b6f:	83 ec 04             	sub    $0x4,%esp
+  801b72:	89 f0                	mov    %esi,%eax
+  801b74:	29 d8                	sub    %ebx,%eax
+  801b76:	50                   	push   %eax
+  801b77:	89 d8                	mov    %ebx,%eax
+  801b79:	03 45 0c             	add    0xc(%ebp),%eax
+  801b7c:	50                   	push   %eax
+  801b7d:	57                   	push   %edi
+  801b7e:	e8 29 ff ff ff       	call   801aac <read>
+		if (m < 0)
+  801b83:	83 c4 10             	add    $0x10,%esp
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 04                	js     801b8e <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b8a:	75 dd                	jne    801b69 <readn+0x16>
+  801b8c:	eb 02                	jmp    801b90 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b8e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b90:	89 d8                	mov    %ebx,%eax
+  801b92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b95:	5b                   	pop    %ebx
+  801b96:	5e                   	pop    %esi
+  801b97:	5f                   	pop    %edi
+  801b98:	5d                   	pop    %ebp
+  801b99:	c3                   	ret
+
+00801b9a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b9a:	55                   	push   %ebp
+  801b9b:	89 e5                	mov    %esp,%ebp
+  801b9d:	56                   	push   %esi
+  801b9e:	53                   	push   %ebx
+  801b9f:	83 ec 18             	sub    $0x18,%esp
+  801ba2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ba5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ba8:	50                   	push   %eax
+  801ba9:	53                   	push   %ebx
+  801baa:	e8 77 fc ff ff       	call   801826 <fd_lookup>
+  801baf:	83 c4 10             	add    $0x10,%esp
+  801bb2:	85 c0                	test   %eax,%eax
+  801bb4:	78 37                	js     801bed <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bb6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bb9:	83 ec 08             	sub    $0x8,%esp
+  801bbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bbf:	50                   	push   %eax
+  801bc0:	ff 36                	push   (%esi)
+  801bc2:	e8 af fc ff ff       	call   801876 <dev_lookup>
+  801bc7:	83 c4 10             	add    $0x10,%esp
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	78 1f                	js     801bed <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bce:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bd2:	74 20                	je     801bf4 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	74 57                	je     801c35 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bde:	83 ec 04             	sub    $0x4,%esp
+  801be1:	ff 75 10             	push   0x10(%ebp)
+  801be4:	ff 75 0c             	push   0xc(%ebp)
+  801be7:	56                   	push   %esi
+  801be8:	ff d0                	call   *%eax
+  801bea:	83 c4 10             	add    $0x10,%esp
+}
+  801bed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf0:	5b                   	pop    %ebx
+  801bf1:	5e                   	pop    %esi
+  801bf2:	5d                   	pop    %ebp
+  801bf3:	c3                   	ret
+  801bf4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bf6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bfb:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c01:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c06:	76 1c                	jbe    801c24 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c08:	8b 42 48             	mov    0x48(%edx),%eax
+  801c0b:	83 ec 04             	sub    $0x4,%esp
+  801c0e:	53                   	push   %ebx
+  801c0f:	50                   	push   %eax
+  801c10:	68 75 2f 80 00       	push   $0x802f75
+  801c15:	e8 d9 e5 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801c1a:	83 c4 10             	add    $0x10,%esp
+  801c1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c22:	eb c9                	jmp    801bed <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c24:	c1 e8 10             	shr    $0x10,%eax
+  801c27:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c2d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c33:	eb d3                	jmp    801c08 <write+0x6e>
+		return -E_NOT_SUPP;
+  801c35:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c3a:	eb b1                	jmp    801bed <write+0x53>
+
+00801c3c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+  801c3f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c45:	50                   	push   %eax
+  801c46:	ff 75 08             	push   0x8(%ebp)
+  801c49:	e8 d8 fb ff ff       	call   801826 <fd_lookup>
+  801c4e:	83 c4 10             	add    $0x10,%esp
+  801c51:	85 c0                	test   %eax,%eax
+  801c53:	78 0e                	js     801c63 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c55:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c5b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+
+00801c65 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c65:	55                   	push   %ebp
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	56                   	push   %esi
+  801c69:	53                   	push   %ebx
+  801c6a:	83 ec 18             	sub    $0x18,%esp
+  801c6d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c70:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c73:	50                   	push   %eax
+  801c74:	53                   	push   %ebx
+  801c75:	e8 ac fb ff ff       	call   801826 <fd_lookup>
+  801c7a:	83 c4 10             	add    $0x10,%esp
+  801c7d:	85 c0                	test   %eax,%eax
+  801c7f:	78 34                	js     801cb5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c81:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c84:	83 ec 08             	sub    $0x8,%esp
+  801c87:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8a:	50                   	push   %eax
+  801c8b:	ff 36                	push   (%esi)
+  801c8d:	e8 e4 fb ff ff       	call   801876 <dev_lookup>
+  801c92:	83 c4 10             	add    $0x10,%esp
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	78 1c                	js     801cb5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c99:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c9d:	74 1d                	je     801cbc <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca2:	8b 40 18             	mov    0x18(%eax),%eax
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	74 54                	je     801cfd <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ca9:	83 ec 08             	sub    $0x8,%esp
+  801cac:	ff 75 0c             	push   0xc(%ebp)
+  801caf:	56                   	push   %esi
+  801cb0:	ff d0                	call   *%eax
+  801cb2:	83 c4 10             	add    $0x10,%esp
+}
+  801cb5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb8:	5b                   	pop    %ebx
+  801cb9:	5e                   	pop    %esi
+  801cba:	5d                   	pop    %ebp
+  801cbb:	c3                   	ret
+  801cbc:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cbe:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cc3:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cc9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cce:	76 1c                	jbe    801cec <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cd0:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cd3:	83 ec 04             	sub    $0x4,%esp
+  801cd6:	53                   	push   %ebx
+  801cd7:	50                   	push   %eax
+  801cd8:	68 38 2f 80 00       	push   $0x802f38
+  801cdd:	e8 11 e5 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801ce2:	83 c4 10             	add    $0x10,%esp
+  801ce5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cea:	eb c9                	jmp    801cb5 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cec:	c1 e8 10             	shr    $0x10,%eax
+  801cef:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cf5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cfb:	eb d3                	jmp    801cd0 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801cfd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d02:	eb b1                	jmp    801cb5 <ftruncate+0x50>
+
+00801d04 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d04:	55                   	push   %ebp
+  801d05:	89 e5                	mov    %esp,%ebp
+  801d07:	56                   	push   %esi
+  801d08:	53                   	push   %ebx
+  801d09:	83 ec 18             	sub    $0x18,%esp
+  801d0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d0f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d12:	50                   	push   %eax
+  801d13:	ff 75 08             	push   0x8(%ebp)
+  801d16:	e8 0b fb ff ff       	call   801826 <fd_lookup>
+  801d1b:	83 c4 10             	add    $0x10,%esp
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	78 49                	js     801d6b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d22:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d25:	83 ec 08             	sub    $0x8,%esp
+  801d28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d2b:	50                   	push   %eax
+  801d2c:	ff 36                	push   (%esi)
+  801d2e:	e8 43 fb ff ff       	call   801876 <dev_lookup>
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 31                	js     801d6b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d41:	74 2f                	je     801d72 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d43:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d46:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d4d:	00 00 00 
+	stat->st_isdir = 0;
+  801d50:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d57:	00 00 00 
+	stat->st_dev = dev;
+  801d5a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d60:	83 ec 08             	sub    $0x8,%esp
+  801d63:	53                   	push   %ebx
+  801d64:	56                   	push   %esi
+  801d65:	ff 50 14             	call   *0x14(%eax)
+  801d68:	83 c4 10             	add    $0x10,%esp
+}
+  801d6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d6e:	5b                   	pop    %ebx
+  801d6f:	5e                   	pop    %esi
+  801d70:	5d                   	pop    %ebp
+  801d71:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d72:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d77:	eb f2                	jmp    801d6b <fstat+0x67>
+
+00801d79 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d79:	55                   	push   %ebp
+  801d7a:	89 e5                	mov    %esp,%ebp
+  801d7c:	56                   	push   %esi
+  801d7d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d7e:	83 ec 08             	sub    $0x8,%esp
+  801d81:	6a 00                	push   $0x0
+  801d83:	ff 75 08             	push   0x8(%ebp)
+  801d86:	e8 e4 01 00 00       	call   801f6f <open>
+  801d8b:	89 c3                	mov    %eax,%ebx
+  801d8d:	83 c4 10             	add    $0x10,%esp
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	78 1b                	js     801daf <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d94:	83 ec 08             	sub    $0x8,%esp
+  801d97:	ff 75 0c             	push   0xc(%ebp)
+  801d9a:	50                   	push   %eax
+  801d9b:	e8 64 ff ff ff       	call   801d04 <fstat>
+  801da0:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801da2:	89 1c 24             	mov    %ebx,(%esp)
+  801da5:	e8 c6 fb ff ff       	call   801970 <close>
+	return r;
+  801daa:	83 c4 10             	add    $0x10,%esp
+  801dad:	89 f3                	mov    %esi,%ebx
+}
+  801daf:	89 d8                	mov    %ebx,%eax
+  801db1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db4:	5b                   	pop    %ebx
+  801db5:	5e                   	pop    %esi
+  801db6:	5d                   	pop    %ebp
+  801db7:	c3                   	ret
+
+00801db8 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801db8:	55                   	push   %ebp
+  801db9:	89 e5                	mov    %esp,%ebp
+  801dbb:	56                   	push   %esi
+  801dbc:	53                   	push   %ebx
+  801dbd:	89 c6                	mov    %eax,%esi
+  801dbf:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801dc1:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801dc8:	74 27                	je     801df1 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dca:	6a 07                	push   $0x7
+  801dcc:	68 00 60 80 00       	push   $0x806000
+  801dd1:	56                   	push   %esi
+  801dd2:	ff 35 00 50 80 00    	push   0x805000
+  801dd8:	e8 b2 0c 00 00       	call   802a8f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ddd:	83 c4 0c             	add    $0xc,%esp
+  801de0:	6a 00                	push   $0x0
+  801de2:	53                   	push   %ebx
+  801de3:	6a 00                	push   $0x0
+  801de5:	e8 8d 0c 00 00       	call   802a77 <ipc_recv>
+}
+  801dea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ded:	5b                   	pop    %ebx
+  801dee:	5e                   	pop    %esi
+  801def:	5d                   	pop    %ebp
+  801df0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801df1:	83 ec 0c             	sub    $0xc,%esp
+  801df4:	6a 01                	push   $0x1
+  801df6:	e8 e8 0c 00 00       	call   802ae3 <ipc_find_env>
+  801dfb:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e00:	83 c4 10             	add    $0x10,%esp
+  801e03:	eb c5                	jmp    801dca <fsipc+0x12>
+
+00801e05 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e05:	55                   	push   %ebp
+  801e06:	89 e5                	mov    %esp,%ebp
+  801e08:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e0e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e11:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e16:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e19:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e23:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e28:	e8 8b ff ff ff       	call   801db8 <fsipc>
+}
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <devfile_flush>:
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e38:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e3b:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e45:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e4a:	e8 69 ff ff ff       	call   801db8 <fsipc>
+}
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+00801e51 <devfile_stat>:
+{
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	53                   	push   %ebx
+  801e55:	83 ec 04             	sub    $0x4,%esp
+  801e58:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e5e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e61:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e70:	e8 43 ff ff ff       	call   801db8 <fsipc>
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	78 2c                	js     801ea5 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e79:	83 ec 08             	sub    $0x8,%esp
+  801e7c:	68 00 60 80 00       	push   $0x806000
+  801e81:	53                   	push   %ebx
+  801e82:	e8 b4 e9 ff ff       	call   80083b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e87:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e8c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e92:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e97:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e9d:	83 c4 10             	add    $0x10,%esp
+  801ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea8:	c9                   	leave
+  801ea9:	c3                   	ret
+
+00801eaa <devfile_write>:
+{
+  801eaa:	55                   	push   %ebp
+  801eab:	89 e5                	mov    %esp,%ebp
+  801ead:	83 ec 0c             	sub    $0xc,%esp
+  801eb0:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801eb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb6:	8b 52 0c             	mov    0xc(%edx),%edx
+  801eb9:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801ebf:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801ec4:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ec9:	39 d0                	cmp    %edx,%eax
+  801ecb:	0f 47 c2             	cmova  %edx,%eax
+  801ece:	50                   	push   %eax
+  801ecf:	ff 75 0c             	push   0xc(%ebp)
+  801ed2:	68 08 60 80 00       	push   $0x806008
+  801ed7:	e8 e5 ea ff ff       	call   8009c1 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801edc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ee6:	e8 cd fe ff ff       	call   801db8 <fsipc>
+}
+  801eeb:	c9                   	leave
+  801eec:	c3                   	ret
+
+00801eed <devfile_read>:
+{
+  801eed:	55                   	push   %ebp
+  801eee:	89 e5                	mov    %esp,%ebp
+  801ef0:	56                   	push   %esi
+  801ef1:	53                   	push   %ebx
+  801ef2:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801efb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801f00:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f06:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f0b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f10:	e8 a3 fe ff ff       	call   801db8 <fsipc>
+  801f15:	89 c3                	mov    %eax,%ebx
+  801f17:	85 c0                	test   %eax,%eax
+  801f19:	78 1f                	js     801f3a <devfile_read+0x4d>
+	assert(r <= n);
+  801f1b:	39 c6                	cmp    %eax,%esi
+  801f1d:	72 24                	jb     801f43 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f1f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f24:	7f 33                	jg     801f59 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f26:	83 ec 04             	sub    $0x4,%esp
+  801f29:	50                   	push   %eax
+  801f2a:	68 00 60 80 00       	push   $0x806000
+  801f2f:	ff 75 0c             	push   0xc(%ebp)
+  801f32:	e8 8a ea ff ff       	call   8009c1 <memmove>
+	return r;
+  801f37:	83 c4 10             	add    $0x10,%esp
+}
+  801f3a:	89 d8                	mov    %ebx,%eax
+  801f3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f3f:	5b                   	pop    %ebx
+  801f40:	5e                   	pop    %esi
+  801f41:	5d                   	pop    %ebp
+  801f42:	c3                   	ret
+	assert(r <= n);
+  801f43:	68 a8 2f 80 00       	push   $0x802fa8
+  801f48:	68 af 2f 80 00       	push   $0x802faf
+  801f4d:	6a 76                	push   $0x76
+  801f4f:	68 c4 2f 80 00       	push   $0x802fc4
+  801f54:	e8 bf e1 ff ff       	call   800118 <_panic>
+	assert(r <= PGSIZE);
+  801f59:	68 cf 2f 80 00       	push   $0x802fcf
+  801f5e:	68 af 2f 80 00       	push   $0x802faf
+  801f63:	6a 77                	push   $0x77
+  801f65:	68 c4 2f 80 00       	push   $0x802fc4
+  801f6a:	e8 a9 e1 ff ff       	call   800118 <_panic>
+
+00801f6f <open>:
+{
+  801f6f:	55                   	push   %ebp
+  801f70:	89 e5                	mov    %esp,%ebp
+  801f72:	56                   	push   %esi
+  801f73:	53                   	push   %ebx
+  801f74:	83 ec 1c             	sub    $0x1c,%esp
+  801f77:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f7a:	56                   	push   %esi
+  801f7b:	e8 80 e8 ff ff       	call   800800 <strlen>
+  801f80:	83 c4 10             	add    $0x10,%esp
+  801f83:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f88:	7f 6c                	jg     801ff6 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f8a:	83 ec 0c             	sub    $0xc,%esp
+  801f8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f90:	50                   	push   %eax
+  801f91:	e8 3a f8 ff ff       	call   8017d0 <fd_alloc>
+  801f96:	89 c3                	mov    %eax,%ebx
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	78 3c                	js     801fdb <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f9f:	83 ec 08             	sub    $0x8,%esp
+  801fa2:	56                   	push   %esi
+  801fa3:	68 00 60 80 00       	push   $0x806000
+  801fa8:	e8 8e e8 ff ff       	call   80083b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801fad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fb0:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fb8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fbd:	e8 f6 fd ff ff       	call   801db8 <fsipc>
+  801fc2:	89 c3                	mov    %eax,%ebx
+  801fc4:	83 c4 10             	add    $0x10,%esp
+  801fc7:	85 c0                	test   %eax,%eax
+  801fc9:	78 19                	js     801fe4 <open+0x75>
+	return fd2num(fd);
+  801fcb:	83 ec 0c             	sub    $0xc,%esp
+  801fce:	ff 75 f4             	push   -0xc(%ebp)
+  801fd1:	e8 d3 f7 ff ff       	call   8017a9 <fd2num>
+  801fd6:	89 c3                	mov    %eax,%ebx
+  801fd8:	83 c4 10             	add    $0x10,%esp
+}
+  801fdb:	89 d8                	mov    %ebx,%eax
+  801fdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe0:	5b                   	pop    %ebx
+  801fe1:	5e                   	pop    %esi
+  801fe2:	5d                   	pop    %ebp
+  801fe3:	c3                   	ret
+		fd_close(fd, 0);
+  801fe4:	83 ec 08             	sub    $0x8,%esp
+  801fe7:	6a 00                	push   $0x0
+  801fe9:	ff 75 f4             	push   -0xc(%ebp)
+  801fec:	e8 f8 f8 ff ff       	call   8018e9 <fd_close>
+		return r;
+  801ff1:	83 c4 10             	add    $0x10,%esp
+  801ff4:	eb e5                	jmp    801fdb <open+0x6c>
+		return -E_BAD_PATH;
+  801ff6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ffb:	eb de                	jmp    801fdb <open+0x6c>
+
+00801ffd <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ffd:	55                   	push   %ebp
+  801ffe:	89 e5                	mov    %esp,%ebp
+  802000:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802003:	ba 00 00 00 00       	mov    $0x0,%edx
+  802008:	b8 08 00 00 00       	mov    $0x8,%eax
+  80200d:	e8 a6 fd ff ff       	call   801db8 <fsipc>
+}
+  802012:	c9                   	leave
+  802013:	c3                   	ret
+
+00802014 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80201a:	68 db 2f 80 00       	push   $0x802fdb
+  80201f:	ff 75 0c             	push   0xc(%ebp)
+  802022:	e8 14 e8 ff ff       	call   80083b <strcpy>
+	return 0;
+}
+  802027:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202c:	c9                   	leave
+  80202d:	c3                   	ret
+
+0080202e <devsock_close>:
+{
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	53                   	push   %ebx
+  802032:	83 ec 10             	sub    $0x10,%esp
+  802035:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802038:	53                   	push   %ebx
+  802039:	e8 e4 0a 00 00       	call   802b22 <pageref>
+  80203e:	89 c2                	mov    %eax,%edx
+  802040:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802043:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802048:	83 fa 01             	cmp    $0x1,%edx
+  80204b:	74 05                	je     802052 <devsock_close+0x24>
+}
+  80204d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802050:	c9                   	leave
+  802051:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802052:	83 ec 0c             	sub    $0xc,%esp
+  802055:	ff 73 0c             	push   0xc(%ebx)
+  802058:	e8 b7 02 00 00       	call   802314 <nsipc_close>
+  80205d:	83 c4 10             	add    $0x10,%esp
+  802060:	eb eb                	jmp    80204d <devsock_close+0x1f>
+
+00802062 <devsock_write>:
+{
+  802062:	55                   	push   %ebp
+  802063:	89 e5                	mov    %esp,%ebp
+  802065:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802068:	6a 00                	push   $0x0
+  80206a:	ff 75 10             	push   0x10(%ebp)
+  80206d:	ff 75 0c             	push   0xc(%ebp)
+  802070:	8b 45 08             	mov    0x8(%ebp),%eax
+  802073:	ff 70 0c             	push   0xc(%eax)
+  802076:	e8 79 03 00 00       	call   8023f4 <nsipc_send>
+}
+  80207b:	c9                   	leave
+  80207c:	c3                   	ret
+
+0080207d <devsock_read>:
+{
+  80207d:	55                   	push   %ebp
+  80207e:	89 e5                	mov    %esp,%ebp
+  802080:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802083:	6a 00                	push   $0x0
+  802085:	ff 75 10             	push   0x10(%ebp)
+  802088:	ff 75 0c             	push   0xc(%ebp)
+  80208b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208e:	ff 70 0c             	push   0xc(%eax)
+  802091:	e8 ef 02 00 00       	call   802385 <nsipc_recv>
+}
+  802096:	c9                   	leave
+  802097:	c3                   	ret
+
+00802098 <fd2sockid>:
+{
+  802098:	55                   	push   %ebp
+  802099:	89 e5                	mov    %esp,%ebp
+  80209b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80209e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020a1:	52                   	push   %edx
+  8020a2:	50                   	push   %eax
+  8020a3:	e8 7e f7 ff ff       	call   801826 <fd_lookup>
+  8020a8:	83 c4 10             	add    $0x10,%esp
+  8020ab:	85 c0                	test   %eax,%eax
+  8020ad:	78 10                	js     8020bf <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020b2:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8020b8:	39 08                	cmp    %ecx,(%eax)
+  8020ba:	75 05                	jne    8020c1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020bc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020bf:	c9                   	leave
+  8020c0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020c1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020c6:	eb f7                	jmp    8020bf <fd2sockid+0x27>
+
+008020c8 <alloc_sockfd>:
+{
+  8020c8:	55                   	push   %ebp
+  8020c9:	89 e5                	mov    %esp,%ebp
+  8020cb:	56                   	push   %esi
+  8020cc:	53                   	push   %ebx
+  8020cd:	83 ec 1c             	sub    $0x1c,%esp
+  8020d0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020d5:	50                   	push   %eax
+  8020d6:	e8 f5 f6 ff ff       	call   8017d0 <fd_alloc>
+  8020db:	89 c3                	mov    %eax,%ebx
+  8020dd:	83 c4 10             	add    $0x10,%esp
+  8020e0:	85 c0                	test   %eax,%eax
+  8020e2:	78 43                	js     802127 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020e4:	83 ec 04             	sub    $0x4,%esp
+  8020e7:	68 07 04 00 00       	push   $0x407
+  8020ec:	ff 75 f4             	push   -0xc(%ebp)
+  8020ef:	6a 00                	push   $0x0
+  8020f1:	e8 3d ec ff ff       	call   800d33 <sys_page_alloc>
+  8020f6:	89 c3                	mov    %eax,%ebx
+  8020f8:	83 c4 10             	add    $0x10,%esp
+  8020fb:	85 c0                	test   %eax,%eax
+  8020fd:	78 28                	js     802127 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802102:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802108:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80210a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80210d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802114:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802117:	83 ec 0c             	sub    $0xc,%esp
+  80211a:	50                   	push   %eax
+  80211b:	e8 89 f6 ff ff       	call   8017a9 <fd2num>
+  802120:	89 c3                	mov    %eax,%ebx
+  802122:	83 c4 10             	add    $0x10,%esp
+  802125:	eb 0c                	jmp    802133 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802127:	83 ec 0c             	sub    $0xc,%esp
+  80212a:	56                   	push   %esi
+  80212b:	e8 e4 01 00 00       	call   802314 <nsipc_close>
+		return r;
+  802130:	83 c4 10             	add    $0x10,%esp
+}
+  802133:	89 d8                	mov    %ebx,%eax
+  802135:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802138:	5b                   	pop    %ebx
+  802139:	5e                   	pop    %esi
+  80213a:	5d                   	pop    %ebp
+  80213b:	c3                   	ret
+
+0080213c <accept>:
+{
+  80213c:	55                   	push   %ebp
+  80213d:	89 e5                	mov    %esp,%ebp
+  80213f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802142:	8b 45 08             	mov    0x8(%ebp),%eax
+  802145:	e8 4e ff ff ff       	call   802098 <fd2sockid>
+  80214a:	85 c0                	test   %eax,%eax
+  80214c:	78 1b                	js     802169 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80214e:	83 ec 04             	sub    $0x4,%esp
+  802151:	ff 75 10             	push   0x10(%ebp)
+  802154:	ff 75 0c             	push   0xc(%ebp)
+  802157:	50                   	push   %eax
+  802158:	e8 0e 01 00 00       	call   80226b <nsipc_accept>
+  80215d:	83 c4 10             	add    $0x10,%esp
+  802160:	85 c0                	test   %eax,%eax
+  802162:	78 05                	js     802169 <accept+0x2d>
+	return alloc_sockfd(r);
+  802164:	e8 5f ff ff ff       	call   8020c8 <alloc_sockfd>
+}
+  802169:	c9                   	leave
+  80216a:	c3                   	ret
+
+0080216b <bind>:
+{
+  80216b:	55                   	push   %ebp
+  80216c:	89 e5                	mov    %esp,%ebp
+  80216e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802171:	8b 45 08             	mov    0x8(%ebp),%eax
+  802174:	e8 1f ff ff ff       	call   802098 <fd2sockid>
+  802179:	85 c0                	test   %eax,%eax
+  80217b:	78 12                	js     80218f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80217d:	83 ec 04             	sub    $0x4,%esp
+  802180:	ff 75 10             	push   0x10(%ebp)
+  802183:	ff 75 0c             	push   0xc(%ebp)
+  802186:	50                   	push   %eax
+  802187:	e8 31 01 00 00       	call   8022bd <nsipc_bind>
+  80218c:	83 c4 10             	add    $0x10,%esp
+}
+  80218f:	c9                   	leave
+  802190:	c3                   	ret
+
+00802191 <shutdown>:
+{
+  802191:	55                   	push   %ebp
+  802192:	89 e5                	mov    %esp,%ebp
+  802194:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802197:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219a:	e8 f9 fe ff ff       	call   802098 <fd2sockid>
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	78 0f                	js     8021b2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8021a3:	83 ec 08             	sub    $0x8,%esp
+  8021a6:	ff 75 0c             	push   0xc(%ebp)
+  8021a9:	50                   	push   %eax
+  8021aa:	e8 43 01 00 00       	call   8022f2 <nsipc_shutdown>
+  8021af:	83 c4 10             	add    $0x10,%esp
+}
+  8021b2:	c9                   	leave
+  8021b3:	c3                   	ret
+
+008021b4 <connect>:
+{
+  8021b4:	55                   	push   %ebp
+  8021b5:	89 e5                	mov    %esp,%ebp
+  8021b7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bd:	e8 d6 fe ff ff       	call   802098 <fd2sockid>
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	78 12                	js     8021d8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021c6:	83 ec 04             	sub    $0x4,%esp
+  8021c9:	ff 75 10             	push   0x10(%ebp)
+  8021cc:	ff 75 0c             	push   0xc(%ebp)
+  8021cf:	50                   	push   %eax
+  8021d0:	e8 59 01 00 00       	call   80232e <nsipc_connect>
+  8021d5:	83 c4 10             	add    $0x10,%esp
+}
+  8021d8:	c9                   	leave
+  8021d9:	c3                   	ret
+
+008021da <listen>:
+{
+  8021da:	55                   	push   %ebp
+  8021db:	89 e5                	mov    %esp,%ebp
+  8021dd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e3:	e8 b0 fe ff ff       	call   802098 <fd2sockid>
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	78 0f                	js     8021fb <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021ec:	83 ec 08             	sub    $0x8,%esp
+  8021ef:	ff 75 0c             	push   0xc(%ebp)
+  8021f2:	50                   	push   %eax
+  8021f3:	e8 6b 01 00 00       	call   802363 <nsipc_listen>
+  8021f8:	83 c4 10             	add    $0x10,%esp
+}
+  8021fb:	c9                   	leave
+  8021fc:	c3                   	ret
+
+008021fd <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021fd:	55                   	push   %ebp
+  8021fe:	89 e5                	mov    %esp,%ebp
+  802200:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802203:	ff 75 10             	push   0x10(%ebp)
+  802206:	ff 75 0c             	push   0xc(%ebp)
+  802209:	ff 75 08             	push   0x8(%ebp)
+  80220c:	e8 41 02 00 00       	call   802452 <nsipc_socket>
+  802211:	83 c4 10             	add    $0x10,%esp
+  802214:	85 c0                	test   %eax,%eax
+  802216:	78 05                	js     80221d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802218:	e8 ab fe ff ff       	call   8020c8 <alloc_sockfd>
+}
+  80221d:	c9                   	leave
+  80221e:	c3                   	ret
+
+0080221f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	53                   	push   %ebx
+  802223:	83 ec 04             	sub    $0x4,%esp
+  802226:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802228:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80222f:	74 26                	je     802257 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802231:	6a 07                	push   $0x7
+  802233:	68 00 70 80 00       	push   $0x807000
+  802238:	53                   	push   %ebx
+  802239:	ff 35 04 50 80 00    	push   0x805004
+  80223f:	e8 4b 08 00 00       	call   802a8f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802244:	83 c4 0c             	add    $0xc,%esp
+  802247:	6a 00                	push   $0x0
+  802249:	6a 00                	push   $0x0
+  80224b:	6a 00                	push   $0x0
+  80224d:	e8 25 08 00 00       	call   802a77 <ipc_recv>
+}
+  802252:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802255:	c9                   	leave
+  802256:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802257:	83 ec 0c             	sub    $0xc,%esp
+  80225a:	6a 02                	push   $0x2
+  80225c:	e8 82 08 00 00       	call   802ae3 <ipc_find_env>
+  802261:	a3 04 50 80 00       	mov    %eax,0x805004
+  802266:	83 c4 10             	add    $0x10,%esp
+  802269:	eb c6                	jmp    802231 <nsipc+0x12>
+
+0080226b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	56                   	push   %esi
+  80226f:	53                   	push   %ebx
+  802270:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802273:	8b 45 08             	mov    0x8(%ebp),%eax
+  802276:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80227b:	8b 06                	mov    (%esi),%eax
+  80227d:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802282:	b8 01 00 00 00       	mov    $0x1,%eax
+  802287:	e8 93 ff ff ff       	call   80221f <nsipc>
+  80228c:	89 c3                	mov    %eax,%ebx
+  80228e:	85 c0                	test   %eax,%eax
+  802290:	79 09                	jns    80229b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802292:	89 d8                	mov    %ebx,%eax
+  802294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802297:	5b                   	pop    %ebx
+  802298:	5e                   	pop    %esi
+  802299:	5d                   	pop    %ebp
+  80229a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80229b:	83 ec 04             	sub    $0x4,%esp
+  80229e:	ff 35 10 70 80 00    	push   0x807010
+  8022a4:	68 00 70 80 00       	push   $0x807000
+  8022a9:	ff 75 0c             	push   0xc(%ebp)
+  8022ac:	e8 10 e7 ff ff       	call   8009c1 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022b1:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022b6:	89 06                	mov    %eax,(%esi)
+  8022b8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022bb:	eb d5                	jmp    802292 <nsipc_accept+0x27>
+
+008022bd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022bd:	55                   	push   %ebp
+  8022be:	89 e5                	mov    %esp,%ebp
+  8022c0:	53                   	push   %ebx
+  8022c1:	83 ec 08             	sub    $0x8,%esp
+  8022c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ca:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022cf:	53                   	push   %ebx
+  8022d0:	ff 75 0c             	push   0xc(%ebp)
+  8022d3:	68 04 70 80 00       	push   $0x807004
+  8022d8:	e8 e4 e6 ff ff       	call   8009c1 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022dd:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022e3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022e8:	e8 32 ff ff ff       	call   80221f <nsipc>
+}
+  8022ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022f0:	c9                   	leave
+  8022f1:	c3                   	ret
+
+008022f2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022f2:	55                   	push   %ebp
+  8022f3:	89 e5                	mov    %esp,%ebp
+  8022f5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802300:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802303:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802308:	b8 03 00 00 00       	mov    $0x3,%eax
+  80230d:	e8 0d ff ff ff       	call   80221f <nsipc>
+}
+  802312:	c9                   	leave
+  802313:	c3                   	ret
+
+00802314 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802314:	55                   	push   %ebp
+  802315:	89 e5                	mov    %esp,%ebp
+  802317:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80231a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802322:	b8 04 00 00 00       	mov    $0x4,%eax
+  802327:	e8 f3 fe ff ff       	call   80221f <nsipc>
+}
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+
+0080232e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80232e:	55                   	push   %ebp
+  80232f:	89 e5                	mov    %esp,%ebp
+  802331:	53                   	push   %ebx
+  802332:	83 ec 08             	sub    $0x8,%esp
+  802335:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802338:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233b:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802340:	53                   	push   %ebx
+  802341:	ff 75 0c             	push   0xc(%ebp)
+  802344:	68 04 70 80 00       	push   $0x807004
+  802349:	e8 73 e6 ff ff       	call   8009c1 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80234e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802354:	b8 05 00 00 00       	mov    $0x5,%eax
+  802359:	e8 c1 fe ff ff       	call   80221f <nsipc>
+}
+  80235e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802361:	c9                   	leave
+  802362:	c3                   	ret
+
+00802363 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802363:	55                   	push   %ebp
+  802364:	89 e5                	mov    %esp,%ebp
+  802366:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802371:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802374:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802379:	b8 06 00 00 00       	mov    $0x6,%eax
+  80237e:	e8 9c fe ff ff       	call   80221f <nsipc>
+}
+  802383:	c9                   	leave
+  802384:	c3                   	ret
+
+00802385 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802385:	55                   	push   %ebp
+  802386:	89 e5                	mov    %esp,%ebp
+  802388:	56                   	push   %esi
+  802389:	53                   	push   %ebx
+  80238a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80238d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802390:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802395:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80239b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80239e:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023a3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023a8:	e8 72 fe ff ff       	call   80221f <nsipc>
+  8023ad:	89 c3                	mov    %eax,%ebx
+  8023af:	85 c0                	test   %eax,%eax
+  8023b1:	78 22                	js     8023d5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023b3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023b8:	39 c6                	cmp    %eax,%esi
+  8023ba:	0f 4e c6             	cmovle %esi,%eax
+  8023bd:	39 c3                	cmp    %eax,%ebx
+  8023bf:	7f 1d                	jg     8023de <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023c1:	83 ec 04             	sub    $0x4,%esp
+  8023c4:	53                   	push   %ebx
+  8023c5:	68 00 70 80 00       	push   $0x807000
+  8023ca:	ff 75 0c             	push   0xc(%ebp)
+  8023cd:	e8 ef e5 ff ff       	call   8009c1 <memmove>
+  8023d2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023d5:	89 d8                	mov    %ebx,%eax
+  8023d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023da:	5b                   	pop    %ebx
+  8023db:	5e                   	pop    %esi
+  8023dc:	5d                   	pop    %ebp
+  8023dd:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023de:	68 e7 2f 80 00       	push   $0x802fe7
+  8023e3:	68 af 2f 80 00       	push   $0x802faf
+  8023e8:	6a 62                	push   $0x62
+  8023ea:	68 fc 2f 80 00       	push   $0x802ffc
+  8023ef:	e8 24 dd ff ff       	call   800118 <_panic>
+
+008023f4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023f4:	55                   	push   %ebp
+  8023f5:	89 e5                	mov    %esp,%ebp
+  8023f7:	53                   	push   %ebx
+  8023f8:	83 ec 04             	sub    $0x4,%esp
+  8023fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802401:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802406:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80240c:	7f 2e                	jg     80243c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80240e:	83 ec 04             	sub    $0x4,%esp
+  802411:	53                   	push   %ebx
+  802412:	ff 75 0c             	push   0xc(%ebp)
+  802415:	68 0c 70 80 00       	push   $0x80700c
+  80241a:	e8 a2 e5 ff ff       	call   8009c1 <memmove>
+	nsipcbuf.send.req_size = size;
+  80241f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802425:	8b 45 14             	mov    0x14(%ebp),%eax
+  802428:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80242d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802432:	e8 e8 fd ff ff       	call   80221f <nsipc>
+}
+  802437:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80243a:	c9                   	leave
+  80243b:	c3                   	ret
+	assert(size < 1600);
+  80243c:	68 08 30 80 00       	push   $0x803008
+  802441:	68 af 2f 80 00       	push   $0x802faf
+  802446:	6a 6d                	push   $0x6d
+  802448:	68 fc 2f 80 00       	push   $0x802ffc
+  80244d:	e8 c6 dc ff ff       	call   800118 <_panic>
+
+00802452 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802458:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802460:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802463:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802468:	8b 45 10             	mov    0x10(%ebp),%eax
+  80246b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802470:	b8 09 00 00 00       	mov    $0x9,%eax
+  802475:	e8 a5 fd ff ff       	call   80221f <nsipc>
+}
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+
+0080247c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80247c:	55                   	push   %ebp
+  80247d:	89 e5                	mov    %esp,%ebp
+  80247f:	56                   	push   %esi
+  802480:	53                   	push   %ebx
+  802481:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802484:	83 ec 0c             	sub    $0xc,%esp
+  802487:	ff 75 08             	push   0x8(%ebp)
+  80248a:	e8 2a f3 ff ff       	call   8017b9 <fd2data>
+  80248f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802491:	83 c4 08             	add    $0x8,%esp
+  802494:	68 14 30 80 00       	push   $0x803014
+  802499:	53                   	push   %ebx
+  80249a:	e8 9c e3 ff ff       	call   80083b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80249f:	8b 46 04             	mov    0x4(%esi),%eax
+  8024a2:	2b 06                	sub    (%esi),%eax
+  8024a4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024aa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024b1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024b4:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024bb:	40 80 00 
+	return 0;
+}
+  8024be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c6:	5b                   	pop    %ebx
+  8024c7:	5e                   	pop    %esi
+  8024c8:	5d                   	pop    %ebp
+  8024c9:	c3                   	ret
+
+008024ca <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024ca:	55                   	push   %ebp
+  8024cb:	89 e5                	mov    %esp,%ebp
+  8024cd:	53                   	push   %ebx
+  8024ce:	83 ec 0c             	sub    $0xc,%esp
+  8024d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024d4:	53                   	push   %ebx
+  8024d5:	6a 00                	push   $0x0
+  8024d7:	e8 32 e9 ff ff       	call   800e0e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024dc:	89 1c 24             	mov    %ebx,(%esp)
+  8024df:	e8 d5 f2 ff ff       	call   8017b9 <fd2data>
+  8024e4:	83 c4 08             	add    $0x8,%esp
+  8024e7:	50                   	push   %eax
+  8024e8:	6a 00                	push   $0x0
+  8024ea:	e8 1f e9 ff ff       	call   800e0e <sys_page_unmap>
+}
+  8024ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f2:	c9                   	leave
+  8024f3:	c3                   	ret
+
+008024f4 <_pipeisclosed>:
+{
+  8024f4:	55                   	push   %ebp
+  8024f5:	89 e5                	mov    %esp,%ebp
+  8024f7:	57                   	push   %edi
+  8024f8:	56                   	push   %esi
+  8024f9:	53                   	push   %ebx
+  8024fa:	83 ec 1c             	sub    $0x1c,%esp
+  8024fd:	89 c7                	mov    %eax,%edi
+  8024ff:	89 d6                	mov    %edx,%esi
+  802501:	eb 3c                	jmp    80253f <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802503:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802506:	83 ec 0c             	sub    $0xc,%esp
+  802509:	57                   	push   %edi
+  80250a:	e8 13 06 00 00       	call   802b22 <pageref>
+  80250f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802512:	89 34 24             	mov    %esi,(%esp)
+  802515:	e8 08 06 00 00       	call   802b22 <pageref>
+  80251a:	89 c2                	mov    %eax,%edx
+  80251c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80251e:	05 00 00 00 20       	add    $0x20000000,%eax
+  802523:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802526:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80252c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802531:	76 31                	jbe    802564 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802533:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802536:	39 c3                	cmp    %eax,%ebx
+  802538:	74 76                	je     8025b0 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80253a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80253d:	74 36                	je     802575 <_pipeisclosed+0x81>
+  80253f:	89 e0                	mov    %esp,%eax
+  802541:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802546:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80254c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802551:	77 b0                	ja     802503 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802553:	c1 e8 10             	shr    $0x10,%eax
+  802556:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80255c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802562:	eb 9f                	jmp    802503 <_pipeisclosed+0xf>
+  802564:	c1 e8 10             	shr    $0x10,%eax
+  802567:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80256d:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802573:	eb be                	jmp    802533 <_pipeisclosed+0x3f>
+  802575:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802577:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80257c:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802582:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802587:	76 16                	jbe    80259f <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802589:	8b 42 58             	mov    0x58(%edx),%eax
+  80258c:	6a 01                	push   $0x1
+  80258e:	50                   	push   %eax
+  80258f:	53                   	push   %ebx
+  802590:	68 1b 30 80 00       	push   $0x80301b
+  802595:	e8 59 dc ff ff       	call   8001f3 <cprintf>
+  80259a:	83 c4 10             	add    $0x10,%esp
+  80259d:	eb a0                	jmp    80253f <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80259f:	c1 e8 10             	shr    $0x10,%eax
+  8025a2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025a8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025ae:	eb d9                	jmp    802589 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8025b0:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025b3:	0f 94 c0             	sete   %al
+  8025b6:	0f b6 c0             	movzbl %al,%eax
+}
+  8025b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025bc:	5b                   	pop    %ebx
+  8025bd:	5e                   	pop    %esi
+  8025be:	5f                   	pop    %edi
+  8025bf:	5d                   	pop    %ebp
+  8025c0:	c3                   	ret
+
+008025c1 <devpipe_write>:
+{
+  8025c1:	55                   	push   %ebp
+  8025c2:	89 e5                	mov    %esp,%ebp
+  8025c4:	57                   	push   %edi
+  8025c5:	56                   	push   %esi
+  8025c6:	53                   	push   %ebx
+  8025c7:	83 ec 28             	sub    $0x28,%esp
+  8025ca:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025cd:	56                   	push   %esi
+  8025ce:	e8 e6 f1 ff ff       	call   8017b9 <fd2data>
+  8025d3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025dd:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025e0:	75 09                	jne    8025eb <devpipe_write+0x2a>
+	return i;
+  8025e2:	89 f8                	mov    %edi,%eax
+  8025e4:	eb 23                	jmp    802609 <devpipe_write+0x48>
+			sys_yield();
+  8025e6:	e8 02 e7 ff ff       	call   800ced <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025eb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025ee:	8b 0b                	mov    (%ebx),%ecx
+  8025f0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025f3:	39 d0                	cmp    %edx,%eax
+  8025f5:	72 1a                	jb     802611 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025f7:	89 da                	mov    %ebx,%edx
+  8025f9:	89 f0                	mov    %esi,%eax
+  8025fb:	e8 f4 fe ff ff       	call   8024f4 <_pipeisclosed>
+  802600:	85 c0                	test   %eax,%eax
+  802602:	74 e2                	je     8025e6 <devpipe_write+0x25>
+				return 0;
+  802604:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80260c:	5b                   	pop    %ebx
+  80260d:	5e                   	pop    %esi
+  80260e:	5f                   	pop    %edi
+  80260f:	5d                   	pop    %ebp
+  802610:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802611:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802614:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802618:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80261b:	89 c2                	mov    %eax,%edx
+  80261d:	c1 fa 1f             	sar    $0x1f,%edx
+  802620:	89 d1                	mov    %edx,%ecx
+  802622:	c1 e9 1b             	shr    $0x1b,%ecx
+  802625:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802628:	83 e2 1f             	and    $0x1f,%edx
+  80262b:	29 ca                	sub    %ecx,%edx
+  80262d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802631:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802635:	83 c0 01             	add    $0x1,%eax
+  802638:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80263b:	83 c7 01             	add    $0x1,%edi
+  80263e:	eb 9d                	jmp    8025dd <devpipe_write+0x1c>
+
+00802640 <devpipe_read>:
+{
+  802640:	55                   	push   %ebp
+  802641:	89 e5                	mov    %esp,%ebp
+  802643:	57                   	push   %edi
+  802644:	56                   	push   %esi
+  802645:	53                   	push   %ebx
+  802646:	83 ec 18             	sub    $0x18,%esp
+  802649:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80264c:	57                   	push   %edi
+  80264d:	e8 67 f1 ff ff       	call   8017b9 <fd2data>
+  802652:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802654:	83 c4 10             	add    $0x10,%esp
+  802657:	be 00 00 00 00       	mov    $0x0,%esi
+  80265c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80265f:	75 13                	jne    802674 <devpipe_read+0x34>
+	return i;
+  802661:	89 f0                	mov    %esi,%eax
+  802663:	eb 02                	jmp    802667 <devpipe_read+0x27>
+				return i;
+  802665:	89 f0                	mov    %esi,%eax
+}
+  802667:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80266a:	5b                   	pop    %ebx
+  80266b:	5e                   	pop    %esi
+  80266c:	5f                   	pop    %edi
+  80266d:	5d                   	pop    %ebp
+  80266e:	c3                   	ret
+			sys_yield();
+  80266f:	e8 79 e6 ff ff       	call   800ced <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802674:	8b 03                	mov    (%ebx),%eax
+  802676:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802679:	75 18                	jne    802693 <devpipe_read+0x53>
+			if (i > 0)
+  80267b:	85 f6                	test   %esi,%esi
+  80267d:	75 e6                	jne    802665 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80267f:	89 da                	mov    %ebx,%edx
+  802681:	89 f8                	mov    %edi,%eax
+  802683:	e8 6c fe ff ff       	call   8024f4 <_pipeisclosed>
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	74 e3                	je     80266f <devpipe_read+0x2f>
+				return 0;
+  80268c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802691:	eb d4                	jmp    802667 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802693:	99                   	cltd
+  802694:	c1 ea 1b             	shr    $0x1b,%edx
+  802697:	01 d0                	add    %edx,%eax
+  802699:	83 e0 1f             	and    $0x1f,%eax
+  80269c:	29 d0                	sub    %edx,%eax
+  80269e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8026a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026a6:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8026a9:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026ac:	83 c6 01             	add    $0x1,%esi
+  8026af:	eb ab                	jmp    80265c <devpipe_read+0x1c>
+
+008026b1 <pipe>:
+{
+  8026b1:	55                   	push   %ebp
+  8026b2:	89 e5                	mov    %esp,%ebp
+  8026b4:	56                   	push   %esi
+  8026b5:	53                   	push   %ebx
+  8026b6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026bc:	50                   	push   %eax
+  8026bd:	e8 0e f1 ff ff       	call   8017d0 <fd_alloc>
+  8026c2:	89 c3                	mov    %eax,%ebx
+  8026c4:	83 c4 10             	add    $0x10,%esp
+  8026c7:	85 c0                	test   %eax,%eax
+  8026c9:	0f 88 23 01 00 00    	js     8027f2 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026cf:	83 ec 04             	sub    $0x4,%esp
+  8026d2:	68 07 04 00 00       	push   $0x407
+  8026d7:	ff 75 f4             	push   -0xc(%ebp)
+  8026da:	6a 00                	push   $0x0
+  8026dc:	e8 52 e6 ff ff       	call   800d33 <sys_page_alloc>
+  8026e1:	89 c3                	mov    %eax,%ebx
+  8026e3:	83 c4 10             	add    $0x10,%esp
+  8026e6:	85 c0                	test   %eax,%eax
+  8026e8:	0f 88 04 01 00 00    	js     8027f2 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026ee:	83 ec 0c             	sub    $0xc,%esp
+  8026f1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026f4:	50                   	push   %eax
+  8026f5:	e8 d6 f0 ff ff       	call   8017d0 <fd_alloc>
+  8026fa:	89 c3                	mov    %eax,%ebx
+  8026fc:	83 c4 10             	add    $0x10,%esp
+  8026ff:	85 c0                	test   %eax,%eax
+  802701:	0f 88 db 00 00 00    	js     8027e2 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802707:	83 ec 04             	sub    $0x4,%esp
+  80270a:	68 07 04 00 00       	push   $0x407
+  80270f:	ff 75 f0             	push   -0x10(%ebp)
+  802712:	6a 00                	push   $0x0
+  802714:	e8 1a e6 ff ff       	call   800d33 <sys_page_alloc>
+  802719:	89 c3                	mov    %eax,%ebx
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	0f 88 bc 00 00 00    	js     8027e2 <pipe+0x131>
+	va = fd2data(fd0);
+  802726:	83 ec 0c             	sub    $0xc,%esp
+  802729:	ff 75 f4             	push   -0xc(%ebp)
+  80272c:	e8 88 f0 ff ff       	call   8017b9 <fd2data>
+  802731:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802733:	83 c4 0c             	add    $0xc,%esp
+  802736:	68 07 04 00 00       	push   $0x407
+  80273b:	50                   	push   %eax
+  80273c:	6a 00                	push   $0x0
+  80273e:	e8 f0 e5 ff ff       	call   800d33 <sys_page_alloc>
+  802743:	89 c3                	mov    %eax,%ebx
+  802745:	83 c4 10             	add    $0x10,%esp
+  802748:	85 c0                	test   %eax,%eax
+  80274a:	0f 88 82 00 00 00    	js     8027d2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802750:	83 ec 0c             	sub    $0xc,%esp
+  802753:	ff 75 f0             	push   -0x10(%ebp)
+  802756:	e8 5e f0 ff ff       	call   8017b9 <fd2data>
+  80275b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802762:	50                   	push   %eax
+  802763:	6a 00                	push   $0x0
+  802765:	56                   	push   %esi
+  802766:	6a 00                	push   $0x0
+  802768:	e8 33 e6 ff ff       	call   800da0 <sys_page_map>
+  80276d:	89 c3                	mov    %eax,%ebx
+  80276f:	83 c4 20             	add    $0x20,%esp
+  802772:	85 c0                	test   %eax,%eax
+  802774:	78 4e                	js     8027c4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802776:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80277b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80277e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802780:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802783:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80278a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80278d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80278f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802792:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802799:	83 ec 0c             	sub    $0xc,%esp
+  80279c:	ff 75 f4             	push   -0xc(%ebp)
+  80279f:	e8 05 f0 ff ff       	call   8017a9 <fd2num>
+  8027a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027a7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027a9:	83 c4 04             	add    $0x4,%esp
+  8027ac:	ff 75 f0             	push   -0x10(%ebp)
+  8027af:	e8 f5 ef ff ff       	call   8017a9 <fd2num>
+  8027b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027b7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027ba:	83 c4 10             	add    $0x10,%esp
+  8027bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027c2:	eb 2e                	jmp    8027f2 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027c4:	83 ec 08             	sub    $0x8,%esp
+  8027c7:	56                   	push   %esi
+  8027c8:	6a 00                	push   $0x0
+  8027ca:	e8 3f e6 ff ff       	call   800e0e <sys_page_unmap>
+  8027cf:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027d2:	83 ec 08             	sub    $0x8,%esp
+  8027d5:	ff 75 f0             	push   -0x10(%ebp)
+  8027d8:	6a 00                	push   $0x0
+  8027da:	e8 2f e6 ff ff       	call   800e0e <sys_page_unmap>
+  8027df:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027e2:	83 ec 08             	sub    $0x8,%esp
+  8027e5:	ff 75 f4             	push   -0xc(%ebp)
+  8027e8:	6a 00                	push   $0x0
+  8027ea:	e8 1f e6 ff ff       	call   800e0e <sys_page_unmap>
+  8027ef:	83 c4 10             	add    $0x10,%esp
+}
+  8027f2:	89 d8                	mov    %ebx,%eax
+  8027f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027f7:	5b                   	pop    %ebx
+  8027f8:	5e                   	pop    %esi
+  8027f9:	5d                   	pop    %ebp
+  8027fa:	c3                   	ret
+
+008027fb <pipeisclosed>:
+{
+  8027fb:	55                   	push   %ebp
+  8027fc:	89 e5                	mov    %esp,%ebp
+  8027fe:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802801:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802804:	50                   	push   %eax
+  802805:	ff 75 08             	push   0x8(%ebp)
+  802808:	e8 19 f0 ff ff       	call   801826 <fd_lookup>
+  80280d:	83 c4 10             	add    $0x10,%esp
+  802810:	85 c0                	test   %eax,%eax
+  802812:	78 18                	js     80282c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802814:	83 ec 0c             	sub    $0xc,%esp
+  802817:	ff 75 f4             	push   -0xc(%ebp)
+  80281a:	e8 9a ef ff ff       	call   8017b9 <fd2data>
+  80281f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802821:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802824:	e8 cb fc ff ff       	call   8024f4 <_pipeisclosed>
+  802829:	83 c4 10             	add    $0x10,%esp
+}
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+
+0080282e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80282e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802833:	c3                   	ret
+
+00802834 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802834:	55                   	push   %ebp
+  802835:	89 e5                	mov    %esp,%ebp
+  802837:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80283a:	68 33 30 80 00       	push   $0x803033
+  80283f:	ff 75 0c             	push   0xc(%ebp)
+  802842:	e8 f4 df ff ff       	call   80083b <strcpy>
+	return 0;
+}
+  802847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284c:	c9                   	leave
+  80284d:	c3                   	ret
+
+0080284e <devcons_write>:
+{
+  80284e:	55                   	push   %ebp
+  80284f:	89 e5                	mov    %esp,%ebp
+  802851:	57                   	push   %edi
+  802852:	56                   	push   %esi
+  802853:	53                   	push   %ebx
+  802854:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80285a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80285f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802865:	eb 2e                	jmp    802895 <devcons_write+0x47>
+		m = n - tot;
+  802867:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80286a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80286c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802871:	39 c3                	cmp    %eax,%ebx
+  802873:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802876:	83 ec 04             	sub    $0x4,%esp
+  802879:	53                   	push   %ebx
+  80287a:	89 f0                	mov    %esi,%eax
+  80287c:	03 45 0c             	add    0xc(%ebp),%eax
+  80287f:	50                   	push   %eax
+  802880:	57                   	push   %edi
+  802881:	e8 3b e1 ff ff       	call   8009c1 <memmove>
+		sys_cputs(buf, m);
+  802886:	83 c4 08             	add    $0x8,%esp
+  802889:	53                   	push   %ebx
+  80288a:	57                   	push   %edi
+  80288b:	e8 24 e3 ff ff       	call   800bb4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802890:	01 de                	add    %ebx,%esi
+  802892:	83 c4 10             	add    $0x10,%esp
+  802895:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802898:	72 cd                	jb     802867 <devcons_write+0x19>
+}
+  80289a:	89 f0                	mov    %esi,%eax
+  80289c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80289f:	5b                   	pop    %ebx
+  8028a0:	5e                   	pop    %esi
+  8028a1:	5f                   	pop    %edi
+  8028a2:	5d                   	pop    %ebp
+  8028a3:	c3                   	ret
+
+008028a4 <devcons_read>:
+{
+  8028a4:	55                   	push   %ebp
+  8028a5:	89 e5                	mov    %esp,%ebp
+  8028a7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8028aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028af:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028b3:	75 07                	jne    8028bc <devcons_read+0x18>
+  8028b5:	eb 1f                	jmp    8028d6 <devcons_read+0x32>
+		sys_yield();
+  8028b7:	e8 31 e4 ff ff       	call   800ced <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028bc:	e8 37 e3 ff ff       	call   800bf8 <sys_cgetc>
+  8028c1:	85 c0                	test   %eax,%eax
+  8028c3:	74 f2                	je     8028b7 <devcons_read+0x13>
+	if (c < 0)
+  8028c5:	78 0f                	js     8028d6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028c7:	83 f8 04             	cmp    $0x4,%eax
+  8028ca:	74 0c                	je     8028d8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028cf:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028d1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028d6:	c9                   	leave
+  8028d7:	c3                   	ret
+		return 0;
+  8028d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028dd:	eb f7                	jmp    8028d6 <devcons_read+0x32>
+
+008028df <cputchar>:
+{
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028eb:	6a 01                	push   $0x1
+  8028ed:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028f0:	50                   	push   %eax
+  8028f1:	e8 be e2 ff ff       	call   800bb4 <sys_cputs>
+}
+  8028f6:	83 c4 10             	add    $0x10,%esp
+  8028f9:	c9                   	leave
+  8028fa:	c3                   	ret
+
+008028fb <getchar>:
+{
+  8028fb:	55                   	push   %ebp
+  8028fc:	89 e5                	mov    %esp,%ebp
+  8028fe:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802901:	6a 01                	push   $0x1
+  802903:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802906:	50                   	push   %eax
+  802907:	6a 00                	push   $0x0
+  802909:	e8 9e f1 ff ff       	call   801aac <read>
+	if (r < 0)
+  80290e:	83 c4 10             	add    $0x10,%esp
+  802911:	85 c0                	test   %eax,%eax
+  802913:	78 06                	js     80291b <getchar+0x20>
+	if (r < 1)
+  802915:	74 06                	je     80291d <getchar+0x22>
+	return c;
+  802917:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80291b:	c9                   	leave
+  80291c:	c3                   	ret
+		return -E_EOF;
+  80291d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802922:	eb f7                	jmp    80291b <getchar+0x20>
+
+00802924 <iscons>:
+{
+  802924:	55                   	push   %ebp
+  802925:	89 e5                	mov    %esp,%ebp
+  802927:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80292a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80292d:	50                   	push   %eax
+  80292e:	ff 75 08             	push   0x8(%ebp)
+  802931:	e8 f0 ee ff ff       	call   801826 <fd_lookup>
+  802936:	83 c4 10             	add    $0x10,%esp
+  802939:	85 c0                	test   %eax,%eax
+  80293b:	78 11                	js     80294e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80293d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802940:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802946:	39 10                	cmp    %edx,(%eax)
+  802948:	0f 94 c0             	sete   %al
+  80294b:	0f b6 c0             	movzbl %al,%eax
+}
+  80294e:	c9                   	leave
+  80294f:	c3                   	ret
+
+00802950 <opencons>:
+{
+  802950:	55                   	push   %ebp
+  802951:	89 e5                	mov    %esp,%ebp
+  802953:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802956:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802959:	50                   	push   %eax
+  80295a:	e8 71 ee ff ff       	call   8017d0 <fd_alloc>
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	85 c0                	test   %eax,%eax
+  802964:	78 3a                	js     8029a0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802966:	83 ec 04             	sub    $0x4,%esp
+  802969:	68 07 04 00 00       	push   $0x407
+  80296e:	ff 75 f4             	push   -0xc(%ebp)
+  802971:	6a 00                	push   $0x0
+  802973:	e8 bb e3 ff ff       	call   800d33 <sys_page_alloc>
+  802978:	83 c4 10             	add    $0x10,%esp
+  80297b:	85 c0                	test   %eax,%eax
+  80297d:	78 21                	js     8029a0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80297f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802982:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802988:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80298a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80298d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802994:	83 ec 0c             	sub    $0xc,%esp
+  802997:	50                   	push   %eax
+  802998:	e8 0c ee ff ff       	call   8017a9 <fd2num>
+  80299d:	83 c4 10             	add    $0x10,%esp
+}
+  8029a0:	c9                   	leave
+  8029a1:	c3                   	ret
+
+008029a2 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  8029a2:	55                   	push   %ebp
+  8029a3:	89 e5                	mov    %esp,%ebp
+  8029a5:	56                   	push   %esi
+  8029a6:	53                   	push   %ebx
+  8029a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8029b0:	85 c0                	test   %eax,%eax
+  8029b2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029b7:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8029ba:	83 ec 08             	sub    $0x8,%esp
+  8029bd:	ff 75 14             	push   0x14(%ebp)
+  8029c0:	50                   	push   %eax
+  8029c1:	e8 7e e7 ff ff       	call   801144 <sys_ipc_recv_until>
+  8029c6:	83 c4 10             	add    $0x10,%esp
+  8029c9:	85 c0                	test   %eax,%eax
+  8029cb:	78 61                	js     802a2e <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029cd:	85 f6                	test   %esi,%esi
+  8029cf:	74 1c                	je     8029ed <ipc_recv_until+0x4b>
+  8029d1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029d3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029d8:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029de:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029e3:	76 5f                	jbe    802a44 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029e5:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029eb:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029ed:	85 db                	test   %ebx,%ebx
+  8029ef:	74 1c                	je     802a0d <ipc_recv_until+0x6b>
+  8029f1:	89 e0                	mov    %esp,%eax
+  8029f3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029f8:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029fe:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a03:	76 50                	jbe    802a55 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802a05:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802a0b:	89 03                	mov    %eax,(%ebx)
+  802a0d:	89 e0                	mov    %esp,%eax
+  802a0f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a14:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a1a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a1f:	76 45                	jbe    802a66 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a21:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a2a:	5b                   	pop    %ebx
+  802a2b:	5e                   	pop    %esi
+  802a2c:	5d                   	pop    %ebp
+  802a2d:	c3                   	ret
+		if (from_env_store)
+  802a2e:	85 f6                	test   %esi,%esi
+  802a30:	74 06                	je     802a38 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a32:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a38:	85 db                	test   %ebx,%ebx
+  802a3a:	74 eb                	je     802a27 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a3c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a42:	eb e3                	jmp    802a27 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a44:	c1 e8 10             	shr    $0x10,%eax
+  802a47:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a4d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a53:	eb 90                	jmp    8029e5 <ipc_recv_until+0x43>
+  802a55:	c1 e8 10             	shr    $0x10,%eax
+  802a58:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a5e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a64:	eb 9f                	jmp    802a05 <ipc_recv_until+0x63>
+  802a66:	c1 e8 10             	shr    $0x10,%eax
+  802a69:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a6f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a75:	eb aa                	jmp    802a21 <ipc_recv_until+0x7f>
+
+00802a77 <ipc_recv>:
+{
+  802a77:	55                   	push   %ebp
+  802a78:	89 e5                	mov    %esp,%ebp
+  802a7a:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a7d:	6a 00                	push   $0x0
+  802a7f:	ff 75 10             	push   0x10(%ebp)
+  802a82:	ff 75 0c             	push   0xc(%ebp)
+  802a85:	ff 75 08             	push   0x8(%ebp)
+  802a88:	e8 15 ff ff ff       	call   8029a2 <ipc_recv_until>
+}
+  802a8d:	c9                   	leave
+  802a8e:	c3                   	ret
+
+00802a8f <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	57                   	push   %edi
+  802a93:	56                   	push   %esi
+  802a94:	53                   	push   %ebx
+  802a95:	83 ec 0c             	sub    $0xc,%esp
+  802a98:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802aa1:	85 db                	test   %ebx,%ebx
+  802aa3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802aa8:	0f 44 d8             	cmove  %eax,%ebx
+  802aab:	eb 05                	jmp    802ab2 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802aad:	e8 3b e2 ff ff       	call   800ced <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802ab2:	ff 75 14             	push   0x14(%ebp)
+  802ab5:	53                   	push   %ebx
+  802ab6:	56                   	push   %esi
+  802ab7:	57                   	push   %edi
+  802ab8:	e8 d3 e5 ff ff       	call   801090 <sys_ipc_try_send>
+  802abd:	83 c4 10             	add    $0x10,%esp
+  802ac0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ac3:	74 e8                	je     802aad <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802ac5:	85 c0                	test   %eax,%eax
+  802ac7:	78 08                	js     802ad1 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802ac9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802acc:	5b                   	pop    %ebx
+  802acd:	5e                   	pop    %esi
+  802ace:	5f                   	pop    %edi
+  802acf:	5d                   	pop    %ebp
+  802ad0:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802ad1:	50                   	push   %eax
+  802ad2:	68 3f 30 80 00       	push   $0x80303f
+  802ad7:	6a 4f                	push   $0x4f
+  802ad9:	68 52 30 80 00       	push   $0x803052
+  802ade:	e8 35 d6 ff ff       	call   800118 <_panic>
+
+00802ae3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ae3:	55                   	push   %ebp
+  802ae4:	89 e5                	mov    %esp,%ebp
+  802ae6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802aee:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802af4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802afa:	8b 52 50             	mov    0x50(%edx),%edx
+  802afd:	39 ca                	cmp    %ecx,%edx
+  802aff:	74 11                	je     802b12 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802b01:	83 c0 01             	add    $0x1,%eax
+  802b04:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802b09:	75 e3                	jne    802aee <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b10:	eb 0e                	jmp    802b20 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802b12:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b18:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b1d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b20:	5d                   	pop    %ebp
+  802b21:	c3                   	ret
+
+00802b22 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b22:	55                   	push   %ebp
+  802b23:	89 e5                	mov    %esp,%ebp
+  802b25:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b28:	89 c2                	mov    %eax,%edx
+  802b2a:	c1 ea 16             	shr    $0x16,%edx
+  802b2d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b34:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b39:	f6 c1 01             	test   $0x1,%cl
+  802b3c:	74 1a                	je     802b58 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b3e:	c1 e8 0c             	shr    $0xc,%eax
+  802b41:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b48:	a8 01                	test   $0x1,%al
+  802b4a:	74 0c                	je     802b58 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b4c:	c1 e8 0c             	shr    $0xc,%eax
+  802b4f:	c1 e0 04             	shl    $0x4,%eax
+  802b52:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b58:	89 d0                	mov    %edx,%eax
+  802b5a:	5d                   	pop    %ebp
+  802b5b:	c3                   	ret
@@ -0,0 +1,6353 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9d 01 00 00       	call   8001ce <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+	}
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 63 0e 00 00       	call   800ead <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+		panic("sys_page_alloc: %e", r);
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 b6 0e 00 00       	call   800f1a <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+		panic("sys_page_map: %e", r);
+	memmove(UTEMP, addr, PGSIZE);
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 bd 0a 00 00       	call   800b3b <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 fb 0e 00 00       	call   800f88 <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+		panic("sys_page_unmap: %e", r);
+}
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  80009b:	50                   	push   %eax
+  80009c:	68 e0 2c 80 00       	push   $0x802ce0
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 f3 2c 80 00       	push   $0x802cf3
+  8000a8:	e8 e5 01 00 00       	call   800292 <_panic>
+		panic("sys_page_map: %e", r);
+  8000ad:	50                   	push   %eax
+  8000ae:	68 03 2d 80 00       	push   $0x802d03
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 f3 2c 80 00       	push   $0x802cf3
+  8000ba:	e8 d3 01 00 00       	call   800292 <_panic>
+		panic("sys_page_unmap: %e", r);
+  8000bf:	50                   	push   %eax
+  8000c0:	68 14 2d 80 00       	push   $0x802d14
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 f3 2c 80 00       	push   $0x802cf3
+  8000cc:	e8 c1 01 00 00       	call   800292 <_panic>
+
+008000d1 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8000d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+	if (envid < 0)
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 23                	js     800108 <dumbfork+0x37>
+		panic("sys_exofork: %e", envid);
+	if (envid == 0) {
+  8000e5:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ea:	75 44                	jne    800130 <dumbfork+0x5f>
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		mainenv = &envs[ENVX(sys_getenvid())];
+  8000ec:	e8 30 0d 00 00       	call   800e21 <sys_getenvid>
+  8000f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800101:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  800106:	eb 57                	jmp    80015f <dumbfork+0x8e>
+		panic("sys_exofork: %e", envid);
+  800108:	50                   	push   %eax
+  800109:	68 27 2d 80 00       	push   $0x802d27
+  80010e:	6a 37                	push   $0x37
+  800110:	68 f3 2c 80 00       	push   $0x802cf3
+  800115:	e8 78 01 00 00       	call   800292 <_panic>
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+		duppage(envid, addr);
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	52                   	push   %edx
+  80011e:	53                   	push   %ebx
+  80011f:	e8 0f ff ff ff       	call   800033 <duppage>
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  800124:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800127:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800133:	81 fa 00 80 80 00    	cmp    $0x808000,%edx
+  800139:	72 df                	jb     80011a <dumbfork+0x49>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800141:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800146:	50                   	push   %eax
+  800147:	53                   	push   %ebx
+  800148:	e8 e6 fe ff ff       	call   800033 <duppage>
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80014d:	83 c4 08             	add    $0x8,%esp
+  800150:	6a 02                	push   $0x2
+  800152:	53                   	push   %ebx
+  800153:	e8 9b 0e 00 00       	call   800ff3 <sys_env_set_status>
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	78 07                	js     800166 <dumbfork+0x95>
+		panic("sys_env_set_status: %e", r);
+
+	return envid;
+}
+  80015f:	89 d8                	mov    %ebx,%eax
+  800161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+		panic("sys_env_set_status: %e", r);
+  800166:	50                   	push   %eax
+  800167:	68 37 2d 80 00       	push   $0x802d37
+  80016c:	6a 4c                	push   $0x4c
+  80016e:	68 f3 2c 80 00       	push   $0x802cf3
+  800173:	e8 1a 01 00 00       	call   800292 <_panic>
+
+00800178 <umain>:
+{
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	57                   	push   %edi
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+	who = dumbfork();
+  800181:	e8 4b ff ff ff       	call   8000d1 <dumbfork>
+  800186:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	bf 4e 2d 80 00       	mov    $0x802d4e,%edi
+  80018f:	b8 55 2d 80 00       	mov    $0x802d55,%eax
+  800194:	0f 44 f8             	cmove  %eax,%edi
+  800197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019c:	eb 1f                	jmp    8001bd <umain+0x45>
+  80019e:	83 fb 13             	cmp    $0x13,%ebx
+  8001a1:	7f 23                	jg     8001c6 <umain+0x4e>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	57                   	push   %edi
+  8001a7:	53                   	push   %ebx
+  8001a8:	68 5b 2d 80 00       	push   $0x802d5b
+  8001ad:	e8 bb 01 00 00       	call   80036d <cprintf>
+		sys_yield();
+  8001b2:	e8 b0 0c 00 00       	call   800e67 <sys_yield>
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8001b7:	83 c3 01             	add    $0x1,%ebx
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	85 f6                	test   %esi,%esi
+  8001bf:	74 dd                	je     80019e <umain+0x26>
+  8001c1:	83 fb 09             	cmp    $0x9,%ebx
+  8001c4:	7e dd                	jle    8001a3 <umain+0x2b>
+}
+  8001c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c9:	5b                   	pop    %ebx
+  8001ca:	5e                   	pop    %esi
+  8001cb:	5f                   	pop    %edi
+  8001cc:	5d                   	pop    %ebp
+  8001cd:	c3                   	ret
+
+008001ce <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	57                   	push   %edi
+  8001d2:	56                   	push   %esi
+  8001d3:	53                   	push   %ebx
+  8001d4:	83 ec 0c             	sub    $0xc,%esp
+  8001d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8001da:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001e2:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8001e4:	c1 ea 0b             	shr    $0xb,%edx
+  8001e7:	83 f2 01             	xor    $0x1,%edx
+  8001ea:	83 e2 01             	and    $0x1,%edx
+  8001ed:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8001f3:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8001fa:	00 00 00 
+	envid = sys_getenvid();
+  8001fd:	e8 1f 0c 00 00       	call   800e21 <sys_getenvid>
+  800202:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800204:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800209:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80020f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800215:	8b 52 48             	mov    0x48(%edx),%edx
+  800218:	39 ca                	cmp    %ecx,%edx
+  80021a:	74 27                	je     800243 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80021c:	83 c0 01             	add    $0x1,%eax
+  80021f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800224:	75 e3                	jne    800209 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800226:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80022d:	75 24                	jne    800253 <libmain+0x85>
+		panic("libmain can't find the environment");
+  80022f:	83 ec 04             	sub    $0x4,%esp
+  800232:	68 70 2d 80 00       	push   $0x802d70
+  800237:	6a 23                	push   $0x23
+  800239:	68 93 2d 80 00       	push   $0x802d93
+  80023e:	e8 4f 00 00 00       	call   800292 <_panic>
+			mainenv = &envs[i];
+  800243:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800249:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80024e:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800253:	85 ff                	test   %edi,%edi
+  800255:	7e 07                	jle    80025e <libmain+0x90>
+		binaryname = argv[0];
+  800257:	8b 06                	mov    (%esi),%eax
+  800259:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80025e:	83 ec 08             	sub    $0x8,%esp
+  800261:	56                   	push   %esi
+  800262:	57                   	push   %edi
+  800263:	e8 10 ff ff ff       	call   800178 <umain>
+
+	// exit gracefully
+	exit();
+  800268:	e8 0b 00 00 00       	call   800278 <exit>
+}
+  80026d:	83 c4 10             	add    $0x10,%esp
+  800270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800273:	5b                   	pop    %ebx
+  800274:	5e                   	pop    %esi
+  800275:	5f                   	pop    %edi
+  800276:	5d                   	pop    %ebp
+  800277:	c3                   	ret
+
+00800278 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800278:	55                   	push   %ebp
+  800279:	89 e5                	mov    %esp,%ebp
+  80027b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80027e:	e8 94 18 00 00       	call   801b17 <close_all>
+	sys_env_destroy(0);
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	6a 00                	push   $0x0
+  800288:	e8 2b 0b 00 00       	call   800db8 <sys_env_destroy>
+}
+  80028d:	83 c4 10             	add    $0x10,%esp
+  800290:	c9                   	leave
+  800291:	c3                   	ret
+
+00800292 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	56                   	push   %esi
+  800296:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800297:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80029a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002a0:	e8 7c 0b 00 00       	call   800e21 <sys_getenvid>
+  8002a5:	83 ec 0c             	sub    $0xc,%esp
+  8002a8:	ff 75 0c             	push   0xc(%ebp)
+  8002ab:	ff 75 08             	push   0x8(%ebp)
+  8002ae:	56                   	push   %esi
+  8002af:	50                   	push   %eax
+  8002b0:	68 ac 2d 80 00       	push   $0x802dac
+  8002b5:	e8 b3 00 00 00       	call   80036d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002ba:	83 c4 18             	add    $0x18,%esp
+  8002bd:	53                   	push   %ebx
+  8002be:	ff 75 10             	push   0x10(%ebp)
+  8002c1:	e8 56 00 00 00       	call   80031c <vcprintf>
+	cprintf("\n");
+  8002c6:	c7 04 24 6b 2d 80 00 	movl   $0x802d6b,(%esp)
+  8002cd:	e8 9b 00 00 00       	call   80036d <cprintf>
+  8002d2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002d5:	cc                   	int3
+	while (1)
+  8002d6:	eb fd                	jmp    8002d5 <_panic+0x43>
+
+008002d8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002d8:	55                   	push   %ebp
+  8002d9:	89 e5                	mov    %esp,%ebp
+  8002db:	53                   	push   %ebx
+  8002dc:	83 ec 04             	sub    $0x4,%esp
+  8002df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002e2:	8b 13                	mov    (%ebx),%edx
+  8002e4:	8d 42 01             	lea    0x1(%edx),%eax
+  8002e7:	89 03                	mov    %eax,(%ebx)
+  8002e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002ec:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002f5:	74 09                	je     800300 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002f7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002fe:	c9                   	leave
+  8002ff:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800300:	83 ec 08             	sub    $0x8,%esp
+  800303:	68 ff 00 00 00       	push   $0xff
+  800308:	8d 43 08             	lea    0x8(%ebx),%eax
+  80030b:	50                   	push   %eax
+  80030c:	e8 1d 0a 00 00       	call   800d2e <sys_cputs>
+		b->idx = 0;
+  800311:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800317:	83 c4 10             	add    $0x10,%esp
+  80031a:	eb db                	jmp    8002f7 <putch+0x1f>
+
+0080031c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800325:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80032c:	00 00 00 
+	b.cnt = 0;
+  80032f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800336:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800339:	ff 75 0c             	push   0xc(%ebp)
+  80033c:	ff 75 08             	push   0x8(%ebp)
+  80033f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800345:	50                   	push   %eax
+  800346:	68 d8 02 80 00       	push   $0x8002d8
+  80034b:	e8 fb 00 00 00       	call   80044b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800350:	83 c4 08             	add    $0x8,%esp
+  800353:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800359:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80035f:	50                   	push   %eax
+  800360:	e8 c9 09 00 00       	call   800d2e <sys_cputs>
+
+	return b.cnt;
+}
+  800365:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80036b:	c9                   	leave
+  80036c:	c3                   	ret
+
+0080036d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80036d:	55                   	push   %ebp
+  80036e:	89 e5                	mov    %esp,%ebp
+  800370:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800373:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800376:	50                   	push   %eax
+  800377:	ff 75 08             	push   0x8(%ebp)
+  80037a:	e8 9d ff ff ff       	call   80031c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80037f:	c9                   	leave
+  800380:	c3                   	ret
+
+00800381 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800381:	55                   	push   %ebp
+  800382:	89 e5                	mov    %esp,%ebp
+  800384:	57                   	push   %edi
+  800385:	56                   	push   %esi
+  800386:	53                   	push   %ebx
+  800387:	83 ec 1c             	sub    $0x1c,%esp
+  80038a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80038d:	89 d6                	mov    %edx,%esi
+  80038f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800392:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800395:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800398:	73 0b                	jae    8003a5 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80039a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80039d:	c1 e7 08             	shl    $0x8,%edi
+  8003a0:	0b 7d 10             	or     0x10(%ebp),%edi
+  8003a3:	eb 36                	jmp    8003db <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8003a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ad:	f7 75 08             	divl   0x8(%ebp)
+  8003b0:	89 c1                	mov    %eax,%ecx
+  8003b2:	ff 75 14             	push   0x14(%ebp)
+  8003b5:	ff 75 10             	push   0x10(%ebp)
+  8003b8:	83 eb 01             	sub    $0x1,%ebx
+  8003bb:	53                   	push   %ebx
+  8003bc:	ff 75 08             	push   0x8(%ebp)
+  8003bf:	89 f2                	mov    %esi,%edx
+  8003c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003c4:	e8 b8 ff ff ff       	call   800381 <printnum>
+  8003c9:	83 c4 10             	add    $0x10,%esp
+  8003cc:	eb 14                	jmp    8003e2 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8003ce:	83 ec 08             	sub    $0x8,%esp
+  8003d1:	56                   	push   %esi
+  8003d2:	57                   	push   %edi
+  8003d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003d6:	ff d0                	call   *%eax
+  8003d8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003db:	83 eb 01             	sub    $0x1,%ebx
+  8003de:	85 db                	test   %ebx,%ebx
+  8003e0:	7f ec                	jg     8003ce <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8003e2:	83 ec 08             	sub    $0x8,%esp
+  8003e5:	56                   	push   %esi
+  8003e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ee:	f7 75 08             	divl   0x8(%ebp)
+  8003f1:	0f be 92 cf 2d 80 00 	movsbl 0x802dcf(%edx),%edx
+  8003f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fb:	c1 e0 08             	shl    $0x8,%eax
+  8003fe:	09 d0                	or     %edx,%eax
+  800400:	50                   	push   %eax
+  800401:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800404:	ff d0                	call   *%eax
+}
+  800406:	83 c4 10             	add    $0x10,%esp
+  800409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040c:	5b                   	pop    %ebx
+  80040d:	5e                   	pop    %esi
+  80040e:	5f                   	pop    %edi
+  80040f:	5d                   	pop    %ebp
+  800410:	c3                   	ret
+
+00800411 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800411:	55                   	push   %ebp
+  800412:	89 e5                	mov    %esp,%ebp
+  800414:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800417:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80041b:	8b 10                	mov    (%eax),%edx
+  80041d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800420:	73 0a                	jae    80042c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800422:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800425:	89 08                	mov    %ecx,(%eax)
+  800427:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042a:	88 02                	mov    %al,(%edx)
+}
+  80042c:	5d                   	pop    %ebp
+  80042d:	c3                   	ret
+
+0080042e <printfmt>:
+{
+  80042e:	55                   	push   %ebp
+  80042f:	89 e5                	mov    %esp,%ebp
+  800431:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800434:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800437:	50                   	push   %eax
+  800438:	ff 75 10             	push   0x10(%ebp)
+  80043b:	ff 75 0c             	push   0xc(%ebp)
+  80043e:	ff 75 08             	push   0x8(%ebp)
+  800441:	e8 05 00 00 00       	call   80044b <vprintfmt>
+}
+  800446:	83 c4 10             	add    $0x10,%esp
+  800449:	c9                   	leave
+  80044a:	c3                   	ret
+
+0080044b <vprintfmt>:
+{
+  80044b:	55                   	push   %ebp
+  80044c:	89 e5                	mov    %esp,%ebp
+  80044e:	57                   	push   %edi
+  80044f:	56                   	push   %esi
+  800450:	53                   	push   %ebx
+  800451:	83 ec 3c             	sub    $0x3c,%esp
+  800454:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800457:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80045a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800461:	eb 16                	jmp    800479 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	ff 75 0c             	push   0xc(%ebp)
+  800469:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80046c:	c1 e2 08             	shl    $0x8,%edx
+  80046f:	09 d0                	or     %edx,%eax
+  800471:	50                   	push   %eax
+  800472:	ff d7                	call   *%edi
+  800474:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800477:	89 de                	mov    %ebx,%esi
+  800479:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80047c:	0f b6 06             	movzbl (%esi),%eax
+  80047f:	83 f8 25             	cmp    $0x25,%eax
+  800482:	74 0c                	je     800490 <vprintfmt+0x45>
+			if (ch == '\0')
+  800484:	85 c0                	test   %eax,%eax
+  800486:	75 db                	jne    800463 <vprintfmt+0x18>
+}
+  800488:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80048b:	5b                   	pop    %ebx
+  80048c:	5e                   	pop    %esi
+  80048d:	5f                   	pop    %edi
+  80048e:	5d                   	pop    %ebp
+  80048f:	c3                   	ret
+		padc = ' ';
+  800490:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800494:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80049b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004a2:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ae:	8d 73 01             	lea    0x1(%ebx),%esi
+  8004b1:	0f b6 13             	movzbl (%ebx),%edx
+  8004b4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004b7:	3c 55                	cmp    $0x55,%al
+  8004b9:	0f 87 2c 04 00 00    	ja     8008eb <vprintfmt+0x4a0>
+  8004bf:	0f b6 c0             	movzbl %al,%eax
+  8004c2:	ff 24 85 20 2f 80 00 	jmp    *0x802f20(,%eax,4)
+  8004c9:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8004cb:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8004cf:	eb dd                	jmp    8004ae <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d1:	89 f3                	mov    %esi,%ebx
+  8004d3:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8004d7:	eb d5                	jmp    8004ae <vprintfmt+0x63>
+  8004d9:	0f b6 d2             	movzbl %dl,%edx
+  8004dc:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8004de:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8004e3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004e6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004ea:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8004ed:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8004f0:	83 fe 09             	cmp    $0x9,%esi
+  8004f3:	0f 87 8a 00 00 00    	ja     800583 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8004f9:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8004fc:	eb e5                	jmp    8004e3 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8004fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800501:	8b 00                	mov    (%eax),%eax
+  800503:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800506:	8b 45 14             	mov    0x14(%ebp),%eax
+  800509:	8d 40 04             	lea    0x4(%eax),%eax
+  80050c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80050f:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800511:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800515:	79 97                	jns    8004ae <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800517:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80051a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800524:	eb 88                	jmp    8004ae <vprintfmt+0x63>
+			if (width < 0)
+  800526:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800529:	85 db                	test   %ebx,%ebx
+  80052b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800530:	0f 49 c3             	cmovns %ebx,%eax
+  800533:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800536:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800538:	e9 71 ff ff ff       	jmp    8004ae <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80053d:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80053f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800546:	e9 63 ff ff ff       	jmp    8004ae <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80054b:	8d 73 02             	lea    0x2(%ebx),%esi
+  80054e:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800552:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800559:	3c 67                	cmp    $0x67,%al
+  80055b:	0f 84 18 ff ff ff    	je     800479 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800561:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800568:	3c 72                	cmp    $0x72,%al
+  80056a:	0f 84 09 ff ff ff    	je     800479 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800570:	3c 62                	cmp    $0x62,%al
+  800572:	0f 94 c0             	sete   %al
+  800575:	0f b6 c0             	movzbl %al,%eax
+  800578:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80057b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80057e:	e9 f6 fe ff ff       	jmp    800479 <vprintfmt+0x2e>
+  800583:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800586:	eb 89                	jmp    800511 <vprintfmt+0xc6>
+			lflag++;
+  800588:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80058b:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80058d:	e9 1c ff ff ff       	jmp    8004ae <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8d 58 04             	lea    0x4(%eax),%ebx
+  800598:	83 ec 08             	sub    $0x8,%esp
+  80059b:	ff 75 0c             	push   0xc(%ebp)
+  80059e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005a1:	c1 e0 08             	shl    $0x8,%eax
+  8005a4:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005a7:	0b 01                	or     (%ecx),%eax
+  8005a9:	50                   	push   %eax
+  8005aa:	ff d7                	call   *%edi
+			break;
+  8005ac:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005af:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8005b2:	e9 c2 fe ff ff       	jmp    800479 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8005bd:	8b 10                	mov    (%eax),%edx
+  8005bf:	89 d0                	mov    %edx,%eax
+  8005c1:	f7 d8                	neg    %eax
+  8005c3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005c6:	83 f8 12             	cmp    $0x12,%eax
+  8005c9:	7f 25                	jg     8005f0 <vprintfmt+0x1a5>
+  8005cb:	8b 14 85 80 30 80 00 	mov    0x803080(,%eax,4),%edx
+  8005d2:	85 d2                	test   %edx,%edx
+  8005d4:	74 1a                	je     8005f0 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8005d6:	52                   	push   %edx
+  8005d7:	68 c1 31 80 00       	push   $0x8031c1
+  8005dc:	ff 75 0c             	push   0xc(%ebp)
+  8005df:	57                   	push   %edi
+  8005e0:	e8 49 fe ff ff       	call   80042e <printfmt>
+  8005e5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e8:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8005eb:	e9 89 fe ff ff       	jmp    800479 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8005f0:	50                   	push   %eax
+  8005f1:	68 e7 2d 80 00       	push   $0x802de7
+  8005f6:	ff 75 0c             	push   0xc(%ebp)
+  8005f9:	57                   	push   %edi
+  8005fa:	e8 2f fe ff ff       	call   80042e <printfmt>
+  8005ff:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800602:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800605:	e9 6f fe ff ff       	jmp    800479 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	83 c0 04             	add    $0x4,%eax
+  800610:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800618:	85 c9                	test   %ecx,%ecx
+  80061a:	b8 e0 2d 80 00       	mov    $0x802de0,%eax
+  80061f:	0f 45 c1             	cmovne %ecx,%eax
+  800622:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800625:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800629:	7e 06                	jle    800631 <vprintfmt+0x1e6>
+  80062b:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80062f:	75 1a                	jne    80064b <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800631:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800634:	c1 e0 08             	shl    $0x8,%eax
+  800637:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80063a:	83 c8 3f             	or     $0x3f,%eax
+  80063d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800640:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800643:	89 75 10             	mov    %esi,0x10(%ebp)
+  800646:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800649:	eb 6d                	jmp    8006b8 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80064b:	83 ec 08             	sub    $0x8,%esp
+  80064e:	ff 75 d0             	push   -0x30(%ebp)
+  800651:	ff 75 c8             	push   -0x38(%ebp)
+  800654:	e8 39 03 00 00       	call   800992 <strnlen>
+  800659:	89 c2                	mov    %eax,%edx
+  80065b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80065e:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800660:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800663:	c1 e1 08             	shl    $0x8,%ecx
+  800666:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80066a:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80066c:	83 c4 10             	add    $0x10,%esp
+  80066f:	89 c3                	mov    %eax,%ebx
+  800671:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800674:	89 75 10             	mov    %esi,0x10(%ebp)
+  800677:	89 ce                	mov    %ecx,%esi
+  800679:	eb 0f                	jmp    80068a <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80067b:	83 ec 08             	sub    $0x8,%esp
+  80067e:	ff 75 0c             	push   0xc(%ebp)
+  800681:	56                   	push   %esi
+  800682:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800684:	83 eb 01             	sub    $0x1,%ebx
+  800687:	83 c4 10             	add    $0x10,%esp
+  80068a:	85 db                	test   %ebx,%ebx
+  80068c:	7f ed                	jg     80067b <vprintfmt+0x230>
+  80068e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800691:	8b 75 10             	mov    0x10(%ebp),%esi
+  800694:	85 c0                	test   %eax,%eax
+  800696:	ba 00 00 00 00       	mov    $0x0,%edx
+  80069b:	0f 49 d0             	cmovns %eax,%edx
+  80069e:	29 d0                	sub    %edx,%eax
+  8006a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006a3:	eb 8c                	jmp    800631 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8006a5:	83 ec 08             	sub    $0x8,%esp
+  8006a8:	ff 75 0c             	push   0xc(%ebp)
+  8006ab:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006ae:	09 c2                	or     %eax,%edx
+  8006b0:	52                   	push   %edx
+  8006b1:	ff d7                	call   *%edi
+  8006b3:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006b6:	89 d9                	mov    %ebx,%ecx
+  8006b8:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8006bb:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8006bf:	0f be d0             	movsbl %al,%edx
+  8006c2:	85 d2                	test   %edx,%edx
+  8006c4:	74 2a                	je     8006f0 <vprintfmt+0x2a5>
+  8006c6:	85 f6                	test   %esi,%esi
+  8006c8:	78 05                	js     8006cf <vprintfmt+0x284>
+  8006ca:	83 ee 01             	sub    $0x1,%esi
+  8006cd:	78 3b                	js     80070a <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006cf:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006d3:	74 d0                	je     8006a5 <vprintfmt+0x25a>
+  8006d5:	0f be c0             	movsbl %al,%eax
+  8006d8:	83 e8 20             	sub    $0x20,%eax
+  8006db:	83 f8 5e             	cmp    $0x5e,%eax
+  8006de:	76 c5                	jbe    8006a5 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8006e0:	83 ec 08             	sub    $0x8,%esp
+  8006e3:	ff 75 0c             	push   0xc(%ebp)
+  8006e6:	ff 75 cc             	push   -0x34(%ebp)
+  8006e9:	ff d7                	call   *%edi
+  8006eb:	83 c4 10             	add    $0x10,%esp
+  8006ee:	eb c6                	jmp    8006b6 <vprintfmt+0x26b>
+  8006f0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006f3:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8006f6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f9:	01 c3                	add    %eax,%ebx
+  8006fb:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8006fd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800700:	83 c8 20             	or     $0x20,%eax
+  800703:	89 75 10             	mov    %esi,0x10(%ebp)
+  800706:	89 c6                	mov    %eax,%esi
+  800708:	eb 14                	jmp    80071e <vprintfmt+0x2d3>
+  80070a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80070d:	eb e4                	jmp    8006f3 <vprintfmt+0x2a8>
+  80070f:	83 ec 08             	sub    $0x8,%esp
+  800712:	ff 75 0c             	push   0xc(%ebp)
+  800715:	56                   	push   %esi
+  800716:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800718:	83 eb 01             	sub    $0x1,%ebx
+  80071b:	83 c4 10             	add    $0x10,%esp
+  80071e:	85 db                	test   %ebx,%ebx
+  800720:	7f ed                	jg     80070f <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800722:	8b 75 10             	mov    0x10(%ebp),%esi
+  800725:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800728:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072b:	e9 49 fd ff ff       	jmp    800479 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800730:	83 f9 01             	cmp    $0x1,%ecx
+  800733:	7f 1f                	jg     800754 <vprintfmt+0x309>
+	else if (lflag)
+  800735:	85 c9                	test   %ecx,%ecx
+  800737:	74 69                	je     8007a2 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	8b 00                	mov    (%eax),%eax
+  80073e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800741:	89 c1                	mov    %eax,%ecx
+  800743:	c1 f9 1f             	sar    $0x1f,%ecx
+  800746:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800749:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074c:	8d 40 04             	lea    0x4(%eax),%eax
+  80074f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800752:	eb 17                	jmp    80076b <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8b 50 04             	mov    0x4(%eax),%edx
+  80075a:	8b 00                	mov    (%eax),%eax
+  80075c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800762:	8b 45 14             	mov    0x14(%ebp),%eax
+  800765:	8d 40 08             	lea    0x8(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80076b:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80076e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800771:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800776:	85 db                	test   %ebx,%ebx
+  800778:	0f 89 f6 00 00 00    	jns    800874 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80077e:	83 ec 08             	sub    $0x8,%esp
+  800781:	ff 75 0c             	push   0xc(%ebp)
+  800784:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800787:	c1 e0 08             	shl    $0x8,%eax
+  80078a:	83 c8 2d             	or     $0x2d,%eax
+  80078d:	50                   	push   %eax
+  80078e:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800790:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800793:	f7 d9                	neg    %ecx
+  800795:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800798:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80079d:	e9 d2 00 00 00       	jmp    800874 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8007a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a5:	8b 00                	mov    (%eax),%eax
+  8007a7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007aa:	89 c1                	mov    %eax,%ecx
+  8007ac:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007af:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bb:	eb ae                	jmp    80076b <vprintfmt+0x320>
+	if (lflag >= 2)
+  8007bd:	83 f9 01             	cmp    $0x1,%ecx
+  8007c0:	7f 19                	jg     8007db <vprintfmt+0x390>
+	else if (lflag)
+  8007c2:	85 c9                	test   %ecx,%ecx
+  8007c4:	74 2a                	je     8007f0 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8b 08                	mov    (%eax),%ecx
+  8007cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8007d6:	e9 99 00 00 00       	jmp    800874 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007de:	8b 08                	mov    (%eax),%ecx
+  8007e0:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8007eb:	e9 84 00 00 00       	jmp    800874 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f3:	8b 08                	mov    (%eax),%ecx
+  8007f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800800:	eb 72                	jmp    800874 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800802:	83 f9 01             	cmp    $0x1,%ecx
+  800805:	7f 16                	jg     80081d <vprintfmt+0x3d2>
+	else if (lflag)
+  800807:	85 c9                	test   %ecx,%ecx
+  800809:	74 24                	je     80082f <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80080b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080e:	8b 08                	mov    (%eax),%ecx
+  800810:	8d 40 04             	lea    0x4(%eax),%eax
+  800813:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800816:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80081b:	eb 57                	jmp    800874 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80081d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800820:	8b 08                	mov    (%eax),%ecx
+  800822:	8d 40 08             	lea    0x8(%eax),%eax
+  800825:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800828:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80082d:	eb 45                	jmp    800874 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80082f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800832:	8b 08                	mov    (%eax),%ecx
+  800834:	8d 40 04             	lea    0x4(%eax),%eax
+  800837:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80083a:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80083f:	eb 33                	jmp    800874 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800841:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800844:	c1 e3 08             	shl    $0x8,%ebx
+  800847:	83 ec 08             	sub    $0x8,%esp
+  80084a:	ff 75 0c             	push   0xc(%ebp)
+  80084d:	89 d8                	mov    %ebx,%eax
+  80084f:	83 c8 30             	or     $0x30,%eax
+  800852:	50                   	push   %eax
+  800853:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800855:	83 c4 08             	add    $0x8,%esp
+  800858:	ff 75 0c             	push   0xc(%ebp)
+  80085b:	83 cb 78             	or     $0x78,%ebx
+  80085e:	53                   	push   %ebx
+  80085f:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800861:	8b 45 14             	mov    0x14(%ebp),%eax
+  800864:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800866:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800869:	8d 40 04             	lea    0x4(%eax),%eax
+  80086c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80086f:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800874:	ff 75 e4             	push   -0x1c(%ebp)
+  800877:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80087b:	52                   	push   %edx
+  80087c:	ff 75 e0             	push   -0x20(%ebp)
+  80087f:	50                   	push   %eax
+  800880:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800883:	89 f8                	mov    %edi,%eax
+  800885:	e8 f7 fa ff ff       	call   800381 <printnum>
+			break;
+  80088a:	83 c4 10             	add    $0x10,%esp
+  80088d:	e9 e7 fb ff ff       	jmp    800479 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800892:	83 f9 01             	cmp    $0x1,%ecx
+  800895:	7f 16                	jg     8008ad <vprintfmt+0x462>
+	else if (lflag)
+  800897:	85 c9                	test   %ecx,%ecx
+  800899:	74 24                	je     8008bf <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80089b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089e:	8b 08                	mov    (%eax),%ecx
+  8008a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a6:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8008ab:	eb c7                	jmp    800874 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b0:	8b 08                	mov    (%eax),%ecx
+  8008b2:	8d 40 08             	lea    0x8(%eax),%eax
+  8008b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008b8:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8008bd:	eb b5                	jmp    800874 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c2:	8b 08                	mov    (%eax),%ecx
+  8008c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ca:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8008cf:	eb a3                	jmp    800874 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8008d1:	83 ec 08             	sub    $0x8,%esp
+  8008d4:	ff 75 0c             	push   0xc(%ebp)
+  8008d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008da:	c1 e0 08             	shl    $0x8,%eax
+  8008dd:	83 c8 25             	or     $0x25,%eax
+  8008e0:	50                   	push   %eax
+  8008e1:	ff d7                	call   *%edi
+			break;
+  8008e3:	83 c4 10             	add    $0x10,%esp
+  8008e6:	e9 8e fb ff ff       	jmp    800479 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8008eb:	83 ec 08             	sub    $0x8,%esp
+  8008ee:	ff 75 0c             	push   0xc(%ebp)
+  8008f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008f4:	c1 e0 08             	shl    $0x8,%eax
+  8008f7:	83 c8 25             	or     $0x25,%eax
+  8008fa:	50                   	push   %eax
+  8008fb:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008fd:	83 c4 10             	add    $0x10,%esp
+  800900:	89 de                	mov    %ebx,%esi
+  800902:	eb 03                	jmp    800907 <vprintfmt+0x4bc>
+  800904:	83 ee 01             	sub    $0x1,%esi
+  800907:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80090b:	75 f7                	jne    800904 <vprintfmt+0x4b9>
+  80090d:	e9 67 fb ff ff       	jmp    800479 <vprintfmt+0x2e>
+
+00800912 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	83 ec 18             	sub    $0x18,%esp
+  800918:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80091e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800921:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800925:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800928:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80092f:	85 c0                	test   %eax,%eax
+  800931:	74 26                	je     800959 <vsnprintf+0x47>
+  800933:	85 d2                	test   %edx,%edx
+  800935:	7e 22                	jle    800959 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800937:	ff 75 14             	push   0x14(%ebp)
+  80093a:	ff 75 10             	push   0x10(%ebp)
+  80093d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800940:	50                   	push   %eax
+  800941:	68 11 04 80 00       	push   $0x800411
+  800946:	e8 00 fb ff ff       	call   80044b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80094b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80094e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800951:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800954:	83 c4 10             	add    $0x10,%esp
+}
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+		return -E_INVAL;
+  800959:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80095e:	eb f7                	jmp    800957 <vsnprintf+0x45>
+
+00800960 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800966:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800969:	50                   	push   %eax
+  80096a:	ff 75 10             	push   0x10(%ebp)
+  80096d:	ff 75 0c             	push   0xc(%ebp)
+  800970:	ff 75 08             	push   0x8(%ebp)
+  800973:	e8 9a ff ff ff       	call   800912 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800978:	c9                   	leave
+  800979:	c3                   	ret
+
+0080097a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800980:	b8 00 00 00 00       	mov    $0x0,%eax
+  800985:	eb 03                	jmp    80098a <strlen+0x10>
+		n++;
+  800987:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80098a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80098e:	75 f7                	jne    800987 <strlen+0xd>
+	return n;
+}
+  800990:	5d                   	pop    %ebp
+  800991:	c3                   	ret
+
+00800992 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800992:	55                   	push   %ebp
+  800993:	89 e5                	mov    %esp,%ebp
+  800995:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800998:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80099b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a0:	eb 03                	jmp    8009a5 <strnlen+0x13>
+		n++;
+  8009a2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a5:	39 d0                	cmp    %edx,%eax
+  8009a7:	74 08                	je     8009b1 <strnlen+0x1f>
+  8009a9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009ad:	75 f3                	jne    8009a2 <strnlen+0x10>
+  8009af:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009b1:	89 d0                	mov    %edx,%eax
+  8009b3:	5d                   	pop    %ebp
+  8009b4:	c3                   	ret
+
+008009b5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009b5:	55                   	push   %ebp
+  8009b6:	89 e5                	mov    %esp,%ebp
+  8009b8:	53                   	push   %ebx
+  8009b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009c8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009cb:	83 c0 01             	add    $0x1,%eax
+  8009ce:	84 d2                	test   %dl,%dl
+  8009d0:	75 f2                	jne    8009c4 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009d2:	89 c8                	mov    %ecx,%eax
+  8009d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d7:	c9                   	leave
+  8009d8:	c3                   	ret
+
+008009d9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	53                   	push   %ebx
+  8009dd:	83 ec 10             	sub    $0x10,%esp
+  8009e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009e3:	53                   	push   %ebx
+  8009e4:	e8 91 ff ff ff       	call   80097a <strlen>
+  8009e9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009ec:	ff 75 0c             	push   0xc(%ebp)
+  8009ef:	01 d8                	add    %ebx,%eax
+  8009f1:	50                   	push   %eax
+  8009f2:	e8 be ff ff ff       	call   8009b5 <strcpy>
+	return dst;
+}
+  8009f7:	89 d8                	mov    %ebx,%eax
+  8009f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009fc:	c9                   	leave
+  8009fd:	c3                   	ret
+
+008009fe <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	56                   	push   %esi
+  800a02:	53                   	push   %ebx
+  800a03:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a09:	89 f3                	mov    %esi,%ebx
+  800a0b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a0e:	89 f0                	mov    %esi,%eax
+  800a10:	eb 0f                	jmp    800a21 <strncpy+0x23>
+		*dst++ = *src;
+  800a12:	83 c0 01             	add    $0x1,%eax
+  800a15:	0f b6 0a             	movzbl (%edx),%ecx
+  800a18:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a1b:	80 f9 01             	cmp    $0x1,%cl
+  800a1e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a21:	39 d8                	cmp    %ebx,%eax
+  800a23:	75 ed                	jne    800a12 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a25:	89 f0                	mov    %esi,%eax
+  800a27:	5b                   	pop    %ebx
+  800a28:	5e                   	pop    %esi
+  800a29:	5d                   	pop    %ebp
+  800a2a:	c3                   	ret
+
+00800a2b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	56                   	push   %esi
+  800a2f:	53                   	push   %ebx
+  800a30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a36:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a39:	89 f0                	mov    %esi,%eax
+  800a3b:	85 d2                	test   %edx,%edx
+  800a3d:	74 21                	je     800a60 <strlcpy+0x35>
+  800a3f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a43:	89 f2                	mov    %esi,%edx
+  800a45:	eb 09                	jmp    800a50 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a47:	83 c1 01             	add    $0x1,%ecx
+  800a4a:	83 c2 01             	add    $0x1,%edx
+  800a4d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a50:	39 c2                	cmp    %eax,%edx
+  800a52:	74 09                	je     800a5d <strlcpy+0x32>
+  800a54:	0f b6 19             	movzbl (%ecx),%ebx
+  800a57:	84 db                	test   %bl,%bl
+  800a59:	75 ec                	jne    800a47 <strlcpy+0x1c>
+  800a5b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a5d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a60:	29 f0                	sub    %esi,%eax
+}
+  800a62:	5b                   	pop    %ebx
+  800a63:	5e                   	pop    %esi
+  800a64:	5d                   	pop    %ebp
+  800a65:	c3                   	ret
+
+00800a66 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a6f:	eb 06                	jmp    800a77 <strcmp+0x11>
+		p++, q++;
+  800a71:	83 c1 01             	add    $0x1,%ecx
+  800a74:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a77:	0f b6 01             	movzbl (%ecx),%eax
+  800a7a:	84 c0                	test   %al,%al
+  800a7c:	74 04                	je     800a82 <strcmp+0x1c>
+  800a7e:	3a 02                	cmp    (%edx),%al
+  800a80:	74 ef                	je     800a71 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a82:	0f b6 c0             	movzbl %al,%eax
+  800a85:	0f b6 12             	movzbl (%edx),%edx
+  800a88:	29 d0                	sub    %edx,%eax
+}
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	53                   	push   %ebx
+  800a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a96:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a99:	eb 09                	jmp    800aa4 <strncmp+0x18>
+		n--, p++, q++;
+  800a9b:	83 ea 01             	sub    $0x1,%edx
+  800a9e:	83 c0 01             	add    $0x1,%eax
+  800aa1:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800aa4:	85 d2                	test   %edx,%edx
+  800aa6:	74 18                	je     800ac0 <strncmp+0x34>
+  800aa8:	0f b6 18             	movzbl (%eax),%ebx
+  800aab:	84 db                	test   %bl,%bl
+  800aad:	74 04                	je     800ab3 <strncmp+0x27>
+  800aaf:	3a 19                	cmp    (%ecx),%bl
+  800ab1:	74 e8                	je     800a9b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ab3:	0f b6 00             	movzbl (%eax),%eax
+  800ab6:	0f b6 11             	movzbl (%ecx),%edx
+  800ab9:	29 d0                	sub    %edx,%eax
+}
+  800abb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abe:	c9                   	leave
+  800abf:	c3                   	ret
+		return 0;
+  800ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac5:	eb f4                	jmp    800abb <strncmp+0x2f>
+
+00800ac7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ac7:	55                   	push   %ebp
+  800ac8:	89 e5                	mov    %esp,%ebp
+  800aca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ad1:	eb 03                	jmp    800ad6 <strchr+0xf>
+  800ad3:	83 c0 01             	add    $0x1,%eax
+  800ad6:	0f b6 10             	movzbl (%eax),%edx
+  800ad9:	84 d2                	test   %dl,%dl
+  800adb:	74 06                	je     800ae3 <strchr+0x1c>
+		if (*s == c)
+  800add:	38 ca                	cmp    %cl,%dl
+  800adf:	75 f2                	jne    800ad3 <strchr+0xc>
+  800ae1:	eb 05                	jmp    800ae8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+
+00800aea <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800af4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800af7:	38 ca                	cmp    %cl,%dl
+  800af9:	74 09                	je     800b04 <strfind+0x1a>
+  800afb:	84 d2                	test   %dl,%dl
+  800afd:	74 05                	je     800b04 <strfind+0x1a>
+	for (; *s; s++)
+  800aff:	83 c0 01             	add    $0x1,%eax
+  800b02:	eb f0                	jmp    800af4 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b04:	5d                   	pop    %ebp
+  800b05:	c3                   	ret
+
+00800b06 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b06:	55                   	push   %ebp
+  800b07:	89 e5                	mov    %esp,%ebp
+  800b09:	57                   	push   %edi
+  800b0a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b0d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b10:	85 c9                	test   %ecx,%ecx
+  800b12:	74 20                	je     800b34 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b14:	89 f8                	mov    %edi,%eax
+  800b16:	09 c8                	or     %ecx,%eax
+  800b18:	a8 03                	test   $0x3,%al
+  800b1a:	75 12                	jne    800b2e <memset+0x28>
+		c &= 0xFF;
+  800b1c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b20:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b26:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b29:	fc                   	cld
+  800b2a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b2c:	eb 06                	jmp    800b34 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b31:	fc                   	cld
+  800b32:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b34:	89 f8                	mov    %edi,%eax
+  800b36:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b39:	c9                   	leave
+  800b3a:	c3                   	ret
+
+00800b3b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b3b:	55                   	push   %ebp
+  800b3c:	89 e5                	mov    %esp,%ebp
+  800b3e:	57                   	push   %edi
+  800b3f:	56                   	push   %esi
+  800b40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b43:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b46:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b49:	39 c6                	cmp    %eax,%esi
+  800b4b:	73 32                	jae    800b7f <memmove+0x44>
+  800b4d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b50:	39 d0                	cmp    %edx,%eax
+  800b52:	73 2b                	jae    800b7f <memmove+0x44>
+		s += n;
+		d += n;
+  800b54:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b57:	89 d6                	mov    %edx,%esi
+  800b59:	09 fe                	or     %edi,%esi
+  800b5b:	09 ce                	or     %ecx,%esi
+  800b5d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b63:	75 0e                	jne    800b73 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b65:	83 ef 04             	sub    $0x4,%edi
+  800b68:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b6b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b6e:	fd                   	std
+  800b6f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b71:	eb 09                	jmp    800b7c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b73:	83 ef 01             	sub    $0x1,%edi
+  800b76:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b79:	fd                   	std
+  800b7a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b7c:	fc                   	cld
+  800b7d:	eb 1a                	jmp    800b99 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b7f:	89 f2                	mov    %esi,%edx
+  800b81:	09 c2                	or     %eax,%edx
+  800b83:	09 ca                	or     %ecx,%edx
+  800b85:	f6 c2 03             	test   $0x3,%dl
+  800b88:	75 0a                	jne    800b94 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b8a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b8d:	89 c7                	mov    %eax,%edi
+  800b8f:	fc                   	cld
+  800b90:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b92:	eb 05                	jmp    800b99 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b94:	89 c7                	mov    %eax,%edi
+  800b96:	fc                   	cld
+  800b97:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b99:	5e                   	pop    %esi
+  800b9a:	5f                   	pop    %edi
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ba3:	ff 75 10             	push   0x10(%ebp)
+  800ba6:	ff 75 0c             	push   0xc(%ebp)
+  800ba9:	ff 75 08             	push   0x8(%ebp)
+  800bac:	e8 8a ff ff ff       	call   800b3b <memmove>
+}
+  800bb1:	c9                   	leave
+  800bb2:	c3                   	ret
+
+00800bb3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bb3:	55                   	push   %ebp
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	56                   	push   %esi
+  800bb7:	53                   	push   %ebx
+  800bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bbe:	89 c6                	mov    %eax,%esi
+  800bc0:	03 75 10             	add    0x10(%ebp),%esi
+  800bc3:	eb 06                	jmp    800bcb <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bc5:	83 c0 01             	add    $0x1,%eax
+  800bc8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bcb:	39 f0                	cmp    %esi,%eax
+  800bcd:	74 14                	je     800be3 <memcmp+0x30>
+		if (*s1 != *s2)
+  800bcf:	0f b6 08             	movzbl (%eax),%ecx
+  800bd2:	0f b6 1a             	movzbl (%edx),%ebx
+  800bd5:	38 d9                	cmp    %bl,%cl
+  800bd7:	74 ec                	je     800bc5 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bd9:	0f b6 c1             	movzbl %cl,%eax
+  800bdc:	0f b6 db             	movzbl %bl,%ebx
+  800bdf:	29 d8                	sub    %ebx,%eax
+  800be1:	eb 05                	jmp    800be8 <memcmp+0x35>
+	}
+
+	return 0;
+  800be3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800be8:	5b                   	pop    %ebx
+  800be9:	5e                   	pop    %esi
+  800bea:	5d                   	pop    %ebp
+  800beb:	c3                   	ret
+
+00800bec <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bf5:	89 c2                	mov    %eax,%edx
+  800bf7:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bfa:	eb 03                	jmp    800bff <memfind+0x13>
+  800bfc:	83 c0 01             	add    $0x1,%eax
+  800bff:	39 d0                	cmp    %edx,%eax
+  800c01:	73 04                	jae    800c07 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c03:	38 08                	cmp    %cl,(%eax)
+  800c05:	75 f5                	jne    800bfc <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+
+00800c09 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	57                   	push   %edi
+  800c0d:	56                   	push   %esi
+  800c0e:	53                   	push   %ebx
+  800c0f:	83 ec 1c             	sub    $0x1c,%esp
+  800c12:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c15:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c18:	eb 03                	jmp    800c1d <strtol+0x14>
+		s++;
+  800c1a:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c1d:	0f b6 06             	movzbl (%esi),%eax
+  800c20:	3c 20                	cmp    $0x20,%al
+  800c22:	74 f6                	je     800c1a <strtol+0x11>
+  800c24:	3c 09                	cmp    $0x9,%al
+  800c26:	74 f2                	je     800c1a <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c28:	3c 2b                	cmp    $0x2b,%al
+  800c2a:	74 43                	je     800c6f <strtol+0x66>
+	int neg = 0;
+  800c2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c31:	3c 2d                	cmp    $0x2d,%al
+  800c33:	74 44                	je     800c79 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c35:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c3b:	75 0f                	jne    800c4c <strtol+0x43>
+  800c3d:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c40:	74 41                	je     800c83 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c42:	85 ff                	test   %edi,%edi
+  800c44:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c49:	0f 44 f8             	cmove  %eax,%edi
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c51:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c56:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c59:	89 fb                	mov    %edi,%ebx
+  800c5b:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c5e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c61:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c64:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c67:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c6a:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c6d:	eb 67                	jmp    800cd6 <strtol+0xcd>
+		s++;
+  800c6f:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c77:	eb bc                	jmp    800c35 <strtol+0x2c>
+		s++, neg = 1;
+  800c79:	83 c6 01             	add    $0x1,%esi
+  800c7c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c81:	eb b2                	jmp    800c35 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c83:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c87:	74 0e                	je     800c97 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c89:	85 ff                	test   %edi,%edi
+  800c8b:	75 bf                	jne    800c4c <strtol+0x43>
+		s++, base = 8;
+  800c8d:	83 c6 01             	add    $0x1,%esi
+  800c90:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c95:	eb b5                	jmp    800c4c <strtol+0x43>
+		s += 2, base = 16;
+  800c97:	83 c6 02             	add    $0x2,%esi
+  800c9a:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c9f:	eb ab                	jmp    800c4c <strtol+0x43>
+			dig = *s - '0';
+  800ca1:	0f be c9             	movsbl %cl,%ecx
+  800ca4:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800ca7:	39 f9                	cmp    %edi,%ecx
+  800ca9:	7d 59                	jge    800d04 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800cab:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800caf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cb2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cb5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cb8:	0f af d8             	imul   %eax,%ebx
+  800cbb:	0f af d7             	imul   %edi,%edx
+  800cbe:	01 d3                	add    %edx,%ebx
+  800cc0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cc3:	f7 e7                	mul    %edi
+  800cc5:	01 da                	add    %ebx,%edx
+  800cc7:	89 cb                	mov    %ecx,%ebx
+  800cc9:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ccc:	01 c8                	add    %ecx,%eax
+  800cce:	11 da                	adc    %ebx,%edx
+  800cd0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800cd3:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd9:	0f b6 08             	movzbl (%eax),%ecx
+  800cdc:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800cdf:	80 fb 09             	cmp    $0x9,%bl
+  800ce2:	76 bd                	jbe    800ca1 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce4:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800ce7:	80 fb 19             	cmp    $0x19,%bl
+  800cea:	77 08                	ja     800cf4 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800cec:	0f be c9             	movsbl %cl,%ecx
+  800cef:	83 e9 57             	sub    $0x57,%ecx
+  800cf2:	eb b3                	jmp    800ca7 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cf4:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800cf7:	80 fb 19             	cmp    $0x19,%bl
+  800cfa:	77 08                	ja     800d04 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800cfc:	0f be c9             	movsbl %cl,%ecx
+  800cff:	83 e9 37             	sub    $0x37,%ecx
+  800d02:	eb a3                	jmp    800ca7 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d04:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d07:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d0a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d0d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d10:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d14:	74 05                	je     800d1b <strtol+0x112>
+		*endptr = (char *) s;
+  800d16:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d19:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d1b:	85 c9                	test   %ecx,%ecx
+  800d1d:	74 07                	je     800d26 <strtol+0x11d>
+  800d1f:	f7 d8                	neg    %eax
+  800d21:	83 d2 00             	adc    $0x0,%edx
+  800d24:	f7 da                	neg    %edx
+}
+  800d26:	83 c4 1c             	add    $0x1c,%esp
+  800d29:	5b                   	pop    %ebx
+  800d2a:	5e                   	pop    %esi
+  800d2b:	5f                   	pop    %edi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	c3                   	ret
+
+00800d2e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d2e:	55                   	push   %ebp
+  800d2f:	89 e5                	mov    %esp,%ebp
+  800d31:	57                   	push   %edi
+  800d32:	56                   	push   %esi
+  800d33:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d34:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d3b:	74 18                	je     800d55 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d48:	89 c3                	mov    %eax,%ebx
+  800d4a:	89 c7                	mov    %eax,%edi
+  800d4c:	89 c6                	mov    %eax,%esi
+  800d4e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d50:	5b                   	pop    %ebx
+  800d51:	5e                   	pop    %esi
+  800d52:	5f                   	pop    %edi
+  800d53:	5d                   	pop    %ebp
+  800d54:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	89 c3                	mov    %eax,%ebx
+  800d62:	89 c7                	mov    %eax,%edi
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	8d 35 6f 0d 80 00    	lea    0x800d6f,%esi
+  800d6d:	0f 34                	sysenter
+  800d6f:	5d                   	pop    %ebp
+		goto out;
+  800d70:	eb de                	jmp    800d50 <sys_cputs+0x22>
+
+00800d72 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	57                   	push   %edi
+  800d76:	56                   	push   %esi
+  800d77:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d78:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d7f:	74 19                	je     800d9a <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d86:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d8b:	89 d1                	mov    %edx,%ecx
+  800d8d:	89 d3                	mov    %edx,%ebx
+  800d8f:	89 d7                	mov    %edx,%edi
+  800d91:	89 d6                	mov    %edx,%esi
+  800d93:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d95:	5b                   	pop    %ebx
+  800d96:	5e                   	pop    %esi
+  800d97:	5f                   	pop    %edi
+  800d98:	5d                   	pop    %ebp
+  800d99:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da4:	89 d1                	mov    %edx,%ecx
+  800da6:	89 d3                	mov    %edx,%ebx
+  800da8:	89 d7                	mov    %edx,%edi
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	8d 35 b5 0d 80 00    	lea    0x800db5,%esi
+  800db3:	0f 34                	sysenter
+  800db5:	5d                   	pop    %ebp
+		goto out;
+  800db6:	eb dd                	jmp    800d95 <sys_cgetc+0x23>
+
+00800db8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	57                   	push   %edi
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dc1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dc8:	74 21                	je     800deb <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800dca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dcf:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd7:	89 cb                	mov    %ecx,%ebx
+  800dd9:	89 cf                	mov    %ecx,%edi
+  800ddb:	89 ce                	mov    %ecx,%esi
+  800ddd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddf:	85 c0                	test   %eax,%eax
+  800de1:	7f 27                	jg     800e0a <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800de3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de6:	5b                   	pop    %ebx
+  800de7:	5e                   	pop    %esi
+  800de8:	5f                   	pop    %edi
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800deb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df8:	89 cb                	mov    %ecx,%ebx
+  800dfa:	89 cf                	mov    %ecx,%edi
+  800dfc:	55                   	push   %ebp
+  800dfd:	89 e5                	mov    %esp,%ebp
+  800dff:	8d 35 07 0e 80 00    	lea    0x800e07,%esi
+  800e05:	0f 34                	sysenter
+  800e07:	5d                   	pop    %ebp
+		goto out;
+  800e08:	eb d5                	jmp    800ddf <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0a:	83 ec 0c             	sub    $0xc,%esp
+  800e0d:	50                   	push   %eax
+  800e0e:	6a 03                	push   $0x3
+  800e10:	68 eb 30 80 00       	push   $0x8030eb
+  800e15:	6a 3f                	push   $0x3f
+  800e17:	68 08 31 80 00       	push   $0x803108
+  800e1c:	e8 71 f4 ff ff       	call   800292 <_panic>
+
+00800e21 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e21:	55                   	push   %ebp
+  800e22:	89 e5                	mov    %esp,%ebp
+  800e24:	57                   	push   %edi
+  800e25:	56                   	push   %esi
+  800e26:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e27:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e2e:	74 19                	je     800e49 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e35:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e3a:	89 d1                	mov    %edx,%ecx
+  800e3c:	89 d3                	mov    %edx,%ebx
+  800e3e:	89 d7                	mov    %edx,%edi
+  800e40:	89 d6                	mov    %edx,%esi
+  800e42:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e44:	5b                   	pop    %ebx
+  800e45:	5e                   	pop    %esi
+  800e46:	5f                   	pop    %edi
+  800e47:	5d                   	pop    %ebp
+  800e48:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e53:	89 d1                	mov    %edx,%ecx
+  800e55:	89 d3                	mov    %edx,%ebx
+  800e57:	89 d7                	mov    %edx,%edi
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	8d 35 64 0e 80 00    	lea    0x800e64,%esi
+  800e62:	0f 34                	sysenter
+  800e64:	5d                   	pop    %ebp
+		goto out;
+  800e65:	eb dd                	jmp    800e44 <sys_getenvid+0x23>
+
+00800e67 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e67:	55                   	push   %ebp
+  800e68:	89 e5                	mov    %esp,%ebp
+  800e6a:	57                   	push   %edi
+  800e6b:	56                   	push   %esi
+  800e6c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e6d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e74:	74 19                	je     800e8f <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e80:	89 d1                	mov    %edx,%ecx
+  800e82:	89 d3                	mov    %edx,%ebx
+  800e84:	89 d7                	mov    %edx,%edi
+  800e86:	89 d6                	mov    %edx,%esi
+  800e88:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e94:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e99:	89 d1                	mov    %edx,%ecx
+  800e9b:	89 d3                	mov    %edx,%ebx
+  800e9d:	89 d7                	mov    %edx,%edi
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	8d 35 aa 0e 80 00    	lea    0x800eaa,%esi
+  800ea8:	0f 34                	sysenter
+  800eaa:	5d                   	pop    %ebp
+		goto out;
+  800eab:	eb dd                	jmp    800e8a <sys_yield+0x23>
+
+00800ead <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ead:	55                   	push   %ebp
+  800eae:	89 e5                	mov    %esp,%ebp
+  800eb0:	57                   	push   %edi
+  800eb1:	56                   	push   %esi
+  800eb2:	53                   	push   %ebx
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eb6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ebd:	74 23                	je     800ee2 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800ebf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ec9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed2:	89 f7                	mov    %esi,%edi
+  800ed4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed6:	85 c0                	test   %eax,%eax
+  800ed8:	7f 29                	jg     800f03 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800eda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edd:	5b                   	pop    %ebx
+  800ede:	5e                   	pop    %esi
+  800edf:	5f                   	pop    %edi
+  800ee0:	5d                   	pop    %ebp
+  800ee1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800eed:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	8d 35 00 0f 80 00    	lea    0x800f00,%esi
+  800efe:	0f 34                	sysenter
+  800f00:	5d                   	pop    %ebp
+		goto out;
+  800f01:	eb d3                	jmp    800ed6 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f03:	83 ec 0c             	sub    $0xc,%esp
+  800f06:	50                   	push   %eax
+  800f07:	6a 04                	push   $0x4
+  800f09:	68 eb 30 80 00       	push   $0x8030eb
+  800f0e:	6a 3f                	push   $0x3f
+  800f10:	68 08 31 80 00       	push   $0x803108
+  800f15:	e8 78 f3 ff ff       	call   800292 <_panic>
+
+00800f1a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	57                   	push   %edi
+  800f1e:	56                   	push   %esi
+  800f1f:	53                   	push   %ebx
+  800f20:	83 ec 0c             	sub    $0xc,%esp
+  800f23:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f26:	85 f6                	test   %esi,%esi
+  800f28:	75 09                	jne    800f33 <sys_page_map+0x19>
+  800f2a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f31:	74 1f                	je     800f52 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f33:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f41:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	7f 27                	jg     800f71 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f58:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f60:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	8d 35 6e 0f 80 00    	lea    0x800f6e,%esi
+  800f6c:	0f 34                	sysenter
+  800f6e:	5d                   	pop    %ebp
+		goto out;
+  800f6f:	eb d5                	jmp    800f46 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f71:	83 ec 0c             	sub    $0xc,%esp
+  800f74:	50                   	push   %eax
+  800f75:	6a 05                	push   $0x5
+  800f77:	68 eb 30 80 00       	push   $0x8030eb
+  800f7c:	6a 3f                	push   $0x3f
+  800f7e:	68 08 31 80 00       	push   $0x803108
+  800f83:	e8 0a f3 ff ff       	call   800292 <_panic>
+
+00800f88 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+  800f8e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f91:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f98:	74 22                	je     800fbc <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faa:	89 df                	mov    %ebx,%edi
+  800fac:	89 de                	mov    %ebx,%esi
+  800fae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb0:	85 c0                	test   %eax,%eax
+  800fb2:	7f 28                	jg     800fdc <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb7:	5b                   	pop    %ebx
+  800fb8:	5e                   	pop    %esi
+  800fb9:	5f                   	pop    %edi
+  800fba:	5d                   	pop    %ebp
+  800fbb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fcc:	89 df                	mov    %ebx,%edi
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	8d 35 d9 0f 80 00    	lea    0x800fd9,%esi
+  800fd7:	0f 34                	sysenter
+  800fd9:	5d                   	pop    %ebp
+		goto out;
+  800fda:	eb d4                	jmp    800fb0 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fdc:	83 ec 0c             	sub    $0xc,%esp
+  800fdf:	50                   	push   %eax
+  800fe0:	6a 06                	push   $0x6
+  800fe2:	68 eb 30 80 00       	push   $0x8030eb
+  800fe7:	6a 3f                	push   $0x3f
+  800fe9:	68 08 31 80 00       	push   $0x803108
+  800fee:	e8 9f f2 ff ff       	call   800292 <_panic>
+
+00800ff3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+  800ff9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ffc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801003:	74 22                	je     801027 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801005:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80100f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801012:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801015:	89 df                	mov    %ebx,%edi
+  801017:	89 de                	mov    %ebx,%esi
+  801019:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80101b:	85 c0                	test   %eax,%eax
+  80101d:	7f 28                	jg     801047 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80101f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801022:	5b                   	pop    %ebx
+  801023:	5e                   	pop    %esi
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801027:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801032:	b8 08 00 00 00       	mov    $0x8,%eax
+  801037:	89 df                	mov    %ebx,%edi
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	8d 35 44 10 80 00    	lea    0x801044,%esi
+  801042:	0f 34                	sysenter
+  801044:	5d                   	pop    %ebp
+		goto out;
+  801045:	eb d4                	jmp    80101b <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	50                   	push   %eax
+  80104b:	6a 08                	push   $0x8
+  80104d:	68 eb 30 80 00       	push   $0x8030eb
+  801052:	6a 3f                	push   $0x3f
+  801054:	68 08 31 80 00       	push   $0x803108
+  801059:	e8 34 f2 ff ff       	call   800292 <_panic>
+
+0080105e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801067:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80106e:	74 22                	je     801092 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801070:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801075:	b8 09 00 00 00       	mov    $0x9,%eax
+  80107a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801080:	89 df                	mov    %ebx,%edi
+  801082:	89 de                	mov    %ebx,%esi
+  801084:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801086:	85 c0                	test   %eax,%eax
+  801088:	7f 28                	jg     8010b2 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80108a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108d:	5b                   	pop    %ebx
+  80108e:	5e                   	pop    %esi
+  80108f:	5f                   	pop    %edi
+  801090:	5d                   	pop    %ebp
+  801091:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801092:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801097:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109d:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010a2:	89 df                	mov    %ebx,%edi
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	8d 35 af 10 80 00    	lea    0x8010af,%esi
+  8010ad:	0f 34                	sysenter
+  8010af:	5d                   	pop    %ebp
+		goto out;
+  8010b0:	eb d4                	jmp    801086 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b2:	83 ec 0c             	sub    $0xc,%esp
+  8010b5:	50                   	push   %eax
+  8010b6:	6a 09                	push   $0x9
+  8010b8:	68 eb 30 80 00       	push   $0x8030eb
+  8010bd:	6a 3f                	push   $0x3f
+  8010bf:	68 08 31 80 00       	push   $0x803108
+  8010c4:	e8 c9 f1 ff ff       	call   800292 <_panic>
+
+008010c9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	57                   	push   %edi
+  8010cd:	56                   	push   %esi
+  8010ce:	53                   	push   %ebx
+  8010cf:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010d2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010d9:	74 22                	je     8010fd <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8010db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010eb:	89 df                	mov    %ebx,%edi
+  8010ed:	89 de                	mov    %ebx,%esi
+  8010ef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f1:	85 c0                	test   %eax,%eax
+  8010f3:	7f 28                	jg     80111d <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f8:	5b                   	pop    %ebx
+  8010f9:	5e                   	pop    %esi
+  8010fa:	5f                   	pop    %edi
+  8010fb:	5d                   	pop    %ebp
+  8010fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801102:	8b 55 08             	mov    0x8(%ebp),%edx
+  801105:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801108:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80110d:	89 df                	mov    %ebx,%edi
+  80110f:	55                   	push   %ebp
+  801110:	89 e5                	mov    %esp,%ebp
+  801112:	8d 35 1a 11 80 00    	lea    0x80111a,%esi
+  801118:	0f 34                	sysenter
+  80111a:	5d                   	pop    %ebp
+		goto out;
+  80111b:	eb d4                	jmp    8010f1 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111d:	83 ec 0c             	sub    $0xc,%esp
+  801120:	50                   	push   %eax
+  801121:	6a 0a                	push   $0xa
+  801123:	68 eb 30 80 00       	push   $0x8030eb
+  801128:	6a 3f                	push   $0x3f
+  80112a:	68 08 31 80 00       	push   $0x803108
+  80112f:	e8 5e f1 ff ff       	call   800292 <_panic>
+
+00801134 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801134:	55                   	push   %ebp
+  801135:	89 e5                	mov    %esp,%ebp
+  801137:	57                   	push   %edi
+  801138:	56                   	push   %esi
+  801139:	53                   	push   %ebx
+  80113a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80113d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801144:	74 22                	je     801168 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801146:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801150:	8b 55 08             	mov    0x8(%ebp),%edx
+  801153:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801156:	89 df                	mov    %ebx,%edi
+  801158:	89 de                	mov    %ebx,%esi
+  80115a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80115c:	85 c0                	test   %eax,%eax
+  80115e:	7f 28                	jg     801188 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801160:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801163:	5b                   	pop    %ebx
+  801164:	5e                   	pop    %esi
+  801165:	5f                   	pop    %edi
+  801166:	5d                   	pop    %ebp
+  801167:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 17 00 00 00       	mov    $0x17,%eax
+  801178:	89 df                	mov    %ebx,%edi
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	8d 35 85 11 80 00    	lea    0x801185,%esi
+  801183:	0f 34                	sysenter
+  801185:	5d                   	pop    %ebp
+		goto out;
+  801186:	eb d4                	jmp    80115c <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801188:	83 ec 0c             	sub    $0xc,%esp
+  80118b:	50                   	push   %eax
+  80118c:	6a 17                	push   $0x17
+  80118e:	68 eb 30 80 00       	push   $0x8030eb
+  801193:	6a 3f                	push   $0x3f
+  801195:	68 08 31 80 00       	push   $0x803108
+  80119a:	e8 f3 f0 ff ff       	call   800292 <_panic>
+
+0080119f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	56                   	push   %esi
+  8011a4:	53                   	push   %ebx
+  8011a5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011a8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011af:	74 22                	je     8011d3 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8011b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b6:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c1:	89 df                	mov    %ebx,%edi
+  8011c3:	89 de                	mov    %ebx,%esi
+  8011c5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c7:	85 c0                	test   %eax,%eax
+  8011c9:	7f 28                	jg     8011f3 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8011cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ce:	5b                   	pop    %ebx
+  8011cf:	5e                   	pop    %esi
+  8011d0:	5f                   	pop    %edi
+  8011d1:	5d                   	pop    %ebp
+  8011d2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011e3:	89 df                	mov    %ebx,%edi
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	8d 35 f0 11 80 00    	lea    0x8011f0,%esi
+  8011ee:	0f 34                	sysenter
+  8011f0:	5d                   	pop    %ebp
+		goto out;
+  8011f1:	eb d4                	jmp    8011c7 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f3:	83 ec 0c             	sub    $0xc,%esp
+  8011f6:	50                   	push   %eax
+  8011f7:	6a 18                	push   $0x18
+  8011f9:	68 eb 30 80 00       	push   $0x8030eb
+  8011fe:	6a 3f                	push   $0x3f
+  801200:	68 08 31 80 00       	push   $0x803108
+  801205:	e8 88 f0 ff ff       	call   800292 <_panic>
+
+0080120a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80120a:	55                   	push   %ebp
+  80120b:	89 e5                	mov    %esp,%ebp
+  80120d:	57                   	push   %edi
+  80120e:	56                   	push   %esi
+  80120f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801210:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801217:	74 1d                	je     801236 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801219:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80121e:	be 00 00 00 00       	mov    $0x0,%esi
+  801223:	8b 55 08             	mov    0x8(%ebp),%edx
+  801226:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801229:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80122c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80122f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801231:	5b                   	pop    %ebx
+  801232:	5e                   	pop    %esi
+  801233:	5f                   	pop    %edi
+  801234:	5d                   	pop    %ebp
+  801235:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801236:	8b 55 08             	mov    0x8(%ebp),%edx
+  801239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801241:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801244:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	8d 35 52 12 80 00    	lea    0x801252,%esi
+  801250:	0f 34                	sysenter
+  801252:	5d                   	pop    %ebp
+		goto out;
+  801253:	eb dc                	jmp    801231 <sys_ipc_try_send+0x27>
+
+00801255 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	57                   	push   %edi
+  801259:	56                   	push   %esi
+  80125a:	53                   	push   %ebx
+  80125b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80125e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801265:	74 21                	je     801288 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801267:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	89 cb                	mov    %ecx,%ebx
+  801276:	89 cf                	mov    %ecx,%edi
+  801278:	89 ce                	mov    %ecx,%esi
+  80127a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80127c:	85 c0                	test   %eax,%eax
+  80127e:	7f 27                	jg     8012a7 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801283:	5b                   	pop    %ebx
+  801284:	5e                   	pop    %esi
+  801285:	5f                   	pop    %edi
+  801286:	5d                   	pop    %ebp
+  801287:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801288:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801290:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801295:	89 cb                	mov    %ecx,%ebx
+  801297:	89 cf                	mov    %ecx,%edi
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	8d 35 a4 12 80 00    	lea    0x8012a4,%esi
+  8012a2:	0f 34                	sysenter
+  8012a4:	5d                   	pop    %ebp
+		goto out;
+  8012a5:	eb d5                	jmp    80127c <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a7:	83 ec 0c             	sub    $0xc,%esp
+  8012aa:	50                   	push   %eax
+  8012ab:	6a 0d                	push   $0xd
+  8012ad:	68 eb 30 80 00       	push   $0x8030eb
+  8012b2:	6a 3f                	push   $0x3f
+  8012b4:	68 08 31 80 00       	push   $0x803108
+  8012b9:	e8 d4 ef ff ff       	call   800292 <_panic>
+
+008012be <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	57                   	push   %edi
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012c4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012cb:	74 1b                	je     8012e8 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8012cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dd:	89 df                	mov    %ebx,%edi
+  8012df:	89 de                	mov    %ebx,%esi
+  8012e1:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8012e3:	5b                   	pop    %ebx
+  8012e4:	5e                   	pop    %esi
+  8012e5:	5f                   	pop    %edi
+  8012e6:	5d                   	pop    %ebp
+  8012e7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012f8:	89 df                	mov    %ebx,%edi
+  8012fa:	55                   	push   %ebp
+  8012fb:	89 e5                	mov    %esp,%ebp
+  8012fd:	8d 35 05 13 80 00    	lea    0x801305,%esi
+  801303:	0f 34                	sysenter
+  801305:	5d                   	pop    %ebp
+		goto out;
+  801306:	eb db                	jmp    8012e3 <sys_ipc_recv_until+0x25>
+
+00801308 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801308:	55                   	push   %ebp
+  801309:	89 e5                	mov    %esp,%ebp
+  80130b:	57                   	push   %edi
+  80130c:	56                   	push   %esi
+  80130d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80130e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801315:	74 19                	je     801330 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801317:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801321:	89 d1                	mov    %edx,%ecx
+  801323:	89 d3                	mov    %edx,%ebx
+  801325:	89 d7                	mov    %edx,%edi
+  801327:	89 d6                	mov    %edx,%esi
+  801329:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80132b:	5b                   	pop    %ebx
+  80132c:	5e                   	pop    %esi
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801330:	ba 00 00 00 00       	mov    $0x0,%edx
+  801335:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80133a:	89 d1                	mov    %edx,%ecx
+  80133c:	89 d3                	mov    %edx,%ebx
+  80133e:	89 d7                	mov    %edx,%edi
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	8d 35 4b 13 80 00    	lea    0x80134b,%esi
+  801349:	0f 34                	sysenter
+  80134b:	5d                   	pop    %ebp
+		goto out;
+  80134c:	eb dd                	jmp    80132b <sys_time_msec+0x23>
+
+0080134e <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80134e:	55                   	push   %ebp
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	57                   	push   %edi
+  801352:	56                   	push   %esi
+  801353:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801354:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80135b:	74 1a                	je     801377 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80135d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801362:	b8 10 00 00 00       	mov    $0x10,%eax
+  801367:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136a:	89 cb                	mov    %ecx,%ebx
+  80136c:	89 cf                	mov    %ecx,%edi
+  80136e:	89 ce                	mov    %ecx,%esi
+  801370:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801372:	5b                   	pop    %ebx
+  801373:	5e                   	pop    %esi
+  801374:	5f                   	pop    %edi
+  801375:	5d                   	pop    %ebp
+  801376:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801377:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801384:	89 cb                	mov    %ecx,%ebx
+  801386:	89 cf                	mov    %ecx,%edi
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	8d 35 93 13 80 00    	lea    0x801393,%esi
+  801391:	0f 34                	sysenter
+  801393:	5d                   	pop    %ebp
+		goto out;
+  801394:	eb dc                	jmp    801372 <sys_sleep_until+0x24>
+
+00801396 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	57                   	push   %edi
+  80139a:	56                   	push   %esi
+  80139b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80139c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013a3:	74 1a                	je     8013bf <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8013a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013aa:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b2:	89 cb                	mov    %ecx,%ebx
+  8013b4:	89 cf                	mov    %ecx,%edi
+  8013b6:	89 ce                	mov    %ecx,%esi
+  8013b8:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8013ba:	5b                   	pop    %ebx
+  8013bb:	5e                   	pop    %esi
+  8013bc:	5f                   	pop    %edi
+  8013bd:	5d                   	pop    %ebp
+  8013be:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013cc:	89 cb                	mov    %ecx,%ebx
+  8013ce:	89 cf                	mov    %ecx,%edi
+  8013d0:	55                   	push   %ebp
+  8013d1:	89 e5                	mov    %esp,%ebp
+  8013d3:	8d 35 db 13 80 00    	lea    0x8013db,%esi
+  8013d9:	0f 34                	sysenter
+  8013db:	5d                   	pop    %ebp
+		goto out;
+  8013dc:	eb dc                	jmp    8013ba <sys_env_print_stats+0x24>
+
+008013de <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8013de:	55                   	push   %ebp
+  8013df:	89 e5                	mov    %esp,%ebp
+  8013e1:	57                   	push   %edi
+  8013e2:	56                   	push   %esi
+  8013e3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013e4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013eb:	74 1b                	je     801408 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8013ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fd:	89 df                	mov    %ebx,%edi
+  8013ff:	89 de                	mov    %ebx,%esi
+  801401:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801403:	5b                   	pop    %ebx
+  801404:	5e                   	pop    %esi
+  801405:	5f                   	pop    %edi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801408:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801410:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801413:	b8 19 00 00 00       	mov    $0x19,%eax
+  801418:	89 df                	mov    %ebx,%edi
+  80141a:	55                   	push   %ebp
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	8d 35 25 14 80 00    	lea    0x801425,%esi
+  801423:	0f 34                	sysenter
+  801425:	5d                   	pop    %ebp
+		goto out;
+  801426:	eb db                	jmp    801403 <sys_perf+0x25>
+
+00801428 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801428:	55                   	push   %ebp
+  801429:	89 e5                	mov    %esp,%ebp
+  80142b:	57                   	push   %edi
+  80142c:	56                   	push   %esi
+  80142d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80142e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801435:	74 19                	je     801450 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801437:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801441:	89 d1                	mov    %edx,%ecx
+  801443:	89 d3                	mov    %edx,%ebx
+  801445:	89 d7                	mov    %edx,%edi
+  801447:	89 d6                	mov    %edx,%esi
+  801449:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80144b:	5b                   	pop    %ebx
+  80144c:	5e                   	pop    %esi
+  80144d:	5f                   	pop    %edi
+  80144e:	5d                   	pop    %ebp
+  80144f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801450:	ba 00 00 00 00       	mov    $0x0,%edx
+  801455:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80145a:	89 d1                	mov    %edx,%ecx
+  80145c:	89 d3                	mov    %edx,%ebx
+  80145e:	89 d7                	mov    %edx,%edi
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	8d 35 6b 14 80 00    	lea    0x80146b,%esi
+  801469:	0f 34                	sysenter
+  80146b:	5d                   	pop    %ebp
+		goto out;
+  80146c:	eb dd                	jmp    80144b <sys_fork+0x23>
+
+0080146e <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80146e:	55                   	push   %ebp
+  80146f:	89 e5                	mov    %esp,%ebp
+  801471:	57                   	push   %edi
+  801472:	56                   	push   %esi
+  801473:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801474:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80147b:	74 1c                	je     801499 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80147d:	be 00 00 00 00       	mov    $0x0,%esi
+  801482:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801490:	89 f7                	mov    %esi,%edi
+  801492:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801494:	5b                   	pop    %ebx
+  801495:	5e                   	pop    %esi
+  801496:	5f                   	pop    %edi
+  801497:	5d                   	pop    %ebp
+  801498:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801499:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	8d 35 b7 14 80 00    	lea    0x8014b7,%esi
+  8014b5:	0f 34                	sysenter
+  8014b7:	5d                   	pop    %ebp
+		goto out;
+  8014b8:	eb da                	jmp    801494 <sys_thread_create+0x26>
+
+008014ba <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	57                   	push   %edi
+  8014be:	56                   	push   %esi
+  8014bf:	53                   	push   %ebx
+  8014c0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014c3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ca:	74 24                	je     8014f0 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8014cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	7f 27                	jg     80150f <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8014e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014eb:	5b                   	pop    %ebx
+  8014ec:	5e                   	pop    %esi
+  8014ed:	5f                   	pop    %edi
+  8014ee:	5d                   	pop    %ebp
+  8014ef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	8d 35 0c 15 80 00    	lea    0x80150c,%esi
+  80150a:	0f 34                	sysenter
+  80150c:	5d                   	pop    %ebp
+		goto out;
+  80150d:	eb d5                	jmp    8014e4 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	50                   	push   %eax
+  801513:	6a 1f                	push   $0x1f
+  801515:	68 eb 30 80 00       	push   $0x8030eb
+  80151a:	6a 3f                	push   $0x3f
+  80151c:	68 08 31 80 00       	push   $0x803108
+  801521:	e8 6c ed ff ff       	call   800292 <_panic>
+
+00801526 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801526:	55                   	push   %ebp
+  801527:	89 e5                	mov    %esp,%ebp
+  801529:	57                   	push   %edi
+  80152a:	56                   	push   %esi
+  80152b:	53                   	push   %ebx
+  80152c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80152f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801536:	74 23                	je     80155b <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801538:	be 00 00 00 00       	mov    $0x0,%esi
+  80153d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801542:	8b 55 08             	mov    0x8(%ebp),%edx
+  801545:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801548:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154b:	89 f7                	mov    %esi,%edi
+  80154d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80154f:	85 c0                	test   %eax,%eax
+  801551:	7f 29                	jg     80157c <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801556:	5b                   	pop    %ebx
+  801557:	5e                   	pop    %esi
+  801558:	5f                   	pop    %edi
+  801559:	5d                   	pop    %ebp
+  80155a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80155b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801561:	b8 20 00 00 00       	mov    $0x20,%eax
+  801566:	bf 00 00 00 00       	mov    $0x0,%edi
+  80156b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156e:	55                   	push   %ebp
+  80156f:	89 e5                	mov    %esp,%ebp
+  801571:	8d 35 79 15 80 00    	lea    0x801579,%esi
+  801577:	0f 34                	sysenter
+  801579:	5d                   	pop    %ebp
+		goto out;
+  80157a:	eb d3                	jmp    80154f <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80157c:	83 ec 0c             	sub    $0xc,%esp
+  80157f:	50                   	push   %eax
+  801580:	6a 20                	push   $0x20
+  801582:	68 eb 30 80 00       	push   $0x8030eb
+  801587:	6a 3f                	push   $0x3f
+  801589:	68 08 31 80 00       	push   $0x803108
+  80158e:	e8 ff ec ff ff       	call   800292 <_panic>
+
+00801593 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	57                   	push   %edi
+  801597:	56                   	push   %esi
+  801598:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801599:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015a0:	74 1b                	je     8015bd <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8015a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b2:	89 df                	mov    %ebx,%edi
+  8015b4:	89 de                	mov    %ebx,%esi
+  8015b6:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8015b8:	5b                   	pop    %ebx
+  8015b9:	5e                   	pop    %esi
+  8015ba:	5f                   	pop    %edi
+  8015bb:	5d                   	pop    %ebp
+  8015bc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015cd:	89 df                	mov    %ebx,%edi
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	8d 35 da 15 80 00    	lea    0x8015da,%esi
+  8015d8:	0f 34                	sysenter
+  8015da:	5d                   	pop    %ebp
+		goto out;
+  8015db:	eb db                	jmp    8015b8 <sys_batch+0x25>
+
+008015dd <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	57                   	push   %edi
+  8015e1:	56                   	push   %esi
+  8015e2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015e3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015ea:	74 1a                	je     801606 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8015ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	89 cb                	mov    %ecx,%ebx
+  8015fb:	89 cf                	mov    %ecx,%edi
+  8015fd:	89 ce                	mov    %ecx,%esi
+  8015ff:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801601:	5b                   	pop    %ebx
+  801602:	5e                   	pop    %esi
+  801603:	5f                   	pop    %edi
+  801604:	5d                   	pop    %ebp
+  801605:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801606:	8b 55 08             	mov    0x8(%ebp),%edx
+  801609:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80160e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801613:	89 cb                	mov    %ecx,%ebx
+  801615:	89 cf                	mov    %ecx,%edi
+  801617:	55                   	push   %ebp
+  801618:	89 e5                	mov    %esp,%ebp
+  80161a:	8d 35 22 16 80 00    	lea    0x801622,%esi
+  801620:	0f 34                	sysenter
+  801622:	5d                   	pop    %ebp
+		goto out;
+  801623:	eb dc                	jmp    801601 <sys_trace_ctl+0x24>
+
+00801625 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801625:	55                   	push   %ebp
+  801626:	89 e5                	mov    %esp,%ebp
+  801628:	57                   	push   %edi
+  801629:	56                   	push   %esi
+  80162a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80162b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801632:	74 1c                	je     801650 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801634:	be 00 00 00 00       	mov    $0x0,%esi
+  801639:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80163e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801641:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801644:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801647:	89 f7                	mov    %esi,%edi
+  801649:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80164b:	5b                   	pop    %ebx
+  80164c:	5e                   	pop    %esi
+  80164d:	5f                   	pop    %edi
+  80164e:	5d                   	pop    %ebp
+  80164f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801650:	8b 55 08             	mov    0x8(%ebp),%edx
+  801653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801656:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80165b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801660:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801663:	55                   	push   %ebp
+  801664:	89 e5                	mov    %esp,%ebp
+  801666:	8d 35 6e 16 80 00    	lea    0x80166e,%esi
+  80166c:	0f 34                	sysenter
+  80166e:	5d                   	pop    %ebp
+		goto out;
+  80166f:	eb da                	jmp    80164b <sys_trace_read+0x26>
+
+00801671 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801671:	55                   	push   %ebp
+  801672:	89 e5                	mov    %esp,%ebp
+  801674:	57                   	push   %edi
+  801675:	56                   	push   %esi
+  801676:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801677:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80167e:	74 1c                	je     80169c <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801680:	be 00 00 00 00       	mov    $0x0,%esi
+  801685:	b8 21 00 00 00       	mov    $0x21,%eax
+  80168a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801690:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801693:	89 f7                	mov    %esi,%edi
+  801695:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801697:	5b                   	pop    %ebx
+  801698:	5e                   	pop    %esi
+  801699:	5f                   	pop    %edi
+  80169a:	5d                   	pop    %ebp
+  80169b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80169c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a2:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	8d 35 ba 16 80 00    	lea    0x8016ba,%esi
+  8016b8:	0f 34                	sysenter
+  8016ba:	5d                   	pop    %ebp
+		goto out;
+  8016bb:	eb da                	jmp    801697 <sys_meminfo+0x26>
+
+008016bd <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	57                   	push   %edi
+  8016c1:	56                   	push   %esi
+  8016c2:	53                   	push   %ebx
+  8016c3:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8016c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8016ca:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016d1:	74 1f                	je     8016f2 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8016d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d8:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e0:	89 df                	mov    %ebx,%edi
+  8016e2:	89 de                	mov    %ebx,%esi
+  8016e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	7f 25                	jg     80170f <sys_env_set_ksm+0x52>
+}
+  8016ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ed:	5b                   	pop    %ebx
+  8016ee:	5e                   	pop    %esi
+  8016ef:	5f                   	pop    %edi
+  8016f0:	5d                   	pop    %ebp
+  8016f1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fa:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016ff:	89 df                	mov    %ebx,%edi
+  801701:	55                   	push   %ebp
+  801702:	89 e5                	mov    %esp,%ebp
+  801704:	8d 35 0c 17 80 00    	lea    0x80170c,%esi
+  80170a:	0f 34                	sysenter
+  80170c:	5d                   	pop    %ebp
+		goto out;
+  80170d:	eb d7                	jmp    8016e6 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80170f:	83 ec 0c             	sub    $0xc,%esp
+  801712:	50                   	push   %eax
+  801713:	6a 22                	push   $0x22
+  801715:	68 eb 30 80 00       	push   $0x8030eb
+  80171a:	6a 3f                	push   $0x3f
+  80171c:	68 08 31 80 00       	push   $0x803108
+  801721:	e8 6c eb ff ff       	call   800292 <_panic>
+
+00801726 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801726:	55                   	push   %ebp
+  801727:	89 e5                	mov    %esp,%ebp
+  801729:	57                   	push   %edi
+  80172a:	56                   	push   %esi
+  80172b:	53                   	push   %ebx
+  80172c:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80172f:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801732:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801739:	74 24                	je     80175f <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80173b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801740:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801745:	89 cb                	mov    %ecx,%ebx
+  801747:	89 cf                	mov    %ecx,%edi
+  801749:	89 ce                	mov    %ecx,%esi
+  80174b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80174d:	85 c0                	test   %eax,%eax
+  80174f:	7f 2a                	jg     80177b <sys_time_nsec+0x55>
+	return ns;
+}
+  801751:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801754:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801757:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80175a:	5b                   	pop    %ebx
+  80175b:	5e                   	pop    %esi
+  80175c:	5f                   	pop    %edi
+  80175d:	5d                   	pop    %ebp
+  80175e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80175f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801764:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801769:	89 cb                	mov    %ecx,%ebx
+  80176b:	89 cf                	mov    %ecx,%edi
+  80176d:	55                   	push   %ebp
+  80176e:	89 e5                	mov    %esp,%ebp
+  801770:	8d 35 78 17 80 00    	lea    0x801778,%esi
+  801776:	0f 34                	sysenter
+  801778:	5d                   	pop    %ebp
+		goto out;
+  801779:	eb d2                	jmp    80174d <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80177b:	83 ec 0c             	sub    $0xc,%esp
+  80177e:	50                   	push   %eax
+  80177f:	6a 0f                	push   $0xf
+  801781:	68 eb 30 80 00       	push   $0x8030eb
+  801786:	6a 3f                	push   $0x3f
+  801788:	68 08 31 80 00       	push   $0x803108
+  80178d:	e8 00 eb ff ff       	call   800292 <_panic>
+
+00801792 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	57                   	push   %edi
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+  801798:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80179b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017a2:	74 22                	je     8017c6 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8017a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a9:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b4:	89 df                	mov    %ebx,%edi
+  8017b6:	89 de                	mov    %ebx,%esi
+  8017b8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017ba:	85 c0                	test   %eax,%eax
+  8017bc:	7f 28                	jg     8017e6 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8017be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5f                   	pop    %edi
+  8017c4:	5d                   	pop    %ebp
+  8017c5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017d6:	89 df                	mov    %ebx,%edi
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	8d 35 e3 17 80 00    	lea    0x8017e3,%esi
+  8017e1:	0f 34                	sysenter
+  8017e3:	5d                   	pop    %ebp
+		goto out;
+  8017e4:	eb d4                	jmp    8017ba <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017e6:	83 ec 0c             	sub    $0xc,%esp
+  8017e9:	50                   	push   %eax
+  8017ea:	6a 12                	push   $0x12
+  8017ec:	68 eb 30 80 00       	push   $0x8030eb
+  8017f1:	6a 3f                	push   $0x3f
+  8017f3:	68 08 31 80 00       	push   $0x803108
+  8017f8:	e8 95 ea ff ff       	call   800292 <_panic>
+
+008017fd <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	57                   	push   %edi
+  801801:	56                   	push   %esi
+  801802:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801803:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80180a:	74 1b                	je     801827 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80180c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801811:	b8 13 00 00 00       	mov    $0x13,%eax
+  801816:	8b 55 08             	mov    0x8(%ebp),%edx
+  801819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181c:	89 df                	mov    %ebx,%edi
+  80181e:	89 de                	mov    %ebx,%esi
+  801820:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801822:	5b                   	pop    %ebx
+  801823:	5e                   	pop    %esi
+  801824:	5f                   	pop    %edi
+  801825:	5d                   	pop    %ebp
+  801826:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801827:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801832:	b8 13 00 00 00       	mov    $0x13,%eax
+  801837:	89 df                	mov    %ebx,%edi
+  801839:	55                   	push   %ebp
+  80183a:	89 e5                	mov    %esp,%ebp
+  80183c:	8d 35 44 18 80 00    	lea    0x801844,%esi
+  801842:	0f 34                	sysenter
+  801844:	5d                   	pop    %ebp
+		goto out;
+  801845:	eb db                	jmp    801822 <sys_e1000_receive+0x25>
+
+00801847 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	57                   	push   %edi
+  80184b:	56                   	push   %esi
+  80184c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80184d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801854:	74 1b                	je     801871 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801856:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801860:	8b 55 08             	mov    0x8(%ebp),%edx
+  801863:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801866:	89 df                	mov    %ebx,%edi
+  801868:	89 de                	mov    %ebx,%esi
+  80186a:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80186c:	5b                   	pop    %ebx
+  80186d:	5e                   	pop    %esi
+  80186e:	5f                   	pop    %edi
+  80186f:	5d                   	pop    %ebp
+  801870:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801871:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801876:	8b 55 08             	mov    0x8(%ebp),%edx
+  801879:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801881:	89 df                	mov    %ebx,%edi
+  801883:	55                   	push   %ebp
+  801884:	89 e5                	mov    %esp,%ebp
+  801886:	8d 35 8e 18 80 00    	lea    0x80188e,%esi
+  80188c:	0f 34                	sysenter
+  80188e:	5d                   	pop    %ebp
+		goto out;
+  80188f:	eb db                	jmp    80186c <sys_e1000_read_hwaddr+0x25>
+
+00801891 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801891:	55                   	push   %ebp
+  801892:	89 e5                	mov    %esp,%ebp
+  801894:	57                   	push   %edi
+  801895:	56                   	push   %esi
+  801896:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801897:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80189e:	74 1a                	je     8018ba <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8018a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ad:	89 cb                	mov    %ecx,%ebx
+  8018af:	89 cf                	mov    %ecx,%edi
+  8018b1:	89 ce                	mov    %ecx,%esi
+  8018b3:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8018b5:	5b                   	pop    %ebx
+  8018b6:	5e                   	pop    %esi
+  8018b7:	5f                   	pop    %edi
+  8018b8:	5d                   	pop    %ebp
+  8018b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018c7:	89 cb                	mov    %ecx,%ebx
+  8018c9:	89 cf                	mov    %ecx,%edi
+  8018cb:	55                   	push   %ebp
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	8d 35 d6 18 80 00    	lea    0x8018d6,%esi
+  8018d4:	0f 34                	sysenter
+  8018d6:	5d                   	pop    %ebp
+		goto out;
+  8018d7:	eb dc                	jmp    8018b5 <sys_sb16_read_version+0x24>
+
+008018d9 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8018d9:	55                   	push   %ebp
+  8018da:	89 e5                	mov    %esp,%ebp
+  8018dc:	57                   	push   %edi
+  8018dd:	56                   	push   %esi
+  8018de:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018df:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018e6:	74 1b                	je     801903 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8018e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ed:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f8:	89 df                	mov    %ebx,%edi
+  8018fa:	89 de                	mov    %ebx,%esi
+  8018fc:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8018fe:	5b                   	pop    %ebx
+  8018ff:	5e                   	pop    %esi
+  801900:	5f                   	pop    %edi
+  801901:	5d                   	pop    %ebp
+  801902:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801903:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801908:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80190e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801913:	89 df                	mov    %ebx,%edi
+  801915:	55                   	push   %ebp
+  801916:	89 e5                	mov    %esp,%ebp
+  801918:	8d 35 20 19 80 00    	lea    0x801920,%esi
+  80191e:	0f 34                	sysenter
+  801920:	5d                   	pop    %ebp
+		goto out;
+  801921:	eb db                	jmp    8018fe <sys_sb16_play+0x25>
+
+00801923 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801923:	55                   	push   %ebp
+  801924:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801926:	8b 45 08             	mov    0x8(%ebp),%eax
+  801929:	05 00 00 00 30       	add    $0x30000000,%eax
+  80192e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801931:	5d                   	pop    %ebp
+  801932:	c3                   	ret
+
+00801933 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801933:	55                   	push   %ebp
+  801934:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801936:	8b 45 08             	mov    0x8(%ebp),%eax
+  801939:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80193e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801943:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+
+0080194a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80194d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801952:	eb 02                	jmp    801956 <fd_alloc+0xc>
+  801954:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801956:	89 c2                	mov    %eax,%edx
+  801958:	c1 ea 16             	shr    $0x16,%edx
+  80195b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801962:	f6 c2 01             	test   $0x1,%dl
+  801965:	74 2b                	je     801992 <fd_alloc+0x48>
+  801967:	89 c2                	mov    %eax,%edx
+  801969:	c1 ea 0c             	shr    $0xc,%edx
+  80196c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801973:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801979:	f6 c1 01             	test   $0x1,%cl
+  80197c:	74 14                	je     801992 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80197e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801984:	75 ce                	jne    801954 <fd_alloc+0xa>
+  801986:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80198b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801990:	eb 05                	jmp    801997 <fd_alloc+0x4d>
+			return 0;
+  801992:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801997:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199a:	89 02                	mov    %eax,(%edx)
+}
+  80199c:	89 c8                	mov    %ecx,%eax
+  80199e:	5d                   	pop    %ebp
+  80199f:	c3                   	ret
+
+008019a0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019a6:	83 f8 1f             	cmp    $0x1f,%eax
+  8019a9:	77 30                	ja     8019db <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019ab:	c1 e0 0c             	shl    $0xc,%eax
+  8019ae:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8019b3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019b9:	f6 c2 01             	test   $0x1,%dl
+  8019bc:	74 24                	je     8019e2 <fd_lookup+0x42>
+  8019be:	89 c2                	mov    %eax,%edx
+  8019c0:	c1 ea 0c             	shr    $0xc,%edx
+  8019c3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019ca:	f6 c2 01             	test   $0x1,%dl
+  8019cd:	74 1a                	je     8019e9 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019d2:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019d9:	5d                   	pop    %ebp
+  8019da:	c3                   	ret
+		return -E_INVAL;
+  8019db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e0:	eb f7                	jmp    8019d9 <fd_lookup+0x39>
+		return -E_INVAL;
+  8019e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019e7:	eb f0                	jmp    8019d9 <fd_lookup+0x39>
+  8019e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ee:	eb e9                	jmp    8019d9 <fd_lookup+0x39>
+
+008019f0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8019f0:	55                   	push   %ebp
+  8019f1:	89 e5                	mov    %esp,%ebp
+  8019f3:	53                   	push   %ebx
+  8019f4:	83 ec 04             	sub    $0x4,%esp
+  8019f7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ff:	eb 03                	jmp    801a04 <dev_lookup+0x14>
+  801a01:	83 c0 01             	add    $0x1,%eax
+  801a04:	8b 1c 85 94 31 80 00 	mov    0x803194(,%eax,4),%ebx
+  801a0b:	85 db                	test   %ebx,%ebx
+  801a0d:	74 0b                	je     801a1a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801a0f:	39 13                	cmp    %edx,(%ebx)
+  801a11:	75 ee                	jne    801a01 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a18:	eb 2e                	jmp    801a48 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801a1a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801a1c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801a21:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801a27:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801a2c:	76 24                	jbe    801a52 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a2e:	8b 41 48             	mov    0x48(%ecx),%eax
+  801a31:	83 ec 04             	sub    $0x4,%esp
+  801a34:	52                   	push   %edx
+  801a35:	50                   	push   %eax
+  801a36:	68 18 31 80 00       	push   $0x803118
+  801a3b:	e8 2d e9 ff ff       	call   80036d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a40:	83 c4 10             	add    $0x10,%esp
+  801a43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a4b:	89 1a                	mov    %ebx,(%edx)
+}
+  801a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a50:	c9                   	leave
+  801a51:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801a52:	c1 e8 10             	shr    $0x10,%eax
+  801a55:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801a5b:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801a61:	eb cb                	jmp    801a2e <dev_lookup+0x3e>
+
+00801a63 <fd_close>:
+{
+  801a63:	55                   	push   %ebp
+  801a64:	89 e5                	mov    %esp,%ebp
+  801a66:	57                   	push   %edi
+  801a67:	56                   	push   %esi
+  801a68:	53                   	push   %ebx
+  801a69:	83 ec 24             	sub    $0x24,%esp
+  801a6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a6f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a72:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a75:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a76:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a7c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a7f:	50                   	push   %eax
+  801a80:	e8 1b ff ff ff       	call   8019a0 <fd_lookup>
+  801a85:	89 c3                	mov    %eax,%ebx
+  801a87:	83 c4 10             	add    $0x10,%esp
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	78 05                	js     801a93 <fd_close+0x30>
+	    || fd != fd2)
+  801a8e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a91:	74 16                	je     801aa9 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a93:	89 f8                	mov    %edi,%eax
+  801a95:	84 c0                	test   %al,%al
+  801a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a9f:	89 d8                	mov    %ebx,%eax
+  801aa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa4:	5b                   	pop    %ebx
+  801aa5:	5e                   	pop    %esi
+  801aa6:	5f                   	pop    %edi
+  801aa7:	5d                   	pop    %ebp
+  801aa8:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801aa9:	83 ec 08             	sub    $0x8,%esp
+  801aac:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801aaf:	50                   	push   %eax
+  801ab0:	ff 36                	push   (%esi)
+  801ab2:	e8 39 ff ff ff       	call   8019f0 <dev_lookup>
+  801ab7:	89 c3                	mov    %eax,%ebx
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	78 1a                	js     801ada <fd_close+0x77>
+		if (dev->dev_close)
+  801ac0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ac3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ac6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801acb:	85 c0                	test   %eax,%eax
+  801acd:	74 0b                	je     801ada <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801acf:	83 ec 0c             	sub    $0xc,%esp
+  801ad2:	56                   	push   %esi
+  801ad3:	ff d0                	call   *%eax
+  801ad5:	89 c3                	mov    %eax,%ebx
+  801ad7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801ada:	83 ec 08             	sub    $0x8,%esp
+  801add:	56                   	push   %esi
+  801ade:	6a 00                	push   $0x0
+  801ae0:	e8 a3 f4 ff ff       	call   800f88 <sys_page_unmap>
+	return r;
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	eb b5                	jmp    801a9f <fd_close+0x3c>
+
+00801aea <close>:
+
+int
+close(int fdnum)
+{
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801af0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af3:	50                   	push   %eax
+  801af4:	ff 75 08             	push   0x8(%ebp)
+  801af7:	e8 a4 fe ff ff       	call   8019a0 <fd_lookup>
+  801afc:	83 c4 10             	add    $0x10,%esp
+  801aff:	85 c0                	test   %eax,%eax
+  801b01:	79 02                	jns    801b05 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b03:	c9                   	leave
+  801b04:	c3                   	ret
+		return fd_close(fd, 1);
+  801b05:	83 ec 08             	sub    $0x8,%esp
+  801b08:	6a 01                	push   $0x1
+  801b0a:	ff 75 f4             	push   -0xc(%ebp)
+  801b0d:	e8 51 ff ff ff       	call   801a63 <fd_close>
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	eb ec                	jmp    801b03 <close+0x19>
+
+00801b17 <close_all>:
+
+void
+close_all(void)
+{
+  801b17:	55                   	push   %ebp
+  801b18:	89 e5                	mov    %esp,%ebp
+  801b1a:	53                   	push   %ebx
+  801b1b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b23:	83 ec 0c             	sub    $0xc,%esp
+  801b26:	53                   	push   %ebx
+  801b27:	e8 be ff ff ff       	call   801aea <close>
+	for (i = 0; i < MAXFD; i++)
+  801b2c:	83 c3 01             	add    $0x1,%ebx
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	83 fb 20             	cmp    $0x20,%ebx
+  801b35:	75 ec                	jne    801b23 <close_all+0xc>
+}
+  801b37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b3a:	c9                   	leave
+  801b3b:	c3                   	ret
+
+00801b3c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b3c:	55                   	push   %ebp
+  801b3d:	89 e5                	mov    %esp,%ebp
+  801b3f:	57                   	push   %edi
+  801b40:	56                   	push   %esi
+  801b41:	53                   	push   %ebx
+  801b42:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b45:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b48:	50                   	push   %eax
+  801b49:	ff 75 08             	push   0x8(%ebp)
+  801b4c:	e8 4f fe ff ff       	call   8019a0 <fd_lookup>
+  801b51:	89 c3                	mov    %eax,%ebx
+  801b53:	83 c4 10             	add    $0x10,%esp
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	78 7f                	js     801bd9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b5a:	83 ec 0c             	sub    $0xc,%esp
+  801b5d:	ff 75 0c             	push   0xc(%ebp)
+  801b60:	e8 85 ff ff ff       	call   801aea <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b65:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b68:	c1 e6 0c             	shl    $0xc,%esi
+  801b6b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b71:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b74:	89 3c 24             	mov    %edi,(%esp)
+  801b77:	e8 b7 fd ff ff       	call   801933 <fd2data>
+  801b7c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b7e:	89 34 24             	mov    %esi,(%esp)
+  801b81:	e8 ad fd ff ff       	call   801933 <fd2data>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b8c:	89 d8                	mov    %ebx,%eax
+  801b8e:	c1 e8 16             	shr    $0x16,%eax
+  801b91:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b98:	a8 01                	test   $0x1,%al
+  801b9a:	74 11                	je     801bad <dup+0x71>
+  801b9c:	89 d8                	mov    %ebx,%eax
+  801b9e:	c1 e8 0c             	shr    $0xc,%eax
+  801ba1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ba8:	f6 c2 01             	test   $0x1,%dl
+  801bab:	75 36                	jne    801be3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bad:	89 f8                	mov    %edi,%eax
+  801baf:	c1 e8 0c             	shr    $0xc,%eax
+  801bb2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bc1:	50                   	push   %eax
+  801bc2:	56                   	push   %esi
+  801bc3:	6a 00                	push   $0x0
+  801bc5:	57                   	push   %edi
+  801bc6:	6a 00                	push   $0x0
+  801bc8:	e8 4d f3 ff ff       	call   800f1a <sys_page_map>
+  801bcd:	89 c3                	mov    %eax,%ebx
+  801bcf:	83 c4 20             	add    $0x20,%esp
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	78 33                	js     801c09 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801bd6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801bd9:	89 d8                	mov    %ebx,%eax
+  801bdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bde:	5b                   	pop    %ebx
+  801bdf:	5e                   	pop    %esi
+  801be0:	5f                   	pop    %edi
+  801be1:	5d                   	pop    %ebp
+  801be2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801be3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bea:	83 ec 0c             	sub    $0xc,%esp
+  801bed:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bf2:	50                   	push   %eax
+  801bf3:	ff 75 d4             	push   -0x2c(%ebp)
+  801bf6:	6a 00                	push   $0x0
+  801bf8:	53                   	push   %ebx
+  801bf9:	6a 00                	push   $0x0
+  801bfb:	e8 1a f3 ff ff       	call   800f1a <sys_page_map>
+  801c00:	89 c3                	mov    %eax,%ebx
+  801c02:	83 c4 20             	add    $0x20,%esp
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	79 a4                	jns    801bad <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c09:	83 ec 08             	sub    $0x8,%esp
+  801c0c:	56                   	push   %esi
+  801c0d:	6a 00                	push   $0x0
+  801c0f:	e8 74 f3 ff ff       	call   800f88 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c14:	83 c4 08             	add    $0x8,%esp
+  801c17:	ff 75 d4             	push   -0x2c(%ebp)
+  801c1a:	6a 00                	push   $0x0
+  801c1c:	e8 67 f3 ff ff       	call   800f88 <sys_page_unmap>
+	return r;
+  801c21:	83 c4 10             	add    $0x10,%esp
+  801c24:	eb b3                	jmp    801bd9 <dup+0x9d>
+
+00801c26 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	56                   	push   %esi
+  801c2a:	53                   	push   %ebx
+  801c2b:	83 ec 18             	sub    $0x18,%esp
+  801c2e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c31:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c34:	50                   	push   %eax
+  801c35:	53                   	push   %ebx
+  801c36:	e8 65 fd ff ff       	call   8019a0 <fd_lookup>
+  801c3b:	83 c4 10             	add    $0x10,%esp
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	78 3c                	js     801c7e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c42:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c45:	83 ec 08             	sub    $0x8,%esp
+  801c48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c4b:	50                   	push   %eax
+  801c4c:	ff 36                	push   (%esi)
+  801c4e:	e8 9d fd ff ff       	call   8019f0 <dev_lookup>
+  801c53:	83 c4 10             	add    $0x10,%esp
+  801c56:	85 c0                	test   %eax,%eax
+  801c58:	78 24                	js     801c7e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c5a:	8b 46 08             	mov    0x8(%esi),%eax
+  801c5d:	83 e0 03             	and    $0x3,%eax
+  801c60:	83 f8 01             	cmp    $0x1,%eax
+  801c63:	74 20                	je     801c85 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c68:	8b 40 08             	mov    0x8(%eax),%eax
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	74 57                	je     801cc6 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c6f:	83 ec 04             	sub    $0x4,%esp
+  801c72:	ff 75 10             	push   0x10(%ebp)
+  801c75:	ff 75 0c             	push   0xc(%ebp)
+  801c78:	56                   	push   %esi
+  801c79:	ff d0                	call   *%eax
+  801c7b:	83 c4 10             	add    $0x10,%esp
+}
+  801c7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c81:	5b                   	pop    %ebx
+  801c82:	5e                   	pop    %esi
+  801c83:	5d                   	pop    %ebp
+  801c84:	c3                   	ret
+  801c85:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c87:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c8c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c92:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c97:	76 1c                	jbe    801cb5 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c99:	8b 42 48             	mov    0x48(%edx),%eax
+  801c9c:	83 ec 04             	sub    $0x4,%esp
+  801c9f:	53                   	push   %ebx
+  801ca0:	50                   	push   %eax
+  801ca1:	68 59 31 80 00       	push   $0x803159
+  801ca6:	e8 c2 e6 ff ff       	call   80036d <cprintf>
+		return -E_INVAL;
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cb3:	eb c9                	jmp    801c7e <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cb5:	c1 e8 10             	shr    $0x10,%eax
+  801cb8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cbe:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cc4:	eb d3                	jmp    801c99 <read+0x73>
+		return -E_NOT_SUPP;
+  801cc6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ccb:	eb b1                	jmp    801c7e <read+0x58>
+
+00801ccd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ccd:	55                   	push   %ebp
+  801cce:	89 e5                	mov    %esp,%ebp
+  801cd0:	57                   	push   %edi
+  801cd1:	56                   	push   %esi
+  801cd2:	53                   	push   %ebx
+  801cd3:	83 ec 0c             	sub    $0xc,%esp
+  801cd6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801cd9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801cdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce1:	eb 02                	jmp    801ce5 <readn+0x18>
+  801ce3:	01 c3                	add    %eax,%ebx
+  801ce5:	39 f3                	cmp    %esi,%ebx
+  801ce7:	73 21                	jae    801d0a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ce9:	83 ec 04             	sub    $0x4,%esp
+  801cec:	89 f0                	mov    %esi,%eax
+  801cee:	29 d8                	sub    %ebx,%eax
+  801cf0:	50                   	push   %eax
+  801cf1:	89 d8                	mov    %ebx,%eax
+  801cf3:	03 45 0c             	add    0xc(%ebp),%eax
+  801cf6:	50                   	push   %eax
+  801cf7:	57                   	push   %edi
+  801cf8:	e8 29 ff ff ff       	call   801c26 <read>
+		if (m < 0)
+  801cfd:	83 c4 10             	add    $0x10,%esp
+  801d00:	85 c0                	test   %eax,%eax
+  801d02:	78 04                	js     801d08 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d04:	75 dd                	jne    801ce3 <readn+0x16>
+  801d06:	eb 02                	jmp    801d0a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d08:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d0a:	89 d8                	mov    %ebx,%eax
+  801d0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d0f:	5b                   	pop    %ebx
+  801d10:	5e                   	pop    %esi
+  801d11:	5f                   	pop    %edi
+  801d12:	5d                   	pop    %ebp
+  801d13:	c3                   	ret
+
+00801d14 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d14:	55                   	push   %ebp
+  801d15:	89 e5                	mov    %esp,%ebp
+  801d17:	56                   	push   %esi
+  801d18:	53                   	push   %ebx
+  801d19:	83 ec 18             	sub    $0x18,%esp
+  801d1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d22:	50                   	push   %eax
+  801d23:	53                   	push   %ebx
+  801d24:	e8 77 fc ff ff       	call   8019a0 <fd_lookup>
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 37                	js     801d67 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d30:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d33:	83 ec 08             	sub    $0x8,%esp
+  801d36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d39:	50                   	push   %eax
+  801d3a:	ff 36                	push   (%esi)
+  801d3c:	e8 af fc ff ff       	call   8019f0 <dev_lookup>
+  801d41:	83 c4 10             	add    $0x10,%esp
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	78 1f                	js     801d67 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d48:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d4c:	74 20                	je     801d6e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d51:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	74 57                	je     801daf <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d58:	83 ec 04             	sub    $0x4,%esp
+  801d5b:	ff 75 10             	push   0x10(%ebp)
+  801d5e:	ff 75 0c             	push   0xc(%ebp)
+  801d61:	56                   	push   %esi
+  801d62:	ff d0                	call   *%eax
+  801d64:	83 c4 10             	add    $0x10,%esp
+}
+  801d67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d6a:	5b                   	pop    %ebx
+  801d6b:	5e                   	pop    %esi
+  801d6c:	5d                   	pop    %ebp
+  801d6d:	c3                   	ret
+  801d6e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d70:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d75:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d7b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d80:	76 1c                	jbe    801d9e <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d82:	8b 42 48             	mov    0x48(%edx),%eax
+  801d85:	83 ec 04             	sub    $0x4,%esp
+  801d88:	53                   	push   %ebx
+  801d89:	50                   	push   %eax
+  801d8a:	68 75 31 80 00       	push   $0x803175
+  801d8f:	e8 d9 e5 ff ff       	call   80036d <cprintf>
+		return -E_INVAL;
+  801d94:	83 c4 10             	add    $0x10,%esp
+  801d97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d9c:	eb c9                	jmp    801d67 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d9e:	c1 e8 10             	shr    $0x10,%eax
+  801da1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801da7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801dad:	eb d3                	jmp    801d82 <write+0x6e>
+		return -E_NOT_SUPP;
+  801daf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801db4:	eb b1                	jmp    801d67 <write+0x53>
+
+00801db6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801db6:	55                   	push   %ebp
+  801db7:	89 e5                	mov    %esp,%ebp
+  801db9:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dbf:	50                   	push   %eax
+  801dc0:	ff 75 08             	push   0x8(%ebp)
+  801dc3:	e8 d8 fb ff ff       	call   8019a0 <fd_lookup>
+  801dc8:	83 c4 10             	add    $0x10,%esp
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	78 0e                	js     801ddd <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801dcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dd5:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ddd:	c9                   	leave
+  801dde:	c3                   	ret
+
+00801ddf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ddf:	55                   	push   %ebp
+  801de0:	89 e5                	mov    %esp,%ebp
+  801de2:	56                   	push   %esi
+  801de3:	53                   	push   %ebx
+  801de4:	83 ec 18             	sub    $0x18,%esp
+  801de7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ded:	50                   	push   %eax
+  801dee:	53                   	push   %ebx
+  801def:	e8 ac fb ff ff       	call   8019a0 <fd_lookup>
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	78 34                	js     801e2f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dfb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dfe:	83 ec 08             	sub    $0x8,%esp
+  801e01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e04:	50                   	push   %eax
+  801e05:	ff 36                	push   (%esi)
+  801e07:	e8 e4 fb ff ff       	call   8019f0 <dev_lookup>
+  801e0c:	83 c4 10             	add    $0x10,%esp
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	78 1c                	js     801e2f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e13:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e17:	74 1d                	je     801e36 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e1c:	8b 40 18             	mov    0x18(%eax),%eax
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	74 54                	je     801e77 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e23:	83 ec 08             	sub    $0x8,%esp
+  801e26:	ff 75 0c             	push   0xc(%ebp)
+  801e29:	56                   	push   %esi
+  801e2a:	ff d0                	call   *%eax
+  801e2c:	83 c4 10             	add    $0x10,%esp
+}
+  801e2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e32:	5b                   	pop    %ebx
+  801e33:	5e                   	pop    %esi
+  801e34:	5d                   	pop    %ebp
+  801e35:	c3                   	ret
+  801e36:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e38:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e3d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e43:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e48:	76 1c                	jbe    801e66 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801e4a:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e4d:	83 ec 04             	sub    $0x4,%esp
+  801e50:	53                   	push   %ebx
+  801e51:	50                   	push   %eax
+  801e52:	68 38 31 80 00       	push   $0x803138
+  801e57:	e8 11 e5 ff ff       	call   80036d <cprintf>
+		return -E_INVAL;
+  801e5c:	83 c4 10             	add    $0x10,%esp
+  801e5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e64:	eb c9                	jmp    801e2f <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e66:	c1 e8 10             	shr    $0x10,%eax
+  801e69:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e6f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e75:	eb d3                	jmp    801e4a <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801e77:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e7c:	eb b1                	jmp    801e2f <ftruncate+0x50>
+
+00801e7e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e7e:	55                   	push   %ebp
+  801e7f:	89 e5                	mov    %esp,%ebp
+  801e81:	56                   	push   %esi
+  801e82:	53                   	push   %ebx
+  801e83:	83 ec 18             	sub    $0x18,%esp
+  801e86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e89:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e8c:	50                   	push   %eax
+  801e8d:	ff 75 08             	push   0x8(%ebp)
+  801e90:	e8 0b fb ff ff       	call   8019a0 <fd_lookup>
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 49                	js     801ee5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e9c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e9f:	83 ec 08             	sub    $0x8,%esp
+  801ea2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ea5:	50                   	push   %eax
+  801ea6:	ff 36                	push   (%esi)
+  801ea8:	e8 43 fb ff ff       	call   8019f0 <dev_lookup>
+  801ead:	83 c4 10             	add    $0x10,%esp
+  801eb0:	85 c0                	test   %eax,%eax
+  801eb2:	78 31                	js     801ee5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801eb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ebb:	74 2f                	je     801eec <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ebd:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801ec0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ec7:	00 00 00 
+	stat->st_isdir = 0;
+  801eca:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ed1:	00 00 00 
+	stat->st_dev = dev;
+  801ed4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801eda:	83 ec 08             	sub    $0x8,%esp
+  801edd:	53                   	push   %ebx
+  801ede:	56                   	push   %esi
+  801edf:	ff 50 14             	call   *0x14(%eax)
+  801ee2:	83 c4 10             	add    $0x10,%esp
+}
+  801ee5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee8:	5b                   	pop    %ebx
+  801ee9:	5e                   	pop    %esi
+  801eea:	5d                   	pop    %ebp
+  801eeb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801eec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ef1:	eb f2                	jmp    801ee5 <fstat+0x67>
+
+00801ef3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	56                   	push   %esi
+  801ef7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801ef8:	83 ec 08             	sub    $0x8,%esp
+  801efb:	6a 00                	push   $0x0
+  801efd:	ff 75 08             	push   0x8(%ebp)
+  801f00:	e8 e4 01 00 00       	call   8020e9 <open>
+  801f05:	89 c3                	mov    %eax,%ebx
+  801f07:	83 c4 10             	add    $0x10,%esp
+  801f0a:	85 c0                	test   %eax,%eax
+  801f0c:	78 1b                	js     801f29 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f0e:	83 ec 08             	sub    $0x8,%esp
+  801f11:	ff 75 0c             	push   0xc(%ebp)
+  801f14:	50                   	push   %eax
+  801f15:	e8 64 ff ff ff       	call   801e7e <fstat>
+  801f1a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f1c:	89 1c 24             	mov    %ebx,(%esp)
+  801f1f:	e8 c6 fb ff ff       	call   801aea <close>
+	return r;
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	89 f3                	mov    %esi,%ebx
+}
+  801f29:	89 d8                	mov    %ebx,%eax
+  801f2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2e:	5b                   	pop    %ebx
+  801f2f:	5e                   	pop    %esi
+  801f30:	5d                   	pop    %ebp
+  801f31:	c3                   	ret
+
+00801f32 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f32:	55                   	push   %ebp
+  801f33:	89 e5                	mov    %esp,%ebp
+  801f35:	56                   	push   %esi
+  801f36:	53                   	push   %ebx
+  801f37:	89 c6                	mov    %eax,%esi
+  801f39:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801f3b:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801f42:	74 27                	je     801f6b <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f44:	6a 07                	push   $0x7
+  801f46:	68 00 60 80 00       	push   $0x806000
+  801f4b:	56                   	push   %esi
+  801f4c:	ff 35 00 50 80 00    	push   0x805000
+  801f52:	e8 b2 0c 00 00       	call   802c09 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801f57:	83 c4 0c             	add    $0xc,%esp
+  801f5a:	6a 00                	push   $0x0
+  801f5c:	53                   	push   %ebx
+  801f5d:	6a 00                	push   $0x0
+  801f5f:	e8 8d 0c 00 00       	call   802bf1 <ipc_recv>
+}
+  801f64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f67:	5b                   	pop    %ebx
+  801f68:	5e                   	pop    %esi
+  801f69:	5d                   	pop    %ebp
+  801f6a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f6b:	83 ec 0c             	sub    $0xc,%esp
+  801f6e:	6a 01                	push   $0x1
+  801f70:	e8 e8 0c 00 00       	call   802c5d <ipc_find_env>
+  801f75:	a3 00 50 80 00       	mov    %eax,0x805000
+  801f7a:	83 c4 10             	add    $0x10,%esp
+  801f7d:	eb c5                	jmp    801f44 <fsipc+0x12>
+
+00801f7f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f88:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f8b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801f90:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f93:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fa2:	e8 8b ff ff ff       	call   801f32 <fsipc>
+}
+  801fa7:	c9                   	leave
+  801fa8:	c3                   	ret
+
+00801fa9 <devfile_flush>:
+{
+  801fa9:	55                   	push   %ebp
+  801faa:	89 e5                	mov    %esp,%ebp
+  801fac:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801faf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fb5:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801fba:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbf:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fc4:	e8 69 ff ff ff       	call   801f32 <fsipc>
+}
+  801fc9:	c9                   	leave
+  801fca:	c3                   	ret
+
+00801fcb <devfile_stat>:
+{
+  801fcb:	55                   	push   %ebp
+  801fcc:	89 e5                	mov    %esp,%ebp
+  801fce:	53                   	push   %ebx
+  801fcf:	83 ec 04             	sub    $0x4,%esp
+  801fd2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fdb:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801fe0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fea:	e8 43 ff ff ff       	call   801f32 <fsipc>
+  801fef:	85 c0                	test   %eax,%eax
+  801ff1:	78 2c                	js     80201f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ff3:	83 ec 08             	sub    $0x8,%esp
+  801ff6:	68 00 60 80 00       	push   $0x806000
+  801ffb:	53                   	push   %ebx
+  801ffc:	e8 b4 e9 ff ff       	call   8009b5 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802001:	a1 80 60 80 00       	mov    0x806080,%eax
+  802006:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80200c:	a1 84 60 80 00       	mov    0x806084,%eax
+  802011:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802017:	83 c4 10             	add    $0x10,%esp
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80201f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802022:	c9                   	leave
+  802023:	c3                   	ret
+
+00802024 <devfile_write>:
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	83 ec 0c             	sub    $0xc,%esp
+  80202a:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80202d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802030:	8b 52 0c             	mov    0xc(%edx),%edx
+  802033:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802039:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80203e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802043:	39 d0                	cmp    %edx,%eax
+  802045:	0f 47 c2             	cmova  %edx,%eax
+  802048:	50                   	push   %eax
+  802049:	ff 75 0c             	push   0xc(%ebp)
+  80204c:	68 08 60 80 00       	push   $0x806008
+  802051:	e8 e5 ea ff ff       	call   800b3b <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802056:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802060:	e8 cd fe ff ff       	call   801f32 <fsipc>
+}
+  802065:	c9                   	leave
+  802066:	c3                   	ret
+
+00802067 <devfile_read>:
+{
+  802067:	55                   	push   %ebp
+  802068:	89 e5                	mov    %esp,%ebp
+  80206a:	56                   	push   %esi
+  80206b:	53                   	push   %ebx
+  80206c:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80206f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802072:	8b 40 0c             	mov    0xc(%eax),%eax
+  802075:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80207a:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802080:	ba 00 00 00 00       	mov    $0x0,%edx
+  802085:	b8 03 00 00 00       	mov    $0x3,%eax
+  80208a:	e8 a3 fe ff ff       	call   801f32 <fsipc>
+  80208f:	89 c3                	mov    %eax,%ebx
+  802091:	85 c0                	test   %eax,%eax
+  802093:	78 1f                	js     8020b4 <devfile_read+0x4d>
+	assert(r <= n);
+  802095:	39 c6                	cmp    %eax,%esi
+  802097:	72 24                	jb     8020bd <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802099:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80209e:	7f 33                	jg     8020d3 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8020a0:	83 ec 04             	sub    $0x4,%esp
+  8020a3:	50                   	push   %eax
+  8020a4:	68 00 60 80 00       	push   $0x806000
+  8020a9:	ff 75 0c             	push   0xc(%ebp)
+  8020ac:	e8 8a ea ff ff       	call   800b3b <memmove>
+	return r;
+  8020b1:	83 c4 10             	add    $0x10,%esp
+}
+  8020b4:	89 d8                	mov    %ebx,%eax
+  8020b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b9:	5b                   	pop    %ebx
+  8020ba:	5e                   	pop    %esi
+  8020bb:	5d                   	pop    %ebp
+  8020bc:	c3                   	ret
+	assert(r <= n);
+  8020bd:	68 a8 31 80 00       	push   $0x8031a8
+  8020c2:	68 af 31 80 00       	push   $0x8031af
+  8020c7:	6a 76                	push   $0x76
+  8020c9:	68 c4 31 80 00       	push   $0x8031c4
+  8020ce:	e8 bf e1 ff ff       	call   800292 <_panic>
+	assert(r <= PGSIZE);
+  8020d3:	68 cf 31 80 00       	push   $0x8031cf
+  8020d8:	68 af 31 80 00       	push   $0x8031af
+  8020dd:	6a 77                	push   $0x77
+  8020df:	68 c4 31 80 00       	push   $0x8031c4
+  8020e4:	e8 a9 e1 ff ff       	call   800292 <_panic>
+
+008020e9 <open>:
+{
+  8020e9:	55                   	push   %ebp
+  8020ea:	89 e5                	mov    %esp,%ebp
+  8020ec:	56                   	push   %esi
+  8020ed:	53                   	push   %ebx
+  8020ee:	83 ec 1c             	sub    $0x1c,%esp
+  8020f1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8020f4:	56                   	push   %esi
+  8020f5:	e8 80 e8 ff ff       	call   80097a <strlen>
+  8020fa:	83 c4 10             	add    $0x10,%esp
+  8020fd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802102:	7f 6c                	jg     802170 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802104:	83 ec 0c             	sub    $0xc,%esp
+  802107:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80210a:	50                   	push   %eax
+  80210b:	e8 3a f8 ff ff       	call   80194a <fd_alloc>
+  802110:	89 c3                	mov    %eax,%ebx
+  802112:	83 c4 10             	add    $0x10,%esp
+  802115:	85 c0                	test   %eax,%eax
+  802117:	78 3c                	js     802155 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802119:	83 ec 08             	sub    $0x8,%esp
+  80211c:	56                   	push   %esi
+  80211d:	68 00 60 80 00       	push   $0x806000
+  802122:	e8 8e e8 ff ff       	call   8009b5 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802127:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80212a:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80212f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802132:	b8 01 00 00 00       	mov    $0x1,%eax
+  802137:	e8 f6 fd ff ff       	call   801f32 <fsipc>
+  80213c:	89 c3                	mov    %eax,%ebx
+  80213e:	83 c4 10             	add    $0x10,%esp
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 19                	js     80215e <open+0x75>
+	return fd2num(fd);
+  802145:	83 ec 0c             	sub    $0xc,%esp
+  802148:	ff 75 f4             	push   -0xc(%ebp)
+  80214b:	e8 d3 f7 ff ff       	call   801923 <fd2num>
+  802150:	89 c3                	mov    %eax,%ebx
+  802152:	83 c4 10             	add    $0x10,%esp
+}
+  802155:	89 d8                	mov    %ebx,%eax
+  802157:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80215a:	5b                   	pop    %ebx
+  80215b:	5e                   	pop    %esi
+  80215c:	5d                   	pop    %ebp
+  80215d:	c3                   	ret
+		fd_close(fd, 0);
+  80215e:	83 ec 08             	sub    $0x8,%esp
+  802161:	6a 00                	push   $0x0
+  802163:	ff 75 f4             	push   -0xc(%ebp)
+  802166:	e8 f8 f8 ff ff       	call   801a63 <fd_close>
+		return r;
+  80216b:	83 c4 10             	add    $0x10,%esp
+  80216e:	eb e5                	jmp    802155 <open+0x6c>
+		return -E_BAD_PATH;
+  802170:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802175:	eb de                	jmp    802155 <open+0x6c>
+
+00802177 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802177:	55                   	push   %ebp
+  802178:	89 e5                	mov    %esp,%ebp
+  80217a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80217d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802182:	b8 08 00 00 00       	mov    $0x8,%eax
+  802187:	e8 a6 fd ff ff       	call   801f32 <fsipc>
+}
+  80218c:	c9                   	leave
+  80218d:	c3                   	ret
+
+0080218e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80218e:	55                   	push   %ebp
+  80218f:	89 e5                	mov    %esp,%ebp
+  802191:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802194:	68 db 31 80 00       	push   $0x8031db
+  802199:	ff 75 0c             	push   0xc(%ebp)
+  80219c:	e8 14 e8 ff ff       	call   8009b5 <strcpy>
+	return 0;
+}
+  8021a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a6:	c9                   	leave
+  8021a7:	c3                   	ret
+
+008021a8 <devsock_close>:
+{
+  8021a8:	55                   	push   %ebp
+  8021a9:	89 e5                	mov    %esp,%ebp
+  8021ab:	53                   	push   %ebx
+  8021ac:	83 ec 10             	sub    $0x10,%esp
+  8021af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8021b2:	53                   	push   %ebx
+  8021b3:	e8 e4 0a 00 00       	call   802c9c <pageref>
+  8021b8:	89 c2                	mov    %eax,%edx
+  8021ba:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8021bd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8021c2:	83 fa 01             	cmp    $0x1,%edx
+  8021c5:	74 05                	je     8021cc <devsock_close+0x24>
+}
+  8021c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8021cc:	83 ec 0c             	sub    $0xc,%esp
+  8021cf:	ff 73 0c             	push   0xc(%ebx)
+  8021d2:	e8 b7 02 00 00       	call   80248e <nsipc_close>
+  8021d7:	83 c4 10             	add    $0x10,%esp
+  8021da:	eb eb                	jmp    8021c7 <devsock_close+0x1f>
+
+008021dc <devsock_write>:
+{
+  8021dc:	55                   	push   %ebp
+  8021dd:	89 e5                	mov    %esp,%ebp
+  8021df:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8021e2:	6a 00                	push   $0x0
+  8021e4:	ff 75 10             	push   0x10(%ebp)
+  8021e7:	ff 75 0c             	push   0xc(%ebp)
+  8021ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ed:	ff 70 0c             	push   0xc(%eax)
+  8021f0:	e8 79 03 00 00       	call   80256e <nsipc_send>
+}
+  8021f5:	c9                   	leave
+  8021f6:	c3                   	ret
+
+008021f7 <devsock_read>:
+{
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8021fd:	6a 00                	push   $0x0
+  8021ff:	ff 75 10             	push   0x10(%ebp)
+  802202:	ff 75 0c             	push   0xc(%ebp)
+  802205:	8b 45 08             	mov    0x8(%ebp),%eax
+  802208:	ff 70 0c             	push   0xc(%eax)
+  80220b:	e8 ef 02 00 00       	call   8024ff <nsipc_recv>
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+
+00802212 <fd2sockid>:
+{
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802218:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80221b:	52                   	push   %edx
+  80221c:	50                   	push   %eax
+  80221d:	e8 7e f7 ff ff       	call   8019a0 <fd_lookup>
+  802222:	83 c4 10             	add    $0x10,%esp
+  802225:	85 c0                	test   %eax,%eax
+  802227:	78 10                	js     802239 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802229:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80222c:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802232:	39 08                	cmp    %ecx,(%eax)
+  802234:	75 05                	jne    80223b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802236:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802239:	c9                   	leave
+  80223a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80223b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802240:	eb f7                	jmp    802239 <fd2sockid+0x27>
+
+00802242 <alloc_sockfd>:
+{
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	56                   	push   %esi
+  802246:	53                   	push   %ebx
+  802247:	83 ec 1c             	sub    $0x1c,%esp
+  80224a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80224c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224f:	50                   	push   %eax
+  802250:	e8 f5 f6 ff ff       	call   80194a <fd_alloc>
+  802255:	89 c3                	mov    %eax,%ebx
+  802257:	83 c4 10             	add    $0x10,%esp
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	78 43                	js     8022a1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80225e:	83 ec 04             	sub    $0x4,%esp
+  802261:	68 07 04 00 00       	push   $0x407
+  802266:	ff 75 f4             	push   -0xc(%ebp)
+  802269:	6a 00                	push   $0x0
+  80226b:	e8 3d ec ff ff       	call   800ead <sys_page_alloc>
+  802270:	89 c3                	mov    %eax,%ebx
+  802272:	83 c4 10             	add    $0x10,%esp
+  802275:	85 c0                	test   %eax,%eax
+  802277:	78 28                	js     8022a1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802279:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80227c:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802282:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802284:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802287:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80228e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802291:	83 ec 0c             	sub    $0xc,%esp
+  802294:	50                   	push   %eax
+  802295:	e8 89 f6 ff ff       	call   801923 <fd2num>
+  80229a:	89 c3                	mov    %eax,%ebx
+  80229c:	83 c4 10             	add    $0x10,%esp
+  80229f:	eb 0c                	jmp    8022ad <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8022a1:	83 ec 0c             	sub    $0xc,%esp
+  8022a4:	56                   	push   %esi
+  8022a5:	e8 e4 01 00 00       	call   80248e <nsipc_close>
+		return r;
+  8022aa:	83 c4 10             	add    $0x10,%esp
+}
+  8022ad:	89 d8                	mov    %ebx,%eax
+  8022af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022b2:	5b                   	pop    %ebx
+  8022b3:	5e                   	pop    %esi
+  8022b4:	5d                   	pop    %ebp
+  8022b5:	c3                   	ret
+
+008022b6 <accept>:
+{
+  8022b6:	55                   	push   %ebp
+  8022b7:	89 e5                	mov    %esp,%ebp
+  8022b9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022bf:	e8 4e ff ff ff       	call   802212 <fd2sockid>
+  8022c4:	85 c0                	test   %eax,%eax
+  8022c6:	78 1b                	js     8022e3 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8022c8:	83 ec 04             	sub    $0x4,%esp
+  8022cb:	ff 75 10             	push   0x10(%ebp)
+  8022ce:	ff 75 0c             	push   0xc(%ebp)
+  8022d1:	50                   	push   %eax
+  8022d2:	e8 0e 01 00 00       	call   8023e5 <nsipc_accept>
+  8022d7:	83 c4 10             	add    $0x10,%esp
+  8022da:	85 c0                	test   %eax,%eax
+  8022dc:	78 05                	js     8022e3 <accept+0x2d>
+	return alloc_sockfd(r);
+  8022de:	e8 5f ff ff ff       	call   802242 <alloc_sockfd>
+}
+  8022e3:	c9                   	leave
+  8022e4:	c3                   	ret
+
+008022e5 <bind>:
+{
+  8022e5:	55                   	push   %ebp
+  8022e6:	89 e5                	mov    %esp,%ebp
+  8022e8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ee:	e8 1f ff ff ff       	call   802212 <fd2sockid>
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	78 12                	js     802309 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8022f7:	83 ec 04             	sub    $0x4,%esp
+  8022fa:	ff 75 10             	push   0x10(%ebp)
+  8022fd:	ff 75 0c             	push   0xc(%ebp)
+  802300:	50                   	push   %eax
+  802301:	e8 31 01 00 00       	call   802437 <nsipc_bind>
+  802306:	83 c4 10             	add    $0x10,%esp
+}
+  802309:	c9                   	leave
+  80230a:	c3                   	ret
+
+0080230b <shutdown>:
+{
+  80230b:	55                   	push   %ebp
+  80230c:	89 e5                	mov    %esp,%ebp
+  80230e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802311:	8b 45 08             	mov    0x8(%ebp),%eax
+  802314:	e8 f9 fe ff ff       	call   802212 <fd2sockid>
+  802319:	85 c0                	test   %eax,%eax
+  80231b:	78 0f                	js     80232c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80231d:	83 ec 08             	sub    $0x8,%esp
+  802320:	ff 75 0c             	push   0xc(%ebp)
+  802323:	50                   	push   %eax
+  802324:	e8 43 01 00 00       	call   80246c <nsipc_shutdown>
+  802329:	83 c4 10             	add    $0x10,%esp
+}
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+
+0080232e <connect>:
+{
+  80232e:	55                   	push   %ebp
+  80232f:	89 e5                	mov    %esp,%ebp
+  802331:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802334:	8b 45 08             	mov    0x8(%ebp),%eax
+  802337:	e8 d6 fe ff ff       	call   802212 <fd2sockid>
+  80233c:	85 c0                	test   %eax,%eax
+  80233e:	78 12                	js     802352 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802340:	83 ec 04             	sub    $0x4,%esp
+  802343:	ff 75 10             	push   0x10(%ebp)
+  802346:	ff 75 0c             	push   0xc(%ebp)
+  802349:	50                   	push   %eax
+  80234a:	e8 59 01 00 00       	call   8024a8 <nsipc_connect>
+  80234f:	83 c4 10             	add    $0x10,%esp
+}
+  802352:	c9                   	leave
+  802353:	c3                   	ret
+
+00802354 <listen>:
+{
+  802354:	55                   	push   %ebp
+  802355:	89 e5                	mov    %esp,%ebp
+  802357:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80235a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235d:	e8 b0 fe ff ff       	call   802212 <fd2sockid>
+  802362:	85 c0                	test   %eax,%eax
+  802364:	78 0f                	js     802375 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802366:	83 ec 08             	sub    $0x8,%esp
+  802369:	ff 75 0c             	push   0xc(%ebp)
+  80236c:	50                   	push   %eax
+  80236d:	e8 6b 01 00 00       	call   8024dd <nsipc_listen>
+  802372:	83 c4 10             	add    $0x10,%esp
+}
+  802375:	c9                   	leave
+  802376:	c3                   	ret
+
+00802377 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80237d:	ff 75 10             	push   0x10(%ebp)
+  802380:	ff 75 0c             	push   0xc(%ebp)
+  802383:	ff 75 08             	push   0x8(%ebp)
+  802386:	e8 41 02 00 00       	call   8025cc <nsipc_socket>
+  80238b:	83 c4 10             	add    $0x10,%esp
+  80238e:	85 c0                	test   %eax,%eax
+  802390:	78 05                	js     802397 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802392:	e8 ab fe ff ff       	call   802242 <alloc_sockfd>
+}
+  802397:	c9                   	leave
+  802398:	c3                   	ret
+
+00802399 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802399:	55                   	push   %ebp
+  80239a:	89 e5                	mov    %esp,%ebp
+  80239c:	53                   	push   %ebx
+  80239d:	83 ec 04             	sub    $0x4,%esp
+  8023a0:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8023a2:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8023a9:	74 26                	je     8023d1 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8023ab:	6a 07                	push   $0x7
+  8023ad:	68 00 70 80 00       	push   $0x807000
+  8023b2:	53                   	push   %ebx
+  8023b3:	ff 35 04 50 80 00    	push   0x805004
+  8023b9:	e8 4b 08 00 00       	call   802c09 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8023be:	83 c4 0c             	add    $0xc,%esp
+  8023c1:	6a 00                	push   $0x0
+  8023c3:	6a 00                	push   $0x0
+  8023c5:	6a 00                	push   $0x0
+  8023c7:	e8 25 08 00 00       	call   802bf1 <ipc_recv>
+}
+  8023cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8023d1:	83 ec 0c             	sub    $0xc,%esp
+  8023d4:	6a 02                	push   $0x2
+  8023d6:	e8 82 08 00 00       	call   802c5d <ipc_find_env>
+  8023db:	a3 04 50 80 00       	mov    %eax,0x805004
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	eb c6                	jmp    8023ab <nsipc+0x12>
+
+008023e5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8023e5:	55                   	push   %ebp
+  8023e6:	89 e5                	mov    %esp,%ebp
+  8023e8:	56                   	push   %esi
+  8023e9:	53                   	push   %ebx
+  8023ea:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8023ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8023f5:	8b 06                	mov    (%esi),%eax
+  8023f7:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8023fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802401:	e8 93 ff ff ff       	call   802399 <nsipc>
+  802406:	89 c3                	mov    %eax,%ebx
+  802408:	85 c0                	test   %eax,%eax
+  80240a:	79 09                	jns    802415 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80240c:	89 d8                	mov    %ebx,%eax
+  80240e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802411:	5b                   	pop    %ebx
+  802412:	5e                   	pop    %esi
+  802413:	5d                   	pop    %ebp
+  802414:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802415:	83 ec 04             	sub    $0x4,%esp
+  802418:	ff 35 10 70 80 00    	push   0x807010
+  80241e:	68 00 70 80 00       	push   $0x807000
+  802423:	ff 75 0c             	push   0xc(%ebp)
+  802426:	e8 10 e7 ff ff       	call   800b3b <memmove>
+		*addrlen = ret->ret_addrlen;
+  80242b:	a1 10 70 80 00       	mov    0x807010,%eax
+  802430:	89 06                	mov    %eax,(%esi)
+  802432:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802435:	eb d5                	jmp    80240c <nsipc_accept+0x27>
+
+00802437 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802437:	55                   	push   %ebp
+  802438:	89 e5                	mov    %esp,%ebp
+  80243a:	53                   	push   %ebx
+  80243b:	83 ec 08             	sub    $0x8,%esp
+  80243e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802441:	8b 45 08             	mov    0x8(%ebp),%eax
+  802444:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802449:	53                   	push   %ebx
+  80244a:	ff 75 0c             	push   0xc(%ebp)
+  80244d:	68 04 70 80 00       	push   $0x807004
+  802452:	e8 e4 e6 ff ff       	call   800b3b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802457:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80245d:	b8 02 00 00 00       	mov    $0x2,%eax
+  802462:	e8 32 ff ff ff       	call   802399 <nsipc>
+}
+  802467:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80246a:	c9                   	leave
+  80246b:	c3                   	ret
+
+0080246c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80246c:	55                   	push   %ebp
+  80246d:	89 e5                	mov    %esp,%ebp
+  80246f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802472:	8b 45 08             	mov    0x8(%ebp),%eax
+  802475:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80247a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80247d:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802482:	b8 03 00 00 00       	mov    $0x3,%eax
+  802487:	e8 0d ff ff ff       	call   802399 <nsipc>
+}
+  80248c:	c9                   	leave
+  80248d:	c3                   	ret
+
+0080248e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802494:	8b 45 08             	mov    0x8(%ebp),%eax
+  802497:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80249c:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024a1:	e8 f3 fe ff ff       	call   802399 <nsipc>
+}
+  8024a6:	c9                   	leave
+  8024a7:	c3                   	ret
+
+008024a8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8024a8:	55                   	push   %ebp
+  8024a9:	89 e5                	mov    %esp,%ebp
+  8024ab:	53                   	push   %ebx
+  8024ac:	83 ec 08             	sub    $0x8,%esp
+  8024af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8024b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b5:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8024ba:	53                   	push   %ebx
+  8024bb:	ff 75 0c             	push   0xc(%ebp)
+  8024be:	68 04 70 80 00       	push   $0x807004
+  8024c3:	e8 73 e6 ff ff       	call   800b3b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8024c8:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8024ce:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024d3:	e8 c1 fe ff ff       	call   802399 <nsipc>
+}
+  8024d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024db:	c9                   	leave
+  8024dc:	c3                   	ret
+
+008024dd <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8024dd:	55                   	push   %ebp
+  8024de:	89 e5                	mov    %esp,%ebp
+  8024e0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8024e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8024eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ee:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8024f3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8024f8:	e8 9c fe ff ff       	call   802399 <nsipc>
+}
+  8024fd:	c9                   	leave
+  8024fe:	c3                   	ret
+
+008024ff <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8024ff:	55                   	push   %ebp
+  802500:	89 e5                	mov    %esp,%ebp
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802507:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80250f:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802515:	8b 45 14             	mov    0x14(%ebp),%eax
+  802518:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80251d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802522:	e8 72 fe ff ff       	call   802399 <nsipc>
+  802527:	89 c3                	mov    %eax,%ebx
+  802529:	85 c0                	test   %eax,%eax
+  80252b:	78 22                	js     80254f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80252d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802532:	39 c6                	cmp    %eax,%esi
+  802534:	0f 4e c6             	cmovle %esi,%eax
+  802537:	39 c3                	cmp    %eax,%ebx
+  802539:	7f 1d                	jg     802558 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80253b:	83 ec 04             	sub    $0x4,%esp
+  80253e:	53                   	push   %ebx
+  80253f:	68 00 70 80 00       	push   $0x807000
+  802544:	ff 75 0c             	push   0xc(%ebp)
+  802547:	e8 ef e5 ff ff       	call   800b3b <memmove>
+  80254c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80254f:	89 d8                	mov    %ebx,%eax
+  802551:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802554:	5b                   	pop    %ebx
+  802555:	5e                   	pop    %esi
+  802556:	5d                   	pop    %ebp
+  802557:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802558:	68 e7 31 80 00       	push   $0x8031e7
+  80255d:	68 af 31 80 00       	push   $0x8031af
+  802562:	6a 62                	push   $0x62
+  802564:	68 fc 31 80 00       	push   $0x8031fc
+  802569:	e8 24 dd ff ff       	call   800292 <_panic>
+
+0080256e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80256e:	55                   	push   %ebp
+  80256f:	89 e5                	mov    %esp,%ebp
+  802571:	53                   	push   %ebx
+  802572:	83 ec 04             	sub    $0x4,%esp
+  802575:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802578:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257b:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802580:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802586:	7f 2e                	jg     8025b6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802588:	83 ec 04             	sub    $0x4,%esp
+  80258b:	53                   	push   %ebx
+  80258c:	ff 75 0c             	push   0xc(%ebp)
+  80258f:	68 0c 70 80 00       	push   $0x80700c
+  802594:	e8 a2 e5 ff ff       	call   800b3b <memmove>
+	nsipcbuf.send.req_size = size;
+  802599:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80259f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025a2:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8025a7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025ac:	e8 e8 fd ff ff       	call   802399 <nsipc>
+}
+  8025b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025b4:	c9                   	leave
+  8025b5:	c3                   	ret
+	assert(size < 1600);
+  8025b6:	68 08 32 80 00       	push   $0x803208
+  8025bb:	68 af 31 80 00       	push   $0x8031af
+  8025c0:	6a 6d                	push   $0x6d
+  8025c2:	68 fc 31 80 00       	push   $0x8031fc
+  8025c7:	e8 c6 dc ff ff       	call   800292 <_panic>
+
+008025cc <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8025cc:	55                   	push   %ebp
+  8025cd:	89 e5                	mov    %esp,%ebp
+  8025cf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8025d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8025da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025dd:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8025e2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025e5:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8025ea:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025ef:	e8 a5 fd ff ff       	call   802399 <nsipc>
+}
+  8025f4:	c9                   	leave
+  8025f5:	c3                   	ret
+
+008025f6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025f6:	55                   	push   %ebp
+  8025f7:	89 e5                	mov    %esp,%ebp
+  8025f9:	56                   	push   %esi
+  8025fa:	53                   	push   %ebx
+  8025fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8025fe:	83 ec 0c             	sub    $0xc,%esp
+  802601:	ff 75 08             	push   0x8(%ebp)
+  802604:	e8 2a f3 ff ff       	call   801933 <fd2data>
+  802609:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80260b:	83 c4 08             	add    $0x8,%esp
+  80260e:	68 14 32 80 00       	push   $0x803214
+  802613:	53                   	push   %ebx
+  802614:	e8 9c e3 ff ff       	call   8009b5 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802619:	8b 46 04             	mov    0x4(%esi),%eax
+  80261c:	2b 06                	sub    (%esi),%eax
+  80261e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802624:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80262b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80262e:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802635:	40 80 00 
+	return 0;
+}
+  802638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802640:	5b                   	pop    %ebx
+  802641:	5e                   	pop    %esi
+  802642:	5d                   	pop    %ebp
+  802643:	c3                   	ret
+
+00802644 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802644:	55                   	push   %ebp
+  802645:	89 e5                	mov    %esp,%ebp
+  802647:	53                   	push   %ebx
+  802648:	83 ec 0c             	sub    $0xc,%esp
+  80264b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80264e:	53                   	push   %ebx
+  80264f:	6a 00                	push   $0x0
+  802651:	e8 32 e9 ff ff       	call   800f88 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802656:	89 1c 24             	mov    %ebx,(%esp)
+  802659:	e8 d5 f2 ff ff       	call   801933 <fd2data>
+  80265e:	83 c4 08             	add    $0x8,%esp
+  802661:	50                   	push   %eax
+  802662:	6a 00                	push   $0x0
+  802664:	e8 1f e9 ff ff       	call   800f88 <sys_page_unmap>
+}
+  802669:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80266c:	c9                   	leave
+  80266d:	c3                   	ret
+
+0080266e <_pipeisclosed>:
+{
+  80266e:	55                   	push   %ebp
+  80266f:	89 e5                	mov    %esp,%ebp
+  802671:	57                   	push   %edi
+  802672:	56                   	push   %esi
+  802673:	53                   	push   %ebx
+  802674:	83 ec 1c             	sub    $0x1c,%esp
+  802677:	89 c7                	mov    %eax,%edi
+  802679:	89 d6                	mov    %edx,%esi
+  80267b:	eb 3c                	jmp    8026b9 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  80267d:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802680:	83 ec 0c             	sub    $0xc,%esp
+  802683:	57                   	push   %edi
+  802684:	e8 13 06 00 00       	call   802c9c <pageref>
+  802689:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80268c:	89 34 24             	mov    %esi,(%esp)
+  80268f:	e8 08 06 00 00       	call   802c9c <pageref>
+  802694:	89 c2                	mov    %eax,%edx
+  802696:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802698:	05 00 00 00 20       	add    $0x20000000,%eax
+  80269d:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8026a0:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026a6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026ab:	76 31                	jbe    8026de <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8026ad:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8026b0:	39 c3                	cmp    %eax,%ebx
+  8026b2:	74 76                	je     80272a <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8026b4:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8026b7:	74 36                	je     8026ef <_pipeisclosed+0x81>
+  8026b9:	89 e0                	mov    %esp,%eax
+  8026bb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026c0:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026c6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026cb:	77 b0                	ja     80267d <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8026cd:	c1 e8 10             	shr    $0x10,%eax
+  8026d0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026d6:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8026dc:	eb 9f                	jmp    80267d <_pipeisclosed+0xf>
+  8026de:	c1 e8 10             	shr    $0x10,%eax
+  8026e1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026e7:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8026ed:	eb be                	jmp    8026ad <_pipeisclosed+0x3f>
+  8026ef:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026f1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026f6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026fc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802701:	76 16                	jbe    802719 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802703:	8b 42 58             	mov    0x58(%edx),%eax
+  802706:	6a 01                	push   $0x1
+  802708:	50                   	push   %eax
+  802709:	53                   	push   %ebx
+  80270a:	68 1b 32 80 00       	push   $0x80321b
+  80270f:	e8 59 dc ff ff       	call   80036d <cprintf>
+  802714:	83 c4 10             	add    $0x10,%esp
+  802717:	eb a0                	jmp    8026b9 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802719:	c1 e8 10             	shr    $0x10,%eax
+  80271c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802722:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802728:	eb d9                	jmp    802703 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80272a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80272d:	0f 94 c0             	sete   %al
+  802730:	0f b6 c0             	movzbl %al,%eax
+}
+  802733:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802736:	5b                   	pop    %ebx
+  802737:	5e                   	pop    %esi
+  802738:	5f                   	pop    %edi
+  802739:	5d                   	pop    %ebp
+  80273a:	c3                   	ret
+
+0080273b <devpipe_write>:
+{
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	57                   	push   %edi
+  80273f:	56                   	push   %esi
+  802740:	53                   	push   %ebx
+  802741:	83 ec 28             	sub    $0x28,%esp
+  802744:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802747:	56                   	push   %esi
+  802748:	e8 e6 f1 ff ff       	call   801933 <fd2data>
+  80274d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80274f:	83 c4 10             	add    $0x10,%esp
+  802752:	bf 00 00 00 00       	mov    $0x0,%edi
+  802757:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80275a:	75 09                	jne    802765 <devpipe_write+0x2a>
+	return i;
+  80275c:	89 f8                	mov    %edi,%eax
+  80275e:	eb 23                	jmp    802783 <devpipe_write+0x48>
+			sys_yield();
+  802760:	e8 02 e7 ff ff       	call   800e67 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802765:	8b 43 04             	mov    0x4(%ebx),%eax
+  802768:	8b 0b                	mov    (%ebx),%ecx
+  80276a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80276d:	39 d0                	cmp    %edx,%eax
+  80276f:	72 1a                	jb     80278b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802771:	89 da                	mov    %ebx,%edx
+  802773:	89 f0                	mov    %esi,%eax
+  802775:	e8 f4 fe ff ff       	call   80266e <_pipeisclosed>
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	74 e2                	je     802760 <devpipe_write+0x25>
+				return 0;
+  80277e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802786:	5b                   	pop    %ebx
+  802787:	5e                   	pop    %esi
+  802788:	5f                   	pop    %edi
+  802789:	5d                   	pop    %ebp
+  80278a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80278b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80278e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802792:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802795:	89 c2                	mov    %eax,%edx
+  802797:	c1 fa 1f             	sar    $0x1f,%edx
+  80279a:	89 d1                	mov    %edx,%ecx
+  80279c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80279f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8027a2:	83 e2 1f             	and    $0x1f,%edx
+  8027a5:	29 ca                	sub    %ecx,%edx
+  8027a7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8027ab:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8027af:	83 c0 01             	add    $0x1,%eax
+  8027b2:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8027b5:	83 c7 01             	add    $0x1,%edi
+  8027b8:	eb 9d                	jmp    802757 <devpipe_write+0x1c>
+
+008027ba <devpipe_read>:
+{
+  8027ba:	55                   	push   %ebp
+  8027bb:	89 e5                	mov    %esp,%ebp
+  8027bd:	57                   	push   %edi
+  8027be:	56                   	push   %esi
+  8027bf:	53                   	push   %ebx
+  8027c0:	83 ec 18             	sub    $0x18,%esp
+  8027c3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8027c6:	57                   	push   %edi
+  8027c7:	e8 67 f1 ff ff       	call   801933 <fd2data>
+  8027cc:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8027ce:	83 c4 10             	add    $0x10,%esp
+  8027d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8027d9:	75 13                	jne    8027ee <devpipe_read+0x34>
+	return i;
+  8027db:	89 f0                	mov    %esi,%eax
+  8027dd:	eb 02                	jmp    8027e1 <devpipe_read+0x27>
+				return i;
+  8027df:	89 f0                	mov    %esi,%eax
+}
+  8027e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027e4:	5b                   	pop    %ebx
+  8027e5:	5e                   	pop    %esi
+  8027e6:	5f                   	pop    %edi
+  8027e7:	5d                   	pop    %ebp
+  8027e8:	c3                   	ret
+			sys_yield();
+  8027e9:	e8 79 e6 ff ff       	call   800e67 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8027ee:	8b 03                	mov    (%ebx),%eax
+  8027f0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027f3:	75 18                	jne    80280d <devpipe_read+0x53>
+			if (i > 0)
+  8027f5:	85 f6                	test   %esi,%esi
+  8027f7:	75 e6                	jne    8027df <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8027f9:	89 da                	mov    %ebx,%edx
+  8027fb:	89 f8                	mov    %edi,%eax
+  8027fd:	e8 6c fe ff ff       	call   80266e <_pipeisclosed>
+  802802:	85 c0                	test   %eax,%eax
+  802804:	74 e3                	je     8027e9 <devpipe_read+0x2f>
+				return 0;
+  802806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280b:	eb d4                	jmp    8027e1 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80280d:	99                   	cltd
+  80280e:	c1 ea 1b             	shr    $0x1b,%edx
+  802811:	01 d0                	add    %edx,%eax
+  802813:	83 e0 1f             	and    $0x1f,%eax
+  802816:	29 d0                	sub    %edx,%eax
+  802818:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80281d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802820:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802823:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802826:	83 c6 01             	add    $0x1,%esi
+  802829:	eb ab                	jmp    8027d6 <devpipe_read+0x1c>
+
+0080282b <pipe>:
+{
+  80282b:	55                   	push   %ebp
+  80282c:	89 e5                	mov    %esp,%ebp
+  80282e:	56                   	push   %esi
+  80282f:	53                   	push   %ebx
+  802830:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802833:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802836:	50                   	push   %eax
+  802837:	e8 0e f1 ff ff       	call   80194a <fd_alloc>
+  80283c:	89 c3                	mov    %eax,%ebx
+  80283e:	83 c4 10             	add    $0x10,%esp
+  802841:	85 c0                	test   %eax,%eax
+  802843:	0f 88 23 01 00 00    	js     80296c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802849:	83 ec 04             	sub    $0x4,%esp
+  80284c:	68 07 04 00 00       	push   $0x407
+  802851:	ff 75 f4             	push   -0xc(%ebp)
+  802854:	6a 00                	push   $0x0
+  802856:	e8 52 e6 ff ff       	call   800ead <sys_page_alloc>
+  80285b:	89 c3                	mov    %eax,%ebx
+  80285d:	83 c4 10             	add    $0x10,%esp
+  802860:	85 c0                	test   %eax,%eax
+  802862:	0f 88 04 01 00 00    	js     80296c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802868:	83 ec 0c             	sub    $0xc,%esp
+  80286b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80286e:	50                   	push   %eax
+  80286f:	e8 d6 f0 ff ff       	call   80194a <fd_alloc>
+  802874:	89 c3                	mov    %eax,%ebx
+  802876:	83 c4 10             	add    $0x10,%esp
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	0f 88 db 00 00 00    	js     80295c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802881:	83 ec 04             	sub    $0x4,%esp
+  802884:	68 07 04 00 00       	push   $0x407
+  802889:	ff 75 f0             	push   -0x10(%ebp)
+  80288c:	6a 00                	push   $0x0
+  80288e:	e8 1a e6 ff ff       	call   800ead <sys_page_alloc>
+  802893:	89 c3                	mov    %eax,%ebx
+  802895:	83 c4 10             	add    $0x10,%esp
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	0f 88 bc 00 00 00    	js     80295c <pipe+0x131>
+	va = fd2data(fd0);
+  8028a0:	83 ec 0c             	sub    $0xc,%esp
+  8028a3:	ff 75 f4             	push   -0xc(%ebp)
+  8028a6:	e8 88 f0 ff ff       	call   801933 <fd2data>
+  8028ab:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028ad:	83 c4 0c             	add    $0xc,%esp
+  8028b0:	68 07 04 00 00       	push   $0x407
+  8028b5:	50                   	push   %eax
+  8028b6:	6a 00                	push   $0x0
+  8028b8:	e8 f0 e5 ff ff       	call   800ead <sys_page_alloc>
+  8028bd:	89 c3                	mov    %eax,%ebx
+  8028bf:	83 c4 10             	add    $0x10,%esp
+  8028c2:	85 c0                	test   %eax,%eax
+  8028c4:	0f 88 82 00 00 00    	js     80294c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028ca:	83 ec 0c             	sub    $0xc,%esp
+  8028cd:	ff 75 f0             	push   -0x10(%ebp)
+  8028d0:	e8 5e f0 ff ff       	call   801933 <fd2data>
+  8028d5:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028dc:	50                   	push   %eax
+  8028dd:	6a 00                	push   $0x0
+  8028df:	56                   	push   %esi
+  8028e0:	6a 00                	push   $0x0
+  8028e2:	e8 33 e6 ff ff       	call   800f1a <sys_page_map>
+  8028e7:	89 c3                	mov    %eax,%ebx
+  8028e9:	83 c4 20             	add    $0x20,%esp
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	78 4e                	js     80293e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8028f0:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8028f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028f8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8028fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028fd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802904:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802907:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802909:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80290c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802913:	83 ec 0c             	sub    $0xc,%esp
+  802916:	ff 75 f4             	push   -0xc(%ebp)
+  802919:	e8 05 f0 ff ff       	call   801923 <fd2num>
+  80291e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802921:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802923:	83 c4 04             	add    $0x4,%esp
+  802926:	ff 75 f0             	push   -0x10(%ebp)
+  802929:	e8 f5 ef ff ff       	call   801923 <fd2num>
+  80292e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802931:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802934:	83 c4 10             	add    $0x10,%esp
+  802937:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80293c:	eb 2e                	jmp    80296c <pipe+0x141>
+	sys_page_unmap(0, va);
+  80293e:	83 ec 08             	sub    $0x8,%esp
+  802941:	56                   	push   %esi
+  802942:	6a 00                	push   $0x0
+  802944:	e8 3f e6 ff ff       	call   800f88 <sys_page_unmap>
+  802949:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80294c:	83 ec 08             	sub    $0x8,%esp
+  80294f:	ff 75 f0             	push   -0x10(%ebp)
+  802952:	6a 00                	push   $0x0
+  802954:	e8 2f e6 ff ff       	call   800f88 <sys_page_unmap>
+  802959:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80295c:	83 ec 08             	sub    $0x8,%esp
+  80295f:	ff 75 f4             	push   -0xc(%ebp)
+  802962:	6a 00                	push   $0x0
+  802964:	e8 1f e6 ff ff       	call   800f88 <sys_page_unmap>
+  802969:	83 c4 10             	add    $0x10,%esp
+}
+  80296c:	89 d8                	mov    %ebx,%eax
+  80296e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802971:	5b                   	pop    %ebx
+  802972:	5e                   	pop    %esi
+  802973:	5d                   	pop    %ebp
+  802974:	c3                   	ret
+
+00802975 <pipeisclosed>:
+{
+  802975:	55                   	push   %ebp
+  802976:	89 e5                	mov    %esp,%ebp
+  802978:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80297b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80297e:	50                   	push   %eax
+  80297f:	ff 75 08             	push   0x8(%ebp)
+  802982:	e8 19 f0 ff ff       	call   8019a0 <fd_lookup>
+  802987:	83 c4 10             	add    $0x10,%esp
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	78 18                	js     8029a6 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80298e:	83 ec 0c             	sub    $0xc,%esp
+  802991:	ff 75 f4             	push   -0xc(%ebp)
+  802994:	e8 9a ef ff ff       	call   801933 <fd2data>
+  802999:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80299b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80299e:	e8 cb fc ff ff       	call   80266e <_pipeisclosed>
+  8029a3:	83 c4 10             	add    $0x10,%esp
+}
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+
+008029a8 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8029a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ad:	c3                   	ret
+
+008029ae <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8029ae:	55                   	push   %ebp
+  8029af:	89 e5                	mov    %esp,%ebp
+  8029b1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8029b4:	68 33 32 80 00       	push   $0x803233
+  8029b9:	ff 75 0c             	push   0xc(%ebp)
+  8029bc:	e8 f4 df ff ff       	call   8009b5 <strcpy>
+	return 0;
+}
+  8029c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+
+008029c8 <devcons_write>:
+{
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	57                   	push   %edi
+  8029cc:	56                   	push   %esi
+  8029cd:	53                   	push   %ebx
+  8029ce:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8029d4:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8029d9:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8029df:	eb 2e                	jmp    802a0f <devcons_write+0x47>
+		m = n - tot;
+  8029e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029e4:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8029e6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8029eb:	39 c3                	cmp    %eax,%ebx
+  8029ed:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8029f0:	83 ec 04             	sub    $0x4,%esp
+  8029f3:	53                   	push   %ebx
+  8029f4:	89 f0                	mov    %esi,%eax
+  8029f6:	03 45 0c             	add    0xc(%ebp),%eax
+  8029f9:	50                   	push   %eax
+  8029fa:	57                   	push   %edi
+  8029fb:	e8 3b e1 ff ff       	call   800b3b <memmove>
+		sys_cputs(buf, m);
+  802a00:	83 c4 08             	add    $0x8,%esp
+  802a03:	53                   	push   %ebx
+  802a04:	57                   	push   %edi
+  802a05:	e8 24 e3 ff ff       	call   800d2e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802a0a:	01 de                	add    %ebx,%esi
+  802a0c:	83 c4 10             	add    $0x10,%esp
+  802a0f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a12:	72 cd                	jb     8029e1 <devcons_write+0x19>
+}
+  802a14:	89 f0                	mov    %esi,%eax
+  802a16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a19:	5b                   	pop    %ebx
+  802a1a:	5e                   	pop    %esi
+  802a1b:	5f                   	pop    %edi
+  802a1c:	5d                   	pop    %ebp
+  802a1d:	c3                   	ret
+
+00802a1e <devcons_read>:
+{
+  802a1e:	55                   	push   %ebp
+  802a1f:	89 e5                	mov    %esp,%ebp
+  802a21:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a29:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a2d:	75 07                	jne    802a36 <devcons_read+0x18>
+  802a2f:	eb 1f                	jmp    802a50 <devcons_read+0x32>
+		sys_yield();
+  802a31:	e8 31 e4 ff ff       	call   800e67 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802a36:	e8 37 e3 ff ff       	call   800d72 <sys_cgetc>
+  802a3b:	85 c0                	test   %eax,%eax
+  802a3d:	74 f2                	je     802a31 <devcons_read+0x13>
+	if (c < 0)
+  802a3f:	78 0f                	js     802a50 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802a41:	83 f8 04             	cmp    $0x4,%eax
+  802a44:	74 0c                	je     802a52 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802a46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a49:	88 02                	mov    %al,(%edx)
+	return 1;
+  802a4b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a50:	c9                   	leave
+  802a51:	c3                   	ret
+		return 0;
+  802a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a57:	eb f7                	jmp    802a50 <devcons_read+0x32>
+
+00802a59 <cputchar>:
+{
+  802a59:	55                   	push   %ebp
+  802a5a:	89 e5                	mov    %esp,%ebp
+  802a5c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802a5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a62:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802a65:	6a 01                	push   $0x1
+  802a67:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a6a:	50                   	push   %eax
+  802a6b:	e8 be e2 ff ff       	call   800d2e <sys_cputs>
+}
+  802a70:	83 c4 10             	add    $0x10,%esp
+  802a73:	c9                   	leave
+  802a74:	c3                   	ret
+
+00802a75 <getchar>:
+{
+  802a75:	55                   	push   %ebp
+  802a76:	89 e5                	mov    %esp,%ebp
+  802a78:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802a7b:	6a 01                	push   $0x1
+  802a7d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a80:	50                   	push   %eax
+  802a81:	6a 00                	push   $0x0
+  802a83:	e8 9e f1 ff ff       	call   801c26 <read>
+	if (r < 0)
+  802a88:	83 c4 10             	add    $0x10,%esp
+  802a8b:	85 c0                	test   %eax,%eax
+  802a8d:	78 06                	js     802a95 <getchar+0x20>
+	if (r < 1)
+  802a8f:	74 06                	je     802a97 <getchar+0x22>
+	return c;
+  802a91:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+		return -E_EOF;
+  802a97:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802a9c:	eb f7                	jmp    802a95 <getchar+0x20>
+
+00802a9e <iscons>:
+{
+  802a9e:	55                   	push   %ebp
+  802a9f:	89 e5                	mov    %esp,%ebp
+  802aa1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802aa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa7:	50                   	push   %eax
+  802aa8:	ff 75 08             	push   0x8(%ebp)
+  802aab:	e8 f0 ee ff ff       	call   8019a0 <fd_lookup>
+  802ab0:	83 c4 10             	add    $0x10,%esp
+  802ab3:	85 c0                	test   %eax,%eax
+  802ab5:	78 11                	js     802ac8 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802ab7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aba:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802ac0:	39 10                	cmp    %edx,(%eax)
+  802ac2:	0f 94 c0             	sete   %al
+  802ac5:	0f b6 c0             	movzbl %al,%eax
+}
+  802ac8:	c9                   	leave
+  802ac9:	c3                   	ret
+
+00802aca <opencons>:
+{
+  802aca:	55                   	push   %ebp
+  802acb:	89 e5                	mov    %esp,%ebp
+  802acd:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802ad0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ad3:	50                   	push   %eax
+  802ad4:	e8 71 ee ff ff       	call   80194a <fd_alloc>
+  802ad9:	83 c4 10             	add    $0x10,%esp
+  802adc:	85 c0                	test   %eax,%eax
+  802ade:	78 3a                	js     802b1a <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ae0:	83 ec 04             	sub    $0x4,%esp
+  802ae3:	68 07 04 00 00       	push   $0x407
+  802ae8:	ff 75 f4             	push   -0xc(%ebp)
+  802aeb:	6a 00                	push   $0x0
+  802aed:	e8 bb e3 ff ff       	call   800ead <sys_page_alloc>
+  802af2:	83 c4 10             	add    $0x10,%esp
+  802af5:	85 c0                	test   %eax,%eax
+  802af7:	78 21                	js     802b1a <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802af9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802afc:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b02:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802b04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b07:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802b0e:	83 ec 0c             	sub    $0xc,%esp
+  802b11:	50                   	push   %eax
+  802b12:	e8 0c ee ff ff       	call   801923 <fd2num>
+  802b17:	83 c4 10             	add    $0x10,%esp
+}
+  802b1a:	c9                   	leave
+  802b1b:	c3                   	ret
+
+00802b1c <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802b1c:	55                   	push   %ebp
+  802b1d:	89 e5                	mov    %esp,%ebp
+  802b1f:	56                   	push   %esi
+  802b20:	53                   	push   %ebx
+  802b21:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b24:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b2a:	85 c0                	test   %eax,%eax
+  802b2c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b31:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802b34:	83 ec 08             	sub    $0x8,%esp
+  802b37:	ff 75 14             	push   0x14(%ebp)
+  802b3a:	50                   	push   %eax
+  802b3b:	e8 7e e7 ff ff       	call   8012be <sys_ipc_recv_until>
+  802b40:	83 c4 10             	add    $0x10,%esp
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	78 61                	js     802ba8 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802b47:	85 f6                	test   %esi,%esi
+  802b49:	74 1c                	je     802b67 <ipc_recv_until+0x4b>
+  802b4b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b4d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b52:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b58:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b5d:	76 5f                	jbe    802bbe <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802b5f:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802b65:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802b67:	85 db                	test   %ebx,%ebx
+  802b69:	74 1c                	je     802b87 <ipc_recv_until+0x6b>
+  802b6b:	89 e0                	mov    %esp,%eax
+  802b6d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b72:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b78:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b7d:	76 50                	jbe    802bcf <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802b7f:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802b85:	89 03                	mov    %eax,(%ebx)
+  802b87:	89 e0                	mov    %esp,%eax
+  802b89:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b8e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b94:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b99:	76 45                	jbe    802be0 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802b9b:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802ba1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ba4:	5b                   	pop    %ebx
+  802ba5:	5e                   	pop    %esi
+  802ba6:	5d                   	pop    %ebp
+  802ba7:	c3                   	ret
+		if (from_env_store)
+  802ba8:	85 f6                	test   %esi,%esi
+  802baa:	74 06                	je     802bb2 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802bac:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802bb2:	85 db                	test   %ebx,%ebx
+  802bb4:	74 eb                	je     802ba1 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802bb6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802bbc:	eb e3                	jmp    802ba1 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802bbe:	c1 e8 10             	shr    $0x10,%eax
+  802bc1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802bc7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802bcd:	eb 90                	jmp    802b5f <ipc_recv_until+0x43>
+  802bcf:	c1 e8 10             	shr    $0x10,%eax
+  802bd2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802bd8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802bde:	eb 9f                	jmp    802b7f <ipc_recv_until+0x63>
+  802be0:	c1 e8 10             	shr    $0x10,%eax
+  802be3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802be9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802bef:	eb aa                	jmp    802b9b <ipc_recv_until+0x7f>
+
+00802bf1 <ipc_recv>:
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+  802bf4:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802bf7:	6a 00                	push   $0x0
+  802bf9:	ff 75 10             	push   0x10(%ebp)
+  802bfc:	ff 75 0c             	push   0xc(%ebp)
+  802bff:	ff 75 08             	push   0x8(%ebp)
+  802c02:	e8 15 ff ff ff       	call   802b1c <ipc_recv_until>
+}
+  802c07:	c9                   	leave
+  802c08:	c3                   	ret
+
+00802c09 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802c09:	55                   	push   %ebp
+  802c0a:	89 e5                	mov    %esp,%ebp
+  802c0c:	57                   	push   %edi
+  802c0d:	56                   	push   %esi
+  802c0e:	53                   	push   %ebx
+  802c0f:	83 ec 0c             	sub    $0xc,%esp
+  802c12:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c15:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802c18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802c1b:	85 db                	test   %ebx,%ebx
+  802c1d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c22:	0f 44 d8             	cmove  %eax,%ebx
+  802c25:	eb 05                	jmp    802c2c <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802c27:	e8 3b e2 ff ff       	call   800e67 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802c2c:	ff 75 14             	push   0x14(%ebp)
+  802c2f:	53                   	push   %ebx
+  802c30:	56                   	push   %esi
+  802c31:	57                   	push   %edi
+  802c32:	e8 d3 e5 ff ff       	call   80120a <sys_ipc_try_send>
+  802c37:	83 c4 10             	add    $0x10,%esp
+  802c3a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802c3d:	74 e8                	je     802c27 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802c3f:	85 c0                	test   %eax,%eax
+  802c41:	78 08                	js     802c4b <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802c43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c46:	5b                   	pop    %ebx
+  802c47:	5e                   	pop    %esi
+  802c48:	5f                   	pop    %edi
+  802c49:	5d                   	pop    %ebp
+  802c4a:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802c4b:	50                   	push   %eax
+  802c4c:	68 3f 32 80 00       	push   $0x80323f
+  802c51:	6a 4f                	push   $0x4f
+  802c53:	68 52 32 80 00       	push   $0x803252
+  802c58:	e8 35 d6 ff ff       	call   800292 <_panic>
+
+00802c5d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c5d:	55                   	push   %ebp
+  802c5e:	89 e5                	mov    %esp,%ebp
+  802c60:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802c63:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802c68:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802c6e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c74:	8b 52 50             	mov    0x50(%edx),%edx
+  802c77:	39 ca                	cmp    %ecx,%edx
+  802c79:	74 11                	je     802c8c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802c7b:	83 c0 01             	add    $0x1,%eax
+  802c7e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802c83:	75 e3                	jne    802c68 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8a:	eb 0e                	jmp    802c9a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802c8c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c92:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c97:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c9a:	5d                   	pop    %ebp
+  802c9b:	c3                   	ret
+
+00802c9c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c9c:	55                   	push   %ebp
+  802c9d:	89 e5                	mov    %esp,%ebp
+  802c9f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802ca2:	89 c2                	mov    %eax,%edx
+  802ca4:	c1 ea 16             	shr    $0x16,%edx
+  802ca7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802cae:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802cb3:	f6 c1 01             	test   $0x1,%cl
+  802cb6:	74 1a                	je     802cd2 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802cb8:	c1 e8 0c             	shr    $0xc,%eax
+  802cbb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802cc2:	a8 01                	test   $0x1,%al
+  802cc4:	74 0c                	je     802cd2 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802cc6:	c1 e8 0c             	shr    $0xc,%eax
+  802cc9:	c1 e0 04             	shl    $0x4,%eax
+  802ccc:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802cd2:	89 d0                	mov    %edx,%eax
+  802cd4:	5d                   	pop    %ebp
+  802cd5:	c3                   	ret
@@ -0,0 +1,6234 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i, nflag;
+
+	nflag = 0;
+  800042:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800049:	83 ff 01             	cmp    $0x1,%edi
+  80004c:	7f 07                	jg     800055 <umain+0x22>
+		nflag = 1;
+		argc--;
+		argv++;
+	}
+	for (i = 1; i < argc; i++) {
+  80004e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800053:	eb 4c                	jmp    8000a1 <umain+0x6e>
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	68 00 2c 80 00       	push   $0x802c00
+  80005d:	ff 76 04             	push   0x4(%esi)
+  800060:	e8 17 09 00 00       	call   80097c <strcmp>
+  800065:	83 c4 10             	add    $0x10,%esp
+	nflag = 0;
+  800068:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	75 db                	jne    80004e <umain+0x1b>
+		argc--;
+  800073:	83 ef 01             	sub    $0x1,%edi
+		argv++;
+  800076:	83 c6 04             	add    $0x4,%esi
+		nflag = 1;
+  800079:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  800080:	eb cc                	jmp    80004e <umain+0x1b>
+		if (i > 1)
+			write(1, " ", 1);
+		write(1, argv[i], strlen(argv[i]));
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	ff 34 9e             	push   (%esi,%ebx,4)
+  800088:	e8 03 08 00 00       	call   800890 <strlen>
+  80008d:	83 c4 0c             	add    $0xc,%esp
+  800090:	50                   	push   %eax
+  800091:	ff 34 9e             	push   (%esi,%ebx,4)
+  800094:	6a 01                	push   $0x1
+  800096:	e8 8f 1b 00 00       	call   801c2a <write>
+	for (i = 1; i < argc; i++) {
+  80009b:	83 c3 01             	add    $0x1,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	39 df                	cmp    %ebx,%edi
+  8000a3:	7e 1b                	jle    8000c0 <umain+0x8d>
+		if (i > 1)
+  8000a5:	83 fb 01             	cmp    $0x1,%ebx
+  8000a8:	7e d8                	jle    800082 <umain+0x4f>
+			write(1, " ", 1);
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	6a 01                	push   $0x1
+  8000af:	68 03 2c 80 00       	push   $0x802c03
+  8000b4:	6a 01                	push   $0x1
+  8000b6:	e8 6f 1b 00 00       	call   801c2a <write>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	eb c2                	jmp    800082 <umain+0x4f>
+	}
+	if (!nflag)
+  8000c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000c4:	74 08                	je     8000ce <umain+0x9b>
+		write(1, "\n", 1);
+}
+  8000c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c9:	5b                   	pop    %ebx
+  8000ca:	5e                   	pop    %esi
+  8000cb:	5f                   	pop    %edi
+  8000cc:	5d                   	pop    %ebp
+  8000cd:	c3                   	ret
+		write(1, "\n", 1);
+  8000ce:	83 ec 04             	sub    $0x4,%esp
+  8000d1:	6a 01                	push   $0x1
+  8000d3:	68 cc 30 80 00       	push   $0x8030cc
+  8000d8:	6a 01                	push   $0x1
+  8000da:	e8 4b 1b 00 00       	call   801c2a <write>
+  8000df:	83 c4 10             	add    $0x10,%esp
+}
+  8000e2:	eb e2                	jmp    8000c6 <umain+0x93>
+
+008000e4 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	57                   	push   %edi
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	83 ec 0c             	sub    $0xc,%esp
+  8000ed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000f0:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000f8:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000fa:	c1 ea 0b             	shr    $0xb,%edx
+  8000fd:	83 f2 01             	xor    $0x1,%edx
+  800100:	83 e2 01             	and    $0x1,%edx
+  800103:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800109:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800110:	00 00 00 
+	envid = sys_getenvid();
+  800113:	e8 1f 0c 00 00       	call   800d37 <sys_getenvid>
+  800118:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80011a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80011f:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800125:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80012b:	8b 52 48             	mov    0x48(%edx),%edx
+  80012e:	39 ca                	cmp    %ecx,%edx
+  800130:	74 27                	je     800159 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800132:	83 c0 01             	add    $0x1,%eax
+  800135:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80013a:	75 e3                	jne    80011f <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80013c:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800143:	75 24                	jne    800169 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800145:	83 ec 04             	sub    $0x4,%esp
+  800148:	68 08 2c 80 00       	push   $0x802c08
+  80014d:	6a 23                	push   $0x23
+  80014f:	68 2b 2c 80 00       	push   $0x802c2b
+  800154:	e8 4f 00 00 00       	call   8001a8 <_panic>
+			mainenv = &envs[i];
+  800159:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80015f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800164:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800169:	85 ff                	test   %edi,%edi
+  80016b:	7e 07                	jle    800174 <libmain+0x90>
+		binaryname = argv[0];
+  80016d:	8b 06                	mov    (%esi),%eax
+  80016f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800174:	83 ec 08             	sub    $0x8,%esp
+  800177:	56                   	push   %esi
+  800178:	57                   	push   %edi
+  800179:	e8 b5 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80017e:	e8 0b 00 00 00       	call   80018e <exit>
+}
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800189:	5b                   	pop    %ebx
+  80018a:	5e                   	pop    %esi
+  80018b:	5f                   	pop    %edi
+  80018c:	5d                   	pop    %ebp
+  80018d:	c3                   	ret
+
+0080018e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80018e:	55                   	push   %ebp
+  80018f:	89 e5                	mov    %esp,%ebp
+  800191:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800194:	e8 94 18 00 00       	call   801a2d <close_all>
+	sys_env_destroy(0);
+  800199:	83 ec 0c             	sub    $0xc,%esp
+  80019c:	6a 00                	push   $0x0
+  80019e:	e8 2b 0b 00 00       	call   800cce <sys_env_destroy>
+}
+  8001a3:	83 c4 10             	add    $0x10,%esp
+  8001a6:	c9                   	leave
+  8001a7:	c3                   	ret
+
+008001a8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001a8:	55                   	push   %ebp
+  8001a9:	89 e5                	mov    %esp,%ebp
+  8001ab:	56                   	push   %esi
+  8001ac:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001ad:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001b0:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001b6:	e8 7c 0b 00 00       	call   800d37 <sys_getenvid>
+  8001bb:	83 ec 0c             	sub    $0xc,%esp
+  8001be:	ff 75 0c             	push   0xc(%ebp)
+  8001c1:	ff 75 08             	push   0x8(%ebp)
+  8001c4:	56                   	push   %esi
+  8001c5:	50                   	push   %eax
+  8001c6:	68 44 2c 80 00       	push   $0x802c44
+  8001cb:	e8 b3 00 00 00       	call   800283 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001d0:	83 c4 18             	add    $0x18,%esp
+  8001d3:	53                   	push   %ebx
+  8001d4:	ff 75 10             	push   0x10(%ebp)
+  8001d7:	e8 56 00 00 00       	call   800232 <vcprintf>
+	cprintf("\n");
+  8001dc:	c7 04 24 cc 30 80 00 	movl   $0x8030cc,(%esp)
+  8001e3:	e8 9b 00 00 00       	call   800283 <cprintf>
+  8001e8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001eb:	cc                   	int3
+	while (1)
+  8001ec:	eb fd                	jmp    8001eb <_panic+0x43>
+
+008001ee <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001ee:	55                   	push   %ebp
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	53                   	push   %ebx
+  8001f2:	83 ec 04             	sub    $0x4,%esp
+  8001f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001f8:	8b 13                	mov    (%ebx),%edx
+  8001fa:	8d 42 01             	lea    0x1(%edx),%eax
+  8001fd:	89 03                	mov    %eax,(%ebx)
+  8001ff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800202:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800206:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80020b:	74 09                	je     800216 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80020d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800211:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800214:	c9                   	leave
+  800215:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800216:	83 ec 08             	sub    $0x8,%esp
+  800219:	68 ff 00 00 00       	push   $0xff
+  80021e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800221:	50                   	push   %eax
+  800222:	e8 1d 0a 00 00       	call   800c44 <sys_cputs>
+		b->idx = 0;
+  800227:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80022d:	83 c4 10             	add    $0x10,%esp
+  800230:	eb db                	jmp    80020d <putch+0x1f>
+
+00800232 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800232:	55                   	push   %ebp
+  800233:	89 e5                	mov    %esp,%ebp
+  800235:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80023b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800242:	00 00 00 
+	b.cnt = 0;
+  800245:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80024c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80024f:	ff 75 0c             	push   0xc(%ebp)
+  800252:	ff 75 08             	push   0x8(%ebp)
+  800255:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80025b:	50                   	push   %eax
+  80025c:	68 ee 01 80 00       	push   $0x8001ee
+  800261:	e8 fb 00 00 00       	call   800361 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800266:	83 c4 08             	add    $0x8,%esp
+  800269:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80026f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800275:	50                   	push   %eax
+  800276:	e8 c9 09 00 00       	call   800c44 <sys_cputs>
+
+	return b.cnt;
+}
+  80027b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800281:	c9                   	leave
+  800282:	c3                   	ret
+
+00800283 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800283:	55                   	push   %ebp
+  800284:	89 e5                	mov    %esp,%ebp
+  800286:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800289:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80028c:	50                   	push   %eax
+  80028d:	ff 75 08             	push   0x8(%ebp)
+  800290:	e8 9d ff ff ff       	call   800232 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800295:	c9                   	leave
+  800296:	c3                   	ret
+
+00800297 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	57                   	push   %edi
+  80029b:	56                   	push   %esi
+  80029c:	53                   	push   %ebx
+  80029d:	83 ec 1c             	sub    $0x1c,%esp
+  8002a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a3:	89 d6                	mov    %edx,%esi
+  8002a5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002ab:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002ae:	73 0b                	jae    8002bb <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002b3:	c1 e7 08             	shl    $0x8,%edi
+  8002b6:	0b 7d 10             	or     0x10(%ebp),%edi
+  8002b9:	eb 36                	jmp    8002f1 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8002bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c3:	f7 75 08             	divl   0x8(%ebp)
+  8002c6:	89 c1                	mov    %eax,%ecx
+  8002c8:	ff 75 14             	push   0x14(%ebp)
+  8002cb:	ff 75 10             	push   0x10(%ebp)
+  8002ce:	83 eb 01             	sub    $0x1,%ebx
+  8002d1:	53                   	push   %ebx
+  8002d2:	ff 75 08             	push   0x8(%ebp)
+  8002d5:	89 f2                	mov    %esi,%edx
+  8002d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002da:	e8 b8 ff ff ff       	call   800297 <printnum>
+  8002df:	83 c4 10             	add    $0x10,%esp
+  8002e2:	eb 14                	jmp    8002f8 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002e4:	83 ec 08             	sub    $0x8,%esp
+  8002e7:	56                   	push   %esi
+  8002e8:	57                   	push   %edi
+  8002e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002ec:	ff d0                	call   *%eax
+  8002ee:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f1:	83 eb 01             	sub    $0x1,%ebx
+  8002f4:	85 db                	test   %ebx,%ebx
+  8002f6:	7f ec                	jg     8002e4 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002f8:	83 ec 08             	sub    $0x8,%esp
+  8002fb:	56                   	push   %esi
+  8002fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800304:	f7 75 08             	divl   0x8(%ebp)
+  800307:	0f be 92 67 2c 80 00 	movsbl 0x802c67(%edx),%edx
+  80030e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800311:	c1 e0 08             	shl    $0x8,%eax
+  800314:	09 d0                	or     %edx,%eax
+  800316:	50                   	push   %eax
+  800317:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80031a:	ff d0                	call   *%eax
+}
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800322:	5b                   	pop    %ebx
+  800323:	5e                   	pop    %esi
+  800324:	5f                   	pop    %edi
+  800325:	5d                   	pop    %ebp
+  800326:	c3                   	ret
+
+00800327 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800327:	55                   	push   %ebp
+  800328:	89 e5                	mov    %esp,%ebp
+  80032a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80032d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800331:	8b 10                	mov    (%eax),%edx
+  800333:	3b 50 04             	cmp    0x4(%eax),%edx
+  800336:	73 0a                	jae    800342 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800338:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80033b:	89 08                	mov    %ecx,(%eax)
+  80033d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800340:	88 02                	mov    %al,(%edx)
+}
+  800342:	5d                   	pop    %ebp
+  800343:	c3                   	ret
+
+00800344 <printfmt>:
+{
+  800344:	55                   	push   %ebp
+  800345:	89 e5                	mov    %esp,%ebp
+  800347:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80034a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80034d:	50                   	push   %eax
+  80034e:	ff 75 10             	push   0x10(%ebp)
+  800351:	ff 75 0c             	push   0xc(%ebp)
+  800354:	ff 75 08             	push   0x8(%ebp)
+  800357:	e8 05 00 00 00       	call   800361 <vprintfmt>
+}
+  80035c:	83 c4 10             	add    $0x10,%esp
+  80035f:	c9                   	leave
+  800360:	c3                   	ret
+
+00800361 <vprintfmt>:
+{
+  800361:	55                   	push   %ebp
+  800362:	89 e5                	mov    %esp,%ebp
+  800364:	57                   	push   %edi
+  800365:	56                   	push   %esi
+  800366:	53                   	push   %ebx
+  800367:	83 ec 3c             	sub    $0x3c,%esp
+  80036a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80036d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800370:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800377:	eb 16                	jmp    80038f <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800379:	83 ec 08             	sub    $0x8,%esp
+  80037c:	ff 75 0c             	push   0xc(%ebp)
+  80037f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800382:	c1 e2 08             	shl    $0x8,%edx
+  800385:	09 d0                	or     %edx,%eax
+  800387:	50                   	push   %eax
+  800388:	ff d7                	call   *%edi
+  80038a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80038d:	89 de                	mov    %ebx,%esi
+  80038f:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800392:	0f b6 06             	movzbl (%esi),%eax
+  800395:	83 f8 25             	cmp    $0x25,%eax
+  800398:	74 0c                	je     8003a6 <vprintfmt+0x45>
+			if (ch == '\0')
+  80039a:	85 c0                	test   %eax,%eax
+  80039c:	75 db                	jne    800379 <vprintfmt+0x18>
+}
+  80039e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a1:	5b                   	pop    %ebx
+  8003a2:	5e                   	pop    %esi
+  8003a3:	5f                   	pop    %edi
+  8003a4:	5d                   	pop    %ebp
+  8003a5:	c3                   	ret
+		padc = ' ';
+  8003a6:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003aa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003b1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003b8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c4:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003c7:	0f b6 13             	movzbl (%ebx),%edx
+  8003ca:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003cd:	3c 55                	cmp    $0x55,%al
+  8003cf:	0f 87 2c 04 00 00    	ja     800801 <vprintfmt+0x4a0>
+  8003d5:	0f b6 c0             	movzbl %al,%eax
+  8003d8:	ff 24 85 c0 2d 80 00 	jmp    *0x802dc0(,%eax,4)
+  8003df:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003e1:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003e5:	eb dd                	jmp    8003c4 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e7:	89 f3                	mov    %esi,%ebx
+  8003e9:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003ed:	eb d5                	jmp    8003c4 <vprintfmt+0x63>
+  8003ef:	0f b6 d2             	movzbl %dl,%edx
+  8003f2:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003f4:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003f9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003fc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800400:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800403:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800406:	83 fe 09             	cmp    $0x9,%esi
+  800409:	0f 87 8a 00 00 00    	ja     800499 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80040f:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800412:	eb e5                	jmp    8003f9 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800414:	8b 45 14             	mov    0x14(%ebp),%eax
+  800417:	8b 00                	mov    (%eax),%eax
+  800419:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041f:	8d 40 04             	lea    0x4(%eax),%eax
+  800422:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800425:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800427:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80042b:	79 97                	jns    8003c4 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80042d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800430:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800433:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80043a:	eb 88                	jmp    8003c4 <vprintfmt+0x63>
+			if (width < 0)
+  80043c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80043f:	85 db                	test   %ebx,%ebx
+  800441:	b8 00 00 00 00       	mov    $0x0,%eax
+  800446:	0f 49 c3             	cmovns %ebx,%eax
+  800449:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044c:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80044e:	e9 71 ff ff ff       	jmp    8003c4 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800453:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800455:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80045c:	e9 63 ff ff ff       	jmp    8003c4 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800461:	8d 73 02             	lea    0x2(%ebx),%esi
+  800464:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800468:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80046f:	3c 67                	cmp    $0x67,%al
+  800471:	0f 84 18 ff ff ff    	je     80038f <vprintfmt+0x2e>
+					attrib = 0x04;
+  800477:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80047e:	3c 72                	cmp    $0x72,%al
+  800480:	0f 84 09 ff ff ff    	je     80038f <vprintfmt+0x2e>
+					attrib = 0x00;
+  800486:	3c 62                	cmp    $0x62,%al
+  800488:	0f 94 c0             	sete   %al
+  80048b:	0f b6 c0             	movzbl %al,%eax
+  80048e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800491:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800494:	e9 f6 fe ff ff       	jmp    80038f <vprintfmt+0x2e>
+  800499:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80049c:	eb 89                	jmp    800427 <vprintfmt+0xc6>
+			lflag++;
+  80049e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a1:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004a3:	e9 1c ff ff ff       	jmp    8003c4 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004ae:	83 ec 08             	sub    $0x8,%esp
+  8004b1:	ff 75 0c             	push   0xc(%ebp)
+  8004b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004b7:	c1 e0 08             	shl    $0x8,%eax
+  8004ba:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8004bd:	0b 01                	or     (%ecx),%eax
+  8004bf:	50                   	push   %eax
+  8004c0:	ff d7                	call   *%edi
+			break;
+  8004c2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004c5:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004c8:	e9 c2 fe ff ff       	jmp    80038f <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d0:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004d3:	8b 10                	mov    (%eax),%edx
+  8004d5:	89 d0                	mov    %edx,%eax
+  8004d7:	f7 d8                	neg    %eax
+  8004d9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004dc:	83 f8 12             	cmp    $0x12,%eax
+  8004df:	7f 25                	jg     800506 <vprintfmt+0x1a5>
+  8004e1:	8b 14 85 20 2f 80 00 	mov    0x802f20(,%eax,4),%edx
+  8004e8:	85 d2                	test   %edx,%edx
+  8004ea:	74 1a                	je     800506 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004ec:	52                   	push   %edx
+  8004ed:	68 61 30 80 00       	push   $0x803061
+  8004f2:	ff 75 0c             	push   0xc(%ebp)
+  8004f5:	57                   	push   %edi
+  8004f6:	e8 49 fe ff ff       	call   800344 <printfmt>
+  8004fb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004fe:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800501:	e9 89 fe ff ff       	jmp    80038f <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800506:	50                   	push   %eax
+  800507:	68 7f 2c 80 00       	push   $0x802c7f
+  80050c:	ff 75 0c             	push   0xc(%ebp)
+  80050f:	57                   	push   %edi
+  800510:	e8 2f fe ff ff       	call   800344 <printfmt>
+  800515:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800518:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80051b:	e9 6f fe ff ff       	jmp    80038f <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	83 c0 04             	add    $0x4,%eax
+  800526:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800529:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80052e:	85 c9                	test   %ecx,%ecx
+  800530:	b8 78 2c 80 00       	mov    $0x802c78,%eax
+  800535:	0f 45 c1             	cmovne %ecx,%eax
+  800538:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80053b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80053f:	7e 06                	jle    800547 <vprintfmt+0x1e6>
+  800541:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800545:	75 1a                	jne    800561 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800547:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80054a:	c1 e0 08             	shl    $0x8,%eax
+  80054d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800550:	83 c8 3f             	or     $0x3f,%eax
+  800553:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800556:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800559:	89 75 10             	mov    %esi,0x10(%ebp)
+  80055c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80055f:	eb 6d                	jmp    8005ce <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800561:	83 ec 08             	sub    $0x8,%esp
+  800564:	ff 75 d0             	push   -0x30(%ebp)
+  800567:	ff 75 c8             	push   -0x38(%ebp)
+  80056a:	e8 39 03 00 00       	call   8008a8 <strnlen>
+  80056f:	89 c2                	mov    %eax,%edx
+  800571:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800574:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800576:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800579:	c1 e1 08             	shl    $0x8,%ecx
+  80057c:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800580:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800582:	83 c4 10             	add    $0x10,%esp
+  800585:	89 c3                	mov    %eax,%ebx
+  800587:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80058d:	89 ce                	mov    %ecx,%esi
+  80058f:	eb 0f                	jmp    8005a0 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800591:	83 ec 08             	sub    $0x8,%esp
+  800594:	ff 75 0c             	push   0xc(%ebp)
+  800597:	56                   	push   %esi
+  800598:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059a:	83 eb 01             	sub    $0x1,%ebx
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	85 db                	test   %ebx,%ebx
+  8005a2:	7f ed                	jg     800591 <vprintfmt+0x230>
+  8005a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005aa:	85 c0                	test   %eax,%eax
+  8005ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b1:	0f 49 d0             	cmovns %eax,%edx
+  8005b4:	29 d0                	sub    %edx,%eax
+  8005b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b9:	eb 8c                	jmp    800547 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8005bb:	83 ec 08             	sub    $0x8,%esp
+  8005be:	ff 75 0c             	push   0xc(%ebp)
+  8005c1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005c4:	09 c2                	or     %eax,%edx
+  8005c6:	52                   	push   %edx
+  8005c7:	ff d7                	call   *%edi
+  8005c9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005cc:	89 d9                	mov    %ebx,%ecx
+  8005ce:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005d1:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005d5:	0f be d0             	movsbl %al,%edx
+  8005d8:	85 d2                	test   %edx,%edx
+  8005da:	74 2a                	je     800606 <vprintfmt+0x2a5>
+  8005dc:	85 f6                	test   %esi,%esi
+  8005de:	78 05                	js     8005e5 <vprintfmt+0x284>
+  8005e0:	83 ee 01             	sub    $0x1,%esi
+  8005e3:	78 3b                	js     800620 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e9:	74 d0                	je     8005bb <vprintfmt+0x25a>
+  8005eb:	0f be c0             	movsbl %al,%eax
+  8005ee:	83 e8 20             	sub    $0x20,%eax
+  8005f1:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f4:	76 c5                	jbe    8005bb <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005f6:	83 ec 08             	sub    $0x8,%esp
+  8005f9:	ff 75 0c             	push   0xc(%ebp)
+  8005fc:	ff 75 cc             	push   -0x34(%ebp)
+  8005ff:	ff d7                	call   *%edi
+  800601:	83 c4 10             	add    $0x10,%esp
+  800604:	eb c6                	jmp    8005cc <vprintfmt+0x26b>
+  800606:	8b 75 10             	mov    0x10(%ebp),%esi
+  800609:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80060c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80060f:	01 c3                	add    %eax,%ebx
+  800611:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800613:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800616:	83 c8 20             	or     $0x20,%eax
+  800619:	89 75 10             	mov    %esi,0x10(%ebp)
+  80061c:	89 c6                	mov    %eax,%esi
+  80061e:	eb 14                	jmp    800634 <vprintfmt+0x2d3>
+  800620:	8b 75 10             	mov    0x10(%ebp),%esi
+  800623:	eb e4                	jmp    800609 <vprintfmt+0x2a8>
+  800625:	83 ec 08             	sub    $0x8,%esp
+  800628:	ff 75 0c             	push   0xc(%ebp)
+  80062b:	56                   	push   %esi
+  80062c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80062e:	83 eb 01             	sub    $0x1,%ebx
+  800631:	83 c4 10             	add    $0x10,%esp
+  800634:	85 db                	test   %ebx,%ebx
+  800636:	7f ed                	jg     800625 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800638:	8b 75 10             	mov    0x10(%ebp),%esi
+  80063b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80063e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800641:	e9 49 fd ff ff       	jmp    80038f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800646:	83 f9 01             	cmp    $0x1,%ecx
+  800649:	7f 1f                	jg     80066a <vprintfmt+0x309>
+	else if (lflag)
+  80064b:	85 c9                	test   %ecx,%ecx
+  80064d:	74 69                	je     8006b8 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80064f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800652:	8b 00                	mov    (%eax),%eax
+  800654:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800657:	89 c1                	mov    %eax,%ecx
+  800659:	c1 f9 1f             	sar    $0x1f,%ecx
+  80065c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80065f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800662:	8d 40 04             	lea    0x4(%eax),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+  800668:	eb 17                	jmp    800681 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80066a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066d:	8b 50 04             	mov    0x4(%eax),%edx
+  800670:	8b 00                	mov    (%eax),%eax
+  800672:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800675:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8d 40 08             	lea    0x8(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800681:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800684:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800687:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80068c:	85 db                	test   %ebx,%ebx
+  80068e:	0f 89 f6 00 00 00    	jns    80078a <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800694:	83 ec 08             	sub    $0x8,%esp
+  800697:	ff 75 0c             	push   0xc(%ebp)
+  80069a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80069d:	c1 e0 08             	shl    $0x8,%eax
+  8006a0:	83 c8 2d             	or     $0x2d,%eax
+  8006a3:	50                   	push   %eax
+  8006a4:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006a6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006a9:	f7 d9                	neg    %ecx
+  8006ab:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006b3:	e9 d2 00 00 00       	jmp    80078a <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 00                	mov    (%eax),%eax
+  8006bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c0:	89 c1                	mov    %eax,%ecx
+  8006c2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006c5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d1:	eb ae                	jmp    800681 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006d3:	83 f9 01             	cmp    $0x1,%ecx
+  8006d6:	7f 19                	jg     8006f1 <vprintfmt+0x390>
+	else if (lflag)
+  8006d8:	85 c9                	test   %ecx,%ecx
+  8006da:	74 2a                	je     800706 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006df:	8b 08                	mov    (%eax),%ecx
+  8006e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006ec:	e9 99 00 00 00       	jmp    80078a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f4:	8b 08                	mov    (%eax),%ecx
+  8006f6:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800701:	e9 84 00 00 00       	jmp    80078a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8b 08                	mov    (%eax),%ecx
+  80070b:	8d 40 04             	lea    0x4(%eax),%eax
+  80070e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800711:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800716:	eb 72                	jmp    80078a <vprintfmt+0x429>
+	if (lflag >= 2)
+  800718:	83 f9 01             	cmp    $0x1,%ecx
+  80071b:	7f 16                	jg     800733 <vprintfmt+0x3d2>
+	else if (lflag)
+  80071d:	85 c9                	test   %ecx,%ecx
+  80071f:	74 24                	je     800745 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 08                	mov    (%eax),%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800731:	eb 57                	jmp    80078a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 08                	mov    (%eax),%ecx
+  800738:	8d 40 08             	lea    0x8(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800743:	eb 45                	jmp    80078a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 08                	mov    (%eax),%ecx
+  80074a:	8d 40 04             	lea    0x4(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800750:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800755:	eb 33                	jmp    80078a <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800757:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80075a:	c1 e3 08             	shl    $0x8,%ebx
+  80075d:	83 ec 08             	sub    $0x8,%esp
+  800760:	ff 75 0c             	push   0xc(%ebp)
+  800763:	89 d8                	mov    %ebx,%eax
+  800765:	83 c8 30             	or     $0x30,%eax
+  800768:	50                   	push   %eax
+  800769:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80076b:	83 c4 08             	add    $0x8,%esp
+  80076e:	ff 75 0c             	push   0xc(%ebp)
+  800771:	83 cb 78             	or     $0x78,%ebx
+  800774:	53                   	push   %ebx
+  800775:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80077c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800785:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80078a:	ff 75 e4             	push   -0x1c(%ebp)
+  80078d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800791:	52                   	push   %edx
+  800792:	ff 75 e0             	push   -0x20(%ebp)
+  800795:	50                   	push   %eax
+  800796:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800799:	89 f8                	mov    %edi,%eax
+  80079b:	e8 f7 fa ff ff       	call   800297 <printnum>
+			break;
+  8007a0:	83 c4 10             	add    $0x10,%esp
+  8007a3:	e9 e7 fb ff ff       	jmp    80038f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007a8:	83 f9 01             	cmp    $0x1,%ecx
+  8007ab:	7f 16                	jg     8007c3 <vprintfmt+0x462>
+	else if (lflag)
+  8007ad:	85 c9                	test   %ecx,%ecx
+  8007af:	74 24                	je     8007d5 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b4:	8b 08                	mov    (%eax),%ecx
+  8007b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007bc:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8007c1:	eb c7                	jmp    80078a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c6:	8b 08                	mov    (%eax),%ecx
+  8007c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ce:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007d3:	eb b5                	jmp    80078a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d8:	8b 08                	mov    (%eax),%ecx
+  8007da:	8d 40 04             	lea    0x4(%eax),%eax
+  8007dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e0:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007e5:	eb a3                	jmp    80078a <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007e7:	83 ec 08             	sub    $0x8,%esp
+  8007ea:	ff 75 0c             	push   0xc(%ebp)
+  8007ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007f0:	c1 e0 08             	shl    $0x8,%eax
+  8007f3:	83 c8 25             	or     $0x25,%eax
+  8007f6:	50                   	push   %eax
+  8007f7:	ff d7                	call   *%edi
+			break;
+  8007f9:	83 c4 10             	add    $0x10,%esp
+  8007fc:	e9 8e fb ff ff       	jmp    80038f <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800801:	83 ec 08             	sub    $0x8,%esp
+  800804:	ff 75 0c             	push   0xc(%ebp)
+  800807:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80080a:	c1 e0 08             	shl    $0x8,%eax
+  80080d:	83 c8 25             	or     $0x25,%eax
+  800810:	50                   	push   %eax
+  800811:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800813:	83 c4 10             	add    $0x10,%esp
+  800816:	89 de                	mov    %ebx,%esi
+  800818:	eb 03                	jmp    80081d <vprintfmt+0x4bc>
+  80081a:	83 ee 01             	sub    $0x1,%esi
+  80081d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800821:	75 f7                	jne    80081a <vprintfmt+0x4b9>
+  800823:	e9 67 fb ff ff       	jmp    80038f <vprintfmt+0x2e>
+
+00800828 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800828:	55                   	push   %ebp
+  800829:	89 e5                	mov    %esp,%ebp
+  80082b:	83 ec 18             	sub    $0x18,%esp
+  80082e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800831:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800834:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800837:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80083b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80083e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800845:	85 c0                	test   %eax,%eax
+  800847:	74 26                	je     80086f <vsnprintf+0x47>
+  800849:	85 d2                	test   %edx,%edx
+  80084b:	7e 22                	jle    80086f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80084d:	ff 75 14             	push   0x14(%ebp)
+  800850:	ff 75 10             	push   0x10(%ebp)
+  800853:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800856:	50                   	push   %eax
+  800857:	68 27 03 80 00       	push   $0x800327
+  80085c:	e8 00 fb ff ff       	call   800361 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800861:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800864:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800867:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80086a:	83 c4 10             	add    $0x10,%esp
+}
+  80086d:	c9                   	leave
+  80086e:	c3                   	ret
+		return -E_INVAL;
+  80086f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800874:	eb f7                	jmp    80086d <vsnprintf+0x45>
+
+00800876 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80087c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80087f:	50                   	push   %eax
+  800880:	ff 75 10             	push   0x10(%ebp)
+  800883:	ff 75 0c             	push   0xc(%ebp)
+  800886:	ff 75 08             	push   0x8(%ebp)
+  800889:	e8 9a ff ff ff       	call   800828 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80088e:	c9                   	leave
+  80088f:	c3                   	ret
+
+00800890 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800890:	55                   	push   %ebp
+  800891:	89 e5                	mov    %esp,%ebp
+  800893:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089b:	eb 03                	jmp    8008a0 <strlen+0x10>
+		n++;
+  80089d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008a0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008a4:	75 f7                	jne    80089d <strlen+0xd>
+	return n;
+}
+  8008a6:	5d                   	pop    %ebp
+  8008a7:	c3                   	ret
+
+008008a8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008a8:	55                   	push   %ebp
+  8008a9:	89 e5                	mov    %esp,%ebp
+  8008ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b6:	eb 03                	jmp    8008bb <strnlen+0x13>
+		n++;
+  8008b8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008bb:	39 d0                	cmp    %edx,%eax
+  8008bd:	74 08                	je     8008c7 <strnlen+0x1f>
+  8008bf:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008c3:	75 f3                	jne    8008b8 <strnlen+0x10>
+  8008c5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008c7:	89 d0                	mov    %edx,%eax
+  8008c9:	5d                   	pop    %ebp
+  8008ca:	c3                   	ret
+
+008008cb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	53                   	push   %ebx
+  8008cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008da:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008de:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008e1:	83 c0 01             	add    $0x1,%eax
+  8008e4:	84 d2                	test   %dl,%dl
+  8008e6:	75 f2                	jne    8008da <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008e8:	89 c8                	mov    %ecx,%eax
+  8008ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ed:	c9                   	leave
+  8008ee:	c3                   	ret
+
+008008ef <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ef:	55                   	push   %ebp
+  8008f0:	89 e5                	mov    %esp,%ebp
+  8008f2:	53                   	push   %ebx
+  8008f3:	83 ec 10             	sub    $0x10,%esp
+  8008f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008f9:	53                   	push   %ebx
+  8008fa:	e8 91 ff ff ff       	call   800890 <strlen>
+  8008ff:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800902:	ff 75 0c             	push   0xc(%ebp)
+  800905:	01 d8                	add    %ebx,%eax
+  800907:	50                   	push   %eax
+  800908:	e8 be ff ff ff       	call   8008cb <strcpy>
+	return dst;
+}
+  80090d:	89 d8                	mov    %ebx,%eax
+  80090f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800912:	c9                   	leave
+  800913:	c3                   	ret
+
+00800914 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800914:	55                   	push   %ebp
+  800915:	89 e5                	mov    %esp,%ebp
+  800917:	56                   	push   %esi
+  800918:	53                   	push   %ebx
+  800919:	8b 75 08             	mov    0x8(%ebp),%esi
+  80091c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80091f:	89 f3                	mov    %esi,%ebx
+  800921:	03 5d 10             	add    0x10(%ebp),%ebx
+  800924:	89 f0                	mov    %esi,%eax
+  800926:	eb 0f                	jmp    800937 <strncpy+0x23>
+		*dst++ = *src;
+  800928:	83 c0 01             	add    $0x1,%eax
+  80092b:	0f b6 0a             	movzbl (%edx),%ecx
+  80092e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800931:	80 f9 01             	cmp    $0x1,%cl
+  800934:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800937:	39 d8                	cmp    %ebx,%eax
+  800939:	75 ed                	jne    800928 <strncpy+0x14>
+	}
+	return ret;
+}
+  80093b:	89 f0                	mov    %esi,%eax
+  80093d:	5b                   	pop    %ebx
+  80093e:	5e                   	pop    %esi
+  80093f:	5d                   	pop    %ebp
+  800940:	c3                   	ret
+
+00800941 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	56                   	push   %esi
+  800945:	53                   	push   %ebx
+  800946:	8b 75 08             	mov    0x8(%ebp),%esi
+  800949:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80094c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80094f:	89 f0                	mov    %esi,%eax
+  800951:	85 d2                	test   %edx,%edx
+  800953:	74 21                	je     800976 <strlcpy+0x35>
+  800955:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800959:	89 f2                	mov    %esi,%edx
+  80095b:	eb 09                	jmp    800966 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80095d:	83 c1 01             	add    $0x1,%ecx
+  800960:	83 c2 01             	add    $0x1,%edx
+  800963:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800966:	39 c2                	cmp    %eax,%edx
+  800968:	74 09                	je     800973 <strlcpy+0x32>
+  80096a:	0f b6 19             	movzbl (%ecx),%ebx
+  80096d:	84 db                	test   %bl,%bl
+  80096f:	75 ec                	jne    80095d <strlcpy+0x1c>
+  800971:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800973:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800976:	29 f0                	sub    %esi,%eax
+}
+  800978:	5b                   	pop    %ebx
+  800979:	5e                   	pop    %esi
+  80097a:	5d                   	pop    %ebp
+  80097b:	c3                   	ret
+
+0080097c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800982:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800985:	eb 06                	jmp    80098d <strcmp+0x11>
+		p++, q++;
+  800987:	83 c1 01             	add    $0x1,%ecx
+  80098a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80098d:	0f b6 01             	movzbl (%ecx),%eax
+  800990:	84 c0                	test   %al,%al
+  800992:	74 04                	je     800998 <strcmp+0x1c>
+  800994:	3a 02                	cmp    (%edx),%al
+  800996:	74 ef                	je     800987 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800998:	0f b6 c0             	movzbl %al,%eax
+  80099b:	0f b6 12             	movzbl (%edx),%edx
+  80099e:	29 d0                	sub    %edx,%eax
+}
+  8009a0:	5d                   	pop    %ebp
+  8009a1:	c3                   	ret
+
+008009a2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	53                   	push   %ebx
+  8009a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ac:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009af:	eb 09                	jmp    8009ba <strncmp+0x18>
+		n--, p++, q++;
+  8009b1:	83 ea 01             	sub    $0x1,%edx
+  8009b4:	83 c0 01             	add    $0x1,%eax
+  8009b7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009ba:	85 d2                	test   %edx,%edx
+  8009bc:	74 18                	je     8009d6 <strncmp+0x34>
+  8009be:	0f b6 18             	movzbl (%eax),%ebx
+  8009c1:	84 db                	test   %bl,%bl
+  8009c3:	74 04                	je     8009c9 <strncmp+0x27>
+  8009c5:	3a 19                	cmp    (%ecx),%bl
+  8009c7:	74 e8                	je     8009b1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c9:	0f b6 00             	movzbl (%eax),%eax
+  8009cc:	0f b6 11             	movzbl (%ecx),%edx
+  8009cf:	29 d0                	sub    %edx,%eax
+}
+  8009d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d4:	c9                   	leave
+  8009d5:	c3                   	ret
+		return 0;
+  8009d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009db:	eb f4                	jmp    8009d1 <strncmp+0x2f>
+
+008009dd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009dd:	55                   	push   %ebp
+  8009de:	89 e5                	mov    %esp,%ebp
+  8009e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e7:	eb 03                	jmp    8009ec <strchr+0xf>
+  8009e9:	83 c0 01             	add    $0x1,%eax
+  8009ec:	0f b6 10             	movzbl (%eax),%edx
+  8009ef:	84 d2                	test   %dl,%dl
+  8009f1:	74 06                	je     8009f9 <strchr+0x1c>
+		if (*s == c)
+  8009f3:	38 ca                	cmp    %cl,%dl
+  8009f5:	75 f2                	jne    8009e9 <strchr+0xc>
+  8009f7:	eb 05                	jmp    8009fe <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009fe:	5d                   	pop    %ebp
+  8009ff:	c3                   	ret
+
+00800a00 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a00:	55                   	push   %ebp
+  800a01:	89 e5                	mov    %esp,%ebp
+  800a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a06:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a0a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a0d:	38 ca                	cmp    %cl,%dl
+  800a0f:	74 09                	je     800a1a <strfind+0x1a>
+  800a11:	84 d2                	test   %dl,%dl
+  800a13:	74 05                	je     800a1a <strfind+0x1a>
+	for (; *s; s++)
+  800a15:	83 c0 01             	add    $0x1,%eax
+  800a18:	eb f0                	jmp    800a0a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a1a:	5d                   	pop    %ebp
+  800a1b:	c3                   	ret
+
+00800a1c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a1c:	55                   	push   %ebp
+  800a1d:	89 e5                	mov    %esp,%ebp
+  800a1f:	57                   	push   %edi
+  800a20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a23:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a26:	85 c9                	test   %ecx,%ecx
+  800a28:	74 20                	je     800a4a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a2a:	89 f8                	mov    %edi,%eax
+  800a2c:	09 c8                	or     %ecx,%eax
+  800a2e:	a8 03                	test   $0x3,%al
+  800a30:	75 12                	jne    800a44 <memset+0x28>
+		c &= 0xFF;
+  800a32:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a36:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a3c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a3f:	fc                   	cld
+  800a40:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a42:	eb 06                	jmp    800a4a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a44:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a47:	fc                   	cld
+  800a48:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a4a:	89 f8                	mov    %edi,%eax
+  800a4c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a4f:	c9                   	leave
+  800a50:	c3                   	ret
+
+00800a51 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	57                   	push   %edi
+  800a55:	56                   	push   %esi
+  800a56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a59:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a5c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a5f:	39 c6                	cmp    %eax,%esi
+  800a61:	73 32                	jae    800a95 <memmove+0x44>
+  800a63:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a66:	39 d0                	cmp    %edx,%eax
+  800a68:	73 2b                	jae    800a95 <memmove+0x44>
+		s += n;
+		d += n;
+  800a6a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a6d:	89 d6                	mov    %edx,%esi
+  800a6f:	09 fe                	or     %edi,%esi
+  800a71:	09 ce                	or     %ecx,%esi
+  800a73:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a79:	75 0e                	jne    800a89 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a7b:	83 ef 04             	sub    $0x4,%edi
+  800a7e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a81:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a84:	fd                   	std
+  800a85:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a87:	eb 09                	jmp    800a92 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a89:	83 ef 01             	sub    $0x1,%edi
+  800a8c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a8f:	fd                   	std
+  800a90:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a92:	fc                   	cld
+  800a93:	eb 1a                	jmp    800aaf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a95:	89 f2                	mov    %esi,%edx
+  800a97:	09 c2                	or     %eax,%edx
+  800a99:	09 ca                	or     %ecx,%edx
+  800a9b:	f6 c2 03             	test   $0x3,%dl
+  800a9e:	75 0a                	jne    800aaa <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800aa0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800aa3:	89 c7                	mov    %eax,%edi
+  800aa5:	fc                   	cld
+  800aa6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa8:	eb 05                	jmp    800aaf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aaa:	89 c7                	mov    %eax,%edi
+  800aac:	fc                   	cld
+  800aad:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aaf:	5e                   	pop    %esi
+  800ab0:	5f                   	pop    %edi
+  800ab1:	5d                   	pop    %ebp
+  800ab2:	c3                   	ret
+
+00800ab3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ab3:	55                   	push   %ebp
+  800ab4:	89 e5                	mov    %esp,%ebp
+  800ab6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ab9:	ff 75 10             	push   0x10(%ebp)
+  800abc:	ff 75 0c             	push   0xc(%ebp)
+  800abf:	ff 75 08             	push   0x8(%ebp)
+  800ac2:	e8 8a ff ff ff       	call   800a51 <memmove>
+}
+  800ac7:	c9                   	leave
+  800ac8:	c3                   	ret
+
+00800ac9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ac9:	55                   	push   %ebp
+  800aca:	89 e5                	mov    %esp,%ebp
+  800acc:	56                   	push   %esi
+  800acd:	53                   	push   %ebx
+  800ace:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ad4:	89 c6                	mov    %eax,%esi
+  800ad6:	03 75 10             	add    0x10(%ebp),%esi
+  800ad9:	eb 06                	jmp    800ae1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800adb:	83 c0 01             	add    $0x1,%eax
+  800ade:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ae1:	39 f0                	cmp    %esi,%eax
+  800ae3:	74 14                	je     800af9 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ae5:	0f b6 08             	movzbl (%eax),%ecx
+  800ae8:	0f b6 1a             	movzbl (%edx),%ebx
+  800aeb:	38 d9                	cmp    %bl,%cl
+  800aed:	74 ec                	je     800adb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aef:	0f b6 c1             	movzbl %cl,%eax
+  800af2:	0f b6 db             	movzbl %bl,%ebx
+  800af5:	29 d8                	sub    %ebx,%eax
+  800af7:	eb 05                	jmp    800afe <memcmp+0x35>
+	}
+
+	return 0;
+  800af9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800afe:	5b                   	pop    %ebx
+  800aff:	5e                   	pop    %esi
+  800b00:	5d                   	pop    %ebp
+  800b01:	c3                   	ret
+
+00800b02 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b0b:	89 c2                	mov    %eax,%edx
+  800b0d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b10:	eb 03                	jmp    800b15 <memfind+0x13>
+  800b12:	83 c0 01             	add    $0x1,%eax
+  800b15:	39 d0                	cmp    %edx,%eax
+  800b17:	73 04                	jae    800b1d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b19:	38 08                	cmp    %cl,(%eax)
+  800b1b:	75 f5                	jne    800b12 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b1d:	5d                   	pop    %ebp
+  800b1e:	c3                   	ret
+
+00800b1f <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	57                   	push   %edi
+  800b23:	56                   	push   %esi
+  800b24:	53                   	push   %ebx
+  800b25:	83 ec 1c             	sub    $0x1c,%esp
+  800b28:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b2b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b2e:	eb 03                	jmp    800b33 <strtol+0x14>
+		s++;
+  800b30:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b33:	0f b6 06             	movzbl (%esi),%eax
+  800b36:	3c 20                	cmp    $0x20,%al
+  800b38:	74 f6                	je     800b30 <strtol+0x11>
+  800b3a:	3c 09                	cmp    $0x9,%al
+  800b3c:	74 f2                	je     800b30 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b3e:	3c 2b                	cmp    $0x2b,%al
+  800b40:	74 43                	je     800b85 <strtol+0x66>
+	int neg = 0;
+  800b42:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b47:	3c 2d                	cmp    $0x2d,%al
+  800b49:	74 44                	je     800b8f <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b4b:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b51:	75 0f                	jne    800b62 <strtol+0x43>
+  800b53:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b56:	74 41                	je     800b99 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b58:	85 ff                	test   %edi,%edi
+  800b5a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b5f:	0f 44 f8             	cmove  %eax,%edi
+  800b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b67:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b6c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b6f:	89 fb                	mov    %edi,%ebx
+  800b71:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b74:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b77:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b7a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b7d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b80:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b83:	eb 67                	jmp    800bec <strtol+0xcd>
+		s++;
+  800b85:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8d:	eb bc                	jmp    800b4b <strtol+0x2c>
+		s++, neg = 1;
+  800b8f:	83 c6 01             	add    $0x1,%esi
+  800b92:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b97:	eb b2                	jmp    800b4b <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b99:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b9d:	74 0e                	je     800bad <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b9f:	85 ff                	test   %edi,%edi
+  800ba1:	75 bf                	jne    800b62 <strtol+0x43>
+		s++, base = 8;
+  800ba3:	83 c6 01             	add    $0x1,%esi
+  800ba6:	bf 08 00 00 00       	mov    $0x8,%edi
+  800bab:	eb b5                	jmp    800b62 <strtol+0x43>
+		s += 2, base = 16;
+  800bad:	83 c6 02             	add    $0x2,%esi
+  800bb0:	bf 10 00 00 00       	mov    $0x10,%edi
+  800bb5:	eb ab                	jmp    800b62 <strtol+0x43>
+			dig = *s - '0';
+  800bb7:	0f be c9             	movsbl %cl,%ecx
+  800bba:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800bbd:	39 f9                	cmp    %edi,%ecx
+  800bbf:	7d 59                	jge    800c1a <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800bc1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800bc5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bc8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bcb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bce:	0f af d8             	imul   %eax,%ebx
+  800bd1:	0f af d7             	imul   %edi,%edx
+  800bd4:	01 d3                	add    %edx,%ebx
+  800bd6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bd9:	f7 e7                	mul    %edi
+  800bdb:	01 da                	add    %ebx,%edx
+  800bdd:	89 cb                	mov    %ecx,%ebx
+  800bdf:	c1 fb 1f             	sar    $0x1f,%ebx
+  800be2:	01 c8                	add    %ecx,%eax
+  800be4:	11 da                	adc    %ebx,%edx
+  800be6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800be9:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bef:	0f b6 08             	movzbl (%eax),%ecx
+  800bf2:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800bf5:	80 fb 09             	cmp    $0x9,%bl
+  800bf8:	76 bd                	jbe    800bb7 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800bfa:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800bfd:	80 fb 19             	cmp    $0x19,%bl
+  800c00:	77 08                	ja     800c0a <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c02:	0f be c9             	movsbl %cl,%ecx
+  800c05:	83 e9 57             	sub    $0x57,%ecx
+  800c08:	eb b3                	jmp    800bbd <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c0a:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c0d:	80 fb 19             	cmp    $0x19,%bl
+  800c10:	77 08                	ja     800c1a <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c12:	0f be c9             	movsbl %cl,%ecx
+  800c15:	83 e9 37             	sub    $0x37,%ecx
+  800c18:	eb a3                	jmp    800bbd <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c1a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c1d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c20:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c23:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c26:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c2a:	74 05                	je     800c31 <strtol+0x112>
+		*endptr = (char *) s;
+  800c2c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c2f:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c31:	85 c9                	test   %ecx,%ecx
+  800c33:	74 07                	je     800c3c <strtol+0x11d>
+  800c35:	f7 d8                	neg    %eax
+  800c37:	83 d2 00             	adc    $0x0,%edx
+  800c3a:	f7 da                	neg    %edx
+}
+  800c3c:	83 c4 1c             	add    $0x1c,%esp
+  800c3f:	5b                   	pop    %ebx
+  800c40:	5e                   	pop    %esi
+  800c41:	5f                   	pop    %edi
+  800c42:	5d                   	pop    %ebp
+  800c43:	c3                   	ret
+
+00800c44 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	57                   	push   %edi
+  800c48:	56                   	push   %esi
+  800c49:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c4a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c51:	74 18                	je     800c6b <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5e:	89 c3                	mov    %eax,%ebx
+  800c60:	89 c7                	mov    %eax,%edi
+  800c62:	89 c6                	mov    %eax,%esi
+  800c64:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c66:	5b                   	pop    %ebx
+  800c67:	5e                   	pop    %esi
+  800c68:	5f                   	pop    %edi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c76:	89 c3                	mov    %eax,%ebx
+  800c78:	89 c7                	mov    %eax,%edi
+  800c7a:	55                   	push   %ebp
+  800c7b:	89 e5                	mov    %esp,%ebp
+  800c7d:	8d 35 85 0c 80 00    	lea    0x800c85,%esi
+  800c83:	0f 34                	sysenter
+  800c85:	5d                   	pop    %ebp
+		goto out;
+  800c86:	eb de                	jmp    800c66 <sys_cputs+0x22>
+
+00800c88 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	57                   	push   %edi
+  800c8c:	56                   	push   %esi
+  800c8d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c8e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c95:	74 19                	je     800cb0 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca1:	89 d1                	mov    %edx,%ecx
+  800ca3:	89 d3                	mov    %edx,%ebx
+  800ca5:	89 d7                	mov    %edx,%edi
+  800ca7:	89 d6                	mov    %edx,%esi
+  800ca9:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cab:	5b                   	pop    %ebx
+  800cac:	5e                   	pop    %esi
+  800cad:	5f                   	pop    %edi
+  800cae:	5d                   	pop    %ebp
+  800caf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cba:	89 d1                	mov    %edx,%ecx
+  800cbc:	89 d3                	mov    %edx,%ebx
+  800cbe:	89 d7                	mov    %edx,%edi
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	8d 35 cb 0c 80 00    	lea    0x800ccb,%esi
+  800cc9:	0f 34                	sysenter
+  800ccb:	5d                   	pop    %ebp
+		goto out;
+  800ccc:	eb dd                	jmp    800cab <sys_cgetc+0x23>
+
+00800cce <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cce:	55                   	push   %ebp
+  800ccf:	89 e5                	mov    %esp,%ebp
+  800cd1:	57                   	push   %edi
+  800cd2:	56                   	push   %esi
+  800cd3:	53                   	push   %ebx
+  800cd4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800cd7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cde:	74 21                	je     800d01 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800ce0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ced:	89 cb                	mov    %ecx,%ebx
+  800cef:	89 cf                	mov    %ecx,%edi
+  800cf1:	89 ce                	mov    %ecx,%esi
+  800cf3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf5:	85 c0                	test   %eax,%eax
+  800cf7:	7f 27                	jg     800d20 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfc:	5b                   	pop    %ebx
+  800cfd:	5e                   	pop    %esi
+  800cfe:	5f                   	pop    %edi
+  800cff:	5d                   	pop    %ebp
+  800d00:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d09:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d0e:	89 cb                	mov    %ecx,%ebx
+  800d10:	89 cf                	mov    %ecx,%edi
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	8d 35 1d 0d 80 00    	lea    0x800d1d,%esi
+  800d1b:	0f 34                	sysenter
+  800d1d:	5d                   	pop    %ebp
+		goto out;
+  800d1e:	eb d5                	jmp    800cf5 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d20:	83 ec 0c             	sub    $0xc,%esp
+  800d23:	50                   	push   %eax
+  800d24:	6a 03                	push   $0x3
+  800d26:	68 8b 2f 80 00       	push   $0x802f8b
+  800d2b:	6a 3f                	push   $0x3f
+  800d2d:	68 a8 2f 80 00       	push   $0x802fa8
+  800d32:	e8 71 f4 ff ff       	call   8001a8 <_panic>
+
+00800d37 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	56                   	push   %esi
+  800d3c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d3d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d44:	74 19                	je     800d5f <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d50:	89 d1                	mov    %edx,%ecx
+  800d52:	89 d3                	mov    %edx,%ebx
+  800d54:	89 d7                	mov    %edx,%edi
+  800d56:	89 d6                	mov    %edx,%esi
+  800d58:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d64:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d69:	89 d1                	mov    %edx,%ecx
+  800d6b:	89 d3                	mov    %edx,%ebx
+  800d6d:	89 d7                	mov    %edx,%edi
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	8d 35 7a 0d 80 00    	lea    0x800d7a,%esi
+  800d78:	0f 34                	sysenter
+  800d7a:	5d                   	pop    %ebp
+		goto out;
+  800d7b:	eb dd                	jmp    800d5a <sys_getenvid+0x23>
+
+00800d7d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d7d:	55                   	push   %ebp
+  800d7e:	89 e5                	mov    %esp,%ebp
+  800d80:	57                   	push   %edi
+  800d81:	56                   	push   %esi
+  800d82:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d83:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d8a:	74 19                	je     800da5 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d91:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d96:	89 d1                	mov    %edx,%ecx
+  800d98:	89 d3                	mov    %edx,%ebx
+  800d9a:	89 d7                	mov    %edx,%edi
+  800d9c:	89 d6                	mov    %edx,%esi
+  800d9e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800da5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800daa:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800daf:	89 d1                	mov    %edx,%ecx
+  800db1:	89 d3                	mov    %edx,%ebx
+  800db3:	89 d7                	mov    %edx,%edi
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	8d 35 c0 0d 80 00    	lea    0x800dc0,%esi
+  800dbe:	0f 34                	sysenter
+  800dc0:	5d                   	pop    %ebp
+		goto out;
+  800dc1:	eb dd                	jmp    800da0 <sys_yield+0x23>
+
+00800dc3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	57                   	push   %edi
+  800dc7:	56                   	push   %esi
+  800dc8:	53                   	push   %ebx
+  800dc9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dcc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dd3:	74 23                	je     800df8 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800dd5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dda:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ddf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de8:	89 f7                	mov    %esi,%edi
+  800dea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dec:	85 c0                	test   %eax,%eax
+  800dee:	7f 29                	jg     800e19 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800df0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df3:	5b                   	pop    %ebx
+  800df4:	5e                   	pop    %esi
+  800df5:	5f                   	pop    %edi
+  800df6:	5d                   	pop    %ebp
+  800df7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800df8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfe:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e03:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	8d 35 16 0e 80 00    	lea    0x800e16,%esi
+  800e14:	0f 34                	sysenter
+  800e16:	5d                   	pop    %ebp
+		goto out;
+  800e17:	eb d3                	jmp    800dec <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+  800e1c:	50                   	push   %eax
+  800e1d:	6a 04                	push   $0x4
+  800e1f:	68 8b 2f 80 00       	push   $0x802f8b
+  800e24:	6a 3f                	push   $0x3f
+  800e26:	68 a8 2f 80 00       	push   $0x802fa8
+  800e2b:	e8 78 f3 ff ff       	call   8001a8 <_panic>
+
+00800e30 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	57                   	push   %edi
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+  800e39:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e3c:	85 f6                	test   %esi,%esi
+  800e3e:	75 09                	jne    800e49 <sys_page_map+0x19>
+  800e40:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e47:	74 1f                	je     800e68 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e49:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e57:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e5a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e5c:	85 c0                	test   %eax,%eax
+  800e5e:	7f 27                	jg     800e87 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e63:	5b                   	pop    %ebx
+  800e64:	5e                   	pop    %esi
+  800e65:	5f                   	pop    %edi
+  800e66:	5d                   	pop    %ebp
+  800e67:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e76:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e79:	55                   	push   %ebp
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	8d 35 84 0e 80 00    	lea    0x800e84,%esi
+  800e82:	0f 34                	sysenter
+  800e84:	5d                   	pop    %ebp
+		goto out;
+  800e85:	eb d5                	jmp    800e5c <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e87:	83 ec 0c             	sub    $0xc,%esp
+  800e8a:	50                   	push   %eax
+  800e8b:	6a 05                	push   $0x5
+  800e8d:	68 8b 2f 80 00       	push   $0x802f8b
+  800e92:	6a 3f                	push   $0x3f
+  800e94:	68 a8 2f 80 00       	push   $0x802fa8
+  800e99:	e8 0a f3 ff ff       	call   8001a8 <_panic>
+
+00800e9e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	57                   	push   %edi
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  800ea4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ea7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eae:	74 22                	je     800ed2 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800eb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec0:	89 df                	mov    %ebx,%edi
+  800ec2:	89 de                	mov    %ebx,%esi
+  800ec4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec6:	85 c0                	test   %eax,%eax
+  800ec8:	7f 28                	jg     800ef2 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecd:	5b                   	pop    %ebx
+  800ece:	5e                   	pop    %esi
+  800ecf:	5f                   	pop    %edi
+  800ed0:	5d                   	pop    %ebp
+  800ed1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ee2:	89 df                	mov    %ebx,%edi
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	8d 35 ef 0e 80 00    	lea    0x800eef,%esi
+  800eed:	0f 34                	sysenter
+  800eef:	5d                   	pop    %ebp
+		goto out;
+  800ef0:	eb d4                	jmp    800ec6 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+  800ef5:	50                   	push   %eax
+  800ef6:	6a 06                	push   $0x6
+  800ef8:	68 8b 2f 80 00       	push   $0x802f8b
+  800efd:	6a 3f                	push   $0x3f
+  800eff:	68 a8 2f 80 00       	push   $0x802fa8
+  800f04:	e8 9f f2 ff ff       	call   8001a8 <_panic>
+
+00800f09 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f12:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f19:	74 22                	je     800f3d <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f20:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2b:	89 df                	mov    %ebx,%edi
+  800f2d:	89 de                	mov    %ebx,%esi
+  800f2f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	7f 28                	jg     800f5d <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f38:	5b                   	pop    %ebx
+  800f39:	5e                   	pop    %esi
+  800f3a:	5f                   	pop    %edi
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f48:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f4d:	89 df                	mov    %ebx,%edi
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	8d 35 5a 0f 80 00    	lea    0x800f5a,%esi
+  800f58:	0f 34                	sysenter
+  800f5a:	5d                   	pop    %ebp
+		goto out;
+  800f5b:	eb d4                	jmp    800f31 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5d:	83 ec 0c             	sub    $0xc,%esp
+  800f60:	50                   	push   %eax
+  800f61:	6a 08                	push   $0x8
+  800f63:	68 8b 2f 80 00       	push   $0x802f8b
+  800f68:	6a 3f                	push   $0x3f
+  800f6a:	68 a8 2f 80 00       	push   $0x802fa8
+  800f6f:	e8 34 f2 ff ff       	call   8001a8 <_panic>
+
+00800f74 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f7d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f84:	74 22                	je     800fa8 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f96:	89 df                	mov    %ebx,%edi
+  800f98:	89 de                	mov    %ebx,%esi
+  800f9a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	7f 28                	jg     800fc8 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fb8:	89 df                	mov    %ebx,%edi
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	8d 35 c5 0f 80 00    	lea    0x800fc5,%esi
+  800fc3:	0f 34                	sysenter
+  800fc5:	5d                   	pop    %ebp
+		goto out;
+  800fc6:	eb d4                	jmp    800f9c <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc8:	83 ec 0c             	sub    $0xc,%esp
+  800fcb:	50                   	push   %eax
+  800fcc:	6a 09                	push   $0x9
+  800fce:	68 8b 2f 80 00       	push   $0x802f8b
+  800fd3:	6a 3f                	push   $0x3f
+  800fd5:	68 a8 2f 80 00       	push   $0x802fa8
+  800fda:	e8 c9 f1 ff ff       	call   8001a8 <_panic>
+
+00800fdf <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	57                   	push   %edi
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+  800fe5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fe8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fef:	74 22                	je     801013 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800ff1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	89 df                	mov    %ebx,%edi
+  801003:	89 de                	mov    %ebx,%esi
+  801005:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801007:	85 c0                	test   %eax,%eax
+  801009:	7f 28                	jg     801033 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80100b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5f                   	pop    %edi
+  801011:	5d                   	pop    %ebp
+  801012:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801013:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801018:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801023:	89 df                	mov    %ebx,%edi
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	8d 35 30 10 80 00    	lea    0x801030,%esi
+  80102e:	0f 34                	sysenter
+  801030:	5d                   	pop    %ebp
+		goto out;
+  801031:	eb d4                	jmp    801007 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801033:	83 ec 0c             	sub    $0xc,%esp
+  801036:	50                   	push   %eax
+  801037:	6a 0a                	push   $0xa
+  801039:	68 8b 2f 80 00       	push   $0x802f8b
+  80103e:	6a 3f                	push   $0x3f
+  801040:	68 a8 2f 80 00       	push   $0x802fa8
+  801045:	e8 5e f1 ff ff       	call   8001a8 <_panic>
+
+0080104a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80104a:	55                   	push   %ebp
+  80104b:	89 e5                	mov    %esp,%ebp
+  80104d:	57                   	push   %edi
+  80104e:	56                   	push   %esi
+  80104f:	53                   	push   %ebx
+  801050:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801053:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80105a:	74 22                	je     80107e <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	b8 17 00 00 00       	mov    $0x17,%eax
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	89 de                	mov    %ebx,%esi
+  801070:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801072:	85 c0                	test   %eax,%eax
+  801074:	7f 28                	jg     80109e <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801076:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80107e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 17 00 00 00       	mov    $0x17,%eax
+  80108e:	89 df                	mov    %ebx,%edi
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	8d 35 9b 10 80 00    	lea    0x80109b,%esi
+  801099:	0f 34                	sysenter
+  80109b:	5d                   	pop    %ebp
+		goto out;
+  80109c:	eb d4                	jmp    801072 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109e:	83 ec 0c             	sub    $0xc,%esp
+  8010a1:	50                   	push   %eax
+  8010a2:	6a 17                	push   $0x17
+  8010a4:	68 8b 2f 80 00       	push   $0x802f8b
+  8010a9:	6a 3f                	push   $0x3f
+  8010ab:	68 a8 2f 80 00       	push   $0x802fa8
+  8010b0:	e8 f3 f0 ff ff       	call   8001a8 <_panic>
+
+008010b5 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010be:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010c5:	74 22                	je     8010e9 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cc:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d7:	89 df                	mov    %ebx,%edi
+  8010d9:	89 de                	mov    %ebx,%esi
+  8010db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010dd:	85 c0                	test   %eax,%eax
+  8010df:	7f 28                	jg     801109 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e4:	5b                   	pop    %ebx
+  8010e5:	5e                   	pop    %esi
+  8010e6:	5f                   	pop    %edi
+  8010e7:	5d                   	pop    %ebp
+  8010e8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010f9:	89 df                	mov    %ebx,%edi
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	8d 35 06 11 80 00    	lea    0x801106,%esi
+  801104:	0f 34                	sysenter
+  801106:	5d                   	pop    %ebp
+		goto out;
+  801107:	eb d4                	jmp    8010dd <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801109:	83 ec 0c             	sub    $0xc,%esp
+  80110c:	50                   	push   %eax
+  80110d:	6a 18                	push   $0x18
+  80110f:	68 8b 2f 80 00       	push   $0x802f8b
+  801114:	6a 3f                	push   $0x3f
+  801116:	68 a8 2f 80 00       	push   $0x802fa8
+  80111b:	e8 88 f0 ff ff       	call   8001a8 <_panic>
+
+00801120 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	57                   	push   %edi
+  801124:	56                   	push   %esi
+  801125:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801126:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80112d:	74 1d                	je     80114c <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80112f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801134:	be 00 00 00 00       	mov    $0x0,%esi
+  801139:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801142:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801145:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80114c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801152:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801157:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	8d 35 68 11 80 00    	lea    0x801168,%esi
+  801166:	0f 34                	sysenter
+  801168:	5d                   	pop    %ebp
+		goto out;
+  801169:	eb dc                	jmp    801147 <sys_ipc_try_send+0x27>
+
+0080116b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	57                   	push   %edi
+  80116f:	56                   	push   %esi
+  801170:	53                   	push   %ebx
+  801171:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801174:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80117b:	74 21                	je     80119e <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80117d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801182:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801187:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118a:	89 cb                	mov    %ecx,%ebx
+  80118c:	89 cf                	mov    %ecx,%edi
+  80118e:	89 ce                	mov    %ecx,%esi
+  801190:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801192:	85 c0                	test   %eax,%eax
+  801194:	7f 27                	jg     8011bd <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801196:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801199:	5b                   	pop    %ebx
+  80119a:	5e                   	pop    %esi
+  80119b:	5f                   	pop    %edi
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80119e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ab:	89 cb                	mov    %ecx,%ebx
+  8011ad:	89 cf                	mov    %ecx,%edi
+  8011af:	55                   	push   %ebp
+  8011b0:	89 e5                	mov    %esp,%ebp
+  8011b2:	8d 35 ba 11 80 00    	lea    0x8011ba,%esi
+  8011b8:	0f 34                	sysenter
+  8011ba:	5d                   	pop    %ebp
+		goto out;
+  8011bb:	eb d5                	jmp    801192 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011bd:	83 ec 0c             	sub    $0xc,%esp
+  8011c0:	50                   	push   %eax
+  8011c1:	6a 0d                	push   $0xd
+  8011c3:	68 8b 2f 80 00       	push   $0x802f8b
+  8011c8:	6a 3f                	push   $0x3f
+  8011ca:	68 a8 2f 80 00       	push   $0x802fa8
+  8011cf:	e8 d4 ef ff ff       	call   8001a8 <_panic>
+
+008011d4 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011da:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011e1:	74 1b                	je     8011fe <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f3:	89 df                	mov    %ebx,%edi
+  8011f5:	89 de                	mov    %ebx,%esi
+  8011f7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011f9:	5b                   	pop    %ebx
+  8011fa:	5e                   	pop    %esi
+  8011fb:	5f                   	pop    %edi
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801203:	8b 55 08             	mov    0x8(%ebp),%edx
+  801206:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801209:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80120e:	89 df                	mov    %ebx,%edi
+  801210:	55                   	push   %ebp
+  801211:	89 e5                	mov    %esp,%ebp
+  801213:	8d 35 1b 12 80 00    	lea    0x80121b,%esi
+  801219:	0f 34                	sysenter
+  80121b:	5d                   	pop    %ebp
+		goto out;
+  80121c:	eb db                	jmp    8011f9 <sys_ipc_recv_until+0x25>
+
+0080121e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80121e:	55                   	push   %ebp
+  80121f:	89 e5                	mov    %esp,%ebp
+  801221:	57                   	push   %edi
+  801222:	56                   	push   %esi
+  801223:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801224:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80122b:	74 19                	je     801246 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80122d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801232:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801237:	89 d1                	mov    %edx,%ecx
+  801239:	89 d3                	mov    %edx,%ebx
+  80123b:	89 d7                	mov    %edx,%edi
+  80123d:	89 d6                	mov    %edx,%esi
+  80123f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5f                   	pop    %edi
+  801244:	5d                   	pop    %ebp
+  801245:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801246:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801250:	89 d1                	mov    %edx,%ecx
+  801252:	89 d3                	mov    %edx,%ebx
+  801254:	89 d7                	mov    %edx,%edi
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	8d 35 61 12 80 00    	lea    0x801261,%esi
+  80125f:	0f 34                	sysenter
+  801261:	5d                   	pop    %ebp
+		goto out;
+  801262:	eb dd                	jmp    801241 <sys_time_msec+0x23>
+
+00801264 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80126a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801271:	74 1a                	je     80128d <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801273:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801278:	b8 10 00 00 00       	mov    $0x10,%eax
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	89 cb                	mov    %ecx,%ebx
+  801282:	89 cf                	mov    %ecx,%edi
+  801284:	89 ce                	mov    %ecx,%esi
+  801286:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801288:	5b                   	pop    %ebx
+  801289:	5e                   	pop    %esi
+  80128a:	5f                   	pop    %edi
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801295:	b8 10 00 00 00       	mov    $0x10,%eax
+  80129a:	89 cb                	mov    %ecx,%ebx
+  80129c:	89 cf                	mov    %ecx,%edi
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	8d 35 a9 12 80 00    	lea    0x8012a9,%esi
+  8012a7:	0f 34                	sysenter
+  8012a9:	5d                   	pop    %ebp
+		goto out;
+  8012aa:	eb dc                	jmp    801288 <sys_sleep_until+0x24>
+
+008012ac <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	57                   	push   %edi
+  8012b0:	56                   	push   %esi
+  8012b1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012b2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012b9:	74 1a                	je     8012d5 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8012bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c8:	89 cb                	mov    %ecx,%ebx
+  8012ca:	89 cf                	mov    %ecx,%edi
+  8012cc:	89 ce                	mov    %ecx,%esi
+  8012ce:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012d0:	5b                   	pop    %ebx
+  8012d1:	5e                   	pop    %esi
+  8012d2:	5f                   	pop    %edi
+  8012d3:	5d                   	pop    %ebp
+  8012d4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012dd:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012e2:	89 cb                	mov    %ecx,%ebx
+  8012e4:	89 cf                	mov    %ecx,%edi
+  8012e6:	55                   	push   %ebp
+  8012e7:	89 e5                	mov    %esp,%ebp
+  8012e9:	8d 35 f1 12 80 00    	lea    0x8012f1,%esi
+  8012ef:	0f 34                	sysenter
+  8012f1:	5d                   	pop    %ebp
+		goto out;
+  8012f2:	eb dc                	jmp    8012d0 <sys_env_print_stats+0x24>
+
+008012f4 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012f4:	55                   	push   %ebp
+  8012f5:	89 e5                	mov    %esp,%ebp
+  8012f7:	57                   	push   %edi
+  8012f8:	56                   	push   %esi
+  8012f9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012fa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801301:	74 1b                	je     80131e <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801303:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801308:	b8 19 00 00 00       	mov    $0x19,%eax
+  80130d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801313:	89 df                	mov    %ebx,%edi
+  801315:	89 de                	mov    %ebx,%esi
+  801317:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801319:	5b                   	pop    %ebx
+  80131a:	5e                   	pop    %esi
+  80131b:	5f                   	pop    %edi
+  80131c:	5d                   	pop    %ebp
+  80131d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80131e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801323:	8b 55 08             	mov    0x8(%ebp),%edx
+  801326:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801329:	b8 19 00 00 00       	mov    $0x19,%eax
+  80132e:	89 df                	mov    %ebx,%edi
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	8d 35 3b 13 80 00    	lea    0x80133b,%esi
+  801339:	0f 34                	sysenter
+  80133b:	5d                   	pop    %ebp
+		goto out;
+  80133c:	eb db                	jmp    801319 <sys_perf+0x25>
+
+0080133e <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	57                   	push   %edi
+  801342:	56                   	push   %esi
+  801343:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801344:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80134b:	74 19                	je     801366 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80134d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801352:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801357:	89 d1                	mov    %edx,%ecx
+  801359:	89 d3                	mov    %edx,%ebx
+  80135b:	89 d7                	mov    %edx,%edi
+  80135d:	89 d6                	mov    %edx,%esi
+  80135f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801361:	5b                   	pop    %ebx
+  801362:	5e                   	pop    %esi
+  801363:	5f                   	pop    %edi
+  801364:	5d                   	pop    %ebp
+  801365:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801366:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801370:	89 d1                	mov    %edx,%ecx
+  801372:	89 d3                	mov    %edx,%ebx
+  801374:	89 d7                	mov    %edx,%edi
+  801376:	55                   	push   %ebp
+  801377:	89 e5                	mov    %esp,%ebp
+  801379:	8d 35 81 13 80 00    	lea    0x801381,%esi
+  80137f:	0f 34                	sysenter
+  801381:	5d                   	pop    %ebp
+		goto out;
+  801382:	eb dd                	jmp    801361 <sys_fork+0x23>
+
+00801384 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801384:	55                   	push   %ebp
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	57                   	push   %edi
+  801388:	56                   	push   %esi
+  801389:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80138a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801391:	74 1c                	je     8013af <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801393:	be 00 00 00 00       	mov    $0x0,%esi
+  801398:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80139d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a6:	89 f7                	mov    %esi,%edi
+  8013a8:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013aa:	5b                   	pop    %ebx
+  8013ab:	5e                   	pop    %esi
+  8013ac:	5f                   	pop    %edi
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	8d 35 cd 13 80 00    	lea    0x8013cd,%esi
+  8013cb:	0f 34                	sysenter
+  8013cd:	5d                   	pop    %ebp
+		goto out;
+  8013ce:	eb da                	jmp    8013aa <sys_thread_create+0x26>
+
+008013d0 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013d0:	55                   	push   %ebp
+  8013d1:	89 e5                	mov    %esp,%ebp
+  8013d3:	57                   	push   %edi
+  8013d4:	56                   	push   %esi
+  8013d5:	53                   	push   %ebx
+  8013d6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013d9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013e0:	74 24                	je     801406 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013e2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013fa:	85 c0                	test   %eax,%eax
+  8013fc:	7f 27                	jg     801425 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801401:	5b                   	pop    %ebx
+  801402:	5e                   	pop    %esi
+  801403:	5f                   	pop    %edi
+  801404:	5d                   	pop    %ebp
+  801405:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801406:	8b 55 08             	mov    0x8(%ebp),%edx
+  801409:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801411:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801414:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	8d 35 22 14 80 00    	lea    0x801422,%esi
+  801420:	0f 34                	sysenter
+  801422:	5d                   	pop    %ebp
+		goto out;
+  801423:	eb d5                	jmp    8013fa <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801425:	83 ec 0c             	sub    $0xc,%esp
+  801428:	50                   	push   %eax
+  801429:	6a 1f                	push   $0x1f
+  80142b:	68 8b 2f 80 00       	push   $0x802f8b
+  801430:	6a 3f                	push   $0x3f
+  801432:	68 a8 2f 80 00       	push   $0x802fa8
+  801437:	e8 6c ed ff ff       	call   8001a8 <_panic>
+
+0080143c <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80143c:	55                   	push   %ebp
+  80143d:	89 e5                	mov    %esp,%ebp
+  80143f:	57                   	push   %edi
+  801440:	56                   	push   %esi
+  801441:	53                   	push   %ebx
+  801442:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801445:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80144c:	74 23                	je     801471 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80144e:	be 00 00 00 00       	mov    $0x0,%esi
+  801453:	b8 20 00 00 00       	mov    $0x20,%eax
+  801458:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801461:	89 f7                	mov    %esi,%edi
+  801463:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801465:	85 c0                	test   %eax,%eax
+  801467:	7f 29                	jg     801492 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146c:	5b                   	pop    %ebx
+  80146d:	5e                   	pop    %esi
+  80146e:	5f                   	pop    %edi
+  80146f:	5d                   	pop    %ebp
+  801470:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801471:	8b 55 08             	mov    0x8(%ebp),%edx
+  801474:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801477:	b8 20 00 00 00       	mov    $0x20,%eax
+  80147c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801481:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801484:	55                   	push   %ebp
+  801485:	89 e5                	mov    %esp,%ebp
+  801487:	8d 35 8f 14 80 00    	lea    0x80148f,%esi
+  80148d:	0f 34                	sysenter
+  80148f:	5d                   	pop    %ebp
+		goto out;
+  801490:	eb d3                	jmp    801465 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801492:	83 ec 0c             	sub    $0xc,%esp
+  801495:	50                   	push   %eax
+  801496:	6a 20                	push   $0x20
+  801498:	68 8b 2f 80 00       	push   $0x802f8b
+  80149d:	6a 3f                	push   $0x3f
+  80149f:	68 a8 2f 80 00       	push   $0x802fa8
+  8014a4:	e8 ff ec ff ff       	call   8001a8 <_panic>
+
+008014a9 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014a9:	55                   	push   %ebp
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	57                   	push   %edi
+  8014ad:	56                   	push   %esi
+  8014ae:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014af:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014b6:	74 1b                	je     8014d3 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8014b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c8:	89 df                	mov    %ebx,%edi
+  8014ca:	89 de                	mov    %ebx,%esi
+  8014cc:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014ce:	5b                   	pop    %ebx
+  8014cf:	5e                   	pop    %esi
+  8014d0:	5f                   	pop    %edi
+  8014d1:	5d                   	pop    %ebp
+  8014d2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014de:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014e3:	89 df                	mov    %ebx,%edi
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  8014e8:	8d 35 f0 14 80 00    	lea    0x8014f0,%esi
+  8014ee:	0f 34                	sysenter
+  8014f0:	5d                   	pop    %ebp
+		goto out;
+  8014f1:	eb db                	jmp    8014ce <sys_batch+0x25>
+
+008014f3 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014f3:	55                   	push   %ebp
+  8014f4:	89 e5                	mov    %esp,%ebp
+  8014f6:	57                   	push   %edi
+  8014f7:	56                   	push   %esi
+  8014f8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014f9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801500:	74 1a                	je     80151c <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801502:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801507:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80150c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150f:	89 cb                	mov    %ecx,%ebx
+  801511:	89 cf                	mov    %ecx,%edi
+  801513:	89 ce                	mov    %ecx,%esi
+  801515:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801517:	5b                   	pop    %ebx
+  801518:	5e                   	pop    %esi
+  801519:	5f                   	pop    %edi
+  80151a:	5d                   	pop    %ebp
+  80151b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80151c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801524:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801529:	89 cb                	mov    %ecx,%ebx
+  80152b:	89 cf                	mov    %ecx,%edi
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	8d 35 38 15 80 00    	lea    0x801538,%esi
+  801536:	0f 34                	sysenter
+  801538:	5d                   	pop    %ebp
+		goto out;
+  801539:	eb dc                	jmp    801517 <sys_trace_ctl+0x24>
+
+0080153b <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80153b:	55                   	push   %ebp
+  80153c:	89 e5                	mov    %esp,%ebp
+  80153e:	57                   	push   %edi
+  80153f:	56                   	push   %esi
+  801540:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801541:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801548:	74 1c                	je     801566 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80154a:	be 00 00 00 00       	mov    $0x0,%esi
+  80154f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801554:	8b 55 08             	mov    0x8(%ebp),%edx
+  801557:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80155d:	89 f7                	mov    %esi,%edi
+  80155f:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801561:	5b                   	pop    %ebx
+  801562:	5e                   	pop    %esi
+  801563:	5f                   	pop    %edi
+  801564:	5d                   	pop    %ebp
+  801565:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801566:	8b 55 08             	mov    0x8(%ebp),%edx
+  801569:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801571:	bf 00 00 00 00       	mov    $0x0,%edi
+  801576:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801579:	55                   	push   %ebp
+  80157a:	89 e5                	mov    %esp,%ebp
+  80157c:	8d 35 84 15 80 00    	lea    0x801584,%esi
+  801582:	0f 34                	sysenter
+  801584:	5d                   	pop    %ebp
+		goto out;
+  801585:	eb da                	jmp    801561 <sys_trace_read+0x26>
+
+00801587 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	57                   	push   %edi
+  80158b:	56                   	push   %esi
+  80158c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80158d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801594:	74 1c                	je     8015b2 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801596:	be 00 00 00 00       	mov    $0x0,%esi
+  80159b:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a9:	89 f7                	mov    %esi,%edi
+  8015ab:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015ad:	5b                   	pop    %ebx
+  8015ae:	5e                   	pop    %esi
+  8015af:	5f                   	pop    %edi
+  8015b0:	5d                   	pop    %ebp
+  8015b1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b8:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	8d 35 d0 15 80 00    	lea    0x8015d0,%esi
+  8015ce:	0f 34                	sysenter
+  8015d0:	5d                   	pop    %ebp
+		goto out;
+  8015d1:	eb da                	jmp    8015ad <sys_meminfo+0x26>
+
+008015d3 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015d3:	55                   	push   %ebp
+  8015d4:	89 e5                	mov    %esp,%ebp
+  8015d6:	57                   	push   %edi
+  8015d7:	56                   	push   %esi
+  8015d8:	53                   	push   %ebx
+  8015d9:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015dc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015e0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015e7:	74 1f                	je     801608 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ee:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f6:	89 df                	mov    %ebx,%edi
+  8015f8:	89 de                	mov    %ebx,%esi
+  8015fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	7f 25                	jg     801625 <sys_env_set_ksm+0x52>
+}
+  801600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801603:	5b                   	pop    %ebx
+  801604:	5e                   	pop    %esi
+  801605:	5f                   	pop    %edi
+  801606:	5d                   	pop    %ebp
+  801607:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801608:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801610:	b8 22 00 00 00       	mov    $0x22,%eax
+  801615:	89 df                	mov    %ebx,%edi
+  801617:	55                   	push   %ebp
+  801618:	89 e5                	mov    %esp,%ebp
+  80161a:	8d 35 22 16 80 00    	lea    0x801622,%esi
+  801620:	0f 34                	sysenter
+  801622:	5d                   	pop    %ebp
+		goto out;
+  801623:	eb d7                	jmp    8015fc <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801625:	83 ec 0c             	sub    $0xc,%esp
+  801628:	50                   	push   %eax
+  801629:	6a 22                	push   $0x22
+  80162b:	68 8b 2f 80 00       	push   $0x802f8b
+  801630:	6a 3f                	push   $0x3f
+  801632:	68 a8 2f 80 00       	push   $0x802fa8
+  801637:	e8 6c eb ff ff       	call   8001a8 <_panic>
+
+0080163c <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80163c:	55                   	push   %ebp
+  80163d:	89 e5                	mov    %esp,%ebp
+  80163f:	57                   	push   %edi
+  801640:	56                   	push   %esi
+  801641:	53                   	push   %ebx
+  801642:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801645:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801648:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80164f:	74 24                	je     801675 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801651:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801656:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80165b:	89 cb                	mov    %ecx,%ebx
+  80165d:	89 cf                	mov    %ecx,%edi
+  80165f:	89 ce                	mov    %ecx,%esi
+  801661:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801663:	85 c0                	test   %eax,%eax
+  801665:	7f 2a                	jg     801691 <sys_time_nsec+0x55>
+	return ns;
+}
+  801667:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80166a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80166d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801670:	5b                   	pop    %ebx
+  801671:	5e                   	pop    %esi
+  801672:	5f                   	pop    %edi
+  801673:	5d                   	pop    %ebp
+  801674:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801675:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80167a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80167f:	89 cb                	mov    %ecx,%ebx
+  801681:	89 cf                	mov    %ecx,%edi
+  801683:	55                   	push   %ebp
+  801684:	89 e5                	mov    %esp,%ebp
+  801686:	8d 35 8e 16 80 00    	lea    0x80168e,%esi
+  80168c:	0f 34                	sysenter
+  80168e:	5d                   	pop    %ebp
+		goto out;
+  80168f:	eb d2                	jmp    801663 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801691:	83 ec 0c             	sub    $0xc,%esp
+  801694:	50                   	push   %eax
+  801695:	6a 0f                	push   $0xf
+  801697:	68 8b 2f 80 00       	push   $0x802f8b
+  80169c:	6a 3f                	push   $0x3f
+  80169e:	68 a8 2f 80 00       	push   $0x802fa8
+  8016a3:	e8 00 eb ff ff       	call   8001a8 <_panic>
+
+008016a8 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016a8:	55                   	push   %ebp
+  8016a9:	89 e5                	mov    %esp,%ebp
+  8016ab:	57                   	push   %edi
+  8016ac:	56                   	push   %esi
+  8016ad:	53                   	push   %ebx
+  8016ae:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016b1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016b8:	74 22                	je     8016dc <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8016ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ca:	89 df                	mov    %ebx,%edi
+  8016cc:	89 de                	mov    %ebx,%esi
+  8016ce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016d0:	85 c0                	test   %eax,%eax
+  8016d2:	7f 28                	jg     8016fc <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d7:	5b                   	pop    %ebx
+  8016d8:	5e                   	pop    %esi
+  8016d9:	5f                   	pop    %edi
+  8016da:	5d                   	pop    %ebp
+  8016db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016ec:	89 df                	mov    %ebx,%edi
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	8d 35 f9 16 80 00    	lea    0x8016f9,%esi
+  8016f7:	0f 34                	sysenter
+  8016f9:	5d                   	pop    %ebp
+		goto out;
+  8016fa:	eb d4                	jmp    8016d0 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016fc:	83 ec 0c             	sub    $0xc,%esp
+  8016ff:	50                   	push   %eax
+  801700:	6a 12                	push   $0x12
+  801702:	68 8b 2f 80 00       	push   $0x802f8b
+  801707:	6a 3f                	push   $0x3f
+  801709:	68 a8 2f 80 00       	push   $0x802fa8
+  80170e:	e8 95 ea ff ff       	call   8001a8 <_panic>
+
+00801713 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	57                   	push   %edi
+  801717:	56                   	push   %esi
+  801718:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801719:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801720:	74 1b                	je     80173d <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801722:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801727:	b8 13 00 00 00       	mov    $0x13,%eax
+  80172c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801732:	89 df                	mov    %ebx,%edi
+  801734:	89 de                	mov    %ebx,%esi
+  801736:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801738:	5b                   	pop    %ebx
+  801739:	5e                   	pop    %esi
+  80173a:	5f                   	pop    %edi
+  80173b:	5d                   	pop    %ebp
+  80173c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80173d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801742:	8b 55 08             	mov    0x8(%ebp),%edx
+  801745:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801748:	b8 13 00 00 00       	mov    $0x13,%eax
+  80174d:	89 df                	mov    %ebx,%edi
+  80174f:	55                   	push   %ebp
+  801750:	89 e5                	mov    %esp,%ebp
+  801752:	8d 35 5a 17 80 00    	lea    0x80175a,%esi
+  801758:	0f 34                	sysenter
+  80175a:	5d                   	pop    %ebp
+		goto out;
+  80175b:	eb db                	jmp    801738 <sys_e1000_receive+0x25>
+
+0080175d <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80175d:	55                   	push   %ebp
+  80175e:	89 e5                	mov    %esp,%ebp
+  801760:	57                   	push   %edi
+  801761:	56                   	push   %esi
+  801762:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801763:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80176a:	74 1b                	je     801787 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80176c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801771:	b8 14 00 00 00       	mov    $0x14,%eax
+  801776:	8b 55 08             	mov    0x8(%ebp),%edx
+  801779:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177c:	89 df                	mov    %ebx,%edi
+  80177e:	89 de                	mov    %ebx,%esi
+  801780:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801782:	5b                   	pop    %ebx
+  801783:	5e                   	pop    %esi
+  801784:	5f                   	pop    %edi
+  801785:	5d                   	pop    %ebp
+  801786:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801787:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801792:	b8 14 00 00 00       	mov    $0x14,%eax
+  801797:	89 df                	mov    %ebx,%edi
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	8d 35 a4 17 80 00    	lea    0x8017a4,%esi
+  8017a2:	0f 34                	sysenter
+  8017a4:	5d                   	pop    %ebp
+		goto out;
+  8017a5:	eb db                	jmp    801782 <sys_e1000_read_hwaddr+0x25>
+
+008017a7 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	57                   	push   %edi
+  8017ab:	56                   	push   %esi
+  8017ac:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ad:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017b4:	74 1a                	je     8017d0 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8017b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017bb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c3:	89 cb                	mov    %ecx,%ebx
+  8017c5:	89 cf                	mov    %ecx,%edi
+  8017c7:	89 ce                	mov    %ecx,%esi
+  8017c9:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017cb:	5b                   	pop    %ebx
+  8017cc:	5e                   	pop    %esi
+  8017cd:	5f                   	pop    %edi
+  8017ce:	5d                   	pop    %ebp
+  8017cf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017d8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017dd:	89 cb                	mov    %ecx,%ebx
+  8017df:	89 cf                	mov    %ecx,%edi
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	8d 35 ec 17 80 00    	lea    0x8017ec,%esi
+  8017ea:	0f 34                	sysenter
+  8017ec:	5d                   	pop    %ebp
+		goto out;
+  8017ed:	eb dc                	jmp    8017cb <sys_sb16_read_version+0x24>
+
+008017ef <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017ef:	55                   	push   %ebp
+  8017f0:	89 e5                	mov    %esp,%ebp
+  8017f2:	57                   	push   %edi
+  8017f3:	56                   	push   %esi
+  8017f4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017fc:	74 1b                	je     801819 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801803:	b8 16 00 00 00       	mov    $0x16,%eax
+  801808:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80180e:	89 df                	mov    %ebx,%edi
+  801810:	89 de                	mov    %ebx,%esi
+  801812:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801814:	5b                   	pop    %ebx
+  801815:	5e                   	pop    %esi
+  801816:	5f                   	pop    %edi
+  801817:	5d                   	pop    %ebp
+  801818:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801819:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801821:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801824:	b8 16 00 00 00       	mov    $0x16,%eax
+  801829:	89 df                	mov    %ebx,%edi
+  80182b:	55                   	push   %ebp
+  80182c:	89 e5                	mov    %esp,%ebp
+  80182e:	8d 35 36 18 80 00    	lea    0x801836,%esi
+  801834:	0f 34                	sysenter
+  801836:	5d                   	pop    %ebp
+		goto out;
+  801837:	eb db                	jmp    801814 <sys_sb16_play+0x25>
+
+00801839 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801839:	55                   	push   %ebp
+  80183a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80183c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80183f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801844:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801847:	5d                   	pop    %ebp
+  801848:	c3                   	ret
+
+00801849 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801849:	55                   	push   %ebp
+  80184a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80184c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80184f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801854:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801859:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80185e:	5d                   	pop    %ebp
+  80185f:	c3                   	ret
+
+00801860 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801860:	55                   	push   %ebp
+  801861:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801863:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801868:	eb 02                	jmp    80186c <fd_alloc+0xc>
+  80186a:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80186c:	89 c2                	mov    %eax,%edx
+  80186e:	c1 ea 16             	shr    $0x16,%edx
+  801871:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801878:	f6 c2 01             	test   $0x1,%dl
+  80187b:	74 2b                	je     8018a8 <fd_alloc+0x48>
+  80187d:	89 c2                	mov    %eax,%edx
+  80187f:	c1 ea 0c             	shr    $0xc,%edx
+  801882:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801889:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80188f:	f6 c1 01             	test   $0x1,%cl
+  801892:	74 14                	je     8018a8 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801894:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80189a:	75 ce                	jne    80186a <fd_alloc+0xa>
+  80189c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018a1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018a6:	eb 05                	jmp    8018ad <fd_alloc+0x4d>
+			return 0;
+  8018a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b0:	89 02                	mov    %eax,(%edx)
+}
+  8018b2:	89 c8                	mov    %ecx,%eax
+  8018b4:	5d                   	pop    %ebp
+  8018b5:	c3                   	ret
+
+008018b6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018b6:	55                   	push   %ebp
+  8018b7:	89 e5                	mov    %esp,%ebp
+  8018b9:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018bc:	83 f8 1f             	cmp    $0x1f,%eax
+  8018bf:	77 30                	ja     8018f1 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018c1:	c1 e0 0c             	shl    $0xc,%eax
+  8018c4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018c9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018cf:	f6 c2 01             	test   $0x1,%dl
+  8018d2:	74 24                	je     8018f8 <fd_lookup+0x42>
+  8018d4:	89 c2                	mov    %eax,%edx
+  8018d6:	c1 ea 0c             	shr    $0xc,%edx
+  8018d9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018e0:	f6 c2 01             	test   $0x1,%dl
+  8018e3:	74 1a                	je     8018ff <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018e8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018ef:	5d                   	pop    %ebp
+  8018f0:	c3                   	ret
+		return -E_INVAL;
+  8018f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018f6:	eb f7                	jmp    8018ef <fd_lookup+0x39>
+		return -E_INVAL;
+  8018f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018fd:	eb f0                	jmp    8018ef <fd_lookup+0x39>
+  8018ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801904:	eb e9                	jmp    8018ef <fd_lookup+0x39>
+
+00801906 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801906:	55                   	push   %ebp
+  801907:	89 e5                	mov    %esp,%ebp
+  801909:	53                   	push   %ebx
+  80190a:	83 ec 04             	sub    $0x4,%esp
+  80190d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801910:	b8 00 00 00 00       	mov    $0x0,%eax
+  801915:	eb 03                	jmp    80191a <dev_lookup+0x14>
+  801917:	83 c0 01             	add    $0x1,%eax
+  80191a:	8b 1c 85 34 30 80 00 	mov    0x803034(,%eax,4),%ebx
+  801921:	85 db                	test   %ebx,%ebx
+  801923:	74 0b                	je     801930 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801925:	39 13                	cmp    %edx,(%ebx)
+  801927:	75 ee                	jne    801917 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192e:	eb 2e                	jmp    80195e <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801930:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801932:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801937:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80193d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801942:	76 24                	jbe    801968 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801944:	8b 41 48             	mov    0x48(%ecx),%eax
+  801947:	83 ec 04             	sub    $0x4,%esp
+  80194a:	52                   	push   %edx
+  80194b:	50                   	push   %eax
+  80194c:	68 b8 2f 80 00       	push   $0x802fb8
+  801951:	e8 2d e9 ff ff       	call   800283 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801956:	83 c4 10             	add    $0x10,%esp
+  801959:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80195e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801961:	89 1a                	mov    %ebx,(%edx)
+}
+  801963:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801968:	c1 e8 10             	shr    $0x10,%eax
+  80196b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801971:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801977:	eb cb                	jmp    801944 <dev_lookup+0x3e>
+
+00801979 <fd_close>:
+{
+  801979:	55                   	push   %ebp
+  80197a:	89 e5                	mov    %esp,%ebp
+  80197c:	57                   	push   %edi
+  80197d:	56                   	push   %esi
+  80197e:	53                   	push   %ebx
+  80197f:	83 ec 24             	sub    $0x24,%esp
+  801982:	8b 75 08             	mov    0x8(%ebp),%esi
+  801985:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801988:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80198b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80198c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801992:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801995:	50                   	push   %eax
+  801996:	e8 1b ff ff ff       	call   8018b6 <fd_lookup>
+  80199b:	89 c3                	mov    %eax,%ebx
+  80199d:	83 c4 10             	add    $0x10,%esp
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	78 05                	js     8019a9 <fd_close+0x30>
+	    || fd != fd2)
+  8019a4:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019a7:	74 16                	je     8019bf <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019a9:	89 f8                	mov    %edi,%eax
+  8019ab:	84 c0                	test   %al,%al
+  8019ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b2:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019b5:	89 d8                	mov    %ebx,%eax
+  8019b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ba:	5b                   	pop    %ebx
+  8019bb:	5e                   	pop    %esi
+  8019bc:	5f                   	pop    %edi
+  8019bd:	5d                   	pop    %ebp
+  8019be:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019bf:	83 ec 08             	sub    $0x8,%esp
+  8019c2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019c5:	50                   	push   %eax
+  8019c6:	ff 36                	push   (%esi)
+  8019c8:	e8 39 ff ff ff       	call   801906 <dev_lookup>
+  8019cd:	89 c3                	mov    %eax,%ebx
+  8019cf:	83 c4 10             	add    $0x10,%esp
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	78 1a                	js     8019f0 <fd_close+0x77>
+		if (dev->dev_close)
+  8019d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019d9:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019e1:	85 c0                	test   %eax,%eax
+  8019e3:	74 0b                	je     8019f0 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8019e5:	83 ec 0c             	sub    $0xc,%esp
+  8019e8:	56                   	push   %esi
+  8019e9:	ff d0                	call   *%eax
+  8019eb:	89 c3                	mov    %eax,%ebx
+  8019ed:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8019f0:	83 ec 08             	sub    $0x8,%esp
+  8019f3:	56                   	push   %esi
+  8019f4:	6a 00                	push   $0x0
+  8019f6:	e8 a3 f4 ff ff       	call   800e9e <sys_page_unmap>
+	return r;
+  8019fb:	83 c4 10             	add    $0x10,%esp
+  8019fe:	eb b5                	jmp    8019b5 <fd_close+0x3c>
+
+00801a00 <close>:
+
+int
+close(int fdnum)
+{
+  801a00:	55                   	push   %ebp
+  801a01:	89 e5                	mov    %esp,%ebp
+  801a03:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a09:	50                   	push   %eax
+  801a0a:	ff 75 08             	push   0x8(%ebp)
+  801a0d:	e8 a4 fe ff ff       	call   8018b6 <fd_lookup>
+  801a12:	83 c4 10             	add    $0x10,%esp
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	79 02                	jns    801a1b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a19:	c9                   	leave
+  801a1a:	c3                   	ret
+		return fd_close(fd, 1);
+  801a1b:	83 ec 08             	sub    $0x8,%esp
+  801a1e:	6a 01                	push   $0x1
+  801a20:	ff 75 f4             	push   -0xc(%ebp)
+  801a23:	e8 51 ff ff ff       	call   801979 <fd_close>
+  801a28:	83 c4 10             	add    $0x10,%esp
+  801a2b:	eb ec                	jmp    801a19 <close+0x19>
+
+00801a2d <close_all>:
+
+void
+close_all(void)
+{
+  801a2d:	55                   	push   %ebp
+  801a2e:	89 e5                	mov    %esp,%ebp
+  801a30:	53                   	push   %ebx
+  801a31:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a34:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a39:	83 ec 0c             	sub    $0xc,%esp
+  801a3c:	53                   	push   %ebx
+  801a3d:	e8 be ff ff ff       	call   801a00 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a42:	83 c3 01             	add    $0x1,%ebx
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	83 fb 20             	cmp    $0x20,%ebx
+  801a4b:	75 ec                	jne    801a39 <close_all+0xc>
+}
+  801a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a50:	c9                   	leave
+  801a51:	c3                   	ret
+
+00801a52 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a52:	55                   	push   %ebp
+  801a53:	89 e5                	mov    %esp,%ebp
+  801a55:	57                   	push   %edi
+  801a56:	56                   	push   %esi
+  801a57:	53                   	push   %ebx
+  801a58:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a5b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a5e:	50                   	push   %eax
+  801a5f:	ff 75 08             	push   0x8(%ebp)
+  801a62:	e8 4f fe ff ff       	call   8018b6 <fd_lookup>
+  801a67:	89 c3                	mov    %eax,%ebx
+  801a69:	83 c4 10             	add    $0x10,%esp
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	78 7f                	js     801aef <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a70:	83 ec 0c             	sub    $0xc,%esp
+  801a73:	ff 75 0c             	push   0xc(%ebp)
+  801a76:	e8 85 ff ff ff       	call   801a00 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a7b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a7e:	c1 e6 0c             	shl    $0xc,%esi
+  801a81:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a87:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a8a:	89 3c 24             	mov    %edi,(%esp)
+  801a8d:	e8 b7 fd ff ff       	call   801849 <fd2data>
+  801a92:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a94:	89 34 24             	mov    %esi,(%esp)
+  801a97:	e8 ad fd ff ff       	call   801849 <fd2data>
+  801a9c:	83 c4 10             	add    $0x10,%esp
+  801a9f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801aa2:	89 d8                	mov    %ebx,%eax
+  801aa4:	c1 e8 16             	shr    $0x16,%eax
+  801aa7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801aae:	a8 01                	test   $0x1,%al
+  801ab0:	74 11                	je     801ac3 <dup+0x71>
+  801ab2:	89 d8                	mov    %ebx,%eax
+  801ab4:	c1 e8 0c             	shr    $0xc,%eax
+  801ab7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801abe:	f6 c2 01             	test   $0x1,%dl
+  801ac1:	75 36                	jne    801af9 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ac3:	89 f8                	mov    %edi,%eax
+  801ac5:	c1 e8 0c             	shr    $0xc,%eax
+  801ac8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801acf:	83 ec 0c             	sub    $0xc,%esp
+  801ad2:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ad7:	50                   	push   %eax
+  801ad8:	56                   	push   %esi
+  801ad9:	6a 00                	push   $0x0
+  801adb:	57                   	push   %edi
+  801adc:	6a 00                	push   $0x0
+  801ade:	e8 4d f3 ff ff       	call   800e30 <sys_page_map>
+  801ae3:	89 c3                	mov    %eax,%ebx
+  801ae5:	83 c4 20             	add    $0x20,%esp
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 33                	js     801b1f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801aec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801aef:	89 d8                	mov    %ebx,%eax
+  801af1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af4:	5b                   	pop    %ebx
+  801af5:	5e                   	pop    %esi
+  801af6:	5f                   	pop    %edi
+  801af7:	5d                   	pop    %ebp
+  801af8:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801af9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b00:	83 ec 0c             	sub    $0xc,%esp
+  801b03:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b08:	50                   	push   %eax
+  801b09:	ff 75 d4             	push   -0x2c(%ebp)
+  801b0c:	6a 00                	push   $0x0
+  801b0e:	53                   	push   %ebx
+  801b0f:	6a 00                	push   $0x0
+  801b11:	e8 1a f3 ff ff       	call   800e30 <sys_page_map>
+  801b16:	89 c3                	mov    %eax,%ebx
+  801b18:	83 c4 20             	add    $0x20,%esp
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	79 a4                	jns    801ac3 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b1f:	83 ec 08             	sub    $0x8,%esp
+  801b22:	56                   	push   %esi
+  801b23:	6a 00                	push   $0x0
+  801b25:	e8 74 f3 ff ff       	call   800e9e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b2a:	83 c4 08             	add    $0x8,%esp
+  801b2d:	ff 75 d4             	push   -0x2c(%ebp)
+  801b30:	6a 00                	push   $0x0
+  801b32:	e8 67 f3 ff ff       	call   800e9e <sys_page_unmap>
+	return r;
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	eb b3                	jmp    801aef <dup+0x9d>
+
+00801b3c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b3c:	55                   	push   %ebp
+  801b3d:	89 e5                	mov    %esp,%ebp
+  801b3f:	56                   	push   %esi
+  801b40:	53                   	push   %ebx
+  801b41:	83 ec 18             	sub    $0x18,%esp
+  801b44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b47:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b4a:	50                   	push   %eax
+  801b4b:	53                   	push   %ebx
+  801b4c:	e8 65 fd ff ff       	call   8018b6 <fd_lookup>
+  801b51:	83 c4 10             	add    $0x10,%esp
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 3c                	js     801b94 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b58:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b5b:	83 ec 08             	sub    $0x8,%esp
+  801b5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b61:	50                   	push   %eax
+  801b62:	ff 36                	push   (%esi)
+  801b64:	e8 9d fd ff ff       	call   801906 <dev_lookup>
+  801b69:	83 c4 10             	add    $0x10,%esp
+  801b6c:	85 c0                	test   %eax,%eax
+  801b6e:	78 24                	js     801b94 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b70:	8b 46 08             	mov    0x8(%esi),%eax
+  801b73:	83 e0 03             	and    $0x3,%eax
+  801b76:	83 f8 01             	cmp    $0x1,%eax
+  801b79:	74 20                	je     801b9b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b7e:	8b 40 08             	mov    0x8(%eax),%eax
+  801b81:	85 c0                	test   %eax,%eax
+  801b83:	74 57                	je     801bdc <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b85:	83 ec 04             	sub    $0x4,%esp
+  801b88:	ff 75 10             	push   0x10(%ebp)
+  801b8b:	ff 75 0c             	push   0xc(%ebp)
+  801b8e:	56                   	push   %esi
+  801b8f:	ff d0                	call   *%eax
+  801b91:	83 c4 10             	add    $0x10,%esp
+}
+  801b94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b97:	5b                   	pop    %ebx
+  801b98:	5e                   	pop    %esi
+  801b99:	5d                   	pop    %ebp
+  801b9a:	c3                   	ret
+  801b9b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b9d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ba2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ba8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bad:	76 1c                	jbe    801bcb <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801baf:	8b 42 48             	mov    0x48(%edx),%eax
+  801bb2:	83 ec 04             	sub    $0x4,%esp
+  801bb5:	53                   	push   %ebx
+  801bb6:	50                   	push   %eax
+  801bb7:	68 f9 2f 80 00       	push   $0x802ff9
+  801bbc:	e8 c2 e6 ff ff       	call   800283 <cprintf>
+		return -E_INVAL;
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bc9:	eb c9                	jmp    801b94 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801bcb:	c1 e8 10             	shr    $0x10,%eax
+  801bce:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801bd4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801bda:	eb d3                	jmp    801baf <read+0x73>
+		return -E_NOT_SUPP;
+  801bdc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801be1:	eb b1                	jmp    801b94 <read+0x58>
+
+00801be3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801be3:	55                   	push   %ebp
+  801be4:	89 e5                	mov    %esp,%ebp
+  801be6:	57                   	push   %edi
+  801be7:	56                   	push   %esi
+  801be8:	53                   	push   %ebx
+  801be9:	83 ec 0c             	sub    $0xc,%esp
+  801bec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801bef:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801bf2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf7:	eb 02                	jmp    801bfb <readn+0x18>
+  801bf9:	01 c3                	add    %eax,%ebx
+  801bfb:	39 f3                	cmp    %esi,%ebx
+  801bfd:	73 21                	jae    801c20 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bff:	83 ec 04             	sub    $0x4,%esp
+  801c02:	89 f0                	mov    %esi,%eax
+  801c04:	29 d8                	sub    %ebx,%eax
+  801c06:	50                   	push   %eax
+  801c07:	89 d8                	mov    %ebx,%eax
+  801c09:	03 45 0c             	add    0xc(%ebp),%eax
+  801c0c:	50                   	push   %eax
+  801c0d:	57                   	push   %edi
+  801c0e:	e8 29 ff ff ff       	call   801b3c <read>
+		if (m < 0)
+  801c13:	83 c4 10             	add    $0x10,%esp
+  801c16:	85 c0                	test   %eax,%eax
+  801c18:	78 04                	js     801c1e <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c1a:	75 dd                	jne    801bf9 <readn+0x16>
+  801c1c:	eb 02                	jmp    801c20 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c1e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c20:	89 d8                	mov    %ebx,%eax
+  801c22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c25:	5b                   	pop    %ebx
+  801c26:	5e                   	pop    %esi
+  801c27:	5f                   	pop    %edi
+  801c28:	5d                   	pop    %ebp
+  801c29:	c3                   	ret
+
+00801c2a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c2a:	55                   	push   %ebp
+  801c2b:	89 e5                	mov    %esp,%ebp
+  801c2d:	56                   	push   %esi
+  801c2e:	53                   	push   %ebx
+  801c2f:	83 ec 18             	sub    $0x18,%esp
+  801c32:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c35:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c38:	50                   	push   %eax
+  801c39:	53                   	push   %ebx
+  801c3a:	e8 77 fc ff ff       	call   8018b6 <fd_lookup>
+  801c3f:	83 c4 10             	add    $0x10,%esp
+  801c42:	85 c0                	test   %eax,%eax
+  801c44:	78 37                	js     801c7d <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c46:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c49:	83 ec 08             	sub    $0x8,%esp
+  801c4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c4f:	50                   	push   %eax
+  801c50:	ff 36                	push   (%esi)
+  801c52:	e8 af fc ff ff       	call   801906 <dev_lookup>
+  801c57:	83 c4 10             	add    $0x10,%esp
+  801c5a:	85 c0                	test   %eax,%eax
+  801c5c:	78 1f                	js     801c7d <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c5e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c62:	74 20                	je     801c84 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c67:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c6a:	85 c0                	test   %eax,%eax
+  801c6c:	74 57                	je     801cc5 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c6e:	83 ec 04             	sub    $0x4,%esp
+  801c71:	ff 75 10             	push   0x10(%ebp)
+  801c74:	ff 75 0c             	push   0xc(%ebp)
+  801c77:	56                   	push   %esi
+  801c78:	ff d0                	call   *%eax
+  801c7a:	83 c4 10             	add    $0x10,%esp
+}
+  801c7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c80:	5b                   	pop    %ebx
+  801c81:	5e                   	pop    %esi
+  801c82:	5d                   	pop    %ebp
+  801c83:	c3                   	ret
+  801c84:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c86:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c8b:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c91:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c96:	76 1c                	jbe    801cb4 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c98:	8b 42 48             	mov    0x48(%edx),%eax
+  801c9b:	83 ec 04             	sub    $0x4,%esp
+  801c9e:	53                   	push   %ebx
+  801c9f:	50                   	push   %eax
+  801ca0:	68 15 30 80 00       	push   $0x803015
+  801ca5:	e8 d9 e5 ff ff       	call   800283 <cprintf>
+		return -E_INVAL;
+  801caa:	83 c4 10             	add    $0x10,%esp
+  801cad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cb2:	eb c9                	jmp    801c7d <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cb4:	c1 e8 10             	shr    $0x10,%eax
+  801cb7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cbd:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cc3:	eb d3                	jmp    801c98 <write+0x6e>
+		return -E_NOT_SUPP;
+  801cc5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cca:	eb b1                	jmp    801c7d <write+0x53>
+
+00801ccc <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd5:	50                   	push   %eax
+  801cd6:	ff 75 08             	push   0x8(%ebp)
+  801cd9:	e8 d8 fb ff ff       	call   8018b6 <fd_lookup>
+  801cde:	83 c4 10             	add    $0x10,%esp
+  801ce1:	85 c0                	test   %eax,%eax
+  801ce3:	78 0e                	js     801cf3 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801ce5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ce8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ceb:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801cee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cf3:	c9                   	leave
+  801cf4:	c3                   	ret
+
+00801cf5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801cf5:	55                   	push   %ebp
+  801cf6:	89 e5                	mov    %esp,%ebp
+  801cf8:	56                   	push   %esi
+  801cf9:	53                   	push   %ebx
+  801cfa:	83 ec 18             	sub    $0x18,%esp
+  801cfd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d00:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d03:	50                   	push   %eax
+  801d04:	53                   	push   %ebx
+  801d05:	e8 ac fb ff ff       	call   8018b6 <fd_lookup>
+  801d0a:	83 c4 10             	add    $0x10,%esp
+  801d0d:	85 c0                	test   %eax,%eax
+  801d0f:	78 34                	js     801d45 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d11:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d14:	83 ec 08             	sub    $0x8,%esp
+  801d17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d1a:	50                   	push   %eax
+  801d1b:	ff 36                	push   (%esi)
+  801d1d:	e8 e4 fb ff ff       	call   801906 <dev_lookup>
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 1c                	js     801d45 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d29:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d2d:	74 1d                	je     801d4c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d32:	8b 40 18             	mov    0x18(%eax),%eax
+  801d35:	85 c0                	test   %eax,%eax
+  801d37:	74 54                	je     801d8d <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d39:	83 ec 08             	sub    $0x8,%esp
+  801d3c:	ff 75 0c             	push   0xc(%ebp)
+  801d3f:	56                   	push   %esi
+  801d40:	ff d0                	call   *%eax
+  801d42:	83 c4 10             	add    $0x10,%esp
+}
+  801d45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d48:	5b                   	pop    %ebx
+  801d49:	5e                   	pop    %esi
+  801d4a:	5d                   	pop    %ebp
+  801d4b:	c3                   	ret
+  801d4c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d4e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d53:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d59:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d5e:	76 1c                	jbe    801d7c <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801d60:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d63:	83 ec 04             	sub    $0x4,%esp
+  801d66:	53                   	push   %ebx
+  801d67:	50                   	push   %eax
+  801d68:	68 d8 2f 80 00       	push   $0x802fd8
+  801d6d:	e8 11 e5 ff ff       	call   800283 <cprintf>
+		return -E_INVAL;
+  801d72:	83 c4 10             	add    $0x10,%esp
+  801d75:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d7a:	eb c9                	jmp    801d45 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d7c:	c1 e8 10             	shr    $0x10,%eax
+  801d7f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d85:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d8b:	eb d3                	jmp    801d60 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801d8d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d92:	eb b1                	jmp    801d45 <ftruncate+0x50>
+
+00801d94 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d94:	55                   	push   %ebp
+  801d95:	89 e5                	mov    %esp,%ebp
+  801d97:	56                   	push   %esi
+  801d98:	53                   	push   %ebx
+  801d99:	83 ec 18             	sub    $0x18,%esp
+  801d9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d9f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801da2:	50                   	push   %eax
+  801da3:	ff 75 08             	push   0x8(%ebp)
+  801da6:	e8 0b fb ff ff       	call   8018b6 <fd_lookup>
+  801dab:	83 c4 10             	add    $0x10,%esp
+  801dae:	85 c0                	test   %eax,%eax
+  801db0:	78 49                	js     801dfb <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801db2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801db5:	83 ec 08             	sub    $0x8,%esp
+  801db8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dbb:	50                   	push   %eax
+  801dbc:	ff 36                	push   (%esi)
+  801dbe:	e8 43 fb ff ff       	call   801906 <dev_lookup>
+  801dc3:	83 c4 10             	add    $0x10,%esp
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	78 31                	js     801dfb <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801dca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dcd:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dd1:	74 2f                	je     801e02 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801dd3:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801dd6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ddd:	00 00 00 
+	stat->st_isdir = 0;
+  801de0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801de7:	00 00 00 
+	stat->st_dev = dev;
+  801dea:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801df0:	83 ec 08             	sub    $0x8,%esp
+  801df3:	53                   	push   %ebx
+  801df4:	56                   	push   %esi
+  801df5:	ff 50 14             	call   *0x14(%eax)
+  801df8:	83 c4 10             	add    $0x10,%esp
+}
+  801dfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfe:	5b                   	pop    %ebx
+  801dff:	5e                   	pop    %esi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e02:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e07:	eb f2                	jmp    801dfb <fstat+0x67>
+
+00801e09 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e09:	55                   	push   %ebp
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	56                   	push   %esi
+  801e0d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e0e:	83 ec 08             	sub    $0x8,%esp
+  801e11:	6a 00                	push   $0x0
+  801e13:	ff 75 08             	push   0x8(%ebp)
+  801e16:	e8 e4 01 00 00       	call   801fff <open>
+  801e1b:	89 c3                	mov    %eax,%ebx
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	78 1b                	js     801e3f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e24:	83 ec 08             	sub    $0x8,%esp
+  801e27:	ff 75 0c             	push   0xc(%ebp)
+  801e2a:	50                   	push   %eax
+  801e2b:	e8 64 ff ff ff       	call   801d94 <fstat>
+  801e30:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e32:	89 1c 24             	mov    %ebx,(%esp)
+  801e35:	e8 c6 fb ff ff       	call   801a00 <close>
+	return r;
+  801e3a:	83 c4 10             	add    $0x10,%esp
+  801e3d:	89 f3                	mov    %esi,%ebx
+}
+  801e3f:	89 d8                	mov    %ebx,%eax
+  801e41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e44:	5b                   	pop    %ebx
+  801e45:	5e                   	pop    %esi
+  801e46:	5d                   	pop    %ebp
+  801e47:	c3                   	ret
+
+00801e48 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e48:	55                   	push   %ebp
+  801e49:	89 e5                	mov    %esp,%ebp
+  801e4b:	56                   	push   %esi
+  801e4c:	53                   	push   %ebx
+  801e4d:	89 c6                	mov    %eax,%esi
+  801e4f:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e51:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801e58:	74 27                	je     801e81 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e5a:	6a 07                	push   $0x7
+  801e5c:	68 00 60 80 00       	push   $0x806000
+  801e61:	56                   	push   %esi
+  801e62:	ff 35 00 50 80 00    	push   0x805000
+  801e68:	e8 b2 0c 00 00       	call   802b1f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e6d:	83 c4 0c             	add    $0xc,%esp
+  801e70:	6a 00                	push   $0x0
+  801e72:	53                   	push   %ebx
+  801e73:	6a 00                	push   $0x0
+  801e75:	e8 8d 0c 00 00       	call   802b07 <ipc_recv>
+}
+  801e7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7d:	5b                   	pop    %ebx
+  801e7e:	5e                   	pop    %esi
+  801e7f:	5d                   	pop    %ebp
+  801e80:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e81:	83 ec 0c             	sub    $0xc,%esp
+  801e84:	6a 01                	push   $0x1
+  801e86:	e8 e8 0c 00 00       	call   802b73 <ipc_find_env>
+  801e8b:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e90:	83 c4 10             	add    $0x10,%esp
+  801e93:	eb c5                	jmp    801e5a <fsipc+0x12>
+
+00801e95 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e95:	55                   	push   %ebp
+  801e96:	89 e5                	mov    %esp,%ebp
+  801e98:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ea1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ea6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ea9:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801eae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb3:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eb8:	e8 8b ff ff ff       	call   801e48 <fsipc>
+}
+  801ebd:	c9                   	leave
+  801ebe:	c3                   	ret
+
+00801ebf <devfile_flush>:
+{
+  801ebf:	55                   	push   %ebp
+  801ec0:	89 e5                	mov    %esp,%ebp
+  801ec2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ec5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ecb:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801ed0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed5:	b8 06 00 00 00       	mov    $0x6,%eax
+  801eda:	e8 69 ff ff ff       	call   801e48 <fsipc>
+}
+  801edf:	c9                   	leave
+  801ee0:	c3                   	ret
+
+00801ee1 <devfile_stat>:
+{
+  801ee1:	55                   	push   %ebp
+  801ee2:	89 e5                	mov    %esp,%ebp
+  801ee4:	53                   	push   %ebx
+  801ee5:	83 ec 04             	sub    $0x4,%esp
+  801ee8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801eeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eee:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef1:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ef6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801efb:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f00:	e8 43 ff ff ff       	call   801e48 <fsipc>
+  801f05:	85 c0                	test   %eax,%eax
+  801f07:	78 2c                	js     801f35 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f09:	83 ec 08             	sub    $0x8,%esp
+  801f0c:	68 00 60 80 00       	push   $0x806000
+  801f11:	53                   	push   %ebx
+  801f12:	e8 b4 e9 ff ff       	call   8008cb <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f17:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f1c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f22:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f27:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f2d:	83 c4 10             	add    $0x10,%esp
+  801f30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f38:	c9                   	leave
+  801f39:	c3                   	ret
+
+00801f3a <devfile_write>:
+{
+  801f3a:	55                   	push   %ebp
+  801f3b:	89 e5                	mov    %esp,%ebp
+  801f3d:	83 ec 0c             	sub    $0xc,%esp
+  801f40:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f46:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f49:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801f4f:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801f54:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f59:	39 d0                	cmp    %edx,%eax
+  801f5b:	0f 47 c2             	cmova  %edx,%eax
+  801f5e:	50                   	push   %eax
+  801f5f:	ff 75 0c             	push   0xc(%ebp)
+  801f62:	68 08 60 80 00       	push   $0x806008
+  801f67:	e8 e5 ea ff ff       	call   800a51 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f71:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f76:	e8 cd fe ff ff       	call   801e48 <fsipc>
+}
+  801f7b:	c9                   	leave
+  801f7c:	c3                   	ret
+
+00801f7d <devfile_read>:
+{
+  801f7d:	55                   	push   %ebp
+  801f7e:	89 e5                	mov    %esp,%ebp
+  801f80:	56                   	push   %esi
+  801f81:	53                   	push   %ebx
+  801f82:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f88:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f8b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801f90:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fa0:	e8 a3 fe ff ff       	call   801e48 <fsipc>
+  801fa5:	89 c3                	mov    %eax,%ebx
+  801fa7:	85 c0                	test   %eax,%eax
+  801fa9:	78 1f                	js     801fca <devfile_read+0x4d>
+	assert(r <= n);
+  801fab:	39 c6                	cmp    %eax,%esi
+  801fad:	72 24                	jb     801fd3 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801faf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fb4:	7f 33                	jg     801fe9 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fb6:	83 ec 04             	sub    $0x4,%esp
+  801fb9:	50                   	push   %eax
+  801fba:	68 00 60 80 00       	push   $0x806000
+  801fbf:	ff 75 0c             	push   0xc(%ebp)
+  801fc2:	e8 8a ea ff ff       	call   800a51 <memmove>
+	return r;
+  801fc7:	83 c4 10             	add    $0x10,%esp
+}
+  801fca:	89 d8                	mov    %ebx,%eax
+  801fcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fcf:	5b                   	pop    %ebx
+  801fd0:	5e                   	pop    %esi
+  801fd1:	5d                   	pop    %ebp
+  801fd2:	c3                   	ret
+	assert(r <= n);
+  801fd3:	68 48 30 80 00       	push   $0x803048
+  801fd8:	68 4f 30 80 00       	push   $0x80304f
+  801fdd:	6a 76                	push   $0x76
+  801fdf:	68 64 30 80 00       	push   $0x803064
+  801fe4:	e8 bf e1 ff ff       	call   8001a8 <_panic>
+	assert(r <= PGSIZE);
+  801fe9:	68 6f 30 80 00       	push   $0x80306f
+  801fee:	68 4f 30 80 00       	push   $0x80304f
+  801ff3:	6a 77                	push   $0x77
+  801ff5:	68 64 30 80 00       	push   $0x803064
+  801ffa:	e8 a9 e1 ff ff       	call   8001a8 <_panic>
+
+00801fff <open>:
+{
+  801fff:	55                   	push   %ebp
+  802000:	89 e5                	mov    %esp,%ebp
+  802002:	56                   	push   %esi
+  802003:	53                   	push   %ebx
+  802004:	83 ec 1c             	sub    $0x1c,%esp
+  802007:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80200a:	56                   	push   %esi
+  80200b:	e8 80 e8 ff ff       	call   800890 <strlen>
+  802010:	83 c4 10             	add    $0x10,%esp
+  802013:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802018:	7f 6c                	jg     802086 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80201a:	83 ec 0c             	sub    $0xc,%esp
+  80201d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802020:	50                   	push   %eax
+  802021:	e8 3a f8 ff ff       	call   801860 <fd_alloc>
+  802026:	89 c3                	mov    %eax,%ebx
+  802028:	83 c4 10             	add    $0x10,%esp
+  80202b:	85 c0                	test   %eax,%eax
+  80202d:	78 3c                	js     80206b <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80202f:	83 ec 08             	sub    $0x8,%esp
+  802032:	56                   	push   %esi
+  802033:	68 00 60 80 00       	push   $0x806000
+  802038:	e8 8e e8 ff ff       	call   8008cb <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80203d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802040:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802045:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802048:	b8 01 00 00 00       	mov    $0x1,%eax
+  80204d:	e8 f6 fd ff ff       	call   801e48 <fsipc>
+  802052:	89 c3                	mov    %eax,%ebx
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	85 c0                	test   %eax,%eax
+  802059:	78 19                	js     802074 <open+0x75>
+	return fd2num(fd);
+  80205b:	83 ec 0c             	sub    $0xc,%esp
+  80205e:	ff 75 f4             	push   -0xc(%ebp)
+  802061:	e8 d3 f7 ff ff       	call   801839 <fd2num>
+  802066:	89 c3                	mov    %eax,%ebx
+  802068:	83 c4 10             	add    $0x10,%esp
+}
+  80206b:	89 d8                	mov    %ebx,%eax
+  80206d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802070:	5b                   	pop    %ebx
+  802071:	5e                   	pop    %esi
+  802072:	5d                   	pop    %ebp
+  802073:	c3                   	ret
+		fd_close(fd, 0);
+  802074:	83 ec 08             	sub    $0x8,%esp
+  802077:	6a 00                	push   $0x0
+  802079:	ff 75 f4             	push   -0xc(%ebp)
+  80207c:	e8 f8 f8 ff ff       	call   801979 <fd_close>
+		return r;
+  802081:	83 c4 10             	add    $0x10,%esp
+  802084:	eb e5                	jmp    80206b <open+0x6c>
+		return -E_BAD_PATH;
+  802086:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80208b:	eb de                	jmp    80206b <open+0x6c>
+
+0080208d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802093:	ba 00 00 00 00       	mov    $0x0,%edx
+  802098:	b8 08 00 00 00       	mov    $0x8,%eax
+  80209d:	e8 a6 fd ff ff       	call   801e48 <fsipc>
+}
+  8020a2:	c9                   	leave
+  8020a3:	c3                   	ret
+
+008020a4 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020a4:	55                   	push   %ebp
+  8020a5:	89 e5                	mov    %esp,%ebp
+  8020a7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8020aa:	68 7b 30 80 00       	push   $0x80307b
+  8020af:	ff 75 0c             	push   0xc(%ebp)
+  8020b2:	e8 14 e8 ff ff       	call   8008cb <strcpy>
+	return 0;
+}
+  8020b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bc:	c9                   	leave
+  8020bd:	c3                   	ret
+
+008020be <devsock_close>:
+{
+  8020be:	55                   	push   %ebp
+  8020bf:	89 e5                	mov    %esp,%ebp
+  8020c1:	53                   	push   %ebx
+  8020c2:	83 ec 10             	sub    $0x10,%esp
+  8020c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8020c8:	53                   	push   %ebx
+  8020c9:	e8 e4 0a 00 00       	call   802bb2 <pageref>
+  8020ce:	89 c2                	mov    %eax,%edx
+  8020d0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020d3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8020d8:	83 fa 01             	cmp    $0x1,%edx
+  8020db:	74 05                	je     8020e2 <devsock_close+0x24>
+}
+  8020dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e0:	c9                   	leave
+  8020e1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8020e2:	83 ec 0c             	sub    $0xc,%esp
+  8020e5:	ff 73 0c             	push   0xc(%ebx)
+  8020e8:	e8 b7 02 00 00       	call   8023a4 <nsipc_close>
+  8020ed:	83 c4 10             	add    $0x10,%esp
+  8020f0:	eb eb                	jmp    8020dd <devsock_close+0x1f>
+
+008020f2 <devsock_write>:
+{
+  8020f2:	55                   	push   %ebp
+  8020f3:	89 e5                	mov    %esp,%ebp
+  8020f5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8020f8:	6a 00                	push   $0x0
+  8020fa:	ff 75 10             	push   0x10(%ebp)
+  8020fd:	ff 75 0c             	push   0xc(%ebp)
+  802100:	8b 45 08             	mov    0x8(%ebp),%eax
+  802103:	ff 70 0c             	push   0xc(%eax)
+  802106:	e8 79 03 00 00       	call   802484 <nsipc_send>
+}
+  80210b:	c9                   	leave
+  80210c:	c3                   	ret
+
+0080210d <devsock_read>:
+{
+  80210d:	55                   	push   %ebp
+  80210e:	89 e5                	mov    %esp,%ebp
+  802110:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802113:	6a 00                	push   $0x0
+  802115:	ff 75 10             	push   0x10(%ebp)
+  802118:	ff 75 0c             	push   0xc(%ebp)
+  80211b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211e:	ff 70 0c             	push   0xc(%eax)
+  802121:	e8 ef 02 00 00       	call   802415 <nsipc_recv>
+}
+  802126:	c9                   	leave
+  802127:	c3                   	ret
+
+00802128 <fd2sockid>:
+{
+  802128:	55                   	push   %ebp
+  802129:	89 e5                	mov    %esp,%ebp
+  80212b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80212e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802131:	52                   	push   %edx
+  802132:	50                   	push   %eax
+  802133:	e8 7e f7 ff ff       	call   8018b6 <fd_lookup>
+  802138:	83 c4 10             	add    $0x10,%esp
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	78 10                	js     80214f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80213f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802142:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802148:	39 08                	cmp    %ecx,(%eax)
+  80214a:	75 05                	jne    802151 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80214c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+		return -E_NOT_SUPP;
+  802151:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802156:	eb f7                	jmp    80214f <fd2sockid+0x27>
+
+00802158 <alloc_sockfd>:
+{
+  802158:	55                   	push   %ebp
+  802159:	89 e5                	mov    %esp,%ebp
+  80215b:	56                   	push   %esi
+  80215c:	53                   	push   %ebx
+  80215d:	83 ec 1c             	sub    $0x1c,%esp
+  802160:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802162:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802165:	50                   	push   %eax
+  802166:	e8 f5 f6 ff ff       	call   801860 <fd_alloc>
+  80216b:	89 c3                	mov    %eax,%ebx
+  80216d:	83 c4 10             	add    $0x10,%esp
+  802170:	85 c0                	test   %eax,%eax
+  802172:	78 43                	js     8021b7 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802174:	83 ec 04             	sub    $0x4,%esp
+  802177:	68 07 04 00 00       	push   $0x407
+  80217c:	ff 75 f4             	push   -0xc(%ebp)
+  80217f:	6a 00                	push   $0x0
+  802181:	e8 3d ec ff ff       	call   800dc3 <sys_page_alloc>
+  802186:	89 c3                	mov    %eax,%ebx
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	78 28                	js     8021b7 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80218f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802192:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802198:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80219a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80219d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8021a4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8021a7:	83 ec 0c             	sub    $0xc,%esp
+  8021aa:	50                   	push   %eax
+  8021ab:	e8 89 f6 ff ff       	call   801839 <fd2num>
+  8021b0:	89 c3                	mov    %eax,%ebx
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	eb 0c                	jmp    8021c3 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8021b7:	83 ec 0c             	sub    $0xc,%esp
+  8021ba:	56                   	push   %esi
+  8021bb:	e8 e4 01 00 00       	call   8023a4 <nsipc_close>
+		return r;
+  8021c0:	83 c4 10             	add    $0x10,%esp
+}
+  8021c3:	89 d8                	mov    %ebx,%eax
+  8021c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c8:	5b                   	pop    %ebx
+  8021c9:	5e                   	pop    %esi
+  8021ca:	5d                   	pop    %ebp
+  8021cb:	c3                   	ret
+
+008021cc <accept>:
+{
+  8021cc:	55                   	push   %ebp
+  8021cd:	89 e5                	mov    %esp,%ebp
+  8021cf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d5:	e8 4e ff ff ff       	call   802128 <fd2sockid>
+  8021da:	85 c0                	test   %eax,%eax
+  8021dc:	78 1b                	js     8021f9 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8021de:	83 ec 04             	sub    $0x4,%esp
+  8021e1:	ff 75 10             	push   0x10(%ebp)
+  8021e4:	ff 75 0c             	push   0xc(%ebp)
+  8021e7:	50                   	push   %eax
+  8021e8:	e8 0e 01 00 00       	call   8022fb <nsipc_accept>
+  8021ed:	83 c4 10             	add    $0x10,%esp
+  8021f0:	85 c0                	test   %eax,%eax
+  8021f2:	78 05                	js     8021f9 <accept+0x2d>
+	return alloc_sockfd(r);
+  8021f4:	e8 5f ff ff ff       	call   802158 <alloc_sockfd>
+}
+  8021f9:	c9                   	leave
+  8021fa:	c3                   	ret
+
+008021fb <bind>:
+{
+  8021fb:	55                   	push   %ebp
+  8021fc:	89 e5                	mov    %esp,%ebp
+  8021fe:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802201:	8b 45 08             	mov    0x8(%ebp),%eax
+  802204:	e8 1f ff ff ff       	call   802128 <fd2sockid>
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	78 12                	js     80221f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80220d:	83 ec 04             	sub    $0x4,%esp
+  802210:	ff 75 10             	push   0x10(%ebp)
+  802213:	ff 75 0c             	push   0xc(%ebp)
+  802216:	50                   	push   %eax
+  802217:	e8 31 01 00 00       	call   80234d <nsipc_bind>
+  80221c:	83 c4 10             	add    $0x10,%esp
+}
+  80221f:	c9                   	leave
+  802220:	c3                   	ret
+
+00802221 <shutdown>:
+{
+  802221:	55                   	push   %ebp
+  802222:	89 e5                	mov    %esp,%ebp
+  802224:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802227:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222a:	e8 f9 fe ff ff       	call   802128 <fd2sockid>
+  80222f:	85 c0                	test   %eax,%eax
+  802231:	78 0f                	js     802242 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802233:	83 ec 08             	sub    $0x8,%esp
+  802236:	ff 75 0c             	push   0xc(%ebp)
+  802239:	50                   	push   %eax
+  80223a:	e8 43 01 00 00       	call   802382 <nsipc_shutdown>
+  80223f:	83 c4 10             	add    $0x10,%esp
+}
+  802242:	c9                   	leave
+  802243:	c3                   	ret
+
+00802244 <connect>:
+{
+  802244:	55                   	push   %ebp
+  802245:	89 e5                	mov    %esp,%ebp
+  802247:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80224a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80224d:	e8 d6 fe ff ff       	call   802128 <fd2sockid>
+  802252:	85 c0                	test   %eax,%eax
+  802254:	78 12                	js     802268 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802256:	83 ec 04             	sub    $0x4,%esp
+  802259:	ff 75 10             	push   0x10(%ebp)
+  80225c:	ff 75 0c             	push   0xc(%ebp)
+  80225f:	50                   	push   %eax
+  802260:	e8 59 01 00 00       	call   8023be <nsipc_connect>
+  802265:	83 c4 10             	add    $0x10,%esp
+}
+  802268:	c9                   	leave
+  802269:	c3                   	ret
+
+0080226a <listen>:
+{
+  80226a:	55                   	push   %ebp
+  80226b:	89 e5                	mov    %esp,%ebp
+  80226d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802270:	8b 45 08             	mov    0x8(%ebp),%eax
+  802273:	e8 b0 fe ff ff       	call   802128 <fd2sockid>
+  802278:	85 c0                	test   %eax,%eax
+  80227a:	78 0f                	js     80228b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80227c:	83 ec 08             	sub    $0x8,%esp
+  80227f:	ff 75 0c             	push   0xc(%ebp)
+  802282:	50                   	push   %eax
+  802283:	e8 6b 01 00 00       	call   8023f3 <nsipc_listen>
+  802288:	83 c4 10             	add    $0x10,%esp
+}
+  80228b:	c9                   	leave
+  80228c:	c3                   	ret
+
+0080228d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80228d:	55                   	push   %ebp
+  80228e:	89 e5                	mov    %esp,%ebp
+  802290:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802293:	ff 75 10             	push   0x10(%ebp)
+  802296:	ff 75 0c             	push   0xc(%ebp)
+  802299:	ff 75 08             	push   0x8(%ebp)
+  80229c:	e8 41 02 00 00       	call   8024e2 <nsipc_socket>
+  8022a1:	83 c4 10             	add    $0x10,%esp
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	78 05                	js     8022ad <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8022a8:	e8 ab fe ff ff       	call   802158 <alloc_sockfd>
+}
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+
+008022af <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8022af:	55                   	push   %ebp
+  8022b0:	89 e5                	mov    %esp,%ebp
+  8022b2:	53                   	push   %ebx
+  8022b3:	83 ec 04             	sub    $0x4,%esp
+  8022b6:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8022b8:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8022bf:	74 26                	je     8022e7 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8022c1:	6a 07                	push   $0x7
+  8022c3:	68 00 70 80 00       	push   $0x807000
+  8022c8:	53                   	push   %ebx
+  8022c9:	ff 35 04 50 80 00    	push   0x805004
+  8022cf:	e8 4b 08 00 00       	call   802b1f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8022d4:	83 c4 0c             	add    $0xc,%esp
+  8022d7:	6a 00                	push   $0x0
+  8022d9:	6a 00                	push   $0x0
+  8022db:	6a 00                	push   $0x0
+  8022dd:	e8 25 08 00 00       	call   802b07 <ipc_recv>
+}
+  8022e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e5:	c9                   	leave
+  8022e6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8022e7:	83 ec 0c             	sub    $0xc,%esp
+  8022ea:	6a 02                	push   $0x2
+  8022ec:	e8 82 08 00 00       	call   802b73 <ipc_find_env>
+  8022f1:	a3 04 50 80 00       	mov    %eax,0x805004
+  8022f6:	83 c4 10             	add    $0x10,%esp
+  8022f9:	eb c6                	jmp    8022c1 <nsipc+0x12>
+
+008022fb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8022fb:	55                   	push   %ebp
+  8022fc:	89 e5                	mov    %esp,%ebp
+  8022fe:	56                   	push   %esi
+  8022ff:	53                   	push   %ebx
+  802300:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802303:	8b 45 08             	mov    0x8(%ebp),%eax
+  802306:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80230b:	8b 06                	mov    (%esi),%eax
+  80230d:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802312:	b8 01 00 00 00       	mov    $0x1,%eax
+  802317:	e8 93 ff ff ff       	call   8022af <nsipc>
+  80231c:	89 c3                	mov    %eax,%ebx
+  80231e:	85 c0                	test   %eax,%eax
+  802320:	79 09                	jns    80232b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802322:	89 d8                	mov    %ebx,%eax
+  802324:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802327:	5b                   	pop    %ebx
+  802328:	5e                   	pop    %esi
+  802329:	5d                   	pop    %ebp
+  80232a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80232b:	83 ec 04             	sub    $0x4,%esp
+  80232e:	ff 35 10 70 80 00    	push   0x807010
+  802334:	68 00 70 80 00       	push   $0x807000
+  802339:	ff 75 0c             	push   0xc(%ebp)
+  80233c:	e8 10 e7 ff ff       	call   800a51 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802341:	a1 10 70 80 00       	mov    0x807010,%eax
+  802346:	89 06                	mov    %eax,(%esi)
+  802348:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80234b:	eb d5                	jmp    802322 <nsipc_accept+0x27>
+
+0080234d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	53                   	push   %ebx
+  802351:	83 ec 08             	sub    $0x8,%esp
+  802354:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802357:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235a:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80235f:	53                   	push   %ebx
+  802360:	ff 75 0c             	push   0xc(%ebp)
+  802363:	68 04 70 80 00       	push   $0x807004
+  802368:	e8 e4 e6 ff ff       	call   800a51 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80236d:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802373:	b8 02 00 00 00       	mov    $0x2,%eax
+  802378:	e8 32 ff ff ff       	call   8022af <nsipc>
+}
+  80237d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802380:	c9                   	leave
+  802381:	c3                   	ret
+
+00802382 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802382:	55                   	push   %ebp
+  802383:	89 e5                	mov    %esp,%ebp
+  802385:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802388:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802390:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802393:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802398:	b8 03 00 00 00       	mov    $0x3,%eax
+  80239d:	e8 0d ff ff ff       	call   8022af <nsipc>
+}
+  8023a2:	c9                   	leave
+  8023a3:	c3                   	ret
+
+008023a4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8023a4:	55                   	push   %ebp
+  8023a5:	89 e5                	mov    %esp,%ebp
+  8023a7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8023aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ad:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8023b2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023b7:	e8 f3 fe ff ff       	call   8022af <nsipc>
+}
+  8023bc:	c9                   	leave
+  8023bd:	c3                   	ret
+
+008023be <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8023be:	55                   	push   %ebp
+  8023bf:	89 e5                	mov    %esp,%ebp
+  8023c1:	53                   	push   %ebx
+  8023c2:	83 ec 08             	sub    $0x8,%esp
+  8023c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8023c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023cb:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8023d0:	53                   	push   %ebx
+  8023d1:	ff 75 0c             	push   0xc(%ebp)
+  8023d4:	68 04 70 80 00       	push   $0x807004
+  8023d9:	e8 73 e6 ff ff       	call   800a51 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8023de:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8023e4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023e9:	e8 c1 fe ff ff       	call   8022af <nsipc>
+}
+  8023ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f1:	c9                   	leave
+  8023f2:	c3                   	ret
+
+008023f3 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8023f3:	55                   	push   %ebp
+  8023f4:	89 e5                	mov    %esp,%ebp
+  8023f6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8023f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fc:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802401:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802404:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802409:	b8 06 00 00 00       	mov    $0x6,%eax
+  80240e:	e8 9c fe ff ff       	call   8022af <nsipc>
+}
+  802413:	c9                   	leave
+  802414:	c3                   	ret
+
+00802415 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	56                   	push   %esi
+  802419:	53                   	push   %ebx
+  80241a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80241d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802420:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802425:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80242b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80242e:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802433:	b8 07 00 00 00       	mov    $0x7,%eax
+  802438:	e8 72 fe ff ff       	call   8022af <nsipc>
+  80243d:	89 c3                	mov    %eax,%ebx
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	78 22                	js     802465 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802443:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802448:	39 c6                	cmp    %eax,%esi
+  80244a:	0f 4e c6             	cmovle %esi,%eax
+  80244d:	39 c3                	cmp    %eax,%ebx
+  80244f:	7f 1d                	jg     80246e <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802451:	83 ec 04             	sub    $0x4,%esp
+  802454:	53                   	push   %ebx
+  802455:	68 00 70 80 00       	push   $0x807000
+  80245a:	ff 75 0c             	push   0xc(%ebp)
+  80245d:	e8 ef e5 ff ff       	call   800a51 <memmove>
+  802462:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802465:	89 d8                	mov    %ebx,%eax
+  802467:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80246a:	5b                   	pop    %ebx
+  80246b:	5e                   	pop    %esi
+  80246c:	5d                   	pop    %ebp
+  80246d:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80246e:	68 87 30 80 00       	push   $0x803087
+  802473:	68 4f 30 80 00       	push   $0x80304f
+  802478:	6a 62                	push   $0x62
+  80247a:	68 9c 30 80 00       	push   $0x80309c
+  80247f:	e8 24 dd ff ff       	call   8001a8 <_panic>
+
+00802484 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	53                   	push   %ebx
+  802488:	83 ec 04             	sub    $0x4,%esp
+  80248b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80248e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802491:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802496:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80249c:	7f 2e                	jg     8024cc <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80249e:	83 ec 04             	sub    $0x4,%esp
+  8024a1:	53                   	push   %ebx
+  8024a2:	ff 75 0c             	push   0xc(%ebp)
+  8024a5:	68 0c 70 80 00       	push   $0x80700c
+  8024aa:	e8 a2 e5 ff ff       	call   800a51 <memmove>
+	nsipcbuf.send.req_size = size;
+  8024af:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8024b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024b8:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8024bd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024c2:	e8 e8 fd ff ff       	call   8022af <nsipc>
+}
+  8024c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ca:	c9                   	leave
+  8024cb:	c3                   	ret
+	assert(size < 1600);
+  8024cc:	68 a8 30 80 00       	push   $0x8030a8
+  8024d1:	68 4f 30 80 00       	push   $0x80304f
+  8024d6:	6a 6d                	push   $0x6d
+  8024d8:	68 9c 30 80 00       	push   $0x80309c
+  8024dd:	e8 c6 dc ff ff       	call   8001a8 <_panic>
+
+008024e2 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8024e2:	55                   	push   %ebp
+  8024e3:	89 e5                	mov    %esp,%ebp
+  8024e5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8024e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024eb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8024f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024f3:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8024f8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024fb:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802500:	b8 09 00 00 00       	mov    $0x9,%eax
+  802505:	e8 a5 fd ff ff       	call   8022af <nsipc>
+}
+  80250a:	c9                   	leave
+  80250b:	c3                   	ret
+
+0080250c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80250c:	55                   	push   %ebp
+  80250d:	89 e5                	mov    %esp,%ebp
+  80250f:	56                   	push   %esi
+  802510:	53                   	push   %ebx
+  802511:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802514:	83 ec 0c             	sub    $0xc,%esp
+  802517:	ff 75 08             	push   0x8(%ebp)
+  80251a:	e8 2a f3 ff ff       	call   801849 <fd2data>
+  80251f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802521:	83 c4 08             	add    $0x8,%esp
+  802524:	68 b4 30 80 00       	push   $0x8030b4
+  802529:	53                   	push   %ebx
+  80252a:	e8 9c e3 ff ff       	call   8008cb <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80252f:	8b 46 04             	mov    0x4(%esi),%eax
+  802532:	2b 06                	sub    (%esi),%eax
+  802534:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80253a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802541:	00 00 00 
+	stat->st_dev = &devpipe;
+  802544:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80254b:	40 80 00 
+	return 0;
+}
+  80254e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802553:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802556:	5b                   	pop    %ebx
+  802557:	5e                   	pop    %esi
+  802558:	5d                   	pop    %ebp
+  802559:	c3                   	ret
+
+0080255a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80255a:	55                   	push   %ebp
+  80255b:	89 e5                	mov    %esp,%ebp
+  80255d:	53                   	push   %ebx
+  80255e:	83 ec 0c             	sub    $0xc,%esp
+  802561:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802564:	53                   	push   %ebx
+  802565:	6a 00                	push   $0x0
+  802567:	e8 32 e9 ff ff       	call   800e9e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80256c:	89 1c 24             	mov    %ebx,(%esp)
+  80256f:	e8 d5 f2 ff ff       	call   801849 <fd2data>
+  802574:	83 c4 08             	add    $0x8,%esp
+  802577:	50                   	push   %eax
+  802578:	6a 00                	push   $0x0
+  80257a:	e8 1f e9 ff ff       	call   800e9e <sys_page_unmap>
+}
+  80257f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802582:	c9                   	leave
+  802583:	c3                   	ret
+
+00802584 <_pipeisclosed>:
+{
+  802584:	55                   	push   %ebp
+  802585:	89 e5                	mov    %esp,%ebp
+  802587:	57                   	push   %edi
+  802588:	56                   	push   %esi
+  802589:	53                   	push   %ebx
+  80258a:	83 ec 1c             	sub    $0x1c,%esp
+  80258d:	89 c7                	mov    %eax,%edi
+  80258f:	89 d6                	mov    %edx,%esi
+  802591:	eb 3c                	jmp    8025cf <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802593:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802596:	83 ec 0c             	sub    $0xc,%esp
+  802599:	57                   	push   %edi
+  80259a:	e8 13 06 00 00       	call   802bb2 <pageref>
+  80259f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025a2:	89 34 24             	mov    %esi,(%esp)
+  8025a5:	e8 08 06 00 00       	call   802bb2 <pageref>
+  8025aa:	89 c2                	mov    %eax,%edx
+  8025ac:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025ae:	05 00 00 00 20       	add    $0x20000000,%eax
+  8025b3:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8025b6:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025bc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025c1:	76 31                	jbe    8025f4 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8025c3:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8025c6:	39 c3                	cmp    %eax,%ebx
+  8025c8:	74 76                	je     802640 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8025ca:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025cd:	74 36                	je     802605 <_pipeisclosed+0x81>
+  8025cf:	89 e0                	mov    %esp,%eax
+  8025d1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025d6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025dc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025e1:	77 b0                	ja     802593 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025e3:	c1 e8 10             	shr    $0x10,%eax
+  8025e6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025ec:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025f2:	eb 9f                	jmp    802593 <_pipeisclosed+0xf>
+  8025f4:	c1 e8 10             	shr    $0x10,%eax
+  8025f7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025fd:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802603:	eb be                	jmp    8025c3 <_pipeisclosed+0x3f>
+  802605:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802607:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80260c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802612:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802617:	76 16                	jbe    80262f <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802619:	8b 42 58             	mov    0x58(%edx),%eax
+  80261c:	6a 01                	push   $0x1
+  80261e:	50                   	push   %eax
+  80261f:	53                   	push   %ebx
+  802620:	68 bb 30 80 00       	push   $0x8030bb
+  802625:	e8 59 dc ff ff       	call   800283 <cprintf>
+  80262a:	83 c4 10             	add    $0x10,%esp
+  80262d:	eb a0                	jmp    8025cf <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80262f:	c1 e8 10             	shr    $0x10,%eax
+  802632:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802638:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80263e:	eb d9                	jmp    802619 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802640:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802643:	0f 94 c0             	sete   %al
+  802646:	0f b6 c0             	movzbl %al,%eax
+}
+  802649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264c:	5b                   	pop    %ebx
+  80264d:	5e                   	pop    %esi
+  80264e:	5f                   	pop    %edi
+  80264f:	5d                   	pop    %ebp
+  802650:	c3                   	ret
+
+00802651 <devpipe_write>:
+{
+  802651:	55                   	push   %ebp
+  802652:	89 e5                	mov    %esp,%ebp
+  802654:	57                   	push   %edi
+  802655:	56                   	push   %esi
+  802656:	53                   	push   %ebx
+  802657:	83 ec 28             	sub    $0x28,%esp
+  80265a:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80265d:	56                   	push   %esi
+  80265e:	e8 e6 f1 ff ff       	call   801849 <fd2data>
+  802663:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802665:	83 c4 10             	add    $0x10,%esp
+  802668:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266d:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802670:	75 09                	jne    80267b <devpipe_write+0x2a>
+	return i;
+  802672:	89 f8                	mov    %edi,%eax
+  802674:	eb 23                	jmp    802699 <devpipe_write+0x48>
+			sys_yield();
+  802676:	e8 02 e7 ff ff       	call   800d7d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80267b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80267e:	8b 0b                	mov    (%ebx),%ecx
+  802680:	8d 51 20             	lea    0x20(%ecx),%edx
+  802683:	39 d0                	cmp    %edx,%eax
+  802685:	72 1a                	jb     8026a1 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802687:	89 da                	mov    %ebx,%edx
+  802689:	89 f0                	mov    %esi,%eax
+  80268b:	e8 f4 fe ff ff       	call   802584 <_pipeisclosed>
+  802690:	85 c0                	test   %eax,%eax
+  802692:	74 e2                	je     802676 <devpipe_write+0x25>
+				return 0;
+  802694:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80269c:	5b                   	pop    %ebx
+  80269d:	5e                   	pop    %esi
+  80269e:	5f                   	pop    %edi
+  80269f:	5d                   	pop    %ebp
+  8026a0:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026a4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8026a8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8026ab:	89 c2                	mov    %eax,%edx
+  8026ad:	c1 fa 1f             	sar    $0x1f,%edx
+  8026b0:	89 d1                	mov    %edx,%ecx
+  8026b2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026b5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026b8:	83 e2 1f             	and    $0x1f,%edx
+  8026bb:	29 ca                	sub    %ecx,%edx
+  8026bd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8026c1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8026c5:	83 c0 01             	add    $0x1,%eax
+  8026c8:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8026cb:	83 c7 01             	add    $0x1,%edi
+  8026ce:	eb 9d                	jmp    80266d <devpipe_write+0x1c>
+
+008026d0 <devpipe_read>:
+{
+  8026d0:	55                   	push   %ebp
+  8026d1:	89 e5                	mov    %esp,%ebp
+  8026d3:	57                   	push   %edi
+  8026d4:	56                   	push   %esi
+  8026d5:	53                   	push   %ebx
+  8026d6:	83 ec 18             	sub    $0x18,%esp
+  8026d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8026dc:	57                   	push   %edi
+  8026dd:	e8 67 f1 ff ff       	call   801849 <fd2data>
+  8026e2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8026e4:	83 c4 10             	add    $0x10,%esp
+  8026e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ec:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8026ef:	75 13                	jne    802704 <devpipe_read+0x34>
+	return i;
+  8026f1:	89 f0                	mov    %esi,%eax
+  8026f3:	eb 02                	jmp    8026f7 <devpipe_read+0x27>
+				return i;
+  8026f5:	89 f0                	mov    %esi,%eax
+}
+  8026f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026fa:	5b                   	pop    %ebx
+  8026fb:	5e                   	pop    %esi
+  8026fc:	5f                   	pop    %edi
+  8026fd:	5d                   	pop    %ebp
+  8026fe:	c3                   	ret
+			sys_yield();
+  8026ff:	e8 79 e6 ff ff       	call   800d7d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802704:	8b 03                	mov    (%ebx),%eax
+  802706:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802709:	75 18                	jne    802723 <devpipe_read+0x53>
+			if (i > 0)
+  80270b:	85 f6                	test   %esi,%esi
+  80270d:	75 e6                	jne    8026f5 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80270f:	89 da                	mov    %ebx,%edx
+  802711:	89 f8                	mov    %edi,%eax
+  802713:	e8 6c fe ff ff       	call   802584 <_pipeisclosed>
+  802718:	85 c0                	test   %eax,%eax
+  80271a:	74 e3                	je     8026ff <devpipe_read+0x2f>
+				return 0;
+  80271c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802721:	eb d4                	jmp    8026f7 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802723:	99                   	cltd
+  802724:	c1 ea 1b             	shr    $0x1b,%edx
+  802727:	01 d0                	add    %edx,%eax
+  802729:	83 e0 1f             	and    $0x1f,%eax
+  80272c:	29 d0                	sub    %edx,%eax
+  80272e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802733:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802736:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802739:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80273c:	83 c6 01             	add    $0x1,%esi
+  80273f:	eb ab                	jmp    8026ec <devpipe_read+0x1c>
+
+00802741 <pipe>:
+{
+  802741:	55                   	push   %ebp
+  802742:	89 e5                	mov    %esp,%ebp
+  802744:	56                   	push   %esi
+  802745:	53                   	push   %ebx
+  802746:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802749:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80274c:	50                   	push   %eax
+  80274d:	e8 0e f1 ff ff       	call   801860 <fd_alloc>
+  802752:	89 c3                	mov    %eax,%ebx
+  802754:	83 c4 10             	add    $0x10,%esp
+  802757:	85 c0                	test   %eax,%eax
+  802759:	0f 88 23 01 00 00    	js     802882 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80275f:	83 ec 04             	sub    $0x4,%esp
+  802762:	68 07 04 00 00       	push   $0x407
+  802767:	ff 75 f4             	push   -0xc(%ebp)
+  80276a:	6a 00                	push   $0x0
+  80276c:	e8 52 e6 ff ff       	call   800dc3 <sys_page_alloc>
+  802771:	89 c3                	mov    %eax,%ebx
+  802773:	83 c4 10             	add    $0x10,%esp
+  802776:	85 c0                	test   %eax,%eax
+  802778:	0f 88 04 01 00 00    	js     802882 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80277e:	83 ec 0c             	sub    $0xc,%esp
+  802781:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802784:	50                   	push   %eax
+  802785:	e8 d6 f0 ff ff       	call   801860 <fd_alloc>
+  80278a:	89 c3                	mov    %eax,%ebx
+  80278c:	83 c4 10             	add    $0x10,%esp
+  80278f:	85 c0                	test   %eax,%eax
+  802791:	0f 88 db 00 00 00    	js     802872 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802797:	83 ec 04             	sub    $0x4,%esp
+  80279a:	68 07 04 00 00       	push   $0x407
+  80279f:	ff 75 f0             	push   -0x10(%ebp)
+  8027a2:	6a 00                	push   $0x0
+  8027a4:	e8 1a e6 ff ff       	call   800dc3 <sys_page_alloc>
+  8027a9:	89 c3                	mov    %eax,%ebx
+  8027ab:	83 c4 10             	add    $0x10,%esp
+  8027ae:	85 c0                	test   %eax,%eax
+  8027b0:	0f 88 bc 00 00 00    	js     802872 <pipe+0x131>
+	va = fd2data(fd0);
+  8027b6:	83 ec 0c             	sub    $0xc,%esp
+  8027b9:	ff 75 f4             	push   -0xc(%ebp)
+  8027bc:	e8 88 f0 ff ff       	call   801849 <fd2data>
+  8027c1:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027c3:	83 c4 0c             	add    $0xc,%esp
+  8027c6:	68 07 04 00 00       	push   $0x407
+  8027cb:	50                   	push   %eax
+  8027cc:	6a 00                	push   $0x0
+  8027ce:	e8 f0 e5 ff ff       	call   800dc3 <sys_page_alloc>
+  8027d3:	89 c3                	mov    %eax,%ebx
+  8027d5:	83 c4 10             	add    $0x10,%esp
+  8027d8:	85 c0                	test   %eax,%eax
+  8027da:	0f 88 82 00 00 00    	js     802862 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027e0:	83 ec 0c             	sub    $0xc,%esp
+  8027e3:	ff 75 f0             	push   -0x10(%ebp)
+  8027e6:	e8 5e f0 ff ff       	call   801849 <fd2data>
+  8027eb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8027f2:	50                   	push   %eax
+  8027f3:	6a 00                	push   $0x0
+  8027f5:	56                   	push   %esi
+  8027f6:	6a 00                	push   $0x0
+  8027f8:	e8 33 e6 ff ff       	call   800e30 <sys_page_map>
+  8027fd:	89 c3                	mov    %eax,%ebx
+  8027ff:	83 c4 20             	add    $0x20,%esp
+  802802:	85 c0                	test   %eax,%eax
+  802804:	78 4e                	js     802854 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802806:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80280b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80280e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802810:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802813:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80281a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80281d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80281f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802822:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802829:	83 ec 0c             	sub    $0xc,%esp
+  80282c:	ff 75 f4             	push   -0xc(%ebp)
+  80282f:	e8 05 f0 ff ff       	call   801839 <fd2num>
+  802834:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802837:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802839:	83 c4 04             	add    $0x4,%esp
+  80283c:	ff 75 f0             	push   -0x10(%ebp)
+  80283f:	e8 f5 ef ff ff       	call   801839 <fd2num>
+  802844:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802847:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80284a:	83 c4 10             	add    $0x10,%esp
+  80284d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802852:	eb 2e                	jmp    802882 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802854:	83 ec 08             	sub    $0x8,%esp
+  802857:	56                   	push   %esi
+  802858:	6a 00                	push   $0x0
+  80285a:	e8 3f e6 ff ff       	call   800e9e <sys_page_unmap>
+  80285f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802862:	83 ec 08             	sub    $0x8,%esp
+  802865:	ff 75 f0             	push   -0x10(%ebp)
+  802868:	6a 00                	push   $0x0
+  80286a:	e8 2f e6 ff ff       	call   800e9e <sys_page_unmap>
+  80286f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802872:	83 ec 08             	sub    $0x8,%esp
+  802875:	ff 75 f4             	push   -0xc(%ebp)
+  802878:	6a 00                	push   $0x0
+  80287a:	e8 1f e6 ff ff       	call   800e9e <sys_page_unmap>
+  80287f:	83 c4 10             	add    $0x10,%esp
+}
+  802882:	89 d8                	mov    %ebx,%eax
+  802884:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802887:	5b                   	pop    %ebx
+  802888:	5e                   	pop    %esi
+  802889:	5d                   	pop    %ebp
+  80288a:	c3                   	ret
+
+0080288b <pipeisclosed>:
+{
+  80288b:	55                   	push   %ebp
+  80288c:	89 e5                	mov    %esp,%ebp
+  80288e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802891:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802894:	50                   	push   %eax
+  802895:	ff 75 08             	push   0x8(%ebp)
+  802898:	e8 19 f0 ff ff       	call   8018b6 <fd_lookup>
+  80289d:	83 c4 10             	add    $0x10,%esp
+  8028a0:	85 c0                	test   %eax,%eax
+  8028a2:	78 18                	js     8028bc <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8028a4:	83 ec 0c             	sub    $0xc,%esp
+  8028a7:	ff 75 f4             	push   -0xc(%ebp)
+  8028aa:	e8 9a ef ff ff       	call   801849 <fd2data>
+  8028af:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8028b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028b4:	e8 cb fc ff ff       	call   802584 <_pipeisclosed>
+  8028b9:	83 c4 10             	add    $0x10,%esp
+}
+  8028bc:	c9                   	leave
+  8028bd:	c3                   	ret
+
+008028be <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8028be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c3:	c3                   	ret
+
+008028c4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028c4:	55                   	push   %ebp
+  8028c5:	89 e5                	mov    %esp,%ebp
+  8028c7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8028ca:	68 d3 30 80 00       	push   $0x8030d3
+  8028cf:	ff 75 0c             	push   0xc(%ebp)
+  8028d2:	e8 f4 df ff ff       	call   8008cb <strcpy>
+	return 0;
+}
+  8028d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028dc:	c9                   	leave
+  8028dd:	c3                   	ret
+
+008028de <devcons_write>:
+{
+  8028de:	55                   	push   %ebp
+  8028df:	89 e5                	mov    %esp,%ebp
+  8028e1:	57                   	push   %edi
+  8028e2:	56                   	push   %esi
+  8028e3:	53                   	push   %ebx
+  8028e4:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8028ea:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8028ef:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8028f5:	eb 2e                	jmp    802925 <devcons_write+0x47>
+		m = n - tot;
+  8028f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028fa:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8028fc:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802901:	39 c3                	cmp    %eax,%ebx
+  802903:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802906:	83 ec 04             	sub    $0x4,%esp
+  802909:	53                   	push   %ebx
+  80290a:	89 f0                	mov    %esi,%eax
+  80290c:	03 45 0c             	add    0xc(%ebp),%eax
+  80290f:	50                   	push   %eax
+  802910:	57                   	push   %edi
+  802911:	e8 3b e1 ff ff       	call   800a51 <memmove>
+		sys_cputs(buf, m);
+  802916:	83 c4 08             	add    $0x8,%esp
+  802919:	53                   	push   %ebx
+  80291a:	57                   	push   %edi
+  80291b:	e8 24 e3 ff ff       	call   800c44 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802920:	01 de                	add    %ebx,%esi
+  802922:	83 c4 10             	add    $0x10,%esp
+  802925:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802928:	72 cd                	jb     8028f7 <devcons_write+0x19>
+}
+  80292a:	89 f0                	mov    %esi,%eax
+  80292c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292f:	5b                   	pop    %ebx
+  802930:	5e                   	pop    %esi
+  802931:	5f                   	pop    %edi
+  802932:	5d                   	pop    %ebp
+  802933:	c3                   	ret
+
+00802934 <devcons_read>:
+{
+  802934:	55                   	push   %ebp
+  802935:	89 e5                	mov    %esp,%ebp
+  802937:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80293a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802943:	75 07                	jne    80294c <devcons_read+0x18>
+  802945:	eb 1f                	jmp    802966 <devcons_read+0x32>
+		sys_yield();
+  802947:	e8 31 e4 ff ff       	call   800d7d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80294c:	e8 37 e3 ff ff       	call   800c88 <sys_cgetc>
+  802951:	85 c0                	test   %eax,%eax
+  802953:	74 f2                	je     802947 <devcons_read+0x13>
+	if (c < 0)
+  802955:	78 0f                	js     802966 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802957:	83 f8 04             	cmp    $0x4,%eax
+  80295a:	74 0c                	je     802968 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80295c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80295f:	88 02                	mov    %al,(%edx)
+	return 1;
+  802961:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802966:	c9                   	leave
+  802967:	c3                   	ret
+		return 0;
+  802968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296d:	eb f7                	jmp    802966 <devcons_read+0x32>
+
+0080296f <cputchar>:
+{
+  80296f:	55                   	push   %ebp
+  802970:	89 e5                	mov    %esp,%ebp
+  802972:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802975:	8b 45 08             	mov    0x8(%ebp),%eax
+  802978:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80297b:	6a 01                	push   $0x1
+  80297d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802980:	50                   	push   %eax
+  802981:	e8 be e2 ff ff       	call   800c44 <sys_cputs>
+}
+  802986:	83 c4 10             	add    $0x10,%esp
+  802989:	c9                   	leave
+  80298a:	c3                   	ret
+
+0080298b <getchar>:
+{
+  80298b:	55                   	push   %ebp
+  80298c:	89 e5                	mov    %esp,%ebp
+  80298e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802991:	6a 01                	push   $0x1
+  802993:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802996:	50                   	push   %eax
+  802997:	6a 00                	push   $0x0
+  802999:	e8 9e f1 ff ff       	call   801b3c <read>
+	if (r < 0)
+  80299e:	83 c4 10             	add    $0x10,%esp
+  8029a1:	85 c0                	test   %eax,%eax
+  8029a3:	78 06                	js     8029ab <getchar+0x20>
+	if (r < 1)
+  8029a5:	74 06                	je     8029ad <getchar+0x22>
+	return c;
+  8029a7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029ab:	c9                   	leave
+  8029ac:	c3                   	ret
+		return -E_EOF;
+  8029ad:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029b2:	eb f7                	jmp    8029ab <getchar+0x20>
+
+008029b4 <iscons>:
+{
+  8029b4:	55                   	push   %ebp
+  8029b5:	89 e5                	mov    %esp,%ebp
+  8029b7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029bd:	50                   	push   %eax
+  8029be:	ff 75 08             	push   0x8(%ebp)
+  8029c1:	e8 f0 ee ff ff       	call   8018b6 <fd_lookup>
+  8029c6:	83 c4 10             	add    $0x10,%esp
+  8029c9:	85 c0                	test   %eax,%eax
+  8029cb:	78 11                	js     8029de <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8029cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029d0:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8029d6:	39 10                	cmp    %edx,(%eax)
+  8029d8:	0f 94 c0             	sete   %al
+  8029db:	0f b6 c0             	movzbl %al,%eax
+}
+  8029de:	c9                   	leave
+  8029df:	c3                   	ret
+
+008029e0 <opencons>:
+{
+  8029e0:	55                   	push   %ebp
+  8029e1:	89 e5                	mov    %esp,%ebp
+  8029e3:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8029e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029e9:	50                   	push   %eax
+  8029ea:	e8 71 ee ff ff       	call   801860 <fd_alloc>
+  8029ef:	83 c4 10             	add    $0x10,%esp
+  8029f2:	85 c0                	test   %eax,%eax
+  8029f4:	78 3a                	js     802a30 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029f6:	83 ec 04             	sub    $0x4,%esp
+  8029f9:	68 07 04 00 00       	push   $0x407
+  8029fe:	ff 75 f4             	push   -0xc(%ebp)
+  802a01:	6a 00                	push   $0x0
+  802a03:	e8 bb e3 ff ff       	call   800dc3 <sys_page_alloc>
+  802a08:	83 c4 10             	add    $0x10,%esp
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	78 21                	js     802a30 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802a0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a12:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a18:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802a1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a1d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802a24:	83 ec 0c             	sub    $0xc,%esp
+  802a27:	50                   	push   %eax
+  802a28:	e8 0c ee ff ff       	call   801839 <fd2num>
+  802a2d:	83 c4 10             	add    $0x10,%esp
+}
+  802a30:	c9                   	leave
+  802a31:	c3                   	ret
+
+00802a32 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802a32:	55                   	push   %ebp
+  802a33:	89 e5                	mov    %esp,%ebp
+  802a35:	56                   	push   %esi
+  802a36:	53                   	push   %ebx
+  802a37:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a40:	85 c0                	test   %eax,%eax
+  802a42:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a47:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802a4a:	83 ec 08             	sub    $0x8,%esp
+  802a4d:	ff 75 14             	push   0x14(%ebp)
+  802a50:	50                   	push   %eax
+  802a51:	e8 7e e7 ff ff       	call   8011d4 <sys_ipc_recv_until>
+  802a56:	83 c4 10             	add    $0x10,%esp
+  802a59:	85 c0                	test   %eax,%eax
+  802a5b:	78 61                	js     802abe <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802a5d:	85 f6                	test   %esi,%esi
+  802a5f:	74 1c                	je     802a7d <ipc_recv_until+0x4b>
+  802a61:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a63:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a68:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a6e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a73:	76 5f                	jbe    802ad4 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802a75:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802a7b:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802a7d:	85 db                	test   %ebx,%ebx
+  802a7f:	74 1c                	je     802a9d <ipc_recv_until+0x6b>
+  802a81:	89 e0                	mov    %esp,%eax
+  802a83:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a88:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a8e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a93:	76 50                	jbe    802ae5 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802a95:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802a9b:	89 03                	mov    %eax,(%ebx)
+  802a9d:	89 e0                	mov    %esp,%eax
+  802a9f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802aa4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802aaa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802aaf:	76 45                	jbe    802af6 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802ab1:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802ab7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802aba:	5b                   	pop    %ebx
+  802abb:	5e                   	pop    %esi
+  802abc:	5d                   	pop    %ebp
+  802abd:	c3                   	ret
+		if (from_env_store)
+  802abe:	85 f6                	test   %esi,%esi
+  802ac0:	74 06                	je     802ac8 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802ac2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ac8:	85 db                	test   %ebx,%ebx
+  802aca:	74 eb                	je     802ab7 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802acc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802ad2:	eb e3                	jmp    802ab7 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ad4:	c1 e8 10             	shr    $0x10,%eax
+  802ad7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802add:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ae3:	eb 90                	jmp    802a75 <ipc_recv_until+0x43>
+  802ae5:	c1 e8 10             	shr    $0x10,%eax
+  802ae8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802aee:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802af4:	eb 9f                	jmp    802a95 <ipc_recv_until+0x63>
+  802af6:	c1 e8 10             	shr    $0x10,%eax
+  802af9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802aff:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b05:	eb aa                	jmp    802ab1 <ipc_recv_until+0x7f>
+
+00802b07 <ipc_recv>:
+{
+  802b07:	55                   	push   %ebp
+  802b08:	89 e5                	mov    %esp,%ebp
+  802b0a:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802b0d:	6a 00                	push   $0x0
+  802b0f:	ff 75 10             	push   0x10(%ebp)
+  802b12:	ff 75 0c             	push   0xc(%ebp)
+  802b15:	ff 75 08             	push   0x8(%ebp)
+  802b18:	e8 15 ff ff ff       	call   802a32 <ipc_recv_until>
+}
+  802b1d:	c9                   	leave
+  802b1e:	c3                   	ret
+
+00802b1f <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b1f:	55                   	push   %ebp
+  802b20:	89 e5                	mov    %esp,%ebp
+  802b22:	57                   	push   %edi
+  802b23:	56                   	push   %esi
+  802b24:	53                   	push   %ebx
+  802b25:	83 ec 0c             	sub    $0xc,%esp
+  802b28:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b31:	85 db                	test   %ebx,%ebx
+  802b33:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b38:	0f 44 d8             	cmove  %eax,%ebx
+  802b3b:	eb 05                	jmp    802b42 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802b3d:	e8 3b e2 ff ff       	call   800d7d <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802b42:	ff 75 14             	push   0x14(%ebp)
+  802b45:	53                   	push   %ebx
+  802b46:	56                   	push   %esi
+  802b47:	57                   	push   %edi
+  802b48:	e8 d3 e5 ff ff       	call   801120 <sys_ipc_try_send>
+  802b4d:	83 c4 10             	add    $0x10,%esp
+  802b50:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b53:	74 e8                	je     802b3d <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	78 08                	js     802b61 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b5c:	5b                   	pop    %ebx
+  802b5d:	5e                   	pop    %esi
+  802b5e:	5f                   	pop    %edi
+  802b5f:	5d                   	pop    %ebp
+  802b60:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802b61:	50                   	push   %eax
+  802b62:	68 df 30 80 00       	push   $0x8030df
+  802b67:	6a 4f                	push   $0x4f
+  802b69:	68 f2 30 80 00       	push   $0x8030f2
+  802b6e:	e8 35 d6 ff ff       	call   8001a8 <_panic>
+
+00802b73 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b73:	55                   	push   %ebp
+  802b74:	89 e5                	mov    %esp,%ebp
+  802b76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802b79:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802b7e:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802b84:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b8a:	8b 52 50             	mov    0x50(%edx),%edx
+  802b8d:	39 ca                	cmp    %ecx,%edx
+  802b8f:	74 11                	je     802ba2 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802b91:	83 c0 01             	add    $0x1,%eax
+  802b94:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802b99:	75 e3                	jne    802b7e <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba0:	eb 0e                	jmp    802bb0 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802ba2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ba8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bad:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bb0:	5d                   	pop    %ebp
+  802bb1:	c3                   	ret
+
+00802bb2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bb2:	55                   	push   %ebp
+  802bb3:	89 e5                	mov    %esp,%ebp
+  802bb5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bb8:	89 c2                	mov    %eax,%edx
+  802bba:	c1 ea 16             	shr    $0x16,%edx
+  802bbd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bc9:	f6 c1 01             	test   $0x1,%cl
+  802bcc:	74 1a                	je     802be8 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802bce:	c1 e8 0c             	shr    $0xc,%eax
+  802bd1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802bd8:	a8 01                	test   $0x1,%al
+  802bda:	74 0c                	je     802be8 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802bdc:	c1 e8 0c             	shr    $0xc,%eax
+  802bdf:	c1 e0 04             	shl    $0x4,%eax
+  802be2:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802be8:	89 d0                	mov    %edx,%eax
+  802bea:	5d                   	pop    %ebp
+  802beb:	c3                   	ret
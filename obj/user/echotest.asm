@@ -0,0 +1,6755 @@
+
+obj/user/echotest.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a6 04 00 00       	call   8004d7 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+
+const char *msg = "Hello world!\n";
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 e0 2f 80 00       	push   $0x802fe0
+  80003f:	e8 32 06 00 00       	call   800676 <cprintf>
+	exit();
+  800044:	e8 38 05 00 00       	call   800581 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <umain>:
+
+void umain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 58             	sub    $0x58,%esp
+	struct sockaddr_in echoserver;
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	cprintf("Connecting to:\n");
+  800057:	68 e4 2f 80 00       	push   $0x802fe4
+  80005c:	e8 15 06 00 00       	call   800676 <cprintf>
+	cprintf("\tip address %s = %x\n", IPADDR, inet_addr(IPADDR));
+  800061:	c7 04 24 f4 2f 80 00 	movl   $0x802ff4,(%esp)
+  800068:	e8 30 04 00 00       	call   80049d <inet_addr>
+  80006d:	83 c4 0c             	add    $0xc,%esp
+  800070:	50                   	push   %eax
+  800071:	68 f4 2f 80 00       	push   $0x802ff4
+  800076:	68 fe 2f 80 00       	push   $0x802ffe
+  80007b:	e8 f6 05 00 00       	call   800676 <cprintf>
+
+	// Create the TCP socket
+	if ((sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800080:	83 c4 0c             	add    $0xc,%esp
+  800083:	6a 06                	push   $0x6
+  800085:	6a 01                	push   $0x1
+  800087:	6a 02                	push   $0x2
+  800089:	e8 f2 25 00 00       	call   802680 <socket>
+  80008e:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  800091:	83 c4 10             	add    $0x10,%esp
+  800094:	85 c0                	test   %eax,%eax
+  800096:	0f 88 b4 00 00 00    	js     800150 <umain+0x102>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  80009c:	83 ec 0c             	sub    $0xc,%esp
+  80009f:	68 2b 30 80 00       	push   $0x80302b
+  8000a4:	e8 cd 05 00 00       	call   800676 <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  8000a9:	83 c4 0c             	add    $0xc,%esp
+  8000ac:	6a 10                	push   $0x10
+  8000ae:	6a 00                	push   $0x0
+  8000b0:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8000b3:	53                   	push   %ebx
+  8000b4:	e8 56 0d 00 00       	call   800e0f <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  8000b9:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = inet_addr(IPADDR);   // IP address
+  8000bd:	c7 04 24 f4 2f 80 00 	movl   $0x802ff4,(%esp)
+  8000c4:	e8 d4 03 00 00       	call   80049d <inet_addr>
+  8000c9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  8000cc:	c7 04 24 10 27 00 00 	movl   $0x2710,(%esp)
+  8000d3:	e8 a7 01 00 00       	call   80027f <htons>
+  8000d8:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to connect to server\n");
+  8000dc:	c7 04 24 3a 30 80 00 	movl   $0x80303a,(%esp)
+  8000e3:	e8 8e 05 00 00       	call   800676 <cprintf>
+
+	// Establish connection
+	if (connect(sock, (struct sockaddr *) &echoserver, sizeof(echoserver)) < 0)
+  8000e8:	83 c4 0c             	add    $0xc,%esp
+  8000eb:	6a 10                	push   $0x10
+  8000ed:	53                   	push   %ebx
+  8000ee:	ff 75 b4             	push   -0x4c(%ebp)
+  8000f1:	e8 41 25 00 00       	call   802637 <connect>
+  8000f6:	83 c4 10             	add    $0x10,%esp
+  8000f9:	85 c0                	test   %eax,%eax
+  8000fb:	78 62                	js     80015f <umain+0x111>
+		die("Failed to connect with server");
+
+	cprintf("connected to server\n");
+  8000fd:	83 ec 0c             	sub    $0xc,%esp
+  800100:	68 75 30 80 00       	push   $0x803075
+  800105:	e8 6c 05 00 00       	call   800676 <cprintf>
+
+	// Send the word to the server
+	echolen = strlen(msg);
+  80010a:	83 c4 04             	add    $0x4,%esp
+  80010d:	ff 35 00 40 80 00    	push   0x804000
+  800113:	e8 6b 0b 00 00       	call   800c83 <strlen>
+  800118:	89 c7                	mov    %eax,%edi
+  80011a:	89 45 b0             	mov    %eax,-0x50(%ebp)
+	if (write(sock, msg, echolen) != echolen)
+  80011d:	83 c4 0c             	add    $0xc,%esp
+  800120:	50                   	push   %eax
+  800121:	ff 35 00 40 80 00    	push   0x804000
+  800127:	ff 75 b4             	push   -0x4c(%ebp)
+  80012a:	e8 ee 1e 00 00       	call   80201d <write>
+  80012f:	83 c4 10             	add    $0x10,%esp
+  800132:	39 c7                	cmp    %eax,%edi
+  800134:	75 35                	jne    80016b <umain+0x11d>
+		die("Mismatch in number of sent bytes");
+
+	// Receive the word back from the server
+	cprintf("Received: \n");
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	68 8a 30 80 00       	push   $0x80308a
+  80013e:	e8 33 05 00 00       	call   800676 <cprintf>
+	while (received < echolen) {
+  800143:	83 c4 10             	add    $0x10,%esp
+	int received = 0;
+  800146:	be 00 00 00 00       	mov    $0x0,%esi
+		int bytes = 0;
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  80014b:	8d 7d b8             	lea    -0x48(%ebp),%edi
+	while (received < echolen) {
+  80014e:	eb 3a                	jmp    80018a <umain+0x13c>
+		die("Failed to create socket");
+  800150:	b8 13 30 80 00       	mov    $0x803013,%eax
+  800155:	e8 d9 fe ff ff       	call   800033 <die>
+  80015a:	e9 3d ff ff ff       	jmp    80009c <umain+0x4e>
+		die("Failed to connect with server");
+  80015f:	b8 57 30 80 00       	mov    $0x803057,%eax
+  800164:	e8 ca fe ff ff       	call   800033 <die>
+  800169:	eb 92                	jmp    8000fd <umain+0xaf>
+		die("Mismatch in number of sent bytes");
+  80016b:	b8 a4 30 80 00       	mov    $0x8030a4,%eax
+  800170:	e8 be fe ff ff       	call   800033 <die>
+  800175:	eb bf                	jmp    800136 <umain+0xe8>
+			die("Failed to receive bytes from server");
+		}
+		received += bytes;
+  800177:	01 de                	add    %ebx,%esi
+		buffer[bytes] = '\0';        // Assure null terminated string
+  800179:	c6 44 1d b8 00       	movb   $0x0,-0x48(%ebp,%ebx,1)
+		cprintf(buffer);
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	57                   	push   %edi
+  800182:	e8 ef 04 00 00       	call   800676 <cprintf>
+  800187:	83 c4 10             	add    $0x10,%esp
+	while (received < echolen) {
+  80018a:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  80018d:	39 c6                	cmp    %eax,%esi
+  80018f:	73 23                	jae    8001b4 <umain+0x166>
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  800191:	83 ec 04             	sub    $0x4,%esp
+  800194:	6a 1f                	push   $0x1f
+  800196:	57                   	push   %edi
+  800197:	ff 75 b4             	push   -0x4c(%ebp)
+  80019a:	e8 90 1d 00 00       	call   801f2f <read>
+  80019f:	89 c3                	mov    %eax,%ebx
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	7f cf                	jg     800177 <umain+0x129>
+			die("Failed to receive bytes from server");
+  8001a8:	b8 c8 30 80 00       	mov    $0x8030c8,%eax
+  8001ad:	e8 81 fe ff ff       	call   800033 <die>
+  8001b2:	eb c3                	jmp    800177 <umain+0x129>
+	}
+	cprintf("\n");
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	68 94 30 80 00       	push   $0x803094
+  8001bc:	e8 b5 04 00 00       	call   800676 <cprintf>
+
+	close(sock);
+  8001c1:	83 c4 04             	add    $0x4,%esp
+  8001c4:	ff 75 b4             	push   -0x4c(%ebp)
+  8001c7:	e8 27 1c 00 00       	call   801df3 <close>
+}
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d2:	5b                   	pop    %ebx
+  8001d3:	5e                   	pop    %esi
+  8001d4:	5f                   	pop    %edi
+  8001d5:	5d                   	pop    %ebp
+  8001d6:	c3                   	ret
+
+008001d7 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001e6:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8001e9:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8001ee:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8001f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f6:	eb 31                	jmp    800229 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8001f8:	0f b6 c8             	movzbl %al,%ecx
+  8001fb:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800200:	88 0a                	mov    %cl,(%edx)
+  800202:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  800205:	83 e8 01             	sub    $0x1,%eax
+  800208:	3c ff                	cmp    $0xff,%al
+  80020a:	75 ec                	jne    8001f8 <inet_ntoa+0x21>
+  80020c:	0f b6 db             	movzbl %bl,%ebx
+  80020f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800212:	01 d8                	add    %ebx,%eax
+  800214:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800216:	8d 40 01             	lea    0x1(%eax),%eax
+  800219:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80021c:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  80021f:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  800222:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800225:	39 c7                	cmp    %eax,%edi
+  800227:	74 46                	je     80026f <inet_ntoa+0x98>
+  800229:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  80022c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800231:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  800234:	89 f0                	mov    %esi,%eax
+  800236:	f6 e2                	mul    %dl
+  800238:	66 c1 e8 0b          	shr    $0xb,%ax
+  80023c:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  80023f:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  800242:	01 c9                	add    %ecx,%ecx
+  800244:	89 d0                	mov    %edx,%eax
+  800246:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800248:	89 d7                	mov    %edx,%edi
+  80024a:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80024e:	89 d9                	mov    %ebx,%ecx
+  800250:	83 c3 01             	add    $0x1,%ebx
+  800253:	0f b6 c9             	movzbl %cl,%ecx
+  800256:	83 c0 30             	add    $0x30,%eax
+  800259:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  80025d:	89 f8                	mov    %edi,%eax
+  80025f:	3c 09                	cmp    $0x9,%al
+  800261:	77 d1                	ja     800234 <inet_ntoa+0x5d>
+  800263:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800266:	88 17                	mov    %dl,(%edi)
+  800268:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  80026b:	89 d8                	mov    %ebx,%eax
+  80026d:	eb 96                	jmp    800205 <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  80026f:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  800272:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800277:	83 c4 1c             	add    $0x1c,%esp
+  80027a:	5b                   	pop    %ebx
+  80027b:	5e                   	pop    %esi
+  80027c:	5f                   	pop    %edi
+  80027d:	5d                   	pop    %ebp
+  80027e:	c3                   	ret
+
+0080027f <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800282:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800286:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  80028a:	5d                   	pop    %ebp
+  80028b:	c3                   	ret
+
+0080028c <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  80028c:	55                   	push   %ebp
+  80028d:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80028f:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800293:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800297:	5d                   	pop    %ebp
+  800298:	c3                   	ret
+
+00800299 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  80029f:	89 d0                	mov    %edx,%eax
+  8002a1:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002a4:	89 d1                	mov    %edx,%ecx
+  8002a6:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002a9:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002ab:	89 d1                	mov    %edx,%ecx
+  8002ad:	c1 e1 08             	shl    $0x8,%ecx
+  8002b0:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002b6:	09 c8                	or     %ecx,%eax
+  8002b8:	c1 ea 08             	shr    $0x8,%edx
+  8002bb:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002c1:	09 d0                	or     %edx,%eax
+}
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <inet_aton>:
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	57                   	push   %edi
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	83 ec 2c             	sub    $0x2c,%esp
+  8002ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002d1:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002d4:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002d7:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002da:	e9 9b 00 00 00       	jmp    80037a <inet_aton+0xb5>
+      c = *++cp;
+  8002df:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002e3:	89 c1                	mov    %eax,%ecx
+  8002e5:	83 e1 df             	and    $0xffffffdf,%ecx
+  8002e8:	80 f9 58             	cmp    $0x58,%cl
+  8002eb:	74 10                	je     8002fd <inet_aton+0x38>
+      c = *++cp;
+  8002ed:	83 c2 01             	add    $0x1,%edx
+  8002f0:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8002f3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8002f8:	e9 97 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        c = *++cp;
+  8002fd:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800301:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  800304:	bf 10 00 00 00       	mov    $0x10,%edi
+  800309:	e9 86 00 00 00       	jmp    800394 <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  80030e:	0f af d7             	imul   %edi,%edx
+  800311:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  800315:	0f be 01             	movsbl (%ecx),%eax
+  800318:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  80031b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  80031e:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800321:	80 fb 09             	cmp    $0x9,%bl
+  800324:	76 e8                	jbe    80030e <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800326:	83 ff 10             	cmp    $0x10,%edi
+  800329:	75 2e                	jne    800359 <inet_aton+0x94>
+  80032b:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  80032f:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  800332:	83 e3 df             	and    $0xffffffdf,%ebx
+  800335:	83 eb 41             	sub    $0x41,%ebx
+  800338:	80 fb 05             	cmp    $0x5,%bl
+  80033b:	77 1c                	ja     800359 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  80033d:	c1 e2 04             	shl    $0x4,%edx
+  800340:	83 c0 0a             	add    $0xa,%eax
+  800343:	89 f3                	mov    %esi,%ebx
+  800345:	80 fb 1a             	cmp    $0x1a,%bl
+  800348:	19 db                	sbb    %ebx,%ebx
+  80034a:	83 e3 20             	and    $0x20,%ebx
+  80034d:	83 c3 41             	add    $0x41,%ebx
+  800350:	29 d8                	sub    %ebx,%eax
+  800352:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  800354:	0f be 01             	movsbl (%ecx),%eax
+  800357:	eb bf                	jmp    800318 <inet_aton+0x53>
+    if (c == '.') {
+  800359:	83 f8 2e             	cmp    $0x2e,%eax
+  80035c:	75 43                	jne    8003a1 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  80035e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800361:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800364:	39 f0                	cmp    %esi,%eax
+  800366:	0f 84 22 01 00 00    	je     80048e <inet_aton+0x1c9>
+      *pp++ = val;
+  80036c:	83 c0 04             	add    $0x4,%eax
+  80036f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800372:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  800375:	89 ca                	mov    %ecx,%edx
+  800377:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  80037a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80037d:	80 f9 09             	cmp    $0x9,%cl
+  800380:	0f 87 01 01 00 00    	ja     800487 <inet_aton+0x1c2>
+    base = 10;
+  800386:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  80038b:	83 f8 30             	cmp    $0x30,%eax
+  80038e:	0f 84 4b ff ff ff    	je     8002df <inet_aton+0x1a>
+  800394:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039c:	e9 7a ff ff ff       	jmp    80031b <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003a1:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003a5:	89 d6                	mov    %edx,%esi
+  8003a7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003aa:	85 c0                	test   %eax,%eax
+  8003ac:	74 2e                	je     8003dc <inet_aton+0x117>
+    return (0);
+  8003ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b3:	89 fa                	mov    %edi,%edx
+  8003b5:	80 fa 1f             	cmp    $0x1f,%dl
+  8003b8:	0f 86 d5 00 00 00    	jbe    800493 <inet_aton+0x1ce>
+  8003be:	84 c0                	test   %al,%al
+  8003c0:	0f 88 cd 00 00 00    	js     800493 <inet_aton+0x1ce>
+  8003c6:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003c9:	83 f9 04             	cmp    $0x4,%ecx
+  8003cc:	76 0e                	jbe    8003dc <inet_aton+0x117>
+    return (0);
+  8003ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003d3:	83 f8 20             	cmp    $0x20,%eax
+  8003d6:	0f 85 b7 00 00 00    	jne    800493 <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003dc:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003df:	89 d8                	mov    %ebx,%eax
+  8003e1:	29 c8                	sub    %ecx,%eax
+  8003e3:	c1 f8 02             	sar    $0x2,%eax
+  8003e6:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8003e9:	83 f8 02             	cmp    $0x2,%eax
+  8003ec:	74 7a                	je     800468 <inet_aton+0x1a3>
+  8003ee:	83 f9 03             	cmp    $0x3,%ecx
+  8003f1:	7f 49                	jg     80043c <inet_aton+0x177>
+  8003f3:	85 c9                	test   %ecx,%ecx
+  8003f5:	0f 84 98 00 00 00    	je     800493 <inet_aton+0x1ce>
+  8003fb:	83 f9 02             	cmp    $0x2,%ecx
+  8003fe:	75 19                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800400:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  800405:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  80040b:	0f 87 82 00 00 00    	ja     800493 <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800411:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800414:	c1 e0 18             	shl    $0x18,%eax
+  800417:	09 c6                	or     %eax,%esi
+  return (1);
+  800419:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  80041e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800422:	74 6f                	je     800493 <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  800424:	83 ec 0c             	sub    $0xc,%esp
+  800427:	56                   	push   %esi
+  800428:	e8 6c fe ff ff       	call   800299 <htonl>
+  80042d:	83 c4 10             	add    $0x10,%esp
+  800430:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800433:	89 06                	mov    %eax,(%esi)
+  return (1);
+  800435:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80043a:	eb 57                	jmp    800493 <inet_aton+0x1ce>
+  switch (n) {
+  80043c:	83 f9 04             	cmp    $0x4,%ecx
+  80043f:	75 d8                	jne    800419 <inet_aton+0x154>
+      return (0);
+  800441:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800446:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  80044c:	77 45                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  80044e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800451:	c1 e0 18             	shl    $0x18,%eax
+  800454:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800457:	c1 e1 10             	shl    $0x10,%ecx
+  80045a:	09 c8                	or     %ecx,%eax
+  80045c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80045f:	c1 e1 08             	shl    $0x8,%ecx
+  800462:	09 c8                	or     %ecx,%eax
+  800464:	09 c6                	or     %eax,%esi
+    break;
+  800466:	eb b1                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800468:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  80046d:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  800473:	77 1e                	ja     800493 <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  800475:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800478:	c1 e0 18             	shl    $0x18,%eax
+  80047b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80047e:	c1 e1 10             	shl    $0x10,%ecx
+  800481:	09 c8                	or     %ecx,%eax
+  800483:	09 c6                	or     %eax,%esi
+    break;
+  800485:	eb 92                	jmp    800419 <inet_aton+0x154>
+      return (0);
+  800487:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80048c:	eb 05                	jmp    800493 <inet_aton+0x1ce>
+        return (0);
+  80048e:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  800493:	89 c8                	mov    %ecx,%eax
+  800495:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800498:	5b                   	pop    %ebx
+  800499:	5e                   	pop    %esi
+  80049a:	5f                   	pop    %edi
+  80049b:	5d                   	pop    %ebp
+  80049c:	c3                   	ret
+
+0080049d <inet_addr>:
+{
+  80049d:	55                   	push   %ebp
+  80049e:	89 e5                	mov    %esp,%ebp
+  8004a0:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	ff 75 08             	push   0x8(%ebp)
+  8004aa:	e8 16 fe ff ff       	call   8002c5 <inet_aton>
+  8004af:	89 c2                	mov    %eax,%edx
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004b4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	75 02                	jne    8004bf <inet_addr+0x22>
+}
+  8004bd:	c9                   	leave
+  8004be:	c3                   	ret
+    return (val.s_addr);
+  8004bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004c2:	eb f9                	jmp    8004bd <inet_addr+0x20>
+
+008004c4 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004c4:	55                   	push   %ebp
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004ca:	ff 75 08             	push   0x8(%ebp)
+  8004cd:	e8 c7 fd ff ff       	call   800299 <htonl>
+  8004d2:	83 c4 10             	add    $0x10,%esp
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+
+008004d7 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004d7:	55                   	push   %ebp
+  8004d8:	89 e5                	mov    %esp,%ebp
+  8004da:	57                   	push   %edi
+  8004db:	56                   	push   %esi
+  8004dc:	53                   	push   %ebx
+  8004dd:	83 ec 0c             	sub    $0xc,%esp
+  8004e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8004e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8004e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004eb:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8004ed:	c1 ea 0b             	shr    $0xb,%edx
+  8004f0:	83 f2 01             	xor    $0x1,%edx
+  8004f3:	83 e2 01             	and    $0x1,%edx
+  8004f6:	88 15 1c 50 80 00    	mov    %dl,0x80501c
+
+	mainenv = NULL;
+  8004fc:	c7 05 18 50 80 00 00 	movl   $0x0,0x805018
+  800503:	00 00 00 
+	envid = sys_getenvid();
+  800506:	e8 1f 0c 00 00       	call   80112a <sys_getenvid>
+  80050b:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80050d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800512:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800518:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80051e:	8b 52 48             	mov    0x48(%edx),%edx
+  800521:	39 ca                	cmp    %ecx,%edx
+  800523:	74 27                	je     80054c <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800525:	83 c0 01             	add    $0x1,%eax
+  800528:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80052d:	75 e3                	jne    800512 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80052f:	83 3d 18 50 80 00 00 	cmpl   $0x0,0x805018
+  800536:	75 24                	jne    80055c <libmain+0x85>
+		panic("libmain can't find the environment");
+  800538:	83 ec 04             	sub    $0x4,%esp
+  80053b:	68 ec 30 80 00       	push   $0x8030ec
+  800540:	6a 23                	push   $0x23
+  800542:	68 0f 31 80 00       	push   $0x80310f
+  800547:	e8 4f 00 00 00       	call   80059b <_panic>
+			mainenv = &envs[i];
+  80054c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800552:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800557:	a3 18 50 80 00       	mov    %eax,0x805018
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80055c:	85 ff                	test   %edi,%edi
+  80055e:	7e 07                	jle    800567 <libmain+0x90>
+		binaryname = argv[0];
+  800560:	8b 06                	mov    (%esi),%eax
+  800562:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  800567:	83 ec 08             	sub    $0x8,%esp
+  80056a:	56                   	push   %esi
+  80056b:	57                   	push   %edi
+  80056c:	e8 dd fa ff ff       	call   80004e <umain>
+
+	// exit gracefully
+	exit();
+  800571:	e8 0b 00 00 00       	call   800581 <exit>
+}
+  800576:	83 c4 10             	add    $0x10,%esp
+  800579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80057c:	5b                   	pop    %ebx
+  80057d:	5e                   	pop    %esi
+  80057e:	5f                   	pop    %edi
+  80057f:	5d                   	pop    %ebp
+  800580:	c3                   	ret
+
+00800581 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800581:	55                   	push   %ebp
+  800582:	89 e5                	mov    %esp,%ebp
+  800584:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800587:	e8 94 18 00 00       	call   801e20 <close_all>
+	sys_env_destroy(0);
+  80058c:	83 ec 0c             	sub    $0xc,%esp
+  80058f:	6a 00                	push   $0x0
+  800591:	e8 2b 0b 00 00       	call   8010c1 <sys_env_destroy>
+}
+  800596:	83 c4 10             	add    $0x10,%esp
+  800599:	c9                   	leave
+  80059a:	c3                   	ret
+
+0080059b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80059b:	55                   	push   %ebp
+  80059c:	89 e5                	mov    %esp,%ebp
+  80059e:	56                   	push   %esi
+  80059f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005a0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005a3:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8005a9:	e8 7c 0b 00 00       	call   80112a <sys_getenvid>
+  8005ae:	83 ec 0c             	sub    $0xc,%esp
+  8005b1:	ff 75 0c             	push   0xc(%ebp)
+  8005b4:	ff 75 08             	push   0x8(%ebp)
+  8005b7:	56                   	push   %esi
+  8005b8:	50                   	push   %eax
+  8005b9:	68 28 31 80 00       	push   $0x803128
+  8005be:	e8 b3 00 00 00       	call   800676 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005c3:	83 c4 18             	add    $0x18,%esp
+  8005c6:	53                   	push   %ebx
+  8005c7:	ff 75 10             	push   0x10(%ebp)
+  8005ca:	e8 56 00 00 00       	call   800625 <vcprintf>
+	cprintf("\n");
+  8005cf:	c7 04 24 94 30 80 00 	movl   $0x803094,(%esp)
+  8005d6:	e8 9b 00 00 00       	call   800676 <cprintf>
+  8005db:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005de:	cc                   	int3
+	while (1)
+  8005df:	eb fd                	jmp    8005de <_panic+0x43>
+
+008005e1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	53                   	push   %ebx
+  8005e5:	83 ec 04             	sub    $0x4,%esp
+  8005e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8005eb:	8b 13                	mov    (%ebx),%edx
+  8005ed:	8d 42 01             	lea    0x1(%edx),%eax
+  8005f0:	89 03                	mov    %eax,(%ebx)
+  8005f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005f5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8005f9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005fe:	74 09                	je     800609 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800600:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800604:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800607:	c9                   	leave
+  800608:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800609:	83 ec 08             	sub    $0x8,%esp
+  80060c:	68 ff 00 00 00       	push   $0xff
+  800611:	8d 43 08             	lea    0x8(%ebx),%eax
+  800614:	50                   	push   %eax
+  800615:	e8 1d 0a 00 00       	call   801037 <sys_cputs>
+		b->idx = 0;
+  80061a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800620:	83 c4 10             	add    $0x10,%esp
+  800623:	eb db                	jmp    800600 <putch+0x1f>
+
+00800625 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800625:	55                   	push   %ebp
+  800626:	89 e5                	mov    %esp,%ebp
+  800628:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80062e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800635:	00 00 00 
+	b.cnt = 0;
+  800638:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80063f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800642:	ff 75 0c             	push   0xc(%ebp)
+  800645:	ff 75 08             	push   0x8(%ebp)
+  800648:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80064e:	50                   	push   %eax
+  80064f:	68 e1 05 80 00       	push   $0x8005e1
+  800654:	e8 fb 00 00 00       	call   800754 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800659:	83 c4 08             	add    $0x8,%esp
+  80065c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800662:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800668:	50                   	push   %eax
+  800669:	e8 c9 09 00 00       	call   801037 <sys_cputs>
+
+	return b.cnt;
+}
+  80066e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800674:	c9                   	leave
+  800675:	c3                   	ret
+
+00800676 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800676:	55                   	push   %ebp
+  800677:	89 e5                	mov    %esp,%ebp
+  800679:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80067c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80067f:	50                   	push   %eax
+  800680:	ff 75 08             	push   0x8(%ebp)
+  800683:	e8 9d ff ff ff       	call   800625 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800688:	c9                   	leave
+  800689:	c3                   	ret
+
+0080068a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80068a:	55                   	push   %ebp
+  80068b:	89 e5                	mov    %esp,%ebp
+  80068d:	57                   	push   %edi
+  80068e:	56                   	push   %esi
+  80068f:	53                   	push   %ebx
+  800690:	83 ec 1c             	sub    $0x1c,%esp
+  800693:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800696:	89 d6                	mov    %edx,%esi
+  800698:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80069b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80069e:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8006a1:	73 0b                	jae    8006ae <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8006a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006a6:	c1 e7 08             	shl    $0x8,%edi
+  8006a9:	0b 7d 10             	or     0x10(%ebp),%edi
+  8006ac:	eb 36                	jmp    8006e4 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8006ae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006b6:	f7 75 08             	divl   0x8(%ebp)
+  8006b9:	89 c1                	mov    %eax,%ecx
+  8006bb:	ff 75 14             	push   0x14(%ebp)
+  8006be:	ff 75 10             	push   0x10(%ebp)
+  8006c1:	83 eb 01             	sub    $0x1,%ebx
+  8006c4:	53                   	push   %ebx
+  8006c5:	ff 75 08             	push   0x8(%ebp)
+  8006c8:	89 f2                	mov    %esi,%edx
+  8006ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006cd:	e8 b8 ff ff ff       	call   80068a <printnum>
+  8006d2:	83 c4 10             	add    $0x10,%esp
+  8006d5:	eb 14                	jmp    8006eb <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	56                   	push   %esi
+  8006db:	57                   	push   %edi
+  8006dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006df:	ff d0                	call   *%eax
+  8006e1:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8006e4:	83 eb 01             	sub    $0x1,%ebx
+  8006e7:	85 db                	test   %ebx,%ebx
+  8006e9:	7f ec                	jg     8006d7 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8006eb:	83 ec 08             	sub    $0x8,%esp
+  8006ee:	56                   	push   %esi
+  8006ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f7:	f7 75 08             	divl   0x8(%ebp)
+  8006fa:	0f be 92 4b 31 80 00 	movsbl 0x80314b(%edx),%edx
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	c1 e0 08             	shl    $0x8,%eax
+  800707:	09 d0                	or     %edx,%eax
+  800709:	50                   	push   %eax
+  80070a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80070d:	ff d0                	call   *%eax
+}
+  80070f:	83 c4 10             	add    $0x10,%esp
+  800712:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800715:	5b                   	pop    %ebx
+  800716:	5e                   	pop    %esi
+  800717:	5f                   	pop    %edi
+  800718:	5d                   	pop    %ebp
+  800719:	c3                   	ret
+
+0080071a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80071a:	55                   	push   %ebp
+  80071b:	89 e5                	mov    %esp,%ebp
+  80071d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800720:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800724:	8b 10                	mov    (%eax),%edx
+  800726:	3b 50 04             	cmp    0x4(%eax),%edx
+  800729:	73 0a                	jae    800735 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80072b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80072e:	89 08                	mov    %ecx,(%eax)
+  800730:	8b 45 08             	mov    0x8(%ebp),%eax
+  800733:	88 02                	mov    %al,(%edx)
+}
+  800735:	5d                   	pop    %ebp
+  800736:	c3                   	ret
+
+00800737 <printfmt>:
+{
+  800737:	55                   	push   %ebp
+  800738:	89 e5                	mov    %esp,%ebp
+  80073a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80073d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800740:	50                   	push   %eax
+  800741:	ff 75 10             	push   0x10(%ebp)
+  800744:	ff 75 0c             	push   0xc(%ebp)
+  800747:	ff 75 08             	push   0x8(%ebp)
+  80074a:	e8 05 00 00 00       	call   800754 <vprintfmt>
+}
+  80074f:	83 c4 10             	add    $0x10,%esp
+  800752:	c9                   	leave
+  800753:	c3                   	ret
+
+00800754 <vprintfmt>:
+{
+  800754:	55                   	push   %ebp
+  800755:	89 e5                	mov    %esp,%ebp
+  800757:	57                   	push   %edi
+  800758:	56                   	push   %esi
+  800759:	53                   	push   %ebx
+  80075a:	83 ec 3c             	sub    $0x3c,%esp
+  80075d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800760:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800763:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80076a:	eb 16                	jmp    800782 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80076c:	83 ec 08             	sub    $0x8,%esp
+  80076f:	ff 75 0c             	push   0xc(%ebp)
+  800772:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800775:	c1 e2 08             	shl    $0x8,%edx
+  800778:	09 d0                	or     %edx,%eax
+  80077a:	50                   	push   %eax
+  80077b:	ff d7                	call   *%edi
+  80077d:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800780:	89 de                	mov    %ebx,%esi
+  800782:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800785:	0f b6 06             	movzbl (%esi),%eax
+  800788:	83 f8 25             	cmp    $0x25,%eax
+  80078b:	74 0c                	je     800799 <vprintfmt+0x45>
+			if (ch == '\0')
+  80078d:	85 c0                	test   %eax,%eax
+  80078f:	75 db                	jne    80076c <vprintfmt+0x18>
+}
+  800791:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800794:	5b                   	pop    %ebx
+  800795:	5e                   	pop    %esi
+  800796:	5f                   	pop    %edi
+  800797:	5d                   	pop    %ebp
+  800798:	c3                   	ret
+		padc = ' ';
+  800799:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80079d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8007a4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8007ab:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8007b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007b7:	8d 73 01             	lea    0x1(%ebx),%esi
+  8007ba:	0f b6 13             	movzbl (%ebx),%edx
+  8007bd:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8007c0:	3c 55                	cmp    $0x55,%al
+  8007c2:	0f 87 2c 04 00 00    	ja     800bf4 <vprintfmt+0x4a0>
+  8007c8:	0f b6 c0             	movzbl %al,%eax
+  8007cb:	ff 24 85 a0 32 80 00 	jmp    *0x8032a0(,%eax,4)
+  8007d2:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8007d4:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8007d8:	eb dd                	jmp    8007b7 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007da:	89 f3                	mov    %esi,%ebx
+  8007dc:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8007e0:	eb d5                	jmp    8007b7 <vprintfmt+0x63>
+  8007e2:	0f b6 d2             	movzbl %dl,%edx
+  8007e5:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8007e7:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8007ec:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8007ef:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8007f3:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8007f6:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8007f9:	83 fe 09             	cmp    $0x9,%esi
+  8007fc:	0f 87 8a 00 00 00    	ja     80088c <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800802:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800805:	eb e5                	jmp    8007ec <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8b 00                	mov    (%eax),%eax
+  80080c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80080f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800812:	8d 40 04             	lea    0x4(%eax),%eax
+  800815:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800818:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80081a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80081e:	79 97                	jns    8007b7 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800820:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800823:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800826:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80082d:	eb 88                	jmp    8007b7 <vprintfmt+0x63>
+			if (width < 0)
+  80082f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800832:	85 db                	test   %ebx,%ebx
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	0f 49 c3             	cmovns %ebx,%eax
+  80083c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80083f:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800841:	e9 71 ff ff ff       	jmp    8007b7 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800846:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800848:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80084f:	e9 63 ff ff ff       	jmp    8007b7 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800854:	8d 73 02             	lea    0x2(%ebx),%esi
+  800857:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80085b:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800862:	3c 67                	cmp    $0x67,%al
+  800864:	0f 84 18 ff ff ff    	je     800782 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80086a:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800871:	3c 72                	cmp    $0x72,%al
+  800873:	0f 84 09 ff ff ff    	je     800782 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800879:	3c 62                	cmp    $0x62,%al
+  80087b:	0f 94 c0             	sete   %al
+  80087e:	0f b6 c0             	movzbl %al,%eax
+  800881:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800884:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800887:	e9 f6 fe ff ff       	jmp    800782 <vprintfmt+0x2e>
+  80088c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80088f:	eb 89                	jmp    80081a <vprintfmt+0xc6>
+			lflag++;
+  800891:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800894:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800896:	e9 1c ff ff ff       	jmp    8007b7 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80089b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089e:	8d 58 04             	lea    0x4(%eax),%ebx
+  8008a1:	83 ec 08             	sub    $0x8,%esp
+  8008a4:	ff 75 0c             	push   0xc(%ebp)
+  8008a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008aa:	c1 e0 08             	shl    $0x8,%eax
+  8008ad:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8008b0:	0b 01                	or     (%ecx),%eax
+  8008b2:	50                   	push   %eax
+  8008b3:	ff d7                	call   *%edi
+			break;
+  8008b5:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8008b8:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8008bb:	e9 c2 fe ff ff       	jmp    800782 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8008c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c3:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8008c6:	8b 10                	mov    (%eax),%edx
+  8008c8:	89 d0                	mov    %edx,%eax
+  8008ca:	f7 d8                	neg    %eax
+  8008cc:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008cf:	83 f8 12             	cmp    $0x12,%eax
+  8008d2:	7f 25                	jg     8008f9 <vprintfmt+0x1a5>
+  8008d4:	8b 14 85 00 34 80 00 	mov    0x803400(,%eax,4),%edx
+  8008db:	85 d2                	test   %edx,%edx
+  8008dd:	74 1a                	je     8008f9 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8008df:	52                   	push   %edx
+  8008e0:	68 41 35 80 00       	push   $0x803541
+  8008e5:	ff 75 0c             	push   0xc(%ebp)
+  8008e8:	57                   	push   %edi
+  8008e9:	e8 49 fe ff ff       	call   800737 <printfmt>
+  8008ee:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8008f1:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8008f4:	e9 89 fe ff ff       	jmp    800782 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8008f9:	50                   	push   %eax
+  8008fa:	68 63 31 80 00       	push   $0x803163
+  8008ff:	ff 75 0c             	push   0xc(%ebp)
+  800902:	57                   	push   %edi
+  800903:	e8 2f fe ff ff       	call   800737 <printfmt>
+  800908:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80090b:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80090e:	e9 6f fe ff ff       	jmp    800782 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800913:	8b 45 14             	mov    0x14(%ebp),%eax
+  800916:	83 c0 04             	add    $0x4,%eax
+  800919:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80091c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800921:	85 c9                	test   %ecx,%ecx
+  800923:	b8 5c 31 80 00       	mov    $0x80315c,%eax
+  800928:	0f 45 c1             	cmovne %ecx,%eax
+  80092b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80092e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800932:	7e 06                	jle    80093a <vprintfmt+0x1e6>
+  800934:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800938:	75 1a                	jne    800954 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80093a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80093d:	c1 e0 08             	shl    $0x8,%eax
+  800940:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800943:	83 c8 3f             	or     $0x3f,%eax
+  800946:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800949:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80094c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80094f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800952:	eb 6d                	jmp    8009c1 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800954:	83 ec 08             	sub    $0x8,%esp
+  800957:	ff 75 d0             	push   -0x30(%ebp)
+  80095a:	ff 75 c8             	push   -0x38(%ebp)
+  80095d:	e8 39 03 00 00       	call   800c9b <strnlen>
+  800962:	89 c2                	mov    %eax,%edx
+  800964:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800967:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800969:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80096c:	c1 e1 08             	shl    $0x8,%ecx
+  80096f:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800973:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800975:	83 c4 10             	add    $0x10,%esp
+  800978:	89 c3                	mov    %eax,%ebx
+  80097a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80097d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800980:	89 ce                	mov    %ecx,%esi
+  800982:	eb 0f                	jmp    800993 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800984:	83 ec 08             	sub    $0x8,%esp
+  800987:	ff 75 0c             	push   0xc(%ebp)
+  80098a:	56                   	push   %esi
+  80098b:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80098d:	83 eb 01             	sub    $0x1,%ebx
+  800990:	83 c4 10             	add    $0x10,%esp
+  800993:	85 db                	test   %ebx,%ebx
+  800995:	7f ed                	jg     800984 <vprintfmt+0x230>
+  800997:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80099a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80099d:	85 c0                	test   %eax,%eax
+  80099f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009a4:	0f 49 d0             	cmovns %eax,%edx
+  8009a7:	29 d0                	sub    %edx,%eax
+  8009a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009ac:	eb 8c                	jmp    80093a <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8009ae:	83 ec 08             	sub    $0x8,%esp
+  8009b1:	ff 75 0c             	push   0xc(%ebp)
+  8009b4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8009b7:	09 c2                	or     %eax,%edx
+  8009b9:	52                   	push   %edx
+  8009ba:	ff d7                	call   *%edi
+  8009bc:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009bf:	89 d9                	mov    %ebx,%ecx
+  8009c1:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8009c4:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8009c8:	0f be d0             	movsbl %al,%edx
+  8009cb:	85 d2                	test   %edx,%edx
+  8009cd:	74 2a                	je     8009f9 <vprintfmt+0x2a5>
+  8009cf:	85 f6                	test   %esi,%esi
+  8009d1:	78 05                	js     8009d8 <vprintfmt+0x284>
+  8009d3:	83 ee 01             	sub    $0x1,%esi
+  8009d6:	78 3b                	js     800a13 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009d8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8009dc:	74 d0                	je     8009ae <vprintfmt+0x25a>
+  8009de:	0f be c0             	movsbl %al,%eax
+  8009e1:	83 e8 20             	sub    $0x20,%eax
+  8009e4:	83 f8 5e             	cmp    $0x5e,%eax
+  8009e7:	76 c5                	jbe    8009ae <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8009e9:	83 ec 08             	sub    $0x8,%esp
+  8009ec:	ff 75 0c             	push   0xc(%ebp)
+  8009ef:	ff 75 cc             	push   -0x34(%ebp)
+  8009f2:	ff d7                	call   *%edi
+  8009f4:	83 c4 10             	add    $0x10,%esp
+  8009f7:	eb c6                	jmp    8009bf <vprintfmt+0x26b>
+  8009f9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8009fc:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8009ff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a02:	01 c3                	add    %eax,%ebx
+  800a04:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800a06:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800a09:	83 c8 20             	or     $0x20,%eax
+  800a0c:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a0f:	89 c6                	mov    %eax,%esi
+  800a11:	eb 14                	jmp    800a27 <vprintfmt+0x2d3>
+  800a13:	8b 75 10             	mov    0x10(%ebp),%esi
+  800a16:	eb e4                	jmp    8009fc <vprintfmt+0x2a8>
+  800a18:	83 ec 08             	sub    $0x8,%esp
+  800a1b:	ff 75 0c             	push   0xc(%ebp)
+  800a1e:	56                   	push   %esi
+  800a1f:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800a21:	83 eb 01             	sub    $0x1,%ebx
+  800a24:	83 c4 10             	add    $0x10,%esp
+  800a27:	85 db                	test   %ebx,%ebx
+  800a29:	7f ed                	jg     800a18 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a2b:	8b 75 10             	mov    0x10(%ebp),%esi
+  800a2e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800a31:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a34:	e9 49 fd ff ff       	jmp    800782 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800a39:	83 f9 01             	cmp    $0x1,%ecx
+  800a3c:	7f 1f                	jg     800a5d <vprintfmt+0x309>
+	else if (lflag)
+  800a3e:	85 c9                	test   %ecx,%ecx
+  800a40:	74 69                	je     800aab <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800a42:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a45:	8b 00                	mov    (%eax),%eax
+  800a47:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a4a:	89 c1                	mov    %eax,%ecx
+  800a4c:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a4f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a52:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a55:	8d 40 04             	lea    0x4(%eax),%eax
+  800a58:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a5b:	eb 17                	jmp    800a74 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800a5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a60:	8b 50 04             	mov    0x4(%eax),%edx
+  800a63:	8b 00                	mov    (%eax),%eax
+  800a65:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a68:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a6b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6e:	8d 40 08             	lea    0x8(%eax),%eax
+  800a71:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a74:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800a77:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800a7a:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800a7f:	85 db                	test   %ebx,%ebx
+  800a81:	0f 89 f6 00 00 00    	jns    800b7d <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800a87:	83 ec 08             	sub    $0x8,%esp
+  800a8a:	ff 75 0c             	push   0xc(%ebp)
+  800a8d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a90:	c1 e0 08             	shl    $0x8,%eax
+  800a93:	83 c8 2d             	or     $0x2d,%eax
+  800a96:	50                   	push   %eax
+  800a97:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800a99:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800a9c:	f7 d9                	neg    %ecx
+  800a9e:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800aa1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aa6:	e9 d2 00 00 00       	jmp    800b7d <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800aab:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aae:	8b 00                	mov    (%eax),%eax
+  800ab0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ab3:	89 c1                	mov    %eax,%ecx
+  800ab5:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ab8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800abb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abe:	8d 40 04             	lea    0x4(%eax),%eax
+  800ac1:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ac4:	eb ae                	jmp    800a74 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800ac6:	83 f9 01             	cmp    $0x1,%ecx
+  800ac9:	7f 19                	jg     800ae4 <vprintfmt+0x390>
+	else if (lflag)
+  800acb:	85 c9                	test   %ecx,%ecx
+  800acd:	74 2a                	je     800af9 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800acf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad2:	8b 08                	mov    (%eax),%ecx
+  800ad4:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ada:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800adf:	e9 99 00 00 00       	jmp    800b7d <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800ae4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae7:	8b 08                	mov    (%eax),%ecx
+  800ae9:	8d 40 08             	lea    0x8(%eax),%eax
+  800aec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800aef:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800af4:	e9 84 00 00 00       	jmp    800b7d <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800af9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afc:	8b 08                	mov    (%eax),%ecx
+  800afe:	8d 40 04             	lea    0x4(%eax),%eax
+  800b01:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b04:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800b09:	eb 72                	jmp    800b7d <vprintfmt+0x429>
+	if (lflag >= 2)
+  800b0b:	83 f9 01             	cmp    $0x1,%ecx
+  800b0e:	7f 16                	jg     800b26 <vprintfmt+0x3d2>
+	else if (lflag)
+  800b10:	85 c9                	test   %ecx,%ecx
+  800b12:	74 24                	je     800b38 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800b14:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b17:	8b 08                	mov    (%eax),%ecx
+  800b19:	8d 40 04             	lea    0x4(%eax),%eax
+  800b1c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b1f:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800b24:	eb 57                	jmp    800b7d <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800b26:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b29:	8b 08                	mov    (%eax),%ecx
+  800b2b:	8d 40 08             	lea    0x8(%eax),%eax
+  800b2e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b31:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800b36:	eb 45                	jmp    800b7d <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800b38:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b3b:	8b 08                	mov    (%eax),%ecx
+  800b3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b43:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800b48:	eb 33                	jmp    800b7d <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800b4a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b4d:	c1 e3 08             	shl    $0x8,%ebx
+  800b50:	83 ec 08             	sub    $0x8,%esp
+  800b53:	ff 75 0c             	push   0xc(%ebp)
+  800b56:	89 d8                	mov    %ebx,%eax
+  800b58:	83 c8 30             	or     $0x30,%eax
+  800b5b:	50                   	push   %eax
+  800b5c:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800b5e:	83 c4 08             	add    $0x8,%esp
+  800b61:	ff 75 0c             	push   0xc(%ebp)
+  800b64:	83 cb 78             	or     $0x78,%ebx
+  800b67:	53                   	push   %ebx
+  800b68:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800b6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6d:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800b6f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b72:	8d 40 04             	lea    0x4(%eax),%eax
+  800b75:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b78:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800b7d:	ff 75 e4             	push   -0x1c(%ebp)
+  800b80:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800b84:	52                   	push   %edx
+  800b85:	ff 75 e0             	push   -0x20(%ebp)
+  800b88:	50                   	push   %eax
+  800b89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b8c:	89 f8                	mov    %edi,%eax
+  800b8e:	e8 f7 fa ff ff       	call   80068a <printnum>
+			break;
+  800b93:	83 c4 10             	add    $0x10,%esp
+  800b96:	e9 e7 fb ff ff       	jmp    800782 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800b9b:	83 f9 01             	cmp    $0x1,%ecx
+  800b9e:	7f 16                	jg     800bb6 <vprintfmt+0x462>
+	else if (lflag)
+  800ba0:	85 c9                	test   %ecx,%ecx
+  800ba2:	74 24                	je     800bc8 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800ba4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba7:	8b 08                	mov    (%eax),%ecx
+  800ba9:	8d 40 04             	lea    0x4(%eax),%eax
+  800bac:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800baf:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800bb4:	eb c7                	jmp    800b7d <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800bb6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb9:	8b 08                	mov    (%eax),%ecx
+  800bbb:	8d 40 08             	lea    0x8(%eax),%eax
+  800bbe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bc1:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800bc6:	eb b5                	jmp    800b7d <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800bc8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bcb:	8b 08                	mov    (%eax),%ecx
+  800bcd:	8d 40 04             	lea    0x4(%eax),%eax
+  800bd0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bd3:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800bd8:	eb a3                	jmp    800b7d <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800bda:	83 ec 08             	sub    $0x8,%esp
+  800bdd:	ff 75 0c             	push   0xc(%ebp)
+  800be0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800be3:	c1 e0 08             	shl    $0x8,%eax
+  800be6:	83 c8 25             	or     $0x25,%eax
+  800be9:	50                   	push   %eax
+  800bea:	ff d7                	call   *%edi
+			break;
+  800bec:	83 c4 10             	add    $0x10,%esp
+  800bef:	e9 8e fb ff ff       	jmp    800782 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800bf4:	83 ec 08             	sub    $0x8,%esp
+  800bf7:	ff 75 0c             	push   0xc(%ebp)
+  800bfa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800bfd:	c1 e0 08             	shl    $0x8,%eax
+  800c00:	83 c8 25             	or     $0x25,%eax
+  800c03:	50                   	push   %eax
+  800c04:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c06:	83 c4 10             	add    $0x10,%esp
+  800c09:	89 de                	mov    %ebx,%esi
+  800c0b:	eb 03                	jmp    800c10 <vprintfmt+0x4bc>
+  800c0d:	83 ee 01             	sub    $0x1,%esi
+  800c10:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800c14:	75 f7                	jne    800c0d <vprintfmt+0x4b9>
+  800c16:	e9 67 fb ff ff       	jmp    800782 <vprintfmt+0x2e>
+
+00800c1b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	83 ec 18             	sub    $0x18,%esp
+  800c21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c24:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c27:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c2a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c2e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c31:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c38:	85 c0                	test   %eax,%eax
+  800c3a:	74 26                	je     800c62 <vsnprintf+0x47>
+  800c3c:	85 d2                	test   %edx,%edx
+  800c3e:	7e 22                	jle    800c62 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c40:	ff 75 14             	push   0x14(%ebp)
+  800c43:	ff 75 10             	push   0x10(%ebp)
+  800c46:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c49:	50                   	push   %eax
+  800c4a:	68 1a 07 80 00       	push   $0x80071a
+  800c4f:	e8 00 fb ff ff       	call   800754 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c54:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c57:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c5d:	83 c4 10             	add    $0x10,%esp
+}
+  800c60:	c9                   	leave
+  800c61:	c3                   	ret
+		return -E_INVAL;
+  800c62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c67:	eb f7                	jmp    800c60 <vsnprintf+0x45>
+
+00800c69 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c69:	55                   	push   %ebp
+  800c6a:	89 e5                	mov    %esp,%ebp
+  800c6c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800c6f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c72:	50                   	push   %eax
+  800c73:	ff 75 10             	push   0x10(%ebp)
+  800c76:	ff 75 0c             	push   0xc(%ebp)
+  800c79:	ff 75 08             	push   0x8(%ebp)
+  800c7c:	e8 9a ff ff ff       	call   800c1b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800c81:	c9                   	leave
+  800c82:	c3                   	ret
+
+00800c83 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c83:	55                   	push   %ebp
+  800c84:	89 e5                	mov    %esp,%ebp
+  800c86:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8e:	eb 03                	jmp    800c93 <strlen+0x10>
+		n++;
+  800c90:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800c93:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c97:	75 f7                	jne    800c90 <strlen+0xd>
+	return n;
+}
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+
+00800c9b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ca1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca9:	eb 03                	jmp    800cae <strnlen+0x13>
+		n++;
+  800cab:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cae:	39 d0                	cmp    %edx,%eax
+  800cb0:	74 08                	je     800cba <strnlen+0x1f>
+  800cb2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800cb6:	75 f3                	jne    800cab <strnlen+0x10>
+  800cb8:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800cba:	89 d0                	mov    %edx,%eax
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+
+00800cbe <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800cbe:	55                   	push   %ebp
+  800cbf:	89 e5                	mov    %esp,%ebp
+  800cc1:	53                   	push   %ebx
+  800cc2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cc5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccd:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800cd1:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800cd4:	83 c0 01             	add    $0x1,%eax
+  800cd7:	84 d2                	test   %dl,%dl
+  800cd9:	75 f2                	jne    800ccd <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800cdb:	89 c8                	mov    %ecx,%eax
+  800cdd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ce0:	c9                   	leave
+  800ce1:	c3                   	ret
+
+00800ce2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ce2:	55                   	push   %ebp
+  800ce3:	89 e5                	mov    %esp,%ebp
+  800ce5:	53                   	push   %ebx
+  800ce6:	83 ec 10             	sub    $0x10,%esp
+  800ce9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800cec:	53                   	push   %ebx
+  800ced:	e8 91 ff ff ff       	call   800c83 <strlen>
+  800cf2:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800cf5:	ff 75 0c             	push   0xc(%ebp)
+  800cf8:	01 d8                	add    %ebx,%eax
+  800cfa:	50                   	push   %eax
+  800cfb:	e8 be ff ff ff       	call   800cbe <strcpy>
+	return dst;
+}
+  800d00:	89 d8                	mov    %ebx,%eax
+  800d02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d05:	c9                   	leave
+  800d06:	c3                   	ret
+
+00800d07 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	56                   	push   %esi
+  800d0b:	53                   	push   %ebx
+  800d0c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d0f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d12:	89 f3                	mov    %esi,%ebx
+  800d14:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d17:	89 f0                	mov    %esi,%eax
+  800d19:	eb 0f                	jmp    800d2a <strncpy+0x23>
+		*dst++ = *src;
+  800d1b:	83 c0 01             	add    $0x1,%eax
+  800d1e:	0f b6 0a             	movzbl (%edx),%ecx
+  800d21:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d24:	80 f9 01             	cmp    $0x1,%cl
+  800d27:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d2a:	39 d8                	cmp    %ebx,%eax
+  800d2c:	75 ed                	jne    800d1b <strncpy+0x14>
+	}
+	return ret;
+}
+  800d2e:	89 f0                	mov    %esi,%eax
+  800d30:	5b                   	pop    %ebx
+  800d31:	5e                   	pop    %esi
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+
+00800d34 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	56                   	push   %esi
+  800d38:	53                   	push   %ebx
+  800d39:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d42:	89 f0                	mov    %esi,%eax
+  800d44:	85 d2                	test   %edx,%edx
+  800d46:	74 21                	je     800d69 <strlcpy+0x35>
+  800d48:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d4c:	89 f2                	mov    %esi,%edx
+  800d4e:	eb 09                	jmp    800d59 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d50:	83 c1 01             	add    $0x1,%ecx
+  800d53:	83 c2 01             	add    $0x1,%edx
+  800d56:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800d59:	39 c2                	cmp    %eax,%edx
+  800d5b:	74 09                	je     800d66 <strlcpy+0x32>
+  800d5d:	0f b6 19             	movzbl (%ecx),%ebx
+  800d60:	84 db                	test   %bl,%bl
+  800d62:	75 ec                	jne    800d50 <strlcpy+0x1c>
+  800d64:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800d66:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800d69:	29 f0                	sub    %esi,%eax
+}
+  800d6b:	5b                   	pop    %ebx
+  800d6c:	5e                   	pop    %esi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+
+00800d6f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d75:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800d78:	eb 06                	jmp    800d80 <strcmp+0x11>
+		p++, q++;
+  800d7a:	83 c1 01             	add    $0x1,%ecx
+  800d7d:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800d80:	0f b6 01             	movzbl (%ecx),%eax
+  800d83:	84 c0                	test   %al,%al
+  800d85:	74 04                	je     800d8b <strcmp+0x1c>
+  800d87:	3a 02                	cmp    (%edx),%al
+  800d89:	74 ef                	je     800d7a <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d8b:	0f b6 c0             	movzbl %al,%eax
+  800d8e:	0f b6 12             	movzbl (%edx),%edx
+  800d91:	29 d0                	sub    %edx,%eax
+}
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+
+00800d95 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	53                   	push   %ebx
+  800d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9f:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800da2:	eb 09                	jmp    800dad <strncmp+0x18>
+		n--, p++, q++;
+  800da4:	83 ea 01             	sub    $0x1,%edx
+  800da7:	83 c0 01             	add    $0x1,%eax
+  800daa:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800dad:	85 d2                	test   %edx,%edx
+  800daf:	74 18                	je     800dc9 <strncmp+0x34>
+  800db1:	0f b6 18             	movzbl (%eax),%ebx
+  800db4:	84 db                	test   %bl,%bl
+  800db6:	74 04                	je     800dbc <strncmp+0x27>
+  800db8:	3a 19                	cmp    (%ecx),%bl
+  800dba:	74 e8                	je     800da4 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dbc:	0f b6 00             	movzbl (%eax),%eax
+  800dbf:	0f b6 11             	movzbl (%ecx),%edx
+  800dc2:	29 d0                	sub    %edx,%eax
+}
+  800dc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dc7:	c9                   	leave
+  800dc8:	c3                   	ret
+		return 0;
+  800dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dce:	eb f4                	jmp    800dc4 <strncmp+0x2f>
+
+00800dd0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800dda:	eb 03                	jmp    800ddf <strchr+0xf>
+  800ddc:	83 c0 01             	add    $0x1,%eax
+  800ddf:	0f b6 10             	movzbl (%eax),%edx
+  800de2:	84 d2                	test   %dl,%dl
+  800de4:	74 06                	je     800dec <strchr+0x1c>
+		if (*s == c)
+  800de6:	38 ca                	cmp    %cl,%dl
+  800de8:	75 f2                	jne    800ddc <strchr+0xc>
+  800dea:	eb 05                	jmp    800df1 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800dec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+
+00800df3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800df3:	55                   	push   %ebp
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800dfd:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e00:	38 ca                	cmp    %cl,%dl
+  800e02:	74 09                	je     800e0d <strfind+0x1a>
+  800e04:	84 d2                	test   %dl,%dl
+  800e06:	74 05                	je     800e0d <strfind+0x1a>
+	for (; *s; s++)
+  800e08:	83 c0 01             	add    $0x1,%eax
+  800e0b:	eb f0                	jmp    800dfd <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+
+00800e0f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	57                   	push   %edi
+  800e13:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e16:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e19:	85 c9                	test   %ecx,%ecx
+  800e1b:	74 20                	je     800e3d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e1d:	89 f8                	mov    %edi,%eax
+  800e1f:	09 c8                	or     %ecx,%eax
+  800e21:	a8 03                	test   $0x3,%al
+  800e23:	75 12                	jne    800e37 <memset+0x28>
+		c &= 0xFF;
+  800e25:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e29:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e2f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e32:	fc                   	cld
+  800e33:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e35:	eb 06                	jmp    800e3d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e3a:	fc                   	cld
+  800e3b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e3d:	89 f8                	mov    %edi,%eax
+  800e3f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e42:	c9                   	leave
+  800e43:	c3                   	ret
+
+00800e44 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e44:	55                   	push   %ebp
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	57                   	push   %edi
+  800e48:	56                   	push   %esi
+  800e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e4f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e52:	39 c6                	cmp    %eax,%esi
+  800e54:	73 32                	jae    800e88 <memmove+0x44>
+  800e56:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e59:	39 d0                	cmp    %edx,%eax
+  800e5b:	73 2b                	jae    800e88 <memmove+0x44>
+		s += n;
+		d += n;
+  800e5d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e60:	89 d6                	mov    %edx,%esi
+  800e62:	09 fe                	or     %edi,%esi
+  800e64:	09 ce                	or     %ecx,%esi
+  800e66:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e6c:	75 0e                	jne    800e7c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e6e:	83 ef 04             	sub    $0x4,%edi
+  800e71:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e74:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e77:	fd                   	std
+  800e78:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e7a:	eb 09                	jmp    800e85 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e7c:	83 ef 01             	sub    $0x1,%edi
+  800e7f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e82:	fd                   	std
+  800e83:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e85:	fc                   	cld
+  800e86:	eb 1a                	jmp    800ea2 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e88:	89 f2                	mov    %esi,%edx
+  800e8a:	09 c2                	or     %eax,%edx
+  800e8c:	09 ca                	or     %ecx,%edx
+  800e8e:	f6 c2 03             	test   $0x3,%dl
+  800e91:	75 0a                	jne    800e9d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e93:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e96:	89 c7                	mov    %eax,%edi
+  800e98:	fc                   	cld
+  800e99:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e9b:	eb 05                	jmp    800ea2 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e9d:	89 c7                	mov    %eax,%edi
+  800e9f:	fc                   	cld
+  800ea0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+
+00800ea6 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800eac:	ff 75 10             	push   0x10(%ebp)
+  800eaf:	ff 75 0c             	push   0xc(%ebp)
+  800eb2:	ff 75 08             	push   0x8(%ebp)
+  800eb5:	e8 8a ff ff ff       	call   800e44 <memmove>
+}
+  800eba:	c9                   	leave
+  800ebb:	c3                   	ret
+
+00800ebc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ebc:	55                   	push   %ebp
+  800ebd:	89 e5                	mov    %esp,%ebp
+  800ebf:	56                   	push   %esi
+  800ec0:	53                   	push   %ebx
+  800ec1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ec7:	89 c6                	mov    %eax,%esi
+  800ec9:	03 75 10             	add    0x10(%ebp),%esi
+  800ecc:	eb 06                	jmp    800ed4 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ece:	83 c0 01             	add    $0x1,%eax
+  800ed1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ed4:	39 f0                	cmp    %esi,%eax
+  800ed6:	74 14                	je     800eec <memcmp+0x30>
+		if (*s1 != *s2)
+  800ed8:	0f b6 08             	movzbl (%eax),%ecx
+  800edb:	0f b6 1a             	movzbl (%edx),%ebx
+  800ede:	38 d9                	cmp    %bl,%cl
+  800ee0:	74 ec                	je     800ece <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ee2:	0f b6 c1             	movzbl %cl,%eax
+  800ee5:	0f b6 db             	movzbl %bl,%ebx
+  800ee8:	29 d8                	sub    %ebx,%eax
+  800eea:	eb 05                	jmp    800ef1 <memcmp+0x35>
+	}
+
+	return 0;
+  800eec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ef1:	5b                   	pop    %ebx
+  800ef2:	5e                   	pop    %esi
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+
+00800ef5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800efb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800efe:	89 c2                	mov    %eax,%edx
+  800f00:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f03:	eb 03                	jmp    800f08 <memfind+0x13>
+  800f05:	83 c0 01             	add    $0x1,%eax
+  800f08:	39 d0                	cmp    %edx,%eax
+  800f0a:	73 04                	jae    800f10 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f0c:	38 08                	cmp    %cl,(%eax)
+  800f0e:	75 f5                	jne    800f05 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f10:	5d                   	pop    %ebp
+  800f11:	c3                   	ret
+
+00800f12 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	56                   	push   %esi
+  800f17:	53                   	push   %ebx
+  800f18:	83 ec 1c             	sub    $0x1c,%esp
+  800f1b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f1e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f21:	eb 03                	jmp    800f26 <strtol+0x14>
+		s++;
+  800f23:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800f26:	0f b6 06             	movzbl (%esi),%eax
+  800f29:	3c 20                	cmp    $0x20,%al
+  800f2b:	74 f6                	je     800f23 <strtol+0x11>
+  800f2d:	3c 09                	cmp    $0x9,%al
+  800f2f:	74 f2                	je     800f23 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f31:	3c 2b                	cmp    $0x2b,%al
+  800f33:	74 43                	je     800f78 <strtol+0x66>
+	int neg = 0;
+  800f35:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800f3a:	3c 2d                	cmp    $0x2d,%al
+  800f3c:	74 44                	je     800f82 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f3e:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800f44:	75 0f                	jne    800f55 <strtol+0x43>
+  800f46:	80 3e 30             	cmpb   $0x30,(%esi)
+  800f49:	74 41                	je     800f8c <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f4b:	85 ff                	test   %edi,%edi
+  800f4d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f52:	0f 44 f8             	cmove  %eax,%edi
+  800f55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800f5f:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800f62:	89 fb                	mov    %edi,%ebx
+  800f64:	c1 fb 1f             	sar    $0x1f,%ebx
+  800f67:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800f6a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800f6d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800f70:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800f73:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f76:	eb 67                	jmp    800fdf <strtol+0xcd>
+		s++;
+  800f78:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800f7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f80:	eb bc                	jmp    800f3e <strtol+0x2c>
+		s++, neg = 1;
+  800f82:	83 c6 01             	add    $0x1,%esi
+  800f85:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f8a:	eb b2                	jmp    800f3e <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f8c:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800f90:	74 0e                	je     800fa0 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800f92:	85 ff                	test   %edi,%edi
+  800f94:	75 bf                	jne    800f55 <strtol+0x43>
+		s++, base = 8;
+  800f96:	83 c6 01             	add    $0x1,%esi
+  800f99:	bf 08 00 00 00       	mov    $0x8,%edi
+  800f9e:	eb b5                	jmp    800f55 <strtol+0x43>
+		s += 2, base = 16;
+  800fa0:	83 c6 02             	add    $0x2,%esi
+  800fa3:	bf 10 00 00 00       	mov    $0x10,%edi
+  800fa8:	eb ab                	jmp    800f55 <strtol+0x43>
+			dig = *s - '0';
+  800faa:	0f be c9             	movsbl %cl,%ecx
+  800fad:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800fb0:	39 f9                	cmp    %edi,%ecx
+  800fb2:	7d 59                	jge    80100d <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800fb4:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800fb8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800fbb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800fbe:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800fc1:	0f af d8             	imul   %eax,%ebx
+  800fc4:	0f af d7             	imul   %edi,%edx
+  800fc7:	01 d3                	add    %edx,%ebx
+  800fc9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800fcc:	f7 e7                	mul    %edi
+  800fce:	01 da                	add    %ebx,%edx
+  800fd0:	89 cb                	mov    %ecx,%ebx
+  800fd2:	c1 fb 1f             	sar    $0x1f,%ebx
+  800fd5:	01 c8                	add    %ecx,%eax
+  800fd7:	11 da                	adc    %ebx,%edx
+  800fd9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800fdc:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800fdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe2:	0f b6 08             	movzbl (%eax),%ecx
+  800fe5:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800fe8:	80 fb 09             	cmp    $0x9,%bl
+  800feb:	76 bd                	jbe    800faa <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800fed:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800ff0:	80 fb 19             	cmp    $0x19,%bl
+  800ff3:	77 08                	ja     800ffd <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800ff5:	0f be c9             	movsbl %cl,%ecx
+  800ff8:	83 e9 57             	sub    $0x57,%ecx
+  800ffb:	eb b3                	jmp    800fb0 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ffd:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  801000:	80 fb 19             	cmp    $0x19,%bl
+  801003:	77 08                	ja     80100d <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  801005:	0f be c9             	movsbl %cl,%ecx
+  801008:	83 e9 37             	sub    $0x37,%ecx
+  80100b:	eb a3                	jmp    800fb0 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80100d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801010:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801013:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  801016:	8b 75 08             	mov    0x8(%ebp),%esi
+  801019:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80101d:	74 05                	je     801024 <strtol+0x112>
+		*endptr = (char *) s;
+  80101f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801022:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  801024:	85 c9                	test   %ecx,%ecx
+  801026:	74 07                	je     80102f <strtol+0x11d>
+  801028:	f7 d8                	neg    %eax
+  80102a:	83 d2 00             	adc    $0x0,%edx
+  80102d:	f7 da                	neg    %edx
+}
+  80102f:	83 c4 1c             	add    $0x1c,%esp
+  801032:	5b                   	pop    %ebx
+  801033:	5e                   	pop    %esi
+  801034:	5f                   	pop    %edi
+  801035:	5d                   	pop    %ebp
+  801036:	c3                   	ret
+
+00801037 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80103d:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801044:	74 18                	je     80105e <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  801046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801051:	89 c3                	mov    %eax,%ebx
+  801053:	89 c7                	mov    %eax,%edi
+  801055:	89 c6                	mov    %eax,%esi
+  801057:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801059:	5b                   	pop    %ebx
+  80105a:	5e                   	pop    %esi
+  80105b:	5f                   	pop    %edi
+  80105c:	5d                   	pop    %ebp
+  80105d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80105e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	89 c3                	mov    %eax,%ebx
+  80106b:	89 c7                	mov    %eax,%edi
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	8d 35 78 10 80 00    	lea    0x801078,%esi
+  801076:	0f 34                	sysenter
+  801078:	5d                   	pop    %ebp
+		goto out;
+  801079:	eb de                	jmp    801059 <sys_cputs+0x22>
+
+0080107b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80107b:	55                   	push   %ebp
+  80107c:	89 e5                	mov    %esp,%ebp
+  80107e:	57                   	push   %edi
+  80107f:	56                   	push   %esi
+  801080:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801081:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801088:	74 19                	je     8010a3 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  80108a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801094:	89 d1                	mov    %edx,%ecx
+  801096:	89 d3                	mov    %edx,%ebx
+  801098:	89 d7                	mov    %edx,%edi
+  80109a:	89 d6                	mov    %edx,%esi
+  80109c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010ad:	89 d1                	mov    %edx,%ecx
+  8010af:	89 d3                	mov    %edx,%ebx
+  8010b1:	89 d7                	mov    %edx,%edi
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	8d 35 be 10 80 00    	lea    0x8010be,%esi
+  8010bc:	0f 34                	sysenter
+  8010be:	5d                   	pop    %ebp
+		goto out;
+  8010bf:	eb dd                	jmp    80109e <sys_cgetc+0x23>
+
+008010c1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	57                   	push   %edi
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+  8010c7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010ca:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8010d1:	74 21                	je     8010f4 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  8010d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	89 cb                	mov    %ecx,%ebx
+  8010e2:	89 cf                	mov    %ecx,%edi
+  8010e4:	89 ce                	mov    %ecx,%esi
+  8010e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e8:	85 c0                	test   %eax,%eax
+  8010ea:	7f 27                	jg     801113 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8010ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ef:	5b                   	pop    %ebx
+  8010f0:	5e                   	pop    %esi
+  8010f1:	5f                   	pop    %edi
+  8010f2:	5d                   	pop    %ebp
+  8010f3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010fc:	b8 03 00 00 00       	mov    $0x3,%eax
+  801101:	89 cb                	mov    %ecx,%ebx
+  801103:	89 cf                	mov    %ecx,%edi
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	8d 35 10 11 80 00    	lea    0x801110,%esi
+  80110e:	0f 34                	sysenter
+  801110:	5d                   	pop    %ebp
+		goto out;
+  801111:	eb d5                	jmp    8010e8 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801113:	83 ec 0c             	sub    $0xc,%esp
+  801116:	50                   	push   %eax
+  801117:	6a 03                	push   $0x3
+  801119:	68 6b 34 80 00       	push   $0x80346b
+  80111e:	6a 3f                	push   $0x3f
+  801120:	68 88 34 80 00       	push   $0x803488
+  801125:	e8 71 f4 ff ff       	call   80059b <_panic>
+
+0080112a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	57                   	push   %edi
+  80112e:	56                   	push   %esi
+  80112f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801130:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801137:	74 19                	je     801152 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  801139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801143:	89 d1                	mov    %edx,%ecx
+  801145:	89 d3                	mov    %edx,%ebx
+  801147:	89 d7                	mov    %edx,%edi
+  801149:	89 d6                	mov    %edx,%esi
+  80114b:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80114d:	5b                   	pop    %ebx
+  80114e:	5e                   	pop    %esi
+  80114f:	5f                   	pop    %edi
+  801150:	5d                   	pop    %ebp
+  801151:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801152:	ba 00 00 00 00       	mov    $0x0,%edx
+  801157:	b8 02 00 00 00       	mov    $0x2,%eax
+  80115c:	89 d1                	mov    %edx,%ecx
+  80115e:	89 d3                	mov    %edx,%ebx
+  801160:	89 d7                	mov    %edx,%edi
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	8d 35 6d 11 80 00    	lea    0x80116d,%esi
+  80116b:	0f 34                	sysenter
+  80116d:	5d                   	pop    %ebp
+		goto out;
+  80116e:	eb dd                	jmp    80114d <sys_getenvid+0x23>
+
+00801170 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801176:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80117d:	74 19                	je     801198 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  80117f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801184:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801189:	89 d1                	mov    %edx,%ecx
+  80118b:	89 d3                	mov    %edx,%ebx
+  80118d:	89 d7                	mov    %edx,%edi
+  80118f:	89 d6                	mov    %edx,%esi
+  801191:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801193:	5b                   	pop    %ebx
+  801194:	5e                   	pop    %esi
+  801195:	5f                   	pop    %edi
+  801196:	5d                   	pop    %ebp
+  801197:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801198:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011a2:	89 d1                	mov    %edx,%ecx
+  8011a4:	89 d3                	mov    %edx,%ebx
+  8011a6:	89 d7                	mov    %edx,%edi
+  8011a8:	55                   	push   %ebp
+  8011a9:	89 e5                	mov    %esp,%ebp
+  8011ab:	8d 35 b3 11 80 00    	lea    0x8011b3,%esi
+  8011b1:	0f 34                	sysenter
+  8011b3:	5d                   	pop    %ebp
+		goto out;
+  8011b4:	eb dd                	jmp    801193 <sys_yield+0x23>
+
+008011b6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8011b6:	55                   	push   %ebp
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	57                   	push   %edi
+  8011ba:	56                   	push   %esi
+  8011bb:	53                   	push   %ebx
+  8011bc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011bf:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8011c6:	74 23                	je     8011eb <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  8011c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011cd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011db:	89 f7                	mov    %esi,%edi
+  8011dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011df:	85 c0                	test   %eax,%eax
+  8011e1:	7f 29                	jg     80120c <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8011e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5f                   	pop    %edi
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	8d 35 09 12 80 00    	lea    0x801209,%esi
+  801207:	0f 34                	sysenter
+  801209:	5d                   	pop    %ebp
+		goto out;
+  80120a:	eb d3                	jmp    8011df <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120c:	83 ec 0c             	sub    $0xc,%esp
+  80120f:	50                   	push   %eax
+  801210:	6a 04                	push   $0x4
+  801212:	68 6b 34 80 00       	push   $0x80346b
+  801217:	6a 3f                	push   $0x3f
+  801219:	68 88 34 80 00       	push   $0x803488
+  80121e:	e8 78 f3 ff ff       	call   80059b <_panic>
+
+00801223 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	57                   	push   %edi
+  801227:	56                   	push   %esi
+  801228:	53                   	push   %ebx
+  801229:	83 ec 0c             	sub    $0xc,%esp
+  80122c:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  80122f:	85 f6                	test   %esi,%esi
+  801231:	75 09                	jne    80123c <sys_page_map+0x19>
+  801233:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80123a:	74 1f                	je     80125b <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  80123c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801241:	8b 55 08             	mov    0x8(%ebp),%edx
+  801244:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801247:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80124f:	85 c0                	test   %eax,%eax
+  801251:	7f 27                	jg     80127a <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801256:	5b                   	pop    %ebx
+  801257:	5e                   	pop    %esi
+  801258:	5f                   	pop    %edi
+  801259:	5d                   	pop    %ebp
+  80125a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80125b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801261:	b8 05 00 00 00       	mov    $0x5,%eax
+  801266:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801269:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	8d 35 77 12 80 00    	lea    0x801277,%esi
+  801275:	0f 34                	sysenter
+  801277:	5d                   	pop    %ebp
+		goto out;
+  801278:	eb d5                	jmp    80124f <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80127a:	83 ec 0c             	sub    $0xc,%esp
+  80127d:	50                   	push   %eax
+  80127e:	6a 05                	push   $0x5
+  801280:	68 6b 34 80 00       	push   $0x80346b
+  801285:	6a 3f                	push   $0x3f
+  801287:	68 88 34 80 00       	push   $0x803488
+  80128c:	e8 0a f3 ff ff       	call   80059b <_panic>
+
+00801291 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801291:	55                   	push   %ebp
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	57                   	push   %edi
+  801295:	56                   	push   %esi
+  801296:	53                   	push   %ebx
+  801297:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80129a:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8012a1:	74 22                	je     8012c5 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  8012a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b3:	89 df                	mov    %ebx,%edi
+  8012b5:	89 de                	mov    %ebx,%esi
+  8012b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b9:	85 c0                	test   %eax,%eax
+  8012bb:	7f 28                	jg     8012e5 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8012bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c0:	5b                   	pop    %ebx
+  8012c1:	5e                   	pop    %esi
+  8012c2:	5f                   	pop    %edi
+  8012c3:	5d                   	pop    %ebp
+  8012c4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012d5:	89 df                	mov    %ebx,%edi
+  8012d7:	55                   	push   %ebp
+  8012d8:	89 e5                	mov    %esp,%ebp
+  8012da:	8d 35 e2 12 80 00    	lea    0x8012e2,%esi
+  8012e0:	0f 34                	sysenter
+  8012e2:	5d                   	pop    %ebp
+		goto out;
+  8012e3:	eb d4                	jmp    8012b9 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012e5:	83 ec 0c             	sub    $0xc,%esp
+  8012e8:	50                   	push   %eax
+  8012e9:	6a 06                	push   $0x6
+  8012eb:	68 6b 34 80 00       	push   $0x80346b
+  8012f0:	6a 3f                	push   $0x3f
+  8012f2:	68 88 34 80 00       	push   $0x803488
+  8012f7:	e8 9f f2 ff ff       	call   80059b <_panic>
+
+008012fc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8012fc:	55                   	push   %ebp
+  8012fd:	89 e5                	mov    %esp,%ebp
+  8012ff:	57                   	push   %edi
+  801300:	56                   	push   %esi
+  801301:	53                   	push   %ebx
+  801302:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801305:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80130c:	74 22                	je     801330 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  80130e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801313:	b8 08 00 00 00       	mov    $0x8,%eax
+  801318:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131e:	89 df                	mov    %ebx,%edi
+  801320:	89 de                	mov    %ebx,%esi
+  801322:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801324:	85 c0                	test   %eax,%eax
+  801326:	7f 28                	jg     801350 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801328:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132b:	5b                   	pop    %ebx
+  80132c:	5e                   	pop    %esi
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801335:	8b 55 08             	mov    0x8(%ebp),%edx
+  801338:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801340:	89 df                	mov    %ebx,%edi
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	8d 35 4d 13 80 00    	lea    0x80134d,%esi
+  80134b:	0f 34                	sysenter
+  80134d:	5d                   	pop    %ebp
+		goto out;
+  80134e:	eb d4                	jmp    801324 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801350:	83 ec 0c             	sub    $0xc,%esp
+  801353:	50                   	push   %eax
+  801354:	6a 08                	push   $0x8
+  801356:	68 6b 34 80 00       	push   $0x80346b
+  80135b:	6a 3f                	push   $0x3f
+  80135d:	68 88 34 80 00       	push   $0x803488
+  801362:	e8 34 f2 ff ff       	call   80059b <_panic>
+
+00801367 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801367:	55                   	push   %ebp
+  801368:	89 e5                	mov    %esp,%ebp
+  80136a:	57                   	push   %edi
+  80136b:	56                   	push   %esi
+  80136c:	53                   	push   %ebx
+  80136d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801370:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801377:	74 22                	je     80139b <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801379:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801383:	8b 55 08             	mov    0x8(%ebp),%edx
+  801386:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801389:	89 df                	mov    %ebx,%edi
+  80138b:	89 de                	mov    %ebx,%esi
+  80138d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80138f:	85 c0                	test   %eax,%eax
+  801391:	7f 28                	jg     8013bb <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801396:	5b                   	pop    %ebx
+  801397:	5e                   	pop    %esi
+  801398:	5f                   	pop    %edi
+  801399:	5d                   	pop    %ebp
+  80139a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80139b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8013ab:	89 df                	mov    %ebx,%edi
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	8d 35 b8 13 80 00    	lea    0x8013b8,%esi
+  8013b6:	0f 34                	sysenter
+  8013b8:	5d                   	pop    %ebp
+		goto out;
+  8013b9:	eb d4                	jmp    80138f <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+  8013be:	50                   	push   %eax
+  8013bf:	6a 09                	push   $0x9
+  8013c1:	68 6b 34 80 00       	push   $0x80346b
+  8013c6:	6a 3f                	push   $0x3f
+  8013c8:	68 88 34 80 00       	push   $0x803488
+  8013cd:	e8 c9 f1 ff ff       	call   80059b <_panic>
+
+008013d2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+  8013d5:	57                   	push   %edi
+  8013d6:	56                   	push   %esi
+  8013d7:	53                   	push   %ebx
+  8013d8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013db:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8013e2:	74 22                	je     801406 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8013e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f4:	89 df                	mov    %ebx,%edi
+  8013f6:	89 de                	mov    %ebx,%esi
+  8013f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013fa:	85 c0                	test   %eax,%eax
+  8013fc:	7f 28                	jg     801426 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8013fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801401:	5b                   	pop    %ebx
+  801402:	5e                   	pop    %esi
+  801403:	5f                   	pop    %edi
+  801404:	5d                   	pop    %ebp
+  801405:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801406:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801411:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801416:	89 df                	mov    %ebx,%edi
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+  80141b:	8d 35 23 14 80 00    	lea    0x801423,%esi
+  801421:	0f 34                	sysenter
+  801423:	5d                   	pop    %ebp
+		goto out;
+  801424:	eb d4                	jmp    8013fa <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801426:	83 ec 0c             	sub    $0xc,%esp
+  801429:	50                   	push   %eax
+  80142a:	6a 0a                	push   $0xa
+  80142c:	68 6b 34 80 00       	push   $0x80346b
+  801431:	6a 3f                	push   $0x3f
+  801433:	68 88 34 80 00       	push   $0x803488
+  801438:	e8 5e f1 ff ff       	call   80059b <_panic>
+
+0080143d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80143d:	55                   	push   %ebp
+  80143e:	89 e5                	mov    %esp,%ebp
+  801440:	57                   	push   %edi
+  801441:	56                   	push   %esi
+  801442:	53                   	push   %ebx
+  801443:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801446:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80144d:	74 22                	je     801471 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80144f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801454:	b8 17 00 00 00       	mov    $0x17,%eax
+  801459:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145f:	89 df                	mov    %ebx,%edi
+  801461:	89 de                	mov    %ebx,%esi
+  801463:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801465:	85 c0                	test   %eax,%eax
+  801467:	7f 28                	jg     801491 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146c:	5b                   	pop    %ebx
+  80146d:	5e                   	pop    %esi
+  80146e:	5f                   	pop    %edi
+  80146f:	5d                   	pop    %ebp
+  801470:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801471:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801476:	8b 55 08             	mov    0x8(%ebp),%edx
+  801479:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801481:	89 df                	mov    %ebx,%edi
+  801483:	55                   	push   %ebp
+  801484:	89 e5                	mov    %esp,%ebp
+  801486:	8d 35 8e 14 80 00    	lea    0x80148e,%esi
+  80148c:	0f 34                	sysenter
+  80148e:	5d                   	pop    %ebp
+		goto out;
+  80148f:	eb d4                	jmp    801465 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801491:	83 ec 0c             	sub    $0xc,%esp
+  801494:	50                   	push   %eax
+  801495:	6a 17                	push   $0x17
+  801497:	68 6b 34 80 00       	push   $0x80346b
+  80149c:	6a 3f                	push   $0x3f
+  80149e:	68 88 34 80 00       	push   $0x803488
+  8014a3:	e8 f3 f0 ff ff       	call   80059b <_panic>
+
+008014a8 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	57                   	push   %edi
+  8014ac:	56                   	push   %esi
+  8014ad:	53                   	push   %ebx
+  8014ae:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014b1:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8014b8:	74 22                	je     8014dc <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8014ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bf:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ca:	89 df                	mov    %ebx,%edi
+  8014cc:	89 de                	mov    %ebx,%esi
+  8014ce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	7f 28                	jg     8014fc <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8014d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d7:	5b                   	pop    %ebx
+  8014d8:	5e                   	pop    %esi
+  8014d9:	5f                   	pop    %edi
+  8014da:	5d                   	pop    %ebp
+  8014db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e7:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014ec:	89 df                	mov    %ebx,%edi
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+  8014f1:	8d 35 f9 14 80 00    	lea    0x8014f9,%esi
+  8014f7:	0f 34                	sysenter
+  8014f9:	5d                   	pop    %ebp
+		goto out;
+  8014fa:	eb d4                	jmp    8014d0 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014fc:	83 ec 0c             	sub    $0xc,%esp
+  8014ff:	50                   	push   %eax
+  801500:	6a 18                	push   $0x18
+  801502:	68 6b 34 80 00       	push   $0x80346b
+  801507:	6a 3f                	push   $0x3f
+  801509:	68 88 34 80 00       	push   $0x803488
+  80150e:	e8 88 f0 ff ff       	call   80059b <_panic>
+
+00801513 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	57                   	push   %edi
+  801517:	56                   	push   %esi
+  801518:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801519:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801520:	74 1d                	je     80153f <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801522:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801527:	be 00 00 00 00       	mov    $0x0,%esi
+  80152c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801532:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801535:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801538:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80153a:	5b                   	pop    %ebx
+  80153b:	5e                   	pop    %esi
+  80153c:	5f                   	pop    %edi
+  80153d:	5d                   	pop    %ebp
+  80153e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80153f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801542:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801545:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80154a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	8d 35 5b 15 80 00    	lea    0x80155b,%esi
+  801559:	0f 34                	sysenter
+  80155b:	5d                   	pop    %ebp
+		goto out;
+  80155c:	eb dc                	jmp    80153a <sys_ipc_try_send+0x27>
+
+0080155e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	57                   	push   %edi
+  801562:	56                   	push   %esi
+  801563:	53                   	push   %ebx
+  801564:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801567:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80156e:	74 21                	je     801591 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801570:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801575:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80157a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157d:	89 cb                	mov    %ecx,%ebx
+  80157f:	89 cf                	mov    %ecx,%edi
+  801581:	89 ce                	mov    %ecx,%esi
+  801583:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801585:	85 c0                	test   %eax,%eax
+  801587:	7f 27                	jg     8015b0 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801589:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80158c:	5b                   	pop    %ebx
+  80158d:	5e                   	pop    %esi
+  80158e:	5f                   	pop    %edi
+  80158f:	5d                   	pop    %ebp
+  801590:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801591:	8b 55 08             	mov    0x8(%ebp),%edx
+  801594:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801599:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80159e:	89 cb                	mov    %ecx,%ebx
+  8015a0:	89 cf                	mov    %ecx,%edi
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	8d 35 ad 15 80 00    	lea    0x8015ad,%esi
+  8015ab:	0f 34                	sysenter
+  8015ad:	5d                   	pop    %ebp
+		goto out;
+  8015ae:	eb d5                	jmp    801585 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015b0:	83 ec 0c             	sub    $0xc,%esp
+  8015b3:	50                   	push   %eax
+  8015b4:	6a 0d                	push   $0xd
+  8015b6:	68 6b 34 80 00       	push   $0x80346b
+  8015bb:	6a 3f                	push   $0x3f
+  8015bd:	68 88 34 80 00       	push   $0x803488
+  8015c2:	e8 d4 ef ff ff       	call   80059b <_panic>
+
+008015c7 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	57                   	push   %edi
+  8015cb:	56                   	push   %esi
+  8015cc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015cd:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8015d4:	74 1b                	je     8015f1 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8015d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015db:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	89 de                	mov    %ebx,%esi
+  8015ea:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8015ec:	5b                   	pop    %ebx
+  8015ed:	5e                   	pop    %esi
+  8015ee:	5f                   	pop    %edi
+  8015ef:	5d                   	pop    %ebp
+  8015f0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801601:	89 df                	mov    %ebx,%edi
+  801603:	55                   	push   %ebp
+  801604:	89 e5                	mov    %esp,%ebp
+  801606:	8d 35 0e 16 80 00    	lea    0x80160e,%esi
+  80160c:	0f 34                	sysenter
+  80160e:	5d                   	pop    %ebp
+		goto out;
+  80160f:	eb db                	jmp    8015ec <sys_ipc_recv_until+0x25>
+
+00801611 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	57                   	push   %edi
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801617:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80161e:	74 19                	je     801639 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801620:	ba 00 00 00 00       	mov    $0x0,%edx
+  801625:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80162a:	89 d1                	mov    %edx,%ecx
+  80162c:	89 d3                	mov    %edx,%ebx
+  80162e:	89 d7                	mov    %edx,%edi
+  801630:	89 d6                	mov    %edx,%esi
+  801632:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801634:	5b                   	pop    %ebx
+  801635:	5e                   	pop    %esi
+  801636:	5f                   	pop    %edi
+  801637:	5d                   	pop    %ebp
+  801638:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801639:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801643:	89 d1                	mov    %edx,%ecx
+  801645:	89 d3                	mov    %edx,%ebx
+  801647:	89 d7                	mov    %edx,%edi
+  801649:	55                   	push   %ebp
+  80164a:	89 e5                	mov    %esp,%ebp
+  80164c:	8d 35 54 16 80 00    	lea    0x801654,%esi
+  801652:	0f 34                	sysenter
+  801654:	5d                   	pop    %ebp
+		goto out;
+  801655:	eb dd                	jmp    801634 <sys_time_msec+0x23>
+
+00801657 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	57                   	push   %edi
+  80165b:	56                   	push   %esi
+  80165c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80165d:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801664:	74 1a                	je     801680 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801670:	8b 55 08             	mov    0x8(%ebp),%edx
+  801673:	89 cb                	mov    %ecx,%ebx
+  801675:	89 cf                	mov    %ecx,%edi
+  801677:	89 ce                	mov    %ecx,%esi
+  801679:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80167b:	5b                   	pop    %ebx
+  80167c:	5e                   	pop    %esi
+  80167d:	5f                   	pop    %edi
+  80167e:	5d                   	pop    %ebp
+  80167f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801680:	8b 55 08             	mov    0x8(%ebp),%edx
+  801683:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801688:	b8 10 00 00 00       	mov    $0x10,%eax
+  80168d:	89 cb                	mov    %ecx,%ebx
+  80168f:	89 cf                	mov    %ecx,%edi
+  801691:	55                   	push   %ebp
+  801692:	89 e5                	mov    %esp,%ebp
+  801694:	8d 35 9c 16 80 00    	lea    0x80169c,%esi
+  80169a:	0f 34                	sysenter
+  80169c:	5d                   	pop    %ebp
+		goto out;
+  80169d:	eb dc                	jmp    80167b <sys_sleep_until+0x24>
+
+0080169f <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80169f:	55                   	push   %ebp
+  8016a0:	89 e5                	mov    %esp,%ebp
+  8016a2:	57                   	push   %edi
+  8016a3:	56                   	push   %esi
+  8016a4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016a5:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8016ac:	74 1a                	je     8016c8 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8016ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8016b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bb:	89 cb                	mov    %ecx,%ebx
+  8016bd:	89 cf                	mov    %ecx,%edi
+  8016bf:	89 ce                	mov    %ecx,%esi
+  8016c1:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8016c3:	5b                   	pop    %ebx
+  8016c4:	5e                   	pop    %esi
+  8016c5:	5f                   	pop    %edi
+  8016c6:	5d                   	pop    %ebp
+  8016c7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016d0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8016d5:	89 cb                	mov    %ecx,%ebx
+  8016d7:	89 cf                	mov    %ecx,%edi
+  8016d9:	55                   	push   %ebp
+  8016da:	89 e5                	mov    %esp,%ebp
+  8016dc:	8d 35 e4 16 80 00    	lea    0x8016e4,%esi
+  8016e2:	0f 34                	sysenter
+  8016e4:	5d                   	pop    %ebp
+		goto out;
+  8016e5:	eb dc                	jmp    8016c3 <sys_env_print_stats+0x24>
+
+008016e7 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8016e7:	55                   	push   %ebp
+  8016e8:	89 e5                	mov    %esp,%ebp
+  8016ea:	57                   	push   %edi
+  8016eb:	56                   	push   %esi
+  8016ec:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016ed:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8016f4:	74 1b                	je     801711 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8016f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fb:	b8 19 00 00 00       	mov    $0x19,%eax
+  801700:	8b 55 08             	mov    0x8(%ebp),%edx
+  801703:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801706:	89 df                	mov    %ebx,%edi
+  801708:	89 de                	mov    %ebx,%esi
+  80170a:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80170c:	5b                   	pop    %ebx
+  80170d:	5e                   	pop    %esi
+  80170e:	5f                   	pop    %edi
+  80170f:	5d                   	pop    %ebp
+  801710:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801711:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801716:	8b 55 08             	mov    0x8(%ebp),%edx
+  801719:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801721:	89 df                	mov    %ebx,%edi
+  801723:	55                   	push   %ebp
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	8d 35 2e 17 80 00    	lea    0x80172e,%esi
+  80172c:	0f 34                	sysenter
+  80172e:	5d                   	pop    %ebp
+		goto out;
+  80172f:	eb db                	jmp    80170c <sys_perf+0x25>
+
+00801731 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801731:	55                   	push   %ebp
+  801732:	89 e5                	mov    %esp,%ebp
+  801734:	57                   	push   %edi
+  801735:	56                   	push   %esi
+  801736:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801737:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80173e:	74 19                	je     801759 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801740:	ba 00 00 00 00       	mov    $0x0,%edx
+  801745:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80174a:	89 d1                	mov    %edx,%ecx
+  80174c:	89 d3                	mov    %edx,%ebx
+  80174e:	89 d7                	mov    %edx,%edi
+  801750:	89 d6                	mov    %edx,%esi
+  801752:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801754:	5b                   	pop    %ebx
+  801755:	5e                   	pop    %esi
+  801756:	5f                   	pop    %edi
+  801757:	5d                   	pop    %ebp
+  801758:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801763:	89 d1                	mov    %edx,%ecx
+  801765:	89 d3                	mov    %edx,%ebx
+  801767:	89 d7                	mov    %edx,%edi
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	8d 35 74 17 80 00    	lea    0x801774,%esi
+  801772:	0f 34                	sysenter
+  801774:	5d                   	pop    %ebp
+		goto out;
+  801775:	eb dd                	jmp    801754 <sys_fork+0x23>
+
+00801777 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	57                   	push   %edi
+  80177b:	56                   	push   %esi
+  80177c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80177d:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801784:	74 1c                	je     8017a2 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801786:	be 00 00 00 00       	mov    $0x0,%esi
+  80178b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801790:	8b 55 08             	mov    0x8(%ebp),%edx
+  801793:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801796:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801799:	89 f7                	mov    %esi,%edi
+  80179b:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80179d:	5b                   	pop    %ebx
+  80179e:	5e                   	pop    %esi
+  80179f:	5f                   	pop    %edi
+  8017a0:	5d                   	pop    %ebp
+  8017a1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8017ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017b5:	55                   	push   %ebp
+  8017b6:	89 e5                	mov    %esp,%ebp
+  8017b8:	8d 35 c0 17 80 00    	lea    0x8017c0,%esi
+  8017be:	0f 34                	sysenter
+  8017c0:	5d                   	pop    %ebp
+		goto out;
+  8017c1:	eb da                	jmp    80179d <sys_thread_create+0x26>
+
+008017c3 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8017c3:	55                   	push   %ebp
+  8017c4:	89 e5                	mov    %esp,%ebp
+  8017c6:	57                   	push   %edi
+  8017c7:	56                   	push   %esi
+  8017c8:	53                   	push   %ebx
+  8017c9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017cc:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8017d3:	74 24                	je     8017f9 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8017d5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8017da:	be 00 00 00 00       	mov    $0x0,%esi
+  8017df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017ed:	85 c0                	test   %eax,%eax
+  8017ef:	7f 27                	jg     801818 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8017f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f4:	5b                   	pop    %ebx
+  8017f5:	5e                   	pop    %esi
+  8017f6:	5f                   	pop    %edi
+  8017f7:	5d                   	pop    %ebp
+  8017f8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ff:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801804:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801807:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	8d 35 15 18 80 00    	lea    0x801815,%esi
+  801813:	0f 34                	sysenter
+  801815:	5d                   	pop    %ebp
+		goto out;
+  801816:	eb d5                	jmp    8017ed <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801818:	83 ec 0c             	sub    $0xc,%esp
+  80181b:	50                   	push   %eax
+  80181c:	6a 1f                	push   $0x1f
+  80181e:	68 6b 34 80 00       	push   $0x80346b
+  801823:	6a 3f                	push   $0x3f
+  801825:	68 88 34 80 00       	push   $0x803488
+  80182a:	e8 6c ed ff ff       	call   80059b <_panic>
+
+0080182f <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80182f:	55                   	push   %ebp
+  801830:	89 e5                	mov    %esp,%ebp
+  801832:	57                   	push   %edi
+  801833:	56                   	push   %esi
+  801834:	53                   	push   %ebx
+  801835:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801838:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80183f:	74 23                	je     801864 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801841:	be 00 00 00 00       	mov    $0x0,%esi
+  801846:	b8 20 00 00 00       	mov    $0x20,%eax
+  80184b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801851:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801854:	89 f7                	mov    %esi,%edi
+  801856:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801858:	85 c0                	test   %eax,%eax
+  80185a:	7f 29                	jg     801885 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80185c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80185f:	5b                   	pop    %ebx
+  801860:	5e                   	pop    %esi
+  801861:	5f                   	pop    %edi
+  801862:	5d                   	pop    %ebp
+  801863:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801864:	8b 55 08             	mov    0x8(%ebp),%edx
+  801867:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80186a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80186f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801874:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801877:	55                   	push   %ebp
+  801878:	89 e5                	mov    %esp,%ebp
+  80187a:	8d 35 82 18 80 00    	lea    0x801882,%esi
+  801880:	0f 34                	sysenter
+  801882:	5d                   	pop    %ebp
+		goto out;
+  801883:	eb d3                	jmp    801858 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801885:	83 ec 0c             	sub    $0xc,%esp
+  801888:	50                   	push   %eax
+  801889:	6a 20                	push   $0x20
+  80188b:	68 6b 34 80 00       	push   $0x80346b
+  801890:	6a 3f                	push   $0x3f
+  801892:	68 88 34 80 00       	push   $0x803488
+  801897:	e8 ff ec ff ff       	call   80059b <_panic>
+
+0080189c <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80189c:	55                   	push   %ebp
+  80189d:	89 e5                	mov    %esp,%ebp
+  80189f:	57                   	push   %edi
+  8018a0:	56                   	push   %esi
+  8018a1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018a2:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8018a9:	74 1b                	je     8018c6 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8018ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8018b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018bb:	89 df                	mov    %ebx,%edi
+  8018bd:	89 de                	mov    %ebx,%esi
+  8018bf:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8018c1:	5b                   	pop    %ebx
+  8018c2:	5e                   	pop    %esi
+  8018c3:	5f                   	pop    %edi
+  8018c4:	5d                   	pop    %ebp
+  8018c5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8018d6:	89 df                	mov    %ebx,%edi
+  8018d8:	55                   	push   %ebp
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	8d 35 e3 18 80 00    	lea    0x8018e3,%esi
+  8018e1:	0f 34                	sysenter
+  8018e3:	5d                   	pop    %ebp
+		goto out;
+  8018e4:	eb db                	jmp    8018c1 <sys_batch+0x25>
+
+008018e6 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8018e6:	55                   	push   %ebp
+  8018e7:	89 e5                	mov    %esp,%ebp
+  8018e9:	57                   	push   %edi
+  8018ea:	56                   	push   %esi
+  8018eb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018ec:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8018f3:	74 1a                	je     80190f <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8018f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018fa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801902:	89 cb                	mov    %ecx,%ebx
+  801904:	89 cf                	mov    %ecx,%edi
+  801906:	89 ce                	mov    %ecx,%esi
+  801908:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80190a:	5b                   	pop    %ebx
+  80190b:	5e                   	pop    %esi
+  80190c:	5f                   	pop    %edi
+  80190d:	5d                   	pop    %ebp
+  80190e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80190f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801912:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801917:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80191c:	89 cb                	mov    %ecx,%ebx
+  80191e:	89 cf                	mov    %ecx,%edi
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	8d 35 2b 19 80 00    	lea    0x80192b,%esi
+  801929:	0f 34                	sysenter
+  80192b:	5d                   	pop    %ebp
+		goto out;
+  80192c:	eb dc                	jmp    80190a <sys_trace_ctl+0x24>
+
+0080192e <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80192e:	55                   	push   %ebp
+  80192f:	89 e5                	mov    %esp,%ebp
+  801931:	57                   	push   %edi
+  801932:	56                   	push   %esi
+  801933:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801934:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80193b:	74 1c                	je     801959 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80193d:	be 00 00 00 00       	mov    $0x0,%esi
+  801942:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801947:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801950:	89 f7                	mov    %esi,%edi
+  801952:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801954:	5b                   	pop    %ebx
+  801955:	5e                   	pop    %esi
+  801956:	5f                   	pop    %edi
+  801957:	5d                   	pop    %ebp
+  801958:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801959:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80195f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801964:	bf 00 00 00 00       	mov    $0x0,%edi
+  801969:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80196c:	55                   	push   %ebp
+  80196d:	89 e5                	mov    %esp,%ebp
+  80196f:	8d 35 77 19 80 00    	lea    0x801977,%esi
+  801975:	0f 34                	sysenter
+  801977:	5d                   	pop    %ebp
+		goto out;
+  801978:	eb da                	jmp    801954 <sys_trace_read+0x26>
+
+0080197a <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	57                   	push   %edi
+  80197e:	56                   	push   %esi
+  80197f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801980:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801987:	74 1c                	je     8019a5 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801989:	be 00 00 00 00       	mov    $0x0,%esi
+  80198e:	b8 21 00 00 00       	mov    $0x21,%eax
+  801993:	8b 55 08             	mov    0x8(%ebp),%edx
+  801996:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801999:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80199c:	89 f7                	mov    %esi,%edi
+  80199e:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8019a0:	5b                   	pop    %ebx
+  8019a1:	5e                   	pop    %esi
+  8019a2:	5f                   	pop    %edi
+  8019a3:	5d                   	pop    %ebp
+  8019a4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019ab:	b8 21 00 00 00       	mov    $0x21,%eax
+  8019b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019b8:	55                   	push   %ebp
+  8019b9:	89 e5                	mov    %esp,%ebp
+  8019bb:	8d 35 c3 19 80 00    	lea    0x8019c3,%esi
+  8019c1:	0f 34                	sysenter
+  8019c3:	5d                   	pop    %ebp
+		goto out;
+  8019c4:	eb da                	jmp    8019a0 <sys_meminfo+0x26>
+
+008019c6 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8019c6:	55                   	push   %ebp
+  8019c7:	89 e5                	mov    %esp,%ebp
+  8019c9:	57                   	push   %edi
+  8019ca:	56                   	push   %esi
+  8019cb:	53                   	push   %ebx
+  8019cc:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8019cf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8019d3:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8019da:	74 1f                	je     8019fb <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8019dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e1:	b8 22 00 00 00       	mov    $0x22,%eax
+  8019e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e9:	89 df                	mov    %ebx,%edi
+  8019eb:	89 de                	mov    %ebx,%esi
+  8019ed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019ef:	85 c0                	test   %eax,%eax
+  8019f1:	7f 25                	jg     801a18 <sys_env_set_ksm+0x52>
+}
+  8019f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019f6:	5b                   	pop    %ebx
+  8019f7:	5e                   	pop    %esi
+  8019f8:	5f                   	pop    %edi
+  8019f9:	5d                   	pop    %ebp
+  8019fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a00:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a03:	b8 22 00 00 00       	mov    $0x22,%eax
+  801a08:	89 df                	mov    %ebx,%edi
+  801a0a:	55                   	push   %ebp
+  801a0b:	89 e5                	mov    %esp,%ebp
+  801a0d:	8d 35 15 1a 80 00    	lea    0x801a15,%esi
+  801a13:	0f 34                	sysenter
+  801a15:	5d                   	pop    %ebp
+		goto out;
+  801a16:	eb d7                	jmp    8019ef <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a18:	83 ec 0c             	sub    $0xc,%esp
+  801a1b:	50                   	push   %eax
+  801a1c:	6a 22                	push   $0x22
+  801a1e:	68 6b 34 80 00       	push   $0x80346b
+  801a23:	6a 3f                	push   $0x3f
+  801a25:	68 88 34 80 00       	push   $0x803488
+  801a2a:	e8 6c eb ff ff       	call   80059b <_panic>
+
+00801a2f <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801a2f:	55                   	push   %ebp
+  801a30:	89 e5                	mov    %esp,%ebp
+  801a32:	57                   	push   %edi
+  801a33:	56                   	push   %esi
+  801a34:	53                   	push   %ebx
+  801a35:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801a38:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801a3b:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801a42:	74 24                	je     801a68 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801a44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a49:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a4e:	89 cb                	mov    %ecx,%ebx
+  801a50:	89 cf                	mov    %ecx,%edi
+  801a52:	89 ce                	mov    %ecx,%esi
+  801a54:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	7f 2a                	jg     801a84 <sys_time_nsec+0x55>
+	return ns;
+}
+  801a5a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a5d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a63:	5b                   	pop    %ebx
+  801a64:	5e                   	pop    %esi
+  801a65:	5f                   	pop    %edi
+  801a66:	5d                   	pop    %ebp
+  801a67:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a6d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a72:	89 cb                	mov    %ecx,%ebx
+  801a74:	89 cf                	mov    %ecx,%edi
+  801a76:	55                   	push   %ebp
+  801a77:	89 e5                	mov    %esp,%ebp
+  801a79:	8d 35 81 1a 80 00    	lea    0x801a81,%esi
+  801a7f:	0f 34                	sysenter
+  801a81:	5d                   	pop    %ebp
+		goto out;
+  801a82:	eb d2                	jmp    801a56 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a84:	83 ec 0c             	sub    $0xc,%esp
+  801a87:	50                   	push   %eax
+  801a88:	6a 0f                	push   $0xf
+  801a8a:	68 6b 34 80 00       	push   $0x80346b
+  801a8f:	6a 3f                	push   $0x3f
+  801a91:	68 88 34 80 00       	push   $0x803488
+  801a96:	e8 00 eb ff ff       	call   80059b <_panic>
+
+00801a9b <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	57                   	push   %edi
+  801a9f:	56                   	push   %esi
+  801aa0:	53                   	push   %ebx
+  801aa1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801aa4:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801aab:	74 22                	je     801acf <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801aad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab2:	b8 12 00 00 00       	mov    $0x12,%eax
+  801ab7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801abd:	89 df                	mov    %ebx,%edi
+  801abf:	89 de                	mov    %ebx,%esi
+  801ac1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ac3:	85 c0                	test   %eax,%eax
+  801ac5:	7f 28                	jg     801aef <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801ac7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aca:	5b                   	pop    %ebx
+  801acb:	5e                   	pop    %esi
+  801acc:	5f                   	pop    %edi
+  801acd:	5d                   	pop    %ebp
+  801ace:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801acf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ada:	b8 12 00 00 00       	mov    $0x12,%eax
+  801adf:	89 df                	mov    %ebx,%edi
+  801ae1:	55                   	push   %ebp
+  801ae2:	89 e5                	mov    %esp,%ebp
+  801ae4:	8d 35 ec 1a 80 00    	lea    0x801aec,%esi
+  801aea:	0f 34                	sysenter
+  801aec:	5d                   	pop    %ebp
+		goto out;
+  801aed:	eb d4                	jmp    801ac3 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801aef:	83 ec 0c             	sub    $0xc,%esp
+  801af2:	50                   	push   %eax
+  801af3:	6a 12                	push   $0x12
+  801af5:	68 6b 34 80 00       	push   $0x80346b
+  801afa:	6a 3f                	push   $0x3f
+  801afc:	68 88 34 80 00       	push   $0x803488
+  801b01:	e8 95 ea ff ff       	call   80059b <_panic>
+
+00801b06 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801b06:	55                   	push   %ebp
+  801b07:	89 e5                	mov    %esp,%ebp
+  801b09:	57                   	push   %edi
+  801b0a:	56                   	push   %esi
+  801b0b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b0c:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801b13:	74 1b                	je     801b30 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801b15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b1a:	b8 13 00 00 00       	mov    $0x13,%eax
+  801b1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b25:	89 df                	mov    %ebx,%edi
+  801b27:	89 de                	mov    %ebx,%esi
+  801b29:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801b2b:	5b                   	pop    %ebx
+  801b2c:	5e                   	pop    %esi
+  801b2d:	5f                   	pop    %edi
+  801b2e:	5d                   	pop    %ebp
+  801b2f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b3b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801b40:	89 df                	mov    %ebx,%edi
+  801b42:	55                   	push   %ebp
+  801b43:	89 e5                	mov    %esp,%ebp
+  801b45:	8d 35 4d 1b 80 00    	lea    0x801b4d,%esi
+  801b4b:	0f 34                	sysenter
+  801b4d:	5d                   	pop    %ebp
+		goto out;
+  801b4e:	eb db                	jmp    801b2b <sys_e1000_receive+0x25>
+
+00801b50 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801b50:	55                   	push   %ebp
+  801b51:	89 e5                	mov    %esp,%ebp
+  801b53:	57                   	push   %edi
+  801b54:	56                   	push   %esi
+  801b55:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b56:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801b5d:	74 1b                	je     801b7a <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801b5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b64:	b8 14 00 00 00       	mov    $0x14,%eax
+  801b69:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b6f:	89 df                	mov    %ebx,%edi
+  801b71:	89 de                	mov    %ebx,%esi
+  801b73:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801b75:	5b                   	pop    %ebx
+  801b76:	5e                   	pop    %esi
+  801b77:	5f                   	pop    %edi
+  801b78:	5d                   	pop    %ebp
+  801b79:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b85:	b8 14 00 00 00       	mov    $0x14,%eax
+  801b8a:	89 df                	mov    %ebx,%edi
+  801b8c:	55                   	push   %ebp
+  801b8d:	89 e5                	mov    %esp,%ebp
+  801b8f:	8d 35 97 1b 80 00    	lea    0x801b97,%esi
+  801b95:	0f 34                	sysenter
+  801b97:	5d                   	pop    %ebp
+		goto out;
+  801b98:	eb db                	jmp    801b75 <sys_e1000_read_hwaddr+0x25>
+
+00801b9a <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801b9a:	55                   	push   %ebp
+  801b9b:	89 e5                	mov    %esp,%ebp
+  801b9d:	57                   	push   %edi
+  801b9e:	56                   	push   %esi
+  801b9f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801ba0:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801ba7:	74 1a                	je     801bc3 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801ba9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bae:	b8 15 00 00 00       	mov    $0x15,%eax
+  801bb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb6:	89 cb                	mov    %ecx,%ebx
+  801bb8:	89 cf                	mov    %ecx,%edi
+  801bba:	89 ce                	mov    %ecx,%esi
+  801bbc:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801bbe:	5b                   	pop    %ebx
+  801bbf:	5e                   	pop    %esi
+  801bc0:	5f                   	pop    %edi
+  801bc1:	5d                   	pop    %ebp
+  801bc2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801bc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bcb:	b8 15 00 00 00       	mov    $0x15,%eax
+  801bd0:	89 cb                	mov    %ecx,%ebx
+  801bd2:	89 cf                	mov    %ecx,%edi
+  801bd4:	55                   	push   %ebp
+  801bd5:	89 e5                	mov    %esp,%ebp
+  801bd7:	8d 35 df 1b 80 00    	lea    0x801bdf,%esi
+  801bdd:	0f 34                	sysenter
+  801bdf:	5d                   	pop    %ebp
+		goto out;
+  801be0:	eb dc                	jmp    801bbe <sys_sb16_read_version+0x24>
+
+00801be2 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801be2:	55                   	push   %ebp
+  801be3:	89 e5                	mov    %esp,%ebp
+  801be5:	57                   	push   %edi
+  801be6:	56                   	push   %esi
+  801be7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801be8:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801bef:	74 1b                	je     801c0c <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801bf1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf6:	b8 16 00 00 00       	mov    $0x16,%eax
+  801bfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c01:	89 df                	mov    %ebx,%edi
+  801c03:	89 de                	mov    %ebx,%esi
+  801c05:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801c07:	5b                   	pop    %ebx
+  801c08:	5e                   	pop    %esi
+  801c09:	5f                   	pop    %edi
+  801c0a:	5d                   	pop    %ebp
+  801c0b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c11:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c17:	b8 16 00 00 00       	mov    $0x16,%eax
+  801c1c:	89 df                	mov    %ebx,%edi
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+  801c21:	8d 35 29 1c 80 00    	lea    0x801c29,%esi
+  801c27:	0f 34                	sysenter
+  801c29:	5d                   	pop    %ebp
+		goto out;
+  801c2a:	eb db                	jmp    801c07 <sys_sb16_play+0x25>
+
+00801c2c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801c2c:	55                   	push   %ebp
+  801c2d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c32:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c37:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801c3a:	5d                   	pop    %ebp
+  801c3b:	c3                   	ret
+
+00801c3c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c42:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801c47:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c4c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801c51:	5d                   	pop    %ebp
+  801c52:	c3                   	ret
+
+00801c53 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801c53:	55                   	push   %ebp
+  801c54:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801c56:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801c5b:	eb 02                	jmp    801c5f <fd_alloc+0xc>
+  801c5d:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c5f:	89 c2                	mov    %eax,%edx
+  801c61:	c1 ea 16             	shr    $0x16,%edx
+  801c64:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c6b:	f6 c2 01             	test   $0x1,%dl
+  801c6e:	74 2b                	je     801c9b <fd_alloc+0x48>
+  801c70:	89 c2                	mov    %eax,%edx
+  801c72:	c1 ea 0c             	shr    $0xc,%edx
+  801c75:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801c7c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c82:	f6 c1 01             	test   $0x1,%cl
+  801c85:	74 14                	je     801c9b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801c87:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801c8d:	75 ce                	jne    801c5d <fd_alloc+0xa>
+  801c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801c94:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c99:	eb 05                	jmp    801ca0 <fd_alloc+0x4d>
+			return 0;
+  801c9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ca3:	89 02                	mov    %eax,(%edx)
+}
+  801ca5:	89 c8                	mov    %ecx,%eax
+  801ca7:	5d                   	pop    %ebp
+  801ca8:	c3                   	ret
+
+00801ca9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801ca9:	55                   	push   %ebp
+  801caa:	89 e5                	mov    %esp,%ebp
+  801cac:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801caf:	83 f8 1f             	cmp    $0x1f,%eax
+  801cb2:	77 30                	ja     801ce4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801cb4:	c1 e0 0c             	shl    $0xc,%eax
+  801cb7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801cbc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801cc2:	f6 c2 01             	test   $0x1,%dl
+  801cc5:	74 24                	je     801ceb <fd_lookup+0x42>
+  801cc7:	89 c2                	mov    %eax,%edx
+  801cc9:	c1 ea 0c             	shr    $0xc,%edx
+  801ccc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801cd3:	f6 c2 01             	test   $0x1,%dl
+  801cd6:	74 1a                	je     801cf2 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801cd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cdb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ce2:	5d                   	pop    %ebp
+  801ce3:	c3                   	ret
+		return -E_INVAL;
+  801ce4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce9:	eb f7                	jmp    801ce2 <fd_lookup+0x39>
+		return -E_INVAL;
+  801ceb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf0:	eb f0                	jmp    801ce2 <fd_lookup+0x39>
+  801cf2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cf7:	eb e9                	jmp    801ce2 <fd_lookup+0x39>
+
+00801cf9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801cf9:	55                   	push   %ebp
+  801cfa:	89 e5                	mov    %esp,%ebp
+  801cfc:	53                   	push   %ebx
+  801cfd:	83 ec 04             	sub    $0x4,%esp
+  801d00:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801d03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d08:	eb 03                	jmp    801d0d <dev_lookup+0x14>
+  801d0a:	83 c0 01             	add    $0x1,%eax
+  801d0d:	8b 1c 85 14 35 80 00 	mov    0x803514(,%eax,4),%ebx
+  801d14:	85 db                	test   %ebx,%ebx
+  801d16:	74 0b                	je     801d23 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801d18:	39 13                	cmp    %edx,(%ebx)
+  801d1a:	75 ee                	jne    801d0a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801d1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d21:	eb 2e                	jmp    801d51 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801d23:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d25:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801d2a:	8b 0d 18 50 80 00    	mov    0x805018,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d30:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d35:	76 24                	jbe    801d5b <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d37:	8b 41 48             	mov    0x48(%ecx),%eax
+  801d3a:	83 ec 04             	sub    $0x4,%esp
+  801d3d:	52                   	push   %edx
+  801d3e:	50                   	push   %eax
+  801d3f:	68 98 34 80 00       	push   $0x803498
+  801d44:	e8 2d e9 ff ff       	call   800676 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801d49:	83 c4 10             	add    $0x10,%esp
+  801d4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801d51:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d54:	89 1a                	mov    %ebx,(%edx)
+}
+  801d56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d59:	c9                   	leave
+  801d5a:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d5b:	c1 e8 10             	shr    $0x10,%eax
+  801d5e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d64:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801d6a:	eb cb                	jmp    801d37 <dev_lookup+0x3e>
+
+00801d6c <fd_close>:
+{
+  801d6c:	55                   	push   %ebp
+  801d6d:	89 e5                	mov    %esp,%ebp
+  801d6f:	57                   	push   %edi
+  801d70:	56                   	push   %esi
+  801d71:	53                   	push   %ebx
+  801d72:	83 ec 24             	sub    $0x24,%esp
+  801d75:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d78:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d7b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d7e:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d7f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d85:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d88:	50                   	push   %eax
+  801d89:	e8 1b ff ff ff       	call   801ca9 <fd_lookup>
+  801d8e:	89 c3                	mov    %eax,%ebx
+  801d90:	83 c4 10             	add    $0x10,%esp
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	78 05                	js     801d9c <fd_close+0x30>
+	    || fd != fd2)
+  801d97:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d9a:	74 16                	je     801db2 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801d9c:	89 f8                	mov    %edi,%eax
+  801d9e:	84 c0                	test   %al,%al
+  801da0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da5:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801da8:	89 d8                	mov    %ebx,%eax
+  801daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dad:	5b                   	pop    %ebx
+  801dae:	5e                   	pop    %esi
+  801daf:	5f                   	pop    %edi
+  801db0:	5d                   	pop    %ebp
+  801db1:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801db2:	83 ec 08             	sub    $0x8,%esp
+  801db5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801db8:	50                   	push   %eax
+  801db9:	ff 36                	push   (%esi)
+  801dbb:	e8 39 ff ff ff       	call   801cf9 <dev_lookup>
+  801dc0:	89 c3                	mov    %eax,%ebx
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 1a                	js     801de3 <fd_close+0x77>
+		if (dev->dev_close)
+  801dc9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801dcc:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801dcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	74 0b                	je     801de3 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801dd8:	83 ec 0c             	sub    $0xc,%esp
+  801ddb:	56                   	push   %esi
+  801ddc:	ff d0                	call   *%eax
+  801dde:	89 c3                	mov    %eax,%ebx
+  801de0:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801de3:	83 ec 08             	sub    $0x8,%esp
+  801de6:	56                   	push   %esi
+  801de7:	6a 00                	push   $0x0
+  801de9:	e8 a3 f4 ff ff       	call   801291 <sys_page_unmap>
+	return r;
+  801dee:	83 c4 10             	add    $0x10,%esp
+  801df1:	eb b5                	jmp    801da8 <fd_close+0x3c>
+
+00801df3 <close>:
+
+int
+close(int fdnum)
+{
+  801df3:	55                   	push   %ebp
+  801df4:	89 e5                	mov    %esp,%ebp
+  801df6:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801df9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dfc:	50                   	push   %eax
+  801dfd:	ff 75 08             	push   0x8(%ebp)
+  801e00:	e8 a4 fe ff ff       	call   801ca9 <fd_lookup>
+  801e05:	83 c4 10             	add    $0x10,%esp
+  801e08:	85 c0                	test   %eax,%eax
+  801e0a:	79 02                	jns    801e0e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801e0c:	c9                   	leave
+  801e0d:	c3                   	ret
+		return fd_close(fd, 1);
+  801e0e:	83 ec 08             	sub    $0x8,%esp
+  801e11:	6a 01                	push   $0x1
+  801e13:	ff 75 f4             	push   -0xc(%ebp)
+  801e16:	e8 51 ff ff ff       	call   801d6c <fd_close>
+  801e1b:	83 c4 10             	add    $0x10,%esp
+  801e1e:	eb ec                	jmp    801e0c <close+0x19>
+
+00801e20 <close_all>:
+
+void
+close_all(void)
+{
+  801e20:	55                   	push   %ebp
+  801e21:	89 e5                	mov    %esp,%ebp
+  801e23:	53                   	push   %ebx
+  801e24:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801e27:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801e2c:	83 ec 0c             	sub    $0xc,%esp
+  801e2f:	53                   	push   %ebx
+  801e30:	e8 be ff ff ff       	call   801df3 <close>
+	for (i = 0; i < MAXFD; i++)
+  801e35:	83 c3 01             	add    $0x1,%ebx
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	83 fb 20             	cmp    $0x20,%ebx
+  801e3e:	75 ec                	jne    801e2c <close_all+0xc>
+}
+  801e40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e43:	c9                   	leave
+  801e44:	c3                   	ret
+
+00801e45 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	57                   	push   %edi
+  801e49:	56                   	push   %esi
+  801e4a:	53                   	push   %ebx
+  801e4b:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801e4e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e51:	50                   	push   %eax
+  801e52:	ff 75 08             	push   0x8(%ebp)
+  801e55:	e8 4f fe ff ff       	call   801ca9 <fd_lookup>
+  801e5a:	89 c3                	mov    %eax,%ebx
+  801e5c:	83 c4 10             	add    $0x10,%esp
+  801e5f:	85 c0                	test   %eax,%eax
+  801e61:	78 7f                	js     801ee2 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801e63:	83 ec 0c             	sub    $0xc,%esp
+  801e66:	ff 75 0c             	push   0xc(%ebp)
+  801e69:	e8 85 ff ff ff       	call   801df3 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e6e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e71:	c1 e6 0c             	shl    $0xc,%esi
+  801e74:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801e7a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e7d:	89 3c 24             	mov    %edi,(%esp)
+  801e80:	e8 b7 fd ff ff       	call   801c3c <fd2data>
+  801e85:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e87:	89 34 24             	mov    %esi,(%esp)
+  801e8a:	e8 ad fd ff ff       	call   801c3c <fd2data>
+  801e8f:	83 c4 10             	add    $0x10,%esp
+  801e92:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801e95:	89 d8                	mov    %ebx,%eax
+  801e97:	c1 e8 16             	shr    $0x16,%eax
+  801e9a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ea1:	a8 01                	test   $0x1,%al
+  801ea3:	74 11                	je     801eb6 <dup+0x71>
+  801ea5:	89 d8                	mov    %ebx,%eax
+  801ea7:	c1 e8 0c             	shr    $0xc,%eax
+  801eaa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801eb1:	f6 c2 01             	test   $0x1,%dl
+  801eb4:	75 36                	jne    801eec <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801eb6:	89 f8                	mov    %edi,%eax
+  801eb8:	c1 e8 0c             	shr    $0xc,%eax
+  801ebb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ec2:	83 ec 0c             	sub    $0xc,%esp
+  801ec5:	25 07 0e 00 00       	and    $0xe07,%eax
+  801eca:	50                   	push   %eax
+  801ecb:	56                   	push   %esi
+  801ecc:	6a 00                	push   $0x0
+  801ece:	57                   	push   %edi
+  801ecf:	6a 00                	push   $0x0
+  801ed1:	e8 4d f3 ff ff       	call   801223 <sys_page_map>
+  801ed6:	89 c3                	mov    %eax,%ebx
+  801ed8:	83 c4 20             	add    $0x20,%esp
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	78 33                	js     801f12 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801edf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801ee2:	89 d8                	mov    %ebx,%eax
+  801ee4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee7:	5b                   	pop    %ebx
+  801ee8:	5e                   	pop    %esi
+  801ee9:	5f                   	pop    %edi
+  801eea:	5d                   	pop    %ebp
+  801eeb:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801eec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ef3:	83 ec 0c             	sub    $0xc,%esp
+  801ef6:	25 07 0e 00 00       	and    $0xe07,%eax
+  801efb:	50                   	push   %eax
+  801efc:	ff 75 d4             	push   -0x2c(%ebp)
+  801eff:	6a 00                	push   $0x0
+  801f01:	53                   	push   %ebx
+  801f02:	6a 00                	push   $0x0
+  801f04:	e8 1a f3 ff ff       	call   801223 <sys_page_map>
+  801f09:	89 c3                	mov    %eax,%ebx
+  801f0b:	83 c4 20             	add    $0x20,%esp
+  801f0e:	85 c0                	test   %eax,%eax
+  801f10:	79 a4                	jns    801eb6 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801f12:	83 ec 08             	sub    $0x8,%esp
+  801f15:	56                   	push   %esi
+  801f16:	6a 00                	push   $0x0
+  801f18:	e8 74 f3 ff ff       	call   801291 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801f1d:	83 c4 08             	add    $0x8,%esp
+  801f20:	ff 75 d4             	push   -0x2c(%ebp)
+  801f23:	6a 00                	push   $0x0
+  801f25:	e8 67 f3 ff ff       	call   801291 <sys_page_unmap>
+	return r;
+  801f2a:	83 c4 10             	add    $0x10,%esp
+  801f2d:	eb b3                	jmp    801ee2 <dup+0x9d>
+
+00801f2f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801f2f:	55                   	push   %ebp
+  801f30:	89 e5                	mov    %esp,%ebp
+  801f32:	56                   	push   %esi
+  801f33:	53                   	push   %ebx
+  801f34:	83 ec 18             	sub    $0x18,%esp
+  801f37:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f3a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f3d:	50                   	push   %eax
+  801f3e:	53                   	push   %ebx
+  801f3f:	e8 65 fd ff ff       	call   801ca9 <fd_lookup>
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	78 3c                	js     801f87 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f4b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f4e:	83 ec 08             	sub    $0x8,%esp
+  801f51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f54:	50                   	push   %eax
+  801f55:	ff 36                	push   (%esi)
+  801f57:	e8 9d fd ff ff       	call   801cf9 <dev_lookup>
+  801f5c:	83 c4 10             	add    $0x10,%esp
+  801f5f:	85 c0                	test   %eax,%eax
+  801f61:	78 24                	js     801f87 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f63:	8b 46 08             	mov    0x8(%esi),%eax
+  801f66:	83 e0 03             	and    $0x3,%eax
+  801f69:	83 f8 01             	cmp    $0x1,%eax
+  801f6c:	74 20                	je     801f8e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f71:	8b 40 08             	mov    0x8(%eax),%eax
+  801f74:	85 c0                	test   %eax,%eax
+  801f76:	74 57                	je     801fcf <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801f78:	83 ec 04             	sub    $0x4,%esp
+  801f7b:	ff 75 10             	push   0x10(%ebp)
+  801f7e:	ff 75 0c             	push   0xc(%ebp)
+  801f81:	56                   	push   %esi
+  801f82:	ff d0                	call   *%eax
+  801f84:	83 c4 10             	add    $0x10,%esp
+}
+  801f87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f8a:	5b                   	pop    %ebx
+  801f8b:	5e                   	pop    %esi
+  801f8c:	5d                   	pop    %ebp
+  801f8d:	c3                   	ret
+  801f8e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801f90:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801f95:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801f9b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801fa0:	76 1c                	jbe    801fbe <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fa2:	8b 42 48             	mov    0x48(%edx),%eax
+  801fa5:	83 ec 04             	sub    $0x4,%esp
+  801fa8:	53                   	push   %ebx
+  801fa9:	50                   	push   %eax
+  801faa:	68 d9 34 80 00       	push   $0x8034d9
+  801faf:	e8 c2 e6 ff ff       	call   800676 <cprintf>
+		return -E_INVAL;
+  801fb4:	83 c4 10             	add    $0x10,%esp
+  801fb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fbc:	eb c9                	jmp    801f87 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801fbe:	c1 e8 10             	shr    $0x10,%eax
+  801fc1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801fc7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801fcd:	eb d3                	jmp    801fa2 <read+0x73>
+		return -E_NOT_SUPP;
+  801fcf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fd4:	eb b1                	jmp    801f87 <read+0x58>
+
+00801fd6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801fd6:	55                   	push   %ebp
+  801fd7:	89 e5                	mov    %esp,%ebp
+  801fd9:	57                   	push   %edi
+  801fda:	56                   	push   %esi
+  801fdb:	53                   	push   %ebx
+  801fdc:	83 ec 0c             	sub    $0xc,%esp
+  801fdf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fe2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801fe5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fea:	eb 02                	jmp    801fee <readn+0x18>
+  801fec:	01 c3                	add    %eax,%ebx
+  801fee:	39 f3                	cmp    %esi,%ebx
+  801ff0:	73 21                	jae    802013 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ff2:	83 ec 04             	sub    $0x4,%esp
+  801ff5:	89 f0                	mov    %esi,%eax
+  801ff7:	29 d8                	sub    %ebx,%eax
+  801ff9:	50                   	push   %eax
+  801ffa:	89 d8                	mov    %ebx,%eax
+  801ffc:	03 45 0c             	add    0xc(%ebp),%eax
+  801fff:	50                   	push   %eax
+  802000:	57                   	push   %edi
+  802001:	e8 29 ff ff ff       	call   801f2f <read>
+		if (m < 0)
+  802006:	83 c4 10             	add    $0x10,%esp
+  802009:	85 c0                	test   %eax,%eax
+  80200b:	78 04                	js     802011 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80200d:	75 dd                	jne    801fec <readn+0x16>
+  80200f:	eb 02                	jmp    802013 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802011:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802013:	89 d8                	mov    %ebx,%eax
+  802015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802018:	5b                   	pop    %ebx
+  802019:	5e                   	pop    %esi
+  80201a:	5f                   	pop    %edi
+  80201b:	5d                   	pop    %ebp
+  80201c:	c3                   	ret
+
+0080201d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	56                   	push   %esi
+  802021:	53                   	push   %ebx
+  802022:	83 ec 18             	sub    $0x18,%esp
+  802025:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802028:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80202b:	50                   	push   %eax
+  80202c:	53                   	push   %ebx
+  80202d:	e8 77 fc ff ff       	call   801ca9 <fd_lookup>
+  802032:	83 c4 10             	add    $0x10,%esp
+  802035:	85 c0                	test   %eax,%eax
+  802037:	78 37                	js     802070 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802039:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80203c:	83 ec 08             	sub    $0x8,%esp
+  80203f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802042:	50                   	push   %eax
+  802043:	ff 36                	push   (%esi)
+  802045:	e8 af fc ff ff       	call   801cf9 <dev_lookup>
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 1f                	js     802070 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802051:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802055:	74 20                	je     802077 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802057:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80205a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80205d:	85 c0                	test   %eax,%eax
+  80205f:	74 57                	je     8020b8 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802061:	83 ec 04             	sub    $0x4,%esp
+  802064:	ff 75 10             	push   0x10(%ebp)
+  802067:	ff 75 0c             	push   0xc(%ebp)
+  80206a:	56                   	push   %esi
+  80206b:	ff d0                	call   *%eax
+  80206d:	83 c4 10             	add    $0x10,%esp
+}
+  802070:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802073:	5b                   	pop    %ebx
+  802074:	5e                   	pop    %esi
+  802075:	5d                   	pop    %ebp
+  802076:	c3                   	ret
+  802077:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802079:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80207e:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802084:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802089:	76 1c                	jbe    8020a7 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80208b:	8b 42 48             	mov    0x48(%edx),%eax
+  80208e:	83 ec 04             	sub    $0x4,%esp
+  802091:	53                   	push   %ebx
+  802092:	50                   	push   %eax
+  802093:	68 f5 34 80 00       	push   $0x8034f5
+  802098:	e8 d9 e5 ff ff       	call   800676 <cprintf>
+		return -E_INVAL;
+  80209d:	83 c4 10             	add    $0x10,%esp
+  8020a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020a5:	eb c9                	jmp    802070 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8020a7:	c1 e8 10             	shr    $0x10,%eax
+  8020aa:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8020b0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8020b6:	eb d3                	jmp    80208b <write+0x6e>
+		return -E_NOT_SUPP;
+  8020b8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020bd:	eb b1                	jmp    802070 <write+0x53>
+
+008020bf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8020bf:	55                   	push   %ebp
+  8020c0:	89 e5                	mov    %esp,%ebp
+  8020c2:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020c8:	50                   	push   %eax
+  8020c9:	ff 75 08             	push   0x8(%ebp)
+  8020cc:	e8 d8 fb ff ff       	call   801ca9 <fd_lookup>
+  8020d1:	83 c4 10             	add    $0x10,%esp
+  8020d4:	85 c0                	test   %eax,%eax
+  8020d6:	78 0e                	js     8020e6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8020d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020de:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8020e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020e6:	c9                   	leave
+  8020e7:	c3                   	ret
+
+008020e8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8020e8:	55                   	push   %ebp
+  8020e9:	89 e5                	mov    %esp,%ebp
+  8020eb:	56                   	push   %esi
+  8020ec:	53                   	push   %ebx
+  8020ed:	83 ec 18             	sub    $0x18,%esp
+  8020f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020f6:	50                   	push   %eax
+  8020f7:	53                   	push   %ebx
+  8020f8:	e8 ac fb ff ff       	call   801ca9 <fd_lookup>
+  8020fd:	83 c4 10             	add    $0x10,%esp
+  802100:	85 c0                	test   %eax,%eax
+  802102:	78 34                	js     802138 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802104:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802107:	83 ec 08             	sub    $0x8,%esp
+  80210a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80210d:	50                   	push   %eax
+  80210e:	ff 36                	push   (%esi)
+  802110:	e8 e4 fb ff ff       	call   801cf9 <dev_lookup>
+  802115:	83 c4 10             	add    $0x10,%esp
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	78 1c                	js     802138 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80211c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802120:	74 1d                	je     80213f <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802122:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802125:	8b 40 18             	mov    0x18(%eax),%eax
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	74 54                	je     802180 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80212c:	83 ec 08             	sub    $0x8,%esp
+  80212f:	ff 75 0c             	push   0xc(%ebp)
+  802132:	56                   	push   %esi
+  802133:	ff d0                	call   *%eax
+  802135:	83 c4 10             	add    $0x10,%esp
+}
+  802138:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80213b:	5b                   	pop    %ebx
+  80213c:	5e                   	pop    %esi
+  80213d:	5d                   	pop    %ebp
+  80213e:	c3                   	ret
+  80213f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802141:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802146:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80214c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802151:	76 1c                	jbe    80216f <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802153:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802156:	83 ec 04             	sub    $0x4,%esp
+  802159:	53                   	push   %ebx
+  80215a:	50                   	push   %eax
+  80215b:	68 b8 34 80 00       	push   $0x8034b8
+  802160:	e8 11 e5 ff ff       	call   800676 <cprintf>
+		return -E_INVAL;
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80216d:	eb c9                	jmp    802138 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80216f:	c1 e8 10             	shr    $0x10,%eax
+  802172:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802178:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80217e:	eb d3                	jmp    802153 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802180:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802185:	eb b1                	jmp    802138 <ftruncate+0x50>
+
+00802187 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802187:	55                   	push   %ebp
+  802188:	89 e5                	mov    %esp,%ebp
+  80218a:	56                   	push   %esi
+  80218b:	53                   	push   %ebx
+  80218c:	83 ec 18             	sub    $0x18,%esp
+  80218f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802192:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802195:	50                   	push   %eax
+  802196:	ff 75 08             	push   0x8(%ebp)
+  802199:	e8 0b fb ff ff       	call   801ca9 <fd_lookup>
+  80219e:	83 c4 10             	add    $0x10,%esp
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 49                	js     8021ee <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021a5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021a8:	83 ec 08             	sub    $0x8,%esp
+  8021ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021ae:	50                   	push   %eax
+  8021af:	ff 36                	push   (%esi)
+  8021b1:	e8 43 fb ff ff       	call   801cf9 <dev_lookup>
+  8021b6:	83 c4 10             	add    $0x10,%esp
+  8021b9:	85 c0                	test   %eax,%eax
+  8021bb:	78 31                	js     8021ee <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8021bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8021c4:	74 2f                	je     8021f5 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8021c6:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8021c9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8021d0:	00 00 00 
+	stat->st_isdir = 0;
+  8021d3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021da:	00 00 00 
+	stat->st_dev = dev;
+  8021dd:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8021e3:	83 ec 08             	sub    $0x8,%esp
+  8021e6:	53                   	push   %ebx
+  8021e7:	56                   	push   %esi
+  8021e8:	ff 50 14             	call   *0x14(%eax)
+  8021eb:	83 c4 10             	add    $0x10,%esp
+}
+  8021ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f1:	5b                   	pop    %ebx
+  8021f2:	5e                   	pop    %esi
+  8021f3:	5d                   	pop    %ebp
+  8021f4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021fa:	eb f2                	jmp    8021ee <fstat+0x67>
+
+008021fc <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8021fc:	55                   	push   %ebp
+  8021fd:	89 e5                	mov    %esp,%ebp
+  8021ff:	56                   	push   %esi
+  802200:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802201:	83 ec 08             	sub    $0x8,%esp
+  802204:	6a 00                	push   $0x0
+  802206:	ff 75 08             	push   0x8(%ebp)
+  802209:	e8 e4 01 00 00       	call   8023f2 <open>
+  80220e:	89 c3                	mov    %eax,%ebx
+  802210:	83 c4 10             	add    $0x10,%esp
+  802213:	85 c0                	test   %eax,%eax
+  802215:	78 1b                	js     802232 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802217:	83 ec 08             	sub    $0x8,%esp
+  80221a:	ff 75 0c             	push   0xc(%ebp)
+  80221d:	50                   	push   %eax
+  80221e:	e8 64 ff ff ff       	call   802187 <fstat>
+  802223:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802225:	89 1c 24             	mov    %ebx,(%esp)
+  802228:	e8 c6 fb ff ff       	call   801df3 <close>
+	return r;
+  80222d:	83 c4 10             	add    $0x10,%esp
+  802230:	89 f3                	mov    %esi,%ebx
+}
+  802232:	89 d8                	mov    %ebx,%eax
+  802234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802237:	5b                   	pop    %ebx
+  802238:	5e                   	pop    %esi
+  802239:	5d                   	pop    %ebp
+  80223a:	c3                   	ret
+
+0080223b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80223b:	55                   	push   %ebp
+  80223c:	89 e5                	mov    %esp,%ebp
+  80223e:	56                   	push   %esi
+  80223f:	53                   	push   %ebx
+  802240:	89 c6                	mov    %eax,%esi
+  802242:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802244:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  80224b:	74 27                	je     802274 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80224d:	6a 07                	push   $0x7
+  80224f:	68 00 60 80 00       	push   $0x806000
+  802254:	56                   	push   %esi
+  802255:	ff 35 10 50 80 00    	push   0x805010
+  80225b:	e8 b2 0c 00 00       	call   802f12 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802260:	83 c4 0c             	add    $0xc,%esp
+  802263:	6a 00                	push   $0x0
+  802265:	53                   	push   %ebx
+  802266:	6a 00                	push   $0x0
+  802268:	e8 8d 0c 00 00       	call   802efa <ipc_recv>
+}
+  80226d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802270:	5b                   	pop    %ebx
+  802271:	5e                   	pop    %esi
+  802272:	5d                   	pop    %ebp
+  802273:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802274:	83 ec 0c             	sub    $0xc,%esp
+  802277:	6a 01                	push   $0x1
+  802279:	e8 e8 0c 00 00       	call   802f66 <ipc_find_env>
+  80227e:	a3 10 50 80 00       	mov    %eax,0x805010
+  802283:	83 c4 10             	add    $0x10,%esp
+  802286:	eb c5                	jmp    80224d <fsipc+0x12>
+
+00802288 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802288:	55                   	push   %ebp
+  802289:	89 e5                	mov    %esp,%ebp
+  80228b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80228e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802291:	8b 40 0c             	mov    0xc(%eax),%eax
+  802294:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802299:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80229c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8022a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022ab:	e8 8b ff ff ff       	call   80223b <fsipc>
+}
+  8022b0:	c9                   	leave
+  8022b1:	c3                   	ret
+
+008022b2 <devfile_flush>:
+{
+  8022b2:	55                   	push   %ebp
+  8022b3:	89 e5                	mov    %esp,%ebp
+  8022b5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022be:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8022c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022cd:	e8 69 ff ff ff       	call   80223b <fsipc>
+}
+  8022d2:	c9                   	leave
+  8022d3:	c3                   	ret
+
+008022d4 <devfile_stat>:
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	53                   	push   %ebx
+  8022d8:	83 ec 04             	sub    $0x4,%esp
+  8022db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022e4:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8022e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ee:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022f3:	e8 43 ff ff ff       	call   80223b <fsipc>
+  8022f8:	85 c0                	test   %eax,%eax
+  8022fa:	78 2c                	js     802328 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8022fc:	83 ec 08             	sub    $0x8,%esp
+  8022ff:	68 00 60 80 00       	push   $0x806000
+  802304:	53                   	push   %ebx
+  802305:	e8 b4 e9 ff ff       	call   800cbe <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80230a:	a1 80 60 80 00       	mov    0x806080,%eax
+  80230f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802315:	a1 84 60 80 00       	mov    0x806084,%eax
+  80231a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802320:	83 c4 10             	add    $0x10,%esp
+  802323:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80232b:	c9                   	leave
+  80232c:	c3                   	ret
+
+0080232d <devfile_write>:
+{
+  80232d:	55                   	push   %ebp
+  80232e:	89 e5                	mov    %esp,%ebp
+  802330:	83 ec 0c             	sub    $0xc,%esp
+  802333:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802336:	8b 55 08             	mov    0x8(%ebp),%edx
+  802339:	8b 52 0c             	mov    0xc(%edx),%edx
+  80233c:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802342:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  802347:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80234c:	39 d0                	cmp    %edx,%eax
+  80234e:	0f 47 c2             	cmova  %edx,%eax
+  802351:	50                   	push   %eax
+  802352:	ff 75 0c             	push   0xc(%ebp)
+  802355:	68 08 60 80 00       	push   $0x806008
+  80235a:	e8 e5 ea ff ff       	call   800e44 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80235f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802364:	b8 04 00 00 00       	mov    $0x4,%eax
+  802369:	e8 cd fe ff ff       	call   80223b <fsipc>
+}
+  80236e:	c9                   	leave
+  80236f:	c3                   	ret
+
+00802370 <devfile_read>:
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+  802373:	56                   	push   %esi
+  802374:	53                   	push   %ebx
+  802375:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802378:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80237e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802383:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802389:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802393:	e8 a3 fe ff ff       	call   80223b <fsipc>
+  802398:	89 c3                	mov    %eax,%ebx
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 1f                	js     8023bd <devfile_read+0x4d>
+	assert(r <= n);
+  80239e:	39 c6                	cmp    %eax,%esi
+  8023a0:	72 24                	jb     8023c6 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8023a2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023a7:	7f 33                	jg     8023dc <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023a9:	83 ec 04             	sub    $0x4,%esp
+  8023ac:	50                   	push   %eax
+  8023ad:	68 00 60 80 00       	push   $0x806000
+  8023b2:	ff 75 0c             	push   0xc(%ebp)
+  8023b5:	e8 8a ea ff ff       	call   800e44 <memmove>
+	return r;
+  8023ba:	83 c4 10             	add    $0x10,%esp
+}
+  8023bd:	89 d8                	mov    %ebx,%eax
+  8023bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c2:	5b                   	pop    %ebx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5d                   	pop    %ebp
+  8023c5:	c3                   	ret
+	assert(r <= n);
+  8023c6:	68 28 35 80 00       	push   $0x803528
+  8023cb:	68 2f 35 80 00       	push   $0x80352f
+  8023d0:	6a 76                	push   $0x76
+  8023d2:	68 44 35 80 00       	push   $0x803544
+  8023d7:	e8 bf e1 ff ff       	call   80059b <_panic>
+	assert(r <= PGSIZE);
+  8023dc:	68 4f 35 80 00       	push   $0x80354f
+  8023e1:	68 2f 35 80 00       	push   $0x80352f
+  8023e6:	6a 77                	push   $0x77
+  8023e8:	68 44 35 80 00       	push   $0x803544
+  8023ed:	e8 a9 e1 ff ff       	call   80059b <_panic>
+
+008023f2 <open>:
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	56                   	push   %esi
+  8023f6:	53                   	push   %ebx
+  8023f7:	83 ec 1c             	sub    $0x1c,%esp
+  8023fa:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8023fd:	56                   	push   %esi
+  8023fe:	e8 80 e8 ff ff       	call   800c83 <strlen>
+  802403:	83 c4 10             	add    $0x10,%esp
+  802406:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80240b:	7f 6c                	jg     802479 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80240d:	83 ec 0c             	sub    $0xc,%esp
+  802410:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802413:	50                   	push   %eax
+  802414:	e8 3a f8 ff ff       	call   801c53 <fd_alloc>
+  802419:	89 c3                	mov    %eax,%ebx
+  80241b:	83 c4 10             	add    $0x10,%esp
+  80241e:	85 c0                	test   %eax,%eax
+  802420:	78 3c                	js     80245e <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802422:	83 ec 08             	sub    $0x8,%esp
+  802425:	56                   	push   %esi
+  802426:	68 00 60 80 00       	push   $0x806000
+  80242b:	e8 8e e8 ff ff       	call   800cbe <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802430:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802433:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802438:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80243b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802440:	e8 f6 fd ff ff       	call   80223b <fsipc>
+  802445:	89 c3                	mov    %eax,%ebx
+  802447:	83 c4 10             	add    $0x10,%esp
+  80244a:	85 c0                	test   %eax,%eax
+  80244c:	78 19                	js     802467 <open+0x75>
+	return fd2num(fd);
+  80244e:	83 ec 0c             	sub    $0xc,%esp
+  802451:	ff 75 f4             	push   -0xc(%ebp)
+  802454:	e8 d3 f7 ff ff       	call   801c2c <fd2num>
+  802459:	89 c3                	mov    %eax,%ebx
+  80245b:	83 c4 10             	add    $0x10,%esp
+}
+  80245e:	89 d8                	mov    %ebx,%eax
+  802460:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802463:	5b                   	pop    %ebx
+  802464:	5e                   	pop    %esi
+  802465:	5d                   	pop    %ebp
+  802466:	c3                   	ret
+		fd_close(fd, 0);
+  802467:	83 ec 08             	sub    $0x8,%esp
+  80246a:	6a 00                	push   $0x0
+  80246c:	ff 75 f4             	push   -0xc(%ebp)
+  80246f:	e8 f8 f8 ff ff       	call   801d6c <fd_close>
+		return r;
+  802474:	83 c4 10             	add    $0x10,%esp
+  802477:	eb e5                	jmp    80245e <open+0x6c>
+		return -E_BAD_PATH;
+  802479:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80247e:	eb de                	jmp    80245e <open+0x6c>
+
+00802480 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802480:	55                   	push   %ebp
+  802481:	89 e5                	mov    %esp,%ebp
+  802483:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802490:	e8 a6 fd ff ff       	call   80223b <fsipc>
+}
+  802495:	c9                   	leave
+  802496:	c3                   	ret
+
+00802497 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802497:	55                   	push   %ebp
+  802498:	89 e5                	mov    %esp,%ebp
+  80249a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80249d:	68 5b 35 80 00       	push   $0x80355b
+  8024a2:	ff 75 0c             	push   0xc(%ebp)
+  8024a5:	e8 14 e8 ff ff       	call   800cbe <strcpy>
+	return 0;
+}
+  8024aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024af:	c9                   	leave
+  8024b0:	c3                   	ret
+
+008024b1 <devsock_close>:
+{
+  8024b1:	55                   	push   %ebp
+  8024b2:	89 e5                	mov    %esp,%ebp
+  8024b4:	53                   	push   %ebx
+  8024b5:	83 ec 10             	sub    $0x10,%esp
+  8024b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8024bb:	53                   	push   %ebx
+  8024bc:	e8 e4 0a 00 00       	call   802fa5 <pageref>
+  8024c1:	89 c2                	mov    %eax,%edx
+  8024c3:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8024c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8024cb:	83 fa 01             	cmp    $0x1,%edx
+  8024ce:	74 05                	je     8024d5 <devsock_close+0x24>
+}
+  8024d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024d3:	c9                   	leave
+  8024d4:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8024d5:	83 ec 0c             	sub    $0xc,%esp
+  8024d8:	ff 73 0c             	push   0xc(%ebx)
+  8024db:	e8 b7 02 00 00       	call   802797 <nsipc_close>
+  8024e0:	83 c4 10             	add    $0x10,%esp
+  8024e3:	eb eb                	jmp    8024d0 <devsock_close+0x1f>
+
+008024e5 <devsock_write>:
+{
+  8024e5:	55                   	push   %ebp
+  8024e6:	89 e5                	mov    %esp,%ebp
+  8024e8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8024eb:	6a 00                	push   $0x0
+  8024ed:	ff 75 10             	push   0x10(%ebp)
+  8024f0:	ff 75 0c             	push   0xc(%ebp)
+  8024f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f6:	ff 70 0c             	push   0xc(%eax)
+  8024f9:	e8 79 03 00 00       	call   802877 <nsipc_send>
+}
+  8024fe:	c9                   	leave
+  8024ff:	c3                   	ret
+
+00802500 <devsock_read>:
+{
+  802500:	55                   	push   %ebp
+  802501:	89 e5                	mov    %esp,%ebp
+  802503:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802506:	6a 00                	push   $0x0
+  802508:	ff 75 10             	push   0x10(%ebp)
+  80250b:	ff 75 0c             	push   0xc(%ebp)
+  80250e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802511:	ff 70 0c             	push   0xc(%eax)
+  802514:	e8 ef 02 00 00       	call   802808 <nsipc_recv>
+}
+  802519:	c9                   	leave
+  80251a:	c3                   	ret
+
+0080251b <fd2sockid>:
+{
+  80251b:	55                   	push   %ebp
+  80251c:	89 e5                	mov    %esp,%ebp
+  80251e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802521:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802524:	52                   	push   %edx
+  802525:	50                   	push   %eax
+  802526:	e8 7e f7 ff ff       	call   801ca9 <fd_lookup>
+  80252b:	83 c4 10             	add    $0x10,%esp
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	78 10                	js     802542 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802532:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802535:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  80253b:	39 08                	cmp    %ecx,(%eax)
+  80253d:	75 05                	jne    802544 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80253f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802542:	c9                   	leave
+  802543:	c3                   	ret
+		return -E_NOT_SUPP;
+  802544:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802549:	eb f7                	jmp    802542 <fd2sockid+0x27>
+
+0080254b <alloc_sockfd>:
+{
+  80254b:	55                   	push   %ebp
+  80254c:	89 e5                	mov    %esp,%ebp
+  80254e:	56                   	push   %esi
+  80254f:	53                   	push   %ebx
+  802550:	83 ec 1c             	sub    $0x1c,%esp
+  802553:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802555:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802558:	50                   	push   %eax
+  802559:	e8 f5 f6 ff ff       	call   801c53 <fd_alloc>
+  80255e:	89 c3                	mov    %eax,%ebx
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	85 c0                	test   %eax,%eax
+  802565:	78 43                	js     8025aa <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802567:	83 ec 04             	sub    $0x4,%esp
+  80256a:	68 07 04 00 00       	push   $0x407
+  80256f:	ff 75 f4             	push   -0xc(%ebp)
+  802572:	6a 00                	push   $0x0
+  802574:	e8 3d ec ff ff       	call   8011b6 <sys_page_alloc>
+  802579:	89 c3                	mov    %eax,%ebx
+  80257b:	83 c4 10             	add    $0x10,%esp
+  80257e:	85 c0                	test   %eax,%eax
+  802580:	78 28                	js     8025aa <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802582:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802585:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  80258b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80258d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802590:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802597:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80259a:	83 ec 0c             	sub    $0xc,%esp
+  80259d:	50                   	push   %eax
+  80259e:	e8 89 f6 ff ff       	call   801c2c <fd2num>
+  8025a3:	89 c3                	mov    %eax,%ebx
+  8025a5:	83 c4 10             	add    $0x10,%esp
+  8025a8:	eb 0c                	jmp    8025b6 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8025aa:	83 ec 0c             	sub    $0xc,%esp
+  8025ad:	56                   	push   %esi
+  8025ae:	e8 e4 01 00 00       	call   802797 <nsipc_close>
+		return r;
+  8025b3:	83 c4 10             	add    $0x10,%esp
+}
+  8025b6:	89 d8                	mov    %ebx,%eax
+  8025b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025bb:	5b                   	pop    %ebx
+  8025bc:	5e                   	pop    %esi
+  8025bd:	5d                   	pop    %ebp
+  8025be:	c3                   	ret
+
+008025bf <accept>:
+{
+  8025bf:	55                   	push   %ebp
+  8025c0:	89 e5                	mov    %esp,%ebp
+  8025c2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c8:	e8 4e ff ff ff       	call   80251b <fd2sockid>
+  8025cd:	85 c0                	test   %eax,%eax
+  8025cf:	78 1b                	js     8025ec <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8025d1:	83 ec 04             	sub    $0x4,%esp
+  8025d4:	ff 75 10             	push   0x10(%ebp)
+  8025d7:	ff 75 0c             	push   0xc(%ebp)
+  8025da:	50                   	push   %eax
+  8025db:	e8 0e 01 00 00       	call   8026ee <nsipc_accept>
+  8025e0:	83 c4 10             	add    $0x10,%esp
+  8025e3:	85 c0                	test   %eax,%eax
+  8025e5:	78 05                	js     8025ec <accept+0x2d>
+	return alloc_sockfd(r);
+  8025e7:	e8 5f ff ff ff       	call   80254b <alloc_sockfd>
+}
+  8025ec:	c9                   	leave
+  8025ed:	c3                   	ret
+
+008025ee <bind>:
+{
+  8025ee:	55                   	push   %ebp
+  8025ef:	89 e5                	mov    %esp,%ebp
+  8025f1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f7:	e8 1f ff ff ff       	call   80251b <fd2sockid>
+  8025fc:	85 c0                	test   %eax,%eax
+  8025fe:	78 12                	js     802612 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802600:	83 ec 04             	sub    $0x4,%esp
+  802603:	ff 75 10             	push   0x10(%ebp)
+  802606:	ff 75 0c             	push   0xc(%ebp)
+  802609:	50                   	push   %eax
+  80260a:	e8 31 01 00 00       	call   802740 <nsipc_bind>
+  80260f:	83 c4 10             	add    $0x10,%esp
+}
+  802612:	c9                   	leave
+  802613:	c3                   	ret
+
+00802614 <shutdown>:
+{
+  802614:	55                   	push   %ebp
+  802615:	89 e5                	mov    %esp,%ebp
+  802617:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80261a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261d:	e8 f9 fe ff ff       	call   80251b <fd2sockid>
+  802622:	85 c0                	test   %eax,%eax
+  802624:	78 0f                	js     802635 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802626:	83 ec 08             	sub    $0x8,%esp
+  802629:	ff 75 0c             	push   0xc(%ebp)
+  80262c:	50                   	push   %eax
+  80262d:	e8 43 01 00 00       	call   802775 <nsipc_shutdown>
+  802632:	83 c4 10             	add    $0x10,%esp
+}
+  802635:	c9                   	leave
+  802636:	c3                   	ret
+
+00802637 <connect>:
+{
+  802637:	55                   	push   %ebp
+  802638:	89 e5                	mov    %esp,%ebp
+  80263a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80263d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802640:	e8 d6 fe ff ff       	call   80251b <fd2sockid>
+  802645:	85 c0                	test   %eax,%eax
+  802647:	78 12                	js     80265b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802649:	83 ec 04             	sub    $0x4,%esp
+  80264c:	ff 75 10             	push   0x10(%ebp)
+  80264f:	ff 75 0c             	push   0xc(%ebp)
+  802652:	50                   	push   %eax
+  802653:	e8 59 01 00 00       	call   8027b1 <nsipc_connect>
+  802658:	83 c4 10             	add    $0x10,%esp
+}
+  80265b:	c9                   	leave
+  80265c:	c3                   	ret
+
+0080265d <listen>:
+{
+  80265d:	55                   	push   %ebp
+  80265e:	89 e5                	mov    %esp,%ebp
+  802660:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802663:	8b 45 08             	mov    0x8(%ebp),%eax
+  802666:	e8 b0 fe ff ff       	call   80251b <fd2sockid>
+  80266b:	85 c0                	test   %eax,%eax
+  80266d:	78 0f                	js     80267e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80266f:	83 ec 08             	sub    $0x8,%esp
+  802672:	ff 75 0c             	push   0xc(%ebp)
+  802675:	50                   	push   %eax
+  802676:	e8 6b 01 00 00       	call   8027e6 <nsipc_listen>
+  80267b:	83 c4 10             	add    $0x10,%esp
+}
+  80267e:	c9                   	leave
+  80267f:	c3                   	ret
+
+00802680 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802680:	55                   	push   %ebp
+  802681:	89 e5                	mov    %esp,%ebp
+  802683:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802686:	ff 75 10             	push   0x10(%ebp)
+  802689:	ff 75 0c             	push   0xc(%ebp)
+  80268c:	ff 75 08             	push   0x8(%ebp)
+  80268f:	e8 41 02 00 00       	call   8028d5 <nsipc_socket>
+  802694:	83 c4 10             	add    $0x10,%esp
+  802697:	85 c0                	test   %eax,%eax
+  802699:	78 05                	js     8026a0 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80269b:	e8 ab fe ff ff       	call   80254b <alloc_sockfd>
+}
+  8026a0:	c9                   	leave
+  8026a1:	c3                   	ret
+
+008026a2 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8026a2:	55                   	push   %ebp
+  8026a3:	89 e5                	mov    %esp,%ebp
+  8026a5:	53                   	push   %ebx
+  8026a6:	83 ec 04             	sub    $0x4,%esp
+  8026a9:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8026ab:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  8026b2:	74 26                	je     8026da <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8026b4:	6a 07                	push   $0x7
+  8026b6:	68 00 70 80 00       	push   $0x807000
+  8026bb:	53                   	push   %ebx
+  8026bc:	ff 35 14 50 80 00    	push   0x805014
+  8026c2:	e8 4b 08 00 00       	call   802f12 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8026c7:	83 c4 0c             	add    $0xc,%esp
+  8026ca:	6a 00                	push   $0x0
+  8026cc:	6a 00                	push   $0x0
+  8026ce:	6a 00                	push   $0x0
+  8026d0:	e8 25 08 00 00       	call   802efa <ipc_recv>
+}
+  8026d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d8:	c9                   	leave
+  8026d9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8026da:	83 ec 0c             	sub    $0xc,%esp
+  8026dd:	6a 02                	push   $0x2
+  8026df:	e8 82 08 00 00       	call   802f66 <ipc_find_env>
+  8026e4:	a3 14 50 80 00       	mov    %eax,0x805014
+  8026e9:	83 c4 10             	add    $0x10,%esp
+  8026ec:	eb c6                	jmp    8026b4 <nsipc+0x12>
+
+008026ee <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8026ee:	55                   	push   %ebp
+  8026ef:	89 e5                	mov    %esp,%ebp
+  8026f1:	56                   	push   %esi
+  8026f2:	53                   	push   %ebx
+  8026f3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8026f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8026fe:	8b 06                	mov    (%esi),%eax
+  802700:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802705:	b8 01 00 00 00       	mov    $0x1,%eax
+  80270a:	e8 93 ff ff ff       	call   8026a2 <nsipc>
+  80270f:	89 c3                	mov    %eax,%ebx
+  802711:	85 c0                	test   %eax,%eax
+  802713:	79 09                	jns    80271e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802715:	89 d8                	mov    %ebx,%eax
+  802717:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80271a:	5b                   	pop    %ebx
+  80271b:	5e                   	pop    %esi
+  80271c:	5d                   	pop    %ebp
+  80271d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80271e:	83 ec 04             	sub    $0x4,%esp
+  802721:	ff 35 10 70 80 00    	push   0x807010
+  802727:	68 00 70 80 00       	push   $0x807000
+  80272c:	ff 75 0c             	push   0xc(%ebp)
+  80272f:	e8 10 e7 ff ff       	call   800e44 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802734:	a1 10 70 80 00       	mov    0x807010,%eax
+  802739:	89 06                	mov    %eax,(%esi)
+  80273b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80273e:	eb d5                	jmp    802715 <nsipc_accept+0x27>
+
+00802740 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802740:	55                   	push   %ebp
+  802741:	89 e5                	mov    %esp,%ebp
+  802743:	53                   	push   %ebx
+  802744:	83 ec 08             	sub    $0x8,%esp
+  802747:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80274a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80274d:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802752:	53                   	push   %ebx
+  802753:	ff 75 0c             	push   0xc(%ebp)
+  802756:	68 04 70 80 00       	push   $0x807004
+  80275b:	e8 e4 e6 ff ff       	call   800e44 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802760:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802766:	b8 02 00 00 00       	mov    $0x2,%eax
+  80276b:	e8 32 ff ff ff       	call   8026a2 <nsipc>
+}
+  802770:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802773:	c9                   	leave
+  802774:	c3                   	ret
+
+00802775 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802775:	55                   	push   %ebp
+  802776:	89 e5                	mov    %esp,%ebp
+  802778:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80277b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802783:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802786:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80278b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802790:	e8 0d ff ff ff       	call   8026a2 <nsipc>
+}
+  802795:	c9                   	leave
+  802796:	c3                   	ret
+
+00802797 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802797:	55                   	push   %ebp
+  802798:	89 e5                	mov    %esp,%ebp
+  80279a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80279d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a0:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8027a5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027aa:	e8 f3 fe ff ff       	call   8026a2 <nsipc>
+}
+  8027af:	c9                   	leave
+  8027b0:	c3                   	ret
+
+008027b1 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8027b1:	55                   	push   %ebp
+  8027b2:	89 e5                	mov    %esp,%ebp
+  8027b4:	53                   	push   %ebx
+  8027b5:	83 ec 08             	sub    $0x8,%esp
+  8027b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8027bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027be:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8027c3:	53                   	push   %ebx
+  8027c4:	ff 75 0c             	push   0xc(%ebp)
+  8027c7:	68 04 70 80 00       	push   $0x807004
+  8027cc:	e8 73 e6 ff ff       	call   800e44 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8027d1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8027d7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027dc:	e8 c1 fe ff ff       	call   8026a2 <nsipc>
+}
+  8027e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+
+008027e6 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8027ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ef:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8027f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027f7:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8027fc:	b8 06 00 00 00       	mov    $0x6,%eax
+  802801:	e8 9c fe ff ff       	call   8026a2 <nsipc>
+}
+  802806:	c9                   	leave
+  802807:	c3                   	ret
+
+00802808 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802808:	55                   	push   %ebp
+  802809:	89 e5                	mov    %esp,%ebp
+  80280b:	56                   	push   %esi
+  80280c:	53                   	push   %ebx
+  80280d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802810:	8b 45 08             	mov    0x8(%ebp),%eax
+  802813:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802818:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80281e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802821:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802826:	b8 07 00 00 00       	mov    $0x7,%eax
+  80282b:	e8 72 fe ff ff       	call   8026a2 <nsipc>
+  802830:	89 c3                	mov    %eax,%ebx
+  802832:	85 c0                	test   %eax,%eax
+  802834:	78 22                	js     802858 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802836:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80283b:	39 c6                	cmp    %eax,%esi
+  80283d:	0f 4e c6             	cmovle %esi,%eax
+  802840:	39 c3                	cmp    %eax,%ebx
+  802842:	7f 1d                	jg     802861 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802844:	83 ec 04             	sub    $0x4,%esp
+  802847:	53                   	push   %ebx
+  802848:	68 00 70 80 00       	push   $0x807000
+  80284d:	ff 75 0c             	push   0xc(%ebp)
+  802850:	e8 ef e5 ff ff       	call   800e44 <memmove>
+  802855:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802858:	89 d8                	mov    %ebx,%eax
+  80285a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80285d:	5b                   	pop    %ebx
+  80285e:	5e                   	pop    %esi
+  80285f:	5d                   	pop    %ebp
+  802860:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802861:	68 67 35 80 00       	push   $0x803567
+  802866:	68 2f 35 80 00       	push   $0x80352f
+  80286b:	6a 62                	push   $0x62
+  80286d:	68 7c 35 80 00       	push   $0x80357c
+  802872:	e8 24 dd ff ff       	call   80059b <_panic>
+
+00802877 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802877:	55                   	push   %ebp
+  802878:	89 e5                	mov    %esp,%ebp
+  80287a:	53                   	push   %ebx
+  80287b:	83 ec 04             	sub    $0x4,%esp
+  80287e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802881:	8b 45 08             	mov    0x8(%ebp),%eax
+  802884:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802889:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80288f:	7f 2e                	jg     8028bf <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802891:	83 ec 04             	sub    $0x4,%esp
+  802894:	53                   	push   %ebx
+  802895:	ff 75 0c             	push   0xc(%ebp)
+  802898:	68 0c 70 80 00       	push   $0x80700c
+  80289d:	e8 a2 e5 ff ff       	call   800e44 <memmove>
+	nsipcbuf.send.req_size = size;
+  8028a2:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8028a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028ab:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8028b0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8028b5:	e8 e8 fd ff ff       	call   8026a2 <nsipc>
+}
+  8028ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028bd:	c9                   	leave
+  8028be:	c3                   	ret
+	assert(size < 1600);
+  8028bf:	68 88 35 80 00       	push   $0x803588
+  8028c4:	68 2f 35 80 00       	push   $0x80352f
+  8028c9:	6a 6d                	push   $0x6d
+  8028cb:	68 7c 35 80 00       	push   $0x80357c
+  8028d0:	e8 c6 dc ff ff       	call   80059b <_panic>
+
+008028d5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8028d5:	55                   	push   %ebp
+  8028d6:	89 e5                	mov    %esp,%ebp
+  8028d8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8028db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028de:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8028e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028e6:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8028eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028ee:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8028f3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8028f8:	e8 a5 fd ff ff       	call   8026a2 <nsipc>
+}
+  8028fd:	c9                   	leave
+  8028fe:	c3                   	ret
+
+008028ff <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028ff:	55                   	push   %ebp
+  802900:	89 e5                	mov    %esp,%ebp
+  802902:	56                   	push   %esi
+  802903:	53                   	push   %ebx
+  802904:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802907:	83 ec 0c             	sub    $0xc,%esp
+  80290a:	ff 75 08             	push   0x8(%ebp)
+  80290d:	e8 2a f3 ff ff       	call   801c3c <fd2data>
+  802912:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802914:	83 c4 08             	add    $0x8,%esp
+  802917:	68 94 35 80 00       	push   $0x803594
+  80291c:	53                   	push   %ebx
+  80291d:	e8 9c e3 ff ff       	call   800cbe <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802922:	8b 46 04             	mov    0x4(%esi),%eax
+  802925:	2b 06                	sub    (%esi),%eax
+  802927:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80292d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802934:	00 00 00 
+	stat->st_dev = &devpipe;
+  802937:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  80293e:	40 80 00 
+	return 0;
+}
+  802941:	b8 00 00 00 00       	mov    $0x0,%eax
+  802946:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802949:	5b                   	pop    %ebx
+  80294a:	5e                   	pop    %esi
+  80294b:	5d                   	pop    %ebp
+  80294c:	c3                   	ret
+
+0080294d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80294d:	55                   	push   %ebp
+  80294e:	89 e5                	mov    %esp,%ebp
+  802950:	53                   	push   %ebx
+  802951:	83 ec 0c             	sub    $0xc,%esp
+  802954:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802957:	53                   	push   %ebx
+  802958:	6a 00                	push   $0x0
+  80295a:	e8 32 e9 ff ff       	call   801291 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80295f:	89 1c 24             	mov    %ebx,(%esp)
+  802962:	e8 d5 f2 ff ff       	call   801c3c <fd2data>
+  802967:	83 c4 08             	add    $0x8,%esp
+  80296a:	50                   	push   %eax
+  80296b:	6a 00                	push   $0x0
+  80296d:	e8 1f e9 ff ff       	call   801291 <sys_page_unmap>
+}
+  802972:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802975:	c9                   	leave
+  802976:	c3                   	ret
+
+00802977 <_pipeisclosed>:
+{
+  802977:	55                   	push   %ebp
+  802978:	89 e5                	mov    %esp,%ebp
+  80297a:	57                   	push   %edi
+  80297b:	56                   	push   %esi
+  80297c:	53                   	push   %ebx
+  80297d:	83 ec 1c             	sub    $0x1c,%esp
+  802980:	89 c7                	mov    %eax,%edi
+  802982:	89 d6                	mov    %edx,%esi
+  802984:	eb 3c                	jmp    8029c2 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802986:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802989:	83 ec 0c             	sub    $0xc,%esp
+  80298c:	57                   	push   %edi
+  80298d:	e8 13 06 00 00       	call   802fa5 <pageref>
+  802992:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802995:	89 34 24             	mov    %esi,(%esp)
+  802998:	e8 08 06 00 00       	call   802fa5 <pageref>
+  80299d:	89 c2                	mov    %eax,%edx
+  80299f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029a1:	05 00 00 00 20       	add    $0x20000000,%eax
+  8029a6:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8029a9:	8b 0d 18 50 80 00    	mov    0x805018,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029af:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029b4:	76 31                	jbe    8029e7 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8029b6:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8029b9:	39 c3                	cmp    %eax,%ebx
+  8029bb:	74 76                	je     802a33 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8029bd:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8029c0:	74 36                	je     8029f8 <_pipeisclosed+0x81>
+  8029c2:	89 e0                	mov    %esp,%eax
+  8029c4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029c9:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029cf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029d4:	77 b0                	ja     802986 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8029d6:	c1 e8 10             	shr    $0x10,%eax
+  8029d9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8029df:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8029e5:	eb 9f                	jmp    802986 <_pipeisclosed+0xf>
+  8029e7:	c1 e8 10             	shr    $0x10,%eax
+  8029ea:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8029f0:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8029f6:	eb be                	jmp    8029b6 <_pipeisclosed+0x3f>
+  8029f8:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029fa:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029ff:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a05:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a0a:	76 16                	jbe    802a22 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802a0c:	8b 42 58             	mov    0x58(%edx),%eax
+  802a0f:	6a 01                	push   $0x1
+  802a11:	50                   	push   %eax
+  802a12:	53                   	push   %ebx
+  802a13:	68 9b 35 80 00       	push   $0x80359b
+  802a18:	e8 59 dc ff ff       	call   800676 <cprintf>
+  802a1d:	83 c4 10             	add    $0x10,%esp
+  802a20:	eb a0                	jmp    8029c2 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a22:	c1 e8 10             	shr    $0x10,%eax
+  802a25:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a2b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a31:	eb d9                	jmp    802a0c <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802a33:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802a36:	0f 94 c0             	sete   %al
+  802a39:	0f b6 c0             	movzbl %al,%eax
+}
+  802a3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3f:	5b                   	pop    %ebx
+  802a40:	5e                   	pop    %esi
+  802a41:	5f                   	pop    %edi
+  802a42:	5d                   	pop    %ebp
+  802a43:	c3                   	ret
+
+00802a44 <devpipe_write>:
+{
+  802a44:	55                   	push   %ebp
+  802a45:	89 e5                	mov    %esp,%ebp
+  802a47:	57                   	push   %edi
+  802a48:	56                   	push   %esi
+  802a49:	53                   	push   %ebx
+  802a4a:	83 ec 28             	sub    $0x28,%esp
+  802a4d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802a50:	56                   	push   %esi
+  802a51:	e8 e6 f1 ff ff       	call   801c3c <fd2data>
+  802a56:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802a58:	83 c4 10             	add    $0x10,%esp
+  802a5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a60:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a63:	75 09                	jne    802a6e <devpipe_write+0x2a>
+	return i;
+  802a65:	89 f8                	mov    %edi,%eax
+  802a67:	eb 23                	jmp    802a8c <devpipe_write+0x48>
+			sys_yield();
+  802a69:	e8 02 e7 ff ff       	call   801170 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802a6e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a71:	8b 0b                	mov    (%ebx),%ecx
+  802a73:	8d 51 20             	lea    0x20(%ecx),%edx
+  802a76:	39 d0                	cmp    %edx,%eax
+  802a78:	72 1a                	jb     802a94 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802a7a:	89 da                	mov    %ebx,%edx
+  802a7c:	89 f0                	mov    %esi,%eax
+  802a7e:	e8 f4 fe ff ff       	call   802977 <_pipeisclosed>
+  802a83:	85 c0                	test   %eax,%eax
+  802a85:	74 e2                	je     802a69 <devpipe_write+0x25>
+				return 0;
+  802a87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a8f:	5b                   	pop    %ebx
+  802a90:	5e                   	pop    %esi
+  802a91:	5f                   	pop    %edi
+  802a92:	5d                   	pop    %ebp
+  802a93:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802a94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a97:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802a9b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802a9e:	89 c2                	mov    %eax,%edx
+  802aa0:	c1 fa 1f             	sar    $0x1f,%edx
+  802aa3:	89 d1                	mov    %edx,%ecx
+  802aa5:	c1 e9 1b             	shr    $0x1b,%ecx
+  802aa8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802aab:	83 e2 1f             	and    $0x1f,%edx
+  802aae:	29 ca                	sub    %ecx,%edx
+  802ab0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ab4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802ab8:	83 c0 01             	add    $0x1,%eax
+  802abb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802abe:	83 c7 01             	add    $0x1,%edi
+  802ac1:	eb 9d                	jmp    802a60 <devpipe_write+0x1c>
+
+00802ac3 <devpipe_read>:
+{
+  802ac3:	55                   	push   %ebp
+  802ac4:	89 e5                	mov    %esp,%ebp
+  802ac6:	57                   	push   %edi
+  802ac7:	56                   	push   %esi
+  802ac8:	53                   	push   %ebx
+  802ac9:	83 ec 18             	sub    $0x18,%esp
+  802acc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802acf:	57                   	push   %edi
+  802ad0:	e8 67 f1 ff ff       	call   801c3c <fd2data>
+  802ad5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ad7:	83 c4 10             	add    $0x10,%esp
+  802ada:	be 00 00 00 00       	mov    $0x0,%esi
+  802adf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ae2:	75 13                	jne    802af7 <devpipe_read+0x34>
+	return i;
+  802ae4:	89 f0                	mov    %esi,%eax
+  802ae6:	eb 02                	jmp    802aea <devpipe_read+0x27>
+				return i;
+  802ae8:	89 f0                	mov    %esi,%eax
+}
+  802aea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aed:	5b                   	pop    %ebx
+  802aee:	5e                   	pop    %esi
+  802aef:	5f                   	pop    %edi
+  802af0:	5d                   	pop    %ebp
+  802af1:	c3                   	ret
+			sys_yield();
+  802af2:	e8 79 e6 ff ff       	call   801170 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802af7:	8b 03                	mov    (%ebx),%eax
+  802af9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802afc:	75 18                	jne    802b16 <devpipe_read+0x53>
+			if (i > 0)
+  802afe:	85 f6                	test   %esi,%esi
+  802b00:	75 e6                	jne    802ae8 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802b02:	89 da                	mov    %ebx,%edx
+  802b04:	89 f8                	mov    %edi,%eax
+  802b06:	e8 6c fe ff ff       	call   802977 <_pipeisclosed>
+  802b0b:	85 c0                	test   %eax,%eax
+  802b0d:	74 e3                	je     802af2 <devpipe_read+0x2f>
+				return 0;
+  802b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b14:	eb d4                	jmp    802aea <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802b16:	99                   	cltd
+  802b17:	c1 ea 1b             	shr    $0x1b,%edx
+  802b1a:	01 d0                	add    %edx,%eax
+  802b1c:	83 e0 1f             	and    $0x1f,%eax
+  802b1f:	29 d0                	sub    %edx,%eax
+  802b21:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802b26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b29:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802b2c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802b2f:	83 c6 01             	add    $0x1,%esi
+  802b32:	eb ab                	jmp    802adf <devpipe_read+0x1c>
+
+00802b34 <pipe>:
+{
+  802b34:	55                   	push   %ebp
+  802b35:	89 e5                	mov    %esp,%ebp
+  802b37:	56                   	push   %esi
+  802b38:	53                   	push   %ebx
+  802b39:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802b3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b3f:	50                   	push   %eax
+  802b40:	e8 0e f1 ff ff       	call   801c53 <fd_alloc>
+  802b45:	89 c3                	mov    %eax,%ebx
+  802b47:	83 c4 10             	add    $0x10,%esp
+  802b4a:	85 c0                	test   %eax,%eax
+  802b4c:	0f 88 23 01 00 00    	js     802c75 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b52:	83 ec 04             	sub    $0x4,%esp
+  802b55:	68 07 04 00 00       	push   $0x407
+  802b5a:	ff 75 f4             	push   -0xc(%ebp)
+  802b5d:	6a 00                	push   $0x0
+  802b5f:	e8 52 e6 ff ff       	call   8011b6 <sys_page_alloc>
+  802b64:	89 c3                	mov    %eax,%ebx
+  802b66:	83 c4 10             	add    $0x10,%esp
+  802b69:	85 c0                	test   %eax,%eax
+  802b6b:	0f 88 04 01 00 00    	js     802c75 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802b71:	83 ec 0c             	sub    $0xc,%esp
+  802b74:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802b77:	50                   	push   %eax
+  802b78:	e8 d6 f0 ff ff       	call   801c53 <fd_alloc>
+  802b7d:	89 c3                	mov    %eax,%ebx
+  802b7f:	83 c4 10             	add    $0x10,%esp
+  802b82:	85 c0                	test   %eax,%eax
+  802b84:	0f 88 db 00 00 00    	js     802c65 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b8a:	83 ec 04             	sub    $0x4,%esp
+  802b8d:	68 07 04 00 00       	push   $0x407
+  802b92:	ff 75 f0             	push   -0x10(%ebp)
+  802b95:	6a 00                	push   $0x0
+  802b97:	e8 1a e6 ff ff       	call   8011b6 <sys_page_alloc>
+  802b9c:	89 c3                	mov    %eax,%ebx
+  802b9e:	83 c4 10             	add    $0x10,%esp
+  802ba1:	85 c0                	test   %eax,%eax
+  802ba3:	0f 88 bc 00 00 00    	js     802c65 <pipe+0x131>
+	va = fd2data(fd0);
+  802ba9:	83 ec 0c             	sub    $0xc,%esp
+  802bac:	ff 75 f4             	push   -0xc(%ebp)
+  802baf:	e8 88 f0 ff ff       	call   801c3c <fd2data>
+  802bb4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802bb6:	83 c4 0c             	add    $0xc,%esp
+  802bb9:	68 07 04 00 00       	push   $0x407
+  802bbe:	50                   	push   %eax
+  802bbf:	6a 00                	push   $0x0
+  802bc1:	e8 f0 e5 ff ff       	call   8011b6 <sys_page_alloc>
+  802bc6:	89 c3                	mov    %eax,%ebx
+  802bc8:	83 c4 10             	add    $0x10,%esp
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	0f 88 82 00 00 00    	js     802c55 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802bd3:	83 ec 0c             	sub    $0xc,%esp
+  802bd6:	ff 75 f0             	push   -0x10(%ebp)
+  802bd9:	e8 5e f0 ff ff       	call   801c3c <fd2data>
+  802bde:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802be5:	50                   	push   %eax
+  802be6:	6a 00                	push   $0x0
+  802be8:	56                   	push   %esi
+  802be9:	6a 00                	push   $0x0
+  802beb:	e8 33 e6 ff ff       	call   801223 <sys_page_map>
+  802bf0:	89 c3                	mov    %eax,%ebx
+  802bf2:	83 c4 20             	add    $0x20,%esp
+  802bf5:	85 c0                	test   %eax,%eax
+  802bf7:	78 4e                	js     802c47 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802bf9:	a1 40 40 80 00       	mov    0x804040,%eax
+  802bfe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c01:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802c03:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c06:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802c0d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802c10:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802c12:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802c15:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802c1c:	83 ec 0c             	sub    $0xc,%esp
+  802c1f:	ff 75 f4             	push   -0xc(%ebp)
+  802c22:	e8 05 f0 ff ff       	call   801c2c <fd2num>
+  802c27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c2a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802c2c:	83 c4 04             	add    $0x4,%esp
+  802c2f:	ff 75 f0             	push   -0x10(%ebp)
+  802c32:	e8 f5 ef ff ff       	call   801c2c <fd2num>
+  802c37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c3a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802c3d:	83 c4 10             	add    $0x10,%esp
+  802c40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c45:	eb 2e                	jmp    802c75 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802c47:	83 ec 08             	sub    $0x8,%esp
+  802c4a:	56                   	push   %esi
+  802c4b:	6a 00                	push   $0x0
+  802c4d:	e8 3f e6 ff ff       	call   801291 <sys_page_unmap>
+  802c52:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802c55:	83 ec 08             	sub    $0x8,%esp
+  802c58:	ff 75 f0             	push   -0x10(%ebp)
+  802c5b:	6a 00                	push   $0x0
+  802c5d:	e8 2f e6 ff ff       	call   801291 <sys_page_unmap>
+  802c62:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802c65:	83 ec 08             	sub    $0x8,%esp
+  802c68:	ff 75 f4             	push   -0xc(%ebp)
+  802c6b:	6a 00                	push   $0x0
+  802c6d:	e8 1f e6 ff ff       	call   801291 <sys_page_unmap>
+  802c72:	83 c4 10             	add    $0x10,%esp
+}
+  802c75:	89 d8                	mov    %ebx,%eax
+  802c77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c7a:	5b                   	pop    %ebx
+  802c7b:	5e                   	pop    %esi
+  802c7c:	5d                   	pop    %ebp
+  802c7d:	c3                   	ret
+
+00802c7e <pipeisclosed>:
+{
+  802c7e:	55                   	push   %ebp
+  802c7f:	89 e5                	mov    %esp,%ebp
+  802c81:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c87:	50                   	push   %eax
+  802c88:	ff 75 08             	push   0x8(%ebp)
+  802c8b:	e8 19 f0 ff ff       	call   801ca9 <fd_lookup>
+  802c90:	83 c4 10             	add    $0x10,%esp
+  802c93:	85 c0                	test   %eax,%eax
+  802c95:	78 18                	js     802caf <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802c97:	83 ec 0c             	sub    $0xc,%esp
+  802c9a:	ff 75 f4             	push   -0xc(%ebp)
+  802c9d:	e8 9a ef ff ff       	call   801c3c <fd2data>
+  802ca2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802ca4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ca7:	e8 cb fc ff ff       	call   802977 <_pipeisclosed>
+  802cac:	83 c4 10             	add    $0x10,%esp
+}
+  802caf:	c9                   	leave
+  802cb0:	c3                   	ret
+
+00802cb1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb6:	c3                   	ret
+
+00802cb7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802cb7:	55                   	push   %ebp
+  802cb8:	89 e5                	mov    %esp,%ebp
+  802cba:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802cbd:	68 b3 35 80 00       	push   $0x8035b3
+  802cc2:	ff 75 0c             	push   0xc(%ebp)
+  802cc5:	e8 f4 df ff ff       	call   800cbe <strcpy>
+	return 0;
+}
+  802cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ccf:	c9                   	leave
+  802cd0:	c3                   	ret
+
+00802cd1 <devcons_write>:
+{
+  802cd1:	55                   	push   %ebp
+  802cd2:	89 e5                	mov    %esp,%ebp
+  802cd4:	57                   	push   %edi
+  802cd5:	56                   	push   %esi
+  802cd6:	53                   	push   %ebx
+  802cd7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802cdd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802ce2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802ce8:	eb 2e                	jmp    802d18 <devcons_write+0x47>
+		m = n - tot;
+  802cea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ced:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802cef:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802cf4:	39 c3                	cmp    %eax,%ebx
+  802cf6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802cf9:	83 ec 04             	sub    $0x4,%esp
+  802cfc:	53                   	push   %ebx
+  802cfd:	89 f0                	mov    %esi,%eax
+  802cff:	03 45 0c             	add    0xc(%ebp),%eax
+  802d02:	50                   	push   %eax
+  802d03:	57                   	push   %edi
+  802d04:	e8 3b e1 ff ff       	call   800e44 <memmove>
+		sys_cputs(buf, m);
+  802d09:	83 c4 08             	add    $0x8,%esp
+  802d0c:	53                   	push   %ebx
+  802d0d:	57                   	push   %edi
+  802d0e:	e8 24 e3 ff ff       	call   801037 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802d13:	01 de                	add    %ebx,%esi
+  802d15:	83 c4 10             	add    $0x10,%esp
+  802d18:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d1b:	72 cd                	jb     802cea <devcons_write+0x19>
+}
+  802d1d:	89 f0                	mov    %esi,%eax
+  802d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d22:	5b                   	pop    %ebx
+  802d23:	5e                   	pop    %esi
+  802d24:	5f                   	pop    %edi
+  802d25:	5d                   	pop    %ebp
+  802d26:	c3                   	ret
+
+00802d27 <devcons_read>:
+{
+  802d27:	55                   	push   %ebp
+  802d28:	89 e5                	mov    %esp,%ebp
+  802d2a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d32:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d36:	75 07                	jne    802d3f <devcons_read+0x18>
+  802d38:	eb 1f                	jmp    802d59 <devcons_read+0x32>
+		sys_yield();
+  802d3a:	e8 31 e4 ff ff       	call   801170 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802d3f:	e8 37 e3 ff ff       	call   80107b <sys_cgetc>
+  802d44:	85 c0                	test   %eax,%eax
+  802d46:	74 f2                	je     802d3a <devcons_read+0x13>
+	if (c < 0)
+  802d48:	78 0f                	js     802d59 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802d4a:	83 f8 04             	cmp    $0x4,%eax
+  802d4d:	74 0c                	je     802d5b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802d4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d52:	88 02                	mov    %al,(%edx)
+	return 1;
+  802d54:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802d59:	c9                   	leave
+  802d5a:	c3                   	ret
+		return 0;
+  802d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d60:	eb f7                	jmp    802d59 <devcons_read+0x32>
+
+00802d62 <cputchar>:
+{
+  802d62:	55                   	push   %ebp
+  802d63:	89 e5                	mov    %esp,%ebp
+  802d65:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802d6e:	6a 01                	push   $0x1
+  802d70:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d73:	50                   	push   %eax
+  802d74:	e8 be e2 ff ff       	call   801037 <sys_cputs>
+}
+  802d79:	83 c4 10             	add    $0x10,%esp
+  802d7c:	c9                   	leave
+  802d7d:	c3                   	ret
+
+00802d7e <getchar>:
+{
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802d84:	6a 01                	push   $0x1
+  802d86:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d89:	50                   	push   %eax
+  802d8a:	6a 00                	push   $0x0
+  802d8c:	e8 9e f1 ff ff       	call   801f2f <read>
+	if (r < 0)
+  802d91:	83 c4 10             	add    $0x10,%esp
+  802d94:	85 c0                	test   %eax,%eax
+  802d96:	78 06                	js     802d9e <getchar+0x20>
+	if (r < 1)
+  802d98:	74 06                	je     802da0 <getchar+0x22>
+	return c;
+  802d9a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802d9e:	c9                   	leave
+  802d9f:	c3                   	ret
+		return -E_EOF;
+  802da0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802da5:	eb f7                	jmp    802d9e <getchar+0x20>
+
+00802da7 <iscons>:
+{
+  802da7:	55                   	push   %ebp
+  802da8:	89 e5                	mov    %esp,%ebp
+  802daa:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802db0:	50                   	push   %eax
+  802db1:	ff 75 08             	push   0x8(%ebp)
+  802db4:	e8 f0 ee ff ff       	call   801ca9 <fd_lookup>
+  802db9:	83 c4 10             	add    $0x10,%esp
+  802dbc:	85 c0                	test   %eax,%eax
+  802dbe:	78 11                	js     802dd1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802dc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dc3:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802dc9:	39 10                	cmp    %edx,(%eax)
+  802dcb:	0f 94 c0             	sete   %al
+  802dce:	0f b6 c0             	movzbl %al,%eax
+}
+  802dd1:	c9                   	leave
+  802dd2:	c3                   	ret
+
+00802dd3 <opencons>:
+{
+  802dd3:	55                   	push   %ebp
+  802dd4:	89 e5                	mov    %esp,%ebp
+  802dd6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802dd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ddc:	50                   	push   %eax
+  802ddd:	e8 71 ee ff ff       	call   801c53 <fd_alloc>
+  802de2:	83 c4 10             	add    $0x10,%esp
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	78 3a                	js     802e23 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802de9:	83 ec 04             	sub    $0x4,%esp
+  802dec:	68 07 04 00 00       	push   $0x407
+  802df1:	ff 75 f4             	push   -0xc(%ebp)
+  802df4:	6a 00                	push   $0x0
+  802df6:	e8 bb e3 ff ff       	call   8011b6 <sys_page_alloc>
+  802dfb:	83 c4 10             	add    $0x10,%esp
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	78 21                	js     802e23 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802e02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e05:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802e0b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802e0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e10:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802e17:	83 ec 0c             	sub    $0xc,%esp
+  802e1a:	50                   	push   %eax
+  802e1b:	e8 0c ee ff ff       	call   801c2c <fd2num>
+  802e20:	83 c4 10             	add    $0x10,%esp
+}
+  802e23:	c9                   	leave
+  802e24:	c3                   	ret
+
+00802e25 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802e25:	55                   	push   %ebp
+  802e26:	89 e5                	mov    %esp,%ebp
+  802e28:	56                   	push   %esi
+  802e29:	53                   	push   %ebx
+  802e2a:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802e33:	85 c0                	test   %eax,%eax
+  802e35:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802e3a:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802e3d:	83 ec 08             	sub    $0x8,%esp
+  802e40:	ff 75 14             	push   0x14(%ebp)
+  802e43:	50                   	push   %eax
+  802e44:	e8 7e e7 ff ff       	call   8015c7 <sys_ipc_recv_until>
+  802e49:	83 c4 10             	add    $0x10,%esp
+  802e4c:	85 c0                	test   %eax,%eax
+  802e4e:	78 61                	js     802eb1 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802e50:	85 f6                	test   %esi,%esi
+  802e52:	74 1c                	je     802e70 <ipc_recv_until+0x4b>
+  802e54:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e56:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e5b:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e61:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e66:	76 5f                	jbe    802ec7 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802e68:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802e6e:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802e70:	85 db                	test   %ebx,%ebx
+  802e72:	74 1c                	je     802e90 <ipc_recv_until+0x6b>
+  802e74:	89 e0                	mov    %esp,%eax
+  802e76:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e7b:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e81:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e86:	76 50                	jbe    802ed8 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802e88:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802e8e:	89 03                	mov    %eax,(%ebx)
+  802e90:	89 e0                	mov    %esp,%eax
+  802e92:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e97:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e9d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ea2:	76 45                	jbe    802ee9 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802ea4:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802eaa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ead:	5b                   	pop    %ebx
+  802eae:	5e                   	pop    %esi
+  802eaf:	5d                   	pop    %ebp
+  802eb0:	c3                   	ret
+		if (from_env_store)
+  802eb1:	85 f6                	test   %esi,%esi
+  802eb3:	74 06                	je     802ebb <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802eb5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ebb:	85 db                	test   %ebx,%ebx
+  802ebd:	74 eb                	je     802eaa <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802ebf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802ec5:	eb e3                	jmp    802eaa <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ec7:	c1 e8 10             	shr    $0x10,%eax
+  802eca:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ed0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ed6:	eb 90                	jmp    802e68 <ipc_recv_until+0x43>
+  802ed8:	c1 e8 10             	shr    $0x10,%eax
+  802edb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ee1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ee7:	eb 9f                	jmp    802e88 <ipc_recv_until+0x63>
+  802ee9:	c1 e8 10             	shr    $0x10,%eax
+  802eec:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ef2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ef8:	eb aa                	jmp    802ea4 <ipc_recv_until+0x7f>
+
+00802efa <ipc_recv>:
+{
+  802efa:	55                   	push   %ebp
+  802efb:	89 e5                	mov    %esp,%ebp
+  802efd:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802f00:	6a 00                	push   $0x0
+  802f02:	ff 75 10             	push   0x10(%ebp)
+  802f05:	ff 75 0c             	push   0xc(%ebp)
+  802f08:	ff 75 08             	push   0x8(%ebp)
+  802f0b:	e8 15 ff ff ff       	call   802e25 <ipc_recv_until>
+}
+  802f10:	c9                   	leave
+  802f11:	c3                   	ret
+
+00802f12 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802f12:	55                   	push   %ebp
+  802f13:	89 e5                	mov    %esp,%ebp
+  802f15:	57                   	push   %edi
+  802f16:	56                   	push   %esi
+  802f17:	53                   	push   %ebx
+  802f18:	83 ec 0c             	sub    $0xc,%esp
+  802f1b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f1e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802f21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802f24:	85 db                	test   %ebx,%ebx
+  802f26:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f2b:	0f 44 d8             	cmove  %eax,%ebx
+  802f2e:	eb 05                	jmp    802f35 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802f30:	e8 3b e2 ff ff       	call   801170 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802f35:	ff 75 14             	push   0x14(%ebp)
+  802f38:	53                   	push   %ebx
+  802f39:	56                   	push   %esi
+  802f3a:	57                   	push   %edi
+  802f3b:	e8 d3 e5 ff ff       	call   801513 <sys_ipc_try_send>
+  802f40:	83 c4 10             	add    $0x10,%esp
+  802f43:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f46:	74 e8                	je     802f30 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802f48:	85 c0                	test   %eax,%eax
+  802f4a:	78 08                	js     802f54 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f4f:	5b                   	pop    %ebx
+  802f50:	5e                   	pop    %esi
+  802f51:	5f                   	pop    %edi
+  802f52:	5d                   	pop    %ebp
+  802f53:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802f54:	50                   	push   %eax
+  802f55:	68 bf 35 80 00       	push   $0x8035bf
+  802f5a:	6a 4f                	push   $0x4f
+  802f5c:	68 d2 35 80 00       	push   $0x8035d2
+  802f61:	e8 35 d6 ff ff       	call   80059b <_panic>
+
+00802f66 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802f66:	55                   	push   %ebp
+  802f67:	89 e5                	mov    %esp,%ebp
+  802f69:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802f71:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802f77:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f7d:	8b 52 50             	mov    0x50(%edx),%edx
+  802f80:	39 ca                	cmp    %ecx,%edx
+  802f82:	74 11                	je     802f95 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802f84:	83 c0 01             	add    $0x1,%eax
+  802f87:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802f8c:	75 e3                	jne    802f71 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f93:	eb 0e                	jmp    802fa3 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802f95:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f9b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802fa0:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802fa3:	5d                   	pop    %ebp
+  802fa4:	c3                   	ret
+
+00802fa5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802fa5:	55                   	push   %ebp
+  802fa6:	89 e5                	mov    %esp,%ebp
+  802fa8:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802fab:	89 c2                	mov    %eax,%edx
+  802fad:	c1 ea 16             	shr    $0x16,%edx
+  802fb0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802fb7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802fbc:	f6 c1 01             	test   $0x1,%cl
+  802fbf:	74 1a                	je     802fdb <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802fc1:	c1 e8 0c             	shr    $0xc,%eax
+  802fc4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802fcb:	a8 01                	test   $0x1,%al
+  802fcd:	74 0c                	je     802fdb <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802fcf:	c1 e8 0c             	shr    $0xc,%eax
+  802fd2:	c1 e0 04             	shl    $0x4,%eax
+  802fd5:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802fdb:	89 d0                	mov    %edx,%eax
+  802fdd:	5d                   	pop    %ebp
+  802fde:	c3                   	ret
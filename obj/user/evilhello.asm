@@ -0,0 +1,6159 @@
+
+obj/user/evilhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	// try to print the kernel entry point as a string!  mua ha ha!
+	sys_cputs((char*)0xf010000c, 100);
+  800039:	6a 64                	push   $0x64
+  80003b:	68 0c 00 10 f0       	push   $0xf010000c
+  800040:	e8 65 0b 00 00       	call   800baa <sys_cputs>
+}
+  800045:	83 c4 10             	add    $0x10,%esp
+  800048:	c9                   	leave
+  800049:	c3                   	ret
+
+0080004a <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	57                   	push   %edi
+  80004e:	56                   	push   %esi
+  80004f:	53                   	push   %ebx
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800059:	b8 01 00 00 00       	mov    $0x1,%eax
+  80005e:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800060:	c1 ea 0b             	shr    $0xb,%edx
+  800063:	83 f2 01             	xor    $0x1,%edx
+  800066:	83 e2 01             	and    $0x1,%edx
+  800069:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80006f:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800076:	00 00 00 
+	envid = sys_getenvid();
+  800079:	e8 1f 0c 00 00       	call   800c9d <sys_getenvid>
+  80007e:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800080:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800085:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80008b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800091:	8b 52 48             	mov    0x48(%edx),%edx
+  800094:	39 ca                	cmp    %ecx,%edx
+  800096:	74 27                	je     8000bf <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800098:	83 c0 01             	add    $0x1,%eax
+  80009b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000a0:	75 e3                	jne    800085 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000a2:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000a9:	75 24                	jne    8000cf <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000ab:	83 ec 04             	sub    $0x4,%esp
+  8000ae:	68 60 2b 80 00       	push   $0x802b60
+  8000b3:	6a 23                	push   $0x23
+  8000b5:	68 83 2b 80 00       	push   $0x802b83
+  8000ba:	e8 4f 00 00 00       	call   80010e <_panic>
+			mainenv = &envs[i];
+  8000bf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000c5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ca:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000cf:	85 ff                	test   %edi,%edi
+  8000d1:	7e 07                	jle    8000da <libmain+0x90>
+		binaryname = argv[0];
+  8000d3:	8b 06                	mov    (%esi),%eax
+  8000d5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000da:	83 ec 08             	sub    $0x8,%esp
+  8000dd:	56                   	push   %esi
+  8000de:	57                   	push   %edi
+  8000df:	e8 4f ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000e4:	e8 0b 00 00 00       	call   8000f4 <exit>
+}
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ef:	5b                   	pop    %ebx
+  8000f0:	5e                   	pop    %esi
+  8000f1:	5f                   	pop    %edi
+  8000f2:	5d                   	pop    %ebp
+  8000f3:	c3                   	ret
+
+008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000fa:	e8 94 18 00 00       	call   801993 <close_all>
+	sys_env_destroy(0);
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	6a 00                	push   $0x0
+  800104:	e8 2b 0b 00 00       	call   800c34 <sys_env_destroy>
+}
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	c9                   	leave
+  80010d:	c3                   	ret
+
+0080010e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80010e:	55                   	push   %ebp
+  80010f:	89 e5                	mov    %esp,%ebp
+  800111:	56                   	push   %esi
+  800112:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800113:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800116:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80011c:	e8 7c 0b 00 00       	call   800c9d <sys_getenvid>
+  800121:	83 ec 0c             	sub    $0xc,%esp
+  800124:	ff 75 0c             	push   0xc(%ebp)
+  800127:	ff 75 08             	push   0x8(%ebp)
+  80012a:	56                   	push   %esi
+  80012b:	50                   	push   %eax
+  80012c:	68 9c 2b 80 00       	push   $0x802b9c
+  800131:	e8 b3 00 00 00       	call   8001e9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800136:	83 c4 18             	add    $0x18,%esp
+  800139:	53                   	push   %ebx
+  80013a:	ff 75 10             	push   0x10(%ebp)
+  80013d:	e8 56 00 00 00       	call   800198 <vcprintf>
+	cprintf("\n");
+  800142:	c7 04 24 0c 30 80 00 	movl   $0x80300c,(%esp)
+  800149:	e8 9b 00 00 00       	call   8001e9 <cprintf>
+  80014e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800151:	cc                   	int3
+	while (1)
+  800152:	eb fd                	jmp    800151 <_panic+0x43>
+
+00800154 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800154:	55                   	push   %ebp
+  800155:	89 e5                	mov    %esp,%ebp
+  800157:	53                   	push   %ebx
+  800158:	83 ec 04             	sub    $0x4,%esp
+  80015b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80015e:	8b 13                	mov    (%ebx),%edx
+  800160:	8d 42 01             	lea    0x1(%edx),%eax
+  800163:	89 03                	mov    %eax,(%ebx)
+  800165:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800168:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80016c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800171:	74 09                	je     80017c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800173:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800177:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80017a:	c9                   	leave
+  80017b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80017c:	83 ec 08             	sub    $0x8,%esp
+  80017f:	68 ff 00 00 00       	push   $0xff
+  800184:	8d 43 08             	lea    0x8(%ebx),%eax
+  800187:	50                   	push   %eax
+  800188:	e8 1d 0a 00 00       	call   800baa <sys_cputs>
+		b->idx = 0;
+  80018d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800193:	83 c4 10             	add    $0x10,%esp
+  800196:	eb db                	jmp    800173 <putch+0x1f>
+
+00800198 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001a1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001a8:	00 00 00 
+	b.cnt = 0;
+  8001ab:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001b2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001b5:	ff 75 0c             	push   0xc(%ebp)
+  8001b8:	ff 75 08             	push   0x8(%ebp)
+  8001bb:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001c1:	50                   	push   %eax
+  8001c2:	68 54 01 80 00       	push   $0x800154
+  8001c7:	e8 fb 00 00 00       	call   8002c7 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001cc:	83 c4 08             	add    $0x8,%esp
+  8001cf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001d5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001db:	50                   	push   %eax
+  8001dc:	e8 c9 09 00 00       	call   800baa <sys_cputs>
+
+	return b.cnt;
+}
+  8001e1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001e7:	c9                   	leave
+  8001e8:	c3                   	ret
+
+008001e9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001e9:	55                   	push   %ebp
+  8001ea:	89 e5                	mov    %esp,%ebp
+  8001ec:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001ef:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001f2:	50                   	push   %eax
+  8001f3:	ff 75 08             	push   0x8(%ebp)
+  8001f6:	e8 9d ff ff ff       	call   800198 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001fb:	c9                   	leave
+  8001fc:	c3                   	ret
+
+008001fd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8001fd:	55                   	push   %ebp
+  8001fe:	89 e5                	mov    %esp,%ebp
+  800200:	57                   	push   %edi
+  800201:	56                   	push   %esi
+  800202:	53                   	push   %ebx
+  800203:	83 ec 1c             	sub    $0x1c,%esp
+  800206:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800209:	89 d6                	mov    %edx,%esi
+  80020b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80020e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800211:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800214:	73 0b                	jae    800221 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800216:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800219:	c1 e7 08             	shl    $0x8,%edi
+  80021c:	0b 7d 10             	or     0x10(%ebp),%edi
+  80021f:	eb 36                	jmp    800257 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800221:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800224:	ba 00 00 00 00       	mov    $0x0,%edx
+  800229:	f7 75 08             	divl   0x8(%ebp)
+  80022c:	89 c1                	mov    %eax,%ecx
+  80022e:	ff 75 14             	push   0x14(%ebp)
+  800231:	ff 75 10             	push   0x10(%ebp)
+  800234:	83 eb 01             	sub    $0x1,%ebx
+  800237:	53                   	push   %ebx
+  800238:	ff 75 08             	push   0x8(%ebp)
+  80023b:	89 f2                	mov    %esi,%edx
+  80023d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800240:	e8 b8 ff ff ff       	call   8001fd <printnum>
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	eb 14                	jmp    80025e <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80024a:	83 ec 08             	sub    $0x8,%esp
+  80024d:	56                   	push   %esi
+  80024e:	57                   	push   %edi
+  80024f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800252:	ff d0                	call   *%eax
+  800254:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800257:	83 eb 01             	sub    $0x1,%ebx
+  80025a:	85 db                	test   %ebx,%ebx
+  80025c:	7f ec                	jg     80024a <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80025e:	83 ec 08             	sub    $0x8,%esp
+  800261:	56                   	push   %esi
+  800262:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800265:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026a:	f7 75 08             	divl   0x8(%ebp)
+  80026d:	0f be 92 bf 2b 80 00 	movsbl 0x802bbf(%edx),%edx
+  800274:	8b 45 14             	mov    0x14(%ebp),%eax
+  800277:	c1 e0 08             	shl    $0x8,%eax
+  80027a:	09 d0                	or     %edx,%eax
+  80027c:	50                   	push   %eax
+  80027d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800280:	ff d0                	call   *%eax
+}
+  800282:	83 c4 10             	add    $0x10,%esp
+  800285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800288:	5b                   	pop    %ebx
+  800289:	5e                   	pop    %esi
+  80028a:	5f                   	pop    %edi
+  80028b:	5d                   	pop    %ebp
+  80028c:	c3                   	ret
+
+0080028d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80028d:	55                   	push   %ebp
+  80028e:	89 e5                	mov    %esp,%ebp
+  800290:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800293:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800297:	8b 10                	mov    (%eax),%edx
+  800299:	3b 50 04             	cmp    0x4(%eax),%edx
+  80029c:	73 0a                	jae    8002a8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80029e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002a1:	89 08                	mov    %ecx,(%eax)
+  8002a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002a6:	88 02                	mov    %al,(%edx)
+}
+  8002a8:	5d                   	pop    %ebp
+  8002a9:	c3                   	ret
+
+008002aa <printfmt>:
+{
+  8002aa:	55                   	push   %ebp
+  8002ab:	89 e5                	mov    %esp,%ebp
+  8002ad:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002b0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002b3:	50                   	push   %eax
+  8002b4:	ff 75 10             	push   0x10(%ebp)
+  8002b7:	ff 75 0c             	push   0xc(%ebp)
+  8002ba:	ff 75 08             	push   0x8(%ebp)
+  8002bd:	e8 05 00 00 00       	call   8002c7 <vprintfmt>
+}
+  8002c2:	83 c4 10             	add    $0x10,%esp
+  8002c5:	c9                   	leave
+  8002c6:	c3                   	ret
+
+008002c7 <vprintfmt>:
+{
+  8002c7:	55                   	push   %ebp
+  8002c8:	89 e5                	mov    %esp,%ebp
+  8002ca:	57                   	push   %edi
+  8002cb:	56                   	push   %esi
+  8002cc:	53                   	push   %ebx
+  8002cd:	83 ec 3c             	sub    $0x3c,%esp
+  8002d0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002d3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002d6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002dd:	eb 16                	jmp    8002f5 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002df:	83 ec 08             	sub    $0x8,%esp
+  8002e2:	ff 75 0c             	push   0xc(%ebp)
+  8002e5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002e8:	c1 e2 08             	shl    $0x8,%edx
+  8002eb:	09 d0                	or     %edx,%eax
+  8002ed:	50                   	push   %eax
+  8002ee:	ff d7                	call   *%edi
+  8002f0:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002f3:	89 de                	mov    %ebx,%esi
+  8002f5:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8002f8:	0f b6 06             	movzbl (%esi),%eax
+  8002fb:	83 f8 25             	cmp    $0x25,%eax
+  8002fe:	74 0c                	je     80030c <vprintfmt+0x45>
+			if (ch == '\0')
+  800300:	85 c0                	test   %eax,%eax
+  800302:	75 db                	jne    8002df <vprintfmt+0x18>
+}
+  800304:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800307:	5b                   	pop    %ebx
+  800308:	5e                   	pop    %esi
+  800309:	5f                   	pop    %edi
+  80030a:	5d                   	pop    %ebp
+  80030b:	c3                   	ret
+		padc = ' ';
+  80030c:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800310:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800317:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80031e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800325:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80032a:	8d 73 01             	lea    0x1(%ebx),%esi
+  80032d:	0f b6 13             	movzbl (%ebx),%edx
+  800330:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800333:	3c 55                	cmp    $0x55,%al
+  800335:	0f 87 2c 04 00 00    	ja     800767 <vprintfmt+0x4a0>
+  80033b:	0f b6 c0             	movzbl %al,%eax
+  80033e:	ff 24 85 00 2d 80 00 	jmp    *0x802d00(,%eax,4)
+  800345:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800347:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80034b:	eb dd                	jmp    80032a <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80034d:	89 f3                	mov    %esi,%ebx
+  80034f:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800353:	eb d5                	jmp    80032a <vprintfmt+0x63>
+  800355:	0f b6 d2             	movzbl %dl,%edx
+  800358:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80035a:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80035f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800362:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800366:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800369:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80036c:	83 fe 09             	cmp    $0x9,%esi
+  80036f:	0f 87 8a 00 00 00    	ja     8003ff <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800375:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800378:	eb e5                	jmp    80035f <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80037a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037d:	8b 00                	mov    (%eax),%eax
+  80037f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800382:	8b 45 14             	mov    0x14(%ebp),%eax
+  800385:	8d 40 04             	lea    0x4(%eax),%eax
+  800388:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038b:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80038d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800391:	79 97                	jns    80032a <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800393:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800396:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800399:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003a0:	eb 88                	jmp    80032a <vprintfmt+0x63>
+			if (width < 0)
+  8003a2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003a5:	85 db                	test   %ebx,%ebx
+  8003a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ac:	0f 49 c3             	cmovns %ebx,%eax
+  8003af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b2:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003b4:	e9 71 ff ff ff       	jmp    80032a <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b9:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003bb:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003c2:	e9 63 ff ff ff       	jmp    80032a <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003c7:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003ca:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003ce:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003d5:	3c 67                	cmp    $0x67,%al
+  8003d7:	0f 84 18 ff ff ff    	je     8002f5 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003dd:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003e4:	3c 72                	cmp    $0x72,%al
+  8003e6:	0f 84 09 ff ff ff    	je     8002f5 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003ec:	3c 62                	cmp    $0x62,%al
+  8003ee:	0f 94 c0             	sete   %al
+  8003f1:	0f b6 c0             	movzbl %al,%eax
+  8003f4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003fa:	e9 f6 fe ff ff       	jmp    8002f5 <vprintfmt+0x2e>
+  8003ff:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800402:	eb 89                	jmp    80038d <vprintfmt+0xc6>
+			lflag++;
+  800404:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800407:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800409:	e9 1c ff ff ff       	jmp    80032a <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80040e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800411:	8d 58 04             	lea    0x4(%eax),%ebx
+  800414:	83 ec 08             	sub    $0x8,%esp
+  800417:	ff 75 0c             	push   0xc(%ebp)
+  80041a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80041d:	c1 e0 08             	shl    $0x8,%eax
+  800420:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800423:	0b 01                	or     (%ecx),%eax
+  800425:	50                   	push   %eax
+  800426:	ff d7                	call   *%edi
+			break;
+  800428:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80042b:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80042e:	e9 c2 fe ff ff       	jmp    8002f5 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800433:	8b 45 14             	mov    0x14(%ebp),%eax
+  800436:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800439:	8b 10                	mov    (%eax),%edx
+  80043b:	89 d0                	mov    %edx,%eax
+  80043d:	f7 d8                	neg    %eax
+  80043f:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800442:	83 f8 12             	cmp    $0x12,%eax
+  800445:	7f 25                	jg     80046c <vprintfmt+0x1a5>
+  800447:	8b 14 85 60 2e 80 00 	mov    0x802e60(,%eax,4),%edx
+  80044e:	85 d2                	test   %edx,%edx
+  800450:	74 1a                	je     80046c <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800452:	52                   	push   %edx
+  800453:	68 a1 2f 80 00       	push   $0x802fa1
+  800458:	ff 75 0c             	push   0xc(%ebp)
+  80045b:	57                   	push   %edi
+  80045c:	e8 49 fe ff ff       	call   8002aa <printfmt>
+  800461:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800464:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800467:	e9 89 fe ff ff       	jmp    8002f5 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80046c:	50                   	push   %eax
+  80046d:	68 d7 2b 80 00       	push   $0x802bd7
+  800472:	ff 75 0c             	push   0xc(%ebp)
+  800475:	57                   	push   %edi
+  800476:	e8 2f fe ff ff       	call   8002aa <printfmt>
+  80047b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800481:	e9 6f fe ff ff       	jmp    8002f5 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800486:	8b 45 14             	mov    0x14(%ebp),%eax
+  800489:	83 c0 04             	add    $0x4,%eax
+  80048c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80048f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800492:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800494:	85 c9                	test   %ecx,%ecx
+  800496:	b8 d0 2b 80 00       	mov    $0x802bd0,%eax
+  80049b:	0f 45 c1             	cmovne %ecx,%eax
+  80049e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004a1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a5:	7e 06                	jle    8004ad <vprintfmt+0x1e6>
+  8004a7:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004ab:	75 1a                	jne    8004c7 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004b0:	c1 e0 08             	shl    $0x8,%eax
+  8004b3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004b6:	83 c8 3f             	or     $0x3f,%eax
+  8004b9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004bc:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004bf:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004c2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004c5:	eb 6d                	jmp    800534 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c7:	83 ec 08             	sub    $0x8,%esp
+  8004ca:	ff 75 d0             	push   -0x30(%ebp)
+  8004cd:	ff 75 c8             	push   -0x38(%ebp)
+  8004d0:	e8 39 03 00 00       	call   80080e <strnlen>
+  8004d5:	89 c2                	mov    %eax,%edx
+  8004d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004da:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004dc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004df:	c1 e1 08             	shl    $0x8,%ecx
+  8004e2:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004e6:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e8:	83 c4 10             	add    $0x10,%esp
+  8004eb:	89 c3                	mov    %eax,%ebx
+  8004ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004f3:	89 ce                	mov    %ecx,%esi
+  8004f5:	eb 0f                	jmp    800506 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8004f7:	83 ec 08             	sub    $0x8,%esp
+  8004fa:	ff 75 0c             	push   0xc(%ebp)
+  8004fd:	56                   	push   %esi
+  8004fe:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800500:	83 eb 01             	sub    $0x1,%ebx
+  800503:	83 c4 10             	add    $0x10,%esp
+  800506:	85 db                	test   %ebx,%ebx
+  800508:	7f ed                	jg     8004f7 <vprintfmt+0x230>
+  80050a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800510:	85 c0                	test   %eax,%eax
+  800512:	ba 00 00 00 00       	mov    $0x0,%edx
+  800517:	0f 49 d0             	cmovns %eax,%edx
+  80051a:	29 d0                	sub    %edx,%eax
+  80051c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051f:	eb 8c                	jmp    8004ad <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800521:	83 ec 08             	sub    $0x8,%esp
+  800524:	ff 75 0c             	push   0xc(%ebp)
+  800527:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80052a:	09 c2                	or     %eax,%edx
+  80052c:	52                   	push   %edx
+  80052d:	ff d7                	call   *%edi
+  80052f:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800532:	89 d9                	mov    %ebx,%ecx
+  800534:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800537:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80053b:	0f be d0             	movsbl %al,%edx
+  80053e:	85 d2                	test   %edx,%edx
+  800540:	74 2a                	je     80056c <vprintfmt+0x2a5>
+  800542:	85 f6                	test   %esi,%esi
+  800544:	78 05                	js     80054b <vprintfmt+0x284>
+  800546:	83 ee 01             	sub    $0x1,%esi
+  800549:	78 3b                	js     800586 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80054b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80054f:	74 d0                	je     800521 <vprintfmt+0x25a>
+  800551:	0f be c0             	movsbl %al,%eax
+  800554:	83 e8 20             	sub    $0x20,%eax
+  800557:	83 f8 5e             	cmp    $0x5e,%eax
+  80055a:	76 c5                	jbe    800521 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80055c:	83 ec 08             	sub    $0x8,%esp
+  80055f:	ff 75 0c             	push   0xc(%ebp)
+  800562:	ff 75 cc             	push   -0x34(%ebp)
+  800565:	ff d7                	call   *%edi
+  800567:	83 c4 10             	add    $0x10,%esp
+  80056a:	eb c6                	jmp    800532 <vprintfmt+0x26b>
+  80056c:	8b 75 10             	mov    0x10(%ebp),%esi
+  80056f:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800572:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800575:	01 c3                	add    %eax,%ebx
+  800577:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800579:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80057c:	83 c8 20             	or     $0x20,%eax
+  80057f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800582:	89 c6                	mov    %eax,%esi
+  800584:	eb 14                	jmp    80059a <vprintfmt+0x2d3>
+  800586:	8b 75 10             	mov    0x10(%ebp),%esi
+  800589:	eb e4                	jmp    80056f <vprintfmt+0x2a8>
+  80058b:	83 ec 08             	sub    $0x8,%esp
+  80058e:	ff 75 0c             	push   0xc(%ebp)
+  800591:	56                   	push   %esi
+  800592:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800594:	83 eb 01             	sub    $0x1,%ebx
+  800597:	83 c4 10             	add    $0x10,%esp
+  80059a:	85 db                	test   %ebx,%ebx
+  80059c:	7f ed                	jg     80058b <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80059e:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005a1:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005a4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a7:	e9 49 fd ff ff       	jmp    8002f5 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005ac:	83 f9 01             	cmp    $0x1,%ecx
+  8005af:	7f 1f                	jg     8005d0 <vprintfmt+0x309>
+	else if (lflag)
+  8005b1:	85 c9                	test   %ecx,%ecx
+  8005b3:	74 69                	je     80061e <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 00                	mov    (%eax),%eax
+  8005ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005bd:	89 c1                	mov    %eax,%ecx
+  8005bf:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005c2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ce:	eb 17                	jmp    8005e7 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d3:	8b 50 04             	mov    0x4(%eax),%edx
+  8005d6:	8b 00                	mov    (%eax),%eax
+  8005d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005db:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e1:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005e7:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005ea:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005f2:	85 db                	test   %ebx,%ebx
+  8005f4:	0f 89 f6 00 00 00    	jns    8006f0 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8005fa:	83 ec 08             	sub    $0x8,%esp
+  8005fd:	ff 75 0c             	push   0xc(%ebp)
+  800600:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800603:	c1 e0 08             	shl    $0x8,%eax
+  800606:	83 c8 2d             	or     $0x2d,%eax
+  800609:	50                   	push   %eax
+  80060a:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80060c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80060f:	f7 d9                	neg    %ecx
+  800611:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800614:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800619:	e9 d2 00 00 00       	jmp    8006f0 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80061e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800621:	8b 00                	mov    (%eax),%eax
+  800623:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800626:	89 c1                	mov    %eax,%ecx
+  800628:	c1 f9 1f             	sar    $0x1f,%ecx
+  80062b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8d 40 04             	lea    0x4(%eax),%eax
+  800634:	89 45 14             	mov    %eax,0x14(%ebp)
+  800637:	eb ae                	jmp    8005e7 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800639:	83 f9 01             	cmp    $0x1,%ecx
+  80063c:	7f 19                	jg     800657 <vprintfmt+0x390>
+	else if (lflag)
+  80063e:	85 c9                	test   %ecx,%ecx
+  800640:	74 2a                	je     80066c <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800642:	8b 45 14             	mov    0x14(%ebp),%eax
+  800645:	8b 08                	mov    (%eax),%ecx
+  800647:	8d 40 04             	lea    0x4(%eax),%eax
+  80064a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064d:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800652:	e9 99 00 00 00       	jmp    8006f0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8b 08                	mov    (%eax),%ecx
+  80065c:	8d 40 08             	lea    0x8(%eax),%eax
+  80065f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800662:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800667:	e9 84 00 00 00       	jmp    8006f0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 08                	mov    (%eax),%ecx
+  800671:	8d 40 04             	lea    0x4(%eax),%eax
+  800674:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800677:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  80067c:	eb 72                	jmp    8006f0 <vprintfmt+0x429>
+	if (lflag >= 2)
+  80067e:	83 f9 01             	cmp    $0x1,%ecx
+  800681:	7f 16                	jg     800699 <vprintfmt+0x3d2>
+	else if (lflag)
+  800683:	85 c9                	test   %ecx,%ecx
+  800685:	74 24                	je     8006ab <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 08                	mov    (%eax),%ecx
+  80068c:	8d 40 04             	lea    0x4(%eax),%eax
+  80068f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800692:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800697:	eb 57                	jmp    8006f0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800699:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069c:	8b 08                	mov    (%eax),%ecx
+  80069e:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a4:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006a9:	eb 45                	jmp    8006f0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ae:	8b 08                	mov    (%eax),%ecx
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b6:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006bb:	eb 33                	jmp    8006f0 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006bd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006c0:	c1 e3 08             	shl    $0x8,%ebx
+  8006c3:	83 ec 08             	sub    $0x8,%esp
+  8006c6:	ff 75 0c             	push   0xc(%ebp)
+  8006c9:	89 d8                	mov    %ebx,%eax
+  8006cb:	83 c8 30             	or     $0x30,%eax
+  8006ce:	50                   	push   %eax
+  8006cf:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006d1:	83 c4 08             	add    $0x8,%esp
+  8006d4:	ff 75 0c             	push   0xc(%ebp)
+  8006d7:	83 cb 78             	or     $0x78,%ebx
+  8006da:	53                   	push   %ebx
+  8006db:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e0:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006e2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006eb:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006f0:	ff 75 e4             	push   -0x1c(%ebp)
+  8006f3:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006f7:	52                   	push   %edx
+  8006f8:	ff 75 e0             	push   -0x20(%ebp)
+  8006fb:	50                   	push   %eax
+  8006fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006ff:	89 f8                	mov    %edi,%eax
+  800701:	e8 f7 fa ff ff       	call   8001fd <printnum>
+			break;
+  800706:	83 c4 10             	add    $0x10,%esp
+  800709:	e9 e7 fb ff ff       	jmp    8002f5 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80070e:	83 f9 01             	cmp    $0x1,%ecx
+  800711:	7f 16                	jg     800729 <vprintfmt+0x462>
+	else if (lflag)
+  800713:	85 c9                	test   %ecx,%ecx
+  800715:	74 24                	je     80073b <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071a:	8b 08                	mov    (%eax),%ecx
+  80071c:	8d 40 04             	lea    0x4(%eax),%eax
+  80071f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800722:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800727:	eb c7                	jmp    8006f0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	8b 08                	mov    (%eax),%ecx
+  80072e:	8d 40 08             	lea    0x8(%eax),%eax
+  800731:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800734:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800739:	eb b5                	jmp    8006f0 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80073b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073e:	8b 08                	mov    (%eax),%ecx
+  800740:	8d 40 04             	lea    0x4(%eax),%eax
+  800743:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800746:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80074b:	eb a3                	jmp    8006f0 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80074d:	83 ec 08             	sub    $0x8,%esp
+  800750:	ff 75 0c             	push   0xc(%ebp)
+  800753:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800756:	c1 e0 08             	shl    $0x8,%eax
+  800759:	83 c8 25             	or     $0x25,%eax
+  80075c:	50                   	push   %eax
+  80075d:	ff d7                	call   *%edi
+			break;
+  80075f:	83 c4 10             	add    $0x10,%esp
+  800762:	e9 8e fb ff ff       	jmp    8002f5 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800767:	83 ec 08             	sub    $0x8,%esp
+  80076a:	ff 75 0c             	push   0xc(%ebp)
+  80076d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800770:	c1 e0 08             	shl    $0x8,%eax
+  800773:	83 c8 25             	or     $0x25,%eax
+  800776:	50                   	push   %eax
+  800777:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800779:	83 c4 10             	add    $0x10,%esp
+  80077c:	89 de                	mov    %ebx,%esi
+  80077e:	eb 03                	jmp    800783 <vprintfmt+0x4bc>
+  800780:	83 ee 01             	sub    $0x1,%esi
+  800783:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800787:	75 f7                	jne    800780 <vprintfmt+0x4b9>
+  800789:	e9 67 fb ff ff       	jmp    8002f5 <vprintfmt+0x2e>
+
+0080078e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80078e:	55                   	push   %ebp
+  80078f:	89 e5                	mov    %esp,%ebp
+  800791:	83 ec 18             	sub    $0x18,%esp
+  800794:	8b 45 08             	mov    0x8(%ebp),%eax
+  800797:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80079a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80079d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007a1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007a4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007ab:	85 c0                	test   %eax,%eax
+  8007ad:	74 26                	je     8007d5 <vsnprintf+0x47>
+  8007af:	85 d2                	test   %edx,%edx
+  8007b1:	7e 22                	jle    8007d5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007b3:	ff 75 14             	push   0x14(%ebp)
+  8007b6:	ff 75 10             	push   0x10(%ebp)
+  8007b9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007bc:	50                   	push   %eax
+  8007bd:	68 8d 02 80 00       	push   $0x80028d
+  8007c2:	e8 00 fb ff ff       	call   8002c7 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007c7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ca:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007d0:	83 c4 10             	add    $0x10,%esp
+}
+  8007d3:	c9                   	leave
+  8007d4:	c3                   	ret
+		return -E_INVAL;
+  8007d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007da:	eb f7                	jmp    8007d3 <vsnprintf+0x45>
+
+008007dc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007dc:	55                   	push   %ebp
+  8007dd:	89 e5                	mov    %esp,%ebp
+  8007df:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007e2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007e5:	50                   	push   %eax
+  8007e6:	ff 75 10             	push   0x10(%ebp)
+  8007e9:	ff 75 0c             	push   0xc(%ebp)
+  8007ec:	ff 75 08             	push   0x8(%ebp)
+  8007ef:	e8 9a ff ff ff       	call   80078e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007f4:	c9                   	leave
+  8007f5:	c3                   	ret
+
+008007f6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800801:	eb 03                	jmp    800806 <strlen+0x10>
+		n++;
+  800803:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800806:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80080a:	75 f7                	jne    800803 <strlen+0xd>
+	return n;
+}
+  80080c:	5d                   	pop    %ebp
+  80080d:	c3                   	ret
+
+0080080e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800814:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081c:	eb 03                	jmp    800821 <strnlen+0x13>
+		n++;
+  80081e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800821:	39 d0                	cmp    %edx,%eax
+  800823:	74 08                	je     80082d <strnlen+0x1f>
+  800825:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800829:	75 f3                	jne    80081e <strnlen+0x10>
+  80082b:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80082d:	89 d0                	mov    %edx,%eax
+  80082f:	5d                   	pop    %ebp
+  800830:	c3                   	ret
+
+00800831 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800831:	55                   	push   %ebp
+  800832:	89 e5                	mov    %esp,%ebp
+  800834:	53                   	push   %ebx
+  800835:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800838:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80083b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800840:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800844:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800847:	83 c0 01             	add    $0x1,%eax
+  80084a:	84 d2                	test   %dl,%dl
+  80084c:	75 f2                	jne    800840 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80084e:	89 c8                	mov    %ecx,%eax
+  800850:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800853:	c9                   	leave
+  800854:	c3                   	ret
+
+00800855 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800855:	55                   	push   %ebp
+  800856:	89 e5                	mov    %esp,%ebp
+  800858:	53                   	push   %ebx
+  800859:	83 ec 10             	sub    $0x10,%esp
+  80085c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80085f:	53                   	push   %ebx
+  800860:	e8 91 ff ff ff       	call   8007f6 <strlen>
+  800865:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800868:	ff 75 0c             	push   0xc(%ebp)
+  80086b:	01 d8                	add    %ebx,%eax
+  80086d:	50                   	push   %eax
+  80086e:	e8 be ff ff ff       	call   800831 <strcpy>
+	return dst;
+}
+  800873:	89 d8                	mov    %ebx,%eax
+  800875:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800878:	c9                   	leave
+  800879:	c3                   	ret
+
+0080087a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80087a:	55                   	push   %ebp
+  80087b:	89 e5                	mov    %esp,%ebp
+  80087d:	56                   	push   %esi
+  80087e:	53                   	push   %ebx
+  80087f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800882:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800885:	89 f3                	mov    %esi,%ebx
+  800887:	03 5d 10             	add    0x10(%ebp),%ebx
+  80088a:	89 f0                	mov    %esi,%eax
+  80088c:	eb 0f                	jmp    80089d <strncpy+0x23>
+		*dst++ = *src;
+  80088e:	83 c0 01             	add    $0x1,%eax
+  800891:	0f b6 0a             	movzbl (%edx),%ecx
+  800894:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800897:	80 f9 01             	cmp    $0x1,%cl
+  80089a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80089d:	39 d8                	cmp    %ebx,%eax
+  80089f:	75 ed                	jne    80088e <strncpy+0x14>
+	}
+	return ret;
+}
+  8008a1:	89 f0                	mov    %esi,%eax
+  8008a3:	5b                   	pop    %ebx
+  8008a4:	5e                   	pop    %esi
+  8008a5:	5d                   	pop    %ebp
+  8008a6:	c3                   	ret
+
+008008a7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008a7:	55                   	push   %ebp
+  8008a8:	89 e5                	mov    %esp,%ebp
+  8008aa:	56                   	push   %esi
+  8008ab:	53                   	push   %ebx
+  8008ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b2:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008b5:	89 f0                	mov    %esi,%eax
+  8008b7:	85 d2                	test   %edx,%edx
+  8008b9:	74 21                	je     8008dc <strlcpy+0x35>
+  8008bb:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008bf:	89 f2                	mov    %esi,%edx
+  8008c1:	eb 09                	jmp    8008cc <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008c3:	83 c1 01             	add    $0x1,%ecx
+  8008c6:	83 c2 01             	add    $0x1,%edx
+  8008c9:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008cc:	39 c2                	cmp    %eax,%edx
+  8008ce:	74 09                	je     8008d9 <strlcpy+0x32>
+  8008d0:	0f b6 19             	movzbl (%ecx),%ebx
+  8008d3:	84 db                	test   %bl,%bl
+  8008d5:	75 ec                	jne    8008c3 <strlcpy+0x1c>
+  8008d7:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008d9:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008dc:	29 f0                	sub    %esi,%eax
+}
+  8008de:	5b                   	pop    %ebx
+  8008df:	5e                   	pop    %esi
+  8008e0:	5d                   	pop    %ebp
+  8008e1:	c3                   	ret
+
+008008e2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008e2:	55                   	push   %ebp
+  8008e3:	89 e5                	mov    %esp,%ebp
+  8008e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008eb:	eb 06                	jmp    8008f3 <strcmp+0x11>
+		p++, q++;
+  8008ed:	83 c1 01             	add    $0x1,%ecx
+  8008f0:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008f3:	0f b6 01             	movzbl (%ecx),%eax
+  8008f6:	84 c0                	test   %al,%al
+  8008f8:	74 04                	je     8008fe <strcmp+0x1c>
+  8008fa:	3a 02                	cmp    (%edx),%al
+  8008fc:	74 ef                	je     8008ed <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008fe:	0f b6 c0             	movzbl %al,%eax
+  800901:	0f b6 12             	movzbl (%edx),%edx
+  800904:	29 d0                	sub    %edx,%eax
+}
+  800906:	5d                   	pop    %ebp
+  800907:	c3                   	ret
+
+00800908 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	53                   	push   %ebx
+  80090c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800912:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800915:	eb 09                	jmp    800920 <strncmp+0x18>
+		n--, p++, q++;
+  800917:	83 ea 01             	sub    $0x1,%edx
+  80091a:	83 c0 01             	add    $0x1,%eax
+  80091d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800920:	85 d2                	test   %edx,%edx
+  800922:	74 18                	je     80093c <strncmp+0x34>
+  800924:	0f b6 18             	movzbl (%eax),%ebx
+  800927:	84 db                	test   %bl,%bl
+  800929:	74 04                	je     80092f <strncmp+0x27>
+  80092b:	3a 19                	cmp    (%ecx),%bl
+  80092d:	74 e8                	je     800917 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80092f:	0f b6 00             	movzbl (%eax),%eax
+  800932:	0f b6 11             	movzbl (%ecx),%edx
+  800935:	29 d0                	sub    %edx,%eax
+}
+  800937:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093a:	c9                   	leave
+  80093b:	c3                   	ret
+		return 0;
+  80093c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800941:	eb f4                	jmp    800937 <strncmp+0x2f>
+
+00800943 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800943:	55                   	push   %ebp
+  800944:	89 e5                	mov    %esp,%ebp
+  800946:	8b 45 08             	mov    0x8(%ebp),%eax
+  800949:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80094d:	eb 03                	jmp    800952 <strchr+0xf>
+  80094f:	83 c0 01             	add    $0x1,%eax
+  800952:	0f b6 10             	movzbl (%eax),%edx
+  800955:	84 d2                	test   %dl,%dl
+  800957:	74 06                	je     80095f <strchr+0x1c>
+		if (*s == c)
+  800959:	38 ca                	cmp    %cl,%dl
+  80095b:	75 f2                	jne    80094f <strchr+0xc>
+  80095d:	eb 05                	jmp    800964 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800964:	5d                   	pop    %ebp
+  800965:	c3                   	ret
+
+00800966 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800966:	55                   	push   %ebp
+  800967:	89 e5                	mov    %esp,%ebp
+  800969:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800970:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800973:	38 ca                	cmp    %cl,%dl
+  800975:	74 09                	je     800980 <strfind+0x1a>
+  800977:	84 d2                	test   %dl,%dl
+  800979:	74 05                	je     800980 <strfind+0x1a>
+	for (; *s; s++)
+  80097b:	83 c0 01             	add    $0x1,%eax
+  80097e:	eb f0                	jmp    800970 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800980:	5d                   	pop    %ebp
+  800981:	c3                   	ret
+
+00800982 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	57                   	push   %edi
+  800986:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800989:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80098c:	85 c9                	test   %ecx,%ecx
+  80098e:	74 20                	je     8009b0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800990:	89 f8                	mov    %edi,%eax
+  800992:	09 c8                	or     %ecx,%eax
+  800994:	a8 03                	test   $0x3,%al
+  800996:	75 12                	jne    8009aa <memset+0x28>
+		c &= 0xFF;
+  800998:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80099c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009a2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009a5:	fc                   	cld
+  8009a6:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009a8:	eb 06                	jmp    8009b0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009ad:	fc                   	cld
+  8009ae:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009b0:	89 f8                	mov    %edi,%eax
+  8009b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009b5:	c9                   	leave
+  8009b6:	c3                   	ret
+
+008009b7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009b7:	55                   	push   %ebp
+  8009b8:	89 e5                	mov    %esp,%ebp
+  8009ba:	57                   	push   %edi
+  8009bb:	56                   	push   %esi
+  8009bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009c2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009c5:	39 c6                	cmp    %eax,%esi
+  8009c7:	73 32                	jae    8009fb <memmove+0x44>
+  8009c9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009cc:	39 d0                	cmp    %edx,%eax
+  8009ce:	73 2b                	jae    8009fb <memmove+0x44>
+		s += n;
+		d += n;
+  8009d0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009d3:	89 d6                	mov    %edx,%esi
+  8009d5:	09 fe                	or     %edi,%esi
+  8009d7:	09 ce                	or     %ecx,%esi
+  8009d9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009df:	75 0e                	jne    8009ef <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009e1:	83 ef 04             	sub    $0x4,%edi
+  8009e4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009e7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009ea:	fd                   	std
+  8009eb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ed:	eb 09                	jmp    8009f8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009ef:	83 ef 01             	sub    $0x1,%edi
+  8009f2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009f5:	fd                   	std
+  8009f6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009f8:	fc                   	cld
+  8009f9:	eb 1a                	jmp    800a15 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009fb:	89 f2                	mov    %esi,%edx
+  8009fd:	09 c2                	or     %eax,%edx
+  8009ff:	09 ca                	or     %ecx,%edx
+  800a01:	f6 c2 03             	test   $0x3,%dl
+  800a04:	75 0a                	jne    800a10 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a06:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a09:	89 c7                	mov    %eax,%edi
+  800a0b:	fc                   	cld
+  800a0c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a0e:	eb 05                	jmp    800a15 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a10:	89 c7                	mov    %eax,%edi
+  800a12:	fc                   	cld
+  800a13:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a15:	5e                   	pop    %esi
+  800a16:	5f                   	pop    %edi
+  800a17:	5d                   	pop    %ebp
+  800a18:	c3                   	ret
+
+00800a19 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a1f:	ff 75 10             	push   0x10(%ebp)
+  800a22:	ff 75 0c             	push   0xc(%ebp)
+  800a25:	ff 75 08             	push   0x8(%ebp)
+  800a28:	e8 8a ff ff ff       	call   8009b7 <memmove>
+}
+  800a2d:	c9                   	leave
+  800a2e:	c3                   	ret
+
+00800a2f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	56                   	push   %esi
+  800a33:	53                   	push   %ebx
+  800a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a37:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a3a:	89 c6                	mov    %eax,%esi
+  800a3c:	03 75 10             	add    0x10(%ebp),%esi
+  800a3f:	eb 06                	jmp    800a47 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a41:	83 c0 01             	add    $0x1,%eax
+  800a44:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a47:	39 f0                	cmp    %esi,%eax
+  800a49:	74 14                	je     800a5f <memcmp+0x30>
+		if (*s1 != *s2)
+  800a4b:	0f b6 08             	movzbl (%eax),%ecx
+  800a4e:	0f b6 1a             	movzbl (%edx),%ebx
+  800a51:	38 d9                	cmp    %bl,%cl
+  800a53:	74 ec                	je     800a41 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a55:	0f b6 c1             	movzbl %cl,%eax
+  800a58:	0f b6 db             	movzbl %bl,%ebx
+  800a5b:	29 d8                	sub    %ebx,%eax
+  800a5d:	eb 05                	jmp    800a64 <memcmp+0x35>
+	}
+
+	return 0;
+  800a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a64:	5b                   	pop    %ebx
+  800a65:	5e                   	pop    %esi
+  800a66:	5d                   	pop    %ebp
+  800a67:	c3                   	ret
+
+00800a68 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a68:	55                   	push   %ebp
+  800a69:	89 e5                	mov    %esp,%ebp
+  800a6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a71:	89 c2                	mov    %eax,%edx
+  800a73:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a76:	eb 03                	jmp    800a7b <memfind+0x13>
+  800a78:	83 c0 01             	add    $0x1,%eax
+  800a7b:	39 d0                	cmp    %edx,%eax
+  800a7d:	73 04                	jae    800a83 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a7f:	38 08                	cmp    %cl,(%eax)
+  800a81:	75 f5                	jne    800a78 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a83:	5d                   	pop    %ebp
+  800a84:	c3                   	ret
+
+00800a85 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	57                   	push   %edi
+  800a89:	56                   	push   %esi
+  800a8a:	53                   	push   %ebx
+  800a8b:	83 ec 1c             	sub    $0x1c,%esp
+  800a8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a91:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a94:	eb 03                	jmp    800a99 <strtol+0x14>
+		s++;
+  800a96:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800a99:	0f b6 06             	movzbl (%esi),%eax
+  800a9c:	3c 20                	cmp    $0x20,%al
+  800a9e:	74 f6                	je     800a96 <strtol+0x11>
+  800aa0:	3c 09                	cmp    $0x9,%al
+  800aa2:	74 f2                	je     800a96 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aa4:	3c 2b                	cmp    $0x2b,%al
+  800aa6:	74 43                	je     800aeb <strtol+0x66>
+	int neg = 0;
+  800aa8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800aad:	3c 2d                	cmp    $0x2d,%al
+  800aaf:	74 44                	je     800af5 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab1:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ab7:	75 0f                	jne    800ac8 <strtol+0x43>
+  800ab9:	80 3e 30             	cmpb   $0x30,(%esi)
+  800abc:	74 41                	je     800aff <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800abe:	85 ff                	test   %edi,%edi
+  800ac0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ac5:	0f 44 f8             	cmove  %eax,%edi
+  800ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acd:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800ad2:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ad5:	89 fb                	mov    %edi,%ebx
+  800ad7:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ada:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800add:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ae0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ae3:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800ae6:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ae9:	eb 67                	jmp    800b52 <strtol+0xcd>
+		s++;
+  800aeb:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800aee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af3:	eb bc                	jmp    800ab1 <strtol+0x2c>
+		s++, neg = 1;
+  800af5:	83 c6 01             	add    $0x1,%esi
+  800af8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800afd:	eb b2                	jmp    800ab1 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aff:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b03:	74 0e                	je     800b13 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b05:	85 ff                	test   %edi,%edi
+  800b07:	75 bf                	jne    800ac8 <strtol+0x43>
+		s++, base = 8;
+  800b09:	83 c6 01             	add    $0x1,%esi
+  800b0c:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b11:	eb b5                	jmp    800ac8 <strtol+0x43>
+		s += 2, base = 16;
+  800b13:	83 c6 02             	add    $0x2,%esi
+  800b16:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b1b:	eb ab                	jmp    800ac8 <strtol+0x43>
+			dig = *s - '0';
+  800b1d:	0f be c9             	movsbl %cl,%ecx
+  800b20:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b23:	39 f9                	cmp    %edi,%ecx
+  800b25:	7d 59                	jge    800b80 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b27:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b2b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b2e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b31:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b34:	0f af d8             	imul   %eax,%ebx
+  800b37:	0f af d7             	imul   %edi,%edx
+  800b3a:	01 d3                	add    %edx,%ebx
+  800b3c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b3f:	f7 e7                	mul    %edi
+  800b41:	01 da                	add    %ebx,%edx
+  800b43:	89 cb                	mov    %ecx,%ebx
+  800b45:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b48:	01 c8                	add    %ecx,%eax
+  800b4a:	11 da                	adc    %ebx,%edx
+  800b4c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b4f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b52:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b55:	0f b6 08             	movzbl (%eax),%ecx
+  800b58:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b5b:	80 fb 09             	cmp    $0x9,%bl
+  800b5e:	76 bd                	jbe    800b1d <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b60:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b63:	80 fb 19             	cmp    $0x19,%bl
+  800b66:	77 08                	ja     800b70 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b68:	0f be c9             	movsbl %cl,%ecx
+  800b6b:	83 e9 57             	sub    $0x57,%ecx
+  800b6e:	eb b3                	jmp    800b23 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b70:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b73:	80 fb 19             	cmp    $0x19,%bl
+  800b76:	77 08                	ja     800b80 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b78:	0f be c9             	movsbl %cl,%ecx
+  800b7b:	83 e9 37             	sub    $0x37,%ecx
+  800b7e:	eb a3                	jmp    800b23 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b80:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b83:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b86:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b89:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b8c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b90:	74 05                	je     800b97 <strtol+0x112>
+		*endptr = (char *) s;
+  800b92:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b95:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800b97:	85 c9                	test   %ecx,%ecx
+  800b99:	74 07                	je     800ba2 <strtol+0x11d>
+  800b9b:	f7 d8                	neg    %eax
+  800b9d:	83 d2 00             	adc    $0x0,%edx
+  800ba0:	f7 da                	neg    %edx
+}
+  800ba2:	83 c4 1c             	add    $0x1c,%esp
+  800ba5:	5b                   	pop    %ebx
+  800ba6:	5e                   	pop    %esi
+  800ba7:	5f                   	pop    %edi
+  800ba8:	5d                   	pop    %ebp
+  800ba9:	c3                   	ret
+
+00800baa <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800baa:	55                   	push   %ebp
+  800bab:	89 e5                	mov    %esp,%ebp
+  800bad:	57                   	push   %edi
+  800bae:	56                   	push   %esi
+  800baf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bb0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bb7:	74 18                	je     800bd1 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc4:	89 c3                	mov    %eax,%ebx
+  800bc6:	89 c7                	mov    %eax,%edi
+  800bc8:	89 c6                	mov    %eax,%esi
+  800bca:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bcc:	5b                   	pop    %ebx
+  800bcd:	5e                   	pop    %esi
+  800bce:	5f                   	pop    %edi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bdc:	89 c3                	mov    %eax,%ebx
+  800bde:	89 c7                	mov    %eax,%edi
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	8d 35 eb 0b 80 00    	lea    0x800beb,%esi
+  800be9:	0f 34                	sysenter
+  800beb:	5d                   	pop    %ebp
+		goto out;
+  800bec:	eb de                	jmp    800bcc <sys_cputs+0x22>
+
+00800bee <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	57                   	push   %edi
+  800bf2:	56                   	push   %esi
+  800bf3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bf4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bfb:	74 19                	je     800c16 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800bfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c02:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c07:	89 d1                	mov    %edx,%ecx
+  800c09:	89 d3                	mov    %edx,%ebx
+  800c0b:	89 d7                	mov    %edx,%edi
+  800c0d:	89 d6                	mov    %edx,%esi
+  800c0f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c11:	5b                   	pop    %ebx
+  800c12:	5e                   	pop    %esi
+  800c13:	5f                   	pop    %edi
+  800c14:	5d                   	pop    %ebp
+  800c15:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c20:	89 d1                	mov    %edx,%ecx
+  800c22:	89 d3                	mov    %edx,%ebx
+  800c24:	89 d7                	mov    %edx,%edi
+  800c26:	55                   	push   %ebp
+  800c27:	89 e5                	mov    %esp,%ebp
+  800c29:	8d 35 31 0c 80 00    	lea    0x800c31,%esi
+  800c2f:	0f 34                	sysenter
+  800c31:	5d                   	pop    %ebp
+		goto out;
+  800c32:	eb dd                	jmp    800c11 <sys_cgetc+0x23>
+
+00800c34 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	57                   	push   %edi
+  800c38:	56                   	push   %esi
+  800c39:	53                   	push   %ebx
+  800c3a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c3d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c44:	74 21                	je     800c67 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c4b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c53:	89 cb                	mov    %ecx,%ebx
+  800c55:	89 cf                	mov    %ecx,%edi
+  800c57:	89 ce                	mov    %ecx,%esi
+  800c59:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c5b:	85 c0                	test   %eax,%eax
+  800c5d:	7f 27                	jg     800c86 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c62:	5b                   	pop    %ebx
+  800c63:	5e                   	pop    %esi
+  800c64:	5f                   	pop    %edi
+  800c65:	5d                   	pop    %ebp
+  800c66:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c74:	89 cb                	mov    %ecx,%ebx
+  800c76:	89 cf                	mov    %ecx,%edi
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	8d 35 83 0c 80 00    	lea    0x800c83,%esi
+  800c81:	0f 34                	sysenter
+  800c83:	5d                   	pop    %ebp
+		goto out;
+  800c84:	eb d5                	jmp    800c5b <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c86:	83 ec 0c             	sub    $0xc,%esp
+  800c89:	50                   	push   %eax
+  800c8a:	6a 03                	push   $0x3
+  800c8c:	68 cb 2e 80 00       	push   $0x802ecb
+  800c91:	6a 3f                	push   $0x3f
+  800c93:	68 e8 2e 80 00       	push   $0x802ee8
+  800c98:	e8 71 f4 ff ff       	call   80010e <_panic>
+
+00800c9d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	57                   	push   %edi
+  800ca1:	56                   	push   %esi
+  800ca2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ca3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800caa:	74 19                	je     800cc5 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800cac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cb6:	89 d1                	mov    %edx,%ecx
+  800cb8:	89 d3                	mov    %edx,%ebx
+  800cba:	89 d7                	mov    %edx,%edi
+  800cbc:	89 d6                	mov    %edx,%esi
+  800cbe:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cc0:	5b                   	pop    %ebx
+  800cc1:	5e                   	pop    %esi
+  800cc2:	5f                   	pop    %edi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cca:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ccf:	89 d1                	mov    %edx,%ecx
+  800cd1:	89 d3                	mov    %edx,%ebx
+  800cd3:	89 d7                	mov    %edx,%edi
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	8d 35 e0 0c 80 00    	lea    0x800ce0,%esi
+  800cde:	0f 34                	sysenter
+  800ce0:	5d                   	pop    %ebp
+		goto out;
+  800ce1:	eb dd                	jmp    800cc0 <sys_getenvid+0x23>
+
+00800ce3 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	57                   	push   %edi
+  800ce7:	56                   	push   %esi
+  800ce8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ce9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cf0:	74 19                	je     800d0b <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800cf2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cfc:	89 d1                	mov    %edx,%ecx
+  800cfe:	89 d3                	mov    %edx,%ebx
+  800d00:	89 d7                	mov    %edx,%edi
+  800d02:	89 d6                	mov    %edx,%esi
+  800d04:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d06:	5b                   	pop    %ebx
+  800d07:	5e                   	pop    %esi
+  800d08:	5f                   	pop    %edi
+  800d09:	5d                   	pop    %ebp
+  800d0a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d10:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d15:	89 d1                	mov    %edx,%ecx
+  800d17:	89 d3                	mov    %edx,%ebx
+  800d19:	89 d7                	mov    %edx,%edi
+  800d1b:	55                   	push   %ebp
+  800d1c:	89 e5                	mov    %esp,%ebp
+  800d1e:	8d 35 26 0d 80 00    	lea    0x800d26,%esi
+  800d24:	0f 34                	sysenter
+  800d26:	5d                   	pop    %ebp
+		goto out;
+  800d27:	eb dd                	jmp    800d06 <sys_yield+0x23>
+
+00800d29 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+  800d2f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d32:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d39:	74 23                	je     800d5e <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d3b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d40:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4e:	89 f7                	mov    %esi,%edi
+  800d50:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d52:	85 c0                	test   %eax,%eax
+  800d54:	7f 29                	jg     800d7f <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d64:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	8d 35 7c 0d 80 00    	lea    0x800d7c,%esi
+  800d7a:	0f 34                	sysenter
+  800d7c:	5d                   	pop    %ebp
+		goto out;
+  800d7d:	eb d3                	jmp    800d52 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d7f:	83 ec 0c             	sub    $0xc,%esp
+  800d82:	50                   	push   %eax
+  800d83:	6a 04                	push   $0x4
+  800d85:	68 cb 2e 80 00       	push   $0x802ecb
+  800d8a:	6a 3f                	push   $0x3f
+  800d8c:	68 e8 2e 80 00       	push   $0x802ee8
+  800d91:	e8 78 f3 ff ff       	call   80010e <_panic>
+
+00800d96 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	57                   	push   %edi
+  800d9a:	56                   	push   %esi
+  800d9b:	53                   	push   %ebx
+  800d9c:	83 ec 0c             	sub    $0xc,%esp
+  800d9f:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800da2:	85 f6                	test   %esi,%esi
+  800da4:	75 09                	jne    800daf <sys_page_map+0x19>
+  800da6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dad:	74 1f                	je     800dce <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800daf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc2:	85 c0                	test   %eax,%eax
+  800dc4:	7f 27                	jg     800ded <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	8d 35 ea 0d 80 00    	lea    0x800dea,%esi
+  800de8:	0f 34                	sysenter
+  800dea:	5d                   	pop    %ebp
+		goto out;
+  800deb:	eb d5                	jmp    800dc2 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ded:	83 ec 0c             	sub    $0xc,%esp
+  800df0:	50                   	push   %eax
+  800df1:	6a 05                	push   $0x5
+  800df3:	68 cb 2e 80 00       	push   $0x802ecb
+  800df8:	6a 3f                	push   $0x3f
+  800dfa:	68 e8 2e 80 00       	push   $0x802ee8
+  800dff:	e8 0a f3 ff ff       	call   80010e <_panic>
+
+00800e04 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	57                   	push   %edi
+  800e08:	56                   	push   %esi
+  800e09:	53                   	push   %ebx
+  800e0a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e0d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e14:	74 22                	je     800e38 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e26:	89 df                	mov    %ebx,%edi
+  800e28:	89 de                	mov    %ebx,%esi
+  800e2a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2c:	85 c0                	test   %eax,%eax
+  800e2e:	7f 28                	jg     800e58 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e33:	5b                   	pop    %ebx
+  800e34:	5e                   	pop    %esi
+  800e35:	5f                   	pop    %edi
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e43:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e48:	89 df                	mov    %ebx,%edi
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	8d 35 55 0e 80 00    	lea    0x800e55,%esi
+  800e53:	0f 34                	sysenter
+  800e55:	5d                   	pop    %ebp
+		goto out;
+  800e56:	eb d4                	jmp    800e2c <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+  800e5b:	50                   	push   %eax
+  800e5c:	6a 06                	push   $0x6
+  800e5e:	68 cb 2e 80 00       	push   $0x802ecb
+  800e63:	6a 3f                	push   $0x3f
+  800e65:	68 e8 2e 80 00       	push   $0x802ee8
+  800e6a:	e8 9f f2 ff ff       	call   80010e <_panic>
+
+00800e6f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	57                   	push   %edi
+  800e73:	56                   	push   %esi
+  800e74:	53                   	push   %ebx
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e78:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e7f:	74 22                	je     800ea3 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e86:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e91:	89 df                	mov    %ebx,%edi
+  800e93:	89 de                	mov    %ebx,%esi
+  800e95:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e97:	85 c0                	test   %eax,%eax
+  800e99:	7f 28                	jg     800ec3 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eae:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eb3:	89 df                	mov    %ebx,%edi
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	8d 35 c0 0e 80 00    	lea    0x800ec0,%esi
+  800ebe:	0f 34                	sysenter
+  800ec0:	5d                   	pop    %ebp
+		goto out;
+  800ec1:	eb d4                	jmp    800e97 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	6a 08                	push   $0x8
+  800ec9:	68 cb 2e 80 00       	push   $0x802ecb
+  800ece:	6a 3f                	push   $0x3f
+  800ed0:	68 e8 2e 80 00       	push   $0x802ee8
+  800ed5:	e8 34 f2 ff ff       	call   80010e <_panic>
+
+00800eda <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ee3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eea:	74 22                	je     800f0e <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800eec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	89 df                	mov    %ebx,%edi
+  800efe:	89 de                	mov    %ebx,%esi
+  800f00:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	7f 28                	jg     800f2e <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f19:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f1e:	89 df                	mov    %ebx,%edi
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	8d 35 2b 0f 80 00    	lea    0x800f2b,%esi
+  800f29:	0f 34                	sysenter
+  800f2b:	5d                   	pop    %ebp
+		goto out;
+  800f2c:	eb d4                	jmp    800f02 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  800f31:	50                   	push   %eax
+  800f32:	6a 09                	push   $0x9
+  800f34:	68 cb 2e 80 00       	push   $0x802ecb
+  800f39:	6a 3f                	push   $0x3f
+  800f3b:	68 e8 2e 80 00       	push   $0x802ee8
+  800f40:	e8 c9 f1 ff ff       	call   80010e <_panic>
+
+00800f45 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	57                   	push   %edi
+  800f49:	56                   	push   %esi
+  800f4a:	53                   	push   %ebx
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f4e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f55:	74 22                	je     800f79 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f67:	89 df                	mov    %ebx,%edi
+  800f69:	89 de                	mov    %ebx,%esi
+  800f6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6d:	85 c0                	test   %eax,%eax
+  800f6f:	7f 28                	jg     800f99 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f74:	5b                   	pop    %ebx
+  800f75:	5e                   	pop    %esi
+  800f76:	5f                   	pop    %edi
+  800f77:	5d                   	pop    %ebp
+  800f78:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f84:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f89:	89 df                	mov    %ebx,%edi
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	8d 35 96 0f 80 00    	lea    0x800f96,%esi
+  800f94:	0f 34                	sysenter
+  800f96:	5d                   	pop    %ebp
+		goto out;
+  800f97:	eb d4                	jmp    800f6d <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+  800f9c:	50                   	push   %eax
+  800f9d:	6a 0a                	push   $0xa
+  800f9f:	68 cb 2e 80 00       	push   $0x802ecb
+  800fa4:	6a 3f                	push   $0x3f
+  800fa6:	68 e8 2e 80 00       	push   $0x802ee8
+  800fab:	e8 5e f1 ff ff       	call   80010e <_panic>
+
+00800fb0 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	57                   	push   %edi
+  800fb4:	56                   	push   %esi
+  800fb5:	53                   	push   %ebx
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fb9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fc0:	74 22                	je     800fe4 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc7:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	89 df                	mov    %ebx,%edi
+  800fd4:	89 de                	mov    %ebx,%esi
+  800fd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 28                	jg     801004 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5f                   	pop    %edi
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fe4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ff4:	89 df                	mov    %ebx,%edi
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	8d 35 01 10 80 00    	lea    0x801001,%esi
+  800fff:	0f 34                	sysenter
+  801001:	5d                   	pop    %ebp
+		goto out;
+  801002:	eb d4                	jmp    800fd8 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 17                	push   $0x17
+  80100a:	68 cb 2e 80 00       	push   $0x802ecb
+  80100f:	6a 3f                	push   $0x3f
+  801011:	68 e8 2e 80 00       	push   $0x802ee8
+  801016:	e8 f3 f0 ff ff       	call   80010e <_panic>
+
+0080101b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801024:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80102b:	74 22                	je     80104f <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80102d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801032:	b8 18 00 00 00       	mov    $0x18,%eax
+  801037:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103d:	89 df                	mov    %ebx,%edi
+  80103f:	89 de                	mov    %ebx,%esi
+  801041:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801043:	85 c0                	test   %eax,%eax
+  801045:	7f 28                	jg     80106f <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80104f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801054:	8b 55 08             	mov    0x8(%ebp),%edx
+  801057:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80105f:	89 df                	mov    %ebx,%edi
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	8d 35 6c 10 80 00    	lea    0x80106c,%esi
+  80106a:	0f 34                	sysenter
+  80106c:	5d                   	pop    %ebp
+		goto out;
+  80106d:	eb d4                	jmp    801043 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	50                   	push   %eax
+  801073:	6a 18                	push   $0x18
+  801075:	68 cb 2e 80 00       	push   $0x802ecb
+  80107a:	6a 3f                	push   $0x3f
+  80107c:	68 e8 2e 80 00       	push   $0x802ee8
+  801081:	e8 88 f0 ff ff       	call   80010e <_panic>
+
+00801086 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80108c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801093:	74 1d                	je     8010b2 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801095:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80109a:	be 00 00 00 00       	mov    $0x0,%esi
+  80109f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ab:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010ad:	5b                   	pop    %ebx
+  8010ae:	5e                   	pop    %esi
+  8010af:	5f                   	pop    %edi
+  8010b0:	5d                   	pop    %ebp
+  8010b1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c3:	55                   	push   %ebp
+  8010c4:	89 e5                	mov    %esp,%ebp
+  8010c6:	8d 35 ce 10 80 00    	lea    0x8010ce,%esi
+  8010cc:	0f 34                	sysenter
+  8010ce:	5d                   	pop    %ebp
+		goto out;
+  8010cf:	eb dc                	jmp    8010ad <sys_ipc_try_send+0x27>
+
+008010d1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	57                   	push   %edi
+  8010d5:	56                   	push   %esi
+  8010d6:	53                   	push   %ebx
+  8010d7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010da:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010e1:	74 21                	je     801104 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f0:	89 cb                	mov    %ecx,%ebx
+  8010f2:	89 cf                	mov    %ecx,%edi
+  8010f4:	89 ce                	mov    %ecx,%esi
+  8010f6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f8:	85 c0                	test   %eax,%eax
+  8010fa:	7f 27                	jg     801123 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ff:	5b                   	pop    %ebx
+  801100:	5e                   	pop    %esi
+  801101:	5f                   	pop    %edi
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801104:	8b 55 08             	mov    0x8(%ebp),%edx
+  801107:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80110c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801111:	89 cb                	mov    %ecx,%ebx
+  801113:	89 cf                	mov    %ecx,%edi
+  801115:	55                   	push   %ebp
+  801116:	89 e5                	mov    %esp,%ebp
+  801118:	8d 35 20 11 80 00    	lea    0x801120,%esi
+  80111e:	0f 34                	sysenter
+  801120:	5d                   	pop    %ebp
+		goto out;
+  801121:	eb d5                	jmp    8010f8 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801123:	83 ec 0c             	sub    $0xc,%esp
+  801126:	50                   	push   %eax
+  801127:	6a 0d                	push   $0xd
+  801129:	68 cb 2e 80 00       	push   $0x802ecb
+  80112e:	6a 3f                	push   $0x3f
+  801130:	68 e8 2e 80 00       	push   $0x802ee8
+  801135:	e8 d4 ef ff ff       	call   80010e <_panic>
+
+0080113a <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	57                   	push   %edi
+  80113e:	56                   	push   %esi
+  80113f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801140:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801147:	74 1b                	je     801164 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801149:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801153:	8b 55 08             	mov    0x8(%ebp),%edx
+  801156:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801159:	89 df                	mov    %ebx,%edi
+  80115b:	89 de                	mov    %ebx,%esi
+  80115d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801164:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801169:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801174:	89 df                	mov    %ebx,%edi
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	8d 35 81 11 80 00    	lea    0x801181,%esi
+  80117f:	0f 34                	sysenter
+  801181:	5d                   	pop    %ebp
+		goto out;
+  801182:	eb db                	jmp    80115f <sys_ipc_recv_until+0x25>
+
+00801184 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801184:	55                   	push   %ebp
+  801185:	89 e5                	mov    %esp,%ebp
+  801187:	57                   	push   %edi
+  801188:	56                   	push   %esi
+  801189:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80118a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801191:	74 19                	je     8011ac <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801193:	ba 00 00 00 00       	mov    $0x0,%edx
+  801198:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80119d:	89 d1                	mov    %edx,%ecx
+  80119f:	89 d3                	mov    %edx,%ebx
+  8011a1:	89 d7                	mov    %edx,%edi
+  8011a3:	89 d6                	mov    %edx,%esi
+  8011a5:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011a7:	5b                   	pop    %ebx
+  8011a8:	5e                   	pop    %esi
+  8011a9:	5f                   	pop    %edi
+  8011aa:	5d                   	pop    %ebp
+  8011ab:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011b6:	89 d1                	mov    %edx,%ecx
+  8011b8:	89 d3                	mov    %edx,%ebx
+  8011ba:	89 d7                	mov    %edx,%edi
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	8d 35 c7 11 80 00    	lea    0x8011c7,%esi
+  8011c5:	0f 34                	sysenter
+  8011c7:	5d                   	pop    %ebp
+		goto out;
+  8011c8:	eb dd                	jmp    8011a7 <sys_time_msec+0x23>
+
+008011ca <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011d0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011d7:	74 1a                	je     8011f3 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011de:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e6:	89 cb                	mov    %ecx,%ebx
+  8011e8:	89 cf                	mov    %ecx,%edi
+  8011ea:	89 ce                	mov    %ecx,%esi
+  8011ec:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011ee:	5b                   	pop    %ebx
+  8011ef:	5e                   	pop    %esi
+  8011f0:	5f                   	pop    %edi
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011fb:	b8 10 00 00 00       	mov    $0x10,%eax
+  801200:	89 cb                	mov    %ecx,%ebx
+  801202:	89 cf                	mov    %ecx,%edi
+  801204:	55                   	push   %ebp
+  801205:	89 e5                	mov    %esp,%ebp
+  801207:	8d 35 0f 12 80 00    	lea    0x80120f,%esi
+  80120d:	0f 34                	sysenter
+  80120f:	5d                   	pop    %ebp
+		goto out;
+  801210:	eb dc                	jmp    8011ee <sys_sleep_until+0x24>
+
+00801212 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	57                   	push   %edi
+  801216:	56                   	push   %esi
+  801217:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801218:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80121f:	74 1a                	je     80123b <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801221:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801226:	b8 11 00 00 00       	mov    $0x11,%eax
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	89 cb                	mov    %ecx,%ebx
+  801230:	89 cf                	mov    %ecx,%edi
+  801232:	89 ce                	mov    %ecx,%esi
+  801234:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801236:	5b                   	pop    %ebx
+  801237:	5e                   	pop    %esi
+  801238:	5f                   	pop    %edi
+  801239:	5d                   	pop    %ebp
+  80123a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80123b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801243:	b8 11 00 00 00       	mov    $0x11,%eax
+  801248:	89 cb                	mov    %ecx,%ebx
+  80124a:	89 cf                	mov    %ecx,%edi
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	8d 35 57 12 80 00    	lea    0x801257,%esi
+  801255:	0f 34                	sysenter
+  801257:	5d                   	pop    %ebp
+		goto out;
+  801258:	eb dc                	jmp    801236 <sys_env_print_stats+0x24>
+
+0080125a <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80125a:	55                   	push   %ebp
+  80125b:	89 e5                	mov    %esp,%ebp
+  80125d:	57                   	push   %edi
+  80125e:	56                   	push   %esi
+  80125f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801260:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801267:	74 1b                	je     801284 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801269:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801273:	8b 55 08             	mov    0x8(%ebp),%edx
+  801276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801279:	89 df                	mov    %ebx,%edi
+  80127b:	89 de                	mov    %ebx,%esi
+  80127d:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801284:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801289:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801294:	89 df                	mov    %ebx,%edi
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	8d 35 a1 12 80 00    	lea    0x8012a1,%esi
+  80129f:	0f 34                	sysenter
+  8012a1:	5d                   	pop    %ebp
+		goto out;
+  8012a2:	eb db                	jmp    80127f <sys_perf+0x25>
+
+008012a4 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012a4:	55                   	push   %ebp
+  8012a5:	89 e5                	mov    %esp,%ebp
+  8012a7:	57                   	push   %edi
+  8012a8:	56                   	push   %esi
+  8012a9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012aa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012b1:	74 19                	je     8012cc <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012bd:	89 d1                	mov    %edx,%ecx
+  8012bf:	89 d3                	mov    %edx,%ebx
+  8012c1:	89 d7                	mov    %edx,%edi
+  8012c3:	89 d6                	mov    %edx,%esi
+  8012c5:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012c7:	5b                   	pop    %ebx
+  8012c8:	5e                   	pop    %esi
+  8012c9:	5f                   	pop    %edi
+  8012ca:	5d                   	pop    %ebp
+  8012cb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012d6:	89 d1                	mov    %edx,%ecx
+  8012d8:	89 d3                	mov    %edx,%ebx
+  8012da:	89 d7                	mov    %edx,%edi
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	8d 35 e7 12 80 00    	lea    0x8012e7,%esi
+  8012e5:	0f 34                	sysenter
+  8012e7:	5d                   	pop    %ebp
+		goto out;
+  8012e8:	eb dd                	jmp    8012c7 <sys_fork+0x23>
+
+008012ea <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	57                   	push   %edi
+  8012ee:	56                   	push   %esi
+  8012ef:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012f0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012f7:	74 1c                	je     801315 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8012f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fe:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801303:	8b 55 08             	mov    0x8(%ebp),%edx
+  801306:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801309:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130c:	89 f7                	mov    %esi,%edi
+  80130e:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801310:	5b                   	pop    %ebx
+  801311:	5e                   	pop    %esi
+  801312:	5f                   	pop    %edi
+  801313:	5d                   	pop    %ebp
+  801314:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801315:	8b 55 08             	mov    0x8(%ebp),%edx
+  801318:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801320:	bf 00 00 00 00       	mov    $0x0,%edi
+  801325:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801328:	55                   	push   %ebp
+  801329:	89 e5                	mov    %esp,%ebp
+  80132b:	8d 35 33 13 80 00    	lea    0x801333,%esi
+  801331:	0f 34                	sysenter
+  801333:	5d                   	pop    %ebp
+		goto out;
+  801334:	eb da                	jmp    801310 <sys_thread_create+0x26>
+
+00801336 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80133f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801346:	74 24                	je     80136c <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801348:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80134d:	be 00 00 00 00       	mov    $0x0,%esi
+  801352:	8b 55 08             	mov    0x8(%ebp),%edx
+  801355:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801358:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80135e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801360:	85 c0                	test   %eax,%eax
+  801362:	7f 27                	jg     80138b <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801364:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801367:	5b                   	pop    %ebx
+  801368:	5e                   	pop    %esi
+  801369:	5f                   	pop    %edi
+  80136a:	5d                   	pop    %ebp
+  80136b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80136c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801372:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801377:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80137a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+  801380:	8d 35 88 13 80 00    	lea    0x801388,%esi
+  801386:	0f 34                	sysenter
+  801388:	5d                   	pop    %ebp
+		goto out;
+  801389:	eb d5                	jmp    801360 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80138b:	83 ec 0c             	sub    $0xc,%esp
+  80138e:	50                   	push   %eax
+  80138f:	6a 1f                	push   $0x1f
+  801391:	68 cb 2e 80 00       	push   $0x802ecb
+  801396:	6a 3f                	push   $0x3f
+  801398:	68 e8 2e 80 00       	push   $0x802ee8
+  80139d:	e8 6c ed ff ff       	call   80010e <_panic>
+
+008013a2 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	53                   	push   %ebx
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013ab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013b2:	74 23                	je     8013d7 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b9:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c7:	89 f7                	mov    %esi,%edi
+  8013c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	7f 29                	jg     8013f8 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013dd:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	8d 35 f5 13 80 00    	lea    0x8013f5,%esi
+  8013f3:	0f 34                	sysenter
+  8013f5:	5d                   	pop    %ebp
+		goto out;
+  8013f6:	eb d3                	jmp    8013cb <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f8:	83 ec 0c             	sub    $0xc,%esp
+  8013fb:	50                   	push   %eax
+  8013fc:	6a 20                	push   $0x20
+  8013fe:	68 cb 2e 80 00       	push   $0x802ecb
+  801403:	6a 3f                	push   $0x3f
+  801405:	68 e8 2e 80 00       	push   $0x802ee8
+  80140a:	e8 ff ec ff ff       	call   80010e <_panic>
+
+0080140f <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	57                   	push   %edi
+  801413:	56                   	push   %esi
+  801414:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801415:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80141c:	74 1b                	je     801439 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80141e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801423:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801428:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142e:	89 df                	mov    %ebx,%edi
+  801430:	89 de                	mov    %ebx,%esi
+  801432:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801434:	5b                   	pop    %ebx
+  801435:	5e                   	pop    %esi
+  801436:	5f                   	pop    %edi
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801439:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801441:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801444:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801449:	89 df                	mov    %ebx,%edi
+  80144b:	55                   	push   %ebp
+  80144c:	89 e5                	mov    %esp,%ebp
+  80144e:	8d 35 56 14 80 00    	lea    0x801456,%esi
+  801454:	0f 34                	sysenter
+  801456:	5d                   	pop    %ebp
+		goto out;
+  801457:	eb db                	jmp    801434 <sys_batch+0x25>
+
+00801459 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80145f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801466:	74 1a                	je     801482 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801468:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801472:	8b 55 08             	mov    0x8(%ebp),%edx
+  801475:	89 cb                	mov    %ecx,%ebx
+  801477:	89 cf                	mov    %ecx,%edi
+  801479:	89 ce                	mov    %ecx,%esi
+  80147b:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80147d:	5b                   	pop    %ebx
+  80147e:	5e                   	pop    %esi
+  80147f:	5f                   	pop    %edi
+  801480:	5d                   	pop    %ebp
+  801481:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801482:	8b 55 08             	mov    0x8(%ebp),%edx
+  801485:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80148f:	89 cb                	mov    %ecx,%ebx
+  801491:	89 cf                	mov    %ecx,%edi
+  801493:	55                   	push   %ebp
+  801494:	89 e5                	mov    %esp,%ebp
+  801496:	8d 35 9e 14 80 00    	lea    0x80149e,%esi
+  80149c:	0f 34                	sysenter
+  80149e:	5d                   	pop    %ebp
+		goto out;
+  80149f:	eb dc                	jmp    80147d <sys_trace_ctl+0x24>
+
+008014a1 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	57                   	push   %edi
+  8014a5:	56                   	push   %esi
+  8014a6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014a7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ae:	74 1c                	je     8014cc <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c3:	89 f7                	mov    %esi,%edi
+  8014c5:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014c7:	5b                   	pop    %ebx
+  8014c8:	5e                   	pop    %esi
+  8014c9:	5f                   	pop    %edi
+  8014ca:	5d                   	pop    %ebp
+  8014cb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014df:	55                   	push   %ebp
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	8d 35 ea 14 80 00    	lea    0x8014ea,%esi
+  8014e8:	0f 34                	sysenter
+  8014ea:	5d                   	pop    %ebp
+		goto out;
+  8014eb:	eb da                	jmp    8014c7 <sys_trace_read+0x26>
+
+008014ed <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	57                   	push   %edi
+  8014f1:	56                   	push   %esi
+  8014f2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014f3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014fa:	74 1c                	je     801518 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8014fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801501:	b8 21 00 00 00       	mov    $0x21,%eax
+  801506:	8b 55 08             	mov    0x8(%ebp),%edx
+  801509:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80150f:	89 f7                	mov    %esi,%edi
+  801511:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801513:	5b                   	pop    %ebx
+  801514:	5e                   	pop    %esi
+  801515:	5f                   	pop    %edi
+  801516:	5d                   	pop    %ebp
+  801517:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801518:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151e:	b8 21 00 00 00       	mov    $0x21,%eax
+  801523:	bf 00 00 00 00       	mov    $0x0,%edi
+  801528:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152b:	55                   	push   %ebp
+  80152c:	89 e5                	mov    %esp,%ebp
+  80152e:	8d 35 36 15 80 00    	lea    0x801536,%esi
+  801534:	0f 34                	sysenter
+  801536:	5d                   	pop    %ebp
+		goto out;
+  801537:	eb da                	jmp    801513 <sys_meminfo+0x26>
+
+00801539 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801539:	55                   	push   %ebp
+  80153a:	89 e5                	mov    %esp,%ebp
+  80153c:	57                   	push   %edi
+  80153d:	56                   	push   %esi
+  80153e:	53                   	push   %ebx
+  80153f:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801542:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801546:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80154d:	74 1f                	je     80156e <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80154f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801554:	b8 22 00 00 00       	mov    $0x22,%eax
+  801559:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155c:	89 df                	mov    %ebx,%edi
+  80155e:	89 de                	mov    %ebx,%esi
+  801560:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801562:	85 c0                	test   %eax,%eax
+  801564:	7f 25                	jg     80158b <sys_env_set_ksm+0x52>
+}
+  801566:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801569:	5b                   	pop    %ebx
+  80156a:	5e                   	pop    %esi
+  80156b:	5f                   	pop    %edi
+  80156c:	5d                   	pop    %ebp
+  80156d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80156e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801573:	8b 55 08             	mov    0x8(%ebp),%edx
+  801576:	b8 22 00 00 00       	mov    $0x22,%eax
+  80157b:	89 df                	mov    %ebx,%edi
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	8d 35 88 15 80 00    	lea    0x801588,%esi
+  801586:	0f 34                	sysenter
+  801588:	5d                   	pop    %ebp
+		goto out;
+  801589:	eb d7                	jmp    801562 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80158b:	83 ec 0c             	sub    $0xc,%esp
+  80158e:	50                   	push   %eax
+  80158f:	6a 22                	push   $0x22
+  801591:	68 cb 2e 80 00       	push   $0x802ecb
+  801596:	6a 3f                	push   $0x3f
+  801598:	68 e8 2e 80 00       	push   $0x802ee8
+  80159d:	e8 6c eb ff ff       	call   80010e <_panic>
+
+008015a2 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	57                   	push   %edi
+  8015a6:	56                   	push   %esi
+  8015a7:	53                   	push   %ebx
+  8015a8:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015ab:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015ae:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015b5:	74 24                	je     8015db <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015bc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015c1:	89 cb                	mov    %ecx,%ebx
+  8015c3:	89 cf                	mov    %ecx,%edi
+  8015c5:	89 ce                	mov    %ecx,%esi
+  8015c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015c9:	85 c0                	test   %eax,%eax
+  8015cb:	7f 2a                	jg     8015f7 <sys_time_nsec+0x55>
+	return ns;
+}
+  8015cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015d0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d6:	5b                   	pop    %ebx
+  8015d7:	5e                   	pop    %esi
+  8015d8:	5f                   	pop    %edi
+  8015d9:	5d                   	pop    %ebp
+  8015da:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015e5:	89 cb                	mov    %ecx,%ebx
+  8015e7:	89 cf                	mov    %ecx,%edi
+  8015e9:	55                   	push   %ebp
+  8015ea:	89 e5                	mov    %esp,%ebp
+  8015ec:	8d 35 f4 15 80 00    	lea    0x8015f4,%esi
+  8015f2:	0f 34                	sysenter
+  8015f4:	5d                   	pop    %ebp
+		goto out;
+  8015f5:	eb d2                	jmp    8015c9 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015f7:	83 ec 0c             	sub    $0xc,%esp
+  8015fa:	50                   	push   %eax
+  8015fb:	6a 0f                	push   $0xf
+  8015fd:	68 cb 2e 80 00       	push   $0x802ecb
+  801602:	6a 3f                	push   $0x3f
+  801604:	68 e8 2e 80 00       	push   $0x802ee8
+  801609:	e8 00 eb ff ff       	call   80010e <_panic>
+
+0080160e <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80160e:	55                   	push   %ebp
+  80160f:	89 e5                	mov    %esp,%ebp
+  801611:	57                   	push   %edi
+  801612:	56                   	push   %esi
+  801613:	53                   	push   %ebx
+  801614:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801617:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80161e:	74 22                	je     801642 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801620:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801625:	b8 12 00 00 00       	mov    $0x12,%eax
+  80162a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801630:	89 df                	mov    %ebx,%edi
+  801632:	89 de                	mov    %ebx,%esi
+  801634:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801636:	85 c0                	test   %eax,%eax
+  801638:	7f 28                	jg     801662 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80163a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163d:	5b                   	pop    %ebx
+  80163e:	5e                   	pop    %esi
+  80163f:	5f                   	pop    %edi
+  801640:	5d                   	pop    %ebp
+  801641:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801642:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801647:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801652:	89 df                	mov    %ebx,%edi
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	8d 35 5f 16 80 00    	lea    0x80165f,%esi
+  80165d:	0f 34                	sysenter
+  80165f:	5d                   	pop    %ebp
+		goto out;
+  801660:	eb d4                	jmp    801636 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801662:	83 ec 0c             	sub    $0xc,%esp
+  801665:	50                   	push   %eax
+  801666:	6a 12                	push   $0x12
+  801668:	68 cb 2e 80 00       	push   $0x802ecb
+  80166d:	6a 3f                	push   $0x3f
+  80166f:	68 e8 2e 80 00       	push   $0x802ee8
+  801674:	e8 95 ea ff ff       	call   80010e <_panic>
+
+00801679 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	57                   	push   %edi
+  80167d:	56                   	push   %esi
+  80167e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80167f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801686:	74 1b                	je     8016a3 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801688:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801692:	8b 55 08             	mov    0x8(%ebp),%edx
+  801695:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801698:	89 df                	mov    %ebx,%edi
+  80169a:	89 de                	mov    %ebx,%esi
+  80169c:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80169e:	5b                   	pop    %ebx
+  80169f:	5e                   	pop    %esi
+  8016a0:	5f                   	pop    %edi
+  8016a1:	5d                   	pop    %ebp
+  8016a2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ae:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016b3:	89 df                	mov    %ebx,%edi
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	8d 35 c0 16 80 00    	lea    0x8016c0,%esi
+  8016be:	0f 34                	sysenter
+  8016c0:	5d                   	pop    %ebp
+		goto out;
+  8016c1:	eb db                	jmp    80169e <sys_e1000_receive+0x25>
+
+008016c3 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016c3:	55                   	push   %ebp
+  8016c4:	89 e5                	mov    %esp,%ebp
+  8016c6:	57                   	push   %edi
+  8016c7:	56                   	push   %esi
+  8016c8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016c9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016d0:	74 1b                	je     8016ed <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e2:	89 df                	mov    %ebx,%edi
+  8016e4:	89 de                	mov    %ebx,%esi
+  8016e6:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5f                   	pop    %edi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016fd:	89 df                	mov    %ebx,%edi
+  8016ff:	55                   	push   %ebp
+  801700:	89 e5                	mov    %esp,%ebp
+  801702:	8d 35 0a 17 80 00    	lea    0x80170a,%esi
+  801708:	0f 34                	sysenter
+  80170a:	5d                   	pop    %ebp
+		goto out;
+  80170b:	eb db                	jmp    8016e8 <sys_e1000_read_hwaddr+0x25>
+
+0080170d <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80170d:	55                   	push   %ebp
+  80170e:	89 e5                	mov    %esp,%ebp
+  801710:	57                   	push   %edi
+  801711:	56                   	push   %esi
+  801712:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801713:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80171a:	74 1a                	je     801736 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80171c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801721:	b8 15 00 00 00       	mov    $0x15,%eax
+  801726:	8b 55 08             	mov    0x8(%ebp),%edx
+  801729:	89 cb                	mov    %ecx,%ebx
+  80172b:	89 cf                	mov    %ecx,%edi
+  80172d:	89 ce                	mov    %ecx,%esi
+  80172f:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801731:	5b                   	pop    %ebx
+  801732:	5e                   	pop    %esi
+  801733:	5f                   	pop    %edi
+  801734:	5d                   	pop    %ebp
+  801735:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801736:	8b 55 08             	mov    0x8(%ebp),%edx
+  801739:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801743:	89 cb                	mov    %ecx,%ebx
+  801745:	89 cf                	mov    %ecx,%edi
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	8d 35 52 17 80 00    	lea    0x801752,%esi
+  801750:	0f 34                	sysenter
+  801752:	5d                   	pop    %ebp
+		goto out;
+  801753:	eb dc                	jmp    801731 <sys_sb16_read_version+0x24>
+
+00801755 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	57                   	push   %edi
+  801759:	56                   	push   %esi
+  80175a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80175b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801762:	74 1b                	je     80177f <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801764:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801769:	b8 16 00 00 00       	mov    $0x16,%eax
+  80176e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801771:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801774:	89 df                	mov    %ebx,%edi
+  801776:	89 de                	mov    %ebx,%esi
+  801778:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80177a:	5b                   	pop    %ebx
+  80177b:	5e                   	pop    %esi
+  80177c:	5f                   	pop    %edi
+  80177d:	5d                   	pop    %ebp
+  80177e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80177f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801784:	8b 55 08             	mov    0x8(%ebp),%edx
+  801787:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80178f:	89 df                	mov    %ebx,%edi
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	8d 35 9c 17 80 00    	lea    0x80179c,%esi
+  80179a:	0f 34                	sysenter
+  80179c:	5d                   	pop    %ebp
+		goto out;
+  80179d:	eb db                	jmp    80177a <sys_sb16_play+0x25>
+
+0080179f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80179f:	55                   	push   %ebp
+  8017a0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017aa:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017ad:	5d                   	pop    %ebp
+  8017ae:	c3                   	ret
+
+008017af <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017af:	55                   	push   %ebp
+  8017b0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017ba:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017bf:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017c4:	5d                   	pop    %ebp
+  8017c5:	c3                   	ret
+
+008017c6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017c6:	55                   	push   %ebp
+  8017c7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017c9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017ce:	eb 02                	jmp    8017d2 <fd_alloc+0xc>
+  8017d0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017d2:	89 c2                	mov    %eax,%edx
+  8017d4:	c1 ea 16             	shr    $0x16,%edx
+  8017d7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017de:	f6 c2 01             	test   $0x1,%dl
+  8017e1:	74 2b                	je     80180e <fd_alloc+0x48>
+  8017e3:	89 c2                	mov    %eax,%edx
+  8017e5:	c1 ea 0c             	shr    $0xc,%edx
+  8017e8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017ef:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017f5:	f6 c1 01             	test   $0x1,%cl
+  8017f8:	74 14                	je     80180e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017fa:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801800:	75 ce                	jne    8017d0 <fd_alloc+0xa>
+  801802:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801807:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80180c:	eb 05                	jmp    801813 <fd_alloc+0x4d>
+			return 0;
+  80180e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801813:	8b 55 08             	mov    0x8(%ebp),%edx
+  801816:	89 02                	mov    %eax,(%edx)
+}
+  801818:	89 c8                	mov    %ecx,%eax
+  80181a:	5d                   	pop    %ebp
+  80181b:	c3                   	ret
+
+0080181c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80181c:	55                   	push   %ebp
+  80181d:	89 e5                	mov    %esp,%ebp
+  80181f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801822:	83 f8 1f             	cmp    $0x1f,%eax
+  801825:	77 30                	ja     801857 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801827:	c1 e0 0c             	shl    $0xc,%eax
+  80182a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80182f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801835:	f6 c2 01             	test   $0x1,%dl
+  801838:	74 24                	je     80185e <fd_lookup+0x42>
+  80183a:	89 c2                	mov    %eax,%edx
+  80183c:	c1 ea 0c             	shr    $0xc,%edx
+  80183f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801846:	f6 c2 01             	test   $0x1,%dl
+  801849:	74 1a                	je     801865 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80184b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80184e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801850:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801855:	5d                   	pop    %ebp
+  801856:	c3                   	ret
+		return -E_INVAL;
+  801857:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185c:	eb f7                	jmp    801855 <fd_lookup+0x39>
+		return -E_INVAL;
+  80185e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801863:	eb f0                	jmp    801855 <fd_lookup+0x39>
+  801865:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80186a:	eb e9                	jmp    801855 <fd_lookup+0x39>
+
+0080186c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80186c:	55                   	push   %ebp
+  80186d:	89 e5                	mov    %esp,%ebp
+  80186f:	53                   	push   %ebx
+  801870:	83 ec 04             	sub    $0x4,%esp
+  801873:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187b:	eb 03                	jmp    801880 <dev_lookup+0x14>
+  80187d:	83 c0 01             	add    $0x1,%eax
+  801880:	8b 1c 85 74 2f 80 00 	mov    0x802f74(,%eax,4),%ebx
+  801887:	85 db                	test   %ebx,%ebx
+  801889:	74 0b                	je     801896 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80188b:	39 13                	cmp    %edx,(%ebx)
+  80188d:	75 ee                	jne    80187d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80188f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801894:	eb 2e                	jmp    8018c4 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801896:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801898:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80189d:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018a3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018a8:	76 24                	jbe    8018ce <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018aa:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018ad:	83 ec 04             	sub    $0x4,%esp
+  8018b0:	52                   	push   %edx
+  8018b1:	50                   	push   %eax
+  8018b2:	68 f8 2e 80 00       	push   $0x802ef8
+  8018b7:	e8 2d e9 ff ff       	call   8001e9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018c7:	89 1a                	mov    %ebx,(%edx)
+}
+  8018c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018cc:	c9                   	leave
+  8018cd:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018ce:	c1 e8 10             	shr    $0x10,%eax
+  8018d1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018d7:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018dd:	eb cb                	jmp    8018aa <dev_lookup+0x3e>
+
+008018df <fd_close>:
+{
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	57                   	push   %edi
+  8018e3:	56                   	push   %esi
+  8018e4:	53                   	push   %ebx
+  8018e5:	83 ec 24             	sub    $0x24,%esp
+  8018e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018eb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018ee:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018f1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018f2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018f8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018fb:	50                   	push   %eax
+  8018fc:	e8 1b ff ff ff       	call   80181c <fd_lookup>
+  801901:	89 c3                	mov    %eax,%ebx
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	78 05                	js     80190f <fd_close+0x30>
+	    || fd != fd2)
+  80190a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80190d:	74 16                	je     801925 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80190f:	89 f8                	mov    %edi,%eax
+  801911:	84 c0                	test   %al,%al
+  801913:	b8 00 00 00 00       	mov    $0x0,%eax
+  801918:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80191b:	89 d8                	mov    %ebx,%eax
+  80191d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801920:	5b                   	pop    %ebx
+  801921:	5e                   	pop    %esi
+  801922:	5f                   	pop    %edi
+  801923:	5d                   	pop    %ebp
+  801924:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801925:	83 ec 08             	sub    $0x8,%esp
+  801928:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80192b:	50                   	push   %eax
+  80192c:	ff 36                	push   (%esi)
+  80192e:	e8 39 ff ff ff       	call   80186c <dev_lookup>
+  801933:	89 c3                	mov    %eax,%ebx
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	85 c0                	test   %eax,%eax
+  80193a:	78 1a                	js     801956 <fd_close+0x77>
+		if (dev->dev_close)
+  80193c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80193f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801942:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801947:	85 c0                	test   %eax,%eax
+  801949:	74 0b                	je     801956 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80194b:	83 ec 0c             	sub    $0xc,%esp
+  80194e:	56                   	push   %esi
+  80194f:	ff d0                	call   *%eax
+  801951:	89 c3                	mov    %eax,%ebx
+  801953:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801956:	83 ec 08             	sub    $0x8,%esp
+  801959:	56                   	push   %esi
+  80195a:	6a 00                	push   $0x0
+  80195c:	e8 a3 f4 ff ff       	call   800e04 <sys_page_unmap>
+	return r;
+  801961:	83 c4 10             	add    $0x10,%esp
+  801964:	eb b5                	jmp    80191b <fd_close+0x3c>
+
+00801966 <close>:
+
+int
+close(int fdnum)
+{
+  801966:	55                   	push   %ebp
+  801967:	89 e5                	mov    %esp,%ebp
+  801969:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80196c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80196f:	50                   	push   %eax
+  801970:	ff 75 08             	push   0x8(%ebp)
+  801973:	e8 a4 fe ff ff       	call   80181c <fd_lookup>
+  801978:	83 c4 10             	add    $0x10,%esp
+  80197b:	85 c0                	test   %eax,%eax
+  80197d:	79 02                	jns    801981 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80197f:	c9                   	leave
+  801980:	c3                   	ret
+		return fd_close(fd, 1);
+  801981:	83 ec 08             	sub    $0x8,%esp
+  801984:	6a 01                	push   $0x1
+  801986:	ff 75 f4             	push   -0xc(%ebp)
+  801989:	e8 51 ff ff ff       	call   8018df <fd_close>
+  80198e:	83 c4 10             	add    $0x10,%esp
+  801991:	eb ec                	jmp    80197f <close+0x19>
+
+00801993 <close_all>:
+
+void
+close_all(void)
+{
+  801993:	55                   	push   %ebp
+  801994:	89 e5                	mov    %esp,%ebp
+  801996:	53                   	push   %ebx
+  801997:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80199a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80199f:	83 ec 0c             	sub    $0xc,%esp
+  8019a2:	53                   	push   %ebx
+  8019a3:	e8 be ff ff ff       	call   801966 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019a8:	83 c3 01             	add    $0x1,%ebx
+  8019ab:	83 c4 10             	add    $0x10,%esp
+  8019ae:	83 fb 20             	cmp    $0x20,%ebx
+  8019b1:	75 ec                	jne    80199f <close_all+0xc>
+}
+  8019b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b6:	c9                   	leave
+  8019b7:	c3                   	ret
+
+008019b8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019b8:	55                   	push   %ebp
+  8019b9:	89 e5                	mov    %esp,%ebp
+  8019bb:	57                   	push   %edi
+  8019bc:	56                   	push   %esi
+  8019bd:	53                   	push   %ebx
+  8019be:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019c1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019c4:	50                   	push   %eax
+  8019c5:	ff 75 08             	push   0x8(%ebp)
+  8019c8:	e8 4f fe ff ff       	call   80181c <fd_lookup>
+  8019cd:	89 c3                	mov    %eax,%ebx
+  8019cf:	83 c4 10             	add    $0x10,%esp
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	78 7f                	js     801a55 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019d6:	83 ec 0c             	sub    $0xc,%esp
+  8019d9:	ff 75 0c             	push   0xc(%ebp)
+  8019dc:	e8 85 ff ff ff       	call   801966 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019e4:	c1 e6 0c             	shl    $0xc,%esi
+  8019e7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019f0:	89 3c 24             	mov    %edi,(%esp)
+  8019f3:	e8 b7 fd ff ff       	call   8017af <fd2data>
+  8019f8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019fa:	89 34 24             	mov    %esi,(%esp)
+  8019fd:	e8 ad fd ff ff       	call   8017af <fd2data>
+  801a02:	83 c4 10             	add    $0x10,%esp
+  801a05:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a08:	89 d8                	mov    %ebx,%eax
+  801a0a:	c1 e8 16             	shr    $0x16,%eax
+  801a0d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a14:	a8 01                	test   $0x1,%al
+  801a16:	74 11                	je     801a29 <dup+0x71>
+  801a18:	89 d8                	mov    %ebx,%eax
+  801a1a:	c1 e8 0c             	shr    $0xc,%eax
+  801a1d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a24:	f6 c2 01             	test   $0x1,%dl
+  801a27:	75 36                	jne    801a5f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a29:	89 f8                	mov    %edi,%eax
+  801a2b:	c1 e8 0c             	shr    $0xc,%eax
+  801a2e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a35:	83 ec 0c             	sub    $0xc,%esp
+  801a38:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a3d:	50                   	push   %eax
+  801a3e:	56                   	push   %esi
+  801a3f:	6a 00                	push   $0x0
+  801a41:	57                   	push   %edi
+  801a42:	6a 00                	push   $0x0
+  801a44:	e8 4d f3 ff ff       	call   800d96 <sys_page_map>
+  801a49:	89 c3                	mov    %eax,%ebx
+  801a4b:	83 c4 20             	add    $0x20,%esp
+  801a4e:	85 c0                	test   %eax,%eax
+  801a50:	78 33                	js     801a85 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a55:	89 d8                	mov    %ebx,%eax
+  801a57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5a:	5b                   	pop    %ebx
+  801a5b:	5e                   	pop    %esi
+  801a5c:	5f                   	pop    %edi
+  801a5d:	5d                   	pop    %ebp
+  801a5e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a5f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a66:	83 ec 0c             	sub    $0xc,%esp
+  801a69:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a6e:	50                   	push   %eax
+  801a6f:	ff 75 d4             	push   -0x2c(%ebp)
+  801a72:	6a 00                	push   $0x0
+  801a74:	53                   	push   %ebx
+  801a75:	6a 00                	push   $0x0
+  801a77:	e8 1a f3 ff ff       	call   800d96 <sys_page_map>
+  801a7c:	89 c3                	mov    %eax,%ebx
+  801a7e:	83 c4 20             	add    $0x20,%esp
+  801a81:	85 c0                	test   %eax,%eax
+  801a83:	79 a4                	jns    801a29 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a85:	83 ec 08             	sub    $0x8,%esp
+  801a88:	56                   	push   %esi
+  801a89:	6a 00                	push   $0x0
+  801a8b:	e8 74 f3 ff ff       	call   800e04 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a90:	83 c4 08             	add    $0x8,%esp
+  801a93:	ff 75 d4             	push   -0x2c(%ebp)
+  801a96:	6a 00                	push   $0x0
+  801a98:	e8 67 f3 ff ff       	call   800e04 <sys_page_unmap>
+	return r;
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	eb b3                	jmp    801a55 <dup+0x9d>
+
+00801aa2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801aa2:	55                   	push   %ebp
+  801aa3:	89 e5                	mov    %esp,%ebp
+  801aa5:	56                   	push   %esi
+  801aa6:	53                   	push   %ebx
+  801aa7:	83 ec 18             	sub    $0x18,%esp
+  801aaa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ab0:	50                   	push   %eax
+  801ab1:	53                   	push   %ebx
+  801ab2:	e8 65 fd ff ff       	call   80181c <fd_lookup>
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 3c                	js     801afa <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801abe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ac1:	83 ec 08             	sub    $0x8,%esp
+  801ac4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac7:	50                   	push   %eax
+  801ac8:	ff 36                	push   (%esi)
+  801aca:	e8 9d fd ff ff       	call   80186c <dev_lookup>
+  801acf:	83 c4 10             	add    $0x10,%esp
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	78 24                	js     801afa <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ad6:	8b 46 08             	mov    0x8(%esi),%eax
+  801ad9:	83 e0 03             	and    $0x3,%eax
+  801adc:	83 f8 01             	cmp    $0x1,%eax
+  801adf:	74 20                	je     801b01 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ae1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae4:	8b 40 08             	mov    0x8(%eax),%eax
+  801ae7:	85 c0                	test   %eax,%eax
+  801ae9:	74 57                	je     801b42 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801aeb:	83 ec 04             	sub    $0x4,%esp
+  801aee:	ff 75 10             	push   0x10(%ebp)
+  801af1:	ff 75 0c             	push   0xc(%ebp)
+  801af4:	56                   	push   %esi
+  801af5:	ff d0                	call   *%eax
+  801af7:	83 c4 10             	add    $0x10,%esp
+}
+  801afa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afd:	5b                   	pop    %ebx
+  801afe:	5e                   	pop    %esi
+  801aff:	5d                   	pop    %ebp
+  801b00:	c3                   	ret
+  801b01:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b03:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b08:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b0e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b13:	76 1c                	jbe    801b31 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b15:	8b 42 48             	mov    0x48(%edx),%eax
+  801b18:	83 ec 04             	sub    $0x4,%esp
+  801b1b:	53                   	push   %ebx
+  801b1c:	50                   	push   %eax
+  801b1d:	68 39 2f 80 00       	push   $0x802f39
+  801b22:	e8 c2 e6 ff ff       	call   8001e9 <cprintf>
+		return -E_INVAL;
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2f:	eb c9                	jmp    801afa <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b31:	c1 e8 10             	shr    $0x10,%eax
+  801b34:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b3a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b40:	eb d3                	jmp    801b15 <read+0x73>
+		return -E_NOT_SUPP;
+  801b42:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b47:	eb b1                	jmp    801afa <read+0x58>
+
+00801b49 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	57                   	push   %edi
+  801b4d:	56                   	push   %esi
+  801b4e:	53                   	push   %ebx
+  801b4f:	83 ec 0c             	sub    $0xc,%esp
+  801b52:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b55:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b5d:	eb 02                	jmp    801b61 <readn+0x18>
+  801b5f:	01 c3                	add    %eax,%ebx
+  801b61:	39 f3                	cmp    %esi,%ebx
+  801b63:	73 21                	jae    801b86 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b65:	83 ec 04             	sub    $0x4,%esp
+  801b68:	89 f0                	mov    %esi,%eax
+  801b6a:	29 d8                	sub    %ebx,%eax
+  801b6c:	50                   	push   %eax
+  801b6d:	89 d8                	mov    %ebx,%eax
+  801b6f:	03 45 0c             	add    0xc(%ebp),%eax
+  801b72:	50                   	push   %eax
+  801b73:	57                   	push   %edi
+  801b74:	e8 29 ff ff ff       	call   801aa2 <read>
+		if (m < 0)
+  801b79:	83 c4 10             	add    $0x10,%esp
+  801b7c:	85 c0                	test   %eax,%eax
+  801b7e:	78 04                	js     801b84 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b80:	75 dd                	jne    801b5f <readn+0x16>
+  801b82:	eb 02                	jmp    801b86 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b84:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b86:	89 d8                	mov    %ebx,%eax
+  801b88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8b:	5b                   	pop    %ebx
+  801b8c:	5e                   	pop    %esi
+  801b8d:	5f                   	pop    %edi
+  801b8e:	5d                   	pop    %ebp
+  801b8f:	c3                   	ret
+
+00801b90 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b90:	55                   	push   %ebp
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	56                   	push   %esi
+  801b94:	53                   	push   %ebx
+  801b95:	83 ec 18             	sub    $0x18,%esp
+  801b98:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b9b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b9e:	50                   	push   %eax
+  801b9f:	53                   	push   %ebx
+  801ba0:	e8 77 fc ff ff       	call   80181c <fd_lookup>
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 37                	js     801be3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bac:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801baf:	83 ec 08             	sub    $0x8,%esp
+  801bb2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb5:	50                   	push   %eax
+  801bb6:	ff 36                	push   (%esi)
+  801bb8:	e8 af fc ff ff       	call   80186c <dev_lookup>
+  801bbd:	83 c4 10             	add    $0x10,%esp
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 1f                	js     801be3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bc4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bc8:	74 20                	je     801bea <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bcd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	74 57                	je     801c2b <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bd4:	83 ec 04             	sub    $0x4,%esp
+  801bd7:	ff 75 10             	push   0x10(%ebp)
+  801bda:	ff 75 0c             	push   0xc(%ebp)
+  801bdd:	56                   	push   %esi
+  801bde:	ff d0                	call   *%eax
+  801be0:	83 c4 10             	add    $0x10,%esp
+}
+  801be3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be6:	5b                   	pop    %ebx
+  801be7:	5e                   	pop    %esi
+  801be8:	5d                   	pop    %ebp
+  801be9:	c3                   	ret
+  801bea:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bec:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bf1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bf7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bfc:	76 1c                	jbe    801c1a <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bfe:	8b 42 48             	mov    0x48(%edx),%eax
+  801c01:	83 ec 04             	sub    $0x4,%esp
+  801c04:	53                   	push   %ebx
+  801c05:	50                   	push   %eax
+  801c06:	68 55 2f 80 00       	push   $0x802f55
+  801c0b:	e8 d9 e5 ff ff       	call   8001e9 <cprintf>
+		return -E_INVAL;
+  801c10:	83 c4 10             	add    $0x10,%esp
+  801c13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c18:	eb c9                	jmp    801be3 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c1a:	c1 e8 10             	shr    $0x10,%eax
+  801c1d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c23:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c29:	eb d3                	jmp    801bfe <write+0x6e>
+		return -E_NOT_SUPP;
+  801c2b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c30:	eb b1                	jmp    801be3 <write+0x53>
+
+00801c32 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c32:	55                   	push   %ebp
+  801c33:	89 e5                	mov    %esp,%ebp
+  801c35:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c38:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c3b:	50                   	push   %eax
+  801c3c:	ff 75 08             	push   0x8(%ebp)
+  801c3f:	e8 d8 fb ff ff       	call   80181c <fd_lookup>
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	85 c0                	test   %eax,%eax
+  801c49:	78 0e                	js     801c59 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c51:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c59:	c9                   	leave
+  801c5a:	c3                   	ret
+
+00801c5b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c5b:	55                   	push   %ebp
+  801c5c:	89 e5                	mov    %esp,%ebp
+  801c5e:	56                   	push   %esi
+  801c5f:	53                   	push   %ebx
+  801c60:	83 ec 18             	sub    $0x18,%esp
+  801c63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c66:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c69:	50                   	push   %eax
+  801c6a:	53                   	push   %ebx
+  801c6b:	e8 ac fb ff ff       	call   80181c <fd_lookup>
+  801c70:	83 c4 10             	add    $0x10,%esp
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	78 34                	js     801cab <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c77:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c7a:	83 ec 08             	sub    $0x8,%esp
+  801c7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c80:	50                   	push   %eax
+  801c81:	ff 36                	push   (%esi)
+  801c83:	e8 e4 fb ff ff       	call   80186c <dev_lookup>
+  801c88:	83 c4 10             	add    $0x10,%esp
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 1c                	js     801cab <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c8f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c93:	74 1d                	je     801cb2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c98:	8b 40 18             	mov    0x18(%eax),%eax
+  801c9b:	85 c0                	test   %eax,%eax
+  801c9d:	74 54                	je     801cf3 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c9f:	83 ec 08             	sub    $0x8,%esp
+  801ca2:	ff 75 0c             	push   0xc(%ebp)
+  801ca5:	56                   	push   %esi
+  801ca6:	ff d0                	call   *%eax
+  801ca8:	83 c4 10             	add    $0x10,%esp
+}
+  801cab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cae:	5b                   	pop    %ebx
+  801caf:	5e                   	pop    %esi
+  801cb0:	5d                   	pop    %ebp
+  801cb1:	c3                   	ret
+  801cb2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cb4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cb9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cbf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cc4:	76 1c                	jbe    801ce2 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cc6:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cc9:	83 ec 04             	sub    $0x4,%esp
+  801ccc:	53                   	push   %ebx
+  801ccd:	50                   	push   %eax
+  801cce:	68 18 2f 80 00       	push   $0x802f18
+  801cd3:	e8 11 e5 ff ff       	call   8001e9 <cprintf>
+		return -E_INVAL;
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce0:	eb c9                	jmp    801cab <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ce2:	c1 e8 10             	shr    $0x10,%eax
+  801ce5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ceb:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cf1:	eb d3                	jmp    801cc6 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801cf3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cf8:	eb b1                	jmp    801cab <ftruncate+0x50>
+
+00801cfa <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	56                   	push   %esi
+  801cfe:	53                   	push   %ebx
+  801cff:	83 ec 18             	sub    $0x18,%esp
+  801d02:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d05:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d08:	50                   	push   %eax
+  801d09:	ff 75 08             	push   0x8(%ebp)
+  801d0c:	e8 0b fb ff ff       	call   80181c <fd_lookup>
+  801d11:	83 c4 10             	add    $0x10,%esp
+  801d14:	85 c0                	test   %eax,%eax
+  801d16:	78 49                	js     801d61 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d18:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d1b:	83 ec 08             	sub    $0x8,%esp
+  801d1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d21:	50                   	push   %eax
+  801d22:	ff 36                	push   (%esi)
+  801d24:	e8 43 fb ff ff       	call   80186c <dev_lookup>
+  801d29:	83 c4 10             	add    $0x10,%esp
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 31                	js     801d61 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d33:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d37:	74 2f                	je     801d68 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d39:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d3c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d43:	00 00 00 
+	stat->st_isdir = 0;
+  801d46:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d4d:	00 00 00 
+	stat->st_dev = dev;
+  801d50:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d56:	83 ec 08             	sub    $0x8,%esp
+  801d59:	53                   	push   %ebx
+  801d5a:	56                   	push   %esi
+  801d5b:	ff 50 14             	call   *0x14(%eax)
+  801d5e:	83 c4 10             	add    $0x10,%esp
+}
+  801d61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d64:	5b                   	pop    %ebx
+  801d65:	5e                   	pop    %esi
+  801d66:	5d                   	pop    %ebp
+  801d67:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d68:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d6d:	eb f2                	jmp    801d61 <fstat+0x67>
+
+00801d6f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d6f:	55                   	push   %ebp
+  801d70:	89 e5                	mov    %esp,%ebp
+  801d72:	56                   	push   %esi
+  801d73:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d74:	83 ec 08             	sub    $0x8,%esp
+  801d77:	6a 00                	push   $0x0
+  801d79:	ff 75 08             	push   0x8(%ebp)
+  801d7c:	e8 e4 01 00 00       	call   801f65 <open>
+  801d81:	89 c3                	mov    %eax,%ebx
+  801d83:	83 c4 10             	add    $0x10,%esp
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	78 1b                	js     801da5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d8a:	83 ec 08             	sub    $0x8,%esp
+  801d8d:	ff 75 0c             	push   0xc(%ebp)
+  801d90:	50                   	push   %eax
+  801d91:	e8 64 ff ff ff       	call   801cfa <fstat>
+  801d96:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d98:	89 1c 24             	mov    %ebx,(%esp)
+  801d9b:	e8 c6 fb ff ff       	call   801966 <close>
+	return r;
+  801da0:	83 c4 10             	add    $0x10,%esp
+  801da3:	89 f3                	mov    %esi,%ebx
+}
+  801da5:	89 d8                	mov    %ebx,%eax
+  801da7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801daa:	5b                   	pop    %ebx
+  801dab:	5e                   	pop    %esi
+  801dac:	5d                   	pop    %ebp
+  801dad:	c3                   	ret
+
+00801dae <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	56                   	push   %esi
+  801db2:	53                   	push   %ebx
+  801db3:	89 c6                	mov    %eax,%esi
+  801db5:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801db7:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801dbe:	74 27                	je     801de7 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dc0:	6a 07                	push   $0x7
+  801dc2:	68 00 60 80 00       	push   $0x806000
+  801dc7:	56                   	push   %esi
+  801dc8:	ff 35 00 50 80 00    	push   0x805000
+  801dce:	e8 b2 0c 00 00       	call   802a85 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801dd3:	83 c4 0c             	add    $0xc,%esp
+  801dd6:	6a 00                	push   $0x0
+  801dd8:	53                   	push   %ebx
+  801dd9:	6a 00                	push   $0x0
+  801ddb:	e8 8d 0c 00 00       	call   802a6d <ipc_recv>
+}
+  801de0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de3:	5b                   	pop    %ebx
+  801de4:	5e                   	pop    %esi
+  801de5:	5d                   	pop    %ebp
+  801de6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801de7:	83 ec 0c             	sub    $0xc,%esp
+  801dea:	6a 01                	push   $0x1
+  801dec:	e8 e8 0c 00 00       	call   802ad9 <ipc_find_env>
+  801df1:	a3 00 50 80 00       	mov    %eax,0x805000
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	eb c5                	jmp    801dc0 <fsipc+0x12>
+
+00801dfb <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801dfb:	55                   	push   %ebp
+  801dfc:	89 e5                	mov    %esp,%ebp
+  801dfe:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e04:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e07:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e0f:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e14:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e19:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e1e:	e8 8b ff ff ff       	call   801dae <fsipc>
+}
+  801e23:	c9                   	leave
+  801e24:	c3                   	ret
+
+00801e25 <devfile_flush>:
+{
+  801e25:	55                   	push   %ebp
+  801e26:	89 e5                	mov    %esp,%ebp
+  801e28:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e31:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e40:	e8 69 ff ff ff       	call   801dae <fsipc>
+}
+  801e45:	c9                   	leave
+  801e46:	c3                   	ret
+
+00801e47 <devfile_stat>:
+{
+  801e47:	55                   	push   %ebp
+  801e48:	89 e5                	mov    %esp,%ebp
+  801e4a:	53                   	push   %ebx
+  801e4b:	83 ec 04             	sub    $0x4,%esp
+  801e4e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e51:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e54:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e57:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e61:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e66:	e8 43 ff ff ff       	call   801dae <fsipc>
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 2c                	js     801e9b <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e6f:	83 ec 08             	sub    $0x8,%esp
+  801e72:	68 00 60 80 00       	push   $0x806000
+  801e77:	53                   	push   %ebx
+  801e78:	e8 b4 e9 ff ff       	call   800831 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e7d:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e82:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e88:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e8d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e93:	83 c4 10             	add    $0x10,%esp
+  801e96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e9e:	c9                   	leave
+  801e9f:	c3                   	ret
+
+00801ea0 <devfile_write>:
+{
+  801ea0:	55                   	push   %ebp
+  801ea1:	89 e5                	mov    %esp,%ebp
+  801ea3:	83 ec 0c             	sub    $0xc,%esp
+  801ea6:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ea9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eac:	8b 52 0c             	mov    0xc(%edx),%edx
+  801eaf:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801eb5:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801eba:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ebf:	39 d0                	cmp    %edx,%eax
+  801ec1:	0f 47 c2             	cmova  %edx,%eax
+  801ec4:	50                   	push   %eax
+  801ec5:	ff 75 0c             	push   0xc(%ebp)
+  801ec8:	68 08 60 80 00       	push   $0x806008
+  801ecd:	e8 e5 ea ff ff       	call   8009b7 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801ed2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed7:	b8 04 00 00 00       	mov    $0x4,%eax
+  801edc:	e8 cd fe ff ff       	call   801dae <fsipc>
+}
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+
+00801ee3 <devfile_read>:
+{
+  801ee3:	55                   	push   %ebp
+  801ee4:	89 e5                	mov    %esp,%ebp
+  801ee6:	56                   	push   %esi
+  801ee7:	53                   	push   %ebx
+  801ee8:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801eeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eee:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ef6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801efc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f01:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f06:	e8 a3 fe ff ff       	call   801dae <fsipc>
+  801f0b:	89 c3                	mov    %eax,%ebx
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	78 1f                	js     801f30 <devfile_read+0x4d>
+	assert(r <= n);
+  801f11:	39 c6                	cmp    %eax,%esi
+  801f13:	72 24                	jb     801f39 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f15:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f1a:	7f 33                	jg     801f4f <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f1c:	83 ec 04             	sub    $0x4,%esp
+  801f1f:	50                   	push   %eax
+  801f20:	68 00 60 80 00       	push   $0x806000
+  801f25:	ff 75 0c             	push   0xc(%ebp)
+  801f28:	e8 8a ea ff ff       	call   8009b7 <memmove>
+	return r;
+  801f2d:	83 c4 10             	add    $0x10,%esp
+}
+  801f30:	89 d8                	mov    %ebx,%eax
+  801f32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f35:	5b                   	pop    %ebx
+  801f36:	5e                   	pop    %esi
+  801f37:	5d                   	pop    %ebp
+  801f38:	c3                   	ret
+	assert(r <= n);
+  801f39:	68 88 2f 80 00       	push   $0x802f88
+  801f3e:	68 8f 2f 80 00       	push   $0x802f8f
+  801f43:	6a 76                	push   $0x76
+  801f45:	68 a4 2f 80 00       	push   $0x802fa4
+  801f4a:	e8 bf e1 ff ff       	call   80010e <_panic>
+	assert(r <= PGSIZE);
+  801f4f:	68 af 2f 80 00       	push   $0x802faf
+  801f54:	68 8f 2f 80 00       	push   $0x802f8f
+  801f59:	6a 77                	push   $0x77
+  801f5b:	68 a4 2f 80 00       	push   $0x802fa4
+  801f60:	e8 a9 e1 ff ff       	call   80010e <_panic>
+
+00801f65 <open>:
+{
+  801f65:	55                   	push   %ebp
+  801f66:	89 e5                	mov    %esp,%ebp
+  801f68:	56                   	push   %esi
+  801f69:	53                   	push   %ebx
+  801f6a:	83 ec 1c             	sub    $0x1c,%esp
+  801f6d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f70:	56                   	push   %esi
+  801f71:	e8 80 e8 ff ff       	call   8007f6 <strlen>
+  801f76:	83 c4 10             	add    $0x10,%esp
+  801f79:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f7e:	7f 6c                	jg     801fec <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f80:	83 ec 0c             	sub    $0xc,%esp
+  801f83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f86:	50                   	push   %eax
+  801f87:	e8 3a f8 ff ff       	call   8017c6 <fd_alloc>
+  801f8c:	89 c3                	mov    %eax,%ebx
+  801f8e:	83 c4 10             	add    $0x10,%esp
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	78 3c                	js     801fd1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f95:	83 ec 08             	sub    $0x8,%esp
+  801f98:	56                   	push   %esi
+  801f99:	68 00 60 80 00       	push   $0x806000
+  801f9e:	e8 8e e8 ff ff       	call   800831 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801fa3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa6:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fab:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fae:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb3:	e8 f6 fd ff ff       	call   801dae <fsipc>
+  801fb8:	89 c3                	mov    %eax,%ebx
+  801fba:	83 c4 10             	add    $0x10,%esp
+  801fbd:	85 c0                	test   %eax,%eax
+  801fbf:	78 19                	js     801fda <open+0x75>
+	return fd2num(fd);
+  801fc1:	83 ec 0c             	sub    $0xc,%esp
+  801fc4:	ff 75 f4             	push   -0xc(%ebp)
+  801fc7:	e8 d3 f7 ff ff       	call   80179f <fd2num>
+  801fcc:	89 c3                	mov    %eax,%ebx
+  801fce:	83 c4 10             	add    $0x10,%esp
+}
+  801fd1:	89 d8                	mov    %ebx,%eax
+  801fd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd6:	5b                   	pop    %ebx
+  801fd7:	5e                   	pop    %esi
+  801fd8:	5d                   	pop    %ebp
+  801fd9:	c3                   	ret
+		fd_close(fd, 0);
+  801fda:	83 ec 08             	sub    $0x8,%esp
+  801fdd:	6a 00                	push   $0x0
+  801fdf:	ff 75 f4             	push   -0xc(%ebp)
+  801fe2:	e8 f8 f8 ff ff       	call   8018df <fd_close>
+		return r;
+  801fe7:	83 c4 10             	add    $0x10,%esp
+  801fea:	eb e5                	jmp    801fd1 <open+0x6c>
+		return -E_BAD_PATH;
+  801fec:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ff1:	eb de                	jmp    801fd1 <open+0x6c>
+
+00801ff3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ff3:	55                   	push   %ebp
+  801ff4:	89 e5                	mov    %esp,%ebp
+  801ff6:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ff9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffe:	b8 08 00 00 00       	mov    $0x8,%eax
+  802003:	e8 a6 fd ff ff       	call   801dae <fsipc>
+}
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+
+0080200a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802010:	68 bb 2f 80 00       	push   $0x802fbb
+  802015:	ff 75 0c             	push   0xc(%ebp)
+  802018:	e8 14 e8 ff ff       	call   800831 <strcpy>
+	return 0;
+}
+  80201d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802022:	c9                   	leave
+  802023:	c3                   	ret
+
+00802024 <devsock_close>:
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	53                   	push   %ebx
+  802028:	83 ec 10             	sub    $0x10,%esp
+  80202b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80202e:	53                   	push   %ebx
+  80202f:	e8 e4 0a 00 00       	call   802b18 <pageref>
+  802034:	89 c2                	mov    %eax,%edx
+  802036:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802039:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80203e:	83 fa 01             	cmp    $0x1,%edx
+  802041:	74 05                	je     802048 <devsock_close+0x24>
+}
+  802043:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802046:	c9                   	leave
+  802047:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802048:	83 ec 0c             	sub    $0xc,%esp
+  80204b:	ff 73 0c             	push   0xc(%ebx)
+  80204e:	e8 b7 02 00 00       	call   80230a <nsipc_close>
+  802053:	83 c4 10             	add    $0x10,%esp
+  802056:	eb eb                	jmp    802043 <devsock_close+0x1f>
+
+00802058 <devsock_write>:
+{
+  802058:	55                   	push   %ebp
+  802059:	89 e5                	mov    %esp,%ebp
+  80205b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80205e:	6a 00                	push   $0x0
+  802060:	ff 75 10             	push   0x10(%ebp)
+  802063:	ff 75 0c             	push   0xc(%ebp)
+  802066:	8b 45 08             	mov    0x8(%ebp),%eax
+  802069:	ff 70 0c             	push   0xc(%eax)
+  80206c:	e8 79 03 00 00       	call   8023ea <nsipc_send>
+}
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+
+00802073 <devsock_read>:
+{
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  802076:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802079:	6a 00                	push   $0x0
+  80207b:	ff 75 10             	push   0x10(%ebp)
+  80207e:	ff 75 0c             	push   0xc(%ebp)
+  802081:	8b 45 08             	mov    0x8(%ebp),%eax
+  802084:	ff 70 0c             	push   0xc(%eax)
+  802087:	e8 ef 02 00 00       	call   80237b <nsipc_recv>
+}
+  80208c:	c9                   	leave
+  80208d:	c3                   	ret
+
+0080208e <fd2sockid>:
+{
+  80208e:	55                   	push   %ebp
+  80208f:	89 e5                	mov    %esp,%ebp
+  802091:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802094:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802097:	52                   	push   %edx
+  802098:	50                   	push   %eax
+  802099:	e8 7e f7 ff ff       	call   80181c <fd_lookup>
+  80209e:	83 c4 10             	add    $0x10,%esp
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	78 10                	js     8020b5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a8:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8020ae:	39 08                	cmp    %ecx,(%eax)
+  8020b0:	75 05                	jne    8020b7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020b2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020b5:	c9                   	leave
+  8020b6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020bc:	eb f7                	jmp    8020b5 <fd2sockid+0x27>
+
+008020be <alloc_sockfd>:
+{
+  8020be:	55                   	push   %ebp
+  8020bf:	89 e5                	mov    %esp,%ebp
+  8020c1:	56                   	push   %esi
+  8020c2:	53                   	push   %ebx
+  8020c3:	83 ec 1c             	sub    $0x1c,%esp
+  8020c6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020cb:	50                   	push   %eax
+  8020cc:	e8 f5 f6 ff ff       	call   8017c6 <fd_alloc>
+  8020d1:	89 c3                	mov    %eax,%ebx
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	85 c0                	test   %eax,%eax
+  8020d8:	78 43                	js     80211d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020da:	83 ec 04             	sub    $0x4,%esp
+  8020dd:	68 07 04 00 00       	push   $0x407
+  8020e2:	ff 75 f4             	push   -0xc(%ebp)
+  8020e5:	6a 00                	push   $0x0
+  8020e7:	e8 3d ec ff ff       	call   800d29 <sys_page_alloc>
+  8020ec:	89 c3                	mov    %eax,%ebx
+  8020ee:	83 c4 10             	add    $0x10,%esp
+  8020f1:	85 c0                	test   %eax,%eax
+  8020f3:	78 28                	js     80211d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f8:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8020fe:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802100:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802103:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80210a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80210d:	83 ec 0c             	sub    $0xc,%esp
+  802110:	50                   	push   %eax
+  802111:	e8 89 f6 ff ff       	call   80179f <fd2num>
+  802116:	89 c3                	mov    %eax,%ebx
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	eb 0c                	jmp    802129 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80211d:	83 ec 0c             	sub    $0xc,%esp
+  802120:	56                   	push   %esi
+  802121:	e8 e4 01 00 00       	call   80230a <nsipc_close>
+		return r;
+  802126:	83 c4 10             	add    $0x10,%esp
+}
+  802129:	89 d8                	mov    %ebx,%eax
+  80212b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80212e:	5b                   	pop    %ebx
+  80212f:	5e                   	pop    %esi
+  802130:	5d                   	pop    %ebp
+  802131:	c3                   	ret
+
+00802132 <accept>:
+{
+  802132:	55                   	push   %ebp
+  802133:	89 e5                	mov    %esp,%ebp
+  802135:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802138:	8b 45 08             	mov    0x8(%ebp),%eax
+  80213b:	e8 4e ff ff ff       	call   80208e <fd2sockid>
+  802140:	85 c0                	test   %eax,%eax
+  802142:	78 1b                	js     80215f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802144:	83 ec 04             	sub    $0x4,%esp
+  802147:	ff 75 10             	push   0x10(%ebp)
+  80214a:	ff 75 0c             	push   0xc(%ebp)
+  80214d:	50                   	push   %eax
+  80214e:	e8 0e 01 00 00       	call   802261 <nsipc_accept>
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	85 c0                	test   %eax,%eax
+  802158:	78 05                	js     80215f <accept+0x2d>
+	return alloc_sockfd(r);
+  80215a:	e8 5f ff ff ff       	call   8020be <alloc_sockfd>
+}
+  80215f:	c9                   	leave
+  802160:	c3                   	ret
+
+00802161 <bind>:
+{
+  802161:	55                   	push   %ebp
+  802162:	89 e5                	mov    %esp,%ebp
+  802164:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216a:	e8 1f ff ff ff       	call   80208e <fd2sockid>
+  80216f:	85 c0                	test   %eax,%eax
+  802171:	78 12                	js     802185 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802173:	83 ec 04             	sub    $0x4,%esp
+  802176:	ff 75 10             	push   0x10(%ebp)
+  802179:	ff 75 0c             	push   0xc(%ebp)
+  80217c:	50                   	push   %eax
+  80217d:	e8 31 01 00 00       	call   8022b3 <nsipc_bind>
+  802182:	83 c4 10             	add    $0x10,%esp
+}
+  802185:	c9                   	leave
+  802186:	c3                   	ret
+
+00802187 <shutdown>:
+{
+  802187:	55                   	push   %ebp
+  802188:	89 e5                	mov    %esp,%ebp
+  80218a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80218d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802190:	e8 f9 fe ff ff       	call   80208e <fd2sockid>
+  802195:	85 c0                	test   %eax,%eax
+  802197:	78 0f                	js     8021a8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802199:	83 ec 08             	sub    $0x8,%esp
+  80219c:	ff 75 0c             	push   0xc(%ebp)
+  80219f:	50                   	push   %eax
+  8021a0:	e8 43 01 00 00       	call   8022e8 <nsipc_shutdown>
+  8021a5:	83 c4 10             	add    $0x10,%esp
+}
+  8021a8:	c9                   	leave
+  8021a9:	c3                   	ret
+
+008021aa <connect>:
+{
+  8021aa:	55                   	push   %ebp
+  8021ab:	89 e5                	mov    %esp,%ebp
+  8021ad:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b3:	e8 d6 fe ff ff       	call   80208e <fd2sockid>
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	78 12                	js     8021ce <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021bc:	83 ec 04             	sub    $0x4,%esp
+  8021bf:	ff 75 10             	push   0x10(%ebp)
+  8021c2:	ff 75 0c             	push   0xc(%ebp)
+  8021c5:	50                   	push   %eax
+  8021c6:	e8 59 01 00 00       	call   802324 <nsipc_connect>
+  8021cb:	83 c4 10             	add    $0x10,%esp
+}
+  8021ce:	c9                   	leave
+  8021cf:	c3                   	ret
+
+008021d0 <listen>:
+{
+  8021d0:	55                   	push   %ebp
+  8021d1:	89 e5                	mov    %esp,%ebp
+  8021d3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d9:	e8 b0 fe ff ff       	call   80208e <fd2sockid>
+  8021de:	85 c0                	test   %eax,%eax
+  8021e0:	78 0f                	js     8021f1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021e2:	83 ec 08             	sub    $0x8,%esp
+  8021e5:	ff 75 0c             	push   0xc(%ebp)
+  8021e8:	50                   	push   %eax
+  8021e9:	e8 6b 01 00 00       	call   802359 <nsipc_listen>
+  8021ee:	83 c4 10             	add    $0x10,%esp
+}
+  8021f1:	c9                   	leave
+  8021f2:	c3                   	ret
+
+008021f3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021f9:	ff 75 10             	push   0x10(%ebp)
+  8021fc:	ff 75 0c             	push   0xc(%ebp)
+  8021ff:	ff 75 08             	push   0x8(%ebp)
+  802202:	e8 41 02 00 00       	call   802448 <nsipc_socket>
+  802207:	83 c4 10             	add    $0x10,%esp
+  80220a:	85 c0                	test   %eax,%eax
+  80220c:	78 05                	js     802213 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80220e:	e8 ab fe ff ff       	call   8020be <alloc_sockfd>
+}
+  802213:	c9                   	leave
+  802214:	c3                   	ret
+
+00802215 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802215:	55                   	push   %ebp
+  802216:	89 e5                	mov    %esp,%ebp
+  802218:	53                   	push   %ebx
+  802219:	83 ec 04             	sub    $0x4,%esp
+  80221c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80221e:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802225:	74 26                	je     80224d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802227:	6a 07                	push   $0x7
+  802229:	68 00 70 80 00       	push   $0x807000
+  80222e:	53                   	push   %ebx
+  80222f:	ff 35 04 50 80 00    	push   0x805004
+  802235:	e8 4b 08 00 00       	call   802a85 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80223a:	83 c4 0c             	add    $0xc,%esp
+  80223d:	6a 00                	push   $0x0
+  80223f:	6a 00                	push   $0x0
+  802241:	6a 00                	push   $0x0
+  802243:	e8 25 08 00 00       	call   802a6d <ipc_recv>
+}
+  802248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80224b:	c9                   	leave
+  80224c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80224d:	83 ec 0c             	sub    $0xc,%esp
+  802250:	6a 02                	push   $0x2
+  802252:	e8 82 08 00 00       	call   802ad9 <ipc_find_env>
+  802257:	a3 04 50 80 00       	mov    %eax,0x805004
+  80225c:	83 c4 10             	add    $0x10,%esp
+  80225f:	eb c6                	jmp    802227 <nsipc+0x12>
+
+00802261 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802261:	55                   	push   %ebp
+  802262:	89 e5                	mov    %esp,%ebp
+  802264:	56                   	push   %esi
+  802265:	53                   	push   %ebx
+  802266:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802269:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802271:	8b 06                	mov    (%esi),%eax
+  802273:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802278:	b8 01 00 00 00       	mov    $0x1,%eax
+  80227d:	e8 93 ff ff ff       	call   802215 <nsipc>
+  802282:	89 c3                	mov    %eax,%ebx
+  802284:	85 c0                	test   %eax,%eax
+  802286:	79 09                	jns    802291 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802288:	89 d8                	mov    %ebx,%eax
+  80228a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80228d:	5b                   	pop    %ebx
+  80228e:	5e                   	pop    %esi
+  80228f:	5d                   	pop    %ebp
+  802290:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802291:	83 ec 04             	sub    $0x4,%esp
+  802294:	ff 35 10 70 80 00    	push   0x807010
+  80229a:	68 00 70 80 00       	push   $0x807000
+  80229f:	ff 75 0c             	push   0xc(%ebp)
+  8022a2:	e8 10 e7 ff ff       	call   8009b7 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022a7:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022ac:	89 06                	mov    %eax,(%esi)
+  8022ae:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022b1:	eb d5                	jmp    802288 <nsipc_accept+0x27>
+
+008022b3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022b3:	55                   	push   %ebp
+  8022b4:	89 e5                	mov    %esp,%ebp
+  8022b6:	53                   	push   %ebx
+  8022b7:	83 ec 08             	sub    $0x8,%esp
+  8022ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c0:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022c5:	53                   	push   %ebx
+  8022c6:	ff 75 0c             	push   0xc(%ebp)
+  8022c9:	68 04 70 80 00       	push   $0x807004
+  8022ce:	e8 e4 e6 ff ff       	call   8009b7 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022d3:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022d9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022de:	e8 32 ff ff ff       	call   802215 <nsipc>
+}
+  8022e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e6:	c9                   	leave
+  8022e7:	c3                   	ret
+
+008022e8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022e8:	55                   	push   %ebp
+  8022e9:	89 e5                	mov    %esp,%ebp
+  8022eb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8022f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022f9:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8022fe:	b8 03 00 00 00       	mov    $0x3,%eax
+  802303:	e8 0d ff ff ff       	call   802215 <nsipc>
+}
+  802308:	c9                   	leave
+  802309:	c3                   	ret
+
+0080230a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80230a:	55                   	push   %ebp
+  80230b:	89 e5                	mov    %esp,%ebp
+  80230d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802310:	8b 45 08             	mov    0x8(%ebp),%eax
+  802313:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802318:	b8 04 00 00 00       	mov    $0x4,%eax
+  80231d:	e8 f3 fe ff ff       	call   802215 <nsipc>
+}
+  802322:	c9                   	leave
+  802323:	c3                   	ret
+
+00802324 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	53                   	push   %ebx
+  802328:	83 ec 08             	sub    $0x8,%esp
+  80232b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80232e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802331:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802336:	53                   	push   %ebx
+  802337:	ff 75 0c             	push   0xc(%ebp)
+  80233a:	68 04 70 80 00       	push   $0x807004
+  80233f:	e8 73 e6 ff ff       	call   8009b7 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802344:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80234a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80234f:	e8 c1 fe ff ff       	call   802215 <nsipc>
+}
+  802354:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802357:	c9                   	leave
+  802358:	c3                   	ret
+
+00802359 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80235f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802362:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802367:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80236a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80236f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802374:	e8 9c fe ff ff       	call   802215 <nsipc>
+}
+  802379:	c9                   	leave
+  80237a:	c3                   	ret
+
+0080237b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	56                   	push   %esi
+  80237f:	53                   	push   %ebx
+  802380:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802383:	8b 45 08             	mov    0x8(%ebp),%eax
+  802386:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80238b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802391:	8b 45 14             	mov    0x14(%ebp),%eax
+  802394:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802399:	b8 07 00 00 00       	mov    $0x7,%eax
+  80239e:	e8 72 fe ff ff       	call   802215 <nsipc>
+  8023a3:	89 c3                	mov    %eax,%ebx
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	78 22                	js     8023cb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023a9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023ae:	39 c6                	cmp    %eax,%esi
+  8023b0:	0f 4e c6             	cmovle %esi,%eax
+  8023b3:	39 c3                	cmp    %eax,%ebx
+  8023b5:	7f 1d                	jg     8023d4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023b7:	83 ec 04             	sub    $0x4,%esp
+  8023ba:	53                   	push   %ebx
+  8023bb:	68 00 70 80 00       	push   $0x807000
+  8023c0:	ff 75 0c             	push   0xc(%ebp)
+  8023c3:	e8 ef e5 ff ff       	call   8009b7 <memmove>
+  8023c8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023cb:	89 d8                	mov    %ebx,%eax
+  8023cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d0:	5b                   	pop    %ebx
+  8023d1:	5e                   	pop    %esi
+  8023d2:	5d                   	pop    %ebp
+  8023d3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023d4:	68 c7 2f 80 00       	push   $0x802fc7
+  8023d9:	68 8f 2f 80 00       	push   $0x802f8f
+  8023de:	6a 62                	push   $0x62
+  8023e0:	68 dc 2f 80 00       	push   $0x802fdc
+  8023e5:	e8 24 dd ff ff       	call   80010e <_panic>
+
+008023ea <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	53                   	push   %ebx
+  8023ee:	83 ec 04             	sub    $0x4,%esp
+  8023f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f7:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8023fc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802402:	7f 2e                	jg     802432 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802404:	83 ec 04             	sub    $0x4,%esp
+  802407:	53                   	push   %ebx
+  802408:	ff 75 0c             	push   0xc(%ebp)
+  80240b:	68 0c 70 80 00       	push   $0x80700c
+  802410:	e8 a2 e5 ff ff       	call   8009b7 <memmove>
+	nsipcbuf.send.req_size = size;
+  802415:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80241b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80241e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802423:	b8 08 00 00 00       	mov    $0x8,%eax
+  802428:	e8 e8 fd ff ff       	call   802215 <nsipc>
+}
+  80242d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802430:	c9                   	leave
+  802431:	c3                   	ret
+	assert(size < 1600);
+  802432:	68 e8 2f 80 00       	push   $0x802fe8
+  802437:	68 8f 2f 80 00       	push   $0x802f8f
+  80243c:	6a 6d                	push   $0x6d
+  80243e:	68 dc 2f 80 00       	push   $0x802fdc
+  802443:	e8 c6 dc ff ff       	call   80010e <_panic>
+
+00802448 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802448:	55                   	push   %ebp
+  802449:	89 e5                	mov    %esp,%ebp
+  80244b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80244e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802451:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802456:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802459:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80245e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802461:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802466:	b8 09 00 00 00       	mov    $0x9,%eax
+  80246b:	e8 a5 fd ff ff       	call   802215 <nsipc>
+}
+  802470:	c9                   	leave
+  802471:	c3                   	ret
+
+00802472 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802472:	55                   	push   %ebp
+  802473:	89 e5                	mov    %esp,%ebp
+  802475:	56                   	push   %esi
+  802476:	53                   	push   %ebx
+  802477:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80247a:	83 ec 0c             	sub    $0xc,%esp
+  80247d:	ff 75 08             	push   0x8(%ebp)
+  802480:	e8 2a f3 ff ff       	call   8017af <fd2data>
+  802485:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802487:	83 c4 08             	add    $0x8,%esp
+  80248a:	68 f4 2f 80 00       	push   $0x802ff4
+  80248f:	53                   	push   %ebx
+  802490:	e8 9c e3 ff ff       	call   800831 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802495:	8b 46 04             	mov    0x4(%esi),%eax
+  802498:	2b 06                	sub    (%esi),%eax
+  80249a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024a0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024a7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024aa:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024b1:	40 80 00 
+	return 0;
+}
+  8024b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024bc:	5b                   	pop    %ebx
+  8024bd:	5e                   	pop    %esi
+  8024be:	5d                   	pop    %ebp
+  8024bf:	c3                   	ret
+
+008024c0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024c0:	55                   	push   %ebp
+  8024c1:	89 e5                	mov    %esp,%ebp
+  8024c3:	53                   	push   %ebx
+  8024c4:	83 ec 0c             	sub    $0xc,%esp
+  8024c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024ca:	53                   	push   %ebx
+  8024cb:	6a 00                	push   $0x0
+  8024cd:	e8 32 e9 ff ff       	call   800e04 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024d2:	89 1c 24             	mov    %ebx,(%esp)
+  8024d5:	e8 d5 f2 ff ff       	call   8017af <fd2data>
+  8024da:	83 c4 08             	add    $0x8,%esp
+  8024dd:	50                   	push   %eax
+  8024de:	6a 00                	push   $0x0
+  8024e0:	e8 1f e9 ff ff       	call   800e04 <sys_page_unmap>
+}
+  8024e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e8:	c9                   	leave
+  8024e9:	c3                   	ret
+
+008024ea <_pipeisclosed>:
+{
+  8024ea:	55                   	push   %ebp
+  8024eb:	89 e5                	mov    %esp,%ebp
+  8024ed:	57                   	push   %edi
+  8024ee:	56                   	push   %esi
+  8024ef:	53                   	push   %ebx
+  8024f0:	83 ec 1c             	sub    $0x1c,%esp
+  8024f3:	89 c7                	mov    %eax,%edi
+  8024f5:	89 d6                	mov    %edx,%esi
+  8024f7:	eb 3c                	jmp    802535 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8024f9:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8024fc:	83 ec 0c             	sub    $0xc,%esp
+  8024ff:	57                   	push   %edi
+  802500:	e8 13 06 00 00       	call   802b18 <pageref>
+  802505:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802508:	89 34 24             	mov    %esi,(%esp)
+  80250b:	e8 08 06 00 00       	call   802b18 <pageref>
+  802510:	89 c2                	mov    %eax,%edx
+  802512:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802514:	05 00 00 00 20       	add    $0x20000000,%eax
+  802519:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80251c:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802522:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802527:	76 31                	jbe    80255a <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802529:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80252c:	39 c3                	cmp    %eax,%ebx
+  80252e:	74 76                	je     8025a6 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802530:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802533:	74 36                	je     80256b <_pipeisclosed+0x81>
+  802535:	89 e0                	mov    %esp,%eax
+  802537:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80253c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802542:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802547:	77 b0                	ja     8024f9 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802549:	c1 e8 10             	shr    $0x10,%eax
+  80254c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802552:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802558:	eb 9f                	jmp    8024f9 <_pipeisclosed+0xf>
+  80255a:	c1 e8 10             	shr    $0x10,%eax
+  80255d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802563:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802569:	eb be                	jmp    802529 <_pipeisclosed+0x3f>
+  80256b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80256d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802572:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802578:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80257d:	76 16                	jbe    802595 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80257f:	8b 42 58             	mov    0x58(%edx),%eax
+  802582:	6a 01                	push   $0x1
+  802584:	50                   	push   %eax
+  802585:	53                   	push   %ebx
+  802586:	68 fb 2f 80 00       	push   $0x802ffb
+  80258b:	e8 59 dc ff ff       	call   8001e9 <cprintf>
+  802590:	83 c4 10             	add    $0x10,%esp
+  802593:	eb a0                	jmp    802535 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802595:	c1 e8 10             	shr    $0x10,%eax
+  802598:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80259e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025a4:	eb d9                	jmp    80257f <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8025a6:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025a9:	0f 94 c0             	sete   %al
+  8025ac:	0f b6 c0             	movzbl %al,%eax
+}
+  8025af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b2:	5b                   	pop    %ebx
+  8025b3:	5e                   	pop    %esi
+  8025b4:	5f                   	pop    %edi
+  8025b5:	5d                   	pop    %ebp
+  8025b6:	c3                   	ret
+
+008025b7 <devpipe_write>:
+{
+  8025b7:	55                   	push   %ebp
+  8025b8:	89 e5                	mov    %esp,%ebp
+  8025ba:	57                   	push   %edi
+  8025bb:	56                   	push   %esi
+  8025bc:	53                   	push   %ebx
+  8025bd:	83 ec 28             	sub    $0x28,%esp
+  8025c0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025c3:	56                   	push   %esi
+  8025c4:	e8 e6 f1 ff ff       	call   8017af <fd2data>
+  8025c9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025cb:	83 c4 10             	add    $0x10,%esp
+  8025ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025d6:	75 09                	jne    8025e1 <devpipe_write+0x2a>
+	return i;
+  8025d8:	89 f8                	mov    %edi,%eax
+  8025da:	eb 23                	jmp    8025ff <devpipe_write+0x48>
+			sys_yield();
+  8025dc:	e8 02 e7 ff ff       	call   800ce3 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025e1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025e4:	8b 0b                	mov    (%ebx),%ecx
+  8025e6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025e9:	39 d0                	cmp    %edx,%eax
+  8025eb:	72 1a                	jb     802607 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025ed:	89 da                	mov    %ebx,%edx
+  8025ef:	89 f0                	mov    %esi,%eax
+  8025f1:	e8 f4 fe ff ff       	call   8024ea <_pipeisclosed>
+  8025f6:	85 c0                	test   %eax,%eax
+  8025f8:	74 e2                	je     8025dc <devpipe_write+0x25>
+				return 0;
+  8025fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802602:	5b                   	pop    %ebx
+  802603:	5e                   	pop    %esi
+  802604:	5f                   	pop    %edi
+  802605:	5d                   	pop    %ebp
+  802606:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802607:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80260a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80260e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802611:	89 c2                	mov    %eax,%edx
+  802613:	c1 fa 1f             	sar    $0x1f,%edx
+  802616:	89 d1                	mov    %edx,%ecx
+  802618:	c1 e9 1b             	shr    $0x1b,%ecx
+  80261b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80261e:	83 e2 1f             	and    $0x1f,%edx
+  802621:	29 ca                	sub    %ecx,%edx
+  802623:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802627:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80262b:	83 c0 01             	add    $0x1,%eax
+  80262e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802631:	83 c7 01             	add    $0x1,%edi
+  802634:	eb 9d                	jmp    8025d3 <devpipe_write+0x1c>
+
+00802636 <devpipe_read>:
+{
+  802636:	55                   	push   %ebp
+  802637:	89 e5                	mov    %esp,%ebp
+  802639:	57                   	push   %edi
+  80263a:	56                   	push   %esi
+  80263b:	53                   	push   %ebx
+  80263c:	83 ec 18             	sub    $0x18,%esp
+  80263f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802642:	57                   	push   %edi
+  802643:	e8 67 f1 ff ff       	call   8017af <fd2data>
+  802648:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80264a:	83 c4 10             	add    $0x10,%esp
+  80264d:	be 00 00 00 00       	mov    $0x0,%esi
+  802652:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802655:	75 13                	jne    80266a <devpipe_read+0x34>
+	return i;
+  802657:	89 f0                	mov    %esi,%eax
+  802659:	eb 02                	jmp    80265d <devpipe_read+0x27>
+				return i;
+  80265b:	89 f0                	mov    %esi,%eax
+}
+  80265d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802660:	5b                   	pop    %ebx
+  802661:	5e                   	pop    %esi
+  802662:	5f                   	pop    %edi
+  802663:	5d                   	pop    %ebp
+  802664:	c3                   	ret
+			sys_yield();
+  802665:	e8 79 e6 ff ff       	call   800ce3 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80266a:	8b 03                	mov    (%ebx),%eax
+  80266c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80266f:	75 18                	jne    802689 <devpipe_read+0x53>
+			if (i > 0)
+  802671:	85 f6                	test   %esi,%esi
+  802673:	75 e6                	jne    80265b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802675:	89 da                	mov    %ebx,%edx
+  802677:	89 f8                	mov    %edi,%eax
+  802679:	e8 6c fe ff ff       	call   8024ea <_pipeisclosed>
+  80267e:	85 c0                	test   %eax,%eax
+  802680:	74 e3                	je     802665 <devpipe_read+0x2f>
+				return 0;
+  802682:	b8 00 00 00 00       	mov    $0x0,%eax
+  802687:	eb d4                	jmp    80265d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802689:	99                   	cltd
+  80268a:	c1 ea 1b             	shr    $0x1b,%edx
+  80268d:	01 d0                	add    %edx,%eax
+  80268f:	83 e0 1f             	and    $0x1f,%eax
+  802692:	29 d0                	sub    %edx,%eax
+  802694:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802699:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80269c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80269f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026a2:	83 c6 01             	add    $0x1,%esi
+  8026a5:	eb ab                	jmp    802652 <devpipe_read+0x1c>
+
+008026a7 <pipe>:
+{
+  8026a7:	55                   	push   %ebp
+  8026a8:	89 e5                	mov    %esp,%ebp
+  8026aa:	56                   	push   %esi
+  8026ab:	53                   	push   %ebx
+  8026ac:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b2:	50                   	push   %eax
+  8026b3:	e8 0e f1 ff ff       	call   8017c6 <fd_alloc>
+  8026b8:	89 c3                	mov    %eax,%ebx
+  8026ba:	83 c4 10             	add    $0x10,%esp
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	0f 88 23 01 00 00    	js     8027e8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026c5:	83 ec 04             	sub    $0x4,%esp
+  8026c8:	68 07 04 00 00       	push   $0x407
+  8026cd:	ff 75 f4             	push   -0xc(%ebp)
+  8026d0:	6a 00                	push   $0x0
+  8026d2:	e8 52 e6 ff ff       	call   800d29 <sys_page_alloc>
+  8026d7:	89 c3                	mov    %eax,%ebx
+  8026d9:	83 c4 10             	add    $0x10,%esp
+  8026dc:	85 c0                	test   %eax,%eax
+  8026de:	0f 88 04 01 00 00    	js     8027e8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026e4:	83 ec 0c             	sub    $0xc,%esp
+  8026e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026ea:	50                   	push   %eax
+  8026eb:	e8 d6 f0 ff ff       	call   8017c6 <fd_alloc>
+  8026f0:	89 c3                	mov    %eax,%ebx
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  8026f5:	85 c0                	test   %eax,%eax
+  8026f7:	0f 88 db 00 00 00    	js     8027d8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026fd:	83 ec 04             	sub    $0x4,%esp
+  802700:	68 07 04 00 00       	push   $0x407
+  802705:	ff 75 f0             	push   -0x10(%ebp)
+  802708:	6a 00                	push   $0x0
+  80270a:	e8 1a e6 ff ff       	call   800d29 <sys_page_alloc>
+  80270f:	89 c3                	mov    %eax,%ebx
+  802711:	83 c4 10             	add    $0x10,%esp
+  802714:	85 c0                	test   %eax,%eax
+  802716:	0f 88 bc 00 00 00    	js     8027d8 <pipe+0x131>
+	va = fd2data(fd0);
+  80271c:	83 ec 0c             	sub    $0xc,%esp
+  80271f:	ff 75 f4             	push   -0xc(%ebp)
+  802722:	e8 88 f0 ff ff       	call   8017af <fd2data>
+  802727:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802729:	83 c4 0c             	add    $0xc,%esp
+  80272c:	68 07 04 00 00       	push   $0x407
+  802731:	50                   	push   %eax
+  802732:	6a 00                	push   $0x0
+  802734:	e8 f0 e5 ff ff       	call   800d29 <sys_page_alloc>
+  802739:	89 c3                	mov    %eax,%ebx
+  80273b:	83 c4 10             	add    $0x10,%esp
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	0f 88 82 00 00 00    	js     8027c8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802746:	83 ec 0c             	sub    $0xc,%esp
+  802749:	ff 75 f0             	push   -0x10(%ebp)
+  80274c:	e8 5e f0 ff ff       	call   8017af <fd2data>
+  802751:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802758:	50                   	push   %eax
+  802759:	6a 00                	push   $0x0
+  80275b:	56                   	push   %esi
+  80275c:	6a 00                	push   $0x0
+  80275e:	e8 33 e6 ff ff       	call   800d96 <sys_page_map>
+  802763:	89 c3                	mov    %eax,%ebx
+  802765:	83 c4 20             	add    $0x20,%esp
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	78 4e                	js     8027ba <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80276c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802771:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802774:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802776:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802779:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802780:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802783:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802785:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802788:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80278f:	83 ec 0c             	sub    $0xc,%esp
+  802792:	ff 75 f4             	push   -0xc(%ebp)
+  802795:	e8 05 f0 ff ff       	call   80179f <fd2num>
+  80279a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80279d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80279f:	83 c4 04             	add    $0x4,%esp
+  8027a2:	ff 75 f0             	push   -0x10(%ebp)
+  8027a5:	e8 f5 ef ff ff       	call   80179f <fd2num>
+  8027aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027ad:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027b0:	83 c4 10             	add    $0x10,%esp
+  8027b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b8:	eb 2e                	jmp    8027e8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027ba:	83 ec 08             	sub    $0x8,%esp
+  8027bd:	56                   	push   %esi
+  8027be:	6a 00                	push   $0x0
+  8027c0:	e8 3f e6 ff ff       	call   800e04 <sys_page_unmap>
+  8027c5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027c8:	83 ec 08             	sub    $0x8,%esp
+  8027cb:	ff 75 f0             	push   -0x10(%ebp)
+  8027ce:	6a 00                	push   $0x0
+  8027d0:	e8 2f e6 ff ff       	call   800e04 <sys_page_unmap>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027d8:	83 ec 08             	sub    $0x8,%esp
+  8027db:	ff 75 f4             	push   -0xc(%ebp)
+  8027de:	6a 00                	push   $0x0
+  8027e0:	e8 1f e6 ff ff       	call   800e04 <sys_page_unmap>
+  8027e5:	83 c4 10             	add    $0x10,%esp
+}
+  8027e8:	89 d8                	mov    %ebx,%eax
+  8027ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ed:	5b                   	pop    %ebx
+  8027ee:	5e                   	pop    %esi
+  8027ef:	5d                   	pop    %ebp
+  8027f0:	c3                   	ret
+
+008027f1 <pipeisclosed>:
+{
+  8027f1:	55                   	push   %ebp
+  8027f2:	89 e5                	mov    %esp,%ebp
+  8027f4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027fa:	50                   	push   %eax
+  8027fb:	ff 75 08             	push   0x8(%ebp)
+  8027fe:	e8 19 f0 ff ff       	call   80181c <fd_lookup>
+  802803:	83 c4 10             	add    $0x10,%esp
+  802806:	85 c0                	test   %eax,%eax
+  802808:	78 18                	js     802822 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80280a:	83 ec 0c             	sub    $0xc,%esp
+  80280d:	ff 75 f4             	push   -0xc(%ebp)
+  802810:	e8 9a ef ff ff       	call   8017af <fd2data>
+  802815:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802817:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281a:	e8 cb fc ff ff       	call   8024ea <_pipeisclosed>
+  80281f:	83 c4 10             	add    $0x10,%esp
+}
+  802822:	c9                   	leave
+  802823:	c3                   	ret
+
+00802824 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802824:	b8 00 00 00 00       	mov    $0x0,%eax
+  802829:	c3                   	ret
+
+0080282a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80282a:	55                   	push   %ebp
+  80282b:	89 e5                	mov    %esp,%ebp
+  80282d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802830:	68 13 30 80 00       	push   $0x803013
+  802835:	ff 75 0c             	push   0xc(%ebp)
+  802838:	e8 f4 df ff ff       	call   800831 <strcpy>
+	return 0;
+}
+  80283d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802842:	c9                   	leave
+  802843:	c3                   	ret
+
+00802844 <devcons_write>:
+{
+  802844:	55                   	push   %ebp
+  802845:	89 e5                	mov    %esp,%ebp
+  802847:	57                   	push   %edi
+  802848:	56                   	push   %esi
+  802849:	53                   	push   %ebx
+  80284a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802850:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802855:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80285b:	eb 2e                	jmp    80288b <devcons_write+0x47>
+		m = n - tot;
+  80285d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802860:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802862:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802867:	39 c3                	cmp    %eax,%ebx
+  802869:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80286c:	83 ec 04             	sub    $0x4,%esp
+  80286f:	53                   	push   %ebx
+  802870:	89 f0                	mov    %esi,%eax
+  802872:	03 45 0c             	add    0xc(%ebp),%eax
+  802875:	50                   	push   %eax
+  802876:	57                   	push   %edi
+  802877:	e8 3b e1 ff ff       	call   8009b7 <memmove>
+		sys_cputs(buf, m);
+  80287c:	83 c4 08             	add    $0x8,%esp
+  80287f:	53                   	push   %ebx
+  802880:	57                   	push   %edi
+  802881:	e8 24 e3 ff ff       	call   800baa <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802886:	01 de                	add    %ebx,%esi
+  802888:	83 c4 10             	add    $0x10,%esp
+  80288b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80288e:	72 cd                	jb     80285d <devcons_write+0x19>
+}
+  802890:	89 f0                	mov    %esi,%eax
+  802892:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802895:	5b                   	pop    %ebx
+  802896:	5e                   	pop    %esi
+  802897:	5f                   	pop    %edi
+  802898:	5d                   	pop    %ebp
+  802899:	c3                   	ret
+
+0080289a <devcons_read>:
+{
+  80289a:	55                   	push   %ebp
+  80289b:	89 e5                	mov    %esp,%ebp
+  80289d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8028a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028a9:	75 07                	jne    8028b2 <devcons_read+0x18>
+  8028ab:	eb 1f                	jmp    8028cc <devcons_read+0x32>
+		sys_yield();
+  8028ad:	e8 31 e4 ff ff       	call   800ce3 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028b2:	e8 37 e3 ff ff       	call   800bee <sys_cgetc>
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	74 f2                	je     8028ad <devcons_read+0x13>
+	if (c < 0)
+  8028bb:	78 0f                	js     8028cc <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028bd:	83 f8 04             	cmp    $0x4,%eax
+  8028c0:	74 0c                	je     8028ce <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028c5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028c7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028cc:	c9                   	leave
+  8028cd:	c3                   	ret
+		return 0;
+  8028ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d3:	eb f7                	jmp    8028cc <devcons_read+0x32>
+
+008028d5 <cputchar>:
+{
+  8028d5:	55                   	push   %ebp
+  8028d6:	89 e5                	mov    %esp,%ebp
+  8028d8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028de:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028e1:	6a 01                	push   $0x1
+  8028e3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028e6:	50                   	push   %eax
+  8028e7:	e8 be e2 ff ff       	call   800baa <sys_cputs>
+}
+  8028ec:	83 c4 10             	add    $0x10,%esp
+  8028ef:	c9                   	leave
+  8028f0:	c3                   	ret
+
+008028f1 <getchar>:
+{
+  8028f1:	55                   	push   %ebp
+  8028f2:	89 e5                	mov    %esp,%ebp
+  8028f4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028f7:	6a 01                	push   $0x1
+  8028f9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028fc:	50                   	push   %eax
+  8028fd:	6a 00                	push   $0x0
+  8028ff:	e8 9e f1 ff ff       	call   801aa2 <read>
+	if (r < 0)
+  802904:	83 c4 10             	add    $0x10,%esp
+  802907:	85 c0                	test   %eax,%eax
+  802909:	78 06                	js     802911 <getchar+0x20>
+	if (r < 1)
+  80290b:	74 06                	je     802913 <getchar+0x22>
+	return c;
+  80290d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802911:	c9                   	leave
+  802912:	c3                   	ret
+		return -E_EOF;
+  802913:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802918:	eb f7                	jmp    802911 <getchar+0x20>
+
+0080291a <iscons>:
+{
+  80291a:	55                   	push   %ebp
+  80291b:	89 e5                	mov    %esp,%ebp
+  80291d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802920:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802923:	50                   	push   %eax
+  802924:	ff 75 08             	push   0x8(%ebp)
+  802927:	e8 f0 ee ff ff       	call   80181c <fd_lookup>
+  80292c:	83 c4 10             	add    $0x10,%esp
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	78 11                	js     802944 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802933:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802936:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80293c:	39 10                	cmp    %edx,(%eax)
+  80293e:	0f 94 c0             	sete   %al
+  802941:	0f b6 c0             	movzbl %al,%eax
+}
+  802944:	c9                   	leave
+  802945:	c3                   	ret
+
+00802946 <opencons>:
+{
+  802946:	55                   	push   %ebp
+  802947:	89 e5                	mov    %esp,%ebp
+  802949:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80294c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80294f:	50                   	push   %eax
+  802950:	e8 71 ee ff ff       	call   8017c6 <fd_alloc>
+  802955:	83 c4 10             	add    $0x10,%esp
+  802958:	85 c0                	test   %eax,%eax
+  80295a:	78 3a                	js     802996 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80295c:	83 ec 04             	sub    $0x4,%esp
+  80295f:	68 07 04 00 00       	push   $0x407
+  802964:	ff 75 f4             	push   -0xc(%ebp)
+  802967:	6a 00                	push   $0x0
+  802969:	e8 bb e3 ff ff       	call   800d29 <sys_page_alloc>
+  80296e:	83 c4 10             	add    $0x10,%esp
+  802971:	85 c0                	test   %eax,%eax
+  802973:	78 21                	js     802996 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802975:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802978:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80297e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802980:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802983:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80298a:	83 ec 0c             	sub    $0xc,%esp
+  80298d:	50                   	push   %eax
+  80298e:	e8 0c ee ff ff       	call   80179f <fd2num>
+  802993:	83 c4 10             	add    $0x10,%esp
+}
+  802996:	c9                   	leave
+  802997:	c3                   	ret
+
+00802998 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802998:	55                   	push   %ebp
+  802999:	89 e5                	mov    %esp,%ebp
+  80299b:	56                   	push   %esi
+  80299c:	53                   	push   %ebx
+  80299d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8029a6:	85 c0                	test   %eax,%eax
+  8029a8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029ad:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8029b0:	83 ec 08             	sub    $0x8,%esp
+  8029b3:	ff 75 14             	push   0x14(%ebp)
+  8029b6:	50                   	push   %eax
+  8029b7:	e8 7e e7 ff ff       	call   80113a <sys_ipc_recv_until>
+  8029bc:	83 c4 10             	add    $0x10,%esp
+  8029bf:	85 c0                	test   %eax,%eax
+  8029c1:	78 61                	js     802a24 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029c3:	85 f6                	test   %esi,%esi
+  8029c5:	74 1c                	je     8029e3 <ipc_recv_until+0x4b>
+  8029c7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029c9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029ce:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029d4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029d9:	76 5f                	jbe    802a3a <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029db:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029e1:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029e3:	85 db                	test   %ebx,%ebx
+  8029e5:	74 1c                	je     802a03 <ipc_recv_until+0x6b>
+  8029e7:	89 e0                	mov    %esp,%eax
+  8029e9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029ee:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029f4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029f9:	76 50                	jbe    802a4b <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8029fb:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802a01:	89 03                	mov    %eax,(%ebx)
+  802a03:	89 e0                	mov    %esp,%eax
+  802a05:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a0a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a10:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a15:	76 45                	jbe    802a5c <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a17:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a20:	5b                   	pop    %ebx
+  802a21:	5e                   	pop    %esi
+  802a22:	5d                   	pop    %ebp
+  802a23:	c3                   	ret
+		if (from_env_store)
+  802a24:	85 f6                	test   %esi,%esi
+  802a26:	74 06                	je     802a2e <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a28:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a2e:	85 db                	test   %ebx,%ebx
+  802a30:	74 eb                	je     802a1d <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a32:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a38:	eb e3                	jmp    802a1d <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a3a:	c1 e8 10             	shr    $0x10,%eax
+  802a3d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a43:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a49:	eb 90                	jmp    8029db <ipc_recv_until+0x43>
+  802a4b:	c1 e8 10             	shr    $0x10,%eax
+  802a4e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a54:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a5a:	eb 9f                	jmp    8029fb <ipc_recv_until+0x63>
+  802a5c:	c1 e8 10             	shr    $0x10,%eax
+  802a5f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a65:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a6b:	eb aa                	jmp    802a17 <ipc_recv_until+0x7f>
+
+00802a6d <ipc_recv>:
+{
+  802a6d:	55                   	push   %ebp
+  802a6e:	89 e5                	mov    %esp,%ebp
+  802a70:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a73:	6a 00                	push   $0x0
+  802a75:	ff 75 10             	push   0x10(%ebp)
+  802a78:	ff 75 0c             	push   0xc(%ebp)
+  802a7b:	ff 75 08             	push   0x8(%ebp)
+  802a7e:	e8 15 ff ff ff       	call   802998 <ipc_recv_until>
+}
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+00802a85 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a85:	55                   	push   %ebp
+  802a86:	89 e5                	mov    %esp,%ebp
+  802a88:	57                   	push   %edi
+  802a89:	56                   	push   %esi
+  802a8a:	53                   	push   %ebx
+  802a8b:	83 ec 0c             	sub    $0xc,%esp
+  802a8e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a91:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a97:	85 db                	test   %ebx,%ebx
+  802a99:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a9e:	0f 44 d8             	cmove  %eax,%ebx
+  802aa1:	eb 05                	jmp    802aa8 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802aa3:	e8 3b e2 ff ff       	call   800ce3 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802aa8:	ff 75 14             	push   0x14(%ebp)
+  802aab:	53                   	push   %ebx
+  802aac:	56                   	push   %esi
+  802aad:	57                   	push   %edi
+  802aae:	e8 d3 e5 ff ff       	call   801086 <sys_ipc_try_send>
+  802ab3:	83 c4 10             	add    $0x10,%esp
+  802ab6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ab9:	74 e8                	je     802aa3 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802abb:	85 c0                	test   %eax,%eax
+  802abd:	78 08                	js     802ac7 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802abf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac2:	5b                   	pop    %ebx
+  802ac3:	5e                   	pop    %esi
+  802ac4:	5f                   	pop    %edi
+  802ac5:	5d                   	pop    %ebp
+  802ac6:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802ac7:	50                   	push   %eax
+  802ac8:	68 1f 30 80 00       	push   $0x80301f
+  802acd:	6a 4f                	push   $0x4f
+  802acf:	68 32 30 80 00       	push   $0x803032
+  802ad4:	e8 35 d6 ff ff       	call   80010e <_panic>
+
+00802ad9 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ad9:	55                   	push   %ebp
+  802ada:	89 e5                	mov    %esp,%ebp
+  802adc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802adf:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ae4:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802aea:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802af0:	8b 52 50             	mov    0x50(%edx),%edx
+  802af3:	39 ca                	cmp    %ecx,%edx
+  802af5:	74 11                	je     802b08 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802af7:	83 c0 01             	add    $0x1,%eax
+  802afa:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802aff:	75 e3                	jne    802ae4 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b06:	eb 0e                	jmp    802b16 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802b08:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b0e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b13:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b16:	5d                   	pop    %ebp
+  802b17:	c3                   	ret
+
+00802b18 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b18:	55                   	push   %ebp
+  802b19:	89 e5                	mov    %esp,%ebp
+  802b1b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b1e:	89 c2                	mov    %eax,%edx
+  802b20:	c1 ea 16             	shr    $0x16,%edx
+  802b23:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b2f:	f6 c1 01             	test   $0x1,%cl
+  802b32:	74 1a                	je     802b4e <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b34:	c1 e8 0c             	shr    $0xc,%eax
+  802b37:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b3e:	a8 01                	test   $0x1,%al
+  802b40:	74 0c                	je     802b4e <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b42:	c1 e8 0c             	shr    $0xc,%eax
+  802b45:	c1 e0 04             	shl    $0x4,%eax
+  802b48:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b4e:	89 d0                	mov    %edx,%eax
+  802b50:	5d                   	pop    %ebp
+  802b51:	c3                   	ret
@@ -0,0 +1,6218 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 91 00 00 00       	call   8000c2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+	envid_t who, id;
+
+	id = sys_getenvid();
+  80003b:	e8 d5 0c 00 00       	call   800d15 <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800042:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800044:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  800049:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80004f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800054:	76 35                	jbe    80008b <umain+0x58>
+
+	if (thisenv == &envs[1]) {
+  800056:	81 fa 58 01 c0 ee    	cmp    $0xeec00158,%edx
+  80005c:	74 3e                	je     80009c <umain+0x69>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+			cprintf("%x recv from %x\n", id, who);
+		}
+	} else {
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80005e:	a1 a0 01 c0 ee       	mov    0xeec001a0,%eax
+  800063:	83 ec 04             	sub    $0x4,%esp
+  800066:	50                   	push   %eax
+  800067:	53                   	push   %ebx
+  800068:	68 f1 2b 80 00       	push   $0x802bf1
+  80006d:	e8 ef 01 00 00       	call   800261 <cprintf>
+  800072:	83 c4 10             	add    $0x10,%esp
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  800075:	a1 a0 01 c0 ee       	mov    0xeec001a0,%eax
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	6a 00                	push   $0x0
+  800080:	50                   	push   %eax
+  800081:	e8 7e 18 00 00       	call   801904 <ipc_send>
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	eb ea                	jmp    800075 <umain+0x42>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80008b:	c1 e8 10             	shr    $0x10,%eax
+  80008e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800094:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80009a:	eb ba                	jmp    800056 <umain+0x23>
+			ipc_recv(&who, 0, 0);
+  80009c:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80009f:	83 ec 04             	sub    $0x4,%esp
+  8000a2:	6a 00                	push   $0x0
+  8000a4:	6a 00                	push   $0x0
+  8000a6:	56                   	push   %esi
+  8000a7:	e8 40 18 00 00       	call   8018ec <ipc_recv>
+			cprintf("%x recv from %x\n", id, who);
+  8000ac:	83 c4 0c             	add    $0xc,%esp
+  8000af:	ff 75 f4             	push   -0xc(%ebp)
+  8000b2:	53                   	push   %ebx
+  8000b3:	68 e0 2b 80 00       	push   $0x802be0
+  8000b8:	e8 a4 01 00 00       	call   800261 <cprintf>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	eb dd                	jmp    80009f <umain+0x6c>
+
+008000c2 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c2:	55                   	push   %ebp
+  8000c3:	89 e5                	mov    %esp,%ebp
+  8000c5:	57                   	push   %edi
+  8000c6:	56                   	push   %esi
+  8000c7:	53                   	push   %ebx
+  8000c8:	83 ec 0c             	sub    $0xc,%esp
+  8000cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d6:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000d8:	c1 ea 0b             	shr    $0xb,%edx
+  8000db:	83 f2 01             	xor    $0x1,%edx
+  8000de:	83 e2 01             	and    $0x1,%edx
+  8000e1:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000e7:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000ee:	00 00 00 
+	envid = sys_getenvid();
+  8000f1:	e8 1f 0c 00 00       	call   800d15 <sys_getenvid>
+  8000f6:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8000f8:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000fd:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800103:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800109:	8b 52 48             	mov    0x48(%edx),%edx
+  80010c:	39 ca                	cmp    %ecx,%edx
+  80010e:	74 27                	je     800137 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800110:	83 c0 01             	add    $0x1,%eax
+  800113:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800118:	75 e3                	jne    8000fd <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80011a:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800121:	75 24                	jne    800147 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800123:	83 ec 04             	sub    $0x4,%esp
+  800126:	68 08 2c 80 00       	push   $0x802c08
+  80012b:	6a 23                	push   $0x23
+  80012d:	68 2b 2c 80 00       	push   $0x802c2b
+  800132:	e8 4f 00 00 00       	call   800186 <_panic>
+			mainenv = &envs[i];
+  800137:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80013d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800142:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800147:	85 ff                	test   %edi,%edi
+  800149:	7e 07                	jle    800152 <libmain+0x90>
+		binaryname = argv[0];
+  80014b:	8b 06                	mov    (%esi),%eax
+  80014d:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	56                   	push   %esi
+  800156:	57                   	push   %edi
+  800157:	e8 d7 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80015c:	e8 0b 00 00 00       	call   80016c <exit>
+}
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800167:	5b                   	pop    %ebx
+  800168:	5e                   	pop    %esi
+  800169:	5f                   	pop    %edi
+  80016a:	5d                   	pop    %ebp
+  80016b:	c3                   	ret
+
+0080016c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80016c:	55                   	push   %ebp
+  80016d:	89 e5                	mov    %esp,%ebp
+  80016f:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800172:	e8 14 1a 00 00       	call   801b8b <close_all>
+	sys_env_destroy(0);
+  800177:	83 ec 0c             	sub    $0xc,%esp
+  80017a:	6a 00                	push   $0x0
+  80017c:	e8 2b 0b 00 00       	call   800cac <sys_env_destroy>
+}
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+
+00800186 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800186:	55                   	push   %ebp
+  800187:	89 e5                	mov    %esp,%ebp
+  800189:	56                   	push   %esi
+  80018a:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80018b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80018e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800194:	e8 7c 0b 00 00       	call   800d15 <sys_getenvid>
+  800199:	83 ec 0c             	sub    $0xc,%esp
+  80019c:	ff 75 0c             	push   0xc(%ebp)
+  80019f:	ff 75 08             	push   0x8(%ebp)
+  8001a2:	56                   	push   %esi
+  8001a3:	50                   	push   %eax
+  8001a4:	68 44 2c 80 00       	push   $0x802c44
+  8001a9:	e8 b3 00 00 00       	call   800261 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001ae:	83 c4 18             	add    $0x18,%esp
+  8001b1:	53                   	push   %ebx
+  8001b2:	ff 75 10             	push   0x10(%ebp)
+  8001b5:	e8 56 00 00 00       	call   800210 <vcprintf>
+	cprintf("\n");
+  8001ba:	c7 04 24 e8 30 80 00 	movl   $0x8030e8,(%esp)
+  8001c1:	e8 9b 00 00 00       	call   800261 <cprintf>
+  8001c6:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001c9:	cc                   	int3
+	while (1)
+  8001ca:	eb fd                	jmp    8001c9 <_panic+0x43>
+
+008001cc <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001cc:	55                   	push   %ebp
+  8001cd:	89 e5                	mov    %esp,%ebp
+  8001cf:	53                   	push   %ebx
+  8001d0:	83 ec 04             	sub    $0x4,%esp
+  8001d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001d6:	8b 13                	mov    (%ebx),%edx
+  8001d8:	8d 42 01             	lea    0x1(%edx),%eax
+  8001db:	89 03                	mov    %eax,(%ebx)
+  8001dd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001e0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001e4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001e9:	74 09                	je     8001f4 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001eb:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f2:	c9                   	leave
+  8001f3:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001f4:	83 ec 08             	sub    $0x8,%esp
+  8001f7:	68 ff 00 00 00       	push   $0xff
+  8001fc:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001ff:	50                   	push   %eax
+  800200:	e8 1d 0a 00 00       	call   800c22 <sys_cputs>
+		b->idx = 0;
+  800205:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80020b:	83 c4 10             	add    $0x10,%esp
+  80020e:	eb db                	jmp    8001eb <putch+0x1f>
+
+00800210 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800210:	55                   	push   %ebp
+  800211:	89 e5                	mov    %esp,%ebp
+  800213:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800219:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800220:	00 00 00 
+	b.cnt = 0;
+  800223:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80022a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	ff 75 08             	push   0x8(%ebp)
+  800233:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800239:	50                   	push   %eax
+  80023a:	68 cc 01 80 00       	push   $0x8001cc
+  80023f:	e8 fb 00 00 00       	call   80033f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800244:	83 c4 08             	add    $0x8,%esp
+  800247:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80024d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800253:	50                   	push   %eax
+  800254:	e8 c9 09 00 00       	call   800c22 <sys_cputs>
+
+	return b.cnt;
+}
+  800259:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80025f:	c9                   	leave
+  800260:	c3                   	ret
+
+00800261 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800261:	55                   	push   %ebp
+  800262:	89 e5                	mov    %esp,%ebp
+  800264:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800267:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80026a:	50                   	push   %eax
+  80026b:	ff 75 08             	push   0x8(%ebp)
+  80026e:	e8 9d ff ff ff       	call   800210 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800273:	c9                   	leave
+  800274:	c3                   	ret
+
+00800275 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	57                   	push   %edi
+  800279:	56                   	push   %esi
+  80027a:	53                   	push   %ebx
+  80027b:	83 ec 1c             	sub    $0x1c,%esp
+  80027e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800281:	89 d6                	mov    %edx,%esi
+  800283:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800286:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800289:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80028c:	73 0b                	jae    800299 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80028e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800291:	c1 e7 08             	shl    $0x8,%edi
+  800294:	0b 7d 10             	or     0x10(%ebp),%edi
+  800297:	eb 36                	jmp    8002cf <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800299:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80029c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a1:	f7 75 08             	divl   0x8(%ebp)
+  8002a4:	89 c1                	mov    %eax,%ecx
+  8002a6:	ff 75 14             	push   0x14(%ebp)
+  8002a9:	ff 75 10             	push   0x10(%ebp)
+  8002ac:	83 eb 01             	sub    $0x1,%ebx
+  8002af:	53                   	push   %ebx
+  8002b0:	ff 75 08             	push   0x8(%ebp)
+  8002b3:	89 f2                	mov    %esi,%edx
+  8002b5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002b8:	e8 b8 ff ff ff       	call   800275 <printnum>
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	eb 14                	jmp    8002d6 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002c2:	83 ec 08             	sub    $0x8,%esp
+  8002c5:	56                   	push   %esi
+  8002c6:	57                   	push   %edi
+  8002c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002ca:	ff d0                	call   *%eax
+  8002cc:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002cf:	83 eb 01             	sub    $0x1,%ebx
+  8002d2:	85 db                	test   %ebx,%ebx
+  8002d4:	7f ec                	jg     8002c2 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002d6:	83 ec 08             	sub    $0x8,%esp
+  8002d9:	56                   	push   %esi
+  8002da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e2:	f7 75 08             	divl   0x8(%ebp)
+  8002e5:	0f be 92 67 2c 80 00 	movsbl 0x802c67(%edx),%edx
+  8002ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ef:	c1 e0 08             	shl    $0x8,%eax
+  8002f2:	09 d0                	or     %edx,%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002f8:	ff d0                	call   *%eax
+}
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800300:	5b                   	pop    %ebx
+  800301:	5e                   	pop    %esi
+  800302:	5f                   	pop    %edi
+  800303:	5d                   	pop    %ebp
+  800304:	c3                   	ret
+
+00800305 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80030b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80030f:	8b 10                	mov    (%eax),%edx
+  800311:	3b 50 04             	cmp    0x4(%eax),%edx
+  800314:	73 0a                	jae    800320 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800316:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800319:	89 08                	mov    %ecx,(%eax)
+  80031b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80031e:	88 02                	mov    %al,(%edx)
+}
+  800320:	5d                   	pop    %ebp
+  800321:	c3                   	ret
+
+00800322 <printfmt>:
+{
+  800322:	55                   	push   %ebp
+  800323:	89 e5                	mov    %esp,%ebp
+  800325:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800328:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80032b:	50                   	push   %eax
+  80032c:	ff 75 10             	push   0x10(%ebp)
+  80032f:	ff 75 0c             	push   0xc(%ebp)
+  800332:	ff 75 08             	push   0x8(%ebp)
+  800335:	e8 05 00 00 00       	call   80033f <vprintfmt>
+}
+  80033a:	83 c4 10             	add    $0x10,%esp
+  80033d:	c9                   	leave
+  80033e:	c3                   	ret
+
+0080033f <vprintfmt>:
+{
+  80033f:	55                   	push   %ebp
+  800340:	89 e5                	mov    %esp,%ebp
+  800342:	57                   	push   %edi
+  800343:	56                   	push   %esi
+  800344:	53                   	push   %ebx
+  800345:	83 ec 3c             	sub    $0x3c,%esp
+  800348:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80034b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80034e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800355:	eb 16                	jmp    80036d <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800357:	83 ec 08             	sub    $0x8,%esp
+  80035a:	ff 75 0c             	push   0xc(%ebp)
+  80035d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800360:	c1 e2 08             	shl    $0x8,%edx
+  800363:	09 d0                	or     %edx,%eax
+  800365:	50                   	push   %eax
+  800366:	ff d7                	call   *%edi
+  800368:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80036b:	89 de                	mov    %ebx,%esi
+  80036d:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800370:	0f b6 06             	movzbl (%esi),%eax
+  800373:	83 f8 25             	cmp    $0x25,%eax
+  800376:	74 0c                	je     800384 <vprintfmt+0x45>
+			if (ch == '\0')
+  800378:	85 c0                	test   %eax,%eax
+  80037a:	75 db                	jne    800357 <vprintfmt+0x18>
+}
+  80037c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037f:	5b                   	pop    %ebx
+  800380:	5e                   	pop    %esi
+  800381:	5f                   	pop    %edi
+  800382:	5d                   	pop    %ebp
+  800383:	c3                   	ret
+		padc = ' ';
+  800384:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800388:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80038f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800396:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80039d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a2:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003a5:	0f b6 13             	movzbl (%ebx),%edx
+  8003a8:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003ab:	3c 55                	cmp    $0x55,%al
+  8003ad:	0f 87 2c 04 00 00    	ja     8007df <vprintfmt+0x4a0>
+  8003b3:	0f b6 c0             	movzbl %al,%eax
+  8003b6:	ff 24 85 c0 2d 80 00 	jmp    *0x802dc0(,%eax,4)
+  8003bd:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003bf:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003c3:	eb dd                	jmp    8003a2 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c5:	89 f3                	mov    %esi,%ebx
+  8003c7:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003cb:	eb d5                	jmp    8003a2 <vprintfmt+0x63>
+  8003cd:	0f b6 d2             	movzbl %dl,%edx
+  8003d0:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003d7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003da:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003de:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003e1:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003e4:	83 fe 09             	cmp    $0x9,%esi
+  8003e7:	0f 87 8a 00 00 00    	ja     800477 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003ed:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003f0:	eb e5                	jmp    8003d7 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f5:	8b 00                	mov    (%eax),%eax
+  8003f7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800400:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800403:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800405:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800409:	79 97                	jns    8003a2 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80040b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80040e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800411:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800418:	eb 88                	jmp    8003a2 <vprintfmt+0x63>
+			if (width < 0)
+  80041a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80041d:	85 db                	test   %ebx,%ebx
+  80041f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800424:	0f 49 c3             	cmovns %ebx,%eax
+  800427:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80042a:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80042c:	e9 71 ff ff ff       	jmp    8003a2 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800431:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800433:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80043a:	e9 63 ff ff ff       	jmp    8003a2 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80043f:	8d 73 02             	lea    0x2(%ebx),%esi
+  800442:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800446:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80044d:	3c 67                	cmp    $0x67,%al
+  80044f:	0f 84 18 ff ff ff    	je     80036d <vprintfmt+0x2e>
+					attrib = 0x04;
+  800455:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80045c:	3c 72                	cmp    $0x72,%al
+  80045e:	0f 84 09 ff ff ff    	je     80036d <vprintfmt+0x2e>
+					attrib = 0x00;
+  800464:	3c 62                	cmp    $0x62,%al
+  800466:	0f 94 c0             	sete   %al
+  800469:	0f b6 c0             	movzbl %al,%eax
+  80046c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80046f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800472:	e9 f6 fe ff ff       	jmp    80036d <vprintfmt+0x2e>
+  800477:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80047a:	eb 89                	jmp    800405 <vprintfmt+0xc6>
+			lflag++;
+  80047c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80047f:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800481:	e9 1c ff ff ff       	jmp    8003a2 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800486:	8b 45 14             	mov    0x14(%ebp),%eax
+  800489:	8d 58 04             	lea    0x4(%eax),%ebx
+  80048c:	83 ec 08             	sub    $0x8,%esp
+  80048f:	ff 75 0c             	push   0xc(%ebp)
+  800492:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800495:	c1 e0 08             	shl    $0x8,%eax
+  800498:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80049b:	0b 01                	or     (%ecx),%eax
+  80049d:	50                   	push   %eax
+  80049e:	ff d7                	call   *%edi
+			break;
+  8004a0:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004a3:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004a6:	e9 c2 fe ff ff       	jmp    80036d <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004b1:	8b 10                	mov    (%eax),%edx
+  8004b3:	89 d0                	mov    %edx,%eax
+  8004b5:	f7 d8                	neg    %eax
+  8004b7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004ba:	83 f8 12             	cmp    $0x12,%eax
+  8004bd:	7f 25                	jg     8004e4 <vprintfmt+0x1a5>
+  8004bf:	8b 14 85 20 2f 80 00 	mov    0x802f20(,%eax,4),%edx
+  8004c6:	85 d2                	test   %edx,%edx
+  8004c8:	74 1a                	je     8004e4 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004ca:	52                   	push   %edx
+  8004cb:	68 7d 30 80 00       	push   $0x80307d
+  8004d0:	ff 75 0c             	push   0xc(%ebp)
+  8004d3:	57                   	push   %edi
+  8004d4:	e8 49 fe ff ff       	call   800322 <printfmt>
+  8004d9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004dc:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8004df:	e9 89 fe ff ff       	jmp    80036d <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004e4:	50                   	push   %eax
+  8004e5:	68 7f 2c 80 00       	push   $0x802c7f
+  8004ea:	ff 75 0c             	push   0xc(%ebp)
+  8004ed:	57                   	push   %edi
+  8004ee:	e8 2f fe ff ff       	call   800322 <printfmt>
+  8004f3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004f6:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004f9:	e9 6f fe ff ff       	jmp    80036d <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800501:	83 c0 04             	add    $0x4,%eax
+  800504:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80050c:	85 c9                	test   %ecx,%ecx
+  80050e:	b8 78 2c 80 00       	mov    $0x802c78,%eax
+  800513:	0f 45 c1             	cmovne %ecx,%eax
+  800516:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800519:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80051d:	7e 06                	jle    800525 <vprintfmt+0x1e6>
+  80051f:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800523:	75 1a                	jne    80053f <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800525:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800528:	c1 e0 08             	shl    $0x8,%eax
+  80052b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80052e:	83 c8 3f             	or     $0x3f,%eax
+  800531:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800534:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800537:	89 75 10             	mov    %esi,0x10(%ebp)
+  80053a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80053d:	eb 6d                	jmp    8005ac <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053f:	83 ec 08             	sub    $0x8,%esp
+  800542:	ff 75 d0             	push   -0x30(%ebp)
+  800545:	ff 75 c8             	push   -0x38(%ebp)
+  800548:	e8 39 03 00 00       	call   800886 <strnlen>
+  80054d:	89 c2                	mov    %eax,%edx
+  80054f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800552:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800554:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800557:	c1 e1 08             	shl    $0x8,%ecx
+  80055a:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80055e:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800560:	83 c4 10             	add    $0x10,%esp
+  800563:	89 c3                	mov    %eax,%ebx
+  800565:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800568:	89 75 10             	mov    %esi,0x10(%ebp)
+  80056b:	89 ce                	mov    %ecx,%esi
+  80056d:	eb 0f                	jmp    80057e <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80056f:	83 ec 08             	sub    $0x8,%esp
+  800572:	ff 75 0c             	push   0xc(%ebp)
+  800575:	56                   	push   %esi
+  800576:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800578:	83 eb 01             	sub    $0x1,%ebx
+  80057b:	83 c4 10             	add    $0x10,%esp
+  80057e:	85 db                	test   %ebx,%ebx
+  800580:	7f ed                	jg     80056f <vprintfmt+0x230>
+  800582:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800585:	8b 75 10             	mov    0x10(%ebp),%esi
+  800588:	85 c0                	test   %eax,%eax
+  80058a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058f:	0f 49 d0             	cmovns %eax,%edx
+  800592:	29 d0                	sub    %edx,%eax
+  800594:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800597:	eb 8c                	jmp    800525 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800599:	83 ec 08             	sub    $0x8,%esp
+  80059c:	ff 75 0c             	push   0xc(%ebp)
+  80059f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005a2:	09 c2                	or     %eax,%edx
+  8005a4:	52                   	push   %edx
+  8005a5:	ff d7                	call   *%edi
+  8005a7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005aa:	89 d9                	mov    %ebx,%ecx
+  8005ac:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005af:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005b3:	0f be d0             	movsbl %al,%edx
+  8005b6:	85 d2                	test   %edx,%edx
+  8005b8:	74 2a                	je     8005e4 <vprintfmt+0x2a5>
+  8005ba:	85 f6                	test   %esi,%esi
+  8005bc:	78 05                	js     8005c3 <vprintfmt+0x284>
+  8005be:	83 ee 01             	sub    $0x1,%esi
+  8005c1:	78 3b                	js     8005fe <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005c3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005c7:	74 d0                	je     800599 <vprintfmt+0x25a>
+  8005c9:	0f be c0             	movsbl %al,%eax
+  8005cc:	83 e8 20             	sub    $0x20,%eax
+  8005cf:	83 f8 5e             	cmp    $0x5e,%eax
+  8005d2:	76 c5                	jbe    800599 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005d4:	83 ec 08             	sub    $0x8,%esp
+  8005d7:	ff 75 0c             	push   0xc(%ebp)
+  8005da:	ff 75 cc             	push   -0x34(%ebp)
+  8005dd:	ff d7                	call   *%edi
+  8005df:	83 c4 10             	add    $0x10,%esp
+  8005e2:	eb c6                	jmp    8005aa <vprintfmt+0x26b>
+  8005e4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005e7:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ed:	01 c3                	add    %eax,%ebx
+  8005ef:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005f1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005f4:	83 c8 20             	or     $0x20,%eax
+  8005f7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005fa:	89 c6                	mov    %eax,%esi
+  8005fc:	eb 14                	jmp    800612 <vprintfmt+0x2d3>
+  8005fe:	8b 75 10             	mov    0x10(%ebp),%esi
+  800601:	eb e4                	jmp    8005e7 <vprintfmt+0x2a8>
+  800603:	83 ec 08             	sub    $0x8,%esp
+  800606:	ff 75 0c             	push   0xc(%ebp)
+  800609:	56                   	push   %esi
+  80060a:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80060c:	83 eb 01             	sub    $0x1,%ebx
+  80060f:	83 c4 10             	add    $0x10,%esp
+  800612:	85 db                	test   %ebx,%ebx
+  800614:	7f ed                	jg     800603 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800616:	8b 75 10             	mov    0x10(%ebp),%esi
+  800619:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80061c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061f:	e9 49 fd ff ff       	jmp    80036d <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800624:	83 f9 01             	cmp    $0x1,%ecx
+  800627:	7f 1f                	jg     800648 <vprintfmt+0x309>
+	else if (lflag)
+  800629:	85 c9                	test   %ecx,%ecx
+  80062b:	74 69                	je     800696 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 00                	mov    (%eax),%eax
+  800632:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800635:	89 c1                	mov    %eax,%ecx
+  800637:	c1 f9 1f             	sar    $0x1f,%ecx
+  80063a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80063d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800640:	8d 40 04             	lea    0x4(%eax),%eax
+  800643:	89 45 14             	mov    %eax,0x14(%ebp)
+  800646:	eb 17                	jmp    80065f <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800648:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064b:	8b 50 04             	mov    0x4(%eax),%edx
+  80064e:	8b 00                	mov    (%eax),%eax
+  800650:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800653:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8d 40 08             	lea    0x8(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80065f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800662:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800665:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80066a:	85 db                	test   %ebx,%ebx
+  80066c:	0f 89 f6 00 00 00    	jns    800768 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800672:	83 ec 08             	sub    $0x8,%esp
+  800675:	ff 75 0c             	push   0xc(%ebp)
+  800678:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80067b:	c1 e0 08             	shl    $0x8,%eax
+  80067e:	83 c8 2d             	or     $0x2d,%eax
+  800681:	50                   	push   %eax
+  800682:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800684:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800687:	f7 d9                	neg    %ecx
+  800689:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80068c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800691:	e9 d2 00 00 00       	jmp    800768 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 00                	mov    (%eax),%eax
+  80069b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069e:	89 c1                	mov    %eax,%ecx
+  8006a0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006a3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ac:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006af:	eb ae                	jmp    80065f <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006b1:	83 f9 01             	cmp    $0x1,%ecx
+  8006b4:	7f 19                	jg     8006cf <vprintfmt+0x390>
+	else if (lflag)
+  8006b6:	85 c9                	test   %ecx,%ecx
+  8006b8:	74 2a                	je     8006e4 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bd:	8b 08                	mov    (%eax),%ecx
+  8006bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006ca:	e9 99 00 00 00       	jmp    800768 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d2:	8b 08                	mov    (%eax),%ecx
+  8006d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006da:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8006df:	e9 84 00 00 00       	jmp    800768 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 08                	mov    (%eax),%ecx
+  8006e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006f4:	eb 72                	jmp    800768 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006f6:	83 f9 01             	cmp    $0x1,%ecx
+  8006f9:	7f 16                	jg     800711 <vprintfmt+0x3d2>
+	else if (lflag)
+  8006fb:	85 c9                	test   %ecx,%ecx
+  8006fd:	74 24                	je     800723 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8b 08                	mov    (%eax),%ecx
+  800704:	8d 40 04             	lea    0x4(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80070a:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80070f:	eb 57                	jmp    800768 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8b 08                	mov    (%eax),%ecx
+  800716:	8d 40 08             	lea    0x8(%eax),%eax
+  800719:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80071c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800721:	eb 45                	jmp    800768 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800723:	8b 45 14             	mov    0x14(%ebp),%eax
+  800726:	8b 08                	mov    (%eax),%ecx
+  800728:	8d 40 04             	lea    0x4(%eax),%eax
+  80072b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800733:	eb 33                	jmp    800768 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800735:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800738:	c1 e3 08             	shl    $0x8,%ebx
+  80073b:	83 ec 08             	sub    $0x8,%esp
+  80073e:	ff 75 0c             	push   0xc(%ebp)
+  800741:	89 d8                	mov    %ebx,%eax
+  800743:	83 c8 30             	or     $0x30,%eax
+  800746:	50                   	push   %eax
+  800747:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800749:	83 c4 08             	add    $0x8,%esp
+  80074c:	ff 75 0c             	push   0xc(%ebp)
+  80074f:	83 cb 78             	or     $0x78,%ebx
+  800752:	53                   	push   %ebx
+  800753:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800755:	8b 45 14             	mov    0x14(%ebp),%eax
+  800758:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80075a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80075d:	8d 40 04             	lea    0x4(%eax),%eax
+  800760:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800763:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800768:	ff 75 e4             	push   -0x1c(%ebp)
+  80076b:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80076f:	52                   	push   %edx
+  800770:	ff 75 e0             	push   -0x20(%ebp)
+  800773:	50                   	push   %eax
+  800774:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800777:	89 f8                	mov    %edi,%eax
+  800779:	e8 f7 fa ff ff       	call   800275 <printnum>
+			break;
+  80077e:	83 c4 10             	add    $0x10,%esp
+  800781:	e9 e7 fb ff ff       	jmp    80036d <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800786:	83 f9 01             	cmp    $0x1,%ecx
+  800789:	7f 16                	jg     8007a1 <vprintfmt+0x462>
+	else if (lflag)
+  80078b:	85 c9                	test   %ecx,%ecx
+  80078d:	74 24                	je     8007b3 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 08                	mov    (%eax),%ecx
+  800794:	8d 40 04             	lea    0x4(%eax),%eax
+  800797:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079a:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80079f:	eb c7                	jmp    800768 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 08                	mov    (%eax),%ecx
+  8007a6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ac:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007b1:	eb b5                	jmp    800768 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 08                	mov    (%eax),%ecx
+  8007b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007be:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007c3:	eb a3                	jmp    800768 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007c5:	83 ec 08             	sub    $0x8,%esp
+  8007c8:	ff 75 0c             	push   0xc(%ebp)
+  8007cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007ce:	c1 e0 08             	shl    $0x8,%eax
+  8007d1:	83 c8 25             	or     $0x25,%eax
+  8007d4:	50                   	push   %eax
+  8007d5:	ff d7                	call   *%edi
+			break;
+  8007d7:	83 c4 10             	add    $0x10,%esp
+  8007da:	e9 8e fb ff ff       	jmp    80036d <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	ff 75 0c             	push   0xc(%ebp)
+  8007e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007e8:	c1 e0 08             	shl    $0x8,%eax
+  8007eb:	83 c8 25             	or     $0x25,%eax
+  8007ee:	50                   	push   %eax
+  8007ef:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007f1:	83 c4 10             	add    $0x10,%esp
+  8007f4:	89 de                	mov    %ebx,%esi
+  8007f6:	eb 03                	jmp    8007fb <vprintfmt+0x4bc>
+  8007f8:	83 ee 01             	sub    $0x1,%esi
+  8007fb:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007ff:	75 f7                	jne    8007f8 <vprintfmt+0x4b9>
+  800801:	e9 67 fb ff ff       	jmp    80036d <vprintfmt+0x2e>
+
+00800806 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	83 ec 18             	sub    $0x18,%esp
+  80080c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800812:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800815:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800819:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80081c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800823:	85 c0                	test   %eax,%eax
+  800825:	74 26                	je     80084d <vsnprintf+0x47>
+  800827:	85 d2                	test   %edx,%edx
+  800829:	7e 22                	jle    80084d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80082b:	ff 75 14             	push   0x14(%ebp)
+  80082e:	ff 75 10             	push   0x10(%ebp)
+  800831:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800834:	50                   	push   %eax
+  800835:	68 05 03 80 00       	push   $0x800305
+  80083a:	e8 00 fb ff ff       	call   80033f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80083f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800842:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800845:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800848:	83 c4 10             	add    $0x10,%esp
+}
+  80084b:	c9                   	leave
+  80084c:	c3                   	ret
+		return -E_INVAL;
+  80084d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800852:	eb f7                	jmp    80084b <vsnprintf+0x45>
+
+00800854 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80085a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80085d:	50                   	push   %eax
+  80085e:	ff 75 10             	push   0x10(%ebp)
+  800861:	ff 75 0c             	push   0xc(%ebp)
+  800864:	ff 75 08             	push   0x8(%ebp)
+  800867:	e8 9a ff ff ff       	call   800806 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80086c:	c9                   	leave
+  80086d:	c3                   	ret
+
+0080086e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80086e:	55                   	push   %ebp
+  80086f:	89 e5                	mov    %esp,%ebp
+  800871:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+  800879:	eb 03                	jmp    80087e <strlen+0x10>
+		n++;
+  80087b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80087e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800882:	75 f7                	jne    80087b <strlen+0xd>
+	return n;
+}
+  800884:	5d                   	pop    %ebp
+  800885:	c3                   	ret
+
+00800886 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800886:	55                   	push   %ebp
+  800887:	89 e5                	mov    %esp,%ebp
+  800889:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80088c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80088f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800894:	eb 03                	jmp    800899 <strnlen+0x13>
+		n++;
+  800896:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800899:	39 d0                	cmp    %edx,%eax
+  80089b:	74 08                	je     8008a5 <strnlen+0x1f>
+  80089d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008a1:	75 f3                	jne    800896 <strnlen+0x10>
+  8008a3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008a5:	89 d0                	mov    %edx,%eax
+  8008a7:	5d                   	pop    %ebp
+  8008a8:	c3                   	ret
+
+008008a9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008a9:	55                   	push   %ebp
+  8008aa:	89 e5                	mov    %esp,%ebp
+  8008ac:	53                   	push   %ebx
+  8008ad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008bc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008bf:	83 c0 01             	add    $0x1,%eax
+  8008c2:	84 d2                	test   %dl,%dl
+  8008c4:	75 f2                	jne    8008b8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008c6:	89 c8                	mov    %ecx,%eax
+  8008c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008cb:	c9                   	leave
+  8008cc:	c3                   	ret
+
+008008cd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008cd:	55                   	push   %ebp
+  8008ce:	89 e5                	mov    %esp,%ebp
+  8008d0:	53                   	push   %ebx
+  8008d1:	83 ec 10             	sub    $0x10,%esp
+  8008d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008d7:	53                   	push   %ebx
+  8008d8:	e8 91 ff ff ff       	call   80086e <strlen>
+  8008dd:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008e0:	ff 75 0c             	push   0xc(%ebp)
+  8008e3:	01 d8                	add    %ebx,%eax
+  8008e5:	50                   	push   %eax
+  8008e6:	e8 be ff ff ff       	call   8008a9 <strcpy>
+	return dst;
+}
+  8008eb:	89 d8                	mov    %ebx,%eax
+  8008ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f0:	c9                   	leave
+  8008f1:	c3                   	ret
+
+008008f2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008f2:	55                   	push   %ebp
+  8008f3:	89 e5                	mov    %esp,%ebp
+  8008f5:	56                   	push   %esi
+  8008f6:	53                   	push   %ebx
+  8008f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008fd:	89 f3                	mov    %esi,%ebx
+  8008ff:	03 5d 10             	add    0x10(%ebp),%ebx
+  800902:	89 f0                	mov    %esi,%eax
+  800904:	eb 0f                	jmp    800915 <strncpy+0x23>
+		*dst++ = *src;
+  800906:	83 c0 01             	add    $0x1,%eax
+  800909:	0f b6 0a             	movzbl (%edx),%ecx
+  80090c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80090f:	80 f9 01             	cmp    $0x1,%cl
+  800912:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800915:	39 d8                	cmp    %ebx,%eax
+  800917:	75 ed                	jne    800906 <strncpy+0x14>
+	}
+	return ret;
+}
+  800919:	89 f0                	mov    %esi,%eax
+  80091b:	5b                   	pop    %ebx
+  80091c:	5e                   	pop    %esi
+  80091d:	5d                   	pop    %ebp
+  80091e:	c3                   	ret
+
+0080091f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80091f:	55                   	push   %ebp
+  800920:	89 e5                	mov    %esp,%ebp
+  800922:	56                   	push   %esi
+  800923:	53                   	push   %ebx
+  800924:	8b 75 08             	mov    0x8(%ebp),%esi
+  800927:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80092a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80092d:	89 f0                	mov    %esi,%eax
+  80092f:	85 d2                	test   %edx,%edx
+  800931:	74 21                	je     800954 <strlcpy+0x35>
+  800933:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800937:	89 f2                	mov    %esi,%edx
+  800939:	eb 09                	jmp    800944 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80093b:	83 c1 01             	add    $0x1,%ecx
+  80093e:	83 c2 01             	add    $0x1,%edx
+  800941:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800944:	39 c2                	cmp    %eax,%edx
+  800946:	74 09                	je     800951 <strlcpy+0x32>
+  800948:	0f b6 19             	movzbl (%ecx),%ebx
+  80094b:	84 db                	test   %bl,%bl
+  80094d:	75 ec                	jne    80093b <strlcpy+0x1c>
+  80094f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800951:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800954:	29 f0                	sub    %esi,%eax
+}
+  800956:	5b                   	pop    %ebx
+  800957:	5e                   	pop    %esi
+  800958:	5d                   	pop    %ebp
+  800959:	c3                   	ret
+
+0080095a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80095a:	55                   	push   %ebp
+  80095b:	89 e5                	mov    %esp,%ebp
+  80095d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800960:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800963:	eb 06                	jmp    80096b <strcmp+0x11>
+		p++, q++;
+  800965:	83 c1 01             	add    $0x1,%ecx
+  800968:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80096b:	0f b6 01             	movzbl (%ecx),%eax
+  80096e:	84 c0                	test   %al,%al
+  800970:	74 04                	je     800976 <strcmp+0x1c>
+  800972:	3a 02                	cmp    (%edx),%al
+  800974:	74 ef                	je     800965 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800976:	0f b6 c0             	movzbl %al,%eax
+  800979:	0f b6 12             	movzbl (%edx),%edx
+  80097c:	29 d0                	sub    %edx,%eax
+}
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+
+00800980 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	53                   	push   %ebx
+  800984:	8b 45 08             	mov    0x8(%ebp),%eax
+  800987:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80098a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80098d:	eb 09                	jmp    800998 <strncmp+0x18>
+		n--, p++, q++;
+  80098f:	83 ea 01             	sub    $0x1,%edx
+  800992:	83 c0 01             	add    $0x1,%eax
+  800995:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800998:	85 d2                	test   %edx,%edx
+  80099a:	74 18                	je     8009b4 <strncmp+0x34>
+  80099c:	0f b6 18             	movzbl (%eax),%ebx
+  80099f:	84 db                	test   %bl,%bl
+  8009a1:	74 04                	je     8009a7 <strncmp+0x27>
+  8009a3:	3a 19                	cmp    (%ecx),%bl
+  8009a5:	74 e8                	je     80098f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009a7:	0f b6 00             	movzbl (%eax),%eax
+  8009aa:	0f b6 11             	movzbl (%ecx),%edx
+  8009ad:	29 d0                	sub    %edx,%eax
+}
+  8009af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009b2:	c9                   	leave
+  8009b3:	c3                   	ret
+		return 0;
+  8009b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b9:	eb f4                	jmp    8009af <strncmp+0x2f>
+
+008009bb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009bb:	55                   	push   %ebp
+  8009bc:	89 e5                	mov    %esp,%ebp
+  8009be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c5:	eb 03                	jmp    8009ca <strchr+0xf>
+  8009c7:	83 c0 01             	add    $0x1,%eax
+  8009ca:	0f b6 10             	movzbl (%eax),%edx
+  8009cd:	84 d2                	test   %dl,%dl
+  8009cf:	74 06                	je     8009d7 <strchr+0x1c>
+		if (*s == c)
+  8009d1:	38 ca                	cmp    %cl,%dl
+  8009d3:	75 f2                	jne    8009c7 <strchr+0xc>
+  8009d5:	eb 05                	jmp    8009dc <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009eb:	38 ca                	cmp    %cl,%dl
+  8009ed:	74 09                	je     8009f8 <strfind+0x1a>
+  8009ef:	84 d2                	test   %dl,%dl
+  8009f1:	74 05                	je     8009f8 <strfind+0x1a>
+	for (; *s; s++)
+  8009f3:	83 c0 01             	add    $0x1,%eax
+  8009f6:	eb f0                	jmp    8009e8 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	57                   	push   %edi
+  8009fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a01:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a04:	85 c9                	test   %ecx,%ecx
+  800a06:	74 20                	je     800a28 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a08:	89 f8                	mov    %edi,%eax
+  800a0a:	09 c8                	or     %ecx,%eax
+  800a0c:	a8 03                	test   $0x3,%al
+  800a0e:	75 12                	jne    800a22 <memset+0x28>
+		c &= 0xFF;
+  800a10:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a14:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a1a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a1d:	fc                   	cld
+  800a1e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a20:	eb 06                	jmp    800a28 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a25:	fc                   	cld
+  800a26:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a28:	89 f8                	mov    %edi,%eax
+  800a2a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a2d:	c9                   	leave
+  800a2e:	c3                   	ret
+
+00800a2f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	57                   	push   %edi
+  800a33:	56                   	push   %esi
+  800a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a37:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a3a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a3d:	39 c6                	cmp    %eax,%esi
+  800a3f:	73 32                	jae    800a73 <memmove+0x44>
+  800a41:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a44:	39 d0                	cmp    %edx,%eax
+  800a46:	73 2b                	jae    800a73 <memmove+0x44>
+		s += n;
+		d += n;
+  800a48:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a4b:	89 d6                	mov    %edx,%esi
+  800a4d:	09 fe                	or     %edi,%esi
+  800a4f:	09 ce                	or     %ecx,%esi
+  800a51:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a57:	75 0e                	jne    800a67 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a59:	83 ef 04             	sub    $0x4,%edi
+  800a5c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a5f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a62:	fd                   	std
+  800a63:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a65:	eb 09                	jmp    800a70 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a67:	83 ef 01             	sub    $0x1,%edi
+  800a6a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a6d:	fd                   	std
+  800a6e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a70:	fc                   	cld
+  800a71:	eb 1a                	jmp    800a8d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a73:	89 f2                	mov    %esi,%edx
+  800a75:	09 c2                	or     %eax,%edx
+  800a77:	09 ca                	or     %ecx,%edx
+  800a79:	f6 c2 03             	test   $0x3,%dl
+  800a7c:	75 0a                	jne    800a88 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a7e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a81:	89 c7                	mov    %eax,%edi
+  800a83:	fc                   	cld
+  800a84:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a86:	eb 05                	jmp    800a8d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a88:	89 c7                	mov    %eax,%edi
+  800a8a:	fc                   	cld
+  800a8b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a8d:	5e                   	pop    %esi
+  800a8e:	5f                   	pop    %edi
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a97:	ff 75 10             	push   0x10(%ebp)
+  800a9a:	ff 75 0c             	push   0xc(%ebp)
+  800a9d:	ff 75 08             	push   0x8(%ebp)
+  800aa0:	e8 8a ff ff ff       	call   800a2f <memmove>
+}
+  800aa5:	c9                   	leave
+  800aa6:	c3                   	ret
+
+00800aa7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aa7:	55                   	push   %ebp
+  800aa8:	89 e5                	mov    %esp,%ebp
+  800aaa:	56                   	push   %esi
+  800aab:	53                   	push   %ebx
+  800aac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aaf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ab2:	89 c6                	mov    %eax,%esi
+  800ab4:	03 75 10             	add    0x10(%ebp),%esi
+  800ab7:	eb 06                	jmp    800abf <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ab9:	83 c0 01             	add    $0x1,%eax
+  800abc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800abf:	39 f0                	cmp    %esi,%eax
+  800ac1:	74 14                	je     800ad7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ac3:	0f b6 08             	movzbl (%eax),%ecx
+  800ac6:	0f b6 1a             	movzbl (%edx),%ebx
+  800ac9:	38 d9                	cmp    %bl,%cl
+  800acb:	74 ec                	je     800ab9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800acd:	0f b6 c1             	movzbl %cl,%eax
+  800ad0:	0f b6 db             	movzbl %bl,%ebx
+  800ad3:	29 d8                	sub    %ebx,%eax
+  800ad5:	eb 05                	jmp    800adc <memcmp+0x35>
+	}
+
+	return 0;
+  800ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800adc:	5b                   	pop    %ebx
+  800add:	5e                   	pop    %esi
+  800ade:	5d                   	pop    %ebp
+  800adf:	c3                   	ret
+
+00800ae0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ae9:	89 c2                	mov    %eax,%edx
+  800aeb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aee:	eb 03                	jmp    800af3 <memfind+0x13>
+  800af0:	83 c0 01             	add    $0x1,%eax
+  800af3:	39 d0                	cmp    %edx,%eax
+  800af5:	73 04                	jae    800afb <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800af7:	38 08                	cmp    %cl,(%eax)
+  800af9:	75 f5                	jne    800af0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	57                   	push   %edi
+  800b01:	56                   	push   %esi
+  800b02:	53                   	push   %ebx
+  800b03:	83 ec 1c             	sub    $0x1c,%esp
+  800b06:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b09:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b0c:	eb 03                	jmp    800b11 <strtol+0x14>
+		s++;
+  800b0e:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b11:	0f b6 06             	movzbl (%esi),%eax
+  800b14:	3c 20                	cmp    $0x20,%al
+  800b16:	74 f6                	je     800b0e <strtol+0x11>
+  800b18:	3c 09                	cmp    $0x9,%al
+  800b1a:	74 f2                	je     800b0e <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b1c:	3c 2b                	cmp    $0x2b,%al
+  800b1e:	74 43                	je     800b63 <strtol+0x66>
+	int neg = 0;
+  800b20:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b25:	3c 2d                	cmp    $0x2d,%al
+  800b27:	74 44                	je     800b6d <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b29:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b2f:	75 0f                	jne    800b40 <strtol+0x43>
+  800b31:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b34:	74 41                	je     800b77 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b36:	85 ff                	test   %edi,%edi
+  800b38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b3d:	0f 44 f8             	cmove  %eax,%edi
+  800b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b45:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b4a:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b4d:	89 fb                	mov    %edi,%ebx
+  800b4f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b52:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b55:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b58:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b5b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b5e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b61:	eb 67                	jmp    800bca <strtol+0xcd>
+		s++;
+  800b63:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b6b:	eb bc                	jmp    800b29 <strtol+0x2c>
+		s++, neg = 1;
+  800b6d:	83 c6 01             	add    $0x1,%esi
+  800b70:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b75:	eb b2                	jmp    800b29 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b77:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b7b:	74 0e                	je     800b8b <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b7d:	85 ff                	test   %edi,%edi
+  800b7f:	75 bf                	jne    800b40 <strtol+0x43>
+		s++, base = 8;
+  800b81:	83 c6 01             	add    $0x1,%esi
+  800b84:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b89:	eb b5                	jmp    800b40 <strtol+0x43>
+		s += 2, base = 16;
+  800b8b:	83 c6 02             	add    $0x2,%esi
+  800b8e:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b93:	eb ab                	jmp    800b40 <strtol+0x43>
+			dig = *s - '0';
+  800b95:	0f be c9             	movsbl %cl,%ecx
+  800b98:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b9b:	39 f9                	cmp    %edi,%ecx
+  800b9d:	7d 59                	jge    800bf8 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b9f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800ba3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ba6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ba9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bac:	0f af d8             	imul   %eax,%ebx
+  800baf:	0f af d7             	imul   %edi,%edx
+  800bb2:	01 d3                	add    %edx,%ebx
+  800bb4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bb7:	f7 e7                	mul    %edi
+  800bb9:	01 da                	add    %ebx,%edx
+  800bbb:	89 cb                	mov    %ecx,%ebx
+  800bbd:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bc0:	01 c8                	add    %ecx,%eax
+  800bc2:	11 da                	adc    %ebx,%edx
+  800bc4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bc7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcd:	0f b6 08             	movzbl (%eax),%ecx
+  800bd0:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800bd3:	80 fb 09             	cmp    $0x9,%bl
+  800bd6:	76 bd                	jbe    800b95 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800bd8:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800bdb:	80 fb 19             	cmp    $0x19,%bl
+  800bde:	77 08                	ja     800be8 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800be0:	0f be c9             	movsbl %cl,%ecx
+  800be3:	83 e9 57             	sub    $0x57,%ecx
+  800be6:	eb b3                	jmp    800b9b <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800be8:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800beb:	80 fb 19             	cmp    $0x19,%bl
+  800bee:	77 08                	ja     800bf8 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800bf0:	0f be c9             	movsbl %cl,%ecx
+  800bf3:	83 e9 37             	sub    $0x37,%ecx
+  800bf6:	eb a3                	jmp    800b9b <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bf8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bfb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bfe:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c01:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c04:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c08:	74 05                	je     800c0f <strtol+0x112>
+		*endptr = (char *) s;
+  800c0a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c0d:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c0f:	85 c9                	test   %ecx,%ecx
+  800c11:	74 07                	je     800c1a <strtol+0x11d>
+  800c13:	f7 d8                	neg    %eax
+  800c15:	83 d2 00             	adc    $0x0,%edx
+  800c18:	f7 da                	neg    %edx
+}
+  800c1a:	83 c4 1c             	add    $0x1c,%esp
+  800c1d:	5b                   	pop    %ebx
+  800c1e:	5e                   	pop    %esi
+  800c1f:	5f                   	pop    %edi
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+
+00800c22 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	57                   	push   %edi
+  800c26:	56                   	push   %esi
+  800c27:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c28:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c2f:	74 18                	je     800c49 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3c:	89 c3                	mov    %eax,%ebx
+  800c3e:	89 c7                	mov    %eax,%edi
+  800c40:	89 c6                	mov    %eax,%esi
+  800c42:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c44:	5b                   	pop    %ebx
+  800c45:	5e                   	pop    %esi
+  800c46:	5f                   	pop    %edi
+  800c47:	5d                   	pop    %ebp
+  800c48:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c54:	89 c3                	mov    %eax,%ebx
+  800c56:	89 c7                	mov    %eax,%edi
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	8d 35 63 0c 80 00    	lea    0x800c63,%esi
+  800c61:	0f 34                	sysenter
+  800c63:	5d                   	pop    %ebp
+		goto out;
+  800c64:	eb de                	jmp    800c44 <sys_cputs+0x22>
+
+00800c66 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	57                   	push   %edi
+  800c6a:	56                   	push   %esi
+  800c6b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c6c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c73:	74 19                	je     800c8e <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c7f:	89 d1                	mov    %edx,%ecx
+  800c81:	89 d3                	mov    %edx,%ebx
+  800c83:	89 d7                	mov    %edx,%edi
+  800c85:	89 d6                	mov    %edx,%esi
+  800c87:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c89:	5b                   	pop    %ebx
+  800c8a:	5e                   	pop    %esi
+  800c8b:	5f                   	pop    %edi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c93:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c98:	89 d1                	mov    %edx,%ecx
+  800c9a:	89 d3                	mov    %edx,%ebx
+  800c9c:	89 d7                	mov    %edx,%edi
+  800c9e:	55                   	push   %ebp
+  800c9f:	89 e5                	mov    %esp,%ebp
+  800ca1:	8d 35 a9 0c 80 00    	lea    0x800ca9,%esi
+  800ca7:	0f 34                	sysenter
+  800ca9:	5d                   	pop    %ebp
+		goto out;
+  800caa:	eb dd                	jmp    800c89 <sys_cgetc+0x23>
+
+00800cac <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	57                   	push   %edi
+  800cb0:	56                   	push   %esi
+  800cb1:	53                   	push   %ebx
+  800cb2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800cb5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cbc:	74 21                	je     800cdf <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccb:	89 cb                	mov    %ecx,%ebx
+  800ccd:	89 cf                	mov    %ecx,%edi
+  800ccf:	89 ce                	mov    %ecx,%esi
+  800cd1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd3:	85 c0                	test   %eax,%eax
+  800cd5:	7f 27                	jg     800cfe <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cda:	5b                   	pop    %ebx
+  800cdb:	5e                   	pop    %esi
+  800cdc:	5f                   	pop    %edi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cec:	89 cb                	mov    %ecx,%ebx
+  800cee:	89 cf                	mov    %ecx,%edi
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	8d 35 fb 0c 80 00    	lea    0x800cfb,%esi
+  800cf9:	0f 34                	sysenter
+  800cfb:	5d                   	pop    %ebp
+		goto out;
+  800cfc:	eb d5                	jmp    800cd3 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfe:	83 ec 0c             	sub    $0xc,%esp
+  800d01:	50                   	push   %eax
+  800d02:	6a 03                	push   $0x3
+  800d04:	68 8b 2f 80 00       	push   $0x802f8b
+  800d09:	6a 3f                	push   $0x3f
+  800d0b:	68 a8 2f 80 00       	push   $0x802fa8
+  800d10:	e8 71 f4 ff ff       	call   800186 <_panic>
+
+00800d15 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	56                   	push   %esi
+  800d1a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d1b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d22:	74 19                	je     800d3d <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d24:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d29:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d2e:	89 d1                	mov    %edx,%ecx
+  800d30:	89 d3                	mov    %edx,%ebx
+  800d32:	89 d7                	mov    %edx,%edi
+  800d34:	89 d6                	mov    %edx,%esi
+  800d36:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d38:	5b                   	pop    %ebx
+  800d39:	5e                   	pop    %esi
+  800d3a:	5f                   	pop    %edi
+  800d3b:	5d                   	pop    %ebp
+  800d3c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d42:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d47:	89 d1                	mov    %edx,%ecx
+  800d49:	89 d3                	mov    %edx,%ebx
+  800d4b:	89 d7                	mov    %edx,%edi
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	8d 35 58 0d 80 00    	lea    0x800d58,%esi
+  800d56:	0f 34                	sysenter
+  800d58:	5d                   	pop    %ebp
+		goto out;
+  800d59:	eb dd                	jmp    800d38 <sys_getenvid+0x23>
+
+00800d5b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d61:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d68:	74 19                	je     800d83 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d74:	89 d1                	mov    %edx,%ecx
+  800d76:	89 d3                	mov    %edx,%ebx
+  800d78:	89 d7                	mov    %edx,%edi
+  800d7a:	89 d6                	mov    %edx,%esi
+  800d7c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d7e:	5b                   	pop    %ebx
+  800d7f:	5e                   	pop    %esi
+  800d80:	5f                   	pop    %edi
+  800d81:	5d                   	pop    %ebp
+  800d82:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d88:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d8d:	89 d1                	mov    %edx,%ecx
+  800d8f:	89 d3                	mov    %edx,%ebx
+  800d91:	89 d7                	mov    %edx,%edi
+  800d93:	55                   	push   %ebp
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	8d 35 9e 0d 80 00    	lea    0x800d9e,%esi
+  800d9c:	0f 34                	sysenter
+  800d9e:	5d                   	pop    %ebp
+		goto out;
+  800d9f:	eb dd                	jmp    800d7e <sys_yield+0x23>
+
+00800da1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	57                   	push   %edi
+  800da5:	56                   	push   %esi
+  800da6:	53                   	push   %ebx
+  800da7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800daa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800db1:	74 23                	je     800dd6 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800db3:	be 00 00 00 00       	mov    $0x0,%esi
+  800db8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc6:	89 f7                	mov    %esi,%edi
+  800dc8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dca:	85 c0                	test   %eax,%eax
+  800dcc:	7f 29                	jg     800df7 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd1:	5b                   	pop    %ebx
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800de1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800de6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	8d 35 f4 0d 80 00    	lea    0x800df4,%esi
+  800df2:	0f 34                	sysenter
+  800df4:	5d                   	pop    %ebp
+		goto out;
+  800df5:	eb d3                	jmp    800dca <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df7:	83 ec 0c             	sub    $0xc,%esp
+  800dfa:	50                   	push   %eax
+  800dfb:	6a 04                	push   $0x4
+  800dfd:	68 8b 2f 80 00       	push   $0x802f8b
+  800e02:	6a 3f                	push   $0x3f
+  800e04:	68 a8 2f 80 00       	push   $0x802fa8
+  800e09:	e8 78 f3 ff ff       	call   800186 <_panic>
+
+00800e0e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+  800e17:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e1a:	85 f6                	test   %esi,%esi
+  800e1c:	75 09                	jne    800e27 <sys_page_map+0x19>
+  800e1e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e25:	74 1f                	je     800e46 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e27:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e35:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e38:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e3a:	85 c0                	test   %eax,%eax
+  800e3c:	7f 27                	jg     800e65 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e54:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	8d 35 62 0e 80 00    	lea    0x800e62,%esi
+  800e60:	0f 34                	sysenter
+  800e62:	5d                   	pop    %ebp
+		goto out;
+  800e63:	eb d5                	jmp    800e3a <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	50                   	push   %eax
+  800e69:	6a 05                	push   $0x5
+  800e6b:	68 8b 2f 80 00       	push   $0x802f8b
+  800e70:	6a 3f                	push   $0x3f
+  800e72:	68 a8 2f 80 00       	push   $0x802fa8
+  800e77:	e8 0a f3 ff ff       	call   800186 <_panic>
+
+00800e7c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e85:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e8c:	74 22                	je     800eb0 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e93:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9e:	89 df                	mov    %ebx,%edi
+  800ea0:	89 de                	mov    %ebx,%esi
+  800ea2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea4:	85 c0                	test   %eax,%eax
+  800ea6:	7f 28                	jg     800ed0 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ea8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eab:	5b                   	pop    %ebx
+  800eac:	5e                   	pop    %esi
+  800ead:	5f                   	pop    %edi
+  800eae:	5d                   	pop    %ebp
+  800eaf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebb:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ec0:	89 df                	mov    %ebx,%edi
+  800ec2:	55                   	push   %ebp
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	8d 35 cd 0e 80 00    	lea    0x800ecd,%esi
+  800ecb:	0f 34                	sysenter
+  800ecd:	5d                   	pop    %ebp
+		goto out;
+  800ece:	eb d4                	jmp    800ea4 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+  800ed3:	50                   	push   %eax
+  800ed4:	6a 06                	push   $0x6
+  800ed6:	68 8b 2f 80 00       	push   $0x802f8b
+  800edb:	6a 3f                	push   $0x3f
+  800edd:	68 a8 2f 80 00       	push   $0x802fa8
+  800ee2:	e8 9f f2 ff ff       	call   800186 <_panic>
+
+00800ee7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	56                   	push   %esi
+  800eec:	53                   	push   %ebx
+  800eed:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ef0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ef7:	74 22                	je     800f1b <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efe:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	89 df                	mov    %ebx,%edi
+  800f0b:	89 de                	mov    %ebx,%esi
+  800f0d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0f:	85 c0                	test   %eax,%eax
+  800f11:	7f 28                	jg     800f3b <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f16:	5b                   	pop    %ebx
+  800f17:	5e                   	pop    %esi
+  800f18:	5f                   	pop    %edi
+  800f19:	5d                   	pop    %ebp
+  800f1a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f2b:	89 df                	mov    %ebx,%edi
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	8d 35 38 0f 80 00    	lea    0x800f38,%esi
+  800f36:	0f 34                	sysenter
+  800f38:	5d                   	pop    %ebp
+		goto out;
+  800f39:	eb d4                	jmp    800f0f <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+  800f3e:	50                   	push   %eax
+  800f3f:	6a 08                	push   $0x8
+  800f41:	68 8b 2f 80 00       	push   $0x802f8b
+  800f46:	6a 3f                	push   $0x3f
+  800f48:	68 a8 2f 80 00       	push   $0x802fa8
+  800f4d:	e8 34 f2 ff ff       	call   800186 <_panic>
+
+00800f52 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	56                   	push   %esi
+  800f57:	53                   	push   %ebx
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f5b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f62:	74 22                	je     800f86 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f69:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f74:	89 df                	mov    %ebx,%edi
+  800f76:	89 de                	mov    %ebx,%esi
+  800f78:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	7f 28                	jg     800fa6 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f91:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f96:	89 df                	mov    %ebx,%edi
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	8d 35 a3 0f 80 00    	lea    0x800fa3,%esi
+  800fa1:	0f 34                	sysenter
+  800fa3:	5d                   	pop    %ebp
+		goto out;
+  800fa4:	eb d4                	jmp    800f7a <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa6:	83 ec 0c             	sub    $0xc,%esp
+  800fa9:	50                   	push   %eax
+  800faa:	6a 09                	push   $0x9
+  800fac:	68 8b 2f 80 00       	push   $0x802f8b
+  800fb1:	6a 3f                	push   $0x3f
+  800fb3:	68 a8 2f 80 00       	push   $0x802fa8
+  800fb8:	e8 c9 f1 ff ff       	call   800186 <_panic>
+
+00800fbd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+  800fc3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fc6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fcd:	74 22                	je     800ff1 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800fcf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	89 df                	mov    %ebx,%edi
+  800fe1:	89 de                	mov    %ebx,%esi
+  800fe3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe5:	85 c0                	test   %eax,%eax
+  800fe7:	7f 28                	jg     801011 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fec:	5b                   	pop    %ebx
+  800fed:	5e                   	pop    %esi
+  800fee:	5f                   	pop    %edi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ff1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801001:	89 df                	mov    %ebx,%edi
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	8d 35 0e 10 80 00    	lea    0x80100e,%esi
+  80100c:	0f 34                	sysenter
+  80100e:	5d                   	pop    %ebp
+		goto out;
+  80100f:	eb d4                	jmp    800fe5 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801011:	83 ec 0c             	sub    $0xc,%esp
+  801014:	50                   	push   %eax
+  801015:	6a 0a                	push   $0xa
+  801017:	68 8b 2f 80 00       	push   $0x802f8b
+  80101c:	6a 3f                	push   $0x3f
+  80101e:	68 a8 2f 80 00       	push   $0x802fa8
+  801023:	e8 5e f1 ff ff       	call   800186 <_panic>
+
+00801028 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	57                   	push   %edi
+  80102c:	56                   	push   %esi
+  80102d:	53                   	push   %ebx
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801031:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801038:	74 22                	je     80105c <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	89 de                	mov    %ebx,%esi
+  80104e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801050:	85 c0                	test   %eax,%eax
+  801052:	7f 28                	jg     80107c <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5f                   	pop    %edi
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801067:	b8 17 00 00 00       	mov    $0x17,%eax
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	8d 35 79 10 80 00    	lea    0x801079,%esi
+  801077:	0f 34                	sysenter
+  801079:	5d                   	pop    %ebp
+		goto out;
+  80107a:	eb d4                	jmp    801050 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107c:	83 ec 0c             	sub    $0xc,%esp
+  80107f:	50                   	push   %eax
+  801080:	6a 17                	push   $0x17
+  801082:	68 8b 2f 80 00       	push   $0x802f8b
+  801087:	6a 3f                	push   $0x3f
+  801089:	68 a8 2f 80 00       	push   $0x802fa8
+  80108e:	e8 f3 f0 ff ff       	call   800186 <_panic>
+
+00801093 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+  801099:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80109c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010a3:	74 22                	je     8010c7 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010aa:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	89 df                	mov    %ebx,%edi
+  8010b7:	89 de                	mov    %ebx,%esi
+  8010b9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010bb:	85 c0                	test   %eax,%eax
+  8010bd:	7f 28                	jg     8010e7 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d7:	89 df                	mov    %ebx,%edi
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	8d 35 e4 10 80 00    	lea    0x8010e4,%esi
+  8010e2:	0f 34                	sysenter
+  8010e4:	5d                   	pop    %ebp
+		goto out;
+  8010e5:	eb d4                	jmp    8010bb <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e7:	83 ec 0c             	sub    $0xc,%esp
+  8010ea:	50                   	push   %eax
+  8010eb:	6a 18                	push   $0x18
+  8010ed:	68 8b 2f 80 00       	push   $0x802f8b
+  8010f2:	6a 3f                	push   $0x3f
+  8010f4:	68 a8 2f 80 00       	push   $0x802fa8
+  8010f9:	e8 88 f0 ff ff       	call   800186 <_panic>
+
+008010fe <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801104:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80110b:	74 1d                	je     80112a <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80110d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801112:	be 00 00 00 00       	mov    $0x0,%esi
+  801117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801120:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801123:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801125:	5b                   	pop    %ebx
+  801126:	5e                   	pop    %esi
+  801127:	5f                   	pop    %edi
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80112a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801130:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801135:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801138:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	8d 35 46 11 80 00    	lea    0x801146,%esi
+  801144:	0f 34                	sysenter
+  801146:	5d                   	pop    %ebp
+		goto out;
+  801147:	eb dc                	jmp    801125 <sys_ipc_try_send+0x27>
+
+00801149 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+  80114f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801152:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801159:	74 21                	je     80117c <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80115b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801160:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801165:	8b 55 08             	mov    0x8(%ebp),%edx
+  801168:	89 cb                	mov    %ecx,%ebx
+  80116a:	89 cf                	mov    %ecx,%edi
+  80116c:	89 ce                	mov    %ecx,%esi
+  80116e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801170:	85 c0                	test   %eax,%eax
+  801172:	7f 27                	jg     80119b <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801174:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801177:	5b                   	pop    %ebx
+  801178:	5e                   	pop    %esi
+  801179:	5f                   	pop    %edi
+  80117a:	5d                   	pop    %ebp
+  80117b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80117c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801184:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801189:	89 cb                	mov    %ecx,%ebx
+  80118b:	89 cf                	mov    %ecx,%edi
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	8d 35 98 11 80 00    	lea    0x801198,%esi
+  801196:	0f 34                	sysenter
+  801198:	5d                   	pop    %ebp
+		goto out;
+  801199:	eb d5                	jmp    801170 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+  80119e:	50                   	push   %eax
+  80119f:	6a 0d                	push   $0xd
+  8011a1:	68 8b 2f 80 00       	push   $0x802f8b
+  8011a6:	6a 3f                	push   $0x3f
+  8011a8:	68 a8 2f 80 00       	push   $0x802fa8
+  8011ad:	e8 d4 ef ff ff       	call   800186 <_panic>
+
+008011b2 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	57                   	push   %edi
+  8011b6:	56                   	push   %esi
+  8011b7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011b8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011bf:	74 1b                	je     8011dc <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d1:	89 df                	mov    %ebx,%edi
+  8011d3:	89 de                	mov    %ebx,%esi
+  8011d5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011d7:	5b                   	pop    %ebx
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5f                   	pop    %edi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ec:	89 df                	mov    %ebx,%edi
+  8011ee:	55                   	push   %ebp
+  8011ef:	89 e5                	mov    %esp,%ebp
+  8011f1:	8d 35 f9 11 80 00    	lea    0x8011f9,%esi
+  8011f7:	0f 34                	sysenter
+  8011f9:	5d                   	pop    %ebp
+		goto out;
+  8011fa:	eb db                	jmp    8011d7 <sys_ipc_recv_until+0x25>
+
+008011fc <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	57                   	push   %edi
+  801200:	56                   	push   %esi
+  801201:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801202:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801209:	74 19                	je     801224 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80120b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801210:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801215:	89 d1                	mov    %edx,%ecx
+  801217:	89 d3                	mov    %edx,%ebx
+  801219:	89 d7                	mov    %edx,%edi
+  80121b:	89 d6                	mov    %edx,%esi
+  80121d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80121f:	5b                   	pop    %ebx
+  801220:	5e                   	pop    %esi
+  801221:	5f                   	pop    %edi
+  801222:	5d                   	pop    %ebp
+  801223:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801224:	ba 00 00 00 00       	mov    $0x0,%edx
+  801229:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80122e:	89 d1                	mov    %edx,%ecx
+  801230:	89 d3                	mov    %edx,%ebx
+  801232:	89 d7                	mov    %edx,%edi
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	8d 35 3f 12 80 00    	lea    0x80123f,%esi
+  80123d:	0f 34                	sysenter
+  80123f:	5d                   	pop    %ebp
+		goto out;
+  801240:	eb dd                	jmp    80121f <sys_time_msec+0x23>
+
+00801242 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801242:	55                   	push   %ebp
+  801243:	89 e5                	mov    %esp,%ebp
+  801245:	57                   	push   %edi
+  801246:	56                   	push   %esi
+  801247:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801248:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80124f:	74 1a                	je     80126b <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801251:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801256:	b8 10 00 00 00       	mov    $0x10,%eax
+  80125b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125e:	89 cb                	mov    %ecx,%ebx
+  801260:	89 cf                	mov    %ecx,%edi
+  801262:	89 ce                	mov    %ecx,%esi
+  801264:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80126b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801273:	b8 10 00 00 00       	mov    $0x10,%eax
+  801278:	89 cb                	mov    %ecx,%ebx
+  80127a:	89 cf                	mov    %ecx,%edi
+  80127c:	55                   	push   %ebp
+  80127d:	89 e5                	mov    %esp,%ebp
+  80127f:	8d 35 87 12 80 00    	lea    0x801287,%esi
+  801285:	0f 34                	sysenter
+  801287:	5d                   	pop    %ebp
+		goto out;
+  801288:	eb dc                	jmp    801266 <sys_sleep_until+0x24>
+
+0080128a <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	57                   	push   %edi
+  80128e:	56                   	push   %esi
+  80128f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801290:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801297:	74 1a                	je     8012b3 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801299:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80129e:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a6:	89 cb                	mov    %ecx,%ebx
+  8012a8:	89 cf                	mov    %ecx,%edi
+  8012aa:	89 ce                	mov    %ecx,%esi
+  8012ac:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012ae:	5b                   	pop    %ebx
+  8012af:	5e                   	pop    %esi
+  8012b0:	5f                   	pop    %edi
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012bb:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012c0:	89 cb                	mov    %ecx,%ebx
+  8012c2:	89 cf                	mov    %ecx,%edi
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	8d 35 cf 12 80 00    	lea    0x8012cf,%esi
+  8012cd:	0f 34                	sysenter
+  8012cf:	5d                   	pop    %ebp
+		goto out;
+  8012d0:	eb dc                	jmp    8012ae <sys_env_print_stats+0x24>
+
+008012d2 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012d2:	55                   	push   %ebp
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	57                   	push   %edi
+  8012d6:	56                   	push   %esi
+  8012d7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012d8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012df:	74 1b                	je     8012fc <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f1:	89 df                	mov    %ebx,%edi
+  8012f3:	89 de                	mov    %ebx,%esi
+  8012f5:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012f7:	5b                   	pop    %ebx
+  8012f8:	5e                   	pop    %esi
+  8012f9:	5f                   	pop    %edi
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801301:	8b 55 08             	mov    0x8(%ebp),%edx
+  801304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801307:	b8 19 00 00 00       	mov    $0x19,%eax
+  80130c:	89 df                	mov    %ebx,%edi
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	8d 35 19 13 80 00    	lea    0x801319,%esi
+  801317:	0f 34                	sysenter
+  801319:	5d                   	pop    %ebp
+		goto out;
+  80131a:	eb db                	jmp    8012f7 <sys_perf+0x25>
+
+0080131c <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	57                   	push   %edi
+  801320:	56                   	push   %esi
+  801321:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801322:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801329:	74 19                	je     801344 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80132b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801330:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801335:	89 d1                	mov    %edx,%ecx
+  801337:	89 d3                	mov    %edx,%ebx
+  801339:	89 d7                	mov    %edx,%edi
+  80133b:	89 d6                	mov    %edx,%esi
+  80133d:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80133f:	5b                   	pop    %ebx
+  801340:	5e                   	pop    %esi
+  801341:	5f                   	pop    %edi
+  801342:	5d                   	pop    %ebp
+  801343:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801344:	ba 00 00 00 00       	mov    $0x0,%edx
+  801349:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80134e:	89 d1                	mov    %edx,%ecx
+  801350:	89 d3                	mov    %edx,%ebx
+  801352:	89 d7                	mov    %edx,%edi
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  801357:	8d 35 5f 13 80 00    	lea    0x80135f,%esi
+  80135d:	0f 34                	sysenter
+  80135f:	5d                   	pop    %ebp
+		goto out;
+  801360:	eb dd                	jmp    80133f <sys_fork+0x23>
+
+00801362 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801362:	55                   	push   %ebp
+  801363:	89 e5                	mov    %esp,%ebp
+  801365:	57                   	push   %edi
+  801366:	56                   	push   %esi
+  801367:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801368:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80136f:	74 1c                	je     80138d <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801371:	be 00 00 00 00       	mov    $0x0,%esi
+  801376:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80137b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801381:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801384:	89 f7                	mov    %esi,%edi
+  801386:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801388:	5b                   	pop    %ebx
+  801389:	5e                   	pop    %esi
+  80138a:	5f                   	pop    %edi
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80138d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801390:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801393:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801398:	bf 00 00 00 00       	mov    $0x0,%edi
+  80139d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a0:	55                   	push   %ebp
+  8013a1:	89 e5                	mov    %esp,%ebp
+  8013a3:	8d 35 ab 13 80 00    	lea    0x8013ab,%esi
+  8013a9:	0f 34                	sysenter
+  8013ab:	5d                   	pop    %ebp
+		goto out;
+  8013ac:	eb da                	jmp    801388 <sys_thread_create+0x26>
+
+008013ae <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013ae:	55                   	push   %ebp
+  8013af:	89 e5                	mov    %esp,%ebp
+  8013b1:	57                   	push   %edi
+  8013b2:	56                   	push   %esi
+  8013b3:	53                   	push   %ebx
+  8013b4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013b7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013be:	74 24                	je     8013e4 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013c0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	7f 27                	jg     801403 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013df:	5b                   	pop    %ebx
+  8013e0:	5e                   	pop    %esi
+  8013e1:	5f                   	pop    %edi
+  8013e2:	5d                   	pop    %ebp
+  8013e3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ea:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	8d 35 00 14 80 00    	lea    0x801400,%esi
+  8013fe:	0f 34                	sysenter
+  801400:	5d                   	pop    %ebp
+		goto out;
+  801401:	eb d5                	jmp    8013d8 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801403:	83 ec 0c             	sub    $0xc,%esp
+  801406:	50                   	push   %eax
+  801407:	6a 1f                	push   $0x1f
+  801409:	68 8b 2f 80 00       	push   $0x802f8b
+  80140e:	6a 3f                	push   $0x3f
+  801410:	68 a8 2f 80 00       	push   $0x802fa8
+  801415:	e8 6c ed ff ff       	call   800186 <_panic>
+
+0080141a <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80141a:	55                   	push   %ebp
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	57                   	push   %edi
+  80141e:	56                   	push   %esi
+  80141f:	53                   	push   %ebx
+  801420:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801423:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80142a:	74 23                	je     80144f <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80142c:	be 00 00 00 00       	mov    $0x0,%esi
+  801431:	b8 20 00 00 00       	mov    $0x20,%eax
+  801436:	8b 55 08             	mov    0x8(%ebp),%edx
+  801439:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143f:	89 f7                	mov    %esi,%edi
+  801441:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801443:	85 c0                	test   %eax,%eax
+  801445:	7f 29                	jg     801470 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144a:	5b                   	pop    %ebx
+  80144b:	5e                   	pop    %esi
+  80144c:	5f                   	pop    %edi
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80144f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801452:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801455:	b8 20 00 00 00       	mov    $0x20,%eax
+  80145a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80145f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801462:	55                   	push   %ebp
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	8d 35 6d 14 80 00    	lea    0x80146d,%esi
+  80146b:	0f 34                	sysenter
+  80146d:	5d                   	pop    %ebp
+		goto out;
+  80146e:	eb d3                	jmp    801443 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801470:	83 ec 0c             	sub    $0xc,%esp
+  801473:	50                   	push   %eax
+  801474:	6a 20                	push   $0x20
+  801476:	68 8b 2f 80 00       	push   $0x802f8b
+  80147b:	6a 3f                	push   $0x3f
+  80147d:	68 a8 2f 80 00       	push   $0x802fa8
+  801482:	e8 ff ec ff ff       	call   800186 <_panic>
+
+00801487 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801487:	55                   	push   %ebp
+  801488:	89 e5                	mov    %esp,%ebp
+  80148a:	57                   	push   %edi
+  80148b:	56                   	push   %esi
+  80148c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80148d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801494:	74 1b                	je     8014b1 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801496:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80149b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a6:	89 df                	mov    %ebx,%edi
+  8014a8:	89 de                	mov    %ebx,%esi
+  8014aa:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014ac:	5b                   	pop    %ebx
+  8014ad:	5e                   	pop    %esi
+  8014ae:	5f                   	pop    %edi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014c1:	89 df                	mov    %ebx,%edi
+  8014c3:	55                   	push   %ebp
+  8014c4:	89 e5                	mov    %esp,%ebp
+  8014c6:	8d 35 ce 14 80 00    	lea    0x8014ce,%esi
+  8014cc:	0f 34                	sysenter
+  8014ce:	5d                   	pop    %ebp
+		goto out;
+  8014cf:	eb db                	jmp    8014ac <sys_batch+0x25>
+
+008014d1 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014d1:	55                   	push   %ebp
+  8014d2:	89 e5                	mov    %esp,%ebp
+  8014d4:	57                   	push   %edi
+  8014d5:	56                   	push   %esi
+  8014d6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014d7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014de:	74 1a                	je     8014fa <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8014e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ed:	89 cb                	mov    %ecx,%ebx
+  8014ef:	89 cf                	mov    %ecx,%edi
+  8014f1:	89 ce                	mov    %ecx,%esi
+  8014f3:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014f5:	5b                   	pop    %ebx
+  8014f6:	5e                   	pop    %esi
+  8014f7:	5f                   	pop    %edi
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801502:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801507:	89 cb                	mov    %ecx,%ebx
+  801509:	89 cf                	mov    %ecx,%edi
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	8d 35 16 15 80 00    	lea    0x801516,%esi
+  801514:	0f 34                	sysenter
+  801516:	5d                   	pop    %ebp
+		goto out;
+  801517:	eb dc                	jmp    8014f5 <sys_trace_ctl+0x24>
+
+00801519 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	57                   	push   %edi
+  80151d:	56                   	push   %esi
+  80151e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80151f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801526:	74 1c                	je     801544 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+  80152d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801532:	8b 55 08             	mov    0x8(%ebp),%edx
+  801535:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801538:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153b:	89 f7                	mov    %esi,%edi
+  80153d:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80153f:	5b                   	pop    %ebx
+  801540:	5e                   	pop    %esi
+  801541:	5f                   	pop    %edi
+  801542:	5d                   	pop    %ebp
+  801543:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801544:	8b 55 08             	mov    0x8(%ebp),%edx
+  801547:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80154f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801554:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801557:	55                   	push   %ebp
+  801558:	89 e5                	mov    %esp,%ebp
+  80155a:	8d 35 62 15 80 00    	lea    0x801562,%esi
+  801560:	0f 34                	sysenter
+  801562:	5d                   	pop    %ebp
+		goto out;
+  801563:	eb da                	jmp    80153f <sys_trace_read+0x26>
+
+00801565 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801565:	55                   	push   %ebp
+  801566:	89 e5                	mov    %esp,%ebp
+  801568:	57                   	push   %edi
+  801569:	56                   	push   %esi
+  80156a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80156b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801572:	74 1c                	je     801590 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801574:	be 00 00 00 00       	mov    $0x0,%esi
+  801579:	b8 21 00 00 00       	mov    $0x21,%eax
+  80157e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801581:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801584:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801587:	89 f7                	mov    %esi,%edi
+  801589:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80158b:	5b                   	pop    %ebx
+  80158c:	5e                   	pop    %esi
+  80158d:	5f                   	pop    %edi
+  80158e:	5d                   	pop    %ebp
+  80158f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801590:	8b 55 08             	mov    0x8(%ebp),%edx
+  801593:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801596:	b8 21 00 00 00       	mov    $0x21,%eax
+  80159b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a3:	55                   	push   %ebp
+  8015a4:	89 e5                	mov    %esp,%ebp
+  8015a6:	8d 35 ae 15 80 00    	lea    0x8015ae,%esi
+  8015ac:	0f 34                	sysenter
+  8015ae:	5d                   	pop    %ebp
+		goto out;
+  8015af:	eb da                	jmp    80158b <sys_meminfo+0x26>
+
+008015b1 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015b1:	55                   	push   %ebp
+  8015b2:	89 e5                	mov    %esp,%ebp
+  8015b4:	57                   	push   %edi
+  8015b5:	56                   	push   %esi
+  8015b6:	53                   	push   %ebx
+  8015b7:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015ba:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015be:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015c5:	74 1f                	je     8015e6 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cc:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d4:	89 df                	mov    %ebx,%edi
+  8015d6:	89 de                	mov    %ebx,%esi
+  8015d8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015da:	85 c0                	test   %eax,%eax
+  8015dc:	7f 25                	jg     801603 <sys_env_set_ksm+0x52>
+}
+  8015de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e1:	5b                   	pop    %ebx
+  8015e2:	5e                   	pop    %esi
+  8015e3:	5f                   	pop    %edi
+  8015e4:	5d                   	pop    %ebp
+  8015e5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ee:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015f3:	89 df                	mov    %ebx,%edi
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	8d 35 00 16 80 00    	lea    0x801600,%esi
+  8015fe:	0f 34                	sysenter
+  801600:	5d                   	pop    %ebp
+		goto out;
+  801601:	eb d7                	jmp    8015da <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801603:	83 ec 0c             	sub    $0xc,%esp
+  801606:	50                   	push   %eax
+  801607:	6a 22                	push   $0x22
+  801609:	68 8b 2f 80 00       	push   $0x802f8b
+  80160e:	6a 3f                	push   $0x3f
+  801610:	68 a8 2f 80 00       	push   $0x802fa8
+  801615:	e8 6c eb ff ff       	call   800186 <_panic>
+
+0080161a <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  80161d:	57                   	push   %edi
+  80161e:	56                   	push   %esi
+  80161f:	53                   	push   %ebx
+  801620:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801623:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801626:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80162d:	74 24                	je     801653 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80162f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801634:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801639:	89 cb                	mov    %ecx,%ebx
+  80163b:	89 cf                	mov    %ecx,%edi
+  80163d:	89 ce                	mov    %ecx,%esi
+  80163f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801641:	85 c0                	test   %eax,%eax
+  801643:	7f 2a                	jg     80166f <sys_time_nsec+0x55>
+	return ns;
+}
+  801645:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801648:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80164b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164e:	5b                   	pop    %ebx
+  80164f:	5e                   	pop    %esi
+  801650:	5f                   	pop    %edi
+  801651:	5d                   	pop    %ebp
+  801652:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801653:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801658:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80165d:	89 cb                	mov    %ecx,%ebx
+  80165f:	89 cf                	mov    %ecx,%edi
+  801661:	55                   	push   %ebp
+  801662:	89 e5                	mov    %esp,%ebp
+  801664:	8d 35 6c 16 80 00    	lea    0x80166c,%esi
+  80166a:	0f 34                	sysenter
+  80166c:	5d                   	pop    %ebp
+		goto out;
+  80166d:	eb d2                	jmp    801641 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80166f:	83 ec 0c             	sub    $0xc,%esp
+  801672:	50                   	push   %eax
+  801673:	6a 0f                	push   $0xf
+  801675:	68 8b 2f 80 00       	push   $0x802f8b
+  80167a:	6a 3f                	push   $0x3f
+  80167c:	68 a8 2f 80 00       	push   $0x802fa8
+  801681:	e8 00 eb ff ff       	call   800186 <_panic>
+
+00801686 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801686:	55                   	push   %ebp
+  801687:	89 e5                	mov    %esp,%ebp
+  801689:	57                   	push   %edi
+  80168a:	56                   	push   %esi
+  80168b:	53                   	push   %ebx
+  80168c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80168f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801696:	74 22                	je     8016ba <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801698:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169d:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a8:	89 df                	mov    %ebx,%edi
+  8016aa:	89 de                	mov    %ebx,%esi
+  8016ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016ae:	85 c0                	test   %eax,%eax
+  8016b0:	7f 28                	jg     8016da <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b5:	5b                   	pop    %ebx
+  8016b6:	5e                   	pop    %esi
+  8016b7:	5f                   	pop    %edi
+  8016b8:	5d                   	pop    %ebp
+  8016b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016ca:	89 df                	mov    %ebx,%edi
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	8d 35 d7 16 80 00    	lea    0x8016d7,%esi
+  8016d5:	0f 34                	sysenter
+  8016d7:	5d                   	pop    %ebp
+		goto out;
+  8016d8:	eb d4                	jmp    8016ae <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016da:	83 ec 0c             	sub    $0xc,%esp
+  8016dd:	50                   	push   %eax
+  8016de:	6a 12                	push   $0x12
+  8016e0:	68 8b 2f 80 00       	push   $0x802f8b
+  8016e5:	6a 3f                	push   $0x3f
+  8016e7:	68 a8 2f 80 00       	push   $0x802fa8
+  8016ec:	e8 95 ea ff ff       	call   800186 <_panic>
+
+008016f1 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	57                   	push   %edi
+  8016f5:	56                   	push   %esi
+  8016f6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016f7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016fe:	74 1b                	je     80171b <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801700:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801705:	b8 13 00 00 00       	mov    $0x13,%eax
+  80170a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801710:	89 df                	mov    %ebx,%edi
+  801712:	89 de                	mov    %ebx,%esi
+  801714:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801716:	5b                   	pop    %ebx
+  801717:	5e                   	pop    %esi
+  801718:	5f                   	pop    %edi
+  801719:	5d                   	pop    %ebp
+  80171a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80171b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801720:	8b 55 08             	mov    0x8(%ebp),%edx
+  801723:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801726:	b8 13 00 00 00       	mov    $0x13,%eax
+  80172b:	89 df                	mov    %ebx,%edi
+  80172d:	55                   	push   %ebp
+  80172e:	89 e5                	mov    %esp,%ebp
+  801730:	8d 35 38 17 80 00    	lea    0x801738,%esi
+  801736:	0f 34                	sysenter
+  801738:	5d                   	pop    %ebp
+		goto out;
+  801739:	eb db                	jmp    801716 <sys_e1000_receive+0x25>
+
+0080173b <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	57                   	push   %edi
+  80173f:	56                   	push   %esi
+  801740:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801741:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801748:	74 1b                	je     801765 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80174a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801754:	8b 55 08             	mov    0x8(%ebp),%edx
+  801757:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175a:	89 df                	mov    %ebx,%edi
+  80175c:	89 de                	mov    %ebx,%esi
+  80175e:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801760:	5b                   	pop    %ebx
+  801761:	5e                   	pop    %esi
+  801762:	5f                   	pop    %edi
+  801763:	5d                   	pop    %ebp
+  801764:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801765:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801770:	b8 14 00 00 00       	mov    $0x14,%eax
+  801775:	89 df                	mov    %ebx,%edi
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	8d 35 82 17 80 00    	lea    0x801782,%esi
+  801780:	0f 34                	sysenter
+  801782:	5d                   	pop    %ebp
+		goto out;
+  801783:	eb db                	jmp    801760 <sys_e1000_read_hwaddr+0x25>
+
+00801785 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801785:	55                   	push   %ebp
+  801786:	89 e5                	mov    %esp,%ebp
+  801788:	57                   	push   %edi
+  801789:	56                   	push   %esi
+  80178a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80178b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801792:	74 1a                	je     8017ae <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801794:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801799:	b8 15 00 00 00       	mov    $0x15,%eax
+  80179e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a1:	89 cb                	mov    %ecx,%ebx
+  8017a3:	89 cf                	mov    %ecx,%edi
+  8017a5:	89 ce                	mov    %ecx,%esi
+  8017a7:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017a9:	5b                   	pop    %ebx
+  8017aa:	5e                   	pop    %esi
+  8017ab:	5f                   	pop    %edi
+  8017ac:	5d                   	pop    %ebp
+  8017ad:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017bb:	89 cb                	mov    %ecx,%ebx
+  8017bd:	89 cf                	mov    %ecx,%edi
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	8d 35 ca 17 80 00    	lea    0x8017ca,%esi
+  8017c8:	0f 34                	sysenter
+  8017ca:	5d                   	pop    %ebp
+		goto out;
+  8017cb:	eb dc                	jmp    8017a9 <sys_sb16_read_version+0x24>
+
+008017cd <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017cd:	55                   	push   %ebp
+  8017ce:	89 e5                	mov    %esp,%ebp
+  8017d0:	57                   	push   %edi
+  8017d1:	56                   	push   %esi
+  8017d2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017d3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017da:	74 1b                	je     8017f7 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ec:	89 df                	mov    %ebx,%edi
+  8017ee:	89 de                	mov    %ebx,%esi
+  8017f0:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017f2:	5b                   	pop    %ebx
+  8017f3:	5e                   	pop    %esi
+  8017f4:	5f                   	pop    %edi
+  8017f5:	5d                   	pop    %ebp
+  8017f6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801802:	b8 16 00 00 00       	mov    $0x16,%eax
+  801807:	89 df                	mov    %ebx,%edi
+  801809:	55                   	push   %ebp
+  80180a:	89 e5                	mov    %esp,%ebp
+  80180c:	8d 35 14 18 80 00    	lea    0x801814,%esi
+  801812:	0f 34                	sysenter
+  801814:	5d                   	pop    %ebp
+		goto out;
+  801815:	eb db                	jmp    8017f2 <sys_sb16_play+0x25>
+
+00801817 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	56                   	push   %esi
+  80181b:	53                   	push   %ebx
+  80181c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80181f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801822:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801825:	85 c0                	test   %eax,%eax
+  801827:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80182c:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  80182f:	83 ec 08             	sub    $0x8,%esp
+  801832:	ff 75 14             	push   0x14(%ebp)
+  801835:	50                   	push   %eax
+  801836:	e8 77 f9 ff ff       	call   8011b2 <sys_ipc_recv_until>
+  80183b:	83 c4 10             	add    $0x10,%esp
+  80183e:	85 c0                	test   %eax,%eax
+  801840:	78 61                	js     8018a3 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801842:	85 f6                	test   %esi,%esi
+  801844:	74 1c                	je     801862 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801846:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801848:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80184d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801853:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801858:	76 5f                	jbe    8018b9 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  80185a:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801860:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801862:	85 db                	test   %ebx,%ebx
+  801864:	74 1c                	je     801882 <ipc_recv_until+0x6b>
+  801866:	89 e0                	mov    %esp,%eax
+  801868:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80186d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801873:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801878:	76 50                	jbe    8018ca <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80187a:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801880:	89 03                	mov    %eax,(%ebx)
+  801882:	89 e0                	mov    %esp,%eax
+  801884:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801889:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80188f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801894:	76 45                	jbe    8018db <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801896:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80189c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189f:	5b                   	pop    %ebx
+  8018a0:	5e                   	pop    %esi
+  8018a1:	5d                   	pop    %ebp
+  8018a2:	c3                   	ret
+		if (from_env_store)
+  8018a3:	85 f6                	test   %esi,%esi
+  8018a5:	74 06                	je     8018ad <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  8018a7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8018ad:	85 db                	test   %ebx,%ebx
+  8018af:	74 eb                	je     80189c <ipc_recv_until+0x85>
+			*perm_store = 0;
+  8018b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8018b7:	eb e3                	jmp    80189c <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018b9:	c1 e8 10             	shr    $0x10,%eax
+  8018bc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018c2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8018c8:	eb 90                	jmp    80185a <ipc_recv_until+0x43>
+  8018ca:	c1 e8 10             	shr    $0x10,%eax
+  8018cd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018d3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8018d9:	eb 9f                	jmp    80187a <ipc_recv_until+0x63>
+  8018db:	c1 e8 10             	shr    $0x10,%eax
+  8018de:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018e4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8018ea:	eb aa                	jmp    801896 <ipc_recv_until+0x7f>
+
+008018ec <ipc_recv>:
+{
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8018f2:	6a 00                	push   $0x0
+  8018f4:	ff 75 10             	push   0x10(%ebp)
+  8018f7:	ff 75 0c             	push   0xc(%ebp)
+  8018fa:	ff 75 08             	push   0x8(%ebp)
+  8018fd:	e8 15 ff ff ff       	call   801817 <ipc_recv_until>
+}
+  801902:	c9                   	leave
+  801903:	c3                   	ret
+
+00801904 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801904:	55                   	push   %ebp
+  801905:	89 e5                	mov    %esp,%ebp
+  801907:	57                   	push   %edi
+  801908:	56                   	push   %esi
+  801909:	53                   	push   %ebx
+  80190a:	83 ec 0c             	sub    $0xc,%esp
+  80190d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801910:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801913:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801916:	85 db                	test   %ebx,%ebx
+  801918:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80191d:	0f 44 d8             	cmove  %eax,%ebx
+  801920:	eb 05                	jmp    801927 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801922:	e8 34 f4 ff ff       	call   800d5b <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801927:	ff 75 14             	push   0x14(%ebp)
+  80192a:	53                   	push   %ebx
+  80192b:	56                   	push   %esi
+  80192c:	57                   	push   %edi
+  80192d:	e8 cc f7 ff ff       	call   8010fe <sys_ipc_try_send>
+  801932:	83 c4 10             	add    $0x10,%esp
+  801935:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801938:	74 e8                	je     801922 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  80193a:	85 c0                	test   %eax,%eax
+  80193c:	78 08                	js     801946 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  80193e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801941:	5b                   	pop    %ebx
+  801942:	5e                   	pop    %esi
+  801943:	5f                   	pop    %edi
+  801944:	5d                   	pop    %ebp
+  801945:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801946:	50                   	push   %eax
+  801947:	68 b6 2f 80 00       	push   $0x802fb6
+  80194c:	6a 4f                	push   $0x4f
+  80194e:	68 c9 2f 80 00       	push   $0x802fc9
+  801953:	e8 2e e8 ff ff       	call   800186 <_panic>
+
+00801958 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801963:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801969:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80196f:	8b 52 50             	mov    0x50(%edx),%edx
+  801972:	39 ca                	cmp    %ecx,%edx
+  801974:	74 11                	je     801987 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801976:	83 c0 01             	add    $0x1,%eax
+  801979:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80197e:	75 e3                	jne    801963 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801980:	b8 00 00 00 00       	mov    $0x0,%eax
+  801985:	eb 0e                	jmp    801995 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801987:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80198d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801992:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801995:	5d                   	pop    %ebp
+  801996:	c3                   	ret
+
+00801997 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80199a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199d:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019a2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019a5:	5d                   	pop    %ebp
+  8019a6:	c3                   	ret
+
+008019a7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ad:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019b2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019b7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019bc:	5d                   	pop    %ebp
+  8019bd:	c3                   	ret
+
+008019be <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019be:	55                   	push   %ebp
+  8019bf:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8019c1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8019c6:	eb 02                	jmp    8019ca <fd_alloc+0xc>
+  8019c8:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019ca:	89 c2                	mov    %eax,%edx
+  8019cc:	c1 ea 16             	shr    $0x16,%edx
+  8019cf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019d6:	f6 c2 01             	test   $0x1,%dl
+  8019d9:	74 2b                	je     801a06 <fd_alloc+0x48>
+  8019db:	89 c2                	mov    %eax,%edx
+  8019dd:	c1 ea 0c             	shr    $0xc,%edx
+  8019e0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8019e7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8019ed:	f6 c1 01             	test   $0x1,%cl
+  8019f0:	74 14                	je     801a06 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8019f2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8019f8:	75 ce                	jne    8019c8 <fd_alloc+0xa>
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019ff:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a04:	eb 05                	jmp    801a0b <fd_alloc+0x4d>
+			return 0;
+  801a06:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0e:	89 02                	mov    %eax,(%edx)
+}
+  801a10:	89 c8                	mov    %ecx,%eax
+  801a12:	5d                   	pop    %ebp
+  801a13:	c3                   	ret
+
+00801a14 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a14:	55                   	push   %ebp
+  801a15:	89 e5                	mov    %esp,%ebp
+  801a17:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a1a:	83 f8 1f             	cmp    $0x1f,%eax
+  801a1d:	77 30                	ja     801a4f <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a1f:	c1 e0 0c             	shl    $0xc,%eax
+  801a22:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a27:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a2d:	f6 c2 01             	test   $0x1,%dl
+  801a30:	74 24                	je     801a56 <fd_lookup+0x42>
+  801a32:	89 c2                	mov    %eax,%edx
+  801a34:	c1 ea 0c             	shr    $0xc,%edx
+  801a37:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a3e:	f6 c2 01             	test   $0x1,%dl
+  801a41:	74 1a                	je     801a5d <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a43:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a46:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a4d:	5d                   	pop    %ebp
+  801a4e:	c3                   	ret
+		return -E_INVAL;
+  801a4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a54:	eb f7                	jmp    801a4d <fd_lookup+0x39>
+		return -E_INVAL;
+  801a56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a5b:	eb f0                	jmp    801a4d <fd_lookup+0x39>
+  801a5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a62:	eb e9                	jmp    801a4d <fd_lookup+0x39>
+
+00801a64 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a64:	55                   	push   %ebp
+  801a65:	89 e5                	mov    %esp,%ebp
+  801a67:	53                   	push   %ebx
+  801a68:	83 ec 04             	sub    $0x4,%esp
+  801a6b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a73:	eb 03                	jmp    801a78 <dev_lookup+0x14>
+  801a75:	83 c0 01             	add    $0x1,%eax
+  801a78:	8b 1c 85 50 30 80 00 	mov    0x803050(,%eax,4),%ebx
+  801a7f:	85 db                	test   %ebx,%ebx
+  801a81:	74 0b                	je     801a8e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801a83:	39 13                	cmp    %edx,(%ebx)
+  801a85:	75 ee                	jne    801a75 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a8c:	eb 2e                	jmp    801abc <dev_lookup+0x58>
+  801a8e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801a90:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801a95:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801a9b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801aa0:	76 24                	jbe    801ac6 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801aa2:	8b 41 48             	mov    0x48(%ecx),%eax
+  801aa5:	83 ec 04             	sub    $0x4,%esp
+  801aa8:	52                   	push   %edx
+  801aa9:	50                   	push   %eax
+  801aaa:	68 d4 2f 80 00       	push   $0x802fd4
+  801aaf:	e8 ad e7 ff ff       	call   800261 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801ab4:	83 c4 10             	add    $0x10,%esp
+  801ab7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801abc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801abf:	89 1a                	mov    %ebx,(%edx)
+}
+  801ac1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac4:	c9                   	leave
+  801ac5:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ac6:	c1 e8 10             	shr    $0x10,%eax
+  801ac9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801acf:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801ad5:	eb cb                	jmp    801aa2 <dev_lookup+0x3e>
+
+00801ad7 <fd_close>:
+{
+  801ad7:	55                   	push   %ebp
+  801ad8:	89 e5                	mov    %esp,%ebp
+  801ada:	57                   	push   %edi
+  801adb:	56                   	push   %esi
+  801adc:	53                   	push   %ebx
+  801add:	83 ec 24             	sub    $0x24,%esp
+  801ae0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ae3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ae6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ae9:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801aea:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801af0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801af3:	50                   	push   %eax
+  801af4:	e8 1b ff ff ff       	call   801a14 <fd_lookup>
+  801af9:	89 c3                	mov    %eax,%ebx
+  801afb:	83 c4 10             	add    $0x10,%esp
+  801afe:	85 c0                	test   %eax,%eax
+  801b00:	78 05                	js     801b07 <fd_close+0x30>
+	    || fd != fd2)
+  801b02:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b05:	74 16                	je     801b1d <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801b07:	89 f8                	mov    %edi,%eax
+  801b09:	84 c0                	test   %al,%al
+  801b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b10:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b13:	89 d8                	mov    %ebx,%eax
+  801b15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b18:	5b                   	pop    %ebx
+  801b19:	5e                   	pop    %esi
+  801b1a:	5f                   	pop    %edi
+  801b1b:	5d                   	pop    %ebp
+  801b1c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b1d:	83 ec 08             	sub    $0x8,%esp
+  801b20:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b23:	50                   	push   %eax
+  801b24:	ff 36                	push   (%esi)
+  801b26:	e8 39 ff ff ff       	call   801a64 <dev_lookup>
+  801b2b:	89 c3                	mov    %eax,%ebx
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	78 1a                	js     801b4e <fd_close+0x77>
+		if (dev->dev_close)
+  801b34:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b37:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b3f:	85 c0                	test   %eax,%eax
+  801b41:	74 0b                	je     801b4e <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b43:	83 ec 0c             	sub    $0xc,%esp
+  801b46:	56                   	push   %esi
+  801b47:	ff d0                	call   *%eax
+  801b49:	89 c3                	mov    %eax,%ebx
+  801b4b:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b4e:	83 ec 08             	sub    $0x8,%esp
+  801b51:	56                   	push   %esi
+  801b52:	6a 00                	push   $0x0
+  801b54:	e8 23 f3 ff ff       	call   800e7c <sys_page_unmap>
+	return r;
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	eb b5                	jmp    801b13 <fd_close+0x3c>
+
+00801b5e <close>:
+
+int
+close(int fdnum)
+{
+  801b5e:	55                   	push   %ebp
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b67:	50                   	push   %eax
+  801b68:	ff 75 08             	push   0x8(%ebp)
+  801b6b:	e8 a4 fe ff ff       	call   801a14 <fd_lookup>
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	79 02                	jns    801b79 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b77:	c9                   	leave
+  801b78:	c3                   	ret
+		return fd_close(fd, 1);
+  801b79:	83 ec 08             	sub    $0x8,%esp
+  801b7c:	6a 01                	push   $0x1
+  801b7e:	ff 75 f4             	push   -0xc(%ebp)
+  801b81:	e8 51 ff ff ff       	call   801ad7 <fd_close>
+  801b86:	83 c4 10             	add    $0x10,%esp
+  801b89:	eb ec                	jmp    801b77 <close+0x19>
+
+00801b8b <close_all>:
+
+void
+close_all(void)
+{
+  801b8b:	55                   	push   %ebp
+  801b8c:	89 e5                	mov    %esp,%ebp
+  801b8e:	53                   	push   %ebx
+  801b8f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b92:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b97:	83 ec 0c             	sub    $0xc,%esp
+  801b9a:	53                   	push   %ebx
+  801b9b:	e8 be ff ff ff       	call   801b5e <close>
+	for (i = 0; i < MAXFD; i++)
+  801ba0:	83 c3 01             	add    $0x1,%ebx
+  801ba3:	83 c4 10             	add    $0x10,%esp
+  801ba6:	83 fb 20             	cmp    $0x20,%ebx
+  801ba9:	75 ec                	jne    801b97 <close_all+0xc>
+}
+  801bab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bae:	c9                   	leave
+  801baf:	c3                   	ret
+
+00801bb0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801bb0:	55                   	push   %ebp
+  801bb1:	89 e5                	mov    %esp,%ebp
+  801bb3:	57                   	push   %edi
+  801bb4:	56                   	push   %esi
+  801bb5:	53                   	push   %ebx
+  801bb6:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801bb9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bbc:	50                   	push   %eax
+  801bbd:	ff 75 08             	push   0x8(%ebp)
+  801bc0:	e8 4f fe ff ff       	call   801a14 <fd_lookup>
+  801bc5:	89 c3                	mov    %eax,%ebx
+  801bc7:	83 c4 10             	add    $0x10,%esp
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	78 7f                	js     801c4d <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801bce:	83 ec 0c             	sub    $0xc,%esp
+  801bd1:	ff 75 0c             	push   0xc(%ebp)
+  801bd4:	e8 85 ff ff ff       	call   801b5e <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801bd9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bdc:	c1 e6 0c             	shl    $0xc,%esi
+  801bdf:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801be5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801be8:	89 3c 24             	mov    %edi,(%esp)
+  801beb:	e8 b7 fd ff ff       	call   8019a7 <fd2data>
+  801bf0:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801bf2:	89 34 24             	mov    %esi,(%esp)
+  801bf5:	e8 ad fd ff ff       	call   8019a7 <fd2data>
+  801bfa:	83 c4 10             	add    $0x10,%esp
+  801bfd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801c00:	89 d8                	mov    %ebx,%eax
+  801c02:	c1 e8 16             	shr    $0x16,%eax
+  801c05:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c0c:	a8 01                	test   $0x1,%al
+  801c0e:	74 11                	je     801c21 <dup+0x71>
+  801c10:	89 d8                	mov    %ebx,%eax
+  801c12:	c1 e8 0c             	shr    $0xc,%eax
+  801c15:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c1c:	f6 c2 01             	test   $0x1,%dl
+  801c1f:	75 36                	jne    801c57 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c21:	89 f8                	mov    %edi,%eax
+  801c23:	c1 e8 0c             	shr    $0xc,%eax
+  801c26:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c2d:	83 ec 0c             	sub    $0xc,%esp
+  801c30:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c35:	50                   	push   %eax
+  801c36:	56                   	push   %esi
+  801c37:	6a 00                	push   $0x0
+  801c39:	57                   	push   %edi
+  801c3a:	6a 00                	push   $0x0
+  801c3c:	e8 cd f1 ff ff       	call   800e0e <sys_page_map>
+  801c41:	89 c3                	mov    %eax,%ebx
+  801c43:	83 c4 20             	add    $0x20,%esp
+  801c46:	85 c0                	test   %eax,%eax
+  801c48:	78 33                	js     801c7d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c4a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c4d:	89 d8                	mov    %ebx,%eax
+  801c4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c52:	5b                   	pop    %ebx
+  801c53:	5e                   	pop    %esi
+  801c54:	5f                   	pop    %edi
+  801c55:	5d                   	pop    %ebp
+  801c56:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c57:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c5e:	83 ec 0c             	sub    $0xc,%esp
+  801c61:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c66:	50                   	push   %eax
+  801c67:	ff 75 d4             	push   -0x2c(%ebp)
+  801c6a:	6a 00                	push   $0x0
+  801c6c:	53                   	push   %ebx
+  801c6d:	6a 00                	push   $0x0
+  801c6f:	e8 9a f1 ff ff       	call   800e0e <sys_page_map>
+  801c74:	89 c3                	mov    %eax,%ebx
+  801c76:	83 c4 20             	add    $0x20,%esp
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	79 a4                	jns    801c21 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c7d:	83 ec 08             	sub    $0x8,%esp
+  801c80:	56                   	push   %esi
+  801c81:	6a 00                	push   $0x0
+  801c83:	e8 f4 f1 ff ff       	call   800e7c <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c88:	83 c4 08             	add    $0x8,%esp
+  801c8b:	ff 75 d4             	push   -0x2c(%ebp)
+  801c8e:	6a 00                	push   $0x0
+  801c90:	e8 e7 f1 ff ff       	call   800e7c <sys_page_unmap>
+	return r;
+  801c95:	83 c4 10             	add    $0x10,%esp
+  801c98:	eb b3                	jmp    801c4d <dup+0x9d>
+
+00801c9a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	56                   	push   %esi
+  801c9e:	53                   	push   %ebx
+  801c9f:	83 ec 18             	sub    $0x18,%esp
+  801ca2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ca5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca8:	50                   	push   %eax
+  801ca9:	53                   	push   %ebx
+  801caa:	e8 65 fd ff ff       	call   801a14 <fd_lookup>
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	85 c0                	test   %eax,%eax
+  801cb4:	78 3c                	js     801cf2 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cb6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cb9:	83 ec 08             	sub    $0x8,%esp
+  801cbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbf:	50                   	push   %eax
+  801cc0:	ff 36                	push   (%esi)
+  801cc2:	e8 9d fd ff ff       	call   801a64 <dev_lookup>
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	78 24                	js     801cf2 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cce:	8b 46 08             	mov    0x8(%esi),%eax
+  801cd1:	83 e0 03             	and    $0x3,%eax
+  801cd4:	83 f8 01             	cmp    $0x1,%eax
+  801cd7:	74 20                	je     801cf9 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801cd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cdc:	8b 40 08             	mov    0x8(%eax),%eax
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	74 57                	je     801d3a <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ce3:	83 ec 04             	sub    $0x4,%esp
+  801ce6:	ff 75 10             	push   0x10(%ebp)
+  801ce9:	ff 75 0c             	push   0xc(%ebp)
+  801cec:	56                   	push   %esi
+  801ced:	ff d0                	call   *%eax
+  801cef:	83 c4 10             	add    $0x10,%esp
+}
+  801cf2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf5:	5b                   	pop    %ebx
+  801cf6:	5e                   	pop    %esi
+  801cf7:	5d                   	pop    %ebp
+  801cf8:	c3                   	ret
+  801cf9:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cfb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d00:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d06:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d0b:	76 1c                	jbe    801d29 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d0d:	8b 42 48             	mov    0x48(%edx),%eax
+  801d10:	83 ec 04             	sub    $0x4,%esp
+  801d13:	53                   	push   %ebx
+  801d14:	50                   	push   %eax
+  801d15:	68 15 30 80 00       	push   $0x803015
+  801d1a:	e8 42 e5 ff ff       	call   800261 <cprintf>
+		return -E_INVAL;
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d27:	eb c9                	jmp    801cf2 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d29:	c1 e8 10             	shr    $0x10,%eax
+  801d2c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d32:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d38:	eb d3                	jmp    801d0d <read+0x73>
+		return -E_NOT_SUPP;
+  801d3a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d3f:	eb b1                	jmp    801cf2 <read+0x58>
+
+00801d41 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	57                   	push   %edi
+  801d45:	56                   	push   %esi
+  801d46:	53                   	push   %ebx
+  801d47:	83 ec 0c             	sub    $0xc,%esp
+  801d4a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d4d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d55:	eb 02                	jmp    801d59 <readn+0x18>
+  801d57:	01 c3                	add    %eax,%ebx
+  801d59:	39 f3                	cmp    %esi,%ebx
+  801d5b:	73 21                	jae    801d7e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d5d:	83 ec 04             	sub    $0x4,%esp
+  801d60:	89 f0                	mov    %esi,%eax
+  801d62:	29 d8                	sub    %ebx,%eax
+  801d64:	50                   	push   %eax
+  801d65:	89 d8                	mov    %ebx,%eax
+  801d67:	03 45 0c             	add    0xc(%ebp),%eax
+  801d6a:	50                   	push   %eax
+  801d6b:	57                   	push   %edi
+  801d6c:	e8 29 ff ff ff       	call   801c9a <read>
+		if (m < 0)
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	78 04                	js     801d7c <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d78:	75 dd                	jne    801d57 <readn+0x16>
+  801d7a:	eb 02                	jmp    801d7e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d7c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d7e:	89 d8                	mov    %ebx,%eax
+  801d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d83:	5b                   	pop    %ebx
+  801d84:	5e                   	pop    %esi
+  801d85:	5f                   	pop    %edi
+  801d86:	5d                   	pop    %ebp
+  801d87:	c3                   	ret
+
+00801d88 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d88:	55                   	push   %ebp
+  801d89:	89 e5                	mov    %esp,%ebp
+  801d8b:	56                   	push   %esi
+  801d8c:	53                   	push   %ebx
+  801d8d:	83 ec 18             	sub    $0x18,%esp
+  801d90:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d93:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d96:	50                   	push   %eax
+  801d97:	53                   	push   %ebx
+  801d98:	e8 77 fc ff ff       	call   801a14 <fd_lookup>
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	78 37                	js     801ddb <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801da4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801da7:	83 ec 08             	sub    $0x8,%esp
+  801daa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dad:	50                   	push   %eax
+  801dae:	ff 36                	push   (%esi)
+  801db0:	e8 af fc ff ff       	call   801a64 <dev_lookup>
+  801db5:	83 c4 10             	add    $0x10,%esp
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 1f                	js     801ddb <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dbc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dc0:	74 20                	je     801de2 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801dc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dc8:	85 c0                	test   %eax,%eax
+  801dca:	74 57                	je     801e23 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801dcc:	83 ec 04             	sub    $0x4,%esp
+  801dcf:	ff 75 10             	push   0x10(%ebp)
+  801dd2:	ff 75 0c             	push   0xc(%ebp)
+  801dd5:	56                   	push   %esi
+  801dd6:	ff d0                	call   *%eax
+  801dd8:	83 c4 10             	add    $0x10,%esp
+}
+  801ddb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dde:	5b                   	pop    %ebx
+  801ddf:	5e                   	pop    %esi
+  801de0:	5d                   	pop    %ebp
+  801de1:	c3                   	ret
+  801de2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801de4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801de9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801def:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801df4:	76 1c                	jbe    801e12 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df6:	8b 42 48             	mov    0x48(%edx),%eax
+  801df9:	83 ec 04             	sub    $0x4,%esp
+  801dfc:	53                   	push   %ebx
+  801dfd:	50                   	push   %eax
+  801dfe:	68 31 30 80 00       	push   $0x803031
+  801e03:	e8 59 e4 ff ff       	call   800261 <cprintf>
+		return -E_INVAL;
+  801e08:	83 c4 10             	add    $0x10,%esp
+  801e0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e10:	eb c9                	jmp    801ddb <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e12:	c1 e8 10             	shr    $0x10,%eax
+  801e15:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e1b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e21:	eb d3                	jmp    801df6 <write+0x6e>
+		return -E_NOT_SUPP;
+  801e23:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e28:	eb b1                	jmp    801ddb <write+0x53>
+
+00801e2a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e33:	50                   	push   %eax
+  801e34:	ff 75 08             	push   0x8(%ebp)
+  801e37:	e8 d8 fb ff ff       	call   801a14 <fd_lookup>
+  801e3c:	83 c4 10             	add    $0x10,%esp
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	78 0e                	js     801e51 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e43:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e49:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e51:	c9                   	leave
+  801e52:	c3                   	ret
+
+00801e53 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e53:	55                   	push   %ebp
+  801e54:	89 e5                	mov    %esp,%ebp
+  801e56:	56                   	push   %esi
+  801e57:	53                   	push   %ebx
+  801e58:	83 ec 18             	sub    $0x18,%esp
+  801e5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e5e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e61:	50                   	push   %eax
+  801e62:	53                   	push   %ebx
+  801e63:	e8 ac fb ff ff       	call   801a14 <fd_lookup>
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 34                	js     801ea3 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e6f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e72:	83 ec 08             	sub    $0x8,%esp
+  801e75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e78:	50                   	push   %eax
+  801e79:	ff 36                	push   (%esi)
+  801e7b:	e8 e4 fb ff ff       	call   801a64 <dev_lookup>
+  801e80:	83 c4 10             	add    $0x10,%esp
+  801e83:	85 c0                	test   %eax,%eax
+  801e85:	78 1c                	js     801ea3 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e87:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e8b:	74 1d                	je     801eaa <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e90:	8b 40 18             	mov    0x18(%eax),%eax
+  801e93:	85 c0                	test   %eax,%eax
+  801e95:	74 54                	je     801eeb <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e97:	83 ec 08             	sub    $0x8,%esp
+  801e9a:	ff 75 0c             	push   0xc(%ebp)
+  801e9d:	56                   	push   %esi
+  801e9e:	ff d0                	call   *%eax
+  801ea0:	83 c4 10             	add    $0x10,%esp
+}
+  801ea3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea6:	5b                   	pop    %ebx
+  801ea7:	5e                   	pop    %esi
+  801ea8:	5d                   	pop    %ebp
+  801ea9:	c3                   	ret
+  801eaa:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801eac:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801eb1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801eb7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ebc:	76 1c                	jbe    801eda <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801ebe:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ec1:	83 ec 04             	sub    $0x4,%esp
+  801ec4:	53                   	push   %ebx
+  801ec5:	50                   	push   %eax
+  801ec6:	68 f4 2f 80 00       	push   $0x802ff4
+  801ecb:	e8 91 e3 ff ff       	call   800261 <cprintf>
+		return -E_INVAL;
+  801ed0:	83 c4 10             	add    $0x10,%esp
+  801ed3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed8:	eb c9                	jmp    801ea3 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801eda:	c1 e8 10             	shr    $0x10,%eax
+  801edd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ee3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ee9:	eb d3                	jmp    801ebe <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801eeb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ef0:	eb b1                	jmp    801ea3 <ftruncate+0x50>
+
+00801ef2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ef2:	55                   	push   %ebp
+  801ef3:	89 e5                	mov    %esp,%ebp
+  801ef5:	56                   	push   %esi
+  801ef6:	53                   	push   %ebx
+  801ef7:	83 ec 18             	sub    $0x18,%esp
+  801efa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801efd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f00:	50                   	push   %eax
+  801f01:	ff 75 08             	push   0x8(%ebp)
+  801f04:	e8 0b fb ff ff       	call   801a14 <fd_lookup>
+  801f09:	83 c4 10             	add    $0x10,%esp
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	78 49                	js     801f59 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f10:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f13:	83 ec 08             	sub    $0x8,%esp
+  801f16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f19:	50                   	push   %eax
+  801f1a:	ff 36                	push   (%esi)
+  801f1c:	e8 43 fb ff ff       	call   801a64 <dev_lookup>
+  801f21:	83 c4 10             	add    $0x10,%esp
+  801f24:	85 c0                	test   %eax,%eax
+  801f26:	78 31                	js     801f59 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f2b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f2f:	74 2f                	je     801f60 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f31:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f34:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f3b:	00 00 00 
+	stat->st_isdir = 0;
+  801f3e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f45:	00 00 00 
+	stat->st_dev = dev;
+  801f48:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f4e:	83 ec 08             	sub    $0x8,%esp
+  801f51:	53                   	push   %ebx
+  801f52:	56                   	push   %esi
+  801f53:	ff 50 14             	call   *0x14(%eax)
+  801f56:	83 c4 10             	add    $0x10,%esp
+}
+  801f59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5c:	5b                   	pop    %ebx
+  801f5d:	5e                   	pop    %esi
+  801f5e:	5d                   	pop    %ebp
+  801f5f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f60:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f65:	eb f2                	jmp    801f59 <fstat+0x67>
+
+00801f67 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f67:	55                   	push   %ebp
+  801f68:	89 e5                	mov    %esp,%ebp
+  801f6a:	56                   	push   %esi
+  801f6b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f6c:	83 ec 08             	sub    $0x8,%esp
+  801f6f:	6a 00                	push   $0x0
+  801f71:	ff 75 08             	push   0x8(%ebp)
+  801f74:	e8 e4 01 00 00       	call   80215d <open>
+  801f79:	89 c3                	mov    %eax,%ebx
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  801f7e:	85 c0                	test   %eax,%eax
+  801f80:	78 1b                	js     801f9d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f82:	83 ec 08             	sub    $0x8,%esp
+  801f85:	ff 75 0c             	push   0xc(%ebp)
+  801f88:	50                   	push   %eax
+  801f89:	e8 64 ff ff ff       	call   801ef2 <fstat>
+  801f8e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f90:	89 1c 24             	mov    %ebx,(%esp)
+  801f93:	e8 c6 fb ff ff       	call   801b5e <close>
+	return r;
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	89 f3                	mov    %esi,%ebx
+}
+  801f9d:	89 d8                	mov    %ebx,%eax
+  801f9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa2:	5b                   	pop    %ebx
+  801fa3:	5e                   	pop    %esi
+  801fa4:	5d                   	pop    %ebp
+  801fa5:	c3                   	ret
+
+00801fa6 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801fa6:	55                   	push   %ebp
+  801fa7:	89 e5                	mov    %esp,%ebp
+  801fa9:	56                   	push   %esi
+  801faa:	53                   	push   %ebx
+  801fab:	89 c6                	mov    %eax,%esi
+  801fad:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801faf:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801fb6:	74 27                	je     801fdf <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801fb8:	6a 07                	push   $0x7
+  801fba:	68 00 60 80 00       	push   $0x806000
+  801fbf:	56                   	push   %esi
+  801fc0:	ff 35 00 50 80 00    	push   0x805000
+  801fc6:	e8 39 f9 ff ff       	call   801904 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801fcb:	83 c4 0c             	add    $0xc,%esp
+  801fce:	6a 00                	push   $0x0
+  801fd0:	53                   	push   %ebx
+  801fd1:	6a 00                	push   $0x0
+  801fd3:	e8 14 f9 ff ff       	call   8018ec <ipc_recv>
+}
+  801fd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fdb:	5b                   	pop    %ebx
+  801fdc:	5e                   	pop    %esi
+  801fdd:	5d                   	pop    %ebp
+  801fde:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fdf:	83 ec 0c             	sub    $0xc,%esp
+  801fe2:	6a 01                	push   $0x1
+  801fe4:	e8 6f f9 ff ff       	call   801958 <ipc_find_env>
+  801fe9:	a3 00 50 80 00       	mov    %eax,0x805000
+  801fee:	83 c4 10             	add    $0x10,%esp
+  801ff1:	eb c5                	jmp    801fb8 <fsipc+0x12>
+
+00801ff3 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ff3:	55                   	push   %ebp
+  801ff4:	89 e5                	mov    %esp,%ebp
+  801ff6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ff9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fff:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802004:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802007:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80200c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802011:	b8 02 00 00 00       	mov    $0x2,%eax
+  802016:	e8 8b ff ff ff       	call   801fa6 <fsipc>
+}
+  80201b:	c9                   	leave
+  80201c:	c3                   	ret
+
+0080201d <devfile_flush>:
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802023:	8b 45 08             	mov    0x8(%ebp),%eax
+  802026:	8b 40 0c             	mov    0xc(%eax),%eax
+  802029:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80202e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802033:	b8 06 00 00 00       	mov    $0x6,%eax
+  802038:	e8 69 ff ff ff       	call   801fa6 <fsipc>
+}
+  80203d:	c9                   	leave
+  80203e:	c3                   	ret
+
+0080203f <devfile_stat>:
+{
+  80203f:	55                   	push   %ebp
+  802040:	89 e5                	mov    %esp,%ebp
+  802042:	53                   	push   %ebx
+  802043:	83 ec 04             	sub    $0x4,%esp
+  802046:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802049:	8b 45 08             	mov    0x8(%ebp),%eax
+  80204c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80204f:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802054:	ba 00 00 00 00       	mov    $0x0,%edx
+  802059:	b8 05 00 00 00       	mov    $0x5,%eax
+  80205e:	e8 43 ff ff ff       	call   801fa6 <fsipc>
+  802063:	85 c0                	test   %eax,%eax
+  802065:	78 2c                	js     802093 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802067:	83 ec 08             	sub    $0x8,%esp
+  80206a:	68 00 60 80 00       	push   $0x806000
+  80206f:	53                   	push   %ebx
+  802070:	e8 34 e8 ff ff       	call   8008a9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802075:	a1 80 60 80 00       	mov    0x806080,%eax
+  80207a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802080:	a1 84 60 80 00       	mov    0x806084,%eax
+  802085:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80208b:	83 c4 10             	add    $0x10,%esp
+  80208e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802093:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802096:	c9                   	leave
+  802097:	c3                   	ret
+
+00802098 <devfile_write>:
+{
+  802098:	55                   	push   %ebp
+  802099:	89 e5                	mov    %esp,%ebp
+  80209b:	83 ec 0c             	sub    $0xc,%esp
+  80209e:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020a4:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020a7:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8020ad:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8020b2:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8020b7:	39 d0                	cmp    %edx,%eax
+  8020b9:	0f 47 c2             	cmova  %edx,%eax
+  8020bc:	50                   	push   %eax
+  8020bd:	ff 75 0c             	push   0xc(%ebp)
+  8020c0:	68 08 60 80 00       	push   $0x806008
+  8020c5:	e8 65 e9 ff ff       	call   800a2f <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8020ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020cf:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020d4:	e8 cd fe ff ff       	call   801fa6 <fsipc>
+}
+  8020d9:	c9                   	leave
+  8020da:	c3                   	ret
+
+008020db <devfile_read>:
+{
+  8020db:	55                   	push   %ebp
+  8020dc:	89 e5                	mov    %esp,%ebp
+  8020de:	56                   	push   %esi
+  8020df:	53                   	push   %ebx
+  8020e0:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020e9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8020ee:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020fe:	e8 a3 fe ff ff       	call   801fa6 <fsipc>
+  802103:	89 c3                	mov    %eax,%ebx
+  802105:	85 c0                	test   %eax,%eax
+  802107:	78 1f                	js     802128 <devfile_read+0x4d>
+	assert(r <= n);
+  802109:	39 c6                	cmp    %eax,%esi
+  80210b:	72 24                	jb     802131 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80210d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802112:	7f 33                	jg     802147 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802114:	83 ec 04             	sub    $0x4,%esp
+  802117:	50                   	push   %eax
+  802118:	68 00 60 80 00       	push   $0x806000
+  80211d:	ff 75 0c             	push   0xc(%ebp)
+  802120:	e8 0a e9 ff ff       	call   800a2f <memmove>
+	return r;
+  802125:	83 c4 10             	add    $0x10,%esp
+}
+  802128:	89 d8                	mov    %ebx,%eax
+  80212a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80212d:	5b                   	pop    %ebx
+  80212e:	5e                   	pop    %esi
+  80212f:	5d                   	pop    %ebp
+  802130:	c3                   	ret
+	assert(r <= n);
+  802131:	68 64 30 80 00       	push   $0x803064
+  802136:	68 6b 30 80 00       	push   $0x80306b
+  80213b:	6a 76                	push   $0x76
+  80213d:	68 80 30 80 00       	push   $0x803080
+  802142:	e8 3f e0 ff ff       	call   800186 <_panic>
+	assert(r <= PGSIZE);
+  802147:	68 8b 30 80 00       	push   $0x80308b
+  80214c:	68 6b 30 80 00       	push   $0x80306b
+  802151:	6a 77                	push   $0x77
+  802153:	68 80 30 80 00       	push   $0x803080
+  802158:	e8 29 e0 ff ff       	call   800186 <_panic>
+
+0080215d <open>:
+{
+  80215d:	55                   	push   %ebp
+  80215e:	89 e5                	mov    %esp,%ebp
+  802160:	56                   	push   %esi
+  802161:	53                   	push   %ebx
+  802162:	83 ec 1c             	sub    $0x1c,%esp
+  802165:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802168:	56                   	push   %esi
+  802169:	e8 00 e7 ff ff       	call   80086e <strlen>
+  80216e:	83 c4 10             	add    $0x10,%esp
+  802171:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802176:	7f 6c                	jg     8021e4 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802178:	83 ec 0c             	sub    $0xc,%esp
+  80217b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80217e:	50                   	push   %eax
+  80217f:	e8 3a f8 ff ff       	call   8019be <fd_alloc>
+  802184:	89 c3                	mov    %eax,%ebx
+  802186:	83 c4 10             	add    $0x10,%esp
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	78 3c                	js     8021c9 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80218d:	83 ec 08             	sub    $0x8,%esp
+  802190:	56                   	push   %esi
+  802191:	68 00 60 80 00       	push   $0x806000
+  802196:	e8 0e e7 ff ff       	call   8008a9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80219b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80219e:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ab:	e8 f6 fd ff ff       	call   801fa6 <fsipc>
+  8021b0:	89 c3                	mov    %eax,%ebx
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	78 19                	js     8021d2 <open+0x75>
+	return fd2num(fd);
+  8021b9:	83 ec 0c             	sub    $0xc,%esp
+  8021bc:	ff 75 f4             	push   -0xc(%ebp)
+  8021bf:	e8 d3 f7 ff ff       	call   801997 <fd2num>
+  8021c4:	89 c3                	mov    %eax,%ebx
+  8021c6:	83 c4 10             	add    $0x10,%esp
+}
+  8021c9:	89 d8                	mov    %ebx,%eax
+  8021cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ce:	5b                   	pop    %ebx
+  8021cf:	5e                   	pop    %esi
+  8021d0:	5d                   	pop    %ebp
+  8021d1:	c3                   	ret
+		fd_close(fd, 0);
+  8021d2:	83 ec 08             	sub    $0x8,%esp
+  8021d5:	6a 00                	push   $0x0
+  8021d7:	ff 75 f4             	push   -0xc(%ebp)
+  8021da:	e8 f8 f8 ff ff       	call   801ad7 <fd_close>
+		return r;
+  8021df:	83 c4 10             	add    $0x10,%esp
+  8021e2:	eb e5                	jmp    8021c9 <open+0x6c>
+		return -E_BAD_PATH;
+  8021e4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021e9:	eb de                	jmp    8021c9 <open+0x6c>
+
+008021eb <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8021eb:	55                   	push   %ebp
+  8021ec:	89 e5                	mov    %esp,%ebp
+  8021ee:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8021f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021fb:	e8 a6 fd ff ff       	call   801fa6 <fsipc>
+}
+  802200:	c9                   	leave
+  802201:	c3                   	ret
+
+00802202 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802208:	68 97 30 80 00       	push   $0x803097
+  80220d:	ff 75 0c             	push   0xc(%ebp)
+  802210:	e8 94 e6 ff ff       	call   8008a9 <strcpy>
+	return 0;
+}
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221a:	c9                   	leave
+  80221b:	c3                   	ret
+
+0080221c <devsock_close>:
+{
+  80221c:	55                   	push   %ebp
+  80221d:	89 e5                	mov    %esp,%ebp
+  80221f:	53                   	push   %ebx
+  802220:	83 ec 10             	sub    $0x10,%esp
+  802223:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802226:	53                   	push   %ebx
+  802227:	e8 64 09 00 00       	call   802b90 <pageref>
+  80222c:	89 c2                	mov    %eax,%edx
+  80222e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802231:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802236:	83 fa 01             	cmp    $0x1,%edx
+  802239:	74 05                	je     802240 <devsock_close+0x24>
+}
+  80223b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223e:	c9                   	leave
+  80223f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802240:	83 ec 0c             	sub    $0xc,%esp
+  802243:	ff 73 0c             	push   0xc(%ebx)
+  802246:	e8 b7 02 00 00       	call   802502 <nsipc_close>
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	eb eb                	jmp    80223b <devsock_close+0x1f>
+
+00802250 <devsock_write>:
+{
+  802250:	55                   	push   %ebp
+  802251:	89 e5                	mov    %esp,%ebp
+  802253:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802256:	6a 00                	push   $0x0
+  802258:	ff 75 10             	push   0x10(%ebp)
+  80225b:	ff 75 0c             	push   0xc(%ebp)
+  80225e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802261:	ff 70 0c             	push   0xc(%eax)
+  802264:	e8 79 03 00 00       	call   8025e2 <nsipc_send>
+}
+  802269:	c9                   	leave
+  80226a:	c3                   	ret
+
+0080226b <devsock_read>:
+{
+  80226b:	55                   	push   %ebp
+  80226c:	89 e5                	mov    %esp,%ebp
+  80226e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802271:	6a 00                	push   $0x0
+  802273:	ff 75 10             	push   0x10(%ebp)
+  802276:	ff 75 0c             	push   0xc(%ebp)
+  802279:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227c:	ff 70 0c             	push   0xc(%eax)
+  80227f:	e8 ef 02 00 00       	call   802573 <nsipc_recv>
+}
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+
+00802286 <fd2sockid>:
+{
+  802286:	55                   	push   %ebp
+  802287:	89 e5                	mov    %esp,%ebp
+  802289:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80228c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80228f:	52                   	push   %edx
+  802290:	50                   	push   %eax
+  802291:	e8 7e f7 ff ff       	call   801a14 <fd_lookup>
+  802296:	83 c4 10             	add    $0x10,%esp
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	78 10                	js     8022ad <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80229d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a0:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022a6:	39 08                	cmp    %ecx,(%eax)
+  8022a8:	75 05                	jne    8022af <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8022aa:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022af:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022b4:	eb f7                	jmp    8022ad <fd2sockid+0x27>
+
+008022b6 <alloc_sockfd>:
+{
+  8022b6:	55                   	push   %ebp
+  8022b7:	89 e5                	mov    %esp,%ebp
+  8022b9:	56                   	push   %esi
+  8022ba:	53                   	push   %ebx
+  8022bb:	83 ec 1c             	sub    $0x1c,%esp
+  8022be:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8022c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c3:	50                   	push   %eax
+  8022c4:	e8 f5 f6 ff ff       	call   8019be <fd_alloc>
+  8022c9:	89 c3                	mov    %eax,%ebx
+  8022cb:	83 c4 10             	add    $0x10,%esp
+  8022ce:	85 c0                	test   %eax,%eax
+  8022d0:	78 43                	js     802315 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8022d2:	83 ec 04             	sub    $0x4,%esp
+  8022d5:	68 07 04 00 00       	push   $0x407
+  8022da:	ff 75 f4             	push   -0xc(%ebp)
+  8022dd:	6a 00                	push   $0x0
+  8022df:	e8 bd ea ff ff       	call   800da1 <sys_page_alloc>
+  8022e4:	89 c3                	mov    %eax,%ebx
+  8022e6:	83 c4 10             	add    $0x10,%esp
+  8022e9:	85 c0                	test   %eax,%eax
+  8022eb:	78 28                	js     802315 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8022ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f0:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8022f6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8022f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022fb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802302:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802305:	83 ec 0c             	sub    $0xc,%esp
+  802308:	50                   	push   %eax
+  802309:	e8 89 f6 ff ff       	call   801997 <fd2num>
+  80230e:	89 c3                	mov    %eax,%ebx
+  802310:	83 c4 10             	add    $0x10,%esp
+  802313:	eb 0c                	jmp    802321 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802315:	83 ec 0c             	sub    $0xc,%esp
+  802318:	56                   	push   %esi
+  802319:	e8 e4 01 00 00       	call   802502 <nsipc_close>
+		return r;
+  80231e:	83 c4 10             	add    $0x10,%esp
+}
+  802321:	89 d8                	mov    %ebx,%eax
+  802323:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802326:	5b                   	pop    %ebx
+  802327:	5e                   	pop    %esi
+  802328:	5d                   	pop    %ebp
+  802329:	c3                   	ret
+
+0080232a <accept>:
+{
+  80232a:	55                   	push   %ebp
+  80232b:	89 e5                	mov    %esp,%ebp
+  80232d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802330:	8b 45 08             	mov    0x8(%ebp),%eax
+  802333:	e8 4e ff ff ff       	call   802286 <fd2sockid>
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	78 1b                	js     802357 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80233c:	83 ec 04             	sub    $0x4,%esp
+  80233f:	ff 75 10             	push   0x10(%ebp)
+  802342:	ff 75 0c             	push   0xc(%ebp)
+  802345:	50                   	push   %eax
+  802346:	e8 0e 01 00 00       	call   802459 <nsipc_accept>
+  80234b:	83 c4 10             	add    $0x10,%esp
+  80234e:	85 c0                	test   %eax,%eax
+  802350:	78 05                	js     802357 <accept+0x2d>
+	return alloc_sockfd(r);
+  802352:	e8 5f ff ff ff       	call   8022b6 <alloc_sockfd>
+}
+  802357:	c9                   	leave
+  802358:	c3                   	ret
+
+00802359 <bind>:
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80235f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802362:	e8 1f ff ff ff       	call   802286 <fd2sockid>
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 12                	js     80237d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80236b:	83 ec 04             	sub    $0x4,%esp
+  80236e:	ff 75 10             	push   0x10(%ebp)
+  802371:	ff 75 0c             	push   0xc(%ebp)
+  802374:	50                   	push   %eax
+  802375:	e8 31 01 00 00       	call   8024ab <nsipc_bind>
+  80237a:	83 c4 10             	add    $0x10,%esp
+}
+  80237d:	c9                   	leave
+  80237e:	c3                   	ret
+
+0080237f <shutdown>:
+{
+  80237f:	55                   	push   %ebp
+  802380:	89 e5                	mov    %esp,%ebp
+  802382:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802385:	8b 45 08             	mov    0x8(%ebp),%eax
+  802388:	e8 f9 fe ff ff       	call   802286 <fd2sockid>
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	78 0f                	js     8023a0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802391:	83 ec 08             	sub    $0x8,%esp
+  802394:	ff 75 0c             	push   0xc(%ebp)
+  802397:	50                   	push   %eax
+  802398:	e8 43 01 00 00       	call   8024e0 <nsipc_shutdown>
+  80239d:	83 c4 10             	add    $0x10,%esp
+}
+  8023a0:	c9                   	leave
+  8023a1:	c3                   	ret
+
+008023a2 <connect>:
+{
+  8023a2:	55                   	push   %ebp
+  8023a3:	89 e5                	mov    %esp,%ebp
+  8023a5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ab:	e8 d6 fe ff ff       	call   802286 <fd2sockid>
+  8023b0:	85 c0                	test   %eax,%eax
+  8023b2:	78 12                	js     8023c6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8023b4:	83 ec 04             	sub    $0x4,%esp
+  8023b7:	ff 75 10             	push   0x10(%ebp)
+  8023ba:	ff 75 0c             	push   0xc(%ebp)
+  8023bd:	50                   	push   %eax
+  8023be:	e8 59 01 00 00       	call   80251c <nsipc_connect>
+  8023c3:	83 c4 10             	add    $0x10,%esp
+}
+  8023c6:	c9                   	leave
+  8023c7:	c3                   	ret
+
+008023c8 <listen>:
+{
+  8023c8:	55                   	push   %ebp
+  8023c9:	89 e5                	mov    %esp,%ebp
+  8023cb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d1:	e8 b0 fe ff ff       	call   802286 <fd2sockid>
+  8023d6:	85 c0                	test   %eax,%eax
+  8023d8:	78 0f                	js     8023e9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8023da:	83 ec 08             	sub    $0x8,%esp
+  8023dd:	ff 75 0c             	push   0xc(%ebp)
+  8023e0:	50                   	push   %eax
+  8023e1:	e8 6b 01 00 00       	call   802551 <nsipc_listen>
+  8023e6:	83 c4 10             	add    $0x10,%esp
+}
+  8023e9:	c9                   	leave
+  8023ea:	c3                   	ret
+
+008023eb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8023eb:	55                   	push   %ebp
+  8023ec:	89 e5                	mov    %esp,%ebp
+  8023ee:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8023f1:	ff 75 10             	push   0x10(%ebp)
+  8023f4:	ff 75 0c             	push   0xc(%ebp)
+  8023f7:	ff 75 08             	push   0x8(%ebp)
+  8023fa:	e8 41 02 00 00       	call   802640 <nsipc_socket>
+  8023ff:	83 c4 10             	add    $0x10,%esp
+  802402:	85 c0                	test   %eax,%eax
+  802404:	78 05                	js     80240b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802406:	e8 ab fe ff ff       	call   8022b6 <alloc_sockfd>
+}
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+
+0080240d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80240d:	55                   	push   %ebp
+  80240e:	89 e5                	mov    %esp,%ebp
+  802410:	53                   	push   %ebx
+  802411:	83 ec 04             	sub    $0x4,%esp
+  802414:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802416:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80241d:	74 26                	je     802445 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80241f:	6a 07                	push   $0x7
+  802421:	68 00 70 80 00       	push   $0x807000
+  802426:	53                   	push   %ebx
+  802427:	ff 35 04 50 80 00    	push   0x805004
+  80242d:	e8 d2 f4 ff ff       	call   801904 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802432:	83 c4 0c             	add    $0xc,%esp
+  802435:	6a 00                	push   $0x0
+  802437:	6a 00                	push   $0x0
+  802439:	6a 00                	push   $0x0
+  80243b:	e8 ac f4 ff ff       	call   8018ec <ipc_recv>
+}
+  802440:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802443:	c9                   	leave
+  802444:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802445:	83 ec 0c             	sub    $0xc,%esp
+  802448:	6a 02                	push   $0x2
+  80244a:	e8 09 f5 ff ff       	call   801958 <ipc_find_env>
+  80244f:	a3 04 50 80 00       	mov    %eax,0x805004
+  802454:	83 c4 10             	add    $0x10,%esp
+  802457:	eb c6                	jmp    80241f <nsipc+0x12>
+
+00802459 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802459:	55                   	push   %ebp
+  80245a:	89 e5                	mov    %esp,%ebp
+  80245c:	56                   	push   %esi
+  80245d:	53                   	push   %ebx
+  80245e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802461:	8b 45 08             	mov    0x8(%ebp),%eax
+  802464:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802469:	8b 06                	mov    (%esi),%eax
+  80246b:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802470:	b8 01 00 00 00       	mov    $0x1,%eax
+  802475:	e8 93 ff ff ff       	call   80240d <nsipc>
+  80247a:	89 c3                	mov    %eax,%ebx
+  80247c:	85 c0                	test   %eax,%eax
+  80247e:	79 09                	jns    802489 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802480:	89 d8                	mov    %ebx,%eax
+  802482:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802485:	5b                   	pop    %ebx
+  802486:	5e                   	pop    %esi
+  802487:	5d                   	pop    %ebp
+  802488:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802489:	83 ec 04             	sub    $0x4,%esp
+  80248c:	ff 35 10 70 80 00    	push   0x807010
+  802492:	68 00 70 80 00       	push   $0x807000
+  802497:	ff 75 0c             	push   0xc(%ebp)
+  80249a:	e8 90 e5 ff ff       	call   800a2f <memmove>
+		*addrlen = ret->ret_addrlen;
+  80249f:	a1 10 70 80 00       	mov    0x807010,%eax
+  8024a4:	89 06                	mov    %eax,(%esi)
+  8024a6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8024a9:	eb d5                	jmp    802480 <nsipc_accept+0x27>
+
+008024ab <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8024ab:	55                   	push   %ebp
+  8024ac:	89 e5                	mov    %esp,%ebp
+  8024ae:	53                   	push   %ebx
+  8024af:	83 ec 08             	sub    $0x8,%esp
+  8024b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8024b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b8:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8024bd:	53                   	push   %ebx
+  8024be:	ff 75 0c             	push   0xc(%ebp)
+  8024c1:	68 04 70 80 00       	push   $0x807004
+  8024c6:	e8 64 e5 ff ff       	call   800a2f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8024cb:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8024d1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024d6:	e8 32 ff ff ff       	call   80240d <nsipc>
+}
+  8024db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024de:	c9                   	leave
+  8024df:	c3                   	ret
+
+008024e0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8024e0:	55                   	push   %ebp
+  8024e1:	89 e5                	mov    %esp,%ebp
+  8024e3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8024e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8024ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024f1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8024f6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024fb:	e8 0d ff ff ff       	call   80240d <nsipc>
+}
+  802500:	c9                   	leave
+  802501:	c3                   	ret
+
+00802502 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802502:	55                   	push   %ebp
+  802503:	89 e5                	mov    %esp,%ebp
+  802505:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802508:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250b:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802510:	b8 04 00 00 00       	mov    $0x4,%eax
+  802515:	e8 f3 fe ff ff       	call   80240d <nsipc>
+}
+  80251a:	c9                   	leave
+  80251b:	c3                   	ret
+
+0080251c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80251c:	55                   	push   %ebp
+  80251d:	89 e5                	mov    %esp,%ebp
+  80251f:	53                   	push   %ebx
+  802520:	83 ec 08             	sub    $0x8,%esp
+  802523:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802526:	8b 45 08             	mov    0x8(%ebp),%eax
+  802529:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80252e:	53                   	push   %ebx
+  80252f:	ff 75 0c             	push   0xc(%ebp)
+  802532:	68 04 70 80 00       	push   $0x807004
+  802537:	e8 f3 e4 ff ff       	call   800a2f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80253c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802542:	b8 05 00 00 00       	mov    $0x5,%eax
+  802547:	e8 c1 fe ff ff       	call   80240d <nsipc>
+}
+  80254c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80254f:	c9                   	leave
+  802550:	c3                   	ret
+
+00802551 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802551:	55                   	push   %ebp
+  802552:	89 e5                	mov    %esp,%ebp
+  802554:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802557:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80255f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802562:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802567:	b8 06 00 00 00       	mov    $0x6,%eax
+  80256c:	e8 9c fe ff ff       	call   80240d <nsipc>
+}
+  802571:	c9                   	leave
+  802572:	c3                   	ret
+
+00802573 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802573:	55                   	push   %ebp
+  802574:	89 e5                	mov    %esp,%ebp
+  802576:	56                   	push   %esi
+  802577:	53                   	push   %ebx
+  802578:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80257b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802583:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80258c:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802591:	b8 07 00 00 00       	mov    $0x7,%eax
+  802596:	e8 72 fe ff ff       	call   80240d <nsipc>
+  80259b:	89 c3                	mov    %eax,%ebx
+  80259d:	85 c0                	test   %eax,%eax
+  80259f:	78 22                	js     8025c3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8025a1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8025a6:	39 c6                	cmp    %eax,%esi
+  8025a8:	0f 4e c6             	cmovle %esi,%eax
+  8025ab:	39 c3                	cmp    %eax,%ebx
+  8025ad:	7f 1d                	jg     8025cc <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8025af:	83 ec 04             	sub    $0x4,%esp
+  8025b2:	53                   	push   %ebx
+  8025b3:	68 00 70 80 00       	push   $0x807000
+  8025b8:	ff 75 0c             	push   0xc(%ebp)
+  8025bb:	e8 6f e4 ff ff       	call   800a2f <memmove>
+  8025c0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8025c3:	89 d8                	mov    %ebx,%eax
+  8025c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c8:	5b                   	pop    %ebx
+  8025c9:	5e                   	pop    %esi
+  8025ca:	5d                   	pop    %ebp
+  8025cb:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8025cc:	68 a3 30 80 00       	push   $0x8030a3
+  8025d1:	68 6b 30 80 00       	push   $0x80306b
+  8025d6:	6a 62                	push   $0x62
+  8025d8:	68 b8 30 80 00       	push   $0x8030b8
+  8025dd:	e8 a4 db ff ff       	call   800186 <_panic>
+
+008025e2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	53                   	push   %ebx
+  8025e6:	83 ec 04             	sub    $0x4,%esp
+  8025e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8025ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ef:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8025f4:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8025fa:	7f 2e                	jg     80262a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8025fc:	83 ec 04             	sub    $0x4,%esp
+  8025ff:	53                   	push   %ebx
+  802600:	ff 75 0c             	push   0xc(%ebp)
+  802603:	68 0c 70 80 00       	push   $0x80700c
+  802608:	e8 22 e4 ff ff       	call   800a2f <memmove>
+	nsipcbuf.send.req_size = size;
+  80260d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802613:	8b 45 14             	mov    0x14(%ebp),%eax
+  802616:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80261b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802620:	e8 e8 fd ff ff       	call   80240d <nsipc>
+}
+  802625:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802628:	c9                   	leave
+  802629:	c3                   	ret
+	assert(size < 1600);
+  80262a:	68 c4 30 80 00       	push   $0x8030c4
+  80262f:	68 6b 30 80 00       	push   $0x80306b
+  802634:	6a 6d                	push   $0x6d
+  802636:	68 b8 30 80 00       	push   $0x8030b8
+  80263b:	e8 46 db ff ff       	call   800186 <_panic>
+
+00802640 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802640:	55                   	push   %ebp
+  802641:	89 e5                	mov    %esp,%ebp
+  802643:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802646:	8b 45 08             	mov    0x8(%ebp),%eax
+  802649:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80264e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802651:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802656:	8b 45 10             	mov    0x10(%ebp),%eax
+  802659:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80265e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802663:	e8 a5 fd ff ff       	call   80240d <nsipc>
+}
+  802668:	c9                   	leave
+  802669:	c3                   	ret
+
+0080266a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80266a:	55                   	push   %ebp
+  80266b:	89 e5                	mov    %esp,%ebp
+  80266d:	56                   	push   %esi
+  80266e:	53                   	push   %ebx
+  80266f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802672:	83 ec 0c             	sub    $0xc,%esp
+  802675:	ff 75 08             	push   0x8(%ebp)
+  802678:	e8 2a f3 ff ff       	call   8019a7 <fd2data>
+  80267d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80267f:	83 c4 08             	add    $0x8,%esp
+  802682:	68 d0 30 80 00       	push   $0x8030d0
+  802687:	53                   	push   %ebx
+  802688:	e8 1c e2 ff ff       	call   8008a9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80268d:	8b 46 04             	mov    0x4(%esi),%eax
+  802690:	2b 06                	sub    (%esi),%eax
+  802692:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802698:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80269f:	00 00 00 
+	stat->st_dev = &devpipe;
+  8026a2:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8026a9:	40 80 00 
+	return 0;
+}
+  8026ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b4:	5b                   	pop    %ebx
+  8026b5:	5e                   	pop    %esi
+  8026b6:	5d                   	pop    %ebp
+  8026b7:	c3                   	ret
+
+008026b8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8026b8:	55                   	push   %ebp
+  8026b9:	89 e5                	mov    %esp,%ebp
+  8026bb:	53                   	push   %ebx
+  8026bc:	83 ec 0c             	sub    $0xc,%esp
+  8026bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8026c2:	53                   	push   %ebx
+  8026c3:	6a 00                	push   $0x0
+  8026c5:	e8 b2 e7 ff ff       	call   800e7c <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8026ca:	89 1c 24             	mov    %ebx,(%esp)
+  8026cd:	e8 d5 f2 ff ff       	call   8019a7 <fd2data>
+  8026d2:	83 c4 08             	add    $0x8,%esp
+  8026d5:	50                   	push   %eax
+  8026d6:	6a 00                	push   $0x0
+  8026d8:	e8 9f e7 ff ff       	call   800e7c <sys_page_unmap>
+}
+  8026dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026e0:	c9                   	leave
+  8026e1:	c3                   	ret
+
+008026e2 <_pipeisclosed>:
+{
+  8026e2:	55                   	push   %ebp
+  8026e3:	89 e5                	mov    %esp,%ebp
+  8026e5:	57                   	push   %edi
+  8026e6:	56                   	push   %esi
+  8026e7:	53                   	push   %ebx
+  8026e8:	83 ec 1c             	sub    $0x1c,%esp
+  8026eb:	89 c7                	mov    %eax,%edi
+  8026ed:	89 d6                	mov    %edx,%esi
+  8026ef:	eb 3c                	jmp    80272d <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8026f1:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8026f4:	83 ec 0c             	sub    $0xc,%esp
+  8026f7:	57                   	push   %edi
+  8026f8:	e8 93 04 00 00       	call   802b90 <pageref>
+  8026fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802700:	89 34 24             	mov    %esi,(%esp)
+  802703:	e8 88 04 00 00       	call   802b90 <pageref>
+  802708:	89 c2                	mov    %eax,%edx
+  80270a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80270c:	05 00 00 00 20       	add    $0x20000000,%eax
+  802711:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802714:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80271a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80271f:	76 31                	jbe    802752 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802721:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802724:	39 c3                	cmp    %eax,%ebx
+  802726:	74 76                	je     80279e <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802728:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80272b:	74 36                	je     802763 <_pipeisclosed+0x81>
+  80272d:	89 e0                	mov    %esp,%eax
+  80272f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802734:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80273a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80273f:	77 b0                	ja     8026f1 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802741:	c1 e8 10             	shr    $0x10,%eax
+  802744:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80274a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802750:	eb 9f                	jmp    8026f1 <_pipeisclosed+0xf>
+  802752:	c1 e8 10             	shr    $0x10,%eax
+  802755:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80275b:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802761:	eb be                	jmp    802721 <_pipeisclosed+0x3f>
+  802763:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802765:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80276a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802770:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802775:	76 16                	jbe    80278d <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802777:	8b 42 58             	mov    0x58(%edx),%eax
+  80277a:	6a 01                	push   $0x1
+  80277c:	50                   	push   %eax
+  80277d:	53                   	push   %ebx
+  80277e:	68 d7 30 80 00       	push   $0x8030d7
+  802783:	e8 d9 da ff ff       	call   800261 <cprintf>
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	eb a0                	jmp    80272d <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80278d:	c1 e8 10             	shr    $0x10,%eax
+  802790:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802796:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80279c:	eb d9                	jmp    802777 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80279e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8027a1:	0f 94 c0             	sete   %al
+  8027a4:	0f b6 c0             	movzbl %al,%eax
+}
+  8027a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027aa:	5b                   	pop    %ebx
+  8027ab:	5e                   	pop    %esi
+  8027ac:	5f                   	pop    %edi
+  8027ad:	5d                   	pop    %ebp
+  8027ae:	c3                   	ret
+
+008027af <devpipe_write>:
+{
+  8027af:	55                   	push   %ebp
+  8027b0:	89 e5                	mov    %esp,%ebp
+  8027b2:	57                   	push   %edi
+  8027b3:	56                   	push   %esi
+  8027b4:	53                   	push   %ebx
+  8027b5:	83 ec 28             	sub    $0x28,%esp
+  8027b8:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8027bb:	56                   	push   %esi
+  8027bc:	e8 e6 f1 ff ff       	call   8019a7 <fd2data>
+  8027c1:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8027c3:	83 c4 10             	add    $0x10,%esp
+  8027c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027cb:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027ce:	75 09                	jne    8027d9 <devpipe_write+0x2a>
+	return i;
+  8027d0:	89 f8                	mov    %edi,%eax
+  8027d2:	eb 23                	jmp    8027f7 <devpipe_write+0x48>
+			sys_yield();
+  8027d4:	e8 82 e5 ff ff       	call   800d5b <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8027d9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027dc:	8b 0b                	mov    (%ebx),%ecx
+  8027de:	8d 51 20             	lea    0x20(%ecx),%edx
+  8027e1:	39 d0                	cmp    %edx,%eax
+  8027e3:	72 1a                	jb     8027ff <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8027e5:	89 da                	mov    %ebx,%edx
+  8027e7:	89 f0                	mov    %esi,%eax
+  8027e9:	e8 f4 fe ff ff       	call   8026e2 <_pipeisclosed>
+  8027ee:	85 c0                	test   %eax,%eax
+  8027f0:	74 e2                	je     8027d4 <devpipe_write+0x25>
+				return 0;
+  8027f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027fa:	5b                   	pop    %ebx
+  8027fb:	5e                   	pop    %esi
+  8027fc:	5f                   	pop    %edi
+  8027fd:	5d                   	pop    %ebp
+  8027fe:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8027ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802802:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802806:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802809:	89 c2                	mov    %eax,%edx
+  80280b:	c1 fa 1f             	sar    $0x1f,%edx
+  80280e:	89 d1                	mov    %edx,%ecx
+  802810:	c1 e9 1b             	shr    $0x1b,%ecx
+  802813:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802816:	83 e2 1f             	and    $0x1f,%edx
+  802819:	29 ca                	sub    %ecx,%edx
+  80281b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80281f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802823:	83 c0 01             	add    $0x1,%eax
+  802826:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802829:	83 c7 01             	add    $0x1,%edi
+  80282c:	eb 9d                	jmp    8027cb <devpipe_write+0x1c>
+
+0080282e <devpipe_read>:
+{
+  80282e:	55                   	push   %ebp
+  80282f:	89 e5                	mov    %esp,%ebp
+  802831:	57                   	push   %edi
+  802832:	56                   	push   %esi
+  802833:	53                   	push   %ebx
+  802834:	83 ec 18             	sub    $0x18,%esp
+  802837:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80283a:	57                   	push   %edi
+  80283b:	e8 67 f1 ff ff       	call   8019a7 <fd2data>
+  802840:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802842:	83 c4 10             	add    $0x10,%esp
+  802845:	be 00 00 00 00       	mov    $0x0,%esi
+  80284a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80284d:	75 13                	jne    802862 <devpipe_read+0x34>
+	return i;
+  80284f:	89 f0                	mov    %esi,%eax
+  802851:	eb 02                	jmp    802855 <devpipe_read+0x27>
+				return i;
+  802853:	89 f0                	mov    %esi,%eax
+}
+  802855:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802858:	5b                   	pop    %ebx
+  802859:	5e                   	pop    %esi
+  80285a:	5f                   	pop    %edi
+  80285b:	5d                   	pop    %ebp
+  80285c:	c3                   	ret
+			sys_yield();
+  80285d:	e8 f9 e4 ff ff       	call   800d5b <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802862:	8b 03                	mov    (%ebx),%eax
+  802864:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802867:	75 18                	jne    802881 <devpipe_read+0x53>
+			if (i > 0)
+  802869:	85 f6                	test   %esi,%esi
+  80286b:	75 e6                	jne    802853 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80286d:	89 da                	mov    %ebx,%edx
+  80286f:	89 f8                	mov    %edi,%eax
+  802871:	e8 6c fe ff ff       	call   8026e2 <_pipeisclosed>
+  802876:	85 c0                	test   %eax,%eax
+  802878:	74 e3                	je     80285d <devpipe_read+0x2f>
+				return 0;
+  80287a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287f:	eb d4                	jmp    802855 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802881:	99                   	cltd
+  802882:	c1 ea 1b             	shr    $0x1b,%edx
+  802885:	01 d0                	add    %edx,%eax
+  802887:	83 e0 1f             	and    $0x1f,%eax
+  80288a:	29 d0                	sub    %edx,%eax
+  80288c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802891:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802894:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802897:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80289a:	83 c6 01             	add    $0x1,%esi
+  80289d:	eb ab                	jmp    80284a <devpipe_read+0x1c>
+
+0080289f <pipe>:
+{
+  80289f:	55                   	push   %ebp
+  8028a0:	89 e5                	mov    %esp,%ebp
+  8028a2:	56                   	push   %esi
+  8028a3:	53                   	push   %ebx
+  8028a4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8028a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028aa:	50                   	push   %eax
+  8028ab:	e8 0e f1 ff ff       	call   8019be <fd_alloc>
+  8028b0:	89 c3                	mov    %eax,%ebx
+  8028b2:	83 c4 10             	add    $0x10,%esp
+  8028b5:	85 c0                	test   %eax,%eax
+  8028b7:	0f 88 23 01 00 00    	js     8029e0 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028bd:	83 ec 04             	sub    $0x4,%esp
+  8028c0:	68 07 04 00 00       	push   $0x407
+  8028c5:	ff 75 f4             	push   -0xc(%ebp)
+  8028c8:	6a 00                	push   $0x0
+  8028ca:	e8 d2 e4 ff ff       	call   800da1 <sys_page_alloc>
+  8028cf:	89 c3                	mov    %eax,%ebx
+  8028d1:	83 c4 10             	add    $0x10,%esp
+  8028d4:	85 c0                	test   %eax,%eax
+  8028d6:	0f 88 04 01 00 00    	js     8029e0 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8028dc:	83 ec 0c             	sub    $0xc,%esp
+  8028df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8028e2:	50                   	push   %eax
+  8028e3:	e8 d6 f0 ff ff       	call   8019be <fd_alloc>
+  8028e8:	89 c3                	mov    %eax,%ebx
+  8028ea:	83 c4 10             	add    $0x10,%esp
+  8028ed:	85 c0                	test   %eax,%eax
+  8028ef:	0f 88 db 00 00 00    	js     8029d0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028f5:	83 ec 04             	sub    $0x4,%esp
+  8028f8:	68 07 04 00 00       	push   $0x407
+  8028fd:	ff 75 f0             	push   -0x10(%ebp)
+  802900:	6a 00                	push   $0x0
+  802902:	e8 9a e4 ff ff       	call   800da1 <sys_page_alloc>
+  802907:	89 c3                	mov    %eax,%ebx
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	0f 88 bc 00 00 00    	js     8029d0 <pipe+0x131>
+	va = fd2data(fd0);
+  802914:	83 ec 0c             	sub    $0xc,%esp
+  802917:	ff 75 f4             	push   -0xc(%ebp)
+  80291a:	e8 88 f0 ff ff       	call   8019a7 <fd2data>
+  80291f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802921:	83 c4 0c             	add    $0xc,%esp
+  802924:	68 07 04 00 00       	push   $0x407
+  802929:	50                   	push   %eax
+  80292a:	6a 00                	push   $0x0
+  80292c:	e8 70 e4 ff ff       	call   800da1 <sys_page_alloc>
+  802931:	89 c3                	mov    %eax,%ebx
+  802933:	83 c4 10             	add    $0x10,%esp
+  802936:	85 c0                	test   %eax,%eax
+  802938:	0f 88 82 00 00 00    	js     8029c0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80293e:	83 ec 0c             	sub    $0xc,%esp
+  802941:	ff 75 f0             	push   -0x10(%ebp)
+  802944:	e8 5e f0 ff ff       	call   8019a7 <fd2data>
+  802949:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802950:	50                   	push   %eax
+  802951:	6a 00                	push   $0x0
+  802953:	56                   	push   %esi
+  802954:	6a 00                	push   $0x0
+  802956:	e8 b3 e4 ff ff       	call   800e0e <sys_page_map>
+  80295b:	89 c3                	mov    %eax,%ebx
+  80295d:	83 c4 20             	add    $0x20,%esp
+  802960:	85 c0                	test   %eax,%eax
+  802962:	78 4e                	js     8029b2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802964:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802969:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80296c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80296e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802971:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802978:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80297b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80297d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802980:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802987:	83 ec 0c             	sub    $0xc,%esp
+  80298a:	ff 75 f4             	push   -0xc(%ebp)
+  80298d:	e8 05 f0 ff ff       	call   801997 <fd2num>
+  802992:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802995:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802997:	83 c4 04             	add    $0x4,%esp
+  80299a:	ff 75 f0             	push   -0x10(%ebp)
+  80299d:	e8 f5 ef ff ff       	call   801997 <fd2num>
+  8029a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029a5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8029a8:	83 c4 10             	add    $0x10,%esp
+  8029ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029b0:	eb 2e                	jmp    8029e0 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8029b2:	83 ec 08             	sub    $0x8,%esp
+  8029b5:	56                   	push   %esi
+  8029b6:	6a 00                	push   $0x0
+  8029b8:	e8 bf e4 ff ff       	call   800e7c <sys_page_unmap>
+  8029bd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8029c0:	83 ec 08             	sub    $0x8,%esp
+  8029c3:	ff 75 f0             	push   -0x10(%ebp)
+  8029c6:	6a 00                	push   $0x0
+  8029c8:	e8 af e4 ff ff       	call   800e7c <sys_page_unmap>
+  8029cd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8029d0:	83 ec 08             	sub    $0x8,%esp
+  8029d3:	ff 75 f4             	push   -0xc(%ebp)
+  8029d6:	6a 00                	push   $0x0
+  8029d8:	e8 9f e4 ff ff       	call   800e7c <sys_page_unmap>
+  8029dd:	83 c4 10             	add    $0x10,%esp
+}
+  8029e0:	89 d8                	mov    %ebx,%eax
+  8029e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029e5:	5b                   	pop    %ebx
+  8029e6:	5e                   	pop    %esi
+  8029e7:	5d                   	pop    %ebp
+  8029e8:	c3                   	ret
+
+008029e9 <pipeisclosed>:
+{
+  8029e9:	55                   	push   %ebp
+  8029ea:	89 e5                	mov    %esp,%ebp
+  8029ec:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029f2:	50                   	push   %eax
+  8029f3:	ff 75 08             	push   0x8(%ebp)
+  8029f6:	e8 19 f0 ff ff       	call   801a14 <fd_lookup>
+  8029fb:	83 c4 10             	add    $0x10,%esp
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	78 18                	js     802a1a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802a02:	83 ec 0c             	sub    $0xc,%esp
+  802a05:	ff 75 f4             	push   -0xc(%ebp)
+  802a08:	e8 9a ef ff ff       	call   8019a7 <fd2data>
+  802a0d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802a0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a12:	e8 cb fc ff ff       	call   8026e2 <_pipeisclosed>
+  802a17:	83 c4 10             	add    $0x10,%esp
+}
+  802a1a:	c9                   	leave
+  802a1b:	c3                   	ret
+
+00802a1c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a21:	c3                   	ret
+
+00802a22 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a22:	55                   	push   %ebp
+  802a23:	89 e5                	mov    %esp,%ebp
+  802a25:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802a28:	68 ef 30 80 00       	push   $0x8030ef
+  802a2d:	ff 75 0c             	push   0xc(%ebp)
+  802a30:	e8 74 de ff ff       	call   8008a9 <strcpy>
+	return 0;
+}
+  802a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+
+00802a3c <devcons_write>:
+{
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	57                   	push   %edi
+  802a40:	56                   	push   %esi
+  802a41:	53                   	push   %ebx
+  802a42:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802a48:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802a4d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802a53:	eb 2e                	jmp    802a83 <devcons_write+0x47>
+		m = n - tot;
+  802a55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a58:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802a5a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a5f:	39 c3                	cmp    %eax,%ebx
+  802a61:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802a64:	83 ec 04             	sub    $0x4,%esp
+  802a67:	53                   	push   %ebx
+  802a68:	89 f0                	mov    %esi,%eax
+  802a6a:	03 45 0c             	add    0xc(%ebp),%eax
+  802a6d:	50                   	push   %eax
+  802a6e:	57                   	push   %edi
+  802a6f:	e8 bb df ff ff       	call   800a2f <memmove>
+		sys_cputs(buf, m);
+  802a74:	83 c4 08             	add    $0x8,%esp
+  802a77:	53                   	push   %ebx
+  802a78:	57                   	push   %edi
+  802a79:	e8 a4 e1 ff ff       	call   800c22 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802a7e:	01 de                	add    %ebx,%esi
+  802a80:	83 c4 10             	add    $0x10,%esp
+  802a83:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a86:	72 cd                	jb     802a55 <devcons_write+0x19>
+}
+  802a88:	89 f0                	mov    %esi,%eax
+  802a8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a8d:	5b                   	pop    %ebx
+  802a8e:	5e                   	pop    %esi
+  802a8f:	5f                   	pop    %edi
+  802a90:	5d                   	pop    %ebp
+  802a91:	c3                   	ret
+
+00802a92 <devcons_read>:
+{
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802a98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802aa1:	75 07                	jne    802aaa <devcons_read+0x18>
+  802aa3:	eb 1f                	jmp    802ac4 <devcons_read+0x32>
+		sys_yield();
+  802aa5:	e8 b1 e2 ff ff       	call   800d5b <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802aaa:	e8 b7 e1 ff ff       	call   800c66 <sys_cgetc>
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	74 f2                	je     802aa5 <devcons_read+0x13>
+	if (c < 0)
+  802ab3:	78 0f                	js     802ac4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802ab5:	83 f8 04             	cmp    $0x4,%eax
+  802ab8:	74 0c                	je     802ac6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802aba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802abd:	88 02                	mov    %al,(%edx)
+	return 1;
+  802abf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802ac4:	c9                   	leave
+  802ac5:	c3                   	ret
+		return 0;
+  802ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802acb:	eb f7                	jmp    802ac4 <devcons_read+0x32>
+
+00802acd <cputchar>:
+{
+  802acd:	55                   	push   %ebp
+  802ace:	89 e5                	mov    %esp,%ebp
+  802ad0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802ad3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802ad9:	6a 01                	push   $0x1
+  802adb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ade:	50                   	push   %eax
+  802adf:	e8 3e e1 ff ff       	call   800c22 <sys_cputs>
+}
+  802ae4:	83 c4 10             	add    $0x10,%esp
+  802ae7:	c9                   	leave
+  802ae8:	c3                   	ret
+
+00802ae9 <getchar>:
+{
+  802ae9:	55                   	push   %ebp
+  802aea:	89 e5                	mov    %esp,%ebp
+  802aec:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802aef:	6a 01                	push   $0x1
+  802af1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802af4:	50                   	push   %eax
+  802af5:	6a 00                	push   $0x0
+  802af7:	e8 9e f1 ff ff       	call   801c9a <read>
+	if (r < 0)
+  802afc:	83 c4 10             	add    $0x10,%esp
+  802aff:	85 c0                	test   %eax,%eax
+  802b01:	78 06                	js     802b09 <getchar+0x20>
+	if (r < 1)
+  802b03:	74 06                	je     802b0b <getchar+0x22>
+	return c;
+  802b05:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802b09:	c9                   	leave
+  802b0a:	c3                   	ret
+		return -E_EOF;
+  802b0b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802b10:	eb f7                	jmp    802b09 <getchar+0x20>
+
+00802b12 <iscons>:
+{
+  802b12:	55                   	push   %ebp
+  802b13:	89 e5                	mov    %esp,%ebp
+  802b15:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b18:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b1b:	50                   	push   %eax
+  802b1c:	ff 75 08             	push   0x8(%ebp)
+  802b1f:	e8 f0 ee ff ff       	call   801a14 <fd_lookup>
+  802b24:	83 c4 10             	add    $0x10,%esp
+  802b27:	85 c0                	test   %eax,%eax
+  802b29:	78 11                	js     802b3c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b2e:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b34:	39 10                	cmp    %edx,(%eax)
+  802b36:	0f 94 c0             	sete   %al
+  802b39:	0f b6 c0             	movzbl %al,%eax
+}
+  802b3c:	c9                   	leave
+  802b3d:	c3                   	ret
+
+00802b3e <opencons>:
+{
+  802b3e:	55                   	push   %ebp
+  802b3f:	89 e5                	mov    %esp,%ebp
+  802b41:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802b44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b47:	50                   	push   %eax
+  802b48:	e8 71 ee ff ff       	call   8019be <fd_alloc>
+  802b4d:	83 c4 10             	add    $0x10,%esp
+  802b50:	85 c0                	test   %eax,%eax
+  802b52:	78 3a                	js     802b8e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802b54:	83 ec 04             	sub    $0x4,%esp
+  802b57:	68 07 04 00 00       	push   $0x407
+  802b5c:	ff 75 f4             	push   -0xc(%ebp)
+  802b5f:	6a 00                	push   $0x0
+  802b61:	e8 3b e2 ff ff       	call   800da1 <sys_page_alloc>
+  802b66:	83 c4 10             	add    $0x10,%esp
+  802b69:	85 c0                	test   %eax,%eax
+  802b6b:	78 21                	js     802b8e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b70:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b76:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b7b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802b82:	83 ec 0c             	sub    $0xc,%esp
+  802b85:	50                   	push   %eax
+  802b86:	e8 0c ee ff ff       	call   801997 <fd2num>
+  802b8b:	83 c4 10             	add    $0x10,%esp
+}
+  802b8e:	c9                   	leave
+  802b8f:	c3                   	ret
+
+00802b90 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b90:	55                   	push   %ebp
+  802b91:	89 e5                	mov    %esp,%ebp
+  802b93:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b96:	89 c2                	mov    %eax,%edx
+  802b98:	c1 ea 16             	shr    $0x16,%edx
+  802b9b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802ba2:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802ba7:	f6 c1 01             	test   $0x1,%cl
+  802baa:	74 1a                	je     802bc6 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802bac:	c1 e8 0c             	shr    $0xc,%eax
+  802baf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802bb6:	a8 01                	test   $0x1,%al
+  802bb8:	74 0c                	je     802bc6 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802bba:	c1 e8 0c             	shr    $0xc,%eax
+  802bbd:	c1 e0 04             	shl    $0x4,%eax
+  802bc0:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802bc6:	89 d0                	mov    %edx,%eax
+  802bc8:	5d                   	pop    %ebp
+  802bc9:	c3                   	ret
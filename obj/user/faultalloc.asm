@@ -0,0 +1,6328 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 80 2c 80 00       	push   $0x802c80
+  800045:	e8 1f 02 00 00       	call   800269 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 4b 0d 00 00       	call   800da9 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 cc 2c 80 00       	push   $0x802ccc
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 e9 07 00 00       	call   80085c <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 a0 2c 80 00       	push   $0x802ca0
+  800085:	6a 0e                	push   $0xe
+  800087:	68 8a 2c 80 00       	push   $0x802c8a
+  80008c:	e8 fd 00 00 00       	call   80018e <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 7e 17 00 00       	call   80181f <set_pgfault_handler>
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 9c 2c 80 00       	push   $0x802c9c
+  8000ae:	e8 b6 01 00 00       	call   800269 <cprintf>
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 9c 2c 80 00       	push   $0x802c9c
+  8000c0:	e8 a4 01 00 00       	call   800269 <cprintf>
+}
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	57                   	push   %edi
+  8000ce:	56                   	push   %esi
+  8000cf:	53                   	push   %ebx
+  8000d0:	83 ec 0c             	sub    $0xc,%esp
+  8000d3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000de:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000e0:	c1 ea 0b             	shr    $0xb,%edx
+  8000e3:	83 f2 01             	xor    $0x1,%edx
+  8000e6:	83 e2 01             	and    $0x1,%edx
+  8000e9:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000ef:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000f6:	00 00 00 
+	envid = sys_getenvid();
+  8000f9:	e8 1f 0c 00 00       	call   800d1d <sys_getenvid>
+  8000fe:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800105:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80010b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800111:	8b 52 48             	mov    0x48(%edx),%edx
+  800114:	39 ca                	cmp    %ecx,%edx
+  800116:	74 27                	je     80013f <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800118:	83 c0 01             	add    $0x1,%eax
+  80011b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800120:	75 e3                	jne    800105 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800122:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800129:	75 24                	jne    80014f <libmain+0x85>
+		panic("libmain can't find the environment");
+  80012b:	83 ec 04             	sub    $0x4,%esp
+  80012e:	68 f0 2c 80 00       	push   $0x802cf0
+  800133:	6a 23                	push   $0x23
+  800135:	68 13 2d 80 00       	push   $0x802d13
+  80013a:	e8 4f 00 00 00       	call   80018e <_panic>
+			mainenv = &envs[i];
+  80013f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800145:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80014a:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80014f:	85 ff                	test   %edi,%edi
+  800151:	7e 07                	jle    80015a <libmain+0x90>
+		binaryname = argv[0];
+  800153:	8b 06                	mov    (%esi),%eax
+  800155:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80015a:	83 ec 08             	sub    $0x8,%esp
+  80015d:	56                   	push   %esi
+  80015e:	57                   	push   %edi
+  80015f:	e8 2d ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  800164:	e8 0b 00 00 00       	call   800174 <exit>
+}
+  800169:	83 c4 10             	add    $0x10,%esp
+  80016c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80016f:	5b                   	pop    %ebx
+  800170:	5e                   	pop    %esi
+  800171:	5f                   	pop    %edi
+  800172:	5d                   	pop    %ebp
+  800173:	c3                   	ret
+
+00800174 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80017a:	e8 23 19 00 00       	call   801aa2 <close_all>
+	sys_env_destroy(0);
+  80017f:	83 ec 0c             	sub    $0xc,%esp
+  800182:	6a 00                	push   $0x0
+  800184:	e8 2b 0b 00 00       	call   800cb4 <sys_env_destroy>
+}
+  800189:	83 c4 10             	add    $0x10,%esp
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+
+0080018e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80018e:	55                   	push   %ebp
+  80018f:	89 e5                	mov    %esp,%ebp
+  800191:	56                   	push   %esi
+  800192:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800193:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800196:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80019c:	e8 7c 0b 00 00       	call   800d1d <sys_getenvid>
+  8001a1:	83 ec 0c             	sub    $0xc,%esp
+  8001a4:	ff 75 0c             	push   0xc(%ebp)
+  8001a7:	ff 75 08             	push   0x8(%ebp)
+  8001aa:	56                   	push   %esi
+  8001ab:	50                   	push   %eax
+  8001ac:	68 2c 2d 80 00       	push   $0x802d2c
+  8001b1:	e8 b3 00 00 00       	call   800269 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001b6:	83 c4 18             	add    $0x18,%esp
+  8001b9:	53                   	push   %ebx
+  8001ba:	ff 75 10             	push   0x10(%ebp)
+  8001bd:	e8 56 00 00 00       	call   800218 <vcprintf>
+	cprintf("\n");
+  8001c2:	c7 04 24 e0 31 80 00 	movl   $0x8031e0,(%esp)
+  8001c9:	e8 9b 00 00 00       	call   800269 <cprintf>
+  8001ce:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001d1:	cc                   	int3
+	while (1)
+  8001d2:	eb fd                	jmp    8001d1 <_panic+0x43>
+
+008001d4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001d4:	55                   	push   %ebp
+  8001d5:	89 e5                	mov    %esp,%ebp
+  8001d7:	53                   	push   %ebx
+  8001d8:	83 ec 04             	sub    $0x4,%esp
+  8001db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001de:	8b 13                	mov    (%ebx),%edx
+  8001e0:	8d 42 01             	lea    0x1(%edx),%eax
+  8001e3:	89 03                	mov    %eax,(%ebx)
+  8001e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001e8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ec:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001f1:	74 09                	je     8001fc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001f3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001fa:	c9                   	leave
+  8001fb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001fc:	83 ec 08             	sub    $0x8,%esp
+  8001ff:	68 ff 00 00 00       	push   $0xff
+  800204:	8d 43 08             	lea    0x8(%ebx),%eax
+  800207:	50                   	push   %eax
+  800208:	e8 1d 0a 00 00       	call   800c2a <sys_cputs>
+		b->idx = 0;
+  80020d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800213:	83 c4 10             	add    $0x10,%esp
+  800216:	eb db                	jmp    8001f3 <putch+0x1f>
+
+00800218 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800218:	55                   	push   %ebp
+  800219:	89 e5                	mov    %esp,%ebp
+  80021b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800221:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800228:	00 00 00 
+	b.cnt = 0;
+  80022b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800232:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800235:	ff 75 0c             	push   0xc(%ebp)
+  800238:	ff 75 08             	push   0x8(%ebp)
+  80023b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800241:	50                   	push   %eax
+  800242:	68 d4 01 80 00       	push   $0x8001d4
+  800247:	e8 fb 00 00 00       	call   800347 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80024c:	83 c4 08             	add    $0x8,%esp
+  80024f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800255:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80025b:	50                   	push   %eax
+  80025c:	e8 c9 09 00 00       	call   800c2a <sys_cputs>
+
+	return b.cnt;
+}
+  800261:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800267:	c9                   	leave
+  800268:	c3                   	ret
+
+00800269 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800269:	55                   	push   %ebp
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80026f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800272:	50                   	push   %eax
+  800273:	ff 75 08             	push   0x8(%ebp)
+  800276:	e8 9d ff ff ff       	call   800218 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80027b:	c9                   	leave
+  80027c:	c3                   	ret
+
+0080027d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	57                   	push   %edi
+  800281:	56                   	push   %esi
+  800282:	53                   	push   %ebx
+  800283:	83 ec 1c             	sub    $0x1c,%esp
+  800286:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800289:	89 d6                	mov    %edx,%esi
+  80028b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80028e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800291:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800294:	73 0b                	jae    8002a1 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800296:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800299:	c1 e7 08             	shl    $0x8,%edi
+  80029c:	0b 7d 10             	or     0x10(%ebp),%edi
+  80029f:	eb 36                	jmp    8002d7 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8002a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a9:	f7 75 08             	divl   0x8(%ebp)
+  8002ac:	89 c1                	mov    %eax,%ecx
+  8002ae:	ff 75 14             	push   0x14(%ebp)
+  8002b1:	ff 75 10             	push   0x10(%ebp)
+  8002b4:	83 eb 01             	sub    $0x1,%ebx
+  8002b7:	53                   	push   %ebx
+  8002b8:	ff 75 08             	push   0x8(%ebp)
+  8002bb:	89 f2                	mov    %esi,%edx
+  8002bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002c0:	e8 b8 ff ff ff       	call   80027d <printnum>
+  8002c5:	83 c4 10             	add    $0x10,%esp
+  8002c8:	eb 14                	jmp    8002de <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002ca:	83 ec 08             	sub    $0x8,%esp
+  8002cd:	56                   	push   %esi
+  8002ce:	57                   	push   %edi
+  8002cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002d2:	ff d0                	call   *%eax
+  8002d4:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002d7:	83 eb 01             	sub    $0x1,%ebx
+  8002da:	85 db                	test   %ebx,%ebx
+  8002dc:	7f ec                	jg     8002ca <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002de:	83 ec 08             	sub    $0x8,%esp
+  8002e1:	56                   	push   %esi
+  8002e2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ea:	f7 75 08             	divl   0x8(%ebp)
+  8002ed:	0f be 92 4f 2d 80 00 	movsbl 0x802d4f(%edx),%edx
+  8002f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f7:	c1 e0 08             	shl    $0x8,%eax
+  8002fa:	09 d0                	or     %edx,%eax
+  8002fc:	50                   	push   %eax
+  8002fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800300:	ff d0                	call   *%eax
+}
+  800302:	83 c4 10             	add    $0x10,%esp
+  800305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800308:	5b                   	pop    %ebx
+  800309:	5e                   	pop    %esi
+  80030a:	5f                   	pop    %edi
+  80030b:	5d                   	pop    %ebp
+  80030c:	c3                   	ret
+
+0080030d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80030d:	55                   	push   %ebp
+  80030e:	89 e5                	mov    %esp,%ebp
+  800310:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800313:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800317:	8b 10                	mov    (%eax),%edx
+  800319:	3b 50 04             	cmp    0x4(%eax),%edx
+  80031c:	73 0a                	jae    800328 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80031e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800321:	89 08                	mov    %ecx,(%eax)
+  800323:	8b 45 08             	mov    0x8(%ebp),%eax
+  800326:	88 02                	mov    %al,(%edx)
+}
+  800328:	5d                   	pop    %ebp
+  800329:	c3                   	ret
+
+0080032a <printfmt>:
+{
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800330:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800333:	50                   	push   %eax
+  800334:	ff 75 10             	push   0x10(%ebp)
+  800337:	ff 75 0c             	push   0xc(%ebp)
+  80033a:	ff 75 08             	push   0x8(%ebp)
+  80033d:	e8 05 00 00 00       	call   800347 <vprintfmt>
+}
+  800342:	83 c4 10             	add    $0x10,%esp
+  800345:	c9                   	leave
+  800346:	c3                   	ret
+
+00800347 <vprintfmt>:
+{
+  800347:	55                   	push   %ebp
+  800348:	89 e5                	mov    %esp,%ebp
+  80034a:	57                   	push   %edi
+  80034b:	56                   	push   %esi
+  80034c:	53                   	push   %ebx
+  80034d:	83 ec 3c             	sub    $0x3c,%esp
+  800350:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800353:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800356:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80035d:	eb 16                	jmp    800375 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	ff 75 0c             	push   0xc(%ebp)
+  800365:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800368:	c1 e2 08             	shl    $0x8,%edx
+  80036b:	09 d0                	or     %edx,%eax
+  80036d:	50                   	push   %eax
+  80036e:	ff d7                	call   *%edi
+  800370:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800373:	89 de                	mov    %ebx,%esi
+  800375:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800378:	0f b6 06             	movzbl (%esi),%eax
+  80037b:	83 f8 25             	cmp    $0x25,%eax
+  80037e:	74 0c                	je     80038c <vprintfmt+0x45>
+			if (ch == '\0')
+  800380:	85 c0                	test   %eax,%eax
+  800382:	75 db                	jne    80035f <vprintfmt+0x18>
+}
+  800384:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800387:	5b                   	pop    %ebx
+  800388:	5e                   	pop    %esi
+  800389:	5f                   	pop    %edi
+  80038a:	5d                   	pop    %ebp
+  80038b:	c3                   	ret
+		padc = ' ';
+  80038c:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800390:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800397:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80039e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003aa:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003ad:	0f b6 13             	movzbl (%ebx),%edx
+  8003b0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003b3:	3c 55                	cmp    $0x55,%al
+  8003b5:	0f 87 2c 04 00 00    	ja     8007e7 <vprintfmt+0x4a0>
+  8003bb:	0f b6 c0             	movzbl %al,%eax
+  8003be:	ff 24 85 a0 2e 80 00 	jmp    *0x802ea0(,%eax,4)
+  8003c5:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003c7:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003cb:	eb dd                	jmp    8003aa <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cd:	89 f3                	mov    %esi,%ebx
+  8003cf:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003d3:	eb d5                	jmp    8003aa <vprintfmt+0x63>
+  8003d5:	0f b6 d2             	movzbl %dl,%edx
+  8003d8:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003da:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003e6:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003e9:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003ec:	83 fe 09             	cmp    $0x9,%esi
+  8003ef:	0f 87 8a 00 00 00    	ja     80047f <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003f5:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003f8:	eb e5                	jmp    8003df <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fd:	8b 00                	mov    (%eax),%eax
+  8003ff:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800402:	8b 45 14             	mov    0x14(%ebp),%eax
+  800405:	8d 40 04             	lea    0x4(%eax),%eax
+  800408:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040b:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80040d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800411:	79 97                	jns    8003aa <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800413:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800416:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800419:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800420:	eb 88                	jmp    8003aa <vprintfmt+0x63>
+			if (width < 0)
+  800422:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800425:	85 db                	test   %ebx,%ebx
+  800427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042c:	0f 49 c3             	cmovns %ebx,%eax
+  80042f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800432:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800434:	e9 71 ff ff ff       	jmp    8003aa <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800439:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80043b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800442:	e9 63 ff ff ff       	jmp    8003aa <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800447:	8d 73 02             	lea    0x2(%ebx),%esi
+  80044a:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80044e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800455:	3c 67                	cmp    $0x67,%al
+  800457:	0f 84 18 ff ff ff    	je     800375 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80045d:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800464:	3c 72                	cmp    $0x72,%al
+  800466:	0f 84 09 ff ff ff    	je     800375 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80046c:	3c 62                	cmp    $0x62,%al
+  80046e:	0f 94 c0             	sete   %al
+  800471:	0f b6 c0             	movzbl %al,%eax
+  800474:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800477:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80047a:	e9 f6 fe ff ff       	jmp    800375 <vprintfmt+0x2e>
+  80047f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800482:	eb 89                	jmp    80040d <vprintfmt+0xc6>
+			lflag++;
+  800484:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800487:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800489:	e9 1c ff ff ff       	jmp    8003aa <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80048e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800491:	8d 58 04             	lea    0x4(%eax),%ebx
+  800494:	83 ec 08             	sub    $0x8,%esp
+  800497:	ff 75 0c             	push   0xc(%ebp)
+  80049a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80049d:	c1 e0 08             	shl    $0x8,%eax
+  8004a0:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8004a3:	0b 01                	or     (%ecx),%eax
+  8004a5:	50                   	push   %eax
+  8004a6:	ff d7                	call   *%edi
+			break;
+  8004a8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004ab:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004ae:	e9 c2 fe ff ff       	jmp    800375 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b6:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004b9:	8b 10                	mov    (%eax),%edx
+  8004bb:	89 d0                	mov    %edx,%eax
+  8004bd:	f7 d8                	neg    %eax
+  8004bf:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004c2:	83 f8 12             	cmp    $0x12,%eax
+  8004c5:	7f 25                	jg     8004ec <vprintfmt+0x1a5>
+  8004c7:	8b 14 85 00 30 80 00 	mov    0x803000(,%eax,4),%edx
+  8004ce:	85 d2                	test   %edx,%edx
+  8004d0:	74 1a                	je     8004ec <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004d2:	52                   	push   %edx
+  8004d3:	68 75 31 80 00       	push   $0x803175
+  8004d8:	ff 75 0c             	push   0xc(%ebp)
+  8004db:	57                   	push   %edi
+  8004dc:	e8 49 fe ff ff       	call   80032a <printfmt>
+  8004e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e4:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8004e7:	e9 89 fe ff ff       	jmp    800375 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004ec:	50                   	push   %eax
+  8004ed:	68 67 2d 80 00       	push   $0x802d67
+  8004f2:	ff 75 0c             	push   0xc(%ebp)
+  8004f5:	57                   	push   %edi
+  8004f6:	e8 2f fe ff ff       	call   80032a <printfmt>
+  8004fb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004fe:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800501:	e9 6f fe ff ff       	jmp    800375 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800506:	8b 45 14             	mov    0x14(%ebp),%eax
+  800509:	83 c0 04             	add    $0x4,%eax
+  80050c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80050f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800512:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800514:	85 c9                	test   %ecx,%ecx
+  800516:	b8 60 2d 80 00       	mov    $0x802d60,%eax
+  80051b:	0f 45 c1             	cmovne %ecx,%eax
+  80051e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800521:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800525:	7e 06                	jle    80052d <vprintfmt+0x1e6>
+  800527:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80052b:	75 1a                	jne    800547 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80052d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800530:	c1 e0 08             	shl    $0x8,%eax
+  800533:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800536:	83 c8 3f             	or     $0x3f,%eax
+  800539:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80053c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80053f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800542:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800545:	eb 6d                	jmp    8005b4 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800547:	83 ec 08             	sub    $0x8,%esp
+  80054a:	ff 75 d0             	push   -0x30(%ebp)
+  80054d:	ff 75 c8             	push   -0x38(%ebp)
+  800550:	e8 39 03 00 00       	call   80088e <strnlen>
+  800555:	89 c2                	mov    %eax,%edx
+  800557:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80055a:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80055c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80055f:	c1 e1 08             	shl    $0x8,%ecx
+  800562:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800566:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800568:	83 c4 10             	add    $0x10,%esp
+  80056b:	89 c3                	mov    %eax,%ebx
+  80056d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800570:	89 75 10             	mov    %esi,0x10(%ebp)
+  800573:	89 ce                	mov    %ecx,%esi
+  800575:	eb 0f                	jmp    800586 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	ff 75 0c             	push   0xc(%ebp)
+  80057d:	56                   	push   %esi
+  80057e:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800580:	83 eb 01             	sub    $0x1,%ebx
+  800583:	83 c4 10             	add    $0x10,%esp
+  800586:	85 db                	test   %ebx,%ebx
+  800588:	7f ed                	jg     800577 <vprintfmt+0x230>
+  80058a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80058d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800590:	85 c0                	test   %eax,%eax
+  800592:	ba 00 00 00 00       	mov    $0x0,%edx
+  800597:	0f 49 d0             	cmovns %eax,%edx
+  80059a:	29 d0                	sub    %edx,%eax
+  80059c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80059f:	eb 8c                	jmp    80052d <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8005a1:	83 ec 08             	sub    $0x8,%esp
+  8005a4:	ff 75 0c             	push   0xc(%ebp)
+  8005a7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005aa:	09 c2                	or     %eax,%edx
+  8005ac:	52                   	push   %edx
+  8005ad:	ff d7                	call   *%edi
+  8005af:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005b2:	89 d9                	mov    %ebx,%ecx
+  8005b4:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005b7:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005bb:	0f be d0             	movsbl %al,%edx
+  8005be:	85 d2                	test   %edx,%edx
+  8005c0:	74 2a                	je     8005ec <vprintfmt+0x2a5>
+  8005c2:	85 f6                	test   %esi,%esi
+  8005c4:	78 05                	js     8005cb <vprintfmt+0x284>
+  8005c6:	83 ee 01             	sub    $0x1,%esi
+  8005c9:	78 3b                	js     800606 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005cb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005cf:	74 d0                	je     8005a1 <vprintfmt+0x25a>
+  8005d1:	0f be c0             	movsbl %al,%eax
+  8005d4:	83 e8 20             	sub    $0x20,%eax
+  8005d7:	83 f8 5e             	cmp    $0x5e,%eax
+  8005da:	76 c5                	jbe    8005a1 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005dc:	83 ec 08             	sub    $0x8,%esp
+  8005df:	ff 75 0c             	push   0xc(%ebp)
+  8005e2:	ff 75 cc             	push   -0x34(%ebp)
+  8005e5:	ff d7                	call   *%edi
+  8005e7:	83 c4 10             	add    $0x10,%esp
+  8005ea:	eb c6                	jmp    8005b2 <vprintfmt+0x26b>
+  8005ec:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005ef:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f5:	01 c3                	add    %eax,%ebx
+  8005f7:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005f9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005fc:	83 c8 20             	or     $0x20,%eax
+  8005ff:	89 75 10             	mov    %esi,0x10(%ebp)
+  800602:	89 c6                	mov    %eax,%esi
+  800604:	eb 14                	jmp    80061a <vprintfmt+0x2d3>
+  800606:	8b 75 10             	mov    0x10(%ebp),%esi
+  800609:	eb e4                	jmp    8005ef <vprintfmt+0x2a8>
+  80060b:	83 ec 08             	sub    $0x8,%esp
+  80060e:	ff 75 0c             	push   0xc(%ebp)
+  800611:	56                   	push   %esi
+  800612:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800614:	83 eb 01             	sub    $0x1,%ebx
+  800617:	83 c4 10             	add    $0x10,%esp
+  80061a:	85 db                	test   %ebx,%ebx
+  80061c:	7f ed                	jg     80060b <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80061e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800621:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800624:	89 45 14             	mov    %eax,0x14(%ebp)
+  800627:	e9 49 fd ff ff       	jmp    800375 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80062c:	83 f9 01             	cmp    $0x1,%ecx
+  80062f:	7f 1f                	jg     800650 <vprintfmt+0x309>
+	else if (lflag)
+  800631:	85 c9                	test   %ecx,%ecx
+  800633:	74 69                	je     80069e <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800635:	8b 45 14             	mov    0x14(%ebp),%eax
+  800638:	8b 00                	mov    (%eax),%eax
+  80063a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80063d:	89 c1                	mov    %eax,%ecx
+  80063f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800642:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8d 40 04             	lea    0x4(%eax),%eax
+  80064b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80064e:	eb 17                	jmp    800667 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8b 50 04             	mov    0x4(%eax),%edx
+  800656:	8b 00                	mov    (%eax),%eax
+  800658:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80065b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80065e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800661:	8d 40 08             	lea    0x8(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800667:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80066a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80066d:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800672:	85 db                	test   %ebx,%ebx
+  800674:	0f 89 f6 00 00 00    	jns    800770 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	ff 75 0c             	push   0xc(%ebp)
+  800680:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800683:	c1 e0 08             	shl    $0x8,%eax
+  800686:	83 c8 2d             	or     $0x2d,%eax
+  800689:	50                   	push   %eax
+  80068a:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80068c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80068f:	f7 d9                	neg    %ecx
+  800691:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800694:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800699:	e9 d2 00 00 00       	jmp    800770 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80069e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a1:	8b 00                	mov    (%eax),%eax
+  8006a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a6:	89 c1                	mov    %eax,%ecx
+  8006a8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ab:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b7:	eb ae                	jmp    800667 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006b9:	83 f9 01             	cmp    $0x1,%ecx
+  8006bc:	7f 19                	jg     8006d7 <vprintfmt+0x390>
+	else if (lflag)
+  8006be:	85 c9                	test   %ecx,%ecx
+  8006c0:	74 2a                	je     8006ec <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	8b 08                	mov    (%eax),%ecx
+  8006c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006d2:	e9 99 00 00 00       	jmp    800770 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8b 08                	mov    (%eax),%ecx
+  8006dc:	8d 40 08             	lea    0x8(%eax),%eax
+  8006df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8006e7:	e9 84 00 00 00       	jmp    800770 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ef:	8b 08                	mov    (%eax),%ecx
+  8006f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006fc:	eb 72                	jmp    800770 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006fe:	83 f9 01             	cmp    $0x1,%ecx
+  800701:	7f 16                	jg     800719 <vprintfmt+0x3d2>
+	else if (lflag)
+  800703:	85 c9                	test   %ecx,%ecx
+  800705:	74 24                	je     80072b <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 08                	mov    (%eax),%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800712:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800717:	eb 57                	jmp    800770 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 08                	mov    (%eax),%ecx
+  80071e:	8d 40 08             	lea    0x8(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800724:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800729:	eb 45                	jmp    800770 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80072b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072e:	8b 08                	mov    (%eax),%ecx
+  800730:	8d 40 04             	lea    0x4(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800736:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80073b:	eb 33                	jmp    800770 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  80073d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800740:	c1 e3 08             	shl    $0x8,%ebx
+  800743:	83 ec 08             	sub    $0x8,%esp
+  800746:	ff 75 0c             	push   0xc(%ebp)
+  800749:	89 d8                	mov    %ebx,%eax
+  80074b:	83 c8 30             	or     $0x30,%eax
+  80074e:	50                   	push   %eax
+  80074f:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800751:	83 c4 08             	add    $0x8,%esp
+  800754:	ff 75 0c             	push   0xc(%ebp)
+  800757:	83 cb 78             	or     $0x78,%ebx
+  80075a:	53                   	push   %ebx
+  80075b:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80075d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800760:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800762:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800765:	8d 40 04             	lea    0x4(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076b:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800770:	ff 75 e4             	push   -0x1c(%ebp)
+  800773:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800777:	52                   	push   %edx
+  800778:	ff 75 e0             	push   -0x20(%ebp)
+  80077b:	50                   	push   %eax
+  80077c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80077f:	89 f8                	mov    %edi,%eax
+  800781:	e8 f7 fa ff ff       	call   80027d <printnum>
+			break;
+  800786:	83 c4 10             	add    $0x10,%esp
+  800789:	e9 e7 fb ff ff       	jmp    800375 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80078e:	83 f9 01             	cmp    $0x1,%ecx
+  800791:	7f 16                	jg     8007a9 <vprintfmt+0x462>
+	else if (lflag)
+  800793:	85 c9                	test   %ecx,%ecx
+  800795:	74 24                	je     8007bb <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800797:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079a:	8b 08                	mov    (%eax),%ecx
+  80079c:	8d 40 04             	lea    0x4(%eax),%eax
+  80079f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a2:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8007a7:	eb c7                	jmp    800770 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8b 08                	mov    (%eax),%ecx
+  8007ae:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b4:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007b9:	eb b5                	jmp    800770 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007be:	8b 08                	mov    (%eax),%ecx
+  8007c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c6:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007cb:	eb a3                	jmp    800770 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007cd:	83 ec 08             	sub    $0x8,%esp
+  8007d0:	ff 75 0c             	push   0xc(%ebp)
+  8007d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007d6:	c1 e0 08             	shl    $0x8,%eax
+  8007d9:	83 c8 25             	or     $0x25,%eax
+  8007dc:	50                   	push   %eax
+  8007dd:	ff d7                	call   *%edi
+			break;
+  8007df:	83 c4 10             	add    $0x10,%esp
+  8007e2:	e9 8e fb ff ff       	jmp    800375 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8007e7:	83 ec 08             	sub    $0x8,%esp
+  8007ea:	ff 75 0c             	push   0xc(%ebp)
+  8007ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007f0:	c1 e0 08             	shl    $0x8,%eax
+  8007f3:	83 c8 25             	or     $0x25,%eax
+  8007f6:	50                   	push   %eax
+  8007f7:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007f9:	83 c4 10             	add    $0x10,%esp
+  8007fc:	89 de                	mov    %ebx,%esi
+  8007fe:	eb 03                	jmp    800803 <vprintfmt+0x4bc>
+  800800:	83 ee 01             	sub    $0x1,%esi
+  800803:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800807:	75 f7                	jne    800800 <vprintfmt+0x4b9>
+  800809:	e9 67 fb ff ff       	jmp    800375 <vprintfmt+0x2e>
+
+0080080e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	83 ec 18             	sub    $0x18,%esp
+  800814:	8b 45 08             	mov    0x8(%ebp),%eax
+  800817:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80081a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80081d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800821:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800824:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80082b:	85 c0                	test   %eax,%eax
+  80082d:	74 26                	je     800855 <vsnprintf+0x47>
+  80082f:	85 d2                	test   %edx,%edx
+  800831:	7e 22                	jle    800855 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800833:	ff 75 14             	push   0x14(%ebp)
+  800836:	ff 75 10             	push   0x10(%ebp)
+  800839:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80083c:	50                   	push   %eax
+  80083d:	68 0d 03 80 00       	push   $0x80030d
+  800842:	e8 00 fb ff ff       	call   800347 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800847:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80084a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80084d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800850:	83 c4 10             	add    $0x10,%esp
+}
+  800853:	c9                   	leave
+  800854:	c3                   	ret
+		return -E_INVAL;
+  800855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80085a:	eb f7                	jmp    800853 <vsnprintf+0x45>
+
+0080085c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800862:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800865:	50                   	push   %eax
+  800866:	ff 75 10             	push   0x10(%ebp)
+  800869:	ff 75 0c             	push   0xc(%ebp)
+  80086c:	ff 75 08             	push   0x8(%ebp)
+  80086f:	e8 9a ff ff ff       	call   80080e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800874:	c9                   	leave
+  800875:	c3                   	ret
+
+00800876 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800881:	eb 03                	jmp    800886 <strlen+0x10>
+		n++;
+  800883:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800886:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80088a:	75 f7                	jne    800883 <strlen+0xd>
+	return n;
+}
+  80088c:	5d                   	pop    %ebp
+  80088d:	c3                   	ret
+
+0080088e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80088e:	55                   	push   %ebp
+  80088f:	89 e5                	mov    %esp,%ebp
+  800891:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800894:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089c:	eb 03                	jmp    8008a1 <strnlen+0x13>
+		n++;
+  80089e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a1:	39 d0                	cmp    %edx,%eax
+  8008a3:	74 08                	je     8008ad <strnlen+0x1f>
+  8008a5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008a9:	75 f3                	jne    80089e <strnlen+0x10>
+  8008ab:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008ad:	89 d0                	mov    %edx,%eax
+  8008af:	5d                   	pop    %ebp
+  8008b0:	c3                   	ret
+
+008008b1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	53                   	push   %ebx
+  8008b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008c7:	83 c0 01             	add    $0x1,%eax
+  8008ca:	84 d2                	test   %dl,%dl
+  8008cc:	75 f2                	jne    8008c0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008ce:	89 c8                	mov    %ecx,%eax
+  8008d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d3:	c9                   	leave
+  8008d4:	c3                   	ret
+
+008008d5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	53                   	push   %ebx
+  8008d9:	83 ec 10             	sub    $0x10,%esp
+  8008dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008df:	53                   	push   %ebx
+  8008e0:	e8 91 ff ff ff       	call   800876 <strlen>
+  8008e5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008e8:	ff 75 0c             	push   0xc(%ebp)
+  8008eb:	01 d8                	add    %ebx,%eax
+  8008ed:	50                   	push   %eax
+  8008ee:	e8 be ff ff ff       	call   8008b1 <strcpy>
+	return dst;
+}
+  8008f3:	89 d8                	mov    %ebx,%eax
+  8008f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f8:	c9                   	leave
+  8008f9:	c3                   	ret
+
+008008fa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008fa:	55                   	push   %ebp
+  8008fb:	89 e5                	mov    %esp,%ebp
+  8008fd:	56                   	push   %esi
+  8008fe:	53                   	push   %ebx
+  8008ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800902:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800905:	89 f3                	mov    %esi,%ebx
+  800907:	03 5d 10             	add    0x10(%ebp),%ebx
+  80090a:	89 f0                	mov    %esi,%eax
+  80090c:	eb 0f                	jmp    80091d <strncpy+0x23>
+		*dst++ = *src;
+  80090e:	83 c0 01             	add    $0x1,%eax
+  800911:	0f b6 0a             	movzbl (%edx),%ecx
+  800914:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800917:	80 f9 01             	cmp    $0x1,%cl
+  80091a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80091d:	39 d8                	cmp    %ebx,%eax
+  80091f:	75 ed                	jne    80090e <strncpy+0x14>
+	}
+	return ret;
+}
+  800921:	89 f0                	mov    %esi,%eax
+  800923:	5b                   	pop    %ebx
+  800924:	5e                   	pop    %esi
+  800925:	5d                   	pop    %ebp
+  800926:	c3                   	ret
+
+00800927 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	56                   	push   %esi
+  80092b:	53                   	push   %ebx
+  80092c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800932:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800935:	89 f0                	mov    %esi,%eax
+  800937:	85 d2                	test   %edx,%edx
+  800939:	74 21                	je     80095c <strlcpy+0x35>
+  80093b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80093f:	89 f2                	mov    %esi,%edx
+  800941:	eb 09                	jmp    80094c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800943:	83 c1 01             	add    $0x1,%ecx
+  800946:	83 c2 01             	add    $0x1,%edx
+  800949:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80094c:	39 c2                	cmp    %eax,%edx
+  80094e:	74 09                	je     800959 <strlcpy+0x32>
+  800950:	0f b6 19             	movzbl (%ecx),%ebx
+  800953:	84 db                	test   %bl,%bl
+  800955:	75 ec                	jne    800943 <strlcpy+0x1c>
+  800957:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800959:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80095c:	29 f0                	sub    %esi,%eax
+}
+  80095e:	5b                   	pop    %ebx
+  80095f:	5e                   	pop    %esi
+  800960:	5d                   	pop    %ebp
+  800961:	c3                   	ret
+
+00800962 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800968:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80096b:	eb 06                	jmp    800973 <strcmp+0x11>
+		p++, q++;
+  80096d:	83 c1 01             	add    $0x1,%ecx
+  800970:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800973:	0f b6 01             	movzbl (%ecx),%eax
+  800976:	84 c0                	test   %al,%al
+  800978:	74 04                	je     80097e <strcmp+0x1c>
+  80097a:	3a 02                	cmp    (%edx),%al
+  80097c:	74 ef                	je     80096d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80097e:	0f b6 c0             	movzbl %al,%eax
+  800981:	0f b6 12             	movzbl (%edx),%edx
+  800984:	29 d0                	sub    %edx,%eax
+}
+  800986:	5d                   	pop    %ebp
+  800987:	c3                   	ret
+
+00800988 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	53                   	push   %ebx
+  80098c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800992:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800995:	eb 09                	jmp    8009a0 <strncmp+0x18>
+		n--, p++, q++;
+  800997:	83 ea 01             	sub    $0x1,%edx
+  80099a:	83 c0 01             	add    $0x1,%eax
+  80099d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009a0:	85 d2                	test   %edx,%edx
+  8009a2:	74 18                	je     8009bc <strncmp+0x34>
+  8009a4:	0f b6 18             	movzbl (%eax),%ebx
+  8009a7:	84 db                	test   %bl,%bl
+  8009a9:	74 04                	je     8009af <strncmp+0x27>
+  8009ab:	3a 19                	cmp    (%ecx),%bl
+  8009ad:	74 e8                	je     800997 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009af:	0f b6 00             	movzbl (%eax),%eax
+  8009b2:	0f b6 11             	movzbl (%ecx),%edx
+  8009b5:	29 d0                	sub    %edx,%eax
+}
+  8009b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ba:	c9                   	leave
+  8009bb:	c3                   	ret
+		return 0;
+  8009bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c1:	eb f4                	jmp    8009b7 <strncmp+0x2f>
+
+008009c3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009cd:	eb 03                	jmp    8009d2 <strchr+0xf>
+  8009cf:	83 c0 01             	add    $0x1,%eax
+  8009d2:	0f b6 10             	movzbl (%eax),%edx
+  8009d5:	84 d2                	test   %dl,%dl
+  8009d7:	74 06                	je     8009df <strchr+0x1c>
+		if (*s == c)
+  8009d9:	38 ca                	cmp    %cl,%dl
+  8009db:	75 f2                	jne    8009cf <strchr+0xc>
+  8009dd:	eb 05                	jmp    8009e4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009e4:	5d                   	pop    %ebp
+  8009e5:	c3                   	ret
+
+008009e6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009e6:	55                   	push   %ebp
+  8009e7:	89 e5                	mov    %esp,%ebp
+  8009e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ec:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009f0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009f3:	38 ca                	cmp    %cl,%dl
+  8009f5:	74 09                	je     800a00 <strfind+0x1a>
+  8009f7:	84 d2                	test   %dl,%dl
+  8009f9:	74 05                	je     800a00 <strfind+0x1a>
+	for (; *s; s++)
+  8009fb:	83 c0 01             	add    $0x1,%eax
+  8009fe:	eb f0                	jmp    8009f0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+
+00800a02 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	57                   	push   %edi
+  800a06:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a09:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a0c:	85 c9                	test   %ecx,%ecx
+  800a0e:	74 20                	je     800a30 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a10:	89 f8                	mov    %edi,%eax
+  800a12:	09 c8                	or     %ecx,%eax
+  800a14:	a8 03                	test   $0x3,%al
+  800a16:	75 12                	jne    800a2a <memset+0x28>
+		c &= 0xFF;
+  800a18:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a1c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a22:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a25:	fc                   	cld
+  800a26:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a28:	eb 06                	jmp    800a30 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a2d:	fc                   	cld
+  800a2e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a30:	89 f8                	mov    %edi,%eax
+  800a32:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a35:	c9                   	leave
+  800a36:	c3                   	ret
+
+00800a37 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	57                   	push   %edi
+  800a3b:	56                   	push   %esi
+  800a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a45:	39 c6                	cmp    %eax,%esi
+  800a47:	73 32                	jae    800a7b <memmove+0x44>
+  800a49:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a4c:	39 d0                	cmp    %edx,%eax
+  800a4e:	73 2b                	jae    800a7b <memmove+0x44>
+		s += n;
+		d += n;
+  800a50:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a53:	89 d6                	mov    %edx,%esi
+  800a55:	09 fe                	or     %edi,%esi
+  800a57:	09 ce                	or     %ecx,%esi
+  800a59:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a5f:	75 0e                	jne    800a6f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a61:	83 ef 04             	sub    $0x4,%edi
+  800a64:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a67:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a6a:	fd                   	std
+  800a6b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6d:	eb 09                	jmp    800a78 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a6f:	83 ef 01             	sub    $0x1,%edi
+  800a72:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a75:	fd                   	std
+  800a76:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a78:	fc                   	cld
+  800a79:	eb 1a                	jmp    800a95 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a7b:	89 f2                	mov    %esi,%edx
+  800a7d:	09 c2                	or     %eax,%edx
+  800a7f:	09 ca                	or     %ecx,%edx
+  800a81:	f6 c2 03             	test   $0x3,%dl
+  800a84:	75 0a                	jne    800a90 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a86:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a89:	89 c7                	mov    %eax,%edi
+  800a8b:	fc                   	cld
+  800a8c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a8e:	eb 05                	jmp    800a95 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a90:	89 c7                	mov    %eax,%edi
+  800a92:	fc                   	cld
+  800a93:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a95:	5e                   	pop    %esi
+  800a96:	5f                   	pop    %edi
+  800a97:	5d                   	pop    %ebp
+  800a98:	c3                   	ret
+
+00800a99 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a9f:	ff 75 10             	push   0x10(%ebp)
+  800aa2:	ff 75 0c             	push   0xc(%ebp)
+  800aa5:	ff 75 08             	push   0x8(%ebp)
+  800aa8:	e8 8a ff ff ff       	call   800a37 <memmove>
+}
+  800aad:	c9                   	leave
+  800aae:	c3                   	ret
+
+00800aaf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aaf:	55                   	push   %ebp
+  800ab0:	89 e5                	mov    %esp,%ebp
+  800ab2:	56                   	push   %esi
+  800ab3:	53                   	push   %ebx
+  800ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aba:	89 c6                	mov    %eax,%esi
+  800abc:	03 75 10             	add    0x10(%ebp),%esi
+  800abf:	eb 06                	jmp    800ac7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ac1:	83 c0 01             	add    $0x1,%eax
+  800ac4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ac7:	39 f0                	cmp    %esi,%eax
+  800ac9:	74 14                	je     800adf <memcmp+0x30>
+		if (*s1 != *s2)
+  800acb:	0f b6 08             	movzbl (%eax),%ecx
+  800ace:	0f b6 1a             	movzbl (%edx),%ebx
+  800ad1:	38 d9                	cmp    %bl,%cl
+  800ad3:	74 ec                	je     800ac1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ad5:	0f b6 c1             	movzbl %cl,%eax
+  800ad8:	0f b6 db             	movzbl %bl,%ebx
+  800adb:	29 d8                	sub    %ebx,%eax
+  800add:	eb 05                	jmp    800ae4 <memcmp+0x35>
+	}
+
+	return 0;
+  800adf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae4:	5b                   	pop    %ebx
+  800ae5:	5e                   	pop    %esi
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+
+00800ae8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800af1:	89 c2                	mov    %eax,%edx
+  800af3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800af6:	eb 03                	jmp    800afb <memfind+0x13>
+  800af8:	83 c0 01             	add    $0x1,%eax
+  800afb:	39 d0                	cmp    %edx,%eax
+  800afd:	73 04                	jae    800b03 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aff:	38 08                	cmp    %cl,(%eax)
+  800b01:	75 f5                	jne    800af8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b03:	5d                   	pop    %ebp
+  800b04:	c3                   	ret
+
+00800b05 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	57                   	push   %edi
+  800b09:	56                   	push   %esi
+  800b0a:	53                   	push   %ebx
+  800b0b:	83 ec 1c             	sub    $0x1c,%esp
+  800b0e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b11:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b14:	eb 03                	jmp    800b19 <strtol+0x14>
+		s++;
+  800b16:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b19:	0f b6 06             	movzbl (%esi),%eax
+  800b1c:	3c 20                	cmp    $0x20,%al
+  800b1e:	74 f6                	je     800b16 <strtol+0x11>
+  800b20:	3c 09                	cmp    $0x9,%al
+  800b22:	74 f2                	je     800b16 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b24:	3c 2b                	cmp    $0x2b,%al
+  800b26:	74 43                	je     800b6b <strtol+0x66>
+	int neg = 0;
+  800b28:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b2d:	3c 2d                	cmp    $0x2d,%al
+  800b2f:	74 44                	je     800b75 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b31:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b37:	75 0f                	jne    800b48 <strtol+0x43>
+  800b39:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b3c:	74 41                	je     800b7f <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b3e:	85 ff                	test   %edi,%edi
+  800b40:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b45:	0f 44 f8             	cmove  %eax,%edi
+  800b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4d:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b52:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b55:	89 fb                	mov    %edi,%ebx
+  800b57:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b5a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b5d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b60:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b63:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b66:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b69:	eb 67                	jmp    800bd2 <strtol+0xcd>
+		s++;
+  800b6b:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b73:	eb bc                	jmp    800b31 <strtol+0x2c>
+		s++, neg = 1;
+  800b75:	83 c6 01             	add    $0x1,%esi
+  800b78:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b7d:	eb b2                	jmp    800b31 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b7f:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b83:	74 0e                	je     800b93 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b85:	85 ff                	test   %edi,%edi
+  800b87:	75 bf                	jne    800b48 <strtol+0x43>
+		s++, base = 8;
+  800b89:	83 c6 01             	add    $0x1,%esi
+  800b8c:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b91:	eb b5                	jmp    800b48 <strtol+0x43>
+		s += 2, base = 16;
+  800b93:	83 c6 02             	add    $0x2,%esi
+  800b96:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b9b:	eb ab                	jmp    800b48 <strtol+0x43>
+			dig = *s - '0';
+  800b9d:	0f be c9             	movsbl %cl,%ecx
+  800ba0:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800ba3:	39 f9                	cmp    %edi,%ecx
+  800ba5:	7d 59                	jge    800c00 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800ba7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800bab:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bae:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bb1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bb4:	0f af d8             	imul   %eax,%ebx
+  800bb7:	0f af d7             	imul   %edi,%edx
+  800bba:	01 d3                	add    %edx,%ebx
+  800bbc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bbf:	f7 e7                	mul    %edi
+  800bc1:	01 da                	add    %ebx,%edx
+  800bc3:	89 cb                	mov    %ecx,%ebx
+  800bc5:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bc8:	01 c8                	add    %ecx,%eax
+  800bca:	11 da                	adc    %ebx,%edx
+  800bcc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bcf:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd5:	0f b6 08             	movzbl (%eax),%ecx
+  800bd8:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800bdb:	80 fb 09             	cmp    $0x9,%bl
+  800bde:	76 bd                	jbe    800b9d <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800be0:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800be3:	80 fb 19             	cmp    $0x19,%bl
+  800be6:	77 08                	ja     800bf0 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800be8:	0f be c9             	movsbl %cl,%ecx
+  800beb:	83 e9 57             	sub    $0x57,%ecx
+  800bee:	eb b3                	jmp    800ba3 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bf0:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800bf3:	80 fb 19             	cmp    $0x19,%bl
+  800bf6:	77 08                	ja     800c00 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800bf8:	0f be c9             	movsbl %cl,%ecx
+  800bfb:	83 e9 37             	sub    $0x37,%ecx
+  800bfe:	eb a3                	jmp    800ba3 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c00:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c03:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c06:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c09:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c0c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c10:	74 05                	je     800c17 <strtol+0x112>
+		*endptr = (char *) s;
+  800c12:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c15:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c17:	85 c9                	test   %ecx,%ecx
+  800c19:	74 07                	je     800c22 <strtol+0x11d>
+  800c1b:	f7 d8                	neg    %eax
+  800c1d:	83 d2 00             	adc    $0x0,%edx
+  800c20:	f7 da                	neg    %edx
+}
+  800c22:	83 c4 1c             	add    $0x1c,%esp
+  800c25:	5b                   	pop    %ebx
+  800c26:	5e                   	pop    %esi
+  800c27:	5f                   	pop    %edi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+
+00800c2a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	57                   	push   %edi
+  800c2e:	56                   	push   %esi
+  800c2f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c30:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c37:	74 18                	je     800c51 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c44:	89 c3                	mov    %eax,%ebx
+  800c46:	89 c7                	mov    %eax,%edi
+  800c48:	89 c6                	mov    %eax,%esi
+  800c4a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c4c:	5b                   	pop    %ebx
+  800c4d:	5e                   	pop    %esi
+  800c4e:	5f                   	pop    %edi
+  800c4f:	5d                   	pop    %ebp
+  800c50:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5c:	89 c3                	mov    %eax,%ebx
+  800c5e:	89 c7                	mov    %eax,%edi
+  800c60:	55                   	push   %ebp
+  800c61:	89 e5                	mov    %esp,%ebp
+  800c63:	8d 35 6b 0c 80 00    	lea    0x800c6b,%esi
+  800c69:	0f 34                	sysenter
+  800c6b:	5d                   	pop    %ebp
+		goto out;
+  800c6c:	eb de                	jmp    800c4c <sys_cputs+0x22>
+
+00800c6e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	57                   	push   %edi
+  800c72:	56                   	push   %esi
+  800c73:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c74:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c7b:	74 19                	je     800c96 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c82:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c87:	89 d1                	mov    %edx,%ecx
+  800c89:	89 d3                	mov    %edx,%ebx
+  800c8b:	89 d7                	mov    %edx,%edi
+  800c8d:	89 d6                	mov    %edx,%esi
+  800c8f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c91:	5b                   	pop    %ebx
+  800c92:	5e                   	pop    %esi
+  800c93:	5f                   	pop    %edi
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca0:	89 d1                	mov    %edx,%ecx
+  800ca2:	89 d3                	mov    %edx,%ebx
+  800ca4:	89 d7                	mov    %edx,%edi
+  800ca6:	55                   	push   %ebp
+  800ca7:	89 e5                	mov    %esp,%ebp
+  800ca9:	8d 35 b1 0c 80 00    	lea    0x800cb1,%esi
+  800caf:	0f 34                	sysenter
+  800cb1:	5d                   	pop    %ebp
+		goto out;
+  800cb2:	eb dd                	jmp    800c91 <sys_cgetc+0x23>
+
+00800cb4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	57                   	push   %edi
+  800cb8:	56                   	push   %esi
+  800cb9:	53                   	push   %ebx
+  800cba:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800cbd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cc4:	74 21                	je     800ce7 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ccb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd3:	89 cb                	mov    %ecx,%ebx
+  800cd5:	89 cf                	mov    %ecx,%edi
+  800cd7:	89 ce                	mov    %ecx,%esi
+  800cd9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cdb:	85 c0                	test   %eax,%eax
+  800cdd:	7f 27                	jg     800d06 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce2:	5b                   	pop    %ebx
+  800ce3:	5e                   	pop    %esi
+  800ce4:	5f                   	pop    %edi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cef:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf4:	89 cb                	mov    %ecx,%ebx
+  800cf6:	89 cf                	mov    %ecx,%edi
+  800cf8:	55                   	push   %ebp
+  800cf9:	89 e5                	mov    %esp,%ebp
+  800cfb:	8d 35 03 0d 80 00    	lea    0x800d03,%esi
+  800d01:	0f 34                	sysenter
+  800d03:	5d                   	pop    %ebp
+		goto out;
+  800d04:	eb d5                	jmp    800cdb <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d06:	83 ec 0c             	sub    $0xc,%esp
+  800d09:	50                   	push   %eax
+  800d0a:	6a 03                	push   $0x3
+  800d0c:	68 6b 30 80 00       	push   $0x80306b
+  800d11:	6a 3f                	push   $0x3f
+  800d13:	68 88 30 80 00       	push   $0x803088
+  800d18:	e8 71 f4 ff ff       	call   80018e <_panic>
+
+00800d1d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d23:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d2a:	74 19                	je     800d45 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d31:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d36:	89 d1                	mov    %edx,%ecx
+  800d38:	89 d3                	mov    %edx,%ebx
+  800d3a:	89 d7                	mov    %edx,%edi
+  800d3c:	89 d6                	mov    %edx,%esi
+  800d3e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d4f:	89 d1                	mov    %edx,%ecx
+  800d51:	89 d3                	mov    %edx,%ebx
+  800d53:	89 d7                	mov    %edx,%edi
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	8d 35 60 0d 80 00    	lea    0x800d60,%esi
+  800d5e:	0f 34                	sysenter
+  800d60:	5d                   	pop    %ebp
+		goto out;
+  800d61:	eb dd                	jmp    800d40 <sys_getenvid+0x23>
+
+00800d63 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	57                   	push   %edi
+  800d67:	56                   	push   %esi
+  800d68:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d69:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d70:	74 19                	je     800d8b <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d77:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d7c:	89 d1                	mov    %edx,%ecx
+  800d7e:	89 d3                	mov    %edx,%ebx
+  800d80:	89 d7                	mov    %edx,%edi
+  800d82:	89 d6                	mov    %edx,%esi
+  800d84:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d86:	5b                   	pop    %ebx
+  800d87:	5e                   	pop    %esi
+  800d88:	5f                   	pop    %edi
+  800d89:	5d                   	pop    %ebp
+  800d8a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d90:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d95:	89 d1                	mov    %edx,%ecx
+  800d97:	89 d3                	mov    %edx,%ebx
+  800d99:	89 d7                	mov    %edx,%edi
+  800d9b:	55                   	push   %ebp
+  800d9c:	89 e5                	mov    %esp,%ebp
+  800d9e:	8d 35 a6 0d 80 00    	lea    0x800da6,%esi
+  800da4:	0f 34                	sysenter
+  800da6:	5d                   	pop    %ebp
+		goto out;
+  800da7:	eb dd                	jmp    800d86 <sys_yield+0x23>
+
+00800da9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	57                   	push   %edi
+  800dad:	56                   	push   %esi
+  800dae:	53                   	push   %ebx
+  800daf:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800db2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800db9:	74 23                	je     800dde <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dce:	89 f7                	mov    %esi,%edi
+  800dd0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd2:	85 c0                	test   %eax,%eax
+  800dd4:	7f 29                	jg     800dff <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd9:	5b                   	pop    %ebx
+  800dda:	5e                   	pop    %esi
+  800ddb:	5f                   	pop    %edi
+  800ddc:	5d                   	pop    %ebp
+  800ddd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800de9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	8d 35 fc 0d 80 00    	lea    0x800dfc,%esi
+  800dfa:	0f 34                	sysenter
+  800dfc:	5d                   	pop    %ebp
+		goto out;
+  800dfd:	eb d3                	jmp    800dd2 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dff:	83 ec 0c             	sub    $0xc,%esp
+  800e02:	50                   	push   %eax
+  800e03:	6a 04                	push   $0x4
+  800e05:	68 6b 30 80 00       	push   $0x80306b
+  800e0a:	6a 3f                	push   $0x3f
+  800e0c:	68 88 30 80 00       	push   $0x803088
+  800e11:	e8 78 f3 ff ff       	call   80018e <_panic>
+
+00800e16 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	57                   	push   %edi
+  800e1a:	56                   	push   %esi
+  800e1b:	53                   	push   %ebx
+  800e1c:	83 ec 0c             	sub    $0xc,%esp
+  800e1f:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e22:	85 f6                	test   %esi,%esi
+  800e24:	75 09                	jne    800e2f <sys_page_map+0x19>
+  800e26:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e2d:	74 1f                	je     800e4e <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e40:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e42:	85 c0                	test   %eax,%eax
+  800e44:	7f 27                	jg     800e6d <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5e                   	pop    %esi
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e54:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e5f:	55                   	push   %ebp
+  800e60:	89 e5                	mov    %esp,%ebp
+  800e62:	8d 35 6a 0e 80 00    	lea    0x800e6a,%esi
+  800e68:	0f 34                	sysenter
+  800e6a:	5d                   	pop    %ebp
+		goto out;
+  800e6b:	eb d5                	jmp    800e42 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+  800e70:	50                   	push   %eax
+  800e71:	6a 05                	push   $0x5
+  800e73:	68 6b 30 80 00       	push   $0x80306b
+  800e78:	6a 3f                	push   $0x3f
+  800e7a:	68 88 30 80 00       	push   $0x803088
+  800e7f:	e8 0a f3 ff ff       	call   80018e <_panic>
+
+00800e84 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e84:	55                   	push   %ebp
+  800e85:	89 e5                	mov    %esp,%ebp
+  800e87:	57                   	push   %edi
+  800e88:	56                   	push   %esi
+  800e89:	53                   	push   %ebx
+  800e8a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e8d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e94:	74 22                	je     800eb8 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ea0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea6:	89 df                	mov    %ebx,%edi
+  800ea8:	89 de                	mov    %ebx,%esi
+  800eaa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	7f 28                	jg     800ed8 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5f                   	pop    %edi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ec8:	89 df                	mov    %ebx,%edi
+  800eca:	55                   	push   %ebp
+  800ecb:	89 e5                	mov    %esp,%ebp
+  800ecd:	8d 35 d5 0e 80 00    	lea    0x800ed5,%esi
+  800ed3:	0f 34                	sysenter
+  800ed5:	5d                   	pop    %ebp
+		goto out;
+  800ed6:	eb d4                	jmp    800eac <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	50                   	push   %eax
+  800edc:	6a 06                	push   $0x6
+  800ede:	68 6b 30 80 00       	push   $0x80306b
+  800ee3:	6a 3f                	push   $0x3f
+  800ee5:	68 88 30 80 00       	push   $0x803088
+  800eea:	e8 9f f2 ff ff       	call   80018e <_panic>
+
+00800eef <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	56                   	push   %esi
+  800ef4:	53                   	push   %ebx
+  800ef5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ef8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eff:	74 22                	je     800f23 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f06:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f11:	89 df                	mov    %ebx,%edi
+  800f13:	89 de                	mov    %ebx,%esi
+  800f15:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f17:	85 c0                	test   %eax,%eax
+  800f19:	7f 28                	jg     800f43 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1e:	5b                   	pop    %ebx
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f33:	89 df                	mov    %ebx,%edi
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	8d 35 40 0f 80 00    	lea    0x800f40,%esi
+  800f3e:	0f 34                	sysenter
+  800f40:	5d                   	pop    %ebp
+		goto out;
+  800f41:	eb d4                	jmp    800f17 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f43:	83 ec 0c             	sub    $0xc,%esp
+  800f46:	50                   	push   %eax
+  800f47:	6a 08                	push   $0x8
+  800f49:	68 6b 30 80 00       	push   $0x80306b
+  800f4e:	6a 3f                	push   $0x3f
+  800f50:	68 88 30 80 00       	push   $0x803088
+  800f55:	e8 34 f2 ff ff       	call   80018e <_panic>
+
+00800f5a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	57                   	push   %edi
+  800f5e:	56                   	push   %esi
+  800f5f:	53                   	push   %ebx
+  800f60:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f63:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f6a:	74 22                	je     800f8e <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f71:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	89 df                	mov    %ebx,%edi
+  800f7e:	89 de                	mov    %ebx,%esi
+  800f80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f82:	85 c0                	test   %eax,%eax
+  800f84:	7f 28                	jg     800fae <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f89:	5b                   	pop    %ebx
+  800f8a:	5e                   	pop    %esi
+  800f8b:	5f                   	pop    %edi
+  800f8c:	5d                   	pop    %ebp
+  800f8d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f99:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f9e:	89 df                	mov    %ebx,%edi
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	8d 35 ab 0f 80 00    	lea    0x800fab,%esi
+  800fa9:	0f 34                	sysenter
+  800fab:	5d                   	pop    %ebp
+		goto out;
+  800fac:	eb d4                	jmp    800f82 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fae:	83 ec 0c             	sub    $0xc,%esp
+  800fb1:	50                   	push   %eax
+  800fb2:	6a 09                	push   $0x9
+  800fb4:	68 6b 30 80 00       	push   $0x80306b
+  800fb9:	6a 3f                	push   $0x3f
+  800fbb:	68 88 30 80 00       	push   $0x803088
+  800fc0:	e8 c9 f1 ff ff       	call   80018e <_panic>
+
+00800fc5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	57                   	push   %edi
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fce:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fd5:	74 22                	je     800ff9 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800fd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe7:	89 df                	mov    %ebx,%edi
+  800fe9:	89 de                	mov    %ebx,%esi
+  800feb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fed:	85 c0                	test   %eax,%eax
+  800fef:	7f 28                	jg     801019 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ff1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5f                   	pop    %edi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ff9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801001:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801004:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801009:	89 df                	mov    %ebx,%edi
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	8d 35 16 10 80 00    	lea    0x801016,%esi
+  801014:	0f 34                	sysenter
+  801016:	5d                   	pop    %ebp
+		goto out;
+  801017:	eb d4                	jmp    800fed <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801019:	83 ec 0c             	sub    $0xc,%esp
+  80101c:	50                   	push   %eax
+  80101d:	6a 0a                	push   $0xa
+  80101f:	68 6b 30 80 00       	push   $0x80306b
+  801024:	6a 3f                	push   $0x3f
+  801026:	68 88 30 80 00       	push   $0x803088
+  80102b:	e8 5e f1 ff ff       	call   80018e <_panic>
+
+00801030 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801030:	55                   	push   %ebp
+  801031:	89 e5                	mov    %esp,%ebp
+  801033:	57                   	push   %edi
+  801034:	56                   	push   %esi
+  801035:	53                   	push   %ebx
+  801036:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801039:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801040:	74 22                	je     801064 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801042:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801047:	b8 17 00 00 00       	mov    $0x17,%eax
+  80104c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801052:	89 df                	mov    %ebx,%edi
+  801054:	89 de                	mov    %ebx,%esi
+  801056:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801058:	85 c0                	test   %eax,%eax
+  80105a:	7f 28                	jg     801084 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80105c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105f:	5b                   	pop    %ebx
+  801060:	5e                   	pop    %esi
+  801061:	5f                   	pop    %edi
+  801062:	5d                   	pop    %ebp
+  801063:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801064:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801074:	89 df                	mov    %ebx,%edi
+  801076:	55                   	push   %ebp
+  801077:	89 e5                	mov    %esp,%ebp
+  801079:	8d 35 81 10 80 00    	lea    0x801081,%esi
+  80107f:	0f 34                	sysenter
+  801081:	5d                   	pop    %ebp
+		goto out;
+  801082:	eb d4                	jmp    801058 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801084:	83 ec 0c             	sub    $0xc,%esp
+  801087:	50                   	push   %eax
+  801088:	6a 17                	push   $0x17
+  80108a:	68 6b 30 80 00       	push   $0x80306b
+  80108f:	6a 3f                	push   $0x3f
+  801091:	68 88 30 80 00       	push   $0x803088
+  801096:	e8 f3 f0 ff ff       	call   80018e <_panic>
+
+0080109b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	57                   	push   %edi
+  80109f:	56                   	push   %esi
+  8010a0:	53                   	push   %ebx
+  8010a1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010a4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010ab:	74 22                	je     8010cf <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bd:	89 df                	mov    %ebx,%edi
+  8010bf:	89 de                	mov    %ebx,%esi
+  8010c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	7f 28                	jg     8010ef <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5e                   	pop    %esi
+  8010cc:	5f                   	pop    %edi
+  8010cd:	5d                   	pop    %ebp
+  8010ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010da:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010df:	89 df                	mov    %ebx,%edi
+  8010e1:	55                   	push   %ebp
+  8010e2:	89 e5                	mov    %esp,%ebp
+  8010e4:	8d 35 ec 10 80 00    	lea    0x8010ec,%esi
+  8010ea:	0f 34                	sysenter
+  8010ec:	5d                   	pop    %ebp
+		goto out;
+  8010ed:	eb d4                	jmp    8010c3 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ef:	83 ec 0c             	sub    $0xc,%esp
+  8010f2:	50                   	push   %eax
+  8010f3:	6a 18                	push   $0x18
+  8010f5:	68 6b 30 80 00       	push   $0x80306b
+  8010fa:	6a 3f                	push   $0x3f
+  8010fc:	68 88 30 80 00       	push   $0x803088
+  801101:	e8 88 f0 ff ff       	call   80018e <_panic>
+
+00801106 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	57                   	push   %edi
+  80110a:	56                   	push   %esi
+  80110b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80110c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801113:	74 1d                	je     801132 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801115:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80111a:	be 00 00 00 00       	mov    $0x0,%esi
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801125:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801128:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80112b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801132:	8b 55 08             	mov    0x8(%ebp),%edx
+  801135:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801138:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80113d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801140:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	8d 35 4e 11 80 00    	lea    0x80114e,%esi
+  80114c:	0f 34                	sysenter
+  80114e:	5d                   	pop    %ebp
+		goto out;
+  80114f:	eb dc                	jmp    80112d <sys_ipc_try_send+0x27>
+
+00801151 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801151:	55                   	push   %ebp
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	57                   	push   %edi
+  801155:	56                   	push   %esi
+  801156:	53                   	push   %ebx
+  801157:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80115a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801161:	74 21                	je     801184 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801163:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801168:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	89 cb                	mov    %ecx,%ebx
+  801172:	89 cf                	mov    %ecx,%edi
+  801174:	89 ce                	mov    %ecx,%esi
+  801176:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801178:	85 c0                	test   %eax,%eax
+  80117a:	7f 27                	jg     8011a3 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80117c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117f:	5b                   	pop    %ebx
+  801180:	5e                   	pop    %esi
+  801181:	5f                   	pop    %edi
+  801182:	5d                   	pop    %ebp
+  801183:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80118c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801191:	89 cb                	mov    %ecx,%ebx
+  801193:	89 cf                	mov    %ecx,%edi
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	8d 35 a0 11 80 00    	lea    0x8011a0,%esi
+  80119e:	0f 34                	sysenter
+  8011a0:	5d                   	pop    %ebp
+		goto out;
+  8011a1:	eb d5                	jmp    801178 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a3:	83 ec 0c             	sub    $0xc,%esp
+  8011a6:	50                   	push   %eax
+  8011a7:	6a 0d                	push   $0xd
+  8011a9:	68 6b 30 80 00       	push   $0x80306b
+  8011ae:	6a 3f                	push   $0x3f
+  8011b0:	68 88 30 80 00       	push   $0x803088
+  8011b5:	e8 d4 ef ff ff       	call   80018e <_panic>
+
+008011ba <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011c0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011c7:	74 1b                	je     8011e4 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d9:	89 df                	mov    %ebx,%edi
+  8011db:	89 de                	mov    %ebx,%esi
+  8011dd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011df:	5b                   	pop    %ebx
+  8011e0:	5e                   	pop    %esi
+  8011e1:	5f                   	pop    %edi
+  8011e2:	5d                   	pop    %ebp
+  8011e3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ef:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011f4:	89 df                	mov    %ebx,%edi
+  8011f6:	55                   	push   %ebp
+  8011f7:	89 e5                	mov    %esp,%ebp
+  8011f9:	8d 35 01 12 80 00    	lea    0x801201,%esi
+  8011ff:	0f 34                	sysenter
+  801201:	5d                   	pop    %ebp
+		goto out;
+  801202:	eb db                	jmp    8011df <sys_ipc_recv_until+0x25>
+
+00801204 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801204:	55                   	push   %ebp
+  801205:	89 e5                	mov    %esp,%ebp
+  801207:	57                   	push   %edi
+  801208:	56                   	push   %esi
+  801209:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80120a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801211:	74 19                	je     80122c <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801213:	ba 00 00 00 00       	mov    $0x0,%edx
+  801218:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80121d:	89 d1                	mov    %edx,%ecx
+  80121f:	89 d3                	mov    %edx,%ebx
+  801221:	89 d7                	mov    %edx,%edi
+  801223:	89 d6                	mov    %edx,%esi
+  801225:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801227:	5b                   	pop    %ebx
+  801228:	5e                   	pop    %esi
+  801229:	5f                   	pop    %edi
+  80122a:	5d                   	pop    %ebp
+  80122b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80122c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801231:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801236:	89 d1                	mov    %edx,%ecx
+  801238:	89 d3                	mov    %edx,%ebx
+  80123a:	89 d7                	mov    %edx,%edi
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	8d 35 47 12 80 00    	lea    0x801247,%esi
+  801245:	0f 34                	sysenter
+  801247:	5d                   	pop    %ebp
+		goto out;
+  801248:	eb dd                	jmp    801227 <sys_time_msec+0x23>
+
+0080124a <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	57                   	push   %edi
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801250:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801257:	74 1a                	je     801273 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801259:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80125e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	89 cb                	mov    %ecx,%ebx
+  801268:	89 cf                	mov    %ecx,%edi
+  80126a:	89 ce                	mov    %ecx,%esi
+  80126c:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80126e:	5b                   	pop    %ebx
+  80126f:	5e                   	pop    %esi
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801273:	8b 55 08             	mov    0x8(%ebp),%edx
+  801276:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80127b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801280:	89 cb                	mov    %ecx,%ebx
+  801282:	89 cf                	mov    %ecx,%edi
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	8d 35 8f 12 80 00    	lea    0x80128f,%esi
+  80128d:	0f 34                	sysenter
+  80128f:	5d                   	pop    %ebp
+		goto out;
+  801290:	eb dc                	jmp    80126e <sys_sleep_until+0x24>
+
+00801292 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801292:	55                   	push   %ebp
+  801293:	89 e5                	mov    %esp,%ebp
+  801295:	57                   	push   %edi
+  801296:	56                   	push   %esi
+  801297:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801298:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80129f:	74 1a                	je     8012bb <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8012a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012a6:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ae:	89 cb                	mov    %ecx,%ebx
+  8012b0:	89 cf                	mov    %ecx,%edi
+  8012b2:	89 ce                	mov    %ecx,%esi
+  8012b4:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012b6:	5b                   	pop    %ebx
+  8012b7:	5e                   	pop    %esi
+  8012b8:	5f                   	pop    %edi
+  8012b9:	5d                   	pop    %ebp
+  8012ba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012c8:	89 cb                	mov    %ecx,%ebx
+  8012ca:	89 cf                	mov    %ecx,%edi
+  8012cc:	55                   	push   %ebp
+  8012cd:	89 e5                	mov    %esp,%ebp
+  8012cf:	8d 35 d7 12 80 00    	lea    0x8012d7,%esi
+  8012d5:	0f 34                	sysenter
+  8012d7:	5d                   	pop    %ebp
+		goto out;
+  8012d8:	eb dc                	jmp    8012b6 <sys_env_print_stats+0x24>
+
+008012da <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	57                   	push   %edi
+  8012de:	56                   	push   %esi
+  8012df:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012e0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012e7:	74 1b                	je     801304 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ee:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f9:	89 df                	mov    %ebx,%edi
+  8012fb:	89 de                	mov    %ebx,%esi
+  8012fd:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012ff:	5b                   	pop    %ebx
+  801300:	5e                   	pop    %esi
+  801301:	5f                   	pop    %edi
+  801302:	5d                   	pop    %ebp
+  801303:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801304:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801309:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801314:	89 df                	mov    %ebx,%edi
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	8d 35 21 13 80 00    	lea    0x801321,%esi
+  80131f:	0f 34                	sysenter
+  801321:	5d                   	pop    %ebp
+		goto out;
+  801322:	eb db                	jmp    8012ff <sys_perf+0x25>
+
+00801324 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801324:	55                   	push   %ebp
+  801325:	89 e5                	mov    %esp,%ebp
+  801327:	57                   	push   %edi
+  801328:	56                   	push   %esi
+  801329:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80132a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801331:	74 19                	je     80134c <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801333:	ba 00 00 00 00       	mov    $0x0,%edx
+  801338:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80133d:	89 d1                	mov    %edx,%ecx
+  80133f:	89 d3                	mov    %edx,%ebx
+  801341:	89 d7                	mov    %edx,%edi
+  801343:	89 d6                	mov    %edx,%esi
+  801345:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801347:	5b                   	pop    %ebx
+  801348:	5e                   	pop    %esi
+  801349:	5f                   	pop    %edi
+  80134a:	5d                   	pop    %ebp
+  80134b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80134c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801351:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801356:	89 d1                	mov    %edx,%ecx
+  801358:	89 d3                	mov    %edx,%ebx
+  80135a:	89 d7                	mov    %edx,%edi
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	8d 35 67 13 80 00    	lea    0x801367,%esi
+  801365:	0f 34                	sysenter
+  801367:	5d                   	pop    %ebp
+		goto out;
+  801368:	eb dd                	jmp    801347 <sys_fork+0x23>
+
+0080136a <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80136a:	55                   	push   %ebp
+  80136b:	89 e5                	mov    %esp,%ebp
+  80136d:	57                   	push   %edi
+  80136e:	56                   	push   %esi
+  80136f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801370:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801377:	74 1c                	je     801395 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801379:	be 00 00 00 00       	mov    $0x0,%esi
+  80137e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801383:	8b 55 08             	mov    0x8(%ebp),%edx
+  801386:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801389:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80138c:	89 f7                	mov    %esi,%edi
+  80138e:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801390:	5b                   	pop    %ebx
+  801391:	5e                   	pop    %esi
+  801392:	5f                   	pop    %edi
+  801393:	5d                   	pop    %ebp
+  801394:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a8:	55                   	push   %ebp
+  8013a9:	89 e5                	mov    %esp,%ebp
+  8013ab:	8d 35 b3 13 80 00    	lea    0x8013b3,%esi
+  8013b1:	0f 34                	sysenter
+  8013b3:	5d                   	pop    %ebp
+		goto out;
+  8013b4:	eb da                	jmp    801390 <sys_thread_create+0x26>
+
+008013b6 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	57                   	push   %edi
+  8013ba:	56                   	push   %esi
+  8013bb:	53                   	push   %ebx
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013bf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013c6:	74 24                	je     8013ec <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013c8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013db:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013e0:	85 c0                	test   %eax,%eax
+  8013e2:	7f 27                	jg     80140b <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e7:	5b                   	pop    %ebx
+  8013e8:	5e                   	pop    %esi
+  8013e9:	5f                   	pop    %edi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013fd:	55                   	push   %ebp
+  8013fe:	89 e5                	mov    %esp,%ebp
+  801400:	8d 35 08 14 80 00    	lea    0x801408,%esi
+  801406:	0f 34                	sysenter
+  801408:	5d                   	pop    %ebp
+		goto out;
+  801409:	eb d5                	jmp    8013e0 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80140b:	83 ec 0c             	sub    $0xc,%esp
+  80140e:	50                   	push   %eax
+  80140f:	6a 1f                	push   $0x1f
+  801411:	68 6b 30 80 00       	push   $0x80306b
+  801416:	6a 3f                	push   $0x3f
+  801418:	68 88 30 80 00       	push   $0x803088
+  80141d:	e8 6c ed ff ff       	call   80018e <_panic>
+
+00801422 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	57                   	push   %edi
+  801426:	56                   	push   %esi
+  801427:	53                   	push   %ebx
+  801428:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80142b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801432:	74 23                	je     801457 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801434:	be 00 00 00 00       	mov    $0x0,%esi
+  801439:	b8 20 00 00 00       	mov    $0x20,%eax
+  80143e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801441:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801444:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801447:	89 f7                	mov    %esi,%edi
+  801449:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	7f 29                	jg     801478 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80144f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801452:	5b                   	pop    %ebx
+  801453:	5e                   	pop    %esi
+  801454:	5f                   	pop    %edi
+  801455:	5d                   	pop    %ebp
+  801456:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801457:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801462:	bf 00 00 00 00       	mov    $0x0,%edi
+  801467:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	8d 35 75 14 80 00    	lea    0x801475,%esi
+  801473:	0f 34                	sysenter
+  801475:	5d                   	pop    %ebp
+		goto out;
+  801476:	eb d3                	jmp    80144b <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801478:	83 ec 0c             	sub    $0xc,%esp
+  80147b:	50                   	push   %eax
+  80147c:	6a 20                	push   $0x20
+  80147e:	68 6b 30 80 00       	push   $0x80306b
+  801483:	6a 3f                	push   $0x3f
+  801485:	68 88 30 80 00       	push   $0x803088
+  80148a:	e8 ff ec ff ff       	call   80018e <_panic>
+
+0080148f <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	57                   	push   %edi
+  801493:	56                   	push   %esi
+  801494:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801495:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80149c:	74 1b                	je     8014b9 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80149e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ae:	89 df                	mov    %ebx,%edi
+  8014b0:	89 de                	mov    %ebx,%esi
+  8014b2:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014b4:	5b                   	pop    %ebx
+  8014b5:	5e                   	pop    %esi
+  8014b6:	5f                   	pop    %edi
+  8014b7:	5d                   	pop    %ebp
+  8014b8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014c9:	89 df                	mov    %ebx,%edi
+  8014cb:	55                   	push   %ebp
+  8014cc:	89 e5                	mov    %esp,%ebp
+  8014ce:	8d 35 d6 14 80 00    	lea    0x8014d6,%esi
+  8014d4:	0f 34                	sysenter
+  8014d6:	5d                   	pop    %ebp
+		goto out;
+  8014d7:	eb db                	jmp    8014b4 <sys_batch+0x25>
+
+008014d9 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014d9:	55                   	push   %ebp
+  8014da:	89 e5                	mov    %esp,%ebp
+  8014dc:	57                   	push   %edi
+  8014dd:	56                   	push   %esi
+  8014de:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014df:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e6:	74 1a                	je     801502 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8014e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ed:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f5:	89 cb                	mov    %ecx,%ebx
+  8014f7:	89 cf                	mov    %ecx,%edi
+  8014f9:	89 ce                	mov    %ecx,%esi
+  8014fb:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014fd:	5b                   	pop    %ebx
+  8014fe:	5e                   	pop    %esi
+  8014ff:	5f                   	pop    %edi
+  801500:	5d                   	pop    %ebp
+  801501:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801502:	8b 55 08             	mov    0x8(%ebp),%edx
+  801505:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80150a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80150f:	89 cb                	mov    %ecx,%ebx
+  801511:	89 cf                	mov    %ecx,%edi
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	8d 35 1e 15 80 00    	lea    0x80151e,%esi
+  80151c:	0f 34                	sysenter
+  80151e:	5d                   	pop    %ebp
+		goto out;
+  80151f:	eb dc                	jmp    8014fd <sys_trace_ctl+0x24>
+
+00801521 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801521:	55                   	push   %ebp
+  801522:	89 e5                	mov    %esp,%ebp
+  801524:	57                   	push   %edi
+  801525:	56                   	push   %esi
+  801526:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801527:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80152e:	74 1c                	je     80154c <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801530:	be 00 00 00 00       	mov    $0x0,%esi
+  801535:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80153a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801540:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801543:	89 f7                	mov    %esi,%edi
+  801545:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801547:	5b                   	pop    %ebx
+  801548:	5e                   	pop    %esi
+  801549:	5f                   	pop    %edi
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80154c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801552:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801557:	bf 00 00 00 00       	mov    $0x0,%edi
+  80155c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80155f:	55                   	push   %ebp
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	8d 35 6a 15 80 00    	lea    0x80156a,%esi
+  801568:	0f 34                	sysenter
+  80156a:	5d                   	pop    %ebp
+		goto out;
+  80156b:	eb da                	jmp    801547 <sys_trace_read+0x26>
+
+0080156d <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	57                   	push   %edi
+  801571:	56                   	push   %esi
+  801572:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801573:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80157a:	74 1c                	je     801598 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80157c:	be 00 00 00 00       	mov    $0x0,%esi
+  801581:	b8 21 00 00 00       	mov    $0x21,%eax
+  801586:	8b 55 08             	mov    0x8(%ebp),%edx
+  801589:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80158c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158f:	89 f7                	mov    %esi,%edi
+  801591:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801593:	5b                   	pop    %ebx
+  801594:	5e                   	pop    %esi
+  801595:	5f                   	pop    %edi
+  801596:	5d                   	pop    %ebp
+  801597:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801598:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159e:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ab:	55                   	push   %ebp
+  8015ac:	89 e5                	mov    %esp,%ebp
+  8015ae:	8d 35 b6 15 80 00    	lea    0x8015b6,%esi
+  8015b4:	0f 34                	sysenter
+  8015b6:	5d                   	pop    %ebp
+		goto out;
+  8015b7:	eb da                	jmp    801593 <sys_meminfo+0x26>
+
+008015b9 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015b9:	55                   	push   %ebp
+  8015ba:	89 e5                	mov    %esp,%ebp
+  8015bc:	57                   	push   %edi
+  8015bd:	56                   	push   %esi
+  8015be:	53                   	push   %ebx
+  8015bf:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015c2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015c6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015cd:	74 1f                	je     8015ee <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d4:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015dc:	89 df                	mov    %ebx,%edi
+  8015de:	89 de                	mov    %ebx,%esi
+  8015e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	7f 25                	jg     80160b <sys_env_set_ksm+0x52>
+}
+  8015e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e9:	5b                   	pop    %ebx
+  8015ea:	5e                   	pop    %esi
+  8015eb:	5f                   	pop    %edi
+  8015ec:	5d                   	pop    %ebp
+  8015ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f6:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015fb:	89 df                	mov    %ebx,%edi
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	8d 35 08 16 80 00    	lea    0x801608,%esi
+  801606:	0f 34                	sysenter
+  801608:	5d                   	pop    %ebp
+		goto out;
+  801609:	eb d7                	jmp    8015e2 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80160b:	83 ec 0c             	sub    $0xc,%esp
+  80160e:	50                   	push   %eax
+  80160f:	6a 22                	push   $0x22
+  801611:	68 6b 30 80 00       	push   $0x80306b
+  801616:	6a 3f                	push   $0x3f
+  801618:	68 88 30 80 00       	push   $0x803088
+  80161d:	e8 6c eb ff ff       	call   80018e <_panic>
+
+00801622 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	57                   	push   %edi
+  801626:	56                   	push   %esi
+  801627:	53                   	push   %ebx
+  801628:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80162b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80162e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801635:	74 24                	je     80165b <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801637:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80163c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801641:	89 cb                	mov    %ecx,%ebx
+  801643:	89 cf                	mov    %ecx,%edi
+  801645:	89 ce                	mov    %ecx,%esi
+  801647:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801649:	85 c0                	test   %eax,%eax
+  80164b:	7f 2a                	jg     801677 <sys_time_nsec+0x55>
+	return ns;
+}
+  80164d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801650:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801653:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801656:	5b                   	pop    %ebx
+  801657:	5e                   	pop    %esi
+  801658:	5f                   	pop    %edi
+  801659:	5d                   	pop    %ebp
+  80165a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80165b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801660:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801665:	89 cb                	mov    %ecx,%ebx
+  801667:	89 cf                	mov    %ecx,%edi
+  801669:	55                   	push   %ebp
+  80166a:	89 e5                	mov    %esp,%ebp
+  80166c:	8d 35 74 16 80 00    	lea    0x801674,%esi
+  801672:	0f 34                	sysenter
+  801674:	5d                   	pop    %ebp
+		goto out;
+  801675:	eb d2                	jmp    801649 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801677:	83 ec 0c             	sub    $0xc,%esp
+  80167a:	50                   	push   %eax
+  80167b:	6a 0f                	push   $0xf
+  80167d:	68 6b 30 80 00       	push   $0x80306b
+  801682:	6a 3f                	push   $0x3f
+  801684:	68 88 30 80 00       	push   $0x803088
+  801689:	e8 00 eb ff ff       	call   80018e <_panic>
+
+0080168e <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80168e:	55                   	push   %ebp
+  80168f:	89 e5                	mov    %esp,%ebp
+  801691:	57                   	push   %edi
+  801692:	56                   	push   %esi
+  801693:	53                   	push   %ebx
+  801694:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801697:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80169e:	74 22                	je     8016c2 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8016a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b0:	89 df                	mov    %ebx,%edi
+  8016b2:	89 de                	mov    %ebx,%esi
+  8016b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	7f 28                	jg     8016e2 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016bd:	5b                   	pop    %ebx
+  8016be:	5e                   	pop    %esi
+  8016bf:	5f                   	pop    %edi
+  8016c0:	5d                   	pop    %ebp
+  8016c1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016cd:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016d2:	89 df                	mov    %ebx,%edi
+  8016d4:	55                   	push   %ebp
+  8016d5:	89 e5                	mov    %esp,%ebp
+  8016d7:	8d 35 df 16 80 00    	lea    0x8016df,%esi
+  8016dd:	0f 34                	sysenter
+  8016df:	5d                   	pop    %ebp
+		goto out;
+  8016e0:	eb d4                	jmp    8016b6 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016e2:	83 ec 0c             	sub    $0xc,%esp
+  8016e5:	50                   	push   %eax
+  8016e6:	6a 12                	push   $0x12
+  8016e8:	68 6b 30 80 00       	push   $0x80306b
+  8016ed:	6a 3f                	push   $0x3f
+  8016ef:	68 88 30 80 00       	push   $0x803088
+  8016f4:	e8 95 ea ff ff       	call   80018e <_panic>
+
+008016f9 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	57                   	push   %edi
+  8016fd:	56                   	push   %esi
+  8016fe:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016ff:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801706:	74 1b                	je     801723 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801712:	8b 55 08             	mov    0x8(%ebp),%edx
+  801715:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801718:	89 df                	mov    %ebx,%edi
+  80171a:	89 de                	mov    %ebx,%esi
+  80171c:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80171e:	5b                   	pop    %ebx
+  80171f:	5e                   	pop    %esi
+  801720:	5f                   	pop    %edi
+  801721:	5d                   	pop    %ebp
+  801722:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801723:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801728:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80172e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801733:	89 df                	mov    %ebx,%edi
+  801735:	55                   	push   %ebp
+  801736:	89 e5                	mov    %esp,%ebp
+  801738:	8d 35 40 17 80 00    	lea    0x801740,%esi
+  80173e:	0f 34                	sysenter
+  801740:	5d                   	pop    %ebp
+		goto out;
+  801741:	eb db                	jmp    80171e <sys_e1000_receive+0x25>
+
+00801743 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801743:	55                   	push   %ebp
+  801744:	89 e5                	mov    %esp,%ebp
+  801746:	57                   	push   %edi
+  801747:	56                   	push   %esi
+  801748:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801749:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801750:	74 1b                	je     80176d <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801752:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801757:	b8 14 00 00 00       	mov    $0x14,%eax
+  80175c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801762:	89 df                	mov    %ebx,%edi
+  801764:	89 de                	mov    %ebx,%esi
+  801766:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801768:	5b                   	pop    %ebx
+  801769:	5e                   	pop    %esi
+  80176a:	5f                   	pop    %edi
+  80176b:	5d                   	pop    %ebp
+  80176c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80176d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801772:	8b 55 08             	mov    0x8(%ebp),%edx
+  801775:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801778:	b8 14 00 00 00       	mov    $0x14,%eax
+  80177d:	89 df                	mov    %ebx,%edi
+  80177f:	55                   	push   %ebp
+  801780:	89 e5                	mov    %esp,%ebp
+  801782:	8d 35 8a 17 80 00    	lea    0x80178a,%esi
+  801788:	0f 34                	sysenter
+  80178a:	5d                   	pop    %ebp
+		goto out;
+  80178b:	eb db                	jmp    801768 <sys_e1000_read_hwaddr+0x25>
+
+0080178d <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80178d:	55                   	push   %ebp
+  80178e:	89 e5                	mov    %esp,%ebp
+  801790:	57                   	push   %edi
+  801791:	56                   	push   %esi
+  801792:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801793:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80179a:	74 1a                	je     8017b6 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80179c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a9:	89 cb                	mov    %ecx,%ebx
+  8017ab:	89 cf                	mov    %ecx,%edi
+  8017ad:	89 ce                	mov    %ecx,%esi
+  8017af:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017b1:	5b                   	pop    %ebx
+  8017b2:	5e                   	pop    %esi
+  8017b3:	5f                   	pop    %edi
+  8017b4:	5d                   	pop    %ebp
+  8017b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017be:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017c3:	89 cb                	mov    %ecx,%ebx
+  8017c5:	89 cf                	mov    %ecx,%edi
+  8017c7:	55                   	push   %ebp
+  8017c8:	89 e5                	mov    %esp,%ebp
+  8017ca:	8d 35 d2 17 80 00    	lea    0x8017d2,%esi
+  8017d0:	0f 34                	sysenter
+  8017d2:	5d                   	pop    %ebp
+		goto out;
+  8017d3:	eb dc                	jmp    8017b1 <sys_sb16_read_version+0x24>
+
+008017d5 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017d5:	55                   	push   %ebp
+  8017d6:	89 e5                	mov    %esp,%ebp
+  8017d8:	57                   	push   %edi
+  8017d9:	56                   	push   %esi
+  8017da:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017db:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017e2:	74 1b                	je     8017ff <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f4:	89 df                	mov    %ebx,%edi
+  8017f6:	89 de                	mov    %ebx,%esi
+  8017f8:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017fa:	5b                   	pop    %ebx
+  8017fb:	5e                   	pop    %esi
+  8017fc:	5f                   	pop    %edi
+  8017fd:	5d                   	pop    %ebp
+  8017fe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801804:	8b 55 08             	mov    0x8(%ebp),%edx
+  801807:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80180a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80180f:	89 df                	mov    %ebx,%edi
+  801811:	55                   	push   %ebp
+  801812:	89 e5                	mov    %esp,%ebp
+  801814:	8d 35 1c 18 80 00    	lea    0x80181c,%esi
+  80181a:	0f 34                	sysenter
+  80181c:	5d                   	pop    %ebp
+		goto out;
+  80181d:	eb db                	jmp    8017fa <sys_sb16_play+0x25>
+
+0080181f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  801825:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  80182c:	74 0a                	je     801838 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80182e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801831:	a3 10 50 80 00       	mov    %eax,0x805010
+}
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  801838:	83 ec 04             	sub    $0x4,%esp
+  80183b:	6a 07                	push   $0x7
+  80183d:	68 00 f0 bf ee       	push   $0xeebff000
+  801842:	6a 00                	push   $0x0
+  801844:	e8 60 f5 ff ff       	call   800da9 <sys_page_alloc>
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	85 c0                	test   %eax,%eax
+  80184e:	78 14                	js     801864 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801850:	83 ec 08             	sub    $0x8,%esp
+  801853:	68 86 18 80 00       	push   $0x801886
+  801858:	6a 00                	push   $0x0
+  80185a:	e8 66 f7 ff ff       	call   800fc5 <sys_env_set_pgfault_upcall>
+  80185f:	83 c4 10             	add    $0x10,%esp
+  801862:	eb ca                	jmp    80182e <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  801864:	83 ec 08             	sub    $0x8,%esp
+  801867:	50                   	push   %eax
+  801868:	68 96 30 80 00       	push   $0x803096
+  80186d:	e8 f7 e9 ff ff       	call   800269 <cprintf>
+			panic("set_pgfault_handler error");
+  801872:	83 c4 0c             	add    $0xc,%esp
+  801875:	68 a1 30 80 00       	push   $0x8030a1
+  80187a:	6a 24                	push   $0x24
+  80187c:	68 bb 30 80 00       	push   $0x8030bb
+  801881:	e8 08 e9 ff ff       	call   80018e <_panic>
+
+00801886 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801886:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801887:	a1 10 50 80 00       	mov    0x805010,%eax
+	call *%eax
+  80188c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80188e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  801891:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  801895:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  801898:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  80189c:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  80189e:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  8018a2:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8018a3:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  8018a7:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  8018a8:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  8018a9:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8018ad:	c3                   	ret
+
+008018ae <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018ae:	55                   	push   %ebp
+  8018af:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018b9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018bc:	5d                   	pop    %ebp
+  8018bd:	c3                   	ret
+
+008018be <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018c9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018ce:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018d3:	5d                   	pop    %ebp
+  8018d4:	c3                   	ret
+
+008018d5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018d8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018dd:	eb 02                	jmp    8018e1 <fd_alloc+0xc>
+  8018df:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018e1:	89 c2                	mov    %eax,%edx
+  8018e3:	c1 ea 16             	shr    $0x16,%edx
+  8018e6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018ed:	f6 c2 01             	test   $0x1,%dl
+  8018f0:	74 2b                	je     80191d <fd_alloc+0x48>
+  8018f2:	89 c2                	mov    %eax,%edx
+  8018f4:	c1 ea 0c             	shr    $0xc,%edx
+  8018f7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018fe:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801904:	f6 c1 01             	test   $0x1,%cl
+  801907:	74 14                	je     80191d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801909:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80190f:	75 ce                	jne    8018df <fd_alloc+0xa>
+  801911:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801916:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80191b:	eb 05                	jmp    801922 <fd_alloc+0x4d>
+			return 0;
+  80191d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801922:	8b 55 08             	mov    0x8(%ebp),%edx
+  801925:	89 02                	mov    %eax,(%edx)
+}
+  801927:	89 c8                	mov    %ecx,%eax
+  801929:	5d                   	pop    %ebp
+  80192a:	c3                   	ret
+
+0080192b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80192b:	55                   	push   %ebp
+  80192c:	89 e5                	mov    %esp,%ebp
+  80192e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801931:	83 f8 1f             	cmp    $0x1f,%eax
+  801934:	77 30                	ja     801966 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801936:	c1 e0 0c             	shl    $0xc,%eax
+  801939:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80193e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801944:	f6 c2 01             	test   $0x1,%dl
+  801947:	74 24                	je     80196d <fd_lookup+0x42>
+  801949:	89 c2                	mov    %eax,%edx
+  80194b:	c1 ea 0c             	shr    $0xc,%edx
+  80194e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801955:	f6 c2 01             	test   $0x1,%dl
+  801958:	74 1a                	je     801974 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80195a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80195d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80195f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801964:	5d                   	pop    %ebp
+  801965:	c3                   	ret
+		return -E_INVAL;
+  801966:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80196b:	eb f7                	jmp    801964 <fd_lookup+0x39>
+		return -E_INVAL;
+  80196d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801972:	eb f0                	jmp    801964 <fd_lookup+0x39>
+  801974:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801979:	eb e9                	jmp    801964 <fd_lookup+0x39>
+
+0080197b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80197b:	55                   	push   %ebp
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	53                   	push   %ebx
+  80197f:	83 ec 04             	sub    $0x4,%esp
+  801982:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198a:	eb 03                	jmp    80198f <dev_lookup+0x14>
+  80198c:	83 c0 01             	add    $0x1,%eax
+  80198f:	8b 1c 85 48 31 80 00 	mov    0x803148(,%eax,4),%ebx
+  801996:	85 db                	test   %ebx,%ebx
+  801998:	74 0b                	je     8019a5 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80199a:	39 13                	cmp    %edx,(%ebx)
+  80199c:	75 ee                	jne    80198c <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80199e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a3:	eb 2e                	jmp    8019d3 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8019a5:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8019a7:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8019ac:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8019b2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8019b7:	76 24                	jbe    8019dd <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019b9:	8b 41 48             	mov    0x48(%ecx),%eax
+  8019bc:	83 ec 04             	sub    $0x4,%esp
+  8019bf:	52                   	push   %edx
+  8019c0:	50                   	push   %eax
+  8019c1:	68 cc 30 80 00       	push   $0x8030cc
+  8019c6:	e8 9e e8 ff ff       	call   800269 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019d6:	89 1a                	mov    %ebx,(%edx)
+}
+  8019d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019db:	c9                   	leave
+  8019dc:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8019dd:	c1 e8 10             	shr    $0x10,%eax
+  8019e0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8019e6:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8019ec:	eb cb                	jmp    8019b9 <dev_lookup+0x3e>
+
+008019ee <fd_close>:
+{
+  8019ee:	55                   	push   %ebp
+  8019ef:	89 e5                	mov    %esp,%ebp
+  8019f1:	57                   	push   %edi
+  8019f2:	56                   	push   %esi
+  8019f3:	53                   	push   %ebx
+  8019f4:	83 ec 24             	sub    $0x24,%esp
+  8019f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019fa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019fd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a00:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a01:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a07:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a0a:	50                   	push   %eax
+  801a0b:	e8 1b ff ff ff       	call   80192b <fd_lookup>
+  801a10:	89 c3                	mov    %eax,%ebx
+  801a12:	83 c4 10             	add    $0x10,%esp
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	78 05                	js     801a1e <fd_close+0x30>
+	    || fd != fd2)
+  801a19:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a1c:	74 16                	je     801a34 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a1e:	89 f8                	mov    %edi,%eax
+  801a20:	84 c0                	test   %al,%al
+  801a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a27:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a2a:	89 d8                	mov    %ebx,%eax
+  801a2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a2f:	5b                   	pop    %ebx
+  801a30:	5e                   	pop    %esi
+  801a31:	5f                   	pop    %edi
+  801a32:	5d                   	pop    %ebp
+  801a33:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a34:	83 ec 08             	sub    $0x8,%esp
+  801a37:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a3a:	50                   	push   %eax
+  801a3b:	ff 36                	push   (%esi)
+  801a3d:	e8 39 ff ff ff       	call   80197b <dev_lookup>
+  801a42:	89 c3                	mov    %eax,%ebx
+  801a44:	83 c4 10             	add    $0x10,%esp
+  801a47:	85 c0                	test   %eax,%eax
+  801a49:	78 1a                	js     801a65 <fd_close+0x77>
+		if (dev->dev_close)
+  801a4b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a4e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a51:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	74 0b                	je     801a65 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a5a:	83 ec 0c             	sub    $0xc,%esp
+  801a5d:	56                   	push   %esi
+  801a5e:	ff d0                	call   *%eax
+  801a60:	89 c3                	mov    %eax,%ebx
+  801a62:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a65:	83 ec 08             	sub    $0x8,%esp
+  801a68:	56                   	push   %esi
+  801a69:	6a 00                	push   $0x0
+  801a6b:	e8 14 f4 ff ff       	call   800e84 <sys_page_unmap>
+	return r;
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	eb b5                	jmp    801a2a <fd_close+0x3c>
+
+00801a75 <close>:
+
+int
+close(int fdnum)
+{
+  801a75:	55                   	push   %ebp
+  801a76:	89 e5                	mov    %esp,%ebp
+  801a78:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a7e:	50                   	push   %eax
+  801a7f:	ff 75 08             	push   0x8(%ebp)
+  801a82:	e8 a4 fe ff ff       	call   80192b <fd_lookup>
+  801a87:	83 c4 10             	add    $0x10,%esp
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	79 02                	jns    801a90 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a8e:	c9                   	leave
+  801a8f:	c3                   	ret
+		return fd_close(fd, 1);
+  801a90:	83 ec 08             	sub    $0x8,%esp
+  801a93:	6a 01                	push   $0x1
+  801a95:	ff 75 f4             	push   -0xc(%ebp)
+  801a98:	e8 51 ff ff ff       	call   8019ee <fd_close>
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	eb ec                	jmp    801a8e <close+0x19>
+
+00801aa2 <close_all>:
+
+void
+close_all(void)
+{
+  801aa2:	55                   	push   %ebp
+  801aa3:	89 e5                	mov    %esp,%ebp
+  801aa5:	53                   	push   %ebx
+  801aa6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801aa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801aae:	83 ec 0c             	sub    $0xc,%esp
+  801ab1:	53                   	push   %ebx
+  801ab2:	e8 be ff ff ff       	call   801a75 <close>
+	for (i = 0; i < MAXFD; i++)
+  801ab7:	83 c3 01             	add    $0x1,%ebx
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	83 fb 20             	cmp    $0x20,%ebx
+  801ac0:	75 ec                	jne    801aae <close_all+0xc>
+}
+  801ac2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac5:	c9                   	leave
+  801ac6:	c3                   	ret
+
+00801ac7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+  801aca:	57                   	push   %edi
+  801acb:	56                   	push   %esi
+  801acc:	53                   	push   %ebx
+  801acd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ad0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ad3:	50                   	push   %eax
+  801ad4:	ff 75 08             	push   0x8(%ebp)
+  801ad7:	e8 4f fe ff ff       	call   80192b <fd_lookup>
+  801adc:	89 c3                	mov    %eax,%ebx
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	78 7f                	js     801b64 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ae5:	83 ec 0c             	sub    $0xc,%esp
+  801ae8:	ff 75 0c             	push   0xc(%ebp)
+  801aeb:	e8 85 ff ff ff       	call   801a75 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801af0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801af3:	c1 e6 0c             	shl    $0xc,%esi
+  801af6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801afc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801aff:	89 3c 24             	mov    %edi,(%esp)
+  801b02:	e8 b7 fd ff ff       	call   8018be <fd2data>
+  801b07:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b09:	89 34 24             	mov    %esi,(%esp)
+  801b0c:	e8 ad fd ff ff       	call   8018be <fd2data>
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b17:	89 d8                	mov    %ebx,%eax
+  801b19:	c1 e8 16             	shr    $0x16,%eax
+  801b1c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b23:	a8 01                	test   $0x1,%al
+  801b25:	74 11                	je     801b38 <dup+0x71>
+  801b27:	89 d8                	mov    %ebx,%eax
+  801b29:	c1 e8 0c             	shr    $0xc,%eax
+  801b2c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b33:	f6 c2 01             	test   $0x1,%dl
+  801b36:	75 36                	jne    801b6e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b38:	89 f8                	mov    %edi,%eax
+  801b3a:	c1 e8 0c             	shr    $0xc,%eax
+  801b3d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b44:	83 ec 0c             	sub    $0xc,%esp
+  801b47:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b4c:	50                   	push   %eax
+  801b4d:	56                   	push   %esi
+  801b4e:	6a 00                	push   $0x0
+  801b50:	57                   	push   %edi
+  801b51:	6a 00                	push   $0x0
+  801b53:	e8 be f2 ff ff       	call   800e16 <sys_page_map>
+  801b58:	89 c3                	mov    %eax,%ebx
+  801b5a:	83 c4 20             	add    $0x20,%esp
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 33                	js     801b94 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b61:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b64:	89 d8                	mov    %ebx,%eax
+  801b66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b69:	5b                   	pop    %ebx
+  801b6a:	5e                   	pop    %esi
+  801b6b:	5f                   	pop    %edi
+  801b6c:	5d                   	pop    %ebp
+  801b6d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b6e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b75:	83 ec 0c             	sub    $0xc,%esp
+  801b78:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b7d:	50                   	push   %eax
+  801b7e:	ff 75 d4             	push   -0x2c(%ebp)
+  801b81:	6a 00                	push   $0x0
+  801b83:	53                   	push   %ebx
+  801b84:	6a 00                	push   $0x0
+  801b86:	e8 8b f2 ff ff       	call   800e16 <sys_page_map>
+  801b8b:	89 c3                	mov    %eax,%ebx
+  801b8d:	83 c4 20             	add    $0x20,%esp
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	79 a4                	jns    801b38 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b94:	83 ec 08             	sub    $0x8,%esp
+  801b97:	56                   	push   %esi
+  801b98:	6a 00                	push   $0x0
+  801b9a:	e8 e5 f2 ff ff       	call   800e84 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b9f:	83 c4 08             	add    $0x8,%esp
+  801ba2:	ff 75 d4             	push   -0x2c(%ebp)
+  801ba5:	6a 00                	push   $0x0
+  801ba7:	e8 d8 f2 ff ff       	call   800e84 <sys_page_unmap>
+	return r;
+  801bac:	83 c4 10             	add    $0x10,%esp
+  801baf:	eb b3                	jmp    801b64 <dup+0x9d>
+
+00801bb1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801bb1:	55                   	push   %ebp
+  801bb2:	89 e5                	mov    %esp,%ebp
+  801bb4:	56                   	push   %esi
+  801bb5:	53                   	push   %ebx
+  801bb6:	83 ec 18             	sub    $0x18,%esp
+  801bb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bbc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bbf:	50                   	push   %eax
+  801bc0:	53                   	push   %ebx
+  801bc1:	e8 65 fd ff ff       	call   80192b <fd_lookup>
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	78 3c                	js     801c09 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bcd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bd0:	83 ec 08             	sub    $0x8,%esp
+  801bd3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd6:	50                   	push   %eax
+  801bd7:	ff 36                	push   (%esi)
+  801bd9:	e8 9d fd ff ff       	call   80197b <dev_lookup>
+  801bde:	83 c4 10             	add    $0x10,%esp
+  801be1:	85 c0                	test   %eax,%eax
+  801be3:	78 24                	js     801c09 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801be5:	8b 46 08             	mov    0x8(%esi),%eax
+  801be8:	83 e0 03             	and    $0x3,%eax
+  801beb:	83 f8 01             	cmp    $0x1,%eax
+  801bee:	74 20                	je     801c10 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801bf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bf3:	8b 40 08             	mov    0x8(%eax),%eax
+  801bf6:	85 c0                	test   %eax,%eax
+  801bf8:	74 57                	je     801c51 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bfa:	83 ec 04             	sub    $0x4,%esp
+  801bfd:	ff 75 10             	push   0x10(%ebp)
+  801c00:	ff 75 0c             	push   0xc(%ebp)
+  801c03:	56                   	push   %esi
+  801c04:	ff d0                	call   *%eax
+  801c06:	83 c4 10             	add    $0x10,%esp
+}
+  801c09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c0c:	5b                   	pop    %ebx
+  801c0d:	5e                   	pop    %esi
+  801c0e:	5d                   	pop    %ebp
+  801c0f:	c3                   	ret
+  801c10:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c12:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c17:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c1d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c22:	76 1c                	jbe    801c40 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c24:	8b 42 48             	mov    0x48(%edx),%eax
+  801c27:	83 ec 04             	sub    $0x4,%esp
+  801c2a:	53                   	push   %ebx
+  801c2b:	50                   	push   %eax
+  801c2c:	68 0d 31 80 00       	push   $0x80310d
+  801c31:	e8 33 e6 ff ff       	call   800269 <cprintf>
+		return -E_INVAL;
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3e:	eb c9                	jmp    801c09 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c40:	c1 e8 10             	shr    $0x10,%eax
+  801c43:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c49:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c4f:	eb d3                	jmp    801c24 <read+0x73>
+		return -E_NOT_SUPP;
+  801c51:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c56:	eb b1                	jmp    801c09 <read+0x58>
+
+00801c58 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c58:	55                   	push   %ebp
+  801c59:	89 e5                	mov    %esp,%ebp
+  801c5b:	57                   	push   %edi
+  801c5c:	56                   	push   %esi
+  801c5d:	53                   	push   %ebx
+  801c5e:	83 ec 0c             	sub    $0xc,%esp
+  801c61:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c64:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c6c:	eb 02                	jmp    801c70 <readn+0x18>
+  801c6e:	01 c3                	add    %eax,%ebx
+  801c70:	39 f3                	cmp    %esi,%ebx
+  801c72:	73 21                	jae    801c95 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c74:	83 ec 04             	sub    $0x4,%esp
+  801c77:	89 f0                	mov    %esi,%eax
+  801c79:	29 d8                	sub    %ebx,%eax
+  801c7b:	50                   	push   %eax
+  801c7c:	89 d8                	mov    %ebx,%eax
+  801c7e:	03 45 0c             	add    0xc(%ebp),%eax
+  801c81:	50                   	push   %eax
+  801c82:	57                   	push   %edi
+  801c83:	e8 29 ff ff ff       	call   801bb1 <read>
+		if (m < 0)
+  801c88:	83 c4 10             	add    $0x10,%esp
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 04                	js     801c93 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c8f:	75 dd                	jne    801c6e <readn+0x16>
+  801c91:	eb 02                	jmp    801c95 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c93:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c95:	89 d8                	mov    %ebx,%eax
+  801c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c9a:	5b                   	pop    %ebx
+  801c9b:	5e                   	pop    %esi
+  801c9c:	5f                   	pop    %edi
+  801c9d:	5d                   	pop    %ebp
+  801c9e:	c3                   	ret
+
+00801c9f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c9f:	55                   	push   %ebp
+  801ca0:	89 e5                	mov    %esp,%ebp
+  801ca2:	56                   	push   %esi
+  801ca3:	53                   	push   %ebx
+  801ca4:	83 ec 18             	sub    $0x18,%esp
+  801ca7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801caa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cad:	50                   	push   %eax
+  801cae:	53                   	push   %ebx
+  801caf:	e8 77 fc ff ff       	call   80192b <fd_lookup>
+  801cb4:	83 c4 10             	add    $0x10,%esp
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	78 37                	js     801cf2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cbb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cbe:	83 ec 08             	sub    $0x8,%esp
+  801cc1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cc4:	50                   	push   %eax
+  801cc5:	ff 36                	push   (%esi)
+  801cc7:	e8 af fc ff ff       	call   80197b <dev_lookup>
+  801ccc:	83 c4 10             	add    $0x10,%esp
+  801ccf:	85 c0                	test   %eax,%eax
+  801cd1:	78 1f                	js     801cf2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cd3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cd7:	74 20                	je     801cf9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cdc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	74 57                	je     801d3a <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801ce3:	83 ec 04             	sub    $0x4,%esp
+  801ce6:	ff 75 10             	push   0x10(%ebp)
+  801ce9:	ff 75 0c             	push   0xc(%ebp)
+  801cec:	56                   	push   %esi
+  801ced:	ff d0                	call   *%eax
+  801cef:	83 c4 10             	add    $0x10,%esp
+}
+  801cf2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf5:	5b                   	pop    %ebx
+  801cf6:	5e                   	pop    %esi
+  801cf7:	5d                   	pop    %ebp
+  801cf8:	c3                   	ret
+  801cf9:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cfb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d00:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d06:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d0b:	76 1c                	jbe    801d29 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d0d:	8b 42 48             	mov    0x48(%edx),%eax
+  801d10:	83 ec 04             	sub    $0x4,%esp
+  801d13:	53                   	push   %ebx
+  801d14:	50                   	push   %eax
+  801d15:	68 29 31 80 00       	push   $0x803129
+  801d1a:	e8 4a e5 ff ff       	call   800269 <cprintf>
+		return -E_INVAL;
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d27:	eb c9                	jmp    801cf2 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d29:	c1 e8 10             	shr    $0x10,%eax
+  801d2c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d32:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d38:	eb d3                	jmp    801d0d <write+0x6e>
+		return -E_NOT_SUPP;
+  801d3a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d3f:	eb b1                	jmp    801cf2 <write+0x53>
+
+00801d41 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d41:	55                   	push   %ebp
+  801d42:	89 e5                	mov    %esp,%ebp
+  801d44:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d47:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4a:	50                   	push   %eax
+  801d4b:	ff 75 08             	push   0x8(%ebp)
+  801d4e:	e8 d8 fb ff ff       	call   80192b <fd_lookup>
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 0e                	js     801d68 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d60:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d68:	c9                   	leave
+  801d69:	c3                   	ret
+
+00801d6a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d6a:	55                   	push   %ebp
+  801d6b:	89 e5                	mov    %esp,%ebp
+  801d6d:	56                   	push   %esi
+  801d6e:	53                   	push   %ebx
+  801d6f:	83 ec 18             	sub    $0x18,%esp
+  801d72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d75:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d78:	50                   	push   %eax
+  801d79:	53                   	push   %ebx
+  801d7a:	e8 ac fb ff ff       	call   80192b <fd_lookup>
+  801d7f:	83 c4 10             	add    $0x10,%esp
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	78 34                	js     801dba <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d86:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d89:	83 ec 08             	sub    $0x8,%esp
+  801d8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d8f:	50                   	push   %eax
+  801d90:	ff 36                	push   (%esi)
+  801d92:	e8 e4 fb ff ff       	call   80197b <dev_lookup>
+  801d97:	83 c4 10             	add    $0x10,%esp
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	78 1c                	js     801dba <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d9e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801da2:	74 1d                	je     801dc1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801da4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da7:	8b 40 18             	mov    0x18(%eax),%eax
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	74 54                	je     801e02 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801dae:	83 ec 08             	sub    $0x8,%esp
+  801db1:	ff 75 0c             	push   0xc(%ebp)
+  801db4:	56                   	push   %esi
+  801db5:	ff d0                	call   *%eax
+  801db7:	83 c4 10             	add    $0x10,%esp
+}
+  801dba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dbd:	5b                   	pop    %ebx
+  801dbe:	5e                   	pop    %esi
+  801dbf:	5d                   	pop    %ebp
+  801dc0:	c3                   	ret
+  801dc1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dc3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801dc8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dce:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801dd3:	76 1c                	jbe    801df1 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801dd5:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dd8:	83 ec 04             	sub    $0x4,%esp
+  801ddb:	53                   	push   %ebx
+  801ddc:	50                   	push   %eax
+  801ddd:	68 ec 30 80 00       	push   $0x8030ec
+  801de2:	e8 82 e4 ff ff       	call   800269 <cprintf>
+		return -E_INVAL;
+  801de7:	83 c4 10             	add    $0x10,%esp
+  801dea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801def:	eb c9                	jmp    801dba <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801df1:	c1 e8 10             	shr    $0x10,%eax
+  801df4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dfa:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e00:	eb d3                	jmp    801dd5 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801e02:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e07:	eb b1                	jmp    801dba <ftruncate+0x50>
+
+00801e09 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e09:	55                   	push   %ebp
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	56                   	push   %esi
+  801e0d:	53                   	push   %ebx
+  801e0e:	83 ec 18             	sub    $0x18,%esp
+  801e11:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e14:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e17:	50                   	push   %eax
+  801e18:	ff 75 08             	push   0x8(%ebp)
+  801e1b:	e8 0b fb ff ff       	call   80192b <fd_lookup>
+  801e20:	83 c4 10             	add    $0x10,%esp
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	78 49                	js     801e70 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e27:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e2a:	83 ec 08             	sub    $0x8,%esp
+  801e2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e30:	50                   	push   %eax
+  801e31:	ff 36                	push   (%esi)
+  801e33:	e8 43 fb ff ff       	call   80197b <dev_lookup>
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 31                	js     801e70 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e42:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e46:	74 2f                	je     801e77 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e48:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e4b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e52:	00 00 00 
+	stat->st_isdir = 0;
+  801e55:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e5c:	00 00 00 
+	stat->st_dev = dev;
+  801e5f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e65:	83 ec 08             	sub    $0x8,%esp
+  801e68:	53                   	push   %ebx
+  801e69:	56                   	push   %esi
+  801e6a:	ff 50 14             	call   *0x14(%eax)
+  801e6d:	83 c4 10             	add    $0x10,%esp
+}
+  801e70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e73:	5b                   	pop    %ebx
+  801e74:	5e                   	pop    %esi
+  801e75:	5d                   	pop    %ebp
+  801e76:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e77:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e7c:	eb f2                	jmp    801e70 <fstat+0x67>
+
+00801e7e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e7e:	55                   	push   %ebp
+  801e7f:	89 e5                	mov    %esp,%ebp
+  801e81:	56                   	push   %esi
+  801e82:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e83:	83 ec 08             	sub    $0x8,%esp
+  801e86:	6a 00                	push   $0x0
+  801e88:	ff 75 08             	push   0x8(%ebp)
+  801e8b:	e8 e4 01 00 00       	call   802074 <open>
+  801e90:	89 c3                	mov    %eax,%ebx
+  801e92:	83 c4 10             	add    $0x10,%esp
+  801e95:	85 c0                	test   %eax,%eax
+  801e97:	78 1b                	js     801eb4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e99:	83 ec 08             	sub    $0x8,%esp
+  801e9c:	ff 75 0c             	push   0xc(%ebp)
+  801e9f:	50                   	push   %eax
+  801ea0:	e8 64 ff ff ff       	call   801e09 <fstat>
+  801ea5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ea7:	89 1c 24             	mov    %ebx,(%esp)
+  801eaa:	e8 c6 fb ff ff       	call   801a75 <close>
+	return r;
+  801eaf:	83 c4 10             	add    $0x10,%esp
+  801eb2:	89 f3                	mov    %esi,%ebx
+}
+  801eb4:	89 d8                	mov    %ebx,%eax
+  801eb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb9:	5b                   	pop    %ebx
+  801eba:	5e                   	pop    %esi
+  801ebb:	5d                   	pop    %ebp
+  801ebc:	c3                   	ret
+
+00801ebd <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	56                   	push   %esi
+  801ec1:	53                   	push   %ebx
+  801ec2:	89 c6                	mov    %eax,%esi
+  801ec4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ec6:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801ecd:	74 27                	je     801ef6 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ecf:	6a 07                	push   $0x7
+  801ed1:	68 00 60 80 00       	push   $0x806000
+  801ed6:	56                   	push   %esi
+  801ed7:	ff 35 00 50 80 00    	push   0x805000
+  801edd:	e8 b2 0c 00 00       	call   802b94 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ee2:	83 c4 0c             	add    $0xc,%esp
+  801ee5:	6a 00                	push   $0x0
+  801ee7:	53                   	push   %ebx
+  801ee8:	6a 00                	push   $0x0
+  801eea:	e8 8d 0c 00 00       	call   802b7c <ipc_recv>
+}
+  801eef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef2:	5b                   	pop    %ebx
+  801ef3:	5e                   	pop    %esi
+  801ef4:	5d                   	pop    %ebp
+  801ef5:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ef6:	83 ec 0c             	sub    $0xc,%esp
+  801ef9:	6a 01                	push   $0x1
+  801efb:	e8 e8 0c 00 00       	call   802be8 <ipc_find_env>
+  801f00:	a3 00 50 80 00       	mov    %eax,0x805000
+  801f05:	83 c4 10             	add    $0x10,%esp
+  801f08:	eb c5                	jmp    801ecf <fsipc+0x12>
+
+00801f0a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f0a:	55                   	push   %ebp
+  801f0b:	89 e5                	mov    %esp,%ebp
+  801f0d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f13:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f16:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801f1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f1e:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f28:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f2d:	e8 8b ff ff ff       	call   801ebd <fsipc>
+}
+  801f32:	c9                   	leave
+  801f33:	c3                   	ret
+
+00801f34 <devfile_flush>:
+{
+  801f34:	55                   	push   %ebp
+  801f35:	89 e5                	mov    %esp,%ebp
+  801f37:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f40:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f4f:	e8 69 ff ff ff       	call   801ebd <fsipc>
+}
+  801f54:	c9                   	leave
+  801f55:	c3                   	ret
+
+00801f56 <devfile_stat>:
+{
+  801f56:	55                   	push   %ebp
+  801f57:	89 e5                	mov    %esp,%ebp
+  801f59:	53                   	push   %ebx
+  801f5a:	83 ec 04             	sub    $0x4,%esp
+  801f5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f63:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f66:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f70:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f75:	e8 43 ff ff ff       	call   801ebd <fsipc>
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	78 2c                	js     801faa <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f7e:	83 ec 08             	sub    $0x8,%esp
+  801f81:	68 00 60 80 00       	push   $0x806000
+  801f86:	53                   	push   %ebx
+  801f87:	e8 25 e9 ff ff       	call   8008b1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f8c:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f91:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f97:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f9c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801fa2:	83 c4 10             	add    $0x10,%esp
+  801fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801faa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fad:	c9                   	leave
+  801fae:	c3                   	ret
+
+00801faf <devfile_write>:
+{
+  801faf:	55                   	push   %ebp
+  801fb0:	89 e5                	mov    %esp,%ebp
+  801fb2:	83 ec 0c             	sub    $0xc,%esp
+  801fb5:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fbb:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fbe:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801fc4:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801fc9:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fce:	39 d0                	cmp    %edx,%eax
+  801fd0:	0f 47 c2             	cmova  %edx,%eax
+  801fd3:	50                   	push   %eax
+  801fd4:	ff 75 0c             	push   0xc(%ebp)
+  801fd7:	68 08 60 80 00       	push   $0x806008
+  801fdc:	e8 56 ea ff ff       	call   800a37 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe6:	b8 04 00 00 00       	mov    $0x4,%eax
+  801feb:	e8 cd fe ff ff       	call   801ebd <fsipc>
+}
+  801ff0:	c9                   	leave
+  801ff1:	c3                   	ret
+
+00801ff2 <devfile_read>:
+{
+  801ff2:	55                   	push   %ebp
+  801ff3:	89 e5                	mov    %esp,%ebp
+  801ff5:	56                   	push   %esi
+  801ff6:	53                   	push   %ebx
+  801ff7:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ffa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffd:	8b 40 0c             	mov    0xc(%eax),%eax
+  802000:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802005:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80200b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802010:	b8 03 00 00 00       	mov    $0x3,%eax
+  802015:	e8 a3 fe ff ff       	call   801ebd <fsipc>
+  80201a:	89 c3                	mov    %eax,%ebx
+  80201c:	85 c0                	test   %eax,%eax
+  80201e:	78 1f                	js     80203f <devfile_read+0x4d>
+	assert(r <= n);
+  802020:	39 c6                	cmp    %eax,%esi
+  802022:	72 24                	jb     802048 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802024:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802029:	7f 33                	jg     80205e <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80202b:	83 ec 04             	sub    $0x4,%esp
+  80202e:	50                   	push   %eax
+  80202f:	68 00 60 80 00       	push   $0x806000
+  802034:	ff 75 0c             	push   0xc(%ebp)
+  802037:	e8 fb e9 ff ff       	call   800a37 <memmove>
+	return r;
+  80203c:	83 c4 10             	add    $0x10,%esp
+}
+  80203f:	89 d8                	mov    %ebx,%eax
+  802041:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802044:	5b                   	pop    %ebx
+  802045:	5e                   	pop    %esi
+  802046:	5d                   	pop    %ebp
+  802047:	c3                   	ret
+	assert(r <= n);
+  802048:	68 5c 31 80 00       	push   $0x80315c
+  80204d:	68 63 31 80 00       	push   $0x803163
+  802052:	6a 76                	push   $0x76
+  802054:	68 78 31 80 00       	push   $0x803178
+  802059:	e8 30 e1 ff ff       	call   80018e <_panic>
+	assert(r <= PGSIZE);
+  80205e:	68 83 31 80 00       	push   $0x803183
+  802063:	68 63 31 80 00       	push   $0x803163
+  802068:	6a 77                	push   $0x77
+  80206a:	68 78 31 80 00       	push   $0x803178
+  80206f:	e8 1a e1 ff ff       	call   80018e <_panic>
+
+00802074 <open>:
+{
+  802074:	55                   	push   %ebp
+  802075:	89 e5                	mov    %esp,%ebp
+  802077:	56                   	push   %esi
+  802078:	53                   	push   %ebx
+  802079:	83 ec 1c             	sub    $0x1c,%esp
+  80207c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80207f:	56                   	push   %esi
+  802080:	e8 f1 e7 ff ff       	call   800876 <strlen>
+  802085:	83 c4 10             	add    $0x10,%esp
+  802088:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80208d:	7f 6c                	jg     8020fb <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80208f:	83 ec 0c             	sub    $0xc,%esp
+  802092:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802095:	50                   	push   %eax
+  802096:	e8 3a f8 ff ff       	call   8018d5 <fd_alloc>
+  80209b:	89 c3                	mov    %eax,%ebx
+  80209d:	83 c4 10             	add    $0x10,%esp
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	78 3c                	js     8020e0 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8020a4:	83 ec 08             	sub    $0x8,%esp
+  8020a7:	56                   	push   %esi
+  8020a8:	68 00 60 80 00       	push   $0x806000
+  8020ad:	e8 ff e7 ff ff       	call   8008b1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020b5:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020c2:	e8 f6 fd ff ff       	call   801ebd <fsipc>
+  8020c7:	89 c3                	mov    %eax,%ebx
+  8020c9:	83 c4 10             	add    $0x10,%esp
+  8020cc:	85 c0                	test   %eax,%eax
+  8020ce:	78 19                	js     8020e9 <open+0x75>
+	return fd2num(fd);
+  8020d0:	83 ec 0c             	sub    $0xc,%esp
+  8020d3:	ff 75 f4             	push   -0xc(%ebp)
+  8020d6:	e8 d3 f7 ff ff       	call   8018ae <fd2num>
+  8020db:	89 c3                	mov    %eax,%ebx
+  8020dd:	83 c4 10             	add    $0x10,%esp
+}
+  8020e0:	89 d8                	mov    %ebx,%eax
+  8020e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e5:	5b                   	pop    %ebx
+  8020e6:	5e                   	pop    %esi
+  8020e7:	5d                   	pop    %ebp
+  8020e8:	c3                   	ret
+		fd_close(fd, 0);
+  8020e9:	83 ec 08             	sub    $0x8,%esp
+  8020ec:	6a 00                	push   $0x0
+  8020ee:	ff 75 f4             	push   -0xc(%ebp)
+  8020f1:	e8 f8 f8 ff ff       	call   8019ee <fd_close>
+		return r;
+  8020f6:	83 c4 10             	add    $0x10,%esp
+  8020f9:	eb e5                	jmp    8020e0 <open+0x6c>
+		return -E_BAD_PATH;
+  8020fb:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802100:	eb de                	jmp    8020e0 <open+0x6c>
+
+00802102 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802102:	55                   	push   %ebp
+  802103:	89 e5                	mov    %esp,%ebp
+  802105:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80210d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802112:	e8 a6 fd ff ff       	call   801ebd <fsipc>
+}
+  802117:	c9                   	leave
+  802118:	c3                   	ret
+
+00802119 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802119:	55                   	push   %ebp
+  80211a:	89 e5                	mov    %esp,%ebp
+  80211c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80211f:	68 8f 31 80 00       	push   $0x80318f
+  802124:	ff 75 0c             	push   0xc(%ebp)
+  802127:	e8 85 e7 ff ff       	call   8008b1 <strcpy>
+	return 0;
+}
+  80212c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802131:	c9                   	leave
+  802132:	c3                   	ret
+
+00802133 <devsock_close>:
+{
+  802133:	55                   	push   %ebp
+  802134:	89 e5                	mov    %esp,%ebp
+  802136:	53                   	push   %ebx
+  802137:	83 ec 10             	sub    $0x10,%esp
+  80213a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80213d:	53                   	push   %ebx
+  80213e:	e8 e4 0a 00 00       	call   802c27 <pageref>
+  802143:	89 c2                	mov    %eax,%edx
+  802145:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802148:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80214d:	83 fa 01             	cmp    $0x1,%edx
+  802150:	74 05                	je     802157 <devsock_close+0x24>
+}
+  802152:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802155:	c9                   	leave
+  802156:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802157:	83 ec 0c             	sub    $0xc,%esp
+  80215a:	ff 73 0c             	push   0xc(%ebx)
+  80215d:	e8 b7 02 00 00       	call   802419 <nsipc_close>
+  802162:	83 c4 10             	add    $0x10,%esp
+  802165:	eb eb                	jmp    802152 <devsock_close+0x1f>
+
+00802167 <devsock_write>:
+{
+  802167:	55                   	push   %ebp
+  802168:	89 e5                	mov    %esp,%ebp
+  80216a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80216d:	6a 00                	push   $0x0
+  80216f:	ff 75 10             	push   0x10(%ebp)
+  802172:	ff 75 0c             	push   0xc(%ebp)
+  802175:	8b 45 08             	mov    0x8(%ebp),%eax
+  802178:	ff 70 0c             	push   0xc(%eax)
+  80217b:	e8 79 03 00 00       	call   8024f9 <nsipc_send>
+}
+  802180:	c9                   	leave
+  802181:	c3                   	ret
+
+00802182 <devsock_read>:
+{
+  802182:	55                   	push   %ebp
+  802183:	89 e5                	mov    %esp,%ebp
+  802185:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802188:	6a 00                	push   $0x0
+  80218a:	ff 75 10             	push   0x10(%ebp)
+  80218d:	ff 75 0c             	push   0xc(%ebp)
+  802190:	8b 45 08             	mov    0x8(%ebp),%eax
+  802193:	ff 70 0c             	push   0xc(%eax)
+  802196:	e8 ef 02 00 00       	call   80248a <nsipc_recv>
+}
+  80219b:	c9                   	leave
+  80219c:	c3                   	ret
+
+0080219d <fd2sockid>:
+{
+  80219d:	55                   	push   %ebp
+  80219e:	89 e5                	mov    %esp,%ebp
+  8021a0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8021a3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021a6:	52                   	push   %edx
+  8021a7:	50                   	push   %eax
+  8021a8:	e8 7e f7 ff ff       	call   80192b <fd_lookup>
+  8021ad:	83 c4 10             	add    $0x10,%esp
+  8021b0:	85 c0                	test   %eax,%eax
+  8021b2:	78 10                	js     8021c4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8021b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b7:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8021bd:	39 08                	cmp    %ecx,(%eax)
+  8021bf:	75 05                	jne    8021c6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8021c1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8021c4:	c9                   	leave
+  8021c5:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021c6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021cb:	eb f7                	jmp    8021c4 <fd2sockid+0x27>
+
+008021cd <alloc_sockfd>:
+{
+  8021cd:	55                   	push   %ebp
+  8021ce:	89 e5                	mov    %esp,%ebp
+  8021d0:	56                   	push   %esi
+  8021d1:	53                   	push   %ebx
+  8021d2:	83 ec 1c             	sub    $0x1c,%esp
+  8021d5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8021d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021da:	50                   	push   %eax
+  8021db:	e8 f5 f6 ff ff       	call   8018d5 <fd_alloc>
+  8021e0:	89 c3                	mov    %eax,%ebx
+  8021e2:	83 c4 10             	add    $0x10,%esp
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	78 43                	js     80222c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8021e9:	83 ec 04             	sub    $0x4,%esp
+  8021ec:	68 07 04 00 00       	push   $0x407
+  8021f1:	ff 75 f4             	push   -0xc(%ebp)
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	e8 ae eb ff ff       	call   800da9 <sys_page_alloc>
+  8021fb:	89 c3                	mov    %eax,%ebx
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	85 c0                	test   %eax,%eax
+  802202:	78 28                	js     80222c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802204:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802207:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80220d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80220f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802212:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802219:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80221c:	83 ec 0c             	sub    $0xc,%esp
+  80221f:	50                   	push   %eax
+  802220:	e8 89 f6 ff ff       	call   8018ae <fd2num>
+  802225:	89 c3                	mov    %eax,%ebx
+  802227:	83 c4 10             	add    $0x10,%esp
+  80222a:	eb 0c                	jmp    802238 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80222c:	83 ec 0c             	sub    $0xc,%esp
+  80222f:	56                   	push   %esi
+  802230:	e8 e4 01 00 00       	call   802419 <nsipc_close>
+		return r;
+  802235:	83 c4 10             	add    $0x10,%esp
+}
+  802238:	89 d8                	mov    %ebx,%eax
+  80223a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80223d:	5b                   	pop    %ebx
+  80223e:	5e                   	pop    %esi
+  80223f:	5d                   	pop    %ebp
+  802240:	c3                   	ret
+
+00802241 <accept>:
+{
+  802241:	55                   	push   %ebp
+  802242:	89 e5                	mov    %esp,%ebp
+  802244:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802247:	8b 45 08             	mov    0x8(%ebp),%eax
+  80224a:	e8 4e ff ff ff       	call   80219d <fd2sockid>
+  80224f:	85 c0                	test   %eax,%eax
+  802251:	78 1b                	js     80226e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802253:	83 ec 04             	sub    $0x4,%esp
+  802256:	ff 75 10             	push   0x10(%ebp)
+  802259:	ff 75 0c             	push   0xc(%ebp)
+  80225c:	50                   	push   %eax
+  80225d:	e8 0e 01 00 00       	call   802370 <nsipc_accept>
+  802262:	83 c4 10             	add    $0x10,%esp
+  802265:	85 c0                	test   %eax,%eax
+  802267:	78 05                	js     80226e <accept+0x2d>
+	return alloc_sockfd(r);
+  802269:	e8 5f ff ff ff       	call   8021cd <alloc_sockfd>
+}
+  80226e:	c9                   	leave
+  80226f:	c3                   	ret
+
+00802270 <bind>:
+{
+  802270:	55                   	push   %ebp
+  802271:	89 e5                	mov    %esp,%ebp
+  802273:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802276:	8b 45 08             	mov    0x8(%ebp),%eax
+  802279:	e8 1f ff ff ff       	call   80219d <fd2sockid>
+  80227e:	85 c0                	test   %eax,%eax
+  802280:	78 12                	js     802294 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802282:	83 ec 04             	sub    $0x4,%esp
+  802285:	ff 75 10             	push   0x10(%ebp)
+  802288:	ff 75 0c             	push   0xc(%ebp)
+  80228b:	50                   	push   %eax
+  80228c:	e8 31 01 00 00       	call   8023c2 <nsipc_bind>
+  802291:	83 c4 10             	add    $0x10,%esp
+}
+  802294:	c9                   	leave
+  802295:	c3                   	ret
+
+00802296 <shutdown>:
+{
+  802296:	55                   	push   %ebp
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80229c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229f:	e8 f9 fe ff ff       	call   80219d <fd2sockid>
+  8022a4:	85 c0                	test   %eax,%eax
+  8022a6:	78 0f                	js     8022b7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8022a8:	83 ec 08             	sub    $0x8,%esp
+  8022ab:	ff 75 0c             	push   0xc(%ebp)
+  8022ae:	50                   	push   %eax
+  8022af:	e8 43 01 00 00       	call   8023f7 <nsipc_shutdown>
+  8022b4:	83 c4 10             	add    $0x10,%esp
+}
+  8022b7:	c9                   	leave
+  8022b8:	c3                   	ret
+
+008022b9 <connect>:
+{
+  8022b9:	55                   	push   %ebp
+  8022ba:	89 e5                	mov    %esp,%ebp
+  8022bc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c2:	e8 d6 fe ff ff       	call   80219d <fd2sockid>
+  8022c7:	85 c0                	test   %eax,%eax
+  8022c9:	78 12                	js     8022dd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8022cb:	83 ec 04             	sub    $0x4,%esp
+  8022ce:	ff 75 10             	push   0x10(%ebp)
+  8022d1:	ff 75 0c             	push   0xc(%ebp)
+  8022d4:	50                   	push   %eax
+  8022d5:	e8 59 01 00 00       	call   802433 <nsipc_connect>
+  8022da:	83 c4 10             	add    $0x10,%esp
+}
+  8022dd:	c9                   	leave
+  8022de:	c3                   	ret
+
+008022df <listen>:
+{
+  8022df:	55                   	push   %ebp
+  8022e0:	89 e5                	mov    %esp,%ebp
+  8022e2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e8:	e8 b0 fe ff ff       	call   80219d <fd2sockid>
+  8022ed:	85 c0                	test   %eax,%eax
+  8022ef:	78 0f                	js     802300 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8022f1:	83 ec 08             	sub    $0x8,%esp
+  8022f4:	ff 75 0c             	push   0xc(%ebp)
+  8022f7:	50                   	push   %eax
+  8022f8:	e8 6b 01 00 00       	call   802468 <nsipc_listen>
+  8022fd:	83 c4 10             	add    $0x10,%esp
+}
+  802300:	c9                   	leave
+  802301:	c3                   	ret
+
+00802302 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802302:	55                   	push   %ebp
+  802303:	89 e5                	mov    %esp,%ebp
+  802305:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802308:	ff 75 10             	push   0x10(%ebp)
+  80230b:	ff 75 0c             	push   0xc(%ebp)
+  80230e:	ff 75 08             	push   0x8(%ebp)
+  802311:	e8 41 02 00 00       	call   802557 <nsipc_socket>
+  802316:	83 c4 10             	add    $0x10,%esp
+  802319:	85 c0                	test   %eax,%eax
+  80231b:	78 05                	js     802322 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80231d:	e8 ab fe ff ff       	call   8021cd <alloc_sockfd>
+}
+  802322:	c9                   	leave
+  802323:	c3                   	ret
+
+00802324 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	53                   	push   %ebx
+  802328:	83 ec 04             	sub    $0x4,%esp
+  80232b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80232d:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802334:	74 26                	je     80235c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802336:	6a 07                	push   $0x7
+  802338:	68 00 70 80 00       	push   $0x807000
+  80233d:	53                   	push   %ebx
+  80233e:	ff 35 04 50 80 00    	push   0x805004
+  802344:	e8 4b 08 00 00       	call   802b94 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802349:	83 c4 0c             	add    $0xc,%esp
+  80234c:	6a 00                	push   $0x0
+  80234e:	6a 00                	push   $0x0
+  802350:	6a 00                	push   $0x0
+  802352:	e8 25 08 00 00       	call   802b7c <ipc_recv>
+}
+  802357:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80235a:	c9                   	leave
+  80235b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80235c:	83 ec 0c             	sub    $0xc,%esp
+  80235f:	6a 02                	push   $0x2
+  802361:	e8 82 08 00 00       	call   802be8 <ipc_find_env>
+  802366:	a3 04 50 80 00       	mov    %eax,0x805004
+  80236b:	83 c4 10             	add    $0x10,%esp
+  80236e:	eb c6                	jmp    802336 <nsipc+0x12>
+
+00802370 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+  802373:	56                   	push   %esi
+  802374:	53                   	push   %ebx
+  802375:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802378:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802380:	8b 06                	mov    (%esi),%eax
+  802382:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802387:	b8 01 00 00 00       	mov    $0x1,%eax
+  80238c:	e8 93 ff ff ff       	call   802324 <nsipc>
+  802391:	89 c3                	mov    %eax,%ebx
+  802393:	85 c0                	test   %eax,%eax
+  802395:	79 09                	jns    8023a0 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802397:	89 d8                	mov    %ebx,%eax
+  802399:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80239c:	5b                   	pop    %ebx
+  80239d:	5e                   	pop    %esi
+  80239e:	5d                   	pop    %ebp
+  80239f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8023a0:	83 ec 04             	sub    $0x4,%esp
+  8023a3:	ff 35 10 70 80 00    	push   0x807010
+  8023a9:	68 00 70 80 00       	push   $0x807000
+  8023ae:	ff 75 0c             	push   0xc(%ebp)
+  8023b1:	e8 81 e6 ff ff       	call   800a37 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8023b6:	a1 10 70 80 00       	mov    0x807010,%eax
+  8023bb:	89 06                	mov    %eax,(%esi)
+  8023bd:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8023c0:	eb d5                	jmp    802397 <nsipc_accept+0x27>
+
+008023c2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8023c2:	55                   	push   %ebp
+  8023c3:	89 e5                	mov    %esp,%ebp
+  8023c5:	53                   	push   %ebx
+  8023c6:	83 ec 08             	sub    $0x8,%esp
+  8023c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8023cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023cf:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8023d4:	53                   	push   %ebx
+  8023d5:	ff 75 0c             	push   0xc(%ebp)
+  8023d8:	68 04 70 80 00       	push   $0x807004
+  8023dd:	e8 55 e6 ff ff       	call   800a37 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8023e2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8023e8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023ed:	e8 32 ff ff ff       	call   802324 <nsipc>
+}
+  8023f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f5:	c9                   	leave
+  8023f6:	c3                   	ret
+
+008023f7 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8023f7:	55                   	push   %ebp
+  8023f8:	89 e5                	mov    %esp,%ebp
+  8023fa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8023fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802400:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802405:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802408:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80240d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802412:	e8 0d ff ff ff       	call   802324 <nsipc>
+}
+  802417:	c9                   	leave
+  802418:	c3                   	ret
+
+00802419 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802419:	55                   	push   %ebp
+  80241a:	89 e5                	mov    %esp,%ebp
+  80241c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80241f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802422:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802427:	b8 04 00 00 00       	mov    $0x4,%eax
+  80242c:	e8 f3 fe ff ff       	call   802324 <nsipc>
+}
+  802431:	c9                   	leave
+  802432:	c3                   	ret
+
+00802433 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802433:	55                   	push   %ebp
+  802434:	89 e5                	mov    %esp,%ebp
+  802436:	53                   	push   %ebx
+  802437:	83 ec 08             	sub    $0x8,%esp
+  80243a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80243d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802440:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802445:	53                   	push   %ebx
+  802446:	ff 75 0c             	push   0xc(%ebp)
+  802449:	68 04 70 80 00       	push   $0x807004
+  80244e:	e8 e4 e5 ff ff       	call   800a37 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802453:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802459:	b8 05 00 00 00       	mov    $0x5,%eax
+  80245e:	e8 c1 fe ff ff       	call   802324 <nsipc>
+}
+  802463:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802466:	c9                   	leave
+  802467:	c3                   	ret
+
+00802468 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802468:	55                   	push   %ebp
+  802469:	89 e5                	mov    %esp,%ebp
+  80246b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80246e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802471:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802476:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802479:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80247e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802483:	e8 9c fe ff ff       	call   802324 <nsipc>
+}
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+
+0080248a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80248a:	55                   	push   %ebp
+  80248b:	89 e5                	mov    %esp,%ebp
+  80248d:	56                   	push   %esi
+  80248e:	53                   	push   %ebx
+  80248f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802492:	8b 45 08             	mov    0x8(%ebp),%eax
+  802495:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80249a:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8024a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024a3:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8024a8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024ad:	e8 72 fe ff ff       	call   802324 <nsipc>
+  8024b2:	89 c3                	mov    %eax,%ebx
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	78 22                	js     8024da <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8024b8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8024bd:	39 c6                	cmp    %eax,%esi
+  8024bf:	0f 4e c6             	cmovle %esi,%eax
+  8024c2:	39 c3                	cmp    %eax,%ebx
+  8024c4:	7f 1d                	jg     8024e3 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8024c6:	83 ec 04             	sub    $0x4,%esp
+  8024c9:	53                   	push   %ebx
+  8024ca:	68 00 70 80 00       	push   $0x807000
+  8024cf:	ff 75 0c             	push   0xc(%ebp)
+  8024d2:	e8 60 e5 ff ff       	call   800a37 <memmove>
+  8024d7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8024da:	89 d8                	mov    %ebx,%eax
+  8024dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024df:	5b                   	pop    %ebx
+  8024e0:	5e                   	pop    %esi
+  8024e1:	5d                   	pop    %ebp
+  8024e2:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8024e3:	68 9b 31 80 00       	push   $0x80319b
+  8024e8:	68 63 31 80 00       	push   $0x803163
+  8024ed:	6a 62                	push   $0x62
+  8024ef:	68 b0 31 80 00       	push   $0x8031b0
+  8024f4:	e8 95 dc ff ff       	call   80018e <_panic>
+
+008024f9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8024f9:	55                   	push   %ebp
+  8024fa:	89 e5                	mov    %esp,%ebp
+  8024fc:	53                   	push   %ebx
+  8024fd:	83 ec 04             	sub    $0x4,%esp
+  802500:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802503:	8b 45 08             	mov    0x8(%ebp),%eax
+  802506:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80250b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802511:	7f 2e                	jg     802541 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802513:	83 ec 04             	sub    $0x4,%esp
+  802516:	53                   	push   %ebx
+  802517:	ff 75 0c             	push   0xc(%ebp)
+  80251a:	68 0c 70 80 00       	push   $0x80700c
+  80251f:	e8 13 e5 ff ff       	call   800a37 <memmove>
+	nsipcbuf.send.req_size = size;
+  802524:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80252a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80252d:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802532:	b8 08 00 00 00       	mov    $0x8,%eax
+  802537:	e8 e8 fd ff ff       	call   802324 <nsipc>
+}
+  80253c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80253f:	c9                   	leave
+  802540:	c3                   	ret
+	assert(size < 1600);
+  802541:	68 bc 31 80 00       	push   $0x8031bc
+  802546:	68 63 31 80 00       	push   $0x803163
+  80254b:	6a 6d                	push   $0x6d
+  80254d:	68 b0 31 80 00       	push   $0x8031b0
+  802552:	e8 37 dc ff ff       	call   80018e <_panic>
+
+00802557 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80255d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802560:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802565:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802568:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80256d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802570:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802575:	b8 09 00 00 00       	mov    $0x9,%eax
+  80257a:	e8 a5 fd ff ff       	call   802324 <nsipc>
+}
+  80257f:	c9                   	leave
+  802580:	c3                   	ret
+
+00802581 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802581:	55                   	push   %ebp
+  802582:	89 e5                	mov    %esp,%ebp
+  802584:	56                   	push   %esi
+  802585:	53                   	push   %ebx
+  802586:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802589:	83 ec 0c             	sub    $0xc,%esp
+  80258c:	ff 75 08             	push   0x8(%ebp)
+  80258f:	e8 2a f3 ff ff       	call   8018be <fd2data>
+  802594:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802596:	83 c4 08             	add    $0x8,%esp
+  802599:	68 c8 31 80 00       	push   $0x8031c8
+  80259e:	53                   	push   %ebx
+  80259f:	e8 0d e3 ff ff       	call   8008b1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8025a4:	8b 46 04             	mov    0x4(%esi),%eax
+  8025a7:	2b 06                	sub    (%esi),%eax
+  8025a9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8025af:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025b6:	00 00 00 
+	stat->st_dev = &devpipe;
+  8025b9:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8025c0:	40 80 00 
+	return 0;
+}
+  8025c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025cb:	5b                   	pop    %ebx
+  8025cc:	5e                   	pop    %esi
+  8025cd:	5d                   	pop    %ebp
+  8025ce:	c3                   	ret
+
+008025cf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8025cf:	55                   	push   %ebp
+  8025d0:	89 e5                	mov    %esp,%ebp
+  8025d2:	53                   	push   %ebx
+  8025d3:	83 ec 0c             	sub    $0xc,%esp
+  8025d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8025d9:	53                   	push   %ebx
+  8025da:	6a 00                	push   $0x0
+  8025dc:	e8 a3 e8 ff ff       	call   800e84 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8025e1:	89 1c 24             	mov    %ebx,(%esp)
+  8025e4:	e8 d5 f2 ff ff       	call   8018be <fd2data>
+  8025e9:	83 c4 08             	add    $0x8,%esp
+  8025ec:	50                   	push   %eax
+  8025ed:	6a 00                	push   $0x0
+  8025ef:	e8 90 e8 ff ff       	call   800e84 <sys_page_unmap>
+}
+  8025f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f7:	c9                   	leave
+  8025f8:	c3                   	ret
+
+008025f9 <_pipeisclosed>:
+{
+  8025f9:	55                   	push   %ebp
+  8025fa:	89 e5                	mov    %esp,%ebp
+  8025fc:	57                   	push   %edi
+  8025fd:	56                   	push   %esi
+  8025fe:	53                   	push   %ebx
+  8025ff:	83 ec 1c             	sub    $0x1c,%esp
+  802602:	89 c7                	mov    %eax,%edi
+  802604:	89 d6                	mov    %edx,%esi
+  802606:	eb 3c                	jmp    802644 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802608:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  80260b:	83 ec 0c             	sub    $0xc,%esp
+  80260e:	57                   	push   %edi
+  80260f:	e8 13 06 00 00       	call   802c27 <pageref>
+  802614:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802617:	89 34 24             	mov    %esi,(%esp)
+  80261a:	e8 08 06 00 00       	call   802c27 <pageref>
+  80261f:	89 c2                	mov    %eax,%edx
+  802621:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802623:	05 00 00 00 20       	add    $0x20000000,%eax
+  802628:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80262b:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802631:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802636:	76 31                	jbe    802669 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802638:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80263b:	39 c3                	cmp    %eax,%ebx
+  80263d:	74 76                	je     8026b5 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80263f:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802642:	74 36                	je     80267a <_pipeisclosed+0x81>
+  802644:	89 e0                	mov    %esp,%eax
+  802646:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80264b:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802651:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802656:	77 b0                	ja     802608 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802658:	c1 e8 10             	shr    $0x10,%eax
+  80265b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802661:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802667:	eb 9f                	jmp    802608 <_pipeisclosed+0xf>
+  802669:	c1 e8 10             	shr    $0x10,%eax
+  80266c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802672:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802678:	eb be                	jmp    802638 <_pipeisclosed+0x3f>
+  80267a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80267c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802681:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802687:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80268c:	76 16                	jbe    8026a4 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80268e:	8b 42 58             	mov    0x58(%edx),%eax
+  802691:	6a 01                	push   $0x1
+  802693:	50                   	push   %eax
+  802694:	53                   	push   %ebx
+  802695:	68 cf 31 80 00       	push   $0x8031cf
+  80269a:	e8 ca db ff ff       	call   800269 <cprintf>
+  80269f:	83 c4 10             	add    $0x10,%esp
+  8026a2:	eb a0                	jmp    802644 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8026a4:	c1 e8 10             	shr    $0x10,%eax
+  8026a7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026ad:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8026b3:	eb d9                	jmp    80268e <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8026b5:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8026b8:	0f 94 c0             	sete   %al
+  8026bb:	0f b6 c0             	movzbl %al,%eax
+}
+  8026be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c1:	5b                   	pop    %ebx
+  8026c2:	5e                   	pop    %esi
+  8026c3:	5f                   	pop    %edi
+  8026c4:	5d                   	pop    %ebp
+  8026c5:	c3                   	ret
+
+008026c6 <devpipe_write>:
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	57                   	push   %edi
+  8026ca:	56                   	push   %esi
+  8026cb:	53                   	push   %ebx
+  8026cc:	83 ec 28             	sub    $0x28,%esp
+  8026cf:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8026d2:	56                   	push   %esi
+  8026d3:	e8 e6 f1 ff ff       	call   8018be <fd2data>
+  8026d8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8026da:	83 c4 10             	add    $0x10,%esp
+  8026dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026e2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8026e5:	75 09                	jne    8026f0 <devpipe_write+0x2a>
+	return i;
+  8026e7:	89 f8                	mov    %edi,%eax
+  8026e9:	eb 23                	jmp    80270e <devpipe_write+0x48>
+			sys_yield();
+  8026eb:	e8 73 e6 ff ff       	call   800d63 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8026f0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026f3:	8b 0b                	mov    (%ebx),%ecx
+  8026f5:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026f8:	39 d0                	cmp    %edx,%eax
+  8026fa:	72 1a                	jb     802716 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8026fc:	89 da                	mov    %ebx,%edx
+  8026fe:	89 f0                	mov    %esi,%eax
+  802700:	e8 f4 fe ff ff       	call   8025f9 <_pipeisclosed>
+  802705:	85 c0                	test   %eax,%eax
+  802707:	74 e2                	je     8026eb <devpipe_write+0x25>
+				return 0;
+  802709:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80270e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802711:	5b                   	pop    %ebx
+  802712:	5e                   	pop    %esi
+  802713:	5f                   	pop    %edi
+  802714:	5d                   	pop    %ebp
+  802715:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802716:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802719:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80271d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802720:	89 c2                	mov    %eax,%edx
+  802722:	c1 fa 1f             	sar    $0x1f,%edx
+  802725:	89 d1                	mov    %edx,%ecx
+  802727:	c1 e9 1b             	shr    $0x1b,%ecx
+  80272a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80272d:	83 e2 1f             	and    $0x1f,%edx
+  802730:	29 ca                	sub    %ecx,%edx
+  802732:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802736:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80273a:	83 c0 01             	add    $0x1,%eax
+  80273d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802740:	83 c7 01             	add    $0x1,%edi
+  802743:	eb 9d                	jmp    8026e2 <devpipe_write+0x1c>
+
+00802745 <devpipe_read>:
+{
+  802745:	55                   	push   %ebp
+  802746:	89 e5                	mov    %esp,%ebp
+  802748:	57                   	push   %edi
+  802749:	56                   	push   %esi
+  80274a:	53                   	push   %ebx
+  80274b:	83 ec 18             	sub    $0x18,%esp
+  80274e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802751:	57                   	push   %edi
+  802752:	e8 67 f1 ff ff       	call   8018be <fd2data>
+  802757:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802759:	83 c4 10             	add    $0x10,%esp
+  80275c:	be 00 00 00 00       	mov    $0x0,%esi
+  802761:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802764:	75 13                	jne    802779 <devpipe_read+0x34>
+	return i;
+  802766:	89 f0                	mov    %esi,%eax
+  802768:	eb 02                	jmp    80276c <devpipe_read+0x27>
+				return i;
+  80276a:	89 f0                	mov    %esi,%eax
+}
+  80276c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80276f:	5b                   	pop    %ebx
+  802770:	5e                   	pop    %esi
+  802771:	5f                   	pop    %edi
+  802772:	5d                   	pop    %ebp
+  802773:	c3                   	ret
+			sys_yield();
+  802774:	e8 ea e5 ff ff       	call   800d63 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802779:	8b 03                	mov    (%ebx),%eax
+  80277b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80277e:	75 18                	jne    802798 <devpipe_read+0x53>
+			if (i > 0)
+  802780:	85 f6                	test   %esi,%esi
+  802782:	75 e6                	jne    80276a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802784:	89 da                	mov    %ebx,%edx
+  802786:	89 f8                	mov    %edi,%eax
+  802788:	e8 6c fe ff ff       	call   8025f9 <_pipeisclosed>
+  80278d:	85 c0                	test   %eax,%eax
+  80278f:	74 e3                	je     802774 <devpipe_read+0x2f>
+				return 0;
+  802791:	b8 00 00 00 00       	mov    $0x0,%eax
+  802796:	eb d4                	jmp    80276c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802798:	99                   	cltd
+  802799:	c1 ea 1b             	shr    $0x1b,%edx
+  80279c:	01 d0                	add    %edx,%eax
+  80279e:	83 e0 1f             	and    $0x1f,%eax
+  8027a1:	29 d0                	sub    %edx,%eax
+  8027a3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8027a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027ab:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8027ae:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8027b1:	83 c6 01             	add    $0x1,%esi
+  8027b4:	eb ab                	jmp    802761 <devpipe_read+0x1c>
+
+008027b6 <pipe>:
+{
+  8027b6:	55                   	push   %ebp
+  8027b7:	89 e5                	mov    %esp,%ebp
+  8027b9:	56                   	push   %esi
+  8027ba:	53                   	push   %ebx
+  8027bb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8027be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027c1:	50                   	push   %eax
+  8027c2:	e8 0e f1 ff ff       	call   8018d5 <fd_alloc>
+  8027c7:	89 c3                	mov    %eax,%ebx
+  8027c9:	83 c4 10             	add    $0x10,%esp
+  8027cc:	85 c0                	test   %eax,%eax
+  8027ce:	0f 88 23 01 00 00    	js     8028f7 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027d4:	83 ec 04             	sub    $0x4,%esp
+  8027d7:	68 07 04 00 00       	push   $0x407
+  8027dc:	ff 75 f4             	push   -0xc(%ebp)
+  8027df:	6a 00                	push   $0x0
+  8027e1:	e8 c3 e5 ff ff       	call   800da9 <sys_page_alloc>
+  8027e6:	89 c3                	mov    %eax,%ebx
+  8027e8:	83 c4 10             	add    $0x10,%esp
+  8027eb:	85 c0                	test   %eax,%eax
+  8027ed:	0f 88 04 01 00 00    	js     8028f7 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8027f3:	83 ec 0c             	sub    $0xc,%esp
+  8027f6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027f9:	50                   	push   %eax
+  8027fa:	e8 d6 f0 ff ff       	call   8018d5 <fd_alloc>
+  8027ff:	89 c3                	mov    %eax,%ebx
+  802801:	83 c4 10             	add    $0x10,%esp
+  802804:	85 c0                	test   %eax,%eax
+  802806:	0f 88 db 00 00 00    	js     8028e7 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80280c:	83 ec 04             	sub    $0x4,%esp
+  80280f:	68 07 04 00 00       	push   $0x407
+  802814:	ff 75 f0             	push   -0x10(%ebp)
+  802817:	6a 00                	push   $0x0
+  802819:	e8 8b e5 ff ff       	call   800da9 <sys_page_alloc>
+  80281e:	89 c3                	mov    %eax,%ebx
+  802820:	83 c4 10             	add    $0x10,%esp
+  802823:	85 c0                	test   %eax,%eax
+  802825:	0f 88 bc 00 00 00    	js     8028e7 <pipe+0x131>
+	va = fd2data(fd0);
+  80282b:	83 ec 0c             	sub    $0xc,%esp
+  80282e:	ff 75 f4             	push   -0xc(%ebp)
+  802831:	e8 88 f0 ff ff       	call   8018be <fd2data>
+  802836:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802838:	83 c4 0c             	add    $0xc,%esp
+  80283b:	68 07 04 00 00       	push   $0x407
+  802840:	50                   	push   %eax
+  802841:	6a 00                	push   $0x0
+  802843:	e8 61 e5 ff ff       	call   800da9 <sys_page_alloc>
+  802848:	89 c3                	mov    %eax,%ebx
+  80284a:	83 c4 10             	add    $0x10,%esp
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	0f 88 82 00 00 00    	js     8028d7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802855:	83 ec 0c             	sub    $0xc,%esp
+  802858:	ff 75 f0             	push   -0x10(%ebp)
+  80285b:	e8 5e f0 ff ff       	call   8018be <fd2data>
+  802860:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802867:	50                   	push   %eax
+  802868:	6a 00                	push   $0x0
+  80286a:	56                   	push   %esi
+  80286b:	6a 00                	push   $0x0
+  80286d:	e8 a4 e5 ff ff       	call   800e16 <sys_page_map>
+  802872:	89 c3                	mov    %eax,%ebx
+  802874:	83 c4 20             	add    $0x20,%esp
+  802877:	85 c0                	test   %eax,%eax
+  802879:	78 4e                	js     8028c9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80287b:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802880:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802883:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802885:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802888:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80288f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802892:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802894:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802897:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80289e:	83 ec 0c             	sub    $0xc,%esp
+  8028a1:	ff 75 f4             	push   -0xc(%ebp)
+  8028a4:	e8 05 f0 ff ff       	call   8018ae <fd2num>
+  8028a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028ac:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8028ae:	83 c4 04             	add    $0x4,%esp
+  8028b1:	ff 75 f0             	push   -0x10(%ebp)
+  8028b4:	e8 f5 ef ff ff       	call   8018ae <fd2num>
+  8028b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028bc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8028bf:	83 c4 10             	add    $0x10,%esp
+  8028c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028c7:	eb 2e                	jmp    8028f7 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8028c9:	83 ec 08             	sub    $0x8,%esp
+  8028cc:	56                   	push   %esi
+  8028cd:	6a 00                	push   $0x0
+  8028cf:	e8 b0 e5 ff ff       	call   800e84 <sys_page_unmap>
+  8028d4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8028d7:	83 ec 08             	sub    $0x8,%esp
+  8028da:	ff 75 f0             	push   -0x10(%ebp)
+  8028dd:	6a 00                	push   $0x0
+  8028df:	e8 a0 e5 ff ff       	call   800e84 <sys_page_unmap>
+  8028e4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8028e7:	83 ec 08             	sub    $0x8,%esp
+  8028ea:	ff 75 f4             	push   -0xc(%ebp)
+  8028ed:	6a 00                	push   $0x0
+  8028ef:	e8 90 e5 ff ff       	call   800e84 <sys_page_unmap>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+}
+  8028f7:	89 d8                	mov    %ebx,%eax
+  8028f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028fc:	5b                   	pop    %ebx
+  8028fd:	5e                   	pop    %esi
+  8028fe:	5d                   	pop    %ebp
+  8028ff:	c3                   	ret
+
+00802900 <pipeisclosed>:
+{
+  802900:	55                   	push   %ebp
+  802901:	89 e5                	mov    %esp,%ebp
+  802903:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802906:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802909:	50                   	push   %eax
+  80290a:	ff 75 08             	push   0x8(%ebp)
+  80290d:	e8 19 f0 ff ff       	call   80192b <fd_lookup>
+  802912:	83 c4 10             	add    $0x10,%esp
+  802915:	85 c0                	test   %eax,%eax
+  802917:	78 18                	js     802931 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802919:	83 ec 0c             	sub    $0xc,%esp
+  80291c:	ff 75 f4             	push   -0xc(%ebp)
+  80291f:	e8 9a ef ff ff       	call   8018be <fd2data>
+  802924:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802926:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802929:	e8 cb fc ff ff       	call   8025f9 <_pipeisclosed>
+  80292e:	83 c4 10             	add    $0x10,%esp
+}
+  802931:	c9                   	leave
+  802932:	c3                   	ret
+
+00802933 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802933:	b8 00 00 00 00       	mov    $0x0,%eax
+  802938:	c3                   	ret
+
+00802939 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802939:	55                   	push   %ebp
+  80293a:	89 e5                	mov    %esp,%ebp
+  80293c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80293f:	68 e7 31 80 00       	push   $0x8031e7
+  802944:	ff 75 0c             	push   0xc(%ebp)
+  802947:	e8 65 df ff ff       	call   8008b1 <strcpy>
+	return 0;
+}
+  80294c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802951:	c9                   	leave
+  802952:	c3                   	ret
+
+00802953 <devcons_write>:
+{
+  802953:	55                   	push   %ebp
+  802954:	89 e5                	mov    %esp,%ebp
+  802956:	57                   	push   %edi
+  802957:	56                   	push   %esi
+  802958:	53                   	push   %ebx
+  802959:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80295f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802964:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80296a:	eb 2e                	jmp    80299a <devcons_write+0x47>
+		m = n - tot;
+  80296c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80296f:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802971:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802976:	39 c3                	cmp    %eax,%ebx
+  802978:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80297b:	83 ec 04             	sub    $0x4,%esp
+  80297e:	53                   	push   %ebx
+  80297f:	89 f0                	mov    %esi,%eax
+  802981:	03 45 0c             	add    0xc(%ebp),%eax
+  802984:	50                   	push   %eax
+  802985:	57                   	push   %edi
+  802986:	e8 ac e0 ff ff       	call   800a37 <memmove>
+		sys_cputs(buf, m);
+  80298b:	83 c4 08             	add    $0x8,%esp
+  80298e:	53                   	push   %ebx
+  80298f:	57                   	push   %edi
+  802990:	e8 95 e2 ff ff       	call   800c2a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802995:	01 de                	add    %ebx,%esi
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80299d:	72 cd                	jb     80296c <devcons_write+0x19>
+}
+  80299f:	89 f0                	mov    %esi,%eax
+  8029a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a4:	5b                   	pop    %ebx
+  8029a5:	5e                   	pop    %esi
+  8029a6:	5f                   	pop    %edi
+  8029a7:	5d                   	pop    %ebp
+  8029a8:	c3                   	ret
+
+008029a9 <devcons_read>:
+{
+  8029a9:	55                   	push   %ebp
+  8029aa:	89 e5                	mov    %esp,%ebp
+  8029ac:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8029af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029b8:	75 07                	jne    8029c1 <devcons_read+0x18>
+  8029ba:	eb 1f                	jmp    8029db <devcons_read+0x32>
+		sys_yield();
+  8029bc:	e8 a2 e3 ff ff       	call   800d63 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8029c1:	e8 a8 e2 ff ff       	call   800c6e <sys_cgetc>
+  8029c6:	85 c0                	test   %eax,%eax
+  8029c8:	74 f2                	je     8029bc <devcons_read+0x13>
+	if (c < 0)
+  8029ca:	78 0f                	js     8029db <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8029cc:	83 f8 04             	cmp    $0x4,%eax
+  8029cf:	74 0c                	je     8029dd <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8029d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029d4:	88 02                	mov    %al,(%edx)
+	return 1;
+  8029d6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8029db:	c9                   	leave
+  8029dc:	c3                   	ret
+		return 0;
+  8029dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e2:	eb f7                	jmp    8029db <devcons_read+0x32>
+
+008029e4 <cputchar>:
+{
+  8029e4:	55                   	push   %ebp
+  8029e5:	89 e5                	mov    %esp,%ebp
+  8029e7:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8029ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ed:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8029f0:	6a 01                	push   $0x1
+  8029f2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029f5:	50                   	push   %eax
+  8029f6:	e8 2f e2 ff ff       	call   800c2a <sys_cputs>
+}
+  8029fb:	83 c4 10             	add    $0x10,%esp
+  8029fe:	c9                   	leave
+  8029ff:	c3                   	ret
+
+00802a00 <getchar>:
+{
+  802a00:	55                   	push   %ebp
+  802a01:	89 e5                	mov    %esp,%ebp
+  802a03:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802a06:	6a 01                	push   $0x1
+  802a08:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a0b:	50                   	push   %eax
+  802a0c:	6a 00                	push   $0x0
+  802a0e:	e8 9e f1 ff ff       	call   801bb1 <read>
+	if (r < 0)
+  802a13:	83 c4 10             	add    $0x10,%esp
+  802a16:	85 c0                	test   %eax,%eax
+  802a18:	78 06                	js     802a20 <getchar+0x20>
+	if (r < 1)
+  802a1a:	74 06                	je     802a22 <getchar+0x22>
+	return c;
+  802a1c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802a20:	c9                   	leave
+  802a21:	c3                   	ret
+		return -E_EOF;
+  802a22:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802a27:	eb f7                	jmp    802a20 <getchar+0x20>
+
+00802a29 <iscons>:
+{
+  802a29:	55                   	push   %ebp
+  802a2a:	89 e5                	mov    %esp,%ebp
+  802a2c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a32:	50                   	push   %eax
+  802a33:	ff 75 08             	push   0x8(%ebp)
+  802a36:	e8 f0 ee ff ff       	call   80192b <fd_lookup>
+  802a3b:	83 c4 10             	add    $0x10,%esp
+  802a3e:	85 c0                	test   %eax,%eax
+  802a40:	78 11                	js     802a53 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802a42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a45:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a4b:	39 10                	cmp    %edx,(%eax)
+  802a4d:	0f 94 c0             	sete   %al
+  802a50:	0f b6 c0             	movzbl %al,%eax
+}
+  802a53:	c9                   	leave
+  802a54:	c3                   	ret
+
+00802a55 <opencons>:
+{
+  802a55:	55                   	push   %ebp
+  802a56:	89 e5                	mov    %esp,%ebp
+  802a58:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802a5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a5e:	50                   	push   %eax
+  802a5f:	e8 71 ee ff ff       	call   8018d5 <fd_alloc>
+  802a64:	83 c4 10             	add    $0x10,%esp
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	78 3a                	js     802aa5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802a6b:	83 ec 04             	sub    $0x4,%esp
+  802a6e:	68 07 04 00 00       	push   $0x407
+  802a73:	ff 75 f4             	push   -0xc(%ebp)
+  802a76:	6a 00                	push   $0x0
+  802a78:	e8 2c e3 ff ff       	call   800da9 <sys_page_alloc>
+  802a7d:	83 c4 10             	add    $0x10,%esp
+  802a80:	85 c0                	test   %eax,%eax
+  802a82:	78 21                	js     802aa5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802a84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a87:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a8d:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802a8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a92:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802a99:	83 ec 0c             	sub    $0xc,%esp
+  802a9c:	50                   	push   %eax
+  802a9d:	e8 0c ee ff ff       	call   8018ae <fd2num>
+  802aa2:	83 c4 10             	add    $0x10,%esp
+}
+  802aa5:	c9                   	leave
+  802aa6:	c3                   	ret
+
+00802aa7 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802aa7:	55                   	push   %ebp
+  802aa8:	89 e5                	mov    %esp,%ebp
+  802aaa:	56                   	push   %esi
+  802aab:	53                   	push   %ebx
+  802aac:	8b 75 08             	mov    0x8(%ebp),%esi
+  802aaf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ab2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802ab5:	85 c0                	test   %eax,%eax
+  802ab7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802abc:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802abf:	83 ec 08             	sub    $0x8,%esp
+  802ac2:	ff 75 14             	push   0x14(%ebp)
+  802ac5:	50                   	push   %eax
+  802ac6:	e8 ef e6 ff ff       	call   8011ba <sys_ipc_recv_until>
+  802acb:	83 c4 10             	add    $0x10,%esp
+  802ace:	85 c0                	test   %eax,%eax
+  802ad0:	78 61                	js     802b33 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802ad2:	85 f6                	test   %esi,%esi
+  802ad4:	74 1c                	je     802af2 <ipc_recv_until+0x4b>
+  802ad6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ad8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802add:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ae3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ae8:	76 5f                	jbe    802b49 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802aea:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802af0:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802af2:	85 db                	test   %ebx,%ebx
+  802af4:	74 1c                	je     802b12 <ipc_recv_until+0x6b>
+  802af6:	89 e0                	mov    %esp,%eax
+  802af8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802afd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b03:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b08:	76 50                	jbe    802b5a <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802b0a:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802b10:	89 03                	mov    %eax,(%ebx)
+  802b12:	89 e0                	mov    %esp,%eax
+  802b14:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b19:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b1f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b24:	76 45                	jbe    802b6b <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802b26:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802b2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b2f:	5b                   	pop    %ebx
+  802b30:	5e                   	pop    %esi
+  802b31:	5d                   	pop    %ebp
+  802b32:	c3                   	ret
+		if (from_env_store)
+  802b33:	85 f6                	test   %esi,%esi
+  802b35:	74 06                	je     802b3d <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802b37:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802b3d:	85 db                	test   %ebx,%ebx
+  802b3f:	74 eb                	je     802b2c <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802b41:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802b47:	eb e3                	jmp    802b2c <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802b49:	c1 e8 10             	shr    $0x10,%eax
+  802b4c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b52:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b58:	eb 90                	jmp    802aea <ipc_recv_until+0x43>
+  802b5a:	c1 e8 10             	shr    $0x10,%eax
+  802b5d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b63:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b69:	eb 9f                	jmp    802b0a <ipc_recv_until+0x63>
+  802b6b:	c1 e8 10             	shr    $0x10,%eax
+  802b6e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b74:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b7a:	eb aa                	jmp    802b26 <ipc_recv_until+0x7f>
+
+00802b7c <ipc_recv>:
+{
+  802b7c:	55                   	push   %ebp
+  802b7d:	89 e5                	mov    %esp,%ebp
+  802b7f:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802b82:	6a 00                	push   $0x0
+  802b84:	ff 75 10             	push   0x10(%ebp)
+  802b87:	ff 75 0c             	push   0xc(%ebp)
+  802b8a:	ff 75 08             	push   0x8(%ebp)
+  802b8d:	e8 15 ff ff ff       	call   802aa7 <ipc_recv_until>
+}
+  802b92:	c9                   	leave
+  802b93:	c3                   	ret
+
+00802b94 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b94:	55                   	push   %ebp
+  802b95:	89 e5                	mov    %esp,%ebp
+  802b97:	57                   	push   %edi
+  802b98:	56                   	push   %esi
+  802b99:	53                   	push   %ebx
+  802b9a:	83 ec 0c             	sub    $0xc,%esp
+  802b9d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ba0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ba3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802ba6:	85 db                	test   %ebx,%ebx
+  802ba8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bad:	0f 44 d8             	cmove  %eax,%ebx
+  802bb0:	eb 05                	jmp    802bb7 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802bb2:	e8 ac e1 ff ff       	call   800d63 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802bb7:	ff 75 14             	push   0x14(%ebp)
+  802bba:	53                   	push   %ebx
+  802bbb:	56                   	push   %esi
+  802bbc:	57                   	push   %edi
+  802bbd:	e8 44 e5 ff ff       	call   801106 <sys_ipc_try_send>
+  802bc2:	83 c4 10             	add    $0x10,%esp
+  802bc5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802bc8:	74 e8                	je     802bb2 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802bca:	85 c0                	test   %eax,%eax
+  802bcc:	78 08                	js     802bd6 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802bce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd1:	5b                   	pop    %ebx
+  802bd2:	5e                   	pop    %esi
+  802bd3:	5f                   	pop    %edi
+  802bd4:	5d                   	pop    %ebp
+  802bd5:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802bd6:	50                   	push   %eax
+  802bd7:	68 f3 31 80 00       	push   $0x8031f3
+  802bdc:	6a 4f                	push   $0x4f
+  802bde:	68 06 32 80 00       	push   $0x803206
+  802be3:	e8 a6 d5 ff ff       	call   80018e <_panic>
+
+00802be8 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802be8:	55                   	push   %ebp
+  802be9:	89 e5                	mov    %esp,%ebp
+  802beb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802bee:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802bf3:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802bf9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802bff:	8b 52 50             	mov    0x50(%edx),%edx
+  802c02:	39 ca                	cmp    %ecx,%edx
+  802c04:	74 11                	je     802c17 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802c06:	83 c0 01             	add    $0x1,%eax
+  802c09:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802c0e:	75 e3                	jne    802bf3 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c15:	eb 0e                	jmp    802c25 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802c17:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c1d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c22:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c25:	5d                   	pop    %ebp
+  802c26:	c3                   	ret
+
+00802c27 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c27:	55                   	push   %ebp
+  802c28:	89 e5                	mov    %esp,%ebp
+  802c2a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802c2d:	89 c2                	mov    %eax,%edx
+  802c2f:	c1 ea 16             	shr    $0x16,%edx
+  802c32:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802c39:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802c3e:	f6 c1 01             	test   $0x1,%cl
+  802c41:	74 1a                	je     802c5d <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802c43:	c1 e8 0c             	shr    $0xc,%eax
+  802c46:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802c4d:	a8 01                	test   $0x1,%al
+  802c4f:	74 0c                	je     802c5d <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802c51:	c1 e8 0c             	shr    $0xc,%eax
+  802c54:	c1 e0 04             	shl    $0x4,%eax
+  802c57:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802c5d:	89 d0                	mov    %edx,%eax
+  802c5f:	5d                   	pop    %ebp
+  802c60:	c3                   	ret
@@ -0,0 +1,6323 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+	cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 60 2c 80 00       	push   $0x802c60
+  800045:	e8 0a 02 00 00       	call   800254 <cprintf>
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 36 0d 00 00       	call   800d94 <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 ac 2c 80 00       	push   $0x802cac
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 d4 07 00 00       	call   800847 <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 80 2c 80 00       	push   $0x802c80
+  800085:	6a 0f                	push   $0xf
+  800087:	68 6a 2c 80 00       	push   $0x802c6a
+  80008c:	e8 e8 00 00 00       	call   800179 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 69 17 00 00       	call   80180a <set_pgfault_handler>
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 65 0b 00 00       	call   800c15 <sys_cputs>
+}
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	57                   	push   %edi
+  8000b9:	56                   	push   %esi
+  8000ba:	53                   	push   %ebx
+  8000bb:	83 ec 0c             	sub    $0xc,%esp
+  8000be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000c9:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000cb:	c1 ea 0b             	shr    $0xb,%edx
+  8000ce:	83 f2 01             	xor    $0x1,%edx
+  8000d1:	83 e2 01             	and    $0x1,%edx
+  8000d4:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000da:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000e1:	00 00 00 
+	envid = sys_getenvid();
+  8000e4:	e8 1f 0c 00 00       	call   800d08 <sys_getenvid>
+  8000e9:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8000eb:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000f0:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8000f6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000fc:	8b 52 48             	mov    0x48(%edx),%edx
+  8000ff:	39 ca                	cmp    %ecx,%edx
+  800101:	74 27                	je     80012a <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800103:	83 c0 01             	add    $0x1,%eax
+  800106:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80010b:	75 e3                	jne    8000f0 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80010d:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800114:	75 24                	jne    80013a <libmain+0x85>
+		panic("libmain can't find the environment");
+  800116:	83 ec 04             	sub    $0x4,%esp
+  800119:	68 d0 2c 80 00       	push   $0x802cd0
+  80011e:	6a 23                	push   $0x23
+  800120:	68 f3 2c 80 00       	push   $0x802cf3
+  800125:	e8 4f 00 00 00       	call   800179 <_panic>
+			mainenv = &envs[i];
+  80012a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800130:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800135:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80013a:	85 ff                	test   %edi,%edi
+  80013c:	7e 07                	jle    800145 <libmain+0x90>
+		binaryname = argv[0];
+  80013e:	8b 06                	mov    (%esi),%eax
+  800140:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800145:	83 ec 08             	sub    $0x8,%esp
+  800148:	56                   	push   %esi
+  800149:	57                   	push   %edi
+  80014a:	e8 42 ff ff ff       	call   800091 <umain>
+
+	// exit gracefully
+	exit();
+  80014f:	e8 0b 00 00 00       	call   80015f <exit>
+}
+  800154:	83 c4 10             	add    $0x10,%esp
+  800157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80015a:	5b                   	pop    %ebx
+  80015b:	5e                   	pop    %esi
+  80015c:	5f                   	pop    %edi
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+
+0080015f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800165:	e8 23 19 00 00       	call   801a8d <close_all>
+	sys_env_destroy(0);
+  80016a:	83 ec 0c             	sub    $0xc,%esp
+  80016d:	6a 00                	push   $0x0
+  80016f:	e8 2b 0b 00 00       	call   800c9f <sys_env_destroy>
+}
+  800174:	83 c4 10             	add    $0x10,%esp
+  800177:	c9                   	leave
+  800178:	c3                   	ret
+
+00800179 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800179:	55                   	push   %ebp
+  80017a:	89 e5                	mov    %esp,%ebp
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80017e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800181:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800187:	e8 7c 0b 00 00       	call   800d08 <sys_getenvid>
+  80018c:	83 ec 0c             	sub    $0xc,%esp
+  80018f:	ff 75 0c             	push   0xc(%ebp)
+  800192:	ff 75 08             	push   0x8(%ebp)
+  800195:	56                   	push   %esi
+  800196:	50                   	push   %eax
+  800197:	68 0c 2d 80 00       	push   $0x802d0c
+  80019c:	e8 b3 00 00 00       	call   800254 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001a1:	83 c4 18             	add    $0x18,%esp
+  8001a4:	53                   	push   %ebx
+  8001a5:	ff 75 10             	push   0x10(%ebp)
+  8001a8:	e8 56 00 00 00       	call   800203 <vcprintf>
+	cprintf("\n");
+  8001ad:	c7 04 24 c0 31 80 00 	movl   $0x8031c0,(%esp)
+  8001b4:	e8 9b 00 00 00       	call   800254 <cprintf>
+  8001b9:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001bc:	cc                   	int3
+	while (1)
+  8001bd:	eb fd                	jmp    8001bc <_panic+0x43>
+
+008001bf <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001bf:	55                   	push   %ebp
+  8001c0:	89 e5                	mov    %esp,%ebp
+  8001c2:	53                   	push   %ebx
+  8001c3:	83 ec 04             	sub    $0x4,%esp
+  8001c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001c9:	8b 13                	mov    (%ebx),%edx
+  8001cb:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ce:	89 03                	mov    %eax,(%ebx)
+  8001d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001d3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001d7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001dc:	74 09                	je     8001e7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001de:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001e7:	83 ec 08             	sub    $0x8,%esp
+  8001ea:	68 ff 00 00 00       	push   $0xff
+  8001ef:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001f2:	50                   	push   %eax
+  8001f3:	e8 1d 0a 00 00       	call   800c15 <sys_cputs>
+		b->idx = 0;
+  8001f8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001fe:	83 c4 10             	add    $0x10,%esp
+  800201:	eb db                	jmp    8001de <putch+0x1f>
+
+00800203 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80020c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800213:	00 00 00 
+	b.cnt = 0;
+  800216:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80021d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800220:	ff 75 0c             	push   0xc(%ebp)
+  800223:	ff 75 08             	push   0x8(%ebp)
+  800226:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80022c:	50                   	push   %eax
+  80022d:	68 bf 01 80 00       	push   $0x8001bf
+  800232:	e8 fb 00 00 00       	call   800332 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800237:	83 c4 08             	add    $0x8,%esp
+  80023a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800240:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800246:	50                   	push   %eax
+  800247:	e8 c9 09 00 00       	call   800c15 <sys_cputs>
+
+	return b.cnt;
+}
+  80024c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800252:	c9                   	leave
+  800253:	c3                   	ret
+
+00800254 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800254:	55                   	push   %ebp
+  800255:	89 e5                	mov    %esp,%ebp
+  800257:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80025a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80025d:	50                   	push   %eax
+  80025e:	ff 75 08             	push   0x8(%ebp)
+  800261:	e8 9d ff ff ff       	call   800203 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+
+00800268 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	57                   	push   %edi
+  80026c:	56                   	push   %esi
+  80026d:	53                   	push   %ebx
+  80026e:	83 ec 1c             	sub    $0x1c,%esp
+  800271:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800274:	89 d6                	mov    %edx,%esi
+  800276:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80027c:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80027f:	73 0b                	jae    80028c <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800281:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800284:	c1 e7 08             	shl    $0x8,%edi
+  800287:	0b 7d 10             	or     0x10(%ebp),%edi
+  80028a:	eb 36                	jmp    8002c2 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80028c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80028f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800294:	f7 75 08             	divl   0x8(%ebp)
+  800297:	89 c1                	mov    %eax,%ecx
+  800299:	ff 75 14             	push   0x14(%ebp)
+  80029c:	ff 75 10             	push   0x10(%ebp)
+  80029f:	83 eb 01             	sub    $0x1,%ebx
+  8002a2:	53                   	push   %ebx
+  8002a3:	ff 75 08             	push   0x8(%ebp)
+  8002a6:	89 f2                	mov    %esi,%edx
+  8002a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002ab:	e8 b8 ff ff ff       	call   800268 <printnum>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	eb 14                	jmp    8002c9 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002b5:	83 ec 08             	sub    $0x8,%esp
+  8002b8:	56                   	push   %esi
+  8002b9:	57                   	push   %edi
+  8002ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002bd:	ff d0                	call   *%eax
+  8002bf:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002c2:	83 eb 01             	sub    $0x1,%ebx
+  8002c5:	85 db                	test   %ebx,%ebx
+  8002c7:	7f ec                	jg     8002b5 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002c9:	83 ec 08             	sub    $0x8,%esp
+  8002cc:	56                   	push   %esi
+  8002cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d5:	f7 75 08             	divl   0x8(%ebp)
+  8002d8:	0f be 92 2f 2d 80 00 	movsbl 0x802d2f(%edx),%edx
+  8002df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e2:	c1 e0 08             	shl    $0x8,%eax
+  8002e5:	09 d0                	or     %edx,%eax
+  8002e7:	50                   	push   %eax
+  8002e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002eb:	ff d0                	call   *%eax
+}
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f3:	5b                   	pop    %ebx
+  8002f4:	5e                   	pop    %esi
+  8002f5:	5f                   	pop    %edi
+  8002f6:	5d                   	pop    %ebp
+  8002f7:	c3                   	ret
+
+008002f8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002f8:	55                   	push   %ebp
+  8002f9:	89 e5                	mov    %esp,%ebp
+  8002fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002fe:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800302:	8b 10                	mov    (%eax),%edx
+  800304:	3b 50 04             	cmp    0x4(%eax),%edx
+  800307:	73 0a                	jae    800313 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800309:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80030c:	89 08                	mov    %ecx,(%eax)
+  80030e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800311:	88 02                	mov    %al,(%edx)
+}
+  800313:	5d                   	pop    %ebp
+  800314:	c3                   	ret
+
+00800315 <printfmt>:
+{
+  800315:	55                   	push   %ebp
+  800316:	89 e5                	mov    %esp,%ebp
+  800318:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80031b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80031e:	50                   	push   %eax
+  80031f:	ff 75 10             	push   0x10(%ebp)
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	ff 75 08             	push   0x8(%ebp)
+  800328:	e8 05 00 00 00       	call   800332 <vprintfmt>
+}
+  80032d:	83 c4 10             	add    $0x10,%esp
+  800330:	c9                   	leave
+  800331:	c3                   	ret
+
+00800332 <vprintfmt>:
+{
+  800332:	55                   	push   %ebp
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	57                   	push   %edi
+  800336:	56                   	push   %esi
+  800337:	53                   	push   %ebx
+  800338:	83 ec 3c             	sub    $0x3c,%esp
+  80033b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80033e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800341:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800348:	eb 16                	jmp    800360 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80034a:	83 ec 08             	sub    $0x8,%esp
+  80034d:	ff 75 0c             	push   0xc(%ebp)
+  800350:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800353:	c1 e2 08             	shl    $0x8,%edx
+  800356:	09 d0                	or     %edx,%eax
+  800358:	50                   	push   %eax
+  800359:	ff d7                	call   *%edi
+  80035b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80035e:	89 de                	mov    %ebx,%esi
+  800360:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800363:	0f b6 06             	movzbl (%esi),%eax
+  800366:	83 f8 25             	cmp    $0x25,%eax
+  800369:	74 0c                	je     800377 <vprintfmt+0x45>
+			if (ch == '\0')
+  80036b:	85 c0                	test   %eax,%eax
+  80036d:	75 db                	jne    80034a <vprintfmt+0x18>
+}
+  80036f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800372:	5b                   	pop    %ebx
+  800373:	5e                   	pop    %esi
+  800374:	5f                   	pop    %edi
+  800375:	5d                   	pop    %ebp
+  800376:	c3                   	ret
+		padc = ' ';
+  800377:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80037b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800382:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800389:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800390:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800395:	8d 73 01             	lea    0x1(%ebx),%esi
+  800398:	0f b6 13             	movzbl (%ebx),%edx
+  80039b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80039e:	3c 55                	cmp    $0x55,%al
+  8003a0:	0f 87 2c 04 00 00    	ja     8007d2 <vprintfmt+0x4a0>
+  8003a6:	0f b6 c0             	movzbl %al,%eax
+  8003a9:	ff 24 85 80 2e 80 00 	jmp    *0x802e80(,%eax,4)
+  8003b0:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003b2:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003b6:	eb dd                	jmp    800395 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b8:	89 f3                	mov    %esi,%ebx
+  8003ba:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003be:	eb d5                	jmp    800395 <vprintfmt+0x63>
+  8003c0:	0f b6 d2             	movzbl %dl,%edx
+  8003c3:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003c5:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003ca:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003cd:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003d1:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003d4:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003d7:	83 fe 09             	cmp    $0x9,%esi
+  8003da:	0f 87 8a 00 00 00    	ja     80046a <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003e0:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003e3:	eb e5                	jmp    8003ca <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e8:	8b 00                	mov    (%eax),%eax
+  8003ea:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8003f3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f6:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8003f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003fc:	79 97                	jns    800395 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8003fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800401:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800404:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80040b:	eb 88                	jmp    800395 <vprintfmt+0x63>
+			if (width < 0)
+  80040d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800410:	85 db                	test   %ebx,%ebx
+  800412:	b8 00 00 00 00       	mov    $0x0,%eax
+  800417:	0f 49 c3             	cmovns %ebx,%eax
+  80041a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80041d:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80041f:	e9 71 ff ff ff       	jmp    800395 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800424:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800426:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80042d:	e9 63 ff ff ff       	jmp    800395 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800432:	8d 73 02             	lea    0x2(%ebx),%esi
+  800435:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800439:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800440:	3c 67                	cmp    $0x67,%al
+  800442:	0f 84 18 ff ff ff    	je     800360 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800448:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80044f:	3c 72                	cmp    $0x72,%al
+  800451:	0f 84 09 ff ff ff    	je     800360 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800457:	3c 62                	cmp    $0x62,%al
+  800459:	0f 94 c0             	sete   %al
+  80045c:	0f b6 c0             	movzbl %al,%eax
+  80045f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800462:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800465:	e9 f6 fe ff ff       	jmp    800360 <vprintfmt+0x2e>
+  80046a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80046d:	eb 89                	jmp    8003f8 <vprintfmt+0xc6>
+			lflag++;
+  80046f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800472:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800474:	e9 1c ff ff ff       	jmp    800395 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800479:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80047f:	83 ec 08             	sub    $0x8,%esp
+  800482:	ff 75 0c             	push   0xc(%ebp)
+  800485:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800488:	c1 e0 08             	shl    $0x8,%eax
+  80048b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80048e:	0b 01                	or     (%ecx),%eax
+  800490:	50                   	push   %eax
+  800491:	ff d7                	call   *%edi
+			break;
+  800493:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800496:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800499:	e9 c2 fe ff ff       	jmp    800360 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80049e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a1:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004a4:	8b 10                	mov    (%eax),%edx
+  8004a6:	89 d0                	mov    %edx,%eax
+  8004a8:	f7 d8                	neg    %eax
+  8004aa:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004ad:	83 f8 12             	cmp    $0x12,%eax
+  8004b0:	7f 25                	jg     8004d7 <vprintfmt+0x1a5>
+  8004b2:	8b 14 85 e0 2f 80 00 	mov    0x802fe0(,%eax,4),%edx
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	74 1a                	je     8004d7 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004bd:	52                   	push   %edx
+  8004be:	68 55 31 80 00       	push   $0x803155
+  8004c3:	ff 75 0c             	push   0xc(%ebp)
+  8004c6:	57                   	push   %edi
+  8004c7:	e8 49 fe ff ff       	call   800315 <printfmt>
+  8004cc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004cf:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8004d2:	e9 89 fe ff ff       	jmp    800360 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004d7:	50                   	push   %eax
+  8004d8:	68 47 2d 80 00       	push   $0x802d47
+  8004dd:	ff 75 0c             	push   0xc(%ebp)
+  8004e0:	57                   	push   %edi
+  8004e1:	e8 2f fe ff ff       	call   800315 <printfmt>
+  8004e6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e9:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004ec:	e9 6f fe ff ff       	jmp    800360 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f4:	83 c0 04             	add    $0x4,%eax
+  8004f7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8004fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004ff:	85 c9                	test   %ecx,%ecx
+  800501:	b8 40 2d 80 00       	mov    $0x802d40,%eax
+  800506:	0f 45 c1             	cmovne %ecx,%eax
+  800509:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80050c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800510:	7e 06                	jle    800518 <vprintfmt+0x1e6>
+  800512:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800516:	75 1a                	jne    800532 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800518:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80051b:	c1 e0 08             	shl    $0x8,%eax
+  80051e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800521:	83 c8 3f             	or     $0x3f,%eax
+  800524:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800527:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80052a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80052d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800530:	eb 6d                	jmp    80059f <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	ff 75 d0             	push   -0x30(%ebp)
+  800538:	ff 75 c8             	push   -0x38(%ebp)
+  80053b:	e8 39 03 00 00       	call   800879 <strnlen>
+  800540:	89 c2                	mov    %eax,%edx
+  800542:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800545:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800547:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80054a:	c1 e1 08             	shl    $0x8,%ecx
+  80054d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800551:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	89 c3                	mov    %eax,%ebx
+  800558:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80055e:	89 ce                	mov    %ecx,%esi
+  800560:	eb 0f                	jmp    800571 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800562:	83 ec 08             	sub    $0x8,%esp
+  800565:	ff 75 0c             	push   0xc(%ebp)
+  800568:	56                   	push   %esi
+  800569:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80056b:	83 eb 01             	sub    $0x1,%ebx
+  80056e:	83 c4 10             	add    $0x10,%esp
+  800571:	85 db                	test   %ebx,%ebx
+  800573:	7f ed                	jg     800562 <vprintfmt+0x230>
+  800575:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800578:	8b 75 10             	mov    0x10(%ebp),%esi
+  80057b:	85 c0                	test   %eax,%eax
+  80057d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800582:	0f 49 d0             	cmovns %eax,%edx
+  800585:	29 d0                	sub    %edx,%eax
+  800587:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058a:	eb 8c                	jmp    800518 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80058c:	83 ec 08             	sub    $0x8,%esp
+  80058f:	ff 75 0c             	push   0xc(%ebp)
+  800592:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800595:	09 c2                	or     %eax,%edx
+  800597:	52                   	push   %edx
+  800598:	ff d7                	call   *%edi
+  80059a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80059d:	89 d9                	mov    %ebx,%ecx
+  80059f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005a2:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005a6:	0f be d0             	movsbl %al,%edx
+  8005a9:	85 d2                	test   %edx,%edx
+  8005ab:	74 2a                	je     8005d7 <vprintfmt+0x2a5>
+  8005ad:	85 f6                	test   %esi,%esi
+  8005af:	78 05                	js     8005b6 <vprintfmt+0x284>
+  8005b1:	83 ee 01             	sub    $0x1,%esi
+  8005b4:	78 3b                	js     8005f1 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005b6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ba:	74 d0                	je     80058c <vprintfmt+0x25a>
+  8005bc:	0f be c0             	movsbl %al,%eax
+  8005bf:	83 e8 20             	sub    $0x20,%eax
+  8005c2:	83 f8 5e             	cmp    $0x5e,%eax
+  8005c5:	76 c5                	jbe    80058c <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+  8005ca:	ff 75 0c             	push   0xc(%ebp)
+  8005cd:	ff 75 cc             	push   -0x34(%ebp)
+  8005d0:	ff d7                	call   *%edi
+  8005d2:	83 c4 10             	add    $0x10,%esp
+  8005d5:	eb c6                	jmp    80059d <vprintfmt+0x26b>
+  8005d7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005da:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e0:	01 c3                	add    %eax,%ebx
+  8005e2:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005e4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005e7:	83 c8 20             	or     $0x20,%eax
+  8005ea:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005ed:	89 c6                	mov    %eax,%esi
+  8005ef:	eb 14                	jmp    800605 <vprintfmt+0x2d3>
+  8005f1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005f4:	eb e4                	jmp    8005da <vprintfmt+0x2a8>
+  8005f6:	83 ec 08             	sub    $0x8,%esp
+  8005f9:	ff 75 0c             	push   0xc(%ebp)
+  8005fc:	56                   	push   %esi
+  8005fd:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005ff:	83 eb 01             	sub    $0x1,%ebx
+  800602:	83 c4 10             	add    $0x10,%esp
+  800605:	85 db                	test   %ebx,%ebx
+  800607:	7f ed                	jg     8005f6 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800609:	8b 75 10             	mov    0x10(%ebp),%esi
+  80060c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80060f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800612:	e9 49 fd ff ff       	jmp    800360 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800617:	83 f9 01             	cmp    $0x1,%ecx
+  80061a:	7f 1f                	jg     80063b <vprintfmt+0x309>
+	else if (lflag)
+  80061c:	85 c9                	test   %ecx,%ecx
+  80061e:	74 69                	je     800689 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 00                	mov    (%eax),%eax
+  800625:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800628:	89 c1                	mov    %eax,%ecx
+  80062a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80062d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+  800639:	eb 17                	jmp    800652 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 50 04             	mov    0x4(%eax),%edx
+  800641:	8b 00                	mov    (%eax),%eax
+  800643:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800646:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8d 40 08             	lea    0x8(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800652:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800655:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800658:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80065d:	85 db                	test   %ebx,%ebx
+  80065f:	0f 89 f6 00 00 00    	jns    80075b <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800665:	83 ec 08             	sub    $0x8,%esp
+  800668:	ff 75 0c             	push   0xc(%ebp)
+  80066b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80066e:	c1 e0 08             	shl    $0x8,%eax
+  800671:	83 c8 2d             	or     $0x2d,%eax
+  800674:	50                   	push   %eax
+  800675:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800677:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80067a:	f7 d9                	neg    %ecx
+  80067c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80067f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800684:	e9 d2 00 00 00       	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800689:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068c:	8b 00                	mov    (%eax),%eax
+  80068e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800691:	89 c1                	mov    %eax,%ecx
+  800693:	c1 f9 1f             	sar    $0x1f,%ecx
+  800696:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800699:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a2:	eb ae                	jmp    800652 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006a4:	83 f9 01             	cmp    $0x1,%ecx
+  8006a7:	7f 19                	jg     8006c2 <vprintfmt+0x390>
+	else if (lflag)
+  8006a9:	85 c9                	test   %ecx,%ecx
+  8006ab:	74 2a                	je     8006d7 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 08                	mov    (%eax),%ecx
+  8006b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006bd:	e9 99 00 00 00       	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	8b 08                	mov    (%eax),%ecx
+  8006c7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8006d2:	e9 84 00 00 00       	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8b 08                	mov    (%eax),%ecx
+  8006dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006e7:	eb 72                	jmp    80075b <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006e9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ec:	7f 16                	jg     800704 <vprintfmt+0x3d2>
+	else if (lflag)
+  8006ee:	85 c9                	test   %ecx,%ecx
+  8006f0:	74 24                	je     800716 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f5:	8b 08                	mov    (%eax),%ecx
+  8006f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006fd:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800702:	eb 57                	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 08                	mov    (%eax),%ecx
+  800709:	8d 40 08             	lea    0x8(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80070f:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800714:	eb 45                	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 08                	mov    (%eax),%ecx
+  80071b:	8d 40 04             	lea    0x4(%eax),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800721:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800726:	eb 33                	jmp    80075b <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800728:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80072b:	c1 e3 08             	shl    $0x8,%ebx
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	ff 75 0c             	push   0xc(%ebp)
+  800734:	89 d8                	mov    %ebx,%eax
+  800736:	83 c8 30             	or     $0x30,%eax
+  800739:	50                   	push   %eax
+  80073a:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80073c:	83 c4 08             	add    $0x8,%esp
+  80073f:	ff 75 0c             	push   0xc(%ebp)
+  800742:	83 cb 78             	or     $0x78,%ebx
+  800745:	53                   	push   %ebx
+  800746:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800748:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074b:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80074d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800750:	8d 40 04             	lea    0x4(%eax),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800756:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80075b:	ff 75 e4             	push   -0x1c(%ebp)
+  80075e:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800762:	52                   	push   %edx
+  800763:	ff 75 e0             	push   -0x20(%ebp)
+  800766:	50                   	push   %eax
+  800767:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80076a:	89 f8                	mov    %edi,%eax
+  80076c:	e8 f7 fa ff ff       	call   800268 <printnum>
+			break;
+  800771:	83 c4 10             	add    $0x10,%esp
+  800774:	e9 e7 fb ff ff       	jmp    800360 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800779:	83 f9 01             	cmp    $0x1,%ecx
+  80077c:	7f 16                	jg     800794 <vprintfmt+0x462>
+	else if (lflag)
+  80077e:	85 c9                	test   %ecx,%ecx
+  800780:	74 24                	je     8007a6 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800782:	8b 45 14             	mov    0x14(%ebp),%eax
+  800785:	8b 08                	mov    (%eax),%ecx
+  800787:	8d 40 04             	lea    0x4(%eax),%eax
+  80078a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800792:	eb c7                	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800794:	8b 45 14             	mov    0x14(%ebp),%eax
+  800797:	8b 08                	mov    (%eax),%ecx
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079f:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007a4:	eb b5                	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 08                	mov    (%eax),%ecx
+  8007ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b1:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007b6:	eb a3                	jmp    80075b <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007b8:	83 ec 08             	sub    $0x8,%esp
+  8007bb:	ff 75 0c             	push   0xc(%ebp)
+  8007be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007c1:	c1 e0 08             	shl    $0x8,%eax
+  8007c4:	83 c8 25             	or     $0x25,%eax
+  8007c7:	50                   	push   %eax
+  8007c8:	ff d7                	call   *%edi
+			break;
+  8007ca:	83 c4 10             	add    $0x10,%esp
+  8007cd:	e9 8e fb ff ff       	jmp    800360 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8007d2:	83 ec 08             	sub    $0x8,%esp
+  8007d5:	ff 75 0c             	push   0xc(%ebp)
+  8007d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007db:	c1 e0 08             	shl    $0x8,%eax
+  8007de:	83 c8 25             	or     $0x25,%eax
+  8007e1:	50                   	push   %eax
+  8007e2:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	89 de                	mov    %ebx,%esi
+  8007e9:	eb 03                	jmp    8007ee <vprintfmt+0x4bc>
+  8007eb:	83 ee 01             	sub    $0x1,%esi
+  8007ee:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007f2:	75 f7                	jne    8007eb <vprintfmt+0x4b9>
+  8007f4:	e9 67 fb ff ff       	jmp    800360 <vprintfmt+0x2e>
+
+008007f9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	83 ec 18             	sub    $0x18,%esp
+  8007ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800802:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800805:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800808:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80080c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80080f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800816:	85 c0                	test   %eax,%eax
+  800818:	74 26                	je     800840 <vsnprintf+0x47>
+  80081a:	85 d2                	test   %edx,%edx
+  80081c:	7e 22                	jle    800840 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80081e:	ff 75 14             	push   0x14(%ebp)
+  800821:	ff 75 10             	push   0x10(%ebp)
+  800824:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800827:	50                   	push   %eax
+  800828:	68 f8 02 80 00       	push   $0x8002f8
+  80082d:	e8 00 fb ff ff       	call   800332 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800832:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800835:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800838:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80083b:	83 c4 10             	add    $0x10,%esp
+}
+  80083e:	c9                   	leave
+  80083f:	c3                   	ret
+		return -E_INVAL;
+  800840:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800845:	eb f7                	jmp    80083e <vsnprintf+0x45>
+
+00800847 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80084d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800850:	50                   	push   %eax
+  800851:	ff 75 10             	push   0x10(%ebp)
+  800854:	ff 75 0c             	push   0xc(%ebp)
+  800857:	ff 75 08             	push   0x8(%ebp)
+  80085a:	e8 9a ff ff ff       	call   8007f9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80085f:	c9                   	leave
+  800860:	c3                   	ret
+
+00800861 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800867:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086c:	eb 03                	jmp    800871 <strlen+0x10>
+		n++;
+  80086e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800871:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800875:	75 f7                	jne    80086e <strlen+0xd>
+	return n;
+}
+  800877:	5d                   	pop    %ebp
+  800878:	c3                   	ret
+
+00800879 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800879:	55                   	push   %ebp
+  80087a:	89 e5                	mov    %esp,%ebp
+  80087c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800882:	b8 00 00 00 00       	mov    $0x0,%eax
+  800887:	eb 03                	jmp    80088c <strnlen+0x13>
+		n++;
+  800889:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80088c:	39 d0                	cmp    %edx,%eax
+  80088e:	74 08                	je     800898 <strnlen+0x1f>
+  800890:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800894:	75 f3                	jne    800889 <strnlen+0x10>
+  800896:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800898:	89 d0                	mov    %edx,%eax
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+
+0080089c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	53                   	push   %ebx
+  8008a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ab:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008af:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	84 d2                	test   %dl,%dl
+  8008b7:	75 f2                	jne    8008ab <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008b9:	89 c8                	mov    %ecx,%eax
+  8008bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008be:	c9                   	leave
+  8008bf:	c3                   	ret
+
+008008c0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	53                   	push   %ebx
+  8008c4:	83 ec 10             	sub    $0x10,%esp
+  8008c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008ca:	53                   	push   %ebx
+  8008cb:	e8 91 ff ff ff       	call   800861 <strlen>
+  8008d0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008d3:	ff 75 0c             	push   0xc(%ebp)
+  8008d6:	01 d8                	add    %ebx,%eax
+  8008d8:	50                   	push   %eax
+  8008d9:	e8 be ff ff ff       	call   80089c <strcpy>
+	return dst;
+}
+  8008de:	89 d8                	mov    %ebx,%eax
+  8008e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e3:	c9                   	leave
+  8008e4:	c3                   	ret
+
+008008e5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	56                   	push   %esi
+  8008e9:	53                   	push   %ebx
+  8008ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008f0:	89 f3                	mov    %esi,%ebx
+  8008f2:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008f5:	89 f0                	mov    %esi,%eax
+  8008f7:	eb 0f                	jmp    800908 <strncpy+0x23>
+		*dst++ = *src;
+  8008f9:	83 c0 01             	add    $0x1,%eax
+  8008fc:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ff:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800902:	80 f9 01             	cmp    $0x1,%cl
+  800905:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800908:	39 d8                	cmp    %ebx,%eax
+  80090a:	75 ed                	jne    8008f9 <strncpy+0x14>
+	}
+	return ret;
+}
+  80090c:	89 f0                	mov    %esi,%eax
+  80090e:	5b                   	pop    %ebx
+  80090f:	5e                   	pop    %esi
+  800910:	5d                   	pop    %ebp
+  800911:	c3                   	ret
+
+00800912 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	56                   	push   %esi
+  800916:	53                   	push   %ebx
+  800917:	8b 75 08             	mov    0x8(%ebp),%esi
+  80091a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80091d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800920:	89 f0                	mov    %esi,%eax
+  800922:	85 d2                	test   %edx,%edx
+  800924:	74 21                	je     800947 <strlcpy+0x35>
+  800926:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80092a:	89 f2                	mov    %esi,%edx
+  80092c:	eb 09                	jmp    800937 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80092e:	83 c1 01             	add    $0x1,%ecx
+  800931:	83 c2 01             	add    $0x1,%edx
+  800934:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800937:	39 c2                	cmp    %eax,%edx
+  800939:	74 09                	je     800944 <strlcpy+0x32>
+  80093b:	0f b6 19             	movzbl (%ecx),%ebx
+  80093e:	84 db                	test   %bl,%bl
+  800940:	75 ec                	jne    80092e <strlcpy+0x1c>
+  800942:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800944:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800947:	29 f0                	sub    %esi,%eax
+}
+  800949:	5b                   	pop    %ebx
+  80094a:	5e                   	pop    %esi
+  80094b:	5d                   	pop    %ebp
+  80094c:	c3                   	ret
+
+0080094d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80094d:	55                   	push   %ebp
+  80094e:	89 e5                	mov    %esp,%ebp
+  800950:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800953:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800956:	eb 06                	jmp    80095e <strcmp+0x11>
+		p++, q++;
+  800958:	83 c1 01             	add    $0x1,%ecx
+  80095b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80095e:	0f b6 01             	movzbl (%ecx),%eax
+  800961:	84 c0                	test   %al,%al
+  800963:	74 04                	je     800969 <strcmp+0x1c>
+  800965:	3a 02                	cmp    (%edx),%al
+  800967:	74 ef                	je     800958 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800969:	0f b6 c0             	movzbl %al,%eax
+  80096c:	0f b6 12             	movzbl (%edx),%edx
+  80096f:	29 d0                	sub    %edx,%eax
+}
+  800971:	5d                   	pop    %ebp
+  800972:	c3                   	ret
+
+00800973 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	53                   	push   %ebx
+  800977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800980:	eb 09                	jmp    80098b <strncmp+0x18>
+		n--, p++, q++;
+  800982:	83 ea 01             	sub    $0x1,%edx
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80098b:	85 d2                	test   %edx,%edx
+  80098d:	74 18                	je     8009a7 <strncmp+0x34>
+  80098f:	0f b6 18             	movzbl (%eax),%ebx
+  800992:	84 db                	test   %bl,%bl
+  800994:	74 04                	je     80099a <strncmp+0x27>
+  800996:	3a 19                	cmp    (%ecx),%bl
+  800998:	74 e8                	je     800982 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80099a:	0f b6 00             	movzbl (%eax),%eax
+  80099d:	0f b6 11             	movzbl (%ecx),%edx
+  8009a0:	29 d0                	sub    %edx,%eax
+}
+  8009a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a5:	c9                   	leave
+  8009a6:	c3                   	ret
+		return 0;
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	eb f4                	jmp    8009a2 <strncmp+0x2f>
+
+008009ae <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009b8:	eb 03                	jmp    8009bd <strchr+0xf>
+  8009ba:	83 c0 01             	add    $0x1,%eax
+  8009bd:	0f b6 10             	movzbl (%eax),%edx
+  8009c0:	84 d2                	test   %dl,%dl
+  8009c2:	74 06                	je     8009ca <strchr+0x1c>
+		if (*s == c)
+  8009c4:	38 ca                	cmp    %cl,%dl
+  8009c6:	75 f2                	jne    8009ba <strchr+0xc>
+  8009c8:	eb 05                	jmp    8009cf <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009cf:	5d                   	pop    %ebp
+  8009d0:	c3                   	ret
+
+008009d1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009db:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009de:	38 ca                	cmp    %cl,%dl
+  8009e0:	74 09                	je     8009eb <strfind+0x1a>
+  8009e2:	84 d2                	test   %dl,%dl
+  8009e4:	74 05                	je     8009eb <strfind+0x1a>
+	for (; *s; s++)
+  8009e6:	83 c0 01             	add    $0x1,%eax
+  8009e9:	eb f0                	jmp    8009db <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009eb:	5d                   	pop    %ebp
+  8009ec:	c3                   	ret
+
+008009ed <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	57                   	push   %edi
+  8009f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009f4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009f7:	85 c9                	test   %ecx,%ecx
+  8009f9:	74 20                	je     800a1b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009fb:	89 f8                	mov    %edi,%eax
+  8009fd:	09 c8                	or     %ecx,%eax
+  8009ff:	a8 03                	test   $0x3,%al
+  800a01:	75 12                	jne    800a15 <memset+0x28>
+		c &= 0xFF;
+  800a03:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a07:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a0d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a10:	fc                   	cld
+  800a11:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a13:	eb 06                	jmp    800a1b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a18:	fc                   	cld
+  800a19:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a1b:	89 f8                	mov    %edi,%eax
+  800a1d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a20:	c9                   	leave
+  800a21:	c3                   	ret
+
+00800a22 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	57                   	push   %edi
+  800a26:	56                   	push   %esi
+  800a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a2d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a30:	39 c6                	cmp    %eax,%esi
+  800a32:	73 32                	jae    800a66 <memmove+0x44>
+  800a34:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a37:	39 d0                	cmp    %edx,%eax
+  800a39:	73 2b                	jae    800a66 <memmove+0x44>
+		s += n;
+		d += n;
+  800a3b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a3e:	89 d6                	mov    %edx,%esi
+  800a40:	09 fe                	or     %edi,%esi
+  800a42:	09 ce                	or     %ecx,%esi
+  800a44:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a4a:	75 0e                	jne    800a5a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a4c:	83 ef 04             	sub    $0x4,%edi
+  800a4f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a52:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a55:	fd                   	std
+  800a56:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a58:	eb 09                	jmp    800a63 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a5a:	83 ef 01             	sub    $0x1,%edi
+  800a5d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a60:	fd                   	std
+  800a61:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a63:	fc                   	cld
+  800a64:	eb 1a                	jmp    800a80 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a66:	89 f2                	mov    %esi,%edx
+  800a68:	09 c2                	or     %eax,%edx
+  800a6a:	09 ca                	or     %ecx,%edx
+  800a6c:	f6 c2 03             	test   $0x3,%dl
+  800a6f:	75 0a                	jne    800a7b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a71:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a74:	89 c7                	mov    %eax,%edi
+  800a76:	fc                   	cld
+  800a77:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a79:	eb 05                	jmp    800a80 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a7b:	89 c7                	mov    %eax,%edi
+  800a7d:	fc                   	cld
+  800a7e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a80:	5e                   	pop    %esi
+  800a81:	5f                   	pop    %edi
+  800a82:	5d                   	pop    %ebp
+  800a83:	c3                   	ret
+
+00800a84 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a84:	55                   	push   %ebp
+  800a85:	89 e5                	mov    %esp,%ebp
+  800a87:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a8a:	ff 75 10             	push   0x10(%ebp)
+  800a8d:	ff 75 0c             	push   0xc(%ebp)
+  800a90:	ff 75 08             	push   0x8(%ebp)
+  800a93:	e8 8a ff ff ff       	call   800a22 <memmove>
+}
+  800a98:	c9                   	leave
+  800a99:	c3                   	ret
+
+00800a9a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	56                   	push   %esi
+  800a9e:	53                   	push   %ebx
+  800a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aa5:	89 c6                	mov    %eax,%esi
+  800aa7:	03 75 10             	add    0x10(%ebp),%esi
+  800aaa:	eb 06                	jmp    800ab2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800aac:	83 c0 01             	add    $0x1,%eax
+  800aaf:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ab2:	39 f0                	cmp    %esi,%eax
+  800ab4:	74 14                	je     800aca <memcmp+0x30>
+		if (*s1 != *s2)
+  800ab6:	0f b6 08             	movzbl (%eax),%ecx
+  800ab9:	0f b6 1a             	movzbl (%edx),%ebx
+  800abc:	38 d9                	cmp    %bl,%cl
+  800abe:	74 ec                	je     800aac <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ac0:	0f b6 c1             	movzbl %cl,%eax
+  800ac3:	0f b6 db             	movzbl %bl,%ebx
+  800ac6:	29 d8                	sub    %ebx,%eax
+  800ac8:	eb 05                	jmp    800acf <memcmp+0x35>
+	}
+
+	return 0;
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800acf:	5b                   	pop    %ebx
+  800ad0:	5e                   	pop    %esi
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	c3                   	ret
+
+00800ad3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800adc:	89 c2                	mov    %eax,%edx
+  800ade:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ae1:	eb 03                	jmp    800ae6 <memfind+0x13>
+  800ae3:	83 c0 01             	add    $0x1,%eax
+  800ae6:	39 d0                	cmp    %edx,%eax
+  800ae8:	73 04                	jae    800aee <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aea:	38 08                	cmp    %cl,(%eax)
+  800aec:	75 f5                	jne    800ae3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aee:	5d                   	pop    %ebp
+  800aef:	c3                   	ret
+
+00800af0 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	57                   	push   %edi
+  800af4:	56                   	push   %esi
+  800af5:	53                   	push   %ebx
+  800af6:	83 ec 1c             	sub    $0x1c,%esp
+  800af9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800afc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aff:	eb 03                	jmp    800b04 <strtol+0x14>
+		s++;
+  800b01:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b04:	0f b6 06             	movzbl (%esi),%eax
+  800b07:	3c 20                	cmp    $0x20,%al
+  800b09:	74 f6                	je     800b01 <strtol+0x11>
+  800b0b:	3c 09                	cmp    $0x9,%al
+  800b0d:	74 f2                	je     800b01 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b0f:	3c 2b                	cmp    $0x2b,%al
+  800b11:	74 43                	je     800b56 <strtol+0x66>
+	int neg = 0;
+  800b13:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b18:	3c 2d                	cmp    $0x2d,%al
+  800b1a:	74 44                	je     800b60 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b1c:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b22:	75 0f                	jne    800b33 <strtol+0x43>
+  800b24:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b27:	74 41                	je     800b6a <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b29:	85 ff                	test   %edi,%edi
+  800b2b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b30:	0f 44 f8             	cmove  %eax,%edi
+  800b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b38:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b3d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b40:	89 fb                	mov    %edi,%ebx
+  800b42:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b45:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b48:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b4b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b4e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b51:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b54:	eb 67                	jmp    800bbd <strtol+0xcd>
+		s++;
+  800b56:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5e:	eb bc                	jmp    800b1c <strtol+0x2c>
+		s++, neg = 1;
+  800b60:	83 c6 01             	add    $0x1,%esi
+  800b63:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b68:	eb b2                	jmp    800b1c <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b6a:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b6e:	74 0e                	je     800b7e <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b70:	85 ff                	test   %edi,%edi
+  800b72:	75 bf                	jne    800b33 <strtol+0x43>
+		s++, base = 8;
+  800b74:	83 c6 01             	add    $0x1,%esi
+  800b77:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b7c:	eb b5                	jmp    800b33 <strtol+0x43>
+		s += 2, base = 16;
+  800b7e:	83 c6 02             	add    $0x2,%esi
+  800b81:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b86:	eb ab                	jmp    800b33 <strtol+0x43>
+			dig = *s - '0';
+  800b88:	0f be c9             	movsbl %cl,%ecx
+  800b8b:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b8e:	39 f9                	cmp    %edi,%ecx
+  800b90:	7d 59                	jge    800beb <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b92:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b96:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b99:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b9c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b9f:	0f af d8             	imul   %eax,%ebx
+  800ba2:	0f af d7             	imul   %edi,%edx
+  800ba5:	01 d3                	add    %edx,%ebx
+  800ba7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800baa:	f7 e7                	mul    %edi
+  800bac:	01 da                	add    %ebx,%edx
+  800bae:	89 cb                	mov    %ecx,%ebx
+  800bb0:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bb3:	01 c8                	add    %ecx,%eax
+  800bb5:	11 da                	adc    %ebx,%edx
+  800bb7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bba:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc0:	0f b6 08             	movzbl (%eax),%ecx
+  800bc3:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800bc6:	80 fb 09             	cmp    $0x9,%bl
+  800bc9:	76 bd                	jbe    800b88 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800bcb:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800bce:	80 fb 19             	cmp    $0x19,%bl
+  800bd1:	77 08                	ja     800bdb <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800bd3:	0f be c9             	movsbl %cl,%ecx
+  800bd6:	83 e9 57             	sub    $0x57,%ecx
+  800bd9:	eb b3                	jmp    800b8e <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bdb:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800bde:	80 fb 19             	cmp    $0x19,%bl
+  800be1:	77 08                	ja     800beb <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800be3:	0f be c9             	movsbl %cl,%ecx
+  800be6:	83 e9 37             	sub    $0x37,%ecx
+  800be9:	eb a3                	jmp    800b8e <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800beb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bf1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bf4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bfb:	74 05                	je     800c02 <strtol+0x112>
+		*endptr = (char *) s;
+  800bfd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c00:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c02:	85 c9                	test   %ecx,%ecx
+  800c04:	74 07                	je     800c0d <strtol+0x11d>
+  800c06:	f7 d8                	neg    %eax
+  800c08:	83 d2 00             	adc    $0x0,%edx
+  800c0b:	f7 da                	neg    %edx
+}
+  800c0d:	83 c4 1c             	add    $0x1c,%esp
+  800c10:	5b                   	pop    %ebx
+  800c11:	5e                   	pop    %esi
+  800c12:	5f                   	pop    %edi
+  800c13:	5d                   	pop    %ebp
+  800c14:	c3                   	ret
+
+00800c15 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c15:	55                   	push   %ebp
+  800c16:	89 e5                	mov    %esp,%ebp
+  800c18:	57                   	push   %edi
+  800c19:	56                   	push   %esi
+  800c1a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c1b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c22:	74 18                	je     800c3c <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2f:	89 c3                	mov    %eax,%ebx
+  800c31:	89 c7                	mov    %eax,%edi
+  800c33:	89 c6                	mov    %eax,%esi
+  800c35:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c47:	89 c3                	mov    %eax,%ebx
+  800c49:	89 c7                	mov    %eax,%edi
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	8d 35 56 0c 80 00    	lea    0x800c56,%esi
+  800c54:	0f 34                	sysenter
+  800c56:	5d                   	pop    %ebp
+		goto out;
+  800c57:	eb de                	jmp    800c37 <sys_cputs+0x22>
+
+00800c59 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	56                   	push   %esi
+  800c5e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c5f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c66:	74 19                	je     800c81 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c72:	89 d1                	mov    %edx,%ecx
+  800c74:	89 d3                	mov    %edx,%ebx
+  800c76:	89 d7                	mov    %edx,%edi
+  800c78:	89 d6                	mov    %edx,%esi
+  800c7a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c7c:	5b                   	pop    %ebx
+  800c7d:	5e                   	pop    %esi
+  800c7e:	5f                   	pop    %edi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c86:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c8b:	89 d1                	mov    %edx,%ecx
+  800c8d:	89 d3                	mov    %edx,%ebx
+  800c8f:	89 d7                	mov    %edx,%edi
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	8d 35 9c 0c 80 00    	lea    0x800c9c,%esi
+  800c9a:	0f 34                	sysenter
+  800c9c:	5d                   	pop    %ebp
+		goto out;
+  800c9d:	eb dd                	jmp    800c7c <sys_cgetc+0x23>
+
+00800c9f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	57                   	push   %edi
+  800ca3:	56                   	push   %esi
+  800ca4:	53                   	push   %ebx
+  800ca5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ca8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800caf:	74 21                	je     800cd2 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	89 cb                	mov    %ecx,%ebx
+  800cc0:	89 cf                	mov    %ecx,%edi
+  800cc2:	89 ce                	mov    %ecx,%esi
+  800cc4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cc6:	85 c0                	test   %eax,%eax
+  800cc8:	7f 27                	jg     800cf1 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccd:	5b                   	pop    %ebx
+  800cce:	5e                   	pop    %esi
+  800ccf:	5f                   	pop    %edi
+  800cd0:	5d                   	pop    %ebp
+  800cd1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cda:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cdf:	89 cb                	mov    %ecx,%ebx
+  800ce1:	89 cf                	mov    %ecx,%edi
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	8d 35 ee 0c 80 00    	lea    0x800cee,%esi
+  800cec:	0f 34                	sysenter
+  800cee:	5d                   	pop    %ebp
+		goto out;
+  800cef:	eb d5                	jmp    800cc6 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  800cf4:	50                   	push   %eax
+  800cf5:	6a 03                	push   $0x3
+  800cf7:	68 4b 30 80 00       	push   $0x80304b
+  800cfc:	6a 3f                	push   $0x3f
+  800cfe:	68 68 30 80 00       	push   $0x803068
+  800d03:	e8 71 f4 ff ff       	call   800179 <_panic>
+
+00800d08 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	57                   	push   %edi
+  800d0c:	56                   	push   %esi
+  800d0d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d0e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d15:	74 19                	je     800d30 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d21:	89 d1                	mov    %edx,%ecx
+  800d23:	89 d3                	mov    %edx,%ebx
+  800d25:	89 d7                	mov    %edx,%edi
+  800d27:	89 d6                	mov    %edx,%esi
+  800d29:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d2b:	5b                   	pop    %ebx
+  800d2c:	5e                   	pop    %esi
+  800d2d:	5f                   	pop    %edi
+  800d2e:	5d                   	pop    %ebp
+  800d2f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d35:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3a:	89 d1                	mov    %edx,%ecx
+  800d3c:	89 d3                	mov    %edx,%ebx
+  800d3e:	89 d7                	mov    %edx,%edi
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	8d 35 4b 0d 80 00    	lea    0x800d4b,%esi
+  800d49:	0f 34                	sysenter
+  800d4b:	5d                   	pop    %ebp
+		goto out;
+  800d4c:	eb dd                	jmp    800d2b <sys_getenvid+0x23>
+
+00800d4e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d4e:	55                   	push   %ebp
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	57                   	push   %edi
+  800d52:	56                   	push   %esi
+  800d53:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d54:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d5b:	74 19                	je     800d76 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d62:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d67:	89 d1                	mov    %edx,%ecx
+  800d69:	89 d3                	mov    %edx,%ebx
+  800d6b:	89 d7                	mov    %edx,%edi
+  800d6d:	89 d6                	mov    %edx,%esi
+  800d6f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d71:	5b                   	pop    %ebx
+  800d72:	5e                   	pop    %esi
+  800d73:	5f                   	pop    %edi
+  800d74:	5d                   	pop    %ebp
+  800d75:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d80:	89 d1                	mov    %edx,%ecx
+  800d82:	89 d3                	mov    %edx,%ebx
+  800d84:	89 d7                	mov    %edx,%edi
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	8d 35 91 0d 80 00    	lea    0x800d91,%esi
+  800d8f:	0f 34                	sysenter
+  800d91:	5d                   	pop    %ebp
+		goto out;
+  800d92:	eb dd                	jmp    800d71 <sys_yield+0x23>
+
+00800d94 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d9d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800da4:	74 23                	je     800dc9 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800da6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dab:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db9:	89 f7                	mov    %esi,%edi
+  800dbb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dbd:	85 c0                	test   %eax,%eax
+  800dbf:	7f 29                	jg     800dea <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5e                   	pop    %esi
+  800dc6:	5f                   	pop    %edi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcf:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddc:	55                   	push   %ebp
+  800ddd:	89 e5                	mov    %esp,%ebp
+  800ddf:	8d 35 e7 0d 80 00    	lea    0x800de7,%esi
+  800de5:	0f 34                	sysenter
+  800de7:	5d                   	pop    %ebp
+		goto out;
+  800de8:	eb d3                	jmp    800dbd <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+  800ded:	50                   	push   %eax
+  800dee:	6a 04                	push   $0x4
+  800df0:	68 4b 30 80 00       	push   $0x80304b
+  800df5:	6a 3f                	push   $0x3f
+  800df7:	68 68 30 80 00       	push   $0x803068
+  800dfc:	e8 78 f3 ff ff       	call   800179 <_panic>
+
+00800e01 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+  800e0a:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e0d:	85 f6                	test   %esi,%esi
+  800e0f:	75 09                	jne    800e1a <sys_page_map+0x19>
+  800e11:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e18:	74 1f                	je     800e39 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e1a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e28:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e2b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2d:	85 c0                	test   %eax,%eax
+  800e2f:	7f 27                	jg     800e58 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e34:	5b                   	pop    %ebx
+  800e35:	5e                   	pop    %esi
+  800e36:	5f                   	pop    %edi
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	8d 35 55 0e 80 00    	lea    0x800e55,%esi
+  800e53:	0f 34                	sysenter
+  800e55:	5d                   	pop    %ebp
+		goto out;
+  800e56:	eb d5                	jmp    800e2d <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+  800e5b:	50                   	push   %eax
+  800e5c:	6a 05                	push   $0x5
+  800e5e:	68 4b 30 80 00       	push   $0x80304b
+  800e63:	6a 3f                	push   $0x3f
+  800e65:	68 68 30 80 00       	push   $0x803068
+  800e6a:	e8 0a f3 ff ff       	call   800179 <_panic>
+
+00800e6f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	57                   	push   %edi
+  800e73:	56                   	push   %esi
+  800e74:	53                   	push   %ebx
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e78:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e7f:	74 22                	je     800ea3 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e86:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e91:	89 df                	mov    %ebx,%edi
+  800e93:	89 de                	mov    %ebx,%esi
+  800e95:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e97:	85 c0                	test   %eax,%eax
+  800e99:	7f 28                	jg     800ec3 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eae:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eb3:	89 df                	mov    %ebx,%edi
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	8d 35 c0 0e 80 00    	lea    0x800ec0,%esi
+  800ebe:	0f 34                	sysenter
+  800ec0:	5d                   	pop    %ebp
+		goto out;
+  800ec1:	eb d4                	jmp    800e97 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	6a 06                	push   $0x6
+  800ec9:	68 4b 30 80 00       	push   $0x80304b
+  800ece:	6a 3f                	push   $0x3f
+  800ed0:	68 68 30 80 00       	push   $0x803068
+  800ed5:	e8 9f f2 ff ff       	call   800179 <_panic>
+
+00800eda <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ee3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eea:	74 22                	je     800f0e <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800eec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	89 df                	mov    %ebx,%edi
+  800efe:	89 de                	mov    %ebx,%esi
+  800f00:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	7f 28                	jg     800f2e <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f19:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f1e:	89 df                	mov    %ebx,%edi
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	8d 35 2b 0f 80 00    	lea    0x800f2b,%esi
+  800f29:	0f 34                	sysenter
+  800f2b:	5d                   	pop    %ebp
+		goto out;
+  800f2c:	eb d4                	jmp    800f02 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  800f31:	50                   	push   %eax
+  800f32:	6a 08                	push   $0x8
+  800f34:	68 4b 30 80 00       	push   $0x80304b
+  800f39:	6a 3f                	push   $0x3f
+  800f3b:	68 68 30 80 00       	push   $0x803068
+  800f40:	e8 34 f2 ff ff       	call   800179 <_panic>
+
+00800f45 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	57                   	push   %edi
+  800f49:	56                   	push   %esi
+  800f4a:	53                   	push   %ebx
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f4e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f55:	74 22                	je     800f79 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f67:	89 df                	mov    %ebx,%edi
+  800f69:	89 de                	mov    %ebx,%esi
+  800f6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6d:	85 c0                	test   %eax,%eax
+  800f6f:	7f 28                	jg     800f99 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f74:	5b                   	pop    %ebx
+  800f75:	5e                   	pop    %esi
+  800f76:	5f                   	pop    %edi
+  800f77:	5d                   	pop    %ebp
+  800f78:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f84:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f89:	89 df                	mov    %ebx,%edi
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	8d 35 96 0f 80 00    	lea    0x800f96,%esi
+  800f94:	0f 34                	sysenter
+  800f96:	5d                   	pop    %ebp
+		goto out;
+  800f97:	eb d4                	jmp    800f6d <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+  800f9c:	50                   	push   %eax
+  800f9d:	6a 09                	push   $0x9
+  800f9f:	68 4b 30 80 00       	push   $0x80304b
+  800fa4:	6a 3f                	push   $0x3f
+  800fa6:	68 68 30 80 00       	push   $0x803068
+  800fab:	e8 c9 f1 ff ff       	call   800179 <_panic>
+
+00800fb0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	57                   	push   %edi
+  800fb4:	56                   	push   %esi
+  800fb5:	53                   	push   %ebx
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fb9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fc0:	74 22                	je     800fe4 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800fc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	89 df                	mov    %ebx,%edi
+  800fd4:	89 de                	mov    %ebx,%esi
+  800fd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 28                	jg     801004 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5f                   	pop    %edi
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fe4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ff4:	89 df                	mov    %ebx,%edi
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	8d 35 01 10 80 00    	lea    0x801001,%esi
+  800fff:	0f 34                	sysenter
+  801001:	5d                   	pop    %ebp
+		goto out;
+  801002:	eb d4                	jmp    800fd8 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 0a                	push   $0xa
+  80100a:	68 4b 30 80 00       	push   $0x80304b
+  80100f:	6a 3f                	push   $0x3f
+  801011:	68 68 30 80 00       	push   $0x803068
+  801016:	e8 5e f1 ff ff       	call   800179 <_panic>
+
+0080101b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801024:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80102b:	74 22                	je     80104f <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80102d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801032:	b8 17 00 00 00       	mov    $0x17,%eax
+  801037:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103d:	89 df                	mov    %ebx,%edi
+  80103f:	89 de                	mov    %ebx,%esi
+  801041:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801043:	85 c0                	test   %eax,%eax
+  801045:	7f 28                	jg     80106f <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80104f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801054:	8b 55 08             	mov    0x8(%ebp),%edx
+  801057:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80105f:	89 df                	mov    %ebx,%edi
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	8d 35 6c 10 80 00    	lea    0x80106c,%esi
+  80106a:	0f 34                	sysenter
+  80106c:	5d                   	pop    %ebp
+		goto out;
+  80106d:	eb d4                	jmp    801043 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	50                   	push   %eax
+  801073:	6a 17                	push   $0x17
+  801075:	68 4b 30 80 00       	push   $0x80304b
+  80107a:	6a 3f                	push   $0x3f
+  80107c:	68 68 30 80 00       	push   $0x803068
+  801081:	e8 f3 f0 ff ff       	call   800179 <_panic>
+
+00801086 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80108f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801096:	74 22                	je     8010ba <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801098:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109d:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	89 df                	mov    %ebx,%edi
+  8010aa:	89 de                	mov    %ebx,%esi
+  8010ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	7f 28                	jg     8010da <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c5:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010ca:	89 df                	mov    %ebx,%edi
+  8010cc:	55                   	push   %ebp
+  8010cd:	89 e5                	mov    %esp,%ebp
+  8010cf:	8d 35 d7 10 80 00    	lea    0x8010d7,%esi
+  8010d5:	0f 34                	sysenter
+  8010d7:	5d                   	pop    %ebp
+		goto out;
+  8010d8:	eb d4                	jmp    8010ae <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010da:	83 ec 0c             	sub    $0xc,%esp
+  8010dd:	50                   	push   %eax
+  8010de:	6a 18                	push   $0x18
+  8010e0:	68 4b 30 80 00       	push   $0x80304b
+  8010e5:	6a 3f                	push   $0x3f
+  8010e7:	68 68 30 80 00       	push   $0x803068
+  8010ec:	e8 88 f0 ff ff       	call   800179 <_panic>
+
+008010f1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010f7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010fe:	74 1d                	je     80111d <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801100:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801105:	be 00 00 00 00       	mov    $0x0,%esi
+  80110a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801110:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801113:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801116:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801118:	5b                   	pop    %ebx
+  801119:	5e                   	pop    %esi
+  80111a:	5f                   	pop    %edi
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80111d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801120:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801123:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801128:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	8d 35 39 11 80 00    	lea    0x801139,%esi
+  801137:	0f 34                	sysenter
+  801139:	5d                   	pop    %ebp
+		goto out;
+  80113a:	eb dc                	jmp    801118 <sys_ipc_try_send+0x27>
+
+0080113c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+  801142:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801145:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80114c:	74 21                	je     80116f <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80114e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801153:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801158:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115b:	89 cb                	mov    %ecx,%ebx
+  80115d:	89 cf                	mov    %ecx,%edi
+  80115f:	89 ce                	mov    %ecx,%esi
+  801161:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801163:	85 c0                	test   %eax,%eax
+  801165:	7f 27                	jg     80118e <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801167:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116a:	5b                   	pop    %ebx
+  80116b:	5e                   	pop    %esi
+  80116c:	5f                   	pop    %edi
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80116f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801172:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801177:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80117c:	89 cb                	mov    %ecx,%ebx
+  80117e:	89 cf                	mov    %ecx,%edi
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	8d 35 8b 11 80 00    	lea    0x80118b,%esi
+  801189:	0f 34                	sysenter
+  80118b:	5d                   	pop    %ebp
+		goto out;
+  80118c:	eb d5                	jmp    801163 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118e:	83 ec 0c             	sub    $0xc,%esp
+  801191:	50                   	push   %eax
+  801192:	6a 0d                	push   $0xd
+  801194:	68 4b 30 80 00       	push   $0x80304b
+  801199:	6a 3f                	push   $0x3f
+  80119b:	68 68 30 80 00       	push   $0x803068
+  8011a0:	e8 d4 ef ff ff       	call   800179 <_panic>
+
+008011a5 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	57                   	push   %edi
+  8011a9:	56                   	push   %esi
+  8011aa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011ab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011b2:	74 1b                	je     8011cf <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c4:	89 df                	mov    %ebx,%edi
+  8011c6:	89 de                	mov    %ebx,%esi
+  8011c8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011ca:	5b                   	pop    %ebx
+  8011cb:	5e                   	pop    %esi
+  8011cc:	5f                   	pop    %edi
+  8011cd:	5d                   	pop    %ebp
+  8011ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011da:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011df:	89 df                	mov    %ebx,%edi
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+  8011e4:	8d 35 ec 11 80 00    	lea    0x8011ec,%esi
+  8011ea:	0f 34                	sysenter
+  8011ec:	5d                   	pop    %ebp
+		goto out;
+  8011ed:	eb db                	jmp    8011ca <sys_ipc_recv_until+0x25>
+
+008011ef <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011fc:	74 19                	je     801217 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8011fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801203:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801208:	89 d1                	mov    %edx,%ecx
+  80120a:	89 d3                	mov    %edx,%ebx
+  80120c:	89 d7                	mov    %edx,%edi
+  80120e:	89 d6                	mov    %edx,%esi
+  801210:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801221:	89 d1                	mov    %edx,%ecx
+  801223:	89 d3                	mov    %edx,%ebx
+  801225:	89 d7                	mov    %edx,%edi
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	8d 35 32 12 80 00    	lea    0x801232,%esi
+  801230:	0f 34                	sysenter
+  801232:	5d                   	pop    %ebp
+		goto out;
+  801233:	eb dd                	jmp    801212 <sys_time_msec+0x23>
+
+00801235 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80123b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801242:	74 1a                	je     80125e <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801244:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801249:	b8 10 00 00 00       	mov    $0x10,%eax
+  80124e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801251:	89 cb                	mov    %ecx,%ebx
+  801253:	89 cf                	mov    %ecx,%edi
+  801255:	89 ce                	mov    %ecx,%esi
+  801257:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801259:	5b                   	pop    %ebx
+  80125a:	5e                   	pop    %esi
+  80125b:	5f                   	pop    %edi
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80125e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801261:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801266:	b8 10 00 00 00       	mov    $0x10,%eax
+  80126b:	89 cb                	mov    %ecx,%ebx
+  80126d:	89 cf                	mov    %ecx,%edi
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	8d 35 7a 12 80 00    	lea    0x80127a,%esi
+  801278:	0f 34                	sysenter
+  80127a:	5d                   	pop    %ebp
+		goto out;
+  80127b:	eb dc                	jmp    801259 <sys_sleep_until+0x24>
+
+0080127d <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	57                   	push   %edi
+  801281:	56                   	push   %esi
+  801282:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801283:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80128a:	74 1a                	je     8012a6 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80128c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801291:	b8 11 00 00 00       	mov    $0x11,%eax
+  801296:	8b 55 08             	mov    0x8(%ebp),%edx
+  801299:	89 cb                	mov    %ecx,%ebx
+  80129b:	89 cf                	mov    %ecx,%edi
+  80129d:	89 ce                	mov    %ecx,%esi
+  80129f:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012a1:	5b                   	pop    %ebx
+  8012a2:	5e                   	pop    %esi
+  8012a3:	5f                   	pop    %edi
+  8012a4:	5d                   	pop    %ebp
+  8012a5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ae:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012b3:	89 cb                	mov    %ecx,%ebx
+  8012b5:	89 cf                	mov    %ecx,%edi
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	8d 35 c2 12 80 00    	lea    0x8012c2,%esi
+  8012c0:	0f 34                	sysenter
+  8012c2:	5d                   	pop    %ebp
+		goto out;
+  8012c3:	eb dc                	jmp    8012a1 <sys_env_print_stats+0x24>
+
+008012c5 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012c5:	55                   	push   %ebp
+  8012c6:	89 e5                	mov    %esp,%ebp
+  8012c8:	57                   	push   %edi
+  8012c9:	56                   	push   %esi
+  8012ca:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012cb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012d2:	74 1b                	je     8012ef <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	89 df                	mov    %ebx,%edi
+  8012e6:	89 de                	mov    %ebx,%esi
+  8012e8:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012ff:	89 df                	mov    %ebx,%edi
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  801304:	8d 35 0c 13 80 00    	lea    0x80130c,%esi
+  80130a:	0f 34                	sysenter
+  80130c:	5d                   	pop    %ebp
+		goto out;
+  80130d:	eb db                	jmp    8012ea <sys_perf+0x25>
+
+0080130f <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801315:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80131c:	74 19                	je     801337 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80131e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801323:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801328:	89 d1                	mov    %edx,%ecx
+  80132a:	89 d3                	mov    %edx,%ebx
+  80132c:	89 d7                	mov    %edx,%edi
+  80132e:	89 d6                	mov    %edx,%esi
+  801330:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801332:	5b                   	pop    %ebx
+  801333:	5e                   	pop    %esi
+  801334:	5f                   	pop    %edi
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801341:	89 d1                	mov    %edx,%ecx
+  801343:	89 d3                	mov    %edx,%ebx
+  801345:	89 d7                	mov    %edx,%edi
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	8d 35 52 13 80 00    	lea    0x801352,%esi
+  801350:	0f 34                	sysenter
+  801352:	5d                   	pop    %ebp
+		goto out;
+  801353:	eb dd                	jmp    801332 <sys_fork+0x23>
+
+00801355 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801355:	55                   	push   %ebp
+  801356:	89 e5                	mov    %esp,%ebp
+  801358:	57                   	push   %edi
+  801359:	56                   	push   %esi
+  80135a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80135b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801362:	74 1c                	je     801380 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801364:	be 00 00 00 00       	mov    $0x0,%esi
+  801369:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80136e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801374:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801377:	89 f7                	mov    %esi,%edi
+  801379:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80137b:	5b                   	pop    %ebx
+  80137c:	5e                   	pop    %esi
+  80137d:	5f                   	pop    %edi
+  80137e:	5d                   	pop    %ebp
+  80137f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801380:	8b 55 08             	mov    0x8(%ebp),%edx
+  801383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801386:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80138b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801390:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	8d 35 9e 13 80 00    	lea    0x80139e,%esi
+  80139c:	0f 34                	sysenter
+  80139e:	5d                   	pop    %ebp
+		goto out;
+  80139f:	eb da                	jmp    80137b <sys_thread_create+0x26>
+
+008013a1 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013a1:	55                   	push   %ebp
+  8013a2:	89 e5                	mov    %esp,%ebp
+  8013a4:	57                   	push   %edi
+  8013a5:	56                   	push   %esi
+  8013a6:	53                   	push   %ebx
+  8013a7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013aa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013b1:	74 24                	je     8013d7 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013b3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	7f 27                	jg     8013f6 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013dd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013e8:	55                   	push   %ebp
+  8013e9:	89 e5                	mov    %esp,%ebp
+  8013eb:	8d 35 f3 13 80 00    	lea    0x8013f3,%esi
+  8013f1:	0f 34                	sysenter
+  8013f3:	5d                   	pop    %ebp
+		goto out;
+  8013f4:	eb d5                	jmp    8013cb <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f6:	83 ec 0c             	sub    $0xc,%esp
+  8013f9:	50                   	push   %eax
+  8013fa:	6a 1f                	push   $0x1f
+  8013fc:	68 4b 30 80 00       	push   $0x80304b
+  801401:	6a 3f                	push   $0x3f
+  801403:	68 68 30 80 00       	push   $0x803068
+  801408:	e8 6c ed ff ff       	call   800179 <_panic>
+
+0080140d <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	57                   	push   %edi
+  801411:	56                   	push   %esi
+  801412:	53                   	push   %ebx
+  801413:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801416:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80141d:	74 23                	je     801442 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80141f:	be 00 00 00 00       	mov    $0x0,%esi
+  801424:	b8 20 00 00 00       	mov    $0x20,%eax
+  801429:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801432:	89 f7                	mov    %esi,%edi
+  801434:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801436:	85 c0                	test   %eax,%eax
+  801438:	7f 29                	jg     801463 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80143a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143d:	5b                   	pop    %ebx
+  80143e:	5e                   	pop    %esi
+  80143f:	5f                   	pop    %edi
+  801440:	5d                   	pop    %ebp
+  801441:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801442:	8b 55 08             	mov    0x8(%ebp),%edx
+  801445:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801448:	b8 20 00 00 00       	mov    $0x20,%eax
+  80144d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801452:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	8d 35 60 14 80 00    	lea    0x801460,%esi
+  80145e:	0f 34                	sysenter
+  801460:	5d                   	pop    %ebp
+		goto out;
+  801461:	eb d3                	jmp    801436 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801463:	83 ec 0c             	sub    $0xc,%esp
+  801466:	50                   	push   %eax
+  801467:	6a 20                	push   $0x20
+  801469:	68 4b 30 80 00       	push   $0x80304b
+  80146e:	6a 3f                	push   $0x3f
+  801470:	68 68 30 80 00       	push   $0x803068
+  801475:	e8 ff ec ff ff       	call   800179 <_panic>
+
+0080147a <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	57                   	push   %edi
+  80147e:	56                   	push   %esi
+  80147f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801480:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801487:	74 1b                	je     8014a4 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801489:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801493:	8b 55 08             	mov    0x8(%ebp),%edx
+  801496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801499:	89 df                	mov    %ebx,%edi
+  80149b:	89 de                	mov    %ebx,%esi
+  80149d:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80149f:	5b                   	pop    %ebx
+  8014a0:	5e                   	pop    %esi
+  8014a1:	5f                   	pop    %edi
+  8014a2:	5d                   	pop    %ebp
+  8014a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014af:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014b4:	89 df                	mov    %ebx,%edi
+  8014b6:	55                   	push   %ebp
+  8014b7:	89 e5                	mov    %esp,%ebp
+  8014b9:	8d 35 c1 14 80 00    	lea    0x8014c1,%esi
+  8014bf:	0f 34                	sysenter
+  8014c1:	5d                   	pop    %ebp
+		goto out;
+  8014c2:	eb db                	jmp    80149f <sys_batch+0x25>
+
+008014c4 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014c4:	55                   	push   %ebp
+  8014c5:	89 e5                	mov    %esp,%ebp
+  8014c7:	57                   	push   %edi
+  8014c8:	56                   	push   %esi
+  8014c9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ca:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014d1:	74 1a                	je     8014ed <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8014d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e0:	89 cb                	mov    %ecx,%ebx
+  8014e2:	89 cf                	mov    %ecx,%edi
+  8014e4:	89 ce                	mov    %ecx,%esi
+  8014e6:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5f                   	pop    %edi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014fa:	89 cb                	mov    %ecx,%ebx
+  8014fc:	89 cf                	mov    %ecx,%edi
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	8d 35 09 15 80 00    	lea    0x801509,%esi
+  801507:	0f 34                	sysenter
+  801509:	5d                   	pop    %ebp
+		goto out;
+  80150a:	eb dc                	jmp    8014e8 <sys_trace_ctl+0x24>
+
+0080150c <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80150c:	55                   	push   %ebp
+  80150d:	89 e5                	mov    %esp,%ebp
+  80150f:	57                   	push   %edi
+  801510:	56                   	push   %esi
+  801511:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801512:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801519:	74 1c                	je     801537 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80151b:	be 00 00 00 00       	mov    $0x0,%esi
+  801520:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801525:	8b 55 08             	mov    0x8(%ebp),%edx
+  801528:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152e:	89 f7                	mov    %esi,%edi
+  801530:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801532:	5b                   	pop    %ebx
+  801533:	5e                   	pop    %esi
+  801534:	5f                   	pop    %edi
+  801535:	5d                   	pop    %ebp
+  801536:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801542:	bf 00 00 00 00       	mov    $0x0,%edi
+  801547:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154a:	55                   	push   %ebp
+  80154b:	89 e5                	mov    %esp,%ebp
+  80154d:	8d 35 55 15 80 00    	lea    0x801555,%esi
+  801553:	0f 34                	sysenter
+  801555:	5d                   	pop    %ebp
+		goto out;
+  801556:	eb da                	jmp    801532 <sys_trace_read+0x26>
+
+00801558 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	57                   	push   %edi
+  80155c:	56                   	push   %esi
+  80155d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80155e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801565:	74 1c                	je     801583 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801567:	be 00 00 00 00       	mov    $0x0,%esi
+  80156c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801571:	8b 55 08             	mov    0x8(%ebp),%edx
+  801574:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801577:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157a:	89 f7                	mov    %esi,%edi
+  80157c:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80157e:	5b                   	pop    %ebx
+  80157f:	5e                   	pop    %esi
+  801580:	5f                   	pop    %edi
+  801581:	5d                   	pop    %ebp
+  801582:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801583:	8b 55 08             	mov    0x8(%ebp),%edx
+  801586:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801589:	b8 21 00 00 00       	mov    $0x21,%eax
+  80158e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801593:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	8d 35 a1 15 80 00    	lea    0x8015a1,%esi
+  80159f:	0f 34                	sysenter
+  8015a1:	5d                   	pop    %ebp
+		goto out;
+  8015a2:	eb da                	jmp    80157e <sys_meminfo+0x26>
+
+008015a4 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	57                   	push   %edi
+  8015a8:	56                   	push   %esi
+  8015a9:	53                   	push   %ebx
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015b1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015b8:	74 1f                	je     8015d9 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bf:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c7:	89 df                	mov    %ebx,%edi
+  8015c9:	89 de                	mov    %ebx,%esi
+  8015cb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015cd:	85 c0                	test   %eax,%eax
+  8015cf:	7f 25                	jg     8015f6 <sys_env_set_ksm+0x52>
+}
+  8015d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d4:	5b                   	pop    %ebx
+  8015d5:	5e                   	pop    %esi
+  8015d6:	5f                   	pop    %edi
+  8015d7:	5d                   	pop    %ebp
+  8015d8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e1:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	55                   	push   %ebp
+  8015e9:	89 e5                	mov    %esp,%ebp
+  8015eb:	8d 35 f3 15 80 00    	lea    0x8015f3,%esi
+  8015f1:	0f 34                	sysenter
+  8015f3:	5d                   	pop    %ebp
+		goto out;
+  8015f4:	eb d7                	jmp    8015cd <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015f6:	83 ec 0c             	sub    $0xc,%esp
+  8015f9:	50                   	push   %eax
+  8015fa:	6a 22                	push   $0x22
+  8015fc:	68 4b 30 80 00       	push   $0x80304b
+  801601:	6a 3f                	push   $0x3f
+  801603:	68 68 30 80 00       	push   $0x803068
+  801608:	e8 6c eb ff ff       	call   800179 <_panic>
+
+0080160d <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	57                   	push   %edi
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801616:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801619:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801620:	74 24                	je     801646 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801622:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801627:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80162c:	89 cb                	mov    %ecx,%ebx
+  80162e:	89 cf                	mov    %ecx,%edi
+  801630:	89 ce                	mov    %ecx,%esi
+  801632:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801634:	85 c0                	test   %eax,%eax
+  801636:	7f 2a                	jg     801662 <sys_time_nsec+0x55>
+	return ns;
+}
+  801638:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80163b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80163e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801641:	5b                   	pop    %ebx
+  801642:	5e                   	pop    %esi
+  801643:	5f                   	pop    %edi
+  801644:	5d                   	pop    %ebp
+  801645:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801646:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801650:	89 cb                	mov    %ecx,%ebx
+  801652:	89 cf                	mov    %ecx,%edi
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	8d 35 5f 16 80 00    	lea    0x80165f,%esi
+  80165d:	0f 34                	sysenter
+  80165f:	5d                   	pop    %ebp
+		goto out;
+  801660:	eb d2                	jmp    801634 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801662:	83 ec 0c             	sub    $0xc,%esp
+  801665:	50                   	push   %eax
+  801666:	6a 0f                	push   $0xf
+  801668:	68 4b 30 80 00       	push   $0x80304b
+  80166d:	6a 3f                	push   $0x3f
+  80166f:	68 68 30 80 00       	push   $0x803068
+  801674:	e8 00 eb ff ff       	call   800179 <_panic>
+
+00801679 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	57                   	push   %edi
+  80167d:	56                   	push   %esi
+  80167e:	53                   	push   %ebx
+  80167f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801682:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801689:	74 22                	je     8016ad <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80168b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801690:	b8 12 00 00 00       	mov    $0x12,%eax
+  801695:	8b 55 08             	mov    0x8(%ebp),%edx
+  801698:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169b:	89 df                	mov    %ebx,%edi
+  80169d:	89 de                	mov    %ebx,%esi
+  80169f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016a1:	85 c0                	test   %eax,%eax
+  8016a3:	7f 28                	jg     8016cd <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a8:	5b                   	pop    %ebx
+  8016a9:	5e                   	pop    %esi
+  8016aa:	5f                   	pop    %edi
+  8016ab:	5d                   	pop    %ebp
+  8016ac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b8:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016bd:	89 df                	mov    %ebx,%edi
+  8016bf:	55                   	push   %ebp
+  8016c0:	89 e5                	mov    %esp,%ebp
+  8016c2:	8d 35 ca 16 80 00    	lea    0x8016ca,%esi
+  8016c8:	0f 34                	sysenter
+  8016ca:	5d                   	pop    %ebp
+		goto out;
+  8016cb:	eb d4                	jmp    8016a1 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	50                   	push   %eax
+  8016d1:	6a 12                	push   $0x12
+  8016d3:	68 4b 30 80 00       	push   $0x80304b
+  8016d8:	6a 3f                	push   $0x3f
+  8016da:	68 68 30 80 00       	push   $0x803068
+  8016df:	e8 95 ea ff ff       	call   800179 <_panic>
+
+008016e4 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016e4:	55                   	push   %ebp
+  8016e5:	89 e5                	mov    %esp,%ebp
+  8016e7:	57                   	push   %edi
+  8016e8:	56                   	push   %esi
+  8016e9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016ea:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016f1:	74 1b                	je     80170e <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8016f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801700:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801703:	89 df                	mov    %ebx,%edi
+  801705:	89 de                	mov    %ebx,%esi
+  801707:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801709:	5b                   	pop    %ebx
+  80170a:	5e                   	pop    %esi
+  80170b:	5f                   	pop    %edi
+  80170c:	5d                   	pop    %ebp
+  80170d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80170e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801713:	8b 55 08             	mov    0x8(%ebp),%edx
+  801716:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801719:	b8 13 00 00 00       	mov    $0x13,%eax
+  80171e:	89 df                	mov    %ebx,%edi
+  801720:	55                   	push   %ebp
+  801721:	89 e5                	mov    %esp,%ebp
+  801723:	8d 35 2b 17 80 00    	lea    0x80172b,%esi
+  801729:	0f 34                	sysenter
+  80172b:	5d                   	pop    %ebp
+		goto out;
+  80172c:	eb db                	jmp    801709 <sys_e1000_receive+0x25>
+
+0080172e <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	57                   	push   %edi
+  801732:	56                   	push   %esi
+  801733:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801734:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80173b:	74 1b                	je     801758 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80173d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801742:	b8 14 00 00 00       	mov    $0x14,%eax
+  801747:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174d:	89 df                	mov    %ebx,%edi
+  80174f:	89 de                	mov    %ebx,%esi
+  801751:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801753:	5b                   	pop    %ebx
+  801754:	5e                   	pop    %esi
+  801755:	5f                   	pop    %edi
+  801756:	5d                   	pop    %ebp
+  801757:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801758:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801760:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801763:	b8 14 00 00 00       	mov    $0x14,%eax
+  801768:	89 df                	mov    %ebx,%edi
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	8d 35 75 17 80 00    	lea    0x801775,%esi
+  801773:	0f 34                	sysenter
+  801775:	5d                   	pop    %ebp
+		goto out;
+  801776:	eb db                	jmp    801753 <sys_e1000_read_hwaddr+0x25>
+
+00801778 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801778:	55                   	push   %ebp
+  801779:	89 e5                	mov    %esp,%ebp
+  80177b:	57                   	push   %edi
+  80177c:	56                   	push   %esi
+  80177d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80177e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801785:	74 1a                	je     8017a1 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801787:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801791:	8b 55 08             	mov    0x8(%ebp),%edx
+  801794:	89 cb                	mov    %ecx,%ebx
+  801796:	89 cf                	mov    %ecx,%edi
+  801798:	89 ce                	mov    %ecx,%esi
+  80179a:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80179c:	5b                   	pop    %ebx
+  80179d:	5e                   	pop    %esi
+  80179e:	5f                   	pop    %edi
+  80179f:	5d                   	pop    %ebp
+  8017a0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017ae:	89 cb                	mov    %ecx,%ebx
+  8017b0:	89 cf                	mov    %ecx,%edi
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	8d 35 bd 17 80 00    	lea    0x8017bd,%esi
+  8017bb:	0f 34                	sysenter
+  8017bd:	5d                   	pop    %ebp
+		goto out;
+  8017be:	eb dc                	jmp    80179c <sys_sb16_read_version+0x24>
+
+008017c0 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017c0:	55                   	push   %ebp
+  8017c1:	89 e5                	mov    %esp,%ebp
+  8017c3:	57                   	push   %edi
+  8017c4:	56                   	push   %esi
+  8017c5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017c6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017cd:	74 1b                	je     8017ea <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017df:	89 df                	mov    %ebx,%edi
+  8017e1:	89 de                	mov    %ebx,%esi
+  8017e3:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017e5:	5b                   	pop    %ebx
+  8017e6:	5e                   	pop    %esi
+  8017e7:	5f                   	pop    %edi
+  8017e8:	5d                   	pop    %ebp
+  8017e9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017fa:	89 df                	mov    %ebx,%edi
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	8d 35 07 18 80 00    	lea    0x801807,%esi
+  801805:	0f 34                	sysenter
+  801807:	5d                   	pop    %ebp
+		goto out;
+  801808:	eb db                	jmp    8017e5 <sys_sb16_play+0x25>
+
+0080180a <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  801810:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  801817:	74 0a                	je     801823 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801819:	8b 45 08             	mov    0x8(%ebp),%eax
+  80181c:	a3 10 50 80 00       	mov    %eax,0x805010
+}
+  801821:	c9                   	leave
+  801822:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  801823:	83 ec 04             	sub    $0x4,%esp
+  801826:	6a 07                	push   $0x7
+  801828:	68 00 f0 bf ee       	push   $0xeebff000
+  80182d:	6a 00                	push   $0x0
+  80182f:	e8 60 f5 ff ff       	call   800d94 <sys_page_alloc>
+  801834:	83 c4 10             	add    $0x10,%esp
+  801837:	85 c0                	test   %eax,%eax
+  801839:	78 14                	js     80184f <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80183b:	83 ec 08             	sub    $0x8,%esp
+  80183e:	68 71 18 80 00       	push   $0x801871
+  801843:	6a 00                	push   $0x0
+  801845:	e8 66 f7 ff ff       	call   800fb0 <sys_env_set_pgfault_upcall>
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	eb ca                	jmp    801819 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  80184f:	83 ec 08             	sub    $0x8,%esp
+  801852:	50                   	push   %eax
+  801853:	68 76 30 80 00       	push   $0x803076
+  801858:	e8 f7 e9 ff ff       	call   800254 <cprintf>
+			panic("set_pgfault_handler error");
+  80185d:	83 c4 0c             	add    $0xc,%esp
+  801860:	68 81 30 80 00       	push   $0x803081
+  801865:	6a 24                	push   $0x24
+  801867:	68 9b 30 80 00       	push   $0x80309b
+  80186c:	e8 08 e9 ff ff       	call   800179 <_panic>
+
+00801871 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801871:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801872:	a1 10 50 80 00       	mov    0x805010,%eax
+	call *%eax
+  801877:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801879:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  80187c:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  801880:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  801883:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  801887:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  801889:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  80188d:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  80188e:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  801892:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  801893:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  801894:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801898:	c3                   	ret
+
+00801899 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801899:	55                   	push   %ebp
+  80189a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80189c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189f:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018a4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018a7:	5d                   	pop    %ebp
+  8018a8:	c3                   	ret
+
+008018a9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018af:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018b4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018b9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018be:	5d                   	pop    %ebp
+  8018bf:	c3                   	ret
+
+008018c0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018c3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018c8:	eb 02                	jmp    8018cc <fd_alloc+0xc>
+  8018ca:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018cc:	89 c2                	mov    %eax,%edx
+  8018ce:	c1 ea 16             	shr    $0x16,%edx
+  8018d1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018d8:	f6 c2 01             	test   $0x1,%dl
+  8018db:	74 2b                	je     801908 <fd_alloc+0x48>
+  8018dd:	89 c2                	mov    %eax,%edx
+  8018df:	c1 ea 0c             	shr    $0xc,%edx
+  8018e2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018e9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018ef:	f6 c1 01             	test   $0x1,%cl
+  8018f2:	74 14                	je     801908 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018f4:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018fa:	75 ce                	jne    8018ca <fd_alloc+0xa>
+  8018fc:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801901:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801906:	eb 05                	jmp    80190d <fd_alloc+0x4d>
+			return 0;
+  801908:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80190d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801910:	89 02                	mov    %eax,(%edx)
+}
+  801912:	89 c8                	mov    %ecx,%eax
+  801914:	5d                   	pop    %ebp
+  801915:	c3                   	ret
+
+00801916 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801916:	55                   	push   %ebp
+  801917:	89 e5                	mov    %esp,%ebp
+  801919:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80191c:	83 f8 1f             	cmp    $0x1f,%eax
+  80191f:	77 30                	ja     801951 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801921:	c1 e0 0c             	shl    $0xc,%eax
+  801924:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801929:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80192f:	f6 c2 01             	test   $0x1,%dl
+  801932:	74 24                	je     801958 <fd_lookup+0x42>
+  801934:	89 c2                	mov    %eax,%edx
+  801936:	c1 ea 0c             	shr    $0xc,%edx
+  801939:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801940:	f6 c2 01             	test   $0x1,%dl
+  801943:	74 1a                	je     80195f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801945:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801948:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80194a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80194f:	5d                   	pop    %ebp
+  801950:	c3                   	ret
+		return -E_INVAL;
+  801951:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801956:	eb f7                	jmp    80194f <fd_lookup+0x39>
+		return -E_INVAL;
+  801958:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80195d:	eb f0                	jmp    80194f <fd_lookup+0x39>
+  80195f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801964:	eb e9                	jmp    80194f <fd_lookup+0x39>
+
+00801966 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801966:	55                   	push   %ebp
+  801967:	89 e5                	mov    %esp,%ebp
+  801969:	53                   	push   %ebx
+  80196a:	83 ec 04             	sub    $0x4,%esp
+  80196d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801970:	b8 00 00 00 00       	mov    $0x0,%eax
+  801975:	eb 03                	jmp    80197a <dev_lookup+0x14>
+  801977:	83 c0 01             	add    $0x1,%eax
+  80197a:	8b 1c 85 28 31 80 00 	mov    0x803128(,%eax,4),%ebx
+  801981:	85 db                	test   %ebx,%ebx
+  801983:	74 0b                	je     801990 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801985:	39 13                	cmp    %edx,(%ebx)
+  801987:	75 ee                	jne    801977 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198e:	eb 2e                	jmp    8019be <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801990:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801992:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801997:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80199d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8019a2:	76 24                	jbe    8019c8 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019a4:	8b 41 48             	mov    0x48(%ecx),%eax
+  8019a7:	83 ec 04             	sub    $0x4,%esp
+  8019aa:	52                   	push   %edx
+  8019ab:	50                   	push   %eax
+  8019ac:	68 ac 30 80 00       	push   $0x8030ac
+  8019b1:	e8 9e e8 ff ff       	call   800254 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019c1:	89 1a                	mov    %ebx,(%edx)
+}
+  8019c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c6:	c9                   	leave
+  8019c7:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8019c8:	c1 e8 10             	shr    $0x10,%eax
+  8019cb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8019d1:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8019d7:	eb cb                	jmp    8019a4 <dev_lookup+0x3e>
+
+008019d9 <fd_close>:
+{
+  8019d9:	55                   	push   %ebp
+  8019da:	89 e5                	mov    %esp,%ebp
+  8019dc:	57                   	push   %edi
+  8019dd:	56                   	push   %esi
+  8019de:	53                   	push   %ebx
+  8019df:	83 ec 24             	sub    $0x24,%esp
+  8019e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019e5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019e8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019eb:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019ec:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019f2:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019f5:	50                   	push   %eax
+  8019f6:	e8 1b ff ff ff       	call   801916 <fd_lookup>
+  8019fb:	89 c3                	mov    %eax,%ebx
+  8019fd:	83 c4 10             	add    $0x10,%esp
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	78 05                	js     801a09 <fd_close+0x30>
+	    || fd != fd2)
+  801a04:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a07:	74 16                	je     801a1f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a09:	89 f8                	mov    %edi,%eax
+  801a0b:	84 c0                	test   %al,%al
+  801a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a12:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a15:	89 d8                	mov    %ebx,%eax
+  801a17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a1a:	5b                   	pop    %ebx
+  801a1b:	5e                   	pop    %esi
+  801a1c:	5f                   	pop    %edi
+  801a1d:	5d                   	pop    %ebp
+  801a1e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a1f:	83 ec 08             	sub    $0x8,%esp
+  801a22:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a25:	50                   	push   %eax
+  801a26:	ff 36                	push   (%esi)
+  801a28:	e8 39 ff ff ff       	call   801966 <dev_lookup>
+  801a2d:	89 c3                	mov    %eax,%ebx
+  801a2f:	83 c4 10             	add    $0x10,%esp
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	78 1a                	js     801a50 <fd_close+0x77>
+		if (dev->dev_close)
+  801a36:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a39:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a41:	85 c0                	test   %eax,%eax
+  801a43:	74 0b                	je     801a50 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a45:	83 ec 0c             	sub    $0xc,%esp
+  801a48:	56                   	push   %esi
+  801a49:	ff d0                	call   *%eax
+  801a4b:	89 c3                	mov    %eax,%ebx
+  801a4d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a50:	83 ec 08             	sub    $0x8,%esp
+  801a53:	56                   	push   %esi
+  801a54:	6a 00                	push   $0x0
+  801a56:	e8 14 f4 ff ff       	call   800e6f <sys_page_unmap>
+	return r;
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	eb b5                	jmp    801a15 <fd_close+0x3c>
+
+00801a60 <close>:
+
+int
+close(int fdnum)
+{
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a69:	50                   	push   %eax
+  801a6a:	ff 75 08             	push   0x8(%ebp)
+  801a6d:	e8 a4 fe ff ff       	call   801916 <fd_lookup>
+  801a72:	83 c4 10             	add    $0x10,%esp
+  801a75:	85 c0                	test   %eax,%eax
+  801a77:	79 02                	jns    801a7b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a79:	c9                   	leave
+  801a7a:	c3                   	ret
+		return fd_close(fd, 1);
+  801a7b:	83 ec 08             	sub    $0x8,%esp
+  801a7e:	6a 01                	push   $0x1
+  801a80:	ff 75 f4             	push   -0xc(%ebp)
+  801a83:	e8 51 ff ff ff       	call   8019d9 <fd_close>
+  801a88:	83 c4 10             	add    $0x10,%esp
+  801a8b:	eb ec                	jmp    801a79 <close+0x19>
+
+00801a8d <close_all>:
+
+void
+close_all(void)
+{
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	53                   	push   %ebx
+  801a91:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a94:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a99:	83 ec 0c             	sub    $0xc,%esp
+  801a9c:	53                   	push   %ebx
+  801a9d:	e8 be ff ff ff       	call   801a60 <close>
+	for (i = 0; i < MAXFD; i++)
+  801aa2:	83 c3 01             	add    $0x1,%ebx
+  801aa5:	83 c4 10             	add    $0x10,%esp
+  801aa8:	83 fb 20             	cmp    $0x20,%ebx
+  801aab:	75 ec                	jne    801a99 <close_all+0xc>
+}
+  801aad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ab0:	c9                   	leave
+  801ab1:	c3                   	ret
+
+00801ab2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	57                   	push   %edi
+  801ab6:	56                   	push   %esi
+  801ab7:	53                   	push   %ebx
+  801ab8:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801abb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801abe:	50                   	push   %eax
+  801abf:	ff 75 08             	push   0x8(%ebp)
+  801ac2:	e8 4f fe ff ff       	call   801916 <fd_lookup>
+  801ac7:	89 c3                	mov    %eax,%ebx
+  801ac9:	83 c4 10             	add    $0x10,%esp
+  801acc:	85 c0                	test   %eax,%eax
+  801ace:	78 7f                	js     801b4f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ad0:	83 ec 0c             	sub    $0xc,%esp
+  801ad3:	ff 75 0c             	push   0xc(%ebp)
+  801ad6:	e8 85 ff ff ff       	call   801a60 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801adb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ade:	c1 e6 0c             	shl    $0xc,%esi
+  801ae1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ae7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801aea:	89 3c 24             	mov    %edi,(%esp)
+  801aed:	e8 b7 fd ff ff       	call   8018a9 <fd2data>
+  801af2:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801af4:	89 34 24             	mov    %esi,(%esp)
+  801af7:	e8 ad fd ff ff       	call   8018a9 <fd2data>
+  801afc:	83 c4 10             	add    $0x10,%esp
+  801aff:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b02:	89 d8                	mov    %ebx,%eax
+  801b04:	c1 e8 16             	shr    $0x16,%eax
+  801b07:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b0e:	a8 01                	test   $0x1,%al
+  801b10:	74 11                	je     801b23 <dup+0x71>
+  801b12:	89 d8                	mov    %ebx,%eax
+  801b14:	c1 e8 0c             	shr    $0xc,%eax
+  801b17:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b1e:	f6 c2 01             	test   $0x1,%dl
+  801b21:	75 36                	jne    801b59 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b23:	89 f8                	mov    %edi,%eax
+  801b25:	c1 e8 0c             	shr    $0xc,%eax
+  801b28:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b2f:	83 ec 0c             	sub    $0xc,%esp
+  801b32:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b37:	50                   	push   %eax
+  801b38:	56                   	push   %esi
+  801b39:	6a 00                	push   $0x0
+  801b3b:	57                   	push   %edi
+  801b3c:	6a 00                	push   $0x0
+  801b3e:	e8 be f2 ff ff       	call   800e01 <sys_page_map>
+  801b43:	89 c3                	mov    %eax,%ebx
+  801b45:	83 c4 20             	add    $0x20,%esp
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	78 33                	js     801b7f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b4f:	89 d8                	mov    %ebx,%eax
+  801b51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b54:	5b                   	pop    %ebx
+  801b55:	5e                   	pop    %esi
+  801b56:	5f                   	pop    %edi
+  801b57:	5d                   	pop    %ebp
+  801b58:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b59:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b60:	83 ec 0c             	sub    $0xc,%esp
+  801b63:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b68:	50                   	push   %eax
+  801b69:	ff 75 d4             	push   -0x2c(%ebp)
+  801b6c:	6a 00                	push   $0x0
+  801b6e:	53                   	push   %ebx
+  801b6f:	6a 00                	push   $0x0
+  801b71:	e8 8b f2 ff ff       	call   800e01 <sys_page_map>
+  801b76:	89 c3                	mov    %eax,%ebx
+  801b78:	83 c4 20             	add    $0x20,%esp
+  801b7b:	85 c0                	test   %eax,%eax
+  801b7d:	79 a4                	jns    801b23 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b7f:	83 ec 08             	sub    $0x8,%esp
+  801b82:	56                   	push   %esi
+  801b83:	6a 00                	push   $0x0
+  801b85:	e8 e5 f2 ff ff       	call   800e6f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b8a:	83 c4 08             	add    $0x8,%esp
+  801b8d:	ff 75 d4             	push   -0x2c(%ebp)
+  801b90:	6a 00                	push   $0x0
+  801b92:	e8 d8 f2 ff ff       	call   800e6f <sys_page_unmap>
+	return r;
+  801b97:	83 c4 10             	add    $0x10,%esp
+  801b9a:	eb b3                	jmp    801b4f <dup+0x9d>
+
+00801b9c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b9c:	55                   	push   %ebp
+  801b9d:	89 e5                	mov    %esp,%ebp
+  801b9f:	56                   	push   %esi
+  801ba0:	53                   	push   %ebx
+  801ba1:	83 ec 18             	sub    $0x18,%esp
+  801ba4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ba7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801baa:	50                   	push   %eax
+  801bab:	53                   	push   %ebx
+  801bac:	e8 65 fd ff ff       	call   801916 <fd_lookup>
+  801bb1:	83 c4 10             	add    $0x10,%esp
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	78 3c                	js     801bf4 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bb8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bbb:	83 ec 08             	sub    $0x8,%esp
+  801bbe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bc1:	50                   	push   %eax
+  801bc2:	ff 36                	push   (%esi)
+  801bc4:	e8 9d fd ff ff       	call   801966 <dev_lookup>
+  801bc9:	83 c4 10             	add    $0x10,%esp
+  801bcc:	85 c0                	test   %eax,%eax
+  801bce:	78 24                	js     801bf4 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bd0:	8b 46 08             	mov    0x8(%esi),%eax
+  801bd3:	83 e0 03             	and    $0x3,%eax
+  801bd6:	83 f8 01             	cmp    $0x1,%eax
+  801bd9:	74 20                	je     801bfb <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801bdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bde:	8b 40 08             	mov    0x8(%eax),%eax
+  801be1:	85 c0                	test   %eax,%eax
+  801be3:	74 57                	je     801c3c <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801be5:	83 ec 04             	sub    $0x4,%esp
+  801be8:	ff 75 10             	push   0x10(%ebp)
+  801beb:	ff 75 0c             	push   0xc(%ebp)
+  801bee:	56                   	push   %esi
+  801bef:	ff d0                	call   *%eax
+  801bf1:	83 c4 10             	add    $0x10,%esp
+}
+  801bf4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf7:	5b                   	pop    %ebx
+  801bf8:	5e                   	pop    %esi
+  801bf9:	5d                   	pop    %ebp
+  801bfa:	c3                   	ret
+  801bfb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bfd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c02:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c08:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c0d:	76 1c                	jbe    801c2b <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c0f:	8b 42 48             	mov    0x48(%edx),%eax
+  801c12:	83 ec 04             	sub    $0x4,%esp
+  801c15:	53                   	push   %ebx
+  801c16:	50                   	push   %eax
+  801c17:	68 ed 30 80 00       	push   $0x8030ed
+  801c1c:	e8 33 e6 ff ff       	call   800254 <cprintf>
+		return -E_INVAL;
+  801c21:	83 c4 10             	add    $0x10,%esp
+  801c24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c29:	eb c9                	jmp    801bf4 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c2b:	c1 e8 10             	shr    $0x10,%eax
+  801c2e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c34:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c3a:	eb d3                	jmp    801c0f <read+0x73>
+		return -E_NOT_SUPP;
+  801c3c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c41:	eb b1                	jmp    801bf4 <read+0x58>
+
+00801c43 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c43:	55                   	push   %ebp
+  801c44:	89 e5                	mov    %esp,%ebp
+  801c46:	57                   	push   %edi
+  801c47:	56                   	push   %esi
+  801c48:	53                   	push   %ebx
+  801c49:	83 ec 0c             	sub    $0xc,%esp
+  801c4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c4f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c57:	eb 02                	jmp    801c5b <readn+0x18>
+  801c59:	01 c3                	add    %eax,%ebx
+  801c5b:	39 f3                	cmp    %esi,%ebx
+  801c5d:	73 21                	jae    801c80 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c5f:	83 ec 04             	sub    $0x4,%esp
+  801c62:	89 f0                	mov    %esi,%eax
+  801c64:	29 d8                	sub    %ebx,%eax
+  801c66:	50                   	push   %eax
+  801c67:	89 d8                	mov    %ebx,%eax
+  801c69:	03 45 0c             	add    0xc(%ebp),%eax
+  801c6c:	50                   	push   %eax
+  801c6d:	57                   	push   %edi
+  801c6e:	e8 29 ff ff ff       	call   801b9c <read>
+		if (m < 0)
+  801c73:	83 c4 10             	add    $0x10,%esp
+  801c76:	85 c0                	test   %eax,%eax
+  801c78:	78 04                	js     801c7e <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c7a:	75 dd                	jne    801c59 <readn+0x16>
+  801c7c:	eb 02                	jmp    801c80 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c7e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c80:	89 d8                	mov    %ebx,%eax
+  801c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c85:	5b                   	pop    %ebx
+  801c86:	5e                   	pop    %esi
+  801c87:	5f                   	pop    %edi
+  801c88:	5d                   	pop    %ebp
+  801c89:	c3                   	ret
+
+00801c8a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c8a:	55                   	push   %ebp
+  801c8b:	89 e5                	mov    %esp,%ebp
+  801c8d:	56                   	push   %esi
+  801c8e:	53                   	push   %ebx
+  801c8f:	83 ec 18             	sub    $0x18,%esp
+  801c92:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c95:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c98:	50                   	push   %eax
+  801c99:	53                   	push   %ebx
+  801c9a:	e8 77 fc ff ff       	call   801916 <fd_lookup>
+  801c9f:	83 c4 10             	add    $0x10,%esp
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	78 37                	js     801cdd <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ca6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ca9:	83 ec 08             	sub    $0x8,%esp
+  801cac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801caf:	50                   	push   %eax
+  801cb0:	ff 36                	push   (%esi)
+  801cb2:	e8 af fc ff ff       	call   801966 <dev_lookup>
+  801cb7:	83 c4 10             	add    $0x10,%esp
+  801cba:	85 c0                	test   %eax,%eax
+  801cbc:	78 1f                	js     801cdd <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cbe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cc2:	74 20                	je     801ce4 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cc7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	74 57                	je     801d25 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801cce:	83 ec 04             	sub    $0x4,%esp
+  801cd1:	ff 75 10             	push   0x10(%ebp)
+  801cd4:	ff 75 0c             	push   0xc(%ebp)
+  801cd7:	56                   	push   %esi
+  801cd8:	ff d0                	call   *%eax
+  801cda:	83 c4 10             	add    $0x10,%esp
+}
+  801cdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce0:	5b                   	pop    %ebx
+  801ce1:	5e                   	pop    %esi
+  801ce2:	5d                   	pop    %ebp
+  801ce3:	c3                   	ret
+  801ce4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ce6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ceb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cf1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cf6:	76 1c                	jbe    801d14 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cf8:	8b 42 48             	mov    0x48(%edx),%eax
+  801cfb:	83 ec 04             	sub    $0x4,%esp
+  801cfe:	53                   	push   %ebx
+  801cff:	50                   	push   %eax
+  801d00:	68 09 31 80 00       	push   $0x803109
+  801d05:	e8 4a e5 ff ff       	call   800254 <cprintf>
+		return -E_INVAL;
+  801d0a:	83 c4 10             	add    $0x10,%esp
+  801d0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d12:	eb c9                	jmp    801cdd <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d14:	c1 e8 10             	shr    $0x10,%eax
+  801d17:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d1d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d23:	eb d3                	jmp    801cf8 <write+0x6e>
+		return -E_NOT_SUPP;
+  801d25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d2a:	eb b1                	jmp    801cdd <write+0x53>
+
+00801d2c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d2c:	55                   	push   %ebp
+  801d2d:	89 e5                	mov    %esp,%ebp
+  801d2f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d35:	50                   	push   %eax
+  801d36:	ff 75 08             	push   0x8(%ebp)
+  801d39:	e8 d8 fb ff ff       	call   801916 <fd_lookup>
+  801d3e:	83 c4 10             	add    $0x10,%esp
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	78 0e                	js     801d53 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d4b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d53:	c9                   	leave
+  801d54:	c3                   	ret
+
+00801d55 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d55:	55                   	push   %ebp
+  801d56:	89 e5                	mov    %esp,%ebp
+  801d58:	56                   	push   %esi
+  801d59:	53                   	push   %ebx
+  801d5a:	83 ec 18             	sub    $0x18,%esp
+  801d5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d60:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d63:	50                   	push   %eax
+  801d64:	53                   	push   %ebx
+  801d65:	e8 ac fb ff ff       	call   801916 <fd_lookup>
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	78 34                	js     801da5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d71:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d74:	83 ec 08             	sub    $0x8,%esp
+  801d77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d7a:	50                   	push   %eax
+  801d7b:	ff 36                	push   (%esi)
+  801d7d:	e8 e4 fb ff ff       	call   801966 <dev_lookup>
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	78 1c                	js     801da5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d89:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d8d:	74 1d                	je     801dac <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d92:	8b 40 18             	mov    0x18(%eax),%eax
+  801d95:	85 c0                	test   %eax,%eax
+  801d97:	74 54                	je     801ded <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d99:	83 ec 08             	sub    $0x8,%esp
+  801d9c:	ff 75 0c             	push   0xc(%ebp)
+  801d9f:	56                   	push   %esi
+  801da0:	ff d0                	call   *%eax
+  801da2:	83 c4 10             	add    $0x10,%esp
+}
+  801da5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da8:	5b                   	pop    %ebx
+  801da9:	5e                   	pop    %esi
+  801daa:	5d                   	pop    %ebp
+  801dab:	c3                   	ret
+  801dac:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dae:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801db3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801db9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801dbe:	76 1c                	jbe    801ddc <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801dc0:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dc3:	83 ec 04             	sub    $0x4,%esp
+  801dc6:	53                   	push   %ebx
+  801dc7:	50                   	push   %eax
+  801dc8:	68 cc 30 80 00       	push   $0x8030cc
+  801dcd:	e8 82 e4 ff ff       	call   800254 <cprintf>
+		return -E_INVAL;
+  801dd2:	83 c4 10             	add    $0x10,%esp
+  801dd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dda:	eb c9                	jmp    801da5 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ddc:	c1 e8 10             	shr    $0x10,%eax
+  801ddf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801de5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801deb:	eb d3                	jmp    801dc0 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801ded:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801df2:	eb b1                	jmp    801da5 <ftruncate+0x50>
+
+00801df4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801df4:	55                   	push   %ebp
+  801df5:	89 e5                	mov    %esp,%ebp
+  801df7:	56                   	push   %esi
+  801df8:	53                   	push   %ebx
+  801df9:	83 ec 18             	sub    $0x18,%esp
+  801dfc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e02:	50                   	push   %eax
+  801e03:	ff 75 08             	push   0x8(%ebp)
+  801e06:	e8 0b fb ff ff       	call   801916 <fd_lookup>
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 49                	js     801e5b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e12:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e15:	83 ec 08             	sub    $0x8,%esp
+  801e18:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e1b:	50                   	push   %eax
+  801e1c:	ff 36                	push   (%esi)
+  801e1e:	e8 43 fb ff ff       	call   801966 <dev_lookup>
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 31                	js     801e5b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e2d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e31:	74 2f                	je     801e62 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e33:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e36:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e3d:	00 00 00 
+	stat->st_isdir = 0;
+  801e40:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e47:	00 00 00 
+	stat->st_dev = dev;
+  801e4a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e50:	83 ec 08             	sub    $0x8,%esp
+  801e53:	53                   	push   %ebx
+  801e54:	56                   	push   %esi
+  801e55:	ff 50 14             	call   *0x14(%eax)
+  801e58:	83 c4 10             	add    $0x10,%esp
+}
+  801e5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e5e:	5b                   	pop    %ebx
+  801e5f:	5e                   	pop    %esi
+  801e60:	5d                   	pop    %ebp
+  801e61:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e67:	eb f2                	jmp    801e5b <fstat+0x67>
+
+00801e69 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e69:	55                   	push   %ebp
+  801e6a:	89 e5                	mov    %esp,%ebp
+  801e6c:	56                   	push   %esi
+  801e6d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e6e:	83 ec 08             	sub    $0x8,%esp
+  801e71:	6a 00                	push   $0x0
+  801e73:	ff 75 08             	push   0x8(%ebp)
+  801e76:	e8 e4 01 00 00       	call   80205f <open>
+  801e7b:	89 c3                	mov    %eax,%ebx
+  801e7d:	83 c4 10             	add    $0x10,%esp
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	78 1b                	js     801e9f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	ff 75 0c             	push   0xc(%ebp)
+  801e8a:	50                   	push   %eax
+  801e8b:	e8 64 ff ff ff       	call   801df4 <fstat>
+  801e90:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e92:	89 1c 24             	mov    %ebx,(%esp)
+  801e95:	e8 c6 fb ff ff       	call   801a60 <close>
+	return r;
+  801e9a:	83 c4 10             	add    $0x10,%esp
+  801e9d:	89 f3                	mov    %esi,%ebx
+}
+  801e9f:	89 d8                	mov    %ebx,%eax
+  801ea1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea4:	5b                   	pop    %ebx
+  801ea5:	5e                   	pop    %esi
+  801ea6:	5d                   	pop    %ebp
+  801ea7:	c3                   	ret
+
+00801ea8 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ea8:	55                   	push   %ebp
+  801ea9:	89 e5                	mov    %esp,%ebp
+  801eab:	56                   	push   %esi
+  801eac:	53                   	push   %ebx
+  801ead:	89 c6                	mov    %eax,%esi
+  801eaf:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801eb1:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801eb8:	74 27                	je     801ee1 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801eba:	6a 07                	push   $0x7
+  801ebc:	68 00 60 80 00       	push   $0x806000
+  801ec1:	56                   	push   %esi
+  801ec2:	ff 35 00 50 80 00    	push   0x805000
+  801ec8:	e8 b2 0c 00 00       	call   802b7f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ecd:	83 c4 0c             	add    $0xc,%esp
+  801ed0:	6a 00                	push   $0x0
+  801ed2:	53                   	push   %ebx
+  801ed3:	6a 00                	push   $0x0
+  801ed5:	e8 8d 0c 00 00       	call   802b67 <ipc_recv>
+}
+  801eda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edd:	5b                   	pop    %ebx
+  801ede:	5e                   	pop    %esi
+  801edf:	5d                   	pop    %ebp
+  801ee0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ee1:	83 ec 0c             	sub    $0xc,%esp
+  801ee4:	6a 01                	push   $0x1
+  801ee6:	e8 e8 0c 00 00       	call   802bd3 <ipc_find_env>
+  801eeb:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ef0:	83 c4 10             	add    $0x10,%esp
+  801ef3:	eb c5                	jmp    801eba <fsipc+0x12>
+
+00801ef5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ef5:	55                   	push   %ebp
+  801ef6:	89 e5                	mov    %esp,%ebp
+  801ef8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801efb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f01:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801f06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f09:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f13:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f18:	e8 8b ff ff ff       	call   801ea8 <fsipc>
+}
+  801f1d:	c9                   	leave
+  801f1e:	c3                   	ret
+
+00801f1f <devfile_flush>:
+{
+  801f1f:	55                   	push   %ebp
+  801f20:	89 e5                	mov    %esp,%ebp
+  801f22:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f28:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f2b:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f30:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f35:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f3a:	e8 69 ff ff ff       	call   801ea8 <fsipc>
+}
+  801f3f:	c9                   	leave
+  801f40:	c3                   	ret
+
+00801f41 <devfile_stat>:
+{
+  801f41:	55                   	push   %ebp
+  801f42:	89 e5                	mov    %esp,%ebp
+  801f44:	53                   	push   %ebx
+  801f45:	83 ec 04             	sub    $0x4,%esp
+  801f48:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f51:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f60:	e8 43 ff ff ff       	call   801ea8 <fsipc>
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	78 2c                	js     801f95 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f69:	83 ec 08             	sub    $0x8,%esp
+  801f6c:	68 00 60 80 00       	push   $0x806000
+  801f71:	53                   	push   %ebx
+  801f72:	e8 25 e9 ff ff       	call   80089c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f77:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f7c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f82:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f87:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f8d:	83 c4 10             	add    $0x10,%esp
+  801f90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f98:	c9                   	leave
+  801f99:	c3                   	ret
+
+00801f9a <devfile_write>:
+{
+  801f9a:	55                   	push   %ebp
+  801f9b:	89 e5                	mov    %esp,%ebp
+  801f9d:	83 ec 0c             	sub    $0xc,%esp
+  801fa0:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa6:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fa9:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801faf:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801fb4:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fb9:	39 d0                	cmp    %edx,%eax
+  801fbb:	0f 47 c2             	cmova  %edx,%eax
+  801fbe:	50                   	push   %eax
+  801fbf:	ff 75 0c             	push   0xc(%ebp)
+  801fc2:	68 08 60 80 00       	push   $0x806008
+  801fc7:	e8 56 ea ff ff       	call   800a22 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801fcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fd6:	e8 cd fe ff ff       	call   801ea8 <fsipc>
+}
+  801fdb:	c9                   	leave
+  801fdc:	c3                   	ret
+
+00801fdd <devfile_read>:
+{
+  801fdd:	55                   	push   %ebp
+  801fde:	89 e5                	mov    %esp,%ebp
+  801fe0:	56                   	push   %esi
+  801fe1:	53                   	push   %ebx
+  801fe2:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fe5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801feb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ff0:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffb:	b8 03 00 00 00       	mov    $0x3,%eax
+  802000:	e8 a3 fe ff ff       	call   801ea8 <fsipc>
+  802005:	89 c3                	mov    %eax,%ebx
+  802007:	85 c0                	test   %eax,%eax
+  802009:	78 1f                	js     80202a <devfile_read+0x4d>
+	assert(r <= n);
+  80200b:	39 c6                	cmp    %eax,%esi
+  80200d:	72 24                	jb     802033 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80200f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802014:	7f 33                	jg     802049 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802016:	83 ec 04             	sub    $0x4,%esp
+  802019:	50                   	push   %eax
+  80201a:	68 00 60 80 00       	push   $0x806000
+  80201f:	ff 75 0c             	push   0xc(%ebp)
+  802022:	e8 fb e9 ff ff       	call   800a22 <memmove>
+	return r;
+  802027:	83 c4 10             	add    $0x10,%esp
+}
+  80202a:	89 d8                	mov    %ebx,%eax
+  80202c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202f:	5b                   	pop    %ebx
+  802030:	5e                   	pop    %esi
+  802031:	5d                   	pop    %ebp
+  802032:	c3                   	ret
+	assert(r <= n);
+  802033:	68 3c 31 80 00       	push   $0x80313c
+  802038:	68 43 31 80 00       	push   $0x803143
+  80203d:	6a 76                	push   $0x76
+  80203f:	68 58 31 80 00       	push   $0x803158
+  802044:	e8 30 e1 ff ff       	call   800179 <_panic>
+	assert(r <= PGSIZE);
+  802049:	68 63 31 80 00       	push   $0x803163
+  80204e:	68 43 31 80 00       	push   $0x803143
+  802053:	6a 77                	push   $0x77
+  802055:	68 58 31 80 00       	push   $0x803158
+  80205a:	e8 1a e1 ff ff       	call   800179 <_panic>
+
+0080205f <open>:
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	83 ec 1c             	sub    $0x1c,%esp
+  802067:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80206a:	56                   	push   %esi
+  80206b:	e8 f1 e7 ff ff       	call   800861 <strlen>
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802078:	7f 6c                	jg     8020e6 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+  80207d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802080:	50                   	push   %eax
+  802081:	e8 3a f8 ff ff       	call   8018c0 <fd_alloc>
+  802086:	89 c3                	mov    %eax,%ebx
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	85 c0                	test   %eax,%eax
+  80208d:	78 3c                	js     8020cb <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80208f:	83 ec 08             	sub    $0x8,%esp
+  802092:	56                   	push   %esi
+  802093:	68 00 60 80 00       	push   $0x806000
+  802098:	e8 ff e7 ff ff       	call   80089c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80209d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a0:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020ad:	e8 f6 fd ff ff       	call   801ea8 <fsipc>
+  8020b2:	89 c3                	mov    %eax,%ebx
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	78 19                	js     8020d4 <open+0x75>
+	return fd2num(fd);
+  8020bb:	83 ec 0c             	sub    $0xc,%esp
+  8020be:	ff 75 f4             	push   -0xc(%ebp)
+  8020c1:	e8 d3 f7 ff ff       	call   801899 <fd2num>
+  8020c6:	89 c3                	mov    %eax,%ebx
+  8020c8:	83 c4 10             	add    $0x10,%esp
+}
+  8020cb:	89 d8                	mov    %ebx,%eax
+  8020cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d0:	5b                   	pop    %ebx
+  8020d1:	5e                   	pop    %esi
+  8020d2:	5d                   	pop    %ebp
+  8020d3:	c3                   	ret
+		fd_close(fd, 0);
+  8020d4:	83 ec 08             	sub    $0x8,%esp
+  8020d7:	6a 00                	push   $0x0
+  8020d9:	ff 75 f4             	push   -0xc(%ebp)
+  8020dc:	e8 f8 f8 ff ff       	call   8019d9 <fd_close>
+		return r;
+  8020e1:	83 c4 10             	add    $0x10,%esp
+  8020e4:	eb e5                	jmp    8020cb <open+0x6c>
+		return -E_BAD_PATH;
+  8020e6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020eb:	eb de                	jmp    8020cb <open+0x6c>
+
+008020ed <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020ed:	55                   	push   %ebp
+  8020ee:	89 e5                	mov    %esp,%ebp
+  8020f0:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020fd:	e8 a6 fd ff ff       	call   801ea8 <fsipc>
+}
+  802102:	c9                   	leave
+  802103:	c3                   	ret
+
+00802104 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80210a:	68 6f 31 80 00       	push   $0x80316f
+  80210f:	ff 75 0c             	push   0xc(%ebp)
+  802112:	e8 85 e7 ff ff       	call   80089c <strcpy>
+	return 0;
+}
+  802117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211c:	c9                   	leave
+  80211d:	c3                   	ret
+
+0080211e <devsock_close>:
+{
+  80211e:	55                   	push   %ebp
+  80211f:	89 e5                	mov    %esp,%ebp
+  802121:	53                   	push   %ebx
+  802122:	83 ec 10             	sub    $0x10,%esp
+  802125:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802128:	53                   	push   %ebx
+  802129:	e8 e4 0a 00 00       	call   802c12 <pageref>
+  80212e:	89 c2                	mov    %eax,%edx
+  802130:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802133:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802138:	83 fa 01             	cmp    $0x1,%edx
+  80213b:	74 05                	je     802142 <devsock_close+0x24>
+}
+  80213d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802140:	c9                   	leave
+  802141:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802142:	83 ec 0c             	sub    $0xc,%esp
+  802145:	ff 73 0c             	push   0xc(%ebx)
+  802148:	e8 b7 02 00 00       	call   802404 <nsipc_close>
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	eb eb                	jmp    80213d <devsock_close+0x1f>
+
+00802152 <devsock_write>:
+{
+  802152:	55                   	push   %ebp
+  802153:	89 e5                	mov    %esp,%ebp
+  802155:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802158:	6a 00                	push   $0x0
+  80215a:	ff 75 10             	push   0x10(%ebp)
+  80215d:	ff 75 0c             	push   0xc(%ebp)
+  802160:	8b 45 08             	mov    0x8(%ebp),%eax
+  802163:	ff 70 0c             	push   0xc(%eax)
+  802166:	e8 79 03 00 00       	call   8024e4 <nsipc_send>
+}
+  80216b:	c9                   	leave
+  80216c:	c3                   	ret
+
+0080216d <devsock_read>:
+{
+  80216d:	55                   	push   %ebp
+  80216e:	89 e5                	mov    %esp,%ebp
+  802170:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802173:	6a 00                	push   $0x0
+  802175:	ff 75 10             	push   0x10(%ebp)
+  802178:	ff 75 0c             	push   0xc(%ebp)
+  80217b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217e:	ff 70 0c             	push   0xc(%eax)
+  802181:	e8 ef 02 00 00       	call   802475 <nsipc_recv>
+}
+  802186:	c9                   	leave
+  802187:	c3                   	ret
+
+00802188 <fd2sockid>:
+{
+  802188:	55                   	push   %ebp
+  802189:	89 e5                	mov    %esp,%ebp
+  80218b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80218e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802191:	52                   	push   %edx
+  802192:	50                   	push   %eax
+  802193:	e8 7e f7 ff ff       	call   801916 <fd_lookup>
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	78 10                	js     8021af <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80219f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a2:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8021a8:	39 08                	cmp    %ecx,(%eax)
+  8021aa:	75 05                	jne    8021b1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8021ac:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8021af:	c9                   	leave
+  8021b0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021b1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021b6:	eb f7                	jmp    8021af <fd2sockid+0x27>
+
+008021b8 <alloc_sockfd>:
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	56                   	push   %esi
+  8021bc:	53                   	push   %ebx
+  8021bd:	83 ec 1c             	sub    $0x1c,%esp
+  8021c0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8021c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c5:	50                   	push   %eax
+  8021c6:	e8 f5 f6 ff ff       	call   8018c0 <fd_alloc>
+  8021cb:	89 c3                	mov    %eax,%ebx
+  8021cd:	83 c4 10             	add    $0x10,%esp
+  8021d0:	85 c0                	test   %eax,%eax
+  8021d2:	78 43                	js     802217 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8021d4:	83 ec 04             	sub    $0x4,%esp
+  8021d7:	68 07 04 00 00       	push   $0x407
+  8021dc:	ff 75 f4             	push   -0xc(%ebp)
+  8021df:	6a 00                	push   $0x0
+  8021e1:	e8 ae eb ff ff       	call   800d94 <sys_page_alloc>
+  8021e6:	89 c3                	mov    %eax,%ebx
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	78 28                	js     802217 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8021ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021f2:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8021f8:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8021fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802204:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802207:	83 ec 0c             	sub    $0xc,%esp
+  80220a:	50                   	push   %eax
+  80220b:	e8 89 f6 ff ff       	call   801899 <fd2num>
+  802210:	89 c3                	mov    %eax,%ebx
+  802212:	83 c4 10             	add    $0x10,%esp
+  802215:	eb 0c                	jmp    802223 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802217:	83 ec 0c             	sub    $0xc,%esp
+  80221a:	56                   	push   %esi
+  80221b:	e8 e4 01 00 00       	call   802404 <nsipc_close>
+		return r;
+  802220:	83 c4 10             	add    $0x10,%esp
+}
+  802223:	89 d8                	mov    %ebx,%eax
+  802225:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802228:	5b                   	pop    %ebx
+  802229:	5e                   	pop    %esi
+  80222a:	5d                   	pop    %ebp
+  80222b:	c3                   	ret
+
+0080222c <accept>:
+{
+  80222c:	55                   	push   %ebp
+  80222d:	89 e5                	mov    %esp,%ebp
+  80222f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802232:	8b 45 08             	mov    0x8(%ebp),%eax
+  802235:	e8 4e ff ff ff       	call   802188 <fd2sockid>
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	78 1b                	js     802259 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80223e:	83 ec 04             	sub    $0x4,%esp
+  802241:	ff 75 10             	push   0x10(%ebp)
+  802244:	ff 75 0c             	push   0xc(%ebp)
+  802247:	50                   	push   %eax
+  802248:	e8 0e 01 00 00       	call   80235b <nsipc_accept>
+  80224d:	83 c4 10             	add    $0x10,%esp
+  802250:	85 c0                	test   %eax,%eax
+  802252:	78 05                	js     802259 <accept+0x2d>
+	return alloc_sockfd(r);
+  802254:	e8 5f ff ff ff       	call   8021b8 <alloc_sockfd>
+}
+  802259:	c9                   	leave
+  80225a:	c3                   	ret
+
+0080225b <bind>:
+{
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802261:	8b 45 08             	mov    0x8(%ebp),%eax
+  802264:	e8 1f ff ff ff       	call   802188 <fd2sockid>
+  802269:	85 c0                	test   %eax,%eax
+  80226b:	78 12                	js     80227f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80226d:	83 ec 04             	sub    $0x4,%esp
+  802270:	ff 75 10             	push   0x10(%ebp)
+  802273:	ff 75 0c             	push   0xc(%ebp)
+  802276:	50                   	push   %eax
+  802277:	e8 31 01 00 00       	call   8023ad <nsipc_bind>
+  80227c:	83 c4 10             	add    $0x10,%esp
+}
+  80227f:	c9                   	leave
+  802280:	c3                   	ret
+
+00802281 <shutdown>:
+{
+  802281:	55                   	push   %ebp
+  802282:	89 e5                	mov    %esp,%ebp
+  802284:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802287:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228a:	e8 f9 fe ff ff       	call   802188 <fd2sockid>
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 0f                	js     8022a2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802293:	83 ec 08             	sub    $0x8,%esp
+  802296:	ff 75 0c             	push   0xc(%ebp)
+  802299:	50                   	push   %eax
+  80229a:	e8 43 01 00 00       	call   8023e2 <nsipc_shutdown>
+  80229f:	83 c4 10             	add    $0x10,%esp
+}
+  8022a2:	c9                   	leave
+  8022a3:	c3                   	ret
+
+008022a4 <connect>:
+{
+  8022a4:	55                   	push   %ebp
+  8022a5:	89 e5                	mov    %esp,%ebp
+  8022a7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ad:	e8 d6 fe ff ff       	call   802188 <fd2sockid>
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 12                	js     8022c8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8022b6:	83 ec 04             	sub    $0x4,%esp
+  8022b9:	ff 75 10             	push   0x10(%ebp)
+  8022bc:	ff 75 0c             	push   0xc(%ebp)
+  8022bf:	50                   	push   %eax
+  8022c0:	e8 59 01 00 00       	call   80241e <nsipc_connect>
+  8022c5:	83 c4 10             	add    $0x10,%esp
+}
+  8022c8:	c9                   	leave
+  8022c9:	c3                   	ret
+
+008022ca <listen>:
+{
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d3:	e8 b0 fe ff ff       	call   802188 <fd2sockid>
+  8022d8:	85 c0                	test   %eax,%eax
+  8022da:	78 0f                	js     8022eb <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8022dc:	83 ec 08             	sub    $0x8,%esp
+  8022df:	ff 75 0c             	push   0xc(%ebp)
+  8022e2:	50                   	push   %eax
+  8022e3:	e8 6b 01 00 00       	call   802453 <nsipc_listen>
+  8022e8:	83 c4 10             	add    $0x10,%esp
+}
+  8022eb:	c9                   	leave
+  8022ec:	c3                   	ret
+
+008022ed <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8022ed:	55                   	push   %ebp
+  8022ee:	89 e5                	mov    %esp,%ebp
+  8022f0:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8022f3:	ff 75 10             	push   0x10(%ebp)
+  8022f6:	ff 75 0c             	push   0xc(%ebp)
+  8022f9:	ff 75 08             	push   0x8(%ebp)
+  8022fc:	e8 41 02 00 00       	call   802542 <nsipc_socket>
+  802301:	83 c4 10             	add    $0x10,%esp
+  802304:	85 c0                	test   %eax,%eax
+  802306:	78 05                	js     80230d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802308:	e8 ab fe ff ff       	call   8021b8 <alloc_sockfd>
+}
+  80230d:	c9                   	leave
+  80230e:	c3                   	ret
+
+0080230f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80230f:	55                   	push   %ebp
+  802310:	89 e5                	mov    %esp,%ebp
+  802312:	53                   	push   %ebx
+  802313:	83 ec 04             	sub    $0x4,%esp
+  802316:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802318:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80231f:	74 26                	je     802347 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802321:	6a 07                	push   $0x7
+  802323:	68 00 70 80 00       	push   $0x807000
+  802328:	53                   	push   %ebx
+  802329:	ff 35 04 50 80 00    	push   0x805004
+  80232f:	e8 4b 08 00 00       	call   802b7f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802334:	83 c4 0c             	add    $0xc,%esp
+  802337:	6a 00                	push   $0x0
+  802339:	6a 00                	push   $0x0
+  80233b:	6a 00                	push   $0x0
+  80233d:	e8 25 08 00 00       	call   802b67 <ipc_recv>
+}
+  802342:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802345:	c9                   	leave
+  802346:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802347:	83 ec 0c             	sub    $0xc,%esp
+  80234a:	6a 02                	push   $0x2
+  80234c:	e8 82 08 00 00       	call   802bd3 <ipc_find_env>
+  802351:	a3 04 50 80 00       	mov    %eax,0x805004
+  802356:	83 c4 10             	add    $0x10,%esp
+  802359:	eb c6                	jmp    802321 <nsipc+0x12>
+
+0080235b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80235b:	55                   	push   %ebp
+  80235c:	89 e5                	mov    %esp,%ebp
+  80235e:	56                   	push   %esi
+  80235f:	53                   	push   %ebx
+  802360:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802363:	8b 45 08             	mov    0x8(%ebp),%eax
+  802366:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80236b:	8b 06                	mov    (%esi),%eax
+  80236d:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802372:	b8 01 00 00 00       	mov    $0x1,%eax
+  802377:	e8 93 ff ff ff       	call   80230f <nsipc>
+  80237c:	89 c3                	mov    %eax,%ebx
+  80237e:	85 c0                	test   %eax,%eax
+  802380:	79 09                	jns    80238b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802382:	89 d8                	mov    %ebx,%eax
+  802384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802387:	5b                   	pop    %ebx
+  802388:	5e                   	pop    %esi
+  802389:	5d                   	pop    %ebp
+  80238a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80238b:	83 ec 04             	sub    $0x4,%esp
+  80238e:	ff 35 10 70 80 00    	push   0x807010
+  802394:	68 00 70 80 00       	push   $0x807000
+  802399:	ff 75 0c             	push   0xc(%ebp)
+  80239c:	e8 81 e6 ff ff       	call   800a22 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8023a1:	a1 10 70 80 00       	mov    0x807010,%eax
+  8023a6:	89 06                	mov    %eax,(%esi)
+  8023a8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8023ab:	eb d5                	jmp    802382 <nsipc_accept+0x27>
+
+008023ad <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	53                   	push   %ebx
+  8023b1:	83 ec 08             	sub    $0x8,%esp
+  8023b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8023b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ba:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8023bf:	53                   	push   %ebx
+  8023c0:	ff 75 0c             	push   0xc(%ebp)
+  8023c3:	68 04 70 80 00       	push   $0x807004
+  8023c8:	e8 55 e6 ff ff       	call   800a22 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8023cd:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8023d3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023d8:	e8 32 ff ff ff       	call   80230f <nsipc>
+}
+  8023dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e0:	c9                   	leave
+  8023e1:	c3                   	ret
+
+008023e2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8023e2:	55                   	push   %ebp
+  8023e3:	89 e5                	mov    %esp,%ebp
+  8023e5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8023e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023eb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8023f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023f3:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8023f8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023fd:	e8 0d ff ff ff       	call   80230f <nsipc>
+}
+  802402:	c9                   	leave
+  802403:	c3                   	ret
+
+00802404 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802404:	55                   	push   %ebp
+  802405:	89 e5                	mov    %esp,%ebp
+  802407:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80240a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802412:	b8 04 00 00 00       	mov    $0x4,%eax
+  802417:	e8 f3 fe ff ff       	call   80230f <nsipc>
+}
+  80241c:	c9                   	leave
+  80241d:	c3                   	ret
+
+0080241e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80241e:	55                   	push   %ebp
+  80241f:	89 e5                	mov    %esp,%ebp
+  802421:	53                   	push   %ebx
+  802422:	83 ec 08             	sub    $0x8,%esp
+  802425:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802428:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242b:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802430:	53                   	push   %ebx
+  802431:	ff 75 0c             	push   0xc(%ebp)
+  802434:	68 04 70 80 00       	push   $0x807004
+  802439:	e8 e4 e5 ff ff       	call   800a22 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80243e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802444:	b8 05 00 00 00       	mov    $0x5,%eax
+  802449:	e8 c1 fe ff ff       	call   80230f <nsipc>
+}
+  80244e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802451:	c9                   	leave
+  802452:	c3                   	ret
+
+00802453 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802453:	55                   	push   %ebp
+  802454:	89 e5                	mov    %esp,%ebp
+  802456:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802461:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802464:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802469:	b8 06 00 00 00       	mov    $0x6,%eax
+  80246e:	e8 9c fe ff ff       	call   80230f <nsipc>
+}
+  802473:	c9                   	leave
+  802474:	c3                   	ret
+
+00802475 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802475:	55                   	push   %ebp
+  802476:	89 e5                	mov    %esp,%ebp
+  802478:	56                   	push   %esi
+  802479:	53                   	push   %ebx
+  80247a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80247d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802480:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802485:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80248b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80248e:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802493:	b8 07 00 00 00       	mov    $0x7,%eax
+  802498:	e8 72 fe ff ff       	call   80230f <nsipc>
+  80249d:	89 c3                	mov    %eax,%ebx
+  80249f:	85 c0                	test   %eax,%eax
+  8024a1:	78 22                	js     8024c5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8024a3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8024a8:	39 c6                	cmp    %eax,%esi
+  8024aa:	0f 4e c6             	cmovle %esi,%eax
+  8024ad:	39 c3                	cmp    %eax,%ebx
+  8024af:	7f 1d                	jg     8024ce <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8024b1:	83 ec 04             	sub    $0x4,%esp
+  8024b4:	53                   	push   %ebx
+  8024b5:	68 00 70 80 00       	push   $0x807000
+  8024ba:	ff 75 0c             	push   0xc(%ebp)
+  8024bd:	e8 60 e5 ff ff       	call   800a22 <memmove>
+  8024c2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8024c5:	89 d8                	mov    %ebx,%eax
+  8024c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024ca:	5b                   	pop    %ebx
+  8024cb:	5e                   	pop    %esi
+  8024cc:	5d                   	pop    %ebp
+  8024cd:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8024ce:	68 7b 31 80 00       	push   $0x80317b
+  8024d3:	68 43 31 80 00       	push   $0x803143
+  8024d8:	6a 62                	push   $0x62
+  8024da:	68 90 31 80 00       	push   $0x803190
+  8024df:	e8 95 dc ff ff       	call   800179 <_panic>
+
+008024e4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8024e4:	55                   	push   %ebp
+  8024e5:	89 e5                	mov    %esp,%ebp
+  8024e7:	53                   	push   %ebx
+  8024e8:	83 ec 04             	sub    $0x4,%esp
+  8024eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8024ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f1:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8024f6:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8024fc:	7f 2e                	jg     80252c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8024fe:	83 ec 04             	sub    $0x4,%esp
+  802501:	53                   	push   %ebx
+  802502:	ff 75 0c             	push   0xc(%ebp)
+  802505:	68 0c 70 80 00       	push   $0x80700c
+  80250a:	e8 13 e5 ff ff       	call   800a22 <memmove>
+	nsipcbuf.send.req_size = size;
+  80250f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802515:	8b 45 14             	mov    0x14(%ebp),%eax
+  802518:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80251d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802522:	e8 e8 fd ff ff       	call   80230f <nsipc>
+}
+  802527:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80252a:	c9                   	leave
+  80252b:	c3                   	ret
+	assert(size < 1600);
+  80252c:	68 9c 31 80 00       	push   $0x80319c
+  802531:	68 43 31 80 00       	push   $0x803143
+  802536:	6a 6d                	push   $0x6d
+  802538:	68 90 31 80 00       	push   $0x803190
+  80253d:	e8 37 dc ff ff       	call   800179 <_panic>
+
+00802542 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802542:	55                   	push   %ebp
+  802543:	89 e5                	mov    %esp,%ebp
+  802545:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802548:	8b 45 08             	mov    0x8(%ebp),%eax
+  80254b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802550:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802553:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802558:	8b 45 10             	mov    0x10(%ebp),%eax
+  80255b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802560:	b8 09 00 00 00       	mov    $0x9,%eax
+  802565:	e8 a5 fd ff ff       	call   80230f <nsipc>
+}
+  80256a:	c9                   	leave
+  80256b:	c3                   	ret
+
+0080256c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80256c:	55                   	push   %ebp
+  80256d:	89 e5                	mov    %esp,%ebp
+  80256f:	56                   	push   %esi
+  802570:	53                   	push   %ebx
+  802571:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802574:	83 ec 0c             	sub    $0xc,%esp
+  802577:	ff 75 08             	push   0x8(%ebp)
+  80257a:	e8 2a f3 ff ff       	call   8018a9 <fd2data>
+  80257f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802581:	83 c4 08             	add    $0x8,%esp
+  802584:	68 a8 31 80 00       	push   $0x8031a8
+  802589:	53                   	push   %ebx
+  80258a:	e8 0d e3 ff ff       	call   80089c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80258f:	8b 46 04             	mov    0x4(%esi),%eax
+  802592:	2b 06                	sub    (%esi),%eax
+  802594:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80259a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025a1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8025a4:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8025ab:	40 80 00 
+	return 0;
+}
+  8025ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025b6:	5b                   	pop    %ebx
+  8025b7:	5e                   	pop    %esi
+  8025b8:	5d                   	pop    %ebp
+  8025b9:	c3                   	ret
+
+008025ba <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8025ba:	55                   	push   %ebp
+  8025bb:	89 e5                	mov    %esp,%ebp
+  8025bd:	53                   	push   %ebx
+  8025be:	83 ec 0c             	sub    $0xc,%esp
+  8025c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8025c4:	53                   	push   %ebx
+  8025c5:	6a 00                	push   $0x0
+  8025c7:	e8 a3 e8 ff ff       	call   800e6f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8025cc:	89 1c 24             	mov    %ebx,(%esp)
+  8025cf:	e8 d5 f2 ff ff       	call   8018a9 <fd2data>
+  8025d4:	83 c4 08             	add    $0x8,%esp
+  8025d7:	50                   	push   %eax
+  8025d8:	6a 00                	push   $0x0
+  8025da:	e8 90 e8 ff ff       	call   800e6f <sys_page_unmap>
+}
+  8025df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025e2:	c9                   	leave
+  8025e3:	c3                   	ret
+
+008025e4 <_pipeisclosed>:
+{
+  8025e4:	55                   	push   %ebp
+  8025e5:	89 e5                	mov    %esp,%ebp
+  8025e7:	57                   	push   %edi
+  8025e8:	56                   	push   %esi
+  8025e9:	53                   	push   %ebx
+  8025ea:	83 ec 1c             	sub    $0x1c,%esp
+  8025ed:	89 c7                	mov    %eax,%edi
+  8025ef:	89 d6                	mov    %edx,%esi
+  8025f1:	eb 3c                	jmp    80262f <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8025f3:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8025f6:	83 ec 0c             	sub    $0xc,%esp
+  8025f9:	57                   	push   %edi
+  8025fa:	e8 13 06 00 00       	call   802c12 <pageref>
+  8025ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802602:	89 34 24             	mov    %esi,(%esp)
+  802605:	e8 08 06 00 00       	call   802c12 <pageref>
+  80260a:	89 c2                	mov    %eax,%edx
+  80260c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80260e:	05 00 00 00 20       	add    $0x20000000,%eax
+  802613:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802616:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80261c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802621:	76 31                	jbe    802654 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802623:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802626:	39 c3                	cmp    %eax,%ebx
+  802628:	74 76                	je     8026a0 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80262a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80262d:	74 36                	je     802665 <_pipeisclosed+0x81>
+  80262f:	89 e0                	mov    %esp,%eax
+  802631:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802636:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80263c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802641:	77 b0                	ja     8025f3 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802643:	c1 e8 10             	shr    $0x10,%eax
+  802646:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80264c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802652:	eb 9f                	jmp    8025f3 <_pipeisclosed+0xf>
+  802654:	c1 e8 10             	shr    $0x10,%eax
+  802657:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80265d:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802663:	eb be                	jmp    802623 <_pipeisclosed+0x3f>
+  802665:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802667:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80266c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802672:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802677:	76 16                	jbe    80268f <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802679:	8b 42 58             	mov    0x58(%edx),%eax
+  80267c:	6a 01                	push   $0x1
+  80267e:	50                   	push   %eax
+  80267f:	53                   	push   %ebx
+  802680:	68 af 31 80 00       	push   $0x8031af
+  802685:	e8 ca db ff ff       	call   800254 <cprintf>
+  80268a:	83 c4 10             	add    $0x10,%esp
+  80268d:	eb a0                	jmp    80262f <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80268f:	c1 e8 10             	shr    $0x10,%eax
+  802692:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802698:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80269e:	eb d9                	jmp    802679 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8026a0:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8026a3:	0f 94 c0             	sete   %al
+  8026a6:	0f b6 c0             	movzbl %al,%eax
+}
+  8026a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ac:	5b                   	pop    %ebx
+  8026ad:	5e                   	pop    %esi
+  8026ae:	5f                   	pop    %edi
+  8026af:	5d                   	pop    %ebp
+  8026b0:	c3                   	ret
+
+008026b1 <devpipe_write>:
+{
+  8026b1:	55                   	push   %ebp
+  8026b2:	89 e5                	mov    %esp,%ebp
+  8026b4:	57                   	push   %edi
+  8026b5:	56                   	push   %esi
+  8026b6:	53                   	push   %ebx
+  8026b7:	83 ec 28             	sub    $0x28,%esp
+  8026ba:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8026bd:	56                   	push   %esi
+  8026be:	e8 e6 f1 ff ff       	call   8018a9 <fd2data>
+  8026c3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8026c5:	83 c4 10             	add    $0x10,%esp
+  8026c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026cd:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8026d0:	75 09                	jne    8026db <devpipe_write+0x2a>
+	return i;
+  8026d2:	89 f8                	mov    %edi,%eax
+  8026d4:	eb 23                	jmp    8026f9 <devpipe_write+0x48>
+			sys_yield();
+  8026d6:	e8 73 e6 ff ff       	call   800d4e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8026db:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026de:	8b 0b                	mov    (%ebx),%ecx
+  8026e0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026e3:	39 d0                	cmp    %edx,%eax
+  8026e5:	72 1a                	jb     802701 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8026e7:	89 da                	mov    %ebx,%edx
+  8026e9:	89 f0                	mov    %esi,%eax
+  8026eb:	e8 f4 fe ff ff       	call   8025e4 <_pipeisclosed>
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	74 e2                	je     8026d6 <devpipe_write+0x25>
+				return 0;
+  8026f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026fc:	5b                   	pop    %ebx
+  8026fd:	5e                   	pop    %esi
+  8026fe:	5f                   	pop    %edi
+  8026ff:	5d                   	pop    %ebp
+  802700:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802701:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802704:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802708:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80270b:	89 c2                	mov    %eax,%edx
+  80270d:	c1 fa 1f             	sar    $0x1f,%edx
+  802710:	89 d1                	mov    %edx,%ecx
+  802712:	c1 e9 1b             	shr    $0x1b,%ecx
+  802715:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802718:	83 e2 1f             	and    $0x1f,%edx
+  80271b:	29 ca                	sub    %ecx,%edx
+  80271d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802721:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802725:	83 c0 01             	add    $0x1,%eax
+  802728:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80272b:	83 c7 01             	add    $0x1,%edi
+  80272e:	eb 9d                	jmp    8026cd <devpipe_write+0x1c>
+
+00802730 <devpipe_read>:
+{
+  802730:	55                   	push   %ebp
+  802731:	89 e5                	mov    %esp,%ebp
+  802733:	57                   	push   %edi
+  802734:	56                   	push   %esi
+  802735:	53                   	push   %ebx
+  802736:	83 ec 18             	sub    $0x18,%esp
+  802739:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80273c:	57                   	push   %edi
+  80273d:	e8 67 f1 ff ff       	call   8018a9 <fd2data>
+  802742:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	be 00 00 00 00       	mov    $0x0,%esi
+  80274c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80274f:	75 13                	jne    802764 <devpipe_read+0x34>
+	return i;
+  802751:	89 f0                	mov    %esi,%eax
+  802753:	eb 02                	jmp    802757 <devpipe_read+0x27>
+				return i;
+  802755:	89 f0                	mov    %esi,%eax
+}
+  802757:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275a:	5b                   	pop    %ebx
+  80275b:	5e                   	pop    %esi
+  80275c:	5f                   	pop    %edi
+  80275d:	5d                   	pop    %ebp
+  80275e:	c3                   	ret
+			sys_yield();
+  80275f:	e8 ea e5 ff ff       	call   800d4e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802764:	8b 03                	mov    (%ebx),%eax
+  802766:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802769:	75 18                	jne    802783 <devpipe_read+0x53>
+			if (i > 0)
+  80276b:	85 f6                	test   %esi,%esi
+  80276d:	75 e6                	jne    802755 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80276f:	89 da                	mov    %ebx,%edx
+  802771:	89 f8                	mov    %edi,%eax
+  802773:	e8 6c fe ff ff       	call   8025e4 <_pipeisclosed>
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	74 e3                	je     80275f <devpipe_read+0x2f>
+				return 0;
+  80277c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802781:	eb d4                	jmp    802757 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802783:	99                   	cltd
+  802784:	c1 ea 1b             	shr    $0x1b,%edx
+  802787:	01 d0                	add    %edx,%eax
+  802789:	83 e0 1f             	and    $0x1f,%eax
+  80278c:	29 d0                	sub    %edx,%eax
+  80278e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802793:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802796:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802799:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80279c:	83 c6 01             	add    $0x1,%esi
+  80279f:	eb ab                	jmp    80274c <devpipe_read+0x1c>
+
+008027a1 <pipe>:
+{
+  8027a1:	55                   	push   %ebp
+  8027a2:	89 e5                	mov    %esp,%ebp
+  8027a4:	56                   	push   %esi
+  8027a5:	53                   	push   %ebx
+  8027a6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8027a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027ac:	50                   	push   %eax
+  8027ad:	e8 0e f1 ff ff       	call   8018c0 <fd_alloc>
+  8027b2:	89 c3                	mov    %eax,%ebx
+  8027b4:	83 c4 10             	add    $0x10,%esp
+  8027b7:	85 c0                	test   %eax,%eax
+  8027b9:	0f 88 23 01 00 00    	js     8028e2 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027bf:	83 ec 04             	sub    $0x4,%esp
+  8027c2:	68 07 04 00 00       	push   $0x407
+  8027c7:	ff 75 f4             	push   -0xc(%ebp)
+  8027ca:	6a 00                	push   $0x0
+  8027cc:	e8 c3 e5 ff ff       	call   800d94 <sys_page_alloc>
+  8027d1:	89 c3                	mov    %eax,%ebx
+  8027d3:	83 c4 10             	add    $0x10,%esp
+  8027d6:	85 c0                	test   %eax,%eax
+  8027d8:	0f 88 04 01 00 00    	js     8028e2 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8027de:	83 ec 0c             	sub    $0xc,%esp
+  8027e1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027e4:	50                   	push   %eax
+  8027e5:	e8 d6 f0 ff ff       	call   8018c0 <fd_alloc>
+  8027ea:	89 c3                	mov    %eax,%ebx
+  8027ec:	83 c4 10             	add    $0x10,%esp
+  8027ef:	85 c0                	test   %eax,%eax
+  8027f1:	0f 88 db 00 00 00    	js     8028d2 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027f7:	83 ec 04             	sub    $0x4,%esp
+  8027fa:	68 07 04 00 00       	push   $0x407
+  8027ff:	ff 75 f0             	push   -0x10(%ebp)
+  802802:	6a 00                	push   $0x0
+  802804:	e8 8b e5 ff ff       	call   800d94 <sys_page_alloc>
+  802809:	89 c3                	mov    %eax,%ebx
+  80280b:	83 c4 10             	add    $0x10,%esp
+  80280e:	85 c0                	test   %eax,%eax
+  802810:	0f 88 bc 00 00 00    	js     8028d2 <pipe+0x131>
+	va = fd2data(fd0);
+  802816:	83 ec 0c             	sub    $0xc,%esp
+  802819:	ff 75 f4             	push   -0xc(%ebp)
+  80281c:	e8 88 f0 ff ff       	call   8018a9 <fd2data>
+  802821:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802823:	83 c4 0c             	add    $0xc,%esp
+  802826:	68 07 04 00 00       	push   $0x407
+  80282b:	50                   	push   %eax
+  80282c:	6a 00                	push   $0x0
+  80282e:	e8 61 e5 ff ff       	call   800d94 <sys_page_alloc>
+  802833:	89 c3                	mov    %eax,%ebx
+  802835:	83 c4 10             	add    $0x10,%esp
+  802838:	85 c0                	test   %eax,%eax
+  80283a:	0f 88 82 00 00 00    	js     8028c2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802840:	83 ec 0c             	sub    $0xc,%esp
+  802843:	ff 75 f0             	push   -0x10(%ebp)
+  802846:	e8 5e f0 ff ff       	call   8018a9 <fd2data>
+  80284b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802852:	50                   	push   %eax
+  802853:	6a 00                	push   $0x0
+  802855:	56                   	push   %esi
+  802856:	6a 00                	push   $0x0
+  802858:	e8 a4 e5 ff ff       	call   800e01 <sys_page_map>
+  80285d:	89 c3                	mov    %eax,%ebx
+  80285f:	83 c4 20             	add    $0x20,%esp
+  802862:	85 c0                	test   %eax,%eax
+  802864:	78 4e                	js     8028b4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802866:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80286b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80286e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802870:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802873:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80287a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80287d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80287f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802882:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802889:	83 ec 0c             	sub    $0xc,%esp
+  80288c:	ff 75 f4             	push   -0xc(%ebp)
+  80288f:	e8 05 f0 ff ff       	call   801899 <fd2num>
+  802894:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802897:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802899:	83 c4 04             	add    $0x4,%esp
+  80289c:	ff 75 f0             	push   -0x10(%ebp)
+  80289f:	e8 f5 ef ff ff       	call   801899 <fd2num>
+  8028a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028a7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028b2:	eb 2e                	jmp    8028e2 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8028b4:	83 ec 08             	sub    $0x8,%esp
+  8028b7:	56                   	push   %esi
+  8028b8:	6a 00                	push   $0x0
+  8028ba:	e8 b0 e5 ff ff       	call   800e6f <sys_page_unmap>
+  8028bf:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8028c2:	83 ec 08             	sub    $0x8,%esp
+  8028c5:	ff 75 f0             	push   -0x10(%ebp)
+  8028c8:	6a 00                	push   $0x0
+  8028ca:	e8 a0 e5 ff ff       	call   800e6f <sys_page_unmap>
+  8028cf:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8028d2:	83 ec 08             	sub    $0x8,%esp
+  8028d5:	ff 75 f4             	push   -0xc(%ebp)
+  8028d8:	6a 00                	push   $0x0
+  8028da:	e8 90 e5 ff ff       	call   800e6f <sys_page_unmap>
+  8028df:	83 c4 10             	add    $0x10,%esp
+}
+  8028e2:	89 d8                	mov    %ebx,%eax
+  8028e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028e7:	5b                   	pop    %ebx
+  8028e8:	5e                   	pop    %esi
+  8028e9:	5d                   	pop    %ebp
+  8028ea:	c3                   	ret
+
+008028eb <pipeisclosed>:
+{
+  8028eb:	55                   	push   %ebp
+  8028ec:	89 e5                	mov    %esp,%ebp
+  8028ee:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028f4:	50                   	push   %eax
+  8028f5:	ff 75 08             	push   0x8(%ebp)
+  8028f8:	e8 19 f0 ff ff       	call   801916 <fd_lookup>
+  8028fd:	83 c4 10             	add    $0x10,%esp
+  802900:	85 c0                	test   %eax,%eax
+  802902:	78 18                	js     80291c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802904:	83 ec 0c             	sub    $0xc,%esp
+  802907:	ff 75 f4             	push   -0xc(%ebp)
+  80290a:	e8 9a ef ff ff       	call   8018a9 <fd2data>
+  80290f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802914:	e8 cb fc ff ff       	call   8025e4 <_pipeisclosed>
+  802919:	83 c4 10             	add    $0x10,%esp
+}
+  80291c:	c9                   	leave
+  80291d:	c3                   	ret
+
+0080291e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80291e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802923:	c3                   	ret
+
+00802924 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802924:	55                   	push   %ebp
+  802925:	89 e5                	mov    %esp,%ebp
+  802927:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80292a:	68 c7 31 80 00       	push   $0x8031c7
+  80292f:	ff 75 0c             	push   0xc(%ebp)
+  802932:	e8 65 df ff ff       	call   80089c <strcpy>
+	return 0;
+}
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293c:	c9                   	leave
+  80293d:	c3                   	ret
+
+0080293e <devcons_write>:
+{
+  80293e:	55                   	push   %ebp
+  80293f:	89 e5                	mov    %esp,%ebp
+  802941:	57                   	push   %edi
+  802942:	56                   	push   %esi
+  802943:	53                   	push   %ebx
+  802944:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80294a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80294f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802955:	eb 2e                	jmp    802985 <devcons_write+0x47>
+		m = n - tot;
+  802957:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80295a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80295c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802961:	39 c3                	cmp    %eax,%ebx
+  802963:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802966:	83 ec 04             	sub    $0x4,%esp
+  802969:	53                   	push   %ebx
+  80296a:	89 f0                	mov    %esi,%eax
+  80296c:	03 45 0c             	add    0xc(%ebp),%eax
+  80296f:	50                   	push   %eax
+  802970:	57                   	push   %edi
+  802971:	e8 ac e0 ff ff       	call   800a22 <memmove>
+		sys_cputs(buf, m);
+  802976:	83 c4 08             	add    $0x8,%esp
+  802979:	53                   	push   %ebx
+  80297a:	57                   	push   %edi
+  80297b:	e8 95 e2 ff ff       	call   800c15 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802980:	01 de                	add    %ebx,%esi
+  802982:	83 c4 10             	add    $0x10,%esp
+  802985:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802988:	72 cd                	jb     802957 <devcons_write+0x19>
+}
+  80298a:	89 f0                	mov    %esi,%eax
+  80298c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80298f:	5b                   	pop    %ebx
+  802990:	5e                   	pop    %esi
+  802991:	5f                   	pop    %edi
+  802992:	5d                   	pop    %ebp
+  802993:	c3                   	ret
+
+00802994 <devcons_read>:
+{
+  802994:	55                   	push   %ebp
+  802995:	89 e5                	mov    %esp,%ebp
+  802997:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80299a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029a3:	75 07                	jne    8029ac <devcons_read+0x18>
+  8029a5:	eb 1f                	jmp    8029c6 <devcons_read+0x32>
+		sys_yield();
+  8029a7:	e8 a2 e3 ff ff       	call   800d4e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8029ac:	e8 a8 e2 ff ff       	call   800c59 <sys_cgetc>
+  8029b1:	85 c0                	test   %eax,%eax
+  8029b3:	74 f2                	je     8029a7 <devcons_read+0x13>
+	if (c < 0)
+  8029b5:	78 0f                	js     8029c6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8029b7:	83 f8 04             	cmp    $0x4,%eax
+  8029ba:	74 0c                	je     8029c8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8029bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029bf:	88 02                	mov    %al,(%edx)
+	return 1;
+  8029c1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+		return 0;
+  8029c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cd:	eb f7                	jmp    8029c6 <devcons_read+0x32>
+
+008029cf <cputchar>:
+{
+  8029cf:	55                   	push   %ebp
+  8029d0:	89 e5                	mov    %esp,%ebp
+  8029d2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8029d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8029db:	6a 01                	push   $0x1
+  8029dd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029e0:	50                   	push   %eax
+  8029e1:	e8 2f e2 ff ff       	call   800c15 <sys_cputs>
+}
+  8029e6:	83 c4 10             	add    $0x10,%esp
+  8029e9:	c9                   	leave
+  8029ea:	c3                   	ret
+
+008029eb <getchar>:
+{
+  8029eb:	55                   	push   %ebp
+  8029ec:	89 e5                	mov    %esp,%ebp
+  8029ee:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8029f1:	6a 01                	push   $0x1
+  8029f3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029f6:	50                   	push   %eax
+  8029f7:	6a 00                	push   $0x0
+  8029f9:	e8 9e f1 ff ff       	call   801b9c <read>
+	if (r < 0)
+  8029fe:	83 c4 10             	add    $0x10,%esp
+  802a01:	85 c0                	test   %eax,%eax
+  802a03:	78 06                	js     802a0b <getchar+0x20>
+	if (r < 1)
+  802a05:	74 06                	je     802a0d <getchar+0x22>
+	return c;
+  802a07:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802a0b:	c9                   	leave
+  802a0c:	c3                   	ret
+		return -E_EOF;
+  802a0d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802a12:	eb f7                	jmp    802a0b <getchar+0x20>
+
+00802a14 <iscons>:
+{
+  802a14:	55                   	push   %ebp
+  802a15:	89 e5                	mov    %esp,%ebp
+  802a17:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a1d:	50                   	push   %eax
+  802a1e:	ff 75 08             	push   0x8(%ebp)
+  802a21:	e8 f0 ee ff ff       	call   801916 <fd_lookup>
+  802a26:	83 c4 10             	add    $0x10,%esp
+  802a29:	85 c0                	test   %eax,%eax
+  802a2b:	78 11                	js     802a3e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802a2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a30:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a36:	39 10                	cmp    %edx,(%eax)
+  802a38:	0f 94 c0             	sete   %al
+  802a3b:	0f b6 c0             	movzbl %al,%eax
+}
+  802a3e:	c9                   	leave
+  802a3f:	c3                   	ret
+
+00802a40 <opencons>:
+{
+  802a40:	55                   	push   %ebp
+  802a41:	89 e5                	mov    %esp,%ebp
+  802a43:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802a46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a49:	50                   	push   %eax
+  802a4a:	e8 71 ee ff ff       	call   8018c0 <fd_alloc>
+  802a4f:	83 c4 10             	add    $0x10,%esp
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	78 3a                	js     802a90 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802a56:	83 ec 04             	sub    $0x4,%esp
+  802a59:	68 07 04 00 00       	push   $0x407
+  802a5e:	ff 75 f4             	push   -0xc(%ebp)
+  802a61:	6a 00                	push   $0x0
+  802a63:	e8 2c e3 ff ff       	call   800d94 <sys_page_alloc>
+  802a68:	83 c4 10             	add    $0x10,%esp
+  802a6b:	85 c0                	test   %eax,%eax
+  802a6d:	78 21                	js     802a90 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802a6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a72:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a78:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802a7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a7d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802a84:	83 ec 0c             	sub    $0xc,%esp
+  802a87:	50                   	push   %eax
+  802a88:	e8 0c ee ff ff       	call   801899 <fd2num>
+  802a8d:	83 c4 10             	add    $0x10,%esp
+}
+  802a90:	c9                   	leave
+  802a91:	c3                   	ret
+
+00802a92 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	56                   	push   %esi
+  802a96:	53                   	push   %ebx
+  802a97:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802aa0:	85 c0                	test   %eax,%eax
+  802aa2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802aa7:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802aaa:	83 ec 08             	sub    $0x8,%esp
+  802aad:	ff 75 14             	push   0x14(%ebp)
+  802ab0:	50                   	push   %eax
+  802ab1:	e8 ef e6 ff ff       	call   8011a5 <sys_ipc_recv_until>
+  802ab6:	83 c4 10             	add    $0x10,%esp
+  802ab9:	85 c0                	test   %eax,%eax
+  802abb:	78 61                	js     802b1e <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802abd:	85 f6                	test   %esi,%esi
+  802abf:	74 1c                	je     802add <ipc_recv_until+0x4b>
+  802ac1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ac3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ac8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ace:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ad3:	76 5f                	jbe    802b34 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802ad5:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802adb:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802add:	85 db                	test   %ebx,%ebx
+  802adf:	74 1c                	je     802afd <ipc_recv_until+0x6b>
+  802ae1:	89 e0                	mov    %esp,%eax
+  802ae3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ae8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802aee:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802af3:	76 50                	jbe    802b45 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802af5:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802afb:	89 03                	mov    %eax,(%ebx)
+  802afd:	89 e0                	mov    %esp,%eax
+  802aff:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b04:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b0a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b0f:	76 45                	jbe    802b56 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802b11:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802b17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b1a:	5b                   	pop    %ebx
+  802b1b:	5e                   	pop    %esi
+  802b1c:	5d                   	pop    %ebp
+  802b1d:	c3                   	ret
+		if (from_env_store)
+  802b1e:	85 f6                	test   %esi,%esi
+  802b20:	74 06                	je     802b28 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802b22:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802b28:	85 db                	test   %ebx,%ebx
+  802b2a:	74 eb                	je     802b17 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802b2c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802b32:	eb e3                	jmp    802b17 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802b34:	c1 e8 10             	shr    $0x10,%eax
+  802b37:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b3d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b43:	eb 90                	jmp    802ad5 <ipc_recv_until+0x43>
+  802b45:	c1 e8 10             	shr    $0x10,%eax
+  802b48:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b4e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b54:	eb 9f                	jmp    802af5 <ipc_recv_until+0x63>
+  802b56:	c1 e8 10             	shr    $0x10,%eax
+  802b59:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b5f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b65:	eb aa                	jmp    802b11 <ipc_recv_until+0x7f>
+
+00802b67 <ipc_recv>:
+{
+  802b67:	55                   	push   %ebp
+  802b68:	89 e5                	mov    %esp,%ebp
+  802b6a:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802b6d:	6a 00                	push   $0x0
+  802b6f:	ff 75 10             	push   0x10(%ebp)
+  802b72:	ff 75 0c             	push   0xc(%ebp)
+  802b75:	ff 75 08             	push   0x8(%ebp)
+  802b78:	e8 15 ff ff ff       	call   802a92 <ipc_recv_until>
+}
+  802b7d:	c9                   	leave
+  802b7e:	c3                   	ret
+
+00802b7f <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b7f:	55                   	push   %ebp
+  802b80:	89 e5                	mov    %esp,%ebp
+  802b82:	57                   	push   %edi
+  802b83:	56                   	push   %esi
+  802b84:	53                   	push   %ebx
+  802b85:	83 ec 0c             	sub    $0xc,%esp
+  802b88:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b8b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b91:	85 db                	test   %ebx,%ebx
+  802b93:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b98:	0f 44 d8             	cmove  %eax,%ebx
+  802b9b:	eb 05                	jmp    802ba2 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802b9d:	e8 ac e1 ff ff       	call   800d4e <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802ba2:	ff 75 14             	push   0x14(%ebp)
+  802ba5:	53                   	push   %ebx
+  802ba6:	56                   	push   %esi
+  802ba7:	57                   	push   %edi
+  802ba8:	e8 44 e5 ff ff       	call   8010f1 <sys_ipc_try_send>
+  802bad:	83 c4 10             	add    $0x10,%esp
+  802bb0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802bb3:	74 e8                	je     802b9d <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802bb5:	85 c0                	test   %eax,%eax
+  802bb7:	78 08                	js     802bc1 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802bb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bbc:	5b                   	pop    %ebx
+  802bbd:	5e                   	pop    %esi
+  802bbe:	5f                   	pop    %edi
+  802bbf:	5d                   	pop    %ebp
+  802bc0:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802bc1:	50                   	push   %eax
+  802bc2:	68 d3 31 80 00       	push   $0x8031d3
+  802bc7:	6a 4f                	push   $0x4f
+  802bc9:	68 e6 31 80 00       	push   $0x8031e6
+  802bce:	e8 a6 d5 ff ff       	call   800179 <_panic>
+
+00802bd3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802bd3:	55                   	push   %ebp
+  802bd4:	89 e5                	mov    %esp,%ebp
+  802bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802bde:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802be4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802bea:	8b 52 50             	mov    0x50(%edx),%edx
+  802bed:	39 ca                	cmp    %ecx,%edx
+  802bef:	74 11                	je     802c02 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802bf1:	83 c0 01             	add    $0x1,%eax
+  802bf4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802bf9:	75 e3                	jne    802bde <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c00:	eb 0e                	jmp    802c10 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802c02:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c08:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c0d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c10:	5d                   	pop    %ebp
+  802c11:	c3                   	ret
+
+00802c12 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c12:	55                   	push   %ebp
+  802c13:	89 e5                	mov    %esp,%ebp
+  802c15:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802c18:	89 c2                	mov    %eax,%edx
+  802c1a:	c1 ea 16             	shr    $0x16,%edx
+  802c1d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802c24:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802c29:	f6 c1 01             	test   $0x1,%cl
+  802c2c:	74 1a                	je     802c48 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802c2e:	c1 e8 0c             	shr    $0xc,%eax
+  802c31:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802c38:	a8 01                	test   $0x1,%al
+  802c3a:	74 0c                	je     802c48 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802c3c:	c1 e8 0c             	shr    $0xc,%eax
+  802c3f:	c1 e0 04             	shl    $0x4,%eax
+  802c42:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802c48:	89 d0                	mov    %edx,%eax
+  802c4a:	5d                   	pop    %ebp
+  802c4b:	c3                   	ret
@@ -0,0 +1,6167 @@
+
+obj/user/faultbadhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 bf ee       	push   $0xeebff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 fd 0c 00 00       	call   800d44 <sys_page_alloc>
+	sys_env_set_pgfault_upcall(0, (void*) 0xDeadBeef);
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 ef be ad de       	push   $0xdeadbeef
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 0a 0f 00 00       	call   800f60 <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+}
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	57                   	push   %edi
+  800069:	56                   	push   %esi
+  80006a:	53                   	push   %ebx
+  80006b:	83 ec 0c             	sub    $0xc,%esp
+  80006e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800071:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800074:	b8 01 00 00 00       	mov    $0x1,%eax
+  800079:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80007b:	c1 ea 0b             	shr    $0xb,%edx
+  80007e:	83 f2 01             	xor    $0x1,%edx
+  800081:	83 e2 01             	and    $0x1,%edx
+  800084:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80008a:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800091:	00 00 00 
+	envid = sys_getenvid();
+  800094:	e8 1f 0c 00 00       	call   800cb8 <sys_getenvid>
+  800099:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000a0:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8000a6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000ac:	8b 52 48             	mov    0x48(%edx),%edx
+  8000af:	39 ca                	cmp    %ecx,%edx
+  8000b1:	74 27                	je     8000da <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8000b3:	83 c0 01             	add    $0x1,%eax
+  8000b6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000bb:	75 e3                	jne    8000a0 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000bd:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000c4:	75 24                	jne    8000ea <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	68 80 2b 80 00       	push   $0x802b80
+  8000ce:	6a 23                	push   $0x23
+  8000d0:	68 a3 2b 80 00       	push   $0x802ba3
+  8000d5:	e8 4f 00 00 00       	call   800129 <_panic>
+			mainenv = &envs[i];
+  8000da:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000e0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000e5:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000ea:	85 ff                	test   %edi,%edi
+  8000ec:	7e 07                	jle    8000f5 <libmain+0x90>
+		binaryname = argv[0];
+  8000ee:	8b 06                	mov    (%esi),%eax
+  8000f0:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000f5:	83 ec 08             	sub    $0x8,%esp
+  8000f8:	56                   	push   %esi
+  8000f9:	57                   	push   %edi
+  8000fa:	e8 34 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000ff:	e8 0b 00 00 00       	call   80010f <exit>
+}
+  800104:	83 c4 10             	add    $0x10,%esp
+  800107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010a:	5b                   	pop    %ebx
+  80010b:	5e                   	pop    %esi
+  80010c:	5f                   	pop    %edi
+  80010d:	5d                   	pop    %ebp
+  80010e:	c3                   	ret
+
+0080010f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80010f:	55                   	push   %ebp
+  800110:	89 e5                	mov    %esp,%ebp
+  800112:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800115:	e8 94 18 00 00       	call   8019ae <close_all>
+	sys_env_destroy(0);
+  80011a:	83 ec 0c             	sub    $0xc,%esp
+  80011d:	6a 00                	push   $0x0
+  80011f:	e8 2b 0b 00 00       	call   800c4f <sys_env_destroy>
+}
+  800124:	83 c4 10             	add    $0x10,%esp
+  800127:	c9                   	leave
+  800128:	c3                   	ret
+
+00800129 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800129:	55                   	push   %ebp
+  80012a:	89 e5                	mov    %esp,%ebp
+  80012c:	56                   	push   %esi
+  80012d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80012e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800131:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800137:	e8 7c 0b 00 00       	call   800cb8 <sys_getenvid>
+  80013c:	83 ec 0c             	sub    $0xc,%esp
+  80013f:	ff 75 0c             	push   0xc(%ebp)
+  800142:	ff 75 08             	push   0x8(%ebp)
+  800145:	56                   	push   %esi
+  800146:	50                   	push   %eax
+  800147:	68 bc 2b 80 00       	push   $0x802bbc
+  80014c:	e8 b3 00 00 00       	call   800204 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800151:	83 c4 18             	add    $0x18,%esp
+  800154:	53                   	push   %ebx
+  800155:	ff 75 10             	push   0x10(%ebp)
+  800158:	e8 56 00 00 00       	call   8001b3 <vcprintf>
+	cprintf("\n");
+  80015d:	c7 04 24 2c 30 80 00 	movl   $0x80302c,(%esp)
+  800164:	e8 9b 00 00 00       	call   800204 <cprintf>
+  800169:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80016c:	cc                   	int3
+	while (1)
+  80016d:	eb fd                	jmp    80016c <_panic+0x43>
+
+0080016f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80016f:	55                   	push   %ebp
+  800170:	89 e5                	mov    %esp,%ebp
+  800172:	53                   	push   %ebx
+  800173:	83 ec 04             	sub    $0x4,%esp
+  800176:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800179:	8b 13                	mov    (%ebx),%edx
+  80017b:	8d 42 01             	lea    0x1(%edx),%eax
+  80017e:	89 03                	mov    %eax,(%ebx)
+  800180:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800183:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800187:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80018c:	74 09                	je     800197 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80018e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800192:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800195:	c9                   	leave
+  800196:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800197:	83 ec 08             	sub    $0x8,%esp
+  80019a:	68 ff 00 00 00       	push   $0xff
+  80019f:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a2:	50                   	push   %eax
+  8001a3:	e8 1d 0a 00 00       	call   800bc5 <sys_cputs>
+		b->idx = 0;
+  8001a8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001ae:	83 c4 10             	add    $0x10,%esp
+  8001b1:	eb db                	jmp    80018e <putch+0x1f>
+
+008001b3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b3:	55                   	push   %ebp
+  8001b4:	89 e5                	mov    %esp,%ebp
+  8001b6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001bc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c3:	00 00 00 
+	b.cnt = 0;
+  8001c6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001cd:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001d0:	ff 75 0c             	push   0xc(%ebp)
+  8001d3:	ff 75 08             	push   0x8(%ebp)
+  8001d6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001dc:	50                   	push   %eax
+  8001dd:	68 6f 01 80 00       	push   $0x80016f
+  8001e2:	e8 fb 00 00 00       	call   8002e2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001e7:	83 c4 08             	add    $0x8,%esp
+  8001ea:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f0:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001f6:	50                   	push   %eax
+  8001f7:	e8 c9 09 00 00       	call   800bc5 <sys_cputs>
+
+	return b.cnt;
+}
+  8001fc:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800202:	c9                   	leave
+  800203:	c3                   	ret
+
+00800204 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800204:	55                   	push   %ebp
+  800205:	89 e5                	mov    %esp,%ebp
+  800207:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80020a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80020d:	50                   	push   %eax
+  80020e:	ff 75 08             	push   0x8(%ebp)
+  800211:	e8 9d ff ff ff       	call   8001b3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800216:	c9                   	leave
+  800217:	c3                   	ret
+
+00800218 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800218:	55                   	push   %ebp
+  800219:	89 e5                	mov    %esp,%ebp
+  80021b:	57                   	push   %edi
+  80021c:	56                   	push   %esi
+  80021d:	53                   	push   %ebx
+  80021e:	83 ec 1c             	sub    $0x1c,%esp
+  800221:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800224:	89 d6                	mov    %edx,%esi
+  800226:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80022c:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80022f:	73 0b                	jae    80023c <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800231:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800234:	c1 e7 08             	shl    $0x8,%edi
+  800237:	0b 7d 10             	or     0x10(%ebp),%edi
+  80023a:	eb 36                	jmp    800272 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80023c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80023f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800244:	f7 75 08             	divl   0x8(%ebp)
+  800247:	89 c1                	mov    %eax,%ecx
+  800249:	ff 75 14             	push   0x14(%ebp)
+  80024c:	ff 75 10             	push   0x10(%ebp)
+  80024f:	83 eb 01             	sub    $0x1,%ebx
+  800252:	53                   	push   %ebx
+  800253:	ff 75 08             	push   0x8(%ebp)
+  800256:	89 f2                	mov    %esi,%edx
+  800258:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80025b:	e8 b8 ff ff ff       	call   800218 <printnum>
+  800260:	83 c4 10             	add    $0x10,%esp
+  800263:	eb 14                	jmp    800279 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800265:	83 ec 08             	sub    $0x8,%esp
+  800268:	56                   	push   %esi
+  800269:	57                   	push   %edi
+  80026a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80026d:	ff d0                	call   *%eax
+  80026f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800272:	83 eb 01             	sub    $0x1,%ebx
+  800275:	85 db                	test   %ebx,%ebx
+  800277:	7f ec                	jg     800265 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800279:	83 ec 08             	sub    $0x8,%esp
+  80027c:	56                   	push   %esi
+  80027d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800280:	ba 00 00 00 00       	mov    $0x0,%edx
+  800285:	f7 75 08             	divl   0x8(%ebp)
+  800288:	0f be 92 df 2b 80 00 	movsbl 0x802bdf(%edx),%edx
+  80028f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800292:	c1 e0 08             	shl    $0x8,%eax
+  800295:	09 d0                	or     %edx,%eax
+  800297:	50                   	push   %eax
+  800298:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80029b:	ff d0                	call   *%eax
+}
+  80029d:	83 c4 10             	add    $0x10,%esp
+  8002a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a3:	5b                   	pop    %ebx
+  8002a4:	5e                   	pop    %esi
+  8002a5:	5f                   	pop    %edi
+  8002a6:	5d                   	pop    %ebp
+  8002a7:	c3                   	ret
+
+008002a8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002a8:	55                   	push   %ebp
+  8002a9:	89 e5                	mov    %esp,%ebp
+  8002ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002ae:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002b2:	8b 10                	mov    (%eax),%edx
+  8002b4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002b7:	73 0a                	jae    8002c3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002b9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002bc:	89 08                	mov    %ecx,(%eax)
+  8002be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c1:	88 02                	mov    %al,(%edx)
+}
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <printfmt>:
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002cb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002ce:	50                   	push   %eax
+  8002cf:	ff 75 10             	push   0x10(%ebp)
+  8002d2:	ff 75 0c             	push   0xc(%ebp)
+  8002d5:	ff 75 08             	push   0x8(%ebp)
+  8002d8:	e8 05 00 00 00       	call   8002e2 <vprintfmt>
+}
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	c9                   	leave
+  8002e1:	c3                   	ret
+
+008002e2 <vprintfmt>:
+{
+  8002e2:	55                   	push   %ebp
+  8002e3:	89 e5                	mov    %esp,%ebp
+  8002e5:	57                   	push   %edi
+  8002e6:	56                   	push   %esi
+  8002e7:	53                   	push   %ebx
+  8002e8:	83 ec 3c             	sub    $0x3c,%esp
+  8002eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002ee:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002f1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002f8:	eb 16                	jmp    800310 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002fa:	83 ec 08             	sub    $0x8,%esp
+  8002fd:	ff 75 0c             	push   0xc(%ebp)
+  800300:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800303:	c1 e2 08             	shl    $0x8,%edx
+  800306:	09 d0                	or     %edx,%eax
+  800308:	50                   	push   %eax
+  800309:	ff d7                	call   *%edi
+  80030b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80030e:	89 de                	mov    %ebx,%esi
+  800310:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800313:	0f b6 06             	movzbl (%esi),%eax
+  800316:	83 f8 25             	cmp    $0x25,%eax
+  800319:	74 0c                	je     800327 <vprintfmt+0x45>
+			if (ch == '\0')
+  80031b:	85 c0                	test   %eax,%eax
+  80031d:	75 db                	jne    8002fa <vprintfmt+0x18>
+}
+  80031f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800322:	5b                   	pop    %ebx
+  800323:	5e                   	pop    %esi
+  800324:	5f                   	pop    %edi
+  800325:	5d                   	pop    %ebp
+  800326:	c3                   	ret
+		padc = ' ';
+  800327:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80032b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800332:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800339:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800340:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800345:	8d 73 01             	lea    0x1(%ebx),%esi
+  800348:	0f b6 13             	movzbl (%ebx),%edx
+  80034b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80034e:	3c 55                	cmp    $0x55,%al
+  800350:	0f 87 2c 04 00 00    	ja     800782 <vprintfmt+0x4a0>
+  800356:	0f b6 c0             	movzbl %al,%eax
+  800359:	ff 24 85 20 2d 80 00 	jmp    *0x802d20(,%eax,4)
+  800360:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800362:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800366:	eb dd                	jmp    800345 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800368:	89 f3                	mov    %esi,%ebx
+  80036a:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80036e:	eb d5                	jmp    800345 <vprintfmt+0x63>
+  800370:	0f b6 d2             	movzbl %dl,%edx
+  800373:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800375:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80037a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80037d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800381:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800384:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800387:	83 fe 09             	cmp    $0x9,%esi
+  80038a:	0f 87 8a 00 00 00    	ja     80041a <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800390:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800393:	eb e5                	jmp    80037a <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800395:	8b 45 14             	mov    0x14(%ebp),%eax
+  800398:	8b 00                	mov    (%eax),%eax
+  80039a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80039d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8003a3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a6:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8003a8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ac:	79 97                	jns    800345 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8003ae:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003bb:	eb 88                	jmp    800345 <vprintfmt+0x63>
+			if (width < 0)
+  8003bd:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003c0:	85 db                	test   %ebx,%ebx
+  8003c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c7:	0f 49 c3             	cmovns %ebx,%eax
+  8003ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003cd:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003cf:	e9 71 ff ff ff       	jmp    800345 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d4:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003d6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003dd:	e9 63 ff ff ff       	jmp    800345 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003e2:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003e5:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003e9:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003f0:	3c 67                	cmp    $0x67,%al
+  8003f2:	0f 84 18 ff ff ff    	je     800310 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003f8:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003ff:	3c 72                	cmp    $0x72,%al
+  800401:	0f 84 09 ff ff ff    	je     800310 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800407:	3c 62                	cmp    $0x62,%al
+  800409:	0f 94 c0             	sete   %al
+  80040c:	0f b6 c0             	movzbl %al,%eax
+  80040f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800412:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800415:	e9 f6 fe ff ff       	jmp    800310 <vprintfmt+0x2e>
+  80041a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041d:	eb 89                	jmp    8003a8 <vprintfmt+0xc6>
+			lflag++;
+  80041f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800422:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800424:	e9 1c ff ff ff       	jmp    800345 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800429:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80042f:	83 ec 08             	sub    $0x8,%esp
+  800432:	ff 75 0c             	push   0xc(%ebp)
+  800435:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800438:	c1 e0 08             	shl    $0x8,%eax
+  80043b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80043e:	0b 01                	or     (%ecx),%eax
+  800440:	50                   	push   %eax
+  800441:	ff d7                	call   *%edi
+			break;
+  800443:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800446:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800449:	e9 c2 fe ff ff       	jmp    800310 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800454:	8b 10                	mov    (%eax),%edx
+  800456:	89 d0                	mov    %edx,%eax
+  800458:	f7 d8                	neg    %eax
+  80045a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045d:	83 f8 12             	cmp    $0x12,%eax
+  800460:	7f 25                	jg     800487 <vprintfmt+0x1a5>
+  800462:	8b 14 85 80 2e 80 00 	mov    0x802e80(,%eax,4),%edx
+  800469:	85 d2                	test   %edx,%edx
+  80046b:	74 1a                	je     800487 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80046d:	52                   	push   %edx
+  80046e:	68 c1 2f 80 00       	push   $0x802fc1
+  800473:	ff 75 0c             	push   0xc(%ebp)
+  800476:	57                   	push   %edi
+  800477:	e8 49 fe ff ff       	call   8002c5 <printfmt>
+  80047c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800482:	e9 89 fe ff ff       	jmp    800310 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800487:	50                   	push   %eax
+  800488:	68 f7 2b 80 00       	push   $0x802bf7
+  80048d:	ff 75 0c             	push   0xc(%ebp)
+  800490:	57                   	push   %edi
+  800491:	e8 2f fe ff ff       	call   8002c5 <printfmt>
+  800496:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800499:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80049c:	e9 6f fe ff ff       	jmp    800310 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a4:	83 c0 04             	add    $0x4,%eax
+  8004a7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8004aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ad:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004af:	85 c9                	test   %ecx,%ecx
+  8004b1:	b8 f0 2b 80 00       	mov    $0x802bf0,%eax
+  8004b6:	0f 45 c1             	cmovne %ecx,%eax
+  8004b9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c0:	7e 06                	jle    8004c8 <vprintfmt+0x1e6>
+  8004c2:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004c6:	75 1a                	jne    8004e2 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004cb:	c1 e0 08             	shl    $0x8,%eax
+  8004ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004d1:	83 c8 3f             	or     $0x3f,%eax
+  8004d4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004d7:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004da:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004dd:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004e0:	eb 6d                	jmp    80054f <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004e2:	83 ec 08             	sub    $0x8,%esp
+  8004e5:	ff 75 d0             	push   -0x30(%ebp)
+  8004e8:	ff 75 c8             	push   -0x38(%ebp)
+  8004eb:	e8 39 03 00 00       	call   800829 <strnlen>
+  8004f0:	89 c2                	mov    %eax,%edx
+  8004f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f5:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004f7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004fa:	c1 e1 08             	shl    $0x8,%ecx
+  8004fd:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800501:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800503:	83 c4 10             	add    $0x10,%esp
+  800506:	89 c3                	mov    %eax,%ebx
+  800508:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80050e:	89 ce                	mov    %ecx,%esi
+  800510:	eb 0f                	jmp    800521 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800512:	83 ec 08             	sub    $0x8,%esp
+  800515:	ff 75 0c             	push   0xc(%ebp)
+  800518:	56                   	push   %esi
+  800519:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80051b:	83 eb 01             	sub    $0x1,%ebx
+  80051e:	83 c4 10             	add    $0x10,%esp
+  800521:	85 db                	test   %ebx,%ebx
+  800523:	7f ed                	jg     800512 <vprintfmt+0x230>
+  800525:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800528:	8b 75 10             	mov    0x10(%ebp),%esi
+  80052b:	85 c0                	test   %eax,%eax
+  80052d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800532:	0f 49 d0             	cmovns %eax,%edx
+  800535:	29 d0                	sub    %edx,%eax
+  800537:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80053a:	eb 8c                	jmp    8004c8 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80053c:	83 ec 08             	sub    $0x8,%esp
+  80053f:	ff 75 0c             	push   0xc(%ebp)
+  800542:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800545:	09 c2                	or     %eax,%edx
+  800547:	52                   	push   %edx
+  800548:	ff d7                	call   *%edi
+  80054a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80054d:	89 d9                	mov    %ebx,%ecx
+  80054f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800552:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800556:	0f be d0             	movsbl %al,%edx
+  800559:	85 d2                	test   %edx,%edx
+  80055b:	74 2a                	je     800587 <vprintfmt+0x2a5>
+  80055d:	85 f6                	test   %esi,%esi
+  80055f:	78 05                	js     800566 <vprintfmt+0x284>
+  800561:	83 ee 01             	sub    $0x1,%esi
+  800564:	78 3b                	js     8005a1 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800566:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80056a:	74 d0                	je     80053c <vprintfmt+0x25a>
+  80056c:	0f be c0             	movsbl %al,%eax
+  80056f:	83 e8 20             	sub    $0x20,%eax
+  800572:	83 f8 5e             	cmp    $0x5e,%eax
+  800575:	76 c5                	jbe    80053c <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	ff 75 0c             	push   0xc(%ebp)
+  80057d:	ff 75 cc             	push   -0x34(%ebp)
+  800580:	ff d7                	call   *%edi
+  800582:	83 c4 10             	add    $0x10,%esp
+  800585:	eb c6                	jmp    80054d <vprintfmt+0x26b>
+  800587:	8b 75 10             	mov    0x10(%ebp),%esi
+  80058a:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80058d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800590:	01 c3                	add    %eax,%ebx
+  800592:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800594:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800597:	83 c8 20             	or     $0x20,%eax
+  80059a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80059d:	89 c6                	mov    %eax,%esi
+  80059f:	eb 14                	jmp    8005b5 <vprintfmt+0x2d3>
+  8005a1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005a4:	eb e4                	jmp    80058a <vprintfmt+0x2a8>
+  8005a6:	83 ec 08             	sub    $0x8,%esp
+  8005a9:	ff 75 0c             	push   0xc(%ebp)
+  8005ac:	56                   	push   %esi
+  8005ad:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005af:	83 eb 01             	sub    $0x1,%ebx
+  8005b2:	83 c4 10             	add    $0x10,%esp
+  8005b5:	85 db                	test   %ebx,%ebx
+  8005b7:	7f ed                	jg     8005a6 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005bc:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c2:	e9 49 fd ff ff       	jmp    800310 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005c7:	83 f9 01             	cmp    $0x1,%ecx
+  8005ca:	7f 1f                	jg     8005eb <vprintfmt+0x309>
+	else if (lflag)
+  8005cc:	85 c9                	test   %ecx,%ecx
+  8005ce:	74 69                	je     800639 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d3:	8b 00                	mov    (%eax),%eax
+  8005d5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d8:	89 c1                	mov    %eax,%ecx
+  8005da:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005dd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e9:	eb 17                	jmp    800602 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8b 50 04             	mov    0x4(%eax),%edx
+  8005f1:	8b 00                	mov    (%eax),%eax
+  8005f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fc:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800602:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800605:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800608:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80060d:	85 db                	test   %ebx,%ebx
+  80060f:	0f 89 f6 00 00 00    	jns    80070b <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800615:	83 ec 08             	sub    $0x8,%esp
+  800618:	ff 75 0c             	push   0xc(%ebp)
+  80061b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80061e:	c1 e0 08             	shl    $0x8,%eax
+  800621:	83 c8 2d             	or     $0x2d,%eax
+  800624:	50                   	push   %eax
+  800625:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800627:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80062a:	f7 d9                	neg    %ecx
+  80062c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80062f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800634:	e9 d2 00 00 00       	jmp    80070b <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063c:	8b 00                	mov    (%eax),%eax
+  80063e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800641:	89 c1                	mov    %eax,%ecx
+  800643:	c1 f9 1f             	sar    $0x1f,%ecx
+  800646:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8d 40 04             	lea    0x4(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800652:	eb ae                	jmp    800602 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800654:	83 f9 01             	cmp    $0x1,%ecx
+  800657:	7f 19                	jg     800672 <vprintfmt+0x390>
+	else if (lflag)
+  800659:	85 c9                	test   %ecx,%ecx
+  80065b:	74 2a                	je     800687 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80065d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800660:	8b 08                	mov    (%eax),%ecx
+  800662:	8d 40 04             	lea    0x4(%eax),%eax
+  800665:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800668:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80066d:	e9 99 00 00 00       	jmp    80070b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 08                	mov    (%eax),%ecx
+  800677:	8d 40 08             	lea    0x8(%eax),%eax
+  80067a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80067d:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800682:	e9 84 00 00 00       	jmp    80070b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 08                	mov    (%eax),%ecx
+  80068c:	8d 40 04             	lea    0x4(%eax),%eax
+  80068f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800692:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800697:	eb 72                	jmp    80070b <vprintfmt+0x429>
+	if (lflag >= 2)
+  800699:	83 f9 01             	cmp    $0x1,%ecx
+  80069c:	7f 16                	jg     8006b4 <vprintfmt+0x3d2>
+	else if (lflag)
+  80069e:	85 c9                	test   %ecx,%ecx
+  8006a0:	74 24                	je     8006c6 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8b 08                	mov    (%eax),%ecx
+  8006a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ad:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8006b2:	eb 57                	jmp    80070b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b7:	8b 08                	mov    (%eax),%ecx
+  8006b9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006bc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006bf:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006c4:	eb 45                	jmp    80070b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8b 08                	mov    (%eax),%ecx
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d1:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006d6:	eb 33                	jmp    80070b <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006d8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006db:	c1 e3 08             	shl    $0x8,%ebx
+  8006de:	83 ec 08             	sub    $0x8,%esp
+  8006e1:	ff 75 0c             	push   0xc(%ebp)
+  8006e4:	89 d8                	mov    %ebx,%eax
+  8006e6:	83 c8 30             	or     $0x30,%eax
+  8006e9:	50                   	push   %eax
+  8006ea:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006ec:	83 c4 08             	add    $0x8,%esp
+  8006ef:	ff 75 0c             	push   0xc(%ebp)
+  8006f2:	83 cb 78             	or     $0x78,%ebx
+  8006f5:	53                   	push   %ebx
+  8006f6:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006fd:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800700:	8d 40 04             	lea    0x4(%eax),%eax
+  800703:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800706:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80070b:	ff 75 e4             	push   -0x1c(%ebp)
+  80070e:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800712:	52                   	push   %edx
+  800713:	ff 75 e0             	push   -0x20(%ebp)
+  800716:	50                   	push   %eax
+  800717:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80071a:	89 f8                	mov    %edi,%eax
+  80071c:	e8 f7 fa ff ff       	call   800218 <printnum>
+			break;
+  800721:	83 c4 10             	add    $0x10,%esp
+  800724:	e9 e7 fb ff ff       	jmp    800310 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800729:	83 f9 01             	cmp    $0x1,%ecx
+  80072c:	7f 16                	jg     800744 <vprintfmt+0x462>
+	else if (lflag)
+  80072e:	85 c9                	test   %ecx,%ecx
+  800730:	74 24                	je     800756 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 08                	mov    (%eax),%ecx
+  800737:	8d 40 04             	lea    0x4(%eax),%eax
+  80073a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800742:	eb c7                	jmp    80070b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8b 08                	mov    (%eax),%ecx
+  800749:	8d 40 08             	lea    0x8(%eax),%eax
+  80074c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074f:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800754:	eb b5                	jmp    80070b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	8b 08                	mov    (%eax),%ecx
+  80075b:	8d 40 04             	lea    0x4(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800761:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800766:	eb a3                	jmp    80070b <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800768:	83 ec 08             	sub    $0x8,%esp
+  80076b:	ff 75 0c             	push   0xc(%ebp)
+  80076e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800771:	c1 e0 08             	shl    $0x8,%eax
+  800774:	83 c8 25             	or     $0x25,%eax
+  800777:	50                   	push   %eax
+  800778:	ff d7                	call   *%edi
+			break;
+  80077a:	83 c4 10             	add    $0x10,%esp
+  80077d:	e9 8e fb ff ff       	jmp    800310 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800782:	83 ec 08             	sub    $0x8,%esp
+  800785:	ff 75 0c             	push   0xc(%ebp)
+  800788:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80078b:	c1 e0 08             	shl    $0x8,%eax
+  80078e:	83 c8 25             	or     $0x25,%eax
+  800791:	50                   	push   %eax
+  800792:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800794:	83 c4 10             	add    $0x10,%esp
+  800797:	89 de                	mov    %ebx,%esi
+  800799:	eb 03                	jmp    80079e <vprintfmt+0x4bc>
+  80079b:	83 ee 01             	sub    $0x1,%esi
+  80079e:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007a2:	75 f7                	jne    80079b <vprintfmt+0x4b9>
+  8007a4:	e9 67 fb ff ff       	jmp    800310 <vprintfmt+0x2e>
+
+008007a9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007a9:	55                   	push   %ebp
+  8007aa:	89 e5                	mov    %esp,%ebp
+  8007ac:	83 ec 18             	sub    $0x18,%esp
+  8007af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007b5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007b8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007bc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007c6:	85 c0                	test   %eax,%eax
+  8007c8:	74 26                	je     8007f0 <vsnprintf+0x47>
+  8007ca:	85 d2                	test   %edx,%edx
+  8007cc:	7e 22                	jle    8007f0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007ce:	ff 75 14             	push   0x14(%ebp)
+  8007d1:	ff 75 10             	push   0x10(%ebp)
+  8007d4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007d7:	50                   	push   %eax
+  8007d8:	68 a8 02 80 00       	push   $0x8002a8
+  8007dd:	e8 00 fb ff ff       	call   8002e2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007e2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007e5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007eb:	83 c4 10             	add    $0x10,%esp
+}
+  8007ee:	c9                   	leave
+  8007ef:	c3                   	ret
+		return -E_INVAL;
+  8007f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007f5:	eb f7                	jmp    8007ee <vsnprintf+0x45>
+
+008007f7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007f7:	55                   	push   %ebp
+  8007f8:	89 e5                	mov    %esp,%ebp
+  8007fa:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007fd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800800:	50                   	push   %eax
+  800801:	ff 75 10             	push   0x10(%ebp)
+  800804:	ff 75 0c             	push   0xc(%ebp)
+  800807:	ff 75 08             	push   0x8(%ebp)
+  80080a:	e8 9a ff ff ff       	call   8007a9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80080f:	c9                   	leave
+  800810:	c3                   	ret
+
+00800811 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800811:	55                   	push   %ebp
+  800812:	89 e5                	mov    %esp,%ebp
+  800814:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081c:	eb 03                	jmp    800821 <strlen+0x10>
+		n++;
+  80081e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800821:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800825:	75 f7                	jne    80081e <strlen+0xd>
+	return n;
+}
+  800827:	5d                   	pop    %ebp
+  800828:	c3                   	ret
+
+00800829 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800829:	55                   	push   %ebp
+  80082a:	89 e5                	mov    %esp,%ebp
+  80082c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80082f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800832:	b8 00 00 00 00       	mov    $0x0,%eax
+  800837:	eb 03                	jmp    80083c <strnlen+0x13>
+		n++;
+  800839:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80083c:	39 d0                	cmp    %edx,%eax
+  80083e:	74 08                	je     800848 <strnlen+0x1f>
+  800840:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800844:	75 f3                	jne    800839 <strnlen+0x10>
+  800846:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800848:	89 d0                	mov    %edx,%eax
+  80084a:	5d                   	pop    %ebp
+  80084b:	c3                   	ret
+
+0080084c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80084c:	55                   	push   %ebp
+  80084d:	89 e5                	mov    %esp,%ebp
+  80084f:	53                   	push   %ebx
+  800850:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800853:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80085f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800862:	83 c0 01             	add    $0x1,%eax
+  800865:	84 d2                	test   %dl,%dl
+  800867:	75 f2                	jne    80085b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800869:	89 c8                	mov    %ecx,%eax
+  80086b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086e:	c9                   	leave
+  80086f:	c3                   	ret
+
+00800870 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800870:	55                   	push   %ebp
+  800871:	89 e5                	mov    %esp,%ebp
+  800873:	53                   	push   %ebx
+  800874:	83 ec 10             	sub    $0x10,%esp
+  800877:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80087a:	53                   	push   %ebx
+  80087b:	e8 91 ff ff ff       	call   800811 <strlen>
+  800880:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800883:	ff 75 0c             	push   0xc(%ebp)
+  800886:	01 d8                	add    %ebx,%eax
+  800888:	50                   	push   %eax
+  800889:	e8 be ff ff ff       	call   80084c <strcpy>
+	return dst;
+}
+  80088e:	89 d8                	mov    %ebx,%eax
+  800890:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800893:	c9                   	leave
+  800894:	c3                   	ret
+
+00800895 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	56                   	push   %esi
+  800899:	53                   	push   %ebx
+  80089a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008a0:	89 f3                	mov    %esi,%ebx
+  8008a2:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008a5:	89 f0                	mov    %esi,%eax
+  8008a7:	eb 0f                	jmp    8008b8 <strncpy+0x23>
+		*dst++ = *src;
+  8008a9:	83 c0 01             	add    $0x1,%eax
+  8008ac:	0f b6 0a             	movzbl (%edx),%ecx
+  8008af:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008b2:	80 f9 01             	cmp    $0x1,%cl
+  8008b5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008b8:	39 d8                	cmp    %ebx,%eax
+  8008ba:	75 ed                	jne    8008a9 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008bc:	89 f0                	mov    %esi,%eax
+  8008be:	5b                   	pop    %ebx
+  8008bf:	5e                   	pop    %esi
+  8008c0:	5d                   	pop    %ebp
+  8008c1:	c3                   	ret
+
+008008c2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	56                   	push   %esi
+  8008c6:	53                   	push   %ebx
+  8008c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008cd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008d0:	89 f0                	mov    %esi,%eax
+  8008d2:	85 d2                	test   %edx,%edx
+  8008d4:	74 21                	je     8008f7 <strlcpy+0x35>
+  8008d6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008da:	89 f2                	mov    %esi,%edx
+  8008dc:	eb 09                	jmp    8008e7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008de:	83 c1 01             	add    $0x1,%ecx
+  8008e1:	83 c2 01             	add    $0x1,%edx
+  8008e4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008e7:	39 c2                	cmp    %eax,%edx
+  8008e9:	74 09                	je     8008f4 <strlcpy+0x32>
+  8008eb:	0f b6 19             	movzbl (%ecx),%ebx
+  8008ee:	84 db                	test   %bl,%bl
+  8008f0:	75 ec                	jne    8008de <strlcpy+0x1c>
+  8008f2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008f4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008f7:	29 f0                	sub    %esi,%eax
+}
+  8008f9:	5b                   	pop    %ebx
+  8008fa:	5e                   	pop    %esi
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+
+008008fd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800903:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800906:	eb 06                	jmp    80090e <strcmp+0x11>
+		p++, q++;
+  800908:	83 c1 01             	add    $0x1,%ecx
+  80090b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80090e:	0f b6 01             	movzbl (%ecx),%eax
+  800911:	84 c0                	test   %al,%al
+  800913:	74 04                	je     800919 <strcmp+0x1c>
+  800915:	3a 02                	cmp    (%edx),%al
+  800917:	74 ef                	je     800908 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800919:	0f b6 c0             	movzbl %al,%eax
+  80091c:	0f b6 12             	movzbl (%edx),%edx
+  80091f:	29 d0                	sub    %edx,%eax
+}
+  800921:	5d                   	pop    %ebp
+  800922:	c3                   	ret
+
+00800923 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800923:	55                   	push   %ebp
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	53                   	push   %ebx
+  800927:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80092d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800930:	eb 09                	jmp    80093b <strncmp+0x18>
+		n--, p++, q++;
+  800932:	83 ea 01             	sub    $0x1,%edx
+  800935:	83 c0 01             	add    $0x1,%eax
+  800938:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80093b:	85 d2                	test   %edx,%edx
+  80093d:	74 18                	je     800957 <strncmp+0x34>
+  80093f:	0f b6 18             	movzbl (%eax),%ebx
+  800942:	84 db                	test   %bl,%bl
+  800944:	74 04                	je     80094a <strncmp+0x27>
+  800946:	3a 19                	cmp    (%ecx),%bl
+  800948:	74 e8                	je     800932 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80094a:	0f b6 00             	movzbl (%eax),%eax
+  80094d:	0f b6 11             	movzbl (%ecx),%edx
+  800950:	29 d0                	sub    %edx,%eax
+}
+  800952:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800955:	c9                   	leave
+  800956:	c3                   	ret
+		return 0;
+  800957:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095c:	eb f4                	jmp    800952 <strncmp+0x2f>
+
+0080095e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	8b 45 08             	mov    0x8(%ebp),%eax
+  800964:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800968:	eb 03                	jmp    80096d <strchr+0xf>
+  80096a:	83 c0 01             	add    $0x1,%eax
+  80096d:	0f b6 10             	movzbl (%eax),%edx
+  800970:	84 d2                	test   %dl,%dl
+  800972:	74 06                	je     80097a <strchr+0x1c>
+		if (*s == c)
+  800974:	38 ca                	cmp    %cl,%dl
+  800976:	75 f2                	jne    80096a <strchr+0xc>
+  800978:	eb 05                	jmp    80097f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80097a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80097f:	5d                   	pop    %ebp
+  800980:	c3                   	ret
+
+00800981 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800981:	55                   	push   %ebp
+  800982:	89 e5                	mov    %esp,%ebp
+  800984:	8b 45 08             	mov    0x8(%ebp),%eax
+  800987:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80098b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80098e:	38 ca                	cmp    %cl,%dl
+  800990:	74 09                	je     80099b <strfind+0x1a>
+  800992:	84 d2                	test   %dl,%dl
+  800994:	74 05                	je     80099b <strfind+0x1a>
+	for (; *s; s++)
+  800996:	83 c0 01             	add    $0x1,%eax
+  800999:	eb f0                	jmp    80098b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80099b:	5d                   	pop    %ebp
+  80099c:	c3                   	ret
+
+0080099d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80099d:	55                   	push   %ebp
+  80099e:	89 e5                	mov    %esp,%ebp
+  8009a0:	57                   	push   %edi
+  8009a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009a4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009a7:	85 c9                	test   %ecx,%ecx
+  8009a9:	74 20                	je     8009cb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009ab:	89 f8                	mov    %edi,%eax
+  8009ad:	09 c8                	or     %ecx,%eax
+  8009af:	a8 03                	test   $0x3,%al
+  8009b1:	75 12                	jne    8009c5 <memset+0x28>
+		c &= 0xFF;
+  8009b3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009b7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009bd:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009c0:	fc                   	cld
+  8009c1:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009c3:	eb 06                	jmp    8009cb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009c8:	fc                   	cld
+  8009c9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009cb:	89 f8                	mov    %edi,%eax
+  8009cd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009d0:	c9                   	leave
+  8009d1:	c3                   	ret
+
+008009d2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	57                   	push   %edi
+  8009d6:	56                   	push   %esi
+  8009d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009dd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009e0:	39 c6                	cmp    %eax,%esi
+  8009e2:	73 32                	jae    800a16 <memmove+0x44>
+  8009e4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009e7:	39 d0                	cmp    %edx,%eax
+  8009e9:	73 2b                	jae    800a16 <memmove+0x44>
+		s += n;
+		d += n;
+  8009eb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ee:	89 d6                	mov    %edx,%esi
+  8009f0:	09 fe                	or     %edi,%esi
+  8009f2:	09 ce                	or     %ecx,%esi
+  8009f4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009fa:	75 0e                	jne    800a0a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009fc:	83 ef 04             	sub    $0x4,%edi
+  8009ff:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a02:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a05:	fd                   	std
+  800a06:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a08:	eb 09                	jmp    800a13 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a0a:	83 ef 01             	sub    $0x1,%edi
+  800a0d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a10:	fd                   	std
+  800a11:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a13:	fc                   	cld
+  800a14:	eb 1a                	jmp    800a30 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a16:	89 f2                	mov    %esi,%edx
+  800a18:	09 c2                	or     %eax,%edx
+  800a1a:	09 ca                	or     %ecx,%edx
+  800a1c:	f6 c2 03             	test   $0x3,%dl
+  800a1f:	75 0a                	jne    800a2b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a21:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a24:	89 c7                	mov    %eax,%edi
+  800a26:	fc                   	cld
+  800a27:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a29:	eb 05                	jmp    800a30 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a2b:	89 c7                	mov    %eax,%edi
+  800a2d:	fc                   	cld
+  800a2e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a30:	5e                   	pop    %esi
+  800a31:	5f                   	pop    %edi
+  800a32:	5d                   	pop    %ebp
+  800a33:	c3                   	ret
+
+00800a34 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a34:	55                   	push   %ebp
+  800a35:	89 e5                	mov    %esp,%ebp
+  800a37:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a3a:	ff 75 10             	push   0x10(%ebp)
+  800a3d:	ff 75 0c             	push   0xc(%ebp)
+  800a40:	ff 75 08             	push   0x8(%ebp)
+  800a43:	e8 8a ff ff ff       	call   8009d2 <memmove>
+}
+  800a48:	c9                   	leave
+  800a49:	c3                   	ret
+
+00800a4a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a4a:	55                   	push   %ebp
+  800a4b:	89 e5                	mov    %esp,%ebp
+  800a4d:	56                   	push   %esi
+  800a4e:	53                   	push   %ebx
+  800a4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a52:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a55:	89 c6                	mov    %eax,%esi
+  800a57:	03 75 10             	add    0x10(%ebp),%esi
+  800a5a:	eb 06                	jmp    800a62 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a5c:	83 c0 01             	add    $0x1,%eax
+  800a5f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a62:	39 f0                	cmp    %esi,%eax
+  800a64:	74 14                	je     800a7a <memcmp+0x30>
+		if (*s1 != *s2)
+  800a66:	0f b6 08             	movzbl (%eax),%ecx
+  800a69:	0f b6 1a             	movzbl (%edx),%ebx
+  800a6c:	38 d9                	cmp    %bl,%cl
+  800a6e:	74 ec                	je     800a5c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a70:	0f b6 c1             	movzbl %cl,%eax
+  800a73:	0f b6 db             	movzbl %bl,%ebx
+  800a76:	29 d8                	sub    %ebx,%eax
+  800a78:	eb 05                	jmp    800a7f <memcmp+0x35>
+	}
+
+	return 0;
+  800a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a7f:	5b                   	pop    %ebx
+  800a80:	5e                   	pop    %esi
+  800a81:	5d                   	pop    %ebp
+  800a82:	c3                   	ret
+
+00800a83 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a83:	55                   	push   %ebp
+  800a84:	89 e5                	mov    %esp,%ebp
+  800a86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a8c:	89 c2                	mov    %eax,%edx
+  800a8e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a91:	eb 03                	jmp    800a96 <memfind+0x13>
+  800a93:	83 c0 01             	add    $0x1,%eax
+  800a96:	39 d0                	cmp    %edx,%eax
+  800a98:	73 04                	jae    800a9e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a9a:	38 08                	cmp    %cl,(%eax)
+  800a9c:	75 f5                	jne    800a93 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	57                   	push   %edi
+  800aa4:	56                   	push   %esi
+  800aa5:	53                   	push   %ebx
+  800aa6:	83 ec 1c             	sub    $0x1c,%esp
+  800aa9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aac:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aaf:	eb 03                	jmp    800ab4 <strtol+0x14>
+		s++;
+  800ab1:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800ab4:	0f b6 06             	movzbl (%esi),%eax
+  800ab7:	3c 20                	cmp    $0x20,%al
+  800ab9:	74 f6                	je     800ab1 <strtol+0x11>
+  800abb:	3c 09                	cmp    $0x9,%al
+  800abd:	74 f2                	je     800ab1 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800abf:	3c 2b                	cmp    $0x2b,%al
+  800ac1:	74 43                	je     800b06 <strtol+0x66>
+	int neg = 0;
+  800ac3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800ac8:	3c 2d                	cmp    $0x2d,%al
+  800aca:	74 44                	je     800b10 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800acc:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ad2:	75 0f                	jne    800ae3 <strtol+0x43>
+  800ad4:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ad7:	74 41                	je     800b1a <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ad9:	85 ff                	test   %edi,%edi
+  800adb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ae0:	0f 44 f8             	cmove  %eax,%edi
+  800ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae8:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800aed:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800af0:	89 fb                	mov    %edi,%ebx
+  800af2:	c1 fb 1f             	sar    $0x1f,%ebx
+  800af5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800af8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800afb:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800afe:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b01:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b04:	eb 67                	jmp    800b6d <strtol+0xcd>
+		s++;
+  800b06:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b09:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b0e:	eb bc                	jmp    800acc <strtol+0x2c>
+		s++, neg = 1;
+  800b10:	83 c6 01             	add    $0x1,%esi
+  800b13:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b18:	eb b2                	jmp    800acc <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b1a:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b1e:	74 0e                	je     800b2e <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b20:	85 ff                	test   %edi,%edi
+  800b22:	75 bf                	jne    800ae3 <strtol+0x43>
+		s++, base = 8;
+  800b24:	83 c6 01             	add    $0x1,%esi
+  800b27:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b2c:	eb b5                	jmp    800ae3 <strtol+0x43>
+		s += 2, base = 16;
+  800b2e:	83 c6 02             	add    $0x2,%esi
+  800b31:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b36:	eb ab                	jmp    800ae3 <strtol+0x43>
+			dig = *s - '0';
+  800b38:	0f be c9             	movsbl %cl,%ecx
+  800b3b:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b3e:	39 f9                	cmp    %edi,%ecx
+  800b40:	7d 59                	jge    800b9b <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b42:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b46:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b49:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b4c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b4f:	0f af d8             	imul   %eax,%ebx
+  800b52:	0f af d7             	imul   %edi,%edx
+  800b55:	01 d3                	add    %edx,%ebx
+  800b57:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b5a:	f7 e7                	mul    %edi
+  800b5c:	01 da                	add    %ebx,%edx
+  800b5e:	89 cb                	mov    %ecx,%ebx
+  800b60:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b63:	01 c8                	add    %ecx,%eax
+  800b65:	11 da                	adc    %ebx,%edx
+  800b67:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b6a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b70:	0f b6 08             	movzbl (%eax),%ecx
+  800b73:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b76:	80 fb 09             	cmp    $0x9,%bl
+  800b79:	76 bd                	jbe    800b38 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b7b:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b7e:	80 fb 19             	cmp    $0x19,%bl
+  800b81:	77 08                	ja     800b8b <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b83:	0f be c9             	movsbl %cl,%ecx
+  800b86:	83 e9 57             	sub    $0x57,%ecx
+  800b89:	eb b3                	jmp    800b3e <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b8b:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b8e:	80 fb 19             	cmp    $0x19,%bl
+  800b91:	77 08                	ja     800b9b <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b93:	0f be c9             	movsbl %cl,%ecx
+  800b96:	83 e9 37             	sub    $0x37,%ecx
+  800b99:	eb a3                	jmp    800b3e <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b9b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b9e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ba1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800ba4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ba7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bab:	74 05                	je     800bb2 <strtol+0x112>
+		*endptr = (char *) s;
+  800bad:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bb0:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800bb2:	85 c9                	test   %ecx,%ecx
+  800bb4:	74 07                	je     800bbd <strtol+0x11d>
+  800bb6:	f7 d8                	neg    %eax
+  800bb8:	83 d2 00             	adc    $0x0,%edx
+  800bbb:	f7 da                	neg    %edx
+}
+  800bbd:	83 c4 1c             	add    $0x1c,%esp
+  800bc0:	5b                   	pop    %ebx
+  800bc1:	5e                   	pop    %esi
+  800bc2:	5f                   	pop    %edi
+  800bc3:	5d                   	pop    %ebp
+  800bc4:	c3                   	ret
+
+00800bc5 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	57                   	push   %edi
+  800bc9:	56                   	push   %esi
+  800bca:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bcb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bd2:	74 18                	je     800bec <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bdf:	89 c3                	mov    %eax,%ebx
+  800be1:	89 c7                	mov    %eax,%edi
+  800be3:	89 c6                	mov    %eax,%esi
+  800be5:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800be7:	5b                   	pop    %ebx
+  800be8:	5e                   	pop    %esi
+  800be9:	5f                   	pop    %edi
+  800bea:	5d                   	pop    %ebp
+  800beb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf7:	89 c3                	mov    %eax,%ebx
+  800bf9:	89 c7                	mov    %eax,%edi
+  800bfb:	55                   	push   %ebp
+  800bfc:	89 e5                	mov    %esp,%ebp
+  800bfe:	8d 35 06 0c 80 00    	lea    0x800c06,%esi
+  800c04:	0f 34                	sysenter
+  800c06:	5d                   	pop    %ebp
+		goto out;
+  800c07:	eb de                	jmp    800be7 <sys_cputs+0x22>
+
+00800c09 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	57                   	push   %edi
+  800c0d:	56                   	push   %esi
+  800c0e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c0f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c16:	74 19                	je     800c31 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c22:	89 d1                	mov    %edx,%ecx
+  800c24:	89 d3                	mov    %edx,%ebx
+  800c26:	89 d7                	mov    %edx,%edi
+  800c28:	89 d6                	mov    %edx,%esi
+  800c2a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c2c:	5b                   	pop    %ebx
+  800c2d:	5e                   	pop    %esi
+  800c2e:	5f                   	pop    %edi
+  800c2f:	5d                   	pop    %ebp
+  800c30:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c36:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c3b:	89 d1                	mov    %edx,%ecx
+  800c3d:	89 d3                	mov    %edx,%ebx
+  800c3f:	89 d7                	mov    %edx,%edi
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	8d 35 4c 0c 80 00    	lea    0x800c4c,%esi
+  800c4a:	0f 34                	sysenter
+  800c4c:	5d                   	pop    %ebp
+		goto out;
+  800c4d:	eb dd                	jmp    800c2c <sys_cgetc+0x23>
+
+00800c4f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c4f:	55                   	push   %ebp
+  800c50:	89 e5                	mov    %esp,%ebp
+  800c52:	57                   	push   %edi
+  800c53:	56                   	push   %esi
+  800c54:	53                   	push   %ebx
+  800c55:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c58:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c5f:	74 21                	je     800c82 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c66:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6e:	89 cb                	mov    %ecx,%ebx
+  800c70:	89 cf                	mov    %ecx,%edi
+  800c72:	89 ce                	mov    %ecx,%esi
+  800c74:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c76:	85 c0                	test   %eax,%eax
+  800c78:	7f 27                	jg     800ca1 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7d:	5b                   	pop    %ebx
+  800c7e:	5e                   	pop    %esi
+  800c7f:	5f                   	pop    %edi
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c8f:	89 cb                	mov    %ecx,%ebx
+  800c91:	89 cf                	mov    %ecx,%edi
+  800c93:	55                   	push   %ebp
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	8d 35 9e 0c 80 00    	lea    0x800c9e,%esi
+  800c9c:	0f 34                	sysenter
+  800c9e:	5d                   	pop    %ebp
+		goto out;
+  800c9f:	eb d5                	jmp    800c76 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca1:	83 ec 0c             	sub    $0xc,%esp
+  800ca4:	50                   	push   %eax
+  800ca5:	6a 03                	push   $0x3
+  800ca7:	68 eb 2e 80 00       	push   $0x802eeb
+  800cac:	6a 3f                	push   $0x3f
+  800cae:	68 08 2f 80 00       	push   $0x802f08
+  800cb3:	e8 71 f4 ff ff       	call   800129 <_panic>
+
+00800cb8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	57                   	push   %edi
+  800cbc:	56                   	push   %esi
+  800cbd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cbe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cc5:	74 19                	je     800ce0 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800cc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccc:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd1:	89 d1                	mov    %edx,%ecx
+  800cd3:	89 d3                	mov    %edx,%ebx
+  800cd5:	89 d7                	mov    %edx,%edi
+  800cd7:	89 d6                	mov    %edx,%esi
+  800cd9:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ce0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cea:	89 d1                	mov    %edx,%ecx
+  800cec:	89 d3                	mov    %edx,%ebx
+  800cee:	89 d7                	mov    %edx,%edi
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	8d 35 fb 0c 80 00    	lea    0x800cfb,%esi
+  800cf9:	0f 34                	sysenter
+  800cfb:	5d                   	pop    %ebp
+		goto out;
+  800cfc:	eb dd                	jmp    800cdb <sys_getenvid+0x23>
+
+00800cfe <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cfe:	55                   	push   %ebp
+  800cff:	89 e5                	mov    %esp,%ebp
+  800d01:	57                   	push   %edi
+  800d02:	56                   	push   %esi
+  800d03:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d04:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d0b:	74 19                	je     800d26 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d12:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d17:	89 d1                	mov    %edx,%ecx
+  800d19:	89 d3                	mov    %edx,%ebx
+  800d1b:	89 d7                	mov    %edx,%edi
+  800d1d:	89 d6                	mov    %edx,%esi
+  800d1f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d21:	5b                   	pop    %ebx
+  800d22:	5e                   	pop    %esi
+  800d23:	5f                   	pop    %edi
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d26:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d30:	89 d1                	mov    %edx,%ecx
+  800d32:	89 d3                	mov    %edx,%ebx
+  800d34:	89 d7                	mov    %edx,%edi
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	8d 35 41 0d 80 00    	lea    0x800d41,%esi
+  800d3f:	0f 34                	sysenter
+  800d41:	5d                   	pop    %ebp
+		goto out;
+  800d42:	eb dd                	jmp    800d21 <sys_yield+0x23>
+
+00800d44 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d44:	55                   	push   %ebp
+  800d45:	89 e5                	mov    %esp,%ebp
+  800d47:	57                   	push   %edi
+  800d48:	56                   	push   %esi
+  800d49:	53                   	push   %ebx
+  800d4a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d4d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d54:	74 23                	je     800d79 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d56:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d69:	89 f7                	mov    %esi,%edi
+  800d6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d6d:	85 c0                	test   %eax,%eax
+  800d6f:	7f 29                	jg     800d9a <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d74:	5b                   	pop    %ebx
+  800d75:	5e                   	pop    %esi
+  800d76:	5f                   	pop    %edi
+  800d77:	5d                   	pop    %ebp
+  800d78:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d84:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	8d 35 97 0d 80 00    	lea    0x800d97,%esi
+  800d95:	0f 34                	sysenter
+  800d97:	5d                   	pop    %ebp
+		goto out;
+  800d98:	eb d3                	jmp    800d6d <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+  800d9d:	50                   	push   %eax
+  800d9e:	6a 04                	push   $0x4
+  800da0:	68 eb 2e 80 00       	push   $0x802eeb
+  800da5:	6a 3f                	push   $0x3f
+  800da7:	68 08 2f 80 00       	push   $0x802f08
+  800dac:	e8 78 f3 ff ff       	call   800129 <_panic>
+
+00800db1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	56                   	push   %esi
+  800db6:	53                   	push   %ebx
+  800db7:	83 ec 0c             	sub    $0xc,%esp
+  800dba:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800dbd:	85 f6                	test   %esi,%esi
+  800dbf:	75 09                	jne    800dca <sys_page_map+0x19>
+  800dc1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dc8:	74 1f                	je     800de9 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800dca:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ddb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	7f 27                	jg     800e08 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800de9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800def:	b8 05 00 00 00       	mov    $0x5,%eax
+  800df4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	8d 35 05 0e 80 00    	lea    0x800e05,%esi
+  800e03:	0f 34                	sysenter
+  800e05:	5d                   	pop    %ebp
+		goto out;
+  800e06:	eb d5                	jmp    800ddd <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e08:	83 ec 0c             	sub    $0xc,%esp
+  800e0b:	50                   	push   %eax
+  800e0c:	6a 05                	push   $0x5
+  800e0e:	68 eb 2e 80 00       	push   $0x802eeb
+  800e13:	6a 3f                	push   $0x3f
+  800e15:	68 08 2f 80 00       	push   $0x802f08
+  800e1a:	e8 0a f3 ff ff       	call   800129 <_panic>
+
+00800e1f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+  800e25:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e28:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e2f:	74 22                	je     800e53 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e36:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e41:	89 df                	mov    %ebx,%edi
+  800e43:	89 de                	mov    %ebx,%esi
+  800e45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 28                	jg     800e73 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e63:	89 df                	mov    %ebx,%edi
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	8d 35 70 0e 80 00    	lea    0x800e70,%esi
+  800e6e:	0f 34                	sysenter
+  800e70:	5d                   	pop    %ebp
+		goto out;
+  800e71:	eb d4                	jmp    800e47 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e73:	83 ec 0c             	sub    $0xc,%esp
+  800e76:	50                   	push   %eax
+  800e77:	6a 06                	push   $0x6
+  800e79:	68 eb 2e 80 00       	push   $0x802eeb
+  800e7e:	6a 3f                	push   $0x3f
+  800e80:	68 08 2f 80 00       	push   $0x802f08
+  800e85:	e8 9f f2 ff ff       	call   800129 <_panic>
+
+00800e8a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	53                   	push   %ebx
+  800e90:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e93:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e9a:	74 22                	je     800ebe <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ea6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eac:	89 df                	mov    %ebx,%edi
+  800eae:	89 de                	mov    %ebx,%esi
+  800eb0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	7f 28                	jg     800ede <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ebe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec9:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ece:	89 df                	mov    %ebx,%edi
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	8d 35 db 0e 80 00    	lea    0x800edb,%esi
+  800ed9:	0f 34                	sysenter
+  800edb:	5d                   	pop    %ebp
+		goto out;
+  800edc:	eb d4                	jmp    800eb2 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ede:	83 ec 0c             	sub    $0xc,%esp
+  800ee1:	50                   	push   %eax
+  800ee2:	6a 08                	push   $0x8
+  800ee4:	68 eb 2e 80 00       	push   $0x802eeb
+  800ee9:	6a 3f                	push   $0x3f
+  800eeb:	68 08 2f 80 00       	push   $0x802f08
+  800ef0:	e8 34 f2 ff ff       	call   800129 <_panic>
+
+00800ef5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800efe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f05:	74 22                	je     800f29 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f17:	89 df                	mov    %ebx,%edi
+  800f19:	89 de                	mov    %ebx,%esi
+  800f1b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	7f 28                	jg     800f49 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f24:	5b                   	pop    %ebx
+  800f25:	5e                   	pop    %esi
+  800f26:	5f                   	pop    %edi
+  800f27:	5d                   	pop    %ebp
+  800f28:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f34:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f39:	89 df                	mov    %ebx,%edi
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	8d 35 46 0f 80 00    	lea    0x800f46,%esi
+  800f44:	0f 34                	sysenter
+  800f46:	5d                   	pop    %ebp
+		goto out;
+  800f47:	eb d4                	jmp    800f1d <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f49:	83 ec 0c             	sub    $0xc,%esp
+  800f4c:	50                   	push   %eax
+  800f4d:	6a 09                	push   $0x9
+  800f4f:	68 eb 2e 80 00       	push   $0x802eeb
+  800f54:	6a 3f                	push   $0x3f
+  800f56:	68 08 2f 80 00       	push   $0x802f08
+  800f5b:	e8 c9 f1 ff ff       	call   800129 <_panic>
+
+00800f60 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	57                   	push   %edi
+  800f64:	56                   	push   %esi
+  800f65:	53                   	push   %ebx
+  800f66:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f69:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f70:	74 22                	je     800f94 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f77:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f82:	89 df                	mov    %ebx,%edi
+  800f84:	89 de                	mov    %ebx,%esi
+  800f86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f88:	85 c0                	test   %eax,%eax
+  800f8a:	7f 28                	jg     800fb4 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa4:	89 df                	mov    %ebx,%edi
+  800fa6:	55                   	push   %ebp
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	8d 35 b1 0f 80 00    	lea    0x800fb1,%esi
+  800faf:	0f 34                	sysenter
+  800fb1:	5d                   	pop    %ebp
+		goto out;
+  800fb2:	eb d4                	jmp    800f88 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+  800fb7:	50                   	push   %eax
+  800fb8:	6a 0a                	push   $0xa
+  800fba:	68 eb 2e 80 00       	push   $0x802eeb
+  800fbf:	6a 3f                	push   $0x3f
+  800fc1:	68 08 2f 80 00       	push   $0x802f08
+  800fc6:	e8 5e f1 ff ff       	call   800129 <_panic>
+
+00800fcb <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fd4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fdb:	74 22                	je     800fff <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe2:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fe7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fed:	89 df                	mov    %ebx,%edi
+  800fef:	89 de                	mov    %ebx,%esi
+  800ff1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff3:	85 c0                	test   %eax,%eax
+  800ff5:	7f 28                	jg     80101f <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800ff7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffa:	5b                   	pop    %ebx
+  800ffb:	5e                   	pop    %esi
+  800ffc:	5f                   	pop    %edi
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801004:	8b 55 08             	mov    0x8(%ebp),%edx
+  801007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80100f:	89 df                	mov    %ebx,%edi
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	8d 35 1c 10 80 00    	lea    0x80101c,%esi
+  80101a:	0f 34                	sysenter
+  80101c:	5d                   	pop    %ebp
+		goto out;
+  80101d:	eb d4                	jmp    800ff3 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101f:	83 ec 0c             	sub    $0xc,%esp
+  801022:	50                   	push   %eax
+  801023:	6a 17                	push   $0x17
+  801025:	68 eb 2e 80 00       	push   $0x802eeb
+  80102a:	6a 3f                	push   $0x3f
+  80102c:	68 08 2f 80 00       	push   $0x802f08
+  801031:	e8 f3 f0 ff ff       	call   800129 <_panic>
+
+00801036 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	57                   	push   %edi
+  80103a:	56                   	push   %esi
+  80103b:	53                   	push   %ebx
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80103f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801046:	74 22                	je     80106a <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801048:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801052:	8b 55 08             	mov    0x8(%ebp),%edx
+  801055:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801058:	89 df                	mov    %ebx,%edi
+  80105a:	89 de                	mov    %ebx,%esi
+  80105c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105e:	85 c0                	test   %eax,%eax
+  801060:	7f 28                	jg     80108a <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801062:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801065:	5b                   	pop    %ebx
+  801066:	5e                   	pop    %esi
+  801067:	5f                   	pop    %edi
+  801068:	5d                   	pop    %ebp
+  801069:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80106a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	b8 18 00 00 00       	mov    $0x18,%eax
+  80107a:	89 df                	mov    %ebx,%edi
+  80107c:	55                   	push   %ebp
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	8d 35 87 10 80 00    	lea    0x801087,%esi
+  801085:	0f 34                	sysenter
+  801087:	5d                   	pop    %ebp
+		goto out;
+  801088:	eb d4                	jmp    80105e <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+  80108d:	50                   	push   %eax
+  80108e:	6a 18                	push   $0x18
+  801090:	68 eb 2e 80 00       	push   $0x802eeb
+  801095:	6a 3f                	push   $0x3f
+  801097:	68 08 2f 80 00       	push   $0x802f08
+  80109c:	e8 88 f0 ff ff       	call   800129 <_panic>
+
+008010a1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010a7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010ae:	74 1d                	je     8010cd <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8010b0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010c8:	5b                   	pop    %ebx
+  8010c9:	5e                   	pop    %esi
+  8010ca:	5f                   	pop    %edi
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010db:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	8d 35 e9 10 80 00    	lea    0x8010e9,%esi
+  8010e7:	0f 34                	sysenter
+  8010e9:	5d                   	pop    %ebp
+		goto out;
+  8010ea:	eb dc                	jmp    8010c8 <sys_ipc_try_send+0x27>
+
+008010ec <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010ec:	55                   	push   %ebp
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	57                   	push   %edi
+  8010f0:	56                   	push   %esi
+  8010f1:	53                   	push   %ebx
+  8010f2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010fc:	74 21                	je     80111f <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801103:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801108:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110b:	89 cb                	mov    %ecx,%ebx
+  80110d:	89 cf                	mov    %ecx,%edi
+  80110f:	89 ce                	mov    %ecx,%esi
+  801111:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801113:	85 c0                	test   %eax,%eax
+  801115:	7f 27                	jg     80113e <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801117:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111a:	5b                   	pop    %ebx
+  80111b:	5e                   	pop    %esi
+  80111c:	5f                   	pop    %edi
+  80111d:	5d                   	pop    %ebp
+  80111e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801127:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80112c:	89 cb                	mov    %ecx,%ebx
+  80112e:	89 cf                	mov    %ecx,%edi
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	8d 35 3b 11 80 00    	lea    0x80113b,%esi
+  801139:	0f 34                	sysenter
+  80113b:	5d                   	pop    %ebp
+		goto out;
+  80113c:	eb d5                	jmp    801113 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+  801141:	50                   	push   %eax
+  801142:	6a 0d                	push   $0xd
+  801144:	68 eb 2e 80 00       	push   $0x802eeb
+  801149:	6a 3f                	push   $0x3f
+  80114b:	68 08 2f 80 00       	push   $0x802f08
+  801150:	e8 d4 ef ff ff       	call   800129 <_panic>
+
+00801155 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80115b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801162:	74 1b                	je     80117f <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801164:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801169:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80116e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801171:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801174:	89 df                	mov    %ebx,%edi
+  801176:	89 de                	mov    %ebx,%esi
+  801178:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80117a:	5b                   	pop    %ebx
+  80117b:	5e                   	pop    %esi
+  80117c:	5f                   	pop    %edi
+  80117d:	5d                   	pop    %ebp
+  80117e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80117f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80118f:	89 df                	mov    %ebx,%edi
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	8d 35 9c 11 80 00    	lea    0x80119c,%esi
+  80119a:	0f 34                	sysenter
+  80119c:	5d                   	pop    %ebp
+		goto out;
+  80119d:	eb db                	jmp    80117a <sys_ipc_recv_until+0x25>
+
+0080119f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	56                   	push   %esi
+  8011a4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011a5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011ac:	74 19                	je     8011c7 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8011ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011b8:	89 d1                	mov    %edx,%ecx
+  8011ba:	89 d3                	mov    %edx,%ebx
+  8011bc:	89 d7                	mov    %edx,%edi
+  8011be:	89 d6                	mov    %edx,%esi
+  8011c0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011c2:	5b                   	pop    %ebx
+  8011c3:	5e                   	pop    %esi
+  8011c4:	5f                   	pop    %edi
+  8011c5:	5d                   	pop    %ebp
+  8011c6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011cc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d1:	89 d1                	mov    %edx,%ecx
+  8011d3:	89 d3                	mov    %edx,%ebx
+  8011d5:	89 d7                	mov    %edx,%edi
+  8011d7:	55                   	push   %ebp
+  8011d8:	89 e5                	mov    %esp,%ebp
+  8011da:	8d 35 e2 11 80 00    	lea    0x8011e2,%esi
+  8011e0:	0f 34                	sysenter
+  8011e2:	5d                   	pop    %ebp
+		goto out;
+  8011e3:	eb dd                	jmp    8011c2 <sys_time_msec+0x23>
+
+008011e5 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	57                   	push   %edi
+  8011e9:	56                   	push   %esi
+  8011ea:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011eb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011f2:	74 1a                	je     80120e <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f9:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801201:	89 cb                	mov    %ecx,%ebx
+  801203:	89 cf                	mov    %ecx,%edi
+  801205:	89 ce                	mov    %ecx,%esi
+  801207:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801209:	5b                   	pop    %ebx
+  80120a:	5e                   	pop    %esi
+  80120b:	5f                   	pop    %edi
+  80120c:	5d                   	pop    %ebp
+  80120d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80120e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801211:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801216:	b8 10 00 00 00       	mov    $0x10,%eax
+  80121b:	89 cb                	mov    %ecx,%ebx
+  80121d:	89 cf                	mov    %ecx,%edi
+  80121f:	55                   	push   %ebp
+  801220:	89 e5                	mov    %esp,%ebp
+  801222:	8d 35 2a 12 80 00    	lea    0x80122a,%esi
+  801228:	0f 34                	sysenter
+  80122a:	5d                   	pop    %ebp
+		goto out;
+  80122b:	eb dc                	jmp    801209 <sys_sleep_until+0x24>
+
+0080122d <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80122d:	55                   	push   %ebp
+  80122e:	89 e5                	mov    %esp,%ebp
+  801230:	57                   	push   %edi
+  801231:	56                   	push   %esi
+  801232:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801233:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80123a:	74 1a                	je     801256 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80123c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801241:	b8 11 00 00 00       	mov    $0x11,%eax
+  801246:	8b 55 08             	mov    0x8(%ebp),%edx
+  801249:	89 cb                	mov    %ecx,%ebx
+  80124b:	89 cf                	mov    %ecx,%edi
+  80124d:	89 ce                	mov    %ecx,%esi
+  80124f:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801251:	5b                   	pop    %ebx
+  801252:	5e                   	pop    %esi
+  801253:	5f                   	pop    %edi
+  801254:	5d                   	pop    %ebp
+  801255:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801256:	8b 55 08             	mov    0x8(%ebp),%edx
+  801259:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80125e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801263:	89 cb                	mov    %ecx,%ebx
+  801265:	89 cf                	mov    %ecx,%edi
+  801267:	55                   	push   %ebp
+  801268:	89 e5                	mov    %esp,%ebp
+  80126a:	8d 35 72 12 80 00    	lea    0x801272,%esi
+  801270:	0f 34                	sysenter
+  801272:	5d                   	pop    %ebp
+		goto out;
+  801273:	eb dc                	jmp    801251 <sys_env_print_stats+0x24>
+
+00801275 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801275:	55                   	push   %ebp
+  801276:	89 e5                	mov    %esp,%ebp
+  801278:	57                   	push   %edi
+  801279:	56                   	push   %esi
+  80127a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80127b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801282:	74 1b                	je     80129f <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801284:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801289:	b8 19 00 00 00       	mov    $0x19,%eax
+  80128e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801291:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801294:	89 df                	mov    %ebx,%edi
+  801296:	89 de                	mov    %ebx,%esi
+  801298:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80129f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012aa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012af:	89 df                	mov    %ebx,%edi
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	8d 35 bc 12 80 00    	lea    0x8012bc,%esi
+  8012ba:	0f 34                	sysenter
+  8012bc:	5d                   	pop    %ebp
+		goto out;
+  8012bd:	eb db                	jmp    80129a <sys_perf+0x25>
+
+008012bf <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	57                   	push   %edi
+  8012c3:	56                   	push   %esi
+  8012c4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012c5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012cc:	74 19                	je     8012e7 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012d8:	89 d1                	mov    %edx,%ecx
+  8012da:	89 d3                	mov    %edx,%ebx
+  8012dc:	89 d7                	mov    %edx,%edi
+  8012de:	89 d6                	mov    %edx,%esi
+  8012e0:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012e2:	5b                   	pop    %ebx
+  8012e3:	5e                   	pop    %esi
+  8012e4:	5f                   	pop    %edi
+  8012e5:	5d                   	pop    %ebp
+  8012e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ec:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012f1:	89 d1                	mov    %edx,%ecx
+  8012f3:	89 d3                	mov    %edx,%ebx
+  8012f5:	89 d7                	mov    %edx,%edi
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	8d 35 02 13 80 00    	lea    0x801302,%esi
+  801300:	0f 34                	sysenter
+  801302:	5d                   	pop    %ebp
+		goto out;
+  801303:	eb dd                	jmp    8012e2 <sys_fork+0x23>
+
+00801305 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	57                   	push   %edi
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80130b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801312:	74 1c                	je     801330 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801314:	be 00 00 00 00       	mov    $0x0,%esi
+  801319:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80131e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801321:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801324:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801327:	89 f7                	mov    %esi,%edi
+  801329:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80132b:	5b                   	pop    %ebx
+  80132c:	5e                   	pop    %esi
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801330:	8b 55 08             	mov    0x8(%ebp),%edx
+  801333:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801336:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80133b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801340:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801343:	55                   	push   %ebp
+  801344:	89 e5                	mov    %esp,%ebp
+  801346:	8d 35 4e 13 80 00    	lea    0x80134e,%esi
+  80134c:	0f 34                	sysenter
+  80134e:	5d                   	pop    %ebp
+		goto out;
+  80134f:	eb da                	jmp    80132b <sys_thread_create+0x26>
+
+00801351 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	57                   	push   %edi
+  801355:	56                   	push   %esi
+  801356:	53                   	push   %ebx
+  801357:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80135a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801361:	74 24                	je     801387 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801363:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801368:	be 00 00 00 00       	mov    $0x0,%esi
+  80136d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801370:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801373:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801376:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801379:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80137b:	85 c0                	test   %eax,%eax
+  80137d:	7f 27                	jg     8013a6 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80137f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801382:	5b                   	pop    %ebx
+  801383:	5e                   	pop    %esi
+  801384:	5f                   	pop    %edi
+  801385:	5d                   	pop    %ebp
+  801386:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801387:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801392:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801395:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  80139b:	8d 35 a3 13 80 00    	lea    0x8013a3,%esi
+  8013a1:	0f 34                	sysenter
+  8013a3:	5d                   	pop    %ebp
+		goto out;
+  8013a4:	eb d5                	jmp    80137b <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013a6:	83 ec 0c             	sub    $0xc,%esp
+  8013a9:	50                   	push   %eax
+  8013aa:	6a 1f                	push   $0x1f
+  8013ac:	68 eb 2e 80 00       	push   $0x802eeb
+  8013b1:	6a 3f                	push   $0x3f
+  8013b3:	68 08 2f 80 00       	push   $0x802f08
+  8013b8:	e8 6c ed ff ff       	call   800129 <_panic>
+
+008013bd <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013bd:	55                   	push   %ebp
+  8013be:	89 e5                	mov    %esp,%ebp
+  8013c0:	57                   	push   %edi
+  8013c1:	56                   	push   %esi
+  8013c2:	53                   	push   %ebx
+  8013c3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013c6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013cd:	74 23                	je     8013f2 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e2:	89 f7                	mov    %esi,%edi
+  8013e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013e6:	85 c0                	test   %eax,%eax
+  8013e8:	7f 29                	jg     801413 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ed:	5b                   	pop    %ebx
+  8013ee:	5e                   	pop    %esi
+  8013ef:	5f                   	pop    %edi
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801402:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801405:	55                   	push   %ebp
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	8d 35 10 14 80 00    	lea    0x801410,%esi
+  80140e:	0f 34                	sysenter
+  801410:	5d                   	pop    %ebp
+		goto out;
+  801411:	eb d3                	jmp    8013e6 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801413:	83 ec 0c             	sub    $0xc,%esp
+  801416:	50                   	push   %eax
+  801417:	6a 20                	push   $0x20
+  801419:	68 eb 2e 80 00       	push   $0x802eeb
+  80141e:	6a 3f                	push   $0x3f
+  801420:	68 08 2f 80 00       	push   $0x802f08
+  801425:	e8 ff ec ff ff       	call   800129 <_panic>
+
+0080142a <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80142a:	55                   	push   %ebp
+  80142b:	89 e5                	mov    %esp,%ebp
+  80142d:	57                   	push   %edi
+  80142e:	56                   	push   %esi
+  80142f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801430:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801437:	74 1b                	je     801454 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801439:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801443:	8b 55 08             	mov    0x8(%ebp),%edx
+  801446:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801449:	89 df                	mov    %ebx,%edi
+  80144b:	89 de                	mov    %ebx,%esi
+  80144d:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80144f:	5b                   	pop    %ebx
+  801450:	5e                   	pop    %esi
+  801451:	5f                   	pop    %edi
+  801452:	5d                   	pop    %ebp
+  801453:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801454:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801459:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801464:	89 df                	mov    %ebx,%edi
+  801466:	55                   	push   %ebp
+  801467:	89 e5                	mov    %esp,%ebp
+  801469:	8d 35 71 14 80 00    	lea    0x801471,%esi
+  80146f:	0f 34                	sysenter
+  801471:	5d                   	pop    %ebp
+		goto out;
+  801472:	eb db                	jmp    80144f <sys_batch+0x25>
+
+00801474 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801474:	55                   	push   %ebp
+  801475:	89 e5                	mov    %esp,%ebp
+  801477:	57                   	push   %edi
+  801478:	56                   	push   %esi
+  801479:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80147a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801481:	74 1a                	je     80149d <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801483:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801488:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80148d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801490:	89 cb                	mov    %ecx,%ebx
+  801492:	89 cf                	mov    %ecx,%edi
+  801494:	89 ce                	mov    %ecx,%esi
+  801496:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801498:	5b                   	pop    %ebx
+  801499:	5e                   	pop    %esi
+  80149a:	5f                   	pop    %edi
+  80149b:	5d                   	pop    %ebp
+  80149c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80149d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014aa:	89 cb                	mov    %ecx,%ebx
+  8014ac:	89 cf                	mov    %ecx,%edi
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	8d 35 b9 14 80 00    	lea    0x8014b9,%esi
+  8014b7:	0f 34                	sysenter
+  8014b9:	5d                   	pop    %ebp
+		goto out;
+  8014ba:	eb dc                	jmp    801498 <sys_trace_ctl+0x24>
+
+008014bc <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014bc:	55                   	push   %ebp
+  8014bd:	89 e5                	mov    %esp,%ebp
+  8014bf:	57                   	push   %edi
+  8014c0:	56                   	push   %esi
+  8014c1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014c2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014c9:	74 1c                	je     8014e7 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014de:	89 f7                	mov    %esi,%edi
+  8014e0:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5f                   	pop    %edi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ed:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fa:	55                   	push   %ebp
+  8014fb:	89 e5                	mov    %esp,%ebp
+  8014fd:	8d 35 05 15 80 00    	lea    0x801505,%esi
+  801503:	0f 34                	sysenter
+  801505:	5d                   	pop    %ebp
+		goto out;
+  801506:	eb da                	jmp    8014e2 <sys_trace_read+0x26>
+
+00801508 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801508:	55                   	push   %ebp
+  801509:	89 e5                	mov    %esp,%ebp
+  80150b:	57                   	push   %edi
+  80150c:	56                   	push   %esi
+  80150d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80150e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801515:	74 1c                	je     801533 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801517:	be 00 00 00 00       	mov    $0x0,%esi
+  80151c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801521:	8b 55 08             	mov    0x8(%ebp),%edx
+  801524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801527:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152a:	89 f7                	mov    %esi,%edi
+  80152c:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80152e:	5b                   	pop    %ebx
+  80152f:	5e                   	pop    %esi
+  801530:	5f                   	pop    %edi
+  801531:	5d                   	pop    %ebp
+  801532:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801533:	8b 55 08             	mov    0x8(%ebp),%edx
+  801536:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801539:	b8 21 00 00 00       	mov    $0x21,%eax
+  80153e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801543:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801546:	55                   	push   %ebp
+  801547:	89 e5                	mov    %esp,%ebp
+  801549:	8d 35 51 15 80 00    	lea    0x801551,%esi
+  80154f:	0f 34                	sysenter
+  801551:	5d                   	pop    %ebp
+		goto out;
+  801552:	eb da                	jmp    80152e <sys_meminfo+0x26>
+
+00801554 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801554:	55                   	push   %ebp
+  801555:	89 e5                	mov    %esp,%ebp
+  801557:	57                   	push   %edi
+  801558:	56                   	push   %esi
+  801559:	53                   	push   %ebx
+  80155a:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80155d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801561:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801568:	74 1f                	je     801589 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80156a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156f:	b8 22 00 00 00       	mov    $0x22,%eax
+  801574:	8b 55 08             	mov    0x8(%ebp),%edx
+  801577:	89 df                	mov    %ebx,%edi
+  801579:	89 de                	mov    %ebx,%esi
+  80157b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	7f 25                	jg     8015a6 <sys_env_set_ksm+0x52>
+}
+  801581:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801584:	5b                   	pop    %ebx
+  801585:	5e                   	pop    %esi
+  801586:	5f                   	pop    %edi
+  801587:	5d                   	pop    %ebp
+  801588:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801589:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801591:	b8 22 00 00 00       	mov    $0x22,%eax
+  801596:	89 df                	mov    %ebx,%edi
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	8d 35 a3 15 80 00    	lea    0x8015a3,%esi
+  8015a1:	0f 34                	sysenter
+  8015a3:	5d                   	pop    %ebp
+		goto out;
+  8015a4:	eb d7                	jmp    80157d <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015a6:	83 ec 0c             	sub    $0xc,%esp
+  8015a9:	50                   	push   %eax
+  8015aa:	6a 22                	push   $0x22
+  8015ac:	68 eb 2e 80 00       	push   $0x802eeb
+  8015b1:	6a 3f                	push   $0x3f
+  8015b3:	68 08 2f 80 00       	push   $0x802f08
+  8015b8:	e8 6c eb ff ff       	call   800129 <_panic>
+
+008015bd <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015bd:	55                   	push   %ebp
+  8015be:	89 e5                	mov    %esp,%ebp
+  8015c0:	57                   	push   %edi
+  8015c1:	56                   	push   %esi
+  8015c2:	53                   	push   %ebx
+  8015c3:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015c6:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015c9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015d0:	74 24                	je     8015f6 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015dc:	89 cb                	mov    %ecx,%ebx
+  8015de:	89 cf                	mov    %ecx,%edi
+  8015e0:	89 ce                	mov    %ecx,%esi
+  8015e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015e4:	85 c0                	test   %eax,%eax
+  8015e6:	7f 2a                	jg     801612 <sys_time_nsec+0x55>
+	return ns;
+}
+  8015e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015eb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f1:	5b                   	pop    %ebx
+  8015f2:	5e                   	pop    %esi
+  8015f3:	5f                   	pop    %edi
+  8015f4:	5d                   	pop    %ebp
+  8015f5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801600:	89 cb                	mov    %ecx,%ebx
+  801602:	89 cf                	mov    %ecx,%edi
+  801604:	55                   	push   %ebp
+  801605:	89 e5                	mov    %esp,%ebp
+  801607:	8d 35 0f 16 80 00    	lea    0x80160f,%esi
+  80160d:	0f 34                	sysenter
+  80160f:	5d                   	pop    %ebp
+		goto out;
+  801610:	eb d2                	jmp    8015e4 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801612:	83 ec 0c             	sub    $0xc,%esp
+  801615:	50                   	push   %eax
+  801616:	6a 0f                	push   $0xf
+  801618:	68 eb 2e 80 00       	push   $0x802eeb
+  80161d:	6a 3f                	push   $0x3f
+  80161f:	68 08 2f 80 00       	push   $0x802f08
+  801624:	e8 00 eb ff ff       	call   800129 <_panic>
+
+00801629 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	57                   	push   %edi
+  80162d:	56                   	push   %esi
+  80162e:	53                   	push   %ebx
+  80162f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801632:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801639:	74 22                	je     80165d <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80163b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801640:	b8 12 00 00 00       	mov    $0x12,%eax
+  801645:	8b 55 08             	mov    0x8(%ebp),%edx
+  801648:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164b:	89 df                	mov    %ebx,%edi
+  80164d:	89 de                	mov    %ebx,%esi
+  80164f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801651:	85 c0                	test   %eax,%eax
+  801653:	7f 28                	jg     80167d <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801655:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801658:	5b                   	pop    %ebx
+  801659:	5e                   	pop    %esi
+  80165a:	5f                   	pop    %edi
+  80165b:	5d                   	pop    %ebp
+  80165c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80165d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801662:	8b 55 08             	mov    0x8(%ebp),%edx
+  801665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801668:	b8 12 00 00 00       	mov    $0x12,%eax
+  80166d:	89 df                	mov    %ebx,%edi
+  80166f:	55                   	push   %ebp
+  801670:	89 e5                	mov    %esp,%ebp
+  801672:	8d 35 7a 16 80 00    	lea    0x80167a,%esi
+  801678:	0f 34                	sysenter
+  80167a:	5d                   	pop    %ebp
+		goto out;
+  80167b:	eb d4                	jmp    801651 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80167d:	83 ec 0c             	sub    $0xc,%esp
+  801680:	50                   	push   %eax
+  801681:	6a 12                	push   $0x12
+  801683:	68 eb 2e 80 00       	push   $0x802eeb
+  801688:	6a 3f                	push   $0x3f
+  80168a:	68 08 2f 80 00       	push   $0x802f08
+  80168f:	e8 95 ea ff ff       	call   800129 <_panic>
+
+00801694 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	57                   	push   %edi
+  801698:	56                   	push   %esi
+  801699:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80169a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016a1:	74 1b                	je     8016be <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8016a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b3:	89 df                	mov    %ebx,%edi
+  8016b5:	89 de                	mov    %ebx,%esi
+  8016b7:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016b9:	5b                   	pop    %ebx
+  8016ba:	5e                   	pop    %esi
+  8016bb:	5f                   	pop    %edi
+  8016bc:	5d                   	pop    %ebp
+  8016bd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016ce:	89 df                	mov    %ebx,%edi
+  8016d0:	55                   	push   %ebp
+  8016d1:	89 e5                	mov    %esp,%ebp
+  8016d3:	8d 35 db 16 80 00    	lea    0x8016db,%esi
+  8016d9:	0f 34                	sysenter
+  8016db:	5d                   	pop    %ebp
+		goto out;
+  8016dc:	eb db                	jmp    8016b9 <sys_e1000_receive+0x25>
+
+008016de <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016de:	55                   	push   %ebp
+  8016df:	89 e5                	mov    %esp,%ebp
+  8016e1:	57                   	push   %edi
+  8016e2:	56                   	push   %esi
+  8016e3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016e4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016eb:	74 1b                	je     801708 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fd:	89 df                	mov    %ebx,%edi
+  8016ff:	89 de                	mov    %ebx,%esi
+  801701:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801703:	5b                   	pop    %ebx
+  801704:	5e                   	pop    %esi
+  801705:	5f                   	pop    %edi
+  801706:	5d                   	pop    %ebp
+  801707:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801710:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801713:	b8 14 00 00 00       	mov    $0x14,%eax
+  801718:	89 df                	mov    %ebx,%edi
+  80171a:	55                   	push   %ebp
+  80171b:	89 e5                	mov    %esp,%ebp
+  80171d:	8d 35 25 17 80 00    	lea    0x801725,%esi
+  801723:	0f 34                	sysenter
+  801725:	5d                   	pop    %ebp
+		goto out;
+  801726:	eb db                	jmp    801703 <sys_e1000_read_hwaddr+0x25>
+
+00801728 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801728:	55                   	push   %ebp
+  801729:	89 e5                	mov    %esp,%ebp
+  80172b:	57                   	push   %edi
+  80172c:	56                   	push   %esi
+  80172d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80172e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801735:	74 1a                	je     801751 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801737:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801741:	8b 55 08             	mov    0x8(%ebp),%edx
+  801744:	89 cb                	mov    %ecx,%ebx
+  801746:	89 cf                	mov    %ecx,%edi
+  801748:	89 ce                	mov    %ecx,%esi
+  80174a:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80174c:	5b                   	pop    %ebx
+  80174d:	5e                   	pop    %esi
+  80174e:	5f                   	pop    %edi
+  80174f:	5d                   	pop    %ebp
+  801750:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801751:	8b 55 08             	mov    0x8(%ebp),%edx
+  801754:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801759:	b8 15 00 00 00       	mov    $0x15,%eax
+  80175e:	89 cb                	mov    %ecx,%ebx
+  801760:	89 cf                	mov    %ecx,%edi
+  801762:	55                   	push   %ebp
+  801763:	89 e5                	mov    %esp,%ebp
+  801765:	8d 35 6d 17 80 00    	lea    0x80176d,%esi
+  80176b:	0f 34                	sysenter
+  80176d:	5d                   	pop    %ebp
+		goto out;
+  80176e:	eb dc                	jmp    80174c <sys_sb16_read_version+0x24>
+
+00801770 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801770:	55                   	push   %ebp
+  801771:	89 e5                	mov    %esp,%ebp
+  801773:	57                   	push   %edi
+  801774:	56                   	push   %esi
+  801775:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801776:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80177d:	74 1b                	je     80179a <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80177f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801784:	b8 16 00 00 00       	mov    $0x16,%eax
+  801789:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178f:	89 df                	mov    %ebx,%edi
+  801791:	89 de                	mov    %ebx,%esi
+  801793:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801795:	5b                   	pop    %ebx
+  801796:	5e                   	pop    %esi
+  801797:	5f                   	pop    %edi
+  801798:	5d                   	pop    %ebp
+  801799:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80179a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017aa:	89 df                	mov    %ebx,%edi
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	8d 35 b7 17 80 00    	lea    0x8017b7,%esi
+  8017b5:	0f 34                	sysenter
+  8017b7:	5d                   	pop    %ebp
+		goto out;
+  8017b8:	eb db                	jmp    801795 <sys_sb16_play+0x25>
+
+008017ba <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017ba:	55                   	push   %ebp
+  8017bb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017c0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017c5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017c8:	5d                   	pop    %ebp
+  8017c9:	c3                   	ret
+
+008017ca <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017ca:	55                   	push   %ebp
+  8017cb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017d0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017d5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017da:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+
+008017e1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017e4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017e9:	eb 02                	jmp    8017ed <fd_alloc+0xc>
+  8017eb:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017ed:	89 c2                	mov    %eax,%edx
+  8017ef:	c1 ea 16             	shr    $0x16,%edx
+  8017f2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017f9:	f6 c2 01             	test   $0x1,%dl
+  8017fc:	74 2b                	je     801829 <fd_alloc+0x48>
+  8017fe:	89 c2                	mov    %eax,%edx
+  801800:	c1 ea 0c             	shr    $0xc,%edx
+  801803:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80180a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801810:	f6 c1 01             	test   $0x1,%cl
+  801813:	74 14                	je     801829 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801815:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80181b:	75 ce                	jne    8017eb <fd_alloc+0xa>
+  80181d:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801822:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801827:	eb 05                	jmp    80182e <fd_alloc+0x4d>
+			return 0;
+  801829:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80182e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801831:	89 02                	mov    %eax,(%edx)
+}
+  801833:	89 c8                	mov    %ecx,%eax
+  801835:	5d                   	pop    %ebp
+  801836:	c3                   	ret
+
+00801837 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801837:	55                   	push   %ebp
+  801838:	89 e5                	mov    %esp,%ebp
+  80183a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80183d:	83 f8 1f             	cmp    $0x1f,%eax
+  801840:	77 30                	ja     801872 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801842:	c1 e0 0c             	shl    $0xc,%eax
+  801845:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80184a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801850:	f6 c2 01             	test   $0x1,%dl
+  801853:	74 24                	je     801879 <fd_lookup+0x42>
+  801855:	89 c2                	mov    %eax,%edx
+  801857:	c1 ea 0c             	shr    $0xc,%edx
+  80185a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801861:	f6 c2 01             	test   $0x1,%dl
+  801864:	74 1a                	je     801880 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801866:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801869:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80186b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801870:	5d                   	pop    %ebp
+  801871:	c3                   	ret
+		return -E_INVAL;
+  801872:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801877:	eb f7                	jmp    801870 <fd_lookup+0x39>
+		return -E_INVAL;
+  801879:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80187e:	eb f0                	jmp    801870 <fd_lookup+0x39>
+  801880:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801885:	eb e9                	jmp    801870 <fd_lookup+0x39>
+
+00801887 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	53                   	push   %ebx
+  80188b:	83 ec 04             	sub    $0x4,%esp
+  80188e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801891:	b8 00 00 00 00       	mov    $0x0,%eax
+  801896:	eb 03                	jmp    80189b <dev_lookup+0x14>
+  801898:	83 c0 01             	add    $0x1,%eax
+  80189b:	8b 1c 85 94 2f 80 00 	mov    0x802f94(,%eax,4),%ebx
+  8018a2:	85 db                	test   %ebx,%ebx
+  8018a4:	74 0b                	je     8018b1 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018a6:	39 13                	cmp    %edx,(%ebx)
+  8018a8:	75 ee                	jne    801898 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018af:	eb 2e                	jmp    8018df <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8018b1:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018b3:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8018b8:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018be:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018c3:	76 24                	jbe    8018e9 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018c5:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018c8:	83 ec 04             	sub    $0x4,%esp
+  8018cb:	52                   	push   %edx
+  8018cc:	50                   	push   %eax
+  8018cd:	68 18 2f 80 00       	push   $0x802f18
+  8018d2:	e8 2d e9 ff ff       	call   800204 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018d7:	83 c4 10             	add    $0x10,%esp
+  8018da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018e2:	89 1a                	mov    %ebx,(%edx)
+}
+  8018e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018e7:	c9                   	leave
+  8018e8:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018e9:	c1 e8 10             	shr    $0x10,%eax
+  8018ec:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018f2:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018f8:	eb cb                	jmp    8018c5 <dev_lookup+0x3e>
+
+008018fa <fd_close>:
+{
+  8018fa:	55                   	push   %ebp
+  8018fb:	89 e5                	mov    %esp,%ebp
+  8018fd:	57                   	push   %edi
+  8018fe:	56                   	push   %esi
+  8018ff:	53                   	push   %ebx
+  801900:	83 ec 24             	sub    $0x24,%esp
+  801903:	8b 75 08             	mov    0x8(%ebp),%esi
+  801906:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801909:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80190c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80190d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801913:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801916:	50                   	push   %eax
+  801917:	e8 1b ff ff ff       	call   801837 <fd_lookup>
+  80191c:	89 c3                	mov    %eax,%ebx
+  80191e:	83 c4 10             	add    $0x10,%esp
+  801921:	85 c0                	test   %eax,%eax
+  801923:	78 05                	js     80192a <fd_close+0x30>
+	    || fd != fd2)
+  801925:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801928:	74 16                	je     801940 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80192a:	89 f8                	mov    %edi,%eax
+  80192c:	84 c0                	test   %al,%al
+  80192e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801933:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801936:	89 d8                	mov    %ebx,%eax
+  801938:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193b:	5b                   	pop    %ebx
+  80193c:	5e                   	pop    %esi
+  80193d:	5f                   	pop    %edi
+  80193e:	5d                   	pop    %ebp
+  80193f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801940:	83 ec 08             	sub    $0x8,%esp
+  801943:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801946:	50                   	push   %eax
+  801947:	ff 36                	push   (%esi)
+  801949:	e8 39 ff ff ff       	call   801887 <dev_lookup>
+  80194e:	89 c3                	mov    %eax,%ebx
+  801950:	83 c4 10             	add    $0x10,%esp
+  801953:	85 c0                	test   %eax,%eax
+  801955:	78 1a                	js     801971 <fd_close+0x77>
+		if (dev->dev_close)
+  801957:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80195a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80195d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801962:	85 c0                	test   %eax,%eax
+  801964:	74 0b                	je     801971 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801966:	83 ec 0c             	sub    $0xc,%esp
+  801969:	56                   	push   %esi
+  80196a:	ff d0                	call   *%eax
+  80196c:	89 c3                	mov    %eax,%ebx
+  80196e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801971:	83 ec 08             	sub    $0x8,%esp
+  801974:	56                   	push   %esi
+  801975:	6a 00                	push   $0x0
+  801977:	e8 a3 f4 ff ff       	call   800e1f <sys_page_unmap>
+	return r;
+  80197c:	83 c4 10             	add    $0x10,%esp
+  80197f:	eb b5                	jmp    801936 <fd_close+0x3c>
+
+00801981 <close>:
+
+int
+close(int fdnum)
+{
+  801981:	55                   	push   %ebp
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801987:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80198a:	50                   	push   %eax
+  80198b:	ff 75 08             	push   0x8(%ebp)
+  80198e:	e8 a4 fe ff ff       	call   801837 <fd_lookup>
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	85 c0                	test   %eax,%eax
+  801998:	79 02                	jns    80199c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80199a:	c9                   	leave
+  80199b:	c3                   	ret
+		return fd_close(fd, 1);
+  80199c:	83 ec 08             	sub    $0x8,%esp
+  80199f:	6a 01                	push   $0x1
+  8019a1:	ff 75 f4             	push   -0xc(%ebp)
+  8019a4:	e8 51 ff ff ff       	call   8018fa <fd_close>
+  8019a9:	83 c4 10             	add    $0x10,%esp
+  8019ac:	eb ec                	jmp    80199a <close+0x19>
+
+008019ae <close_all>:
+
+void
+close_all(void)
+{
+  8019ae:	55                   	push   %ebp
+  8019af:	89 e5                	mov    %esp,%ebp
+  8019b1:	53                   	push   %ebx
+  8019b2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019ba:	83 ec 0c             	sub    $0xc,%esp
+  8019bd:	53                   	push   %ebx
+  8019be:	e8 be ff ff ff       	call   801981 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019c3:	83 c3 01             	add    $0x1,%ebx
+  8019c6:	83 c4 10             	add    $0x10,%esp
+  8019c9:	83 fb 20             	cmp    $0x20,%ebx
+  8019cc:	75 ec                	jne    8019ba <close_all+0xc>
+}
+  8019ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d1:	c9                   	leave
+  8019d2:	c3                   	ret
+
+008019d3 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019d3:	55                   	push   %ebp
+  8019d4:	89 e5                	mov    %esp,%ebp
+  8019d6:	57                   	push   %edi
+  8019d7:	56                   	push   %esi
+  8019d8:	53                   	push   %ebx
+  8019d9:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019dc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019df:	50                   	push   %eax
+  8019e0:	ff 75 08             	push   0x8(%ebp)
+  8019e3:	e8 4f fe ff ff       	call   801837 <fd_lookup>
+  8019e8:	89 c3                	mov    %eax,%ebx
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	78 7f                	js     801a70 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019f1:	83 ec 0c             	sub    $0xc,%esp
+  8019f4:	ff 75 0c             	push   0xc(%ebp)
+  8019f7:	e8 85 ff ff ff       	call   801981 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019ff:	c1 e6 0c             	shl    $0xc,%esi
+  801a02:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a08:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a0b:	89 3c 24             	mov    %edi,(%esp)
+  801a0e:	e8 b7 fd ff ff       	call   8017ca <fd2data>
+  801a13:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a15:	89 34 24             	mov    %esi,(%esp)
+  801a18:	e8 ad fd ff ff       	call   8017ca <fd2data>
+  801a1d:	83 c4 10             	add    $0x10,%esp
+  801a20:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a23:	89 d8                	mov    %ebx,%eax
+  801a25:	c1 e8 16             	shr    $0x16,%eax
+  801a28:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a2f:	a8 01                	test   $0x1,%al
+  801a31:	74 11                	je     801a44 <dup+0x71>
+  801a33:	89 d8                	mov    %ebx,%eax
+  801a35:	c1 e8 0c             	shr    $0xc,%eax
+  801a38:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a3f:	f6 c2 01             	test   $0x1,%dl
+  801a42:	75 36                	jne    801a7a <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a44:	89 f8                	mov    %edi,%eax
+  801a46:	c1 e8 0c             	shr    $0xc,%eax
+  801a49:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a50:	83 ec 0c             	sub    $0xc,%esp
+  801a53:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a58:	50                   	push   %eax
+  801a59:	56                   	push   %esi
+  801a5a:	6a 00                	push   $0x0
+  801a5c:	57                   	push   %edi
+  801a5d:	6a 00                	push   $0x0
+  801a5f:	e8 4d f3 ff ff       	call   800db1 <sys_page_map>
+  801a64:	89 c3                	mov    %eax,%ebx
+  801a66:	83 c4 20             	add    $0x20,%esp
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	78 33                	js     801aa0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a70:	89 d8                	mov    %ebx,%eax
+  801a72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a75:	5b                   	pop    %ebx
+  801a76:	5e                   	pop    %esi
+  801a77:	5f                   	pop    %edi
+  801a78:	5d                   	pop    %ebp
+  801a79:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a7a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a81:	83 ec 0c             	sub    $0xc,%esp
+  801a84:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a89:	50                   	push   %eax
+  801a8a:	ff 75 d4             	push   -0x2c(%ebp)
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	53                   	push   %ebx
+  801a90:	6a 00                	push   $0x0
+  801a92:	e8 1a f3 ff ff       	call   800db1 <sys_page_map>
+  801a97:	89 c3                	mov    %eax,%ebx
+  801a99:	83 c4 20             	add    $0x20,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	79 a4                	jns    801a44 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801aa0:	83 ec 08             	sub    $0x8,%esp
+  801aa3:	56                   	push   %esi
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	e8 74 f3 ff ff       	call   800e1f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801aab:	83 c4 08             	add    $0x8,%esp
+  801aae:	ff 75 d4             	push   -0x2c(%ebp)
+  801ab1:	6a 00                	push   $0x0
+  801ab3:	e8 67 f3 ff ff       	call   800e1f <sys_page_unmap>
+	return r;
+  801ab8:	83 c4 10             	add    $0x10,%esp
+  801abb:	eb b3                	jmp    801a70 <dup+0x9d>
+
+00801abd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801abd:	55                   	push   %ebp
+  801abe:	89 e5                	mov    %esp,%ebp
+  801ac0:	56                   	push   %esi
+  801ac1:	53                   	push   %ebx
+  801ac2:	83 ec 18             	sub    $0x18,%esp
+  801ac5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ac8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801acb:	50                   	push   %eax
+  801acc:	53                   	push   %ebx
+  801acd:	e8 65 fd ff ff       	call   801837 <fd_lookup>
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	78 3c                	js     801b15 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ad9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801adc:	83 ec 08             	sub    $0x8,%esp
+  801adf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ae2:	50                   	push   %eax
+  801ae3:	ff 36                	push   (%esi)
+  801ae5:	e8 9d fd ff ff       	call   801887 <dev_lookup>
+  801aea:	83 c4 10             	add    $0x10,%esp
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	78 24                	js     801b15 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801af1:	8b 46 08             	mov    0x8(%esi),%eax
+  801af4:	83 e0 03             	and    $0x3,%eax
+  801af7:	83 f8 01             	cmp    $0x1,%eax
+  801afa:	74 20                	je     801b1c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801afc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aff:	8b 40 08             	mov    0x8(%eax),%eax
+  801b02:	85 c0                	test   %eax,%eax
+  801b04:	74 57                	je     801b5d <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b06:	83 ec 04             	sub    $0x4,%esp
+  801b09:	ff 75 10             	push   0x10(%ebp)
+  801b0c:	ff 75 0c             	push   0xc(%ebp)
+  801b0f:	56                   	push   %esi
+  801b10:	ff d0                	call   *%eax
+  801b12:	83 c4 10             	add    $0x10,%esp
+}
+  801b15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b18:	5b                   	pop    %ebx
+  801b19:	5e                   	pop    %esi
+  801b1a:	5d                   	pop    %ebp
+  801b1b:	c3                   	ret
+  801b1c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b1e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b23:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b29:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b2e:	76 1c                	jbe    801b4c <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b30:	8b 42 48             	mov    0x48(%edx),%eax
+  801b33:	83 ec 04             	sub    $0x4,%esp
+  801b36:	53                   	push   %ebx
+  801b37:	50                   	push   %eax
+  801b38:	68 59 2f 80 00       	push   $0x802f59
+  801b3d:	e8 c2 e6 ff ff       	call   800204 <cprintf>
+		return -E_INVAL;
+  801b42:	83 c4 10             	add    $0x10,%esp
+  801b45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b4a:	eb c9                	jmp    801b15 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b4c:	c1 e8 10             	shr    $0x10,%eax
+  801b4f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b55:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b5b:	eb d3                	jmp    801b30 <read+0x73>
+		return -E_NOT_SUPP;
+  801b5d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b62:	eb b1                	jmp    801b15 <read+0x58>
+
+00801b64 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b64:	55                   	push   %ebp
+  801b65:	89 e5                	mov    %esp,%ebp
+  801b67:	57                   	push   %edi
+  801b68:	56                   	push   %esi
+  801b69:	53                   	push   %ebx
+  801b6a:	83 ec 0c             	sub    $0xc,%esp
+  801b6d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b70:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b78:	eb 02                	jmp    801b7c <readn+0x18>
+  801b7a:	01 c3                	add    %eax,%ebx
+  801b7c:	39 f3                	cmp    %esi,%ebx
+  801b7e:	73 21                	jae    801ba1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b80:	83 ec 04             	sub    $0x4,%esp
+  801b83:	89 f0                	mov    %esi,%eax
+  801b85:	29 d8                	sub    %ebx,%eax
+  801b87:	50                   	push   %eax
+  801b88:	89 d8                	mov    %ebx,%eax
+  801b8a:	03 45 0c             	add    0xc(%ebp),%eax
+  801b8d:	50                   	push   %eax
+  801b8e:	57                   	push   %edi
+  801b8f:	e8 29 ff ff ff       	call   801abd <read>
+		if (m < 0)
+  801b94:	83 c4 10             	add    $0x10,%esp
+  801b97:	85 c0                	test   %eax,%eax
+  801b99:	78 04                	js     801b9f <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b9b:	75 dd                	jne    801b7a <readn+0x16>
+  801b9d:	eb 02                	jmp    801ba1 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b9f:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801ba1:	89 d8                	mov    %ebx,%eax
+  801ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba6:	5b                   	pop    %ebx
+  801ba7:	5e                   	pop    %esi
+  801ba8:	5f                   	pop    %edi
+  801ba9:	5d                   	pop    %ebp
+  801baa:	c3                   	ret
+
+00801bab <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801bab:	55                   	push   %ebp
+  801bac:	89 e5                	mov    %esp,%ebp
+  801bae:	56                   	push   %esi
+  801baf:	53                   	push   %ebx
+  801bb0:	83 ec 18             	sub    $0x18,%esp
+  801bb3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bb6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bb9:	50                   	push   %eax
+  801bba:	53                   	push   %ebx
+  801bbb:	e8 77 fc ff ff       	call   801837 <fd_lookup>
+  801bc0:	83 c4 10             	add    $0x10,%esp
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	78 37                	js     801bfe <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bc7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bca:	83 ec 08             	sub    $0x8,%esp
+  801bcd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd0:	50                   	push   %eax
+  801bd1:	ff 36                	push   (%esi)
+  801bd3:	e8 af fc ff ff       	call   801887 <dev_lookup>
+  801bd8:	83 c4 10             	add    $0x10,%esp
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	78 1f                	js     801bfe <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bdf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801be3:	74 20                	je     801c05 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801be5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801be8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801beb:	85 c0                	test   %eax,%eax
+  801bed:	74 57                	je     801c46 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bef:	83 ec 04             	sub    $0x4,%esp
+  801bf2:	ff 75 10             	push   0x10(%ebp)
+  801bf5:	ff 75 0c             	push   0xc(%ebp)
+  801bf8:	56                   	push   %esi
+  801bf9:	ff d0                	call   *%eax
+  801bfb:	83 c4 10             	add    $0x10,%esp
+}
+  801bfe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c01:	5b                   	pop    %ebx
+  801c02:	5e                   	pop    %esi
+  801c03:	5d                   	pop    %ebp
+  801c04:	c3                   	ret
+  801c05:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c07:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c0c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c12:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c17:	76 1c                	jbe    801c35 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c19:	8b 42 48             	mov    0x48(%edx),%eax
+  801c1c:	83 ec 04             	sub    $0x4,%esp
+  801c1f:	53                   	push   %ebx
+  801c20:	50                   	push   %eax
+  801c21:	68 75 2f 80 00       	push   $0x802f75
+  801c26:	e8 d9 e5 ff ff       	call   800204 <cprintf>
+		return -E_INVAL;
+  801c2b:	83 c4 10             	add    $0x10,%esp
+  801c2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c33:	eb c9                	jmp    801bfe <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c35:	c1 e8 10             	shr    $0x10,%eax
+  801c38:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c3e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c44:	eb d3                	jmp    801c19 <write+0x6e>
+		return -E_NOT_SUPP;
+  801c46:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c4b:	eb b1                	jmp    801bfe <write+0x53>
+
+00801c4d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c4d:	55                   	push   %ebp
+  801c4e:	89 e5                	mov    %esp,%ebp
+  801c50:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c53:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c56:	50                   	push   %eax
+  801c57:	ff 75 08             	push   0x8(%ebp)
+  801c5a:	e8 d8 fb ff ff       	call   801837 <fd_lookup>
+  801c5f:	83 c4 10             	add    $0x10,%esp
+  801c62:	85 c0                	test   %eax,%eax
+  801c64:	78 0e                	js     801c74 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c6c:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c74:	c9                   	leave
+  801c75:	c3                   	ret
+
+00801c76 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c76:	55                   	push   %ebp
+  801c77:	89 e5                	mov    %esp,%ebp
+  801c79:	56                   	push   %esi
+  801c7a:	53                   	push   %ebx
+  801c7b:	83 ec 18             	sub    $0x18,%esp
+  801c7e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c81:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c84:	50                   	push   %eax
+  801c85:	53                   	push   %ebx
+  801c86:	e8 ac fb ff ff       	call   801837 <fd_lookup>
+  801c8b:	83 c4 10             	add    $0x10,%esp
+  801c8e:	85 c0                	test   %eax,%eax
+  801c90:	78 34                	js     801cc6 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c92:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c95:	83 ec 08             	sub    $0x8,%esp
+  801c98:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c9b:	50                   	push   %eax
+  801c9c:	ff 36                	push   (%esi)
+  801c9e:	e8 e4 fb ff ff       	call   801887 <dev_lookup>
+  801ca3:	83 c4 10             	add    $0x10,%esp
+  801ca6:	85 c0                	test   %eax,%eax
+  801ca8:	78 1c                	js     801cc6 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801caa:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cae:	74 1d                	je     801ccd <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801cb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb3:	8b 40 18             	mov    0x18(%eax),%eax
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	74 54                	je     801d0e <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801cba:	83 ec 08             	sub    $0x8,%esp
+  801cbd:	ff 75 0c             	push   0xc(%ebp)
+  801cc0:	56                   	push   %esi
+  801cc1:	ff d0                	call   *%eax
+  801cc3:	83 c4 10             	add    $0x10,%esp
+}
+  801cc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cc9:	5b                   	pop    %ebx
+  801cca:	5e                   	pop    %esi
+  801ccb:	5d                   	pop    %ebp
+  801ccc:	c3                   	ret
+  801ccd:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ccf:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cd4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cda:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cdf:	76 1c                	jbe    801cfd <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801ce1:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ce4:	83 ec 04             	sub    $0x4,%esp
+  801ce7:	53                   	push   %ebx
+  801ce8:	50                   	push   %eax
+  801ce9:	68 38 2f 80 00       	push   $0x802f38
+  801cee:	e8 11 e5 ff ff       	call   800204 <cprintf>
+		return -E_INVAL;
+  801cf3:	83 c4 10             	add    $0x10,%esp
+  801cf6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cfb:	eb c9                	jmp    801cc6 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cfd:	c1 e8 10             	shr    $0x10,%eax
+  801d00:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d06:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d0c:	eb d3                	jmp    801ce1 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801d0e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d13:	eb b1                	jmp    801cc6 <ftruncate+0x50>
+
+00801d15 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d15:	55                   	push   %ebp
+  801d16:	89 e5                	mov    %esp,%ebp
+  801d18:	56                   	push   %esi
+  801d19:	53                   	push   %ebx
+  801d1a:	83 ec 18             	sub    $0x18,%esp
+  801d1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d20:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d23:	50                   	push   %eax
+  801d24:	ff 75 08             	push   0x8(%ebp)
+  801d27:	e8 0b fb ff ff       	call   801837 <fd_lookup>
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 49                	js     801d7c <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d33:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d36:	83 ec 08             	sub    $0x8,%esp
+  801d39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3c:	50                   	push   %eax
+  801d3d:	ff 36                	push   (%esi)
+  801d3f:	e8 43 fb ff ff       	call   801887 <dev_lookup>
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 31                	js     801d7c <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d4e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d52:	74 2f                	je     801d83 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d54:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d57:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d5e:	00 00 00 
+	stat->st_isdir = 0;
+  801d61:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d68:	00 00 00 
+	stat->st_dev = dev;
+  801d6b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d71:	83 ec 08             	sub    $0x8,%esp
+  801d74:	53                   	push   %ebx
+  801d75:	56                   	push   %esi
+  801d76:	ff 50 14             	call   *0x14(%eax)
+  801d79:	83 c4 10             	add    $0x10,%esp
+}
+  801d7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d7f:	5b                   	pop    %ebx
+  801d80:	5e                   	pop    %esi
+  801d81:	5d                   	pop    %ebp
+  801d82:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d83:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d88:	eb f2                	jmp    801d7c <fstat+0x67>
+
+00801d8a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d8a:	55                   	push   %ebp
+  801d8b:	89 e5                	mov    %esp,%ebp
+  801d8d:	56                   	push   %esi
+  801d8e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d8f:	83 ec 08             	sub    $0x8,%esp
+  801d92:	6a 00                	push   $0x0
+  801d94:	ff 75 08             	push   0x8(%ebp)
+  801d97:	e8 e4 01 00 00       	call   801f80 <open>
+  801d9c:	89 c3                	mov    %eax,%ebx
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	78 1b                	js     801dc0 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801da5:	83 ec 08             	sub    $0x8,%esp
+  801da8:	ff 75 0c             	push   0xc(%ebp)
+  801dab:	50                   	push   %eax
+  801dac:	e8 64 ff ff ff       	call   801d15 <fstat>
+  801db1:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801db3:	89 1c 24             	mov    %ebx,(%esp)
+  801db6:	e8 c6 fb ff ff       	call   801981 <close>
+	return r;
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	89 f3                	mov    %esi,%ebx
+}
+  801dc0:	89 d8                	mov    %ebx,%eax
+  801dc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc5:	5b                   	pop    %ebx
+  801dc6:	5e                   	pop    %esi
+  801dc7:	5d                   	pop    %ebp
+  801dc8:	c3                   	ret
+
+00801dc9 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	56                   	push   %esi
+  801dcd:	53                   	push   %ebx
+  801dce:	89 c6                	mov    %eax,%esi
+  801dd0:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801dd2:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801dd9:	74 27                	je     801e02 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ddb:	6a 07                	push   $0x7
+  801ddd:	68 00 60 80 00       	push   $0x806000
+  801de2:	56                   	push   %esi
+  801de3:	ff 35 00 50 80 00    	push   0x805000
+  801de9:	e8 b2 0c 00 00       	call   802aa0 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801dee:	83 c4 0c             	add    $0xc,%esp
+  801df1:	6a 00                	push   $0x0
+  801df3:	53                   	push   %ebx
+  801df4:	6a 00                	push   $0x0
+  801df6:	e8 8d 0c 00 00       	call   802a88 <ipc_recv>
+}
+  801dfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfe:	5b                   	pop    %ebx
+  801dff:	5e                   	pop    %esi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e02:	83 ec 0c             	sub    $0xc,%esp
+  801e05:	6a 01                	push   $0x1
+  801e07:	e8 e8 0c 00 00       	call   802af4 <ipc_find_env>
+  801e0c:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e11:	83 c4 10             	add    $0x10,%esp
+  801e14:	eb c5                	jmp    801ddb <fsipc+0x12>
+
+00801e16 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e22:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e2a:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e34:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e39:	e8 8b ff ff ff       	call   801dc9 <fsipc>
+}
+  801e3e:	c9                   	leave
+  801e3f:	c3                   	ret
+
+00801e40 <devfile_flush>:
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e49:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e4c:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e56:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e5b:	e8 69 ff ff ff       	call   801dc9 <fsipc>
+}
+  801e60:	c9                   	leave
+  801e61:	c3                   	ret
+
+00801e62 <devfile_stat>:
+{
+  801e62:	55                   	push   %ebp
+  801e63:	89 e5                	mov    %esp,%ebp
+  801e65:	53                   	push   %ebx
+  801e66:	83 ec 04             	sub    $0x4,%esp
+  801e69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e72:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e81:	e8 43 ff ff ff       	call   801dc9 <fsipc>
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 2c                	js     801eb6 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e8a:	83 ec 08             	sub    $0x8,%esp
+  801e8d:	68 00 60 80 00       	push   $0x806000
+  801e92:	53                   	push   %ebx
+  801e93:	e8 b4 e9 ff ff       	call   80084c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e98:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e9d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ea3:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ea8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801eae:	83 c4 10             	add    $0x10,%esp
+  801eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb9:	c9                   	leave
+  801eba:	c3                   	ret
+
+00801ebb <devfile_write>:
+{
+  801ebb:	55                   	push   %ebp
+  801ebc:	89 e5                	mov    %esp,%ebp
+  801ebe:	83 ec 0c             	sub    $0xc,%esp
+  801ec1:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ec7:	8b 52 0c             	mov    0xc(%edx),%edx
+  801eca:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801ed0:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801ed5:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801eda:	39 d0                	cmp    %edx,%eax
+  801edc:	0f 47 c2             	cmova  %edx,%eax
+  801edf:	50                   	push   %eax
+  801ee0:	ff 75 0c             	push   0xc(%ebp)
+  801ee3:	68 08 60 80 00       	push   $0x806008
+  801ee8:	e8 e5 ea ff ff       	call   8009d2 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801eed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ef7:	e8 cd fe ff ff       	call   801dc9 <fsipc>
+}
+  801efc:	c9                   	leave
+  801efd:	c3                   	ret
+
+00801efe <devfile_read>:
+{
+  801efe:	55                   	push   %ebp
+  801eff:	89 e5                	mov    %esp,%ebp
+  801f01:	56                   	push   %esi
+  801f02:	53                   	push   %ebx
+  801f03:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f09:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f0c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801f11:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f21:	e8 a3 fe ff ff       	call   801dc9 <fsipc>
+  801f26:	89 c3                	mov    %eax,%ebx
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	78 1f                	js     801f4b <devfile_read+0x4d>
+	assert(r <= n);
+  801f2c:	39 c6                	cmp    %eax,%esi
+  801f2e:	72 24                	jb     801f54 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f30:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f35:	7f 33                	jg     801f6a <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f37:	83 ec 04             	sub    $0x4,%esp
+  801f3a:	50                   	push   %eax
+  801f3b:	68 00 60 80 00       	push   $0x806000
+  801f40:	ff 75 0c             	push   0xc(%ebp)
+  801f43:	e8 8a ea ff ff       	call   8009d2 <memmove>
+	return r;
+  801f48:	83 c4 10             	add    $0x10,%esp
+}
+  801f4b:	89 d8                	mov    %ebx,%eax
+  801f4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f50:	5b                   	pop    %ebx
+  801f51:	5e                   	pop    %esi
+  801f52:	5d                   	pop    %ebp
+  801f53:	c3                   	ret
+	assert(r <= n);
+  801f54:	68 a8 2f 80 00       	push   $0x802fa8
+  801f59:	68 af 2f 80 00       	push   $0x802faf
+  801f5e:	6a 76                	push   $0x76
+  801f60:	68 c4 2f 80 00       	push   $0x802fc4
+  801f65:	e8 bf e1 ff ff       	call   800129 <_panic>
+	assert(r <= PGSIZE);
+  801f6a:	68 cf 2f 80 00       	push   $0x802fcf
+  801f6f:	68 af 2f 80 00       	push   $0x802faf
+  801f74:	6a 77                	push   $0x77
+  801f76:	68 c4 2f 80 00       	push   $0x802fc4
+  801f7b:	e8 a9 e1 ff ff       	call   800129 <_panic>
+
+00801f80 <open>:
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	56                   	push   %esi
+  801f84:	53                   	push   %ebx
+  801f85:	83 ec 1c             	sub    $0x1c,%esp
+  801f88:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f8b:	56                   	push   %esi
+  801f8c:	e8 80 e8 ff ff       	call   800811 <strlen>
+  801f91:	83 c4 10             	add    $0x10,%esp
+  801f94:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f99:	7f 6c                	jg     802007 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f9b:	83 ec 0c             	sub    $0xc,%esp
+  801f9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fa1:	50                   	push   %eax
+  801fa2:	e8 3a f8 ff ff       	call   8017e1 <fd_alloc>
+  801fa7:	89 c3                	mov    %eax,%ebx
+  801fa9:	83 c4 10             	add    $0x10,%esp
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 3c                	js     801fec <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801fb0:	83 ec 08             	sub    $0x8,%esp
+  801fb3:	56                   	push   %esi
+  801fb4:	68 00 60 80 00       	push   $0x806000
+  801fb9:	e8 8e e8 ff ff       	call   80084c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801fbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc1:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fc6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fce:	e8 f6 fd ff ff       	call   801dc9 <fsipc>
+  801fd3:	89 c3                	mov    %eax,%ebx
+  801fd5:	83 c4 10             	add    $0x10,%esp
+  801fd8:	85 c0                	test   %eax,%eax
+  801fda:	78 19                	js     801ff5 <open+0x75>
+	return fd2num(fd);
+  801fdc:	83 ec 0c             	sub    $0xc,%esp
+  801fdf:	ff 75 f4             	push   -0xc(%ebp)
+  801fe2:	e8 d3 f7 ff ff       	call   8017ba <fd2num>
+  801fe7:	89 c3                	mov    %eax,%ebx
+  801fe9:	83 c4 10             	add    $0x10,%esp
+}
+  801fec:	89 d8                	mov    %ebx,%eax
+  801fee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff1:	5b                   	pop    %ebx
+  801ff2:	5e                   	pop    %esi
+  801ff3:	5d                   	pop    %ebp
+  801ff4:	c3                   	ret
+		fd_close(fd, 0);
+  801ff5:	83 ec 08             	sub    $0x8,%esp
+  801ff8:	6a 00                	push   $0x0
+  801ffa:	ff 75 f4             	push   -0xc(%ebp)
+  801ffd:	e8 f8 f8 ff ff       	call   8018fa <fd_close>
+		return r;
+  802002:	83 c4 10             	add    $0x10,%esp
+  802005:	eb e5                	jmp    801fec <open+0x6c>
+		return -E_BAD_PATH;
+  802007:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80200c:	eb de                	jmp    801fec <open+0x6c>
+
+0080200e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80200e:	55                   	push   %ebp
+  80200f:	89 e5                	mov    %esp,%ebp
+  802011:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802014:	ba 00 00 00 00       	mov    $0x0,%edx
+  802019:	b8 08 00 00 00       	mov    $0x8,%eax
+  80201e:	e8 a6 fd ff ff       	call   801dc9 <fsipc>
+}
+  802023:	c9                   	leave
+  802024:	c3                   	ret
+
+00802025 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802025:	55                   	push   %ebp
+  802026:	89 e5                	mov    %esp,%ebp
+  802028:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80202b:	68 db 2f 80 00       	push   $0x802fdb
+  802030:	ff 75 0c             	push   0xc(%ebp)
+  802033:	e8 14 e8 ff ff       	call   80084c <strcpy>
+	return 0;
+}
+  802038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203d:	c9                   	leave
+  80203e:	c3                   	ret
+
+0080203f <devsock_close>:
+{
+  80203f:	55                   	push   %ebp
+  802040:	89 e5                	mov    %esp,%ebp
+  802042:	53                   	push   %ebx
+  802043:	83 ec 10             	sub    $0x10,%esp
+  802046:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802049:	53                   	push   %ebx
+  80204a:	e8 e4 0a 00 00       	call   802b33 <pageref>
+  80204f:	89 c2                	mov    %eax,%edx
+  802051:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802054:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802059:	83 fa 01             	cmp    $0x1,%edx
+  80205c:	74 05                	je     802063 <devsock_close+0x24>
+}
+  80205e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802061:	c9                   	leave
+  802062:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802063:	83 ec 0c             	sub    $0xc,%esp
+  802066:	ff 73 0c             	push   0xc(%ebx)
+  802069:	e8 b7 02 00 00       	call   802325 <nsipc_close>
+  80206e:	83 c4 10             	add    $0x10,%esp
+  802071:	eb eb                	jmp    80205e <devsock_close+0x1f>
+
+00802073 <devsock_write>:
+{
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  802076:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802079:	6a 00                	push   $0x0
+  80207b:	ff 75 10             	push   0x10(%ebp)
+  80207e:	ff 75 0c             	push   0xc(%ebp)
+  802081:	8b 45 08             	mov    0x8(%ebp),%eax
+  802084:	ff 70 0c             	push   0xc(%eax)
+  802087:	e8 79 03 00 00       	call   802405 <nsipc_send>
+}
+  80208c:	c9                   	leave
+  80208d:	c3                   	ret
+
+0080208e <devsock_read>:
+{
+  80208e:	55                   	push   %ebp
+  80208f:	89 e5                	mov    %esp,%ebp
+  802091:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802094:	6a 00                	push   $0x0
+  802096:	ff 75 10             	push   0x10(%ebp)
+  802099:	ff 75 0c             	push   0xc(%ebp)
+  80209c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209f:	ff 70 0c             	push   0xc(%eax)
+  8020a2:	e8 ef 02 00 00       	call   802396 <nsipc_recv>
+}
+  8020a7:	c9                   	leave
+  8020a8:	c3                   	ret
+
+008020a9 <fd2sockid>:
+{
+  8020a9:	55                   	push   %ebp
+  8020aa:	89 e5                	mov    %esp,%ebp
+  8020ac:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8020af:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020b2:	52                   	push   %edx
+  8020b3:	50                   	push   %eax
+  8020b4:	e8 7e f7 ff ff       	call   801837 <fd_lookup>
+  8020b9:	83 c4 10             	add    $0x10,%esp
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	78 10                	js     8020d0 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c3:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8020c9:	39 08                	cmp    %ecx,(%eax)
+  8020cb:	75 05                	jne    8020d2 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020cd:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020d0:	c9                   	leave
+  8020d1:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020d7:	eb f7                	jmp    8020d0 <fd2sockid+0x27>
+
+008020d9 <alloc_sockfd>:
+{
+  8020d9:	55                   	push   %ebp
+  8020da:	89 e5                	mov    %esp,%ebp
+  8020dc:	56                   	push   %esi
+  8020dd:	53                   	push   %ebx
+  8020de:	83 ec 1c             	sub    $0x1c,%esp
+  8020e1:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e6:	50                   	push   %eax
+  8020e7:	e8 f5 f6 ff ff       	call   8017e1 <fd_alloc>
+  8020ec:	89 c3                	mov    %eax,%ebx
+  8020ee:	83 c4 10             	add    $0x10,%esp
+  8020f1:	85 c0                	test   %eax,%eax
+  8020f3:	78 43                	js     802138 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020f5:	83 ec 04             	sub    $0x4,%esp
+  8020f8:	68 07 04 00 00       	push   $0x407
+  8020fd:	ff 75 f4             	push   -0xc(%ebp)
+  802100:	6a 00                	push   $0x0
+  802102:	e8 3d ec ff ff       	call   800d44 <sys_page_alloc>
+  802107:	89 c3                	mov    %eax,%ebx
+  802109:	83 c4 10             	add    $0x10,%esp
+  80210c:	85 c0                	test   %eax,%eax
+  80210e:	78 28                	js     802138 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802110:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802113:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802119:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80211b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80211e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802125:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802128:	83 ec 0c             	sub    $0xc,%esp
+  80212b:	50                   	push   %eax
+  80212c:	e8 89 f6 ff ff       	call   8017ba <fd2num>
+  802131:	89 c3                	mov    %eax,%ebx
+  802133:	83 c4 10             	add    $0x10,%esp
+  802136:	eb 0c                	jmp    802144 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802138:	83 ec 0c             	sub    $0xc,%esp
+  80213b:	56                   	push   %esi
+  80213c:	e8 e4 01 00 00       	call   802325 <nsipc_close>
+		return r;
+  802141:	83 c4 10             	add    $0x10,%esp
+}
+  802144:	89 d8                	mov    %ebx,%eax
+  802146:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802149:	5b                   	pop    %ebx
+  80214a:	5e                   	pop    %esi
+  80214b:	5d                   	pop    %ebp
+  80214c:	c3                   	ret
+
+0080214d <accept>:
+{
+  80214d:	55                   	push   %ebp
+  80214e:	89 e5                	mov    %esp,%ebp
+  802150:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802153:	8b 45 08             	mov    0x8(%ebp),%eax
+  802156:	e8 4e ff ff ff       	call   8020a9 <fd2sockid>
+  80215b:	85 c0                	test   %eax,%eax
+  80215d:	78 1b                	js     80217a <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80215f:	83 ec 04             	sub    $0x4,%esp
+  802162:	ff 75 10             	push   0x10(%ebp)
+  802165:	ff 75 0c             	push   0xc(%ebp)
+  802168:	50                   	push   %eax
+  802169:	e8 0e 01 00 00       	call   80227c <nsipc_accept>
+  80216e:	83 c4 10             	add    $0x10,%esp
+  802171:	85 c0                	test   %eax,%eax
+  802173:	78 05                	js     80217a <accept+0x2d>
+	return alloc_sockfd(r);
+  802175:	e8 5f ff ff ff       	call   8020d9 <alloc_sockfd>
+}
+  80217a:	c9                   	leave
+  80217b:	c3                   	ret
+
+0080217c <bind>:
+{
+  80217c:	55                   	push   %ebp
+  80217d:	89 e5                	mov    %esp,%ebp
+  80217f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802182:	8b 45 08             	mov    0x8(%ebp),%eax
+  802185:	e8 1f ff ff ff       	call   8020a9 <fd2sockid>
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 12                	js     8021a0 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80218e:	83 ec 04             	sub    $0x4,%esp
+  802191:	ff 75 10             	push   0x10(%ebp)
+  802194:	ff 75 0c             	push   0xc(%ebp)
+  802197:	50                   	push   %eax
+  802198:	e8 31 01 00 00       	call   8022ce <nsipc_bind>
+  80219d:	83 c4 10             	add    $0x10,%esp
+}
+  8021a0:	c9                   	leave
+  8021a1:	c3                   	ret
+
+008021a2 <shutdown>:
+{
+  8021a2:	55                   	push   %ebp
+  8021a3:	89 e5                	mov    %esp,%ebp
+  8021a5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ab:	e8 f9 fe ff ff       	call   8020a9 <fd2sockid>
+  8021b0:	85 c0                	test   %eax,%eax
+  8021b2:	78 0f                	js     8021c3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8021b4:	83 ec 08             	sub    $0x8,%esp
+  8021b7:	ff 75 0c             	push   0xc(%ebp)
+  8021ba:	50                   	push   %eax
+  8021bb:	e8 43 01 00 00       	call   802303 <nsipc_shutdown>
+  8021c0:	83 c4 10             	add    $0x10,%esp
+}
+  8021c3:	c9                   	leave
+  8021c4:	c3                   	ret
+
+008021c5 <connect>:
+{
+  8021c5:	55                   	push   %ebp
+  8021c6:	89 e5                	mov    %esp,%ebp
+  8021c8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ce:	e8 d6 fe ff ff       	call   8020a9 <fd2sockid>
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 12                	js     8021e9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021d7:	83 ec 04             	sub    $0x4,%esp
+  8021da:	ff 75 10             	push   0x10(%ebp)
+  8021dd:	ff 75 0c             	push   0xc(%ebp)
+  8021e0:	50                   	push   %eax
+  8021e1:	e8 59 01 00 00       	call   80233f <nsipc_connect>
+  8021e6:	83 c4 10             	add    $0x10,%esp
+}
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+
+008021eb <listen>:
+{
+  8021eb:	55                   	push   %ebp
+  8021ec:	89 e5                	mov    %esp,%ebp
+  8021ee:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f4:	e8 b0 fe ff ff       	call   8020a9 <fd2sockid>
+  8021f9:	85 c0                	test   %eax,%eax
+  8021fb:	78 0f                	js     80220c <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021fd:	83 ec 08             	sub    $0x8,%esp
+  802200:	ff 75 0c             	push   0xc(%ebp)
+  802203:	50                   	push   %eax
+  802204:	e8 6b 01 00 00       	call   802374 <nsipc_listen>
+  802209:	83 c4 10             	add    $0x10,%esp
+}
+  80220c:	c9                   	leave
+  80220d:	c3                   	ret
+
+0080220e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80220e:	55                   	push   %ebp
+  80220f:	89 e5                	mov    %esp,%ebp
+  802211:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802214:	ff 75 10             	push   0x10(%ebp)
+  802217:	ff 75 0c             	push   0xc(%ebp)
+  80221a:	ff 75 08             	push   0x8(%ebp)
+  80221d:	e8 41 02 00 00       	call   802463 <nsipc_socket>
+  802222:	83 c4 10             	add    $0x10,%esp
+  802225:	85 c0                	test   %eax,%eax
+  802227:	78 05                	js     80222e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802229:	e8 ab fe ff ff       	call   8020d9 <alloc_sockfd>
+}
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+
+00802230 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802230:	55                   	push   %ebp
+  802231:	89 e5                	mov    %esp,%ebp
+  802233:	53                   	push   %ebx
+  802234:	83 ec 04             	sub    $0x4,%esp
+  802237:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802239:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802240:	74 26                	je     802268 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802242:	6a 07                	push   $0x7
+  802244:	68 00 70 80 00       	push   $0x807000
+  802249:	53                   	push   %ebx
+  80224a:	ff 35 04 50 80 00    	push   0x805004
+  802250:	e8 4b 08 00 00       	call   802aa0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802255:	83 c4 0c             	add    $0xc,%esp
+  802258:	6a 00                	push   $0x0
+  80225a:	6a 00                	push   $0x0
+  80225c:	6a 00                	push   $0x0
+  80225e:	e8 25 08 00 00       	call   802a88 <ipc_recv>
+}
+  802263:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802266:	c9                   	leave
+  802267:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802268:	83 ec 0c             	sub    $0xc,%esp
+  80226b:	6a 02                	push   $0x2
+  80226d:	e8 82 08 00 00       	call   802af4 <ipc_find_env>
+  802272:	a3 04 50 80 00       	mov    %eax,0x805004
+  802277:	83 c4 10             	add    $0x10,%esp
+  80227a:	eb c6                	jmp    802242 <nsipc+0x12>
+
+0080227c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80227c:	55                   	push   %ebp
+  80227d:	89 e5                	mov    %esp,%ebp
+  80227f:	56                   	push   %esi
+  802280:	53                   	push   %ebx
+  802281:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802284:	8b 45 08             	mov    0x8(%ebp),%eax
+  802287:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80228c:	8b 06                	mov    (%esi),%eax
+  80228e:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802293:	b8 01 00 00 00       	mov    $0x1,%eax
+  802298:	e8 93 ff ff ff       	call   802230 <nsipc>
+  80229d:	89 c3                	mov    %eax,%ebx
+  80229f:	85 c0                	test   %eax,%eax
+  8022a1:	79 09                	jns    8022ac <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8022a3:	89 d8                	mov    %ebx,%eax
+  8022a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022a8:	5b                   	pop    %ebx
+  8022a9:	5e                   	pop    %esi
+  8022aa:	5d                   	pop    %ebp
+  8022ab:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8022ac:	83 ec 04             	sub    $0x4,%esp
+  8022af:	ff 35 10 70 80 00    	push   0x807010
+  8022b5:	68 00 70 80 00       	push   $0x807000
+  8022ba:	ff 75 0c             	push   0xc(%ebp)
+  8022bd:	e8 10 e7 ff ff       	call   8009d2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022c2:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022c7:	89 06                	mov    %eax,(%esi)
+  8022c9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022cc:	eb d5                	jmp    8022a3 <nsipc_accept+0x27>
+
+008022ce <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022ce:	55                   	push   %ebp
+  8022cf:	89 e5                	mov    %esp,%ebp
+  8022d1:	53                   	push   %ebx
+  8022d2:	83 ec 08             	sub    $0x8,%esp
+  8022d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022db:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022e0:	53                   	push   %ebx
+  8022e1:	ff 75 0c             	push   0xc(%ebp)
+  8022e4:	68 04 70 80 00       	push   $0x807004
+  8022e9:	e8 e4 e6 ff ff       	call   8009d2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022ee:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022f4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022f9:	e8 32 ff ff ff       	call   802230 <nsipc>
+}
+  8022fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802301:	c9                   	leave
+  802302:	c3                   	ret
+
+00802303 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802309:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802311:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802314:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802319:	b8 03 00 00 00       	mov    $0x3,%eax
+  80231e:	e8 0d ff ff ff       	call   802230 <nsipc>
+}
+  802323:	c9                   	leave
+  802324:	c3                   	ret
+
+00802325 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802325:	55                   	push   %ebp
+  802326:	89 e5                	mov    %esp,%ebp
+  802328:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80232b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232e:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802333:	b8 04 00 00 00       	mov    $0x4,%eax
+  802338:	e8 f3 fe ff ff       	call   802230 <nsipc>
+}
+  80233d:	c9                   	leave
+  80233e:	c3                   	ret
+
+0080233f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80233f:	55                   	push   %ebp
+  802340:	89 e5                	mov    %esp,%ebp
+  802342:	53                   	push   %ebx
+  802343:	83 ec 08             	sub    $0x8,%esp
+  802346:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802349:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234c:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802351:	53                   	push   %ebx
+  802352:	ff 75 0c             	push   0xc(%ebp)
+  802355:	68 04 70 80 00       	push   $0x807004
+  80235a:	e8 73 e6 ff ff       	call   8009d2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80235f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802365:	b8 05 00 00 00       	mov    $0x5,%eax
+  80236a:	e8 c1 fe ff ff       	call   802230 <nsipc>
+}
+  80236f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802372:	c9                   	leave
+  802373:	c3                   	ret
+
+00802374 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80237a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802382:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802385:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80238a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80238f:	e8 9c fe ff ff       	call   802230 <nsipc>
+}
+  802394:	c9                   	leave
+  802395:	c3                   	ret
+
+00802396 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802396:	55                   	push   %ebp
+  802397:	89 e5                	mov    %esp,%ebp
+  802399:	56                   	push   %esi
+  80239a:	53                   	push   %ebx
+  80239b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80239e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8023a6:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8023ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023af:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023b4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023b9:	e8 72 fe ff ff       	call   802230 <nsipc>
+  8023be:	89 c3                	mov    %eax,%ebx
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	78 22                	js     8023e6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023c4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023c9:	39 c6                	cmp    %eax,%esi
+  8023cb:	0f 4e c6             	cmovle %esi,%eax
+  8023ce:	39 c3                	cmp    %eax,%ebx
+  8023d0:	7f 1d                	jg     8023ef <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023d2:	83 ec 04             	sub    $0x4,%esp
+  8023d5:	53                   	push   %ebx
+  8023d6:	68 00 70 80 00       	push   $0x807000
+  8023db:	ff 75 0c             	push   0xc(%ebp)
+  8023de:	e8 ef e5 ff ff       	call   8009d2 <memmove>
+  8023e3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023e6:	89 d8                	mov    %ebx,%eax
+  8023e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023eb:	5b                   	pop    %ebx
+  8023ec:	5e                   	pop    %esi
+  8023ed:	5d                   	pop    %ebp
+  8023ee:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023ef:	68 e7 2f 80 00       	push   $0x802fe7
+  8023f4:	68 af 2f 80 00       	push   $0x802faf
+  8023f9:	6a 62                	push   $0x62
+  8023fb:	68 fc 2f 80 00       	push   $0x802ffc
+  802400:	e8 24 dd ff ff       	call   800129 <_panic>
+
+00802405 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+  802408:	53                   	push   %ebx
+  802409:	83 ec 04             	sub    $0x4,%esp
+  80240c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80240f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802412:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802417:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80241d:	7f 2e                	jg     80244d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80241f:	83 ec 04             	sub    $0x4,%esp
+  802422:	53                   	push   %ebx
+  802423:	ff 75 0c             	push   0xc(%ebp)
+  802426:	68 0c 70 80 00       	push   $0x80700c
+  80242b:	e8 a2 e5 ff ff       	call   8009d2 <memmove>
+	nsipcbuf.send.req_size = size;
+  802430:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802436:	8b 45 14             	mov    0x14(%ebp),%eax
+  802439:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80243e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802443:	e8 e8 fd ff ff       	call   802230 <nsipc>
+}
+  802448:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80244b:	c9                   	leave
+  80244c:	c3                   	ret
+	assert(size < 1600);
+  80244d:	68 08 30 80 00       	push   $0x803008
+  802452:	68 af 2f 80 00       	push   $0x802faf
+  802457:	6a 6d                	push   $0x6d
+  802459:	68 fc 2f 80 00       	push   $0x802ffc
+  80245e:	e8 c6 dc ff ff       	call   800129 <_panic>
+
+00802463 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802463:	55                   	push   %ebp
+  802464:	89 e5                	mov    %esp,%ebp
+  802466:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802469:	8b 45 08             	mov    0x8(%ebp),%eax
+  80246c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802471:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802474:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802479:	8b 45 10             	mov    0x10(%ebp),%eax
+  80247c:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802481:	b8 09 00 00 00       	mov    $0x9,%eax
+  802486:	e8 a5 fd ff ff       	call   802230 <nsipc>
+}
+  80248b:	c9                   	leave
+  80248c:	c3                   	ret
+
+0080248d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80248d:	55                   	push   %ebp
+  80248e:	89 e5                	mov    %esp,%ebp
+  802490:	56                   	push   %esi
+  802491:	53                   	push   %ebx
+  802492:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802495:	83 ec 0c             	sub    $0xc,%esp
+  802498:	ff 75 08             	push   0x8(%ebp)
+  80249b:	e8 2a f3 ff ff       	call   8017ca <fd2data>
+  8024a0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8024a2:	83 c4 08             	add    $0x8,%esp
+  8024a5:	68 14 30 80 00       	push   $0x803014
+  8024aa:	53                   	push   %ebx
+  8024ab:	e8 9c e3 ff ff       	call   80084c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8024b0:	8b 46 04             	mov    0x4(%esi),%eax
+  8024b3:	2b 06                	sub    (%esi),%eax
+  8024b5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024bb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024c2:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024c5:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024cc:	40 80 00 
+	return 0;
+}
+  8024cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d7:	5b                   	pop    %ebx
+  8024d8:	5e                   	pop    %esi
+  8024d9:	5d                   	pop    %ebp
+  8024da:	c3                   	ret
+
+008024db <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024db:	55                   	push   %ebp
+  8024dc:	89 e5                	mov    %esp,%ebp
+  8024de:	53                   	push   %ebx
+  8024df:	83 ec 0c             	sub    $0xc,%esp
+  8024e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024e5:	53                   	push   %ebx
+  8024e6:	6a 00                	push   $0x0
+  8024e8:	e8 32 e9 ff ff       	call   800e1f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024ed:	89 1c 24             	mov    %ebx,(%esp)
+  8024f0:	e8 d5 f2 ff ff       	call   8017ca <fd2data>
+  8024f5:	83 c4 08             	add    $0x8,%esp
+  8024f8:	50                   	push   %eax
+  8024f9:	6a 00                	push   $0x0
+  8024fb:	e8 1f e9 ff ff       	call   800e1f <sys_page_unmap>
+}
+  802500:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802503:	c9                   	leave
+  802504:	c3                   	ret
+
+00802505 <_pipeisclosed>:
+{
+  802505:	55                   	push   %ebp
+  802506:	89 e5                	mov    %esp,%ebp
+  802508:	57                   	push   %edi
+  802509:	56                   	push   %esi
+  80250a:	53                   	push   %ebx
+  80250b:	83 ec 1c             	sub    $0x1c,%esp
+  80250e:	89 c7                	mov    %eax,%edi
+  802510:	89 d6                	mov    %edx,%esi
+  802512:	eb 3c                	jmp    802550 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802514:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802517:	83 ec 0c             	sub    $0xc,%esp
+  80251a:	57                   	push   %edi
+  80251b:	e8 13 06 00 00       	call   802b33 <pageref>
+  802520:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802523:	89 34 24             	mov    %esi,(%esp)
+  802526:	e8 08 06 00 00       	call   802b33 <pageref>
+  80252b:	89 c2                	mov    %eax,%edx
+  80252d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80252f:	05 00 00 00 20       	add    $0x20000000,%eax
+  802534:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802537:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80253d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802542:	76 31                	jbe    802575 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802544:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802547:	39 c3                	cmp    %eax,%ebx
+  802549:	74 76                	je     8025c1 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80254b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80254e:	74 36                	je     802586 <_pipeisclosed+0x81>
+  802550:	89 e0                	mov    %esp,%eax
+  802552:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802557:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80255d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802562:	77 b0                	ja     802514 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802564:	c1 e8 10             	shr    $0x10,%eax
+  802567:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80256d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802573:	eb 9f                	jmp    802514 <_pipeisclosed+0xf>
+  802575:	c1 e8 10             	shr    $0x10,%eax
+  802578:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80257e:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802584:	eb be                	jmp    802544 <_pipeisclosed+0x3f>
+  802586:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802588:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80258d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802593:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802598:	76 16                	jbe    8025b0 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80259a:	8b 42 58             	mov    0x58(%edx),%eax
+  80259d:	6a 01                	push   $0x1
+  80259f:	50                   	push   %eax
+  8025a0:	53                   	push   %ebx
+  8025a1:	68 1b 30 80 00       	push   $0x80301b
+  8025a6:	e8 59 dc ff ff       	call   800204 <cprintf>
+  8025ab:	83 c4 10             	add    $0x10,%esp
+  8025ae:	eb a0                	jmp    802550 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025b0:	c1 e8 10             	shr    $0x10,%eax
+  8025b3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025b9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025bf:	eb d9                	jmp    80259a <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8025c1:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025c4:	0f 94 c0             	sete   %al
+  8025c7:	0f b6 c0             	movzbl %al,%eax
+}
+  8025ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025cd:	5b                   	pop    %ebx
+  8025ce:	5e                   	pop    %esi
+  8025cf:	5f                   	pop    %edi
+  8025d0:	5d                   	pop    %ebp
+  8025d1:	c3                   	ret
+
+008025d2 <devpipe_write>:
+{
+  8025d2:	55                   	push   %ebp
+  8025d3:	89 e5                	mov    %esp,%ebp
+  8025d5:	57                   	push   %edi
+  8025d6:	56                   	push   %esi
+  8025d7:	53                   	push   %ebx
+  8025d8:	83 ec 28             	sub    $0x28,%esp
+  8025db:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025de:	56                   	push   %esi
+  8025df:	e8 e6 f1 ff ff       	call   8017ca <fd2data>
+  8025e4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025e6:	83 c4 10             	add    $0x10,%esp
+  8025e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ee:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025f1:	75 09                	jne    8025fc <devpipe_write+0x2a>
+	return i;
+  8025f3:	89 f8                	mov    %edi,%eax
+  8025f5:	eb 23                	jmp    80261a <devpipe_write+0x48>
+			sys_yield();
+  8025f7:	e8 02 e7 ff ff       	call   800cfe <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025fc:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025ff:	8b 0b                	mov    (%ebx),%ecx
+  802601:	8d 51 20             	lea    0x20(%ecx),%edx
+  802604:	39 d0                	cmp    %edx,%eax
+  802606:	72 1a                	jb     802622 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802608:	89 da                	mov    %ebx,%edx
+  80260a:	89 f0                	mov    %esi,%eax
+  80260c:	e8 f4 fe ff ff       	call   802505 <_pipeisclosed>
+  802611:	85 c0                	test   %eax,%eax
+  802613:	74 e2                	je     8025f7 <devpipe_write+0x25>
+				return 0;
+  802615:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80261a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80261d:	5b                   	pop    %ebx
+  80261e:	5e                   	pop    %esi
+  80261f:	5f                   	pop    %edi
+  802620:	5d                   	pop    %ebp
+  802621:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802622:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802625:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802629:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80262c:	89 c2                	mov    %eax,%edx
+  80262e:	c1 fa 1f             	sar    $0x1f,%edx
+  802631:	89 d1                	mov    %edx,%ecx
+  802633:	c1 e9 1b             	shr    $0x1b,%ecx
+  802636:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802639:	83 e2 1f             	and    $0x1f,%edx
+  80263c:	29 ca                	sub    %ecx,%edx
+  80263e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802642:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802646:	83 c0 01             	add    $0x1,%eax
+  802649:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80264c:	83 c7 01             	add    $0x1,%edi
+  80264f:	eb 9d                	jmp    8025ee <devpipe_write+0x1c>
+
+00802651 <devpipe_read>:
+{
+  802651:	55                   	push   %ebp
+  802652:	89 e5                	mov    %esp,%ebp
+  802654:	57                   	push   %edi
+  802655:	56                   	push   %esi
+  802656:	53                   	push   %ebx
+  802657:	83 ec 18             	sub    $0x18,%esp
+  80265a:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80265d:	57                   	push   %edi
+  80265e:	e8 67 f1 ff ff       	call   8017ca <fd2data>
+  802663:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802665:	83 c4 10             	add    $0x10,%esp
+  802668:	be 00 00 00 00       	mov    $0x0,%esi
+  80266d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802670:	75 13                	jne    802685 <devpipe_read+0x34>
+	return i;
+  802672:	89 f0                	mov    %esi,%eax
+  802674:	eb 02                	jmp    802678 <devpipe_read+0x27>
+				return i;
+  802676:	89 f0                	mov    %esi,%eax
+}
+  802678:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80267b:	5b                   	pop    %ebx
+  80267c:	5e                   	pop    %esi
+  80267d:	5f                   	pop    %edi
+  80267e:	5d                   	pop    %ebp
+  80267f:	c3                   	ret
+			sys_yield();
+  802680:	e8 79 e6 ff ff       	call   800cfe <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802685:	8b 03                	mov    (%ebx),%eax
+  802687:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80268a:	75 18                	jne    8026a4 <devpipe_read+0x53>
+			if (i > 0)
+  80268c:	85 f6                	test   %esi,%esi
+  80268e:	75 e6                	jne    802676 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802690:	89 da                	mov    %ebx,%edx
+  802692:	89 f8                	mov    %edi,%eax
+  802694:	e8 6c fe ff ff       	call   802505 <_pipeisclosed>
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	74 e3                	je     802680 <devpipe_read+0x2f>
+				return 0;
+  80269d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a2:	eb d4                	jmp    802678 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026a4:	99                   	cltd
+  8026a5:	c1 ea 1b             	shr    $0x1b,%edx
+  8026a8:	01 d0                	add    %edx,%eax
+  8026aa:	83 e0 1f             	and    $0x1f,%eax
+  8026ad:	29 d0                	sub    %edx,%eax
+  8026af:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8026b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026b7:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8026ba:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026bd:	83 c6 01             	add    $0x1,%esi
+  8026c0:	eb ab                	jmp    80266d <devpipe_read+0x1c>
+
+008026c2 <pipe>:
+{
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	56                   	push   %esi
+  8026c6:	53                   	push   %ebx
+  8026c7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026cd:	50                   	push   %eax
+  8026ce:	e8 0e f1 ff ff       	call   8017e1 <fd_alloc>
+  8026d3:	89 c3                	mov    %eax,%ebx
+  8026d5:	83 c4 10             	add    $0x10,%esp
+  8026d8:	85 c0                	test   %eax,%eax
+  8026da:	0f 88 23 01 00 00    	js     802803 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026e0:	83 ec 04             	sub    $0x4,%esp
+  8026e3:	68 07 04 00 00       	push   $0x407
+  8026e8:	ff 75 f4             	push   -0xc(%ebp)
+  8026eb:	6a 00                	push   $0x0
+  8026ed:	e8 52 e6 ff ff       	call   800d44 <sys_page_alloc>
+  8026f2:	89 c3                	mov    %eax,%ebx
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	85 c0                	test   %eax,%eax
+  8026f9:	0f 88 04 01 00 00    	js     802803 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026ff:	83 ec 0c             	sub    $0xc,%esp
+  802702:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802705:	50                   	push   %eax
+  802706:	e8 d6 f0 ff ff       	call   8017e1 <fd_alloc>
+  80270b:	89 c3                	mov    %eax,%ebx
+  80270d:	83 c4 10             	add    $0x10,%esp
+  802710:	85 c0                	test   %eax,%eax
+  802712:	0f 88 db 00 00 00    	js     8027f3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802718:	83 ec 04             	sub    $0x4,%esp
+  80271b:	68 07 04 00 00       	push   $0x407
+  802720:	ff 75 f0             	push   -0x10(%ebp)
+  802723:	6a 00                	push   $0x0
+  802725:	e8 1a e6 ff ff       	call   800d44 <sys_page_alloc>
+  80272a:	89 c3                	mov    %eax,%ebx
+  80272c:	83 c4 10             	add    $0x10,%esp
+  80272f:	85 c0                	test   %eax,%eax
+  802731:	0f 88 bc 00 00 00    	js     8027f3 <pipe+0x131>
+	va = fd2data(fd0);
+  802737:	83 ec 0c             	sub    $0xc,%esp
+  80273a:	ff 75 f4             	push   -0xc(%ebp)
+  80273d:	e8 88 f0 ff ff       	call   8017ca <fd2data>
+  802742:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802744:	83 c4 0c             	add    $0xc,%esp
+  802747:	68 07 04 00 00       	push   $0x407
+  80274c:	50                   	push   %eax
+  80274d:	6a 00                	push   $0x0
+  80274f:	e8 f0 e5 ff ff       	call   800d44 <sys_page_alloc>
+  802754:	89 c3                	mov    %eax,%ebx
+  802756:	83 c4 10             	add    $0x10,%esp
+  802759:	85 c0                	test   %eax,%eax
+  80275b:	0f 88 82 00 00 00    	js     8027e3 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802761:	83 ec 0c             	sub    $0xc,%esp
+  802764:	ff 75 f0             	push   -0x10(%ebp)
+  802767:	e8 5e f0 ff ff       	call   8017ca <fd2data>
+  80276c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802773:	50                   	push   %eax
+  802774:	6a 00                	push   $0x0
+  802776:	56                   	push   %esi
+  802777:	6a 00                	push   $0x0
+  802779:	e8 33 e6 ff ff       	call   800db1 <sys_page_map>
+  80277e:	89 c3                	mov    %eax,%ebx
+  802780:	83 c4 20             	add    $0x20,%esp
+  802783:	85 c0                	test   %eax,%eax
+  802785:	78 4e                	js     8027d5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802787:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80278c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80278f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802791:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802794:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80279b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80279e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8027a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8027a3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8027aa:	83 ec 0c             	sub    $0xc,%esp
+  8027ad:	ff 75 f4             	push   -0xc(%ebp)
+  8027b0:	e8 05 f0 ff ff       	call   8017ba <fd2num>
+  8027b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027b8:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027ba:	83 c4 04             	add    $0x4,%esp
+  8027bd:	ff 75 f0             	push   -0x10(%ebp)
+  8027c0:	e8 f5 ef ff ff       	call   8017ba <fd2num>
+  8027c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027c8:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027cb:	83 c4 10             	add    $0x10,%esp
+  8027ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027d3:	eb 2e                	jmp    802803 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027d5:	83 ec 08             	sub    $0x8,%esp
+  8027d8:	56                   	push   %esi
+  8027d9:	6a 00                	push   $0x0
+  8027db:	e8 3f e6 ff ff       	call   800e1f <sys_page_unmap>
+  8027e0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027e3:	83 ec 08             	sub    $0x8,%esp
+  8027e6:	ff 75 f0             	push   -0x10(%ebp)
+  8027e9:	6a 00                	push   $0x0
+  8027eb:	e8 2f e6 ff ff       	call   800e1f <sys_page_unmap>
+  8027f0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027f3:	83 ec 08             	sub    $0x8,%esp
+  8027f6:	ff 75 f4             	push   -0xc(%ebp)
+  8027f9:	6a 00                	push   $0x0
+  8027fb:	e8 1f e6 ff ff       	call   800e1f <sys_page_unmap>
+  802800:	83 c4 10             	add    $0x10,%esp
+}
+  802803:	89 d8                	mov    %ebx,%eax
+  802805:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802808:	5b                   	pop    %ebx
+  802809:	5e                   	pop    %esi
+  80280a:	5d                   	pop    %ebp
+  80280b:	c3                   	ret
+
+0080280c <pipeisclosed>:
+{
+  80280c:	55                   	push   %ebp
+  80280d:	89 e5                	mov    %esp,%ebp
+  80280f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802812:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802815:	50                   	push   %eax
+  802816:	ff 75 08             	push   0x8(%ebp)
+  802819:	e8 19 f0 ff ff       	call   801837 <fd_lookup>
+  80281e:	83 c4 10             	add    $0x10,%esp
+  802821:	85 c0                	test   %eax,%eax
+  802823:	78 18                	js     80283d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802825:	83 ec 0c             	sub    $0xc,%esp
+  802828:	ff 75 f4             	push   -0xc(%ebp)
+  80282b:	e8 9a ef ff ff       	call   8017ca <fd2data>
+  802830:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802832:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802835:	e8 cb fc ff ff       	call   802505 <_pipeisclosed>
+  80283a:	83 c4 10             	add    $0x10,%esp
+}
+  80283d:	c9                   	leave
+  80283e:	c3                   	ret
+
+0080283f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80283f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802844:	c3                   	ret
+
+00802845 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802845:	55                   	push   %ebp
+  802846:	89 e5                	mov    %esp,%ebp
+  802848:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80284b:	68 33 30 80 00       	push   $0x803033
+  802850:	ff 75 0c             	push   0xc(%ebp)
+  802853:	e8 f4 df ff ff       	call   80084c <strcpy>
+	return 0;
+}
+  802858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285d:	c9                   	leave
+  80285e:	c3                   	ret
+
+0080285f <devcons_write>:
+{
+  80285f:	55                   	push   %ebp
+  802860:	89 e5                	mov    %esp,%ebp
+  802862:	57                   	push   %edi
+  802863:	56                   	push   %esi
+  802864:	53                   	push   %ebx
+  802865:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80286b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802870:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802876:	eb 2e                	jmp    8028a6 <devcons_write+0x47>
+		m = n - tot;
+  802878:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80287b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80287d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802882:	39 c3                	cmp    %eax,%ebx
+  802884:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802887:	83 ec 04             	sub    $0x4,%esp
+  80288a:	53                   	push   %ebx
+  80288b:	89 f0                	mov    %esi,%eax
+  80288d:	03 45 0c             	add    0xc(%ebp),%eax
+  802890:	50                   	push   %eax
+  802891:	57                   	push   %edi
+  802892:	e8 3b e1 ff ff       	call   8009d2 <memmove>
+		sys_cputs(buf, m);
+  802897:	83 c4 08             	add    $0x8,%esp
+  80289a:	53                   	push   %ebx
+  80289b:	57                   	push   %edi
+  80289c:	e8 24 e3 ff ff       	call   800bc5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028a1:	01 de                	add    %ebx,%esi
+  8028a3:	83 c4 10             	add    $0x10,%esp
+  8028a6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8028a9:	72 cd                	jb     802878 <devcons_write+0x19>
+}
+  8028ab:	89 f0                	mov    %esi,%eax
+  8028ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028b0:	5b                   	pop    %ebx
+  8028b1:	5e                   	pop    %esi
+  8028b2:	5f                   	pop    %edi
+  8028b3:	5d                   	pop    %ebp
+  8028b4:	c3                   	ret
+
+008028b5 <devcons_read>:
+{
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8028bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028c4:	75 07                	jne    8028cd <devcons_read+0x18>
+  8028c6:	eb 1f                	jmp    8028e7 <devcons_read+0x32>
+		sys_yield();
+  8028c8:	e8 31 e4 ff ff       	call   800cfe <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028cd:	e8 37 e3 ff ff       	call   800c09 <sys_cgetc>
+  8028d2:	85 c0                	test   %eax,%eax
+  8028d4:	74 f2                	je     8028c8 <devcons_read+0x13>
+	if (c < 0)
+  8028d6:	78 0f                	js     8028e7 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028d8:	83 f8 04             	cmp    $0x4,%eax
+  8028db:	74 0c                	je     8028e9 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028e0:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028e2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028e7:	c9                   	leave
+  8028e8:	c3                   	ret
+		return 0;
+  8028e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ee:	eb f7                	jmp    8028e7 <devcons_read+0x32>
+
+008028f0 <cputchar>:
+{
+  8028f0:	55                   	push   %ebp
+  8028f1:	89 e5                	mov    %esp,%ebp
+  8028f3:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f9:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028fc:	6a 01                	push   $0x1
+  8028fe:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802901:	50                   	push   %eax
+  802902:	e8 be e2 ff ff       	call   800bc5 <sys_cputs>
+}
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	c9                   	leave
+  80290b:	c3                   	ret
+
+0080290c <getchar>:
+{
+  80290c:	55                   	push   %ebp
+  80290d:	89 e5                	mov    %esp,%ebp
+  80290f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802912:	6a 01                	push   $0x1
+  802914:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802917:	50                   	push   %eax
+  802918:	6a 00                	push   $0x0
+  80291a:	e8 9e f1 ff ff       	call   801abd <read>
+	if (r < 0)
+  80291f:	83 c4 10             	add    $0x10,%esp
+  802922:	85 c0                	test   %eax,%eax
+  802924:	78 06                	js     80292c <getchar+0x20>
+	if (r < 1)
+  802926:	74 06                	je     80292e <getchar+0x22>
+	return c;
+  802928:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80292c:	c9                   	leave
+  80292d:	c3                   	ret
+		return -E_EOF;
+  80292e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802933:	eb f7                	jmp    80292c <getchar+0x20>
+
+00802935 <iscons>:
+{
+  802935:	55                   	push   %ebp
+  802936:	89 e5                	mov    %esp,%ebp
+  802938:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80293b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80293e:	50                   	push   %eax
+  80293f:	ff 75 08             	push   0x8(%ebp)
+  802942:	e8 f0 ee ff ff       	call   801837 <fd_lookup>
+  802947:	83 c4 10             	add    $0x10,%esp
+  80294a:	85 c0                	test   %eax,%eax
+  80294c:	78 11                	js     80295f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80294e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802951:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802957:	39 10                	cmp    %edx,(%eax)
+  802959:	0f 94 c0             	sete   %al
+  80295c:	0f b6 c0             	movzbl %al,%eax
+}
+  80295f:	c9                   	leave
+  802960:	c3                   	ret
+
+00802961 <opencons>:
+{
+  802961:	55                   	push   %ebp
+  802962:	89 e5                	mov    %esp,%ebp
+  802964:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802967:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80296a:	50                   	push   %eax
+  80296b:	e8 71 ee ff ff       	call   8017e1 <fd_alloc>
+  802970:	83 c4 10             	add    $0x10,%esp
+  802973:	85 c0                	test   %eax,%eax
+  802975:	78 3a                	js     8029b1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802977:	83 ec 04             	sub    $0x4,%esp
+  80297a:	68 07 04 00 00       	push   $0x407
+  80297f:	ff 75 f4             	push   -0xc(%ebp)
+  802982:	6a 00                	push   $0x0
+  802984:	e8 bb e3 ff ff       	call   800d44 <sys_page_alloc>
+  802989:	83 c4 10             	add    $0x10,%esp
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	78 21                	js     8029b1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802990:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802993:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802999:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80299b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80299e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029a5:	83 ec 0c             	sub    $0xc,%esp
+  8029a8:	50                   	push   %eax
+  8029a9:	e8 0c ee ff ff       	call   8017ba <fd2num>
+  8029ae:	83 c4 10             	add    $0x10,%esp
+}
+  8029b1:	c9                   	leave
+  8029b2:	c3                   	ret
+
+008029b3 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  8029b3:	55                   	push   %ebp
+  8029b4:	89 e5                	mov    %esp,%ebp
+  8029b6:	56                   	push   %esi
+  8029b7:	53                   	push   %ebx
+  8029b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8029c1:	85 c0                	test   %eax,%eax
+  8029c3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029c8:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8029cb:	83 ec 08             	sub    $0x8,%esp
+  8029ce:	ff 75 14             	push   0x14(%ebp)
+  8029d1:	50                   	push   %eax
+  8029d2:	e8 7e e7 ff ff       	call   801155 <sys_ipc_recv_until>
+  8029d7:	83 c4 10             	add    $0x10,%esp
+  8029da:	85 c0                	test   %eax,%eax
+  8029dc:	78 61                	js     802a3f <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029de:	85 f6                	test   %esi,%esi
+  8029e0:	74 1c                	je     8029fe <ipc_recv_until+0x4b>
+  8029e2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029e4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029e9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029ef:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029f4:	76 5f                	jbe    802a55 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029f6:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029fc:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029fe:	85 db                	test   %ebx,%ebx
+  802a00:	74 1c                	je     802a1e <ipc_recv_until+0x6b>
+  802a02:	89 e0                	mov    %esp,%eax
+  802a04:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a09:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a0f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a14:	76 50                	jbe    802a66 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802a16:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802a1c:	89 03                	mov    %eax,(%ebx)
+  802a1e:	89 e0                	mov    %esp,%eax
+  802a20:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a25:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a2b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a30:	76 45                	jbe    802a77 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a32:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a3b:	5b                   	pop    %ebx
+  802a3c:	5e                   	pop    %esi
+  802a3d:	5d                   	pop    %ebp
+  802a3e:	c3                   	ret
+		if (from_env_store)
+  802a3f:	85 f6                	test   %esi,%esi
+  802a41:	74 06                	je     802a49 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a43:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a49:	85 db                	test   %ebx,%ebx
+  802a4b:	74 eb                	je     802a38 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a4d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a53:	eb e3                	jmp    802a38 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a55:	c1 e8 10             	shr    $0x10,%eax
+  802a58:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a5e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a64:	eb 90                	jmp    8029f6 <ipc_recv_until+0x43>
+  802a66:	c1 e8 10             	shr    $0x10,%eax
+  802a69:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a6f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a75:	eb 9f                	jmp    802a16 <ipc_recv_until+0x63>
+  802a77:	c1 e8 10             	shr    $0x10,%eax
+  802a7a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a80:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a86:	eb aa                	jmp    802a32 <ipc_recv_until+0x7f>
+
+00802a88 <ipc_recv>:
+{
+  802a88:	55                   	push   %ebp
+  802a89:	89 e5                	mov    %esp,%ebp
+  802a8b:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a8e:	6a 00                	push   $0x0
+  802a90:	ff 75 10             	push   0x10(%ebp)
+  802a93:	ff 75 0c             	push   0xc(%ebp)
+  802a96:	ff 75 08             	push   0x8(%ebp)
+  802a99:	e8 15 ff ff ff       	call   8029b3 <ipc_recv_until>
+}
+  802a9e:	c9                   	leave
+  802a9f:	c3                   	ret
+
+00802aa0 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802aa0:	55                   	push   %ebp
+  802aa1:	89 e5                	mov    %esp,%ebp
+  802aa3:	57                   	push   %edi
+  802aa4:	56                   	push   %esi
+  802aa5:	53                   	push   %ebx
+  802aa6:	83 ec 0c             	sub    $0xc,%esp
+  802aa9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802aac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802aaf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802ab2:	85 db                	test   %ebx,%ebx
+  802ab4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ab9:	0f 44 d8             	cmove  %eax,%ebx
+  802abc:	eb 05                	jmp    802ac3 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802abe:	e8 3b e2 ff ff       	call   800cfe <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802ac3:	ff 75 14             	push   0x14(%ebp)
+  802ac6:	53                   	push   %ebx
+  802ac7:	56                   	push   %esi
+  802ac8:	57                   	push   %edi
+  802ac9:	e8 d3 e5 ff ff       	call   8010a1 <sys_ipc_try_send>
+  802ace:	83 c4 10             	add    $0x10,%esp
+  802ad1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ad4:	74 e8                	je     802abe <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802ad6:	85 c0                	test   %eax,%eax
+  802ad8:	78 08                	js     802ae2 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802ada:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802add:	5b                   	pop    %ebx
+  802ade:	5e                   	pop    %esi
+  802adf:	5f                   	pop    %edi
+  802ae0:	5d                   	pop    %ebp
+  802ae1:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802ae2:	50                   	push   %eax
+  802ae3:	68 3f 30 80 00       	push   $0x80303f
+  802ae8:	6a 4f                	push   $0x4f
+  802aea:	68 52 30 80 00       	push   $0x803052
+  802aef:	e8 35 d6 ff ff       	call   800129 <_panic>
+
+00802af4 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802af4:	55                   	push   %ebp
+  802af5:	89 e5                	mov    %esp,%ebp
+  802af7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802afa:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802aff:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802b05:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b0b:	8b 52 50             	mov    0x50(%edx),%edx
+  802b0e:	39 ca                	cmp    %ecx,%edx
+  802b10:	74 11                	je     802b23 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802b12:	83 c0 01             	add    $0x1,%eax
+  802b15:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802b1a:	75 e3                	jne    802aff <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b21:	eb 0e                	jmp    802b31 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802b23:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b29:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b2e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b31:	5d                   	pop    %ebp
+  802b32:	c3                   	ret
+
+00802b33 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b33:	55                   	push   %ebp
+  802b34:	89 e5                	mov    %esp,%ebp
+  802b36:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b39:	89 c2                	mov    %eax,%edx
+  802b3b:	c1 ea 16             	shr    $0x16,%edx
+  802b3e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b45:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b4a:	f6 c1 01             	test   $0x1,%cl
+  802b4d:	74 1a                	je     802b69 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b4f:	c1 e8 0c             	shr    $0xc,%eax
+  802b52:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b59:	a8 01                	test   $0x1,%al
+  802b5b:	74 0c                	je     802b69 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b5d:	c1 e8 0c             	shr    $0xc,%eax
+  802b60:	c1 e0 04             	shl    $0x4,%eax
+  802b63:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b69:	89 d0                	mov    %edx,%eax
+  802b6b:	5d                   	pop    %ebp
+  802b6c:	c3                   	ret
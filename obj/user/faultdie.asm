@@ -0,0 +1,6297 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void*)utf->utf_fault_va;
+	uint32_t err = utf->utf_err;
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 20 2c 80 00       	push   $0x802c20
+  80004a:	e8 d0 01 00 00       	call   80021f <cprintf>
+	sys_env_destroy(sys_getenvid());
+  80004f:	e8 7f 0c 00 00       	call   800cd3 <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 0e 0c 00 00       	call   800c6a <sys_env_destroy>
+}
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(handler);
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 64 17 00 00       	call   8017d5 <set_pgfault_handler>
+	*(int*)0xDeadBeef = 0;
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+}
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	57                   	push   %edi
+  800084:	56                   	push   %esi
+  800085:	53                   	push   %ebx
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80008c:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80008f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800094:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800096:	c1 ea 0b             	shr    $0xb,%edx
+  800099:	83 f2 01             	xor    $0x1,%edx
+  80009c:	83 e2 01             	and    $0x1,%edx
+  80009f:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000a5:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000ac:	00 00 00 
+	envid = sys_getenvid();
+  8000af:	e8 1f 0c 00 00       	call   800cd3 <sys_getenvid>
+  8000b4:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000bb:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8000c1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000c7:	8b 52 48             	mov    0x48(%edx),%edx
+  8000ca:	39 ca                	cmp    %ecx,%edx
+  8000cc:	74 27                	je     8000f5 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8000ce:	83 c0 01             	add    $0x1,%eax
+  8000d1:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000d6:	75 e3                	jne    8000bb <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000d8:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000df:	75 24                	jne    800105 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000e1:	83 ec 04             	sub    $0x4,%esp
+  8000e4:	68 3c 2c 80 00       	push   $0x802c3c
+  8000e9:	6a 23                	push   $0x23
+  8000eb:	68 5f 2c 80 00       	push   $0x802c5f
+  8000f0:	e8 4f 00 00 00       	call   800144 <_panic>
+			mainenv = &envs[i];
+  8000f5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800100:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800105:	85 ff                	test   %edi,%edi
+  800107:	7e 07                	jle    800110 <libmain+0x90>
+		binaryname = argv[0];
+  800109:	8b 06                	mov    (%esi),%eax
+  80010b:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800110:	83 ec 08             	sub    $0x8,%esp
+  800113:	56                   	push   %esi
+  800114:	57                   	push   %edi
+  800115:	e8 47 ff ff ff       	call   800061 <umain>
+
+	// exit gracefully
+	exit();
+  80011a:	e8 0b 00 00 00       	call   80012a <exit>
+}
+  80011f:	83 c4 10             	add    $0x10,%esp
+  800122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800125:	5b                   	pop    %ebx
+  800126:	5e                   	pop    %esi
+  800127:	5f                   	pop    %edi
+  800128:	5d                   	pop    %ebp
+  800129:	c3                   	ret
+
+0080012a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012a:	55                   	push   %ebp
+  80012b:	89 e5                	mov    %esp,%ebp
+  80012d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800130:	e8 23 19 00 00       	call   801a58 <close_all>
+	sys_env_destroy(0);
+  800135:	83 ec 0c             	sub    $0xc,%esp
+  800138:	6a 00                	push   $0x0
+  80013a:	e8 2b 0b 00 00       	call   800c6a <sys_env_destroy>
+}
+  80013f:	83 c4 10             	add    $0x10,%esp
+  800142:	c9                   	leave
+  800143:	c3                   	ret
+
+00800144 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	56                   	push   %esi
+  800148:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800149:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80014c:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800152:	e8 7c 0b 00 00       	call   800cd3 <sys_getenvid>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	ff 75 0c             	push   0xc(%ebp)
+  80015d:	ff 75 08             	push   0x8(%ebp)
+  800160:	56                   	push   %esi
+  800161:	50                   	push   %eax
+  800162:	68 78 2c 80 00       	push   $0x802c78
+  800167:	e8 b3 00 00 00       	call   80021f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80016c:	83 c4 18             	add    $0x18,%esp
+  80016f:	53                   	push   %ebx
+  800170:	ff 75 10             	push   0x10(%ebp)
+  800173:	e8 56 00 00 00       	call   8001ce <vcprintf>
+	cprintf("\n");
+  800178:	c7 04 24 20 31 80 00 	movl   $0x803120,(%esp)
+  80017f:	e8 9b 00 00 00       	call   80021f <cprintf>
+  800184:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800187:	cc                   	int3
+	while (1)
+  800188:	eb fd                	jmp    800187 <_panic+0x43>
+
+0080018a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80018a:	55                   	push   %ebp
+  80018b:	89 e5                	mov    %esp,%ebp
+  80018d:	53                   	push   %ebx
+  80018e:	83 ec 04             	sub    $0x4,%esp
+  800191:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800194:	8b 13                	mov    (%ebx),%edx
+  800196:	8d 42 01             	lea    0x1(%edx),%eax
+  800199:	89 03                	mov    %eax,(%ebx)
+  80019b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80019e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001a2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a7:	74 09                	je     8001b2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001a9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b0:	c9                   	leave
+  8001b1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001b2:	83 ec 08             	sub    $0x8,%esp
+  8001b5:	68 ff 00 00 00       	push   $0xff
+  8001ba:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001bd:	50                   	push   %eax
+  8001be:	e8 1d 0a 00 00       	call   800be0 <sys_cputs>
+		b->idx = 0;
+  8001c3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001c9:	83 c4 10             	add    $0x10,%esp
+  8001cc:	eb db                	jmp    8001a9 <putch+0x1f>
+
+008001ce <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001d7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001de:	00 00 00 
+	b.cnt = 0;
+  8001e1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001eb:	ff 75 0c             	push   0xc(%ebp)
+  8001ee:	ff 75 08             	push   0x8(%ebp)
+  8001f1:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f7:	50                   	push   %eax
+  8001f8:	68 8a 01 80 00       	push   $0x80018a
+  8001fd:	e8 fb 00 00 00       	call   8002fd <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800202:	83 c4 08             	add    $0x8,%esp
+  800205:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80020b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800211:	50                   	push   %eax
+  800212:	e8 c9 09 00 00       	call   800be0 <sys_cputs>
+
+	return b.cnt;
+}
+  800217:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80021d:	c9                   	leave
+  80021e:	c3                   	ret
+
+0080021f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80021f:	55                   	push   %ebp
+  800220:	89 e5                	mov    %esp,%ebp
+  800222:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800225:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800228:	50                   	push   %eax
+  800229:	ff 75 08             	push   0x8(%ebp)
+  80022c:	e8 9d ff ff ff       	call   8001ce <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+
+00800233 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	57                   	push   %edi
+  800237:	56                   	push   %esi
+  800238:	53                   	push   %ebx
+  800239:	83 ec 1c             	sub    $0x1c,%esp
+  80023c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80023f:	89 d6                	mov    %edx,%esi
+  800241:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800244:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800247:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80024a:	73 0b                	jae    800257 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80024c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80024f:	c1 e7 08             	shl    $0x8,%edi
+  800252:	0b 7d 10             	or     0x10(%ebp),%edi
+  800255:	eb 36                	jmp    80028d <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800257:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80025a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025f:	f7 75 08             	divl   0x8(%ebp)
+  800262:	89 c1                	mov    %eax,%ecx
+  800264:	ff 75 14             	push   0x14(%ebp)
+  800267:	ff 75 10             	push   0x10(%ebp)
+  80026a:	83 eb 01             	sub    $0x1,%ebx
+  80026d:	53                   	push   %ebx
+  80026e:	ff 75 08             	push   0x8(%ebp)
+  800271:	89 f2                	mov    %esi,%edx
+  800273:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800276:	e8 b8 ff ff ff       	call   800233 <printnum>
+  80027b:	83 c4 10             	add    $0x10,%esp
+  80027e:	eb 14                	jmp    800294 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800280:	83 ec 08             	sub    $0x8,%esp
+  800283:	56                   	push   %esi
+  800284:	57                   	push   %edi
+  800285:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800288:	ff d0                	call   *%eax
+  80028a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028d:	83 eb 01             	sub    $0x1,%ebx
+  800290:	85 db                	test   %ebx,%ebx
+  800292:	7f ec                	jg     800280 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800294:	83 ec 08             	sub    $0x8,%esp
+  800297:	56                   	push   %esi
+  800298:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80029b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a0:	f7 75 08             	divl   0x8(%ebp)
+  8002a3:	0f be 92 9b 2c 80 00 	movsbl 0x802c9b(%edx),%edx
+  8002aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ad:	c1 e0 08             	shl    $0x8,%eax
+  8002b0:	09 d0                	or     %edx,%eax
+  8002b2:	50                   	push   %eax
+  8002b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002b6:	ff d0                	call   *%eax
+}
+  8002b8:	83 c4 10             	add    $0x10,%esp
+  8002bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002be:	5b                   	pop    %ebx
+  8002bf:	5e                   	pop    %esi
+  8002c0:	5f                   	pop    %edi
+  8002c1:	5d                   	pop    %ebp
+  8002c2:	c3                   	ret
+
+008002c3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c3:	55                   	push   %ebp
+  8002c4:	89 e5                	mov    %esp,%ebp
+  8002c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002c9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002cd:	8b 10                	mov    (%eax),%edx
+  8002cf:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d2:	73 0a                	jae    8002de <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d7:	89 08                	mov    %ecx,(%eax)
+  8002d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dc:	88 02                	mov    %al,(%edx)
+}
+  8002de:	5d                   	pop    %ebp
+  8002df:	c3                   	ret
+
+008002e0 <printfmt>:
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002e9:	50                   	push   %eax
+  8002ea:	ff 75 10             	push   0x10(%ebp)
+  8002ed:	ff 75 0c             	push   0xc(%ebp)
+  8002f0:	ff 75 08             	push   0x8(%ebp)
+  8002f3:	e8 05 00 00 00       	call   8002fd <vprintfmt>
+}
+  8002f8:	83 c4 10             	add    $0x10,%esp
+  8002fb:	c9                   	leave
+  8002fc:	c3                   	ret
+
+008002fd <vprintfmt>:
+{
+  8002fd:	55                   	push   %ebp
+  8002fe:	89 e5                	mov    %esp,%ebp
+  800300:	57                   	push   %edi
+  800301:	56                   	push   %esi
+  800302:	53                   	push   %ebx
+  800303:	83 ec 3c             	sub    $0x3c,%esp
+  800306:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800309:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80030c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800313:	eb 16                	jmp    80032b <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800315:	83 ec 08             	sub    $0x8,%esp
+  800318:	ff 75 0c             	push   0xc(%ebp)
+  80031b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80031e:	c1 e2 08             	shl    $0x8,%edx
+  800321:	09 d0                	or     %edx,%eax
+  800323:	50                   	push   %eax
+  800324:	ff d7                	call   *%edi
+  800326:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800329:	89 de                	mov    %ebx,%esi
+  80032b:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80032e:	0f b6 06             	movzbl (%esi),%eax
+  800331:	83 f8 25             	cmp    $0x25,%eax
+  800334:	74 0c                	je     800342 <vprintfmt+0x45>
+			if (ch == '\0')
+  800336:	85 c0                	test   %eax,%eax
+  800338:	75 db                	jne    800315 <vprintfmt+0x18>
+}
+  80033a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033d:	5b                   	pop    %ebx
+  80033e:	5e                   	pop    %esi
+  80033f:	5f                   	pop    %edi
+  800340:	5d                   	pop    %ebp
+  800341:	c3                   	ret
+		padc = ' ';
+  800342:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800346:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80034d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800354:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80035b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800360:	8d 73 01             	lea    0x1(%ebx),%esi
+  800363:	0f b6 13             	movzbl (%ebx),%edx
+  800366:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800369:	3c 55                	cmp    $0x55,%al
+  80036b:	0f 87 2c 04 00 00    	ja     80079d <vprintfmt+0x4a0>
+  800371:	0f b6 c0             	movzbl %al,%eax
+  800374:	ff 24 85 e0 2d 80 00 	jmp    *0x802de0(,%eax,4)
+  80037b:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80037d:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800381:	eb dd                	jmp    800360 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800383:	89 f3                	mov    %esi,%ebx
+  800385:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800389:	eb d5                	jmp    800360 <vprintfmt+0x63>
+  80038b:	0f b6 d2             	movzbl %dl,%edx
+  80038e:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800390:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800395:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800398:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80039c:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80039f:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003a2:	83 fe 09             	cmp    $0x9,%esi
+  8003a5:	0f 87 8a 00 00 00    	ja     800435 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003ab:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003ae:	eb e5                	jmp    800395 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b3:	8b 00                	mov    (%eax),%eax
+  8003b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8003be:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c1:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8003c3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c7:	79 97                	jns    800360 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8003c9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003cf:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d6:	eb 88                	jmp    800360 <vprintfmt+0x63>
+			if (width < 0)
+  8003d8:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003db:	85 db                	test   %ebx,%ebx
+  8003dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e2:	0f 49 c3             	cmovns %ebx,%eax
+  8003e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e8:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003ea:	e9 71 ff ff ff       	jmp    800360 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ef:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003f1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f8:	e9 63 ff ff ff       	jmp    800360 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003fd:	8d 73 02             	lea    0x2(%ebx),%esi
+  800400:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800404:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80040b:	3c 67                	cmp    $0x67,%al
+  80040d:	0f 84 18 ff ff ff    	je     80032b <vprintfmt+0x2e>
+					attrib = 0x04;
+  800413:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80041a:	3c 72                	cmp    $0x72,%al
+  80041c:	0f 84 09 ff ff ff    	je     80032b <vprintfmt+0x2e>
+					attrib = 0x00;
+  800422:	3c 62                	cmp    $0x62,%al
+  800424:	0f 94 c0             	sete   %al
+  800427:	0f b6 c0             	movzbl %al,%eax
+  80042a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80042d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800430:	e9 f6 fe ff ff       	jmp    80032b <vprintfmt+0x2e>
+  800435:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800438:	eb 89                	jmp    8003c3 <vprintfmt+0xc6>
+			lflag++;
+  80043a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80043d:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80043f:	e9 1c ff ff ff       	jmp    800360 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800444:	8b 45 14             	mov    0x14(%ebp),%eax
+  800447:	8d 58 04             	lea    0x4(%eax),%ebx
+  80044a:	83 ec 08             	sub    $0x8,%esp
+  80044d:	ff 75 0c             	push   0xc(%ebp)
+  800450:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800453:	c1 e0 08             	shl    $0x8,%eax
+  800456:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800459:	0b 01                	or     (%ecx),%eax
+  80045b:	50                   	push   %eax
+  80045c:	ff d7                	call   *%edi
+			break;
+  80045e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800461:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800464:	e9 c2 fe ff ff       	jmp    80032b <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800469:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046c:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80046f:	8b 10                	mov    (%eax),%edx
+  800471:	89 d0                	mov    %edx,%eax
+  800473:	f7 d8                	neg    %eax
+  800475:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800478:	83 f8 12             	cmp    $0x12,%eax
+  80047b:	7f 25                	jg     8004a2 <vprintfmt+0x1a5>
+  80047d:	8b 14 85 40 2f 80 00 	mov    0x802f40(,%eax,4),%edx
+  800484:	85 d2                	test   %edx,%edx
+  800486:	74 1a                	je     8004a2 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800488:	52                   	push   %edx
+  800489:	68 b5 30 80 00       	push   $0x8030b5
+  80048e:	ff 75 0c             	push   0xc(%ebp)
+  800491:	57                   	push   %edi
+  800492:	e8 49 fe ff ff       	call   8002e0 <printfmt>
+  800497:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80049a:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80049d:	e9 89 fe ff ff       	jmp    80032b <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004a2:	50                   	push   %eax
+  8004a3:	68 b3 2c 80 00       	push   $0x802cb3
+  8004a8:	ff 75 0c             	push   0xc(%ebp)
+  8004ab:	57                   	push   %edi
+  8004ac:	e8 2f fe ff ff       	call   8002e0 <printfmt>
+  8004b1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b4:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004b7:	e9 6f fe ff ff       	jmp    80032b <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bf:	83 c0 04             	add    $0x4,%eax
+  8004c2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8004c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c8:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004ca:	85 c9                	test   %ecx,%ecx
+  8004cc:	b8 ac 2c 80 00       	mov    $0x802cac,%eax
+  8004d1:	0f 45 c1             	cmovne %ecx,%eax
+  8004d4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004d7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004db:	7e 06                	jle    8004e3 <vprintfmt+0x1e6>
+  8004dd:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004e1:	75 1a                	jne    8004fd <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004e6:	c1 e0 08             	shl    $0x8,%eax
+  8004e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004ec:	83 c8 3f             	or     $0x3f,%eax
+  8004ef:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004f2:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004f5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004f8:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004fb:	eb 6d                	jmp    80056a <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	ff 75 d0             	push   -0x30(%ebp)
+  800503:	ff 75 c8             	push   -0x38(%ebp)
+  800506:	e8 39 03 00 00       	call   800844 <strnlen>
+  80050b:	89 c2                	mov    %eax,%edx
+  80050d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800510:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800512:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800515:	c1 e1 08             	shl    $0x8,%ecx
+  800518:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80051c:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80051e:	83 c4 10             	add    $0x10,%esp
+  800521:	89 c3                	mov    %eax,%ebx
+  800523:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800526:	89 75 10             	mov    %esi,0x10(%ebp)
+  800529:	89 ce                	mov    %ecx,%esi
+  80052b:	eb 0f                	jmp    80053c <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80052d:	83 ec 08             	sub    $0x8,%esp
+  800530:	ff 75 0c             	push   0xc(%ebp)
+  800533:	56                   	push   %esi
+  800534:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800536:	83 eb 01             	sub    $0x1,%ebx
+  800539:	83 c4 10             	add    $0x10,%esp
+  80053c:	85 db                	test   %ebx,%ebx
+  80053e:	7f ed                	jg     80052d <vprintfmt+0x230>
+  800540:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800543:	8b 75 10             	mov    0x10(%ebp),%esi
+  800546:	85 c0                	test   %eax,%eax
+  800548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054d:	0f 49 d0             	cmovns %eax,%edx
+  800550:	29 d0                	sub    %edx,%eax
+  800552:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800555:	eb 8c                	jmp    8004e3 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800557:	83 ec 08             	sub    $0x8,%esp
+  80055a:	ff 75 0c             	push   0xc(%ebp)
+  80055d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800560:	09 c2                	or     %eax,%edx
+  800562:	52                   	push   %edx
+  800563:	ff d7                	call   *%edi
+  800565:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800568:	89 d9                	mov    %ebx,%ecx
+  80056a:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80056d:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800571:	0f be d0             	movsbl %al,%edx
+  800574:	85 d2                	test   %edx,%edx
+  800576:	74 2a                	je     8005a2 <vprintfmt+0x2a5>
+  800578:	85 f6                	test   %esi,%esi
+  80057a:	78 05                	js     800581 <vprintfmt+0x284>
+  80057c:	83 ee 01             	sub    $0x1,%esi
+  80057f:	78 3b                	js     8005bc <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800581:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800585:	74 d0                	je     800557 <vprintfmt+0x25a>
+  800587:	0f be c0             	movsbl %al,%eax
+  80058a:	83 e8 20             	sub    $0x20,%eax
+  80058d:	83 f8 5e             	cmp    $0x5e,%eax
+  800590:	76 c5                	jbe    800557 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800592:	83 ec 08             	sub    $0x8,%esp
+  800595:	ff 75 0c             	push   0xc(%ebp)
+  800598:	ff 75 cc             	push   -0x34(%ebp)
+  80059b:	ff d7                	call   *%edi
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	eb c6                	jmp    800568 <vprintfmt+0x26b>
+  8005a2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005a5:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ab:	01 c3                	add    %eax,%ebx
+  8005ad:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005af:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005b2:	83 c8 20             	or     $0x20,%eax
+  8005b5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005b8:	89 c6                	mov    %eax,%esi
+  8005ba:	eb 14                	jmp    8005d0 <vprintfmt+0x2d3>
+  8005bc:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005bf:	eb e4                	jmp    8005a5 <vprintfmt+0x2a8>
+  8005c1:	83 ec 08             	sub    $0x8,%esp
+  8005c4:	ff 75 0c             	push   0xc(%ebp)
+  8005c7:	56                   	push   %esi
+  8005c8:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005ca:	83 eb 01             	sub    $0x1,%ebx
+  8005cd:	83 c4 10             	add    $0x10,%esp
+  8005d0:	85 db                	test   %ebx,%ebx
+  8005d2:	7f ed                	jg     8005c1 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005d4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005d7:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005dd:	e9 49 fd ff ff       	jmp    80032b <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005e2:	83 f9 01             	cmp    $0x1,%ecx
+  8005e5:	7f 1f                	jg     800606 <vprintfmt+0x309>
+	else if (lflag)
+  8005e7:	85 c9                	test   %ecx,%ecx
+  8005e9:	74 69                	je     800654 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8b 00                	mov    (%eax),%eax
+  8005f0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f3:	89 c1                	mov    %eax,%ecx
+  8005f5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800601:	89 45 14             	mov    %eax,0x14(%ebp)
+  800604:	eb 17                	jmp    80061d <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8b 50 04             	mov    0x4(%eax),%edx
+  80060c:	8b 00                	mov    (%eax),%eax
+  80060e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800611:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800614:	8b 45 14             	mov    0x14(%ebp),%eax
+  800617:	8d 40 08             	lea    0x8(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80061d:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800620:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800623:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800628:	85 db                	test   %ebx,%ebx
+  80062a:	0f 89 f6 00 00 00    	jns    800726 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800630:	83 ec 08             	sub    $0x8,%esp
+  800633:	ff 75 0c             	push   0xc(%ebp)
+  800636:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800639:	c1 e0 08             	shl    $0x8,%eax
+  80063c:	83 c8 2d             	or     $0x2d,%eax
+  80063f:	50                   	push   %eax
+  800640:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800642:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800645:	f7 d9                	neg    %ecx
+  800647:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80064a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80064f:	e9 d2 00 00 00       	jmp    800726 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8b 00                	mov    (%eax),%eax
+  800659:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80065c:	89 c1                	mov    %eax,%ecx
+  80065e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800661:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8d 40 04             	lea    0x4(%eax),%eax
+  80066a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066d:	eb ae                	jmp    80061d <vprintfmt+0x320>
+	if (lflag >= 2)
+  80066f:	83 f9 01             	cmp    $0x1,%ecx
+  800672:	7f 19                	jg     80068d <vprintfmt+0x390>
+	else if (lflag)
+  800674:	85 c9                	test   %ecx,%ecx
+  800676:	74 2a                	je     8006a2 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8b 08                	mov    (%eax),%ecx
+  80067d:	8d 40 04             	lea    0x4(%eax),%eax
+  800680:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800683:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800688:	e9 99 00 00 00       	jmp    800726 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8b 08                	mov    (%eax),%ecx
+  800692:	8d 40 08             	lea    0x8(%eax),%eax
+  800695:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800698:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80069d:	e9 84 00 00 00       	jmp    800726 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a5:	8b 08                	mov    (%eax),%ecx
+  8006a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006b2:	eb 72                	jmp    800726 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006b4:	83 f9 01             	cmp    $0x1,%ecx
+  8006b7:	7f 16                	jg     8006cf <vprintfmt+0x3d2>
+	else if (lflag)
+  8006b9:	85 c9                	test   %ecx,%ecx
+  8006bb:	74 24                	je     8006e1 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8b 08                	mov    (%eax),%ecx
+  8006c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c8:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8006cd:	eb 57                	jmp    800726 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d2:	8b 08                	mov    (%eax),%ecx
+  8006d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006da:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006df:	eb 45                	jmp    800726 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8b 08                	mov    (%eax),%ecx
+  8006e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ec:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006f1:	eb 33                	jmp    800726 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006f3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006f6:	c1 e3 08             	shl    $0x8,%ebx
+  8006f9:	83 ec 08             	sub    $0x8,%esp
+  8006fc:	ff 75 0c             	push   0xc(%ebp)
+  8006ff:	89 d8                	mov    %ebx,%eax
+  800701:	83 c8 30             	or     $0x30,%eax
+  800704:	50                   	push   %eax
+  800705:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800707:	83 c4 08             	add    $0x8,%esp
+  80070a:	ff 75 0c             	push   0xc(%ebp)
+  80070d:	83 cb 78             	or     $0x78,%ebx
+  800710:	53                   	push   %ebx
+  800711:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800718:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80071b:	8d 40 04             	lea    0x4(%eax),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800721:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800726:	ff 75 e4             	push   -0x1c(%ebp)
+  800729:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80072d:	52                   	push   %edx
+  80072e:	ff 75 e0             	push   -0x20(%ebp)
+  800731:	50                   	push   %eax
+  800732:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800735:	89 f8                	mov    %edi,%eax
+  800737:	e8 f7 fa ff ff       	call   800233 <printnum>
+			break;
+  80073c:	83 c4 10             	add    $0x10,%esp
+  80073f:	e9 e7 fb ff ff       	jmp    80032b <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800744:	83 f9 01             	cmp    $0x1,%ecx
+  800747:	7f 16                	jg     80075f <vprintfmt+0x462>
+	else if (lflag)
+  800749:	85 c9                	test   %ecx,%ecx
+  80074b:	74 24                	je     800771 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 08                	mov    (%eax),%ecx
+  800752:	8d 40 04             	lea    0x4(%eax),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800758:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80075d:	eb c7                	jmp    800726 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8b 08                	mov    (%eax),%ecx
+  800764:	8d 40 08             	lea    0x8(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076a:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80076f:	eb b5                	jmp    800726 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 08                	mov    (%eax),%ecx
+  800776:	8d 40 04             	lea    0x4(%eax),%eax
+  800779:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80077c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800781:	eb a3                	jmp    800726 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800783:	83 ec 08             	sub    $0x8,%esp
+  800786:	ff 75 0c             	push   0xc(%ebp)
+  800789:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80078c:	c1 e0 08             	shl    $0x8,%eax
+  80078f:	83 c8 25             	or     $0x25,%eax
+  800792:	50                   	push   %eax
+  800793:	ff d7                	call   *%edi
+			break;
+  800795:	83 c4 10             	add    $0x10,%esp
+  800798:	e9 8e fb ff ff       	jmp    80032b <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80079d:	83 ec 08             	sub    $0x8,%esp
+  8007a0:	ff 75 0c             	push   0xc(%ebp)
+  8007a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007a6:	c1 e0 08             	shl    $0x8,%eax
+  8007a9:	83 c8 25             	or     $0x25,%eax
+  8007ac:	50                   	push   %eax
+  8007ad:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007af:	83 c4 10             	add    $0x10,%esp
+  8007b2:	89 de                	mov    %ebx,%esi
+  8007b4:	eb 03                	jmp    8007b9 <vprintfmt+0x4bc>
+  8007b6:	83 ee 01             	sub    $0x1,%esi
+  8007b9:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007bd:	75 f7                	jne    8007b6 <vprintfmt+0x4b9>
+  8007bf:	e9 67 fb ff ff       	jmp    80032b <vprintfmt+0x2e>
+
+008007c4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007c4:	55                   	push   %ebp
+  8007c5:	89 e5                	mov    %esp,%ebp
+  8007c7:	83 ec 18             	sub    $0x18,%esp
+  8007ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007d0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007d3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007d7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007da:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007e1:	85 c0                	test   %eax,%eax
+  8007e3:	74 26                	je     80080b <vsnprintf+0x47>
+  8007e5:	85 d2                	test   %edx,%edx
+  8007e7:	7e 22                	jle    80080b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007e9:	ff 75 14             	push   0x14(%ebp)
+  8007ec:	ff 75 10             	push   0x10(%ebp)
+  8007ef:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007f2:	50                   	push   %eax
+  8007f3:	68 c3 02 80 00       	push   $0x8002c3
+  8007f8:	e8 00 fb ff ff       	call   8002fd <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007fd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800800:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800803:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800806:	83 c4 10             	add    $0x10,%esp
+}
+  800809:	c9                   	leave
+  80080a:	c3                   	ret
+		return -E_INVAL;
+  80080b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800810:	eb f7                	jmp    800809 <vsnprintf+0x45>
+
+00800812 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800818:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80081b:	50                   	push   %eax
+  80081c:	ff 75 10             	push   0x10(%ebp)
+  80081f:	ff 75 0c             	push   0xc(%ebp)
+  800822:	ff 75 08             	push   0x8(%ebp)
+  800825:	e8 9a ff ff ff       	call   8007c4 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80082a:	c9                   	leave
+  80082b:	c3                   	ret
+
+0080082c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80082c:	55                   	push   %ebp
+  80082d:	89 e5                	mov    %esp,%ebp
+  80082f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800832:	b8 00 00 00 00       	mov    $0x0,%eax
+  800837:	eb 03                	jmp    80083c <strlen+0x10>
+		n++;
+  800839:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80083c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800840:	75 f7                	jne    800839 <strlen+0xd>
+	return n;
+}
+  800842:	5d                   	pop    %ebp
+  800843:	c3                   	ret
+
+00800844 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80084a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80084d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800852:	eb 03                	jmp    800857 <strnlen+0x13>
+		n++;
+  800854:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800857:	39 d0                	cmp    %edx,%eax
+  800859:	74 08                	je     800863 <strnlen+0x1f>
+  80085b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80085f:	75 f3                	jne    800854 <strnlen+0x10>
+  800861:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800863:	89 d0                	mov    %edx,%eax
+  800865:	5d                   	pop    %ebp
+  800866:	c3                   	ret
+
+00800867 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800867:	55                   	push   %ebp
+  800868:	89 e5                	mov    %esp,%ebp
+  80086a:	53                   	push   %ebx
+  80086b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80086e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800871:	b8 00 00 00 00       	mov    $0x0,%eax
+  800876:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80087a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80087d:	83 c0 01             	add    $0x1,%eax
+  800880:	84 d2                	test   %dl,%dl
+  800882:	75 f2                	jne    800876 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800884:	89 c8                	mov    %ecx,%eax
+  800886:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800889:	c9                   	leave
+  80088a:	c3                   	ret
+
+0080088b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	53                   	push   %ebx
+  80088f:	83 ec 10             	sub    $0x10,%esp
+  800892:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800895:	53                   	push   %ebx
+  800896:	e8 91 ff ff ff       	call   80082c <strlen>
+  80089b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80089e:	ff 75 0c             	push   0xc(%ebp)
+  8008a1:	01 d8                	add    %ebx,%eax
+  8008a3:	50                   	push   %eax
+  8008a4:	e8 be ff ff ff       	call   800867 <strcpy>
+	return dst;
+}
+  8008a9:	89 d8                	mov    %ebx,%eax
+  8008ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ae:	c9                   	leave
+  8008af:	c3                   	ret
+
+008008b0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008b0:	55                   	push   %ebp
+  8008b1:	89 e5                	mov    %esp,%ebp
+  8008b3:	56                   	push   %esi
+  8008b4:	53                   	push   %ebx
+  8008b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008bb:	89 f3                	mov    %esi,%ebx
+  8008bd:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008c0:	89 f0                	mov    %esi,%eax
+  8008c2:	eb 0f                	jmp    8008d3 <strncpy+0x23>
+		*dst++ = *src;
+  8008c4:	83 c0 01             	add    $0x1,%eax
+  8008c7:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ca:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008cd:	80 f9 01             	cmp    $0x1,%cl
+  8008d0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008d3:	39 d8                	cmp    %ebx,%eax
+  8008d5:	75 ed                	jne    8008c4 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008d7:	89 f0                	mov    %esi,%eax
+  8008d9:	5b                   	pop    %ebx
+  8008da:	5e                   	pop    %esi
+  8008db:	5d                   	pop    %ebp
+  8008dc:	c3                   	ret
+
+008008dd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	56                   	push   %esi
+  8008e1:	53                   	push   %ebx
+  8008e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e8:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008eb:	89 f0                	mov    %esi,%eax
+  8008ed:	85 d2                	test   %edx,%edx
+  8008ef:	74 21                	je     800912 <strlcpy+0x35>
+  8008f1:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008f5:	89 f2                	mov    %esi,%edx
+  8008f7:	eb 09                	jmp    800902 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008f9:	83 c1 01             	add    $0x1,%ecx
+  8008fc:	83 c2 01             	add    $0x1,%edx
+  8008ff:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800902:	39 c2                	cmp    %eax,%edx
+  800904:	74 09                	je     80090f <strlcpy+0x32>
+  800906:	0f b6 19             	movzbl (%ecx),%ebx
+  800909:	84 db                	test   %bl,%bl
+  80090b:	75 ec                	jne    8008f9 <strlcpy+0x1c>
+  80090d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80090f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800912:	29 f0                	sub    %esi,%eax
+}
+  800914:	5b                   	pop    %ebx
+  800915:	5e                   	pop    %esi
+  800916:	5d                   	pop    %ebp
+  800917:	c3                   	ret
+
+00800918 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800918:	55                   	push   %ebp
+  800919:	89 e5                	mov    %esp,%ebp
+  80091b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800921:	eb 06                	jmp    800929 <strcmp+0x11>
+		p++, q++;
+  800923:	83 c1 01             	add    $0x1,%ecx
+  800926:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800929:	0f b6 01             	movzbl (%ecx),%eax
+  80092c:	84 c0                	test   %al,%al
+  80092e:	74 04                	je     800934 <strcmp+0x1c>
+  800930:	3a 02                	cmp    (%edx),%al
+  800932:	74 ef                	je     800923 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800934:	0f b6 c0             	movzbl %al,%eax
+  800937:	0f b6 12             	movzbl (%edx),%edx
+  80093a:	29 d0                	sub    %edx,%eax
+}
+  80093c:	5d                   	pop    %ebp
+  80093d:	c3                   	ret
+
+0080093e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80093e:	55                   	push   %ebp
+  80093f:	89 e5                	mov    %esp,%ebp
+  800941:	53                   	push   %ebx
+  800942:	8b 45 08             	mov    0x8(%ebp),%eax
+  800945:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800948:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80094b:	eb 09                	jmp    800956 <strncmp+0x18>
+		n--, p++, q++;
+  80094d:	83 ea 01             	sub    $0x1,%edx
+  800950:	83 c0 01             	add    $0x1,%eax
+  800953:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800956:	85 d2                	test   %edx,%edx
+  800958:	74 18                	je     800972 <strncmp+0x34>
+  80095a:	0f b6 18             	movzbl (%eax),%ebx
+  80095d:	84 db                	test   %bl,%bl
+  80095f:	74 04                	je     800965 <strncmp+0x27>
+  800961:	3a 19                	cmp    (%ecx),%bl
+  800963:	74 e8                	je     80094d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800965:	0f b6 00             	movzbl (%eax),%eax
+  800968:	0f b6 11             	movzbl (%ecx),%edx
+  80096b:	29 d0                	sub    %edx,%eax
+}
+  80096d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800970:	c9                   	leave
+  800971:	c3                   	ret
+		return 0;
+  800972:	b8 00 00 00 00       	mov    $0x0,%eax
+  800977:	eb f4                	jmp    80096d <strncmp+0x2f>
+
+00800979 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800979:	55                   	push   %ebp
+  80097a:	89 e5                	mov    %esp,%ebp
+  80097c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800983:	eb 03                	jmp    800988 <strchr+0xf>
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	0f b6 10             	movzbl (%eax),%edx
+  80098b:	84 d2                	test   %dl,%dl
+  80098d:	74 06                	je     800995 <strchr+0x1c>
+		if (*s == c)
+  80098f:	38 ca                	cmp    %cl,%dl
+  800991:	75 f2                	jne    800985 <strchr+0xc>
+  800993:	eb 05                	jmp    80099a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800995:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80099a:	5d                   	pop    %ebp
+  80099b:	c3                   	ret
+
+0080099c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009a6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009a9:	38 ca                	cmp    %cl,%dl
+  8009ab:	74 09                	je     8009b6 <strfind+0x1a>
+  8009ad:	84 d2                	test   %dl,%dl
+  8009af:	74 05                	je     8009b6 <strfind+0x1a>
+	for (; *s; s++)
+  8009b1:	83 c0 01             	add    $0x1,%eax
+  8009b4:	eb f0                	jmp    8009a6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009b6:	5d                   	pop    %ebp
+  8009b7:	c3                   	ret
+
+008009b8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	57                   	push   %edi
+  8009bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009bf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009c2:	85 c9                	test   %ecx,%ecx
+  8009c4:	74 20                	je     8009e6 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009c6:	89 f8                	mov    %edi,%eax
+  8009c8:	09 c8                	or     %ecx,%eax
+  8009ca:	a8 03                	test   $0x3,%al
+  8009cc:	75 12                	jne    8009e0 <memset+0x28>
+		c &= 0xFF;
+  8009ce:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009d2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009d8:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009db:	fc                   	cld
+  8009dc:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009de:	eb 06                	jmp    8009e6 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009e3:	fc                   	cld
+  8009e4:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009e6:	89 f8                	mov    %edi,%eax
+  8009e8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009eb:	c9                   	leave
+  8009ec:	c3                   	ret
+
+008009ed <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	57                   	push   %edi
+  8009f1:	56                   	push   %esi
+  8009f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009f8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009fb:	39 c6                	cmp    %eax,%esi
+  8009fd:	73 32                	jae    800a31 <memmove+0x44>
+  8009ff:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a02:	39 d0                	cmp    %edx,%eax
+  800a04:	73 2b                	jae    800a31 <memmove+0x44>
+		s += n;
+		d += n;
+  800a06:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a09:	89 d6                	mov    %edx,%esi
+  800a0b:	09 fe                	or     %edi,%esi
+  800a0d:	09 ce                	or     %ecx,%esi
+  800a0f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a15:	75 0e                	jne    800a25 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a17:	83 ef 04             	sub    $0x4,%edi
+  800a1a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a1d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a20:	fd                   	std
+  800a21:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a23:	eb 09                	jmp    800a2e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a25:	83 ef 01             	sub    $0x1,%edi
+  800a28:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a2b:	fd                   	std
+  800a2c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a2e:	fc                   	cld
+  800a2f:	eb 1a                	jmp    800a4b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a31:	89 f2                	mov    %esi,%edx
+  800a33:	09 c2                	or     %eax,%edx
+  800a35:	09 ca                	or     %ecx,%edx
+  800a37:	f6 c2 03             	test   $0x3,%dl
+  800a3a:	75 0a                	jne    800a46 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a3c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a3f:	89 c7                	mov    %eax,%edi
+  800a41:	fc                   	cld
+  800a42:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a44:	eb 05                	jmp    800a4b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a46:	89 c7                	mov    %eax,%edi
+  800a48:	fc                   	cld
+  800a49:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a4b:	5e                   	pop    %esi
+  800a4c:	5f                   	pop    %edi
+  800a4d:	5d                   	pop    %ebp
+  800a4e:	c3                   	ret
+
+00800a4f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a4f:	55                   	push   %ebp
+  800a50:	89 e5                	mov    %esp,%ebp
+  800a52:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a55:	ff 75 10             	push   0x10(%ebp)
+  800a58:	ff 75 0c             	push   0xc(%ebp)
+  800a5b:	ff 75 08             	push   0x8(%ebp)
+  800a5e:	e8 8a ff ff ff       	call   8009ed <memmove>
+}
+  800a63:	c9                   	leave
+  800a64:	c3                   	ret
+
+00800a65 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	56                   	push   %esi
+  800a69:	53                   	push   %ebx
+  800a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a70:	89 c6                	mov    %eax,%esi
+  800a72:	03 75 10             	add    0x10(%ebp),%esi
+  800a75:	eb 06                	jmp    800a7d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a77:	83 c0 01             	add    $0x1,%eax
+  800a7a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a7d:	39 f0                	cmp    %esi,%eax
+  800a7f:	74 14                	je     800a95 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a81:	0f b6 08             	movzbl (%eax),%ecx
+  800a84:	0f b6 1a             	movzbl (%edx),%ebx
+  800a87:	38 d9                	cmp    %bl,%cl
+  800a89:	74 ec                	je     800a77 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a8b:	0f b6 c1             	movzbl %cl,%eax
+  800a8e:	0f b6 db             	movzbl %bl,%ebx
+  800a91:	29 d8                	sub    %ebx,%eax
+  800a93:	eb 05                	jmp    800a9a <memcmp+0x35>
+	}
+
+	return 0;
+  800a95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a9a:	5b                   	pop    %ebx
+  800a9b:	5e                   	pop    %esi
+  800a9c:	5d                   	pop    %ebp
+  800a9d:	c3                   	ret
+
+00800a9e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a9e:	55                   	push   %ebp
+  800a9f:	89 e5                	mov    %esp,%ebp
+  800aa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800aa7:	89 c2                	mov    %eax,%edx
+  800aa9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aac:	eb 03                	jmp    800ab1 <memfind+0x13>
+  800aae:	83 c0 01             	add    $0x1,%eax
+  800ab1:	39 d0                	cmp    %edx,%eax
+  800ab3:	73 04                	jae    800ab9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ab5:	38 08                	cmp    %cl,(%eax)
+  800ab7:	75 f5                	jne    800aae <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+
+00800abb <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	57                   	push   %edi
+  800abf:	56                   	push   %esi
+  800ac0:	53                   	push   %ebx
+  800ac1:	83 ec 1c             	sub    $0x1c,%esp
+  800ac4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aca:	eb 03                	jmp    800acf <strtol+0x14>
+		s++;
+  800acc:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800acf:	0f b6 06             	movzbl (%esi),%eax
+  800ad2:	3c 20                	cmp    $0x20,%al
+  800ad4:	74 f6                	je     800acc <strtol+0x11>
+  800ad6:	3c 09                	cmp    $0x9,%al
+  800ad8:	74 f2                	je     800acc <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ada:	3c 2b                	cmp    $0x2b,%al
+  800adc:	74 43                	je     800b21 <strtol+0x66>
+	int neg = 0;
+  800ade:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800ae3:	3c 2d                	cmp    $0x2d,%al
+  800ae5:	74 44                	je     800b2b <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ae7:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800aed:	75 0f                	jne    800afe <strtol+0x43>
+  800aef:	80 3e 30             	cmpb   $0x30,(%esi)
+  800af2:	74 41                	je     800b35 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800af4:	85 ff                	test   %edi,%edi
+  800af6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800afb:	0f 44 f8             	cmove  %eax,%edi
+  800afe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b03:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b08:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b0b:	89 fb                	mov    %edi,%ebx
+  800b0d:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b10:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b13:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b16:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b19:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b1c:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b1f:	eb 67                	jmp    800b88 <strtol+0xcd>
+		s++;
+  800b21:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b29:	eb bc                	jmp    800ae7 <strtol+0x2c>
+		s++, neg = 1;
+  800b2b:	83 c6 01             	add    $0x1,%esi
+  800b2e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b33:	eb b2                	jmp    800ae7 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b35:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b39:	74 0e                	je     800b49 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b3b:	85 ff                	test   %edi,%edi
+  800b3d:	75 bf                	jne    800afe <strtol+0x43>
+		s++, base = 8;
+  800b3f:	83 c6 01             	add    $0x1,%esi
+  800b42:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b47:	eb b5                	jmp    800afe <strtol+0x43>
+		s += 2, base = 16;
+  800b49:	83 c6 02             	add    $0x2,%esi
+  800b4c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b51:	eb ab                	jmp    800afe <strtol+0x43>
+			dig = *s - '0';
+  800b53:	0f be c9             	movsbl %cl,%ecx
+  800b56:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b59:	39 f9                	cmp    %edi,%ecx
+  800b5b:	7d 59                	jge    800bb6 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b5d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b61:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b64:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b67:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b6a:	0f af d8             	imul   %eax,%ebx
+  800b6d:	0f af d7             	imul   %edi,%edx
+  800b70:	01 d3                	add    %edx,%ebx
+  800b72:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b75:	f7 e7                	mul    %edi
+  800b77:	01 da                	add    %ebx,%edx
+  800b79:	89 cb                	mov    %ecx,%ebx
+  800b7b:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b7e:	01 c8                	add    %ecx,%eax
+  800b80:	11 da                	adc    %ebx,%edx
+  800b82:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b85:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8b:	0f b6 08             	movzbl (%eax),%ecx
+  800b8e:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b91:	80 fb 09             	cmp    $0x9,%bl
+  800b94:	76 bd                	jbe    800b53 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b96:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b99:	80 fb 19             	cmp    $0x19,%bl
+  800b9c:	77 08                	ja     800ba6 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b9e:	0f be c9             	movsbl %cl,%ecx
+  800ba1:	83 e9 57             	sub    $0x57,%ecx
+  800ba4:	eb b3                	jmp    800b59 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ba6:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800ba9:	80 fb 19             	cmp    $0x19,%bl
+  800bac:	77 08                	ja     800bb6 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800bae:	0f be c9             	movsbl %cl,%ecx
+  800bb1:	83 e9 37             	sub    $0x37,%ecx
+  800bb4:	eb a3                	jmp    800b59 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bb6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bb9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bbc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bc6:	74 05                	je     800bcd <strtol+0x112>
+		*endptr = (char *) s;
+  800bc8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bcb:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800bcd:	85 c9                	test   %ecx,%ecx
+  800bcf:	74 07                	je     800bd8 <strtol+0x11d>
+  800bd1:	f7 d8                	neg    %eax
+  800bd3:	83 d2 00             	adc    $0x0,%edx
+  800bd6:	f7 da                	neg    %edx
+}
+  800bd8:	83 c4 1c             	add    $0x1c,%esp
+  800bdb:	5b                   	pop    %ebx
+  800bdc:	5e                   	pop    %esi
+  800bdd:	5f                   	pop    %edi
+  800bde:	5d                   	pop    %ebp
+  800bdf:	c3                   	ret
+
+00800be0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	57                   	push   %edi
+  800be4:	56                   	push   %esi
+  800be5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800be6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bed:	74 18                	je     800c07 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfa:	89 c3                	mov    %eax,%ebx
+  800bfc:	89 c7                	mov    %eax,%edi
+  800bfe:	89 c6                	mov    %eax,%esi
+  800c00:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c02:	5b                   	pop    %ebx
+  800c03:	5e                   	pop    %esi
+  800c04:	5f                   	pop    %edi
+  800c05:	5d                   	pop    %ebp
+  800c06:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c12:	89 c3                	mov    %eax,%ebx
+  800c14:	89 c7                	mov    %eax,%edi
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	8d 35 21 0c 80 00    	lea    0x800c21,%esi
+  800c1f:	0f 34                	sysenter
+  800c21:	5d                   	pop    %ebp
+		goto out;
+  800c22:	eb de                	jmp    800c02 <sys_cputs+0x22>
+
+00800c24 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c2a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c31:	74 19                	je     800c4c <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c38:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c3d:	89 d1                	mov    %edx,%ecx
+  800c3f:	89 d3                	mov    %edx,%ebx
+  800c41:	89 d7                	mov    %edx,%edi
+  800c43:	89 d6                	mov    %edx,%esi
+  800c45:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5f                   	pop    %edi
+  800c4a:	5d                   	pop    %ebp
+  800c4b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c51:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c56:	89 d1                	mov    %edx,%ecx
+  800c58:	89 d3                	mov    %edx,%ebx
+  800c5a:	89 d7                	mov    %edx,%edi
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	8d 35 67 0c 80 00    	lea    0x800c67,%esi
+  800c65:	0f 34                	sysenter
+  800c67:	5d                   	pop    %ebp
+		goto out;
+  800c68:	eb dd                	jmp    800c47 <sys_cgetc+0x23>
+
+00800c6a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	57                   	push   %edi
+  800c6e:	56                   	push   %esi
+  800c6f:	53                   	push   %ebx
+  800c70:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c73:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c7a:	74 21                	je     800c9d <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c81:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c89:	89 cb                	mov    %ecx,%ebx
+  800c8b:	89 cf                	mov    %ecx,%edi
+  800c8d:	89 ce                	mov    %ecx,%esi
+  800c8f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c91:	85 c0                	test   %eax,%eax
+  800c93:	7f 27                	jg     800cbc <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800caa:	89 cb                	mov    %ecx,%ebx
+  800cac:	89 cf                	mov    %ecx,%edi
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	8d 35 b9 0c 80 00    	lea    0x800cb9,%esi
+  800cb7:	0f 34                	sysenter
+  800cb9:	5d                   	pop    %ebp
+		goto out;
+  800cba:	eb d5                	jmp    800c91 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cbc:	83 ec 0c             	sub    $0xc,%esp
+  800cbf:	50                   	push   %eax
+  800cc0:	6a 03                	push   $0x3
+  800cc2:	68 ab 2f 80 00       	push   $0x802fab
+  800cc7:	6a 3f                	push   $0x3f
+  800cc9:	68 c8 2f 80 00       	push   $0x802fc8
+  800cce:	e8 71 f4 ff ff       	call   800144 <_panic>
+
+00800cd3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cd3:	55                   	push   %ebp
+  800cd4:	89 e5                	mov    %esp,%ebp
+  800cd6:	57                   	push   %edi
+  800cd7:	56                   	push   %esi
+  800cd8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cd9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ce0:	74 19                	je     800cfb <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cec:	89 d1                	mov    %edx,%ecx
+  800cee:	89 d3                	mov    %edx,%ebx
+  800cf0:	89 d7                	mov    %edx,%edi
+  800cf2:	89 d6                	mov    %edx,%esi
+  800cf4:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cf6:	5b                   	pop    %ebx
+  800cf7:	5e                   	pop    %esi
+  800cf8:	5f                   	pop    %edi
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d00:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d05:	89 d1                	mov    %edx,%ecx
+  800d07:	89 d3                	mov    %edx,%ebx
+  800d09:	89 d7                	mov    %edx,%edi
+  800d0b:	55                   	push   %ebp
+  800d0c:	89 e5                	mov    %esp,%ebp
+  800d0e:	8d 35 16 0d 80 00    	lea    0x800d16,%esi
+  800d14:	0f 34                	sysenter
+  800d16:	5d                   	pop    %ebp
+		goto out;
+  800d17:	eb dd                	jmp    800cf6 <sys_getenvid+0x23>
+
+00800d19 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	57                   	push   %edi
+  800d1d:	56                   	push   %esi
+  800d1e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d1f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d26:	74 19                	je     800d41 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d32:	89 d1                	mov    %edx,%ecx
+  800d34:	89 d3                	mov    %edx,%ebx
+  800d36:	89 d7                	mov    %edx,%edi
+  800d38:	89 d6                	mov    %edx,%esi
+  800d3a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d3c:	5b                   	pop    %ebx
+  800d3d:	5e                   	pop    %esi
+  800d3e:	5f                   	pop    %edi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d41:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d46:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d4b:	89 d1                	mov    %edx,%ecx
+  800d4d:	89 d3                	mov    %edx,%ebx
+  800d4f:	89 d7                	mov    %edx,%edi
+  800d51:	55                   	push   %ebp
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	8d 35 5c 0d 80 00    	lea    0x800d5c,%esi
+  800d5a:	0f 34                	sysenter
+  800d5c:	5d                   	pop    %ebp
+		goto out;
+  800d5d:	eb dd                	jmp    800d3c <sys_yield+0x23>
+
+00800d5f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	57                   	push   %edi
+  800d63:	56                   	push   %esi
+  800d64:	53                   	push   %ebx
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d68:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d6f:	74 23                	je     800d94 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d71:	be 00 00 00 00       	mov    $0x0,%esi
+  800d76:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d84:	89 f7                	mov    %esi,%edi
+  800d86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d88:	85 c0                	test   %eax,%eax
+  800d8a:	7f 29                	jg     800db5 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	8d 35 b2 0d 80 00    	lea    0x800db2,%esi
+  800db0:	0f 34                	sysenter
+  800db2:	5d                   	pop    %ebp
+		goto out;
+  800db3:	eb d3                	jmp    800d88 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db5:	83 ec 0c             	sub    $0xc,%esp
+  800db8:	50                   	push   %eax
+  800db9:	6a 04                	push   $0x4
+  800dbb:	68 ab 2f 80 00       	push   $0x802fab
+  800dc0:	6a 3f                	push   $0x3f
+  800dc2:	68 c8 2f 80 00       	push   $0x802fc8
+  800dc7:	e8 78 f3 ff ff       	call   800144 <_panic>
+
+00800dcc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dcc:	55                   	push   %ebp
+  800dcd:	89 e5                	mov    %esp,%ebp
+  800dcf:	57                   	push   %edi
+  800dd0:	56                   	push   %esi
+  800dd1:	53                   	push   %ebx
+  800dd2:	83 ec 0c             	sub    $0xc,%esp
+  800dd5:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800dd8:	85 f6                	test   %esi,%esi
+  800dda:	75 09                	jne    800de5 <sys_page_map+0x19>
+  800ddc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800de3:	74 1f                	je     800e04 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800de5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ded:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df8:	85 c0                	test   %eax,%eax
+  800dfa:	7f 27                	jg     800e23 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dff:	5b                   	pop    %ebx
+  800e00:	5e                   	pop    %esi
+  800e01:	5f                   	pop    %edi
+  800e02:	5d                   	pop    %ebp
+  800e03:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e12:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e15:	55                   	push   %ebp
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	8d 35 20 0e 80 00    	lea    0x800e20,%esi
+  800e1e:	0f 34                	sysenter
+  800e20:	5d                   	pop    %ebp
+		goto out;
+  800e21:	eb d5                	jmp    800df8 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e23:	83 ec 0c             	sub    $0xc,%esp
+  800e26:	50                   	push   %eax
+  800e27:	6a 05                	push   $0x5
+  800e29:	68 ab 2f 80 00       	push   $0x802fab
+  800e2e:	6a 3f                	push   $0x3f
+  800e30:	68 c8 2f 80 00       	push   $0x802fc8
+  800e35:	e8 0a f3 ff ff       	call   800144 <_panic>
+
+00800e3a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	57                   	push   %edi
+  800e3e:	56                   	push   %esi
+  800e3f:	53                   	push   %ebx
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e43:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e4a:	74 22                	je     800e6e <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e51:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5c:	89 df                	mov    %ebx,%edi
+  800e5e:	89 de                	mov    %ebx,%esi
+  800e60:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e62:	85 c0                	test   %eax,%eax
+  800e64:	7f 28                	jg     800e8e <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e69:	5b                   	pop    %ebx
+  800e6a:	5e                   	pop    %esi
+  800e6b:	5f                   	pop    %edi
+  800e6c:	5d                   	pop    %ebp
+  800e6d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e79:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e7e:	89 df                	mov    %ebx,%edi
+  800e80:	55                   	push   %ebp
+  800e81:	89 e5                	mov    %esp,%ebp
+  800e83:	8d 35 8b 0e 80 00    	lea    0x800e8b,%esi
+  800e89:	0f 34                	sysenter
+  800e8b:	5d                   	pop    %ebp
+		goto out;
+  800e8c:	eb d4                	jmp    800e62 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	50                   	push   %eax
+  800e92:	6a 06                	push   $0x6
+  800e94:	68 ab 2f 80 00       	push   $0x802fab
+  800e99:	6a 3f                	push   $0x3f
+  800e9b:	68 c8 2f 80 00       	push   $0x802fc8
+  800ea0:	e8 9f f2 ff ff       	call   800144 <_panic>
+
+00800ea5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	57                   	push   %edi
+  800ea9:	56                   	push   %esi
+  800eaa:	53                   	push   %ebx
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eae:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eb5:	74 22                	je     800ed9 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800eb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec7:	89 df                	mov    %ebx,%edi
+  800ec9:	89 de                	mov    %ebx,%esi
+  800ecb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ecd:	85 c0                	test   %eax,%eax
+  800ecf:	7f 28                	jg     800ef9 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ed1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed4:	5b                   	pop    %ebx
+  800ed5:	5e                   	pop    %esi
+  800ed6:	5f                   	pop    %edi
+  800ed7:	5d                   	pop    %ebp
+  800ed8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ed9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee4:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ee9:	89 df                	mov    %ebx,%edi
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	8d 35 f6 0e 80 00    	lea    0x800ef6,%esi
+  800ef4:	0f 34                	sysenter
+  800ef6:	5d                   	pop    %ebp
+		goto out;
+  800ef7:	eb d4                	jmp    800ecd <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef9:	83 ec 0c             	sub    $0xc,%esp
+  800efc:	50                   	push   %eax
+  800efd:	6a 08                	push   $0x8
+  800eff:	68 ab 2f 80 00       	push   $0x802fab
+  800f04:	6a 3f                	push   $0x3f
+  800f06:	68 c8 2f 80 00       	push   $0x802fc8
+  800f0b:	e8 34 f2 ff ff       	call   800144 <_panic>
+
+00800f10 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	57                   	push   %edi
+  800f14:	56                   	push   %esi
+  800f15:	53                   	push   %ebx
+  800f16:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f19:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f20:	74 22                	je     800f44 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f27:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f32:	89 df                	mov    %ebx,%edi
+  800f34:	89 de                	mov    %ebx,%esi
+  800f36:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f38:	85 c0                	test   %eax,%eax
+  800f3a:	7f 28                	jg     800f64 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f54:	89 df                	mov    %ebx,%edi
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	8d 35 61 0f 80 00    	lea    0x800f61,%esi
+  800f5f:	0f 34                	sysenter
+  800f61:	5d                   	pop    %ebp
+		goto out;
+  800f62:	eb d4                	jmp    800f38 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	50                   	push   %eax
+  800f68:	6a 09                	push   $0x9
+  800f6a:	68 ab 2f 80 00       	push   $0x802fab
+  800f6f:	6a 3f                	push   $0x3f
+  800f71:	68 c8 2f 80 00       	push   $0x802fc8
+  800f76:	e8 c9 f1 ff ff       	call   800144 <_panic>
+
+00800f7b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	57                   	push   %edi
+  800f7f:	56                   	push   %esi
+  800f80:	53                   	push   %ebx
+  800f81:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f84:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f8b:	74 22                	je     800faf <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f92:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9d:	89 df                	mov    %ebx,%edi
+  800f9f:	89 de                	mov    %ebx,%esi
+  800fa1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa3:	85 c0                	test   %eax,%eax
+  800fa5:	7f 28                	jg     800fcf <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fa7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800faa:	5b                   	pop    %ebx
+  800fab:	5e                   	pop    %esi
+  800fac:	5f                   	pop    %edi
+  800fad:	5d                   	pop    %ebp
+  800fae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800faf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fbf:	89 df                	mov    %ebx,%edi
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	8d 35 cc 0f 80 00    	lea    0x800fcc,%esi
+  800fca:	0f 34                	sysenter
+  800fcc:	5d                   	pop    %ebp
+		goto out;
+  800fcd:	eb d4                	jmp    800fa3 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fcf:	83 ec 0c             	sub    $0xc,%esp
+  800fd2:	50                   	push   %eax
+  800fd3:	6a 0a                	push   $0xa
+  800fd5:	68 ab 2f 80 00       	push   $0x802fab
+  800fda:	6a 3f                	push   $0x3f
+  800fdc:	68 c8 2f 80 00       	push   $0x802fc8
+  800fe1:	e8 5e f1 ff ff       	call   800144 <_panic>
+
+00800fe6 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fe6:	55                   	push   %ebp
+  800fe7:	89 e5                	mov    %esp,%ebp
+  800fe9:	57                   	push   %edi
+  800fea:	56                   	push   %esi
+  800feb:	53                   	push   %ebx
+  800fec:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fef:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ff6:	74 22                	je     80101a <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800ff8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffd:	b8 17 00 00 00       	mov    $0x17,%eax
+  801002:	8b 55 08             	mov    0x8(%ebp),%edx
+  801005:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801008:	89 df                	mov    %ebx,%edi
+  80100a:	89 de                	mov    %ebx,%esi
+  80100c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	7f 28                	jg     80103a <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801012:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801015:	5b                   	pop    %ebx
+  801016:	5e                   	pop    %esi
+  801017:	5f                   	pop    %edi
+  801018:	5d                   	pop    %ebp
+  801019:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80101a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 17 00 00 00       	mov    $0x17,%eax
+  80102a:	89 df                	mov    %ebx,%edi
+  80102c:	55                   	push   %ebp
+  80102d:	89 e5                	mov    %esp,%ebp
+  80102f:	8d 35 37 10 80 00    	lea    0x801037,%esi
+  801035:	0f 34                	sysenter
+  801037:	5d                   	pop    %ebp
+		goto out;
+  801038:	eb d4                	jmp    80100e <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103a:	83 ec 0c             	sub    $0xc,%esp
+  80103d:	50                   	push   %eax
+  80103e:	6a 17                	push   $0x17
+  801040:	68 ab 2f 80 00       	push   $0x802fab
+  801045:	6a 3f                	push   $0x3f
+  801047:	68 c8 2f 80 00       	push   $0x802fc8
+  80104c:	e8 f3 f0 ff ff       	call   800144 <_panic>
+
+00801051 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	56                   	push   %esi
+  801056:	53                   	push   %ebx
+  801057:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80105a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801061:	74 22                	je     801085 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801063:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801068:	b8 18 00 00 00       	mov    $0x18,%eax
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	89 df                	mov    %ebx,%edi
+  801075:	89 de                	mov    %ebx,%esi
+  801077:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801079:	85 c0                	test   %eax,%eax
+  80107b:	7f 28                	jg     8010a5 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80107d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801080:	5b                   	pop    %ebx
+  801081:	5e                   	pop    %esi
+  801082:	5f                   	pop    %edi
+  801083:	5d                   	pop    %ebp
+  801084:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801085:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801090:	b8 18 00 00 00       	mov    $0x18,%eax
+  801095:	89 df                	mov    %ebx,%edi
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	8d 35 a2 10 80 00    	lea    0x8010a2,%esi
+  8010a0:	0f 34                	sysenter
+  8010a2:	5d                   	pop    %ebp
+		goto out;
+  8010a3:	eb d4                	jmp    801079 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a5:	83 ec 0c             	sub    $0xc,%esp
+  8010a8:	50                   	push   %eax
+  8010a9:	6a 18                	push   $0x18
+  8010ab:	68 ab 2f 80 00       	push   $0x802fab
+  8010b0:	6a 3f                	push   $0x3f
+  8010b2:	68 c8 2f 80 00       	push   $0x802fc8
+  8010b7:	e8 88 f0 ff ff       	call   800144 <_panic>
+
+008010bc <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010c2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010c9:	74 1d                	je     8010e8 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8010cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010de:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e1:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010e3:	5b                   	pop    %ebx
+  8010e4:	5e                   	pop    %esi
+  8010e5:	5f                   	pop    %edi
+  8010e6:	5d                   	pop    %ebp
+  8010e7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	8d 35 04 11 80 00    	lea    0x801104,%esi
+  801102:	0f 34                	sysenter
+  801104:	5d                   	pop    %ebp
+		goto out;
+  801105:	eb dc                	jmp    8010e3 <sys_ipc_try_send+0x27>
+
+00801107 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	57                   	push   %edi
+  80110b:	56                   	push   %esi
+  80110c:	53                   	push   %ebx
+  80110d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801110:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801117:	74 21                	je     80113a <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801119:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80111e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801123:	8b 55 08             	mov    0x8(%ebp),%edx
+  801126:	89 cb                	mov    %ecx,%ebx
+  801128:	89 cf                	mov    %ecx,%edi
+  80112a:	89 ce                	mov    %ecx,%esi
+  80112c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80112e:	85 c0                	test   %eax,%eax
+  801130:	7f 27                	jg     801159 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801132:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801135:	5b                   	pop    %ebx
+  801136:	5e                   	pop    %esi
+  801137:	5f                   	pop    %edi
+  801138:	5d                   	pop    %ebp
+  801139:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80113a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801142:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801147:	89 cb                	mov    %ecx,%ebx
+  801149:	89 cf                	mov    %ecx,%edi
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	8d 35 56 11 80 00    	lea    0x801156,%esi
+  801154:	0f 34                	sysenter
+  801156:	5d                   	pop    %ebp
+		goto out;
+  801157:	eb d5                	jmp    80112e <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801159:	83 ec 0c             	sub    $0xc,%esp
+  80115c:	50                   	push   %eax
+  80115d:	6a 0d                	push   $0xd
+  80115f:	68 ab 2f 80 00       	push   $0x802fab
+  801164:	6a 3f                	push   $0x3f
+  801166:	68 c8 2f 80 00       	push   $0x802fc8
+  80116b:	e8 d4 ef ff ff       	call   800144 <_panic>
+
+00801170 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801176:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80117d:	74 1b                	je     80119a <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80117f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801184:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118f:	89 df                	mov    %ebx,%edi
+  801191:	89 de                	mov    %ebx,%esi
+  801193:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80119a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011aa:	89 df                	mov    %ebx,%edi
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	8d 35 b7 11 80 00    	lea    0x8011b7,%esi
+  8011b5:	0f 34                	sysenter
+  8011b7:	5d                   	pop    %ebp
+		goto out;
+  8011b8:	eb db                	jmp    801195 <sys_ipc_recv_until+0x25>
+
+008011ba <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011c0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011c7:	74 19                	je     8011e2 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8011c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ce:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d3:	89 d1                	mov    %edx,%ecx
+  8011d5:	89 d3                	mov    %edx,%ebx
+  8011d7:	89 d7                	mov    %edx,%edi
+  8011d9:	89 d6                	mov    %edx,%esi
+  8011db:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011dd:	5b                   	pop    %ebx
+  8011de:	5e                   	pop    %esi
+  8011df:	5f                   	pop    %edi
+  8011e0:	5d                   	pop    %ebp
+  8011e1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011ec:	89 d1                	mov    %edx,%ecx
+  8011ee:	89 d3                	mov    %edx,%ebx
+  8011f0:	89 d7                	mov    %edx,%edi
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	8d 35 fd 11 80 00    	lea    0x8011fd,%esi
+  8011fb:	0f 34                	sysenter
+  8011fd:	5d                   	pop    %ebp
+		goto out;
+  8011fe:	eb dd                	jmp    8011dd <sys_time_msec+0x23>
+
+00801200 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801206:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80120d:	74 1a                	je     801229 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80120f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801214:	b8 10 00 00 00       	mov    $0x10,%eax
+  801219:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121c:	89 cb                	mov    %ecx,%ebx
+  80121e:	89 cf                	mov    %ecx,%edi
+  801220:	89 ce                	mov    %ecx,%esi
+  801222:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801224:	5b                   	pop    %ebx
+  801225:	5e                   	pop    %esi
+  801226:	5f                   	pop    %edi
+  801227:	5d                   	pop    %ebp
+  801228:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801229:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801231:	b8 10 00 00 00       	mov    $0x10,%eax
+  801236:	89 cb                	mov    %ecx,%ebx
+  801238:	89 cf                	mov    %ecx,%edi
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	8d 35 45 12 80 00    	lea    0x801245,%esi
+  801243:	0f 34                	sysenter
+  801245:	5d                   	pop    %ebp
+		goto out;
+  801246:	eb dc                	jmp    801224 <sys_sleep_until+0x24>
+
+00801248 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801248:	55                   	push   %ebp
+  801249:	89 e5                	mov    %esp,%ebp
+  80124b:	57                   	push   %edi
+  80124c:	56                   	push   %esi
+  80124d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80124e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801255:	74 1a                	je     801271 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801257:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80125c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801261:	8b 55 08             	mov    0x8(%ebp),%edx
+  801264:	89 cb                	mov    %ecx,%ebx
+  801266:	89 cf                	mov    %ecx,%edi
+  801268:	89 ce                	mov    %ecx,%esi
+  80126a:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80126c:	5b                   	pop    %ebx
+  80126d:	5e                   	pop    %esi
+  80126e:	5f                   	pop    %edi
+  80126f:	5d                   	pop    %ebp
+  801270:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801279:	b8 11 00 00 00       	mov    $0x11,%eax
+  80127e:	89 cb                	mov    %ecx,%ebx
+  801280:	89 cf                	mov    %ecx,%edi
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	8d 35 8d 12 80 00    	lea    0x80128d,%esi
+  80128b:	0f 34                	sysenter
+  80128d:	5d                   	pop    %ebp
+		goto out;
+  80128e:	eb dc                	jmp    80126c <sys_env_print_stats+0x24>
+
+00801290 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	57                   	push   %edi
+  801294:	56                   	push   %esi
+  801295:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801296:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80129d:	74 1b                	je     8012ba <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80129f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012af:	89 df                	mov    %ebx,%edi
+  8012b1:	89 de                	mov    %ebx,%esi
+  8012b3:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012b5:	5b                   	pop    %ebx
+  8012b6:	5e                   	pop    %esi
+  8012b7:	5f                   	pop    %edi
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012ca:	89 df                	mov    %ebx,%edi
+  8012cc:	55                   	push   %ebp
+  8012cd:	89 e5                	mov    %esp,%ebp
+  8012cf:	8d 35 d7 12 80 00    	lea    0x8012d7,%esi
+  8012d5:	0f 34                	sysenter
+  8012d7:	5d                   	pop    %ebp
+		goto out;
+  8012d8:	eb db                	jmp    8012b5 <sys_perf+0x25>
+
+008012da <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	57                   	push   %edi
+  8012de:	56                   	push   %esi
+  8012df:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012e0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012e7:	74 19                	je     801302 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ee:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012f3:	89 d1                	mov    %edx,%ecx
+  8012f5:	89 d3                	mov    %edx,%ebx
+  8012f7:	89 d7                	mov    %edx,%edi
+  8012f9:	89 d6                	mov    %edx,%esi
+  8012fb:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012fd:	5b                   	pop    %ebx
+  8012fe:	5e                   	pop    %esi
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801302:	ba 00 00 00 00       	mov    $0x0,%edx
+  801307:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80130c:	89 d1                	mov    %edx,%ecx
+  80130e:	89 d3                	mov    %edx,%ebx
+  801310:	89 d7                	mov    %edx,%edi
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	8d 35 1d 13 80 00    	lea    0x80131d,%esi
+  80131b:	0f 34                	sysenter
+  80131d:	5d                   	pop    %ebp
+		goto out;
+  80131e:	eb dd                	jmp    8012fd <sys_fork+0x23>
+
+00801320 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801320:	55                   	push   %ebp
+  801321:	89 e5                	mov    %esp,%ebp
+  801323:	57                   	push   %edi
+  801324:	56                   	push   %esi
+  801325:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801326:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80132d:	74 1c                	je     80134b <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80132f:	be 00 00 00 00       	mov    $0x0,%esi
+  801334:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801339:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801342:	89 f7                	mov    %esi,%edi
+  801344:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801346:	5b                   	pop    %ebx
+  801347:	5e                   	pop    %esi
+  801348:	5f                   	pop    %edi
+  801349:	5d                   	pop    %ebp
+  80134a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80134b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801351:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801356:	bf 00 00 00 00       	mov    $0x0,%edi
+  80135b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	8d 35 69 13 80 00    	lea    0x801369,%esi
+  801367:	0f 34                	sysenter
+  801369:	5d                   	pop    %ebp
+		goto out;
+  80136a:	eb da                	jmp    801346 <sys_thread_create+0x26>
+
+0080136c <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80136c:	55                   	push   %ebp
+  80136d:	89 e5                	mov    %esp,%ebp
+  80136f:	57                   	push   %edi
+  801370:	56                   	push   %esi
+  801371:	53                   	push   %ebx
+  801372:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801375:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80137c:	74 24                	je     8013a2 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80137e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801383:	be 00 00 00 00       	mov    $0x0,%esi
+  801388:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801391:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801394:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801396:	85 c0                	test   %eax,%eax
+  801398:	7f 27                	jg     8013c1 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80139a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139d:	5b                   	pop    %ebx
+  80139e:	5e                   	pop    %esi
+  80139f:	5f                   	pop    %edi
+  8013a0:	5d                   	pop    %ebp
+  8013a1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013b3:	55                   	push   %ebp
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	8d 35 be 13 80 00    	lea    0x8013be,%esi
+  8013bc:	0f 34                	sysenter
+  8013be:	5d                   	pop    %ebp
+		goto out;
+  8013bf:	eb d5                	jmp    801396 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c1:	83 ec 0c             	sub    $0xc,%esp
+  8013c4:	50                   	push   %eax
+  8013c5:	6a 1f                	push   $0x1f
+  8013c7:	68 ab 2f 80 00       	push   $0x802fab
+  8013cc:	6a 3f                	push   $0x3f
+  8013ce:	68 c8 2f 80 00       	push   $0x802fc8
+  8013d3:	e8 6c ed ff ff       	call   800144 <_panic>
+
+008013d8 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013d8:	55                   	push   %ebp
+  8013d9:	89 e5                	mov    %esp,%ebp
+  8013db:	57                   	push   %edi
+  8013dc:	56                   	push   %esi
+  8013dd:	53                   	push   %ebx
+  8013de:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013e1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013e8:	74 23                	je     80140d <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ef:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013fd:	89 f7                	mov    %esi,%edi
+  8013ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801401:	85 c0                	test   %eax,%eax
+  801403:	7f 29                	jg     80142e <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801405:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801408:	5b                   	pop    %ebx
+  801409:	5e                   	pop    %esi
+  80140a:	5f                   	pop    %edi
+  80140b:	5d                   	pop    %ebp
+  80140c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80140d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801410:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801413:	b8 20 00 00 00       	mov    $0x20,%eax
+  801418:	bf 00 00 00 00       	mov    $0x0,%edi
+  80141d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	8d 35 2b 14 80 00    	lea    0x80142b,%esi
+  801429:	0f 34                	sysenter
+  80142b:	5d                   	pop    %ebp
+		goto out;
+  80142c:	eb d3                	jmp    801401 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80142e:	83 ec 0c             	sub    $0xc,%esp
+  801431:	50                   	push   %eax
+  801432:	6a 20                	push   $0x20
+  801434:	68 ab 2f 80 00       	push   $0x802fab
+  801439:	6a 3f                	push   $0x3f
+  80143b:	68 c8 2f 80 00       	push   $0x802fc8
+  801440:	e8 ff ec ff ff       	call   800144 <_panic>
+
+00801445 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	57                   	push   %edi
+  801449:	56                   	push   %esi
+  80144a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80144b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801452:	74 1b                	je     80146f <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801454:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801459:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80145e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801461:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801464:	89 df                	mov    %ebx,%edi
+  801466:	89 de                	mov    %ebx,%esi
+  801468:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80146a:	5b                   	pop    %ebx
+  80146b:	5e                   	pop    %esi
+  80146c:	5f                   	pop    %edi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80146f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801474:	8b 55 08             	mov    0x8(%ebp),%edx
+  801477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80147f:	89 df                	mov    %ebx,%edi
+  801481:	55                   	push   %ebp
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	8d 35 8c 14 80 00    	lea    0x80148c,%esi
+  80148a:	0f 34                	sysenter
+  80148c:	5d                   	pop    %ebp
+		goto out;
+  80148d:	eb db                	jmp    80146a <sys_batch+0x25>
+
+0080148f <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80148f:	55                   	push   %ebp
+  801490:	89 e5                	mov    %esp,%ebp
+  801492:	57                   	push   %edi
+  801493:	56                   	push   %esi
+  801494:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801495:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80149c:	74 1a                	je     8014b8 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80149e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ab:	89 cb                	mov    %ecx,%ebx
+  8014ad:	89 cf                	mov    %ecx,%edi
+  8014af:	89 ce                	mov    %ecx,%esi
+  8014b1:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014b3:	5b                   	pop    %ebx
+  8014b4:	5e                   	pop    %esi
+  8014b5:	5f                   	pop    %edi
+  8014b6:	5d                   	pop    %ebp
+  8014b7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014c5:	89 cb                	mov    %ecx,%ebx
+  8014c7:	89 cf                	mov    %ecx,%edi
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	8d 35 d4 14 80 00    	lea    0x8014d4,%esi
+  8014d2:	0f 34                	sysenter
+  8014d4:	5d                   	pop    %ebp
+		goto out;
+  8014d5:	eb dc                	jmp    8014b3 <sys_trace_ctl+0x24>
+
+008014d7 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014d7:	55                   	push   %ebp
+  8014d8:	89 e5                	mov    %esp,%ebp
+  8014da:	57                   	push   %edi
+  8014db:	56                   	push   %esi
+  8014dc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014dd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e4:	74 1c                	je     801502 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f9:	89 f7                	mov    %esi,%edi
+  8014fb:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014fd:	5b                   	pop    %ebx
+  8014fe:	5e                   	pop    %esi
+  8014ff:	5f                   	pop    %edi
+  801500:	5d                   	pop    %ebp
+  801501:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801502:	8b 55 08             	mov    0x8(%ebp),%edx
+  801505:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801508:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80150d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	8d 35 20 15 80 00    	lea    0x801520,%esi
+  80151e:	0f 34                	sysenter
+  801520:	5d                   	pop    %ebp
+		goto out;
+  801521:	eb da                	jmp    8014fd <sys_trace_read+0x26>
+
+00801523 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801523:	55                   	push   %ebp
+  801524:	89 e5                	mov    %esp,%ebp
+  801526:	57                   	push   %edi
+  801527:	56                   	push   %esi
+  801528:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801529:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801530:	74 1c                	je     80154e <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801532:	be 00 00 00 00       	mov    $0x0,%esi
+  801537:	b8 21 00 00 00       	mov    $0x21,%eax
+  80153c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801542:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801545:	89 f7                	mov    %esi,%edi
+  801547:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801549:	5b                   	pop    %ebx
+  80154a:	5e                   	pop    %esi
+  80154b:	5f                   	pop    %edi
+  80154c:	5d                   	pop    %ebp
+  80154d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80154e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801551:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801554:	b8 21 00 00 00       	mov    $0x21,%eax
+  801559:	bf 00 00 00 00       	mov    $0x0,%edi
+  80155e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	8d 35 6c 15 80 00    	lea    0x80156c,%esi
+  80156a:	0f 34                	sysenter
+  80156c:	5d                   	pop    %ebp
+		goto out;
+  80156d:	eb da                	jmp    801549 <sys_meminfo+0x26>
+
+0080156f <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80156f:	55                   	push   %ebp
+  801570:	89 e5                	mov    %esp,%ebp
+  801572:	57                   	push   %edi
+  801573:	56                   	push   %esi
+  801574:	53                   	push   %ebx
+  801575:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801578:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80157c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801583:	74 1f                	je     8015a4 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801585:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80158f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801592:	89 df                	mov    %ebx,%edi
+  801594:	89 de                	mov    %ebx,%esi
+  801596:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	7f 25                	jg     8015c1 <sys_env_set_ksm+0x52>
+}
+  80159c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159f:	5b                   	pop    %ebx
+  8015a0:	5e                   	pop    %esi
+  8015a1:	5f                   	pop    %edi
+  8015a2:	5d                   	pop    %ebp
+  8015a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ac:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015b1:	89 df                	mov    %ebx,%edi
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	8d 35 be 15 80 00    	lea    0x8015be,%esi
+  8015bc:	0f 34                	sysenter
+  8015be:	5d                   	pop    %ebp
+		goto out;
+  8015bf:	eb d7                	jmp    801598 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c1:	83 ec 0c             	sub    $0xc,%esp
+  8015c4:	50                   	push   %eax
+  8015c5:	6a 22                	push   $0x22
+  8015c7:	68 ab 2f 80 00       	push   $0x802fab
+  8015cc:	6a 3f                	push   $0x3f
+  8015ce:	68 c8 2f 80 00       	push   $0x802fc8
+  8015d3:	e8 6c eb ff ff       	call   800144 <_panic>
+
+008015d8 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015d8:	55                   	push   %ebp
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	57                   	push   %edi
+  8015dc:	56                   	push   %esi
+  8015dd:	53                   	push   %ebx
+  8015de:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015e1:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015e4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015eb:	74 24                	je     801611 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015f7:	89 cb                	mov    %ecx,%ebx
+  8015f9:	89 cf                	mov    %ecx,%edi
+  8015fb:	89 ce                	mov    %ecx,%esi
+  8015fd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	7f 2a                	jg     80162d <sys_time_nsec+0x55>
+	return ns;
+}
+  801603:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801606:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160c:	5b                   	pop    %ebx
+  80160d:	5e                   	pop    %esi
+  80160e:	5f                   	pop    %edi
+  80160f:	5d                   	pop    %ebp
+  801610:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801611:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801616:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80161b:	89 cb                	mov    %ecx,%ebx
+  80161d:	89 cf                	mov    %ecx,%edi
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	8d 35 2a 16 80 00    	lea    0x80162a,%esi
+  801628:	0f 34                	sysenter
+  80162a:	5d                   	pop    %ebp
+		goto out;
+  80162b:	eb d2                	jmp    8015ff <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80162d:	83 ec 0c             	sub    $0xc,%esp
+  801630:	50                   	push   %eax
+  801631:	6a 0f                	push   $0xf
+  801633:	68 ab 2f 80 00       	push   $0x802fab
+  801638:	6a 3f                	push   $0x3f
+  80163a:	68 c8 2f 80 00       	push   $0x802fc8
+  80163f:	e8 00 eb ff ff       	call   800144 <_panic>
+
+00801644 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	57                   	push   %edi
+  801648:	56                   	push   %esi
+  801649:	53                   	push   %ebx
+  80164a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80164d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801654:	74 22                	je     801678 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801656:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801660:	8b 55 08             	mov    0x8(%ebp),%edx
+  801663:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801666:	89 df                	mov    %ebx,%edi
+  801668:	89 de                	mov    %ebx,%esi
+  80166a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	7f 28                	jg     801698 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801673:	5b                   	pop    %ebx
+  801674:	5e                   	pop    %esi
+  801675:	5f                   	pop    %edi
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801678:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801680:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801683:	b8 12 00 00 00       	mov    $0x12,%eax
+  801688:	89 df                	mov    %ebx,%edi
+  80168a:	55                   	push   %ebp
+  80168b:	89 e5                	mov    %esp,%ebp
+  80168d:	8d 35 95 16 80 00    	lea    0x801695,%esi
+  801693:	0f 34                	sysenter
+  801695:	5d                   	pop    %ebp
+		goto out;
+  801696:	eb d4                	jmp    80166c <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801698:	83 ec 0c             	sub    $0xc,%esp
+  80169b:	50                   	push   %eax
+  80169c:	6a 12                	push   $0x12
+  80169e:	68 ab 2f 80 00       	push   $0x802fab
+  8016a3:	6a 3f                	push   $0x3f
+  8016a5:	68 c8 2f 80 00       	push   $0x802fc8
+  8016aa:	e8 95 ea ff ff       	call   800144 <_panic>
+
+008016af <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	57                   	push   %edi
+  8016b3:	56                   	push   %esi
+  8016b4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016b5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016bc:	74 1b                	je     8016d9 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8016be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ce:	89 df                	mov    %ebx,%edi
+  8016d0:	89 de                	mov    %ebx,%esi
+  8016d2:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016d4:	5b                   	pop    %ebx
+  8016d5:	5e                   	pop    %esi
+  8016d6:	5f                   	pop    %edi
+  8016d7:	5d                   	pop    %ebp
+  8016d8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016e9:	89 df                	mov    %ebx,%edi
+  8016eb:	55                   	push   %ebp
+  8016ec:	89 e5                	mov    %esp,%ebp
+  8016ee:	8d 35 f6 16 80 00    	lea    0x8016f6,%esi
+  8016f4:	0f 34                	sysenter
+  8016f6:	5d                   	pop    %ebp
+		goto out;
+  8016f7:	eb db                	jmp    8016d4 <sys_e1000_receive+0x25>
+
+008016f9 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	57                   	push   %edi
+  8016fd:	56                   	push   %esi
+  8016fe:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016ff:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801706:	74 1b                	je     801723 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801712:	8b 55 08             	mov    0x8(%ebp),%edx
+  801715:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801718:	89 df                	mov    %ebx,%edi
+  80171a:	89 de                	mov    %ebx,%esi
+  80171c:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80171e:	5b                   	pop    %ebx
+  80171f:	5e                   	pop    %esi
+  801720:	5f                   	pop    %edi
+  801721:	5d                   	pop    %ebp
+  801722:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801723:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801728:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80172e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801733:	89 df                	mov    %ebx,%edi
+  801735:	55                   	push   %ebp
+  801736:	89 e5                	mov    %esp,%ebp
+  801738:	8d 35 40 17 80 00    	lea    0x801740,%esi
+  80173e:	0f 34                	sysenter
+  801740:	5d                   	pop    %ebp
+		goto out;
+  801741:	eb db                	jmp    80171e <sys_e1000_read_hwaddr+0x25>
+
+00801743 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801743:	55                   	push   %ebp
+  801744:	89 e5                	mov    %esp,%ebp
+  801746:	57                   	push   %edi
+  801747:	56                   	push   %esi
+  801748:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801749:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801750:	74 1a                	je     80176c <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801752:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801757:	b8 15 00 00 00       	mov    $0x15,%eax
+  80175c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175f:	89 cb                	mov    %ecx,%ebx
+  801761:	89 cf                	mov    %ecx,%edi
+  801763:	89 ce                	mov    %ecx,%esi
+  801765:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801767:	5b                   	pop    %ebx
+  801768:	5e                   	pop    %esi
+  801769:	5f                   	pop    %edi
+  80176a:	5d                   	pop    %ebp
+  80176b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80176c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801774:	b8 15 00 00 00       	mov    $0x15,%eax
+  801779:	89 cb                	mov    %ecx,%ebx
+  80177b:	89 cf                	mov    %ecx,%edi
+  80177d:	55                   	push   %ebp
+  80177e:	89 e5                	mov    %esp,%ebp
+  801780:	8d 35 88 17 80 00    	lea    0x801788,%esi
+  801786:	0f 34                	sysenter
+  801788:	5d                   	pop    %ebp
+		goto out;
+  801789:	eb dc                	jmp    801767 <sys_sb16_read_version+0x24>
+
+0080178b <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+  80178e:	57                   	push   %edi
+  80178f:	56                   	push   %esi
+  801790:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801791:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801798:	74 1b                	je     8017b5 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80179a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179f:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017aa:	89 df                	mov    %ebx,%edi
+  8017ac:	89 de                	mov    %ebx,%esi
+  8017ae:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017b0:	5b                   	pop    %ebx
+  8017b1:	5e                   	pop    %esi
+  8017b2:	5f                   	pop    %edi
+  8017b3:	5d                   	pop    %ebp
+  8017b4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017c5:	89 df                	mov    %ebx,%edi
+  8017c7:	55                   	push   %ebp
+  8017c8:	89 e5                	mov    %esp,%ebp
+  8017ca:	8d 35 d2 17 80 00    	lea    0x8017d2,%esi
+  8017d0:	0f 34                	sysenter
+  8017d2:	5d                   	pop    %ebp
+		goto out;
+  8017d3:	eb db                	jmp    8017b0 <sys_sb16_play+0x25>
+
+008017d5 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8017d5:	55                   	push   %ebp
+  8017d6:	89 e5                	mov    %esp,%ebp
+  8017d8:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8017db:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  8017e2:	74 0a                	je     8017ee <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8017e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e7:	a3 10 50 80 00       	mov    %eax,0x805010
+}
+  8017ec:	c9                   	leave
+  8017ed:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8017ee:	83 ec 04             	sub    $0x4,%esp
+  8017f1:	6a 07                	push   $0x7
+  8017f3:	68 00 f0 bf ee       	push   $0xeebff000
+  8017f8:	6a 00                	push   $0x0
+  8017fa:	e8 60 f5 ff ff       	call   800d5f <sys_page_alloc>
+  8017ff:	83 c4 10             	add    $0x10,%esp
+  801802:	85 c0                	test   %eax,%eax
+  801804:	78 14                	js     80181a <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801806:	83 ec 08             	sub    $0x8,%esp
+  801809:	68 3c 18 80 00       	push   $0x80183c
+  80180e:	6a 00                	push   $0x0
+  801810:	e8 66 f7 ff ff       	call   800f7b <sys_env_set_pgfault_upcall>
+  801815:	83 c4 10             	add    $0x10,%esp
+  801818:	eb ca                	jmp    8017e4 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  80181a:	83 ec 08             	sub    $0x8,%esp
+  80181d:	50                   	push   %eax
+  80181e:	68 d6 2f 80 00       	push   $0x802fd6
+  801823:	e8 f7 e9 ff ff       	call   80021f <cprintf>
+			panic("set_pgfault_handler error");
+  801828:	83 c4 0c             	add    $0xc,%esp
+  80182b:	68 e1 2f 80 00       	push   $0x802fe1
+  801830:	6a 24                	push   $0x24
+  801832:	68 fb 2f 80 00       	push   $0x802ffb
+  801837:	e8 08 e9 ff ff       	call   800144 <_panic>
+
+0080183c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80183c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80183d:	a1 10 50 80 00       	mov    0x805010,%eax
+	call *%eax
+  801842:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801844:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  801847:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80184b:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  80184e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  801852:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  801854:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  801858:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  801859:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  80185d:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  80185e:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  80185f:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801863:	c3                   	ret
+
+00801864 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801864:	55                   	push   %ebp
+  801865:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801867:	8b 45 08             	mov    0x8(%ebp),%eax
+  80186a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80186f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801872:	5d                   	pop    %ebp
+  801873:	c3                   	ret
+
+00801874 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801874:	55                   	push   %ebp
+  801875:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801877:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80187f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801884:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801889:	5d                   	pop    %ebp
+  80188a:	c3                   	ret
+
+0080188b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80188b:	55                   	push   %ebp
+  80188c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80188e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801893:	eb 02                	jmp    801897 <fd_alloc+0xc>
+  801895:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801897:	89 c2                	mov    %eax,%edx
+  801899:	c1 ea 16             	shr    $0x16,%edx
+  80189c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018a3:	f6 c2 01             	test   $0x1,%dl
+  8018a6:	74 2b                	je     8018d3 <fd_alloc+0x48>
+  8018a8:	89 c2                	mov    %eax,%edx
+  8018aa:	c1 ea 0c             	shr    $0xc,%edx
+  8018ad:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018b4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018ba:	f6 c1 01             	test   $0x1,%cl
+  8018bd:	74 14                	je     8018d3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018bf:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018c5:	75 ce                	jne    801895 <fd_alloc+0xa>
+  8018c7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018cc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018d1:	eb 05                	jmp    8018d8 <fd_alloc+0x4d>
+			return 0;
+  8018d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018db:	89 02                	mov    %eax,(%edx)
+}
+  8018dd:	89 c8                	mov    %ecx,%eax
+  8018df:	5d                   	pop    %ebp
+  8018e0:	c3                   	ret
+
+008018e1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018e1:	55                   	push   %ebp
+  8018e2:	89 e5                	mov    %esp,%ebp
+  8018e4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018e7:	83 f8 1f             	cmp    $0x1f,%eax
+  8018ea:	77 30                	ja     80191c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018ec:	c1 e0 0c             	shl    $0xc,%eax
+  8018ef:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018f4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018fa:	f6 c2 01             	test   $0x1,%dl
+  8018fd:	74 24                	je     801923 <fd_lookup+0x42>
+  8018ff:	89 c2                	mov    %eax,%edx
+  801901:	c1 ea 0c             	shr    $0xc,%edx
+  801904:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80190b:	f6 c2 01             	test   $0x1,%dl
+  80190e:	74 1a                	je     80192a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801910:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801913:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801915:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80191a:	5d                   	pop    %ebp
+  80191b:	c3                   	ret
+		return -E_INVAL;
+  80191c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801921:	eb f7                	jmp    80191a <fd_lookup+0x39>
+		return -E_INVAL;
+  801923:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801928:	eb f0                	jmp    80191a <fd_lookup+0x39>
+  80192a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80192f:	eb e9                	jmp    80191a <fd_lookup+0x39>
+
+00801931 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801931:	55                   	push   %ebp
+  801932:	89 e5                	mov    %esp,%ebp
+  801934:	53                   	push   %ebx
+  801935:	83 ec 04             	sub    $0x4,%esp
+  801938:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80193b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801940:	eb 03                	jmp    801945 <dev_lookup+0x14>
+  801942:	83 c0 01             	add    $0x1,%eax
+  801945:	8b 1c 85 88 30 80 00 	mov    0x803088(,%eax,4),%ebx
+  80194c:	85 db                	test   %ebx,%ebx
+  80194e:	74 0b                	je     80195b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801950:	39 13                	cmp    %edx,(%ebx)
+  801952:	75 ee                	jne    801942 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801954:	b8 00 00 00 00       	mov    $0x0,%eax
+  801959:	eb 2e                	jmp    801989 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80195b:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80195d:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801962:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801968:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80196d:	76 24                	jbe    801993 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80196f:	8b 41 48             	mov    0x48(%ecx),%eax
+  801972:	83 ec 04             	sub    $0x4,%esp
+  801975:	52                   	push   %edx
+  801976:	50                   	push   %eax
+  801977:	68 0c 30 80 00       	push   $0x80300c
+  80197c:	e8 9e e8 ff ff       	call   80021f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801981:	83 c4 10             	add    $0x10,%esp
+  801984:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801989:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80198c:	89 1a                	mov    %ebx,(%edx)
+}
+  80198e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801991:	c9                   	leave
+  801992:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801993:	c1 e8 10             	shr    $0x10,%eax
+  801996:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80199c:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8019a2:	eb cb                	jmp    80196f <dev_lookup+0x3e>
+
+008019a4 <fd_close>:
+{
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+  8019a7:	57                   	push   %edi
+  8019a8:	56                   	push   %esi
+  8019a9:	53                   	push   %ebx
+  8019aa:	83 ec 24             	sub    $0x24,%esp
+  8019ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019b6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019b7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019bd:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019c0:	50                   	push   %eax
+  8019c1:	e8 1b ff ff ff       	call   8018e1 <fd_lookup>
+  8019c6:	89 c3                	mov    %eax,%ebx
+  8019c8:	83 c4 10             	add    $0x10,%esp
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	78 05                	js     8019d4 <fd_close+0x30>
+	    || fd != fd2)
+  8019cf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019d2:	74 16                	je     8019ea <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019d4:	89 f8                	mov    %edi,%eax
+  8019d6:	84 c0                	test   %al,%al
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019e0:	89 d8                	mov    %ebx,%eax
+  8019e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019e5:	5b                   	pop    %ebx
+  8019e6:	5e                   	pop    %esi
+  8019e7:	5f                   	pop    %edi
+  8019e8:	5d                   	pop    %ebp
+  8019e9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019ea:	83 ec 08             	sub    $0x8,%esp
+  8019ed:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019f0:	50                   	push   %eax
+  8019f1:	ff 36                	push   (%esi)
+  8019f3:	e8 39 ff ff ff       	call   801931 <dev_lookup>
+  8019f8:	89 c3                	mov    %eax,%ebx
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	85 c0                	test   %eax,%eax
+  8019ff:	78 1a                	js     801a1b <fd_close+0x77>
+		if (dev->dev_close)
+  801a01:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a04:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a07:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	74 0b                	je     801a1b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a10:	83 ec 0c             	sub    $0xc,%esp
+  801a13:	56                   	push   %esi
+  801a14:	ff d0                	call   *%eax
+  801a16:	89 c3                	mov    %eax,%ebx
+  801a18:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a1b:	83 ec 08             	sub    $0x8,%esp
+  801a1e:	56                   	push   %esi
+  801a1f:	6a 00                	push   $0x0
+  801a21:	e8 14 f4 ff ff       	call   800e3a <sys_page_unmap>
+	return r;
+  801a26:	83 c4 10             	add    $0x10,%esp
+  801a29:	eb b5                	jmp    8019e0 <fd_close+0x3c>
+
+00801a2b <close>:
+
+int
+close(int fdnum)
+{
+  801a2b:	55                   	push   %ebp
+  801a2c:	89 e5                	mov    %esp,%ebp
+  801a2e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a34:	50                   	push   %eax
+  801a35:	ff 75 08             	push   0x8(%ebp)
+  801a38:	e8 a4 fe ff ff       	call   8018e1 <fd_lookup>
+  801a3d:	83 c4 10             	add    $0x10,%esp
+  801a40:	85 c0                	test   %eax,%eax
+  801a42:	79 02                	jns    801a46 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a44:	c9                   	leave
+  801a45:	c3                   	ret
+		return fd_close(fd, 1);
+  801a46:	83 ec 08             	sub    $0x8,%esp
+  801a49:	6a 01                	push   $0x1
+  801a4b:	ff 75 f4             	push   -0xc(%ebp)
+  801a4e:	e8 51 ff ff ff       	call   8019a4 <fd_close>
+  801a53:	83 c4 10             	add    $0x10,%esp
+  801a56:	eb ec                	jmp    801a44 <close+0x19>
+
+00801a58 <close_all>:
+
+void
+close_all(void)
+{
+  801a58:	55                   	push   %ebp
+  801a59:	89 e5                	mov    %esp,%ebp
+  801a5b:	53                   	push   %ebx
+  801a5c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a64:	83 ec 0c             	sub    $0xc,%esp
+  801a67:	53                   	push   %ebx
+  801a68:	e8 be ff ff ff       	call   801a2b <close>
+	for (i = 0; i < MAXFD; i++)
+  801a6d:	83 c3 01             	add    $0x1,%ebx
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	83 fb 20             	cmp    $0x20,%ebx
+  801a76:	75 ec                	jne    801a64 <close_all+0xc>
+}
+  801a78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a7b:	c9                   	leave
+  801a7c:	c3                   	ret
+
+00801a7d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a7d:	55                   	push   %ebp
+  801a7e:	89 e5                	mov    %esp,%ebp
+  801a80:	57                   	push   %edi
+  801a81:	56                   	push   %esi
+  801a82:	53                   	push   %ebx
+  801a83:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a86:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a89:	50                   	push   %eax
+  801a8a:	ff 75 08             	push   0x8(%ebp)
+  801a8d:	e8 4f fe ff ff       	call   8018e1 <fd_lookup>
+  801a92:	89 c3                	mov    %eax,%ebx
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	85 c0                	test   %eax,%eax
+  801a99:	78 7f                	js     801b1a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a9b:	83 ec 0c             	sub    $0xc,%esp
+  801a9e:	ff 75 0c             	push   0xc(%ebp)
+  801aa1:	e8 85 ff ff ff       	call   801a2b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801aa6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801aa9:	c1 e6 0c             	shl    $0xc,%esi
+  801aac:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ab2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ab5:	89 3c 24             	mov    %edi,(%esp)
+  801ab8:	e8 b7 fd ff ff       	call   801874 <fd2data>
+  801abd:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801abf:	89 34 24             	mov    %esi,(%esp)
+  801ac2:	e8 ad fd ff ff       	call   801874 <fd2data>
+  801ac7:	83 c4 10             	add    $0x10,%esp
+  801aca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801acd:	89 d8                	mov    %ebx,%eax
+  801acf:	c1 e8 16             	shr    $0x16,%eax
+  801ad2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ad9:	a8 01                	test   $0x1,%al
+  801adb:	74 11                	je     801aee <dup+0x71>
+  801add:	89 d8                	mov    %ebx,%eax
+  801adf:	c1 e8 0c             	shr    $0xc,%eax
+  801ae2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ae9:	f6 c2 01             	test   $0x1,%dl
+  801aec:	75 36                	jne    801b24 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801aee:	89 f8                	mov    %edi,%eax
+  801af0:	c1 e8 0c             	shr    $0xc,%eax
+  801af3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801afa:	83 ec 0c             	sub    $0xc,%esp
+  801afd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b02:	50                   	push   %eax
+  801b03:	56                   	push   %esi
+  801b04:	6a 00                	push   $0x0
+  801b06:	57                   	push   %edi
+  801b07:	6a 00                	push   $0x0
+  801b09:	e8 be f2 ff ff       	call   800dcc <sys_page_map>
+  801b0e:	89 c3                	mov    %eax,%ebx
+  801b10:	83 c4 20             	add    $0x20,%esp
+  801b13:	85 c0                	test   %eax,%eax
+  801b15:	78 33                	js     801b4a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b1a:	89 d8                	mov    %ebx,%eax
+  801b1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b1f:	5b                   	pop    %ebx
+  801b20:	5e                   	pop    %esi
+  801b21:	5f                   	pop    %edi
+  801b22:	5d                   	pop    %ebp
+  801b23:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b24:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b2b:	83 ec 0c             	sub    $0xc,%esp
+  801b2e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b33:	50                   	push   %eax
+  801b34:	ff 75 d4             	push   -0x2c(%ebp)
+  801b37:	6a 00                	push   $0x0
+  801b39:	53                   	push   %ebx
+  801b3a:	6a 00                	push   $0x0
+  801b3c:	e8 8b f2 ff ff       	call   800dcc <sys_page_map>
+  801b41:	89 c3                	mov    %eax,%ebx
+  801b43:	83 c4 20             	add    $0x20,%esp
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	79 a4                	jns    801aee <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b4a:	83 ec 08             	sub    $0x8,%esp
+  801b4d:	56                   	push   %esi
+  801b4e:	6a 00                	push   $0x0
+  801b50:	e8 e5 f2 ff ff       	call   800e3a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b55:	83 c4 08             	add    $0x8,%esp
+  801b58:	ff 75 d4             	push   -0x2c(%ebp)
+  801b5b:	6a 00                	push   $0x0
+  801b5d:	e8 d8 f2 ff ff       	call   800e3a <sys_page_unmap>
+	return r;
+  801b62:	83 c4 10             	add    $0x10,%esp
+  801b65:	eb b3                	jmp    801b1a <dup+0x9d>
+
+00801b67 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b67:	55                   	push   %ebp
+  801b68:	89 e5                	mov    %esp,%ebp
+  801b6a:	56                   	push   %esi
+  801b6b:	53                   	push   %ebx
+  801b6c:	83 ec 18             	sub    $0x18,%esp
+  801b6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b72:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b75:	50                   	push   %eax
+  801b76:	53                   	push   %ebx
+  801b77:	e8 65 fd ff ff       	call   8018e1 <fd_lookup>
+  801b7c:	83 c4 10             	add    $0x10,%esp
+  801b7f:	85 c0                	test   %eax,%eax
+  801b81:	78 3c                	js     801bbf <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b83:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b86:	83 ec 08             	sub    $0x8,%esp
+  801b89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b8c:	50                   	push   %eax
+  801b8d:	ff 36                	push   (%esi)
+  801b8f:	e8 9d fd ff ff       	call   801931 <dev_lookup>
+  801b94:	83 c4 10             	add    $0x10,%esp
+  801b97:	85 c0                	test   %eax,%eax
+  801b99:	78 24                	js     801bbf <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b9b:	8b 46 08             	mov    0x8(%esi),%eax
+  801b9e:	83 e0 03             	and    $0x3,%eax
+  801ba1:	83 f8 01             	cmp    $0x1,%eax
+  801ba4:	74 20                	je     801bc6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ba6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ba9:	8b 40 08             	mov    0x8(%eax),%eax
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	74 57                	je     801c07 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bb0:	83 ec 04             	sub    $0x4,%esp
+  801bb3:	ff 75 10             	push   0x10(%ebp)
+  801bb6:	ff 75 0c             	push   0xc(%ebp)
+  801bb9:	56                   	push   %esi
+  801bba:	ff d0                	call   *%eax
+  801bbc:	83 c4 10             	add    $0x10,%esp
+}
+  801bbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bc2:	5b                   	pop    %ebx
+  801bc3:	5e                   	pop    %esi
+  801bc4:	5d                   	pop    %ebp
+  801bc5:	c3                   	ret
+  801bc6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bc8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bcd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bd3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bd8:	76 1c                	jbe    801bf6 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bda:	8b 42 48             	mov    0x48(%edx),%eax
+  801bdd:	83 ec 04             	sub    $0x4,%esp
+  801be0:	53                   	push   %ebx
+  801be1:	50                   	push   %eax
+  801be2:	68 4d 30 80 00       	push   $0x80304d
+  801be7:	e8 33 e6 ff ff       	call   80021f <cprintf>
+		return -E_INVAL;
+  801bec:	83 c4 10             	add    $0x10,%esp
+  801bef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bf4:	eb c9                	jmp    801bbf <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801bf6:	c1 e8 10             	shr    $0x10,%eax
+  801bf9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801bff:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c05:	eb d3                	jmp    801bda <read+0x73>
+		return -E_NOT_SUPP;
+  801c07:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c0c:	eb b1                	jmp    801bbf <read+0x58>
+
+00801c0e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	57                   	push   %edi
+  801c12:	56                   	push   %esi
+  801c13:	53                   	push   %ebx
+  801c14:	83 ec 0c             	sub    $0xc,%esp
+  801c17:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c1a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c22:	eb 02                	jmp    801c26 <readn+0x18>
+  801c24:	01 c3                	add    %eax,%ebx
+  801c26:	39 f3                	cmp    %esi,%ebx
+  801c28:	73 21                	jae    801c4b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c2a:	83 ec 04             	sub    $0x4,%esp
+  801c2d:	89 f0                	mov    %esi,%eax
+  801c2f:	29 d8                	sub    %ebx,%eax
+  801c31:	50                   	push   %eax
+  801c32:	89 d8                	mov    %ebx,%eax
+  801c34:	03 45 0c             	add    0xc(%ebp),%eax
+  801c37:	50                   	push   %eax
+  801c38:	57                   	push   %edi
+  801c39:	e8 29 ff ff ff       	call   801b67 <read>
+		if (m < 0)
+  801c3e:	83 c4 10             	add    $0x10,%esp
+  801c41:	85 c0                	test   %eax,%eax
+  801c43:	78 04                	js     801c49 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c45:	75 dd                	jne    801c24 <readn+0x16>
+  801c47:	eb 02                	jmp    801c4b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c49:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c4b:	89 d8                	mov    %ebx,%eax
+  801c4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c50:	5b                   	pop    %ebx
+  801c51:	5e                   	pop    %esi
+  801c52:	5f                   	pop    %edi
+  801c53:	5d                   	pop    %ebp
+  801c54:	c3                   	ret
+
+00801c55 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c55:	55                   	push   %ebp
+  801c56:	89 e5                	mov    %esp,%ebp
+  801c58:	56                   	push   %esi
+  801c59:	53                   	push   %ebx
+  801c5a:	83 ec 18             	sub    $0x18,%esp
+  801c5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c60:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c63:	50                   	push   %eax
+  801c64:	53                   	push   %ebx
+  801c65:	e8 77 fc ff ff       	call   8018e1 <fd_lookup>
+  801c6a:	83 c4 10             	add    $0x10,%esp
+  801c6d:	85 c0                	test   %eax,%eax
+  801c6f:	78 37                	js     801ca8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c71:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c74:	83 ec 08             	sub    $0x8,%esp
+  801c77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c7a:	50                   	push   %eax
+  801c7b:	ff 36                	push   (%esi)
+  801c7d:	e8 af fc ff ff       	call   801931 <dev_lookup>
+  801c82:	83 c4 10             	add    $0x10,%esp
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	78 1f                	js     801ca8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c89:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c8d:	74 20                	je     801caf <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c92:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	74 57                	je     801cf0 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c99:	83 ec 04             	sub    $0x4,%esp
+  801c9c:	ff 75 10             	push   0x10(%ebp)
+  801c9f:	ff 75 0c             	push   0xc(%ebp)
+  801ca2:	56                   	push   %esi
+  801ca3:	ff d0                	call   *%eax
+  801ca5:	83 c4 10             	add    $0x10,%esp
+}
+  801ca8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cab:	5b                   	pop    %ebx
+  801cac:	5e                   	pop    %esi
+  801cad:	5d                   	pop    %ebp
+  801cae:	c3                   	ret
+  801caf:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cb1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cb6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cbc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cc1:	76 1c                	jbe    801cdf <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cc3:	8b 42 48             	mov    0x48(%edx),%eax
+  801cc6:	83 ec 04             	sub    $0x4,%esp
+  801cc9:	53                   	push   %ebx
+  801cca:	50                   	push   %eax
+  801ccb:	68 69 30 80 00       	push   $0x803069
+  801cd0:	e8 4a e5 ff ff       	call   80021f <cprintf>
+		return -E_INVAL;
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cdd:	eb c9                	jmp    801ca8 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cdf:	c1 e8 10             	shr    $0x10,%eax
+  801ce2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ce8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cee:	eb d3                	jmp    801cc3 <write+0x6e>
+		return -E_NOT_SUPP;
+  801cf0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cf5:	eb b1                	jmp    801ca8 <write+0x53>
+
+00801cf7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cf7:	55                   	push   %ebp
+  801cf8:	89 e5                	mov    %esp,%ebp
+  801cfa:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cfd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d00:	50                   	push   %eax
+  801d01:	ff 75 08             	push   0x8(%ebp)
+  801d04:	e8 d8 fb ff ff       	call   8018e1 <fd_lookup>
+  801d09:	83 c4 10             	add    $0x10,%esp
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	78 0e                	js     801d1e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d10:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d16:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d1e:	c9                   	leave
+  801d1f:	c3                   	ret
+
+00801d20 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d20:	55                   	push   %ebp
+  801d21:	89 e5                	mov    %esp,%ebp
+  801d23:	56                   	push   %esi
+  801d24:	53                   	push   %ebx
+  801d25:	83 ec 18             	sub    $0x18,%esp
+  801d28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d2b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d2e:	50                   	push   %eax
+  801d2f:	53                   	push   %ebx
+  801d30:	e8 ac fb ff ff       	call   8018e1 <fd_lookup>
+  801d35:	83 c4 10             	add    $0x10,%esp
+  801d38:	85 c0                	test   %eax,%eax
+  801d3a:	78 34                	js     801d70 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d3c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d3f:	83 ec 08             	sub    $0x8,%esp
+  801d42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d45:	50                   	push   %eax
+  801d46:	ff 36                	push   (%esi)
+  801d48:	e8 e4 fb ff ff       	call   801931 <dev_lookup>
+  801d4d:	83 c4 10             	add    $0x10,%esp
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	78 1c                	js     801d70 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d54:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d58:	74 1d                	je     801d77 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5d:	8b 40 18             	mov    0x18(%eax),%eax
+  801d60:	85 c0                	test   %eax,%eax
+  801d62:	74 54                	je     801db8 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d64:	83 ec 08             	sub    $0x8,%esp
+  801d67:	ff 75 0c             	push   0xc(%ebp)
+  801d6a:	56                   	push   %esi
+  801d6b:	ff d0                	call   *%eax
+  801d6d:	83 c4 10             	add    $0x10,%esp
+}
+  801d70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d73:	5b                   	pop    %ebx
+  801d74:	5e                   	pop    %esi
+  801d75:	5d                   	pop    %ebp
+  801d76:	c3                   	ret
+  801d77:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d79:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d7e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d84:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d89:	76 1c                	jbe    801da7 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801d8b:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d8e:	83 ec 04             	sub    $0x4,%esp
+  801d91:	53                   	push   %ebx
+  801d92:	50                   	push   %eax
+  801d93:	68 2c 30 80 00       	push   $0x80302c
+  801d98:	e8 82 e4 ff ff       	call   80021f <cprintf>
+		return -E_INVAL;
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801da5:	eb c9                	jmp    801d70 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801da7:	c1 e8 10             	shr    $0x10,%eax
+  801daa:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801db0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801db6:	eb d3                	jmp    801d8b <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801db8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dbd:	eb b1                	jmp    801d70 <ftruncate+0x50>
+
+00801dbf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+  801dc2:	56                   	push   %esi
+  801dc3:	53                   	push   %ebx
+  801dc4:	83 ec 18             	sub    $0x18,%esp
+  801dc7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dcd:	50                   	push   %eax
+  801dce:	ff 75 08             	push   0x8(%ebp)
+  801dd1:	e8 0b fb ff ff       	call   8018e1 <fd_lookup>
+  801dd6:	83 c4 10             	add    $0x10,%esp
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 49                	js     801e26 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ddd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801de0:	83 ec 08             	sub    $0x8,%esp
+  801de3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801de6:	50                   	push   %eax
+  801de7:	ff 36                	push   (%esi)
+  801de9:	e8 43 fb ff ff       	call   801931 <dev_lookup>
+  801dee:	83 c4 10             	add    $0x10,%esp
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	78 31                	js     801e26 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801df5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dfc:	74 2f                	je     801e2d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801dfe:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e01:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e08:	00 00 00 
+	stat->st_isdir = 0;
+  801e0b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e12:	00 00 00 
+	stat->st_dev = dev;
+  801e15:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e1b:	83 ec 08             	sub    $0x8,%esp
+  801e1e:	53                   	push   %ebx
+  801e1f:	56                   	push   %esi
+  801e20:	ff 50 14             	call   *0x14(%eax)
+  801e23:	83 c4 10             	add    $0x10,%esp
+}
+  801e26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e29:	5b                   	pop    %ebx
+  801e2a:	5e                   	pop    %esi
+  801e2b:	5d                   	pop    %ebp
+  801e2c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e2d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e32:	eb f2                	jmp    801e26 <fstat+0x67>
+
+00801e34 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e34:	55                   	push   %ebp
+  801e35:	89 e5                	mov    %esp,%ebp
+  801e37:	56                   	push   %esi
+  801e38:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e39:	83 ec 08             	sub    $0x8,%esp
+  801e3c:	6a 00                	push   $0x0
+  801e3e:	ff 75 08             	push   0x8(%ebp)
+  801e41:	e8 e4 01 00 00       	call   80202a <open>
+  801e46:	89 c3                	mov    %eax,%ebx
+  801e48:	83 c4 10             	add    $0x10,%esp
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	78 1b                	js     801e6a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e4f:	83 ec 08             	sub    $0x8,%esp
+  801e52:	ff 75 0c             	push   0xc(%ebp)
+  801e55:	50                   	push   %eax
+  801e56:	e8 64 ff ff ff       	call   801dbf <fstat>
+  801e5b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e5d:	89 1c 24             	mov    %ebx,(%esp)
+  801e60:	e8 c6 fb ff ff       	call   801a2b <close>
+	return r;
+  801e65:	83 c4 10             	add    $0x10,%esp
+  801e68:	89 f3                	mov    %esi,%ebx
+}
+  801e6a:	89 d8                	mov    %ebx,%eax
+  801e6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6f:	5b                   	pop    %ebx
+  801e70:	5e                   	pop    %esi
+  801e71:	5d                   	pop    %ebp
+  801e72:	c3                   	ret
+
+00801e73 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	56                   	push   %esi
+  801e77:	53                   	push   %ebx
+  801e78:	89 c6                	mov    %eax,%esi
+  801e7a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e7c:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801e83:	74 27                	je     801eac <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e85:	6a 07                	push   $0x7
+  801e87:	68 00 60 80 00       	push   $0x806000
+  801e8c:	56                   	push   %esi
+  801e8d:	ff 35 00 50 80 00    	push   0x805000
+  801e93:	e8 b2 0c 00 00       	call   802b4a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e98:	83 c4 0c             	add    $0xc,%esp
+  801e9b:	6a 00                	push   $0x0
+  801e9d:	53                   	push   %ebx
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	e8 8d 0c 00 00       	call   802b32 <ipc_recv>
+}
+  801ea5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea8:	5b                   	pop    %ebx
+  801ea9:	5e                   	pop    %esi
+  801eaa:	5d                   	pop    %ebp
+  801eab:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801eac:	83 ec 0c             	sub    $0xc,%esp
+  801eaf:	6a 01                	push   $0x1
+  801eb1:	e8 e8 0c 00 00       	call   802b9e <ipc_find_env>
+  801eb6:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ebb:	83 c4 10             	add    $0x10,%esp
+  801ebe:	eb c5                	jmp    801e85 <fsipc+0x12>
+
+00801ec0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ec0:	55                   	push   %ebp
+  801ec1:	89 e5                	mov    %esp,%ebp
+  801ec3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ec6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ecc:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ed1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ed9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ede:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ee3:	e8 8b ff ff ff       	call   801e73 <fsipc>
+}
+  801ee8:	c9                   	leave
+  801ee9:	c3                   	ret
+
+00801eea <devfile_flush>:
+{
+  801eea:	55                   	push   %ebp
+  801eeb:	89 e5                	mov    %esp,%ebp
+  801eed:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ef0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f00:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f05:	e8 69 ff ff ff       	call   801e73 <fsipc>
+}
+  801f0a:	c9                   	leave
+  801f0b:	c3                   	ret
+
+00801f0c <devfile_stat>:
+{
+  801f0c:	55                   	push   %ebp
+  801f0d:	89 e5                	mov    %esp,%ebp
+  801f0f:	53                   	push   %ebx
+  801f10:	83 ec 04             	sub    $0x4,%esp
+  801f13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f19:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f1c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f26:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f2b:	e8 43 ff ff ff       	call   801e73 <fsipc>
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	78 2c                	js     801f60 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f34:	83 ec 08             	sub    $0x8,%esp
+  801f37:	68 00 60 80 00       	push   $0x806000
+  801f3c:	53                   	push   %ebx
+  801f3d:	e8 25 e9 ff ff       	call   800867 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f42:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f47:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f4d:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f52:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f58:	83 c4 10             	add    $0x10,%esp
+  801f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f63:	c9                   	leave
+  801f64:	c3                   	ret
+
+00801f65 <devfile_write>:
+{
+  801f65:	55                   	push   %ebp
+  801f66:	89 e5                	mov    %esp,%ebp
+  801f68:	83 ec 0c             	sub    $0xc,%esp
+  801f6b:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f71:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f74:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801f7a:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801f7f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f84:	39 d0                	cmp    %edx,%eax
+  801f86:	0f 47 c2             	cmova  %edx,%eax
+  801f89:	50                   	push   %eax
+  801f8a:	ff 75 0c             	push   0xc(%ebp)
+  801f8d:	68 08 60 80 00       	push   $0x806008
+  801f92:	e8 56 ea ff ff       	call   8009ed <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fa1:	e8 cd fe ff ff       	call   801e73 <fsipc>
+}
+  801fa6:	c9                   	leave
+  801fa7:	c3                   	ret
+
+00801fa8 <devfile_read>:
+{
+  801fa8:	55                   	push   %ebp
+  801fa9:	89 e5                	mov    %esp,%ebp
+  801fab:	56                   	push   %esi
+  801fac:	53                   	push   %ebx
+  801fad:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fb6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801fbb:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc6:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fcb:	e8 a3 fe ff ff       	call   801e73 <fsipc>
+  801fd0:	89 c3                	mov    %eax,%ebx
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	78 1f                	js     801ff5 <devfile_read+0x4d>
+	assert(r <= n);
+  801fd6:	39 c6                	cmp    %eax,%esi
+  801fd8:	72 24                	jb     801ffe <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801fda:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fdf:	7f 33                	jg     802014 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fe1:	83 ec 04             	sub    $0x4,%esp
+  801fe4:	50                   	push   %eax
+  801fe5:	68 00 60 80 00       	push   $0x806000
+  801fea:	ff 75 0c             	push   0xc(%ebp)
+  801fed:	e8 fb e9 ff ff       	call   8009ed <memmove>
+	return r;
+  801ff2:	83 c4 10             	add    $0x10,%esp
+}
+  801ff5:	89 d8                	mov    %ebx,%eax
+  801ff7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ffa:	5b                   	pop    %ebx
+  801ffb:	5e                   	pop    %esi
+  801ffc:	5d                   	pop    %ebp
+  801ffd:	c3                   	ret
+	assert(r <= n);
+  801ffe:	68 9c 30 80 00       	push   $0x80309c
+  802003:	68 a3 30 80 00       	push   $0x8030a3
+  802008:	6a 76                	push   $0x76
+  80200a:	68 b8 30 80 00       	push   $0x8030b8
+  80200f:	e8 30 e1 ff ff       	call   800144 <_panic>
+	assert(r <= PGSIZE);
+  802014:	68 c3 30 80 00       	push   $0x8030c3
+  802019:	68 a3 30 80 00       	push   $0x8030a3
+  80201e:	6a 77                	push   $0x77
+  802020:	68 b8 30 80 00       	push   $0x8030b8
+  802025:	e8 1a e1 ff ff       	call   800144 <_panic>
+
+0080202a <open>:
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	56                   	push   %esi
+  80202e:	53                   	push   %ebx
+  80202f:	83 ec 1c             	sub    $0x1c,%esp
+  802032:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802035:	56                   	push   %esi
+  802036:	e8 f1 e7 ff ff       	call   80082c <strlen>
+  80203b:	83 c4 10             	add    $0x10,%esp
+  80203e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802043:	7f 6c                	jg     8020b1 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802045:	83 ec 0c             	sub    $0xc,%esp
+  802048:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80204b:	50                   	push   %eax
+  80204c:	e8 3a f8 ff ff       	call   80188b <fd_alloc>
+  802051:	89 c3                	mov    %eax,%ebx
+  802053:	83 c4 10             	add    $0x10,%esp
+  802056:	85 c0                	test   %eax,%eax
+  802058:	78 3c                	js     802096 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80205a:	83 ec 08             	sub    $0x8,%esp
+  80205d:	56                   	push   %esi
+  80205e:	68 00 60 80 00       	push   $0x806000
+  802063:	e8 ff e7 ff ff       	call   800867 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802068:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80206b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802070:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802073:	b8 01 00 00 00       	mov    $0x1,%eax
+  802078:	e8 f6 fd ff ff       	call   801e73 <fsipc>
+  80207d:	89 c3                	mov    %eax,%ebx
+  80207f:	83 c4 10             	add    $0x10,%esp
+  802082:	85 c0                	test   %eax,%eax
+  802084:	78 19                	js     80209f <open+0x75>
+	return fd2num(fd);
+  802086:	83 ec 0c             	sub    $0xc,%esp
+  802089:	ff 75 f4             	push   -0xc(%ebp)
+  80208c:	e8 d3 f7 ff ff       	call   801864 <fd2num>
+  802091:	89 c3                	mov    %eax,%ebx
+  802093:	83 c4 10             	add    $0x10,%esp
+}
+  802096:	89 d8                	mov    %ebx,%eax
+  802098:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80209b:	5b                   	pop    %ebx
+  80209c:	5e                   	pop    %esi
+  80209d:	5d                   	pop    %ebp
+  80209e:	c3                   	ret
+		fd_close(fd, 0);
+  80209f:	83 ec 08             	sub    $0x8,%esp
+  8020a2:	6a 00                	push   $0x0
+  8020a4:	ff 75 f4             	push   -0xc(%ebp)
+  8020a7:	e8 f8 f8 ff ff       	call   8019a4 <fd_close>
+		return r;
+  8020ac:	83 c4 10             	add    $0x10,%esp
+  8020af:	eb e5                	jmp    802096 <open+0x6c>
+		return -E_BAD_PATH;
+  8020b1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020b6:	eb de                	jmp    802096 <open+0x6c>
+
+008020b8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020b8:	55                   	push   %ebp
+  8020b9:	89 e5                	mov    %esp,%ebp
+  8020bb:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020c8:	e8 a6 fd ff ff       	call   801e73 <fsipc>
+}
+  8020cd:	c9                   	leave
+  8020ce:	c3                   	ret
+
+008020cf <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8020d5:	68 cf 30 80 00       	push   $0x8030cf
+  8020da:	ff 75 0c             	push   0xc(%ebp)
+  8020dd:	e8 85 e7 ff ff       	call   800867 <strcpy>
+	return 0;
+}
+  8020e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e7:	c9                   	leave
+  8020e8:	c3                   	ret
+
+008020e9 <devsock_close>:
+{
+  8020e9:	55                   	push   %ebp
+  8020ea:	89 e5                	mov    %esp,%ebp
+  8020ec:	53                   	push   %ebx
+  8020ed:	83 ec 10             	sub    $0x10,%esp
+  8020f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8020f3:	53                   	push   %ebx
+  8020f4:	e8 e4 0a 00 00       	call   802bdd <pageref>
+  8020f9:	89 c2                	mov    %eax,%edx
+  8020fb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020fe:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802103:	83 fa 01             	cmp    $0x1,%edx
+  802106:	74 05                	je     80210d <devsock_close+0x24>
+}
+  802108:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210b:	c9                   	leave
+  80210c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80210d:	83 ec 0c             	sub    $0xc,%esp
+  802110:	ff 73 0c             	push   0xc(%ebx)
+  802113:	e8 b7 02 00 00       	call   8023cf <nsipc_close>
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	eb eb                	jmp    802108 <devsock_close+0x1f>
+
+0080211d <devsock_write>:
+{
+  80211d:	55                   	push   %ebp
+  80211e:	89 e5                	mov    %esp,%ebp
+  802120:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802123:	6a 00                	push   $0x0
+  802125:	ff 75 10             	push   0x10(%ebp)
+  802128:	ff 75 0c             	push   0xc(%ebp)
+  80212b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212e:	ff 70 0c             	push   0xc(%eax)
+  802131:	e8 79 03 00 00       	call   8024af <nsipc_send>
+}
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+
+00802138 <devsock_read>:
+{
+  802138:	55                   	push   %ebp
+  802139:	89 e5                	mov    %esp,%ebp
+  80213b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80213e:	6a 00                	push   $0x0
+  802140:	ff 75 10             	push   0x10(%ebp)
+  802143:	ff 75 0c             	push   0xc(%ebp)
+  802146:	8b 45 08             	mov    0x8(%ebp),%eax
+  802149:	ff 70 0c             	push   0xc(%eax)
+  80214c:	e8 ef 02 00 00       	call   802440 <nsipc_recv>
+}
+  802151:	c9                   	leave
+  802152:	c3                   	ret
+
+00802153 <fd2sockid>:
+{
+  802153:	55                   	push   %ebp
+  802154:	89 e5                	mov    %esp,%ebp
+  802156:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802159:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80215c:	52                   	push   %edx
+  80215d:	50                   	push   %eax
+  80215e:	e8 7e f7 ff ff       	call   8018e1 <fd_lookup>
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	85 c0                	test   %eax,%eax
+  802168:	78 10                	js     80217a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80216a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80216d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802173:	39 08                	cmp    %ecx,(%eax)
+  802175:	75 05                	jne    80217c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802177:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80217a:	c9                   	leave
+  80217b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80217c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802181:	eb f7                	jmp    80217a <fd2sockid+0x27>
+
+00802183 <alloc_sockfd>:
+{
+  802183:	55                   	push   %ebp
+  802184:	89 e5                	mov    %esp,%ebp
+  802186:	56                   	push   %esi
+  802187:	53                   	push   %ebx
+  802188:	83 ec 1c             	sub    $0x1c,%esp
+  80218b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80218d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802190:	50                   	push   %eax
+  802191:	e8 f5 f6 ff ff       	call   80188b <fd_alloc>
+  802196:	89 c3                	mov    %eax,%ebx
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	78 43                	js     8021e2 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80219f:	83 ec 04             	sub    $0x4,%esp
+  8021a2:	68 07 04 00 00       	push   $0x407
+  8021a7:	ff 75 f4             	push   -0xc(%ebp)
+  8021aa:	6a 00                	push   $0x0
+  8021ac:	e8 ae eb ff ff       	call   800d5f <sys_page_alloc>
+  8021b1:	89 c3                	mov    %eax,%ebx
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	85 c0                	test   %eax,%eax
+  8021b8:	78 28                	js     8021e2 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8021ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021bd:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8021c3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8021c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8021cf:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8021d2:	83 ec 0c             	sub    $0xc,%esp
+  8021d5:	50                   	push   %eax
+  8021d6:	e8 89 f6 ff ff       	call   801864 <fd2num>
+  8021db:	89 c3                	mov    %eax,%ebx
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	eb 0c                	jmp    8021ee <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8021e2:	83 ec 0c             	sub    $0xc,%esp
+  8021e5:	56                   	push   %esi
+  8021e6:	e8 e4 01 00 00       	call   8023cf <nsipc_close>
+		return r;
+  8021eb:	83 c4 10             	add    $0x10,%esp
+}
+  8021ee:	89 d8                	mov    %ebx,%eax
+  8021f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f3:	5b                   	pop    %ebx
+  8021f4:	5e                   	pop    %esi
+  8021f5:	5d                   	pop    %ebp
+  8021f6:	c3                   	ret
+
+008021f7 <accept>:
+{
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802200:	e8 4e ff ff ff       	call   802153 <fd2sockid>
+  802205:	85 c0                	test   %eax,%eax
+  802207:	78 1b                	js     802224 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802209:	83 ec 04             	sub    $0x4,%esp
+  80220c:	ff 75 10             	push   0x10(%ebp)
+  80220f:	ff 75 0c             	push   0xc(%ebp)
+  802212:	50                   	push   %eax
+  802213:	e8 0e 01 00 00       	call   802326 <nsipc_accept>
+  802218:	83 c4 10             	add    $0x10,%esp
+  80221b:	85 c0                	test   %eax,%eax
+  80221d:	78 05                	js     802224 <accept+0x2d>
+	return alloc_sockfd(r);
+  80221f:	e8 5f ff ff ff       	call   802183 <alloc_sockfd>
+}
+  802224:	c9                   	leave
+  802225:	c3                   	ret
+
+00802226 <bind>:
+{
+  802226:	55                   	push   %ebp
+  802227:	89 e5                	mov    %esp,%ebp
+  802229:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80222c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222f:	e8 1f ff ff ff       	call   802153 <fd2sockid>
+  802234:	85 c0                	test   %eax,%eax
+  802236:	78 12                	js     80224a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802238:	83 ec 04             	sub    $0x4,%esp
+  80223b:	ff 75 10             	push   0x10(%ebp)
+  80223e:	ff 75 0c             	push   0xc(%ebp)
+  802241:	50                   	push   %eax
+  802242:	e8 31 01 00 00       	call   802378 <nsipc_bind>
+  802247:	83 c4 10             	add    $0x10,%esp
+}
+  80224a:	c9                   	leave
+  80224b:	c3                   	ret
+
+0080224c <shutdown>:
+{
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802252:	8b 45 08             	mov    0x8(%ebp),%eax
+  802255:	e8 f9 fe ff ff       	call   802153 <fd2sockid>
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	78 0f                	js     80226d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80225e:	83 ec 08             	sub    $0x8,%esp
+  802261:	ff 75 0c             	push   0xc(%ebp)
+  802264:	50                   	push   %eax
+  802265:	e8 43 01 00 00       	call   8023ad <nsipc_shutdown>
+  80226a:	83 c4 10             	add    $0x10,%esp
+}
+  80226d:	c9                   	leave
+  80226e:	c3                   	ret
+
+0080226f <connect>:
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802275:	8b 45 08             	mov    0x8(%ebp),%eax
+  802278:	e8 d6 fe ff ff       	call   802153 <fd2sockid>
+  80227d:	85 c0                	test   %eax,%eax
+  80227f:	78 12                	js     802293 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802281:	83 ec 04             	sub    $0x4,%esp
+  802284:	ff 75 10             	push   0x10(%ebp)
+  802287:	ff 75 0c             	push   0xc(%ebp)
+  80228a:	50                   	push   %eax
+  80228b:	e8 59 01 00 00       	call   8023e9 <nsipc_connect>
+  802290:	83 c4 10             	add    $0x10,%esp
+}
+  802293:	c9                   	leave
+  802294:	c3                   	ret
+
+00802295 <listen>:
+{
+  802295:	55                   	push   %ebp
+  802296:	89 e5                	mov    %esp,%ebp
+  802298:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80229b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229e:	e8 b0 fe ff ff       	call   802153 <fd2sockid>
+  8022a3:	85 c0                	test   %eax,%eax
+  8022a5:	78 0f                	js     8022b6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8022a7:	83 ec 08             	sub    $0x8,%esp
+  8022aa:	ff 75 0c             	push   0xc(%ebp)
+  8022ad:	50                   	push   %eax
+  8022ae:	e8 6b 01 00 00       	call   80241e <nsipc_listen>
+  8022b3:	83 c4 10             	add    $0x10,%esp
+}
+  8022b6:	c9                   	leave
+  8022b7:	c3                   	ret
+
+008022b8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8022b8:	55                   	push   %ebp
+  8022b9:	89 e5                	mov    %esp,%ebp
+  8022bb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8022be:	ff 75 10             	push   0x10(%ebp)
+  8022c1:	ff 75 0c             	push   0xc(%ebp)
+  8022c4:	ff 75 08             	push   0x8(%ebp)
+  8022c7:	e8 41 02 00 00       	call   80250d <nsipc_socket>
+  8022cc:	83 c4 10             	add    $0x10,%esp
+  8022cf:	85 c0                	test   %eax,%eax
+  8022d1:	78 05                	js     8022d8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8022d3:	e8 ab fe ff ff       	call   802183 <alloc_sockfd>
+}
+  8022d8:	c9                   	leave
+  8022d9:	c3                   	ret
+
+008022da <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8022da:	55                   	push   %ebp
+  8022db:	89 e5                	mov    %esp,%ebp
+  8022dd:	53                   	push   %ebx
+  8022de:	83 ec 04             	sub    $0x4,%esp
+  8022e1:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8022e3:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8022ea:	74 26                	je     802312 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8022ec:	6a 07                	push   $0x7
+  8022ee:	68 00 70 80 00       	push   $0x807000
+  8022f3:	53                   	push   %ebx
+  8022f4:	ff 35 04 50 80 00    	push   0x805004
+  8022fa:	e8 4b 08 00 00       	call   802b4a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8022ff:	83 c4 0c             	add    $0xc,%esp
+  802302:	6a 00                	push   $0x0
+  802304:	6a 00                	push   $0x0
+  802306:	6a 00                	push   $0x0
+  802308:	e8 25 08 00 00       	call   802b32 <ipc_recv>
+}
+  80230d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802310:	c9                   	leave
+  802311:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802312:	83 ec 0c             	sub    $0xc,%esp
+  802315:	6a 02                	push   $0x2
+  802317:	e8 82 08 00 00       	call   802b9e <ipc_find_env>
+  80231c:	a3 04 50 80 00       	mov    %eax,0x805004
+  802321:	83 c4 10             	add    $0x10,%esp
+  802324:	eb c6                	jmp    8022ec <nsipc+0x12>
+
+00802326 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802326:	55                   	push   %ebp
+  802327:	89 e5                	mov    %esp,%ebp
+  802329:	56                   	push   %esi
+  80232a:	53                   	push   %ebx
+  80232b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80232e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802331:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802336:	8b 06                	mov    (%esi),%eax
+  802338:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80233d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802342:	e8 93 ff ff ff       	call   8022da <nsipc>
+  802347:	89 c3                	mov    %eax,%ebx
+  802349:	85 c0                	test   %eax,%eax
+  80234b:	79 09                	jns    802356 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80234d:	89 d8                	mov    %ebx,%eax
+  80234f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802352:	5b                   	pop    %ebx
+  802353:	5e                   	pop    %esi
+  802354:	5d                   	pop    %ebp
+  802355:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802356:	83 ec 04             	sub    $0x4,%esp
+  802359:	ff 35 10 70 80 00    	push   0x807010
+  80235f:	68 00 70 80 00       	push   $0x807000
+  802364:	ff 75 0c             	push   0xc(%ebp)
+  802367:	e8 81 e6 ff ff       	call   8009ed <memmove>
+		*addrlen = ret->ret_addrlen;
+  80236c:	a1 10 70 80 00       	mov    0x807010,%eax
+  802371:	89 06                	mov    %eax,(%esi)
+  802373:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802376:	eb d5                	jmp    80234d <nsipc_accept+0x27>
+
+00802378 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	53                   	push   %ebx
+  80237c:	83 ec 08             	sub    $0x8,%esp
+  80237f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802382:	8b 45 08             	mov    0x8(%ebp),%eax
+  802385:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80238a:	53                   	push   %ebx
+  80238b:	ff 75 0c             	push   0xc(%ebp)
+  80238e:	68 04 70 80 00       	push   $0x807004
+  802393:	e8 55 e6 ff ff       	call   8009ed <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802398:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80239e:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023a3:	e8 32 ff ff ff       	call   8022da <nsipc>
+}
+  8023a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ab:	c9                   	leave
+  8023ac:	c3                   	ret
+
+008023ad <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8023b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8023bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023be:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8023c3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023c8:	e8 0d ff ff ff       	call   8022da <nsipc>
+}
+  8023cd:	c9                   	leave
+  8023ce:	c3                   	ret
+
+008023cf <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8023cf:	55                   	push   %ebp
+  8023d0:	89 e5                	mov    %esp,%ebp
+  8023d2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8023d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d8:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8023dd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023e2:	e8 f3 fe ff ff       	call   8022da <nsipc>
+}
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+
+008023e9 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8023e9:	55                   	push   %ebp
+  8023ea:	89 e5                	mov    %esp,%ebp
+  8023ec:	53                   	push   %ebx
+  8023ed:	83 ec 08             	sub    $0x8,%esp
+  8023f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8023f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f6:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8023fb:	53                   	push   %ebx
+  8023fc:	ff 75 0c             	push   0xc(%ebp)
+  8023ff:	68 04 70 80 00       	push   $0x807004
+  802404:	e8 e4 e5 ff ff       	call   8009ed <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802409:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80240f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802414:	e8 c1 fe ff ff       	call   8022da <nsipc>
+}
+  802419:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80241c:	c9                   	leave
+  80241d:	c3                   	ret
+
+0080241e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80241e:	55                   	push   %ebp
+  80241f:	89 e5                	mov    %esp,%ebp
+  802421:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802424:	8b 45 08             	mov    0x8(%ebp),%eax
+  802427:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80242c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80242f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802434:	b8 06 00 00 00       	mov    $0x6,%eax
+  802439:	e8 9c fe ff ff       	call   8022da <nsipc>
+}
+  80243e:	c9                   	leave
+  80243f:	c3                   	ret
+
+00802440 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802440:	55                   	push   %ebp
+  802441:	89 e5                	mov    %esp,%ebp
+  802443:	56                   	push   %esi
+  802444:	53                   	push   %ebx
+  802445:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802448:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802450:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802456:	8b 45 14             	mov    0x14(%ebp),%eax
+  802459:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80245e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802463:	e8 72 fe ff ff       	call   8022da <nsipc>
+  802468:	89 c3                	mov    %eax,%ebx
+  80246a:	85 c0                	test   %eax,%eax
+  80246c:	78 22                	js     802490 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80246e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802473:	39 c6                	cmp    %eax,%esi
+  802475:	0f 4e c6             	cmovle %esi,%eax
+  802478:	39 c3                	cmp    %eax,%ebx
+  80247a:	7f 1d                	jg     802499 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80247c:	83 ec 04             	sub    $0x4,%esp
+  80247f:	53                   	push   %ebx
+  802480:	68 00 70 80 00       	push   $0x807000
+  802485:	ff 75 0c             	push   0xc(%ebp)
+  802488:	e8 60 e5 ff ff       	call   8009ed <memmove>
+  80248d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802490:	89 d8                	mov    %ebx,%eax
+  802492:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802495:	5b                   	pop    %ebx
+  802496:	5e                   	pop    %esi
+  802497:	5d                   	pop    %ebp
+  802498:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802499:	68 db 30 80 00       	push   $0x8030db
+  80249e:	68 a3 30 80 00       	push   $0x8030a3
+  8024a3:	6a 62                	push   $0x62
+  8024a5:	68 f0 30 80 00       	push   $0x8030f0
+  8024aa:	e8 95 dc ff ff       	call   800144 <_panic>
+
+008024af <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8024af:	55                   	push   %ebp
+  8024b0:	89 e5                	mov    %esp,%ebp
+  8024b2:	53                   	push   %ebx
+  8024b3:	83 ec 04             	sub    $0x4,%esp
+  8024b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8024b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024bc:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8024c1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8024c7:	7f 2e                	jg     8024f7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8024c9:	83 ec 04             	sub    $0x4,%esp
+  8024cc:	53                   	push   %ebx
+  8024cd:	ff 75 0c             	push   0xc(%ebp)
+  8024d0:	68 0c 70 80 00       	push   $0x80700c
+  8024d5:	e8 13 e5 ff ff       	call   8009ed <memmove>
+	nsipcbuf.send.req_size = size;
+  8024da:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8024e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e3:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8024e8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024ed:	e8 e8 fd ff ff       	call   8022da <nsipc>
+}
+  8024f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f5:	c9                   	leave
+  8024f6:	c3                   	ret
+	assert(size < 1600);
+  8024f7:	68 fc 30 80 00       	push   $0x8030fc
+  8024fc:	68 a3 30 80 00       	push   $0x8030a3
+  802501:	6a 6d                	push   $0x6d
+  802503:	68 f0 30 80 00       	push   $0x8030f0
+  802508:	e8 37 dc ff ff       	call   800144 <_panic>
+
+0080250d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80250d:	55                   	push   %ebp
+  80250e:	89 e5                	mov    %esp,%ebp
+  802510:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802513:	8b 45 08             	mov    0x8(%ebp),%eax
+  802516:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80251b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80251e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802523:	8b 45 10             	mov    0x10(%ebp),%eax
+  802526:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80252b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802530:	e8 a5 fd ff ff       	call   8022da <nsipc>
+}
+  802535:	c9                   	leave
+  802536:	c3                   	ret
+
+00802537 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802537:	55                   	push   %ebp
+  802538:	89 e5                	mov    %esp,%ebp
+  80253a:	56                   	push   %esi
+  80253b:	53                   	push   %ebx
+  80253c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80253f:	83 ec 0c             	sub    $0xc,%esp
+  802542:	ff 75 08             	push   0x8(%ebp)
+  802545:	e8 2a f3 ff ff       	call   801874 <fd2data>
+  80254a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80254c:	83 c4 08             	add    $0x8,%esp
+  80254f:	68 08 31 80 00       	push   $0x803108
+  802554:	53                   	push   %ebx
+  802555:	e8 0d e3 ff ff       	call   800867 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80255a:	8b 46 04             	mov    0x4(%esi),%eax
+  80255d:	2b 06                	sub    (%esi),%eax
+  80255f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802565:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80256c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80256f:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802576:	40 80 00 
+	return 0;
+}
+  802579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802581:	5b                   	pop    %ebx
+  802582:	5e                   	pop    %esi
+  802583:	5d                   	pop    %ebp
+  802584:	c3                   	ret
+
+00802585 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	53                   	push   %ebx
+  802589:	83 ec 0c             	sub    $0xc,%esp
+  80258c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80258f:	53                   	push   %ebx
+  802590:	6a 00                	push   $0x0
+  802592:	e8 a3 e8 ff ff       	call   800e3a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802597:	89 1c 24             	mov    %ebx,(%esp)
+  80259a:	e8 d5 f2 ff ff       	call   801874 <fd2data>
+  80259f:	83 c4 08             	add    $0x8,%esp
+  8025a2:	50                   	push   %eax
+  8025a3:	6a 00                	push   $0x0
+  8025a5:	e8 90 e8 ff ff       	call   800e3a <sys_page_unmap>
+}
+  8025aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ad:	c9                   	leave
+  8025ae:	c3                   	ret
+
+008025af <_pipeisclosed>:
+{
+  8025af:	55                   	push   %ebp
+  8025b0:	89 e5                	mov    %esp,%ebp
+  8025b2:	57                   	push   %edi
+  8025b3:	56                   	push   %esi
+  8025b4:	53                   	push   %ebx
+  8025b5:	83 ec 1c             	sub    $0x1c,%esp
+  8025b8:	89 c7                	mov    %eax,%edi
+  8025ba:	89 d6                	mov    %edx,%esi
+  8025bc:	eb 3c                	jmp    8025fa <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8025be:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8025c1:	83 ec 0c             	sub    $0xc,%esp
+  8025c4:	57                   	push   %edi
+  8025c5:	e8 13 06 00 00       	call   802bdd <pageref>
+  8025ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025cd:	89 34 24             	mov    %esi,(%esp)
+  8025d0:	e8 08 06 00 00       	call   802bdd <pageref>
+  8025d5:	89 c2                	mov    %eax,%edx
+  8025d7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025d9:	05 00 00 00 20       	add    $0x20000000,%eax
+  8025de:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8025e1:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025e7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025ec:	76 31                	jbe    80261f <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8025ee:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8025f1:	39 c3                	cmp    %eax,%ebx
+  8025f3:	74 76                	je     80266b <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8025f5:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025f8:	74 36                	je     802630 <_pipeisclosed+0x81>
+  8025fa:	89 e0                	mov    %esp,%eax
+  8025fc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802601:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802607:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80260c:	77 b0                	ja     8025be <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80260e:	c1 e8 10             	shr    $0x10,%eax
+  802611:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802617:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80261d:	eb 9f                	jmp    8025be <_pipeisclosed+0xf>
+  80261f:	c1 e8 10             	shr    $0x10,%eax
+  802622:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802628:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80262e:	eb be                	jmp    8025ee <_pipeisclosed+0x3f>
+  802630:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802632:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802637:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80263d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802642:	76 16                	jbe    80265a <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802644:	8b 42 58             	mov    0x58(%edx),%eax
+  802647:	6a 01                	push   $0x1
+  802649:	50                   	push   %eax
+  80264a:	53                   	push   %ebx
+  80264b:	68 0f 31 80 00       	push   $0x80310f
+  802650:	e8 ca db ff ff       	call   80021f <cprintf>
+  802655:	83 c4 10             	add    $0x10,%esp
+  802658:	eb a0                	jmp    8025fa <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80265a:	c1 e8 10             	shr    $0x10,%eax
+  80265d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802663:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802669:	eb d9                	jmp    802644 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80266b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80266e:	0f 94 c0             	sete   %al
+  802671:	0f b6 c0             	movzbl %al,%eax
+}
+  802674:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802677:	5b                   	pop    %ebx
+  802678:	5e                   	pop    %esi
+  802679:	5f                   	pop    %edi
+  80267a:	5d                   	pop    %ebp
+  80267b:	c3                   	ret
+
+0080267c <devpipe_write>:
+{
+  80267c:	55                   	push   %ebp
+  80267d:	89 e5                	mov    %esp,%ebp
+  80267f:	57                   	push   %edi
+  802680:	56                   	push   %esi
+  802681:	53                   	push   %ebx
+  802682:	83 ec 28             	sub    $0x28,%esp
+  802685:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802688:	56                   	push   %esi
+  802689:	e8 e6 f1 ff ff       	call   801874 <fd2data>
+  80268e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802690:	83 c4 10             	add    $0x10,%esp
+  802693:	bf 00 00 00 00       	mov    $0x0,%edi
+  802698:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80269b:	75 09                	jne    8026a6 <devpipe_write+0x2a>
+	return i;
+  80269d:	89 f8                	mov    %edi,%eax
+  80269f:	eb 23                	jmp    8026c4 <devpipe_write+0x48>
+			sys_yield();
+  8026a1:	e8 73 e6 ff ff       	call   800d19 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8026a6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026a9:	8b 0b                	mov    (%ebx),%ecx
+  8026ab:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026ae:	39 d0                	cmp    %edx,%eax
+  8026b0:	72 1a                	jb     8026cc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8026b2:	89 da                	mov    %ebx,%edx
+  8026b4:	89 f0                	mov    %esi,%eax
+  8026b6:	e8 f4 fe ff ff       	call   8025af <_pipeisclosed>
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	74 e2                	je     8026a1 <devpipe_write+0x25>
+				return 0;
+  8026bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c7:	5b                   	pop    %ebx
+  8026c8:	5e                   	pop    %esi
+  8026c9:	5f                   	pop    %edi
+  8026ca:	5d                   	pop    %ebp
+  8026cb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026cf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8026d3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8026d6:	89 c2                	mov    %eax,%edx
+  8026d8:	c1 fa 1f             	sar    $0x1f,%edx
+  8026db:	89 d1                	mov    %edx,%ecx
+  8026dd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026e0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026e3:	83 e2 1f             	and    $0x1f,%edx
+  8026e6:	29 ca                	sub    %ecx,%edx
+  8026e8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8026ec:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8026f0:	83 c0 01             	add    $0x1,%eax
+  8026f3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8026f6:	83 c7 01             	add    $0x1,%edi
+  8026f9:	eb 9d                	jmp    802698 <devpipe_write+0x1c>
+
+008026fb <devpipe_read>:
+{
+  8026fb:	55                   	push   %ebp
+  8026fc:	89 e5                	mov    %esp,%ebp
+  8026fe:	57                   	push   %edi
+  8026ff:	56                   	push   %esi
+  802700:	53                   	push   %ebx
+  802701:	83 ec 18             	sub    $0x18,%esp
+  802704:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802707:	57                   	push   %edi
+  802708:	e8 67 f1 ff ff       	call   801874 <fd2data>
+  80270d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80270f:	83 c4 10             	add    $0x10,%esp
+  802712:	be 00 00 00 00       	mov    $0x0,%esi
+  802717:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80271a:	75 13                	jne    80272f <devpipe_read+0x34>
+	return i;
+  80271c:	89 f0                	mov    %esi,%eax
+  80271e:	eb 02                	jmp    802722 <devpipe_read+0x27>
+				return i;
+  802720:	89 f0                	mov    %esi,%eax
+}
+  802722:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802725:	5b                   	pop    %ebx
+  802726:	5e                   	pop    %esi
+  802727:	5f                   	pop    %edi
+  802728:	5d                   	pop    %ebp
+  802729:	c3                   	ret
+			sys_yield();
+  80272a:	e8 ea e5 ff ff       	call   800d19 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80272f:	8b 03                	mov    (%ebx),%eax
+  802731:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802734:	75 18                	jne    80274e <devpipe_read+0x53>
+			if (i > 0)
+  802736:	85 f6                	test   %esi,%esi
+  802738:	75 e6                	jne    802720 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80273a:	89 da                	mov    %ebx,%edx
+  80273c:	89 f8                	mov    %edi,%eax
+  80273e:	e8 6c fe ff ff       	call   8025af <_pipeisclosed>
+  802743:	85 c0                	test   %eax,%eax
+  802745:	74 e3                	je     80272a <devpipe_read+0x2f>
+				return 0;
+  802747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80274c:	eb d4                	jmp    802722 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80274e:	99                   	cltd
+  80274f:	c1 ea 1b             	shr    $0x1b,%edx
+  802752:	01 d0                	add    %edx,%eax
+  802754:	83 e0 1f             	and    $0x1f,%eax
+  802757:	29 d0                	sub    %edx,%eax
+  802759:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80275e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802761:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802764:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802767:	83 c6 01             	add    $0x1,%esi
+  80276a:	eb ab                	jmp    802717 <devpipe_read+0x1c>
+
+0080276c <pipe>:
+{
+  80276c:	55                   	push   %ebp
+  80276d:	89 e5                	mov    %esp,%ebp
+  80276f:	56                   	push   %esi
+  802770:	53                   	push   %ebx
+  802771:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802774:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802777:	50                   	push   %eax
+  802778:	e8 0e f1 ff ff       	call   80188b <fd_alloc>
+  80277d:	89 c3                	mov    %eax,%ebx
+  80277f:	83 c4 10             	add    $0x10,%esp
+  802782:	85 c0                	test   %eax,%eax
+  802784:	0f 88 23 01 00 00    	js     8028ad <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80278a:	83 ec 04             	sub    $0x4,%esp
+  80278d:	68 07 04 00 00       	push   $0x407
+  802792:	ff 75 f4             	push   -0xc(%ebp)
+  802795:	6a 00                	push   $0x0
+  802797:	e8 c3 e5 ff ff       	call   800d5f <sys_page_alloc>
+  80279c:	89 c3                	mov    %eax,%ebx
+  80279e:	83 c4 10             	add    $0x10,%esp
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	0f 88 04 01 00 00    	js     8028ad <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8027a9:	83 ec 0c             	sub    $0xc,%esp
+  8027ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027af:	50                   	push   %eax
+  8027b0:	e8 d6 f0 ff ff       	call   80188b <fd_alloc>
+  8027b5:	89 c3                	mov    %eax,%ebx
+  8027b7:	83 c4 10             	add    $0x10,%esp
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	0f 88 db 00 00 00    	js     80289d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027c2:	83 ec 04             	sub    $0x4,%esp
+  8027c5:	68 07 04 00 00       	push   $0x407
+  8027ca:	ff 75 f0             	push   -0x10(%ebp)
+  8027cd:	6a 00                	push   $0x0
+  8027cf:	e8 8b e5 ff ff       	call   800d5f <sys_page_alloc>
+  8027d4:	89 c3                	mov    %eax,%ebx
+  8027d6:	83 c4 10             	add    $0x10,%esp
+  8027d9:	85 c0                	test   %eax,%eax
+  8027db:	0f 88 bc 00 00 00    	js     80289d <pipe+0x131>
+	va = fd2data(fd0);
+  8027e1:	83 ec 0c             	sub    $0xc,%esp
+  8027e4:	ff 75 f4             	push   -0xc(%ebp)
+  8027e7:	e8 88 f0 ff ff       	call   801874 <fd2data>
+  8027ec:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027ee:	83 c4 0c             	add    $0xc,%esp
+  8027f1:	68 07 04 00 00       	push   $0x407
+  8027f6:	50                   	push   %eax
+  8027f7:	6a 00                	push   $0x0
+  8027f9:	e8 61 e5 ff ff       	call   800d5f <sys_page_alloc>
+  8027fe:	89 c3                	mov    %eax,%ebx
+  802800:	83 c4 10             	add    $0x10,%esp
+  802803:	85 c0                	test   %eax,%eax
+  802805:	0f 88 82 00 00 00    	js     80288d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80280b:	83 ec 0c             	sub    $0xc,%esp
+  80280e:	ff 75 f0             	push   -0x10(%ebp)
+  802811:	e8 5e f0 ff ff       	call   801874 <fd2data>
+  802816:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80281d:	50                   	push   %eax
+  80281e:	6a 00                	push   $0x0
+  802820:	56                   	push   %esi
+  802821:	6a 00                	push   $0x0
+  802823:	e8 a4 e5 ff ff       	call   800dcc <sys_page_map>
+  802828:	89 c3                	mov    %eax,%ebx
+  80282a:	83 c4 20             	add    $0x20,%esp
+  80282d:	85 c0                	test   %eax,%eax
+  80282f:	78 4e                	js     80287f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802831:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802836:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802839:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80283b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80283e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802845:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802848:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80284a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80284d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802854:	83 ec 0c             	sub    $0xc,%esp
+  802857:	ff 75 f4             	push   -0xc(%ebp)
+  80285a:	e8 05 f0 ff ff       	call   801864 <fd2num>
+  80285f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802862:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802864:	83 c4 04             	add    $0x4,%esp
+  802867:	ff 75 f0             	push   -0x10(%ebp)
+  80286a:	e8 f5 ef ff ff       	call   801864 <fd2num>
+  80286f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802872:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802875:	83 c4 10             	add    $0x10,%esp
+  802878:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80287d:	eb 2e                	jmp    8028ad <pipe+0x141>
+	sys_page_unmap(0, va);
+  80287f:	83 ec 08             	sub    $0x8,%esp
+  802882:	56                   	push   %esi
+  802883:	6a 00                	push   $0x0
+  802885:	e8 b0 e5 ff ff       	call   800e3a <sys_page_unmap>
+  80288a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80288d:	83 ec 08             	sub    $0x8,%esp
+  802890:	ff 75 f0             	push   -0x10(%ebp)
+  802893:	6a 00                	push   $0x0
+  802895:	e8 a0 e5 ff ff       	call   800e3a <sys_page_unmap>
+  80289a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80289d:	83 ec 08             	sub    $0x8,%esp
+  8028a0:	ff 75 f4             	push   -0xc(%ebp)
+  8028a3:	6a 00                	push   $0x0
+  8028a5:	e8 90 e5 ff ff       	call   800e3a <sys_page_unmap>
+  8028aa:	83 c4 10             	add    $0x10,%esp
+}
+  8028ad:	89 d8                	mov    %ebx,%eax
+  8028af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028b2:	5b                   	pop    %ebx
+  8028b3:	5e                   	pop    %esi
+  8028b4:	5d                   	pop    %ebp
+  8028b5:	c3                   	ret
+
+008028b6 <pipeisclosed>:
+{
+  8028b6:	55                   	push   %ebp
+  8028b7:	89 e5                	mov    %esp,%ebp
+  8028b9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028bf:	50                   	push   %eax
+  8028c0:	ff 75 08             	push   0x8(%ebp)
+  8028c3:	e8 19 f0 ff ff       	call   8018e1 <fd_lookup>
+  8028c8:	83 c4 10             	add    $0x10,%esp
+  8028cb:	85 c0                	test   %eax,%eax
+  8028cd:	78 18                	js     8028e7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8028cf:	83 ec 0c             	sub    $0xc,%esp
+  8028d2:	ff 75 f4             	push   -0xc(%ebp)
+  8028d5:	e8 9a ef ff ff       	call   801874 <fd2data>
+  8028da:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8028dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028df:	e8 cb fc ff ff       	call   8025af <_pipeisclosed>
+  8028e4:	83 c4 10             	add    $0x10,%esp
+}
+  8028e7:	c9                   	leave
+  8028e8:	c3                   	ret
+
+008028e9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8028e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ee:	c3                   	ret
+
+008028ef <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028ef:	55                   	push   %ebp
+  8028f0:	89 e5                	mov    %esp,%ebp
+  8028f2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8028f5:	68 27 31 80 00       	push   $0x803127
+  8028fa:	ff 75 0c             	push   0xc(%ebp)
+  8028fd:	e8 65 df ff ff       	call   800867 <strcpy>
+	return 0;
+}
+  802902:	b8 00 00 00 00       	mov    $0x0,%eax
+  802907:	c9                   	leave
+  802908:	c3                   	ret
+
+00802909 <devcons_write>:
+{
+  802909:	55                   	push   %ebp
+  80290a:	89 e5                	mov    %esp,%ebp
+  80290c:	57                   	push   %edi
+  80290d:	56                   	push   %esi
+  80290e:	53                   	push   %ebx
+  80290f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802915:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80291a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802920:	eb 2e                	jmp    802950 <devcons_write+0x47>
+		m = n - tot;
+  802922:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802925:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802927:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80292c:	39 c3                	cmp    %eax,%ebx
+  80292e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802931:	83 ec 04             	sub    $0x4,%esp
+  802934:	53                   	push   %ebx
+  802935:	89 f0                	mov    %esi,%eax
+  802937:	03 45 0c             	add    0xc(%ebp),%eax
+  80293a:	50                   	push   %eax
+  80293b:	57                   	push   %edi
+  80293c:	e8 ac e0 ff ff       	call   8009ed <memmove>
+		sys_cputs(buf, m);
+  802941:	83 c4 08             	add    $0x8,%esp
+  802944:	53                   	push   %ebx
+  802945:	57                   	push   %edi
+  802946:	e8 95 e2 ff ff       	call   800be0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80294b:	01 de                	add    %ebx,%esi
+  80294d:	83 c4 10             	add    $0x10,%esp
+  802950:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802953:	72 cd                	jb     802922 <devcons_write+0x19>
+}
+  802955:	89 f0                	mov    %esi,%eax
+  802957:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80295a:	5b                   	pop    %ebx
+  80295b:	5e                   	pop    %esi
+  80295c:	5f                   	pop    %edi
+  80295d:	5d                   	pop    %ebp
+  80295e:	c3                   	ret
+
+0080295f <devcons_read>:
+{
+  80295f:	55                   	push   %ebp
+  802960:	89 e5                	mov    %esp,%ebp
+  802962:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80296e:	75 07                	jne    802977 <devcons_read+0x18>
+  802970:	eb 1f                	jmp    802991 <devcons_read+0x32>
+		sys_yield();
+  802972:	e8 a2 e3 ff ff       	call   800d19 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802977:	e8 a8 e2 ff ff       	call   800c24 <sys_cgetc>
+  80297c:	85 c0                	test   %eax,%eax
+  80297e:	74 f2                	je     802972 <devcons_read+0x13>
+	if (c < 0)
+  802980:	78 0f                	js     802991 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802982:	83 f8 04             	cmp    $0x4,%eax
+  802985:	74 0c                	je     802993 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802987:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80298a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80298c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+		return 0;
+  802993:	b8 00 00 00 00       	mov    $0x0,%eax
+  802998:	eb f7                	jmp    802991 <devcons_read+0x32>
+
+0080299a <cputchar>:
+{
+  80299a:	55                   	push   %ebp
+  80299b:	89 e5                	mov    %esp,%ebp
+  80299d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8029a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8029a6:	6a 01                	push   $0x1
+  8029a8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029ab:	50                   	push   %eax
+  8029ac:	e8 2f e2 ff ff       	call   800be0 <sys_cputs>
+}
+  8029b1:	83 c4 10             	add    $0x10,%esp
+  8029b4:	c9                   	leave
+  8029b5:	c3                   	ret
+
+008029b6 <getchar>:
+{
+  8029b6:	55                   	push   %ebp
+  8029b7:	89 e5                	mov    %esp,%ebp
+  8029b9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8029bc:	6a 01                	push   $0x1
+  8029be:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029c1:	50                   	push   %eax
+  8029c2:	6a 00                	push   $0x0
+  8029c4:	e8 9e f1 ff ff       	call   801b67 <read>
+	if (r < 0)
+  8029c9:	83 c4 10             	add    $0x10,%esp
+  8029cc:	85 c0                	test   %eax,%eax
+  8029ce:	78 06                	js     8029d6 <getchar+0x20>
+	if (r < 1)
+  8029d0:	74 06                	je     8029d8 <getchar+0x22>
+	return c;
+  8029d2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029d6:	c9                   	leave
+  8029d7:	c3                   	ret
+		return -E_EOF;
+  8029d8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029dd:	eb f7                	jmp    8029d6 <getchar+0x20>
+
+008029df <iscons>:
+{
+  8029df:	55                   	push   %ebp
+  8029e0:	89 e5                	mov    %esp,%ebp
+  8029e2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029e8:	50                   	push   %eax
+  8029e9:	ff 75 08             	push   0x8(%ebp)
+  8029ec:	e8 f0 ee ff ff       	call   8018e1 <fd_lookup>
+  8029f1:	83 c4 10             	add    $0x10,%esp
+  8029f4:	85 c0                	test   %eax,%eax
+  8029f6:	78 11                	js     802a09 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8029f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029fb:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a01:	39 10                	cmp    %edx,(%eax)
+  802a03:	0f 94 c0             	sete   %al
+  802a06:	0f b6 c0             	movzbl %al,%eax
+}
+  802a09:	c9                   	leave
+  802a0a:	c3                   	ret
+
+00802a0b <opencons>:
+{
+  802a0b:	55                   	push   %ebp
+  802a0c:	89 e5                	mov    %esp,%ebp
+  802a0e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802a11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a14:	50                   	push   %eax
+  802a15:	e8 71 ee ff ff       	call   80188b <fd_alloc>
+  802a1a:	83 c4 10             	add    $0x10,%esp
+  802a1d:	85 c0                	test   %eax,%eax
+  802a1f:	78 3a                	js     802a5b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802a21:	83 ec 04             	sub    $0x4,%esp
+  802a24:	68 07 04 00 00       	push   $0x407
+  802a29:	ff 75 f4             	push   -0xc(%ebp)
+  802a2c:	6a 00                	push   $0x0
+  802a2e:	e8 2c e3 ff ff       	call   800d5f <sys_page_alloc>
+  802a33:	83 c4 10             	add    $0x10,%esp
+  802a36:	85 c0                	test   %eax,%eax
+  802a38:	78 21                	js     802a5b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802a3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a3d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a43:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802a45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a48:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802a4f:	83 ec 0c             	sub    $0xc,%esp
+  802a52:	50                   	push   %eax
+  802a53:	e8 0c ee ff ff       	call   801864 <fd2num>
+  802a58:	83 c4 10             	add    $0x10,%esp
+}
+  802a5b:	c9                   	leave
+  802a5c:	c3                   	ret
+
+00802a5d <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802a5d:	55                   	push   %ebp
+  802a5e:	89 e5                	mov    %esp,%ebp
+  802a60:	56                   	push   %esi
+  802a61:	53                   	push   %ebx
+  802a62:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a6b:	85 c0                	test   %eax,%eax
+  802a6d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a72:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802a75:	83 ec 08             	sub    $0x8,%esp
+  802a78:	ff 75 14             	push   0x14(%ebp)
+  802a7b:	50                   	push   %eax
+  802a7c:	e8 ef e6 ff ff       	call   801170 <sys_ipc_recv_until>
+  802a81:	83 c4 10             	add    $0x10,%esp
+  802a84:	85 c0                	test   %eax,%eax
+  802a86:	78 61                	js     802ae9 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802a88:	85 f6                	test   %esi,%esi
+  802a8a:	74 1c                	je     802aa8 <ipc_recv_until+0x4b>
+  802a8c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a8e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a93:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a99:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a9e:	76 5f                	jbe    802aff <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802aa0:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802aa6:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802aa8:	85 db                	test   %ebx,%ebx
+  802aaa:	74 1c                	je     802ac8 <ipc_recv_until+0x6b>
+  802aac:	89 e0                	mov    %esp,%eax
+  802aae:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ab3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ab9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802abe:	76 50                	jbe    802b10 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802ac0:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802ac6:	89 03                	mov    %eax,(%ebx)
+  802ac8:	89 e0                	mov    %esp,%eax
+  802aca:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802acf:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ad5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ada:	76 45                	jbe    802b21 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802adc:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802ae2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae5:	5b                   	pop    %ebx
+  802ae6:	5e                   	pop    %esi
+  802ae7:	5d                   	pop    %ebp
+  802ae8:	c3                   	ret
+		if (from_env_store)
+  802ae9:	85 f6                	test   %esi,%esi
+  802aeb:	74 06                	je     802af3 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802aed:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802af3:	85 db                	test   %ebx,%ebx
+  802af5:	74 eb                	je     802ae2 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802af7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802afd:	eb e3                	jmp    802ae2 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802aff:	c1 e8 10             	shr    $0x10,%eax
+  802b02:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b08:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b0e:	eb 90                	jmp    802aa0 <ipc_recv_until+0x43>
+  802b10:	c1 e8 10             	shr    $0x10,%eax
+  802b13:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b19:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b1f:	eb 9f                	jmp    802ac0 <ipc_recv_until+0x63>
+  802b21:	c1 e8 10             	shr    $0x10,%eax
+  802b24:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b2a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b30:	eb aa                	jmp    802adc <ipc_recv_until+0x7f>
+
+00802b32 <ipc_recv>:
+{
+  802b32:	55                   	push   %ebp
+  802b33:	89 e5                	mov    %esp,%ebp
+  802b35:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802b38:	6a 00                	push   $0x0
+  802b3a:	ff 75 10             	push   0x10(%ebp)
+  802b3d:	ff 75 0c             	push   0xc(%ebp)
+  802b40:	ff 75 08             	push   0x8(%ebp)
+  802b43:	e8 15 ff ff ff       	call   802a5d <ipc_recv_until>
+}
+  802b48:	c9                   	leave
+  802b49:	c3                   	ret
+
+00802b4a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b4a:	55                   	push   %ebp
+  802b4b:	89 e5                	mov    %esp,%ebp
+  802b4d:	57                   	push   %edi
+  802b4e:	56                   	push   %esi
+  802b4f:	53                   	push   %ebx
+  802b50:	83 ec 0c             	sub    $0xc,%esp
+  802b53:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b56:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b5c:	85 db                	test   %ebx,%ebx
+  802b5e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b63:	0f 44 d8             	cmove  %eax,%ebx
+  802b66:	eb 05                	jmp    802b6d <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802b68:	e8 ac e1 ff ff       	call   800d19 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802b6d:	ff 75 14             	push   0x14(%ebp)
+  802b70:	53                   	push   %ebx
+  802b71:	56                   	push   %esi
+  802b72:	57                   	push   %edi
+  802b73:	e8 44 e5 ff ff       	call   8010bc <sys_ipc_try_send>
+  802b78:	83 c4 10             	add    $0x10,%esp
+  802b7b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b7e:	74 e8                	je     802b68 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	78 08                	js     802b8c <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802b84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b87:	5b                   	pop    %ebx
+  802b88:	5e                   	pop    %esi
+  802b89:	5f                   	pop    %edi
+  802b8a:	5d                   	pop    %ebp
+  802b8b:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802b8c:	50                   	push   %eax
+  802b8d:	68 33 31 80 00       	push   $0x803133
+  802b92:	6a 4f                	push   $0x4f
+  802b94:	68 46 31 80 00       	push   $0x803146
+  802b99:	e8 a6 d5 ff ff       	call   800144 <_panic>
+
+00802b9e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b9e:	55                   	push   %ebp
+  802b9f:	89 e5                	mov    %esp,%ebp
+  802ba1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ba9:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802baf:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802bb5:	8b 52 50             	mov    0x50(%edx),%edx
+  802bb8:	39 ca                	cmp    %ecx,%edx
+  802bba:	74 11                	je     802bcd <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802bbc:	83 c0 01             	add    $0x1,%eax
+  802bbf:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802bc4:	75 e3                	jne    802ba9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802bc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcb:	eb 0e                	jmp    802bdb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802bcd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802bd3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bd8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bdb:	5d                   	pop    %ebp
+  802bdc:	c3                   	ret
+
+00802bdd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bdd:	55                   	push   %ebp
+  802bde:	89 e5                	mov    %esp,%ebp
+  802be0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802be3:	89 c2                	mov    %eax,%edx
+  802be5:	c1 ea 16             	shr    $0x16,%edx
+  802be8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802bef:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bf4:	f6 c1 01             	test   $0x1,%cl
+  802bf7:	74 1a                	je     802c13 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802bf9:	c1 e8 0c             	shr    $0xc,%eax
+  802bfc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802c03:	a8 01                	test   $0x1,%al
+  802c05:	74 0c                	je     802c13 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802c07:	c1 e8 0c             	shr    $0xc,%eax
+  802c0a:	c1 e0 04             	shl    $0x4,%eax
+  802c0d:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802c13:	89 d0                	mov    %edx,%eax
+  802c15:	5d                   	pop    %ebp
+  802c16:	c3                   	ret
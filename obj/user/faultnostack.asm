@@ -0,0 +1,6271 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800039:	68 a9 17 80 00       	push   $0x8017a9
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 0a 0f 00 00       	call   800f4f <sys_env_set_pgfault_upcall>
+	*(int*)0 = 0;
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	57                   	push   %edi
+  800058:	56                   	push   %esi
+  800059:	53                   	push   %ebx
+  80005a:	83 ec 0c             	sub    $0xc,%esp
+  80005d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800060:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800063:	b8 01 00 00 00       	mov    $0x1,%eax
+  800068:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80006a:	c1 ea 0b             	shr    $0xb,%edx
+  80006d:	83 f2 01             	xor    $0x1,%edx
+  800070:	83 e2 01             	and    $0x1,%edx
+  800073:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800079:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800080:	00 00 00 
+	envid = sys_getenvid();
+  800083:	e8 1f 0c 00 00       	call   800ca7 <sys_getenvid>
+  800088:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80008a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80008f:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800095:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80009b:	8b 52 48             	mov    0x48(%edx),%edx
+  80009e:	39 ca                	cmp    %ecx,%edx
+  8000a0:	74 27                	je     8000c9 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8000a2:	83 c0 01             	add    $0x1,%eax
+  8000a5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000aa:	75 e3                	jne    80008f <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000ac:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000b3:	75 24                	jne    8000d9 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000b5:	83 ec 04             	sub    $0x4,%esp
+  8000b8:	68 00 2c 80 00       	push   $0x802c00
+  8000bd:	6a 23                	push   $0x23
+  8000bf:	68 23 2c 80 00       	push   $0x802c23
+  8000c4:	e8 4f 00 00 00       	call   800118 <_panic>
+			mainenv = &envs[i];
+  8000c9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000d4:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000d9:	85 ff                	test   %edi,%edi
+  8000db:	7e 07                	jle    8000e4 <libmain+0x90>
+		binaryname = argv[0];
+  8000dd:	8b 06                	mov    (%esi),%eax
+  8000df:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000e4:	83 ec 08             	sub    $0x8,%esp
+  8000e7:	56                   	push   %esi
+  8000e8:	57                   	push   %edi
+  8000e9:	e8 45 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000ee:	e8 0b 00 00 00       	call   8000fe <exit>
+}
+  8000f3:	83 c4 10             	add    $0x10,%esp
+  8000f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f9:	5b                   	pop    %ebx
+  8000fa:	5e                   	pop    %esi
+  8000fb:	5f                   	pop    %edi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800104:	e8 bc 18 00 00       	call   8019c5 <close_all>
+	sys_env_destroy(0);
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	6a 00                	push   $0x0
+  80010e:	e8 2b 0b 00 00       	call   800c3e <sys_env_destroy>
+}
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	c9                   	leave
+  800117:	c3                   	ret
+
+00800118 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800118:	55                   	push   %ebp
+  800119:	89 e5                	mov    %esp,%ebp
+  80011b:	56                   	push   %esi
+  80011c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80011d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800120:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800126:	e8 7c 0b 00 00       	call   800ca7 <sys_getenvid>
+  80012b:	83 ec 0c             	sub    $0xc,%esp
+  80012e:	ff 75 0c             	push   0xc(%ebp)
+  800131:	ff 75 08             	push   0x8(%ebp)
+  800134:	56                   	push   %esi
+  800135:	50                   	push   %eax
+  800136:	68 3c 2c 80 00       	push   $0x802c3c
+  80013b:	e8 b3 00 00 00       	call   8001f3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800140:	83 c4 18             	add    $0x18,%esp
+  800143:	53                   	push   %ebx
+  800144:	ff 75 10             	push   0x10(%ebp)
+  800147:	e8 56 00 00 00       	call   8001a2 <vcprintf>
+	cprintf("\n");
+  80014c:	c7 04 24 ac 30 80 00 	movl   $0x8030ac,(%esp)
+  800153:	e8 9b 00 00 00       	call   8001f3 <cprintf>
+  800158:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80015b:	cc                   	int3
+	while (1)
+  80015c:	eb fd                	jmp    80015b <_panic+0x43>
+
+0080015e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	53                   	push   %ebx
+  800162:	83 ec 04             	sub    $0x4,%esp
+  800165:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800168:	8b 13                	mov    (%ebx),%edx
+  80016a:	8d 42 01             	lea    0x1(%edx),%eax
+  80016d:	89 03                	mov    %eax,(%ebx)
+  80016f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800172:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800176:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80017b:	74 09                	je     800186 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800186:	83 ec 08             	sub    $0x8,%esp
+  800189:	68 ff 00 00 00       	push   $0xff
+  80018e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800191:	50                   	push   %eax
+  800192:	e8 1d 0a 00 00       	call   800bb4 <sys_cputs>
+		b->idx = 0;
+  800197:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	eb db                	jmp    80017d <putch+0x1f>
+
+008001a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b2:	00 00 00 
+	b.cnt = 0;
+  8001b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001bf:	ff 75 0c             	push   0xc(%ebp)
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001cb:	50                   	push   %eax
+  8001cc:	68 5e 01 80 00       	push   $0x80015e
+  8001d1:	e8 fb 00 00 00       	call   8002d1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d6:	83 c4 08             	add    $0x8,%esp
+  8001d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	e8 c9 09 00 00       	call   800bb4 <sys_cputs>
+
+	return b.cnt;
+}
+  8001eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+008001f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f3:	55                   	push   %ebp
+  8001f4:	89 e5                	mov    %esp,%ebp
+  8001f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001fc:	50                   	push   %eax
+  8001fd:	ff 75 08             	push   0x8(%ebp)
+  800200:	e8 9d ff ff ff       	call   8001a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	57                   	push   %edi
+  80020b:	56                   	push   %esi
+  80020c:	53                   	push   %ebx
+  80020d:	83 ec 1c             	sub    $0x1c,%esp
+  800210:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800213:	89 d6                	mov    %edx,%esi
+  800215:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800218:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80021b:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80021e:	73 0b                	jae    80022b <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800220:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800223:	c1 e7 08             	shl    $0x8,%edi
+  800226:	0b 7d 10             	or     0x10(%ebp),%edi
+  800229:	eb 36                	jmp    800261 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80022b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80022e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800233:	f7 75 08             	divl   0x8(%ebp)
+  800236:	89 c1                	mov    %eax,%ecx
+  800238:	ff 75 14             	push   0x14(%ebp)
+  80023b:	ff 75 10             	push   0x10(%ebp)
+  80023e:	83 eb 01             	sub    $0x1,%ebx
+  800241:	53                   	push   %ebx
+  800242:	ff 75 08             	push   0x8(%ebp)
+  800245:	89 f2                	mov    %esi,%edx
+  800247:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80024a:	e8 b8 ff ff ff       	call   800207 <printnum>
+  80024f:	83 c4 10             	add    $0x10,%esp
+  800252:	eb 14                	jmp    800268 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800254:	83 ec 08             	sub    $0x8,%esp
+  800257:	56                   	push   %esi
+  800258:	57                   	push   %edi
+  800259:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80025c:	ff d0                	call   *%eax
+  80025e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800261:	83 eb 01             	sub    $0x1,%ebx
+  800264:	85 db                	test   %ebx,%ebx
+  800266:	7f ec                	jg     800254 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800268:	83 ec 08             	sub    $0x8,%esp
+  80026b:	56                   	push   %esi
+  80026c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80026f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800274:	f7 75 08             	divl   0x8(%ebp)
+  800277:	0f be 92 5f 2c 80 00 	movsbl 0x802c5f(%edx),%edx
+  80027e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800281:	c1 e0 08             	shl    $0x8,%eax
+  800284:	09 d0                	or     %edx,%eax
+  800286:	50                   	push   %eax
+  800287:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80028a:	ff d0                	call   *%eax
+}
+  80028c:	83 c4 10             	add    $0x10,%esp
+  80028f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800292:	5b                   	pop    %ebx
+  800293:	5e                   	pop    %esi
+  800294:	5f                   	pop    %edi
+  800295:	5d                   	pop    %ebp
+  800296:	c3                   	ret
+
+00800297 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80029d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002a1:	8b 10                	mov    (%eax),%edx
+  8002a3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a6:	73 0a                	jae    8002b2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ab:	89 08                	mov    %ecx,(%eax)
+  8002ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002b0:	88 02                	mov    %al,(%edx)
+}
+  8002b2:	5d                   	pop    %ebp
+  8002b3:	c3                   	ret
+
+008002b4 <printfmt>:
+{
+  8002b4:	55                   	push   %ebp
+  8002b5:	89 e5                	mov    %esp,%ebp
+  8002b7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002ba:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002bd:	50                   	push   %eax
+  8002be:	ff 75 10             	push   0x10(%ebp)
+  8002c1:	ff 75 0c             	push   0xc(%ebp)
+  8002c4:	ff 75 08             	push   0x8(%ebp)
+  8002c7:	e8 05 00 00 00       	call   8002d1 <vprintfmt>
+}
+  8002cc:	83 c4 10             	add    $0x10,%esp
+  8002cf:	c9                   	leave
+  8002d0:	c3                   	ret
+
+008002d1 <vprintfmt>:
+{
+  8002d1:	55                   	push   %ebp
+  8002d2:	89 e5                	mov    %esp,%ebp
+  8002d4:	57                   	push   %edi
+  8002d5:	56                   	push   %esi
+  8002d6:	53                   	push   %ebx
+  8002d7:	83 ec 3c             	sub    $0x3c,%esp
+  8002da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002dd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002e0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002e7:	eb 16                	jmp    8002ff <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002e9:	83 ec 08             	sub    $0x8,%esp
+  8002ec:	ff 75 0c             	push   0xc(%ebp)
+  8002ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002f2:	c1 e2 08             	shl    $0x8,%edx
+  8002f5:	09 d0                	or     %edx,%eax
+  8002f7:	50                   	push   %eax
+  8002f8:	ff d7                	call   *%edi
+  8002fa:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002fd:	89 de                	mov    %ebx,%esi
+  8002ff:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800302:	0f b6 06             	movzbl (%esi),%eax
+  800305:	83 f8 25             	cmp    $0x25,%eax
+  800308:	74 0c                	je     800316 <vprintfmt+0x45>
+			if (ch == '\0')
+  80030a:	85 c0                	test   %eax,%eax
+  80030c:	75 db                	jne    8002e9 <vprintfmt+0x18>
+}
+  80030e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800311:	5b                   	pop    %ebx
+  800312:	5e                   	pop    %esi
+  800313:	5f                   	pop    %edi
+  800314:	5d                   	pop    %ebp
+  800315:	c3                   	ret
+		padc = ' ';
+  800316:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80031a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800321:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800328:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80032f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800334:	8d 73 01             	lea    0x1(%ebx),%esi
+  800337:	0f b6 13             	movzbl (%ebx),%edx
+  80033a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80033d:	3c 55                	cmp    $0x55,%al
+  80033f:	0f 87 2c 04 00 00    	ja     800771 <vprintfmt+0x4a0>
+  800345:	0f b6 c0             	movzbl %al,%eax
+  800348:	ff 24 85 a0 2d 80 00 	jmp    *0x802da0(,%eax,4)
+  80034f:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800351:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800355:	eb dd                	jmp    800334 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800357:	89 f3                	mov    %esi,%ebx
+  800359:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80035d:	eb d5                	jmp    800334 <vprintfmt+0x63>
+  80035f:	0f b6 d2             	movzbl %dl,%edx
+  800362:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800364:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800369:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80036c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800370:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800373:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800376:	83 fe 09             	cmp    $0x9,%esi
+  800379:	0f 87 8a 00 00 00    	ja     800409 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80037f:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800382:	eb e5                	jmp    800369 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800384:	8b 45 14             	mov    0x14(%ebp),%eax
+  800387:	8b 00                	mov    (%eax),%eax
+  800389:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80038f:	8d 40 04             	lea    0x4(%eax),%eax
+  800392:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800395:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800397:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80039b:	79 97                	jns    800334 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80039d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003a0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003a3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003aa:	eb 88                	jmp    800334 <vprintfmt+0x63>
+			if (width < 0)
+  8003ac:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003af:	85 db                	test   %ebx,%ebx
+  8003b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b6:	0f 49 c3             	cmovns %ebx,%eax
+  8003b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003be:	e9 71 ff ff ff       	jmp    800334 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c3:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003c5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003cc:	e9 63 ff ff ff       	jmp    800334 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003d1:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003d4:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003d8:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003df:	3c 67                	cmp    $0x67,%al
+  8003e1:	0f 84 18 ff ff ff    	je     8002ff <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003e7:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003ee:	3c 72                	cmp    $0x72,%al
+  8003f0:	0f 84 09 ff ff ff    	je     8002ff <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003f6:	3c 62                	cmp    $0x62,%al
+  8003f8:	0f 94 c0             	sete   %al
+  8003fb:	0f b6 c0             	movzbl %al,%eax
+  8003fe:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800401:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800404:	e9 f6 fe ff ff       	jmp    8002ff <vprintfmt+0x2e>
+  800409:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80040c:	eb 89                	jmp    800397 <vprintfmt+0xc6>
+			lflag++;
+  80040e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800411:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800413:	e9 1c ff ff ff       	jmp    800334 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800418:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041b:	8d 58 04             	lea    0x4(%eax),%ebx
+  80041e:	83 ec 08             	sub    $0x8,%esp
+  800421:	ff 75 0c             	push   0xc(%ebp)
+  800424:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800427:	c1 e0 08             	shl    $0x8,%eax
+  80042a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80042d:	0b 01                	or     (%ecx),%eax
+  80042f:	50                   	push   %eax
+  800430:	ff d7                	call   *%edi
+			break;
+  800432:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800435:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800438:	e9 c2 fe ff ff       	jmp    8002ff <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80043d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800440:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800443:	8b 10                	mov    (%eax),%edx
+  800445:	89 d0                	mov    %edx,%eax
+  800447:	f7 d8                	neg    %eax
+  800449:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80044c:	83 f8 12             	cmp    $0x12,%eax
+  80044f:	7f 25                	jg     800476 <vprintfmt+0x1a5>
+  800451:	8b 14 85 00 2f 80 00 	mov    0x802f00(,%eax,4),%edx
+  800458:	85 d2                	test   %edx,%edx
+  80045a:	74 1a                	je     800476 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80045c:	52                   	push   %edx
+  80045d:	68 41 30 80 00       	push   $0x803041
+  800462:	ff 75 0c             	push   0xc(%ebp)
+  800465:	57                   	push   %edi
+  800466:	e8 49 fe ff ff       	call   8002b4 <printfmt>
+  80046b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800471:	e9 89 fe ff ff       	jmp    8002ff <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800476:	50                   	push   %eax
+  800477:	68 77 2c 80 00       	push   $0x802c77
+  80047c:	ff 75 0c             	push   0xc(%ebp)
+  80047f:	57                   	push   %edi
+  800480:	e8 2f fe ff ff       	call   8002b4 <printfmt>
+  800485:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800488:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80048b:	e9 6f fe ff ff       	jmp    8002ff <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800490:	8b 45 14             	mov    0x14(%ebp),%eax
+  800493:	83 c0 04             	add    $0x4,%eax
+  800496:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800499:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80049e:	85 c9                	test   %ecx,%ecx
+  8004a0:	b8 70 2c 80 00       	mov    $0x802c70,%eax
+  8004a5:	0f 45 c1             	cmovne %ecx,%eax
+  8004a8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004ab:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004af:	7e 06                	jle    8004b7 <vprintfmt+0x1e6>
+  8004b1:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004b5:	75 1a                	jne    8004d1 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004ba:	c1 e0 08             	shl    $0x8,%eax
+  8004bd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004c0:	83 c8 3f             	or     $0x3f,%eax
+  8004c3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004c6:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004c9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004cc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004cf:	eb 6d                	jmp    80053e <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	ff 75 d0             	push   -0x30(%ebp)
+  8004d7:	ff 75 c8             	push   -0x38(%ebp)
+  8004da:	e8 39 03 00 00       	call   800818 <strnlen>
+  8004df:	89 c2                	mov    %eax,%edx
+  8004e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e4:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004e6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004e9:	c1 e1 08             	shl    $0x8,%ecx
+  8004ec:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004f0:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f2:	83 c4 10             	add    $0x10,%esp
+  8004f5:	89 c3                	mov    %eax,%ebx
+  8004f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fa:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004fd:	89 ce                	mov    %ecx,%esi
+  8004ff:	eb 0f                	jmp    800510 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800501:	83 ec 08             	sub    $0x8,%esp
+  800504:	ff 75 0c             	push   0xc(%ebp)
+  800507:	56                   	push   %esi
+  800508:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80050a:	83 eb 01             	sub    $0x1,%ebx
+  80050d:	83 c4 10             	add    $0x10,%esp
+  800510:	85 db                	test   %ebx,%ebx
+  800512:	7f ed                	jg     800501 <vprintfmt+0x230>
+  800514:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800517:	8b 75 10             	mov    0x10(%ebp),%esi
+  80051a:	85 c0                	test   %eax,%eax
+  80051c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800521:	0f 49 d0             	cmovns %eax,%edx
+  800524:	29 d0                	sub    %edx,%eax
+  800526:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800529:	eb 8c                	jmp    8004b7 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80052b:	83 ec 08             	sub    $0x8,%esp
+  80052e:	ff 75 0c             	push   0xc(%ebp)
+  800531:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800534:	09 c2                	or     %eax,%edx
+  800536:	52                   	push   %edx
+  800537:	ff d7                	call   *%edi
+  800539:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80053c:	89 d9                	mov    %ebx,%ecx
+  80053e:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800541:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800545:	0f be d0             	movsbl %al,%edx
+  800548:	85 d2                	test   %edx,%edx
+  80054a:	74 2a                	je     800576 <vprintfmt+0x2a5>
+  80054c:	85 f6                	test   %esi,%esi
+  80054e:	78 05                	js     800555 <vprintfmt+0x284>
+  800550:	83 ee 01             	sub    $0x1,%esi
+  800553:	78 3b                	js     800590 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800555:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800559:	74 d0                	je     80052b <vprintfmt+0x25a>
+  80055b:	0f be c0             	movsbl %al,%eax
+  80055e:	83 e8 20             	sub    $0x20,%eax
+  800561:	83 f8 5e             	cmp    $0x5e,%eax
+  800564:	76 c5                	jbe    80052b <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800566:	83 ec 08             	sub    $0x8,%esp
+  800569:	ff 75 0c             	push   0xc(%ebp)
+  80056c:	ff 75 cc             	push   -0x34(%ebp)
+  80056f:	ff d7                	call   *%edi
+  800571:	83 c4 10             	add    $0x10,%esp
+  800574:	eb c6                	jmp    80053c <vprintfmt+0x26b>
+  800576:	8b 75 10             	mov    0x10(%ebp),%esi
+  800579:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80057c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80057f:	01 c3                	add    %eax,%ebx
+  800581:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800583:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800586:	83 c8 20             	or     $0x20,%eax
+  800589:	89 75 10             	mov    %esi,0x10(%ebp)
+  80058c:	89 c6                	mov    %eax,%esi
+  80058e:	eb 14                	jmp    8005a4 <vprintfmt+0x2d3>
+  800590:	8b 75 10             	mov    0x10(%ebp),%esi
+  800593:	eb e4                	jmp    800579 <vprintfmt+0x2a8>
+  800595:	83 ec 08             	sub    $0x8,%esp
+  800598:	ff 75 0c             	push   0xc(%ebp)
+  80059b:	56                   	push   %esi
+  80059c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80059e:	83 eb 01             	sub    $0x1,%ebx
+  8005a1:	83 c4 10             	add    $0x10,%esp
+  8005a4:	85 db                	test   %ebx,%ebx
+  8005a6:	7f ed                	jg     800595 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005ab:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005ae:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b1:	e9 49 fd ff ff       	jmp    8002ff <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005b6:	83 f9 01             	cmp    $0x1,%ecx
+  8005b9:	7f 1f                	jg     8005da <vprintfmt+0x309>
+	else if (lflag)
+  8005bb:	85 c9                	test   %ecx,%ecx
+  8005bd:	74 69                	je     800628 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8b 00                	mov    (%eax),%eax
+  8005c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c7:	89 c1                	mov    %eax,%ecx
+  8005c9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005cc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d8:	eb 17                	jmp    8005f1 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 50 04             	mov    0x4(%eax),%edx
+  8005e0:	8b 00                	mov    (%eax),%eax
+  8005e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005f1:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005f4:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005fc:	85 db                	test   %ebx,%ebx
+  8005fe:	0f 89 f6 00 00 00    	jns    8006fa <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800604:	83 ec 08             	sub    $0x8,%esp
+  800607:	ff 75 0c             	push   0xc(%ebp)
+  80060a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80060d:	c1 e0 08             	shl    $0x8,%eax
+  800610:	83 c8 2d             	or     $0x2d,%eax
+  800613:	50                   	push   %eax
+  800614:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800616:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800619:	f7 d9                	neg    %ecx
+  80061b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80061e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800623:	e9 d2 00 00 00       	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 00                	mov    (%eax),%eax
+  80062d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800630:	89 c1                	mov    %eax,%ecx
+  800632:	c1 f9 1f             	sar    $0x1f,%ecx
+  800635:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8d 40 04             	lea    0x4(%eax),%eax
+  80063e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800641:	eb ae                	jmp    8005f1 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800643:	83 f9 01             	cmp    $0x1,%ecx
+  800646:	7f 19                	jg     800661 <vprintfmt+0x390>
+	else if (lflag)
+  800648:	85 c9                	test   %ecx,%ecx
+  80064a:	74 2a                	je     800676 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 08                	mov    (%eax),%ecx
+  800651:	8d 40 04             	lea    0x4(%eax),%eax
+  800654:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800657:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80065c:	e9 99 00 00 00       	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 08                	mov    (%eax),%ecx
+  800666:	8d 40 08             	lea    0x8(%eax),%eax
+  800669:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800671:	e9 84 00 00 00       	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8b 08                	mov    (%eax),%ecx
+  80067b:	8d 40 04             	lea    0x4(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800681:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800686:	eb 72                	jmp    8006fa <vprintfmt+0x429>
+	if (lflag >= 2)
+  800688:	83 f9 01             	cmp    $0x1,%ecx
+  80068b:	7f 16                	jg     8006a3 <vprintfmt+0x3d2>
+	else if (lflag)
+  80068d:	85 c9                	test   %ecx,%ecx
+  80068f:	74 24                	je     8006b5 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800691:	8b 45 14             	mov    0x14(%ebp),%eax
+  800694:	8b 08                	mov    (%eax),%ecx
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80069c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8006a1:	eb 57                	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 08                	mov    (%eax),%ecx
+  8006a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ae:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006b3:	eb 45                	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8b 08                	mov    (%eax),%ecx
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c0:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006c5:	eb 33                	jmp    8006fa <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006c7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006ca:	c1 e3 08             	shl    $0x8,%ebx
+  8006cd:	83 ec 08             	sub    $0x8,%esp
+  8006d0:	ff 75 0c             	push   0xc(%ebp)
+  8006d3:	89 d8                	mov    %ebx,%eax
+  8006d5:	83 c8 30             	or     $0x30,%eax
+  8006d8:	50                   	push   %eax
+  8006d9:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006db:	83 c4 08             	add    $0x8,%esp
+  8006de:	ff 75 0c             	push   0xc(%ebp)
+  8006e1:	83 cb 78             	or     $0x78,%ebx
+  8006e4:	53                   	push   %ebx
+  8006e5:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ea:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006ec:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006f5:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006fa:	ff 75 e4             	push   -0x1c(%ebp)
+  8006fd:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800701:	52                   	push   %edx
+  800702:	ff 75 e0             	push   -0x20(%ebp)
+  800705:	50                   	push   %eax
+  800706:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800709:	89 f8                	mov    %edi,%eax
+  80070b:	e8 f7 fa ff ff       	call   800207 <printnum>
+			break;
+  800710:	83 c4 10             	add    $0x10,%esp
+  800713:	e9 e7 fb ff ff       	jmp    8002ff <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800718:	83 f9 01             	cmp    $0x1,%ecx
+  80071b:	7f 16                	jg     800733 <vprintfmt+0x462>
+	else if (lflag)
+  80071d:	85 c9                	test   %ecx,%ecx
+  80071f:	74 24                	je     800745 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 08                	mov    (%eax),%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800731:	eb c7                	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 08                	mov    (%eax),%ecx
+  800738:	8d 40 08             	lea    0x8(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800743:	eb b5                	jmp    8006fa <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 08                	mov    (%eax),%ecx
+  80074a:	8d 40 04             	lea    0x4(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800750:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800755:	eb a3                	jmp    8006fa <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800757:	83 ec 08             	sub    $0x8,%esp
+  80075a:	ff 75 0c             	push   0xc(%ebp)
+  80075d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800760:	c1 e0 08             	shl    $0x8,%eax
+  800763:	83 c8 25             	or     $0x25,%eax
+  800766:	50                   	push   %eax
+  800767:	ff d7                	call   *%edi
+			break;
+  800769:	83 c4 10             	add    $0x10,%esp
+  80076c:	e9 8e fb ff ff       	jmp    8002ff <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800771:	83 ec 08             	sub    $0x8,%esp
+  800774:	ff 75 0c             	push   0xc(%ebp)
+  800777:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80077a:	c1 e0 08             	shl    $0x8,%eax
+  80077d:	83 c8 25             	or     $0x25,%eax
+  800780:	50                   	push   %eax
+  800781:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800783:	83 c4 10             	add    $0x10,%esp
+  800786:	89 de                	mov    %ebx,%esi
+  800788:	eb 03                	jmp    80078d <vprintfmt+0x4bc>
+  80078a:	83 ee 01             	sub    $0x1,%esi
+  80078d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800791:	75 f7                	jne    80078a <vprintfmt+0x4b9>
+  800793:	e9 67 fb ff ff       	jmp    8002ff <vprintfmt+0x2e>
+
+00800798 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800798:	55                   	push   %ebp
+  800799:	89 e5                	mov    %esp,%ebp
+  80079b:	83 ec 18             	sub    $0x18,%esp
+  80079e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007a4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007a7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007ab:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007ae:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007b5:	85 c0                	test   %eax,%eax
+  8007b7:	74 26                	je     8007df <vsnprintf+0x47>
+  8007b9:	85 d2                	test   %edx,%edx
+  8007bb:	7e 22                	jle    8007df <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007bd:	ff 75 14             	push   0x14(%ebp)
+  8007c0:	ff 75 10             	push   0x10(%ebp)
+  8007c3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007c6:	50                   	push   %eax
+  8007c7:	68 97 02 80 00       	push   $0x800297
+  8007cc:	e8 00 fb ff ff       	call   8002d1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007d1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007d4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007da:	83 c4 10             	add    $0x10,%esp
+}
+  8007dd:	c9                   	leave
+  8007de:	c3                   	ret
+		return -E_INVAL;
+  8007df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e4:	eb f7                	jmp    8007dd <vsnprintf+0x45>
+
+008007e6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007ec:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007ef:	50                   	push   %eax
+  8007f0:	ff 75 10             	push   0x10(%ebp)
+  8007f3:	ff 75 0c             	push   0xc(%ebp)
+  8007f6:	ff 75 08             	push   0x8(%ebp)
+  8007f9:	e8 9a ff ff ff       	call   800798 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007fe:	c9                   	leave
+  8007ff:	c3                   	ret
+
+00800800 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080b:	eb 03                	jmp    800810 <strlen+0x10>
+		n++;
+  80080d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800810:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800814:	75 f7                	jne    80080d <strlen+0xd>
+	return n;
+}
+  800816:	5d                   	pop    %ebp
+  800817:	c3                   	ret
+
+00800818 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800818:	55                   	push   %ebp
+  800819:	89 e5                	mov    %esp,%ebp
+  80081b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800821:	b8 00 00 00 00       	mov    $0x0,%eax
+  800826:	eb 03                	jmp    80082b <strnlen+0x13>
+		n++;
+  800828:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80082b:	39 d0                	cmp    %edx,%eax
+  80082d:	74 08                	je     800837 <strnlen+0x1f>
+  80082f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800833:	75 f3                	jne    800828 <strnlen+0x10>
+  800835:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800837:	89 d0                	mov    %edx,%eax
+  800839:	5d                   	pop    %ebp
+  80083a:	c3                   	ret
+
+0080083b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80083b:	55                   	push   %ebp
+  80083c:	89 e5                	mov    %esp,%ebp
+  80083e:	53                   	push   %ebx
+  80083f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800842:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80084e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800851:	83 c0 01             	add    $0x1,%eax
+  800854:	84 d2                	test   %dl,%dl
+  800856:	75 f2                	jne    80084a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800858:	89 c8                	mov    %ecx,%eax
+  80085a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80085d:	c9                   	leave
+  80085e:	c3                   	ret
+
+0080085f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	53                   	push   %ebx
+  800863:	83 ec 10             	sub    $0x10,%esp
+  800866:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800869:	53                   	push   %ebx
+  80086a:	e8 91 ff ff ff       	call   800800 <strlen>
+  80086f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800872:	ff 75 0c             	push   0xc(%ebp)
+  800875:	01 d8                	add    %ebx,%eax
+  800877:	50                   	push   %eax
+  800878:	e8 be ff ff ff       	call   80083b <strcpy>
+	return dst;
+}
+  80087d:	89 d8                	mov    %ebx,%eax
+  80087f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800882:	c9                   	leave
+  800883:	c3                   	ret
+
+00800884 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	56                   	push   %esi
+  800888:	53                   	push   %ebx
+  800889:	8b 75 08             	mov    0x8(%ebp),%esi
+  80088c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80088f:	89 f3                	mov    %esi,%ebx
+  800891:	03 5d 10             	add    0x10(%ebp),%ebx
+  800894:	89 f0                	mov    %esi,%eax
+  800896:	eb 0f                	jmp    8008a7 <strncpy+0x23>
+		*dst++ = *src;
+  800898:	83 c0 01             	add    $0x1,%eax
+  80089b:	0f b6 0a             	movzbl (%edx),%ecx
+  80089e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008a1:	80 f9 01             	cmp    $0x1,%cl
+  8008a4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008a7:	39 d8                	cmp    %ebx,%eax
+  8008a9:	75 ed                	jne    800898 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008ab:	89 f0                	mov    %esi,%eax
+  8008ad:	5b                   	pop    %ebx
+  8008ae:	5e                   	pop    %esi
+  8008af:	5d                   	pop    %ebp
+  8008b0:	c3                   	ret
+
+008008b1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	56                   	push   %esi
+  8008b5:	53                   	push   %ebx
+  8008b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008bc:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008bf:	89 f0                	mov    %esi,%eax
+  8008c1:	85 d2                	test   %edx,%edx
+  8008c3:	74 21                	je     8008e6 <strlcpy+0x35>
+  8008c5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008c9:	89 f2                	mov    %esi,%edx
+  8008cb:	eb 09                	jmp    8008d6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008cd:	83 c1 01             	add    $0x1,%ecx
+  8008d0:	83 c2 01             	add    $0x1,%edx
+  8008d3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008d6:	39 c2                	cmp    %eax,%edx
+  8008d8:	74 09                	je     8008e3 <strlcpy+0x32>
+  8008da:	0f b6 19             	movzbl (%ecx),%ebx
+  8008dd:	84 db                	test   %bl,%bl
+  8008df:	75 ec                	jne    8008cd <strlcpy+0x1c>
+  8008e1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008e3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008e6:	29 f0                	sub    %esi,%eax
+}
+  8008e8:	5b                   	pop    %ebx
+  8008e9:	5e                   	pop    %esi
+  8008ea:	5d                   	pop    %ebp
+  8008eb:	c3                   	ret
+
+008008ec <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008f5:	eb 06                	jmp    8008fd <strcmp+0x11>
+		p++, q++;
+  8008f7:	83 c1 01             	add    $0x1,%ecx
+  8008fa:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008fd:	0f b6 01             	movzbl (%ecx),%eax
+  800900:	84 c0                	test   %al,%al
+  800902:	74 04                	je     800908 <strcmp+0x1c>
+  800904:	3a 02                	cmp    (%edx),%al
+  800906:	74 ef                	je     8008f7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800908:	0f b6 c0             	movzbl %al,%eax
+  80090b:	0f b6 12             	movzbl (%edx),%edx
+  80090e:	29 d0                	sub    %edx,%eax
+}
+  800910:	5d                   	pop    %ebp
+  800911:	c3                   	ret
+
+00800912 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	53                   	push   %ebx
+  800916:	8b 45 08             	mov    0x8(%ebp),%eax
+  800919:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80091c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80091f:	eb 09                	jmp    80092a <strncmp+0x18>
+		n--, p++, q++;
+  800921:	83 ea 01             	sub    $0x1,%edx
+  800924:	83 c0 01             	add    $0x1,%eax
+  800927:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80092a:	85 d2                	test   %edx,%edx
+  80092c:	74 18                	je     800946 <strncmp+0x34>
+  80092e:	0f b6 18             	movzbl (%eax),%ebx
+  800931:	84 db                	test   %bl,%bl
+  800933:	74 04                	je     800939 <strncmp+0x27>
+  800935:	3a 19                	cmp    (%ecx),%bl
+  800937:	74 e8                	je     800921 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800939:	0f b6 00             	movzbl (%eax),%eax
+  80093c:	0f b6 11             	movzbl (%ecx),%edx
+  80093f:	29 d0                	sub    %edx,%eax
+}
+  800941:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800944:	c9                   	leave
+  800945:	c3                   	ret
+		return 0;
+  800946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094b:	eb f4                	jmp    800941 <strncmp+0x2f>
+
+0080094d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80094d:	55                   	push   %ebp
+  80094e:	89 e5                	mov    %esp,%ebp
+  800950:	8b 45 08             	mov    0x8(%ebp),%eax
+  800953:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800957:	eb 03                	jmp    80095c <strchr+0xf>
+  800959:	83 c0 01             	add    $0x1,%eax
+  80095c:	0f b6 10             	movzbl (%eax),%edx
+  80095f:	84 d2                	test   %dl,%dl
+  800961:	74 06                	je     800969 <strchr+0x1c>
+		if (*s == c)
+  800963:	38 ca                	cmp    %cl,%dl
+  800965:	75 f2                	jne    800959 <strchr+0xc>
+  800967:	eb 05                	jmp    80096e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800969:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80096e:	5d                   	pop    %ebp
+  80096f:	c3                   	ret
+
+00800970 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800970:	55                   	push   %ebp
+  800971:	89 e5                	mov    %esp,%ebp
+  800973:	8b 45 08             	mov    0x8(%ebp),%eax
+  800976:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80097a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80097d:	38 ca                	cmp    %cl,%dl
+  80097f:	74 09                	je     80098a <strfind+0x1a>
+  800981:	84 d2                	test   %dl,%dl
+  800983:	74 05                	je     80098a <strfind+0x1a>
+	for (; *s; s++)
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	eb f0                	jmp    80097a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80098a:	5d                   	pop    %ebp
+  80098b:	c3                   	ret
+
+0080098c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80098c:	55                   	push   %ebp
+  80098d:	89 e5                	mov    %esp,%ebp
+  80098f:	57                   	push   %edi
+  800990:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800993:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800996:	85 c9                	test   %ecx,%ecx
+  800998:	74 20                	je     8009ba <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80099a:	89 f8                	mov    %edi,%eax
+  80099c:	09 c8                	or     %ecx,%eax
+  80099e:	a8 03                	test   $0x3,%al
+  8009a0:	75 12                	jne    8009b4 <memset+0x28>
+		c &= 0xFF;
+  8009a2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009a6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009ac:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009af:	fc                   	cld
+  8009b0:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009b2:	eb 06                	jmp    8009ba <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009b7:	fc                   	cld
+  8009b8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009ba:	89 f8                	mov    %edi,%eax
+  8009bc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009bf:	c9                   	leave
+  8009c0:	c3                   	ret
+
+008009c1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	57                   	push   %edi
+  8009c5:	56                   	push   %esi
+  8009c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009cc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009cf:	39 c6                	cmp    %eax,%esi
+  8009d1:	73 32                	jae    800a05 <memmove+0x44>
+  8009d3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009d6:	39 d0                	cmp    %edx,%eax
+  8009d8:	73 2b                	jae    800a05 <memmove+0x44>
+		s += n;
+		d += n;
+  8009da:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009dd:	89 d6                	mov    %edx,%esi
+  8009df:	09 fe                	or     %edi,%esi
+  8009e1:	09 ce                	or     %ecx,%esi
+  8009e3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009e9:	75 0e                	jne    8009f9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009eb:	83 ef 04             	sub    $0x4,%edi
+  8009ee:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009f1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009f4:	fd                   	std
+  8009f5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f7:	eb 09                	jmp    800a02 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009f9:	83 ef 01             	sub    $0x1,%edi
+  8009fc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009ff:	fd                   	std
+  800a00:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a02:	fc                   	cld
+  800a03:	eb 1a                	jmp    800a1f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a05:	89 f2                	mov    %esi,%edx
+  800a07:	09 c2                	or     %eax,%edx
+  800a09:	09 ca                	or     %ecx,%edx
+  800a0b:	f6 c2 03             	test   $0x3,%dl
+  800a0e:	75 0a                	jne    800a1a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a10:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a13:	89 c7                	mov    %eax,%edi
+  800a15:	fc                   	cld
+  800a16:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a18:	eb 05                	jmp    800a1f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a1a:	89 c7                	mov    %eax,%edi
+  800a1c:	fc                   	cld
+  800a1d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a1f:	5e                   	pop    %esi
+  800a20:	5f                   	pop    %edi
+  800a21:	5d                   	pop    %ebp
+  800a22:	c3                   	ret
+
+00800a23 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a29:	ff 75 10             	push   0x10(%ebp)
+  800a2c:	ff 75 0c             	push   0xc(%ebp)
+  800a2f:	ff 75 08             	push   0x8(%ebp)
+  800a32:	e8 8a ff ff ff       	call   8009c1 <memmove>
+}
+  800a37:	c9                   	leave
+  800a38:	c3                   	ret
+
+00800a39 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	56                   	push   %esi
+  800a3d:	53                   	push   %ebx
+  800a3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a41:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a44:	89 c6                	mov    %eax,%esi
+  800a46:	03 75 10             	add    0x10(%ebp),%esi
+  800a49:	eb 06                	jmp    800a51 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a4b:	83 c0 01             	add    $0x1,%eax
+  800a4e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a51:	39 f0                	cmp    %esi,%eax
+  800a53:	74 14                	je     800a69 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a55:	0f b6 08             	movzbl (%eax),%ecx
+  800a58:	0f b6 1a             	movzbl (%edx),%ebx
+  800a5b:	38 d9                	cmp    %bl,%cl
+  800a5d:	74 ec                	je     800a4b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a5f:	0f b6 c1             	movzbl %cl,%eax
+  800a62:	0f b6 db             	movzbl %bl,%ebx
+  800a65:	29 d8                	sub    %ebx,%eax
+  800a67:	eb 05                	jmp    800a6e <memcmp+0x35>
+	}
+
+	return 0;
+  800a69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a6e:	5b                   	pop    %ebx
+  800a6f:	5e                   	pop    %esi
+  800a70:	5d                   	pop    %ebp
+  800a71:	c3                   	ret
+
+00800a72 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a7b:	89 c2                	mov    %eax,%edx
+  800a7d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a80:	eb 03                	jmp    800a85 <memfind+0x13>
+  800a82:	83 c0 01             	add    $0x1,%eax
+  800a85:	39 d0                	cmp    %edx,%eax
+  800a87:	73 04                	jae    800a8d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a89:	38 08                	cmp    %cl,(%eax)
+  800a8b:	75 f5                	jne    800a82 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+
+00800a8f <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	57                   	push   %edi
+  800a93:	56                   	push   %esi
+  800a94:	53                   	push   %ebx
+  800a95:	83 ec 1c             	sub    $0x1c,%esp
+  800a98:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a9b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a9e:	eb 03                	jmp    800aa3 <strtol+0x14>
+		s++;
+  800aa0:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800aa3:	0f b6 06             	movzbl (%esi),%eax
+  800aa6:	3c 20                	cmp    $0x20,%al
+  800aa8:	74 f6                	je     800aa0 <strtol+0x11>
+  800aaa:	3c 09                	cmp    $0x9,%al
+  800aac:	74 f2                	je     800aa0 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aae:	3c 2b                	cmp    $0x2b,%al
+  800ab0:	74 43                	je     800af5 <strtol+0x66>
+	int neg = 0;
+  800ab2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800ab7:	3c 2d                	cmp    $0x2d,%al
+  800ab9:	74 44                	je     800aff <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800abb:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ac1:	75 0f                	jne    800ad2 <strtol+0x43>
+  800ac3:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ac6:	74 41                	je     800b09 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ac8:	85 ff                	test   %edi,%edi
+  800aca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800acf:	0f 44 f8             	cmove  %eax,%edi
+  800ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad7:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800adc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800adf:	89 fb                	mov    %edi,%ebx
+  800ae1:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ae4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ae7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800aea:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800aed:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800af0:	89 75 08             	mov    %esi,0x8(%ebp)
+  800af3:	eb 67                	jmp    800b5c <strtol+0xcd>
+		s++;
+  800af5:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800af8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afd:	eb bc                	jmp    800abb <strtol+0x2c>
+		s++, neg = 1;
+  800aff:	83 c6 01             	add    $0x1,%esi
+  800b02:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b07:	eb b2                	jmp    800abb <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b09:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b0d:	74 0e                	je     800b1d <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b0f:	85 ff                	test   %edi,%edi
+  800b11:	75 bf                	jne    800ad2 <strtol+0x43>
+		s++, base = 8;
+  800b13:	83 c6 01             	add    $0x1,%esi
+  800b16:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b1b:	eb b5                	jmp    800ad2 <strtol+0x43>
+		s += 2, base = 16;
+  800b1d:	83 c6 02             	add    $0x2,%esi
+  800b20:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b25:	eb ab                	jmp    800ad2 <strtol+0x43>
+			dig = *s - '0';
+  800b27:	0f be c9             	movsbl %cl,%ecx
+  800b2a:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b2d:	39 f9                	cmp    %edi,%ecx
+  800b2f:	7d 59                	jge    800b8a <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b31:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b35:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b38:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b3b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b3e:	0f af d8             	imul   %eax,%ebx
+  800b41:	0f af d7             	imul   %edi,%edx
+  800b44:	01 d3                	add    %edx,%ebx
+  800b46:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b49:	f7 e7                	mul    %edi
+  800b4b:	01 da                	add    %ebx,%edx
+  800b4d:	89 cb                	mov    %ecx,%ebx
+  800b4f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b52:	01 c8                	add    %ecx,%eax
+  800b54:	11 da                	adc    %ebx,%edx
+  800b56:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b59:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5f:	0f b6 08             	movzbl (%eax),%ecx
+  800b62:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b65:	80 fb 09             	cmp    $0x9,%bl
+  800b68:	76 bd                	jbe    800b27 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b6a:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b6d:	80 fb 19             	cmp    $0x19,%bl
+  800b70:	77 08                	ja     800b7a <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b72:	0f be c9             	movsbl %cl,%ecx
+  800b75:	83 e9 57             	sub    $0x57,%ecx
+  800b78:	eb b3                	jmp    800b2d <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b7a:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b7d:	80 fb 19             	cmp    $0x19,%bl
+  800b80:	77 08                	ja     800b8a <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b82:	0f be c9             	movsbl %cl,%ecx
+  800b85:	83 e9 37             	sub    $0x37,%ecx
+  800b88:	eb a3                	jmp    800b2d <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b8a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b8d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b90:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b93:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b96:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b9a:	74 05                	je     800ba1 <strtol+0x112>
+		*endptr = (char *) s;
+  800b9c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b9f:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800ba1:	85 c9                	test   %ecx,%ecx
+  800ba3:	74 07                	je     800bac <strtol+0x11d>
+  800ba5:	f7 d8                	neg    %eax
+  800ba7:	83 d2 00             	adc    $0x0,%edx
+  800baa:	f7 da                	neg    %edx
+}
+  800bac:	83 c4 1c             	add    $0x1c,%esp
+  800baf:	5b                   	pop    %ebx
+  800bb0:	5e                   	pop    %esi
+  800bb1:	5f                   	pop    %edi
+  800bb2:	5d                   	pop    %ebp
+  800bb3:	c3                   	ret
+
+00800bb4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bb4:	55                   	push   %ebp
+  800bb5:	89 e5                	mov    %esp,%ebp
+  800bb7:	57                   	push   %edi
+  800bb8:	56                   	push   %esi
+  800bb9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bba:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bc1:	74 18                	je     800bdb <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bce:	89 c3                	mov    %eax,%ebx
+  800bd0:	89 c7                	mov    %eax,%edi
+  800bd2:	89 c6                	mov    %eax,%esi
+  800bd4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bd6:	5b                   	pop    %ebx
+  800bd7:	5e                   	pop    %esi
+  800bd8:	5f                   	pop    %edi
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be6:	89 c3                	mov    %eax,%ebx
+  800be8:	89 c7                	mov    %eax,%edi
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	8d 35 f5 0b 80 00    	lea    0x800bf5,%esi
+  800bf3:	0f 34                	sysenter
+  800bf5:	5d                   	pop    %ebp
+		goto out;
+  800bf6:	eb de                	jmp    800bd6 <sys_cputs+0x22>
+
+00800bf8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	57                   	push   %edi
+  800bfc:	56                   	push   %esi
+  800bfd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bfe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c05:	74 19                	je     800c20 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c11:	89 d1                	mov    %edx,%ecx
+  800c13:	89 d3                	mov    %edx,%ebx
+  800c15:	89 d7                	mov    %edx,%edi
+  800c17:	89 d6                	mov    %edx,%esi
+  800c19:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c1b:	5b                   	pop    %ebx
+  800c1c:	5e                   	pop    %esi
+  800c1d:	5f                   	pop    %edi
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c25:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c2a:	89 d1                	mov    %edx,%ecx
+  800c2c:	89 d3                	mov    %edx,%ebx
+  800c2e:	89 d7                	mov    %edx,%edi
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	8d 35 3b 0c 80 00    	lea    0x800c3b,%esi
+  800c39:	0f 34                	sysenter
+  800c3b:	5d                   	pop    %ebp
+		goto out;
+  800c3c:	eb dd                	jmp    800c1b <sys_cgetc+0x23>
+
+00800c3e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	57                   	push   %edi
+  800c42:	56                   	push   %esi
+  800c43:	53                   	push   %ebx
+  800c44:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c47:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c4e:	74 21                	je     800c71 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c55:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5d:	89 cb                	mov    %ecx,%ebx
+  800c5f:	89 cf                	mov    %ecx,%edi
+  800c61:	89 ce                	mov    %ecx,%esi
+  800c63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c65:	85 c0                	test   %eax,%eax
+  800c67:	7f 27                	jg     800c90 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6c:	5b                   	pop    %ebx
+  800c6d:	5e                   	pop    %esi
+  800c6e:	5f                   	pop    %edi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c79:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c7e:	89 cb                	mov    %ecx,%ebx
+  800c80:	89 cf                	mov    %ecx,%edi
+  800c82:	55                   	push   %ebp
+  800c83:	89 e5                	mov    %esp,%ebp
+  800c85:	8d 35 8d 0c 80 00    	lea    0x800c8d,%esi
+  800c8b:	0f 34                	sysenter
+  800c8d:	5d                   	pop    %ebp
+		goto out;
+  800c8e:	eb d5                	jmp    800c65 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c90:	83 ec 0c             	sub    $0xc,%esp
+  800c93:	50                   	push   %eax
+  800c94:	6a 03                	push   $0x3
+  800c96:	68 6b 2f 80 00       	push   $0x802f6b
+  800c9b:	6a 3f                	push   $0x3f
+  800c9d:	68 88 2f 80 00       	push   $0x802f88
+  800ca2:	e8 71 f4 ff ff       	call   800118 <_panic>
+
+00800ca7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ca7:	55                   	push   %ebp
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	57                   	push   %edi
+  800cab:	56                   	push   %esi
+  800cac:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cad:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cb4:	74 19                	je     800ccf <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800cb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cc0:	89 d1                	mov    %edx,%ecx
+  800cc2:	89 d3                	mov    %edx,%ebx
+  800cc4:	89 d7                	mov    %edx,%edi
+  800cc6:	89 d6                	mov    %edx,%esi
+  800cc8:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ccf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd9:	89 d1                	mov    %edx,%ecx
+  800cdb:	89 d3                	mov    %edx,%ebx
+  800cdd:	89 d7                	mov    %edx,%edi
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	8d 35 ea 0c 80 00    	lea    0x800cea,%esi
+  800ce8:	0f 34                	sysenter
+  800cea:	5d                   	pop    %ebp
+		goto out;
+  800ceb:	eb dd                	jmp    800cca <sys_getenvid+0x23>
+
+00800ced <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cf3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cfa:	74 19                	je     800d15 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d01:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d06:	89 d1                	mov    %edx,%ecx
+  800d08:	89 d3                	mov    %edx,%ebx
+  800d0a:	89 d7                	mov    %edx,%edi
+  800d0c:	89 d6                	mov    %edx,%esi
+  800d0e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5f                   	pop    %edi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d1f:	89 d1                	mov    %edx,%ecx
+  800d21:	89 d3                	mov    %edx,%ebx
+  800d23:	89 d7                	mov    %edx,%edi
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	8d 35 30 0d 80 00    	lea    0x800d30,%esi
+  800d2e:	0f 34                	sysenter
+  800d30:	5d                   	pop    %ebp
+		goto out;
+  800d31:	eb dd                	jmp    800d10 <sys_yield+0x23>
+
+00800d33 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d33:	55                   	push   %ebp
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	57                   	push   %edi
+  800d37:	56                   	push   %esi
+  800d38:	53                   	push   %ebx
+  800d39:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d3c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d43:	74 23                	je     800d68 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d45:	be 00 00 00 00       	mov    $0x0,%esi
+  800d4a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d58:	89 f7                	mov    %esi,%edi
+  800d5a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d5c:	85 c0                	test   %eax,%eax
+  800d5e:	7f 29                	jg     800d89 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d63:	5b                   	pop    %ebx
+  800d64:	5e                   	pop    %esi
+  800d65:	5f                   	pop    %edi
+  800d66:	5d                   	pop    %ebp
+  800d67:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d78:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	8d 35 86 0d 80 00    	lea    0x800d86,%esi
+  800d84:	0f 34                	sysenter
+  800d86:	5d                   	pop    %ebp
+		goto out;
+  800d87:	eb d3                	jmp    800d5c <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d89:	83 ec 0c             	sub    $0xc,%esp
+  800d8c:	50                   	push   %eax
+  800d8d:	6a 04                	push   $0x4
+  800d8f:	68 6b 2f 80 00       	push   $0x802f6b
+  800d94:	6a 3f                	push   $0x3f
+  800d96:	68 88 2f 80 00       	push   $0x802f88
+  800d9b:	e8 78 f3 ff ff       	call   800118 <_panic>
+
+00800da0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800da0:	55                   	push   %ebp
+  800da1:	89 e5                	mov    %esp,%ebp
+  800da3:	57                   	push   %edi
+  800da4:	56                   	push   %esi
+  800da5:	53                   	push   %ebx
+  800da6:	83 ec 0c             	sub    $0xc,%esp
+  800da9:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800dac:	85 f6                	test   %esi,%esi
+  800dae:	75 09                	jne    800db9 <sys_page_map+0x19>
+  800db0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800db7:	74 1f                	je     800dd8 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800db9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcc:	85 c0                	test   %eax,%eax
+  800dce:	7f 27                	jg     800df7 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd3:	5b                   	pop    %ebx
+  800dd4:	5e                   	pop    %esi
+  800dd5:	5f                   	pop    %edi
+  800dd6:	5d                   	pop    %ebp
+  800dd7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dde:	b8 05 00 00 00       	mov    $0x5,%eax
+  800de3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	8d 35 f4 0d 80 00    	lea    0x800df4,%esi
+  800df2:	0f 34                	sysenter
+  800df4:	5d                   	pop    %ebp
+		goto out;
+  800df5:	eb d5                	jmp    800dcc <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df7:	83 ec 0c             	sub    $0xc,%esp
+  800dfa:	50                   	push   %eax
+  800dfb:	6a 05                	push   $0x5
+  800dfd:	68 6b 2f 80 00       	push   $0x802f6b
+  800e02:	6a 3f                	push   $0x3f
+  800e04:	68 88 2f 80 00       	push   $0x802f88
+  800e09:	e8 0a f3 ff ff       	call   800118 <_panic>
+
+00800e0e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	57                   	push   %edi
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e17:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e1e:	74 22                	je     800e42 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e25:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	89 df                	mov    %ebx,%edi
+  800e32:	89 de                	mov    %ebx,%esi
+  800e34:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e36:	85 c0                	test   %eax,%eax
+  800e38:	7f 28                	jg     800e62 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3d:	5b                   	pop    %ebx
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5f                   	pop    %edi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e52:	89 df                	mov    %ebx,%edi
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	8d 35 5f 0e 80 00    	lea    0x800e5f,%esi
+  800e5d:	0f 34                	sysenter
+  800e5f:	5d                   	pop    %ebp
+		goto out;
+  800e60:	eb d4                	jmp    800e36 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e62:	83 ec 0c             	sub    $0xc,%esp
+  800e65:	50                   	push   %eax
+  800e66:	6a 06                	push   $0x6
+  800e68:	68 6b 2f 80 00       	push   $0x802f6b
+  800e6d:	6a 3f                	push   $0x3f
+  800e6f:	68 88 2f 80 00       	push   $0x802f88
+  800e74:	e8 9f f2 ff ff       	call   800118 <_panic>
+
+00800e79 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e79:	55                   	push   %ebp
+  800e7a:	89 e5                	mov    %esp,%ebp
+  800e7c:	57                   	push   %edi
+  800e7d:	56                   	push   %esi
+  800e7e:	53                   	push   %ebx
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e82:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e89:	74 22                	je     800ead <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e90:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9b:	89 df                	mov    %ebx,%edi
+  800e9d:	89 de                	mov    %ebx,%esi
+  800e9f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea1:	85 c0                	test   %eax,%eax
+  800ea3:	7f 28                	jg     800ecd <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ea5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea8:	5b                   	pop    %ebx
+  800ea9:	5e                   	pop    %esi
+  800eaa:	5f                   	pop    %edi
+  800eab:	5d                   	pop    %ebp
+  800eac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ead:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ebd:	89 df                	mov    %ebx,%edi
+  800ebf:	55                   	push   %ebp
+  800ec0:	89 e5                	mov    %esp,%ebp
+  800ec2:	8d 35 ca 0e 80 00    	lea    0x800eca,%esi
+  800ec8:	0f 34                	sysenter
+  800eca:	5d                   	pop    %ebp
+		goto out;
+  800ecb:	eb d4                	jmp    800ea1 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ecd:	83 ec 0c             	sub    $0xc,%esp
+  800ed0:	50                   	push   %eax
+  800ed1:	6a 08                	push   $0x8
+  800ed3:	68 6b 2f 80 00       	push   $0x802f6b
+  800ed8:	6a 3f                	push   $0x3f
+  800eda:	68 88 2f 80 00       	push   $0x802f88
+  800edf:	e8 34 f2 ff ff       	call   800118 <_panic>
+
+00800ee4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eed:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ef4:	74 22                	je     800f18 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ef6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f06:	89 df                	mov    %ebx,%edi
+  800f08:	89 de                	mov    %ebx,%esi
+  800f0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0c:	85 c0                	test   %eax,%eax
+  800f0e:	7f 28                	jg     800f38 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5f                   	pop    %edi
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f28:	89 df                	mov    %ebx,%edi
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	8d 35 35 0f 80 00    	lea    0x800f35,%esi
+  800f33:	0f 34                	sysenter
+  800f35:	5d                   	pop    %ebp
+		goto out;
+  800f36:	eb d4                	jmp    800f0c <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f38:	83 ec 0c             	sub    $0xc,%esp
+  800f3b:	50                   	push   %eax
+  800f3c:	6a 09                	push   $0x9
+  800f3e:	68 6b 2f 80 00       	push   $0x802f6b
+  800f43:	6a 3f                	push   $0x3f
+  800f45:	68 88 2f 80 00       	push   $0x802f88
+  800f4a:	e8 c9 f1 ff ff       	call   800118 <_panic>
+
+00800f4f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	57                   	push   %edi
+  800f53:	56                   	push   %esi
+  800f54:	53                   	push   %ebx
+  800f55:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f58:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f5f:	74 22                	je     800f83 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f66:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f71:	89 df                	mov    %ebx,%edi
+  800f73:	89 de                	mov    %ebx,%esi
+  800f75:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f77:	85 c0                	test   %eax,%eax
+  800f79:	7f 28                	jg     800fa3 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7e:	5b                   	pop    %ebx
+  800f7f:	5e                   	pop    %esi
+  800f80:	5f                   	pop    %edi
+  800f81:	5d                   	pop    %ebp
+  800f82:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f93:	89 df                	mov    %ebx,%edi
+  800f95:	55                   	push   %ebp
+  800f96:	89 e5                	mov    %esp,%ebp
+  800f98:	8d 35 a0 0f 80 00    	lea    0x800fa0,%esi
+  800f9e:	0f 34                	sysenter
+  800fa0:	5d                   	pop    %ebp
+		goto out;
+  800fa1:	eb d4                	jmp    800f77 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa3:	83 ec 0c             	sub    $0xc,%esp
+  800fa6:	50                   	push   %eax
+  800fa7:	6a 0a                	push   $0xa
+  800fa9:	68 6b 2f 80 00       	push   $0x802f6b
+  800fae:	6a 3f                	push   $0x3f
+  800fb0:	68 88 2f 80 00       	push   $0x802f88
+  800fb5:	e8 5e f1 ff ff       	call   800118 <_panic>
+
+00800fba <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	57                   	push   %edi
+  800fbe:	56                   	push   %esi
+  800fbf:	53                   	push   %ebx
+  800fc0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fc3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fca:	74 22                	je     800fee <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd1:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdc:	89 df                	mov    %ebx,%edi
+  800fde:	89 de                	mov    %ebx,%esi
+  800fe0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe2:	85 c0                	test   %eax,%eax
+  800fe4:	7f 28                	jg     80100e <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fe6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff9:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ffe:	89 df                	mov    %ebx,%edi
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	8d 35 0b 10 80 00    	lea    0x80100b,%esi
+  801009:	0f 34                	sysenter
+  80100b:	5d                   	pop    %ebp
+		goto out;
+  80100c:	eb d4                	jmp    800fe2 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+  801011:	50                   	push   %eax
+  801012:	6a 17                	push   $0x17
+  801014:	68 6b 2f 80 00       	push   $0x802f6b
+  801019:	6a 3f                	push   $0x3f
+  80101b:	68 88 2f 80 00       	push   $0x802f88
+  801020:	e8 f3 f0 ff ff       	call   800118 <_panic>
+
+00801025 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	57                   	push   %edi
+  801029:	56                   	push   %esi
+  80102a:	53                   	push   %ebx
+  80102b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80102e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801035:	74 22                	je     801059 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801037:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	89 df                	mov    %ebx,%edi
+  801049:	89 de                	mov    %ebx,%esi
+  80104b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104d:	85 c0                	test   %eax,%eax
+  80104f:	7f 28                	jg     801079 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801051:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801054:	5b                   	pop    %ebx
+  801055:	5e                   	pop    %esi
+  801056:	5f                   	pop    %edi
+  801057:	5d                   	pop    %ebp
+  801058:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801059:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801061:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801064:	b8 18 00 00 00       	mov    $0x18,%eax
+  801069:	89 df                	mov    %ebx,%edi
+  80106b:	55                   	push   %ebp
+  80106c:	89 e5                	mov    %esp,%ebp
+  80106e:	8d 35 76 10 80 00    	lea    0x801076,%esi
+  801074:	0f 34                	sysenter
+  801076:	5d                   	pop    %ebp
+		goto out;
+  801077:	eb d4                	jmp    80104d <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801079:	83 ec 0c             	sub    $0xc,%esp
+  80107c:	50                   	push   %eax
+  80107d:	6a 18                	push   $0x18
+  80107f:	68 6b 2f 80 00       	push   $0x802f6b
+  801084:	6a 3f                	push   $0x3f
+  801086:	68 88 2f 80 00       	push   $0x802f88
+  80108b:	e8 88 f0 ff ff       	call   800118 <_panic>
+
+00801090 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	57                   	push   %edi
+  801094:	56                   	push   %esi
+  801095:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801096:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80109d:	74 1d                	je     8010bc <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80109f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010b7:	5b                   	pop    %ebx
+  8010b8:	5e                   	pop    %esi
+  8010b9:	5f                   	pop    %edi
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ca:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010cd:	55                   	push   %ebp
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	8d 35 d8 10 80 00    	lea    0x8010d8,%esi
+  8010d6:	0f 34                	sysenter
+  8010d8:	5d                   	pop    %ebp
+		goto out;
+  8010d9:	eb dc                	jmp    8010b7 <sys_ipc_try_send+0x27>
+
+008010db <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+  8010e1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010e4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010eb:	74 21                	je     80110e <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fa:	89 cb                	mov    %ecx,%ebx
+  8010fc:	89 cf                	mov    %ecx,%edi
+  8010fe:	89 ce                	mov    %ecx,%esi
+  801100:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801102:	85 c0                	test   %eax,%eax
+  801104:	7f 27                	jg     80112d <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80110e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801111:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801116:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80111b:	89 cb                	mov    %ecx,%ebx
+  80111d:	89 cf                	mov    %ecx,%edi
+  80111f:	55                   	push   %ebp
+  801120:	89 e5                	mov    %esp,%ebp
+  801122:	8d 35 2a 11 80 00    	lea    0x80112a,%esi
+  801128:	0f 34                	sysenter
+  80112a:	5d                   	pop    %ebp
+		goto out;
+  80112b:	eb d5                	jmp    801102 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112d:	83 ec 0c             	sub    $0xc,%esp
+  801130:	50                   	push   %eax
+  801131:	6a 0d                	push   $0xd
+  801133:	68 6b 2f 80 00       	push   $0x802f6b
+  801138:	6a 3f                	push   $0x3f
+  80113a:	68 88 2f 80 00       	push   $0x802f88
+  80113f:	e8 d4 ef ff ff       	call   800118 <_panic>
+
+00801144 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	57                   	push   %edi
+  801148:	56                   	push   %esi
+  801149:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80114a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801151:	74 1b                	je     80116e <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801153:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801158:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801163:	89 df                	mov    %ebx,%edi
+  801165:	89 de                	mov    %ebx,%esi
+  801167:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801169:	5b                   	pop    %ebx
+  80116a:	5e                   	pop    %esi
+  80116b:	5f                   	pop    %edi
+  80116c:	5d                   	pop    %ebp
+  80116d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80116e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801173:	8b 55 08             	mov    0x8(%ebp),%edx
+  801176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801179:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80117e:	89 df                	mov    %ebx,%edi
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	8d 35 8b 11 80 00    	lea    0x80118b,%esi
+  801189:	0f 34                	sysenter
+  80118b:	5d                   	pop    %ebp
+		goto out;
+  80118c:	eb db                	jmp    801169 <sys_ipc_recv_until+0x25>
+
+0080118e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801194:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80119b:	74 19                	je     8011b6 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80119d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a7:	89 d1                	mov    %edx,%ecx
+  8011a9:	89 d3                	mov    %edx,%ebx
+  8011ab:	89 d7                	mov    %edx,%edi
+  8011ad:	89 d6                	mov    %edx,%esi
+  8011af:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011b1:	5b                   	pop    %ebx
+  8011b2:	5e                   	pop    %esi
+  8011b3:	5f                   	pop    %edi
+  8011b4:	5d                   	pop    %ebp
+  8011b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011c0:	89 d1                	mov    %edx,%ecx
+  8011c2:	89 d3                	mov    %edx,%ebx
+  8011c4:	89 d7                	mov    %edx,%edi
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	8d 35 d1 11 80 00    	lea    0x8011d1,%esi
+  8011cf:	0f 34                	sysenter
+  8011d1:	5d                   	pop    %ebp
+		goto out;
+  8011d2:	eb dd                	jmp    8011b1 <sys_time_msec+0x23>
+
+008011d4 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011da:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011e1:	74 1a                	je     8011fd <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f0:	89 cb                	mov    %ecx,%ebx
+  8011f2:	89 cf                	mov    %ecx,%edi
+  8011f4:	89 ce                	mov    %ecx,%esi
+  8011f6:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5f                   	pop    %edi
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801200:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801205:	b8 10 00 00 00       	mov    $0x10,%eax
+  80120a:	89 cb                	mov    %ecx,%ebx
+  80120c:	89 cf                	mov    %ecx,%edi
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	8d 35 19 12 80 00    	lea    0x801219,%esi
+  801217:	0f 34                	sysenter
+  801219:	5d                   	pop    %ebp
+		goto out;
+  80121a:	eb dc                	jmp    8011f8 <sys_sleep_until+0x24>
+
+0080121c <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	57                   	push   %edi
+  801220:	56                   	push   %esi
+  801221:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801222:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801229:	74 1a                	je     801245 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80122b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801230:	b8 11 00 00 00       	mov    $0x11,%eax
+  801235:	8b 55 08             	mov    0x8(%ebp),%edx
+  801238:	89 cb                	mov    %ecx,%ebx
+  80123a:	89 cf                	mov    %ecx,%edi
+  80123c:	89 ce                	mov    %ecx,%esi
+  80123e:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801240:	5b                   	pop    %ebx
+  801241:	5e                   	pop    %esi
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801245:	8b 55 08             	mov    0x8(%ebp),%edx
+  801248:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801252:	89 cb                	mov    %ecx,%ebx
+  801254:	89 cf                	mov    %ecx,%edi
+  801256:	55                   	push   %ebp
+  801257:	89 e5                	mov    %esp,%ebp
+  801259:	8d 35 61 12 80 00    	lea    0x801261,%esi
+  80125f:	0f 34                	sysenter
+  801261:	5d                   	pop    %ebp
+		goto out;
+  801262:	eb dc                	jmp    801240 <sys_env_print_stats+0x24>
+
+00801264 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801264:	55                   	push   %ebp
+  801265:	89 e5                	mov    %esp,%ebp
+  801267:	57                   	push   %edi
+  801268:	56                   	push   %esi
+  801269:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80126a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801271:	74 1b                	je     80128e <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801278:	b8 19 00 00 00       	mov    $0x19,%eax
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	89 df                	mov    %ebx,%edi
+  801285:	89 de                	mov    %ebx,%esi
+  801287:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801289:	5b                   	pop    %ebx
+  80128a:	5e                   	pop    %esi
+  80128b:	5f                   	pop    %edi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80128e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801293:	8b 55 08             	mov    0x8(%ebp),%edx
+  801296:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801299:	b8 19 00 00 00       	mov    $0x19,%eax
+  80129e:	89 df                	mov    %ebx,%edi
+  8012a0:	55                   	push   %ebp
+  8012a1:	89 e5                	mov    %esp,%ebp
+  8012a3:	8d 35 ab 12 80 00    	lea    0x8012ab,%esi
+  8012a9:	0f 34                	sysenter
+  8012ab:	5d                   	pop    %ebp
+		goto out;
+  8012ac:	eb db                	jmp    801289 <sys_perf+0x25>
+
+008012ae <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	57                   	push   %edi
+  8012b2:	56                   	push   %esi
+  8012b3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012b4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012bb:	74 19                	je     8012d6 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012c7:	89 d1                	mov    %edx,%ecx
+  8012c9:	89 d3                	mov    %edx,%ebx
+  8012cb:	89 d7                	mov    %edx,%edi
+  8012cd:	89 d6                	mov    %edx,%esi
+  8012cf:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012d1:	5b                   	pop    %ebx
+  8012d2:	5e                   	pop    %esi
+  8012d3:	5f                   	pop    %edi
+  8012d4:	5d                   	pop    %ebp
+  8012d5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012e0:	89 d1                	mov    %edx,%ecx
+  8012e2:	89 d3                	mov    %edx,%ebx
+  8012e4:	89 d7                	mov    %edx,%edi
+  8012e6:	55                   	push   %ebp
+  8012e7:	89 e5                	mov    %esp,%ebp
+  8012e9:	8d 35 f1 12 80 00    	lea    0x8012f1,%esi
+  8012ef:	0f 34                	sysenter
+  8012f1:	5d                   	pop    %ebp
+		goto out;
+  8012f2:	eb dd                	jmp    8012d1 <sys_fork+0x23>
+
+008012f4 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012f4:	55                   	push   %ebp
+  8012f5:	89 e5                	mov    %esp,%ebp
+  8012f7:	57                   	push   %edi
+  8012f8:	56                   	push   %esi
+  8012f9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012fa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801301:	74 1c                	je     80131f <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801303:	be 00 00 00 00       	mov    $0x0,%esi
+  801308:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80130d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801313:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801316:	89 f7                	mov    %esi,%edi
+  801318:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80131a:	5b                   	pop    %ebx
+  80131b:	5e                   	pop    %esi
+  80131c:	5f                   	pop    %edi
+  80131d:	5d                   	pop    %ebp
+  80131e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80131f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801322:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801325:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80132a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80132f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	8d 35 3d 13 80 00    	lea    0x80133d,%esi
+  80133b:	0f 34                	sysenter
+  80133d:	5d                   	pop    %ebp
+		goto out;
+  80133e:	eb da                	jmp    80131a <sys_thread_create+0x26>
+
+00801340 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	57                   	push   %edi
+  801344:	56                   	push   %esi
+  801345:	53                   	push   %ebx
+  801346:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801349:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801350:	74 24                	je     801376 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801352:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801357:	be 00 00 00 00       	mov    $0x0,%esi
+  80135c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801365:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801368:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80136a:	85 c0                	test   %eax,%eax
+  80136c:	7f 27                	jg     801395 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80136e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801371:	5b                   	pop    %ebx
+  801372:	5e                   	pop    %esi
+  801373:	5f                   	pop    %edi
+  801374:	5d                   	pop    %ebp
+  801375:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801376:	8b 55 08             	mov    0x8(%ebp),%edx
+  801379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801381:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801384:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	8d 35 92 13 80 00    	lea    0x801392,%esi
+  801390:	0f 34                	sysenter
+  801392:	5d                   	pop    %ebp
+		goto out;
+  801393:	eb d5                	jmp    80136a <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801395:	83 ec 0c             	sub    $0xc,%esp
+  801398:	50                   	push   %eax
+  801399:	6a 1f                	push   $0x1f
+  80139b:	68 6b 2f 80 00       	push   $0x802f6b
+  8013a0:	6a 3f                	push   $0x3f
+  8013a2:	68 88 2f 80 00       	push   $0x802f88
+  8013a7:	e8 6c ed ff ff       	call   800118 <_panic>
+
+008013ac <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	57                   	push   %edi
+  8013b0:	56                   	push   %esi
+  8013b1:	53                   	push   %ebx
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013b5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013bc:	74 23                	je     8013e1 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013be:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d1:	89 f7                	mov    %esi,%edi
+  8013d3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	7f 29                	jg     801402 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013dc:	5b                   	pop    %ebx
+  8013dd:	5e                   	pop    %esi
+  8013de:	5f                   	pop    %edi
+  8013df:	5d                   	pop    %ebp
+  8013e0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f4:	55                   	push   %ebp
+  8013f5:	89 e5                	mov    %esp,%ebp
+  8013f7:	8d 35 ff 13 80 00    	lea    0x8013ff,%esi
+  8013fd:	0f 34                	sysenter
+  8013ff:	5d                   	pop    %ebp
+		goto out;
+  801400:	eb d3                	jmp    8013d5 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801402:	83 ec 0c             	sub    $0xc,%esp
+  801405:	50                   	push   %eax
+  801406:	6a 20                	push   $0x20
+  801408:	68 6b 2f 80 00       	push   $0x802f6b
+  80140d:	6a 3f                	push   $0x3f
+  80140f:	68 88 2f 80 00       	push   $0x802f88
+  801414:	e8 ff ec ff ff       	call   800118 <_panic>
+
+00801419 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	57                   	push   %edi
+  80141d:	56                   	push   %esi
+  80141e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80141f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801426:	74 1b                	je     801443 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801432:	8b 55 08             	mov    0x8(%ebp),%edx
+  801435:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801438:	89 df                	mov    %ebx,%edi
+  80143a:	89 de                	mov    %ebx,%esi
+  80143c:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80143e:	5b                   	pop    %ebx
+  80143f:	5e                   	pop    %esi
+  801440:	5f                   	pop    %edi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801443:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801448:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801453:	89 df                	mov    %ebx,%edi
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	8d 35 60 14 80 00    	lea    0x801460,%esi
+  80145e:	0f 34                	sysenter
+  801460:	5d                   	pop    %ebp
+		goto out;
+  801461:	eb db                	jmp    80143e <sys_batch+0x25>
+
+00801463 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801463:	55                   	push   %ebp
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	57                   	push   %edi
+  801467:	56                   	push   %esi
+  801468:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801469:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801470:	74 1a                	je     80148c <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801472:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801477:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80147c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147f:	89 cb                	mov    %ecx,%ebx
+  801481:	89 cf                	mov    %ecx,%edi
+  801483:	89 ce                	mov    %ecx,%esi
+  801485:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801487:	5b                   	pop    %ebx
+  801488:	5e                   	pop    %esi
+  801489:	5f                   	pop    %edi
+  80148a:	5d                   	pop    %ebp
+  80148b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80148c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801494:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801499:	89 cb                	mov    %ecx,%ebx
+  80149b:	89 cf                	mov    %ecx,%edi
+  80149d:	55                   	push   %ebp
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	8d 35 a8 14 80 00    	lea    0x8014a8,%esi
+  8014a6:	0f 34                	sysenter
+  8014a8:	5d                   	pop    %ebp
+		goto out;
+  8014a9:	eb dc                	jmp    801487 <sys_trace_ctl+0x24>
+
+008014ab <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+  8014ae:	57                   	push   %edi
+  8014af:	56                   	push   %esi
+  8014b0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014b1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014b8:	74 1c                	je     8014d6 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014cd:	89 f7                	mov    %esi,%edi
+  8014cf:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014d1:	5b                   	pop    %ebx
+  8014d2:	5e                   	pop    %esi
+  8014d3:	5f                   	pop    %edi
+  8014d4:	5d                   	pop    %ebp
+  8014d5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014dc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e9:	55                   	push   %ebp
+  8014ea:	89 e5                	mov    %esp,%ebp
+  8014ec:	8d 35 f4 14 80 00    	lea    0x8014f4,%esi
+  8014f2:	0f 34                	sysenter
+  8014f4:	5d                   	pop    %ebp
+		goto out;
+  8014f5:	eb da                	jmp    8014d1 <sys_trace_read+0x26>
+
+008014f7 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	57                   	push   %edi
+  8014fb:	56                   	push   %esi
+  8014fc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014fd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801504:	74 1c                	je     801522 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801506:	be 00 00 00 00       	mov    $0x0,%esi
+  80150b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801510:	8b 55 08             	mov    0x8(%ebp),%edx
+  801513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801516:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801519:	89 f7                	mov    %esi,%edi
+  80151b:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80151d:	5b                   	pop    %ebx
+  80151e:	5e                   	pop    %esi
+  80151f:	5f                   	pop    %edi
+  801520:	5d                   	pop    %ebp
+  801521:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801522:	8b 55 08             	mov    0x8(%ebp),%edx
+  801525:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801528:	b8 21 00 00 00       	mov    $0x21,%eax
+  80152d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801532:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	8d 35 40 15 80 00    	lea    0x801540,%esi
+  80153e:	0f 34                	sysenter
+  801540:	5d                   	pop    %ebp
+		goto out;
+  801541:	eb da                	jmp    80151d <sys_meminfo+0x26>
+
+00801543 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	57                   	push   %edi
+  801547:	56                   	push   %esi
+  801548:	53                   	push   %ebx
+  801549:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80154c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801550:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801557:	74 1f                	je     801578 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801563:	8b 55 08             	mov    0x8(%ebp),%edx
+  801566:	89 df                	mov    %ebx,%edi
+  801568:	89 de                	mov    %ebx,%esi
+  80156a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80156c:	85 c0                	test   %eax,%eax
+  80156e:	7f 25                	jg     801595 <sys_env_set_ksm+0x52>
+}
+  801570:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801573:	5b                   	pop    %ebx
+  801574:	5e                   	pop    %esi
+  801575:	5f                   	pop    %edi
+  801576:	5d                   	pop    %ebp
+  801577:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801578:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801580:	b8 22 00 00 00       	mov    $0x22,%eax
+  801585:	89 df                	mov    %ebx,%edi
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	8d 35 92 15 80 00    	lea    0x801592,%esi
+  801590:	0f 34                	sysenter
+  801592:	5d                   	pop    %ebp
+		goto out;
+  801593:	eb d7                	jmp    80156c <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801595:	83 ec 0c             	sub    $0xc,%esp
+  801598:	50                   	push   %eax
+  801599:	6a 22                	push   $0x22
+  80159b:	68 6b 2f 80 00       	push   $0x802f6b
+  8015a0:	6a 3f                	push   $0x3f
+  8015a2:	68 88 2f 80 00       	push   $0x802f88
+  8015a7:	e8 6c eb ff ff       	call   800118 <_panic>
+
+008015ac <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	57                   	push   %edi
+  8015b0:	56                   	push   %esi
+  8015b1:	53                   	push   %ebx
+  8015b2:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015b5:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015b8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015bf:	74 24                	je     8015e5 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015cb:	89 cb                	mov    %ecx,%ebx
+  8015cd:	89 cf                	mov    %ecx,%edi
+  8015cf:	89 ce                	mov    %ecx,%esi
+  8015d1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015d3:	85 c0                	test   %eax,%eax
+  8015d5:	7f 2a                	jg     801601 <sys_time_nsec+0x55>
+	return ns;
+}
+  8015d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e0:	5b                   	pop    %ebx
+  8015e1:	5e                   	pop    %esi
+  8015e2:	5f                   	pop    %edi
+  8015e3:	5d                   	pop    %ebp
+  8015e4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015ef:	89 cb                	mov    %ecx,%ebx
+  8015f1:	89 cf                	mov    %ecx,%edi
+  8015f3:	55                   	push   %ebp
+  8015f4:	89 e5                	mov    %esp,%ebp
+  8015f6:	8d 35 fe 15 80 00    	lea    0x8015fe,%esi
+  8015fc:	0f 34                	sysenter
+  8015fe:	5d                   	pop    %ebp
+		goto out;
+  8015ff:	eb d2                	jmp    8015d3 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801601:	83 ec 0c             	sub    $0xc,%esp
+  801604:	50                   	push   %eax
+  801605:	6a 0f                	push   $0xf
+  801607:	68 6b 2f 80 00       	push   $0x802f6b
+  80160c:	6a 3f                	push   $0x3f
+  80160e:	68 88 2f 80 00       	push   $0x802f88
+  801613:	e8 00 eb ff ff       	call   800118 <_panic>
+
+00801618 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	57                   	push   %edi
+  80161c:	56                   	push   %esi
+  80161d:	53                   	push   %ebx
+  80161e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801621:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801628:	74 22                	je     80164c <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801634:	8b 55 08             	mov    0x8(%ebp),%edx
+  801637:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163a:	89 df                	mov    %ebx,%edi
+  80163c:	89 de                	mov    %ebx,%esi
+  80163e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801640:	85 c0                	test   %eax,%eax
+  801642:	7f 28                	jg     80166c <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801644:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801647:	5b                   	pop    %ebx
+  801648:	5e                   	pop    %esi
+  801649:	5f                   	pop    %edi
+  80164a:	5d                   	pop    %ebp
+  80164b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80164c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801651:	8b 55 08             	mov    0x8(%ebp),%edx
+  801654:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801657:	b8 12 00 00 00       	mov    $0x12,%eax
+  80165c:	89 df                	mov    %ebx,%edi
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	8d 35 69 16 80 00    	lea    0x801669,%esi
+  801667:	0f 34                	sysenter
+  801669:	5d                   	pop    %ebp
+		goto out;
+  80166a:	eb d4                	jmp    801640 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80166c:	83 ec 0c             	sub    $0xc,%esp
+  80166f:	50                   	push   %eax
+  801670:	6a 12                	push   $0x12
+  801672:	68 6b 2f 80 00       	push   $0x802f6b
+  801677:	6a 3f                	push   $0x3f
+  801679:	68 88 2f 80 00       	push   $0x802f88
+  80167e:	e8 95 ea ff ff       	call   800118 <_panic>
+
+00801683 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801683:	55                   	push   %ebp
+  801684:	89 e5                	mov    %esp,%ebp
+  801686:	57                   	push   %edi
+  801687:	56                   	push   %esi
+  801688:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801689:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801690:	74 1b                	je     8016ad <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801692:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801697:	b8 13 00 00 00       	mov    $0x13,%eax
+  80169c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a2:	89 df                	mov    %ebx,%edi
+  8016a4:	89 de                	mov    %ebx,%esi
+  8016a6:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016a8:	5b                   	pop    %ebx
+  8016a9:	5e                   	pop    %esi
+  8016aa:	5f                   	pop    %edi
+  8016ab:	5d                   	pop    %ebp
+  8016ac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016bd:	89 df                	mov    %ebx,%edi
+  8016bf:	55                   	push   %ebp
+  8016c0:	89 e5                	mov    %esp,%ebp
+  8016c2:	8d 35 ca 16 80 00    	lea    0x8016ca,%esi
+  8016c8:	0f 34                	sysenter
+  8016ca:	5d                   	pop    %ebp
+		goto out;
+  8016cb:	eb db                	jmp    8016a8 <sys_e1000_receive+0x25>
+
+008016cd <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	57                   	push   %edi
+  8016d1:	56                   	push   %esi
+  8016d2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016d3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016da:	74 1b                	je     8016f7 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ec:	89 df                	mov    %ebx,%edi
+  8016ee:	89 de                	mov    %ebx,%esi
+  8016f0:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5f                   	pop    %edi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801702:	b8 14 00 00 00       	mov    $0x14,%eax
+  801707:	89 df                	mov    %ebx,%edi
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	8d 35 14 17 80 00    	lea    0x801714,%esi
+  801712:	0f 34                	sysenter
+  801714:	5d                   	pop    %ebp
+		goto out;
+  801715:	eb db                	jmp    8016f2 <sys_e1000_read_hwaddr+0x25>
+
+00801717 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	57                   	push   %edi
+  80171b:	56                   	push   %esi
+  80171c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80171d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801724:	74 1a                	je     801740 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801726:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80172b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801730:	8b 55 08             	mov    0x8(%ebp),%edx
+  801733:	89 cb                	mov    %ecx,%ebx
+  801735:	89 cf                	mov    %ecx,%edi
+  801737:	89 ce                	mov    %ecx,%esi
+  801739:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80173b:	5b                   	pop    %ebx
+  80173c:	5e                   	pop    %esi
+  80173d:	5f                   	pop    %edi
+  80173e:	5d                   	pop    %ebp
+  80173f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801740:	8b 55 08             	mov    0x8(%ebp),%edx
+  801743:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801748:	b8 15 00 00 00       	mov    $0x15,%eax
+  80174d:	89 cb                	mov    %ecx,%ebx
+  80174f:	89 cf                	mov    %ecx,%edi
+  801751:	55                   	push   %ebp
+  801752:	89 e5                	mov    %esp,%ebp
+  801754:	8d 35 5c 17 80 00    	lea    0x80175c,%esi
+  80175a:	0f 34                	sysenter
+  80175c:	5d                   	pop    %ebp
+		goto out;
+  80175d:	eb dc                	jmp    80173b <sys_sb16_read_version+0x24>
+
+0080175f <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80175f:	55                   	push   %ebp
+  801760:	89 e5                	mov    %esp,%ebp
+  801762:	57                   	push   %edi
+  801763:	56                   	push   %esi
+  801764:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801765:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80176c:	74 1b                	je     801789 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80176e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801773:	b8 16 00 00 00       	mov    $0x16,%eax
+  801778:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177e:	89 df                	mov    %ebx,%edi
+  801780:	89 de                	mov    %ebx,%esi
+  801782:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801784:	5b                   	pop    %ebx
+  801785:	5e                   	pop    %esi
+  801786:	5f                   	pop    %edi
+  801787:	5d                   	pop    %ebp
+  801788:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801789:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801791:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801794:	b8 16 00 00 00       	mov    $0x16,%eax
+  801799:	89 df                	mov    %ebx,%edi
+  80179b:	55                   	push   %ebp
+  80179c:	89 e5                	mov    %esp,%ebp
+  80179e:	8d 35 a6 17 80 00    	lea    0x8017a6,%esi
+  8017a4:	0f 34                	sysenter
+  8017a6:	5d                   	pop    %ebp
+		goto out;
+  8017a7:	eb db                	jmp    801784 <sys_sb16_play+0x25>
+
+008017a9 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8017a9:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8017aa:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8017af:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8017b1:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8017b4:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  8017b8:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  8017bb:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  8017bf:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  8017c1:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  8017c5:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8017c6:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  8017ca:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  8017cb:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  8017cc:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8017d0:	c3                   	ret
+
+008017d1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017d1:	55                   	push   %ebp
+  8017d2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017d7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017dc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+
+008017e1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017ec:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017f1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017f6:	5d                   	pop    %ebp
+  8017f7:	c3                   	ret
+
+008017f8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017fb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801800:	eb 02                	jmp    801804 <fd_alloc+0xc>
+  801802:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801804:	89 c2                	mov    %eax,%edx
+  801806:	c1 ea 16             	shr    $0x16,%edx
+  801809:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801810:	f6 c2 01             	test   $0x1,%dl
+  801813:	74 2b                	je     801840 <fd_alloc+0x48>
+  801815:	89 c2                	mov    %eax,%edx
+  801817:	c1 ea 0c             	shr    $0xc,%edx
+  80181a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801821:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801827:	f6 c1 01             	test   $0x1,%cl
+  80182a:	74 14                	je     801840 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80182c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801832:	75 ce                	jne    801802 <fd_alloc+0xa>
+  801834:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801839:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80183e:	eb 05                	jmp    801845 <fd_alloc+0x4d>
+			return 0;
+  801840:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801845:	8b 55 08             	mov    0x8(%ebp),%edx
+  801848:	89 02                	mov    %eax,(%edx)
+}
+  80184a:	89 c8                	mov    %ecx,%eax
+  80184c:	5d                   	pop    %ebp
+  80184d:	c3                   	ret
+
+0080184e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80184e:	55                   	push   %ebp
+  80184f:	89 e5                	mov    %esp,%ebp
+  801851:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801854:	83 f8 1f             	cmp    $0x1f,%eax
+  801857:	77 30                	ja     801889 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801859:	c1 e0 0c             	shl    $0xc,%eax
+  80185c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801861:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801867:	f6 c2 01             	test   $0x1,%dl
+  80186a:	74 24                	je     801890 <fd_lookup+0x42>
+  80186c:	89 c2                	mov    %eax,%edx
+  80186e:	c1 ea 0c             	shr    $0xc,%edx
+  801871:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801878:	f6 c2 01             	test   $0x1,%dl
+  80187b:	74 1a                	je     801897 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80187d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801880:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801882:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801887:	5d                   	pop    %ebp
+  801888:	c3                   	ret
+		return -E_INVAL;
+  801889:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80188e:	eb f7                	jmp    801887 <fd_lookup+0x39>
+		return -E_INVAL;
+  801890:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801895:	eb f0                	jmp    801887 <fd_lookup+0x39>
+  801897:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189c:	eb e9                	jmp    801887 <fd_lookup+0x39>
+
+0080189e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80189e:	55                   	push   %ebp
+  80189f:	89 e5                	mov    %esp,%ebp
+  8018a1:	53                   	push   %ebx
+  8018a2:	83 ec 04             	sub    $0x4,%esp
+  8018a5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ad:	eb 03                	jmp    8018b2 <dev_lookup+0x14>
+  8018af:	83 c0 01             	add    $0x1,%eax
+  8018b2:	8b 1c 85 14 30 80 00 	mov    0x803014(,%eax,4),%ebx
+  8018b9:	85 db                	test   %ebx,%ebx
+  8018bb:	74 0b                	je     8018c8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018bd:	39 13                	cmp    %edx,(%ebx)
+  8018bf:	75 ee                	jne    8018af <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c6:	eb 2e                	jmp    8018f6 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8018c8:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018ca:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8018cf:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018d5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018da:	76 24                	jbe    801900 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018dc:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018df:	83 ec 04             	sub    $0x4,%esp
+  8018e2:	52                   	push   %edx
+  8018e3:	50                   	push   %eax
+  8018e4:	68 98 2f 80 00       	push   $0x802f98
+  8018e9:	e8 05 e9 ff ff       	call   8001f3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018ee:	83 c4 10             	add    $0x10,%esp
+  8018f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018f9:	89 1a                	mov    %ebx,(%edx)
+}
+  8018fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018fe:	c9                   	leave
+  8018ff:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801900:	c1 e8 10             	shr    $0x10,%eax
+  801903:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801909:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80190f:	eb cb                	jmp    8018dc <dev_lookup+0x3e>
+
+00801911 <fd_close>:
+{
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+  801914:	57                   	push   %edi
+  801915:	56                   	push   %esi
+  801916:	53                   	push   %ebx
+  801917:	83 ec 24             	sub    $0x24,%esp
+  80191a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80191d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801920:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801923:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801924:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80192a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80192d:	50                   	push   %eax
+  80192e:	e8 1b ff ff ff       	call   80184e <fd_lookup>
+  801933:	89 c3                	mov    %eax,%ebx
+  801935:	83 c4 10             	add    $0x10,%esp
+  801938:	85 c0                	test   %eax,%eax
+  80193a:	78 05                	js     801941 <fd_close+0x30>
+	    || fd != fd2)
+  80193c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80193f:	74 16                	je     801957 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801941:	89 f8                	mov    %edi,%eax
+  801943:	84 c0                	test   %al,%al
+  801945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80194d:	89 d8                	mov    %ebx,%eax
+  80194f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801952:	5b                   	pop    %ebx
+  801953:	5e                   	pop    %esi
+  801954:	5f                   	pop    %edi
+  801955:	5d                   	pop    %ebp
+  801956:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801957:	83 ec 08             	sub    $0x8,%esp
+  80195a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80195d:	50                   	push   %eax
+  80195e:	ff 36                	push   (%esi)
+  801960:	e8 39 ff ff ff       	call   80189e <dev_lookup>
+  801965:	89 c3                	mov    %eax,%ebx
+  801967:	83 c4 10             	add    $0x10,%esp
+  80196a:	85 c0                	test   %eax,%eax
+  80196c:	78 1a                	js     801988 <fd_close+0x77>
+		if (dev->dev_close)
+  80196e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801971:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801974:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	74 0b                	je     801988 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80197d:	83 ec 0c             	sub    $0xc,%esp
+  801980:	56                   	push   %esi
+  801981:	ff d0                	call   *%eax
+  801983:	89 c3                	mov    %eax,%ebx
+  801985:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801988:	83 ec 08             	sub    $0x8,%esp
+  80198b:	56                   	push   %esi
+  80198c:	6a 00                	push   $0x0
+  80198e:	e8 7b f4 ff ff       	call   800e0e <sys_page_unmap>
+	return r;
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	eb b5                	jmp    80194d <fd_close+0x3c>
+
+00801998 <close>:
+
+int
+close(int fdnum)
+{
+  801998:	55                   	push   %ebp
+  801999:	89 e5                	mov    %esp,%ebp
+  80199b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80199e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a1:	50                   	push   %eax
+  8019a2:	ff 75 08             	push   0x8(%ebp)
+  8019a5:	e8 a4 fe ff ff       	call   80184e <fd_lookup>
+  8019aa:	83 c4 10             	add    $0x10,%esp
+  8019ad:	85 c0                	test   %eax,%eax
+  8019af:	79 02                	jns    8019b3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8019b1:	c9                   	leave
+  8019b2:	c3                   	ret
+		return fd_close(fd, 1);
+  8019b3:	83 ec 08             	sub    $0x8,%esp
+  8019b6:	6a 01                	push   $0x1
+  8019b8:	ff 75 f4             	push   -0xc(%ebp)
+  8019bb:	e8 51 ff ff ff       	call   801911 <fd_close>
+  8019c0:	83 c4 10             	add    $0x10,%esp
+  8019c3:	eb ec                	jmp    8019b1 <close+0x19>
+
+008019c5 <close_all>:
+
+void
+close_all(void)
+{
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+  8019c8:	53                   	push   %ebx
+  8019c9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019d1:	83 ec 0c             	sub    $0xc,%esp
+  8019d4:	53                   	push   %ebx
+  8019d5:	e8 be ff ff ff       	call   801998 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019da:	83 c3 01             	add    $0x1,%ebx
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	83 fb 20             	cmp    $0x20,%ebx
+  8019e3:	75 ec                	jne    8019d1 <close_all+0xc>
+}
+  8019e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e8:	c9                   	leave
+  8019e9:	c3                   	ret
+
+008019ea <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	57                   	push   %edi
+  8019ee:	56                   	push   %esi
+  8019ef:	53                   	push   %ebx
+  8019f0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019f3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019f6:	50                   	push   %eax
+  8019f7:	ff 75 08             	push   0x8(%ebp)
+  8019fa:	e8 4f fe ff ff       	call   80184e <fd_lookup>
+  8019ff:	89 c3                	mov    %eax,%ebx
+  801a01:	83 c4 10             	add    $0x10,%esp
+  801a04:	85 c0                	test   %eax,%eax
+  801a06:	78 7f                	js     801a87 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a08:	83 ec 0c             	sub    $0xc,%esp
+  801a0b:	ff 75 0c             	push   0xc(%ebp)
+  801a0e:	e8 85 ff ff ff       	call   801998 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a13:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a16:	c1 e6 0c             	shl    $0xc,%esi
+  801a19:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a1f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a22:	89 3c 24             	mov    %edi,(%esp)
+  801a25:	e8 b7 fd ff ff       	call   8017e1 <fd2data>
+  801a2a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a2c:	89 34 24             	mov    %esi,(%esp)
+  801a2f:	e8 ad fd ff ff       	call   8017e1 <fd2data>
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a3a:	89 d8                	mov    %ebx,%eax
+  801a3c:	c1 e8 16             	shr    $0x16,%eax
+  801a3f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a46:	a8 01                	test   $0x1,%al
+  801a48:	74 11                	je     801a5b <dup+0x71>
+  801a4a:	89 d8                	mov    %ebx,%eax
+  801a4c:	c1 e8 0c             	shr    $0xc,%eax
+  801a4f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a56:	f6 c2 01             	test   $0x1,%dl
+  801a59:	75 36                	jne    801a91 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a5b:	89 f8                	mov    %edi,%eax
+  801a5d:	c1 e8 0c             	shr    $0xc,%eax
+  801a60:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a67:	83 ec 0c             	sub    $0xc,%esp
+  801a6a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a6f:	50                   	push   %eax
+  801a70:	56                   	push   %esi
+  801a71:	6a 00                	push   $0x0
+  801a73:	57                   	push   %edi
+  801a74:	6a 00                	push   $0x0
+  801a76:	e8 25 f3 ff ff       	call   800da0 <sys_page_map>
+  801a7b:	89 c3                	mov    %eax,%ebx
+  801a7d:	83 c4 20             	add    $0x20,%esp
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	78 33                	js     801ab7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a84:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a87:	89 d8                	mov    %ebx,%eax
+  801a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a8c:	5b                   	pop    %ebx
+  801a8d:	5e                   	pop    %esi
+  801a8e:	5f                   	pop    %edi
+  801a8f:	5d                   	pop    %ebp
+  801a90:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a91:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a98:	83 ec 0c             	sub    $0xc,%esp
+  801a9b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801aa0:	50                   	push   %eax
+  801aa1:	ff 75 d4             	push   -0x2c(%ebp)
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	53                   	push   %ebx
+  801aa7:	6a 00                	push   $0x0
+  801aa9:	e8 f2 f2 ff ff       	call   800da0 <sys_page_map>
+  801aae:	89 c3                	mov    %eax,%ebx
+  801ab0:	83 c4 20             	add    $0x20,%esp
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	79 a4                	jns    801a5b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ab7:	83 ec 08             	sub    $0x8,%esp
+  801aba:	56                   	push   %esi
+  801abb:	6a 00                	push   $0x0
+  801abd:	e8 4c f3 ff ff       	call   800e0e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ac2:	83 c4 08             	add    $0x8,%esp
+  801ac5:	ff 75 d4             	push   -0x2c(%ebp)
+  801ac8:	6a 00                	push   $0x0
+  801aca:	e8 3f f3 ff ff       	call   800e0e <sys_page_unmap>
+	return r;
+  801acf:	83 c4 10             	add    $0x10,%esp
+  801ad2:	eb b3                	jmp    801a87 <dup+0x9d>
+
+00801ad4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ad4:	55                   	push   %ebp
+  801ad5:	89 e5                	mov    %esp,%ebp
+  801ad7:	56                   	push   %esi
+  801ad8:	53                   	push   %ebx
+  801ad9:	83 ec 18             	sub    $0x18,%esp
+  801adc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801adf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ae2:	50                   	push   %eax
+  801ae3:	53                   	push   %ebx
+  801ae4:	e8 65 fd ff ff       	call   80184e <fd_lookup>
+  801ae9:	83 c4 10             	add    $0x10,%esp
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	78 3c                	js     801b2c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801af0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801af3:	83 ec 08             	sub    $0x8,%esp
+  801af6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af9:	50                   	push   %eax
+  801afa:	ff 36                	push   (%esi)
+  801afc:	e8 9d fd ff ff       	call   80189e <dev_lookup>
+  801b01:	83 c4 10             	add    $0x10,%esp
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 24                	js     801b2c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b08:	8b 46 08             	mov    0x8(%esi),%eax
+  801b0b:	83 e0 03             	and    $0x3,%eax
+  801b0e:	83 f8 01             	cmp    $0x1,%eax
+  801b11:	74 20                	je     801b33 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b16:	8b 40 08             	mov    0x8(%eax),%eax
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	74 57                	je     801b74 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b1d:	83 ec 04             	sub    $0x4,%esp
+  801b20:	ff 75 10             	push   0x10(%ebp)
+  801b23:	ff 75 0c             	push   0xc(%ebp)
+  801b26:	56                   	push   %esi
+  801b27:	ff d0                	call   *%eax
+  801b29:	83 c4 10             	add    $0x10,%esp
+}
+  801b2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b2f:	5b                   	pop    %ebx
+  801b30:	5e                   	pop    %esi
+  801b31:	5d                   	pop    %ebp
+  801b32:	c3                   	ret
+  801b33:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b35:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b3a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b40:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b45:	76 1c                	jbe    801b63 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b47:	8b 42 48             	mov    0x48(%edx),%eax
+  801b4a:	83 ec 04             	sub    $0x4,%esp
+  801b4d:	53                   	push   %ebx
+  801b4e:	50                   	push   %eax
+  801b4f:	68 d9 2f 80 00       	push   $0x802fd9
+  801b54:	e8 9a e6 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b61:	eb c9                	jmp    801b2c <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b63:	c1 e8 10             	shr    $0x10,%eax
+  801b66:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b6c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b72:	eb d3                	jmp    801b47 <read+0x73>
+		return -E_NOT_SUPP;
+  801b74:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b79:	eb b1                	jmp    801b2c <read+0x58>
+
+00801b7b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b7b:	55                   	push   %ebp
+  801b7c:	89 e5                	mov    %esp,%ebp
+  801b7e:	57                   	push   %edi
+  801b7f:	56                   	push   %esi
+  801b80:	53                   	push   %ebx
+  801b81:	83 ec 0c             	sub    $0xc,%esp
+  801b84:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b87:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b8f:	eb 02                	jmp    801b93 <readn+0x18>
+  801b91:	01 c3                	add    %eax,%ebx
+  801b93:	39 f3                	cmp    %esi,%ebx
+  801b95:	73 21                	jae    801bb8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b97:	83 ec 04             	sub    $0x4,%esp
+  801b9a:	89 f0                	mov    %esi,%eax
+  801b9c:	29 d8                	sub    %ebx,%eax
+  801b9e:	50                   	push   %eax
+  801b9f:	89 d8                	mov    %ebx,%eax
+  801ba1:	03 45 0c             	add    0xc(%ebp),%eax
+  801ba4:	50                   	push   %eax
+  801ba5:	57                   	push   %edi
+  801ba6:	e8 29 ff ff ff       	call   801ad4 <read>
+		if (m < 0)
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 04                	js     801bb6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801bb2:	75 dd                	jne    801b91 <readn+0x16>
+  801bb4:	eb 02                	jmp    801bb8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bb6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801bb8:	89 d8                	mov    %ebx,%eax
+  801bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbd:	5b                   	pop    %ebx
+  801bbe:	5e                   	pop    %esi
+  801bbf:	5f                   	pop    %edi
+  801bc0:	5d                   	pop    %ebp
+  801bc1:	c3                   	ret
+
+00801bc2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801bc2:	55                   	push   %ebp
+  801bc3:	89 e5                	mov    %esp,%ebp
+  801bc5:	56                   	push   %esi
+  801bc6:	53                   	push   %ebx
+  801bc7:	83 ec 18             	sub    $0x18,%esp
+  801bca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bcd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bd0:	50                   	push   %eax
+  801bd1:	53                   	push   %ebx
+  801bd2:	e8 77 fc ff ff       	call   80184e <fd_lookup>
+  801bd7:	83 c4 10             	add    $0x10,%esp
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	78 37                	js     801c15 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bde:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801be1:	83 ec 08             	sub    $0x8,%esp
+  801be4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be7:	50                   	push   %eax
+  801be8:	ff 36                	push   (%esi)
+  801bea:	e8 af fc ff ff       	call   80189e <dev_lookup>
+  801bef:	83 c4 10             	add    $0x10,%esp
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	78 1f                	js     801c15 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bf6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bfa:	74 20                	je     801c1c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bff:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	74 57                	je     801c5d <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c06:	83 ec 04             	sub    $0x4,%esp
+  801c09:	ff 75 10             	push   0x10(%ebp)
+  801c0c:	ff 75 0c             	push   0xc(%ebp)
+  801c0f:	56                   	push   %esi
+  801c10:	ff d0                	call   *%eax
+  801c12:	83 c4 10             	add    $0x10,%esp
+}
+  801c15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c18:	5b                   	pop    %ebx
+  801c19:	5e                   	pop    %esi
+  801c1a:	5d                   	pop    %ebp
+  801c1b:	c3                   	ret
+  801c1c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c1e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c23:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c29:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c2e:	76 1c                	jbe    801c4c <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c30:	8b 42 48             	mov    0x48(%edx),%eax
+  801c33:	83 ec 04             	sub    $0x4,%esp
+  801c36:	53                   	push   %ebx
+  801c37:	50                   	push   %eax
+  801c38:	68 f5 2f 80 00       	push   $0x802ff5
+  801c3d:	e8 b1 e5 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801c42:	83 c4 10             	add    $0x10,%esp
+  801c45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c4a:	eb c9                	jmp    801c15 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c4c:	c1 e8 10             	shr    $0x10,%eax
+  801c4f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c55:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c5b:	eb d3                	jmp    801c30 <write+0x6e>
+		return -E_NOT_SUPP;
+  801c5d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c62:	eb b1                	jmp    801c15 <write+0x53>
+
+00801c64 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6d:	50                   	push   %eax
+  801c6e:	ff 75 08             	push   0x8(%ebp)
+  801c71:	e8 d8 fb ff ff       	call   80184e <fd_lookup>
+  801c76:	83 c4 10             	add    $0x10,%esp
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	78 0e                	js     801c8b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c83:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+
+00801c8d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c8d:	55                   	push   %ebp
+  801c8e:	89 e5                	mov    %esp,%ebp
+  801c90:	56                   	push   %esi
+  801c91:	53                   	push   %ebx
+  801c92:	83 ec 18             	sub    $0x18,%esp
+  801c95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c98:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c9b:	50                   	push   %eax
+  801c9c:	53                   	push   %ebx
+  801c9d:	e8 ac fb ff ff       	call   80184e <fd_lookup>
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 34                	js     801cdd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ca9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cac:	83 ec 08             	sub    $0x8,%esp
+  801caf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb2:	50                   	push   %eax
+  801cb3:	ff 36                	push   (%esi)
+  801cb5:	e8 e4 fb ff ff       	call   80189e <dev_lookup>
+  801cba:	83 c4 10             	add    $0x10,%esp
+  801cbd:	85 c0                	test   %eax,%eax
+  801cbf:	78 1c                	js     801cdd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cc1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cc5:	74 1d                	je     801ce4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801cc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cca:	8b 40 18             	mov    0x18(%eax),%eax
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	74 54                	je     801d25 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801cd1:	83 ec 08             	sub    $0x8,%esp
+  801cd4:	ff 75 0c             	push   0xc(%ebp)
+  801cd7:	56                   	push   %esi
+  801cd8:	ff d0                	call   *%eax
+  801cda:	83 c4 10             	add    $0x10,%esp
+}
+  801cdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce0:	5b                   	pop    %ebx
+  801ce1:	5e                   	pop    %esi
+  801ce2:	5d                   	pop    %ebp
+  801ce3:	c3                   	ret
+  801ce4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ce6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ceb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cf1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cf6:	76 1c                	jbe    801d14 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cf8:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cfb:	83 ec 04             	sub    $0x4,%esp
+  801cfe:	53                   	push   %ebx
+  801cff:	50                   	push   %eax
+  801d00:	68 b8 2f 80 00       	push   $0x802fb8
+  801d05:	e8 e9 e4 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801d0a:	83 c4 10             	add    $0x10,%esp
+  801d0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d12:	eb c9                	jmp    801cdd <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d14:	c1 e8 10             	shr    $0x10,%eax
+  801d17:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d1d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d23:	eb d3                	jmp    801cf8 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801d25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d2a:	eb b1                	jmp    801cdd <ftruncate+0x50>
+
+00801d2c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d2c:	55                   	push   %ebp
+  801d2d:	89 e5                	mov    %esp,%ebp
+  801d2f:	56                   	push   %esi
+  801d30:	53                   	push   %ebx
+  801d31:	83 ec 18             	sub    $0x18,%esp
+  801d34:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d37:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d3a:	50                   	push   %eax
+  801d3b:	ff 75 08             	push   0x8(%ebp)
+  801d3e:	e8 0b fb ff ff       	call   80184e <fd_lookup>
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	85 c0                	test   %eax,%eax
+  801d48:	78 49                	js     801d93 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d4a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d4d:	83 ec 08             	sub    $0x8,%esp
+  801d50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d53:	50                   	push   %eax
+  801d54:	ff 36                	push   (%esi)
+  801d56:	e8 43 fb ff ff       	call   80189e <dev_lookup>
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	78 31                	js     801d93 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d65:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d69:	74 2f                	je     801d9a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d6b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d6e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d75:	00 00 00 
+	stat->st_isdir = 0;
+  801d78:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d7f:	00 00 00 
+	stat->st_dev = dev;
+  801d82:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	53                   	push   %ebx
+  801d8c:	56                   	push   %esi
+  801d8d:	ff 50 14             	call   *0x14(%eax)
+  801d90:	83 c4 10             	add    $0x10,%esp
+}
+  801d93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d96:	5b                   	pop    %ebx
+  801d97:	5e                   	pop    %esi
+  801d98:	5d                   	pop    %ebp
+  801d99:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d9a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d9f:	eb f2                	jmp    801d93 <fstat+0x67>
+
+00801da1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801da1:	55                   	push   %ebp
+  801da2:	89 e5                	mov    %esp,%ebp
+  801da4:	56                   	push   %esi
+  801da5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801da6:	83 ec 08             	sub    $0x8,%esp
+  801da9:	6a 00                	push   $0x0
+  801dab:	ff 75 08             	push   0x8(%ebp)
+  801dae:	e8 e4 01 00 00       	call   801f97 <open>
+  801db3:	89 c3                	mov    %eax,%ebx
+  801db5:	83 c4 10             	add    $0x10,%esp
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 1b                	js     801dd7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801dbc:	83 ec 08             	sub    $0x8,%esp
+  801dbf:	ff 75 0c             	push   0xc(%ebp)
+  801dc2:	50                   	push   %eax
+  801dc3:	e8 64 ff ff ff       	call   801d2c <fstat>
+  801dc8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801dca:	89 1c 24             	mov    %ebx,(%esp)
+  801dcd:	e8 c6 fb ff ff       	call   801998 <close>
+	return r;
+  801dd2:	83 c4 10             	add    $0x10,%esp
+  801dd5:	89 f3                	mov    %esi,%ebx
+}
+  801dd7:	89 d8                	mov    %ebx,%eax
+  801dd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ddc:	5b                   	pop    %ebx
+  801ddd:	5e                   	pop    %esi
+  801dde:	5d                   	pop    %ebp
+  801ddf:	c3                   	ret
+
+00801de0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801de0:	55                   	push   %ebp
+  801de1:	89 e5                	mov    %esp,%ebp
+  801de3:	56                   	push   %esi
+  801de4:	53                   	push   %ebx
+  801de5:	89 c6                	mov    %eax,%esi
+  801de7:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801de9:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801df0:	74 27                	je     801e19 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801df2:	6a 07                	push   $0x7
+  801df4:	68 00 60 80 00       	push   $0x806000
+  801df9:	56                   	push   %esi
+  801dfa:	ff 35 00 50 80 00    	push   0x805000
+  801e00:	e8 19 0d 00 00       	call   802b1e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e05:	83 c4 0c             	add    $0xc,%esp
+  801e08:	6a 00                	push   $0x0
+  801e0a:	53                   	push   %ebx
+  801e0b:	6a 00                	push   $0x0
+  801e0d:	e8 f4 0c 00 00       	call   802b06 <ipc_recv>
+}
+  801e12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e15:	5b                   	pop    %ebx
+  801e16:	5e                   	pop    %esi
+  801e17:	5d                   	pop    %ebp
+  801e18:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e19:	83 ec 0c             	sub    $0xc,%esp
+  801e1c:	6a 01                	push   $0x1
+  801e1e:	e8 4f 0d 00 00       	call   802b72 <ipc_find_env>
+  801e23:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	eb c5                	jmp    801df2 <fsipc+0x12>
+
+00801e2d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e2d:	55                   	push   %ebp
+  801e2e:	89 e5                	mov    %esp,%ebp
+  801e30:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e36:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e39:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e41:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e50:	e8 8b ff ff ff       	call   801de0 <fsipc>
+}
+  801e55:	c9                   	leave
+  801e56:	c3                   	ret
+
+00801e57 <devfile_flush>:
+{
+  801e57:	55                   	push   %ebp
+  801e58:	89 e5                	mov    %esp,%ebp
+  801e5a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e60:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e63:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e72:	e8 69 ff ff ff       	call   801de0 <fsipc>
+}
+  801e77:	c9                   	leave
+  801e78:	c3                   	ret
+
+00801e79 <devfile_stat>:
+{
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	53                   	push   %ebx
+  801e7d:	83 ec 04             	sub    $0x4,%esp
+  801e80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e86:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e89:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e93:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e98:	e8 43 ff ff ff       	call   801de0 <fsipc>
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	78 2c                	js     801ecd <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ea1:	83 ec 08             	sub    $0x8,%esp
+  801ea4:	68 00 60 80 00       	push   $0x806000
+  801ea9:	53                   	push   %ebx
+  801eaa:	e8 8c e9 ff ff       	call   80083b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801eaf:	a1 80 60 80 00       	mov    0x806080,%eax
+  801eb4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801eba:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ebf:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801ec5:	83 c4 10             	add    $0x10,%esp
+  801ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ecd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed0:	c9                   	leave
+  801ed1:	c3                   	ret
+
+00801ed2 <devfile_write>:
+{
+  801ed2:	55                   	push   %ebp
+  801ed3:	89 e5                	mov    %esp,%ebp
+  801ed5:	83 ec 0c             	sub    $0xc,%esp
+  801ed8:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801edb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ede:	8b 52 0c             	mov    0xc(%edx),%edx
+  801ee1:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801ee7:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801eec:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ef1:	39 d0                	cmp    %edx,%eax
+  801ef3:	0f 47 c2             	cmova  %edx,%eax
+  801ef6:	50                   	push   %eax
+  801ef7:	ff 75 0c             	push   0xc(%ebp)
+  801efa:	68 08 60 80 00       	push   $0x806008
+  801eff:	e8 bd ea ff ff       	call   8009c1 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f09:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f0e:	e8 cd fe ff ff       	call   801de0 <fsipc>
+}
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+
+00801f15 <devfile_read>:
+{
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	56                   	push   %esi
+  801f19:	53                   	push   %ebx
+  801f1a:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f20:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f23:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801f28:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f33:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f38:	e8 a3 fe ff ff       	call   801de0 <fsipc>
+  801f3d:	89 c3                	mov    %eax,%ebx
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 1f                	js     801f62 <devfile_read+0x4d>
+	assert(r <= n);
+  801f43:	39 c6                	cmp    %eax,%esi
+  801f45:	72 24                	jb     801f6b <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f47:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f4c:	7f 33                	jg     801f81 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f4e:	83 ec 04             	sub    $0x4,%esp
+  801f51:	50                   	push   %eax
+  801f52:	68 00 60 80 00       	push   $0x806000
+  801f57:	ff 75 0c             	push   0xc(%ebp)
+  801f5a:	e8 62 ea ff ff       	call   8009c1 <memmove>
+	return r;
+  801f5f:	83 c4 10             	add    $0x10,%esp
+}
+  801f62:	89 d8                	mov    %ebx,%eax
+  801f64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f67:	5b                   	pop    %ebx
+  801f68:	5e                   	pop    %esi
+  801f69:	5d                   	pop    %ebp
+  801f6a:	c3                   	ret
+	assert(r <= n);
+  801f6b:	68 28 30 80 00       	push   $0x803028
+  801f70:	68 2f 30 80 00       	push   $0x80302f
+  801f75:	6a 76                	push   $0x76
+  801f77:	68 44 30 80 00       	push   $0x803044
+  801f7c:	e8 97 e1 ff ff       	call   800118 <_panic>
+	assert(r <= PGSIZE);
+  801f81:	68 4f 30 80 00       	push   $0x80304f
+  801f86:	68 2f 30 80 00       	push   $0x80302f
+  801f8b:	6a 77                	push   $0x77
+  801f8d:	68 44 30 80 00       	push   $0x803044
+  801f92:	e8 81 e1 ff ff       	call   800118 <_panic>
+
+00801f97 <open>:
+{
+  801f97:	55                   	push   %ebp
+  801f98:	89 e5                	mov    %esp,%ebp
+  801f9a:	56                   	push   %esi
+  801f9b:	53                   	push   %ebx
+  801f9c:	83 ec 1c             	sub    $0x1c,%esp
+  801f9f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801fa2:	56                   	push   %esi
+  801fa3:	e8 58 e8 ff ff       	call   800800 <strlen>
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fb0:	7f 6c                	jg     80201e <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801fb2:	83 ec 0c             	sub    $0xc,%esp
+  801fb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb8:	50                   	push   %eax
+  801fb9:	e8 3a f8 ff ff       	call   8017f8 <fd_alloc>
+  801fbe:	89 c3                	mov    %eax,%ebx
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	85 c0                	test   %eax,%eax
+  801fc5:	78 3c                	js     802003 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801fc7:	83 ec 08             	sub    $0x8,%esp
+  801fca:	56                   	push   %esi
+  801fcb:	68 00 60 80 00       	push   $0x806000
+  801fd0:	e8 66 e8 ff ff       	call   80083b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801fd5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd8:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fdd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fe0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fe5:	e8 f6 fd ff ff       	call   801de0 <fsipc>
+  801fea:	89 c3                	mov    %eax,%ebx
+  801fec:	83 c4 10             	add    $0x10,%esp
+  801fef:	85 c0                	test   %eax,%eax
+  801ff1:	78 19                	js     80200c <open+0x75>
+	return fd2num(fd);
+  801ff3:	83 ec 0c             	sub    $0xc,%esp
+  801ff6:	ff 75 f4             	push   -0xc(%ebp)
+  801ff9:	e8 d3 f7 ff ff       	call   8017d1 <fd2num>
+  801ffe:	89 c3                	mov    %eax,%ebx
+  802000:	83 c4 10             	add    $0x10,%esp
+}
+  802003:	89 d8                	mov    %ebx,%eax
+  802005:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802008:	5b                   	pop    %ebx
+  802009:	5e                   	pop    %esi
+  80200a:	5d                   	pop    %ebp
+  80200b:	c3                   	ret
+		fd_close(fd, 0);
+  80200c:	83 ec 08             	sub    $0x8,%esp
+  80200f:	6a 00                	push   $0x0
+  802011:	ff 75 f4             	push   -0xc(%ebp)
+  802014:	e8 f8 f8 ff ff       	call   801911 <fd_close>
+		return r;
+  802019:	83 c4 10             	add    $0x10,%esp
+  80201c:	eb e5                	jmp    802003 <open+0x6c>
+		return -E_BAD_PATH;
+  80201e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802023:	eb de                	jmp    802003 <open+0x6c>
+
+00802025 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802025:	55                   	push   %ebp
+  802026:	89 e5                	mov    %esp,%ebp
+  802028:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80202b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802030:	b8 08 00 00 00       	mov    $0x8,%eax
+  802035:	e8 a6 fd ff ff       	call   801de0 <fsipc>
+}
+  80203a:	c9                   	leave
+  80203b:	c3                   	ret
+
+0080203c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80203c:	55                   	push   %ebp
+  80203d:	89 e5                	mov    %esp,%ebp
+  80203f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802042:	68 5b 30 80 00       	push   $0x80305b
+  802047:	ff 75 0c             	push   0xc(%ebp)
+  80204a:	e8 ec e7 ff ff       	call   80083b <strcpy>
+	return 0;
+}
+  80204f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802054:	c9                   	leave
+  802055:	c3                   	ret
+
+00802056 <devsock_close>:
+{
+  802056:	55                   	push   %ebp
+  802057:	89 e5                	mov    %esp,%ebp
+  802059:	53                   	push   %ebx
+  80205a:	83 ec 10             	sub    $0x10,%esp
+  80205d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802060:	53                   	push   %ebx
+  802061:	e8 4b 0b 00 00       	call   802bb1 <pageref>
+  802066:	89 c2                	mov    %eax,%edx
+  802068:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80206b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802070:	83 fa 01             	cmp    $0x1,%edx
+  802073:	74 05                	je     80207a <devsock_close+0x24>
+}
+  802075:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802078:	c9                   	leave
+  802079:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+  80207d:	ff 73 0c             	push   0xc(%ebx)
+  802080:	e8 b7 02 00 00       	call   80233c <nsipc_close>
+  802085:	83 c4 10             	add    $0x10,%esp
+  802088:	eb eb                	jmp    802075 <devsock_close+0x1f>
+
+0080208a <devsock_write>:
+{
+  80208a:	55                   	push   %ebp
+  80208b:	89 e5                	mov    %esp,%ebp
+  80208d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802090:	6a 00                	push   $0x0
+  802092:	ff 75 10             	push   0x10(%ebp)
+  802095:	ff 75 0c             	push   0xc(%ebp)
+  802098:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209b:	ff 70 0c             	push   0xc(%eax)
+  80209e:	e8 79 03 00 00       	call   80241c <nsipc_send>
+}
+  8020a3:	c9                   	leave
+  8020a4:	c3                   	ret
+
+008020a5 <devsock_read>:
+{
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8020ab:	6a 00                	push   $0x0
+  8020ad:	ff 75 10             	push   0x10(%ebp)
+  8020b0:	ff 75 0c             	push   0xc(%ebp)
+  8020b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b6:	ff 70 0c             	push   0xc(%eax)
+  8020b9:	e8 ef 02 00 00       	call   8023ad <nsipc_recv>
+}
+  8020be:	c9                   	leave
+  8020bf:	c3                   	ret
+
+008020c0 <fd2sockid>:
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8020c6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020c9:	52                   	push   %edx
+  8020ca:	50                   	push   %eax
+  8020cb:	e8 7e f7 ff ff       	call   80184e <fd_lookup>
+  8020d0:	83 c4 10             	add    $0x10,%esp
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 10                	js     8020e7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020da:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8020e0:	39 08                	cmp    %ecx,(%eax)
+  8020e2:	75 05                	jne    8020e9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020e4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020e7:	c9                   	leave
+  8020e8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020ee:	eb f7                	jmp    8020e7 <fd2sockid+0x27>
+
+008020f0 <alloc_sockfd>:
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	56                   	push   %esi
+  8020f4:	53                   	push   %ebx
+  8020f5:	83 ec 1c             	sub    $0x1c,%esp
+  8020f8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020fd:	50                   	push   %eax
+  8020fe:	e8 f5 f6 ff ff       	call   8017f8 <fd_alloc>
+  802103:	89 c3                	mov    %eax,%ebx
+  802105:	83 c4 10             	add    $0x10,%esp
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	78 43                	js     80214f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80210c:	83 ec 04             	sub    $0x4,%esp
+  80210f:	68 07 04 00 00       	push   $0x407
+  802114:	ff 75 f4             	push   -0xc(%ebp)
+  802117:	6a 00                	push   $0x0
+  802119:	e8 15 ec ff ff       	call   800d33 <sys_page_alloc>
+  80211e:	89 c3                	mov    %eax,%ebx
+  802120:	83 c4 10             	add    $0x10,%esp
+  802123:	85 c0                	test   %eax,%eax
+  802125:	78 28                	js     80214f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802127:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80212a:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802130:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802132:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802135:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80213c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80213f:	83 ec 0c             	sub    $0xc,%esp
+  802142:	50                   	push   %eax
+  802143:	e8 89 f6 ff ff       	call   8017d1 <fd2num>
+  802148:	89 c3                	mov    %eax,%ebx
+  80214a:	83 c4 10             	add    $0x10,%esp
+  80214d:	eb 0c                	jmp    80215b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80214f:	83 ec 0c             	sub    $0xc,%esp
+  802152:	56                   	push   %esi
+  802153:	e8 e4 01 00 00       	call   80233c <nsipc_close>
+		return r;
+  802158:	83 c4 10             	add    $0x10,%esp
+}
+  80215b:	89 d8                	mov    %ebx,%eax
+  80215d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802160:	5b                   	pop    %ebx
+  802161:	5e                   	pop    %esi
+  802162:	5d                   	pop    %ebp
+  802163:	c3                   	ret
+
+00802164 <accept>:
+{
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80216a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216d:	e8 4e ff ff ff       	call   8020c0 <fd2sockid>
+  802172:	85 c0                	test   %eax,%eax
+  802174:	78 1b                	js     802191 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802176:	83 ec 04             	sub    $0x4,%esp
+  802179:	ff 75 10             	push   0x10(%ebp)
+  80217c:	ff 75 0c             	push   0xc(%ebp)
+  80217f:	50                   	push   %eax
+  802180:	e8 0e 01 00 00       	call   802293 <nsipc_accept>
+  802185:	83 c4 10             	add    $0x10,%esp
+  802188:	85 c0                	test   %eax,%eax
+  80218a:	78 05                	js     802191 <accept+0x2d>
+	return alloc_sockfd(r);
+  80218c:	e8 5f ff ff ff       	call   8020f0 <alloc_sockfd>
+}
+  802191:	c9                   	leave
+  802192:	c3                   	ret
+
+00802193 <bind>:
+{
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802199:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219c:	e8 1f ff ff ff       	call   8020c0 <fd2sockid>
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 12                	js     8021b7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8021a5:	83 ec 04             	sub    $0x4,%esp
+  8021a8:	ff 75 10             	push   0x10(%ebp)
+  8021ab:	ff 75 0c             	push   0xc(%ebp)
+  8021ae:	50                   	push   %eax
+  8021af:	e8 31 01 00 00       	call   8022e5 <nsipc_bind>
+  8021b4:	83 c4 10             	add    $0x10,%esp
+}
+  8021b7:	c9                   	leave
+  8021b8:	c3                   	ret
+
+008021b9 <shutdown>:
+{
+  8021b9:	55                   	push   %ebp
+  8021ba:	89 e5                	mov    %esp,%ebp
+  8021bc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c2:	e8 f9 fe ff ff       	call   8020c0 <fd2sockid>
+  8021c7:	85 c0                	test   %eax,%eax
+  8021c9:	78 0f                	js     8021da <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8021cb:	83 ec 08             	sub    $0x8,%esp
+  8021ce:	ff 75 0c             	push   0xc(%ebp)
+  8021d1:	50                   	push   %eax
+  8021d2:	e8 43 01 00 00       	call   80231a <nsipc_shutdown>
+  8021d7:	83 c4 10             	add    $0x10,%esp
+}
+  8021da:	c9                   	leave
+  8021db:	c3                   	ret
+
+008021dc <connect>:
+{
+  8021dc:	55                   	push   %ebp
+  8021dd:	89 e5                	mov    %esp,%ebp
+  8021df:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e5:	e8 d6 fe ff ff       	call   8020c0 <fd2sockid>
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 12                	js     802200 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021ee:	83 ec 04             	sub    $0x4,%esp
+  8021f1:	ff 75 10             	push   0x10(%ebp)
+  8021f4:	ff 75 0c             	push   0xc(%ebp)
+  8021f7:	50                   	push   %eax
+  8021f8:	e8 59 01 00 00       	call   802356 <nsipc_connect>
+  8021fd:	83 c4 10             	add    $0x10,%esp
+}
+  802200:	c9                   	leave
+  802201:	c3                   	ret
+
+00802202 <listen>:
+{
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802208:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220b:	e8 b0 fe ff ff       	call   8020c0 <fd2sockid>
+  802210:	85 c0                	test   %eax,%eax
+  802212:	78 0f                	js     802223 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802214:	83 ec 08             	sub    $0x8,%esp
+  802217:	ff 75 0c             	push   0xc(%ebp)
+  80221a:	50                   	push   %eax
+  80221b:	e8 6b 01 00 00       	call   80238b <nsipc_listen>
+  802220:	83 c4 10             	add    $0x10,%esp
+}
+  802223:	c9                   	leave
+  802224:	c3                   	ret
+
+00802225 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802225:	55                   	push   %ebp
+  802226:	89 e5                	mov    %esp,%ebp
+  802228:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80222b:	ff 75 10             	push   0x10(%ebp)
+  80222e:	ff 75 0c             	push   0xc(%ebp)
+  802231:	ff 75 08             	push   0x8(%ebp)
+  802234:	e8 41 02 00 00       	call   80247a <nsipc_socket>
+  802239:	83 c4 10             	add    $0x10,%esp
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	78 05                	js     802245 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802240:	e8 ab fe ff ff       	call   8020f0 <alloc_sockfd>
+}
+  802245:	c9                   	leave
+  802246:	c3                   	ret
+
+00802247 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802247:	55                   	push   %ebp
+  802248:	89 e5                	mov    %esp,%ebp
+  80224a:	53                   	push   %ebx
+  80224b:	83 ec 04             	sub    $0x4,%esp
+  80224e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802250:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802257:	74 26                	je     80227f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802259:	6a 07                	push   $0x7
+  80225b:	68 00 70 80 00       	push   $0x807000
+  802260:	53                   	push   %ebx
+  802261:	ff 35 04 50 80 00    	push   0x805004
+  802267:	e8 b2 08 00 00       	call   802b1e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80226c:	83 c4 0c             	add    $0xc,%esp
+  80226f:	6a 00                	push   $0x0
+  802271:	6a 00                	push   $0x0
+  802273:	6a 00                	push   $0x0
+  802275:	e8 8c 08 00 00       	call   802b06 <ipc_recv>
+}
+  80227a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80227d:	c9                   	leave
+  80227e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80227f:	83 ec 0c             	sub    $0xc,%esp
+  802282:	6a 02                	push   $0x2
+  802284:	e8 e9 08 00 00       	call   802b72 <ipc_find_env>
+  802289:	a3 04 50 80 00       	mov    %eax,0x805004
+  80228e:	83 c4 10             	add    $0x10,%esp
+  802291:	eb c6                	jmp    802259 <nsipc+0x12>
+
+00802293 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802293:	55                   	push   %ebp
+  802294:	89 e5                	mov    %esp,%ebp
+  802296:	56                   	push   %esi
+  802297:	53                   	push   %ebx
+  802298:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80229b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8022a3:	8b 06                	mov    (%esi),%eax
+  8022a5:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8022aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022af:	e8 93 ff ff ff       	call   802247 <nsipc>
+  8022b4:	89 c3                	mov    %eax,%ebx
+  8022b6:	85 c0                	test   %eax,%eax
+  8022b8:	79 09                	jns    8022c3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8022ba:	89 d8                	mov    %ebx,%eax
+  8022bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022bf:	5b                   	pop    %ebx
+  8022c0:	5e                   	pop    %esi
+  8022c1:	5d                   	pop    %ebp
+  8022c2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8022c3:	83 ec 04             	sub    $0x4,%esp
+  8022c6:	ff 35 10 70 80 00    	push   0x807010
+  8022cc:	68 00 70 80 00       	push   $0x807000
+  8022d1:	ff 75 0c             	push   0xc(%ebp)
+  8022d4:	e8 e8 e6 ff ff       	call   8009c1 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022d9:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022de:	89 06                	mov    %eax,(%esi)
+  8022e0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022e3:	eb d5                	jmp    8022ba <nsipc_accept+0x27>
+
+008022e5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022e5:	55                   	push   %ebp
+  8022e6:	89 e5                	mov    %esp,%ebp
+  8022e8:	53                   	push   %ebx
+  8022e9:	83 ec 08             	sub    $0x8,%esp
+  8022ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f2:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022f7:	53                   	push   %ebx
+  8022f8:	ff 75 0c             	push   0xc(%ebp)
+  8022fb:	68 04 70 80 00       	push   $0x807004
+  802300:	e8 bc e6 ff ff       	call   8009c1 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802305:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80230b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802310:	e8 32 ff ff ff       	call   802247 <nsipc>
+}
+  802315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802318:	c9                   	leave
+  802319:	c3                   	ret
+
+0080231a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80231a:	55                   	push   %ebp
+  80231b:	89 e5                	mov    %esp,%ebp
+  80231d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802320:	8b 45 08             	mov    0x8(%ebp),%eax
+  802323:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802328:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80232b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802330:	b8 03 00 00 00       	mov    $0x3,%eax
+  802335:	e8 0d ff ff ff       	call   802247 <nsipc>
+}
+  80233a:	c9                   	leave
+  80233b:	c3                   	ret
+
+0080233c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80233c:	55                   	push   %ebp
+  80233d:	89 e5                	mov    %esp,%ebp
+  80233f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802342:	8b 45 08             	mov    0x8(%ebp),%eax
+  802345:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80234a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80234f:	e8 f3 fe ff ff       	call   802247 <nsipc>
+}
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+00802356 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802356:	55                   	push   %ebp
+  802357:	89 e5                	mov    %esp,%ebp
+  802359:	53                   	push   %ebx
+  80235a:	83 ec 08             	sub    $0x8,%esp
+  80235d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802360:	8b 45 08             	mov    0x8(%ebp),%eax
+  802363:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802368:	53                   	push   %ebx
+  802369:	ff 75 0c             	push   0xc(%ebp)
+  80236c:	68 04 70 80 00       	push   $0x807004
+  802371:	e8 4b e6 ff ff       	call   8009c1 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802376:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80237c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802381:	e8 c1 fe ff ff       	call   802247 <nsipc>
+}
+  802386:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802389:	c9                   	leave
+  80238a:	c3                   	ret
+
+0080238b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80238b:	55                   	push   %ebp
+  80238c:	89 e5                	mov    %esp,%ebp
+  80238e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802391:	8b 45 08             	mov    0x8(%ebp),%eax
+  802394:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802399:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80239c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8023a1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023a6:	e8 9c fe ff ff       	call   802247 <nsipc>
+}
+  8023ab:	c9                   	leave
+  8023ac:	c3                   	ret
+
+008023ad <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	56                   	push   %esi
+  8023b1:	53                   	push   %ebx
+  8023b2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8023b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8023bd:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8023c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023c6:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023cb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023d0:	e8 72 fe ff ff       	call   802247 <nsipc>
+  8023d5:	89 c3                	mov    %eax,%ebx
+  8023d7:	85 c0                	test   %eax,%eax
+  8023d9:	78 22                	js     8023fd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023db:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023e0:	39 c6                	cmp    %eax,%esi
+  8023e2:	0f 4e c6             	cmovle %esi,%eax
+  8023e5:	39 c3                	cmp    %eax,%ebx
+  8023e7:	7f 1d                	jg     802406 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023e9:	83 ec 04             	sub    $0x4,%esp
+  8023ec:	53                   	push   %ebx
+  8023ed:	68 00 70 80 00       	push   $0x807000
+  8023f2:	ff 75 0c             	push   0xc(%ebp)
+  8023f5:	e8 c7 e5 ff ff       	call   8009c1 <memmove>
+  8023fa:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023fd:	89 d8                	mov    %ebx,%eax
+  8023ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802402:	5b                   	pop    %ebx
+  802403:	5e                   	pop    %esi
+  802404:	5d                   	pop    %ebp
+  802405:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802406:	68 67 30 80 00       	push   $0x803067
+  80240b:	68 2f 30 80 00       	push   $0x80302f
+  802410:	6a 62                	push   $0x62
+  802412:	68 7c 30 80 00       	push   $0x80307c
+  802417:	e8 fc dc ff ff       	call   800118 <_panic>
+
+0080241c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80241c:	55                   	push   %ebp
+  80241d:	89 e5                	mov    %esp,%ebp
+  80241f:	53                   	push   %ebx
+  802420:	83 ec 04             	sub    $0x4,%esp
+  802423:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802426:	8b 45 08             	mov    0x8(%ebp),%eax
+  802429:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80242e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802434:	7f 2e                	jg     802464 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802436:	83 ec 04             	sub    $0x4,%esp
+  802439:	53                   	push   %ebx
+  80243a:	ff 75 0c             	push   0xc(%ebp)
+  80243d:	68 0c 70 80 00       	push   $0x80700c
+  802442:	e8 7a e5 ff ff       	call   8009c1 <memmove>
+	nsipcbuf.send.req_size = size;
+  802447:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80244d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802450:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802455:	b8 08 00 00 00       	mov    $0x8,%eax
+  80245a:	e8 e8 fd ff ff       	call   802247 <nsipc>
+}
+  80245f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802462:	c9                   	leave
+  802463:	c3                   	ret
+	assert(size < 1600);
+  802464:	68 88 30 80 00       	push   $0x803088
+  802469:	68 2f 30 80 00       	push   $0x80302f
+  80246e:	6a 6d                	push   $0x6d
+  802470:	68 7c 30 80 00       	push   $0x80307c
+  802475:	e8 9e dc ff ff       	call   800118 <_panic>
+
+0080247a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80247a:	55                   	push   %ebp
+  80247b:	89 e5                	mov    %esp,%ebp
+  80247d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802480:	8b 45 08             	mov    0x8(%ebp),%eax
+  802483:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802488:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80248b:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802490:	8b 45 10             	mov    0x10(%ebp),%eax
+  802493:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802498:	b8 09 00 00 00       	mov    $0x9,%eax
+  80249d:	e8 a5 fd ff ff       	call   802247 <nsipc>
+}
+  8024a2:	c9                   	leave
+  8024a3:	c3                   	ret
+
+008024a4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024a4:	55                   	push   %ebp
+  8024a5:	89 e5                	mov    %esp,%ebp
+  8024a7:	56                   	push   %esi
+  8024a8:	53                   	push   %ebx
+  8024a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8024ac:	83 ec 0c             	sub    $0xc,%esp
+  8024af:	ff 75 08             	push   0x8(%ebp)
+  8024b2:	e8 2a f3 ff ff       	call   8017e1 <fd2data>
+  8024b7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8024b9:	83 c4 08             	add    $0x8,%esp
+  8024bc:	68 94 30 80 00       	push   $0x803094
+  8024c1:	53                   	push   %ebx
+  8024c2:	e8 74 e3 ff ff       	call   80083b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8024c7:	8b 46 04             	mov    0x4(%esi),%eax
+  8024ca:	2b 06                	sub    (%esi),%eax
+  8024cc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024d2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024d9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024dc:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024e3:	40 80 00 
+	return 0;
+}
+  8024e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024ee:	5b                   	pop    %ebx
+  8024ef:	5e                   	pop    %esi
+  8024f0:	5d                   	pop    %ebp
+  8024f1:	c3                   	ret
+
+008024f2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	53                   	push   %ebx
+  8024f6:	83 ec 0c             	sub    $0xc,%esp
+  8024f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024fc:	53                   	push   %ebx
+  8024fd:	6a 00                	push   $0x0
+  8024ff:	e8 0a e9 ff ff       	call   800e0e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802504:	89 1c 24             	mov    %ebx,(%esp)
+  802507:	e8 d5 f2 ff ff       	call   8017e1 <fd2data>
+  80250c:	83 c4 08             	add    $0x8,%esp
+  80250f:	50                   	push   %eax
+  802510:	6a 00                	push   $0x0
+  802512:	e8 f7 e8 ff ff       	call   800e0e <sys_page_unmap>
+}
+  802517:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80251a:	c9                   	leave
+  80251b:	c3                   	ret
+
+0080251c <_pipeisclosed>:
+{
+  80251c:	55                   	push   %ebp
+  80251d:	89 e5                	mov    %esp,%ebp
+  80251f:	57                   	push   %edi
+  802520:	56                   	push   %esi
+  802521:	53                   	push   %ebx
+  802522:	83 ec 1c             	sub    $0x1c,%esp
+  802525:	89 c7                	mov    %eax,%edi
+  802527:	89 d6                	mov    %edx,%esi
+  802529:	eb 3c                	jmp    802567 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  80252b:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  80252e:	83 ec 0c             	sub    $0xc,%esp
+  802531:	57                   	push   %edi
+  802532:	e8 7a 06 00 00       	call   802bb1 <pageref>
+  802537:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80253a:	89 34 24             	mov    %esi,(%esp)
+  80253d:	e8 6f 06 00 00       	call   802bb1 <pageref>
+  802542:	89 c2                	mov    %eax,%edx
+  802544:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802546:	05 00 00 00 20       	add    $0x20000000,%eax
+  80254b:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80254e:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802554:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802559:	76 31                	jbe    80258c <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  80255b:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80255e:	39 c3                	cmp    %eax,%ebx
+  802560:	74 76                	je     8025d8 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802562:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802565:	74 36                	je     80259d <_pipeisclosed+0x81>
+  802567:	89 e0                	mov    %esp,%eax
+  802569:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80256e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802574:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802579:	77 b0                	ja     80252b <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80257b:	c1 e8 10             	shr    $0x10,%eax
+  80257e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802584:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80258a:	eb 9f                	jmp    80252b <_pipeisclosed+0xf>
+  80258c:	c1 e8 10             	shr    $0x10,%eax
+  80258f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802595:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80259b:	eb be                	jmp    80255b <_pipeisclosed+0x3f>
+  80259d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80259f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025a4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025aa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025af:	76 16                	jbe    8025c7 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8025b1:	8b 42 58             	mov    0x58(%edx),%eax
+  8025b4:	6a 01                	push   $0x1
+  8025b6:	50                   	push   %eax
+  8025b7:	53                   	push   %ebx
+  8025b8:	68 9b 30 80 00       	push   $0x80309b
+  8025bd:	e8 31 dc ff ff       	call   8001f3 <cprintf>
+  8025c2:	83 c4 10             	add    $0x10,%esp
+  8025c5:	eb a0                	jmp    802567 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025c7:	c1 e8 10             	shr    $0x10,%eax
+  8025ca:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025d0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025d6:	eb d9                	jmp    8025b1 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8025d8:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025db:	0f 94 c0             	sete   %al
+  8025de:	0f b6 c0             	movzbl %al,%eax
+}
+  8025e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e4:	5b                   	pop    %ebx
+  8025e5:	5e                   	pop    %esi
+  8025e6:	5f                   	pop    %edi
+  8025e7:	5d                   	pop    %ebp
+  8025e8:	c3                   	ret
+
+008025e9 <devpipe_write>:
+{
+  8025e9:	55                   	push   %ebp
+  8025ea:	89 e5                	mov    %esp,%ebp
+  8025ec:	57                   	push   %edi
+  8025ed:	56                   	push   %esi
+  8025ee:	53                   	push   %ebx
+  8025ef:	83 ec 28             	sub    $0x28,%esp
+  8025f2:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025f5:	56                   	push   %esi
+  8025f6:	e8 e6 f1 ff ff       	call   8017e1 <fd2data>
+  8025fb:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025fd:	83 c4 10             	add    $0x10,%esp
+  802600:	bf 00 00 00 00       	mov    $0x0,%edi
+  802605:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802608:	75 09                	jne    802613 <devpipe_write+0x2a>
+	return i;
+  80260a:	89 f8                	mov    %edi,%eax
+  80260c:	eb 23                	jmp    802631 <devpipe_write+0x48>
+			sys_yield();
+  80260e:	e8 da e6 ff ff       	call   800ced <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802613:	8b 43 04             	mov    0x4(%ebx),%eax
+  802616:	8b 0b                	mov    (%ebx),%ecx
+  802618:	8d 51 20             	lea    0x20(%ecx),%edx
+  80261b:	39 d0                	cmp    %edx,%eax
+  80261d:	72 1a                	jb     802639 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80261f:	89 da                	mov    %ebx,%edx
+  802621:	89 f0                	mov    %esi,%eax
+  802623:	e8 f4 fe ff ff       	call   80251c <_pipeisclosed>
+  802628:	85 c0                	test   %eax,%eax
+  80262a:	74 e2                	je     80260e <devpipe_write+0x25>
+				return 0;
+  80262c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802631:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802634:	5b                   	pop    %ebx
+  802635:	5e                   	pop    %esi
+  802636:	5f                   	pop    %edi
+  802637:	5d                   	pop    %ebp
+  802638:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802639:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80263c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802640:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802643:	89 c2                	mov    %eax,%edx
+  802645:	c1 fa 1f             	sar    $0x1f,%edx
+  802648:	89 d1                	mov    %edx,%ecx
+  80264a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80264d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802650:	83 e2 1f             	and    $0x1f,%edx
+  802653:	29 ca                	sub    %ecx,%edx
+  802655:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802659:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80265d:	83 c0 01             	add    $0x1,%eax
+  802660:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802663:	83 c7 01             	add    $0x1,%edi
+  802666:	eb 9d                	jmp    802605 <devpipe_write+0x1c>
+
+00802668 <devpipe_read>:
+{
+  802668:	55                   	push   %ebp
+  802669:	89 e5                	mov    %esp,%ebp
+  80266b:	57                   	push   %edi
+  80266c:	56                   	push   %esi
+  80266d:	53                   	push   %ebx
+  80266e:	83 ec 18             	sub    $0x18,%esp
+  802671:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802674:	57                   	push   %edi
+  802675:	e8 67 f1 ff ff       	call   8017e1 <fd2data>
+  80267a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80267c:	83 c4 10             	add    $0x10,%esp
+  80267f:	be 00 00 00 00       	mov    $0x0,%esi
+  802684:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802687:	75 13                	jne    80269c <devpipe_read+0x34>
+	return i;
+  802689:	89 f0                	mov    %esi,%eax
+  80268b:	eb 02                	jmp    80268f <devpipe_read+0x27>
+				return i;
+  80268d:	89 f0                	mov    %esi,%eax
+}
+  80268f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802692:	5b                   	pop    %ebx
+  802693:	5e                   	pop    %esi
+  802694:	5f                   	pop    %edi
+  802695:	5d                   	pop    %ebp
+  802696:	c3                   	ret
+			sys_yield();
+  802697:	e8 51 e6 ff ff       	call   800ced <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80269c:	8b 03                	mov    (%ebx),%eax
+  80269e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8026a1:	75 18                	jne    8026bb <devpipe_read+0x53>
+			if (i > 0)
+  8026a3:	85 f6                	test   %esi,%esi
+  8026a5:	75 e6                	jne    80268d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8026a7:	89 da                	mov    %ebx,%edx
+  8026a9:	89 f8                	mov    %edi,%eax
+  8026ab:	e8 6c fe ff ff       	call   80251c <_pipeisclosed>
+  8026b0:	85 c0                	test   %eax,%eax
+  8026b2:	74 e3                	je     802697 <devpipe_read+0x2f>
+				return 0;
+  8026b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b9:	eb d4                	jmp    80268f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026bb:	99                   	cltd
+  8026bc:	c1 ea 1b             	shr    $0x1b,%edx
+  8026bf:	01 d0                	add    %edx,%eax
+  8026c1:	83 e0 1f             	and    $0x1f,%eax
+  8026c4:	29 d0                	sub    %edx,%eax
+  8026c6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8026cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026ce:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8026d1:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026d4:	83 c6 01             	add    $0x1,%esi
+  8026d7:	eb ab                	jmp    802684 <devpipe_read+0x1c>
+
+008026d9 <pipe>:
+{
+  8026d9:	55                   	push   %ebp
+  8026da:	89 e5                	mov    %esp,%ebp
+  8026dc:	56                   	push   %esi
+  8026dd:	53                   	push   %ebx
+  8026de:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026e4:	50                   	push   %eax
+  8026e5:	e8 0e f1 ff ff       	call   8017f8 <fd_alloc>
+  8026ea:	89 c3                	mov    %eax,%ebx
+  8026ec:	83 c4 10             	add    $0x10,%esp
+  8026ef:	85 c0                	test   %eax,%eax
+  8026f1:	0f 88 23 01 00 00    	js     80281a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f7:	83 ec 04             	sub    $0x4,%esp
+  8026fa:	68 07 04 00 00       	push   $0x407
+  8026ff:	ff 75 f4             	push   -0xc(%ebp)
+  802702:	6a 00                	push   $0x0
+  802704:	e8 2a e6 ff ff       	call   800d33 <sys_page_alloc>
+  802709:	89 c3                	mov    %eax,%ebx
+  80270b:	83 c4 10             	add    $0x10,%esp
+  80270e:	85 c0                	test   %eax,%eax
+  802710:	0f 88 04 01 00 00    	js     80281a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802716:	83 ec 0c             	sub    $0xc,%esp
+  802719:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80271c:	50                   	push   %eax
+  80271d:	e8 d6 f0 ff ff       	call   8017f8 <fd_alloc>
+  802722:	89 c3                	mov    %eax,%ebx
+  802724:	83 c4 10             	add    $0x10,%esp
+  802727:	85 c0                	test   %eax,%eax
+  802729:	0f 88 db 00 00 00    	js     80280a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80272f:	83 ec 04             	sub    $0x4,%esp
+  802732:	68 07 04 00 00       	push   $0x407
+  802737:	ff 75 f0             	push   -0x10(%ebp)
+  80273a:	6a 00                	push   $0x0
+  80273c:	e8 f2 e5 ff ff       	call   800d33 <sys_page_alloc>
+  802741:	89 c3                	mov    %eax,%ebx
+  802743:	83 c4 10             	add    $0x10,%esp
+  802746:	85 c0                	test   %eax,%eax
+  802748:	0f 88 bc 00 00 00    	js     80280a <pipe+0x131>
+	va = fd2data(fd0);
+  80274e:	83 ec 0c             	sub    $0xc,%esp
+  802751:	ff 75 f4             	push   -0xc(%ebp)
+  802754:	e8 88 f0 ff ff       	call   8017e1 <fd2data>
+  802759:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80275b:	83 c4 0c             	add    $0xc,%esp
+  80275e:	68 07 04 00 00       	push   $0x407
+  802763:	50                   	push   %eax
+  802764:	6a 00                	push   $0x0
+  802766:	e8 c8 e5 ff ff       	call   800d33 <sys_page_alloc>
+  80276b:	89 c3                	mov    %eax,%ebx
+  80276d:	83 c4 10             	add    $0x10,%esp
+  802770:	85 c0                	test   %eax,%eax
+  802772:	0f 88 82 00 00 00    	js     8027fa <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802778:	83 ec 0c             	sub    $0xc,%esp
+  80277b:	ff 75 f0             	push   -0x10(%ebp)
+  80277e:	e8 5e f0 ff ff       	call   8017e1 <fd2data>
+  802783:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80278a:	50                   	push   %eax
+  80278b:	6a 00                	push   $0x0
+  80278d:	56                   	push   %esi
+  80278e:	6a 00                	push   $0x0
+  802790:	e8 0b e6 ff ff       	call   800da0 <sys_page_map>
+  802795:	89 c3                	mov    %eax,%ebx
+  802797:	83 c4 20             	add    $0x20,%esp
+  80279a:	85 c0                	test   %eax,%eax
+  80279c:	78 4e                	js     8027ec <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80279e:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8027a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027a6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8027a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027ab:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8027b2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8027b5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8027b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8027ba:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8027c1:	83 ec 0c             	sub    $0xc,%esp
+  8027c4:	ff 75 f4             	push   -0xc(%ebp)
+  8027c7:	e8 05 f0 ff ff       	call   8017d1 <fd2num>
+  8027cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027cf:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027d1:	83 c4 04             	add    $0x4,%esp
+  8027d4:	ff 75 f0             	push   -0x10(%ebp)
+  8027d7:	e8 f5 ef ff ff       	call   8017d1 <fd2num>
+  8027dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027df:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027e2:	83 c4 10             	add    $0x10,%esp
+  8027e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027ea:	eb 2e                	jmp    80281a <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027ec:	83 ec 08             	sub    $0x8,%esp
+  8027ef:	56                   	push   %esi
+  8027f0:	6a 00                	push   $0x0
+  8027f2:	e8 17 e6 ff ff       	call   800e0e <sys_page_unmap>
+  8027f7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027fa:	83 ec 08             	sub    $0x8,%esp
+  8027fd:	ff 75 f0             	push   -0x10(%ebp)
+  802800:	6a 00                	push   $0x0
+  802802:	e8 07 e6 ff ff       	call   800e0e <sys_page_unmap>
+  802807:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80280a:	83 ec 08             	sub    $0x8,%esp
+  80280d:	ff 75 f4             	push   -0xc(%ebp)
+  802810:	6a 00                	push   $0x0
+  802812:	e8 f7 e5 ff ff       	call   800e0e <sys_page_unmap>
+  802817:	83 c4 10             	add    $0x10,%esp
+}
+  80281a:	89 d8                	mov    %ebx,%eax
+  80281c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80281f:	5b                   	pop    %ebx
+  802820:	5e                   	pop    %esi
+  802821:	5d                   	pop    %ebp
+  802822:	c3                   	ret
+
+00802823 <pipeisclosed>:
+{
+  802823:	55                   	push   %ebp
+  802824:	89 e5                	mov    %esp,%ebp
+  802826:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802829:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80282c:	50                   	push   %eax
+  80282d:	ff 75 08             	push   0x8(%ebp)
+  802830:	e8 19 f0 ff ff       	call   80184e <fd_lookup>
+  802835:	83 c4 10             	add    $0x10,%esp
+  802838:	85 c0                	test   %eax,%eax
+  80283a:	78 18                	js     802854 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80283c:	83 ec 0c             	sub    $0xc,%esp
+  80283f:	ff 75 f4             	push   -0xc(%ebp)
+  802842:	e8 9a ef ff ff       	call   8017e1 <fd2data>
+  802847:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802849:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80284c:	e8 cb fc ff ff       	call   80251c <_pipeisclosed>
+  802851:	83 c4 10             	add    $0x10,%esp
+}
+  802854:	c9                   	leave
+  802855:	c3                   	ret
+
+00802856 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285b:	c3                   	ret
+
+0080285c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80285c:	55                   	push   %ebp
+  80285d:	89 e5                	mov    %esp,%ebp
+  80285f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802862:	68 b3 30 80 00       	push   $0x8030b3
+  802867:	ff 75 0c             	push   0xc(%ebp)
+  80286a:	e8 cc df ff ff       	call   80083b <strcpy>
+	return 0;
+}
+  80286f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802874:	c9                   	leave
+  802875:	c3                   	ret
+
+00802876 <devcons_write>:
+{
+  802876:	55                   	push   %ebp
+  802877:	89 e5                	mov    %esp,%ebp
+  802879:	57                   	push   %edi
+  80287a:	56                   	push   %esi
+  80287b:	53                   	push   %ebx
+  80287c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802882:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802887:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80288d:	eb 2e                	jmp    8028bd <devcons_write+0x47>
+		m = n - tot;
+  80288f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802892:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802894:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802899:	39 c3                	cmp    %eax,%ebx
+  80289b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80289e:	83 ec 04             	sub    $0x4,%esp
+  8028a1:	53                   	push   %ebx
+  8028a2:	89 f0                	mov    %esi,%eax
+  8028a4:	03 45 0c             	add    0xc(%ebp),%eax
+  8028a7:	50                   	push   %eax
+  8028a8:	57                   	push   %edi
+  8028a9:	e8 13 e1 ff ff       	call   8009c1 <memmove>
+		sys_cputs(buf, m);
+  8028ae:	83 c4 08             	add    $0x8,%esp
+  8028b1:	53                   	push   %ebx
+  8028b2:	57                   	push   %edi
+  8028b3:	e8 fc e2 ff ff       	call   800bb4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028b8:	01 de                	add    %ebx,%esi
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8028c0:	72 cd                	jb     80288f <devcons_write+0x19>
+}
+  8028c2:	89 f0                	mov    %esi,%eax
+  8028c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c7:	5b                   	pop    %ebx
+  8028c8:	5e                   	pop    %esi
+  8028c9:	5f                   	pop    %edi
+  8028ca:	5d                   	pop    %ebp
+  8028cb:	c3                   	ret
+
+008028cc <devcons_read>:
+{
+  8028cc:	55                   	push   %ebp
+  8028cd:	89 e5                	mov    %esp,%ebp
+  8028cf:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8028d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028db:	75 07                	jne    8028e4 <devcons_read+0x18>
+  8028dd:	eb 1f                	jmp    8028fe <devcons_read+0x32>
+		sys_yield();
+  8028df:	e8 09 e4 ff ff       	call   800ced <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028e4:	e8 0f e3 ff ff       	call   800bf8 <sys_cgetc>
+  8028e9:	85 c0                	test   %eax,%eax
+  8028eb:	74 f2                	je     8028df <devcons_read+0x13>
+	if (c < 0)
+  8028ed:	78 0f                	js     8028fe <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028ef:	83 f8 04             	cmp    $0x4,%eax
+  8028f2:	74 0c                	je     802900 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028f7:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028f9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028fe:	c9                   	leave
+  8028ff:	c3                   	ret
+		return 0;
+  802900:	b8 00 00 00 00       	mov    $0x0,%eax
+  802905:	eb f7                	jmp    8028fe <devcons_read+0x32>
+
+00802907 <cputchar>:
+{
+  802907:	55                   	push   %ebp
+  802908:	89 e5                	mov    %esp,%ebp
+  80290a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80290d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802910:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802913:	6a 01                	push   $0x1
+  802915:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802918:	50                   	push   %eax
+  802919:	e8 96 e2 ff ff       	call   800bb4 <sys_cputs>
+}
+  80291e:	83 c4 10             	add    $0x10,%esp
+  802921:	c9                   	leave
+  802922:	c3                   	ret
+
+00802923 <getchar>:
+{
+  802923:	55                   	push   %ebp
+  802924:	89 e5                	mov    %esp,%ebp
+  802926:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802929:	6a 01                	push   $0x1
+  80292b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80292e:	50                   	push   %eax
+  80292f:	6a 00                	push   $0x0
+  802931:	e8 9e f1 ff ff       	call   801ad4 <read>
+	if (r < 0)
+  802936:	83 c4 10             	add    $0x10,%esp
+  802939:	85 c0                	test   %eax,%eax
+  80293b:	78 06                	js     802943 <getchar+0x20>
+	if (r < 1)
+  80293d:	74 06                	je     802945 <getchar+0x22>
+	return c;
+  80293f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802943:	c9                   	leave
+  802944:	c3                   	ret
+		return -E_EOF;
+  802945:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80294a:	eb f7                	jmp    802943 <getchar+0x20>
+
+0080294c <iscons>:
+{
+  80294c:	55                   	push   %ebp
+  80294d:	89 e5                	mov    %esp,%ebp
+  80294f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802952:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802955:	50                   	push   %eax
+  802956:	ff 75 08             	push   0x8(%ebp)
+  802959:	e8 f0 ee ff ff       	call   80184e <fd_lookup>
+  80295e:	83 c4 10             	add    $0x10,%esp
+  802961:	85 c0                	test   %eax,%eax
+  802963:	78 11                	js     802976 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802965:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802968:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80296e:	39 10                	cmp    %edx,(%eax)
+  802970:	0f 94 c0             	sete   %al
+  802973:	0f b6 c0             	movzbl %al,%eax
+}
+  802976:	c9                   	leave
+  802977:	c3                   	ret
+
+00802978 <opencons>:
+{
+  802978:	55                   	push   %ebp
+  802979:	89 e5                	mov    %esp,%ebp
+  80297b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80297e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802981:	50                   	push   %eax
+  802982:	e8 71 ee ff ff       	call   8017f8 <fd_alloc>
+  802987:	83 c4 10             	add    $0x10,%esp
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	78 3a                	js     8029c8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80298e:	83 ec 04             	sub    $0x4,%esp
+  802991:	68 07 04 00 00       	push   $0x407
+  802996:	ff 75 f4             	push   -0xc(%ebp)
+  802999:	6a 00                	push   $0x0
+  80299b:	e8 93 e3 ff ff       	call   800d33 <sys_page_alloc>
+  8029a0:	83 c4 10             	add    $0x10,%esp
+  8029a3:	85 c0                	test   %eax,%eax
+  8029a5:	78 21                	js     8029c8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029aa:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8029b0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029b5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029bc:	83 ec 0c             	sub    $0xc,%esp
+  8029bf:	50                   	push   %eax
+  8029c0:	e8 0c ee ff ff       	call   8017d1 <fd2num>
+  8029c5:	83 c4 10             	add    $0x10,%esp
+}
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+008029ca <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8029ca:	55                   	push   %ebp
+  8029cb:	89 e5                	mov    %esp,%ebp
+  8029cd:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8029d0:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8029d7:	74 0a                	je     8029e3 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8029d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029dc:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8029e3:	83 ec 04             	sub    $0x4,%esp
+  8029e6:	6a 07                	push   $0x7
+  8029e8:	68 00 f0 bf ee       	push   $0xeebff000
+  8029ed:	6a 00                	push   $0x0
+  8029ef:	e8 3f e3 ff ff       	call   800d33 <sys_page_alloc>
+  8029f4:	83 c4 10             	add    $0x10,%esp
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	78 14                	js     802a0f <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8029fb:	83 ec 08             	sub    $0x8,%esp
+  8029fe:	68 a9 17 80 00       	push   $0x8017a9
+  802a03:	6a 00                	push   $0x0
+  802a05:	e8 45 e5 ff ff       	call   800f4f <sys_env_set_pgfault_upcall>
+  802a0a:	83 c4 10             	add    $0x10,%esp
+  802a0d:	eb ca                	jmp    8029d9 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  802a0f:	83 ec 08             	sub    $0x8,%esp
+  802a12:	50                   	push   %eax
+  802a13:	68 bf 30 80 00       	push   $0x8030bf
+  802a18:	e8 d6 d7 ff ff       	call   8001f3 <cprintf>
+			panic("set_pgfault_handler error");
+  802a1d:	83 c4 0c             	add    $0xc,%esp
+  802a20:	68 ca 30 80 00       	push   $0x8030ca
+  802a25:	6a 24                	push   $0x24
+  802a27:	68 e4 30 80 00       	push   $0x8030e4
+  802a2c:	e8 e7 d6 ff ff       	call   800118 <_panic>
+
+00802a31 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802a31:	55                   	push   %ebp
+  802a32:	89 e5                	mov    %esp,%ebp
+  802a34:	56                   	push   %esi
+  802a35:	53                   	push   %ebx
+  802a36:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a3f:	85 c0                	test   %eax,%eax
+  802a41:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a46:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802a49:	83 ec 08             	sub    $0x8,%esp
+  802a4c:	ff 75 14             	push   0x14(%ebp)
+  802a4f:	50                   	push   %eax
+  802a50:	e8 ef e6 ff ff       	call   801144 <sys_ipc_recv_until>
+  802a55:	83 c4 10             	add    $0x10,%esp
+  802a58:	85 c0                	test   %eax,%eax
+  802a5a:	78 61                	js     802abd <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802a5c:	85 f6                	test   %esi,%esi
+  802a5e:	74 1c                	je     802a7c <ipc_recv_until+0x4b>
+  802a60:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a62:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a67:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a6d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a72:	76 5f                	jbe    802ad3 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802a74:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802a7a:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802a7c:	85 db                	test   %ebx,%ebx
+  802a7e:	74 1c                	je     802a9c <ipc_recv_until+0x6b>
+  802a80:	89 e0                	mov    %esp,%eax
+  802a82:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a87:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a8d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a92:	76 50                	jbe    802ae4 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802a94:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802a9a:	89 03                	mov    %eax,(%ebx)
+  802a9c:	89 e0                	mov    %esp,%eax
+  802a9e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802aa3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802aa9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802aae:	76 45                	jbe    802af5 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802ab0:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802ab6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ab9:	5b                   	pop    %ebx
+  802aba:	5e                   	pop    %esi
+  802abb:	5d                   	pop    %ebp
+  802abc:	c3                   	ret
+		if (from_env_store)
+  802abd:	85 f6                	test   %esi,%esi
+  802abf:	74 06                	je     802ac7 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802ac1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ac7:	85 db                	test   %ebx,%ebx
+  802ac9:	74 eb                	je     802ab6 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802acb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802ad1:	eb e3                	jmp    802ab6 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ad3:	c1 e8 10             	shr    $0x10,%eax
+  802ad6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802adc:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ae2:	eb 90                	jmp    802a74 <ipc_recv_until+0x43>
+  802ae4:	c1 e8 10             	shr    $0x10,%eax
+  802ae7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802aed:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802af3:	eb 9f                	jmp    802a94 <ipc_recv_until+0x63>
+  802af5:	c1 e8 10             	shr    $0x10,%eax
+  802af8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802afe:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b04:	eb aa                	jmp    802ab0 <ipc_recv_until+0x7f>
+
+00802b06 <ipc_recv>:
+{
+  802b06:	55                   	push   %ebp
+  802b07:	89 e5                	mov    %esp,%ebp
+  802b09:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802b0c:	6a 00                	push   $0x0
+  802b0e:	ff 75 10             	push   0x10(%ebp)
+  802b11:	ff 75 0c             	push   0xc(%ebp)
+  802b14:	ff 75 08             	push   0x8(%ebp)
+  802b17:	e8 15 ff ff ff       	call   802a31 <ipc_recv_until>
+}
+  802b1c:	c9                   	leave
+  802b1d:	c3                   	ret
+
+00802b1e <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b1e:	55                   	push   %ebp
+  802b1f:	89 e5                	mov    %esp,%ebp
+  802b21:	57                   	push   %edi
+  802b22:	56                   	push   %esi
+  802b23:	53                   	push   %ebx
+  802b24:	83 ec 0c             	sub    $0xc,%esp
+  802b27:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b2a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b30:	85 db                	test   %ebx,%ebx
+  802b32:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b37:	0f 44 d8             	cmove  %eax,%ebx
+  802b3a:	eb 05                	jmp    802b41 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802b3c:	e8 ac e1 ff ff       	call   800ced <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802b41:	ff 75 14             	push   0x14(%ebp)
+  802b44:	53                   	push   %ebx
+  802b45:	56                   	push   %esi
+  802b46:	57                   	push   %edi
+  802b47:	e8 44 e5 ff ff       	call   801090 <sys_ipc_try_send>
+  802b4c:	83 c4 10             	add    $0x10,%esp
+  802b4f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b52:	74 e8                	je     802b3c <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802b54:	85 c0                	test   %eax,%eax
+  802b56:	78 08                	js     802b60 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b5b:	5b                   	pop    %ebx
+  802b5c:	5e                   	pop    %esi
+  802b5d:	5f                   	pop    %edi
+  802b5e:	5d                   	pop    %ebp
+  802b5f:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802b60:	50                   	push   %eax
+  802b61:	68 f2 30 80 00       	push   $0x8030f2
+  802b66:	6a 4f                	push   $0x4f
+  802b68:	68 05 31 80 00       	push   $0x803105
+  802b6d:	e8 a6 d5 ff ff       	call   800118 <_panic>
+
+00802b72 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b72:	55                   	push   %ebp
+  802b73:	89 e5                	mov    %esp,%ebp
+  802b75:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802b78:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802b7d:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802b83:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b89:	8b 52 50             	mov    0x50(%edx),%edx
+  802b8c:	39 ca                	cmp    %ecx,%edx
+  802b8e:	74 11                	je     802ba1 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802b90:	83 c0 01             	add    $0x1,%eax
+  802b93:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802b98:	75 e3                	jne    802b7d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9f:	eb 0e                	jmp    802baf <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802ba1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ba7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bac:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802baf:	5d                   	pop    %ebp
+  802bb0:	c3                   	ret
+
+00802bb1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bb1:	55                   	push   %ebp
+  802bb2:	89 e5                	mov    %esp,%ebp
+  802bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bb7:	89 c2                	mov    %eax,%edx
+  802bb9:	c1 ea 16             	shr    $0x16,%edx
+  802bbc:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802bc3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bc8:	f6 c1 01             	test   $0x1,%cl
+  802bcb:	74 1a                	je     802be7 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802bcd:	c1 e8 0c             	shr    $0xc,%eax
+  802bd0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802bd7:	a8 01                	test   $0x1,%al
+  802bd9:	74 0c                	je     802be7 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802bdb:	c1 e8 0c             	shr    $0xc,%eax
+  802bde:	c1 e0 04             	shl    $0x4,%eax
+  802be1:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802be7:	89 d0                	mov    %edx,%eax
+  802be9:	5d                   	pop    %ebp
+  802bea:	c3                   	ret
@@ -0,0 +1,6158 @@
+
+obj/user/faultreadkernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("I read %08x from location 0xf0100000!\n", *(unsigned*)0xf0100000);
+  800039:	ff 35 00 00 10 f0    	push   0xf0100000
+  80003f:	68 60 2b 80 00       	push   $0x802b60
+  800044:	e8 a4 01 00 00       	call   8001ed <cprintf>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 0c             	sub    $0xc,%esp
+  800057:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80005a:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80005d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800062:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800064:	c1 ea 0b             	shr    $0xb,%edx
+  800067:	83 f2 01             	xor    $0x1,%edx
+  80006a:	83 e2 01             	and    $0x1,%edx
+  80006d:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800073:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80007a:	00 00 00 
+	envid = sys_getenvid();
+  80007d:	e8 1f 0c 00 00       	call   800ca1 <sys_getenvid>
+  800082:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800084:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800089:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80008f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800095:	8b 52 48             	mov    0x48(%edx),%edx
+  800098:	39 ca                	cmp    %ecx,%edx
+  80009a:	74 27                	je     8000c3 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80009c:	83 c0 01             	add    $0x1,%eax
+  80009f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000a4:	75 e3                	jne    800089 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000a6:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000ad:	75 24                	jne    8000d3 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000af:	83 ec 04             	sub    $0x4,%esp
+  8000b2:	68 88 2b 80 00       	push   $0x802b88
+  8000b7:	6a 23                	push   $0x23
+  8000b9:	68 ab 2b 80 00       	push   $0x802bab
+  8000be:	e8 4f 00 00 00       	call   800112 <_panic>
+			mainenv = &envs[i];
+  8000c3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000c9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ce:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000d3:	85 ff                	test   %edi,%edi
+  8000d5:	7e 07                	jle    8000de <libmain+0x90>
+		binaryname = argv[0];
+  8000d7:	8b 06                	mov    (%esi),%eax
+  8000d9:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000de:	83 ec 08             	sub    $0x8,%esp
+  8000e1:	56                   	push   %esi
+  8000e2:	57                   	push   %edi
+  8000e3:	e8 4b ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000e8:	e8 0b 00 00 00       	call   8000f8 <exit>
+}
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f3:	5b                   	pop    %ebx
+  8000f4:	5e                   	pop    %esi
+  8000f5:	5f                   	pop    %edi
+  8000f6:	5d                   	pop    %ebp
+  8000f7:	c3                   	ret
+
+008000f8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000f8:	55                   	push   %ebp
+  8000f9:	89 e5                	mov    %esp,%ebp
+  8000fb:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000fe:	e8 94 18 00 00       	call   801997 <close_all>
+	sys_env_destroy(0);
+  800103:	83 ec 0c             	sub    $0xc,%esp
+  800106:	6a 00                	push   $0x0
+  800108:	e8 2b 0b 00 00       	call   800c38 <sys_env_destroy>
+}
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	c9                   	leave
+  800111:	c3                   	ret
+
+00800112 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800112:	55                   	push   %ebp
+  800113:	89 e5                	mov    %esp,%ebp
+  800115:	56                   	push   %esi
+  800116:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800117:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80011a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800120:	e8 7c 0b 00 00       	call   800ca1 <sys_getenvid>
+  800125:	83 ec 0c             	sub    $0xc,%esp
+  800128:	ff 75 0c             	push   0xc(%ebp)
+  80012b:	ff 75 08             	push   0x8(%ebp)
+  80012e:	56                   	push   %esi
+  80012f:	50                   	push   %eax
+  800130:	68 c4 2b 80 00       	push   $0x802bc4
+  800135:	e8 b3 00 00 00       	call   8001ed <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80013a:	83 c4 18             	add    $0x18,%esp
+  80013d:	53                   	push   %ebx
+  80013e:	ff 75 10             	push   0x10(%ebp)
+  800141:	e8 56 00 00 00       	call   80019c <vcprintf>
+	cprintf("\n");
+  800146:	c7 04 24 4c 30 80 00 	movl   $0x80304c,(%esp)
+  80014d:	e8 9b 00 00 00       	call   8001ed <cprintf>
+  800152:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800155:	cc                   	int3
+	while (1)
+  800156:	eb fd                	jmp    800155 <_panic+0x43>
+
+00800158 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800158:	55                   	push   %ebp
+  800159:	89 e5                	mov    %esp,%ebp
+  80015b:	53                   	push   %ebx
+  80015c:	83 ec 04             	sub    $0x4,%esp
+  80015f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800162:	8b 13                	mov    (%ebx),%edx
+  800164:	8d 42 01             	lea    0x1(%edx),%eax
+  800167:	89 03                	mov    %eax,(%ebx)
+  800169:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80016c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800170:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800175:	74 09                	je     800180 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800177:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80017b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80017e:	c9                   	leave
+  80017f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800180:	83 ec 08             	sub    $0x8,%esp
+  800183:	68 ff 00 00 00       	push   $0xff
+  800188:	8d 43 08             	lea    0x8(%ebx),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 1d 0a 00 00       	call   800bae <sys_cputs>
+		b->idx = 0;
+  800191:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800197:	83 c4 10             	add    $0x10,%esp
+  80019a:	eb db                	jmp    800177 <putch+0x1f>
+
+0080019c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80019c:	55                   	push   %ebp
+  80019d:	89 e5                	mov    %esp,%ebp
+  80019f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001a5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001ac:	00 00 00 
+	b.cnt = 0;
+  8001af:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001b6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001b9:	ff 75 0c             	push   0xc(%ebp)
+  8001bc:	ff 75 08             	push   0x8(%ebp)
+  8001bf:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001c5:	50                   	push   %eax
+  8001c6:	68 58 01 80 00       	push   $0x800158
+  8001cb:	e8 fb 00 00 00       	call   8002cb <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d0:	83 c4 08             	add    $0x8,%esp
+  8001d3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001d9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001df:	50                   	push   %eax
+  8001e0:	e8 c9 09 00 00       	call   800bae <sys_cputs>
+
+	return b.cnt;
+}
+  8001e5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001eb:	c9                   	leave
+  8001ec:	c3                   	ret
+
+008001ed <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001f6:	50                   	push   %eax
+  8001f7:	ff 75 08             	push   0x8(%ebp)
+  8001fa:	e8 9d ff ff ff       	call   80019c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ff:	c9                   	leave
+  800200:	c3                   	ret
+
+00800201 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	57                   	push   %edi
+  800205:	56                   	push   %esi
+  800206:	53                   	push   %ebx
+  800207:	83 ec 1c             	sub    $0x1c,%esp
+  80020a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80020d:	89 d6                	mov    %edx,%esi
+  80020f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800212:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800215:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800218:	73 0b                	jae    800225 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80021a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80021d:	c1 e7 08             	shl    $0x8,%edi
+  800220:	0b 7d 10             	or     0x10(%ebp),%edi
+  800223:	eb 36                	jmp    80025b <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800225:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800228:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022d:	f7 75 08             	divl   0x8(%ebp)
+  800230:	89 c1                	mov    %eax,%ecx
+  800232:	ff 75 14             	push   0x14(%ebp)
+  800235:	ff 75 10             	push   0x10(%ebp)
+  800238:	83 eb 01             	sub    $0x1,%ebx
+  80023b:	53                   	push   %ebx
+  80023c:	ff 75 08             	push   0x8(%ebp)
+  80023f:	89 f2                	mov    %esi,%edx
+  800241:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800244:	e8 b8 ff ff ff       	call   800201 <printnum>
+  800249:	83 c4 10             	add    $0x10,%esp
+  80024c:	eb 14                	jmp    800262 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80024e:	83 ec 08             	sub    $0x8,%esp
+  800251:	56                   	push   %esi
+  800252:	57                   	push   %edi
+  800253:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800256:	ff d0                	call   *%eax
+  800258:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80025b:	83 eb 01             	sub    $0x1,%ebx
+  80025e:	85 db                	test   %ebx,%ebx
+  800260:	7f ec                	jg     80024e <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800262:	83 ec 08             	sub    $0x8,%esp
+  800265:	56                   	push   %esi
+  800266:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800269:	ba 00 00 00 00       	mov    $0x0,%edx
+  80026e:	f7 75 08             	divl   0x8(%ebp)
+  800271:	0f be 92 e7 2b 80 00 	movsbl 0x802be7(%edx),%edx
+  800278:	8b 45 14             	mov    0x14(%ebp),%eax
+  80027b:	c1 e0 08             	shl    $0x8,%eax
+  80027e:	09 d0                	or     %edx,%eax
+  800280:	50                   	push   %eax
+  800281:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800284:	ff d0                	call   *%eax
+}
+  800286:	83 c4 10             	add    $0x10,%esp
+  800289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028c:	5b                   	pop    %ebx
+  80028d:	5e                   	pop    %esi
+  80028e:	5f                   	pop    %edi
+  80028f:	5d                   	pop    %ebp
+  800290:	c3                   	ret
+
+00800291 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800297:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80029b:	8b 10                	mov    (%eax),%edx
+  80029d:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002a0:	73 0a                	jae    8002ac <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002a2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002a5:	89 08                	mov    %ecx,(%eax)
+  8002a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002aa:	88 02                	mov    %al,(%edx)
+}
+  8002ac:	5d                   	pop    %ebp
+  8002ad:	c3                   	ret
+
+008002ae <printfmt>:
+{
+  8002ae:	55                   	push   %ebp
+  8002af:	89 e5                	mov    %esp,%ebp
+  8002b1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002b4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002b7:	50                   	push   %eax
+  8002b8:	ff 75 10             	push   0x10(%ebp)
+  8002bb:	ff 75 0c             	push   0xc(%ebp)
+  8002be:	ff 75 08             	push   0x8(%ebp)
+  8002c1:	e8 05 00 00 00       	call   8002cb <vprintfmt>
+}
+  8002c6:	83 c4 10             	add    $0x10,%esp
+  8002c9:	c9                   	leave
+  8002ca:	c3                   	ret
+
+008002cb <vprintfmt>:
+{
+  8002cb:	55                   	push   %ebp
+  8002cc:	89 e5                	mov    %esp,%ebp
+  8002ce:	57                   	push   %edi
+  8002cf:	56                   	push   %esi
+  8002d0:	53                   	push   %ebx
+  8002d1:	83 ec 3c             	sub    $0x3c,%esp
+  8002d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002d7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002da:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002e1:	eb 16                	jmp    8002f9 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002e3:	83 ec 08             	sub    $0x8,%esp
+  8002e6:	ff 75 0c             	push   0xc(%ebp)
+  8002e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002ec:	c1 e2 08             	shl    $0x8,%edx
+  8002ef:	09 d0                	or     %edx,%eax
+  8002f1:	50                   	push   %eax
+  8002f2:	ff d7                	call   *%edi
+  8002f4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002f7:	89 de                	mov    %ebx,%esi
+  8002f9:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8002fc:	0f b6 06             	movzbl (%esi),%eax
+  8002ff:	83 f8 25             	cmp    $0x25,%eax
+  800302:	74 0c                	je     800310 <vprintfmt+0x45>
+			if (ch == '\0')
+  800304:	85 c0                	test   %eax,%eax
+  800306:	75 db                	jne    8002e3 <vprintfmt+0x18>
+}
+  800308:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030b:	5b                   	pop    %ebx
+  80030c:	5e                   	pop    %esi
+  80030d:	5f                   	pop    %edi
+  80030e:	5d                   	pop    %ebp
+  80030f:	c3                   	ret
+		padc = ' ';
+  800310:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800314:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80031b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800322:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800329:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80032e:	8d 73 01             	lea    0x1(%ebx),%esi
+  800331:	0f b6 13             	movzbl (%ebx),%edx
+  800334:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800337:	3c 55                	cmp    $0x55,%al
+  800339:	0f 87 2c 04 00 00    	ja     80076b <vprintfmt+0x4a0>
+  80033f:	0f b6 c0             	movzbl %al,%eax
+  800342:	ff 24 85 40 2d 80 00 	jmp    *0x802d40(,%eax,4)
+  800349:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80034b:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80034f:	eb dd                	jmp    80032e <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800351:	89 f3                	mov    %esi,%ebx
+  800353:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800357:	eb d5                	jmp    80032e <vprintfmt+0x63>
+  800359:	0f b6 d2             	movzbl %dl,%edx
+  80035c:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80035e:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800363:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800366:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80036a:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80036d:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800370:	83 fe 09             	cmp    $0x9,%esi
+  800373:	0f 87 8a 00 00 00    	ja     800403 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800379:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80037c:	eb e5                	jmp    800363 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80037e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800381:	8b 00                	mov    (%eax),%eax
+  800383:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800386:	8b 45 14             	mov    0x14(%ebp),%eax
+  800389:	8d 40 04             	lea    0x4(%eax),%eax
+  80038c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80038f:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800391:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800395:	79 97                	jns    80032e <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800397:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80039a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80039d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003a4:	eb 88                	jmp    80032e <vprintfmt+0x63>
+			if (width < 0)
+  8003a6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003a9:	85 db                	test   %ebx,%ebx
+  8003ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b0:	0f 49 c3             	cmovns %ebx,%eax
+  8003b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b6:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003b8:	e9 71 ff ff ff       	jmp    80032e <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bd:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003bf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003c6:	e9 63 ff ff ff       	jmp    80032e <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003cb:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003ce:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003d2:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003d9:	3c 67                	cmp    $0x67,%al
+  8003db:	0f 84 18 ff ff ff    	je     8002f9 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003e1:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003e8:	3c 72                	cmp    $0x72,%al
+  8003ea:	0f 84 09 ff ff ff    	je     8002f9 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003f0:	3c 62                	cmp    $0x62,%al
+  8003f2:	0f 94 c0             	sete   %al
+  8003f5:	0f b6 c0             	movzbl %al,%eax
+  8003f8:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003fe:	e9 f6 fe ff ff       	jmp    8002f9 <vprintfmt+0x2e>
+  800403:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800406:	eb 89                	jmp    800391 <vprintfmt+0xc6>
+			lflag++;
+  800408:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80040b:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80040d:	e9 1c ff ff ff       	jmp    80032e <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800412:	8b 45 14             	mov    0x14(%ebp),%eax
+  800415:	8d 58 04             	lea    0x4(%eax),%ebx
+  800418:	83 ec 08             	sub    $0x8,%esp
+  80041b:	ff 75 0c             	push   0xc(%ebp)
+  80041e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800421:	c1 e0 08             	shl    $0x8,%eax
+  800424:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800427:	0b 01                	or     (%ecx),%eax
+  800429:	50                   	push   %eax
+  80042a:	ff d7                	call   *%edi
+			break;
+  80042c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80042f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800432:	e9 c2 fe ff ff       	jmp    8002f9 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800437:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043a:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80043d:	8b 10                	mov    (%eax),%edx
+  80043f:	89 d0                	mov    %edx,%eax
+  800441:	f7 d8                	neg    %eax
+  800443:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800446:	83 f8 12             	cmp    $0x12,%eax
+  800449:	7f 25                	jg     800470 <vprintfmt+0x1a5>
+  80044b:	8b 14 85 a0 2e 80 00 	mov    0x802ea0(,%eax,4),%edx
+  800452:	85 d2                	test   %edx,%edx
+  800454:	74 1a                	je     800470 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800456:	52                   	push   %edx
+  800457:	68 e1 2f 80 00       	push   $0x802fe1
+  80045c:	ff 75 0c             	push   0xc(%ebp)
+  80045f:	57                   	push   %edi
+  800460:	e8 49 fe ff ff       	call   8002ae <printfmt>
+  800465:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800468:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80046b:	e9 89 fe ff ff       	jmp    8002f9 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800470:	50                   	push   %eax
+  800471:	68 ff 2b 80 00       	push   $0x802bff
+  800476:	ff 75 0c             	push   0xc(%ebp)
+  800479:	57                   	push   %edi
+  80047a:	e8 2f fe ff ff       	call   8002ae <printfmt>
+  80047f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800482:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800485:	e9 6f fe ff ff       	jmp    8002f9 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80048a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048d:	83 c0 04             	add    $0x4,%eax
+  800490:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800493:	8b 45 14             	mov    0x14(%ebp),%eax
+  800496:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800498:	85 c9                	test   %ecx,%ecx
+  80049a:	b8 f8 2b 80 00       	mov    $0x802bf8,%eax
+  80049f:	0f 45 c1             	cmovne %ecx,%eax
+  8004a2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004a5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004a9:	7e 06                	jle    8004b1 <vprintfmt+0x1e6>
+  8004ab:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004af:	75 1a                	jne    8004cb <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004b4:	c1 e0 08             	shl    $0x8,%eax
+  8004b7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004ba:	83 c8 3f             	or     $0x3f,%eax
+  8004bd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004c0:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004c3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004c6:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004c9:	eb 6d                	jmp    800538 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004cb:	83 ec 08             	sub    $0x8,%esp
+  8004ce:	ff 75 d0             	push   -0x30(%ebp)
+  8004d1:	ff 75 c8             	push   -0x38(%ebp)
+  8004d4:	e8 39 03 00 00       	call   800812 <strnlen>
+  8004d9:	89 c2                	mov    %eax,%edx
+  8004db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004de:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004e0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004e3:	c1 e1 08             	shl    $0x8,%ecx
+  8004e6:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004ea:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ec:	83 c4 10             	add    $0x10,%esp
+  8004ef:	89 c3                	mov    %eax,%ebx
+  8004f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f4:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004f7:	89 ce                	mov    %ecx,%esi
+  8004f9:	eb 0f                	jmp    80050a <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8004fb:	83 ec 08             	sub    $0x8,%esp
+  8004fe:	ff 75 0c             	push   0xc(%ebp)
+  800501:	56                   	push   %esi
+  800502:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800504:	83 eb 01             	sub    $0x1,%ebx
+  800507:	83 c4 10             	add    $0x10,%esp
+  80050a:	85 db                	test   %ebx,%ebx
+  80050c:	7f ed                	jg     8004fb <vprintfmt+0x230>
+  80050e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800511:	8b 75 10             	mov    0x10(%ebp),%esi
+  800514:	85 c0                	test   %eax,%eax
+  800516:	ba 00 00 00 00       	mov    $0x0,%edx
+  80051b:	0f 49 d0             	cmovns %eax,%edx
+  80051e:	29 d0                	sub    %edx,%eax
+  800520:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800523:	eb 8c                	jmp    8004b1 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800525:	83 ec 08             	sub    $0x8,%esp
+  800528:	ff 75 0c             	push   0xc(%ebp)
+  80052b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80052e:	09 c2                	or     %eax,%edx
+  800530:	52                   	push   %edx
+  800531:	ff d7                	call   *%edi
+  800533:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800536:	89 d9                	mov    %ebx,%ecx
+  800538:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80053b:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80053f:	0f be d0             	movsbl %al,%edx
+  800542:	85 d2                	test   %edx,%edx
+  800544:	74 2a                	je     800570 <vprintfmt+0x2a5>
+  800546:	85 f6                	test   %esi,%esi
+  800548:	78 05                	js     80054f <vprintfmt+0x284>
+  80054a:	83 ee 01             	sub    $0x1,%esi
+  80054d:	78 3b                	js     80058a <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80054f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800553:	74 d0                	je     800525 <vprintfmt+0x25a>
+  800555:	0f be c0             	movsbl %al,%eax
+  800558:	83 e8 20             	sub    $0x20,%eax
+  80055b:	83 f8 5e             	cmp    $0x5e,%eax
+  80055e:	76 c5                	jbe    800525 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800560:	83 ec 08             	sub    $0x8,%esp
+  800563:	ff 75 0c             	push   0xc(%ebp)
+  800566:	ff 75 cc             	push   -0x34(%ebp)
+  800569:	ff d7                	call   *%edi
+  80056b:	83 c4 10             	add    $0x10,%esp
+  80056e:	eb c6                	jmp    800536 <vprintfmt+0x26b>
+  800570:	8b 75 10             	mov    0x10(%ebp),%esi
+  800573:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800576:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800579:	01 c3                	add    %eax,%ebx
+  80057b:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80057d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800580:	83 c8 20             	or     $0x20,%eax
+  800583:	89 75 10             	mov    %esi,0x10(%ebp)
+  800586:	89 c6                	mov    %eax,%esi
+  800588:	eb 14                	jmp    80059e <vprintfmt+0x2d3>
+  80058a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80058d:	eb e4                	jmp    800573 <vprintfmt+0x2a8>
+  80058f:	83 ec 08             	sub    $0x8,%esp
+  800592:	ff 75 0c             	push   0xc(%ebp)
+  800595:	56                   	push   %esi
+  800596:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800598:	83 eb 01             	sub    $0x1,%ebx
+  80059b:	83 c4 10             	add    $0x10,%esp
+  80059e:	85 db                	test   %ebx,%ebx
+  8005a0:	7f ed                	jg     80058f <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005a5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ab:	e9 49 fd ff ff       	jmp    8002f9 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005b0:	83 f9 01             	cmp    $0x1,%ecx
+  8005b3:	7f 1f                	jg     8005d4 <vprintfmt+0x309>
+	else if (lflag)
+  8005b5:	85 c9                	test   %ecx,%ecx
+  8005b7:	74 69                	je     800622 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8b 00                	mov    (%eax),%eax
+  8005be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c1:	89 c1                	mov    %eax,%ecx
+  8005c3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005c6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d2:	eb 17                	jmp    8005eb <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d7:	8b 50 04             	mov    0x4(%eax),%edx
+  8005da:	8b 00                	mov    (%eax),%eax
+  8005dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005eb:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005ee:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005f1:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005f6:	85 db                	test   %ebx,%ebx
+  8005f8:	0f 89 f6 00 00 00    	jns    8006f4 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8005fe:	83 ec 08             	sub    $0x8,%esp
+  800601:	ff 75 0c             	push   0xc(%ebp)
+  800604:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800607:	c1 e0 08             	shl    $0x8,%eax
+  80060a:	83 c8 2d             	or     $0x2d,%eax
+  80060d:	50                   	push   %eax
+  80060e:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800610:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800613:	f7 d9                	neg    %ecx
+  800615:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800618:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80061d:	e9 d2 00 00 00       	jmp    8006f4 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 00                	mov    (%eax),%eax
+  800627:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062a:	89 c1                	mov    %eax,%ecx
+  80062c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80062f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8d 40 04             	lea    0x4(%eax),%eax
+  800638:	89 45 14             	mov    %eax,0x14(%ebp)
+  80063b:	eb ae                	jmp    8005eb <vprintfmt+0x320>
+	if (lflag >= 2)
+  80063d:	83 f9 01             	cmp    $0x1,%ecx
+  800640:	7f 19                	jg     80065b <vprintfmt+0x390>
+	else if (lflag)
+  800642:	85 c9                	test   %ecx,%ecx
+  800644:	74 2a                	je     800670 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8b 08                	mov    (%eax),%ecx
+  80064b:	8d 40 04             	lea    0x4(%eax),%eax
+  80064e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800651:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800656:	e9 99 00 00 00       	jmp    8006f4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80065b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065e:	8b 08                	mov    (%eax),%ecx
+  800660:	8d 40 08             	lea    0x8(%eax),%eax
+  800663:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800666:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80066b:	e9 84 00 00 00       	jmp    8006f4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 08                	mov    (%eax),%ecx
+  800675:	8d 40 04             	lea    0x4(%eax),%eax
+  800678:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80067b:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800680:	eb 72                	jmp    8006f4 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800682:	83 f9 01             	cmp    $0x1,%ecx
+  800685:	7f 16                	jg     80069d <vprintfmt+0x3d2>
+	else if (lflag)
+  800687:	85 c9                	test   %ecx,%ecx
+  800689:	74 24                	je     8006af <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 08                	mov    (%eax),%ecx
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800696:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80069b:	eb 57                	jmp    8006f4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8b 08                	mov    (%eax),%ecx
+  8006a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a8:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006ad:	eb 45                	jmp    8006f4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8b 08                	mov    (%eax),%ecx
+  8006b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ba:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006bf:	eb 33                	jmp    8006f4 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006c1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006c4:	c1 e3 08             	shl    $0x8,%ebx
+  8006c7:	83 ec 08             	sub    $0x8,%esp
+  8006ca:	ff 75 0c             	push   0xc(%ebp)
+  8006cd:	89 d8                	mov    %ebx,%eax
+  8006cf:	83 c8 30             	or     $0x30,%eax
+  8006d2:	50                   	push   %eax
+  8006d3:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006d5:	83 c4 08             	add    $0x8,%esp
+  8006d8:	ff 75 0c             	push   0xc(%ebp)
+  8006db:	83 cb 78             	or     $0x78,%ebx
+  8006de:	53                   	push   %ebx
+  8006df:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006e6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ef:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006f4:	ff 75 e4             	push   -0x1c(%ebp)
+  8006f7:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006fb:	52                   	push   %edx
+  8006fc:	ff 75 e0             	push   -0x20(%ebp)
+  8006ff:	50                   	push   %eax
+  800700:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800703:	89 f8                	mov    %edi,%eax
+  800705:	e8 f7 fa ff ff       	call   800201 <printnum>
+			break;
+  80070a:	83 c4 10             	add    $0x10,%esp
+  80070d:	e9 e7 fb ff ff       	jmp    8002f9 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800712:	83 f9 01             	cmp    $0x1,%ecx
+  800715:	7f 16                	jg     80072d <vprintfmt+0x462>
+	else if (lflag)
+  800717:	85 c9                	test   %ecx,%ecx
+  800719:	74 24                	je     80073f <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80071b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071e:	8b 08                	mov    (%eax),%ecx
+  800720:	8d 40 04             	lea    0x4(%eax),%eax
+  800723:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800726:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80072b:	eb c7                	jmp    8006f4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80072d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800730:	8b 08                	mov    (%eax),%ecx
+  800732:	8d 40 08             	lea    0x8(%eax),%eax
+  800735:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800738:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80073d:	eb b5                	jmp    8006f4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	8b 08                	mov    (%eax),%ecx
+  800744:	8d 40 04             	lea    0x4(%eax),%eax
+  800747:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074a:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80074f:	eb a3                	jmp    8006f4 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800751:	83 ec 08             	sub    $0x8,%esp
+  800754:	ff 75 0c             	push   0xc(%ebp)
+  800757:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80075a:	c1 e0 08             	shl    $0x8,%eax
+  80075d:	83 c8 25             	or     $0x25,%eax
+  800760:	50                   	push   %eax
+  800761:	ff d7                	call   *%edi
+			break;
+  800763:	83 c4 10             	add    $0x10,%esp
+  800766:	e9 8e fb ff ff       	jmp    8002f9 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80076b:	83 ec 08             	sub    $0x8,%esp
+  80076e:	ff 75 0c             	push   0xc(%ebp)
+  800771:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800774:	c1 e0 08             	shl    $0x8,%eax
+  800777:	83 c8 25             	or     $0x25,%eax
+  80077a:	50                   	push   %eax
+  80077b:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80077d:	83 c4 10             	add    $0x10,%esp
+  800780:	89 de                	mov    %ebx,%esi
+  800782:	eb 03                	jmp    800787 <vprintfmt+0x4bc>
+  800784:	83 ee 01             	sub    $0x1,%esi
+  800787:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80078b:	75 f7                	jne    800784 <vprintfmt+0x4b9>
+  80078d:	e9 67 fb ff ff       	jmp    8002f9 <vprintfmt+0x2e>
+
+00800792 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800792:	55                   	push   %ebp
+  800793:	89 e5                	mov    %esp,%ebp
+  800795:	83 ec 18             	sub    $0x18,%esp
+  800798:	8b 45 08             	mov    0x8(%ebp),%eax
+  80079b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80079e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007a1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007a5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007a8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007af:	85 c0                	test   %eax,%eax
+  8007b1:	74 26                	je     8007d9 <vsnprintf+0x47>
+  8007b3:	85 d2                	test   %edx,%edx
+  8007b5:	7e 22                	jle    8007d9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007b7:	ff 75 14             	push   0x14(%ebp)
+  8007ba:	ff 75 10             	push   0x10(%ebp)
+  8007bd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007c0:	50                   	push   %eax
+  8007c1:	68 91 02 80 00       	push   $0x800291
+  8007c6:	e8 00 fb ff ff       	call   8002cb <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007cb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ce:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007d4:	83 c4 10             	add    $0x10,%esp
+}
+  8007d7:	c9                   	leave
+  8007d8:	c3                   	ret
+		return -E_INVAL;
+  8007d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007de:	eb f7                	jmp    8007d7 <vsnprintf+0x45>
+
+008007e0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007e0:	55                   	push   %ebp
+  8007e1:	89 e5                	mov    %esp,%ebp
+  8007e3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007e6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007e9:	50                   	push   %eax
+  8007ea:	ff 75 10             	push   0x10(%ebp)
+  8007ed:	ff 75 0c             	push   0xc(%ebp)
+  8007f0:	ff 75 08             	push   0x8(%ebp)
+  8007f3:	e8 9a ff ff ff       	call   800792 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007f8:	c9                   	leave
+  8007f9:	c3                   	ret
+
+008007fa <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007fa:	55                   	push   %ebp
+  8007fb:	89 e5                	mov    %esp,%ebp
+  8007fd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800800:	b8 00 00 00 00       	mov    $0x0,%eax
+  800805:	eb 03                	jmp    80080a <strlen+0x10>
+		n++;
+  800807:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80080a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80080e:	75 f7                	jne    800807 <strlen+0xd>
+	return n;
+}
+  800810:	5d                   	pop    %ebp
+  800811:	c3                   	ret
+
+00800812 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800818:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80081b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800820:	eb 03                	jmp    800825 <strnlen+0x13>
+		n++;
+  800822:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800825:	39 d0                	cmp    %edx,%eax
+  800827:	74 08                	je     800831 <strnlen+0x1f>
+  800829:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80082d:	75 f3                	jne    800822 <strnlen+0x10>
+  80082f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800831:	89 d0                	mov    %edx,%eax
+  800833:	5d                   	pop    %ebp
+  800834:	c3                   	ret
+
+00800835 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	53                   	push   %ebx
+  800839:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80083c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80083f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800844:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800848:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80084b:	83 c0 01             	add    $0x1,%eax
+  80084e:	84 d2                	test   %dl,%dl
+  800850:	75 f2                	jne    800844 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800852:	89 c8                	mov    %ecx,%eax
+  800854:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800857:	c9                   	leave
+  800858:	c3                   	ret
+
+00800859 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	53                   	push   %ebx
+  80085d:	83 ec 10             	sub    $0x10,%esp
+  800860:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800863:	53                   	push   %ebx
+  800864:	e8 91 ff ff ff       	call   8007fa <strlen>
+  800869:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80086c:	ff 75 0c             	push   0xc(%ebp)
+  80086f:	01 d8                	add    %ebx,%eax
+  800871:	50                   	push   %eax
+  800872:	e8 be ff ff ff       	call   800835 <strcpy>
+	return dst;
+}
+  800877:	89 d8                	mov    %ebx,%eax
+  800879:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80087c:	c9                   	leave
+  80087d:	c3                   	ret
+
+0080087e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80087e:	55                   	push   %ebp
+  80087f:	89 e5                	mov    %esp,%ebp
+  800881:	56                   	push   %esi
+  800882:	53                   	push   %ebx
+  800883:	8b 75 08             	mov    0x8(%ebp),%esi
+  800886:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800889:	89 f3                	mov    %esi,%ebx
+  80088b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80088e:	89 f0                	mov    %esi,%eax
+  800890:	eb 0f                	jmp    8008a1 <strncpy+0x23>
+		*dst++ = *src;
+  800892:	83 c0 01             	add    $0x1,%eax
+  800895:	0f b6 0a             	movzbl (%edx),%ecx
+  800898:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80089b:	80 f9 01             	cmp    $0x1,%cl
+  80089e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008a1:	39 d8                	cmp    %ebx,%eax
+  8008a3:	75 ed                	jne    800892 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008a5:	89 f0                	mov    %esi,%eax
+  8008a7:	5b                   	pop    %ebx
+  8008a8:	5e                   	pop    %esi
+  8008a9:	5d                   	pop    %ebp
+  8008aa:	c3                   	ret
+
+008008ab <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008ab:	55                   	push   %ebp
+  8008ac:	89 e5                	mov    %esp,%ebp
+  8008ae:	56                   	push   %esi
+  8008af:	53                   	push   %ebx
+  8008b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b6:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008b9:	89 f0                	mov    %esi,%eax
+  8008bb:	85 d2                	test   %edx,%edx
+  8008bd:	74 21                	je     8008e0 <strlcpy+0x35>
+  8008bf:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008c3:	89 f2                	mov    %esi,%edx
+  8008c5:	eb 09                	jmp    8008d0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008c7:	83 c1 01             	add    $0x1,%ecx
+  8008ca:	83 c2 01             	add    $0x1,%edx
+  8008cd:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008d0:	39 c2                	cmp    %eax,%edx
+  8008d2:	74 09                	je     8008dd <strlcpy+0x32>
+  8008d4:	0f b6 19             	movzbl (%ecx),%ebx
+  8008d7:	84 db                	test   %bl,%bl
+  8008d9:	75 ec                	jne    8008c7 <strlcpy+0x1c>
+  8008db:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008dd:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008e0:	29 f0                	sub    %esi,%eax
+}
+  8008e2:	5b                   	pop    %ebx
+  8008e3:	5e                   	pop    %esi
+  8008e4:	5d                   	pop    %ebp
+  8008e5:	c3                   	ret
+
+008008e6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008e6:	55                   	push   %ebp
+  8008e7:	89 e5                	mov    %esp,%ebp
+  8008e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008ef:	eb 06                	jmp    8008f7 <strcmp+0x11>
+		p++, q++;
+  8008f1:	83 c1 01             	add    $0x1,%ecx
+  8008f4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008f7:	0f b6 01             	movzbl (%ecx),%eax
+  8008fa:	84 c0                	test   %al,%al
+  8008fc:	74 04                	je     800902 <strcmp+0x1c>
+  8008fe:	3a 02                	cmp    (%edx),%al
+  800900:	74 ef                	je     8008f1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800902:	0f b6 c0             	movzbl %al,%eax
+  800905:	0f b6 12             	movzbl (%edx),%edx
+  800908:	29 d0                	sub    %edx,%eax
+}
+  80090a:	5d                   	pop    %ebp
+  80090b:	c3                   	ret
+
+0080090c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80090c:	55                   	push   %ebp
+  80090d:	89 e5                	mov    %esp,%ebp
+  80090f:	53                   	push   %ebx
+  800910:	8b 45 08             	mov    0x8(%ebp),%eax
+  800913:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800916:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800919:	eb 09                	jmp    800924 <strncmp+0x18>
+		n--, p++, q++;
+  80091b:	83 ea 01             	sub    $0x1,%edx
+  80091e:	83 c0 01             	add    $0x1,%eax
+  800921:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800924:	85 d2                	test   %edx,%edx
+  800926:	74 18                	je     800940 <strncmp+0x34>
+  800928:	0f b6 18             	movzbl (%eax),%ebx
+  80092b:	84 db                	test   %bl,%bl
+  80092d:	74 04                	je     800933 <strncmp+0x27>
+  80092f:	3a 19                	cmp    (%ecx),%bl
+  800931:	74 e8                	je     80091b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800933:	0f b6 00             	movzbl (%eax),%eax
+  800936:	0f b6 11             	movzbl (%ecx),%edx
+  800939:	29 d0                	sub    %edx,%eax
+}
+  80093b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093e:	c9                   	leave
+  80093f:	c3                   	ret
+		return 0;
+  800940:	b8 00 00 00 00       	mov    $0x0,%eax
+  800945:	eb f4                	jmp    80093b <strncmp+0x2f>
+
+00800947 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800951:	eb 03                	jmp    800956 <strchr+0xf>
+  800953:	83 c0 01             	add    $0x1,%eax
+  800956:	0f b6 10             	movzbl (%eax),%edx
+  800959:	84 d2                	test   %dl,%dl
+  80095b:	74 06                	je     800963 <strchr+0x1c>
+		if (*s == c)
+  80095d:	38 ca                	cmp    %cl,%dl
+  80095f:	75 f2                	jne    800953 <strchr+0xc>
+  800961:	eb 05                	jmp    800968 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800963:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800968:	5d                   	pop    %ebp
+  800969:	c3                   	ret
+
+0080096a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80096a:	55                   	push   %ebp
+  80096b:	89 e5                	mov    %esp,%ebp
+  80096d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800970:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800974:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800977:	38 ca                	cmp    %cl,%dl
+  800979:	74 09                	je     800984 <strfind+0x1a>
+  80097b:	84 d2                	test   %dl,%dl
+  80097d:	74 05                	je     800984 <strfind+0x1a>
+	for (; *s; s++)
+  80097f:	83 c0 01             	add    $0x1,%eax
+  800982:	eb f0                	jmp    800974 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800984:	5d                   	pop    %ebp
+  800985:	c3                   	ret
+
+00800986 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	57                   	push   %edi
+  80098a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80098d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800990:	85 c9                	test   %ecx,%ecx
+  800992:	74 20                	je     8009b4 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800994:	89 f8                	mov    %edi,%eax
+  800996:	09 c8                	or     %ecx,%eax
+  800998:	a8 03                	test   $0x3,%al
+  80099a:	75 12                	jne    8009ae <memset+0x28>
+		c &= 0xFF;
+  80099c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009a0:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009a6:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009a9:	fc                   	cld
+  8009aa:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009ac:	eb 06                	jmp    8009b4 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009b1:	fc                   	cld
+  8009b2:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009b4:	89 f8                	mov    %edi,%eax
+  8009b6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009b9:	c9                   	leave
+  8009ba:	c3                   	ret
+
+008009bb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009bb:	55                   	push   %ebp
+  8009bc:	89 e5                	mov    %esp,%ebp
+  8009be:	57                   	push   %edi
+  8009bf:	56                   	push   %esi
+  8009c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009c6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009c9:	39 c6                	cmp    %eax,%esi
+  8009cb:	73 32                	jae    8009ff <memmove+0x44>
+  8009cd:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009d0:	39 d0                	cmp    %edx,%eax
+  8009d2:	73 2b                	jae    8009ff <memmove+0x44>
+		s += n;
+		d += n;
+  8009d4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009d7:	89 d6                	mov    %edx,%esi
+  8009d9:	09 fe                	or     %edi,%esi
+  8009db:	09 ce                	or     %ecx,%esi
+  8009dd:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009e3:	75 0e                	jne    8009f3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009e5:	83 ef 04             	sub    $0x4,%edi
+  8009e8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009eb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009ee:	fd                   	std
+  8009ef:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009f1:	eb 09                	jmp    8009fc <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009f3:	83 ef 01             	sub    $0x1,%edi
+  8009f6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009f9:	fd                   	std
+  8009fa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009fc:	fc                   	cld
+  8009fd:	eb 1a                	jmp    800a19 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ff:	89 f2                	mov    %esi,%edx
+  800a01:	09 c2                	or     %eax,%edx
+  800a03:	09 ca                	or     %ecx,%edx
+  800a05:	f6 c2 03             	test   $0x3,%dl
+  800a08:	75 0a                	jne    800a14 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a0a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a0d:	89 c7                	mov    %eax,%edi
+  800a0f:	fc                   	cld
+  800a10:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a12:	eb 05                	jmp    800a19 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a14:	89 c7                	mov    %eax,%edi
+  800a16:	fc                   	cld
+  800a17:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a19:	5e                   	pop    %esi
+  800a1a:	5f                   	pop    %edi
+  800a1b:	5d                   	pop    %ebp
+  800a1c:	c3                   	ret
+
+00800a1d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a1d:	55                   	push   %ebp
+  800a1e:	89 e5                	mov    %esp,%ebp
+  800a20:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a23:	ff 75 10             	push   0x10(%ebp)
+  800a26:	ff 75 0c             	push   0xc(%ebp)
+  800a29:	ff 75 08             	push   0x8(%ebp)
+  800a2c:	e8 8a ff ff ff       	call   8009bb <memmove>
+}
+  800a31:	c9                   	leave
+  800a32:	c3                   	ret
+
+00800a33 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	56                   	push   %esi
+  800a37:	53                   	push   %ebx
+  800a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a3e:	89 c6                	mov    %eax,%esi
+  800a40:	03 75 10             	add    0x10(%ebp),%esi
+  800a43:	eb 06                	jmp    800a4b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a45:	83 c0 01             	add    $0x1,%eax
+  800a48:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a4b:	39 f0                	cmp    %esi,%eax
+  800a4d:	74 14                	je     800a63 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a4f:	0f b6 08             	movzbl (%eax),%ecx
+  800a52:	0f b6 1a             	movzbl (%edx),%ebx
+  800a55:	38 d9                	cmp    %bl,%cl
+  800a57:	74 ec                	je     800a45 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a59:	0f b6 c1             	movzbl %cl,%eax
+  800a5c:	0f b6 db             	movzbl %bl,%ebx
+  800a5f:	29 d8                	sub    %ebx,%eax
+  800a61:	eb 05                	jmp    800a68 <memcmp+0x35>
+	}
+
+	return 0;
+  800a63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a68:	5b                   	pop    %ebx
+  800a69:	5e                   	pop    %esi
+  800a6a:	5d                   	pop    %ebp
+  800a6b:	c3                   	ret
+
+00800a6c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a75:	89 c2                	mov    %eax,%edx
+  800a77:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a7a:	eb 03                	jmp    800a7f <memfind+0x13>
+  800a7c:	83 c0 01             	add    $0x1,%eax
+  800a7f:	39 d0                	cmp    %edx,%eax
+  800a81:	73 04                	jae    800a87 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a83:	38 08                	cmp    %cl,(%eax)
+  800a85:	75 f5                	jne    800a7c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a87:	5d                   	pop    %ebp
+  800a88:	c3                   	ret
+
+00800a89 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a89:	55                   	push   %ebp
+  800a8a:	89 e5                	mov    %esp,%ebp
+  800a8c:	57                   	push   %edi
+  800a8d:	56                   	push   %esi
+  800a8e:	53                   	push   %ebx
+  800a8f:	83 ec 1c             	sub    $0x1c,%esp
+  800a92:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a95:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a98:	eb 03                	jmp    800a9d <strtol+0x14>
+		s++;
+  800a9a:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800a9d:	0f b6 06             	movzbl (%esi),%eax
+  800aa0:	3c 20                	cmp    $0x20,%al
+  800aa2:	74 f6                	je     800a9a <strtol+0x11>
+  800aa4:	3c 09                	cmp    $0x9,%al
+  800aa6:	74 f2                	je     800a9a <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800aa8:	3c 2b                	cmp    $0x2b,%al
+  800aaa:	74 43                	je     800aef <strtol+0x66>
+	int neg = 0;
+  800aac:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800ab1:	3c 2d                	cmp    $0x2d,%al
+  800ab3:	74 44                	je     800af9 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab5:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800abb:	75 0f                	jne    800acc <strtol+0x43>
+  800abd:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ac0:	74 41                	je     800b03 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ac2:	85 ff                	test   %edi,%edi
+  800ac4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ac9:	0f 44 f8             	cmove  %eax,%edi
+  800acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad1:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800ad6:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ad9:	89 fb                	mov    %edi,%ebx
+  800adb:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ade:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ae1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ae4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ae7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800aea:	89 75 08             	mov    %esi,0x8(%ebp)
+  800aed:	eb 67                	jmp    800b56 <strtol+0xcd>
+		s++;
+  800aef:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800af2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af7:	eb bc                	jmp    800ab5 <strtol+0x2c>
+		s++, neg = 1;
+  800af9:	83 c6 01             	add    $0x1,%esi
+  800afc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b01:	eb b2                	jmp    800ab5 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b03:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b07:	74 0e                	je     800b17 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b09:	85 ff                	test   %edi,%edi
+  800b0b:	75 bf                	jne    800acc <strtol+0x43>
+		s++, base = 8;
+  800b0d:	83 c6 01             	add    $0x1,%esi
+  800b10:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b15:	eb b5                	jmp    800acc <strtol+0x43>
+		s += 2, base = 16;
+  800b17:	83 c6 02             	add    $0x2,%esi
+  800b1a:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b1f:	eb ab                	jmp    800acc <strtol+0x43>
+			dig = *s - '0';
+  800b21:	0f be c9             	movsbl %cl,%ecx
+  800b24:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b27:	39 f9                	cmp    %edi,%ecx
+  800b29:	7d 59                	jge    800b84 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b2b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b2f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b32:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b35:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b38:	0f af d8             	imul   %eax,%ebx
+  800b3b:	0f af d7             	imul   %edi,%edx
+  800b3e:	01 d3                	add    %edx,%ebx
+  800b40:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b43:	f7 e7                	mul    %edi
+  800b45:	01 da                	add    %ebx,%edx
+  800b47:	89 cb                	mov    %ecx,%ebx
+  800b49:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b4c:	01 c8                	add    %ecx,%eax
+  800b4e:	11 da                	adc    %ebx,%edx
+  800b50:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b53:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b59:	0f b6 08             	movzbl (%eax),%ecx
+  800b5c:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b5f:	80 fb 09             	cmp    $0x9,%bl
+  800b62:	76 bd                	jbe    800b21 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b64:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b67:	80 fb 19             	cmp    $0x19,%bl
+  800b6a:	77 08                	ja     800b74 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b6c:	0f be c9             	movsbl %cl,%ecx
+  800b6f:	83 e9 57             	sub    $0x57,%ecx
+  800b72:	eb b3                	jmp    800b27 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b74:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b77:	80 fb 19             	cmp    $0x19,%bl
+  800b7a:	77 08                	ja     800b84 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b7c:	0f be c9             	movsbl %cl,%ecx
+  800b7f:	83 e9 37             	sub    $0x37,%ecx
+  800b82:	eb a3                	jmp    800b27 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b84:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b87:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b8a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b90:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b94:	74 05                	je     800b9b <strtol+0x112>
+		*endptr = (char *) s;
+  800b96:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b99:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800b9b:	85 c9                	test   %ecx,%ecx
+  800b9d:	74 07                	je     800ba6 <strtol+0x11d>
+  800b9f:	f7 d8                	neg    %eax
+  800ba1:	83 d2 00             	adc    $0x0,%edx
+  800ba4:	f7 da                	neg    %edx
+}
+  800ba6:	83 c4 1c             	add    $0x1c,%esp
+  800ba9:	5b                   	pop    %ebx
+  800baa:	5e                   	pop    %esi
+  800bab:	5f                   	pop    %edi
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+
+00800bae <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	57                   	push   %edi
+  800bb2:	56                   	push   %esi
+  800bb3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bb4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bbb:	74 18                	je     800bd5 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc8:	89 c3                	mov    %eax,%ebx
+  800bca:	89 c7                	mov    %eax,%edi
+  800bcc:	89 c6                	mov    %eax,%esi
+  800bce:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bd0:	5b                   	pop    %ebx
+  800bd1:	5e                   	pop    %esi
+  800bd2:	5f                   	pop    %edi
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be0:	89 c3                	mov    %eax,%ebx
+  800be2:	89 c7                	mov    %eax,%edi
+  800be4:	55                   	push   %ebp
+  800be5:	89 e5                	mov    %esp,%ebp
+  800be7:	8d 35 ef 0b 80 00    	lea    0x800bef,%esi
+  800bed:	0f 34                	sysenter
+  800bef:	5d                   	pop    %ebp
+		goto out;
+  800bf0:	eb de                	jmp    800bd0 <sys_cputs+0x22>
+
+00800bf2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bf8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bff:	74 19                	je     800c1a <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c06:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c0b:	89 d1                	mov    %edx,%ecx
+  800c0d:	89 d3                	mov    %edx,%ebx
+  800c0f:	89 d7                	mov    %edx,%edi
+  800c11:	89 d6                	mov    %edx,%esi
+  800c13:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c15:	5b                   	pop    %ebx
+  800c16:	5e                   	pop    %esi
+  800c17:	5f                   	pop    %edi
+  800c18:	5d                   	pop    %ebp
+  800c19:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c24:	89 d1                	mov    %edx,%ecx
+  800c26:	89 d3                	mov    %edx,%ebx
+  800c28:	89 d7                	mov    %edx,%edi
+  800c2a:	55                   	push   %ebp
+  800c2b:	89 e5                	mov    %esp,%ebp
+  800c2d:	8d 35 35 0c 80 00    	lea    0x800c35,%esi
+  800c33:	0f 34                	sysenter
+  800c35:	5d                   	pop    %ebp
+		goto out;
+  800c36:	eb dd                	jmp    800c15 <sys_cgetc+0x23>
+
+00800c38 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	57                   	push   %edi
+  800c3c:	56                   	push   %esi
+  800c3d:	53                   	push   %ebx
+  800c3e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c41:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c48:	74 21                	je     800c6b <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c4f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c57:	89 cb                	mov    %ecx,%ebx
+  800c59:	89 cf                	mov    %ecx,%edi
+  800c5b:	89 ce                	mov    %ecx,%esi
+  800c5d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c5f:	85 c0                	test   %eax,%eax
+  800c61:	7f 27                	jg     800c8a <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c66:	5b                   	pop    %ebx
+  800c67:	5e                   	pop    %esi
+  800c68:	5f                   	pop    %edi
+  800c69:	5d                   	pop    %ebp
+  800c6a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c73:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c78:	89 cb                	mov    %ecx,%ebx
+  800c7a:	89 cf                	mov    %ecx,%edi
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	8d 35 87 0c 80 00    	lea    0x800c87,%esi
+  800c85:	0f 34                	sysenter
+  800c87:	5d                   	pop    %ebp
+		goto out;
+  800c88:	eb d5                	jmp    800c5f <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c8a:	83 ec 0c             	sub    $0xc,%esp
+  800c8d:	50                   	push   %eax
+  800c8e:	6a 03                	push   $0x3
+  800c90:	68 0b 2f 80 00       	push   $0x802f0b
+  800c95:	6a 3f                	push   $0x3f
+  800c97:	68 28 2f 80 00       	push   $0x802f28
+  800c9c:	e8 71 f4 ff ff       	call   800112 <_panic>
+
+00800ca1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	57                   	push   %edi
+  800ca5:	56                   	push   %esi
+  800ca6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ca7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cae:	74 19                	je     800cc9 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800cb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cba:	89 d1                	mov    %edx,%ecx
+  800cbc:	89 d3                	mov    %edx,%ebx
+  800cbe:	89 d7                	mov    %edx,%edi
+  800cc0:	89 d6                	mov    %edx,%esi
+  800cc2:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cc4:	5b                   	pop    %ebx
+  800cc5:	5e                   	pop    %esi
+  800cc6:	5f                   	pop    %edi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cce:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd3:	89 d1                	mov    %edx,%ecx
+  800cd5:	89 d3                	mov    %edx,%ebx
+  800cd7:	89 d7                	mov    %edx,%edi
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	8d 35 e4 0c 80 00    	lea    0x800ce4,%esi
+  800ce2:	0f 34                	sysenter
+  800ce4:	5d                   	pop    %ebp
+		goto out;
+  800ce5:	eb dd                	jmp    800cc4 <sys_getenvid+0x23>
+
+00800ce7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	57                   	push   %edi
+  800ceb:	56                   	push   %esi
+  800cec:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ced:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cf4:	74 19                	je     800d0f <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800cf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cfb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d00:	89 d1                	mov    %edx,%ecx
+  800d02:	89 d3                	mov    %edx,%ebx
+  800d04:	89 d7                	mov    %edx,%edi
+  800d06:	89 d6                	mov    %edx,%esi
+  800d08:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d0a:	5b                   	pop    %ebx
+  800d0b:	5e                   	pop    %esi
+  800d0c:	5f                   	pop    %edi
+  800d0d:	5d                   	pop    %ebp
+  800d0e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d14:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d19:	89 d1                	mov    %edx,%ecx
+  800d1b:	89 d3                	mov    %edx,%ebx
+  800d1d:	89 d7                	mov    %edx,%edi
+  800d1f:	55                   	push   %ebp
+  800d20:	89 e5                	mov    %esp,%ebp
+  800d22:	8d 35 2a 0d 80 00    	lea    0x800d2a,%esi
+  800d28:	0f 34                	sysenter
+  800d2a:	5d                   	pop    %ebp
+		goto out;
+  800d2b:	eb dd                	jmp    800d0a <sys_yield+0x23>
+
+00800d2d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+  800d33:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d36:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d3d:	74 23                	je     800d62 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d3f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d44:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d52:	89 f7                	mov    %esi,%edi
+  800d54:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d56:	85 c0                	test   %eax,%eax
+  800d58:	7f 29                	jg     800d83 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5d:	5b                   	pop    %ebx
+  800d5e:	5e                   	pop    %esi
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d68:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	8d 35 80 0d 80 00    	lea    0x800d80,%esi
+  800d7e:	0f 34                	sysenter
+  800d80:	5d                   	pop    %ebp
+		goto out;
+  800d81:	eb d3                	jmp    800d56 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d83:	83 ec 0c             	sub    $0xc,%esp
+  800d86:	50                   	push   %eax
+  800d87:	6a 04                	push   $0x4
+  800d89:	68 0b 2f 80 00       	push   $0x802f0b
+  800d8e:	6a 3f                	push   $0x3f
+  800d90:	68 28 2f 80 00       	push   $0x802f28
+  800d95:	e8 78 f3 ff ff       	call   800112 <_panic>
+
+00800d9a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d9a:	55                   	push   %ebp
+  800d9b:	89 e5                	mov    %esp,%ebp
+  800d9d:	57                   	push   %edi
+  800d9e:	56                   	push   %esi
+  800d9f:	53                   	push   %ebx
+  800da0:	83 ec 0c             	sub    $0xc,%esp
+  800da3:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800da6:	85 f6                	test   %esi,%esi
+  800da8:	75 09                	jne    800db3 <sys_page_map+0x19>
+  800daa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800db1:	74 1f                	je     800dd2 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800db3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc6:	85 c0                	test   %eax,%eax
+  800dc8:	7f 27                	jg     800df1 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcd:	5b                   	pop    %ebx
+  800dce:	5e                   	pop    %esi
+  800dcf:	5f                   	pop    %edi
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ddd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	8d 35 ee 0d 80 00    	lea    0x800dee,%esi
+  800dec:	0f 34                	sysenter
+  800dee:	5d                   	pop    %ebp
+		goto out;
+  800def:	eb d5                	jmp    800dc6 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+  800df4:	50                   	push   %eax
+  800df5:	6a 05                	push   $0x5
+  800df7:	68 0b 2f 80 00       	push   $0x802f0b
+  800dfc:	6a 3f                	push   $0x3f
+  800dfe:	68 28 2f 80 00       	push   $0x802f28
+  800e03:	e8 0a f3 ff ff       	call   800112 <_panic>
+
+00800e08 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	57                   	push   %edi
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+  800e0e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e11:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e18:	74 22                	je     800e3c <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2a:	89 df                	mov    %ebx,%edi
+  800e2c:	89 de                	mov    %ebx,%esi
+  800e2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e30:	85 c0                	test   %eax,%eax
+  800e32:	7f 28                	jg     800e5c <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e37:	5b                   	pop    %ebx
+  800e38:	5e                   	pop    %esi
+  800e39:	5f                   	pop    %edi
+  800e3a:	5d                   	pop    %ebp
+  800e3b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e47:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e4c:	89 df                	mov    %ebx,%edi
+  800e4e:	55                   	push   %ebp
+  800e4f:	89 e5                	mov    %esp,%ebp
+  800e51:	8d 35 59 0e 80 00    	lea    0x800e59,%esi
+  800e57:	0f 34                	sysenter
+  800e59:	5d                   	pop    %ebp
+		goto out;
+  800e5a:	eb d4                	jmp    800e30 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+  800e5f:	50                   	push   %eax
+  800e60:	6a 06                	push   $0x6
+  800e62:	68 0b 2f 80 00       	push   $0x802f0b
+  800e67:	6a 3f                	push   $0x3f
+  800e69:	68 28 2f 80 00       	push   $0x802f28
+  800e6e:	e8 9f f2 ff ff       	call   800112 <_panic>
+
+00800e73 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e7c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e83:	74 22                	je     800ea7 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e8a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e95:	89 df                	mov    %ebx,%edi
+  800e97:	89 de                	mov    %ebx,%esi
+  800e99:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e9b:	85 c0                	test   %eax,%eax
+  800e9d:	7f 28                	jg     800ec7 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5f                   	pop    %edi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ea7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb2:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eb7:	89 df                	mov    %ebx,%edi
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	8d 35 c4 0e 80 00    	lea    0x800ec4,%esi
+  800ec2:	0f 34                	sysenter
+  800ec4:	5d                   	pop    %ebp
+		goto out;
+  800ec5:	eb d4                	jmp    800e9b <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec7:	83 ec 0c             	sub    $0xc,%esp
+  800eca:	50                   	push   %eax
+  800ecb:	6a 08                	push   $0x8
+  800ecd:	68 0b 2f 80 00       	push   $0x802f0b
+  800ed2:	6a 3f                	push   $0x3f
+  800ed4:	68 28 2f 80 00       	push   $0x802f28
+  800ed9:	e8 34 f2 ff ff       	call   800112 <_panic>
+
+00800ede <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	57                   	push   %edi
+  800ee2:	56                   	push   %esi
+  800ee3:	53                   	push   %ebx
+  800ee4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ee7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eee:	74 22                	je     800f12 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ef0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef5:	b8 09 00 00 00       	mov    $0x9,%eax
+  800efa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f00:	89 df                	mov    %ebx,%edi
+  800f02:	89 de                	mov    %ebx,%esi
+  800f04:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	7f 28                	jg     800f32 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0d:	5b                   	pop    %ebx
+  800f0e:	5e                   	pop    %esi
+  800f0f:	5f                   	pop    %edi
+  800f10:	5d                   	pop    %ebp
+  800f11:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f22:	89 df                	mov    %ebx,%edi
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	8d 35 2f 0f 80 00    	lea    0x800f2f,%esi
+  800f2d:	0f 34                	sysenter
+  800f2f:	5d                   	pop    %ebp
+		goto out;
+  800f30:	eb d4                	jmp    800f06 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  800f35:	50                   	push   %eax
+  800f36:	6a 09                	push   $0x9
+  800f38:	68 0b 2f 80 00       	push   $0x802f0b
+  800f3d:	6a 3f                	push   $0x3f
+  800f3f:	68 28 2f 80 00       	push   $0x802f28
+  800f44:	e8 c9 f1 ff ff       	call   800112 <_panic>
+
+00800f49 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	57                   	push   %edi
+  800f4d:	56                   	push   %esi
+  800f4e:	53                   	push   %ebx
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f52:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f59:	74 22                	je     800f7d <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f60:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6b:	89 df                	mov    %ebx,%edi
+  800f6d:	89 de                	mov    %ebx,%esi
+  800f6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f71:	85 c0                	test   %eax,%eax
+  800f73:	7f 28                	jg     800f9d <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f88:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f8d:	89 df                	mov    %ebx,%edi
+  800f8f:	55                   	push   %ebp
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	8d 35 9a 0f 80 00    	lea    0x800f9a,%esi
+  800f98:	0f 34                	sysenter
+  800f9a:	5d                   	pop    %ebp
+		goto out;
+  800f9b:	eb d4                	jmp    800f71 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9d:	83 ec 0c             	sub    $0xc,%esp
+  800fa0:	50                   	push   %eax
+  800fa1:	6a 0a                	push   $0xa
+  800fa3:	68 0b 2f 80 00       	push   $0x802f0b
+  800fa8:	6a 3f                	push   $0x3f
+  800faa:	68 28 2f 80 00       	push   $0x802f28
+  800faf:	e8 5e f1 ff ff       	call   800112 <_panic>
+
+00800fb4 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+  800fb7:	57                   	push   %edi
+  800fb8:	56                   	push   %esi
+  800fb9:	53                   	push   %ebx
+  800fba:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fbd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fc4:	74 22                	je     800fe8 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcb:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd6:	89 df                	mov    %ebx,%edi
+  800fd8:	89 de                	mov    %ebx,%esi
+  800fda:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fdc:	85 c0                	test   %eax,%eax
+  800fde:	7f 28                	jg     801008 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe3:	5b                   	pop    %ebx
+  800fe4:	5e                   	pop    %esi
+  800fe5:	5f                   	pop    %edi
+  800fe6:	5d                   	pop    %ebp
+  800fe7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fe8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff3:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ff8:	89 df                	mov    %ebx,%edi
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	8d 35 05 10 80 00    	lea    0x801005,%esi
+  801003:	0f 34                	sysenter
+  801005:	5d                   	pop    %ebp
+		goto out;
+  801006:	eb d4                	jmp    800fdc <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801008:	83 ec 0c             	sub    $0xc,%esp
+  80100b:	50                   	push   %eax
+  80100c:	6a 17                	push   $0x17
+  80100e:	68 0b 2f 80 00       	push   $0x802f0b
+  801013:	6a 3f                	push   $0x3f
+  801015:	68 28 2f 80 00       	push   $0x802f28
+  80101a:	e8 f3 f0 ff ff       	call   800112 <_panic>
+
+0080101f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+  801025:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801028:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80102f:	74 22                	je     801053 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801031:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801036:	b8 18 00 00 00       	mov    $0x18,%eax
+  80103b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801041:	89 df                	mov    %ebx,%edi
+  801043:	89 de                	mov    %ebx,%esi
+  801045:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801047:	85 c0                	test   %eax,%eax
+  801049:	7f 28                	jg     801073 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80104b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801053:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801058:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801063:	89 df                	mov    %ebx,%edi
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	8d 35 70 10 80 00    	lea    0x801070,%esi
+  80106e:	0f 34                	sysenter
+  801070:	5d                   	pop    %ebp
+		goto out;
+  801071:	eb d4                	jmp    801047 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801073:	83 ec 0c             	sub    $0xc,%esp
+  801076:	50                   	push   %eax
+  801077:	6a 18                	push   $0x18
+  801079:	68 0b 2f 80 00       	push   $0x802f0b
+  80107e:	6a 3f                	push   $0x3f
+  801080:	68 28 2f 80 00       	push   $0x802f28
+  801085:	e8 88 f0 ff ff       	call   800112 <_panic>
+
+0080108a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	57                   	push   %edi
+  80108e:	56                   	push   %esi
+  80108f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801090:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801097:	74 1d                	je     8010b6 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801099:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80109e:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010af:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010b1:	5b                   	pop    %ebx
+  8010b2:	5e                   	pop    %esi
+  8010b3:	5f                   	pop    %edi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	8d 35 d2 10 80 00    	lea    0x8010d2,%esi
+  8010d0:	0f 34                	sysenter
+  8010d2:	5d                   	pop    %ebp
+		goto out;
+  8010d3:	eb dc                	jmp    8010b1 <sys_ipc_try_send+0x27>
+
+008010d5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	57                   	push   %edi
+  8010d9:	56                   	push   %esi
+  8010da:	53                   	push   %ebx
+  8010db:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010de:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010e5:	74 21                	je     801108 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ec:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	89 cb                	mov    %ecx,%ebx
+  8010f6:	89 cf                	mov    %ecx,%edi
+  8010f8:	89 ce                	mov    %ecx,%esi
+  8010fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010fc:	85 c0                	test   %eax,%eax
+  8010fe:	7f 27                	jg     801127 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801103:	5b                   	pop    %ebx
+  801104:	5e                   	pop    %esi
+  801105:	5f                   	pop    %edi
+  801106:	5d                   	pop    %ebp
+  801107:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801108:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801110:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801115:	89 cb                	mov    %ecx,%ebx
+  801117:	89 cf                	mov    %ecx,%edi
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	8d 35 24 11 80 00    	lea    0x801124,%esi
+  801122:	0f 34                	sysenter
+  801124:	5d                   	pop    %ebp
+		goto out;
+  801125:	eb d5                	jmp    8010fc <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801127:	83 ec 0c             	sub    $0xc,%esp
+  80112a:	50                   	push   %eax
+  80112b:	6a 0d                	push   $0xd
+  80112d:	68 0b 2f 80 00       	push   $0x802f0b
+  801132:	6a 3f                	push   $0x3f
+  801134:	68 28 2f 80 00       	push   $0x802f28
+  801139:	e8 d4 ef ff ff       	call   800112 <_panic>
+
+0080113e <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80113e:	55                   	push   %ebp
+  80113f:	89 e5                	mov    %esp,%ebp
+  801141:	57                   	push   %edi
+  801142:	56                   	push   %esi
+  801143:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801144:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80114b:	74 1b                	je     801168 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80114d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801152:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115d:	89 df                	mov    %ebx,%edi
+  80115f:	89 de                	mov    %ebx,%esi
+  801161:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801163:	5b                   	pop    %ebx
+  801164:	5e                   	pop    %esi
+  801165:	5f                   	pop    %edi
+  801166:	5d                   	pop    %ebp
+  801167:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801178:	89 df                	mov    %ebx,%edi
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	8d 35 85 11 80 00    	lea    0x801185,%esi
+  801183:	0f 34                	sysenter
+  801185:	5d                   	pop    %ebp
+		goto out;
+  801186:	eb db                	jmp    801163 <sys_ipc_recv_until+0x25>
+
+00801188 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	57                   	push   %edi
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80118e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801195:	74 19                	je     8011b0 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a1:	89 d1                	mov    %edx,%ecx
+  8011a3:	89 d3                	mov    %edx,%ebx
+  8011a5:	89 d7                	mov    %edx,%edi
+  8011a7:	89 d6                	mov    %edx,%esi
+  8011a9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011ba:	89 d1                	mov    %edx,%ecx
+  8011bc:	89 d3                	mov    %edx,%ebx
+  8011be:	89 d7                	mov    %edx,%edi
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	8d 35 cb 11 80 00    	lea    0x8011cb,%esi
+  8011c9:	0f 34                	sysenter
+  8011cb:	5d                   	pop    %ebp
+		goto out;
+  8011cc:	eb dd                	jmp    8011ab <sys_time_msec+0x23>
+
+008011ce <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	57                   	push   %edi
+  8011d2:	56                   	push   %esi
+  8011d3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011d4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011db:	74 1a                	je     8011f7 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ea:	89 cb                	mov    %ecx,%ebx
+  8011ec:	89 cf                	mov    %ecx,%edi
+  8011ee:	89 ce                	mov    %ecx,%esi
+  8011f0:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011f2:	5b                   	pop    %ebx
+  8011f3:	5e                   	pop    %esi
+  8011f4:	5f                   	pop    %edi
+  8011f5:	5d                   	pop    %ebp
+  8011f6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ff:	b8 10 00 00 00       	mov    $0x10,%eax
+  801204:	89 cb                	mov    %ecx,%ebx
+  801206:	89 cf                	mov    %ecx,%edi
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	8d 35 13 12 80 00    	lea    0x801213,%esi
+  801211:	0f 34                	sysenter
+  801213:	5d                   	pop    %ebp
+		goto out;
+  801214:	eb dc                	jmp    8011f2 <sys_sleep_until+0x24>
+
+00801216 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	57                   	push   %edi
+  80121a:	56                   	push   %esi
+  80121b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80121c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801223:	74 1a                	je     80123f <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801225:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80122a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80122f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801232:	89 cb                	mov    %ecx,%ebx
+  801234:	89 cf                	mov    %ecx,%edi
+  801236:	89 ce                	mov    %ecx,%esi
+  801238:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80123a:	5b                   	pop    %ebx
+  80123b:	5e                   	pop    %esi
+  80123c:	5f                   	pop    %edi
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80123f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801247:	b8 11 00 00 00       	mov    $0x11,%eax
+  80124c:	89 cb                	mov    %ecx,%ebx
+  80124e:	89 cf                	mov    %ecx,%edi
+  801250:	55                   	push   %ebp
+  801251:	89 e5                	mov    %esp,%ebp
+  801253:	8d 35 5b 12 80 00    	lea    0x80125b,%esi
+  801259:	0f 34                	sysenter
+  80125b:	5d                   	pop    %ebp
+		goto out;
+  80125c:	eb dc                	jmp    80123a <sys_env_print_stats+0x24>
+
+0080125e <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	57                   	push   %edi
+  801262:	56                   	push   %esi
+  801263:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801264:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80126b:	74 1b                	je     801288 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80126d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801272:	b8 19 00 00 00       	mov    $0x19,%eax
+  801277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127d:	89 df                	mov    %ebx,%edi
+  80127f:	89 de                	mov    %ebx,%esi
+  801281:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801283:	5b                   	pop    %ebx
+  801284:	5e                   	pop    %esi
+  801285:	5f                   	pop    %edi
+  801286:	5d                   	pop    %ebp
+  801287:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801293:	b8 19 00 00 00       	mov    $0x19,%eax
+  801298:	89 df                	mov    %ebx,%edi
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	8d 35 a5 12 80 00    	lea    0x8012a5,%esi
+  8012a3:	0f 34                	sysenter
+  8012a5:	5d                   	pop    %ebp
+		goto out;
+  8012a6:	eb db                	jmp    801283 <sys_perf+0x25>
+
+008012a8 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	57                   	push   %edi
+  8012ac:	56                   	push   %esi
+  8012ad:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012ae:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012b5:	74 19                	je     8012d0 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012c1:	89 d1                	mov    %edx,%ecx
+  8012c3:	89 d3                	mov    %edx,%ebx
+  8012c5:	89 d7                	mov    %edx,%edi
+  8012c7:	89 d6                	mov    %edx,%esi
+  8012c9:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012da:	89 d1                	mov    %edx,%ecx
+  8012dc:	89 d3                	mov    %edx,%ebx
+  8012de:	89 d7                	mov    %edx,%edi
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	8d 35 eb 12 80 00    	lea    0x8012eb,%esi
+  8012e9:	0f 34                	sysenter
+  8012eb:	5d                   	pop    %ebp
+		goto out;
+  8012ec:	eb dd                	jmp    8012cb <sys_fork+0x23>
+
+008012ee <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	57                   	push   %edi
+  8012f2:	56                   	push   %esi
+  8012f3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012f4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012fb:	74 1c                	je     801319 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8012fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801302:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801307:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801310:	89 f7                	mov    %esi,%edi
+  801312:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801314:	5b                   	pop    %ebx
+  801315:	5e                   	pop    %esi
+  801316:	5f                   	pop    %edi
+  801317:	5d                   	pop    %ebp
+  801318:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801319:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801324:	bf 00 00 00 00       	mov    $0x0,%edi
+  801329:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	8d 35 37 13 80 00    	lea    0x801337,%esi
+  801335:	0f 34                	sysenter
+  801337:	5d                   	pop    %ebp
+		goto out;
+  801338:	eb da                	jmp    801314 <sys_thread_create+0x26>
+
+0080133a <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801343:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80134a:	74 24                	je     801370 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80134c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801351:	be 00 00 00 00       	mov    $0x0,%esi
+  801356:	8b 55 08             	mov    0x8(%ebp),%edx
+  801359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801362:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801364:	85 c0                	test   %eax,%eax
+  801366:	7f 27                	jg     80138f <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136b:	5b                   	pop    %ebx
+  80136c:	5e                   	pop    %esi
+  80136d:	5f                   	pop    %edi
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801370:	8b 55 08             	mov    0x8(%ebp),%edx
+  801373:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801376:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80137b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80137e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801381:	55                   	push   %ebp
+  801382:	89 e5                	mov    %esp,%ebp
+  801384:	8d 35 8c 13 80 00    	lea    0x80138c,%esi
+  80138a:	0f 34                	sysenter
+  80138c:	5d                   	pop    %ebp
+		goto out;
+  80138d:	eb d5                	jmp    801364 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80138f:	83 ec 0c             	sub    $0xc,%esp
+  801392:	50                   	push   %eax
+  801393:	6a 1f                	push   $0x1f
+  801395:	68 0b 2f 80 00       	push   $0x802f0b
+  80139a:	6a 3f                	push   $0x3f
+  80139c:	68 28 2f 80 00       	push   $0x802f28
+  8013a1:	e8 6c ed ff ff       	call   800112 <_panic>
+
+008013a6 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	57                   	push   %edi
+  8013aa:	56                   	push   %esi
+  8013ab:	53                   	push   %ebx
+  8013ac:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013af:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013b6:	74 23                	je     8013db <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bd:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013cb:	89 f7                	mov    %esi,%edi
+  8013cd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013cf:	85 c0                	test   %eax,%eax
+  8013d1:	7f 29                	jg     8013fc <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d6:	5b                   	pop    %ebx
+  8013d7:	5e                   	pop    %esi
+  8013d8:	5f                   	pop    %edi
+  8013d9:	5d                   	pop    %ebp
+  8013da:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e1:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	8d 35 f9 13 80 00    	lea    0x8013f9,%esi
+  8013f7:	0f 34                	sysenter
+  8013f9:	5d                   	pop    %ebp
+		goto out;
+  8013fa:	eb d3                	jmp    8013cf <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013fc:	83 ec 0c             	sub    $0xc,%esp
+  8013ff:	50                   	push   %eax
+  801400:	6a 20                	push   $0x20
+  801402:	68 0b 2f 80 00       	push   $0x802f0b
+  801407:	6a 3f                	push   $0x3f
+  801409:	68 28 2f 80 00       	push   $0x802f28
+  80140e:	e8 ff ec ff ff       	call   800112 <_panic>
+
+00801413 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801413:	55                   	push   %ebp
+  801414:	89 e5                	mov    %esp,%ebp
+  801416:	57                   	push   %edi
+  801417:	56                   	push   %esi
+  801418:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801419:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801420:	74 1b                	je     80143d <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801422:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801427:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80142c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801432:	89 df                	mov    %ebx,%edi
+  801434:	89 de                	mov    %ebx,%esi
+  801436:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801438:	5b                   	pop    %ebx
+  801439:	5e                   	pop    %esi
+  80143a:	5f                   	pop    %edi
+  80143b:	5d                   	pop    %ebp
+  80143c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80143d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801442:	8b 55 08             	mov    0x8(%ebp),%edx
+  801445:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801448:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80144d:	89 df                	mov    %ebx,%edi
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	8d 35 5a 14 80 00    	lea    0x80145a,%esi
+  801458:	0f 34                	sysenter
+  80145a:	5d                   	pop    %ebp
+		goto out;
+  80145b:	eb db                	jmp    801438 <sys_batch+0x25>
+
+0080145d <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80145d:	55                   	push   %ebp
+  80145e:	89 e5                	mov    %esp,%ebp
+  801460:	57                   	push   %edi
+  801461:	56                   	push   %esi
+  801462:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801463:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80146a:	74 1a                	je     801486 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80146c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801471:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801476:	8b 55 08             	mov    0x8(%ebp),%edx
+  801479:	89 cb                	mov    %ecx,%ebx
+  80147b:	89 cf                	mov    %ecx,%edi
+  80147d:	89 ce                	mov    %ecx,%esi
+  80147f:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801481:	5b                   	pop    %ebx
+  801482:	5e                   	pop    %esi
+  801483:	5f                   	pop    %edi
+  801484:	5d                   	pop    %ebp
+  801485:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801493:	89 cb                	mov    %ecx,%ebx
+  801495:	89 cf                	mov    %ecx,%edi
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	8d 35 a2 14 80 00    	lea    0x8014a2,%esi
+  8014a0:	0f 34                	sysenter
+  8014a2:	5d                   	pop    %ebp
+		goto out;
+  8014a3:	eb dc                	jmp    801481 <sys_trace_ctl+0x24>
+
+008014a5 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014b2:	74 1c                	je     8014d0 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c7:	89 f7                	mov    %esi,%edi
+  8014c9:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014cb:	5b                   	pop    %ebx
+  8014cc:	5e                   	pop    %esi
+  8014cd:	5f                   	pop    %edi
+  8014ce:	5d                   	pop    %ebp
+  8014cf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	8d 35 ee 14 80 00    	lea    0x8014ee,%esi
+  8014ec:	0f 34                	sysenter
+  8014ee:	5d                   	pop    %ebp
+		goto out;
+  8014ef:	eb da                	jmp    8014cb <sys_trace_read+0x26>
+
+008014f1 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	57                   	push   %edi
+  8014f5:	56                   	push   %esi
+  8014f6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014f7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014fe:	74 1c                	je     80151c <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801500:	be 00 00 00 00       	mov    $0x0,%esi
+  801505:	b8 21 00 00 00       	mov    $0x21,%eax
+  80150a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801510:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801513:	89 f7                	mov    %esi,%edi
+  801515:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801517:	5b                   	pop    %ebx
+  801518:	5e                   	pop    %esi
+  801519:	5f                   	pop    %edi
+  80151a:	5d                   	pop    %ebp
+  80151b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80151c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801522:	b8 21 00 00 00       	mov    $0x21,%eax
+  801527:	bf 00 00 00 00       	mov    $0x0,%edi
+  80152c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152f:	55                   	push   %ebp
+  801530:	89 e5                	mov    %esp,%ebp
+  801532:	8d 35 3a 15 80 00    	lea    0x80153a,%esi
+  801538:	0f 34                	sysenter
+  80153a:	5d                   	pop    %ebp
+		goto out;
+  80153b:	eb da                	jmp    801517 <sys_meminfo+0x26>
+
+0080153d <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80153d:	55                   	push   %ebp
+  80153e:	89 e5                	mov    %esp,%ebp
+  801540:	57                   	push   %edi
+  801541:	56                   	push   %esi
+  801542:	53                   	push   %ebx
+  801543:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801546:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80154a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801551:	74 1f                	je     801572 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801553:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801558:	b8 22 00 00 00       	mov    $0x22,%eax
+  80155d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801560:	89 df                	mov    %ebx,%edi
+  801562:	89 de                	mov    %ebx,%esi
+  801564:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801566:	85 c0                	test   %eax,%eax
+  801568:	7f 25                	jg     80158f <sys_env_set_ksm+0x52>
+}
+  80156a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80156d:	5b                   	pop    %ebx
+  80156e:	5e                   	pop    %esi
+  80156f:	5f                   	pop    %edi
+  801570:	5d                   	pop    %ebp
+  801571:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801572:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801577:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80157f:	89 df                	mov    %ebx,%edi
+  801581:	55                   	push   %ebp
+  801582:	89 e5                	mov    %esp,%ebp
+  801584:	8d 35 8c 15 80 00    	lea    0x80158c,%esi
+  80158a:	0f 34                	sysenter
+  80158c:	5d                   	pop    %ebp
+		goto out;
+  80158d:	eb d7                	jmp    801566 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80158f:	83 ec 0c             	sub    $0xc,%esp
+  801592:	50                   	push   %eax
+  801593:	6a 22                	push   $0x22
+  801595:	68 0b 2f 80 00       	push   $0x802f0b
+  80159a:	6a 3f                	push   $0x3f
+  80159c:	68 28 2f 80 00       	push   $0x802f28
+  8015a1:	e8 6c eb ff ff       	call   800112 <_panic>
+
+008015a6 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015a6:	55                   	push   %ebp
+  8015a7:	89 e5                	mov    %esp,%ebp
+  8015a9:	57                   	push   %edi
+  8015aa:	56                   	push   %esi
+  8015ab:	53                   	push   %ebx
+  8015ac:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015af:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015b2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015b9:	74 24                	je     8015df <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015c5:	89 cb                	mov    %ecx,%ebx
+  8015c7:	89 cf                	mov    %ecx,%edi
+  8015c9:	89 ce                	mov    %ecx,%esi
+  8015cb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015cd:	85 c0                	test   %eax,%eax
+  8015cf:	7f 2a                	jg     8015fb <sys_time_nsec+0x55>
+	return ns;
+}
+  8015d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015d4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015da:	5b                   	pop    %ebx
+  8015db:	5e                   	pop    %esi
+  8015dc:	5f                   	pop    %edi
+  8015dd:	5d                   	pop    %ebp
+  8015de:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015e9:	89 cb                	mov    %ecx,%ebx
+  8015eb:	89 cf                	mov    %ecx,%edi
+  8015ed:	55                   	push   %ebp
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	8d 35 f8 15 80 00    	lea    0x8015f8,%esi
+  8015f6:	0f 34                	sysenter
+  8015f8:	5d                   	pop    %ebp
+		goto out;
+  8015f9:	eb d2                	jmp    8015cd <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015fb:	83 ec 0c             	sub    $0xc,%esp
+  8015fe:	50                   	push   %eax
+  8015ff:	6a 0f                	push   $0xf
+  801601:	68 0b 2f 80 00       	push   $0x802f0b
+  801606:	6a 3f                	push   $0x3f
+  801608:	68 28 2f 80 00       	push   $0x802f28
+  80160d:	e8 00 eb ff ff       	call   800112 <_panic>
+
+00801612 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  801615:	57                   	push   %edi
+  801616:	56                   	push   %esi
+  801617:	53                   	push   %ebx
+  801618:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80161b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801622:	74 22                	je     801646 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801624:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801629:	b8 12 00 00 00       	mov    $0x12,%eax
+  80162e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801631:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801634:	89 df                	mov    %ebx,%edi
+  801636:	89 de                	mov    %ebx,%esi
+  801638:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	7f 28                	jg     801666 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80163e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801641:	5b                   	pop    %ebx
+  801642:	5e                   	pop    %esi
+  801643:	5f                   	pop    %edi
+  801644:	5d                   	pop    %ebp
+  801645:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801646:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801651:	b8 12 00 00 00       	mov    $0x12,%eax
+  801656:	89 df                	mov    %ebx,%edi
+  801658:	55                   	push   %ebp
+  801659:	89 e5                	mov    %esp,%ebp
+  80165b:	8d 35 63 16 80 00    	lea    0x801663,%esi
+  801661:	0f 34                	sysenter
+  801663:	5d                   	pop    %ebp
+		goto out;
+  801664:	eb d4                	jmp    80163a <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801666:	83 ec 0c             	sub    $0xc,%esp
+  801669:	50                   	push   %eax
+  80166a:	6a 12                	push   $0x12
+  80166c:	68 0b 2f 80 00       	push   $0x802f0b
+  801671:	6a 3f                	push   $0x3f
+  801673:	68 28 2f 80 00       	push   $0x802f28
+  801678:	e8 95 ea ff ff       	call   800112 <_panic>
+
+0080167d <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80167d:	55                   	push   %ebp
+  80167e:	89 e5                	mov    %esp,%ebp
+  801680:	57                   	push   %edi
+  801681:	56                   	push   %esi
+  801682:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801683:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80168a:	74 1b                	je     8016a7 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80168c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801691:	b8 13 00 00 00       	mov    $0x13,%eax
+  801696:	8b 55 08             	mov    0x8(%ebp),%edx
+  801699:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169c:	89 df                	mov    %ebx,%edi
+  80169e:	89 de                	mov    %ebx,%esi
+  8016a0:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016a2:	5b                   	pop    %ebx
+  8016a3:	5e                   	pop    %esi
+  8016a4:	5f                   	pop    %edi
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016b7:	89 df                	mov    %ebx,%edi
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	8d 35 c4 16 80 00    	lea    0x8016c4,%esi
+  8016c2:	0f 34                	sysenter
+  8016c4:	5d                   	pop    %ebp
+		goto out;
+  8016c5:	eb db                	jmp    8016a2 <sys_e1000_receive+0x25>
+
+008016c7 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016c7:	55                   	push   %ebp
+  8016c8:	89 e5                	mov    %esp,%ebp
+  8016ca:	57                   	push   %edi
+  8016cb:	56                   	push   %esi
+  8016cc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016cd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016d4:	74 1b                	je     8016f1 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016db:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e6:	89 df                	mov    %ebx,%edi
+  8016e8:	89 de                	mov    %ebx,%esi
+  8016ea:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016ec:	5b                   	pop    %ebx
+  8016ed:	5e                   	pop    %esi
+  8016ee:	5f                   	pop    %edi
+  8016ef:	5d                   	pop    %ebp
+  8016f0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fc:	b8 14 00 00 00       	mov    $0x14,%eax
+  801701:	89 df                	mov    %ebx,%edi
+  801703:	55                   	push   %ebp
+  801704:	89 e5                	mov    %esp,%ebp
+  801706:	8d 35 0e 17 80 00    	lea    0x80170e,%esi
+  80170c:	0f 34                	sysenter
+  80170e:	5d                   	pop    %ebp
+		goto out;
+  80170f:	eb db                	jmp    8016ec <sys_e1000_read_hwaddr+0x25>
+
+00801711 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	57                   	push   %edi
+  801715:	56                   	push   %esi
+  801716:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801717:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80171e:	74 1a                	je     80173a <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801720:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801725:	b8 15 00 00 00       	mov    $0x15,%eax
+  80172a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172d:	89 cb                	mov    %ecx,%ebx
+  80172f:	89 cf                	mov    %ecx,%edi
+  801731:	89 ce                	mov    %ecx,%esi
+  801733:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801735:	5b                   	pop    %ebx
+  801736:	5e                   	pop    %esi
+  801737:	5f                   	pop    %edi
+  801738:	5d                   	pop    %ebp
+  801739:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80173a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801742:	b8 15 00 00 00       	mov    $0x15,%eax
+  801747:	89 cb                	mov    %ecx,%ebx
+  801749:	89 cf                	mov    %ecx,%edi
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	8d 35 56 17 80 00    	lea    0x801756,%esi
+  801754:	0f 34                	sysenter
+  801756:	5d                   	pop    %ebp
+		goto out;
+  801757:	eb dc                	jmp    801735 <sys_sb16_read_version+0x24>
+
+00801759 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801759:	55                   	push   %ebp
+  80175a:	89 e5                	mov    %esp,%ebp
+  80175c:	57                   	push   %edi
+  80175d:	56                   	push   %esi
+  80175e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80175f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801766:	74 1b                	je     801783 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801768:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801772:	8b 55 08             	mov    0x8(%ebp),%edx
+  801775:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801778:	89 df                	mov    %ebx,%edi
+  80177a:	89 de                	mov    %ebx,%esi
+  80177c:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80177e:	5b                   	pop    %ebx
+  80177f:	5e                   	pop    %esi
+  801780:	5f                   	pop    %edi
+  801781:	5d                   	pop    %ebp
+  801782:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801783:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801788:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801793:	89 df                	mov    %ebx,%edi
+  801795:	55                   	push   %ebp
+  801796:	89 e5                	mov    %esp,%ebp
+  801798:	8d 35 a0 17 80 00    	lea    0x8017a0,%esi
+  80179e:	0f 34                	sysenter
+  8017a0:	5d                   	pop    %ebp
+		goto out;
+  8017a1:	eb db                	jmp    80177e <sys_sb16_play+0x25>
+
+008017a3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a9:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017ae:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017b1:	5d                   	pop    %ebp
+  8017b2:	c3                   	ret
+
+008017b3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017b3:	55                   	push   %ebp
+  8017b4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017be:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017c3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017c8:	5d                   	pop    %ebp
+  8017c9:	c3                   	ret
+
+008017ca <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017ca:	55                   	push   %ebp
+  8017cb:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017cd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017d2:	eb 02                	jmp    8017d6 <fd_alloc+0xc>
+  8017d4:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017d6:	89 c2                	mov    %eax,%edx
+  8017d8:	c1 ea 16             	shr    $0x16,%edx
+  8017db:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017e2:	f6 c2 01             	test   $0x1,%dl
+  8017e5:	74 2b                	je     801812 <fd_alloc+0x48>
+  8017e7:	89 c2                	mov    %eax,%edx
+  8017e9:	c1 ea 0c             	shr    $0xc,%edx
+  8017ec:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017f3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017f9:	f6 c1 01             	test   $0x1,%cl
+  8017fc:	74 14                	je     801812 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017fe:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801804:	75 ce                	jne    8017d4 <fd_alloc+0xa>
+  801806:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80180b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801810:	eb 05                	jmp    801817 <fd_alloc+0x4d>
+			return 0;
+  801812:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801817:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181a:	89 02                	mov    %eax,(%edx)
+}
+  80181c:	89 c8                	mov    %ecx,%eax
+  80181e:	5d                   	pop    %ebp
+  80181f:	c3                   	ret
+
+00801820 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801820:	55                   	push   %ebp
+  801821:	89 e5                	mov    %esp,%ebp
+  801823:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801826:	83 f8 1f             	cmp    $0x1f,%eax
+  801829:	77 30                	ja     80185b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80182b:	c1 e0 0c             	shl    $0xc,%eax
+  80182e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801833:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801839:	f6 c2 01             	test   $0x1,%dl
+  80183c:	74 24                	je     801862 <fd_lookup+0x42>
+  80183e:	89 c2                	mov    %eax,%edx
+  801840:	c1 ea 0c             	shr    $0xc,%edx
+  801843:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80184a:	f6 c2 01             	test   $0x1,%dl
+  80184d:	74 1a                	je     801869 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80184f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801852:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801854:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801859:	5d                   	pop    %ebp
+  80185a:	c3                   	ret
+		return -E_INVAL;
+  80185b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801860:	eb f7                	jmp    801859 <fd_lookup+0x39>
+		return -E_INVAL;
+  801862:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801867:	eb f0                	jmp    801859 <fd_lookup+0x39>
+  801869:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80186e:	eb e9                	jmp    801859 <fd_lookup+0x39>
+
+00801870 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801870:	55                   	push   %ebp
+  801871:	89 e5                	mov    %esp,%ebp
+  801873:	53                   	push   %ebx
+  801874:	83 ec 04             	sub    $0x4,%esp
+  801877:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80187a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187f:	eb 03                	jmp    801884 <dev_lookup+0x14>
+  801881:	83 c0 01             	add    $0x1,%eax
+  801884:	8b 1c 85 b4 2f 80 00 	mov    0x802fb4(,%eax,4),%ebx
+  80188b:	85 db                	test   %ebx,%ebx
+  80188d:	74 0b                	je     80189a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80188f:	39 13                	cmp    %edx,(%ebx)
+  801891:	75 ee                	jne    801881 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801893:	b8 00 00 00 00       	mov    $0x0,%eax
+  801898:	eb 2e                	jmp    8018c8 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80189a:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80189c:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8018a1:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018a7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018ac:	76 24                	jbe    8018d2 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018ae:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018b1:	83 ec 04             	sub    $0x4,%esp
+  8018b4:	52                   	push   %edx
+  8018b5:	50                   	push   %eax
+  8018b6:	68 38 2f 80 00       	push   $0x802f38
+  8018bb:	e8 2d e9 ff ff       	call   8001ed <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018c0:	83 c4 10             	add    $0x10,%esp
+  8018c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018cb:	89 1a                	mov    %ebx,(%edx)
+}
+  8018cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d0:	c9                   	leave
+  8018d1:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018d2:	c1 e8 10             	shr    $0x10,%eax
+  8018d5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018db:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018e1:	eb cb                	jmp    8018ae <dev_lookup+0x3e>
+
+008018e3 <fd_close>:
+{
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	57                   	push   %edi
+  8018e7:	56                   	push   %esi
+  8018e8:	53                   	push   %ebx
+  8018e9:	83 ec 24             	sub    $0x24,%esp
+  8018ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018f2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018f5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018f6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018fc:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018ff:	50                   	push   %eax
+  801900:	e8 1b ff ff ff       	call   801820 <fd_lookup>
+  801905:	89 c3                	mov    %eax,%ebx
+  801907:	83 c4 10             	add    $0x10,%esp
+  80190a:	85 c0                	test   %eax,%eax
+  80190c:	78 05                	js     801913 <fd_close+0x30>
+	    || fd != fd2)
+  80190e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801911:	74 16                	je     801929 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801913:	89 f8                	mov    %edi,%eax
+  801915:	84 c0                	test   %al,%al
+  801917:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80191f:	89 d8                	mov    %ebx,%eax
+  801921:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801924:	5b                   	pop    %ebx
+  801925:	5e                   	pop    %esi
+  801926:	5f                   	pop    %edi
+  801927:	5d                   	pop    %ebp
+  801928:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801929:	83 ec 08             	sub    $0x8,%esp
+  80192c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80192f:	50                   	push   %eax
+  801930:	ff 36                	push   (%esi)
+  801932:	e8 39 ff ff ff       	call   801870 <dev_lookup>
+  801937:	89 c3                	mov    %eax,%ebx
+  801939:	83 c4 10             	add    $0x10,%esp
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	78 1a                	js     80195a <fd_close+0x77>
+		if (dev->dev_close)
+  801940:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801943:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801946:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80194b:	85 c0                	test   %eax,%eax
+  80194d:	74 0b                	je     80195a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80194f:	83 ec 0c             	sub    $0xc,%esp
+  801952:	56                   	push   %esi
+  801953:	ff d0                	call   *%eax
+  801955:	89 c3                	mov    %eax,%ebx
+  801957:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80195a:	83 ec 08             	sub    $0x8,%esp
+  80195d:	56                   	push   %esi
+  80195e:	6a 00                	push   $0x0
+  801960:	e8 a3 f4 ff ff       	call   800e08 <sys_page_unmap>
+	return r;
+  801965:	83 c4 10             	add    $0x10,%esp
+  801968:	eb b5                	jmp    80191f <fd_close+0x3c>
+
+0080196a <close>:
+
+int
+close(int fdnum)
+{
+  80196a:	55                   	push   %ebp
+  80196b:	89 e5                	mov    %esp,%ebp
+  80196d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801970:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801973:	50                   	push   %eax
+  801974:	ff 75 08             	push   0x8(%ebp)
+  801977:	e8 a4 fe ff ff       	call   801820 <fd_lookup>
+  80197c:	83 c4 10             	add    $0x10,%esp
+  80197f:	85 c0                	test   %eax,%eax
+  801981:	79 02                	jns    801985 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801983:	c9                   	leave
+  801984:	c3                   	ret
+		return fd_close(fd, 1);
+  801985:	83 ec 08             	sub    $0x8,%esp
+  801988:	6a 01                	push   $0x1
+  80198a:	ff 75 f4             	push   -0xc(%ebp)
+  80198d:	e8 51 ff ff ff       	call   8018e3 <fd_close>
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	eb ec                	jmp    801983 <close+0x19>
+
+00801997 <close_all>:
+
+void
+close_all(void)
+{
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	53                   	push   %ebx
+  80199b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80199e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019a3:	83 ec 0c             	sub    $0xc,%esp
+  8019a6:	53                   	push   %ebx
+  8019a7:	e8 be ff ff ff       	call   80196a <close>
+	for (i = 0; i < MAXFD; i++)
+  8019ac:	83 c3 01             	add    $0x1,%ebx
+  8019af:	83 c4 10             	add    $0x10,%esp
+  8019b2:	83 fb 20             	cmp    $0x20,%ebx
+  8019b5:	75 ec                	jne    8019a3 <close_all+0xc>
+}
+  8019b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ba:	c9                   	leave
+  8019bb:	c3                   	ret
+
+008019bc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019bc:	55                   	push   %ebp
+  8019bd:	89 e5                	mov    %esp,%ebp
+  8019bf:	57                   	push   %edi
+  8019c0:	56                   	push   %esi
+  8019c1:	53                   	push   %ebx
+  8019c2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019c5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019c8:	50                   	push   %eax
+  8019c9:	ff 75 08             	push   0x8(%ebp)
+  8019cc:	e8 4f fe ff ff       	call   801820 <fd_lookup>
+  8019d1:	89 c3                	mov    %eax,%ebx
+  8019d3:	83 c4 10             	add    $0x10,%esp
+  8019d6:	85 c0                	test   %eax,%eax
+  8019d8:	78 7f                	js     801a59 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019da:	83 ec 0c             	sub    $0xc,%esp
+  8019dd:	ff 75 0c             	push   0xc(%ebp)
+  8019e0:	e8 85 ff ff ff       	call   80196a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019e8:	c1 e6 0c             	shl    $0xc,%esi
+  8019eb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019f4:	89 3c 24             	mov    %edi,(%esp)
+  8019f7:	e8 b7 fd ff ff       	call   8017b3 <fd2data>
+  8019fc:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019fe:	89 34 24             	mov    %esi,(%esp)
+  801a01:	e8 ad fd ff ff       	call   8017b3 <fd2data>
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a0c:	89 d8                	mov    %ebx,%eax
+  801a0e:	c1 e8 16             	shr    $0x16,%eax
+  801a11:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a18:	a8 01                	test   $0x1,%al
+  801a1a:	74 11                	je     801a2d <dup+0x71>
+  801a1c:	89 d8                	mov    %ebx,%eax
+  801a1e:	c1 e8 0c             	shr    $0xc,%eax
+  801a21:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a28:	f6 c2 01             	test   $0x1,%dl
+  801a2b:	75 36                	jne    801a63 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a2d:	89 f8                	mov    %edi,%eax
+  801a2f:	c1 e8 0c             	shr    $0xc,%eax
+  801a32:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a39:	83 ec 0c             	sub    $0xc,%esp
+  801a3c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a41:	50                   	push   %eax
+  801a42:	56                   	push   %esi
+  801a43:	6a 00                	push   $0x0
+  801a45:	57                   	push   %edi
+  801a46:	6a 00                	push   $0x0
+  801a48:	e8 4d f3 ff ff       	call   800d9a <sys_page_map>
+  801a4d:	89 c3                	mov    %eax,%ebx
+  801a4f:	83 c4 20             	add    $0x20,%esp
+  801a52:	85 c0                	test   %eax,%eax
+  801a54:	78 33                	js     801a89 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a59:	89 d8                	mov    %ebx,%eax
+  801a5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5e:	5b                   	pop    %ebx
+  801a5f:	5e                   	pop    %esi
+  801a60:	5f                   	pop    %edi
+  801a61:	5d                   	pop    %ebp
+  801a62:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a63:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a6a:	83 ec 0c             	sub    $0xc,%esp
+  801a6d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a72:	50                   	push   %eax
+  801a73:	ff 75 d4             	push   -0x2c(%ebp)
+  801a76:	6a 00                	push   $0x0
+  801a78:	53                   	push   %ebx
+  801a79:	6a 00                	push   $0x0
+  801a7b:	e8 1a f3 ff ff       	call   800d9a <sys_page_map>
+  801a80:	89 c3                	mov    %eax,%ebx
+  801a82:	83 c4 20             	add    $0x20,%esp
+  801a85:	85 c0                	test   %eax,%eax
+  801a87:	79 a4                	jns    801a2d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a89:	83 ec 08             	sub    $0x8,%esp
+  801a8c:	56                   	push   %esi
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	e8 74 f3 ff ff       	call   800e08 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a94:	83 c4 08             	add    $0x8,%esp
+  801a97:	ff 75 d4             	push   -0x2c(%ebp)
+  801a9a:	6a 00                	push   $0x0
+  801a9c:	e8 67 f3 ff ff       	call   800e08 <sys_page_unmap>
+	return r;
+  801aa1:	83 c4 10             	add    $0x10,%esp
+  801aa4:	eb b3                	jmp    801a59 <dup+0x9d>
+
+00801aa6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801aa6:	55                   	push   %ebp
+  801aa7:	89 e5                	mov    %esp,%ebp
+  801aa9:	56                   	push   %esi
+  801aaa:	53                   	push   %ebx
+  801aab:	83 ec 18             	sub    $0x18,%esp
+  801aae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ab1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ab4:	50                   	push   %eax
+  801ab5:	53                   	push   %ebx
+  801ab6:	e8 65 fd ff ff       	call   801820 <fd_lookup>
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	78 3c                	js     801afe <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ac2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ac5:	83 ec 08             	sub    $0x8,%esp
+  801ac8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801acb:	50                   	push   %eax
+  801acc:	ff 36                	push   (%esi)
+  801ace:	e8 9d fd ff ff       	call   801870 <dev_lookup>
+  801ad3:	83 c4 10             	add    $0x10,%esp
+  801ad6:	85 c0                	test   %eax,%eax
+  801ad8:	78 24                	js     801afe <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ada:	8b 46 08             	mov    0x8(%esi),%eax
+  801add:	83 e0 03             	and    $0x3,%eax
+  801ae0:	83 f8 01             	cmp    $0x1,%eax
+  801ae3:	74 20                	je     801b05 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ae5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ae8:	8b 40 08             	mov    0x8(%eax),%eax
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	74 57                	je     801b46 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801aef:	83 ec 04             	sub    $0x4,%esp
+  801af2:	ff 75 10             	push   0x10(%ebp)
+  801af5:	ff 75 0c             	push   0xc(%ebp)
+  801af8:	56                   	push   %esi
+  801af9:	ff d0                	call   *%eax
+  801afb:	83 c4 10             	add    $0x10,%esp
+}
+  801afe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b01:	5b                   	pop    %ebx
+  801b02:	5e                   	pop    %esi
+  801b03:	5d                   	pop    %ebp
+  801b04:	c3                   	ret
+  801b05:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b07:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b0c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b12:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b17:	76 1c                	jbe    801b35 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b19:	8b 42 48             	mov    0x48(%edx),%eax
+  801b1c:	83 ec 04             	sub    $0x4,%esp
+  801b1f:	53                   	push   %ebx
+  801b20:	50                   	push   %eax
+  801b21:	68 79 2f 80 00       	push   $0x802f79
+  801b26:	e8 c2 e6 ff ff       	call   8001ed <cprintf>
+		return -E_INVAL;
+  801b2b:	83 c4 10             	add    $0x10,%esp
+  801b2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b33:	eb c9                	jmp    801afe <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b35:	c1 e8 10             	shr    $0x10,%eax
+  801b38:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b3e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b44:	eb d3                	jmp    801b19 <read+0x73>
+		return -E_NOT_SUPP;
+  801b46:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b4b:	eb b1                	jmp    801afe <read+0x58>
+
+00801b4d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b4d:	55                   	push   %ebp
+  801b4e:	89 e5                	mov    %esp,%ebp
+  801b50:	57                   	push   %edi
+  801b51:	56                   	push   %esi
+  801b52:	53                   	push   %ebx
+  801b53:	83 ec 0c             	sub    $0xc,%esp
+  801b56:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b59:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b61:	eb 02                	jmp    801b65 <readn+0x18>
+  801b63:	01 c3                	add    %eax,%ebx
+  801b65:	39 f3                	cmp    %esi,%ebx
+  801b67:	73 21                	jae    801b8a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b69:	83 ec 04             	sub    $0x4,%esp
+  801b6c:	89 f0                	mov    %esi,%eax
+  801b6e:	29 d8                	sub    %ebx,%eax
+  801b70:	50                   	push   %eax
+  801b71:	89 d8                	mov    %ebx,%eax
+  801b73:	03 45 0c             	add    0xc(%ebp),%eax
+  801b76:	50                   	push   %eax
+  801b77:	57                   	push   %edi
+  801b78:	e8 29 ff ff ff       	call   801aa6 <read>
+		if (m < 0)
+  801b7d:	83 c4 10             	add    $0x10,%esp
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	78 04                	js     801b88 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b84:	75 dd                	jne    801b63 <readn+0x16>
+  801b86:	eb 02                	jmp    801b8a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b88:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b8a:	89 d8                	mov    %ebx,%eax
+  801b8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8f:	5b                   	pop    %ebx
+  801b90:	5e                   	pop    %esi
+  801b91:	5f                   	pop    %edi
+  801b92:	5d                   	pop    %ebp
+  801b93:	c3                   	ret
+
+00801b94 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b94:	55                   	push   %ebp
+  801b95:	89 e5                	mov    %esp,%ebp
+  801b97:	56                   	push   %esi
+  801b98:	53                   	push   %ebx
+  801b99:	83 ec 18             	sub    $0x18,%esp
+  801b9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b9f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ba2:	50                   	push   %eax
+  801ba3:	53                   	push   %ebx
+  801ba4:	e8 77 fc ff ff       	call   801820 <fd_lookup>
+  801ba9:	83 c4 10             	add    $0x10,%esp
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	78 37                	js     801be7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bb0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bb3:	83 ec 08             	sub    $0x8,%esp
+  801bb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb9:	50                   	push   %eax
+  801bba:	ff 36                	push   (%esi)
+  801bbc:	e8 af fc ff ff       	call   801870 <dev_lookup>
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 1f                	js     801be7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bc8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bcc:	74 20                	je     801bee <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	74 57                	je     801c2f <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bd8:	83 ec 04             	sub    $0x4,%esp
+  801bdb:	ff 75 10             	push   0x10(%ebp)
+  801bde:	ff 75 0c             	push   0xc(%ebp)
+  801be1:	56                   	push   %esi
+  801be2:	ff d0                	call   *%eax
+  801be4:	83 c4 10             	add    $0x10,%esp
+}
+  801be7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bea:	5b                   	pop    %ebx
+  801beb:	5e                   	pop    %esi
+  801bec:	5d                   	pop    %ebp
+  801bed:	c3                   	ret
+  801bee:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bf0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bf5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bfb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c00:	76 1c                	jbe    801c1e <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c02:	8b 42 48             	mov    0x48(%edx),%eax
+  801c05:	83 ec 04             	sub    $0x4,%esp
+  801c08:	53                   	push   %ebx
+  801c09:	50                   	push   %eax
+  801c0a:	68 95 2f 80 00       	push   $0x802f95
+  801c0f:	e8 d9 e5 ff ff       	call   8001ed <cprintf>
+		return -E_INVAL;
+  801c14:	83 c4 10             	add    $0x10,%esp
+  801c17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c1c:	eb c9                	jmp    801be7 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c1e:	c1 e8 10             	shr    $0x10,%eax
+  801c21:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c27:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c2d:	eb d3                	jmp    801c02 <write+0x6e>
+		return -E_NOT_SUPP;
+  801c2f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c34:	eb b1                	jmp    801be7 <write+0x53>
+
+00801c36 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c36:	55                   	push   %ebp
+  801c37:	89 e5                	mov    %esp,%ebp
+  801c39:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c3f:	50                   	push   %eax
+  801c40:	ff 75 08             	push   0x8(%ebp)
+  801c43:	e8 d8 fb ff ff       	call   801820 <fd_lookup>
+  801c48:	83 c4 10             	add    $0x10,%esp
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	78 0e                	js     801c5d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c55:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+
+00801c5f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c5f:	55                   	push   %ebp
+  801c60:	89 e5                	mov    %esp,%ebp
+  801c62:	56                   	push   %esi
+  801c63:	53                   	push   %ebx
+  801c64:	83 ec 18             	sub    $0x18,%esp
+  801c67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c6a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c6d:	50                   	push   %eax
+  801c6e:	53                   	push   %ebx
+  801c6f:	e8 ac fb ff ff       	call   801820 <fd_lookup>
+  801c74:	83 c4 10             	add    $0x10,%esp
+  801c77:	85 c0                	test   %eax,%eax
+  801c79:	78 34                	js     801caf <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c7b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c7e:	83 ec 08             	sub    $0x8,%esp
+  801c81:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c84:	50                   	push   %eax
+  801c85:	ff 36                	push   (%esi)
+  801c87:	e8 e4 fb ff ff       	call   801870 <dev_lookup>
+  801c8c:	83 c4 10             	add    $0x10,%esp
+  801c8f:	85 c0                	test   %eax,%eax
+  801c91:	78 1c                	js     801caf <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c93:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c97:	74 1d                	je     801cb6 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c9c:	8b 40 18             	mov    0x18(%eax),%eax
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	74 54                	je     801cf7 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ca3:	83 ec 08             	sub    $0x8,%esp
+  801ca6:	ff 75 0c             	push   0xc(%ebp)
+  801ca9:	56                   	push   %esi
+  801caa:	ff d0                	call   *%eax
+  801cac:	83 c4 10             	add    $0x10,%esp
+}
+  801caf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb2:	5b                   	pop    %ebx
+  801cb3:	5e                   	pop    %esi
+  801cb4:	5d                   	pop    %ebp
+  801cb5:	c3                   	ret
+  801cb6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cb8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cbd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cc3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cc8:	76 1c                	jbe    801ce6 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cca:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ccd:	83 ec 04             	sub    $0x4,%esp
+  801cd0:	53                   	push   %ebx
+  801cd1:	50                   	push   %eax
+  801cd2:	68 58 2f 80 00       	push   $0x802f58
+  801cd7:	e8 11 e5 ff ff       	call   8001ed <cprintf>
+		return -E_INVAL;
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce4:	eb c9                	jmp    801caf <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ce6:	c1 e8 10             	shr    $0x10,%eax
+  801ce9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cef:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cf5:	eb d3                	jmp    801cca <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801cf7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cfc:	eb b1                	jmp    801caf <ftruncate+0x50>
+
+00801cfe <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	56                   	push   %esi
+  801d02:	53                   	push   %ebx
+  801d03:	83 ec 18             	sub    $0x18,%esp
+  801d06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d09:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d0c:	50                   	push   %eax
+  801d0d:	ff 75 08             	push   0x8(%ebp)
+  801d10:	e8 0b fb ff ff       	call   801820 <fd_lookup>
+  801d15:	83 c4 10             	add    $0x10,%esp
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	78 49                	js     801d65 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d1c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d1f:	83 ec 08             	sub    $0x8,%esp
+  801d22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d25:	50                   	push   %eax
+  801d26:	ff 36                	push   (%esi)
+  801d28:	e8 43 fb ff ff       	call   801870 <dev_lookup>
+  801d2d:	83 c4 10             	add    $0x10,%esp
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	78 31                	js     801d65 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d37:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d3b:	74 2f                	je     801d6c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d3d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d40:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d47:	00 00 00 
+	stat->st_isdir = 0;
+  801d4a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d51:	00 00 00 
+	stat->st_dev = dev;
+  801d54:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d5a:	83 ec 08             	sub    $0x8,%esp
+  801d5d:	53                   	push   %ebx
+  801d5e:	56                   	push   %esi
+  801d5f:	ff 50 14             	call   *0x14(%eax)
+  801d62:	83 c4 10             	add    $0x10,%esp
+}
+  801d65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d68:	5b                   	pop    %ebx
+  801d69:	5e                   	pop    %esi
+  801d6a:	5d                   	pop    %ebp
+  801d6b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d6c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d71:	eb f2                	jmp    801d65 <fstat+0x67>
+
+00801d73 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	56                   	push   %esi
+  801d77:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d78:	83 ec 08             	sub    $0x8,%esp
+  801d7b:	6a 00                	push   $0x0
+  801d7d:	ff 75 08             	push   0x8(%ebp)
+  801d80:	e8 e4 01 00 00       	call   801f69 <open>
+  801d85:	89 c3                	mov    %eax,%ebx
+  801d87:	83 c4 10             	add    $0x10,%esp
+  801d8a:	85 c0                	test   %eax,%eax
+  801d8c:	78 1b                	js     801da9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d8e:	83 ec 08             	sub    $0x8,%esp
+  801d91:	ff 75 0c             	push   0xc(%ebp)
+  801d94:	50                   	push   %eax
+  801d95:	e8 64 ff ff ff       	call   801cfe <fstat>
+  801d9a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d9c:	89 1c 24             	mov    %ebx,(%esp)
+  801d9f:	e8 c6 fb ff ff       	call   80196a <close>
+	return r;
+  801da4:	83 c4 10             	add    $0x10,%esp
+  801da7:	89 f3                	mov    %esi,%ebx
+}
+  801da9:	89 d8                	mov    %ebx,%eax
+  801dab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dae:	5b                   	pop    %ebx
+  801daf:	5e                   	pop    %esi
+  801db0:	5d                   	pop    %ebp
+  801db1:	c3                   	ret
+
+00801db2 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801db2:	55                   	push   %ebp
+  801db3:	89 e5                	mov    %esp,%ebp
+  801db5:	56                   	push   %esi
+  801db6:	53                   	push   %ebx
+  801db7:	89 c6                	mov    %eax,%esi
+  801db9:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801dbb:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801dc2:	74 27                	je     801deb <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dc4:	6a 07                	push   $0x7
+  801dc6:	68 00 60 80 00       	push   $0x806000
+  801dcb:	56                   	push   %esi
+  801dcc:	ff 35 00 50 80 00    	push   0x805000
+  801dd2:	e8 b2 0c 00 00       	call   802a89 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801dd7:	83 c4 0c             	add    $0xc,%esp
+  801dda:	6a 00                	push   $0x0
+  801ddc:	53                   	push   %ebx
+  801ddd:	6a 00                	push   $0x0
+  801ddf:	e8 8d 0c 00 00       	call   802a71 <ipc_recv>
+}
+  801de4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de7:	5b                   	pop    %ebx
+  801de8:	5e                   	pop    %esi
+  801de9:	5d                   	pop    %ebp
+  801dea:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801deb:	83 ec 0c             	sub    $0xc,%esp
+  801dee:	6a 01                	push   $0x1
+  801df0:	e8 e8 0c 00 00       	call   802add <ipc_find_env>
+  801df5:	a3 00 50 80 00       	mov    %eax,0x805000
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	eb c5                	jmp    801dc4 <fsipc+0x12>
+
+00801dff <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801dff:	55                   	push   %ebp
+  801e00:	89 e5                	mov    %esp,%ebp
+  801e02:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e08:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e0b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e13:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e1d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e22:	e8 8b ff ff ff       	call   801db2 <fsipc>
+}
+  801e27:	c9                   	leave
+  801e28:	c3                   	ret
+
+00801e29 <devfile_flush>:
+{
+  801e29:	55                   	push   %ebp
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e32:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e35:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e44:	e8 69 ff ff ff       	call   801db2 <fsipc>
+}
+  801e49:	c9                   	leave
+  801e4a:	c3                   	ret
+
+00801e4b <devfile_stat>:
+{
+  801e4b:	55                   	push   %ebp
+  801e4c:	89 e5                	mov    %esp,%ebp
+  801e4e:	53                   	push   %ebx
+  801e4f:	83 ec 04             	sub    $0x4,%esp
+  801e52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e58:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e5b:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e65:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e6a:	e8 43 ff ff ff       	call   801db2 <fsipc>
+  801e6f:	85 c0                	test   %eax,%eax
+  801e71:	78 2c                	js     801e9f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e73:	83 ec 08             	sub    $0x8,%esp
+  801e76:	68 00 60 80 00       	push   $0x806000
+  801e7b:	53                   	push   %ebx
+  801e7c:	e8 b4 e9 ff ff       	call   800835 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e81:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e86:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e8c:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e91:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e97:	83 c4 10             	add    $0x10,%esp
+  801e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea2:	c9                   	leave
+  801ea3:	c3                   	ret
+
+00801ea4 <devfile_write>:
+{
+  801ea4:	55                   	push   %ebp
+  801ea5:	89 e5                	mov    %esp,%ebp
+  801ea7:	83 ec 0c             	sub    $0xc,%esp
+  801eaa:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb0:	8b 52 0c             	mov    0xc(%edx),%edx
+  801eb3:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801eb9:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801ebe:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ec3:	39 d0                	cmp    %edx,%eax
+  801ec5:	0f 47 c2             	cmova  %edx,%eax
+  801ec8:	50                   	push   %eax
+  801ec9:	ff 75 0c             	push   0xc(%ebp)
+  801ecc:	68 08 60 80 00       	push   $0x806008
+  801ed1:	e8 e5 ea ff ff       	call   8009bb <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801ed6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ee0:	e8 cd fe ff ff       	call   801db2 <fsipc>
+}
+  801ee5:	c9                   	leave
+  801ee6:	c3                   	ret
+
+00801ee7 <devfile_read>:
+{
+  801ee7:	55                   	push   %ebp
+  801ee8:	89 e5                	mov    %esp,%ebp
+  801eea:	56                   	push   %esi
+  801eeb:	53                   	push   %ebx
+  801eec:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801eef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801efa:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f00:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f05:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f0a:	e8 a3 fe ff ff       	call   801db2 <fsipc>
+  801f0f:	89 c3                	mov    %eax,%ebx
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	78 1f                	js     801f34 <devfile_read+0x4d>
+	assert(r <= n);
+  801f15:	39 c6                	cmp    %eax,%esi
+  801f17:	72 24                	jb     801f3d <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f19:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f1e:	7f 33                	jg     801f53 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f20:	83 ec 04             	sub    $0x4,%esp
+  801f23:	50                   	push   %eax
+  801f24:	68 00 60 80 00       	push   $0x806000
+  801f29:	ff 75 0c             	push   0xc(%ebp)
+  801f2c:	e8 8a ea ff ff       	call   8009bb <memmove>
+	return r;
+  801f31:	83 c4 10             	add    $0x10,%esp
+}
+  801f34:	89 d8                	mov    %ebx,%eax
+  801f36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f39:	5b                   	pop    %ebx
+  801f3a:	5e                   	pop    %esi
+  801f3b:	5d                   	pop    %ebp
+  801f3c:	c3                   	ret
+	assert(r <= n);
+  801f3d:	68 c8 2f 80 00       	push   $0x802fc8
+  801f42:	68 cf 2f 80 00       	push   $0x802fcf
+  801f47:	6a 76                	push   $0x76
+  801f49:	68 e4 2f 80 00       	push   $0x802fe4
+  801f4e:	e8 bf e1 ff ff       	call   800112 <_panic>
+	assert(r <= PGSIZE);
+  801f53:	68 ef 2f 80 00       	push   $0x802fef
+  801f58:	68 cf 2f 80 00       	push   $0x802fcf
+  801f5d:	6a 77                	push   $0x77
+  801f5f:	68 e4 2f 80 00       	push   $0x802fe4
+  801f64:	e8 a9 e1 ff ff       	call   800112 <_panic>
+
+00801f69 <open>:
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	56                   	push   %esi
+  801f6d:	53                   	push   %ebx
+  801f6e:	83 ec 1c             	sub    $0x1c,%esp
+  801f71:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f74:	56                   	push   %esi
+  801f75:	e8 80 e8 ff ff       	call   8007fa <strlen>
+  801f7a:	83 c4 10             	add    $0x10,%esp
+  801f7d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f82:	7f 6c                	jg     801ff0 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f84:	83 ec 0c             	sub    $0xc,%esp
+  801f87:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f8a:	50                   	push   %eax
+  801f8b:	e8 3a f8 ff ff       	call   8017ca <fd_alloc>
+  801f90:	89 c3                	mov    %eax,%ebx
+  801f92:	83 c4 10             	add    $0x10,%esp
+  801f95:	85 c0                	test   %eax,%eax
+  801f97:	78 3c                	js     801fd5 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f99:	83 ec 08             	sub    $0x8,%esp
+  801f9c:	56                   	push   %esi
+  801f9d:	68 00 60 80 00       	push   $0x806000
+  801fa2:	e8 8e e8 ff ff       	call   800835 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801fa7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801faa:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801faf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fb2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fb7:	e8 f6 fd ff ff       	call   801db2 <fsipc>
+  801fbc:	89 c3                	mov    %eax,%ebx
+  801fbe:	83 c4 10             	add    $0x10,%esp
+  801fc1:	85 c0                	test   %eax,%eax
+  801fc3:	78 19                	js     801fde <open+0x75>
+	return fd2num(fd);
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+  801fc8:	ff 75 f4             	push   -0xc(%ebp)
+  801fcb:	e8 d3 f7 ff ff       	call   8017a3 <fd2num>
+  801fd0:	89 c3                	mov    %eax,%ebx
+  801fd2:	83 c4 10             	add    $0x10,%esp
+}
+  801fd5:	89 d8                	mov    %ebx,%eax
+  801fd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fda:	5b                   	pop    %ebx
+  801fdb:	5e                   	pop    %esi
+  801fdc:	5d                   	pop    %ebp
+  801fdd:	c3                   	ret
+		fd_close(fd, 0);
+  801fde:	83 ec 08             	sub    $0x8,%esp
+  801fe1:	6a 00                	push   $0x0
+  801fe3:	ff 75 f4             	push   -0xc(%ebp)
+  801fe6:	e8 f8 f8 ff ff       	call   8018e3 <fd_close>
+		return r;
+  801feb:	83 c4 10             	add    $0x10,%esp
+  801fee:	eb e5                	jmp    801fd5 <open+0x6c>
+		return -E_BAD_PATH;
+  801ff0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ff5:	eb de                	jmp    801fd5 <open+0x6c>
+
+00801ff7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ff7:	55                   	push   %ebp
+  801ff8:	89 e5                	mov    %esp,%ebp
+  801ffa:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802002:	b8 08 00 00 00       	mov    $0x8,%eax
+  802007:	e8 a6 fd ff ff       	call   801db2 <fsipc>
+}
+  80200c:	c9                   	leave
+  80200d:	c3                   	ret
+
+0080200e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80200e:	55                   	push   %ebp
+  80200f:	89 e5                	mov    %esp,%ebp
+  802011:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802014:	68 fb 2f 80 00       	push   $0x802ffb
+  802019:	ff 75 0c             	push   0xc(%ebp)
+  80201c:	e8 14 e8 ff ff       	call   800835 <strcpy>
+	return 0;
+}
+  802021:	b8 00 00 00 00       	mov    $0x0,%eax
+  802026:	c9                   	leave
+  802027:	c3                   	ret
+
+00802028 <devsock_close>:
+{
+  802028:	55                   	push   %ebp
+  802029:	89 e5                	mov    %esp,%ebp
+  80202b:	53                   	push   %ebx
+  80202c:	83 ec 10             	sub    $0x10,%esp
+  80202f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802032:	53                   	push   %ebx
+  802033:	e8 e4 0a 00 00       	call   802b1c <pageref>
+  802038:	89 c2                	mov    %eax,%edx
+  80203a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80203d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802042:	83 fa 01             	cmp    $0x1,%edx
+  802045:	74 05                	je     80204c <devsock_close+0x24>
+}
+  802047:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80204a:	c9                   	leave
+  80204b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80204c:	83 ec 0c             	sub    $0xc,%esp
+  80204f:	ff 73 0c             	push   0xc(%ebx)
+  802052:	e8 b7 02 00 00       	call   80230e <nsipc_close>
+  802057:	83 c4 10             	add    $0x10,%esp
+  80205a:	eb eb                	jmp    802047 <devsock_close+0x1f>
+
+0080205c <devsock_write>:
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802062:	6a 00                	push   $0x0
+  802064:	ff 75 10             	push   0x10(%ebp)
+  802067:	ff 75 0c             	push   0xc(%ebp)
+  80206a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206d:	ff 70 0c             	push   0xc(%eax)
+  802070:	e8 79 03 00 00       	call   8023ee <nsipc_send>
+}
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+
+00802077 <devsock_read>:
+{
+  802077:	55                   	push   %ebp
+  802078:	89 e5                	mov    %esp,%ebp
+  80207a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80207d:	6a 00                	push   $0x0
+  80207f:	ff 75 10             	push   0x10(%ebp)
+  802082:	ff 75 0c             	push   0xc(%ebp)
+  802085:	8b 45 08             	mov    0x8(%ebp),%eax
+  802088:	ff 70 0c             	push   0xc(%eax)
+  80208b:	e8 ef 02 00 00       	call   80237f <nsipc_recv>
+}
+  802090:	c9                   	leave
+  802091:	c3                   	ret
+
+00802092 <fd2sockid>:
+{
+  802092:	55                   	push   %ebp
+  802093:	89 e5                	mov    %esp,%ebp
+  802095:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802098:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80209b:	52                   	push   %edx
+  80209c:	50                   	push   %eax
+  80209d:	e8 7e f7 ff ff       	call   801820 <fd_lookup>
+  8020a2:	83 c4 10             	add    $0x10,%esp
+  8020a5:	85 c0                	test   %eax,%eax
+  8020a7:	78 10                	js     8020b9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ac:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8020b2:	39 08                	cmp    %ecx,(%eax)
+  8020b4:	75 05                	jne    8020bb <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020b6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020b9:	c9                   	leave
+  8020ba:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020c0:	eb f7                	jmp    8020b9 <fd2sockid+0x27>
+
+008020c2 <alloc_sockfd>:
+{
+  8020c2:	55                   	push   %ebp
+  8020c3:	89 e5                	mov    %esp,%ebp
+  8020c5:	56                   	push   %esi
+  8020c6:	53                   	push   %ebx
+  8020c7:	83 ec 1c             	sub    $0x1c,%esp
+  8020ca:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020cf:	50                   	push   %eax
+  8020d0:	e8 f5 f6 ff ff       	call   8017ca <fd_alloc>
+  8020d5:	89 c3                	mov    %eax,%ebx
+  8020d7:	83 c4 10             	add    $0x10,%esp
+  8020da:	85 c0                	test   %eax,%eax
+  8020dc:	78 43                	js     802121 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020de:	83 ec 04             	sub    $0x4,%esp
+  8020e1:	68 07 04 00 00       	push   $0x407
+  8020e6:	ff 75 f4             	push   -0xc(%ebp)
+  8020e9:	6a 00                	push   $0x0
+  8020eb:	e8 3d ec ff ff       	call   800d2d <sys_page_alloc>
+  8020f0:	89 c3                	mov    %eax,%ebx
+  8020f2:	83 c4 10             	add    $0x10,%esp
+  8020f5:	85 c0                	test   %eax,%eax
+  8020f7:	78 28                	js     802121 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020fc:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802102:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802104:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802107:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80210e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802111:	83 ec 0c             	sub    $0xc,%esp
+  802114:	50                   	push   %eax
+  802115:	e8 89 f6 ff ff       	call   8017a3 <fd2num>
+  80211a:	89 c3                	mov    %eax,%ebx
+  80211c:	83 c4 10             	add    $0x10,%esp
+  80211f:	eb 0c                	jmp    80212d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802121:	83 ec 0c             	sub    $0xc,%esp
+  802124:	56                   	push   %esi
+  802125:	e8 e4 01 00 00       	call   80230e <nsipc_close>
+		return r;
+  80212a:	83 c4 10             	add    $0x10,%esp
+}
+  80212d:	89 d8                	mov    %ebx,%eax
+  80212f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802132:	5b                   	pop    %ebx
+  802133:	5e                   	pop    %esi
+  802134:	5d                   	pop    %ebp
+  802135:	c3                   	ret
+
+00802136 <accept>:
+{
+  802136:	55                   	push   %ebp
+  802137:	89 e5                	mov    %esp,%ebp
+  802139:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80213c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80213f:	e8 4e ff ff ff       	call   802092 <fd2sockid>
+  802144:	85 c0                	test   %eax,%eax
+  802146:	78 1b                	js     802163 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802148:	83 ec 04             	sub    $0x4,%esp
+  80214b:	ff 75 10             	push   0x10(%ebp)
+  80214e:	ff 75 0c             	push   0xc(%ebp)
+  802151:	50                   	push   %eax
+  802152:	e8 0e 01 00 00       	call   802265 <nsipc_accept>
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	78 05                	js     802163 <accept+0x2d>
+	return alloc_sockfd(r);
+  80215e:	e8 5f ff ff ff       	call   8020c2 <alloc_sockfd>
+}
+  802163:	c9                   	leave
+  802164:	c3                   	ret
+
+00802165 <bind>:
+{
+  802165:	55                   	push   %ebp
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80216b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216e:	e8 1f ff ff ff       	call   802092 <fd2sockid>
+  802173:	85 c0                	test   %eax,%eax
+  802175:	78 12                	js     802189 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802177:	83 ec 04             	sub    $0x4,%esp
+  80217a:	ff 75 10             	push   0x10(%ebp)
+  80217d:	ff 75 0c             	push   0xc(%ebp)
+  802180:	50                   	push   %eax
+  802181:	e8 31 01 00 00       	call   8022b7 <nsipc_bind>
+  802186:	83 c4 10             	add    $0x10,%esp
+}
+  802189:	c9                   	leave
+  80218a:	c3                   	ret
+
+0080218b <shutdown>:
+{
+  80218b:	55                   	push   %ebp
+  80218c:	89 e5                	mov    %esp,%ebp
+  80218e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802191:	8b 45 08             	mov    0x8(%ebp),%eax
+  802194:	e8 f9 fe ff ff       	call   802092 <fd2sockid>
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	78 0f                	js     8021ac <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80219d:	83 ec 08             	sub    $0x8,%esp
+  8021a0:	ff 75 0c             	push   0xc(%ebp)
+  8021a3:	50                   	push   %eax
+  8021a4:	e8 43 01 00 00       	call   8022ec <nsipc_shutdown>
+  8021a9:	83 c4 10             	add    $0x10,%esp
+}
+  8021ac:	c9                   	leave
+  8021ad:	c3                   	ret
+
+008021ae <connect>:
+{
+  8021ae:	55                   	push   %ebp
+  8021af:	89 e5                	mov    %esp,%ebp
+  8021b1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b7:	e8 d6 fe ff ff       	call   802092 <fd2sockid>
+  8021bc:	85 c0                	test   %eax,%eax
+  8021be:	78 12                	js     8021d2 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021c0:	83 ec 04             	sub    $0x4,%esp
+  8021c3:	ff 75 10             	push   0x10(%ebp)
+  8021c6:	ff 75 0c             	push   0xc(%ebp)
+  8021c9:	50                   	push   %eax
+  8021ca:	e8 59 01 00 00       	call   802328 <nsipc_connect>
+  8021cf:	83 c4 10             	add    $0x10,%esp
+}
+  8021d2:	c9                   	leave
+  8021d3:	c3                   	ret
+
+008021d4 <listen>:
+{
+  8021d4:	55                   	push   %ebp
+  8021d5:	89 e5                	mov    %esp,%ebp
+  8021d7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021dd:	e8 b0 fe ff ff       	call   802092 <fd2sockid>
+  8021e2:	85 c0                	test   %eax,%eax
+  8021e4:	78 0f                	js     8021f5 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+  8021e9:	ff 75 0c             	push   0xc(%ebp)
+  8021ec:	50                   	push   %eax
+  8021ed:	e8 6b 01 00 00       	call   80235d <nsipc_listen>
+  8021f2:	83 c4 10             	add    $0x10,%esp
+}
+  8021f5:	c9                   	leave
+  8021f6:	c3                   	ret
+
+008021f7 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021fd:	ff 75 10             	push   0x10(%ebp)
+  802200:	ff 75 0c             	push   0xc(%ebp)
+  802203:	ff 75 08             	push   0x8(%ebp)
+  802206:	e8 41 02 00 00       	call   80244c <nsipc_socket>
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	78 05                	js     802217 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802212:	e8 ab fe ff ff       	call   8020c2 <alloc_sockfd>
+}
+  802217:	c9                   	leave
+  802218:	c3                   	ret
+
+00802219 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802219:	55                   	push   %ebp
+  80221a:	89 e5                	mov    %esp,%ebp
+  80221c:	53                   	push   %ebx
+  80221d:	83 ec 04             	sub    $0x4,%esp
+  802220:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802222:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802229:	74 26                	je     802251 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80222b:	6a 07                	push   $0x7
+  80222d:	68 00 70 80 00       	push   $0x807000
+  802232:	53                   	push   %ebx
+  802233:	ff 35 04 50 80 00    	push   0x805004
+  802239:	e8 4b 08 00 00       	call   802a89 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80223e:	83 c4 0c             	add    $0xc,%esp
+  802241:	6a 00                	push   $0x0
+  802243:	6a 00                	push   $0x0
+  802245:	6a 00                	push   $0x0
+  802247:	e8 25 08 00 00       	call   802a71 <ipc_recv>
+}
+  80224c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80224f:	c9                   	leave
+  802250:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802251:	83 ec 0c             	sub    $0xc,%esp
+  802254:	6a 02                	push   $0x2
+  802256:	e8 82 08 00 00       	call   802add <ipc_find_env>
+  80225b:	a3 04 50 80 00       	mov    %eax,0x805004
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	eb c6                	jmp    80222b <nsipc+0x12>
+
+00802265 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802265:	55                   	push   %ebp
+  802266:	89 e5                	mov    %esp,%ebp
+  802268:	56                   	push   %esi
+  802269:	53                   	push   %ebx
+  80226a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80226d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802270:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802275:	8b 06                	mov    (%esi),%eax
+  802277:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80227c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802281:	e8 93 ff ff ff       	call   802219 <nsipc>
+  802286:	89 c3                	mov    %eax,%ebx
+  802288:	85 c0                	test   %eax,%eax
+  80228a:	79 09                	jns    802295 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80228c:	89 d8                	mov    %ebx,%eax
+  80228e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802291:	5b                   	pop    %ebx
+  802292:	5e                   	pop    %esi
+  802293:	5d                   	pop    %ebp
+  802294:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802295:	83 ec 04             	sub    $0x4,%esp
+  802298:	ff 35 10 70 80 00    	push   0x807010
+  80229e:	68 00 70 80 00       	push   $0x807000
+  8022a3:	ff 75 0c             	push   0xc(%ebp)
+  8022a6:	e8 10 e7 ff ff       	call   8009bb <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022ab:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022b0:	89 06                	mov    %eax,(%esi)
+  8022b2:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022b5:	eb d5                	jmp    80228c <nsipc_accept+0x27>
+
+008022b7 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022b7:	55                   	push   %ebp
+  8022b8:	89 e5                	mov    %esp,%ebp
+  8022ba:	53                   	push   %ebx
+  8022bb:	83 ec 08             	sub    $0x8,%esp
+  8022be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c4:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022c9:	53                   	push   %ebx
+  8022ca:	ff 75 0c             	push   0xc(%ebp)
+  8022cd:	68 04 70 80 00       	push   $0x807004
+  8022d2:	e8 e4 e6 ff ff       	call   8009bb <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022d7:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022dd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022e2:	e8 32 ff ff ff       	call   802219 <nsipc>
+}
+  8022e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ea:	c9                   	leave
+  8022eb:	c3                   	ret
+
+008022ec <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022ec:	55                   	push   %ebp
+  8022ed:	89 e5                	mov    %esp,%ebp
+  8022ef:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8022fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022fd:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802302:	b8 03 00 00 00       	mov    $0x3,%eax
+  802307:	e8 0d ff ff ff       	call   802219 <nsipc>
+}
+  80230c:	c9                   	leave
+  80230d:	c3                   	ret
+
+0080230e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802314:	8b 45 08             	mov    0x8(%ebp),%eax
+  802317:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80231c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802321:	e8 f3 fe ff ff       	call   802219 <nsipc>
+}
+  802326:	c9                   	leave
+  802327:	c3                   	ret
+
+00802328 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802328:	55                   	push   %ebp
+  802329:	89 e5                	mov    %esp,%ebp
+  80232b:	53                   	push   %ebx
+  80232c:	83 ec 08             	sub    $0x8,%esp
+  80232f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802332:	8b 45 08             	mov    0x8(%ebp),%eax
+  802335:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80233a:	53                   	push   %ebx
+  80233b:	ff 75 0c             	push   0xc(%ebp)
+  80233e:	68 04 70 80 00       	push   $0x807004
+  802343:	e8 73 e6 ff ff       	call   8009bb <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802348:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80234e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802353:	e8 c1 fe ff ff       	call   802219 <nsipc>
+}
+  802358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80235b:	c9                   	leave
+  80235c:	c3                   	ret
+
+0080235d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80235d:	55                   	push   %ebp
+  80235e:	89 e5                	mov    %esp,%ebp
+  802360:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802363:	8b 45 08             	mov    0x8(%ebp),%eax
+  802366:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80236b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80236e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802373:	b8 06 00 00 00       	mov    $0x6,%eax
+  802378:	e8 9c fe ff ff       	call   802219 <nsipc>
+}
+  80237d:	c9                   	leave
+  80237e:	c3                   	ret
+
+0080237f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80237f:	55                   	push   %ebp
+  802380:	89 e5                	mov    %esp,%ebp
+  802382:	56                   	push   %esi
+  802383:	53                   	push   %ebx
+  802384:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802387:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80238f:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802395:	8b 45 14             	mov    0x14(%ebp),%eax
+  802398:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80239d:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023a2:	e8 72 fe ff ff       	call   802219 <nsipc>
+  8023a7:	89 c3                	mov    %eax,%ebx
+  8023a9:	85 c0                	test   %eax,%eax
+  8023ab:	78 22                	js     8023cf <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023ad:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023b2:	39 c6                	cmp    %eax,%esi
+  8023b4:	0f 4e c6             	cmovle %esi,%eax
+  8023b7:	39 c3                	cmp    %eax,%ebx
+  8023b9:	7f 1d                	jg     8023d8 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023bb:	83 ec 04             	sub    $0x4,%esp
+  8023be:	53                   	push   %ebx
+  8023bf:	68 00 70 80 00       	push   $0x807000
+  8023c4:	ff 75 0c             	push   0xc(%ebp)
+  8023c7:	e8 ef e5 ff ff       	call   8009bb <memmove>
+  8023cc:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023cf:	89 d8                	mov    %ebx,%eax
+  8023d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d4:	5b                   	pop    %ebx
+  8023d5:	5e                   	pop    %esi
+  8023d6:	5d                   	pop    %ebp
+  8023d7:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023d8:	68 07 30 80 00       	push   $0x803007
+  8023dd:	68 cf 2f 80 00       	push   $0x802fcf
+  8023e2:	6a 62                	push   $0x62
+  8023e4:	68 1c 30 80 00       	push   $0x80301c
+  8023e9:	e8 24 dd ff ff       	call   800112 <_panic>
+
+008023ee <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023ee:	55                   	push   %ebp
+  8023ef:	89 e5                	mov    %esp,%ebp
+  8023f1:	53                   	push   %ebx
+  8023f2:	83 ec 04             	sub    $0x4,%esp
+  8023f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fb:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802400:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802406:	7f 2e                	jg     802436 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802408:	83 ec 04             	sub    $0x4,%esp
+  80240b:	53                   	push   %ebx
+  80240c:	ff 75 0c             	push   0xc(%ebp)
+  80240f:	68 0c 70 80 00       	push   $0x80700c
+  802414:	e8 a2 e5 ff ff       	call   8009bb <memmove>
+	nsipcbuf.send.req_size = size;
+  802419:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80241f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802422:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802427:	b8 08 00 00 00       	mov    $0x8,%eax
+  80242c:	e8 e8 fd ff ff       	call   802219 <nsipc>
+}
+  802431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802434:	c9                   	leave
+  802435:	c3                   	ret
+	assert(size < 1600);
+  802436:	68 28 30 80 00       	push   $0x803028
+  80243b:	68 cf 2f 80 00       	push   $0x802fcf
+  802440:	6a 6d                	push   $0x6d
+  802442:	68 1c 30 80 00       	push   $0x80301c
+  802447:	e8 c6 dc ff ff       	call   800112 <_panic>
+
+0080244c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80244c:	55                   	push   %ebp
+  80244d:	89 e5                	mov    %esp,%ebp
+  80244f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802452:	8b 45 08             	mov    0x8(%ebp),%eax
+  802455:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80245a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80245d:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802462:	8b 45 10             	mov    0x10(%ebp),%eax
+  802465:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80246a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80246f:	e8 a5 fd ff ff       	call   802219 <nsipc>
+}
+  802474:	c9                   	leave
+  802475:	c3                   	ret
+
+00802476 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802476:	55                   	push   %ebp
+  802477:	89 e5                	mov    %esp,%ebp
+  802479:	56                   	push   %esi
+  80247a:	53                   	push   %ebx
+  80247b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80247e:	83 ec 0c             	sub    $0xc,%esp
+  802481:	ff 75 08             	push   0x8(%ebp)
+  802484:	e8 2a f3 ff ff       	call   8017b3 <fd2data>
+  802489:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80248b:	83 c4 08             	add    $0x8,%esp
+  80248e:	68 34 30 80 00       	push   $0x803034
+  802493:	53                   	push   %ebx
+  802494:	e8 9c e3 ff ff       	call   800835 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802499:	8b 46 04             	mov    0x4(%esi),%eax
+  80249c:	2b 06                	sub    (%esi),%eax
+  80249e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024a4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024ab:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024ae:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024b5:	40 80 00 
+	return 0;
+}
+  8024b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024c0:	5b                   	pop    %ebx
+  8024c1:	5e                   	pop    %esi
+  8024c2:	5d                   	pop    %ebp
+  8024c3:	c3                   	ret
+
+008024c4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024c4:	55                   	push   %ebp
+  8024c5:	89 e5                	mov    %esp,%ebp
+  8024c7:	53                   	push   %ebx
+  8024c8:	83 ec 0c             	sub    $0xc,%esp
+  8024cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024ce:	53                   	push   %ebx
+  8024cf:	6a 00                	push   $0x0
+  8024d1:	e8 32 e9 ff ff       	call   800e08 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024d6:	89 1c 24             	mov    %ebx,(%esp)
+  8024d9:	e8 d5 f2 ff ff       	call   8017b3 <fd2data>
+  8024de:	83 c4 08             	add    $0x8,%esp
+  8024e1:	50                   	push   %eax
+  8024e2:	6a 00                	push   $0x0
+  8024e4:	e8 1f e9 ff ff       	call   800e08 <sys_page_unmap>
+}
+  8024e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024ec:	c9                   	leave
+  8024ed:	c3                   	ret
+
+008024ee <_pipeisclosed>:
+{
+  8024ee:	55                   	push   %ebp
+  8024ef:	89 e5                	mov    %esp,%ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 1c             	sub    $0x1c,%esp
+  8024f7:	89 c7                	mov    %eax,%edi
+  8024f9:	89 d6                	mov    %edx,%esi
+  8024fb:	eb 3c                	jmp    802539 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8024fd:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802500:	83 ec 0c             	sub    $0xc,%esp
+  802503:	57                   	push   %edi
+  802504:	e8 13 06 00 00       	call   802b1c <pageref>
+  802509:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80250c:	89 34 24             	mov    %esi,(%esp)
+  80250f:	e8 08 06 00 00       	call   802b1c <pageref>
+  802514:	89 c2                	mov    %eax,%edx
+  802516:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802518:	05 00 00 00 20       	add    $0x20000000,%eax
+  80251d:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802520:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802526:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80252b:	76 31                	jbe    80255e <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  80252d:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802530:	39 c3                	cmp    %eax,%ebx
+  802532:	74 76                	je     8025aa <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802534:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802537:	74 36                	je     80256f <_pipeisclosed+0x81>
+  802539:	89 e0                	mov    %esp,%eax
+  80253b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802540:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802546:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80254b:	77 b0                	ja     8024fd <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80254d:	c1 e8 10             	shr    $0x10,%eax
+  802550:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802556:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80255c:	eb 9f                	jmp    8024fd <_pipeisclosed+0xf>
+  80255e:	c1 e8 10             	shr    $0x10,%eax
+  802561:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802567:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80256d:	eb be                	jmp    80252d <_pipeisclosed+0x3f>
+  80256f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802571:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802576:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80257c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802581:	76 16                	jbe    802599 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802583:	8b 42 58             	mov    0x58(%edx),%eax
+  802586:	6a 01                	push   $0x1
+  802588:	50                   	push   %eax
+  802589:	53                   	push   %ebx
+  80258a:	68 3b 30 80 00       	push   $0x80303b
+  80258f:	e8 59 dc ff ff       	call   8001ed <cprintf>
+  802594:	83 c4 10             	add    $0x10,%esp
+  802597:	eb a0                	jmp    802539 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802599:	c1 e8 10             	shr    $0x10,%eax
+  80259c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025a2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025a8:	eb d9                	jmp    802583 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8025aa:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025ad:	0f 94 c0             	sete   %al
+  8025b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8025b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b6:	5b                   	pop    %ebx
+  8025b7:	5e                   	pop    %esi
+  8025b8:	5f                   	pop    %edi
+  8025b9:	5d                   	pop    %ebp
+  8025ba:	c3                   	ret
+
+008025bb <devpipe_write>:
+{
+  8025bb:	55                   	push   %ebp
+  8025bc:	89 e5                	mov    %esp,%ebp
+  8025be:	57                   	push   %edi
+  8025bf:	56                   	push   %esi
+  8025c0:	53                   	push   %ebx
+  8025c1:	83 ec 28             	sub    $0x28,%esp
+  8025c4:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025c7:	56                   	push   %esi
+  8025c8:	e8 e6 f1 ff ff       	call   8017b3 <fd2data>
+  8025cd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025cf:	83 c4 10             	add    $0x10,%esp
+  8025d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025d7:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025da:	75 09                	jne    8025e5 <devpipe_write+0x2a>
+	return i;
+  8025dc:	89 f8                	mov    %edi,%eax
+  8025de:	eb 23                	jmp    802603 <devpipe_write+0x48>
+			sys_yield();
+  8025e0:	e8 02 e7 ff ff       	call   800ce7 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025e5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025e8:	8b 0b                	mov    (%ebx),%ecx
+  8025ea:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025ed:	39 d0                	cmp    %edx,%eax
+  8025ef:	72 1a                	jb     80260b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025f1:	89 da                	mov    %ebx,%edx
+  8025f3:	89 f0                	mov    %esi,%eax
+  8025f5:	e8 f4 fe ff ff       	call   8024ee <_pipeisclosed>
+  8025fa:	85 c0                	test   %eax,%eax
+  8025fc:	74 e2                	je     8025e0 <devpipe_write+0x25>
+				return 0;
+  8025fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802606:	5b                   	pop    %ebx
+  802607:	5e                   	pop    %esi
+  802608:	5f                   	pop    %edi
+  802609:	5d                   	pop    %ebp
+  80260a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80260b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80260e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802612:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802615:	89 c2                	mov    %eax,%edx
+  802617:	c1 fa 1f             	sar    $0x1f,%edx
+  80261a:	89 d1                	mov    %edx,%ecx
+  80261c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80261f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802622:	83 e2 1f             	and    $0x1f,%edx
+  802625:	29 ca                	sub    %ecx,%edx
+  802627:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80262b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80262f:	83 c0 01             	add    $0x1,%eax
+  802632:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802635:	83 c7 01             	add    $0x1,%edi
+  802638:	eb 9d                	jmp    8025d7 <devpipe_write+0x1c>
+
+0080263a <devpipe_read>:
+{
+  80263a:	55                   	push   %ebp
+  80263b:	89 e5                	mov    %esp,%ebp
+  80263d:	57                   	push   %edi
+  80263e:	56                   	push   %esi
+  80263f:	53                   	push   %ebx
+  802640:	83 ec 18             	sub    $0x18,%esp
+  802643:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802646:	57                   	push   %edi
+  802647:	e8 67 f1 ff ff       	call   8017b3 <fd2data>
+  80264c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80264e:	83 c4 10             	add    $0x10,%esp
+  802651:	be 00 00 00 00       	mov    $0x0,%esi
+  802656:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802659:	75 13                	jne    80266e <devpipe_read+0x34>
+	return i;
+  80265b:	89 f0                	mov    %esi,%eax
+  80265d:	eb 02                	jmp    802661 <devpipe_read+0x27>
+				return i;
+  80265f:	89 f0                	mov    %esi,%eax
+}
+  802661:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802664:	5b                   	pop    %ebx
+  802665:	5e                   	pop    %esi
+  802666:	5f                   	pop    %edi
+  802667:	5d                   	pop    %ebp
+  802668:	c3                   	ret
+			sys_yield();
+  802669:	e8 79 e6 ff ff       	call   800ce7 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80266e:	8b 03                	mov    (%ebx),%eax
+  802670:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802673:	75 18                	jne    80268d <devpipe_read+0x53>
+			if (i > 0)
+  802675:	85 f6                	test   %esi,%esi
+  802677:	75 e6                	jne    80265f <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802679:	89 da                	mov    %ebx,%edx
+  80267b:	89 f8                	mov    %edi,%eax
+  80267d:	e8 6c fe ff ff       	call   8024ee <_pipeisclosed>
+  802682:	85 c0                	test   %eax,%eax
+  802684:	74 e3                	je     802669 <devpipe_read+0x2f>
+				return 0;
+  802686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268b:	eb d4                	jmp    802661 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80268d:	99                   	cltd
+  80268e:	c1 ea 1b             	shr    $0x1b,%edx
+  802691:	01 d0                	add    %edx,%eax
+  802693:	83 e0 1f             	and    $0x1f,%eax
+  802696:	29 d0                	sub    %edx,%eax
+  802698:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80269d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026a0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8026a3:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026a6:	83 c6 01             	add    $0x1,%esi
+  8026a9:	eb ab                	jmp    802656 <devpipe_read+0x1c>
+
+008026ab <pipe>:
+{
+  8026ab:	55                   	push   %ebp
+  8026ac:	89 e5                	mov    %esp,%ebp
+  8026ae:	56                   	push   %esi
+  8026af:	53                   	push   %ebx
+  8026b0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b6:	50                   	push   %eax
+  8026b7:	e8 0e f1 ff ff       	call   8017ca <fd_alloc>
+  8026bc:	89 c3                	mov    %eax,%ebx
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	0f 88 23 01 00 00    	js     8027ec <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026c9:	83 ec 04             	sub    $0x4,%esp
+  8026cc:	68 07 04 00 00       	push   $0x407
+  8026d1:	ff 75 f4             	push   -0xc(%ebp)
+  8026d4:	6a 00                	push   $0x0
+  8026d6:	e8 52 e6 ff ff       	call   800d2d <sys_page_alloc>
+  8026db:	89 c3                	mov    %eax,%ebx
+  8026dd:	83 c4 10             	add    $0x10,%esp
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	0f 88 04 01 00 00    	js     8027ec <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026e8:	83 ec 0c             	sub    $0xc,%esp
+  8026eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026ee:	50                   	push   %eax
+  8026ef:	e8 d6 f0 ff ff       	call   8017ca <fd_alloc>
+  8026f4:	89 c3                	mov    %eax,%ebx
+  8026f6:	83 c4 10             	add    $0x10,%esp
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	0f 88 db 00 00 00    	js     8027dc <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802701:	83 ec 04             	sub    $0x4,%esp
+  802704:	68 07 04 00 00       	push   $0x407
+  802709:	ff 75 f0             	push   -0x10(%ebp)
+  80270c:	6a 00                	push   $0x0
+  80270e:	e8 1a e6 ff ff       	call   800d2d <sys_page_alloc>
+  802713:	89 c3                	mov    %eax,%ebx
+  802715:	83 c4 10             	add    $0x10,%esp
+  802718:	85 c0                	test   %eax,%eax
+  80271a:	0f 88 bc 00 00 00    	js     8027dc <pipe+0x131>
+	va = fd2data(fd0);
+  802720:	83 ec 0c             	sub    $0xc,%esp
+  802723:	ff 75 f4             	push   -0xc(%ebp)
+  802726:	e8 88 f0 ff ff       	call   8017b3 <fd2data>
+  80272b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80272d:	83 c4 0c             	add    $0xc,%esp
+  802730:	68 07 04 00 00       	push   $0x407
+  802735:	50                   	push   %eax
+  802736:	6a 00                	push   $0x0
+  802738:	e8 f0 e5 ff ff       	call   800d2d <sys_page_alloc>
+  80273d:	89 c3                	mov    %eax,%ebx
+  80273f:	83 c4 10             	add    $0x10,%esp
+  802742:	85 c0                	test   %eax,%eax
+  802744:	0f 88 82 00 00 00    	js     8027cc <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80274a:	83 ec 0c             	sub    $0xc,%esp
+  80274d:	ff 75 f0             	push   -0x10(%ebp)
+  802750:	e8 5e f0 ff ff       	call   8017b3 <fd2data>
+  802755:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80275c:	50                   	push   %eax
+  80275d:	6a 00                	push   $0x0
+  80275f:	56                   	push   %esi
+  802760:	6a 00                	push   $0x0
+  802762:	e8 33 e6 ff ff       	call   800d9a <sys_page_map>
+  802767:	89 c3                	mov    %eax,%ebx
+  802769:	83 c4 20             	add    $0x20,%esp
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	78 4e                	js     8027be <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802770:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802775:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802778:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80277a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80277d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802784:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802787:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802789:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80278c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802793:	83 ec 0c             	sub    $0xc,%esp
+  802796:	ff 75 f4             	push   -0xc(%ebp)
+  802799:	e8 05 f0 ff ff       	call   8017a3 <fd2num>
+  80279e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027a1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027a3:	83 c4 04             	add    $0x4,%esp
+  8027a6:	ff 75 f0             	push   -0x10(%ebp)
+  8027a9:	e8 f5 ef ff ff       	call   8017a3 <fd2num>
+  8027ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027b1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027b4:	83 c4 10             	add    $0x10,%esp
+  8027b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027bc:	eb 2e                	jmp    8027ec <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027be:	83 ec 08             	sub    $0x8,%esp
+  8027c1:	56                   	push   %esi
+  8027c2:	6a 00                	push   $0x0
+  8027c4:	e8 3f e6 ff ff       	call   800e08 <sys_page_unmap>
+  8027c9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027cc:	83 ec 08             	sub    $0x8,%esp
+  8027cf:	ff 75 f0             	push   -0x10(%ebp)
+  8027d2:	6a 00                	push   $0x0
+  8027d4:	e8 2f e6 ff ff       	call   800e08 <sys_page_unmap>
+  8027d9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027dc:	83 ec 08             	sub    $0x8,%esp
+  8027df:	ff 75 f4             	push   -0xc(%ebp)
+  8027e2:	6a 00                	push   $0x0
+  8027e4:	e8 1f e6 ff ff       	call   800e08 <sys_page_unmap>
+  8027e9:	83 c4 10             	add    $0x10,%esp
+}
+  8027ec:	89 d8                	mov    %ebx,%eax
+  8027ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027f1:	5b                   	pop    %ebx
+  8027f2:	5e                   	pop    %esi
+  8027f3:	5d                   	pop    %ebp
+  8027f4:	c3                   	ret
+
+008027f5 <pipeisclosed>:
+{
+  8027f5:	55                   	push   %ebp
+  8027f6:	89 e5                	mov    %esp,%ebp
+  8027f8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027fe:	50                   	push   %eax
+  8027ff:	ff 75 08             	push   0x8(%ebp)
+  802802:	e8 19 f0 ff ff       	call   801820 <fd_lookup>
+  802807:	83 c4 10             	add    $0x10,%esp
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	78 18                	js     802826 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80280e:	83 ec 0c             	sub    $0xc,%esp
+  802811:	ff 75 f4             	push   -0xc(%ebp)
+  802814:	e8 9a ef ff ff       	call   8017b3 <fd2data>
+  802819:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80281b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281e:	e8 cb fc ff ff       	call   8024ee <_pipeisclosed>
+  802823:	83 c4 10             	add    $0x10,%esp
+}
+  802826:	c9                   	leave
+  802827:	c3                   	ret
+
+00802828 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282d:	c3                   	ret
+
+0080282e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80282e:	55                   	push   %ebp
+  80282f:	89 e5                	mov    %esp,%ebp
+  802831:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802834:	68 53 30 80 00       	push   $0x803053
+  802839:	ff 75 0c             	push   0xc(%ebp)
+  80283c:	e8 f4 df ff ff       	call   800835 <strcpy>
+	return 0;
+}
+  802841:	b8 00 00 00 00       	mov    $0x0,%eax
+  802846:	c9                   	leave
+  802847:	c3                   	ret
+
+00802848 <devcons_write>:
+{
+  802848:	55                   	push   %ebp
+  802849:	89 e5                	mov    %esp,%ebp
+  80284b:	57                   	push   %edi
+  80284c:	56                   	push   %esi
+  80284d:	53                   	push   %ebx
+  80284e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802854:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802859:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80285f:	eb 2e                	jmp    80288f <devcons_write+0x47>
+		m = n - tot;
+  802861:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802864:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802866:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80286b:	39 c3                	cmp    %eax,%ebx
+  80286d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802870:	83 ec 04             	sub    $0x4,%esp
+  802873:	53                   	push   %ebx
+  802874:	89 f0                	mov    %esi,%eax
+  802876:	03 45 0c             	add    0xc(%ebp),%eax
+  802879:	50                   	push   %eax
+  80287a:	57                   	push   %edi
+  80287b:	e8 3b e1 ff ff       	call   8009bb <memmove>
+		sys_cputs(buf, m);
+  802880:	83 c4 08             	add    $0x8,%esp
+  802883:	53                   	push   %ebx
+  802884:	57                   	push   %edi
+  802885:	e8 24 e3 ff ff       	call   800bae <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80288a:	01 de                	add    %ebx,%esi
+  80288c:	83 c4 10             	add    $0x10,%esp
+  80288f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802892:	72 cd                	jb     802861 <devcons_write+0x19>
+}
+  802894:	89 f0                	mov    %esi,%eax
+  802896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802899:	5b                   	pop    %ebx
+  80289a:	5e                   	pop    %esi
+  80289b:	5f                   	pop    %edi
+  80289c:	5d                   	pop    %ebp
+  80289d:	c3                   	ret
+
+0080289e <devcons_read>:
+{
+  80289e:	55                   	push   %ebp
+  80289f:	89 e5                	mov    %esp,%ebp
+  8028a1:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8028a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028ad:	75 07                	jne    8028b6 <devcons_read+0x18>
+  8028af:	eb 1f                	jmp    8028d0 <devcons_read+0x32>
+		sys_yield();
+  8028b1:	e8 31 e4 ff ff       	call   800ce7 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028b6:	e8 37 e3 ff ff       	call   800bf2 <sys_cgetc>
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	74 f2                	je     8028b1 <devcons_read+0x13>
+	if (c < 0)
+  8028bf:	78 0f                	js     8028d0 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028c1:	83 f8 04             	cmp    $0x4,%eax
+  8028c4:	74 0c                	je     8028d2 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028c9:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028cb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028d0:	c9                   	leave
+  8028d1:	c3                   	ret
+		return 0;
+  8028d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d7:	eb f7                	jmp    8028d0 <devcons_read+0x32>
+
+008028d9 <cputchar>:
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e2:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028e5:	6a 01                	push   $0x1
+  8028e7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028ea:	50                   	push   %eax
+  8028eb:	e8 be e2 ff ff       	call   800bae <sys_cputs>
+}
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	c9                   	leave
+  8028f4:	c3                   	ret
+
+008028f5 <getchar>:
+{
+  8028f5:	55                   	push   %ebp
+  8028f6:	89 e5                	mov    %esp,%ebp
+  8028f8:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028fb:	6a 01                	push   $0x1
+  8028fd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802900:	50                   	push   %eax
+  802901:	6a 00                	push   $0x0
+  802903:	e8 9e f1 ff ff       	call   801aa6 <read>
+	if (r < 0)
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	78 06                	js     802915 <getchar+0x20>
+	if (r < 1)
+  80290f:	74 06                	je     802917 <getchar+0x22>
+	return c;
+  802911:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802915:	c9                   	leave
+  802916:	c3                   	ret
+		return -E_EOF;
+  802917:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80291c:	eb f7                	jmp    802915 <getchar+0x20>
+
+0080291e <iscons>:
+{
+  80291e:	55                   	push   %ebp
+  80291f:	89 e5                	mov    %esp,%ebp
+  802921:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802924:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802927:	50                   	push   %eax
+  802928:	ff 75 08             	push   0x8(%ebp)
+  80292b:	e8 f0 ee ff ff       	call   801820 <fd_lookup>
+  802930:	83 c4 10             	add    $0x10,%esp
+  802933:	85 c0                	test   %eax,%eax
+  802935:	78 11                	js     802948 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802937:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80293a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802940:	39 10                	cmp    %edx,(%eax)
+  802942:	0f 94 c0             	sete   %al
+  802945:	0f b6 c0             	movzbl %al,%eax
+}
+  802948:	c9                   	leave
+  802949:	c3                   	ret
+
+0080294a <opencons>:
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802950:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802953:	50                   	push   %eax
+  802954:	e8 71 ee ff ff       	call   8017ca <fd_alloc>
+  802959:	83 c4 10             	add    $0x10,%esp
+  80295c:	85 c0                	test   %eax,%eax
+  80295e:	78 3a                	js     80299a <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802960:	83 ec 04             	sub    $0x4,%esp
+  802963:	68 07 04 00 00       	push   $0x407
+  802968:	ff 75 f4             	push   -0xc(%ebp)
+  80296b:	6a 00                	push   $0x0
+  80296d:	e8 bb e3 ff ff       	call   800d2d <sys_page_alloc>
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	85 c0                	test   %eax,%eax
+  802977:	78 21                	js     80299a <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80297c:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802982:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802984:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802987:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80298e:	83 ec 0c             	sub    $0xc,%esp
+  802991:	50                   	push   %eax
+  802992:	e8 0c ee ff ff       	call   8017a3 <fd2num>
+  802997:	83 c4 10             	add    $0x10,%esp
+}
+  80299a:	c9                   	leave
+  80299b:	c3                   	ret
+
+0080299c <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  80299c:	55                   	push   %ebp
+  80299d:	89 e5                	mov    %esp,%ebp
+  80299f:	56                   	push   %esi
+  8029a0:	53                   	push   %ebx
+  8029a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8029aa:	85 c0                	test   %eax,%eax
+  8029ac:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029b1:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8029b4:	83 ec 08             	sub    $0x8,%esp
+  8029b7:	ff 75 14             	push   0x14(%ebp)
+  8029ba:	50                   	push   %eax
+  8029bb:	e8 7e e7 ff ff       	call   80113e <sys_ipc_recv_until>
+  8029c0:	83 c4 10             	add    $0x10,%esp
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 61                	js     802a28 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029c7:	85 f6                	test   %esi,%esi
+  8029c9:	74 1c                	je     8029e7 <ipc_recv_until+0x4b>
+  8029cb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029cd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029d2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029d8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029dd:	76 5f                	jbe    802a3e <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029df:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029e5:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029e7:	85 db                	test   %ebx,%ebx
+  8029e9:	74 1c                	je     802a07 <ipc_recv_until+0x6b>
+  8029eb:	89 e0                	mov    %esp,%eax
+  8029ed:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029f2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029f8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029fd:	76 50                	jbe    802a4f <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8029ff:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802a05:	89 03                	mov    %eax,(%ebx)
+  802a07:	89 e0                	mov    %esp,%eax
+  802a09:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a0e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a14:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a19:	76 45                	jbe    802a60 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a1b:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a24:	5b                   	pop    %ebx
+  802a25:	5e                   	pop    %esi
+  802a26:	5d                   	pop    %ebp
+  802a27:	c3                   	ret
+		if (from_env_store)
+  802a28:	85 f6                	test   %esi,%esi
+  802a2a:	74 06                	je     802a32 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a2c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a32:	85 db                	test   %ebx,%ebx
+  802a34:	74 eb                	je     802a21 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a36:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a3c:	eb e3                	jmp    802a21 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a3e:	c1 e8 10             	shr    $0x10,%eax
+  802a41:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a47:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a4d:	eb 90                	jmp    8029df <ipc_recv_until+0x43>
+  802a4f:	c1 e8 10             	shr    $0x10,%eax
+  802a52:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a58:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a5e:	eb 9f                	jmp    8029ff <ipc_recv_until+0x63>
+  802a60:	c1 e8 10             	shr    $0x10,%eax
+  802a63:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a69:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a6f:	eb aa                	jmp    802a1b <ipc_recv_until+0x7f>
+
+00802a71 <ipc_recv>:
+{
+  802a71:	55                   	push   %ebp
+  802a72:	89 e5                	mov    %esp,%ebp
+  802a74:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a77:	6a 00                	push   $0x0
+  802a79:	ff 75 10             	push   0x10(%ebp)
+  802a7c:	ff 75 0c             	push   0xc(%ebp)
+  802a7f:	ff 75 08             	push   0x8(%ebp)
+  802a82:	e8 15 ff ff ff       	call   80299c <ipc_recv_until>
+}
+  802a87:	c9                   	leave
+  802a88:	c3                   	ret
+
+00802a89 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	57                   	push   %edi
+  802a8d:	56                   	push   %esi
+  802a8e:	53                   	push   %ebx
+  802a8f:	83 ec 0c             	sub    $0xc,%esp
+  802a92:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a95:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a9b:	85 db                	test   %ebx,%ebx
+  802a9d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802aa2:	0f 44 d8             	cmove  %eax,%ebx
+  802aa5:	eb 05                	jmp    802aac <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802aa7:	e8 3b e2 ff ff       	call   800ce7 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802aac:	ff 75 14             	push   0x14(%ebp)
+  802aaf:	53                   	push   %ebx
+  802ab0:	56                   	push   %esi
+  802ab1:	57                   	push   %edi
+  802ab2:	e8 d3 e5 ff ff       	call   80108a <sys_ipc_try_send>
+  802ab7:	83 c4 10             	add    $0x10,%esp
+  802aba:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802abd:	74 e8                	je     802aa7 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802abf:	85 c0                	test   %eax,%eax
+  802ac1:	78 08                	js     802acb <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802ac3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac6:	5b                   	pop    %ebx
+  802ac7:	5e                   	pop    %esi
+  802ac8:	5f                   	pop    %edi
+  802ac9:	5d                   	pop    %ebp
+  802aca:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802acb:	50                   	push   %eax
+  802acc:	68 5f 30 80 00       	push   $0x80305f
+  802ad1:	6a 4f                	push   $0x4f
+  802ad3:	68 72 30 80 00       	push   $0x803072
+  802ad8:	e8 35 d6 ff ff       	call   800112 <_panic>
+
+00802add <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802add:	55                   	push   %ebp
+  802ade:	89 e5                	mov    %esp,%ebp
+  802ae0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ae8:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802aee:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802af4:	8b 52 50             	mov    0x50(%edx),%edx
+  802af7:	39 ca                	cmp    %ecx,%edx
+  802af9:	74 11                	je     802b0c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802afb:	83 c0 01             	add    $0x1,%eax
+  802afe:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802b03:	75 e3                	jne    802ae8 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0a:	eb 0e                	jmp    802b1a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802b0c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b12:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b17:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b1a:	5d                   	pop    %ebp
+  802b1b:	c3                   	ret
+
+00802b1c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b1c:	55                   	push   %ebp
+  802b1d:	89 e5                	mov    %esp,%ebp
+  802b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b22:	89 c2                	mov    %eax,%edx
+  802b24:	c1 ea 16             	shr    $0x16,%edx
+  802b27:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b33:	f6 c1 01             	test   $0x1,%cl
+  802b36:	74 1a                	je     802b52 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b38:	c1 e8 0c             	shr    $0xc,%eax
+  802b3b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b42:	a8 01                	test   $0x1,%al
+  802b44:	74 0c                	je     802b52 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b46:	c1 e8 0c             	shr    $0xc,%eax
+  802b49:	c1 e0 04             	shl    $0x4,%eax
+  802b4c:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b52:	89 d0                	mov    %edx,%eax
+  802b54:	5d                   	pop    %ebp
+  802b55:	c3                   	ret
@@ -0,0 +1,6712 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 aa 05 00 00       	call   8005db <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+	int mismatch = 0;
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 b1 31 80 00       	push   $0x8031b1
+  800049:	68 80 31 80 00       	push   $0x803180
+  80004e:	e8 27 07 00 00       	call   80077a <cprintf>
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_edi);
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 90 31 80 00       	push   $0x803190
+  80005c:	68 94 31 80 00       	push   $0x803194
+  800061:	e8 14 07 00 00       	call   80077a <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 a8 31 80 00       	push   $0x8031a8
+  80007b:	e8 fa 06 00 00       	call   80077a <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(esi, regs.reg_esi);
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 b2 31 80 00       	push   $0x8031b2
+  800093:	68 94 31 80 00       	push   $0x803194
+  800098:	e8 dd 06 00 00       	call   80077a <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 a8 31 80 00       	push   $0x8031a8
+  8000b4:	e8 c1 06 00 00       	call   80077a <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebp, regs.reg_ebp);
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 b6 31 80 00       	push   $0x8031b6
+  8000cc:	68 94 31 80 00       	push   $0x803194
+  8000d1:	e8 a4 06 00 00       	call   80077a <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 a8 31 80 00       	push   $0x8031a8
+  8000ed:	e8 88 06 00 00       	call   80077a <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ebx, regs.reg_ebx);
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 ba 31 80 00       	push   $0x8031ba
+  800105:	68 94 31 80 00       	push   $0x803194
+  80010a:	e8 6b 06 00 00       	call   80077a <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 a8 31 80 00       	push   $0x8031a8
+  800126:	e8 4f 06 00 00       	call   80077a <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(edx, regs.reg_edx);
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 be 31 80 00       	push   $0x8031be
+  80013e:	68 94 31 80 00       	push   $0x803194
+  800143:	e8 32 06 00 00       	call   80077a <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 a8 31 80 00       	push   $0x8031a8
+  80015f:	e8 16 06 00 00       	call   80077a <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(ecx, regs.reg_ecx);
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 c2 31 80 00       	push   $0x8031c2
+  800177:	68 94 31 80 00       	push   $0x803194
+  80017c:	e8 f9 05 00 00       	call   80077a <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 a8 31 80 00       	push   $0x8031a8
+  800198:	e8 dd 05 00 00       	call   80077a <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eax, regs.reg_eax);
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 c6 31 80 00       	push   $0x8031c6
+  8001b0:	68 94 31 80 00       	push   $0x803194
+  8001b5:	e8 c0 05 00 00       	call   80077a <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 a8 31 80 00       	push   $0x8031a8
+  8001d1:	e8 a4 05 00 00       	call   80077a <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eip, eip);
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 ca 31 80 00       	push   $0x8031ca
+  8001e9:	68 94 31 80 00       	push   $0x803194
+  8001ee:	e8 87 05 00 00       	call   80077a <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 a8 31 80 00       	push   $0x8031a8
+  80020a:	e8 6b 05 00 00       	call   80077a <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+	CHECK(eflags, eflags);
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 ce 31 80 00       	push   $0x8031ce
+  800222:	68 94 31 80 00       	push   $0x803194
+  800227:	e8 4e 05 00 00       	call   80077a <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 a8 31 80 00       	push   $0x8031a8
+  800243:	e8 32 05 00 00       	call   80077a <cprintf>
+	CHECK(esp, esp);
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 d5 31 80 00       	push   $0x8031d5
+  800253:	68 94 31 80 00       	push   $0x803194
+  800258:	e8 1d 05 00 00       	call   80077a <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 a8 31 80 00       	push   $0x8031a8
+  800274:	e8 01 05 00 00       	call   80077a <cprintf>
+
+#undef CHECK
+
+	cprintf("Registers %s ", testname);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 d9 31 80 00       	push   $0x8031d9
+  800284:	e8 f1 04 00 00       	call   80077a <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+	if (!mismatch)
+		cprintf("OK\n");
+	else
+		cprintf("MISMATCH\n");
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 a8 31 80 00       	push   $0x8031a8
+  800294:	e8 e1 04 00 00       	call   80077a <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+}
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+	CHECK(edi, regs.reg_edi);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 a4 31 80 00       	push   $0x8031a4
+  8002a9:	e8 cc 04 00 00       	call   80077a <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+	int mismatch = 0;
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+	CHECK(esi, regs.reg_esi);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 a4 31 80 00       	push   $0x8031a4
+  8002c3:	e8 b2 04 00 00       	call   80077a <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+	CHECK(ebp, regs.reg_ebp);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 a4 31 80 00       	push   $0x8031a4
+  8002d8:	e8 9d 04 00 00       	call   80077a <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+	CHECK(ebx, regs.reg_ebx);
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 a4 31 80 00       	push   $0x8031a4
+  8002ed:	e8 88 04 00 00       	call   80077a <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+	CHECK(edx, regs.reg_edx);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 a4 31 80 00       	push   $0x8031a4
+  800302:	e8 73 04 00 00       	call   80077a <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+	CHECK(ecx, regs.reg_ecx);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 a4 31 80 00       	push   $0x8031a4
+  800317:	e8 5e 04 00 00       	call   80077a <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+	CHECK(eax, regs.reg_eax);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 a4 31 80 00       	push   $0x8031a4
+  80032c:	e8 49 04 00 00       	call   80077a <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+	CHECK(eip, eip);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 a4 31 80 00       	push   $0x8031a4
+  800341:	e8 34 04 00 00       	call   80077a <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+	CHECK(eflags, eflags);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 a4 31 80 00       	push   $0x8031a4
+  800356:	e8 1f 04 00 00       	call   80077a <cprintf>
+	CHECK(esp, esp);
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 d5 31 80 00       	push   $0x8031d5
+  800366:	68 94 31 80 00       	push   $0x803194
+  80036b:	e8 0a 04 00 00       	call   80077a <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 a4 31 80 00       	push   $0x8031a4
+  800387:	e8 ee 03 00 00       	call   80077a <cprintf>
+	cprintf("Registers %s ", testname);
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 d9 31 80 00       	push   $0x8031d9
+  800397:	e8 de 03 00 00       	call   80077a <cprintf>
+	if (!mismatch)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+		cprintf("OK\n");
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 a4 31 80 00       	push   $0x8031a4
+  8003af:	e8 c6 03 00 00       	call   80077a <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+}
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+	CHECK(esp, esp);
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 a4 31 80 00       	push   $0x8031a4
+  8003c7:	e8 ae 03 00 00       	call   80077a <cprintf>
+	cprintf("Registers %s ", testname);
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 d9 31 80 00       	push   $0x8031d9
+  8003d7:	e8 9e 03 00 00       	call   80077a <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+	int r;
+
+	if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 9d 00 00 00    	jne    800498 <pgfault+0xb4>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+		      utf->utf_fault_va, utf->utf_eip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 40 50 80 00    	mov    %edx,0x805040
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 44 50 80 00    	mov    %edx,0x805044
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 48 50 80 00    	mov    %edx,0x805048
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 4c 50 80 00    	mov    %edx,0x80504c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 50 50 80 00    	mov    %edx,0x805050
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 54 50 80 00    	mov    %edx,0x805054
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 58 50 80 00    	mov    %edx,0x805058
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 5c 50 80 00    	mov    %edx,0x80505c
+	during.eip = utf->utf_eip;
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 60 50 80 00    	mov    %edx,0x805060
+	during.eflags = utf->utf_eflags;
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	89 15 64 50 80 00    	mov    %edx,0x805064
+	during.esp = utf->utf_esp;
+  800455:	8b 40 30             	mov    0x30(%eax),%eax
+  800458:	a3 68 50 80 00       	mov    %eax,0x805068
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	68 ff 31 80 00       	push   $0x8031ff
+  800465:	68 0d 32 80 00       	push   $0x80320d
+  80046a:	b9 40 50 80 00       	mov    $0x805040,%ecx
+  80046f:	ba f8 31 80 00       	mov    $0x8031f8,%edx
+  800474:	b8 80 50 80 00       	mov    $0x805080,%eax
+  800479:	e8 b5 fb ff ff       	call   800033 <check_regs>
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  80047e:	83 c4 0c             	add    $0xc,%esp
+  800481:	6a 07                	push   $0x7
+  800483:	68 00 00 40 00       	push   $0x400000
+  800488:	6a 00                	push   $0x0
+  80048a:	e8 2b 0e 00 00       	call   8012ba <sys_page_alloc>
+  80048f:	83 c4 10             	add    $0x10,%esp
+  800492:	85 c0                	test   %eax,%eax
+  800494:	78 1a                	js     8004b0 <pgfault+0xcc>
+		panic("sys_page_alloc: %e", r);
+}
+  800496:	c9                   	leave
+  800497:	c3                   	ret
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  800498:	83 ec 0c             	sub    $0xc,%esp
+  80049b:	ff 70 28             	push   0x28(%eax)
+  80049e:	52                   	push   %edx
+  80049f:	68 40 32 80 00       	push   $0x803240
+  8004a4:	6a 50                	push   $0x50
+  8004a6:	68 e7 31 80 00       	push   $0x8031e7
+  8004ab:	e8 ef 01 00 00       	call   80069f <_panic>
+		panic("sys_page_alloc: %e", r);
+  8004b0:	50                   	push   %eax
+  8004b1:	68 14 32 80 00       	push   $0x803214
+  8004b6:	6a 5c                	push   $0x5c
+  8004b8:	68 e7 31 80 00       	push   $0x8031e7
+  8004bd:	e8 dd 01 00 00       	call   80069f <_panic>
+
+008004c2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	83 ec 14             	sub    $0x14,%esp
+	set_pgfault_handler(pgfault);
+  8004c8:	68 e4 03 80 00       	push   $0x8003e4
+  8004cd:	e8 5e 18 00 00       	call   801d30 <set_pgfault_handler>
+
+	__asm __volatile(
+  8004d2:	50                   	push   %eax
+  8004d3:	9c                   	pushf
+  8004d4:	58                   	pop    %eax
+  8004d5:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004da:	50                   	push   %eax
+  8004db:	9d                   	popf
+  8004dc:	a3 a4 50 80 00       	mov    %eax,0x8050a4
+  8004e1:	8d 05 1c 05 80 00    	lea    0x80051c,%eax
+  8004e7:	a3 a0 50 80 00       	mov    %eax,0x8050a0
+  8004ec:	58                   	pop    %eax
+  8004ed:	89 3d 80 50 80 00    	mov    %edi,0x805080
+  8004f3:	89 35 84 50 80 00    	mov    %esi,0x805084
+  8004f9:	89 2d 88 50 80 00    	mov    %ebp,0x805088
+  8004ff:	89 1d 90 50 80 00    	mov    %ebx,0x805090
+  800505:	89 15 94 50 80 00    	mov    %edx,0x805094
+  80050b:	89 0d 98 50 80 00    	mov    %ecx,0x805098
+  800511:	a3 9c 50 80 00       	mov    %eax,0x80509c
+  800516:	89 25 a8 50 80 00    	mov    %esp,0x8050a8
+  80051c:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800523:	00 00 00 
+  800526:	89 3d 00 50 80 00    	mov    %edi,0x805000
+  80052c:	89 35 04 50 80 00    	mov    %esi,0x805004
+  800532:	89 2d 08 50 80 00    	mov    %ebp,0x805008
+  800538:	89 1d 10 50 80 00    	mov    %ebx,0x805010
+  80053e:	89 15 14 50 80 00    	mov    %edx,0x805014
+  800544:	89 0d 18 50 80 00    	mov    %ecx,0x805018
+  80054a:	a3 1c 50 80 00       	mov    %eax,0x80501c
+  80054f:	89 25 28 50 80 00    	mov    %esp,0x805028
+  800555:	8b 3d 80 50 80 00    	mov    0x805080,%edi
+  80055b:	8b 35 84 50 80 00    	mov    0x805084,%esi
+  800561:	8b 2d 88 50 80 00    	mov    0x805088,%ebp
+  800567:	8b 1d 90 50 80 00    	mov    0x805090,%ebx
+  80056d:	8b 15 94 50 80 00    	mov    0x805094,%edx
+  800573:	8b 0d 98 50 80 00    	mov    0x805098,%ecx
+  800579:	a1 9c 50 80 00       	mov    0x80509c,%eax
+  80057e:	8b 25 a8 50 80 00    	mov    0x8050a8,%esp
+  800584:	50                   	push   %eax
+  800585:	9c                   	pushf
+  800586:	58                   	pop    %eax
+  800587:	a3 24 50 80 00       	mov    %eax,0x805024
+  80058c:	58                   	pop    %eax
+		: : "m" (before), "m" (after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  80058d:	83 c4 10             	add    $0x10,%esp
+  800590:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  800597:	75 30                	jne    8005c9 <umain+0x107>
+		cprintf("EIP after page-fault MISMATCH\n");
+	after.eip = before.eip;
+  800599:	a1 a0 50 80 00       	mov    0x8050a0,%eax
+  80059e:	a3 20 50 80 00       	mov    %eax,0x805020
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	68 27 32 80 00       	push   $0x803227
+  8005ab:	68 38 32 80 00       	push   $0x803238
+  8005b0:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  8005b5:	ba f8 31 80 00       	mov    $0x8031f8,%edx
+  8005ba:	b8 80 50 80 00       	mov    $0x805080,%eax
+  8005bf:	e8 6f fa ff ff       	call   800033 <check_regs>
+}
+  8005c4:	83 c4 10             	add    $0x10,%esp
+  8005c7:	c9                   	leave
+  8005c8:	c3                   	ret
+		cprintf("EIP after page-fault MISMATCH\n");
+  8005c9:	83 ec 0c             	sub    $0xc,%esp
+  8005cc:	68 74 32 80 00       	push   $0x803274
+  8005d1:	e8 a4 01 00 00       	call   80077a <cprintf>
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	eb be                	jmp    800599 <umain+0xd7>
+
+008005db <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005db:	55                   	push   %ebp
+  8005dc:	89 e5                	mov    %esp,%ebp
+  8005de:	57                   	push   %edi
+  8005df:	56                   	push   %esi
+  8005e0:	53                   	push   %ebx
+  8005e1:	83 ec 0c             	sub    $0xc,%esp
+  8005e4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8005ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8005ef:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8005f1:	c1 ea 0b             	shr    $0xb,%edx
+  8005f4:	83 f2 01             	xor    $0x1,%edx
+  8005f7:	83 e2 01             	and    $0x1,%edx
+  8005fa:	88 15 b8 50 80 00    	mov    %dl,0x8050b8
+
+	mainenv = NULL;
+  800600:	c7 05 b4 50 80 00 00 	movl   $0x0,0x8050b4
+  800607:	00 00 00 
+	envid = sys_getenvid();
+  80060a:	e8 1f 0c 00 00       	call   80122e <sys_getenvid>
+  80060f:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800611:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800616:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80061c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800622:	8b 52 48             	mov    0x48(%edx),%edx
+  800625:	39 ca                	cmp    %ecx,%edx
+  800627:	74 27                	je     800650 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800629:	83 c0 01             	add    $0x1,%eax
+  80062c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800631:	75 e3                	jne    800616 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800633:	83 3d b4 50 80 00 00 	cmpl   $0x0,0x8050b4
+  80063a:	75 24                	jne    800660 <libmain+0x85>
+		panic("libmain can't find the environment");
+  80063c:	83 ec 04             	sub    $0x4,%esp
+  80063f:	68 94 32 80 00       	push   $0x803294
+  800644:	6a 23                	push   $0x23
+  800646:	68 b7 32 80 00       	push   $0x8032b7
+  80064b:	e8 4f 00 00 00       	call   80069f <_panic>
+			mainenv = &envs[i];
+  800650:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800656:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80065b:	a3 b4 50 80 00       	mov    %eax,0x8050b4
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800660:	85 ff                	test   %edi,%edi
+  800662:	7e 07                	jle    80066b <libmain+0x90>
+		binaryname = argv[0];
+  800664:	8b 06                	mov    (%esi),%eax
+  800666:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	56                   	push   %esi
+  80066f:	57                   	push   %edi
+  800670:	e8 4d fe ff ff       	call   8004c2 <umain>
+
+	// exit gracefully
+	exit();
+  800675:	e8 0b 00 00 00       	call   800685 <exit>
+}
+  80067a:	83 c4 10             	add    $0x10,%esp
+  80067d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800680:	5b                   	pop    %ebx
+  800681:	5e                   	pop    %esi
+  800682:	5f                   	pop    %edi
+  800683:	5d                   	pop    %ebp
+  800684:	c3                   	ret
+
+00800685 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800685:	55                   	push   %ebp
+  800686:	89 e5                	mov    %esp,%ebp
+  800688:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80068b:	e8 23 19 00 00       	call   801fb3 <close_all>
+	sys_env_destroy(0);
+  800690:	83 ec 0c             	sub    $0xc,%esp
+  800693:	6a 00                	push   $0x0
+  800695:	e8 2b 0b 00 00       	call   8011c5 <sys_env_destroy>
+}
+  80069a:	83 c4 10             	add    $0x10,%esp
+  80069d:	c9                   	leave
+  80069e:	c3                   	ret
+
+0080069f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80069f:	55                   	push   %ebp
+  8006a0:	89 e5                	mov    %esp,%ebp
+  8006a2:	56                   	push   %esi
+  8006a3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8006a4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006a7:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8006ad:	e8 7c 0b 00 00       	call   80122e <sys_getenvid>
+  8006b2:	83 ec 0c             	sub    $0xc,%esp
+  8006b5:	ff 75 0c             	push   0xc(%ebp)
+  8006b8:	ff 75 08             	push   0x8(%ebp)
+  8006bb:	56                   	push   %esi
+  8006bc:	50                   	push   %eax
+  8006bd:	68 d0 32 80 00       	push   $0x8032d0
+  8006c2:	e8 b3 00 00 00       	call   80077a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8006c7:	83 c4 18             	add    $0x18,%esp
+  8006ca:	53                   	push   %ebx
+  8006cb:	ff 75 10             	push   0x10(%ebp)
+  8006ce:	e8 56 00 00 00       	call   800729 <vcprintf>
+	cprintf("\n");
+  8006d3:	c7 04 24 b0 31 80 00 	movl   $0x8031b0,(%esp)
+  8006da:	e8 9b 00 00 00       	call   80077a <cprintf>
+  8006df:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006e2:	cc                   	int3
+	while (1)
+  8006e3:	eb fd                	jmp    8006e2 <_panic+0x43>
+
+008006e5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8006e5:	55                   	push   %ebp
+  8006e6:	89 e5                	mov    %esp,%ebp
+  8006e8:	53                   	push   %ebx
+  8006e9:	83 ec 04             	sub    $0x4,%esp
+  8006ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8006ef:	8b 13                	mov    (%ebx),%edx
+  8006f1:	8d 42 01             	lea    0x1(%edx),%eax
+  8006f4:	89 03                	mov    %eax,(%ebx)
+  8006f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006f9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006fd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800702:	74 09                	je     80070d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800704:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800708:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80070b:	c9                   	leave
+  80070c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80070d:	83 ec 08             	sub    $0x8,%esp
+  800710:	68 ff 00 00 00       	push   $0xff
+  800715:	8d 43 08             	lea    0x8(%ebx),%eax
+  800718:	50                   	push   %eax
+  800719:	e8 1d 0a 00 00       	call   80113b <sys_cputs>
+		b->idx = 0;
+  80071e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800724:	83 c4 10             	add    $0x10,%esp
+  800727:	eb db                	jmp    800704 <putch+0x1f>
+
+00800729 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800729:	55                   	push   %ebp
+  80072a:	89 e5                	mov    %esp,%ebp
+  80072c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800732:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800739:	00 00 00 
+	b.cnt = 0;
+  80073c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800743:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800746:	ff 75 0c             	push   0xc(%ebp)
+  800749:	ff 75 08             	push   0x8(%ebp)
+  80074c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800752:	50                   	push   %eax
+  800753:	68 e5 06 80 00       	push   $0x8006e5
+  800758:	e8 fb 00 00 00       	call   800858 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80075d:	83 c4 08             	add    $0x8,%esp
+  800760:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800766:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80076c:	50                   	push   %eax
+  80076d:	e8 c9 09 00 00       	call   80113b <sys_cputs>
+
+	return b.cnt;
+}
+  800772:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800778:	c9                   	leave
+  800779:	c3                   	ret
+
+0080077a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80077a:	55                   	push   %ebp
+  80077b:	89 e5                	mov    %esp,%ebp
+  80077d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800780:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800783:	50                   	push   %eax
+  800784:	ff 75 08             	push   0x8(%ebp)
+  800787:	e8 9d ff ff ff       	call   800729 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80078c:	c9                   	leave
+  80078d:	c3                   	ret
+
+0080078e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80078e:	55                   	push   %ebp
+  80078f:	89 e5                	mov    %esp,%ebp
+  800791:	57                   	push   %edi
+  800792:	56                   	push   %esi
+  800793:	53                   	push   %ebx
+  800794:	83 ec 1c             	sub    $0x1c,%esp
+  800797:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80079a:	89 d6                	mov    %edx,%esi
+  80079c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80079f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007a2:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8007a5:	73 0b                	jae    8007b2 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8007a7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8007aa:	c1 e7 08             	shl    $0x8,%edi
+  8007ad:	0b 7d 10             	or     0x10(%ebp),%edi
+  8007b0:	eb 36                	jmp    8007e8 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8007b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007ba:	f7 75 08             	divl   0x8(%ebp)
+  8007bd:	89 c1                	mov    %eax,%ecx
+  8007bf:	ff 75 14             	push   0x14(%ebp)
+  8007c2:	ff 75 10             	push   0x10(%ebp)
+  8007c5:	83 eb 01             	sub    $0x1,%ebx
+  8007c8:	53                   	push   %ebx
+  8007c9:	ff 75 08             	push   0x8(%ebp)
+  8007cc:	89 f2                	mov    %esi,%edx
+  8007ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007d1:	e8 b8 ff ff ff       	call   80078e <printnum>
+  8007d6:	83 c4 10             	add    $0x10,%esp
+  8007d9:	eb 14                	jmp    8007ef <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8007db:	83 ec 08             	sub    $0x8,%esp
+  8007de:	56                   	push   %esi
+  8007df:	57                   	push   %edi
+  8007e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007e3:	ff d0                	call   *%eax
+  8007e5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8007e8:	83 eb 01             	sub    $0x1,%ebx
+  8007eb:	85 db                	test   %ebx,%ebx
+  8007ed:	7f ec                	jg     8007db <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8007ef:	83 ec 08             	sub    $0x8,%esp
+  8007f2:	56                   	push   %esi
+  8007f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007fb:	f7 75 08             	divl   0x8(%ebp)
+  8007fe:	0f be 92 f3 32 80 00 	movsbl 0x8032f3(%edx),%edx
+  800805:	8b 45 14             	mov    0x14(%ebp),%eax
+  800808:	c1 e0 08             	shl    $0x8,%eax
+  80080b:	09 d0                	or     %edx,%eax
+  80080d:	50                   	push   %eax
+  80080e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800811:	ff d0                	call   *%eax
+}
+  800813:	83 c4 10             	add    $0x10,%esp
+  800816:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800819:	5b                   	pop    %ebx
+  80081a:	5e                   	pop    %esi
+  80081b:	5f                   	pop    %edi
+  80081c:	5d                   	pop    %ebp
+  80081d:	c3                   	ret
+
+0080081e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80081e:	55                   	push   %ebp
+  80081f:	89 e5                	mov    %esp,%ebp
+  800821:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800824:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800828:	8b 10                	mov    (%eax),%edx
+  80082a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80082d:	73 0a                	jae    800839 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80082f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800832:	89 08                	mov    %ecx,(%eax)
+  800834:	8b 45 08             	mov    0x8(%ebp),%eax
+  800837:	88 02                	mov    %al,(%edx)
+}
+  800839:	5d                   	pop    %ebp
+  80083a:	c3                   	ret
+
+0080083b <printfmt>:
+{
+  80083b:	55                   	push   %ebp
+  80083c:	89 e5                	mov    %esp,%ebp
+  80083e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800841:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800844:	50                   	push   %eax
+  800845:	ff 75 10             	push   0x10(%ebp)
+  800848:	ff 75 0c             	push   0xc(%ebp)
+  80084b:	ff 75 08             	push   0x8(%ebp)
+  80084e:	e8 05 00 00 00       	call   800858 <vprintfmt>
+}
+  800853:	83 c4 10             	add    $0x10,%esp
+  800856:	c9                   	leave
+  800857:	c3                   	ret
+
+00800858 <vprintfmt>:
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	57                   	push   %edi
+  80085c:	56                   	push   %esi
+  80085d:	53                   	push   %ebx
+  80085e:	83 ec 3c             	sub    $0x3c,%esp
+  800861:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800864:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800867:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80086e:	eb 16                	jmp    800886 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800870:	83 ec 08             	sub    $0x8,%esp
+  800873:	ff 75 0c             	push   0xc(%ebp)
+  800876:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800879:	c1 e2 08             	shl    $0x8,%edx
+  80087c:	09 d0                	or     %edx,%eax
+  80087e:	50                   	push   %eax
+  80087f:	ff d7                	call   *%edi
+  800881:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800884:	89 de                	mov    %ebx,%esi
+  800886:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800889:	0f b6 06             	movzbl (%esi),%eax
+  80088c:	83 f8 25             	cmp    $0x25,%eax
+  80088f:	74 0c                	je     80089d <vprintfmt+0x45>
+			if (ch == '\0')
+  800891:	85 c0                	test   %eax,%eax
+  800893:	75 db                	jne    800870 <vprintfmt+0x18>
+}
+  800895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800898:	5b                   	pop    %ebx
+  800899:	5e                   	pop    %esi
+  80089a:	5f                   	pop    %edi
+  80089b:	5d                   	pop    %ebp
+  80089c:	c3                   	ret
+		padc = ' ';
+  80089d:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8008a1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8008a8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8008af:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8008b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8008bb:	8d 73 01             	lea    0x1(%ebx),%esi
+  8008be:	0f b6 13             	movzbl (%ebx),%edx
+  8008c1:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8008c4:	3c 55                	cmp    $0x55,%al
+  8008c6:	0f 87 2c 04 00 00    	ja     800cf8 <vprintfmt+0x4a0>
+  8008cc:	0f b6 c0             	movzbl %al,%eax
+  8008cf:	ff 24 85 40 34 80 00 	jmp    *0x803440(,%eax,4)
+  8008d6:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8008d8:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8008dc:	eb dd                	jmp    8008bb <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008de:	89 f3                	mov    %esi,%ebx
+  8008e0:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8008e4:	eb d5                	jmp    8008bb <vprintfmt+0x63>
+  8008e6:	0f b6 d2             	movzbl %dl,%edx
+  8008e9:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8008eb:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8008f0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008f3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8008f7:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8008fa:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8008fd:	83 fe 09             	cmp    $0x9,%esi
+  800900:	0f 87 8a 00 00 00    	ja     800990 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800906:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800909:	eb e5                	jmp    8008f0 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80090b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090e:	8b 00                	mov    (%eax),%eax
+  800910:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800913:	8b 45 14             	mov    0x14(%ebp),%eax
+  800916:	8d 40 04             	lea    0x4(%eax),%eax
+  800919:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80091c:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80091e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800922:	79 97                	jns    8008bb <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800924:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800927:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80092a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800931:	eb 88                	jmp    8008bb <vprintfmt+0x63>
+			if (width < 0)
+  800933:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800936:	85 db                	test   %ebx,%ebx
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093d:	0f 49 c3             	cmovns %ebx,%eax
+  800940:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800943:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800945:	e9 71 ff ff ff       	jmp    8008bb <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80094a:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80094c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800953:	e9 63 ff ff ff       	jmp    8008bb <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800958:	8d 73 02             	lea    0x2(%ebx),%esi
+  80095b:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80095f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800966:	3c 67                	cmp    $0x67,%al
+  800968:	0f 84 18 ff ff ff    	je     800886 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80096e:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800975:	3c 72                	cmp    $0x72,%al
+  800977:	0f 84 09 ff ff ff    	je     800886 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80097d:	3c 62                	cmp    $0x62,%al
+  80097f:	0f 94 c0             	sete   %al
+  800982:	0f b6 c0             	movzbl %al,%eax
+  800985:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800988:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80098b:	e9 f6 fe ff ff       	jmp    800886 <vprintfmt+0x2e>
+  800990:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800993:	eb 89                	jmp    80091e <vprintfmt+0xc6>
+			lflag++;
+  800995:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800998:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80099a:	e9 1c ff ff ff       	jmp    8008bb <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80099f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a2:	8d 58 04             	lea    0x4(%eax),%ebx
+  8009a5:	83 ec 08             	sub    $0x8,%esp
+  8009a8:	ff 75 0c             	push   0xc(%ebp)
+  8009ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009ae:	c1 e0 08             	shl    $0x8,%eax
+  8009b1:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8009b4:	0b 01                	or     (%ecx),%eax
+  8009b6:	50                   	push   %eax
+  8009b7:	ff d7                	call   *%edi
+			break;
+  8009b9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8009bc:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8009bf:	e9 c2 fe ff ff       	jmp    800886 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8009c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c7:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8009ca:	8b 10                	mov    (%eax),%edx
+  8009cc:	89 d0                	mov    %edx,%eax
+  8009ce:	f7 d8                	neg    %eax
+  8009d0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009d3:	83 f8 12             	cmp    $0x12,%eax
+  8009d6:	7f 25                	jg     8009fd <vprintfmt+0x1a5>
+  8009d8:	8b 14 85 a0 35 80 00 	mov    0x8035a0(,%eax,4),%edx
+  8009df:	85 d2                	test   %edx,%edx
+  8009e1:	74 1a                	je     8009fd <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8009e3:	52                   	push   %edx
+  8009e4:	68 15 37 80 00       	push   $0x803715
+  8009e9:	ff 75 0c             	push   0xc(%ebp)
+  8009ec:	57                   	push   %edi
+  8009ed:	e8 49 fe ff ff       	call   80083b <printfmt>
+  8009f2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009f5:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8009f8:	e9 89 fe ff ff       	jmp    800886 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8009fd:	50                   	push   %eax
+  8009fe:	68 0b 33 80 00       	push   $0x80330b
+  800a03:	ff 75 0c             	push   0xc(%ebp)
+  800a06:	57                   	push   %edi
+  800a07:	e8 2f fe ff ff       	call   80083b <printfmt>
+  800a0c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a0f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800a12:	e9 6f fe ff ff       	jmp    800886 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a17:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1a:	83 c0 04             	add    $0x4,%eax
+  800a1d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800a20:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a23:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800a25:	85 c9                	test   %ecx,%ecx
+  800a27:	b8 04 33 80 00       	mov    $0x803304,%eax
+  800a2c:	0f 45 c1             	cmovne %ecx,%eax
+  800a2f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800a32:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800a36:	7e 06                	jle    800a3e <vprintfmt+0x1e6>
+  800a38:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800a3c:	75 1a                	jne    800a58 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800a3e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a41:	c1 e0 08             	shl    $0x8,%eax
+  800a44:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800a47:	83 c8 3f             	or     $0x3f,%eax
+  800a4a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800a4d:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800a50:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a53:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800a56:	eb 6d                	jmp    800ac5 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a58:	83 ec 08             	sub    $0x8,%esp
+  800a5b:	ff 75 d0             	push   -0x30(%ebp)
+  800a5e:	ff 75 c8             	push   -0x38(%ebp)
+  800a61:	e8 39 03 00 00       	call   800d9f <strnlen>
+  800a66:	89 c2                	mov    %eax,%edx
+  800a68:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a6b:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800a6d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800a70:	c1 e1 08             	shl    $0x8,%ecx
+  800a73:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800a77:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a79:	83 c4 10             	add    $0x10,%esp
+  800a7c:	89 c3                	mov    %eax,%ebx
+  800a7e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a81:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a84:	89 ce                	mov    %ecx,%esi
+  800a86:	eb 0f                	jmp    800a97 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800a88:	83 ec 08             	sub    $0x8,%esp
+  800a8b:	ff 75 0c             	push   0xc(%ebp)
+  800a8e:	56                   	push   %esi
+  800a8f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a91:	83 eb 01             	sub    $0x1,%ebx
+  800a94:	83 c4 10             	add    $0x10,%esp
+  800a97:	85 db                	test   %ebx,%ebx
+  800a99:	7f ed                	jg     800a88 <vprintfmt+0x230>
+  800a9b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a9e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800aa1:	85 c0                	test   %eax,%eax
+  800aa3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aa8:	0f 49 d0             	cmovns %eax,%edx
+  800aab:	29 d0                	sub    %edx,%eax
+  800aad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ab0:	eb 8c                	jmp    800a3e <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800ab2:	83 ec 08             	sub    $0x8,%esp
+  800ab5:	ff 75 0c             	push   0xc(%ebp)
+  800ab8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800abb:	09 c2                	or     %eax,%edx
+  800abd:	52                   	push   %edx
+  800abe:	ff d7                	call   *%edi
+  800ac0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ac3:	89 d9                	mov    %ebx,%ecx
+  800ac5:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800ac8:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800acc:	0f be d0             	movsbl %al,%edx
+  800acf:	85 d2                	test   %edx,%edx
+  800ad1:	74 2a                	je     800afd <vprintfmt+0x2a5>
+  800ad3:	85 f6                	test   %esi,%esi
+  800ad5:	78 05                	js     800adc <vprintfmt+0x284>
+  800ad7:	83 ee 01             	sub    $0x1,%esi
+  800ada:	78 3b                	js     800b17 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800adc:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800ae0:	74 d0                	je     800ab2 <vprintfmt+0x25a>
+  800ae2:	0f be c0             	movsbl %al,%eax
+  800ae5:	83 e8 20             	sub    $0x20,%eax
+  800ae8:	83 f8 5e             	cmp    $0x5e,%eax
+  800aeb:	76 c5                	jbe    800ab2 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800aed:	83 ec 08             	sub    $0x8,%esp
+  800af0:	ff 75 0c             	push   0xc(%ebp)
+  800af3:	ff 75 cc             	push   -0x34(%ebp)
+  800af6:	ff d7                	call   *%edi
+  800af8:	83 c4 10             	add    $0x10,%esp
+  800afb:	eb c6                	jmp    800ac3 <vprintfmt+0x26b>
+  800afd:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b00:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800b03:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b06:	01 c3                	add    %eax,%ebx
+  800b08:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800b0a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800b0d:	83 c8 20             	or     $0x20,%eax
+  800b10:	89 75 10             	mov    %esi,0x10(%ebp)
+  800b13:	89 c6                	mov    %eax,%esi
+  800b15:	eb 14                	jmp    800b2b <vprintfmt+0x2d3>
+  800b17:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b1a:	eb e4                	jmp    800b00 <vprintfmt+0x2a8>
+  800b1c:	83 ec 08             	sub    $0x8,%esp
+  800b1f:	ff 75 0c             	push   0xc(%ebp)
+  800b22:	56                   	push   %esi
+  800b23:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800b25:	83 eb 01             	sub    $0x1,%ebx
+  800b28:	83 c4 10             	add    $0x10,%esp
+  800b2b:	85 db                	test   %ebx,%ebx
+  800b2d:	7f ed                	jg     800b1c <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800b2f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b32:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800b35:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b38:	e9 49 fd ff ff       	jmp    800886 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800b3d:	83 f9 01             	cmp    $0x1,%ecx
+  800b40:	7f 1f                	jg     800b61 <vprintfmt+0x309>
+	else if (lflag)
+  800b42:	85 c9                	test   %ecx,%ecx
+  800b44:	74 69                	je     800baf <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800b46:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b49:	8b 00                	mov    (%eax),%eax
+  800b4b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b4e:	89 c1                	mov    %eax,%ecx
+  800b50:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b53:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b56:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b59:	8d 40 04             	lea    0x4(%eax),%eax
+  800b5c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b5f:	eb 17                	jmp    800b78 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800b61:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b64:	8b 50 04             	mov    0x4(%eax),%edx
+  800b67:	8b 00                	mov    (%eax),%eax
+  800b69:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b6c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b6f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b72:	8d 40 08             	lea    0x8(%eax),%eax
+  800b75:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800b78:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800b7b:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800b7e:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800b83:	85 db                	test   %ebx,%ebx
+  800b85:	0f 89 f6 00 00 00    	jns    800c81 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800b8b:	83 ec 08             	sub    $0x8,%esp
+  800b8e:	ff 75 0c             	push   0xc(%ebp)
+  800b91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b94:	c1 e0 08             	shl    $0x8,%eax
+  800b97:	83 c8 2d             	or     $0x2d,%eax
+  800b9a:	50                   	push   %eax
+  800b9b:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800b9d:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800ba0:	f7 d9                	neg    %ecx
+  800ba2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ba5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800baa:	e9 d2 00 00 00       	jmp    800c81 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800baf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb2:	8b 00                	mov    (%eax),%eax
+  800bb4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bb7:	89 c1                	mov    %eax,%ecx
+  800bb9:	c1 f9 1f             	sar    $0x1f,%ecx
+  800bbc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bbf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc2:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bc8:	eb ae                	jmp    800b78 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800bca:	83 f9 01             	cmp    $0x1,%ecx
+  800bcd:	7f 19                	jg     800be8 <vprintfmt+0x390>
+	else if (lflag)
+  800bcf:	85 c9                	test   %ecx,%ecx
+  800bd1:	74 2a                	je     800bfd <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800bd3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd6:	8b 08                	mov    (%eax),%ecx
+  800bd8:	8d 40 04             	lea    0x4(%eax),%eax
+  800bdb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bde:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800be3:	e9 99 00 00 00       	jmp    800c81 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800be8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800beb:	8b 08                	mov    (%eax),%ecx
+  800bed:	8d 40 08             	lea    0x8(%eax),%eax
+  800bf0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800bf3:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800bf8:	e9 84 00 00 00       	jmp    800c81 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800bfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c00:	8b 08                	mov    (%eax),%ecx
+  800c02:	8d 40 04             	lea    0x4(%eax),%eax
+  800c05:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c08:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800c0d:	eb 72                	jmp    800c81 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800c0f:	83 f9 01             	cmp    $0x1,%ecx
+  800c12:	7f 16                	jg     800c2a <vprintfmt+0x3d2>
+	else if (lflag)
+  800c14:	85 c9                	test   %ecx,%ecx
+  800c16:	74 24                	je     800c3c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800c18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c1b:	8b 08                	mov    (%eax),%ecx
+  800c1d:	8d 40 04             	lea    0x4(%eax),%eax
+  800c20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c23:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800c28:	eb 57                	jmp    800c81 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800c2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c2d:	8b 08                	mov    (%eax),%ecx
+  800c2f:	8d 40 08             	lea    0x8(%eax),%eax
+  800c32:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c35:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800c3a:	eb 45                	jmp    800c81 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800c3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3f:	8b 08                	mov    (%eax),%ecx
+  800c41:	8d 40 04             	lea    0x4(%eax),%eax
+  800c44:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800c47:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800c4c:	eb 33                	jmp    800c81 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800c4e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c51:	c1 e3 08             	shl    $0x8,%ebx
+  800c54:	83 ec 08             	sub    $0x8,%esp
+  800c57:	ff 75 0c             	push   0xc(%ebp)
+  800c5a:	89 d8                	mov    %ebx,%eax
+  800c5c:	83 c8 30             	or     $0x30,%eax
+  800c5f:	50                   	push   %eax
+  800c60:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800c62:	83 c4 08             	add    $0x8,%esp
+  800c65:	ff 75 0c             	push   0xc(%ebp)
+  800c68:	83 cb 78             	or     $0x78,%ebx
+  800c6b:	53                   	push   %ebx
+  800c6c:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800c6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c71:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800c73:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c76:	8d 40 04             	lea    0x4(%eax),%eax
+  800c79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c7c:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800c81:	ff 75 e4             	push   -0x1c(%ebp)
+  800c84:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800c88:	52                   	push   %edx
+  800c89:	ff 75 e0             	push   -0x20(%ebp)
+  800c8c:	50                   	push   %eax
+  800c8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c90:	89 f8                	mov    %edi,%eax
+  800c92:	e8 f7 fa ff ff       	call   80078e <printnum>
+			break;
+  800c97:	83 c4 10             	add    $0x10,%esp
+  800c9a:	e9 e7 fb ff ff       	jmp    800886 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800c9f:	83 f9 01             	cmp    $0x1,%ecx
+  800ca2:	7f 16                	jg     800cba <vprintfmt+0x462>
+	else if (lflag)
+  800ca4:	85 c9                	test   %ecx,%ecx
+  800ca6:	74 24                	je     800ccc <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800ca8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cab:	8b 08                	mov    (%eax),%ecx
+  800cad:	8d 40 04             	lea    0x4(%eax),%eax
+  800cb0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cb3:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800cb8:	eb c7                	jmp    800c81 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800cba:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cbd:	8b 08                	mov    (%eax),%ecx
+  800cbf:	8d 40 08             	lea    0x8(%eax),%eax
+  800cc2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cc5:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800cca:	eb b5                	jmp    800c81 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800ccc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ccf:	8b 08                	mov    (%eax),%ecx
+  800cd1:	8d 40 04             	lea    0x4(%eax),%eax
+  800cd4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800cd7:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800cdc:	eb a3                	jmp    800c81 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800cde:	83 ec 08             	sub    $0x8,%esp
+  800ce1:	ff 75 0c             	push   0xc(%ebp)
+  800ce4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800ce7:	c1 e0 08             	shl    $0x8,%eax
+  800cea:	83 c8 25             	or     $0x25,%eax
+  800ced:	50                   	push   %eax
+  800cee:	ff d7                	call   *%edi
+			break;
+  800cf0:	83 c4 10             	add    $0x10,%esp
+  800cf3:	e9 8e fb ff ff       	jmp    800886 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800cf8:	83 ec 08             	sub    $0x8,%esp
+  800cfb:	ff 75 0c             	push   0xc(%ebp)
+  800cfe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800d01:	c1 e0 08             	shl    $0x8,%eax
+  800d04:	83 c8 25             	or     $0x25,%eax
+  800d07:	50                   	push   %eax
+  800d08:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d0a:	83 c4 10             	add    $0x10,%esp
+  800d0d:	89 de                	mov    %ebx,%esi
+  800d0f:	eb 03                	jmp    800d14 <vprintfmt+0x4bc>
+  800d11:	83 ee 01             	sub    $0x1,%esi
+  800d14:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800d18:	75 f7                	jne    800d11 <vprintfmt+0x4b9>
+  800d1a:	e9 67 fb ff ff       	jmp    800886 <vprintfmt+0x2e>
+
+00800d1f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d1f:	55                   	push   %ebp
+  800d20:	89 e5                	mov    %esp,%ebp
+  800d22:	83 ec 18             	sub    $0x18,%esp
+  800d25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d28:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800d2b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d2e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d32:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d35:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800d3c:	85 c0                	test   %eax,%eax
+  800d3e:	74 26                	je     800d66 <vsnprintf+0x47>
+  800d40:	85 d2                	test   %edx,%edx
+  800d42:	7e 22                	jle    800d66 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d44:	ff 75 14             	push   0x14(%ebp)
+  800d47:	ff 75 10             	push   0x10(%ebp)
+  800d4a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d4d:	50                   	push   %eax
+  800d4e:	68 1e 08 80 00       	push   $0x80081e
+  800d53:	e8 00 fb ff ff       	call   800858 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d58:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d5b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d61:	83 c4 10             	add    $0x10,%esp
+}
+  800d64:	c9                   	leave
+  800d65:	c3                   	ret
+		return -E_INVAL;
+  800d66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d6b:	eb f7                	jmp    800d64 <vsnprintf+0x45>
+
+00800d6d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800d73:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d76:	50                   	push   %eax
+  800d77:	ff 75 10             	push   0x10(%ebp)
+  800d7a:	ff 75 0c             	push   0xc(%ebp)
+  800d7d:	ff 75 08             	push   0x8(%ebp)
+  800d80:	e8 9a ff ff ff       	call   800d1f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d85:	c9                   	leave
+  800d86:	c3                   	ret
+
+00800d87 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d92:	eb 03                	jmp    800d97 <strlen+0x10>
+		n++;
+  800d94:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800d97:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d9b:	75 f7                	jne    800d94 <strlen+0xd>
+	return n;
+}
+  800d9d:	5d                   	pop    %ebp
+  800d9e:	c3                   	ret
+
+00800d9f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800da5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dad:	eb 03                	jmp    800db2 <strnlen+0x13>
+		n++;
+  800daf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800db2:	39 d0                	cmp    %edx,%eax
+  800db4:	74 08                	je     800dbe <strnlen+0x1f>
+  800db6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800dba:	75 f3                	jne    800daf <strnlen+0x10>
+  800dbc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800dbe:	89 d0                	mov    %edx,%eax
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+
+00800dc2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	53                   	push   %ebx
+  800dc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dc9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800dd5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800dd8:	83 c0 01             	add    $0x1,%eax
+  800ddb:	84 d2                	test   %dl,%dl
+  800ddd:	75 f2                	jne    800dd1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ddf:	89 c8                	mov    %ecx,%eax
+  800de1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800de4:	c9                   	leave
+  800de5:	c3                   	ret
+
+00800de6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	53                   	push   %ebx
+  800dea:	83 ec 10             	sub    $0x10,%esp
+  800ded:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800df0:	53                   	push   %ebx
+  800df1:	e8 91 ff ff ff       	call   800d87 <strlen>
+  800df6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800df9:	ff 75 0c             	push   0xc(%ebp)
+  800dfc:	01 d8                	add    %ebx,%eax
+  800dfe:	50                   	push   %eax
+  800dff:	e8 be ff ff ff       	call   800dc2 <strcpy>
+	return dst;
+}
+  800e04:	89 d8                	mov    %ebx,%eax
+  800e06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e09:	c9                   	leave
+  800e0a:	c3                   	ret
+
+00800e0b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	56                   	push   %esi
+  800e0f:	53                   	push   %ebx
+  800e10:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e13:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800e16:	89 f3                	mov    %esi,%ebx
+  800e18:	03 5d 10             	add    0x10(%ebp),%ebx
+  800e1b:	89 f0                	mov    %esi,%eax
+  800e1d:	eb 0f                	jmp    800e2e <strncpy+0x23>
+		*dst++ = *src;
+  800e1f:	83 c0 01             	add    $0x1,%eax
+  800e22:	0f b6 0a             	movzbl (%edx),%ecx
+  800e25:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800e28:	80 f9 01             	cmp    $0x1,%cl
+  800e2b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800e2e:	39 d8                	cmp    %ebx,%eax
+  800e30:	75 ed                	jne    800e1f <strncpy+0x14>
+	}
+	return ret;
+}
+  800e32:	89 f0                	mov    %esi,%eax
+  800e34:	5b                   	pop    %ebx
+  800e35:	5e                   	pop    %esi
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+
+00800e38 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	56                   	push   %esi
+  800e3c:	53                   	push   %ebx
+  800e3d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e43:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800e46:	89 f0                	mov    %esi,%eax
+  800e48:	85 d2                	test   %edx,%edx
+  800e4a:	74 21                	je     800e6d <strlcpy+0x35>
+  800e4c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800e50:	89 f2                	mov    %esi,%edx
+  800e52:	eb 09                	jmp    800e5d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800e54:	83 c1 01             	add    $0x1,%ecx
+  800e57:	83 c2 01             	add    $0x1,%edx
+  800e5a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800e5d:	39 c2                	cmp    %eax,%edx
+  800e5f:	74 09                	je     800e6a <strlcpy+0x32>
+  800e61:	0f b6 19             	movzbl (%ecx),%ebx
+  800e64:	84 db                	test   %bl,%bl
+  800e66:	75 ec                	jne    800e54 <strlcpy+0x1c>
+  800e68:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800e6a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e6d:	29 f0                	sub    %esi,%eax
+}
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e79:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e7c:	eb 06                	jmp    800e84 <strcmp+0x11>
+		p++, q++;
+  800e7e:	83 c1 01             	add    $0x1,%ecx
+  800e81:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e84:	0f b6 01             	movzbl (%ecx),%eax
+  800e87:	84 c0                	test   %al,%al
+  800e89:	74 04                	je     800e8f <strcmp+0x1c>
+  800e8b:	3a 02                	cmp    (%edx),%al
+  800e8d:	74 ef                	je     800e7e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e8f:	0f b6 c0             	movzbl %al,%eax
+  800e92:	0f b6 12             	movzbl (%edx),%edx
+  800e95:	29 d0                	sub    %edx,%eax
+}
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+
+00800e99 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	53                   	push   %ebx
+  800e9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ea6:	eb 09                	jmp    800eb1 <strncmp+0x18>
+		n--, p++, q++;
+  800ea8:	83 ea 01             	sub    $0x1,%edx
+  800eab:	83 c0 01             	add    $0x1,%eax
+  800eae:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800eb1:	85 d2                	test   %edx,%edx
+  800eb3:	74 18                	je     800ecd <strncmp+0x34>
+  800eb5:	0f b6 18             	movzbl (%eax),%ebx
+  800eb8:	84 db                	test   %bl,%bl
+  800eba:	74 04                	je     800ec0 <strncmp+0x27>
+  800ebc:	3a 19                	cmp    (%ecx),%bl
+  800ebe:	74 e8                	je     800ea8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ec0:	0f b6 00             	movzbl (%eax),%eax
+  800ec3:	0f b6 11             	movzbl (%ecx),%edx
+  800ec6:	29 d0                	sub    %edx,%eax
+}
+  800ec8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ecb:	c9                   	leave
+  800ecc:	c3                   	ret
+		return 0;
+  800ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed2:	eb f4                	jmp    800ec8 <strncmp+0x2f>
+
+00800ed4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eda:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ede:	eb 03                	jmp    800ee3 <strchr+0xf>
+  800ee0:	83 c0 01             	add    $0x1,%eax
+  800ee3:	0f b6 10             	movzbl (%eax),%edx
+  800ee6:	84 d2                	test   %dl,%dl
+  800ee8:	74 06                	je     800ef0 <strchr+0x1c>
+		if (*s == c)
+  800eea:	38 ca                	cmp    %cl,%dl
+  800eec:	75 f2                	jne    800ee0 <strchr+0xc>
+  800eee:	eb 05                	jmp    800ef5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+
+00800ef7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800efd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f01:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800f04:	38 ca                	cmp    %cl,%dl
+  800f06:	74 09                	je     800f11 <strfind+0x1a>
+  800f08:	84 d2                	test   %dl,%dl
+  800f0a:	74 05                	je     800f11 <strfind+0x1a>
+	for (; *s; s++)
+  800f0c:	83 c0 01             	add    $0x1,%eax
+  800f0f:	eb f0                	jmp    800f01 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+
+00800f13 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f1a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800f1d:	85 c9                	test   %ecx,%ecx
+  800f1f:	74 20                	je     800f41 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800f21:	89 f8                	mov    %edi,%eax
+  800f23:	09 c8                	or     %ecx,%eax
+  800f25:	a8 03                	test   $0x3,%al
+  800f27:	75 12                	jne    800f3b <memset+0x28>
+		c &= 0xFF;
+  800f29:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f2d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800f33:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800f36:	fc                   	cld
+  800f37:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f39:	eb 06                	jmp    800f41 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800f3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f3e:	fc                   	cld
+  800f3f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800f41:	89 f8                	mov    %edi,%eax
+  800f43:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f46:	c9                   	leave
+  800f47:	c3                   	ret
+
+00800f48 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f48:	55                   	push   %ebp
+  800f49:	89 e5                	mov    %esp,%ebp
+  800f4b:	57                   	push   %edi
+  800f4c:	56                   	push   %esi
+  800f4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f50:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f53:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f56:	39 c6                	cmp    %eax,%esi
+  800f58:	73 32                	jae    800f8c <memmove+0x44>
+  800f5a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f5d:	39 d0                	cmp    %edx,%eax
+  800f5f:	73 2b                	jae    800f8c <memmove+0x44>
+		s += n;
+		d += n;
+  800f61:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f64:	89 d6                	mov    %edx,%esi
+  800f66:	09 fe                	or     %edi,%esi
+  800f68:	09 ce                	or     %ecx,%esi
+  800f6a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f70:	75 0e                	jne    800f80 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f72:	83 ef 04             	sub    $0x4,%edi
+  800f75:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f78:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f7b:	fd                   	std
+  800f7c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f7e:	eb 09                	jmp    800f89 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f80:	83 ef 01             	sub    $0x1,%edi
+  800f83:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f86:	fd                   	std
+  800f87:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f89:	fc                   	cld
+  800f8a:	eb 1a                	jmp    800fa6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f8c:	89 f2                	mov    %esi,%edx
+  800f8e:	09 c2                	or     %eax,%edx
+  800f90:	09 ca                	or     %ecx,%edx
+  800f92:	f6 c2 03             	test   $0x3,%dl
+  800f95:	75 0a                	jne    800fa1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f97:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f9a:	89 c7                	mov    %eax,%edi
+  800f9c:	fc                   	cld
+  800f9d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f9f:	eb 05                	jmp    800fa6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800fa1:	89 c7                	mov    %eax,%edi
+  800fa3:	fc                   	cld
+  800fa4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+
+00800faa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800fb0:	ff 75 10             	push   0x10(%ebp)
+  800fb3:	ff 75 0c             	push   0xc(%ebp)
+  800fb6:	ff 75 08             	push   0x8(%ebp)
+  800fb9:	e8 8a ff ff ff       	call   800f48 <memmove>
+}
+  800fbe:	c9                   	leave
+  800fbf:	c3                   	ret
+
+00800fc0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+  800fc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800fcb:	89 c6                	mov    %eax,%esi
+  800fcd:	03 75 10             	add    0x10(%ebp),%esi
+  800fd0:	eb 06                	jmp    800fd8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800fd2:	83 c0 01             	add    $0x1,%eax
+  800fd5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800fd8:	39 f0                	cmp    %esi,%eax
+  800fda:	74 14                	je     800ff0 <memcmp+0x30>
+		if (*s1 != *s2)
+  800fdc:	0f b6 08             	movzbl (%eax),%ecx
+  800fdf:	0f b6 1a             	movzbl (%edx),%ebx
+  800fe2:	38 d9                	cmp    %bl,%cl
+  800fe4:	74 ec                	je     800fd2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800fe6:	0f b6 c1             	movzbl %cl,%eax
+  800fe9:	0f b6 db             	movzbl %bl,%ebx
+  800fec:	29 d8                	sub    %ebx,%eax
+  800fee:	eb 05                	jmp    800ff5 <memcmp+0x35>
+	}
+
+	return 0;
+  800ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+
+00800ff9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801002:	89 c2                	mov    %eax,%edx
+  801004:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801007:	eb 03                	jmp    80100c <memfind+0x13>
+  801009:	83 c0 01             	add    $0x1,%eax
+  80100c:	39 d0                	cmp    %edx,%eax
+  80100e:	73 04                	jae    801014 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801010:	38 08                	cmp    %cl,(%eax)
+  801012:	75 f5                	jne    801009 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+
+00801016 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+  80101c:	83 ec 1c             	sub    $0x1c,%esp
+  80101f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801022:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801025:	eb 03                	jmp    80102a <strtol+0x14>
+		s++;
+  801027:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  80102a:	0f b6 06             	movzbl (%esi),%eax
+  80102d:	3c 20                	cmp    $0x20,%al
+  80102f:	74 f6                	je     801027 <strtol+0x11>
+  801031:	3c 09                	cmp    $0x9,%al
+  801033:	74 f2                	je     801027 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  801035:	3c 2b                	cmp    $0x2b,%al
+  801037:	74 43                	je     80107c <strtol+0x66>
+	int neg = 0;
+  801039:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  80103e:	3c 2d                	cmp    $0x2d,%al
+  801040:	74 44                	je     801086 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801042:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  801048:	75 0f                	jne    801059 <strtol+0x43>
+  80104a:	80 3e 30             	cmpb   $0x30,(%esi)
+  80104d:	74 41                	je     801090 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80104f:	85 ff                	test   %edi,%edi
+  801051:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801056:	0f 44 f8             	cmove  %eax,%edi
+  801059:	b8 00 00 00 00       	mov    $0x0,%eax
+  80105e:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  801063:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  801066:	89 fb                	mov    %edi,%ebx
+  801068:	c1 fb 1f             	sar    $0x1f,%ebx
+  80106b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80106e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801071:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  801074:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801077:	89 75 08             	mov    %esi,0x8(%ebp)
+  80107a:	eb 67                	jmp    8010e3 <strtol+0xcd>
+		s++;
+  80107c:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  80107f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801084:	eb bc                	jmp    801042 <strtol+0x2c>
+		s++, neg = 1;
+  801086:	83 c6 01             	add    $0x1,%esi
+  801089:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80108e:	eb b2                	jmp    801042 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801090:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  801094:	74 0e                	je     8010a4 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  801096:	85 ff                	test   %edi,%edi
+  801098:	75 bf                	jne    801059 <strtol+0x43>
+		s++, base = 8;
+  80109a:	83 c6 01             	add    $0x1,%esi
+  80109d:	bf 08 00 00 00       	mov    $0x8,%edi
+  8010a2:	eb b5                	jmp    801059 <strtol+0x43>
+		s += 2, base = 16;
+  8010a4:	83 c6 02             	add    $0x2,%esi
+  8010a7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8010ac:	eb ab                	jmp    801059 <strtol+0x43>
+			dig = *s - '0';
+  8010ae:	0f be c9             	movsbl %cl,%ecx
+  8010b1:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  8010b4:	39 f9                	cmp    %edi,%ecx
+  8010b6:	7d 59                	jge    801111 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  8010b8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8010bc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8010bf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8010c2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  8010c5:	0f af d8             	imul   %eax,%ebx
+  8010c8:	0f af d7             	imul   %edi,%edx
+  8010cb:	01 d3                	add    %edx,%ebx
+  8010cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8010d0:	f7 e7                	mul    %edi
+  8010d2:	01 da                	add    %ebx,%edx
+  8010d4:	89 cb                	mov    %ecx,%ebx
+  8010d6:	c1 fb 1f             	sar    $0x1f,%ebx
+  8010d9:	01 c8                	add    %ecx,%eax
+  8010db:	11 da                	adc    %ebx,%edx
+  8010dd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  8010e0:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  8010e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010e6:	0f b6 08             	movzbl (%eax),%ecx
+  8010e9:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  8010ec:	80 fb 09             	cmp    $0x9,%bl
+  8010ef:	76 bd                	jbe    8010ae <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  8010f1:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  8010f4:	80 fb 19             	cmp    $0x19,%bl
+  8010f7:	77 08                	ja     801101 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  8010f9:	0f be c9             	movsbl %cl,%ecx
+  8010fc:	83 e9 57             	sub    $0x57,%ecx
+  8010ff:	eb b3                	jmp    8010b4 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801101:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  801104:	80 fb 19             	cmp    $0x19,%bl
+  801107:	77 08                	ja     801111 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  801109:	0f be c9             	movsbl %cl,%ecx
+  80110c:	83 e9 37             	sub    $0x37,%ecx
+  80110f:	eb a3                	jmp    8010b4 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801111:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801114:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801117:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  80111a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80111d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801121:	74 05                	je     801128 <strtol+0x112>
+		*endptr = (char *) s;
+  801123:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801126:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  801128:	85 c9                	test   %ecx,%ecx
+  80112a:	74 07                	je     801133 <strtol+0x11d>
+  80112c:	f7 d8                	neg    %eax
+  80112e:	83 d2 00             	adc    $0x0,%edx
+  801131:	f7 da                	neg    %edx
+}
+  801133:	83 c4 1c             	add    $0x1c,%esp
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5f                   	pop    %edi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+
+0080113b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	57                   	push   %edi
+  80113f:	56                   	push   %esi
+  801140:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801141:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801148:	74 18                	je     801162 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  80114a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801152:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801155:	89 c3                	mov    %eax,%ebx
+  801157:	89 c7                	mov    %eax,%edi
+  801159:	89 c6                	mov    %eax,%esi
+  80115b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801162:	b8 00 00 00 00       	mov    $0x0,%eax
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	89 c3                	mov    %eax,%ebx
+  80116f:	89 c7                	mov    %eax,%edi
+  801171:	55                   	push   %ebp
+  801172:	89 e5                	mov    %esp,%ebp
+  801174:	8d 35 7c 11 80 00    	lea    0x80117c,%esi
+  80117a:	0f 34                	sysenter
+  80117c:	5d                   	pop    %ebp
+		goto out;
+  80117d:	eb de                	jmp    80115d <sys_cputs+0x22>
+
+0080117f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80117f:	55                   	push   %ebp
+  801180:	89 e5                	mov    %esp,%ebp
+  801182:	57                   	push   %edi
+  801183:	56                   	push   %esi
+  801184:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801185:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  80118c:	74 19                	je     8011a7 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  80118e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801193:	b8 01 00 00 00       	mov    $0x1,%eax
+  801198:	89 d1                	mov    %edx,%ecx
+  80119a:	89 d3                	mov    %edx,%ebx
+  80119c:	89 d7                	mov    %edx,%edi
+  80119e:	89 d6                	mov    %edx,%esi
+  8011a0:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8011a2:	5b                   	pop    %ebx
+  8011a3:	5e                   	pop    %esi
+  8011a4:	5f                   	pop    %edi
+  8011a5:	5d                   	pop    %ebp
+  8011a6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011b1:	89 d1                	mov    %edx,%ecx
+  8011b3:	89 d3                	mov    %edx,%ebx
+  8011b5:	89 d7                	mov    %edx,%edi
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	8d 35 c2 11 80 00    	lea    0x8011c2,%esi
+  8011c0:	0f 34                	sysenter
+  8011c2:	5d                   	pop    %ebp
+		goto out;
+  8011c3:	eb dd                	jmp    8011a2 <sys_cgetc+0x23>
+
+008011c5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8011c5:	55                   	push   %ebp
+  8011c6:	89 e5                	mov    %esp,%ebp
+  8011c8:	57                   	push   %edi
+  8011c9:	56                   	push   %esi
+  8011ca:	53                   	push   %ebx
+  8011cb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011ce:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8011d5:	74 21                	je     8011f8 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  8011d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011dc:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e4:	89 cb                	mov    %ecx,%ebx
+  8011e6:	89 cf                	mov    %ecx,%edi
+  8011e8:	89 ce                	mov    %ecx,%esi
+  8011ea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ec:	85 c0                	test   %eax,%eax
+  8011ee:	7f 27                	jg     801217 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8011f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f3:	5b                   	pop    %ebx
+  8011f4:	5e                   	pop    %esi
+  8011f5:	5f                   	pop    %edi
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801200:	b8 03 00 00 00       	mov    $0x3,%eax
+  801205:	89 cb                	mov    %ecx,%ebx
+  801207:	89 cf                	mov    %ecx,%edi
+  801209:	55                   	push   %ebp
+  80120a:	89 e5                	mov    %esp,%ebp
+  80120c:	8d 35 14 12 80 00    	lea    0x801214,%esi
+  801212:	0f 34                	sysenter
+  801214:	5d                   	pop    %ebp
+		goto out;
+  801215:	eb d5                	jmp    8011ec <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801217:	83 ec 0c             	sub    $0xc,%esp
+  80121a:	50                   	push   %eax
+  80121b:	6a 03                	push   $0x3
+  80121d:	68 0b 36 80 00       	push   $0x80360b
+  801222:	6a 3f                	push   $0x3f
+  801224:	68 28 36 80 00       	push   $0x803628
+  801229:	e8 71 f4 ff ff       	call   80069f <_panic>
+
+0080122e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	57                   	push   %edi
+  801232:	56                   	push   %esi
+  801233:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801234:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  80123b:	74 19                	je     801256 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  80123d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801242:	b8 02 00 00 00       	mov    $0x2,%eax
+  801247:	89 d1                	mov    %edx,%ecx
+  801249:	89 d3                	mov    %edx,%ebx
+  80124b:	89 d7                	mov    %edx,%edi
+  80124d:	89 d6                	mov    %edx,%esi
+  80124f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801251:	5b                   	pop    %ebx
+  801252:	5e                   	pop    %esi
+  801253:	5f                   	pop    %edi
+  801254:	5d                   	pop    %ebp
+  801255:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801260:	89 d1                	mov    %edx,%ecx
+  801262:	89 d3                	mov    %edx,%ebx
+  801264:	89 d7                	mov    %edx,%edi
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	8d 35 71 12 80 00    	lea    0x801271,%esi
+  80126f:	0f 34                	sysenter
+  801271:	5d                   	pop    %ebp
+		goto out;
+  801272:	eb dd                	jmp    801251 <sys_getenvid+0x23>
+
+00801274 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801274:	55                   	push   %ebp
+  801275:	89 e5                	mov    %esp,%ebp
+  801277:	57                   	push   %edi
+  801278:	56                   	push   %esi
+  801279:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80127a:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801281:	74 19                	je     80129c <sys_yield+0x28>
+	asm volatile("int %1\n"
+  801283:	ba 00 00 00 00       	mov    $0x0,%edx
+  801288:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80128d:	89 d1                	mov    %edx,%ecx
+  80128f:	89 d3                	mov    %edx,%ebx
+  801291:	89 d7                	mov    %edx,%edi
+  801293:	89 d6                	mov    %edx,%esi
+  801295:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801297:	5b                   	pop    %ebx
+  801298:	5e                   	pop    %esi
+  801299:	5f                   	pop    %edi
+  80129a:	5d                   	pop    %ebp
+  80129b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80129c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8012a6:	89 d1                	mov    %edx,%ecx
+  8012a8:	89 d3                	mov    %edx,%ebx
+  8012aa:	89 d7                	mov    %edx,%edi
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	8d 35 b7 12 80 00    	lea    0x8012b7,%esi
+  8012b5:	0f 34                	sysenter
+  8012b7:	5d                   	pop    %ebp
+		goto out;
+  8012b8:	eb dd                	jmp    801297 <sys_yield+0x23>
+
+008012ba <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	57                   	push   %edi
+  8012be:	56                   	push   %esi
+  8012bf:	53                   	push   %ebx
+  8012c0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012c3:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8012ca:	74 23                	je     8012ef <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  8012cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012df:	89 f7                	mov    %esi,%edi
+  8012e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	7f 29                	jg     801310 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8012e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8012fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	8d 35 0d 13 80 00    	lea    0x80130d,%esi
+  80130b:	0f 34                	sysenter
+  80130d:	5d                   	pop    %ebp
+		goto out;
+  80130e:	eb d3                	jmp    8012e3 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801310:	83 ec 0c             	sub    $0xc,%esp
+  801313:	50                   	push   %eax
+  801314:	6a 04                	push   $0x4
+  801316:	68 0b 36 80 00       	push   $0x80360b
+  80131b:	6a 3f                	push   $0x3f
+  80131d:	68 28 36 80 00       	push   $0x803628
+  801322:	e8 78 f3 ff ff       	call   80069f <_panic>
+
+00801327 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801327:	55                   	push   %ebp
+  801328:	89 e5                	mov    %esp,%ebp
+  80132a:	57                   	push   %edi
+  80132b:	56                   	push   %esi
+  80132c:	53                   	push   %ebx
+  80132d:	83 ec 0c             	sub    $0xc,%esp
+  801330:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  801333:	85 f6                	test   %esi,%esi
+  801335:	75 09                	jne    801340 <sys_page_map+0x19>
+  801337:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  80133e:	74 1f                	je     80135f <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  801340:	b8 05 00 00 00       	mov    $0x5,%eax
+  801345:	8b 55 08             	mov    0x8(%ebp),%edx
+  801348:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801351:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801353:	85 c0                	test   %eax,%eax
+  801355:	7f 27                	jg     80137e <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135a:	5b                   	pop    %ebx
+  80135b:	5e                   	pop    %esi
+  80135c:	5f                   	pop    %edi
+  80135d:	5d                   	pop    %ebp
+  80135e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80135f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801362:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801365:	b8 05 00 00 00       	mov    $0x5,%eax
+  80136a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801370:	55                   	push   %ebp
+  801371:	89 e5                	mov    %esp,%ebp
+  801373:	8d 35 7b 13 80 00    	lea    0x80137b,%esi
+  801379:	0f 34                	sysenter
+  80137b:	5d                   	pop    %ebp
+		goto out;
+  80137c:	eb d5                	jmp    801353 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80137e:	83 ec 0c             	sub    $0xc,%esp
+  801381:	50                   	push   %eax
+  801382:	6a 05                	push   $0x5
+  801384:	68 0b 36 80 00       	push   $0x80360b
+  801389:	6a 3f                	push   $0x3f
+  80138b:	68 28 36 80 00       	push   $0x803628
+  801390:	e8 0a f3 ff ff       	call   80069f <_panic>
+
+00801395 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801395:	55                   	push   %ebp
+  801396:	89 e5                	mov    %esp,%ebp
+  801398:	57                   	push   %edi
+  801399:	56                   	push   %esi
+  80139a:	53                   	push   %ebx
+  80139b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80139e:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8013a5:	74 22                	je     8013c9 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  8013a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ac:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b7:	89 df                	mov    %ebx,%edi
+  8013b9:	89 de                	mov    %ebx,%esi
+  8013bb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013bd:	85 c0                	test   %eax,%eax
+  8013bf:	7f 28                	jg     8013e9 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8013c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c4:	5b                   	pop    %ebx
+  8013c5:	5e                   	pop    %esi
+  8013c6:	5f                   	pop    %edi
+  8013c7:	5d                   	pop    %ebp
+  8013c8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013d9:	89 df                	mov    %ebx,%edi
+  8013db:	55                   	push   %ebp
+  8013dc:	89 e5                	mov    %esp,%ebp
+  8013de:	8d 35 e6 13 80 00    	lea    0x8013e6,%esi
+  8013e4:	0f 34                	sysenter
+  8013e6:	5d                   	pop    %ebp
+		goto out;
+  8013e7:	eb d4                	jmp    8013bd <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013e9:	83 ec 0c             	sub    $0xc,%esp
+  8013ec:	50                   	push   %eax
+  8013ed:	6a 06                	push   $0x6
+  8013ef:	68 0b 36 80 00       	push   $0x80360b
+  8013f4:	6a 3f                	push   $0x3f
+  8013f6:	68 28 36 80 00       	push   $0x803628
+  8013fb:	e8 9f f2 ff ff       	call   80069f <_panic>
+
+00801400 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801400:	55                   	push   %ebp
+  801401:	89 e5                	mov    %esp,%ebp
+  801403:	57                   	push   %edi
+  801404:	56                   	push   %esi
+  801405:	53                   	push   %ebx
+  801406:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801409:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801410:	74 22                	je     801434 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801412:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801417:	b8 08 00 00 00       	mov    $0x8,%eax
+  80141c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801422:	89 df                	mov    %ebx,%edi
+  801424:	89 de                	mov    %ebx,%esi
+  801426:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801428:	85 c0                	test   %eax,%eax
+  80142a:	7f 28                	jg     801454 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80142c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142f:	5b                   	pop    %ebx
+  801430:	5e                   	pop    %esi
+  801431:	5f                   	pop    %edi
+  801432:	5d                   	pop    %ebp
+  801433:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801444:	89 df                	mov    %ebx,%edi
+  801446:	55                   	push   %ebp
+  801447:	89 e5                	mov    %esp,%ebp
+  801449:	8d 35 51 14 80 00    	lea    0x801451,%esi
+  80144f:	0f 34                	sysenter
+  801451:	5d                   	pop    %ebp
+		goto out;
+  801452:	eb d4                	jmp    801428 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801454:	83 ec 0c             	sub    $0xc,%esp
+  801457:	50                   	push   %eax
+  801458:	6a 08                	push   $0x8
+  80145a:	68 0b 36 80 00       	push   $0x80360b
+  80145f:	6a 3f                	push   $0x3f
+  801461:	68 28 36 80 00       	push   $0x803628
+  801466:	e8 34 f2 ff ff       	call   80069f <_panic>
+
+0080146b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	56                   	push   %esi
+  801470:	53                   	push   %ebx
+  801471:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801474:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  80147b:	74 22                	je     80149f <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80147d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801482:	b8 09 00 00 00       	mov    $0x9,%eax
+  801487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148d:	89 df                	mov    %ebx,%edi
+  80148f:	89 de                	mov    %ebx,%esi
+  801491:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801493:	85 c0                	test   %eax,%eax
+  801495:	7f 28                	jg     8014bf <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149a:	5b                   	pop    %ebx
+  80149b:	5e                   	pop    %esi
+  80149c:	5f                   	pop    %edi
+  80149d:	5d                   	pop    %ebp
+  80149e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80149f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014aa:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014af:	89 df                	mov    %ebx,%edi
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	8d 35 bc 14 80 00    	lea    0x8014bc,%esi
+  8014ba:	0f 34                	sysenter
+  8014bc:	5d                   	pop    %ebp
+		goto out;
+  8014bd:	eb d4                	jmp    801493 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014bf:	83 ec 0c             	sub    $0xc,%esp
+  8014c2:	50                   	push   %eax
+  8014c3:	6a 09                	push   $0x9
+  8014c5:	68 0b 36 80 00       	push   $0x80360b
+  8014ca:	6a 3f                	push   $0x3f
+  8014cc:	68 28 36 80 00       	push   $0x803628
+  8014d1:	e8 c9 f1 ff ff       	call   80069f <_panic>
+
+008014d6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8014d6:	55                   	push   %ebp
+  8014d7:	89 e5                	mov    %esp,%ebp
+  8014d9:	57                   	push   %edi
+  8014da:	56                   	push   %esi
+  8014db:	53                   	push   %ebx
+  8014dc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014df:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8014e6:	74 22                	je     80150a <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8014e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f8:	89 df                	mov    %ebx,%edi
+  8014fa:	89 de                	mov    %ebx,%esi
+  8014fc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014fe:	85 c0                	test   %eax,%eax
+  801500:	7f 28                	jg     80152a <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801502:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801505:	5b                   	pop    %ebx
+  801506:	5e                   	pop    %esi
+  801507:	5f                   	pop    %edi
+  801508:	5d                   	pop    %ebp
+  801509:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80150a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801512:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801515:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80151a:	89 df                	mov    %ebx,%edi
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	8d 35 27 15 80 00    	lea    0x801527,%esi
+  801525:	0f 34                	sysenter
+  801527:	5d                   	pop    %ebp
+		goto out;
+  801528:	eb d4                	jmp    8014fe <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	50                   	push   %eax
+  80152e:	6a 0a                	push   $0xa
+  801530:	68 0b 36 80 00       	push   $0x80360b
+  801535:	6a 3f                	push   $0x3f
+  801537:	68 28 36 80 00       	push   $0x803628
+  80153c:	e8 5e f1 ff ff       	call   80069f <_panic>
+
+00801541 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+  801547:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80154a:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801551:	74 22                	je     801575 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801553:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801558:	b8 17 00 00 00       	mov    $0x17,%eax
+  80155d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801560:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801563:	89 df                	mov    %ebx,%edi
+  801565:	89 de                	mov    %ebx,%esi
+  801567:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801569:	85 c0                	test   %eax,%eax
+  80156b:	7f 28                	jg     801595 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80156d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801570:	5b                   	pop    %ebx
+  801571:	5e                   	pop    %esi
+  801572:	5f                   	pop    %edi
+  801573:	5d                   	pop    %ebp
+  801574:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801575:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801580:	b8 17 00 00 00       	mov    $0x17,%eax
+  801585:	89 df                	mov    %ebx,%edi
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	8d 35 92 15 80 00    	lea    0x801592,%esi
+  801590:	0f 34                	sysenter
+  801592:	5d                   	pop    %ebp
+		goto out;
+  801593:	eb d4                	jmp    801569 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801595:	83 ec 0c             	sub    $0xc,%esp
+  801598:	50                   	push   %eax
+  801599:	6a 17                	push   $0x17
+  80159b:	68 0b 36 80 00       	push   $0x80360b
+  8015a0:	6a 3f                	push   $0x3f
+  8015a2:	68 28 36 80 00       	push   $0x803628
+  8015a7:	e8 f3 f0 ff ff       	call   80069f <_panic>
+
+008015ac <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	57                   	push   %edi
+  8015b0:	56                   	push   %esi
+  8015b1:	53                   	push   %ebx
+  8015b2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8015b5:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8015bc:	74 22                	je     8015e0 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8015be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8015c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ce:	89 df                	mov    %ebx,%edi
+  8015d0:	89 de                	mov    %ebx,%esi
+  8015d2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015d4:	85 c0                	test   %eax,%eax
+  8015d6:	7f 28                	jg     801600 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8015d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015db:	5b                   	pop    %ebx
+  8015dc:	5e                   	pop    %esi
+  8015dd:	5f                   	pop    %edi
+  8015de:	5d                   	pop    %ebp
+  8015df:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015eb:	b8 18 00 00 00       	mov    $0x18,%eax
+  8015f0:	89 df                	mov    %ebx,%edi
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	8d 35 fd 15 80 00    	lea    0x8015fd,%esi
+  8015fb:	0f 34                	sysenter
+  8015fd:	5d                   	pop    %ebp
+		goto out;
+  8015fe:	eb d4                	jmp    8015d4 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801600:	83 ec 0c             	sub    $0xc,%esp
+  801603:	50                   	push   %eax
+  801604:	6a 18                	push   $0x18
+  801606:	68 0b 36 80 00       	push   $0x80360b
+  80160b:	6a 3f                	push   $0x3f
+  80160d:	68 28 36 80 00       	push   $0x803628
+  801612:	e8 88 f0 ff ff       	call   80069f <_panic>
+
+00801617 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801617:	55                   	push   %ebp
+  801618:	89 e5                	mov    %esp,%ebp
+  80161a:	57                   	push   %edi
+  80161b:	56                   	push   %esi
+  80161c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80161d:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801624:	74 1d                	je     801643 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801626:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80162b:	be 00 00 00 00       	mov    $0x0,%esi
+  801630:	8b 55 08             	mov    0x8(%ebp),%edx
+  801633:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801636:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801639:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80163c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80163e:	5b                   	pop    %ebx
+  80163f:	5e                   	pop    %esi
+  801640:	5f                   	pop    %edi
+  801641:	5d                   	pop    %ebp
+  801642:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801643:	8b 55 08             	mov    0x8(%ebp),%edx
+  801646:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801649:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80164e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801651:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	8d 35 5f 16 80 00    	lea    0x80165f,%esi
+  80165d:	0f 34                	sysenter
+  80165f:	5d                   	pop    %ebp
+		goto out;
+  801660:	eb dc                	jmp    80163e <sys_ipc_try_send+0x27>
+
+00801662 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801662:	55                   	push   %ebp
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	57                   	push   %edi
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80166b:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801672:	74 21                	je     801695 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801679:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80167e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801681:	89 cb                	mov    %ecx,%ebx
+  801683:	89 cf                	mov    %ecx,%edi
+  801685:	89 ce                	mov    %ecx,%esi
+  801687:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801689:	85 c0                	test   %eax,%eax
+  80168b:	7f 27                	jg     8016b4 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80168d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801690:	5b                   	pop    %ebx
+  801691:	5e                   	pop    %esi
+  801692:	5f                   	pop    %edi
+  801693:	5d                   	pop    %ebp
+  801694:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801695:	8b 55 08             	mov    0x8(%ebp),%edx
+  801698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80169d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8016a2:	89 cb                	mov    %ecx,%ebx
+  8016a4:	89 cf                	mov    %ecx,%edi
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	8d 35 b1 16 80 00    	lea    0x8016b1,%esi
+  8016af:	0f 34                	sysenter
+  8016b1:	5d                   	pop    %ebp
+		goto out;
+  8016b2:	eb d5                	jmp    801689 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016b4:	83 ec 0c             	sub    $0xc,%esp
+  8016b7:	50                   	push   %eax
+  8016b8:	6a 0d                	push   $0xd
+  8016ba:	68 0b 36 80 00       	push   $0x80360b
+  8016bf:	6a 3f                	push   $0x3f
+  8016c1:	68 28 36 80 00       	push   $0x803628
+  8016c6:	e8 d4 ef ff ff       	call   80069f <_panic>
+
+008016cb <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8016cb:	55                   	push   %ebp
+  8016cc:	89 e5                	mov    %esp,%ebp
+  8016ce:	57                   	push   %edi
+  8016cf:	56                   	push   %esi
+  8016d0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016d1:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8016d8:	74 1b                	je     8016f5 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8016da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016df:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8016e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ea:	89 df                	mov    %ebx,%edi
+  8016ec:	89 de                	mov    %ebx,%esi
+  8016ee:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8016f0:	5b                   	pop    %ebx
+  8016f1:	5e                   	pop    %esi
+  8016f2:	5f                   	pop    %edi
+  8016f3:	5d                   	pop    %ebp
+  8016f4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801700:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801705:	89 df                	mov    %ebx,%edi
+  801707:	55                   	push   %ebp
+  801708:	89 e5                	mov    %esp,%ebp
+  80170a:	8d 35 12 17 80 00    	lea    0x801712,%esi
+  801710:	0f 34                	sysenter
+  801712:	5d                   	pop    %ebp
+		goto out;
+  801713:	eb db                	jmp    8016f0 <sys_ipc_recv_until+0x25>
+
+00801715 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801715:	55                   	push   %ebp
+  801716:	89 e5                	mov    %esp,%ebp
+  801718:	57                   	push   %edi
+  801719:	56                   	push   %esi
+  80171a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80171b:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801722:	74 19                	je     80173d <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801724:	ba 00 00 00 00       	mov    $0x0,%edx
+  801729:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80172e:	89 d1                	mov    %edx,%ecx
+  801730:	89 d3                	mov    %edx,%ebx
+  801732:	89 d7                	mov    %edx,%edi
+  801734:	89 d6                	mov    %edx,%esi
+  801736:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801738:	5b                   	pop    %ebx
+  801739:	5e                   	pop    %esi
+  80173a:	5f                   	pop    %edi
+  80173b:	5d                   	pop    %ebp
+  80173c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80173d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801742:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801747:	89 d1                	mov    %edx,%ecx
+  801749:	89 d3                	mov    %edx,%ebx
+  80174b:	89 d7                	mov    %edx,%edi
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	8d 35 58 17 80 00    	lea    0x801758,%esi
+  801756:	0f 34                	sysenter
+  801758:	5d                   	pop    %ebp
+		goto out;
+  801759:	eb dd                	jmp    801738 <sys_time_msec+0x23>
+
+0080175b <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80175b:	55                   	push   %ebp
+  80175c:	89 e5                	mov    %esp,%ebp
+  80175e:	57                   	push   %edi
+  80175f:	56                   	push   %esi
+  801760:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801761:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801768:	74 1a                	je     801784 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80176a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80176f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801774:	8b 55 08             	mov    0x8(%ebp),%edx
+  801777:	89 cb                	mov    %ecx,%ebx
+  801779:	89 cf                	mov    %ecx,%edi
+  80177b:	89 ce                	mov    %ecx,%esi
+  80177d:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80177f:	5b                   	pop    %ebx
+  801780:	5e                   	pop    %esi
+  801781:	5f                   	pop    %edi
+  801782:	5d                   	pop    %ebp
+  801783:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801784:	8b 55 08             	mov    0x8(%ebp),%edx
+  801787:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801791:	89 cb                	mov    %ecx,%ebx
+  801793:	89 cf                	mov    %ecx,%edi
+  801795:	55                   	push   %ebp
+  801796:	89 e5                	mov    %esp,%ebp
+  801798:	8d 35 a0 17 80 00    	lea    0x8017a0,%esi
+  80179e:	0f 34                	sysenter
+  8017a0:	5d                   	pop    %ebp
+		goto out;
+  8017a1:	eb dc                	jmp    80177f <sys_sleep_until+0x24>
+
+008017a3 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	57                   	push   %edi
+  8017a7:	56                   	push   %esi
+  8017a8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017a9:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8017b0:	74 1a                	je     8017cc <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8017b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8017bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bf:	89 cb                	mov    %ecx,%ebx
+  8017c1:	89 cf                	mov    %ecx,%edi
+  8017c3:	89 ce                	mov    %ecx,%esi
+  8017c5:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8017c7:	5b                   	pop    %ebx
+  8017c8:	5e                   	pop    %esi
+  8017c9:	5f                   	pop    %edi
+  8017ca:	5d                   	pop    %ebp
+  8017cb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017d4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8017d9:	89 cb                	mov    %ecx,%ebx
+  8017db:	89 cf                	mov    %ecx,%edi
+  8017dd:	55                   	push   %ebp
+  8017de:	89 e5                	mov    %esp,%ebp
+  8017e0:	8d 35 e8 17 80 00    	lea    0x8017e8,%esi
+  8017e6:	0f 34                	sysenter
+  8017e8:	5d                   	pop    %ebp
+		goto out;
+  8017e9:	eb dc                	jmp    8017c7 <sys_env_print_stats+0x24>
+
+008017eb <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8017eb:	55                   	push   %ebp
+  8017ec:	89 e5                	mov    %esp,%ebp
+  8017ee:	57                   	push   %edi
+  8017ef:	56                   	push   %esi
+  8017f0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017f1:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8017f8:	74 1b                	je     801815 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8017fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ff:	b8 19 00 00 00       	mov    $0x19,%eax
+  801804:	8b 55 08             	mov    0x8(%ebp),%edx
+  801807:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80180a:	89 df                	mov    %ebx,%edi
+  80180c:	89 de                	mov    %ebx,%esi
+  80180e:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801810:	5b                   	pop    %ebx
+  801811:	5e                   	pop    %esi
+  801812:	5f                   	pop    %edi
+  801813:	5d                   	pop    %ebp
+  801814:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801815:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801820:	b8 19 00 00 00       	mov    $0x19,%eax
+  801825:	89 df                	mov    %ebx,%edi
+  801827:	55                   	push   %ebp
+  801828:	89 e5                	mov    %esp,%ebp
+  80182a:	8d 35 32 18 80 00    	lea    0x801832,%esi
+  801830:	0f 34                	sysenter
+  801832:	5d                   	pop    %ebp
+		goto out;
+  801833:	eb db                	jmp    801810 <sys_perf+0x25>
+
+00801835 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801835:	55                   	push   %ebp
+  801836:	89 e5                	mov    %esp,%ebp
+  801838:	57                   	push   %edi
+  801839:	56                   	push   %esi
+  80183a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80183b:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801842:	74 19                	je     80185d <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801844:	ba 00 00 00 00       	mov    $0x0,%edx
+  801849:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80184e:	89 d1                	mov    %edx,%ecx
+  801850:	89 d3                	mov    %edx,%ebx
+  801852:	89 d7                	mov    %edx,%edi
+  801854:	89 d6                	mov    %edx,%esi
+  801856:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801858:	5b                   	pop    %ebx
+  801859:	5e                   	pop    %esi
+  80185a:	5f                   	pop    %edi
+  80185b:	5d                   	pop    %ebp
+  80185c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80185d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801862:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801867:	89 d1                	mov    %edx,%ecx
+  801869:	89 d3                	mov    %edx,%ebx
+  80186b:	89 d7                	mov    %edx,%edi
+  80186d:	55                   	push   %ebp
+  80186e:	89 e5                	mov    %esp,%ebp
+  801870:	8d 35 78 18 80 00    	lea    0x801878,%esi
+  801876:	0f 34                	sysenter
+  801878:	5d                   	pop    %ebp
+		goto out;
+  801879:	eb dd                	jmp    801858 <sys_fork+0x23>
+
+0080187b <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80187b:	55                   	push   %ebp
+  80187c:	89 e5                	mov    %esp,%ebp
+  80187e:	57                   	push   %edi
+  80187f:	56                   	push   %esi
+  801880:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801881:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801888:	74 1c                	je     8018a6 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80188a:	be 00 00 00 00       	mov    $0x0,%esi
+  80188f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801894:	8b 55 08             	mov    0x8(%ebp),%edx
+  801897:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80189d:	89 f7                	mov    %esi,%edi
+  80189f:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8018a1:	5b                   	pop    %ebx
+  8018a2:	5e                   	pop    %esi
+  8018a3:	5f                   	pop    %edi
+  8018a4:	5d                   	pop    %ebp
+  8018a5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ac:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8018b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018b9:	55                   	push   %ebp
+  8018ba:	89 e5                	mov    %esp,%ebp
+  8018bc:	8d 35 c4 18 80 00    	lea    0x8018c4,%esi
+  8018c2:	0f 34                	sysenter
+  8018c4:	5d                   	pop    %ebp
+		goto out;
+  8018c5:	eb da                	jmp    8018a1 <sys_thread_create+0x26>
+
+008018c7 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8018c7:	55                   	push   %ebp
+  8018c8:	89 e5                	mov    %esp,%ebp
+  8018ca:	57                   	push   %edi
+  8018cb:	56                   	push   %esi
+  8018cc:	53                   	push   %ebx
+  8018cd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8018d0:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8018d7:	74 24                	je     8018fd <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8018d9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8018de:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018ec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018ef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018f1:	85 c0                	test   %eax,%eax
+  8018f3:	7f 27                	jg     80191c <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8018f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018f8:	5b                   	pop    %ebx
+  8018f9:	5e                   	pop    %esi
+  8018fa:	5f                   	pop    %edi
+  8018fb:	5d                   	pop    %ebp
+  8018fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801900:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801903:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801908:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80190b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80190e:	55                   	push   %ebp
+  80190f:	89 e5                	mov    %esp,%ebp
+  801911:	8d 35 19 19 80 00    	lea    0x801919,%esi
+  801917:	0f 34                	sysenter
+  801919:	5d                   	pop    %ebp
+		goto out;
+  80191a:	eb d5                	jmp    8018f1 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80191c:	83 ec 0c             	sub    $0xc,%esp
+  80191f:	50                   	push   %eax
+  801920:	6a 1f                	push   $0x1f
+  801922:	68 0b 36 80 00       	push   $0x80360b
+  801927:	6a 3f                	push   $0x3f
+  801929:	68 28 36 80 00       	push   $0x803628
+  80192e:	e8 6c ed ff ff       	call   80069f <_panic>
+
+00801933 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801933:	55                   	push   %ebp
+  801934:	89 e5                	mov    %esp,%ebp
+  801936:	57                   	push   %edi
+  801937:	56                   	push   %esi
+  801938:	53                   	push   %ebx
+  801939:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80193c:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801943:	74 23                	je     801968 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801945:	be 00 00 00 00       	mov    $0x0,%esi
+  80194a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80194f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801952:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801955:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801958:	89 f7                	mov    %esi,%edi
+  80195a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80195c:	85 c0                	test   %eax,%eax
+  80195e:	7f 29                	jg     801989 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801963:	5b                   	pop    %ebx
+  801964:	5e                   	pop    %esi
+  801965:	5f                   	pop    %edi
+  801966:	5d                   	pop    %ebp
+  801967:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801968:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80196e:	b8 20 00 00 00       	mov    $0x20,%eax
+  801973:	bf 00 00 00 00       	mov    $0x0,%edi
+  801978:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80197b:	55                   	push   %ebp
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	8d 35 86 19 80 00    	lea    0x801986,%esi
+  801984:	0f 34                	sysenter
+  801986:	5d                   	pop    %ebp
+		goto out;
+  801987:	eb d3                	jmp    80195c <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801989:	83 ec 0c             	sub    $0xc,%esp
+  80198c:	50                   	push   %eax
+  80198d:	6a 20                	push   $0x20
+  80198f:	68 0b 36 80 00       	push   $0x80360b
+  801994:	6a 3f                	push   $0x3f
+  801996:	68 28 36 80 00       	push   $0x803628
+  80199b:	e8 ff ec ff ff       	call   80069f <_panic>
+
+008019a0 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	57                   	push   %edi
+  8019a4:	56                   	push   %esi
+  8019a5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019a6:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8019ad:	74 1b                	je     8019ca <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8019af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8019b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019bf:	89 df                	mov    %ebx,%edi
+  8019c1:	89 de                	mov    %ebx,%esi
+  8019c3:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8019c5:	5b                   	pop    %ebx
+  8019c6:	5e                   	pop    %esi
+  8019c7:	5f                   	pop    %edi
+  8019c8:	5d                   	pop    %ebp
+  8019c9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019d5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8019da:	89 df                	mov    %ebx,%edi
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	8d 35 e7 19 80 00    	lea    0x8019e7,%esi
+  8019e5:	0f 34                	sysenter
+  8019e7:	5d                   	pop    %ebp
+		goto out;
+  8019e8:	eb db                	jmp    8019c5 <sys_batch+0x25>
+
+008019ea <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	57                   	push   %edi
+  8019ee:	56                   	push   %esi
+  8019ef:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019f0:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  8019f7:	74 1a                	je     801a13 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8019f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019fe:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a06:	89 cb                	mov    %ecx,%ebx
+  801a08:	89 cf                	mov    %ecx,%edi
+  801a0a:	89 ce                	mov    %ecx,%esi
+  801a0c:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801a0e:	5b                   	pop    %ebx
+  801a0f:	5e                   	pop    %esi
+  801a10:	5f                   	pop    %edi
+  801a11:	5d                   	pop    %ebp
+  801a12:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a13:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a1b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801a20:	89 cb                	mov    %ecx,%ebx
+  801a22:	89 cf                	mov    %ecx,%edi
+  801a24:	55                   	push   %ebp
+  801a25:	89 e5                	mov    %esp,%ebp
+  801a27:	8d 35 2f 1a 80 00    	lea    0x801a2f,%esi
+  801a2d:	0f 34                	sysenter
+  801a2f:	5d                   	pop    %ebp
+		goto out;
+  801a30:	eb dc                	jmp    801a0e <sys_trace_ctl+0x24>
+
+00801a32 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801a32:	55                   	push   %ebp
+  801a33:	89 e5                	mov    %esp,%ebp
+  801a35:	57                   	push   %edi
+  801a36:	56                   	push   %esi
+  801a37:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a38:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801a3f:	74 1c                	je     801a5d <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801a41:	be 00 00 00 00       	mov    $0x0,%esi
+  801a46:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801a4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a54:	89 f7                	mov    %esi,%edi
+  801a56:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801a58:	5b                   	pop    %ebx
+  801a59:	5e                   	pop    %esi
+  801a5a:	5f                   	pop    %edi
+  801a5b:	5d                   	pop    %ebp
+  801a5c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a63:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801a68:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a70:	55                   	push   %ebp
+  801a71:	89 e5                	mov    %esp,%ebp
+  801a73:	8d 35 7b 1a 80 00    	lea    0x801a7b,%esi
+  801a79:	0f 34                	sysenter
+  801a7b:	5d                   	pop    %ebp
+		goto out;
+  801a7c:	eb da                	jmp    801a58 <sys_trace_read+0x26>
+
+00801a7e <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	57                   	push   %edi
+  801a82:	56                   	push   %esi
+  801a83:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a84:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801a8b:	74 1c                	je     801aa9 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a92:	b8 21 00 00 00       	mov    $0x21,%eax
+  801a97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801aa0:	89 f7                	mov    %esi,%edi
+  801aa2:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801aa4:	5b                   	pop    %ebx
+  801aa5:	5e                   	pop    %esi
+  801aa6:	5f                   	pop    %edi
+  801aa7:	5d                   	pop    %ebp
+  801aa8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801aa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aaf:	b8 21 00 00 00       	mov    $0x21,%eax
+  801ab4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801abc:	55                   	push   %ebp
+  801abd:	89 e5                	mov    %esp,%ebp
+  801abf:	8d 35 c7 1a 80 00    	lea    0x801ac7,%esi
+  801ac5:	0f 34                	sysenter
+  801ac7:	5d                   	pop    %ebp
+		goto out;
+  801ac8:	eb da                	jmp    801aa4 <sys_meminfo+0x26>
+
+00801aca <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801aca:	55                   	push   %ebp
+  801acb:	89 e5                	mov    %esp,%ebp
+  801acd:	57                   	push   %edi
+  801ace:	56                   	push   %esi
+  801acf:	53                   	push   %ebx
+  801ad0:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801ad3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801ad7:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801ade:	74 1f                	je     801aff <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801ae0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae5:	b8 22 00 00 00       	mov    $0x22,%eax
+  801aea:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aed:	89 df                	mov    %ebx,%edi
+  801aef:	89 de                	mov    %ebx,%esi
+  801af1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	7f 25                	jg     801b1c <sys_env_set_ksm+0x52>
+}
+  801af7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801afa:	5b                   	pop    %ebx
+  801afb:	5e                   	pop    %esi
+  801afc:	5f                   	pop    %edi
+  801afd:	5d                   	pop    %ebp
+  801afe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801aff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b04:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b07:	b8 22 00 00 00       	mov    $0x22,%eax
+  801b0c:	89 df                	mov    %ebx,%edi
+  801b0e:	55                   	push   %ebp
+  801b0f:	89 e5                	mov    %esp,%ebp
+  801b11:	8d 35 19 1b 80 00    	lea    0x801b19,%esi
+  801b17:	0f 34                	sysenter
+  801b19:	5d                   	pop    %ebp
+		goto out;
+  801b1a:	eb d7                	jmp    801af3 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b1c:	83 ec 0c             	sub    $0xc,%esp
+  801b1f:	50                   	push   %eax
+  801b20:	6a 22                	push   $0x22
+  801b22:	68 0b 36 80 00       	push   $0x80360b
+  801b27:	6a 3f                	push   $0x3f
+  801b29:	68 28 36 80 00       	push   $0x803628
+  801b2e:	e8 6c eb ff ff       	call   80069f <_panic>
+
+00801b33 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801b33:	55                   	push   %ebp
+  801b34:	89 e5                	mov    %esp,%ebp
+  801b36:	57                   	push   %edi
+  801b37:	56                   	push   %esi
+  801b38:	53                   	push   %ebx
+  801b39:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801b3c:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801b3f:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801b46:	74 24                	je     801b6c <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801b48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b4d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801b52:	89 cb                	mov    %ecx,%ebx
+  801b54:	89 cf                	mov    %ecx,%edi
+  801b56:	89 ce                	mov    %ecx,%esi
+  801b58:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801b5a:	85 c0                	test   %eax,%eax
+  801b5c:	7f 2a                	jg     801b88 <sys_time_nsec+0x55>
+	return ns;
+}
+  801b5e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b61:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b67:	5b                   	pop    %ebx
+  801b68:	5e                   	pop    %esi
+  801b69:	5f                   	pop    %edi
+  801b6a:	5d                   	pop    %ebp
+  801b6b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b71:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801b76:	89 cb                	mov    %ecx,%ebx
+  801b78:	89 cf                	mov    %ecx,%edi
+  801b7a:	55                   	push   %ebp
+  801b7b:	89 e5                	mov    %esp,%ebp
+  801b7d:	8d 35 85 1b 80 00    	lea    0x801b85,%esi
+  801b83:	0f 34                	sysenter
+  801b85:	5d                   	pop    %ebp
+		goto out;
+  801b86:	eb d2                	jmp    801b5a <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b88:	83 ec 0c             	sub    $0xc,%esp
+  801b8b:	50                   	push   %eax
+  801b8c:	6a 0f                	push   $0xf
+  801b8e:	68 0b 36 80 00       	push   $0x80360b
+  801b93:	6a 3f                	push   $0x3f
+  801b95:	68 28 36 80 00       	push   $0x803628
+  801b9a:	e8 00 eb ff ff       	call   80069f <_panic>
+
+00801b9f <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801b9f:	55                   	push   %ebp
+  801ba0:	89 e5                	mov    %esp,%ebp
+  801ba2:	57                   	push   %edi
+  801ba3:	56                   	push   %esi
+  801ba4:	53                   	push   %ebx
+  801ba5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801ba8:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801baf:	74 22                	je     801bd3 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801bb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb6:	b8 12 00 00 00       	mov    $0x12,%eax
+  801bbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc1:	89 df                	mov    %ebx,%edi
+  801bc3:	89 de                	mov    %ebx,%esi
+  801bc5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801bc7:	85 c0                	test   %eax,%eax
+  801bc9:	7f 28                	jg     801bf3 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801bcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bce:	5b                   	pop    %ebx
+  801bcf:	5e                   	pop    %esi
+  801bd0:	5f                   	pop    %edi
+  801bd1:	5d                   	pop    %ebp
+  801bd2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801bd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bde:	b8 12 00 00 00       	mov    $0x12,%eax
+  801be3:	89 df                	mov    %ebx,%edi
+  801be5:	55                   	push   %ebp
+  801be6:	89 e5                	mov    %esp,%ebp
+  801be8:	8d 35 f0 1b 80 00    	lea    0x801bf0,%esi
+  801bee:	0f 34                	sysenter
+  801bf0:	5d                   	pop    %ebp
+		goto out;
+  801bf1:	eb d4                	jmp    801bc7 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bf3:	83 ec 0c             	sub    $0xc,%esp
+  801bf6:	50                   	push   %eax
+  801bf7:	6a 12                	push   $0x12
+  801bf9:	68 0b 36 80 00       	push   $0x80360b
+  801bfe:	6a 3f                	push   $0x3f
+  801c00:	68 28 36 80 00       	push   $0x803628
+  801c05:	e8 95 ea ff ff       	call   80069f <_panic>
+
+00801c0a <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	57                   	push   %edi
+  801c0e:	56                   	push   %esi
+  801c0f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801c10:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801c17:	74 1b                	je     801c34 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801c19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c1e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801c23:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c29:	89 df                	mov    %ebx,%edi
+  801c2b:	89 de                	mov    %ebx,%esi
+  801c2d:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801c2f:	5b                   	pop    %ebx
+  801c30:	5e                   	pop    %esi
+  801c31:	5f                   	pop    %edi
+  801c32:	5d                   	pop    %ebp
+  801c33:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c39:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c3f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801c44:	89 df                	mov    %ebx,%edi
+  801c46:	55                   	push   %ebp
+  801c47:	89 e5                	mov    %esp,%ebp
+  801c49:	8d 35 51 1c 80 00    	lea    0x801c51,%esi
+  801c4f:	0f 34                	sysenter
+  801c51:	5d                   	pop    %ebp
+		goto out;
+  801c52:	eb db                	jmp    801c2f <sys_e1000_receive+0x25>
+
+00801c54 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+  801c57:	57                   	push   %edi
+  801c58:	56                   	push   %esi
+  801c59:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801c5a:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801c61:	74 1b                	je     801c7e <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801c63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c68:	b8 14 00 00 00       	mov    $0x14,%eax
+  801c6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c73:	89 df                	mov    %ebx,%edi
+  801c75:	89 de                	mov    %ebx,%esi
+  801c77:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801c79:	5b                   	pop    %ebx
+  801c7a:	5e                   	pop    %esi
+  801c7b:	5f                   	pop    %edi
+  801c7c:	5d                   	pop    %ebp
+  801c7d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c83:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c89:	b8 14 00 00 00       	mov    $0x14,%eax
+  801c8e:	89 df                	mov    %ebx,%edi
+  801c90:	55                   	push   %ebp
+  801c91:	89 e5                	mov    %esp,%ebp
+  801c93:	8d 35 9b 1c 80 00    	lea    0x801c9b,%esi
+  801c99:	0f 34                	sysenter
+  801c9b:	5d                   	pop    %ebp
+		goto out;
+  801c9c:	eb db                	jmp    801c79 <sys_e1000_read_hwaddr+0x25>
+
+00801c9e <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801c9e:	55                   	push   %ebp
+  801c9f:	89 e5                	mov    %esp,%ebp
+  801ca1:	57                   	push   %edi
+  801ca2:	56                   	push   %esi
+  801ca3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801ca4:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801cab:	74 1a                	je     801cc7 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801cad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cb2:	b8 15 00 00 00       	mov    $0x15,%eax
+  801cb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cba:	89 cb                	mov    %ecx,%ebx
+  801cbc:	89 cf                	mov    %ecx,%edi
+  801cbe:	89 ce                	mov    %ecx,%esi
+  801cc0:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801cc2:	5b                   	pop    %ebx
+  801cc3:	5e                   	pop    %esi
+  801cc4:	5f                   	pop    %edi
+  801cc5:	5d                   	pop    %ebp
+  801cc6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ccf:	b8 15 00 00 00       	mov    $0x15,%eax
+  801cd4:	89 cb                	mov    %ecx,%ebx
+  801cd6:	89 cf                	mov    %ecx,%edi
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	8d 35 e3 1c 80 00    	lea    0x801ce3,%esi
+  801ce1:	0f 34                	sysenter
+  801ce3:	5d                   	pop    %ebp
+		goto out;
+  801ce4:	eb dc                	jmp    801cc2 <sys_sb16_read_version+0x24>
+
+00801ce6 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	57                   	push   %edi
+  801cea:	56                   	push   %esi
+  801ceb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801cec:	80 3d b8 50 80 00 00 	cmpb   $0x0,0x8050b8
+  801cf3:	74 1b                	je     801d10 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801cf5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cfa:	b8 16 00 00 00       	mov    $0x16,%eax
+  801cff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d05:	89 df                	mov    %ebx,%edi
+  801d07:	89 de                	mov    %ebx,%esi
+  801d09:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801d0b:	5b                   	pop    %ebx
+  801d0c:	5e                   	pop    %esi
+  801d0d:	5f                   	pop    %edi
+  801d0e:	5d                   	pop    %ebp
+  801d0f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801d10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d1b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801d20:	89 df                	mov    %ebx,%edi
+  801d22:	55                   	push   %ebp
+  801d23:	89 e5                	mov    %esp,%ebp
+  801d25:	8d 35 2d 1d 80 00    	lea    0x801d2d,%esi
+  801d2b:	0f 34                	sysenter
+  801d2d:	5d                   	pop    %ebp
+		goto out;
+  801d2e:	eb db                	jmp    801d0b <sys_sb16_play+0x25>
+
+00801d30 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  801d30:	55                   	push   %ebp
+  801d31:	89 e5                	mov    %esp,%ebp
+  801d33:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  801d36:	83 3d bc 50 80 00 00 	cmpl   $0x0,0x8050bc
+  801d3d:	74 0a                	je     801d49 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  801d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d42:	a3 bc 50 80 00       	mov    %eax,0x8050bc
+}
+  801d47:	c9                   	leave
+  801d48:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  801d49:	83 ec 04             	sub    $0x4,%esp
+  801d4c:	6a 07                	push   $0x7
+  801d4e:	68 00 f0 bf ee       	push   $0xeebff000
+  801d53:	6a 00                	push   $0x0
+  801d55:	e8 60 f5 ff ff       	call   8012ba <sys_page_alloc>
+  801d5a:	83 c4 10             	add    $0x10,%esp
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	78 14                	js     801d75 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801d61:	83 ec 08             	sub    $0x8,%esp
+  801d64:	68 97 1d 80 00       	push   $0x801d97
+  801d69:	6a 00                	push   $0x0
+  801d6b:	e8 66 f7 ff ff       	call   8014d6 <sys_env_set_pgfault_upcall>
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	eb ca                	jmp    801d3f <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  801d75:	83 ec 08             	sub    $0x8,%esp
+  801d78:	50                   	push   %eax
+  801d79:	68 36 36 80 00       	push   $0x803636
+  801d7e:	e8 f7 e9 ff ff       	call   80077a <cprintf>
+			panic("set_pgfault_handler error");
+  801d83:	83 c4 0c             	add    $0xc,%esp
+  801d86:	68 41 36 80 00       	push   $0x803641
+  801d8b:	6a 24                	push   $0x24
+  801d8d:	68 5b 36 80 00       	push   $0x80365b
+  801d92:	e8 08 e9 ff ff       	call   80069f <_panic>
+
+00801d97 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801d97:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801d98:	a1 bc 50 80 00       	mov    0x8050bc,%eax
+	call *%eax
+  801d9d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801d9f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  801da2:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  801da6:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  801da9:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  801dad:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  801daf:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  801db3:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  801db4:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  801db8:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  801db9:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  801dba:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  801dbe:	c3                   	ret
+
+00801dbf <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc5:	05 00 00 00 30       	add    $0x30000000,%eax
+  801dca:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801dcd:	5d                   	pop    %ebp
+  801dce:	c3                   	ret
+
+00801dcf <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801dcf:	55                   	push   %ebp
+  801dd0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801dda:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ddf:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801de4:	5d                   	pop    %ebp
+  801de5:	c3                   	ret
+
+00801de6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801de6:	55                   	push   %ebp
+  801de7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801de9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801dee:	eb 02                	jmp    801df2 <fd_alloc+0xc>
+  801df0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801df2:	89 c2                	mov    %eax,%edx
+  801df4:	c1 ea 16             	shr    $0x16,%edx
+  801df7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801dfe:	f6 c2 01             	test   $0x1,%dl
+  801e01:	74 2b                	je     801e2e <fd_alloc+0x48>
+  801e03:	89 c2                	mov    %eax,%edx
+  801e05:	c1 ea 0c             	shr    $0xc,%edx
+  801e08:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801e0f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801e15:	f6 c1 01             	test   $0x1,%cl
+  801e18:	74 14                	je     801e2e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801e1a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801e20:	75 ce                	jne    801df0 <fd_alloc+0xa>
+  801e22:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801e27:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801e2c:	eb 05                	jmp    801e33 <fd_alloc+0x4d>
+			return 0;
+  801e2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801e33:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e36:	89 02                	mov    %eax,(%edx)
+}
+  801e38:	89 c8                	mov    %ecx,%eax
+  801e3a:	5d                   	pop    %ebp
+  801e3b:	c3                   	ret
+
+00801e3c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801e42:	83 f8 1f             	cmp    $0x1f,%eax
+  801e45:	77 30                	ja     801e77 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801e47:	c1 e0 0c             	shl    $0xc,%eax
+  801e4a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801e4f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e55:	f6 c2 01             	test   $0x1,%dl
+  801e58:	74 24                	je     801e7e <fd_lookup+0x42>
+  801e5a:	89 c2                	mov    %eax,%edx
+  801e5c:	c1 ea 0c             	shr    $0xc,%edx
+  801e5f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e66:	f6 c2 01             	test   $0x1,%dl
+  801e69:	74 1a                	je     801e85 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801e6b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e6e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801e70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e75:	5d                   	pop    %ebp
+  801e76:	c3                   	ret
+		return -E_INVAL;
+  801e77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e7c:	eb f7                	jmp    801e75 <fd_lookup+0x39>
+		return -E_INVAL;
+  801e7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e83:	eb f0                	jmp    801e75 <fd_lookup+0x39>
+  801e85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e8a:	eb e9                	jmp    801e75 <fd_lookup+0x39>
+
+00801e8c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801e8c:	55                   	push   %ebp
+  801e8d:	89 e5                	mov    %esp,%ebp
+  801e8f:	53                   	push   %ebx
+  801e90:	83 ec 04             	sub    $0x4,%esp
+  801e93:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9b:	eb 03                	jmp    801ea0 <dev_lookup+0x14>
+  801e9d:	83 c0 01             	add    $0x1,%eax
+  801ea0:	8b 1c 85 e8 36 80 00 	mov    0x8036e8(,%eax,4),%ebx
+  801ea7:	85 db                	test   %ebx,%ebx
+  801ea9:	74 0b                	je     801eb6 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801eab:	39 13                	cmp    %edx,(%ebx)
+  801ead:	75 ee                	jne    801e9d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb4:	eb 2e                	jmp    801ee4 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801eb6:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801eb8:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801ebd:	8b 0d b4 50 80 00    	mov    0x8050b4,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ec3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ec8:	76 24                	jbe    801eee <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801eca:	8b 41 48             	mov    0x48(%ecx),%eax
+  801ecd:	83 ec 04             	sub    $0x4,%esp
+  801ed0:	52                   	push   %edx
+  801ed1:	50                   	push   %eax
+  801ed2:	68 6c 36 80 00       	push   $0x80366c
+  801ed7:	e8 9e e8 ff ff       	call   80077a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801edc:	83 c4 10             	add    $0x10,%esp
+  801edf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801ee4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ee7:	89 1a                	mov    %ebx,(%edx)
+}
+  801ee9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eec:	c9                   	leave
+  801eed:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801eee:	c1 e8 10             	shr    $0x10,%eax
+  801ef1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ef7:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801efd:	eb cb                	jmp    801eca <dev_lookup+0x3e>
+
+00801eff <fd_close>:
+{
+  801eff:	55                   	push   %ebp
+  801f00:	89 e5                	mov    %esp,%ebp
+  801f02:	57                   	push   %edi
+  801f03:	56                   	push   %esi
+  801f04:	53                   	push   %ebx
+  801f05:	83 ec 24             	sub    $0x24,%esp
+  801f08:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f0b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801f0e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f11:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f12:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801f18:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801f1b:	50                   	push   %eax
+  801f1c:	e8 1b ff ff ff       	call   801e3c <fd_lookup>
+  801f21:	89 c3                	mov    %eax,%ebx
+  801f23:	83 c4 10             	add    $0x10,%esp
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	78 05                	js     801f2f <fd_close+0x30>
+	    || fd != fd2)
+  801f2a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801f2d:	74 16                	je     801f45 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801f2f:	89 f8                	mov    %edi,%eax
+  801f31:	84 c0                	test   %al,%al
+  801f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f38:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801f3b:	89 d8                	mov    %ebx,%eax
+  801f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f40:	5b                   	pop    %ebx
+  801f41:	5e                   	pop    %esi
+  801f42:	5f                   	pop    %edi
+  801f43:	5d                   	pop    %ebp
+  801f44:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f45:	83 ec 08             	sub    $0x8,%esp
+  801f48:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f4b:	50                   	push   %eax
+  801f4c:	ff 36                	push   (%esi)
+  801f4e:	e8 39 ff ff ff       	call   801e8c <dev_lookup>
+  801f53:	89 c3                	mov    %eax,%ebx
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	78 1a                	js     801f76 <fd_close+0x77>
+		if (dev->dev_close)
+  801f5c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f5f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	74 0b                	je     801f76 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801f6b:	83 ec 0c             	sub    $0xc,%esp
+  801f6e:	56                   	push   %esi
+  801f6f:	ff d0                	call   *%eax
+  801f71:	89 c3                	mov    %eax,%ebx
+  801f73:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801f76:	83 ec 08             	sub    $0x8,%esp
+  801f79:	56                   	push   %esi
+  801f7a:	6a 00                	push   $0x0
+  801f7c:	e8 14 f4 ff ff       	call   801395 <sys_page_unmap>
+	return r;
+  801f81:	83 c4 10             	add    $0x10,%esp
+  801f84:	eb b5                	jmp    801f3b <fd_close+0x3c>
+
+00801f86 <close>:
+
+int
+close(int fdnum)
+{
+  801f86:	55                   	push   %ebp
+  801f87:	89 e5                	mov    %esp,%ebp
+  801f89:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f8f:	50                   	push   %eax
+  801f90:	ff 75 08             	push   0x8(%ebp)
+  801f93:	e8 a4 fe ff ff       	call   801e3c <fd_lookup>
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	85 c0                	test   %eax,%eax
+  801f9d:	79 02                	jns    801fa1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801f9f:	c9                   	leave
+  801fa0:	c3                   	ret
+		return fd_close(fd, 1);
+  801fa1:	83 ec 08             	sub    $0x8,%esp
+  801fa4:	6a 01                	push   $0x1
+  801fa6:	ff 75 f4             	push   -0xc(%ebp)
+  801fa9:	e8 51 ff ff ff       	call   801eff <fd_close>
+  801fae:	83 c4 10             	add    $0x10,%esp
+  801fb1:	eb ec                	jmp    801f9f <close+0x19>
+
+00801fb3 <close_all>:
+
+void
+close_all(void)
+{
+  801fb3:	55                   	push   %ebp
+  801fb4:	89 e5                	mov    %esp,%ebp
+  801fb6:	53                   	push   %ebx
+  801fb7:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801fbf:	83 ec 0c             	sub    $0xc,%esp
+  801fc2:	53                   	push   %ebx
+  801fc3:	e8 be ff ff ff       	call   801f86 <close>
+	for (i = 0; i < MAXFD; i++)
+  801fc8:	83 c3 01             	add    $0x1,%ebx
+  801fcb:	83 c4 10             	add    $0x10,%esp
+  801fce:	83 fb 20             	cmp    $0x20,%ebx
+  801fd1:	75 ec                	jne    801fbf <close_all+0xc>
+}
+  801fd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	57                   	push   %edi
+  801fdc:	56                   	push   %esi
+  801fdd:	53                   	push   %ebx
+  801fde:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801fe1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fe4:	50                   	push   %eax
+  801fe5:	ff 75 08             	push   0x8(%ebp)
+  801fe8:	e8 4f fe ff ff       	call   801e3c <fd_lookup>
+  801fed:	89 c3                	mov    %eax,%ebx
+  801fef:	83 c4 10             	add    $0x10,%esp
+  801ff2:	85 c0                	test   %eax,%eax
+  801ff4:	78 7f                	js     802075 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ff6:	83 ec 0c             	sub    $0xc,%esp
+  801ff9:	ff 75 0c             	push   0xc(%ebp)
+  801ffc:	e8 85 ff ff ff       	call   801f86 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802001:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802004:	c1 e6 0c             	shl    $0xc,%esi
+  802007:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80200d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802010:	89 3c 24             	mov    %edi,(%esp)
+  802013:	e8 b7 fd ff ff       	call   801dcf <fd2data>
+  802018:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80201a:	89 34 24             	mov    %esi,(%esp)
+  80201d:	e8 ad fd ff ff       	call   801dcf <fd2data>
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802028:	89 d8                	mov    %ebx,%eax
+  80202a:	c1 e8 16             	shr    $0x16,%eax
+  80202d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802034:	a8 01                	test   $0x1,%al
+  802036:	74 11                	je     802049 <dup+0x71>
+  802038:	89 d8                	mov    %ebx,%eax
+  80203a:	c1 e8 0c             	shr    $0xc,%eax
+  80203d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802044:	f6 c2 01             	test   $0x1,%dl
+  802047:	75 36                	jne    80207f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802049:	89 f8                	mov    %edi,%eax
+  80204b:	c1 e8 0c             	shr    $0xc,%eax
+  80204e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802055:	83 ec 0c             	sub    $0xc,%esp
+  802058:	25 07 0e 00 00       	and    $0xe07,%eax
+  80205d:	50                   	push   %eax
+  80205e:	56                   	push   %esi
+  80205f:	6a 00                	push   $0x0
+  802061:	57                   	push   %edi
+  802062:	6a 00                	push   $0x0
+  802064:	e8 be f2 ff ff       	call   801327 <sys_page_map>
+  802069:	89 c3                	mov    %eax,%ebx
+  80206b:	83 c4 20             	add    $0x20,%esp
+  80206e:	85 c0                	test   %eax,%eax
+  802070:	78 33                	js     8020a5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802072:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802075:	89 d8                	mov    %ebx,%eax
+  802077:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80207a:	5b                   	pop    %ebx
+  80207b:	5e                   	pop    %esi
+  80207c:	5f                   	pop    %edi
+  80207d:	5d                   	pop    %ebp
+  80207e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80207f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802086:	83 ec 0c             	sub    $0xc,%esp
+  802089:	25 07 0e 00 00       	and    $0xe07,%eax
+  80208e:	50                   	push   %eax
+  80208f:	ff 75 d4             	push   -0x2c(%ebp)
+  802092:	6a 00                	push   $0x0
+  802094:	53                   	push   %ebx
+  802095:	6a 00                	push   $0x0
+  802097:	e8 8b f2 ff ff       	call   801327 <sys_page_map>
+  80209c:	89 c3                	mov    %eax,%ebx
+  80209e:	83 c4 20             	add    $0x20,%esp
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	79 a4                	jns    802049 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8020a5:	83 ec 08             	sub    $0x8,%esp
+  8020a8:	56                   	push   %esi
+  8020a9:	6a 00                	push   $0x0
+  8020ab:	e8 e5 f2 ff ff       	call   801395 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8020b0:	83 c4 08             	add    $0x8,%esp
+  8020b3:	ff 75 d4             	push   -0x2c(%ebp)
+  8020b6:	6a 00                	push   $0x0
+  8020b8:	e8 d8 f2 ff ff       	call   801395 <sys_page_unmap>
+	return r;
+  8020bd:	83 c4 10             	add    $0x10,%esp
+  8020c0:	eb b3                	jmp    802075 <dup+0x9d>
+
+008020c2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8020c2:	55                   	push   %ebp
+  8020c3:	89 e5                	mov    %esp,%ebp
+  8020c5:	56                   	push   %esi
+  8020c6:	53                   	push   %ebx
+  8020c7:	83 ec 18             	sub    $0x18,%esp
+  8020ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020d0:	50                   	push   %eax
+  8020d1:	53                   	push   %ebx
+  8020d2:	e8 65 fd ff ff       	call   801e3c <fd_lookup>
+  8020d7:	83 c4 10             	add    $0x10,%esp
+  8020da:	85 c0                	test   %eax,%eax
+  8020dc:	78 3c                	js     80211a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020de:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020e1:	83 ec 08             	sub    $0x8,%esp
+  8020e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e7:	50                   	push   %eax
+  8020e8:	ff 36                	push   (%esi)
+  8020ea:	e8 9d fd ff ff       	call   801e8c <dev_lookup>
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	78 24                	js     80211a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8020f6:	8b 46 08             	mov    0x8(%esi),%eax
+  8020f9:	83 e0 03             	and    $0x3,%eax
+  8020fc:	83 f8 01             	cmp    $0x1,%eax
+  8020ff:	74 20                	je     802121 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802101:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802104:	8b 40 08             	mov    0x8(%eax),%eax
+  802107:	85 c0                	test   %eax,%eax
+  802109:	74 57                	je     802162 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80210b:	83 ec 04             	sub    $0x4,%esp
+  80210e:	ff 75 10             	push   0x10(%ebp)
+  802111:	ff 75 0c             	push   0xc(%ebp)
+  802114:	56                   	push   %esi
+  802115:	ff d0                	call   *%eax
+  802117:	83 c4 10             	add    $0x10,%esp
+}
+  80211a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211d:	5b                   	pop    %ebx
+  80211e:	5e                   	pop    %esi
+  80211f:	5d                   	pop    %ebp
+  802120:	c3                   	ret
+  802121:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802123:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802128:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80212e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802133:	76 1c                	jbe    802151 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802135:	8b 42 48             	mov    0x48(%edx),%eax
+  802138:	83 ec 04             	sub    $0x4,%esp
+  80213b:	53                   	push   %ebx
+  80213c:	50                   	push   %eax
+  80213d:	68 ad 36 80 00       	push   $0x8036ad
+  802142:	e8 33 e6 ff ff       	call   80077a <cprintf>
+		return -E_INVAL;
+  802147:	83 c4 10             	add    $0x10,%esp
+  80214a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80214f:	eb c9                	jmp    80211a <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802151:	c1 e8 10             	shr    $0x10,%eax
+  802154:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80215a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802160:	eb d3                	jmp    802135 <read+0x73>
+		return -E_NOT_SUPP;
+  802162:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802167:	eb b1                	jmp    80211a <read+0x58>
+
+00802169 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	57                   	push   %edi
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+  80216f:	83 ec 0c             	sub    $0xc,%esp
+  802172:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802175:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80217d:	eb 02                	jmp    802181 <readn+0x18>
+  80217f:	01 c3                	add    %eax,%ebx
+  802181:	39 f3                	cmp    %esi,%ebx
+  802183:	73 21                	jae    8021a6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802185:	83 ec 04             	sub    $0x4,%esp
+  802188:	89 f0                	mov    %esi,%eax
+  80218a:	29 d8                	sub    %ebx,%eax
+  80218c:	50                   	push   %eax
+  80218d:	89 d8                	mov    %ebx,%eax
+  80218f:	03 45 0c             	add    0xc(%ebp),%eax
+  802192:	50                   	push   %eax
+  802193:	57                   	push   %edi
+  802194:	e8 29 ff ff ff       	call   8020c2 <read>
+		if (m < 0)
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	85 c0                	test   %eax,%eax
+  80219e:	78 04                	js     8021a4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8021a0:	75 dd                	jne    80217f <readn+0x16>
+  8021a2:	eb 02                	jmp    8021a6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8021a4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8021a6:	89 d8                	mov    %ebx,%eax
+  8021a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ab:	5b                   	pop    %ebx
+  8021ac:	5e                   	pop    %esi
+  8021ad:	5f                   	pop    %edi
+  8021ae:	5d                   	pop    %ebp
+  8021af:	c3                   	ret
+
+008021b0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	56                   	push   %esi
+  8021b4:	53                   	push   %ebx
+  8021b5:	83 ec 18             	sub    $0x18,%esp
+  8021b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021bb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021be:	50                   	push   %eax
+  8021bf:	53                   	push   %ebx
+  8021c0:	e8 77 fc ff ff       	call   801e3c <fd_lookup>
+  8021c5:	83 c4 10             	add    $0x10,%esp
+  8021c8:	85 c0                	test   %eax,%eax
+  8021ca:	78 37                	js     802203 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021cc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021cf:	83 ec 08             	sub    $0x8,%esp
+  8021d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d5:	50                   	push   %eax
+  8021d6:	ff 36                	push   (%esi)
+  8021d8:	e8 af fc ff ff       	call   801e8c <dev_lookup>
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	85 c0                	test   %eax,%eax
+  8021e2:	78 1f                	js     802203 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021e4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021e8:	74 20                	je     80220a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8021ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ed:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021f0:	85 c0                	test   %eax,%eax
+  8021f2:	74 57                	je     80224b <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8021f4:	83 ec 04             	sub    $0x4,%esp
+  8021f7:	ff 75 10             	push   0x10(%ebp)
+  8021fa:	ff 75 0c             	push   0xc(%ebp)
+  8021fd:	56                   	push   %esi
+  8021fe:	ff d0                	call   *%eax
+  802200:	83 c4 10             	add    $0x10,%esp
+}
+  802203:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802206:	5b                   	pop    %ebx
+  802207:	5e                   	pop    %esi
+  802208:	5d                   	pop    %ebp
+  802209:	c3                   	ret
+  80220a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80220c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802211:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802217:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80221c:	76 1c                	jbe    80223a <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80221e:	8b 42 48             	mov    0x48(%edx),%eax
+  802221:	83 ec 04             	sub    $0x4,%esp
+  802224:	53                   	push   %ebx
+  802225:	50                   	push   %eax
+  802226:	68 c9 36 80 00       	push   $0x8036c9
+  80222b:	e8 4a e5 ff ff       	call   80077a <cprintf>
+		return -E_INVAL;
+  802230:	83 c4 10             	add    $0x10,%esp
+  802233:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802238:	eb c9                	jmp    802203 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80223a:	c1 e8 10             	shr    $0x10,%eax
+  80223d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802243:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802249:	eb d3                	jmp    80221e <write+0x6e>
+		return -E_NOT_SUPP;
+  80224b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802250:	eb b1                	jmp    802203 <write+0x53>
+
+00802252 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802252:	55                   	push   %ebp
+  802253:	89 e5                	mov    %esp,%ebp
+  802255:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802258:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80225b:	50                   	push   %eax
+  80225c:	ff 75 08             	push   0x8(%ebp)
+  80225f:	e8 d8 fb ff ff       	call   801e3c <fd_lookup>
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	85 c0                	test   %eax,%eax
+  802269:	78 0e                	js     802279 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80226b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80226e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802271:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802274:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802279:	c9                   	leave
+  80227a:	c3                   	ret
+
+0080227b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	56                   	push   %esi
+  80227f:	53                   	push   %ebx
+  802280:	83 ec 18             	sub    $0x18,%esp
+  802283:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802286:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802289:	50                   	push   %eax
+  80228a:	53                   	push   %ebx
+  80228b:	e8 ac fb ff ff       	call   801e3c <fd_lookup>
+  802290:	83 c4 10             	add    $0x10,%esp
+  802293:	85 c0                	test   %eax,%eax
+  802295:	78 34                	js     8022cb <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802297:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80229a:	83 ec 08             	sub    $0x8,%esp
+  80229d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a0:	50                   	push   %eax
+  8022a1:	ff 36                	push   (%esi)
+  8022a3:	e8 e4 fb ff ff       	call   801e8c <dev_lookup>
+  8022a8:	83 c4 10             	add    $0x10,%esp
+  8022ab:	85 c0                	test   %eax,%eax
+  8022ad:	78 1c                	js     8022cb <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022af:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8022b3:	74 1d                	je     8022d2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8022b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022b8:	8b 40 18             	mov    0x18(%eax),%eax
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	74 54                	je     802313 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8022bf:	83 ec 08             	sub    $0x8,%esp
+  8022c2:	ff 75 0c             	push   0xc(%ebp)
+  8022c5:	56                   	push   %esi
+  8022c6:	ff d0                	call   *%eax
+  8022c8:	83 c4 10             	add    $0x10,%esp
+}
+  8022cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ce:	5b                   	pop    %ebx
+  8022cf:	5e                   	pop    %esi
+  8022d0:	5d                   	pop    %ebp
+  8022d1:	c3                   	ret
+  8022d2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022d4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022d9:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022df:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8022e4:	76 1c                	jbe    802302 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8022e6:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8022e9:	83 ec 04             	sub    $0x4,%esp
+  8022ec:	53                   	push   %ebx
+  8022ed:	50                   	push   %eax
+  8022ee:	68 8c 36 80 00       	push   $0x80368c
+  8022f3:	e8 82 e4 ff ff       	call   80077a <cprintf>
+		return -E_INVAL;
+  8022f8:	83 c4 10             	add    $0x10,%esp
+  8022fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802300:	eb c9                	jmp    8022cb <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802302:	c1 e8 10             	shr    $0x10,%eax
+  802305:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80230b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802311:	eb d3                	jmp    8022e6 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802313:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802318:	eb b1                	jmp    8022cb <ftruncate+0x50>
+
+0080231a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80231a:	55                   	push   %ebp
+  80231b:	89 e5                	mov    %esp,%ebp
+  80231d:	56                   	push   %esi
+  80231e:	53                   	push   %ebx
+  80231f:	83 ec 18             	sub    $0x18,%esp
+  802322:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802325:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802328:	50                   	push   %eax
+  802329:	ff 75 08             	push   0x8(%ebp)
+  80232c:	e8 0b fb ff ff       	call   801e3c <fd_lookup>
+  802331:	83 c4 10             	add    $0x10,%esp
+  802334:	85 c0                	test   %eax,%eax
+  802336:	78 49                	js     802381 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802338:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80233b:	83 ec 08             	sub    $0x8,%esp
+  80233e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802341:	50                   	push   %eax
+  802342:	ff 36                	push   (%esi)
+  802344:	e8 43 fb ff ff       	call   801e8c <dev_lookup>
+  802349:	83 c4 10             	add    $0x10,%esp
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	78 31                	js     802381 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802350:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802353:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802357:	74 2f                	je     802388 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802359:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80235c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802363:	00 00 00 
+	stat->st_isdir = 0;
+  802366:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80236d:	00 00 00 
+	stat->st_dev = dev;
+  802370:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802376:	83 ec 08             	sub    $0x8,%esp
+  802379:	53                   	push   %ebx
+  80237a:	56                   	push   %esi
+  80237b:	ff 50 14             	call   *0x14(%eax)
+  80237e:	83 c4 10             	add    $0x10,%esp
+}
+  802381:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802384:	5b                   	pop    %ebx
+  802385:	5e                   	pop    %esi
+  802386:	5d                   	pop    %ebp
+  802387:	c3                   	ret
+		return -E_NOT_SUPP;
+  802388:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80238d:	eb f2                	jmp    802381 <fstat+0x67>
+
+0080238f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	56                   	push   %esi
+  802393:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802394:	83 ec 08             	sub    $0x8,%esp
+  802397:	6a 00                	push   $0x0
+  802399:	ff 75 08             	push   0x8(%ebp)
+  80239c:	e8 e4 01 00 00       	call   802585 <open>
+  8023a1:	89 c3                	mov    %eax,%ebx
+  8023a3:	83 c4 10             	add    $0x10,%esp
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	78 1b                	js     8023c5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8023aa:	83 ec 08             	sub    $0x8,%esp
+  8023ad:	ff 75 0c             	push   0xc(%ebp)
+  8023b0:	50                   	push   %eax
+  8023b1:	e8 64 ff ff ff       	call   80231a <fstat>
+  8023b6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8023b8:	89 1c 24             	mov    %ebx,(%esp)
+  8023bb:	e8 c6 fb ff ff       	call   801f86 <close>
+	return r;
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	89 f3                	mov    %esi,%ebx
+}
+  8023c5:	89 d8                	mov    %ebx,%eax
+  8023c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+
+008023ce <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8023ce:	55                   	push   %ebp
+  8023cf:	89 e5                	mov    %esp,%ebp
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	89 c6                	mov    %eax,%esi
+  8023d5:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8023d7:	83 3d ac 50 80 00 00 	cmpl   $0x0,0x8050ac
+  8023de:	74 27                	je     802407 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8023e0:	6a 07                	push   $0x7
+  8023e2:	68 00 60 80 00       	push   $0x806000
+  8023e7:	56                   	push   %esi
+  8023e8:	ff 35 ac 50 80 00    	push   0x8050ac
+  8023ee:	e8 b2 0c 00 00       	call   8030a5 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8023f3:	83 c4 0c             	add    $0xc,%esp
+  8023f6:	6a 00                	push   $0x0
+  8023f8:	53                   	push   %ebx
+  8023f9:	6a 00                	push   $0x0
+  8023fb:	e8 8d 0c 00 00       	call   80308d <ipc_recv>
+}
+  802400:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802403:	5b                   	pop    %ebx
+  802404:	5e                   	pop    %esi
+  802405:	5d                   	pop    %ebp
+  802406:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802407:	83 ec 0c             	sub    $0xc,%esp
+  80240a:	6a 01                	push   $0x1
+  80240c:	e8 e8 0c 00 00       	call   8030f9 <ipc_find_env>
+  802411:	a3 ac 50 80 00       	mov    %eax,0x8050ac
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	eb c5                	jmp    8023e0 <fsipc+0x12>
+
+0080241b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80241b:	55                   	push   %ebp
+  80241c:	89 e5                	mov    %esp,%ebp
+  80241e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802421:	8b 45 08             	mov    0x8(%ebp),%eax
+  802424:	8b 40 0c             	mov    0xc(%eax),%eax
+  802427:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80242c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80242f:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802434:	ba 00 00 00 00       	mov    $0x0,%edx
+  802439:	b8 02 00 00 00       	mov    $0x2,%eax
+  80243e:	e8 8b ff ff ff       	call   8023ce <fsipc>
+}
+  802443:	c9                   	leave
+  802444:	c3                   	ret
+
+00802445 <devfile_flush>:
+{
+  802445:	55                   	push   %ebp
+  802446:	89 e5                	mov    %esp,%ebp
+  802448:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80244b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80244e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802451:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802456:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802460:	e8 69 ff ff ff       	call   8023ce <fsipc>
+}
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+
+00802467 <devfile_stat>:
+{
+  802467:	55                   	push   %ebp
+  802468:	89 e5                	mov    %esp,%ebp
+  80246a:	53                   	push   %ebx
+  80246b:	83 ec 04             	sub    $0x4,%esp
+  80246e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802471:	8b 45 08             	mov    0x8(%ebp),%eax
+  802474:	8b 40 0c             	mov    0xc(%eax),%eax
+  802477:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80247c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802481:	b8 05 00 00 00       	mov    $0x5,%eax
+  802486:	e8 43 ff ff ff       	call   8023ce <fsipc>
+  80248b:	85 c0                	test   %eax,%eax
+  80248d:	78 2c                	js     8024bb <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80248f:	83 ec 08             	sub    $0x8,%esp
+  802492:	68 00 60 80 00       	push   $0x806000
+  802497:	53                   	push   %ebx
+  802498:	e8 25 e9 ff ff       	call   800dc2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80249d:	a1 80 60 80 00       	mov    0x806080,%eax
+  8024a2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8024a8:	a1 84 60 80 00       	mov    0x806084,%eax
+  8024ad:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8024b3:	83 c4 10             	add    $0x10,%esp
+  8024b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024be:	c9                   	leave
+  8024bf:	c3                   	ret
+
+008024c0 <devfile_write>:
+{
+  8024c0:	55                   	push   %ebp
+  8024c1:	89 e5                	mov    %esp,%ebp
+  8024c3:	83 ec 0c             	sub    $0xc,%esp
+  8024c6:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024cc:	8b 52 0c             	mov    0xc(%edx),%edx
+  8024cf:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8024d5:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8024da:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8024df:	39 d0                	cmp    %edx,%eax
+  8024e1:	0f 47 c2             	cmova  %edx,%eax
+  8024e4:	50                   	push   %eax
+  8024e5:	ff 75 0c             	push   0xc(%ebp)
+  8024e8:	68 08 60 80 00       	push   $0x806008
+  8024ed:	e8 56 ea ff ff       	call   800f48 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8024f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024fc:	e8 cd fe ff ff       	call   8023ce <fsipc>
+}
+  802501:	c9                   	leave
+  802502:	c3                   	ret
+
+00802503 <devfile_read>:
+{
+  802503:	55                   	push   %ebp
+  802504:	89 e5                	mov    %esp,%ebp
+  802506:	56                   	push   %esi
+  802507:	53                   	push   %ebx
+  802508:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80250b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802511:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802516:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80251c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802521:	b8 03 00 00 00       	mov    $0x3,%eax
+  802526:	e8 a3 fe ff ff       	call   8023ce <fsipc>
+  80252b:	89 c3                	mov    %eax,%ebx
+  80252d:	85 c0                	test   %eax,%eax
+  80252f:	78 1f                	js     802550 <devfile_read+0x4d>
+	assert(r <= n);
+  802531:	39 c6                	cmp    %eax,%esi
+  802533:	72 24                	jb     802559 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802535:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80253a:	7f 33                	jg     80256f <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80253c:	83 ec 04             	sub    $0x4,%esp
+  80253f:	50                   	push   %eax
+  802540:	68 00 60 80 00       	push   $0x806000
+  802545:	ff 75 0c             	push   0xc(%ebp)
+  802548:	e8 fb e9 ff ff       	call   800f48 <memmove>
+	return r;
+  80254d:	83 c4 10             	add    $0x10,%esp
+}
+  802550:	89 d8                	mov    %ebx,%eax
+  802552:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802555:	5b                   	pop    %ebx
+  802556:	5e                   	pop    %esi
+  802557:	5d                   	pop    %ebp
+  802558:	c3                   	ret
+	assert(r <= n);
+  802559:	68 fc 36 80 00       	push   $0x8036fc
+  80255e:	68 03 37 80 00       	push   $0x803703
+  802563:	6a 76                	push   $0x76
+  802565:	68 18 37 80 00       	push   $0x803718
+  80256a:	e8 30 e1 ff ff       	call   80069f <_panic>
+	assert(r <= PGSIZE);
+  80256f:	68 23 37 80 00       	push   $0x803723
+  802574:	68 03 37 80 00       	push   $0x803703
+  802579:	6a 77                	push   $0x77
+  80257b:	68 18 37 80 00       	push   $0x803718
+  802580:	e8 1a e1 ff ff       	call   80069f <_panic>
+
+00802585 <open>:
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	56                   	push   %esi
+  802589:	53                   	push   %ebx
+  80258a:	83 ec 1c             	sub    $0x1c,%esp
+  80258d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802590:	56                   	push   %esi
+  802591:	e8 f1 e7 ff ff       	call   800d87 <strlen>
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80259e:	7f 6c                	jg     80260c <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8025a0:	83 ec 0c             	sub    $0xc,%esp
+  8025a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025a6:	50                   	push   %eax
+  8025a7:	e8 3a f8 ff ff       	call   801de6 <fd_alloc>
+  8025ac:	89 c3                	mov    %eax,%ebx
+  8025ae:	83 c4 10             	add    $0x10,%esp
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	78 3c                	js     8025f1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8025b5:	83 ec 08             	sub    $0x8,%esp
+  8025b8:	56                   	push   %esi
+  8025b9:	68 00 60 80 00       	push   $0x806000
+  8025be:	e8 ff e7 ff ff       	call   800dc2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8025c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025c6:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8025cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025d3:	e8 f6 fd ff ff       	call   8023ce <fsipc>
+  8025d8:	89 c3                	mov    %eax,%ebx
+  8025da:	83 c4 10             	add    $0x10,%esp
+  8025dd:	85 c0                	test   %eax,%eax
+  8025df:	78 19                	js     8025fa <open+0x75>
+	return fd2num(fd);
+  8025e1:	83 ec 0c             	sub    $0xc,%esp
+  8025e4:	ff 75 f4             	push   -0xc(%ebp)
+  8025e7:	e8 d3 f7 ff ff       	call   801dbf <fd2num>
+  8025ec:	89 c3                	mov    %eax,%ebx
+  8025ee:	83 c4 10             	add    $0x10,%esp
+}
+  8025f1:	89 d8                	mov    %ebx,%eax
+  8025f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025f6:	5b                   	pop    %ebx
+  8025f7:	5e                   	pop    %esi
+  8025f8:	5d                   	pop    %ebp
+  8025f9:	c3                   	ret
+		fd_close(fd, 0);
+  8025fa:	83 ec 08             	sub    $0x8,%esp
+  8025fd:	6a 00                	push   $0x0
+  8025ff:	ff 75 f4             	push   -0xc(%ebp)
+  802602:	e8 f8 f8 ff ff       	call   801eff <fd_close>
+		return r;
+  802607:	83 c4 10             	add    $0x10,%esp
+  80260a:	eb e5                	jmp    8025f1 <open+0x6c>
+		return -E_BAD_PATH;
+  80260c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802611:	eb de                	jmp    8025f1 <open+0x6c>
+
+00802613 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802613:	55                   	push   %ebp
+  802614:	89 e5                	mov    %esp,%ebp
+  802616:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802619:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802623:	e8 a6 fd ff ff       	call   8023ce <fsipc>
+}
+  802628:	c9                   	leave
+  802629:	c3                   	ret
+
+0080262a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80262a:	55                   	push   %ebp
+  80262b:	89 e5                	mov    %esp,%ebp
+  80262d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802630:	68 2f 37 80 00       	push   $0x80372f
+  802635:	ff 75 0c             	push   0xc(%ebp)
+  802638:	e8 85 e7 ff ff       	call   800dc2 <strcpy>
+	return 0;
+}
+  80263d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+
+00802644 <devsock_close>:
+{
+  802644:	55                   	push   %ebp
+  802645:	89 e5                	mov    %esp,%ebp
+  802647:	53                   	push   %ebx
+  802648:	83 ec 10             	sub    $0x10,%esp
+  80264b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80264e:	53                   	push   %ebx
+  80264f:	e8 e4 0a 00 00       	call   803138 <pageref>
+  802654:	89 c2                	mov    %eax,%edx
+  802656:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802659:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80265e:	83 fa 01             	cmp    $0x1,%edx
+  802661:	74 05                	je     802668 <devsock_close+0x24>
+}
+  802663:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802666:	c9                   	leave
+  802667:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802668:	83 ec 0c             	sub    $0xc,%esp
+  80266b:	ff 73 0c             	push   0xc(%ebx)
+  80266e:	e8 b7 02 00 00       	call   80292a <nsipc_close>
+  802673:	83 c4 10             	add    $0x10,%esp
+  802676:	eb eb                	jmp    802663 <devsock_close+0x1f>
+
+00802678 <devsock_write>:
+{
+  802678:	55                   	push   %ebp
+  802679:	89 e5                	mov    %esp,%ebp
+  80267b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80267e:	6a 00                	push   $0x0
+  802680:	ff 75 10             	push   0x10(%ebp)
+  802683:	ff 75 0c             	push   0xc(%ebp)
+  802686:	8b 45 08             	mov    0x8(%ebp),%eax
+  802689:	ff 70 0c             	push   0xc(%eax)
+  80268c:	e8 79 03 00 00       	call   802a0a <nsipc_send>
+}
+  802691:	c9                   	leave
+  802692:	c3                   	ret
+
+00802693 <devsock_read>:
+{
+  802693:	55                   	push   %ebp
+  802694:	89 e5                	mov    %esp,%ebp
+  802696:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802699:	6a 00                	push   $0x0
+  80269b:	ff 75 10             	push   0x10(%ebp)
+  80269e:	ff 75 0c             	push   0xc(%ebp)
+  8026a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a4:	ff 70 0c             	push   0xc(%eax)
+  8026a7:	e8 ef 02 00 00       	call   80299b <nsipc_recv>
+}
+  8026ac:	c9                   	leave
+  8026ad:	c3                   	ret
+
+008026ae <fd2sockid>:
+{
+  8026ae:	55                   	push   %ebp
+  8026af:	89 e5                	mov    %esp,%ebp
+  8026b1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8026b4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026b7:	52                   	push   %edx
+  8026b8:	50                   	push   %eax
+  8026b9:	e8 7e f7 ff ff       	call   801e3c <fd_lookup>
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	78 10                	js     8026d5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8026c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026c8:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8026ce:	39 08                	cmp    %ecx,(%eax)
+  8026d0:	75 05                	jne    8026d7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8026d2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8026d5:	c9                   	leave
+  8026d6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026d7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026dc:	eb f7                	jmp    8026d5 <fd2sockid+0x27>
+
+008026de <alloc_sockfd>:
+{
+  8026de:	55                   	push   %ebp
+  8026df:	89 e5                	mov    %esp,%ebp
+  8026e1:	56                   	push   %esi
+  8026e2:	53                   	push   %ebx
+  8026e3:	83 ec 1c             	sub    $0x1c,%esp
+  8026e6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8026e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026eb:	50                   	push   %eax
+  8026ec:	e8 f5 f6 ff ff       	call   801de6 <fd_alloc>
+  8026f1:	89 c3                	mov    %eax,%ebx
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	85 c0                	test   %eax,%eax
+  8026f8:	78 43                	js     80273d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026fa:	83 ec 04             	sub    $0x4,%esp
+  8026fd:	68 07 04 00 00       	push   $0x407
+  802702:	ff 75 f4             	push   -0xc(%ebp)
+  802705:	6a 00                	push   $0x0
+  802707:	e8 ae eb ff ff       	call   8012ba <sys_page_alloc>
+  80270c:	89 c3                	mov    %eax,%ebx
+  80270e:	83 c4 10             	add    $0x10,%esp
+  802711:	85 c0                	test   %eax,%eax
+  802713:	78 28                	js     80273d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802715:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802718:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80271e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802720:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802723:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80272a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80272d:	83 ec 0c             	sub    $0xc,%esp
+  802730:	50                   	push   %eax
+  802731:	e8 89 f6 ff ff       	call   801dbf <fd2num>
+  802736:	89 c3                	mov    %eax,%ebx
+  802738:	83 c4 10             	add    $0x10,%esp
+  80273b:	eb 0c                	jmp    802749 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80273d:	83 ec 0c             	sub    $0xc,%esp
+  802740:	56                   	push   %esi
+  802741:	e8 e4 01 00 00       	call   80292a <nsipc_close>
+		return r;
+  802746:	83 c4 10             	add    $0x10,%esp
+}
+  802749:	89 d8                	mov    %ebx,%eax
+  80274b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80274e:	5b                   	pop    %ebx
+  80274f:	5e                   	pop    %esi
+  802750:	5d                   	pop    %ebp
+  802751:	c3                   	ret
+
+00802752 <accept>:
+{
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802758:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275b:	e8 4e ff ff ff       	call   8026ae <fd2sockid>
+  802760:	85 c0                	test   %eax,%eax
+  802762:	78 1b                	js     80277f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802764:	83 ec 04             	sub    $0x4,%esp
+  802767:	ff 75 10             	push   0x10(%ebp)
+  80276a:	ff 75 0c             	push   0xc(%ebp)
+  80276d:	50                   	push   %eax
+  80276e:	e8 0e 01 00 00       	call   802881 <nsipc_accept>
+  802773:	83 c4 10             	add    $0x10,%esp
+  802776:	85 c0                	test   %eax,%eax
+  802778:	78 05                	js     80277f <accept+0x2d>
+	return alloc_sockfd(r);
+  80277a:	e8 5f ff ff ff       	call   8026de <alloc_sockfd>
+}
+  80277f:	c9                   	leave
+  802780:	c3                   	ret
+
+00802781 <bind>:
+{
+  802781:	55                   	push   %ebp
+  802782:	89 e5                	mov    %esp,%ebp
+  802784:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802787:	8b 45 08             	mov    0x8(%ebp),%eax
+  80278a:	e8 1f ff ff ff       	call   8026ae <fd2sockid>
+  80278f:	85 c0                	test   %eax,%eax
+  802791:	78 12                	js     8027a5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802793:	83 ec 04             	sub    $0x4,%esp
+  802796:	ff 75 10             	push   0x10(%ebp)
+  802799:	ff 75 0c             	push   0xc(%ebp)
+  80279c:	50                   	push   %eax
+  80279d:	e8 31 01 00 00       	call   8028d3 <nsipc_bind>
+  8027a2:	83 c4 10             	add    $0x10,%esp
+}
+  8027a5:	c9                   	leave
+  8027a6:	c3                   	ret
+
+008027a7 <shutdown>:
+{
+  8027a7:	55                   	push   %ebp
+  8027a8:	89 e5                	mov    %esp,%ebp
+  8027aa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b0:	e8 f9 fe ff ff       	call   8026ae <fd2sockid>
+  8027b5:	85 c0                	test   %eax,%eax
+  8027b7:	78 0f                	js     8027c8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8027b9:	83 ec 08             	sub    $0x8,%esp
+  8027bc:	ff 75 0c             	push   0xc(%ebp)
+  8027bf:	50                   	push   %eax
+  8027c0:	e8 43 01 00 00       	call   802908 <nsipc_shutdown>
+  8027c5:	83 c4 10             	add    $0x10,%esp
+}
+  8027c8:	c9                   	leave
+  8027c9:	c3                   	ret
+
+008027ca <connect>:
+{
+  8027ca:	55                   	push   %ebp
+  8027cb:	89 e5                	mov    %esp,%ebp
+  8027cd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d3:	e8 d6 fe ff ff       	call   8026ae <fd2sockid>
+  8027d8:	85 c0                	test   %eax,%eax
+  8027da:	78 12                	js     8027ee <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8027dc:	83 ec 04             	sub    $0x4,%esp
+  8027df:	ff 75 10             	push   0x10(%ebp)
+  8027e2:	ff 75 0c             	push   0xc(%ebp)
+  8027e5:	50                   	push   %eax
+  8027e6:	e8 59 01 00 00       	call   802944 <nsipc_connect>
+  8027eb:	83 c4 10             	add    $0x10,%esp
+}
+  8027ee:	c9                   	leave
+  8027ef:	c3                   	ret
+
+008027f0 <listen>:
+{
+  8027f0:	55                   	push   %ebp
+  8027f1:	89 e5                	mov    %esp,%ebp
+  8027f3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f9:	e8 b0 fe ff ff       	call   8026ae <fd2sockid>
+  8027fe:	85 c0                	test   %eax,%eax
+  802800:	78 0f                	js     802811 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802802:	83 ec 08             	sub    $0x8,%esp
+  802805:	ff 75 0c             	push   0xc(%ebp)
+  802808:	50                   	push   %eax
+  802809:	e8 6b 01 00 00       	call   802979 <nsipc_listen>
+  80280e:	83 c4 10             	add    $0x10,%esp
+}
+  802811:	c9                   	leave
+  802812:	c3                   	ret
+
+00802813 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802813:	55                   	push   %ebp
+  802814:	89 e5                	mov    %esp,%ebp
+  802816:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802819:	ff 75 10             	push   0x10(%ebp)
+  80281c:	ff 75 0c             	push   0xc(%ebp)
+  80281f:	ff 75 08             	push   0x8(%ebp)
+  802822:	e8 41 02 00 00       	call   802a68 <nsipc_socket>
+  802827:	83 c4 10             	add    $0x10,%esp
+  80282a:	85 c0                	test   %eax,%eax
+  80282c:	78 05                	js     802833 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80282e:	e8 ab fe ff ff       	call   8026de <alloc_sockfd>
+}
+  802833:	c9                   	leave
+  802834:	c3                   	ret
+
+00802835 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802835:	55                   	push   %ebp
+  802836:	89 e5                	mov    %esp,%ebp
+  802838:	53                   	push   %ebx
+  802839:	83 ec 04             	sub    $0x4,%esp
+  80283c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80283e:	83 3d b0 50 80 00 00 	cmpl   $0x0,0x8050b0
+  802845:	74 26                	je     80286d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802847:	6a 07                	push   $0x7
+  802849:	68 00 70 80 00       	push   $0x807000
+  80284e:	53                   	push   %ebx
+  80284f:	ff 35 b0 50 80 00    	push   0x8050b0
+  802855:	e8 4b 08 00 00       	call   8030a5 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80285a:	83 c4 0c             	add    $0xc,%esp
+  80285d:	6a 00                	push   $0x0
+  80285f:	6a 00                	push   $0x0
+  802861:	6a 00                	push   $0x0
+  802863:	e8 25 08 00 00       	call   80308d <ipc_recv>
+}
+  802868:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80286b:	c9                   	leave
+  80286c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80286d:	83 ec 0c             	sub    $0xc,%esp
+  802870:	6a 02                	push   $0x2
+  802872:	e8 82 08 00 00       	call   8030f9 <ipc_find_env>
+  802877:	a3 b0 50 80 00       	mov    %eax,0x8050b0
+  80287c:	83 c4 10             	add    $0x10,%esp
+  80287f:	eb c6                	jmp    802847 <nsipc+0x12>
+
+00802881 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802881:	55                   	push   %ebp
+  802882:	89 e5                	mov    %esp,%ebp
+  802884:	56                   	push   %esi
+  802885:	53                   	push   %ebx
+  802886:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802889:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802891:	8b 06                	mov    (%esi),%eax
+  802893:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802898:	b8 01 00 00 00       	mov    $0x1,%eax
+  80289d:	e8 93 ff ff ff       	call   802835 <nsipc>
+  8028a2:	89 c3                	mov    %eax,%ebx
+  8028a4:	85 c0                	test   %eax,%eax
+  8028a6:	79 09                	jns    8028b1 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8028a8:	89 d8                	mov    %ebx,%eax
+  8028aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ad:	5b                   	pop    %ebx
+  8028ae:	5e                   	pop    %esi
+  8028af:	5d                   	pop    %ebp
+  8028b0:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8028b1:	83 ec 04             	sub    $0x4,%esp
+  8028b4:	ff 35 10 70 80 00    	push   0x807010
+  8028ba:	68 00 70 80 00       	push   $0x807000
+  8028bf:	ff 75 0c             	push   0xc(%ebp)
+  8028c2:	e8 81 e6 ff ff       	call   800f48 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8028c7:	a1 10 70 80 00       	mov    0x807010,%eax
+  8028cc:	89 06                	mov    %eax,(%esi)
+  8028ce:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8028d1:	eb d5                	jmp    8028a8 <nsipc_accept+0x27>
+
+008028d3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8028d3:	55                   	push   %ebp
+  8028d4:	89 e5                	mov    %esp,%ebp
+  8028d6:	53                   	push   %ebx
+  8028d7:	83 ec 08             	sub    $0x8,%esp
+  8028da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8028dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e0:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8028e5:	53                   	push   %ebx
+  8028e6:	ff 75 0c             	push   0xc(%ebp)
+  8028e9:	68 04 70 80 00       	push   $0x807004
+  8028ee:	e8 55 e6 ff ff       	call   800f48 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8028f3:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8028f9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028fe:	e8 32 ff ff ff       	call   802835 <nsipc>
+}
+  802903:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802906:	c9                   	leave
+  802907:	c3                   	ret
+
+00802908 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802908:	55                   	push   %ebp
+  802909:	89 e5                	mov    %esp,%ebp
+  80290b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80290e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802911:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802916:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802919:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80291e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802923:	e8 0d ff ff ff       	call   802835 <nsipc>
+}
+  802928:	c9                   	leave
+  802929:	c3                   	ret
+
+0080292a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80292a:	55                   	push   %ebp
+  80292b:	89 e5                	mov    %esp,%ebp
+  80292d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802930:	8b 45 08             	mov    0x8(%ebp),%eax
+  802933:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802938:	b8 04 00 00 00       	mov    $0x4,%eax
+  80293d:	e8 f3 fe ff ff       	call   802835 <nsipc>
+}
+  802942:	c9                   	leave
+  802943:	c3                   	ret
+
+00802944 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802944:	55                   	push   %ebp
+  802945:	89 e5                	mov    %esp,%ebp
+  802947:	53                   	push   %ebx
+  802948:	83 ec 08             	sub    $0x8,%esp
+  80294b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80294e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802951:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802956:	53                   	push   %ebx
+  802957:	ff 75 0c             	push   0xc(%ebp)
+  80295a:	68 04 70 80 00       	push   $0x807004
+  80295f:	e8 e4 e5 ff ff       	call   800f48 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802964:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80296a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80296f:	e8 c1 fe ff ff       	call   802835 <nsipc>
+}
+  802974:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802977:	c9                   	leave
+  802978:	c3                   	ret
+
+00802979 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802979:	55                   	push   %ebp
+  80297a:	89 e5                	mov    %esp,%ebp
+  80297c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80297f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802982:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802987:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80298a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80298f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802994:	e8 9c fe ff ff       	call   802835 <nsipc>
+}
+  802999:	c9                   	leave
+  80299a:	c3                   	ret
+
+0080299b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80299b:	55                   	push   %ebp
+  80299c:	89 e5                	mov    %esp,%ebp
+  80299e:	56                   	push   %esi
+  80299f:	53                   	push   %ebx
+  8029a0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8029a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8029ab:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8029b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029b4:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8029b9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029be:	e8 72 fe ff ff       	call   802835 <nsipc>
+  8029c3:	89 c3                	mov    %eax,%ebx
+  8029c5:	85 c0                	test   %eax,%eax
+  8029c7:	78 22                	js     8029eb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8029c9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8029ce:	39 c6                	cmp    %eax,%esi
+  8029d0:	0f 4e c6             	cmovle %esi,%eax
+  8029d3:	39 c3                	cmp    %eax,%ebx
+  8029d5:	7f 1d                	jg     8029f4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8029d7:	83 ec 04             	sub    $0x4,%esp
+  8029da:	53                   	push   %ebx
+  8029db:	68 00 70 80 00       	push   $0x807000
+  8029e0:	ff 75 0c             	push   0xc(%ebp)
+  8029e3:	e8 60 e5 ff ff       	call   800f48 <memmove>
+  8029e8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8029eb:	89 d8                	mov    %ebx,%eax
+  8029ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029f0:	5b                   	pop    %ebx
+  8029f1:	5e                   	pop    %esi
+  8029f2:	5d                   	pop    %ebp
+  8029f3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8029f4:	68 3b 37 80 00       	push   $0x80373b
+  8029f9:	68 03 37 80 00       	push   $0x803703
+  8029fe:	6a 62                	push   $0x62
+  802a00:	68 50 37 80 00       	push   $0x803750
+  802a05:	e8 95 dc ff ff       	call   80069f <_panic>
+
+00802a0a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a0a:	55                   	push   %ebp
+  802a0b:	89 e5                	mov    %esp,%ebp
+  802a0d:	53                   	push   %ebx
+  802a0e:	83 ec 04             	sub    $0x4,%esp
+  802a11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a17:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802a1c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a22:	7f 2e                	jg     802a52 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a24:	83 ec 04             	sub    $0x4,%esp
+  802a27:	53                   	push   %ebx
+  802a28:	ff 75 0c             	push   0xc(%ebp)
+  802a2b:	68 0c 70 80 00       	push   $0x80700c
+  802a30:	e8 13 e5 ff ff       	call   800f48 <memmove>
+	nsipcbuf.send.req_size = size;
+  802a35:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802a3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a3e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802a43:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a48:	e8 e8 fd ff ff       	call   802835 <nsipc>
+}
+  802a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a50:	c9                   	leave
+  802a51:	c3                   	ret
+	assert(size < 1600);
+  802a52:	68 5c 37 80 00       	push   $0x80375c
+  802a57:	68 03 37 80 00       	push   $0x803703
+  802a5c:	6a 6d                	push   $0x6d
+  802a5e:	68 50 37 80 00       	push   $0x803750
+  802a63:	e8 37 dc ff ff       	call   80069f <_panic>
+
+00802a68 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a68:	55                   	push   %ebp
+  802a69:	89 e5                	mov    %esp,%ebp
+  802a6b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a71:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802a76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a79:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a7e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a81:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802a86:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a8b:	e8 a5 fd ff ff       	call   802835 <nsipc>
+}
+  802a90:	c9                   	leave
+  802a91:	c3                   	ret
+
+00802a92 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	56                   	push   %esi
+  802a96:	53                   	push   %ebx
+  802a97:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802a9a:	83 ec 0c             	sub    $0xc,%esp
+  802a9d:	ff 75 08             	push   0x8(%ebp)
+  802aa0:	e8 2a f3 ff ff       	call   801dcf <fd2data>
+  802aa5:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802aa7:	83 c4 08             	add    $0x8,%esp
+  802aaa:	68 68 37 80 00       	push   $0x803768
+  802aaf:	53                   	push   %ebx
+  802ab0:	e8 0d e3 ff ff       	call   800dc2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ab5:	8b 46 04             	mov    0x4(%esi),%eax
+  802ab8:	2b 06                	sub    (%esi),%eax
+  802aba:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ac0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ac7:	00 00 00 
+	stat->st_dev = &devpipe;
+  802aca:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802ad1:	40 80 00 
+	return 0;
+}
+  802ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802adc:	5b                   	pop    %ebx
+  802add:	5e                   	pop    %esi
+  802ade:	5d                   	pop    %ebp
+  802adf:	c3                   	ret
+
+00802ae0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ae0:	55                   	push   %ebp
+  802ae1:	89 e5                	mov    %esp,%ebp
+  802ae3:	53                   	push   %ebx
+  802ae4:	83 ec 0c             	sub    $0xc,%esp
+  802ae7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802aea:	53                   	push   %ebx
+  802aeb:	6a 00                	push   $0x0
+  802aed:	e8 a3 e8 ff ff       	call   801395 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802af2:	89 1c 24             	mov    %ebx,(%esp)
+  802af5:	e8 d5 f2 ff ff       	call   801dcf <fd2data>
+  802afa:	83 c4 08             	add    $0x8,%esp
+  802afd:	50                   	push   %eax
+  802afe:	6a 00                	push   $0x0
+  802b00:	e8 90 e8 ff ff       	call   801395 <sys_page_unmap>
+}
+  802b05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b08:	c9                   	leave
+  802b09:	c3                   	ret
+
+00802b0a <_pipeisclosed>:
+{
+  802b0a:	55                   	push   %ebp
+  802b0b:	89 e5                	mov    %esp,%ebp
+  802b0d:	57                   	push   %edi
+  802b0e:	56                   	push   %esi
+  802b0f:	53                   	push   %ebx
+  802b10:	83 ec 1c             	sub    $0x1c,%esp
+  802b13:	89 c7                	mov    %eax,%edi
+  802b15:	89 d6                	mov    %edx,%esi
+  802b17:	eb 3c                	jmp    802b55 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802b19:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802b1c:	83 ec 0c             	sub    $0xc,%esp
+  802b1f:	57                   	push   %edi
+  802b20:	e8 13 06 00 00       	call   803138 <pageref>
+  802b25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b28:	89 34 24             	mov    %esi,(%esp)
+  802b2b:	e8 08 06 00 00       	call   803138 <pageref>
+  802b30:	89 c2                	mov    %eax,%edx
+  802b32:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b34:	05 00 00 00 20       	add    $0x20000000,%eax
+  802b39:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802b3c:	8b 0d b4 50 80 00    	mov    0x8050b4,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b42:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b47:	76 31                	jbe    802b7a <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802b49:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802b4c:	39 c3                	cmp    %eax,%ebx
+  802b4e:	74 76                	je     802bc6 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802b50:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802b53:	74 36                	je     802b8b <_pipeisclosed+0x81>
+  802b55:	89 e0                	mov    %esp,%eax
+  802b57:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b5c:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b62:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b67:	77 b0                	ja     802b19 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802b69:	c1 e8 10             	shr    $0x10,%eax
+  802b6c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b72:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b78:	eb 9f                	jmp    802b19 <_pipeisclosed+0xf>
+  802b7a:	c1 e8 10             	shr    $0x10,%eax
+  802b7d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b83:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802b89:	eb be                	jmp    802b49 <_pipeisclosed+0x3f>
+  802b8b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b8d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b92:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b98:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b9d:	76 16                	jbe    802bb5 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802b9f:	8b 42 58             	mov    0x58(%edx),%eax
+  802ba2:	6a 01                	push   $0x1
+  802ba4:	50                   	push   %eax
+  802ba5:	53                   	push   %ebx
+  802ba6:	68 6f 37 80 00       	push   $0x80376f
+  802bab:	e8 ca db ff ff       	call   80077a <cprintf>
+  802bb0:	83 c4 10             	add    $0x10,%esp
+  802bb3:	eb a0                	jmp    802b55 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802bb5:	c1 e8 10             	shr    $0x10,%eax
+  802bb8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802bbe:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802bc4:	eb d9                	jmp    802b9f <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802bc6:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802bc9:	0f 94 c0             	sete   %al
+  802bcc:	0f b6 c0             	movzbl %al,%eax
+}
+  802bcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd2:	5b                   	pop    %ebx
+  802bd3:	5e                   	pop    %esi
+  802bd4:	5f                   	pop    %edi
+  802bd5:	5d                   	pop    %ebp
+  802bd6:	c3                   	ret
+
+00802bd7 <devpipe_write>:
+{
+  802bd7:	55                   	push   %ebp
+  802bd8:	89 e5                	mov    %esp,%ebp
+  802bda:	57                   	push   %edi
+  802bdb:	56                   	push   %esi
+  802bdc:	53                   	push   %ebx
+  802bdd:	83 ec 28             	sub    $0x28,%esp
+  802be0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802be3:	56                   	push   %esi
+  802be4:	e8 e6 f1 ff ff       	call   801dcf <fd2data>
+  802be9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802beb:	83 c4 10             	add    $0x10,%esp
+  802bee:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802bf6:	75 09                	jne    802c01 <devpipe_write+0x2a>
+	return i;
+  802bf8:	89 f8                	mov    %edi,%eax
+  802bfa:	eb 23                	jmp    802c1f <devpipe_write+0x48>
+			sys_yield();
+  802bfc:	e8 73 e6 ff ff       	call   801274 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802c01:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c04:	8b 0b                	mov    (%ebx),%ecx
+  802c06:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c09:	39 d0                	cmp    %edx,%eax
+  802c0b:	72 1a                	jb     802c27 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802c0d:	89 da                	mov    %ebx,%edx
+  802c0f:	89 f0                	mov    %esi,%eax
+  802c11:	e8 f4 fe ff ff       	call   802b0a <_pipeisclosed>
+  802c16:	85 c0                	test   %eax,%eax
+  802c18:	74 e2                	je     802bfc <devpipe_write+0x25>
+				return 0;
+  802c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c22:	5b                   	pop    %ebx
+  802c23:	5e                   	pop    %esi
+  802c24:	5f                   	pop    %edi
+  802c25:	5d                   	pop    %ebp
+  802c26:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c2a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802c2e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802c31:	89 c2                	mov    %eax,%edx
+  802c33:	c1 fa 1f             	sar    $0x1f,%edx
+  802c36:	89 d1                	mov    %edx,%ecx
+  802c38:	c1 e9 1b             	shr    $0x1b,%ecx
+  802c3b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c3e:	83 e2 1f             	and    $0x1f,%edx
+  802c41:	29 ca                	sub    %ecx,%edx
+  802c43:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802c47:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802c4b:	83 c0 01             	add    $0x1,%eax
+  802c4e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802c51:	83 c7 01             	add    $0x1,%edi
+  802c54:	eb 9d                	jmp    802bf3 <devpipe_write+0x1c>
+
+00802c56 <devpipe_read>:
+{
+  802c56:	55                   	push   %ebp
+  802c57:	89 e5                	mov    %esp,%ebp
+  802c59:	57                   	push   %edi
+  802c5a:	56                   	push   %esi
+  802c5b:	53                   	push   %ebx
+  802c5c:	83 ec 18             	sub    $0x18,%esp
+  802c5f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802c62:	57                   	push   %edi
+  802c63:	e8 67 f1 ff ff       	call   801dcf <fd2data>
+  802c68:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802c72:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c75:	75 13                	jne    802c8a <devpipe_read+0x34>
+	return i;
+  802c77:	89 f0                	mov    %esi,%eax
+  802c79:	eb 02                	jmp    802c7d <devpipe_read+0x27>
+				return i;
+  802c7b:	89 f0                	mov    %esi,%eax
+}
+  802c7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c80:	5b                   	pop    %ebx
+  802c81:	5e                   	pop    %esi
+  802c82:	5f                   	pop    %edi
+  802c83:	5d                   	pop    %ebp
+  802c84:	c3                   	ret
+			sys_yield();
+  802c85:	e8 ea e5 ff ff       	call   801274 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802c8a:	8b 03                	mov    (%ebx),%eax
+  802c8c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c8f:	75 18                	jne    802ca9 <devpipe_read+0x53>
+			if (i > 0)
+  802c91:	85 f6                	test   %esi,%esi
+  802c93:	75 e6                	jne    802c7b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802c95:	89 da                	mov    %ebx,%edx
+  802c97:	89 f8                	mov    %edi,%eax
+  802c99:	e8 6c fe ff ff       	call   802b0a <_pipeisclosed>
+  802c9e:	85 c0                	test   %eax,%eax
+  802ca0:	74 e3                	je     802c85 <devpipe_read+0x2f>
+				return 0;
+  802ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca7:	eb d4                	jmp    802c7d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ca9:	99                   	cltd
+  802caa:	c1 ea 1b             	shr    $0x1b,%edx
+  802cad:	01 d0                	add    %edx,%eax
+  802caf:	83 e0 1f             	and    $0x1f,%eax
+  802cb2:	29 d0                	sub    %edx,%eax
+  802cb4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802cb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cbc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802cbf:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802cc2:	83 c6 01             	add    $0x1,%esi
+  802cc5:	eb ab                	jmp    802c72 <devpipe_read+0x1c>
+
+00802cc7 <pipe>:
+{
+  802cc7:	55                   	push   %ebp
+  802cc8:	89 e5                	mov    %esp,%ebp
+  802cca:	56                   	push   %esi
+  802ccb:	53                   	push   %ebx
+  802ccc:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802ccf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cd2:	50                   	push   %eax
+  802cd3:	e8 0e f1 ff ff       	call   801de6 <fd_alloc>
+  802cd8:	89 c3                	mov    %eax,%ebx
+  802cda:	83 c4 10             	add    $0x10,%esp
+  802cdd:	85 c0                	test   %eax,%eax
+  802cdf:	0f 88 23 01 00 00    	js     802e08 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ce5:	83 ec 04             	sub    $0x4,%esp
+  802ce8:	68 07 04 00 00       	push   $0x407
+  802ced:	ff 75 f4             	push   -0xc(%ebp)
+  802cf0:	6a 00                	push   $0x0
+  802cf2:	e8 c3 e5 ff ff       	call   8012ba <sys_page_alloc>
+  802cf7:	89 c3                	mov    %eax,%ebx
+  802cf9:	83 c4 10             	add    $0x10,%esp
+  802cfc:	85 c0                	test   %eax,%eax
+  802cfe:	0f 88 04 01 00 00    	js     802e08 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802d04:	83 ec 0c             	sub    $0xc,%esp
+  802d07:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d0a:	50                   	push   %eax
+  802d0b:	e8 d6 f0 ff ff       	call   801de6 <fd_alloc>
+  802d10:	89 c3                	mov    %eax,%ebx
+  802d12:	83 c4 10             	add    $0x10,%esp
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	0f 88 db 00 00 00    	js     802df8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d1d:	83 ec 04             	sub    $0x4,%esp
+  802d20:	68 07 04 00 00       	push   $0x407
+  802d25:	ff 75 f0             	push   -0x10(%ebp)
+  802d28:	6a 00                	push   $0x0
+  802d2a:	e8 8b e5 ff ff       	call   8012ba <sys_page_alloc>
+  802d2f:	89 c3                	mov    %eax,%ebx
+  802d31:	83 c4 10             	add    $0x10,%esp
+  802d34:	85 c0                	test   %eax,%eax
+  802d36:	0f 88 bc 00 00 00    	js     802df8 <pipe+0x131>
+	va = fd2data(fd0);
+  802d3c:	83 ec 0c             	sub    $0xc,%esp
+  802d3f:	ff 75 f4             	push   -0xc(%ebp)
+  802d42:	e8 88 f0 ff ff       	call   801dcf <fd2data>
+  802d47:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d49:	83 c4 0c             	add    $0xc,%esp
+  802d4c:	68 07 04 00 00       	push   $0x407
+  802d51:	50                   	push   %eax
+  802d52:	6a 00                	push   $0x0
+  802d54:	e8 61 e5 ff ff       	call   8012ba <sys_page_alloc>
+  802d59:	89 c3                	mov    %eax,%ebx
+  802d5b:	83 c4 10             	add    $0x10,%esp
+  802d5e:	85 c0                	test   %eax,%eax
+  802d60:	0f 88 82 00 00 00    	js     802de8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d66:	83 ec 0c             	sub    $0xc,%esp
+  802d69:	ff 75 f0             	push   -0x10(%ebp)
+  802d6c:	e8 5e f0 ff ff       	call   801dcf <fd2data>
+  802d71:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d78:	50                   	push   %eax
+  802d79:	6a 00                	push   $0x0
+  802d7b:	56                   	push   %esi
+  802d7c:	6a 00                	push   $0x0
+  802d7e:	e8 a4 e5 ff ff       	call   801327 <sys_page_map>
+  802d83:	89 c3                	mov    %eax,%ebx
+  802d85:	83 c4 20             	add    $0x20,%esp
+  802d88:	85 c0                	test   %eax,%eax
+  802d8a:	78 4e                	js     802dda <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802d8c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802d91:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d94:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802d96:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d99:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802da0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802da3:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802da5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802da8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802daf:	83 ec 0c             	sub    $0xc,%esp
+  802db2:	ff 75 f4             	push   -0xc(%ebp)
+  802db5:	e8 05 f0 ff ff       	call   801dbf <fd2num>
+  802dba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dbd:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802dbf:	83 c4 04             	add    $0x4,%esp
+  802dc2:	ff 75 f0             	push   -0x10(%ebp)
+  802dc5:	e8 f5 ef ff ff       	call   801dbf <fd2num>
+  802dca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dcd:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802dd0:	83 c4 10             	add    $0x10,%esp
+  802dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dd8:	eb 2e                	jmp    802e08 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802dda:	83 ec 08             	sub    $0x8,%esp
+  802ddd:	56                   	push   %esi
+  802dde:	6a 00                	push   $0x0
+  802de0:	e8 b0 e5 ff ff       	call   801395 <sys_page_unmap>
+  802de5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802de8:	83 ec 08             	sub    $0x8,%esp
+  802deb:	ff 75 f0             	push   -0x10(%ebp)
+  802dee:	6a 00                	push   $0x0
+  802df0:	e8 a0 e5 ff ff       	call   801395 <sys_page_unmap>
+  802df5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802df8:	83 ec 08             	sub    $0x8,%esp
+  802dfb:	ff 75 f4             	push   -0xc(%ebp)
+  802dfe:	6a 00                	push   $0x0
+  802e00:	e8 90 e5 ff ff       	call   801395 <sys_page_unmap>
+  802e05:	83 c4 10             	add    $0x10,%esp
+}
+  802e08:	89 d8                	mov    %ebx,%eax
+  802e0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e0d:	5b                   	pop    %ebx
+  802e0e:	5e                   	pop    %esi
+  802e0f:	5d                   	pop    %ebp
+  802e10:	c3                   	ret
+
+00802e11 <pipeisclosed>:
+{
+  802e11:	55                   	push   %ebp
+  802e12:	89 e5                	mov    %esp,%ebp
+  802e14:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e17:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e1a:	50                   	push   %eax
+  802e1b:	ff 75 08             	push   0x8(%ebp)
+  802e1e:	e8 19 f0 ff ff       	call   801e3c <fd_lookup>
+  802e23:	83 c4 10             	add    $0x10,%esp
+  802e26:	85 c0                	test   %eax,%eax
+  802e28:	78 18                	js     802e42 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802e2a:	83 ec 0c             	sub    $0xc,%esp
+  802e2d:	ff 75 f4             	push   -0xc(%ebp)
+  802e30:	e8 9a ef ff ff       	call   801dcf <fd2data>
+  802e35:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802e37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e3a:	e8 cb fc ff ff       	call   802b0a <_pipeisclosed>
+  802e3f:	83 c4 10             	add    $0x10,%esp
+}
+  802e42:	c9                   	leave
+  802e43:	c3                   	ret
+
+00802e44 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e49:	c3                   	ret
+
+00802e4a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e4a:	55                   	push   %ebp
+  802e4b:	89 e5                	mov    %esp,%ebp
+  802e4d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802e50:	68 87 37 80 00       	push   $0x803787
+  802e55:	ff 75 0c             	push   0xc(%ebp)
+  802e58:	e8 65 df ff ff       	call   800dc2 <strcpy>
+	return 0;
+}
+  802e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e62:	c9                   	leave
+  802e63:	c3                   	ret
+
+00802e64 <devcons_write>:
+{
+  802e64:	55                   	push   %ebp
+  802e65:	89 e5                	mov    %esp,%ebp
+  802e67:	57                   	push   %edi
+  802e68:	56                   	push   %esi
+  802e69:	53                   	push   %ebx
+  802e6a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802e70:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802e75:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802e7b:	eb 2e                	jmp    802eab <devcons_write+0x47>
+		m = n - tot;
+  802e7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e80:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802e82:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802e87:	39 c3                	cmp    %eax,%ebx
+  802e89:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802e8c:	83 ec 04             	sub    $0x4,%esp
+  802e8f:	53                   	push   %ebx
+  802e90:	89 f0                	mov    %esi,%eax
+  802e92:	03 45 0c             	add    0xc(%ebp),%eax
+  802e95:	50                   	push   %eax
+  802e96:	57                   	push   %edi
+  802e97:	e8 ac e0 ff ff       	call   800f48 <memmove>
+		sys_cputs(buf, m);
+  802e9c:	83 c4 08             	add    $0x8,%esp
+  802e9f:	53                   	push   %ebx
+  802ea0:	57                   	push   %edi
+  802ea1:	e8 95 e2 ff ff       	call   80113b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802ea6:	01 de                	add    %ebx,%esi
+  802ea8:	83 c4 10             	add    $0x10,%esp
+  802eab:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802eae:	72 cd                	jb     802e7d <devcons_write+0x19>
+}
+  802eb0:	89 f0                	mov    %esi,%eax
+  802eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eb5:	5b                   	pop    %ebx
+  802eb6:	5e                   	pop    %esi
+  802eb7:	5f                   	pop    %edi
+  802eb8:	5d                   	pop    %ebp
+  802eb9:	c3                   	ret
+
+00802eba <devcons_read>:
+{
+  802eba:	55                   	push   %ebp
+  802ebb:	89 e5                	mov    %esp,%ebp
+  802ebd:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ec9:	75 07                	jne    802ed2 <devcons_read+0x18>
+  802ecb:	eb 1f                	jmp    802eec <devcons_read+0x32>
+		sys_yield();
+  802ecd:	e8 a2 e3 ff ff       	call   801274 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802ed2:	e8 a8 e2 ff ff       	call   80117f <sys_cgetc>
+  802ed7:	85 c0                	test   %eax,%eax
+  802ed9:	74 f2                	je     802ecd <devcons_read+0x13>
+	if (c < 0)
+  802edb:	78 0f                	js     802eec <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802edd:	83 f8 04             	cmp    $0x4,%eax
+  802ee0:	74 0c                	je     802eee <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802ee2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ee5:	88 02                	mov    %al,(%edx)
+	return 1;
+  802ee7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802eec:	c9                   	leave
+  802eed:	c3                   	ret
+		return 0;
+  802eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef3:	eb f7                	jmp    802eec <devcons_read+0x32>
+
+00802ef5 <cputchar>:
+{
+  802ef5:	55                   	push   %ebp
+  802ef6:	89 e5                	mov    %esp,%ebp
+  802ef8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802efb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802efe:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802f01:	6a 01                	push   $0x1
+  802f03:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f06:	50                   	push   %eax
+  802f07:	e8 2f e2 ff ff       	call   80113b <sys_cputs>
+}
+  802f0c:	83 c4 10             	add    $0x10,%esp
+  802f0f:	c9                   	leave
+  802f10:	c3                   	ret
+
+00802f11 <getchar>:
+{
+  802f11:	55                   	push   %ebp
+  802f12:	89 e5                	mov    %esp,%ebp
+  802f14:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802f17:	6a 01                	push   $0x1
+  802f19:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f1c:	50                   	push   %eax
+  802f1d:	6a 00                	push   $0x0
+  802f1f:	e8 9e f1 ff ff       	call   8020c2 <read>
+	if (r < 0)
+  802f24:	83 c4 10             	add    $0x10,%esp
+  802f27:	85 c0                	test   %eax,%eax
+  802f29:	78 06                	js     802f31 <getchar+0x20>
+	if (r < 1)
+  802f2b:	74 06                	je     802f33 <getchar+0x22>
+	return c;
+  802f2d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+		return -E_EOF;
+  802f33:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802f38:	eb f7                	jmp    802f31 <getchar+0x20>
+
+00802f3a <iscons>:
+{
+  802f3a:	55                   	push   %ebp
+  802f3b:	89 e5                	mov    %esp,%ebp
+  802f3d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f43:	50                   	push   %eax
+  802f44:	ff 75 08             	push   0x8(%ebp)
+  802f47:	e8 f0 ee ff ff       	call   801e3c <fd_lookup>
+  802f4c:	83 c4 10             	add    $0x10,%esp
+  802f4f:	85 c0                	test   %eax,%eax
+  802f51:	78 11                	js     802f64 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802f53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f56:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802f5c:	39 10                	cmp    %edx,(%eax)
+  802f5e:	0f 94 c0             	sete   %al
+  802f61:	0f b6 c0             	movzbl %al,%eax
+}
+  802f64:	c9                   	leave
+  802f65:	c3                   	ret
+
+00802f66 <opencons>:
+{
+  802f66:	55                   	push   %ebp
+  802f67:	89 e5                	mov    %esp,%ebp
+  802f69:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802f6c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f6f:	50                   	push   %eax
+  802f70:	e8 71 ee ff ff       	call   801de6 <fd_alloc>
+  802f75:	83 c4 10             	add    $0x10,%esp
+  802f78:	85 c0                	test   %eax,%eax
+  802f7a:	78 3a                	js     802fb6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802f7c:	83 ec 04             	sub    $0x4,%esp
+  802f7f:	68 07 04 00 00       	push   $0x407
+  802f84:	ff 75 f4             	push   -0xc(%ebp)
+  802f87:	6a 00                	push   $0x0
+  802f89:	e8 2c e3 ff ff       	call   8012ba <sys_page_alloc>
+  802f8e:	83 c4 10             	add    $0x10,%esp
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	78 21                	js     802fb6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802f95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f98:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802f9e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802fa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fa3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802faa:	83 ec 0c             	sub    $0xc,%esp
+  802fad:	50                   	push   %eax
+  802fae:	e8 0c ee ff ff       	call   801dbf <fd2num>
+  802fb3:	83 c4 10             	add    $0x10,%esp
+}
+  802fb6:	c9                   	leave
+  802fb7:	c3                   	ret
+
+00802fb8 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802fb8:	55                   	push   %ebp
+  802fb9:	89 e5                	mov    %esp,%ebp
+  802fbb:	56                   	push   %esi
+  802fbc:	53                   	push   %ebx
+  802fbd:	8b 75 08             	mov    0x8(%ebp),%esi
+  802fc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802fc6:	85 c0                	test   %eax,%eax
+  802fc8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802fcd:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802fd0:	83 ec 08             	sub    $0x8,%esp
+  802fd3:	ff 75 14             	push   0x14(%ebp)
+  802fd6:	50                   	push   %eax
+  802fd7:	e8 ef e6 ff ff       	call   8016cb <sys_ipc_recv_until>
+  802fdc:	83 c4 10             	add    $0x10,%esp
+  802fdf:	85 c0                	test   %eax,%eax
+  802fe1:	78 61                	js     803044 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802fe3:	85 f6                	test   %esi,%esi
+  802fe5:	74 1c                	je     803003 <ipc_recv_until+0x4b>
+  802fe7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fe9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802fee:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ff4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ff9:	76 5f                	jbe    80305a <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802ffb:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803001:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803003:	85 db                	test   %ebx,%ebx
+  803005:	74 1c                	je     803023 <ipc_recv_until+0x6b>
+  803007:	89 e0                	mov    %esp,%eax
+  803009:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80300e:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803014:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803019:	76 50                	jbe    80306b <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80301b:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803021:	89 03                	mov    %eax,(%ebx)
+  803023:	89 e0                	mov    %esp,%eax
+  803025:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80302a:	8b 15 b4 50 80 00    	mov    0x8050b4,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803030:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803035:	76 45                	jbe    80307c <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803037:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80303d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803040:	5b                   	pop    %ebx
+  803041:	5e                   	pop    %esi
+  803042:	5d                   	pop    %ebp
+  803043:	c3                   	ret
+		if (from_env_store)
+  803044:	85 f6                	test   %esi,%esi
+  803046:	74 06                	je     80304e <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803048:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  80304e:	85 db                	test   %ebx,%ebx
+  803050:	74 eb                	je     80303d <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803052:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803058:	eb e3                	jmp    80303d <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80305a:	c1 e8 10             	shr    $0x10,%eax
+  80305d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803063:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803069:	eb 90                	jmp    802ffb <ipc_recv_until+0x43>
+  80306b:	c1 e8 10             	shr    $0x10,%eax
+  80306e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803074:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80307a:	eb 9f                	jmp    80301b <ipc_recv_until+0x63>
+  80307c:	c1 e8 10             	shr    $0x10,%eax
+  80307f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803085:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80308b:	eb aa                	jmp    803037 <ipc_recv_until+0x7f>
+
+0080308d <ipc_recv>:
+{
+  80308d:	55                   	push   %ebp
+  80308e:	89 e5                	mov    %esp,%ebp
+  803090:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803093:	6a 00                	push   $0x0
+  803095:	ff 75 10             	push   0x10(%ebp)
+  803098:	ff 75 0c             	push   0xc(%ebp)
+  80309b:	ff 75 08             	push   0x8(%ebp)
+  80309e:	e8 15 ff ff ff       	call   802fb8 <ipc_recv_until>
+}
+  8030a3:	c9                   	leave
+  8030a4:	c3                   	ret
+
+008030a5 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8030a5:	55                   	push   %ebp
+  8030a6:	89 e5                	mov    %esp,%ebp
+  8030a8:	57                   	push   %edi
+  8030a9:	56                   	push   %esi
+  8030aa:	53                   	push   %ebx
+  8030ab:	83 ec 0c             	sub    $0xc,%esp
+  8030ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8030b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8030b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8030b7:	85 db                	test   %ebx,%ebx
+  8030b9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8030be:	0f 44 d8             	cmove  %eax,%ebx
+  8030c1:	eb 05                	jmp    8030c8 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8030c3:	e8 ac e1 ff ff       	call   801274 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8030c8:	ff 75 14             	push   0x14(%ebp)
+  8030cb:	53                   	push   %ebx
+  8030cc:	56                   	push   %esi
+  8030cd:	57                   	push   %edi
+  8030ce:	e8 44 e5 ff ff       	call   801617 <sys_ipc_try_send>
+  8030d3:	83 c4 10             	add    $0x10,%esp
+  8030d6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8030d9:	74 e8                	je     8030c3 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8030db:	85 c0                	test   %eax,%eax
+  8030dd:	78 08                	js     8030e7 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8030df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030e2:	5b                   	pop    %ebx
+  8030e3:	5e                   	pop    %esi
+  8030e4:	5f                   	pop    %edi
+  8030e5:	5d                   	pop    %ebp
+  8030e6:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8030e7:	50                   	push   %eax
+  8030e8:	68 93 37 80 00       	push   $0x803793
+  8030ed:	6a 4f                	push   $0x4f
+  8030ef:	68 a6 37 80 00       	push   $0x8037a6
+  8030f4:	e8 a6 d5 ff ff       	call   80069f <_panic>
+
+008030f9 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8030f9:	55                   	push   %ebp
+  8030fa:	89 e5                	mov    %esp,%ebp
+  8030fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8030ff:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803104:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80310a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803110:	8b 52 50             	mov    0x50(%edx),%edx
+  803113:	39 ca                	cmp    %ecx,%edx
+  803115:	74 11                	je     803128 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803117:	83 c0 01             	add    $0x1,%eax
+  80311a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80311f:	75 e3                	jne    803104 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803121:	b8 00 00 00 00       	mov    $0x0,%eax
+  803126:	eb 0e                	jmp    803136 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803128:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80312e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803133:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803136:	5d                   	pop    %ebp
+  803137:	c3                   	ret
+
+00803138 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803138:	55                   	push   %ebp
+  803139:	89 e5                	mov    %esp,%ebp
+  80313b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80313e:	89 c2                	mov    %eax,%edx
+  803140:	c1 ea 16             	shr    $0x16,%edx
+  803143:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80314a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80314f:	f6 c1 01             	test   $0x1,%cl
+  803152:	74 1a                	je     80316e <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803154:	c1 e8 0c             	shr    $0xc,%eax
+  803157:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80315e:	a8 01                	test   $0x1,%al
+  803160:	74 0c                	je     80316e <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803162:	c1 e8 0c             	shr    $0xc,%eax
+  803165:	c1 e0 04             	shl    $0x4,%eax
+  803168:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80316e:	89 d0                	mov    %edx,%eax
+  803170:	5d                   	pop    %ebp
+  803171:	c3                   	ret
@@ -0,0 +1,6151 @@
+
+obj/user/faultwritekernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	*(unsigned*)0xf0100000 = 0;
+  800033:	c7 05 00 00 10 f0 00 	movl   $0x0,0xf0100000
+  80003a:	00 00 00 
+}
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	57                   	push   %edi
+  800042:	56                   	push   %esi
+  800043:	53                   	push   %ebx
+  800044:	83 ec 0c             	sub    $0xc,%esp
+  800047:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80004a:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80004d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800052:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800054:	c1 ea 0b             	shr    $0xb,%edx
+  800057:	83 f2 01             	xor    $0x1,%edx
+  80005a:	83 e2 01             	and    $0x1,%edx
+  80005d:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800063:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80006a:	00 00 00 
+	envid = sys_getenvid();
+  80006d:	e8 1f 0c 00 00       	call   800c91 <sys_getenvid>
+  800072:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800074:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800079:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80007f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800085:	8b 52 48             	mov    0x48(%edx),%edx
+  800088:	39 ca                	cmp    %ecx,%edx
+  80008a:	74 27                	je     8000b3 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80008c:	83 c0 01             	add    $0x1,%eax
+  80008f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800094:	75 e3                	jne    800079 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800096:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80009d:	75 24                	jne    8000c3 <libmain+0x85>
+		panic("libmain can't find the environment");
+  80009f:	83 ec 04             	sub    $0x4,%esp
+  8000a2:	68 60 2b 80 00       	push   $0x802b60
+  8000a7:	6a 23                	push   $0x23
+  8000a9:	68 83 2b 80 00       	push   $0x802b83
+  8000ae:	e8 4f 00 00 00       	call   800102 <_panic>
+			mainenv = &envs[i];
+  8000b3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000b9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000be:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000c3:	85 ff                	test   %edi,%edi
+  8000c5:	7e 07                	jle    8000ce <libmain+0x90>
+		binaryname = argv[0];
+  8000c7:	8b 06                	mov    (%esi),%eax
+  8000c9:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ce:	83 ec 08             	sub    $0x8,%esp
+  8000d1:	56                   	push   %esi
+  8000d2:	57                   	push   %edi
+  8000d3:	e8 5b ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d8:	e8 0b 00 00 00       	call   8000e8 <exit>
+}
+  8000dd:	83 c4 10             	add    $0x10,%esp
+  8000e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e3:	5b                   	pop    %ebx
+  8000e4:	5e                   	pop    %esi
+  8000e5:	5f                   	pop    %edi
+  8000e6:	5d                   	pop    %ebp
+  8000e7:	c3                   	ret
+
+008000e8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e8:	55                   	push   %ebp
+  8000e9:	89 e5                	mov    %esp,%ebp
+  8000eb:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000ee:	e8 94 18 00 00       	call   801987 <close_all>
+	sys_env_destroy(0);
+  8000f3:	83 ec 0c             	sub    $0xc,%esp
+  8000f6:	6a 00                	push   $0x0
+  8000f8:	e8 2b 0b 00 00       	call   800c28 <sys_env_destroy>
+}
+  8000fd:	83 c4 10             	add    $0x10,%esp
+  800100:	c9                   	leave
+  800101:	c3                   	ret
+
+00800102 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800102:	55                   	push   %ebp
+  800103:	89 e5                	mov    %esp,%ebp
+  800105:	56                   	push   %esi
+  800106:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800107:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80010a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800110:	e8 7c 0b 00 00       	call   800c91 <sys_getenvid>
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	ff 75 0c             	push   0xc(%ebp)
+  80011b:	ff 75 08             	push   0x8(%ebp)
+  80011e:	56                   	push   %esi
+  80011f:	50                   	push   %eax
+  800120:	68 9c 2b 80 00       	push   $0x802b9c
+  800125:	e8 b3 00 00 00       	call   8001dd <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80012a:	83 c4 18             	add    $0x18,%esp
+  80012d:	53                   	push   %ebx
+  80012e:	ff 75 10             	push   0x10(%ebp)
+  800131:	e8 56 00 00 00       	call   80018c <vcprintf>
+	cprintf("\n");
+  800136:	c7 04 24 0c 30 80 00 	movl   $0x80300c,(%esp)
+  80013d:	e8 9b 00 00 00       	call   8001dd <cprintf>
+  800142:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800145:	cc                   	int3
+	while (1)
+  800146:	eb fd                	jmp    800145 <_panic+0x43>
+
+00800148 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	53                   	push   %ebx
+  80014c:	83 ec 04             	sub    $0x4,%esp
+  80014f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800152:	8b 13                	mov    (%ebx),%edx
+  800154:	8d 42 01             	lea    0x1(%edx),%eax
+  800157:	89 03                	mov    %eax,(%ebx)
+  800159:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80015c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800160:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800165:	74 09                	je     800170 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800167:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80016b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80016e:	c9                   	leave
+  80016f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800170:	83 ec 08             	sub    $0x8,%esp
+  800173:	68 ff 00 00 00       	push   $0xff
+  800178:	8d 43 08             	lea    0x8(%ebx),%eax
+  80017b:	50                   	push   %eax
+  80017c:	e8 1d 0a 00 00       	call   800b9e <sys_cputs>
+		b->idx = 0;
+  800181:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800187:	83 c4 10             	add    $0x10,%esp
+  80018a:	eb db                	jmp    800167 <putch+0x1f>
+
+0080018c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800195:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80019c:	00 00 00 
+	b.cnt = 0;
+  80019f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001a6:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a9:	ff 75 0c             	push   0xc(%ebp)
+  8001ac:	ff 75 08             	push   0x8(%ebp)
+  8001af:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001b5:	50                   	push   %eax
+  8001b6:	68 48 01 80 00       	push   $0x800148
+  8001bb:	e8 fb 00 00 00       	call   8002bb <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001c0:	83 c4 08             	add    $0x8,%esp
+  8001c3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001cf:	50                   	push   %eax
+  8001d0:	e8 c9 09 00 00       	call   800b9e <sys_cputs>
+
+	return b.cnt;
+}
+  8001d5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001db:	c9                   	leave
+  8001dc:	c3                   	ret
+
+008001dd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001e3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001e6:	50                   	push   %eax
+  8001e7:	ff 75 08             	push   0x8(%ebp)
+  8001ea:	e8 9d ff ff ff       	call   80018c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001ef:	c9                   	leave
+  8001f0:	c3                   	ret
+
+008001f1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8001f1:	55                   	push   %ebp
+  8001f2:	89 e5                	mov    %esp,%ebp
+  8001f4:	57                   	push   %edi
+  8001f5:	56                   	push   %esi
+  8001f6:	53                   	push   %ebx
+  8001f7:	83 ec 1c             	sub    $0x1c,%esp
+  8001fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8001fd:	89 d6                	mov    %edx,%esi
+  8001ff:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800202:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800205:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800208:	73 0b                	jae    800215 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80020a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80020d:	c1 e7 08             	shl    $0x8,%edi
+  800210:	0b 7d 10             	or     0x10(%ebp),%edi
+  800213:	eb 36                	jmp    80024b <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800215:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021d:	f7 75 08             	divl   0x8(%ebp)
+  800220:	89 c1                	mov    %eax,%ecx
+  800222:	ff 75 14             	push   0x14(%ebp)
+  800225:	ff 75 10             	push   0x10(%ebp)
+  800228:	83 eb 01             	sub    $0x1,%ebx
+  80022b:	53                   	push   %ebx
+  80022c:	ff 75 08             	push   0x8(%ebp)
+  80022f:	89 f2                	mov    %esi,%edx
+  800231:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800234:	e8 b8 ff ff ff       	call   8001f1 <printnum>
+  800239:	83 c4 10             	add    $0x10,%esp
+  80023c:	eb 14                	jmp    800252 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80023e:	83 ec 08             	sub    $0x8,%esp
+  800241:	56                   	push   %esi
+  800242:	57                   	push   %edi
+  800243:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800246:	ff d0                	call   *%eax
+  800248:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80024b:	83 eb 01             	sub    $0x1,%ebx
+  80024e:	85 db                	test   %ebx,%ebx
+  800250:	7f ec                	jg     80023e <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800252:	83 ec 08             	sub    $0x8,%esp
+  800255:	56                   	push   %esi
+  800256:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800259:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025e:	f7 75 08             	divl   0x8(%ebp)
+  800261:	0f be 92 bf 2b 80 00 	movsbl 0x802bbf(%edx),%edx
+  800268:	8b 45 14             	mov    0x14(%ebp),%eax
+  80026b:	c1 e0 08             	shl    $0x8,%eax
+  80026e:	09 d0                	or     %edx,%eax
+  800270:	50                   	push   %eax
+  800271:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800274:	ff d0                	call   *%eax
+}
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027c:	5b                   	pop    %ebx
+  80027d:	5e                   	pop    %esi
+  80027e:	5f                   	pop    %edi
+  80027f:	5d                   	pop    %ebp
+  800280:	c3                   	ret
+
+00800281 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800287:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80028b:	8b 10                	mov    (%eax),%edx
+  80028d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800290:	73 0a                	jae    80029c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800292:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800295:	89 08                	mov    %ecx,(%eax)
+  800297:	8b 45 08             	mov    0x8(%ebp),%eax
+  80029a:	88 02                	mov    %al,(%edx)
+}
+  80029c:	5d                   	pop    %ebp
+  80029d:	c3                   	ret
+
+0080029e <printfmt>:
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002a4:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002a7:	50                   	push   %eax
+  8002a8:	ff 75 10             	push   0x10(%ebp)
+  8002ab:	ff 75 0c             	push   0xc(%ebp)
+  8002ae:	ff 75 08             	push   0x8(%ebp)
+  8002b1:	e8 05 00 00 00       	call   8002bb <vprintfmt>
+}
+  8002b6:	83 c4 10             	add    $0x10,%esp
+  8002b9:	c9                   	leave
+  8002ba:	c3                   	ret
+
+008002bb <vprintfmt>:
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	57                   	push   %edi
+  8002bf:	56                   	push   %esi
+  8002c0:	53                   	push   %ebx
+  8002c1:	83 ec 3c             	sub    $0x3c,%esp
+  8002c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002c7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002ca:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002d1:	eb 16                	jmp    8002e9 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002d3:	83 ec 08             	sub    $0x8,%esp
+  8002d6:	ff 75 0c             	push   0xc(%ebp)
+  8002d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002dc:	c1 e2 08             	shl    $0x8,%edx
+  8002df:	09 d0                	or     %edx,%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	ff d7                	call   *%edi
+  8002e4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002e7:	89 de                	mov    %ebx,%esi
+  8002e9:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8002ec:	0f b6 06             	movzbl (%esi),%eax
+  8002ef:	83 f8 25             	cmp    $0x25,%eax
+  8002f2:	74 0c                	je     800300 <vprintfmt+0x45>
+			if (ch == '\0')
+  8002f4:	85 c0                	test   %eax,%eax
+  8002f6:	75 db                	jne    8002d3 <vprintfmt+0x18>
+}
+  8002f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002fb:	5b                   	pop    %ebx
+  8002fc:	5e                   	pop    %esi
+  8002fd:	5f                   	pop    %edi
+  8002fe:	5d                   	pop    %ebp
+  8002ff:	c3                   	ret
+		padc = ' ';
+  800300:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800304:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80030b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800312:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800319:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80031e:	8d 73 01             	lea    0x1(%ebx),%esi
+  800321:	0f b6 13             	movzbl (%ebx),%edx
+  800324:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800327:	3c 55                	cmp    $0x55,%al
+  800329:	0f 87 2c 04 00 00    	ja     80075b <vprintfmt+0x4a0>
+  80032f:	0f b6 c0             	movzbl %al,%eax
+  800332:	ff 24 85 00 2d 80 00 	jmp    *0x802d00(,%eax,4)
+  800339:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80033b:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80033f:	eb dd                	jmp    80031e <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800341:	89 f3                	mov    %esi,%ebx
+  800343:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800347:	eb d5                	jmp    80031e <vprintfmt+0x63>
+  800349:	0f b6 d2             	movzbl %dl,%edx
+  80034c:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80034e:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800353:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800356:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80035a:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80035d:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800360:	83 fe 09             	cmp    $0x9,%esi
+  800363:	0f 87 8a 00 00 00    	ja     8003f3 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800369:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80036c:	eb e5                	jmp    800353 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80036e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800371:	8b 00                	mov    (%eax),%eax
+  800373:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800376:	8b 45 14             	mov    0x14(%ebp),%eax
+  800379:	8d 40 04             	lea    0x4(%eax),%eax
+  80037c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80037f:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800381:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800385:	79 97                	jns    80031e <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800387:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80038a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80038d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800394:	eb 88                	jmp    80031e <vprintfmt+0x63>
+			if (width < 0)
+  800396:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800399:	85 db                	test   %ebx,%ebx
+  80039b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a0:	0f 49 c3             	cmovns %ebx,%eax
+  8003a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a6:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003a8:	e9 71 ff ff ff       	jmp    80031e <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ad:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003af:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003b6:	e9 63 ff ff ff       	jmp    80031e <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003bb:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003be:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003c2:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003c9:	3c 67                	cmp    $0x67,%al
+  8003cb:	0f 84 18 ff ff ff    	je     8002e9 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003d1:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003d8:	3c 72                	cmp    $0x72,%al
+  8003da:	0f 84 09 ff ff ff    	je     8002e9 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003e0:	3c 62                	cmp    $0x62,%al
+  8003e2:	0f 94 c0             	sete   %al
+  8003e5:	0f b6 c0             	movzbl %al,%eax
+  8003e8:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ee:	e9 f6 fe ff ff       	jmp    8002e9 <vprintfmt+0x2e>
+  8003f3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f6:	eb 89                	jmp    800381 <vprintfmt+0xc6>
+			lflag++;
+  8003f8:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fb:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003fd:	e9 1c ff ff ff       	jmp    80031e <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800402:	8b 45 14             	mov    0x14(%ebp),%eax
+  800405:	8d 58 04             	lea    0x4(%eax),%ebx
+  800408:	83 ec 08             	sub    $0x8,%esp
+  80040b:	ff 75 0c             	push   0xc(%ebp)
+  80040e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800411:	c1 e0 08             	shl    $0x8,%eax
+  800414:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800417:	0b 01                	or     (%ecx),%eax
+  800419:	50                   	push   %eax
+  80041a:	ff d7                	call   *%edi
+			break;
+  80041c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80041f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800422:	e9 c2 fe ff ff       	jmp    8002e9 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800427:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042a:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80042d:	8b 10                	mov    (%eax),%edx
+  80042f:	89 d0                	mov    %edx,%eax
+  800431:	f7 d8                	neg    %eax
+  800433:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800436:	83 f8 12             	cmp    $0x12,%eax
+  800439:	7f 25                	jg     800460 <vprintfmt+0x1a5>
+  80043b:	8b 14 85 60 2e 80 00 	mov    0x802e60(,%eax,4),%edx
+  800442:	85 d2                	test   %edx,%edx
+  800444:	74 1a                	je     800460 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800446:	52                   	push   %edx
+  800447:	68 a1 2f 80 00       	push   $0x802fa1
+  80044c:	ff 75 0c             	push   0xc(%ebp)
+  80044f:	57                   	push   %edi
+  800450:	e8 49 fe ff ff       	call   80029e <printfmt>
+  800455:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800458:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80045b:	e9 89 fe ff ff       	jmp    8002e9 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800460:	50                   	push   %eax
+  800461:	68 d7 2b 80 00       	push   $0x802bd7
+  800466:	ff 75 0c             	push   0xc(%ebp)
+  800469:	57                   	push   %edi
+  80046a:	e8 2f fe ff ff       	call   80029e <printfmt>
+  80046f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800472:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800475:	e9 6f fe ff ff       	jmp    8002e9 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80047a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047d:	83 c0 04             	add    $0x4,%eax
+  800480:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800483:	8b 45 14             	mov    0x14(%ebp),%eax
+  800486:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800488:	85 c9                	test   %ecx,%ecx
+  80048a:	b8 d0 2b 80 00       	mov    $0x802bd0,%eax
+  80048f:	0f 45 c1             	cmovne %ecx,%eax
+  800492:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800495:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800499:	7e 06                	jle    8004a1 <vprintfmt+0x1e6>
+  80049b:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80049f:	75 1a                	jne    8004bb <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004a4:	c1 e0 08             	shl    $0x8,%eax
+  8004a7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004aa:	83 c8 3f             	or     $0x3f,%eax
+  8004ad:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004b0:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004b3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004b6:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004b9:	eb 6d                	jmp    800528 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004bb:	83 ec 08             	sub    $0x8,%esp
+  8004be:	ff 75 d0             	push   -0x30(%ebp)
+  8004c1:	ff 75 c8             	push   -0x38(%ebp)
+  8004c4:	e8 39 03 00 00       	call   800802 <strnlen>
+  8004c9:	89 c2                	mov    %eax,%edx
+  8004cb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ce:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004d0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004d3:	c1 e1 08             	shl    $0x8,%ecx
+  8004d6:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004da:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004dc:	83 c4 10             	add    $0x10,%esp
+  8004df:	89 c3                	mov    %eax,%ebx
+  8004e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e4:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004e7:	89 ce                	mov    %ecx,%esi
+  8004e9:	eb 0f                	jmp    8004fa <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8004eb:	83 ec 08             	sub    $0x8,%esp
+  8004ee:	ff 75 0c             	push   0xc(%ebp)
+  8004f1:	56                   	push   %esi
+  8004f2:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f4:	83 eb 01             	sub    $0x1,%ebx
+  8004f7:	83 c4 10             	add    $0x10,%esp
+  8004fa:	85 db                	test   %ebx,%ebx
+  8004fc:	7f ed                	jg     8004eb <vprintfmt+0x230>
+  8004fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800501:	8b 75 10             	mov    0x10(%ebp),%esi
+  800504:	85 c0                	test   %eax,%eax
+  800506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050b:	0f 49 d0             	cmovns %eax,%edx
+  80050e:	29 d0                	sub    %edx,%eax
+  800510:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800513:	eb 8c                	jmp    8004a1 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	ff 75 0c             	push   0xc(%ebp)
+  80051b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80051e:	09 c2                	or     %eax,%edx
+  800520:	52                   	push   %edx
+  800521:	ff d7                	call   *%edi
+  800523:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800526:	89 d9                	mov    %ebx,%ecx
+  800528:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80052b:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80052f:	0f be d0             	movsbl %al,%edx
+  800532:	85 d2                	test   %edx,%edx
+  800534:	74 2a                	je     800560 <vprintfmt+0x2a5>
+  800536:	85 f6                	test   %esi,%esi
+  800538:	78 05                	js     80053f <vprintfmt+0x284>
+  80053a:	83 ee 01             	sub    $0x1,%esi
+  80053d:	78 3b                	js     80057a <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80053f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800543:	74 d0                	je     800515 <vprintfmt+0x25a>
+  800545:	0f be c0             	movsbl %al,%eax
+  800548:	83 e8 20             	sub    $0x20,%eax
+  80054b:	83 f8 5e             	cmp    $0x5e,%eax
+  80054e:	76 c5                	jbe    800515 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800550:	83 ec 08             	sub    $0x8,%esp
+  800553:	ff 75 0c             	push   0xc(%ebp)
+  800556:	ff 75 cc             	push   -0x34(%ebp)
+  800559:	ff d7                	call   *%edi
+  80055b:	83 c4 10             	add    $0x10,%esp
+  80055e:	eb c6                	jmp    800526 <vprintfmt+0x26b>
+  800560:	8b 75 10             	mov    0x10(%ebp),%esi
+  800563:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800566:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800569:	01 c3                	add    %eax,%ebx
+  80056b:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80056d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800570:	83 c8 20             	or     $0x20,%eax
+  800573:	89 75 10             	mov    %esi,0x10(%ebp)
+  800576:	89 c6                	mov    %eax,%esi
+  800578:	eb 14                	jmp    80058e <vprintfmt+0x2d3>
+  80057a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80057d:	eb e4                	jmp    800563 <vprintfmt+0x2a8>
+  80057f:	83 ec 08             	sub    $0x8,%esp
+  800582:	ff 75 0c             	push   0xc(%ebp)
+  800585:	56                   	push   %esi
+  800586:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800588:	83 eb 01             	sub    $0x1,%ebx
+  80058b:	83 c4 10             	add    $0x10,%esp
+  80058e:	85 db                	test   %ebx,%ebx
+  800590:	7f ed                	jg     80057f <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800592:	8b 75 10             	mov    0x10(%ebp),%esi
+  800595:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800598:	89 45 14             	mov    %eax,0x14(%ebp)
+  80059b:	e9 49 fd ff ff       	jmp    8002e9 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005a0:	83 f9 01             	cmp    $0x1,%ecx
+  8005a3:	7f 1f                	jg     8005c4 <vprintfmt+0x309>
+	else if (lflag)
+  8005a5:	85 c9                	test   %ecx,%ecx
+  8005a7:	74 69                	je     800612 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	8b 00                	mov    (%eax),%eax
+  8005ae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b1:	89 c1                	mov    %eax,%ecx
+  8005b3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c2:	eb 17                	jmp    8005db <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c7:	8b 50 04             	mov    0x4(%eax),%edx
+  8005ca:	8b 00                	mov    (%eax),%eax
+  8005cc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cf:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005db:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005de:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005e6:	85 db                	test   %ebx,%ebx
+  8005e8:	0f 89 f6 00 00 00    	jns    8006e4 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8005ee:	83 ec 08             	sub    $0x8,%esp
+  8005f1:	ff 75 0c             	push   0xc(%ebp)
+  8005f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005f7:	c1 e0 08             	shl    $0x8,%eax
+  8005fa:	83 c8 2d             	or     $0x2d,%eax
+  8005fd:	50                   	push   %eax
+  8005fe:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800600:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800603:	f7 d9                	neg    %ecx
+  800605:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800608:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80060d:	e9 d2 00 00 00       	jmp    8006e4 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800612:	8b 45 14             	mov    0x14(%ebp),%eax
+  800615:	8b 00                	mov    (%eax),%eax
+  800617:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80061a:	89 c1                	mov    %eax,%ecx
+  80061c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80061f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8d 40 04             	lea    0x4(%eax),%eax
+  800628:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062b:	eb ae                	jmp    8005db <vprintfmt+0x320>
+	if (lflag >= 2)
+  80062d:	83 f9 01             	cmp    $0x1,%ecx
+  800630:	7f 19                	jg     80064b <vprintfmt+0x390>
+	else if (lflag)
+  800632:	85 c9                	test   %ecx,%ecx
+  800634:	74 2a                	je     800660 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8b 08                	mov    (%eax),%ecx
+  80063b:	8d 40 04             	lea    0x4(%eax),%eax
+  80063e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800641:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800646:	e9 99 00 00 00       	jmp    8006e4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 08                	mov    (%eax),%ecx
+  800650:	8d 40 08             	lea    0x8(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800656:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80065b:	e9 84 00 00 00       	jmp    8006e4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 08                	mov    (%eax),%ecx
+  800665:	8d 40 04             	lea    0x4(%eax),%eax
+  800668:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066b:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800670:	eb 72                	jmp    8006e4 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800672:	83 f9 01             	cmp    $0x1,%ecx
+  800675:	7f 16                	jg     80068d <vprintfmt+0x3d2>
+	else if (lflag)
+  800677:	85 c9                	test   %ecx,%ecx
+  800679:	74 24                	je     80069f <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 08                	mov    (%eax),%ecx
+  800680:	8d 40 04             	lea    0x4(%eax),%eax
+  800683:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800686:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80068b:	eb 57                	jmp    8006e4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8b 08                	mov    (%eax),%ecx
+  800692:	8d 40 08             	lea    0x8(%eax),%eax
+  800695:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800698:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80069d:	eb 45                	jmp    8006e4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80069f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a2:	8b 08                	mov    (%eax),%ecx
+  8006a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006aa:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006af:	eb 33                	jmp    8006e4 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006b1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006b4:	c1 e3 08             	shl    $0x8,%ebx
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	ff 75 0c             	push   0xc(%ebp)
+  8006bd:	89 d8                	mov    %ebx,%eax
+  8006bf:	83 c8 30             	or     $0x30,%eax
+  8006c2:	50                   	push   %eax
+  8006c3:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006c5:	83 c4 08             	add    $0x8,%esp
+  8006c8:	ff 75 0c             	push   0xc(%ebp)
+  8006cb:	83 cb 78             	or     $0x78,%ebx
+  8006ce:	53                   	push   %ebx
+  8006cf:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006d6:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006df:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8006e7:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006eb:	52                   	push   %edx
+  8006ec:	ff 75 e0             	push   -0x20(%ebp)
+  8006ef:	50                   	push   %eax
+  8006f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006f3:	89 f8                	mov    %edi,%eax
+  8006f5:	e8 f7 fa ff ff       	call   8001f1 <printnum>
+			break;
+  8006fa:	83 c4 10             	add    $0x10,%esp
+  8006fd:	e9 e7 fb ff ff       	jmp    8002e9 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800702:	83 f9 01             	cmp    $0x1,%ecx
+  800705:	7f 16                	jg     80071d <vprintfmt+0x462>
+	else if (lflag)
+  800707:	85 c9                	test   %ecx,%ecx
+  800709:	74 24                	je     80072f <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80070b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070e:	8b 08                	mov    (%eax),%ecx
+  800710:	8d 40 04             	lea    0x4(%eax),%eax
+  800713:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800716:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80071b:	eb c7                	jmp    8006e4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 08                	mov    (%eax),%ecx
+  800722:	8d 40 08             	lea    0x8(%eax),%eax
+  800725:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800728:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80072d:	eb b5                	jmp    8006e4 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80072f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800732:	8b 08                	mov    (%eax),%ecx
+  800734:	8d 40 04             	lea    0x4(%eax),%eax
+  800737:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073a:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80073f:	eb a3                	jmp    8006e4 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800741:	83 ec 08             	sub    $0x8,%esp
+  800744:	ff 75 0c             	push   0xc(%ebp)
+  800747:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80074a:	c1 e0 08             	shl    $0x8,%eax
+  80074d:	83 c8 25             	or     $0x25,%eax
+  800750:	50                   	push   %eax
+  800751:	ff d7                	call   *%edi
+			break;
+  800753:	83 c4 10             	add    $0x10,%esp
+  800756:	e9 8e fb ff ff       	jmp    8002e9 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80075b:	83 ec 08             	sub    $0x8,%esp
+  80075e:	ff 75 0c             	push   0xc(%ebp)
+  800761:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800764:	c1 e0 08             	shl    $0x8,%eax
+  800767:	83 c8 25             	or     $0x25,%eax
+  80076a:	50                   	push   %eax
+  80076b:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80076d:	83 c4 10             	add    $0x10,%esp
+  800770:	89 de                	mov    %ebx,%esi
+  800772:	eb 03                	jmp    800777 <vprintfmt+0x4bc>
+  800774:	83 ee 01             	sub    $0x1,%esi
+  800777:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80077b:	75 f7                	jne    800774 <vprintfmt+0x4b9>
+  80077d:	e9 67 fb ff ff       	jmp    8002e9 <vprintfmt+0x2e>
+
+00800782 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800782:	55                   	push   %ebp
+  800783:	89 e5                	mov    %esp,%ebp
+  800785:	83 ec 18             	sub    $0x18,%esp
+  800788:	8b 45 08             	mov    0x8(%ebp),%eax
+  80078b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80078e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800791:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800795:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800798:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80079f:	85 c0                	test   %eax,%eax
+  8007a1:	74 26                	je     8007c9 <vsnprintf+0x47>
+  8007a3:	85 d2                	test   %edx,%edx
+  8007a5:	7e 22                	jle    8007c9 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007a7:	ff 75 14             	push   0x14(%ebp)
+  8007aa:	ff 75 10             	push   0x10(%ebp)
+  8007ad:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007b0:	50                   	push   %eax
+  8007b1:	68 81 02 80 00       	push   $0x800281
+  8007b6:	e8 00 fb ff ff       	call   8002bb <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007be:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007c4:	83 c4 10             	add    $0x10,%esp
+}
+  8007c7:	c9                   	leave
+  8007c8:	c3                   	ret
+		return -E_INVAL;
+  8007c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ce:	eb f7                	jmp    8007c7 <vsnprintf+0x45>
+
+008007d0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007d6:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d9:	50                   	push   %eax
+  8007da:	ff 75 10             	push   0x10(%ebp)
+  8007dd:	ff 75 0c             	push   0xc(%ebp)
+  8007e0:	ff 75 08             	push   0x8(%ebp)
+  8007e3:	e8 9a ff ff ff       	call   800782 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007e8:	c9                   	leave
+  8007e9:	c3                   	ret
+
+008007ea <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007ea:	55                   	push   %ebp
+  8007eb:	89 e5                	mov    %esp,%ebp
+  8007ed:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f5:	eb 03                	jmp    8007fa <strlen+0x10>
+		n++;
+  8007f7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007fa:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007fe:	75 f7                	jne    8007f7 <strlen+0xd>
+	return n;
+}
+  800800:	5d                   	pop    %ebp
+  800801:	c3                   	ret
+
+00800802 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800808:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	eb 03                	jmp    800815 <strnlen+0x13>
+		n++;
+  800812:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800815:	39 d0                	cmp    %edx,%eax
+  800817:	74 08                	je     800821 <strnlen+0x1f>
+  800819:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80081d:	75 f3                	jne    800812 <strnlen+0x10>
+  80081f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800821:	89 d0                	mov    %edx,%eax
+  800823:	5d                   	pop    %ebp
+  800824:	c3                   	ret
+
+00800825 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800825:	55                   	push   %ebp
+  800826:	89 e5                	mov    %esp,%ebp
+  800828:	53                   	push   %ebx
+  800829:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80082c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80082f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800834:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800838:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80083b:	83 c0 01             	add    $0x1,%eax
+  80083e:	84 d2                	test   %dl,%dl
+  800840:	75 f2                	jne    800834 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800842:	89 c8                	mov    %ecx,%eax
+  800844:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800847:	c9                   	leave
+  800848:	c3                   	ret
+
+00800849 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	53                   	push   %ebx
+  80084d:	83 ec 10             	sub    $0x10,%esp
+  800850:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800853:	53                   	push   %ebx
+  800854:	e8 91 ff ff ff       	call   8007ea <strlen>
+  800859:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80085c:	ff 75 0c             	push   0xc(%ebp)
+  80085f:	01 d8                	add    %ebx,%eax
+  800861:	50                   	push   %eax
+  800862:	e8 be ff ff ff       	call   800825 <strcpy>
+	return dst;
+}
+  800867:	89 d8                	mov    %ebx,%eax
+  800869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086c:	c9                   	leave
+  80086d:	c3                   	ret
+
+0080086e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80086e:	55                   	push   %ebp
+  80086f:	89 e5                	mov    %esp,%ebp
+  800871:	56                   	push   %esi
+  800872:	53                   	push   %ebx
+  800873:	8b 75 08             	mov    0x8(%ebp),%esi
+  800876:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800879:	89 f3                	mov    %esi,%ebx
+  80087b:	03 5d 10             	add    0x10(%ebp),%ebx
+  80087e:	89 f0                	mov    %esi,%eax
+  800880:	eb 0f                	jmp    800891 <strncpy+0x23>
+		*dst++ = *src;
+  800882:	83 c0 01             	add    $0x1,%eax
+  800885:	0f b6 0a             	movzbl (%edx),%ecx
+  800888:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80088b:	80 f9 01             	cmp    $0x1,%cl
+  80088e:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800891:	39 d8                	cmp    %ebx,%eax
+  800893:	75 ed                	jne    800882 <strncpy+0x14>
+	}
+	return ret;
+}
+  800895:	89 f0                	mov    %esi,%eax
+  800897:	5b                   	pop    %ebx
+  800898:	5e                   	pop    %esi
+  800899:	5d                   	pop    %ebp
+  80089a:	c3                   	ret
+
+0080089b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80089b:	55                   	push   %ebp
+  80089c:	89 e5                	mov    %esp,%ebp
+  80089e:	56                   	push   %esi
+  80089f:	53                   	push   %ebx
+  8008a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a6:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a9:	89 f0                	mov    %esi,%eax
+  8008ab:	85 d2                	test   %edx,%edx
+  8008ad:	74 21                	je     8008d0 <strlcpy+0x35>
+  8008af:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008b3:	89 f2                	mov    %esi,%edx
+  8008b5:	eb 09                	jmp    8008c0 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008b7:	83 c1 01             	add    $0x1,%ecx
+  8008ba:	83 c2 01             	add    $0x1,%edx
+  8008bd:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008c0:	39 c2                	cmp    %eax,%edx
+  8008c2:	74 09                	je     8008cd <strlcpy+0x32>
+  8008c4:	0f b6 19             	movzbl (%ecx),%ebx
+  8008c7:	84 db                	test   %bl,%bl
+  8008c9:	75 ec                	jne    8008b7 <strlcpy+0x1c>
+  8008cb:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008cd:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008d0:	29 f0                	sub    %esi,%eax
+}
+  8008d2:	5b                   	pop    %ebx
+  8008d3:	5e                   	pop    %esi
+  8008d4:	5d                   	pop    %ebp
+  8008d5:	c3                   	ret
+
+008008d6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008d6:	55                   	push   %ebp
+  8008d7:	89 e5                	mov    %esp,%ebp
+  8008d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008df:	eb 06                	jmp    8008e7 <strcmp+0x11>
+		p++, q++;
+  8008e1:	83 c1 01             	add    $0x1,%ecx
+  8008e4:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008e7:	0f b6 01             	movzbl (%ecx),%eax
+  8008ea:	84 c0                	test   %al,%al
+  8008ec:	74 04                	je     8008f2 <strcmp+0x1c>
+  8008ee:	3a 02                	cmp    (%edx),%al
+  8008f0:	74 ef                	je     8008e1 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008f2:	0f b6 c0             	movzbl %al,%eax
+  8008f5:	0f b6 12             	movzbl (%edx),%edx
+  8008f8:	29 d0                	sub    %edx,%eax
+}
+  8008fa:	5d                   	pop    %ebp
+  8008fb:	c3                   	ret
+
+008008fc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008fc:	55                   	push   %ebp
+  8008fd:	89 e5                	mov    %esp,%ebp
+  8008ff:	53                   	push   %ebx
+  800900:	8b 45 08             	mov    0x8(%ebp),%eax
+  800903:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800906:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800909:	eb 09                	jmp    800914 <strncmp+0x18>
+		n--, p++, q++;
+  80090b:	83 ea 01             	sub    $0x1,%edx
+  80090e:	83 c0 01             	add    $0x1,%eax
+  800911:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800914:	85 d2                	test   %edx,%edx
+  800916:	74 18                	je     800930 <strncmp+0x34>
+  800918:	0f b6 18             	movzbl (%eax),%ebx
+  80091b:	84 db                	test   %bl,%bl
+  80091d:	74 04                	je     800923 <strncmp+0x27>
+  80091f:	3a 19                	cmp    (%ecx),%bl
+  800921:	74 e8                	je     80090b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800923:	0f b6 00             	movzbl (%eax),%eax
+  800926:	0f b6 11             	movzbl (%ecx),%edx
+  800929:	29 d0                	sub    %edx,%eax
+}
+  80092b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092e:	c9                   	leave
+  80092f:	c3                   	ret
+		return 0;
+  800930:	b8 00 00 00 00       	mov    $0x0,%eax
+  800935:	eb f4                	jmp    80092b <strncmp+0x2f>
+
+00800937 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800941:	eb 03                	jmp    800946 <strchr+0xf>
+  800943:	83 c0 01             	add    $0x1,%eax
+  800946:	0f b6 10             	movzbl (%eax),%edx
+  800949:	84 d2                	test   %dl,%dl
+  80094b:	74 06                	je     800953 <strchr+0x1c>
+		if (*s == c)
+  80094d:	38 ca                	cmp    %cl,%dl
+  80094f:	75 f2                	jne    800943 <strchr+0xc>
+  800951:	eb 05                	jmp    800958 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800953:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800958:	5d                   	pop    %ebp
+  800959:	c3                   	ret
+
+0080095a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80095a:	55                   	push   %ebp
+  80095b:	89 e5                	mov    %esp,%ebp
+  80095d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800960:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800964:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800967:	38 ca                	cmp    %cl,%dl
+  800969:	74 09                	je     800974 <strfind+0x1a>
+  80096b:	84 d2                	test   %dl,%dl
+  80096d:	74 05                	je     800974 <strfind+0x1a>
+	for (; *s; s++)
+  80096f:	83 c0 01             	add    $0x1,%eax
+  800972:	eb f0                	jmp    800964 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800974:	5d                   	pop    %ebp
+  800975:	c3                   	ret
+
+00800976 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	57                   	push   %edi
+  80097a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80097d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800980:	85 c9                	test   %ecx,%ecx
+  800982:	74 20                	je     8009a4 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800984:	89 f8                	mov    %edi,%eax
+  800986:	09 c8                	or     %ecx,%eax
+  800988:	a8 03                	test   $0x3,%al
+  80098a:	75 12                	jne    80099e <memset+0x28>
+		c &= 0xFF;
+  80098c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800990:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800996:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800999:	fc                   	cld
+  80099a:	f3 ab                	rep stos %eax,%es:(%edi)
+  80099c:	eb 06                	jmp    8009a4 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80099e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009a1:	fc                   	cld
+  8009a2:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009a4:	89 f8                	mov    %edi,%eax
+  8009a6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a9:	c9                   	leave
+  8009aa:	c3                   	ret
+
+008009ab <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009ab:	55                   	push   %ebp
+  8009ac:	89 e5                	mov    %esp,%ebp
+  8009ae:	57                   	push   %edi
+  8009af:	56                   	push   %esi
+  8009b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009b6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b9:	39 c6                	cmp    %eax,%esi
+  8009bb:	73 32                	jae    8009ef <memmove+0x44>
+  8009bd:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009c0:	39 d0                	cmp    %edx,%eax
+  8009c2:	73 2b                	jae    8009ef <memmove+0x44>
+		s += n;
+		d += n;
+  8009c4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c7:	89 d6                	mov    %edx,%esi
+  8009c9:	09 fe                	or     %edi,%esi
+  8009cb:	09 ce                	or     %ecx,%esi
+  8009cd:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009d3:	75 0e                	jne    8009e3 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009d5:	83 ef 04             	sub    $0x4,%edi
+  8009d8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009db:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009de:	fd                   	std
+  8009df:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e1:	eb 09                	jmp    8009ec <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009e3:	83 ef 01             	sub    $0x1,%edi
+  8009e6:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e9:	fd                   	std
+  8009ea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009ec:	fc                   	cld
+  8009ed:	eb 1a                	jmp    800a09 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ef:	89 f2                	mov    %esi,%edx
+  8009f1:	09 c2                	or     %eax,%edx
+  8009f3:	09 ca                	or     %ecx,%edx
+  8009f5:	f6 c2 03             	test   $0x3,%dl
+  8009f8:	75 0a                	jne    800a04 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009fa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009fd:	89 c7                	mov    %eax,%edi
+  8009ff:	fc                   	cld
+  800a00:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a02:	eb 05                	jmp    800a09 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a04:	89 c7                	mov    %eax,%edi
+  800a06:	fc                   	cld
+  800a07:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a09:	5e                   	pop    %esi
+  800a0a:	5f                   	pop    %edi
+  800a0b:	5d                   	pop    %ebp
+  800a0c:	c3                   	ret
+
+00800a0d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a13:	ff 75 10             	push   0x10(%ebp)
+  800a16:	ff 75 0c             	push   0xc(%ebp)
+  800a19:	ff 75 08             	push   0x8(%ebp)
+  800a1c:	e8 8a ff ff ff       	call   8009ab <memmove>
+}
+  800a21:	c9                   	leave
+  800a22:	c3                   	ret
+
+00800a23 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	56                   	push   %esi
+  800a27:	53                   	push   %ebx
+  800a28:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a2e:	89 c6                	mov    %eax,%esi
+  800a30:	03 75 10             	add    0x10(%ebp),%esi
+  800a33:	eb 06                	jmp    800a3b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a35:	83 c0 01             	add    $0x1,%eax
+  800a38:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a3b:	39 f0                	cmp    %esi,%eax
+  800a3d:	74 14                	je     800a53 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a3f:	0f b6 08             	movzbl (%eax),%ecx
+  800a42:	0f b6 1a             	movzbl (%edx),%ebx
+  800a45:	38 d9                	cmp    %bl,%cl
+  800a47:	74 ec                	je     800a35 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a49:	0f b6 c1             	movzbl %cl,%eax
+  800a4c:	0f b6 db             	movzbl %bl,%ebx
+  800a4f:	29 d8                	sub    %ebx,%eax
+  800a51:	eb 05                	jmp    800a58 <memcmp+0x35>
+	}
+
+	return 0;
+  800a53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a58:	5b                   	pop    %ebx
+  800a59:	5e                   	pop    %esi
+  800a5a:	5d                   	pop    %ebp
+  800a5b:	c3                   	ret
+
+00800a5c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a65:	89 c2                	mov    %eax,%edx
+  800a67:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a6a:	eb 03                	jmp    800a6f <memfind+0x13>
+  800a6c:	83 c0 01             	add    $0x1,%eax
+  800a6f:	39 d0                	cmp    %edx,%eax
+  800a71:	73 04                	jae    800a77 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a73:	38 08                	cmp    %cl,(%eax)
+  800a75:	75 f5                	jne    800a6c <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a77:	5d                   	pop    %ebp
+  800a78:	c3                   	ret
+
+00800a79 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a79:	55                   	push   %ebp
+  800a7a:	89 e5                	mov    %esp,%ebp
+  800a7c:	57                   	push   %edi
+  800a7d:	56                   	push   %esi
+  800a7e:	53                   	push   %ebx
+  800a7f:	83 ec 1c             	sub    $0x1c,%esp
+  800a82:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a85:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a88:	eb 03                	jmp    800a8d <strtol+0x14>
+		s++;
+  800a8a:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800a8d:	0f b6 06             	movzbl (%esi),%eax
+  800a90:	3c 20                	cmp    $0x20,%al
+  800a92:	74 f6                	je     800a8a <strtol+0x11>
+  800a94:	3c 09                	cmp    $0x9,%al
+  800a96:	74 f2                	je     800a8a <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a98:	3c 2b                	cmp    $0x2b,%al
+  800a9a:	74 43                	je     800adf <strtol+0x66>
+	int neg = 0;
+  800a9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800aa1:	3c 2d                	cmp    $0x2d,%al
+  800aa3:	74 44                	je     800ae9 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa5:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800aab:	75 0f                	jne    800abc <strtol+0x43>
+  800aad:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ab0:	74 41                	je     800af3 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ab2:	85 ff                	test   %edi,%edi
+  800ab4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab9:	0f 44 f8             	cmove  %eax,%edi
+  800abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800ac6:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ac9:	89 fb                	mov    %edi,%ebx
+  800acb:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ace:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ad1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ad4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ad7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800ada:	89 75 08             	mov    %esi,0x8(%ebp)
+  800add:	eb 67                	jmp    800b46 <strtol+0xcd>
+		s++;
+  800adf:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800ae2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae7:	eb bc                	jmp    800aa5 <strtol+0x2c>
+		s++, neg = 1;
+  800ae9:	83 c6 01             	add    $0x1,%esi
+  800aec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800af1:	eb b2                	jmp    800aa5 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800af3:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800af7:	74 0e                	je     800b07 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800af9:	85 ff                	test   %edi,%edi
+  800afb:	75 bf                	jne    800abc <strtol+0x43>
+		s++, base = 8;
+  800afd:	83 c6 01             	add    $0x1,%esi
+  800b00:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b05:	eb b5                	jmp    800abc <strtol+0x43>
+		s += 2, base = 16;
+  800b07:	83 c6 02             	add    $0x2,%esi
+  800b0a:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b0f:	eb ab                	jmp    800abc <strtol+0x43>
+			dig = *s - '0';
+  800b11:	0f be c9             	movsbl %cl,%ecx
+  800b14:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b17:	39 f9                	cmp    %edi,%ecx
+  800b19:	7d 59                	jge    800b74 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b1b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b1f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b22:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b25:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b28:	0f af d8             	imul   %eax,%ebx
+  800b2b:	0f af d7             	imul   %edi,%edx
+  800b2e:	01 d3                	add    %edx,%ebx
+  800b30:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b33:	f7 e7                	mul    %edi
+  800b35:	01 da                	add    %ebx,%edx
+  800b37:	89 cb                	mov    %ecx,%ebx
+  800b39:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b3c:	01 c8                	add    %ecx,%eax
+  800b3e:	11 da                	adc    %ebx,%edx
+  800b40:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b43:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b46:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b49:	0f b6 08             	movzbl (%eax),%ecx
+  800b4c:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b4f:	80 fb 09             	cmp    $0x9,%bl
+  800b52:	76 bd                	jbe    800b11 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b54:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b57:	80 fb 19             	cmp    $0x19,%bl
+  800b5a:	77 08                	ja     800b64 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b5c:	0f be c9             	movsbl %cl,%ecx
+  800b5f:	83 e9 57             	sub    $0x57,%ecx
+  800b62:	eb b3                	jmp    800b17 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b64:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b67:	80 fb 19             	cmp    $0x19,%bl
+  800b6a:	77 08                	ja     800b74 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b6c:	0f be c9             	movsbl %cl,%ecx
+  800b6f:	83 e9 37             	sub    $0x37,%ecx
+  800b72:	eb a3                	jmp    800b17 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b74:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b77:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b7a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b7d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b80:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b84:	74 05                	je     800b8b <strtol+0x112>
+		*endptr = (char *) s;
+  800b86:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b89:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800b8b:	85 c9                	test   %ecx,%ecx
+  800b8d:	74 07                	je     800b96 <strtol+0x11d>
+  800b8f:	f7 d8                	neg    %eax
+  800b91:	83 d2 00             	adc    $0x0,%edx
+  800b94:	f7 da                	neg    %edx
+}
+  800b96:	83 c4 1c             	add    $0x1c,%esp
+  800b99:	5b                   	pop    %ebx
+  800b9a:	5e                   	pop    %esi
+  800b9b:	5f                   	pop    %edi
+  800b9c:	5d                   	pop    %ebp
+  800b9d:	c3                   	ret
+
+00800b9e <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b9e:	55                   	push   %ebp
+  800b9f:	89 e5                	mov    %esp,%ebp
+  800ba1:	57                   	push   %edi
+  800ba2:	56                   	push   %esi
+  800ba3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ba4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bab:	74 18                	je     800bc5 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb8:	89 c3                	mov    %eax,%ebx
+  800bba:	89 c7                	mov    %eax,%edi
+  800bbc:	89 c6                	mov    %eax,%esi
+  800bbe:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bc0:	5b                   	pop    %ebx
+  800bc1:	5e                   	pop    %esi
+  800bc2:	5f                   	pop    %edi
+  800bc3:	5d                   	pop    %ebp
+  800bc4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd0:	89 c3                	mov    %eax,%ebx
+  800bd2:	89 c7                	mov    %eax,%edi
+  800bd4:	55                   	push   %ebp
+  800bd5:	89 e5                	mov    %esp,%ebp
+  800bd7:	8d 35 df 0b 80 00    	lea    0x800bdf,%esi
+  800bdd:	0f 34                	sysenter
+  800bdf:	5d                   	pop    %ebp
+		goto out;
+  800be0:	eb de                	jmp    800bc0 <sys_cputs+0x22>
+
+00800be2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	57                   	push   %edi
+  800be6:	56                   	push   %esi
+  800be7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800be8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bef:	74 19                	je     800c0a <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800bf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bfb:	89 d1                	mov    %edx,%ecx
+  800bfd:	89 d3                	mov    %edx,%ebx
+  800bff:	89 d7                	mov    %edx,%edi
+  800c01:	89 d6                	mov    %edx,%esi
+  800c03:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c05:	5b                   	pop    %ebx
+  800c06:	5e                   	pop    %esi
+  800c07:	5f                   	pop    %edi
+  800c08:	5d                   	pop    %ebp
+  800c09:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c14:	89 d1                	mov    %edx,%ecx
+  800c16:	89 d3                	mov    %edx,%ebx
+  800c18:	89 d7                	mov    %edx,%edi
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	8d 35 25 0c 80 00    	lea    0x800c25,%esi
+  800c23:	0f 34                	sysenter
+  800c25:	5d                   	pop    %ebp
+		goto out;
+  800c26:	eb dd                	jmp    800c05 <sys_cgetc+0x23>
+
+00800c28 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	57                   	push   %edi
+  800c2c:	56                   	push   %esi
+  800c2d:	53                   	push   %ebx
+  800c2e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c31:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c38:	74 21                	je     800c5b <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c47:	89 cb                	mov    %ecx,%ebx
+  800c49:	89 cf                	mov    %ecx,%edi
+  800c4b:	89 ce                	mov    %ecx,%esi
+  800c4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c4f:	85 c0                	test   %eax,%eax
+  800c51:	7f 27                	jg     800c7a <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5f                   	pop    %edi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c63:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c68:	89 cb                	mov    %ecx,%ebx
+  800c6a:	89 cf                	mov    %ecx,%edi
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	8d 35 77 0c 80 00    	lea    0x800c77,%esi
+  800c75:	0f 34                	sysenter
+  800c77:	5d                   	pop    %ebp
+		goto out;
+  800c78:	eb d5                	jmp    800c4f <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c7a:	83 ec 0c             	sub    $0xc,%esp
+  800c7d:	50                   	push   %eax
+  800c7e:	6a 03                	push   $0x3
+  800c80:	68 cb 2e 80 00       	push   $0x802ecb
+  800c85:	6a 3f                	push   $0x3f
+  800c87:	68 e8 2e 80 00       	push   $0x802ee8
+  800c8c:	e8 71 f4 ff ff       	call   800102 <_panic>
+
+00800c91 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	57                   	push   %edi
+  800c95:	56                   	push   %esi
+  800c96:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c97:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c9e:	74 19                	je     800cb9 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800ca0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800caa:	89 d1                	mov    %edx,%ecx
+  800cac:	89 d3                	mov    %edx,%ebx
+  800cae:	89 d7                	mov    %edx,%edi
+  800cb0:	89 d6                	mov    %edx,%esi
+  800cb2:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cb4:	5b                   	pop    %ebx
+  800cb5:	5e                   	pop    %esi
+  800cb6:	5f                   	pop    %edi
+  800cb7:	5d                   	pop    %ebp
+  800cb8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbe:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cc3:	89 d1                	mov    %edx,%ecx
+  800cc5:	89 d3                	mov    %edx,%ebx
+  800cc7:	89 d7                	mov    %edx,%edi
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	8d 35 d4 0c 80 00    	lea    0x800cd4,%esi
+  800cd2:	0f 34                	sysenter
+  800cd4:	5d                   	pop    %ebp
+		goto out;
+  800cd5:	eb dd                	jmp    800cb4 <sys_getenvid+0x23>
+
+00800cd7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	57                   	push   %edi
+  800cdb:	56                   	push   %esi
+  800cdc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cdd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ce4:	74 19                	je     800cff <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ceb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf0:	89 d1                	mov    %edx,%ecx
+  800cf2:	89 d3                	mov    %edx,%ebx
+  800cf4:	89 d7                	mov    %edx,%edi
+  800cf6:	89 d6                	mov    %edx,%esi
+  800cf8:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cfa:	5b                   	pop    %ebx
+  800cfb:	5e                   	pop    %esi
+  800cfc:	5f                   	pop    %edi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d04:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d09:	89 d1                	mov    %edx,%ecx
+  800d0b:	89 d3                	mov    %edx,%ebx
+  800d0d:	89 d7                	mov    %edx,%edi
+  800d0f:	55                   	push   %ebp
+  800d10:	89 e5                	mov    %esp,%ebp
+  800d12:	8d 35 1a 0d 80 00    	lea    0x800d1a,%esi
+  800d18:	0f 34                	sysenter
+  800d1a:	5d                   	pop    %ebp
+		goto out;
+  800d1b:	eb dd                	jmp    800cfa <sys_yield+0x23>
+
+00800d1d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+  800d23:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d26:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d2d:	74 23                	je     800d52 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d2f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d34:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d42:	89 f7                	mov    %esi,%edi
+  800d44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d46:	85 c0                	test   %eax,%eax
+  800d48:	7f 29                	jg     800d73 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4d:	5b                   	pop    %ebx
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5f                   	pop    %edi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d58:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	8d 35 70 0d 80 00    	lea    0x800d70,%esi
+  800d6e:	0f 34                	sysenter
+  800d70:	5d                   	pop    %ebp
+		goto out;
+  800d71:	eb d3                	jmp    800d46 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+  800d76:	50                   	push   %eax
+  800d77:	6a 04                	push   $0x4
+  800d79:	68 cb 2e 80 00       	push   $0x802ecb
+  800d7e:	6a 3f                	push   $0x3f
+  800d80:	68 e8 2e 80 00       	push   $0x802ee8
+  800d85:	e8 78 f3 ff ff       	call   800102 <_panic>
+
+00800d8a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	57                   	push   %edi
+  800d8e:	56                   	push   %esi
+  800d8f:	53                   	push   %ebx
+  800d90:	83 ec 0c             	sub    $0xc,%esp
+  800d93:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800d96:	85 f6                	test   %esi,%esi
+  800d98:	75 09                	jne    800da3 <sys_page_map+0x19>
+  800d9a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800da1:	74 1f                	je     800dc2 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800da3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800da8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db6:	85 c0                	test   %eax,%eax
+  800db8:	7f 27                	jg     800de1 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5f                   	pop    %edi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	8d 35 de 0d 80 00    	lea    0x800dde,%esi
+  800ddc:	0f 34                	sysenter
+  800dde:	5d                   	pop    %ebp
+		goto out;
+  800ddf:	eb d5                	jmp    800db6 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de1:	83 ec 0c             	sub    $0xc,%esp
+  800de4:	50                   	push   %eax
+  800de5:	6a 05                	push   $0x5
+  800de7:	68 cb 2e 80 00       	push   $0x802ecb
+  800dec:	6a 3f                	push   $0x3f
+  800dee:	68 e8 2e 80 00       	push   $0x802ee8
+  800df3:	e8 0a f3 ff ff       	call   800102 <_panic>
+
+00800df8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	57                   	push   %edi
+  800dfc:	56                   	push   %esi
+  800dfd:	53                   	push   %ebx
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e01:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e08:	74 22                	je     800e2c <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	89 df                	mov    %ebx,%edi
+  800e1c:	89 de                	mov    %ebx,%esi
+  800e1e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e20:	85 c0                	test   %eax,%eax
+  800e22:	7f 28                	jg     800e4c <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e27:	5b                   	pop    %ebx
+  800e28:	5e                   	pop    %esi
+  800e29:	5f                   	pop    %edi
+  800e2a:	5d                   	pop    %ebp
+  800e2b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e3c:	89 df                	mov    %ebx,%edi
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	8d 35 49 0e 80 00    	lea    0x800e49,%esi
+  800e47:	0f 34                	sysenter
+  800e49:	5d                   	pop    %ebp
+		goto out;
+  800e4a:	eb d4                	jmp    800e20 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+  800e4f:	50                   	push   %eax
+  800e50:	6a 06                	push   $0x6
+  800e52:	68 cb 2e 80 00       	push   $0x802ecb
+  800e57:	6a 3f                	push   $0x3f
+  800e59:	68 e8 2e 80 00       	push   $0x802ee8
+  800e5e:	e8 9f f2 ff ff       	call   800102 <_panic>
+
+00800e63 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+  800e69:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e6c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e73:	74 22                	je     800e97 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e85:	89 df                	mov    %ebx,%edi
+  800e87:	89 de                	mov    %ebx,%esi
+  800e89:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8b:	85 c0                	test   %eax,%eax
+  800e8d:	7f 28                	jg     800eb7 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e92:	5b                   	pop    %ebx
+  800e93:	5e                   	pop    %esi
+  800e94:	5f                   	pop    %edi
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea2:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ea7:	89 df                	mov    %ebx,%edi
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	8d 35 b4 0e 80 00    	lea    0x800eb4,%esi
+  800eb2:	0f 34                	sysenter
+  800eb4:	5d                   	pop    %ebp
+		goto out;
+  800eb5:	eb d4                	jmp    800e8b <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+  800eba:	50                   	push   %eax
+  800ebb:	6a 08                	push   $0x8
+  800ebd:	68 cb 2e 80 00       	push   $0x802ecb
+  800ec2:	6a 3f                	push   $0x3f
+  800ec4:	68 e8 2e 80 00       	push   $0x802ee8
+  800ec9:	e8 34 f2 ff ff       	call   800102 <_panic>
+
+00800ece <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ed7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ede:	74 22                	je     800f02 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ee0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee5:	b8 09 00 00 00       	mov    $0x9,%eax
+  800eea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef0:	89 df                	mov    %ebx,%edi
+  800ef2:	89 de                	mov    %ebx,%esi
+  800ef4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef6:	85 c0                	test   %eax,%eax
+  800ef8:	7f 28                	jg     800f22 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800efa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efd:	5b                   	pop    %ebx
+  800efe:	5e                   	pop    %esi
+  800eff:	5f                   	pop    %edi
+  800f00:	5d                   	pop    %ebp
+  800f01:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f12:	89 df                	mov    %ebx,%edi
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	8d 35 1f 0f 80 00    	lea    0x800f1f,%esi
+  800f1d:	0f 34                	sysenter
+  800f1f:	5d                   	pop    %ebp
+		goto out;
+  800f20:	eb d4                	jmp    800ef6 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f22:	83 ec 0c             	sub    $0xc,%esp
+  800f25:	50                   	push   %eax
+  800f26:	6a 09                	push   $0x9
+  800f28:	68 cb 2e 80 00       	push   $0x802ecb
+  800f2d:	6a 3f                	push   $0x3f
+  800f2f:	68 e8 2e 80 00       	push   $0x802ee8
+  800f34:	e8 c9 f1 ff ff       	call   800102 <_panic>
+
+00800f39 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	56                   	push   %esi
+  800f3e:	53                   	push   %ebx
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f42:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f49:	74 22                	je     800f6d <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f50:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5b:	89 df                	mov    %ebx,%edi
+  800f5d:	89 de                	mov    %ebx,%esi
+  800f5f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f61:	85 c0                	test   %eax,%eax
+  800f63:	7f 28                	jg     800f8d <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f68:	5b                   	pop    %ebx
+  800f69:	5e                   	pop    %esi
+  800f6a:	5f                   	pop    %edi
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f78:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f7d:	89 df                	mov    %ebx,%edi
+  800f7f:	55                   	push   %ebp
+  800f80:	89 e5                	mov    %esp,%ebp
+  800f82:	8d 35 8a 0f 80 00    	lea    0x800f8a,%esi
+  800f88:	0f 34                	sysenter
+  800f8a:	5d                   	pop    %ebp
+		goto out;
+  800f8b:	eb d4                	jmp    800f61 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8d:	83 ec 0c             	sub    $0xc,%esp
+  800f90:	50                   	push   %eax
+  800f91:	6a 0a                	push   $0xa
+  800f93:	68 cb 2e 80 00       	push   $0x802ecb
+  800f98:	6a 3f                	push   $0x3f
+  800f9a:	68 e8 2e 80 00       	push   $0x802ee8
+  800f9f:	e8 5e f1 ff ff       	call   800102 <_panic>
+
+00800fa4 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	57                   	push   %edi
+  800fa8:	56                   	push   %esi
+  800fa9:	53                   	push   %ebx
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fad:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fb4:	74 22                	je     800fd8 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbb:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc6:	89 df                	mov    %ebx,%edi
+  800fc8:	89 de                	mov    %ebx,%esi
+  800fca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fcc:	85 c0                	test   %eax,%eax
+  800fce:	7f 28                	jg     800ff8 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd3:	5b                   	pop    %ebx
+  800fd4:	5e                   	pop    %esi
+  800fd5:	5f                   	pop    %edi
+  800fd6:	5d                   	pop    %ebp
+  800fd7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe3:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fe8:	89 df                	mov    %ebx,%edi
+  800fea:	55                   	push   %ebp
+  800feb:	89 e5                	mov    %esp,%ebp
+  800fed:	8d 35 f5 0f 80 00    	lea    0x800ff5,%esi
+  800ff3:	0f 34                	sysenter
+  800ff5:	5d                   	pop    %ebp
+		goto out;
+  800ff6:	eb d4                	jmp    800fcc <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff8:	83 ec 0c             	sub    $0xc,%esp
+  800ffb:	50                   	push   %eax
+  800ffc:	6a 17                	push   $0x17
+  800ffe:	68 cb 2e 80 00       	push   $0x802ecb
+  801003:	6a 3f                	push   $0x3f
+  801005:	68 e8 2e 80 00       	push   $0x802ee8
+  80100a:	e8 f3 f0 ff ff       	call   800102 <_panic>
+
+0080100f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+  801015:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801018:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80101f:	74 22                	je     801043 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801021:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801026:	b8 18 00 00 00       	mov    $0x18,%eax
+  80102b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801031:	89 df                	mov    %ebx,%edi
+  801033:	89 de                	mov    %ebx,%esi
+  801035:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801037:	85 c0                	test   %eax,%eax
+  801039:	7f 28                	jg     801063 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80103b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103e:	5b                   	pop    %ebx
+  80103f:	5e                   	pop    %esi
+  801040:	5f                   	pop    %edi
+  801041:	5d                   	pop    %ebp
+  801042:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801043:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801048:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801053:	89 df                	mov    %ebx,%edi
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	8d 35 60 10 80 00    	lea    0x801060,%esi
+  80105e:	0f 34                	sysenter
+  801060:	5d                   	pop    %ebp
+		goto out;
+  801061:	eb d4                	jmp    801037 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801063:	83 ec 0c             	sub    $0xc,%esp
+  801066:	50                   	push   %eax
+  801067:	6a 18                	push   $0x18
+  801069:	68 cb 2e 80 00       	push   $0x802ecb
+  80106e:	6a 3f                	push   $0x3f
+  801070:	68 e8 2e 80 00       	push   $0x802ee8
+  801075:	e8 88 f0 ff ff       	call   800102 <_panic>
+
+0080107a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	57                   	push   %edi
+  80107e:	56                   	push   %esi
+  80107f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801080:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801087:	74 1d                	je     8010a6 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801089:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80108e:	be 00 00 00 00       	mov    $0x0,%esi
+  801093:	8b 55 08             	mov    0x8(%ebp),%edx
+  801096:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801099:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80109f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010a1:	5b                   	pop    %ebx
+  8010a2:	5e                   	pop    %esi
+  8010a3:	5f                   	pop    %edi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b7:	55                   	push   %ebp
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	8d 35 c2 10 80 00    	lea    0x8010c2,%esi
+  8010c0:	0f 34                	sysenter
+  8010c2:	5d                   	pop    %ebp
+		goto out;
+  8010c3:	eb dc                	jmp    8010a1 <sys_ipc_try_send+0x27>
+
+008010c5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	57                   	push   %edi
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010ce:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010d5:	74 21                	je     8010f8 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010dc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e4:	89 cb                	mov    %ecx,%ebx
+  8010e6:	89 cf                	mov    %ecx,%edi
+  8010e8:	89 ce                	mov    %ecx,%esi
+  8010ea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ec:	85 c0                	test   %eax,%eax
+  8010ee:	7f 27                	jg     801117 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801100:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801105:	89 cb                	mov    %ecx,%ebx
+  801107:	89 cf                	mov    %ecx,%edi
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	8d 35 14 11 80 00    	lea    0x801114,%esi
+  801112:	0f 34                	sysenter
+  801114:	5d                   	pop    %ebp
+		goto out;
+  801115:	eb d5                	jmp    8010ec <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801117:	83 ec 0c             	sub    $0xc,%esp
+  80111a:	50                   	push   %eax
+  80111b:	6a 0d                	push   $0xd
+  80111d:	68 cb 2e 80 00       	push   $0x802ecb
+  801122:	6a 3f                	push   $0x3f
+  801124:	68 e8 2e 80 00       	push   $0x802ee8
+  801129:	e8 d4 ef ff ff       	call   800102 <_panic>
+
+0080112e <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	56                   	push   %esi
+  801133:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801134:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80113b:	74 1b                	je     801158 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80113d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801142:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114d:	89 df                	mov    %ebx,%edi
+  80114f:	89 de                	mov    %ebx,%esi
+  801151:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801153:	5b                   	pop    %ebx
+  801154:	5e                   	pop    %esi
+  801155:	5f                   	pop    %edi
+  801156:	5d                   	pop    %ebp
+  801157:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801158:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801160:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801163:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801168:	89 df                	mov    %ebx,%edi
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	8d 35 75 11 80 00    	lea    0x801175,%esi
+  801173:	0f 34                	sysenter
+  801175:	5d                   	pop    %ebp
+		goto out;
+  801176:	eb db                	jmp    801153 <sys_ipc_recv_until+0x25>
+
+00801178 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	56                   	push   %esi
+  80117d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80117e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801185:	74 19                	je     8011a0 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801187:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801191:	89 d1                	mov    %edx,%ecx
+  801193:	89 d3                	mov    %edx,%ebx
+  801195:	89 d7                	mov    %edx,%edi
+  801197:	89 d6                	mov    %edx,%esi
+  801199:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80119b:	5b                   	pop    %ebx
+  80119c:	5e                   	pop    %esi
+  80119d:	5f                   	pop    %edi
+  80119e:	5d                   	pop    %ebp
+  80119f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011aa:	89 d1                	mov    %edx,%ecx
+  8011ac:	89 d3                	mov    %edx,%ebx
+  8011ae:	89 d7                	mov    %edx,%edi
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	8d 35 bb 11 80 00    	lea    0x8011bb,%esi
+  8011b9:	0f 34                	sysenter
+  8011bb:	5d                   	pop    %ebp
+		goto out;
+  8011bc:	eb dd                	jmp    80119b <sys_time_msec+0x23>
+
+008011be <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011be:	55                   	push   %ebp
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	57                   	push   %edi
+  8011c2:	56                   	push   %esi
+  8011c3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011c4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011cb:	74 1a                	je     8011e7 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011da:	89 cb                	mov    %ecx,%ebx
+  8011dc:	89 cf                	mov    %ecx,%edi
+  8011de:	89 ce                	mov    %ecx,%esi
+  8011e0:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011e2:	5b                   	pop    %ebx
+  8011e3:	5e                   	pop    %esi
+  8011e4:	5f                   	pop    %edi
+  8011e5:	5d                   	pop    %ebp
+  8011e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ef:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011f4:	89 cb                	mov    %ecx,%ebx
+  8011f6:	89 cf                	mov    %ecx,%edi
+  8011f8:	55                   	push   %ebp
+  8011f9:	89 e5                	mov    %esp,%ebp
+  8011fb:	8d 35 03 12 80 00    	lea    0x801203,%esi
+  801201:	0f 34                	sysenter
+  801203:	5d                   	pop    %ebp
+		goto out;
+  801204:	eb dc                	jmp    8011e2 <sys_sleep_until+0x24>
+
+00801206 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80120c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801213:	74 1a                	je     80122f <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801215:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80121a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80121f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801222:	89 cb                	mov    %ecx,%ebx
+  801224:	89 cf                	mov    %ecx,%edi
+  801226:	89 ce                	mov    %ecx,%esi
+  801228:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80122a:	5b                   	pop    %ebx
+  80122b:	5e                   	pop    %esi
+  80122c:	5f                   	pop    %edi
+  80122d:	5d                   	pop    %ebp
+  80122e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80122f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801232:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801237:	b8 11 00 00 00       	mov    $0x11,%eax
+  80123c:	89 cb                	mov    %ecx,%ebx
+  80123e:	89 cf                	mov    %ecx,%edi
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	8d 35 4b 12 80 00    	lea    0x80124b,%esi
+  801249:	0f 34                	sysenter
+  80124b:	5d                   	pop    %ebp
+		goto out;
+  80124c:	eb dc                	jmp    80122a <sys_env_print_stats+0x24>
+
+0080124e <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	57                   	push   %edi
+  801252:	56                   	push   %esi
+  801253:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801254:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80125b:	74 1b                	je     801278 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80125d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801262:	b8 19 00 00 00       	mov    $0x19,%eax
+  801267:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126d:	89 df                	mov    %ebx,%edi
+  80126f:	89 de                	mov    %ebx,%esi
+  801271:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801273:	5b                   	pop    %ebx
+  801274:	5e                   	pop    %esi
+  801275:	5f                   	pop    %edi
+  801276:	5d                   	pop    %ebp
+  801277:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801278:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	b8 19 00 00 00       	mov    $0x19,%eax
+  801288:	89 df                	mov    %ebx,%edi
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	8d 35 95 12 80 00    	lea    0x801295,%esi
+  801293:	0f 34                	sysenter
+  801295:	5d                   	pop    %ebp
+		goto out;
+  801296:	eb db                	jmp    801273 <sys_perf+0x25>
+
+00801298 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801298:	55                   	push   %ebp
+  801299:	89 e5                	mov    %esp,%ebp
+  80129b:	57                   	push   %edi
+  80129c:	56                   	push   %esi
+  80129d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80129e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012a5:	74 19                	je     8012c0 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ac:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012b1:	89 d1                	mov    %edx,%ecx
+  8012b3:	89 d3                	mov    %edx,%ebx
+  8012b5:	89 d7                	mov    %edx,%edi
+  8012b7:	89 d6                	mov    %edx,%esi
+  8012b9:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012bb:	5b                   	pop    %ebx
+  8012bc:	5e                   	pop    %esi
+  8012bd:	5f                   	pop    %edi
+  8012be:	5d                   	pop    %ebp
+  8012bf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012ca:	89 d1                	mov    %edx,%ecx
+  8012cc:	89 d3                	mov    %edx,%ebx
+  8012ce:	89 d7                	mov    %edx,%edi
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	8d 35 db 12 80 00    	lea    0x8012db,%esi
+  8012d9:	0f 34                	sysenter
+  8012db:	5d                   	pop    %ebp
+		goto out;
+  8012dc:	eb dd                	jmp    8012bb <sys_fork+0x23>
+
+008012de <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	57                   	push   %edi
+  8012e2:	56                   	push   %esi
+  8012e3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012e4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012eb:	74 1c                	je     801309 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8012ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8012f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801300:	89 f7                	mov    %esi,%edi
+  801302:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801304:	5b                   	pop    %ebx
+  801305:	5e                   	pop    %esi
+  801306:	5f                   	pop    %edi
+  801307:	5d                   	pop    %ebp
+  801308:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801309:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801314:	bf 00 00 00 00       	mov    $0x0,%edi
+  801319:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	8d 35 27 13 80 00    	lea    0x801327,%esi
+  801325:	0f 34                	sysenter
+  801327:	5d                   	pop    %ebp
+		goto out;
+  801328:	eb da                	jmp    801304 <sys_thread_create+0x26>
+
+0080132a <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80132a:	55                   	push   %ebp
+  80132b:	89 e5                	mov    %esp,%ebp
+  80132d:	57                   	push   %edi
+  80132e:	56                   	push   %esi
+  80132f:	53                   	push   %ebx
+  801330:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801333:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80133a:	74 24                	je     801360 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80133c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801341:	be 00 00 00 00       	mov    $0x0,%esi
+  801346:	8b 55 08             	mov    0x8(%ebp),%edx
+  801349:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801352:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801354:	85 c0                	test   %eax,%eax
+  801356:	7f 27                	jg     80137f <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801358:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135b:	5b                   	pop    %ebx
+  80135c:	5e                   	pop    %esi
+  80135d:	5f                   	pop    %edi
+  80135e:	5d                   	pop    %ebp
+  80135f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801360:	8b 55 08             	mov    0x8(%ebp),%edx
+  801363:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801366:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80136b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801371:	55                   	push   %ebp
+  801372:	89 e5                	mov    %esp,%ebp
+  801374:	8d 35 7c 13 80 00    	lea    0x80137c,%esi
+  80137a:	0f 34                	sysenter
+  80137c:	5d                   	pop    %ebp
+		goto out;
+  80137d:	eb d5                	jmp    801354 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80137f:	83 ec 0c             	sub    $0xc,%esp
+  801382:	50                   	push   %eax
+  801383:	6a 1f                	push   $0x1f
+  801385:	68 cb 2e 80 00       	push   $0x802ecb
+  80138a:	6a 3f                	push   $0x3f
+  80138c:	68 e8 2e 80 00       	push   $0x802ee8
+  801391:	e8 6c ed ff ff       	call   800102 <_panic>
+
+00801396 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	57                   	push   %edi
+  80139a:	56                   	push   %esi
+  80139b:	53                   	push   %ebx
+  80139c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80139f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013a6:	74 23                	je     8013cb <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ad:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013bb:	89 f7                	mov    %esi,%edi
+  8013bd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013bf:	85 c0                	test   %eax,%eax
+  8013c1:	7f 29                	jg     8013ec <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c6:	5b                   	pop    %ebx
+  8013c7:	5e                   	pop    %esi
+  8013c8:	5f                   	pop    %edi
+  8013c9:	5d                   	pop    %ebp
+  8013ca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d1:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013de:	55                   	push   %ebp
+  8013df:	89 e5                	mov    %esp,%ebp
+  8013e1:	8d 35 e9 13 80 00    	lea    0x8013e9,%esi
+  8013e7:	0f 34                	sysenter
+  8013e9:	5d                   	pop    %ebp
+		goto out;
+  8013ea:	eb d3                	jmp    8013bf <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ec:	83 ec 0c             	sub    $0xc,%esp
+  8013ef:	50                   	push   %eax
+  8013f0:	6a 20                	push   $0x20
+  8013f2:	68 cb 2e 80 00       	push   $0x802ecb
+  8013f7:	6a 3f                	push   $0x3f
+  8013f9:	68 e8 2e 80 00       	push   $0x802ee8
+  8013fe:	e8 ff ec ff ff       	call   800102 <_panic>
+
+00801403 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801403:	55                   	push   %ebp
+  801404:	89 e5                	mov    %esp,%ebp
+  801406:	57                   	push   %edi
+  801407:	56                   	push   %esi
+  801408:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801409:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801410:	74 1b                	je     80142d <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801412:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801417:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80141c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801422:	89 df                	mov    %ebx,%edi
+  801424:	89 de                	mov    %ebx,%esi
+  801426:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801428:	5b                   	pop    %ebx
+  801429:	5e                   	pop    %esi
+  80142a:	5f                   	pop    %edi
+  80142b:	5d                   	pop    %ebp
+  80142c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80142d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801432:	8b 55 08             	mov    0x8(%ebp),%edx
+  801435:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801438:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80143d:	89 df                	mov    %ebx,%edi
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	8d 35 4a 14 80 00    	lea    0x80144a,%esi
+  801448:	0f 34                	sysenter
+  80144a:	5d                   	pop    %ebp
+		goto out;
+  80144b:	eb db                	jmp    801428 <sys_batch+0x25>
+
+0080144d <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80144d:	55                   	push   %ebp
+  80144e:	89 e5                	mov    %esp,%ebp
+  801450:	57                   	push   %edi
+  801451:	56                   	push   %esi
+  801452:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801453:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80145a:	74 1a                	je     801476 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80145c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801461:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801466:	8b 55 08             	mov    0x8(%ebp),%edx
+  801469:	89 cb                	mov    %ecx,%ebx
+  80146b:	89 cf                	mov    %ecx,%edi
+  80146d:	89 ce                	mov    %ecx,%esi
+  80146f:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801471:	5b                   	pop    %ebx
+  801472:	5e                   	pop    %esi
+  801473:	5f                   	pop    %edi
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801476:	8b 55 08             	mov    0x8(%ebp),%edx
+  801479:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80147e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801483:	89 cb                	mov    %ecx,%ebx
+  801485:	89 cf                	mov    %ecx,%edi
+  801487:	55                   	push   %ebp
+  801488:	89 e5                	mov    %esp,%ebp
+  80148a:	8d 35 92 14 80 00    	lea    0x801492,%esi
+  801490:	0f 34                	sysenter
+  801492:	5d                   	pop    %ebp
+		goto out;
+  801493:	eb dc                	jmp    801471 <sys_trace_ctl+0x24>
+
+00801495 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801495:	55                   	push   %ebp
+  801496:	89 e5                	mov    %esp,%ebp
+  801498:	57                   	push   %edi
+  801499:	56                   	push   %esi
+  80149a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80149b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014a2:	74 1c                	je     8014c0 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b7:	89 f7                	mov    %esi,%edi
+  8014b9:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014bb:	5b                   	pop    %ebx
+  8014bc:	5e                   	pop    %esi
+  8014bd:	5f                   	pop    %edi
+  8014be:	5d                   	pop    %ebp
+  8014bf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	8d 35 de 14 80 00    	lea    0x8014de,%esi
+  8014dc:	0f 34                	sysenter
+  8014de:	5d                   	pop    %ebp
+		goto out;
+  8014df:	eb da                	jmp    8014bb <sys_trace_read+0x26>
+
+008014e1 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	57                   	push   %edi
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014e7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ee:	74 1c                	je     80150c <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8014f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f5:	b8 21 00 00 00       	mov    $0x21,%eax
+  8014fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801500:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801503:	89 f7                	mov    %esi,%edi
+  801505:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801507:	5b                   	pop    %ebx
+  801508:	5e                   	pop    %esi
+  801509:	5f                   	pop    %edi
+  80150a:	5d                   	pop    %ebp
+  80150b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80150c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801512:	b8 21 00 00 00       	mov    $0x21,%eax
+  801517:	bf 00 00 00 00       	mov    $0x0,%edi
+  80151c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151f:	55                   	push   %ebp
+  801520:	89 e5                	mov    %esp,%ebp
+  801522:	8d 35 2a 15 80 00    	lea    0x80152a,%esi
+  801528:	0f 34                	sysenter
+  80152a:	5d                   	pop    %ebp
+		goto out;
+  80152b:	eb da                	jmp    801507 <sys_meminfo+0x26>
+
+0080152d <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	57                   	push   %edi
+  801531:	56                   	push   %esi
+  801532:	53                   	push   %ebx
+  801533:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801536:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80153a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801541:	74 1f                	je     801562 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801543:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801548:	b8 22 00 00 00       	mov    $0x22,%eax
+  80154d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801550:	89 df                	mov    %ebx,%edi
+  801552:	89 de                	mov    %ebx,%esi
+  801554:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801556:	85 c0                	test   %eax,%eax
+  801558:	7f 25                	jg     80157f <sys_env_set_ksm+0x52>
+}
+  80155a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80155d:	5b                   	pop    %ebx
+  80155e:	5e                   	pop    %esi
+  80155f:	5f                   	pop    %edi
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801562:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801567:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80156f:	89 df                	mov    %ebx,%edi
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	8d 35 7c 15 80 00    	lea    0x80157c,%esi
+  80157a:	0f 34                	sysenter
+  80157c:	5d                   	pop    %ebp
+		goto out;
+  80157d:	eb d7                	jmp    801556 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80157f:	83 ec 0c             	sub    $0xc,%esp
+  801582:	50                   	push   %eax
+  801583:	6a 22                	push   $0x22
+  801585:	68 cb 2e 80 00       	push   $0x802ecb
+  80158a:	6a 3f                	push   $0x3f
+  80158c:	68 e8 2e 80 00       	push   $0x802ee8
+  801591:	e8 6c eb ff ff       	call   800102 <_panic>
+
+00801596 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	57                   	push   %edi
+  80159a:	56                   	push   %esi
+  80159b:	53                   	push   %ebx
+  80159c:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80159f:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015a2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015a9:	74 24                	je     8015cf <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015b5:	89 cb                	mov    %ecx,%ebx
+  8015b7:	89 cf                	mov    %ecx,%edi
+  8015b9:	89 ce                	mov    %ecx,%esi
+  8015bb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015bd:	85 c0                	test   %eax,%eax
+  8015bf:	7f 2a                	jg     8015eb <sys_time_nsec+0x55>
+	return ns;
+}
+  8015c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015c4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ca:	5b                   	pop    %ebx
+  8015cb:	5e                   	pop    %esi
+  8015cc:	5f                   	pop    %edi
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015d9:	89 cb                	mov    %ecx,%ebx
+  8015db:	89 cf                	mov    %ecx,%edi
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	8d 35 e8 15 80 00    	lea    0x8015e8,%esi
+  8015e6:	0f 34                	sysenter
+  8015e8:	5d                   	pop    %ebp
+		goto out;
+  8015e9:	eb d2                	jmp    8015bd <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+  8015ee:	50                   	push   %eax
+  8015ef:	6a 0f                	push   $0xf
+  8015f1:	68 cb 2e 80 00       	push   $0x802ecb
+  8015f6:	6a 3f                	push   $0x3f
+  8015f8:	68 e8 2e 80 00       	push   $0x802ee8
+  8015fd:	e8 00 eb ff ff       	call   800102 <_panic>
+
+00801602 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801602:	55                   	push   %ebp
+  801603:	89 e5                	mov    %esp,%ebp
+  801605:	57                   	push   %edi
+  801606:	56                   	push   %esi
+  801607:	53                   	push   %ebx
+  801608:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80160b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801612:	74 22                	je     801636 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801614:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801619:	b8 12 00 00 00       	mov    $0x12,%eax
+  80161e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801621:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801624:	89 df                	mov    %ebx,%edi
+  801626:	89 de                	mov    %ebx,%esi
+  801628:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	7f 28                	jg     801656 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80162e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801631:	5b                   	pop    %ebx
+  801632:	5e                   	pop    %esi
+  801633:	5f                   	pop    %edi
+  801634:	5d                   	pop    %ebp
+  801635:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801636:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801641:	b8 12 00 00 00       	mov    $0x12,%eax
+  801646:	89 df                	mov    %ebx,%edi
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	8d 35 53 16 80 00    	lea    0x801653,%esi
+  801651:	0f 34                	sysenter
+  801653:	5d                   	pop    %ebp
+		goto out;
+  801654:	eb d4                	jmp    80162a <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801656:	83 ec 0c             	sub    $0xc,%esp
+  801659:	50                   	push   %eax
+  80165a:	6a 12                	push   $0x12
+  80165c:	68 cb 2e 80 00       	push   $0x802ecb
+  801661:	6a 3f                	push   $0x3f
+  801663:	68 e8 2e 80 00       	push   $0x802ee8
+  801668:	e8 95 ea ff ff       	call   800102 <_panic>
+
+0080166d <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	57                   	push   %edi
+  801671:	56                   	push   %esi
+  801672:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801673:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80167a:	74 1b                	je     801697 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80167c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801681:	b8 13 00 00 00       	mov    $0x13,%eax
+  801686:	8b 55 08             	mov    0x8(%ebp),%edx
+  801689:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168c:	89 df                	mov    %ebx,%edi
+  80168e:	89 de                	mov    %ebx,%esi
+  801690:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801692:	5b                   	pop    %ebx
+  801693:	5e                   	pop    %esi
+  801694:	5f                   	pop    %edi
+  801695:	5d                   	pop    %ebp
+  801696:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801697:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a2:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016a7:	89 df                	mov    %ebx,%edi
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	8d 35 b4 16 80 00    	lea    0x8016b4,%esi
+  8016b2:	0f 34                	sysenter
+  8016b4:	5d                   	pop    %ebp
+		goto out;
+  8016b5:	eb db                	jmp    801692 <sys_e1000_receive+0x25>
+
+008016b7 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	57                   	push   %edi
+  8016bb:	56                   	push   %esi
+  8016bc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016bd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016c4:	74 1b                	je     8016e1 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cb:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d6:	89 df                	mov    %ebx,%edi
+  8016d8:	89 de                	mov    %ebx,%esi
+  8016da:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016dc:	5b                   	pop    %ebx
+  8016dd:	5e                   	pop    %esi
+  8016de:	5f                   	pop    %edi
+  8016df:	5d                   	pop    %ebp
+  8016e0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ec:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016f1:	89 df                	mov    %ebx,%edi
+  8016f3:	55                   	push   %ebp
+  8016f4:	89 e5                	mov    %esp,%ebp
+  8016f6:	8d 35 fe 16 80 00    	lea    0x8016fe,%esi
+  8016fc:	0f 34                	sysenter
+  8016fe:	5d                   	pop    %ebp
+		goto out;
+  8016ff:	eb db                	jmp    8016dc <sys_e1000_read_hwaddr+0x25>
+
+00801701 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801701:	55                   	push   %ebp
+  801702:	89 e5                	mov    %esp,%ebp
+  801704:	57                   	push   %edi
+  801705:	56                   	push   %esi
+  801706:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801707:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80170e:	74 1a                	je     80172a <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801710:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801715:	b8 15 00 00 00       	mov    $0x15,%eax
+  80171a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171d:	89 cb                	mov    %ecx,%ebx
+  80171f:	89 cf                	mov    %ecx,%edi
+  801721:	89 ce                	mov    %ecx,%esi
+  801723:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801725:	5b                   	pop    %ebx
+  801726:	5e                   	pop    %esi
+  801727:	5f                   	pop    %edi
+  801728:	5d                   	pop    %ebp
+  801729:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80172a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801732:	b8 15 00 00 00       	mov    $0x15,%eax
+  801737:	89 cb                	mov    %ecx,%ebx
+  801739:	89 cf                	mov    %ecx,%edi
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	8d 35 46 17 80 00    	lea    0x801746,%esi
+  801744:	0f 34                	sysenter
+  801746:	5d                   	pop    %ebp
+		goto out;
+  801747:	eb dc                	jmp    801725 <sys_sb16_read_version+0x24>
+
+00801749 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801749:	55                   	push   %ebp
+  80174a:	89 e5                	mov    %esp,%ebp
+  80174c:	57                   	push   %edi
+  80174d:	56                   	push   %esi
+  80174e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80174f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801756:	74 1b                	je     801773 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801758:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801762:	8b 55 08             	mov    0x8(%ebp),%edx
+  801765:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801768:	89 df                	mov    %ebx,%edi
+  80176a:	89 de                	mov    %ebx,%esi
+  80176c:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80176e:	5b                   	pop    %ebx
+  80176f:	5e                   	pop    %esi
+  801770:	5f                   	pop    %edi
+  801771:	5d                   	pop    %ebp
+  801772:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801773:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801778:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801783:	89 df                	mov    %ebx,%edi
+  801785:	55                   	push   %ebp
+  801786:	89 e5                	mov    %esp,%ebp
+  801788:	8d 35 90 17 80 00    	lea    0x801790,%esi
+  80178e:	0f 34                	sysenter
+  801790:	5d                   	pop    %ebp
+		goto out;
+  801791:	eb db                	jmp    80176e <sys_sb16_play+0x25>
+
+00801793 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801796:	8b 45 08             	mov    0x8(%ebp),%eax
+  801799:	05 00 00 00 30       	add    $0x30000000,%eax
+  80179e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017a1:	5d                   	pop    %ebp
+  8017a2:	c3                   	ret
+
+008017a3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017ae:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017b3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017b8:	5d                   	pop    %ebp
+  8017b9:	c3                   	ret
+
+008017ba <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017ba:	55                   	push   %ebp
+  8017bb:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017bd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017c2:	eb 02                	jmp    8017c6 <fd_alloc+0xc>
+  8017c4:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017c6:	89 c2                	mov    %eax,%edx
+  8017c8:	c1 ea 16             	shr    $0x16,%edx
+  8017cb:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017d2:	f6 c2 01             	test   $0x1,%dl
+  8017d5:	74 2b                	je     801802 <fd_alloc+0x48>
+  8017d7:	89 c2                	mov    %eax,%edx
+  8017d9:	c1 ea 0c             	shr    $0xc,%edx
+  8017dc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017e3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017e9:	f6 c1 01             	test   $0x1,%cl
+  8017ec:	74 14                	je     801802 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017ee:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017f4:	75 ce                	jne    8017c4 <fd_alloc+0xa>
+  8017f6:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8017fb:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801800:	eb 05                	jmp    801807 <fd_alloc+0x4d>
+			return 0;
+  801802:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801807:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180a:	89 02                	mov    %eax,(%edx)
+}
+  80180c:	89 c8                	mov    %ecx,%eax
+  80180e:	5d                   	pop    %ebp
+  80180f:	c3                   	ret
+
+00801810 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801810:	55                   	push   %ebp
+  801811:	89 e5                	mov    %esp,%ebp
+  801813:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801816:	83 f8 1f             	cmp    $0x1f,%eax
+  801819:	77 30                	ja     80184b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80181b:	c1 e0 0c             	shl    $0xc,%eax
+  80181e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801823:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801829:	f6 c2 01             	test   $0x1,%dl
+  80182c:	74 24                	je     801852 <fd_lookup+0x42>
+  80182e:	89 c2                	mov    %eax,%edx
+  801830:	c1 ea 0c             	shr    $0xc,%edx
+  801833:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80183a:	f6 c2 01             	test   $0x1,%dl
+  80183d:	74 1a                	je     801859 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80183f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801842:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801844:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801849:	5d                   	pop    %ebp
+  80184a:	c3                   	ret
+		return -E_INVAL;
+  80184b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801850:	eb f7                	jmp    801849 <fd_lookup+0x39>
+		return -E_INVAL;
+  801852:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801857:	eb f0                	jmp    801849 <fd_lookup+0x39>
+  801859:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185e:	eb e9                	jmp    801849 <fd_lookup+0x39>
+
+00801860 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801860:	55                   	push   %ebp
+  801861:	89 e5                	mov    %esp,%ebp
+  801863:	53                   	push   %ebx
+  801864:	83 ec 04             	sub    $0x4,%esp
+  801867:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80186a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186f:	eb 03                	jmp    801874 <dev_lookup+0x14>
+  801871:	83 c0 01             	add    $0x1,%eax
+  801874:	8b 1c 85 74 2f 80 00 	mov    0x802f74(,%eax,4),%ebx
+  80187b:	85 db                	test   %ebx,%ebx
+  80187d:	74 0b                	je     80188a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80187f:	39 13                	cmp    %edx,(%ebx)
+  801881:	75 ee                	jne    801871 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801883:	b8 00 00 00 00       	mov    $0x0,%eax
+  801888:	eb 2e                	jmp    8018b8 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80188a:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80188c:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801891:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801897:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80189c:	76 24                	jbe    8018c2 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80189e:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018a1:	83 ec 04             	sub    $0x4,%esp
+  8018a4:	52                   	push   %edx
+  8018a5:	50                   	push   %eax
+  8018a6:	68 f8 2e 80 00       	push   $0x802ef8
+  8018ab:	e8 2d e9 ff ff       	call   8001dd <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018b0:	83 c4 10             	add    $0x10,%esp
+  8018b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018bb:	89 1a                	mov    %ebx,(%edx)
+}
+  8018bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c0:	c9                   	leave
+  8018c1:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018c2:	c1 e8 10             	shr    $0x10,%eax
+  8018c5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018cb:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018d1:	eb cb                	jmp    80189e <dev_lookup+0x3e>
+
+008018d3 <fd_close>:
+{
+  8018d3:	55                   	push   %ebp
+  8018d4:	89 e5                	mov    %esp,%ebp
+  8018d6:	57                   	push   %edi
+  8018d7:	56                   	push   %esi
+  8018d8:	53                   	push   %ebx
+  8018d9:	83 ec 24             	sub    $0x24,%esp
+  8018dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018df:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018e2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018e5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018e6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018ec:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018ef:	50                   	push   %eax
+  8018f0:	e8 1b ff ff ff       	call   801810 <fd_lookup>
+  8018f5:	89 c3                	mov    %eax,%ebx
+  8018f7:	83 c4 10             	add    $0x10,%esp
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	78 05                	js     801903 <fd_close+0x30>
+	    || fd != fd2)
+  8018fe:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801901:	74 16                	je     801919 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801903:	89 f8                	mov    %edi,%eax
+  801905:	84 c0                	test   %al,%al
+  801907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80190f:	89 d8                	mov    %ebx,%eax
+  801911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801914:	5b                   	pop    %ebx
+  801915:	5e                   	pop    %esi
+  801916:	5f                   	pop    %edi
+  801917:	5d                   	pop    %ebp
+  801918:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801919:	83 ec 08             	sub    $0x8,%esp
+  80191c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80191f:	50                   	push   %eax
+  801920:	ff 36                	push   (%esi)
+  801922:	e8 39 ff ff ff       	call   801860 <dev_lookup>
+  801927:	89 c3                	mov    %eax,%ebx
+  801929:	83 c4 10             	add    $0x10,%esp
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	78 1a                	js     80194a <fd_close+0x77>
+		if (dev->dev_close)
+  801930:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801933:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801936:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	74 0b                	je     80194a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80193f:	83 ec 0c             	sub    $0xc,%esp
+  801942:	56                   	push   %esi
+  801943:	ff d0                	call   *%eax
+  801945:	89 c3                	mov    %eax,%ebx
+  801947:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80194a:	83 ec 08             	sub    $0x8,%esp
+  80194d:	56                   	push   %esi
+  80194e:	6a 00                	push   $0x0
+  801950:	e8 a3 f4 ff ff       	call   800df8 <sys_page_unmap>
+	return r;
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	eb b5                	jmp    80190f <fd_close+0x3c>
+
+0080195a <close>:
+
+int
+close(int fdnum)
+{
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801960:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801963:	50                   	push   %eax
+  801964:	ff 75 08             	push   0x8(%ebp)
+  801967:	e8 a4 fe ff ff       	call   801810 <fd_lookup>
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	79 02                	jns    801975 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801973:	c9                   	leave
+  801974:	c3                   	ret
+		return fd_close(fd, 1);
+  801975:	83 ec 08             	sub    $0x8,%esp
+  801978:	6a 01                	push   $0x1
+  80197a:	ff 75 f4             	push   -0xc(%ebp)
+  80197d:	e8 51 ff ff ff       	call   8018d3 <fd_close>
+  801982:	83 c4 10             	add    $0x10,%esp
+  801985:	eb ec                	jmp    801973 <close+0x19>
+
+00801987 <close_all>:
+
+void
+close_all(void)
+{
+  801987:	55                   	push   %ebp
+  801988:	89 e5                	mov    %esp,%ebp
+  80198a:	53                   	push   %ebx
+  80198b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80198e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801993:	83 ec 0c             	sub    $0xc,%esp
+  801996:	53                   	push   %ebx
+  801997:	e8 be ff ff ff       	call   80195a <close>
+	for (i = 0; i < MAXFD; i++)
+  80199c:	83 c3 01             	add    $0x1,%ebx
+  80199f:	83 c4 10             	add    $0x10,%esp
+  8019a2:	83 fb 20             	cmp    $0x20,%ebx
+  8019a5:	75 ec                	jne    801993 <close_all+0xc>
+}
+  8019a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019aa:	c9                   	leave
+  8019ab:	c3                   	ret
+
+008019ac <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	57                   	push   %edi
+  8019b0:	56                   	push   %esi
+  8019b1:	53                   	push   %ebx
+  8019b2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019b8:	50                   	push   %eax
+  8019b9:	ff 75 08             	push   0x8(%ebp)
+  8019bc:	e8 4f fe ff ff       	call   801810 <fd_lookup>
+  8019c1:	89 c3                	mov    %eax,%ebx
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	85 c0                	test   %eax,%eax
+  8019c8:	78 7f                	js     801a49 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019ca:	83 ec 0c             	sub    $0xc,%esp
+  8019cd:	ff 75 0c             	push   0xc(%ebp)
+  8019d0:	e8 85 ff ff ff       	call   80195a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019d8:	c1 e6 0c             	shl    $0xc,%esi
+  8019db:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019e4:	89 3c 24             	mov    %edi,(%esp)
+  8019e7:	e8 b7 fd ff ff       	call   8017a3 <fd2data>
+  8019ec:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019ee:	89 34 24             	mov    %esi,(%esp)
+  8019f1:	e8 ad fd ff ff       	call   8017a3 <fd2data>
+  8019f6:	83 c4 10             	add    $0x10,%esp
+  8019f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8019fc:	89 d8                	mov    %ebx,%eax
+  8019fe:	c1 e8 16             	shr    $0x16,%eax
+  801a01:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a08:	a8 01                	test   $0x1,%al
+  801a0a:	74 11                	je     801a1d <dup+0x71>
+  801a0c:	89 d8                	mov    %ebx,%eax
+  801a0e:	c1 e8 0c             	shr    $0xc,%eax
+  801a11:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a18:	f6 c2 01             	test   $0x1,%dl
+  801a1b:	75 36                	jne    801a53 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a1d:	89 f8                	mov    %edi,%eax
+  801a1f:	c1 e8 0c             	shr    $0xc,%eax
+  801a22:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a29:	83 ec 0c             	sub    $0xc,%esp
+  801a2c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a31:	50                   	push   %eax
+  801a32:	56                   	push   %esi
+  801a33:	6a 00                	push   $0x0
+  801a35:	57                   	push   %edi
+  801a36:	6a 00                	push   $0x0
+  801a38:	e8 4d f3 ff ff       	call   800d8a <sys_page_map>
+  801a3d:	89 c3                	mov    %eax,%ebx
+  801a3f:	83 c4 20             	add    $0x20,%esp
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	78 33                	js     801a79 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a46:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a49:	89 d8                	mov    %ebx,%eax
+  801a4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4e:	5b                   	pop    %ebx
+  801a4f:	5e                   	pop    %esi
+  801a50:	5f                   	pop    %edi
+  801a51:	5d                   	pop    %ebp
+  801a52:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a53:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a5a:	83 ec 0c             	sub    $0xc,%esp
+  801a5d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a62:	50                   	push   %eax
+  801a63:	ff 75 d4             	push   -0x2c(%ebp)
+  801a66:	6a 00                	push   $0x0
+  801a68:	53                   	push   %ebx
+  801a69:	6a 00                	push   $0x0
+  801a6b:	e8 1a f3 ff ff       	call   800d8a <sys_page_map>
+  801a70:	89 c3                	mov    %eax,%ebx
+  801a72:	83 c4 20             	add    $0x20,%esp
+  801a75:	85 c0                	test   %eax,%eax
+  801a77:	79 a4                	jns    801a1d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a79:	83 ec 08             	sub    $0x8,%esp
+  801a7c:	56                   	push   %esi
+  801a7d:	6a 00                	push   $0x0
+  801a7f:	e8 74 f3 ff ff       	call   800df8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a84:	83 c4 08             	add    $0x8,%esp
+  801a87:	ff 75 d4             	push   -0x2c(%ebp)
+  801a8a:	6a 00                	push   $0x0
+  801a8c:	e8 67 f3 ff ff       	call   800df8 <sys_page_unmap>
+	return r;
+  801a91:	83 c4 10             	add    $0x10,%esp
+  801a94:	eb b3                	jmp    801a49 <dup+0x9d>
+
+00801a96 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a96:	55                   	push   %ebp
+  801a97:	89 e5                	mov    %esp,%ebp
+  801a99:	56                   	push   %esi
+  801a9a:	53                   	push   %ebx
+  801a9b:	83 ec 18             	sub    $0x18,%esp
+  801a9e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aa1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aa4:	50                   	push   %eax
+  801aa5:	53                   	push   %ebx
+  801aa6:	e8 65 fd ff ff       	call   801810 <fd_lookup>
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	85 c0                	test   %eax,%eax
+  801ab0:	78 3c                	js     801aee <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ab2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ab5:	83 ec 08             	sub    $0x8,%esp
+  801ab8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801abb:	50                   	push   %eax
+  801abc:	ff 36                	push   (%esi)
+  801abe:	e8 9d fd ff ff       	call   801860 <dev_lookup>
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	85 c0                	test   %eax,%eax
+  801ac8:	78 24                	js     801aee <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801aca:	8b 46 08             	mov    0x8(%esi),%eax
+  801acd:	83 e0 03             	and    $0x3,%eax
+  801ad0:	83 f8 01             	cmp    $0x1,%eax
+  801ad3:	74 20                	je     801af5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ad5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad8:	8b 40 08             	mov    0x8(%eax),%eax
+  801adb:	85 c0                	test   %eax,%eax
+  801add:	74 57                	je     801b36 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801adf:	83 ec 04             	sub    $0x4,%esp
+  801ae2:	ff 75 10             	push   0x10(%ebp)
+  801ae5:	ff 75 0c             	push   0xc(%ebp)
+  801ae8:	56                   	push   %esi
+  801ae9:	ff d0                	call   *%eax
+  801aeb:	83 c4 10             	add    $0x10,%esp
+}
+  801aee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801af1:	5b                   	pop    %ebx
+  801af2:	5e                   	pop    %esi
+  801af3:	5d                   	pop    %ebp
+  801af4:	c3                   	ret
+  801af5:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801af7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801afc:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b02:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b07:	76 1c                	jbe    801b25 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b09:	8b 42 48             	mov    0x48(%edx),%eax
+  801b0c:	83 ec 04             	sub    $0x4,%esp
+  801b0f:	53                   	push   %ebx
+  801b10:	50                   	push   %eax
+  801b11:	68 39 2f 80 00       	push   $0x802f39
+  801b16:	e8 c2 e6 ff ff       	call   8001dd <cprintf>
+		return -E_INVAL;
+  801b1b:	83 c4 10             	add    $0x10,%esp
+  801b1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b23:	eb c9                	jmp    801aee <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b25:	c1 e8 10             	shr    $0x10,%eax
+  801b28:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b2e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b34:	eb d3                	jmp    801b09 <read+0x73>
+		return -E_NOT_SUPP;
+  801b36:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b3b:	eb b1                	jmp    801aee <read+0x58>
+
+00801b3d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b3d:	55                   	push   %ebp
+  801b3e:	89 e5                	mov    %esp,%ebp
+  801b40:	57                   	push   %edi
+  801b41:	56                   	push   %esi
+  801b42:	53                   	push   %ebx
+  801b43:	83 ec 0c             	sub    $0xc,%esp
+  801b46:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b49:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b51:	eb 02                	jmp    801b55 <readn+0x18>
+  801b53:	01 c3                	add    %eax,%ebx
+  801b55:	39 f3                	cmp    %esi,%ebx
+  801b57:	73 21                	jae    801b7a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b59:	83 ec 04             	sub    $0x4,%esp
+  801b5c:	89 f0                	mov    %esi,%eax
+  801b5e:	29 d8                	sub    %ebx,%eax
+  801b60:	50                   	push   %eax
+  801b61:	89 d8                	mov    %ebx,%eax
+  801b63:	03 45 0c             	add    0xc(%ebp),%eax
+  801b66:	50                   	push   %eax
+  801b67:	57                   	push   %edi
+  801b68:	e8 29 ff ff ff       	call   801a96 <read>
+		if (m < 0)
+  801b6d:	83 c4 10             	add    $0x10,%esp
+  801b70:	85 c0                	test   %eax,%eax
+  801b72:	78 04                	js     801b78 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b74:	75 dd                	jne    801b53 <readn+0x16>
+  801b76:	eb 02                	jmp    801b7a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b78:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b7a:	89 d8                	mov    %ebx,%eax
+  801b7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b7f:	5b                   	pop    %ebx
+  801b80:	5e                   	pop    %esi
+  801b81:	5f                   	pop    %edi
+  801b82:	5d                   	pop    %ebp
+  801b83:	c3                   	ret
+
+00801b84 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b84:	55                   	push   %ebp
+  801b85:	89 e5                	mov    %esp,%ebp
+  801b87:	56                   	push   %esi
+  801b88:	53                   	push   %ebx
+  801b89:	83 ec 18             	sub    $0x18,%esp
+  801b8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b8f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b92:	50                   	push   %eax
+  801b93:	53                   	push   %ebx
+  801b94:	e8 77 fc ff ff       	call   801810 <fd_lookup>
+  801b99:	83 c4 10             	add    $0x10,%esp
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 37                	js     801bd7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ba0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ba3:	83 ec 08             	sub    $0x8,%esp
+  801ba6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba9:	50                   	push   %eax
+  801baa:	ff 36                	push   (%esi)
+  801bac:	e8 af fc ff ff       	call   801860 <dev_lookup>
+  801bb1:	83 c4 10             	add    $0x10,%esp
+  801bb4:	85 c0                	test   %eax,%eax
+  801bb6:	78 1f                	js     801bd7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bb8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bbc:	74 20                	je     801bde <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	74 57                	je     801c1f <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bc8:	83 ec 04             	sub    $0x4,%esp
+  801bcb:	ff 75 10             	push   0x10(%ebp)
+  801bce:	ff 75 0c             	push   0xc(%ebp)
+  801bd1:	56                   	push   %esi
+  801bd2:	ff d0                	call   *%eax
+  801bd4:	83 c4 10             	add    $0x10,%esp
+}
+  801bd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bda:	5b                   	pop    %ebx
+  801bdb:	5e                   	pop    %esi
+  801bdc:	5d                   	pop    %ebp
+  801bdd:	c3                   	ret
+  801bde:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801be0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801be5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801beb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bf0:	76 1c                	jbe    801c0e <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf2:	8b 42 48             	mov    0x48(%edx),%eax
+  801bf5:	83 ec 04             	sub    $0x4,%esp
+  801bf8:	53                   	push   %ebx
+  801bf9:	50                   	push   %eax
+  801bfa:	68 55 2f 80 00       	push   $0x802f55
+  801bff:	e8 d9 e5 ff ff       	call   8001dd <cprintf>
+		return -E_INVAL;
+  801c04:	83 c4 10             	add    $0x10,%esp
+  801c07:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c0c:	eb c9                	jmp    801bd7 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c0e:	c1 e8 10             	shr    $0x10,%eax
+  801c11:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c17:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c1d:	eb d3                	jmp    801bf2 <write+0x6e>
+		return -E_NOT_SUPP;
+  801c1f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c24:	eb b1                	jmp    801bd7 <write+0x53>
+
+00801c26 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c2f:	50                   	push   %eax
+  801c30:	ff 75 08             	push   0x8(%ebp)
+  801c33:	e8 d8 fb ff ff       	call   801810 <fd_lookup>
+  801c38:	83 c4 10             	add    $0x10,%esp
+  801c3b:	85 c0                	test   %eax,%eax
+  801c3d:	78 0e                	js     801c4d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c45:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+00801c4f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c4f:	55                   	push   %ebp
+  801c50:	89 e5                	mov    %esp,%ebp
+  801c52:	56                   	push   %esi
+  801c53:	53                   	push   %ebx
+  801c54:	83 ec 18             	sub    $0x18,%esp
+  801c57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c5a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c5d:	50                   	push   %eax
+  801c5e:	53                   	push   %ebx
+  801c5f:	e8 ac fb ff ff       	call   801810 <fd_lookup>
+  801c64:	83 c4 10             	add    $0x10,%esp
+  801c67:	85 c0                	test   %eax,%eax
+  801c69:	78 34                	js     801c9f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c6b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c6e:	83 ec 08             	sub    $0x8,%esp
+  801c71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c74:	50                   	push   %eax
+  801c75:	ff 36                	push   (%esi)
+  801c77:	e8 e4 fb ff ff       	call   801860 <dev_lookup>
+  801c7c:	83 c4 10             	add    $0x10,%esp
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	78 1c                	js     801c9f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c83:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c87:	74 1d                	je     801ca6 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c8c:	8b 40 18             	mov    0x18(%eax),%eax
+  801c8f:	85 c0                	test   %eax,%eax
+  801c91:	74 54                	je     801ce7 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c93:	83 ec 08             	sub    $0x8,%esp
+  801c96:	ff 75 0c             	push   0xc(%ebp)
+  801c99:	56                   	push   %esi
+  801c9a:	ff d0                	call   *%eax
+  801c9c:	83 c4 10             	add    $0x10,%esp
+}
+  801c9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca2:	5b                   	pop    %ebx
+  801ca3:	5e                   	pop    %esi
+  801ca4:	5d                   	pop    %ebp
+  801ca5:	c3                   	ret
+  801ca6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ca8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cad:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cb3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cb8:	76 1c                	jbe    801cd6 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cba:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cbd:	83 ec 04             	sub    $0x4,%esp
+  801cc0:	53                   	push   %ebx
+  801cc1:	50                   	push   %eax
+  801cc2:	68 18 2f 80 00       	push   $0x802f18
+  801cc7:	e8 11 e5 ff ff       	call   8001dd <cprintf>
+		return -E_INVAL;
+  801ccc:	83 c4 10             	add    $0x10,%esp
+  801ccf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cd4:	eb c9                	jmp    801c9f <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cd6:	c1 e8 10             	shr    $0x10,%eax
+  801cd9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cdf:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ce5:	eb d3                	jmp    801cba <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801ce7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cec:	eb b1                	jmp    801c9f <ftruncate+0x50>
+
+00801cee <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cee:	55                   	push   %ebp
+  801cef:	89 e5                	mov    %esp,%ebp
+  801cf1:	56                   	push   %esi
+  801cf2:	53                   	push   %ebx
+  801cf3:	83 ec 18             	sub    $0x18,%esp
+  801cf6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cf9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cfc:	50                   	push   %eax
+  801cfd:	ff 75 08             	push   0x8(%ebp)
+  801d00:	e8 0b fb ff ff       	call   801810 <fd_lookup>
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 49                	js     801d55 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d0c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d0f:	83 ec 08             	sub    $0x8,%esp
+  801d12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d15:	50                   	push   %eax
+  801d16:	ff 36                	push   (%esi)
+  801d18:	e8 43 fb ff ff       	call   801860 <dev_lookup>
+  801d1d:	83 c4 10             	add    $0x10,%esp
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	78 31                	js     801d55 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d27:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d2b:	74 2f                	je     801d5c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d2d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d30:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d37:	00 00 00 
+	stat->st_isdir = 0;
+  801d3a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d41:	00 00 00 
+	stat->st_dev = dev;
+  801d44:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d4a:	83 ec 08             	sub    $0x8,%esp
+  801d4d:	53                   	push   %ebx
+  801d4e:	56                   	push   %esi
+  801d4f:	ff 50 14             	call   *0x14(%eax)
+  801d52:	83 c4 10             	add    $0x10,%esp
+}
+  801d55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d58:	5b                   	pop    %ebx
+  801d59:	5e                   	pop    %esi
+  801d5a:	5d                   	pop    %ebp
+  801d5b:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d61:	eb f2                	jmp    801d55 <fstat+0x67>
+
+00801d63 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d63:	55                   	push   %ebp
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	56                   	push   %esi
+  801d67:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d68:	83 ec 08             	sub    $0x8,%esp
+  801d6b:	6a 00                	push   $0x0
+  801d6d:	ff 75 08             	push   0x8(%ebp)
+  801d70:	e8 e4 01 00 00       	call   801f59 <open>
+  801d75:	89 c3                	mov    %eax,%ebx
+  801d77:	83 c4 10             	add    $0x10,%esp
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 1b                	js     801d99 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d7e:	83 ec 08             	sub    $0x8,%esp
+  801d81:	ff 75 0c             	push   0xc(%ebp)
+  801d84:	50                   	push   %eax
+  801d85:	e8 64 ff ff ff       	call   801cee <fstat>
+  801d8a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d8c:	89 1c 24             	mov    %ebx,(%esp)
+  801d8f:	e8 c6 fb ff ff       	call   80195a <close>
+	return r;
+  801d94:	83 c4 10             	add    $0x10,%esp
+  801d97:	89 f3                	mov    %esi,%ebx
+}
+  801d99:	89 d8                	mov    %ebx,%eax
+  801d9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9e:	5b                   	pop    %ebx
+  801d9f:	5e                   	pop    %esi
+  801da0:	5d                   	pop    %ebp
+  801da1:	c3                   	ret
+
+00801da2 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801da2:	55                   	push   %ebp
+  801da3:	89 e5                	mov    %esp,%ebp
+  801da5:	56                   	push   %esi
+  801da6:	53                   	push   %ebx
+  801da7:	89 c6                	mov    %eax,%esi
+  801da9:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801dab:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801db2:	74 27                	je     801ddb <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801db4:	6a 07                	push   $0x7
+  801db6:	68 00 60 80 00       	push   $0x806000
+  801dbb:	56                   	push   %esi
+  801dbc:	ff 35 00 50 80 00    	push   0x805000
+  801dc2:	e8 b2 0c 00 00       	call   802a79 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801dc7:	83 c4 0c             	add    $0xc,%esp
+  801dca:	6a 00                	push   $0x0
+  801dcc:	53                   	push   %ebx
+  801dcd:	6a 00                	push   $0x0
+  801dcf:	e8 8d 0c 00 00       	call   802a61 <ipc_recv>
+}
+  801dd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd7:	5b                   	pop    %ebx
+  801dd8:	5e                   	pop    %esi
+  801dd9:	5d                   	pop    %ebp
+  801dda:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ddb:	83 ec 0c             	sub    $0xc,%esp
+  801dde:	6a 01                	push   $0x1
+  801de0:	e8 e8 0c 00 00       	call   802acd <ipc_find_env>
+  801de5:	a3 00 50 80 00       	mov    %eax,0x805000
+  801dea:	83 c4 10             	add    $0x10,%esp
+  801ded:	eb c5                	jmp    801db4 <fsipc+0x12>
+
+00801def <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801def:	55                   	push   %ebp
+  801df0:	89 e5                	mov    %esp,%ebp
+  801df2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801df5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dfb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e03:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e12:	e8 8b ff ff ff       	call   801da2 <fsipc>
+}
+  801e17:	c9                   	leave
+  801e18:	c3                   	ret
+
+00801e19 <devfile_flush>:
+{
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e22:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e25:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e34:	e8 69 ff ff ff       	call   801da2 <fsipc>
+}
+  801e39:	c9                   	leave
+  801e3a:	c3                   	ret
+
+00801e3b <devfile_stat>:
+{
+  801e3b:	55                   	push   %ebp
+  801e3c:	89 e5                	mov    %esp,%ebp
+  801e3e:	53                   	push   %ebx
+  801e3f:	83 ec 04             	sub    $0x4,%esp
+  801e42:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e48:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e4b:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e55:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e5a:	e8 43 ff ff ff       	call   801da2 <fsipc>
+  801e5f:	85 c0                	test   %eax,%eax
+  801e61:	78 2c                	js     801e8f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e63:	83 ec 08             	sub    $0x8,%esp
+  801e66:	68 00 60 80 00       	push   $0x806000
+  801e6b:	53                   	push   %ebx
+  801e6c:	e8 b4 e9 ff ff       	call   800825 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e71:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e76:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e7c:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e81:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e87:	83 c4 10             	add    $0x10,%esp
+  801e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e92:	c9                   	leave
+  801e93:	c3                   	ret
+
+00801e94 <devfile_write>:
+{
+  801e94:	55                   	push   %ebp
+  801e95:	89 e5                	mov    %esp,%ebp
+  801e97:	83 ec 0c             	sub    $0xc,%esp
+  801e9a:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ea0:	8b 52 0c             	mov    0xc(%edx),%edx
+  801ea3:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801ea9:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801eae:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801eb3:	39 d0                	cmp    %edx,%eax
+  801eb5:	0f 47 c2             	cmova  %edx,%eax
+  801eb8:	50                   	push   %eax
+  801eb9:	ff 75 0c             	push   0xc(%ebp)
+  801ebc:	68 08 60 80 00       	push   $0x806008
+  801ec1:	e8 e5 ea ff ff       	call   8009ab <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801ec6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ecb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ed0:	e8 cd fe ff ff       	call   801da2 <fsipc>
+}
+  801ed5:	c9                   	leave
+  801ed6:	c3                   	ret
+
+00801ed7 <devfile_read>:
+{
+  801ed7:	55                   	push   %ebp
+  801ed8:	89 e5                	mov    %esp,%ebp
+  801eda:	56                   	push   %esi
+  801edb:	53                   	push   %ebx
+  801edc:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801edf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801eea:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ef0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef5:	b8 03 00 00 00       	mov    $0x3,%eax
+  801efa:	e8 a3 fe ff ff       	call   801da2 <fsipc>
+  801eff:	89 c3                	mov    %eax,%ebx
+  801f01:	85 c0                	test   %eax,%eax
+  801f03:	78 1f                	js     801f24 <devfile_read+0x4d>
+	assert(r <= n);
+  801f05:	39 c6                	cmp    %eax,%esi
+  801f07:	72 24                	jb     801f2d <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f09:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f0e:	7f 33                	jg     801f43 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f10:	83 ec 04             	sub    $0x4,%esp
+  801f13:	50                   	push   %eax
+  801f14:	68 00 60 80 00       	push   $0x806000
+  801f19:	ff 75 0c             	push   0xc(%ebp)
+  801f1c:	e8 8a ea ff ff       	call   8009ab <memmove>
+	return r;
+  801f21:	83 c4 10             	add    $0x10,%esp
+}
+  801f24:	89 d8                	mov    %ebx,%eax
+  801f26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f29:	5b                   	pop    %ebx
+  801f2a:	5e                   	pop    %esi
+  801f2b:	5d                   	pop    %ebp
+  801f2c:	c3                   	ret
+	assert(r <= n);
+  801f2d:	68 88 2f 80 00       	push   $0x802f88
+  801f32:	68 8f 2f 80 00       	push   $0x802f8f
+  801f37:	6a 76                	push   $0x76
+  801f39:	68 a4 2f 80 00       	push   $0x802fa4
+  801f3e:	e8 bf e1 ff ff       	call   800102 <_panic>
+	assert(r <= PGSIZE);
+  801f43:	68 af 2f 80 00       	push   $0x802faf
+  801f48:	68 8f 2f 80 00       	push   $0x802f8f
+  801f4d:	6a 77                	push   $0x77
+  801f4f:	68 a4 2f 80 00       	push   $0x802fa4
+  801f54:	e8 a9 e1 ff ff       	call   800102 <_panic>
+
+00801f59 <open>:
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	56                   	push   %esi
+  801f5d:	53                   	push   %ebx
+  801f5e:	83 ec 1c             	sub    $0x1c,%esp
+  801f61:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f64:	56                   	push   %esi
+  801f65:	e8 80 e8 ff ff       	call   8007ea <strlen>
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f72:	7f 6c                	jg     801fe0 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f74:	83 ec 0c             	sub    $0xc,%esp
+  801f77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f7a:	50                   	push   %eax
+  801f7b:	e8 3a f8 ff ff       	call   8017ba <fd_alloc>
+  801f80:	89 c3                	mov    %eax,%ebx
+  801f82:	83 c4 10             	add    $0x10,%esp
+  801f85:	85 c0                	test   %eax,%eax
+  801f87:	78 3c                	js     801fc5 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f89:	83 ec 08             	sub    $0x8,%esp
+  801f8c:	56                   	push   %esi
+  801f8d:	68 00 60 80 00       	push   $0x806000
+  801f92:	e8 8e e8 ff ff       	call   800825 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f9a:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f9f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fa2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fa7:	e8 f6 fd ff ff       	call   801da2 <fsipc>
+  801fac:	89 c3                	mov    %eax,%ebx
+  801fae:	83 c4 10             	add    $0x10,%esp
+  801fb1:	85 c0                	test   %eax,%eax
+  801fb3:	78 19                	js     801fce <open+0x75>
+	return fd2num(fd);
+  801fb5:	83 ec 0c             	sub    $0xc,%esp
+  801fb8:	ff 75 f4             	push   -0xc(%ebp)
+  801fbb:	e8 d3 f7 ff ff       	call   801793 <fd2num>
+  801fc0:	89 c3                	mov    %eax,%ebx
+  801fc2:	83 c4 10             	add    $0x10,%esp
+}
+  801fc5:	89 d8                	mov    %ebx,%eax
+  801fc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fca:	5b                   	pop    %ebx
+  801fcb:	5e                   	pop    %esi
+  801fcc:	5d                   	pop    %ebp
+  801fcd:	c3                   	ret
+		fd_close(fd, 0);
+  801fce:	83 ec 08             	sub    $0x8,%esp
+  801fd1:	6a 00                	push   $0x0
+  801fd3:	ff 75 f4             	push   -0xc(%ebp)
+  801fd6:	e8 f8 f8 ff ff       	call   8018d3 <fd_close>
+		return r;
+  801fdb:	83 c4 10             	add    $0x10,%esp
+  801fde:	eb e5                	jmp    801fc5 <open+0x6c>
+		return -E_BAD_PATH;
+  801fe0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fe5:	eb de                	jmp    801fc5 <open+0x6c>
+
+00801fe7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801fe7:	55                   	push   %ebp
+  801fe8:	89 e5                	mov    %esp,%ebp
+  801fea:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801fed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff2:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ff7:	e8 a6 fd ff ff       	call   801da2 <fsipc>
+}
+  801ffc:	c9                   	leave
+  801ffd:	c3                   	ret
+
+00801ffe <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ffe:	55                   	push   %ebp
+  801fff:	89 e5                	mov    %esp,%ebp
+  802001:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802004:	68 bb 2f 80 00       	push   $0x802fbb
+  802009:	ff 75 0c             	push   0xc(%ebp)
+  80200c:	e8 14 e8 ff ff       	call   800825 <strcpy>
+	return 0;
+}
+  802011:	b8 00 00 00 00       	mov    $0x0,%eax
+  802016:	c9                   	leave
+  802017:	c3                   	ret
+
+00802018 <devsock_close>:
+{
+  802018:	55                   	push   %ebp
+  802019:	89 e5                	mov    %esp,%ebp
+  80201b:	53                   	push   %ebx
+  80201c:	83 ec 10             	sub    $0x10,%esp
+  80201f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802022:	53                   	push   %ebx
+  802023:	e8 e4 0a 00 00       	call   802b0c <pageref>
+  802028:	89 c2                	mov    %eax,%edx
+  80202a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80202d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802032:	83 fa 01             	cmp    $0x1,%edx
+  802035:	74 05                	je     80203c <devsock_close+0x24>
+}
+  802037:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80203a:	c9                   	leave
+  80203b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80203c:	83 ec 0c             	sub    $0xc,%esp
+  80203f:	ff 73 0c             	push   0xc(%ebx)
+  802042:	e8 b7 02 00 00       	call   8022fe <nsipc_close>
+  802047:	83 c4 10             	add    $0x10,%esp
+  80204a:	eb eb                	jmp    802037 <devsock_close+0x1f>
+
+0080204c <devsock_write>:
+{
+  80204c:	55                   	push   %ebp
+  80204d:	89 e5                	mov    %esp,%ebp
+  80204f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802052:	6a 00                	push   $0x0
+  802054:	ff 75 10             	push   0x10(%ebp)
+  802057:	ff 75 0c             	push   0xc(%ebp)
+  80205a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205d:	ff 70 0c             	push   0xc(%eax)
+  802060:	e8 79 03 00 00       	call   8023de <nsipc_send>
+}
+  802065:	c9                   	leave
+  802066:	c3                   	ret
+
+00802067 <devsock_read>:
+{
+  802067:	55                   	push   %ebp
+  802068:	89 e5                	mov    %esp,%ebp
+  80206a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80206d:	6a 00                	push   $0x0
+  80206f:	ff 75 10             	push   0x10(%ebp)
+  802072:	ff 75 0c             	push   0xc(%ebp)
+  802075:	8b 45 08             	mov    0x8(%ebp),%eax
+  802078:	ff 70 0c             	push   0xc(%eax)
+  80207b:	e8 ef 02 00 00       	call   80236f <nsipc_recv>
+}
+  802080:	c9                   	leave
+  802081:	c3                   	ret
+
+00802082 <fd2sockid>:
+{
+  802082:	55                   	push   %ebp
+  802083:	89 e5                	mov    %esp,%ebp
+  802085:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802088:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80208b:	52                   	push   %edx
+  80208c:	50                   	push   %eax
+  80208d:	e8 7e f7 ff ff       	call   801810 <fd_lookup>
+  802092:	83 c4 10             	add    $0x10,%esp
+  802095:	85 c0                	test   %eax,%eax
+  802097:	78 10                	js     8020a9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802099:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80209c:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8020a2:	39 08                	cmp    %ecx,(%eax)
+  8020a4:	75 05                	jne    8020ab <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020a6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020a9:	c9                   	leave
+  8020aa:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020b0:	eb f7                	jmp    8020a9 <fd2sockid+0x27>
+
+008020b2 <alloc_sockfd>:
+{
+  8020b2:	55                   	push   %ebp
+  8020b3:	89 e5                	mov    %esp,%ebp
+  8020b5:	56                   	push   %esi
+  8020b6:	53                   	push   %ebx
+  8020b7:	83 ec 1c             	sub    $0x1c,%esp
+  8020ba:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020bf:	50                   	push   %eax
+  8020c0:	e8 f5 f6 ff ff       	call   8017ba <fd_alloc>
+  8020c5:	89 c3                	mov    %eax,%ebx
+  8020c7:	83 c4 10             	add    $0x10,%esp
+  8020ca:	85 c0                	test   %eax,%eax
+  8020cc:	78 43                	js     802111 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020ce:	83 ec 04             	sub    $0x4,%esp
+  8020d1:	68 07 04 00 00       	push   $0x407
+  8020d6:	ff 75 f4             	push   -0xc(%ebp)
+  8020d9:	6a 00                	push   $0x0
+  8020db:	e8 3d ec ff ff       	call   800d1d <sys_page_alloc>
+  8020e0:	89 c3                	mov    %eax,%ebx
+  8020e2:	83 c4 10             	add    $0x10,%esp
+  8020e5:	85 c0                	test   %eax,%eax
+  8020e7:	78 28                	js     802111 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ec:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8020f2:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8020f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8020fe:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802101:	83 ec 0c             	sub    $0xc,%esp
+  802104:	50                   	push   %eax
+  802105:	e8 89 f6 ff ff       	call   801793 <fd2num>
+  80210a:	89 c3                	mov    %eax,%ebx
+  80210c:	83 c4 10             	add    $0x10,%esp
+  80210f:	eb 0c                	jmp    80211d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802111:	83 ec 0c             	sub    $0xc,%esp
+  802114:	56                   	push   %esi
+  802115:	e8 e4 01 00 00       	call   8022fe <nsipc_close>
+		return r;
+  80211a:	83 c4 10             	add    $0x10,%esp
+}
+  80211d:	89 d8                	mov    %ebx,%eax
+  80211f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802122:	5b                   	pop    %ebx
+  802123:	5e                   	pop    %esi
+  802124:	5d                   	pop    %ebp
+  802125:	c3                   	ret
+
+00802126 <accept>:
+{
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80212c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212f:	e8 4e ff ff ff       	call   802082 <fd2sockid>
+  802134:	85 c0                	test   %eax,%eax
+  802136:	78 1b                	js     802153 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802138:	83 ec 04             	sub    $0x4,%esp
+  80213b:	ff 75 10             	push   0x10(%ebp)
+  80213e:	ff 75 0c             	push   0xc(%ebp)
+  802141:	50                   	push   %eax
+  802142:	e8 0e 01 00 00       	call   802255 <nsipc_accept>
+  802147:	83 c4 10             	add    $0x10,%esp
+  80214a:	85 c0                	test   %eax,%eax
+  80214c:	78 05                	js     802153 <accept+0x2d>
+	return alloc_sockfd(r);
+  80214e:	e8 5f ff ff ff       	call   8020b2 <alloc_sockfd>
+}
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+
+00802155 <bind>:
+{
+  802155:	55                   	push   %ebp
+  802156:	89 e5                	mov    %esp,%ebp
+  802158:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80215b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80215e:	e8 1f ff ff ff       	call   802082 <fd2sockid>
+  802163:	85 c0                	test   %eax,%eax
+  802165:	78 12                	js     802179 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802167:	83 ec 04             	sub    $0x4,%esp
+  80216a:	ff 75 10             	push   0x10(%ebp)
+  80216d:	ff 75 0c             	push   0xc(%ebp)
+  802170:	50                   	push   %eax
+  802171:	e8 31 01 00 00       	call   8022a7 <nsipc_bind>
+  802176:	83 c4 10             	add    $0x10,%esp
+}
+  802179:	c9                   	leave
+  80217a:	c3                   	ret
+
+0080217b <shutdown>:
+{
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802181:	8b 45 08             	mov    0x8(%ebp),%eax
+  802184:	e8 f9 fe ff ff       	call   802082 <fd2sockid>
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	78 0f                	js     80219c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80218d:	83 ec 08             	sub    $0x8,%esp
+  802190:	ff 75 0c             	push   0xc(%ebp)
+  802193:	50                   	push   %eax
+  802194:	e8 43 01 00 00       	call   8022dc <nsipc_shutdown>
+  802199:	83 c4 10             	add    $0x10,%esp
+}
+  80219c:	c9                   	leave
+  80219d:	c3                   	ret
+
+0080219e <connect>:
+{
+  80219e:	55                   	push   %ebp
+  80219f:	89 e5                	mov    %esp,%ebp
+  8021a1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a7:	e8 d6 fe ff ff       	call   802082 <fd2sockid>
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	78 12                	js     8021c2 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021b0:	83 ec 04             	sub    $0x4,%esp
+  8021b3:	ff 75 10             	push   0x10(%ebp)
+  8021b6:	ff 75 0c             	push   0xc(%ebp)
+  8021b9:	50                   	push   %eax
+  8021ba:	e8 59 01 00 00       	call   802318 <nsipc_connect>
+  8021bf:	83 c4 10             	add    $0x10,%esp
+}
+  8021c2:	c9                   	leave
+  8021c3:	c3                   	ret
+
+008021c4 <listen>:
+{
+  8021c4:	55                   	push   %ebp
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021cd:	e8 b0 fe ff ff       	call   802082 <fd2sockid>
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 0f                	js     8021e5 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021d6:	83 ec 08             	sub    $0x8,%esp
+  8021d9:	ff 75 0c             	push   0xc(%ebp)
+  8021dc:	50                   	push   %eax
+  8021dd:	e8 6b 01 00 00       	call   80234d <nsipc_listen>
+  8021e2:	83 c4 10             	add    $0x10,%esp
+}
+  8021e5:	c9                   	leave
+  8021e6:	c3                   	ret
+
+008021e7 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021e7:	55                   	push   %ebp
+  8021e8:	89 e5                	mov    %esp,%ebp
+  8021ea:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021ed:	ff 75 10             	push   0x10(%ebp)
+  8021f0:	ff 75 0c             	push   0xc(%ebp)
+  8021f3:	ff 75 08             	push   0x8(%ebp)
+  8021f6:	e8 41 02 00 00       	call   80243c <nsipc_socket>
+  8021fb:	83 c4 10             	add    $0x10,%esp
+  8021fe:	85 c0                	test   %eax,%eax
+  802200:	78 05                	js     802207 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802202:	e8 ab fe ff ff       	call   8020b2 <alloc_sockfd>
+}
+  802207:	c9                   	leave
+  802208:	c3                   	ret
+
+00802209 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	53                   	push   %ebx
+  80220d:	83 ec 04             	sub    $0x4,%esp
+  802210:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802212:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802219:	74 26                	je     802241 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80221b:	6a 07                	push   $0x7
+  80221d:	68 00 70 80 00       	push   $0x807000
+  802222:	53                   	push   %ebx
+  802223:	ff 35 04 50 80 00    	push   0x805004
+  802229:	e8 4b 08 00 00       	call   802a79 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80222e:	83 c4 0c             	add    $0xc,%esp
+  802231:	6a 00                	push   $0x0
+  802233:	6a 00                	push   $0x0
+  802235:	6a 00                	push   $0x0
+  802237:	e8 25 08 00 00       	call   802a61 <ipc_recv>
+}
+  80223c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223f:	c9                   	leave
+  802240:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802241:	83 ec 0c             	sub    $0xc,%esp
+  802244:	6a 02                	push   $0x2
+  802246:	e8 82 08 00 00       	call   802acd <ipc_find_env>
+  80224b:	a3 04 50 80 00       	mov    %eax,0x805004
+  802250:	83 c4 10             	add    $0x10,%esp
+  802253:	eb c6                	jmp    80221b <nsipc+0x12>
+
+00802255 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802255:	55                   	push   %ebp
+  802256:	89 e5                	mov    %esp,%ebp
+  802258:	56                   	push   %esi
+  802259:	53                   	push   %ebx
+  80225a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80225d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802260:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802265:	8b 06                	mov    (%esi),%eax
+  802267:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80226c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802271:	e8 93 ff ff ff       	call   802209 <nsipc>
+  802276:	89 c3                	mov    %eax,%ebx
+  802278:	85 c0                	test   %eax,%eax
+  80227a:	79 09                	jns    802285 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80227c:	89 d8                	mov    %ebx,%eax
+  80227e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802281:	5b                   	pop    %ebx
+  802282:	5e                   	pop    %esi
+  802283:	5d                   	pop    %ebp
+  802284:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802285:	83 ec 04             	sub    $0x4,%esp
+  802288:	ff 35 10 70 80 00    	push   0x807010
+  80228e:	68 00 70 80 00       	push   $0x807000
+  802293:	ff 75 0c             	push   0xc(%ebp)
+  802296:	e8 10 e7 ff ff       	call   8009ab <memmove>
+		*addrlen = ret->ret_addrlen;
+  80229b:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022a0:	89 06                	mov    %eax,(%esi)
+  8022a2:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022a5:	eb d5                	jmp    80227c <nsipc_accept+0x27>
+
+008022a7 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022a7:	55                   	push   %ebp
+  8022a8:	89 e5                	mov    %esp,%ebp
+  8022aa:	53                   	push   %ebx
+  8022ab:	83 ec 08             	sub    $0x8,%esp
+  8022ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b4:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022b9:	53                   	push   %ebx
+  8022ba:	ff 75 0c             	push   0xc(%ebp)
+  8022bd:	68 04 70 80 00       	push   $0x807004
+  8022c2:	e8 e4 e6 ff ff       	call   8009ab <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022c7:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022cd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022d2:	e8 32 ff ff ff       	call   802209 <nsipc>
+}
+  8022d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022da:	c9                   	leave
+  8022db:	c3                   	ret
+
+008022dc <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022dc:	55                   	push   %ebp
+  8022dd:	89 e5                	mov    %esp,%ebp
+  8022df:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8022ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ed:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8022f2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022f7:	e8 0d ff ff ff       	call   802209 <nsipc>
+}
+  8022fc:	c9                   	leave
+  8022fd:	c3                   	ret
+
+008022fe <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8022fe:	55                   	push   %ebp
+  8022ff:	89 e5                	mov    %esp,%ebp
+  802301:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802304:	8b 45 08             	mov    0x8(%ebp),%eax
+  802307:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80230c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802311:	e8 f3 fe ff ff       	call   802209 <nsipc>
+}
+  802316:	c9                   	leave
+  802317:	c3                   	ret
+
+00802318 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802318:	55                   	push   %ebp
+  802319:	89 e5                	mov    %esp,%ebp
+  80231b:	53                   	push   %ebx
+  80231c:	83 ec 08             	sub    $0x8,%esp
+  80231f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802322:	8b 45 08             	mov    0x8(%ebp),%eax
+  802325:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80232a:	53                   	push   %ebx
+  80232b:	ff 75 0c             	push   0xc(%ebp)
+  80232e:	68 04 70 80 00       	push   $0x807004
+  802333:	e8 73 e6 ff ff       	call   8009ab <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802338:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80233e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802343:	e8 c1 fe ff ff       	call   802209 <nsipc>
+}
+  802348:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+0080234d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80234d:	55                   	push   %ebp
+  80234e:	89 e5                	mov    %esp,%ebp
+  802350:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802353:	8b 45 08             	mov    0x8(%ebp),%eax
+  802356:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80235b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80235e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802363:	b8 06 00 00 00       	mov    $0x6,%eax
+  802368:	e8 9c fe ff ff       	call   802209 <nsipc>
+}
+  80236d:	c9                   	leave
+  80236e:	c3                   	ret
+
+0080236f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80236f:	55                   	push   %ebp
+  802370:	89 e5                	mov    %esp,%ebp
+  802372:	56                   	push   %esi
+  802373:	53                   	push   %ebx
+  802374:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802377:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  80237f:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802385:	8b 45 14             	mov    0x14(%ebp),%eax
+  802388:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80238d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802392:	e8 72 fe ff ff       	call   802209 <nsipc>
+  802397:	89 c3                	mov    %eax,%ebx
+  802399:	85 c0                	test   %eax,%eax
+  80239b:	78 22                	js     8023bf <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80239d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023a2:	39 c6                	cmp    %eax,%esi
+  8023a4:	0f 4e c6             	cmovle %esi,%eax
+  8023a7:	39 c3                	cmp    %eax,%ebx
+  8023a9:	7f 1d                	jg     8023c8 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023ab:	83 ec 04             	sub    $0x4,%esp
+  8023ae:	53                   	push   %ebx
+  8023af:	68 00 70 80 00       	push   $0x807000
+  8023b4:	ff 75 0c             	push   0xc(%ebp)
+  8023b7:	e8 ef e5 ff ff       	call   8009ab <memmove>
+  8023bc:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023bf:	89 d8                	mov    %ebx,%eax
+  8023c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023c4:	5b                   	pop    %ebx
+  8023c5:	5e                   	pop    %esi
+  8023c6:	5d                   	pop    %ebp
+  8023c7:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023c8:	68 c7 2f 80 00       	push   $0x802fc7
+  8023cd:	68 8f 2f 80 00       	push   $0x802f8f
+  8023d2:	6a 62                	push   $0x62
+  8023d4:	68 dc 2f 80 00       	push   $0x802fdc
+  8023d9:	e8 24 dd ff ff       	call   800102 <_panic>
+
+008023de <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023de:	55                   	push   %ebp
+  8023df:	89 e5                	mov    %esp,%ebp
+  8023e1:	53                   	push   %ebx
+  8023e2:	83 ec 04             	sub    $0x4,%esp
+  8023e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023eb:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8023f0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8023f6:	7f 2e                	jg     802426 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8023f8:	83 ec 04             	sub    $0x4,%esp
+  8023fb:	53                   	push   %ebx
+  8023fc:	ff 75 0c             	push   0xc(%ebp)
+  8023ff:	68 0c 70 80 00       	push   $0x80700c
+  802404:	e8 a2 e5 ff ff       	call   8009ab <memmove>
+	nsipcbuf.send.req_size = size;
+  802409:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80240f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802412:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802417:	b8 08 00 00 00       	mov    $0x8,%eax
+  80241c:	e8 e8 fd ff ff       	call   802209 <nsipc>
+}
+  802421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802424:	c9                   	leave
+  802425:	c3                   	ret
+	assert(size < 1600);
+  802426:	68 e8 2f 80 00       	push   $0x802fe8
+  80242b:	68 8f 2f 80 00       	push   $0x802f8f
+  802430:	6a 6d                	push   $0x6d
+  802432:	68 dc 2f 80 00       	push   $0x802fdc
+  802437:	e8 c6 dc ff ff       	call   800102 <_panic>
+
+0080243c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80243c:	55                   	push   %ebp
+  80243d:	89 e5                	mov    %esp,%ebp
+  80243f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802442:	8b 45 08             	mov    0x8(%ebp),%eax
+  802445:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80244a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80244d:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802452:	8b 45 10             	mov    0x10(%ebp),%eax
+  802455:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80245a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80245f:	e8 a5 fd ff ff       	call   802209 <nsipc>
+}
+  802464:	c9                   	leave
+  802465:	c3                   	ret
+
+00802466 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802466:	55                   	push   %ebp
+  802467:	89 e5                	mov    %esp,%ebp
+  802469:	56                   	push   %esi
+  80246a:	53                   	push   %ebx
+  80246b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80246e:	83 ec 0c             	sub    $0xc,%esp
+  802471:	ff 75 08             	push   0x8(%ebp)
+  802474:	e8 2a f3 ff ff       	call   8017a3 <fd2data>
+  802479:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80247b:	83 c4 08             	add    $0x8,%esp
+  80247e:	68 f4 2f 80 00       	push   $0x802ff4
+  802483:	53                   	push   %ebx
+  802484:	e8 9c e3 ff ff       	call   800825 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802489:	8b 46 04             	mov    0x4(%esi),%eax
+  80248c:	2b 06                	sub    (%esi),%eax
+  80248e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802494:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80249b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80249e:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024a5:	40 80 00 
+	return 0;
+}
+  8024a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024b0:	5b                   	pop    %ebx
+  8024b1:	5e                   	pop    %esi
+  8024b2:	5d                   	pop    %ebp
+  8024b3:	c3                   	ret
+
+008024b4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024b4:	55                   	push   %ebp
+  8024b5:	89 e5                	mov    %esp,%ebp
+  8024b7:	53                   	push   %ebx
+  8024b8:	83 ec 0c             	sub    $0xc,%esp
+  8024bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024be:	53                   	push   %ebx
+  8024bf:	6a 00                	push   $0x0
+  8024c1:	e8 32 e9 ff ff       	call   800df8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024c6:	89 1c 24             	mov    %ebx,(%esp)
+  8024c9:	e8 d5 f2 ff ff       	call   8017a3 <fd2data>
+  8024ce:	83 c4 08             	add    $0x8,%esp
+  8024d1:	50                   	push   %eax
+  8024d2:	6a 00                	push   $0x0
+  8024d4:	e8 1f e9 ff ff       	call   800df8 <sys_page_unmap>
+}
+  8024d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024dc:	c9                   	leave
+  8024dd:	c3                   	ret
+
+008024de <_pipeisclosed>:
+{
+  8024de:	55                   	push   %ebp
+  8024df:	89 e5                	mov    %esp,%ebp
+  8024e1:	57                   	push   %edi
+  8024e2:	56                   	push   %esi
+  8024e3:	53                   	push   %ebx
+  8024e4:	83 ec 1c             	sub    $0x1c,%esp
+  8024e7:	89 c7                	mov    %eax,%edi
+  8024e9:	89 d6                	mov    %edx,%esi
+  8024eb:	eb 3c                	jmp    802529 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8024ed:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8024f0:	83 ec 0c             	sub    $0xc,%esp
+  8024f3:	57                   	push   %edi
+  8024f4:	e8 13 06 00 00       	call   802b0c <pageref>
+  8024f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024fc:	89 34 24             	mov    %esi,(%esp)
+  8024ff:	e8 08 06 00 00       	call   802b0c <pageref>
+  802504:	89 c2                	mov    %eax,%edx
+  802506:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802508:	05 00 00 00 20       	add    $0x20000000,%eax
+  80250d:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802510:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802516:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80251b:	76 31                	jbe    80254e <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  80251d:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802520:	39 c3                	cmp    %eax,%ebx
+  802522:	74 76                	je     80259a <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802524:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802527:	74 36                	je     80255f <_pipeisclosed+0x81>
+  802529:	89 e0                	mov    %esp,%eax
+  80252b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802530:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802536:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80253b:	77 b0                	ja     8024ed <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80253d:	c1 e8 10             	shr    $0x10,%eax
+  802540:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802546:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80254c:	eb 9f                	jmp    8024ed <_pipeisclosed+0xf>
+  80254e:	c1 e8 10             	shr    $0x10,%eax
+  802551:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802557:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80255d:	eb be                	jmp    80251d <_pipeisclosed+0x3f>
+  80255f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802561:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802566:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80256c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802571:	76 16                	jbe    802589 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802573:	8b 42 58             	mov    0x58(%edx),%eax
+  802576:	6a 01                	push   $0x1
+  802578:	50                   	push   %eax
+  802579:	53                   	push   %ebx
+  80257a:	68 fb 2f 80 00       	push   $0x802ffb
+  80257f:	e8 59 dc ff ff       	call   8001dd <cprintf>
+  802584:	83 c4 10             	add    $0x10,%esp
+  802587:	eb a0                	jmp    802529 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802589:	c1 e8 10             	shr    $0x10,%eax
+  80258c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802592:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802598:	eb d9                	jmp    802573 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80259a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80259d:	0f 94 c0             	sete   %al
+  8025a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8025a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025a6:	5b                   	pop    %ebx
+  8025a7:	5e                   	pop    %esi
+  8025a8:	5f                   	pop    %edi
+  8025a9:	5d                   	pop    %ebp
+  8025aa:	c3                   	ret
+
+008025ab <devpipe_write>:
+{
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+  8025ae:	57                   	push   %edi
+  8025af:	56                   	push   %esi
+  8025b0:	53                   	push   %ebx
+  8025b1:	83 ec 28             	sub    $0x28,%esp
+  8025b4:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025b7:	56                   	push   %esi
+  8025b8:	e8 e6 f1 ff ff       	call   8017a3 <fd2data>
+  8025bd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025bf:	83 c4 10             	add    $0x10,%esp
+  8025c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c7:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025ca:	75 09                	jne    8025d5 <devpipe_write+0x2a>
+	return i;
+  8025cc:	89 f8                	mov    %edi,%eax
+  8025ce:	eb 23                	jmp    8025f3 <devpipe_write+0x48>
+			sys_yield();
+  8025d0:	e8 02 e7 ff ff       	call   800cd7 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025d5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025d8:	8b 0b                	mov    (%ebx),%ecx
+  8025da:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025dd:	39 d0                	cmp    %edx,%eax
+  8025df:	72 1a                	jb     8025fb <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025e1:	89 da                	mov    %ebx,%edx
+  8025e3:	89 f0                	mov    %esi,%eax
+  8025e5:	e8 f4 fe ff ff       	call   8024de <_pipeisclosed>
+  8025ea:	85 c0                	test   %eax,%eax
+  8025ec:	74 e2                	je     8025d0 <devpipe_write+0x25>
+				return 0;
+  8025ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025f6:	5b                   	pop    %ebx
+  8025f7:	5e                   	pop    %esi
+  8025f8:	5f                   	pop    %edi
+  8025f9:	5d                   	pop    %ebp
+  8025fa:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025fe:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802602:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802605:	89 c2                	mov    %eax,%edx
+  802607:	c1 fa 1f             	sar    $0x1f,%edx
+  80260a:	89 d1                	mov    %edx,%ecx
+  80260c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80260f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802612:	83 e2 1f             	and    $0x1f,%edx
+  802615:	29 ca                	sub    %ecx,%edx
+  802617:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80261b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80261f:	83 c0 01             	add    $0x1,%eax
+  802622:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802625:	83 c7 01             	add    $0x1,%edi
+  802628:	eb 9d                	jmp    8025c7 <devpipe_write+0x1c>
+
+0080262a <devpipe_read>:
+{
+  80262a:	55                   	push   %ebp
+  80262b:	89 e5                	mov    %esp,%ebp
+  80262d:	57                   	push   %edi
+  80262e:	56                   	push   %esi
+  80262f:	53                   	push   %ebx
+  802630:	83 ec 18             	sub    $0x18,%esp
+  802633:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802636:	57                   	push   %edi
+  802637:	e8 67 f1 ff ff       	call   8017a3 <fd2data>
+  80263c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80263e:	83 c4 10             	add    $0x10,%esp
+  802641:	be 00 00 00 00       	mov    $0x0,%esi
+  802646:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802649:	75 13                	jne    80265e <devpipe_read+0x34>
+	return i;
+  80264b:	89 f0                	mov    %esi,%eax
+  80264d:	eb 02                	jmp    802651 <devpipe_read+0x27>
+				return i;
+  80264f:	89 f0                	mov    %esi,%eax
+}
+  802651:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802654:	5b                   	pop    %ebx
+  802655:	5e                   	pop    %esi
+  802656:	5f                   	pop    %edi
+  802657:	5d                   	pop    %ebp
+  802658:	c3                   	ret
+			sys_yield();
+  802659:	e8 79 e6 ff ff       	call   800cd7 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80265e:	8b 03                	mov    (%ebx),%eax
+  802660:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802663:	75 18                	jne    80267d <devpipe_read+0x53>
+			if (i > 0)
+  802665:	85 f6                	test   %esi,%esi
+  802667:	75 e6                	jne    80264f <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802669:	89 da                	mov    %ebx,%edx
+  80266b:	89 f8                	mov    %edi,%eax
+  80266d:	e8 6c fe ff ff       	call   8024de <_pipeisclosed>
+  802672:	85 c0                	test   %eax,%eax
+  802674:	74 e3                	je     802659 <devpipe_read+0x2f>
+				return 0;
+  802676:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267b:	eb d4                	jmp    802651 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80267d:	99                   	cltd
+  80267e:	c1 ea 1b             	shr    $0x1b,%edx
+  802681:	01 d0                	add    %edx,%eax
+  802683:	83 e0 1f             	and    $0x1f,%eax
+  802686:	29 d0                	sub    %edx,%eax
+  802688:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80268d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802690:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802693:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802696:	83 c6 01             	add    $0x1,%esi
+  802699:	eb ab                	jmp    802646 <devpipe_read+0x1c>
+
+0080269b <pipe>:
+{
+  80269b:	55                   	push   %ebp
+  80269c:	89 e5                	mov    %esp,%ebp
+  80269e:	56                   	push   %esi
+  80269f:	53                   	push   %ebx
+  8026a0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026a6:	50                   	push   %eax
+  8026a7:	e8 0e f1 ff ff       	call   8017ba <fd_alloc>
+  8026ac:	89 c3                	mov    %eax,%ebx
+  8026ae:	83 c4 10             	add    $0x10,%esp
+  8026b1:	85 c0                	test   %eax,%eax
+  8026b3:	0f 88 23 01 00 00    	js     8027dc <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026b9:	83 ec 04             	sub    $0x4,%esp
+  8026bc:	68 07 04 00 00       	push   $0x407
+  8026c1:	ff 75 f4             	push   -0xc(%ebp)
+  8026c4:	6a 00                	push   $0x0
+  8026c6:	e8 52 e6 ff ff       	call   800d1d <sys_page_alloc>
+  8026cb:	89 c3                	mov    %eax,%ebx
+  8026cd:	83 c4 10             	add    $0x10,%esp
+  8026d0:	85 c0                	test   %eax,%eax
+  8026d2:	0f 88 04 01 00 00    	js     8027dc <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026d8:	83 ec 0c             	sub    $0xc,%esp
+  8026db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026de:	50                   	push   %eax
+  8026df:	e8 d6 f0 ff ff       	call   8017ba <fd_alloc>
+  8026e4:	89 c3                	mov    %eax,%ebx
+  8026e6:	83 c4 10             	add    $0x10,%esp
+  8026e9:	85 c0                	test   %eax,%eax
+  8026eb:	0f 88 db 00 00 00    	js     8027cc <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f1:	83 ec 04             	sub    $0x4,%esp
+  8026f4:	68 07 04 00 00       	push   $0x407
+  8026f9:	ff 75 f0             	push   -0x10(%ebp)
+  8026fc:	6a 00                	push   $0x0
+  8026fe:	e8 1a e6 ff ff       	call   800d1d <sys_page_alloc>
+  802703:	89 c3                	mov    %eax,%ebx
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	0f 88 bc 00 00 00    	js     8027cc <pipe+0x131>
+	va = fd2data(fd0);
+  802710:	83 ec 0c             	sub    $0xc,%esp
+  802713:	ff 75 f4             	push   -0xc(%ebp)
+  802716:	e8 88 f0 ff ff       	call   8017a3 <fd2data>
+  80271b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80271d:	83 c4 0c             	add    $0xc,%esp
+  802720:	68 07 04 00 00       	push   $0x407
+  802725:	50                   	push   %eax
+  802726:	6a 00                	push   $0x0
+  802728:	e8 f0 e5 ff ff       	call   800d1d <sys_page_alloc>
+  80272d:	89 c3                	mov    %eax,%ebx
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	85 c0                	test   %eax,%eax
+  802734:	0f 88 82 00 00 00    	js     8027bc <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80273a:	83 ec 0c             	sub    $0xc,%esp
+  80273d:	ff 75 f0             	push   -0x10(%ebp)
+  802740:	e8 5e f0 ff ff       	call   8017a3 <fd2data>
+  802745:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80274c:	50                   	push   %eax
+  80274d:	6a 00                	push   $0x0
+  80274f:	56                   	push   %esi
+  802750:	6a 00                	push   $0x0
+  802752:	e8 33 e6 ff ff       	call   800d8a <sys_page_map>
+  802757:	89 c3                	mov    %eax,%ebx
+  802759:	83 c4 20             	add    $0x20,%esp
+  80275c:	85 c0                	test   %eax,%eax
+  80275e:	78 4e                	js     8027ae <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802760:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802765:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802768:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80276a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80276d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802774:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802777:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802779:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80277c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802783:	83 ec 0c             	sub    $0xc,%esp
+  802786:	ff 75 f4             	push   -0xc(%ebp)
+  802789:	e8 05 f0 ff ff       	call   801793 <fd2num>
+  80278e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802791:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802793:	83 c4 04             	add    $0x4,%esp
+  802796:	ff 75 f0             	push   -0x10(%ebp)
+  802799:	e8 f5 ef ff ff       	call   801793 <fd2num>
+  80279e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027a1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027ac:	eb 2e                	jmp    8027dc <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027ae:	83 ec 08             	sub    $0x8,%esp
+  8027b1:	56                   	push   %esi
+  8027b2:	6a 00                	push   $0x0
+  8027b4:	e8 3f e6 ff ff       	call   800df8 <sys_page_unmap>
+  8027b9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027bc:	83 ec 08             	sub    $0x8,%esp
+  8027bf:	ff 75 f0             	push   -0x10(%ebp)
+  8027c2:	6a 00                	push   $0x0
+  8027c4:	e8 2f e6 ff ff       	call   800df8 <sys_page_unmap>
+  8027c9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027cc:	83 ec 08             	sub    $0x8,%esp
+  8027cf:	ff 75 f4             	push   -0xc(%ebp)
+  8027d2:	6a 00                	push   $0x0
+  8027d4:	e8 1f e6 ff ff       	call   800df8 <sys_page_unmap>
+  8027d9:	83 c4 10             	add    $0x10,%esp
+}
+  8027dc:	89 d8                	mov    %ebx,%eax
+  8027de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027e1:	5b                   	pop    %ebx
+  8027e2:	5e                   	pop    %esi
+  8027e3:	5d                   	pop    %ebp
+  8027e4:	c3                   	ret
+
+008027e5 <pipeisclosed>:
+{
+  8027e5:	55                   	push   %ebp
+  8027e6:	89 e5                	mov    %esp,%ebp
+  8027e8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027ee:	50                   	push   %eax
+  8027ef:	ff 75 08             	push   0x8(%ebp)
+  8027f2:	e8 19 f0 ff ff       	call   801810 <fd_lookup>
+  8027f7:	83 c4 10             	add    $0x10,%esp
+  8027fa:	85 c0                	test   %eax,%eax
+  8027fc:	78 18                	js     802816 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027fe:	83 ec 0c             	sub    $0xc,%esp
+  802801:	ff 75 f4             	push   -0xc(%ebp)
+  802804:	e8 9a ef ff ff       	call   8017a3 <fd2data>
+  802809:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80280b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80280e:	e8 cb fc ff ff       	call   8024de <_pipeisclosed>
+  802813:	83 c4 10             	add    $0x10,%esp
+}
+  802816:	c9                   	leave
+  802817:	c3                   	ret
+
+00802818 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281d:	c3                   	ret
+
+0080281e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80281e:	55                   	push   %ebp
+  80281f:	89 e5                	mov    %esp,%ebp
+  802821:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802824:	68 13 30 80 00       	push   $0x803013
+  802829:	ff 75 0c             	push   0xc(%ebp)
+  80282c:	e8 f4 df ff ff       	call   800825 <strcpy>
+	return 0;
+}
+  802831:	b8 00 00 00 00       	mov    $0x0,%eax
+  802836:	c9                   	leave
+  802837:	c3                   	ret
+
+00802838 <devcons_write>:
+{
+  802838:	55                   	push   %ebp
+  802839:	89 e5                	mov    %esp,%ebp
+  80283b:	57                   	push   %edi
+  80283c:	56                   	push   %esi
+  80283d:	53                   	push   %ebx
+  80283e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802844:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802849:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80284f:	eb 2e                	jmp    80287f <devcons_write+0x47>
+		m = n - tot;
+  802851:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802854:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802856:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80285b:	39 c3                	cmp    %eax,%ebx
+  80285d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802860:	83 ec 04             	sub    $0x4,%esp
+  802863:	53                   	push   %ebx
+  802864:	89 f0                	mov    %esi,%eax
+  802866:	03 45 0c             	add    0xc(%ebp),%eax
+  802869:	50                   	push   %eax
+  80286a:	57                   	push   %edi
+  80286b:	e8 3b e1 ff ff       	call   8009ab <memmove>
+		sys_cputs(buf, m);
+  802870:	83 c4 08             	add    $0x8,%esp
+  802873:	53                   	push   %ebx
+  802874:	57                   	push   %edi
+  802875:	e8 24 e3 ff ff       	call   800b9e <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80287a:	01 de                	add    %ebx,%esi
+  80287c:	83 c4 10             	add    $0x10,%esp
+  80287f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802882:	72 cd                	jb     802851 <devcons_write+0x19>
+}
+  802884:	89 f0                	mov    %esi,%eax
+  802886:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802889:	5b                   	pop    %ebx
+  80288a:	5e                   	pop    %esi
+  80288b:	5f                   	pop    %edi
+  80288c:	5d                   	pop    %ebp
+  80288d:	c3                   	ret
+
+0080288e <devcons_read>:
+{
+  80288e:	55                   	push   %ebp
+  80288f:	89 e5                	mov    %esp,%ebp
+  802891:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802894:	b8 00 00 00 00       	mov    $0x0,%eax
+  802899:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80289d:	75 07                	jne    8028a6 <devcons_read+0x18>
+  80289f:	eb 1f                	jmp    8028c0 <devcons_read+0x32>
+		sys_yield();
+  8028a1:	e8 31 e4 ff ff       	call   800cd7 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028a6:	e8 37 e3 ff ff       	call   800be2 <sys_cgetc>
+  8028ab:	85 c0                	test   %eax,%eax
+  8028ad:	74 f2                	je     8028a1 <devcons_read+0x13>
+	if (c < 0)
+  8028af:	78 0f                	js     8028c0 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028b1:	83 f8 04             	cmp    $0x4,%eax
+  8028b4:	74 0c                	je     8028c2 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028b9:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028bb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028c0:	c9                   	leave
+  8028c1:	c3                   	ret
+		return 0;
+  8028c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c7:	eb f7                	jmp    8028c0 <devcons_read+0x32>
+
+008028c9 <cputchar>:
+{
+  8028c9:	55                   	push   %ebp
+  8028ca:	89 e5                	mov    %esp,%ebp
+  8028cc:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d2:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028d5:	6a 01                	push   $0x1
+  8028d7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028da:	50                   	push   %eax
+  8028db:	e8 be e2 ff ff       	call   800b9e <sys_cputs>
+}
+  8028e0:	83 c4 10             	add    $0x10,%esp
+  8028e3:	c9                   	leave
+  8028e4:	c3                   	ret
+
+008028e5 <getchar>:
+{
+  8028e5:	55                   	push   %ebp
+  8028e6:	89 e5                	mov    %esp,%ebp
+  8028e8:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028eb:	6a 01                	push   $0x1
+  8028ed:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028f0:	50                   	push   %eax
+  8028f1:	6a 00                	push   $0x0
+  8028f3:	e8 9e f1 ff ff       	call   801a96 <read>
+	if (r < 0)
+  8028f8:	83 c4 10             	add    $0x10,%esp
+  8028fb:	85 c0                	test   %eax,%eax
+  8028fd:	78 06                	js     802905 <getchar+0x20>
+	if (r < 1)
+  8028ff:	74 06                	je     802907 <getchar+0x22>
+	return c;
+  802901:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802905:	c9                   	leave
+  802906:	c3                   	ret
+		return -E_EOF;
+  802907:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80290c:	eb f7                	jmp    802905 <getchar+0x20>
+
+0080290e <iscons>:
+{
+  80290e:	55                   	push   %ebp
+  80290f:	89 e5                	mov    %esp,%ebp
+  802911:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802914:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802917:	50                   	push   %eax
+  802918:	ff 75 08             	push   0x8(%ebp)
+  80291b:	e8 f0 ee ff ff       	call   801810 <fd_lookup>
+  802920:	83 c4 10             	add    $0x10,%esp
+  802923:	85 c0                	test   %eax,%eax
+  802925:	78 11                	js     802938 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802927:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80292a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802930:	39 10                	cmp    %edx,(%eax)
+  802932:	0f 94 c0             	sete   %al
+  802935:	0f b6 c0             	movzbl %al,%eax
+}
+  802938:	c9                   	leave
+  802939:	c3                   	ret
+
+0080293a <opencons>:
+{
+  80293a:	55                   	push   %ebp
+  80293b:	89 e5                	mov    %esp,%ebp
+  80293d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802940:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802943:	50                   	push   %eax
+  802944:	e8 71 ee ff ff       	call   8017ba <fd_alloc>
+  802949:	83 c4 10             	add    $0x10,%esp
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	78 3a                	js     80298a <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802950:	83 ec 04             	sub    $0x4,%esp
+  802953:	68 07 04 00 00       	push   $0x407
+  802958:	ff 75 f4             	push   -0xc(%ebp)
+  80295b:	6a 00                	push   $0x0
+  80295d:	e8 bb e3 ff ff       	call   800d1d <sys_page_alloc>
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	85 c0                	test   %eax,%eax
+  802967:	78 21                	js     80298a <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802969:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80296c:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802972:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802974:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802977:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80297e:	83 ec 0c             	sub    $0xc,%esp
+  802981:	50                   	push   %eax
+  802982:	e8 0c ee ff ff       	call   801793 <fd2num>
+  802987:	83 c4 10             	add    $0x10,%esp
+}
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	56                   	push   %esi
+  802990:	53                   	push   %ebx
+  802991:	8b 75 08             	mov    0x8(%ebp),%esi
+  802994:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802997:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029a1:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8029a4:	83 ec 08             	sub    $0x8,%esp
+  8029a7:	ff 75 14             	push   0x14(%ebp)
+  8029aa:	50                   	push   %eax
+  8029ab:	e8 7e e7 ff ff       	call   80112e <sys_ipc_recv_until>
+  8029b0:	83 c4 10             	add    $0x10,%esp
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	78 61                	js     802a18 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029b7:	85 f6                	test   %esi,%esi
+  8029b9:	74 1c                	je     8029d7 <ipc_recv_until+0x4b>
+  8029bb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029bd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029c2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029c8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029cd:	76 5f                	jbe    802a2e <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029cf:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029d5:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029d7:	85 db                	test   %ebx,%ebx
+  8029d9:	74 1c                	je     8029f7 <ipc_recv_until+0x6b>
+  8029db:	89 e0                	mov    %esp,%eax
+  8029dd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029e2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029e8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029ed:	76 50                	jbe    802a3f <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8029ef:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8029f5:	89 03                	mov    %eax,(%ebx)
+  8029f7:	89 e0                	mov    %esp,%eax
+  8029f9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029fe:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a04:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a09:	76 45                	jbe    802a50 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a0b:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a14:	5b                   	pop    %ebx
+  802a15:	5e                   	pop    %esi
+  802a16:	5d                   	pop    %ebp
+  802a17:	c3                   	ret
+		if (from_env_store)
+  802a18:	85 f6                	test   %esi,%esi
+  802a1a:	74 06                	je     802a22 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a1c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a22:	85 db                	test   %ebx,%ebx
+  802a24:	74 eb                	je     802a11 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a26:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a2c:	eb e3                	jmp    802a11 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a2e:	c1 e8 10             	shr    $0x10,%eax
+  802a31:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a37:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a3d:	eb 90                	jmp    8029cf <ipc_recv_until+0x43>
+  802a3f:	c1 e8 10             	shr    $0x10,%eax
+  802a42:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a48:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a4e:	eb 9f                	jmp    8029ef <ipc_recv_until+0x63>
+  802a50:	c1 e8 10             	shr    $0x10,%eax
+  802a53:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a59:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a5f:	eb aa                	jmp    802a0b <ipc_recv_until+0x7f>
+
+00802a61 <ipc_recv>:
+{
+  802a61:	55                   	push   %ebp
+  802a62:	89 e5                	mov    %esp,%ebp
+  802a64:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a67:	6a 00                	push   $0x0
+  802a69:	ff 75 10             	push   0x10(%ebp)
+  802a6c:	ff 75 0c             	push   0xc(%ebp)
+  802a6f:	ff 75 08             	push   0x8(%ebp)
+  802a72:	e8 15 ff ff ff       	call   80298c <ipc_recv_until>
+}
+  802a77:	c9                   	leave
+  802a78:	c3                   	ret
+
+00802a79 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a79:	55                   	push   %ebp
+  802a7a:	89 e5                	mov    %esp,%ebp
+  802a7c:	57                   	push   %edi
+  802a7d:	56                   	push   %esi
+  802a7e:	53                   	push   %ebx
+  802a7f:	83 ec 0c             	sub    $0xc,%esp
+  802a82:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a85:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a8b:	85 db                	test   %ebx,%ebx
+  802a8d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a92:	0f 44 d8             	cmove  %eax,%ebx
+  802a95:	eb 05                	jmp    802a9c <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802a97:	e8 3b e2 ff ff       	call   800cd7 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802a9c:	ff 75 14             	push   0x14(%ebp)
+  802a9f:	53                   	push   %ebx
+  802aa0:	56                   	push   %esi
+  802aa1:	57                   	push   %edi
+  802aa2:	e8 d3 e5 ff ff       	call   80107a <sys_ipc_try_send>
+  802aa7:	83 c4 10             	add    $0x10,%esp
+  802aaa:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802aad:	74 e8                	je     802a97 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	78 08                	js     802abb <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802ab3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ab6:	5b                   	pop    %ebx
+  802ab7:	5e                   	pop    %esi
+  802ab8:	5f                   	pop    %edi
+  802ab9:	5d                   	pop    %ebp
+  802aba:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802abb:	50                   	push   %eax
+  802abc:	68 1f 30 80 00       	push   $0x80301f
+  802ac1:	6a 4f                	push   $0x4f
+  802ac3:	68 32 30 80 00       	push   $0x803032
+  802ac8:	e8 35 d6 ff ff       	call   800102 <_panic>
+
+00802acd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802acd:	55                   	push   %ebp
+  802ace:	89 e5                	mov    %esp,%ebp
+  802ad0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ad8:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802ade:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ae4:	8b 52 50             	mov    0x50(%edx),%edx
+  802ae7:	39 ca                	cmp    %ecx,%edx
+  802ae9:	74 11                	je     802afc <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802aeb:	83 c0 01             	add    $0x1,%eax
+  802aee:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802af3:	75 e3                	jne    802ad8 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afa:	eb 0e                	jmp    802b0a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802afc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b02:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b07:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b0a:	5d                   	pop    %ebp
+  802b0b:	c3                   	ret
+
+00802b0c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b0c:	55                   	push   %ebp
+  802b0d:	89 e5                	mov    %esp,%ebp
+  802b0f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b12:	89 c2                	mov    %eax,%edx
+  802b14:	c1 ea 16             	shr    $0x16,%edx
+  802b17:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b1e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b23:	f6 c1 01             	test   $0x1,%cl
+  802b26:	74 1a                	je     802b42 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b28:	c1 e8 0c             	shr    $0xc,%eax
+  802b2b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b32:	a8 01                	test   $0x1,%al
+  802b34:	74 0c                	je     802b42 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b36:	c1 e8 0c             	shr    $0xc,%eax
+  802b39:	c1 e0 04             	shl    $0x4,%eax
+  802b3c:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b42:	89 d0                	mov    %edx,%eax
+  802b44:	5d                   	pop    %ebp
+  802b45:	c3                   	ret
@@ -0,0 +1,7378 @@
+
+obj/user/forkbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 64 02 00 00       	call   800295 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <bench_fork>:
+typedef envid_t (*forkfn_t)(void);
+
+// The mean cycles, >> 10, that one call of 'forkfn' takes.
+static uint32_t
+bench_fork(forkfn_t forkfn)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	uint64_t start, total = 0;
+	envid_t envid;
+	int i;
+
+	for (i = 0; i < NFORKS; i++) {
+  80003f:	c7 45 dc 15 00 00 00 	movl   $0x15,-0x24(%ebp)
+	uint64_t start, total = 0;
+  800046:	be 00 00 00 00       	mov    $0x0,%esi
+  80004b:	bf 00 00 00 00       	mov    $0x0,%edi
+	for (i = 0; i < NFORKS; i++) {
+  800050:	eb 2a                	jmp    80007c <bench_fork+0x49>
+		start = read_tsc();
+		if ((envid = forkfn()) < 0)
+			panic("fork: %e", envid);
+  800052:	50                   	push   %eax
+  800053:	68 90 3a 80 00       	push   $0x803a90
+  800058:	6a 1f                	push   $0x1f
+  80005a:	68 a0 35 80 00       	push   $0x8035a0
+  80005f:	e8 f5 02 00 00       	call   800359 <_panic>
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  800064:	0f 31                	rdtsc
+		if (envid == 0)
+			exit();
+		total += read_tsc() - start;
+  800066:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  800069:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  80006c:	01 c6                	add    %eax,%esi
+  80006e:	11 d7                	adc    %edx,%edi
+		wait(envid);
+  800070:	83 ec 0c             	sub    $0xc,%esp
+  800073:	53                   	push   %ebx
+  800074:	e8 fe 30 00 00       	call   803177 <wait>
+  800079:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NFORKS; i++) {
+  80007c:	83 6d dc 01          	subl   $0x1,-0x24(%ebp)
+  800080:	74 1c                	je     80009e <bench_fork+0x6b>
+  800082:	0f 31                	rdtsc
+  800084:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800087:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		if ((envid = forkfn()) < 0)
+  80008a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80008d:	ff d0                	call   *%eax
+  80008f:	89 c3                	mov    %eax,%ebx
+  800091:	85 c0                	test   %eax,%eax
+  800093:	78 bd                	js     800052 <bench_fork+0x1f>
+		if (envid == 0)
+  800095:	75 cd                	jne    800064 <bench_fork+0x31>
+			exit();
+  800097:	e8 a3 02 00 00       	call   80033f <exit>
+  80009c:	eb c6                	jmp    800064 <bench_fork+0x31>
+	}
+	return (uint32_t) (total >> 10) / NFORKS;
+  80009e:	89 f0                	mov    %esi,%eax
+  8000a0:	89 fa                	mov    %edi,%edx
+  8000a2:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  8000a6:	c1 ea 0a             	shr    $0xa,%edx
+  8000a9:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+  8000ae:	f7 e2                	mul    %edx
+  8000b0:	89 d0                	mov    %edx,%eax
+  8000b2:	c1 e8 04             	shr    $0x4,%eax
+}
+  8000b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b8:	5b                   	pop    %ebx
+  8000b9:	5e                   	pop    %esi
+  8000ba:	5f                   	pop    %edi
+  8000bb:	5d                   	pop    %ebp
+  8000bc:	c3                   	ret
+
+008000bd <tree>:
+
+static void
+tree(forkfn_t forkfn, int depth)
+{
+  8000bd:	55                   	push   %ebp
+  8000be:	89 e5                	mov    %esp,%ebp
+  8000c0:	57                   	push   %edi
+  8000c1:	56                   	push   %esi
+  8000c2:	53                   	push   %ebx
+  8000c3:	83 ec 1c             	sub    $0x1c,%esp
+  8000c6:	89 c3                	mov    %eax,%ebx
+  8000c8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	envid_t child[2];
+	int i;
+
+	if (depth == 0)
+  8000cb:	85 d2                	test   %edx,%edx
+  8000cd:	74 28                	je     8000f7 <tree+0x3a>
+		return;
+	for (i = 0; i < 2; i++) {
+		if ((child[i] = forkfn()) < 0)
+  8000cf:	ff d0                	call   *%eax
+  8000d1:	89 c7                	mov    %eax,%edi
+  8000d3:	85 c0                	test   %eax,%eax
+  8000d5:	78 50                	js     800127 <tree+0x6a>
+			panic("fork: %e", child[i]);
+		if (child[i] == 0) {
+  8000d7:	74 26                	je     8000ff <tree+0x42>
+		if ((child[i] = forkfn()) < 0)
+  8000d9:	ff d3                	call   *%ebx
+  8000db:	89 c6                	mov    %eax,%esi
+  8000dd:	85 c0                	test   %eax,%eax
+  8000df:	78 48                	js     800129 <tree+0x6c>
+		if (child[i] == 0) {
+  8000e1:	74 30                	je     800113 <tree+0x56>
+			tree(forkfn, depth - 1);
+			exit();
+		}
+	}
+	for (i = 0; i < 2; i++)
+		wait(child[i]);
+  8000e3:	83 ec 0c             	sub    $0xc,%esp
+  8000e6:	57                   	push   %edi
+  8000e7:	e8 8b 30 00 00       	call   803177 <wait>
+  8000ec:	89 34 24             	mov    %esi,(%esp)
+  8000ef:	e8 83 30 00 00       	call   803177 <wait>
+	for (i = 0; i < 2; i++)
+  8000f4:	83 c4 10             	add    $0x10,%esp
+}
+  8000f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000fa:	5b                   	pop    %ebx
+  8000fb:	5e                   	pop    %esi
+  8000fc:	5f                   	pop    %edi
+  8000fd:	5d                   	pop    %ebp
+  8000fe:	c3                   	ret
+			tree(forkfn, depth - 1);
+  8000ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800102:	8d 50 ff             	lea    -0x1(%eax),%edx
+  800105:	89 d8                	mov    %ebx,%eax
+  800107:	e8 b1 ff ff ff       	call   8000bd <tree>
+			exit();
+  80010c:	e8 2e 02 00 00       	call   80033f <exit>
+  800111:	eb c6                	jmp    8000d9 <tree+0x1c>
+			tree(forkfn, depth - 1);
+  800113:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800116:	83 ea 01             	sub    $0x1,%edx
+  800119:	89 d8                	mov    %ebx,%eax
+  80011b:	e8 9d ff ff ff       	call   8000bd <tree>
+			exit();
+  800120:	e8 1a 02 00 00       	call   80033f <exit>
+  800125:	eb bc                	jmp    8000e3 <tree+0x26>
+		if ((child[i] = forkfn()) < 0)
+  800127:	89 c6                	mov    %eax,%esi
+			panic("fork: %e", child[i]);
+  800129:	56                   	push   %esi
+  80012a:	68 90 3a 80 00       	push   $0x803a90
+  80012f:	6a 32                	push   $0x32
+  800131:	68 a0 35 80 00       	push   $0x8035a0
+  800136:	e8 1e 02 00 00       	call   800359 <_panic>
+
+0080013b <umain>:
+		fast);
+}
+
+void
+umain(int argc, char **argv)
+{
+  80013b:	55                   	push   %ebp
+  80013c:	89 e5                	mov    %esp,%ebp
+  80013e:	57                   	push   %edi
+  80013f:	56                   	push   %esi
+  800140:	81 ec e0 01 00 00    	sub    $0x1e0,%esp
+	struct Batch b;
+	uint32_t slow, fast;
+	int i, r;
+
+	// warm up
+	bench_fork(ufork);
+  800146:	b8 61 1b 80 00       	mov    $0x801b61,%eax
+  80014b:	e8 e3 fe ff ff       	call   800033 <bench_fork>
+	bench_fork(fork);
+  800150:	b8 5f 1e 80 00       	mov    $0x801e5f,%eax
+  800155:	e8 d9 fe ff ff       	call   800033 <bench_fork>
+
+	slow = bench_fork(ufork);
+  80015a:	b8 61 1b 80 00       	mov    $0x801b61,%eax
+  80015f:	e8 cf fe ff ff       	call   800033 <bench_fork>
+  800164:	89 c6                	mov    %eax,%esi
+	fast = bench_fork(fork);
+  800166:	b8 5f 1e 80 00       	mov    $0x801e5f,%eax
+  80016b:	e8 c3 fe ff ff       	call   800033 <bench_fork>
+	cprintf("forkbench: %-16s ufork %7u kc, fork %7u kc\n", what, slow,
+  800170:	50                   	push   %eax
+  800171:	56                   	push   %esi
+  800172:	68 b1 35 80 00       	push   $0x8035b1
+  800177:	68 dc 35 80 00       	push   $0x8035dc
+  80017c:	e8 b3 02 00 00       	call   800434 <cprintf>
+	report("small", slow, fast);
+
+	batch_init(&b);
+  800181:	8d b5 30 fe ff ff    	lea    -0x1d0(%ebp),%esi
+  800187:	89 34 24             	mov    %esi,(%esp)
+  80018a:	e8 41 1d 00 00       	call   801ed0 <batch_init>
+	batch_alloc(&b, 0, HEAP, PTE_P | PTE_U | PTE_W, HEAPPAGES);
+  80018f:	c7 04 24 00 04 00 00 	movl   $0x400,(%esp)
+  800196:	6a 07                	push   $0x7
+  800198:	68 00 00 00 10       	push   $0x10000000
+  80019d:	6a 00                	push   $0x0
+  80019f:	56                   	push   %esi
+  8001a0:	e8 ac 1e 00 00       	call   802051 <batch_alloc>
+	if ((r = batch_flush(&b)) < 0)
+  8001a5:	83 c4 14             	add    $0x14,%esp
+  8001a8:	56                   	push   %esi
+  8001a9:	e8 3e 1d 00 00       	call   801eec <batch_flush>
+  8001ae:	83 c4 10             	add    $0x10,%esp
+  8001b1:	85 c0                	test   %eax,%eax
+  8001b3:	0f 88 ca 00 00 00    	js     800283 <umain+0x148>
+  8001b9:	ba 00 00 00 10       	mov    $0x10000000,%edx
+		panic("batch_flush: %e", r);
+	for (i = 0; i < HEAPPAGES; i++)
+  8001be:	b8 00 00 00 00       	mov    $0x0,%eax
+		HEAP[i * PGSIZE] = i;
+  8001c3:	88 02                	mov    %al,(%edx)
+	for (i = 0; i < HEAPPAGES; i++)
+  8001c5:	83 c0 01             	add    $0x1,%eax
+  8001c8:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  8001ce:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001d3:	75 ee                	jne    8001c3 <umain+0x88>
+
+	slow = bench_fork(ufork);
+  8001d5:	b8 61 1b 80 00       	mov    $0x801b61,%eax
+  8001da:	e8 54 fe ff ff       	call   800033 <bench_fork>
+  8001df:	89 c6                	mov    %eax,%esi
+	fast = bench_fork(fork);
+  8001e1:	b8 5f 1e 80 00       	mov    $0x801e5f,%eax
+  8001e6:	e8 48 fe ff ff       	call   800033 <bench_fork>
+	cprintf("forkbench: %-16s ufork %7u kc, fork %7u kc\n", what, slow,
+  8001eb:	50                   	push   %eax
+  8001ec:	56                   	push   %esi
+  8001ed:	68 c7 35 80 00       	push   $0x8035c7
+  8001f2:	68 dc 35 80 00       	push   $0x8035dc
+  8001f7:	e8 38 02 00 00       	call   800434 <cprintf>
+  8001fc:	0f 31                	rdtsc
+  8001fe:	89 85 20 fe ff ff    	mov    %eax,-0x1e0(%ebp)
+  800204:	89 95 24 fe ff ff    	mov    %edx,-0x1dc(%ebp)
+	tree(forkfn, TREEDEPTH);
+  80020a:	ba 05 00 00 00       	mov    $0x5,%edx
+  80020f:	b8 61 1b 80 00       	mov    $0x801b61,%eax
+  800214:	e8 a4 fe ff ff       	call   8000bd <tree>
+  800219:	0f 31                	rdtsc
+  80021b:	89 c6                	mov    %eax,%esi
+  80021d:	89 d7                	mov    %edx,%edi
+  80021f:	0f 31                	rdtsc
+  800221:	89 85 18 fe ff ff    	mov    %eax,-0x1e8(%ebp)
+  800227:	89 95 1c fe ff ff    	mov    %edx,-0x1e4(%ebp)
+  80022d:	ba 05 00 00 00       	mov    $0x5,%edx
+  800232:	b8 5f 1e 80 00       	mov    $0x801e5f,%eax
+  800237:	e8 81 fe ff ff       	call   8000bd <tree>
+  80023c:	0f 31                	rdtsc
+	return (uint32_t) ((read_tsc() - start) >> 10);
+  80023e:	2b 85 18 fe ff ff    	sub    -0x1e8(%ebp),%eax
+  800244:	1b 95 1c fe ff ff    	sbb    -0x1e4(%ebp),%edx
+  80024a:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  80024e:	c1 ea 0a             	shr    $0xa,%edx
+	cprintf("forkbench: %-16s ufork %7u kc, fork %7u kc\n", what, slow,
+  800251:	50                   	push   %eax
+	return (uint32_t) ((read_tsc() - start) >> 10);
+  800252:	2b b5 20 fe ff ff    	sub    -0x1e0(%ebp),%esi
+  800258:	1b bd 24 fe ff ff    	sbb    -0x1dc(%ebp),%edi
+  80025e:	89 f0                	mov    %esi,%eax
+  800260:	89 fa                	mov    %edi,%edx
+  800262:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  800266:	c1 ea 0a             	shr    $0xa,%edx
+	cprintf("forkbench: %-16s ufork %7u kc, fork %7u kc\n", what, slow,
+  800269:	50                   	push   %eax
+  80026a:	68 d0 35 80 00       	push   $0x8035d0
+  80026f:	68 dc 35 80 00       	push   $0x8035dc
+  800274:	e8 bb 01 00 00       	call   800434 <cprintf>
+	report("4MB heap", slow, fast);
+
+	slow = bench_tree(ufork);
+	fast = bench_tree(fork);
+	report("tree of 63", slow, fast);
+}
+  800279:	83 c4 20             	add    $0x20,%esp
+  80027c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80027f:	5e                   	pop    %esi
+  800280:	5f                   	pop    %edi
+  800281:	5d                   	pop    %ebp
+  800282:	c3                   	ret
+		panic("batch_flush: %e", r);
+  800283:	50                   	push   %eax
+  800284:	68 b7 35 80 00       	push   $0x8035b7
+  800289:	6a 5f                	push   $0x5f
+  80028b:	68 a0 35 80 00       	push   $0x8035a0
+  800290:	e8 c4 00 00 00       	call   800359 <_panic>
+
+00800295 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800295:	55                   	push   %ebp
+  800296:	89 e5                	mov    %esp,%ebp
+  800298:	57                   	push   %edi
+  800299:	56                   	push   %esi
+  80029a:	53                   	push   %ebx
+  80029b:	83 ec 0c             	sub    $0xc,%esp
+  80029e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	asm volatile("cpuid"
+  8002a4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002a9:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8002ab:	c1 ea 0b             	shr    $0xb,%edx
+  8002ae:	83 f2 01             	xor    $0x1,%edx
+  8002b1:	83 e2 01             	and    $0x1,%edx
+  8002b4:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8002ba:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8002c1:	00 00 00 
+	envid = sys_getenvid();
+  8002c4:	e8 1f 0c 00 00       	call   800ee8 <sys_getenvid>
+  8002c9:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8002cb:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8002d0:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8002d6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8002dc:	8b 52 48             	mov    0x48(%edx),%edx
+  8002df:	39 ca                	cmp    %ecx,%edx
+  8002e1:	74 27                	je     80030a <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8002e3:	83 c0 01             	add    $0x1,%eax
+  8002e6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8002eb:	75 e3                	jne    8002d0 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8002ed:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8002f4:	75 24                	jne    80031a <libmain+0x85>
+		panic("libmain can't find the environment");
+  8002f6:	83 ec 04             	sub    $0x4,%esp
+  8002f9:	68 08 36 80 00       	push   $0x803608
+  8002fe:	6a 23                	push   $0x23
+  800300:	68 2b 36 80 00       	push   $0x80362b
+  800305:	e8 4f 00 00 00       	call   800359 <_panic>
+			mainenv = &envs[i];
+  80030a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800310:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800315:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80031a:	85 ff                	test   %edi,%edi
+  80031c:	7e 07                	jle    800325 <libmain+0x90>
+		binaryname = argv[0];
+  80031e:	8b 06                	mov    (%esi),%eax
+  800320:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800325:	83 ec 08             	sub    $0x8,%esp
+  800328:	56                   	push   %esi
+  800329:	57                   	push   %edi
+  80032a:	e8 0c fe ff ff       	call   80013b <umain>
+
+	// exit gracefully
+	exit();
+  80032f:	e8 0b 00 00 00       	call   80033f <exit>
+}
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033a:	5b                   	pop    %ebx
+  80033b:	5e                   	pop    %esi
+  80033c:	5f                   	pop    %edi
+  80033d:	5d                   	pop    %ebp
+  80033e:	c3                   	ret
+
+0080033f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80033f:	55                   	push   %ebp
+  800340:	89 e5                	mov    %esp,%ebp
+  800342:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800345:	e8 9c 1f 00 00       	call   8022e6 <close_all>
+	sys_env_destroy(0);
+  80034a:	83 ec 0c             	sub    $0xc,%esp
+  80034d:	6a 00                	push   $0x0
+  80034f:	e8 2b 0b 00 00       	call   800e7f <sys_env_destroy>
+}
+  800354:	83 c4 10             	add    $0x10,%esp
+  800357:	c9                   	leave
+  800358:	c3                   	ret
+
+00800359 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	56                   	push   %esi
+  80035d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80035e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800361:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800367:	e8 7c 0b 00 00       	call   800ee8 <sys_getenvid>
+  80036c:	83 ec 0c             	sub    $0xc,%esp
+  80036f:	ff 75 0c             	push   0xc(%ebp)
+  800372:	ff 75 08             	push   0x8(%ebp)
+  800375:	56                   	push   %esi
+  800376:	50                   	push   %eax
+  800377:	68 44 36 80 00       	push   $0x803644
+  80037c:	e8 b3 00 00 00       	call   800434 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800381:	83 c4 18             	add    $0x18,%esp
+  800384:	53                   	push   %ebx
+  800385:	ff 75 10             	push   0x10(%ebp)
+  800388:	e8 56 00 00 00       	call   8003e3 <vcprintf>
+	cprintf("\n");
+  80038d:	c7 04 24 cf 3b 80 00 	movl   $0x803bcf,(%esp)
+  800394:	e8 9b 00 00 00       	call   800434 <cprintf>
+  800399:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80039c:	cc                   	int3
+	while (1)
+  80039d:	eb fd                	jmp    80039c <_panic+0x43>
+
+0080039f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80039f:	55                   	push   %ebp
+  8003a0:	89 e5                	mov    %esp,%ebp
+  8003a2:	53                   	push   %ebx
+  8003a3:	83 ec 04             	sub    $0x4,%esp
+  8003a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003a9:	8b 13                	mov    (%ebx),%edx
+  8003ab:	8d 42 01             	lea    0x1(%edx),%eax
+  8003ae:	89 03                	mov    %eax,(%ebx)
+  8003b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003b3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003b7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003bc:	74 09                	je     8003c7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003be:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003c5:	c9                   	leave
+  8003c6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003c7:	83 ec 08             	sub    $0x8,%esp
+  8003ca:	68 ff 00 00 00       	push   $0xff
+  8003cf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003d2:	50                   	push   %eax
+  8003d3:	e8 1d 0a 00 00       	call   800df5 <sys_cputs>
+		b->idx = 0;
+  8003d8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003de:	83 c4 10             	add    $0x10,%esp
+  8003e1:	eb db                	jmp    8003be <putch+0x1f>
+
+008003e3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003e3:	55                   	push   %ebp
+  8003e4:	89 e5                	mov    %esp,%ebp
+  8003e6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003ec:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003f3:	00 00 00 
+	b.cnt = 0;
+  8003f6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003fd:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800400:	ff 75 0c             	push   0xc(%ebp)
+  800403:	ff 75 08             	push   0x8(%ebp)
+  800406:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80040c:	50                   	push   %eax
+  80040d:	68 9f 03 80 00       	push   $0x80039f
+  800412:	e8 fb 00 00 00       	call   800512 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800417:	83 c4 08             	add    $0x8,%esp
+  80041a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800420:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800426:	50                   	push   %eax
+  800427:	e8 c9 09 00 00       	call   800df5 <sys_cputs>
+
+	return b.cnt;
+}
+  80042c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800432:	c9                   	leave
+  800433:	c3                   	ret
+
+00800434 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800434:	55                   	push   %ebp
+  800435:	89 e5                	mov    %esp,%ebp
+  800437:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80043a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80043d:	50                   	push   %eax
+  80043e:	ff 75 08             	push   0x8(%ebp)
+  800441:	e8 9d ff ff ff       	call   8003e3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800446:	c9                   	leave
+  800447:	c3                   	ret
+
+00800448 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800448:	55                   	push   %ebp
+  800449:	89 e5                	mov    %esp,%ebp
+  80044b:	57                   	push   %edi
+  80044c:	56                   	push   %esi
+  80044d:	53                   	push   %ebx
+  80044e:	83 ec 1c             	sub    $0x1c,%esp
+  800451:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800454:	89 d6                	mov    %edx,%esi
+  800456:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800459:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80045c:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80045f:	73 0b                	jae    80046c <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800461:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800464:	c1 e7 08             	shl    $0x8,%edi
+  800467:	0b 7d 10             	or     0x10(%ebp),%edi
+  80046a:	eb 36                	jmp    8004a2 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80046c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80046f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800474:	f7 75 08             	divl   0x8(%ebp)
+  800477:	89 c1                	mov    %eax,%ecx
+  800479:	ff 75 14             	push   0x14(%ebp)
+  80047c:	ff 75 10             	push   0x10(%ebp)
+  80047f:	83 eb 01             	sub    $0x1,%ebx
+  800482:	53                   	push   %ebx
+  800483:	ff 75 08             	push   0x8(%ebp)
+  800486:	89 f2                	mov    %esi,%edx
+  800488:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80048b:	e8 b8 ff ff ff       	call   800448 <printnum>
+  800490:	83 c4 10             	add    $0x10,%esp
+  800493:	eb 14                	jmp    8004a9 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800495:	83 ec 08             	sub    $0x8,%esp
+  800498:	56                   	push   %esi
+  800499:	57                   	push   %edi
+  80049a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80049d:	ff d0                	call   *%eax
+  80049f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004a2:	83 eb 01             	sub    $0x1,%ebx
+  8004a5:	85 db                	test   %ebx,%ebx
+  8004a7:	7f ec                	jg     800495 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8004a9:	83 ec 08             	sub    $0x8,%esp
+  8004ac:	56                   	push   %esi
+  8004ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b5:	f7 75 08             	divl   0x8(%ebp)
+  8004b8:	0f be 92 67 36 80 00 	movsbl 0x803667(%edx),%edx
+  8004bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c2:	c1 e0 08             	shl    $0x8,%eax
+  8004c5:	09 d0                	or     %edx,%eax
+  8004c7:	50                   	push   %eax
+  8004c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004cb:	ff d0                	call   *%eax
+}
+  8004cd:	83 c4 10             	add    $0x10,%esp
+  8004d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004d3:	5b                   	pop    %ebx
+  8004d4:	5e                   	pop    %esi
+  8004d5:	5f                   	pop    %edi
+  8004d6:	5d                   	pop    %ebp
+  8004d7:	c3                   	ret
+
+008004d8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004d8:	55                   	push   %ebp
+  8004d9:	89 e5                	mov    %esp,%ebp
+  8004db:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004de:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004e2:	8b 10                	mov    (%eax),%edx
+  8004e4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004e7:	73 0a                	jae    8004f3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004e9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004ec:	89 08                	mov    %ecx,(%eax)
+  8004ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f1:	88 02                	mov    %al,(%edx)
+}
+  8004f3:	5d                   	pop    %ebp
+  8004f4:	c3                   	ret
+
+008004f5 <printfmt>:
+{
+  8004f5:	55                   	push   %ebp
+  8004f6:	89 e5                	mov    %esp,%ebp
+  8004f8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004fb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004fe:	50                   	push   %eax
+  8004ff:	ff 75 10             	push   0x10(%ebp)
+  800502:	ff 75 0c             	push   0xc(%ebp)
+  800505:	ff 75 08             	push   0x8(%ebp)
+  800508:	e8 05 00 00 00       	call   800512 <vprintfmt>
+}
+  80050d:	83 c4 10             	add    $0x10,%esp
+  800510:	c9                   	leave
+  800511:	c3                   	ret
+
+00800512 <vprintfmt>:
+{
+  800512:	55                   	push   %ebp
+  800513:	89 e5                	mov    %esp,%ebp
+  800515:	57                   	push   %edi
+  800516:	56                   	push   %esi
+  800517:	53                   	push   %ebx
+  800518:	83 ec 3c             	sub    $0x3c,%esp
+  80051b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80051e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800521:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800528:	eb 16                	jmp    800540 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	ff 75 0c             	push   0xc(%ebp)
+  800530:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800533:	c1 e2 08             	shl    $0x8,%edx
+  800536:	09 d0                	or     %edx,%eax
+  800538:	50                   	push   %eax
+  800539:	ff d7                	call   *%edi
+  80053b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80053e:	89 de                	mov    %ebx,%esi
+  800540:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800543:	0f b6 06             	movzbl (%esi),%eax
+  800546:	83 f8 25             	cmp    $0x25,%eax
+  800549:	74 0c                	je     800557 <vprintfmt+0x45>
+			if (ch == '\0')
+  80054b:	85 c0                	test   %eax,%eax
+  80054d:	75 db                	jne    80052a <vprintfmt+0x18>
+}
+  80054f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800552:	5b                   	pop    %ebx
+  800553:	5e                   	pop    %esi
+  800554:	5f                   	pop    %edi
+  800555:	5d                   	pop    %ebp
+  800556:	c3                   	ret
+		padc = ' ';
+  800557:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80055b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800562:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800569:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800570:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800575:	8d 73 01             	lea    0x1(%ebx),%esi
+  800578:	0f b6 13             	movzbl (%ebx),%edx
+  80057b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80057e:	3c 55                	cmp    $0x55,%al
+  800580:	0f 87 2c 04 00 00    	ja     8009b2 <vprintfmt+0x4a0>
+  800586:	0f b6 c0             	movzbl %al,%eax
+  800589:	ff 24 85 c0 37 80 00 	jmp    *0x8037c0(,%eax,4)
+  800590:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800592:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800596:	eb dd                	jmp    800575 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800598:	89 f3                	mov    %esi,%ebx
+  80059a:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80059e:	eb d5                	jmp    800575 <vprintfmt+0x63>
+  8005a0:	0f b6 d2             	movzbl %dl,%edx
+  8005a3:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8005a5:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8005aa:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005ad:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005b1:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8005b4:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8005b7:	83 fe 09             	cmp    $0x9,%esi
+  8005ba:	0f 87 8a 00 00 00    	ja     80064a <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8005c0:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8005c3:	eb e5                	jmp    8005aa <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8005c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c8:	8b 00                	mov    (%eax),%eax
+  8005ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005d6:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8005d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005dc:	79 97                	jns    800575 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8005de:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005eb:	eb 88                	jmp    800575 <vprintfmt+0x63>
+			if (width < 0)
+  8005ed:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8005f0:	85 db                	test   %ebx,%ebx
+  8005f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f7:	0f 49 c3             	cmovns %ebx,%eax
+  8005fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005fd:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005ff:	e9 71 ff ff ff       	jmp    800575 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800604:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800606:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80060d:	e9 63 ff ff ff       	jmp    800575 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800612:	8d 73 02             	lea    0x2(%ebx),%esi
+  800615:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800619:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800620:	3c 67                	cmp    $0x67,%al
+  800622:	0f 84 18 ff ff ff    	je     800540 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800628:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80062f:	3c 72                	cmp    $0x72,%al
+  800631:	0f 84 09 ff ff ff    	je     800540 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800637:	3c 62                	cmp    $0x62,%al
+  800639:	0f 94 c0             	sete   %al
+  80063c:	0f b6 c0             	movzbl %al,%eax
+  80063f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800642:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800645:	e9 f6 fe ff ff       	jmp    800540 <vprintfmt+0x2e>
+  80064a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80064d:	eb 89                	jmp    8005d8 <vprintfmt+0xc6>
+			lflag++;
+  80064f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800652:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800654:	e9 1c ff ff ff       	jmp    800575 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80065f:	83 ec 08             	sub    $0x8,%esp
+  800662:	ff 75 0c             	push   0xc(%ebp)
+  800665:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800668:	c1 e0 08             	shl    $0x8,%eax
+  80066b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80066e:	0b 01                	or     (%ecx),%eax
+  800670:	50                   	push   %eax
+  800671:	ff d7                	call   *%edi
+			break;
+  800673:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800676:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800679:	e9 c2 fe ff ff       	jmp    800540 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800684:	8b 10                	mov    (%eax),%edx
+  800686:	89 d0                	mov    %edx,%eax
+  800688:	f7 d8                	neg    %eax
+  80068a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80068d:	83 f8 12             	cmp    $0x12,%eax
+  800690:	7f 25                	jg     8006b7 <vprintfmt+0x1a5>
+  800692:	8b 14 85 20 39 80 00 	mov    0x803920(,%eax,4),%edx
+  800699:	85 d2                	test   %edx,%edx
+  80069b:	74 1a                	je     8006b7 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80069d:	52                   	push   %edx
+  80069e:	68 62 3a 80 00       	push   $0x803a62
+  8006a3:	ff 75 0c             	push   0xc(%ebp)
+  8006a6:	57                   	push   %edi
+  8006a7:	e8 49 fe ff ff       	call   8004f5 <printfmt>
+  8006ac:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006af:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8006b2:	e9 89 fe ff ff       	jmp    800540 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8006b7:	50                   	push   %eax
+  8006b8:	68 7f 36 80 00       	push   $0x80367f
+  8006bd:	ff 75 0c             	push   0xc(%ebp)
+  8006c0:	57                   	push   %edi
+  8006c1:	e8 2f fe ff ff       	call   8004f5 <printfmt>
+  8006c6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006c9:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006cc:	e9 6f fe ff ff       	jmp    800540 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	83 c0 04             	add    $0x4,%eax
+  8006d7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006df:	85 c9                	test   %ecx,%ecx
+  8006e1:	b8 78 36 80 00       	mov    $0x803678,%eax
+  8006e6:	0f 45 c1             	cmovne %ecx,%eax
+  8006e9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8006ec:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006f0:	7e 06                	jle    8006f8 <vprintfmt+0x1e6>
+  8006f2:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8006f6:	75 1a                	jne    800712 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8006f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006fb:	c1 e0 08             	shl    $0x8,%eax
+  8006fe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800701:	83 c8 3f             	or     $0x3f,%eax
+  800704:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800707:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80070a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80070d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800710:	eb 6d                	jmp    80077f <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800712:	83 ec 08             	sub    $0x8,%esp
+  800715:	ff 75 d0             	push   -0x30(%ebp)
+  800718:	ff 75 c8             	push   -0x38(%ebp)
+  80071b:	e8 39 03 00 00       	call   800a59 <strnlen>
+  800720:	89 c2                	mov    %eax,%edx
+  800722:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800725:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800727:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80072a:	c1 e1 08             	shl    $0x8,%ecx
+  80072d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800731:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800733:	83 c4 10             	add    $0x10,%esp
+  800736:	89 c3                	mov    %eax,%ebx
+  800738:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80073b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80073e:	89 ce                	mov    %ecx,%esi
+  800740:	eb 0f                	jmp    800751 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800742:	83 ec 08             	sub    $0x8,%esp
+  800745:	ff 75 0c             	push   0xc(%ebp)
+  800748:	56                   	push   %esi
+  800749:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80074b:	83 eb 01             	sub    $0x1,%ebx
+  80074e:	83 c4 10             	add    $0x10,%esp
+  800751:	85 db                	test   %ebx,%ebx
+  800753:	7f ed                	jg     800742 <vprintfmt+0x230>
+  800755:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800758:	8b 75 10             	mov    0x10(%ebp),%esi
+  80075b:	85 c0                	test   %eax,%eax
+  80075d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800762:	0f 49 d0             	cmovns %eax,%edx
+  800765:	29 d0                	sub    %edx,%eax
+  800767:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80076a:	eb 8c                	jmp    8006f8 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80076c:	83 ec 08             	sub    $0x8,%esp
+  80076f:	ff 75 0c             	push   0xc(%ebp)
+  800772:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800775:	09 c2                	or     %eax,%edx
+  800777:	52                   	push   %edx
+  800778:	ff d7                	call   *%edi
+  80077a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80077d:	89 d9                	mov    %ebx,%ecx
+  80077f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800782:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800786:	0f be d0             	movsbl %al,%edx
+  800789:	85 d2                	test   %edx,%edx
+  80078b:	74 2a                	je     8007b7 <vprintfmt+0x2a5>
+  80078d:	85 f6                	test   %esi,%esi
+  80078f:	78 05                	js     800796 <vprintfmt+0x284>
+  800791:	83 ee 01             	sub    $0x1,%esi
+  800794:	78 3b                	js     8007d1 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800796:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80079a:	74 d0                	je     80076c <vprintfmt+0x25a>
+  80079c:	0f be c0             	movsbl %al,%eax
+  80079f:	83 e8 20             	sub    $0x20,%eax
+  8007a2:	83 f8 5e             	cmp    $0x5e,%eax
+  8007a5:	76 c5                	jbe    80076c <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8007a7:	83 ec 08             	sub    $0x8,%esp
+  8007aa:	ff 75 0c             	push   0xc(%ebp)
+  8007ad:	ff 75 cc             	push   -0x34(%ebp)
+  8007b0:	ff d7                	call   *%edi
+  8007b2:	83 c4 10             	add    $0x10,%esp
+  8007b5:	eb c6                	jmp    80077d <vprintfmt+0x26b>
+  8007b7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8007ba:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8007bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007c0:	01 c3                	add    %eax,%ebx
+  8007c2:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8007c4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8007c7:	83 c8 20             	or     $0x20,%eax
+  8007ca:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007cd:	89 c6                	mov    %eax,%esi
+  8007cf:	eb 14                	jmp    8007e5 <vprintfmt+0x2d3>
+  8007d1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8007d4:	eb e4                	jmp    8007ba <vprintfmt+0x2a8>
+  8007d6:	83 ec 08             	sub    $0x8,%esp
+  8007d9:	ff 75 0c             	push   0xc(%ebp)
+  8007dc:	56                   	push   %esi
+  8007dd:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007df:	83 eb 01             	sub    $0x1,%ebx
+  8007e2:	83 c4 10             	add    $0x10,%esp
+  8007e5:	85 db                	test   %ebx,%ebx
+  8007e7:	7f ed                	jg     8007d6 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007e9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8007ec:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8007ef:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f2:	e9 49 fd ff ff       	jmp    800540 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007f7:	83 f9 01             	cmp    $0x1,%ecx
+  8007fa:	7f 1f                	jg     80081b <vprintfmt+0x309>
+	else if (lflag)
+  8007fc:	85 c9                	test   %ecx,%ecx
+  8007fe:	74 69                	je     800869 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 00                	mov    (%eax),%eax
+  800805:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800808:	89 c1                	mov    %eax,%ecx
+  80080a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80080d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800810:	8b 45 14             	mov    0x14(%ebp),%eax
+  800813:	8d 40 04             	lea    0x4(%eax),%eax
+  800816:	89 45 14             	mov    %eax,0x14(%ebp)
+  800819:	eb 17                	jmp    800832 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80081b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081e:	8b 50 04             	mov    0x4(%eax),%edx
+  800821:	8b 00                	mov    (%eax),%eax
+  800823:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800826:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800829:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082c:	8d 40 08             	lea    0x8(%eax),%eax
+  80082f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800832:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800835:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800838:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80083d:	85 db                	test   %ebx,%ebx
+  80083f:	0f 89 f6 00 00 00    	jns    80093b <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800845:	83 ec 08             	sub    $0x8,%esp
+  800848:	ff 75 0c             	push   0xc(%ebp)
+  80084b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80084e:	c1 e0 08             	shl    $0x8,%eax
+  800851:	83 c8 2d             	or     $0x2d,%eax
+  800854:	50                   	push   %eax
+  800855:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800857:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80085a:	f7 d9                	neg    %ecx
+  80085c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80085f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800864:	e9 d2 00 00 00       	jmp    80093b <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800869:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086c:	8b 00                	mov    (%eax),%eax
+  80086e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800871:	89 c1                	mov    %eax,%ecx
+  800873:	c1 f9 1f             	sar    $0x1f,%ecx
+  800876:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800879:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087c:	8d 40 04             	lea    0x4(%eax),%eax
+  80087f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800882:	eb ae                	jmp    800832 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800884:	83 f9 01             	cmp    $0x1,%ecx
+  800887:	7f 19                	jg     8008a2 <vprintfmt+0x390>
+	else if (lflag)
+  800889:	85 c9                	test   %ecx,%ecx
+  80088b:	74 2a                	je     8008b7 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80088d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800890:	8b 08                	mov    (%eax),%ecx
+  800892:	8d 40 04             	lea    0x4(%eax),%eax
+  800895:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800898:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80089d:	e9 99 00 00 00       	jmp    80093b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a5:	8b 08                	mov    (%eax),%ecx
+  8008a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8008aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8008b2:	e9 84 00 00 00       	jmp    80093b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ba:	8b 08                	mov    (%eax),%ecx
+  8008bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008bf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8008c7:	eb 72                	jmp    80093b <vprintfmt+0x429>
+	if (lflag >= 2)
+  8008c9:	83 f9 01             	cmp    $0x1,%ecx
+  8008cc:	7f 16                	jg     8008e4 <vprintfmt+0x3d2>
+	else if (lflag)
+  8008ce:	85 c9                	test   %ecx,%ecx
+  8008d0:	74 24                	je     8008f6 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8008d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d5:	8b 08                	mov    (%eax),%ecx
+  8008d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8008da:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008dd:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8008e2:	eb 57                	jmp    80093b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e7:	8b 08                	mov    (%eax),%ecx
+  8008e9:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008ef:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8008f4:	eb 45                	jmp    80093b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f9:	8b 08                	mov    (%eax),%ecx
+  8008fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800901:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800906:	eb 33                	jmp    80093b <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800908:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80090b:	c1 e3 08             	shl    $0x8,%ebx
+  80090e:	83 ec 08             	sub    $0x8,%esp
+  800911:	ff 75 0c             	push   0xc(%ebp)
+  800914:	89 d8                	mov    %ebx,%eax
+  800916:	83 c8 30             	or     $0x30,%eax
+  800919:	50                   	push   %eax
+  80091a:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80091c:	83 c4 08             	add    $0x8,%esp
+  80091f:	ff 75 0c             	push   0xc(%ebp)
+  800922:	83 cb 78             	or     $0x78,%ebx
+  800925:	53                   	push   %ebx
+  800926:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800928:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092b:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80092d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800930:	8d 40 04             	lea    0x4(%eax),%eax
+  800933:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800936:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80093b:	ff 75 e4             	push   -0x1c(%ebp)
+  80093e:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800942:	52                   	push   %edx
+  800943:	ff 75 e0             	push   -0x20(%ebp)
+  800946:	50                   	push   %eax
+  800947:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80094a:	89 f8                	mov    %edi,%eax
+  80094c:	e8 f7 fa ff ff       	call   800448 <printnum>
+			break;
+  800951:	83 c4 10             	add    $0x10,%esp
+  800954:	e9 e7 fb ff ff       	jmp    800540 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800959:	83 f9 01             	cmp    $0x1,%ecx
+  80095c:	7f 16                	jg     800974 <vprintfmt+0x462>
+	else if (lflag)
+  80095e:	85 c9                	test   %ecx,%ecx
+  800960:	74 24                	je     800986 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800962:	8b 45 14             	mov    0x14(%ebp),%eax
+  800965:	8b 08                	mov    (%eax),%ecx
+  800967:	8d 40 04             	lea    0x4(%eax),%eax
+  80096a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80096d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800972:	eb c7                	jmp    80093b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800974:	8b 45 14             	mov    0x14(%ebp),%eax
+  800977:	8b 08                	mov    (%eax),%ecx
+  800979:	8d 40 08             	lea    0x8(%eax),%eax
+  80097c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80097f:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800984:	eb b5                	jmp    80093b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800986:	8b 45 14             	mov    0x14(%ebp),%eax
+  800989:	8b 08                	mov    (%eax),%ecx
+  80098b:	8d 40 04             	lea    0x4(%eax),%eax
+  80098e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800991:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800996:	eb a3                	jmp    80093b <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800998:	83 ec 08             	sub    $0x8,%esp
+  80099b:	ff 75 0c             	push   0xc(%ebp)
+  80099e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009a1:	c1 e0 08             	shl    $0x8,%eax
+  8009a4:	83 c8 25             	or     $0x25,%eax
+  8009a7:	50                   	push   %eax
+  8009a8:	ff d7                	call   *%edi
+			break;
+  8009aa:	83 c4 10             	add    $0x10,%esp
+  8009ad:	e9 8e fb ff ff       	jmp    800540 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8009b2:	83 ec 08             	sub    $0x8,%esp
+  8009b5:	ff 75 0c             	push   0xc(%ebp)
+  8009b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009bb:	c1 e0 08             	shl    $0x8,%eax
+  8009be:	83 c8 25             	or     $0x25,%eax
+  8009c1:	50                   	push   %eax
+  8009c2:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009c4:	83 c4 10             	add    $0x10,%esp
+  8009c7:	89 de                	mov    %ebx,%esi
+  8009c9:	eb 03                	jmp    8009ce <vprintfmt+0x4bc>
+  8009cb:	83 ee 01             	sub    $0x1,%esi
+  8009ce:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8009d2:	75 f7                	jne    8009cb <vprintfmt+0x4b9>
+  8009d4:	e9 67 fb ff ff       	jmp    800540 <vprintfmt+0x2e>
+
+008009d9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	83 ec 18             	sub    $0x18,%esp
+  8009df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009e5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009e8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009ec:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009ef:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009f6:	85 c0                	test   %eax,%eax
+  8009f8:	74 26                	je     800a20 <vsnprintf+0x47>
+  8009fa:	85 d2                	test   %edx,%edx
+  8009fc:	7e 22                	jle    800a20 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009fe:	ff 75 14             	push   0x14(%ebp)
+  800a01:	ff 75 10             	push   0x10(%ebp)
+  800a04:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a07:	50                   	push   %eax
+  800a08:	68 d8 04 80 00       	push   $0x8004d8
+  800a0d:	e8 00 fb ff ff       	call   800512 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a15:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a1b:	83 c4 10             	add    $0x10,%esp
+}
+  800a1e:	c9                   	leave
+  800a1f:	c3                   	ret
+		return -E_INVAL;
+  800a20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a25:	eb f7                	jmp    800a1e <vsnprintf+0x45>
+
+00800a27 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800a2d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a30:	50                   	push   %eax
+  800a31:	ff 75 10             	push   0x10(%ebp)
+  800a34:	ff 75 0c             	push   0xc(%ebp)
+  800a37:	ff 75 08             	push   0x8(%ebp)
+  800a3a:	e8 9a ff ff ff       	call   8009d9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a3f:	c9                   	leave
+  800a40:	c3                   	ret
+
+00800a41 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4c:	eb 03                	jmp    800a51 <strlen+0x10>
+		n++;
+  800a4e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a51:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a55:	75 f7                	jne    800a4e <strlen+0xd>
+	return n;
+}
+  800a57:	5d                   	pop    %ebp
+  800a58:	c3                   	ret
+
+00800a59 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a59:	55                   	push   %ebp
+  800a5a:	89 e5                	mov    %esp,%ebp
+  800a5c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a67:	eb 03                	jmp    800a6c <strnlen+0x13>
+		n++;
+  800a69:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a6c:	39 d0                	cmp    %edx,%eax
+  800a6e:	74 08                	je     800a78 <strnlen+0x1f>
+  800a70:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a74:	75 f3                	jne    800a69 <strnlen+0x10>
+  800a76:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a78:	89 d0                	mov    %edx,%eax
+  800a7a:	5d                   	pop    %ebp
+  800a7b:	c3                   	ret
+
+00800a7c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	53                   	push   %ebx
+  800a80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a8f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a92:	83 c0 01             	add    $0x1,%eax
+  800a95:	84 d2                	test   %dl,%dl
+  800a97:	75 f2                	jne    800a8b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a99:	89 c8                	mov    %ecx,%eax
+  800a9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a9e:	c9                   	leave
+  800a9f:	c3                   	ret
+
+00800aa0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	53                   	push   %ebx
+  800aa4:	83 ec 10             	sub    $0x10,%esp
+  800aa7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800aaa:	53                   	push   %ebx
+  800aab:	e8 91 ff ff ff       	call   800a41 <strlen>
+  800ab0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ab3:	ff 75 0c             	push   0xc(%ebp)
+  800ab6:	01 d8                	add    %ebx,%eax
+  800ab8:	50                   	push   %eax
+  800ab9:	e8 be ff ff ff       	call   800a7c <strcpy>
+	return dst;
+}
+  800abe:	89 d8                	mov    %ebx,%eax
+  800ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ac3:	c9                   	leave
+  800ac4:	c3                   	ret
+
+00800ac5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	56                   	push   %esi
+  800ac9:	53                   	push   %ebx
+  800aca:	8b 75 08             	mov    0x8(%ebp),%esi
+  800acd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ad0:	89 f3                	mov    %esi,%ebx
+  800ad2:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ad5:	89 f0                	mov    %esi,%eax
+  800ad7:	eb 0f                	jmp    800ae8 <strncpy+0x23>
+		*dst++ = *src;
+  800ad9:	83 c0 01             	add    $0x1,%eax
+  800adc:	0f b6 0a             	movzbl (%edx),%ecx
+  800adf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ae2:	80 f9 01             	cmp    $0x1,%cl
+  800ae5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ae8:	39 d8                	cmp    %ebx,%eax
+  800aea:	75 ed                	jne    800ad9 <strncpy+0x14>
+	}
+	return ret;
+}
+  800aec:	89 f0                	mov    %esi,%eax
+  800aee:	5b                   	pop    %ebx
+  800aef:	5e                   	pop    %esi
+  800af0:	5d                   	pop    %ebp
+  800af1:	c3                   	ret
+
+00800af2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	56                   	push   %esi
+  800af6:	53                   	push   %ebx
+  800af7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800afa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800afd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b00:	89 f0                	mov    %esi,%eax
+  800b02:	85 d2                	test   %edx,%edx
+  800b04:	74 21                	je     800b27 <strlcpy+0x35>
+  800b06:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b0a:	89 f2                	mov    %esi,%edx
+  800b0c:	eb 09                	jmp    800b17 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b0e:	83 c1 01             	add    $0x1,%ecx
+  800b11:	83 c2 01             	add    $0x1,%edx
+  800b14:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b17:	39 c2                	cmp    %eax,%edx
+  800b19:	74 09                	je     800b24 <strlcpy+0x32>
+  800b1b:	0f b6 19             	movzbl (%ecx),%ebx
+  800b1e:	84 db                	test   %bl,%bl
+  800b20:	75 ec                	jne    800b0e <strlcpy+0x1c>
+  800b22:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b24:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b27:	29 f0                	sub    %esi,%eax
+}
+  800b29:	5b                   	pop    %ebx
+  800b2a:	5e                   	pop    %esi
+  800b2b:	5d                   	pop    %ebp
+  800b2c:	c3                   	ret
+
+00800b2d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b2d:	55                   	push   %ebp
+  800b2e:	89 e5                	mov    %esp,%ebp
+  800b30:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b33:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b36:	eb 06                	jmp    800b3e <strcmp+0x11>
+		p++, q++;
+  800b38:	83 c1 01             	add    $0x1,%ecx
+  800b3b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b3e:	0f b6 01             	movzbl (%ecx),%eax
+  800b41:	84 c0                	test   %al,%al
+  800b43:	74 04                	je     800b49 <strcmp+0x1c>
+  800b45:	3a 02                	cmp    (%edx),%al
+  800b47:	74 ef                	je     800b38 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b49:	0f b6 c0             	movzbl %al,%eax
+  800b4c:	0f b6 12             	movzbl (%edx),%edx
+  800b4f:	29 d0                	sub    %edx,%eax
+}
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	53                   	push   %ebx
+  800b57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b5d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b60:	eb 09                	jmp    800b6b <strncmp+0x18>
+		n--, p++, q++;
+  800b62:	83 ea 01             	sub    $0x1,%edx
+  800b65:	83 c0 01             	add    $0x1,%eax
+  800b68:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b6b:	85 d2                	test   %edx,%edx
+  800b6d:	74 18                	je     800b87 <strncmp+0x34>
+  800b6f:	0f b6 18             	movzbl (%eax),%ebx
+  800b72:	84 db                	test   %bl,%bl
+  800b74:	74 04                	je     800b7a <strncmp+0x27>
+  800b76:	3a 19                	cmp    (%ecx),%bl
+  800b78:	74 e8                	je     800b62 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b7a:	0f b6 00             	movzbl (%eax),%eax
+  800b7d:	0f b6 11             	movzbl (%ecx),%edx
+  800b80:	29 d0                	sub    %edx,%eax
+}
+  800b82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b85:	c9                   	leave
+  800b86:	c3                   	ret
+		return 0;
+  800b87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8c:	eb f4                	jmp    800b82 <strncmp+0x2f>
+
+00800b8e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b94:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b98:	eb 03                	jmp    800b9d <strchr+0xf>
+  800b9a:	83 c0 01             	add    $0x1,%eax
+  800b9d:	0f b6 10             	movzbl (%eax),%edx
+  800ba0:	84 d2                	test   %dl,%dl
+  800ba2:	74 06                	je     800baa <strchr+0x1c>
+		if (*s == c)
+  800ba4:	38 ca                	cmp    %cl,%dl
+  800ba6:	75 f2                	jne    800b9a <strchr+0xc>
+  800ba8:	eb 05                	jmp    800baf <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800baa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800baf:	5d                   	pop    %ebp
+  800bb0:	c3                   	ret
+
+00800bb1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bb1:	55                   	push   %ebp
+  800bb2:	89 e5                	mov    %esp,%ebp
+  800bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bbb:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bbe:	38 ca                	cmp    %cl,%dl
+  800bc0:	74 09                	je     800bcb <strfind+0x1a>
+  800bc2:	84 d2                	test   %dl,%dl
+  800bc4:	74 05                	je     800bcb <strfind+0x1a>
+	for (; *s; s++)
+  800bc6:	83 c0 01             	add    $0x1,%eax
+  800bc9:	eb f0                	jmp    800bbb <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bcb:	5d                   	pop    %ebp
+  800bcc:	c3                   	ret
+
+00800bcd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	57                   	push   %edi
+  800bd1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bd4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bd7:	85 c9                	test   %ecx,%ecx
+  800bd9:	74 20                	je     800bfb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bdb:	89 f8                	mov    %edi,%eax
+  800bdd:	09 c8                	or     %ecx,%eax
+  800bdf:	a8 03                	test   $0x3,%al
+  800be1:	75 12                	jne    800bf5 <memset+0x28>
+		c &= 0xFF;
+  800be3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800be7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bed:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bf0:	fc                   	cld
+  800bf1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bf3:	eb 06                	jmp    800bfb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf8:	fc                   	cld
+  800bf9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bfb:	89 f8                	mov    %edi,%eax
+  800bfd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c00:	c9                   	leave
+  800c01:	c3                   	ret
+
+00800c02 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	57                   	push   %edi
+  800c06:	56                   	push   %esi
+  800c07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c0d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c10:	39 c6                	cmp    %eax,%esi
+  800c12:	73 32                	jae    800c46 <memmove+0x44>
+  800c14:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c17:	39 d0                	cmp    %edx,%eax
+  800c19:	73 2b                	jae    800c46 <memmove+0x44>
+		s += n;
+		d += n;
+  800c1b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c1e:	89 d6                	mov    %edx,%esi
+  800c20:	09 fe                	or     %edi,%esi
+  800c22:	09 ce                	or     %ecx,%esi
+  800c24:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c2a:	75 0e                	jne    800c3a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c2c:	83 ef 04             	sub    $0x4,%edi
+  800c2f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c32:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c35:	fd                   	std
+  800c36:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c38:	eb 09                	jmp    800c43 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c3a:	83 ef 01             	sub    $0x1,%edi
+  800c3d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c40:	fd                   	std
+  800c41:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c43:	fc                   	cld
+  800c44:	eb 1a                	jmp    800c60 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c46:	89 f2                	mov    %esi,%edx
+  800c48:	09 c2                	or     %eax,%edx
+  800c4a:	09 ca                	or     %ecx,%edx
+  800c4c:	f6 c2 03             	test   $0x3,%dl
+  800c4f:	75 0a                	jne    800c5b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c51:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c54:	89 c7                	mov    %eax,%edi
+  800c56:	fc                   	cld
+  800c57:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c59:	eb 05                	jmp    800c60 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c5b:	89 c7                	mov    %eax,%edi
+  800c5d:	fc                   	cld
+  800c5e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c60:	5e                   	pop    %esi
+  800c61:	5f                   	pop    %edi
+  800c62:	5d                   	pop    %ebp
+  800c63:	c3                   	ret
+
+00800c64 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c6a:	ff 75 10             	push   0x10(%ebp)
+  800c6d:	ff 75 0c             	push   0xc(%ebp)
+  800c70:	ff 75 08             	push   0x8(%ebp)
+  800c73:	e8 8a ff ff ff       	call   800c02 <memmove>
+}
+  800c78:	c9                   	leave
+  800c79:	c3                   	ret
+
+00800c7a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c7a:	55                   	push   %ebp
+  800c7b:	89 e5                	mov    %esp,%ebp
+  800c7d:	56                   	push   %esi
+  800c7e:	53                   	push   %ebx
+  800c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c82:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c85:	89 c6                	mov    %eax,%esi
+  800c87:	03 75 10             	add    0x10(%ebp),%esi
+  800c8a:	eb 06                	jmp    800c92 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c8c:	83 c0 01             	add    $0x1,%eax
+  800c8f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c92:	39 f0                	cmp    %esi,%eax
+  800c94:	74 14                	je     800caa <memcmp+0x30>
+		if (*s1 != *s2)
+  800c96:	0f b6 08             	movzbl (%eax),%ecx
+  800c99:	0f b6 1a             	movzbl (%edx),%ebx
+  800c9c:	38 d9                	cmp    %bl,%cl
+  800c9e:	74 ec                	je     800c8c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ca0:	0f b6 c1             	movzbl %cl,%eax
+  800ca3:	0f b6 db             	movzbl %bl,%ebx
+  800ca6:	29 d8                	sub    %ebx,%eax
+  800ca8:	eb 05                	jmp    800caf <memcmp+0x35>
+	}
+
+	return 0;
+  800caa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800caf:	5b                   	pop    %ebx
+  800cb0:	5e                   	pop    %esi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+
+00800cb3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cbc:	89 c2                	mov    %eax,%edx
+  800cbe:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cc1:	eb 03                	jmp    800cc6 <memfind+0x13>
+  800cc3:	83 c0 01             	add    $0x1,%eax
+  800cc6:	39 d0                	cmp    %edx,%eax
+  800cc8:	73 04                	jae    800cce <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cca:	38 08                	cmp    %cl,(%eax)
+  800ccc:	75 f5                	jne    800cc3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cce:	5d                   	pop    %ebp
+  800ccf:	c3                   	ret
+
+00800cd0 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800cd0:	55                   	push   %ebp
+  800cd1:	89 e5                	mov    %esp,%ebp
+  800cd3:	57                   	push   %edi
+  800cd4:	56                   	push   %esi
+  800cd5:	53                   	push   %ebx
+  800cd6:	83 ec 1c             	sub    $0x1c,%esp
+  800cd9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cdc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cdf:	eb 03                	jmp    800ce4 <strtol+0x14>
+		s++;
+  800ce1:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800ce4:	0f b6 06             	movzbl (%esi),%eax
+  800ce7:	3c 20                	cmp    $0x20,%al
+  800ce9:	74 f6                	je     800ce1 <strtol+0x11>
+  800ceb:	3c 09                	cmp    $0x9,%al
+  800ced:	74 f2                	je     800ce1 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cef:	3c 2b                	cmp    $0x2b,%al
+  800cf1:	74 43                	je     800d36 <strtol+0x66>
+	int neg = 0;
+  800cf3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800cf8:	3c 2d                	cmp    $0x2d,%al
+  800cfa:	74 44                	je     800d40 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cfc:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800d02:	75 0f                	jne    800d13 <strtol+0x43>
+  800d04:	80 3e 30             	cmpb   $0x30,(%esi)
+  800d07:	74 41                	je     800d4a <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d09:	85 ff                	test   %edi,%edi
+  800d0b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d10:	0f 44 f8             	cmove  %eax,%edi
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800d1d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800d20:	89 fb                	mov    %edi,%ebx
+  800d22:	c1 fb 1f             	sar    $0x1f,%ebx
+  800d25:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800d28:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d2b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d2e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800d31:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d34:	eb 67                	jmp    800d9d <strtol+0xcd>
+		s++;
+  800d36:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800d39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3e:	eb bc                	jmp    800cfc <strtol+0x2c>
+		s++, neg = 1;
+  800d40:	83 c6 01             	add    $0x1,%esi
+  800d43:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d48:	eb b2                	jmp    800cfc <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d4a:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800d4e:	74 0e                	je     800d5e <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800d50:	85 ff                	test   %edi,%edi
+  800d52:	75 bf                	jne    800d13 <strtol+0x43>
+		s++, base = 8;
+  800d54:	83 c6 01             	add    $0x1,%esi
+  800d57:	bf 08 00 00 00       	mov    $0x8,%edi
+  800d5c:	eb b5                	jmp    800d13 <strtol+0x43>
+		s += 2, base = 16;
+  800d5e:	83 c6 02             	add    $0x2,%esi
+  800d61:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d66:	eb ab                	jmp    800d13 <strtol+0x43>
+			dig = *s - '0';
+  800d68:	0f be c9             	movsbl %cl,%ecx
+  800d6b:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800d6e:	39 f9                	cmp    %edi,%ecx
+  800d70:	7d 59                	jge    800dcb <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800d72:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800d76:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d79:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d7c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d7f:	0f af d8             	imul   %eax,%ebx
+  800d82:	0f af d7             	imul   %edi,%edx
+  800d85:	01 d3                	add    %edx,%ebx
+  800d87:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d8a:	f7 e7                	mul    %edi
+  800d8c:	01 da                	add    %ebx,%edx
+  800d8e:	89 cb                	mov    %ecx,%ebx
+  800d90:	c1 fb 1f             	sar    $0x1f,%ebx
+  800d93:	01 c8                	add    %ecx,%eax
+  800d95:	11 da                	adc    %ebx,%edx
+  800d97:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d9a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da0:	0f b6 08             	movzbl (%eax),%ecx
+  800da3:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800da6:	80 fb 09             	cmp    $0x9,%bl
+  800da9:	76 bd                	jbe    800d68 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800dab:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800dae:	80 fb 19             	cmp    $0x19,%bl
+  800db1:	77 08                	ja     800dbb <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800db3:	0f be c9             	movsbl %cl,%ecx
+  800db6:	83 e9 57             	sub    $0x57,%ecx
+  800db9:	eb b3                	jmp    800d6e <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dbb:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800dbe:	80 fb 19             	cmp    $0x19,%bl
+  800dc1:	77 08                	ja     800dcb <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800dc3:	0f be c9             	movsbl %cl,%ecx
+  800dc6:	83 e9 37             	sub    $0x37,%ecx
+  800dc9:	eb a3                	jmp    800d6e <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dcb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800dce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800dd1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800dd4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dd7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ddb:	74 05                	je     800de2 <strtol+0x112>
+		*endptr = (char *) s;
+  800ddd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800de0:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800de2:	85 c9                	test   %ecx,%ecx
+  800de4:	74 07                	je     800ded <strtol+0x11d>
+  800de6:	f7 d8                	neg    %eax
+  800de8:	83 d2 00             	adc    $0x0,%edx
+  800deb:	f7 da                	neg    %edx
+}
+  800ded:	83 c4 1c             	add    $0x1c,%esp
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5f                   	pop    %edi
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+
+00800df5 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800df5:	55                   	push   %ebp
+  800df6:	89 e5                	mov    %esp,%ebp
+  800df8:	57                   	push   %edi
+  800df9:	56                   	push   %esi
+  800dfa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dfb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e02:	74 18                	je     800e1c <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e09:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0f:	89 c3                	mov    %eax,%ebx
+  800e11:	89 c7                	mov    %eax,%edi
+  800e13:	89 c6                	mov    %eax,%esi
+  800e15:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e17:	5b                   	pop    %ebx
+  800e18:	5e                   	pop    %esi
+  800e19:	5f                   	pop    %edi
+  800e1a:	5d                   	pop    %ebp
+  800e1b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	89 c3                	mov    %eax,%ebx
+  800e29:	89 c7                	mov    %eax,%edi
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	8d 35 36 0e 80 00    	lea    0x800e36,%esi
+  800e34:	0f 34                	sysenter
+  800e36:	5d                   	pop    %ebp
+		goto out;
+  800e37:	eb de                	jmp    800e17 <sys_cputs+0x22>
+
+00800e39 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	57                   	push   %edi
+  800e3d:	56                   	push   %esi
+  800e3e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e3f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e46:	74 19                	je     800e61 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e52:	89 d1                	mov    %edx,%ecx
+  800e54:	89 d3                	mov    %edx,%ebx
+  800e56:	89 d7                	mov    %edx,%edi
+  800e58:	89 d6                	mov    %edx,%esi
+  800e5a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e66:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e6b:	89 d1                	mov    %edx,%ecx
+  800e6d:	89 d3                	mov    %edx,%ebx
+  800e6f:	89 d7                	mov    %edx,%edi
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	8d 35 7c 0e 80 00    	lea    0x800e7c,%esi
+  800e7a:	0f 34                	sysenter
+  800e7c:	5d                   	pop    %ebp
+		goto out;
+  800e7d:	eb dd                	jmp    800e5c <sys_cgetc+0x23>
+
+00800e7f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	56                   	push   %esi
+  800e84:	53                   	push   %ebx
+  800e85:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e88:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e8f:	74 21                	je     800eb2 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800e91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e96:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9e:	89 cb                	mov    %ecx,%ebx
+  800ea0:	89 cf                	mov    %ecx,%edi
+  800ea2:	89 ce                	mov    %ecx,%esi
+  800ea4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea6:	85 c0                	test   %eax,%eax
+  800ea8:	7f 27                	jg     800ed1 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800eaa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ead:	5b                   	pop    %ebx
+  800eae:	5e                   	pop    %esi
+  800eaf:	5f                   	pop    %edi
+  800eb0:	5d                   	pop    %ebp
+  800eb1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eba:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ebf:	89 cb                	mov    %ecx,%ebx
+  800ec1:	89 cf                	mov    %ecx,%edi
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	8d 35 ce 0e 80 00    	lea    0x800ece,%esi
+  800ecc:	0f 34                	sysenter
+  800ece:	5d                   	pop    %ebp
+		goto out;
+  800ecf:	eb d5                	jmp    800ea6 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed1:	83 ec 0c             	sub    $0xc,%esp
+  800ed4:	50                   	push   %eax
+  800ed5:	6a 03                	push   $0x3
+  800ed7:	68 8b 39 80 00       	push   $0x80398b
+  800edc:	6a 3f                	push   $0x3f
+  800ede:	68 a8 39 80 00       	push   $0x8039a8
+  800ee3:	e8 71 f4 ff ff       	call   800359 <_panic>
+
+00800ee8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	57                   	push   %edi
+  800eec:	56                   	push   %esi
+  800eed:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800eee:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ef5:	74 19                	je     800f10 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800ef7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efc:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f01:	89 d1                	mov    %edx,%ecx
+  800f03:	89 d3                	mov    %edx,%ebx
+  800f05:	89 d7                	mov    %edx,%edi
+  800f07:	89 d6                	mov    %edx,%esi
+  800f09:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f0b:	5b                   	pop    %ebx
+  800f0c:	5e                   	pop    %esi
+  800f0d:	5f                   	pop    %edi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f15:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f1a:	89 d1                	mov    %edx,%ecx
+  800f1c:	89 d3                	mov    %edx,%ebx
+  800f1e:	89 d7                	mov    %edx,%edi
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	8d 35 2b 0f 80 00    	lea    0x800f2b,%esi
+  800f29:	0f 34                	sysenter
+  800f2b:	5d                   	pop    %ebp
+		goto out;
+  800f2c:	eb dd                	jmp    800f0b <sys_getenvid+0x23>
+
+00800f2e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f34:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f3b:	74 19                	je     800f56 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800f3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f42:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f47:	89 d1                	mov    %edx,%ecx
+  800f49:	89 d3                	mov    %edx,%ebx
+  800f4b:	89 d7                	mov    %edx,%edi
+  800f4d:	89 d6                	mov    %edx,%esi
+  800f4f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f51:	5b                   	pop    %ebx
+  800f52:	5e                   	pop    %esi
+  800f53:	5f                   	pop    %edi
+  800f54:	5d                   	pop    %ebp
+  800f55:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f60:	89 d1                	mov    %edx,%ecx
+  800f62:	89 d3                	mov    %edx,%ebx
+  800f64:	89 d7                	mov    %edx,%edi
+  800f66:	55                   	push   %ebp
+  800f67:	89 e5                	mov    %esp,%ebp
+  800f69:	8d 35 71 0f 80 00    	lea    0x800f71,%esi
+  800f6f:	0f 34                	sysenter
+  800f71:	5d                   	pop    %ebp
+		goto out;
+  800f72:	eb dd                	jmp    800f51 <sys_yield+0x23>
+
+00800f74 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f7d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f84:	74 23                	je     800fa9 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800f86:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f99:	89 f7                	mov    %esi,%edi
+  800f9b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9d:	85 c0                	test   %eax,%eax
+  800f9f:	7f 29                	jg     800fca <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa4:	5b                   	pop    %ebx
+  800fa5:	5e                   	pop    %esi
+  800fa6:	5f                   	pop    %edi
+  800fa7:	5d                   	pop    %ebp
+  800fa8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fbc:	55                   	push   %ebp
+  800fbd:	89 e5                	mov    %esp,%ebp
+  800fbf:	8d 35 c7 0f 80 00    	lea    0x800fc7,%esi
+  800fc5:	0f 34                	sysenter
+  800fc7:	5d                   	pop    %ebp
+		goto out;
+  800fc8:	eb d3                	jmp    800f9d <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fca:	83 ec 0c             	sub    $0xc,%esp
+  800fcd:	50                   	push   %eax
+  800fce:	6a 04                	push   $0x4
+  800fd0:	68 8b 39 80 00       	push   $0x80398b
+  800fd5:	6a 3f                	push   $0x3f
+  800fd7:	68 a8 39 80 00       	push   $0x8039a8
+  800fdc:	e8 78 f3 ff ff       	call   800359 <_panic>
+
+00800fe1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	56                   	push   %esi
+  800fe6:	53                   	push   %ebx
+  800fe7:	83 ec 0c             	sub    $0xc,%esp
+  800fea:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800fed:	85 f6                	test   %esi,%esi
+  800fef:	75 09                	jne    800ffa <sys_page_map+0x19>
+  800ff1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ff8:	74 1f                	je     801019 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800ffa:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801005:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801008:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80100b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100d:	85 c0                	test   %eax,%eax
+  80100f:	7f 27                	jg     801038 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5f                   	pop    %edi
+  801017:	5d                   	pop    %ebp
+  801018:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801019:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801024:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801027:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	8d 35 35 10 80 00    	lea    0x801035,%esi
+  801033:	0f 34                	sysenter
+  801035:	5d                   	pop    %ebp
+		goto out;
+  801036:	eb d5                	jmp    80100d <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801038:	83 ec 0c             	sub    $0xc,%esp
+  80103b:	50                   	push   %eax
+  80103c:	6a 05                	push   $0x5
+  80103e:	68 8b 39 80 00       	push   $0x80398b
+  801043:	6a 3f                	push   $0x3f
+  801045:	68 a8 39 80 00       	push   $0x8039a8
+  80104a:	e8 0a f3 ff ff       	call   800359 <_panic>
+
+0080104f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+  801055:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801058:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80105f:	74 22                	je     801083 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801061:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801066:	b8 06 00 00 00       	mov    $0x6,%eax
+  80106b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801071:	89 df                	mov    %ebx,%edi
+  801073:	89 de                	mov    %ebx,%esi
+  801075:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801077:	85 c0                	test   %eax,%eax
+  801079:	7f 28                	jg     8010a3 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80107b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107e:	5b                   	pop    %ebx
+  80107f:	5e                   	pop    %esi
+  801080:	5f                   	pop    %edi
+  801081:	5d                   	pop    %ebp
+  801082:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801083:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801093:	89 df                	mov    %ebx,%edi
+  801095:	55                   	push   %ebp
+  801096:	89 e5                	mov    %esp,%ebp
+  801098:	8d 35 a0 10 80 00    	lea    0x8010a0,%esi
+  80109e:	0f 34                	sysenter
+  8010a0:	5d                   	pop    %ebp
+		goto out;
+  8010a1:	eb d4                	jmp    801077 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a3:	83 ec 0c             	sub    $0xc,%esp
+  8010a6:	50                   	push   %eax
+  8010a7:	6a 06                	push   $0x6
+  8010a9:	68 8b 39 80 00       	push   $0x80398b
+  8010ae:	6a 3f                	push   $0x3f
+  8010b0:	68 a8 39 80 00       	push   $0x8039a8
+  8010b5:	e8 9f f2 ff ff       	call   800359 <_panic>
+
+008010ba <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	57                   	push   %edi
+  8010be:	56                   	push   %esi
+  8010bf:	53                   	push   %ebx
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010c3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010ca:	74 22                	je     8010ee <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8010cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dc:	89 df                	mov    %ebx,%edi
+  8010de:	89 de                	mov    %ebx,%esi
+  8010e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e2:	85 c0                	test   %eax,%eax
+  8010e4:	7f 28                	jg     80110e <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e9:	5b                   	pop    %ebx
+  8010ea:	5e                   	pop    %esi
+  8010eb:	5f                   	pop    %edi
+  8010ec:	5d                   	pop    %ebp
+  8010ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010fe:	89 df                	mov    %ebx,%edi
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	8d 35 0b 11 80 00    	lea    0x80110b,%esi
+  801109:	0f 34                	sysenter
+  80110b:	5d                   	pop    %ebp
+		goto out;
+  80110c:	eb d4                	jmp    8010e2 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	50                   	push   %eax
+  801112:	6a 08                	push   $0x8
+  801114:	68 8b 39 80 00       	push   $0x80398b
+  801119:	6a 3f                	push   $0x3f
+  80111b:	68 a8 39 80 00       	push   $0x8039a8
+  801120:	e8 34 f2 ff ff       	call   800359 <_panic>
+
+00801125 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80112e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801135:	74 22                	je     801159 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801137:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801141:	8b 55 08             	mov    0x8(%ebp),%edx
+  801144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801147:	89 df                	mov    %ebx,%edi
+  801149:	89 de                	mov    %ebx,%esi
+  80114b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80114d:	85 c0                	test   %eax,%eax
+  80114f:	7f 28                	jg     801179 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801151:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801154:	5b                   	pop    %ebx
+  801155:	5e                   	pop    %esi
+  801156:	5f                   	pop    %edi
+  801157:	5d                   	pop    %ebp
+  801158:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801159:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801164:	b8 09 00 00 00       	mov    $0x9,%eax
+  801169:	89 df                	mov    %ebx,%edi
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	8d 35 76 11 80 00    	lea    0x801176,%esi
+  801174:	0f 34                	sysenter
+  801176:	5d                   	pop    %ebp
+		goto out;
+  801177:	eb d4                	jmp    80114d <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801179:	83 ec 0c             	sub    $0xc,%esp
+  80117c:	50                   	push   %eax
+  80117d:	6a 09                	push   $0x9
+  80117f:	68 8b 39 80 00       	push   $0x80398b
+  801184:	6a 3f                	push   $0x3f
+  801186:	68 a8 39 80 00       	push   $0x8039a8
+  80118b:	e8 c9 f1 ff ff       	call   800359 <_panic>
+
+00801190 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801190:	55                   	push   %ebp
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	57                   	push   %edi
+  801194:	56                   	push   %esi
+  801195:	53                   	push   %ebx
+  801196:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801199:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011a0:	74 22                	je     8011c4 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8011a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b2:	89 df                	mov    %ebx,%edi
+  8011b4:	89 de                	mov    %ebx,%esi
+  8011b6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011b8:	85 c0                	test   %eax,%eax
+  8011ba:	7f 28                	jg     8011e4 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bf:	5b                   	pop    %ebx
+  8011c0:	5e                   	pop    %esi
+  8011c1:	5f                   	pop    %edi
+  8011c2:	5d                   	pop    %ebp
+  8011c3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011d4:	89 df                	mov    %ebx,%edi
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	8d 35 e1 11 80 00    	lea    0x8011e1,%esi
+  8011df:	0f 34                	sysenter
+  8011e1:	5d                   	pop    %ebp
+		goto out;
+  8011e2:	eb d4                	jmp    8011b8 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e4:	83 ec 0c             	sub    $0xc,%esp
+  8011e7:	50                   	push   %eax
+  8011e8:	6a 0a                	push   $0xa
+  8011ea:	68 8b 39 80 00       	push   $0x80398b
+  8011ef:	6a 3f                	push   $0x3f
+  8011f1:	68 a8 39 80 00       	push   $0x8039a8
+  8011f6:	e8 5e f1 ff ff       	call   800359 <_panic>
+
+008011fb <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+  801201:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801204:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80120b:	74 22                	je     80122f <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80120d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801212:	b8 17 00 00 00       	mov    $0x17,%eax
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121d:	89 df                	mov    %ebx,%edi
+  80121f:	89 de                	mov    %ebx,%esi
+  801221:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801223:	85 c0                	test   %eax,%eax
+  801225:	7f 28                	jg     80124f <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801227:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122a:	5b                   	pop    %ebx
+  80122b:	5e                   	pop    %esi
+  80122c:	5f                   	pop    %edi
+  80122d:	5d                   	pop    %ebp
+  80122e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80122f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801234:	8b 55 08             	mov    0x8(%ebp),%edx
+  801237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80123f:	89 df                	mov    %ebx,%edi
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	8d 35 4c 12 80 00    	lea    0x80124c,%esi
+  80124a:	0f 34                	sysenter
+  80124c:	5d                   	pop    %ebp
+		goto out;
+  80124d:	eb d4                	jmp    801223 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80124f:	83 ec 0c             	sub    $0xc,%esp
+  801252:	50                   	push   %eax
+  801253:	6a 17                	push   $0x17
+  801255:	68 8b 39 80 00       	push   $0x80398b
+  80125a:	6a 3f                	push   $0x3f
+  80125c:	68 a8 39 80 00       	push   $0x8039a8
+  801261:	e8 f3 f0 ff ff       	call   800359 <_panic>
+
+00801266 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80126f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801276:	74 22                	je     80129a <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801278:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801282:	8b 55 08             	mov    0x8(%ebp),%edx
+  801285:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801288:	89 df                	mov    %ebx,%edi
+  80128a:	89 de                	mov    %ebx,%esi
+  80128c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80128e:	85 c0                	test   %eax,%eax
+  801290:	7f 28                	jg     8012ba <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801292:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5f                   	pop    %edi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80129a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a5:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012aa:	89 df                	mov    %ebx,%edi
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	8d 35 b7 12 80 00    	lea    0x8012b7,%esi
+  8012b5:	0f 34                	sysenter
+  8012b7:	5d                   	pop    %ebp
+		goto out;
+  8012b8:	eb d4                	jmp    80128e <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ba:	83 ec 0c             	sub    $0xc,%esp
+  8012bd:	50                   	push   %eax
+  8012be:	6a 18                	push   $0x18
+  8012c0:	68 8b 39 80 00       	push   $0x80398b
+  8012c5:	6a 3f                	push   $0x3f
+  8012c7:	68 a8 39 80 00       	push   $0x8039a8
+  8012cc:	e8 88 f0 ff ff       	call   800359 <_panic>
+
+008012d1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012d1:	55                   	push   %ebp
+  8012d2:	89 e5                	mov    %esp,%ebp
+  8012d4:	57                   	push   %edi
+  8012d5:	56                   	push   %esi
+  8012d6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012d7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012de:	74 1d                	je     8012fd <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8012e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012f6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8012f8:	5b                   	pop    %ebx
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5f                   	pop    %edi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801300:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801303:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801308:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80130e:	55                   	push   %ebp
+  80130f:	89 e5                	mov    %esp,%ebp
+  801311:	8d 35 19 13 80 00    	lea    0x801319,%esi
+  801317:	0f 34                	sysenter
+  801319:	5d                   	pop    %ebp
+		goto out;
+  80131a:	eb dc                	jmp    8012f8 <sys_ipc_try_send+0x27>
+
+0080131c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	57                   	push   %edi
+  801320:	56                   	push   %esi
+  801321:	53                   	push   %ebx
+  801322:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801325:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80132c:	74 21                	je     80134f <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80132e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801333:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801338:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133b:	89 cb                	mov    %ecx,%ebx
+  80133d:	89 cf                	mov    %ecx,%edi
+  80133f:	89 ce                	mov    %ecx,%esi
+  801341:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801343:	85 c0                	test   %eax,%eax
+  801345:	7f 27                	jg     80136e <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801347:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134a:	5b                   	pop    %ebx
+  80134b:	5e                   	pop    %esi
+  80134c:	5f                   	pop    %edi
+  80134d:	5d                   	pop    %ebp
+  80134e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80134f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801352:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801357:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80135c:	89 cb                	mov    %ecx,%ebx
+  80135e:	89 cf                	mov    %ecx,%edi
+  801360:	55                   	push   %ebp
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	8d 35 6b 13 80 00    	lea    0x80136b,%esi
+  801369:	0f 34                	sysenter
+  80136b:	5d                   	pop    %ebp
+		goto out;
+  80136c:	eb d5                	jmp    801343 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80136e:	83 ec 0c             	sub    $0xc,%esp
+  801371:	50                   	push   %eax
+  801372:	6a 0d                	push   $0xd
+  801374:	68 8b 39 80 00       	push   $0x80398b
+  801379:	6a 3f                	push   $0x3f
+  80137b:	68 a8 39 80 00       	push   $0x8039a8
+  801380:	e8 d4 ef ff ff       	call   800359 <_panic>
+
+00801385 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	57                   	push   %edi
+  801389:	56                   	push   %esi
+  80138a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80138b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801392:	74 1b                	je     8013af <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801394:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801399:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80139e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a4:	89 df                	mov    %ebx,%edi
+  8013a6:	89 de                	mov    %ebx,%esi
+  8013a8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8013aa:	5b                   	pop    %ebx
+  8013ab:	5e                   	pop    %esi
+  8013ac:	5f                   	pop    %edi
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ba:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013bf:	89 df                	mov    %ebx,%edi
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	8d 35 cc 13 80 00    	lea    0x8013cc,%esi
+  8013ca:	0f 34                	sysenter
+  8013cc:	5d                   	pop    %ebp
+		goto out;
+  8013cd:	eb db                	jmp    8013aa <sys_ipc_recv_until+0x25>
+
+008013cf <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	57                   	push   %edi
+  8013d3:	56                   	push   %esi
+  8013d4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013d5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013dc:	74 19                	je     8013f7 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8013de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013e8:	89 d1                	mov    %edx,%ecx
+  8013ea:	89 d3                	mov    %edx,%ebx
+  8013ec:	89 d7                	mov    %edx,%edi
+  8013ee:	89 d6                	mov    %edx,%esi
+  8013f0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8013f2:	5b                   	pop    %ebx
+  8013f3:	5e                   	pop    %esi
+  8013f4:	5f                   	pop    %edi
+  8013f5:	5d                   	pop    %ebp
+  8013f6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801401:	89 d1                	mov    %edx,%ecx
+  801403:	89 d3                	mov    %edx,%ebx
+  801405:	89 d7                	mov    %edx,%edi
+  801407:	55                   	push   %ebp
+  801408:	89 e5                	mov    %esp,%ebp
+  80140a:	8d 35 12 14 80 00    	lea    0x801412,%esi
+  801410:	0f 34                	sysenter
+  801412:	5d                   	pop    %ebp
+		goto out;
+  801413:	eb dd                	jmp    8013f2 <sys_time_msec+0x23>
+
+00801415 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	57                   	push   %edi
+  801419:	56                   	push   %esi
+  80141a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80141b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801422:	74 1a                	je     80143e <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801424:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801429:	b8 10 00 00 00       	mov    $0x10,%eax
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	89 cb                	mov    %ecx,%ebx
+  801433:	89 cf                	mov    %ecx,%edi
+  801435:	89 ce                	mov    %ecx,%esi
+  801437:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801439:	5b                   	pop    %ebx
+  80143a:	5e                   	pop    %esi
+  80143b:	5f                   	pop    %edi
+  80143c:	5d                   	pop    %ebp
+  80143d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80143e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801441:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801446:	b8 10 00 00 00       	mov    $0x10,%eax
+  80144b:	89 cb                	mov    %ecx,%ebx
+  80144d:	89 cf                	mov    %ecx,%edi
+  80144f:	55                   	push   %ebp
+  801450:	89 e5                	mov    %esp,%ebp
+  801452:	8d 35 5a 14 80 00    	lea    0x80145a,%esi
+  801458:	0f 34                	sysenter
+  80145a:	5d                   	pop    %ebp
+		goto out;
+  80145b:	eb dc                	jmp    801439 <sys_sleep_until+0x24>
+
+0080145d <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80145d:	55                   	push   %ebp
+  80145e:	89 e5                	mov    %esp,%ebp
+  801460:	57                   	push   %edi
+  801461:	56                   	push   %esi
+  801462:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801463:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80146a:	74 1a                	je     801486 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80146c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801471:	b8 11 00 00 00       	mov    $0x11,%eax
+  801476:	8b 55 08             	mov    0x8(%ebp),%edx
+  801479:	89 cb                	mov    %ecx,%ebx
+  80147b:	89 cf                	mov    %ecx,%edi
+  80147d:	89 ce                	mov    %ecx,%esi
+  80147f:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801481:	5b                   	pop    %ebx
+  801482:	5e                   	pop    %esi
+  801483:	5f                   	pop    %edi
+  801484:	5d                   	pop    %ebp
+  801485:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801493:	89 cb                	mov    %ecx,%ebx
+  801495:	89 cf                	mov    %ecx,%edi
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	8d 35 a2 14 80 00    	lea    0x8014a2,%esi
+  8014a0:	0f 34                	sysenter
+  8014a2:	5d                   	pop    %ebp
+		goto out;
+  8014a3:	eb dc                	jmp    801481 <sys_env_print_stats+0x24>
+
+008014a5 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014b2:	74 1b                	je     8014cf <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8014b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c4:	89 df                	mov    %ebx,%edi
+  8014c6:	89 de                	mov    %ebx,%esi
+  8014c8:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8014ca:	5b                   	pop    %ebx
+  8014cb:	5e                   	pop    %esi
+  8014cc:	5f                   	pop    %edi
+  8014cd:	5d                   	pop    %ebp
+  8014ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014da:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014df:	89 df                	mov    %ebx,%edi
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	8d 35 ec 14 80 00    	lea    0x8014ec,%esi
+  8014ea:	0f 34                	sysenter
+  8014ec:	5d                   	pop    %ebp
+		goto out;
+  8014ed:	eb db                	jmp    8014ca <sys_perf+0x25>
+
+008014ef <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	57                   	push   %edi
+  8014f3:	56                   	push   %esi
+  8014f4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014fc:	74 19                	je     801517 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8014fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801503:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801508:	89 d1                	mov    %edx,%ecx
+  80150a:	89 d3                	mov    %edx,%ebx
+  80150c:	89 d7                	mov    %edx,%edi
+  80150e:	89 d6                	mov    %edx,%esi
+  801510:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801512:	5b                   	pop    %ebx
+  801513:	5e                   	pop    %esi
+  801514:	5f                   	pop    %edi
+  801515:	5d                   	pop    %ebp
+  801516:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801521:	89 d1                	mov    %edx,%ecx
+  801523:	89 d3                	mov    %edx,%ebx
+  801525:	89 d7                	mov    %edx,%edi
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	8d 35 32 15 80 00    	lea    0x801532,%esi
+  801530:	0f 34                	sysenter
+  801532:	5d                   	pop    %ebp
+		goto out;
+  801533:	eb dd                	jmp    801512 <sys_fork+0x23>
+
+00801535 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	57                   	push   %edi
+  801539:	56                   	push   %esi
+  80153a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80153b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801542:	74 1c                	je     801560 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801544:	be 00 00 00 00       	mov    $0x0,%esi
+  801549:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80154e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801551:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801554:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801557:	89 f7                	mov    %esi,%edi
+  801559:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80155b:	5b                   	pop    %ebx
+  80155c:	5e                   	pop    %esi
+  80155d:	5f                   	pop    %edi
+  80155e:	5d                   	pop    %ebp
+  80155f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801560:	8b 55 08             	mov    0x8(%ebp),%edx
+  801563:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801566:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80156b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801570:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	8d 35 7e 15 80 00    	lea    0x80157e,%esi
+  80157c:	0f 34                	sysenter
+  80157e:	5d                   	pop    %ebp
+		goto out;
+  80157f:	eb da                	jmp    80155b <sys_thread_create+0x26>
+
+00801581 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801581:	55                   	push   %ebp
+  801582:	89 e5                	mov    %esp,%ebp
+  801584:	57                   	push   %edi
+  801585:	56                   	push   %esi
+  801586:	53                   	push   %ebx
+  801587:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80158a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801591:	74 24                	je     8015b7 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801593:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801598:	be 00 00 00 00       	mov    $0x0,%esi
+  80159d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015a9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015ab:	85 c0                	test   %eax,%eax
+  8015ad:	7f 27                	jg     8015d6 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8015af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b2:	5b                   	pop    %ebx
+  8015b3:	5e                   	pop    %esi
+  8015b4:	5f                   	pop    %edi
+  8015b5:	5d                   	pop    %ebp
+  8015b6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8015c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015c8:	55                   	push   %ebp
+  8015c9:	89 e5                	mov    %esp,%ebp
+  8015cb:	8d 35 d3 15 80 00    	lea    0x8015d3,%esi
+  8015d1:	0f 34                	sysenter
+  8015d3:	5d                   	pop    %ebp
+		goto out;
+  8015d4:	eb d5                	jmp    8015ab <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015d6:	83 ec 0c             	sub    $0xc,%esp
+  8015d9:	50                   	push   %eax
+  8015da:	6a 1f                	push   $0x1f
+  8015dc:	68 8b 39 80 00       	push   $0x80398b
+  8015e1:	6a 3f                	push   $0x3f
+  8015e3:	68 a8 39 80 00       	push   $0x8039a8
+  8015e8:	e8 6c ed ff ff       	call   800359 <_panic>
+
+008015ed <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8015ed:	55                   	push   %ebp
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	57                   	push   %edi
+  8015f1:	56                   	push   %esi
+  8015f2:	53                   	push   %ebx
+  8015f3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8015f6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015fd:	74 23                	je     801622 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8015ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801604:	b8 20 00 00 00       	mov    $0x20,%eax
+  801609:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801612:	89 f7                	mov    %esi,%edi
+  801614:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801616:	85 c0                	test   %eax,%eax
+  801618:	7f 29                	jg     801643 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80161a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161d:	5b                   	pop    %ebx
+  80161e:	5e                   	pop    %esi
+  80161f:	5f                   	pop    %edi
+  801620:	5d                   	pop    %ebp
+  801621:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801622:	8b 55 08             	mov    0x8(%ebp),%edx
+  801625:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801628:	b8 20 00 00 00       	mov    $0x20,%eax
+  80162d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801632:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+  801638:	8d 35 40 16 80 00    	lea    0x801640,%esi
+  80163e:	0f 34                	sysenter
+  801640:	5d                   	pop    %ebp
+		goto out;
+  801641:	eb d3                	jmp    801616 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801643:	83 ec 0c             	sub    $0xc,%esp
+  801646:	50                   	push   %eax
+  801647:	6a 20                	push   $0x20
+  801649:	68 8b 39 80 00       	push   $0x80398b
+  80164e:	6a 3f                	push   $0x3f
+  801650:	68 a8 39 80 00       	push   $0x8039a8
+  801655:	e8 ff ec ff ff       	call   800359 <_panic>
+
+0080165a <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80165a:	55                   	push   %ebp
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	57                   	push   %edi
+  80165e:	56                   	push   %esi
+  80165f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801660:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801667:	74 1b                	je     801684 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801669:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801673:	8b 55 08             	mov    0x8(%ebp),%edx
+  801676:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801679:	89 df                	mov    %ebx,%edi
+  80167b:	89 de                	mov    %ebx,%esi
+  80167d:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80167f:	5b                   	pop    %ebx
+  801680:	5e                   	pop    %esi
+  801681:	5f                   	pop    %edi
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801684:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801694:	89 df                	mov    %ebx,%edi
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	8d 35 a1 16 80 00    	lea    0x8016a1,%esi
+  80169f:	0f 34                	sysenter
+  8016a1:	5d                   	pop    %ebp
+		goto out;
+  8016a2:	eb db                	jmp    80167f <sys_batch+0x25>
+
+008016a4 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8016a4:	55                   	push   %ebp
+  8016a5:	89 e5                	mov    %esp,%ebp
+  8016a7:	57                   	push   %edi
+  8016a8:	56                   	push   %esi
+  8016a9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016aa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016b1:	74 1a                	je     8016cd <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8016b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8016bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c0:	89 cb                	mov    %ecx,%ebx
+  8016c2:	89 cf                	mov    %ecx,%edi
+  8016c4:	89 ce                	mov    %ecx,%esi
+  8016c6:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8016c8:	5b                   	pop    %ebx
+  8016c9:	5e                   	pop    %esi
+  8016ca:	5f                   	pop    %edi
+  8016cb:	5d                   	pop    %ebp
+  8016cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016d5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8016da:	89 cb                	mov    %ecx,%ebx
+  8016dc:	89 cf                	mov    %ecx,%edi
+  8016de:	55                   	push   %ebp
+  8016df:	89 e5                	mov    %esp,%ebp
+  8016e1:	8d 35 e9 16 80 00    	lea    0x8016e9,%esi
+  8016e7:	0f 34                	sysenter
+  8016e9:	5d                   	pop    %ebp
+		goto out;
+  8016ea:	eb dc                	jmp    8016c8 <sys_trace_ctl+0x24>
+
+008016ec <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	57                   	push   %edi
+  8016f0:	56                   	push   %esi
+  8016f1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016f2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016f9:	74 1c                	je     801717 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8016fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801700:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801705:	8b 55 08             	mov    0x8(%ebp),%edx
+  801708:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170e:	89 f7                	mov    %esi,%edi
+  801710:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801712:	5b                   	pop    %ebx
+  801713:	5e                   	pop    %esi
+  801714:	5f                   	pop    %edi
+  801715:	5d                   	pop    %ebp
+  801716:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801717:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801722:	bf 00 00 00 00       	mov    $0x0,%edi
+  801727:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80172a:	55                   	push   %ebp
+  80172b:	89 e5                	mov    %esp,%ebp
+  80172d:	8d 35 35 17 80 00    	lea    0x801735,%esi
+  801733:	0f 34                	sysenter
+  801735:	5d                   	pop    %ebp
+		goto out;
+  801736:	eb da                	jmp    801712 <sys_trace_read+0x26>
+
+00801738 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801738:	55                   	push   %ebp
+  801739:	89 e5                	mov    %esp,%ebp
+  80173b:	57                   	push   %edi
+  80173c:	56                   	push   %esi
+  80173d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80173e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801745:	74 1c                	je     801763 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801747:	be 00 00 00 00       	mov    $0x0,%esi
+  80174c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801751:	8b 55 08             	mov    0x8(%ebp),%edx
+  801754:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801757:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80175a:	89 f7                	mov    %esi,%edi
+  80175c:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80175e:	5b                   	pop    %ebx
+  80175f:	5e                   	pop    %esi
+  801760:	5f                   	pop    %edi
+  801761:	5d                   	pop    %ebp
+  801762:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801763:	8b 55 08             	mov    0x8(%ebp),%edx
+  801766:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801769:	b8 21 00 00 00       	mov    $0x21,%eax
+  80176e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801773:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801776:	55                   	push   %ebp
+  801777:	89 e5                	mov    %esp,%ebp
+  801779:	8d 35 81 17 80 00    	lea    0x801781,%esi
+  80177f:	0f 34                	sysenter
+  801781:	5d                   	pop    %ebp
+		goto out;
+  801782:	eb da                	jmp    80175e <sys_meminfo+0x26>
+
+00801784 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801784:	55                   	push   %ebp
+  801785:	89 e5                	mov    %esp,%ebp
+  801787:	57                   	push   %edi
+  801788:	56                   	push   %esi
+  801789:	53                   	push   %ebx
+  80178a:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80178d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801791:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801798:	74 1f                	je     8017b9 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80179a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179f:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a7:	89 df                	mov    %ebx,%edi
+  8017a9:	89 de                	mov    %ebx,%esi
+  8017ab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	7f 25                	jg     8017d6 <sys_env_set_ksm+0x52>
+}
+  8017b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b4:	5b                   	pop    %ebx
+  8017b5:	5e                   	pop    %esi
+  8017b6:	5f                   	pop    %edi
+  8017b7:	5d                   	pop    %ebp
+  8017b8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c1:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017c6:	89 df                	mov    %ebx,%edi
+  8017c8:	55                   	push   %ebp
+  8017c9:	89 e5                	mov    %esp,%ebp
+  8017cb:	8d 35 d3 17 80 00    	lea    0x8017d3,%esi
+  8017d1:	0f 34                	sysenter
+  8017d3:	5d                   	pop    %ebp
+		goto out;
+  8017d4:	eb d7                	jmp    8017ad <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017d6:	83 ec 0c             	sub    $0xc,%esp
+  8017d9:	50                   	push   %eax
+  8017da:	6a 22                	push   $0x22
+  8017dc:	68 8b 39 80 00       	push   $0x80398b
+  8017e1:	6a 3f                	push   $0x3f
+  8017e3:	68 a8 39 80 00       	push   $0x8039a8
+  8017e8:	e8 6c eb ff ff       	call   800359 <_panic>
+
+008017ed <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8017ed:	55                   	push   %ebp
+  8017ee:	89 e5                	mov    %esp,%ebp
+  8017f0:	57                   	push   %edi
+  8017f1:	56                   	push   %esi
+  8017f2:	53                   	push   %ebx
+  8017f3:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8017f6:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8017f9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801800:	74 24                	je     801826 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801802:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801807:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80180c:	89 cb                	mov    %ecx,%ebx
+  80180e:	89 cf                	mov    %ecx,%edi
+  801810:	89 ce                	mov    %ecx,%esi
+  801812:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801814:	85 c0                	test   %eax,%eax
+  801816:	7f 2a                	jg     801842 <sys_time_nsec+0x55>
+	return ns;
+}
+  801818:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80181b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80181e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801821:	5b                   	pop    %ebx
+  801822:	5e                   	pop    %esi
+  801823:	5f                   	pop    %edi
+  801824:	5d                   	pop    %ebp
+  801825:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801826:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80182b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801830:	89 cb                	mov    %ecx,%ebx
+  801832:	89 cf                	mov    %ecx,%edi
+  801834:	55                   	push   %ebp
+  801835:	89 e5                	mov    %esp,%ebp
+  801837:	8d 35 3f 18 80 00    	lea    0x80183f,%esi
+  80183d:	0f 34                	sysenter
+  80183f:	5d                   	pop    %ebp
+		goto out;
+  801840:	eb d2                	jmp    801814 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801842:	83 ec 0c             	sub    $0xc,%esp
+  801845:	50                   	push   %eax
+  801846:	6a 0f                	push   $0xf
+  801848:	68 8b 39 80 00       	push   $0x80398b
+  80184d:	6a 3f                	push   $0x3f
+  80184f:	68 a8 39 80 00       	push   $0x8039a8
+  801854:	e8 00 eb ff ff       	call   800359 <_panic>
+
+00801859 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801859:	55                   	push   %ebp
+  80185a:	89 e5                	mov    %esp,%ebp
+  80185c:	57                   	push   %edi
+  80185d:	56                   	push   %esi
+  80185e:	53                   	push   %ebx
+  80185f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801862:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801869:	74 22                	je     80188d <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80186b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801870:	b8 12 00 00 00       	mov    $0x12,%eax
+  801875:	8b 55 08             	mov    0x8(%ebp),%edx
+  801878:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187b:	89 df                	mov    %ebx,%edi
+  80187d:	89 de                	mov    %ebx,%esi
+  80187f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801881:	85 c0                	test   %eax,%eax
+  801883:	7f 28                	jg     8018ad <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801885:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801888:	5b                   	pop    %ebx
+  801889:	5e                   	pop    %esi
+  80188a:	5f                   	pop    %edi
+  80188b:	5d                   	pop    %ebp
+  80188c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80188d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801892:	8b 55 08             	mov    0x8(%ebp),%edx
+  801895:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801898:	b8 12 00 00 00       	mov    $0x12,%eax
+  80189d:	89 df                	mov    %ebx,%edi
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	8d 35 aa 18 80 00    	lea    0x8018aa,%esi
+  8018a8:	0f 34                	sysenter
+  8018aa:	5d                   	pop    %ebp
+		goto out;
+  8018ab:	eb d4                	jmp    801881 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018ad:	83 ec 0c             	sub    $0xc,%esp
+  8018b0:	50                   	push   %eax
+  8018b1:	6a 12                	push   $0x12
+  8018b3:	68 8b 39 80 00       	push   $0x80398b
+  8018b8:	6a 3f                	push   $0x3f
+  8018ba:	68 a8 39 80 00       	push   $0x8039a8
+  8018bf:	e8 95 ea ff ff       	call   800359 <_panic>
+
+008018c4 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8018c4:	55                   	push   %ebp
+  8018c5:	89 e5                	mov    %esp,%ebp
+  8018c7:	57                   	push   %edi
+  8018c8:	56                   	push   %esi
+  8018c9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018ca:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018d1:	74 1b                	je     8018ee <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8018d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e3:	89 df                	mov    %ebx,%edi
+  8018e5:	89 de                	mov    %ebx,%esi
+  8018e7:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8018e9:	5b                   	pop    %ebx
+  8018ea:	5e                   	pop    %esi
+  8018eb:	5f                   	pop    %edi
+  8018ec:	5d                   	pop    %ebp
+  8018ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018fe:	89 df                	mov    %ebx,%edi
+  801900:	55                   	push   %ebp
+  801901:	89 e5                	mov    %esp,%ebp
+  801903:	8d 35 0b 19 80 00    	lea    0x80190b,%esi
+  801909:	0f 34                	sysenter
+  80190b:	5d                   	pop    %ebp
+		goto out;
+  80190c:	eb db                	jmp    8018e9 <sys_e1000_receive+0x25>
+
+0080190e <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80190e:	55                   	push   %ebp
+  80190f:	89 e5                	mov    %esp,%ebp
+  801911:	57                   	push   %edi
+  801912:	56                   	push   %esi
+  801913:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801914:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80191b:	74 1b                	je     801938 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80191d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801922:	b8 14 00 00 00       	mov    $0x14,%eax
+  801927:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80192d:	89 df                	mov    %ebx,%edi
+  80192f:	89 de                	mov    %ebx,%esi
+  801931:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801933:	5b                   	pop    %ebx
+  801934:	5e                   	pop    %esi
+  801935:	5f                   	pop    %edi
+  801936:	5d                   	pop    %ebp
+  801937:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801938:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801940:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801943:	b8 14 00 00 00       	mov    $0x14,%eax
+  801948:	89 df                	mov    %ebx,%edi
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	8d 35 55 19 80 00    	lea    0x801955,%esi
+  801953:	0f 34                	sysenter
+  801955:	5d                   	pop    %ebp
+		goto out;
+  801956:	eb db                	jmp    801933 <sys_e1000_read_hwaddr+0x25>
+
+00801958 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801958:	55                   	push   %ebp
+  801959:	89 e5                	mov    %esp,%ebp
+  80195b:	57                   	push   %edi
+  80195c:	56                   	push   %esi
+  80195d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80195e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801965:	74 1a                	je     801981 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801967:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80196c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801971:	8b 55 08             	mov    0x8(%ebp),%edx
+  801974:	89 cb                	mov    %ecx,%ebx
+  801976:	89 cf                	mov    %ecx,%edi
+  801978:	89 ce                	mov    %ecx,%esi
+  80197a:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80197c:	5b                   	pop    %ebx
+  80197d:	5e                   	pop    %esi
+  80197e:	5f                   	pop    %edi
+  80197f:	5d                   	pop    %ebp
+  801980:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801981:	8b 55 08             	mov    0x8(%ebp),%edx
+  801984:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801989:	b8 15 00 00 00       	mov    $0x15,%eax
+  80198e:	89 cb                	mov    %ecx,%ebx
+  801990:	89 cf                	mov    %ecx,%edi
+  801992:	55                   	push   %ebp
+  801993:	89 e5                	mov    %esp,%ebp
+  801995:	8d 35 9d 19 80 00    	lea    0x80199d,%esi
+  80199b:	0f 34                	sysenter
+  80199d:	5d                   	pop    %ebp
+		goto out;
+  80199e:	eb dc                	jmp    80197c <sys_sb16_read_version+0x24>
+
+008019a0 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	57                   	push   %edi
+  8019a4:	56                   	push   %esi
+  8019a5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019a6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8019ad:	74 1b                	je     8019ca <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8019af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8019b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019bf:	89 df                	mov    %ebx,%edi
+  8019c1:	89 de                	mov    %ebx,%esi
+  8019c3:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8019c5:	5b                   	pop    %ebx
+  8019c6:	5e                   	pop    %esi
+  8019c7:	5f                   	pop    %edi
+  8019c8:	5d                   	pop    %ebp
+  8019c9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019d5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8019da:	89 df                	mov    %ebx,%edi
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+  8019df:	8d 35 e7 19 80 00    	lea    0x8019e7,%esi
+  8019e5:	0f 34                	sysenter
+  8019e7:	5d                   	pop    %ebp
+		goto out;
+  8019e8:	eb db                	jmp    8019c5 <sys_sb16_play+0x25>
+
+008019ea <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	53                   	push   %ebx
+  8019ee:	83 ec 04             	sub    $0x4,%esp
+  8019f1:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8019f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019fa:	f6 c4 04             	test   $0x4,%ah
+  8019fd:	74 0c                	je     801a0b <dupperm+0x21>
+  8019ff:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801a06:	f6 c4 08             	test   $0x8,%ah
+  801a09:	75 62                	jne    801a6d <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801a0b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801a12:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801a17:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801a1d:	74 19                	je     801a38 <dupperm+0x4e>
+  801a1f:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801a26:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801a2b:	83 f8 01             	cmp    $0x1,%eax
+  801a2e:	19 c0                	sbb    %eax,%eax
+  801a30:	25 00 08 00 00       	and    $0x800,%eax
+  801a35:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801a38:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  801a3f:	89 c1                	mov    %eax,%ecx
+  801a41:	80 cd 04             	or     $0x4,%ch
+  801a44:	f6 c7 04             	test   $0x4,%bh
+  801a47:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801a4a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a51:	f6 c1 02             	test   $0x2,%cl
+  801a54:	74 12                	je     801a68 <dupperm+0x7e>
+  801a56:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801a5d:	89 c2                	mov    %eax,%edx
+  801a5f:	83 ca 02             	or     $0x2,%edx
+  801a62:	f6 c5 04             	test   $0x4,%ch
+  801a65:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801a68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a6b:	c9                   	leave
+  801a6c:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801a6d:	68 b8 39 80 00       	push   $0x8039b8
+  801a72:	68 50 3a 80 00       	push   $0x803a50
+  801a77:	6a 39                	push   $0x39
+  801a79:	68 65 3a 80 00       	push   $0x803a65
+  801a7e:	e8 d6 e8 ff ff       	call   800359 <_panic>
+
+00801a83 <pgfault>:
+{
+  801a83:	55                   	push   %ebp
+  801a84:	89 e5                	mov    %esp,%ebp
+  801a86:	53                   	push   %ebx
+  801a87:	83 ec 04             	sub    $0x4,%esp
+  801a8a:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801a8d:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801a8f:	89 c3                	mov    %eax,%ebx
+  801a91:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801a97:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801a9b:	74 6d                	je     801b0a <pgfault+0x87>
+  801a9d:	89 da                	mov    %ebx,%edx
+  801a9f:	c1 ea 16             	shr    $0x16,%edx
+  801aa2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801aa9:	f6 c2 80             	test   $0x80,%dl
+  801aac:	75 5c                	jne    801b0a <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801aae:	c1 e8 0c             	shr    $0xc,%eax
+  801ab1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801ab8:	f6 c4 08             	test   $0x8,%ah
+  801abb:	74 4d                	je     801b0a <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801abd:	83 ec 04             	sub    $0x4,%esp
+  801ac0:	6a 07                	push   $0x7
+  801ac2:	68 00 f0 7f 00       	push   $0x7ff000
+  801ac7:	6a 00                	push   $0x0
+  801ac9:	e8 a6 f4 ff ff       	call   800f74 <sys_page_alloc>
+  801ace:	83 c4 10             	add    $0x10,%esp
+  801ad1:	85 c0                	test   %eax,%eax
+  801ad3:	78 49                	js     801b1e <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801ad5:	83 ec 04             	sub    $0x4,%esp
+  801ad8:	68 00 10 00 00       	push   $0x1000
+  801add:	53                   	push   %ebx
+  801ade:	68 00 f0 7f 00       	push   $0x7ff000
+  801ae3:	e8 1a f1 ff ff       	call   800c02 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801ae8:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801aef:	53                   	push   %ebx
+  801af0:	6a 00                	push   $0x0
+  801af2:	68 00 f0 7f 00       	push   $0x7ff000
+  801af7:	6a 00                	push   $0x0
+  801af9:	e8 e3 f4 ff ff       	call   800fe1 <sys_page_map>
+  801afe:	83 c4 20             	add    $0x20,%esp
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	78 2d                	js     801b32 <pgfault+0xaf>
+}
+  801b05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b08:	c9                   	leave
+  801b09:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801b0a:	83 ec 04             	sub    $0x4,%esp
+  801b0d:	68 70 3a 80 00       	push   $0x803a70
+  801b12:	6a 1e                	push   $0x1e
+  801b14:	68 65 3a 80 00       	push   $0x803a65
+  801b19:	e8 3b e8 ff ff       	call   800359 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801b1e:	83 ec 04             	sub    $0x4,%esp
+  801b21:	68 ec 39 80 00       	push   $0x8039ec
+  801b26:	6a 29                	push   $0x29
+  801b28:	68 65 3a 80 00       	push   $0x803a65
+  801b2d:	e8 27 e8 ff ff       	call   800359 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801b32:	50                   	push   %eax
+  801b33:	68 20 3a 80 00       	push   $0x803a20
+  801b38:	6a 2e                	push   $0x2e
+  801b3a:	68 65 3a 80 00       	push   $0x803a65
+  801b3f:	e8 15 e8 ff ff       	call   800359 <_panic>
+
+00801b44 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801b44:	55                   	push   %ebp
+  801b45:	89 e5                	mov    %esp,%ebp
+  801b47:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801b4a:	ff 75 0c             	push   0xc(%ebp)
+  801b4d:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801b50:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801b57:	e8 23 f3 ff ff       	call   800e7f <sys_env_destroy>
+}
+  801b5c:	83 c4 10             	add    $0x10,%esp
+  801b5f:	c9                   	leave
+  801b60:	c3                   	ret
+
+00801b61 <ufork>:
+{
+  801b61:	55                   	push   %ebp
+  801b62:	89 e5                	mov    %esp,%ebp
+  801b64:	57                   	push   %edi
+  801b65:	56                   	push   %esi
+  801b66:	53                   	push   %ebx
+  801b67:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801b6d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b72:	cd 30                	int    $0x30
+  801b74:	89 c6                	mov    %eax,%esi
+  801b76:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801b7c:	85 c0                	test   %eax,%eax
+  801b7e:	78 56                	js     801bd6 <ufork+0x75>
+	if (pid > 0) {
+  801b80:	0f 8e b3 02 00 00    	jle    801e39 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801b86:	83 ec 0c             	sub    $0xc,%esp
+  801b89:	68 83 1a 80 00       	push   $0x801a83
+  801b8e:	e8 aa 17 00 00       	call   80333d <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801b93:	83 c4 08             	add    $0x8,%esp
+  801b96:	68 a4 33 80 00       	push   $0x8033a4
+  801b9b:	56                   	push   %esi
+  801b9c:	e8 ef f5 ff ff       	call   801190 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801ba1:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801ba7:	89 1c 24             	mov    %ebx,(%esp)
+  801baa:	e8 21 03 00 00       	call   801ed0 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801baf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801bb6:	6a 07                	push   $0x7
+  801bb8:	68 00 f0 bf ee       	push   $0xeebff000
+  801bbd:	56                   	push   %esi
+  801bbe:	53                   	push   %ebx
+  801bbf:	e8 8d 04 00 00       	call   802051 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801bc4:	83 c4 20             	add    $0x20,%esp
+  801bc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcc:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801bd2:	89 fe                	mov    %edi,%esi
+  801bd4:	eb 22                	jmp    801bf8 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801bd6:	50                   	push   %eax
+  801bd7:	68 89 3a 80 00       	push   $0x803a89
+  801bdc:	68 a9 00 00 00       	push   $0xa9
+  801be1:	68 65 3a 80 00       	push   $0x803a65
+  801be6:	e8 6e e7 ff ff       	call   800359 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801beb:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801bf1:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801bf6:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801bf8:	89 f7                	mov    %esi,%edi
+  801bfa:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801c00:	0f 87 e9 01 00 00    	ja     801def <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801c06:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801c0c:	85 f6                	test   %esi,%esi
+  801c0e:	0f 49 d6             	cmovns %esi,%edx
+  801c11:	c1 fa 0a             	sar    $0xa,%edx
+  801c14:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801c1b:	f6 c1 01             	test   $0x1,%cl
+  801c1e:	74 cb                	je     801beb <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801c20:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c27:	f6 c2 80             	test   $0x80,%dl
+  801c2a:	75 17                	jne    801c43 <ufork+0xe2>
+			j = i + 1;
+  801c2c:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801c2f:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801c36:	f6 c2 01             	test   $0x1,%dl
+  801c39:	0f 85 f3 00 00 00    	jne    801d32 <ufork+0x1d1>
+			j = i + 1;
+  801c3f:	89 de                	mov    %ebx,%esi
+  801c41:	eb b5                	jmp    801bf8 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801c43:	89 fb                	mov    %edi,%ebx
+  801c45:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801c48:	89 d8                	mov    %ebx,%eax
+  801c4a:	c1 e8 16             	shr    $0x16,%eax
+  801c4d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c54:	89 c2                	mov    %eax,%edx
+  801c56:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801c5c:	25 02 04 00 00       	and    $0x402,%eax
+  801c61:	83 f8 02             	cmp    $0x2,%eax
+  801c64:	74 31                	je     801c97 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801c66:	83 ec 04             	sub    $0x4,%esp
+  801c69:	6a 01                	push   $0x1
+  801c6b:	52                   	push   %edx
+  801c6c:	53                   	push   %ebx
+  801c6d:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c73:	53                   	push   %ebx
+  801c74:	6a 00                	push   $0x0
+  801c76:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801c7c:	50                   	push   %eax
+  801c7d:	e8 fa 03 00 00       	call   80207c <batch_map>
+		return;
+  801c82:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801c85:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801c8b:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801c90:	89 c6                	mov    %eax,%esi
+				continue;
+  801c92:	e9 61 ff ff ff       	jmp    801bf8 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801c97:	83 ec 04             	sub    $0x4,%esp
+  801c9a:	80 ca 80             	or     $0x80,%dl
+  801c9d:	52                   	push   %edx
+  801c9e:	53                   	push   %ebx
+  801c9f:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801ca5:	e8 ca f2 ff ff       	call   800f74 <sys_page_alloc>
+  801caa:	83 c4 10             	add    $0x10,%esp
+  801cad:	85 c0                	test   %eax,%eax
+  801caf:	78 5d                	js     801d0e <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801cb1:	83 ec 0c             	sub    $0xc,%esp
+  801cb4:	6a 07                	push   $0x7
+  801cb6:	68 00 00 40 00       	push   $0x400000
+  801cbb:	6a 00                	push   $0x0
+  801cbd:	53                   	push   %ebx
+  801cbe:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801cc4:	e8 18 f3 ff ff       	call   800fe1 <sys_page_map>
+  801cc9:	83 c4 20             	add    $0x20,%esp
+  801ccc:	85 c0                	test   %eax,%eax
+  801cce:	78 50                	js     801d20 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801cd0:	83 ec 04             	sub    $0x4,%esp
+  801cd3:	68 00 00 40 00       	push   $0x400000
+  801cd8:	53                   	push   %ebx
+  801cd9:	68 00 00 40 00       	push   $0x400000
+  801cde:	e8 1f ef ff ff       	call   800c02 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801ce3:	83 c4 08             	add    $0x8,%esp
+  801ce6:	68 00 00 40 00       	push   $0x400000
+  801ceb:	6a 00                	push   $0x0
+  801ced:	e8 5d f3 ff ff       	call   80104f <sys_page_unmap>
+  801cf2:	83 c4 10             	add    $0x10,%esp
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	79 8c                	jns    801c85 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801cf9:	50                   	push   %eax
+  801cfa:	68 bd 3a 80 00       	push   $0x803abd
+  801cff:	68 81 00 00 00       	push   $0x81
+  801d04:	68 65 3a 80 00       	push   $0x803a65
+  801d09:	e8 4b e6 ff ff       	call   800359 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801d0e:	50                   	push   %eax
+  801d0f:	68 99 3a 80 00       	push   $0x803a99
+  801d14:	6a 7c                	push   $0x7c
+  801d16:	68 65 3a 80 00       	push   $0x803a65
+  801d1b:	e8 39 e6 ff ff       	call   800359 <_panic>
+		panic("sys_page_map: %e", r);
+  801d20:	50                   	push   %eax
+  801d21:	68 ac 3a 80 00       	push   $0x803aac
+  801d26:	6a 7e                	push   $0x7e
+  801d28:	68 65 3a 80 00       	push   $0x803a65
+  801d2d:	e8 27 e6 ff ff       	call   800359 <_panic>
+  801d32:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801d38:	eb 22                	jmp    801d5c <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801d3a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801d41:	a8 01                	test   $0x1,%al
+  801d43:	74 35                	je     801d7a <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801d45:	89 d8                	mov    %ebx,%eax
+  801d47:	e8 9e fc ff ff       	call   8019ea <dupperm>
+  801d4c:	89 c6                	mov    %eax,%esi
+  801d4e:	89 f8                	mov    %edi,%eax
+  801d50:	e8 95 fc ff ff       	call   8019ea <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801d55:	39 c6                	cmp    %eax,%esi
+  801d57:	75 21                	jne    801d7a <ufork+0x219>
+				j++;
+  801d59:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801d5c:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801d62:	74 16                	je     801d7a <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801d64:	89 d8                	mov    %ebx,%eax
+  801d66:	c1 e8 0a             	shr    $0xa,%eax
+  801d69:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d70:	25 81 00 00 00       	and    $0x81,%eax
+  801d75:	83 f8 01             	cmp    $0x1,%eax
+  801d78:	74 c0                	je     801d3a <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801d7a:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801d80:	89 d8                	mov    %ebx,%eax
+  801d82:	29 f0                	sub    %esi,%eax
+  801d84:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801d8a:	89 fe                	mov    %edi,%esi
+  801d8c:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801d8f:	89 f8                	mov    %edi,%eax
+  801d91:	e8 54 fc ff ff       	call   8019ea <dupperm>
+  801d96:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801d98:	83 ec 08             	sub    $0x8,%esp
+  801d9b:	6a 02                	push   $0x2
+  801d9d:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801da3:	51                   	push   %ecx
+  801da4:	e8 95 01 00 00       	call   801f3e <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801da9:	83 c4 0c             	add    $0xc,%esp
+  801dac:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801db2:	57                   	push   %edi
+  801db3:	56                   	push   %esi
+  801db4:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801dba:	56                   	push   %esi
+  801dbb:	6a 00                	push   $0x0
+  801dbd:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801dc3:	51                   	push   %ecx
+  801dc4:	e8 b3 02 00 00       	call   80207c <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801dc9:	83 c4 1c             	add    $0x1c,%esp
+  801dcc:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801dd2:	57                   	push   %edi
+  801dd3:	56                   	push   %esi
+  801dd4:	6a 00                	push   $0x0
+  801dd6:	56                   	push   %esi
+  801dd7:	6a 00                	push   $0x0
+  801dd9:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801ddf:	50                   	push   %eax
+  801de0:	e8 97 02 00 00       	call   80207c <batch_map>
+	return 0;
+  801de5:	83 c4 20             	add    $0x20,%esp
+  801de8:	89 de                	mov    %ebx,%esi
+  801dea:	e9 09 fe ff ff       	jmp    801bf8 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801def:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801df5:	83 ec 04             	sub    $0x4,%esp
+  801df8:	6a 02                	push   $0x2
+  801dfa:	56                   	push   %esi
+  801dfb:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801e01:	53                   	push   %ebx
+  801e02:	e8 c9 02 00 00       	call   8020d0 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801e07:	89 1c 24             	mov    %ebx,(%esp)
+  801e0a:	e8 dd 00 00 00       	call   801eec <batch_flush>
+  801e0f:	83 c4 10             	add    $0x10,%esp
+  801e12:	85 c0                	test   %eax,%eax
+  801e14:	78 0e                	js     801e24 <ufork+0x2c3>
+}
+  801e16:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801e1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e1f:	5b                   	pop    %ebx
+  801e20:	5e                   	pop    %esi
+  801e21:	5f                   	pop    %edi
+  801e22:	5d                   	pop    %ebp
+  801e23:	c3                   	ret
+			panic("fork: %e", r);
+  801e24:	50                   	push   %eax
+  801e25:	68 90 3a 80 00       	push   $0x803a90
+  801e2a:	68 d7 00 00 00       	push   $0xd7
+  801e2f:	68 65 3a 80 00       	push   $0x803a65
+  801e34:	e8 20 e5 ff ff       	call   800359 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801e39:	e8 aa f0 ff ff       	call   800ee8 <sys_getenvid>
+  801e3e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e43:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e49:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801e4e:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801e53:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801e5a:	00 00 00 
+  801e5d:	eb b7                	jmp    801e16 <ufork+0x2b5>
+
+00801e5f <fork>:
+{
+  801e5f:	55                   	push   %ebp
+  801e60:	89 e5                	mov    %esp,%ebp
+  801e62:	53                   	push   %ebx
+  801e63:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801e66:	68 83 1a 80 00       	push   $0x801a83
+  801e6b:	e8 cd 14 00 00       	call   80333d <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801e70:	e8 7a f6 ff ff       	call   8014ef <sys_fork>
+  801e75:	89 c3                	mov    %eax,%ebx
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	78 09                	js     801e87 <fork+0x28>
+	if (pid == 0)
+  801e7e:	74 1c                	je     801e9c <fork+0x3d>
+}
+  801e80:	89 d8                	mov    %ebx,%eax
+  801e82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e85:	c9                   	leave
+  801e86:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801e87:	50                   	push   %eax
+  801e88:	68 89 3a 80 00       	push   $0x803a89
+  801e8d:	68 ed 00 00 00       	push   $0xed
+  801e92:	68 65 3a 80 00       	push   $0x803a65
+  801e97:	e8 bd e4 ff ff       	call   800359 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801e9c:	e8 47 f0 ff ff       	call   800ee8 <sys_getenvid>
+  801ea1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ea6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801eac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801eb1:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801eb6:	eb c8                	jmp    801e80 <fork+0x21>
+
+00801eb8 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801eb8:	55                   	push   %ebp
+  801eb9:	89 e5                	mov    %esp,%ebp
+  801ebb:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801ebe:	ff 75 0c             	push   0xc(%ebp)
+  801ec1:	ff 75 08             	push   0x8(%ebp)
+  801ec4:	68 44 1b 80 00       	push   $0x801b44
+  801ec9:	e8 67 f6 ff ff       	call   801535 <sys_thread_create>
+}
+  801ece:	c9                   	leave
+  801ecf:	c3                   	ret
+
+00801ed0 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801ed0:	55                   	push   %ebp
+  801ed1:	89 e5                	mov    %esp,%ebp
+  801ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801ed6:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801edd:	00 00 00 
+	b->b_error = 0;
+  801ee0:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801ee7:	00 00 00 
+}
+  801eea:	5d                   	pop    %ebp
+  801eeb:	c3                   	ret
+
+00801eec <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801eec:	55                   	push   %ebp
+  801eed:	89 e5                	mov    %esp,%ebp
+  801eef:	53                   	push   %ebx
+  801ef0:	83 ec 04             	sub    $0x4,%esp
+  801ef3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801ef6:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	7e 09                	jle    801f09 <batch_flush+0x1d>
+  801f00:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801f07:	74 15                	je     801f1e <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801f09:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801f10:	00 00 00 
+	return b->b_error;
+  801f13:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801f19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f1c:	c9                   	leave
+  801f1d:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801f1e:	83 ec 08             	sub    $0x8,%esp
+  801f21:	50                   	push   %eax
+  801f22:	53                   	push   %ebx
+  801f23:	e8 32 f7 ff ff       	call   80165a <sys_batch>
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	79 da                	jns    801f09 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801f2f:	f7 d8                	neg    %eax
+  801f31:	0f b6 c0             	movzbl %al,%eax
+  801f34:	f7 d8                	neg    %eax
+  801f36:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801f3c:	eb cb                	jmp    801f09 <batch_flush+0x1d>
+
+00801f3e <batch_reserve>:
+{
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	83 ec 08             	sub    $0x8,%esp
+  801f44:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801f47:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801f4d:	03 45 0c             	add    0xc(%ebp),%eax
+  801f50:	83 f8 10             	cmp    $0x10,%eax
+  801f53:	7f 02                	jg     801f57 <batch_reserve+0x19>
+}
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+		batch_flush(b);
+  801f57:	83 ec 0c             	sub    $0xc,%esp
+  801f5a:	52                   	push   %edx
+  801f5b:	e8 8c ff ff ff       	call   801eec <batch_flush>
+  801f60:	83 c4 10             	add    $0x10,%esp
+}
+  801f63:	eb f0                	jmp    801f55 <batch_reserve+0x17>
+
+00801f65 <batch_next>:
+{
+  801f65:	55                   	push   %ebp
+  801f66:	89 e5                	mov    %esp,%ebp
+  801f68:	53                   	push   %ebx
+  801f69:	83 ec 04             	sub    $0x4,%esp
+  801f6c:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801f6e:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801f75:	74 28                	je     801f9f <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801f77:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801f7d:	8d 50 01             	lea    0x1(%eax),%edx
+  801f80:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801f86:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f89:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801f8b:	83 ec 04             	sub    $0x4,%esp
+  801f8e:	6a 1c                	push   $0x1c
+  801f90:	6a 00                	push   $0x0
+  801f92:	53                   	push   %ebx
+  801f93:	e8 35 ec ff ff       	call   800bcd <memset>
+}
+  801f98:	89 d8                	mov    %ebx,%eax
+  801f9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f9d:	c9                   	leave
+  801f9e:	c3                   	ret
+		batch_flush(b);
+  801f9f:	83 ec 0c             	sub    $0xc,%esp
+  801fa2:	50                   	push   %eax
+  801fa3:	e8 44 ff ff ff       	call   801eec <batch_flush>
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	eb ca                	jmp    801f77 <batch_next+0x12>
+
+00801fad <batch_page>:
+{
+  801fad:	55                   	push   %ebp
+  801fae:	89 e5                	mov    %esp,%ebp
+  801fb0:	57                   	push   %edi
+  801fb1:	56                   	push   %esi
+  801fb2:	53                   	push   %ebx
+  801fb3:	83 ec 1c             	sub    $0x1c,%esp
+  801fb6:	89 d3                	mov    %edx,%ebx
+  801fb8:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801fba:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801fc0:	85 d2                	test   %edx,%edx
+  801fc2:	74 50                	je     802014 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801fc4:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801fc7:	01 c1                	add    %eax,%ecx
+  801fc9:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801fcc:	75 46                	jne    802014 <batch_page+0x67>
+  801fce:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801fd1:	75 41                	jne    802014 <batch_page+0x67>
+  801fd3:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801fd6:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801fd9:	75 39                	jne    802014 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801fdb:	83 ea 01             	sub    $0x1,%edx
+  801fde:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801fe1:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801fe4:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801fe8:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801feb:	75 27                	jne    802014 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801fed:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801ff0:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801ff4:	89 fa                	mov    %edi,%edx
+  801ff6:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801ff9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801ffc:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801fff:	39 55 08             	cmp    %edx,0x8(%ebp)
+  802002:	75 10                	jne    802014 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802004:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  802008:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80200b:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  80200f:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802012:	74 2a                	je     80203e <batch_page+0x91>
+	op = batch_next(b);
+  802014:	e8 4c ff ff ff       	call   801f65 <batch_next>
+	op->bo_op = opcode;
+  802019:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  80201b:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  80201e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802021:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802024:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802027:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  80202a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80202d:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  802030:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802033:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802036:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802039:	89 78 14             	mov    %edi,0x14(%eax)
+  80203c:	eb 0b                	jmp    802049 <batch_page+0x9c>
+		op->bo_npages += npages;
+  80203e:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  802042:	03 7d 18             	add    0x18(%ebp),%edi
+  802045:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802049:	83 c4 1c             	add    $0x1c,%esp
+  80204c:	5b                   	pop    %ebx
+  80204d:	5e                   	pop    %esi
+  80204e:	5f                   	pop    %edi
+  80204f:	5d                   	pop    %ebp
+  802050:	c3                   	ret
+
+00802051 <batch_alloc>:
+{
+  802051:	55                   	push   %ebp
+  802052:	89 e5                	mov    %esp,%ebp
+  802054:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802057:	ff 75 18             	push   0x18(%ebp)
+  80205a:	ff 75 14             	push   0x14(%ebp)
+  80205d:	ff 75 10             	push   0x10(%ebp)
+  802060:	ff 75 0c             	push   0xc(%ebp)
+  802063:	6a 00                	push   $0x0
+  802065:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802072:	e8 36 ff ff ff       	call   801fad <batch_page>
+}
+  802077:	83 c4 20             	add    $0x20,%esp
+  80207a:	c9                   	leave
+  80207b:	c3                   	ret
+
+0080207c <batch_map>:
+{
+  80207c:	55                   	push   %ebp
+  80207d:	89 e5                	mov    %esp,%ebp
+  80207f:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802082:	ff 75 20             	push   0x20(%ebp)
+  802085:	ff 75 1c             	push   0x1c(%ebp)
+  802088:	ff 75 18             	push   0x18(%ebp)
+  80208b:	ff 75 14             	push   0x14(%ebp)
+  80208e:	ff 75 10             	push   0x10(%ebp)
+  802091:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802094:	ba 01 00 00 00       	mov    $0x1,%edx
+  802099:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209c:	e8 0c ff ff ff       	call   801fad <batch_page>
+}
+  8020a1:	83 c4 20             	add    $0x20,%esp
+  8020a4:	c9                   	leave
+  8020a5:	c3                   	ret
+
+008020a6 <batch_unmap>:
+{
+  8020a6:	55                   	push   %ebp
+  8020a7:	89 e5                	mov    %esp,%ebp
+  8020a9:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  8020ac:	ff 75 14             	push   0x14(%ebp)
+  8020af:	6a 00                	push   $0x0
+  8020b1:	ff 75 10             	push   0x10(%ebp)
+  8020b4:	ff 75 0c             	push   0xc(%ebp)
+  8020b7:	6a 00                	push   $0x0
+  8020b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020be:	ba 02 00 00 00       	mov    $0x2,%edx
+  8020c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c6:	e8 e2 fe ff ff       	call   801fad <batch_page>
+}
+  8020cb:	83 c4 20             	add    $0x20,%esp
+  8020ce:	c9                   	leave
+  8020cf:	c3                   	ret
+
+008020d0 <batch_set_status>:
+{
+  8020d0:	55                   	push   %ebp
+  8020d1:	89 e5                	mov    %esp,%ebp
+  8020d3:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8020d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d9:	e8 87 fe ff ff       	call   801f65 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8020de:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8020e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020e7:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8020ea:	8b 55 10             	mov    0x10(%ebp),%edx
+  8020ed:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8020f0:	c9                   	leave
+  8020f1:	c3                   	ret
+
+008020f2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8020f2:	55                   	push   %ebp
+  8020f3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8020fd:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802100:	5d                   	pop    %ebp
+  802101:	c3                   	ret
+
+00802102 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802102:	55                   	push   %ebp
+  802103:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802105:	8b 45 08             	mov    0x8(%ebp),%eax
+  802108:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80210d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802112:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802117:	5d                   	pop    %ebp
+  802118:	c3                   	ret
+
+00802119 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802119:	55                   	push   %ebp
+  80211a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80211c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802121:	eb 02                	jmp    802125 <fd_alloc+0xc>
+  802123:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802125:	89 c2                	mov    %eax,%edx
+  802127:	c1 ea 16             	shr    $0x16,%edx
+  80212a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802131:	f6 c2 01             	test   $0x1,%dl
+  802134:	74 2b                	je     802161 <fd_alloc+0x48>
+  802136:	89 c2                	mov    %eax,%edx
+  802138:	c1 ea 0c             	shr    $0xc,%edx
+  80213b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802142:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802148:	f6 c1 01             	test   $0x1,%cl
+  80214b:	74 14                	je     802161 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80214d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802153:	75 ce                	jne    802123 <fd_alloc+0xa>
+  802155:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80215a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80215f:	eb 05                	jmp    802166 <fd_alloc+0x4d>
+			return 0;
+  802161:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802166:	8b 55 08             	mov    0x8(%ebp),%edx
+  802169:	89 02                	mov    %eax,(%edx)
+}
+  80216b:	89 c8                	mov    %ecx,%eax
+  80216d:	5d                   	pop    %ebp
+  80216e:	c3                   	ret
+
+0080216f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80216f:	55                   	push   %ebp
+  802170:	89 e5                	mov    %esp,%ebp
+  802172:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802175:	83 f8 1f             	cmp    $0x1f,%eax
+  802178:	77 30                	ja     8021aa <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80217a:	c1 e0 0c             	shl    $0xc,%eax
+  80217d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802182:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802188:	f6 c2 01             	test   $0x1,%dl
+  80218b:	74 24                	je     8021b1 <fd_lookup+0x42>
+  80218d:	89 c2                	mov    %eax,%edx
+  80218f:	c1 ea 0c             	shr    $0xc,%edx
+  802192:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802199:	f6 c2 01             	test   $0x1,%dl
+  80219c:	74 1a                	je     8021b8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80219e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021a1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8021a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021a8:	5d                   	pop    %ebp
+  8021a9:	c3                   	ret
+		return -E_INVAL;
+  8021aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021af:	eb f7                	jmp    8021a8 <fd_lookup+0x39>
+		return -E_INVAL;
+  8021b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021b6:	eb f0                	jmp    8021a8 <fd_lookup+0x39>
+  8021b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021bd:	eb e9                	jmp    8021a8 <fd_lookup+0x39>
+
+008021bf <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8021bf:	55                   	push   %ebp
+  8021c0:	89 e5                	mov    %esp,%ebp
+  8021c2:	53                   	push   %ebx
+  8021c3:	83 ec 04             	sub    $0x4,%esp
+  8021c6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8021c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ce:	eb 03                	jmp    8021d3 <dev_lookup+0x14>
+  8021d0:	83 c0 01             	add    $0x1,%eax
+  8021d3:	8b 1c 85 4c 3b 80 00 	mov    0x803b4c(,%eax,4),%ebx
+  8021da:	85 db                	test   %ebx,%ebx
+  8021dc:	74 0b                	je     8021e9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8021de:	39 13                	cmp    %edx,(%ebx)
+  8021e0:	75 ee                	jne    8021d0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8021e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e7:	eb 2e                	jmp    802217 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8021e9:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8021eb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8021f0:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8021f6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8021fb:	76 24                	jbe    802221 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8021fd:	8b 41 48             	mov    0x48(%ecx),%eax
+  802200:	83 ec 04             	sub    $0x4,%esp
+  802203:	52                   	push   %edx
+  802204:	50                   	push   %eax
+  802205:	68 d0 3a 80 00       	push   $0x803ad0
+  80220a:	e8 25 e2 ff ff       	call   800434 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80220f:	83 c4 10             	add    $0x10,%esp
+  802212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802217:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80221a:	89 1a                	mov    %ebx,(%edx)
+}
+  80221c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80221f:	c9                   	leave
+  802220:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802221:	c1 e8 10             	shr    $0x10,%eax
+  802224:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80222a:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802230:	eb cb                	jmp    8021fd <dev_lookup+0x3e>
+
+00802232 <fd_close>:
+{
+  802232:	55                   	push   %ebp
+  802233:	89 e5                	mov    %esp,%ebp
+  802235:	57                   	push   %edi
+  802236:	56                   	push   %esi
+  802237:	53                   	push   %ebx
+  802238:	83 ec 24             	sub    $0x24,%esp
+  80223b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80223e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802241:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802244:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802245:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80224b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80224e:	50                   	push   %eax
+  80224f:	e8 1b ff ff ff       	call   80216f <fd_lookup>
+  802254:	89 c3                	mov    %eax,%ebx
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	85 c0                	test   %eax,%eax
+  80225b:	78 05                	js     802262 <fd_close+0x30>
+	    || fd != fd2)
+  80225d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802260:	74 16                	je     802278 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802262:	89 f8                	mov    %edi,%eax
+  802264:	84 c0                	test   %al,%al
+  802266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80226e:	89 d8                	mov    %ebx,%eax
+  802270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802273:	5b                   	pop    %ebx
+  802274:	5e                   	pop    %esi
+  802275:	5f                   	pop    %edi
+  802276:	5d                   	pop    %ebp
+  802277:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802278:	83 ec 08             	sub    $0x8,%esp
+  80227b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80227e:	50                   	push   %eax
+  80227f:	ff 36                	push   (%esi)
+  802281:	e8 39 ff ff ff       	call   8021bf <dev_lookup>
+  802286:	89 c3                	mov    %eax,%ebx
+  802288:	83 c4 10             	add    $0x10,%esp
+  80228b:	85 c0                	test   %eax,%eax
+  80228d:	78 1a                	js     8022a9 <fd_close+0x77>
+		if (dev->dev_close)
+  80228f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802292:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802295:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	74 0b                	je     8022a9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80229e:	83 ec 0c             	sub    $0xc,%esp
+  8022a1:	56                   	push   %esi
+  8022a2:	ff d0                	call   *%eax
+  8022a4:	89 c3                	mov    %eax,%ebx
+  8022a6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8022a9:	83 ec 08             	sub    $0x8,%esp
+  8022ac:	56                   	push   %esi
+  8022ad:	6a 00                	push   $0x0
+  8022af:	e8 9b ed ff ff       	call   80104f <sys_page_unmap>
+	return r;
+  8022b4:	83 c4 10             	add    $0x10,%esp
+  8022b7:	eb b5                	jmp    80226e <fd_close+0x3c>
+
+008022b9 <close>:
+
+int
+close(int fdnum)
+{
+  8022b9:	55                   	push   %ebp
+  8022ba:	89 e5                	mov    %esp,%ebp
+  8022bc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c2:	50                   	push   %eax
+  8022c3:	ff 75 08             	push   0x8(%ebp)
+  8022c6:	e8 a4 fe ff ff       	call   80216f <fd_lookup>
+  8022cb:	83 c4 10             	add    $0x10,%esp
+  8022ce:	85 c0                	test   %eax,%eax
+  8022d0:	79 02                	jns    8022d4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8022d2:	c9                   	leave
+  8022d3:	c3                   	ret
+		return fd_close(fd, 1);
+  8022d4:	83 ec 08             	sub    $0x8,%esp
+  8022d7:	6a 01                	push   $0x1
+  8022d9:	ff 75 f4             	push   -0xc(%ebp)
+  8022dc:	e8 51 ff ff ff       	call   802232 <fd_close>
+  8022e1:	83 c4 10             	add    $0x10,%esp
+  8022e4:	eb ec                	jmp    8022d2 <close+0x19>
+
+008022e6 <close_all>:
+
+void
+close_all(void)
+{
+  8022e6:	55                   	push   %ebp
+  8022e7:	89 e5                	mov    %esp,%ebp
+  8022e9:	53                   	push   %ebx
+  8022ea:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8022ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8022f2:	83 ec 0c             	sub    $0xc,%esp
+  8022f5:	53                   	push   %ebx
+  8022f6:	e8 be ff ff ff       	call   8022b9 <close>
+	for (i = 0; i < MAXFD; i++)
+  8022fb:	83 c3 01             	add    $0x1,%ebx
+  8022fe:	83 c4 10             	add    $0x10,%esp
+  802301:	83 fb 20             	cmp    $0x20,%ebx
+  802304:	75 ec                	jne    8022f2 <close_all+0xc>
+}
+  802306:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802309:	c9                   	leave
+  80230a:	c3                   	ret
+
+0080230b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80230b:	55                   	push   %ebp
+  80230c:	89 e5                	mov    %esp,%ebp
+  80230e:	57                   	push   %edi
+  80230f:	56                   	push   %esi
+  802310:	53                   	push   %ebx
+  802311:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802314:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802317:	50                   	push   %eax
+  802318:	ff 75 08             	push   0x8(%ebp)
+  80231b:	e8 4f fe ff ff       	call   80216f <fd_lookup>
+  802320:	89 c3                	mov    %eax,%ebx
+  802322:	83 c4 10             	add    $0x10,%esp
+  802325:	85 c0                	test   %eax,%eax
+  802327:	78 7f                	js     8023a8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802329:	83 ec 0c             	sub    $0xc,%esp
+  80232c:	ff 75 0c             	push   0xc(%ebp)
+  80232f:	e8 85 ff ff ff       	call   8022b9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802334:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802337:	c1 e6 0c             	shl    $0xc,%esi
+  80233a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802340:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802343:	89 3c 24             	mov    %edi,(%esp)
+  802346:	e8 b7 fd ff ff       	call   802102 <fd2data>
+  80234b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80234d:	89 34 24             	mov    %esi,(%esp)
+  802350:	e8 ad fd ff ff       	call   802102 <fd2data>
+  802355:	83 c4 10             	add    $0x10,%esp
+  802358:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80235b:	89 d8                	mov    %ebx,%eax
+  80235d:	c1 e8 16             	shr    $0x16,%eax
+  802360:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802367:	a8 01                	test   $0x1,%al
+  802369:	74 11                	je     80237c <dup+0x71>
+  80236b:	89 d8                	mov    %ebx,%eax
+  80236d:	c1 e8 0c             	shr    $0xc,%eax
+  802370:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802377:	f6 c2 01             	test   $0x1,%dl
+  80237a:	75 36                	jne    8023b2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80237c:	89 f8                	mov    %edi,%eax
+  80237e:	c1 e8 0c             	shr    $0xc,%eax
+  802381:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802388:	83 ec 0c             	sub    $0xc,%esp
+  80238b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802390:	50                   	push   %eax
+  802391:	56                   	push   %esi
+  802392:	6a 00                	push   $0x0
+  802394:	57                   	push   %edi
+  802395:	6a 00                	push   $0x0
+  802397:	e8 45 ec ff ff       	call   800fe1 <sys_page_map>
+  80239c:	89 c3                	mov    %eax,%ebx
+  80239e:	83 c4 20             	add    $0x20,%esp
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 33                	js     8023d8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8023a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8023a8:	89 d8                	mov    %ebx,%eax
+  8023aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ad:	5b                   	pop    %ebx
+  8023ae:	5e                   	pop    %esi
+  8023af:	5f                   	pop    %edi
+  8023b0:	5d                   	pop    %ebp
+  8023b1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8023b2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8023b9:	83 ec 0c             	sub    $0xc,%esp
+  8023bc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023c1:	50                   	push   %eax
+  8023c2:	ff 75 d4             	push   -0x2c(%ebp)
+  8023c5:	6a 00                	push   $0x0
+  8023c7:	53                   	push   %ebx
+  8023c8:	6a 00                	push   $0x0
+  8023ca:	e8 12 ec ff ff       	call   800fe1 <sys_page_map>
+  8023cf:	89 c3                	mov    %eax,%ebx
+  8023d1:	83 c4 20             	add    $0x20,%esp
+  8023d4:	85 c0                	test   %eax,%eax
+  8023d6:	79 a4                	jns    80237c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8023d8:	83 ec 08             	sub    $0x8,%esp
+  8023db:	56                   	push   %esi
+  8023dc:	6a 00                	push   $0x0
+  8023de:	e8 6c ec ff ff       	call   80104f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8023e3:	83 c4 08             	add    $0x8,%esp
+  8023e6:	ff 75 d4             	push   -0x2c(%ebp)
+  8023e9:	6a 00                	push   $0x0
+  8023eb:	e8 5f ec ff ff       	call   80104f <sys_page_unmap>
+	return r;
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	eb b3                	jmp    8023a8 <dup+0x9d>
+
+008023f5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8023f5:	55                   	push   %ebp
+  8023f6:	89 e5                	mov    %esp,%ebp
+  8023f8:	56                   	push   %esi
+  8023f9:	53                   	push   %ebx
+  8023fa:	83 ec 18             	sub    $0x18,%esp
+  8023fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802400:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802403:	50                   	push   %eax
+  802404:	53                   	push   %ebx
+  802405:	e8 65 fd ff ff       	call   80216f <fd_lookup>
+  80240a:	83 c4 10             	add    $0x10,%esp
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 3c                	js     80244d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802411:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802414:	83 ec 08             	sub    $0x8,%esp
+  802417:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80241a:	50                   	push   %eax
+  80241b:	ff 36                	push   (%esi)
+  80241d:	e8 9d fd ff ff       	call   8021bf <dev_lookup>
+  802422:	83 c4 10             	add    $0x10,%esp
+  802425:	85 c0                	test   %eax,%eax
+  802427:	78 24                	js     80244d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802429:	8b 46 08             	mov    0x8(%esi),%eax
+  80242c:	83 e0 03             	and    $0x3,%eax
+  80242f:	83 f8 01             	cmp    $0x1,%eax
+  802432:	74 20                	je     802454 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802434:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802437:	8b 40 08             	mov    0x8(%eax),%eax
+  80243a:	85 c0                	test   %eax,%eax
+  80243c:	74 57                	je     802495 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80243e:	83 ec 04             	sub    $0x4,%esp
+  802441:	ff 75 10             	push   0x10(%ebp)
+  802444:	ff 75 0c             	push   0xc(%ebp)
+  802447:	56                   	push   %esi
+  802448:	ff d0                	call   *%eax
+  80244a:	83 c4 10             	add    $0x10,%esp
+}
+  80244d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802450:	5b                   	pop    %ebx
+  802451:	5e                   	pop    %esi
+  802452:	5d                   	pop    %ebp
+  802453:	c3                   	ret
+  802454:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802456:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80245b:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802461:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802466:	76 1c                	jbe    802484 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802468:	8b 42 48             	mov    0x48(%edx),%eax
+  80246b:	83 ec 04             	sub    $0x4,%esp
+  80246e:	53                   	push   %ebx
+  80246f:	50                   	push   %eax
+  802470:	68 11 3b 80 00       	push   $0x803b11
+  802475:	e8 ba df ff ff       	call   800434 <cprintf>
+		return -E_INVAL;
+  80247a:	83 c4 10             	add    $0x10,%esp
+  80247d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802482:	eb c9                	jmp    80244d <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802484:	c1 e8 10             	shr    $0x10,%eax
+  802487:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80248d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802493:	eb d3                	jmp    802468 <read+0x73>
+		return -E_NOT_SUPP;
+  802495:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80249a:	eb b1                	jmp    80244d <read+0x58>
+
+0080249c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80249c:	55                   	push   %ebp
+  80249d:	89 e5                	mov    %esp,%ebp
+  80249f:	57                   	push   %edi
+  8024a0:	56                   	push   %esi
+  8024a1:	53                   	push   %ebx
+  8024a2:	83 ec 0c             	sub    $0xc,%esp
+  8024a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024a8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8024ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b0:	eb 02                	jmp    8024b4 <readn+0x18>
+  8024b2:	01 c3                	add    %eax,%ebx
+  8024b4:	39 f3                	cmp    %esi,%ebx
+  8024b6:	73 21                	jae    8024d9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8024b8:	83 ec 04             	sub    $0x4,%esp
+  8024bb:	89 f0                	mov    %esi,%eax
+  8024bd:	29 d8                	sub    %ebx,%eax
+  8024bf:	50                   	push   %eax
+  8024c0:	89 d8                	mov    %ebx,%eax
+  8024c2:	03 45 0c             	add    0xc(%ebp),%eax
+  8024c5:	50                   	push   %eax
+  8024c6:	57                   	push   %edi
+  8024c7:	e8 29 ff ff ff       	call   8023f5 <read>
+		if (m < 0)
+  8024cc:	83 c4 10             	add    $0x10,%esp
+  8024cf:	85 c0                	test   %eax,%eax
+  8024d1:	78 04                	js     8024d7 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8024d3:	75 dd                	jne    8024b2 <readn+0x16>
+  8024d5:	eb 02                	jmp    8024d9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8024d7:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8024d9:	89 d8                	mov    %ebx,%eax
+  8024db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024de:	5b                   	pop    %ebx
+  8024df:	5e                   	pop    %esi
+  8024e0:	5f                   	pop    %edi
+  8024e1:	5d                   	pop    %ebp
+  8024e2:	c3                   	ret
+
+008024e3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8024e3:	55                   	push   %ebp
+  8024e4:	89 e5                	mov    %esp,%ebp
+  8024e6:	56                   	push   %esi
+  8024e7:	53                   	push   %ebx
+  8024e8:	83 ec 18             	sub    $0x18,%esp
+  8024eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024f1:	50                   	push   %eax
+  8024f2:	53                   	push   %ebx
+  8024f3:	e8 77 fc ff ff       	call   80216f <fd_lookup>
+  8024f8:	83 c4 10             	add    $0x10,%esp
+  8024fb:	85 c0                	test   %eax,%eax
+  8024fd:	78 37                	js     802536 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024ff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802502:	83 ec 08             	sub    $0x8,%esp
+  802505:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802508:	50                   	push   %eax
+  802509:	ff 36                	push   (%esi)
+  80250b:	e8 af fc ff ff       	call   8021bf <dev_lookup>
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	85 c0                	test   %eax,%eax
+  802515:	78 1f                	js     802536 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802517:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80251b:	74 20                	je     80253d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80251d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802520:	8b 40 0c             	mov    0xc(%eax),%eax
+  802523:	85 c0                	test   %eax,%eax
+  802525:	74 57                	je     80257e <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802527:	83 ec 04             	sub    $0x4,%esp
+  80252a:	ff 75 10             	push   0x10(%ebp)
+  80252d:	ff 75 0c             	push   0xc(%ebp)
+  802530:	56                   	push   %esi
+  802531:	ff d0                	call   *%eax
+  802533:	83 c4 10             	add    $0x10,%esp
+}
+  802536:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802539:	5b                   	pop    %ebx
+  80253a:	5e                   	pop    %esi
+  80253b:	5d                   	pop    %ebp
+  80253c:	c3                   	ret
+  80253d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80253f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802544:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80254a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80254f:	76 1c                	jbe    80256d <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802551:	8b 42 48             	mov    0x48(%edx),%eax
+  802554:	83 ec 04             	sub    $0x4,%esp
+  802557:	53                   	push   %ebx
+  802558:	50                   	push   %eax
+  802559:	68 2d 3b 80 00       	push   $0x803b2d
+  80255e:	e8 d1 de ff ff       	call   800434 <cprintf>
+		return -E_INVAL;
+  802563:	83 c4 10             	add    $0x10,%esp
+  802566:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80256b:	eb c9                	jmp    802536 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80256d:	c1 e8 10             	shr    $0x10,%eax
+  802570:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802576:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80257c:	eb d3                	jmp    802551 <write+0x6e>
+		return -E_NOT_SUPP;
+  80257e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802583:	eb b1                	jmp    802536 <write+0x53>
+
+00802585 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80258b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80258e:	50                   	push   %eax
+  80258f:	ff 75 08             	push   0x8(%ebp)
+  802592:	e8 d8 fb ff ff       	call   80216f <fd_lookup>
+  802597:	83 c4 10             	add    $0x10,%esp
+  80259a:	85 c0                	test   %eax,%eax
+  80259c:	78 0e                	js     8025ac <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80259e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025a4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8025a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025ac:	c9                   	leave
+  8025ad:	c3                   	ret
+
+008025ae <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8025ae:	55                   	push   %ebp
+  8025af:	89 e5                	mov    %esp,%ebp
+  8025b1:	56                   	push   %esi
+  8025b2:	53                   	push   %ebx
+  8025b3:	83 ec 18             	sub    $0x18,%esp
+  8025b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025b9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025bc:	50                   	push   %eax
+  8025bd:	53                   	push   %ebx
+  8025be:	e8 ac fb ff ff       	call   80216f <fd_lookup>
+  8025c3:	83 c4 10             	add    $0x10,%esp
+  8025c6:	85 c0                	test   %eax,%eax
+  8025c8:	78 34                	js     8025fe <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025ca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025cd:	83 ec 08             	sub    $0x8,%esp
+  8025d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025d3:	50                   	push   %eax
+  8025d4:	ff 36                	push   (%esi)
+  8025d6:	e8 e4 fb ff ff       	call   8021bf <dev_lookup>
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 1c                	js     8025fe <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025e2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8025e6:	74 1d                	je     802605 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8025e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025eb:	8b 40 18             	mov    0x18(%eax),%eax
+  8025ee:	85 c0                	test   %eax,%eax
+  8025f0:	74 54                	je     802646 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8025f2:	83 ec 08             	sub    $0x8,%esp
+  8025f5:	ff 75 0c             	push   0xc(%ebp)
+  8025f8:	56                   	push   %esi
+  8025f9:	ff d0                	call   *%eax
+  8025fb:	83 c4 10             	add    $0x10,%esp
+}
+  8025fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802601:	5b                   	pop    %ebx
+  802602:	5e                   	pop    %esi
+  802603:	5d                   	pop    %ebp
+  802604:	c3                   	ret
+  802605:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802607:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80260c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802612:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802617:	76 1c                	jbe    802635 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802619:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80261c:	83 ec 04             	sub    $0x4,%esp
+  80261f:	53                   	push   %ebx
+  802620:	50                   	push   %eax
+  802621:	68 f0 3a 80 00       	push   $0x803af0
+  802626:	e8 09 de ff ff       	call   800434 <cprintf>
+		return -E_INVAL;
+  80262b:	83 c4 10             	add    $0x10,%esp
+  80262e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802633:	eb c9                	jmp    8025fe <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802635:	c1 e8 10             	shr    $0x10,%eax
+  802638:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80263e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802644:	eb d3                	jmp    802619 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802646:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80264b:	eb b1                	jmp    8025fe <ftruncate+0x50>
+
+0080264d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80264d:	55                   	push   %ebp
+  80264e:	89 e5                	mov    %esp,%ebp
+  802650:	56                   	push   %esi
+  802651:	53                   	push   %ebx
+  802652:	83 ec 18             	sub    $0x18,%esp
+  802655:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802658:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80265b:	50                   	push   %eax
+  80265c:	ff 75 08             	push   0x8(%ebp)
+  80265f:	e8 0b fb ff ff       	call   80216f <fd_lookup>
+  802664:	83 c4 10             	add    $0x10,%esp
+  802667:	85 c0                	test   %eax,%eax
+  802669:	78 49                	js     8026b4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80266b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80266e:	83 ec 08             	sub    $0x8,%esp
+  802671:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802674:	50                   	push   %eax
+  802675:	ff 36                	push   (%esi)
+  802677:	e8 43 fb ff ff       	call   8021bf <dev_lookup>
+  80267c:	83 c4 10             	add    $0x10,%esp
+  80267f:	85 c0                	test   %eax,%eax
+  802681:	78 31                	js     8026b4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802683:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802686:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80268a:	74 2f                	je     8026bb <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80268c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80268f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802696:	00 00 00 
+	stat->st_isdir = 0;
+  802699:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026a0:	00 00 00 
+	stat->st_dev = dev;
+  8026a3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8026a9:	83 ec 08             	sub    $0x8,%esp
+  8026ac:	53                   	push   %ebx
+  8026ad:	56                   	push   %esi
+  8026ae:	ff 50 14             	call   *0x14(%eax)
+  8026b1:	83 c4 10             	add    $0x10,%esp
+}
+  8026b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b7:	5b                   	pop    %ebx
+  8026b8:	5e                   	pop    %esi
+  8026b9:	5d                   	pop    %ebp
+  8026ba:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026c0:	eb f2                	jmp    8026b4 <fstat+0x67>
+
+008026c2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	56                   	push   %esi
+  8026c6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8026c7:	83 ec 08             	sub    $0x8,%esp
+  8026ca:	6a 00                	push   $0x0
+  8026cc:	ff 75 08             	push   0x8(%ebp)
+  8026cf:	e8 e4 01 00 00       	call   8028b8 <open>
+  8026d4:	89 c3                	mov    %eax,%ebx
+  8026d6:	83 c4 10             	add    $0x10,%esp
+  8026d9:	85 c0                	test   %eax,%eax
+  8026db:	78 1b                	js     8026f8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8026dd:	83 ec 08             	sub    $0x8,%esp
+  8026e0:	ff 75 0c             	push   0xc(%ebp)
+  8026e3:	50                   	push   %eax
+  8026e4:	e8 64 ff ff ff       	call   80264d <fstat>
+  8026e9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8026eb:	89 1c 24             	mov    %ebx,(%esp)
+  8026ee:	e8 c6 fb ff ff       	call   8022b9 <close>
+	return r;
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	89 f3                	mov    %esi,%ebx
+}
+  8026f8:	89 d8                	mov    %ebx,%eax
+  8026fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fd:	5b                   	pop    %ebx
+  8026fe:	5e                   	pop    %esi
+  8026ff:	5d                   	pop    %ebp
+  802700:	c3                   	ret
+
+00802701 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802701:	55                   	push   %ebp
+  802702:	89 e5                	mov    %esp,%ebp
+  802704:	56                   	push   %esi
+  802705:	53                   	push   %ebx
+  802706:	89 c6                	mov    %eax,%esi
+  802708:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80270a:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  802711:	74 27                	je     80273a <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802713:	6a 07                	push   $0x7
+  802715:	68 00 60 80 00       	push   $0x806000
+  80271a:	56                   	push   %esi
+  80271b:	ff 35 00 50 80 00    	push   0x805000
+  802721:	e8 93 0d 00 00       	call   8034b9 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802726:	83 c4 0c             	add    $0xc,%esp
+  802729:	6a 00                	push   $0x0
+  80272b:	53                   	push   %ebx
+  80272c:	6a 00                	push   $0x0
+  80272e:	e8 6e 0d 00 00       	call   8034a1 <ipc_recv>
+}
+  802733:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802736:	5b                   	pop    %ebx
+  802737:	5e                   	pop    %esi
+  802738:	5d                   	pop    %ebp
+  802739:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80273a:	83 ec 0c             	sub    $0xc,%esp
+  80273d:	6a 01                	push   $0x1
+  80273f:	e8 c9 0d 00 00       	call   80350d <ipc_find_env>
+  802744:	a3 00 50 80 00       	mov    %eax,0x805000
+  802749:	83 c4 10             	add    $0x10,%esp
+  80274c:	eb c5                	jmp    802713 <fsipc+0x12>
+
+0080274e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802754:	8b 45 08             	mov    0x8(%ebp),%eax
+  802757:	8b 40 0c             	mov    0xc(%eax),%eax
+  80275a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80275f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802762:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802767:	ba 00 00 00 00       	mov    $0x0,%edx
+  80276c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802771:	e8 8b ff ff ff       	call   802701 <fsipc>
+}
+  802776:	c9                   	leave
+  802777:	c3                   	ret
+
+00802778 <devfile_flush>:
+{
+  802778:	55                   	push   %ebp
+  802779:	89 e5                	mov    %esp,%ebp
+  80277b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80277e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802781:	8b 40 0c             	mov    0xc(%eax),%eax
+  802784:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802789:	ba 00 00 00 00       	mov    $0x0,%edx
+  80278e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802793:	e8 69 ff ff ff       	call   802701 <fsipc>
+}
+  802798:	c9                   	leave
+  802799:	c3                   	ret
+
+0080279a <devfile_stat>:
+{
+  80279a:	55                   	push   %ebp
+  80279b:	89 e5                	mov    %esp,%ebp
+  80279d:	53                   	push   %ebx
+  80279e:	83 ec 04             	sub    $0x4,%esp
+  8027a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027aa:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8027af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027b9:	e8 43 ff ff ff       	call   802701 <fsipc>
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	78 2c                	js     8027ee <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8027c2:	83 ec 08             	sub    $0x8,%esp
+  8027c5:	68 00 60 80 00       	push   $0x806000
+  8027ca:	53                   	push   %ebx
+  8027cb:	e8 ac e2 ff ff       	call   800a7c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8027d0:	a1 80 60 80 00       	mov    0x806080,%eax
+  8027d5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8027db:	a1 84 60 80 00       	mov    0x806084,%eax
+  8027e0:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8027e6:	83 c4 10             	add    $0x10,%esp
+  8027e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027f1:	c9                   	leave
+  8027f2:	c3                   	ret
+
+008027f3 <devfile_write>:
+{
+  8027f3:	55                   	push   %ebp
+  8027f4:	89 e5                	mov    %esp,%ebp
+  8027f6:	83 ec 0c             	sub    $0xc,%esp
+  8027f9:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027ff:	8b 52 0c             	mov    0xc(%edx),%edx
+  802802:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802808:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80280d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802812:	39 d0                	cmp    %edx,%eax
+  802814:	0f 47 c2             	cmova  %edx,%eax
+  802817:	50                   	push   %eax
+  802818:	ff 75 0c             	push   0xc(%ebp)
+  80281b:	68 08 60 80 00       	push   $0x806008
+  802820:	e8 dd e3 ff ff       	call   800c02 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802825:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80282f:	e8 cd fe ff ff       	call   802701 <fsipc>
+}
+  802834:	c9                   	leave
+  802835:	c3                   	ret
+
+00802836 <devfile_read>:
+{
+  802836:	55                   	push   %ebp
+  802837:	89 e5                	mov    %esp,%ebp
+  802839:	56                   	push   %esi
+  80283a:	53                   	push   %ebx
+  80283b:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80283e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802841:	8b 40 0c             	mov    0xc(%eax),%eax
+  802844:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802849:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80284f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802854:	b8 03 00 00 00       	mov    $0x3,%eax
+  802859:	e8 a3 fe ff ff       	call   802701 <fsipc>
+  80285e:	89 c3                	mov    %eax,%ebx
+  802860:	85 c0                	test   %eax,%eax
+  802862:	78 1f                	js     802883 <devfile_read+0x4d>
+	assert(r <= n);
+  802864:	39 c6                	cmp    %eax,%esi
+  802866:	72 24                	jb     80288c <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802868:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80286d:	7f 33                	jg     8028a2 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80286f:	83 ec 04             	sub    $0x4,%esp
+  802872:	50                   	push   %eax
+  802873:	68 00 60 80 00       	push   $0x806000
+  802878:	ff 75 0c             	push   0xc(%ebp)
+  80287b:	e8 82 e3 ff ff       	call   800c02 <memmove>
+	return r;
+  802880:	83 c4 10             	add    $0x10,%esp
+}
+  802883:	89 d8                	mov    %ebx,%eax
+  802885:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802888:	5b                   	pop    %ebx
+  802889:	5e                   	pop    %esi
+  80288a:	5d                   	pop    %ebp
+  80288b:	c3                   	ret
+	assert(r <= n);
+  80288c:	68 60 3b 80 00       	push   $0x803b60
+  802891:	68 50 3a 80 00       	push   $0x803a50
+  802896:	6a 76                	push   $0x76
+  802898:	68 67 3b 80 00       	push   $0x803b67
+  80289d:	e8 b7 da ff ff       	call   800359 <_panic>
+	assert(r <= PGSIZE);
+  8028a2:	68 72 3b 80 00       	push   $0x803b72
+  8028a7:	68 50 3a 80 00       	push   $0x803a50
+  8028ac:	6a 77                	push   $0x77
+  8028ae:	68 67 3b 80 00       	push   $0x803b67
+  8028b3:	e8 a1 da ff ff       	call   800359 <_panic>
+
+008028b8 <open>:
+{
+  8028b8:	55                   	push   %ebp
+  8028b9:	89 e5                	mov    %esp,%ebp
+  8028bb:	56                   	push   %esi
+  8028bc:	53                   	push   %ebx
+  8028bd:	83 ec 1c             	sub    $0x1c,%esp
+  8028c0:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8028c3:	56                   	push   %esi
+  8028c4:	e8 78 e1 ff ff       	call   800a41 <strlen>
+  8028c9:	83 c4 10             	add    $0x10,%esp
+  8028cc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028d1:	7f 6c                	jg     80293f <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8028d3:	83 ec 0c             	sub    $0xc,%esp
+  8028d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028d9:	50                   	push   %eax
+  8028da:	e8 3a f8 ff ff       	call   802119 <fd_alloc>
+  8028df:	89 c3                	mov    %eax,%ebx
+  8028e1:	83 c4 10             	add    $0x10,%esp
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	78 3c                	js     802924 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8028e8:	83 ec 08             	sub    $0x8,%esp
+  8028eb:	56                   	push   %esi
+  8028ec:	68 00 60 80 00       	push   $0x806000
+  8028f1:	e8 86 e1 ff ff       	call   800a7c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8028f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028f9:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8028fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802901:	b8 01 00 00 00       	mov    $0x1,%eax
+  802906:	e8 f6 fd ff ff       	call   802701 <fsipc>
+  80290b:	89 c3                	mov    %eax,%ebx
+  80290d:	83 c4 10             	add    $0x10,%esp
+  802910:	85 c0                	test   %eax,%eax
+  802912:	78 19                	js     80292d <open+0x75>
+	return fd2num(fd);
+  802914:	83 ec 0c             	sub    $0xc,%esp
+  802917:	ff 75 f4             	push   -0xc(%ebp)
+  80291a:	e8 d3 f7 ff ff       	call   8020f2 <fd2num>
+  80291f:	89 c3                	mov    %eax,%ebx
+  802921:	83 c4 10             	add    $0x10,%esp
+}
+  802924:	89 d8                	mov    %ebx,%eax
+  802926:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802929:	5b                   	pop    %ebx
+  80292a:	5e                   	pop    %esi
+  80292b:	5d                   	pop    %ebp
+  80292c:	c3                   	ret
+		fd_close(fd, 0);
+  80292d:	83 ec 08             	sub    $0x8,%esp
+  802930:	6a 00                	push   $0x0
+  802932:	ff 75 f4             	push   -0xc(%ebp)
+  802935:	e8 f8 f8 ff ff       	call   802232 <fd_close>
+		return r;
+  80293a:	83 c4 10             	add    $0x10,%esp
+  80293d:	eb e5                	jmp    802924 <open+0x6c>
+		return -E_BAD_PATH;
+  80293f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802944:	eb de                	jmp    802924 <open+0x6c>
+
+00802946 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802946:	55                   	push   %ebp
+  802947:	89 e5                	mov    %esp,%ebp
+  802949:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80294c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802951:	b8 08 00 00 00       	mov    $0x8,%eax
+  802956:	e8 a6 fd ff ff       	call   802701 <fsipc>
+}
+  80295b:	c9                   	leave
+  80295c:	c3                   	ret
+
+0080295d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80295d:	55                   	push   %ebp
+  80295e:	89 e5                	mov    %esp,%ebp
+  802960:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802963:	68 7e 3b 80 00       	push   $0x803b7e
+  802968:	ff 75 0c             	push   0xc(%ebp)
+  80296b:	e8 0c e1 ff ff       	call   800a7c <strcpy>
+	return 0;
+}
+  802970:	b8 00 00 00 00       	mov    $0x0,%eax
+  802975:	c9                   	leave
+  802976:	c3                   	ret
+
+00802977 <devsock_close>:
+{
+  802977:	55                   	push   %ebp
+  802978:	89 e5                	mov    %esp,%ebp
+  80297a:	53                   	push   %ebx
+  80297b:	83 ec 10             	sub    $0x10,%esp
+  80297e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802981:	53                   	push   %ebx
+  802982:	e8 c5 0b 00 00       	call   80354c <pageref>
+  802987:	89 c2                	mov    %eax,%edx
+  802989:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80298c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802991:	83 fa 01             	cmp    $0x1,%edx
+  802994:	74 05                	je     80299b <devsock_close+0x24>
+}
+  802996:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802999:	c9                   	leave
+  80299a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80299b:	83 ec 0c             	sub    $0xc,%esp
+  80299e:	ff 73 0c             	push   0xc(%ebx)
+  8029a1:	e8 b7 02 00 00       	call   802c5d <nsipc_close>
+  8029a6:	83 c4 10             	add    $0x10,%esp
+  8029a9:	eb eb                	jmp    802996 <devsock_close+0x1f>
+
+008029ab <devsock_write>:
+{
+  8029ab:	55                   	push   %ebp
+  8029ac:	89 e5                	mov    %esp,%ebp
+  8029ae:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8029b1:	6a 00                	push   $0x0
+  8029b3:	ff 75 10             	push   0x10(%ebp)
+  8029b6:	ff 75 0c             	push   0xc(%ebp)
+  8029b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029bc:	ff 70 0c             	push   0xc(%eax)
+  8029bf:	e8 79 03 00 00       	call   802d3d <nsipc_send>
+}
+  8029c4:	c9                   	leave
+  8029c5:	c3                   	ret
+
+008029c6 <devsock_read>:
+{
+  8029c6:	55                   	push   %ebp
+  8029c7:	89 e5                	mov    %esp,%ebp
+  8029c9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8029cc:	6a 00                	push   $0x0
+  8029ce:	ff 75 10             	push   0x10(%ebp)
+  8029d1:	ff 75 0c             	push   0xc(%ebp)
+  8029d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d7:	ff 70 0c             	push   0xc(%eax)
+  8029da:	e8 ef 02 00 00       	call   802cce <nsipc_recv>
+}
+  8029df:	c9                   	leave
+  8029e0:	c3                   	ret
+
+008029e1 <fd2sockid>:
+{
+  8029e1:	55                   	push   %ebp
+  8029e2:	89 e5                	mov    %esp,%ebp
+  8029e4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8029e7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029ea:	52                   	push   %edx
+  8029eb:	50                   	push   %eax
+  8029ec:	e8 7e f7 ff ff       	call   80216f <fd_lookup>
+  8029f1:	83 c4 10             	add    $0x10,%esp
+  8029f4:	85 c0                	test   %eax,%eax
+  8029f6:	78 10                	js     802a08 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8029f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029fb:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a01:	39 08                	cmp    %ecx,(%eax)
+  802a03:	75 05                	jne    802a0a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802a05:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802a08:	c9                   	leave
+  802a09:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a0a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a0f:	eb f7                	jmp    802a08 <fd2sockid+0x27>
+
+00802a11 <alloc_sockfd>:
+{
+  802a11:	55                   	push   %ebp
+  802a12:	89 e5                	mov    %esp,%ebp
+  802a14:	56                   	push   %esi
+  802a15:	53                   	push   %ebx
+  802a16:	83 ec 1c             	sub    $0x1c,%esp
+  802a19:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802a1b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a1e:	50                   	push   %eax
+  802a1f:	e8 f5 f6 ff ff       	call   802119 <fd_alloc>
+  802a24:	89 c3                	mov    %eax,%ebx
+  802a26:	83 c4 10             	add    $0x10,%esp
+  802a29:	85 c0                	test   %eax,%eax
+  802a2b:	78 43                	js     802a70 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802a2d:	83 ec 04             	sub    $0x4,%esp
+  802a30:	68 07 04 00 00       	push   $0x407
+  802a35:	ff 75 f4             	push   -0xc(%ebp)
+  802a38:	6a 00                	push   $0x0
+  802a3a:	e8 35 e5 ff ff       	call   800f74 <sys_page_alloc>
+  802a3f:	89 c3                	mov    %eax,%ebx
+  802a41:	83 c4 10             	add    $0x10,%esp
+  802a44:	85 c0                	test   %eax,%eax
+  802a46:	78 28                	js     802a70 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a4b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a51:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802a53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a56:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802a5d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802a60:	83 ec 0c             	sub    $0xc,%esp
+  802a63:	50                   	push   %eax
+  802a64:	e8 89 f6 ff ff       	call   8020f2 <fd2num>
+  802a69:	89 c3                	mov    %eax,%ebx
+  802a6b:	83 c4 10             	add    $0x10,%esp
+  802a6e:	eb 0c                	jmp    802a7c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a70:	83 ec 0c             	sub    $0xc,%esp
+  802a73:	56                   	push   %esi
+  802a74:	e8 e4 01 00 00       	call   802c5d <nsipc_close>
+		return r;
+  802a79:	83 c4 10             	add    $0x10,%esp
+}
+  802a7c:	89 d8                	mov    %ebx,%eax
+  802a7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a81:	5b                   	pop    %ebx
+  802a82:	5e                   	pop    %esi
+  802a83:	5d                   	pop    %ebp
+  802a84:	c3                   	ret
+
+00802a85 <accept>:
+{
+  802a85:	55                   	push   %ebp
+  802a86:	89 e5                	mov    %esp,%ebp
+  802a88:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8e:	e8 4e ff ff ff       	call   8029e1 <fd2sockid>
+  802a93:	85 c0                	test   %eax,%eax
+  802a95:	78 1b                	js     802ab2 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802a97:	83 ec 04             	sub    $0x4,%esp
+  802a9a:	ff 75 10             	push   0x10(%ebp)
+  802a9d:	ff 75 0c             	push   0xc(%ebp)
+  802aa0:	50                   	push   %eax
+  802aa1:	e8 0e 01 00 00       	call   802bb4 <nsipc_accept>
+  802aa6:	83 c4 10             	add    $0x10,%esp
+  802aa9:	85 c0                	test   %eax,%eax
+  802aab:	78 05                	js     802ab2 <accept+0x2d>
+	return alloc_sockfd(r);
+  802aad:	e8 5f ff ff ff       	call   802a11 <alloc_sockfd>
+}
+  802ab2:	c9                   	leave
+  802ab3:	c3                   	ret
+
+00802ab4 <bind>:
+{
+  802ab4:	55                   	push   %ebp
+  802ab5:	89 e5                	mov    %esp,%ebp
+  802ab7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802aba:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abd:	e8 1f ff ff ff       	call   8029e1 <fd2sockid>
+  802ac2:	85 c0                	test   %eax,%eax
+  802ac4:	78 12                	js     802ad8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802ac6:	83 ec 04             	sub    $0x4,%esp
+  802ac9:	ff 75 10             	push   0x10(%ebp)
+  802acc:	ff 75 0c             	push   0xc(%ebp)
+  802acf:	50                   	push   %eax
+  802ad0:	e8 31 01 00 00       	call   802c06 <nsipc_bind>
+  802ad5:	83 c4 10             	add    $0x10,%esp
+}
+  802ad8:	c9                   	leave
+  802ad9:	c3                   	ret
+
+00802ada <shutdown>:
+{
+  802ada:	55                   	push   %ebp
+  802adb:	89 e5                	mov    %esp,%ebp
+  802add:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae3:	e8 f9 fe ff ff       	call   8029e1 <fd2sockid>
+  802ae8:	85 c0                	test   %eax,%eax
+  802aea:	78 0f                	js     802afb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802aec:	83 ec 08             	sub    $0x8,%esp
+  802aef:	ff 75 0c             	push   0xc(%ebp)
+  802af2:	50                   	push   %eax
+  802af3:	e8 43 01 00 00       	call   802c3b <nsipc_shutdown>
+  802af8:	83 c4 10             	add    $0x10,%esp
+}
+  802afb:	c9                   	leave
+  802afc:	c3                   	ret
+
+00802afd <connect>:
+{
+  802afd:	55                   	push   %ebp
+  802afe:	89 e5                	mov    %esp,%ebp
+  802b00:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b06:	e8 d6 fe ff ff       	call   8029e1 <fd2sockid>
+  802b0b:	85 c0                	test   %eax,%eax
+  802b0d:	78 12                	js     802b21 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b0f:	83 ec 04             	sub    $0x4,%esp
+  802b12:	ff 75 10             	push   0x10(%ebp)
+  802b15:	ff 75 0c             	push   0xc(%ebp)
+  802b18:	50                   	push   %eax
+  802b19:	e8 59 01 00 00       	call   802c77 <nsipc_connect>
+  802b1e:	83 c4 10             	add    $0x10,%esp
+}
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+
+00802b23 <listen>:
+{
+  802b23:	55                   	push   %ebp
+  802b24:	89 e5                	mov    %esp,%ebp
+  802b26:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b2c:	e8 b0 fe ff ff       	call   8029e1 <fd2sockid>
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	78 0f                	js     802b44 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802b35:	83 ec 08             	sub    $0x8,%esp
+  802b38:	ff 75 0c             	push   0xc(%ebp)
+  802b3b:	50                   	push   %eax
+  802b3c:	e8 6b 01 00 00       	call   802cac <nsipc_listen>
+  802b41:	83 c4 10             	add    $0x10,%esp
+}
+  802b44:	c9                   	leave
+  802b45:	c3                   	ret
+
+00802b46 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802b46:	55                   	push   %ebp
+  802b47:	89 e5                	mov    %esp,%ebp
+  802b49:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802b4c:	ff 75 10             	push   0x10(%ebp)
+  802b4f:	ff 75 0c             	push   0xc(%ebp)
+  802b52:	ff 75 08             	push   0x8(%ebp)
+  802b55:	e8 41 02 00 00       	call   802d9b <nsipc_socket>
+  802b5a:	83 c4 10             	add    $0x10,%esp
+  802b5d:	85 c0                	test   %eax,%eax
+  802b5f:	78 05                	js     802b66 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b61:	e8 ab fe ff ff       	call   802a11 <alloc_sockfd>
+}
+  802b66:	c9                   	leave
+  802b67:	c3                   	ret
+
+00802b68 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b68:	55                   	push   %ebp
+  802b69:	89 e5                	mov    %esp,%ebp
+  802b6b:	53                   	push   %ebx
+  802b6c:	83 ec 04             	sub    $0x4,%esp
+  802b6f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b71:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802b78:	74 26                	je     802ba0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b7a:	6a 07                	push   $0x7
+  802b7c:	68 00 70 80 00       	push   $0x807000
+  802b81:	53                   	push   %ebx
+  802b82:	ff 35 04 50 80 00    	push   0x805004
+  802b88:	e8 2c 09 00 00       	call   8034b9 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b8d:	83 c4 0c             	add    $0xc,%esp
+  802b90:	6a 00                	push   $0x0
+  802b92:	6a 00                	push   $0x0
+  802b94:	6a 00                	push   $0x0
+  802b96:	e8 06 09 00 00       	call   8034a1 <ipc_recv>
+}
+  802b9b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b9e:	c9                   	leave
+  802b9f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ba0:	83 ec 0c             	sub    $0xc,%esp
+  802ba3:	6a 02                	push   $0x2
+  802ba5:	e8 63 09 00 00       	call   80350d <ipc_find_env>
+  802baa:	a3 04 50 80 00       	mov    %eax,0x805004
+  802baf:	83 c4 10             	add    $0x10,%esp
+  802bb2:	eb c6                	jmp    802b7a <nsipc+0x12>
+
+00802bb4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802bb4:	55                   	push   %ebp
+  802bb5:	89 e5                	mov    %esp,%ebp
+  802bb7:	56                   	push   %esi
+  802bb8:	53                   	push   %ebx
+  802bb9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbf:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802bc4:	8b 06                	mov    (%esi),%eax
+  802bc6:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802bcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bd0:	e8 93 ff ff ff       	call   802b68 <nsipc>
+  802bd5:	89 c3                	mov    %eax,%ebx
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	79 09                	jns    802be4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802bdb:	89 d8                	mov    %ebx,%eax
+  802bdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be0:	5b                   	pop    %ebx
+  802be1:	5e                   	pop    %esi
+  802be2:	5d                   	pop    %ebp
+  802be3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802be4:	83 ec 04             	sub    $0x4,%esp
+  802be7:	ff 35 10 70 80 00    	push   0x807010
+  802bed:	68 00 70 80 00       	push   $0x807000
+  802bf2:	ff 75 0c             	push   0xc(%ebp)
+  802bf5:	e8 08 e0 ff ff       	call   800c02 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802bfa:	a1 10 70 80 00       	mov    0x807010,%eax
+  802bff:	89 06                	mov    %eax,(%esi)
+  802c01:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c04:	eb d5                	jmp    802bdb <nsipc_accept+0x27>
+
+00802c06 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c06:	55                   	push   %ebp
+  802c07:	89 e5                	mov    %esp,%ebp
+  802c09:	53                   	push   %ebx
+  802c0a:	83 ec 08             	sub    $0x8,%esp
+  802c0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c10:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c13:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c18:	53                   	push   %ebx
+  802c19:	ff 75 0c             	push   0xc(%ebp)
+  802c1c:	68 04 70 80 00       	push   $0x807004
+  802c21:	e8 dc df ff ff       	call   800c02 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c26:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802c2c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c31:	e8 32 ff ff ff       	call   802b68 <nsipc>
+}
+  802c36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c39:	c9                   	leave
+  802c3a:	c3                   	ret
+
+00802c3b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c3b:	55                   	push   %ebp
+  802c3c:	89 e5                	mov    %esp,%ebp
+  802c3e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c44:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802c49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c4c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c51:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c56:	e8 0d ff ff ff       	call   802b68 <nsipc>
+}
+  802c5b:	c9                   	leave
+  802c5c:	c3                   	ret
+
+00802c5d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c5d:	55                   	push   %ebp
+  802c5e:	89 e5                	mov    %esp,%ebp
+  802c60:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c66:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802c6b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c70:	e8 f3 fe ff ff       	call   802b68 <nsipc>
+}
+  802c75:	c9                   	leave
+  802c76:	c3                   	ret
+
+00802c77 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c77:	55                   	push   %ebp
+  802c78:	89 e5                	mov    %esp,%ebp
+  802c7a:	53                   	push   %ebx
+  802c7b:	83 ec 08             	sub    $0x8,%esp
+  802c7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c84:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c89:	53                   	push   %ebx
+  802c8a:	ff 75 0c             	push   0xc(%ebp)
+  802c8d:	68 04 70 80 00       	push   $0x807004
+  802c92:	e8 6b df ff ff       	call   800c02 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c97:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802c9d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ca2:	e8 c1 fe ff ff       	call   802b68 <nsipc>
+}
+  802ca7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802caa:	c9                   	leave
+  802cab:	c3                   	ret
+
+00802cac <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802cac:	55                   	push   %ebp
+  802cad:	89 e5                	mov    %esp,%ebp
+  802caf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802cb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802cba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cbd:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802cc2:	b8 06 00 00 00       	mov    $0x6,%eax
+  802cc7:	e8 9c fe ff ff       	call   802b68 <nsipc>
+}
+  802ccc:	c9                   	leave
+  802ccd:	c3                   	ret
+
+00802cce <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802cce:	55                   	push   %ebp
+  802ccf:	89 e5                	mov    %esp,%ebp
+  802cd1:	56                   	push   %esi
+  802cd2:	53                   	push   %ebx
+  802cd3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802cde:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802ce4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ce7:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802cec:	b8 07 00 00 00       	mov    $0x7,%eax
+  802cf1:	e8 72 fe ff ff       	call   802b68 <nsipc>
+  802cf6:	89 c3                	mov    %eax,%ebx
+  802cf8:	85 c0                	test   %eax,%eax
+  802cfa:	78 22                	js     802d1e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802cfc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d01:	39 c6                	cmp    %eax,%esi
+  802d03:	0f 4e c6             	cmovle %esi,%eax
+  802d06:	39 c3                	cmp    %eax,%ebx
+  802d08:	7f 1d                	jg     802d27 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d0a:	83 ec 04             	sub    $0x4,%esp
+  802d0d:	53                   	push   %ebx
+  802d0e:	68 00 70 80 00       	push   $0x807000
+  802d13:	ff 75 0c             	push   0xc(%ebp)
+  802d16:	e8 e7 de ff ff       	call   800c02 <memmove>
+  802d1b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d1e:	89 d8                	mov    %ebx,%eax
+  802d20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d23:	5b                   	pop    %ebx
+  802d24:	5e                   	pop    %esi
+  802d25:	5d                   	pop    %ebp
+  802d26:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d27:	68 8a 3b 80 00       	push   $0x803b8a
+  802d2c:	68 50 3a 80 00       	push   $0x803a50
+  802d31:	6a 62                	push   $0x62
+  802d33:	68 9f 3b 80 00       	push   $0x803b9f
+  802d38:	e8 1c d6 ff ff       	call   800359 <_panic>
+
+00802d3d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d3d:	55                   	push   %ebp
+  802d3e:	89 e5                	mov    %esp,%ebp
+  802d40:	53                   	push   %ebx
+  802d41:	83 ec 04             	sub    $0x4,%esp
+  802d44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d47:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4a:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802d4f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d55:	7f 2e                	jg     802d85 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d57:	83 ec 04             	sub    $0x4,%esp
+  802d5a:	53                   	push   %ebx
+  802d5b:	ff 75 0c             	push   0xc(%ebp)
+  802d5e:	68 0c 70 80 00       	push   $0x80700c
+  802d63:	e8 9a de ff ff       	call   800c02 <memmove>
+	nsipcbuf.send.req_size = size;
+  802d68:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802d6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d71:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802d76:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d7b:	e8 e8 fd ff ff       	call   802b68 <nsipc>
+}
+  802d80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d83:	c9                   	leave
+  802d84:	c3                   	ret
+	assert(size < 1600);
+  802d85:	68 ab 3b 80 00       	push   $0x803bab
+  802d8a:	68 50 3a 80 00       	push   $0x803a50
+  802d8f:	6a 6d                	push   $0x6d
+  802d91:	68 9f 3b 80 00       	push   $0x803b9f
+  802d96:	e8 be d5 ff ff       	call   800359 <_panic>
+
+00802d9b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d9b:	55                   	push   %ebp
+  802d9c:	89 e5                	mov    %esp,%ebp
+  802d9e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802da1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802da9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dac:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802db1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802db4:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802db9:	b8 09 00 00 00       	mov    $0x9,%eax
+  802dbe:	e8 a5 fd ff ff       	call   802b68 <nsipc>
+}
+  802dc3:	c9                   	leave
+  802dc4:	c3                   	ret
+
+00802dc5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802dc5:	55                   	push   %ebp
+  802dc6:	89 e5                	mov    %esp,%ebp
+  802dc8:	56                   	push   %esi
+  802dc9:	53                   	push   %ebx
+  802dca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802dcd:	83 ec 0c             	sub    $0xc,%esp
+  802dd0:	ff 75 08             	push   0x8(%ebp)
+  802dd3:	e8 2a f3 ff ff       	call   802102 <fd2data>
+  802dd8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802dda:	83 c4 08             	add    $0x8,%esp
+  802ddd:	68 b7 3b 80 00       	push   $0x803bb7
+  802de2:	53                   	push   %ebx
+  802de3:	e8 94 dc ff ff       	call   800a7c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802de8:	8b 46 04             	mov    0x4(%esi),%eax
+  802deb:	2b 06                	sub    (%esi),%eax
+  802ded:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802df3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802dfa:	00 00 00 
+	stat->st_dev = &devpipe;
+  802dfd:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802e04:	40 80 00 
+	return 0;
+}
+  802e07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e0f:	5b                   	pop    %ebx
+  802e10:	5e                   	pop    %esi
+  802e11:	5d                   	pop    %ebp
+  802e12:	c3                   	ret
+
+00802e13 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e13:	55                   	push   %ebp
+  802e14:	89 e5                	mov    %esp,%ebp
+  802e16:	53                   	push   %ebx
+  802e17:	83 ec 0c             	sub    $0xc,%esp
+  802e1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e1d:	53                   	push   %ebx
+  802e1e:	6a 00                	push   $0x0
+  802e20:	e8 2a e2 ff ff       	call   80104f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e25:	89 1c 24             	mov    %ebx,(%esp)
+  802e28:	e8 d5 f2 ff ff       	call   802102 <fd2data>
+  802e2d:	83 c4 08             	add    $0x8,%esp
+  802e30:	50                   	push   %eax
+  802e31:	6a 00                	push   $0x0
+  802e33:	e8 17 e2 ff ff       	call   80104f <sys_page_unmap>
+}
+  802e38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e3b:	c9                   	leave
+  802e3c:	c3                   	ret
+
+00802e3d <_pipeisclosed>:
+{
+  802e3d:	55                   	push   %ebp
+  802e3e:	89 e5                	mov    %esp,%ebp
+  802e40:	57                   	push   %edi
+  802e41:	56                   	push   %esi
+  802e42:	53                   	push   %ebx
+  802e43:	83 ec 1c             	sub    $0x1c,%esp
+  802e46:	89 c7                	mov    %eax,%edi
+  802e48:	89 d6                	mov    %edx,%esi
+  802e4a:	eb 3c                	jmp    802e88 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802e4c:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e4f:	83 ec 0c             	sub    $0xc,%esp
+  802e52:	57                   	push   %edi
+  802e53:	e8 f4 06 00 00       	call   80354c <pageref>
+  802e58:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e5b:	89 34 24             	mov    %esi,(%esp)
+  802e5e:	e8 e9 06 00 00       	call   80354c <pageref>
+  802e63:	89 c2                	mov    %eax,%edx
+  802e65:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e67:	05 00 00 00 20       	add    $0x20000000,%eax
+  802e6c:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802e6f:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e75:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e7a:	76 31                	jbe    802ead <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802e7c:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802e7f:	39 c3                	cmp    %eax,%ebx
+  802e81:	74 76                	je     802ef9 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802e83:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802e86:	74 36                	je     802ebe <_pipeisclosed+0x81>
+  802e88:	89 e0                	mov    %esp,%eax
+  802e8a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e8f:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e95:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e9a:	77 b0                	ja     802e4c <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e9c:	c1 e8 10             	shr    $0x10,%eax
+  802e9f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ea5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802eab:	eb 9f                	jmp    802e4c <_pipeisclosed+0xf>
+  802ead:	c1 e8 10             	shr    $0x10,%eax
+  802eb0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802eb6:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802ebc:	eb be                	jmp    802e7c <_pipeisclosed+0x3f>
+  802ebe:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ec0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ec5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ecb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ed0:	76 16                	jbe    802ee8 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ed2:	8b 42 58             	mov    0x58(%edx),%eax
+  802ed5:	6a 01                	push   $0x1
+  802ed7:	50                   	push   %eax
+  802ed8:	53                   	push   %ebx
+  802ed9:	68 be 3b 80 00       	push   $0x803bbe
+  802ede:	e8 51 d5 ff ff       	call   800434 <cprintf>
+  802ee3:	83 c4 10             	add    $0x10,%esp
+  802ee6:	eb a0                	jmp    802e88 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ee8:	c1 e8 10             	shr    $0x10,%eax
+  802eeb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ef1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ef7:	eb d9                	jmp    802ed2 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802ef9:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802efc:	0f 94 c0             	sete   %al
+  802eff:	0f b6 c0             	movzbl %al,%eax
+}
+  802f02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f05:	5b                   	pop    %ebx
+  802f06:	5e                   	pop    %esi
+  802f07:	5f                   	pop    %edi
+  802f08:	5d                   	pop    %ebp
+  802f09:	c3                   	ret
+
+00802f0a <devpipe_write>:
+{
+  802f0a:	55                   	push   %ebp
+  802f0b:	89 e5                	mov    %esp,%ebp
+  802f0d:	57                   	push   %edi
+  802f0e:	56                   	push   %esi
+  802f0f:	53                   	push   %ebx
+  802f10:	83 ec 28             	sub    $0x28,%esp
+  802f13:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802f16:	56                   	push   %esi
+  802f17:	e8 e6 f1 ff ff       	call   802102 <fd2data>
+  802f1c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f1e:	83 c4 10             	add    $0x10,%esp
+  802f21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f26:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802f29:	75 09                	jne    802f34 <devpipe_write+0x2a>
+	return i;
+  802f2b:	89 f8                	mov    %edi,%eax
+  802f2d:	eb 23                	jmp    802f52 <devpipe_write+0x48>
+			sys_yield();
+  802f2f:	e8 fa df ff ff       	call   800f2e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f34:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f37:	8b 0b                	mov    (%ebx),%ecx
+  802f39:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f3c:	39 d0                	cmp    %edx,%eax
+  802f3e:	72 1a                	jb     802f5a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802f40:	89 da                	mov    %ebx,%edx
+  802f42:	89 f0                	mov    %esi,%eax
+  802f44:	e8 f4 fe ff ff       	call   802e3d <_pipeisclosed>
+  802f49:	85 c0                	test   %eax,%eax
+  802f4b:	74 e2                	je     802f2f <devpipe_write+0x25>
+				return 0;
+  802f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f55:	5b                   	pop    %ebx
+  802f56:	5e                   	pop    %esi
+  802f57:	5f                   	pop    %edi
+  802f58:	5d                   	pop    %ebp
+  802f59:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f5d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f61:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f64:	89 c2                	mov    %eax,%edx
+  802f66:	c1 fa 1f             	sar    $0x1f,%edx
+  802f69:	89 d1                	mov    %edx,%ecx
+  802f6b:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f6e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f71:	83 e2 1f             	and    $0x1f,%edx
+  802f74:	29 ca                	sub    %ecx,%edx
+  802f76:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f7a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802f7e:	83 c0 01             	add    $0x1,%eax
+  802f81:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802f84:	83 c7 01             	add    $0x1,%edi
+  802f87:	eb 9d                	jmp    802f26 <devpipe_write+0x1c>
+
+00802f89 <devpipe_read>:
+{
+  802f89:	55                   	push   %ebp
+  802f8a:	89 e5                	mov    %esp,%ebp
+  802f8c:	57                   	push   %edi
+  802f8d:	56                   	push   %esi
+  802f8e:	53                   	push   %ebx
+  802f8f:	83 ec 18             	sub    $0x18,%esp
+  802f92:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802f95:	57                   	push   %edi
+  802f96:	e8 67 f1 ff ff       	call   802102 <fd2data>
+  802f9b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f9d:	83 c4 10             	add    $0x10,%esp
+  802fa0:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802fa8:	75 13                	jne    802fbd <devpipe_read+0x34>
+	return i;
+  802faa:	89 f0                	mov    %esi,%eax
+  802fac:	eb 02                	jmp    802fb0 <devpipe_read+0x27>
+				return i;
+  802fae:	89 f0                	mov    %esi,%eax
+}
+  802fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb3:	5b                   	pop    %ebx
+  802fb4:	5e                   	pop    %esi
+  802fb5:	5f                   	pop    %edi
+  802fb6:	5d                   	pop    %ebp
+  802fb7:	c3                   	ret
+			sys_yield();
+  802fb8:	e8 71 df ff ff       	call   800f2e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802fbd:	8b 03                	mov    (%ebx),%eax
+  802fbf:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fc2:	75 18                	jne    802fdc <devpipe_read+0x53>
+			if (i > 0)
+  802fc4:	85 f6                	test   %esi,%esi
+  802fc6:	75 e6                	jne    802fae <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802fc8:	89 da                	mov    %ebx,%edx
+  802fca:	89 f8                	mov    %edi,%eax
+  802fcc:	e8 6c fe ff ff       	call   802e3d <_pipeisclosed>
+  802fd1:	85 c0                	test   %eax,%eax
+  802fd3:	74 e3                	je     802fb8 <devpipe_read+0x2f>
+				return 0;
+  802fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fda:	eb d4                	jmp    802fb0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802fdc:	99                   	cltd
+  802fdd:	c1 ea 1b             	shr    $0x1b,%edx
+  802fe0:	01 d0                	add    %edx,%eax
+  802fe2:	83 e0 1f             	and    $0x1f,%eax
+  802fe5:	29 d0                	sub    %edx,%eax
+  802fe7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fef:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802ff2:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802ff5:	83 c6 01             	add    $0x1,%esi
+  802ff8:	eb ab                	jmp    802fa5 <devpipe_read+0x1c>
+
+00802ffa <pipe>:
+{
+  802ffa:	55                   	push   %ebp
+  802ffb:	89 e5                	mov    %esp,%ebp
+  802ffd:	56                   	push   %esi
+  802ffe:	53                   	push   %ebx
+  802fff:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803002:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803005:	50                   	push   %eax
+  803006:	e8 0e f1 ff ff       	call   802119 <fd_alloc>
+  80300b:	89 c3                	mov    %eax,%ebx
+  80300d:	83 c4 10             	add    $0x10,%esp
+  803010:	85 c0                	test   %eax,%eax
+  803012:	0f 88 23 01 00 00    	js     80313b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803018:	83 ec 04             	sub    $0x4,%esp
+  80301b:	68 07 04 00 00       	push   $0x407
+  803020:	ff 75 f4             	push   -0xc(%ebp)
+  803023:	6a 00                	push   $0x0
+  803025:	e8 4a df ff ff       	call   800f74 <sys_page_alloc>
+  80302a:	89 c3                	mov    %eax,%ebx
+  80302c:	83 c4 10             	add    $0x10,%esp
+  80302f:	85 c0                	test   %eax,%eax
+  803031:	0f 88 04 01 00 00    	js     80313b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803037:	83 ec 0c             	sub    $0xc,%esp
+  80303a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80303d:	50                   	push   %eax
+  80303e:	e8 d6 f0 ff ff       	call   802119 <fd_alloc>
+  803043:	89 c3                	mov    %eax,%ebx
+  803045:	83 c4 10             	add    $0x10,%esp
+  803048:	85 c0                	test   %eax,%eax
+  80304a:	0f 88 db 00 00 00    	js     80312b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803050:	83 ec 04             	sub    $0x4,%esp
+  803053:	68 07 04 00 00       	push   $0x407
+  803058:	ff 75 f0             	push   -0x10(%ebp)
+  80305b:	6a 00                	push   $0x0
+  80305d:	e8 12 df ff ff       	call   800f74 <sys_page_alloc>
+  803062:	89 c3                	mov    %eax,%ebx
+  803064:	83 c4 10             	add    $0x10,%esp
+  803067:	85 c0                	test   %eax,%eax
+  803069:	0f 88 bc 00 00 00    	js     80312b <pipe+0x131>
+	va = fd2data(fd0);
+  80306f:	83 ec 0c             	sub    $0xc,%esp
+  803072:	ff 75 f4             	push   -0xc(%ebp)
+  803075:	e8 88 f0 ff ff       	call   802102 <fd2data>
+  80307a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80307c:	83 c4 0c             	add    $0xc,%esp
+  80307f:	68 07 04 00 00       	push   $0x407
+  803084:	50                   	push   %eax
+  803085:	6a 00                	push   $0x0
+  803087:	e8 e8 de ff ff       	call   800f74 <sys_page_alloc>
+  80308c:	89 c3                	mov    %eax,%ebx
+  80308e:	83 c4 10             	add    $0x10,%esp
+  803091:	85 c0                	test   %eax,%eax
+  803093:	0f 88 82 00 00 00    	js     80311b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803099:	83 ec 0c             	sub    $0xc,%esp
+  80309c:	ff 75 f0             	push   -0x10(%ebp)
+  80309f:	e8 5e f0 ff ff       	call   802102 <fd2data>
+  8030a4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030ab:	50                   	push   %eax
+  8030ac:	6a 00                	push   $0x0
+  8030ae:	56                   	push   %esi
+  8030af:	6a 00                	push   $0x0
+  8030b1:	e8 2b df ff ff       	call   800fe1 <sys_page_map>
+  8030b6:	89 c3                	mov    %eax,%ebx
+  8030b8:	83 c4 20             	add    $0x20,%esp
+  8030bb:	85 c0                	test   %eax,%eax
+  8030bd:	78 4e                	js     80310d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8030bf:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8030c4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030c7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8030c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030cc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8030d3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8030d6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8030d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030db:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8030e2:	83 ec 0c             	sub    $0xc,%esp
+  8030e5:	ff 75 f4             	push   -0xc(%ebp)
+  8030e8:	e8 05 f0 ff ff       	call   8020f2 <fd2num>
+  8030ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030f0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8030f2:	83 c4 04             	add    $0x4,%esp
+  8030f5:	ff 75 f0             	push   -0x10(%ebp)
+  8030f8:	e8 f5 ef ff ff       	call   8020f2 <fd2num>
+  8030fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803100:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803103:	83 c4 10             	add    $0x10,%esp
+  803106:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80310b:	eb 2e                	jmp    80313b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80310d:	83 ec 08             	sub    $0x8,%esp
+  803110:	56                   	push   %esi
+  803111:	6a 00                	push   $0x0
+  803113:	e8 37 df ff ff       	call   80104f <sys_page_unmap>
+  803118:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80311b:	83 ec 08             	sub    $0x8,%esp
+  80311e:	ff 75 f0             	push   -0x10(%ebp)
+  803121:	6a 00                	push   $0x0
+  803123:	e8 27 df ff ff       	call   80104f <sys_page_unmap>
+  803128:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80312b:	83 ec 08             	sub    $0x8,%esp
+  80312e:	ff 75 f4             	push   -0xc(%ebp)
+  803131:	6a 00                	push   $0x0
+  803133:	e8 17 df ff ff       	call   80104f <sys_page_unmap>
+  803138:	83 c4 10             	add    $0x10,%esp
+}
+  80313b:	89 d8                	mov    %ebx,%eax
+  80313d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803140:	5b                   	pop    %ebx
+  803141:	5e                   	pop    %esi
+  803142:	5d                   	pop    %ebp
+  803143:	c3                   	ret
+
+00803144 <pipeisclosed>:
+{
+  803144:	55                   	push   %ebp
+  803145:	89 e5                	mov    %esp,%ebp
+  803147:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80314a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80314d:	50                   	push   %eax
+  80314e:	ff 75 08             	push   0x8(%ebp)
+  803151:	e8 19 f0 ff ff       	call   80216f <fd_lookup>
+  803156:	83 c4 10             	add    $0x10,%esp
+  803159:	85 c0                	test   %eax,%eax
+  80315b:	78 18                	js     803175 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80315d:	83 ec 0c             	sub    $0xc,%esp
+  803160:	ff 75 f4             	push   -0xc(%ebp)
+  803163:	e8 9a ef ff ff       	call   802102 <fd2data>
+  803168:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80316a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80316d:	e8 cb fc ff ff       	call   802e3d <_pipeisclosed>
+  803172:	83 c4 10             	add    $0x10,%esp
+}
+  803175:	c9                   	leave
+  803176:	c3                   	ret
+
+00803177 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803177:	55                   	push   %ebp
+  803178:	89 e5                	mov    %esp,%ebp
+  80317a:	56                   	push   %esi
+  80317b:	53                   	push   %ebx
+  80317c:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80317f:	85 f6                	test   %esi,%esi
+  803181:	74 16                	je     803199 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  803183:	89 f3                	mov    %esi,%ebx
+  803185:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80318b:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  803191:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803197:	eb 1b                	jmp    8031b4 <wait+0x3d>
+	assert(envid != 0);
+  803199:	68 d6 3b 80 00       	push   $0x803bd6
+  80319e:	68 50 3a 80 00       	push   $0x803a50
+  8031a3:	6a 09                	push   $0x9
+  8031a5:	68 e1 3b 80 00       	push   $0x803be1
+  8031aa:	e8 aa d1 ff ff       	call   800359 <_panic>
+		sys_yield();
+  8031af:	e8 7a dd ff ff       	call   800f2e <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8031b4:	8b 43 48             	mov    0x48(%ebx),%eax
+  8031b7:	39 f0                	cmp    %esi,%eax
+  8031b9:	75 07                	jne    8031c2 <wait+0x4b>
+  8031bb:	8b 43 54             	mov    0x54(%ebx),%eax
+  8031be:	85 c0                	test   %eax,%eax
+  8031c0:	75 ed                	jne    8031af <wait+0x38>
+}
+  8031c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031c5:	5b                   	pop    %ebx
+  8031c6:	5e                   	pop    %esi
+  8031c7:	5d                   	pop    %ebp
+  8031c8:	c3                   	ret
+
+008031c9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8031c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ce:	c3                   	ret
+
+008031cf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8031cf:	55                   	push   %ebp
+  8031d0:	89 e5                	mov    %esp,%ebp
+  8031d2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8031d5:	68 ec 3b 80 00       	push   $0x803bec
+  8031da:	ff 75 0c             	push   0xc(%ebp)
+  8031dd:	e8 9a d8 ff ff       	call   800a7c <strcpy>
+	return 0;
+}
+  8031e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e7:	c9                   	leave
+  8031e8:	c3                   	ret
+
+008031e9 <devcons_write>:
+{
+  8031e9:	55                   	push   %ebp
+  8031ea:	89 e5                	mov    %esp,%ebp
+  8031ec:	57                   	push   %edi
+  8031ed:	56                   	push   %esi
+  8031ee:	53                   	push   %ebx
+  8031ef:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8031f5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8031fa:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803200:	eb 2e                	jmp    803230 <devcons_write+0x47>
+		m = n - tot;
+  803202:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803205:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803207:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80320c:	39 c3                	cmp    %eax,%ebx
+  80320e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803211:	83 ec 04             	sub    $0x4,%esp
+  803214:	53                   	push   %ebx
+  803215:	89 f0                	mov    %esi,%eax
+  803217:	03 45 0c             	add    0xc(%ebp),%eax
+  80321a:	50                   	push   %eax
+  80321b:	57                   	push   %edi
+  80321c:	e8 e1 d9 ff ff       	call   800c02 <memmove>
+		sys_cputs(buf, m);
+  803221:	83 c4 08             	add    $0x8,%esp
+  803224:	53                   	push   %ebx
+  803225:	57                   	push   %edi
+  803226:	e8 ca db ff ff       	call   800df5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80322b:	01 de                	add    %ebx,%esi
+  80322d:	83 c4 10             	add    $0x10,%esp
+  803230:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803233:	72 cd                	jb     803202 <devcons_write+0x19>
+}
+  803235:	89 f0                	mov    %esi,%eax
+  803237:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80323a:	5b                   	pop    %ebx
+  80323b:	5e                   	pop    %esi
+  80323c:	5f                   	pop    %edi
+  80323d:	5d                   	pop    %ebp
+  80323e:	c3                   	ret
+
+0080323f <devcons_read>:
+{
+  80323f:	55                   	push   %ebp
+  803240:	89 e5                	mov    %esp,%ebp
+  803242:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80324e:	75 07                	jne    803257 <devcons_read+0x18>
+  803250:	eb 1f                	jmp    803271 <devcons_read+0x32>
+		sys_yield();
+  803252:	e8 d7 dc ff ff       	call   800f2e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803257:	e8 dd db ff ff       	call   800e39 <sys_cgetc>
+  80325c:	85 c0                	test   %eax,%eax
+  80325e:	74 f2                	je     803252 <devcons_read+0x13>
+	if (c < 0)
+  803260:	78 0f                	js     803271 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803262:	83 f8 04             	cmp    $0x4,%eax
+  803265:	74 0c                	je     803273 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803267:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80326a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80326c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803271:	c9                   	leave
+  803272:	c3                   	ret
+		return 0;
+  803273:	b8 00 00 00 00       	mov    $0x0,%eax
+  803278:	eb f7                	jmp    803271 <devcons_read+0x32>
+
+0080327a <cputchar>:
+{
+  80327a:	55                   	push   %ebp
+  80327b:	89 e5                	mov    %esp,%ebp
+  80327d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803280:	8b 45 08             	mov    0x8(%ebp),%eax
+  803283:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803286:	6a 01                	push   $0x1
+  803288:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80328b:	50                   	push   %eax
+  80328c:	e8 64 db ff ff       	call   800df5 <sys_cputs>
+}
+  803291:	83 c4 10             	add    $0x10,%esp
+  803294:	c9                   	leave
+  803295:	c3                   	ret
+
+00803296 <getchar>:
+{
+  803296:	55                   	push   %ebp
+  803297:	89 e5                	mov    %esp,%ebp
+  803299:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80329c:	6a 01                	push   $0x1
+  80329e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032a1:	50                   	push   %eax
+  8032a2:	6a 00                	push   $0x0
+  8032a4:	e8 4c f1 ff ff       	call   8023f5 <read>
+	if (r < 0)
+  8032a9:	83 c4 10             	add    $0x10,%esp
+  8032ac:	85 c0                	test   %eax,%eax
+  8032ae:	78 06                	js     8032b6 <getchar+0x20>
+	if (r < 1)
+  8032b0:	74 06                	je     8032b8 <getchar+0x22>
+	return c;
+  8032b2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8032b6:	c9                   	leave
+  8032b7:	c3                   	ret
+		return -E_EOF;
+  8032b8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8032bd:	eb f7                	jmp    8032b6 <getchar+0x20>
+
+008032bf <iscons>:
+{
+  8032bf:	55                   	push   %ebp
+  8032c0:	89 e5                	mov    %esp,%ebp
+  8032c2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032c8:	50                   	push   %eax
+  8032c9:	ff 75 08             	push   0x8(%ebp)
+  8032cc:	e8 9e ee ff ff       	call   80216f <fd_lookup>
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	85 c0                	test   %eax,%eax
+  8032d6:	78 11                	js     8032e9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8032d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032db:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8032e1:	39 10                	cmp    %edx,(%eax)
+  8032e3:	0f 94 c0             	sete   %al
+  8032e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8032e9:	c9                   	leave
+  8032ea:	c3                   	ret
+
+008032eb <opencons>:
+{
+  8032eb:	55                   	push   %ebp
+  8032ec:	89 e5                	mov    %esp,%ebp
+  8032ee:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8032f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032f4:	50                   	push   %eax
+  8032f5:	e8 1f ee ff ff       	call   802119 <fd_alloc>
+  8032fa:	83 c4 10             	add    $0x10,%esp
+  8032fd:	85 c0                	test   %eax,%eax
+  8032ff:	78 3a                	js     80333b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803301:	83 ec 04             	sub    $0x4,%esp
+  803304:	68 07 04 00 00       	push   $0x407
+  803309:	ff 75 f4             	push   -0xc(%ebp)
+  80330c:	6a 00                	push   $0x0
+  80330e:	e8 61 dc ff ff       	call   800f74 <sys_page_alloc>
+  803313:	83 c4 10             	add    $0x10,%esp
+  803316:	85 c0                	test   %eax,%eax
+  803318:	78 21                	js     80333b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80331a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80331d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803323:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803325:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803328:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80332f:	83 ec 0c             	sub    $0xc,%esp
+  803332:	50                   	push   %eax
+  803333:	e8 ba ed ff ff       	call   8020f2 <fd2num>
+  803338:	83 c4 10             	add    $0x10,%esp
+}
+  80333b:	c9                   	leave
+  80333c:	c3                   	ret
+
+0080333d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80333d:	55                   	push   %ebp
+  80333e:	89 e5                	mov    %esp,%ebp
+  803340:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803343:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80334a:	74 0a                	je     803356 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80334c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80334f:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803354:	c9                   	leave
+  803355:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803356:	83 ec 04             	sub    $0x4,%esp
+  803359:	6a 07                	push   $0x7
+  80335b:	68 00 f0 bf ee       	push   $0xeebff000
+  803360:	6a 00                	push   $0x0
+  803362:	e8 0d dc ff ff       	call   800f74 <sys_page_alloc>
+  803367:	83 c4 10             	add    $0x10,%esp
+  80336a:	85 c0                	test   %eax,%eax
+  80336c:	78 14                	js     803382 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80336e:	83 ec 08             	sub    $0x8,%esp
+  803371:	68 a4 33 80 00       	push   $0x8033a4
+  803376:	6a 00                	push   $0x0
+  803378:	e8 13 de ff ff       	call   801190 <sys_env_set_pgfault_upcall>
+  80337d:	83 c4 10             	add    $0x10,%esp
+  803380:	eb ca                	jmp    80334c <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  803382:	83 ec 08             	sub    $0x8,%esp
+  803385:	50                   	push   %eax
+  803386:	68 f8 3b 80 00       	push   $0x803bf8
+  80338b:	e8 a4 d0 ff ff       	call   800434 <cprintf>
+			panic("set_pgfault_handler error");
+  803390:	83 c4 0c             	add    $0xc,%esp
+  803393:	68 03 3c 80 00       	push   $0x803c03
+  803398:	6a 24                	push   $0x24
+  80339a:	68 1d 3c 80 00       	push   $0x803c1d
+  80339f:	e8 b5 cf ff ff       	call   800359 <_panic>
+
+008033a4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8033a4:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8033a5:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8033aa:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8033ac:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8033af:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  8033b3:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  8033b6:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  8033ba:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  8033bc:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  8033c0:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8033c1:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  8033c5:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  8033c6:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  8033c7:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8033cb:	c3                   	ret
+
+008033cc <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  8033cc:	55                   	push   %ebp
+  8033cd:	89 e5                	mov    %esp,%ebp
+  8033cf:	56                   	push   %esi
+  8033d0:	53                   	push   %ebx
+  8033d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8033da:	85 c0                	test   %eax,%eax
+  8033dc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033e1:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8033e4:	83 ec 08             	sub    $0x8,%esp
+  8033e7:	ff 75 14             	push   0x14(%ebp)
+  8033ea:	50                   	push   %eax
+  8033eb:	e8 95 df ff ff       	call   801385 <sys_ipc_recv_until>
+  8033f0:	83 c4 10             	add    $0x10,%esp
+  8033f3:	85 c0                	test   %eax,%eax
+  8033f5:	78 61                	js     803458 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8033f7:	85 f6                	test   %esi,%esi
+  8033f9:	74 1c                	je     803417 <ipc_recv_until+0x4b>
+  8033fb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8033fd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803402:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803408:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80340d:	76 5f                	jbe    80346e <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  80340f:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803415:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803417:	85 db                	test   %ebx,%ebx
+  803419:	74 1c                	je     803437 <ipc_recv_until+0x6b>
+  80341b:	89 e0                	mov    %esp,%eax
+  80341d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803422:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803428:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80342d:	76 50                	jbe    80347f <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80342f:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803435:	89 03                	mov    %eax,(%ebx)
+  803437:	89 e0                	mov    %esp,%eax
+  803439:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80343e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803444:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803449:	76 45                	jbe    803490 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  80344b:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  803451:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803454:	5b                   	pop    %ebx
+  803455:	5e                   	pop    %esi
+  803456:	5d                   	pop    %ebp
+  803457:	c3                   	ret
+		if (from_env_store)
+  803458:	85 f6                	test   %esi,%esi
+  80345a:	74 06                	je     803462 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  80345c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  803462:	85 db                	test   %ebx,%ebx
+  803464:	74 eb                	je     803451 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803466:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80346c:	eb e3                	jmp    803451 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80346e:	c1 e8 10             	shr    $0x10,%eax
+  803471:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803477:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80347d:	eb 90                	jmp    80340f <ipc_recv_until+0x43>
+  80347f:	c1 e8 10             	shr    $0x10,%eax
+  803482:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803488:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80348e:	eb 9f                	jmp    80342f <ipc_recv_until+0x63>
+  803490:	c1 e8 10             	shr    $0x10,%eax
+  803493:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803499:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80349f:	eb aa                	jmp    80344b <ipc_recv_until+0x7f>
+
+008034a1 <ipc_recv>:
+{
+  8034a1:	55                   	push   %ebp
+  8034a2:	89 e5                	mov    %esp,%ebp
+  8034a4:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8034a7:	6a 00                	push   $0x0
+  8034a9:	ff 75 10             	push   0x10(%ebp)
+  8034ac:	ff 75 0c             	push   0xc(%ebp)
+  8034af:	ff 75 08             	push   0x8(%ebp)
+  8034b2:	e8 15 ff ff ff       	call   8033cc <ipc_recv_until>
+}
+  8034b7:	c9                   	leave
+  8034b8:	c3                   	ret
+
+008034b9 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8034b9:	55                   	push   %ebp
+  8034ba:	89 e5                	mov    %esp,%ebp
+  8034bc:	57                   	push   %edi
+  8034bd:	56                   	push   %esi
+  8034be:	53                   	push   %ebx
+  8034bf:	83 ec 0c             	sub    $0xc,%esp
+  8034c2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8034cb:	85 db                	test   %ebx,%ebx
+  8034cd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8034d2:	0f 44 d8             	cmove  %eax,%ebx
+  8034d5:	eb 05                	jmp    8034dc <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8034d7:	e8 52 da ff ff       	call   800f2e <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8034dc:	ff 75 14             	push   0x14(%ebp)
+  8034df:	53                   	push   %ebx
+  8034e0:	56                   	push   %esi
+  8034e1:	57                   	push   %edi
+  8034e2:	e8 ea dd ff ff       	call   8012d1 <sys_ipc_try_send>
+  8034e7:	83 c4 10             	add    $0x10,%esp
+  8034ea:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8034ed:	74 e8                	je     8034d7 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8034ef:	85 c0                	test   %eax,%eax
+  8034f1:	78 08                	js     8034fb <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8034f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034f6:	5b                   	pop    %ebx
+  8034f7:	5e                   	pop    %esi
+  8034f8:	5f                   	pop    %edi
+  8034f9:	5d                   	pop    %ebp
+  8034fa:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8034fb:	50                   	push   %eax
+  8034fc:	68 2b 3c 80 00       	push   $0x803c2b
+  803501:	6a 4f                	push   $0x4f
+  803503:	68 3e 3c 80 00       	push   $0x803c3e
+  803508:	e8 4c ce ff ff       	call   800359 <_panic>
+
+0080350d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80350d:	55                   	push   %ebp
+  80350e:	89 e5                	mov    %esp,%ebp
+  803510:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803513:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803518:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80351e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803524:	8b 52 50             	mov    0x50(%edx),%edx
+  803527:	39 ca                	cmp    %ecx,%edx
+  803529:	74 11                	je     80353c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80352b:	83 c0 01             	add    $0x1,%eax
+  80352e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803533:	75 e3                	jne    803518 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353a:	eb 0e                	jmp    80354a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80353c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803542:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803547:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80354a:	5d                   	pop    %ebp
+  80354b:	c3                   	ret
+
+0080354c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80354c:	55                   	push   %ebp
+  80354d:	89 e5                	mov    %esp,%ebp
+  80354f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803552:	89 c2                	mov    %eax,%edx
+  803554:	c1 ea 16             	shr    $0x16,%edx
+  803557:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80355e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803563:	f6 c1 01             	test   $0x1,%cl
+  803566:	74 1a                	je     803582 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803568:	c1 e8 0c             	shr    $0xc,%eax
+  80356b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803572:	a8 01                	test   $0x1,%al
+  803574:	74 0c                	je     803582 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803576:	c1 e8 0c             	shr    $0xc,%eax
+  803579:	c1 e0 04             	shl    $0x4,%eax
+  80357c:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803582:	89 d0                	mov    %edx,%eax
+  803584:	5d                   	pop    %ebp
+  803585:	c3                   	ret
@@ -0,0 +1,7131 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+	}
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	e8 f4 0c 00 00       	call   800d36 <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 a0 33 80 00       	push   $0x8033a0
+  80004c:	e8 31 02 00 00       	call   800282 <cprintf>
+
+	forkchild(cur, '0');
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+	forkchild(cur, '1');
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+}
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if (strlen(cur) >= DEPTH)
+  80007d:	53                   	push   %ebx
+  80007e:	e8 0c 08 00 00       	call   80088f <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+}
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 b1 33 80 00       	push   $0x8033b1
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 c9 07 00 00       	call   800875 <snprintf>
+	if (fork() == 0) {
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 f9 1b 00 00       	call   801cad <fork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+		forktree(nxt);
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+		exit();
+  8000c4:	e8 c4 00 00 00       	call   80018d <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+	forktree("");
+  8000d4:	68 b0 33 80 00       	push   $0x8033b0
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	57                   	push   %edi
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	83 ec 0c             	sub    $0xc,%esp
+  8000ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000f7:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000f9:	c1 ea 0b             	shr    $0xb,%edx
+  8000fc:	83 f2 01             	xor    $0x1,%edx
+  8000ff:	83 e2 01             	and    $0x1,%edx
+  800102:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800108:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80010f:	00 00 00 
+	envid = sys_getenvid();
+  800112:	e8 1f 0c 00 00       	call   800d36 <sys_getenvid>
+  800117:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800119:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80011e:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800124:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80012a:	8b 52 48             	mov    0x48(%edx),%edx
+  80012d:	39 ca                	cmp    %ecx,%edx
+  80012f:	74 27                	je     800158 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800131:	83 c0 01             	add    $0x1,%eax
+  800134:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800139:	75 e3                	jne    80011e <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80013b:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800142:	75 24                	jne    800168 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800144:	83 ec 04             	sub    $0x4,%esp
+  800147:	68 b8 33 80 00       	push   $0x8033b8
+  80014c:	6a 23                	push   $0x23
+  80014e:	68 db 33 80 00       	push   $0x8033db
+  800153:	e8 4f 00 00 00       	call   8001a7 <_panic>
+			mainenv = &envs[i];
+  800158:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80015e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800163:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800168:	85 ff                	test   %edi,%edi
+  80016a:	7e 07                	jle    800173 <libmain+0x90>
+		binaryname = argv[0];
+  80016c:	8b 06                	mov    (%esi),%eax
+  80016e:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800173:	83 ec 08             	sub    $0x8,%esp
+  800176:	56                   	push   %esi
+  800177:	57                   	push   %edi
+  800178:	e8 51 ff ff ff       	call   8000ce <umain>
+
+	// exit gracefully
+	exit();
+  80017d:	e8 0b 00 00 00       	call   80018d <exit>
+}
+  800182:	83 c4 10             	add    $0x10,%esp
+  800185:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800188:	5b                   	pop    %ebx
+  800189:	5e                   	pop    %esi
+  80018a:	5f                   	pop    %edi
+  80018b:	5d                   	pop    %ebp
+  80018c:	c3                   	ret
+
+0080018d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80018d:	55                   	push   %ebp
+  80018e:	89 e5                	mov    %esp,%ebp
+  800190:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800193:	e8 9c 1f 00 00       	call   802134 <close_all>
+	sys_env_destroy(0);
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	6a 00                	push   $0x0
+  80019d:	e8 2b 0b 00 00       	call   800ccd <sys_env_destroy>
+}
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	c9                   	leave
+  8001a6:	c3                   	ret
+
+008001a7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001a7:	55                   	push   %ebp
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	56                   	push   %esi
+  8001ab:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001ac:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001af:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001b5:	e8 7c 0b 00 00       	call   800d36 <sys_getenvid>
+  8001ba:	83 ec 0c             	sub    $0xc,%esp
+  8001bd:	ff 75 0c             	push   0xc(%ebp)
+  8001c0:	ff 75 08             	push   0x8(%ebp)
+  8001c3:	56                   	push   %esi
+  8001c4:	50                   	push   %eax
+  8001c5:	68 f4 33 80 00       	push   $0x8033f4
+  8001ca:	e8 b3 00 00 00       	call   800282 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001cf:	83 c4 18             	add    $0x18,%esp
+  8001d2:	53                   	push   %ebx
+  8001d3:	ff 75 10             	push   0x10(%ebp)
+  8001d6:	e8 56 00 00 00       	call   800231 <vcprintf>
+	cprintf("\n");
+  8001db:	c7 04 24 af 33 80 00 	movl   $0x8033af,(%esp)
+  8001e2:	e8 9b 00 00 00       	call   800282 <cprintf>
+  8001e7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001ea:	cc                   	int3
+	while (1)
+  8001eb:	eb fd                	jmp    8001ea <_panic+0x43>
+
+008001ed <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	53                   	push   %ebx
+  8001f1:	83 ec 04             	sub    $0x4,%esp
+  8001f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001f7:	8b 13                	mov    (%ebx),%edx
+  8001f9:	8d 42 01             	lea    0x1(%edx),%eax
+  8001fc:	89 03                	mov    %eax,(%ebx)
+  8001fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800201:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800205:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80020a:	74 09                	je     800215 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80020c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800210:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800213:	c9                   	leave
+  800214:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800215:	83 ec 08             	sub    $0x8,%esp
+  800218:	68 ff 00 00 00       	push   $0xff
+  80021d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800220:	50                   	push   %eax
+  800221:	e8 1d 0a 00 00       	call   800c43 <sys_cputs>
+		b->idx = 0;
+  800226:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	eb db                	jmp    80020c <putch+0x1f>
+
+00800231 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80023a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800241:	00 00 00 
+	b.cnt = 0;
+  800244:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80024b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80024e:	ff 75 0c             	push   0xc(%ebp)
+  800251:	ff 75 08             	push   0x8(%ebp)
+  800254:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80025a:	50                   	push   %eax
+  80025b:	68 ed 01 80 00       	push   $0x8001ed
+  800260:	e8 fb 00 00 00       	call   800360 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800265:	83 c4 08             	add    $0x8,%esp
+  800268:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80026e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800274:	50                   	push   %eax
+  800275:	e8 c9 09 00 00       	call   800c43 <sys_cputs>
+
+	return b.cnt;
+}
+  80027a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800280:	c9                   	leave
+  800281:	c3                   	ret
+
+00800282 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800282:	55                   	push   %ebp
+  800283:	89 e5                	mov    %esp,%ebp
+  800285:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800288:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80028b:	50                   	push   %eax
+  80028c:	ff 75 08             	push   0x8(%ebp)
+  80028f:	e8 9d ff ff ff       	call   800231 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800294:	c9                   	leave
+  800295:	c3                   	ret
+
+00800296 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800296:	55                   	push   %ebp
+  800297:	89 e5                	mov    %esp,%ebp
+  800299:	57                   	push   %edi
+  80029a:	56                   	push   %esi
+  80029b:	53                   	push   %ebx
+  80029c:	83 ec 1c             	sub    $0x1c,%esp
+  80029f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a2:	89 d6                	mov    %edx,%esi
+  8002a4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002aa:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002ad:	73 0b                	jae    8002ba <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002b2:	c1 e7 08             	shl    $0x8,%edi
+  8002b5:	0b 7d 10             	or     0x10(%ebp),%edi
+  8002b8:	eb 36                	jmp    8002f0 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8002ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c2:	f7 75 08             	divl   0x8(%ebp)
+  8002c5:	89 c1                	mov    %eax,%ecx
+  8002c7:	ff 75 14             	push   0x14(%ebp)
+  8002ca:	ff 75 10             	push   0x10(%ebp)
+  8002cd:	83 eb 01             	sub    $0x1,%ebx
+  8002d0:	53                   	push   %ebx
+  8002d1:	ff 75 08             	push   0x8(%ebp)
+  8002d4:	89 f2                	mov    %esi,%edx
+  8002d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002d9:	e8 b8 ff ff ff       	call   800296 <printnum>
+  8002de:	83 c4 10             	add    $0x10,%esp
+  8002e1:	eb 14                	jmp    8002f7 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002e3:	83 ec 08             	sub    $0x8,%esp
+  8002e6:	56                   	push   %esi
+  8002e7:	57                   	push   %edi
+  8002e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002eb:	ff d0                	call   *%eax
+  8002ed:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002f0:	83 eb 01             	sub    $0x1,%ebx
+  8002f3:	85 db                	test   %ebx,%ebx
+  8002f5:	7f ec                	jg     8002e3 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002f7:	83 ec 08             	sub    $0x8,%esp
+  8002fa:	56                   	push   %esi
+  8002fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800303:	f7 75 08             	divl   0x8(%ebp)
+  800306:	0f be 92 17 34 80 00 	movsbl 0x803417(%edx),%edx
+  80030d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800310:	c1 e0 08             	shl    $0x8,%eax
+  800313:	09 d0                	or     %edx,%eax
+  800315:	50                   	push   %eax
+  800316:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800319:	ff d0                	call   *%eax
+}
+  80031b:	83 c4 10             	add    $0x10,%esp
+  80031e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800321:	5b                   	pop    %ebx
+  800322:	5e                   	pop    %esi
+  800323:	5f                   	pop    %edi
+  800324:	5d                   	pop    %ebp
+  800325:	c3                   	ret
+
+00800326 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800326:	55                   	push   %ebp
+  800327:	89 e5                	mov    %esp,%ebp
+  800329:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80032c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800330:	8b 10                	mov    (%eax),%edx
+  800332:	3b 50 04             	cmp    0x4(%eax),%edx
+  800335:	73 0a                	jae    800341 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800337:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80033a:	89 08                	mov    %ecx,(%eax)
+  80033c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80033f:	88 02                	mov    %al,(%edx)
+}
+  800341:	5d                   	pop    %ebp
+  800342:	c3                   	ret
+
+00800343 <printfmt>:
+{
+  800343:	55                   	push   %ebp
+  800344:	89 e5                	mov    %esp,%ebp
+  800346:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800349:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80034c:	50                   	push   %eax
+  80034d:	ff 75 10             	push   0x10(%ebp)
+  800350:	ff 75 0c             	push   0xc(%ebp)
+  800353:	ff 75 08             	push   0x8(%ebp)
+  800356:	e8 05 00 00 00       	call   800360 <vprintfmt>
+}
+  80035b:	83 c4 10             	add    $0x10,%esp
+  80035e:	c9                   	leave
+  80035f:	c3                   	ret
+
+00800360 <vprintfmt>:
+{
+  800360:	55                   	push   %ebp
+  800361:	89 e5                	mov    %esp,%ebp
+  800363:	57                   	push   %edi
+  800364:	56                   	push   %esi
+  800365:	53                   	push   %ebx
+  800366:	83 ec 3c             	sub    $0x3c,%esp
+  800369:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80036c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80036f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800376:	eb 16                	jmp    80038e <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800378:	83 ec 08             	sub    $0x8,%esp
+  80037b:	ff 75 0c             	push   0xc(%ebp)
+  80037e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800381:	c1 e2 08             	shl    $0x8,%edx
+  800384:	09 d0                	or     %edx,%eax
+  800386:	50                   	push   %eax
+  800387:	ff d7                	call   *%edi
+  800389:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80038c:	89 de                	mov    %ebx,%esi
+  80038e:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800391:	0f b6 06             	movzbl (%esi),%eax
+  800394:	83 f8 25             	cmp    $0x25,%eax
+  800397:	74 0c                	je     8003a5 <vprintfmt+0x45>
+			if (ch == '\0')
+  800399:	85 c0                	test   %eax,%eax
+  80039b:	75 db                	jne    800378 <vprintfmt+0x18>
+}
+  80039d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a0:	5b                   	pop    %ebx
+  8003a1:	5e                   	pop    %esi
+  8003a2:	5f                   	pop    %edi
+  8003a3:	5d                   	pop    %ebp
+  8003a4:	c3                   	ret
+		padc = ' ';
+  8003a5:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003a9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003b0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003b7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003be:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c3:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003c6:	0f b6 13             	movzbl (%ebx),%edx
+  8003c9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003cc:	3c 55                	cmp    $0x55,%al
+  8003ce:	0f 87 2c 04 00 00    	ja     800800 <vprintfmt+0x4a0>
+  8003d4:	0f b6 c0             	movzbl %al,%eax
+  8003d7:	ff 24 85 60 35 80 00 	jmp    *0x803560(,%eax,4)
+  8003de:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003e0:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003e4:	eb dd                	jmp    8003c3 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e6:	89 f3                	mov    %esi,%ebx
+  8003e8:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003ec:	eb d5                	jmp    8003c3 <vprintfmt+0x63>
+  8003ee:	0f b6 d2             	movzbl %dl,%edx
+  8003f1:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003f3:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003f8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003fb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003ff:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800402:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800405:	83 fe 09             	cmp    $0x9,%esi
+  800408:	0f 87 8a 00 00 00    	ja     800498 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80040e:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800411:	eb e5                	jmp    8003f8 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800413:	8b 45 14             	mov    0x14(%ebp),%eax
+  800416:	8b 00                	mov    (%eax),%eax
+  800418:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041e:	8d 40 04             	lea    0x4(%eax),%eax
+  800421:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800424:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800426:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80042a:	79 97                	jns    8003c3 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80042c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80042f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800432:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800439:	eb 88                	jmp    8003c3 <vprintfmt+0x63>
+			if (width < 0)
+  80043b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80043e:	85 db                	test   %ebx,%ebx
+  800440:	b8 00 00 00 00       	mov    $0x0,%eax
+  800445:	0f 49 c3             	cmovns %ebx,%eax
+  800448:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044b:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80044d:	e9 71 ff ff ff       	jmp    8003c3 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800452:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800454:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80045b:	e9 63 ff ff ff       	jmp    8003c3 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800460:	8d 73 02             	lea    0x2(%ebx),%esi
+  800463:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800467:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80046e:	3c 67                	cmp    $0x67,%al
+  800470:	0f 84 18 ff ff ff    	je     80038e <vprintfmt+0x2e>
+					attrib = 0x04;
+  800476:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80047d:	3c 72                	cmp    $0x72,%al
+  80047f:	0f 84 09 ff ff ff    	je     80038e <vprintfmt+0x2e>
+					attrib = 0x00;
+  800485:	3c 62                	cmp    $0x62,%al
+  800487:	0f 94 c0             	sete   %al
+  80048a:	0f b6 c0             	movzbl %al,%eax
+  80048d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800490:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800493:	e9 f6 fe ff ff       	jmp    80038e <vprintfmt+0x2e>
+  800498:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80049b:	eb 89                	jmp    800426 <vprintfmt+0xc6>
+			lflag++;
+  80049d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a0:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004a2:	e9 1c ff ff ff       	jmp    8003c3 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004aa:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004ad:	83 ec 08             	sub    $0x8,%esp
+  8004b0:	ff 75 0c             	push   0xc(%ebp)
+  8004b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004b6:	c1 e0 08             	shl    $0x8,%eax
+  8004b9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8004bc:	0b 01                	or     (%ecx),%eax
+  8004be:	50                   	push   %eax
+  8004bf:	ff d7                	call   *%edi
+			break;
+  8004c1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004c4:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004c7:	e9 c2 fe ff ff       	jmp    80038e <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cf:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004d2:	8b 10                	mov    (%eax),%edx
+  8004d4:	89 d0                	mov    %edx,%eax
+  8004d6:	f7 d8                	neg    %eax
+  8004d8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004db:	83 f8 12             	cmp    $0x12,%eax
+  8004de:	7f 25                	jg     800505 <vprintfmt+0x1a5>
+  8004e0:	8b 14 85 c0 36 80 00 	mov    0x8036c0(,%eax,4),%edx
+  8004e7:	85 d2                	test   %edx,%edx
+  8004e9:	74 1a                	je     800505 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004eb:	52                   	push   %edx
+  8004ec:	68 02 38 80 00       	push   $0x803802
+  8004f1:	ff 75 0c             	push   0xc(%ebp)
+  8004f4:	57                   	push   %edi
+  8004f5:	e8 49 fe ff ff       	call   800343 <printfmt>
+  8004fa:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004fd:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800500:	e9 89 fe ff ff       	jmp    80038e <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800505:	50                   	push   %eax
+  800506:	68 2f 34 80 00       	push   $0x80342f
+  80050b:	ff 75 0c             	push   0xc(%ebp)
+  80050e:	57                   	push   %edi
+  80050f:	e8 2f fe ff ff       	call   800343 <printfmt>
+  800514:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800517:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80051a:	e9 6f fe ff ff       	jmp    80038e <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80051f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800522:	83 c0 04             	add    $0x4,%eax
+  800525:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80052d:	85 c9                	test   %ecx,%ecx
+  80052f:	b8 28 34 80 00       	mov    $0x803428,%eax
+  800534:	0f 45 c1             	cmovne %ecx,%eax
+  800537:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80053a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80053e:	7e 06                	jle    800546 <vprintfmt+0x1e6>
+  800540:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800544:	75 1a                	jne    800560 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800546:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800549:	c1 e0 08             	shl    $0x8,%eax
+  80054c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80054f:	83 c8 3f             	or     $0x3f,%eax
+  800552:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800555:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800558:	89 75 10             	mov    %esi,0x10(%ebp)
+  80055b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80055e:	eb 6d                	jmp    8005cd <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800560:	83 ec 08             	sub    $0x8,%esp
+  800563:	ff 75 d0             	push   -0x30(%ebp)
+  800566:	ff 75 c8             	push   -0x38(%ebp)
+  800569:	e8 39 03 00 00       	call   8008a7 <strnlen>
+  80056e:	89 c2                	mov    %eax,%edx
+  800570:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800573:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800575:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800578:	c1 e1 08             	shl    $0x8,%ecx
+  80057b:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80057f:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800581:	83 c4 10             	add    $0x10,%esp
+  800584:	89 c3                	mov    %eax,%ebx
+  800586:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800589:	89 75 10             	mov    %esi,0x10(%ebp)
+  80058c:	89 ce                	mov    %ecx,%esi
+  80058e:	eb 0f                	jmp    80059f <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800590:	83 ec 08             	sub    $0x8,%esp
+  800593:	ff 75 0c             	push   0xc(%ebp)
+  800596:	56                   	push   %esi
+  800597:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800599:	83 eb 01             	sub    $0x1,%ebx
+  80059c:	83 c4 10             	add    $0x10,%esp
+  80059f:	85 db                	test   %ebx,%ebx
+  8005a1:	7f ed                	jg     800590 <vprintfmt+0x230>
+  8005a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005a9:	85 c0                	test   %eax,%eax
+  8005ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b0:	0f 49 d0             	cmovns %eax,%edx
+  8005b3:	29 d0                	sub    %edx,%eax
+  8005b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b8:	eb 8c                	jmp    800546 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8005ba:	83 ec 08             	sub    $0x8,%esp
+  8005bd:	ff 75 0c             	push   0xc(%ebp)
+  8005c0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005c3:	09 c2                	or     %eax,%edx
+  8005c5:	52                   	push   %edx
+  8005c6:	ff d7                	call   *%edi
+  8005c8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005cb:	89 d9                	mov    %ebx,%ecx
+  8005cd:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005d0:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005d4:	0f be d0             	movsbl %al,%edx
+  8005d7:	85 d2                	test   %edx,%edx
+  8005d9:	74 2a                	je     800605 <vprintfmt+0x2a5>
+  8005db:	85 f6                	test   %esi,%esi
+  8005dd:	78 05                	js     8005e4 <vprintfmt+0x284>
+  8005df:	83 ee 01             	sub    $0x1,%esi
+  8005e2:	78 3b                	js     80061f <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e8:	74 d0                	je     8005ba <vprintfmt+0x25a>
+  8005ea:	0f be c0             	movsbl %al,%eax
+  8005ed:	83 e8 20             	sub    $0x20,%eax
+  8005f0:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f3:	76 c5                	jbe    8005ba <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005f5:	83 ec 08             	sub    $0x8,%esp
+  8005f8:	ff 75 0c             	push   0xc(%ebp)
+  8005fb:	ff 75 cc             	push   -0x34(%ebp)
+  8005fe:	ff d7                	call   *%edi
+  800600:	83 c4 10             	add    $0x10,%esp
+  800603:	eb c6                	jmp    8005cb <vprintfmt+0x26b>
+  800605:	8b 75 10             	mov    0x10(%ebp),%esi
+  800608:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80060b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80060e:	01 c3                	add    %eax,%ebx
+  800610:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800612:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800615:	83 c8 20             	or     $0x20,%eax
+  800618:	89 75 10             	mov    %esi,0x10(%ebp)
+  80061b:	89 c6                	mov    %eax,%esi
+  80061d:	eb 14                	jmp    800633 <vprintfmt+0x2d3>
+  80061f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800622:	eb e4                	jmp    800608 <vprintfmt+0x2a8>
+  800624:	83 ec 08             	sub    $0x8,%esp
+  800627:	ff 75 0c             	push   0xc(%ebp)
+  80062a:	56                   	push   %esi
+  80062b:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80062d:	83 eb 01             	sub    $0x1,%ebx
+  800630:	83 c4 10             	add    $0x10,%esp
+  800633:	85 db                	test   %ebx,%ebx
+  800635:	7f ed                	jg     800624 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800637:	8b 75 10             	mov    0x10(%ebp),%esi
+  80063a:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80063d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800640:	e9 49 fd ff ff       	jmp    80038e <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800645:	83 f9 01             	cmp    $0x1,%ecx
+  800648:	7f 1f                	jg     800669 <vprintfmt+0x309>
+	else if (lflag)
+  80064a:	85 c9                	test   %ecx,%ecx
+  80064c:	74 69                	je     8006b7 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8b 00                	mov    (%eax),%eax
+  800653:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800656:	89 c1                	mov    %eax,%ecx
+  800658:	c1 f9 1f             	sar    $0x1f,%ecx
+  80065b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80065e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800661:	8d 40 04             	lea    0x4(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+  800667:	eb 17                	jmp    800680 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800669:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066c:	8b 50 04             	mov    0x4(%eax),%edx
+  80066f:	8b 00                	mov    (%eax),%eax
+  800671:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800674:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8d 40 08             	lea    0x8(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800680:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800683:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800686:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80068b:	85 db                	test   %ebx,%ebx
+  80068d:	0f 89 f6 00 00 00    	jns    800789 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800693:	83 ec 08             	sub    $0x8,%esp
+  800696:	ff 75 0c             	push   0xc(%ebp)
+  800699:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80069c:	c1 e0 08             	shl    $0x8,%eax
+  80069f:	83 c8 2d             	or     $0x2d,%eax
+  8006a2:	50                   	push   %eax
+  8006a3:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006a5:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006a8:	f7 d9                	neg    %ecx
+  8006aa:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006b2:	e9 d2 00 00 00       	jmp    800789 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8006b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ba:	8b 00                	mov    (%eax),%eax
+  8006bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006bf:	89 c1                	mov    %eax,%ecx
+  8006c1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d0:	eb ae                	jmp    800680 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006d2:	83 f9 01             	cmp    $0x1,%ecx
+  8006d5:	7f 19                	jg     8006f0 <vprintfmt+0x390>
+	else if (lflag)
+  8006d7:	85 c9                	test   %ecx,%ecx
+  8006d9:	74 2a                	je     800705 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 08                	mov    (%eax),%ecx
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006eb:	e9 99 00 00 00       	jmp    800789 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 08                	mov    (%eax),%ecx
+  8006f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800700:	e9 84 00 00 00       	jmp    800789 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 08                	mov    (%eax),%ecx
+  80070a:	8d 40 04             	lea    0x4(%eax),%eax
+  80070d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800710:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800715:	eb 72                	jmp    800789 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800717:	83 f9 01             	cmp    $0x1,%ecx
+  80071a:	7f 16                	jg     800732 <vprintfmt+0x3d2>
+	else if (lflag)
+  80071c:	85 c9                	test   %ecx,%ecx
+  80071e:	74 24                	je     800744 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800720:	8b 45 14             	mov    0x14(%ebp),%eax
+  800723:	8b 08                	mov    (%eax),%ecx
+  800725:	8d 40 04             	lea    0x4(%eax),%eax
+  800728:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800730:	eb 57                	jmp    800789 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800732:	8b 45 14             	mov    0x14(%ebp),%eax
+  800735:	8b 08                	mov    (%eax),%ecx
+  800737:	8d 40 08             	lea    0x8(%eax),%eax
+  80073a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073d:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800742:	eb 45                	jmp    800789 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8b 08                	mov    (%eax),%ecx
+  800749:	8d 40 04             	lea    0x4(%eax),%eax
+  80074c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80074f:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800754:	eb 33                	jmp    800789 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800756:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800759:	c1 e3 08             	shl    $0x8,%ebx
+  80075c:	83 ec 08             	sub    $0x8,%esp
+  80075f:	ff 75 0c             	push   0xc(%ebp)
+  800762:	89 d8                	mov    %ebx,%eax
+  800764:	83 c8 30             	or     $0x30,%eax
+  800767:	50                   	push   %eax
+  800768:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80076a:	83 c4 08             	add    $0x8,%esp
+  80076d:	ff 75 0c             	push   0xc(%ebp)
+  800770:	83 cb 78             	or     $0x78,%ebx
+  800773:	53                   	push   %ebx
+  800774:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800776:	8b 45 14             	mov    0x14(%ebp),%eax
+  800779:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80077b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80077e:	8d 40 04             	lea    0x4(%eax),%eax
+  800781:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800784:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800789:	ff 75 e4             	push   -0x1c(%ebp)
+  80078c:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800790:	52                   	push   %edx
+  800791:	ff 75 e0             	push   -0x20(%ebp)
+  800794:	50                   	push   %eax
+  800795:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800798:	89 f8                	mov    %edi,%eax
+  80079a:	e8 f7 fa ff ff       	call   800296 <printnum>
+			break;
+  80079f:	83 c4 10             	add    $0x10,%esp
+  8007a2:	e9 e7 fb ff ff       	jmp    80038e <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007a7:	83 f9 01             	cmp    $0x1,%ecx
+  8007aa:	7f 16                	jg     8007c2 <vprintfmt+0x462>
+	else if (lflag)
+  8007ac:	85 c9                	test   %ecx,%ecx
+  8007ae:	74 24                	je     8007d4 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8b 08                	mov    (%eax),%ecx
+  8007b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007bb:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8007c0:	eb c7                	jmp    800789 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c5:	8b 08                	mov    (%eax),%ecx
+  8007c7:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007cd:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007d2:	eb b5                	jmp    800789 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d7:	8b 08                	mov    (%eax),%ecx
+  8007d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007df:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007e4:	eb a3                	jmp    800789 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007e6:	83 ec 08             	sub    $0x8,%esp
+  8007e9:	ff 75 0c             	push   0xc(%ebp)
+  8007ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007ef:	c1 e0 08             	shl    $0x8,%eax
+  8007f2:	83 c8 25             	or     $0x25,%eax
+  8007f5:	50                   	push   %eax
+  8007f6:	ff d7                	call   *%edi
+			break;
+  8007f8:	83 c4 10             	add    $0x10,%esp
+  8007fb:	e9 8e fb ff ff       	jmp    80038e <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800800:	83 ec 08             	sub    $0x8,%esp
+  800803:	ff 75 0c             	push   0xc(%ebp)
+  800806:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800809:	c1 e0 08             	shl    $0x8,%eax
+  80080c:	83 c8 25             	or     $0x25,%eax
+  80080f:	50                   	push   %eax
+  800810:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800812:	83 c4 10             	add    $0x10,%esp
+  800815:	89 de                	mov    %ebx,%esi
+  800817:	eb 03                	jmp    80081c <vprintfmt+0x4bc>
+  800819:	83 ee 01             	sub    $0x1,%esi
+  80081c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800820:	75 f7                	jne    800819 <vprintfmt+0x4b9>
+  800822:	e9 67 fb ff ff       	jmp    80038e <vprintfmt+0x2e>
+
+00800827 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800827:	55                   	push   %ebp
+  800828:	89 e5                	mov    %esp,%ebp
+  80082a:	83 ec 18             	sub    $0x18,%esp
+  80082d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800830:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800833:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800836:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80083a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80083d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800844:	85 c0                	test   %eax,%eax
+  800846:	74 26                	je     80086e <vsnprintf+0x47>
+  800848:	85 d2                	test   %edx,%edx
+  80084a:	7e 22                	jle    80086e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80084c:	ff 75 14             	push   0x14(%ebp)
+  80084f:	ff 75 10             	push   0x10(%ebp)
+  800852:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800855:	50                   	push   %eax
+  800856:	68 26 03 80 00       	push   $0x800326
+  80085b:	e8 00 fb ff ff       	call   800360 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800860:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800863:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800866:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800869:	83 c4 10             	add    $0x10,%esp
+}
+  80086c:	c9                   	leave
+  80086d:	c3                   	ret
+		return -E_INVAL;
+  80086e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800873:	eb f7                	jmp    80086c <vsnprintf+0x45>
+
+00800875 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80087b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80087e:	50                   	push   %eax
+  80087f:	ff 75 10             	push   0x10(%ebp)
+  800882:	ff 75 0c             	push   0xc(%ebp)
+  800885:	ff 75 08             	push   0x8(%ebp)
+  800888:	e8 9a ff ff ff       	call   800827 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80088d:	c9                   	leave
+  80088e:	c3                   	ret
+
+0080088f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80088f:	55                   	push   %ebp
+  800890:	89 e5                	mov    %esp,%ebp
+  800892:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089a:	eb 03                	jmp    80089f <strlen+0x10>
+		n++;
+  80089c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80089f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008a3:	75 f7                	jne    80089c <strlen+0xd>
+	return n;
+}
+  8008a5:	5d                   	pop    %ebp
+  8008a6:	c3                   	ret
+
+008008a7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008a7:	55                   	push   %ebp
+  8008a8:	89 e5                	mov    %esp,%ebp
+  8008aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b5:	eb 03                	jmp    8008ba <strnlen+0x13>
+		n++;
+  8008b7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ba:	39 d0                	cmp    %edx,%eax
+  8008bc:	74 08                	je     8008c6 <strnlen+0x1f>
+  8008be:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008c2:	75 f3                	jne    8008b7 <strnlen+0x10>
+  8008c4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008c6:	89 d0                	mov    %edx,%eax
+  8008c8:	5d                   	pop    %ebp
+  8008c9:	c3                   	ret
+
+008008ca <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	53                   	push   %ebx
+  8008ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008dd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008e0:	83 c0 01             	add    $0x1,%eax
+  8008e3:	84 d2                	test   %dl,%dl
+  8008e5:	75 f2                	jne    8008d9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008e7:	89 c8                	mov    %ecx,%eax
+  8008e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ec:	c9                   	leave
+  8008ed:	c3                   	ret
+
+008008ee <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ee:	55                   	push   %ebp
+  8008ef:	89 e5                	mov    %esp,%ebp
+  8008f1:	53                   	push   %ebx
+  8008f2:	83 ec 10             	sub    $0x10,%esp
+  8008f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008f8:	53                   	push   %ebx
+  8008f9:	e8 91 ff ff ff       	call   80088f <strlen>
+  8008fe:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800901:	ff 75 0c             	push   0xc(%ebp)
+  800904:	01 d8                	add    %ebx,%eax
+  800906:	50                   	push   %eax
+  800907:	e8 be ff ff ff       	call   8008ca <strcpy>
+	return dst;
+}
+  80090c:	89 d8                	mov    %ebx,%eax
+  80090e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800911:	c9                   	leave
+  800912:	c3                   	ret
+
+00800913 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	56                   	push   %esi
+  800917:	53                   	push   %ebx
+  800918:	8b 75 08             	mov    0x8(%ebp),%esi
+  80091b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80091e:	89 f3                	mov    %esi,%ebx
+  800920:	03 5d 10             	add    0x10(%ebp),%ebx
+  800923:	89 f0                	mov    %esi,%eax
+  800925:	eb 0f                	jmp    800936 <strncpy+0x23>
+		*dst++ = *src;
+  800927:	83 c0 01             	add    $0x1,%eax
+  80092a:	0f b6 0a             	movzbl (%edx),%ecx
+  80092d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800930:	80 f9 01             	cmp    $0x1,%cl
+  800933:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800936:	39 d8                	cmp    %ebx,%eax
+  800938:	75 ed                	jne    800927 <strncpy+0x14>
+	}
+	return ret;
+}
+  80093a:	89 f0                	mov    %esi,%eax
+  80093c:	5b                   	pop    %ebx
+  80093d:	5e                   	pop    %esi
+  80093e:	5d                   	pop    %ebp
+  80093f:	c3                   	ret
+
+00800940 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	56                   	push   %esi
+  800944:	53                   	push   %ebx
+  800945:	8b 75 08             	mov    0x8(%ebp),%esi
+  800948:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80094b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80094e:	89 f0                	mov    %esi,%eax
+  800950:	85 d2                	test   %edx,%edx
+  800952:	74 21                	je     800975 <strlcpy+0x35>
+  800954:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800958:	89 f2                	mov    %esi,%edx
+  80095a:	eb 09                	jmp    800965 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80095c:	83 c1 01             	add    $0x1,%ecx
+  80095f:	83 c2 01             	add    $0x1,%edx
+  800962:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800965:	39 c2                	cmp    %eax,%edx
+  800967:	74 09                	je     800972 <strlcpy+0x32>
+  800969:	0f b6 19             	movzbl (%ecx),%ebx
+  80096c:	84 db                	test   %bl,%bl
+  80096e:	75 ec                	jne    80095c <strlcpy+0x1c>
+  800970:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800972:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800975:	29 f0                	sub    %esi,%eax
+}
+  800977:	5b                   	pop    %ebx
+  800978:	5e                   	pop    %esi
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+
+0080097b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800981:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800984:	eb 06                	jmp    80098c <strcmp+0x11>
+		p++, q++;
+  800986:	83 c1 01             	add    $0x1,%ecx
+  800989:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80098c:	0f b6 01             	movzbl (%ecx),%eax
+  80098f:	84 c0                	test   %al,%al
+  800991:	74 04                	je     800997 <strcmp+0x1c>
+  800993:	3a 02                	cmp    (%edx),%al
+  800995:	74 ef                	je     800986 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800997:	0f b6 c0             	movzbl %al,%eax
+  80099a:	0f b6 12             	movzbl (%edx),%edx
+  80099d:	29 d0                	sub    %edx,%eax
+}
+  80099f:	5d                   	pop    %ebp
+  8009a0:	c3                   	ret
+
+008009a1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	53                   	push   %ebx
+  8009a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ab:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009ae:	eb 09                	jmp    8009b9 <strncmp+0x18>
+		n--, p++, q++;
+  8009b0:	83 ea 01             	sub    $0x1,%edx
+  8009b3:	83 c0 01             	add    $0x1,%eax
+  8009b6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009b9:	85 d2                	test   %edx,%edx
+  8009bb:	74 18                	je     8009d5 <strncmp+0x34>
+  8009bd:	0f b6 18             	movzbl (%eax),%ebx
+  8009c0:	84 db                	test   %bl,%bl
+  8009c2:	74 04                	je     8009c8 <strncmp+0x27>
+  8009c4:	3a 19                	cmp    (%ecx),%bl
+  8009c6:	74 e8                	je     8009b0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c8:	0f b6 00             	movzbl (%eax),%eax
+  8009cb:	0f b6 11             	movzbl (%ecx),%edx
+  8009ce:	29 d0                	sub    %edx,%eax
+}
+  8009d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d3:	c9                   	leave
+  8009d4:	c3                   	ret
+		return 0;
+  8009d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009da:	eb f4                	jmp    8009d0 <strncmp+0x2f>
+
+008009dc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e6:	eb 03                	jmp    8009eb <strchr+0xf>
+  8009e8:	83 c0 01             	add    $0x1,%eax
+  8009eb:	0f b6 10             	movzbl (%eax),%edx
+  8009ee:	84 d2                	test   %dl,%dl
+  8009f0:	74 06                	je     8009f8 <strchr+0x1c>
+		if (*s == c)
+  8009f2:	38 ca                	cmp    %cl,%dl
+  8009f4:	75 f2                	jne    8009e8 <strchr+0xc>
+  8009f6:	eb 05                	jmp    8009fd <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+
+008009ff <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a05:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a09:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a0c:	38 ca                	cmp    %cl,%dl
+  800a0e:	74 09                	je     800a19 <strfind+0x1a>
+  800a10:	84 d2                	test   %dl,%dl
+  800a12:	74 05                	je     800a19 <strfind+0x1a>
+	for (; *s; s++)
+  800a14:	83 c0 01             	add    $0x1,%eax
+  800a17:	eb f0                	jmp    800a09 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a19:	5d                   	pop    %ebp
+  800a1a:	c3                   	ret
+
+00800a1b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a1b:	55                   	push   %ebp
+  800a1c:	89 e5                	mov    %esp,%ebp
+  800a1e:	57                   	push   %edi
+  800a1f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a22:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a25:	85 c9                	test   %ecx,%ecx
+  800a27:	74 20                	je     800a49 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a29:	89 f8                	mov    %edi,%eax
+  800a2b:	09 c8                	or     %ecx,%eax
+  800a2d:	a8 03                	test   $0x3,%al
+  800a2f:	75 12                	jne    800a43 <memset+0x28>
+		c &= 0xFF;
+  800a31:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a35:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a3b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a3e:	fc                   	cld
+  800a3f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a41:	eb 06                	jmp    800a49 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a43:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a46:	fc                   	cld
+  800a47:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a49:	89 f8                	mov    %edi,%eax
+  800a4b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+
+00800a50 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	57                   	push   %edi
+  800a54:	56                   	push   %esi
+  800a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a58:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a5b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a5e:	39 c6                	cmp    %eax,%esi
+  800a60:	73 32                	jae    800a94 <memmove+0x44>
+  800a62:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a65:	39 d0                	cmp    %edx,%eax
+  800a67:	73 2b                	jae    800a94 <memmove+0x44>
+		s += n;
+		d += n;
+  800a69:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a6c:	89 d6                	mov    %edx,%esi
+  800a6e:	09 fe                	or     %edi,%esi
+  800a70:	09 ce                	or     %ecx,%esi
+  800a72:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a78:	75 0e                	jne    800a88 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a7a:	83 ef 04             	sub    $0x4,%edi
+  800a7d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a80:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a83:	fd                   	std
+  800a84:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a86:	eb 09                	jmp    800a91 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a88:	83 ef 01             	sub    $0x1,%edi
+  800a8b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a8e:	fd                   	std
+  800a8f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a91:	fc                   	cld
+  800a92:	eb 1a                	jmp    800aae <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a94:	89 f2                	mov    %esi,%edx
+  800a96:	09 c2                	or     %eax,%edx
+  800a98:	09 ca                	or     %ecx,%edx
+  800a9a:	f6 c2 03             	test   $0x3,%dl
+  800a9d:	75 0a                	jne    800aa9 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a9f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800aa2:	89 c7                	mov    %eax,%edi
+  800aa4:	fc                   	cld
+  800aa5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa7:	eb 05                	jmp    800aae <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aa9:	89 c7                	mov    %eax,%edi
+  800aab:	fc                   	cld
+  800aac:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aae:	5e                   	pop    %esi
+  800aaf:	5f                   	pop    %edi
+  800ab0:	5d                   	pop    %ebp
+  800ab1:	c3                   	ret
+
+00800ab2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ab2:	55                   	push   %ebp
+  800ab3:	89 e5                	mov    %esp,%ebp
+  800ab5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ab8:	ff 75 10             	push   0x10(%ebp)
+  800abb:	ff 75 0c             	push   0xc(%ebp)
+  800abe:	ff 75 08             	push   0x8(%ebp)
+  800ac1:	e8 8a ff ff ff       	call   800a50 <memmove>
+}
+  800ac6:	c9                   	leave
+  800ac7:	c3                   	ret
+
+00800ac8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	56                   	push   %esi
+  800acc:	53                   	push   %ebx
+  800acd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ad3:	89 c6                	mov    %eax,%esi
+  800ad5:	03 75 10             	add    0x10(%ebp),%esi
+  800ad8:	eb 06                	jmp    800ae0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ada:	83 c0 01             	add    $0x1,%eax
+  800add:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ae0:	39 f0                	cmp    %esi,%eax
+  800ae2:	74 14                	je     800af8 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ae4:	0f b6 08             	movzbl (%eax),%ecx
+  800ae7:	0f b6 1a             	movzbl (%edx),%ebx
+  800aea:	38 d9                	cmp    %bl,%cl
+  800aec:	74 ec                	je     800ada <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aee:	0f b6 c1             	movzbl %cl,%eax
+  800af1:	0f b6 db             	movzbl %bl,%ebx
+  800af4:	29 d8                	sub    %ebx,%eax
+  800af6:	eb 05                	jmp    800afd <memcmp+0x35>
+	}
+
+	return 0;
+  800af8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800afd:	5b                   	pop    %ebx
+  800afe:	5e                   	pop    %esi
+  800aff:	5d                   	pop    %ebp
+  800b00:	c3                   	ret
+
+00800b01 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b0a:	89 c2                	mov    %eax,%edx
+  800b0c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b0f:	eb 03                	jmp    800b14 <memfind+0x13>
+  800b11:	83 c0 01             	add    $0x1,%eax
+  800b14:	39 d0                	cmp    %edx,%eax
+  800b16:	73 04                	jae    800b1c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b18:	38 08                	cmp    %cl,(%eax)
+  800b1a:	75 f5                	jne    800b11 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b1c:	5d                   	pop    %ebp
+  800b1d:	c3                   	ret
+
+00800b1e <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	57                   	push   %edi
+  800b22:	56                   	push   %esi
+  800b23:	53                   	push   %ebx
+  800b24:	83 ec 1c             	sub    $0x1c,%esp
+  800b27:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b2a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b2d:	eb 03                	jmp    800b32 <strtol+0x14>
+		s++;
+  800b2f:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b32:	0f b6 06             	movzbl (%esi),%eax
+  800b35:	3c 20                	cmp    $0x20,%al
+  800b37:	74 f6                	je     800b2f <strtol+0x11>
+  800b39:	3c 09                	cmp    $0x9,%al
+  800b3b:	74 f2                	je     800b2f <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b3d:	3c 2b                	cmp    $0x2b,%al
+  800b3f:	74 43                	je     800b84 <strtol+0x66>
+	int neg = 0;
+  800b41:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b46:	3c 2d                	cmp    $0x2d,%al
+  800b48:	74 44                	je     800b8e <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b4a:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b50:	75 0f                	jne    800b61 <strtol+0x43>
+  800b52:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b55:	74 41                	je     800b98 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b57:	85 ff                	test   %edi,%edi
+  800b59:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b5e:	0f 44 f8             	cmove  %eax,%edi
+  800b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b66:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b6b:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b6e:	89 fb                	mov    %edi,%ebx
+  800b70:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b73:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b76:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b79:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b7c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b7f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b82:	eb 67                	jmp    800beb <strtol+0xcd>
+		s++;
+  800b84:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8c:	eb bc                	jmp    800b4a <strtol+0x2c>
+		s++, neg = 1;
+  800b8e:	83 c6 01             	add    $0x1,%esi
+  800b91:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b96:	eb b2                	jmp    800b4a <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b98:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b9c:	74 0e                	je     800bac <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b9e:	85 ff                	test   %edi,%edi
+  800ba0:	75 bf                	jne    800b61 <strtol+0x43>
+		s++, base = 8;
+  800ba2:	83 c6 01             	add    $0x1,%esi
+  800ba5:	bf 08 00 00 00       	mov    $0x8,%edi
+  800baa:	eb b5                	jmp    800b61 <strtol+0x43>
+		s += 2, base = 16;
+  800bac:	83 c6 02             	add    $0x2,%esi
+  800baf:	bf 10 00 00 00       	mov    $0x10,%edi
+  800bb4:	eb ab                	jmp    800b61 <strtol+0x43>
+			dig = *s - '0';
+  800bb6:	0f be c9             	movsbl %cl,%ecx
+  800bb9:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800bbc:	39 f9                	cmp    %edi,%ecx
+  800bbe:	7d 59                	jge    800c19 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800bc0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800bc4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bc7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bca:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bcd:	0f af d8             	imul   %eax,%ebx
+  800bd0:	0f af d7             	imul   %edi,%edx
+  800bd3:	01 d3                	add    %edx,%ebx
+  800bd5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bd8:	f7 e7                	mul    %edi
+  800bda:	01 da                	add    %ebx,%edx
+  800bdc:	89 cb                	mov    %ecx,%ebx
+  800bde:	c1 fb 1f             	sar    $0x1f,%ebx
+  800be1:	01 c8                	add    %ecx,%eax
+  800be3:	11 da                	adc    %ebx,%edx
+  800be5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800be8:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bee:	0f b6 08             	movzbl (%eax),%ecx
+  800bf1:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800bf4:	80 fb 09             	cmp    $0x9,%bl
+  800bf7:	76 bd                	jbe    800bb6 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800bf9:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800bfc:	80 fb 19             	cmp    $0x19,%bl
+  800bff:	77 08                	ja     800c09 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c01:	0f be c9             	movsbl %cl,%ecx
+  800c04:	83 e9 57             	sub    $0x57,%ecx
+  800c07:	eb b3                	jmp    800bbc <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c09:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c0c:	80 fb 19             	cmp    $0x19,%bl
+  800c0f:	77 08                	ja     800c19 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c11:	0f be c9             	movsbl %cl,%ecx
+  800c14:	83 e9 37             	sub    $0x37,%ecx
+  800c17:	eb a3                	jmp    800bbc <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c19:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c1c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c1f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c22:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c25:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c29:	74 05                	je     800c30 <strtol+0x112>
+		*endptr = (char *) s;
+  800c2b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c2e:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c30:	85 c9                	test   %ecx,%ecx
+  800c32:	74 07                	je     800c3b <strtol+0x11d>
+  800c34:	f7 d8                	neg    %eax
+  800c36:	83 d2 00             	adc    $0x0,%edx
+  800c39:	f7 da                	neg    %edx
+}
+  800c3b:	83 c4 1c             	add    $0x1c,%esp
+  800c3e:	5b                   	pop    %ebx
+  800c3f:	5e                   	pop    %esi
+  800c40:	5f                   	pop    %edi
+  800c41:	5d                   	pop    %ebp
+  800c42:	c3                   	ret
+
+00800c43 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c43:	55                   	push   %ebp
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	57                   	push   %edi
+  800c47:	56                   	push   %esi
+  800c48:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c49:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c50:	74 18                	je     800c6a <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5d:	89 c3                	mov    %eax,%ebx
+  800c5f:	89 c7                	mov    %eax,%edi
+  800c61:	89 c6                	mov    %eax,%esi
+  800c63:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c65:	5b                   	pop    %ebx
+  800c66:	5e                   	pop    %esi
+  800c67:	5f                   	pop    %edi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c75:	89 c3                	mov    %eax,%ebx
+  800c77:	89 c7                	mov    %eax,%edi
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	8d 35 84 0c 80 00    	lea    0x800c84,%esi
+  800c82:	0f 34                	sysenter
+  800c84:	5d                   	pop    %ebp
+		goto out;
+  800c85:	eb de                	jmp    800c65 <sys_cputs+0x22>
+
+00800c87 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c87:	55                   	push   %ebp
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	57                   	push   %edi
+  800c8b:	56                   	push   %esi
+  800c8c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c8d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c94:	74 19                	je     800caf <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ca0:	89 d1                	mov    %edx,%ecx
+  800ca2:	89 d3                	mov    %edx,%ebx
+  800ca4:	89 d7                	mov    %edx,%edi
+  800ca6:	89 d6                	mov    %edx,%esi
+  800ca8:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800caa:	5b                   	pop    %ebx
+  800cab:	5e                   	pop    %esi
+  800cac:	5f                   	pop    %edi
+  800cad:	5d                   	pop    %ebp
+  800cae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800caf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb9:	89 d1                	mov    %edx,%ecx
+  800cbb:	89 d3                	mov    %edx,%ebx
+  800cbd:	89 d7                	mov    %edx,%edi
+  800cbf:	55                   	push   %ebp
+  800cc0:	89 e5                	mov    %esp,%ebp
+  800cc2:	8d 35 ca 0c 80 00    	lea    0x800cca,%esi
+  800cc8:	0f 34                	sysenter
+  800cca:	5d                   	pop    %ebp
+		goto out;
+  800ccb:	eb dd                	jmp    800caa <sys_cgetc+0x23>
+
+00800ccd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+  800cd3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800cd6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cdd:	74 21                	je     800d00 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cec:	89 cb                	mov    %ecx,%ebx
+  800cee:	89 cf                	mov    %ecx,%edi
+  800cf0:	89 ce                	mov    %ecx,%esi
+  800cf2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7f 27                	jg     800d1f <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d08:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d0d:	89 cb                	mov    %ecx,%ebx
+  800d0f:	89 cf                	mov    %ecx,%edi
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	8d 35 1c 0d 80 00    	lea    0x800d1c,%esi
+  800d1a:	0f 34                	sysenter
+  800d1c:	5d                   	pop    %ebp
+		goto out;
+  800d1d:	eb d5                	jmp    800cf4 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d1f:	83 ec 0c             	sub    $0xc,%esp
+  800d22:	50                   	push   %eax
+  800d23:	6a 03                	push   $0x3
+  800d25:	68 2b 37 80 00       	push   $0x80372b
+  800d2a:	6a 3f                	push   $0x3f
+  800d2c:	68 48 37 80 00       	push   $0x803748
+  800d31:	e8 71 f4 ff ff       	call   8001a7 <_panic>
+
+00800d36 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	57                   	push   %edi
+  800d3a:	56                   	push   %esi
+  800d3b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d3c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d43:	74 19                	je     800d5e <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d4f:	89 d1                	mov    %edx,%ecx
+  800d51:	89 d3                	mov    %edx,%ebx
+  800d53:	89 d7                	mov    %edx,%edi
+  800d55:	89 d6                	mov    %edx,%esi
+  800d57:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d63:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d68:	89 d1                	mov    %edx,%ecx
+  800d6a:	89 d3                	mov    %edx,%ebx
+  800d6c:	89 d7                	mov    %edx,%edi
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	8d 35 79 0d 80 00    	lea    0x800d79,%esi
+  800d77:	0f 34                	sysenter
+  800d79:	5d                   	pop    %ebp
+		goto out;
+  800d7a:	eb dd                	jmp    800d59 <sys_getenvid+0x23>
+
+00800d7c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	57                   	push   %edi
+  800d80:	56                   	push   %esi
+  800d81:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d82:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d89:	74 19                	je     800da4 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d90:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d95:	89 d1                	mov    %edx,%ecx
+  800d97:	89 d3                	mov    %edx,%ebx
+  800d99:	89 d7                	mov    %edx,%edi
+  800d9b:	89 d6                	mov    %edx,%esi
+  800d9d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800da4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dae:	89 d1                	mov    %edx,%ecx
+  800db0:	89 d3                	mov    %edx,%ebx
+  800db2:	89 d7                	mov    %edx,%edi
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	8d 35 bf 0d 80 00    	lea    0x800dbf,%esi
+  800dbd:	0f 34                	sysenter
+  800dbf:	5d                   	pop    %ebp
+		goto out;
+  800dc0:	eb dd                	jmp    800d9f <sys_yield+0x23>
+
+00800dc2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	57                   	push   %edi
+  800dc6:	56                   	push   %esi
+  800dc7:	53                   	push   %ebx
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dcb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dd2:	74 23                	je     800df7 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800dd4:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de7:	89 f7                	mov    %esi,%edi
+  800de9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800deb:	85 c0                	test   %eax,%eax
+  800ded:	7f 29                	jg     800e18 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df2:	5b                   	pop    %ebx
+  800df3:	5e                   	pop    %esi
+  800df4:	5f                   	pop    %edi
+  800df5:	5d                   	pop    %ebp
+  800df6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e02:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	8d 35 15 0e 80 00    	lea    0x800e15,%esi
+  800e13:	0f 34                	sysenter
+  800e15:	5d                   	pop    %ebp
+		goto out;
+  800e16:	eb d3                	jmp    800deb <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e18:	83 ec 0c             	sub    $0xc,%esp
+  800e1b:	50                   	push   %eax
+  800e1c:	6a 04                	push   $0x4
+  800e1e:	68 2b 37 80 00       	push   $0x80372b
+  800e23:	6a 3f                	push   $0x3f
+  800e25:	68 48 37 80 00       	push   $0x803748
+  800e2a:	e8 78 f3 ff ff       	call   8001a7 <_panic>
+
+00800e2f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	56                   	push   %esi
+  800e34:	53                   	push   %ebx
+  800e35:	83 ec 0c             	sub    $0xc,%esp
+  800e38:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e3b:	85 f6                	test   %esi,%esi
+  800e3d:	75 09                	jne    800e48 <sys_page_map+0x19>
+  800e3f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e46:	74 1f                	je     800e67 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e48:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e56:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e59:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e5b:	85 c0                	test   %eax,%eax
+  800e5d:	7f 27                	jg     800e86 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e62:	5b                   	pop    %ebx
+  800e63:	5e                   	pop    %esi
+  800e64:	5f                   	pop    %edi
+  800e65:	5d                   	pop    %ebp
+  800e66:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e75:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e78:	55                   	push   %ebp
+  800e79:	89 e5                	mov    %esp,%ebp
+  800e7b:	8d 35 83 0e 80 00    	lea    0x800e83,%esi
+  800e81:	0f 34                	sysenter
+  800e83:	5d                   	pop    %ebp
+		goto out;
+  800e84:	eb d5                	jmp    800e5b <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e86:	83 ec 0c             	sub    $0xc,%esp
+  800e89:	50                   	push   %eax
+  800e8a:	6a 05                	push   $0x5
+  800e8c:	68 2b 37 80 00       	push   $0x80372b
+  800e91:	6a 3f                	push   $0x3f
+  800e93:	68 48 37 80 00       	push   $0x803748
+  800e98:	e8 0a f3 ff ff       	call   8001a7 <_panic>
+
+00800e9d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e9d:	55                   	push   %ebp
+  800e9e:	89 e5                	mov    %esp,%ebp
+  800ea0:	57                   	push   %edi
+  800ea1:	56                   	push   %esi
+  800ea2:	53                   	push   %ebx
+  800ea3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ea6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ead:	74 22                	je     800ed1 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800eaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb4:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebf:	89 df                	mov    %ebx,%edi
+  800ec1:	89 de                	mov    %ebx,%esi
+  800ec3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	7f 28                	jg     800ef1 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ec9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edc:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ee1:	89 df                	mov    %ebx,%edi
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	8d 35 ee 0e 80 00    	lea    0x800eee,%esi
+  800eec:	0f 34                	sysenter
+  800eee:	5d                   	pop    %ebp
+		goto out;
+  800eef:	eb d4                	jmp    800ec5 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef1:	83 ec 0c             	sub    $0xc,%esp
+  800ef4:	50                   	push   %eax
+  800ef5:	6a 06                	push   $0x6
+  800ef7:	68 2b 37 80 00       	push   $0x80372b
+  800efc:	6a 3f                	push   $0x3f
+  800efe:	68 48 37 80 00       	push   $0x803748
+  800f03:	e8 9f f2 ff ff       	call   8001a7 <_panic>
+
+00800f08 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	57                   	push   %edi
+  800f0c:	56                   	push   %esi
+  800f0d:	53                   	push   %ebx
+  800f0e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f11:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f18:	74 22                	je     800f3c <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2a:	89 df                	mov    %ebx,%edi
+  800f2c:	89 de                	mov    %ebx,%esi
+  800f2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f30:	85 c0                	test   %eax,%eax
+  800f32:	7f 28                	jg     800f5c <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5f                   	pop    %edi
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f4c:	89 df                	mov    %ebx,%edi
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	8d 35 59 0f 80 00    	lea    0x800f59,%esi
+  800f57:	0f 34                	sysenter
+  800f59:	5d                   	pop    %ebp
+		goto out;
+  800f5a:	eb d4                	jmp    800f30 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5c:	83 ec 0c             	sub    $0xc,%esp
+  800f5f:	50                   	push   %eax
+  800f60:	6a 08                	push   $0x8
+  800f62:	68 2b 37 80 00       	push   $0x80372b
+  800f67:	6a 3f                	push   $0x3f
+  800f69:	68 48 37 80 00       	push   $0x803748
+  800f6e:	e8 34 f2 ff ff       	call   8001a7 <_panic>
+
+00800f73 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f73:	55                   	push   %ebp
+  800f74:	89 e5                	mov    %esp,%ebp
+  800f76:	57                   	push   %edi
+  800f77:	56                   	push   %esi
+  800f78:	53                   	push   %ebx
+  800f79:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f7c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f83:	74 22                	je     800fa7 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f95:	89 df                	mov    %ebx,%edi
+  800f97:	89 de                	mov    %ebx,%esi
+  800f99:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	7f 28                	jg     800fc7 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb2:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fb7:	89 df                	mov    %ebx,%edi
+  800fb9:	55                   	push   %ebp
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	8d 35 c4 0f 80 00    	lea    0x800fc4,%esi
+  800fc2:	0f 34                	sysenter
+  800fc4:	5d                   	pop    %ebp
+		goto out;
+  800fc5:	eb d4                	jmp    800f9b <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc7:	83 ec 0c             	sub    $0xc,%esp
+  800fca:	50                   	push   %eax
+  800fcb:	6a 09                	push   $0x9
+  800fcd:	68 2b 37 80 00       	push   $0x80372b
+  800fd2:	6a 3f                	push   $0x3f
+  800fd4:	68 48 37 80 00       	push   $0x803748
+  800fd9:	e8 c9 f1 ff ff       	call   8001a7 <_panic>
+
+00800fde <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	57                   	push   %edi
+  800fe2:	56                   	push   %esi
+  800fe3:	53                   	push   %ebx
+  800fe4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fe7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fee:	74 22                	je     801012 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800ff0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ffa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801000:	89 df                	mov    %ebx,%edi
+  801002:	89 de                	mov    %ebx,%esi
+  801004:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801006:	85 c0                	test   %eax,%eax
+  801008:	7f 28                	jg     801032 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80100a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100d:	5b                   	pop    %ebx
+  80100e:	5e                   	pop    %esi
+  80100f:	5f                   	pop    %edi
+  801010:	5d                   	pop    %ebp
+  801011:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801012:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801017:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801022:	89 df                	mov    %ebx,%edi
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	8d 35 2f 10 80 00    	lea    0x80102f,%esi
+  80102d:	0f 34                	sysenter
+  80102f:	5d                   	pop    %ebp
+		goto out;
+  801030:	eb d4                	jmp    801006 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801032:	83 ec 0c             	sub    $0xc,%esp
+  801035:	50                   	push   %eax
+  801036:	6a 0a                	push   $0xa
+  801038:	68 2b 37 80 00       	push   $0x80372b
+  80103d:	6a 3f                	push   $0x3f
+  80103f:	68 48 37 80 00       	push   $0x803748
+  801044:	e8 5e f1 ff ff       	call   8001a7 <_panic>
+
+00801049 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	56                   	push   %esi
+  80104e:	53                   	push   %ebx
+  80104f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801052:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801059:	74 22                	je     80107d <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80105b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801060:	b8 17 00 00 00       	mov    $0x17,%eax
+  801065:	8b 55 08             	mov    0x8(%ebp),%edx
+  801068:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106b:	89 df                	mov    %ebx,%edi
+  80106d:	89 de                	mov    %ebx,%esi
+  80106f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801071:	85 c0                	test   %eax,%eax
+  801073:	7f 28                	jg     80109d <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801078:	5b                   	pop    %ebx
+  801079:	5e                   	pop    %esi
+  80107a:	5f                   	pop    %edi
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80107d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801088:	b8 17 00 00 00       	mov    $0x17,%eax
+  80108d:	89 df                	mov    %ebx,%edi
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	8d 35 9a 10 80 00    	lea    0x80109a,%esi
+  801098:	0f 34                	sysenter
+  80109a:	5d                   	pop    %ebp
+		goto out;
+  80109b:	eb d4                	jmp    801071 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	50                   	push   %eax
+  8010a1:	6a 17                	push   $0x17
+  8010a3:	68 2b 37 80 00       	push   $0x80372b
+  8010a8:	6a 3f                	push   $0x3f
+  8010aa:	68 48 37 80 00       	push   $0x803748
+  8010af:	e8 f3 f0 ff ff       	call   8001a7 <_panic>
+
+008010b4 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	57                   	push   %edi
+  8010b8:	56                   	push   %esi
+  8010b9:	53                   	push   %ebx
+  8010ba:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010bd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010c4:	74 22                	je     8010e8 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cb:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d6:	89 df                	mov    %ebx,%edi
+  8010d8:	89 de                	mov    %ebx,%esi
+  8010da:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010dc:	85 c0                	test   %eax,%eax
+  8010de:	7f 28                	jg     801108 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e3:	5b                   	pop    %ebx
+  8010e4:	5e                   	pop    %esi
+  8010e5:	5f                   	pop    %edi
+  8010e6:	5d                   	pop    %ebp
+  8010e7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010f8:	89 df                	mov    %ebx,%edi
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	8d 35 05 11 80 00    	lea    0x801105,%esi
+  801103:	0f 34                	sysenter
+  801105:	5d                   	pop    %ebp
+		goto out;
+  801106:	eb d4                	jmp    8010dc <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801108:	83 ec 0c             	sub    $0xc,%esp
+  80110b:	50                   	push   %eax
+  80110c:	6a 18                	push   $0x18
+  80110e:	68 2b 37 80 00       	push   $0x80372b
+  801113:	6a 3f                	push   $0x3f
+  801115:	68 48 37 80 00       	push   $0x803748
+  80111a:	e8 88 f0 ff ff       	call   8001a7 <_panic>
+
+0080111f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80111f:	55                   	push   %ebp
+  801120:	89 e5                	mov    %esp,%ebp
+  801122:	57                   	push   %edi
+  801123:	56                   	push   %esi
+  801124:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801125:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80112c:	74 1d                	je     80114b <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80112e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801133:	be 00 00 00 00       	mov    $0x0,%esi
+  801138:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801141:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801144:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801146:	5b                   	pop    %ebx
+  801147:	5e                   	pop    %esi
+  801148:	5f                   	pop    %edi
+  801149:	5d                   	pop    %ebp
+  80114a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801151:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801156:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801159:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	8d 35 67 11 80 00    	lea    0x801167,%esi
+  801165:	0f 34                	sysenter
+  801167:	5d                   	pop    %ebp
+		goto out;
+  801168:	eb dc                	jmp    801146 <sys_ipc_try_send+0x27>
+
+0080116a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	57                   	push   %edi
+  80116e:	56                   	push   %esi
+  80116f:	53                   	push   %ebx
+  801170:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801173:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80117a:	74 21                	je     80119d <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80117c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801181:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801186:	8b 55 08             	mov    0x8(%ebp),%edx
+  801189:	89 cb                	mov    %ecx,%ebx
+  80118b:	89 cf                	mov    %ecx,%edi
+  80118d:	89 ce                	mov    %ecx,%esi
+  80118f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801191:	85 c0                	test   %eax,%eax
+  801193:	7f 27                	jg     8011bc <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801195:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801198:	5b                   	pop    %ebx
+  801199:	5e                   	pop    %esi
+  80119a:	5f                   	pop    %edi
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80119d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011aa:	89 cb                	mov    %ecx,%ebx
+  8011ac:	89 cf                	mov    %ecx,%edi
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	8d 35 b9 11 80 00    	lea    0x8011b9,%esi
+  8011b7:	0f 34                	sysenter
+  8011b9:	5d                   	pop    %ebp
+		goto out;
+  8011ba:	eb d5                	jmp    801191 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011bc:	83 ec 0c             	sub    $0xc,%esp
+  8011bf:	50                   	push   %eax
+  8011c0:	6a 0d                	push   $0xd
+  8011c2:	68 2b 37 80 00       	push   $0x80372b
+  8011c7:	6a 3f                	push   $0x3f
+  8011c9:	68 48 37 80 00       	push   $0x803748
+  8011ce:	e8 d4 ef ff ff       	call   8001a7 <_panic>
+
+008011d3 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011d3:	55                   	push   %ebp
+  8011d4:	89 e5                	mov    %esp,%ebp
+  8011d6:	57                   	push   %edi
+  8011d7:	56                   	push   %esi
+  8011d8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011d9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011e0:	74 1b                	je     8011fd <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f2:	89 df                	mov    %ebx,%edi
+  8011f4:	89 de                	mov    %ebx,%esi
+  8011f6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5f                   	pop    %edi
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801202:	8b 55 08             	mov    0x8(%ebp),%edx
+  801205:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801208:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80120d:	89 df                	mov    %ebx,%edi
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	8d 35 1a 12 80 00    	lea    0x80121a,%esi
+  801218:	0f 34                	sysenter
+  80121a:	5d                   	pop    %ebp
+		goto out;
+  80121b:	eb db                	jmp    8011f8 <sys_ipc_recv_until+0x25>
+
+0080121d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801223:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80122a:	74 19                	je     801245 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80122c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801231:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801236:	89 d1                	mov    %edx,%ecx
+  801238:	89 d3                	mov    %edx,%ebx
+  80123a:	89 d7                	mov    %edx,%edi
+  80123c:	89 d6                	mov    %edx,%esi
+  80123e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801240:	5b                   	pop    %ebx
+  801241:	5e                   	pop    %esi
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80124f:	89 d1                	mov    %edx,%ecx
+  801251:	89 d3                	mov    %edx,%ebx
+  801253:	89 d7                	mov    %edx,%edi
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	8d 35 60 12 80 00    	lea    0x801260,%esi
+  80125e:	0f 34                	sysenter
+  801260:	5d                   	pop    %ebp
+		goto out;
+  801261:	eb dd                	jmp    801240 <sys_time_msec+0x23>
+
+00801263 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801269:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801270:	74 1a                	je     80128c <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801272:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801277:	b8 10 00 00 00       	mov    $0x10,%eax
+  80127c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127f:	89 cb                	mov    %ecx,%ebx
+  801281:	89 cf                	mov    %ecx,%edi
+  801283:	89 ce                	mov    %ecx,%esi
+  801285:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801287:	5b                   	pop    %ebx
+  801288:	5e                   	pop    %esi
+  801289:	5f                   	pop    %edi
+  80128a:	5d                   	pop    %ebp
+  80128b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801294:	b8 10 00 00 00       	mov    $0x10,%eax
+  801299:	89 cb                	mov    %ecx,%ebx
+  80129b:	89 cf                	mov    %ecx,%edi
+  80129d:	55                   	push   %ebp
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	8d 35 a8 12 80 00    	lea    0x8012a8,%esi
+  8012a6:	0f 34                	sysenter
+  8012a8:	5d                   	pop    %ebp
+		goto out;
+  8012a9:	eb dc                	jmp    801287 <sys_sleep_until+0x24>
+
+008012ab <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012ab:	55                   	push   %ebp
+  8012ac:	89 e5                	mov    %esp,%ebp
+  8012ae:	57                   	push   %edi
+  8012af:	56                   	push   %esi
+  8012b0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012b1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012b8:	74 1a                	je     8012d4 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8012ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012bf:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c7:	89 cb                	mov    %ecx,%ebx
+  8012c9:	89 cf                	mov    %ecx,%edi
+  8012cb:	89 ce                	mov    %ecx,%esi
+  8012cd:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5e                   	pop    %esi
+  8012d1:	5f                   	pop    %edi
+  8012d2:	5d                   	pop    %ebp
+  8012d3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012dc:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012e1:	89 cb                	mov    %ecx,%ebx
+  8012e3:	89 cf                	mov    %ecx,%edi
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	8d 35 f0 12 80 00    	lea    0x8012f0,%esi
+  8012ee:	0f 34                	sysenter
+  8012f0:	5d                   	pop    %ebp
+		goto out;
+  8012f1:	eb dc                	jmp    8012cf <sys_env_print_stats+0x24>
+
+008012f3 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  8012f6:	57                   	push   %edi
+  8012f7:	56                   	push   %esi
+  8012f8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012f9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801300:	74 1b                	je     80131d <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801302:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801307:	b8 19 00 00 00       	mov    $0x19,%eax
+  80130c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801312:	89 df                	mov    %ebx,%edi
+  801314:	89 de                	mov    %ebx,%esi
+  801316:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801318:	5b                   	pop    %ebx
+  801319:	5e                   	pop    %esi
+  80131a:	5f                   	pop    %edi
+  80131b:	5d                   	pop    %ebp
+  80131c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80131d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801322:	8b 55 08             	mov    0x8(%ebp),%edx
+  801325:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801328:	b8 19 00 00 00       	mov    $0x19,%eax
+  80132d:	89 df                	mov    %ebx,%edi
+  80132f:	55                   	push   %ebp
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	8d 35 3a 13 80 00    	lea    0x80133a,%esi
+  801338:	0f 34                	sysenter
+  80133a:	5d                   	pop    %ebp
+		goto out;
+  80133b:	eb db                	jmp    801318 <sys_perf+0x25>
+
+0080133d <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80133d:	55                   	push   %ebp
+  80133e:	89 e5                	mov    %esp,%ebp
+  801340:	57                   	push   %edi
+  801341:	56                   	push   %esi
+  801342:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801343:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80134a:	74 19                	je     801365 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80134c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801351:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801356:	89 d1                	mov    %edx,%ecx
+  801358:	89 d3                	mov    %edx,%ebx
+  80135a:	89 d7                	mov    %edx,%edi
+  80135c:	89 d6                	mov    %edx,%esi
+  80135e:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801360:	5b                   	pop    %ebx
+  801361:	5e                   	pop    %esi
+  801362:	5f                   	pop    %edi
+  801363:	5d                   	pop    %ebp
+  801364:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801365:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80136f:	89 d1                	mov    %edx,%ecx
+  801371:	89 d3                	mov    %edx,%ebx
+  801373:	89 d7                	mov    %edx,%edi
+  801375:	55                   	push   %ebp
+  801376:	89 e5                	mov    %esp,%ebp
+  801378:	8d 35 80 13 80 00    	lea    0x801380,%esi
+  80137e:	0f 34                	sysenter
+  801380:	5d                   	pop    %ebp
+		goto out;
+  801381:	eb dd                	jmp    801360 <sys_fork+0x23>
+
+00801383 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  801386:	57                   	push   %edi
+  801387:	56                   	push   %esi
+  801388:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801389:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801390:	74 1c                	je     8013ae <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801392:	be 00 00 00 00       	mov    $0x0,%esi
+  801397:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80139c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a5:	89 f7                	mov    %esi,%edi
+  8013a7:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013a9:	5b                   	pop    %ebx
+  8013aa:	5e                   	pop    %esi
+  8013ab:	5f                   	pop    %edi
+  8013ac:	5d                   	pop    %ebp
+  8013ad:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	8d 35 cc 13 80 00    	lea    0x8013cc,%esi
+  8013ca:	0f 34                	sysenter
+  8013cc:	5d                   	pop    %ebp
+		goto out;
+  8013cd:	eb da                	jmp    8013a9 <sys_thread_create+0x26>
+
+008013cf <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	57                   	push   %edi
+  8013d3:	56                   	push   %esi
+  8013d4:	53                   	push   %ebx
+  8013d5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013d8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013df:	74 24                	je     801405 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013e1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	7f 27                	jg     801424 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5f                   	pop    %edi
+  801403:	5d                   	pop    %ebp
+  801404:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801405:	8b 55 08             	mov    0x8(%ebp),%edx
+  801408:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801410:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801413:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801416:	55                   	push   %ebp
+  801417:	89 e5                	mov    %esp,%ebp
+  801419:	8d 35 21 14 80 00    	lea    0x801421,%esi
+  80141f:	0f 34                	sysenter
+  801421:	5d                   	pop    %ebp
+		goto out;
+  801422:	eb d5                	jmp    8013f9 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801424:	83 ec 0c             	sub    $0xc,%esp
+  801427:	50                   	push   %eax
+  801428:	6a 1f                	push   $0x1f
+  80142a:	68 2b 37 80 00       	push   $0x80372b
+  80142f:	6a 3f                	push   $0x3f
+  801431:	68 48 37 80 00       	push   $0x803748
+  801436:	e8 6c ed ff ff       	call   8001a7 <_panic>
+
+0080143b <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+  801441:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801444:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80144b:	74 23                	je     801470 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80144d:	be 00 00 00 00       	mov    $0x0,%esi
+  801452:	b8 20 00 00 00       	mov    $0x20,%eax
+  801457:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801460:	89 f7                	mov    %esi,%edi
+  801462:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801464:	85 c0                	test   %eax,%eax
+  801466:	7f 29                	jg     801491 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801468:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146b:	5b                   	pop    %ebx
+  80146c:	5e                   	pop    %esi
+  80146d:	5f                   	pop    %edi
+  80146e:	5d                   	pop    %ebp
+  80146f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801470:	8b 55 08             	mov    0x8(%ebp),%edx
+  801473:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801476:	b8 20 00 00 00       	mov    $0x20,%eax
+  80147b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801480:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801483:	55                   	push   %ebp
+  801484:	89 e5                	mov    %esp,%ebp
+  801486:	8d 35 8e 14 80 00    	lea    0x80148e,%esi
+  80148c:	0f 34                	sysenter
+  80148e:	5d                   	pop    %ebp
+		goto out;
+  80148f:	eb d3                	jmp    801464 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801491:	83 ec 0c             	sub    $0xc,%esp
+  801494:	50                   	push   %eax
+  801495:	6a 20                	push   $0x20
+  801497:	68 2b 37 80 00       	push   $0x80372b
+  80149c:	6a 3f                	push   $0x3f
+  80149e:	68 48 37 80 00       	push   $0x803748
+  8014a3:	e8 ff ec ff ff       	call   8001a7 <_panic>
+
+008014a8 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	57                   	push   %edi
+  8014ac:	56                   	push   %esi
+  8014ad:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ae:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014b5:	74 1b                	je     8014d2 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8014b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c7:	89 df                	mov    %ebx,%edi
+  8014c9:	89 de                	mov    %ebx,%esi
+  8014cb:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014cd:	5b                   	pop    %ebx
+  8014ce:	5e                   	pop    %esi
+  8014cf:	5f                   	pop    %edi
+  8014d0:	5d                   	pop    %ebp
+  8014d1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014dd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014e2:	89 df                	mov    %ebx,%edi
+  8014e4:	55                   	push   %ebp
+  8014e5:	89 e5                	mov    %esp,%ebp
+  8014e7:	8d 35 ef 14 80 00    	lea    0x8014ef,%esi
+  8014ed:	0f 34                	sysenter
+  8014ef:	5d                   	pop    %ebp
+		goto out;
+  8014f0:	eb db                	jmp    8014cd <sys_batch+0x25>
+
+008014f2 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014f2:	55                   	push   %ebp
+  8014f3:	89 e5                	mov    %esp,%ebp
+  8014f5:	57                   	push   %edi
+  8014f6:	56                   	push   %esi
+  8014f7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014f8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ff:	74 1a                	je     80151b <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801501:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801506:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80150b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150e:	89 cb                	mov    %ecx,%ebx
+  801510:	89 cf                	mov    %ecx,%edi
+  801512:	89 ce                	mov    %ecx,%esi
+  801514:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801516:	5b                   	pop    %ebx
+  801517:	5e                   	pop    %esi
+  801518:	5f                   	pop    %edi
+  801519:	5d                   	pop    %ebp
+  80151a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80151b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801523:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801528:	89 cb                	mov    %ecx,%ebx
+  80152a:	89 cf                	mov    %ecx,%edi
+  80152c:	55                   	push   %ebp
+  80152d:	89 e5                	mov    %esp,%ebp
+  80152f:	8d 35 37 15 80 00    	lea    0x801537,%esi
+  801535:	0f 34                	sysenter
+  801537:	5d                   	pop    %ebp
+		goto out;
+  801538:	eb dc                	jmp    801516 <sys_trace_ctl+0x24>
+
+0080153a <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	57                   	push   %edi
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801540:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801547:	74 1c                	je     801565 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801549:	be 00 00 00 00       	mov    $0x0,%esi
+  80154e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801553:	8b 55 08             	mov    0x8(%ebp),%edx
+  801556:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801559:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80155c:	89 f7                	mov    %esi,%edi
+  80155e:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5f                   	pop    %edi
+  801563:	5d                   	pop    %ebp
+  801564:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801565:	8b 55 08             	mov    0x8(%ebp),%edx
+  801568:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801570:	bf 00 00 00 00       	mov    $0x0,%edi
+  801575:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801578:	55                   	push   %ebp
+  801579:	89 e5                	mov    %esp,%ebp
+  80157b:	8d 35 83 15 80 00    	lea    0x801583,%esi
+  801581:	0f 34                	sysenter
+  801583:	5d                   	pop    %ebp
+		goto out;
+  801584:	eb da                	jmp    801560 <sys_trace_read+0x26>
+
+00801586 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801586:	55                   	push   %ebp
+  801587:	89 e5                	mov    %esp,%ebp
+  801589:	57                   	push   %edi
+  80158a:	56                   	push   %esi
+  80158b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80158c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801593:	74 1c                	je     8015b1 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801595:	be 00 00 00 00       	mov    $0x0,%esi
+  80159a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80159f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a8:	89 f7                	mov    %esi,%edi
+  8015aa:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015ac:	5b                   	pop    %ebx
+  8015ad:	5e                   	pop    %esi
+  8015ae:	5f                   	pop    %edi
+  8015af:	5d                   	pop    %ebp
+  8015b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b7:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	8d 35 cf 15 80 00    	lea    0x8015cf,%esi
+  8015cd:	0f 34                	sysenter
+  8015cf:	5d                   	pop    %ebp
+		goto out;
+  8015d0:	eb da                	jmp    8015ac <sys_meminfo+0x26>
+
+008015d2 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015d2:	55                   	push   %ebp
+  8015d3:	89 e5                	mov    %esp,%ebp
+  8015d5:	57                   	push   %edi
+  8015d6:	56                   	push   %esi
+  8015d7:	53                   	push   %ebx
+  8015d8:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015db:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015df:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015e6:	74 1f                	je     801607 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ed:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f5:	89 df                	mov    %ebx,%edi
+  8015f7:	89 de                	mov    %ebx,%esi
+  8015f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015fb:	85 c0                	test   %eax,%eax
+  8015fd:	7f 25                	jg     801624 <sys_env_set_ksm+0x52>
+}
+  8015ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801602:	5b                   	pop    %ebx
+  801603:	5e                   	pop    %esi
+  801604:	5f                   	pop    %edi
+  801605:	5d                   	pop    %ebp
+  801606:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801607:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160f:	b8 22 00 00 00       	mov    $0x22,%eax
+  801614:	89 df                	mov    %ebx,%edi
+  801616:	55                   	push   %ebp
+  801617:	89 e5                	mov    %esp,%ebp
+  801619:	8d 35 21 16 80 00    	lea    0x801621,%esi
+  80161f:	0f 34                	sysenter
+  801621:	5d                   	pop    %ebp
+		goto out;
+  801622:	eb d7                	jmp    8015fb <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801624:	83 ec 0c             	sub    $0xc,%esp
+  801627:	50                   	push   %eax
+  801628:	6a 22                	push   $0x22
+  80162a:	68 2b 37 80 00       	push   $0x80372b
+  80162f:	6a 3f                	push   $0x3f
+  801631:	68 48 37 80 00       	push   $0x803748
+  801636:	e8 6c eb ff ff       	call   8001a7 <_panic>
+
+0080163b <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80163b:	55                   	push   %ebp
+  80163c:	89 e5                	mov    %esp,%ebp
+  80163e:	57                   	push   %edi
+  80163f:	56                   	push   %esi
+  801640:	53                   	push   %ebx
+  801641:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801644:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801647:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80164e:	74 24                	je     801674 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801655:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80165a:	89 cb                	mov    %ecx,%ebx
+  80165c:	89 cf                	mov    %ecx,%edi
+  80165e:	89 ce                	mov    %ecx,%esi
+  801660:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801662:	85 c0                	test   %eax,%eax
+  801664:	7f 2a                	jg     801690 <sys_time_nsec+0x55>
+	return ns;
+}
+  801666:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801669:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80166c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166f:	5b                   	pop    %ebx
+  801670:	5e                   	pop    %esi
+  801671:	5f                   	pop    %edi
+  801672:	5d                   	pop    %ebp
+  801673:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801679:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80167e:	89 cb                	mov    %ecx,%ebx
+  801680:	89 cf                	mov    %ecx,%edi
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	8d 35 8d 16 80 00    	lea    0x80168d,%esi
+  80168b:	0f 34                	sysenter
+  80168d:	5d                   	pop    %ebp
+		goto out;
+  80168e:	eb d2                	jmp    801662 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801690:	83 ec 0c             	sub    $0xc,%esp
+  801693:	50                   	push   %eax
+  801694:	6a 0f                	push   $0xf
+  801696:	68 2b 37 80 00       	push   $0x80372b
+  80169b:	6a 3f                	push   $0x3f
+  80169d:	68 48 37 80 00       	push   $0x803748
+  8016a2:	e8 00 eb ff ff       	call   8001a7 <_panic>
+
+008016a7 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016a7:	55                   	push   %ebp
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	57                   	push   %edi
+  8016ab:	56                   	push   %esi
+  8016ac:	53                   	push   %ebx
+  8016ad:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016b0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016b7:	74 22                	je     8016db <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8016b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016be:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c9:	89 df                	mov    %ebx,%edi
+  8016cb:	89 de                	mov    %ebx,%esi
+  8016cd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	7f 28                	jg     8016fb <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d6:	5b                   	pop    %ebx
+  8016d7:	5e                   	pop    %esi
+  8016d8:	5f                   	pop    %edi
+  8016d9:	5d                   	pop    %ebp
+  8016da:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016eb:	89 df                	mov    %ebx,%edi
+  8016ed:	55                   	push   %ebp
+  8016ee:	89 e5                	mov    %esp,%ebp
+  8016f0:	8d 35 f8 16 80 00    	lea    0x8016f8,%esi
+  8016f6:	0f 34                	sysenter
+  8016f8:	5d                   	pop    %ebp
+		goto out;
+  8016f9:	eb d4                	jmp    8016cf <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016fb:	83 ec 0c             	sub    $0xc,%esp
+  8016fe:	50                   	push   %eax
+  8016ff:	6a 12                	push   $0x12
+  801701:	68 2b 37 80 00       	push   $0x80372b
+  801706:	6a 3f                	push   $0x3f
+  801708:	68 48 37 80 00       	push   $0x803748
+  80170d:	e8 95 ea ff ff       	call   8001a7 <_panic>
+
+00801712 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801712:	55                   	push   %ebp
+  801713:	89 e5                	mov    %esp,%ebp
+  801715:	57                   	push   %edi
+  801716:	56                   	push   %esi
+  801717:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801718:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80171f:	74 1b                	je     80173c <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801721:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801726:	b8 13 00 00 00       	mov    $0x13,%eax
+  80172b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801731:	89 df                	mov    %ebx,%edi
+  801733:	89 de                	mov    %ebx,%esi
+  801735:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801737:	5b                   	pop    %ebx
+  801738:	5e                   	pop    %esi
+  801739:	5f                   	pop    %edi
+  80173a:	5d                   	pop    %ebp
+  80173b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80173c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801741:	8b 55 08             	mov    0x8(%ebp),%edx
+  801744:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801747:	b8 13 00 00 00       	mov    $0x13,%eax
+  80174c:	89 df                	mov    %ebx,%edi
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	8d 35 59 17 80 00    	lea    0x801759,%esi
+  801757:	0f 34                	sysenter
+  801759:	5d                   	pop    %ebp
+		goto out;
+  80175a:	eb db                	jmp    801737 <sys_e1000_receive+0x25>
+
+0080175c <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	57                   	push   %edi
+  801760:	56                   	push   %esi
+  801761:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801762:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801769:	74 1b                	je     801786 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80176b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801770:	b8 14 00 00 00       	mov    $0x14,%eax
+  801775:	8b 55 08             	mov    0x8(%ebp),%edx
+  801778:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177b:	89 df                	mov    %ebx,%edi
+  80177d:	89 de                	mov    %ebx,%esi
+  80177f:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801781:	5b                   	pop    %ebx
+  801782:	5e                   	pop    %esi
+  801783:	5f                   	pop    %edi
+  801784:	5d                   	pop    %ebp
+  801785:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801786:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801791:	b8 14 00 00 00       	mov    $0x14,%eax
+  801796:	89 df                	mov    %ebx,%edi
+  801798:	55                   	push   %ebp
+  801799:	89 e5                	mov    %esp,%ebp
+  80179b:	8d 35 a3 17 80 00    	lea    0x8017a3,%esi
+  8017a1:	0f 34                	sysenter
+  8017a3:	5d                   	pop    %ebp
+		goto out;
+  8017a4:	eb db                	jmp    801781 <sys_e1000_read_hwaddr+0x25>
+
+008017a6 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	57                   	push   %edi
+  8017aa:	56                   	push   %esi
+  8017ab:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ac:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017b3:	74 1a                	je     8017cf <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8017b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017ba:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c2:	89 cb                	mov    %ecx,%ebx
+  8017c4:	89 cf                	mov    %ecx,%edi
+  8017c6:	89 ce                	mov    %ecx,%esi
+  8017c8:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017ca:	5b                   	pop    %ebx
+  8017cb:	5e                   	pop    %esi
+  8017cc:	5f                   	pop    %edi
+  8017cd:	5d                   	pop    %ebp
+  8017ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017d7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017dc:	89 cb                	mov    %ecx,%ebx
+  8017de:	89 cf                	mov    %ecx,%edi
+  8017e0:	55                   	push   %ebp
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	8d 35 eb 17 80 00    	lea    0x8017eb,%esi
+  8017e9:	0f 34                	sysenter
+  8017eb:	5d                   	pop    %ebp
+		goto out;
+  8017ec:	eb dc                	jmp    8017ca <sys_sb16_read_version+0x24>
+
+008017ee <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017ee:	55                   	push   %ebp
+  8017ef:	89 e5                	mov    %esp,%ebp
+  8017f1:	57                   	push   %edi
+  8017f2:	56                   	push   %esi
+  8017f3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017f4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017fb:	74 1b                	je     801818 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801802:	b8 16 00 00 00       	mov    $0x16,%eax
+  801807:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80180d:	89 df                	mov    %ebx,%edi
+  80180f:	89 de                	mov    %ebx,%esi
+  801811:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801813:	5b                   	pop    %ebx
+  801814:	5e                   	pop    %esi
+  801815:	5f                   	pop    %edi
+  801816:	5d                   	pop    %ebp
+  801817:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801818:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801820:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801823:	b8 16 00 00 00       	mov    $0x16,%eax
+  801828:	89 df                	mov    %ebx,%edi
+  80182a:	55                   	push   %ebp
+  80182b:	89 e5                	mov    %esp,%ebp
+  80182d:	8d 35 35 18 80 00    	lea    0x801835,%esi
+  801833:	0f 34                	sysenter
+  801835:	5d                   	pop    %ebp
+		goto out;
+  801836:	eb db                	jmp    801813 <sys_sb16_play+0x25>
+
+00801838 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	53                   	push   %ebx
+  80183c:	83 ec 04             	sub    $0x4,%esp
+  80183f:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801841:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801848:	f6 c4 04             	test   $0x4,%ah
+  80184b:	74 0c                	je     801859 <dupperm+0x21>
+  80184d:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801854:	f6 c4 08             	test   $0x8,%ah
+  801857:	75 62                	jne    8018bb <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801859:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801860:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801865:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80186b:	74 19                	je     801886 <dupperm+0x4e>
+  80186d:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801874:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801879:	83 f8 01             	cmp    $0x1,%eax
+  80187c:	19 c0                	sbb    %eax,%eax
+  80187e:	25 00 08 00 00       	and    $0x800,%eax
+  801883:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801886:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  80188d:	89 c1                	mov    %eax,%ecx
+  80188f:	80 cd 04             	or     $0x4,%ch
+  801892:	f6 c7 04             	test   $0x4,%bh
+  801895:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801898:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80189f:	f6 c1 02             	test   $0x2,%cl
+  8018a2:	74 12                	je     8018b6 <dupperm+0x7e>
+  8018a4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  8018ab:	89 c2                	mov    %eax,%edx
+  8018ad:	83 ca 02             	or     $0x2,%edx
+  8018b0:	f6 c5 04             	test   $0x4,%ch
+  8018b3:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  8018b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b9:	c9                   	leave
+  8018ba:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8018bb:	68 58 37 80 00       	push   $0x803758
+  8018c0:	68 f0 37 80 00       	push   $0x8037f0
+  8018c5:	6a 39                	push   $0x39
+  8018c7:	68 05 38 80 00       	push   $0x803805
+  8018cc:	e8 d6 e8 ff ff       	call   8001a7 <_panic>
+
+008018d1 <pgfault>:
+{
+  8018d1:	55                   	push   %ebp
+  8018d2:	89 e5                	mov    %esp,%ebp
+  8018d4:	53                   	push   %ebx
+  8018d5:	83 ec 04             	sub    $0x4,%esp
+  8018d8:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8018db:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8018dd:	89 c3                	mov    %eax,%ebx
+  8018df:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8018e5:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8018e9:	74 6d                	je     801958 <pgfault+0x87>
+  8018eb:	89 da                	mov    %ebx,%edx
+  8018ed:	c1 ea 16             	shr    $0x16,%edx
+  8018f0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018f7:	f6 c2 80             	test   $0x80,%dl
+  8018fa:	75 5c                	jne    801958 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8018fc:	c1 e8 0c             	shr    $0xc,%eax
+  8018ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801906:	f6 c4 08             	test   $0x8,%ah
+  801909:	74 4d                	je     801958 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  80190b:	83 ec 04             	sub    $0x4,%esp
+  80190e:	6a 07                	push   $0x7
+  801910:	68 00 f0 7f 00       	push   $0x7ff000
+  801915:	6a 00                	push   $0x0
+  801917:	e8 a6 f4 ff ff       	call   800dc2 <sys_page_alloc>
+  80191c:	83 c4 10             	add    $0x10,%esp
+  80191f:	85 c0                	test   %eax,%eax
+  801921:	78 49                	js     80196c <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801923:	83 ec 04             	sub    $0x4,%esp
+  801926:	68 00 10 00 00       	push   $0x1000
+  80192b:	53                   	push   %ebx
+  80192c:	68 00 f0 7f 00       	push   $0x7ff000
+  801931:	e8 1a f1 ff ff       	call   800a50 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801936:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80193d:	53                   	push   %ebx
+  80193e:	6a 00                	push   $0x0
+  801940:	68 00 f0 7f 00       	push   $0x7ff000
+  801945:	6a 00                	push   $0x0
+  801947:	e8 e3 f4 ff ff       	call   800e2f <sys_page_map>
+  80194c:	83 c4 20             	add    $0x20,%esp
+  80194f:	85 c0                	test   %eax,%eax
+  801951:	78 2d                	js     801980 <pgfault+0xaf>
+}
+  801953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801956:	c9                   	leave
+  801957:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801958:	83 ec 04             	sub    $0x4,%esp
+  80195b:	68 10 38 80 00       	push   $0x803810
+  801960:	6a 1e                	push   $0x1e
+  801962:	68 05 38 80 00       	push   $0x803805
+  801967:	e8 3b e8 ff ff       	call   8001a7 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  80196c:	83 ec 04             	sub    $0x4,%esp
+  80196f:	68 8c 37 80 00       	push   $0x80378c
+  801974:	6a 29                	push   $0x29
+  801976:	68 05 38 80 00       	push   $0x803805
+  80197b:	e8 27 e8 ff ff       	call   8001a7 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801980:	50                   	push   %eax
+  801981:	68 c0 37 80 00       	push   $0x8037c0
+  801986:	6a 2e                	push   $0x2e
+  801988:	68 05 38 80 00       	push   $0x803805
+  80198d:	e8 15 e8 ff ff       	call   8001a7 <_panic>
+
+00801992 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801992:	55                   	push   %ebp
+  801993:	89 e5                	mov    %esp,%ebp
+  801995:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801998:	ff 75 0c             	push   0xc(%ebp)
+  80199b:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80199e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8019a5:	e8 23 f3 ff ff       	call   800ccd <sys_env_destroy>
+}
+  8019aa:	83 c4 10             	add    $0x10,%esp
+  8019ad:	c9                   	leave
+  8019ae:	c3                   	ret
+
+008019af <ufork>:
+{
+  8019af:	55                   	push   %ebp
+  8019b0:	89 e5                	mov    %esp,%ebp
+  8019b2:	57                   	push   %edi
+  8019b3:	56                   	push   %esi
+  8019b4:	53                   	push   %ebx
+  8019b5:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8019bb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019c0:	cd 30                	int    $0x30
+  8019c2:	89 c6                	mov    %eax,%esi
+  8019c4:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  8019ca:	85 c0                	test   %eax,%eax
+  8019cc:	78 56                	js     801a24 <ufork+0x75>
+	if (pid > 0) {
+  8019ce:	0f 8e b3 02 00 00    	jle    801c87 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  8019d4:	83 ec 0c             	sub    $0xc,%esp
+  8019d7:	68 d1 18 80 00       	push   $0x8018d1
+  8019dc:	e8 58 17 00 00       	call   803139 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  8019e1:	83 c4 08             	add    $0x8,%esp
+  8019e4:	68 a0 31 80 00       	push   $0x8031a0
+  8019e9:	56                   	push   %esi
+  8019ea:	e8 ef f5 ff ff       	call   800fde <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  8019ef:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  8019f5:	89 1c 24             	mov    %ebx,(%esp)
+  8019f8:	e8 21 03 00 00       	call   801d1e <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  8019fd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801a04:	6a 07                	push   $0x7
+  801a06:	68 00 f0 bf ee       	push   $0xeebff000
+  801a0b:	56                   	push   %esi
+  801a0c:	53                   	push   %ebx
+  801a0d:	e8 8d 04 00 00       	call   801e9f <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a12:	83 c4 20             	add    $0x20,%esp
+  801a15:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a1a:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801a20:	89 fe                	mov    %edi,%esi
+  801a22:	eb 22                	jmp    801a46 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801a24:	50                   	push   %eax
+  801a25:	68 29 38 80 00       	push   $0x803829
+  801a2a:	68 a9 00 00 00       	push   $0xa9
+  801a2f:	68 05 38 80 00       	push   $0x803805
+  801a34:	e8 6e e7 ff ff       	call   8001a7 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801a39:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801a3f:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801a44:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a46:	89 f7                	mov    %esi,%edi
+  801a48:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801a4e:	0f 87 e9 01 00 00    	ja     801c3d <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801a54:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801a5a:	85 f6                	test   %esi,%esi
+  801a5c:	0f 49 d6             	cmovns %esi,%edx
+  801a5f:	c1 fa 0a             	sar    $0xa,%edx
+  801a62:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801a69:	f6 c1 01             	test   $0x1,%cl
+  801a6c:	74 cb                	je     801a39 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801a6e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a75:	f6 c2 80             	test   $0x80,%dl
+  801a78:	75 17                	jne    801a91 <ufork+0xe2>
+			j = i + 1;
+  801a7a:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801a7d:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801a84:	f6 c2 01             	test   $0x1,%dl
+  801a87:	0f 85 f3 00 00 00    	jne    801b80 <ufork+0x1d1>
+			j = i + 1;
+  801a8d:	89 de                	mov    %ebx,%esi
+  801a8f:	eb b5                	jmp    801a46 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801a91:	89 fb                	mov    %edi,%ebx
+  801a93:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801a96:	89 d8                	mov    %ebx,%eax
+  801a98:	c1 e8 16             	shr    $0x16,%eax
+  801a9b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801aa2:	89 c2                	mov    %eax,%edx
+  801aa4:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801aaa:	25 02 04 00 00       	and    $0x402,%eax
+  801aaf:	83 f8 02             	cmp    $0x2,%eax
+  801ab2:	74 31                	je     801ae5 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801ab4:	83 ec 04             	sub    $0x4,%esp
+  801ab7:	6a 01                	push   $0x1
+  801ab9:	52                   	push   %edx
+  801aba:	53                   	push   %ebx
+  801abb:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801ac1:	53                   	push   %ebx
+  801ac2:	6a 00                	push   $0x0
+  801ac4:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801aca:	50                   	push   %eax
+  801acb:	e8 fa 03 00 00       	call   801eca <batch_map>
+		return;
+  801ad0:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801ad3:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801ad9:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801ade:	89 c6                	mov    %eax,%esi
+				continue;
+  801ae0:	e9 61 ff ff ff       	jmp    801a46 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801ae5:	83 ec 04             	sub    $0x4,%esp
+  801ae8:	80 ca 80             	or     $0x80,%dl
+  801aeb:	52                   	push   %edx
+  801aec:	53                   	push   %ebx
+  801aed:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801af3:	e8 ca f2 ff ff       	call   800dc2 <sys_page_alloc>
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 5d                	js     801b5c <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801aff:	83 ec 0c             	sub    $0xc,%esp
+  801b02:	6a 07                	push   $0x7
+  801b04:	68 00 00 40 00       	push   $0x400000
+  801b09:	6a 00                	push   $0x0
+  801b0b:	53                   	push   %ebx
+  801b0c:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b12:	e8 18 f3 ff ff       	call   800e2f <sys_page_map>
+  801b17:	83 c4 20             	add    $0x20,%esp
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	78 50                	js     801b6e <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801b1e:	83 ec 04             	sub    $0x4,%esp
+  801b21:	68 00 00 40 00       	push   $0x400000
+  801b26:	53                   	push   %ebx
+  801b27:	68 00 00 40 00       	push   $0x400000
+  801b2c:	e8 1f ef ff ff       	call   800a50 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801b31:	83 c4 08             	add    $0x8,%esp
+  801b34:	68 00 00 40 00       	push   $0x400000
+  801b39:	6a 00                	push   $0x0
+  801b3b:	e8 5d f3 ff ff       	call   800e9d <sys_page_unmap>
+  801b40:	83 c4 10             	add    $0x10,%esp
+  801b43:	85 c0                	test   %eax,%eax
+  801b45:	79 8c                	jns    801ad3 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801b47:	50                   	push   %eax
+  801b48:	68 5d 38 80 00       	push   $0x80385d
+  801b4d:	68 81 00 00 00       	push   $0x81
+  801b52:	68 05 38 80 00       	push   $0x803805
+  801b57:	e8 4b e6 ff ff       	call   8001a7 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801b5c:	50                   	push   %eax
+  801b5d:	68 39 38 80 00       	push   $0x803839
+  801b62:	6a 7c                	push   $0x7c
+  801b64:	68 05 38 80 00       	push   $0x803805
+  801b69:	e8 39 e6 ff ff       	call   8001a7 <_panic>
+		panic("sys_page_map: %e", r);
+  801b6e:	50                   	push   %eax
+  801b6f:	68 4c 38 80 00       	push   $0x80384c
+  801b74:	6a 7e                	push   $0x7e
+  801b76:	68 05 38 80 00       	push   $0x803805
+  801b7b:	e8 27 e6 ff ff       	call   8001a7 <_panic>
+  801b80:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801b86:	eb 22                	jmp    801baa <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801b88:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801b8f:	a8 01                	test   $0x1,%al
+  801b91:	74 35                	je     801bc8 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801b93:	89 d8                	mov    %ebx,%eax
+  801b95:	e8 9e fc ff ff       	call   801838 <dupperm>
+  801b9a:	89 c6                	mov    %eax,%esi
+  801b9c:	89 f8                	mov    %edi,%eax
+  801b9e:	e8 95 fc ff ff       	call   801838 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801ba3:	39 c6                	cmp    %eax,%esi
+  801ba5:	75 21                	jne    801bc8 <ufork+0x219>
+				j++;
+  801ba7:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801baa:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801bb0:	74 16                	je     801bc8 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801bb2:	89 d8                	mov    %ebx,%eax
+  801bb4:	c1 e8 0a             	shr    $0xa,%eax
+  801bb7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bbe:	25 81 00 00 00       	and    $0x81,%eax
+  801bc3:	83 f8 01             	cmp    $0x1,%eax
+  801bc6:	74 c0                	je     801b88 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801bc8:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801bce:	89 d8                	mov    %ebx,%eax
+  801bd0:	29 f0                	sub    %esi,%eax
+  801bd2:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801bd8:	89 fe                	mov    %edi,%esi
+  801bda:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801bdd:	89 f8                	mov    %edi,%eax
+  801bdf:	e8 54 fc ff ff       	call   801838 <dupperm>
+  801be4:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801be6:	83 ec 08             	sub    $0x8,%esp
+  801be9:	6a 02                	push   $0x2
+  801beb:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801bf1:	51                   	push   %ecx
+  801bf2:	e8 95 01 00 00       	call   801d8c <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801bf7:	83 c4 0c             	add    $0xc,%esp
+  801bfa:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801c00:	57                   	push   %edi
+  801c01:	56                   	push   %esi
+  801c02:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c08:	56                   	push   %esi
+  801c09:	6a 00                	push   $0x0
+  801c0b:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801c11:	51                   	push   %ecx
+  801c12:	e8 b3 02 00 00       	call   801eca <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801c17:	83 c4 1c             	add    $0x1c,%esp
+  801c1a:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801c20:	57                   	push   %edi
+  801c21:	56                   	push   %esi
+  801c22:	6a 00                	push   $0x0
+  801c24:	56                   	push   %esi
+  801c25:	6a 00                	push   $0x0
+  801c27:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801c2d:	50                   	push   %eax
+  801c2e:	e8 97 02 00 00       	call   801eca <batch_map>
+	return 0;
+  801c33:	83 c4 20             	add    $0x20,%esp
+  801c36:	89 de                	mov    %ebx,%esi
+  801c38:	e9 09 fe ff ff       	jmp    801a46 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801c3d:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801c43:	83 ec 04             	sub    $0x4,%esp
+  801c46:	6a 02                	push   $0x2
+  801c48:	56                   	push   %esi
+  801c49:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801c4f:	53                   	push   %ebx
+  801c50:	e8 c9 02 00 00       	call   801f1e <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801c55:	89 1c 24             	mov    %ebx,(%esp)
+  801c58:	e8 dd 00 00 00       	call   801d3a <batch_flush>
+  801c5d:	83 c4 10             	add    $0x10,%esp
+  801c60:	85 c0                	test   %eax,%eax
+  801c62:	78 0e                	js     801c72 <ufork+0x2c3>
+}
+  801c64:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801c6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c6d:	5b                   	pop    %ebx
+  801c6e:	5e                   	pop    %esi
+  801c6f:	5f                   	pop    %edi
+  801c70:	5d                   	pop    %ebp
+  801c71:	c3                   	ret
+			panic("fork: %e", r);
+  801c72:	50                   	push   %eax
+  801c73:	68 30 38 80 00       	push   $0x803830
+  801c78:	68 d7 00 00 00       	push   $0xd7
+  801c7d:	68 05 38 80 00       	push   $0x803805
+  801c82:	e8 20 e5 ff ff       	call   8001a7 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801c87:	e8 aa f0 ff ff       	call   800d36 <sys_getenvid>
+  801c8c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c91:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c97:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c9c:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801ca1:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801ca8:	00 00 00 
+  801cab:	eb b7                	jmp    801c64 <ufork+0x2b5>
+
+00801cad <fork>:
+{
+  801cad:	55                   	push   %ebp
+  801cae:	89 e5                	mov    %esp,%ebp
+  801cb0:	53                   	push   %ebx
+  801cb1:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801cb4:	68 d1 18 80 00       	push   $0x8018d1
+  801cb9:	e8 7b 14 00 00       	call   803139 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801cbe:	e8 7a f6 ff ff       	call   80133d <sys_fork>
+  801cc3:	89 c3                	mov    %eax,%ebx
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	78 09                	js     801cd5 <fork+0x28>
+	if (pid == 0)
+  801ccc:	74 1c                	je     801cea <fork+0x3d>
+}
+  801cce:	89 d8                	mov    %ebx,%eax
+  801cd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd3:	c9                   	leave
+  801cd4:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801cd5:	50                   	push   %eax
+  801cd6:	68 29 38 80 00       	push   $0x803829
+  801cdb:	68 ed 00 00 00       	push   $0xed
+  801ce0:	68 05 38 80 00       	push   $0x803805
+  801ce5:	e8 bd e4 ff ff       	call   8001a7 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801cea:	e8 47 f0 ff ff       	call   800d36 <sys_getenvid>
+  801cef:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cf4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cfa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801cff:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801d04:	eb c8                	jmp    801cce <fork+0x21>
+
+00801d06 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801d06:	55                   	push   %ebp
+  801d07:	89 e5                	mov    %esp,%ebp
+  801d09:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801d0c:	ff 75 0c             	push   0xc(%ebp)
+  801d0f:	ff 75 08             	push   0x8(%ebp)
+  801d12:	68 92 19 80 00       	push   $0x801992
+  801d17:	e8 67 f6 ff ff       	call   801383 <sys_thread_create>
+}
+  801d1c:	c9                   	leave
+  801d1d:	c3                   	ret
+
+00801d1e <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801d1e:	55                   	push   %ebp
+  801d1f:	89 e5                	mov    %esp,%ebp
+  801d21:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801d24:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801d2b:	00 00 00 
+	b->b_error = 0;
+  801d2e:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801d35:	00 00 00 
+}
+  801d38:	5d                   	pop    %ebp
+  801d39:	c3                   	ret
+
+00801d3a <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801d3a:	55                   	push   %ebp
+  801d3b:	89 e5                	mov    %esp,%ebp
+  801d3d:	53                   	push   %ebx
+  801d3e:	83 ec 04             	sub    $0x4,%esp
+  801d41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801d44:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	7e 09                	jle    801d57 <batch_flush+0x1d>
+  801d4e:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801d55:	74 15                	je     801d6c <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801d57:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801d5e:	00 00 00 
+	return b->b_error;
+  801d61:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801d67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d6a:	c9                   	leave
+  801d6b:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801d6c:	83 ec 08             	sub    $0x8,%esp
+  801d6f:	50                   	push   %eax
+  801d70:	53                   	push   %ebx
+  801d71:	e8 32 f7 ff ff       	call   8014a8 <sys_batch>
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	79 da                	jns    801d57 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801d7d:	f7 d8                	neg    %eax
+  801d7f:	0f b6 c0             	movzbl %al,%eax
+  801d82:	f7 d8                	neg    %eax
+  801d84:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801d8a:	eb cb                	jmp    801d57 <batch_flush+0x1d>
+
+00801d8c <batch_reserve>:
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	83 ec 08             	sub    $0x8,%esp
+  801d92:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801d95:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801d9b:	03 45 0c             	add    0xc(%ebp),%eax
+  801d9e:	83 f8 10             	cmp    $0x10,%eax
+  801da1:	7f 02                	jg     801da5 <batch_reserve+0x19>
+}
+  801da3:	c9                   	leave
+  801da4:	c3                   	ret
+		batch_flush(b);
+  801da5:	83 ec 0c             	sub    $0xc,%esp
+  801da8:	52                   	push   %edx
+  801da9:	e8 8c ff ff ff       	call   801d3a <batch_flush>
+  801dae:	83 c4 10             	add    $0x10,%esp
+}
+  801db1:	eb f0                	jmp    801da3 <batch_reserve+0x17>
+
+00801db3 <batch_next>:
+{
+  801db3:	55                   	push   %ebp
+  801db4:	89 e5                	mov    %esp,%ebp
+  801db6:	53                   	push   %ebx
+  801db7:	83 ec 04             	sub    $0x4,%esp
+  801dba:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801dbc:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801dc3:	74 28                	je     801ded <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801dc5:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801dcb:	8d 50 01             	lea    0x1(%eax),%edx
+  801dce:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801dd4:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801dd7:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801dd9:	83 ec 04             	sub    $0x4,%esp
+  801ddc:	6a 1c                	push   $0x1c
+  801dde:	6a 00                	push   $0x0
+  801de0:	53                   	push   %ebx
+  801de1:	e8 35 ec ff ff       	call   800a1b <memset>
+}
+  801de6:	89 d8                	mov    %ebx,%eax
+  801de8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801deb:	c9                   	leave
+  801dec:	c3                   	ret
+		batch_flush(b);
+  801ded:	83 ec 0c             	sub    $0xc,%esp
+  801df0:	50                   	push   %eax
+  801df1:	e8 44 ff ff ff       	call   801d3a <batch_flush>
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	eb ca                	jmp    801dc5 <batch_next+0x12>
+
+00801dfb <batch_page>:
+{
+  801dfb:	55                   	push   %ebp
+  801dfc:	89 e5                	mov    %esp,%ebp
+  801dfe:	57                   	push   %edi
+  801dff:	56                   	push   %esi
+  801e00:	53                   	push   %ebx
+  801e01:	83 ec 1c             	sub    $0x1c,%esp
+  801e04:	89 d3                	mov    %edx,%ebx
+  801e06:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801e08:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801e0e:	85 d2                	test   %edx,%edx
+  801e10:	74 50                	je     801e62 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801e12:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801e15:	01 c1                	add    %eax,%ecx
+  801e17:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801e1a:	75 46                	jne    801e62 <batch_page+0x67>
+  801e1c:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801e1f:	75 41                	jne    801e62 <batch_page+0x67>
+  801e21:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801e24:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801e27:	75 39                	jne    801e62 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801e29:	83 ea 01             	sub    $0x1,%edx
+  801e2c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801e2f:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801e32:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801e36:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801e39:	75 27                	jne    801e62 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801e3b:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801e3e:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801e42:	89 fa                	mov    %edi,%edx
+  801e44:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801e47:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801e4a:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801e4d:	39 55 08             	cmp    %edx,0x8(%ebp)
+  801e50:	75 10                	jne    801e62 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801e52:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  801e56:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e59:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  801e5d:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801e60:	74 2a                	je     801e8c <batch_page+0x91>
+	op = batch_next(b);
+  801e62:	e8 4c ff ff ff       	call   801db3 <batch_next>
+	op->bo_op = opcode;
+  801e67:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  801e69:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  801e6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e6f:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  801e72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e75:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  801e78:	8b 75 10             	mov    0x10(%ebp),%esi
+  801e7b:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  801e7e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801e81:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  801e84:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801e87:	89 78 14             	mov    %edi,0x14(%eax)
+  801e8a:	eb 0b                	jmp    801e97 <batch_page+0x9c>
+		op->bo_npages += npages;
+  801e8c:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  801e90:	03 7d 18             	add    0x18(%ebp),%edi
+  801e93:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  801e97:	83 c4 1c             	add    $0x1c,%esp
+  801e9a:	5b                   	pop    %ebx
+  801e9b:	5e                   	pop    %esi
+  801e9c:	5f                   	pop    %edi
+  801e9d:	5d                   	pop    %ebp
+  801e9e:	c3                   	ret
+
+00801e9f <batch_alloc>:
+{
+  801e9f:	55                   	push   %ebp
+  801ea0:	89 e5                	mov    %esp,%ebp
+  801ea2:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  801ea5:	ff 75 18             	push   0x18(%ebp)
+  801ea8:	ff 75 14             	push   0x14(%ebp)
+  801eab:	ff 75 10             	push   0x10(%ebp)
+  801eae:	ff 75 0c             	push   0xc(%ebp)
+  801eb1:	6a 00                	push   $0x0
+  801eb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec0:	e8 36 ff ff ff       	call   801dfb <batch_page>
+}
+  801ec5:	83 c4 20             	add    $0x20,%esp
+  801ec8:	c9                   	leave
+  801ec9:	c3                   	ret
+
+00801eca <batch_map>:
+{
+  801eca:	55                   	push   %ebp
+  801ecb:	89 e5                	mov    %esp,%ebp
+  801ecd:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  801ed0:	ff 75 20             	push   0x20(%ebp)
+  801ed3:	ff 75 1c             	push   0x1c(%ebp)
+  801ed6:	ff 75 18             	push   0x18(%ebp)
+  801ed9:	ff 75 14             	push   0x14(%ebp)
+  801edc:	ff 75 10             	push   0x10(%ebp)
+  801edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ee2:	ba 01 00 00 00       	mov    $0x1,%edx
+  801ee7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eea:	e8 0c ff ff ff       	call   801dfb <batch_page>
+}
+  801eef:	83 c4 20             	add    $0x20,%esp
+  801ef2:	c9                   	leave
+  801ef3:	c3                   	ret
+
+00801ef4 <batch_unmap>:
+{
+  801ef4:	55                   	push   %ebp
+  801ef5:	89 e5                	mov    %esp,%ebp
+  801ef7:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  801efa:	ff 75 14             	push   0x14(%ebp)
+  801efd:	6a 00                	push   $0x0
+  801eff:	ff 75 10             	push   0x10(%ebp)
+  801f02:	ff 75 0c             	push   0xc(%ebp)
+  801f05:	6a 00                	push   $0x0
+  801f07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f0c:	ba 02 00 00 00       	mov    $0x2,%edx
+  801f11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f14:	e8 e2 fe ff ff       	call   801dfb <batch_page>
+}
+  801f19:	83 c4 20             	add    $0x20,%esp
+  801f1c:	c9                   	leave
+  801f1d:	c3                   	ret
+
+00801f1e <batch_set_status>:
+{
+  801f1e:	55                   	push   %ebp
+  801f1f:	89 e5                	mov    %esp,%ebp
+  801f21:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  801f24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f27:	e8 87 fe ff ff       	call   801db3 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  801f2c:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  801f32:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f35:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  801f38:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f3b:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  801f3e:	c9                   	leave
+  801f3f:	c3                   	ret
+
+00801f40 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801f40:	55                   	push   %ebp
+  801f41:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f46:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f4b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801f4e:	5d                   	pop    %ebp
+  801f4f:	c3                   	ret
+
+00801f50 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801f50:	55                   	push   %ebp
+  801f51:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f56:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801f5b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f60:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801f65:	5d                   	pop    %ebp
+  801f66:	c3                   	ret
+
+00801f67 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801f67:	55                   	push   %ebp
+  801f68:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801f6a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801f6f:	eb 02                	jmp    801f73 <fd_alloc+0xc>
+  801f71:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801f73:	89 c2                	mov    %eax,%edx
+  801f75:	c1 ea 16             	shr    $0x16,%edx
+  801f78:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f7f:	f6 c2 01             	test   $0x1,%dl
+  801f82:	74 2b                	je     801faf <fd_alloc+0x48>
+  801f84:	89 c2                	mov    %eax,%edx
+  801f86:	c1 ea 0c             	shr    $0xc,%edx
+  801f89:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801f90:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801f96:	f6 c1 01             	test   $0x1,%cl
+  801f99:	74 14                	je     801faf <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801f9b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801fa1:	75 ce                	jne    801f71 <fd_alloc+0xa>
+  801fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801fa8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801fad:	eb 05                	jmp    801fb4 <fd_alloc+0x4d>
+			return 0;
+  801faf:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb7:	89 02                	mov    %eax,(%edx)
+}
+  801fb9:	89 c8                	mov    %ecx,%eax
+  801fbb:	5d                   	pop    %ebp
+  801fbc:	c3                   	ret
+
+00801fbd <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801fbd:	55                   	push   %ebp
+  801fbe:	89 e5                	mov    %esp,%ebp
+  801fc0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801fc3:	83 f8 1f             	cmp    $0x1f,%eax
+  801fc6:	77 30                	ja     801ff8 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801fc8:	c1 e0 0c             	shl    $0xc,%eax
+  801fcb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801fd0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801fd6:	f6 c2 01             	test   $0x1,%dl
+  801fd9:	74 24                	je     801fff <fd_lookup+0x42>
+  801fdb:	89 c2                	mov    %eax,%edx
+  801fdd:	c1 ea 0c             	shr    $0xc,%edx
+  801fe0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801fe7:	f6 c2 01             	test   $0x1,%dl
+  801fea:	74 1a                	je     802006 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801fec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fef:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ff6:	5d                   	pop    %ebp
+  801ff7:	c3                   	ret
+		return -E_INVAL;
+  801ff8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ffd:	eb f7                	jmp    801ff6 <fd_lookup+0x39>
+		return -E_INVAL;
+  801fff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802004:	eb f0                	jmp    801ff6 <fd_lookup+0x39>
+  802006:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80200b:	eb e9                	jmp    801ff6 <fd_lookup+0x39>
+
+0080200d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	53                   	push   %ebx
+  802011:	83 ec 04             	sub    $0x4,%esp
+  802014:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802017:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201c:	eb 03                	jmp    802021 <dev_lookup+0x14>
+  80201e:	83 c0 01             	add    $0x1,%eax
+  802021:	8b 1c 85 ec 38 80 00 	mov    0x8038ec(,%eax,4),%ebx
+  802028:	85 db                	test   %ebx,%ebx
+  80202a:	74 0b                	je     802037 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80202c:	39 13                	cmp    %edx,(%ebx)
+  80202e:	75 ee                	jne    80201e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802030:	b8 00 00 00 00       	mov    $0x0,%eax
+  802035:	eb 2e                	jmp    802065 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  802037:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802039:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80203e:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802044:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802049:	76 24                	jbe    80206f <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80204b:	8b 41 48             	mov    0x48(%ecx),%eax
+  80204e:	83 ec 04             	sub    $0x4,%esp
+  802051:	52                   	push   %edx
+  802052:	50                   	push   %eax
+  802053:	68 70 38 80 00       	push   $0x803870
+  802058:	e8 25 e2 ff ff       	call   800282 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80205d:	83 c4 10             	add    $0x10,%esp
+  802060:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802065:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802068:	89 1a                	mov    %ebx,(%edx)
+}
+  80206a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80206d:	c9                   	leave
+  80206e:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80206f:	c1 e8 10             	shr    $0x10,%eax
+  802072:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802078:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80207e:	eb cb                	jmp    80204b <dev_lookup+0x3e>
+
+00802080 <fd_close>:
+{
+  802080:	55                   	push   %ebp
+  802081:	89 e5                	mov    %esp,%ebp
+  802083:	57                   	push   %edi
+  802084:	56                   	push   %esi
+  802085:	53                   	push   %ebx
+  802086:	83 ec 24             	sub    $0x24,%esp
+  802089:	8b 75 08             	mov    0x8(%ebp),%esi
+  80208c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80208f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802092:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802093:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802099:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80209c:	50                   	push   %eax
+  80209d:	e8 1b ff ff ff       	call   801fbd <fd_lookup>
+  8020a2:	89 c3                	mov    %eax,%ebx
+  8020a4:	83 c4 10             	add    $0x10,%esp
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 05                	js     8020b0 <fd_close+0x30>
+	    || fd != fd2)
+  8020ab:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8020ae:	74 16                	je     8020c6 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8020b0:	89 f8                	mov    %edi,%eax
+  8020b2:	84 c0                	test   %al,%al
+  8020b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b9:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8020bc:	89 d8                	mov    %ebx,%eax
+  8020be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c1:	5b                   	pop    %ebx
+  8020c2:	5e                   	pop    %esi
+  8020c3:	5f                   	pop    %edi
+  8020c4:	5d                   	pop    %ebp
+  8020c5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8020c6:	83 ec 08             	sub    $0x8,%esp
+  8020c9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8020cc:	50                   	push   %eax
+  8020cd:	ff 36                	push   (%esi)
+  8020cf:	e8 39 ff ff ff       	call   80200d <dev_lookup>
+  8020d4:	89 c3                	mov    %eax,%ebx
+  8020d6:	83 c4 10             	add    $0x10,%esp
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	78 1a                	js     8020f7 <fd_close+0x77>
+		if (dev->dev_close)
+  8020dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020e0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8020e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8020e8:	85 c0                	test   %eax,%eax
+  8020ea:	74 0b                	je     8020f7 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8020ec:	83 ec 0c             	sub    $0xc,%esp
+  8020ef:	56                   	push   %esi
+  8020f0:	ff d0                	call   *%eax
+  8020f2:	89 c3                	mov    %eax,%ebx
+  8020f4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8020f7:	83 ec 08             	sub    $0x8,%esp
+  8020fa:	56                   	push   %esi
+  8020fb:	6a 00                	push   $0x0
+  8020fd:	e8 9b ed ff ff       	call   800e9d <sys_page_unmap>
+	return r;
+  802102:	83 c4 10             	add    $0x10,%esp
+  802105:	eb b5                	jmp    8020bc <fd_close+0x3c>
+
+00802107 <close>:
+
+int
+close(int fdnum)
+{
+  802107:	55                   	push   %ebp
+  802108:	89 e5                	mov    %esp,%ebp
+  80210a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80210d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802110:	50                   	push   %eax
+  802111:	ff 75 08             	push   0x8(%ebp)
+  802114:	e8 a4 fe ff ff       	call   801fbd <fd_lookup>
+  802119:	83 c4 10             	add    $0x10,%esp
+  80211c:	85 c0                	test   %eax,%eax
+  80211e:	79 02                	jns    802122 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802120:	c9                   	leave
+  802121:	c3                   	ret
+		return fd_close(fd, 1);
+  802122:	83 ec 08             	sub    $0x8,%esp
+  802125:	6a 01                	push   $0x1
+  802127:	ff 75 f4             	push   -0xc(%ebp)
+  80212a:	e8 51 ff ff ff       	call   802080 <fd_close>
+  80212f:	83 c4 10             	add    $0x10,%esp
+  802132:	eb ec                	jmp    802120 <close+0x19>
+
+00802134 <close_all>:
+
+void
+close_all(void)
+{
+  802134:	55                   	push   %ebp
+  802135:	89 e5                	mov    %esp,%ebp
+  802137:	53                   	push   %ebx
+  802138:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80213b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802140:	83 ec 0c             	sub    $0xc,%esp
+  802143:	53                   	push   %ebx
+  802144:	e8 be ff ff ff       	call   802107 <close>
+	for (i = 0; i < MAXFD; i++)
+  802149:	83 c3 01             	add    $0x1,%ebx
+  80214c:	83 c4 10             	add    $0x10,%esp
+  80214f:	83 fb 20             	cmp    $0x20,%ebx
+  802152:	75 ec                	jne    802140 <close_all+0xc>
+}
+  802154:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802157:	c9                   	leave
+  802158:	c3                   	ret
+
+00802159 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802159:	55                   	push   %ebp
+  80215a:	89 e5                	mov    %esp,%ebp
+  80215c:	57                   	push   %edi
+  80215d:	56                   	push   %esi
+  80215e:	53                   	push   %ebx
+  80215f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802162:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802165:	50                   	push   %eax
+  802166:	ff 75 08             	push   0x8(%ebp)
+  802169:	e8 4f fe ff ff       	call   801fbd <fd_lookup>
+  80216e:	89 c3                	mov    %eax,%ebx
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	85 c0                	test   %eax,%eax
+  802175:	78 7f                	js     8021f6 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802177:	83 ec 0c             	sub    $0xc,%esp
+  80217a:	ff 75 0c             	push   0xc(%ebp)
+  80217d:	e8 85 ff ff ff       	call   802107 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802182:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802185:	c1 e6 0c             	shl    $0xc,%esi
+  802188:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80218e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802191:	89 3c 24             	mov    %edi,(%esp)
+  802194:	e8 b7 fd ff ff       	call   801f50 <fd2data>
+  802199:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80219b:	89 34 24             	mov    %esi,(%esp)
+  80219e:	e8 ad fd ff ff       	call   801f50 <fd2data>
+  8021a3:	83 c4 10             	add    $0x10,%esp
+  8021a6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8021a9:	89 d8                	mov    %ebx,%eax
+  8021ab:	c1 e8 16             	shr    $0x16,%eax
+  8021ae:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021b5:	a8 01                	test   $0x1,%al
+  8021b7:	74 11                	je     8021ca <dup+0x71>
+  8021b9:	89 d8                	mov    %ebx,%eax
+  8021bb:	c1 e8 0c             	shr    $0xc,%eax
+  8021be:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8021c5:	f6 c2 01             	test   $0x1,%dl
+  8021c8:	75 36                	jne    802200 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8021ca:	89 f8                	mov    %edi,%eax
+  8021cc:	c1 e8 0c             	shr    $0xc,%eax
+  8021cf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021d6:	83 ec 0c             	sub    $0xc,%esp
+  8021d9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021de:	50                   	push   %eax
+  8021df:	56                   	push   %esi
+  8021e0:	6a 00                	push   $0x0
+  8021e2:	57                   	push   %edi
+  8021e3:	6a 00                	push   $0x0
+  8021e5:	e8 45 ec ff ff       	call   800e2f <sys_page_map>
+  8021ea:	89 c3                	mov    %eax,%ebx
+  8021ec:	83 c4 20             	add    $0x20,%esp
+  8021ef:	85 c0                	test   %eax,%eax
+  8021f1:	78 33                	js     802226 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8021f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8021f6:	89 d8                	mov    %ebx,%eax
+  8021f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021fb:	5b                   	pop    %ebx
+  8021fc:	5e                   	pop    %esi
+  8021fd:	5f                   	pop    %edi
+  8021fe:	5d                   	pop    %ebp
+  8021ff:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802200:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802207:	83 ec 0c             	sub    $0xc,%esp
+  80220a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80220f:	50                   	push   %eax
+  802210:	ff 75 d4             	push   -0x2c(%ebp)
+  802213:	6a 00                	push   $0x0
+  802215:	53                   	push   %ebx
+  802216:	6a 00                	push   $0x0
+  802218:	e8 12 ec ff ff       	call   800e2f <sys_page_map>
+  80221d:	89 c3                	mov    %eax,%ebx
+  80221f:	83 c4 20             	add    $0x20,%esp
+  802222:	85 c0                	test   %eax,%eax
+  802224:	79 a4                	jns    8021ca <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802226:	83 ec 08             	sub    $0x8,%esp
+  802229:	56                   	push   %esi
+  80222a:	6a 00                	push   $0x0
+  80222c:	e8 6c ec ff ff       	call   800e9d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802231:	83 c4 08             	add    $0x8,%esp
+  802234:	ff 75 d4             	push   -0x2c(%ebp)
+  802237:	6a 00                	push   $0x0
+  802239:	e8 5f ec ff ff       	call   800e9d <sys_page_unmap>
+	return r;
+  80223e:	83 c4 10             	add    $0x10,%esp
+  802241:	eb b3                	jmp    8021f6 <dup+0x9d>
+
+00802243 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802243:	55                   	push   %ebp
+  802244:	89 e5                	mov    %esp,%ebp
+  802246:	56                   	push   %esi
+  802247:	53                   	push   %ebx
+  802248:	83 ec 18             	sub    $0x18,%esp
+  80224b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80224e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802251:	50                   	push   %eax
+  802252:	53                   	push   %ebx
+  802253:	e8 65 fd ff ff       	call   801fbd <fd_lookup>
+  802258:	83 c4 10             	add    $0x10,%esp
+  80225b:	85 c0                	test   %eax,%eax
+  80225d:	78 3c                	js     80229b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80225f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802262:	83 ec 08             	sub    $0x8,%esp
+  802265:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802268:	50                   	push   %eax
+  802269:	ff 36                	push   (%esi)
+  80226b:	e8 9d fd ff ff       	call   80200d <dev_lookup>
+  802270:	83 c4 10             	add    $0x10,%esp
+  802273:	85 c0                	test   %eax,%eax
+  802275:	78 24                	js     80229b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802277:	8b 46 08             	mov    0x8(%esi),%eax
+  80227a:	83 e0 03             	and    $0x3,%eax
+  80227d:	83 f8 01             	cmp    $0x1,%eax
+  802280:	74 20                	je     8022a2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802282:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802285:	8b 40 08             	mov    0x8(%eax),%eax
+  802288:	85 c0                	test   %eax,%eax
+  80228a:	74 57                	je     8022e3 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80228c:	83 ec 04             	sub    $0x4,%esp
+  80228f:	ff 75 10             	push   0x10(%ebp)
+  802292:	ff 75 0c             	push   0xc(%ebp)
+  802295:	56                   	push   %esi
+  802296:	ff d0                	call   *%eax
+  802298:	83 c4 10             	add    $0x10,%esp
+}
+  80229b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80229e:	5b                   	pop    %ebx
+  80229f:	5e                   	pop    %esi
+  8022a0:	5d                   	pop    %ebp
+  8022a1:	c3                   	ret
+  8022a2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022a4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022a9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022af:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8022b4:	76 1c                	jbe    8022d2 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022b6:	8b 42 48             	mov    0x48(%edx),%eax
+  8022b9:	83 ec 04             	sub    $0x4,%esp
+  8022bc:	53                   	push   %ebx
+  8022bd:	50                   	push   %eax
+  8022be:	68 b1 38 80 00       	push   $0x8038b1
+  8022c3:	e8 ba df ff ff       	call   800282 <cprintf>
+		return -E_INVAL;
+  8022c8:	83 c4 10             	add    $0x10,%esp
+  8022cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022d0:	eb c9                	jmp    80229b <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8022d2:	c1 e8 10             	shr    $0x10,%eax
+  8022d5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8022db:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8022e1:	eb d3                	jmp    8022b6 <read+0x73>
+		return -E_NOT_SUPP;
+  8022e3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022e8:	eb b1                	jmp    80229b <read+0x58>
+
+008022ea <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8022ea:	55                   	push   %ebp
+  8022eb:	89 e5                	mov    %esp,%ebp
+  8022ed:	57                   	push   %edi
+  8022ee:	56                   	push   %esi
+  8022ef:	53                   	push   %ebx
+  8022f0:	83 ec 0c             	sub    $0xc,%esp
+  8022f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022f6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8022f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022fe:	eb 02                	jmp    802302 <readn+0x18>
+  802300:	01 c3                	add    %eax,%ebx
+  802302:	39 f3                	cmp    %esi,%ebx
+  802304:	73 21                	jae    802327 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802306:	83 ec 04             	sub    $0x4,%esp
+  802309:	89 f0                	mov    %esi,%eax
+  80230b:	29 d8                	sub    %ebx,%eax
+  80230d:	50                   	push   %eax
+  80230e:	89 d8                	mov    %ebx,%eax
+  802310:	03 45 0c             	add    0xc(%ebp),%eax
+  802313:	50                   	push   %eax
+  802314:	57                   	push   %edi
+  802315:	e8 29 ff ff ff       	call   802243 <read>
+		if (m < 0)
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	78 04                	js     802325 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802321:	75 dd                	jne    802300 <readn+0x16>
+  802323:	eb 02                	jmp    802327 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802325:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802327:	89 d8                	mov    %ebx,%eax
+  802329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80232c:	5b                   	pop    %ebx
+  80232d:	5e                   	pop    %esi
+  80232e:	5f                   	pop    %edi
+  80232f:	5d                   	pop    %ebp
+  802330:	c3                   	ret
+
+00802331 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802331:	55                   	push   %ebp
+  802332:	89 e5                	mov    %esp,%ebp
+  802334:	56                   	push   %esi
+  802335:	53                   	push   %ebx
+  802336:	83 ec 18             	sub    $0x18,%esp
+  802339:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80233c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80233f:	50                   	push   %eax
+  802340:	53                   	push   %ebx
+  802341:	e8 77 fc ff ff       	call   801fbd <fd_lookup>
+  802346:	83 c4 10             	add    $0x10,%esp
+  802349:	85 c0                	test   %eax,%eax
+  80234b:	78 37                	js     802384 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80234d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802350:	83 ec 08             	sub    $0x8,%esp
+  802353:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802356:	50                   	push   %eax
+  802357:	ff 36                	push   (%esi)
+  802359:	e8 af fc ff ff       	call   80200d <dev_lookup>
+  80235e:	83 c4 10             	add    $0x10,%esp
+  802361:	85 c0                	test   %eax,%eax
+  802363:	78 1f                	js     802384 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802365:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802369:	74 20                	je     80238b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80236b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802371:	85 c0                	test   %eax,%eax
+  802373:	74 57                	je     8023cc <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802375:	83 ec 04             	sub    $0x4,%esp
+  802378:	ff 75 10             	push   0x10(%ebp)
+  80237b:	ff 75 0c             	push   0xc(%ebp)
+  80237e:	56                   	push   %esi
+  80237f:	ff d0                	call   *%eax
+  802381:	83 c4 10             	add    $0x10,%esp
+}
+  802384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802387:	5b                   	pop    %ebx
+  802388:	5e                   	pop    %esi
+  802389:	5d                   	pop    %ebp
+  80238a:	c3                   	ret
+  80238b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80238d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802392:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802398:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80239d:	76 1c                	jbe    8023bb <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80239f:	8b 42 48             	mov    0x48(%edx),%eax
+  8023a2:	83 ec 04             	sub    $0x4,%esp
+  8023a5:	53                   	push   %ebx
+  8023a6:	50                   	push   %eax
+  8023a7:	68 cd 38 80 00       	push   $0x8038cd
+  8023ac:	e8 d1 de ff ff       	call   800282 <cprintf>
+		return -E_INVAL;
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023b9:	eb c9                	jmp    802384 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8023bb:	c1 e8 10             	shr    $0x10,%eax
+  8023be:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8023c4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8023ca:	eb d3                	jmp    80239f <write+0x6e>
+		return -E_NOT_SUPP;
+  8023cc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023d1:	eb b1                	jmp    802384 <write+0x53>
+
+008023d3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8023d3:	55                   	push   %ebp
+  8023d4:	89 e5                	mov    %esp,%ebp
+  8023d6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023dc:	50                   	push   %eax
+  8023dd:	ff 75 08             	push   0x8(%ebp)
+  8023e0:	e8 d8 fb ff ff       	call   801fbd <fd_lookup>
+  8023e5:	83 c4 10             	add    $0x10,%esp
+  8023e8:	85 c0                	test   %eax,%eax
+  8023ea:	78 0e                	js     8023fa <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8023ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f2:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8023f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023fa:	c9                   	leave
+  8023fb:	c3                   	ret
+
+008023fc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	56                   	push   %esi
+  802400:	53                   	push   %ebx
+  802401:	83 ec 18             	sub    $0x18,%esp
+  802404:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802407:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80240a:	50                   	push   %eax
+  80240b:	53                   	push   %ebx
+  80240c:	e8 ac fb ff ff       	call   801fbd <fd_lookup>
+  802411:	83 c4 10             	add    $0x10,%esp
+  802414:	85 c0                	test   %eax,%eax
+  802416:	78 34                	js     80244c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802418:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80241b:	83 ec 08             	sub    $0x8,%esp
+  80241e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802421:	50                   	push   %eax
+  802422:	ff 36                	push   (%esi)
+  802424:	e8 e4 fb ff ff       	call   80200d <dev_lookup>
+  802429:	83 c4 10             	add    $0x10,%esp
+  80242c:	85 c0                	test   %eax,%eax
+  80242e:	78 1c                	js     80244c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802430:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802434:	74 1d                	je     802453 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802436:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802439:	8b 40 18             	mov    0x18(%eax),%eax
+  80243c:	85 c0                	test   %eax,%eax
+  80243e:	74 54                	je     802494 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802440:	83 ec 08             	sub    $0x8,%esp
+  802443:	ff 75 0c             	push   0xc(%ebp)
+  802446:	56                   	push   %esi
+  802447:	ff d0                	call   *%eax
+  802449:	83 c4 10             	add    $0x10,%esp
+}
+  80244c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80244f:	5b                   	pop    %ebx
+  802450:	5e                   	pop    %esi
+  802451:	5d                   	pop    %ebp
+  802452:	c3                   	ret
+  802453:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802455:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80245a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802460:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802465:	76 1c                	jbe    802483 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802467:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80246a:	83 ec 04             	sub    $0x4,%esp
+  80246d:	53                   	push   %ebx
+  80246e:	50                   	push   %eax
+  80246f:	68 90 38 80 00       	push   $0x803890
+  802474:	e8 09 de ff ff       	call   800282 <cprintf>
+		return -E_INVAL;
+  802479:	83 c4 10             	add    $0x10,%esp
+  80247c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802481:	eb c9                	jmp    80244c <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802483:	c1 e8 10             	shr    $0x10,%eax
+  802486:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80248c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802492:	eb d3                	jmp    802467 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802494:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802499:	eb b1                	jmp    80244c <ftruncate+0x50>
+
+0080249b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80249b:	55                   	push   %ebp
+  80249c:	89 e5                	mov    %esp,%ebp
+  80249e:	56                   	push   %esi
+  80249f:	53                   	push   %ebx
+  8024a0:	83 ec 18             	sub    $0x18,%esp
+  8024a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024a9:	50                   	push   %eax
+  8024aa:	ff 75 08             	push   0x8(%ebp)
+  8024ad:	e8 0b fb ff ff       	call   801fbd <fd_lookup>
+  8024b2:	83 c4 10             	add    $0x10,%esp
+  8024b5:	85 c0                	test   %eax,%eax
+  8024b7:	78 49                	js     802502 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024b9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024bc:	83 ec 08             	sub    $0x8,%esp
+  8024bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024c2:	50                   	push   %eax
+  8024c3:	ff 36                	push   (%esi)
+  8024c5:	e8 43 fb ff ff       	call   80200d <dev_lookup>
+  8024ca:	83 c4 10             	add    $0x10,%esp
+  8024cd:	85 c0                	test   %eax,%eax
+  8024cf:	78 31                	js     802502 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8024d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8024d8:	74 2f                	je     802509 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8024da:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8024dd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8024e4:	00 00 00 
+	stat->st_isdir = 0;
+  8024e7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024ee:	00 00 00 
+	stat->st_dev = dev;
+  8024f1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8024f7:	83 ec 08             	sub    $0x8,%esp
+  8024fa:	53                   	push   %ebx
+  8024fb:	56                   	push   %esi
+  8024fc:	ff 50 14             	call   *0x14(%eax)
+  8024ff:	83 c4 10             	add    $0x10,%esp
+}
+  802502:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802505:	5b                   	pop    %ebx
+  802506:	5e                   	pop    %esi
+  802507:	5d                   	pop    %ebp
+  802508:	c3                   	ret
+		return -E_NOT_SUPP;
+  802509:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80250e:	eb f2                	jmp    802502 <fstat+0x67>
+
+00802510 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802510:	55                   	push   %ebp
+  802511:	89 e5                	mov    %esp,%ebp
+  802513:	56                   	push   %esi
+  802514:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802515:	83 ec 08             	sub    $0x8,%esp
+  802518:	6a 00                	push   $0x0
+  80251a:	ff 75 08             	push   0x8(%ebp)
+  80251d:	e8 e4 01 00 00       	call   802706 <open>
+  802522:	89 c3                	mov    %eax,%ebx
+  802524:	83 c4 10             	add    $0x10,%esp
+  802527:	85 c0                	test   %eax,%eax
+  802529:	78 1b                	js     802546 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80252b:	83 ec 08             	sub    $0x8,%esp
+  80252e:	ff 75 0c             	push   0xc(%ebp)
+  802531:	50                   	push   %eax
+  802532:	e8 64 ff ff ff       	call   80249b <fstat>
+  802537:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802539:	89 1c 24             	mov    %ebx,(%esp)
+  80253c:	e8 c6 fb ff ff       	call   802107 <close>
+	return r;
+  802541:	83 c4 10             	add    $0x10,%esp
+  802544:	89 f3                	mov    %esi,%ebx
+}
+  802546:	89 d8                	mov    %ebx,%eax
+  802548:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80254b:	5b                   	pop    %ebx
+  80254c:	5e                   	pop    %esi
+  80254d:	5d                   	pop    %ebp
+  80254e:	c3                   	ret
+
+0080254f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80254f:	55                   	push   %ebp
+  802550:	89 e5                	mov    %esp,%ebp
+  802552:	56                   	push   %esi
+  802553:	53                   	push   %ebx
+  802554:	89 c6                	mov    %eax,%esi
+  802556:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802558:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80255f:	74 27                	je     802588 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802561:	6a 07                	push   $0x7
+  802563:	68 00 60 80 00       	push   $0x806000
+  802568:	56                   	push   %esi
+  802569:	ff 35 00 50 80 00    	push   0x805000
+  80256f:	e8 41 0d 00 00       	call   8032b5 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802574:	83 c4 0c             	add    $0xc,%esp
+  802577:	6a 00                	push   $0x0
+  802579:	53                   	push   %ebx
+  80257a:	6a 00                	push   $0x0
+  80257c:	e8 1c 0d 00 00       	call   80329d <ipc_recv>
+}
+  802581:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802584:	5b                   	pop    %ebx
+  802585:	5e                   	pop    %esi
+  802586:	5d                   	pop    %ebp
+  802587:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802588:	83 ec 0c             	sub    $0xc,%esp
+  80258b:	6a 01                	push   $0x1
+  80258d:	e8 77 0d 00 00       	call   803309 <ipc_find_env>
+  802592:	a3 00 50 80 00       	mov    %eax,0x805000
+  802597:	83 c4 10             	add    $0x10,%esp
+  80259a:	eb c5                	jmp    802561 <fsipc+0x12>
+
+0080259c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8025a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025a8:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8025ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025b0:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8025b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ba:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025bf:	e8 8b ff ff ff       	call   80254f <fsipc>
+}
+  8025c4:	c9                   	leave
+  8025c5:	c3                   	ret
+
+008025c6 <devfile_flush>:
+{
+  8025c6:	55                   	push   %ebp
+  8025c7:	89 e5                	mov    %esp,%ebp
+  8025c9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8025cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025cf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025d2:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8025d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025dc:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025e1:	e8 69 ff ff ff       	call   80254f <fsipc>
+}
+  8025e6:	c9                   	leave
+  8025e7:	c3                   	ret
+
+008025e8 <devfile_stat>:
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	53                   	push   %ebx
+  8025ec:	83 ec 04             	sub    $0x4,%esp
+  8025ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8025f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025f8:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8025fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802602:	b8 05 00 00 00       	mov    $0x5,%eax
+  802607:	e8 43 ff ff ff       	call   80254f <fsipc>
+  80260c:	85 c0                	test   %eax,%eax
+  80260e:	78 2c                	js     80263c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802610:	83 ec 08             	sub    $0x8,%esp
+  802613:	68 00 60 80 00       	push   $0x806000
+  802618:	53                   	push   %ebx
+  802619:	e8 ac e2 ff ff       	call   8008ca <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80261e:	a1 80 60 80 00       	mov    0x806080,%eax
+  802623:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802629:	a1 84 60 80 00       	mov    0x806084,%eax
+  80262e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802634:	83 c4 10             	add    $0x10,%esp
+  802637:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80263c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263f:	c9                   	leave
+  802640:	c3                   	ret
+
+00802641 <devfile_write>:
+{
+  802641:	55                   	push   %ebp
+  802642:	89 e5                	mov    %esp,%ebp
+  802644:	83 ec 0c             	sub    $0xc,%esp
+  802647:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80264a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80264d:	8b 52 0c             	mov    0xc(%edx),%edx
+  802650:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802656:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80265b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802660:	39 d0                	cmp    %edx,%eax
+  802662:	0f 47 c2             	cmova  %edx,%eax
+  802665:	50                   	push   %eax
+  802666:	ff 75 0c             	push   0xc(%ebp)
+  802669:	68 08 60 80 00       	push   $0x806008
+  80266e:	e8 dd e3 ff ff       	call   800a50 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802673:	ba 00 00 00 00       	mov    $0x0,%edx
+  802678:	b8 04 00 00 00       	mov    $0x4,%eax
+  80267d:	e8 cd fe ff ff       	call   80254f <fsipc>
+}
+  802682:	c9                   	leave
+  802683:	c3                   	ret
+
+00802684 <devfile_read>:
+{
+  802684:	55                   	push   %ebp
+  802685:	89 e5                	mov    %esp,%ebp
+  802687:	56                   	push   %esi
+  802688:	53                   	push   %ebx
+  802689:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80268c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802692:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802697:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80269d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026a7:	e8 a3 fe ff ff       	call   80254f <fsipc>
+  8026ac:	89 c3                	mov    %eax,%ebx
+  8026ae:	85 c0                	test   %eax,%eax
+  8026b0:	78 1f                	js     8026d1 <devfile_read+0x4d>
+	assert(r <= n);
+  8026b2:	39 c6                	cmp    %eax,%esi
+  8026b4:	72 24                	jb     8026da <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8026b6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8026bb:	7f 33                	jg     8026f0 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8026bd:	83 ec 04             	sub    $0x4,%esp
+  8026c0:	50                   	push   %eax
+  8026c1:	68 00 60 80 00       	push   $0x806000
+  8026c6:	ff 75 0c             	push   0xc(%ebp)
+  8026c9:	e8 82 e3 ff ff       	call   800a50 <memmove>
+	return r;
+  8026ce:	83 c4 10             	add    $0x10,%esp
+}
+  8026d1:	89 d8                	mov    %ebx,%eax
+  8026d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026d6:	5b                   	pop    %ebx
+  8026d7:	5e                   	pop    %esi
+  8026d8:	5d                   	pop    %ebp
+  8026d9:	c3                   	ret
+	assert(r <= n);
+  8026da:	68 00 39 80 00       	push   $0x803900
+  8026df:	68 f0 37 80 00       	push   $0x8037f0
+  8026e4:	6a 76                	push   $0x76
+  8026e6:	68 07 39 80 00       	push   $0x803907
+  8026eb:	e8 b7 da ff ff       	call   8001a7 <_panic>
+	assert(r <= PGSIZE);
+  8026f0:	68 12 39 80 00       	push   $0x803912
+  8026f5:	68 f0 37 80 00       	push   $0x8037f0
+  8026fa:	6a 77                	push   $0x77
+  8026fc:	68 07 39 80 00       	push   $0x803907
+  802701:	e8 a1 da ff ff       	call   8001a7 <_panic>
+
+00802706 <open>:
+{
+  802706:	55                   	push   %ebp
+  802707:	89 e5                	mov    %esp,%ebp
+  802709:	56                   	push   %esi
+  80270a:	53                   	push   %ebx
+  80270b:	83 ec 1c             	sub    $0x1c,%esp
+  80270e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802711:	56                   	push   %esi
+  802712:	e8 78 e1 ff ff       	call   80088f <strlen>
+  802717:	83 c4 10             	add    $0x10,%esp
+  80271a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80271f:	7f 6c                	jg     80278d <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802721:	83 ec 0c             	sub    $0xc,%esp
+  802724:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802727:	50                   	push   %eax
+  802728:	e8 3a f8 ff ff       	call   801f67 <fd_alloc>
+  80272d:	89 c3                	mov    %eax,%ebx
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	85 c0                	test   %eax,%eax
+  802734:	78 3c                	js     802772 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802736:	83 ec 08             	sub    $0x8,%esp
+  802739:	56                   	push   %esi
+  80273a:	68 00 60 80 00       	push   $0x806000
+  80273f:	e8 86 e1 ff ff       	call   8008ca <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802744:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802747:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80274c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80274f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802754:	e8 f6 fd ff ff       	call   80254f <fsipc>
+  802759:	89 c3                	mov    %eax,%ebx
+  80275b:	83 c4 10             	add    $0x10,%esp
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	78 19                	js     80277b <open+0x75>
+	return fd2num(fd);
+  802762:	83 ec 0c             	sub    $0xc,%esp
+  802765:	ff 75 f4             	push   -0xc(%ebp)
+  802768:	e8 d3 f7 ff ff       	call   801f40 <fd2num>
+  80276d:	89 c3                	mov    %eax,%ebx
+  80276f:	83 c4 10             	add    $0x10,%esp
+}
+  802772:	89 d8                	mov    %ebx,%eax
+  802774:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802777:	5b                   	pop    %ebx
+  802778:	5e                   	pop    %esi
+  802779:	5d                   	pop    %ebp
+  80277a:	c3                   	ret
+		fd_close(fd, 0);
+  80277b:	83 ec 08             	sub    $0x8,%esp
+  80277e:	6a 00                	push   $0x0
+  802780:	ff 75 f4             	push   -0xc(%ebp)
+  802783:	e8 f8 f8 ff ff       	call   802080 <fd_close>
+		return r;
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	eb e5                	jmp    802772 <open+0x6c>
+		return -E_BAD_PATH;
+  80278d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802792:	eb de                	jmp    802772 <open+0x6c>
+
+00802794 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802794:	55                   	push   %ebp
+  802795:	89 e5                	mov    %esp,%ebp
+  802797:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80279a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279f:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027a4:	e8 a6 fd ff ff       	call   80254f <fsipc>
+}
+  8027a9:	c9                   	leave
+  8027aa:	c3                   	ret
+
+008027ab <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027ab:	55                   	push   %ebp
+  8027ac:	89 e5                	mov    %esp,%ebp
+  8027ae:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8027b1:	68 1e 39 80 00       	push   $0x80391e
+  8027b6:	ff 75 0c             	push   0xc(%ebp)
+  8027b9:	e8 0c e1 ff ff       	call   8008ca <strcpy>
+	return 0;
+}
+  8027be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c3:	c9                   	leave
+  8027c4:	c3                   	ret
+
+008027c5 <devsock_close>:
+{
+  8027c5:	55                   	push   %ebp
+  8027c6:	89 e5                	mov    %esp,%ebp
+  8027c8:	53                   	push   %ebx
+  8027c9:	83 ec 10             	sub    $0x10,%esp
+  8027cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027cf:	53                   	push   %ebx
+  8027d0:	e8 73 0b 00 00       	call   803348 <pageref>
+  8027d5:	89 c2                	mov    %eax,%edx
+  8027d7:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027da:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027df:	83 fa 01             	cmp    $0x1,%edx
+  8027e2:	74 05                	je     8027e9 <devsock_close+0x24>
+}
+  8027e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027e7:	c9                   	leave
+  8027e8:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027e9:	83 ec 0c             	sub    $0xc,%esp
+  8027ec:	ff 73 0c             	push   0xc(%ebx)
+  8027ef:	e8 b7 02 00 00       	call   802aab <nsipc_close>
+  8027f4:	83 c4 10             	add    $0x10,%esp
+  8027f7:	eb eb                	jmp    8027e4 <devsock_close+0x1f>
+
+008027f9 <devsock_write>:
+{
+  8027f9:	55                   	push   %ebp
+  8027fa:	89 e5                	mov    %esp,%ebp
+  8027fc:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8027ff:	6a 00                	push   $0x0
+  802801:	ff 75 10             	push   0x10(%ebp)
+  802804:	ff 75 0c             	push   0xc(%ebp)
+  802807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80280a:	ff 70 0c             	push   0xc(%eax)
+  80280d:	e8 79 03 00 00       	call   802b8b <nsipc_send>
+}
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+
+00802814 <devsock_read>:
+{
+  802814:	55                   	push   %ebp
+  802815:	89 e5                	mov    %esp,%ebp
+  802817:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80281a:	6a 00                	push   $0x0
+  80281c:	ff 75 10             	push   0x10(%ebp)
+  80281f:	ff 75 0c             	push   0xc(%ebp)
+  802822:	8b 45 08             	mov    0x8(%ebp),%eax
+  802825:	ff 70 0c             	push   0xc(%eax)
+  802828:	e8 ef 02 00 00       	call   802b1c <nsipc_recv>
+}
+  80282d:	c9                   	leave
+  80282e:	c3                   	ret
+
+0080282f <fd2sockid>:
+{
+  80282f:	55                   	push   %ebp
+  802830:	89 e5                	mov    %esp,%ebp
+  802832:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802835:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802838:	52                   	push   %edx
+  802839:	50                   	push   %eax
+  80283a:	e8 7e f7 ff ff       	call   801fbd <fd_lookup>
+  80283f:	83 c4 10             	add    $0x10,%esp
+  802842:	85 c0                	test   %eax,%eax
+  802844:	78 10                	js     802856 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802846:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802849:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80284f:	39 08                	cmp    %ecx,(%eax)
+  802851:	75 05                	jne    802858 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802853:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802856:	c9                   	leave
+  802857:	c3                   	ret
+		return -E_NOT_SUPP;
+  802858:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80285d:	eb f7                	jmp    802856 <fd2sockid+0x27>
+
+0080285f <alloc_sockfd>:
+{
+  80285f:	55                   	push   %ebp
+  802860:	89 e5                	mov    %esp,%ebp
+  802862:	56                   	push   %esi
+  802863:	53                   	push   %ebx
+  802864:	83 ec 1c             	sub    $0x1c,%esp
+  802867:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802869:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80286c:	50                   	push   %eax
+  80286d:	e8 f5 f6 ff ff       	call   801f67 <fd_alloc>
+  802872:	89 c3                	mov    %eax,%ebx
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	85 c0                	test   %eax,%eax
+  802879:	78 43                	js     8028be <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80287b:	83 ec 04             	sub    $0x4,%esp
+  80287e:	68 07 04 00 00       	push   $0x407
+  802883:	ff 75 f4             	push   -0xc(%ebp)
+  802886:	6a 00                	push   $0x0
+  802888:	e8 35 e5 ff ff       	call   800dc2 <sys_page_alloc>
+  80288d:	89 c3                	mov    %eax,%ebx
+  80288f:	83 c4 10             	add    $0x10,%esp
+  802892:	85 c0                	test   %eax,%eax
+  802894:	78 28                	js     8028be <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802896:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802899:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80289f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8028a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028a4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8028ab:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8028ae:	83 ec 0c             	sub    $0xc,%esp
+  8028b1:	50                   	push   %eax
+  8028b2:	e8 89 f6 ff ff       	call   801f40 <fd2num>
+  8028b7:	89 c3                	mov    %eax,%ebx
+  8028b9:	83 c4 10             	add    $0x10,%esp
+  8028bc:	eb 0c                	jmp    8028ca <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8028be:	83 ec 0c             	sub    $0xc,%esp
+  8028c1:	56                   	push   %esi
+  8028c2:	e8 e4 01 00 00       	call   802aab <nsipc_close>
+		return r;
+  8028c7:	83 c4 10             	add    $0x10,%esp
+}
+  8028ca:	89 d8                	mov    %ebx,%eax
+  8028cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028cf:	5b                   	pop    %ebx
+  8028d0:	5e                   	pop    %esi
+  8028d1:	5d                   	pop    %ebp
+  8028d2:	c3                   	ret
+
+008028d3 <accept>:
+{
+  8028d3:	55                   	push   %ebp
+  8028d4:	89 e5                	mov    %esp,%ebp
+  8028d6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028dc:	e8 4e ff ff ff       	call   80282f <fd2sockid>
+  8028e1:	85 c0                	test   %eax,%eax
+  8028e3:	78 1b                	js     802900 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8028e5:	83 ec 04             	sub    $0x4,%esp
+  8028e8:	ff 75 10             	push   0x10(%ebp)
+  8028eb:	ff 75 0c             	push   0xc(%ebp)
+  8028ee:	50                   	push   %eax
+  8028ef:	e8 0e 01 00 00       	call   802a02 <nsipc_accept>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	78 05                	js     802900 <accept+0x2d>
+	return alloc_sockfd(r);
+  8028fb:	e8 5f ff ff ff       	call   80285f <alloc_sockfd>
+}
+  802900:	c9                   	leave
+  802901:	c3                   	ret
+
+00802902 <bind>:
+{
+  802902:	55                   	push   %ebp
+  802903:	89 e5                	mov    %esp,%ebp
+  802905:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290b:	e8 1f ff ff ff       	call   80282f <fd2sockid>
+  802910:	85 c0                	test   %eax,%eax
+  802912:	78 12                	js     802926 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802914:	83 ec 04             	sub    $0x4,%esp
+  802917:	ff 75 10             	push   0x10(%ebp)
+  80291a:	ff 75 0c             	push   0xc(%ebp)
+  80291d:	50                   	push   %eax
+  80291e:	e8 31 01 00 00       	call   802a54 <nsipc_bind>
+  802923:	83 c4 10             	add    $0x10,%esp
+}
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+
+00802928 <shutdown>:
+{
+  802928:	55                   	push   %ebp
+  802929:	89 e5                	mov    %esp,%ebp
+  80292b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80292e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802931:	e8 f9 fe ff ff       	call   80282f <fd2sockid>
+  802936:	85 c0                	test   %eax,%eax
+  802938:	78 0f                	js     802949 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80293a:	83 ec 08             	sub    $0x8,%esp
+  80293d:	ff 75 0c             	push   0xc(%ebp)
+  802940:	50                   	push   %eax
+  802941:	e8 43 01 00 00       	call   802a89 <nsipc_shutdown>
+  802946:	83 c4 10             	add    $0x10,%esp
+}
+  802949:	c9                   	leave
+  80294a:	c3                   	ret
+
+0080294b <connect>:
+{
+  80294b:	55                   	push   %ebp
+  80294c:	89 e5                	mov    %esp,%ebp
+  80294e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802951:	8b 45 08             	mov    0x8(%ebp),%eax
+  802954:	e8 d6 fe ff ff       	call   80282f <fd2sockid>
+  802959:	85 c0                	test   %eax,%eax
+  80295b:	78 12                	js     80296f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80295d:	83 ec 04             	sub    $0x4,%esp
+  802960:	ff 75 10             	push   0x10(%ebp)
+  802963:	ff 75 0c             	push   0xc(%ebp)
+  802966:	50                   	push   %eax
+  802967:	e8 59 01 00 00       	call   802ac5 <nsipc_connect>
+  80296c:	83 c4 10             	add    $0x10,%esp
+}
+  80296f:	c9                   	leave
+  802970:	c3                   	ret
+
+00802971 <listen>:
+{
+  802971:	55                   	push   %ebp
+  802972:	89 e5                	mov    %esp,%ebp
+  802974:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80297a:	e8 b0 fe ff ff       	call   80282f <fd2sockid>
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	78 0f                	js     802992 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802983:	83 ec 08             	sub    $0x8,%esp
+  802986:	ff 75 0c             	push   0xc(%ebp)
+  802989:	50                   	push   %eax
+  80298a:	e8 6b 01 00 00       	call   802afa <nsipc_listen>
+  80298f:	83 c4 10             	add    $0x10,%esp
+}
+  802992:	c9                   	leave
+  802993:	c3                   	ret
+
+00802994 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802994:	55                   	push   %ebp
+  802995:	89 e5                	mov    %esp,%ebp
+  802997:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80299a:	ff 75 10             	push   0x10(%ebp)
+  80299d:	ff 75 0c             	push   0xc(%ebp)
+  8029a0:	ff 75 08             	push   0x8(%ebp)
+  8029a3:	e8 41 02 00 00       	call   802be9 <nsipc_socket>
+  8029a8:	83 c4 10             	add    $0x10,%esp
+  8029ab:	85 c0                	test   %eax,%eax
+  8029ad:	78 05                	js     8029b4 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8029af:	e8 ab fe ff ff       	call   80285f <alloc_sockfd>
+}
+  8029b4:	c9                   	leave
+  8029b5:	c3                   	ret
+
+008029b6 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8029b6:	55                   	push   %ebp
+  8029b7:	89 e5                	mov    %esp,%ebp
+  8029b9:	53                   	push   %ebx
+  8029ba:	83 ec 04             	sub    $0x4,%esp
+  8029bd:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8029bf:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8029c6:	74 26                	je     8029ee <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8029c8:	6a 07                	push   $0x7
+  8029ca:	68 00 70 80 00       	push   $0x807000
+  8029cf:	53                   	push   %ebx
+  8029d0:	ff 35 04 50 80 00    	push   0x805004
+  8029d6:	e8 da 08 00 00       	call   8032b5 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029db:	83 c4 0c             	add    $0xc,%esp
+  8029de:	6a 00                	push   $0x0
+  8029e0:	6a 00                	push   $0x0
+  8029e2:	6a 00                	push   $0x0
+  8029e4:	e8 b4 08 00 00       	call   80329d <ipc_recv>
+}
+  8029e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ec:	c9                   	leave
+  8029ed:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029ee:	83 ec 0c             	sub    $0xc,%esp
+  8029f1:	6a 02                	push   $0x2
+  8029f3:	e8 11 09 00 00       	call   803309 <ipc_find_env>
+  8029f8:	a3 04 50 80 00       	mov    %eax,0x805004
+  8029fd:	83 c4 10             	add    $0x10,%esp
+  802a00:	eb c6                	jmp    8029c8 <nsipc+0x12>
+
+00802a02 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a02:	55                   	push   %ebp
+  802a03:	89 e5                	mov    %esp,%ebp
+  802a05:	56                   	push   %esi
+  802a06:	53                   	push   %ebx
+  802a07:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a0d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a12:	8b 06                	mov    (%esi),%eax
+  802a14:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a19:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a1e:	e8 93 ff ff ff       	call   8029b6 <nsipc>
+  802a23:	89 c3                	mov    %eax,%ebx
+  802a25:	85 c0                	test   %eax,%eax
+  802a27:	79 09                	jns    802a32 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a29:	89 d8                	mov    %ebx,%eax
+  802a2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a2e:	5b                   	pop    %ebx
+  802a2f:	5e                   	pop    %esi
+  802a30:	5d                   	pop    %ebp
+  802a31:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a32:	83 ec 04             	sub    $0x4,%esp
+  802a35:	ff 35 10 70 80 00    	push   0x807010
+  802a3b:	68 00 70 80 00       	push   $0x807000
+  802a40:	ff 75 0c             	push   0xc(%ebp)
+  802a43:	e8 08 e0 ff ff       	call   800a50 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a48:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a4d:	89 06                	mov    %eax,(%esi)
+  802a4f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a52:	eb d5                	jmp    802a29 <nsipc_accept+0x27>
+
+00802a54 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a54:	55                   	push   %ebp
+  802a55:	89 e5                	mov    %esp,%ebp
+  802a57:	53                   	push   %ebx
+  802a58:	83 ec 08             	sub    $0x8,%esp
+  802a5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a61:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a66:	53                   	push   %ebx
+  802a67:	ff 75 0c             	push   0xc(%ebp)
+  802a6a:	68 04 70 80 00       	push   $0x807004
+  802a6f:	e8 dc df ff ff       	call   800a50 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a74:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802a7a:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a7f:	e8 32 ff ff ff       	call   8029b6 <nsipc>
+}
+  802a84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a87:	c9                   	leave
+  802a88:	c3                   	ret
+
+00802a89 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a92:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802a97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a9a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a9f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802aa4:	e8 0d ff ff ff       	call   8029b6 <nsipc>
+}
+  802aa9:	c9                   	leave
+  802aaa:	c3                   	ret
+
+00802aab <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802aab:	55                   	push   %ebp
+  802aac:	89 e5                	mov    %esp,%ebp
+  802aae:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ab1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab4:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802ab9:	b8 04 00 00 00       	mov    $0x4,%eax
+  802abe:	e8 f3 fe ff ff       	call   8029b6 <nsipc>
+}
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	53                   	push   %ebx
+  802ac9:	83 ec 08             	sub    $0x8,%esp
+  802acc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802acf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad2:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ad7:	53                   	push   %ebx
+  802ad8:	ff 75 0c             	push   0xc(%ebp)
+  802adb:	68 04 70 80 00       	push   $0x807004
+  802ae0:	e8 6b df ff ff       	call   800a50 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ae5:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802aeb:	b8 05 00 00 00       	mov    $0x5,%eax
+  802af0:	e8 c1 fe ff ff       	call   8029b6 <nsipc>
+}
+  802af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+00802afa <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b03:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b08:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b0b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802b10:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b15:	e8 9c fe ff ff       	call   8029b6 <nsipc>
+}
+  802b1a:	c9                   	leave
+  802b1b:	c3                   	ret
+
+00802b1c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b1c:	55                   	push   %ebp
+  802b1d:	89 e5                	mov    %esp,%ebp
+  802b1f:	56                   	push   %esi
+  802b20:	53                   	push   %ebx
+  802b21:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b27:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802b2c:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802b32:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b35:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b3a:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b3f:	e8 72 fe ff ff       	call   8029b6 <nsipc>
+  802b44:	89 c3                	mov    %eax,%ebx
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	78 22                	js     802b6c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b4a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b4f:	39 c6                	cmp    %eax,%esi
+  802b51:	0f 4e c6             	cmovle %esi,%eax
+  802b54:	39 c3                	cmp    %eax,%ebx
+  802b56:	7f 1d                	jg     802b75 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b58:	83 ec 04             	sub    $0x4,%esp
+  802b5b:	53                   	push   %ebx
+  802b5c:	68 00 70 80 00       	push   $0x807000
+  802b61:	ff 75 0c             	push   0xc(%ebp)
+  802b64:	e8 e7 de ff ff       	call   800a50 <memmove>
+  802b69:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b6c:	89 d8                	mov    %ebx,%eax
+  802b6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b71:	5b                   	pop    %ebx
+  802b72:	5e                   	pop    %esi
+  802b73:	5d                   	pop    %ebp
+  802b74:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b75:	68 2a 39 80 00       	push   $0x80392a
+  802b7a:	68 f0 37 80 00       	push   $0x8037f0
+  802b7f:	6a 62                	push   $0x62
+  802b81:	68 3f 39 80 00       	push   $0x80393f
+  802b86:	e8 1c d6 ff ff       	call   8001a7 <_panic>
+
+00802b8b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b8b:	55                   	push   %ebp
+  802b8c:	89 e5                	mov    %esp,%ebp
+  802b8e:	53                   	push   %ebx
+  802b8f:	83 ec 04             	sub    $0x4,%esp
+  802b92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b98:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802b9d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ba3:	7f 2e                	jg     802bd3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ba5:	83 ec 04             	sub    $0x4,%esp
+  802ba8:	53                   	push   %ebx
+  802ba9:	ff 75 0c             	push   0xc(%ebp)
+  802bac:	68 0c 70 80 00       	push   $0x80700c
+  802bb1:	e8 9a de ff ff       	call   800a50 <memmove>
+	nsipcbuf.send.req_size = size;
+  802bb6:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802bbc:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bbf:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802bc4:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bc9:	e8 e8 fd ff ff       	call   8029b6 <nsipc>
+}
+  802bce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bd1:	c9                   	leave
+  802bd2:	c3                   	ret
+	assert(size < 1600);
+  802bd3:	68 4b 39 80 00       	push   $0x80394b
+  802bd8:	68 f0 37 80 00       	push   $0x8037f0
+  802bdd:	6a 6d                	push   $0x6d
+  802bdf:	68 3f 39 80 00       	push   $0x80393f
+  802be4:	e8 be d5 ff ff       	call   8001a7 <_panic>
+
+00802be9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802bef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802bf7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bfa:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802bff:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c02:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802c07:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c0c:	e8 a5 fd ff ff       	call   8029b6 <nsipc>
+}
+  802c11:	c9                   	leave
+  802c12:	c3                   	ret
+
+00802c13 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c13:	55                   	push   %ebp
+  802c14:	89 e5                	mov    %esp,%ebp
+  802c16:	56                   	push   %esi
+  802c17:	53                   	push   %ebx
+  802c18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802c1b:	83 ec 0c             	sub    $0xc,%esp
+  802c1e:	ff 75 08             	push   0x8(%ebp)
+  802c21:	e8 2a f3 ff ff       	call   801f50 <fd2data>
+  802c26:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802c28:	83 c4 08             	add    $0x8,%esp
+  802c2b:	68 57 39 80 00       	push   $0x803957
+  802c30:	53                   	push   %ebx
+  802c31:	e8 94 dc ff ff       	call   8008ca <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c36:	8b 46 04             	mov    0x4(%esi),%eax
+  802c39:	2b 06                	sub    (%esi),%eax
+  802c3b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802c41:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c48:	00 00 00 
+	stat->st_dev = &devpipe;
+  802c4b:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802c52:	40 80 00 
+	return 0;
+}
+  802c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c5d:	5b                   	pop    %ebx
+  802c5e:	5e                   	pop    %esi
+  802c5f:	5d                   	pop    %ebp
+  802c60:	c3                   	ret
+
+00802c61 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c61:	55                   	push   %ebp
+  802c62:	89 e5                	mov    %esp,%ebp
+  802c64:	53                   	push   %ebx
+  802c65:	83 ec 0c             	sub    $0xc,%esp
+  802c68:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c6b:	53                   	push   %ebx
+  802c6c:	6a 00                	push   $0x0
+  802c6e:	e8 2a e2 ff ff       	call   800e9d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c73:	89 1c 24             	mov    %ebx,(%esp)
+  802c76:	e8 d5 f2 ff ff       	call   801f50 <fd2data>
+  802c7b:	83 c4 08             	add    $0x8,%esp
+  802c7e:	50                   	push   %eax
+  802c7f:	6a 00                	push   $0x0
+  802c81:	e8 17 e2 ff ff       	call   800e9d <sys_page_unmap>
+}
+  802c86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c89:	c9                   	leave
+  802c8a:	c3                   	ret
+
+00802c8b <_pipeisclosed>:
+{
+  802c8b:	55                   	push   %ebp
+  802c8c:	89 e5                	mov    %esp,%ebp
+  802c8e:	57                   	push   %edi
+  802c8f:	56                   	push   %esi
+  802c90:	53                   	push   %ebx
+  802c91:	83 ec 1c             	sub    $0x1c,%esp
+  802c94:	89 c7                	mov    %eax,%edi
+  802c96:	89 d6                	mov    %edx,%esi
+  802c98:	eb 3c                	jmp    802cd6 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802c9a:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802c9d:	83 ec 0c             	sub    $0xc,%esp
+  802ca0:	57                   	push   %edi
+  802ca1:	e8 a2 06 00 00       	call   803348 <pageref>
+  802ca6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ca9:	89 34 24             	mov    %esi,(%esp)
+  802cac:	e8 97 06 00 00       	call   803348 <pageref>
+  802cb1:	89 c2                	mov    %eax,%edx
+  802cb3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cb5:	05 00 00 00 20       	add    $0x20000000,%eax
+  802cba:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802cbd:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cc3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cc8:	76 31                	jbe    802cfb <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802cca:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802ccd:	39 c3                	cmp    %eax,%ebx
+  802ccf:	74 76                	je     802d47 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802cd1:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802cd4:	74 36                	je     802d0c <_pipeisclosed+0x81>
+  802cd6:	89 e0                	mov    %esp,%eax
+  802cd8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802cdd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ce3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ce8:	77 b0                	ja     802c9a <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802cea:	c1 e8 10             	shr    $0x10,%eax
+  802ced:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802cf3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802cf9:	eb 9f                	jmp    802c9a <_pipeisclosed+0xf>
+  802cfb:	c1 e8 10             	shr    $0x10,%eax
+  802cfe:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d04:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802d0a:	eb be                	jmp    802cca <_pipeisclosed+0x3f>
+  802d0c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d0e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d13:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d19:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d1e:	76 16                	jbe    802d36 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d20:	8b 42 58             	mov    0x58(%edx),%eax
+  802d23:	6a 01                	push   $0x1
+  802d25:	50                   	push   %eax
+  802d26:	53                   	push   %ebx
+  802d27:	68 5e 39 80 00       	push   $0x80395e
+  802d2c:	e8 51 d5 ff ff       	call   800282 <cprintf>
+  802d31:	83 c4 10             	add    $0x10,%esp
+  802d34:	eb a0                	jmp    802cd6 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d36:	c1 e8 10             	shr    $0x10,%eax
+  802d39:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d3f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d45:	eb d9                	jmp    802d20 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802d47:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802d4a:	0f 94 c0             	sete   %al
+  802d4d:	0f b6 c0             	movzbl %al,%eax
+}
+  802d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d53:	5b                   	pop    %ebx
+  802d54:	5e                   	pop    %esi
+  802d55:	5f                   	pop    %edi
+  802d56:	5d                   	pop    %ebp
+  802d57:	c3                   	ret
+
+00802d58 <devpipe_write>:
+{
+  802d58:	55                   	push   %ebp
+  802d59:	89 e5                	mov    %esp,%ebp
+  802d5b:	57                   	push   %edi
+  802d5c:	56                   	push   %esi
+  802d5d:	53                   	push   %ebx
+  802d5e:	83 ec 28             	sub    $0x28,%esp
+  802d61:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802d64:	56                   	push   %esi
+  802d65:	e8 e6 f1 ff ff       	call   801f50 <fd2data>
+  802d6a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d6c:	83 c4 10             	add    $0x10,%esp
+  802d6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d74:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d77:	75 09                	jne    802d82 <devpipe_write+0x2a>
+	return i;
+  802d79:	89 f8                	mov    %edi,%eax
+  802d7b:	eb 23                	jmp    802da0 <devpipe_write+0x48>
+			sys_yield();
+  802d7d:	e8 fa df ff ff       	call   800d7c <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d82:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d85:	8b 0b                	mov    (%ebx),%ecx
+  802d87:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d8a:	39 d0                	cmp    %edx,%eax
+  802d8c:	72 1a                	jb     802da8 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802d8e:	89 da                	mov    %ebx,%edx
+  802d90:	89 f0                	mov    %esi,%eax
+  802d92:	e8 f4 fe ff ff       	call   802c8b <_pipeisclosed>
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	74 e2                	je     802d7d <devpipe_write+0x25>
+				return 0;
+  802d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802da0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da3:	5b                   	pop    %ebx
+  802da4:	5e                   	pop    %esi
+  802da5:	5f                   	pop    %edi
+  802da6:	5d                   	pop    %ebp
+  802da7:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802da8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dab:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802daf:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802db2:	89 c2                	mov    %eax,%edx
+  802db4:	c1 fa 1f             	sar    $0x1f,%edx
+  802db7:	89 d1                	mov    %edx,%ecx
+  802db9:	c1 e9 1b             	shr    $0x1b,%ecx
+  802dbc:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802dbf:	83 e2 1f             	and    $0x1f,%edx
+  802dc2:	29 ca                	sub    %ecx,%edx
+  802dc4:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802dc8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802dcc:	83 c0 01             	add    $0x1,%eax
+  802dcf:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802dd2:	83 c7 01             	add    $0x1,%edi
+  802dd5:	eb 9d                	jmp    802d74 <devpipe_write+0x1c>
+
+00802dd7 <devpipe_read>:
+{
+  802dd7:	55                   	push   %ebp
+  802dd8:	89 e5                	mov    %esp,%ebp
+  802dda:	57                   	push   %edi
+  802ddb:	56                   	push   %esi
+  802ddc:	53                   	push   %ebx
+  802ddd:	83 ec 18             	sub    $0x18,%esp
+  802de0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802de3:	57                   	push   %edi
+  802de4:	e8 67 f1 ff ff       	call   801f50 <fd2data>
+  802de9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802deb:	83 c4 10             	add    $0x10,%esp
+  802dee:	be 00 00 00 00       	mov    $0x0,%esi
+  802df3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802df6:	75 13                	jne    802e0b <devpipe_read+0x34>
+	return i;
+  802df8:	89 f0                	mov    %esi,%eax
+  802dfa:	eb 02                	jmp    802dfe <devpipe_read+0x27>
+				return i;
+  802dfc:	89 f0                	mov    %esi,%eax
+}
+  802dfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e01:	5b                   	pop    %ebx
+  802e02:	5e                   	pop    %esi
+  802e03:	5f                   	pop    %edi
+  802e04:	5d                   	pop    %ebp
+  802e05:	c3                   	ret
+			sys_yield();
+  802e06:	e8 71 df ff ff       	call   800d7c <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802e0b:	8b 03                	mov    (%ebx),%eax
+  802e0d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e10:	75 18                	jne    802e2a <devpipe_read+0x53>
+			if (i > 0)
+  802e12:	85 f6                	test   %esi,%esi
+  802e14:	75 e6                	jne    802dfc <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802e16:	89 da                	mov    %ebx,%edx
+  802e18:	89 f8                	mov    %edi,%eax
+  802e1a:	e8 6c fe ff ff       	call   802c8b <_pipeisclosed>
+  802e1f:	85 c0                	test   %eax,%eax
+  802e21:	74 e3                	je     802e06 <devpipe_read+0x2f>
+				return 0;
+  802e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e28:	eb d4                	jmp    802dfe <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e2a:	99                   	cltd
+  802e2b:	c1 ea 1b             	shr    $0x1b,%edx
+  802e2e:	01 d0                	add    %edx,%eax
+  802e30:	83 e0 1f             	and    $0x1f,%eax
+  802e33:	29 d0                	sub    %edx,%eax
+  802e35:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e3d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802e40:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802e43:	83 c6 01             	add    $0x1,%esi
+  802e46:	eb ab                	jmp    802df3 <devpipe_read+0x1c>
+
+00802e48 <pipe>:
+{
+  802e48:	55                   	push   %ebp
+  802e49:	89 e5                	mov    %esp,%ebp
+  802e4b:	56                   	push   %esi
+  802e4c:	53                   	push   %ebx
+  802e4d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802e50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e53:	50                   	push   %eax
+  802e54:	e8 0e f1 ff ff       	call   801f67 <fd_alloc>
+  802e59:	89 c3                	mov    %eax,%ebx
+  802e5b:	83 c4 10             	add    $0x10,%esp
+  802e5e:	85 c0                	test   %eax,%eax
+  802e60:	0f 88 23 01 00 00    	js     802f89 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e66:	83 ec 04             	sub    $0x4,%esp
+  802e69:	68 07 04 00 00       	push   $0x407
+  802e6e:	ff 75 f4             	push   -0xc(%ebp)
+  802e71:	6a 00                	push   $0x0
+  802e73:	e8 4a df ff ff       	call   800dc2 <sys_page_alloc>
+  802e78:	89 c3                	mov    %eax,%ebx
+  802e7a:	83 c4 10             	add    $0x10,%esp
+  802e7d:	85 c0                	test   %eax,%eax
+  802e7f:	0f 88 04 01 00 00    	js     802f89 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802e85:	83 ec 0c             	sub    $0xc,%esp
+  802e88:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e8b:	50                   	push   %eax
+  802e8c:	e8 d6 f0 ff ff       	call   801f67 <fd_alloc>
+  802e91:	89 c3                	mov    %eax,%ebx
+  802e93:	83 c4 10             	add    $0x10,%esp
+  802e96:	85 c0                	test   %eax,%eax
+  802e98:	0f 88 db 00 00 00    	js     802f79 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e9e:	83 ec 04             	sub    $0x4,%esp
+  802ea1:	68 07 04 00 00       	push   $0x407
+  802ea6:	ff 75 f0             	push   -0x10(%ebp)
+  802ea9:	6a 00                	push   $0x0
+  802eab:	e8 12 df ff ff       	call   800dc2 <sys_page_alloc>
+  802eb0:	89 c3                	mov    %eax,%ebx
+  802eb2:	83 c4 10             	add    $0x10,%esp
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	0f 88 bc 00 00 00    	js     802f79 <pipe+0x131>
+	va = fd2data(fd0);
+  802ebd:	83 ec 0c             	sub    $0xc,%esp
+  802ec0:	ff 75 f4             	push   -0xc(%ebp)
+  802ec3:	e8 88 f0 ff ff       	call   801f50 <fd2data>
+  802ec8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802eca:	83 c4 0c             	add    $0xc,%esp
+  802ecd:	68 07 04 00 00       	push   $0x407
+  802ed2:	50                   	push   %eax
+  802ed3:	6a 00                	push   $0x0
+  802ed5:	e8 e8 de ff ff       	call   800dc2 <sys_page_alloc>
+  802eda:	89 c3                	mov    %eax,%ebx
+  802edc:	83 c4 10             	add    $0x10,%esp
+  802edf:	85 c0                	test   %eax,%eax
+  802ee1:	0f 88 82 00 00 00    	js     802f69 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ee7:	83 ec 0c             	sub    $0xc,%esp
+  802eea:	ff 75 f0             	push   -0x10(%ebp)
+  802eed:	e8 5e f0 ff ff       	call   801f50 <fd2data>
+  802ef2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ef9:	50                   	push   %eax
+  802efa:	6a 00                	push   $0x0
+  802efc:	56                   	push   %esi
+  802efd:	6a 00                	push   $0x0
+  802eff:	e8 2b df ff ff       	call   800e2f <sys_page_map>
+  802f04:	89 c3                	mov    %eax,%ebx
+  802f06:	83 c4 20             	add    $0x20,%esp
+  802f09:	85 c0                	test   %eax,%eax
+  802f0b:	78 4e                	js     802f5b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802f0d:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802f12:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f15:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802f17:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f1a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802f21:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f24:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802f26:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f29:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802f30:	83 ec 0c             	sub    $0xc,%esp
+  802f33:	ff 75 f4             	push   -0xc(%ebp)
+  802f36:	e8 05 f0 ff ff       	call   801f40 <fd2num>
+  802f3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f3e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802f40:	83 c4 04             	add    $0x4,%esp
+  802f43:	ff 75 f0             	push   -0x10(%ebp)
+  802f46:	e8 f5 ef ff ff       	call   801f40 <fd2num>
+  802f4b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f4e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802f51:	83 c4 10             	add    $0x10,%esp
+  802f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f59:	eb 2e                	jmp    802f89 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802f5b:	83 ec 08             	sub    $0x8,%esp
+  802f5e:	56                   	push   %esi
+  802f5f:	6a 00                	push   $0x0
+  802f61:	e8 37 df ff ff       	call   800e9d <sys_page_unmap>
+  802f66:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802f69:	83 ec 08             	sub    $0x8,%esp
+  802f6c:	ff 75 f0             	push   -0x10(%ebp)
+  802f6f:	6a 00                	push   $0x0
+  802f71:	e8 27 df ff ff       	call   800e9d <sys_page_unmap>
+  802f76:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802f79:	83 ec 08             	sub    $0x8,%esp
+  802f7c:	ff 75 f4             	push   -0xc(%ebp)
+  802f7f:	6a 00                	push   $0x0
+  802f81:	e8 17 df ff ff       	call   800e9d <sys_page_unmap>
+  802f86:	83 c4 10             	add    $0x10,%esp
+}
+  802f89:	89 d8                	mov    %ebx,%eax
+  802f8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f8e:	5b                   	pop    %ebx
+  802f8f:	5e                   	pop    %esi
+  802f90:	5d                   	pop    %ebp
+  802f91:	c3                   	ret
+
+00802f92 <pipeisclosed>:
+{
+  802f92:	55                   	push   %ebp
+  802f93:	89 e5                	mov    %esp,%ebp
+  802f95:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f98:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f9b:	50                   	push   %eax
+  802f9c:	ff 75 08             	push   0x8(%ebp)
+  802f9f:	e8 19 f0 ff ff       	call   801fbd <fd_lookup>
+  802fa4:	83 c4 10             	add    $0x10,%esp
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	78 18                	js     802fc3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802fab:	83 ec 0c             	sub    $0xc,%esp
+  802fae:	ff 75 f4             	push   -0xc(%ebp)
+  802fb1:	e8 9a ef ff ff       	call   801f50 <fd2data>
+  802fb6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802fb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fbb:	e8 cb fc ff ff       	call   802c8b <_pipeisclosed>
+  802fc0:	83 c4 10             	add    $0x10,%esp
+}
+  802fc3:	c9                   	leave
+  802fc4:	c3                   	ret
+
+00802fc5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fca:	c3                   	ret
+
+00802fcb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fcb:	55                   	push   %ebp
+  802fcc:	89 e5                	mov    %esp,%ebp
+  802fce:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802fd1:	68 76 39 80 00       	push   $0x803976
+  802fd6:	ff 75 0c             	push   0xc(%ebp)
+  802fd9:	e8 ec d8 ff ff       	call   8008ca <strcpy>
+	return 0;
+}
+  802fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe3:	c9                   	leave
+  802fe4:	c3                   	ret
+
+00802fe5 <devcons_write>:
+{
+  802fe5:	55                   	push   %ebp
+  802fe6:	89 e5                	mov    %esp,%ebp
+  802fe8:	57                   	push   %edi
+  802fe9:	56                   	push   %esi
+  802fea:	53                   	push   %ebx
+  802feb:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802ff1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802ff6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802ffc:	eb 2e                	jmp    80302c <devcons_write+0x47>
+		m = n - tot;
+  802ffe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803001:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803003:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803008:	39 c3                	cmp    %eax,%ebx
+  80300a:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80300d:	83 ec 04             	sub    $0x4,%esp
+  803010:	53                   	push   %ebx
+  803011:	89 f0                	mov    %esi,%eax
+  803013:	03 45 0c             	add    0xc(%ebp),%eax
+  803016:	50                   	push   %eax
+  803017:	57                   	push   %edi
+  803018:	e8 33 da ff ff       	call   800a50 <memmove>
+		sys_cputs(buf, m);
+  80301d:	83 c4 08             	add    $0x8,%esp
+  803020:	53                   	push   %ebx
+  803021:	57                   	push   %edi
+  803022:	e8 1c dc ff ff       	call   800c43 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803027:	01 de                	add    %ebx,%esi
+  803029:	83 c4 10             	add    $0x10,%esp
+  80302c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80302f:	72 cd                	jb     802ffe <devcons_write+0x19>
+}
+  803031:	89 f0                	mov    %esi,%eax
+  803033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803036:	5b                   	pop    %ebx
+  803037:	5e                   	pop    %esi
+  803038:	5f                   	pop    %edi
+  803039:	5d                   	pop    %ebp
+  80303a:	c3                   	ret
+
+0080303b <devcons_read>:
+{
+  80303b:	55                   	push   %ebp
+  80303c:	89 e5                	mov    %esp,%ebp
+  80303e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803041:	b8 00 00 00 00       	mov    $0x0,%eax
+  803046:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80304a:	75 07                	jne    803053 <devcons_read+0x18>
+  80304c:	eb 1f                	jmp    80306d <devcons_read+0x32>
+		sys_yield();
+  80304e:	e8 29 dd ff ff       	call   800d7c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803053:	e8 2f dc ff ff       	call   800c87 <sys_cgetc>
+  803058:	85 c0                	test   %eax,%eax
+  80305a:	74 f2                	je     80304e <devcons_read+0x13>
+	if (c < 0)
+  80305c:	78 0f                	js     80306d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80305e:	83 f8 04             	cmp    $0x4,%eax
+  803061:	74 0c                	je     80306f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803063:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803066:	88 02                	mov    %al,(%edx)
+	return 1;
+  803068:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80306d:	c9                   	leave
+  80306e:	c3                   	ret
+		return 0;
+  80306f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803074:	eb f7                	jmp    80306d <devcons_read+0x32>
+
+00803076 <cputchar>:
+{
+  803076:	55                   	push   %ebp
+  803077:	89 e5                	mov    %esp,%ebp
+  803079:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80307c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803082:	6a 01                	push   $0x1
+  803084:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803087:	50                   	push   %eax
+  803088:	e8 b6 db ff ff       	call   800c43 <sys_cputs>
+}
+  80308d:	83 c4 10             	add    $0x10,%esp
+  803090:	c9                   	leave
+  803091:	c3                   	ret
+
+00803092 <getchar>:
+{
+  803092:	55                   	push   %ebp
+  803093:	89 e5                	mov    %esp,%ebp
+  803095:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803098:	6a 01                	push   $0x1
+  80309a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80309d:	50                   	push   %eax
+  80309e:	6a 00                	push   $0x0
+  8030a0:	e8 9e f1 ff ff       	call   802243 <read>
+	if (r < 0)
+  8030a5:	83 c4 10             	add    $0x10,%esp
+  8030a8:	85 c0                	test   %eax,%eax
+  8030aa:	78 06                	js     8030b2 <getchar+0x20>
+	if (r < 1)
+  8030ac:	74 06                	je     8030b4 <getchar+0x22>
+	return c;
+  8030ae:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8030b2:	c9                   	leave
+  8030b3:	c3                   	ret
+		return -E_EOF;
+  8030b4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8030b9:	eb f7                	jmp    8030b2 <getchar+0x20>
+
+008030bb <iscons>:
+{
+  8030bb:	55                   	push   %ebp
+  8030bc:	89 e5                	mov    %esp,%ebp
+  8030be:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030c4:	50                   	push   %eax
+  8030c5:	ff 75 08             	push   0x8(%ebp)
+  8030c8:	e8 f0 ee ff ff       	call   801fbd <fd_lookup>
+  8030cd:	83 c4 10             	add    $0x10,%esp
+  8030d0:	85 c0                	test   %eax,%eax
+  8030d2:	78 11                	js     8030e5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8030d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030d7:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8030dd:	39 10                	cmp    %edx,(%eax)
+  8030df:	0f 94 c0             	sete   %al
+  8030e2:	0f b6 c0             	movzbl %al,%eax
+}
+  8030e5:	c9                   	leave
+  8030e6:	c3                   	ret
+
+008030e7 <opencons>:
+{
+  8030e7:	55                   	push   %ebp
+  8030e8:	89 e5                	mov    %esp,%ebp
+  8030ea:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8030ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030f0:	50                   	push   %eax
+  8030f1:	e8 71 ee ff ff       	call   801f67 <fd_alloc>
+  8030f6:	83 c4 10             	add    $0x10,%esp
+  8030f9:	85 c0                	test   %eax,%eax
+  8030fb:	78 3a                	js     803137 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8030fd:	83 ec 04             	sub    $0x4,%esp
+  803100:	68 07 04 00 00       	push   $0x407
+  803105:	ff 75 f4             	push   -0xc(%ebp)
+  803108:	6a 00                	push   $0x0
+  80310a:	e8 b3 dc ff ff       	call   800dc2 <sys_page_alloc>
+  80310f:	83 c4 10             	add    $0x10,%esp
+  803112:	85 c0                	test   %eax,%eax
+  803114:	78 21                	js     803137 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803116:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803119:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80311f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803121:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803124:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80312b:	83 ec 0c             	sub    $0xc,%esp
+  80312e:	50                   	push   %eax
+  80312f:	e8 0c ee ff ff       	call   801f40 <fd2num>
+  803134:	83 c4 10             	add    $0x10,%esp
+}
+  803137:	c9                   	leave
+  803138:	c3                   	ret
+
+00803139 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803139:	55                   	push   %ebp
+  80313a:	89 e5                	mov    %esp,%ebp
+  80313c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  80313f:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803146:	74 0a                	je     803152 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803148:	8b 45 08             	mov    0x8(%ebp),%eax
+  80314b:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803150:	c9                   	leave
+  803151:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803152:	83 ec 04             	sub    $0x4,%esp
+  803155:	6a 07                	push   $0x7
+  803157:	68 00 f0 bf ee       	push   $0xeebff000
+  80315c:	6a 00                	push   $0x0
+  80315e:	e8 5f dc ff ff       	call   800dc2 <sys_page_alloc>
+  803163:	83 c4 10             	add    $0x10,%esp
+  803166:	85 c0                	test   %eax,%eax
+  803168:	78 14                	js     80317e <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80316a:	83 ec 08             	sub    $0x8,%esp
+  80316d:	68 a0 31 80 00       	push   $0x8031a0
+  803172:	6a 00                	push   $0x0
+  803174:	e8 65 de ff ff       	call   800fde <sys_env_set_pgfault_upcall>
+  803179:	83 c4 10             	add    $0x10,%esp
+  80317c:	eb ca                	jmp    803148 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  80317e:	83 ec 08             	sub    $0x8,%esp
+  803181:	50                   	push   %eax
+  803182:	68 82 39 80 00       	push   $0x803982
+  803187:	e8 f6 d0 ff ff       	call   800282 <cprintf>
+			panic("set_pgfault_handler error");
+  80318c:	83 c4 0c             	add    $0xc,%esp
+  80318f:	68 8d 39 80 00       	push   $0x80398d
+  803194:	6a 24                	push   $0x24
+  803196:	68 a7 39 80 00       	push   $0x8039a7
+  80319b:	e8 07 d0 ff ff       	call   8001a7 <_panic>
+
+008031a0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8031a0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8031a1:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8031a6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8031a8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8031ab:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  8031af:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  8031b2:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  8031b6:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  8031b8:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  8031bc:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8031bd:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  8031c1:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  8031c2:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  8031c3:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8031c7:	c3                   	ret
+
+008031c8 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  8031c8:	55                   	push   %ebp
+  8031c9:	89 e5                	mov    %esp,%ebp
+  8031cb:	56                   	push   %esi
+  8031cc:	53                   	push   %ebx
+  8031cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8031d6:	85 c0                	test   %eax,%eax
+  8031d8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8031dd:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8031e0:	83 ec 08             	sub    $0x8,%esp
+  8031e3:	ff 75 14             	push   0x14(%ebp)
+  8031e6:	50                   	push   %eax
+  8031e7:	e8 e7 df ff ff       	call   8011d3 <sys_ipc_recv_until>
+  8031ec:	83 c4 10             	add    $0x10,%esp
+  8031ef:	85 c0                	test   %eax,%eax
+  8031f1:	78 61                	js     803254 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8031f3:	85 f6                	test   %esi,%esi
+  8031f5:	74 1c                	je     803213 <ipc_recv_until+0x4b>
+  8031f7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8031f9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8031fe:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803204:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803209:	76 5f                	jbe    80326a <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  80320b:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803211:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803213:	85 db                	test   %ebx,%ebx
+  803215:	74 1c                	je     803233 <ipc_recv_until+0x6b>
+  803217:	89 e0                	mov    %esp,%eax
+  803219:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80321e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803224:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803229:	76 50                	jbe    80327b <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80322b:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803231:	89 03                	mov    %eax,(%ebx)
+  803233:	89 e0                	mov    %esp,%eax
+  803235:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80323a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803240:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803245:	76 45                	jbe    80328c <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803247:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80324d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803250:	5b                   	pop    %ebx
+  803251:	5e                   	pop    %esi
+  803252:	5d                   	pop    %ebp
+  803253:	c3                   	ret
+		if (from_env_store)
+  803254:	85 f6                	test   %esi,%esi
+  803256:	74 06                	je     80325e <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803258:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  80325e:	85 db                	test   %ebx,%ebx
+  803260:	74 eb                	je     80324d <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803262:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803268:	eb e3                	jmp    80324d <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80326a:	c1 e8 10             	shr    $0x10,%eax
+  80326d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803273:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803279:	eb 90                	jmp    80320b <ipc_recv_until+0x43>
+  80327b:	c1 e8 10             	shr    $0x10,%eax
+  80327e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803284:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80328a:	eb 9f                	jmp    80322b <ipc_recv_until+0x63>
+  80328c:	c1 e8 10             	shr    $0x10,%eax
+  80328f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803295:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80329b:	eb aa                	jmp    803247 <ipc_recv_until+0x7f>
+
+0080329d <ipc_recv>:
+{
+  80329d:	55                   	push   %ebp
+  80329e:	89 e5                	mov    %esp,%ebp
+  8032a0:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8032a3:	6a 00                	push   $0x0
+  8032a5:	ff 75 10             	push   0x10(%ebp)
+  8032a8:	ff 75 0c             	push   0xc(%ebp)
+  8032ab:	ff 75 08             	push   0x8(%ebp)
+  8032ae:	e8 15 ff ff ff       	call   8031c8 <ipc_recv_until>
+}
+  8032b3:	c9                   	leave
+  8032b4:	c3                   	ret
+
+008032b5 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032b5:	55                   	push   %ebp
+  8032b6:	89 e5                	mov    %esp,%ebp
+  8032b8:	57                   	push   %edi
+  8032b9:	56                   	push   %esi
+  8032ba:	53                   	push   %ebx
+  8032bb:	83 ec 0c             	sub    $0xc,%esp
+  8032be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8032c7:	85 db                	test   %ebx,%ebx
+  8032c9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032ce:	0f 44 d8             	cmove  %eax,%ebx
+  8032d1:	eb 05                	jmp    8032d8 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8032d3:	e8 a4 da ff ff       	call   800d7c <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8032d8:	ff 75 14             	push   0x14(%ebp)
+  8032db:	53                   	push   %ebx
+  8032dc:	56                   	push   %esi
+  8032dd:	57                   	push   %edi
+  8032de:	e8 3c de ff ff       	call   80111f <sys_ipc_try_send>
+  8032e3:	83 c4 10             	add    $0x10,%esp
+  8032e6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032e9:	74 e8                	je     8032d3 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	78 08                	js     8032f7 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8032ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032f2:	5b                   	pop    %ebx
+  8032f3:	5e                   	pop    %esi
+  8032f4:	5f                   	pop    %edi
+  8032f5:	5d                   	pop    %ebp
+  8032f6:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8032f7:	50                   	push   %eax
+  8032f8:	68 b5 39 80 00       	push   $0x8039b5
+  8032fd:	6a 4f                	push   $0x4f
+  8032ff:	68 c8 39 80 00       	push   $0x8039c8
+  803304:	e8 9e ce ff ff       	call   8001a7 <_panic>
+
+00803309 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803309:	55                   	push   %ebp
+  80330a:	89 e5                	mov    %esp,%ebp
+  80330c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80330f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803314:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80331a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803320:	8b 52 50             	mov    0x50(%edx),%edx
+  803323:	39 ca                	cmp    %ecx,%edx
+  803325:	74 11                	je     803338 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803327:	83 c0 01             	add    $0x1,%eax
+  80332a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80332f:	75 e3                	jne    803314 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803331:	b8 00 00 00 00       	mov    $0x0,%eax
+  803336:	eb 0e                	jmp    803346 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803338:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80333e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803343:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803346:	5d                   	pop    %ebp
+  803347:	c3                   	ret
+
+00803348 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803348:	55                   	push   %ebp
+  803349:	89 e5                	mov    %esp,%ebp
+  80334b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80334e:	89 c2                	mov    %eax,%edx
+  803350:	c1 ea 16             	shr    $0x16,%edx
+  803353:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80335a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80335f:	f6 c1 01             	test   $0x1,%cl
+  803362:	74 1a                	je     80337e <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803364:	c1 e8 0c             	shr    $0xc,%eax
+  803367:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80336e:	a8 01                	test   $0x1,%al
+  803370:	74 0c                	je     80337e <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803372:	c1 e8 0c             	shr    $0xc,%eax
+  803375:	c1 e0 04             	shl    $0x4,%eax
+  803378:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80337e:	89 d0                	mov    %edx,%eax
+  803380:	5d                   	pop    %ebp
+  803381:	c3                   	ret
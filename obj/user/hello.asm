@@ -0,0 +1,6183 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 50 00 00 00       	call   800081 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("hello, world\n");
+  800039:	68 a0 2b 80 00       	push   $0x802ba0
+  80003e:	e8 dd 01 00 00       	call   800220 <cprintf>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800043:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800045:	05 00 00 00 20       	add    $0x20000000,%eax
+  80004a:	83 c4 10             	add    $0x10,%esp
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80004d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800053:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800058:	76 16                	jbe    800070 <umain+0x3d>
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  80005a:	8b 42 48             	mov    0x48(%edx),%eax
+  80005d:	83 ec 08             	sub    $0x8,%esp
+  800060:	50                   	push   %eax
+  800061:	68 ae 2b 80 00       	push   $0x802bae
+  800066:	e8 b5 01 00 00       	call   800220 <cprintf>
+}
+  80006b:	83 c4 10             	add    $0x10,%esp
+  80006e:	c9                   	leave
+  80006f:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800070:	c1 e8 10             	shr    $0x10,%eax
+  800073:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800079:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80007f:	eb d9                	jmp    80005a <umain+0x27>
+
+00800081 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800081:	55                   	push   %ebp
+  800082:	89 e5                	mov    %esp,%ebp
+  800084:	57                   	push   %edi
+  800085:	56                   	push   %esi
+  800086:	53                   	push   %ebx
+  800087:	83 ec 0c             	sub    $0xc,%esp
+  80008a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80008d:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800090:	b8 01 00 00 00       	mov    $0x1,%eax
+  800095:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800097:	c1 ea 0b             	shr    $0xb,%edx
+  80009a:	83 f2 01             	xor    $0x1,%edx
+  80009d:	83 e2 01             	and    $0x1,%edx
+  8000a0:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000a6:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000ad:	00 00 00 
+	envid = sys_getenvid();
+  8000b0:	e8 1f 0c 00 00       	call   800cd4 <sys_getenvid>
+  8000b5:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000bc:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8000c2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000c8:	8b 52 48             	mov    0x48(%edx),%edx
+  8000cb:	39 ca                	cmp    %ecx,%edx
+  8000cd:	74 27                	je     8000f6 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8000cf:	83 c0 01             	add    $0x1,%eax
+  8000d2:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000d7:	75 e3                	jne    8000bc <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000d9:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000e0:	75 24                	jne    800106 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000e2:	83 ec 04             	sub    $0x4,%esp
+  8000e5:	68 c8 2b 80 00       	push   $0x802bc8
+  8000ea:	6a 23                	push   $0x23
+  8000ec:	68 eb 2b 80 00       	push   $0x802beb
+  8000f1:	e8 4f 00 00 00       	call   800145 <_panic>
+			mainenv = &envs[i];
+  8000f6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800101:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800106:	85 ff                	test   %edi,%edi
+  800108:	7e 07                	jle    800111 <libmain+0x90>
+		binaryname = argv[0];
+  80010a:	8b 06                	mov    (%esi),%eax
+  80010c:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800111:	83 ec 08             	sub    $0x8,%esp
+  800114:	56                   	push   %esi
+  800115:	57                   	push   %edi
+  800116:	e8 18 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80011b:	e8 0b 00 00 00       	call   80012b <exit>
+}
+  800120:	83 c4 10             	add    $0x10,%esp
+  800123:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800126:	5b                   	pop    %ebx
+  800127:	5e                   	pop    %esi
+  800128:	5f                   	pop    %edi
+  800129:	5d                   	pop    %ebp
+  80012a:	c3                   	ret
+
+0080012b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012b:	55                   	push   %ebp
+  80012c:	89 e5                	mov    %esp,%ebp
+  80012e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800131:	e8 94 18 00 00       	call   8019ca <close_all>
+	sys_env_destroy(0);
+  800136:	83 ec 0c             	sub    $0xc,%esp
+  800139:	6a 00                	push   $0x0
+  80013b:	e8 2b 0b 00 00       	call   800c6b <sys_env_destroy>
+}
+  800140:	83 c4 10             	add    $0x10,%esp
+  800143:	c9                   	leave
+  800144:	c3                   	ret
+
+00800145 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800145:	55                   	push   %ebp
+  800146:	89 e5                	mov    %esp,%ebp
+  800148:	56                   	push   %esi
+  800149:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80014a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80014d:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800153:	e8 7c 0b 00 00       	call   800cd4 <sys_getenvid>
+  800158:	83 ec 0c             	sub    $0xc,%esp
+  80015b:	ff 75 0c             	push   0xc(%ebp)
+  80015e:	ff 75 08             	push   0x8(%ebp)
+  800161:	56                   	push   %esi
+  800162:	50                   	push   %eax
+  800163:	68 04 2c 80 00       	push   $0x802c04
+  800168:	e8 b3 00 00 00       	call   800220 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80016d:	83 c4 18             	add    $0x18,%esp
+  800170:	53                   	push   %ebx
+  800171:	ff 75 10             	push   0x10(%ebp)
+  800174:	e8 56 00 00 00       	call   8001cf <vcprintf>
+	cprintf("\n");
+  800179:	c7 04 24 8c 30 80 00 	movl   $0x80308c,(%esp)
+  800180:	e8 9b 00 00 00       	call   800220 <cprintf>
+  800185:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800188:	cc                   	int3
+	while (1)
+  800189:	eb fd                	jmp    800188 <_panic+0x43>
+
+0080018b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80018b:	55                   	push   %ebp
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	53                   	push   %ebx
+  80018f:	83 ec 04             	sub    $0x4,%esp
+  800192:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800195:	8b 13                	mov    (%ebx),%edx
+  800197:	8d 42 01             	lea    0x1(%edx),%eax
+  80019a:	89 03                	mov    %eax,(%ebx)
+  80019c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80019f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001a3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001a8:	74 09                	je     8001b3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001aa:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b1:	c9                   	leave
+  8001b2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001b3:	83 ec 08             	sub    $0x8,%esp
+  8001b6:	68 ff 00 00 00       	push   $0xff
+  8001bb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001be:	50                   	push   %eax
+  8001bf:	e8 1d 0a 00 00       	call   800be1 <sys_cputs>
+		b->idx = 0;
+  8001c4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001ca:	83 c4 10             	add    $0x10,%esp
+  8001cd:	eb db                	jmp    8001aa <putch+0x1f>
+
+008001cf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001cf:	55                   	push   %ebp
+  8001d0:	89 e5                	mov    %esp,%ebp
+  8001d2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001d8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001df:	00 00 00 
+	b.cnt = 0;
+  8001e2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001e9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001ec:	ff 75 0c             	push   0xc(%ebp)
+  8001ef:	ff 75 08             	push   0x8(%ebp)
+  8001f2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001f8:	50                   	push   %eax
+  8001f9:	68 8b 01 80 00       	push   $0x80018b
+  8001fe:	e8 fb 00 00 00       	call   8002fe <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800203:	83 c4 08             	add    $0x8,%esp
+  800206:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80020c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 c9 09 00 00       	call   800be1 <sys_cputs>
+
+	return b.cnt;
+}
+  800218:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80021e:	c9                   	leave
+  80021f:	c3                   	ret
+
+00800220 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800226:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800229:	50                   	push   %eax
+  80022a:	ff 75 08             	push   0x8(%ebp)
+  80022d:	e8 9d ff ff ff       	call   8001cf <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800232:	c9                   	leave
+  800233:	c3                   	ret
+
+00800234 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	57                   	push   %edi
+  800238:	56                   	push   %esi
+  800239:	53                   	push   %ebx
+  80023a:	83 ec 1c             	sub    $0x1c,%esp
+  80023d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800240:	89 d6                	mov    %edx,%esi
+  800242:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800245:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800248:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80024b:	73 0b                	jae    800258 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80024d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800250:	c1 e7 08             	shl    $0x8,%edi
+  800253:	0b 7d 10             	or     0x10(%ebp),%edi
+  800256:	eb 36                	jmp    80028e <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800258:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80025b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800260:	f7 75 08             	divl   0x8(%ebp)
+  800263:	89 c1                	mov    %eax,%ecx
+  800265:	ff 75 14             	push   0x14(%ebp)
+  800268:	ff 75 10             	push   0x10(%ebp)
+  80026b:	83 eb 01             	sub    $0x1,%ebx
+  80026e:	53                   	push   %ebx
+  80026f:	ff 75 08             	push   0x8(%ebp)
+  800272:	89 f2                	mov    %esi,%edx
+  800274:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800277:	e8 b8 ff ff ff       	call   800234 <printnum>
+  80027c:	83 c4 10             	add    $0x10,%esp
+  80027f:	eb 14                	jmp    800295 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800281:	83 ec 08             	sub    $0x8,%esp
+  800284:	56                   	push   %esi
+  800285:	57                   	push   %edi
+  800286:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800289:	ff d0                	call   *%eax
+  80028b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80028e:	83 eb 01             	sub    $0x1,%ebx
+  800291:	85 db                	test   %ebx,%ebx
+  800293:	7f ec                	jg     800281 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800295:	83 ec 08             	sub    $0x8,%esp
+  800298:	56                   	push   %esi
+  800299:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80029c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a1:	f7 75 08             	divl   0x8(%ebp)
+  8002a4:	0f be 92 27 2c 80 00 	movsbl 0x802c27(%edx),%edx
+  8002ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ae:	c1 e0 08             	shl    $0x8,%eax
+  8002b1:	09 d0                	or     %edx,%eax
+  8002b3:	50                   	push   %eax
+  8002b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002b7:	ff d0                	call   *%eax
+}
+  8002b9:	83 c4 10             	add    $0x10,%esp
+  8002bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002bf:	5b                   	pop    %ebx
+  8002c0:	5e                   	pop    %esi
+  8002c1:	5f                   	pop    %edi
+  8002c2:	5d                   	pop    %ebp
+  8002c3:	c3                   	ret
+
+008002c4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c4:	55                   	push   %ebp
+  8002c5:	89 e5                	mov    %esp,%ebp
+  8002c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002ca:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002ce:	8b 10                	mov    (%eax),%edx
+  8002d0:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d3:	73 0a                	jae    8002df <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002d5:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d8:	89 08                	mov    %ecx,(%eax)
+  8002da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002dd:	88 02                	mov    %al,(%edx)
+}
+  8002df:	5d                   	pop    %ebp
+  8002e0:	c3                   	ret
+
+008002e1 <printfmt>:
+{
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002e7:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002ea:	50                   	push   %eax
+  8002eb:	ff 75 10             	push   0x10(%ebp)
+  8002ee:	ff 75 0c             	push   0xc(%ebp)
+  8002f1:	ff 75 08             	push   0x8(%ebp)
+  8002f4:	e8 05 00 00 00       	call   8002fe <vprintfmt>
+}
+  8002f9:	83 c4 10             	add    $0x10,%esp
+  8002fc:	c9                   	leave
+  8002fd:	c3                   	ret
+
+008002fe <vprintfmt>:
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	57                   	push   %edi
+  800302:	56                   	push   %esi
+  800303:	53                   	push   %ebx
+  800304:	83 ec 3c             	sub    $0x3c,%esp
+  800307:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80030a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80030d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800314:	eb 16                	jmp    80032c <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800316:	83 ec 08             	sub    $0x8,%esp
+  800319:	ff 75 0c             	push   0xc(%ebp)
+  80031c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80031f:	c1 e2 08             	shl    $0x8,%edx
+  800322:	09 d0                	or     %edx,%eax
+  800324:	50                   	push   %eax
+  800325:	ff d7                	call   *%edi
+  800327:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80032a:	89 de                	mov    %ebx,%esi
+  80032c:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80032f:	0f b6 06             	movzbl (%esi),%eax
+  800332:	83 f8 25             	cmp    $0x25,%eax
+  800335:	74 0c                	je     800343 <vprintfmt+0x45>
+			if (ch == '\0')
+  800337:	85 c0                	test   %eax,%eax
+  800339:	75 db                	jne    800316 <vprintfmt+0x18>
+}
+  80033b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033e:	5b                   	pop    %ebx
+  80033f:	5e                   	pop    %esi
+  800340:	5f                   	pop    %edi
+  800341:	5d                   	pop    %ebp
+  800342:	c3                   	ret
+		padc = ' ';
+  800343:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800347:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80034e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800355:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80035c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800361:	8d 73 01             	lea    0x1(%ebx),%esi
+  800364:	0f b6 13             	movzbl (%ebx),%edx
+  800367:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80036a:	3c 55                	cmp    $0x55,%al
+  80036c:	0f 87 2c 04 00 00    	ja     80079e <vprintfmt+0x4a0>
+  800372:	0f b6 c0             	movzbl %al,%eax
+  800375:	ff 24 85 80 2d 80 00 	jmp    *0x802d80(,%eax,4)
+  80037c:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80037e:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800382:	eb dd                	jmp    800361 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800384:	89 f3                	mov    %esi,%ebx
+  800386:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80038a:	eb d5                	jmp    800361 <vprintfmt+0x63>
+  80038c:	0f b6 d2             	movzbl %dl,%edx
+  80038f:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800391:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800396:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800399:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80039d:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003a0:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003a3:	83 fe 09             	cmp    $0x9,%esi
+  8003a6:	0f 87 8a 00 00 00    	ja     800436 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003ac:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003af:	eb e5                	jmp    800396 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b4:	8b 00                	mov    (%eax),%eax
+  8003b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8003bf:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c2:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8003c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003c8:	79 97                	jns    800361 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8003ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d7:	eb 88                	jmp    800361 <vprintfmt+0x63>
+			if (width < 0)
+  8003d9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003dc:	85 db                	test   %ebx,%ebx
+  8003de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e3:	0f 49 c3             	cmovns %ebx,%eax
+  8003e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e9:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003eb:	e9 71 ff ff ff       	jmp    800361 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f0:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003f2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003f9:	e9 63 ff ff ff       	jmp    800361 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003fe:	8d 73 02             	lea    0x2(%ebx),%esi
+  800401:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800405:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80040c:	3c 67                	cmp    $0x67,%al
+  80040e:	0f 84 18 ff ff ff    	je     80032c <vprintfmt+0x2e>
+					attrib = 0x04;
+  800414:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80041b:	3c 72                	cmp    $0x72,%al
+  80041d:	0f 84 09 ff ff ff    	je     80032c <vprintfmt+0x2e>
+					attrib = 0x00;
+  800423:	3c 62                	cmp    $0x62,%al
+  800425:	0f 94 c0             	sete   %al
+  800428:	0f b6 c0             	movzbl %al,%eax
+  80042b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80042e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800431:	e9 f6 fe ff ff       	jmp    80032c <vprintfmt+0x2e>
+  800436:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800439:	eb 89                	jmp    8003c4 <vprintfmt+0xc6>
+			lflag++;
+  80043b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80043e:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800440:	e9 1c ff ff ff       	jmp    800361 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800445:	8b 45 14             	mov    0x14(%ebp),%eax
+  800448:	8d 58 04             	lea    0x4(%eax),%ebx
+  80044b:	83 ec 08             	sub    $0x8,%esp
+  80044e:	ff 75 0c             	push   0xc(%ebp)
+  800451:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800454:	c1 e0 08             	shl    $0x8,%eax
+  800457:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80045a:	0b 01                	or     (%ecx),%eax
+  80045c:	50                   	push   %eax
+  80045d:	ff d7                	call   *%edi
+			break;
+  80045f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800462:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800465:	e9 c2 fe ff ff       	jmp    80032c <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80046a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046d:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800470:	8b 10                	mov    (%eax),%edx
+  800472:	89 d0                	mov    %edx,%eax
+  800474:	f7 d8                	neg    %eax
+  800476:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800479:	83 f8 12             	cmp    $0x12,%eax
+  80047c:	7f 25                	jg     8004a3 <vprintfmt+0x1a5>
+  80047e:	8b 14 85 e0 2e 80 00 	mov    0x802ee0(,%eax,4),%edx
+  800485:	85 d2                	test   %edx,%edx
+  800487:	74 1a                	je     8004a3 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800489:	52                   	push   %edx
+  80048a:	68 21 30 80 00       	push   $0x803021
+  80048f:	ff 75 0c             	push   0xc(%ebp)
+  800492:	57                   	push   %edi
+  800493:	e8 49 fe ff ff       	call   8002e1 <printfmt>
+  800498:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80049b:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80049e:	e9 89 fe ff ff       	jmp    80032c <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004a3:	50                   	push   %eax
+  8004a4:	68 3f 2c 80 00       	push   $0x802c3f
+  8004a9:	ff 75 0c             	push   0xc(%ebp)
+  8004ac:	57                   	push   %edi
+  8004ad:	e8 2f fe ff ff       	call   8002e1 <printfmt>
+  8004b2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b5:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004b8:	e9 6f fe ff ff       	jmp    80032c <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c0:	83 c0 04             	add    $0x4,%eax
+  8004c3:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8004c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c9:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004cb:	85 c9                	test   %ecx,%ecx
+  8004cd:	b8 38 2c 80 00       	mov    $0x802c38,%eax
+  8004d2:	0f 45 c1             	cmovne %ecx,%eax
+  8004d5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004dc:	7e 06                	jle    8004e4 <vprintfmt+0x1e6>
+  8004de:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004e2:	75 1a                	jne    8004fe <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004e7:	c1 e0 08             	shl    $0x8,%eax
+  8004ea:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004ed:	83 c8 3f             	or     $0x3f,%eax
+  8004f0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004f3:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004f6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004f9:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004fc:	eb 6d                	jmp    80056b <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	ff 75 d0             	push   -0x30(%ebp)
+  800504:	ff 75 c8             	push   -0x38(%ebp)
+  800507:	e8 39 03 00 00       	call   800845 <strnlen>
+  80050c:	89 c2                	mov    %eax,%edx
+  80050e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800511:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800513:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800516:	c1 e1 08             	shl    $0x8,%ecx
+  800519:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80051d:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80051f:	83 c4 10             	add    $0x10,%esp
+  800522:	89 c3                	mov    %eax,%ebx
+  800524:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800527:	89 75 10             	mov    %esi,0x10(%ebp)
+  80052a:	89 ce                	mov    %ecx,%esi
+  80052c:	eb 0f                	jmp    80053d <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	ff 75 0c             	push   0xc(%ebp)
+  800534:	56                   	push   %esi
+  800535:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800537:	83 eb 01             	sub    $0x1,%ebx
+  80053a:	83 c4 10             	add    $0x10,%esp
+  80053d:	85 db                	test   %ebx,%ebx
+  80053f:	7f ed                	jg     80052e <vprintfmt+0x230>
+  800541:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800544:	8b 75 10             	mov    0x10(%ebp),%esi
+  800547:	85 c0                	test   %eax,%eax
+  800549:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054e:	0f 49 d0             	cmovns %eax,%edx
+  800551:	29 d0                	sub    %edx,%eax
+  800553:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800556:	eb 8c                	jmp    8004e4 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800558:	83 ec 08             	sub    $0x8,%esp
+  80055b:	ff 75 0c             	push   0xc(%ebp)
+  80055e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800561:	09 c2                	or     %eax,%edx
+  800563:	52                   	push   %edx
+  800564:	ff d7                	call   *%edi
+  800566:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800569:	89 d9                	mov    %ebx,%ecx
+  80056b:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80056e:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800572:	0f be d0             	movsbl %al,%edx
+  800575:	85 d2                	test   %edx,%edx
+  800577:	74 2a                	je     8005a3 <vprintfmt+0x2a5>
+  800579:	85 f6                	test   %esi,%esi
+  80057b:	78 05                	js     800582 <vprintfmt+0x284>
+  80057d:	83 ee 01             	sub    $0x1,%esi
+  800580:	78 3b                	js     8005bd <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800582:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800586:	74 d0                	je     800558 <vprintfmt+0x25a>
+  800588:	0f be c0             	movsbl %al,%eax
+  80058b:	83 e8 20             	sub    $0x20,%eax
+  80058e:	83 f8 5e             	cmp    $0x5e,%eax
+  800591:	76 c5                	jbe    800558 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800593:	83 ec 08             	sub    $0x8,%esp
+  800596:	ff 75 0c             	push   0xc(%ebp)
+  800599:	ff 75 cc             	push   -0x34(%ebp)
+  80059c:	ff d7                	call   *%edi
+  80059e:	83 c4 10             	add    $0x10,%esp
+  8005a1:	eb c6                	jmp    800569 <vprintfmt+0x26b>
+  8005a3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005a6:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ac:	01 c3                	add    %eax,%ebx
+  8005ae:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005b0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005b3:	83 c8 20             	or     $0x20,%eax
+  8005b6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005b9:	89 c6                	mov    %eax,%esi
+  8005bb:	eb 14                	jmp    8005d1 <vprintfmt+0x2d3>
+  8005bd:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005c0:	eb e4                	jmp    8005a6 <vprintfmt+0x2a8>
+  8005c2:	83 ec 08             	sub    $0x8,%esp
+  8005c5:	ff 75 0c             	push   0xc(%ebp)
+  8005c8:	56                   	push   %esi
+  8005c9:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005cb:	83 eb 01             	sub    $0x1,%ebx
+  8005ce:	83 c4 10             	add    $0x10,%esp
+  8005d1:	85 db                	test   %ebx,%ebx
+  8005d3:	7f ed                	jg     8005c2 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005d5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005d8:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005de:	e9 49 fd ff ff       	jmp    80032c <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005e3:	83 f9 01             	cmp    $0x1,%ecx
+  8005e6:	7f 1f                	jg     800607 <vprintfmt+0x309>
+	else if (lflag)
+  8005e8:	85 c9                	test   %ecx,%ecx
+  8005ea:	74 69                	je     800655 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ef:	8b 00                	mov    (%eax),%eax
+  8005f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f4:	89 c1                	mov    %eax,%ecx
+  8005f6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800602:	89 45 14             	mov    %eax,0x14(%ebp)
+  800605:	eb 17                	jmp    80061e <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 50 04             	mov    0x4(%eax),%edx
+  80060d:	8b 00                	mov    (%eax),%eax
+  80060f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800612:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8d 40 08             	lea    0x8(%eax),%eax
+  80061b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80061e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800621:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800624:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800629:	85 db                	test   %ebx,%ebx
+  80062b:	0f 89 f6 00 00 00    	jns    800727 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800631:	83 ec 08             	sub    $0x8,%esp
+  800634:	ff 75 0c             	push   0xc(%ebp)
+  800637:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80063a:	c1 e0 08             	shl    $0x8,%eax
+  80063d:	83 c8 2d             	or     $0x2d,%eax
+  800640:	50                   	push   %eax
+  800641:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800643:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800646:	f7 d9                	neg    %ecx
+  800648:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80064b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800650:	e9 d2 00 00 00       	jmp    800727 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800655:	8b 45 14             	mov    0x14(%ebp),%eax
+  800658:	8b 00                	mov    (%eax),%eax
+  80065a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80065d:	89 c1                	mov    %eax,%ecx
+  80065f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800662:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800665:	8b 45 14             	mov    0x14(%ebp),%eax
+  800668:	8d 40 04             	lea    0x4(%eax),%eax
+  80066b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066e:	eb ae                	jmp    80061e <vprintfmt+0x320>
+	if (lflag >= 2)
+  800670:	83 f9 01             	cmp    $0x1,%ecx
+  800673:	7f 19                	jg     80068e <vprintfmt+0x390>
+	else if (lflag)
+  800675:	85 c9                	test   %ecx,%ecx
+  800677:	74 2a                	je     8006a3 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	8b 08                	mov    (%eax),%ecx
+  80067e:	8d 40 04             	lea    0x4(%eax),%eax
+  800681:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800684:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800689:	e9 99 00 00 00       	jmp    800727 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 08                	mov    (%eax),%ecx
+  800693:	8d 40 08             	lea    0x8(%eax),%eax
+  800696:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800699:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80069e:	e9 84 00 00 00       	jmp    800727 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 08                	mov    (%eax),%ecx
+  8006a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006b3:	eb 72                	jmp    800727 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006b5:	83 f9 01             	cmp    $0x1,%ecx
+  8006b8:	7f 16                	jg     8006d0 <vprintfmt+0x3d2>
+	else if (lflag)
+  8006ba:	85 c9                	test   %ecx,%ecx
+  8006bc:	74 24                	je     8006e2 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8b 08                	mov    (%eax),%ecx
+  8006c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006c9:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8006ce:	eb 57                	jmp    800727 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d3:	8b 08                	mov    (%eax),%ecx
+  8006d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006db:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006e0:	eb 45                	jmp    800727 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	8b 08                	mov    (%eax),%ecx
+  8006e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ed:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006f2:	eb 33                	jmp    800727 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006f4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006f7:	c1 e3 08             	shl    $0x8,%ebx
+  8006fa:	83 ec 08             	sub    $0x8,%esp
+  8006fd:	ff 75 0c             	push   0xc(%ebp)
+  800700:	89 d8                	mov    %ebx,%eax
+  800702:	83 c8 30             	or     $0x30,%eax
+  800705:	50                   	push   %eax
+  800706:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800708:	83 c4 08             	add    $0x8,%esp
+  80070b:	ff 75 0c             	push   0xc(%ebp)
+  80070e:	83 cb 78             	or     $0x78,%ebx
+  800711:	53                   	push   %ebx
+  800712:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800714:	8b 45 14             	mov    0x14(%ebp),%eax
+  800717:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800719:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80071c:	8d 40 04             	lea    0x4(%eax),%eax
+  80071f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800722:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800727:	ff 75 e4             	push   -0x1c(%ebp)
+  80072a:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80072e:	52                   	push   %edx
+  80072f:	ff 75 e0             	push   -0x20(%ebp)
+  800732:	50                   	push   %eax
+  800733:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800736:	89 f8                	mov    %edi,%eax
+  800738:	e8 f7 fa ff ff       	call   800234 <printnum>
+			break;
+  80073d:	83 c4 10             	add    $0x10,%esp
+  800740:	e9 e7 fb ff ff       	jmp    80032c <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800745:	83 f9 01             	cmp    $0x1,%ecx
+  800748:	7f 16                	jg     800760 <vprintfmt+0x462>
+	else if (lflag)
+  80074a:	85 c9                	test   %ecx,%ecx
+  80074c:	74 24                	je     800772 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 08                	mov    (%eax),%ecx
+  800753:	8d 40 04             	lea    0x4(%eax),%eax
+  800756:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800759:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80075e:	eb c7                	jmp    800727 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 08                	mov    (%eax),%ecx
+  800765:	8d 40 08             	lea    0x8(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076b:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800770:	eb b5                	jmp    800727 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 08                	mov    (%eax),%ecx
+  800777:	8d 40 04             	lea    0x4(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80077d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800782:	eb a3                	jmp    800727 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800784:	83 ec 08             	sub    $0x8,%esp
+  800787:	ff 75 0c             	push   0xc(%ebp)
+  80078a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80078d:	c1 e0 08             	shl    $0x8,%eax
+  800790:	83 c8 25             	or     $0x25,%eax
+  800793:	50                   	push   %eax
+  800794:	ff d7                	call   *%edi
+			break;
+  800796:	83 c4 10             	add    $0x10,%esp
+  800799:	e9 8e fb ff ff       	jmp    80032c <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80079e:	83 ec 08             	sub    $0x8,%esp
+  8007a1:	ff 75 0c             	push   0xc(%ebp)
+  8007a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007a7:	c1 e0 08             	shl    $0x8,%eax
+  8007aa:	83 c8 25             	or     $0x25,%eax
+  8007ad:	50                   	push   %eax
+  8007ae:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007b0:	83 c4 10             	add    $0x10,%esp
+  8007b3:	89 de                	mov    %ebx,%esi
+  8007b5:	eb 03                	jmp    8007ba <vprintfmt+0x4bc>
+  8007b7:	83 ee 01             	sub    $0x1,%esi
+  8007ba:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007be:	75 f7                	jne    8007b7 <vprintfmt+0x4b9>
+  8007c0:	e9 67 fb ff ff       	jmp    80032c <vprintfmt+0x2e>
+
+008007c5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007c5:	55                   	push   %ebp
+  8007c6:	89 e5                	mov    %esp,%ebp
+  8007c8:	83 ec 18             	sub    $0x18,%esp
+  8007cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007d4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007d8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007db:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007e2:	85 c0                	test   %eax,%eax
+  8007e4:	74 26                	je     80080c <vsnprintf+0x47>
+  8007e6:	85 d2                	test   %edx,%edx
+  8007e8:	7e 22                	jle    80080c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007ea:	ff 75 14             	push   0x14(%ebp)
+  8007ed:	ff 75 10             	push   0x10(%ebp)
+  8007f0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007f3:	50                   	push   %eax
+  8007f4:	68 c4 02 80 00       	push   $0x8002c4
+  8007f9:	e8 00 fb ff ff       	call   8002fe <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800801:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800804:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800807:	83 c4 10             	add    $0x10,%esp
+}
+  80080a:	c9                   	leave
+  80080b:	c3                   	ret
+		return -E_INVAL;
+  80080c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800811:	eb f7                	jmp    80080a <vsnprintf+0x45>
+
+00800813 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800813:	55                   	push   %ebp
+  800814:	89 e5                	mov    %esp,%ebp
+  800816:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800819:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80081c:	50                   	push   %eax
+  80081d:	ff 75 10             	push   0x10(%ebp)
+  800820:	ff 75 0c             	push   0xc(%ebp)
+  800823:	ff 75 08             	push   0x8(%ebp)
+  800826:	e8 9a ff ff ff       	call   8007c5 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80082b:	c9                   	leave
+  80082c:	c3                   	ret
+
+0080082d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80082d:	55                   	push   %ebp
+  80082e:	89 e5                	mov    %esp,%ebp
+  800830:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800833:	b8 00 00 00 00       	mov    $0x0,%eax
+  800838:	eb 03                	jmp    80083d <strlen+0x10>
+		n++;
+  80083a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80083d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800841:	75 f7                	jne    80083a <strlen+0xd>
+	return n;
+}
+  800843:	5d                   	pop    %ebp
+  800844:	c3                   	ret
+
+00800845 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800845:	55                   	push   %ebp
+  800846:	89 e5                	mov    %esp,%ebp
+  800848:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80084b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80084e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800853:	eb 03                	jmp    800858 <strnlen+0x13>
+		n++;
+  800855:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800858:	39 d0                	cmp    %edx,%eax
+  80085a:	74 08                	je     800864 <strnlen+0x1f>
+  80085c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800860:	75 f3                	jne    800855 <strnlen+0x10>
+  800862:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800864:	89 d0                	mov    %edx,%eax
+  800866:	5d                   	pop    %ebp
+  800867:	c3                   	ret
+
+00800868 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	53                   	push   %ebx
+  80086c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80086f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800872:	b8 00 00 00 00       	mov    $0x0,%eax
+  800877:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80087b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80087e:	83 c0 01             	add    $0x1,%eax
+  800881:	84 d2                	test   %dl,%dl
+  800883:	75 f2                	jne    800877 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800885:	89 c8                	mov    %ecx,%eax
+  800887:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80088a:	c9                   	leave
+  80088b:	c3                   	ret
+
+0080088c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80088c:	55                   	push   %ebp
+  80088d:	89 e5                	mov    %esp,%ebp
+  80088f:	53                   	push   %ebx
+  800890:	83 ec 10             	sub    $0x10,%esp
+  800893:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800896:	53                   	push   %ebx
+  800897:	e8 91 ff ff ff       	call   80082d <strlen>
+  80089c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80089f:	ff 75 0c             	push   0xc(%ebp)
+  8008a2:	01 d8                	add    %ebx,%eax
+  8008a4:	50                   	push   %eax
+  8008a5:	e8 be ff ff ff       	call   800868 <strcpy>
+	return dst;
+}
+  8008aa:	89 d8                	mov    %ebx,%eax
+  8008ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008af:	c9                   	leave
+  8008b0:	c3                   	ret
+
+008008b1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	56                   	push   %esi
+  8008b5:	53                   	push   %ebx
+  8008b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008bc:	89 f3                	mov    %esi,%ebx
+  8008be:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008c1:	89 f0                	mov    %esi,%eax
+  8008c3:	eb 0f                	jmp    8008d4 <strncpy+0x23>
+		*dst++ = *src;
+  8008c5:	83 c0 01             	add    $0x1,%eax
+  8008c8:	0f b6 0a             	movzbl (%edx),%ecx
+  8008cb:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008ce:	80 f9 01             	cmp    $0x1,%cl
+  8008d1:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008d4:	39 d8                	cmp    %ebx,%eax
+  8008d6:	75 ed                	jne    8008c5 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008d8:	89 f0                	mov    %esi,%eax
+  8008da:	5b                   	pop    %ebx
+  8008db:	5e                   	pop    %esi
+  8008dc:	5d                   	pop    %ebp
+  8008dd:	c3                   	ret
+
+008008de <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008de:	55                   	push   %ebp
+  8008df:	89 e5                	mov    %esp,%ebp
+  8008e1:	56                   	push   %esi
+  8008e2:	53                   	push   %ebx
+  8008e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e9:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008ec:	89 f0                	mov    %esi,%eax
+  8008ee:	85 d2                	test   %edx,%edx
+  8008f0:	74 21                	je     800913 <strlcpy+0x35>
+  8008f2:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008f6:	89 f2                	mov    %esi,%edx
+  8008f8:	eb 09                	jmp    800903 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008fa:	83 c1 01             	add    $0x1,%ecx
+  8008fd:	83 c2 01             	add    $0x1,%edx
+  800900:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800903:	39 c2                	cmp    %eax,%edx
+  800905:	74 09                	je     800910 <strlcpy+0x32>
+  800907:	0f b6 19             	movzbl (%ecx),%ebx
+  80090a:	84 db                	test   %bl,%bl
+  80090c:	75 ec                	jne    8008fa <strlcpy+0x1c>
+  80090e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800910:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800913:	29 f0                	sub    %esi,%eax
+}
+  800915:	5b                   	pop    %ebx
+  800916:	5e                   	pop    %esi
+  800917:	5d                   	pop    %ebp
+  800918:	c3                   	ret
+
+00800919 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800922:	eb 06                	jmp    80092a <strcmp+0x11>
+		p++, q++;
+  800924:	83 c1 01             	add    $0x1,%ecx
+  800927:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80092a:	0f b6 01             	movzbl (%ecx),%eax
+  80092d:	84 c0                	test   %al,%al
+  80092f:	74 04                	je     800935 <strcmp+0x1c>
+  800931:	3a 02                	cmp    (%edx),%al
+  800933:	74 ef                	je     800924 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800935:	0f b6 c0             	movzbl %al,%eax
+  800938:	0f b6 12             	movzbl (%edx),%edx
+  80093b:	29 d0                	sub    %edx,%eax
+}
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	53                   	push   %ebx
+  800943:	8b 45 08             	mov    0x8(%ebp),%eax
+  800946:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800949:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80094c:	eb 09                	jmp    800957 <strncmp+0x18>
+		n--, p++, q++;
+  80094e:	83 ea 01             	sub    $0x1,%edx
+  800951:	83 c0 01             	add    $0x1,%eax
+  800954:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800957:	85 d2                	test   %edx,%edx
+  800959:	74 18                	je     800973 <strncmp+0x34>
+  80095b:	0f b6 18             	movzbl (%eax),%ebx
+  80095e:	84 db                	test   %bl,%bl
+  800960:	74 04                	je     800966 <strncmp+0x27>
+  800962:	3a 19                	cmp    (%ecx),%bl
+  800964:	74 e8                	je     80094e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800966:	0f b6 00             	movzbl (%eax),%eax
+  800969:	0f b6 11             	movzbl (%ecx),%edx
+  80096c:	29 d0                	sub    %edx,%eax
+}
+  80096e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800971:	c9                   	leave
+  800972:	c3                   	ret
+		return 0;
+  800973:	b8 00 00 00 00       	mov    $0x0,%eax
+  800978:	eb f4                	jmp    80096e <strncmp+0x2f>
+
+0080097a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800980:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800984:	eb 03                	jmp    800989 <strchr+0xf>
+  800986:	83 c0 01             	add    $0x1,%eax
+  800989:	0f b6 10             	movzbl (%eax),%edx
+  80098c:	84 d2                	test   %dl,%dl
+  80098e:	74 06                	je     800996 <strchr+0x1c>
+		if (*s == c)
+  800990:	38 ca                	cmp    %cl,%dl
+  800992:	75 f2                	jne    800986 <strchr+0xc>
+  800994:	eb 05                	jmp    80099b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800996:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80099b:	5d                   	pop    %ebp
+  80099c:	c3                   	ret
+
+0080099d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80099d:	55                   	push   %ebp
+  80099e:	89 e5                	mov    %esp,%ebp
+  8009a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009a7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009aa:	38 ca                	cmp    %cl,%dl
+  8009ac:	74 09                	je     8009b7 <strfind+0x1a>
+  8009ae:	84 d2                	test   %dl,%dl
+  8009b0:	74 05                	je     8009b7 <strfind+0x1a>
+	for (; *s; s++)
+  8009b2:	83 c0 01             	add    $0x1,%eax
+  8009b5:	eb f0                	jmp    8009a7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009b7:	5d                   	pop    %ebp
+  8009b8:	c3                   	ret
+
+008009b9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009b9:	55                   	push   %ebp
+  8009ba:	89 e5                	mov    %esp,%ebp
+  8009bc:	57                   	push   %edi
+  8009bd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009c0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009c3:	85 c9                	test   %ecx,%ecx
+  8009c5:	74 20                	je     8009e7 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009c7:	89 f8                	mov    %edi,%eax
+  8009c9:	09 c8                	or     %ecx,%eax
+  8009cb:	a8 03                	test   $0x3,%al
+  8009cd:	75 12                	jne    8009e1 <memset+0x28>
+		c &= 0xFF;
+  8009cf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009d3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009d9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009dc:	fc                   	cld
+  8009dd:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009df:	eb 06                	jmp    8009e7 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009e4:	fc                   	cld
+  8009e5:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009e7:	89 f8                	mov    %edi,%eax
+  8009e9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009ec:	c9                   	leave
+  8009ed:	c3                   	ret
+
+008009ee <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009ee:	55                   	push   %ebp
+  8009ef:	89 e5                	mov    %esp,%ebp
+  8009f1:	57                   	push   %edi
+  8009f2:	56                   	push   %esi
+  8009f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009f9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009fc:	39 c6                	cmp    %eax,%esi
+  8009fe:	73 32                	jae    800a32 <memmove+0x44>
+  800a00:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a03:	39 d0                	cmp    %edx,%eax
+  800a05:	73 2b                	jae    800a32 <memmove+0x44>
+		s += n;
+		d += n;
+  800a07:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a0a:	89 d6                	mov    %edx,%esi
+  800a0c:	09 fe                	or     %edi,%esi
+  800a0e:	09 ce                	or     %ecx,%esi
+  800a10:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a16:	75 0e                	jne    800a26 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a18:	83 ef 04             	sub    $0x4,%edi
+  800a1b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a1e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a21:	fd                   	std
+  800a22:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a24:	eb 09                	jmp    800a2f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a26:	83 ef 01             	sub    $0x1,%edi
+  800a29:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a2c:	fd                   	std
+  800a2d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a2f:	fc                   	cld
+  800a30:	eb 1a                	jmp    800a4c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a32:	89 f2                	mov    %esi,%edx
+  800a34:	09 c2                	or     %eax,%edx
+  800a36:	09 ca                	or     %ecx,%edx
+  800a38:	f6 c2 03             	test   $0x3,%dl
+  800a3b:	75 0a                	jne    800a47 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a3d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a40:	89 c7                	mov    %eax,%edi
+  800a42:	fc                   	cld
+  800a43:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a45:	eb 05                	jmp    800a4c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a47:	89 c7                	mov    %eax,%edi
+  800a49:	fc                   	cld
+  800a4a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a4c:	5e                   	pop    %esi
+  800a4d:	5f                   	pop    %edi
+  800a4e:	5d                   	pop    %ebp
+  800a4f:	c3                   	ret
+
+00800a50 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a56:	ff 75 10             	push   0x10(%ebp)
+  800a59:	ff 75 0c             	push   0xc(%ebp)
+  800a5c:	ff 75 08             	push   0x8(%ebp)
+  800a5f:	e8 8a ff ff ff       	call   8009ee <memmove>
+}
+  800a64:	c9                   	leave
+  800a65:	c3                   	ret
+
+00800a66 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	56                   	push   %esi
+  800a6a:	53                   	push   %ebx
+  800a6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a71:	89 c6                	mov    %eax,%esi
+  800a73:	03 75 10             	add    0x10(%ebp),%esi
+  800a76:	eb 06                	jmp    800a7e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a78:	83 c0 01             	add    $0x1,%eax
+  800a7b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a7e:	39 f0                	cmp    %esi,%eax
+  800a80:	74 14                	je     800a96 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a82:	0f b6 08             	movzbl (%eax),%ecx
+  800a85:	0f b6 1a             	movzbl (%edx),%ebx
+  800a88:	38 d9                	cmp    %bl,%cl
+  800a8a:	74 ec                	je     800a78 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a8c:	0f b6 c1             	movzbl %cl,%eax
+  800a8f:	0f b6 db             	movzbl %bl,%ebx
+  800a92:	29 d8                	sub    %ebx,%eax
+  800a94:	eb 05                	jmp    800a9b <memcmp+0x35>
+	}
+
+	return 0;
+  800a96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a9b:	5b                   	pop    %ebx
+  800a9c:	5e                   	pop    %esi
+  800a9d:	5d                   	pop    %ebp
+  800a9e:	c3                   	ret
+
+00800a9f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a9f:	55                   	push   %ebp
+  800aa0:	89 e5                	mov    %esp,%ebp
+  800aa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800aa8:	89 c2                	mov    %eax,%edx
+  800aaa:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aad:	eb 03                	jmp    800ab2 <memfind+0x13>
+  800aaf:	83 c0 01             	add    $0x1,%eax
+  800ab2:	39 d0                	cmp    %edx,%eax
+  800ab4:	73 04                	jae    800aba <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ab6:	38 08                	cmp    %cl,(%eax)
+  800ab8:	75 f5                	jne    800aaf <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+
+00800abc <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	57                   	push   %edi
+  800ac0:	56                   	push   %esi
+  800ac1:	53                   	push   %ebx
+  800ac2:	83 ec 1c             	sub    $0x1c,%esp
+  800ac5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac8:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800acb:	eb 03                	jmp    800ad0 <strtol+0x14>
+		s++;
+  800acd:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800ad0:	0f b6 06             	movzbl (%esi),%eax
+  800ad3:	3c 20                	cmp    $0x20,%al
+  800ad5:	74 f6                	je     800acd <strtol+0x11>
+  800ad7:	3c 09                	cmp    $0x9,%al
+  800ad9:	74 f2                	je     800acd <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800adb:	3c 2b                	cmp    $0x2b,%al
+  800add:	74 43                	je     800b22 <strtol+0x66>
+	int neg = 0;
+  800adf:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800ae4:	3c 2d                	cmp    $0x2d,%al
+  800ae6:	74 44                	je     800b2c <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ae8:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800aee:	75 0f                	jne    800aff <strtol+0x43>
+  800af0:	80 3e 30             	cmpb   $0x30,(%esi)
+  800af3:	74 41                	je     800b36 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800af5:	85 ff                	test   %edi,%edi
+  800af7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800afc:	0f 44 f8             	cmove  %eax,%edi
+  800aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b04:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b09:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b0c:	89 fb                	mov    %edi,%ebx
+  800b0e:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b11:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b14:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b17:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b1a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b1d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b20:	eb 67                	jmp    800b89 <strtol+0xcd>
+		s++;
+  800b22:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b2a:	eb bc                	jmp    800ae8 <strtol+0x2c>
+		s++, neg = 1;
+  800b2c:	83 c6 01             	add    $0x1,%esi
+  800b2f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b34:	eb b2                	jmp    800ae8 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b36:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b3a:	74 0e                	je     800b4a <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b3c:	85 ff                	test   %edi,%edi
+  800b3e:	75 bf                	jne    800aff <strtol+0x43>
+		s++, base = 8;
+  800b40:	83 c6 01             	add    $0x1,%esi
+  800b43:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b48:	eb b5                	jmp    800aff <strtol+0x43>
+		s += 2, base = 16;
+  800b4a:	83 c6 02             	add    $0x2,%esi
+  800b4d:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b52:	eb ab                	jmp    800aff <strtol+0x43>
+			dig = *s - '0';
+  800b54:	0f be c9             	movsbl %cl,%ecx
+  800b57:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b5a:	39 f9                	cmp    %edi,%ecx
+  800b5c:	7d 59                	jge    800bb7 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b5e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b62:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b65:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b68:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b6b:	0f af d8             	imul   %eax,%ebx
+  800b6e:	0f af d7             	imul   %edi,%edx
+  800b71:	01 d3                	add    %edx,%ebx
+  800b73:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b76:	f7 e7                	mul    %edi
+  800b78:	01 da                	add    %ebx,%edx
+  800b7a:	89 cb                	mov    %ecx,%ebx
+  800b7c:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b7f:	01 c8                	add    %ecx,%eax
+  800b81:	11 da                	adc    %ebx,%edx
+  800b83:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b86:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8c:	0f b6 08             	movzbl (%eax),%ecx
+  800b8f:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b92:	80 fb 09             	cmp    $0x9,%bl
+  800b95:	76 bd                	jbe    800b54 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b97:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b9a:	80 fb 19             	cmp    $0x19,%bl
+  800b9d:	77 08                	ja     800ba7 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b9f:	0f be c9             	movsbl %cl,%ecx
+  800ba2:	83 e9 57             	sub    $0x57,%ecx
+  800ba5:	eb b3                	jmp    800b5a <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ba7:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800baa:	80 fb 19             	cmp    $0x19,%bl
+  800bad:	77 08                	ja     800bb7 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800baf:	0f be c9             	movsbl %cl,%ecx
+  800bb2:	83 e9 37             	sub    $0x37,%ecx
+  800bb5:	eb a3                	jmp    800b5a <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bb7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bba:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bbd:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bc0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bc7:	74 05                	je     800bce <strtol+0x112>
+		*endptr = (char *) s;
+  800bc9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bcc:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800bce:	85 c9                	test   %ecx,%ecx
+  800bd0:	74 07                	je     800bd9 <strtol+0x11d>
+  800bd2:	f7 d8                	neg    %eax
+  800bd4:	83 d2 00             	adc    $0x0,%edx
+  800bd7:	f7 da                	neg    %edx
+}
+  800bd9:	83 c4 1c             	add    $0x1c,%esp
+  800bdc:	5b                   	pop    %ebx
+  800bdd:	5e                   	pop    %esi
+  800bde:	5f                   	pop    %edi
+  800bdf:	5d                   	pop    %ebp
+  800be0:	c3                   	ret
+
+00800be1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800be1:	55                   	push   %ebp
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	57                   	push   %edi
+  800be5:	56                   	push   %esi
+  800be6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800be7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bee:	74 18                	je     800c08 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bfb:	89 c3                	mov    %eax,%ebx
+  800bfd:	89 c7                	mov    %eax,%edi
+  800bff:	89 c6                	mov    %eax,%esi
+  800c01:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c03:	5b                   	pop    %ebx
+  800c04:	5e                   	pop    %esi
+  800c05:	5f                   	pop    %edi
+  800c06:	5d                   	pop    %ebp
+  800c07:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c13:	89 c3                	mov    %eax,%ebx
+  800c15:	89 c7                	mov    %eax,%edi
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	8d 35 22 0c 80 00    	lea    0x800c22,%esi
+  800c20:	0f 34                	sysenter
+  800c22:	5d                   	pop    %ebp
+		goto out;
+  800c23:	eb de                	jmp    800c03 <sys_cputs+0x22>
+
+00800c25 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c25:	55                   	push   %ebp
+  800c26:	89 e5                	mov    %esp,%ebp
+  800c28:	57                   	push   %edi
+  800c29:	56                   	push   %esi
+  800c2a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c2b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c32:	74 19                	je     800c4d <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c39:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c3e:	89 d1                	mov    %edx,%ecx
+  800c40:	89 d3                	mov    %edx,%ebx
+  800c42:	89 d7                	mov    %edx,%edi
+  800c44:	89 d6                	mov    %edx,%esi
+  800c46:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c48:	5b                   	pop    %ebx
+  800c49:	5e                   	pop    %esi
+  800c4a:	5f                   	pop    %edi
+  800c4b:	5d                   	pop    %ebp
+  800c4c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c52:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c57:	89 d1                	mov    %edx,%ecx
+  800c59:	89 d3                	mov    %edx,%ebx
+  800c5b:	89 d7                	mov    %edx,%edi
+  800c5d:	55                   	push   %ebp
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	8d 35 68 0c 80 00    	lea    0x800c68,%esi
+  800c66:	0f 34                	sysenter
+  800c68:	5d                   	pop    %ebp
+		goto out;
+  800c69:	eb dd                	jmp    800c48 <sys_cgetc+0x23>
+
+00800c6b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c6b:	55                   	push   %ebp
+  800c6c:	89 e5                	mov    %esp,%ebp
+  800c6e:	57                   	push   %edi
+  800c6f:	56                   	push   %esi
+  800c70:	53                   	push   %ebx
+  800c71:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c74:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c7b:	74 21                	je     800c9e <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c82:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8a:	89 cb                	mov    %ecx,%ebx
+  800c8c:	89 cf                	mov    %ecx,%edi
+  800c8e:	89 ce                	mov    %ecx,%esi
+  800c90:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c92:	85 c0                	test   %eax,%eax
+  800c94:	7f 27                	jg     800cbd <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c99:	5b                   	pop    %ebx
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5f                   	pop    %edi
+  800c9c:	5d                   	pop    %ebp
+  800c9d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cab:	89 cb                	mov    %ecx,%ebx
+  800cad:	89 cf                	mov    %ecx,%edi
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	8d 35 ba 0c 80 00    	lea    0x800cba,%esi
+  800cb8:	0f 34                	sysenter
+  800cba:	5d                   	pop    %ebp
+		goto out;
+  800cbb:	eb d5                	jmp    800c92 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cbd:	83 ec 0c             	sub    $0xc,%esp
+  800cc0:	50                   	push   %eax
+  800cc1:	6a 03                	push   $0x3
+  800cc3:	68 4b 2f 80 00       	push   $0x802f4b
+  800cc8:	6a 3f                	push   $0x3f
+  800cca:	68 68 2f 80 00       	push   $0x802f68
+  800ccf:	e8 71 f4 ff ff       	call   800145 <_panic>
+
+00800cd4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cd4:	55                   	push   %ebp
+  800cd5:	89 e5                	mov    %esp,%ebp
+  800cd7:	57                   	push   %edi
+  800cd8:	56                   	push   %esi
+  800cd9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cda:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ce1:	74 19                	je     800cfc <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800ce3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce8:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ced:	89 d1                	mov    %edx,%ecx
+  800cef:	89 d3                	mov    %edx,%ebx
+  800cf1:	89 d7                	mov    %edx,%edi
+  800cf3:	89 d6                	mov    %edx,%esi
+  800cf5:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cf7:	5b                   	pop    %ebx
+  800cf8:	5e                   	pop    %esi
+  800cf9:	5f                   	pop    %edi
+  800cfa:	5d                   	pop    %ebp
+  800cfb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d01:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d06:	89 d1                	mov    %edx,%ecx
+  800d08:	89 d3                	mov    %edx,%ebx
+  800d0a:	89 d7                	mov    %edx,%edi
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	8d 35 17 0d 80 00    	lea    0x800d17,%esi
+  800d15:	0f 34                	sysenter
+  800d17:	5d                   	pop    %ebp
+		goto out;
+  800d18:	eb dd                	jmp    800cf7 <sys_getenvid+0x23>
+
+00800d1a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	57                   	push   %edi
+  800d1e:	56                   	push   %esi
+  800d1f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d20:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d27:	74 19                	je     800d42 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d29:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d33:	89 d1                	mov    %edx,%ecx
+  800d35:	89 d3                	mov    %edx,%ebx
+  800d37:	89 d7                	mov    %edx,%edi
+  800d39:	89 d6                	mov    %edx,%esi
+  800d3b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5f                   	pop    %edi
+  800d40:	5d                   	pop    %ebp
+  800d41:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d47:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d4c:	89 d1                	mov    %edx,%ecx
+  800d4e:	89 d3                	mov    %edx,%ebx
+  800d50:	89 d7                	mov    %edx,%edi
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	8d 35 5d 0d 80 00    	lea    0x800d5d,%esi
+  800d5b:	0f 34                	sysenter
+  800d5d:	5d                   	pop    %ebp
+		goto out;
+  800d5e:	eb dd                	jmp    800d3d <sys_yield+0x23>
+
+00800d60 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	57                   	push   %edi
+  800d64:	56                   	push   %esi
+  800d65:	53                   	push   %ebx
+  800d66:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d69:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d70:	74 23                	je     800d95 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d72:	be 00 00 00 00       	mov    $0x0,%esi
+  800d77:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d85:	89 f7                	mov    %esi,%edi
+  800d87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	7f 29                	jg     800db6 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	8d 35 b3 0d 80 00    	lea    0x800db3,%esi
+  800db1:	0f 34                	sysenter
+  800db3:	5d                   	pop    %ebp
+		goto out;
+  800db4:	eb d3                	jmp    800d89 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+  800db9:	50                   	push   %eax
+  800dba:	6a 04                	push   $0x4
+  800dbc:	68 4b 2f 80 00       	push   $0x802f4b
+  800dc1:	6a 3f                	push   $0x3f
+  800dc3:	68 68 2f 80 00       	push   $0x802f68
+  800dc8:	e8 78 f3 ff ff       	call   800145 <_panic>
+
+00800dcd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	56                   	push   %esi
+  800dd2:	53                   	push   %ebx
+  800dd3:	83 ec 0c             	sub    $0xc,%esp
+  800dd6:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800dd9:	85 f6                	test   %esi,%esi
+  800ddb:	75 09                	jne    800de6 <sys_page_map+0x19>
+  800ddd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800de4:	74 1f                	je     800e05 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800de6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800deb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800df9:	85 c0                	test   %eax,%eax
+  800dfb:	7f 27                	jg     800e24 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e00:	5b                   	pop    %ebx
+  800e01:	5e                   	pop    %esi
+  800e02:	5f                   	pop    %edi
+  800e03:	5d                   	pop    %ebp
+  800e04:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e13:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	8d 35 21 0e 80 00    	lea    0x800e21,%esi
+  800e1f:	0f 34                	sysenter
+  800e21:	5d                   	pop    %ebp
+		goto out;
+  800e22:	eb d5                	jmp    800df9 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e24:	83 ec 0c             	sub    $0xc,%esp
+  800e27:	50                   	push   %eax
+  800e28:	6a 05                	push   $0x5
+  800e2a:	68 4b 2f 80 00       	push   $0x802f4b
+  800e2f:	6a 3f                	push   $0x3f
+  800e31:	68 68 2f 80 00       	push   $0x802f68
+  800e36:	e8 0a f3 ff ff       	call   800145 <_panic>
+
+00800e3b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e3b:	55                   	push   %ebp
+  800e3c:	89 e5                	mov    %esp,%ebp
+  800e3e:	57                   	push   %edi
+  800e3f:	56                   	push   %esi
+  800e40:	53                   	push   %ebx
+  800e41:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e44:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e4b:	74 22                	je     800e6f <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e52:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5d:	89 df                	mov    %ebx,%edi
+  800e5f:	89 de                	mov    %ebx,%esi
+  800e61:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e63:	85 c0                	test   %eax,%eax
+  800e65:	7f 28                	jg     800e8f <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6a:	5b                   	pop    %ebx
+  800e6b:	5e                   	pop    %esi
+  800e6c:	5f                   	pop    %edi
+  800e6d:	5d                   	pop    %ebp
+  800e6e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e7f:	89 df                	mov    %ebx,%edi
+  800e81:	55                   	push   %ebp
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	8d 35 8c 0e 80 00    	lea    0x800e8c,%esi
+  800e8a:	0f 34                	sysenter
+  800e8c:	5d                   	pop    %ebp
+		goto out;
+  800e8d:	eb d4                	jmp    800e63 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+  800e92:	50                   	push   %eax
+  800e93:	6a 06                	push   $0x6
+  800e95:	68 4b 2f 80 00       	push   $0x802f4b
+  800e9a:	6a 3f                	push   $0x3f
+  800e9c:	68 68 2f 80 00       	push   $0x802f68
+  800ea1:	e8 9f f2 ff ff       	call   800145 <_panic>
+
+00800ea6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+  800eac:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eaf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eb6:	74 22                	je     800eda <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800eb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebd:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec8:	89 df                	mov    %ebx,%edi
+  800eca:	89 de                	mov    %ebx,%esi
+  800ecc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ece:	85 c0                	test   %eax,%eax
+  800ed0:	7f 28                	jg     800efa <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ed2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed5:	5b                   	pop    %ebx
+  800ed6:	5e                   	pop    %esi
+  800ed7:	5f                   	pop    %edi
+  800ed8:	5d                   	pop    %ebp
+  800ed9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eea:	89 df                	mov    %ebx,%edi
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	8d 35 f7 0e 80 00    	lea    0x800ef7,%esi
+  800ef5:	0f 34                	sysenter
+  800ef7:	5d                   	pop    %ebp
+		goto out;
+  800ef8:	eb d4                	jmp    800ece <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	50                   	push   %eax
+  800efe:	6a 08                	push   $0x8
+  800f00:	68 4b 2f 80 00       	push   $0x802f4b
+  800f05:	6a 3f                	push   $0x3f
+  800f07:	68 68 2f 80 00       	push   $0x802f68
+  800f0c:	e8 34 f2 ff ff       	call   800145 <_panic>
+
+00800f11 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	57                   	push   %edi
+  800f15:	56                   	push   %esi
+  800f16:	53                   	push   %ebx
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f1a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f21:	74 22                	je     800f45 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f28:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f33:	89 df                	mov    %ebx,%edi
+  800f35:	89 de                	mov    %ebx,%esi
+  800f37:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f39:	85 c0                	test   %eax,%eax
+  800f3b:	7f 28                	jg     800f65 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f40:	5b                   	pop    %ebx
+  800f41:	5e                   	pop    %esi
+  800f42:	5f                   	pop    %edi
+  800f43:	5d                   	pop    %ebp
+  800f44:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f50:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f55:	89 df                	mov    %ebx,%edi
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	8d 35 62 0f 80 00    	lea    0x800f62,%esi
+  800f60:	0f 34                	sysenter
+  800f62:	5d                   	pop    %ebp
+		goto out;
+  800f63:	eb d4                	jmp    800f39 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	50                   	push   %eax
+  800f69:	6a 09                	push   $0x9
+  800f6b:	68 4b 2f 80 00       	push   $0x802f4b
+  800f70:	6a 3f                	push   $0x3f
+  800f72:	68 68 2f 80 00       	push   $0x802f68
+  800f77:	e8 c9 f1 ff ff       	call   800145 <_panic>
+
+00800f7c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f85:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f8c:	74 22                	je     800fb0 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f93:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9e:	89 df                	mov    %ebx,%edi
+  800fa0:	89 de                	mov    %ebx,%esi
+  800fa2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa4:	85 c0                	test   %eax,%eax
+  800fa6:	7f 28                	jg     800fd0 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fab:	5b                   	pop    %ebx
+  800fac:	5e                   	pop    %esi
+  800fad:	5f                   	pop    %edi
+  800fae:	5d                   	pop    %ebp
+  800faf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc0:	89 df                	mov    %ebx,%edi
+  800fc2:	55                   	push   %ebp
+  800fc3:	89 e5                	mov    %esp,%ebp
+  800fc5:	8d 35 cd 0f 80 00    	lea    0x800fcd,%esi
+  800fcb:	0f 34                	sysenter
+  800fcd:	5d                   	pop    %ebp
+		goto out;
+  800fce:	eb d4                	jmp    800fa4 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd0:	83 ec 0c             	sub    $0xc,%esp
+  800fd3:	50                   	push   %eax
+  800fd4:	6a 0a                	push   $0xa
+  800fd6:	68 4b 2f 80 00       	push   $0x802f4b
+  800fdb:	6a 3f                	push   $0x3f
+  800fdd:	68 68 2f 80 00       	push   $0x802f68
+  800fe2:	e8 5e f1 ff ff       	call   800145 <_panic>
+
+00800fe7 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	57                   	push   %edi
+  800feb:	56                   	push   %esi
+  800fec:	53                   	push   %ebx
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ff0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ff7:	74 22                	je     80101b <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800ff9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffe:	b8 17 00 00 00       	mov    $0x17,%eax
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801009:	89 df                	mov    %ebx,%edi
+  80100b:	89 de                	mov    %ebx,%esi
+  80100d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80100f:	85 c0                	test   %eax,%eax
+  801011:	7f 28                	jg     80103b <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801013:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801016:	5b                   	pop    %ebx
+  801017:	5e                   	pop    %esi
+  801018:	5f                   	pop    %edi
+  801019:	5d                   	pop    %ebp
+  80101a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80101b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801020:	8b 55 08             	mov    0x8(%ebp),%edx
+  801023:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801026:	b8 17 00 00 00       	mov    $0x17,%eax
+  80102b:	89 df                	mov    %ebx,%edi
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	8d 35 38 10 80 00    	lea    0x801038,%esi
+  801036:	0f 34                	sysenter
+  801038:	5d                   	pop    %ebp
+		goto out;
+  801039:	eb d4                	jmp    80100f <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103b:	83 ec 0c             	sub    $0xc,%esp
+  80103e:	50                   	push   %eax
+  80103f:	6a 17                	push   $0x17
+  801041:	68 4b 2f 80 00       	push   $0x802f4b
+  801046:	6a 3f                	push   $0x3f
+  801048:	68 68 2f 80 00       	push   $0x802f68
+  80104d:	e8 f3 f0 ff ff       	call   800145 <_panic>
+
+00801052 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	57                   	push   %edi
+  801056:	56                   	push   %esi
+  801057:	53                   	push   %ebx
+  801058:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80105b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801062:	74 22                	je     801086 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801064:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801069:	b8 18 00 00 00       	mov    $0x18,%eax
+  80106e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801071:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801074:	89 df                	mov    %ebx,%edi
+  801076:	89 de                	mov    %ebx,%esi
+  801078:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107a:	85 c0                	test   %eax,%eax
+  80107c:	7f 28                	jg     8010a6 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80107e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801081:	5b                   	pop    %ebx
+  801082:	5e                   	pop    %esi
+  801083:	5f                   	pop    %edi
+  801084:	5d                   	pop    %ebp
+  801085:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801086:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	b8 18 00 00 00       	mov    $0x18,%eax
+  801096:	89 df                	mov    %ebx,%edi
+  801098:	55                   	push   %ebp
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	8d 35 a3 10 80 00    	lea    0x8010a3,%esi
+  8010a1:	0f 34                	sysenter
+  8010a3:	5d                   	pop    %ebp
+		goto out;
+  8010a4:	eb d4                	jmp    80107a <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a6:	83 ec 0c             	sub    $0xc,%esp
+  8010a9:	50                   	push   %eax
+  8010aa:	6a 18                	push   $0x18
+  8010ac:	68 4b 2f 80 00       	push   $0x802f4b
+  8010b1:	6a 3f                	push   $0x3f
+  8010b3:	68 68 2f 80 00       	push   $0x802f68
+  8010b8:	e8 88 f0 ff ff       	call   800145 <_panic>
+
+008010bd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	57                   	push   %edi
+  8010c1:	56                   	push   %esi
+  8010c2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010c3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010ca:	74 1d                	je     8010e9 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8010cc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010e4:	5b                   	pop    %ebx
+  8010e5:	5e                   	pop    %esi
+  8010e6:	5f                   	pop    %edi
+  8010e7:	5d                   	pop    %ebp
+  8010e8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ef:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	8d 35 05 11 80 00    	lea    0x801105,%esi
+  801103:	0f 34                	sysenter
+  801105:	5d                   	pop    %ebp
+		goto out;
+  801106:	eb dc                	jmp    8010e4 <sys_ipc_try_send+0x27>
+
+00801108 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801108:	55                   	push   %ebp
+  801109:	89 e5                	mov    %esp,%ebp
+  80110b:	57                   	push   %edi
+  80110c:	56                   	push   %esi
+  80110d:	53                   	push   %ebx
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801111:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801118:	74 21                	je     80113b <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80111a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80111f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801124:	8b 55 08             	mov    0x8(%ebp),%edx
+  801127:	89 cb                	mov    %ecx,%ebx
+  801129:	89 cf                	mov    %ecx,%edi
+  80112b:	89 ce                	mov    %ecx,%esi
+  80112d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80112f:	85 c0                	test   %eax,%eax
+  801131:	7f 27                	jg     80115a <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5f                   	pop    %edi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80113b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801143:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801148:	89 cb                	mov    %ecx,%ebx
+  80114a:	89 cf                	mov    %ecx,%edi
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	8d 35 57 11 80 00    	lea    0x801157,%esi
+  801155:	0f 34                	sysenter
+  801157:	5d                   	pop    %ebp
+		goto out;
+  801158:	eb d5                	jmp    80112f <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115a:	83 ec 0c             	sub    $0xc,%esp
+  80115d:	50                   	push   %eax
+  80115e:	6a 0d                	push   $0xd
+  801160:	68 4b 2f 80 00       	push   $0x802f4b
+  801165:	6a 3f                	push   $0x3f
+  801167:	68 68 2f 80 00       	push   $0x802f68
+  80116c:	e8 d4 ef ff ff       	call   800145 <_panic>
+
+00801171 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801171:	55                   	push   %ebp
+  801172:	89 e5                	mov    %esp,%ebp
+  801174:	57                   	push   %edi
+  801175:	56                   	push   %esi
+  801176:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801177:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80117e:	74 1b                	je     80119b <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801185:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80118a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801190:	89 df                	mov    %ebx,%edi
+  801192:	89 de                	mov    %ebx,%esi
+  801194:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80119b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ab:	89 df                	mov    %ebx,%edi
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	8d 35 b8 11 80 00    	lea    0x8011b8,%esi
+  8011b6:	0f 34                	sysenter
+  8011b8:	5d                   	pop    %ebp
+		goto out;
+  8011b9:	eb db                	jmp    801196 <sys_ipc_recv_until+0x25>
+
+008011bb <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011c1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011c8:	74 19                	je     8011e3 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8011ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011cf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d4:	89 d1                	mov    %edx,%ecx
+  8011d6:	89 d3                	mov    %edx,%ebx
+  8011d8:	89 d7                	mov    %edx,%edi
+  8011da:	89 d6                	mov    %edx,%esi
+  8011dc:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011de:	5b                   	pop    %ebx
+  8011df:	5e                   	pop    %esi
+  8011e0:	5f                   	pop    %edi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011ed:	89 d1                	mov    %edx,%ecx
+  8011ef:	89 d3                	mov    %edx,%ebx
+  8011f1:	89 d7                	mov    %edx,%edi
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	8d 35 fe 11 80 00    	lea    0x8011fe,%esi
+  8011fc:	0f 34                	sysenter
+  8011fe:	5d                   	pop    %ebp
+		goto out;
+  8011ff:	eb dd                	jmp    8011de <sys_time_msec+0x23>
+
+00801201 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	57                   	push   %edi
+  801205:	56                   	push   %esi
+  801206:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801207:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80120e:	74 1a                	je     80122a <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801215:	b8 10 00 00 00       	mov    $0x10,%eax
+  80121a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121d:	89 cb                	mov    %ecx,%ebx
+  80121f:	89 cf                	mov    %ecx,%edi
+  801221:	89 ce                	mov    %ecx,%esi
+  801223:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801225:	5b                   	pop    %ebx
+  801226:	5e                   	pop    %esi
+  801227:	5f                   	pop    %edi
+  801228:	5d                   	pop    %ebp
+  801229:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80122a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801232:	b8 10 00 00 00       	mov    $0x10,%eax
+  801237:	89 cb                	mov    %ecx,%ebx
+  801239:	89 cf                	mov    %ecx,%edi
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	8d 35 46 12 80 00    	lea    0x801246,%esi
+  801244:	0f 34                	sysenter
+  801246:	5d                   	pop    %ebp
+		goto out;
+  801247:	eb dc                	jmp    801225 <sys_sleep_until+0x24>
+
+00801249 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	57                   	push   %edi
+  80124d:	56                   	push   %esi
+  80124e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80124f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801256:	74 1a                	je     801272 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801258:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80125d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801262:	8b 55 08             	mov    0x8(%ebp),%edx
+  801265:	89 cb                	mov    %ecx,%ebx
+  801267:	89 cf                	mov    %ecx,%edi
+  801269:	89 ce                	mov    %ecx,%esi
+  80126b:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80126d:	5b                   	pop    %ebx
+  80126e:	5e                   	pop    %esi
+  80126f:	5f                   	pop    %edi
+  801270:	5d                   	pop    %ebp
+  801271:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801272:	8b 55 08             	mov    0x8(%ebp),%edx
+  801275:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80127a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80127f:	89 cb                	mov    %ecx,%ebx
+  801281:	89 cf                	mov    %ecx,%edi
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	8d 35 8e 12 80 00    	lea    0x80128e,%esi
+  80128c:	0f 34                	sysenter
+  80128e:	5d                   	pop    %ebp
+		goto out;
+  80128f:	eb dc                	jmp    80126d <sys_env_print_stats+0x24>
+
+00801291 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801291:	55                   	push   %ebp
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	57                   	push   %edi
+  801295:	56                   	push   %esi
+  801296:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801297:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80129e:	74 1b                	je     8012bb <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b0:	89 df                	mov    %ebx,%edi
+  8012b2:	89 de                	mov    %ebx,%esi
+  8012b4:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012b6:	5b                   	pop    %ebx
+  8012b7:	5e                   	pop    %esi
+  8012b8:	5f                   	pop    %edi
+  8012b9:	5d                   	pop    %ebp
+  8012ba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012cb:	89 df                	mov    %ebx,%edi
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	8d 35 d8 12 80 00    	lea    0x8012d8,%esi
+  8012d6:	0f 34                	sysenter
+  8012d8:	5d                   	pop    %ebp
+		goto out;
+  8012d9:	eb db                	jmp    8012b6 <sys_perf+0x25>
+
+008012db <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012db:	55                   	push   %ebp
+  8012dc:	89 e5                	mov    %esp,%ebp
+  8012de:	57                   	push   %edi
+  8012df:	56                   	push   %esi
+  8012e0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012e1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012e8:	74 19                	je     801303 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ef:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012f4:	89 d1                	mov    %edx,%ecx
+  8012f6:	89 d3                	mov    %edx,%ebx
+  8012f8:	89 d7                	mov    %edx,%edi
+  8012fa:	89 d6                	mov    %edx,%esi
+  8012fc:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012fe:	5b                   	pop    %ebx
+  8012ff:	5e                   	pop    %esi
+  801300:	5f                   	pop    %edi
+  801301:	5d                   	pop    %ebp
+  801302:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801303:	ba 00 00 00 00       	mov    $0x0,%edx
+  801308:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80130d:	89 d1                	mov    %edx,%ecx
+  80130f:	89 d3                	mov    %edx,%ebx
+  801311:	89 d7                	mov    %edx,%edi
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  801316:	8d 35 1e 13 80 00    	lea    0x80131e,%esi
+  80131c:	0f 34                	sysenter
+  80131e:	5d                   	pop    %ebp
+		goto out;
+  80131f:	eb dd                	jmp    8012fe <sys_fork+0x23>
+
+00801321 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+  801324:	57                   	push   %edi
+  801325:	56                   	push   %esi
+  801326:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801327:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80132e:	74 1c                	je     80134c <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801330:	be 00 00 00 00       	mov    $0x0,%esi
+  801335:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80133a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801343:	89 f7                	mov    %esi,%edi
+  801345:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801347:	5b                   	pop    %ebx
+  801348:	5e                   	pop    %esi
+  801349:	5f                   	pop    %edi
+  80134a:	5d                   	pop    %ebp
+  80134b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80134c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801352:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80135c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  801362:	8d 35 6a 13 80 00    	lea    0x80136a,%esi
+  801368:	0f 34                	sysenter
+  80136a:	5d                   	pop    %ebp
+		goto out;
+  80136b:	eb da                	jmp    801347 <sys_thread_create+0x26>
+
+0080136d <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	57                   	push   %edi
+  801371:	56                   	push   %esi
+  801372:	53                   	push   %ebx
+  801373:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801376:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80137d:	74 24                	je     8013a3 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80137f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801384:	be 00 00 00 00       	mov    $0x0,%esi
+  801389:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80138f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801392:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801395:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801397:	85 c0                	test   %eax,%eax
+  801399:	7f 27                	jg     8013c2 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80139b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80139e:	5b                   	pop    %ebx
+  80139f:	5e                   	pop    %esi
+  8013a0:	5f                   	pop    %edi
+  8013a1:	5d                   	pop    %ebp
+  8013a2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013b4:	55                   	push   %ebp
+  8013b5:	89 e5                	mov    %esp,%ebp
+  8013b7:	8d 35 bf 13 80 00    	lea    0x8013bf,%esi
+  8013bd:	0f 34                	sysenter
+  8013bf:	5d                   	pop    %ebp
+		goto out;
+  8013c0:	eb d5                	jmp    801397 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c2:	83 ec 0c             	sub    $0xc,%esp
+  8013c5:	50                   	push   %eax
+  8013c6:	6a 1f                	push   $0x1f
+  8013c8:	68 4b 2f 80 00       	push   $0x802f4b
+  8013cd:	6a 3f                	push   $0x3f
+  8013cf:	68 68 2f 80 00       	push   $0x802f68
+  8013d4:	e8 6c ed ff ff       	call   800145 <_panic>
+
+008013d9 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	57                   	push   %edi
+  8013dd:	56                   	push   %esi
+  8013de:	53                   	push   %ebx
+  8013df:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013e2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013e9:	74 23                	je     80140e <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f0:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013fe:	89 f7                	mov    %esi,%edi
+  801400:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801402:	85 c0                	test   %eax,%eax
+  801404:	7f 29                	jg     80142f <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801409:	5b                   	pop    %ebx
+  80140a:	5e                   	pop    %esi
+  80140b:	5f                   	pop    %edi
+  80140c:	5d                   	pop    %ebp
+  80140d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80140e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801411:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801414:	b8 20 00 00 00       	mov    $0x20,%eax
+  801419:	bf 00 00 00 00       	mov    $0x0,%edi
+  80141e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801421:	55                   	push   %ebp
+  801422:	89 e5                	mov    %esp,%ebp
+  801424:	8d 35 2c 14 80 00    	lea    0x80142c,%esi
+  80142a:	0f 34                	sysenter
+  80142c:	5d                   	pop    %ebp
+		goto out;
+  80142d:	eb d3                	jmp    801402 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80142f:	83 ec 0c             	sub    $0xc,%esp
+  801432:	50                   	push   %eax
+  801433:	6a 20                	push   $0x20
+  801435:	68 4b 2f 80 00       	push   $0x802f4b
+  80143a:	6a 3f                	push   $0x3f
+  80143c:	68 68 2f 80 00       	push   $0x802f68
+  801441:	e8 ff ec ff ff       	call   800145 <_panic>
+
+00801446 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801446:	55                   	push   %ebp
+  801447:	89 e5                	mov    %esp,%ebp
+  801449:	57                   	push   %edi
+  80144a:	56                   	push   %esi
+  80144b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80144c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801453:	74 1b                	je     801470 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801455:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80145f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801462:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801465:	89 df                	mov    %ebx,%edi
+  801467:	89 de                	mov    %ebx,%esi
+  801469:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80146b:	5b                   	pop    %ebx
+  80146c:	5e                   	pop    %esi
+  80146d:	5f                   	pop    %edi
+  80146e:	5d                   	pop    %ebp
+  80146f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801470:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801475:	8b 55 08             	mov    0x8(%ebp),%edx
+  801478:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801480:	89 df                	mov    %ebx,%edi
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	8d 35 8d 14 80 00    	lea    0x80148d,%esi
+  80148b:	0f 34                	sysenter
+  80148d:	5d                   	pop    %ebp
+		goto out;
+  80148e:	eb db                	jmp    80146b <sys_batch+0x25>
+
+00801490 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	57                   	push   %edi
+  801494:	56                   	push   %esi
+  801495:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801496:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80149d:	74 1a                	je     8014b9 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80149f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ac:	89 cb                	mov    %ecx,%ebx
+  8014ae:	89 cf                	mov    %ecx,%edi
+  8014b0:	89 ce                	mov    %ecx,%esi
+  8014b2:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014b4:	5b                   	pop    %ebx
+  8014b5:	5e                   	pop    %esi
+  8014b6:	5f                   	pop    %edi
+  8014b7:	5d                   	pop    %ebp
+  8014b8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014c6:	89 cb                	mov    %ecx,%ebx
+  8014c8:	89 cf                	mov    %ecx,%edi
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	8d 35 d5 14 80 00    	lea    0x8014d5,%esi
+  8014d3:	0f 34                	sysenter
+  8014d5:	5d                   	pop    %ebp
+		goto out;
+  8014d6:	eb dc                	jmp    8014b4 <sys_trace_ctl+0x24>
+
+008014d8 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014d8:	55                   	push   %ebp
+  8014d9:	89 e5                	mov    %esp,%ebp
+  8014db:	57                   	push   %edi
+  8014dc:	56                   	push   %esi
+  8014dd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014de:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e5:	74 1c                	je     801503 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ec:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fa:	89 f7                	mov    %esi,%edi
+  8014fc:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014fe:	5b                   	pop    %ebx
+  8014ff:	5e                   	pop    %esi
+  801500:	5f                   	pop    %edi
+  801501:	5d                   	pop    %ebp
+  801502:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801503:	8b 55 08             	mov    0x8(%ebp),%edx
+  801506:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801509:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80150e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801513:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801516:	55                   	push   %ebp
+  801517:	89 e5                	mov    %esp,%ebp
+  801519:	8d 35 21 15 80 00    	lea    0x801521,%esi
+  80151f:	0f 34                	sysenter
+  801521:	5d                   	pop    %ebp
+		goto out;
+  801522:	eb da                	jmp    8014fe <sys_trace_read+0x26>
+
+00801524 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801524:	55                   	push   %ebp
+  801525:	89 e5                	mov    %esp,%ebp
+  801527:	57                   	push   %edi
+  801528:	56                   	push   %esi
+  801529:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80152a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801531:	74 1c                	je     80154f <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801533:	be 00 00 00 00       	mov    $0x0,%esi
+  801538:	b8 21 00 00 00       	mov    $0x21,%eax
+  80153d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801540:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801543:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801546:	89 f7                	mov    %esi,%edi
+  801548:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80154a:	5b                   	pop    %ebx
+  80154b:	5e                   	pop    %esi
+  80154c:	5f                   	pop    %edi
+  80154d:	5d                   	pop    %ebp
+  80154e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80154f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801552:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801555:	b8 21 00 00 00       	mov    $0x21,%eax
+  80155a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80155f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	8d 35 6d 15 80 00    	lea    0x80156d,%esi
+  80156b:	0f 34                	sysenter
+  80156d:	5d                   	pop    %ebp
+		goto out;
+  80156e:	eb da                	jmp    80154a <sys_meminfo+0x26>
+
+00801570 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801570:	55                   	push   %ebp
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	57                   	push   %edi
+  801574:	56                   	push   %esi
+  801575:	53                   	push   %ebx
+  801576:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801579:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80157d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801584:	74 1f                	je     8015a5 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801586:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158b:	b8 22 00 00 00       	mov    $0x22,%eax
+  801590:	8b 55 08             	mov    0x8(%ebp),%edx
+  801593:	89 df                	mov    %ebx,%edi
+  801595:	89 de                	mov    %ebx,%esi
+  801597:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	7f 25                	jg     8015c2 <sys_env_set_ksm+0x52>
+}
+  80159d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a0:	5b                   	pop    %ebx
+  8015a1:	5e                   	pop    %esi
+  8015a2:	5f                   	pop    %edi
+  8015a3:	5d                   	pop    %ebp
+  8015a4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ad:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015b2:	89 df                	mov    %ebx,%edi
+  8015b4:	55                   	push   %ebp
+  8015b5:	89 e5                	mov    %esp,%ebp
+  8015b7:	8d 35 bf 15 80 00    	lea    0x8015bf,%esi
+  8015bd:	0f 34                	sysenter
+  8015bf:	5d                   	pop    %ebp
+		goto out;
+  8015c0:	eb d7                	jmp    801599 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+  8015c5:	50                   	push   %eax
+  8015c6:	6a 22                	push   $0x22
+  8015c8:	68 4b 2f 80 00       	push   $0x802f4b
+  8015cd:	6a 3f                	push   $0x3f
+  8015cf:	68 68 2f 80 00       	push   $0x802f68
+  8015d4:	e8 6c eb ff ff       	call   800145 <_panic>
+
+008015d9 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	57                   	push   %edi
+  8015dd:	56                   	push   %esi
+  8015de:	53                   	push   %ebx
+  8015df:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015e2:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015e5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015ec:	74 24                	je     801612 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015f8:	89 cb                	mov    %ecx,%ebx
+  8015fa:	89 cf                	mov    %ecx,%edi
+  8015fc:	89 ce                	mov    %ecx,%esi
+  8015fe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801600:	85 c0                	test   %eax,%eax
+  801602:	7f 2a                	jg     80162e <sys_time_nsec+0x55>
+	return ns;
+}
+  801604:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801607:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80160a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160d:	5b                   	pop    %ebx
+  80160e:	5e                   	pop    %esi
+  80160f:	5f                   	pop    %edi
+  801610:	5d                   	pop    %ebp
+  801611:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801617:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80161c:	89 cb                	mov    %ecx,%ebx
+  80161e:	89 cf                	mov    %ecx,%edi
+  801620:	55                   	push   %ebp
+  801621:	89 e5                	mov    %esp,%ebp
+  801623:	8d 35 2b 16 80 00    	lea    0x80162b,%esi
+  801629:	0f 34                	sysenter
+  80162b:	5d                   	pop    %ebp
+		goto out;
+  80162c:	eb d2                	jmp    801600 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80162e:	83 ec 0c             	sub    $0xc,%esp
+  801631:	50                   	push   %eax
+  801632:	6a 0f                	push   $0xf
+  801634:	68 4b 2f 80 00       	push   $0x802f4b
+  801639:	6a 3f                	push   $0x3f
+  80163b:	68 68 2f 80 00       	push   $0x802f68
+  801640:	e8 00 eb ff ff       	call   800145 <_panic>
+
+00801645 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801645:	55                   	push   %ebp
+  801646:	89 e5                	mov    %esp,%ebp
+  801648:	57                   	push   %edi
+  801649:	56                   	push   %esi
+  80164a:	53                   	push   %ebx
+  80164b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80164e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801655:	74 22                	je     801679 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801657:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801661:	8b 55 08             	mov    0x8(%ebp),%edx
+  801664:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801667:	89 df                	mov    %ebx,%edi
+  801669:	89 de                	mov    %ebx,%esi
+  80166b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	7f 28                	jg     801699 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801671:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801674:	5b                   	pop    %ebx
+  801675:	5e                   	pop    %esi
+  801676:	5f                   	pop    %edi
+  801677:	5d                   	pop    %ebp
+  801678:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801679:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801681:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801684:	b8 12 00 00 00       	mov    $0x12,%eax
+  801689:	89 df                	mov    %ebx,%edi
+  80168b:	55                   	push   %ebp
+  80168c:	89 e5                	mov    %esp,%ebp
+  80168e:	8d 35 96 16 80 00    	lea    0x801696,%esi
+  801694:	0f 34                	sysenter
+  801696:	5d                   	pop    %ebp
+		goto out;
+  801697:	eb d4                	jmp    80166d <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801699:	83 ec 0c             	sub    $0xc,%esp
+  80169c:	50                   	push   %eax
+  80169d:	6a 12                	push   $0x12
+  80169f:	68 4b 2f 80 00       	push   $0x802f4b
+  8016a4:	6a 3f                	push   $0x3f
+  8016a6:	68 68 2f 80 00       	push   $0x802f68
+  8016ab:	e8 95 ea ff ff       	call   800145 <_panic>
+
+008016b0 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016b0:	55                   	push   %ebp
+  8016b1:	89 e5                	mov    %esp,%ebp
+  8016b3:	57                   	push   %edi
+  8016b4:	56                   	push   %esi
+  8016b5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016b6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016bd:	74 1b                	je     8016da <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8016bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016cf:	89 df                	mov    %ebx,%edi
+  8016d1:	89 de                	mov    %ebx,%esi
+  8016d3:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016d5:	5b                   	pop    %ebx
+  8016d6:	5e                   	pop    %esi
+  8016d7:	5f                   	pop    %edi
+  8016d8:	5d                   	pop    %ebp
+  8016d9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016ea:	89 df                	mov    %ebx,%edi
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	8d 35 f7 16 80 00    	lea    0x8016f7,%esi
+  8016f5:	0f 34                	sysenter
+  8016f7:	5d                   	pop    %ebp
+		goto out;
+  8016f8:	eb db                	jmp    8016d5 <sys_e1000_receive+0x25>
+
+008016fa <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+  8016fd:	57                   	push   %edi
+  8016fe:	56                   	push   %esi
+  8016ff:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801700:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801707:	74 1b                	je     801724 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801709:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801713:	8b 55 08             	mov    0x8(%ebp),%edx
+  801716:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801719:	89 df                	mov    %ebx,%edi
+  80171b:	89 de                	mov    %ebx,%esi
+  80171d:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80171f:	5b                   	pop    %ebx
+  801720:	5e                   	pop    %esi
+  801721:	5f                   	pop    %edi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801724:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801729:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80172f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801734:	89 df                	mov    %ebx,%edi
+  801736:	55                   	push   %ebp
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	8d 35 41 17 80 00    	lea    0x801741,%esi
+  80173f:	0f 34                	sysenter
+  801741:	5d                   	pop    %ebp
+		goto out;
+  801742:	eb db                	jmp    80171f <sys_e1000_read_hwaddr+0x25>
+
+00801744 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801744:	55                   	push   %ebp
+  801745:	89 e5                	mov    %esp,%ebp
+  801747:	57                   	push   %edi
+  801748:	56                   	push   %esi
+  801749:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80174a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801751:	74 1a                	je     80176d <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801753:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801758:	b8 15 00 00 00       	mov    $0x15,%eax
+  80175d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801760:	89 cb                	mov    %ecx,%ebx
+  801762:	89 cf                	mov    %ecx,%edi
+  801764:	89 ce                	mov    %ecx,%esi
+  801766:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801768:	5b                   	pop    %ebx
+  801769:	5e                   	pop    %esi
+  80176a:	5f                   	pop    %edi
+  80176b:	5d                   	pop    %ebp
+  80176c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80176d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801770:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801775:	b8 15 00 00 00       	mov    $0x15,%eax
+  80177a:	89 cb                	mov    %ecx,%ebx
+  80177c:	89 cf                	mov    %ecx,%edi
+  80177e:	55                   	push   %ebp
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	8d 35 89 17 80 00    	lea    0x801789,%esi
+  801787:	0f 34                	sysenter
+  801789:	5d                   	pop    %ebp
+		goto out;
+  80178a:	eb dc                	jmp    801768 <sys_sb16_read_version+0x24>
+
+0080178c <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80178c:	55                   	push   %ebp
+  80178d:	89 e5                	mov    %esp,%ebp
+  80178f:	57                   	push   %edi
+  801790:	56                   	push   %esi
+  801791:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801792:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801799:	74 1b                	je     8017b6 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80179b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ab:	89 df                	mov    %ebx,%edi
+  8017ad:	89 de                	mov    %ebx,%esi
+  8017af:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017b1:	5b                   	pop    %ebx
+  8017b2:	5e                   	pop    %esi
+  8017b3:	5f                   	pop    %edi
+  8017b4:	5d                   	pop    %ebp
+  8017b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017c6:	89 df                	mov    %ebx,%edi
+  8017c8:	55                   	push   %ebp
+  8017c9:	89 e5                	mov    %esp,%ebp
+  8017cb:	8d 35 d3 17 80 00    	lea    0x8017d3,%esi
+  8017d1:	0f 34                	sysenter
+  8017d3:	5d                   	pop    %ebp
+		goto out;
+  8017d4:	eb db                	jmp    8017b1 <sys_sb16_play+0x25>
+
+008017d6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017dc:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017e1:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017e4:	5d                   	pop    %ebp
+  8017e5:	c3                   	ret
+
+008017e6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017ec:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017f1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017f6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017fb:	5d                   	pop    %ebp
+  8017fc:	c3                   	ret
+
+008017fd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801800:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801805:	eb 02                	jmp    801809 <fd_alloc+0xc>
+  801807:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801809:	89 c2                	mov    %eax,%edx
+  80180b:	c1 ea 16             	shr    $0x16,%edx
+  80180e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801815:	f6 c2 01             	test   $0x1,%dl
+  801818:	74 2b                	je     801845 <fd_alloc+0x48>
+  80181a:	89 c2                	mov    %eax,%edx
+  80181c:	c1 ea 0c             	shr    $0xc,%edx
+  80181f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801826:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80182c:	f6 c1 01             	test   $0x1,%cl
+  80182f:	74 14                	je     801845 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801831:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801837:	75 ce                	jne    801807 <fd_alloc+0xa>
+  801839:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80183e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801843:	eb 05                	jmp    80184a <fd_alloc+0x4d>
+			return 0;
+  801845:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80184a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184d:	89 02                	mov    %eax,(%edx)
+}
+  80184f:	89 c8                	mov    %ecx,%eax
+  801851:	5d                   	pop    %ebp
+  801852:	c3                   	ret
+
+00801853 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801853:	55                   	push   %ebp
+  801854:	89 e5                	mov    %esp,%ebp
+  801856:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801859:	83 f8 1f             	cmp    $0x1f,%eax
+  80185c:	77 30                	ja     80188e <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80185e:	c1 e0 0c             	shl    $0xc,%eax
+  801861:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801866:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80186c:	f6 c2 01             	test   $0x1,%dl
+  80186f:	74 24                	je     801895 <fd_lookup+0x42>
+  801871:	89 c2                	mov    %eax,%edx
+  801873:	c1 ea 0c             	shr    $0xc,%edx
+  801876:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80187d:	f6 c2 01             	test   $0x1,%dl
+  801880:	74 1a                	je     80189c <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801882:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801885:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801887:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80188c:	5d                   	pop    %ebp
+  80188d:	c3                   	ret
+		return -E_INVAL;
+  80188e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801893:	eb f7                	jmp    80188c <fd_lookup+0x39>
+		return -E_INVAL;
+  801895:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189a:	eb f0                	jmp    80188c <fd_lookup+0x39>
+  80189c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a1:	eb e9                	jmp    80188c <fd_lookup+0x39>
+
+008018a3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+  8018a6:	53                   	push   %ebx
+  8018a7:	83 ec 04             	sub    $0x4,%esp
+  8018aa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b2:	eb 03                	jmp    8018b7 <dev_lookup+0x14>
+  8018b4:	83 c0 01             	add    $0x1,%eax
+  8018b7:	8b 1c 85 f4 2f 80 00 	mov    0x802ff4(,%eax,4),%ebx
+  8018be:	85 db                	test   %ebx,%ebx
+  8018c0:	74 0b                	je     8018cd <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018c2:	39 13                	cmp    %edx,(%ebx)
+  8018c4:	75 ee                	jne    8018b4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cb:	eb 2e                	jmp    8018fb <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8018cd:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018cf:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8018d4:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018da:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018df:	76 24                	jbe    801905 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018e1:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018e4:	83 ec 04             	sub    $0x4,%esp
+  8018e7:	52                   	push   %edx
+  8018e8:	50                   	push   %eax
+  8018e9:	68 78 2f 80 00       	push   $0x802f78
+  8018ee:	e8 2d e9 ff ff       	call   800220 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018fe:	89 1a                	mov    %ebx,(%edx)
+}
+  801900:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801905:	c1 e8 10             	shr    $0x10,%eax
+  801908:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80190e:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801914:	eb cb                	jmp    8018e1 <dev_lookup+0x3e>
+
+00801916 <fd_close>:
+{
+  801916:	55                   	push   %ebp
+  801917:	89 e5                	mov    %esp,%ebp
+  801919:	57                   	push   %edi
+  80191a:	56                   	push   %esi
+  80191b:	53                   	push   %ebx
+  80191c:	83 ec 24             	sub    $0x24,%esp
+  80191f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801922:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801925:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801928:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801929:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80192f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801932:	50                   	push   %eax
+  801933:	e8 1b ff ff ff       	call   801853 <fd_lookup>
+  801938:	89 c3                	mov    %eax,%ebx
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	78 05                	js     801946 <fd_close+0x30>
+	    || fd != fd2)
+  801941:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801944:	74 16                	je     80195c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801946:	89 f8                	mov    %edi,%eax
+  801948:	84 c0                	test   %al,%al
+  80194a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801952:	89 d8                	mov    %ebx,%eax
+  801954:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801957:	5b                   	pop    %ebx
+  801958:	5e                   	pop    %esi
+  801959:	5f                   	pop    %edi
+  80195a:	5d                   	pop    %ebp
+  80195b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80195c:	83 ec 08             	sub    $0x8,%esp
+  80195f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801962:	50                   	push   %eax
+  801963:	ff 36                	push   (%esi)
+  801965:	e8 39 ff ff ff       	call   8018a3 <dev_lookup>
+  80196a:	89 c3                	mov    %eax,%ebx
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 1a                	js     80198d <fd_close+0x77>
+		if (dev->dev_close)
+  801973:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801976:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801979:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	74 0b                	je     80198d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801982:	83 ec 0c             	sub    $0xc,%esp
+  801985:	56                   	push   %esi
+  801986:	ff d0                	call   *%eax
+  801988:	89 c3                	mov    %eax,%ebx
+  80198a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80198d:	83 ec 08             	sub    $0x8,%esp
+  801990:	56                   	push   %esi
+  801991:	6a 00                	push   $0x0
+  801993:	e8 a3 f4 ff ff       	call   800e3b <sys_page_unmap>
+	return r;
+  801998:	83 c4 10             	add    $0x10,%esp
+  80199b:	eb b5                	jmp    801952 <fd_close+0x3c>
+
+0080199d <close>:
+
+int
+close(int fdnum)
+{
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a6:	50                   	push   %eax
+  8019a7:	ff 75 08             	push   0x8(%ebp)
+  8019aa:	e8 a4 fe ff ff       	call   801853 <fd_lookup>
+  8019af:	83 c4 10             	add    $0x10,%esp
+  8019b2:	85 c0                	test   %eax,%eax
+  8019b4:	79 02                	jns    8019b8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8019b6:	c9                   	leave
+  8019b7:	c3                   	ret
+		return fd_close(fd, 1);
+  8019b8:	83 ec 08             	sub    $0x8,%esp
+  8019bb:	6a 01                	push   $0x1
+  8019bd:	ff 75 f4             	push   -0xc(%ebp)
+  8019c0:	e8 51 ff ff ff       	call   801916 <fd_close>
+  8019c5:	83 c4 10             	add    $0x10,%esp
+  8019c8:	eb ec                	jmp    8019b6 <close+0x19>
+
+008019ca <close_all>:
+
+void
+close_all(void)
+{
+  8019ca:	55                   	push   %ebp
+  8019cb:	89 e5                	mov    %esp,%ebp
+  8019cd:	53                   	push   %ebx
+  8019ce:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019d6:	83 ec 0c             	sub    $0xc,%esp
+  8019d9:	53                   	push   %ebx
+  8019da:	e8 be ff ff ff       	call   80199d <close>
+	for (i = 0; i < MAXFD; i++)
+  8019df:	83 c3 01             	add    $0x1,%ebx
+  8019e2:	83 c4 10             	add    $0x10,%esp
+  8019e5:	83 fb 20             	cmp    $0x20,%ebx
+  8019e8:	75 ec                	jne    8019d6 <close_all+0xc>
+}
+  8019ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ed:	c9                   	leave
+  8019ee:	c3                   	ret
+
+008019ef <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019ef:	55                   	push   %ebp
+  8019f0:	89 e5                	mov    %esp,%ebp
+  8019f2:	57                   	push   %edi
+  8019f3:	56                   	push   %esi
+  8019f4:	53                   	push   %ebx
+  8019f5:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019f8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019fb:	50                   	push   %eax
+  8019fc:	ff 75 08             	push   0x8(%ebp)
+  8019ff:	e8 4f fe ff ff       	call   801853 <fd_lookup>
+  801a04:	89 c3                	mov    %eax,%ebx
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	78 7f                	js     801a8c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a0d:	83 ec 0c             	sub    $0xc,%esp
+  801a10:	ff 75 0c             	push   0xc(%ebp)
+  801a13:	e8 85 ff ff ff       	call   80199d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a18:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a1b:	c1 e6 0c             	shl    $0xc,%esi
+  801a1e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a24:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a27:	89 3c 24             	mov    %edi,(%esp)
+  801a2a:	e8 b7 fd ff ff       	call   8017e6 <fd2data>
+  801a2f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a31:	89 34 24             	mov    %esi,(%esp)
+  801a34:	e8 ad fd ff ff       	call   8017e6 <fd2data>
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a3f:	89 d8                	mov    %ebx,%eax
+  801a41:	c1 e8 16             	shr    $0x16,%eax
+  801a44:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a4b:	a8 01                	test   $0x1,%al
+  801a4d:	74 11                	je     801a60 <dup+0x71>
+  801a4f:	89 d8                	mov    %ebx,%eax
+  801a51:	c1 e8 0c             	shr    $0xc,%eax
+  801a54:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a5b:	f6 c2 01             	test   $0x1,%dl
+  801a5e:	75 36                	jne    801a96 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a60:	89 f8                	mov    %edi,%eax
+  801a62:	c1 e8 0c             	shr    $0xc,%eax
+  801a65:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a6c:	83 ec 0c             	sub    $0xc,%esp
+  801a6f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a74:	50                   	push   %eax
+  801a75:	56                   	push   %esi
+  801a76:	6a 00                	push   $0x0
+  801a78:	57                   	push   %edi
+  801a79:	6a 00                	push   $0x0
+  801a7b:	e8 4d f3 ff ff       	call   800dcd <sys_page_map>
+  801a80:	89 c3                	mov    %eax,%ebx
+  801a82:	83 c4 20             	add    $0x20,%esp
+  801a85:	85 c0                	test   %eax,%eax
+  801a87:	78 33                	js     801abc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a8c:	89 d8                	mov    %ebx,%eax
+  801a8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a91:	5b                   	pop    %ebx
+  801a92:	5e                   	pop    %esi
+  801a93:	5f                   	pop    %edi
+  801a94:	5d                   	pop    %ebp
+  801a95:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a96:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a9d:	83 ec 0c             	sub    $0xc,%esp
+  801aa0:	25 07 0e 00 00       	and    $0xe07,%eax
+  801aa5:	50                   	push   %eax
+  801aa6:	ff 75 d4             	push   -0x2c(%ebp)
+  801aa9:	6a 00                	push   $0x0
+  801aab:	53                   	push   %ebx
+  801aac:	6a 00                	push   $0x0
+  801aae:	e8 1a f3 ff ff       	call   800dcd <sys_page_map>
+  801ab3:	89 c3                	mov    %eax,%ebx
+  801ab5:	83 c4 20             	add    $0x20,%esp
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	79 a4                	jns    801a60 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801abc:	83 ec 08             	sub    $0x8,%esp
+  801abf:	56                   	push   %esi
+  801ac0:	6a 00                	push   $0x0
+  801ac2:	e8 74 f3 ff ff       	call   800e3b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ac7:	83 c4 08             	add    $0x8,%esp
+  801aca:	ff 75 d4             	push   -0x2c(%ebp)
+  801acd:	6a 00                	push   $0x0
+  801acf:	e8 67 f3 ff ff       	call   800e3b <sys_page_unmap>
+	return r;
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	eb b3                	jmp    801a8c <dup+0x9d>
+
+00801ad9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ad9:	55                   	push   %ebp
+  801ada:	89 e5                	mov    %esp,%ebp
+  801adc:	56                   	push   %esi
+  801add:	53                   	push   %ebx
+  801ade:	83 ec 18             	sub    $0x18,%esp
+  801ae1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ae4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ae7:	50                   	push   %eax
+  801ae8:	53                   	push   %ebx
+  801ae9:	e8 65 fd ff ff       	call   801853 <fd_lookup>
+  801aee:	83 c4 10             	add    $0x10,%esp
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	78 3c                	js     801b31 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801af5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801af8:	83 ec 08             	sub    $0x8,%esp
+  801afb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801afe:	50                   	push   %eax
+  801aff:	ff 36                	push   (%esi)
+  801b01:	e8 9d fd ff ff       	call   8018a3 <dev_lookup>
+  801b06:	83 c4 10             	add    $0x10,%esp
+  801b09:	85 c0                	test   %eax,%eax
+  801b0b:	78 24                	js     801b31 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b0d:	8b 46 08             	mov    0x8(%esi),%eax
+  801b10:	83 e0 03             	and    $0x3,%eax
+  801b13:	83 f8 01             	cmp    $0x1,%eax
+  801b16:	74 20                	je     801b38 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b1b:	8b 40 08             	mov    0x8(%eax),%eax
+  801b1e:	85 c0                	test   %eax,%eax
+  801b20:	74 57                	je     801b79 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b22:	83 ec 04             	sub    $0x4,%esp
+  801b25:	ff 75 10             	push   0x10(%ebp)
+  801b28:	ff 75 0c             	push   0xc(%ebp)
+  801b2b:	56                   	push   %esi
+  801b2c:	ff d0                	call   *%eax
+  801b2e:	83 c4 10             	add    $0x10,%esp
+}
+  801b31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b34:	5b                   	pop    %ebx
+  801b35:	5e                   	pop    %esi
+  801b36:	5d                   	pop    %ebp
+  801b37:	c3                   	ret
+  801b38:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b3a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b3f:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b45:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b4a:	76 1c                	jbe    801b68 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b4c:	8b 42 48             	mov    0x48(%edx),%eax
+  801b4f:	83 ec 04             	sub    $0x4,%esp
+  801b52:	53                   	push   %ebx
+  801b53:	50                   	push   %eax
+  801b54:	68 b9 2f 80 00       	push   $0x802fb9
+  801b59:	e8 c2 e6 ff ff       	call   800220 <cprintf>
+		return -E_INVAL;
+  801b5e:	83 c4 10             	add    $0x10,%esp
+  801b61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b66:	eb c9                	jmp    801b31 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b68:	c1 e8 10             	shr    $0x10,%eax
+  801b6b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b71:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b77:	eb d3                	jmp    801b4c <read+0x73>
+		return -E_NOT_SUPP;
+  801b79:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b7e:	eb b1                	jmp    801b31 <read+0x58>
+
+00801b80 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+  801b83:	57                   	push   %edi
+  801b84:	56                   	push   %esi
+  801b85:	53                   	push   %ebx
+  801b86:	83 ec 0c             	sub    $0xc,%esp
+  801b89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b8c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b94:	eb 02                	jmp    801b98 <readn+0x18>
+  801b96:	01 c3                	add    %eax,%ebx
+  801b98:	39 f3                	cmp    %esi,%ebx
+  801b9a:	73 21                	jae    801bbd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b9c:	83 ec 04             	sub    $0x4,%esp
+  801b9f:	89 f0                	mov    %esi,%eax
+  801ba1:	29 d8                	sub    %ebx,%eax
+  801ba3:	50                   	push   %eax
+  801ba4:	89 d8                	mov    %ebx,%eax
+  801ba6:	03 45 0c             	add    0xc(%ebp),%eax
+  801ba9:	50                   	push   %eax
+  801baa:	57                   	push   %edi
+  801bab:	e8 29 ff ff ff       	call   801ad9 <read>
+		if (m < 0)
+  801bb0:	83 c4 10             	add    $0x10,%esp
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	78 04                	js     801bbb <readn+0x3b>
+			return m;
+		if (m == 0)
+  801bb7:	75 dd                	jne    801b96 <readn+0x16>
+  801bb9:	eb 02                	jmp    801bbd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bbb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801bbd:	89 d8                	mov    %ebx,%eax
+  801bbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bc2:	5b                   	pop    %ebx
+  801bc3:	5e                   	pop    %esi
+  801bc4:	5f                   	pop    %edi
+  801bc5:	5d                   	pop    %ebp
+  801bc6:	c3                   	ret
+
+00801bc7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801bc7:	55                   	push   %ebp
+  801bc8:	89 e5                	mov    %esp,%ebp
+  801bca:	56                   	push   %esi
+  801bcb:	53                   	push   %ebx
+  801bcc:	83 ec 18             	sub    $0x18,%esp
+  801bcf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bd2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bd5:	50                   	push   %eax
+  801bd6:	53                   	push   %ebx
+  801bd7:	e8 77 fc ff ff       	call   801853 <fd_lookup>
+  801bdc:	83 c4 10             	add    $0x10,%esp
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 37                	js     801c1a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801be3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801be6:	83 ec 08             	sub    $0x8,%esp
+  801be9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bec:	50                   	push   %eax
+  801bed:	ff 36                	push   (%esi)
+  801bef:	e8 af fc ff ff       	call   8018a3 <dev_lookup>
+  801bf4:	83 c4 10             	add    $0x10,%esp
+  801bf7:	85 c0                	test   %eax,%eax
+  801bf9:	78 1f                	js     801c1a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bfb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bff:	74 20                	je     801c21 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c04:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c07:	85 c0                	test   %eax,%eax
+  801c09:	74 57                	je     801c62 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c0b:	83 ec 04             	sub    $0x4,%esp
+  801c0e:	ff 75 10             	push   0x10(%ebp)
+  801c11:	ff 75 0c             	push   0xc(%ebp)
+  801c14:	56                   	push   %esi
+  801c15:	ff d0                	call   *%eax
+  801c17:	83 c4 10             	add    $0x10,%esp
+}
+  801c1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c1d:	5b                   	pop    %ebx
+  801c1e:	5e                   	pop    %esi
+  801c1f:	5d                   	pop    %ebp
+  801c20:	c3                   	ret
+  801c21:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c23:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c28:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c2e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c33:	76 1c                	jbe    801c51 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c35:	8b 42 48             	mov    0x48(%edx),%eax
+  801c38:	83 ec 04             	sub    $0x4,%esp
+  801c3b:	53                   	push   %ebx
+  801c3c:	50                   	push   %eax
+  801c3d:	68 d5 2f 80 00       	push   $0x802fd5
+  801c42:	e8 d9 e5 ff ff       	call   800220 <cprintf>
+		return -E_INVAL;
+  801c47:	83 c4 10             	add    $0x10,%esp
+  801c4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c4f:	eb c9                	jmp    801c1a <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c51:	c1 e8 10             	shr    $0x10,%eax
+  801c54:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c5a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c60:	eb d3                	jmp    801c35 <write+0x6e>
+		return -E_NOT_SUPP;
+  801c62:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c67:	eb b1                	jmp    801c1a <write+0x53>
+
+00801c69 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c72:	50                   	push   %eax
+  801c73:	ff 75 08             	push   0x8(%ebp)
+  801c76:	e8 d8 fb ff ff       	call   801853 <fd_lookup>
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	78 0e                	js     801c90 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c88:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c90:	c9                   	leave
+  801c91:	c3                   	ret
+
+00801c92 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c92:	55                   	push   %ebp
+  801c93:	89 e5                	mov    %esp,%ebp
+  801c95:	56                   	push   %esi
+  801c96:	53                   	push   %ebx
+  801c97:	83 ec 18             	sub    $0x18,%esp
+  801c9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca0:	50                   	push   %eax
+  801ca1:	53                   	push   %ebx
+  801ca2:	e8 ac fb ff ff       	call   801853 <fd_lookup>
+  801ca7:	83 c4 10             	add    $0x10,%esp
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	78 34                	js     801ce2 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cb1:	83 ec 08             	sub    $0x8,%esp
+  801cb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb7:	50                   	push   %eax
+  801cb8:	ff 36                	push   (%esi)
+  801cba:	e8 e4 fb ff ff       	call   8018a3 <dev_lookup>
+  801cbf:	83 c4 10             	add    $0x10,%esp
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 1c                	js     801ce2 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cc6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cca:	74 1d                	je     801ce9 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801ccc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ccf:	8b 40 18             	mov    0x18(%eax),%eax
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	74 54                	je     801d2a <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801cd6:	83 ec 08             	sub    $0x8,%esp
+  801cd9:	ff 75 0c             	push   0xc(%ebp)
+  801cdc:	56                   	push   %esi
+  801cdd:	ff d0                	call   *%eax
+  801cdf:	83 c4 10             	add    $0x10,%esp
+}
+  801ce2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce5:	5b                   	pop    %ebx
+  801ce6:	5e                   	pop    %esi
+  801ce7:	5d                   	pop    %ebp
+  801ce8:	c3                   	ret
+  801ce9:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ceb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cf0:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cf6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cfb:	76 1c                	jbe    801d19 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cfd:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d00:	83 ec 04             	sub    $0x4,%esp
+  801d03:	53                   	push   %ebx
+  801d04:	50                   	push   %eax
+  801d05:	68 98 2f 80 00       	push   $0x802f98
+  801d0a:	e8 11 e5 ff ff       	call   800220 <cprintf>
+		return -E_INVAL;
+  801d0f:	83 c4 10             	add    $0x10,%esp
+  801d12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d17:	eb c9                	jmp    801ce2 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d19:	c1 e8 10             	shr    $0x10,%eax
+  801d1c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d22:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d28:	eb d3                	jmp    801cfd <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801d2a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d2f:	eb b1                	jmp    801ce2 <ftruncate+0x50>
+
+00801d31 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d31:	55                   	push   %ebp
+  801d32:	89 e5                	mov    %esp,%ebp
+  801d34:	56                   	push   %esi
+  801d35:	53                   	push   %ebx
+  801d36:	83 ec 18             	sub    $0x18,%esp
+  801d39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d3c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d3f:	50                   	push   %eax
+  801d40:	ff 75 08             	push   0x8(%ebp)
+  801d43:	e8 0b fb ff ff       	call   801853 <fd_lookup>
+  801d48:	83 c4 10             	add    $0x10,%esp
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	78 49                	js     801d98 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d4f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d52:	83 ec 08             	sub    $0x8,%esp
+  801d55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d58:	50                   	push   %eax
+  801d59:	ff 36                	push   (%esi)
+  801d5b:	e8 43 fb ff ff       	call   8018a3 <dev_lookup>
+  801d60:	83 c4 10             	add    $0x10,%esp
+  801d63:	85 c0                	test   %eax,%eax
+  801d65:	78 31                	js     801d98 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d6a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d6e:	74 2f                	je     801d9f <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d70:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d73:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d7a:	00 00 00 
+	stat->st_isdir = 0;
+  801d7d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d84:	00 00 00 
+	stat->st_dev = dev;
+  801d87:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d8d:	83 ec 08             	sub    $0x8,%esp
+  801d90:	53                   	push   %ebx
+  801d91:	56                   	push   %esi
+  801d92:	ff 50 14             	call   *0x14(%eax)
+  801d95:	83 c4 10             	add    $0x10,%esp
+}
+  801d98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d9b:	5b                   	pop    %ebx
+  801d9c:	5e                   	pop    %esi
+  801d9d:	5d                   	pop    %ebp
+  801d9e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d9f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801da4:	eb f2                	jmp    801d98 <fstat+0x67>
+
+00801da6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	56                   	push   %esi
+  801daa:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801dab:	83 ec 08             	sub    $0x8,%esp
+  801dae:	6a 00                	push   $0x0
+  801db0:	ff 75 08             	push   0x8(%ebp)
+  801db3:	e8 e4 01 00 00       	call   801f9c <open>
+  801db8:	89 c3                	mov    %eax,%ebx
+  801dba:	83 c4 10             	add    $0x10,%esp
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	78 1b                	js     801ddc <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801dc1:	83 ec 08             	sub    $0x8,%esp
+  801dc4:	ff 75 0c             	push   0xc(%ebp)
+  801dc7:	50                   	push   %eax
+  801dc8:	e8 64 ff ff ff       	call   801d31 <fstat>
+  801dcd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801dcf:	89 1c 24             	mov    %ebx,(%esp)
+  801dd2:	e8 c6 fb ff ff       	call   80199d <close>
+	return r;
+  801dd7:	83 c4 10             	add    $0x10,%esp
+  801dda:	89 f3                	mov    %esi,%ebx
+}
+  801ddc:	89 d8                	mov    %ebx,%eax
+  801dde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de1:	5b                   	pop    %ebx
+  801de2:	5e                   	pop    %esi
+  801de3:	5d                   	pop    %ebp
+  801de4:	c3                   	ret
+
+00801de5 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801de5:	55                   	push   %ebp
+  801de6:	89 e5                	mov    %esp,%ebp
+  801de8:	56                   	push   %esi
+  801de9:	53                   	push   %ebx
+  801dea:	89 c6                	mov    %eax,%esi
+  801dec:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801dee:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801df5:	74 27                	je     801e1e <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801df7:	6a 07                	push   $0x7
+  801df9:	68 00 60 80 00       	push   $0x806000
+  801dfe:	56                   	push   %esi
+  801dff:	ff 35 00 50 80 00    	push   0x805000
+  801e05:	e8 b2 0c 00 00       	call   802abc <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e0a:	83 c4 0c             	add    $0xc,%esp
+  801e0d:	6a 00                	push   $0x0
+  801e0f:	53                   	push   %ebx
+  801e10:	6a 00                	push   $0x0
+  801e12:	e8 8d 0c 00 00       	call   802aa4 <ipc_recv>
+}
+  801e17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e1a:	5b                   	pop    %ebx
+  801e1b:	5e                   	pop    %esi
+  801e1c:	5d                   	pop    %ebp
+  801e1d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e1e:	83 ec 0c             	sub    $0xc,%esp
+  801e21:	6a 01                	push   $0x1
+  801e23:	e8 e8 0c 00 00       	call   802b10 <ipc_find_env>
+  801e28:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e2d:	83 c4 10             	add    $0x10,%esp
+  801e30:	eb c5                	jmp    801df7 <fsipc+0x12>
+
+00801e32 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e32:	55                   	push   %ebp
+  801e33:	89 e5                	mov    %esp,%ebp
+  801e35:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e3e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e43:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e46:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e50:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e55:	e8 8b ff ff ff       	call   801de5 <fsipc>
+}
+  801e5a:	c9                   	leave
+  801e5b:	c3                   	ret
+
+00801e5c <devfile_flush>:
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e62:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e65:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e68:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e72:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e77:	e8 69 ff ff ff       	call   801de5 <fsipc>
+}
+  801e7c:	c9                   	leave
+  801e7d:	c3                   	ret
+
+00801e7e <devfile_stat>:
+{
+  801e7e:	55                   	push   %ebp
+  801e7f:	89 e5                	mov    %esp,%ebp
+  801e81:	53                   	push   %ebx
+  801e82:	83 ec 04             	sub    $0x4,%esp
+  801e85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e8b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e8e:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e98:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e9d:	e8 43 ff ff ff       	call   801de5 <fsipc>
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 2c                	js     801ed2 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ea6:	83 ec 08             	sub    $0x8,%esp
+  801ea9:	68 00 60 80 00       	push   $0x806000
+  801eae:	53                   	push   %ebx
+  801eaf:	e8 b4 e9 ff ff       	call   800868 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801eb4:	a1 80 60 80 00       	mov    0x806080,%eax
+  801eb9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ebf:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ec4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ed2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed5:	c9                   	leave
+  801ed6:	c3                   	ret
+
+00801ed7 <devfile_write>:
+{
+  801ed7:	55                   	push   %ebp
+  801ed8:	89 e5                	mov    %esp,%ebp
+  801eda:	83 ec 0c             	sub    $0xc,%esp
+  801edd:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ee0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee3:	8b 52 0c             	mov    0xc(%edx),%edx
+  801ee6:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801eec:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801ef1:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ef6:	39 d0                	cmp    %edx,%eax
+  801ef8:	0f 47 c2             	cmova  %edx,%eax
+  801efb:	50                   	push   %eax
+  801efc:	ff 75 0c             	push   0xc(%ebp)
+  801eff:	68 08 60 80 00       	push   $0x806008
+  801f04:	e8 e5 ea ff ff       	call   8009ee <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f0e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f13:	e8 cd fe ff ff       	call   801de5 <fsipc>
+}
+  801f18:	c9                   	leave
+  801f19:	c3                   	ret
+
+00801f1a <devfile_read>:
+{
+  801f1a:	55                   	push   %ebp
+  801f1b:	89 e5                	mov    %esp,%ebp
+  801f1d:	56                   	push   %esi
+  801f1e:	53                   	push   %ebx
+  801f1f:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f25:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f28:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801f2d:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f38:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f3d:	e8 a3 fe ff ff       	call   801de5 <fsipc>
+  801f42:	89 c3                	mov    %eax,%ebx
+  801f44:	85 c0                	test   %eax,%eax
+  801f46:	78 1f                	js     801f67 <devfile_read+0x4d>
+	assert(r <= n);
+  801f48:	39 c6                	cmp    %eax,%esi
+  801f4a:	72 24                	jb     801f70 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f4c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f51:	7f 33                	jg     801f86 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f53:	83 ec 04             	sub    $0x4,%esp
+  801f56:	50                   	push   %eax
+  801f57:	68 00 60 80 00       	push   $0x806000
+  801f5c:	ff 75 0c             	push   0xc(%ebp)
+  801f5f:	e8 8a ea ff ff       	call   8009ee <memmove>
+	return r;
+  801f64:	83 c4 10             	add    $0x10,%esp
+}
+  801f67:	89 d8                	mov    %ebx,%eax
+  801f69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f6c:	5b                   	pop    %ebx
+  801f6d:	5e                   	pop    %esi
+  801f6e:	5d                   	pop    %ebp
+  801f6f:	c3                   	ret
+	assert(r <= n);
+  801f70:	68 08 30 80 00       	push   $0x803008
+  801f75:	68 0f 30 80 00       	push   $0x80300f
+  801f7a:	6a 76                	push   $0x76
+  801f7c:	68 24 30 80 00       	push   $0x803024
+  801f81:	e8 bf e1 ff ff       	call   800145 <_panic>
+	assert(r <= PGSIZE);
+  801f86:	68 2f 30 80 00       	push   $0x80302f
+  801f8b:	68 0f 30 80 00       	push   $0x80300f
+  801f90:	6a 77                	push   $0x77
+  801f92:	68 24 30 80 00       	push   $0x803024
+  801f97:	e8 a9 e1 ff ff       	call   800145 <_panic>
+
+00801f9c <open>:
+{
+  801f9c:	55                   	push   %ebp
+  801f9d:	89 e5                	mov    %esp,%ebp
+  801f9f:	56                   	push   %esi
+  801fa0:	53                   	push   %ebx
+  801fa1:	83 ec 1c             	sub    $0x1c,%esp
+  801fa4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801fa7:	56                   	push   %esi
+  801fa8:	e8 80 e8 ff ff       	call   80082d <strlen>
+  801fad:	83 c4 10             	add    $0x10,%esp
+  801fb0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fb5:	7f 6c                	jg     802023 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801fb7:	83 ec 0c             	sub    $0xc,%esp
+  801fba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fbd:	50                   	push   %eax
+  801fbe:	e8 3a f8 ff ff       	call   8017fd <fd_alloc>
+  801fc3:	89 c3                	mov    %eax,%ebx
+  801fc5:	83 c4 10             	add    $0x10,%esp
+  801fc8:	85 c0                	test   %eax,%eax
+  801fca:	78 3c                	js     802008 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801fcc:	83 ec 08             	sub    $0x8,%esp
+  801fcf:	56                   	push   %esi
+  801fd0:	68 00 60 80 00       	push   $0x806000
+  801fd5:	e8 8e e8 ff ff       	call   800868 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801fda:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fdd:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fe2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fe5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fea:	e8 f6 fd ff ff       	call   801de5 <fsipc>
+  801fef:	89 c3                	mov    %eax,%ebx
+  801ff1:	83 c4 10             	add    $0x10,%esp
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	78 19                	js     802011 <open+0x75>
+	return fd2num(fd);
+  801ff8:	83 ec 0c             	sub    $0xc,%esp
+  801ffb:	ff 75 f4             	push   -0xc(%ebp)
+  801ffe:	e8 d3 f7 ff ff       	call   8017d6 <fd2num>
+  802003:	89 c3                	mov    %eax,%ebx
+  802005:	83 c4 10             	add    $0x10,%esp
+}
+  802008:	89 d8                	mov    %ebx,%eax
+  80200a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80200d:	5b                   	pop    %ebx
+  80200e:	5e                   	pop    %esi
+  80200f:	5d                   	pop    %ebp
+  802010:	c3                   	ret
+		fd_close(fd, 0);
+  802011:	83 ec 08             	sub    $0x8,%esp
+  802014:	6a 00                	push   $0x0
+  802016:	ff 75 f4             	push   -0xc(%ebp)
+  802019:	e8 f8 f8 ff ff       	call   801916 <fd_close>
+		return r;
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	eb e5                	jmp    802008 <open+0x6c>
+		return -E_BAD_PATH;
+  802023:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802028:	eb de                	jmp    802008 <open+0x6c>
+
+0080202a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802030:	ba 00 00 00 00       	mov    $0x0,%edx
+  802035:	b8 08 00 00 00       	mov    $0x8,%eax
+  80203a:	e8 a6 fd ff ff       	call   801de5 <fsipc>
+}
+  80203f:	c9                   	leave
+  802040:	c3                   	ret
+
+00802041 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802041:	55                   	push   %ebp
+  802042:	89 e5                	mov    %esp,%ebp
+  802044:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802047:	68 3b 30 80 00       	push   $0x80303b
+  80204c:	ff 75 0c             	push   0xc(%ebp)
+  80204f:	e8 14 e8 ff ff       	call   800868 <strcpy>
+	return 0;
+}
+  802054:	b8 00 00 00 00       	mov    $0x0,%eax
+  802059:	c9                   	leave
+  80205a:	c3                   	ret
+
+0080205b <devsock_close>:
+{
+  80205b:	55                   	push   %ebp
+  80205c:	89 e5                	mov    %esp,%ebp
+  80205e:	53                   	push   %ebx
+  80205f:	83 ec 10             	sub    $0x10,%esp
+  802062:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802065:	53                   	push   %ebx
+  802066:	e8 e4 0a 00 00       	call   802b4f <pageref>
+  80206b:	89 c2                	mov    %eax,%edx
+  80206d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802070:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802075:	83 fa 01             	cmp    $0x1,%edx
+  802078:	74 05                	je     80207f <devsock_close+0x24>
+}
+  80207a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80207d:	c9                   	leave
+  80207e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80207f:	83 ec 0c             	sub    $0xc,%esp
+  802082:	ff 73 0c             	push   0xc(%ebx)
+  802085:	e8 b7 02 00 00       	call   802341 <nsipc_close>
+  80208a:	83 c4 10             	add    $0x10,%esp
+  80208d:	eb eb                	jmp    80207a <devsock_close+0x1f>
+
+0080208f <devsock_write>:
+{
+  80208f:	55                   	push   %ebp
+  802090:	89 e5                	mov    %esp,%ebp
+  802092:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802095:	6a 00                	push   $0x0
+  802097:	ff 75 10             	push   0x10(%ebp)
+  80209a:	ff 75 0c             	push   0xc(%ebp)
+  80209d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a0:	ff 70 0c             	push   0xc(%eax)
+  8020a3:	e8 79 03 00 00       	call   802421 <nsipc_send>
+}
+  8020a8:	c9                   	leave
+  8020a9:	c3                   	ret
+
+008020aa <devsock_read>:
+{
+  8020aa:	55                   	push   %ebp
+  8020ab:	89 e5                	mov    %esp,%ebp
+  8020ad:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8020b0:	6a 00                	push   $0x0
+  8020b2:	ff 75 10             	push   0x10(%ebp)
+  8020b5:	ff 75 0c             	push   0xc(%ebp)
+  8020b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020bb:	ff 70 0c             	push   0xc(%eax)
+  8020be:	e8 ef 02 00 00       	call   8023b2 <nsipc_recv>
+}
+  8020c3:	c9                   	leave
+  8020c4:	c3                   	ret
+
+008020c5 <fd2sockid>:
+{
+  8020c5:	55                   	push   %ebp
+  8020c6:	89 e5                	mov    %esp,%ebp
+  8020c8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8020cb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020ce:	52                   	push   %edx
+  8020cf:	50                   	push   %eax
+  8020d0:	e8 7e f7 ff ff       	call   801853 <fd_lookup>
+  8020d5:	83 c4 10             	add    $0x10,%esp
+  8020d8:	85 c0                	test   %eax,%eax
+  8020da:	78 10                	js     8020ec <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8020dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020df:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8020e5:	39 08                	cmp    %ecx,(%eax)
+  8020e7:	75 05                	jne    8020ee <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8020e9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020ec:	c9                   	leave
+  8020ed:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020ee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020f3:	eb f7                	jmp    8020ec <fd2sockid+0x27>
+
+008020f5 <alloc_sockfd>:
+{
+  8020f5:	55                   	push   %ebp
+  8020f6:	89 e5                	mov    %esp,%ebp
+  8020f8:	56                   	push   %esi
+  8020f9:	53                   	push   %ebx
+  8020fa:	83 ec 1c             	sub    $0x1c,%esp
+  8020fd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802102:	50                   	push   %eax
+  802103:	e8 f5 f6 ff ff       	call   8017fd <fd_alloc>
+  802108:	89 c3                	mov    %eax,%ebx
+  80210a:	83 c4 10             	add    $0x10,%esp
+  80210d:	85 c0                	test   %eax,%eax
+  80210f:	78 43                	js     802154 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802111:	83 ec 04             	sub    $0x4,%esp
+  802114:	68 07 04 00 00       	push   $0x407
+  802119:	ff 75 f4             	push   -0xc(%ebp)
+  80211c:	6a 00                	push   $0x0
+  80211e:	e8 3d ec ff ff       	call   800d60 <sys_page_alloc>
+  802123:	89 c3                	mov    %eax,%ebx
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 28                	js     802154 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80212c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80212f:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802135:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802137:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80213a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802141:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802144:	83 ec 0c             	sub    $0xc,%esp
+  802147:	50                   	push   %eax
+  802148:	e8 89 f6 ff ff       	call   8017d6 <fd2num>
+  80214d:	89 c3                	mov    %eax,%ebx
+  80214f:	83 c4 10             	add    $0x10,%esp
+  802152:	eb 0c                	jmp    802160 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802154:	83 ec 0c             	sub    $0xc,%esp
+  802157:	56                   	push   %esi
+  802158:	e8 e4 01 00 00       	call   802341 <nsipc_close>
+		return r;
+  80215d:	83 c4 10             	add    $0x10,%esp
+}
+  802160:	89 d8                	mov    %ebx,%eax
+  802162:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802165:	5b                   	pop    %ebx
+  802166:	5e                   	pop    %esi
+  802167:	5d                   	pop    %ebp
+  802168:	c3                   	ret
+
+00802169 <accept>:
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80216f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802172:	e8 4e ff ff ff       	call   8020c5 <fd2sockid>
+  802177:	85 c0                	test   %eax,%eax
+  802179:	78 1b                	js     802196 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80217b:	83 ec 04             	sub    $0x4,%esp
+  80217e:	ff 75 10             	push   0x10(%ebp)
+  802181:	ff 75 0c             	push   0xc(%ebp)
+  802184:	50                   	push   %eax
+  802185:	e8 0e 01 00 00       	call   802298 <nsipc_accept>
+  80218a:	83 c4 10             	add    $0x10,%esp
+  80218d:	85 c0                	test   %eax,%eax
+  80218f:	78 05                	js     802196 <accept+0x2d>
+	return alloc_sockfd(r);
+  802191:	e8 5f ff ff ff       	call   8020f5 <alloc_sockfd>
+}
+  802196:	c9                   	leave
+  802197:	c3                   	ret
+
+00802198 <bind>:
+{
+  802198:	55                   	push   %ebp
+  802199:	89 e5                	mov    %esp,%ebp
+  80219b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80219e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a1:	e8 1f ff ff ff       	call   8020c5 <fd2sockid>
+  8021a6:	85 c0                	test   %eax,%eax
+  8021a8:	78 12                	js     8021bc <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8021aa:	83 ec 04             	sub    $0x4,%esp
+  8021ad:	ff 75 10             	push   0x10(%ebp)
+  8021b0:	ff 75 0c             	push   0xc(%ebp)
+  8021b3:	50                   	push   %eax
+  8021b4:	e8 31 01 00 00       	call   8022ea <nsipc_bind>
+  8021b9:	83 c4 10             	add    $0x10,%esp
+}
+  8021bc:	c9                   	leave
+  8021bd:	c3                   	ret
+
+008021be <shutdown>:
+{
+  8021be:	55                   	push   %ebp
+  8021bf:	89 e5                	mov    %esp,%ebp
+  8021c1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c7:	e8 f9 fe ff ff       	call   8020c5 <fd2sockid>
+  8021cc:	85 c0                	test   %eax,%eax
+  8021ce:	78 0f                	js     8021df <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8021d0:	83 ec 08             	sub    $0x8,%esp
+  8021d3:	ff 75 0c             	push   0xc(%ebp)
+  8021d6:	50                   	push   %eax
+  8021d7:	e8 43 01 00 00       	call   80231f <nsipc_shutdown>
+  8021dc:	83 c4 10             	add    $0x10,%esp
+}
+  8021df:	c9                   	leave
+  8021e0:	c3                   	ret
+
+008021e1 <connect>:
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ea:	e8 d6 fe ff ff       	call   8020c5 <fd2sockid>
+  8021ef:	85 c0                	test   %eax,%eax
+  8021f1:	78 12                	js     802205 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021f3:	83 ec 04             	sub    $0x4,%esp
+  8021f6:	ff 75 10             	push   0x10(%ebp)
+  8021f9:	ff 75 0c             	push   0xc(%ebp)
+  8021fc:	50                   	push   %eax
+  8021fd:	e8 59 01 00 00       	call   80235b <nsipc_connect>
+  802202:	83 c4 10             	add    $0x10,%esp
+}
+  802205:	c9                   	leave
+  802206:	c3                   	ret
+
+00802207 <listen>:
+{
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80220d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802210:	e8 b0 fe ff ff       	call   8020c5 <fd2sockid>
+  802215:	85 c0                	test   %eax,%eax
+  802217:	78 0f                	js     802228 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802219:	83 ec 08             	sub    $0x8,%esp
+  80221c:	ff 75 0c             	push   0xc(%ebp)
+  80221f:	50                   	push   %eax
+  802220:	e8 6b 01 00 00       	call   802390 <nsipc_listen>
+  802225:	83 c4 10             	add    $0x10,%esp
+}
+  802228:	c9                   	leave
+  802229:	c3                   	ret
+
+0080222a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80222a:	55                   	push   %ebp
+  80222b:	89 e5                	mov    %esp,%ebp
+  80222d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802230:	ff 75 10             	push   0x10(%ebp)
+  802233:	ff 75 0c             	push   0xc(%ebp)
+  802236:	ff 75 08             	push   0x8(%ebp)
+  802239:	e8 41 02 00 00       	call   80247f <nsipc_socket>
+  80223e:	83 c4 10             	add    $0x10,%esp
+  802241:	85 c0                	test   %eax,%eax
+  802243:	78 05                	js     80224a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802245:	e8 ab fe ff ff       	call   8020f5 <alloc_sockfd>
+}
+  80224a:	c9                   	leave
+  80224b:	c3                   	ret
+
+0080224c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	53                   	push   %ebx
+  802250:	83 ec 04             	sub    $0x4,%esp
+  802253:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802255:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80225c:	74 26                	je     802284 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80225e:	6a 07                	push   $0x7
+  802260:	68 00 70 80 00       	push   $0x807000
+  802265:	53                   	push   %ebx
+  802266:	ff 35 04 50 80 00    	push   0x805004
+  80226c:	e8 4b 08 00 00       	call   802abc <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802271:	83 c4 0c             	add    $0xc,%esp
+  802274:	6a 00                	push   $0x0
+  802276:	6a 00                	push   $0x0
+  802278:	6a 00                	push   $0x0
+  80227a:	e8 25 08 00 00       	call   802aa4 <ipc_recv>
+}
+  80227f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802282:	c9                   	leave
+  802283:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802284:	83 ec 0c             	sub    $0xc,%esp
+  802287:	6a 02                	push   $0x2
+  802289:	e8 82 08 00 00       	call   802b10 <ipc_find_env>
+  80228e:	a3 04 50 80 00       	mov    %eax,0x805004
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	eb c6                	jmp    80225e <nsipc+0x12>
+
+00802298 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802298:	55                   	push   %ebp
+  802299:	89 e5                	mov    %esp,%ebp
+  80229b:	56                   	push   %esi
+  80229c:	53                   	push   %ebx
+  80229d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8022a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8022a8:	8b 06                	mov    (%esi),%eax
+  8022aa:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8022af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b4:	e8 93 ff ff ff       	call   80224c <nsipc>
+  8022b9:	89 c3                	mov    %eax,%ebx
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	79 09                	jns    8022c8 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8022bf:	89 d8                	mov    %ebx,%eax
+  8022c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022c4:	5b                   	pop    %ebx
+  8022c5:	5e                   	pop    %esi
+  8022c6:	5d                   	pop    %ebp
+  8022c7:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8022c8:	83 ec 04             	sub    $0x4,%esp
+  8022cb:	ff 35 10 70 80 00    	push   0x807010
+  8022d1:	68 00 70 80 00       	push   $0x807000
+  8022d6:	ff 75 0c             	push   0xc(%ebp)
+  8022d9:	e8 10 e7 ff ff       	call   8009ee <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022de:	a1 10 70 80 00       	mov    0x807010,%eax
+  8022e3:	89 06                	mov    %eax,(%esi)
+  8022e5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8022e8:	eb d5                	jmp    8022bf <nsipc_accept+0x27>
+
+008022ea <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8022ea:	55                   	push   %ebp
+  8022eb:	89 e5                	mov    %esp,%ebp
+  8022ed:	53                   	push   %ebx
+  8022ee:	83 ec 08             	sub    $0x8,%esp
+  8022f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f7:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022fc:	53                   	push   %ebx
+  8022fd:	ff 75 0c             	push   0xc(%ebp)
+  802300:	68 04 70 80 00       	push   $0x807004
+  802305:	e8 e4 e6 ff ff       	call   8009ee <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80230a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802310:	b8 02 00 00 00       	mov    $0x2,%eax
+  802315:	e8 32 ff ff ff       	call   80224c <nsipc>
+}
+  80231a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80231d:	c9                   	leave
+  80231e:	c3                   	ret
+
+0080231f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802325:	8b 45 08             	mov    0x8(%ebp),%eax
+  802328:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80232d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802330:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802335:	b8 03 00 00 00       	mov    $0x3,%eax
+  80233a:	e8 0d ff ff ff       	call   80224c <nsipc>
+}
+  80233f:	c9                   	leave
+  802340:	c3                   	ret
+
+00802341 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802341:	55                   	push   %ebp
+  802342:	89 e5                	mov    %esp,%ebp
+  802344:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802347:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80234f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802354:	e8 f3 fe ff ff       	call   80224c <nsipc>
+}
+  802359:	c9                   	leave
+  80235a:	c3                   	ret
+
+0080235b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80235b:	55                   	push   %ebp
+  80235c:	89 e5                	mov    %esp,%ebp
+  80235e:	53                   	push   %ebx
+  80235f:	83 ec 08             	sub    $0x8,%esp
+  802362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802365:	8b 45 08             	mov    0x8(%ebp),%eax
+  802368:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80236d:	53                   	push   %ebx
+  80236e:	ff 75 0c             	push   0xc(%ebp)
+  802371:	68 04 70 80 00       	push   $0x807004
+  802376:	e8 73 e6 ff ff       	call   8009ee <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80237b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802381:	b8 05 00 00 00       	mov    $0x5,%eax
+  802386:	e8 c1 fe ff ff       	call   80224c <nsipc>
+}
+  80238b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80238e:	c9                   	leave
+  80238f:	c3                   	ret
+
+00802390 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802390:	55                   	push   %ebp
+  802391:	89 e5                	mov    %esp,%ebp
+  802393:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802396:	8b 45 08             	mov    0x8(%ebp),%eax
+  802399:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80239e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8023a6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023ab:	e8 9c fe ff ff       	call   80224c <nsipc>
+}
+  8023b0:	c9                   	leave
+  8023b1:	c3                   	ret
+
+008023b2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8023b2:	55                   	push   %ebp
+  8023b3:	89 e5                	mov    %esp,%ebp
+  8023b5:	56                   	push   %esi
+  8023b6:	53                   	push   %ebx
+  8023b7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8023ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8023c2:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8023c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023cb:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023d0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023d5:	e8 72 fe ff ff       	call   80224c <nsipc>
+  8023da:	89 c3                	mov    %eax,%ebx
+  8023dc:	85 c0                	test   %eax,%eax
+  8023de:	78 22                	js     802402 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8023e0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8023e5:	39 c6                	cmp    %eax,%esi
+  8023e7:	0f 4e c6             	cmovle %esi,%eax
+  8023ea:	39 c3                	cmp    %eax,%ebx
+  8023ec:	7f 1d                	jg     80240b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023ee:	83 ec 04             	sub    $0x4,%esp
+  8023f1:	53                   	push   %ebx
+  8023f2:	68 00 70 80 00       	push   $0x807000
+  8023f7:	ff 75 0c             	push   0xc(%ebp)
+  8023fa:	e8 ef e5 ff ff       	call   8009ee <memmove>
+  8023ff:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802402:	89 d8                	mov    %ebx,%eax
+  802404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802407:	5b                   	pop    %ebx
+  802408:	5e                   	pop    %esi
+  802409:	5d                   	pop    %ebp
+  80240a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80240b:	68 47 30 80 00       	push   $0x803047
+  802410:	68 0f 30 80 00       	push   $0x80300f
+  802415:	6a 62                	push   $0x62
+  802417:	68 5c 30 80 00       	push   $0x80305c
+  80241c:	e8 24 dd ff ff       	call   800145 <_panic>
+
+00802421 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	53                   	push   %ebx
+  802425:	83 ec 04             	sub    $0x4,%esp
+  802428:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80242b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80242e:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802433:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802439:	7f 2e                	jg     802469 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80243b:	83 ec 04             	sub    $0x4,%esp
+  80243e:	53                   	push   %ebx
+  80243f:	ff 75 0c             	push   0xc(%ebp)
+  802442:	68 0c 70 80 00       	push   $0x80700c
+  802447:	e8 a2 e5 ff ff       	call   8009ee <memmove>
+	nsipcbuf.send.req_size = size;
+  80244c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802452:	8b 45 14             	mov    0x14(%ebp),%eax
+  802455:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80245a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80245f:	e8 e8 fd ff ff       	call   80224c <nsipc>
+}
+  802464:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802467:	c9                   	leave
+  802468:	c3                   	ret
+	assert(size < 1600);
+  802469:	68 68 30 80 00       	push   $0x803068
+  80246e:	68 0f 30 80 00       	push   $0x80300f
+  802473:	6a 6d                	push   $0x6d
+  802475:	68 5c 30 80 00       	push   $0x80305c
+  80247a:	e8 c6 dc ff ff       	call   800145 <_panic>
+
+0080247f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80247f:	55                   	push   %ebp
+  802480:	89 e5                	mov    %esp,%ebp
+  802482:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802485:	8b 45 08             	mov    0x8(%ebp),%eax
+  802488:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80248d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802490:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802495:	8b 45 10             	mov    0x10(%ebp),%eax
+  802498:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80249d:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024a2:	e8 a5 fd ff ff       	call   80224c <nsipc>
+}
+  8024a7:	c9                   	leave
+  8024a8:	c3                   	ret
+
+008024a9 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024a9:	55                   	push   %ebp
+  8024aa:	89 e5                	mov    %esp,%ebp
+  8024ac:	56                   	push   %esi
+  8024ad:	53                   	push   %ebx
+  8024ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8024b1:	83 ec 0c             	sub    $0xc,%esp
+  8024b4:	ff 75 08             	push   0x8(%ebp)
+  8024b7:	e8 2a f3 ff ff       	call   8017e6 <fd2data>
+  8024bc:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8024be:	83 c4 08             	add    $0x8,%esp
+  8024c1:	68 74 30 80 00       	push   $0x803074
+  8024c6:	53                   	push   %ebx
+  8024c7:	e8 9c e3 ff ff       	call   800868 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8024cc:	8b 46 04             	mov    0x4(%esi),%eax
+  8024cf:	2b 06                	sub    (%esi),%eax
+  8024d1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8024d7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024de:	00 00 00 
+	stat->st_dev = &devpipe;
+  8024e1:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024e8:	40 80 00 
+	return 0;
+}
+  8024eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024f3:	5b                   	pop    %ebx
+  8024f4:	5e                   	pop    %esi
+  8024f5:	5d                   	pop    %ebp
+  8024f6:	c3                   	ret
+
+008024f7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024f7:	55                   	push   %ebp
+  8024f8:	89 e5                	mov    %esp,%ebp
+  8024fa:	53                   	push   %ebx
+  8024fb:	83 ec 0c             	sub    $0xc,%esp
+  8024fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802501:	53                   	push   %ebx
+  802502:	6a 00                	push   $0x0
+  802504:	e8 32 e9 ff ff       	call   800e3b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802509:	89 1c 24             	mov    %ebx,(%esp)
+  80250c:	e8 d5 f2 ff ff       	call   8017e6 <fd2data>
+  802511:	83 c4 08             	add    $0x8,%esp
+  802514:	50                   	push   %eax
+  802515:	6a 00                	push   $0x0
+  802517:	e8 1f e9 ff ff       	call   800e3b <sys_page_unmap>
+}
+  80251c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80251f:	c9                   	leave
+  802520:	c3                   	ret
+
+00802521 <_pipeisclosed>:
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	57                   	push   %edi
+  802525:	56                   	push   %esi
+  802526:	53                   	push   %ebx
+  802527:	83 ec 1c             	sub    $0x1c,%esp
+  80252a:	89 c7                	mov    %eax,%edi
+  80252c:	89 d6                	mov    %edx,%esi
+  80252e:	eb 3c                	jmp    80256c <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802530:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802533:	83 ec 0c             	sub    $0xc,%esp
+  802536:	57                   	push   %edi
+  802537:	e8 13 06 00 00       	call   802b4f <pageref>
+  80253c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80253f:	89 34 24             	mov    %esi,(%esp)
+  802542:	e8 08 06 00 00       	call   802b4f <pageref>
+  802547:	89 c2                	mov    %eax,%edx
+  802549:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80254b:	05 00 00 00 20       	add    $0x20000000,%eax
+  802550:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802553:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802559:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80255e:	76 31                	jbe    802591 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802560:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802563:	39 c3                	cmp    %eax,%ebx
+  802565:	74 76                	je     8025dd <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802567:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80256a:	74 36                	je     8025a2 <_pipeisclosed+0x81>
+  80256c:	89 e0                	mov    %esp,%eax
+  80256e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802573:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802579:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80257e:	77 b0                	ja     802530 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802580:	c1 e8 10             	shr    $0x10,%eax
+  802583:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802589:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80258f:	eb 9f                	jmp    802530 <_pipeisclosed+0xf>
+  802591:	c1 e8 10             	shr    $0x10,%eax
+  802594:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80259a:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8025a0:	eb be                	jmp    802560 <_pipeisclosed+0x3f>
+  8025a2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025a4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025a9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025af:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025b4:	76 16                	jbe    8025cc <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8025b6:	8b 42 58             	mov    0x58(%edx),%eax
+  8025b9:	6a 01                	push   $0x1
+  8025bb:	50                   	push   %eax
+  8025bc:	53                   	push   %ebx
+  8025bd:	68 7b 30 80 00       	push   $0x80307b
+  8025c2:	e8 59 dc ff ff       	call   800220 <cprintf>
+  8025c7:	83 c4 10             	add    $0x10,%esp
+  8025ca:	eb a0                	jmp    80256c <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025cc:	c1 e8 10             	shr    $0x10,%eax
+  8025cf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025d5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025db:	eb d9                	jmp    8025b6 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8025dd:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025e0:	0f 94 c0             	sete   %al
+  8025e3:	0f b6 c0             	movzbl %al,%eax
+}
+  8025e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e9:	5b                   	pop    %ebx
+  8025ea:	5e                   	pop    %esi
+  8025eb:	5f                   	pop    %edi
+  8025ec:	5d                   	pop    %ebp
+  8025ed:	c3                   	ret
+
+008025ee <devpipe_write>:
+{
+  8025ee:	55                   	push   %ebp
+  8025ef:	89 e5                	mov    %esp,%ebp
+  8025f1:	57                   	push   %edi
+  8025f2:	56                   	push   %esi
+  8025f3:	53                   	push   %ebx
+  8025f4:	83 ec 28             	sub    $0x28,%esp
+  8025f7:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025fa:	56                   	push   %esi
+  8025fb:	e8 e6 f1 ff ff       	call   8017e6 <fd2data>
+  802600:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802602:	83 c4 10             	add    $0x10,%esp
+  802605:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80260d:	75 09                	jne    802618 <devpipe_write+0x2a>
+	return i;
+  80260f:	89 f8                	mov    %edi,%eax
+  802611:	eb 23                	jmp    802636 <devpipe_write+0x48>
+			sys_yield();
+  802613:	e8 02 e7 ff ff       	call   800d1a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802618:	8b 43 04             	mov    0x4(%ebx),%eax
+  80261b:	8b 0b                	mov    (%ebx),%ecx
+  80261d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802620:	39 d0                	cmp    %edx,%eax
+  802622:	72 1a                	jb     80263e <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802624:	89 da                	mov    %ebx,%edx
+  802626:	89 f0                	mov    %esi,%eax
+  802628:	e8 f4 fe ff ff       	call   802521 <_pipeisclosed>
+  80262d:	85 c0                	test   %eax,%eax
+  80262f:	74 e2                	je     802613 <devpipe_write+0x25>
+				return 0;
+  802631:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802636:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802639:	5b                   	pop    %ebx
+  80263a:	5e                   	pop    %esi
+  80263b:	5f                   	pop    %edi
+  80263c:	5d                   	pop    %ebp
+  80263d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80263e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802641:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802645:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802648:	89 c2                	mov    %eax,%edx
+  80264a:	c1 fa 1f             	sar    $0x1f,%edx
+  80264d:	89 d1                	mov    %edx,%ecx
+  80264f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802652:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802655:	83 e2 1f             	and    $0x1f,%edx
+  802658:	29 ca                	sub    %ecx,%edx
+  80265a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80265e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802662:	83 c0 01             	add    $0x1,%eax
+  802665:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802668:	83 c7 01             	add    $0x1,%edi
+  80266b:	eb 9d                	jmp    80260a <devpipe_write+0x1c>
+
+0080266d <devpipe_read>:
+{
+  80266d:	55                   	push   %ebp
+  80266e:	89 e5                	mov    %esp,%ebp
+  802670:	57                   	push   %edi
+  802671:	56                   	push   %esi
+  802672:	53                   	push   %ebx
+  802673:	83 ec 18             	sub    $0x18,%esp
+  802676:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802679:	57                   	push   %edi
+  80267a:	e8 67 f1 ff ff       	call   8017e6 <fd2data>
+  80267f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802681:	83 c4 10             	add    $0x10,%esp
+  802684:	be 00 00 00 00       	mov    $0x0,%esi
+  802689:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80268c:	75 13                	jne    8026a1 <devpipe_read+0x34>
+	return i;
+  80268e:	89 f0                	mov    %esi,%eax
+  802690:	eb 02                	jmp    802694 <devpipe_read+0x27>
+				return i;
+  802692:	89 f0                	mov    %esi,%eax
+}
+  802694:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802697:	5b                   	pop    %ebx
+  802698:	5e                   	pop    %esi
+  802699:	5f                   	pop    %edi
+  80269a:	5d                   	pop    %ebp
+  80269b:	c3                   	ret
+			sys_yield();
+  80269c:	e8 79 e6 ff ff       	call   800d1a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8026a1:	8b 03                	mov    (%ebx),%eax
+  8026a3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8026a6:	75 18                	jne    8026c0 <devpipe_read+0x53>
+			if (i > 0)
+  8026a8:	85 f6                	test   %esi,%esi
+  8026aa:	75 e6                	jne    802692 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8026ac:	89 da                	mov    %ebx,%edx
+  8026ae:	89 f8                	mov    %edi,%eax
+  8026b0:	e8 6c fe ff ff       	call   802521 <_pipeisclosed>
+  8026b5:	85 c0                	test   %eax,%eax
+  8026b7:	74 e3                	je     80269c <devpipe_read+0x2f>
+				return 0;
+  8026b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026be:	eb d4                	jmp    802694 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026c0:	99                   	cltd
+  8026c1:	c1 ea 1b             	shr    $0x1b,%edx
+  8026c4:	01 d0                	add    %edx,%eax
+  8026c6:	83 e0 1f             	and    $0x1f,%eax
+  8026c9:	29 d0                	sub    %edx,%eax
+  8026cb:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8026d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026d3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8026d6:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8026d9:	83 c6 01             	add    $0x1,%esi
+  8026dc:	eb ab                	jmp    802689 <devpipe_read+0x1c>
+
+008026de <pipe>:
+{
+  8026de:	55                   	push   %ebp
+  8026df:	89 e5                	mov    %esp,%ebp
+  8026e1:	56                   	push   %esi
+  8026e2:	53                   	push   %ebx
+  8026e3:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8026e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026e9:	50                   	push   %eax
+  8026ea:	e8 0e f1 ff ff       	call   8017fd <fd_alloc>
+  8026ef:	89 c3                	mov    %eax,%ebx
+  8026f1:	83 c4 10             	add    $0x10,%esp
+  8026f4:	85 c0                	test   %eax,%eax
+  8026f6:	0f 88 23 01 00 00    	js     80281f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026fc:	83 ec 04             	sub    $0x4,%esp
+  8026ff:	68 07 04 00 00       	push   $0x407
+  802704:	ff 75 f4             	push   -0xc(%ebp)
+  802707:	6a 00                	push   $0x0
+  802709:	e8 52 e6 ff ff       	call   800d60 <sys_page_alloc>
+  80270e:	89 c3                	mov    %eax,%ebx
+  802710:	83 c4 10             	add    $0x10,%esp
+  802713:	85 c0                	test   %eax,%eax
+  802715:	0f 88 04 01 00 00    	js     80281f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80271b:	83 ec 0c             	sub    $0xc,%esp
+  80271e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802721:	50                   	push   %eax
+  802722:	e8 d6 f0 ff ff       	call   8017fd <fd_alloc>
+  802727:	89 c3                	mov    %eax,%ebx
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	85 c0                	test   %eax,%eax
+  80272e:	0f 88 db 00 00 00    	js     80280f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802734:	83 ec 04             	sub    $0x4,%esp
+  802737:	68 07 04 00 00       	push   $0x407
+  80273c:	ff 75 f0             	push   -0x10(%ebp)
+  80273f:	6a 00                	push   $0x0
+  802741:	e8 1a e6 ff ff       	call   800d60 <sys_page_alloc>
+  802746:	89 c3                	mov    %eax,%ebx
+  802748:	83 c4 10             	add    $0x10,%esp
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	0f 88 bc 00 00 00    	js     80280f <pipe+0x131>
+	va = fd2data(fd0);
+  802753:	83 ec 0c             	sub    $0xc,%esp
+  802756:	ff 75 f4             	push   -0xc(%ebp)
+  802759:	e8 88 f0 ff ff       	call   8017e6 <fd2data>
+  80275e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802760:	83 c4 0c             	add    $0xc,%esp
+  802763:	68 07 04 00 00       	push   $0x407
+  802768:	50                   	push   %eax
+  802769:	6a 00                	push   $0x0
+  80276b:	e8 f0 e5 ff ff       	call   800d60 <sys_page_alloc>
+  802770:	89 c3                	mov    %eax,%ebx
+  802772:	83 c4 10             	add    $0x10,%esp
+  802775:	85 c0                	test   %eax,%eax
+  802777:	0f 88 82 00 00 00    	js     8027ff <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80277d:	83 ec 0c             	sub    $0xc,%esp
+  802780:	ff 75 f0             	push   -0x10(%ebp)
+  802783:	e8 5e f0 ff ff       	call   8017e6 <fd2data>
+  802788:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80278f:	50                   	push   %eax
+  802790:	6a 00                	push   $0x0
+  802792:	56                   	push   %esi
+  802793:	6a 00                	push   $0x0
+  802795:	e8 33 e6 ff ff       	call   800dcd <sys_page_map>
+  80279a:	89 c3                	mov    %eax,%ebx
+  80279c:	83 c4 20             	add    $0x20,%esp
+  80279f:	85 c0                	test   %eax,%eax
+  8027a1:	78 4e                	js     8027f1 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8027a3:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8027a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027ab:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8027ad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027b0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8027b7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8027ba:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8027bc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8027bf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8027c6:	83 ec 0c             	sub    $0xc,%esp
+  8027c9:	ff 75 f4             	push   -0xc(%ebp)
+  8027cc:	e8 05 f0 ff ff       	call   8017d6 <fd2num>
+  8027d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027d4:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8027d6:	83 c4 04             	add    $0x4,%esp
+  8027d9:	ff 75 f0             	push   -0x10(%ebp)
+  8027dc:	e8 f5 ef ff ff       	call   8017d6 <fd2num>
+  8027e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027e4:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8027e7:	83 c4 10             	add    $0x10,%esp
+  8027ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027ef:	eb 2e                	jmp    80281f <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027f1:	83 ec 08             	sub    $0x8,%esp
+  8027f4:	56                   	push   %esi
+  8027f5:	6a 00                	push   $0x0
+  8027f7:	e8 3f e6 ff ff       	call   800e3b <sys_page_unmap>
+  8027fc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027ff:	83 ec 08             	sub    $0x8,%esp
+  802802:	ff 75 f0             	push   -0x10(%ebp)
+  802805:	6a 00                	push   $0x0
+  802807:	e8 2f e6 ff ff       	call   800e3b <sys_page_unmap>
+  80280c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80280f:	83 ec 08             	sub    $0x8,%esp
+  802812:	ff 75 f4             	push   -0xc(%ebp)
+  802815:	6a 00                	push   $0x0
+  802817:	e8 1f e6 ff ff       	call   800e3b <sys_page_unmap>
+  80281c:	83 c4 10             	add    $0x10,%esp
+}
+  80281f:	89 d8                	mov    %ebx,%eax
+  802821:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802824:	5b                   	pop    %ebx
+  802825:	5e                   	pop    %esi
+  802826:	5d                   	pop    %ebp
+  802827:	c3                   	ret
+
+00802828 <pipeisclosed>:
+{
+  802828:	55                   	push   %ebp
+  802829:	89 e5                	mov    %esp,%ebp
+  80282b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80282e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802831:	50                   	push   %eax
+  802832:	ff 75 08             	push   0x8(%ebp)
+  802835:	e8 19 f0 ff ff       	call   801853 <fd_lookup>
+  80283a:	83 c4 10             	add    $0x10,%esp
+  80283d:	85 c0                	test   %eax,%eax
+  80283f:	78 18                	js     802859 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802841:	83 ec 0c             	sub    $0xc,%esp
+  802844:	ff 75 f4             	push   -0xc(%ebp)
+  802847:	e8 9a ef ff ff       	call   8017e6 <fd2data>
+  80284c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80284e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802851:	e8 cb fc ff ff       	call   802521 <_pipeisclosed>
+  802856:	83 c4 10             	add    $0x10,%esp
+}
+  802859:	c9                   	leave
+  80285a:	c3                   	ret
+
+0080285b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80285b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802860:	c3                   	ret
+
+00802861 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802861:	55                   	push   %ebp
+  802862:	89 e5                	mov    %esp,%ebp
+  802864:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802867:	68 93 30 80 00       	push   $0x803093
+  80286c:	ff 75 0c             	push   0xc(%ebp)
+  80286f:	e8 f4 df ff ff       	call   800868 <strcpy>
+	return 0;
+}
+  802874:	b8 00 00 00 00       	mov    $0x0,%eax
+  802879:	c9                   	leave
+  80287a:	c3                   	ret
+
+0080287b <devcons_write>:
+{
+  80287b:	55                   	push   %ebp
+  80287c:	89 e5                	mov    %esp,%ebp
+  80287e:	57                   	push   %edi
+  80287f:	56                   	push   %esi
+  802880:	53                   	push   %ebx
+  802881:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802887:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80288c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802892:	eb 2e                	jmp    8028c2 <devcons_write+0x47>
+		m = n - tot;
+  802894:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802897:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802899:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80289e:	39 c3                	cmp    %eax,%ebx
+  8028a0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8028a3:	83 ec 04             	sub    $0x4,%esp
+  8028a6:	53                   	push   %ebx
+  8028a7:	89 f0                	mov    %esi,%eax
+  8028a9:	03 45 0c             	add    0xc(%ebp),%eax
+  8028ac:	50                   	push   %eax
+  8028ad:	57                   	push   %edi
+  8028ae:	e8 3b e1 ff ff       	call   8009ee <memmove>
+		sys_cputs(buf, m);
+  8028b3:	83 c4 08             	add    $0x8,%esp
+  8028b6:	53                   	push   %ebx
+  8028b7:	57                   	push   %edi
+  8028b8:	e8 24 e3 ff ff       	call   800be1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028bd:	01 de                	add    %ebx,%esi
+  8028bf:	83 c4 10             	add    $0x10,%esp
+  8028c2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8028c5:	72 cd                	jb     802894 <devcons_write+0x19>
+}
+  8028c7:	89 f0                	mov    %esi,%eax
+  8028c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028cc:	5b                   	pop    %ebx
+  8028cd:	5e                   	pop    %esi
+  8028ce:	5f                   	pop    %edi
+  8028cf:	5d                   	pop    %ebp
+  8028d0:	c3                   	ret
+
+008028d1 <devcons_read>:
+{
+  8028d1:	55                   	push   %ebp
+  8028d2:	89 e5                	mov    %esp,%ebp
+  8028d4:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8028d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028dc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028e0:	75 07                	jne    8028e9 <devcons_read+0x18>
+  8028e2:	eb 1f                	jmp    802903 <devcons_read+0x32>
+		sys_yield();
+  8028e4:	e8 31 e4 ff ff       	call   800d1a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8028e9:	e8 37 e3 ff ff       	call   800c25 <sys_cgetc>
+  8028ee:	85 c0                	test   %eax,%eax
+  8028f0:	74 f2                	je     8028e4 <devcons_read+0x13>
+	if (c < 0)
+  8028f2:	78 0f                	js     802903 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028f4:	83 f8 04             	cmp    $0x4,%eax
+  8028f7:	74 0c                	je     802905 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028fc:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028fe:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802903:	c9                   	leave
+  802904:	c3                   	ret
+		return 0;
+  802905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290a:	eb f7                	jmp    802903 <devcons_read+0x32>
+
+0080290c <cputchar>:
+{
+  80290c:	55                   	push   %ebp
+  80290d:	89 e5                	mov    %esp,%ebp
+  80290f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802912:	8b 45 08             	mov    0x8(%ebp),%eax
+  802915:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802918:	6a 01                	push   $0x1
+  80291a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80291d:	50                   	push   %eax
+  80291e:	e8 be e2 ff ff       	call   800be1 <sys_cputs>
+}
+  802923:	83 c4 10             	add    $0x10,%esp
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+
+00802928 <getchar>:
+{
+  802928:	55                   	push   %ebp
+  802929:	89 e5                	mov    %esp,%ebp
+  80292b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80292e:	6a 01                	push   $0x1
+  802930:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802933:	50                   	push   %eax
+  802934:	6a 00                	push   $0x0
+  802936:	e8 9e f1 ff ff       	call   801ad9 <read>
+	if (r < 0)
+  80293b:	83 c4 10             	add    $0x10,%esp
+  80293e:	85 c0                	test   %eax,%eax
+  802940:	78 06                	js     802948 <getchar+0x20>
+	if (r < 1)
+  802942:	74 06                	je     80294a <getchar+0x22>
+	return c;
+  802944:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802948:	c9                   	leave
+  802949:	c3                   	ret
+		return -E_EOF;
+  80294a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80294f:	eb f7                	jmp    802948 <getchar+0x20>
+
+00802951 <iscons>:
+{
+  802951:	55                   	push   %ebp
+  802952:	89 e5                	mov    %esp,%ebp
+  802954:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802957:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80295a:	50                   	push   %eax
+  80295b:	ff 75 08             	push   0x8(%ebp)
+  80295e:	e8 f0 ee ff ff       	call   801853 <fd_lookup>
+  802963:	83 c4 10             	add    $0x10,%esp
+  802966:	85 c0                	test   %eax,%eax
+  802968:	78 11                	js     80297b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80296a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80296d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802973:	39 10                	cmp    %edx,(%eax)
+  802975:	0f 94 c0             	sete   %al
+  802978:	0f b6 c0             	movzbl %al,%eax
+}
+  80297b:	c9                   	leave
+  80297c:	c3                   	ret
+
+0080297d <opencons>:
+{
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802983:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802986:	50                   	push   %eax
+  802987:	e8 71 ee ff ff       	call   8017fd <fd_alloc>
+  80298c:	83 c4 10             	add    $0x10,%esp
+  80298f:	85 c0                	test   %eax,%eax
+  802991:	78 3a                	js     8029cd <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802993:	83 ec 04             	sub    $0x4,%esp
+  802996:	68 07 04 00 00       	push   $0x407
+  80299b:	ff 75 f4             	push   -0xc(%ebp)
+  80299e:	6a 00                	push   $0x0
+  8029a0:	e8 bb e3 ff ff       	call   800d60 <sys_page_alloc>
+  8029a5:	83 c4 10             	add    $0x10,%esp
+  8029a8:	85 c0                	test   %eax,%eax
+  8029aa:	78 21                	js     8029cd <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029af:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8029b5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ba:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029c1:	83 ec 0c             	sub    $0xc,%esp
+  8029c4:	50                   	push   %eax
+  8029c5:	e8 0c ee ff ff       	call   8017d6 <fd2num>
+  8029ca:	83 c4 10             	add    $0x10,%esp
+}
+  8029cd:	c9                   	leave
+  8029ce:	c3                   	ret
+
+008029cf <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  8029cf:	55                   	push   %ebp
+  8029d0:	89 e5                	mov    %esp,%ebp
+  8029d2:	56                   	push   %esi
+  8029d3:	53                   	push   %ebx
+  8029d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8029d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8029e4:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8029e7:	83 ec 08             	sub    $0x8,%esp
+  8029ea:	ff 75 14             	push   0x14(%ebp)
+  8029ed:	50                   	push   %eax
+  8029ee:	e8 7e e7 ff ff       	call   801171 <sys_ipc_recv_until>
+  8029f3:	83 c4 10             	add    $0x10,%esp
+  8029f6:	85 c0                	test   %eax,%eax
+  8029f8:	78 61                	js     802a5b <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029fa:	85 f6                	test   %esi,%esi
+  8029fc:	74 1c                	je     802a1a <ipc_recv_until+0x4b>
+  8029fe:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a00:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a05:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a0b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a10:	76 5f                	jbe    802a71 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802a12:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802a18:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802a1a:	85 db                	test   %ebx,%ebx
+  802a1c:	74 1c                	je     802a3a <ipc_recv_until+0x6b>
+  802a1e:	89 e0                	mov    %esp,%eax
+  802a20:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a25:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a2b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a30:	76 50                	jbe    802a82 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802a32:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802a38:	89 03                	mov    %eax,(%ebx)
+  802a3a:	89 e0                	mov    %esp,%eax
+  802a3c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a41:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a47:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a4c:	76 45                	jbe    802a93 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a4e:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a57:	5b                   	pop    %ebx
+  802a58:	5e                   	pop    %esi
+  802a59:	5d                   	pop    %ebp
+  802a5a:	c3                   	ret
+		if (from_env_store)
+  802a5b:	85 f6                	test   %esi,%esi
+  802a5d:	74 06                	je     802a65 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a5f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a65:	85 db                	test   %ebx,%ebx
+  802a67:	74 eb                	je     802a54 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a69:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a6f:	eb e3                	jmp    802a54 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a71:	c1 e8 10             	shr    $0x10,%eax
+  802a74:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a7a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a80:	eb 90                	jmp    802a12 <ipc_recv_until+0x43>
+  802a82:	c1 e8 10             	shr    $0x10,%eax
+  802a85:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a8b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a91:	eb 9f                	jmp    802a32 <ipc_recv_until+0x63>
+  802a93:	c1 e8 10             	shr    $0x10,%eax
+  802a96:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a9c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802aa2:	eb aa                	jmp    802a4e <ipc_recv_until+0x7f>
+
+00802aa4 <ipc_recv>:
+{
+  802aa4:	55                   	push   %ebp
+  802aa5:	89 e5                	mov    %esp,%ebp
+  802aa7:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802aaa:	6a 00                	push   $0x0
+  802aac:	ff 75 10             	push   0x10(%ebp)
+  802aaf:	ff 75 0c             	push   0xc(%ebp)
+  802ab2:	ff 75 08             	push   0x8(%ebp)
+  802ab5:	e8 15 ff ff ff       	call   8029cf <ipc_recv_until>
+}
+  802aba:	c9                   	leave
+  802abb:	c3                   	ret
+
+00802abc <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802abc:	55                   	push   %ebp
+  802abd:	89 e5                	mov    %esp,%ebp
+  802abf:	57                   	push   %edi
+  802ac0:	56                   	push   %esi
+  802ac1:	53                   	push   %ebx
+  802ac2:	83 ec 0c             	sub    $0xc,%esp
+  802ac5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ac8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802acb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802ace:	85 db                	test   %ebx,%ebx
+  802ad0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ad5:	0f 44 d8             	cmove  %eax,%ebx
+  802ad8:	eb 05                	jmp    802adf <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802ada:	e8 3b e2 ff ff       	call   800d1a <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802adf:	ff 75 14             	push   0x14(%ebp)
+  802ae2:	53                   	push   %ebx
+  802ae3:	56                   	push   %esi
+  802ae4:	57                   	push   %edi
+  802ae5:	e8 d3 e5 ff ff       	call   8010bd <sys_ipc_try_send>
+  802aea:	83 c4 10             	add    $0x10,%esp
+  802aed:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802af0:	74 e8                	je     802ada <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802af2:	85 c0                	test   %eax,%eax
+  802af4:	78 08                	js     802afe <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802af6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af9:	5b                   	pop    %ebx
+  802afa:	5e                   	pop    %esi
+  802afb:	5f                   	pop    %edi
+  802afc:	5d                   	pop    %ebp
+  802afd:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802afe:	50                   	push   %eax
+  802aff:	68 9f 30 80 00       	push   $0x80309f
+  802b04:	6a 4f                	push   $0x4f
+  802b06:	68 b2 30 80 00       	push   $0x8030b2
+  802b0b:	e8 35 d6 ff ff       	call   800145 <_panic>
+
+00802b10 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b10:	55                   	push   %ebp
+  802b11:	89 e5                	mov    %esp,%ebp
+  802b13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802b16:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802b1b:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802b21:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b27:	8b 52 50             	mov    0x50(%edx),%edx
+  802b2a:	39 ca                	cmp    %ecx,%edx
+  802b2c:	74 11                	je     802b3f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802b2e:	83 c0 01             	add    $0x1,%eax
+  802b31:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802b36:	75 e3                	jne    802b1b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3d:	eb 0e                	jmp    802b4d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802b3f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b45:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b4a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b4d:	5d                   	pop    %ebp
+  802b4e:	c3                   	ret
+
+00802b4f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b4f:	55                   	push   %ebp
+  802b50:	89 e5                	mov    %esp,%ebp
+  802b52:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b55:	89 c2                	mov    %eax,%edx
+  802b57:	c1 ea 16             	shr    $0x16,%edx
+  802b5a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b61:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b66:	f6 c1 01             	test   $0x1,%cl
+  802b69:	74 1a                	je     802b85 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b6b:	c1 e8 0c             	shr    $0xc,%eax
+  802b6e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b75:	a8 01                	test   $0x1,%al
+  802b77:	74 0c                	je     802b85 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b79:	c1 e8 0c             	shr    $0xc,%eax
+  802b7c:	c1 e0 04             	shl    $0x4,%eax
+  802b7f:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b85:	89 d0                	mov    %edx,%eax
+  802b87:	5d                   	pop    %ebp
+  802b88:	c3                   	ret
@@ -0,0 +1,7355 @@
+
+obj/user/httpd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 90 07 00 00       	call   8007c1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+	{404, "Not Found"},
+};
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 60 35 80 00       	push   $0x803560
+  80003f:	e8 1c 09 00 00       	call   800960 <cprintf>
+	exit();
+  800044:	e8 22 08 00 00       	call   80086b <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <send_error>:
+	return 0;
+}
+
+static int
+send_error(struct http_request *req, int code)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	81 ec 0c 02 00 00    	sub    $0x20c,%esp
+  80005a:	89 c3                	mov    %eax,%ebx
+	char buf[512];
+	int r;
+
+	struct error_messages *e = errors;
+  80005c:	b8 00 40 80 00       	mov    $0x804000,%eax
+	while (e->code != 0 && e->msg != 0) {
+  800061:	8b 08                	mov    (%eax),%ecx
+  800063:	85 c9                	test   %ecx,%ecx
+  800065:	74 0f                	je     800076 <send_error+0x28>
+		if (e->code == code)
+  800067:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  80006b:	74 10                	je     80007d <send_error+0x2f>
+  80006d:	39 d1                	cmp    %edx,%ecx
+  80006f:	74 0c                	je     80007d <send_error+0x2f>
+			break;
+		e++;
+  800071:	83 c0 08             	add    $0x8,%eax
+  800074:	eb eb                	jmp    800061 <send_error+0x13>
+	}
+
+	if (e->code == 0)
+		return -1;
+  800076:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80007b:	eb 3b                	jmp    8000b8 <send_error+0x6a>
+
+	r = snprintf(buf, 512, "HTTP/" HTTP_VERSION" %d %s\r\n"
+  80007d:	8b 40 04             	mov    0x4(%eax),%eax
+  800080:	83 ec 04             	sub    $0x4,%esp
+  800083:	50                   	push   %eax
+  800084:	51                   	push   %ecx
+  800085:	50                   	push   %eax
+  800086:	51                   	push   %ecx
+  800087:	68 20 36 80 00       	push   $0x803620
+  80008c:	68 00 02 00 00       	push   $0x200
+  800091:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+  800097:	57                   	push   %edi
+  800098:	e8 b6 0e 00 00       	call   800f53 <snprintf>
+  80009d:	89 c6                	mov    %eax,%esi
+			       "Content-type: text/html\r\n"
+			       "\r\n"
+			       "<html><body><p>%d - %s</p></body></html>\r\n",
+			       e->code, e->msg, e->code, e->msg);
+
+	if (write(req->sock, buf, r) != r)
+  80009f:	83 c4 1c             	add    $0x1c,%esp
+  8000a2:	50                   	push   %eax
+  8000a3:	57                   	push   %edi
+  8000a4:	ff 33                	push   (%ebx)
+  8000a6:	e8 5c 22 00 00       	call   802307 <write>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	39 f0                	cmp    %esi,%eax
+  8000b0:	0f 95 c0             	setne  %al
+  8000b3:	0f b6 c0             	movzbl %al,%eax
+  8000b6:	f7 d8                	neg    %eax
+		return -1;
+
+	return 0;
+}
+  8000b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000bb:	5b                   	pop    %ebx
+  8000bc:	5e                   	pop    %esi
+  8000bd:	5f                   	pop    %edi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+
+008000c0 <handle_client>:
+    return r;
+}
+
+static void
+handle_client(int sock)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	81 ec 40 03 00 00    	sub    $0x340,%esp
+  8000cc:	89 c6                	mov    %eax,%esi
+	struct http_request *req = &con_d;
+
+	while (1)
+	{
+		// Receive message
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  8000ce:	68 00 02 00 00       	push   $0x200
+  8000d3:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  8000d9:	50                   	push   %eax
+  8000da:	56                   	push   %esi
+  8000db:	e8 39 21 00 00       	call   802219 <read>
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	85 c0                	test   %eax,%eax
+  8000e5:	78 3c                	js     800123 <handle_client+0x63>
+			panic("failed to read");
+
+		memset(req, 0, sizeof(req));
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	6a 04                	push   $0x4
+  8000ec:	6a 00                	push   $0x0
+  8000ee:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8000f1:	50                   	push   %eax
+  8000f2:	e8 02 10 00 00       	call   8010f9 <memset>
+
+		req->sock = sock;
+  8000f7:	89 75 dc             	mov    %esi,-0x24(%ebp)
+	if (strncmp(request, "GET ", 4) != 0)
+  8000fa:	83 c4 0c             	add    $0xc,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	68 80 35 80 00       	push   $0x803580
+  800104:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  80010a:	50                   	push   %eax
+  80010b:	e8 6f 0f 00 00       	call   80107f <strncmp>
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	85 c0                	test   %eax,%eax
+  800115:	0f 85 c0 01 00 00    	jne    8002db <handle_client+0x21b>
+	request += 4;
+  80011b:	8d 9d e0 fd ff ff    	lea    -0x220(%ebp),%ebx
+  800121:	eb 1a                	jmp    80013d <handle_client+0x7d>
+			panic("failed to read");
+  800123:	83 ec 04             	sub    $0x4,%esp
+  800126:	68 64 35 80 00       	push   $0x803564
+  80012b:	68 19 01 00 00       	push   $0x119
+  800130:	68 73 35 80 00       	push   $0x803573
+  800135:	e8 4b 07 00 00       	call   800885 <_panic>
+		request++;
+  80013a:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != ' ')
+  80013d:	f6 03 df             	testb  $0xdf,(%ebx)
+  800140:	75 f8                	jne    80013a <handle_client+0x7a>
+	url_len = request - url;
+  800142:	89 df                	mov    %ebx,%edi
+  800144:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+  80014a:	29 c7                	sub    %eax,%edi
+	req->url = malloc(url_len + 1);
+  80014c:	83 ec 0c             	sub    $0xc,%esp
+  80014f:	8d 47 01             	lea    0x1(%edi),%eax
+  800152:	50                   	push   %eax
+  800153:	e8 3d 2b 00 00       	call   802c95 <malloc>
+  800158:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	memmove(req->url, url, url_len);
+  80015b:	83 c4 0c             	add    $0xc,%esp
+  80015e:	57                   	push   %edi
+  80015f:	8d 8d e0 fd ff ff    	lea    -0x220(%ebp),%ecx
+  800165:	51                   	push   %ecx
+  800166:	50                   	push   %eax
+  800167:	e8 c2 0f 00 00       	call   80112e <memmove>
+	req->url[url_len] = '\0';
+  80016c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80016f:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	request++;
+  800173:	83 c3 01             	add    $0x1,%ebx
+	while (*request && *request != '\n')
+  800176:	83 c4 10             	add    $0x10,%esp
+	request++;
+  800179:	89 d8                	mov    %ebx,%eax
+	while (*request && *request != '\n')
+  80017b:	eb 03                	jmp    800180 <handle_client+0xc0>
+		request++;
+  80017d:	83 c0 01             	add    $0x1,%eax
+	while (*request && *request != '\n')
+  800180:	0f b6 10             	movzbl (%eax),%edx
+  800183:	84 d2                	test   %dl,%dl
+  800185:	74 05                	je     80018c <handle_client+0xcc>
+  800187:	80 fa 0a             	cmp    $0xa,%dl
+  80018a:	75 f1                	jne    80017d <handle_client+0xbd>
+	version_len = request - version;
+  80018c:	29 d8                	sub    %ebx,%eax
+  80018e:	89 c7                	mov    %eax,%edi
+	req->version = malloc(version_len + 1);
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	8d 40 01             	lea    0x1(%eax),%eax
+  800196:	50                   	push   %eax
+  800197:	e8 f9 2a 00 00       	call   802c95 <malloc>
+  80019c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	memmove(req->version, version, version_len);
+  80019f:	83 c4 0c             	add    $0xc,%esp
+  8001a2:	57                   	push   %edi
+  8001a3:	53                   	push   %ebx
+  8001a4:	50                   	push   %eax
+  8001a5:	e8 84 0f 00 00       	call   80112e <memmove>
+	req->version[version_len] = '\0';
+  8001aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8001ad:	c6 04 38 00          	movb   $0x0,(%eax,%edi,1)
+	if ((fd = open(req->url, O_RDONLY)) < 0)
+  8001b1:	83 c4 08             	add    $0x8,%esp
+  8001b4:	6a 00                	push   $0x0
+  8001b6:	ff 75 e0             	push   -0x20(%ebp)
+  8001b9:	e8 1e 25 00 00       	call   8026dc <open>
+  8001be:	89 c3                	mov    %eax,%ebx
+  8001c0:	83 c4 10             	add    $0x10,%esp
+  8001c3:	85 c0                	test   %eax,%eax
+  8001c5:	78 21                	js     8001e8 <handle_client+0x128>
+    fstat(fd, &statbuff);
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+  8001ca:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  8001d0:	50                   	push   %eax
+  8001d1:	53                   	push   %ebx
+  8001d2:	e8 9a 22 00 00       	call   802471 <fstat>
+    if (statbuff.st_isdir)
+  8001d7:	83 c4 10             	add    $0x10,%esp
+	struct responce_header *h = headers;
+  8001da:	bf 10 40 80 00       	mov    $0x804010,%edi
+    if (statbuff.st_isdir)
+  8001df:	83 bd d4 fd ff ff 00 	cmpl   $0x0,-0x22c(%ebp)
+  8001e6:	74 3f                	je     800227 <handle_client+0x167>
+    send_error(req, 404);
+  8001e8:	ba 94 01 00 00       	mov    $0x194,%edx
+  8001ed:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8001f0:	e8 59 fe ff ff       	call   80004e <send_error>
+    close(fd);
+  8001f5:	83 ec 0c             	sub    $0xc,%esp
+  8001f8:	53                   	push   %ebx
+  8001f9:	e8 df 1e 00 00       	call   8020dd <close>
+    return r;
+  8001fe:	83 c4 10             	add    $0x10,%esp
+	free(req->url);
+  800201:	83 ec 0c             	sub    $0xc,%esp
+  800204:	ff 75 e0             	push   -0x20(%ebp)
+  800207:	e8 dd 29 00 00       	call   802be9 <free>
+	free(req->version);
+  80020c:	83 c4 04             	add    $0x4,%esp
+  80020f:	ff 75 e4             	push   -0x1c(%ebp)
+  800212:	e8 d2 29 00 00       	call   802be9 <free>
+
+		// no keep alive
+		break;
+	}
+
+	close(sock);
+  800217:	89 34 24             	mov    %esi,(%esp)
+  80021a:	e8 be 1e 00 00       	call   8020dd <close>
+}
+  80021f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800222:	5b                   	pop    %ebx
+  800223:	5e                   	pop    %esi
+  800224:	5f                   	pop    %edi
+  800225:	5d                   	pop    %ebp
+  800226:	c3                   	ret
+	while (h->code != 0 && h->header!= 0) {
+  800227:	8b 07                	mov    (%edi),%eax
+  800229:	85 c0                	test   %eax,%eax
+  80022b:	0f 84 96 01 00 00    	je     8003c7 <handle_client+0x307>
+		if (h->code == code)
+  800231:	83 7f 04 00          	cmpl   $0x0,0x4(%edi)
+  800235:	0f 84 b2 00 00 00    	je     8002ed <handle_client+0x22d>
+  80023b:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  800240:	0f 84 a7 00 00 00    	je     8002ed <handle_client+0x22d>
+		h++;
+  800246:	83 c7 08             	add    $0x8,%edi
+  800249:	eb dc                	jmp    800227 <handle_client+0x167>
+		die("Failed to send bytes to client");
+  80024b:	b8 9c 36 80 00       	mov    $0x80369c,%eax
+  800250:	e8 de fd ff ff       	call   800033 <die>
+  800255:	e9 c2 00 00 00       	jmp    80031c <handle_client+0x25c>
+		panic("buffer too small!");
+  80025a:	83 ec 04             	sub    $0x4,%esp
+  80025d:	68 85 35 80 00       	push   $0x803585
+  800262:	6a 65                	push   $0x65
+  800264:	68 73 35 80 00       	push   $0x803573
+  800269:	e8 17 06 00 00       	call   800885 <_panic>
+		panic("buffer too small!");
+  80026e:	83 ec 04             	sub    $0x4,%esp
+  800271:	68 85 35 80 00       	push   $0x803585
+  800276:	68 81 00 00 00       	push   $0x81
+  80027b:	68 73 35 80 00       	push   $0x803573
+  800280:	e8 00 06 00 00       	call   800885 <_panic>
+            die("Faialed to read from resource");
+  800285:	b8 b4 35 80 00       	mov    $0x8035b4,%eax
+  80028a:	e8 a4 fd ff ff       	call   800033 <die>
+        if (write(req->sock, buffer, r) != r)
+  80028f:	83 ec 04             	sub    $0x4,%esp
+  800292:	57                   	push   %edi
+  800293:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  800299:	50                   	push   %eax
+  80029a:	ff 75 dc             	push   -0x24(%ebp)
+  80029d:	e8 65 20 00 00       	call   802307 <write>
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	39 c7                	cmp    %eax,%edi
+  8002a7:	75 26                	jne    8002cf <handle_client+0x20f>
+    while ((r = read(fd, buffer, sizeof(buffer))) != 0) {
+  8002a9:	83 ec 04             	sub    $0x4,%esp
+  8002ac:	68 80 00 00 00       	push   $0x80
+  8002b1:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  8002b7:	50                   	push   %eax
+  8002b8:	53                   	push   %ebx
+  8002b9:	e8 5b 1f 00 00       	call   802219 <read>
+  8002be:	89 c7                	mov    %eax,%edi
+  8002c0:	83 c4 10             	add    $0x10,%esp
+  8002c3:	85 c0                	test   %eax,%eax
+  8002c5:	0f 84 fc 00 00 00    	je     8003c7 <handle_client+0x307>
+        if (r < 0)
+  8002cb:	79 c2                	jns    80028f <handle_client+0x1cf>
+  8002cd:	eb b6                	jmp    800285 <handle_client+0x1c5>
+            die("Failed to send bytes to client");
+  8002cf:	b8 9c 36 80 00       	mov    $0x80369c,%eax
+  8002d4:	e8 5a fd ff ff       	call   800033 <die>
+  8002d9:	eb ce                	jmp    8002a9 <handle_client+0x1e9>
+			send_error(req, 400);
+  8002db:	ba 90 01 00 00       	mov    $0x190,%edx
+  8002e0:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8002e3:	e8 66 fd ff ff       	call   80004e <send_error>
+  8002e8:	e9 14 ff ff ff       	jmp    800201 <handle_client+0x141>
+	int len = strlen(h->header);
+  8002ed:	83 ec 0c             	sub    $0xc,%esp
+  8002f0:	ff 77 04             	push   0x4(%edi)
+  8002f3:	e8 75 0c 00 00       	call   800f6d <strlen>
+	if (write(req->sock, h->header, len) != len) {
+  8002f8:	83 c4 0c             	add    $0xc,%esp
+  8002fb:	89 85 c4 fc ff ff    	mov    %eax,-0x33c(%ebp)
+  800301:	50                   	push   %eax
+  800302:	ff 77 04             	push   0x4(%edi)
+  800305:	ff 75 dc             	push   -0x24(%ebp)
+  800308:	e8 fa 1f 00 00       	call   802307 <write>
+  80030d:	83 c4 10             	add    $0x10,%esp
+  800310:	39 85 c4 fc ff ff    	cmp    %eax,-0x33c(%ebp)
+  800316:	0f 85 2f ff ff ff    	jne    80024b <handle_client+0x18b>
+	r = snprintf(buf, 64, "Content-Length: %ld\r\n", (long)size);
+  80031c:	6a ff                	push   $0xffffffff
+  80031e:	68 d2 35 80 00       	push   $0x8035d2
+  800323:	6a 40                	push   $0x40
+  800325:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  80032b:	50                   	push   %eax
+  80032c:	e8 22 0c 00 00       	call   800f53 <snprintf>
+  800331:	89 c7                	mov    %eax,%edi
+	if (r > 63)
+  800333:	83 c4 10             	add    $0x10,%esp
+  800336:	83 f8 3f             	cmp    $0x3f,%eax
+  800339:	0f 8f 1b ff ff ff    	jg     80025a <handle_client+0x19a>
+	if (write(req->sock, buf, r) != r)
+  80033f:	83 ec 04             	sub    $0x4,%esp
+  800342:	57                   	push   %edi
+  800343:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  800349:	50                   	push   %eax
+  80034a:	ff 75 dc             	push   -0x24(%ebp)
+  80034d:	e8 b5 1f 00 00       	call   802307 <write>
+	if ((r = send_size(req, file_size)) < 0)
+  800352:	83 c4 10             	add    $0x10,%esp
+  800355:	39 c7                	cmp    %eax,%edi
+  800357:	75 6e                	jne    8003c7 <handle_client+0x307>
+	r = snprintf(buf, 128, "Content-Type: %s\r\n", type);
+  800359:	68 97 35 80 00       	push   $0x803597
+  80035e:	68 a1 35 80 00       	push   $0x8035a1
+  800363:	68 80 00 00 00       	push   $0x80
+  800368:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  80036e:	50                   	push   %eax
+  80036f:	e8 df 0b 00 00       	call   800f53 <snprintf>
+  800374:	89 c7                	mov    %eax,%edi
+	if (r > 127)
+  800376:	83 c4 10             	add    $0x10,%esp
+  800379:	83 f8 7f             	cmp    $0x7f,%eax
+  80037c:	0f 8f ec fe ff ff    	jg     80026e <handle_client+0x1ae>
+	if (write(req->sock, buf, r) != r)
+  800382:	83 ec 04             	sub    $0x4,%esp
+  800385:	50                   	push   %eax
+  800386:	8d 85 d0 fc ff ff    	lea    -0x330(%ebp),%eax
+  80038c:	50                   	push   %eax
+  80038d:	ff 75 dc             	push   -0x24(%ebp)
+  800390:	e8 72 1f 00 00       	call   802307 <write>
+	if ((r = send_content_type(req)) < 0)
+  800395:	83 c4 10             	add    $0x10,%esp
+  800398:	39 c7                	cmp    %eax,%edi
+  80039a:	75 2b                	jne    8003c7 <handle_client+0x307>
+	int fin_len = strlen(fin);
+  80039c:	83 ec 0c             	sub    $0xc,%esp
+  80039f:	68 e5 35 80 00       	push   $0x8035e5
+  8003a4:	e8 c4 0b 00 00       	call   800f6d <strlen>
+  8003a9:	89 c7                	mov    %eax,%edi
+	if (write(req->sock, fin, fin_len) != fin_len)
+  8003ab:	83 c4 0c             	add    $0xc,%esp
+  8003ae:	50                   	push   %eax
+  8003af:	68 e5 35 80 00       	push   $0x8035e5
+  8003b4:	ff 75 dc             	push   -0x24(%ebp)
+  8003b7:	e8 4b 1f 00 00       	call   802307 <write>
+	if ((r = send_header_fin(req)) < 0)
+  8003bc:	83 c4 10             	add    $0x10,%esp
+  8003bf:	39 c7                	cmp    %eax,%edi
+  8003c1:	0f 84 e2 fe ff ff    	je     8002a9 <handle_client+0x1e9>
+	close(fd);
+  8003c7:	83 ec 0c             	sub    $0xc,%esp
+  8003ca:	53                   	push   %ebx
+  8003cb:	e8 0d 1d 00 00       	call   8020dd <close>
+	return r;
+  8003d0:	83 c4 10             	add    $0x10,%esp
+  8003d3:	e9 29 fe ff ff       	jmp    800201 <handle_client+0x141>
+
+008003d8 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8003d8:	55                   	push   %ebp
+  8003d9:	89 e5                	mov    %esp,%ebp
+  8003db:	57                   	push   %edi
+  8003dc:	56                   	push   %esi
+  8003dd:	53                   	push   %ebx
+  8003de:	83 ec 40             	sub    $0x40,%esp
+	int serversock, clientsock;
+	struct sockaddr_in server, client;
+
+	binaryname = "jhttpd";
+  8003e1:	c7 05 20 40 80 00 e8 	movl   $0x8035e8,0x804020
+  8003e8:	35 80 00 
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8003eb:	6a 06                	push   $0x6
+  8003ed:	6a 01                	push   $0x1
+  8003ef:	6a 02                	push   $0x2
+  8003f1:	e8 74 25 00 00       	call   80296a <socket>
+  8003f6:	89 c6                	mov    %eax,%esi
+  8003f8:	83 c4 10             	add    $0x10,%esp
+  8003fb:	85 c0                	test   %eax,%eax
+  8003fd:	78 6d                	js     80046c <umain+0x94>
+		die("Failed to create socket");
+
+	// Construct the server sockaddr_in structure
+	memset(&server, 0, sizeof(server));		// Clear struct
+  8003ff:	83 ec 04             	sub    $0x4,%esp
+  800402:	6a 10                	push   $0x10
+  800404:	6a 00                	push   $0x0
+  800406:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  800409:	53                   	push   %ebx
+  80040a:	e8 ea 0c 00 00       	call   8010f9 <memset>
+	server.sin_family = AF_INET;			// Internet/IP
+  80040f:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	server.sin_addr.s_addr = htonl(INADDR_ANY);	// IP address
+  800413:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80041a:	e8 64 01 00 00       	call   800583 <htonl>
+  80041f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	server.sin_port = htons(PORT);			// server port
+  800422:	c7 04 24 50 00 00 00 	movl   $0x50,(%esp)
+  800429:	e8 3b 01 00 00       	call   800569 <htons>
+  80042e:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &server,
+  800432:	83 c4 0c             	add    $0xc,%esp
+  800435:	6a 10                	push   $0x10
+  800437:	53                   	push   %ebx
+  800438:	56                   	push   %esi
+  800439:	e8 9a 24 00 00       	call   8028d8 <bind>
+  80043e:	83 c4 10             	add    $0x10,%esp
+  800441:	85 c0                	test   %eax,%eax
+  800443:	78 33                	js     800478 <umain+0xa0>
+	{
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800445:	83 ec 08             	sub    $0x8,%esp
+  800448:	6a 05                	push   $0x5
+  80044a:	56                   	push   %esi
+  80044b:	e8 f7 24 00 00       	call   802947 <listen>
+  800450:	83 c4 10             	add    $0x10,%esp
+  800453:	85 c0                	test   %eax,%eax
+  800455:	78 2d                	js     800484 <umain+0xac>
+		die("Failed to listen on server socket");
+
+	cprintf("Waiting for http connections...\n");
+  800457:	83 ec 0c             	sub    $0xc,%esp
+  80045a:	68 04 37 80 00       	push   $0x803704
+  80045f:	e8 fc 04 00 00       	call   800960 <cprintf>
+  800464:	83 c4 10             	add    $0x10,%esp
+
+	while (1) {
+		unsigned int clientlen = sizeof(client);
+		// Wait for client connection
+		if ((clientsock = accept(serversock,
+  800467:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  80046a:	eb 35                	jmp    8004a1 <umain+0xc9>
+		die("Failed to create socket");
+  80046c:	b8 ef 35 80 00       	mov    $0x8035ef,%eax
+  800471:	e8 bd fb ff ff       	call   800033 <die>
+  800476:	eb 87                	jmp    8003ff <umain+0x27>
+		die("Failed to bind the server socket");
+  800478:	b8 bc 36 80 00       	mov    $0x8036bc,%eax
+  80047d:	e8 b1 fb ff ff       	call   800033 <die>
+  800482:	eb c1                	jmp    800445 <umain+0x6d>
+		die("Failed to listen on server socket");
+  800484:	b8 e0 36 80 00       	mov    $0x8036e0,%eax
+  800489:	e8 a5 fb ff ff       	call   800033 <die>
+  80048e:	eb c7                	jmp    800457 <umain+0x7f>
+					 (struct sockaddr *) &client,
+					 &clientlen)) < 0)
+		{
+			die("Failed to accept client connection");
+  800490:	b8 28 37 80 00       	mov    $0x803728,%eax
+  800495:	e8 99 fb ff ff       	call   800033 <die>
+		}
+		handle_client(clientsock);
+  80049a:	89 d8                	mov    %ebx,%eax
+  80049c:	e8 1f fc ff ff       	call   8000c0 <handle_client>
+		unsigned int clientlen = sizeof(client);
+  8004a1:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		if ((clientsock = accept(serversock,
+  8004a8:	83 ec 04             	sub    $0x4,%esp
+  8004ab:	57                   	push   %edi
+  8004ac:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8004af:	50                   	push   %eax
+  8004b0:	56                   	push   %esi
+  8004b1:	e8 f3 23 00 00       	call   8028a9 <accept>
+  8004b6:	89 c3                	mov    %eax,%ebx
+  8004b8:	83 c4 10             	add    $0x10,%esp
+  8004bb:	85 c0                	test   %eax,%eax
+  8004bd:	78 d1                	js     800490 <umain+0xb8>
+  8004bf:	eb d9                	jmp    80049a <umain+0xc2>
+
+008004c1 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8004c1:	55                   	push   %ebp
+  8004c2:	89 e5                	mov    %esp,%ebp
+  8004c4:	57                   	push   %edi
+  8004c5:	56                   	push   %esi
+  8004c6:	53                   	push   %ebx
+  8004c7:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8004ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004cd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8004d0:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  8004d3:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  8004d8:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8004dd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004e0:	eb 31                	jmp    800513 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  8004e2:	0f b6 c8             	movzbl %al,%ecx
+  8004e5:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  8004ea:	88 0a                	mov    %cl,(%edx)
+  8004ec:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  8004ef:	83 e8 01             	sub    $0x1,%eax
+  8004f2:	3c ff                	cmp    $0xff,%al
+  8004f4:	75 ec                	jne    8004e2 <inet_ntoa+0x21>
+  8004f6:	0f b6 db             	movzbl %bl,%ebx
+  8004f9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8004fc:	01 d8                	add    %ebx,%eax
+  8004fe:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  800500:	8d 40 01             	lea    0x1(%eax),%eax
+  800503:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800506:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800509:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80050c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80050f:	39 c7                	cmp    %eax,%edi
+  800511:	74 46                	je     800559 <inet_ntoa+0x98>
+  800513:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800516:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051b:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80051e:	89 f0                	mov    %esi,%eax
+  800520:	f6 e2                	mul    %dl
+  800522:	66 c1 e8 0b          	shr    $0xb,%ax
+  800526:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800529:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80052c:	01 c9                	add    %ecx,%ecx
+  80052e:	89 d0                	mov    %edx,%eax
+  800530:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800532:	89 d7                	mov    %edx,%edi
+  800534:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800538:	89 d9                	mov    %ebx,%ecx
+  80053a:	83 c3 01             	add    $0x1,%ebx
+  80053d:	0f b6 c9             	movzbl %cl,%ecx
+  800540:	83 c0 30             	add    $0x30,%eax
+  800543:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800547:	89 f8                	mov    %edi,%eax
+  800549:	3c 09                	cmp    $0x9,%al
+  80054b:	77 d1                	ja     80051e <inet_ntoa+0x5d>
+  80054d:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  800550:	88 17                	mov    %dl,(%edi)
+  800552:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800555:	89 d8                	mov    %ebx,%eax
+  800557:	eb 96                	jmp    8004ef <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  800559:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  80055c:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800561:	83 c4 1c             	add    $0x1c,%esp
+  800564:	5b                   	pop    %ebx
+  800565:	5e                   	pop    %esi
+  800566:	5f                   	pop    %edi
+  800567:	5d                   	pop    %ebp
+  800568:	c3                   	ret
+
+00800569 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  800569:	55                   	push   %ebp
+  80056a:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80056c:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  800570:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  800574:	5d                   	pop    %ebp
+  800575:	c3                   	ret
+
+00800576 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  800576:	55                   	push   %ebp
+  800577:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  800579:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80057d:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  800581:	5d                   	pop    %ebp
+  800582:	c3                   	ret
+
+00800583 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  800583:	55                   	push   %ebp
+  800584:	89 e5                	mov    %esp,%ebp
+  800586:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  800589:	89 d0                	mov    %edx,%eax
+  80058b:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  80058e:	89 d1                	mov    %edx,%ecx
+  800590:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  800593:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  800595:	89 d1                	mov    %edx,%ecx
+  800597:	c1 e1 08             	shl    $0x8,%ecx
+  80059a:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8005a0:	09 c8                	or     %ecx,%eax
+  8005a2:	c1 ea 08             	shr    $0x8,%edx
+  8005a5:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8005ab:	09 d0                	or     %edx,%eax
+}
+  8005ad:	5d                   	pop    %ebp
+  8005ae:	c3                   	ret
+
+008005af <inet_aton>:
+{
+  8005af:	55                   	push   %ebp
+  8005b0:	89 e5                	mov    %esp,%ebp
+  8005b2:	57                   	push   %edi
+  8005b3:	56                   	push   %esi
+  8005b4:	53                   	push   %ebx
+  8005b5:	83 ec 2c             	sub    $0x2c,%esp
+  8005b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8005bb:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8005be:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8005c1:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8005c4:	e9 9b 00 00 00       	jmp    800664 <inet_aton+0xb5>
+      c = *++cp;
+  8005c9:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8005cd:	89 c1                	mov    %eax,%ecx
+  8005cf:	83 e1 df             	and    $0xffffffdf,%ecx
+  8005d2:	80 f9 58             	cmp    $0x58,%cl
+  8005d5:	74 10                	je     8005e7 <inet_aton+0x38>
+      c = *++cp;
+  8005d7:	83 c2 01             	add    $0x1,%edx
+  8005da:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  8005dd:	bf 08 00 00 00       	mov    $0x8,%edi
+  8005e2:	e9 97 00 00 00       	jmp    80067e <inet_aton+0xcf>
+        c = *++cp;
+  8005e7:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  8005eb:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  8005ee:	bf 10 00 00 00       	mov    $0x10,%edi
+  8005f3:	e9 86 00 00 00       	jmp    80067e <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  8005f8:	0f af d7             	imul   %edi,%edx
+  8005fb:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  8005ff:	0f be 01             	movsbl (%ecx),%eax
+  800602:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800605:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800608:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  80060b:	80 fb 09             	cmp    $0x9,%bl
+  80060e:	76 e8                	jbe    8005f8 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  800610:	83 ff 10             	cmp    $0x10,%edi
+  800613:	75 2e                	jne    800643 <inet_aton+0x94>
+  800615:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800619:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80061c:	83 e3 df             	and    $0xffffffdf,%ebx
+  80061f:	83 eb 41             	sub    $0x41,%ebx
+  800622:	80 fb 05             	cmp    $0x5,%bl
+  800625:	77 1c                	ja     800643 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800627:	c1 e2 04             	shl    $0x4,%edx
+  80062a:	83 c0 0a             	add    $0xa,%eax
+  80062d:	89 f3                	mov    %esi,%ebx
+  80062f:	80 fb 1a             	cmp    $0x1a,%bl
+  800632:	19 db                	sbb    %ebx,%ebx
+  800634:	83 e3 20             	and    $0x20,%ebx
+  800637:	83 c3 41             	add    $0x41,%ebx
+  80063a:	29 d8                	sub    %ebx,%eax
+  80063c:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80063e:	0f be 01             	movsbl (%ecx),%eax
+  800641:	eb bf                	jmp    800602 <inet_aton+0x53>
+    if (c == '.') {
+  800643:	83 f8 2e             	cmp    $0x2e,%eax
+  800646:	75 43                	jne    80068b <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800648:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80064b:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80064e:	39 f0                	cmp    %esi,%eax
+  800650:	0f 84 22 01 00 00    	je     800778 <inet_aton+0x1c9>
+      *pp++ = val;
+  800656:	83 c0 04             	add    $0x4,%eax
+  800659:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80065c:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80065f:	89 ca                	mov    %ecx,%edx
+  800661:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800664:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800667:	80 f9 09             	cmp    $0x9,%cl
+  80066a:	0f 87 01 01 00 00    	ja     800771 <inet_aton+0x1c2>
+    base = 10;
+  800670:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  800675:	83 f8 30             	cmp    $0x30,%eax
+  800678:	0f 84 4b ff ff ff    	je     8005c9 <inet_aton+0x1a>
+  80067e:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  800681:	ba 00 00 00 00       	mov    $0x0,%edx
+  800686:	e9 7a ff ff ff       	jmp    800605 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80068b:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  80068f:	89 d6                	mov    %edx,%esi
+  800691:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800694:	85 c0                	test   %eax,%eax
+  800696:	74 2e                	je     8006c6 <inet_aton+0x117>
+    return (0);
+  800698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80069d:	89 fa                	mov    %edi,%edx
+  80069f:	80 fa 1f             	cmp    $0x1f,%dl
+  8006a2:	0f 86 d5 00 00 00    	jbe    80077d <inet_aton+0x1ce>
+  8006a8:	84 c0                	test   %al,%al
+  8006aa:	0f 88 cd 00 00 00    	js     80077d <inet_aton+0x1ce>
+  8006b0:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8006b3:	83 f9 04             	cmp    $0x4,%ecx
+  8006b6:	76 0e                	jbe    8006c6 <inet_aton+0x117>
+    return (0);
+  8006b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8006bd:	83 f8 20             	cmp    $0x20,%eax
+  8006c0:	0f 85 b7 00 00 00    	jne    80077d <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8006c6:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8006c9:	89 d8                	mov    %ebx,%eax
+  8006cb:	29 c8                	sub    %ecx,%eax
+  8006cd:	c1 f8 02             	sar    $0x2,%eax
+  8006d0:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  8006d3:	83 f8 02             	cmp    $0x2,%eax
+  8006d6:	74 7a                	je     800752 <inet_aton+0x1a3>
+  8006d8:	83 f9 03             	cmp    $0x3,%ecx
+  8006db:	7f 49                	jg     800726 <inet_aton+0x177>
+  8006dd:	85 c9                	test   %ecx,%ecx
+  8006df:	0f 84 98 00 00 00    	je     80077d <inet_aton+0x1ce>
+  8006e5:	83 f9 02             	cmp    $0x2,%ecx
+  8006e8:	75 19                	jne    800703 <inet_aton+0x154>
+      return (0);
+  8006ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  8006ef:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  8006f5:	0f 87 82 00 00 00    	ja     80077d <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  8006fb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8006fe:	c1 e0 18             	shl    $0x18,%eax
+  800701:	09 c6                	or     %eax,%esi
+  return (1);
+  800703:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800708:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80070c:	74 6f                	je     80077d <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  80070e:	83 ec 0c             	sub    $0xc,%esp
+  800711:	56                   	push   %esi
+  800712:	e8 6c fe ff ff       	call   800583 <htonl>
+  800717:	83 c4 10             	add    $0x10,%esp
+  80071a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80071d:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80071f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800724:	eb 57                	jmp    80077d <inet_aton+0x1ce>
+  switch (n) {
+  800726:	83 f9 04             	cmp    $0x4,%ecx
+  800729:	75 d8                	jne    800703 <inet_aton+0x154>
+      return (0);
+  80072b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  800730:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800736:	77 45                	ja     80077d <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800738:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80073b:	c1 e0 18             	shl    $0x18,%eax
+  80073e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800741:	c1 e1 10             	shl    $0x10,%ecx
+  800744:	09 c8                	or     %ecx,%eax
+  800746:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800749:	c1 e1 08             	shl    $0x8,%ecx
+  80074c:	09 c8                	or     %ecx,%eax
+  80074e:	09 c6                	or     %eax,%esi
+    break;
+  800750:	eb b1                	jmp    800703 <inet_aton+0x154>
+      return (0);
+  800752:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800757:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80075d:	77 1e                	ja     80077d <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80075f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800762:	c1 e0 18             	shl    $0x18,%eax
+  800765:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800768:	c1 e1 10             	shl    $0x10,%ecx
+  80076b:	09 c8                	or     %ecx,%eax
+  80076d:	09 c6                	or     %eax,%esi
+    break;
+  80076f:	eb 92                	jmp    800703 <inet_aton+0x154>
+      return (0);
+  800771:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800776:	eb 05                	jmp    80077d <inet_aton+0x1ce>
+        return (0);
+  800778:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  80077d:	89 c8                	mov    %ecx,%eax
+  80077f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800782:	5b                   	pop    %ebx
+  800783:	5e                   	pop    %esi
+  800784:	5f                   	pop    %edi
+  800785:	5d                   	pop    %ebp
+  800786:	c3                   	ret
+
+00800787 <inet_addr>:
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  80078d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800790:	50                   	push   %eax
+  800791:	ff 75 08             	push   0x8(%ebp)
+  800794:	e8 16 fe ff ff       	call   8005af <inet_aton>
+  800799:	89 c2                	mov    %eax,%edx
+  80079b:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  80079e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8007a3:	85 d2                	test   %edx,%edx
+  8007a5:	75 02                	jne    8007a9 <inet_addr+0x22>
+}
+  8007a7:	c9                   	leave
+  8007a8:	c3                   	ret
+    return (val.s_addr);
+  8007a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007ac:	eb f9                	jmp    8007a7 <inet_addr+0x20>
+
+008007ae <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8007ae:	55                   	push   %ebp
+  8007af:	89 e5                	mov    %esp,%ebp
+  8007b1:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8007b4:	ff 75 08             	push   0x8(%ebp)
+  8007b7:	e8 c7 fd ff ff       	call   800583 <htonl>
+  8007bc:	83 c4 10             	add    $0x10,%esp
+}
+  8007bf:	c9                   	leave
+  8007c0:	c3                   	ret
+
+008007c1 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8007c1:	55                   	push   %ebp
+  8007c2:	89 e5                	mov    %esp,%ebp
+  8007c4:	57                   	push   %edi
+  8007c5:	56                   	push   %esi
+  8007c6:	53                   	push   %ebx
+  8007c7:	83 ec 0c             	sub    $0xc,%esp
+  8007ca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8007d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8007d5:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8007d7:	c1 ea 0b             	shr    $0xb,%edx
+  8007da:	83 f2 01             	xor    $0x1,%edx
+  8007dd:	83 e2 01             	and    $0x1,%edx
+  8007e0:	88 15 20 50 80 00    	mov    %dl,0x805020
+
+	mainenv = NULL;
+  8007e6:	c7 05 1c 50 80 00 00 	movl   $0x0,0x80501c
+  8007ed:	00 00 00 
+	envid = sys_getenvid();
+  8007f0:	e8 1f 0c 00 00       	call   801414 <sys_getenvid>
+  8007f5:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8007fc:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800802:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800808:	8b 52 48             	mov    0x48(%edx),%edx
+  80080b:	39 ca                	cmp    %ecx,%edx
+  80080d:	74 27                	je     800836 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80080f:	83 c0 01             	add    $0x1,%eax
+  800812:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800817:	75 e3                	jne    8007fc <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800819:	83 3d 1c 50 80 00 00 	cmpl   $0x0,0x80501c
+  800820:	75 24                	jne    800846 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800822:	83 ec 04             	sub    $0x4,%esp
+  800825:	68 74 37 80 00       	push   $0x803774
+  80082a:	6a 23                	push   $0x23
+  80082c:	68 97 37 80 00       	push   $0x803797
+  800831:	e8 4f 00 00 00       	call   800885 <_panic>
+			mainenv = &envs[i];
+  800836:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80083c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800841:	a3 1c 50 80 00       	mov    %eax,0x80501c
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800846:	85 ff                	test   %edi,%edi
+  800848:	7e 07                	jle    800851 <libmain+0x90>
+		binaryname = argv[0];
+  80084a:	8b 06                	mov    (%esi),%eax
+  80084c:	a3 20 40 80 00       	mov    %eax,0x804020
+
+	// call user main routine
+	umain(argc, argv);
+  800851:	83 ec 08             	sub    $0x8,%esp
+  800854:	56                   	push   %esi
+  800855:	57                   	push   %edi
+  800856:	e8 7d fb ff ff       	call   8003d8 <umain>
+
+	// exit gracefully
+	exit();
+  80085b:	e8 0b 00 00 00       	call   80086b <exit>
+}
+  800860:	83 c4 10             	add    $0x10,%esp
+  800863:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800866:	5b                   	pop    %ebx
+  800867:	5e                   	pop    %esi
+  800868:	5f                   	pop    %edi
+  800869:	5d                   	pop    %ebp
+  80086a:	c3                   	ret
+
+0080086b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80086b:	55                   	push   %ebp
+  80086c:	89 e5                	mov    %esp,%ebp
+  80086e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800871:	e8 94 18 00 00       	call   80210a <close_all>
+	sys_env_destroy(0);
+  800876:	83 ec 0c             	sub    $0xc,%esp
+  800879:	6a 00                	push   $0x0
+  80087b:	e8 2b 0b 00 00       	call   8013ab <sys_env_destroy>
+}
+  800880:	83 c4 10             	add    $0x10,%esp
+  800883:	c9                   	leave
+  800884:	c3                   	ret
+
+00800885 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	56                   	push   %esi
+  800889:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80088a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80088d:	8b 35 20 40 80 00    	mov    0x804020,%esi
+  800893:	e8 7c 0b 00 00       	call   801414 <sys_getenvid>
+  800898:	83 ec 0c             	sub    $0xc,%esp
+  80089b:	ff 75 0c             	push   0xc(%ebp)
+  80089e:	ff 75 08             	push   0x8(%ebp)
+  8008a1:	56                   	push   %esi
+  8008a2:	50                   	push   %eax
+  8008a3:	68 b0 37 80 00       	push   $0x8037b0
+  8008a8:	e8 b3 00 00 00       	call   800960 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8008ad:	83 c4 18             	add    $0x18,%esp
+  8008b0:	53                   	push   %ebx
+  8008b1:	ff 75 10             	push   0x10(%ebp)
+  8008b4:	e8 56 00 00 00       	call   80090f <vcprintf>
+	cprintf("\n");
+  8008b9:	c7 04 24 e6 35 80 00 	movl   $0x8035e6,(%esp)
+  8008c0:	e8 9b 00 00 00       	call   800960 <cprintf>
+  8008c5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8008c8:	cc                   	int3
+	while (1)
+  8008c9:	eb fd                	jmp    8008c8 <_panic+0x43>
+
+008008cb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	53                   	push   %ebx
+  8008cf:	83 ec 04             	sub    $0x4,%esp
+  8008d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8008d5:	8b 13                	mov    (%ebx),%edx
+  8008d7:	8d 42 01             	lea    0x1(%edx),%eax
+  8008da:	89 03                	mov    %eax,(%ebx)
+  8008dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008df:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8008e3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8008e8:	74 09                	je     8008f3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8008ea:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8008ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f1:	c9                   	leave
+  8008f2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8008f3:	83 ec 08             	sub    $0x8,%esp
+  8008f6:	68 ff 00 00 00       	push   $0xff
+  8008fb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8008fe:	50                   	push   %eax
+  8008ff:	e8 1d 0a 00 00       	call   801321 <sys_cputs>
+		b->idx = 0;
+  800904:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80090a:	83 c4 10             	add    $0x10,%esp
+  80090d:	eb db                	jmp    8008ea <putch+0x1f>
+
+0080090f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80090f:	55                   	push   %ebp
+  800910:	89 e5                	mov    %esp,%ebp
+  800912:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800918:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80091f:	00 00 00 
+	b.cnt = 0;
+  800922:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800929:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80092c:	ff 75 0c             	push   0xc(%ebp)
+  80092f:	ff 75 08             	push   0x8(%ebp)
+  800932:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800938:	50                   	push   %eax
+  800939:	68 cb 08 80 00       	push   $0x8008cb
+  80093e:	e8 fb 00 00 00       	call   800a3e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800943:	83 c4 08             	add    $0x8,%esp
+  800946:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80094c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800952:	50                   	push   %eax
+  800953:	e8 c9 09 00 00       	call   801321 <sys_cputs>
+
+	return b.cnt;
+}
+  800958:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80095e:	c9                   	leave
+  80095f:	c3                   	ret
+
+00800960 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800960:	55                   	push   %ebp
+  800961:	89 e5                	mov    %esp,%ebp
+  800963:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800966:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800969:	50                   	push   %eax
+  80096a:	ff 75 08             	push   0x8(%ebp)
+  80096d:	e8 9d ff ff ff       	call   80090f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800972:	c9                   	leave
+  800973:	c3                   	ret
+
+00800974 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	57                   	push   %edi
+  800978:	56                   	push   %esi
+  800979:	53                   	push   %ebx
+  80097a:	83 ec 1c             	sub    $0x1c,%esp
+  80097d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800980:	89 d6                	mov    %edx,%esi
+  800982:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800985:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800988:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80098b:	73 0b                	jae    800998 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80098d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800990:	c1 e7 08             	shl    $0x8,%edi
+  800993:	0b 7d 10             	or     0x10(%ebp),%edi
+  800996:	eb 36                	jmp    8009ce <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800998:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80099b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009a0:	f7 75 08             	divl   0x8(%ebp)
+  8009a3:	89 c1                	mov    %eax,%ecx
+  8009a5:	ff 75 14             	push   0x14(%ebp)
+  8009a8:	ff 75 10             	push   0x10(%ebp)
+  8009ab:	83 eb 01             	sub    $0x1,%ebx
+  8009ae:	53                   	push   %ebx
+  8009af:	ff 75 08             	push   0x8(%ebp)
+  8009b2:	89 f2                	mov    %esi,%edx
+  8009b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009b7:	e8 b8 ff ff ff       	call   800974 <printnum>
+  8009bc:	83 c4 10             	add    $0x10,%esp
+  8009bf:	eb 14                	jmp    8009d5 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8009c1:	83 ec 08             	sub    $0x8,%esp
+  8009c4:	56                   	push   %esi
+  8009c5:	57                   	push   %edi
+  8009c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009c9:	ff d0                	call   *%eax
+  8009cb:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8009ce:	83 eb 01             	sub    $0x1,%ebx
+  8009d1:	85 db                	test   %ebx,%ebx
+  8009d3:	7f ec                	jg     8009c1 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8009d5:	83 ec 08             	sub    $0x8,%esp
+  8009d8:	56                   	push   %esi
+  8009d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e1:	f7 75 08             	divl   0x8(%ebp)
+  8009e4:	0f be 92 d3 37 80 00 	movsbl 0x8037d3(%edx),%edx
+  8009eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ee:	c1 e0 08             	shl    $0x8,%eax
+  8009f1:	09 d0                	or     %edx,%eax
+  8009f3:	50                   	push   %eax
+  8009f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009f7:	ff d0                	call   *%eax
+}
+  8009f9:	83 c4 10             	add    $0x10,%esp
+  8009fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009ff:	5b                   	pop    %ebx
+  800a00:	5e                   	pop    %esi
+  800a01:	5f                   	pop    %edi
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+
+00800a04 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800a0a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800a0e:	8b 10                	mov    (%eax),%edx
+  800a10:	3b 50 04             	cmp    0x4(%eax),%edx
+  800a13:	73 0a                	jae    800a1f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800a15:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800a18:	89 08                	mov    %ecx,(%eax)
+  800a1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1d:	88 02                	mov    %al,(%edx)
+}
+  800a1f:	5d                   	pop    %ebp
+  800a20:	c3                   	ret
+
+00800a21 <printfmt>:
+{
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800a27:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800a2a:	50                   	push   %eax
+  800a2b:	ff 75 10             	push   0x10(%ebp)
+  800a2e:	ff 75 0c             	push   0xc(%ebp)
+  800a31:	ff 75 08             	push   0x8(%ebp)
+  800a34:	e8 05 00 00 00       	call   800a3e <vprintfmt>
+}
+  800a39:	83 c4 10             	add    $0x10,%esp
+  800a3c:	c9                   	leave
+  800a3d:	c3                   	ret
+
+00800a3e <vprintfmt>:
+{
+  800a3e:	55                   	push   %ebp
+  800a3f:	89 e5                	mov    %esp,%ebp
+  800a41:	57                   	push   %edi
+  800a42:	56                   	push   %esi
+  800a43:	53                   	push   %ebx
+  800a44:	83 ec 3c             	sub    $0x3c,%esp
+  800a47:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800a4d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800a54:	eb 16                	jmp    800a6c <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800a56:	83 ec 08             	sub    $0x8,%esp
+  800a59:	ff 75 0c             	push   0xc(%ebp)
+  800a5c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800a5f:	c1 e2 08             	shl    $0x8,%edx
+  800a62:	09 d0                	or     %edx,%eax
+  800a64:	50                   	push   %eax
+  800a65:	ff d7                	call   *%edi
+  800a67:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a6a:	89 de                	mov    %ebx,%esi
+  800a6c:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800a6f:	0f b6 06             	movzbl (%esi),%eax
+  800a72:	83 f8 25             	cmp    $0x25,%eax
+  800a75:	74 0c                	je     800a83 <vprintfmt+0x45>
+			if (ch == '\0')
+  800a77:	85 c0                	test   %eax,%eax
+  800a79:	75 db                	jne    800a56 <vprintfmt+0x18>
+}
+  800a7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a7e:	5b                   	pop    %ebx
+  800a7f:	5e                   	pop    %esi
+  800a80:	5f                   	pop    %edi
+  800a81:	5d                   	pop    %ebp
+  800a82:	c3                   	ret
+		padc = ' ';
+  800a83:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800a87:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800a8e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800a95:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800a9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800aa1:	8d 73 01             	lea    0x1(%ebx),%esi
+  800aa4:	0f b6 13             	movzbl (%ebx),%edx
+  800aa7:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800aaa:	3c 55                	cmp    $0x55,%al
+  800aac:	0f 87 2c 04 00 00    	ja     800ede <vprintfmt+0x4a0>
+  800ab2:	0f b6 c0             	movzbl %al,%eax
+  800ab5:	ff 24 85 20 39 80 00 	jmp    *0x803920(,%eax,4)
+  800abc:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800abe:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800ac2:	eb dd                	jmp    800aa1 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800ac4:	89 f3                	mov    %esi,%ebx
+  800ac6:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800aca:	eb d5                	jmp    800aa1 <vprintfmt+0x63>
+  800acc:	0f b6 d2             	movzbl %dl,%edx
+  800acf:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800ad6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800ad9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800add:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800ae0:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800ae3:	83 fe 09             	cmp    $0x9,%esi
+  800ae6:	0f 87 8a 00 00 00    	ja     800b76 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800aec:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800aef:	eb e5                	jmp    800ad6 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af4:	8b 00                	mov    (%eax),%eax
+  800af6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800af9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afc:	8d 40 04             	lea    0x4(%eax),%eax
+  800aff:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b02:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800b04:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800b08:	79 97                	jns    800aa1 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800b0a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b0d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b10:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800b17:	eb 88                	jmp    800aa1 <vprintfmt+0x63>
+			if (width < 0)
+  800b19:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800b1c:	85 db                	test   %ebx,%ebx
+  800b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b23:	0f 49 c3             	cmovns %ebx,%eax
+  800b26:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800b29:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800b2b:	e9 71 ff ff ff       	jmp    800aa1 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800b30:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800b32:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800b39:	e9 63 ff ff ff       	jmp    800aa1 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800b3e:	8d 73 02             	lea    0x2(%ebx),%esi
+  800b41:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800b45:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800b4c:	3c 67                	cmp    $0x67,%al
+  800b4e:	0f 84 18 ff ff ff    	je     800a6c <vprintfmt+0x2e>
+					attrib = 0x04;
+  800b54:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800b5b:	3c 72                	cmp    $0x72,%al
+  800b5d:	0f 84 09 ff ff ff    	je     800a6c <vprintfmt+0x2e>
+					attrib = 0x00;
+  800b63:	3c 62                	cmp    $0x62,%al
+  800b65:	0f 94 c0             	sete   %al
+  800b68:	0f b6 c0             	movzbl %al,%eax
+  800b6b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800b6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b71:	e9 f6 fe ff ff       	jmp    800a6c <vprintfmt+0x2e>
+  800b76:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800b79:	eb 89                	jmp    800b04 <vprintfmt+0xc6>
+			lflag++;
+  800b7b:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800b7e:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800b80:	e9 1c ff ff ff       	jmp    800aa1 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800b85:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b88:	8d 58 04             	lea    0x4(%eax),%ebx
+  800b8b:	83 ec 08             	sub    $0x8,%esp
+  800b8e:	ff 75 0c             	push   0xc(%ebp)
+  800b91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b94:	c1 e0 08             	shl    $0x8,%eax
+  800b97:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800b9a:	0b 01                	or     (%ecx),%eax
+  800b9c:	50                   	push   %eax
+  800b9d:	ff d7                	call   *%edi
+			break;
+  800b9f:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800ba2:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800ba5:	e9 c2 fe ff ff       	jmp    800a6c <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800baa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bad:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800bb0:	8b 10                	mov    (%eax),%edx
+  800bb2:	89 d0                	mov    %edx,%eax
+  800bb4:	f7 d8                	neg    %eax
+  800bb6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800bb9:	83 f8 12             	cmp    $0x12,%eax
+  800bbc:	7f 25                	jg     800be3 <vprintfmt+0x1a5>
+  800bbe:	8b 14 85 80 3a 80 00 	mov    0x803a80(,%eax,4),%edx
+  800bc5:	85 d2                	test   %edx,%edx
+  800bc7:	74 1a                	je     800be3 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800bc9:	52                   	push   %edx
+  800bca:	68 c1 3b 80 00       	push   $0x803bc1
+  800bcf:	ff 75 0c             	push   0xc(%ebp)
+  800bd2:	57                   	push   %edi
+  800bd3:	e8 49 fe ff ff       	call   800a21 <printfmt>
+  800bd8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bdb:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800bde:	e9 89 fe ff ff       	jmp    800a6c <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800be3:	50                   	push   %eax
+  800be4:	68 eb 37 80 00       	push   $0x8037eb
+  800be9:	ff 75 0c             	push   0xc(%ebp)
+  800bec:	57                   	push   %edi
+  800bed:	e8 2f fe ff ff       	call   800a21 <printfmt>
+  800bf2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800bf5:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800bf8:	e9 6f fe ff ff       	jmp    800a6c <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c00:	83 c0 04             	add    $0x4,%eax
+  800c03:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800c06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c09:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800c0b:	85 c9                	test   %ecx,%ecx
+  800c0d:	b8 e4 37 80 00       	mov    $0x8037e4,%eax
+  800c12:	0f 45 c1             	cmovne %ecx,%eax
+  800c15:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800c18:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800c1c:	7e 06                	jle    800c24 <vprintfmt+0x1e6>
+  800c1e:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800c22:	75 1a                	jne    800c3e <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800c24:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800c27:	c1 e0 08             	shl    $0x8,%eax
+  800c2a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800c2d:	83 c8 3f             	or     $0x3f,%eax
+  800c30:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800c33:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800c36:	89 75 10             	mov    %esi,0x10(%ebp)
+  800c39:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800c3c:	eb 6d                	jmp    800cab <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c3e:	83 ec 08             	sub    $0x8,%esp
+  800c41:	ff 75 d0             	push   -0x30(%ebp)
+  800c44:	ff 75 c8             	push   -0x38(%ebp)
+  800c47:	e8 39 03 00 00       	call   800f85 <strnlen>
+  800c4c:	89 c2                	mov    %eax,%edx
+  800c4e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c51:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800c53:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800c56:	c1 e1 08             	shl    $0x8,%ecx
+  800c59:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800c5d:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c5f:	83 c4 10             	add    $0x10,%esp
+  800c62:	89 c3                	mov    %eax,%ebx
+  800c64:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c67:	89 75 10             	mov    %esi,0x10(%ebp)
+  800c6a:	89 ce                	mov    %ecx,%esi
+  800c6c:	eb 0f                	jmp    800c7d <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800c6e:	83 ec 08             	sub    $0x8,%esp
+  800c71:	ff 75 0c             	push   0xc(%ebp)
+  800c74:	56                   	push   %esi
+  800c75:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c77:	83 eb 01             	sub    $0x1,%ebx
+  800c7a:	83 c4 10             	add    $0x10,%esp
+  800c7d:	85 db                	test   %ebx,%ebx
+  800c7f:	7f ed                	jg     800c6e <vprintfmt+0x230>
+  800c81:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800c84:	8b 75 10             	mov    0x10(%ebp),%esi
+  800c87:	85 c0                	test   %eax,%eax
+  800c89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c8e:	0f 49 d0             	cmovns %eax,%edx
+  800c91:	29 d0                	sub    %edx,%eax
+  800c93:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c96:	eb 8c                	jmp    800c24 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800c98:	83 ec 08             	sub    $0x8,%esp
+  800c9b:	ff 75 0c             	push   0xc(%ebp)
+  800c9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800ca1:	09 c2                	or     %eax,%edx
+  800ca3:	52                   	push   %edx
+  800ca4:	ff d7                	call   *%edi
+  800ca6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ca9:	89 d9                	mov    %ebx,%ecx
+  800cab:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800cae:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800cb2:	0f be d0             	movsbl %al,%edx
+  800cb5:	85 d2                	test   %edx,%edx
+  800cb7:	74 2a                	je     800ce3 <vprintfmt+0x2a5>
+  800cb9:	85 f6                	test   %esi,%esi
+  800cbb:	78 05                	js     800cc2 <vprintfmt+0x284>
+  800cbd:	83 ee 01             	sub    $0x1,%esi
+  800cc0:	78 3b                	js     800cfd <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800cc2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800cc6:	74 d0                	je     800c98 <vprintfmt+0x25a>
+  800cc8:	0f be c0             	movsbl %al,%eax
+  800ccb:	83 e8 20             	sub    $0x20,%eax
+  800cce:	83 f8 5e             	cmp    $0x5e,%eax
+  800cd1:	76 c5                	jbe    800c98 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800cd3:	83 ec 08             	sub    $0x8,%esp
+  800cd6:	ff 75 0c             	push   0xc(%ebp)
+  800cd9:	ff 75 cc             	push   -0x34(%ebp)
+  800cdc:	ff d7                	call   *%edi
+  800cde:	83 c4 10             	add    $0x10,%esp
+  800ce1:	eb c6                	jmp    800ca9 <vprintfmt+0x26b>
+  800ce3:	8b 75 10             	mov    0x10(%ebp),%esi
+  800ce6:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800ce9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800cec:	01 c3                	add    %eax,%ebx
+  800cee:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800cf0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800cf3:	83 c8 20             	or     $0x20,%eax
+  800cf6:	89 75 10             	mov    %esi,0x10(%ebp)
+  800cf9:	89 c6                	mov    %eax,%esi
+  800cfb:	eb 14                	jmp    800d11 <vprintfmt+0x2d3>
+  800cfd:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d00:	eb e4                	jmp    800ce6 <vprintfmt+0x2a8>
+  800d02:	83 ec 08             	sub    $0x8,%esp
+  800d05:	ff 75 0c             	push   0xc(%ebp)
+  800d08:	56                   	push   %esi
+  800d09:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800d0b:	83 eb 01             	sub    $0x1,%ebx
+  800d0e:	83 c4 10             	add    $0x10,%esp
+  800d11:	85 db                	test   %ebx,%ebx
+  800d13:	7f ed                	jg     800d02 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800d15:	8b 75 10             	mov    0x10(%ebp),%esi
+  800d18:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800d1b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d1e:	e9 49 fd ff ff       	jmp    800a6c <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800d23:	83 f9 01             	cmp    $0x1,%ecx
+  800d26:	7f 1f                	jg     800d47 <vprintfmt+0x309>
+	else if (lflag)
+  800d28:	85 c9                	test   %ecx,%ecx
+  800d2a:	74 69                	je     800d95 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800d2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d2f:	8b 00                	mov    (%eax),%eax
+  800d31:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d34:	89 c1                	mov    %eax,%ecx
+  800d36:	c1 f9 1f             	sar    $0x1f,%ecx
+  800d39:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d3c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d3f:	8d 40 04             	lea    0x4(%eax),%eax
+  800d42:	89 45 14             	mov    %eax,0x14(%ebp)
+  800d45:	eb 17                	jmp    800d5e <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800d47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d4a:	8b 50 04             	mov    0x4(%eax),%edx
+  800d4d:	8b 00                	mov    (%eax),%eax
+  800d4f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d52:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800d55:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d58:	8d 40 08             	lea    0x8(%eax),%eax
+  800d5b:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800d5e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800d61:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800d64:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800d69:	85 db                	test   %ebx,%ebx
+  800d6b:	0f 89 f6 00 00 00    	jns    800e67 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800d71:	83 ec 08             	sub    $0x8,%esp
+  800d74:	ff 75 0c             	push   0xc(%ebp)
+  800d77:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800d7a:	c1 e0 08             	shl    $0x8,%eax
+  800d7d:	83 c8 2d             	or     $0x2d,%eax
+  800d80:	50                   	push   %eax
+  800d81:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800d83:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800d86:	f7 d9                	neg    %ecx
+  800d88:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800d8b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d90:	e9 d2 00 00 00       	jmp    800e67 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800d95:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d98:	8b 00                	mov    (%eax),%eax
+  800d9a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800d9d:	89 c1                	mov    %eax,%ecx
+  800d9f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800da2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800da5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800da8:	8d 40 04             	lea    0x4(%eax),%eax
+  800dab:	89 45 14             	mov    %eax,0x14(%ebp)
+  800dae:	eb ae                	jmp    800d5e <vprintfmt+0x320>
+	if (lflag >= 2)
+  800db0:	83 f9 01             	cmp    $0x1,%ecx
+  800db3:	7f 19                	jg     800dce <vprintfmt+0x390>
+	else if (lflag)
+  800db5:	85 c9                	test   %ecx,%ecx
+  800db7:	74 2a                	je     800de3 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800db9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dbc:	8b 08                	mov    (%eax),%ecx
+  800dbe:	8d 40 04             	lea    0x4(%eax),%eax
+  800dc1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800dc4:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800dc9:	e9 99 00 00 00       	jmp    800e67 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800dce:	8b 45 14             	mov    0x14(%ebp),%eax
+  800dd1:	8b 08                	mov    (%eax),%ecx
+  800dd3:	8d 40 08             	lea    0x8(%eax),%eax
+  800dd6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800dd9:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800dde:	e9 84 00 00 00       	jmp    800e67 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800de3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800de6:	8b 08                	mov    (%eax),%ecx
+  800de8:	8d 40 04             	lea    0x4(%eax),%eax
+  800deb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800dee:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800df3:	eb 72                	jmp    800e67 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800df5:	83 f9 01             	cmp    $0x1,%ecx
+  800df8:	7f 16                	jg     800e10 <vprintfmt+0x3d2>
+	else if (lflag)
+  800dfa:	85 c9                	test   %ecx,%ecx
+  800dfc:	74 24                	je     800e22 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800dfe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e01:	8b 08                	mov    (%eax),%ecx
+  800e03:	8d 40 04             	lea    0x4(%eax),%eax
+  800e06:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800e09:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800e0e:	eb 57                	jmp    800e67 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800e10:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e13:	8b 08                	mov    (%eax),%ecx
+  800e15:	8d 40 08             	lea    0x8(%eax),%eax
+  800e18:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800e1b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800e20:	eb 45                	jmp    800e67 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800e22:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e25:	8b 08                	mov    (%eax),%ecx
+  800e27:	8d 40 04             	lea    0x4(%eax),%eax
+  800e2a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800e2d:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800e32:	eb 33                	jmp    800e67 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800e34:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e37:	c1 e3 08             	shl    $0x8,%ebx
+  800e3a:	83 ec 08             	sub    $0x8,%esp
+  800e3d:	ff 75 0c             	push   0xc(%ebp)
+  800e40:	89 d8                	mov    %ebx,%eax
+  800e42:	83 c8 30             	or     $0x30,%eax
+  800e45:	50                   	push   %eax
+  800e46:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800e48:	83 c4 08             	add    $0x8,%esp
+  800e4b:	ff 75 0c             	push   0xc(%ebp)
+  800e4e:	83 cb 78             	or     $0x78,%ebx
+  800e51:	53                   	push   %ebx
+  800e52:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800e54:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e57:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800e59:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800e5c:	8d 40 04             	lea    0x4(%eax),%eax
+  800e5f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e62:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800e67:	ff 75 e4             	push   -0x1c(%ebp)
+  800e6a:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800e6e:	52                   	push   %edx
+  800e6f:	ff 75 e0             	push   -0x20(%ebp)
+  800e72:	50                   	push   %eax
+  800e73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e76:	89 f8                	mov    %edi,%eax
+  800e78:	e8 f7 fa ff ff       	call   800974 <printnum>
+			break;
+  800e7d:	83 c4 10             	add    $0x10,%esp
+  800e80:	e9 e7 fb ff ff       	jmp    800a6c <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800e85:	83 f9 01             	cmp    $0x1,%ecx
+  800e88:	7f 16                	jg     800ea0 <vprintfmt+0x462>
+	else if (lflag)
+  800e8a:	85 c9                	test   %ecx,%ecx
+  800e8c:	74 24                	je     800eb2 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800e8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e91:	8b 08                	mov    (%eax),%ecx
+  800e93:	8d 40 04             	lea    0x4(%eax),%eax
+  800e96:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800e99:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800e9e:	eb c7                	jmp    800e67 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800ea0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea3:	8b 08                	mov    (%eax),%ecx
+  800ea5:	8d 40 08             	lea    0x8(%eax),%eax
+  800ea8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800eab:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800eb0:	eb b5                	jmp    800e67 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800eb2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eb5:	8b 08                	mov    (%eax),%ecx
+  800eb7:	8d 40 04             	lea    0x4(%eax),%eax
+  800eba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ebd:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800ec2:	eb a3                	jmp    800e67 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800ec4:	83 ec 08             	sub    $0x8,%esp
+  800ec7:	ff 75 0c             	push   0xc(%ebp)
+  800eca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800ecd:	c1 e0 08             	shl    $0x8,%eax
+  800ed0:	83 c8 25             	or     $0x25,%eax
+  800ed3:	50                   	push   %eax
+  800ed4:	ff d7                	call   *%edi
+			break;
+  800ed6:	83 c4 10             	add    $0x10,%esp
+  800ed9:	e9 8e fb ff ff       	jmp    800a6c <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800ede:	83 ec 08             	sub    $0x8,%esp
+  800ee1:	ff 75 0c             	push   0xc(%ebp)
+  800ee4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800ee7:	c1 e0 08             	shl    $0x8,%eax
+  800eea:	83 c8 25             	or     $0x25,%eax
+  800eed:	50                   	push   %eax
+  800eee:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ef0:	83 c4 10             	add    $0x10,%esp
+  800ef3:	89 de                	mov    %ebx,%esi
+  800ef5:	eb 03                	jmp    800efa <vprintfmt+0x4bc>
+  800ef7:	83 ee 01             	sub    $0x1,%esi
+  800efa:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800efe:	75 f7                	jne    800ef7 <vprintfmt+0x4b9>
+  800f00:	e9 67 fb ff ff       	jmp    800a6c <vprintfmt+0x2e>
+
+00800f05 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	83 ec 18             	sub    $0x18,%esp
+  800f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800f11:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800f14:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800f18:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800f1b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800f22:	85 c0                	test   %eax,%eax
+  800f24:	74 26                	je     800f4c <vsnprintf+0x47>
+  800f26:	85 d2                	test   %edx,%edx
+  800f28:	7e 22                	jle    800f4c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800f2a:	ff 75 14             	push   0x14(%ebp)
+  800f2d:	ff 75 10             	push   0x10(%ebp)
+  800f30:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800f33:	50                   	push   %eax
+  800f34:	68 04 0a 80 00       	push   $0x800a04
+  800f39:	e8 00 fb ff ff       	call   800a3e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800f3e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f41:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800f44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f47:	83 c4 10             	add    $0x10,%esp
+}
+  800f4a:	c9                   	leave
+  800f4b:	c3                   	ret
+		return -E_INVAL;
+  800f4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f51:	eb f7                	jmp    800f4a <vsnprintf+0x45>
+
+00800f53 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800f59:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800f5c:	50                   	push   %eax
+  800f5d:	ff 75 10             	push   0x10(%ebp)
+  800f60:	ff 75 0c             	push   0xc(%ebp)
+  800f63:	ff 75 08             	push   0x8(%ebp)
+  800f66:	e8 9a ff ff ff       	call   800f05 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800f6b:	c9                   	leave
+  800f6c:	c3                   	ret
+
+00800f6d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800f6d:	55                   	push   %ebp
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f78:	eb 03                	jmp    800f7d <strlen+0x10>
+		n++;
+  800f7a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800f7d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800f81:	75 f7                	jne    800f7a <strlen+0xd>
+	return n;
+}
+  800f83:	5d                   	pop    %ebp
+  800f84:	c3                   	ret
+
+00800f85 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800f85:	55                   	push   %ebp
+  800f86:	89 e5                	mov    %esp,%ebp
+  800f88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f93:	eb 03                	jmp    800f98 <strnlen+0x13>
+		n++;
+  800f95:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800f98:	39 d0                	cmp    %edx,%eax
+  800f9a:	74 08                	je     800fa4 <strnlen+0x1f>
+  800f9c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800fa0:	75 f3                	jne    800f95 <strnlen+0x10>
+  800fa2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800fa4:	89 d0                	mov    %edx,%eax
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+
+00800fa8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800fa8:	55                   	push   %ebp
+  800fa9:	89 e5                	mov    %esp,%ebp
+  800fab:	53                   	push   %ebx
+  800fac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800faf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800fbb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800fbe:	83 c0 01             	add    $0x1,%eax
+  800fc1:	84 d2                	test   %dl,%dl
+  800fc3:	75 f2                	jne    800fb7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800fc5:	89 c8                	mov    %ecx,%eax
+  800fc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fca:	c9                   	leave
+  800fcb:	c3                   	ret
+
+00800fcc <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	53                   	push   %ebx
+  800fd0:	83 ec 10             	sub    $0x10,%esp
+  800fd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800fd6:	53                   	push   %ebx
+  800fd7:	e8 91 ff ff ff       	call   800f6d <strlen>
+  800fdc:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800fdf:	ff 75 0c             	push   0xc(%ebp)
+  800fe2:	01 d8                	add    %ebx,%eax
+  800fe4:	50                   	push   %eax
+  800fe5:	e8 be ff ff ff       	call   800fa8 <strcpy>
+	return dst;
+}
+  800fea:	89 d8                	mov    %ebx,%eax
+  800fec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fef:	c9                   	leave
+  800ff0:	c3                   	ret
+
+00800ff1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	56                   	push   %esi
+  800ff5:	53                   	push   %ebx
+  800ff6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ff9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ffc:	89 f3                	mov    %esi,%ebx
+  800ffe:	03 5d 10             	add    0x10(%ebp),%ebx
+  801001:	89 f0                	mov    %esi,%eax
+  801003:	eb 0f                	jmp    801014 <strncpy+0x23>
+		*dst++ = *src;
+  801005:	83 c0 01             	add    $0x1,%eax
+  801008:	0f b6 0a             	movzbl (%edx),%ecx
+  80100b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80100e:	80 f9 01             	cmp    $0x1,%cl
+  801011:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801014:	39 d8                	cmp    %ebx,%eax
+  801016:	75 ed                	jne    801005 <strncpy+0x14>
+	}
+	return ret;
+}
+  801018:	89 f0                	mov    %esi,%eax
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5d                   	pop    %ebp
+  80101d:	c3                   	ret
+
+0080101e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80101e:	55                   	push   %ebp
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+  801023:	8b 75 08             	mov    0x8(%ebp),%esi
+  801026:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801029:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80102c:	89 f0                	mov    %esi,%eax
+  80102e:	85 d2                	test   %edx,%edx
+  801030:	74 21                	je     801053 <strlcpy+0x35>
+  801032:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801036:	89 f2                	mov    %esi,%edx
+  801038:	eb 09                	jmp    801043 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80103a:	83 c1 01             	add    $0x1,%ecx
+  80103d:	83 c2 01             	add    $0x1,%edx
+  801040:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801043:	39 c2                	cmp    %eax,%edx
+  801045:	74 09                	je     801050 <strlcpy+0x32>
+  801047:	0f b6 19             	movzbl (%ecx),%ebx
+  80104a:	84 db                	test   %bl,%bl
+  80104c:	75 ec                	jne    80103a <strlcpy+0x1c>
+  80104e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801050:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801053:	29 f0                	sub    %esi,%eax
+}
+  801055:	5b                   	pop    %ebx
+  801056:	5e                   	pop    %esi
+  801057:	5d                   	pop    %ebp
+  801058:	c3                   	ret
+
+00801059 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80105f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801062:	eb 06                	jmp    80106a <strcmp+0x11>
+		p++, q++;
+  801064:	83 c1 01             	add    $0x1,%ecx
+  801067:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80106a:	0f b6 01             	movzbl (%ecx),%eax
+  80106d:	84 c0                	test   %al,%al
+  80106f:	74 04                	je     801075 <strcmp+0x1c>
+  801071:	3a 02                	cmp    (%edx),%al
+  801073:	74 ef                	je     801064 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801075:	0f b6 c0             	movzbl %al,%eax
+  801078:	0f b6 12             	movzbl (%edx),%edx
+  80107b:	29 d0                	sub    %edx,%eax
+}
+  80107d:	5d                   	pop    %ebp
+  80107e:	c3                   	ret
+
+0080107f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	53                   	push   %ebx
+  801083:	8b 45 08             	mov    0x8(%ebp),%eax
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80108c:	eb 09                	jmp    801097 <strncmp+0x18>
+		n--, p++, q++;
+  80108e:	83 ea 01             	sub    $0x1,%edx
+  801091:	83 c0 01             	add    $0x1,%eax
+  801094:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  801097:	85 d2                	test   %edx,%edx
+  801099:	74 18                	je     8010b3 <strncmp+0x34>
+  80109b:	0f b6 18             	movzbl (%eax),%ebx
+  80109e:	84 db                	test   %bl,%bl
+  8010a0:	74 04                	je     8010a6 <strncmp+0x27>
+  8010a2:	3a 19                	cmp    (%ecx),%bl
+  8010a4:	74 e8                	je     80108e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8010a6:	0f b6 00             	movzbl (%eax),%eax
+  8010a9:	0f b6 11             	movzbl (%ecx),%edx
+  8010ac:	29 d0                	sub    %edx,%eax
+}
+  8010ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010b1:	c9                   	leave
+  8010b2:	c3                   	ret
+		return 0;
+  8010b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b8:	eb f4                	jmp    8010ae <strncmp+0x2f>
+
+008010ba <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8010c4:	eb 03                	jmp    8010c9 <strchr+0xf>
+  8010c6:	83 c0 01             	add    $0x1,%eax
+  8010c9:	0f b6 10             	movzbl (%eax),%edx
+  8010cc:	84 d2                	test   %dl,%dl
+  8010ce:	74 06                	je     8010d6 <strchr+0x1c>
+		if (*s == c)
+  8010d0:	38 ca                	cmp    %cl,%dl
+  8010d2:	75 f2                	jne    8010c6 <strchr+0xc>
+  8010d4:	eb 05                	jmp    8010db <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8010d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+
+008010dd <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8010dd:	55                   	push   %ebp
+  8010de:	89 e5                	mov    %esp,%ebp
+  8010e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010e3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8010e7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8010ea:	38 ca                	cmp    %cl,%dl
+  8010ec:	74 09                	je     8010f7 <strfind+0x1a>
+  8010ee:	84 d2                	test   %dl,%dl
+  8010f0:	74 05                	je     8010f7 <strfind+0x1a>
+	for (; *s; s++)
+  8010f2:	83 c0 01             	add    $0x1,%eax
+  8010f5:	eb f0                	jmp    8010e7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	c3                   	ret
+
+008010f9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	57                   	push   %edi
+  8010fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801100:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801103:	85 c9                	test   %ecx,%ecx
+  801105:	74 20                	je     801127 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801107:	89 f8                	mov    %edi,%eax
+  801109:	09 c8                	or     %ecx,%eax
+  80110b:	a8 03                	test   $0x3,%al
+  80110d:	75 12                	jne    801121 <memset+0x28>
+		c &= 0xFF;
+  80110f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801113:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801119:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80111c:	fc                   	cld
+  80111d:	f3 ab                	rep stos %eax,%es:(%edi)
+  80111f:	eb 06                	jmp    801127 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801121:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801124:	fc                   	cld
+  801125:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801127:	89 f8                	mov    %edi,%eax
+  801129:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80112c:	c9                   	leave
+  80112d:	c3                   	ret
+
+0080112e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	56                   	push   %esi
+  801133:	8b 45 08             	mov    0x8(%ebp),%eax
+  801136:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801139:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80113c:	39 c6                	cmp    %eax,%esi
+  80113e:	73 32                	jae    801172 <memmove+0x44>
+  801140:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801143:	39 d0                	cmp    %edx,%eax
+  801145:	73 2b                	jae    801172 <memmove+0x44>
+		s += n;
+		d += n;
+  801147:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80114a:	89 d6                	mov    %edx,%esi
+  80114c:	09 fe                	or     %edi,%esi
+  80114e:	09 ce                	or     %ecx,%esi
+  801150:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801156:	75 0e                	jne    801166 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801158:	83 ef 04             	sub    $0x4,%edi
+  80115b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80115e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801161:	fd                   	std
+  801162:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801164:	eb 09                	jmp    80116f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801166:	83 ef 01             	sub    $0x1,%edi
+  801169:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80116c:	fd                   	std
+  80116d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80116f:	fc                   	cld
+  801170:	eb 1a                	jmp    80118c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801172:	89 f2                	mov    %esi,%edx
+  801174:	09 c2                	or     %eax,%edx
+  801176:	09 ca                	or     %ecx,%edx
+  801178:	f6 c2 03             	test   $0x3,%dl
+  80117b:	75 0a                	jne    801187 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80117d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801180:	89 c7                	mov    %eax,%edi
+  801182:	fc                   	cld
+  801183:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801185:	eb 05                	jmp    80118c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801187:	89 c7                	mov    %eax,%edi
+  801189:	fc                   	cld
+  80118a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80118c:	5e                   	pop    %esi
+  80118d:	5f                   	pop    %edi
+  80118e:	5d                   	pop    %ebp
+  80118f:	c3                   	ret
+
+00801190 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801190:	55                   	push   %ebp
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801196:	ff 75 10             	push   0x10(%ebp)
+  801199:	ff 75 0c             	push   0xc(%ebp)
+  80119c:	ff 75 08             	push   0x8(%ebp)
+  80119f:	e8 8a ff ff ff       	call   80112e <memmove>
+}
+  8011a4:	c9                   	leave
+  8011a5:	c3                   	ret
+
+008011a6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	56                   	push   %esi
+  8011aa:	53                   	push   %ebx
+  8011ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8011b1:	89 c6                	mov    %eax,%esi
+  8011b3:	03 75 10             	add    0x10(%ebp),%esi
+  8011b6:	eb 06                	jmp    8011be <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8011b8:	83 c0 01             	add    $0x1,%eax
+  8011bb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8011be:	39 f0                	cmp    %esi,%eax
+  8011c0:	74 14                	je     8011d6 <memcmp+0x30>
+		if (*s1 != *s2)
+  8011c2:	0f b6 08             	movzbl (%eax),%ecx
+  8011c5:	0f b6 1a             	movzbl (%edx),%ebx
+  8011c8:	38 d9                	cmp    %bl,%cl
+  8011ca:	74 ec                	je     8011b8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8011cc:	0f b6 c1             	movzbl %cl,%eax
+  8011cf:	0f b6 db             	movzbl %bl,%ebx
+  8011d2:	29 d8                	sub    %ebx,%eax
+  8011d4:	eb 05                	jmp    8011db <memcmp+0x35>
+	}
+
+	return 0;
+  8011d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011db:	5b                   	pop    %ebx
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8011e8:	89 c2                	mov    %eax,%edx
+  8011ea:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8011ed:	eb 03                	jmp    8011f2 <memfind+0x13>
+  8011ef:	83 c0 01             	add    $0x1,%eax
+  8011f2:	39 d0                	cmp    %edx,%eax
+  8011f4:	73 04                	jae    8011fa <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8011f6:	38 08                	cmp    %cl,(%eax)
+  8011f8:	75 f5                	jne    8011ef <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	c3                   	ret
+
+008011fc <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	57                   	push   %edi
+  801200:	56                   	push   %esi
+  801201:	53                   	push   %ebx
+  801202:	83 ec 1c             	sub    $0x1c,%esp
+  801205:	8b 75 08             	mov    0x8(%ebp),%esi
+  801208:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80120b:	eb 03                	jmp    801210 <strtol+0x14>
+		s++;
+  80120d:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  801210:	0f b6 06             	movzbl (%esi),%eax
+  801213:	3c 20                	cmp    $0x20,%al
+  801215:	74 f6                	je     80120d <strtol+0x11>
+  801217:	3c 09                	cmp    $0x9,%al
+  801219:	74 f2                	je     80120d <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  80121b:	3c 2b                	cmp    $0x2b,%al
+  80121d:	74 43                	je     801262 <strtol+0x66>
+	int neg = 0;
+  80121f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  801224:	3c 2d                	cmp    $0x2d,%al
+  801226:	74 44                	je     80126c <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801228:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  80122e:	75 0f                	jne    80123f <strtol+0x43>
+  801230:	80 3e 30             	cmpb   $0x30,(%esi)
+  801233:	74 41                	je     801276 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801235:	85 ff                	test   %edi,%edi
+  801237:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80123c:	0f 44 f8             	cmove  %eax,%edi
+  80123f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801244:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  801249:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80124c:	89 fb                	mov    %edi,%ebx
+  80124e:	c1 fb 1f             	sar    $0x1f,%ebx
+  801251:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  801254:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801257:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  80125a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80125d:	89 75 08             	mov    %esi,0x8(%ebp)
+  801260:	eb 67                	jmp    8012c9 <strtol+0xcd>
+		s++;
+  801262:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  801265:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126a:	eb bc                	jmp    801228 <strtol+0x2c>
+		s++, neg = 1;
+  80126c:	83 c6 01             	add    $0x1,%esi
+  80126f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801274:	eb b2                	jmp    801228 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801276:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  80127a:	74 0e                	je     80128a <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  80127c:	85 ff                	test   %edi,%edi
+  80127e:	75 bf                	jne    80123f <strtol+0x43>
+		s++, base = 8;
+  801280:	83 c6 01             	add    $0x1,%esi
+  801283:	bf 08 00 00 00       	mov    $0x8,%edi
+  801288:	eb b5                	jmp    80123f <strtol+0x43>
+		s += 2, base = 16;
+  80128a:	83 c6 02             	add    $0x2,%esi
+  80128d:	bf 10 00 00 00       	mov    $0x10,%edi
+  801292:	eb ab                	jmp    80123f <strtol+0x43>
+			dig = *s - '0';
+  801294:	0f be c9             	movsbl %cl,%ecx
+  801297:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  80129a:	39 f9                	cmp    %edi,%ecx
+  80129c:	7d 59                	jge    8012f7 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  80129e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8012a2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8012a5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8012a8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  8012ab:	0f af d8             	imul   %eax,%ebx
+  8012ae:	0f af d7             	imul   %edi,%edx
+  8012b1:	01 d3                	add    %edx,%ebx
+  8012b3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8012b6:	f7 e7                	mul    %edi
+  8012b8:	01 da                	add    %ebx,%edx
+  8012ba:	89 cb                	mov    %ecx,%ebx
+  8012bc:	c1 fb 1f             	sar    $0x1f,%ebx
+  8012bf:	01 c8                	add    %ecx,%eax
+  8012c1:	11 da                	adc    %ebx,%edx
+  8012c3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  8012c6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  8012c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012cc:	0f b6 08             	movzbl (%eax),%ecx
+  8012cf:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  8012d2:	80 fb 09             	cmp    $0x9,%bl
+  8012d5:	76 bd                	jbe    801294 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  8012d7:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  8012da:	80 fb 19             	cmp    $0x19,%bl
+  8012dd:	77 08                	ja     8012e7 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  8012df:	0f be c9             	movsbl %cl,%ecx
+  8012e2:	83 e9 57             	sub    $0x57,%ecx
+  8012e5:	eb b3                	jmp    80129a <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  8012e7:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  8012ea:	80 fb 19             	cmp    $0x19,%bl
+  8012ed:	77 08                	ja     8012f7 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  8012ef:	0f be c9             	movsbl %cl,%ecx
+  8012f2:	83 e9 37             	sub    $0x37,%ecx
+  8012f5:	eb a3                	jmp    80129a <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8012f7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8012fa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8012fd:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  801300:	8b 75 08             	mov    0x8(%ebp),%esi
+  801303:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801307:	74 05                	je     80130e <strtol+0x112>
+		*endptr = (char *) s;
+  801309:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80130c:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  80130e:	85 c9                	test   %ecx,%ecx
+  801310:	74 07                	je     801319 <strtol+0x11d>
+  801312:	f7 d8                	neg    %eax
+  801314:	83 d2 00             	adc    $0x0,%edx
+  801317:	f7 da                	neg    %edx
+}
+  801319:	83 c4 1c             	add    $0x1c,%esp
+  80131c:	5b                   	pop    %ebx
+  80131d:	5e                   	pop    %esi
+  80131e:	5f                   	pop    %edi
+  80131f:	5d                   	pop    %ebp
+  801320:	c3                   	ret
+
+00801321 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+  801324:	57                   	push   %edi
+  801325:	56                   	push   %esi
+  801326:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801327:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  80132e:	74 18                	je     801348 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  801330:	b8 00 00 00 00       	mov    $0x0,%eax
+  801335:	8b 55 08             	mov    0x8(%ebp),%edx
+  801338:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133b:	89 c3                	mov    %eax,%ebx
+  80133d:	89 c7                	mov    %eax,%edi
+  80133f:	89 c6                	mov    %eax,%esi
+  801341:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801343:	5b                   	pop    %ebx
+  801344:	5e                   	pop    %esi
+  801345:	5f                   	pop    %edi
+  801346:	5d                   	pop    %ebp
+  801347:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801350:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801353:	89 c3                	mov    %eax,%ebx
+  801355:	89 c7                	mov    %eax,%edi
+  801357:	55                   	push   %ebp
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	8d 35 62 13 80 00    	lea    0x801362,%esi
+  801360:	0f 34                	sysenter
+  801362:	5d                   	pop    %ebp
+		goto out;
+  801363:	eb de                	jmp    801343 <sys_cputs+0x22>
+
+00801365 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801365:	55                   	push   %ebp
+  801366:	89 e5                	mov    %esp,%ebp
+  801368:	57                   	push   %edi
+  801369:	56                   	push   %esi
+  80136a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80136b:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801372:	74 19                	je     80138d <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  801374:	ba 00 00 00 00       	mov    $0x0,%edx
+  801379:	b8 01 00 00 00       	mov    $0x1,%eax
+  80137e:	89 d1                	mov    %edx,%ecx
+  801380:	89 d3                	mov    %edx,%ebx
+  801382:	89 d7                	mov    %edx,%edi
+  801384:	89 d6                	mov    %edx,%esi
+  801386:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801388:	5b                   	pop    %ebx
+  801389:	5e                   	pop    %esi
+  80138a:	5f                   	pop    %edi
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80138d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801392:	b8 01 00 00 00       	mov    $0x1,%eax
+  801397:	89 d1                	mov    %edx,%ecx
+  801399:	89 d3                	mov    %edx,%ebx
+  80139b:	89 d7                	mov    %edx,%edi
+  80139d:	55                   	push   %ebp
+  80139e:	89 e5                	mov    %esp,%ebp
+  8013a0:	8d 35 a8 13 80 00    	lea    0x8013a8,%esi
+  8013a6:	0f 34                	sysenter
+  8013a8:	5d                   	pop    %ebp
+		goto out;
+  8013a9:	eb dd                	jmp    801388 <sys_cgetc+0x23>
+
+008013ab <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	57                   	push   %edi
+  8013af:	56                   	push   %esi
+  8013b0:	53                   	push   %ebx
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013b4:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  8013bb:	74 21                	je     8013de <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  8013bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8013c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ca:	89 cb                	mov    %ecx,%ebx
+  8013cc:	89 cf                	mov    %ecx,%edi
+  8013ce:	89 ce                	mov    %ecx,%esi
+  8013d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013d2:	85 c0                	test   %eax,%eax
+  8013d4:	7f 27                	jg     8013fd <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8013d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d9:	5b                   	pop    %ebx
+  8013da:	5e                   	pop    %esi
+  8013db:	5f                   	pop    %edi
+  8013dc:	5d                   	pop    %ebp
+  8013dd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013e6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8013eb:	89 cb                	mov    %ecx,%ebx
+  8013ed:	89 cf                	mov    %ecx,%edi
+  8013ef:	55                   	push   %ebp
+  8013f0:	89 e5                	mov    %esp,%ebp
+  8013f2:	8d 35 fa 13 80 00    	lea    0x8013fa,%esi
+  8013f8:	0f 34                	sysenter
+  8013fa:	5d                   	pop    %ebp
+		goto out;
+  8013fb:	eb d5                	jmp    8013d2 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013fd:	83 ec 0c             	sub    $0xc,%esp
+  801400:	50                   	push   %eax
+  801401:	6a 03                	push   $0x3
+  801403:	68 eb 3a 80 00       	push   $0x803aeb
+  801408:	6a 3f                	push   $0x3f
+  80140a:	68 08 3b 80 00       	push   $0x803b08
+  80140f:	e8 71 f4 ff ff       	call   800885 <_panic>
+
+00801414 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+  801417:	57                   	push   %edi
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80141a:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801421:	74 19                	je     80143c <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  801423:	ba 00 00 00 00       	mov    $0x0,%edx
+  801428:	b8 02 00 00 00       	mov    $0x2,%eax
+  80142d:	89 d1                	mov    %edx,%ecx
+  80142f:	89 d3                	mov    %edx,%ebx
+  801431:	89 d7                	mov    %edx,%edi
+  801433:	89 d6                	mov    %edx,%esi
+  801435:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5f                   	pop    %edi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80143c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801441:	b8 02 00 00 00       	mov    $0x2,%eax
+  801446:	89 d1                	mov    %edx,%ecx
+  801448:	89 d3                	mov    %edx,%ebx
+  80144a:	89 d7                	mov    %edx,%edi
+  80144c:	55                   	push   %ebp
+  80144d:	89 e5                	mov    %esp,%ebp
+  80144f:	8d 35 57 14 80 00    	lea    0x801457,%esi
+  801455:	0f 34                	sysenter
+  801457:	5d                   	pop    %ebp
+		goto out;
+  801458:	eb dd                	jmp    801437 <sys_getenvid+0x23>
+
+0080145a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	57                   	push   %edi
+  80145e:	56                   	push   %esi
+  80145f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801460:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801467:	74 19                	je     801482 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  801469:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801473:	89 d1                	mov    %edx,%ecx
+  801475:	89 d3                	mov    %edx,%ebx
+  801477:	89 d7                	mov    %edx,%edi
+  801479:	89 d6                	mov    %edx,%esi
+  80147b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80147d:	5b                   	pop    %ebx
+  80147e:	5e                   	pop    %esi
+  80147f:	5f                   	pop    %edi
+  801480:	5d                   	pop    %ebp
+  801481:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801482:	ba 00 00 00 00       	mov    $0x0,%edx
+  801487:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80148c:	89 d1                	mov    %edx,%ecx
+  80148e:	89 d3                	mov    %edx,%ebx
+  801490:	89 d7                	mov    %edx,%edi
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	8d 35 9d 14 80 00    	lea    0x80149d,%esi
+  80149b:	0f 34                	sysenter
+  80149d:	5d                   	pop    %ebp
+		goto out;
+  80149e:	eb dd                	jmp    80147d <sys_yield+0x23>
+
+008014a0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8014a0:	55                   	push   %ebp
+  8014a1:	89 e5                	mov    %esp,%ebp
+  8014a3:	57                   	push   %edi
+  8014a4:	56                   	push   %esi
+  8014a5:	53                   	push   %ebx
+  8014a6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014a9:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  8014b0:	74 23                	je     8014d5 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  8014b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8014bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c5:	89 f7                	mov    %esi,%edi
+  8014c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014c9:	85 c0                	test   %eax,%eax
+  8014cb:	7f 29                	jg     8014f6 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8014cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d0:	5b                   	pop    %ebx
+  8014d1:	5e                   	pop    %esi
+  8014d2:	5f                   	pop    %edi
+  8014d3:	5d                   	pop    %ebp
+  8014d4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014db:	b8 04 00 00 00       	mov    $0x4,%eax
+  8014e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e8:	55                   	push   %ebp
+  8014e9:	89 e5                	mov    %esp,%ebp
+  8014eb:	8d 35 f3 14 80 00    	lea    0x8014f3,%esi
+  8014f1:	0f 34                	sysenter
+  8014f3:	5d                   	pop    %ebp
+		goto out;
+  8014f4:	eb d3                	jmp    8014c9 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014f6:	83 ec 0c             	sub    $0xc,%esp
+  8014f9:	50                   	push   %eax
+  8014fa:	6a 04                	push   $0x4
+  8014fc:	68 eb 3a 80 00       	push   $0x803aeb
+  801501:	6a 3f                	push   $0x3f
+  801503:	68 08 3b 80 00       	push   $0x803b08
+  801508:	e8 78 f3 ff ff       	call   800885 <_panic>
+
+0080150d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80150d:	55                   	push   %ebp
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	57                   	push   %edi
+  801511:	56                   	push   %esi
+  801512:	53                   	push   %ebx
+  801513:	83 ec 0c             	sub    $0xc,%esp
+  801516:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  801519:	85 f6                	test   %esi,%esi
+  80151b:	75 09                	jne    801526 <sys_page_map+0x19>
+  80151d:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801524:	74 1f                	je     801545 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  801526:	b8 05 00 00 00       	mov    $0x5,%eax
+  80152b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801531:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801534:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801537:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801539:	85 c0                	test   %eax,%eax
+  80153b:	7f 27                	jg     801564 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80153d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801540:	5b                   	pop    %ebx
+  801541:	5e                   	pop    %esi
+  801542:	5f                   	pop    %edi
+  801543:	5d                   	pop    %ebp
+  801544:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801545:	8b 55 08             	mov    0x8(%ebp),%edx
+  801548:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801550:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801553:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801556:	55                   	push   %ebp
+  801557:	89 e5                	mov    %esp,%ebp
+  801559:	8d 35 61 15 80 00    	lea    0x801561,%esi
+  80155f:	0f 34                	sysenter
+  801561:	5d                   	pop    %ebp
+		goto out;
+  801562:	eb d5                	jmp    801539 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801564:	83 ec 0c             	sub    $0xc,%esp
+  801567:	50                   	push   %eax
+  801568:	6a 05                	push   $0x5
+  80156a:	68 eb 3a 80 00       	push   $0x803aeb
+  80156f:	6a 3f                	push   $0x3f
+  801571:	68 08 3b 80 00       	push   $0x803b08
+  801576:	e8 0a f3 ff ff       	call   800885 <_panic>
+
+0080157b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80157b:	55                   	push   %ebp
+  80157c:	89 e5                	mov    %esp,%ebp
+  80157e:	57                   	push   %edi
+  80157f:	56                   	push   %esi
+  801580:	53                   	push   %ebx
+  801581:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801584:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  80158b:	74 22                	je     8015af <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  80158d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801592:	b8 06 00 00 00       	mov    $0x6,%eax
+  801597:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159d:	89 df                	mov    %ebx,%edi
+  80159f:	89 de                	mov    %ebx,%esi
+  8015a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	7f 28                	jg     8015cf <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8015a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015aa:	5b                   	pop    %ebx
+  8015ab:	5e                   	pop    %esi
+  8015ac:	5f                   	pop    %edi
+  8015ad:	5d                   	pop    %ebp
+  8015ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ba:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015bf:	89 df                	mov    %ebx,%edi
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	8d 35 cc 15 80 00    	lea    0x8015cc,%esi
+  8015ca:	0f 34                	sysenter
+  8015cc:	5d                   	pop    %ebp
+		goto out;
+  8015cd:	eb d4                	jmp    8015a3 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015cf:	83 ec 0c             	sub    $0xc,%esp
+  8015d2:	50                   	push   %eax
+  8015d3:	6a 06                	push   $0x6
+  8015d5:	68 eb 3a 80 00       	push   $0x803aeb
+  8015da:	6a 3f                	push   $0x3f
+  8015dc:	68 08 3b 80 00       	push   $0x803b08
+  8015e1:	e8 9f f2 ff ff       	call   800885 <_panic>
+
+008015e6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	57                   	push   %edi
+  8015ea:	56                   	push   %esi
+  8015eb:	53                   	push   %ebx
+  8015ec:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8015ef:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  8015f6:	74 22                	je     80161a <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8015f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fd:	b8 08 00 00 00       	mov    $0x8,%eax
+  801602:	8b 55 08             	mov    0x8(%ebp),%edx
+  801605:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801608:	89 df                	mov    %ebx,%edi
+  80160a:	89 de                	mov    %ebx,%esi
+  80160c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	7f 28                	jg     80163a <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80161a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801622:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801625:	b8 08 00 00 00       	mov    $0x8,%eax
+  80162a:	89 df                	mov    %ebx,%edi
+  80162c:	55                   	push   %ebp
+  80162d:	89 e5                	mov    %esp,%ebp
+  80162f:	8d 35 37 16 80 00    	lea    0x801637,%esi
+  801635:	0f 34                	sysenter
+  801637:	5d                   	pop    %ebp
+		goto out;
+  801638:	eb d4                	jmp    80160e <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80163a:	83 ec 0c             	sub    $0xc,%esp
+  80163d:	50                   	push   %eax
+  80163e:	6a 08                	push   $0x8
+  801640:	68 eb 3a 80 00       	push   $0x803aeb
+  801645:	6a 3f                	push   $0x3f
+  801647:	68 08 3b 80 00       	push   $0x803b08
+  80164c:	e8 34 f2 ff ff       	call   800885 <_panic>
+
+00801651 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801651:	55                   	push   %ebp
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	57                   	push   %edi
+  801655:	56                   	push   %esi
+  801656:	53                   	push   %ebx
+  801657:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80165a:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801661:	74 22                	je     801685 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801663:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801668:	b8 09 00 00 00       	mov    $0x9,%eax
+  80166d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801670:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801673:	89 df                	mov    %ebx,%edi
+  801675:	89 de                	mov    %ebx,%esi
+  801677:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801679:	85 c0                	test   %eax,%eax
+  80167b:	7f 28                	jg     8016a5 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80167d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801680:	5b                   	pop    %ebx
+  801681:	5e                   	pop    %esi
+  801682:	5f                   	pop    %edi
+  801683:	5d                   	pop    %ebp
+  801684:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801685:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801690:	b8 09 00 00 00       	mov    $0x9,%eax
+  801695:	89 df                	mov    %ebx,%edi
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	8d 35 a2 16 80 00    	lea    0x8016a2,%esi
+  8016a0:	0f 34                	sysenter
+  8016a2:	5d                   	pop    %ebp
+		goto out;
+  8016a3:	eb d4                	jmp    801679 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016a5:	83 ec 0c             	sub    $0xc,%esp
+  8016a8:	50                   	push   %eax
+  8016a9:	6a 09                	push   $0x9
+  8016ab:	68 eb 3a 80 00       	push   $0x803aeb
+  8016b0:	6a 3f                	push   $0x3f
+  8016b2:	68 08 3b 80 00       	push   $0x803b08
+  8016b7:	e8 c9 f1 ff ff       	call   800885 <_panic>
+
+008016bc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8016bc:	55                   	push   %ebp
+  8016bd:	89 e5                	mov    %esp,%ebp
+  8016bf:	57                   	push   %edi
+  8016c0:	56                   	push   %esi
+  8016c1:	53                   	push   %ebx
+  8016c2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016c5:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  8016cc:	74 22                	je     8016f0 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8016ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8016d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016de:	89 df                	mov    %ebx,%edi
+  8016e0:	89 de                	mov    %ebx,%esi
+  8016e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	7f 28                	jg     801710 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8016e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016eb:	5b                   	pop    %ebx
+  8016ec:	5e                   	pop    %esi
+  8016ed:	5f                   	pop    %edi
+  8016ee:	5d                   	pop    %ebp
+  8016ef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801700:	89 df                	mov    %ebx,%edi
+  801702:	55                   	push   %ebp
+  801703:	89 e5                	mov    %esp,%ebp
+  801705:	8d 35 0d 17 80 00    	lea    0x80170d,%esi
+  80170b:	0f 34                	sysenter
+  80170d:	5d                   	pop    %ebp
+		goto out;
+  80170e:	eb d4                	jmp    8016e4 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801710:	83 ec 0c             	sub    $0xc,%esp
+  801713:	50                   	push   %eax
+  801714:	6a 0a                	push   $0xa
+  801716:	68 eb 3a 80 00       	push   $0x803aeb
+  80171b:	6a 3f                	push   $0x3f
+  80171d:	68 08 3b 80 00       	push   $0x803b08
+  801722:	e8 5e f1 ff ff       	call   800885 <_panic>
+
+00801727 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801727:	55                   	push   %ebp
+  801728:	89 e5                	mov    %esp,%ebp
+  80172a:	57                   	push   %edi
+  80172b:	56                   	push   %esi
+  80172c:	53                   	push   %ebx
+  80172d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801730:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801737:	74 22                	je     80175b <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801739:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801743:	8b 55 08             	mov    0x8(%ebp),%edx
+  801746:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801749:	89 df                	mov    %ebx,%edi
+  80174b:	89 de                	mov    %ebx,%esi
+  80174d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	7f 28                	jg     80177b <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801753:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801756:	5b                   	pop    %ebx
+  801757:	5e                   	pop    %esi
+  801758:	5f                   	pop    %edi
+  801759:	5d                   	pop    %ebp
+  80175a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80175b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801760:	8b 55 08             	mov    0x8(%ebp),%edx
+  801763:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801766:	b8 17 00 00 00       	mov    $0x17,%eax
+  80176b:	89 df                	mov    %ebx,%edi
+  80176d:	55                   	push   %ebp
+  80176e:	89 e5                	mov    %esp,%ebp
+  801770:	8d 35 78 17 80 00    	lea    0x801778,%esi
+  801776:	0f 34                	sysenter
+  801778:	5d                   	pop    %ebp
+		goto out;
+  801779:	eb d4                	jmp    80174f <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80177b:	83 ec 0c             	sub    $0xc,%esp
+  80177e:	50                   	push   %eax
+  80177f:	6a 17                	push   $0x17
+  801781:	68 eb 3a 80 00       	push   $0x803aeb
+  801786:	6a 3f                	push   $0x3f
+  801788:	68 08 3b 80 00       	push   $0x803b08
+  80178d:	e8 f3 f0 ff ff       	call   800885 <_panic>
+
+00801792 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	57                   	push   %edi
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+  801798:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80179b:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  8017a2:	74 22                	je     8017c6 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8017a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a9:	b8 18 00 00 00       	mov    $0x18,%eax
+  8017ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b4:	89 df                	mov    %ebx,%edi
+  8017b6:	89 de                	mov    %ebx,%esi
+  8017b8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017ba:	85 c0                	test   %eax,%eax
+  8017bc:	7f 28                	jg     8017e6 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8017be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5f                   	pop    %edi
+  8017c4:	5d                   	pop    %ebp
+  8017c5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8017d6:	89 df                	mov    %ebx,%edi
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	8d 35 e3 17 80 00    	lea    0x8017e3,%esi
+  8017e1:	0f 34                	sysenter
+  8017e3:	5d                   	pop    %ebp
+		goto out;
+  8017e4:	eb d4                	jmp    8017ba <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017e6:	83 ec 0c             	sub    $0xc,%esp
+  8017e9:	50                   	push   %eax
+  8017ea:	6a 18                	push   $0x18
+  8017ec:	68 eb 3a 80 00       	push   $0x803aeb
+  8017f1:	6a 3f                	push   $0x3f
+  8017f3:	68 08 3b 80 00       	push   $0x803b08
+  8017f8:	e8 88 f0 ff ff       	call   800885 <_panic>
+
+008017fd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	57                   	push   %edi
+  801801:	56                   	push   %esi
+  801802:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801803:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  80180a:	74 1d                	je     801829 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80180c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801811:	be 00 00 00 00       	mov    $0x0,%esi
+  801816:	8b 55 08             	mov    0x8(%ebp),%edx
+  801819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80181f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801822:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801824:	5b                   	pop    %ebx
+  801825:	5e                   	pop    %esi
+  801826:	5f                   	pop    %edi
+  801827:	5d                   	pop    %ebp
+  801828:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801829:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80182f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801834:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801837:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	8d 35 45 18 80 00    	lea    0x801845,%esi
+  801843:	0f 34                	sysenter
+  801845:	5d                   	pop    %ebp
+		goto out;
+  801846:	eb dc                	jmp    801824 <sys_ipc_try_send+0x27>
+
+00801848 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801848:	55                   	push   %ebp
+  801849:	89 e5                	mov    %esp,%ebp
+  80184b:	57                   	push   %edi
+  80184c:	56                   	push   %esi
+  80184d:	53                   	push   %ebx
+  80184e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801851:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801858:	74 21                	je     80187b <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80185a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80185f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801864:	8b 55 08             	mov    0x8(%ebp),%edx
+  801867:	89 cb                	mov    %ecx,%ebx
+  801869:	89 cf                	mov    %ecx,%edi
+  80186b:	89 ce                	mov    %ecx,%esi
+  80186d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80186f:	85 c0                	test   %eax,%eax
+  801871:	7f 27                	jg     80189a <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801873:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801876:	5b                   	pop    %ebx
+  801877:	5e                   	pop    %esi
+  801878:	5f                   	pop    %edi
+  801879:	5d                   	pop    %ebp
+  80187a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80187b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801883:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801888:	89 cb                	mov    %ecx,%ebx
+  80188a:	89 cf                	mov    %ecx,%edi
+  80188c:	55                   	push   %ebp
+  80188d:	89 e5                	mov    %esp,%ebp
+  80188f:	8d 35 97 18 80 00    	lea    0x801897,%esi
+  801895:	0f 34                	sysenter
+  801897:	5d                   	pop    %ebp
+		goto out;
+  801898:	eb d5                	jmp    80186f <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80189a:	83 ec 0c             	sub    $0xc,%esp
+  80189d:	50                   	push   %eax
+  80189e:	6a 0d                	push   $0xd
+  8018a0:	68 eb 3a 80 00       	push   $0x803aeb
+  8018a5:	6a 3f                	push   $0x3f
+  8018a7:	68 08 3b 80 00       	push   $0x803b08
+  8018ac:	e8 d4 ef ff ff       	call   800885 <_panic>
+
+008018b1 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8018b1:	55                   	push   %ebp
+  8018b2:	89 e5                	mov    %esp,%ebp
+  8018b4:	57                   	push   %edi
+  8018b5:	56                   	push   %esi
+  8018b6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018b7:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  8018be:	74 1b                	je     8018db <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8018c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d0:	89 df                	mov    %ebx,%edi
+  8018d2:	89 de                	mov    %ebx,%esi
+  8018d4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8018d6:	5b                   	pop    %ebx
+  8018d7:	5e                   	pop    %esi
+  8018d8:	5f                   	pop    %edi
+  8018d9:	5d                   	pop    %ebp
+  8018da:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8018eb:	89 df                	mov    %ebx,%edi
+  8018ed:	55                   	push   %ebp
+  8018ee:	89 e5                	mov    %esp,%ebp
+  8018f0:	8d 35 f8 18 80 00    	lea    0x8018f8,%esi
+  8018f6:	0f 34                	sysenter
+  8018f8:	5d                   	pop    %ebp
+		goto out;
+  8018f9:	eb db                	jmp    8018d6 <sys_ipc_recv_until+0x25>
+
+008018fb <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8018fb:	55                   	push   %ebp
+  8018fc:	89 e5                	mov    %esp,%ebp
+  8018fe:	57                   	push   %edi
+  8018ff:	56                   	push   %esi
+  801900:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801901:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801908:	74 19                	je     801923 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80190a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801914:	89 d1                	mov    %edx,%ecx
+  801916:	89 d3                	mov    %edx,%ebx
+  801918:	89 d7                	mov    %edx,%edi
+  80191a:	89 d6                	mov    %edx,%esi
+  80191c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80191e:	5b                   	pop    %ebx
+  80191f:	5e                   	pop    %esi
+  801920:	5f                   	pop    %edi
+  801921:	5d                   	pop    %ebp
+  801922:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801923:	ba 00 00 00 00       	mov    $0x0,%edx
+  801928:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80192d:	89 d1                	mov    %edx,%ecx
+  80192f:	89 d3                	mov    %edx,%ebx
+  801931:	89 d7                	mov    %edx,%edi
+  801933:	55                   	push   %ebp
+  801934:	89 e5                	mov    %esp,%ebp
+  801936:	8d 35 3e 19 80 00    	lea    0x80193e,%esi
+  80193c:	0f 34                	sysenter
+  80193e:	5d                   	pop    %ebp
+		goto out;
+  80193f:	eb dd                	jmp    80191e <sys_time_msec+0x23>
+
+00801941 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801941:	55                   	push   %ebp
+  801942:	89 e5                	mov    %esp,%ebp
+  801944:	57                   	push   %edi
+  801945:	56                   	push   %esi
+  801946:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801947:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  80194e:	74 1a                	je     80196a <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801950:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801955:	b8 10 00 00 00       	mov    $0x10,%eax
+  80195a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195d:	89 cb                	mov    %ecx,%ebx
+  80195f:	89 cf                	mov    %ecx,%edi
+  801961:	89 ce                	mov    %ecx,%esi
+  801963:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801965:	5b                   	pop    %ebx
+  801966:	5e                   	pop    %esi
+  801967:	5f                   	pop    %edi
+  801968:	5d                   	pop    %ebp
+  801969:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80196a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801972:	b8 10 00 00 00       	mov    $0x10,%eax
+  801977:	89 cb                	mov    %ecx,%ebx
+  801979:	89 cf                	mov    %ecx,%edi
+  80197b:	55                   	push   %ebp
+  80197c:	89 e5                	mov    %esp,%ebp
+  80197e:	8d 35 86 19 80 00    	lea    0x801986,%esi
+  801984:	0f 34                	sysenter
+  801986:	5d                   	pop    %ebp
+		goto out;
+  801987:	eb dc                	jmp    801965 <sys_sleep_until+0x24>
+
+00801989 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801989:	55                   	push   %ebp
+  80198a:	89 e5                	mov    %esp,%ebp
+  80198c:	57                   	push   %edi
+  80198d:	56                   	push   %esi
+  80198e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80198f:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801996:	74 1a                	je     8019b2 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801998:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80199d:	b8 11 00 00 00       	mov    $0x11,%eax
+  8019a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a5:	89 cb                	mov    %ecx,%ebx
+  8019a7:	89 cf                	mov    %ecx,%edi
+  8019a9:	89 ce                	mov    %ecx,%esi
+  8019ab:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8019ad:	5b                   	pop    %ebx
+  8019ae:	5e                   	pop    %esi
+  8019af:	5f                   	pop    %edi
+  8019b0:	5d                   	pop    %ebp
+  8019b1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019ba:	b8 11 00 00 00       	mov    $0x11,%eax
+  8019bf:	89 cb                	mov    %ecx,%ebx
+  8019c1:	89 cf                	mov    %ecx,%edi
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	8d 35 ce 19 80 00    	lea    0x8019ce,%esi
+  8019cc:	0f 34                	sysenter
+  8019ce:	5d                   	pop    %ebp
+		goto out;
+  8019cf:	eb dc                	jmp    8019ad <sys_env_print_stats+0x24>
+
+008019d1 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8019d1:	55                   	push   %ebp
+  8019d2:	89 e5                	mov    %esp,%ebp
+  8019d4:	57                   	push   %edi
+  8019d5:	56                   	push   %esi
+  8019d6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019d7:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  8019de:	74 1b                	je     8019fb <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8019e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8019ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f0:	89 df                	mov    %ebx,%edi
+  8019f2:	89 de                	mov    %ebx,%esi
+  8019f4:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8019f6:	5b                   	pop    %ebx
+  8019f7:	5e                   	pop    %esi
+  8019f8:	5f                   	pop    %edi
+  8019f9:	5d                   	pop    %ebp
+  8019fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a00:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a06:	b8 19 00 00 00       	mov    $0x19,%eax
+  801a0b:	89 df                	mov    %ebx,%edi
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	8d 35 18 1a 80 00    	lea    0x801a18,%esi
+  801a16:	0f 34                	sysenter
+  801a18:	5d                   	pop    %ebp
+		goto out;
+  801a19:	eb db                	jmp    8019f6 <sys_perf+0x25>
+
+00801a1b <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801a1b:	55                   	push   %ebp
+  801a1c:	89 e5                	mov    %esp,%ebp
+  801a1e:	57                   	push   %edi
+  801a1f:	56                   	push   %esi
+  801a20:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a21:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801a28:	74 19                	je     801a43 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801a2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801a34:	89 d1                	mov    %edx,%ecx
+  801a36:	89 d3                	mov    %edx,%ebx
+  801a38:	89 d7                	mov    %edx,%edi
+  801a3a:	89 d6                	mov    %edx,%esi
+  801a3c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801a3e:	5b                   	pop    %ebx
+  801a3f:	5e                   	pop    %esi
+  801a40:	5f                   	pop    %edi
+  801a41:	5d                   	pop    %ebp
+  801a42:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a48:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801a4d:	89 d1                	mov    %edx,%ecx
+  801a4f:	89 d3                	mov    %edx,%ebx
+  801a51:	89 d7                	mov    %edx,%edi
+  801a53:	55                   	push   %ebp
+  801a54:	89 e5                	mov    %esp,%ebp
+  801a56:	8d 35 5e 1a 80 00    	lea    0x801a5e,%esi
+  801a5c:	0f 34                	sysenter
+  801a5e:	5d                   	pop    %ebp
+		goto out;
+  801a5f:	eb dd                	jmp    801a3e <sys_fork+0x23>
+
+00801a61 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	57                   	push   %edi
+  801a65:	56                   	push   %esi
+  801a66:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a67:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801a6e:	74 1c                	je     801a8c <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801a70:	be 00 00 00 00       	mov    $0x0,%esi
+  801a75:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a83:	89 f7                	mov    %esi,%edi
+  801a85:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801a87:	5b                   	pop    %ebx
+  801a88:	5e                   	pop    %esi
+  801a89:	5f                   	pop    %edi
+  801a8a:	5d                   	pop    %ebp
+  801a8b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a92:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801a97:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a9f:	55                   	push   %ebp
+  801aa0:	89 e5                	mov    %esp,%ebp
+  801aa2:	8d 35 aa 1a 80 00    	lea    0x801aaa,%esi
+  801aa8:	0f 34                	sysenter
+  801aaa:	5d                   	pop    %ebp
+		goto out;
+  801aab:	eb da                	jmp    801a87 <sys_thread_create+0x26>
+
+00801aad <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801aad:	55                   	push   %ebp
+  801aae:	89 e5                	mov    %esp,%ebp
+  801ab0:	57                   	push   %edi
+  801ab1:	56                   	push   %esi
+  801ab2:	53                   	push   %ebx
+  801ab3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801ab6:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801abd:	74 24                	je     801ae3 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801abf:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801ac4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801acc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801acf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ad2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ad5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	7f 27                	jg     801b02 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801adb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ade:	5b                   	pop    %ebx
+  801adf:	5e                   	pop    %esi
+  801ae0:	5f                   	pop    %edi
+  801ae1:	5d                   	pop    %ebp
+  801ae2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ae3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ae9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801aee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801af1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801af4:	55                   	push   %ebp
+  801af5:	89 e5                	mov    %esp,%ebp
+  801af7:	8d 35 ff 1a 80 00    	lea    0x801aff,%esi
+  801afd:	0f 34                	sysenter
+  801aff:	5d                   	pop    %ebp
+		goto out;
+  801b00:	eb d5                	jmp    801ad7 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b02:	83 ec 0c             	sub    $0xc,%esp
+  801b05:	50                   	push   %eax
+  801b06:	6a 1f                	push   $0x1f
+  801b08:	68 eb 3a 80 00       	push   $0x803aeb
+  801b0d:	6a 3f                	push   $0x3f
+  801b0f:	68 08 3b 80 00       	push   $0x803b08
+  801b14:	e8 6c ed ff ff       	call   800885 <_panic>
+
+00801b19 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801b19:	55                   	push   %ebp
+  801b1a:	89 e5                	mov    %esp,%ebp
+  801b1c:	57                   	push   %edi
+  801b1d:	56                   	push   %esi
+  801b1e:	53                   	push   %ebx
+  801b1f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801b22:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801b29:	74 23                	je     801b4e <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801b2b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b30:	b8 20 00 00 00       	mov    $0x20,%eax
+  801b35:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b3e:	89 f7                	mov    %esi,%edi
+  801b40:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801b42:	85 c0                	test   %eax,%eax
+  801b44:	7f 29                	jg     801b6f <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801b46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b49:	5b                   	pop    %ebx
+  801b4a:	5e                   	pop    %esi
+  801b4b:	5f                   	pop    %edi
+  801b4c:	5d                   	pop    %ebp
+  801b4d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b54:	b8 20 00 00 00       	mov    $0x20,%eax
+  801b59:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b61:	55                   	push   %ebp
+  801b62:	89 e5                	mov    %esp,%ebp
+  801b64:	8d 35 6c 1b 80 00    	lea    0x801b6c,%esi
+  801b6a:	0f 34                	sysenter
+  801b6c:	5d                   	pop    %ebp
+		goto out;
+  801b6d:	eb d3                	jmp    801b42 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b6f:	83 ec 0c             	sub    $0xc,%esp
+  801b72:	50                   	push   %eax
+  801b73:	6a 20                	push   $0x20
+  801b75:	68 eb 3a 80 00       	push   $0x803aeb
+  801b7a:	6a 3f                	push   $0x3f
+  801b7c:	68 08 3b 80 00       	push   $0x803b08
+  801b81:	e8 ff ec ff ff       	call   800885 <_panic>
+
+00801b86 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801b86:	55                   	push   %ebp
+  801b87:	89 e5                	mov    %esp,%ebp
+  801b89:	57                   	push   %edi
+  801b8a:	56                   	push   %esi
+  801b8b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b8c:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801b93:	74 1b                	je     801bb0 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801b95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b9a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801b9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ba2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ba5:	89 df                	mov    %ebx,%edi
+  801ba7:	89 de                	mov    %ebx,%esi
+  801ba9:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801bab:	5b                   	pop    %ebx
+  801bac:	5e                   	pop    %esi
+  801bad:	5f                   	pop    %edi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801bb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bbb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801bc0:	89 df                	mov    %ebx,%edi
+  801bc2:	55                   	push   %ebp
+  801bc3:	89 e5                	mov    %esp,%ebp
+  801bc5:	8d 35 cd 1b 80 00    	lea    0x801bcd,%esi
+  801bcb:	0f 34                	sysenter
+  801bcd:	5d                   	pop    %ebp
+		goto out;
+  801bce:	eb db                	jmp    801bab <sys_batch+0x25>
+
+00801bd0 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801bd0:	55                   	push   %ebp
+  801bd1:	89 e5                	mov    %esp,%ebp
+  801bd3:	57                   	push   %edi
+  801bd4:	56                   	push   %esi
+  801bd5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801bd6:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801bdd:	74 1a                	je     801bf9 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801bdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801be9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bec:	89 cb                	mov    %ecx,%ebx
+  801bee:	89 cf                	mov    %ecx,%edi
+  801bf0:	89 ce                	mov    %ecx,%esi
+  801bf2:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801bf4:	5b                   	pop    %ebx
+  801bf5:	5e                   	pop    %esi
+  801bf6:	5f                   	pop    %edi
+  801bf7:	5d                   	pop    %ebp
+  801bf8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801bf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c01:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801c06:	89 cb                	mov    %ecx,%ebx
+  801c08:	89 cf                	mov    %ecx,%edi
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	8d 35 15 1c 80 00    	lea    0x801c15,%esi
+  801c13:	0f 34                	sysenter
+  801c15:	5d                   	pop    %ebp
+		goto out;
+  801c16:	eb dc                	jmp    801bf4 <sys_trace_ctl+0x24>
+
+00801c18 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801c18:	55                   	push   %ebp
+  801c19:	89 e5                	mov    %esp,%ebp
+  801c1b:	57                   	push   %edi
+  801c1c:	56                   	push   %esi
+  801c1d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801c1e:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801c25:	74 1c                	je     801c43 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801c27:	be 00 00 00 00       	mov    $0x0,%esi
+  801c2c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801c31:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c3a:	89 f7                	mov    %esi,%edi
+  801c3c:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801c3e:	5b                   	pop    %ebx
+  801c3f:	5e                   	pop    %esi
+  801c40:	5f                   	pop    %edi
+  801c41:	5d                   	pop    %ebp
+  801c42:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c43:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c49:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801c4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c56:	55                   	push   %ebp
+  801c57:	89 e5                	mov    %esp,%ebp
+  801c59:	8d 35 61 1c 80 00    	lea    0x801c61,%esi
+  801c5f:	0f 34                	sysenter
+  801c61:	5d                   	pop    %ebp
+		goto out;
+  801c62:	eb da                	jmp    801c3e <sys_trace_read+0x26>
+
+00801c64 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	57                   	push   %edi
+  801c68:	56                   	push   %esi
+  801c69:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801c6a:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801c71:	74 1c                	je     801c8f <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801c73:	be 00 00 00 00       	mov    $0x0,%esi
+  801c78:	b8 21 00 00 00       	mov    $0x21,%eax
+  801c7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c86:	89 f7                	mov    %esi,%edi
+  801c88:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801c8a:	5b                   	pop    %ebx
+  801c8b:	5e                   	pop    %esi
+  801c8c:	5f                   	pop    %edi
+  801c8d:	5d                   	pop    %ebp
+  801c8e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c95:	b8 21 00 00 00       	mov    $0x21,%eax
+  801c9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ca2:	55                   	push   %ebp
+  801ca3:	89 e5                	mov    %esp,%ebp
+  801ca5:	8d 35 ad 1c 80 00    	lea    0x801cad,%esi
+  801cab:	0f 34                	sysenter
+  801cad:	5d                   	pop    %ebp
+		goto out;
+  801cae:	eb da                	jmp    801c8a <sys_meminfo+0x26>
+
+00801cb0 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	57                   	push   %edi
+  801cb4:	56                   	push   %esi
+  801cb5:	53                   	push   %ebx
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801cb9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801cbd:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801cc4:	74 1f                	je     801ce5 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801cc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ccb:	b8 22 00 00 00       	mov    $0x22,%eax
+  801cd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cd3:	89 df                	mov    %ebx,%edi
+  801cd5:	89 de                	mov    %ebx,%esi
+  801cd7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	7f 25                	jg     801d02 <sys_env_set_ksm+0x52>
+}
+  801cdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ce0:	5b                   	pop    %ebx
+  801ce1:	5e                   	pop    %esi
+  801ce2:	5f                   	pop    %edi
+  801ce3:	5d                   	pop    %ebp
+  801ce4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ce5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cea:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ced:	b8 22 00 00 00       	mov    $0x22,%eax
+  801cf2:	89 df                	mov    %ebx,%edi
+  801cf4:	55                   	push   %ebp
+  801cf5:	89 e5                	mov    %esp,%ebp
+  801cf7:	8d 35 ff 1c 80 00    	lea    0x801cff,%esi
+  801cfd:	0f 34                	sysenter
+  801cff:	5d                   	pop    %ebp
+		goto out;
+  801d00:	eb d7                	jmp    801cd9 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d02:	83 ec 0c             	sub    $0xc,%esp
+  801d05:	50                   	push   %eax
+  801d06:	6a 22                	push   $0x22
+  801d08:	68 eb 3a 80 00       	push   $0x803aeb
+  801d0d:	6a 3f                	push   $0x3f
+  801d0f:	68 08 3b 80 00       	push   $0x803b08
+  801d14:	e8 6c eb ff ff       	call   800885 <_panic>
+
+00801d19 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801d19:	55                   	push   %ebp
+  801d1a:	89 e5                	mov    %esp,%ebp
+  801d1c:	57                   	push   %edi
+  801d1d:	56                   	push   %esi
+  801d1e:	53                   	push   %ebx
+  801d1f:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801d22:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801d25:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801d2c:	74 24                	je     801d52 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801d2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d33:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801d38:	89 cb                	mov    %ecx,%ebx
+  801d3a:	89 cf                	mov    %ecx,%edi
+  801d3c:	89 ce                	mov    %ecx,%esi
+  801d3e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801d40:	85 c0                	test   %eax,%eax
+  801d42:	7f 2a                	jg     801d6e <sys_time_nsec+0x55>
+	return ns;
+}
+  801d44:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d47:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d4d:	5b                   	pop    %ebx
+  801d4e:	5e                   	pop    %esi
+  801d4f:	5f                   	pop    %edi
+  801d50:	5d                   	pop    %ebp
+  801d51:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801d52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d57:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801d5c:	89 cb                	mov    %ecx,%ebx
+  801d5e:	89 cf                	mov    %ecx,%edi
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	8d 35 6b 1d 80 00    	lea    0x801d6b,%esi
+  801d69:	0f 34                	sysenter
+  801d6b:	5d                   	pop    %ebp
+		goto out;
+  801d6c:	eb d2                	jmp    801d40 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d6e:	83 ec 0c             	sub    $0xc,%esp
+  801d71:	50                   	push   %eax
+  801d72:	6a 0f                	push   $0xf
+  801d74:	68 eb 3a 80 00       	push   $0x803aeb
+  801d79:	6a 3f                	push   $0x3f
+  801d7b:	68 08 3b 80 00       	push   $0x803b08
+  801d80:	e8 00 eb ff ff       	call   800885 <_panic>
+
+00801d85 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801d85:	55                   	push   %ebp
+  801d86:	89 e5                	mov    %esp,%ebp
+  801d88:	57                   	push   %edi
+  801d89:	56                   	push   %esi
+  801d8a:	53                   	push   %ebx
+  801d8b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801d8e:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801d95:	74 22                	je     801db9 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801d97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801da1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801da7:	89 df                	mov    %ebx,%edi
+  801da9:	89 de                	mov    %ebx,%esi
+  801dab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801dad:	85 c0                	test   %eax,%eax
+  801daf:	7f 28                	jg     801dd9 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801db4:	5b                   	pop    %ebx
+  801db5:	5e                   	pop    %esi
+  801db6:	5f                   	pop    %edi
+  801db7:	5d                   	pop    %ebp
+  801db8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801db9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dc4:	b8 12 00 00 00       	mov    $0x12,%eax
+  801dc9:	89 df                	mov    %ebx,%edi
+  801dcb:	55                   	push   %ebp
+  801dcc:	89 e5                	mov    %esp,%ebp
+  801dce:	8d 35 d6 1d 80 00    	lea    0x801dd6,%esi
+  801dd4:	0f 34                	sysenter
+  801dd6:	5d                   	pop    %ebp
+		goto out;
+  801dd7:	eb d4                	jmp    801dad <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801dd9:	83 ec 0c             	sub    $0xc,%esp
+  801ddc:	50                   	push   %eax
+  801ddd:	6a 12                	push   $0x12
+  801ddf:	68 eb 3a 80 00       	push   $0x803aeb
+  801de4:	6a 3f                	push   $0x3f
+  801de6:	68 08 3b 80 00       	push   $0x803b08
+  801deb:	e8 95 ea ff ff       	call   800885 <_panic>
+
+00801df0 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801df0:	55                   	push   %ebp
+  801df1:	89 e5                	mov    %esp,%ebp
+  801df3:	57                   	push   %edi
+  801df4:	56                   	push   %esi
+  801df5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801df6:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801dfd:	74 1b                	je     801e1a <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801dff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e04:	b8 13 00 00 00       	mov    $0x13,%eax
+  801e09:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e0f:	89 df                	mov    %ebx,%edi
+  801e11:	89 de                	mov    %ebx,%esi
+  801e13:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801e15:	5b                   	pop    %ebx
+  801e16:	5e                   	pop    %esi
+  801e17:	5f                   	pop    %edi
+  801e18:	5d                   	pop    %ebp
+  801e19:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801e1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e25:	b8 13 00 00 00       	mov    $0x13,%eax
+  801e2a:	89 df                	mov    %ebx,%edi
+  801e2c:	55                   	push   %ebp
+  801e2d:	89 e5                	mov    %esp,%ebp
+  801e2f:	8d 35 37 1e 80 00    	lea    0x801e37,%esi
+  801e35:	0f 34                	sysenter
+  801e37:	5d                   	pop    %ebp
+		goto out;
+  801e38:	eb db                	jmp    801e15 <sys_e1000_receive+0x25>
+
+00801e3a <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801e3a:	55                   	push   %ebp
+  801e3b:	89 e5                	mov    %esp,%ebp
+  801e3d:	57                   	push   %edi
+  801e3e:	56                   	push   %esi
+  801e3f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801e40:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801e47:	74 1b                	je     801e64 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801e49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e4e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e53:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e59:	89 df                	mov    %ebx,%edi
+  801e5b:	89 de                	mov    %ebx,%esi
+  801e5d:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801e5f:	5b                   	pop    %ebx
+  801e60:	5e                   	pop    %esi
+  801e61:	5f                   	pop    %edi
+  801e62:	5d                   	pop    %ebp
+  801e63:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801e64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e69:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e6f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801e74:	89 df                	mov    %ebx,%edi
+  801e76:	55                   	push   %ebp
+  801e77:	89 e5                	mov    %esp,%ebp
+  801e79:	8d 35 81 1e 80 00    	lea    0x801e81,%esi
+  801e7f:	0f 34                	sysenter
+  801e81:	5d                   	pop    %ebp
+		goto out;
+  801e82:	eb db                	jmp    801e5f <sys_e1000_read_hwaddr+0x25>
+
+00801e84 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801e84:	55                   	push   %ebp
+  801e85:	89 e5                	mov    %esp,%ebp
+  801e87:	57                   	push   %edi
+  801e88:	56                   	push   %esi
+  801e89:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801e8a:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801e91:	74 1a                	je     801ead <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801e93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e98:	b8 15 00 00 00       	mov    $0x15,%eax
+  801e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ea0:	89 cb                	mov    %ecx,%ebx
+  801ea2:	89 cf                	mov    %ecx,%edi
+  801ea4:	89 ce                	mov    %ecx,%esi
+  801ea6:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801ea8:	5b                   	pop    %ebx
+  801ea9:	5e                   	pop    %esi
+  801eaa:	5f                   	pop    %edi
+  801eab:	5d                   	pop    %ebp
+  801eac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eb5:	b8 15 00 00 00       	mov    $0x15,%eax
+  801eba:	89 cb                	mov    %ecx,%ebx
+  801ebc:	89 cf                	mov    %ecx,%edi
+  801ebe:	55                   	push   %ebp
+  801ebf:	89 e5                	mov    %esp,%ebp
+  801ec1:	8d 35 c9 1e 80 00    	lea    0x801ec9,%esi
+  801ec7:	0f 34                	sysenter
+  801ec9:	5d                   	pop    %ebp
+		goto out;
+  801eca:	eb dc                	jmp    801ea8 <sys_sb16_read_version+0x24>
+
+00801ecc <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	57                   	push   %edi
+  801ed0:	56                   	push   %esi
+  801ed1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801ed2:	80 3d 20 50 80 00 00 	cmpb   $0x0,0x805020
+  801ed9:	74 1b                	je     801ef6 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ee0:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ee5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eeb:	89 df                	mov    %ebx,%edi
+  801eed:	89 de                	mov    %ebx,%esi
+  801eef:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801ef1:	5b                   	pop    %ebx
+  801ef2:	5e                   	pop    %esi
+  801ef3:	5f                   	pop    %edi
+  801ef4:	5d                   	pop    %ebp
+  801ef5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ef6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801efe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f01:	b8 16 00 00 00       	mov    $0x16,%eax
+  801f06:	89 df                	mov    %ebx,%edi
+  801f08:	55                   	push   %ebp
+  801f09:	89 e5                	mov    %esp,%ebp
+  801f0b:	8d 35 13 1f 80 00    	lea    0x801f13,%esi
+  801f11:	0f 34                	sysenter
+  801f13:	5d                   	pop    %ebp
+		goto out;
+  801f14:	eb db                	jmp    801ef1 <sys_sb16_play+0x25>
+
+00801f16 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801f16:	55                   	push   %ebp
+  801f17:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f21:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801f24:	5d                   	pop    %ebp
+  801f25:	c3                   	ret
+
+00801f26 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801f26:	55                   	push   %ebp
+  801f27:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801f31:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f36:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801f3b:	5d                   	pop    %ebp
+  801f3c:	c3                   	ret
+
+00801f3d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801f3d:	55                   	push   %ebp
+  801f3e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801f40:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801f45:	eb 02                	jmp    801f49 <fd_alloc+0xc>
+  801f47:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801f49:	89 c2                	mov    %eax,%edx
+  801f4b:	c1 ea 16             	shr    $0x16,%edx
+  801f4e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f55:	f6 c2 01             	test   $0x1,%dl
+  801f58:	74 2b                	je     801f85 <fd_alloc+0x48>
+  801f5a:	89 c2                	mov    %eax,%edx
+  801f5c:	c1 ea 0c             	shr    $0xc,%edx
+  801f5f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801f66:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801f6c:	f6 c1 01             	test   $0x1,%cl
+  801f6f:	74 14                	je     801f85 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801f71:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801f77:	75 ce                	jne    801f47 <fd_alloc+0xa>
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801f7e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801f83:	eb 05                	jmp    801f8a <fd_alloc+0x4d>
+			return 0;
+  801f85:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f8d:	89 02                	mov    %eax,(%edx)
+}
+  801f8f:	89 c8                	mov    %ecx,%eax
+  801f91:	5d                   	pop    %ebp
+  801f92:	c3                   	ret
+
+00801f93 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801f93:	55                   	push   %ebp
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801f99:	83 f8 1f             	cmp    $0x1f,%eax
+  801f9c:	77 30                	ja     801fce <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801f9e:	c1 e0 0c             	shl    $0xc,%eax
+  801fa1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801fa6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801fac:	f6 c2 01             	test   $0x1,%dl
+  801faf:	74 24                	je     801fd5 <fd_lookup+0x42>
+  801fb1:	89 c2                	mov    %eax,%edx
+  801fb3:	c1 ea 0c             	shr    $0xc,%edx
+  801fb6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801fbd:	f6 c2 01             	test   $0x1,%dl
+  801fc0:	74 1a                	je     801fdc <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801fc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fc5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fcc:	5d                   	pop    %ebp
+  801fcd:	c3                   	ret
+		return -E_INVAL;
+  801fce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fd3:	eb f7                	jmp    801fcc <fd_lookup+0x39>
+		return -E_INVAL;
+  801fd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fda:	eb f0                	jmp    801fcc <fd_lookup+0x39>
+  801fdc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe1:	eb e9                	jmp    801fcc <fd_lookup+0x39>
+
+00801fe3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	53                   	push   %ebx
+  801fe7:	83 ec 04             	sub    $0x4,%esp
+  801fea:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801fed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff2:	eb 03                	jmp    801ff7 <dev_lookup+0x14>
+  801ff4:	83 c0 01             	add    $0x1,%eax
+  801ff7:	8b 1c 85 94 3b 80 00 	mov    0x803b94(,%eax,4),%ebx
+  801ffe:	85 db                	test   %ebx,%ebx
+  802000:	74 0b                	je     80200d <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802002:	39 13                	cmp    %edx,(%ebx)
+  802004:	75 ee                	jne    801ff4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802006:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200b:	eb 2e                	jmp    80203b <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80200d:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80200f:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  802014:	8b 0d 1c 50 80 00    	mov    0x80501c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80201a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80201f:	76 24                	jbe    802045 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802021:	8b 41 48             	mov    0x48(%ecx),%eax
+  802024:	83 ec 04             	sub    $0x4,%esp
+  802027:	52                   	push   %edx
+  802028:	50                   	push   %eax
+  802029:	68 18 3b 80 00       	push   $0x803b18
+  80202e:	e8 2d e9 ff ff       	call   800960 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802033:	83 c4 10             	add    $0x10,%esp
+  802036:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80203b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80203e:	89 1a                	mov    %ebx,(%edx)
+}
+  802040:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802043:	c9                   	leave
+  802044:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802045:	c1 e8 10             	shr    $0x10,%eax
+  802048:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80204e:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802054:	eb cb                	jmp    802021 <dev_lookup+0x3e>
+
+00802056 <fd_close>:
+{
+  802056:	55                   	push   %ebp
+  802057:	89 e5                	mov    %esp,%ebp
+  802059:	57                   	push   %edi
+  80205a:	56                   	push   %esi
+  80205b:	53                   	push   %ebx
+  80205c:	83 ec 24             	sub    $0x24,%esp
+  80205f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802062:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802065:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802068:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802069:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80206f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802072:	50                   	push   %eax
+  802073:	e8 1b ff ff ff       	call   801f93 <fd_lookup>
+  802078:	89 c3                	mov    %eax,%ebx
+  80207a:	83 c4 10             	add    $0x10,%esp
+  80207d:	85 c0                	test   %eax,%eax
+  80207f:	78 05                	js     802086 <fd_close+0x30>
+	    || fd != fd2)
+  802081:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802084:	74 16                	je     80209c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802086:	89 f8                	mov    %edi,%eax
+  802088:	84 c0                	test   %al,%al
+  80208a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802092:	89 d8                	mov    %ebx,%eax
+  802094:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802097:	5b                   	pop    %ebx
+  802098:	5e                   	pop    %esi
+  802099:	5f                   	pop    %edi
+  80209a:	5d                   	pop    %ebp
+  80209b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80209c:	83 ec 08             	sub    $0x8,%esp
+  80209f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8020a2:	50                   	push   %eax
+  8020a3:	ff 36                	push   (%esi)
+  8020a5:	e8 39 ff ff ff       	call   801fe3 <dev_lookup>
+  8020aa:	89 c3                	mov    %eax,%ebx
+  8020ac:	83 c4 10             	add    $0x10,%esp
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	78 1a                	js     8020cd <fd_close+0x77>
+		if (dev->dev_close)
+  8020b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020b6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8020b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	74 0b                	je     8020cd <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8020c2:	83 ec 0c             	sub    $0xc,%esp
+  8020c5:	56                   	push   %esi
+  8020c6:	ff d0                	call   *%eax
+  8020c8:	89 c3                	mov    %eax,%ebx
+  8020ca:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8020cd:	83 ec 08             	sub    $0x8,%esp
+  8020d0:	56                   	push   %esi
+  8020d1:	6a 00                	push   $0x0
+  8020d3:	e8 a3 f4 ff ff       	call   80157b <sys_page_unmap>
+	return r;
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	eb b5                	jmp    802092 <fd_close+0x3c>
+
+008020dd <close>:
+
+int
+close(int fdnum)
+{
+  8020dd:	55                   	push   %ebp
+  8020de:	89 e5                	mov    %esp,%ebp
+  8020e0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e6:	50                   	push   %eax
+  8020e7:	ff 75 08             	push   0x8(%ebp)
+  8020ea:	e8 a4 fe ff ff       	call   801f93 <fd_lookup>
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	79 02                	jns    8020f8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8020f6:	c9                   	leave
+  8020f7:	c3                   	ret
+		return fd_close(fd, 1);
+  8020f8:	83 ec 08             	sub    $0x8,%esp
+  8020fb:	6a 01                	push   $0x1
+  8020fd:	ff 75 f4             	push   -0xc(%ebp)
+  802100:	e8 51 ff ff ff       	call   802056 <fd_close>
+  802105:	83 c4 10             	add    $0x10,%esp
+  802108:	eb ec                	jmp    8020f6 <close+0x19>
+
+0080210a <close_all>:
+
+void
+close_all(void)
+{
+  80210a:	55                   	push   %ebp
+  80210b:	89 e5                	mov    %esp,%ebp
+  80210d:	53                   	push   %ebx
+  80210e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802111:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802116:	83 ec 0c             	sub    $0xc,%esp
+  802119:	53                   	push   %ebx
+  80211a:	e8 be ff ff ff       	call   8020dd <close>
+	for (i = 0; i < MAXFD; i++)
+  80211f:	83 c3 01             	add    $0x1,%ebx
+  802122:	83 c4 10             	add    $0x10,%esp
+  802125:	83 fb 20             	cmp    $0x20,%ebx
+  802128:	75 ec                	jne    802116 <close_all+0xc>
+}
+  80212a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80212d:	c9                   	leave
+  80212e:	c3                   	ret
+
+0080212f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80212f:	55                   	push   %ebp
+  802130:	89 e5                	mov    %esp,%ebp
+  802132:	57                   	push   %edi
+  802133:	56                   	push   %esi
+  802134:	53                   	push   %ebx
+  802135:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802138:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80213b:	50                   	push   %eax
+  80213c:	ff 75 08             	push   0x8(%ebp)
+  80213f:	e8 4f fe ff ff       	call   801f93 <fd_lookup>
+  802144:	89 c3                	mov    %eax,%ebx
+  802146:	83 c4 10             	add    $0x10,%esp
+  802149:	85 c0                	test   %eax,%eax
+  80214b:	78 7f                	js     8021cc <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80214d:	83 ec 0c             	sub    $0xc,%esp
+  802150:	ff 75 0c             	push   0xc(%ebp)
+  802153:	e8 85 ff ff ff       	call   8020dd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802158:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80215b:	c1 e6 0c             	shl    $0xc,%esi
+  80215e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802164:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802167:	89 3c 24             	mov    %edi,(%esp)
+  80216a:	e8 b7 fd ff ff       	call   801f26 <fd2data>
+  80216f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802171:	89 34 24             	mov    %esi,(%esp)
+  802174:	e8 ad fd ff ff       	call   801f26 <fd2data>
+  802179:	83 c4 10             	add    $0x10,%esp
+  80217c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80217f:	89 d8                	mov    %ebx,%eax
+  802181:	c1 e8 16             	shr    $0x16,%eax
+  802184:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80218b:	a8 01                	test   $0x1,%al
+  80218d:	74 11                	je     8021a0 <dup+0x71>
+  80218f:	89 d8                	mov    %ebx,%eax
+  802191:	c1 e8 0c             	shr    $0xc,%eax
+  802194:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80219b:	f6 c2 01             	test   $0x1,%dl
+  80219e:	75 36                	jne    8021d6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8021a0:	89 f8                	mov    %edi,%eax
+  8021a2:	c1 e8 0c             	shr    $0xc,%eax
+  8021a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021ac:	83 ec 0c             	sub    $0xc,%esp
+  8021af:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021b4:	50                   	push   %eax
+  8021b5:	56                   	push   %esi
+  8021b6:	6a 00                	push   $0x0
+  8021b8:	57                   	push   %edi
+  8021b9:	6a 00                	push   $0x0
+  8021bb:	e8 4d f3 ff ff       	call   80150d <sys_page_map>
+  8021c0:	89 c3                	mov    %eax,%ebx
+  8021c2:	83 c4 20             	add    $0x20,%esp
+  8021c5:	85 c0                	test   %eax,%eax
+  8021c7:	78 33                	js     8021fc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8021c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8021cc:	89 d8                	mov    %ebx,%eax
+  8021ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d1:	5b                   	pop    %ebx
+  8021d2:	5e                   	pop    %esi
+  8021d3:	5f                   	pop    %edi
+  8021d4:	5d                   	pop    %ebp
+  8021d5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8021d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021dd:	83 ec 0c             	sub    $0xc,%esp
+  8021e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021e5:	50                   	push   %eax
+  8021e6:	ff 75 d4             	push   -0x2c(%ebp)
+  8021e9:	6a 00                	push   $0x0
+  8021eb:	53                   	push   %ebx
+  8021ec:	6a 00                	push   $0x0
+  8021ee:	e8 1a f3 ff ff       	call   80150d <sys_page_map>
+  8021f3:	89 c3                	mov    %eax,%ebx
+  8021f5:	83 c4 20             	add    $0x20,%esp
+  8021f8:	85 c0                	test   %eax,%eax
+  8021fa:	79 a4                	jns    8021a0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8021fc:	83 ec 08             	sub    $0x8,%esp
+  8021ff:	56                   	push   %esi
+  802200:	6a 00                	push   $0x0
+  802202:	e8 74 f3 ff ff       	call   80157b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802207:	83 c4 08             	add    $0x8,%esp
+  80220a:	ff 75 d4             	push   -0x2c(%ebp)
+  80220d:	6a 00                	push   $0x0
+  80220f:	e8 67 f3 ff ff       	call   80157b <sys_page_unmap>
+	return r;
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	eb b3                	jmp    8021cc <dup+0x9d>
+
+00802219 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802219:	55                   	push   %ebp
+  80221a:	89 e5                	mov    %esp,%ebp
+  80221c:	56                   	push   %esi
+  80221d:	53                   	push   %ebx
+  80221e:	83 ec 18             	sub    $0x18,%esp
+  802221:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802224:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802227:	50                   	push   %eax
+  802228:	53                   	push   %ebx
+  802229:	e8 65 fd ff ff       	call   801f93 <fd_lookup>
+  80222e:	83 c4 10             	add    $0x10,%esp
+  802231:	85 c0                	test   %eax,%eax
+  802233:	78 3c                	js     802271 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802235:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802238:	83 ec 08             	sub    $0x8,%esp
+  80223b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80223e:	50                   	push   %eax
+  80223f:	ff 36                	push   (%esi)
+  802241:	e8 9d fd ff ff       	call   801fe3 <dev_lookup>
+  802246:	83 c4 10             	add    $0x10,%esp
+  802249:	85 c0                	test   %eax,%eax
+  80224b:	78 24                	js     802271 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80224d:	8b 46 08             	mov    0x8(%esi),%eax
+  802250:	83 e0 03             	and    $0x3,%eax
+  802253:	83 f8 01             	cmp    $0x1,%eax
+  802256:	74 20                	je     802278 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80225b:	8b 40 08             	mov    0x8(%eax),%eax
+  80225e:	85 c0                	test   %eax,%eax
+  802260:	74 57                	je     8022b9 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802262:	83 ec 04             	sub    $0x4,%esp
+  802265:	ff 75 10             	push   0x10(%ebp)
+  802268:	ff 75 0c             	push   0xc(%ebp)
+  80226b:	56                   	push   %esi
+  80226c:	ff d0                	call   *%eax
+  80226e:	83 c4 10             	add    $0x10,%esp
+}
+  802271:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802274:	5b                   	pop    %ebx
+  802275:	5e                   	pop    %esi
+  802276:	5d                   	pop    %ebp
+  802277:	c3                   	ret
+  802278:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80227a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80227f:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802285:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80228a:	76 1c                	jbe    8022a8 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80228c:	8b 42 48             	mov    0x48(%edx),%eax
+  80228f:	83 ec 04             	sub    $0x4,%esp
+  802292:	53                   	push   %ebx
+  802293:	50                   	push   %eax
+  802294:	68 59 3b 80 00       	push   $0x803b59
+  802299:	e8 c2 e6 ff ff       	call   800960 <cprintf>
+		return -E_INVAL;
+  80229e:	83 c4 10             	add    $0x10,%esp
+  8022a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a6:	eb c9                	jmp    802271 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8022a8:	c1 e8 10             	shr    $0x10,%eax
+  8022ab:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8022b1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8022b7:	eb d3                	jmp    80228c <read+0x73>
+		return -E_NOT_SUPP;
+  8022b9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022be:	eb b1                	jmp    802271 <read+0x58>
+
+008022c0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8022c0:	55                   	push   %ebp
+  8022c1:	89 e5                	mov    %esp,%ebp
+  8022c3:	57                   	push   %edi
+  8022c4:	56                   	push   %esi
+  8022c5:	53                   	push   %ebx
+  8022c6:	83 ec 0c             	sub    $0xc,%esp
+  8022c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022cc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8022cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022d4:	eb 02                	jmp    8022d8 <readn+0x18>
+  8022d6:	01 c3                	add    %eax,%ebx
+  8022d8:	39 f3                	cmp    %esi,%ebx
+  8022da:	73 21                	jae    8022fd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8022dc:	83 ec 04             	sub    $0x4,%esp
+  8022df:	89 f0                	mov    %esi,%eax
+  8022e1:	29 d8                	sub    %ebx,%eax
+  8022e3:	50                   	push   %eax
+  8022e4:	89 d8                	mov    %ebx,%eax
+  8022e6:	03 45 0c             	add    0xc(%ebp),%eax
+  8022e9:	50                   	push   %eax
+  8022ea:	57                   	push   %edi
+  8022eb:	e8 29 ff ff ff       	call   802219 <read>
+		if (m < 0)
+  8022f0:	83 c4 10             	add    $0x10,%esp
+  8022f3:	85 c0                	test   %eax,%eax
+  8022f5:	78 04                	js     8022fb <readn+0x3b>
+			return m;
+		if (m == 0)
+  8022f7:	75 dd                	jne    8022d6 <readn+0x16>
+  8022f9:	eb 02                	jmp    8022fd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8022fb:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8022fd:	89 d8                	mov    %ebx,%eax
+  8022ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802302:	5b                   	pop    %ebx
+  802303:	5e                   	pop    %esi
+  802304:	5f                   	pop    %edi
+  802305:	5d                   	pop    %ebp
+  802306:	c3                   	ret
+
+00802307 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802307:	55                   	push   %ebp
+  802308:	89 e5                	mov    %esp,%ebp
+  80230a:	56                   	push   %esi
+  80230b:	53                   	push   %ebx
+  80230c:	83 ec 18             	sub    $0x18,%esp
+  80230f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802312:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802315:	50                   	push   %eax
+  802316:	53                   	push   %ebx
+  802317:	e8 77 fc ff ff       	call   801f93 <fd_lookup>
+  80231c:	83 c4 10             	add    $0x10,%esp
+  80231f:	85 c0                	test   %eax,%eax
+  802321:	78 37                	js     80235a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802323:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802326:	83 ec 08             	sub    $0x8,%esp
+  802329:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80232c:	50                   	push   %eax
+  80232d:	ff 36                	push   (%esi)
+  80232f:	e8 af fc ff ff       	call   801fe3 <dev_lookup>
+  802334:	83 c4 10             	add    $0x10,%esp
+  802337:	85 c0                	test   %eax,%eax
+  802339:	78 1f                	js     80235a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80233b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80233f:	74 20                	je     802361 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802341:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802344:	8b 40 0c             	mov    0xc(%eax),%eax
+  802347:	85 c0                	test   %eax,%eax
+  802349:	74 57                	je     8023a2 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80234b:	83 ec 04             	sub    $0x4,%esp
+  80234e:	ff 75 10             	push   0x10(%ebp)
+  802351:	ff 75 0c             	push   0xc(%ebp)
+  802354:	56                   	push   %esi
+  802355:	ff d0                	call   *%eax
+  802357:	83 c4 10             	add    $0x10,%esp
+}
+  80235a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80235d:	5b                   	pop    %ebx
+  80235e:	5e                   	pop    %esi
+  80235f:	5d                   	pop    %ebp
+  802360:	c3                   	ret
+  802361:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802363:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802368:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80236e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802373:	76 1c                	jbe    802391 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802375:	8b 42 48             	mov    0x48(%edx),%eax
+  802378:	83 ec 04             	sub    $0x4,%esp
+  80237b:	53                   	push   %ebx
+  80237c:	50                   	push   %eax
+  80237d:	68 75 3b 80 00       	push   $0x803b75
+  802382:	e8 d9 e5 ff ff       	call   800960 <cprintf>
+		return -E_INVAL;
+  802387:	83 c4 10             	add    $0x10,%esp
+  80238a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80238f:	eb c9                	jmp    80235a <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802391:	c1 e8 10             	shr    $0x10,%eax
+  802394:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80239a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8023a0:	eb d3                	jmp    802375 <write+0x6e>
+		return -E_NOT_SUPP;
+  8023a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023a7:	eb b1                	jmp    80235a <write+0x53>
+
+008023a9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8023a9:	55                   	push   %ebp
+  8023aa:	89 e5                	mov    %esp,%ebp
+  8023ac:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023b2:	50                   	push   %eax
+  8023b3:	ff 75 08             	push   0x8(%ebp)
+  8023b6:	e8 d8 fb ff ff       	call   801f93 <fd_lookup>
+  8023bb:	83 c4 10             	add    $0x10,%esp
+  8023be:	85 c0                	test   %eax,%eax
+  8023c0:	78 0e                	js     8023d0 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8023c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8023cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d0:	c9                   	leave
+  8023d1:	c3                   	ret
+
+008023d2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8023d2:	55                   	push   %ebp
+  8023d3:	89 e5                	mov    %esp,%ebp
+  8023d5:	56                   	push   %esi
+  8023d6:	53                   	push   %ebx
+  8023d7:	83 ec 18             	sub    $0x18,%esp
+  8023da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8023dd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023e0:	50                   	push   %eax
+  8023e1:	53                   	push   %ebx
+  8023e2:	e8 ac fb ff ff       	call   801f93 <fd_lookup>
+  8023e7:	83 c4 10             	add    $0x10,%esp
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	78 34                	js     802422 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023ee:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023f1:	83 ec 08             	sub    $0x8,%esp
+  8023f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023f7:	50                   	push   %eax
+  8023f8:	ff 36                	push   (%esi)
+  8023fa:	e8 e4 fb ff ff       	call   801fe3 <dev_lookup>
+  8023ff:	83 c4 10             	add    $0x10,%esp
+  802402:	85 c0                	test   %eax,%eax
+  802404:	78 1c                	js     802422 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802406:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80240a:	74 1d                	je     802429 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80240c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80240f:	8b 40 18             	mov    0x18(%eax),%eax
+  802412:	85 c0                	test   %eax,%eax
+  802414:	74 54                	je     80246a <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802416:	83 ec 08             	sub    $0x8,%esp
+  802419:	ff 75 0c             	push   0xc(%ebp)
+  80241c:	56                   	push   %esi
+  80241d:	ff d0                	call   *%eax
+  80241f:	83 c4 10             	add    $0x10,%esp
+}
+  802422:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802425:	5b                   	pop    %ebx
+  802426:	5e                   	pop    %esi
+  802427:	5d                   	pop    %ebp
+  802428:	c3                   	ret
+  802429:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80242b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802430:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802436:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80243b:	76 1c                	jbe    802459 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  80243d:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802440:	83 ec 04             	sub    $0x4,%esp
+  802443:	53                   	push   %ebx
+  802444:	50                   	push   %eax
+  802445:	68 38 3b 80 00       	push   $0x803b38
+  80244a:	e8 11 e5 ff ff       	call   800960 <cprintf>
+		return -E_INVAL;
+  80244f:	83 c4 10             	add    $0x10,%esp
+  802452:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802457:	eb c9                	jmp    802422 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802459:	c1 e8 10             	shr    $0x10,%eax
+  80245c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802462:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802468:	eb d3                	jmp    80243d <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  80246a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80246f:	eb b1                	jmp    802422 <ftruncate+0x50>
+
+00802471 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802471:	55                   	push   %ebp
+  802472:	89 e5                	mov    %esp,%ebp
+  802474:	56                   	push   %esi
+  802475:	53                   	push   %ebx
+  802476:	83 ec 18             	sub    $0x18,%esp
+  802479:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80247c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80247f:	50                   	push   %eax
+  802480:	ff 75 08             	push   0x8(%ebp)
+  802483:	e8 0b fb ff ff       	call   801f93 <fd_lookup>
+  802488:	83 c4 10             	add    $0x10,%esp
+  80248b:	85 c0                	test   %eax,%eax
+  80248d:	78 49                	js     8024d8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80248f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802492:	83 ec 08             	sub    $0x8,%esp
+  802495:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802498:	50                   	push   %eax
+  802499:	ff 36                	push   (%esi)
+  80249b:	e8 43 fb ff ff       	call   801fe3 <dev_lookup>
+  8024a0:	83 c4 10             	add    $0x10,%esp
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	78 31                	js     8024d8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8024a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024aa:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8024ae:	74 2f                	je     8024df <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8024b0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8024b3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8024ba:	00 00 00 
+	stat->st_isdir = 0;
+  8024bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024c4:	00 00 00 
+	stat->st_dev = dev;
+  8024c7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8024cd:	83 ec 08             	sub    $0x8,%esp
+  8024d0:	53                   	push   %ebx
+  8024d1:	56                   	push   %esi
+  8024d2:	ff 50 14             	call   *0x14(%eax)
+  8024d5:	83 c4 10             	add    $0x10,%esp
+}
+  8024d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024db:	5b                   	pop    %ebx
+  8024dc:	5e                   	pop    %esi
+  8024dd:	5d                   	pop    %ebp
+  8024de:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024e4:	eb f2                	jmp    8024d8 <fstat+0x67>
+
+008024e6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8024e6:	55                   	push   %ebp
+  8024e7:	89 e5                	mov    %esp,%ebp
+  8024e9:	56                   	push   %esi
+  8024ea:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8024eb:	83 ec 08             	sub    $0x8,%esp
+  8024ee:	6a 00                	push   $0x0
+  8024f0:	ff 75 08             	push   0x8(%ebp)
+  8024f3:	e8 e4 01 00 00       	call   8026dc <open>
+  8024f8:	89 c3                	mov    %eax,%ebx
+  8024fa:	83 c4 10             	add    $0x10,%esp
+  8024fd:	85 c0                	test   %eax,%eax
+  8024ff:	78 1b                	js     80251c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802501:	83 ec 08             	sub    $0x8,%esp
+  802504:	ff 75 0c             	push   0xc(%ebp)
+  802507:	50                   	push   %eax
+  802508:	e8 64 ff ff ff       	call   802471 <fstat>
+  80250d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80250f:	89 1c 24             	mov    %ebx,(%esp)
+  802512:	e8 c6 fb ff ff       	call   8020dd <close>
+	return r;
+  802517:	83 c4 10             	add    $0x10,%esp
+  80251a:	89 f3                	mov    %esi,%ebx
+}
+  80251c:	89 d8                	mov    %ebx,%eax
+  80251e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802521:	5b                   	pop    %ebx
+  802522:	5e                   	pop    %esi
+  802523:	5d                   	pop    %ebp
+  802524:	c3                   	ret
+
+00802525 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802525:	55                   	push   %ebp
+  802526:	89 e5                	mov    %esp,%ebp
+  802528:	56                   	push   %esi
+  802529:	53                   	push   %ebx
+  80252a:	89 c6                	mov    %eax,%esi
+  80252c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80252e:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  802535:	74 27                	je     80255e <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802537:	6a 07                	push   $0x7
+  802539:	68 00 60 80 00       	push   $0x806000
+  80253e:	56                   	push   %esi
+  80253f:	ff 35 10 50 80 00    	push   0x805010
+  802545:	e8 2e 0f 00 00       	call   803478 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80254a:	83 c4 0c             	add    $0xc,%esp
+  80254d:	6a 00                	push   $0x0
+  80254f:	53                   	push   %ebx
+  802550:	6a 00                	push   $0x0
+  802552:	e8 09 0f 00 00       	call   803460 <ipc_recv>
+}
+  802557:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80255a:	5b                   	pop    %ebx
+  80255b:	5e                   	pop    %esi
+  80255c:	5d                   	pop    %ebp
+  80255d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80255e:	83 ec 0c             	sub    $0xc,%esp
+  802561:	6a 01                	push   $0x1
+  802563:	e8 64 0f 00 00       	call   8034cc <ipc_find_env>
+  802568:	a3 10 50 80 00       	mov    %eax,0x805010
+  80256d:	83 c4 10             	add    $0x10,%esp
+  802570:	eb c5                	jmp    802537 <fsipc+0x12>
+
+00802572 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802572:	55                   	push   %ebp
+  802573:	89 e5                	mov    %esp,%ebp
+  802575:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802578:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80257e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802583:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802586:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80258b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802590:	b8 02 00 00 00       	mov    $0x2,%eax
+  802595:	e8 8b ff ff ff       	call   802525 <fsipc>
+}
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+
+0080259c <devfile_flush>:
+{
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8025a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025a8:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8025ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025b7:	e8 69 ff ff ff       	call   802525 <fsipc>
+}
+  8025bc:	c9                   	leave
+  8025bd:	c3                   	ret
+
+008025be <devfile_stat>:
+{
+  8025be:	55                   	push   %ebp
+  8025bf:	89 e5                	mov    %esp,%ebp
+  8025c1:	53                   	push   %ebx
+  8025c2:	83 ec 04             	sub    $0x4,%esp
+  8025c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8025c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025cb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025ce:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8025d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025dd:	e8 43 ff ff ff       	call   802525 <fsipc>
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	78 2c                	js     802612 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8025e6:	83 ec 08             	sub    $0x8,%esp
+  8025e9:	68 00 60 80 00       	push   $0x806000
+  8025ee:	53                   	push   %ebx
+  8025ef:	e8 b4 e9 ff ff       	call   800fa8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8025f4:	a1 80 60 80 00       	mov    0x806080,%eax
+  8025f9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8025ff:	a1 84 60 80 00       	mov    0x806084,%eax
+  802604:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80260a:	83 c4 10             	add    $0x10,%esp
+  80260d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802612:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802615:	c9                   	leave
+  802616:	c3                   	ret
+
+00802617 <devfile_write>:
+{
+  802617:	55                   	push   %ebp
+  802618:	89 e5                	mov    %esp,%ebp
+  80261a:	83 ec 0c             	sub    $0xc,%esp
+  80261d:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802620:	8b 55 08             	mov    0x8(%ebp),%edx
+  802623:	8b 52 0c             	mov    0xc(%edx),%edx
+  802626:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  80262c:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  802631:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802636:	39 d0                	cmp    %edx,%eax
+  802638:	0f 47 c2             	cmova  %edx,%eax
+  80263b:	50                   	push   %eax
+  80263c:	ff 75 0c             	push   0xc(%ebp)
+  80263f:	68 08 60 80 00       	push   $0x806008
+  802644:	e8 e5 ea ff ff       	call   80112e <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802649:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802653:	e8 cd fe ff ff       	call   802525 <fsipc>
+}
+  802658:	c9                   	leave
+  802659:	c3                   	ret
+
+0080265a <devfile_read>:
+{
+  80265a:	55                   	push   %ebp
+  80265b:	89 e5                	mov    %esp,%ebp
+  80265d:	56                   	push   %esi
+  80265e:	53                   	push   %ebx
+  80265f:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802662:	8b 45 08             	mov    0x8(%ebp),%eax
+  802665:	8b 40 0c             	mov    0xc(%eax),%eax
+  802668:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80266d:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802673:	ba 00 00 00 00       	mov    $0x0,%edx
+  802678:	b8 03 00 00 00       	mov    $0x3,%eax
+  80267d:	e8 a3 fe ff ff       	call   802525 <fsipc>
+  802682:	89 c3                	mov    %eax,%ebx
+  802684:	85 c0                	test   %eax,%eax
+  802686:	78 1f                	js     8026a7 <devfile_read+0x4d>
+	assert(r <= n);
+  802688:	39 c6                	cmp    %eax,%esi
+  80268a:	72 24                	jb     8026b0 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80268c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802691:	7f 33                	jg     8026c6 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802693:	83 ec 04             	sub    $0x4,%esp
+  802696:	50                   	push   %eax
+  802697:	68 00 60 80 00       	push   $0x806000
+  80269c:	ff 75 0c             	push   0xc(%ebp)
+  80269f:	e8 8a ea ff ff       	call   80112e <memmove>
+	return r;
+  8026a4:	83 c4 10             	add    $0x10,%esp
+}
+  8026a7:	89 d8                	mov    %ebx,%eax
+  8026a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ac:	5b                   	pop    %ebx
+  8026ad:	5e                   	pop    %esi
+  8026ae:	5d                   	pop    %ebp
+  8026af:	c3                   	ret
+	assert(r <= n);
+  8026b0:	68 a8 3b 80 00       	push   $0x803ba8
+  8026b5:	68 af 3b 80 00       	push   $0x803baf
+  8026ba:	6a 76                	push   $0x76
+  8026bc:	68 c4 3b 80 00       	push   $0x803bc4
+  8026c1:	e8 bf e1 ff ff       	call   800885 <_panic>
+	assert(r <= PGSIZE);
+  8026c6:	68 cf 3b 80 00       	push   $0x803bcf
+  8026cb:	68 af 3b 80 00       	push   $0x803baf
+  8026d0:	6a 77                	push   $0x77
+  8026d2:	68 c4 3b 80 00       	push   $0x803bc4
+  8026d7:	e8 a9 e1 ff ff       	call   800885 <_panic>
+
+008026dc <open>:
+{
+  8026dc:	55                   	push   %ebp
+  8026dd:	89 e5                	mov    %esp,%ebp
+  8026df:	56                   	push   %esi
+  8026e0:	53                   	push   %ebx
+  8026e1:	83 ec 1c             	sub    $0x1c,%esp
+  8026e4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8026e7:	56                   	push   %esi
+  8026e8:	e8 80 e8 ff ff       	call   800f6d <strlen>
+  8026ed:	83 c4 10             	add    $0x10,%esp
+  8026f0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026f5:	7f 6c                	jg     802763 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8026f7:	83 ec 0c             	sub    $0xc,%esp
+  8026fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026fd:	50                   	push   %eax
+  8026fe:	e8 3a f8 ff ff       	call   801f3d <fd_alloc>
+  802703:	89 c3                	mov    %eax,%ebx
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	78 3c                	js     802748 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80270c:	83 ec 08             	sub    $0x8,%esp
+  80270f:	56                   	push   %esi
+  802710:	68 00 60 80 00       	push   $0x806000
+  802715:	e8 8e e8 ff ff       	call   800fa8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80271a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80271d:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802722:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802725:	b8 01 00 00 00       	mov    $0x1,%eax
+  80272a:	e8 f6 fd ff ff       	call   802525 <fsipc>
+  80272f:	89 c3                	mov    %eax,%ebx
+  802731:	83 c4 10             	add    $0x10,%esp
+  802734:	85 c0                	test   %eax,%eax
+  802736:	78 19                	js     802751 <open+0x75>
+	return fd2num(fd);
+  802738:	83 ec 0c             	sub    $0xc,%esp
+  80273b:	ff 75 f4             	push   -0xc(%ebp)
+  80273e:	e8 d3 f7 ff ff       	call   801f16 <fd2num>
+  802743:	89 c3                	mov    %eax,%ebx
+  802745:	83 c4 10             	add    $0x10,%esp
+}
+  802748:	89 d8                	mov    %ebx,%eax
+  80274a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80274d:	5b                   	pop    %ebx
+  80274e:	5e                   	pop    %esi
+  80274f:	5d                   	pop    %ebp
+  802750:	c3                   	ret
+		fd_close(fd, 0);
+  802751:	83 ec 08             	sub    $0x8,%esp
+  802754:	6a 00                	push   $0x0
+  802756:	ff 75 f4             	push   -0xc(%ebp)
+  802759:	e8 f8 f8 ff ff       	call   802056 <fd_close>
+		return r;
+  80275e:	83 c4 10             	add    $0x10,%esp
+  802761:	eb e5                	jmp    802748 <open+0x6c>
+		return -E_BAD_PATH;
+  802763:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802768:	eb de                	jmp    802748 <open+0x6c>
+
+0080276a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80276a:	55                   	push   %ebp
+  80276b:	89 e5                	mov    %esp,%ebp
+  80276d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802770:	ba 00 00 00 00       	mov    $0x0,%edx
+  802775:	b8 08 00 00 00       	mov    $0x8,%eax
+  80277a:	e8 a6 fd ff ff       	call   802525 <fsipc>
+}
+  80277f:	c9                   	leave
+  802780:	c3                   	ret
+
+00802781 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802781:	55                   	push   %ebp
+  802782:	89 e5                	mov    %esp,%ebp
+  802784:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802787:	68 db 3b 80 00       	push   $0x803bdb
+  80278c:	ff 75 0c             	push   0xc(%ebp)
+  80278f:	e8 14 e8 ff ff       	call   800fa8 <strcpy>
+	return 0;
+}
+  802794:	b8 00 00 00 00       	mov    $0x0,%eax
+  802799:	c9                   	leave
+  80279a:	c3                   	ret
+
+0080279b <devsock_close>:
+{
+  80279b:	55                   	push   %ebp
+  80279c:	89 e5                	mov    %esp,%ebp
+  80279e:	53                   	push   %ebx
+  80279f:	83 ec 10             	sub    $0x10,%esp
+  8027a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027a5:	53                   	push   %ebx
+  8027a6:	e8 60 0d 00 00       	call   80350b <pageref>
+  8027ab:	89 c2                	mov    %eax,%edx
+  8027ad:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027b0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027b5:	83 fa 01             	cmp    $0x1,%edx
+  8027b8:	74 05                	je     8027bf <devsock_close+0x24>
+}
+  8027ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027bd:	c9                   	leave
+  8027be:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027bf:	83 ec 0c             	sub    $0xc,%esp
+  8027c2:	ff 73 0c             	push   0xc(%ebx)
+  8027c5:	e8 b7 02 00 00       	call   802a81 <nsipc_close>
+  8027ca:	83 c4 10             	add    $0x10,%esp
+  8027cd:	eb eb                	jmp    8027ba <devsock_close+0x1f>
+
+008027cf <devsock_write>:
+{
+  8027cf:	55                   	push   %ebp
+  8027d0:	89 e5                	mov    %esp,%ebp
+  8027d2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8027d5:	6a 00                	push   $0x0
+  8027d7:	ff 75 10             	push   0x10(%ebp)
+  8027da:	ff 75 0c             	push   0xc(%ebp)
+  8027dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e0:	ff 70 0c             	push   0xc(%eax)
+  8027e3:	e8 79 03 00 00       	call   802b61 <nsipc_send>
+}
+  8027e8:	c9                   	leave
+  8027e9:	c3                   	ret
+
+008027ea <devsock_read>:
+{
+  8027ea:	55                   	push   %ebp
+  8027eb:	89 e5                	mov    %esp,%ebp
+  8027ed:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8027f0:	6a 00                	push   $0x0
+  8027f2:	ff 75 10             	push   0x10(%ebp)
+  8027f5:	ff 75 0c             	push   0xc(%ebp)
+  8027f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027fb:	ff 70 0c             	push   0xc(%eax)
+  8027fe:	e8 ef 02 00 00       	call   802af2 <nsipc_recv>
+}
+  802803:	c9                   	leave
+  802804:	c3                   	ret
+
+00802805 <fd2sockid>:
+{
+  802805:	55                   	push   %ebp
+  802806:	89 e5                	mov    %esp,%ebp
+  802808:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80280b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80280e:	52                   	push   %edx
+  80280f:	50                   	push   %eax
+  802810:	e8 7e f7 ff ff       	call   801f93 <fd_lookup>
+  802815:	83 c4 10             	add    $0x10,%esp
+  802818:	85 c0                	test   %eax,%eax
+  80281a:	78 10                	js     80282c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80281c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281f:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802825:	39 08                	cmp    %ecx,(%eax)
+  802827:	75 05                	jne    80282e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802829:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80282e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802833:	eb f7                	jmp    80282c <fd2sockid+0x27>
+
+00802835 <alloc_sockfd>:
+{
+  802835:	55                   	push   %ebp
+  802836:	89 e5                	mov    %esp,%ebp
+  802838:	56                   	push   %esi
+  802839:	53                   	push   %ebx
+  80283a:	83 ec 1c             	sub    $0x1c,%esp
+  80283d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80283f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802842:	50                   	push   %eax
+  802843:	e8 f5 f6 ff ff       	call   801f3d <fd_alloc>
+  802848:	89 c3                	mov    %eax,%ebx
+  80284a:	83 c4 10             	add    $0x10,%esp
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	78 43                	js     802894 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802851:	83 ec 04             	sub    $0x4,%esp
+  802854:	68 07 04 00 00       	push   $0x407
+  802859:	ff 75 f4             	push   -0xc(%ebp)
+  80285c:	6a 00                	push   $0x0
+  80285e:	e8 3d ec ff ff       	call   8014a0 <sys_page_alloc>
+  802863:	89 c3                	mov    %eax,%ebx
+  802865:	83 c4 10             	add    $0x10,%esp
+  802868:	85 c0                	test   %eax,%eax
+  80286a:	78 28                	js     802894 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80286c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80286f:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802875:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802877:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80287a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802881:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802884:	83 ec 0c             	sub    $0xc,%esp
+  802887:	50                   	push   %eax
+  802888:	e8 89 f6 ff ff       	call   801f16 <fd2num>
+  80288d:	89 c3                	mov    %eax,%ebx
+  80288f:	83 c4 10             	add    $0x10,%esp
+  802892:	eb 0c                	jmp    8028a0 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802894:	83 ec 0c             	sub    $0xc,%esp
+  802897:	56                   	push   %esi
+  802898:	e8 e4 01 00 00       	call   802a81 <nsipc_close>
+		return r;
+  80289d:	83 c4 10             	add    $0x10,%esp
+}
+  8028a0:	89 d8                	mov    %ebx,%eax
+  8028a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a5:	5b                   	pop    %ebx
+  8028a6:	5e                   	pop    %esi
+  8028a7:	5d                   	pop    %ebp
+  8028a8:	c3                   	ret
+
+008028a9 <accept>:
+{
+  8028a9:	55                   	push   %ebp
+  8028aa:	89 e5                	mov    %esp,%ebp
+  8028ac:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b2:	e8 4e ff ff ff       	call   802805 <fd2sockid>
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	78 1b                	js     8028d6 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8028bb:	83 ec 04             	sub    $0x4,%esp
+  8028be:	ff 75 10             	push   0x10(%ebp)
+  8028c1:	ff 75 0c             	push   0xc(%ebp)
+  8028c4:	50                   	push   %eax
+  8028c5:	e8 0e 01 00 00       	call   8029d8 <nsipc_accept>
+  8028ca:	83 c4 10             	add    $0x10,%esp
+  8028cd:	85 c0                	test   %eax,%eax
+  8028cf:	78 05                	js     8028d6 <accept+0x2d>
+	return alloc_sockfd(r);
+  8028d1:	e8 5f ff ff ff       	call   802835 <alloc_sockfd>
+}
+  8028d6:	c9                   	leave
+  8028d7:	c3                   	ret
+
+008028d8 <bind>:
+{
+  8028d8:	55                   	push   %ebp
+  8028d9:	89 e5                	mov    %esp,%ebp
+  8028db:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e1:	e8 1f ff ff ff       	call   802805 <fd2sockid>
+  8028e6:	85 c0                	test   %eax,%eax
+  8028e8:	78 12                	js     8028fc <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8028ea:	83 ec 04             	sub    $0x4,%esp
+  8028ed:	ff 75 10             	push   0x10(%ebp)
+  8028f0:	ff 75 0c             	push   0xc(%ebp)
+  8028f3:	50                   	push   %eax
+  8028f4:	e8 31 01 00 00       	call   802a2a <nsipc_bind>
+  8028f9:	83 c4 10             	add    $0x10,%esp
+}
+  8028fc:	c9                   	leave
+  8028fd:	c3                   	ret
+
+008028fe <shutdown>:
+{
+  8028fe:	55                   	push   %ebp
+  8028ff:	89 e5                	mov    %esp,%ebp
+  802901:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802904:	8b 45 08             	mov    0x8(%ebp),%eax
+  802907:	e8 f9 fe ff ff       	call   802805 <fd2sockid>
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	78 0f                	js     80291f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802910:	83 ec 08             	sub    $0x8,%esp
+  802913:	ff 75 0c             	push   0xc(%ebp)
+  802916:	50                   	push   %eax
+  802917:	e8 43 01 00 00       	call   802a5f <nsipc_shutdown>
+  80291c:	83 c4 10             	add    $0x10,%esp
+}
+  80291f:	c9                   	leave
+  802920:	c3                   	ret
+
+00802921 <connect>:
+{
+  802921:	55                   	push   %ebp
+  802922:	89 e5                	mov    %esp,%ebp
+  802924:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802927:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292a:	e8 d6 fe ff ff       	call   802805 <fd2sockid>
+  80292f:	85 c0                	test   %eax,%eax
+  802931:	78 12                	js     802945 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802933:	83 ec 04             	sub    $0x4,%esp
+  802936:	ff 75 10             	push   0x10(%ebp)
+  802939:	ff 75 0c             	push   0xc(%ebp)
+  80293c:	50                   	push   %eax
+  80293d:	e8 59 01 00 00       	call   802a9b <nsipc_connect>
+  802942:	83 c4 10             	add    $0x10,%esp
+}
+  802945:	c9                   	leave
+  802946:	c3                   	ret
+
+00802947 <listen>:
+{
+  802947:	55                   	push   %ebp
+  802948:	89 e5                	mov    %esp,%ebp
+  80294a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80294d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802950:	e8 b0 fe ff ff       	call   802805 <fd2sockid>
+  802955:	85 c0                	test   %eax,%eax
+  802957:	78 0f                	js     802968 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802959:	83 ec 08             	sub    $0x8,%esp
+  80295c:	ff 75 0c             	push   0xc(%ebp)
+  80295f:	50                   	push   %eax
+  802960:	e8 6b 01 00 00       	call   802ad0 <nsipc_listen>
+  802965:	83 c4 10             	add    $0x10,%esp
+}
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+
+0080296a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80296a:	55                   	push   %ebp
+  80296b:	89 e5                	mov    %esp,%ebp
+  80296d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802970:	ff 75 10             	push   0x10(%ebp)
+  802973:	ff 75 0c             	push   0xc(%ebp)
+  802976:	ff 75 08             	push   0x8(%ebp)
+  802979:	e8 41 02 00 00       	call   802bbf <nsipc_socket>
+  80297e:	83 c4 10             	add    $0x10,%esp
+  802981:	85 c0                	test   %eax,%eax
+  802983:	78 05                	js     80298a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802985:	e8 ab fe ff ff       	call   802835 <alloc_sockfd>
+}
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	53                   	push   %ebx
+  802990:	83 ec 04             	sub    $0x4,%esp
+  802993:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802995:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  80299c:	74 26                	je     8029c4 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80299e:	6a 07                	push   $0x7
+  8029a0:	68 00 70 80 00       	push   $0x807000
+  8029a5:	53                   	push   %ebx
+  8029a6:	ff 35 14 50 80 00    	push   0x805014
+  8029ac:	e8 c7 0a 00 00       	call   803478 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029b1:	83 c4 0c             	add    $0xc,%esp
+  8029b4:	6a 00                	push   $0x0
+  8029b6:	6a 00                	push   $0x0
+  8029b8:	6a 00                	push   $0x0
+  8029ba:	e8 a1 0a 00 00       	call   803460 <ipc_recv>
+}
+  8029bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029c4:	83 ec 0c             	sub    $0xc,%esp
+  8029c7:	6a 02                	push   $0x2
+  8029c9:	e8 fe 0a 00 00       	call   8034cc <ipc_find_env>
+  8029ce:	a3 14 50 80 00       	mov    %eax,0x805014
+  8029d3:	83 c4 10             	add    $0x10,%esp
+  8029d6:	eb c6                	jmp    80299e <nsipc+0x12>
+
+008029d8 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8029d8:	55                   	push   %ebp
+  8029d9:	89 e5                	mov    %esp,%ebp
+  8029db:	56                   	push   %esi
+  8029dc:	53                   	push   %ebx
+  8029dd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8029e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8029e8:	8b 06                	mov    (%esi),%eax
+  8029ea:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8029ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029f4:	e8 93 ff ff ff       	call   80298c <nsipc>
+  8029f9:	89 c3                	mov    %eax,%ebx
+  8029fb:	85 c0                	test   %eax,%eax
+  8029fd:	79 09                	jns    802a08 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8029ff:	89 d8                	mov    %ebx,%eax
+  802a01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a04:	5b                   	pop    %ebx
+  802a05:	5e                   	pop    %esi
+  802a06:	5d                   	pop    %ebp
+  802a07:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a08:	83 ec 04             	sub    $0x4,%esp
+  802a0b:	ff 35 10 70 80 00    	push   0x807010
+  802a11:	68 00 70 80 00       	push   $0x807000
+  802a16:	ff 75 0c             	push   0xc(%ebp)
+  802a19:	e8 10 e7 ff ff       	call   80112e <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a1e:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a23:	89 06                	mov    %eax,(%esi)
+  802a25:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a28:	eb d5                	jmp    8029ff <nsipc_accept+0x27>
+
+00802a2a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a2a:	55                   	push   %ebp
+  802a2b:	89 e5                	mov    %esp,%ebp
+  802a2d:	53                   	push   %ebx
+  802a2e:	83 ec 08             	sub    $0x8,%esp
+  802a31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a37:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a3c:	53                   	push   %ebx
+  802a3d:	ff 75 0c             	push   0xc(%ebp)
+  802a40:	68 04 70 80 00       	push   $0x807004
+  802a45:	e8 e4 e6 ff ff       	call   80112e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a4a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802a50:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a55:	e8 32 ff ff ff       	call   80298c <nsipc>
+}
+  802a5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+00802a5f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a68:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802a6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a70:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a75:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a7a:	e8 0d ff ff ff       	call   80298c <nsipc>
+}
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+
+00802a81 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a81:	55                   	push   %ebp
+  802a82:	89 e5                	mov    %esp,%ebp
+  802a84:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a87:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802a8f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a94:	e8 f3 fe ff ff       	call   80298c <nsipc>
+}
+  802a99:	c9                   	leave
+  802a9a:	c3                   	ret
+
+00802a9b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a9b:	55                   	push   %ebp
+  802a9c:	89 e5                	mov    %esp,%ebp
+  802a9e:	53                   	push   %ebx
+  802a9f:	83 ec 08             	sub    $0x8,%esp
+  802aa2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802aa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa8:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802aad:	53                   	push   %ebx
+  802aae:	ff 75 0c             	push   0xc(%ebp)
+  802ab1:	68 04 70 80 00       	push   $0x807004
+  802ab6:	e8 73 e6 ff ff       	call   80112e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802abb:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802ac1:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ac6:	e8 c1 fe ff ff       	call   80298c <nsipc>
+}
+  802acb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ace:	c9                   	leave
+  802acf:	c3                   	ret
+
+00802ad0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ad0:	55                   	push   %ebp
+  802ad1:	89 e5                	mov    %esp,%ebp
+  802ad3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802ade:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ae1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802ae6:	b8 06 00 00 00       	mov    $0x6,%eax
+  802aeb:	e8 9c fe ff ff       	call   80298c <nsipc>
+}
+  802af0:	c9                   	leave
+  802af1:	c3                   	ret
+
+00802af2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802af2:	55                   	push   %ebp
+  802af3:	89 e5                	mov    %esp,%ebp
+  802af5:	56                   	push   %esi
+  802af6:	53                   	push   %ebx
+  802af7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802b02:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802b08:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b0b:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b10:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b15:	e8 72 fe ff ff       	call   80298c <nsipc>
+  802b1a:	89 c3                	mov    %eax,%ebx
+  802b1c:	85 c0                	test   %eax,%eax
+  802b1e:	78 22                	js     802b42 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b20:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b25:	39 c6                	cmp    %eax,%esi
+  802b27:	0f 4e c6             	cmovle %esi,%eax
+  802b2a:	39 c3                	cmp    %eax,%ebx
+  802b2c:	7f 1d                	jg     802b4b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b2e:	83 ec 04             	sub    $0x4,%esp
+  802b31:	53                   	push   %ebx
+  802b32:	68 00 70 80 00       	push   $0x807000
+  802b37:	ff 75 0c             	push   0xc(%ebp)
+  802b3a:	e8 ef e5 ff ff       	call   80112e <memmove>
+  802b3f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b42:	89 d8                	mov    %ebx,%eax
+  802b44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b47:	5b                   	pop    %ebx
+  802b48:	5e                   	pop    %esi
+  802b49:	5d                   	pop    %ebp
+  802b4a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b4b:	68 e7 3b 80 00       	push   $0x803be7
+  802b50:	68 af 3b 80 00       	push   $0x803baf
+  802b55:	6a 62                	push   $0x62
+  802b57:	68 fc 3b 80 00       	push   $0x803bfc
+  802b5c:	e8 24 dd ff ff       	call   800885 <_panic>
+
+00802b61 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b61:	55                   	push   %ebp
+  802b62:	89 e5                	mov    %esp,%ebp
+  802b64:	53                   	push   %ebx
+  802b65:	83 ec 04             	sub    $0x4,%esp
+  802b68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6e:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802b73:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b79:	7f 2e                	jg     802ba9 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b7b:	83 ec 04             	sub    $0x4,%esp
+  802b7e:	53                   	push   %ebx
+  802b7f:	ff 75 0c             	push   0xc(%ebp)
+  802b82:	68 0c 70 80 00       	push   $0x80700c
+  802b87:	e8 a2 e5 ff ff       	call   80112e <memmove>
+	nsipcbuf.send.req_size = size;
+  802b8c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802b92:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b95:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802b9a:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b9f:	e8 e8 fd ff ff       	call   80298c <nsipc>
+}
+  802ba4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba7:	c9                   	leave
+  802ba8:	c3                   	ret
+	assert(size < 1600);
+  802ba9:	68 08 3c 80 00       	push   $0x803c08
+  802bae:	68 af 3b 80 00       	push   $0x803baf
+  802bb3:	6a 6d                	push   $0x6d
+  802bb5:	68 fc 3b 80 00       	push   $0x803bfc
+  802bba:	e8 c6 dc ff ff       	call   800885 <_panic>
+
+00802bbf <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802bbf:	55                   	push   %ebp
+  802bc0:	89 e5                	mov    %esp,%ebp
+  802bc2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802bc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802bcd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bd0:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802bd5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd8:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802bdd:	b8 09 00 00 00       	mov    $0x9,%eax
+  802be2:	e8 a5 fd ff ff       	call   80298c <nsipc>
+}
+  802be7:	c9                   	leave
+  802be8:	c3                   	ret
+
+00802be9 <free>:
+	return v;
+}
+
+void
+free(void *v)
+{
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	53                   	push   %ebx
+  802bed:	83 ec 04             	sub    $0x4,%esp
+  802bf0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint8_t *c;
+	uint32_t *ref;
+
+	if (v == 0)
+  802bf3:	85 db                	test   %ebx,%ebx
+  802bf5:	0f 84 85 00 00 00    	je     802c80 <free+0x97>
+		return;
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802bfb:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c01:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c06:	77 51                	ja     802c59 <free+0x70>
+
+	c = ROUNDDOWN(v, PGSIZE);
+  802c08:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  802c0e:	89 d8                	mov    %ebx,%eax
+  802c10:	c1 e8 0c             	shr    $0xc,%eax
+  802c13:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802c1a:	f6 c4 02             	test   $0x2,%ah
+  802c1d:	74 50                	je     802c6f <free+0x86>
+		sys_page_unmap(0, c);
+  802c1f:	83 ec 08             	sub    $0x8,%esp
+  802c22:	53                   	push   %ebx
+  802c23:	6a 00                	push   $0x0
+  802c25:	e8 51 e9 ff ff       	call   80157b <sys_page_unmap>
+		c += PGSIZE;
+  802c2a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+		assert(mbegin <= c && c < mend);
+  802c30:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  802c36:	83 c4 10             	add    $0x10,%esp
+  802c39:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802c3e:	76 ce                	jbe    802c0e <free+0x25>
+  802c40:	68 4f 3c 80 00       	push   $0x803c4f
+  802c45:	68 af 3b 80 00       	push   $0x803baf
+  802c4a:	68 81 00 00 00       	push   $0x81
+  802c4f:	68 42 3c 80 00       	push   $0x803c42
+  802c54:	e8 2c dc ff ff       	call   800885 <_panic>
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  802c59:	68 14 3c 80 00       	push   $0x803c14
+  802c5e:	68 af 3b 80 00       	push   $0x803baf
+  802c63:	6a 7a                	push   $0x7a
+  802c65:	68 42 3c 80 00       	push   $0x803c42
+  802c6a:	e8 16 dc ff ff       	call   800885 <_panic>
+	/*
+	 * c is just a piece of this page, so dec the ref count
+	 * and maybe free the page.
+	 */
+	ref = (uint32_t*) (c + PGSIZE - 4);
+	if (--(*ref) == 0)
+  802c6f:	8b 83 fc 0f 00 00    	mov    0xffc(%ebx),%eax
+  802c75:	83 e8 01             	sub    $0x1,%eax
+  802c78:	89 83 fc 0f 00 00    	mov    %eax,0xffc(%ebx)
+  802c7e:	74 05                	je     802c85 <free+0x9c>
+		sys_page_unmap(0, c);
+}
+  802c80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c83:	c9                   	leave
+  802c84:	c3                   	ret
+		sys_page_unmap(0, c);
+  802c85:	83 ec 08             	sub    $0x8,%esp
+  802c88:	53                   	push   %ebx
+  802c89:	6a 00                	push   $0x0
+  802c8b:	e8 eb e8 ff ff       	call   80157b <sys_page_unmap>
+  802c90:	83 c4 10             	add    $0x10,%esp
+  802c93:	eb eb                	jmp    802c80 <free+0x97>
+
+00802c95 <malloc>:
+{
+  802c95:	55                   	push   %ebp
+  802c96:	89 e5                	mov    %esp,%ebp
+  802c98:	57                   	push   %edi
+  802c99:	56                   	push   %esi
+  802c9a:	53                   	push   %ebx
+  802c9b:	83 ec 1c             	sub    $0x1c,%esp
+	if (mptr == 0)
+  802c9e:	a1 18 50 80 00       	mov    0x805018,%eax
+  802ca3:	85 c0                	test   %eax,%eax
+  802ca5:	74 6c                	je     802d13 <malloc+0x7e>
+	n = ROUNDUP(n, 4);
+  802ca7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802caa:	8d 57 03             	lea    0x3(%edi),%edx
+  802cad:	89 d6                	mov    %edx,%esi
+  802caf:	83 e6 fc             	and    $0xfffffffc,%esi
+	if (n >= MAXMALLOC)
+  802cb2:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802cb8:	0f 87 55 01 00 00    	ja     802e13 <malloc+0x17e>
+	if ((uintptr_t) mptr % PGSIZE){
+  802cbe:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  802cc3:	74 30                	je     802cf5 <malloc+0x60>
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  802cc5:	89 c3                	mov    %eax,%ebx
+  802cc7:	c1 eb 0c             	shr    $0xc,%ebx
+  802cca:	8d 54 30 03          	lea    0x3(%eax,%esi,1),%edx
+  802cce:	c1 ea 0c             	shr    $0xc,%edx
+  802cd1:	39 d3                	cmp    %edx,%ebx
+  802cd3:	74 60                	je     802d35 <malloc+0xa0>
+		free(mptr);	/* drop reference to this page */
+  802cd5:	83 ec 0c             	sub    $0xc,%esp
+  802cd8:	50                   	push   %eax
+  802cd9:	e8 0b ff ff ff       	call   802be9 <free>
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  802cde:	a1 18 50 80 00       	mov    0x805018,%eax
+  802ce3:	05 00 10 00 00       	add    $0x1000,%eax
+  802ce8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ced:	a3 18 50 80 00       	mov    %eax,0x805018
+  802cf2:	83 c4 10             	add    $0x10,%esp
+  802cf5:	8b 0d 18 50 80 00    	mov    0x805018,%ecx
+{
+  802cfb:	ba 02 00 00 00       	mov    $0x2,%edx
+  802d00:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  802d04:	8d 7e 04             	lea    0x4(%esi),%edi
+  802d07:	89 cb                	mov    %ecx,%ebx
+  802d09:	01 f9                	add    %edi,%ecx
+  802d0b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802d0e:	e9 8e 00 00 00       	jmp    802da1 <malloc+0x10c>
+		mptr = mbegin;
+  802d13:	c7 05 18 50 80 00 00 	movl   $0x8000000,0x805018
+  802d1a:	00 00 08 
+	n = ROUNDUP(n, 4);
+  802d1d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d20:	8d 57 03             	lea    0x3(%edi),%edx
+  802d23:	89 d6                	mov    %edx,%esi
+  802d25:	83 e6 fc             	and    $0xfffffffc,%esi
+	if (n >= MAXMALLOC)
+  802d28:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802d2e:	76 c5                	jbe    802cf5 <malloc+0x60>
+  802d30:	e9 d6 00 00 00       	jmp    802e0b <malloc+0x176>
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  802d35:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  802d3b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+			(*ref)++;
+  802d41:	83 42 fc 01          	addl   $0x1,-0x4(%edx)
+			mptr += n;
+  802d45:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  802d48:	89 15 18 50 80 00    	mov    %edx,0x805018
+			return v;
+  802d4e:	e9 b8 00 00 00       	jmp    802e0b <malloc+0x176>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802d53:	05 00 10 00 00       	add    $0x1000,%eax
+  802d58:	39 c8                	cmp    %ecx,%eax
+  802d5a:	0f 83 ba 00 00 00    	jae    802e1a <malloc+0x185>
+		if (va >= (uintptr_t) mend
+  802d60:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802d65:	77 22                	ja     802d89 <malloc+0xf4>
+		    || ((uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  802d67:	89 c2                	mov    %eax,%edx
+  802d69:	c1 ea 16             	shr    $0x16,%edx
+  802d6c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802d73:	f6 c2 01             	test   $0x1,%dl
+  802d76:	74 db                	je     802d53 <malloc+0xbe>
+  802d78:	89 c2                	mov    %eax,%edx
+  802d7a:	c1 ea 0c             	shr    $0xc,%edx
+  802d7d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802d84:	f6 c2 01             	test   $0x1,%dl
+  802d87:	74 ca                	je     802d53 <malloc+0xbe>
+		if (mptr == mend) {
+  802d89:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d8f:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  802d95:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+  802d99:	81 fb 00 00 00 10    	cmp    $0x10000000,%ebx
+  802d9f:	74 04                	je     802da5 <malloc+0x110>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802da1:	89 d8                	mov    %ebx,%eax
+  802da3:	eb b3                	jmp    802d58 <malloc+0xc3>
+  802da5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+			mptr = mbegin;
+  802da8:	b9 00 00 00 08       	mov    $0x8000000,%ecx
+  802dad:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+			if (++nwrap == 2)
+  802db1:	83 ea 01             	sub    $0x1,%edx
+  802db4:	0f 85 4d ff ff ff    	jne    802d07 <malloc+0x72>
+  802dba:	c7 05 18 50 80 00 00 	movl   $0x8000000,0x805018
+  802dc1:	00 00 08 
+				return 0;	/* out of address space */
+  802dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc9:	eb 40                	jmp    802e0b <malloc+0x176>
+				sys_page_unmap(0, mptr + i);
+  802dcb:	83 ec 08             	sub    $0x8,%esp
+  802dce:	89 d8                	mov    %ebx,%eax
+  802dd0:	03 05 18 50 80 00    	add    0x805018,%eax
+  802dd6:	50                   	push   %eax
+  802dd7:	6a 00                	push   $0x0
+  802dd9:	e8 9d e7 ff ff       	call   80157b <sys_page_unmap>
+			for (; i >= 0; i -= PGSIZE)
+  802dde:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802de4:	83 c4 10             	add    $0x10,%esp
+  802de7:	85 db                	test   %ebx,%ebx
+  802de9:	79 e0                	jns    802dcb <malloc+0x136>
+			return 0;	/* out of physical memory */
+  802deb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df0:	eb 19                	jmp    802e0b <malloc+0x176>
+	ref = (uint32_t*) (mptr + i - 4);
+  802df2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802df5:	a1 18 50 80 00       	mov    0x805018,%eax
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  802dfa:	c7 44 18 fc 02 00 00 	movl   $0x2,-0x4(%eax,%ebx,1)
+  802e01:	00 
+	mptr += n;
+  802e02:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  802e05:	89 15 18 50 80 00    	mov    %edx,0x805018
+}
+  802e0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e0e:	5b                   	pop    %ebx
+  802e0f:	5e                   	pop    %esi
+  802e10:	5f                   	pop    %edi
+  802e11:	5d                   	pop    %ebp
+  802e12:	c3                   	ret
+		return 0;
+  802e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e18:	eb f1                	jmp    802e0b <malloc+0x176>
+  802e1a:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+  802e1e:	74 06                	je     802e26 <malloc+0x191>
+  802e20:	89 1d 18 50 80 00    	mov    %ebx,0x805018
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e2b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802e2e:	39 fb                	cmp    %edi,%ebx
+  802e30:	73 c0                	jae    802df2 <malloc+0x15d>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e32:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e38:	83 ec 04             	sub    $0x4,%esp
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  802e3b:	39 fe                	cmp    %edi,%esi
+  802e3d:	0f 92 c0             	setb   %al
+  802e40:	0f b6 c0             	movzbl %al,%eax
+  802e43:	c1 e0 09             	shl    $0x9,%eax
+		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
+  802e46:	83 c8 07             	or     $0x7,%eax
+  802e49:	50                   	push   %eax
+  802e4a:	89 d8                	mov    %ebx,%eax
+  802e4c:	03 05 18 50 80 00    	add    0x805018,%eax
+  802e52:	50                   	push   %eax
+  802e53:	6a 00                	push   $0x0
+  802e55:	e8 46 e6 ff ff       	call   8014a0 <sys_page_alloc>
+  802e5a:	83 c4 10             	add    $0x10,%esp
+  802e5d:	85 c0                	test   %eax,%eax
+  802e5f:	78 86                	js     802de7 <malloc+0x152>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  802e61:	89 f3                	mov    %esi,%ebx
+  802e63:	eb c9                	jmp    802e2e <malloc+0x199>
+
+00802e65 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e65:	55                   	push   %ebp
+  802e66:	89 e5                	mov    %esp,%ebp
+  802e68:	56                   	push   %esi
+  802e69:	53                   	push   %ebx
+  802e6a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e6d:	83 ec 0c             	sub    $0xc,%esp
+  802e70:	ff 75 08             	push   0x8(%ebp)
+  802e73:	e8 ae f0 ff ff       	call   801f26 <fd2data>
+  802e78:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e7a:	83 c4 08             	add    $0x8,%esp
+  802e7d:	68 67 3c 80 00       	push   $0x803c67
+  802e82:	53                   	push   %ebx
+  802e83:	e8 20 e1 ff ff       	call   800fa8 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e88:	8b 46 04             	mov    0x4(%esi),%eax
+  802e8b:	2b 06                	sub    (%esi),%eax
+  802e8d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e93:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e9a:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e9d:	c7 83 88 00 00 00 5c 	movl   $0x80405c,0x88(%ebx)
+  802ea4:	40 80 00 
+	return 0;
+}
+  802ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eaf:	5b                   	pop    %ebx
+  802eb0:	5e                   	pop    %esi
+  802eb1:	5d                   	pop    %ebp
+  802eb2:	c3                   	ret
+
+00802eb3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802eb3:	55                   	push   %ebp
+  802eb4:	89 e5                	mov    %esp,%ebp
+  802eb6:	53                   	push   %ebx
+  802eb7:	83 ec 0c             	sub    $0xc,%esp
+  802eba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802ebd:	53                   	push   %ebx
+  802ebe:	6a 00                	push   $0x0
+  802ec0:	e8 b6 e6 ff ff       	call   80157b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802ec5:	89 1c 24             	mov    %ebx,(%esp)
+  802ec8:	e8 59 f0 ff ff       	call   801f26 <fd2data>
+  802ecd:	83 c4 08             	add    $0x8,%esp
+  802ed0:	50                   	push   %eax
+  802ed1:	6a 00                	push   $0x0
+  802ed3:	e8 a3 e6 ff ff       	call   80157b <sys_page_unmap>
+}
+  802ed8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802edb:	c9                   	leave
+  802edc:	c3                   	ret
+
+00802edd <_pipeisclosed>:
+{
+  802edd:	55                   	push   %ebp
+  802ede:	89 e5                	mov    %esp,%ebp
+  802ee0:	57                   	push   %edi
+  802ee1:	56                   	push   %esi
+  802ee2:	53                   	push   %ebx
+  802ee3:	83 ec 1c             	sub    $0x1c,%esp
+  802ee6:	89 c7                	mov    %eax,%edi
+  802ee8:	89 d6                	mov    %edx,%esi
+  802eea:	eb 3c                	jmp    802f28 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802eec:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802eef:	83 ec 0c             	sub    $0xc,%esp
+  802ef2:	57                   	push   %edi
+  802ef3:	e8 13 06 00 00       	call   80350b <pageref>
+  802ef8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802efb:	89 34 24             	mov    %esi,(%esp)
+  802efe:	e8 08 06 00 00       	call   80350b <pageref>
+  802f03:	89 c2                	mov    %eax,%edx
+  802f05:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f07:	05 00 00 00 20       	add    $0x20000000,%eax
+  802f0c:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802f0f:	8b 0d 1c 50 80 00    	mov    0x80501c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f15:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f1a:	76 31                	jbe    802f4d <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802f1c:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802f1f:	39 c3                	cmp    %eax,%ebx
+  802f21:	74 76                	je     802f99 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802f23:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f26:	74 36                	je     802f5e <_pipeisclosed+0x81>
+  802f28:	89 e0                	mov    %esp,%eax
+  802f2a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f2f:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f35:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f3a:	77 b0                	ja     802eec <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f3c:	c1 e8 10             	shr    $0x10,%eax
+  802f3f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f45:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f4b:	eb 9f                	jmp    802eec <_pipeisclosed+0xf>
+  802f4d:	c1 e8 10             	shr    $0x10,%eax
+  802f50:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f56:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802f5c:	eb be                	jmp    802f1c <_pipeisclosed+0x3f>
+  802f5e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f60:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f65:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f6b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f70:	76 16                	jbe    802f88 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f72:	8b 42 58             	mov    0x58(%edx),%eax
+  802f75:	6a 01                	push   $0x1
+  802f77:	50                   	push   %eax
+  802f78:	53                   	push   %ebx
+  802f79:	68 6e 3c 80 00       	push   $0x803c6e
+  802f7e:	e8 dd d9 ff ff       	call   800960 <cprintf>
+  802f83:	83 c4 10             	add    $0x10,%esp
+  802f86:	eb a0                	jmp    802f28 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f88:	c1 e8 10             	shr    $0x10,%eax
+  802f8b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f91:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f97:	eb d9                	jmp    802f72 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802f99:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f9c:	0f 94 c0             	sete   %al
+  802f9f:	0f b6 c0             	movzbl %al,%eax
+}
+  802fa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fa5:	5b                   	pop    %ebx
+  802fa6:	5e                   	pop    %esi
+  802fa7:	5f                   	pop    %edi
+  802fa8:	5d                   	pop    %ebp
+  802fa9:	c3                   	ret
+
+00802faa <devpipe_write>:
+{
+  802faa:	55                   	push   %ebp
+  802fab:	89 e5                	mov    %esp,%ebp
+  802fad:	57                   	push   %edi
+  802fae:	56                   	push   %esi
+  802faf:	53                   	push   %ebx
+  802fb0:	83 ec 28             	sub    $0x28,%esp
+  802fb3:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802fb6:	56                   	push   %esi
+  802fb7:	e8 6a ef ff ff       	call   801f26 <fd2data>
+  802fbc:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fbe:	83 c4 10             	add    $0x10,%esp
+  802fc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802fc9:	75 09                	jne    802fd4 <devpipe_write+0x2a>
+	return i;
+  802fcb:	89 f8                	mov    %edi,%eax
+  802fcd:	eb 23                	jmp    802ff2 <devpipe_write+0x48>
+			sys_yield();
+  802fcf:	e8 86 e4 ff ff       	call   80145a <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802fd4:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fd7:	8b 0b                	mov    (%ebx),%ecx
+  802fd9:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fdc:	39 d0                	cmp    %edx,%eax
+  802fde:	72 1a                	jb     802ffa <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802fe0:	89 da                	mov    %ebx,%edx
+  802fe2:	89 f0                	mov    %esi,%eax
+  802fe4:	e8 f4 fe ff ff       	call   802edd <_pipeisclosed>
+  802fe9:	85 c0                	test   %eax,%eax
+  802feb:	74 e2                	je     802fcf <devpipe_write+0x25>
+				return 0;
+  802fed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ff2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff5:	5b                   	pop    %ebx
+  802ff6:	5e                   	pop    %esi
+  802ff7:	5f                   	pop    %edi
+  802ff8:	5d                   	pop    %ebp
+  802ff9:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ffa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ffd:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803001:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803004:	89 c2                	mov    %eax,%edx
+  803006:	c1 fa 1f             	sar    $0x1f,%edx
+  803009:	89 d1                	mov    %edx,%ecx
+  80300b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80300e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803011:	83 e2 1f             	and    $0x1f,%edx
+  803014:	29 ca                	sub    %ecx,%edx
+  803016:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80301a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80301e:	83 c0 01             	add    $0x1,%eax
+  803021:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803024:	83 c7 01             	add    $0x1,%edi
+  803027:	eb 9d                	jmp    802fc6 <devpipe_write+0x1c>
+
+00803029 <devpipe_read>:
+{
+  803029:	55                   	push   %ebp
+  80302a:	89 e5                	mov    %esp,%ebp
+  80302c:	57                   	push   %edi
+  80302d:	56                   	push   %esi
+  80302e:	53                   	push   %ebx
+  80302f:	83 ec 18             	sub    $0x18,%esp
+  803032:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803035:	57                   	push   %edi
+  803036:	e8 eb ee ff ff       	call   801f26 <fd2data>
+  80303b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80303d:	83 c4 10             	add    $0x10,%esp
+  803040:	be 00 00 00 00       	mov    $0x0,%esi
+  803045:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803048:	75 13                	jne    80305d <devpipe_read+0x34>
+	return i;
+  80304a:	89 f0                	mov    %esi,%eax
+  80304c:	eb 02                	jmp    803050 <devpipe_read+0x27>
+				return i;
+  80304e:	89 f0                	mov    %esi,%eax
+}
+  803050:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803053:	5b                   	pop    %ebx
+  803054:	5e                   	pop    %esi
+  803055:	5f                   	pop    %edi
+  803056:	5d                   	pop    %ebp
+  803057:	c3                   	ret
+			sys_yield();
+  803058:	e8 fd e3 ff ff       	call   80145a <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80305d:	8b 03                	mov    (%ebx),%eax
+  80305f:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803062:	75 18                	jne    80307c <devpipe_read+0x53>
+			if (i > 0)
+  803064:	85 f6                	test   %esi,%esi
+  803066:	75 e6                	jne    80304e <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803068:	89 da                	mov    %ebx,%edx
+  80306a:	89 f8                	mov    %edi,%eax
+  80306c:	e8 6c fe ff ff       	call   802edd <_pipeisclosed>
+  803071:	85 c0                	test   %eax,%eax
+  803073:	74 e3                	je     803058 <devpipe_read+0x2f>
+				return 0;
+  803075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307a:	eb d4                	jmp    803050 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80307c:	99                   	cltd
+  80307d:	c1 ea 1b             	shr    $0x1b,%edx
+  803080:	01 d0                	add    %edx,%eax
+  803082:	83 e0 1f             	and    $0x1f,%eax
+  803085:	29 d0                	sub    %edx,%eax
+  803087:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80308c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80308f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803092:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803095:	83 c6 01             	add    $0x1,%esi
+  803098:	eb ab                	jmp    803045 <devpipe_read+0x1c>
+
+0080309a <pipe>:
+{
+  80309a:	55                   	push   %ebp
+  80309b:	89 e5                	mov    %esp,%ebp
+  80309d:	56                   	push   %esi
+  80309e:	53                   	push   %ebx
+  80309f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030a5:	50                   	push   %eax
+  8030a6:	e8 92 ee ff ff       	call   801f3d <fd_alloc>
+  8030ab:	89 c3                	mov    %eax,%ebx
+  8030ad:	83 c4 10             	add    $0x10,%esp
+  8030b0:	85 c0                	test   %eax,%eax
+  8030b2:	0f 88 23 01 00 00    	js     8031db <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030b8:	83 ec 04             	sub    $0x4,%esp
+  8030bb:	68 07 04 00 00       	push   $0x407
+  8030c0:	ff 75 f4             	push   -0xc(%ebp)
+  8030c3:	6a 00                	push   $0x0
+  8030c5:	e8 d6 e3 ff ff       	call   8014a0 <sys_page_alloc>
+  8030ca:	89 c3                	mov    %eax,%ebx
+  8030cc:	83 c4 10             	add    $0x10,%esp
+  8030cf:	85 c0                	test   %eax,%eax
+  8030d1:	0f 88 04 01 00 00    	js     8031db <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030d7:	83 ec 0c             	sub    $0xc,%esp
+  8030da:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030dd:	50                   	push   %eax
+  8030de:	e8 5a ee ff ff       	call   801f3d <fd_alloc>
+  8030e3:	89 c3                	mov    %eax,%ebx
+  8030e5:	83 c4 10             	add    $0x10,%esp
+  8030e8:	85 c0                	test   %eax,%eax
+  8030ea:	0f 88 db 00 00 00    	js     8031cb <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030f0:	83 ec 04             	sub    $0x4,%esp
+  8030f3:	68 07 04 00 00       	push   $0x407
+  8030f8:	ff 75 f0             	push   -0x10(%ebp)
+  8030fb:	6a 00                	push   $0x0
+  8030fd:	e8 9e e3 ff ff       	call   8014a0 <sys_page_alloc>
+  803102:	89 c3                	mov    %eax,%ebx
+  803104:	83 c4 10             	add    $0x10,%esp
+  803107:	85 c0                	test   %eax,%eax
+  803109:	0f 88 bc 00 00 00    	js     8031cb <pipe+0x131>
+	va = fd2data(fd0);
+  80310f:	83 ec 0c             	sub    $0xc,%esp
+  803112:	ff 75 f4             	push   -0xc(%ebp)
+  803115:	e8 0c ee ff ff       	call   801f26 <fd2data>
+  80311a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80311c:	83 c4 0c             	add    $0xc,%esp
+  80311f:	68 07 04 00 00       	push   $0x407
+  803124:	50                   	push   %eax
+  803125:	6a 00                	push   $0x0
+  803127:	e8 74 e3 ff ff       	call   8014a0 <sys_page_alloc>
+  80312c:	89 c3                	mov    %eax,%ebx
+  80312e:	83 c4 10             	add    $0x10,%esp
+  803131:	85 c0                	test   %eax,%eax
+  803133:	0f 88 82 00 00 00    	js     8031bb <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803139:	83 ec 0c             	sub    $0xc,%esp
+  80313c:	ff 75 f0             	push   -0x10(%ebp)
+  80313f:	e8 e2 ed ff ff       	call   801f26 <fd2data>
+  803144:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80314b:	50                   	push   %eax
+  80314c:	6a 00                	push   $0x0
+  80314e:	56                   	push   %esi
+  80314f:	6a 00                	push   $0x0
+  803151:	e8 b7 e3 ff ff       	call   80150d <sys_page_map>
+  803156:	89 c3                	mov    %eax,%ebx
+  803158:	83 c4 20             	add    $0x20,%esp
+  80315b:	85 c0                	test   %eax,%eax
+  80315d:	78 4e                	js     8031ad <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80315f:	a1 5c 40 80 00       	mov    0x80405c,%eax
+  803164:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803167:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803169:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80316c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803173:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803176:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803178:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80317b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803182:	83 ec 0c             	sub    $0xc,%esp
+  803185:	ff 75 f4             	push   -0xc(%ebp)
+  803188:	e8 89 ed ff ff       	call   801f16 <fd2num>
+  80318d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803190:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803192:	83 c4 04             	add    $0x4,%esp
+  803195:	ff 75 f0             	push   -0x10(%ebp)
+  803198:	e8 79 ed ff ff       	call   801f16 <fd2num>
+  80319d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031a0:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031a3:	83 c4 10             	add    $0x10,%esp
+  8031a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031ab:	eb 2e                	jmp    8031db <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031ad:	83 ec 08             	sub    $0x8,%esp
+  8031b0:	56                   	push   %esi
+  8031b1:	6a 00                	push   $0x0
+  8031b3:	e8 c3 e3 ff ff       	call   80157b <sys_page_unmap>
+  8031b8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031bb:	83 ec 08             	sub    $0x8,%esp
+  8031be:	ff 75 f0             	push   -0x10(%ebp)
+  8031c1:	6a 00                	push   $0x0
+  8031c3:	e8 b3 e3 ff ff       	call   80157b <sys_page_unmap>
+  8031c8:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031cb:	83 ec 08             	sub    $0x8,%esp
+  8031ce:	ff 75 f4             	push   -0xc(%ebp)
+  8031d1:	6a 00                	push   $0x0
+  8031d3:	e8 a3 e3 ff ff       	call   80157b <sys_page_unmap>
+  8031d8:	83 c4 10             	add    $0x10,%esp
+}
+  8031db:	89 d8                	mov    %ebx,%eax
+  8031dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031e0:	5b                   	pop    %ebx
+  8031e1:	5e                   	pop    %esi
+  8031e2:	5d                   	pop    %ebp
+  8031e3:	c3                   	ret
+
+008031e4 <pipeisclosed>:
+{
+  8031e4:	55                   	push   %ebp
+  8031e5:	89 e5                	mov    %esp,%ebp
+  8031e7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031ed:	50                   	push   %eax
+  8031ee:	ff 75 08             	push   0x8(%ebp)
+  8031f1:	e8 9d ed ff ff       	call   801f93 <fd_lookup>
+  8031f6:	83 c4 10             	add    $0x10,%esp
+  8031f9:	85 c0                	test   %eax,%eax
+  8031fb:	78 18                	js     803215 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8031fd:	83 ec 0c             	sub    $0xc,%esp
+  803200:	ff 75 f4             	push   -0xc(%ebp)
+  803203:	e8 1e ed ff ff       	call   801f26 <fd2data>
+  803208:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80320a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80320d:	e8 cb fc ff ff       	call   802edd <_pipeisclosed>
+  803212:	83 c4 10             	add    $0x10,%esp
+}
+  803215:	c9                   	leave
+  803216:	c3                   	ret
+
+00803217 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321c:	c3                   	ret
+
+0080321d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80321d:	55                   	push   %ebp
+  80321e:	89 e5                	mov    %esp,%ebp
+  803220:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803223:	68 86 3c 80 00       	push   $0x803c86
+  803228:	ff 75 0c             	push   0xc(%ebp)
+  80322b:	e8 78 dd ff ff       	call   800fa8 <strcpy>
+	return 0;
+}
+  803230:	b8 00 00 00 00       	mov    $0x0,%eax
+  803235:	c9                   	leave
+  803236:	c3                   	ret
+
+00803237 <devcons_write>:
+{
+  803237:	55                   	push   %ebp
+  803238:	89 e5                	mov    %esp,%ebp
+  80323a:	57                   	push   %edi
+  80323b:	56                   	push   %esi
+  80323c:	53                   	push   %ebx
+  80323d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803243:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803248:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80324e:	eb 2e                	jmp    80327e <devcons_write+0x47>
+		m = n - tot;
+  803250:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803253:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803255:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80325a:	39 c3                	cmp    %eax,%ebx
+  80325c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80325f:	83 ec 04             	sub    $0x4,%esp
+  803262:	53                   	push   %ebx
+  803263:	89 f0                	mov    %esi,%eax
+  803265:	03 45 0c             	add    0xc(%ebp),%eax
+  803268:	50                   	push   %eax
+  803269:	57                   	push   %edi
+  80326a:	e8 bf de ff ff       	call   80112e <memmove>
+		sys_cputs(buf, m);
+  80326f:	83 c4 08             	add    $0x8,%esp
+  803272:	53                   	push   %ebx
+  803273:	57                   	push   %edi
+  803274:	e8 a8 e0 ff ff       	call   801321 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803279:	01 de                	add    %ebx,%esi
+  80327b:	83 c4 10             	add    $0x10,%esp
+  80327e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803281:	72 cd                	jb     803250 <devcons_write+0x19>
+}
+  803283:	89 f0                	mov    %esi,%eax
+  803285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803288:	5b                   	pop    %ebx
+  803289:	5e                   	pop    %esi
+  80328a:	5f                   	pop    %edi
+  80328b:	5d                   	pop    %ebp
+  80328c:	c3                   	ret
+
+0080328d <devcons_read>:
+{
+  80328d:	55                   	push   %ebp
+  80328e:	89 e5                	mov    %esp,%ebp
+  803290:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803293:	b8 00 00 00 00       	mov    $0x0,%eax
+  803298:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80329c:	75 07                	jne    8032a5 <devcons_read+0x18>
+  80329e:	eb 1f                	jmp    8032bf <devcons_read+0x32>
+		sys_yield();
+  8032a0:	e8 b5 e1 ff ff       	call   80145a <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8032a5:	e8 bb e0 ff ff       	call   801365 <sys_cgetc>
+  8032aa:	85 c0                	test   %eax,%eax
+  8032ac:	74 f2                	je     8032a0 <devcons_read+0x13>
+	if (c < 0)
+  8032ae:	78 0f                	js     8032bf <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8032b0:	83 f8 04             	cmp    $0x4,%eax
+  8032b3:	74 0c                	je     8032c1 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8032b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032b8:	88 02                	mov    %al,(%edx)
+	return 1;
+  8032ba:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8032bf:	c9                   	leave
+  8032c0:	c3                   	ret
+		return 0;
+  8032c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c6:	eb f7                	jmp    8032bf <devcons_read+0x32>
+
+008032c8 <cputchar>:
+{
+  8032c8:	55                   	push   %ebp
+  8032c9:	89 e5                	mov    %esp,%ebp
+  8032cb:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8032ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8032d4:	6a 01                	push   $0x1
+  8032d6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032d9:	50                   	push   %eax
+  8032da:	e8 42 e0 ff ff       	call   801321 <sys_cputs>
+}
+  8032df:	83 c4 10             	add    $0x10,%esp
+  8032e2:	c9                   	leave
+  8032e3:	c3                   	ret
+
+008032e4 <getchar>:
+{
+  8032e4:	55                   	push   %ebp
+  8032e5:	89 e5                	mov    %esp,%ebp
+  8032e7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8032ea:	6a 01                	push   $0x1
+  8032ec:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032ef:	50                   	push   %eax
+  8032f0:	6a 00                	push   $0x0
+  8032f2:	e8 22 ef ff ff       	call   802219 <read>
+	if (r < 0)
+  8032f7:	83 c4 10             	add    $0x10,%esp
+  8032fa:	85 c0                	test   %eax,%eax
+  8032fc:	78 06                	js     803304 <getchar+0x20>
+	if (r < 1)
+  8032fe:	74 06                	je     803306 <getchar+0x22>
+	return c;
+  803300:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803304:	c9                   	leave
+  803305:	c3                   	ret
+		return -E_EOF;
+  803306:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80330b:	eb f7                	jmp    803304 <getchar+0x20>
+
+0080330d <iscons>:
+{
+  80330d:	55                   	push   %ebp
+  80330e:	89 e5                	mov    %esp,%ebp
+  803310:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803313:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803316:	50                   	push   %eax
+  803317:	ff 75 08             	push   0x8(%ebp)
+  80331a:	e8 74 ec ff ff       	call   801f93 <fd_lookup>
+  80331f:	83 c4 10             	add    $0x10,%esp
+  803322:	85 c0                	test   %eax,%eax
+  803324:	78 11                	js     803337 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803326:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803329:	8b 15 78 40 80 00    	mov    0x804078,%edx
+  80332f:	39 10                	cmp    %edx,(%eax)
+  803331:	0f 94 c0             	sete   %al
+  803334:	0f b6 c0             	movzbl %al,%eax
+}
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+
+00803339 <opencons>:
+{
+  803339:	55                   	push   %ebp
+  80333a:	89 e5                	mov    %esp,%ebp
+  80333c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80333f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803342:	50                   	push   %eax
+  803343:	e8 f5 eb ff ff       	call   801f3d <fd_alloc>
+  803348:	83 c4 10             	add    $0x10,%esp
+  80334b:	85 c0                	test   %eax,%eax
+  80334d:	78 3a                	js     803389 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80334f:	83 ec 04             	sub    $0x4,%esp
+  803352:	68 07 04 00 00       	push   $0x407
+  803357:	ff 75 f4             	push   -0xc(%ebp)
+  80335a:	6a 00                	push   $0x0
+  80335c:	e8 3f e1 ff ff       	call   8014a0 <sys_page_alloc>
+  803361:	83 c4 10             	add    $0x10,%esp
+  803364:	85 c0                	test   %eax,%eax
+  803366:	78 21                	js     803389 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803368:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80336b:	8b 15 78 40 80 00    	mov    0x804078,%edx
+  803371:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803373:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803376:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80337d:	83 ec 0c             	sub    $0xc,%esp
+  803380:	50                   	push   %eax
+  803381:	e8 90 eb ff ff       	call   801f16 <fd2num>
+  803386:	83 c4 10             	add    $0x10,%esp
+}
+  803389:	c9                   	leave
+  80338a:	c3                   	ret
+
+0080338b <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  80338b:	55                   	push   %ebp
+  80338c:	89 e5                	mov    %esp,%ebp
+  80338e:	56                   	push   %esi
+  80338f:	53                   	push   %ebx
+  803390:	8b 75 08             	mov    0x8(%ebp),%esi
+  803393:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803396:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803399:	85 c0                	test   %eax,%eax
+  80339b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033a0:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8033a3:	83 ec 08             	sub    $0x8,%esp
+  8033a6:	ff 75 14             	push   0x14(%ebp)
+  8033a9:	50                   	push   %eax
+  8033aa:	e8 02 e5 ff ff       	call   8018b1 <sys_ipc_recv_until>
+  8033af:	83 c4 10             	add    $0x10,%esp
+  8033b2:	85 c0                	test   %eax,%eax
+  8033b4:	78 61                	js     803417 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8033b6:	85 f6                	test   %esi,%esi
+  8033b8:	74 1c                	je     8033d6 <ipc_recv_until+0x4b>
+  8033ba:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8033bc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8033c1:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8033c7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8033cc:	76 5f                	jbe    80342d <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8033ce:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8033d4:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8033d6:	85 db                	test   %ebx,%ebx
+  8033d8:	74 1c                	je     8033f6 <ipc_recv_until+0x6b>
+  8033da:	89 e0                	mov    %esp,%eax
+  8033dc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8033e1:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8033e7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8033ec:	76 50                	jbe    80343e <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8033ee:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8033f4:	89 03                	mov    %eax,(%ebx)
+  8033f6:	89 e0                	mov    %esp,%eax
+  8033f8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8033fd:	8b 15 1c 50 80 00    	mov    0x80501c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803403:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803408:	76 45                	jbe    80344f <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  80340a:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  803410:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803413:	5b                   	pop    %ebx
+  803414:	5e                   	pop    %esi
+  803415:	5d                   	pop    %ebp
+  803416:	c3                   	ret
+		if (from_env_store)
+  803417:	85 f6                	test   %esi,%esi
+  803419:	74 06                	je     803421 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  80341b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  803421:	85 db                	test   %ebx,%ebx
+  803423:	74 eb                	je     803410 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803425:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80342b:	eb e3                	jmp    803410 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80342d:	c1 e8 10             	shr    $0x10,%eax
+  803430:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803436:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80343c:	eb 90                	jmp    8033ce <ipc_recv_until+0x43>
+  80343e:	c1 e8 10             	shr    $0x10,%eax
+  803441:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803447:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80344d:	eb 9f                	jmp    8033ee <ipc_recv_until+0x63>
+  80344f:	c1 e8 10             	shr    $0x10,%eax
+  803452:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803458:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80345e:	eb aa                	jmp    80340a <ipc_recv_until+0x7f>
+
+00803460 <ipc_recv>:
+{
+  803460:	55                   	push   %ebp
+  803461:	89 e5                	mov    %esp,%ebp
+  803463:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803466:	6a 00                	push   $0x0
+  803468:	ff 75 10             	push   0x10(%ebp)
+  80346b:	ff 75 0c             	push   0xc(%ebp)
+  80346e:	ff 75 08             	push   0x8(%ebp)
+  803471:	e8 15 ff ff ff       	call   80338b <ipc_recv_until>
+}
+  803476:	c9                   	leave
+  803477:	c3                   	ret
+
+00803478 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803478:	55                   	push   %ebp
+  803479:	89 e5                	mov    %esp,%ebp
+  80347b:	57                   	push   %edi
+  80347c:	56                   	push   %esi
+  80347d:	53                   	push   %ebx
+  80347e:	83 ec 0c             	sub    $0xc,%esp
+  803481:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803484:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803487:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80348a:	85 db                	test   %ebx,%ebx
+  80348c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803491:	0f 44 d8             	cmove  %eax,%ebx
+  803494:	eb 05                	jmp    80349b <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803496:	e8 bf df ff ff       	call   80145a <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  80349b:	ff 75 14             	push   0x14(%ebp)
+  80349e:	53                   	push   %ebx
+  80349f:	56                   	push   %esi
+  8034a0:	57                   	push   %edi
+  8034a1:	e8 57 e3 ff ff       	call   8017fd <sys_ipc_try_send>
+  8034a6:	83 c4 10             	add    $0x10,%esp
+  8034a9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8034ac:	74 e8                	je     803496 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	78 08                	js     8034ba <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8034b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034b5:	5b                   	pop    %ebx
+  8034b6:	5e                   	pop    %esi
+  8034b7:	5f                   	pop    %edi
+  8034b8:	5d                   	pop    %ebp
+  8034b9:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8034ba:	50                   	push   %eax
+  8034bb:	68 92 3c 80 00       	push   $0x803c92
+  8034c0:	6a 4f                	push   $0x4f
+  8034c2:	68 a5 3c 80 00       	push   $0x803ca5
+  8034c7:	e8 b9 d3 ff ff       	call   800885 <_panic>
+
+008034cc <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8034cc:	55                   	push   %ebp
+  8034cd:	89 e5                	mov    %esp,%ebp
+  8034cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8034d2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8034d7:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8034dd:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8034e3:	8b 52 50             	mov    0x50(%edx),%edx
+  8034e6:	39 ca                	cmp    %ecx,%edx
+  8034e8:	74 11                	je     8034fb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8034ea:	83 c0 01             	add    $0x1,%eax
+  8034ed:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8034f2:	75 e3                	jne    8034d7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8034f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f9:	eb 0e                	jmp    803509 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8034fb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803501:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803506:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803509:	5d                   	pop    %ebp
+  80350a:	c3                   	ret
+
+0080350b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80350b:	55                   	push   %ebp
+  80350c:	89 e5                	mov    %esp,%ebp
+  80350e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803511:	89 c2                	mov    %eax,%edx
+  803513:	c1 ea 16             	shr    $0x16,%edx
+  803516:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80351d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803522:	f6 c1 01             	test   $0x1,%cl
+  803525:	74 1a                	je     803541 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803527:	c1 e8 0c             	shr    $0xc,%eax
+  80352a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803531:	a8 01                	test   $0x1,%al
+  803533:	74 0c                	je     803541 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803535:	c1 e8 0c             	shr    $0xc,%eax
+  803538:	c1 e0 04             	shl    $0x4,%eax
+  80353b:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803541:	89 d0                	mov    %edx,%eax
+  803543:	5d                   	pop    %ebp
+  803544:	c3                   	ret
@@ -0,0 +1,7233 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 01 00 00       	call   800134 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+	int fd, n, r;
+	char buf[512+1];
+
+	binaryname = "icode";
+  80003e:	c7 05 00 40 80 00 c0 	movl   $0x8035c0,0x804000
+  800045:	35 80 00 
+
+	cprintf("icode startup\n");
+  800048:	68 c6 35 80 00       	push   $0x8035c6
+  80004d:	e8 81 02 00 00       	call   8002d3 <cprintf>
+
+	cprintf("icode: open /motd\n");
+  800052:	c7 04 24 d5 35 80 00 	movl   $0x8035d5,(%esp)
+  800059:	e8 75 02 00 00       	call   8002d3 <cprintf>
+	if ((fd = open("/motd", O_RDONLY)) < 0)
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 e8 35 80 00       	push   $0x8035e8
+  800068:	e8 e2 1f 00 00       	call   80204f <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+		panic("icode: open /motd: %e", fd);
+
+	cprintf("icode: read /motd\n");
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 11 36 80 00       	push   $0x803611
+  80007e:	e8 50 02 00 00       	call   8002d3 <cprintf>
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+		panic("icode: open /motd: %e", fd);
+  80008e:	50                   	push   %eax
+  80008f:	68 ee 35 80 00       	push   $0x8035ee
+  800094:	6a 0f                	push   $0xf
+  800096:	68 04 36 80 00       	push   $0x803604
+  80009b:	e8 58 01 00 00       	call   8001f8 <_panic>
+		sys_cputs(buf, n);
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 ea 0b 00 00       	call   800c94 <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 d0 1a 00 00       	call   801b8c <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+
+	cprintf("icode: close /motd\n");
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 24 36 80 00       	push   $0x803624
+  8000cb:	e8 03 02 00 00       	call   8002d3 <cprintf>
+	close(fd);
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 78 19 00 00       	call   801a50 <close>
+
+	cprintf("icode: spawn /init\n");
+  8000d8:	c7 04 24 38 36 80 00 	movl   $0x803638,(%esp)
+  8000df:	e8 ef 01 00 00       	call   8002d3 <cprintf>
+	if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 4c 36 80 00       	push   $0x80364c
+  8000f0:	68 55 36 80 00       	push   $0x803655
+  8000f5:	68 5f 36 80 00       	push   $0x80365f
+  8000fa:	68 5e 36 80 00       	push   $0x80365e
+  8000ff:	e8 c6 26 00 00       	call   8027ca <spawnl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 17                	js     800122 <umain+0xef>
+		panic("icode: spawn /init: %e", r);
+
+	cprintf("icode: exiting\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 7b 36 80 00       	push   $0x80367b
+  800113:	e8 bb 01 00 00       	call   8002d3 <cprintf>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+		panic("icode: spawn /init: %e", r);
+  800122:	50                   	push   %eax
+  800123:	68 64 36 80 00       	push   $0x803664
+  800128:	6a 1a                	push   $0x1a
+  80012a:	68 04 36 80 00       	push   $0x803604
+  80012f:	e8 c4 00 00 00       	call   8001f8 <_panic>
+
+00800134 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	57                   	push   %edi
+  800138:	56                   	push   %esi
+  800139:	53                   	push   %ebx
+  80013a:	83 ec 0c             	sub    $0xc,%esp
+  80013d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800140:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800143:	b8 01 00 00 00       	mov    $0x1,%eax
+  800148:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80014a:	c1 ea 0b             	shr    $0xb,%edx
+  80014d:	83 f2 01             	xor    $0x1,%edx
+  800150:	83 e2 01             	and    $0x1,%edx
+  800153:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800159:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800160:	00 00 00 
+	envid = sys_getenvid();
+  800163:	e8 1f 0c 00 00       	call   800d87 <sys_getenvid>
+  800168:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80016f:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800175:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80017b:	8b 52 48             	mov    0x48(%edx),%edx
+  80017e:	39 ca                	cmp    %ecx,%edx
+  800180:	74 27                	je     8001a9 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800182:	83 c0 01             	add    $0x1,%eax
+  800185:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80018a:	75 e3                	jne    80016f <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80018c:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800193:	75 24                	jne    8001b9 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800195:	83 ec 04             	sub    $0x4,%esp
+  800198:	68 8c 36 80 00       	push   $0x80368c
+  80019d:	6a 23                	push   $0x23
+  80019f:	68 af 36 80 00       	push   $0x8036af
+  8001a4:	e8 4f 00 00 00       	call   8001f8 <_panic>
+			mainenv = &envs[i];
+  8001a9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001b4:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001b9:	85 ff                	test   %edi,%edi
+  8001bb:	7e 07                	jle    8001c4 <libmain+0x90>
+		binaryname = argv[0];
+  8001bd:	8b 06                	mov    (%esi),%eax
+  8001bf:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001c4:	83 ec 08             	sub    $0x8,%esp
+  8001c7:	56                   	push   %esi
+  8001c8:	57                   	push   %edi
+  8001c9:	e8 65 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001ce:	e8 0b 00 00 00       	call   8001de <exit>
+}
+  8001d3:	83 c4 10             	add    $0x10,%esp
+  8001d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d9:	5b                   	pop    %ebx
+  8001da:	5e                   	pop    %esi
+  8001db:	5f                   	pop    %edi
+  8001dc:	5d                   	pop    %ebp
+  8001dd:	c3                   	ret
+
+008001de <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001e4:	e8 94 18 00 00       	call   801a7d <close_all>
+	sys_env_destroy(0);
+  8001e9:	83 ec 0c             	sub    $0xc,%esp
+  8001ec:	6a 00                	push   $0x0
+  8001ee:	e8 2b 0b 00 00       	call   800d1e <sys_env_destroy>
+}
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	c9                   	leave
+  8001f7:	c3                   	ret
+
+008001f8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f8:	55                   	push   %ebp
+  8001f9:	89 e5                	mov    %esp,%ebp
+  8001fb:	56                   	push   %esi
+  8001fc:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001fd:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800200:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800206:	e8 7c 0b 00 00       	call   800d87 <sys_getenvid>
+  80020b:	83 ec 0c             	sub    $0xc,%esp
+  80020e:	ff 75 0c             	push   0xc(%ebp)
+  800211:	ff 75 08             	push   0x8(%ebp)
+  800214:	56                   	push   %esi
+  800215:	50                   	push   %eax
+  800216:	68 c8 36 80 00       	push   $0x8036c8
+  80021b:	e8 b3 00 00 00       	call   8002d3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800220:	83 c4 18             	add    $0x18,%esp
+  800223:	53                   	push   %ebx
+  800224:	ff 75 10             	push   0x10(%ebp)
+  800227:	e8 56 00 00 00       	call   800282 <vcprintf>
+	cprintf("\n");
+  80022c:	c7 04 24 54 3b 80 00 	movl   $0x803b54,(%esp)
+  800233:	e8 9b 00 00 00       	call   8002d3 <cprintf>
+  800238:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80023b:	cc                   	int3
+	while (1)
+  80023c:	eb fd                	jmp    80023b <_panic+0x43>
+
+0080023e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80023e:	55                   	push   %ebp
+  80023f:	89 e5                	mov    %esp,%ebp
+  800241:	53                   	push   %ebx
+  800242:	83 ec 04             	sub    $0x4,%esp
+  800245:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800248:	8b 13                	mov    (%ebx),%edx
+  80024a:	8d 42 01             	lea    0x1(%edx),%eax
+  80024d:	89 03                	mov    %eax,(%ebx)
+  80024f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800252:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800256:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80025b:	74 09                	je     800266 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80025d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800264:	c9                   	leave
+  800265:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800266:	83 ec 08             	sub    $0x8,%esp
+  800269:	68 ff 00 00 00       	push   $0xff
+  80026e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800271:	50                   	push   %eax
+  800272:	e8 1d 0a 00 00       	call   800c94 <sys_cputs>
+		b->idx = 0;
+  800277:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80027d:	83 c4 10             	add    $0x10,%esp
+  800280:	eb db                	jmp    80025d <putch+0x1f>
+
+00800282 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800282:	55                   	push   %ebp
+  800283:	89 e5                	mov    %esp,%ebp
+  800285:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80028b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800292:	00 00 00 
+	b.cnt = 0;
+  800295:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80029c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80029f:	ff 75 0c             	push   0xc(%ebp)
+  8002a2:	ff 75 08             	push   0x8(%ebp)
+  8002a5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002ab:	50                   	push   %eax
+  8002ac:	68 3e 02 80 00       	push   $0x80023e
+  8002b1:	e8 fb 00 00 00       	call   8003b1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002b6:	83 c4 08             	add    $0x8,%esp
+  8002b9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002bf:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c5:	50                   	push   %eax
+  8002c6:	e8 c9 09 00 00       	call   800c94 <sys_cputs>
+
+	return b.cnt;
+}
+  8002cb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002d1:	c9                   	leave
+  8002d2:	c3                   	ret
+
+008002d3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002d3:	55                   	push   %ebp
+  8002d4:	89 e5                	mov    %esp,%ebp
+  8002d6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002d9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002dc:	50                   	push   %eax
+  8002dd:	ff 75 08             	push   0x8(%ebp)
+  8002e0:	e8 9d ff ff ff       	call   800282 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002e5:	c9                   	leave
+  8002e6:	c3                   	ret
+
+008002e7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8002e7:	55                   	push   %ebp
+  8002e8:	89 e5                	mov    %esp,%ebp
+  8002ea:	57                   	push   %edi
+  8002eb:	56                   	push   %esi
+  8002ec:	53                   	push   %ebx
+  8002ed:	83 ec 1c             	sub    $0x1c,%esp
+  8002f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002f3:	89 d6                	mov    %edx,%esi
+  8002f5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002fb:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002fe:	73 0b                	jae    80030b <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800300:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800303:	c1 e7 08             	shl    $0x8,%edi
+  800306:	0b 7d 10             	or     0x10(%ebp),%edi
+  800309:	eb 36                	jmp    800341 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80030b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80030e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800313:	f7 75 08             	divl   0x8(%ebp)
+  800316:	89 c1                	mov    %eax,%ecx
+  800318:	ff 75 14             	push   0x14(%ebp)
+  80031b:	ff 75 10             	push   0x10(%ebp)
+  80031e:	83 eb 01             	sub    $0x1,%ebx
+  800321:	53                   	push   %ebx
+  800322:	ff 75 08             	push   0x8(%ebp)
+  800325:	89 f2                	mov    %esi,%edx
+  800327:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80032a:	e8 b8 ff ff ff       	call   8002e7 <printnum>
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	eb 14                	jmp    800348 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800334:	83 ec 08             	sub    $0x8,%esp
+  800337:	56                   	push   %esi
+  800338:	57                   	push   %edi
+  800339:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80033c:	ff d0                	call   *%eax
+  80033e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800341:	83 eb 01             	sub    $0x1,%ebx
+  800344:	85 db                	test   %ebx,%ebx
+  800346:	7f ec                	jg     800334 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800348:	83 ec 08             	sub    $0x8,%esp
+  80034b:	56                   	push   %esi
+  80034c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80034f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800354:	f7 75 08             	divl   0x8(%ebp)
+  800357:	0f be 92 eb 36 80 00 	movsbl 0x8036eb(%edx),%edx
+  80035e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800361:	c1 e0 08             	shl    $0x8,%eax
+  800364:	09 d0                	or     %edx,%eax
+  800366:	50                   	push   %eax
+  800367:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80036a:	ff d0                	call   *%eax
+}
+  80036c:	83 c4 10             	add    $0x10,%esp
+  80036f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800372:	5b                   	pop    %ebx
+  800373:	5e                   	pop    %esi
+  800374:	5f                   	pop    %edi
+  800375:	5d                   	pop    %ebp
+  800376:	c3                   	ret
+
+00800377 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800377:	55                   	push   %ebp
+  800378:	89 e5                	mov    %esp,%ebp
+  80037a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80037d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800381:	8b 10                	mov    (%eax),%edx
+  800383:	3b 50 04             	cmp    0x4(%eax),%edx
+  800386:	73 0a                	jae    800392 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800388:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80038b:	89 08                	mov    %ecx,(%eax)
+  80038d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800390:	88 02                	mov    %al,(%edx)
+}
+  800392:	5d                   	pop    %ebp
+  800393:	c3                   	ret
+
+00800394 <printfmt>:
+{
+  800394:	55                   	push   %ebp
+  800395:	89 e5                	mov    %esp,%ebp
+  800397:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80039a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80039d:	50                   	push   %eax
+  80039e:	ff 75 10             	push   0x10(%ebp)
+  8003a1:	ff 75 0c             	push   0xc(%ebp)
+  8003a4:	ff 75 08             	push   0x8(%ebp)
+  8003a7:	e8 05 00 00 00       	call   8003b1 <vprintfmt>
+}
+  8003ac:	83 c4 10             	add    $0x10,%esp
+  8003af:	c9                   	leave
+  8003b0:	c3                   	ret
+
+008003b1 <vprintfmt>:
+{
+  8003b1:	55                   	push   %ebp
+  8003b2:	89 e5                	mov    %esp,%ebp
+  8003b4:	57                   	push   %edi
+  8003b5:	56                   	push   %esi
+  8003b6:	53                   	push   %ebx
+  8003b7:	83 ec 3c             	sub    $0x3c,%esp
+  8003ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8003bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8003c0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003c7:	eb 16                	jmp    8003df <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8003c9:	83 ec 08             	sub    $0x8,%esp
+  8003cc:	ff 75 0c             	push   0xc(%ebp)
+  8003cf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003d2:	c1 e2 08             	shl    $0x8,%edx
+  8003d5:	09 d0                	or     %edx,%eax
+  8003d7:	50                   	push   %eax
+  8003d8:	ff d7                	call   *%edi
+  8003da:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003dd:	89 de                	mov    %ebx,%esi
+  8003df:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003e2:	0f b6 06             	movzbl (%esi),%eax
+  8003e5:	83 f8 25             	cmp    $0x25,%eax
+  8003e8:	74 0c                	je     8003f6 <vprintfmt+0x45>
+			if (ch == '\0')
+  8003ea:	85 c0                	test   %eax,%eax
+  8003ec:	75 db                	jne    8003c9 <vprintfmt+0x18>
+}
+  8003ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f1:	5b                   	pop    %ebx
+  8003f2:	5e                   	pop    %esi
+  8003f3:	5f                   	pop    %edi
+  8003f4:	5d                   	pop    %ebp
+  8003f5:	c3                   	ret
+		padc = ' ';
+  8003f6:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003fa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800401:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800408:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80040f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800414:	8d 73 01             	lea    0x1(%ebx),%esi
+  800417:	0f b6 13             	movzbl (%ebx),%edx
+  80041a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80041d:	3c 55                	cmp    $0x55,%al
+  80041f:	0f 87 2c 04 00 00    	ja     800851 <vprintfmt+0x4a0>
+  800425:	0f b6 c0             	movzbl %al,%eax
+  800428:	ff 24 85 40 38 80 00 	jmp    *0x803840(,%eax,4)
+  80042f:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800431:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800435:	eb dd                	jmp    800414 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800437:	89 f3                	mov    %esi,%ebx
+  800439:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80043d:	eb d5                	jmp    800414 <vprintfmt+0x63>
+  80043f:	0f b6 d2             	movzbl %dl,%edx
+  800442:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800444:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800449:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80044c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800450:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800453:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800456:	83 fe 09             	cmp    $0x9,%esi
+  800459:	0f 87 8a 00 00 00    	ja     8004e9 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80045f:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800462:	eb e5                	jmp    800449 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800464:	8b 45 14             	mov    0x14(%ebp),%eax
+  800467:	8b 00                	mov    (%eax),%eax
+  800469:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80046c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046f:	8d 40 04             	lea    0x4(%eax),%eax
+  800472:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800475:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800477:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047b:	79 97                	jns    800414 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80047d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800483:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80048a:	eb 88                	jmp    800414 <vprintfmt+0x63>
+			if (width < 0)
+  80048c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80048f:	85 db                	test   %ebx,%ebx
+  800491:	b8 00 00 00 00       	mov    $0x0,%eax
+  800496:	0f 49 c3             	cmovns %ebx,%eax
+  800499:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80049c:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80049e:	e9 71 ff ff ff       	jmp    800414 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a3:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8004a5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004ac:	e9 63 ff ff ff       	jmp    800414 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8004b1:	8d 73 02             	lea    0x2(%ebx),%esi
+  8004b4:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8004b8:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8004bf:	3c 67                	cmp    $0x67,%al
+  8004c1:	0f 84 18 ff ff ff    	je     8003df <vprintfmt+0x2e>
+					attrib = 0x04;
+  8004c7:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8004ce:	3c 72                	cmp    $0x72,%al
+  8004d0:	0f 84 09 ff ff ff    	je     8003df <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004d6:	3c 62                	cmp    $0x62,%al
+  8004d8:	0f 94 c0             	sete   %al
+  8004db:	0f b6 c0             	movzbl %al,%eax
+  8004de:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004e4:	e9 f6 fe ff ff       	jmp    8003df <vprintfmt+0x2e>
+  8004e9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ec:	eb 89                	jmp    800477 <vprintfmt+0xc6>
+			lflag++;
+  8004ee:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f1:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004f3:	e9 1c ff ff ff       	jmp    800414 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fb:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	ff 75 0c             	push   0xc(%ebp)
+  800504:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800507:	c1 e0 08             	shl    $0x8,%eax
+  80050a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80050d:	0b 01                	or     (%ecx),%eax
+  80050f:	50                   	push   %eax
+  800510:	ff d7                	call   *%edi
+			break;
+  800512:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800515:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800518:	e9 c2 fe ff ff       	jmp    8003df <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80051d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800520:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800523:	8b 10                	mov    (%eax),%edx
+  800525:	89 d0                	mov    %edx,%eax
+  800527:	f7 d8                	neg    %eax
+  800529:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80052c:	83 f8 12             	cmp    $0x12,%eax
+  80052f:	7f 25                	jg     800556 <vprintfmt+0x1a5>
+  800531:	8b 14 85 a0 39 80 00 	mov    0x8039a0(,%eax,4),%edx
+  800538:	85 d2                	test   %edx,%edx
+  80053a:	74 1a                	je     800556 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80053c:	52                   	push   %edx
+  80053d:	68 e1 3a 80 00       	push   $0x803ae1
+  800542:	ff 75 0c             	push   0xc(%ebp)
+  800545:	57                   	push   %edi
+  800546:	e8 49 fe ff ff       	call   800394 <printfmt>
+  80054b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80054e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800551:	e9 89 fe ff ff       	jmp    8003df <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800556:	50                   	push   %eax
+  800557:	68 03 37 80 00       	push   $0x803703
+  80055c:	ff 75 0c             	push   0xc(%ebp)
+  80055f:	57                   	push   %edi
+  800560:	e8 2f fe ff ff       	call   800394 <printfmt>
+  800565:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800568:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80056b:	e9 6f fe ff ff       	jmp    8003df <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	83 c0 04             	add    $0x4,%eax
+  800576:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80057e:	85 c9                	test   %ecx,%ecx
+  800580:	b8 fc 36 80 00       	mov    $0x8036fc,%eax
+  800585:	0f 45 c1             	cmovne %ecx,%eax
+  800588:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80058b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80058f:	7e 06                	jle    800597 <vprintfmt+0x1e6>
+  800591:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800595:	75 1a                	jne    8005b1 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800597:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80059a:	c1 e0 08             	shl    $0x8,%eax
+  80059d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8005a0:	83 c8 3f             	or     $0x3f,%eax
+  8005a3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005a6:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8005a9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005ac:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8005af:	eb 6d                	jmp    80061e <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005b1:	83 ec 08             	sub    $0x8,%esp
+  8005b4:	ff 75 d0             	push   -0x30(%ebp)
+  8005b7:	ff 75 c8             	push   -0x38(%ebp)
+  8005ba:	e8 39 03 00 00       	call   8008f8 <strnlen>
+  8005bf:	89 c2                	mov    %eax,%edx
+  8005c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c4:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8005c6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005c9:	c1 e1 08             	shl    $0x8,%ecx
+  8005cc:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8005d0:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d2:	83 c4 10             	add    $0x10,%esp
+  8005d5:	89 c3                	mov    %eax,%ebx
+  8005d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005da:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005dd:	89 ce                	mov    %ecx,%esi
+  8005df:	eb 0f                	jmp    8005f0 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	ff 75 0c             	push   0xc(%ebp)
+  8005e7:	56                   	push   %esi
+  8005e8:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ea:	83 eb 01             	sub    $0x1,%ebx
+  8005ed:	83 c4 10             	add    $0x10,%esp
+  8005f0:	85 db                	test   %ebx,%ebx
+  8005f2:	7f ed                	jg     8005e1 <vprintfmt+0x230>
+  8005f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005fa:	85 c0                	test   %eax,%eax
+  8005fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800601:	0f 49 d0             	cmovns %eax,%edx
+  800604:	29 d0                	sub    %edx,%eax
+  800606:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800609:	eb 8c                	jmp    800597 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80060b:	83 ec 08             	sub    $0x8,%esp
+  80060e:	ff 75 0c             	push   0xc(%ebp)
+  800611:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800614:	09 c2                	or     %eax,%edx
+  800616:	52                   	push   %edx
+  800617:	ff d7                	call   *%edi
+  800619:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80061c:	89 d9                	mov    %ebx,%ecx
+  80061e:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800621:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800625:	0f be d0             	movsbl %al,%edx
+  800628:	85 d2                	test   %edx,%edx
+  80062a:	74 2a                	je     800656 <vprintfmt+0x2a5>
+  80062c:	85 f6                	test   %esi,%esi
+  80062e:	78 05                	js     800635 <vprintfmt+0x284>
+  800630:	83 ee 01             	sub    $0x1,%esi
+  800633:	78 3b                	js     800670 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800635:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800639:	74 d0                	je     80060b <vprintfmt+0x25a>
+  80063b:	0f be c0             	movsbl %al,%eax
+  80063e:	83 e8 20             	sub    $0x20,%eax
+  800641:	83 f8 5e             	cmp    $0x5e,%eax
+  800644:	76 c5                	jbe    80060b <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800646:	83 ec 08             	sub    $0x8,%esp
+  800649:	ff 75 0c             	push   0xc(%ebp)
+  80064c:	ff 75 cc             	push   -0x34(%ebp)
+  80064f:	ff d7                	call   *%edi
+  800651:	83 c4 10             	add    $0x10,%esp
+  800654:	eb c6                	jmp    80061c <vprintfmt+0x26b>
+  800656:	8b 75 10             	mov    0x10(%ebp),%esi
+  800659:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80065c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80065f:	01 c3                	add    %eax,%ebx
+  800661:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800663:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800666:	83 c8 20             	or     $0x20,%eax
+  800669:	89 75 10             	mov    %esi,0x10(%ebp)
+  80066c:	89 c6                	mov    %eax,%esi
+  80066e:	eb 14                	jmp    800684 <vprintfmt+0x2d3>
+  800670:	8b 75 10             	mov    0x10(%ebp),%esi
+  800673:	eb e4                	jmp    800659 <vprintfmt+0x2a8>
+  800675:	83 ec 08             	sub    $0x8,%esp
+  800678:	ff 75 0c             	push   0xc(%ebp)
+  80067b:	56                   	push   %esi
+  80067c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80067e:	83 eb 01             	sub    $0x1,%ebx
+  800681:	83 c4 10             	add    $0x10,%esp
+  800684:	85 db                	test   %ebx,%ebx
+  800686:	7f ed                	jg     800675 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800688:	8b 75 10             	mov    0x10(%ebp),%esi
+  80068b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800691:	e9 49 fd ff ff       	jmp    8003df <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800696:	83 f9 01             	cmp    $0x1,%ecx
+  800699:	7f 1f                	jg     8006ba <vprintfmt+0x309>
+	else if (lflag)
+  80069b:	85 c9                	test   %ecx,%ecx
+  80069d:	74 69                	je     800708 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80069f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a2:	8b 00                	mov    (%eax),%eax
+  8006a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a7:	89 c1                	mov    %eax,%ecx
+  8006a9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ac:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b8:	eb 17                	jmp    8006d1 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8006ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bd:	8b 50 04             	mov    0x4(%eax),%edx
+  8006c0:	8b 00                	mov    (%eax),%eax
+  8006c2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006d1:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006d4:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006dc:	85 db                	test   %ebx,%ebx
+  8006de:	0f 89 f6 00 00 00    	jns    8007da <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	ff 75 0c             	push   0xc(%ebp)
+  8006ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006ed:	c1 e0 08             	shl    $0x8,%eax
+  8006f0:	83 c8 2d             	or     $0x2d,%eax
+  8006f3:	50                   	push   %eax
+  8006f4:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006f6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006f9:	f7 d9                	neg    %ecx
+  8006fb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800703:	e9 d2 00 00 00       	jmp    8007da <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 00                	mov    (%eax),%eax
+  80070d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800710:	89 c1                	mov    %eax,%ecx
+  800712:	c1 f9 1f             	sar    $0x1f,%ecx
+  800715:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8d 40 04             	lea    0x4(%eax),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800721:	eb ae                	jmp    8006d1 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800723:	83 f9 01             	cmp    $0x1,%ecx
+  800726:	7f 19                	jg     800741 <vprintfmt+0x390>
+	else if (lflag)
+  800728:	85 c9                	test   %ecx,%ecx
+  80072a:	74 2a                	je     800756 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80072c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072f:	8b 08                	mov    (%eax),%ecx
+  800731:	8d 40 04             	lea    0x4(%eax),%eax
+  800734:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800737:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80073c:	e9 99 00 00 00       	jmp    8007da <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800741:	8b 45 14             	mov    0x14(%ebp),%eax
+  800744:	8b 08                	mov    (%eax),%ecx
+  800746:	8d 40 08             	lea    0x8(%eax),%eax
+  800749:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80074c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800751:	e9 84 00 00 00       	jmp    8007da <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	8b 08                	mov    (%eax),%ecx
+  80075b:	8d 40 04             	lea    0x4(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800761:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800766:	eb 72                	jmp    8007da <vprintfmt+0x429>
+	if (lflag >= 2)
+  800768:	83 f9 01             	cmp    $0x1,%ecx
+  80076b:	7f 16                	jg     800783 <vprintfmt+0x3d2>
+	else if (lflag)
+  80076d:	85 c9                	test   %ecx,%ecx
+  80076f:	74 24                	je     800795 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 08                	mov    (%eax),%ecx
+  800776:	8d 40 04             	lea    0x4(%eax),%eax
+  800779:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80077c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800781:	eb 57                	jmp    8007da <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800783:	8b 45 14             	mov    0x14(%ebp),%eax
+  800786:	8b 08                	mov    (%eax),%ecx
+  800788:	8d 40 08             	lea    0x8(%eax),%eax
+  80078b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800793:	eb 45                	jmp    8007da <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800795:	8b 45 14             	mov    0x14(%ebp),%eax
+  800798:	8b 08                	mov    (%eax),%ecx
+  80079a:	8d 40 04             	lea    0x4(%eax),%eax
+  80079d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007a0:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8007a5:	eb 33                	jmp    8007da <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8007a7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007aa:	c1 e3 08             	shl    $0x8,%ebx
+  8007ad:	83 ec 08             	sub    $0x8,%esp
+  8007b0:	ff 75 0c             	push   0xc(%ebp)
+  8007b3:	89 d8                	mov    %ebx,%eax
+  8007b5:	83 c8 30             	or     $0x30,%eax
+  8007b8:	50                   	push   %eax
+  8007b9:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8007bb:	83 c4 08             	add    $0x8,%esp
+  8007be:	ff 75 0c             	push   0xc(%ebp)
+  8007c1:	83 cb 78             	or     $0x78,%ebx
+  8007c4:	53                   	push   %ebx
+  8007c5:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ca:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8007cc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d5:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007da:	ff 75 e4             	push   -0x1c(%ebp)
+  8007dd:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007e1:	52                   	push   %edx
+  8007e2:	ff 75 e0             	push   -0x20(%ebp)
+  8007e5:	50                   	push   %eax
+  8007e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e9:	89 f8                	mov    %edi,%eax
+  8007eb:	e8 f7 fa ff ff       	call   8002e7 <printnum>
+			break;
+  8007f0:	83 c4 10             	add    $0x10,%esp
+  8007f3:	e9 e7 fb ff ff       	jmp    8003df <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007f8:	83 f9 01             	cmp    $0x1,%ecx
+  8007fb:	7f 16                	jg     800813 <vprintfmt+0x462>
+	else if (lflag)
+  8007fd:	85 c9                	test   %ecx,%ecx
+  8007ff:	74 24                	je     800825 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800801:	8b 45 14             	mov    0x14(%ebp),%eax
+  800804:	8b 08                	mov    (%eax),%ecx
+  800806:	8d 40 04             	lea    0x4(%eax),%eax
+  800809:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800811:	eb c7                	jmp    8007da <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800813:	8b 45 14             	mov    0x14(%ebp),%eax
+  800816:	8b 08                	mov    (%eax),%ecx
+  800818:	8d 40 08             	lea    0x8(%eax),%eax
+  80081b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800823:	eb b5                	jmp    8007da <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800825:	8b 45 14             	mov    0x14(%ebp),%eax
+  800828:	8b 08                	mov    (%eax),%ecx
+  80082a:	8d 40 04             	lea    0x4(%eax),%eax
+  80082d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800830:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800835:	eb a3                	jmp    8007da <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800837:	83 ec 08             	sub    $0x8,%esp
+  80083a:	ff 75 0c             	push   0xc(%ebp)
+  80083d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800840:	c1 e0 08             	shl    $0x8,%eax
+  800843:	83 c8 25             	or     $0x25,%eax
+  800846:	50                   	push   %eax
+  800847:	ff d7                	call   *%edi
+			break;
+  800849:	83 c4 10             	add    $0x10,%esp
+  80084c:	e9 8e fb ff ff       	jmp    8003df <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800851:	83 ec 08             	sub    $0x8,%esp
+  800854:	ff 75 0c             	push   0xc(%ebp)
+  800857:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80085a:	c1 e0 08             	shl    $0x8,%eax
+  80085d:	83 c8 25             	or     $0x25,%eax
+  800860:	50                   	push   %eax
+  800861:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800863:	83 c4 10             	add    $0x10,%esp
+  800866:	89 de                	mov    %ebx,%esi
+  800868:	eb 03                	jmp    80086d <vprintfmt+0x4bc>
+  80086a:	83 ee 01             	sub    $0x1,%esi
+  80086d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800871:	75 f7                	jne    80086a <vprintfmt+0x4b9>
+  800873:	e9 67 fb ff ff       	jmp    8003df <vprintfmt+0x2e>
+
+00800878 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800878:	55                   	push   %ebp
+  800879:	89 e5                	mov    %esp,%ebp
+  80087b:	83 ec 18             	sub    $0x18,%esp
+  80087e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800881:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800884:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800887:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80088b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80088e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800895:	85 c0                	test   %eax,%eax
+  800897:	74 26                	je     8008bf <vsnprintf+0x47>
+  800899:	85 d2                	test   %edx,%edx
+  80089b:	7e 22                	jle    8008bf <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80089d:	ff 75 14             	push   0x14(%ebp)
+  8008a0:	ff 75 10             	push   0x10(%ebp)
+  8008a3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008a6:	50                   	push   %eax
+  8008a7:	68 77 03 80 00       	push   $0x800377
+  8008ac:	e8 00 fb ff ff       	call   8003b1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008b1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008b4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008ba:	83 c4 10             	add    $0x10,%esp
+}
+  8008bd:	c9                   	leave
+  8008be:	c3                   	ret
+		return -E_INVAL;
+  8008bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008c4:	eb f7                	jmp    8008bd <vsnprintf+0x45>
+
+008008c6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008c6:	55                   	push   %ebp
+  8008c7:	89 e5                	mov    %esp,%ebp
+  8008c9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8008cc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008cf:	50                   	push   %eax
+  8008d0:	ff 75 10             	push   0x10(%ebp)
+  8008d3:	ff 75 0c             	push   0xc(%ebp)
+  8008d6:	ff 75 08             	push   0x8(%ebp)
+  8008d9:	e8 9a ff ff ff       	call   800878 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008de:	c9                   	leave
+  8008df:	c3                   	ret
+
+008008e0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008e0:	55                   	push   %ebp
+  8008e1:	89 e5                	mov    %esp,%ebp
+  8008e3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	eb 03                	jmp    8008f0 <strlen+0x10>
+		n++;
+  8008ed:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008f0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008f4:	75 f7                	jne    8008ed <strlen+0xd>
+	return n;
+}
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+
+008008f8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	eb 03                	jmp    80090b <strnlen+0x13>
+		n++;
+  800908:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80090b:	39 d0                	cmp    %edx,%eax
+  80090d:	74 08                	je     800917 <strnlen+0x1f>
+  80090f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800913:	75 f3                	jne    800908 <strnlen+0x10>
+  800915:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800917:	89 d0                	mov    %edx,%eax
+  800919:	5d                   	pop    %ebp
+  80091a:	c3                   	ret
+
+0080091b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	53                   	push   %ebx
+  80091f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800922:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800925:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80092e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800931:	83 c0 01             	add    $0x1,%eax
+  800934:	84 d2                	test   %dl,%dl
+  800936:	75 f2                	jne    80092a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800938:	89 c8                	mov    %ecx,%eax
+  80093a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093d:	c9                   	leave
+  80093e:	c3                   	ret
+
+0080093f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	53                   	push   %ebx
+  800943:	83 ec 10             	sub    $0x10,%esp
+  800946:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800949:	53                   	push   %ebx
+  80094a:	e8 91 ff ff ff       	call   8008e0 <strlen>
+  80094f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800952:	ff 75 0c             	push   0xc(%ebp)
+  800955:	01 d8                	add    %ebx,%eax
+  800957:	50                   	push   %eax
+  800958:	e8 be ff ff ff       	call   80091b <strcpy>
+	return dst;
+}
+  80095d:	89 d8                	mov    %ebx,%eax
+  80095f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+
+00800964 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800964:	55                   	push   %ebp
+  800965:	89 e5                	mov    %esp,%ebp
+  800967:	56                   	push   %esi
+  800968:	53                   	push   %ebx
+  800969:	8b 75 08             	mov    0x8(%ebp),%esi
+  80096c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80096f:	89 f3                	mov    %esi,%ebx
+  800971:	03 5d 10             	add    0x10(%ebp),%ebx
+  800974:	89 f0                	mov    %esi,%eax
+  800976:	eb 0f                	jmp    800987 <strncpy+0x23>
+		*dst++ = *src;
+  800978:	83 c0 01             	add    $0x1,%eax
+  80097b:	0f b6 0a             	movzbl (%edx),%ecx
+  80097e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800981:	80 f9 01             	cmp    $0x1,%cl
+  800984:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800987:	39 d8                	cmp    %ebx,%eax
+  800989:	75 ed                	jne    800978 <strncpy+0x14>
+	}
+	return ret;
+}
+  80098b:	89 f0                	mov    %esi,%eax
+  80098d:	5b                   	pop    %ebx
+  80098e:	5e                   	pop    %esi
+  80098f:	5d                   	pop    %ebp
+  800990:	c3                   	ret
+
+00800991 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800991:	55                   	push   %ebp
+  800992:	89 e5                	mov    %esp,%ebp
+  800994:	56                   	push   %esi
+  800995:	53                   	push   %ebx
+  800996:	8b 75 08             	mov    0x8(%ebp),%esi
+  800999:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80099c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80099f:	89 f0                	mov    %esi,%eax
+  8009a1:	85 d2                	test   %edx,%edx
+  8009a3:	74 21                	je     8009c6 <strlcpy+0x35>
+  8009a5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009a9:	89 f2                	mov    %esi,%edx
+  8009ab:	eb 09                	jmp    8009b6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009ad:	83 c1 01             	add    $0x1,%ecx
+  8009b0:	83 c2 01             	add    $0x1,%edx
+  8009b3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009b6:	39 c2                	cmp    %eax,%edx
+  8009b8:	74 09                	je     8009c3 <strlcpy+0x32>
+  8009ba:	0f b6 19             	movzbl (%ecx),%ebx
+  8009bd:	84 db                	test   %bl,%bl
+  8009bf:	75 ec                	jne    8009ad <strlcpy+0x1c>
+  8009c1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009c3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009c6:	29 f0                	sub    %esi,%eax
+}
+  8009c8:	5b                   	pop    %ebx
+  8009c9:	5e                   	pop    %esi
+  8009ca:	5d                   	pop    %ebp
+  8009cb:	c3                   	ret
+
+008009cc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009cc:	55                   	push   %ebp
+  8009cd:	89 e5                	mov    %esp,%ebp
+  8009cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009d5:	eb 06                	jmp    8009dd <strcmp+0x11>
+		p++, q++;
+  8009d7:	83 c1 01             	add    $0x1,%ecx
+  8009da:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009dd:	0f b6 01             	movzbl (%ecx),%eax
+  8009e0:	84 c0                	test   %al,%al
+  8009e2:	74 04                	je     8009e8 <strcmp+0x1c>
+  8009e4:	3a 02                	cmp    (%edx),%al
+  8009e6:	74 ef                	je     8009d7 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e8:	0f b6 c0             	movzbl %al,%eax
+  8009eb:	0f b6 12             	movzbl (%edx),%edx
+  8009ee:	29 d0                	sub    %edx,%eax
+}
+  8009f0:	5d                   	pop    %ebp
+  8009f1:	c3                   	ret
+
+008009f2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009f2:	55                   	push   %ebp
+  8009f3:	89 e5                	mov    %esp,%ebp
+  8009f5:	53                   	push   %ebx
+  8009f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009fc:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009ff:	eb 09                	jmp    800a0a <strncmp+0x18>
+		n--, p++, q++;
+  800a01:	83 ea 01             	sub    $0x1,%edx
+  800a04:	83 c0 01             	add    $0x1,%eax
+  800a07:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a0a:	85 d2                	test   %edx,%edx
+  800a0c:	74 18                	je     800a26 <strncmp+0x34>
+  800a0e:	0f b6 18             	movzbl (%eax),%ebx
+  800a11:	84 db                	test   %bl,%bl
+  800a13:	74 04                	je     800a19 <strncmp+0x27>
+  800a15:	3a 19                	cmp    (%ecx),%bl
+  800a17:	74 e8                	je     800a01 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a19:	0f b6 00             	movzbl (%eax),%eax
+  800a1c:	0f b6 11             	movzbl (%ecx),%edx
+  800a1f:	29 d0                	sub    %edx,%eax
+}
+  800a21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a24:	c9                   	leave
+  800a25:	c3                   	ret
+		return 0;
+  800a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2b:	eb f4                	jmp    800a21 <strncmp+0x2f>
+
+00800a2d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a33:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a37:	eb 03                	jmp    800a3c <strchr+0xf>
+  800a39:	83 c0 01             	add    $0x1,%eax
+  800a3c:	0f b6 10             	movzbl (%eax),%edx
+  800a3f:	84 d2                	test   %dl,%dl
+  800a41:	74 06                	je     800a49 <strchr+0x1c>
+		if (*s == c)
+  800a43:	38 ca                	cmp    %cl,%dl
+  800a45:	75 f2                	jne    800a39 <strchr+0xc>
+  800a47:	eb 05                	jmp    800a4e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a4e:	5d                   	pop    %ebp
+  800a4f:	c3                   	ret
+
+00800a50 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a5a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a5d:	38 ca                	cmp    %cl,%dl
+  800a5f:	74 09                	je     800a6a <strfind+0x1a>
+  800a61:	84 d2                	test   %dl,%dl
+  800a63:	74 05                	je     800a6a <strfind+0x1a>
+	for (; *s; s++)
+  800a65:	83 c0 01             	add    $0x1,%eax
+  800a68:	eb f0                	jmp    800a5a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a6a:	5d                   	pop    %ebp
+  800a6b:	c3                   	ret
+
+00800a6c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	57                   	push   %edi
+  800a70:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a73:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a76:	85 c9                	test   %ecx,%ecx
+  800a78:	74 20                	je     800a9a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a7a:	89 f8                	mov    %edi,%eax
+  800a7c:	09 c8                	or     %ecx,%eax
+  800a7e:	a8 03                	test   $0x3,%al
+  800a80:	75 12                	jne    800a94 <memset+0x28>
+		c &= 0xFF;
+  800a82:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a86:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a8c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a8f:	fc                   	cld
+  800a90:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a92:	eb 06                	jmp    800a9a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a97:	fc                   	cld
+  800a98:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a9a:	89 f8                	mov    %edi,%eax
+  800a9c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a9f:	c9                   	leave
+  800aa0:	c3                   	ret
+
+00800aa1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aa1:	55                   	push   %ebp
+  800aa2:	89 e5                	mov    %esp,%ebp
+  800aa4:	57                   	push   %edi
+  800aa5:	56                   	push   %esi
+  800aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aaf:	39 c6                	cmp    %eax,%esi
+  800ab1:	73 32                	jae    800ae5 <memmove+0x44>
+  800ab3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ab6:	39 d0                	cmp    %edx,%eax
+  800ab8:	73 2b                	jae    800ae5 <memmove+0x44>
+		s += n;
+		d += n;
+  800aba:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800abd:	89 d6                	mov    %edx,%esi
+  800abf:	09 fe                	or     %edi,%esi
+  800ac1:	09 ce                	or     %ecx,%esi
+  800ac3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ac9:	75 0e                	jne    800ad9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800acb:	83 ef 04             	sub    $0x4,%edi
+  800ace:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ad1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ad4:	fd                   	std
+  800ad5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad7:	eb 09                	jmp    800ae2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ad9:	83 ef 01             	sub    $0x1,%edi
+  800adc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800adf:	fd                   	std
+  800ae0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ae2:	fc                   	cld
+  800ae3:	eb 1a                	jmp    800aff <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ae5:	89 f2                	mov    %esi,%edx
+  800ae7:	09 c2                	or     %eax,%edx
+  800ae9:	09 ca                	or     %ecx,%edx
+  800aeb:	f6 c2 03             	test   $0x3,%dl
+  800aee:	75 0a                	jne    800afa <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800af0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800af3:	89 c7                	mov    %eax,%edi
+  800af5:	fc                   	cld
+  800af6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af8:	eb 05                	jmp    800aff <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800afa:	89 c7                	mov    %eax,%edi
+  800afc:	fc                   	cld
+  800afd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aff:	5e                   	pop    %esi
+  800b00:	5f                   	pop    %edi
+  800b01:	5d                   	pop    %ebp
+  800b02:	c3                   	ret
+
+00800b03 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b09:	ff 75 10             	push   0x10(%ebp)
+  800b0c:	ff 75 0c             	push   0xc(%ebp)
+  800b0f:	ff 75 08             	push   0x8(%ebp)
+  800b12:	e8 8a ff ff ff       	call   800aa1 <memmove>
+}
+  800b17:	c9                   	leave
+  800b18:	c3                   	ret
+
+00800b19 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b19:	55                   	push   %ebp
+  800b1a:	89 e5                	mov    %esp,%ebp
+  800b1c:	56                   	push   %esi
+  800b1d:	53                   	push   %ebx
+  800b1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b21:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b24:	89 c6                	mov    %eax,%esi
+  800b26:	03 75 10             	add    0x10(%ebp),%esi
+  800b29:	eb 06                	jmp    800b31 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b2b:	83 c0 01             	add    $0x1,%eax
+  800b2e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b31:	39 f0                	cmp    %esi,%eax
+  800b33:	74 14                	je     800b49 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b35:	0f b6 08             	movzbl (%eax),%ecx
+  800b38:	0f b6 1a             	movzbl (%edx),%ebx
+  800b3b:	38 d9                	cmp    %bl,%cl
+  800b3d:	74 ec                	je     800b2b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b3f:	0f b6 c1             	movzbl %cl,%eax
+  800b42:	0f b6 db             	movzbl %bl,%ebx
+  800b45:	29 d8                	sub    %ebx,%eax
+  800b47:	eb 05                	jmp    800b4e <memcmp+0x35>
+	}
+
+	return 0;
+  800b49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b4e:	5b                   	pop    %ebx
+  800b4f:	5e                   	pop    %esi
+  800b50:	5d                   	pop    %ebp
+  800b51:	c3                   	ret
+
+00800b52 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b60:	eb 03                	jmp    800b65 <memfind+0x13>
+  800b62:	83 c0 01             	add    $0x1,%eax
+  800b65:	39 d0                	cmp    %edx,%eax
+  800b67:	73 04                	jae    800b6d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b69:	38 08                	cmp    %cl,(%eax)
+  800b6b:	75 f5                	jne    800b62 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b6d:	5d                   	pop    %ebp
+  800b6e:	c3                   	ret
+
+00800b6f <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	57                   	push   %edi
+  800b73:	56                   	push   %esi
+  800b74:	53                   	push   %ebx
+  800b75:	83 ec 1c             	sub    $0x1c,%esp
+  800b78:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b7b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b7e:	eb 03                	jmp    800b83 <strtol+0x14>
+		s++;
+  800b80:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b83:	0f b6 06             	movzbl (%esi),%eax
+  800b86:	3c 20                	cmp    $0x20,%al
+  800b88:	74 f6                	je     800b80 <strtol+0x11>
+  800b8a:	3c 09                	cmp    $0x9,%al
+  800b8c:	74 f2                	je     800b80 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b8e:	3c 2b                	cmp    $0x2b,%al
+  800b90:	74 43                	je     800bd5 <strtol+0x66>
+	int neg = 0;
+  800b92:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b97:	3c 2d                	cmp    $0x2d,%al
+  800b99:	74 44                	je     800bdf <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b9b:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ba1:	75 0f                	jne    800bb2 <strtol+0x43>
+  800ba3:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ba6:	74 41                	je     800be9 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ba8:	85 ff                	test   %edi,%edi
+  800baa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800baf:	0f 44 f8             	cmove  %eax,%edi
+  800bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb7:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800bbc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800bbf:	89 fb                	mov    %edi,%ebx
+  800bc1:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bc4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800bc7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bca:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bcd:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800bd0:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bd3:	eb 67                	jmp    800c3c <strtol+0xcd>
+		s++;
+  800bd5:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800bd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bdd:	eb bc                	jmp    800b9b <strtol+0x2c>
+		s++, neg = 1;
+  800bdf:	83 c6 01             	add    $0x1,%esi
+  800be2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be7:	eb b2                	jmp    800b9b <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be9:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800bed:	74 0e                	je     800bfd <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800bef:	85 ff                	test   %edi,%edi
+  800bf1:	75 bf                	jne    800bb2 <strtol+0x43>
+		s++, base = 8;
+  800bf3:	83 c6 01             	add    $0x1,%esi
+  800bf6:	bf 08 00 00 00       	mov    $0x8,%edi
+  800bfb:	eb b5                	jmp    800bb2 <strtol+0x43>
+		s += 2, base = 16;
+  800bfd:	83 c6 02             	add    $0x2,%esi
+  800c00:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c05:	eb ab                	jmp    800bb2 <strtol+0x43>
+			dig = *s - '0';
+  800c07:	0f be c9             	movsbl %cl,%ecx
+  800c0a:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c0d:	39 f9                	cmp    %edi,%ecx
+  800c0f:	7d 59                	jge    800c6a <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c11:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c15:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c18:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c1b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c1e:	0f af d8             	imul   %eax,%ebx
+  800c21:	0f af d7             	imul   %edi,%edx
+  800c24:	01 d3                	add    %edx,%ebx
+  800c26:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c29:	f7 e7                	mul    %edi
+  800c2b:	01 da                	add    %ebx,%edx
+  800c2d:	89 cb                	mov    %ecx,%ebx
+  800c2f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c32:	01 c8                	add    %ecx,%eax
+  800c34:	11 da                	adc    %ebx,%edx
+  800c36:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c39:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3f:	0f b6 08             	movzbl (%eax),%ecx
+  800c42:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c45:	80 fb 09             	cmp    $0x9,%bl
+  800c48:	76 bd                	jbe    800c07 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c4a:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c4d:	80 fb 19             	cmp    $0x19,%bl
+  800c50:	77 08                	ja     800c5a <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c52:	0f be c9             	movsbl %cl,%ecx
+  800c55:	83 e9 57             	sub    $0x57,%ecx
+  800c58:	eb b3                	jmp    800c0d <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c5a:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c5d:	80 fb 19             	cmp    $0x19,%bl
+  800c60:	77 08                	ja     800c6a <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c62:	0f be c9             	movsbl %cl,%ecx
+  800c65:	83 e9 37             	sub    $0x37,%ecx
+  800c68:	eb a3                	jmp    800c0d <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c6a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c6d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c70:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c73:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c76:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c7a:	74 05                	je     800c81 <strtol+0x112>
+		*endptr = (char *) s;
+  800c7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c7f:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c81:	85 c9                	test   %ecx,%ecx
+  800c83:	74 07                	je     800c8c <strtol+0x11d>
+  800c85:	f7 d8                	neg    %eax
+  800c87:	83 d2 00             	adc    $0x0,%edx
+  800c8a:	f7 da                	neg    %edx
+}
+  800c8c:	83 c4 1c             	add    $0x1c,%esp
+  800c8f:	5b                   	pop    %ebx
+  800c90:	5e                   	pop    %esi
+  800c91:	5f                   	pop    %edi
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+
+00800c94 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	57                   	push   %edi
+  800c98:	56                   	push   %esi
+  800c99:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c9a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ca1:	74 18                	je     800cbb <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cae:	89 c3                	mov    %eax,%ebx
+  800cb0:	89 c7                	mov    %eax,%edi
+  800cb2:	89 c6                	mov    %eax,%esi
+  800cb4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cb6:	5b                   	pop    %ebx
+  800cb7:	5e                   	pop    %esi
+  800cb8:	5f                   	pop    %edi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc6:	89 c3                	mov    %eax,%ebx
+  800cc8:	89 c7                	mov    %eax,%edi
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	8d 35 d5 0c 80 00    	lea    0x800cd5,%esi
+  800cd3:	0f 34                	sysenter
+  800cd5:	5d                   	pop    %ebp
+		goto out;
+  800cd6:	eb de                	jmp    800cb6 <sys_cputs+0x22>
+
+00800cd8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cd8:	55                   	push   %ebp
+  800cd9:	89 e5                	mov    %esp,%ebp
+  800cdb:	57                   	push   %edi
+  800cdc:	56                   	push   %esi
+  800cdd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cde:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ce5:	74 19                	je     800d00 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cec:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cf1:	89 d1                	mov    %edx,%ecx
+  800cf3:	89 d3                	mov    %edx,%ebx
+  800cf5:	89 d7                	mov    %edx,%edi
+  800cf7:	89 d6                	mov    %edx,%esi
+  800cf9:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d0a:	89 d1                	mov    %edx,%ecx
+  800d0c:	89 d3                	mov    %edx,%ebx
+  800d0e:	89 d7                	mov    %edx,%edi
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	8d 35 1b 0d 80 00    	lea    0x800d1b,%esi
+  800d19:	0f 34                	sysenter
+  800d1b:	5d                   	pop    %ebp
+		goto out;
+  800d1c:	eb dd                	jmp    800cfb <sys_cgetc+0x23>
+
+00800d1e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	57                   	push   %edi
+  800d22:	56                   	push   %esi
+  800d23:	53                   	push   %ebx
+  800d24:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d27:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d2e:	74 21                	je     800d51 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d35:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3d:	89 cb                	mov    %ecx,%ebx
+  800d3f:	89 cf                	mov    %ecx,%edi
+  800d41:	89 ce                	mov    %ecx,%esi
+  800d43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	7f 27                	jg     800d70 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d59:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d5e:	89 cb                	mov    %ecx,%ebx
+  800d60:	89 cf                	mov    %ecx,%edi
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	8d 35 6d 0d 80 00    	lea    0x800d6d,%esi
+  800d6b:	0f 34                	sysenter
+  800d6d:	5d                   	pop    %ebp
+		goto out;
+  800d6e:	eb d5                	jmp    800d45 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d70:	83 ec 0c             	sub    $0xc,%esp
+  800d73:	50                   	push   %eax
+  800d74:	6a 03                	push   $0x3
+  800d76:	68 0b 3a 80 00       	push   $0x803a0b
+  800d7b:	6a 3f                	push   $0x3f
+  800d7d:	68 28 3a 80 00       	push   $0x803a28
+  800d82:	e8 71 f4 ff ff       	call   8001f8 <_panic>
+
+00800d87 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d8d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d94:	74 19                	je     800daf <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800da0:	89 d1                	mov    %edx,%ecx
+  800da2:	89 d3                	mov    %edx,%ebx
+  800da4:	89 d7                	mov    %edx,%edi
+  800da6:	89 d6                	mov    %edx,%esi
+  800da8:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800daa:	5b                   	pop    %ebx
+  800dab:	5e                   	pop    %esi
+  800dac:	5f                   	pop    %edi
+  800dad:	5d                   	pop    %ebp
+  800dae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db9:	89 d1                	mov    %edx,%ecx
+  800dbb:	89 d3                	mov    %edx,%ebx
+  800dbd:	89 d7                	mov    %edx,%edi
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	8d 35 ca 0d 80 00    	lea    0x800dca,%esi
+  800dc8:	0f 34                	sysenter
+  800dca:	5d                   	pop    %ebp
+		goto out;
+  800dcb:	eb dd                	jmp    800daa <sys_getenvid+0x23>
+
+00800dcd <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	57                   	push   %edi
+  800dd1:	56                   	push   %esi
+  800dd2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dd3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dda:	74 19                	je     800df5 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800ddc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800de6:	89 d1                	mov    %edx,%ecx
+  800de8:	89 d3                	mov    %edx,%ebx
+  800dea:	89 d7                	mov    %edx,%edi
+  800dec:	89 d6                	mov    %edx,%esi
+  800dee:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800df0:	5b                   	pop    %ebx
+  800df1:	5e                   	pop    %esi
+  800df2:	5f                   	pop    %edi
+  800df3:	5d                   	pop    %ebp
+  800df4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800df5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfa:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dff:	89 d1                	mov    %edx,%ecx
+  800e01:	89 d3                	mov    %edx,%ebx
+  800e03:	89 d7                	mov    %edx,%edi
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	8d 35 10 0e 80 00    	lea    0x800e10,%esi
+  800e0e:	0f 34                	sysenter
+  800e10:	5d                   	pop    %ebp
+		goto out;
+  800e11:	eb dd                	jmp    800df0 <sys_yield+0x23>
+
+00800e13 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e1c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e23:	74 23                	je     800e48 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e25:	be 00 00 00 00       	mov    $0x0,%esi
+  800e2a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e38:	89 f7                	mov    %esi,%edi
+  800e3a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e3c:	85 c0                	test   %eax,%eax
+  800e3e:	7f 29                	jg     800e69 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e43:	5b                   	pop    %ebx
+  800e44:	5e                   	pop    %esi
+  800e45:	5f                   	pop    %edi
+  800e46:	5d                   	pop    %ebp
+  800e47:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e53:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5b:	55                   	push   %ebp
+  800e5c:	89 e5                	mov    %esp,%ebp
+  800e5e:	8d 35 66 0e 80 00    	lea    0x800e66,%esi
+  800e64:	0f 34                	sysenter
+  800e66:	5d                   	pop    %ebp
+		goto out;
+  800e67:	eb d3                	jmp    800e3c <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e69:	83 ec 0c             	sub    $0xc,%esp
+  800e6c:	50                   	push   %eax
+  800e6d:	6a 04                	push   $0x4
+  800e6f:	68 0b 3a 80 00       	push   $0x803a0b
+  800e74:	6a 3f                	push   $0x3f
+  800e76:	68 28 3a 80 00       	push   $0x803a28
+  800e7b:	e8 78 f3 ff ff       	call   8001f8 <_panic>
+
+00800e80 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e80:	55                   	push   %ebp
+  800e81:	89 e5                	mov    %esp,%ebp
+  800e83:	57                   	push   %edi
+  800e84:	56                   	push   %esi
+  800e85:	53                   	push   %ebx
+  800e86:	83 ec 0c             	sub    $0xc,%esp
+  800e89:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e8c:	85 f6                	test   %esi,%esi
+  800e8e:	75 09                	jne    800e99 <sys_page_map+0x19>
+  800e90:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e97:	74 1f                	je     800eb8 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e99:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eaa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	7f 27                	jg     800ed7 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800eb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5f                   	pop    %edi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebe:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ec3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	8d 35 d4 0e 80 00    	lea    0x800ed4,%esi
+  800ed2:	0f 34                	sysenter
+  800ed4:	5d                   	pop    %ebp
+		goto out;
+  800ed5:	eb d5                	jmp    800eac <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	50                   	push   %eax
+  800edb:	6a 05                	push   $0x5
+  800edd:	68 0b 3a 80 00       	push   $0x803a0b
+  800ee2:	6a 3f                	push   $0x3f
+  800ee4:	68 28 3a 80 00       	push   $0x803a28
+  800ee9:	e8 0a f3 ff ff       	call   8001f8 <_panic>
+
+00800eee <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	56                   	push   %esi
+  800ef3:	53                   	push   %ebx
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ef7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800efe:	74 22                	je     800f22 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f05:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f10:	89 df                	mov    %ebx,%edi
+  800f12:	89 de                	mov    %ebx,%esi
+  800f14:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f16:	85 c0                	test   %eax,%eax
+  800f18:	7f 28                	jg     800f42 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1d:	5b                   	pop    %ebx
+  800f1e:	5e                   	pop    %esi
+  800f1f:	5f                   	pop    %edi
+  800f20:	5d                   	pop    %ebp
+  800f21:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f32:	89 df                	mov    %ebx,%edi
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	8d 35 3f 0f 80 00    	lea    0x800f3f,%esi
+  800f3d:	0f 34                	sysenter
+  800f3f:	5d                   	pop    %ebp
+		goto out;
+  800f40:	eb d4                	jmp    800f16 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f42:	83 ec 0c             	sub    $0xc,%esp
+  800f45:	50                   	push   %eax
+  800f46:	6a 06                	push   $0x6
+  800f48:	68 0b 3a 80 00       	push   $0x803a0b
+  800f4d:	6a 3f                	push   $0x3f
+  800f4f:	68 28 3a 80 00       	push   $0x803a28
+  800f54:	e8 9f f2 ff ff       	call   8001f8 <_panic>
+
+00800f59 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f59:	55                   	push   %ebp
+  800f5a:	89 e5                	mov    %esp,%ebp
+  800f5c:	57                   	push   %edi
+  800f5d:	56                   	push   %esi
+  800f5e:	53                   	push   %ebx
+  800f5f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f62:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f69:	74 22                	je     800f8d <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f70:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7b:	89 df                	mov    %ebx,%edi
+  800f7d:	89 de                	mov    %ebx,%esi
+  800f7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f81:	85 c0                	test   %eax,%eax
+  800f83:	7f 28                	jg     800fad <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f98:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f9d:	89 df                	mov    %ebx,%edi
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	8d 35 aa 0f 80 00    	lea    0x800faa,%esi
+  800fa8:	0f 34                	sysenter
+  800faa:	5d                   	pop    %ebp
+		goto out;
+  800fab:	eb d4                	jmp    800f81 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fad:	83 ec 0c             	sub    $0xc,%esp
+  800fb0:	50                   	push   %eax
+  800fb1:	6a 08                	push   $0x8
+  800fb3:	68 0b 3a 80 00       	push   $0x803a0b
+  800fb8:	6a 3f                	push   $0x3f
+  800fba:	68 28 3a 80 00       	push   $0x803a28
+  800fbf:	e8 34 f2 ff ff       	call   8001f8 <_panic>
+
+00800fc4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	57                   	push   %edi
+  800fc8:	56                   	push   %esi
+  800fc9:	53                   	push   %ebx
+  800fca:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fcd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fd4:	74 22                	je     800ff8 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800fd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdb:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe6:	89 df                	mov    %ebx,%edi
+  800fe8:	89 de                	mov    %ebx,%esi
+  800fea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fec:	85 c0                	test   %eax,%eax
+  800fee:	7f 28                	jg     801018 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ff8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801003:	b8 09 00 00 00       	mov    $0x9,%eax
+  801008:	89 df                	mov    %ebx,%edi
+  80100a:	55                   	push   %ebp
+  80100b:	89 e5                	mov    %esp,%ebp
+  80100d:	8d 35 15 10 80 00    	lea    0x801015,%esi
+  801013:	0f 34                	sysenter
+  801015:	5d                   	pop    %ebp
+		goto out;
+  801016:	eb d4                	jmp    800fec <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801018:	83 ec 0c             	sub    $0xc,%esp
+  80101b:	50                   	push   %eax
+  80101c:	6a 09                	push   $0x9
+  80101e:	68 0b 3a 80 00       	push   $0x803a0b
+  801023:	6a 3f                	push   $0x3f
+  801025:	68 28 3a 80 00       	push   $0x803a28
+  80102a:	e8 c9 f1 ff ff       	call   8001f8 <_panic>
+
+0080102f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	57                   	push   %edi
+  801033:	56                   	push   %esi
+  801034:	53                   	push   %ebx
+  801035:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801038:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80103f:	74 22                	je     801063 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801041:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801046:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801051:	89 df                	mov    %ebx,%edi
+  801053:	89 de                	mov    %ebx,%esi
+  801055:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801057:	85 c0                	test   %eax,%eax
+  801059:	7f 28                	jg     801083 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80105b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105e:	5b                   	pop    %ebx
+  80105f:	5e                   	pop    %esi
+  801060:	5f                   	pop    %edi
+  801061:	5d                   	pop    %ebp
+  801062:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801063:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801073:	89 df                	mov    %ebx,%edi
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	8d 35 80 10 80 00    	lea    0x801080,%esi
+  80107e:	0f 34                	sysenter
+  801080:	5d                   	pop    %ebp
+		goto out;
+  801081:	eb d4                	jmp    801057 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801083:	83 ec 0c             	sub    $0xc,%esp
+  801086:	50                   	push   %eax
+  801087:	6a 0a                	push   $0xa
+  801089:	68 0b 3a 80 00       	push   $0x803a0b
+  80108e:	6a 3f                	push   $0x3f
+  801090:	68 28 3a 80 00       	push   $0x803a28
+  801095:	e8 5e f1 ff ff       	call   8001f8 <_panic>
+
+0080109a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	57                   	push   %edi
+  80109e:	56                   	push   %esi
+  80109f:	53                   	push   %ebx
+  8010a0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010a3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010aa:	74 22                	je     8010ce <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8010ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bc:	89 df                	mov    %ebx,%edi
+  8010be:	89 de                	mov    %ebx,%esi
+  8010c0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c2:	85 c0                	test   %eax,%eax
+  8010c4:	7f 28                	jg     8010ee <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8010c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010de:	89 df                	mov    %ebx,%edi
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	8d 35 eb 10 80 00    	lea    0x8010eb,%esi
+  8010e9:	0f 34                	sysenter
+  8010eb:	5d                   	pop    %ebp
+		goto out;
+  8010ec:	eb d4                	jmp    8010c2 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ee:	83 ec 0c             	sub    $0xc,%esp
+  8010f1:	50                   	push   %eax
+  8010f2:	6a 17                	push   $0x17
+  8010f4:	68 0b 3a 80 00       	push   $0x803a0b
+  8010f9:	6a 3f                	push   $0x3f
+  8010fb:	68 28 3a 80 00       	push   $0x803a28
+  801100:	e8 f3 f0 ff ff       	call   8001f8 <_panic>
+
+00801105 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	57                   	push   %edi
+  801109:	56                   	push   %esi
+  80110a:	53                   	push   %ebx
+  80110b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80110e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801115:	74 22                	je     801139 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801117:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801121:	8b 55 08             	mov    0x8(%ebp),%edx
+  801124:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801127:	89 df                	mov    %ebx,%edi
+  801129:	89 de                	mov    %ebx,%esi
+  80112b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80112d:	85 c0                	test   %eax,%eax
+  80112f:	7f 28                	jg     801159 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801134:	5b                   	pop    %ebx
+  801135:	5e                   	pop    %esi
+  801136:	5f                   	pop    %edi
+  801137:	5d                   	pop    %ebp
+  801138:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801141:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801144:	b8 18 00 00 00       	mov    $0x18,%eax
+  801149:	89 df                	mov    %ebx,%edi
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	8d 35 56 11 80 00    	lea    0x801156,%esi
+  801154:	0f 34                	sysenter
+  801156:	5d                   	pop    %ebp
+		goto out;
+  801157:	eb d4                	jmp    80112d <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801159:	83 ec 0c             	sub    $0xc,%esp
+  80115c:	50                   	push   %eax
+  80115d:	6a 18                	push   $0x18
+  80115f:	68 0b 3a 80 00       	push   $0x803a0b
+  801164:	6a 3f                	push   $0x3f
+  801166:	68 28 3a 80 00       	push   $0x803a28
+  80116b:	e8 88 f0 ff ff       	call   8001f8 <_panic>
+
+00801170 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801176:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80117d:	74 1d                	je     80119c <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80117f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801184:	be 00 00 00 00       	mov    $0x0,%esi
+  801189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801192:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801195:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80119c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011aa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	8d 35 b8 11 80 00    	lea    0x8011b8,%esi
+  8011b6:	0f 34                	sysenter
+  8011b8:	5d                   	pop    %ebp
+		goto out;
+  8011b9:	eb dc                	jmp    801197 <sys_ipc_try_send+0x27>
+
+008011bb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+  8011c1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011c4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011cb:	74 21                	je     8011ee <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8011cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011da:	89 cb                	mov    %ecx,%ebx
+  8011dc:	89 cf                	mov    %ecx,%edi
+  8011de:	89 ce                	mov    %ecx,%esi
+  8011e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e2:	85 c0                	test   %eax,%eax
+  8011e4:	7f 27                	jg     80120d <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e9:	5b                   	pop    %ebx
+  8011ea:	5e                   	pop    %esi
+  8011eb:	5f                   	pop    %edi
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011fb:	89 cb                	mov    %ecx,%ebx
+  8011fd:	89 cf                	mov    %ecx,%edi
+  8011ff:	55                   	push   %ebp
+  801200:	89 e5                	mov    %esp,%ebp
+  801202:	8d 35 0a 12 80 00    	lea    0x80120a,%esi
+  801208:	0f 34                	sysenter
+  80120a:	5d                   	pop    %ebp
+		goto out;
+  80120b:	eb d5                	jmp    8011e2 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120d:	83 ec 0c             	sub    $0xc,%esp
+  801210:	50                   	push   %eax
+  801211:	6a 0d                	push   $0xd
+  801213:	68 0b 3a 80 00       	push   $0x803a0b
+  801218:	6a 3f                	push   $0x3f
+  80121a:	68 28 3a 80 00       	push   $0x803a28
+  80121f:	e8 d4 ef ff ff       	call   8001f8 <_panic>
+
+00801224 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801224:	55                   	push   %ebp
+  801225:	89 e5                	mov    %esp,%ebp
+  801227:	57                   	push   %edi
+  801228:	56                   	push   %esi
+  801229:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80122a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801231:	74 1b                	je     80124e <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801238:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80123d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801243:	89 df                	mov    %ebx,%edi
+  801245:	89 de                	mov    %ebx,%esi
+  801247:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801249:	5b                   	pop    %ebx
+  80124a:	5e                   	pop    %esi
+  80124b:	5f                   	pop    %edi
+  80124c:	5d                   	pop    %ebp
+  80124d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80124e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801253:	8b 55 08             	mov    0x8(%ebp),%edx
+  801256:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801259:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80125e:	89 df                	mov    %ebx,%edi
+  801260:	55                   	push   %ebp
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	8d 35 6b 12 80 00    	lea    0x80126b,%esi
+  801269:	0f 34                	sysenter
+  80126b:	5d                   	pop    %ebp
+		goto out;
+  80126c:	eb db                	jmp    801249 <sys_ipc_recv_until+0x25>
+
+0080126e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801274:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80127b:	74 19                	je     801296 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80127d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801282:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801287:	89 d1                	mov    %edx,%ecx
+  801289:	89 d3                	mov    %edx,%ebx
+  80128b:	89 d7                	mov    %edx,%edi
+  80128d:	89 d6                	mov    %edx,%esi
+  80128f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801291:	5b                   	pop    %ebx
+  801292:	5e                   	pop    %esi
+  801293:	5f                   	pop    %edi
+  801294:	5d                   	pop    %ebp
+  801295:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012a0:	89 d1                	mov    %edx,%ecx
+  8012a2:	89 d3                	mov    %edx,%ebx
+  8012a4:	89 d7                	mov    %edx,%edi
+  8012a6:	55                   	push   %ebp
+  8012a7:	89 e5                	mov    %esp,%ebp
+  8012a9:	8d 35 b1 12 80 00    	lea    0x8012b1,%esi
+  8012af:	0f 34                	sysenter
+  8012b1:	5d                   	pop    %ebp
+		goto out;
+  8012b2:	eb dd                	jmp    801291 <sys_time_msec+0x23>
+
+008012b4 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8012b4:	55                   	push   %ebp
+  8012b5:	89 e5                	mov    %esp,%ebp
+  8012b7:	57                   	push   %edi
+  8012b8:	56                   	push   %esi
+  8012b9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012ba:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012c1:	74 1a                	je     8012dd <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8012c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d0:	89 cb                	mov    %ecx,%ebx
+  8012d2:	89 cf                	mov    %ecx,%edi
+  8012d4:	89 ce                	mov    %ecx,%esi
+  8012d6:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012d8:	5b                   	pop    %ebx
+  8012d9:	5e                   	pop    %esi
+  8012da:	5f                   	pop    %edi
+  8012db:	5d                   	pop    %ebp
+  8012dc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012ea:	89 cb                	mov    %ecx,%ebx
+  8012ec:	89 cf                	mov    %ecx,%edi
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	8d 35 f9 12 80 00    	lea    0x8012f9,%esi
+  8012f7:	0f 34                	sysenter
+  8012f9:	5d                   	pop    %ebp
+		goto out;
+  8012fa:	eb dc                	jmp    8012d8 <sys_sleep_until+0x24>
+
+008012fc <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012fc:	55                   	push   %ebp
+  8012fd:	89 e5                	mov    %esp,%ebp
+  8012ff:	57                   	push   %edi
+  801300:	56                   	push   %esi
+  801301:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801302:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801309:	74 1a                	je     801325 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80130b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801310:	b8 11 00 00 00       	mov    $0x11,%eax
+  801315:	8b 55 08             	mov    0x8(%ebp),%edx
+  801318:	89 cb                	mov    %ecx,%ebx
+  80131a:	89 cf                	mov    %ecx,%edi
+  80131c:	89 ce                	mov    %ecx,%esi
+  80131e:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801320:	5b                   	pop    %ebx
+  801321:	5e                   	pop    %esi
+  801322:	5f                   	pop    %edi
+  801323:	5d                   	pop    %ebp
+  801324:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801325:	8b 55 08             	mov    0x8(%ebp),%edx
+  801328:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80132d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801332:	89 cb                	mov    %ecx,%ebx
+  801334:	89 cf                	mov    %ecx,%edi
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	8d 35 41 13 80 00    	lea    0x801341,%esi
+  80133f:	0f 34                	sysenter
+  801341:	5d                   	pop    %ebp
+		goto out;
+  801342:	eb dc                	jmp    801320 <sys_env_print_stats+0x24>
+
+00801344 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801344:	55                   	push   %ebp
+  801345:	89 e5                	mov    %esp,%ebp
+  801347:	57                   	push   %edi
+  801348:	56                   	push   %esi
+  801349:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80134a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801351:	74 1b                	je     80136e <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801353:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801358:	b8 19 00 00 00       	mov    $0x19,%eax
+  80135d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801360:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801363:	89 df                	mov    %ebx,%edi
+  801365:	89 de                	mov    %ebx,%esi
+  801367:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801369:	5b                   	pop    %ebx
+  80136a:	5e                   	pop    %esi
+  80136b:	5f                   	pop    %edi
+  80136c:	5d                   	pop    %ebp
+  80136d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80136e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801373:	8b 55 08             	mov    0x8(%ebp),%edx
+  801376:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801379:	b8 19 00 00 00       	mov    $0x19,%eax
+  80137e:	89 df                	mov    %ebx,%edi
+  801380:	55                   	push   %ebp
+  801381:	89 e5                	mov    %esp,%ebp
+  801383:	8d 35 8b 13 80 00    	lea    0x80138b,%esi
+  801389:	0f 34                	sysenter
+  80138b:	5d                   	pop    %ebp
+		goto out;
+  80138c:	eb db                	jmp    801369 <sys_perf+0x25>
+
+0080138e <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80138e:	55                   	push   %ebp
+  80138f:	89 e5                	mov    %esp,%ebp
+  801391:	57                   	push   %edi
+  801392:	56                   	push   %esi
+  801393:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801394:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80139b:	74 19                	je     8013b6 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80139d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013a7:	89 d1                	mov    %edx,%ecx
+  8013a9:	89 d3                	mov    %edx,%ebx
+  8013ab:	89 d7                	mov    %edx,%edi
+  8013ad:	89 d6                	mov    %edx,%esi
+  8013af:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013b1:	5b                   	pop    %ebx
+  8013b2:	5e                   	pop    %esi
+  8013b3:	5f                   	pop    %edi
+  8013b4:	5d                   	pop    %ebp
+  8013b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013c0:	89 d1                	mov    %edx,%ecx
+  8013c2:	89 d3                	mov    %edx,%ebx
+  8013c4:	89 d7                	mov    %edx,%edi
+  8013c6:	55                   	push   %ebp
+  8013c7:	89 e5                	mov    %esp,%ebp
+  8013c9:	8d 35 d1 13 80 00    	lea    0x8013d1,%esi
+  8013cf:	0f 34                	sysenter
+  8013d1:	5d                   	pop    %ebp
+		goto out;
+  8013d2:	eb dd                	jmp    8013b1 <sys_fork+0x23>
+
+008013d4 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	57                   	push   %edi
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013da:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013e1:	74 1c                	je     8013ff <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f6:	89 f7                	mov    %esi,%edi
+  8013f8:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013fa:	5b                   	pop    %ebx
+  8013fb:	5e                   	pop    %esi
+  8013fc:	5f                   	pop    %edi
+  8013fd:	5d                   	pop    %ebp
+  8013fe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801402:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801405:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80140a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80140f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	8d 35 1d 14 80 00    	lea    0x80141d,%esi
+  80141b:	0f 34                	sysenter
+  80141d:	5d                   	pop    %ebp
+		goto out;
+  80141e:	eb da                	jmp    8013fa <sys_thread_create+0x26>
+
+00801420 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	57                   	push   %edi
+  801424:	56                   	push   %esi
+  801425:	53                   	push   %ebx
+  801426:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801429:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801430:	74 24                	je     801456 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801432:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801437:	be 00 00 00 00       	mov    $0x0,%esi
+  80143c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801442:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801445:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801448:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	7f 27                	jg     801475 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80144e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801451:	5b                   	pop    %ebx
+  801452:	5e                   	pop    %esi
+  801453:	5f                   	pop    %edi
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801456:	8b 55 08             	mov    0x8(%ebp),%edx
+  801459:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801461:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801464:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801467:	55                   	push   %ebp
+  801468:	89 e5                	mov    %esp,%ebp
+  80146a:	8d 35 72 14 80 00    	lea    0x801472,%esi
+  801470:	0f 34                	sysenter
+  801472:	5d                   	pop    %ebp
+		goto out;
+  801473:	eb d5                	jmp    80144a <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801475:	83 ec 0c             	sub    $0xc,%esp
+  801478:	50                   	push   %eax
+  801479:	6a 1f                	push   $0x1f
+  80147b:	68 0b 3a 80 00       	push   $0x803a0b
+  801480:	6a 3f                	push   $0x3f
+  801482:	68 28 3a 80 00       	push   $0x803a28
+  801487:	e8 6c ed ff ff       	call   8001f8 <_panic>
+
+0080148c <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	57                   	push   %edi
+  801490:	56                   	push   %esi
+  801491:	53                   	push   %ebx
+  801492:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801495:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80149c:	74 23                	je     8014c1 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80149e:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b1:	89 f7                	mov    %esi,%edi
+  8014b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014b5:	85 c0                	test   %eax,%eax
+  8014b7:	7f 29                	jg     8014e2 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8014b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014bc:	5b                   	pop    %ebx
+  8014bd:	5e                   	pop    %esi
+  8014be:	5f                   	pop    %edi
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d4:	55                   	push   %ebp
+  8014d5:	89 e5                	mov    %esp,%ebp
+  8014d7:	8d 35 df 14 80 00    	lea    0x8014df,%esi
+  8014dd:	0f 34                	sysenter
+  8014df:	5d                   	pop    %ebp
+		goto out;
+  8014e0:	eb d3                	jmp    8014b5 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e2:	83 ec 0c             	sub    $0xc,%esp
+  8014e5:	50                   	push   %eax
+  8014e6:	6a 20                	push   $0x20
+  8014e8:	68 0b 3a 80 00       	push   $0x803a0b
+  8014ed:	6a 3f                	push   $0x3f
+  8014ef:	68 28 3a 80 00       	push   $0x803a28
+  8014f4:	e8 ff ec ff ff       	call   8001f8 <_panic>
+
+008014f9 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014f9:	55                   	push   %ebp
+  8014fa:	89 e5                	mov    %esp,%ebp
+  8014fc:	57                   	push   %edi
+  8014fd:	56                   	push   %esi
+  8014fe:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ff:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801506:	74 1b                	je     801523 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801508:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801512:	8b 55 08             	mov    0x8(%ebp),%edx
+  801515:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801518:	89 df                	mov    %ebx,%edi
+  80151a:	89 de                	mov    %ebx,%esi
+  80151c:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80151e:	5b                   	pop    %ebx
+  80151f:	5e                   	pop    %esi
+  801520:	5f                   	pop    %edi
+  801521:	5d                   	pop    %ebp
+  801522:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801523:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801528:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801533:	89 df                	mov    %ebx,%edi
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	8d 35 40 15 80 00    	lea    0x801540,%esi
+  80153e:	0f 34                	sysenter
+  801540:	5d                   	pop    %ebp
+		goto out;
+  801541:	eb db                	jmp    80151e <sys_batch+0x25>
+
+00801543 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	57                   	push   %edi
+  801547:	56                   	push   %esi
+  801548:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801549:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801550:	74 1a                	je     80156c <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801552:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801557:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80155c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155f:	89 cb                	mov    %ecx,%ebx
+  801561:	89 cf                	mov    %ecx,%edi
+  801563:	89 ce                	mov    %ecx,%esi
+  801565:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801567:	5b                   	pop    %ebx
+  801568:	5e                   	pop    %esi
+  801569:	5f                   	pop    %edi
+  80156a:	5d                   	pop    %ebp
+  80156b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80156c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801574:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801579:	89 cb                	mov    %ecx,%ebx
+  80157b:	89 cf                	mov    %ecx,%edi
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	8d 35 88 15 80 00    	lea    0x801588,%esi
+  801586:	0f 34                	sysenter
+  801588:	5d                   	pop    %ebp
+		goto out;
+  801589:	eb dc                	jmp    801567 <sys_trace_ctl+0x24>
+
+0080158b <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	57                   	push   %edi
+  80158f:	56                   	push   %esi
+  801590:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801591:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801598:	74 1c                	je     8015b6 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80159a:	be 00 00 00 00       	mov    $0x0,%esi
+  80159f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ad:	89 f7                	mov    %esi,%edi
+  8015af:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8015b1:	5b                   	pop    %ebx
+  8015b2:	5e                   	pop    %esi
+  8015b3:	5f                   	pop    %edi
+  8015b4:	5d                   	pop    %ebp
+  8015b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	8d 35 d4 15 80 00    	lea    0x8015d4,%esi
+  8015d2:	0f 34                	sysenter
+  8015d4:	5d                   	pop    %ebp
+		goto out;
+  8015d5:	eb da                	jmp    8015b1 <sys_trace_read+0x26>
+
+008015d7 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015d7:	55                   	push   %ebp
+  8015d8:	89 e5                	mov    %esp,%ebp
+  8015da:	57                   	push   %edi
+  8015db:	56                   	push   %esi
+  8015dc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015dd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015e4:	74 1c                	je     801602 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8015e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015eb:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f9:	89 f7                	mov    %esi,%edi
+  8015fb:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015fd:	5b                   	pop    %ebx
+  8015fe:	5e                   	pop    %esi
+  8015ff:	5f                   	pop    %edi
+  801600:	5d                   	pop    %ebp
+  801601:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801602:	8b 55 08             	mov    0x8(%ebp),%edx
+  801605:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801608:	b8 21 00 00 00       	mov    $0x21,%eax
+  80160d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801612:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	8d 35 20 16 80 00    	lea    0x801620,%esi
+  80161e:	0f 34                	sysenter
+  801620:	5d                   	pop    %ebp
+		goto out;
+  801621:	eb da                	jmp    8015fd <sys_meminfo+0x26>
+
+00801623 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801623:	55                   	push   %ebp
+  801624:	89 e5                	mov    %esp,%ebp
+  801626:	57                   	push   %edi
+  801627:	56                   	push   %esi
+  801628:	53                   	push   %ebx
+  801629:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80162c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801630:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801637:	74 1f                	je     801658 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801639:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801643:	8b 55 08             	mov    0x8(%ebp),%edx
+  801646:	89 df                	mov    %ebx,%edi
+  801648:	89 de                	mov    %ebx,%esi
+  80164a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80164c:	85 c0                	test   %eax,%eax
+  80164e:	7f 25                	jg     801675 <sys_env_set_ksm+0x52>
+}
+  801650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801653:	5b                   	pop    %ebx
+  801654:	5e                   	pop    %esi
+  801655:	5f                   	pop    %edi
+  801656:	5d                   	pop    %ebp
+  801657:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801658:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801660:	b8 22 00 00 00       	mov    $0x22,%eax
+  801665:	89 df                	mov    %ebx,%edi
+  801667:	55                   	push   %ebp
+  801668:	89 e5                	mov    %esp,%ebp
+  80166a:	8d 35 72 16 80 00    	lea    0x801672,%esi
+  801670:	0f 34                	sysenter
+  801672:	5d                   	pop    %ebp
+		goto out;
+  801673:	eb d7                	jmp    80164c <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801675:	83 ec 0c             	sub    $0xc,%esp
+  801678:	50                   	push   %eax
+  801679:	6a 22                	push   $0x22
+  80167b:	68 0b 3a 80 00       	push   $0x803a0b
+  801680:	6a 3f                	push   $0x3f
+  801682:	68 28 3a 80 00       	push   $0x803a28
+  801687:	e8 6c eb ff ff       	call   8001f8 <_panic>
+
+0080168c <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80168c:	55                   	push   %ebp
+  80168d:	89 e5                	mov    %esp,%ebp
+  80168f:	57                   	push   %edi
+  801690:	56                   	push   %esi
+  801691:	53                   	push   %ebx
+  801692:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801695:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801698:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80169f:	74 24                	je     8016c5 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8016a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016ab:	89 cb                	mov    %ecx,%ebx
+  8016ad:	89 cf                	mov    %ecx,%edi
+  8016af:	89 ce                	mov    %ecx,%esi
+  8016b1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016b3:	85 c0                	test   %eax,%eax
+  8016b5:	7f 2a                	jg     8016e1 <sys_time_nsec+0x55>
+	return ns;
+}
+  8016b7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016ba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c0:	5b                   	pop    %ebx
+  8016c1:	5e                   	pop    %esi
+  8016c2:	5f                   	pop    %edi
+  8016c3:	5d                   	pop    %ebp
+  8016c4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ca:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016cf:	89 cb                	mov    %ecx,%ebx
+  8016d1:	89 cf                	mov    %ecx,%edi
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	8d 35 de 16 80 00    	lea    0x8016de,%esi
+  8016dc:	0f 34                	sysenter
+  8016de:	5d                   	pop    %ebp
+		goto out;
+  8016df:	eb d2                	jmp    8016b3 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016e1:	83 ec 0c             	sub    $0xc,%esp
+  8016e4:	50                   	push   %eax
+  8016e5:	6a 0f                	push   $0xf
+  8016e7:	68 0b 3a 80 00       	push   $0x803a0b
+  8016ec:	6a 3f                	push   $0x3f
+  8016ee:	68 28 3a 80 00       	push   $0x803a28
+  8016f3:	e8 00 eb ff ff       	call   8001f8 <_panic>
+
+008016f8 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016f8:	55                   	push   %ebp
+  8016f9:	89 e5                	mov    %esp,%ebp
+  8016fb:	57                   	push   %edi
+  8016fc:	56                   	push   %esi
+  8016fd:	53                   	push   %ebx
+  8016fe:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801701:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801708:	74 22                	je     80172c <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80170a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801714:	8b 55 08             	mov    0x8(%ebp),%edx
+  801717:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171a:	89 df                	mov    %ebx,%edi
+  80171c:	89 de                	mov    %ebx,%esi
+  80171e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801720:	85 c0                	test   %eax,%eax
+  801722:	7f 28                	jg     80174c <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801727:	5b                   	pop    %ebx
+  801728:	5e                   	pop    %esi
+  801729:	5f                   	pop    %edi
+  80172a:	5d                   	pop    %ebp
+  80172b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80172c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801731:	8b 55 08             	mov    0x8(%ebp),%edx
+  801734:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801737:	b8 12 00 00 00       	mov    $0x12,%eax
+  80173c:	89 df                	mov    %ebx,%edi
+  80173e:	55                   	push   %ebp
+  80173f:	89 e5                	mov    %esp,%ebp
+  801741:	8d 35 49 17 80 00    	lea    0x801749,%esi
+  801747:	0f 34                	sysenter
+  801749:	5d                   	pop    %ebp
+		goto out;
+  80174a:	eb d4                	jmp    801720 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80174c:	83 ec 0c             	sub    $0xc,%esp
+  80174f:	50                   	push   %eax
+  801750:	6a 12                	push   $0x12
+  801752:	68 0b 3a 80 00       	push   $0x803a0b
+  801757:	6a 3f                	push   $0x3f
+  801759:	68 28 3a 80 00       	push   $0x803a28
+  80175e:	e8 95 ea ff ff       	call   8001f8 <_panic>
+
+00801763 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801763:	55                   	push   %ebp
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	57                   	push   %edi
+  801767:	56                   	push   %esi
+  801768:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801769:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801770:	74 1b                	je     80178d <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801772:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801777:	b8 13 00 00 00       	mov    $0x13,%eax
+  80177c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801782:	89 df                	mov    %ebx,%edi
+  801784:	89 de                	mov    %ebx,%esi
+  801786:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801788:	5b                   	pop    %ebx
+  801789:	5e                   	pop    %esi
+  80178a:	5f                   	pop    %edi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80178d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801792:	8b 55 08             	mov    0x8(%ebp),%edx
+  801795:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801798:	b8 13 00 00 00       	mov    $0x13,%eax
+  80179d:	89 df                	mov    %ebx,%edi
+  80179f:	55                   	push   %ebp
+  8017a0:	89 e5                	mov    %esp,%ebp
+  8017a2:	8d 35 aa 17 80 00    	lea    0x8017aa,%esi
+  8017a8:	0f 34                	sysenter
+  8017aa:	5d                   	pop    %ebp
+		goto out;
+  8017ab:	eb db                	jmp    801788 <sys_e1000_receive+0x25>
+
+008017ad <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8017ad:	55                   	push   %ebp
+  8017ae:	89 e5                	mov    %esp,%ebp
+  8017b0:	57                   	push   %edi
+  8017b1:	56                   	push   %esi
+  8017b2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017b3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017ba:	74 1b                	je     8017d7 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8017bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cc:	89 df                	mov    %ebx,%edi
+  8017ce:	89 de                	mov    %ebx,%esi
+  8017d0:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017d2:	5b                   	pop    %ebx
+  8017d3:	5e                   	pop    %esi
+  8017d4:	5f                   	pop    %edi
+  8017d5:	5d                   	pop    %ebp
+  8017d6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017e7:	89 df                	mov    %ebx,%edi
+  8017e9:	55                   	push   %ebp
+  8017ea:	89 e5                	mov    %esp,%ebp
+  8017ec:	8d 35 f4 17 80 00    	lea    0x8017f4,%esi
+  8017f2:	0f 34                	sysenter
+  8017f4:	5d                   	pop    %ebp
+		goto out;
+  8017f5:	eb db                	jmp    8017d2 <sys_e1000_read_hwaddr+0x25>
+
+008017f7 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017f7:	55                   	push   %ebp
+  8017f8:	89 e5                	mov    %esp,%ebp
+  8017fa:	57                   	push   %edi
+  8017fb:	56                   	push   %esi
+  8017fc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017fd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801804:	74 1a                	je     801820 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801806:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80180b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801810:	8b 55 08             	mov    0x8(%ebp),%edx
+  801813:	89 cb                	mov    %ecx,%ebx
+  801815:	89 cf                	mov    %ecx,%edi
+  801817:	89 ce                	mov    %ecx,%esi
+  801819:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80181b:	5b                   	pop    %ebx
+  80181c:	5e                   	pop    %esi
+  80181d:	5f                   	pop    %edi
+  80181e:	5d                   	pop    %ebp
+  80181f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801820:	8b 55 08             	mov    0x8(%ebp),%edx
+  801823:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801828:	b8 15 00 00 00       	mov    $0x15,%eax
+  80182d:	89 cb                	mov    %ecx,%ebx
+  80182f:	89 cf                	mov    %ecx,%edi
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	8d 35 3c 18 80 00    	lea    0x80183c,%esi
+  80183a:	0f 34                	sysenter
+  80183c:	5d                   	pop    %ebp
+		goto out;
+  80183d:	eb dc                	jmp    80181b <sys_sb16_read_version+0x24>
+
+0080183f <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80183f:	55                   	push   %ebp
+  801840:	89 e5                	mov    %esp,%ebp
+  801842:	57                   	push   %edi
+  801843:	56                   	push   %esi
+  801844:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801845:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80184c:	74 1b                	je     801869 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80184e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801853:	b8 16 00 00 00       	mov    $0x16,%eax
+  801858:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185e:	89 df                	mov    %ebx,%edi
+  801860:	89 de                	mov    %ebx,%esi
+  801862:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801864:	5b                   	pop    %ebx
+  801865:	5e                   	pop    %esi
+  801866:	5f                   	pop    %edi
+  801867:	5d                   	pop    %ebp
+  801868:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801869:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801871:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801874:	b8 16 00 00 00       	mov    $0x16,%eax
+  801879:	89 df                	mov    %ebx,%edi
+  80187b:	55                   	push   %ebp
+  80187c:	89 e5                	mov    %esp,%ebp
+  80187e:	8d 35 86 18 80 00    	lea    0x801886,%esi
+  801884:	0f 34                	sysenter
+  801886:	5d                   	pop    %ebp
+		goto out;
+  801887:	eb db                	jmp    801864 <sys_sb16_play+0x25>
+
+00801889 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801889:	55                   	push   %ebp
+  80188a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80188c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801894:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801897:	5d                   	pop    %ebp
+  801898:	c3                   	ret
+
+00801899 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801899:	55                   	push   %ebp
+  80189a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80189c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018a4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018a9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018ae:	5d                   	pop    %ebp
+  8018af:	c3                   	ret
+
+008018b0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018b3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018b8:	eb 02                	jmp    8018bc <fd_alloc+0xc>
+  8018ba:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018bc:	89 c2                	mov    %eax,%edx
+  8018be:	c1 ea 16             	shr    $0x16,%edx
+  8018c1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018c8:	f6 c2 01             	test   $0x1,%dl
+  8018cb:	74 2b                	je     8018f8 <fd_alloc+0x48>
+  8018cd:	89 c2                	mov    %eax,%edx
+  8018cf:	c1 ea 0c             	shr    $0xc,%edx
+  8018d2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018d9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018df:	f6 c1 01             	test   $0x1,%cl
+  8018e2:	74 14                	je     8018f8 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018e4:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018ea:	75 ce                	jne    8018ba <fd_alloc+0xa>
+  8018ec:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018f1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018f6:	eb 05                	jmp    8018fd <fd_alloc+0x4d>
+			return 0;
+  8018f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801900:	89 02                	mov    %eax,(%edx)
+}
+  801902:	89 c8                	mov    %ecx,%eax
+  801904:	5d                   	pop    %ebp
+  801905:	c3                   	ret
+
+00801906 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801906:	55                   	push   %ebp
+  801907:	89 e5                	mov    %esp,%ebp
+  801909:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80190c:	83 f8 1f             	cmp    $0x1f,%eax
+  80190f:	77 30                	ja     801941 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801911:	c1 e0 0c             	shl    $0xc,%eax
+  801914:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801919:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80191f:	f6 c2 01             	test   $0x1,%dl
+  801922:	74 24                	je     801948 <fd_lookup+0x42>
+  801924:	89 c2                	mov    %eax,%edx
+  801926:	c1 ea 0c             	shr    $0xc,%edx
+  801929:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801930:	f6 c2 01             	test   $0x1,%dl
+  801933:	74 1a                	je     80194f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801935:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801938:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80193a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80193f:	5d                   	pop    %ebp
+  801940:	c3                   	ret
+		return -E_INVAL;
+  801941:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801946:	eb f7                	jmp    80193f <fd_lookup+0x39>
+		return -E_INVAL;
+  801948:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194d:	eb f0                	jmp    80193f <fd_lookup+0x39>
+  80194f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801954:	eb e9                	jmp    80193f <fd_lookup+0x39>
+
+00801956 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801956:	55                   	push   %ebp
+  801957:	89 e5                	mov    %esp,%ebp
+  801959:	53                   	push   %ebx
+  80195a:	83 ec 04             	sub    $0x4,%esp
+  80195d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801960:	b8 00 00 00 00       	mov    $0x0,%eax
+  801965:	eb 03                	jmp    80196a <dev_lookup+0x14>
+  801967:	83 c0 01             	add    $0x1,%eax
+  80196a:	8b 1c 85 b4 3a 80 00 	mov    0x803ab4(,%eax,4),%ebx
+  801971:	85 db                	test   %ebx,%ebx
+  801973:	74 0b                	je     801980 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801975:	39 13                	cmp    %edx,(%ebx)
+  801977:	75 ee                	jne    801967 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197e:	eb 2e                	jmp    8019ae <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801980:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801982:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801987:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80198d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801992:	76 24                	jbe    8019b8 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801994:	8b 41 48             	mov    0x48(%ecx),%eax
+  801997:	83 ec 04             	sub    $0x4,%esp
+  80199a:	52                   	push   %edx
+  80199b:	50                   	push   %eax
+  80199c:	68 38 3a 80 00       	push   $0x803a38
+  8019a1:	e8 2d e9 ff ff       	call   8002d3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019a6:	83 c4 10             	add    $0x10,%esp
+  8019a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019b1:	89 1a                	mov    %ebx,(%edx)
+}
+  8019b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b6:	c9                   	leave
+  8019b7:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8019b8:	c1 e8 10             	shr    $0x10,%eax
+  8019bb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8019c1:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8019c7:	eb cb                	jmp    801994 <dev_lookup+0x3e>
+
+008019c9 <fd_close>:
+{
+  8019c9:	55                   	push   %ebp
+  8019ca:	89 e5                	mov    %esp,%ebp
+  8019cc:	57                   	push   %edi
+  8019cd:	56                   	push   %esi
+  8019ce:	53                   	push   %ebx
+  8019cf:	83 ec 24             	sub    $0x24,%esp
+  8019d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019d8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019db:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019dc:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019e2:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019e5:	50                   	push   %eax
+  8019e6:	e8 1b ff ff ff       	call   801906 <fd_lookup>
+  8019eb:	89 c3                	mov    %eax,%ebx
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 05                	js     8019f9 <fd_close+0x30>
+	    || fd != fd2)
+  8019f4:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019f7:	74 16                	je     801a0f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019f9:	89 f8                	mov    %edi,%eax
+  8019fb:	84 c0                	test   %al,%al
+  8019fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a02:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a05:	89 d8                	mov    %ebx,%eax
+  801a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0a:	5b                   	pop    %ebx
+  801a0b:	5e                   	pop    %esi
+  801a0c:	5f                   	pop    %edi
+  801a0d:	5d                   	pop    %ebp
+  801a0e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a0f:	83 ec 08             	sub    $0x8,%esp
+  801a12:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a15:	50                   	push   %eax
+  801a16:	ff 36                	push   (%esi)
+  801a18:	e8 39 ff ff ff       	call   801956 <dev_lookup>
+  801a1d:	89 c3                	mov    %eax,%ebx
+  801a1f:	83 c4 10             	add    $0x10,%esp
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	78 1a                	js     801a40 <fd_close+0x77>
+		if (dev->dev_close)
+  801a26:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a29:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	74 0b                	je     801a40 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a35:	83 ec 0c             	sub    $0xc,%esp
+  801a38:	56                   	push   %esi
+  801a39:	ff d0                	call   *%eax
+  801a3b:	89 c3                	mov    %eax,%ebx
+  801a3d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a40:	83 ec 08             	sub    $0x8,%esp
+  801a43:	56                   	push   %esi
+  801a44:	6a 00                	push   $0x0
+  801a46:	e8 a3 f4 ff ff       	call   800eee <sys_page_unmap>
+	return r;
+  801a4b:	83 c4 10             	add    $0x10,%esp
+  801a4e:	eb b5                	jmp    801a05 <fd_close+0x3c>
+
+00801a50 <close>:
+
+int
+close(int fdnum)
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a59:	50                   	push   %eax
+  801a5a:	ff 75 08             	push   0x8(%ebp)
+  801a5d:	e8 a4 fe ff ff       	call   801906 <fd_lookup>
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	79 02                	jns    801a6b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+		return fd_close(fd, 1);
+  801a6b:	83 ec 08             	sub    $0x8,%esp
+  801a6e:	6a 01                	push   $0x1
+  801a70:	ff 75 f4             	push   -0xc(%ebp)
+  801a73:	e8 51 ff ff ff       	call   8019c9 <fd_close>
+  801a78:	83 c4 10             	add    $0x10,%esp
+  801a7b:	eb ec                	jmp    801a69 <close+0x19>
+
+00801a7d <close_all>:
+
+void
+close_all(void)
+{
+  801a7d:	55                   	push   %ebp
+  801a7e:	89 e5                	mov    %esp,%ebp
+  801a80:	53                   	push   %ebx
+  801a81:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a84:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a89:	83 ec 0c             	sub    $0xc,%esp
+  801a8c:	53                   	push   %ebx
+  801a8d:	e8 be ff ff ff       	call   801a50 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a92:	83 c3 01             	add    $0x1,%ebx
+  801a95:	83 c4 10             	add    $0x10,%esp
+  801a98:	83 fb 20             	cmp    $0x20,%ebx
+  801a9b:	75 ec                	jne    801a89 <close_all+0xc>
+}
+  801a9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aa0:	c9                   	leave
+  801aa1:	c3                   	ret
+
+00801aa2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801aa2:	55                   	push   %ebp
+  801aa3:	89 e5                	mov    %esp,%ebp
+  801aa5:	57                   	push   %edi
+  801aa6:	56                   	push   %esi
+  801aa7:	53                   	push   %ebx
+  801aa8:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801aab:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801aae:	50                   	push   %eax
+  801aaf:	ff 75 08             	push   0x8(%ebp)
+  801ab2:	e8 4f fe ff ff       	call   801906 <fd_lookup>
+  801ab7:	89 c3                	mov    %eax,%ebx
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	78 7f                	js     801b3f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ac0:	83 ec 0c             	sub    $0xc,%esp
+  801ac3:	ff 75 0c             	push   0xc(%ebp)
+  801ac6:	e8 85 ff ff ff       	call   801a50 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801acb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ace:	c1 e6 0c             	shl    $0xc,%esi
+  801ad1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ad7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ada:	89 3c 24             	mov    %edi,(%esp)
+  801add:	e8 b7 fd ff ff       	call   801899 <fd2data>
+  801ae2:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801ae4:	89 34 24             	mov    %esi,(%esp)
+  801ae7:	e8 ad fd ff ff       	call   801899 <fd2data>
+  801aec:	83 c4 10             	add    $0x10,%esp
+  801aef:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801af2:	89 d8                	mov    %ebx,%eax
+  801af4:	c1 e8 16             	shr    $0x16,%eax
+  801af7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801afe:	a8 01                	test   $0x1,%al
+  801b00:	74 11                	je     801b13 <dup+0x71>
+  801b02:	89 d8                	mov    %ebx,%eax
+  801b04:	c1 e8 0c             	shr    $0xc,%eax
+  801b07:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b0e:	f6 c2 01             	test   $0x1,%dl
+  801b11:	75 36                	jne    801b49 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b13:	89 f8                	mov    %edi,%eax
+  801b15:	c1 e8 0c             	shr    $0xc,%eax
+  801b18:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b1f:	83 ec 0c             	sub    $0xc,%esp
+  801b22:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b27:	50                   	push   %eax
+  801b28:	56                   	push   %esi
+  801b29:	6a 00                	push   $0x0
+  801b2b:	57                   	push   %edi
+  801b2c:	6a 00                	push   $0x0
+  801b2e:	e8 4d f3 ff ff       	call   800e80 <sys_page_map>
+  801b33:	89 c3                	mov    %eax,%ebx
+  801b35:	83 c4 20             	add    $0x20,%esp
+  801b38:	85 c0                	test   %eax,%eax
+  801b3a:	78 33                	js     801b6f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b3c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b3f:	89 d8                	mov    %ebx,%eax
+  801b41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b44:	5b                   	pop    %ebx
+  801b45:	5e                   	pop    %esi
+  801b46:	5f                   	pop    %edi
+  801b47:	5d                   	pop    %ebp
+  801b48:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b49:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b50:	83 ec 0c             	sub    $0xc,%esp
+  801b53:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b58:	50                   	push   %eax
+  801b59:	ff 75 d4             	push   -0x2c(%ebp)
+  801b5c:	6a 00                	push   $0x0
+  801b5e:	53                   	push   %ebx
+  801b5f:	6a 00                	push   $0x0
+  801b61:	e8 1a f3 ff ff       	call   800e80 <sys_page_map>
+  801b66:	89 c3                	mov    %eax,%ebx
+  801b68:	83 c4 20             	add    $0x20,%esp
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	79 a4                	jns    801b13 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b6f:	83 ec 08             	sub    $0x8,%esp
+  801b72:	56                   	push   %esi
+  801b73:	6a 00                	push   $0x0
+  801b75:	e8 74 f3 ff ff       	call   800eee <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b7a:	83 c4 08             	add    $0x8,%esp
+  801b7d:	ff 75 d4             	push   -0x2c(%ebp)
+  801b80:	6a 00                	push   $0x0
+  801b82:	e8 67 f3 ff ff       	call   800eee <sys_page_unmap>
+	return r;
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	eb b3                	jmp    801b3f <dup+0x9d>
+
+00801b8c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b8c:	55                   	push   %ebp
+  801b8d:	89 e5                	mov    %esp,%ebp
+  801b8f:	56                   	push   %esi
+  801b90:	53                   	push   %ebx
+  801b91:	83 ec 18             	sub    $0x18,%esp
+  801b94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b9a:	50                   	push   %eax
+  801b9b:	53                   	push   %ebx
+  801b9c:	e8 65 fd ff ff       	call   801906 <fd_lookup>
+  801ba1:	83 c4 10             	add    $0x10,%esp
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	78 3c                	js     801be4 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ba8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bab:	83 ec 08             	sub    $0x8,%esp
+  801bae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb1:	50                   	push   %eax
+  801bb2:	ff 36                	push   (%esi)
+  801bb4:	e8 9d fd ff ff       	call   801956 <dev_lookup>
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 24                	js     801be4 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bc0:	8b 46 08             	mov    0x8(%esi),%eax
+  801bc3:	83 e0 03             	and    $0x3,%eax
+  801bc6:	83 f8 01             	cmp    $0x1,%eax
+  801bc9:	74 20                	je     801beb <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801bcb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bce:	8b 40 08             	mov    0x8(%eax),%eax
+  801bd1:	85 c0                	test   %eax,%eax
+  801bd3:	74 57                	je     801c2c <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bd5:	83 ec 04             	sub    $0x4,%esp
+  801bd8:	ff 75 10             	push   0x10(%ebp)
+  801bdb:	ff 75 0c             	push   0xc(%ebp)
+  801bde:	56                   	push   %esi
+  801bdf:	ff d0                	call   *%eax
+  801be1:	83 c4 10             	add    $0x10,%esp
+}
+  801be4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be7:	5b                   	pop    %ebx
+  801be8:	5e                   	pop    %esi
+  801be9:	5d                   	pop    %ebp
+  801bea:	c3                   	ret
+  801beb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bed:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bf2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bf8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bfd:	76 1c                	jbe    801c1b <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bff:	8b 42 48             	mov    0x48(%edx),%eax
+  801c02:	83 ec 04             	sub    $0x4,%esp
+  801c05:	53                   	push   %ebx
+  801c06:	50                   	push   %eax
+  801c07:	68 79 3a 80 00       	push   $0x803a79
+  801c0c:	e8 c2 e6 ff ff       	call   8002d3 <cprintf>
+		return -E_INVAL;
+  801c11:	83 c4 10             	add    $0x10,%esp
+  801c14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c19:	eb c9                	jmp    801be4 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c1b:	c1 e8 10             	shr    $0x10,%eax
+  801c1e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c24:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c2a:	eb d3                	jmp    801bff <read+0x73>
+		return -E_NOT_SUPP;
+  801c2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c31:	eb b1                	jmp    801be4 <read+0x58>
+
+00801c33 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c33:	55                   	push   %ebp
+  801c34:	89 e5                	mov    %esp,%ebp
+  801c36:	57                   	push   %edi
+  801c37:	56                   	push   %esi
+  801c38:	53                   	push   %ebx
+  801c39:	83 ec 0c             	sub    $0xc,%esp
+  801c3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c3f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c47:	eb 02                	jmp    801c4b <readn+0x18>
+  801c49:	01 c3                	add    %eax,%ebx
+  801c4b:	39 f3                	cmp    %esi,%ebx
+  801c4d:	73 21                	jae    801c70 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c4f:	83 ec 04             	sub    $0x4,%esp
+  801c52:	89 f0                	mov    %esi,%eax
+  801c54:	29 d8                	sub    %ebx,%eax
+  801c56:	50                   	push   %eax
+  801c57:	89 d8                	mov    %ebx,%eax
+  801c59:	03 45 0c             	add    0xc(%ebp),%eax
+  801c5c:	50                   	push   %eax
+  801c5d:	57                   	push   %edi
+  801c5e:	e8 29 ff ff ff       	call   801b8c <read>
+		if (m < 0)
+  801c63:	83 c4 10             	add    $0x10,%esp
+  801c66:	85 c0                	test   %eax,%eax
+  801c68:	78 04                	js     801c6e <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c6a:	75 dd                	jne    801c49 <readn+0x16>
+  801c6c:	eb 02                	jmp    801c70 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c6e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c70:	89 d8                	mov    %ebx,%eax
+  801c72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c75:	5b                   	pop    %ebx
+  801c76:	5e                   	pop    %esi
+  801c77:	5f                   	pop    %edi
+  801c78:	5d                   	pop    %ebp
+  801c79:	c3                   	ret
+
+00801c7a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	56                   	push   %esi
+  801c7e:	53                   	push   %ebx
+  801c7f:	83 ec 18             	sub    $0x18,%esp
+  801c82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c85:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c88:	50                   	push   %eax
+  801c89:	53                   	push   %ebx
+  801c8a:	e8 77 fc ff ff       	call   801906 <fd_lookup>
+  801c8f:	83 c4 10             	add    $0x10,%esp
+  801c92:	85 c0                	test   %eax,%eax
+  801c94:	78 37                	js     801ccd <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c96:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c99:	83 ec 08             	sub    $0x8,%esp
+  801c9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c9f:	50                   	push   %eax
+  801ca0:	ff 36                	push   (%esi)
+  801ca2:	e8 af fc ff ff       	call   801956 <dev_lookup>
+  801ca7:	83 c4 10             	add    $0x10,%esp
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	78 1f                	js     801ccd <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cae:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cb2:	74 20                	je     801cd4 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cba:	85 c0                	test   %eax,%eax
+  801cbc:	74 57                	je     801d15 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801cbe:	83 ec 04             	sub    $0x4,%esp
+  801cc1:	ff 75 10             	push   0x10(%ebp)
+  801cc4:	ff 75 0c             	push   0xc(%ebp)
+  801cc7:	56                   	push   %esi
+  801cc8:	ff d0                	call   *%eax
+  801cca:	83 c4 10             	add    $0x10,%esp
+}
+  801ccd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cd0:	5b                   	pop    %ebx
+  801cd1:	5e                   	pop    %esi
+  801cd2:	5d                   	pop    %ebp
+  801cd3:	c3                   	ret
+  801cd4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cd6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cdb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ce1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ce6:	76 1c                	jbe    801d04 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ce8:	8b 42 48             	mov    0x48(%edx),%eax
+  801ceb:	83 ec 04             	sub    $0x4,%esp
+  801cee:	53                   	push   %ebx
+  801cef:	50                   	push   %eax
+  801cf0:	68 95 3a 80 00       	push   $0x803a95
+  801cf5:	e8 d9 e5 ff ff       	call   8002d3 <cprintf>
+		return -E_INVAL;
+  801cfa:	83 c4 10             	add    $0x10,%esp
+  801cfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d02:	eb c9                	jmp    801ccd <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d04:	c1 e8 10             	shr    $0x10,%eax
+  801d07:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d0d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d13:	eb d3                	jmp    801ce8 <write+0x6e>
+		return -E_NOT_SUPP;
+  801d15:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d1a:	eb b1                	jmp    801ccd <write+0x53>
+
+00801d1c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d25:	50                   	push   %eax
+  801d26:	ff 75 08             	push   0x8(%ebp)
+  801d29:	e8 d8 fb ff ff       	call   801906 <fd_lookup>
+  801d2e:	83 c4 10             	add    $0x10,%esp
+  801d31:	85 c0                	test   %eax,%eax
+  801d33:	78 0e                	js     801d43 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d3b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d43:	c9                   	leave
+  801d44:	c3                   	ret
+
+00801d45 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d45:	55                   	push   %ebp
+  801d46:	89 e5                	mov    %esp,%ebp
+  801d48:	56                   	push   %esi
+  801d49:	53                   	push   %ebx
+  801d4a:	83 ec 18             	sub    $0x18,%esp
+  801d4d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d50:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d53:	50                   	push   %eax
+  801d54:	53                   	push   %ebx
+  801d55:	e8 ac fb ff ff       	call   801906 <fd_lookup>
+  801d5a:	83 c4 10             	add    $0x10,%esp
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	78 34                	js     801d95 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d61:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d64:	83 ec 08             	sub    $0x8,%esp
+  801d67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6a:	50                   	push   %eax
+  801d6b:	ff 36                	push   (%esi)
+  801d6d:	e8 e4 fb ff ff       	call   801956 <dev_lookup>
+  801d72:	83 c4 10             	add    $0x10,%esp
+  801d75:	85 c0                	test   %eax,%eax
+  801d77:	78 1c                	js     801d95 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d79:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d7d:	74 1d                	je     801d9c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d82:	8b 40 18             	mov    0x18(%eax),%eax
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	74 54                	je     801ddd <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d89:	83 ec 08             	sub    $0x8,%esp
+  801d8c:	ff 75 0c             	push   0xc(%ebp)
+  801d8f:	56                   	push   %esi
+  801d90:	ff d0                	call   *%eax
+  801d92:	83 c4 10             	add    $0x10,%esp
+}
+  801d95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d98:	5b                   	pop    %ebx
+  801d99:	5e                   	pop    %esi
+  801d9a:	5d                   	pop    %ebp
+  801d9b:	c3                   	ret
+  801d9c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d9e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801da3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801da9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801dae:	76 1c                	jbe    801dcc <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801db0:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801db3:	83 ec 04             	sub    $0x4,%esp
+  801db6:	53                   	push   %ebx
+  801db7:	50                   	push   %eax
+  801db8:	68 58 3a 80 00       	push   $0x803a58
+  801dbd:	e8 11 e5 ff ff       	call   8002d3 <cprintf>
+		return -E_INVAL;
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dca:	eb c9                	jmp    801d95 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801dcc:	c1 e8 10             	shr    $0x10,%eax
+  801dcf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dd5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ddb:	eb d3                	jmp    801db0 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801ddd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801de2:	eb b1                	jmp    801d95 <ftruncate+0x50>
+
+00801de4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801de4:	55                   	push   %ebp
+  801de5:	89 e5                	mov    %esp,%ebp
+  801de7:	56                   	push   %esi
+  801de8:	53                   	push   %ebx
+  801de9:	83 ec 18             	sub    $0x18,%esp
+  801dec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801def:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801df2:	50                   	push   %eax
+  801df3:	ff 75 08             	push   0x8(%ebp)
+  801df6:	e8 0b fb ff ff       	call   801906 <fd_lookup>
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	78 49                	js     801e4b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e02:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e05:	83 ec 08             	sub    $0x8,%esp
+  801e08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e0b:	50                   	push   %eax
+  801e0c:	ff 36                	push   (%esi)
+  801e0e:	e8 43 fb ff ff       	call   801956 <dev_lookup>
+  801e13:	83 c4 10             	add    $0x10,%esp
+  801e16:	85 c0                	test   %eax,%eax
+  801e18:	78 31                	js     801e4b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e1d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e21:	74 2f                	je     801e52 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e23:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e26:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e2d:	00 00 00 
+	stat->st_isdir = 0;
+  801e30:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e37:	00 00 00 
+	stat->st_dev = dev;
+  801e3a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e40:	83 ec 08             	sub    $0x8,%esp
+  801e43:	53                   	push   %ebx
+  801e44:	56                   	push   %esi
+  801e45:	ff 50 14             	call   *0x14(%eax)
+  801e48:	83 c4 10             	add    $0x10,%esp
+}
+  801e4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e4e:	5b                   	pop    %ebx
+  801e4f:	5e                   	pop    %esi
+  801e50:	5d                   	pop    %ebp
+  801e51:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e52:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e57:	eb f2                	jmp    801e4b <fstat+0x67>
+
+00801e59 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e59:	55                   	push   %ebp
+  801e5a:	89 e5                	mov    %esp,%ebp
+  801e5c:	56                   	push   %esi
+  801e5d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e5e:	83 ec 08             	sub    $0x8,%esp
+  801e61:	6a 00                	push   $0x0
+  801e63:	ff 75 08             	push   0x8(%ebp)
+  801e66:	e8 e4 01 00 00       	call   80204f <open>
+  801e6b:	89 c3                	mov    %eax,%ebx
+  801e6d:	83 c4 10             	add    $0x10,%esp
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	78 1b                	js     801e8f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e74:	83 ec 08             	sub    $0x8,%esp
+  801e77:	ff 75 0c             	push   0xc(%ebp)
+  801e7a:	50                   	push   %eax
+  801e7b:	e8 64 ff ff ff       	call   801de4 <fstat>
+  801e80:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e82:	89 1c 24             	mov    %ebx,(%esp)
+  801e85:	e8 c6 fb ff ff       	call   801a50 <close>
+	return r;
+  801e8a:	83 c4 10             	add    $0x10,%esp
+  801e8d:	89 f3                	mov    %esi,%ebx
+}
+  801e8f:	89 d8                	mov    %ebx,%eax
+  801e91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e94:	5b                   	pop    %ebx
+  801e95:	5e                   	pop    %esi
+  801e96:	5d                   	pop    %ebp
+  801e97:	c3                   	ret
+
+00801e98 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e98:	55                   	push   %ebp
+  801e99:	89 e5                	mov    %esp,%ebp
+  801e9b:	56                   	push   %esi
+  801e9c:	53                   	push   %ebx
+  801e9d:	89 c6                	mov    %eax,%esi
+  801e9f:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ea1:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801ea8:	74 27                	je     801ed1 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801eaa:	6a 07                	push   $0x7
+  801eac:	68 00 60 80 00       	push   $0x806000
+  801eb1:	56                   	push   %esi
+  801eb2:	ff 35 00 50 80 00    	push   0x805000
+  801eb8:	e8 fc 13 00 00       	call   8032b9 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ebd:	83 c4 0c             	add    $0xc,%esp
+  801ec0:	6a 00                	push   $0x0
+  801ec2:	53                   	push   %ebx
+  801ec3:	6a 00                	push   $0x0
+  801ec5:	e8 d7 13 00 00       	call   8032a1 <ipc_recv>
+}
+  801eca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ecd:	5b                   	pop    %ebx
+  801ece:	5e                   	pop    %esi
+  801ecf:	5d                   	pop    %ebp
+  801ed0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ed1:	83 ec 0c             	sub    $0xc,%esp
+  801ed4:	6a 01                	push   $0x1
+  801ed6:	e8 32 14 00 00       	call   80330d <ipc_find_env>
+  801edb:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ee0:	83 c4 10             	add    $0x10,%esp
+  801ee3:	eb c5                	jmp    801eaa <fsipc+0x12>
+
+00801ee5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ee5:	55                   	push   %ebp
+  801ee6:	89 e5                	mov    %esp,%ebp
+  801ee8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801eeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eee:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ef6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ef9:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801efe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f03:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f08:	e8 8b ff ff ff       	call   801e98 <fsipc>
+}
+  801f0d:	c9                   	leave
+  801f0e:	c3                   	ret
+
+00801f0f <devfile_flush>:
+{
+  801f0f:	55                   	push   %ebp
+  801f10:	89 e5                	mov    %esp,%ebp
+  801f12:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f18:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f1b:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f25:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f2a:	e8 69 ff ff ff       	call   801e98 <fsipc>
+}
+  801f2f:	c9                   	leave
+  801f30:	c3                   	ret
+
+00801f31 <devfile_stat>:
+{
+  801f31:	55                   	push   %ebp
+  801f32:	89 e5                	mov    %esp,%ebp
+  801f34:	53                   	push   %ebx
+  801f35:	83 ec 04             	sub    $0x4,%esp
+  801f38:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f41:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f50:	e8 43 ff ff ff       	call   801e98 <fsipc>
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 2c                	js     801f85 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f59:	83 ec 08             	sub    $0x8,%esp
+  801f5c:	68 00 60 80 00       	push   $0x806000
+  801f61:	53                   	push   %ebx
+  801f62:	e8 b4 e9 ff ff       	call   80091b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f67:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f6c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f72:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f77:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f7d:	83 c4 10             	add    $0x10,%esp
+  801f80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f88:	c9                   	leave
+  801f89:	c3                   	ret
+
+00801f8a <devfile_write>:
+{
+  801f8a:	55                   	push   %ebp
+  801f8b:	89 e5                	mov    %esp,%ebp
+  801f8d:	83 ec 0c             	sub    $0xc,%esp
+  801f90:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f96:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f99:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801f9f:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801fa4:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fa9:	39 d0                	cmp    %edx,%eax
+  801fab:	0f 47 c2             	cmova  %edx,%eax
+  801fae:	50                   	push   %eax
+  801faf:	ff 75 0c             	push   0xc(%ebp)
+  801fb2:	68 08 60 80 00       	push   $0x806008
+  801fb7:	e8 e5 ea ff ff       	call   800aa1 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc1:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fc6:	e8 cd fe ff ff       	call   801e98 <fsipc>
+}
+  801fcb:	c9                   	leave
+  801fcc:	c3                   	ret
+
+00801fcd <devfile_read>:
+{
+  801fcd:	55                   	push   %ebp
+  801fce:	89 e5                	mov    %esp,%ebp
+  801fd0:	56                   	push   %esi
+  801fd1:	53                   	push   %ebx
+  801fd2:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fdb:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801fe0:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fe6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801feb:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ff0:	e8 a3 fe ff ff       	call   801e98 <fsipc>
+  801ff5:	89 c3                	mov    %eax,%ebx
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 1f                	js     80201a <devfile_read+0x4d>
+	assert(r <= n);
+  801ffb:	39 c6                	cmp    %eax,%esi
+  801ffd:	72 24                	jb     802023 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801fff:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802004:	7f 33                	jg     802039 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802006:	83 ec 04             	sub    $0x4,%esp
+  802009:	50                   	push   %eax
+  80200a:	68 00 60 80 00       	push   $0x806000
+  80200f:	ff 75 0c             	push   0xc(%ebp)
+  802012:	e8 8a ea ff ff       	call   800aa1 <memmove>
+	return r;
+  802017:	83 c4 10             	add    $0x10,%esp
+}
+  80201a:	89 d8                	mov    %ebx,%eax
+  80201c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80201f:	5b                   	pop    %ebx
+  802020:	5e                   	pop    %esi
+  802021:	5d                   	pop    %ebp
+  802022:	c3                   	ret
+	assert(r <= n);
+  802023:	68 c8 3a 80 00       	push   $0x803ac8
+  802028:	68 cf 3a 80 00       	push   $0x803acf
+  80202d:	6a 76                	push   $0x76
+  80202f:	68 e4 3a 80 00       	push   $0x803ae4
+  802034:	e8 bf e1 ff ff       	call   8001f8 <_panic>
+	assert(r <= PGSIZE);
+  802039:	68 ef 3a 80 00       	push   $0x803aef
+  80203e:	68 cf 3a 80 00       	push   $0x803acf
+  802043:	6a 77                	push   $0x77
+  802045:	68 e4 3a 80 00       	push   $0x803ae4
+  80204a:	e8 a9 e1 ff ff       	call   8001f8 <_panic>
+
+0080204f <open>:
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	56                   	push   %esi
+  802053:	53                   	push   %ebx
+  802054:	83 ec 1c             	sub    $0x1c,%esp
+  802057:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80205a:	56                   	push   %esi
+  80205b:	e8 80 e8 ff ff       	call   8008e0 <strlen>
+  802060:	83 c4 10             	add    $0x10,%esp
+  802063:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802068:	7f 6c                	jg     8020d6 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80206a:	83 ec 0c             	sub    $0xc,%esp
+  80206d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802070:	50                   	push   %eax
+  802071:	e8 3a f8 ff ff       	call   8018b0 <fd_alloc>
+  802076:	89 c3                	mov    %eax,%ebx
+  802078:	83 c4 10             	add    $0x10,%esp
+  80207b:	85 c0                	test   %eax,%eax
+  80207d:	78 3c                	js     8020bb <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80207f:	83 ec 08             	sub    $0x8,%esp
+  802082:	56                   	push   %esi
+  802083:	68 00 60 80 00       	push   $0x806000
+  802088:	e8 8e e8 ff ff       	call   80091b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80208d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802090:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802095:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802098:	b8 01 00 00 00       	mov    $0x1,%eax
+  80209d:	e8 f6 fd ff ff       	call   801e98 <fsipc>
+  8020a2:	89 c3                	mov    %eax,%ebx
+  8020a4:	83 c4 10             	add    $0x10,%esp
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 19                	js     8020c4 <open+0x75>
+	return fd2num(fd);
+  8020ab:	83 ec 0c             	sub    $0xc,%esp
+  8020ae:	ff 75 f4             	push   -0xc(%ebp)
+  8020b1:	e8 d3 f7 ff ff       	call   801889 <fd2num>
+  8020b6:	89 c3                	mov    %eax,%ebx
+  8020b8:	83 c4 10             	add    $0x10,%esp
+}
+  8020bb:	89 d8                	mov    %ebx,%eax
+  8020bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c0:	5b                   	pop    %ebx
+  8020c1:	5e                   	pop    %esi
+  8020c2:	5d                   	pop    %ebp
+  8020c3:	c3                   	ret
+		fd_close(fd, 0);
+  8020c4:	83 ec 08             	sub    $0x8,%esp
+  8020c7:	6a 00                	push   $0x0
+  8020c9:	ff 75 f4             	push   -0xc(%ebp)
+  8020cc:	e8 f8 f8 ff ff       	call   8019c9 <fd_close>
+		return r;
+  8020d1:	83 c4 10             	add    $0x10,%esp
+  8020d4:	eb e5                	jmp    8020bb <open+0x6c>
+		return -E_BAD_PATH;
+  8020d6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020db:	eb de                	jmp    8020bb <open+0x6c>
+
+008020dd <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020dd:	55                   	push   %ebp
+  8020de:	89 e5                	mov    %esp,%ebp
+  8020e0:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020ed:	e8 a6 fd ff ff       	call   801e98 <fsipc>
+}
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+008020f4 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	57                   	push   %edi
+  8020f8:	56                   	push   %esi
+  8020f9:	53                   	push   %ebx
+  8020fa:	81 ec 54 04 00 00    	sub    $0x454,%esp
+	//
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802100:	6a 00                	push   $0x0
+  802102:	ff 75 08             	push   0x8(%ebp)
+  802105:	e8 45 ff ff ff       	call   80204f <open>
+  80210a:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802110:	83 c4 10             	add    $0x10,%esp
+  802113:	85 c0                	test   %eax,%eax
+  802115:	0f 88 7a 06 00 00    	js     802795 <spawn+0x6a1>
+  80211b:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  80211d:	83 ec 04             	sub    $0x4,%esp
+  802120:	68 00 02 00 00       	push   $0x200
+  802125:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80212b:	50                   	push   %eax
+  80212c:	51                   	push   %ecx
+  80212d:	e8 01 fb ff ff       	call   801c33 <readn>
+  802132:	83 c4 10             	add    $0x10,%esp
+  802135:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80213a:	75 7a                	jne    8021b6 <spawn+0xc2>
+	    || elf->e_magic != ELF_MAGIC) {
+  80213c:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802143:	45 4c 46 
+  802146:	75 6e                	jne    8021b6 <spawn+0xc2>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802148:	b8 07 00 00 00       	mov    $0x7,%eax
+  80214d:	cd 30                	int    $0x30
+  80214f:	89 85 cc fb ff ff    	mov    %eax,-0x434(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802155:	89 c6                	mov    %eax,%esi
+  802157:	85 c0                	test   %eax,%eax
+  802159:	0f 88 2a 06 00 00    	js     802789 <spawn+0x695>
+		return r;
+	child = r;
+
+	// The child's memory is its own, not our demand-zero regions.
+	if ((r = sys_region_release(child, 0, UTOP)) < 0)
+  80215f:	83 ec 04             	sub    $0x4,%esp
+  802162:	68 00 00 c0 ee       	push   $0xeec00000
+  802167:	6a 00                	push   $0x0
+  802169:	50                   	push   %eax
+  80216a:	e8 1d f3 ff ff       	call   80148c <sys_region_release>
+  80216f:	89 c7                	mov    %eax,%edi
+  802171:	83 c4 10             	add    $0x10,%esp
+  802174:	85 c0                	test   %eax,%eax
+  802176:	0f 88 da 05 00 00    	js     802756 <spawn+0x662>
+		goto error;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  80217c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  802182:	69 f6 58 01 00 00    	imul   $0x158,%esi,%esi
+  802188:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80218e:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802194:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802199:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  80219b:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8021a1:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8021a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8021ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8021b4:	eb 4b                	jmp    802201 <spawn+0x10d>
+		close(fd);
+  8021b6:	83 ec 0c             	sub    $0xc,%esp
+  8021b9:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8021bf:	e8 8c f8 ff ff       	call   801a50 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8021c4:	83 c4 0c             	add    $0xc,%esp
+  8021c7:	68 7f 45 4c 46       	push   $0x464c457f
+  8021cc:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8021d2:	68 fb 3a 80 00       	push   $0x803afb
+  8021d7:	e8 f7 e0 ff ff       	call   8002d3 <cprintf>
+		return -E_NOT_EXEC;
+  8021dc:	83 c4 10             	add    $0x10,%esp
+  8021df:	c7 85 d0 fb ff ff f2 	movl   $0xfffffff2,-0x430(%ebp)
+  8021e6:	ff ff ff 
+  8021e9:	e9 a7 05 00 00       	jmp    802795 <spawn+0x6a1>
+		string_size += strlen(argv[argc]) + 1;
+  8021ee:	83 ec 0c             	sub    $0xc,%esp
+  8021f1:	50                   	push   %eax
+  8021f2:	e8 e9 e6 ff ff       	call   8008e0 <strlen>
+  8021f7:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8021fb:	83 c3 01             	add    $0x1,%ebx
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802204:	85 c0                	test   %eax,%eax
+  802206:	75 e6                	jne    8021ee <spawn+0xfa>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802208:	89 9d c4 fb ff ff    	mov    %ebx,-0x43c(%ebp)
+  80220e:	b8 00 10 40 00       	mov    $0x401000,%eax
+  802213:	29 f0                	sub    %esi,%eax
+  802215:	89 c7                	mov    %eax,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802217:	89 c2                	mov    %eax,%edx
+  802219:	83 e2 fc             	and    $0xfffffffc,%edx
+  80221c:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802223:	29 c2                	sub    %eax,%edx
+  802225:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80222b:	8d 42 f8             	lea    -0x8(%edx),%eax
+  80222e:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802233:	0f 86 6a 05 00 00    	jbe    8027a3 <spawn+0x6af>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802239:	83 ec 04             	sub    $0x4,%esp
+  80223c:	6a 07                	push   $0x7
+  80223e:	68 00 00 40 00       	push   $0x400000
+  802243:	6a 00                	push   $0x0
+  802245:	e8 c9 eb ff ff       	call   800e13 <sys_page_alloc>
+  80224a:	83 c4 10             	add    $0x10,%esp
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	0f 88 53 05 00 00    	js     8027a8 <spawn+0x6b4>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802255:	be 00 00 00 00       	mov    $0x0,%esi
+  80225a:	89 9d c8 fb ff ff    	mov    %ebx,-0x438(%ebp)
+  802260:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802263:	eb 30                	jmp    802295 <spawn+0x1a1>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802265:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80226b:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  802271:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802274:	83 ec 08             	sub    $0x8,%esp
+  802277:	ff 34 b3             	push   (%ebx,%esi,4)
+  80227a:	57                   	push   %edi
+  80227b:	e8 9b e6 ff ff       	call   80091b <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802280:	83 c4 04             	add    $0x4,%esp
+  802283:	ff 34 b3             	push   (%ebx,%esi,4)
+  802286:	e8 55 e6 ff ff       	call   8008e0 <strlen>
+  80228b:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  80228f:	83 c6 01             	add    $0x1,%esi
+  802292:	83 c4 10             	add    $0x10,%esp
+  802295:	39 b5 c8 fb ff ff    	cmp    %esi,-0x438(%ebp)
+  80229b:	7f c8                	jg     802265 <spawn+0x171>
+	}
+	argv_store[argc] = 0;
+  80229d:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  8022a3:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  8022a9:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8022b0:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8022b6:	0f 85 85 00 00 00    	jne    802341 <spawn+0x24d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8022bc:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  8022c2:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  8022c8:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  8022cb:	89 d0                	mov    %edx,%eax
+  8022cd:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  8022d3:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8022d6:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8022db:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8022e1:	83 ec 0c             	sub    $0xc,%esp
+  8022e4:	6a 07                	push   $0x7
+  8022e6:	68 00 d0 bf ee       	push   $0xeebfd000
+  8022eb:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8022f1:	68 00 00 40 00       	push   $0x400000
+  8022f6:	6a 00                	push   $0x0
+  8022f8:	e8 83 eb ff ff       	call   800e80 <sys_page_map>
+  8022fd:	89 c3                	mov    %eax,%ebx
+  8022ff:	83 c4 20             	add    $0x20,%esp
+  802302:	85 c0                	test   %eax,%eax
+  802304:	0f 88 a6 04 00 00    	js     8027b0 <spawn+0x6bc>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80230a:	83 ec 08             	sub    $0x8,%esp
+  80230d:	68 00 00 40 00       	push   $0x400000
+  802312:	6a 00                	push   $0x0
+  802314:	e8 d5 eb ff ff       	call   800eee <sys_page_unmap>
+  802319:	89 c3                	mov    %eax,%ebx
+  80231b:	83 c4 10             	add    $0x10,%esp
+  80231e:	85 c0                	test   %eax,%eax
+  802320:	0f 88 8a 04 00 00    	js     8027b0 <spawn+0x6bc>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802326:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80232c:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802333:	b8 00 00 00 00       	mov    $0x0,%eax
+  802338:	89 df                	mov    %ebx,%edi
+  80233a:	89 c3                	mov    %eax,%ebx
+  80233c:	e9 8d 01 00 00       	jmp    8024ce <spawn+0x3da>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802341:	68 ac 3b 80 00       	push   $0x803bac
+  802346:	68 cf 3a 80 00       	push   $0x803acf
+  80234b:	68 f3 00 00 00       	push   $0xf3
+  802350:	68 15 3b 80 00       	push   $0x803b15
+  802355:	e8 9e de ff ff       	call   8001f8 <_panic>
+	}
+
+	// The pages that come from the file, a chunk at a time: allocate
+	// the chunk at UTEMP, read it in, and move it to the child.
+	batch_init(&b);
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  80235a:	01 fe                	add    %edi,%esi
+  80235c:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+  802362:	8b 85 c0 fb ff ff    	mov    -0x440(%ebp),%eax
+  802368:	39 c6                	cmp    %eax,%esi
+  80236a:	0f 83 18 01 00 00    	jae    802488 <spawn+0x394>
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  802370:	8b 9d b8 fb ff ff    	mov    -0x448(%ebp),%ebx
+  802376:	29 f3                	sub    %esi,%ebx
+  802378:	c1 eb 0c             	shr    $0xc,%ebx
+  80237b:	b8 40 00 00 00       	mov    $0x40,%eax
+  802380:	39 c3                	cmp    %eax,%ebx
+  802382:	0f 47 d8             	cmova  %eax,%ebx
+  802385:	89 df                	mov    %ebx,%edi
+			SEGMENT_CHUNK);
+		batch_alloc(&b, 0, UTEMP, PTE_P|PTE_U|PTE_W, n);
+  802387:	83 ec 0c             	sub    $0xc,%esp
+  80238a:	53                   	push   %ebx
+  80238b:	6a 07                	push   $0x7
+  80238d:	68 00 00 40 00       	push   $0x400000
+  802392:	6a 00                	push   $0x0
+  802394:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80239a:	50                   	push   %eax
+  80239b:	e8 2d 11 00 00       	call   8034cd <batch_alloc>
+		if ((r = batch_flush(&b)) < 0)
+  8023a0:	83 c4 14             	add    $0x14,%esp
+  8023a3:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8023a9:	50                   	push   %eax
+  8023aa:	e8 b9 0f 00 00       	call   803368 <batch_flush>
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	0f 88 9a 03 00 00    	js     802754 <spawn+0x660>
+			return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  8023ba:	83 ec 08             	sub    $0x8,%esp
+  8023bd:	8b 85 bc fb ff ff    	mov    -0x444(%ebp),%eax
+  8023c3:	01 f0                	add    %esi,%eax
+  8023c5:	50                   	push   %eax
+  8023c6:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8023cc:	e8 4b f9 ff ff       	call   801d1c <seek>
+  8023d1:	83 c4 10             	add    $0x10,%esp
+  8023d4:	85 c0                	test   %eax,%eax
+  8023d6:	0f 88 a1 03 00 00    	js     80277d <spawn+0x689>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  8023dc:	c1 e7 0c             	shl    $0xc,%edi
+  8023df:	83 ec 04             	sub    $0x4,%esp
+  8023e2:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  8023e8:	8b 8d d4 fb ff ff    	mov    -0x42c(%ebp),%ecx
+  8023ee:	29 c8                	sub    %ecx,%eax
+  8023f0:	39 f8                	cmp    %edi,%eax
+  8023f2:	0f 47 c7             	cmova  %edi,%eax
+  8023f5:	50                   	push   %eax
+  8023f6:	68 00 00 40 00       	push   $0x400000
+  8023fb:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802401:	e8 2d f8 ff ff       	call   801c33 <readn>
+  802406:	83 c4 10             	add    $0x10,%esp
+  802409:	85 c0                	test   %eax,%eax
+  80240b:	0f 88 70 03 00 00    	js     802781 <spawn+0x68d>
+			return r;
+		batch_map(&b, 0, UTEMP, child, (void*) (va + i), perm, n);
+  802411:	83 ec 04             	sub    $0x4,%esp
+  802414:	53                   	push   %ebx
+  802415:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  80241b:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802421:	8b 95 c4 fb ff ff    	mov    -0x43c(%ebp),%edx
+  802427:	01 d0                	add    %edx,%eax
+  802429:	50                   	push   %eax
+  80242a:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802430:	68 00 00 40 00       	push   $0x400000
+  802435:	6a 00                	push   $0x0
+  802437:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80243d:	50                   	push   %eax
+  80243e:	e8 b5 10 00 00       	call   8034f8 <batch_map>
+		batch_unmap(&b, 0, UTEMP, n);
+  802443:	83 c4 20             	add    $0x20,%esp
+  802446:	53                   	push   %ebx
+  802447:	68 00 00 40 00       	push   $0x400000
+  80244c:	6a 00                	push   $0x0
+  80244e:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802454:	50                   	push   %eax
+  802455:	e8 c8 10 00 00       	call   803522 <batch_unmap>
+		if ((r = batch_flush(&b)) < 0)
+  80245a:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802460:	89 04 24             	mov    %eax,(%esp)
+  802463:	e8 00 0f 00 00       	call   803368 <batch_flush>
+  802468:	83 c4 10             	add    $0x10,%esp
+  80246b:	85 c0                	test   %eax,%eax
+  80246d:	0f 89 e7 fe ff ff    	jns    80235a <spawn+0x266>
+			panic("spawn: sys_page_map data: %e", r);
+  802473:	50                   	push   %eax
+  802474:	68 21 3b 80 00       	push   $0x803b21
+  802479:	68 2b 01 00 00       	push   $0x12b
+  80247e:	68 15 3b 80 00       	push   $0x803b15
+  802483:	e8 70 dd ff ff       	call   8001f8 <_panic>
+	}
+
+	// the blank pages are demand-zero
+	if (i < memsz)
+  802488:	8b 9d ac fb ff ff    	mov    -0x454(%ebp),%ebx
+  80248e:	8b bd a8 fb ff ff    	mov    -0x458(%ebp),%edi
+  802494:	89 f2                	mov    %esi,%edx
+  802496:	8b 85 b0 fb ff ff    	mov    -0x450(%ebp),%eax
+  80249c:	39 c6                	cmp    %eax,%esi
+  80249e:	73 28                	jae    8024c8 <spawn+0x3d4>
+		return sys_region_reserve(child, (void*) (va + i), memsz - i,
+  8024a0:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  8024a6:	29 f0                	sub    %esi,%eax
+  8024a8:	50                   	push   %eax
+  8024a9:	8b 85 c4 fb ff ff    	mov    -0x43c(%ebp),%eax
+  8024af:	01 c2                	add    %eax,%edx
+  8024b1:	52                   	push   %edx
+  8024b2:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8024b8:	e8 63 ef ff ff       	call   801420 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8024bd:	83 c4 10             	add    $0x10,%esp
+  8024c0:	85 c0                	test   %eax,%eax
+  8024c2:	0f 88 bd 02 00 00    	js     802785 <spawn+0x691>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8024c8:	83 c3 01             	add    $0x1,%ebx
+  8024cb:	83 c7 20             	add    $0x20,%edi
+  8024ce:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8024d5:	39 d8                	cmp    %ebx,%eax
+  8024d7:	0f 8e b2 00 00 00    	jle    80258f <spawn+0x49b>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8024dd:	83 3f 01             	cmpl   $0x1,(%edi)
+  8024e0:	75 e6                	jne    8024c8 <spawn+0x3d4>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8024e2:	8b 47 18             	mov    0x18(%edi),%eax
+  8024e5:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8024e8:	83 f8 01             	cmp    $0x1,%eax
+  8024eb:	19 c0                	sbb    %eax,%eax
+  8024ed:	83 e0 fe             	and    $0xfffffffe,%eax
+  8024f0:	83 c0 07             	add    $0x7,%eax
+  8024f3:	89 85 b4 fb ff ff    	mov    %eax,-0x44c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8024f9:	8b 57 04             	mov    0x4(%edi),%edx
+  8024fc:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+  802502:	8b 77 10             	mov    0x10(%edi),%esi
+  802505:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+  80250b:	8b 47 14             	mov    0x14(%edi),%eax
+  80250e:	89 85 b0 fb ff ff    	mov    %eax,-0x450(%ebp)
+  802514:	8b 4f 08             	mov    0x8(%edi),%ecx
+  802517:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+	if ((i = PGOFF(va))) {
+  80251d:	89 c8                	mov    %ecx,%eax
+  80251f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802524:	74 1e                	je     802544 <spawn+0x450>
+		va -= i;
+  802526:	29 c1                	sub    %eax,%ecx
+  802528:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+		memsz += i;
+  80252e:	01 85 b0 fb ff ff    	add    %eax,-0x450(%ebp)
+		filesz += i;
+  802534:	01 c6                	add    %eax,%esi
+  802536:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+		fileoffset -= i;
+  80253c:	29 c2                	sub    %eax,%edx
+  80253e:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+	batch_init(&b);
+  802544:	83 ec 0c             	sub    $0xc,%esp
+  802547:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80254d:	50                   	push   %eax
+  80254e:	e8 f9 0d 00 00       	call   80334c <batch_init>
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  802553:	83 c4 10             	add    $0x10,%esp
+  802556:	be 00 00 00 00       	mov    $0x0,%esi
+  80255b:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  802561:	8b 8d b0 fb ff ff    	mov    -0x450(%ebp),%ecx
+  802567:	39 c8                	cmp    %ecx,%eax
+  802569:	0f 46 c8             	cmovbe %eax,%ecx
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  80256c:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  802572:	89 85 b8 fb ff ff    	mov    %eax,-0x448(%ebp)
+  802578:	89 9d ac fb ff ff    	mov    %ebx,-0x454(%ebp)
+  80257e:	89 bd a8 fb ff ff    	mov    %edi,-0x458(%ebp)
+  802584:	89 8d c0 fb ff ff    	mov    %ecx,-0x440(%ebp)
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  80258a:	e9 cd fd ff ff       	jmp    80235c <spawn+0x268>
+	close(fd);
+  80258f:	83 ec 0c             	sub    $0xc,%esp
+  802592:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802598:	e8 b3 f4 ff ff       	call   801a50 <close>
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	struct Batch b;
+	int i, r;
+	cprintf("copy_shared_pages(%x);\n", child);
+  80259d:	83 c4 08             	add    $0x8,%esp
+  8025a0:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8025a6:	68 3e 3b 80 00       	push   $0x803b3e
+  8025ab:	e8 23 dd ff ff       	call   8002d3 <cprintf>
+	
+	batch_init(&b);
+  8025b0:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8025b6:	89 04 24             	mov    %eax,(%esp)
+  8025b9:	e8 8e 0d 00 00       	call   80334c <batch_init>
+	
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  8025be:	83 c4 10             	add    $0x10,%esp
+  8025c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		// Handle PTE flags
+		assert(uvpt[i] & PTE_U);
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+		
+		// Map page (adjacent pages are mapped with one operation)
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  8025c6:	8d bd dc fb ff ff    	lea    -0x424(%ebp),%edi
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  8025cc:	eb 22                	jmp    8025f0 <spawn+0x4fc>
+			if (uvpd[i / NPTENTRIES] & PTE_SHARE)
+  8025ce:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8025d5:	f6 c6 04             	test   $0x4,%dh
+  8025d8:	0f 85 97 00 00 00    	jne    802675 <spawn+0x581>
+			i = ROUNDUP(i + 1, NPTENTRIES) - 1;
+  8025de:	8d 9e 00 04 00 00    	lea    0x400(%esi),%ebx
+  8025e4:	81 e3 00 fc ff ff    	and    $0xfffffc00,%ebx
+  8025ea:	83 eb 01             	sub    $0x1,%ebx
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  8025ed:	83 c3 01             	add    $0x1,%ebx
+  8025f0:	89 de                	mov    %ebx,%esi
+  8025f2:	81 fb fd eb 0e 00    	cmp    $0xeebfd,%ebx
+  8025f8:	0f 87 bd 00 00 00    	ja     8026bb <spawn+0x5c7>
+		if (! (uvpd[i / NPTENTRIES] & PTE_P))
+  8025fe:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+  802604:	85 db                	test   %ebx,%ebx
+  802606:	0f 49 c3             	cmovns %ebx,%eax
+  802609:	c1 f8 0a             	sar    $0xa,%eax
+  80260c:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802613:	f6 c2 01             	test   $0x1,%dl
+  802616:	74 d5                	je     8025ed <spawn+0x4f9>
+		if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  802618:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80261f:	f6 c2 80             	test   $0x80,%dl
+  802622:	75 aa                	jne    8025ce <spawn+0x4da>
+		if (! (uvpt[i] & PTE_P))
+  802624:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80262b:	a8 01                	test   $0x1,%al
+  80262d:	74 be                	je     8025ed <spawn+0x4f9>
+		if (! (uvpt[i] & PTE_SHARE))
+  80262f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802636:	f6 c4 04             	test   $0x4,%ah
+  802639:	74 b2                	je     8025ed <spawn+0x4f9>
+		assert(uvpt[i] & PTE_U);
+  80263b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802642:	a8 04                	test   $0x4,%al
+  802644:	74 5c                	je     8026a2 <spawn+0x5ae>
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  802646:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  80264d:	89 da                	mov    %ebx,%edx
+  80264f:	c1 e2 0c             	shl    $0xc,%edx
+  802652:	83 ec 04             	sub    $0x4,%esp
+  802655:	6a 01                	push   $0x1
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  802657:	25 07 0e 00 00       	and    $0xe07,%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  80265c:	50                   	push   %eax
+  80265d:	52                   	push   %edx
+  80265e:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802664:	52                   	push   %edx
+  802665:	6a 00                	push   $0x0
+  802667:	57                   	push   %edi
+  802668:	e8 8b 0e 00 00       	call   8034f8 <batch_map>
+  80266d:	83 c4 20             	add    $0x20,%esp
+  802670:	e9 78 ff ff ff       	jmp    8025ed <spawn+0x4f9>
+					  uvpd[i / NPTENTRIES] & PTE_SYSCALL, 1);
+  802675:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+					  (void *) (i * PGSIZE),
+  80267c:	c1 e3 0c             	shl    $0xc,%ebx
+				batch_map(&b, 0, (void *) (i * PGSIZE), child,
+  80267f:	83 ec 04             	sub    $0x4,%esp
+  802682:	6a 01                	push   $0x1
+  802684:	25 07 0e 00 00       	and    $0xe07,%eax
+  802689:	50                   	push   %eax
+  80268a:	53                   	push   %ebx
+  80268b:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802691:	53                   	push   %ebx
+  802692:	6a 00                	push   $0x0
+  802694:	57                   	push   %edi
+  802695:	e8 5e 0e 00 00       	call   8034f8 <batch_map>
+  80269a:	83 c4 20             	add    $0x20,%esp
+  80269d:	e9 3c ff ff ff       	jmp    8025de <spawn+0x4ea>
+		assert(uvpt[i] & PTE_U);
+  8026a2:	68 56 3b 80 00       	push   $0x803b56
+  8026a7:	68 cf 3a 80 00       	push   $0x803acf
+  8026ac:	68 58 01 00 00       	push   $0x158
+  8026b1:	68 15 3b 80 00       	push   $0x803b15
+  8026b6:	e8 3d db ff ff       	call   8001f8 <_panic>
+	}
+	if ((r = batch_flush(&b)) < 0)
+  8026bb:	83 ec 0c             	sub    $0xc,%esp
+  8026be:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8026c4:	50                   	push   %eax
+  8026c5:	e8 9e 0c 00 00       	call   803368 <batch_flush>
+  8026ca:	83 c4 10             	add    $0x10,%esp
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	78 44                	js     802715 <spawn+0x621>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8026d1:	83 ec 08             	sub    $0x8,%esp
+  8026d4:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8026da:	50                   	push   %eax
+  8026db:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8026e1:	e8 de e8 ff ff       	call   800fc4 <sys_env_set_trapframe>
+  8026e6:	83 c4 10             	add    $0x10,%esp
+  8026e9:	85 c0                	test   %eax,%eax
+  8026eb:	78 3d                	js     80272a <spawn+0x636>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8026ed:	83 ec 08             	sub    $0x8,%esp
+  8026f0:	6a 02                	push   $0x2
+  8026f2:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8026f8:	e8 5c e8 ff ff       	call   800f59 <sys_env_set_status>
+  8026fd:	83 c4 10             	add    $0x10,%esp
+  802700:	85 c0                	test   %eax,%eax
+  802702:	78 3b                	js     80273f <spawn+0x64b>
+	return child;
+  802704:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  80270a:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802710:	e9 80 00 00 00       	jmp    802795 <spawn+0x6a1>
+		panic("cannot map page: %e", r);
+  802715:	50                   	push   %eax
+  802716:	68 66 3b 80 00       	push   $0x803b66
+  80271b:	68 5f 01 00 00       	push   $0x15f
+  802720:	68 15 3b 80 00       	push   $0x803b15
+  802725:	e8 ce da ff ff       	call   8001f8 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  80272a:	50                   	push   %eax
+  80272b:	68 7a 3b 80 00       	push   $0x803b7a
+  802730:	68 87 00 00 00       	push   $0x87
+  802735:	68 15 3b 80 00       	push   $0x803b15
+  80273a:	e8 b9 da ff ff       	call   8001f8 <_panic>
+		panic("sys_env_set_status: %e", r);
+  80273f:	50                   	push   %eax
+  802740:	68 94 3b 80 00       	push   $0x803b94
+  802745:	68 8a 00 00 00       	push   $0x8a
+  80274a:	68 15 3b 80 00       	push   $0x803b15
+  80274f:	e8 a4 da ff ff       	call   8001f8 <_panic>
+  802754:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802756:	83 ec 0c             	sub    $0xc,%esp
+  802759:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80275f:	e8 ba e5 ff ff       	call   800d1e <sys_env_destroy>
+	close(fd);
+  802764:	83 c4 04             	add    $0x4,%esp
+  802767:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  80276d:	e8 de f2 ff ff       	call   801a50 <close>
+	return r;
+  802772:	83 c4 10             	add    $0x10,%esp
+  802775:	89 bd d0 fb ff ff    	mov    %edi,-0x430(%ebp)
+  80277b:	eb 18                	jmp    802795 <spawn+0x6a1>
+  80277d:	89 c7                	mov    %eax,%edi
+  80277f:	eb d5                	jmp    802756 <spawn+0x662>
+  802781:	89 c7                	mov    %eax,%edi
+  802783:	eb d1                	jmp    802756 <spawn+0x662>
+  802785:	89 c7                	mov    %eax,%edi
+  802787:	eb cd                	jmp    802756 <spawn+0x662>
+		return r;
+  802789:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  80278f:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+}
+  802795:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+  80279b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279e:	5b                   	pop    %ebx
+  80279f:	5e                   	pop    %esi
+  8027a0:	5f                   	pop    %edi
+  8027a1:	5d                   	pop    %ebp
+  8027a2:	c3                   	ret
+		return -E_NO_MEM;
+  8027a3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8027a8:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  8027ae:	eb e5                	jmp    802795 <spawn+0x6a1>
+	sys_page_unmap(0, UTEMP);
+  8027b0:	83 ec 08             	sub    $0x8,%esp
+  8027b3:	68 00 00 40 00       	push   $0x400000
+  8027b8:	6a 00                	push   $0x0
+  8027ba:	e8 2f e7 ff ff       	call   800eee <sys_page_unmap>
+  8027bf:	83 c4 10             	add    $0x10,%esp
+  8027c2:	89 9d d0 fb ff ff    	mov    %ebx,-0x430(%ebp)
+  8027c8:	eb cb                	jmp    802795 <spawn+0x6a1>
+
+008027ca <spawnl>:
+{
+  8027ca:	55                   	push   %ebp
+  8027cb:	89 e5                	mov    %esp,%ebp
+  8027cd:	56                   	push   %esi
+  8027ce:	53                   	push   %ebx
+	va_start(vl, arg0);
+  8027cf:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8027d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8027d7:	eb 05                	jmp    8027de <spawnl+0x14>
+		argc++;
+  8027d9:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8027dc:	89 ca                	mov    %ecx,%edx
+  8027de:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8027e1:	83 3a 00             	cmpl   $0x0,(%edx)
+  8027e4:	75 f3                	jne    8027d9 <spawnl+0xf>
+	const char *argv[argc+2];
+  8027e6:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  8027ed:	83 e2 f0             	and    $0xfffffff0,%edx
+  8027f0:	29 d4                	sub    %edx,%esp
+  8027f2:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8027f6:	89 da                	mov    %ebx,%edx
+  8027f8:	c1 ea 02             	shr    $0x2,%edx
+  8027fb:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  8027fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802801:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802808:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80280f:	00 
+	va_start(vl, arg0);
+  802810:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802813:	89 c2                	mov    %eax,%edx
+  802815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281a:	eb 0b                	jmp    802827 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80281c:	83 c0 01             	add    $0x1,%eax
+  80281f:	8b 31                	mov    (%ecx),%esi
+  802821:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802824:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802827:	39 d0                	cmp    %edx,%eax
+  802829:	75 f1                	jne    80281c <spawnl+0x52>
+	return spawn(prog, argv);
+  80282b:	83 ec 08             	sub    $0x8,%esp
+  80282e:	53                   	push   %ebx
+  80282f:	ff 75 08             	push   0x8(%ebp)
+  802832:	e8 bd f8 ff ff       	call   8020f4 <spawn>
+}
+  802837:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80283a:	5b                   	pop    %ebx
+  80283b:	5e                   	pop    %esi
+  80283c:	5d                   	pop    %ebp
+  80283d:	c3                   	ret
+
+0080283e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80283e:	55                   	push   %ebp
+  80283f:	89 e5                	mov    %esp,%ebp
+  802841:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802844:	68 d2 3b 80 00       	push   $0x803bd2
+  802849:	ff 75 0c             	push   0xc(%ebp)
+  80284c:	e8 ca e0 ff ff       	call   80091b <strcpy>
+	return 0;
+}
+  802851:	b8 00 00 00 00       	mov    $0x0,%eax
+  802856:	c9                   	leave
+  802857:	c3                   	ret
+
+00802858 <devsock_close>:
+{
+  802858:	55                   	push   %ebp
+  802859:	89 e5                	mov    %esp,%ebp
+  80285b:	53                   	push   %ebx
+  80285c:	83 ec 10             	sub    $0x10,%esp
+  80285f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802862:	53                   	push   %ebx
+  802863:	e8 06 0d 00 00       	call   80356e <pageref>
+  802868:	89 c2                	mov    %eax,%edx
+  80286a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80286d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802872:	83 fa 01             	cmp    $0x1,%edx
+  802875:	74 05                	je     80287c <devsock_close+0x24>
+}
+  802877:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80287a:	c9                   	leave
+  80287b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80287c:	83 ec 0c             	sub    $0xc,%esp
+  80287f:	ff 73 0c             	push   0xc(%ebx)
+  802882:	e8 b7 02 00 00       	call   802b3e <nsipc_close>
+  802887:	83 c4 10             	add    $0x10,%esp
+  80288a:	eb eb                	jmp    802877 <devsock_close+0x1f>
+
+0080288c <devsock_write>:
+{
+  80288c:	55                   	push   %ebp
+  80288d:	89 e5                	mov    %esp,%ebp
+  80288f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802892:	6a 00                	push   $0x0
+  802894:	ff 75 10             	push   0x10(%ebp)
+  802897:	ff 75 0c             	push   0xc(%ebp)
+  80289a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289d:	ff 70 0c             	push   0xc(%eax)
+  8028a0:	e8 79 03 00 00       	call   802c1e <nsipc_send>
+}
+  8028a5:	c9                   	leave
+  8028a6:	c3                   	ret
+
+008028a7 <devsock_read>:
+{
+  8028a7:	55                   	push   %ebp
+  8028a8:	89 e5                	mov    %esp,%ebp
+  8028aa:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8028ad:	6a 00                	push   $0x0
+  8028af:	ff 75 10             	push   0x10(%ebp)
+  8028b2:	ff 75 0c             	push   0xc(%ebp)
+  8028b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b8:	ff 70 0c             	push   0xc(%eax)
+  8028bb:	e8 ef 02 00 00       	call   802baf <nsipc_recv>
+}
+  8028c0:	c9                   	leave
+  8028c1:	c3                   	ret
+
+008028c2 <fd2sockid>:
+{
+  8028c2:	55                   	push   %ebp
+  8028c3:	89 e5                	mov    %esp,%ebp
+  8028c5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8028c8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028cb:	52                   	push   %edx
+  8028cc:	50                   	push   %eax
+  8028cd:	e8 34 f0 ff ff       	call   801906 <fd_lookup>
+  8028d2:	83 c4 10             	add    $0x10,%esp
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	78 10                	js     8028e9 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8028d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028dc:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8028e2:	39 08                	cmp    %ecx,(%eax)
+  8028e4:	75 05                	jne    8028eb <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8028e6:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8028e9:	c9                   	leave
+  8028ea:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028f0:	eb f7                	jmp    8028e9 <fd2sockid+0x27>
+
+008028f2 <alloc_sockfd>:
+{
+  8028f2:	55                   	push   %ebp
+  8028f3:	89 e5                	mov    %esp,%ebp
+  8028f5:	56                   	push   %esi
+  8028f6:	53                   	push   %ebx
+  8028f7:	83 ec 1c             	sub    $0x1c,%esp
+  8028fa:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8028fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028ff:	50                   	push   %eax
+  802900:	e8 ab ef ff ff       	call   8018b0 <fd_alloc>
+  802905:	89 c3                	mov    %eax,%ebx
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	85 c0                	test   %eax,%eax
+  80290c:	78 43                	js     802951 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80290e:	83 ec 04             	sub    $0x4,%esp
+  802911:	68 07 04 00 00       	push   $0x407
+  802916:	ff 75 f4             	push   -0xc(%ebp)
+  802919:	6a 00                	push   $0x0
+  80291b:	e8 f3 e4 ff ff       	call   800e13 <sys_page_alloc>
+  802920:	89 c3                	mov    %eax,%ebx
+  802922:	83 c4 10             	add    $0x10,%esp
+  802925:	85 c0                	test   %eax,%eax
+  802927:	78 28                	js     802951 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802929:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80292c:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802932:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802934:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802937:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80293e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802941:	83 ec 0c             	sub    $0xc,%esp
+  802944:	50                   	push   %eax
+  802945:	e8 3f ef ff ff       	call   801889 <fd2num>
+  80294a:	89 c3                	mov    %eax,%ebx
+  80294c:	83 c4 10             	add    $0x10,%esp
+  80294f:	eb 0c                	jmp    80295d <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802951:	83 ec 0c             	sub    $0xc,%esp
+  802954:	56                   	push   %esi
+  802955:	e8 e4 01 00 00       	call   802b3e <nsipc_close>
+		return r;
+  80295a:	83 c4 10             	add    $0x10,%esp
+}
+  80295d:	89 d8                	mov    %ebx,%eax
+  80295f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802962:	5b                   	pop    %ebx
+  802963:	5e                   	pop    %esi
+  802964:	5d                   	pop    %ebp
+  802965:	c3                   	ret
+
+00802966 <accept>:
+{
+  802966:	55                   	push   %ebp
+  802967:	89 e5                	mov    %esp,%ebp
+  802969:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80296c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296f:	e8 4e ff ff ff       	call   8028c2 <fd2sockid>
+  802974:	85 c0                	test   %eax,%eax
+  802976:	78 1b                	js     802993 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802978:	83 ec 04             	sub    $0x4,%esp
+  80297b:	ff 75 10             	push   0x10(%ebp)
+  80297e:	ff 75 0c             	push   0xc(%ebp)
+  802981:	50                   	push   %eax
+  802982:	e8 0e 01 00 00       	call   802a95 <nsipc_accept>
+  802987:	83 c4 10             	add    $0x10,%esp
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	78 05                	js     802993 <accept+0x2d>
+	return alloc_sockfd(r);
+  80298e:	e8 5f ff ff ff       	call   8028f2 <alloc_sockfd>
+}
+  802993:	c9                   	leave
+  802994:	c3                   	ret
+
+00802995 <bind>:
+{
+  802995:	55                   	push   %ebp
+  802996:	89 e5                	mov    %esp,%ebp
+  802998:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80299b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80299e:	e8 1f ff ff ff       	call   8028c2 <fd2sockid>
+  8029a3:	85 c0                	test   %eax,%eax
+  8029a5:	78 12                	js     8029b9 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8029a7:	83 ec 04             	sub    $0x4,%esp
+  8029aa:	ff 75 10             	push   0x10(%ebp)
+  8029ad:	ff 75 0c             	push   0xc(%ebp)
+  8029b0:	50                   	push   %eax
+  8029b1:	e8 31 01 00 00       	call   802ae7 <nsipc_bind>
+  8029b6:	83 c4 10             	add    $0x10,%esp
+}
+  8029b9:	c9                   	leave
+  8029ba:	c3                   	ret
+
+008029bb <shutdown>:
+{
+  8029bb:	55                   	push   %ebp
+  8029bc:	89 e5                	mov    %esp,%ebp
+  8029be:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c4:	e8 f9 fe ff ff       	call   8028c2 <fd2sockid>
+  8029c9:	85 c0                	test   %eax,%eax
+  8029cb:	78 0f                	js     8029dc <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8029cd:	83 ec 08             	sub    $0x8,%esp
+  8029d0:	ff 75 0c             	push   0xc(%ebp)
+  8029d3:	50                   	push   %eax
+  8029d4:	e8 43 01 00 00       	call   802b1c <nsipc_shutdown>
+  8029d9:	83 c4 10             	add    $0x10,%esp
+}
+  8029dc:	c9                   	leave
+  8029dd:	c3                   	ret
+
+008029de <connect>:
+{
+  8029de:	55                   	push   %ebp
+  8029df:	89 e5                	mov    %esp,%ebp
+  8029e1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029e7:	e8 d6 fe ff ff       	call   8028c2 <fd2sockid>
+  8029ec:	85 c0                	test   %eax,%eax
+  8029ee:	78 12                	js     802a02 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8029f0:	83 ec 04             	sub    $0x4,%esp
+  8029f3:	ff 75 10             	push   0x10(%ebp)
+  8029f6:	ff 75 0c             	push   0xc(%ebp)
+  8029f9:	50                   	push   %eax
+  8029fa:	e8 59 01 00 00       	call   802b58 <nsipc_connect>
+  8029ff:	83 c4 10             	add    $0x10,%esp
+}
+  802a02:	c9                   	leave
+  802a03:	c3                   	ret
+
+00802a04 <listen>:
+{
+  802a04:	55                   	push   %ebp
+  802a05:	89 e5                	mov    %esp,%ebp
+  802a07:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a0d:	e8 b0 fe ff ff       	call   8028c2 <fd2sockid>
+  802a12:	85 c0                	test   %eax,%eax
+  802a14:	78 0f                	js     802a25 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a16:	83 ec 08             	sub    $0x8,%esp
+  802a19:	ff 75 0c             	push   0xc(%ebp)
+  802a1c:	50                   	push   %eax
+  802a1d:	e8 6b 01 00 00       	call   802b8d <nsipc_listen>
+  802a22:	83 c4 10             	add    $0x10,%esp
+}
+  802a25:	c9                   	leave
+  802a26:	c3                   	ret
+
+00802a27 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a27:	55                   	push   %ebp
+  802a28:	89 e5                	mov    %esp,%ebp
+  802a2a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a2d:	ff 75 10             	push   0x10(%ebp)
+  802a30:	ff 75 0c             	push   0xc(%ebp)
+  802a33:	ff 75 08             	push   0x8(%ebp)
+  802a36:	e8 41 02 00 00       	call   802c7c <nsipc_socket>
+  802a3b:	83 c4 10             	add    $0x10,%esp
+  802a3e:	85 c0                	test   %eax,%eax
+  802a40:	78 05                	js     802a47 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a42:	e8 ab fe ff ff       	call   8028f2 <alloc_sockfd>
+}
+  802a47:	c9                   	leave
+  802a48:	c3                   	ret
+
+00802a49 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a49:	55                   	push   %ebp
+  802a4a:	89 e5                	mov    %esp,%ebp
+  802a4c:	53                   	push   %ebx
+  802a4d:	83 ec 04             	sub    $0x4,%esp
+  802a50:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802a52:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802a59:	74 26                	je     802a81 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a5b:	6a 07                	push   $0x7
+  802a5d:	68 00 70 80 00       	push   $0x807000
+  802a62:	53                   	push   %ebx
+  802a63:	ff 35 04 50 80 00    	push   0x805004
+  802a69:	e8 4b 08 00 00       	call   8032b9 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a6e:	83 c4 0c             	add    $0xc,%esp
+  802a71:	6a 00                	push   $0x0
+  802a73:	6a 00                	push   $0x0
+  802a75:	6a 00                	push   $0x0
+  802a77:	e8 25 08 00 00       	call   8032a1 <ipc_recv>
+}
+  802a7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a81:	83 ec 0c             	sub    $0xc,%esp
+  802a84:	6a 02                	push   $0x2
+  802a86:	e8 82 08 00 00       	call   80330d <ipc_find_env>
+  802a8b:	a3 04 50 80 00       	mov    %eax,0x805004
+  802a90:	83 c4 10             	add    $0x10,%esp
+  802a93:	eb c6                	jmp    802a5b <nsipc+0x12>
+
+00802a95 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a95:	55                   	push   %ebp
+  802a96:	89 e5                	mov    %esp,%ebp
+  802a98:	56                   	push   %esi
+  802a99:	53                   	push   %ebx
+  802a9a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802aa5:	8b 06                	mov    (%esi),%eax
+  802aa7:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802aac:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ab1:	e8 93 ff ff ff       	call   802a49 <nsipc>
+  802ab6:	89 c3                	mov    %eax,%ebx
+  802ab8:	85 c0                	test   %eax,%eax
+  802aba:	79 09                	jns    802ac5 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802abc:	89 d8                	mov    %ebx,%eax
+  802abe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ac1:	5b                   	pop    %ebx
+  802ac2:	5e                   	pop    %esi
+  802ac3:	5d                   	pop    %ebp
+  802ac4:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802ac5:	83 ec 04             	sub    $0x4,%esp
+  802ac8:	ff 35 10 70 80 00    	push   0x807010
+  802ace:	68 00 70 80 00       	push   $0x807000
+  802ad3:	ff 75 0c             	push   0xc(%ebp)
+  802ad6:	e8 c6 df ff ff       	call   800aa1 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802adb:	a1 10 70 80 00       	mov    0x807010,%eax
+  802ae0:	89 06                	mov    %eax,(%esi)
+  802ae2:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ae5:	eb d5                	jmp    802abc <nsipc_accept+0x27>
+
+00802ae7 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ae7:	55                   	push   %ebp
+  802ae8:	89 e5                	mov    %esp,%ebp
+  802aea:	53                   	push   %ebx
+  802aeb:	83 ec 08             	sub    $0x8,%esp
+  802aee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802af1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af4:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802af9:	53                   	push   %ebx
+  802afa:	ff 75 0c             	push   0xc(%ebp)
+  802afd:	68 04 70 80 00       	push   $0x807004
+  802b02:	e8 9a df ff ff       	call   800aa1 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b07:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802b0d:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b12:	e8 32 ff ff ff       	call   802a49 <nsipc>
+}
+  802b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b1a:	c9                   	leave
+  802b1b:	c3                   	ret
+
+00802b1c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b1c:	55                   	push   %ebp
+  802b1d:	89 e5                	mov    %esp,%ebp
+  802b1f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b25:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802b2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b2d:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b32:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b37:	e8 0d ff ff ff       	call   802a49 <nsipc>
+}
+  802b3c:	c9                   	leave
+  802b3d:	c3                   	ret
+
+00802b3e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b3e:	55                   	push   %ebp
+  802b3f:	89 e5                	mov    %esp,%ebp
+  802b41:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b47:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802b4c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b51:	e8 f3 fe ff ff       	call   802a49 <nsipc>
+}
+  802b56:	c9                   	leave
+  802b57:	c3                   	ret
+
+00802b58 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b58:	55                   	push   %ebp
+  802b59:	89 e5                	mov    %esp,%ebp
+  802b5b:	53                   	push   %ebx
+  802b5c:	83 ec 08             	sub    $0x8,%esp
+  802b5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b65:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b6a:	53                   	push   %ebx
+  802b6b:	ff 75 0c             	push   0xc(%ebp)
+  802b6e:	68 04 70 80 00       	push   $0x807004
+  802b73:	e8 29 df ff ff       	call   800aa1 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b78:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802b7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b83:	e8 c1 fe ff ff       	call   802a49 <nsipc>
+}
+  802b88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b8b:	c9                   	leave
+  802b8c:	c3                   	ret
+
+00802b8d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b8d:	55                   	push   %ebp
+  802b8e:	89 e5                	mov    %esp,%ebp
+  802b90:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b96:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b9e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802ba3:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ba8:	e8 9c fe ff ff       	call   802a49 <nsipc>
+}
+  802bad:	c9                   	leave
+  802bae:	c3                   	ret
+
+00802baf <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802baf:	55                   	push   %ebp
+  802bb0:	89 e5                	mov    %esp,%ebp
+  802bb2:	56                   	push   %esi
+  802bb3:	53                   	push   %ebx
+  802bb4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802bb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bba:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802bbf:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802bc5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bc8:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802bcd:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bd2:	e8 72 fe ff ff       	call   802a49 <nsipc>
+  802bd7:	89 c3                	mov    %eax,%ebx
+  802bd9:	85 c0                	test   %eax,%eax
+  802bdb:	78 22                	js     802bff <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802bdd:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802be2:	39 c6                	cmp    %eax,%esi
+  802be4:	0f 4e c6             	cmovle %esi,%eax
+  802be7:	39 c3                	cmp    %eax,%ebx
+  802be9:	7f 1d                	jg     802c08 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802beb:	83 ec 04             	sub    $0x4,%esp
+  802bee:	53                   	push   %ebx
+  802bef:	68 00 70 80 00       	push   $0x807000
+  802bf4:	ff 75 0c             	push   0xc(%ebp)
+  802bf7:	e8 a5 de ff ff       	call   800aa1 <memmove>
+  802bfc:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802bff:	89 d8                	mov    %ebx,%eax
+  802c01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c04:	5b                   	pop    %ebx
+  802c05:	5e                   	pop    %esi
+  802c06:	5d                   	pop    %ebp
+  802c07:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c08:	68 de 3b 80 00       	push   $0x803bde
+  802c0d:	68 cf 3a 80 00       	push   $0x803acf
+  802c12:	6a 62                	push   $0x62
+  802c14:	68 f3 3b 80 00       	push   $0x803bf3
+  802c19:	e8 da d5 ff ff       	call   8001f8 <_panic>
+
+00802c1e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c1e:	55                   	push   %ebp
+  802c1f:	89 e5                	mov    %esp,%ebp
+  802c21:	53                   	push   %ebx
+  802c22:	83 ec 04             	sub    $0x4,%esp
+  802c25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c28:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2b:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802c30:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c36:	7f 2e                	jg     802c66 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c38:	83 ec 04             	sub    $0x4,%esp
+  802c3b:	53                   	push   %ebx
+  802c3c:	ff 75 0c             	push   0xc(%ebp)
+  802c3f:	68 0c 70 80 00       	push   $0x80700c
+  802c44:	e8 58 de ff ff       	call   800aa1 <memmove>
+	nsipcbuf.send.req_size = size;
+  802c49:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802c4f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c52:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802c57:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c5c:	e8 e8 fd ff ff       	call   802a49 <nsipc>
+}
+  802c61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c64:	c9                   	leave
+  802c65:	c3                   	ret
+	assert(size < 1600);
+  802c66:	68 ff 3b 80 00       	push   $0x803bff
+  802c6b:	68 cf 3a 80 00       	push   $0x803acf
+  802c70:	6a 6d                	push   $0x6d
+  802c72:	68 f3 3b 80 00       	push   $0x803bf3
+  802c77:	e8 7c d5 ff ff       	call   8001f8 <_panic>
+
+00802c7c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c7c:	55                   	push   %ebp
+  802c7d:	89 e5                	mov    %esp,%ebp
+  802c7f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c85:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802c8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c8d:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c92:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c95:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802c9a:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c9f:	e8 a5 fd ff ff       	call   802a49 <nsipc>
+}
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+
+00802ca6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ca6:	55                   	push   %ebp
+  802ca7:	89 e5                	mov    %esp,%ebp
+  802ca9:	56                   	push   %esi
+  802caa:	53                   	push   %ebx
+  802cab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802cae:	83 ec 0c             	sub    $0xc,%esp
+  802cb1:	ff 75 08             	push   0x8(%ebp)
+  802cb4:	e8 e0 eb ff ff       	call   801899 <fd2data>
+  802cb9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802cbb:	83 c4 08             	add    $0x8,%esp
+  802cbe:	68 0b 3c 80 00       	push   $0x803c0b
+  802cc3:	53                   	push   %ebx
+  802cc4:	e8 52 dc ff ff       	call   80091b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802cc9:	8b 46 04             	mov    0x4(%esi),%eax
+  802ccc:	2b 06                	sub    (%esi),%eax
+  802cce:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802cd4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802cdb:	00 00 00 
+	stat->st_dev = &devpipe;
+  802cde:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802ce5:	40 80 00 
+	return 0;
+}
+  802ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ced:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cf0:	5b                   	pop    %ebx
+  802cf1:	5e                   	pop    %esi
+  802cf2:	5d                   	pop    %ebp
+  802cf3:	c3                   	ret
+
+00802cf4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802cf4:	55                   	push   %ebp
+  802cf5:	89 e5                	mov    %esp,%ebp
+  802cf7:	53                   	push   %ebx
+  802cf8:	83 ec 0c             	sub    $0xc,%esp
+  802cfb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802cfe:	53                   	push   %ebx
+  802cff:	6a 00                	push   $0x0
+  802d01:	e8 e8 e1 ff ff       	call   800eee <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d06:	89 1c 24             	mov    %ebx,(%esp)
+  802d09:	e8 8b eb ff ff       	call   801899 <fd2data>
+  802d0e:	83 c4 08             	add    $0x8,%esp
+  802d11:	50                   	push   %eax
+  802d12:	6a 00                	push   $0x0
+  802d14:	e8 d5 e1 ff ff       	call   800eee <sys_page_unmap>
+}
+  802d19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d1c:	c9                   	leave
+  802d1d:	c3                   	ret
+
+00802d1e <_pipeisclosed>:
+{
+  802d1e:	55                   	push   %ebp
+  802d1f:	89 e5                	mov    %esp,%ebp
+  802d21:	57                   	push   %edi
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	83 ec 1c             	sub    $0x1c,%esp
+  802d27:	89 c7                	mov    %eax,%edi
+  802d29:	89 d6                	mov    %edx,%esi
+  802d2b:	eb 3c                	jmp    802d69 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802d2d:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802d30:	83 ec 0c             	sub    $0xc,%esp
+  802d33:	57                   	push   %edi
+  802d34:	e8 35 08 00 00       	call   80356e <pageref>
+  802d39:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d3c:	89 34 24             	mov    %esi,(%esp)
+  802d3f:	e8 2a 08 00 00       	call   80356e <pageref>
+  802d44:	89 c2                	mov    %eax,%edx
+  802d46:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d48:	05 00 00 00 20       	add    $0x20000000,%eax
+  802d4d:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802d50:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d56:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d5b:	76 31                	jbe    802d8e <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802d5d:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802d60:	39 c3                	cmp    %eax,%ebx
+  802d62:	74 76                	je     802dda <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802d64:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802d67:	74 36                	je     802d9f <_pipeisclosed+0x81>
+  802d69:	89 e0                	mov    %esp,%eax
+  802d6b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d70:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d76:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d7b:	77 b0                	ja     802d2d <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d7d:	c1 e8 10             	shr    $0x10,%eax
+  802d80:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d86:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d8c:	eb 9f                	jmp    802d2d <_pipeisclosed+0xf>
+  802d8e:	c1 e8 10             	shr    $0x10,%eax
+  802d91:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d97:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802d9d:	eb be                	jmp    802d5d <_pipeisclosed+0x3f>
+  802d9f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802da1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802da6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802dac:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802db1:	76 16                	jbe    802dc9 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802db3:	8b 42 58             	mov    0x58(%edx),%eax
+  802db6:	6a 01                	push   $0x1
+  802db8:	50                   	push   %eax
+  802db9:	53                   	push   %ebx
+  802dba:	68 12 3c 80 00       	push   $0x803c12
+  802dbf:	e8 0f d5 ff ff       	call   8002d3 <cprintf>
+  802dc4:	83 c4 10             	add    $0x10,%esp
+  802dc7:	eb a0                	jmp    802d69 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802dc9:	c1 e8 10             	shr    $0x10,%eax
+  802dcc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802dd2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802dd8:	eb d9                	jmp    802db3 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802dda:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802ddd:	0f 94 c0             	sete   %al
+  802de0:	0f b6 c0             	movzbl %al,%eax
+}
+  802de3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de6:	5b                   	pop    %ebx
+  802de7:	5e                   	pop    %esi
+  802de8:	5f                   	pop    %edi
+  802de9:	5d                   	pop    %ebp
+  802dea:	c3                   	ret
+
+00802deb <devpipe_write>:
+{
+  802deb:	55                   	push   %ebp
+  802dec:	89 e5                	mov    %esp,%ebp
+  802dee:	57                   	push   %edi
+  802def:	56                   	push   %esi
+  802df0:	53                   	push   %ebx
+  802df1:	83 ec 28             	sub    $0x28,%esp
+  802df4:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802df7:	56                   	push   %esi
+  802df8:	e8 9c ea ff ff       	call   801899 <fd2data>
+  802dfd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802dff:	83 c4 10             	add    $0x10,%esp
+  802e02:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e07:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802e0a:	75 09                	jne    802e15 <devpipe_write+0x2a>
+	return i;
+  802e0c:	89 f8                	mov    %edi,%eax
+  802e0e:	eb 23                	jmp    802e33 <devpipe_write+0x48>
+			sys_yield();
+  802e10:	e8 b8 df ff ff       	call   800dcd <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802e15:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e18:	8b 0b                	mov    (%ebx),%ecx
+  802e1a:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e1d:	39 d0                	cmp    %edx,%eax
+  802e1f:	72 1a                	jb     802e3b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802e21:	89 da                	mov    %ebx,%edx
+  802e23:	89 f0                	mov    %esi,%eax
+  802e25:	e8 f4 fe ff ff       	call   802d1e <_pipeisclosed>
+  802e2a:	85 c0                	test   %eax,%eax
+  802e2c:	74 e2                	je     802e10 <devpipe_write+0x25>
+				return 0;
+  802e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e36:	5b                   	pop    %ebx
+  802e37:	5e                   	pop    %esi
+  802e38:	5f                   	pop    %edi
+  802e39:	5d                   	pop    %ebp
+  802e3a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e3e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802e42:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802e45:	89 c2                	mov    %eax,%edx
+  802e47:	c1 fa 1f             	sar    $0x1f,%edx
+  802e4a:	89 d1                	mov    %edx,%ecx
+  802e4c:	c1 e9 1b             	shr    $0x1b,%ecx
+  802e4f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e52:	83 e2 1f             	and    $0x1f,%edx
+  802e55:	29 ca                	sub    %ecx,%edx
+  802e57:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802e5b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802e5f:	83 c0 01             	add    $0x1,%eax
+  802e62:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802e65:	83 c7 01             	add    $0x1,%edi
+  802e68:	eb 9d                	jmp    802e07 <devpipe_write+0x1c>
+
+00802e6a <devpipe_read>:
+{
+  802e6a:	55                   	push   %ebp
+  802e6b:	89 e5                	mov    %esp,%ebp
+  802e6d:	57                   	push   %edi
+  802e6e:	56                   	push   %esi
+  802e6f:	53                   	push   %ebx
+  802e70:	83 ec 18             	sub    $0x18,%esp
+  802e73:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802e76:	57                   	push   %edi
+  802e77:	e8 1d ea ff ff       	call   801899 <fd2data>
+  802e7c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802e7e:	83 c4 10             	add    $0x10,%esp
+  802e81:	be 00 00 00 00       	mov    $0x0,%esi
+  802e86:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e89:	75 13                	jne    802e9e <devpipe_read+0x34>
+	return i;
+  802e8b:	89 f0                	mov    %esi,%eax
+  802e8d:	eb 02                	jmp    802e91 <devpipe_read+0x27>
+				return i;
+  802e8f:	89 f0                	mov    %esi,%eax
+}
+  802e91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e94:	5b                   	pop    %ebx
+  802e95:	5e                   	pop    %esi
+  802e96:	5f                   	pop    %edi
+  802e97:	5d                   	pop    %ebp
+  802e98:	c3                   	ret
+			sys_yield();
+  802e99:	e8 2f df ff ff       	call   800dcd <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802e9e:	8b 03                	mov    (%ebx),%eax
+  802ea0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802ea3:	75 18                	jne    802ebd <devpipe_read+0x53>
+			if (i > 0)
+  802ea5:	85 f6                	test   %esi,%esi
+  802ea7:	75 e6                	jne    802e8f <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802ea9:	89 da                	mov    %ebx,%edx
+  802eab:	89 f8                	mov    %edi,%eax
+  802ead:	e8 6c fe ff ff       	call   802d1e <_pipeisclosed>
+  802eb2:	85 c0                	test   %eax,%eax
+  802eb4:	74 e3                	je     802e99 <devpipe_read+0x2f>
+				return 0;
+  802eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebb:	eb d4                	jmp    802e91 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ebd:	99                   	cltd
+  802ebe:	c1 ea 1b             	shr    $0x1b,%edx
+  802ec1:	01 d0                	add    %edx,%eax
+  802ec3:	83 e0 1f             	and    $0x1f,%eax
+  802ec6:	29 d0                	sub    %edx,%eax
+  802ec8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ecd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ed0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802ed3:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802ed6:	83 c6 01             	add    $0x1,%esi
+  802ed9:	eb ab                	jmp    802e86 <devpipe_read+0x1c>
+
+00802edb <pipe>:
+{
+  802edb:	55                   	push   %ebp
+  802edc:	89 e5                	mov    %esp,%ebp
+  802ede:	56                   	push   %esi
+  802edf:	53                   	push   %ebx
+  802ee0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802ee3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ee6:	50                   	push   %eax
+  802ee7:	e8 c4 e9 ff ff       	call   8018b0 <fd_alloc>
+  802eec:	89 c3                	mov    %eax,%ebx
+  802eee:	83 c4 10             	add    $0x10,%esp
+  802ef1:	85 c0                	test   %eax,%eax
+  802ef3:	0f 88 23 01 00 00    	js     80301c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ef9:	83 ec 04             	sub    $0x4,%esp
+  802efc:	68 07 04 00 00       	push   $0x407
+  802f01:	ff 75 f4             	push   -0xc(%ebp)
+  802f04:	6a 00                	push   $0x0
+  802f06:	e8 08 df ff ff       	call   800e13 <sys_page_alloc>
+  802f0b:	89 c3                	mov    %eax,%ebx
+  802f0d:	83 c4 10             	add    $0x10,%esp
+  802f10:	85 c0                	test   %eax,%eax
+  802f12:	0f 88 04 01 00 00    	js     80301c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802f18:	83 ec 0c             	sub    $0xc,%esp
+  802f1b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f1e:	50                   	push   %eax
+  802f1f:	e8 8c e9 ff ff       	call   8018b0 <fd_alloc>
+  802f24:	89 c3                	mov    %eax,%ebx
+  802f26:	83 c4 10             	add    $0x10,%esp
+  802f29:	85 c0                	test   %eax,%eax
+  802f2b:	0f 88 db 00 00 00    	js     80300c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f31:	83 ec 04             	sub    $0x4,%esp
+  802f34:	68 07 04 00 00       	push   $0x407
+  802f39:	ff 75 f0             	push   -0x10(%ebp)
+  802f3c:	6a 00                	push   $0x0
+  802f3e:	e8 d0 de ff ff       	call   800e13 <sys_page_alloc>
+  802f43:	89 c3                	mov    %eax,%ebx
+  802f45:	83 c4 10             	add    $0x10,%esp
+  802f48:	85 c0                	test   %eax,%eax
+  802f4a:	0f 88 bc 00 00 00    	js     80300c <pipe+0x131>
+	va = fd2data(fd0);
+  802f50:	83 ec 0c             	sub    $0xc,%esp
+  802f53:	ff 75 f4             	push   -0xc(%ebp)
+  802f56:	e8 3e e9 ff ff       	call   801899 <fd2data>
+  802f5b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f5d:	83 c4 0c             	add    $0xc,%esp
+  802f60:	68 07 04 00 00       	push   $0x407
+  802f65:	50                   	push   %eax
+  802f66:	6a 00                	push   $0x0
+  802f68:	e8 a6 de ff ff       	call   800e13 <sys_page_alloc>
+  802f6d:	89 c3                	mov    %eax,%ebx
+  802f6f:	83 c4 10             	add    $0x10,%esp
+  802f72:	85 c0                	test   %eax,%eax
+  802f74:	0f 88 82 00 00 00    	js     802ffc <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f7a:	83 ec 0c             	sub    $0xc,%esp
+  802f7d:	ff 75 f0             	push   -0x10(%ebp)
+  802f80:	e8 14 e9 ff ff       	call   801899 <fd2data>
+  802f85:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802f8c:	50                   	push   %eax
+  802f8d:	6a 00                	push   $0x0
+  802f8f:	56                   	push   %esi
+  802f90:	6a 00                	push   $0x0
+  802f92:	e8 e9 de ff ff       	call   800e80 <sys_page_map>
+  802f97:	89 c3                	mov    %eax,%ebx
+  802f99:	83 c4 20             	add    $0x20,%esp
+  802f9c:	85 c0                	test   %eax,%eax
+  802f9e:	78 4e                	js     802fee <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802fa0:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802fa5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802fa8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802faa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802fad:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802fb4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802fb7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802fb9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802fbc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802fc3:	83 ec 0c             	sub    $0xc,%esp
+  802fc6:	ff 75 f4             	push   -0xc(%ebp)
+  802fc9:	e8 bb e8 ff ff       	call   801889 <fd2num>
+  802fce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fd1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802fd3:	83 c4 04             	add    $0x4,%esp
+  802fd6:	ff 75 f0             	push   -0x10(%ebp)
+  802fd9:	e8 ab e8 ff ff       	call   801889 <fd2num>
+  802fde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fe1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802fe4:	83 c4 10             	add    $0x10,%esp
+  802fe7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fec:	eb 2e                	jmp    80301c <pipe+0x141>
+	sys_page_unmap(0, va);
+  802fee:	83 ec 08             	sub    $0x8,%esp
+  802ff1:	56                   	push   %esi
+  802ff2:	6a 00                	push   $0x0
+  802ff4:	e8 f5 de ff ff       	call   800eee <sys_page_unmap>
+  802ff9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802ffc:	83 ec 08             	sub    $0x8,%esp
+  802fff:	ff 75 f0             	push   -0x10(%ebp)
+  803002:	6a 00                	push   $0x0
+  803004:	e8 e5 de ff ff       	call   800eee <sys_page_unmap>
+  803009:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80300c:	83 ec 08             	sub    $0x8,%esp
+  80300f:	ff 75 f4             	push   -0xc(%ebp)
+  803012:	6a 00                	push   $0x0
+  803014:	e8 d5 de ff ff       	call   800eee <sys_page_unmap>
+  803019:	83 c4 10             	add    $0x10,%esp
+}
+  80301c:	89 d8                	mov    %ebx,%eax
+  80301e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803021:	5b                   	pop    %ebx
+  803022:	5e                   	pop    %esi
+  803023:	5d                   	pop    %ebp
+  803024:	c3                   	ret
+
+00803025 <pipeisclosed>:
+{
+  803025:	55                   	push   %ebp
+  803026:	89 e5                	mov    %esp,%ebp
+  803028:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80302b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80302e:	50                   	push   %eax
+  80302f:	ff 75 08             	push   0x8(%ebp)
+  803032:	e8 cf e8 ff ff       	call   801906 <fd_lookup>
+  803037:	83 c4 10             	add    $0x10,%esp
+  80303a:	85 c0                	test   %eax,%eax
+  80303c:	78 18                	js     803056 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80303e:	83 ec 0c             	sub    $0xc,%esp
+  803041:	ff 75 f4             	push   -0xc(%ebp)
+  803044:	e8 50 e8 ff ff       	call   801899 <fd2data>
+  803049:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80304b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80304e:	e8 cb fc ff ff       	call   802d1e <_pipeisclosed>
+  803053:	83 c4 10             	add    $0x10,%esp
+}
+  803056:	c9                   	leave
+  803057:	c3                   	ret
+
+00803058 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305d:	c3                   	ret
+
+0080305e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80305e:	55                   	push   %ebp
+  80305f:	89 e5                	mov    %esp,%ebp
+  803061:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803064:	68 2a 3c 80 00       	push   $0x803c2a
+  803069:	ff 75 0c             	push   0xc(%ebp)
+  80306c:	e8 aa d8 ff ff       	call   80091b <strcpy>
+	return 0;
+}
+  803071:	b8 00 00 00 00       	mov    $0x0,%eax
+  803076:	c9                   	leave
+  803077:	c3                   	ret
+
+00803078 <devcons_write>:
+{
+  803078:	55                   	push   %ebp
+  803079:	89 e5                	mov    %esp,%ebp
+  80307b:	57                   	push   %edi
+  80307c:	56                   	push   %esi
+  80307d:	53                   	push   %ebx
+  80307e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803084:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803089:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80308f:	eb 2e                	jmp    8030bf <devcons_write+0x47>
+		m = n - tot;
+  803091:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803094:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803096:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80309b:	39 c3                	cmp    %eax,%ebx
+  80309d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8030a0:	83 ec 04             	sub    $0x4,%esp
+  8030a3:	53                   	push   %ebx
+  8030a4:	89 f0                	mov    %esi,%eax
+  8030a6:	03 45 0c             	add    0xc(%ebp),%eax
+  8030a9:	50                   	push   %eax
+  8030aa:	57                   	push   %edi
+  8030ab:	e8 f1 d9 ff ff       	call   800aa1 <memmove>
+		sys_cputs(buf, m);
+  8030b0:	83 c4 08             	add    $0x8,%esp
+  8030b3:	53                   	push   %ebx
+  8030b4:	57                   	push   %edi
+  8030b5:	e8 da db ff ff       	call   800c94 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8030ba:	01 de                	add    %ebx,%esi
+  8030bc:	83 c4 10             	add    $0x10,%esp
+  8030bf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030c2:	72 cd                	jb     803091 <devcons_write+0x19>
+}
+  8030c4:	89 f0                	mov    %esi,%eax
+  8030c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c9:	5b                   	pop    %ebx
+  8030ca:	5e                   	pop    %esi
+  8030cb:	5f                   	pop    %edi
+  8030cc:	5d                   	pop    %ebp
+  8030cd:	c3                   	ret
+
+008030ce <devcons_read>:
+{
+  8030ce:	55                   	push   %ebp
+  8030cf:	89 e5                	mov    %esp,%ebp
+  8030d1:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8030d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030dd:	75 07                	jne    8030e6 <devcons_read+0x18>
+  8030df:	eb 1f                	jmp    803100 <devcons_read+0x32>
+		sys_yield();
+  8030e1:	e8 e7 dc ff ff       	call   800dcd <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030e6:	e8 ed db ff ff       	call   800cd8 <sys_cgetc>
+  8030eb:	85 c0                	test   %eax,%eax
+  8030ed:	74 f2                	je     8030e1 <devcons_read+0x13>
+	if (c < 0)
+  8030ef:	78 0f                	js     803100 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030f1:	83 f8 04             	cmp    $0x4,%eax
+  8030f4:	74 0c                	je     803102 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030f9:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030fb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803100:	c9                   	leave
+  803101:	c3                   	ret
+		return 0;
+  803102:	b8 00 00 00 00       	mov    $0x0,%eax
+  803107:	eb f7                	jmp    803100 <devcons_read+0x32>
+
+00803109 <cputchar>:
+{
+  803109:	55                   	push   %ebp
+  80310a:	89 e5                	mov    %esp,%ebp
+  80310c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80310f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803112:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803115:	6a 01                	push   $0x1
+  803117:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80311a:	50                   	push   %eax
+  80311b:	e8 74 db ff ff       	call   800c94 <sys_cputs>
+}
+  803120:	83 c4 10             	add    $0x10,%esp
+  803123:	c9                   	leave
+  803124:	c3                   	ret
+
+00803125 <getchar>:
+{
+  803125:	55                   	push   %ebp
+  803126:	89 e5                	mov    %esp,%ebp
+  803128:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80312b:	6a 01                	push   $0x1
+  80312d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803130:	50                   	push   %eax
+  803131:	6a 00                	push   $0x0
+  803133:	e8 54 ea ff ff       	call   801b8c <read>
+	if (r < 0)
+  803138:	83 c4 10             	add    $0x10,%esp
+  80313b:	85 c0                	test   %eax,%eax
+  80313d:	78 06                	js     803145 <getchar+0x20>
+	if (r < 1)
+  80313f:	74 06                	je     803147 <getchar+0x22>
+	return c;
+  803141:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803145:	c9                   	leave
+  803146:	c3                   	ret
+		return -E_EOF;
+  803147:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80314c:	eb f7                	jmp    803145 <getchar+0x20>
+
+0080314e <iscons>:
+{
+  80314e:	55                   	push   %ebp
+  80314f:	89 e5                	mov    %esp,%ebp
+  803151:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803154:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803157:	50                   	push   %eax
+  803158:	ff 75 08             	push   0x8(%ebp)
+  80315b:	e8 a6 e7 ff ff       	call   801906 <fd_lookup>
+  803160:	83 c4 10             	add    $0x10,%esp
+  803163:	85 c0                	test   %eax,%eax
+  803165:	78 11                	js     803178 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803167:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80316a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803170:	39 10                	cmp    %edx,(%eax)
+  803172:	0f 94 c0             	sete   %al
+  803175:	0f b6 c0             	movzbl %al,%eax
+}
+  803178:	c9                   	leave
+  803179:	c3                   	ret
+
+0080317a <opencons>:
+{
+  80317a:	55                   	push   %ebp
+  80317b:	89 e5                	mov    %esp,%ebp
+  80317d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803180:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803183:	50                   	push   %eax
+  803184:	e8 27 e7 ff ff       	call   8018b0 <fd_alloc>
+  803189:	83 c4 10             	add    $0x10,%esp
+  80318c:	85 c0                	test   %eax,%eax
+  80318e:	78 3a                	js     8031ca <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803190:	83 ec 04             	sub    $0x4,%esp
+  803193:	68 07 04 00 00       	push   $0x407
+  803198:	ff 75 f4             	push   -0xc(%ebp)
+  80319b:	6a 00                	push   $0x0
+  80319d:	e8 71 dc ff ff       	call   800e13 <sys_page_alloc>
+  8031a2:	83 c4 10             	add    $0x10,%esp
+  8031a5:	85 c0                	test   %eax,%eax
+  8031a7:	78 21                	js     8031ca <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8031a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031ac:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8031b2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8031b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031b7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8031be:	83 ec 0c             	sub    $0xc,%esp
+  8031c1:	50                   	push   %eax
+  8031c2:	e8 c2 e6 ff ff       	call   801889 <fd2num>
+  8031c7:	83 c4 10             	add    $0x10,%esp
+}
+  8031ca:	c9                   	leave
+  8031cb:	c3                   	ret
+
+008031cc <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  8031cc:	55                   	push   %ebp
+  8031cd:	89 e5                	mov    %esp,%ebp
+  8031cf:	56                   	push   %esi
+  8031d0:	53                   	push   %ebx
+  8031d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8031e1:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8031e4:	83 ec 08             	sub    $0x8,%esp
+  8031e7:	ff 75 14             	push   0x14(%ebp)
+  8031ea:	50                   	push   %eax
+  8031eb:	e8 34 e0 ff ff       	call   801224 <sys_ipc_recv_until>
+  8031f0:	83 c4 10             	add    $0x10,%esp
+  8031f3:	85 c0                	test   %eax,%eax
+  8031f5:	78 61                	js     803258 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8031f7:	85 f6                	test   %esi,%esi
+  8031f9:	74 1c                	je     803217 <ipc_recv_until+0x4b>
+  8031fb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8031fd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803202:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803208:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80320d:	76 5f                	jbe    80326e <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  80320f:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803215:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803217:	85 db                	test   %ebx,%ebx
+  803219:	74 1c                	je     803237 <ipc_recv_until+0x6b>
+  80321b:	89 e0                	mov    %esp,%eax
+  80321d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803222:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803228:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80322d:	76 50                	jbe    80327f <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80322f:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803235:	89 03                	mov    %eax,(%ebx)
+  803237:	89 e0                	mov    %esp,%eax
+  803239:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80323e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803244:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803249:	76 45                	jbe    803290 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  80324b:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  803251:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803254:	5b                   	pop    %ebx
+  803255:	5e                   	pop    %esi
+  803256:	5d                   	pop    %ebp
+  803257:	c3                   	ret
+		if (from_env_store)
+  803258:	85 f6                	test   %esi,%esi
+  80325a:	74 06                	je     803262 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  80325c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  803262:	85 db                	test   %ebx,%ebx
+  803264:	74 eb                	je     803251 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803266:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80326c:	eb e3                	jmp    803251 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80326e:	c1 e8 10             	shr    $0x10,%eax
+  803271:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803277:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80327d:	eb 90                	jmp    80320f <ipc_recv_until+0x43>
+  80327f:	c1 e8 10             	shr    $0x10,%eax
+  803282:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803288:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80328e:	eb 9f                	jmp    80322f <ipc_recv_until+0x63>
+  803290:	c1 e8 10             	shr    $0x10,%eax
+  803293:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803299:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80329f:	eb aa                	jmp    80324b <ipc_recv_until+0x7f>
+
+008032a1 <ipc_recv>:
+{
+  8032a1:	55                   	push   %ebp
+  8032a2:	89 e5                	mov    %esp,%ebp
+  8032a4:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8032a7:	6a 00                	push   $0x0
+  8032a9:	ff 75 10             	push   0x10(%ebp)
+  8032ac:	ff 75 0c             	push   0xc(%ebp)
+  8032af:	ff 75 08             	push   0x8(%ebp)
+  8032b2:	e8 15 ff ff ff       	call   8031cc <ipc_recv_until>
+}
+  8032b7:	c9                   	leave
+  8032b8:	c3                   	ret
+
+008032b9 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8032b9:	55                   	push   %ebp
+  8032ba:	89 e5                	mov    %esp,%ebp
+  8032bc:	57                   	push   %edi
+  8032bd:	56                   	push   %esi
+  8032be:	53                   	push   %ebx
+  8032bf:	83 ec 0c             	sub    $0xc,%esp
+  8032c2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8032cb:	85 db                	test   %ebx,%ebx
+  8032cd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032d2:	0f 44 d8             	cmove  %eax,%ebx
+  8032d5:	eb 05                	jmp    8032dc <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8032d7:	e8 f1 da ff ff       	call   800dcd <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8032dc:	ff 75 14             	push   0x14(%ebp)
+  8032df:	53                   	push   %ebx
+  8032e0:	56                   	push   %esi
+  8032e1:	57                   	push   %edi
+  8032e2:	e8 89 de ff ff       	call   801170 <sys_ipc_try_send>
+  8032e7:	83 c4 10             	add    $0x10,%esp
+  8032ea:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032ed:	74 e8                	je     8032d7 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	78 08                	js     8032fb <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8032f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032f6:	5b                   	pop    %ebx
+  8032f7:	5e                   	pop    %esi
+  8032f8:	5f                   	pop    %edi
+  8032f9:	5d                   	pop    %ebp
+  8032fa:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8032fb:	50                   	push   %eax
+  8032fc:	68 36 3c 80 00       	push   $0x803c36
+  803301:	6a 4f                	push   $0x4f
+  803303:	68 49 3c 80 00       	push   $0x803c49
+  803308:	e8 eb ce ff ff       	call   8001f8 <_panic>
+
+0080330d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80330d:	55                   	push   %ebp
+  80330e:	89 e5                	mov    %esp,%ebp
+  803310:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803313:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803318:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80331e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803324:	8b 52 50             	mov    0x50(%edx),%edx
+  803327:	39 ca                	cmp    %ecx,%edx
+  803329:	74 11                	je     80333c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80332b:	83 c0 01             	add    $0x1,%eax
+  80332e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803333:	75 e3                	jne    803318 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333a:	eb 0e                	jmp    80334a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80333c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803342:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803347:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80334a:	5d                   	pop    %ebp
+  80334b:	c3                   	ret
+
+0080334c <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  80334c:	55                   	push   %ebp
+  80334d:	89 e5                	mov    %esp,%ebp
+  80334f:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  803352:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  803359:	00 00 00 
+	b->b_error = 0;
+  80335c:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  803363:	00 00 00 
+}
+  803366:	5d                   	pop    %ebp
+  803367:	c3                   	ret
+
+00803368 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  803368:	55                   	push   %ebp
+  803369:	89 e5                	mov    %esp,%ebp
+  80336b:	53                   	push   %ebx
+  80336c:	83 ec 04             	sub    $0x4,%esp
+  80336f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  803372:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	7e 09                	jle    803385 <batch_flush+0x1d>
+  80337c:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  803383:	74 15                	je     80339a <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  803385:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  80338c:	00 00 00 
+	return b->b_error;
+  80338f:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  803395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803398:	c9                   	leave
+  803399:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  80339a:	83 ec 08             	sub    $0x8,%esp
+  80339d:	50                   	push   %eax
+  80339e:	53                   	push   %ebx
+  80339f:	e8 55 e1 ff ff       	call   8014f9 <sys_batch>
+  8033a4:	83 c4 10             	add    $0x10,%esp
+  8033a7:	85 c0                	test   %eax,%eax
+  8033a9:	79 da                	jns    803385 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  8033ab:	f7 d8                	neg    %eax
+  8033ad:	0f b6 c0             	movzbl %al,%eax
+  8033b0:	f7 d8                	neg    %eax
+  8033b2:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  8033b8:	eb cb                	jmp    803385 <batch_flush+0x1d>
+
+008033ba <batch_reserve>:
+{
+  8033ba:	55                   	push   %ebp
+  8033bb:	89 e5                	mov    %esp,%ebp
+  8033bd:	83 ec 08             	sub    $0x8,%esp
+  8033c0:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  8033c3:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  8033c9:	03 45 0c             	add    0xc(%ebp),%eax
+  8033cc:	83 f8 10             	cmp    $0x10,%eax
+  8033cf:	7f 02                	jg     8033d3 <batch_reserve+0x19>
+}
+  8033d1:	c9                   	leave
+  8033d2:	c3                   	ret
+		batch_flush(b);
+  8033d3:	83 ec 0c             	sub    $0xc,%esp
+  8033d6:	52                   	push   %edx
+  8033d7:	e8 8c ff ff ff       	call   803368 <batch_flush>
+  8033dc:	83 c4 10             	add    $0x10,%esp
+}
+  8033df:	eb f0                	jmp    8033d1 <batch_reserve+0x17>
+
+008033e1 <batch_next>:
+{
+  8033e1:	55                   	push   %ebp
+  8033e2:	89 e5                	mov    %esp,%ebp
+  8033e4:	53                   	push   %ebx
+  8033e5:	83 ec 04             	sub    $0x4,%esp
+  8033e8:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  8033ea:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  8033f1:	74 28                	je     80341b <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  8033f3:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8033f9:	8d 50 01             	lea    0x1(%eax),%edx
+  8033fc:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  803402:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803405:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  803407:	83 ec 04             	sub    $0x4,%esp
+  80340a:	6a 1c                	push   $0x1c
+  80340c:	6a 00                	push   $0x0
+  80340e:	53                   	push   %ebx
+  80340f:	e8 58 d6 ff ff       	call   800a6c <memset>
+}
+  803414:	89 d8                	mov    %ebx,%eax
+  803416:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803419:	c9                   	leave
+  80341a:	c3                   	ret
+		batch_flush(b);
+  80341b:	83 ec 0c             	sub    $0xc,%esp
+  80341e:	50                   	push   %eax
+  80341f:	e8 44 ff ff ff       	call   803368 <batch_flush>
+  803424:	83 c4 10             	add    $0x10,%esp
+  803427:	eb ca                	jmp    8033f3 <batch_next+0x12>
+
+00803429 <batch_page>:
+{
+  803429:	55                   	push   %ebp
+  80342a:	89 e5                	mov    %esp,%ebp
+  80342c:	57                   	push   %edi
+  80342d:	56                   	push   %esi
+  80342e:	53                   	push   %ebx
+  80342f:	83 ec 1c             	sub    $0x1c,%esp
+  803432:	89 d3                	mov    %edx,%ebx
+  803434:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  803436:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  80343c:	85 d2                	test   %edx,%edx
+  80343e:	74 50                	je     803490 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  803440:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  803443:	01 c1                	add    %eax,%ecx
+  803445:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  803448:	75 46                	jne    803490 <batch_page+0x67>
+  80344a:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  80344d:	75 41                	jne    803490 <batch_page+0x67>
+  80344f:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  803452:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  803455:	75 39                	jne    803490 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  803457:	83 ea 01             	sub    $0x1,%edx
+  80345a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  80345d:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  803460:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  803464:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  803467:	75 27                	jne    803490 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  803469:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  80346c:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  803470:	89 fa                	mov    %edi,%edx
+  803472:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  803475:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  803478:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  80347b:	39 55 08             	cmp    %edx,0x8(%ebp)
+  80347e:	75 10                	jne    803490 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  803480:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  803484:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803487:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  80348b:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80348e:	74 2a                	je     8034ba <batch_page+0x91>
+	op = batch_next(b);
+  803490:	e8 4c ff ff ff       	call   8033e1 <batch_next>
+	op->bo_op = opcode;
+  803495:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  803497:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  80349a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80349d:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  8034a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034a3:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  8034a6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8034a9:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  8034ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8034af:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  8034b2:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8034b5:	89 78 14             	mov    %edi,0x14(%eax)
+  8034b8:	eb 0b                	jmp    8034c5 <batch_page+0x9c>
+		op->bo_npages += npages;
+  8034ba:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  8034be:	03 7d 18             	add    0x18(%ebp),%edi
+  8034c1:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  8034c5:	83 c4 1c             	add    $0x1c,%esp
+  8034c8:	5b                   	pop    %ebx
+  8034c9:	5e                   	pop    %esi
+  8034ca:	5f                   	pop    %edi
+  8034cb:	5d                   	pop    %ebp
+  8034cc:	c3                   	ret
+
+008034cd <batch_alloc>:
+{
+  8034cd:	55                   	push   %ebp
+  8034ce:	89 e5                	mov    %esp,%ebp
+  8034d0:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  8034d3:	ff 75 18             	push   0x18(%ebp)
+  8034d6:	ff 75 14             	push   0x14(%ebp)
+  8034d9:	ff 75 10             	push   0x10(%ebp)
+  8034dc:	ff 75 0c             	push   0xc(%ebp)
+  8034df:	6a 00                	push   $0x0
+  8034e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ee:	e8 36 ff ff ff       	call   803429 <batch_page>
+}
+  8034f3:	83 c4 20             	add    $0x20,%esp
+  8034f6:	c9                   	leave
+  8034f7:	c3                   	ret
+
+008034f8 <batch_map>:
+{
+  8034f8:	55                   	push   %ebp
+  8034f9:	89 e5                	mov    %esp,%ebp
+  8034fb:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  8034fe:	ff 75 20             	push   0x20(%ebp)
+  803501:	ff 75 1c             	push   0x1c(%ebp)
+  803504:	ff 75 18             	push   0x18(%ebp)
+  803507:	ff 75 14             	push   0x14(%ebp)
+  80350a:	ff 75 10             	push   0x10(%ebp)
+  80350d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803510:	ba 01 00 00 00       	mov    $0x1,%edx
+  803515:	8b 45 08             	mov    0x8(%ebp),%eax
+  803518:	e8 0c ff ff ff       	call   803429 <batch_page>
+}
+  80351d:	83 c4 20             	add    $0x20,%esp
+  803520:	c9                   	leave
+  803521:	c3                   	ret
+
+00803522 <batch_unmap>:
+{
+  803522:	55                   	push   %ebp
+  803523:	89 e5                	mov    %esp,%ebp
+  803525:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  803528:	ff 75 14             	push   0x14(%ebp)
+  80352b:	6a 00                	push   $0x0
+  80352d:	ff 75 10             	push   0x10(%ebp)
+  803530:	ff 75 0c             	push   0xc(%ebp)
+  803533:	6a 00                	push   $0x0
+  803535:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80353a:	ba 02 00 00 00       	mov    $0x2,%edx
+  80353f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803542:	e8 e2 fe ff ff       	call   803429 <batch_page>
+}
+  803547:	83 c4 20             	add    $0x20,%esp
+  80354a:	c9                   	leave
+  80354b:	c3                   	ret
+
+0080354c <batch_set_status>:
+{
+  80354c:	55                   	push   %ebp
+  80354d:	89 e5                	mov    %esp,%ebp
+  80354f:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  803552:	8b 45 08             	mov    0x8(%ebp),%eax
+  803555:	e8 87 fe ff ff       	call   8033e1 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  80355a:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  803560:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803563:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  803566:	8b 55 10             	mov    0x10(%ebp),%edx
+  803569:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  80356c:	c9                   	leave
+  80356d:	c3                   	ret
+
+0080356e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80356e:	55                   	push   %ebp
+  80356f:	89 e5                	mov    %esp,%ebp
+  803571:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803574:	89 c2                	mov    %eax,%edx
+  803576:	c1 ea 16             	shr    $0x16,%edx
+  803579:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803580:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803585:	f6 c1 01             	test   $0x1,%cl
+  803588:	74 1a                	je     8035a4 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  80358a:	c1 e8 0c             	shr    $0xc,%eax
+  80358d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803594:	a8 01                	test   $0x1,%al
+  803596:	74 0c                	je     8035a4 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803598:	c1 e8 0c             	shr    $0xc,%eax
+  80359b:	c1 e0 04             	shl    $0x4,%eax
+  80359e:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8035a4:	89 d0                	mov    %edx,%eax
+  8035a6:	5d                   	pop    %ebp
+  8035a7:	c3                   	ret
@@ -0,0 +1,7391 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5f 03 00 00       	call   800390 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int i, tot = 0;
+  80003e:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = 0; i < n; i++)
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	eb 0c                	jmp    800056 <sum+0x23>
+		tot ^= i * s[i];
+  80004a:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  80004e:	0f af d0             	imul   %eax,%edx
+  800051:	31 d1                	xor    %edx,%ecx
+	for (i = 0; i < n; i++)
+  800053:	83 c0 01             	add    $0x1,%eax
+  800056:	39 d8                	cmp    %ebx,%eax
+  800058:	7c f0                	jl     80004a <sum+0x17>
+	return tot;
+}
+  80005a:	89 c8                	mov    %ecx,%eax
+  80005c:	5b                   	pop    %ebx
+  80005d:	5e                   	pop    %esi
+  80005e:	5d                   	pop    %ebp
+  80005f:	c3                   	ret
+
+00800060 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800060:	55                   	push   %ebp
+  800061:	89 e5                	mov    %esp,%ebp
+  800063:	57                   	push   %edi
+  800064:	56                   	push   %esi
+  800065:	53                   	push   %ebx
+  800066:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80006c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	int i, r, x, want;
+	char args[256];
+
+	cprintf("init: running\n");
+  80006f:	68 00 37 80 00       	push   $0x803700
+  800074:	e8 b6 04 00 00       	call   80052f <cprintf>
+
+	want = 0xf989e;
+	if ((x = sum((char*)&data, sizeof data)) != want)
+  800079:	83 c4 08             	add    $0x8,%esp
+  80007c:	68 70 17 00 00       	push   $0x1770
+  800081:	68 00 40 80 00       	push   $0x804000
+  800086:	e8 a8 ff ff ff       	call   800033 <sum>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  800093:	74 64                	je     8000f9 <umain+0x99>
+		cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  800095:	83 ec 04             	sub    $0x4,%esp
+  800098:	68 9e 98 0f 00       	push   $0xf989e
+  80009d:	50                   	push   %eax
+  80009e:	68 c8 37 80 00       	push   $0x8037c8
+  8000a3:	e8 87 04 00 00       	call   80052f <cprintf>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+			x, want);
+	else
+		cprintf("init: data seems okay\n");
+	if ((x = sum(bss, sizeof bss)) != 0)
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	68 70 17 00 00       	push   $0x1770
+  8000b3:	68 20 60 80 00       	push   $0x806020
+  8000b8:	e8 76 ff ff ff       	call   800033 <sum>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	74 47                	je     80010b <umain+0xab>
+		cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	50                   	push   %eax
+  8000c8:	68 04 38 80 00       	push   $0x803804
+  8000cd:	e8 5d 04 00 00       	call   80052f <cprintf>
+  8000d2:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("init: bss seems okay\n");
+
+	// output in one syscall per line to avoid output interleaving 
+	strcat(args, "init: args:");
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+  8000d8:	68 3c 37 80 00       	push   $0x80373c
+  8000dd:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000e3:	50                   	push   %eax
+  8000e4:	e8 b2 0a 00 00       	call   800b9b <strcat>
+	for (i = 0; i < argc; i++) {
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		strcat(args, " '");
+  8000f1:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+	for (i = 0; i < argc; i++) {
+  8000f7:	eb 55                	jmp    80014e <umain+0xee>
+		cprintf("init: data seems okay\n");
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	68 0f 37 80 00       	push   $0x80370f
+  800101:	e8 29 04 00 00       	call   80052f <cprintf>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	eb a0                	jmp    8000ab <umain+0x4b>
+		cprintf("init: bss seems okay\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 26 37 80 00       	push   $0x803726
+  800113:	e8 17 04 00 00       	call   80052f <cprintf>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	eb b8                	jmp    8000d5 <umain+0x75>
+		strcat(args, " '");
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	68 48 37 80 00       	push   $0x803748
+  800125:	56                   	push   %esi
+  800126:	e8 70 0a 00 00       	call   800b9b <strcat>
+		strcat(args, argv[i]);
+  80012b:	83 c4 08             	add    $0x8,%esp
+  80012e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800131:	ff 34 98             	push   (%eax,%ebx,4)
+  800134:	56                   	push   %esi
+  800135:	e8 61 0a 00 00       	call   800b9b <strcat>
+		strcat(args, "'");
+  80013a:	83 c4 08             	add    $0x8,%esp
+  80013d:	68 49 37 80 00       	push   $0x803749
+  800142:	56                   	push   %esi
+  800143:	e8 53 0a 00 00       	call   800b9b <strcat>
+	for (i = 0; i < argc; i++) {
+  800148:	83 c3 01             	add    $0x1,%ebx
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	39 fb                	cmp    %edi,%ebx
+  800150:	7c cb                	jl     80011d <umain+0xbd>
+	}
+	cprintf("%s\n", args);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80015b:	50                   	push   %eax
+  80015c:	68 4b 37 80 00       	push   $0x80374b
+  800161:	e8 c9 03 00 00       	call   80052f <cprintf>
+
+	cprintf("init: running sh\n");
+  800166:	c7 04 24 4f 37 80 00 	movl   $0x80374f,(%esp)
+  80016d:	e8 bd 03 00 00       	call   80052f <cprintf>
+
+	// being run directly from kernel, so no file descriptors open yet
+	close(0);
+  800172:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800179:	e8 2e 1b 00 00       	call   801cac <close>
+	if ((r = opencons()) < 0)
+  80017e:	e8 bb 01 00 00       	call   80033e <opencons>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 14                	js     80019e <umain+0x13e>
+		panic("opencons: %e", r);
+	if (r != 0)
+  80018a:	74 24                	je     8001b0 <umain+0x150>
+		panic("first opencons used fd %d", r);
+  80018c:	50                   	push   %eax
+  80018d:	68 7a 37 80 00       	push   $0x80377a
+  800192:	6a 39                	push   $0x39
+  800194:	68 6e 37 80 00       	push   $0x80376e
+  800199:	e8 b6 02 00 00       	call   800454 <_panic>
+		panic("opencons: %e", r);
+  80019e:	50                   	push   %eax
+  80019f:	68 61 37 80 00       	push   $0x803761
+  8001a4:	6a 37                	push   $0x37
+  8001a6:	68 6e 37 80 00       	push   $0x80376e
+  8001ab:	e8 a4 02 00 00       	call   800454 <_panic>
+	if ((r = dup(0, 1)) < 0)
+  8001b0:	83 ec 08             	sub    $0x8,%esp
+  8001b3:	6a 01                	push   $0x1
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 42 1b 00 00       	call   801cfe <dup>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	79 23                	jns    8001e6 <umain+0x186>
+		panic("dup: %e", r);
+  8001c3:	50                   	push   %eax
+  8001c4:	68 94 37 80 00       	push   $0x803794
+  8001c9:	6a 3b                	push   $0x3b
+  8001cb:	68 6e 37 80 00       	push   $0x80376e
+  8001d0:	e8 7f 02 00 00       	call   800454 <_panic>
+	while (1) {
+		cprintf("init: starting sh\n");
+		r = spawnl("/sh", "sh", (char*)0);
+		if (r < 0) {
+			cprintf("init: spawn sh: %e\n", r);
+  8001d5:	83 ec 08             	sub    $0x8,%esp
+  8001d8:	50                   	push   %eax
+  8001d9:	68 b3 37 80 00       	push   $0x8037b3
+  8001de:	e8 4c 03 00 00       	call   80052f <cprintf>
+			continue;
+  8001e3:	83 c4 10             	add    $0x10,%esp
+		cprintf("init: starting sh\n");
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	68 9c 37 80 00       	push   $0x80379c
+  8001ee:	e8 3c 03 00 00       	call   80052f <cprintf>
+		r = spawnl("/sh", "sh", (char*)0);
+  8001f3:	83 c4 0c             	add    $0xc,%esp
+  8001f6:	6a 00                	push   $0x0
+  8001f8:	68 b0 37 80 00       	push   $0x8037b0
+  8001fd:	68 af 37 80 00       	push   $0x8037af
+  800202:	e8 1f 28 00 00       	call   802a26 <spawnl>
+		if (r < 0) {
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 c7                	js     8001d5 <umain+0x175>
+		}
+		wait(r);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	50                   	push   %eax
+  800212:	e8 9d 30 00 00       	call   8032b4 <wait>
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	eb ca                	jmp    8001e6 <umain+0x186>
+
+0080021c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80021c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800221:	c3                   	ret
+
+00800222 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  800228:	68 33 38 80 00       	push   $0x803833
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	e8 42 09 00 00       	call   800b77 <strcpy>
+	return 0;
+}
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <devcons_write>:
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800248:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80024d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800253:	eb 2e                	jmp    800283 <devcons_write+0x47>
+		m = n - tot;
+  800255:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800258:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80025a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80025f:	39 c3                	cmp    %eax,%ebx
+  800261:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800264:	83 ec 04             	sub    $0x4,%esp
+  800267:	53                   	push   %ebx
+  800268:	89 f0                	mov    %esi,%eax
+  80026a:	03 45 0c             	add    0xc(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	57                   	push   %edi
+  80026f:	e8 89 0a 00 00       	call   800cfd <memmove>
+		sys_cputs(buf, m);
+  800274:	83 c4 08             	add    $0x8,%esp
+  800277:	53                   	push   %ebx
+  800278:	57                   	push   %edi
+  800279:	e8 72 0c 00 00       	call   800ef0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80027e:	01 de                	add    %ebx,%esi
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800286:	72 cd                	jb     800255 <devcons_write+0x19>
+}
+  800288:	89 f0                	mov    %esi,%eax
+  80028a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <devcons_read>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002a1:	75 07                	jne    8002aa <devcons_read+0x18>
+  8002a3:	eb 1f                	jmp    8002c4 <devcons_read+0x32>
+		sys_yield();
+  8002a5:	e8 7f 0d 00 00       	call   801029 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8002aa:	e8 85 0c 00 00       	call   800f34 <sys_cgetc>
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	74 f2                	je     8002a5 <devcons_read+0x13>
+	if (c < 0)
+  8002b3:	78 0f                	js     8002c4 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8002b5:	83 f8 04             	cmp    $0x4,%eax
+  8002b8:	74 0c                	je     8002c6 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8002ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bd:	88 02                	mov    %al,(%edx)
+	return 1;
+  8002bf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+		return 0;
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	eb f7                	jmp    8002c4 <devcons_read+0x32>
+
+008002cd <cputchar>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8002d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8002d9:	6a 01                	push   $0x1
+  8002db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	e8 0c 0c 00 00       	call   800ef0 <sys_cputs>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <getchar>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8002ef:	6a 01                	push   $0x1
+  8002f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	6a 00                	push   $0x0
+  8002f7:	e8 ec 1a 00 00       	call   801de8 <read>
+	if (r < 0)
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	78 06                	js     800309 <getchar+0x20>
+	if (r < 1)
+  800303:	74 06                	je     80030b <getchar+0x22>
+	return c;
+  800305:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+		return -E_EOF;
+  80030b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800310:	eb f7                	jmp    800309 <getchar+0x20>
+
+00800312 <iscons>:
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800318:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 3e 18 00 00       	call   801b62 <fd_lookup>
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	85 c0                	test   %eax,%eax
+  800329:	78 11                	js     80033c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80032b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80032e:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800334:	39 10                	cmp    %edx,(%eax)
+  800336:	0f 94 c0             	sete   %al
+  800339:	0f b6 c0             	movzbl %al,%eax
+}
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+0080033e <opencons>:
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800344:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800347:	50                   	push   %eax
+  800348:	e8 bf 17 00 00       	call   801b0c <fd_alloc>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	85 c0                	test   %eax,%eax
+  800352:	78 3a                	js     80038e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800354:	83 ec 04             	sub    $0x4,%esp
+  800357:	68 07 04 00 00       	push   $0x407
+  80035c:	ff 75 f4             	push   -0xc(%ebp)
+  80035f:	6a 00                	push   $0x0
+  800361:	e8 09 0d 00 00       	call   80106f <sys_page_alloc>
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	78 21                	js     80038e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80036d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800370:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800376:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80037b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	e8 5a 17 00 00       	call   801ae5 <fd2num>
+  80038b:	83 c4 10             	add    $0x10,%esp
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	57                   	push   %edi
+  800394:	56                   	push   %esi
+  800395:	53                   	push   %ebx
+  800396:	83 ec 0c             	sub    $0xc,%esp
+  800399:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80039c:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80039f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8003a4:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8003a6:	c1 ea 0b             	shr    $0xb,%edx
+  8003a9:	83 f2 01             	xor    $0x1,%edx
+  8003ac:	83 e2 01             	and    $0x1,%edx
+  8003af:	88 15 94 77 80 00    	mov    %dl,0x807794
+
+	mainenv = NULL;
+  8003b5:	c7 05 90 77 80 00 00 	movl   $0x0,0x807790
+  8003bc:	00 00 00 
+	envid = sys_getenvid();
+  8003bf:	e8 1f 0c 00 00       	call   800fe3 <sys_getenvid>
+  8003c4:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8003c6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8003cb:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8003d1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8003d7:	8b 52 48             	mov    0x48(%edx),%edx
+  8003da:	39 ca                	cmp    %ecx,%edx
+  8003dc:	74 27                	je     800405 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8003de:	83 c0 01             	add    $0x1,%eax
+  8003e1:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8003e6:	75 e3                	jne    8003cb <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8003e8:	83 3d 90 77 80 00 00 	cmpl   $0x0,0x807790
+  8003ef:	75 24                	jne    800415 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8003f1:	83 ec 04             	sub    $0x4,%esp
+  8003f4:	68 40 38 80 00       	push   $0x803840
+  8003f9:	6a 23                	push   $0x23
+  8003fb:	68 63 38 80 00       	push   $0x803863
+  800400:	e8 4f 00 00 00       	call   800454 <_panic>
+			mainenv = &envs[i];
+  800405:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80040b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800410:	a3 90 77 80 00       	mov    %eax,0x807790
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800415:	85 ff                	test   %edi,%edi
+  800417:	7e 07                	jle    800420 <libmain+0x90>
+		binaryname = argv[0];
+  800419:	8b 06                	mov    (%esi),%eax
+  80041b:	a3 8c 57 80 00       	mov    %eax,0x80578c
+
+	// call user main routine
+	umain(argc, argv);
+  800420:	83 ec 08             	sub    $0x8,%esp
+  800423:	56                   	push   %esi
+  800424:	57                   	push   %edi
+  800425:	e8 36 fc ff ff       	call   800060 <umain>
+
+	// exit gracefully
+	exit();
+  80042a:	e8 0b 00 00 00       	call   80043a <exit>
+}
+  80042f:	83 c4 10             	add    $0x10,%esp
+  800432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800435:	5b                   	pop    %ebx
+  800436:	5e                   	pop    %esi
+  800437:	5f                   	pop    %edi
+  800438:	5d                   	pop    %ebp
+  800439:	c3                   	ret
+
+0080043a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80043a:	55                   	push   %ebp
+  80043b:	89 e5                	mov    %esp,%ebp
+  80043d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800440:	e8 94 18 00 00       	call   801cd9 <close_all>
+	sys_env_destroy(0);
+  800445:	83 ec 0c             	sub    $0xc,%esp
+  800448:	6a 00                	push   $0x0
+  80044a:	e8 2b 0b 00 00       	call   800f7a <sys_env_destroy>
+}
+  80044f:	83 c4 10             	add    $0x10,%esp
+  800452:	c9                   	leave
+  800453:	c3                   	ret
+
+00800454 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800454:	55                   	push   %ebp
+  800455:	89 e5                	mov    %esp,%ebp
+  800457:	56                   	push   %esi
+  800458:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800459:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80045c:	8b 35 8c 57 80 00    	mov    0x80578c,%esi
+  800462:	e8 7c 0b 00 00       	call   800fe3 <sys_getenvid>
+  800467:	83 ec 0c             	sub    $0xc,%esp
+  80046a:	ff 75 0c             	push   0xc(%ebp)
+  80046d:	ff 75 08             	push   0x8(%ebp)
+  800470:	56                   	push   %esi
+  800471:	50                   	push   %eax
+  800472:	68 7c 38 80 00       	push   $0x80387c
+  800477:	e8 b3 00 00 00       	call   80052f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80047c:	83 c4 18             	add    $0x18,%esp
+  80047f:	53                   	push   %ebx
+  800480:	ff 75 10             	push   0x10(%ebp)
+  800483:	e8 56 00 00 00       	call   8004de <vcprintf>
+	cprintf("\n");
+  800488:	c7 04 24 f4 3c 80 00 	movl   $0x803cf4,(%esp)
+  80048f:	e8 9b 00 00 00       	call   80052f <cprintf>
+  800494:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800497:	cc                   	int3
+	while (1)
+  800498:	eb fd                	jmp    800497 <_panic+0x43>
+
+0080049a <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80049a:	55                   	push   %ebp
+  80049b:	89 e5                	mov    %esp,%ebp
+  80049d:	53                   	push   %ebx
+  80049e:	83 ec 04             	sub    $0x4,%esp
+  8004a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8004a4:	8b 13                	mov    (%ebx),%edx
+  8004a6:	8d 42 01             	lea    0x1(%edx),%eax
+  8004a9:	89 03                	mov    %eax,(%ebx)
+  8004ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004ae:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8004b2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004b7:	74 09                	je     8004c2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8004b9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8004bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004c0:	c9                   	leave
+  8004c1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8004c2:	83 ec 08             	sub    $0x8,%esp
+  8004c5:	68 ff 00 00 00       	push   $0xff
+  8004ca:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004cd:	50                   	push   %eax
+  8004ce:	e8 1d 0a 00 00       	call   800ef0 <sys_cputs>
+		b->idx = 0;
+  8004d3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004d9:	83 c4 10             	add    $0x10,%esp
+  8004dc:	eb db                	jmp    8004b9 <putch+0x1f>
+
+008004de <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004de:	55                   	push   %ebp
+  8004df:	89 e5                	mov    %esp,%ebp
+  8004e1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004e7:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004ee:	00 00 00 
+	b.cnt = 0;
+  8004f1:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004f8:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004fb:	ff 75 0c             	push   0xc(%ebp)
+  8004fe:	ff 75 08             	push   0x8(%ebp)
+  800501:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800507:	50                   	push   %eax
+  800508:	68 9a 04 80 00       	push   $0x80049a
+  80050d:	e8 fb 00 00 00       	call   80060d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800512:	83 c4 08             	add    $0x8,%esp
+  800515:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80051b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800521:	50                   	push   %eax
+  800522:	e8 c9 09 00 00       	call   800ef0 <sys_cputs>
+
+	return b.cnt;
+}
+  800527:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80052d:	c9                   	leave
+  80052e:	c3                   	ret
+
+0080052f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80052f:	55                   	push   %ebp
+  800530:	89 e5                	mov    %esp,%ebp
+  800532:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800535:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800538:	50                   	push   %eax
+  800539:	ff 75 08             	push   0x8(%ebp)
+  80053c:	e8 9d ff ff ff       	call   8004de <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800541:	c9                   	leave
+  800542:	c3                   	ret
+
+00800543 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800543:	55                   	push   %ebp
+  800544:	89 e5                	mov    %esp,%ebp
+  800546:	57                   	push   %edi
+  800547:	56                   	push   %esi
+  800548:	53                   	push   %ebx
+  800549:	83 ec 1c             	sub    $0x1c,%esp
+  80054c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80054f:	89 d6                	mov    %edx,%esi
+  800551:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800554:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800557:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80055a:	73 0b                	jae    800567 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80055c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80055f:	c1 e7 08             	shl    $0x8,%edi
+  800562:	0b 7d 10             	or     0x10(%ebp),%edi
+  800565:	eb 36                	jmp    80059d <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800567:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80056a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80056f:	f7 75 08             	divl   0x8(%ebp)
+  800572:	89 c1                	mov    %eax,%ecx
+  800574:	ff 75 14             	push   0x14(%ebp)
+  800577:	ff 75 10             	push   0x10(%ebp)
+  80057a:	83 eb 01             	sub    $0x1,%ebx
+  80057d:	53                   	push   %ebx
+  80057e:	ff 75 08             	push   0x8(%ebp)
+  800581:	89 f2                	mov    %esi,%edx
+  800583:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800586:	e8 b8 ff ff ff       	call   800543 <printnum>
+  80058b:	83 c4 10             	add    $0x10,%esp
+  80058e:	eb 14                	jmp    8005a4 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800590:	83 ec 08             	sub    $0x8,%esp
+  800593:	56                   	push   %esi
+  800594:	57                   	push   %edi
+  800595:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800598:	ff d0                	call   *%eax
+  80059a:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80059d:	83 eb 01             	sub    $0x1,%ebx
+  8005a0:	85 db                	test   %ebx,%ebx
+  8005a2:	7f ec                	jg     800590 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8005a4:	83 ec 08             	sub    $0x8,%esp
+  8005a7:	56                   	push   %esi
+  8005a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b0:	f7 75 08             	divl   0x8(%ebp)
+  8005b3:	0f be 92 9f 38 80 00 	movsbl 0x80389f(%edx),%edx
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	c1 e0 08             	shl    $0x8,%eax
+  8005c0:	09 d0                	or     %edx,%eax
+  8005c2:	50                   	push   %eax
+  8005c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005c6:	ff d0                	call   *%eax
+}
+  8005c8:	83 c4 10             	add    $0x10,%esp
+  8005cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ce:	5b                   	pop    %ebx
+  8005cf:	5e                   	pop    %esi
+  8005d0:	5f                   	pop    %edi
+  8005d1:	5d                   	pop    %ebp
+  8005d2:	c3                   	ret
+
+008005d3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005d3:	55                   	push   %ebp
+  8005d4:	89 e5                	mov    %esp,%ebp
+  8005d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005d9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005dd:	8b 10                	mov    (%eax),%edx
+  8005df:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005e2:	73 0a                	jae    8005ee <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005e4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005e7:	89 08                	mov    %ecx,(%eax)
+  8005e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005ec:	88 02                	mov    %al,(%edx)
+}
+  8005ee:	5d                   	pop    %ebp
+  8005ef:	c3                   	ret
+
+008005f0 <printfmt>:
+{
+  8005f0:	55                   	push   %ebp
+  8005f1:	89 e5                	mov    %esp,%ebp
+  8005f3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005f6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005f9:	50                   	push   %eax
+  8005fa:	ff 75 10             	push   0x10(%ebp)
+  8005fd:	ff 75 0c             	push   0xc(%ebp)
+  800600:	ff 75 08             	push   0x8(%ebp)
+  800603:	e8 05 00 00 00       	call   80060d <vprintfmt>
+}
+  800608:	83 c4 10             	add    $0x10,%esp
+  80060b:	c9                   	leave
+  80060c:	c3                   	ret
+
+0080060d <vprintfmt>:
+{
+  80060d:	55                   	push   %ebp
+  80060e:	89 e5                	mov    %esp,%ebp
+  800610:	57                   	push   %edi
+  800611:	56                   	push   %esi
+  800612:	53                   	push   %ebx
+  800613:	83 ec 3c             	sub    $0x3c,%esp
+  800616:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800619:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80061c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800623:	eb 16                	jmp    80063b <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800625:	83 ec 08             	sub    $0x8,%esp
+  800628:	ff 75 0c             	push   0xc(%ebp)
+  80062b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80062e:	c1 e2 08             	shl    $0x8,%edx
+  800631:	09 d0                	or     %edx,%eax
+  800633:	50                   	push   %eax
+  800634:	ff d7                	call   *%edi
+  800636:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800639:	89 de                	mov    %ebx,%esi
+  80063b:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80063e:	0f b6 06             	movzbl (%esi),%eax
+  800641:	83 f8 25             	cmp    $0x25,%eax
+  800644:	74 0c                	je     800652 <vprintfmt+0x45>
+			if (ch == '\0')
+  800646:	85 c0                	test   %eax,%eax
+  800648:	75 db                	jne    800625 <vprintfmt+0x18>
+}
+  80064a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80064d:	5b                   	pop    %ebx
+  80064e:	5e                   	pop    %esi
+  80064f:	5f                   	pop    %edi
+  800650:	5d                   	pop    %ebp
+  800651:	c3                   	ret
+		padc = ' ';
+  800652:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800656:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80065d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800664:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80066b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800670:	8d 73 01             	lea    0x1(%ebx),%esi
+  800673:	0f b6 13             	movzbl (%ebx),%edx
+  800676:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800679:	3c 55                	cmp    $0x55,%al
+  80067b:	0f 87 2c 04 00 00    	ja     800aad <vprintfmt+0x4a0>
+  800681:	0f b6 c0             	movzbl %al,%eax
+  800684:	ff 24 85 e0 39 80 00 	jmp    *0x8039e0(,%eax,4)
+  80068b:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80068d:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800691:	eb dd                	jmp    800670 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800693:	89 f3                	mov    %esi,%ebx
+  800695:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800699:	eb d5                	jmp    800670 <vprintfmt+0x63>
+  80069b:	0f b6 d2             	movzbl %dl,%edx
+  80069e:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8006a0:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8006a5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8006a8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8006ac:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8006af:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8006b2:	83 fe 09             	cmp    $0x9,%esi
+  8006b5:	0f 87 8a 00 00 00    	ja     800745 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8006bb:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8006be:	eb e5                	jmp    8006a5 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8b 00                	mov    (%eax),%eax
+  8006c5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d1:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8006d3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006d7:	79 97                	jns    800670 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8006d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006df:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006e6:	eb 88                	jmp    800670 <vprintfmt+0x63>
+			if (width < 0)
+  8006e8:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8006eb:	85 db                	test   %ebx,%ebx
+  8006ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f2:	0f 49 c3             	cmovns %ebx,%eax
+  8006f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f8:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8006fa:	e9 71 ff ff ff       	jmp    800670 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006ff:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800701:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800708:	e9 63 ff ff ff       	jmp    800670 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80070d:	8d 73 02             	lea    0x2(%ebx),%esi
+  800710:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800714:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80071b:	3c 67                	cmp    $0x67,%al
+  80071d:	0f 84 18 ff ff ff    	je     80063b <vprintfmt+0x2e>
+					attrib = 0x04;
+  800723:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80072a:	3c 72                	cmp    $0x72,%al
+  80072c:	0f 84 09 ff ff ff    	je     80063b <vprintfmt+0x2e>
+					attrib = 0x00;
+  800732:	3c 62                	cmp    $0x62,%al
+  800734:	0f 94 c0             	sete   %al
+  800737:	0f b6 c0             	movzbl %al,%eax
+  80073a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80073d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800740:	e9 f6 fe ff ff       	jmp    80063b <vprintfmt+0x2e>
+  800745:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800748:	eb 89                	jmp    8006d3 <vprintfmt+0xc6>
+			lflag++;
+  80074a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80074d:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80074f:	e9 1c ff ff ff       	jmp    800670 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8d 58 04             	lea    0x4(%eax),%ebx
+  80075a:	83 ec 08             	sub    $0x8,%esp
+  80075d:	ff 75 0c             	push   0xc(%ebp)
+  800760:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800763:	c1 e0 08             	shl    $0x8,%eax
+  800766:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800769:	0b 01                	or     (%ecx),%eax
+  80076b:	50                   	push   %eax
+  80076c:	ff d7                	call   *%edi
+			break;
+  80076e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800771:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800774:	e9 c2 fe ff ff       	jmp    80063b <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80077f:	8b 10                	mov    (%eax),%edx
+  800781:	89 d0                	mov    %edx,%eax
+  800783:	f7 d8                	neg    %eax
+  800785:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800788:	83 f8 12             	cmp    $0x12,%eax
+  80078b:	7f 25                	jg     8007b2 <vprintfmt+0x1a5>
+  80078d:	8b 14 85 40 3b 80 00 	mov    0x803b40(,%eax,4),%edx
+  800794:	85 d2                	test   %edx,%edx
+  800796:	74 1a                	je     8007b2 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800798:	52                   	push   %edx
+  800799:	68 81 3c 80 00       	push   $0x803c81
+  80079e:	ff 75 0c             	push   0xc(%ebp)
+  8007a1:	57                   	push   %edi
+  8007a2:	e8 49 fe ff ff       	call   8005f0 <printfmt>
+  8007a7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007aa:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8007ad:	e9 89 fe ff ff       	jmp    80063b <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8007b2:	50                   	push   %eax
+  8007b3:	68 b7 38 80 00       	push   $0x8038b7
+  8007b8:	ff 75 0c             	push   0xc(%ebp)
+  8007bb:	57                   	push   %edi
+  8007bc:	e8 2f fe ff ff       	call   8005f0 <printfmt>
+  8007c1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007c4:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8007c7:	e9 6f fe ff ff       	jmp    80063b <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cf:	83 c0 04             	add    $0x4,%eax
+  8007d2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8007d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d8:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8007da:	85 c9                	test   %ecx,%ecx
+  8007dc:	b8 b0 38 80 00       	mov    $0x8038b0,%eax
+  8007e1:	0f 45 c1             	cmovne %ecx,%eax
+  8007e4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8007e7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007eb:	7e 06                	jle    8007f3 <vprintfmt+0x1e6>
+  8007ed:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8007f1:	75 1a                	jne    80080d <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8007f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007f6:	c1 e0 08             	shl    $0x8,%eax
+  8007f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8007fc:	83 c8 3f             	or     $0x3f,%eax
+  8007ff:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800802:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800805:	89 75 10             	mov    %esi,0x10(%ebp)
+  800808:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80080b:	eb 6d                	jmp    80087a <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80080d:	83 ec 08             	sub    $0x8,%esp
+  800810:	ff 75 d0             	push   -0x30(%ebp)
+  800813:	ff 75 c8             	push   -0x38(%ebp)
+  800816:	e8 39 03 00 00       	call   800b54 <strnlen>
+  80081b:	89 c2                	mov    %eax,%edx
+  80081d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800820:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800822:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800825:	c1 e1 08             	shl    $0x8,%ecx
+  800828:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80082c:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	89 c3                	mov    %eax,%ebx
+  800833:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800836:	89 75 10             	mov    %esi,0x10(%ebp)
+  800839:	89 ce                	mov    %ecx,%esi
+  80083b:	eb 0f                	jmp    80084c <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80083d:	83 ec 08             	sub    $0x8,%esp
+  800840:	ff 75 0c             	push   0xc(%ebp)
+  800843:	56                   	push   %esi
+  800844:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800846:	83 eb 01             	sub    $0x1,%ebx
+  800849:	83 c4 10             	add    $0x10,%esp
+  80084c:	85 db                	test   %ebx,%ebx
+  80084e:	7f ed                	jg     80083d <vprintfmt+0x230>
+  800850:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800853:	8b 75 10             	mov    0x10(%ebp),%esi
+  800856:	85 c0                	test   %eax,%eax
+  800858:	ba 00 00 00 00       	mov    $0x0,%edx
+  80085d:	0f 49 d0             	cmovns %eax,%edx
+  800860:	29 d0                	sub    %edx,%eax
+  800862:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800865:	eb 8c                	jmp    8007f3 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800867:	83 ec 08             	sub    $0x8,%esp
+  80086a:	ff 75 0c             	push   0xc(%ebp)
+  80086d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800870:	09 c2                	or     %eax,%edx
+  800872:	52                   	push   %edx
+  800873:	ff d7                	call   *%edi
+  800875:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800878:	89 d9                	mov    %ebx,%ecx
+  80087a:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80087d:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800881:	0f be d0             	movsbl %al,%edx
+  800884:	85 d2                	test   %edx,%edx
+  800886:	74 2a                	je     8008b2 <vprintfmt+0x2a5>
+  800888:	85 f6                	test   %esi,%esi
+  80088a:	78 05                	js     800891 <vprintfmt+0x284>
+  80088c:	83 ee 01             	sub    $0x1,%esi
+  80088f:	78 3b                	js     8008cc <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800891:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800895:	74 d0                	je     800867 <vprintfmt+0x25a>
+  800897:	0f be c0             	movsbl %al,%eax
+  80089a:	83 e8 20             	sub    $0x20,%eax
+  80089d:	83 f8 5e             	cmp    $0x5e,%eax
+  8008a0:	76 c5                	jbe    800867 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8008a2:	83 ec 08             	sub    $0x8,%esp
+  8008a5:	ff 75 0c             	push   0xc(%ebp)
+  8008a8:	ff 75 cc             	push   -0x34(%ebp)
+  8008ab:	ff d7                	call   *%edi
+  8008ad:	83 c4 10             	add    $0x10,%esp
+  8008b0:	eb c6                	jmp    800878 <vprintfmt+0x26b>
+  8008b2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008b5:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8008b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008bb:	01 c3                	add    %eax,%ebx
+  8008bd:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8008bf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8008c2:	83 c8 20             	or     $0x20,%eax
+  8008c5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008c8:	89 c6                	mov    %eax,%esi
+  8008ca:	eb 14                	jmp    8008e0 <vprintfmt+0x2d3>
+  8008cc:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008cf:	eb e4                	jmp    8008b5 <vprintfmt+0x2a8>
+  8008d1:	83 ec 08             	sub    $0x8,%esp
+  8008d4:	ff 75 0c             	push   0xc(%ebp)
+  8008d7:	56                   	push   %esi
+  8008d8:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8008da:	83 eb 01             	sub    $0x1,%ebx
+  8008dd:	83 c4 10             	add    $0x10,%esp
+  8008e0:	85 db                	test   %ebx,%ebx
+  8008e2:	7f ed                	jg     8008d1 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008e4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008e7:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8008ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008ed:	e9 49 fd ff ff       	jmp    80063b <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008f2:	83 f9 01             	cmp    $0x1,%ecx
+  8008f5:	7f 1f                	jg     800916 <vprintfmt+0x309>
+	else if (lflag)
+  8008f7:	85 c9                	test   %ecx,%ecx
+  8008f9:	74 69                	je     800964 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8008fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fe:	8b 00                	mov    (%eax),%eax
+  800900:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800903:	89 c1                	mov    %eax,%ecx
+  800905:	c1 f9 1f             	sar    $0x1f,%ecx
+  800908:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80090b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090e:	8d 40 04             	lea    0x4(%eax),%eax
+  800911:	89 45 14             	mov    %eax,0x14(%ebp)
+  800914:	eb 17                	jmp    80092d <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800916:	8b 45 14             	mov    0x14(%ebp),%eax
+  800919:	8b 50 04             	mov    0x4(%eax),%edx
+  80091c:	8b 00                	mov    (%eax),%eax
+  80091e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800921:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800924:	8b 45 14             	mov    0x14(%ebp),%eax
+  800927:	8d 40 08             	lea    0x8(%eax),%eax
+  80092a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80092d:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800930:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800933:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800938:	85 db                	test   %ebx,%ebx
+  80093a:	0f 89 f6 00 00 00    	jns    800a36 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800940:	83 ec 08             	sub    $0x8,%esp
+  800943:	ff 75 0c             	push   0xc(%ebp)
+  800946:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800949:	c1 e0 08             	shl    $0x8,%eax
+  80094c:	83 c8 2d             	or     $0x2d,%eax
+  80094f:	50                   	push   %eax
+  800950:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800952:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800955:	f7 d9                	neg    %ecx
+  800957:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80095a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80095f:	e9 d2 00 00 00       	jmp    800a36 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800964:	8b 45 14             	mov    0x14(%ebp),%eax
+  800967:	8b 00                	mov    (%eax),%eax
+  800969:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80096c:	89 c1                	mov    %eax,%ecx
+  80096e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800971:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800974:	8b 45 14             	mov    0x14(%ebp),%eax
+  800977:	8d 40 04             	lea    0x4(%eax),%eax
+  80097a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097d:	eb ae                	jmp    80092d <vprintfmt+0x320>
+	if (lflag >= 2)
+  80097f:	83 f9 01             	cmp    $0x1,%ecx
+  800982:	7f 19                	jg     80099d <vprintfmt+0x390>
+	else if (lflag)
+  800984:	85 c9                	test   %ecx,%ecx
+  800986:	74 2a                	je     8009b2 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800988:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098b:	8b 08                	mov    (%eax),%ecx
+  80098d:	8d 40 04             	lea    0x4(%eax),%eax
+  800990:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800993:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800998:	e9 99 00 00 00       	jmp    800a36 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80099d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a0:	8b 08                	mov    (%eax),%ecx
+  8009a2:	8d 40 08             	lea    0x8(%eax),%eax
+  8009a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8009ad:	e9 84 00 00 00       	jmp    800a36 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8009b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b5:	8b 08                	mov    (%eax),%ecx
+  8009b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8009c2:	eb 72                	jmp    800a36 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8009c4:	83 f9 01             	cmp    $0x1,%ecx
+  8009c7:	7f 16                	jg     8009df <vprintfmt+0x3d2>
+	else if (lflag)
+  8009c9:	85 c9                	test   %ecx,%ecx
+  8009cb:	74 24                	je     8009f1 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8009cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d0:	8b 08                	mov    (%eax),%ecx
+  8009d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009d8:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8009dd:	eb 57                	jmp    800a36 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8009df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e2:	8b 08                	mov    (%eax),%ecx
+  8009e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009ea:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8009ef:	eb 45                	jmp    800a36 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8009f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f4:	8b 08                	mov    (%eax),%ecx
+  8009f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009fc:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800a01:	eb 33                	jmp    800a36 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800a03:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a06:	c1 e3 08             	shl    $0x8,%ebx
+  800a09:	83 ec 08             	sub    $0x8,%esp
+  800a0c:	ff 75 0c             	push   0xc(%ebp)
+  800a0f:	89 d8                	mov    %ebx,%eax
+  800a11:	83 c8 30             	or     $0x30,%eax
+  800a14:	50                   	push   %eax
+  800a15:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800a17:	83 c4 08             	add    $0x8,%esp
+  800a1a:	ff 75 0c             	push   0xc(%ebp)
+  800a1d:	83 cb 78             	or     $0x78,%ebx
+  800a20:	53                   	push   %ebx
+  800a21:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800a23:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a26:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800a28:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a2b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a31:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800a36:	ff 75 e4             	push   -0x1c(%ebp)
+  800a39:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800a3d:	52                   	push   %edx
+  800a3e:	ff 75 e0             	push   -0x20(%ebp)
+  800a41:	50                   	push   %eax
+  800a42:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a45:	89 f8                	mov    %edi,%eax
+  800a47:	e8 f7 fa ff ff       	call   800543 <printnum>
+			break;
+  800a4c:	83 c4 10             	add    $0x10,%esp
+  800a4f:	e9 e7 fb ff ff       	jmp    80063b <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800a54:	83 f9 01             	cmp    $0x1,%ecx
+  800a57:	7f 16                	jg     800a6f <vprintfmt+0x462>
+	else if (lflag)
+  800a59:	85 c9                	test   %ecx,%ecx
+  800a5b:	74 24                	je     800a81 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800a5d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a60:	8b 08                	mov    (%eax),%ecx
+  800a62:	8d 40 04             	lea    0x4(%eax),%eax
+  800a65:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a68:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800a6d:	eb c7                	jmp    800a36 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a6f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a72:	8b 08                	mov    (%eax),%ecx
+  800a74:	8d 40 08             	lea    0x8(%eax),%eax
+  800a77:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a7a:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800a7f:	eb b5                	jmp    800a36 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a81:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a84:	8b 08                	mov    (%eax),%ecx
+  800a86:	8d 40 04             	lea    0x4(%eax),%eax
+  800a89:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a8c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800a91:	eb a3                	jmp    800a36 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800a93:	83 ec 08             	sub    $0x8,%esp
+  800a96:	ff 75 0c             	push   0xc(%ebp)
+  800a99:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a9c:	c1 e0 08             	shl    $0x8,%eax
+  800a9f:	83 c8 25             	or     $0x25,%eax
+  800aa2:	50                   	push   %eax
+  800aa3:	ff d7                	call   *%edi
+			break;
+  800aa5:	83 c4 10             	add    $0x10,%esp
+  800aa8:	e9 8e fb ff ff       	jmp    80063b <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800aad:	83 ec 08             	sub    $0x8,%esp
+  800ab0:	ff 75 0c             	push   0xc(%ebp)
+  800ab3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800ab6:	c1 e0 08             	shl    $0x8,%eax
+  800ab9:	83 c8 25             	or     $0x25,%eax
+  800abc:	50                   	push   %eax
+  800abd:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800abf:	83 c4 10             	add    $0x10,%esp
+  800ac2:	89 de                	mov    %ebx,%esi
+  800ac4:	eb 03                	jmp    800ac9 <vprintfmt+0x4bc>
+  800ac6:	83 ee 01             	sub    $0x1,%esi
+  800ac9:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800acd:	75 f7                	jne    800ac6 <vprintfmt+0x4b9>
+  800acf:	e9 67 fb ff ff       	jmp    80063b <vprintfmt+0x2e>
+
+00800ad4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	83 ec 18             	sub    $0x18,%esp
+  800ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  800add:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ae0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ae3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ae7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800aea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800af1:	85 c0                	test   %eax,%eax
+  800af3:	74 26                	je     800b1b <vsnprintf+0x47>
+  800af5:	85 d2                	test   %edx,%edx
+  800af7:	7e 22                	jle    800b1b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800af9:	ff 75 14             	push   0x14(%ebp)
+  800afc:	ff 75 10             	push   0x10(%ebp)
+  800aff:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b02:	50                   	push   %eax
+  800b03:	68 d3 05 80 00       	push   $0x8005d3
+  800b08:	e8 00 fb ff ff       	call   80060d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b0d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b10:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b16:	83 c4 10             	add    $0x10,%esp
+}
+  800b19:	c9                   	leave
+  800b1a:	c3                   	ret
+		return -E_INVAL;
+  800b1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b20:	eb f7                	jmp    800b19 <vsnprintf+0x45>
+
+00800b22 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b22:	55                   	push   %ebp
+  800b23:	89 e5                	mov    %esp,%ebp
+  800b25:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800b28:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b2b:	50                   	push   %eax
+  800b2c:	ff 75 10             	push   0x10(%ebp)
+  800b2f:	ff 75 0c             	push   0xc(%ebp)
+  800b32:	ff 75 08             	push   0x8(%ebp)
+  800b35:	e8 9a ff ff ff       	call   800ad4 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b3a:	c9                   	leave
+  800b3b:	c3                   	ret
+
+00800b3c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b3c:	55                   	push   %ebp
+  800b3d:	89 e5                	mov    %esp,%ebp
+  800b3f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b47:	eb 03                	jmp    800b4c <strlen+0x10>
+		n++;
+  800b49:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b4c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b50:	75 f7                	jne    800b49 <strlen+0xd>
+	return n;
+}
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+
+00800b54 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b62:	eb 03                	jmp    800b67 <strnlen+0x13>
+		n++;
+  800b64:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b67:	39 d0                	cmp    %edx,%eax
+  800b69:	74 08                	je     800b73 <strnlen+0x1f>
+  800b6b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b6f:	75 f3                	jne    800b64 <strnlen+0x10>
+  800b71:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b73:	89 d0                	mov    %edx,%eax
+  800b75:	5d                   	pop    %ebp
+  800b76:	c3                   	ret
+
+00800b77 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	53                   	push   %ebx
+  800b7b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b7e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b86:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b8a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b8d:	83 c0 01             	add    $0x1,%eax
+  800b90:	84 d2                	test   %dl,%dl
+  800b92:	75 f2                	jne    800b86 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b94:	89 c8                	mov    %ecx,%eax
+  800b96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b99:	c9                   	leave
+  800b9a:	c3                   	ret
+
+00800b9b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	53                   	push   %ebx
+  800b9f:	83 ec 10             	sub    $0x10,%esp
+  800ba2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ba5:	53                   	push   %ebx
+  800ba6:	e8 91 ff ff ff       	call   800b3c <strlen>
+  800bab:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bae:	ff 75 0c             	push   0xc(%ebp)
+  800bb1:	01 d8                	add    %ebx,%eax
+  800bb3:	50                   	push   %eax
+  800bb4:	e8 be ff ff ff       	call   800b77 <strcpy>
+	return dst;
+}
+  800bb9:	89 d8                	mov    %ebx,%eax
+  800bbb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bbe:	c9                   	leave
+  800bbf:	c3                   	ret
+
+00800bc0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	56                   	push   %esi
+  800bc4:	53                   	push   %ebx
+  800bc5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bcb:	89 f3                	mov    %esi,%ebx
+  800bcd:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bd0:	89 f0                	mov    %esi,%eax
+  800bd2:	eb 0f                	jmp    800be3 <strncpy+0x23>
+		*dst++ = *src;
+  800bd4:	83 c0 01             	add    $0x1,%eax
+  800bd7:	0f b6 0a             	movzbl (%edx),%ecx
+  800bda:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bdd:	80 f9 01             	cmp    $0x1,%cl
+  800be0:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800be3:	39 d8                	cmp    %ebx,%eax
+  800be5:	75 ed                	jne    800bd4 <strncpy+0x14>
+	}
+	return ret;
+}
+  800be7:	89 f0                	mov    %esi,%eax
+  800be9:	5b                   	pop    %ebx
+  800bea:	5e                   	pop    %esi
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+
+00800bed <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	56                   	push   %esi
+  800bf1:	53                   	push   %ebx
+  800bf2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf8:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bfb:	89 f0                	mov    %esi,%eax
+  800bfd:	85 d2                	test   %edx,%edx
+  800bff:	74 21                	je     800c22 <strlcpy+0x35>
+  800c01:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c05:	89 f2                	mov    %esi,%edx
+  800c07:	eb 09                	jmp    800c12 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c09:	83 c1 01             	add    $0x1,%ecx
+  800c0c:	83 c2 01             	add    $0x1,%edx
+  800c0f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c12:	39 c2                	cmp    %eax,%edx
+  800c14:	74 09                	je     800c1f <strlcpy+0x32>
+  800c16:	0f b6 19             	movzbl (%ecx),%ebx
+  800c19:	84 db                	test   %bl,%bl
+  800c1b:	75 ec                	jne    800c09 <strlcpy+0x1c>
+  800c1d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c1f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c22:	29 f0                	sub    %esi,%eax
+}
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5d                   	pop    %ebp
+  800c27:	c3                   	ret
+
+00800c28 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c31:	eb 06                	jmp    800c39 <strcmp+0x11>
+		p++, q++;
+  800c33:	83 c1 01             	add    $0x1,%ecx
+  800c36:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c39:	0f b6 01             	movzbl (%ecx),%eax
+  800c3c:	84 c0                	test   %al,%al
+  800c3e:	74 04                	je     800c44 <strcmp+0x1c>
+  800c40:	3a 02                	cmp    (%edx),%al
+  800c42:	74 ef                	je     800c33 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c44:	0f b6 c0             	movzbl %al,%eax
+  800c47:	0f b6 12             	movzbl (%edx),%edx
+  800c4a:	29 d0                	sub    %edx,%eax
+}
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+
+00800c4e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	53                   	push   %ebx
+  800c52:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c58:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c5b:	eb 09                	jmp    800c66 <strncmp+0x18>
+		n--, p++, q++;
+  800c5d:	83 ea 01             	sub    $0x1,%edx
+  800c60:	83 c0 01             	add    $0x1,%eax
+  800c63:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c66:	85 d2                	test   %edx,%edx
+  800c68:	74 18                	je     800c82 <strncmp+0x34>
+  800c6a:	0f b6 18             	movzbl (%eax),%ebx
+  800c6d:	84 db                	test   %bl,%bl
+  800c6f:	74 04                	je     800c75 <strncmp+0x27>
+  800c71:	3a 19                	cmp    (%ecx),%bl
+  800c73:	74 e8                	je     800c5d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c75:	0f b6 00             	movzbl (%eax),%eax
+  800c78:	0f b6 11             	movzbl (%ecx),%edx
+  800c7b:	29 d0                	sub    %edx,%eax
+}
+  800c7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c80:	c9                   	leave
+  800c81:	c3                   	ret
+		return 0;
+  800c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c87:	eb f4                	jmp    800c7d <strncmp+0x2f>
+
+00800c89 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c93:	eb 03                	jmp    800c98 <strchr+0xf>
+  800c95:	83 c0 01             	add    $0x1,%eax
+  800c98:	0f b6 10             	movzbl (%eax),%edx
+  800c9b:	84 d2                	test   %dl,%dl
+  800c9d:	74 06                	je     800ca5 <strchr+0x1c>
+		if (*s == c)
+  800c9f:	38 ca                	cmp    %cl,%dl
+  800ca1:	75 f2                	jne    800c95 <strchr+0xc>
+  800ca3:	eb 05                	jmp    800caa <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cb6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cb9:	38 ca                	cmp    %cl,%dl
+  800cbb:	74 09                	je     800cc6 <strfind+0x1a>
+  800cbd:	84 d2                	test   %dl,%dl
+  800cbf:	74 05                	je     800cc6 <strfind+0x1a>
+	for (; *s; s++)
+  800cc1:	83 c0 01             	add    $0x1,%eax
+  800cc4:	eb f0                	jmp    800cb6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800cc6:	5d                   	pop    %ebp
+  800cc7:	c3                   	ret
+
+00800cc8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	57                   	push   %edi
+  800ccc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ccf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cd2:	85 c9                	test   %ecx,%ecx
+  800cd4:	74 20                	je     800cf6 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cd6:	89 f8                	mov    %edi,%eax
+  800cd8:	09 c8                	or     %ecx,%eax
+  800cda:	a8 03                	test   $0x3,%al
+  800cdc:	75 12                	jne    800cf0 <memset+0x28>
+		c &= 0xFF;
+  800cde:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ce2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ce8:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ceb:	fc                   	cld
+  800cec:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cee:	eb 06                	jmp    800cf6 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cf0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cf3:	fc                   	cld
+  800cf4:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cf6:	89 f8                	mov    %edi,%eax
+  800cf8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cfb:	c9                   	leave
+  800cfc:	c3                   	ret
+
+00800cfd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	57                   	push   %edi
+  800d01:	56                   	push   %esi
+  800d02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d05:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d08:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d0b:	39 c6                	cmp    %eax,%esi
+  800d0d:	73 32                	jae    800d41 <memmove+0x44>
+  800d0f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d12:	39 d0                	cmp    %edx,%eax
+  800d14:	73 2b                	jae    800d41 <memmove+0x44>
+		s += n;
+		d += n;
+  800d16:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d19:	89 d6                	mov    %edx,%esi
+  800d1b:	09 fe                	or     %edi,%esi
+  800d1d:	09 ce                	or     %ecx,%esi
+  800d1f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d25:	75 0e                	jne    800d35 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d27:	83 ef 04             	sub    $0x4,%edi
+  800d2a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d2d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d30:	fd                   	std
+  800d31:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d33:	eb 09                	jmp    800d3e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d35:	83 ef 01             	sub    $0x1,%edi
+  800d38:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d3b:	fd                   	std
+  800d3c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d3e:	fc                   	cld
+  800d3f:	eb 1a                	jmp    800d5b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d41:	89 f2                	mov    %esi,%edx
+  800d43:	09 c2                	or     %eax,%edx
+  800d45:	09 ca                	or     %ecx,%edx
+  800d47:	f6 c2 03             	test   $0x3,%dl
+  800d4a:	75 0a                	jne    800d56 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d4c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d4f:	89 c7                	mov    %eax,%edi
+  800d51:	fc                   	cld
+  800d52:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d54:	eb 05                	jmp    800d5b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d56:	89 c7                	mov    %eax,%edi
+  800d58:	fc                   	cld
+  800d59:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+
+00800d5f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d65:	ff 75 10             	push   0x10(%ebp)
+  800d68:	ff 75 0c             	push   0xc(%ebp)
+  800d6b:	ff 75 08             	push   0x8(%ebp)
+  800d6e:	e8 8a ff ff ff       	call   800cfd <memmove>
+}
+  800d73:	c9                   	leave
+  800d74:	c3                   	ret
+
+00800d75 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	56                   	push   %esi
+  800d79:	53                   	push   %ebx
+  800d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d80:	89 c6                	mov    %eax,%esi
+  800d82:	03 75 10             	add    0x10(%ebp),%esi
+  800d85:	eb 06                	jmp    800d8d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d87:	83 c0 01             	add    $0x1,%eax
+  800d8a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d8d:	39 f0                	cmp    %esi,%eax
+  800d8f:	74 14                	je     800da5 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d91:	0f b6 08             	movzbl (%eax),%ecx
+  800d94:	0f b6 1a             	movzbl (%edx),%ebx
+  800d97:	38 d9                	cmp    %bl,%cl
+  800d99:	74 ec                	je     800d87 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d9b:	0f b6 c1             	movzbl %cl,%eax
+  800d9e:	0f b6 db             	movzbl %bl,%ebx
+  800da1:	29 d8                	sub    %ebx,%eax
+  800da3:	eb 05                	jmp    800daa <memcmp+0x35>
+	}
+
+	return 0;
+  800da5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800daa:	5b                   	pop    %ebx
+  800dab:	5e                   	pop    %esi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+
+00800dae <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800db7:	89 c2                	mov    %eax,%edx
+  800db9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dbc:	eb 03                	jmp    800dc1 <memfind+0x13>
+  800dbe:	83 c0 01             	add    $0x1,%eax
+  800dc1:	39 d0                	cmp    %edx,%eax
+  800dc3:	73 04                	jae    800dc9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dc5:	38 08                	cmp    %cl,(%eax)
+  800dc7:	75 f5                	jne    800dbe <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+
+00800dcb <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	57                   	push   %edi
+  800dcf:	56                   	push   %esi
+  800dd0:	53                   	push   %ebx
+  800dd1:	83 ec 1c             	sub    $0x1c,%esp
+  800dd4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dd7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800dda:	eb 03                	jmp    800ddf <strtol+0x14>
+		s++;
+  800ddc:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800ddf:	0f b6 06             	movzbl (%esi),%eax
+  800de2:	3c 20                	cmp    $0x20,%al
+  800de4:	74 f6                	je     800ddc <strtol+0x11>
+  800de6:	3c 09                	cmp    $0x9,%al
+  800de8:	74 f2                	je     800ddc <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800dea:	3c 2b                	cmp    $0x2b,%al
+  800dec:	74 43                	je     800e31 <strtol+0x66>
+	int neg = 0;
+  800dee:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800df3:	3c 2d                	cmp    $0x2d,%al
+  800df5:	74 44                	je     800e3b <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800df7:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800dfd:	75 0f                	jne    800e0e <strtol+0x43>
+  800dff:	80 3e 30             	cmpb   $0x30,(%esi)
+  800e02:	74 41                	je     800e45 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e04:	85 ff                	test   %edi,%edi
+  800e06:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e0b:	0f 44 f8             	cmove  %eax,%edi
+  800e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e13:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e18:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800e1b:	89 fb                	mov    %edi,%ebx
+  800e1d:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e20:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800e23:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e26:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e29:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800e2c:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e2f:	eb 67                	jmp    800e98 <strtol+0xcd>
+		s++;
+  800e31:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800e34:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e39:	eb bc                	jmp    800df7 <strtol+0x2c>
+		s++, neg = 1;
+  800e3b:	83 c6 01             	add    $0x1,%esi
+  800e3e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e43:	eb b2                	jmp    800df7 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e45:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800e49:	74 0e                	je     800e59 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800e4b:	85 ff                	test   %edi,%edi
+  800e4d:	75 bf                	jne    800e0e <strtol+0x43>
+		s++, base = 8;
+  800e4f:	83 c6 01             	add    $0x1,%esi
+  800e52:	bf 08 00 00 00       	mov    $0x8,%edi
+  800e57:	eb b5                	jmp    800e0e <strtol+0x43>
+		s += 2, base = 16;
+  800e59:	83 c6 02             	add    $0x2,%esi
+  800e5c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800e61:	eb ab                	jmp    800e0e <strtol+0x43>
+			dig = *s - '0';
+  800e63:	0f be c9             	movsbl %cl,%ecx
+  800e66:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800e69:	39 f9                	cmp    %edi,%ecx
+  800e6b:	7d 59                	jge    800ec6 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800e6d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800e71:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e74:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e77:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800e7a:	0f af d8             	imul   %eax,%ebx
+  800e7d:	0f af d7             	imul   %edi,%edx
+  800e80:	01 d3                	add    %edx,%ebx
+  800e82:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e85:	f7 e7                	mul    %edi
+  800e87:	01 da                	add    %ebx,%edx
+  800e89:	89 cb                	mov    %ecx,%ebx
+  800e8b:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e8e:	01 c8                	add    %ecx,%eax
+  800e90:	11 da                	adc    %ebx,%edx
+  800e92:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e95:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800e98:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e9b:	0f b6 08             	movzbl (%eax),%ecx
+  800e9e:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800ea1:	80 fb 09             	cmp    $0x9,%bl
+  800ea4:	76 bd                	jbe    800e63 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800ea6:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800ea9:	80 fb 19             	cmp    $0x19,%bl
+  800eac:	77 08                	ja     800eb6 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800eae:	0f be c9             	movsbl %cl,%ecx
+  800eb1:	83 e9 57             	sub    $0x57,%ecx
+  800eb4:	eb b3                	jmp    800e69 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800eb6:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800eb9:	80 fb 19             	cmp    $0x19,%bl
+  800ebc:	77 08                	ja     800ec6 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800ebe:	0f be c9             	movsbl %cl,%ecx
+  800ec1:	83 e9 37             	sub    $0x37,%ecx
+  800ec4:	eb a3                	jmp    800e69 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ec6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ec9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ecc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800ecf:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ed2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ed6:	74 05                	je     800edd <strtol+0x112>
+		*endptr = (char *) s;
+  800ed8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800edb:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800edd:	85 c9                	test   %ecx,%ecx
+  800edf:	74 07                	je     800ee8 <strtol+0x11d>
+  800ee1:	f7 d8                	neg    %eax
+  800ee3:	83 d2 00             	adc    $0x0,%edx
+  800ee6:	f7 da                	neg    %edx
+}
+  800ee8:	83 c4 1c             	add    $0x1c,%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+
+00800ef0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ef0:	55                   	push   %ebp
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	57                   	push   %edi
+  800ef4:	56                   	push   %esi
+  800ef5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ef6:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  800efd:	74 18                	je     800f17 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0a:	89 c3                	mov    %eax,%ebx
+  800f0c:	89 c7                	mov    %eax,%edi
+  800f0e:	89 c6                	mov    %eax,%esi
+  800f10:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	89 c3                	mov    %eax,%ebx
+  800f24:	89 c7                	mov    %eax,%edi
+  800f26:	55                   	push   %ebp
+  800f27:	89 e5                	mov    %esp,%ebp
+  800f29:	8d 35 31 0f 80 00    	lea    0x800f31,%esi
+  800f2f:	0f 34                	sysenter
+  800f31:	5d                   	pop    %ebp
+		goto out;
+  800f32:	eb de                	jmp    800f12 <sys_cputs+0x22>
+
+00800f34 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	57                   	push   %edi
+  800f38:	56                   	push   %esi
+  800f39:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f3a:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  800f41:	74 19                	je     800f5c <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800f43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f48:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f4d:	89 d1                	mov    %edx,%ecx
+  800f4f:	89 d3                	mov    %edx,%ebx
+  800f51:	89 d7                	mov    %edx,%edi
+  800f53:	89 d6                	mov    %edx,%esi
+  800f55:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f57:	5b                   	pop    %ebx
+  800f58:	5e                   	pop    %esi
+  800f59:	5f                   	pop    %edi
+  800f5a:	5d                   	pop    %ebp
+  800f5b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f61:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f66:	89 d1                	mov    %edx,%ecx
+  800f68:	89 d3                	mov    %edx,%ebx
+  800f6a:	89 d7                	mov    %edx,%edi
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	8d 35 77 0f 80 00    	lea    0x800f77,%esi
+  800f75:	0f 34                	sysenter
+  800f77:	5d                   	pop    %ebp
+		goto out;
+  800f78:	eb dd                	jmp    800f57 <sys_cgetc+0x23>
+
+00800f7a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+  800f80:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f83:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  800f8a:	74 21                	je     800fad <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800f8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f91:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	89 cb                	mov    %ecx,%ebx
+  800f9b:	89 cf                	mov    %ecx,%edi
+  800f9d:	89 ce                	mov    %ecx,%esi
+  800f9f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa1:	85 c0                	test   %eax,%eax
+  800fa3:	7f 27                	jg     800fcc <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa8:	5b                   	pop    %ebx
+  800fa9:	5e                   	pop    %esi
+  800faa:	5f                   	pop    %edi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fb5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fba:	89 cb                	mov    %ecx,%ebx
+  800fbc:	89 cf                	mov    %ecx,%edi
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	8d 35 c9 0f 80 00    	lea    0x800fc9,%esi
+  800fc7:	0f 34                	sysenter
+  800fc9:	5d                   	pop    %ebp
+		goto out;
+  800fca:	eb d5                	jmp    800fa1 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fcc:	83 ec 0c             	sub    $0xc,%esp
+  800fcf:	50                   	push   %eax
+  800fd0:	6a 03                	push   $0x3
+  800fd2:	68 ab 3b 80 00       	push   $0x803bab
+  800fd7:	6a 3f                	push   $0x3f
+  800fd9:	68 c8 3b 80 00       	push   $0x803bc8
+  800fde:	e8 71 f4 ff ff       	call   800454 <_panic>
+
+00800fe3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	57                   	push   %edi
+  800fe7:	56                   	push   %esi
+  800fe8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fe9:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  800ff0:	74 19                	je     80100b <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800ff2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ffc:	89 d1                	mov    %edx,%ecx
+  800ffe:	89 d3                	mov    %edx,%ebx
+  801000:	89 d7                	mov    %edx,%edi
+  801002:	89 d6                	mov    %edx,%esi
+  801004:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801006:	5b                   	pop    %ebx
+  801007:	5e                   	pop    %esi
+  801008:	5f                   	pop    %edi
+  801009:	5d                   	pop    %ebp
+  80100a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80100b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801010:	b8 02 00 00 00       	mov    $0x2,%eax
+  801015:	89 d1                	mov    %edx,%ecx
+  801017:	89 d3                	mov    %edx,%ebx
+  801019:	89 d7                	mov    %edx,%edi
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	8d 35 26 10 80 00    	lea    0x801026,%esi
+  801024:	0f 34                	sysenter
+  801026:	5d                   	pop    %ebp
+		goto out;
+  801027:	eb dd                	jmp    801006 <sys_getenvid+0x23>
+
+00801029 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801029:	55                   	push   %ebp
+  80102a:	89 e5                	mov    %esp,%ebp
+  80102c:	57                   	push   %edi
+  80102d:	56                   	push   %esi
+  80102e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80102f:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801036:	74 19                	je     801051 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  801038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801042:	89 d1                	mov    %edx,%ecx
+  801044:	89 d3                	mov    %edx,%ebx
+  801046:	89 d7                	mov    %edx,%edi
+  801048:	89 d6                	mov    %edx,%esi
+  80104a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80104c:	5b                   	pop    %ebx
+  80104d:	5e                   	pop    %esi
+  80104e:	5f                   	pop    %edi
+  80104f:	5d                   	pop    %ebp
+  801050:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801051:	ba 00 00 00 00       	mov    $0x0,%edx
+  801056:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80105b:	89 d1                	mov    %edx,%ecx
+  80105d:	89 d3                	mov    %edx,%ebx
+  80105f:	89 d7                	mov    %edx,%edi
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	8d 35 6c 10 80 00    	lea    0x80106c,%esi
+  80106a:	0f 34                	sysenter
+  80106c:	5d                   	pop    %ebp
+		goto out;
+  80106d:	eb dd                	jmp    80104c <sys_yield+0x23>
+
+0080106f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+  801075:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801078:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  80107f:	74 23                	je     8010a4 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  801081:	be 00 00 00 00       	mov    $0x0,%esi
+  801086:	b8 04 00 00 00       	mov    $0x4,%eax
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801094:	89 f7                	mov    %esi,%edi
+  801096:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801098:	85 c0                	test   %eax,%eax
+  80109a:	7f 29                	jg     8010c5 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80109c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5e                   	pop    %esi
+  8010a1:	5f                   	pop    %edi
+  8010a2:	5d                   	pop    %ebp
+  8010a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010aa:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b7:	55                   	push   %ebp
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	8d 35 c2 10 80 00    	lea    0x8010c2,%esi
+  8010c0:	0f 34                	sysenter
+  8010c2:	5d                   	pop    %ebp
+		goto out;
+  8010c3:	eb d3                	jmp    801098 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c5:	83 ec 0c             	sub    $0xc,%esp
+  8010c8:	50                   	push   %eax
+  8010c9:	6a 04                	push   $0x4
+  8010cb:	68 ab 3b 80 00       	push   $0x803bab
+  8010d0:	6a 3f                	push   $0x3f
+  8010d2:	68 c8 3b 80 00       	push   $0x803bc8
+  8010d7:	e8 78 f3 ff ff       	call   800454 <_panic>
+
+008010dc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010dc:	55                   	push   %ebp
+  8010dd:	89 e5                	mov    %esp,%ebp
+  8010df:	57                   	push   %edi
+  8010e0:	56                   	push   %esi
+  8010e1:	53                   	push   %ebx
+  8010e2:	83 ec 0c             	sub    $0xc,%esp
+  8010e5:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  8010e8:	85 f6                	test   %esi,%esi
+  8010ea:	75 09                	jne    8010f5 <sys_page_map+0x19>
+  8010ec:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8010f3:	74 1f                	je     801114 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  8010f5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801100:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801103:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801106:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801108:	85 c0                	test   %eax,%eax
+  80110a:	7f 27                	jg     801133 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80110c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801114:	8b 55 08             	mov    0x8(%ebp),%edx
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80111f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801122:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	8d 35 30 11 80 00    	lea    0x801130,%esi
+  80112e:	0f 34                	sysenter
+  801130:	5d                   	pop    %ebp
+		goto out;
+  801131:	eb d5                	jmp    801108 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801133:	83 ec 0c             	sub    $0xc,%esp
+  801136:	50                   	push   %eax
+  801137:	6a 05                	push   $0x5
+  801139:	68 ab 3b 80 00       	push   $0x803bab
+  80113e:	6a 3f                	push   $0x3f
+  801140:	68 c8 3b 80 00       	push   $0x803bc8
+  801145:	e8 0a f3 ff ff       	call   800454 <_panic>
+
+0080114a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80114a:	55                   	push   %ebp
+  80114b:	89 e5                	mov    %esp,%ebp
+  80114d:	57                   	push   %edi
+  80114e:	56                   	push   %esi
+  80114f:	53                   	push   %ebx
+  801150:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801153:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  80115a:	74 22                	je     80117e <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  80115c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801161:	b8 06 00 00 00       	mov    $0x6,%eax
+  801166:	8b 55 08             	mov    0x8(%ebp),%edx
+  801169:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116c:	89 df                	mov    %ebx,%edi
+  80116e:	89 de                	mov    %ebx,%esi
+  801170:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801172:	85 c0                	test   %eax,%eax
+  801174:	7f 28                	jg     80119e <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801176:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5f                   	pop    %edi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80117e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801183:	8b 55 08             	mov    0x8(%ebp),%edx
+  801186:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801189:	b8 06 00 00 00       	mov    $0x6,%eax
+  80118e:	89 df                	mov    %ebx,%edi
+  801190:	55                   	push   %ebp
+  801191:	89 e5                	mov    %esp,%ebp
+  801193:	8d 35 9b 11 80 00    	lea    0x80119b,%esi
+  801199:	0f 34                	sysenter
+  80119b:	5d                   	pop    %ebp
+		goto out;
+  80119c:	eb d4                	jmp    801172 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119e:	83 ec 0c             	sub    $0xc,%esp
+  8011a1:	50                   	push   %eax
+  8011a2:	6a 06                	push   $0x6
+  8011a4:	68 ab 3b 80 00       	push   $0x803bab
+  8011a9:	6a 3f                	push   $0x3f
+  8011ab:	68 c8 3b 80 00       	push   $0x803bc8
+  8011b0:	e8 9f f2 ff ff       	call   800454 <_panic>
+
+008011b5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	57                   	push   %edi
+  8011b9:	56                   	push   %esi
+  8011ba:	53                   	push   %ebx
+  8011bb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011be:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8011c5:	74 22                	je     8011e9 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8011c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d7:	89 df                	mov    %ebx,%edi
+  8011d9:	89 de                	mov    %ebx,%esi
+  8011db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011dd:	85 c0                	test   %eax,%eax
+  8011df:	7f 28                	jg     801209 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011f9:	89 df                	mov    %ebx,%edi
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	8d 35 06 12 80 00    	lea    0x801206,%esi
+  801204:	0f 34                	sysenter
+  801206:	5d                   	pop    %ebp
+		goto out;
+  801207:	eb d4                	jmp    8011dd <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801209:	83 ec 0c             	sub    $0xc,%esp
+  80120c:	50                   	push   %eax
+  80120d:	6a 08                	push   $0x8
+  80120f:	68 ab 3b 80 00       	push   $0x803bab
+  801214:	6a 3f                	push   $0x3f
+  801216:	68 c8 3b 80 00       	push   $0x803bc8
+  80121b:	e8 34 f2 ff ff       	call   800454 <_panic>
+
+00801220 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	57                   	push   %edi
+  801224:	56                   	push   %esi
+  801225:	53                   	push   %ebx
+  801226:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801229:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801230:	74 22                	je     801254 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801232:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801237:	b8 09 00 00 00       	mov    $0x9,%eax
+  80123c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801242:	89 df                	mov    %ebx,%edi
+  801244:	89 de                	mov    %ebx,%esi
+  801246:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	7f 28                	jg     801274 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80124c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124f:	5b                   	pop    %ebx
+  801250:	5e                   	pop    %esi
+  801251:	5f                   	pop    %edi
+  801252:	5d                   	pop    %ebp
+  801253:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801264:	89 df                	mov    %ebx,%edi
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	8d 35 71 12 80 00    	lea    0x801271,%esi
+  80126f:	0f 34                	sysenter
+  801271:	5d                   	pop    %ebp
+		goto out;
+  801272:	eb d4                	jmp    801248 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801274:	83 ec 0c             	sub    $0xc,%esp
+  801277:	50                   	push   %eax
+  801278:	6a 09                	push   $0x9
+  80127a:	68 ab 3b 80 00       	push   $0x803bab
+  80127f:	6a 3f                	push   $0x3f
+  801281:	68 c8 3b 80 00       	push   $0x803bc8
+  801286:	e8 c9 f1 ff ff       	call   800454 <_panic>
+
+0080128b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80128b:	55                   	push   %ebp
+  80128c:	89 e5                	mov    %esp,%ebp
+  80128e:	57                   	push   %edi
+  80128f:	56                   	push   %esi
+  801290:	53                   	push   %ebx
+  801291:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801294:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  80129b:	74 22                	je     8012bf <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80129d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ad:	89 df                	mov    %ebx,%edi
+  8012af:	89 de                	mov    %ebx,%esi
+  8012b1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	7f 28                	jg     8012df <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ba:	5b                   	pop    %ebx
+  8012bb:	5e                   	pop    %esi
+  8012bc:	5f                   	pop    %edi
+  8012bd:	5d                   	pop    %ebp
+  8012be:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012cf:	89 df                	mov    %ebx,%edi
+  8012d1:	55                   	push   %ebp
+  8012d2:	89 e5                	mov    %esp,%ebp
+  8012d4:	8d 35 dc 12 80 00    	lea    0x8012dc,%esi
+  8012da:	0f 34                	sysenter
+  8012dc:	5d                   	pop    %ebp
+		goto out;
+  8012dd:	eb d4                	jmp    8012b3 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012df:	83 ec 0c             	sub    $0xc,%esp
+  8012e2:	50                   	push   %eax
+  8012e3:	6a 0a                	push   $0xa
+  8012e5:	68 ab 3b 80 00       	push   $0x803bab
+  8012ea:	6a 3f                	push   $0x3f
+  8012ec:	68 c8 3b 80 00       	push   $0x803bc8
+  8012f1:	e8 5e f1 ff ff       	call   800454 <_panic>
+
+008012f6 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8012f6:	55                   	push   %ebp
+  8012f7:	89 e5                	mov    %esp,%ebp
+  8012f9:	57                   	push   %edi
+  8012fa:	56                   	push   %esi
+  8012fb:	53                   	push   %ebx
+  8012fc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012ff:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801306:	74 22                	je     80132a <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801308:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801312:	8b 55 08             	mov    0x8(%ebp),%edx
+  801315:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801318:	89 df                	mov    %ebx,%edi
+  80131a:	89 de                	mov    %ebx,%esi
+  80131c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80131e:	85 c0                	test   %eax,%eax
+  801320:	7f 28                	jg     80134a <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801325:	5b                   	pop    %ebx
+  801326:	5e                   	pop    %esi
+  801327:	5f                   	pop    %edi
+  801328:	5d                   	pop    %ebp
+  801329:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80132a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801332:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801335:	b8 17 00 00 00       	mov    $0x17,%eax
+  80133a:	89 df                	mov    %ebx,%edi
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	8d 35 47 13 80 00    	lea    0x801347,%esi
+  801345:	0f 34                	sysenter
+  801347:	5d                   	pop    %ebp
+		goto out;
+  801348:	eb d4                	jmp    80131e <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80134a:	83 ec 0c             	sub    $0xc,%esp
+  80134d:	50                   	push   %eax
+  80134e:	6a 17                	push   $0x17
+  801350:	68 ab 3b 80 00       	push   $0x803bab
+  801355:	6a 3f                	push   $0x3f
+  801357:	68 c8 3b 80 00       	push   $0x803bc8
+  80135c:	e8 f3 f0 ff ff       	call   800454 <_panic>
+
+00801361 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801361:	55                   	push   %ebp
+  801362:	89 e5                	mov    %esp,%ebp
+  801364:	57                   	push   %edi
+  801365:	56                   	push   %esi
+  801366:	53                   	push   %ebx
+  801367:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80136a:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801371:	74 22                	je     801395 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801373:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801378:	b8 18 00 00 00       	mov    $0x18,%eax
+  80137d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801380:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801383:	89 df                	mov    %ebx,%edi
+  801385:	89 de                	mov    %ebx,%esi
+  801387:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801389:	85 c0                	test   %eax,%eax
+  80138b:	7f 28                	jg     8013b5 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80138d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801390:	5b                   	pop    %ebx
+  801391:	5e                   	pop    %esi
+  801392:	5f                   	pop    %edi
+  801393:	5d                   	pop    %ebp
+  801394:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801395:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013a5:	89 df                	mov    %ebx,%edi
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	8d 35 b2 13 80 00    	lea    0x8013b2,%esi
+  8013b0:	0f 34                	sysenter
+  8013b2:	5d                   	pop    %ebp
+		goto out;
+  8013b3:	eb d4                	jmp    801389 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b5:	83 ec 0c             	sub    $0xc,%esp
+  8013b8:	50                   	push   %eax
+  8013b9:	6a 18                	push   $0x18
+  8013bb:	68 ab 3b 80 00       	push   $0x803bab
+  8013c0:	6a 3f                	push   $0x3f
+  8013c2:	68 c8 3b 80 00       	push   $0x803bc8
+  8013c7:	e8 88 f0 ff ff       	call   800454 <_panic>
+
+008013cc <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8013cc:	55                   	push   %ebp
+  8013cd:	89 e5                	mov    %esp,%ebp
+  8013cf:	57                   	push   %edi
+  8013d0:	56                   	push   %esi
+  8013d1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013d2:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8013d9:	74 1d                	je     8013f8 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8013db:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f1:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8013f3:	5b                   	pop    %ebx
+  8013f4:	5e                   	pop    %esi
+  8013f5:	5f                   	pop    %edi
+  8013f6:	5d                   	pop    %ebp
+  8013f7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fe:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801403:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801406:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	8d 35 14 14 80 00    	lea    0x801414,%esi
+  801412:	0f 34                	sysenter
+  801414:	5d                   	pop    %ebp
+		goto out;
+  801415:	eb dc                	jmp    8013f3 <sys_ipc_try_send+0x27>
+
+00801417 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	57                   	push   %edi
+  80141b:	56                   	push   %esi
+  80141c:	53                   	push   %ebx
+  80141d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801420:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801427:	74 21                	je     80144a <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801429:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80142e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801433:	8b 55 08             	mov    0x8(%ebp),%edx
+  801436:	89 cb                	mov    %ecx,%ebx
+  801438:	89 cf                	mov    %ecx,%edi
+  80143a:	89 ce                	mov    %ecx,%esi
+  80143c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	7f 27                	jg     801469 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801445:	5b                   	pop    %ebx
+  801446:	5e                   	pop    %esi
+  801447:	5f                   	pop    %edi
+  801448:	5d                   	pop    %ebp
+  801449:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80144a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801452:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801457:	89 cb                	mov    %ecx,%ebx
+  801459:	89 cf                	mov    %ecx,%edi
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	8d 35 66 14 80 00    	lea    0x801466,%esi
+  801464:	0f 34                	sysenter
+  801466:	5d                   	pop    %ebp
+		goto out;
+  801467:	eb d5                	jmp    80143e <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801469:	83 ec 0c             	sub    $0xc,%esp
+  80146c:	50                   	push   %eax
+  80146d:	6a 0d                	push   $0xd
+  80146f:	68 ab 3b 80 00       	push   $0x803bab
+  801474:	6a 3f                	push   $0x3f
+  801476:	68 c8 3b 80 00       	push   $0x803bc8
+  80147b:	e8 d4 ef ff ff       	call   800454 <_panic>
+
+00801480 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801480:	55                   	push   %ebp
+  801481:	89 e5                	mov    %esp,%ebp
+  801483:	57                   	push   %edi
+  801484:	56                   	push   %esi
+  801485:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801486:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  80148d:	74 1b                	je     8014aa <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80148f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801494:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801499:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149f:	89 df                	mov    %ebx,%edi
+  8014a1:	89 de                	mov    %ebx,%esi
+  8014a3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8014a5:	5b                   	pop    %ebx
+  8014a6:	5e                   	pop    %esi
+  8014a7:	5f                   	pop    %edi
+  8014a8:	5d                   	pop    %ebp
+  8014a9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014ba:	89 df                	mov    %ebx,%edi
+  8014bc:	55                   	push   %ebp
+  8014bd:	89 e5                	mov    %esp,%ebp
+  8014bf:	8d 35 c7 14 80 00    	lea    0x8014c7,%esi
+  8014c5:	0f 34                	sysenter
+  8014c7:	5d                   	pop    %ebp
+		goto out;
+  8014c8:	eb db                	jmp    8014a5 <sys_ipc_recv_until+0x25>
+
+008014ca <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	57                   	push   %edi
+  8014ce:	56                   	push   %esi
+  8014cf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014d0:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8014d7:	74 19                	je     8014f2 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8014d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014de:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014e3:	89 d1                	mov    %edx,%ecx
+  8014e5:	89 d3                	mov    %edx,%ebx
+  8014e7:	89 d7                	mov    %edx,%edi
+  8014e9:	89 d6                	mov    %edx,%esi
+  8014eb:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014ed:	5b                   	pop    %ebx
+  8014ee:	5e                   	pop    %esi
+  8014ef:	5f                   	pop    %edi
+  8014f0:	5d                   	pop    %ebp
+  8014f1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014fc:	89 d1                	mov    %edx,%ecx
+  8014fe:	89 d3                	mov    %edx,%ebx
+  801500:	89 d7                	mov    %edx,%edi
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	8d 35 0d 15 80 00    	lea    0x80150d,%esi
+  80150b:	0f 34                	sysenter
+  80150d:	5d                   	pop    %ebp
+		goto out;
+  80150e:	eb dd                	jmp    8014ed <sys_time_msec+0x23>
+
+00801510 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801510:	55                   	push   %ebp
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	57                   	push   %edi
+  801514:	56                   	push   %esi
+  801515:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801516:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  80151d:	74 1a                	je     801539 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80151f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801524:	b8 10 00 00 00       	mov    $0x10,%eax
+  801529:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152c:	89 cb                	mov    %ecx,%ebx
+  80152e:	89 cf                	mov    %ecx,%edi
+  801530:	89 ce                	mov    %ecx,%esi
+  801532:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801534:	5b                   	pop    %ebx
+  801535:	5e                   	pop    %esi
+  801536:	5f                   	pop    %edi
+  801537:	5d                   	pop    %ebp
+  801538:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801539:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801541:	b8 10 00 00 00       	mov    $0x10,%eax
+  801546:	89 cb                	mov    %ecx,%ebx
+  801548:	89 cf                	mov    %ecx,%edi
+  80154a:	55                   	push   %ebp
+  80154b:	89 e5                	mov    %esp,%ebp
+  80154d:	8d 35 55 15 80 00    	lea    0x801555,%esi
+  801553:	0f 34                	sysenter
+  801555:	5d                   	pop    %ebp
+		goto out;
+  801556:	eb dc                	jmp    801534 <sys_sleep_until+0x24>
+
+00801558 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	57                   	push   %edi
+  80155c:	56                   	push   %esi
+  80155d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80155e:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801565:	74 1a                	je     801581 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801567:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80156c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801571:	8b 55 08             	mov    0x8(%ebp),%edx
+  801574:	89 cb                	mov    %ecx,%ebx
+  801576:	89 cf                	mov    %ecx,%edi
+  801578:	89 ce                	mov    %ecx,%esi
+  80157a:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80157c:	5b                   	pop    %ebx
+  80157d:	5e                   	pop    %esi
+  80157e:	5f                   	pop    %edi
+  80157f:	5d                   	pop    %ebp
+  801580:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801581:	8b 55 08             	mov    0x8(%ebp),%edx
+  801584:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801589:	b8 11 00 00 00       	mov    $0x11,%eax
+  80158e:	89 cb                	mov    %ecx,%ebx
+  801590:	89 cf                	mov    %ecx,%edi
+  801592:	55                   	push   %ebp
+  801593:	89 e5                	mov    %esp,%ebp
+  801595:	8d 35 9d 15 80 00    	lea    0x80159d,%esi
+  80159b:	0f 34                	sysenter
+  80159d:	5d                   	pop    %ebp
+		goto out;
+  80159e:	eb dc                	jmp    80157c <sys_env_print_stats+0x24>
+
+008015a0 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	57                   	push   %edi
+  8015a4:	56                   	push   %esi
+  8015a5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015a6:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8015ad:	74 1b                	je     8015ca <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8015af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015bf:	89 df                	mov    %ebx,%edi
+  8015c1:	89 de                	mov    %ebx,%esi
+  8015c3:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8015c5:	5b                   	pop    %ebx
+  8015c6:	5e                   	pop    %esi
+  8015c7:	5f                   	pop    %edi
+  8015c8:	5d                   	pop    %ebp
+  8015c9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015da:	89 df                	mov    %ebx,%edi
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	8d 35 e7 15 80 00    	lea    0x8015e7,%esi
+  8015e5:	0f 34                	sysenter
+  8015e7:	5d                   	pop    %ebp
+		goto out;
+  8015e8:	eb db                	jmp    8015c5 <sys_perf+0x25>
+
+008015ea <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8015ea:	55                   	push   %ebp
+  8015eb:	89 e5                	mov    %esp,%ebp
+  8015ed:	57                   	push   %edi
+  8015ee:	56                   	push   %esi
+  8015ef:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015f0:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8015f7:	74 19                	je     801612 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8015f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015fe:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801603:	89 d1                	mov    %edx,%ecx
+  801605:	89 d3                	mov    %edx,%ebx
+  801607:	89 d7                	mov    %edx,%edi
+  801609:	89 d6                	mov    %edx,%esi
+  80160b:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80160d:	5b                   	pop    %ebx
+  80160e:	5e                   	pop    %esi
+  80160f:	5f                   	pop    %edi
+  801610:	5d                   	pop    %ebp
+  801611:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801612:	ba 00 00 00 00       	mov    $0x0,%edx
+  801617:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80161c:	89 d1                	mov    %edx,%ecx
+  80161e:	89 d3                	mov    %edx,%ebx
+  801620:	89 d7                	mov    %edx,%edi
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	8d 35 2d 16 80 00    	lea    0x80162d,%esi
+  80162b:	0f 34                	sysenter
+  80162d:	5d                   	pop    %ebp
+		goto out;
+  80162e:	eb dd                	jmp    80160d <sys_fork+0x23>
+
+00801630 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	57                   	push   %edi
+  801634:	56                   	push   %esi
+  801635:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801636:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  80163d:	74 1c                	je     80165b <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80163f:	be 00 00 00 00       	mov    $0x0,%esi
+  801644:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801649:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801652:	89 f7                	mov    %esi,%edi
+  801654:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801656:	5b                   	pop    %ebx
+  801657:	5e                   	pop    %esi
+  801658:	5f                   	pop    %edi
+  801659:	5d                   	pop    %ebp
+  80165a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80165b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801661:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801666:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80166e:	55                   	push   %ebp
+  80166f:	89 e5                	mov    %esp,%ebp
+  801671:	8d 35 79 16 80 00    	lea    0x801679,%esi
+  801677:	0f 34                	sysenter
+  801679:	5d                   	pop    %ebp
+		goto out;
+  80167a:	eb da                	jmp    801656 <sys_thread_create+0x26>
+
+0080167c <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80167c:	55                   	push   %ebp
+  80167d:	89 e5                	mov    %esp,%ebp
+  80167f:	57                   	push   %edi
+  801680:	56                   	push   %esi
+  801681:	53                   	push   %ebx
+  801682:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801685:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  80168c:	74 24                	je     8016b2 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80168e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801693:	be 00 00 00 00       	mov    $0x0,%esi
+  801698:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016a4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016a6:	85 c0                	test   %eax,%eax
+  8016a8:	7f 27                	jg     8016d1 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8016aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ad:	5b                   	pop    %ebx
+  8016ae:	5e                   	pop    %esi
+  8016af:	5f                   	pop    %edi
+  8016b0:	5d                   	pop    %ebp
+  8016b1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8016bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016c3:	55                   	push   %ebp
+  8016c4:	89 e5                	mov    %esp,%ebp
+  8016c6:	8d 35 ce 16 80 00    	lea    0x8016ce,%esi
+  8016cc:	0f 34                	sysenter
+  8016ce:	5d                   	pop    %ebp
+		goto out;
+  8016cf:	eb d5                	jmp    8016a6 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d1:	83 ec 0c             	sub    $0xc,%esp
+  8016d4:	50                   	push   %eax
+  8016d5:	6a 1f                	push   $0x1f
+  8016d7:	68 ab 3b 80 00       	push   $0x803bab
+  8016dc:	6a 3f                	push   $0x3f
+  8016de:	68 c8 3b 80 00       	push   $0x803bc8
+  8016e3:	e8 6c ed ff ff       	call   800454 <_panic>
+
+008016e8 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8016e8:	55                   	push   %ebp
+  8016e9:	89 e5                	mov    %esp,%ebp
+  8016eb:	57                   	push   %edi
+  8016ec:	56                   	push   %esi
+  8016ed:	53                   	push   %ebx
+  8016ee:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016f1:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8016f8:	74 23                	je     80171d <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8016fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ff:	b8 20 00 00 00       	mov    $0x20,%eax
+  801704:	8b 55 08             	mov    0x8(%ebp),%edx
+  801707:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170d:	89 f7                	mov    %esi,%edi
+  80170f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801711:	85 c0                	test   %eax,%eax
+  801713:	7f 29                	jg     80173e <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801715:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801718:	5b                   	pop    %ebx
+  801719:	5e                   	pop    %esi
+  80171a:	5f                   	pop    %edi
+  80171b:	5d                   	pop    %ebp
+  80171c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80171d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801720:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801723:	b8 20 00 00 00       	mov    $0x20,%eax
+  801728:	bf 00 00 00 00       	mov    $0x0,%edi
+  80172d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801730:	55                   	push   %ebp
+  801731:	89 e5                	mov    %esp,%ebp
+  801733:	8d 35 3b 17 80 00    	lea    0x80173b,%esi
+  801739:	0f 34                	sysenter
+  80173b:	5d                   	pop    %ebp
+		goto out;
+  80173c:	eb d3                	jmp    801711 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80173e:	83 ec 0c             	sub    $0xc,%esp
+  801741:	50                   	push   %eax
+  801742:	6a 20                	push   $0x20
+  801744:	68 ab 3b 80 00       	push   $0x803bab
+  801749:	6a 3f                	push   $0x3f
+  80174b:	68 c8 3b 80 00       	push   $0x803bc8
+  801750:	e8 ff ec ff ff       	call   800454 <_panic>
+
+00801755 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	57                   	push   %edi
+  801759:	56                   	push   %esi
+  80175a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80175b:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801762:	74 1b                	je     80177f <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801764:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801769:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80176e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801771:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801774:	89 df                	mov    %ebx,%edi
+  801776:	89 de                	mov    %ebx,%esi
+  801778:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80177a:	5b                   	pop    %ebx
+  80177b:	5e                   	pop    %esi
+  80177c:	5f                   	pop    %edi
+  80177d:	5d                   	pop    %ebp
+  80177e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80177f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801784:	8b 55 08             	mov    0x8(%ebp),%edx
+  801787:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80178f:	89 df                	mov    %ebx,%edi
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	8d 35 9c 17 80 00    	lea    0x80179c,%esi
+  80179a:	0f 34                	sysenter
+  80179c:	5d                   	pop    %ebp
+		goto out;
+  80179d:	eb db                	jmp    80177a <sys_batch+0x25>
+
+0080179f <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80179f:	55                   	push   %ebp
+  8017a0:	89 e5                	mov    %esp,%ebp
+  8017a2:	57                   	push   %edi
+  8017a3:	56                   	push   %esi
+  8017a4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017a5:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8017ac:	74 1a                	je     8017c8 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8017ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bb:	89 cb                	mov    %ecx,%ebx
+  8017bd:	89 cf                	mov    %ecx,%edi
+  8017bf:	89 ce                	mov    %ecx,%esi
+  8017c1:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8017c3:	5b                   	pop    %ebx
+  8017c4:	5e                   	pop    %esi
+  8017c5:	5f                   	pop    %edi
+  8017c6:	5d                   	pop    %ebp
+  8017c7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017d0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017d5:	89 cb                	mov    %ecx,%ebx
+  8017d7:	89 cf                	mov    %ecx,%edi
+  8017d9:	55                   	push   %ebp
+  8017da:	89 e5                	mov    %esp,%ebp
+  8017dc:	8d 35 e4 17 80 00    	lea    0x8017e4,%esi
+  8017e2:	0f 34                	sysenter
+  8017e4:	5d                   	pop    %ebp
+		goto out;
+  8017e5:	eb dc                	jmp    8017c3 <sys_trace_ctl+0x24>
+
+008017e7 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	57                   	push   %edi
+  8017eb:	56                   	push   %esi
+  8017ec:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ed:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8017f4:	74 1c                	je     801812 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8017f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801800:	8b 55 08             	mov    0x8(%ebp),%edx
+  801803:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801806:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801809:	89 f7                	mov    %esi,%edi
+  80180b:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80180d:	5b                   	pop    %ebx
+  80180e:	5e                   	pop    %esi
+  80180f:	5f                   	pop    %edi
+  801810:	5d                   	pop    %ebp
+  801811:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801812:	8b 55 08             	mov    0x8(%ebp),%edx
+  801815:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801818:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80181d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801822:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801825:	55                   	push   %ebp
+  801826:	89 e5                	mov    %esp,%ebp
+  801828:	8d 35 30 18 80 00    	lea    0x801830,%esi
+  80182e:	0f 34                	sysenter
+  801830:	5d                   	pop    %ebp
+		goto out;
+  801831:	eb da                	jmp    80180d <sys_trace_read+0x26>
+
+00801833 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801833:	55                   	push   %ebp
+  801834:	89 e5                	mov    %esp,%ebp
+  801836:	57                   	push   %edi
+  801837:	56                   	push   %esi
+  801838:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801839:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801840:	74 1c                	je     80185e <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801842:	be 00 00 00 00       	mov    $0x0,%esi
+  801847:	b8 21 00 00 00       	mov    $0x21,%eax
+  80184c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801852:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801855:	89 f7                	mov    %esi,%edi
+  801857:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801859:	5b                   	pop    %ebx
+  80185a:	5e                   	pop    %esi
+  80185b:	5f                   	pop    %edi
+  80185c:	5d                   	pop    %ebp
+  80185d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80185e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801861:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801864:	b8 21 00 00 00       	mov    $0x21,%eax
+  801869:	bf 00 00 00 00       	mov    $0x0,%edi
+  80186e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801871:	55                   	push   %ebp
+  801872:	89 e5                	mov    %esp,%ebp
+  801874:	8d 35 7c 18 80 00    	lea    0x80187c,%esi
+  80187a:	0f 34                	sysenter
+  80187c:	5d                   	pop    %ebp
+		goto out;
+  80187d:	eb da                	jmp    801859 <sys_meminfo+0x26>
+
+0080187f <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80187f:	55                   	push   %ebp
+  801880:	89 e5                	mov    %esp,%ebp
+  801882:	57                   	push   %edi
+  801883:	56                   	push   %esi
+  801884:	53                   	push   %ebx
+  801885:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801888:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80188c:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801893:	74 1f                	je     8018b4 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801895:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189a:	b8 22 00 00 00       	mov    $0x22,%eax
+  80189f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a2:	89 df                	mov    %ebx,%edi
+  8018a4:	89 de                	mov    %ebx,%esi
+  8018a6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018a8:	85 c0                	test   %eax,%eax
+  8018aa:	7f 25                	jg     8018d1 <sys_env_set_ksm+0x52>
+}
+  8018ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018af:	5b                   	pop    %ebx
+  8018b0:	5e                   	pop    %esi
+  8018b1:	5f                   	pop    %edi
+  8018b2:	5d                   	pop    %ebp
+  8018b3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018bc:	b8 22 00 00 00       	mov    $0x22,%eax
+  8018c1:	89 df                	mov    %ebx,%edi
+  8018c3:	55                   	push   %ebp
+  8018c4:	89 e5                	mov    %esp,%ebp
+  8018c6:	8d 35 ce 18 80 00    	lea    0x8018ce,%esi
+  8018cc:	0f 34                	sysenter
+  8018ce:	5d                   	pop    %ebp
+		goto out;
+  8018cf:	eb d7                	jmp    8018a8 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018d1:	83 ec 0c             	sub    $0xc,%esp
+  8018d4:	50                   	push   %eax
+  8018d5:	6a 22                	push   $0x22
+  8018d7:	68 ab 3b 80 00       	push   $0x803bab
+  8018dc:	6a 3f                	push   $0x3f
+  8018de:	68 c8 3b 80 00       	push   $0x803bc8
+  8018e3:	e8 6c eb ff ff       	call   800454 <_panic>
+
+008018e8 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8018e8:	55                   	push   %ebp
+  8018e9:	89 e5                	mov    %esp,%ebp
+  8018eb:	57                   	push   %edi
+  8018ec:	56                   	push   %esi
+  8018ed:	53                   	push   %ebx
+  8018ee:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8018f1:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8018f4:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8018fb:	74 24                	je     801921 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8018fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801902:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801907:	89 cb                	mov    %ecx,%ebx
+  801909:	89 cf                	mov    %ecx,%edi
+  80190b:	89 ce                	mov    %ecx,%esi
+  80190d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	7f 2a                	jg     80193d <sys_time_nsec+0x55>
+	return ns;
+}
+  801913:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801916:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801919:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80191c:	5b                   	pop    %ebx
+  80191d:	5e                   	pop    %esi
+  80191e:	5f                   	pop    %edi
+  80191f:	5d                   	pop    %ebp
+  801920:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801921:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801926:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80192b:	89 cb                	mov    %ecx,%ebx
+  80192d:	89 cf                	mov    %ecx,%edi
+  80192f:	55                   	push   %ebp
+  801930:	89 e5                	mov    %esp,%ebp
+  801932:	8d 35 3a 19 80 00    	lea    0x80193a,%esi
+  801938:	0f 34                	sysenter
+  80193a:	5d                   	pop    %ebp
+		goto out;
+  80193b:	eb d2                	jmp    80190f <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80193d:	83 ec 0c             	sub    $0xc,%esp
+  801940:	50                   	push   %eax
+  801941:	6a 0f                	push   $0xf
+  801943:	68 ab 3b 80 00       	push   $0x803bab
+  801948:	6a 3f                	push   $0x3f
+  80194a:	68 c8 3b 80 00       	push   $0x803bc8
+  80194f:	e8 00 eb ff ff       	call   800454 <_panic>
+
+00801954 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801954:	55                   	push   %ebp
+  801955:	89 e5                	mov    %esp,%ebp
+  801957:	57                   	push   %edi
+  801958:	56                   	push   %esi
+  801959:	53                   	push   %ebx
+  80195a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80195d:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801964:	74 22                	je     801988 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801966:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801970:	8b 55 08             	mov    0x8(%ebp),%edx
+  801973:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801976:	89 df                	mov    %ebx,%edi
+  801978:	89 de                	mov    %ebx,%esi
+  80197a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	7f 28                	jg     8019a8 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801983:	5b                   	pop    %ebx
+  801984:	5e                   	pop    %esi
+  801985:	5f                   	pop    %edi
+  801986:	5d                   	pop    %ebp
+  801987:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801988:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801990:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801993:	b8 12 00 00 00       	mov    $0x12,%eax
+  801998:	89 df                	mov    %ebx,%edi
+  80199a:	55                   	push   %ebp
+  80199b:	89 e5                	mov    %esp,%ebp
+  80199d:	8d 35 a5 19 80 00    	lea    0x8019a5,%esi
+  8019a3:	0f 34                	sysenter
+  8019a5:	5d                   	pop    %ebp
+		goto out;
+  8019a6:	eb d4                	jmp    80197c <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019a8:	83 ec 0c             	sub    $0xc,%esp
+  8019ab:	50                   	push   %eax
+  8019ac:	6a 12                	push   $0x12
+  8019ae:	68 ab 3b 80 00       	push   $0x803bab
+  8019b3:	6a 3f                	push   $0x3f
+  8019b5:	68 c8 3b 80 00       	push   $0x803bc8
+  8019ba:	e8 95 ea ff ff       	call   800454 <_panic>
+
+008019bf <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8019bf:	55                   	push   %ebp
+  8019c0:	89 e5                	mov    %esp,%ebp
+  8019c2:	57                   	push   %edi
+  8019c3:	56                   	push   %esi
+  8019c4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019c5:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  8019cc:	74 1b                	je     8019e9 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8019ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019de:	89 df                	mov    %ebx,%edi
+  8019e0:	89 de                	mov    %ebx,%esi
+  8019e2:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8019e4:	5b                   	pop    %ebx
+  8019e5:	5e                   	pop    %esi
+  8019e6:	5f                   	pop    %edi
+  8019e7:	5d                   	pop    %ebp
+  8019e8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f4:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019f9:	89 df                	mov    %ebx,%edi
+  8019fb:	55                   	push   %ebp
+  8019fc:	89 e5                	mov    %esp,%ebp
+  8019fe:	8d 35 06 1a 80 00    	lea    0x801a06,%esi
+  801a04:	0f 34                	sysenter
+  801a06:	5d                   	pop    %ebp
+		goto out;
+  801a07:	eb db                	jmp    8019e4 <sys_e1000_receive+0x25>
+
+00801a09 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801a09:	55                   	push   %ebp
+  801a0a:	89 e5                	mov    %esp,%ebp
+  801a0c:	57                   	push   %edi
+  801a0d:	56                   	push   %esi
+  801a0e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a0f:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801a16:	74 1b                	je     801a33 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801a18:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801a22:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a28:	89 df                	mov    %ebx,%edi
+  801a2a:	89 de                	mov    %ebx,%esi
+  801a2c:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801a2e:	5b                   	pop    %ebx
+  801a2f:	5e                   	pop    %esi
+  801a30:	5f                   	pop    %edi
+  801a31:	5d                   	pop    %ebp
+  801a32:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a38:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a3e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801a43:	89 df                	mov    %ebx,%edi
+  801a45:	55                   	push   %ebp
+  801a46:	89 e5                	mov    %esp,%ebp
+  801a48:	8d 35 50 1a 80 00    	lea    0x801a50,%esi
+  801a4e:	0f 34                	sysenter
+  801a50:	5d                   	pop    %ebp
+		goto out;
+  801a51:	eb db                	jmp    801a2e <sys_e1000_read_hwaddr+0x25>
+
+00801a53 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801a53:	55                   	push   %ebp
+  801a54:	89 e5                	mov    %esp,%ebp
+  801a56:	57                   	push   %edi
+  801a57:	56                   	push   %esi
+  801a58:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a59:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801a60:	74 1a                	je     801a7c <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801a62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a67:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a6f:	89 cb                	mov    %ecx,%ebx
+  801a71:	89 cf                	mov    %ecx,%edi
+  801a73:	89 ce                	mov    %ecx,%esi
+  801a75:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801a77:	5b                   	pop    %ebx
+  801a78:	5e                   	pop    %esi
+  801a79:	5f                   	pop    %edi
+  801a7a:	5d                   	pop    %ebp
+  801a7b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a84:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a89:	89 cb                	mov    %ecx,%ebx
+  801a8b:	89 cf                	mov    %ecx,%edi
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	8d 35 98 1a 80 00    	lea    0x801a98,%esi
+  801a96:	0f 34                	sysenter
+  801a98:	5d                   	pop    %ebp
+		goto out;
+  801a99:	eb dc                	jmp    801a77 <sys_sb16_read_version+0x24>
+
+00801a9b <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	57                   	push   %edi
+  801a9f:	56                   	push   %esi
+  801aa0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801aa1:	80 3d 94 77 80 00 00 	cmpb   $0x0,0x807794
+  801aa8:	74 1b                	je     801ac5 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801aaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aaf:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ab4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aba:	89 df                	mov    %ebx,%edi
+  801abc:	89 de                	mov    %ebx,%esi
+  801abe:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801ac0:	5b                   	pop    %ebx
+  801ac1:	5e                   	pop    %esi
+  801ac2:	5f                   	pop    %edi
+  801ac3:	5d                   	pop    %ebp
+  801ac4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ac5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aca:	8b 55 08             	mov    0x8(%ebp),%edx
+  801acd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad0:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ad5:	89 df                	mov    %ebx,%edi
+  801ad7:	55                   	push   %ebp
+  801ad8:	89 e5                	mov    %esp,%ebp
+  801ada:	8d 35 e2 1a 80 00    	lea    0x801ae2,%esi
+  801ae0:	0f 34                	sysenter
+  801ae2:	5d                   	pop    %ebp
+		goto out;
+  801ae3:	eb db                	jmp    801ac0 <sys_sb16_play+0x25>
+
+00801ae5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801ae5:	55                   	push   %ebp
+  801ae6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aeb:	05 00 00 00 30       	add    $0x30000000,%eax
+  801af0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801af3:	5d                   	pop    %ebp
+  801af4:	c3                   	ret
+
+00801af5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801af5:	55                   	push   %ebp
+  801af6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801afb:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801b00:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b05:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801b0a:	5d                   	pop    %ebp
+  801b0b:	c3                   	ret
+
+00801b0c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b0c:	55                   	push   %ebp
+  801b0d:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801b0f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801b14:	eb 02                	jmp    801b18 <fd_alloc+0xc>
+  801b16:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801b18:	89 c2                	mov    %eax,%edx
+  801b1a:	c1 ea 16             	shr    $0x16,%edx
+  801b1d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b24:	f6 c2 01             	test   $0x1,%dl
+  801b27:	74 2b                	je     801b54 <fd_alloc+0x48>
+  801b29:	89 c2                	mov    %eax,%edx
+  801b2b:	c1 ea 0c             	shr    $0xc,%edx
+  801b2e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801b35:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801b3b:	f6 c1 01             	test   $0x1,%cl
+  801b3e:	74 14                	je     801b54 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801b40:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801b46:	75 ce                	jne    801b16 <fd_alloc+0xa>
+  801b48:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801b4d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b52:	eb 05                	jmp    801b59 <fd_alloc+0x4d>
+			return 0;
+  801b54:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801b59:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b5c:	89 02                	mov    %eax,(%edx)
+}
+  801b5e:	89 c8                	mov    %ecx,%eax
+  801b60:	5d                   	pop    %ebp
+  801b61:	c3                   	ret
+
+00801b62 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801b62:	55                   	push   %ebp
+  801b63:	89 e5                	mov    %esp,%ebp
+  801b65:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801b68:	83 f8 1f             	cmp    $0x1f,%eax
+  801b6b:	77 30                	ja     801b9d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801b6d:	c1 e0 0c             	shl    $0xc,%eax
+  801b70:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801b75:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b7b:	f6 c2 01             	test   $0x1,%dl
+  801b7e:	74 24                	je     801ba4 <fd_lookup+0x42>
+  801b80:	89 c2                	mov    %eax,%edx
+  801b82:	c1 ea 0c             	shr    $0xc,%edx
+  801b85:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b8c:	f6 c2 01             	test   $0x1,%dl
+  801b8f:	74 1a                	je     801bab <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b91:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b94:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b9b:	5d                   	pop    %ebp
+  801b9c:	c3                   	ret
+		return -E_INVAL;
+  801b9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba2:	eb f7                	jmp    801b9b <fd_lookup+0x39>
+		return -E_INVAL;
+  801ba4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ba9:	eb f0                	jmp    801b9b <fd_lookup+0x39>
+  801bab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bb0:	eb e9                	jmp    801b9b <fd_lookup+0x39>
+
+00801bb2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801bb2:	55                   	push   %ebp
+  801bb3:	89 e5                	mov    %esp,%ebp
+  801bb5:	53                   	push   %ebx
+  801bb6:	83 ec 04             	sub    $0x4,%esp
+  801bb9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc1:	eb 03                	jmp    801bc6 <dev_lookup+0x14>
+  801bc3:	83 c0 01             	add    $0x1,%eax
+  801bc6:	8b 1c 85 54 3c 80 00 	mov    0x803c54(,%eax,4),%ebx
+  801bcd:	85 db                	test   %ebx,%ebx
+  801bcf:	74 0b                	je     801bdc <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801bd1:	39 13                	cmp    %edx,(%ebx)
+  801bd3:	75 ee                	jne    801bc3 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bda:	eb 2e                	jmp    801c0a <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801bdc:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bde:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801be3:	8b 0d 90 77 80 00    	mov    0x807790,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801be9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bee:	76 24                	jbe    801c14 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bf0:	8b 41 48             	mov    0x48(%ecx),%eax
+  801bf3:	83 ec 04             	sub    $0x4,%esp
+  801bf6:	52                   	push   %edx
+  801bf7:	50                   	push   %eax
+  801bf8:	68 d8 3b 80 00       	push   $0x803bd8
+  801bfd:	e8 2d e9 ff ff       	call   80052f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801c02:	83 c4 10             	add    $0x10,%esp
+  801c05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801c0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c0d:	89 1a                	mov    %ebx,(%edx)
+}
+  801c0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c12:	c9                   	leave
+  801c13:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c14:	c1 e8 10             	shr    $0x10,%eax
+  801c17:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c1d:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801c23:	eb cb                	jmp    801bf0 <dev_lookup+0x3e>
+
+00801c25 <fd_close>:
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	57                   	push   %edi
+  801c29:	56                   	push   %esi
+  801c2a:	53                   	push   %ebx
+  801c2b:	83 ec 24             	sub    $0x24,%esp
+  801c2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c31:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c34:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c37:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c38:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c3e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c41:	50                   	push   %eax
+  801c42:	e8 1b ff ff ff       	call   801b62 <fd_lookup>
+  801c47:	89 c3                	mov    %eax,%ebx
+  801c49:	83 c4 10             	add    $0x10,%esp
+  801c4c:	85 c0                	test   %eax,%eax
+  801c4e:	78 05                	js     801c55 <fd_close+0x30>
+	    || fd != fd2)
+  801c50:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c53:	74 16                	je     801c6b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801c55:	89 f8                	mov    %edi,%eax
+  801c57:	84 c0                	test   %al,%al
+  801c59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801c61:	89 d8                	mov    %ebx,%eax
+  801c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c66:	5b                   	pop    %ebx
+  801c67:	5e                   	pop    %esi
+  801c68:	5f                   	pop    %edi
+  801c69:	5d                   	pop    %ebp
+  801c6a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c6b:	83 ec 08             	sub    $0x8,%esp
+  801c6e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c71:	50                   	push   %eax
+  801c72:	ff 36                	push   (%esi)
+  801c74:	e8 39 ff ff ff       	call   801bb2 <dev_lookup>
+  801c79:	89 c3                	mov    %eax,%ebx
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	78 1a                	js     801c9c <fd_close+0x77>
+		if (dev->dev_close)
+  801c82:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c85:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801c88:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801c8d:	85 c0                	test   %eax,%eax
+  801c8f:	74 0b                	je     801c9c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801c91:	83 ec 0c             	sub    $0xc,%esp
+  801c94:	56                   	push   %esi
+  801c95:	ff d0                	call   *%eax
+  801c97:	89 c3                	mov    %eax,%ebx
+  801c99:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801c9c:	83 ec 08             	sub    $0x8,%esp
+  801c9f:	56                   	push   %esi
+  801ca0:	6a 00                	push   $0x0
+  801ca2:	e8 a3 f4 ff ff       	call   80114a <sys_page_unmap>
+	return r;
+  801ca7:	83 c4 10             	add    $0x10,%esp
+  801caa:	eb b5                	jmp    801c61 <fd_close+0x3c>
+
+00801cac <close>:
+
+int
+close(int fdnum)
+{
+  801cac:	55                   	push   %ebp
+  801cad:	89 e5                	mov    %esp,%ebp
+  801caf:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cb2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb5:	50                   	push   %eax
+  801cb6:	ff 75 08             	push   0x8(%ebp)
+  801cb9:	e8 a4 fe ff ff       	call   801b62 <fd_lookup>
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	79 02                	jns    801cc7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801cc5:	c9                   	leave
+  801cc6:	c3                   	ret
+		return fd_close(fd, 1);
+  801cc7:	83 ec 08             	sub    $0x8,%esp
+  801cca:	6a 01                	push   $0x1
+  801ccc:	ff 75 f4             	push   -0xc(%ebp)
+  801ccf:	e8 51 ff ff ff       	call   801c25 <fd_close>
+  801cd4:	83 c4 10             	add    $0x10,%esp
+  801cd7:	eb ec                	jmp    801cc5 <close+0x19>
+
+00801cd9 <close_all>:
+
+void
+close_all(void)
+{
+  801cd9:	55                   	push   %ebp
+  801cda:	89 e5                	mov    %esp,%ebp
+  801cdc:	53                   	push   %ebx
+  801cdd:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801ce0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801ce5:	83 ec 0c             	sub    $0xc,%esp
+  801ce8:	53                   	push   %ebx
+  801ce9:	e8 be ff ff ff       	call   801cac <close>
+	for (i = 0; i < MAXFD; i++)
+  801cee:	83 c3 01             	add    $0x1,%ebx
+  801cf1:	83 c4 10             	add    $0x10,%esp
+  801cf4:	83 fb 20             	cmp    $0x20,%ebx
+  801cf7:	75 ec                	jne    801ce5 <close_all+0xc>
+}
+  801cf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cfc:	c9                   	leave
+  801cfd:	c3                   	ret
+
+00801cfe <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	57                   	push   %edi
+  801d02:	56                   	push   %esi
+  801d03:	53                   	push   %ebx
+  801d04:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d07:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d0a:	50                   	push   %eax
+  801d0b:	ff 75 08             	push   0x8(%ebp)
+  801d0e:	e8 4f fe ff ff       	call   801b62 <fd_lookup>
+  801d13:	89 c3                	mov    %eax,%ebx
+  801d15:	83 c4 10             	add    $0x10,%esp
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	78 7f                	js     801d9b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801d1c:	83 ec 0c             	sub    $0xc,%esp
+  801d1f:	ff 75 0c             	push   0xc(%ebp)
+  801d22:	e8 85 ff ff ff       	call   801cac <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801d27:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d2a:	c1 e6 0c             	shl    $0xc,%esi
+  801d2d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801d33:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d36:	89 3c 24             	mov    %edi,(%esp)
+  801d39:	e8 b7 fd ff ff       	call   801af5 <fd2data>
+  801d3e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801d40:	89 34 24             	mov    %esi,(%esp)
+  801d43:	e8 ad fd ff ff       	call   801af5 <fd2data>
+  801d48:	83 c4 10             	add    $0x10,%esp
+  801d4b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801d4e:	89 d8                	mov    %ebx,%eax
+  801d50:	c1 e8 16             	shr    $0x16,%eax
+  801d53:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d5a:	a8 01                	test   $0x1,%al
+  801d5c:	74 11                	je     801d6f <dup+0x71>
+  801d5e:	89 d8                	mov    %ebx,%eax
+  801d60:	c1 e8 0c             	shr    $0xc,%eax
+  801d63:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d6a:	f6 c2 01             	test   $0x1,%dl
+  801d6d:	75 36                	jne    801da5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d6f:	89 f8                	mov    %edi,%eax
+  801d71:	c1 e8 0c             	shr    $0xc,%eax
+  801d74:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d7b:	83 ec 0c             	sub    $0xc,%esp
+  801d7e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d83:	50                   	push   %eax
+  801d84:	56                   	push   %esi
+  801d85:	6a 00                	push   $0x0
+  801d87:	57                   	push   %edi
+  801d88:	6a 00                	push   $0x0
+  801d8a:	e8 4d f3 ff ff       	call   8010dc <sys_page_map>
+  801d8f:	89 c3                	mov    %eax,%ebx
+  801d91:	83 c4 20             	add    $0x20,%esp
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	78 33                	js     801dcb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801d98:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801d9b:	89 d8                	mov    %ebx,%eax
+  801d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da0:	5b                   	pop    %ebx
+  801da1:	5e                   	pop    %esi
+  801da2:	5f                   	pop    %edi
+  801da3:	5d                   	pop    %ebp
+  801da4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801da5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801dac:	83 ec 0c             	sub    $0xc,%esp
+  801daf:	25 07 0e 00 00       	and    $0xe07,%eax
+  801db4:	50                   	push   %eax
+  801db5:	ff 75 d4             	push   -0x2c(%ebp)
+  801db8:	6a 00                	push   $0x0
+  801dba:	53                   	push   %ebx
+  801dbb:	6a 00                	push   $0x0
+  801dbd:	e8 1a f3 ff ff       	call   8010dc <sys_page_map>
+  801dc2:	89 c3                	mov    %eax,%ebx
+  801dc4:	83 c4 20             	add    $0x20,%esp
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	79 a4                	jns    801d6f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801dcb:	83 ec 08             	sub    $0x8,%esp
+  801dce:	56                   	push   %esi
+  801dcf:	6a 00                	push   $0x0
+  801dd1:	e8 74 f3 ff ff       	call   80114a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801dd6:	83 c4 08             	add    $0x8,%esp
+  801dd9:	ff 75 d4             	push   -0x2c(%ebp)
+  801ddc:	6a 00                	push   $0x0
+  801dde:	e8 67 f3 ff ff       	call   80114a <sys_page_unmap>
+	return r;
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	eb b3                	jmp    801d9b <dup+0x9d>
+
+00801de8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	56                   	push   %esi
+  801dec:	53                   	push   %ebx
+  801ded:	83 ec 18             	sub    $0x18,%esp
+  801df0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801df3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801df6:	50                   	push   %eax
+  801df7:	53                   	push   %ebx
+  801df8:	e8 65 fd ff ff       	call   801b62 <fd_lookup>
+  801dfd:	83 c4 10             	add    $0x10,%esp
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	78 3c                	js     801e40 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e04:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e07:	83 ec 08             	sub    $0x8,%esp
+  801e0a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e0d:	50                   	push   %eax
+  801e0e:	ff 36                	push   (%esi)
+  801e10:	e8 9d fd ff ff       	call   801bb2 <dev_lookup>
+  801e15:	83 c4 10             	add    $0x10,%esp
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	78 24                	js     801e40 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e1c:	8b 46 08             	mov    0x8(%esi),%eax
+  801e1f:	83 e0 03             	and    $0x3,%eax
+  801e22:	83 f8 01             	cmp    $0x1,%eax
+  801e25:	74 20                	je     801e47 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801e27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e2a:	8b 40 08             	mov    0x8(%eax),%eax
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	74 57                	je     801e88 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e31:	83 ec 04             	sub    $0x4,%esp
+  801e34:	ff 75 10             	push   0x10(%ebp)
+  801e37:	ff 75 0c             	push   0xc(%ebp)
+  801e3a:	56                   	push   %esi
+  801e3b:	ff d0                	call   *%eax
+  801e3d:	83 c4 10             	add    $0x10,%esp
+}
+  801e40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e43:	5b                   	pop    %ebx
+  801e44:	5e                   	pop    %esi
+  801e45:	5d                   	pop    %ebp
+  801e46:	c3                   	ret
+  801e47:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e49:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e4e:	8b 15 90 77 80 00    	mov    0x807790,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e54:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e59:	76 1c                	jbe    801e77 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e5b:	8b 42 48             	mov    0x48(%edx),%eax
+  801e5e:	83 ec 04             	sub    $0x4,%esp
+  801e61:	53                   	push   %ebx
+  801e62:	50                   	push   %eax
+  801e63:	68 19 3c 80 00       	push   $0x803c19
+  801e68:	e8 c2 e6 ff ff       	call   80052f <cprintf>
+		return -E_INVAL;
+  801e6d:	83 c4 10             	add    $0x10,%esp
+  801e70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e75:	eb c9                	jmp    801e40 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e77:	c1 e8 10             	shr    $0x10,%eax
+  801e7a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e80:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e86:	eb d3                	jmp    801e5b <read+0x73>
+		return -E_NOT_SUPP;
+  801e88:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e8d:	eb b1                	jmp    801e40 <read+0x58>
+
+00801e8f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e8f:	55                   	push   %ebp
+  801e90:	89 e5                	mov    %esp,%ebp
+  801e92:	57                   	push   %edi
+  801e93:	56                   	push   %esi
+  801e94:	53                   	push   %ebx
+  801e95:	83 ec 0c             	sub    $0xc,%esp
+  801e98:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e9b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801e9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea3:	eb 02                	jmp    801ea7 <readn+0x18>
+  801ea5:	01 c3                	add    %eax,%ebx
+  801ea7:	39 f3                	cmp    %esi,%ebx
+  801ea9:	73 21                	jae    801ecc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801eab:	83 ec 04             	sub    $0x4,%esp
+  801eae:	89 f0                	mov    %esi,%eax
+  801eb0:	29 d8                	sub    %ebx,%eax
+  801eb2:	50                   	push   %eax
+  801eb3:	89 d8                	mov    %ebx,%eax
+  801eb5:	03 45 0c             	add    0xc(%ebp),%eax
+  801eb8:	50                   	push   %eax
+  801eb9:	57                   	push   %edi
+  801eba:	e8 29 ff ff ff       	call   801de8 <read>
+		if (m < 0)
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 04                	js     801eca <readn+0x3b>
+			return m;
+		if (m == 0)
+  801ec6:	75 dd                	jne    801ea5 <readn+0x16>
+  801ec8:	eb 02                	jmp    801ecc <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801eca:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801ecc:	89 d8                	mov    %ebx,%eax
+  801ece:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed1:	5b                   	pop    %ebx
+  801ed2:	5e                   	pop    %esi
+  801ed3:	5f                   	pop    %edi
+  801ed4:	5d                   	pop    %ebp
+  801ed5:	c3                   	ret
+
+00801ed6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801ed6:	55                   	push   %ebp
+  801ed7:	89 e5                	mov    %esp,%ebp
+  801ed9:	56                   	push   %esi
+  801eda:	53                   	push   %ebx
+  801edb:	83 ec 18             	sub    $0x18,%esp
+  801ede:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ee1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ee4:	50                   	push   %eax
+  801ee5:	53                   	push   %ebx
+  801ee6:	e8 77 fc ff ff       	call   801b62 <fd_lookup>
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	85 c0                	test   %eax,%eax
+  801ef0:	78 37                	js     801f29 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ef2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ef5:	83 ec 08             	sub    $0x8,%esp
+  801ef8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801efb:	50                   	push   %eax
+  801efc:	ff 36                	push   (%esi)
+  801efe:	e8 af fc ff ff       	call   801bb2 <dev_lookup>
+  801f03:	83 c4 10             	add    $0x10,%esp
+  801f06:	85 c0                	test   %eax,%eax
+  801f08:	78 1f                	js     801f29 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f0a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f0e:	74 20                	je     801f30 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801f10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f13:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	74 57                	je     801f71 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801f1a:	83 ec 04             	sub    $0x4,%esp
+  801f1d:	ff 75 10             	push   0x10(%ebp)
+  801f20:	ff 75 0c             	push   0xc(%ebp)
+  801f23:	56                   	push   %esi
+  801f24:	ff d0                	call   *%eax
+  801f26:	83 c4 10             	add    $0x10,%esp
+}
+  801f29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2c:	5b                   	pop    %ebx
+  801f2d:	5e                   	pop    %esi
+  801f2e:	5d                   	pop    %ebp
+  801f2f:	c3                   	ret
+  801f30:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801f32:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801f37:	8b 15 90 77 80 00    	mov    0x807790,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801f3d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801f42:	76 1c                	jbe    801f60 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f44:	8b 42 48             	mov    0x48(%edx),%eax
+  801f47:	83 ec 04             	sub    $0x4,%esp
+  801f4a:	53                   	push   %ebx
+  801f4b:	50                   	push   %eax
+  801f4c:	68 35 3c 80 00       	push   $0x803c35
+  801f51:	e8 d9 e5 ff ff       	call   80052f <cprintf>
+		return -E_INVAL;
+  801f56:	83 c4 10             	add    $0x10,%esp
+  801f59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f5e:	eb c9                	jmp    801f29 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801f60:	c1 e8 10             	shr    $0x10,%eax
+  801f63:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f69:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f6f:	eb d3                	jmp    801f44 <write+0x6e>
+		return -E_NOT_SUPP;
+  801f71:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f76:	eb b1                	jmp    801f29 <write+0x53>
+
+00801f78 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f81:	50                   	push   %eax
+  801f82:	ff 75 08             	push   0x8(%ebp)
+  801f85:	e8 d8 fb ff ff       	call   801b62 <fd_lookup>
+  801f8a:	83 c4 10             	add    $0x10,%esp
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	78 0e                	js     801f9f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801f91:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f97:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f9f:	c9                   	leave
+  801fa0:	c3                   	ret
+
+00801fa1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801fa1:	55                   	push   %ebp
+  801fa2:	89 e5                	mov    %esp,%ebp
+  801fa4:	56                   	push   %esi
+  801fa5:	53                   	push   %ebx
+  801fa6:	83 ec 18             	sub    $0x18,%esp
+  801fa9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801faf:	50                   	push   %eax
+  801fb0:	53                   	push   %ebx
+  801fb1:	e8 ac fb ff ff       	call   801b62 <fd_lookup>
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	78 34                	js     801ff1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fbd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fc0:	83 ec 08             	sub    $0x8,%esp
+  801fc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc6:	50                   	push   %eax
+  801fc7:	ff 36                	push   (%esi)
+  801fc9:	e8 e4 fb ff ff       	call   801bb2 <dev_lookup>
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 1c                	js     801ff1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fd5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fd9:	74 1d                	je     801ff8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801fdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fde:	8b 40 18             	mov    0x18(%eax),%eax
+  801fe1:	85 c0                	test   %eax,%eax
+  801fe3:	74 54                	je     802039 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801fe5:	83 ec 08             	sub    $0x8,%esp
+  801fe8:	ff 75 0c             	push   0xc(%ebp)
+  801feb:	56                   	push   %esi
+  801fec:	ff d0                	call   *%eax
+  801fee:	83 c4 10             	add    $0x10,%esp
+}
+  801ff1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff4:	5b                   	pop    %ebx
+  801ff5:	5e                   	pop    %esi
+  801ff6:	5d                   	pop    %ebp
+  801ff7:	c3                   	ret
+  801ff8:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ffa:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801fff:	8b 15 90 77 80 00    	mov    0x807790,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802005:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80200a:	76 1c                	jbe    802028 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  80200c:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80200f:	83 ec 04             	sub    $0x4,%esp
+  802012:	53                   	push   %ebx
+  802013:	50                   	push   %eax
+  802014:	68 f8 3b 80 00       	push   $0x803bf8
+  802019:	e8 11 e5 ff ff       	call   80052f <cprintf>
+		return -E_INVAL;
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802026:	eb c9                	jmp    801ff1 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802028:	c1 e8 10             	shr    $0x10,%eax
+  80202b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802031:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802037:	eb d3                	jmp    80200c <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802039:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80203e:	eb b1                	jmp    801ff1 <ftruncate+0x50>
+
+00802040 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802040:	55                   	push   %ebp
+  802041:	89 e5                	mov    %esp,%ebp
+  802043:	56                   	push   %esi
+  802044:	53                   	push   %ebx
+  802045:	83 ec 18             	sub    $0x18,%esp
+  802048:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80204b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80204e:	50                   	push   %eax
+  80204f:	ff 75 08             	push   0x8(%ebp)
+  802052:	e8 0b fb ff ff       	call   801b62 <fd_lookup>
+  802057:	83 c4 10             	add    $0x10,%esp
+  80205a:	85 c0                	test   %eax,%eax
+  80205c:	78 49                	js     8020a7 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80205e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802061:	83 ec 08             	sub    $0x8,%esp
+  802064:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802067:	50                   	push   %eax
+  802068:	ff 36                	push   (%esi)
+  80206a:	e8 43 fb ff ff       	call   801bb2 <dev_lookup>
+  80206f:	83 c4 10             	add    $0x10,%esp
+  802072:	85 c0                	test   %eax,%eax
+  802074:	78 31                	js     8020a7 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802076:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802079:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80207d:	74 2f                	je     8020ae <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80207f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802082:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802089:	00 00 00 
+	stat->st_isdir = 0;
+  80208c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802093:	00 00 00 
+	stat->st_dev = dev;
+  802096:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80209c:	83 ec 08             	sub    $0x8,%esp
+  80209f:	53                   	push   %ebx
+  8020a0:	56                   	push   %esi
+  8020a1:	ff 50 14             	call   *0x14(%eax)
+  8020a4:	83 c4 10             	add    $0x10,%esp
+}
+  8020a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020aa:	5b                   	pop    %ebx
+  8020ab:	5e                   	pop    %esi
+  8020ac:	5d                   	pop    %ebp
+  8020ad:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020ae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020b3:	eb f2                	jmp    8020a7 <fstat+0x67>
+
+008020b5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8020b5:	55                   	push   %ebp
+  8020b6:	89 e5                	mov    %esp,%ebp
+  8020b8:	56                   	push   %esi
+  8020b9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8020ba:	83 ec 08             	sub    $0x8,%esp
+  8020bd:	6a 00                	push   $0x0
+  8020bf:	ff 75 08             	push   0x8(%ebp)
+  8020c2:	e8 e4 01 00 00       	call   8022ab <open>
+  8020c7:	89 c3                	mov    %eax,%ebx
+  8020c9:	83 c4 10             	add    $0x10,%esp
+  8020cc:	85 c0                	test   %eax,%eax
+  8020ce:	78 1b                	js     8020eb <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8020d0:	83 ec 08             	sub    $0x8,%esp
+  8020d3:	ff 75 0c             	push   0xc(%ebp)
+  8020d6:	50                   	push   %eax
+  8020d7:	e8 64 ff ff ff       	call   802040 <fstat>
+  8020dc:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8020de:	89 1c 24             	mov    %ebx,(%esp)
+  8020e1:	e8 c6 fb ff ff       	call   801cac <close>
+	return r;
+  8020e6:	83 c4 10             	add    $0x10,%esp
+  8020e9:	89 f3                	mov    %esi,%ebx
+}
+  8020eb:	89 d8                	mov    %ebx,%eax
+  8020ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020f0:	5b                   	pop    %ebx
+  8020f1:	5e                   	pop    %esi
+  8020f2:	5d                   	pop    %ebp
+  8020f3:	c3                   	ret
+
+008020f4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	56                   	push   %esi
+  8020f8:	53                   	push   %ebx
+  8020f9:	89 c6                	mov    %eax,%esi
+  8020fb:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8020fd:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  802104:	74 27                	je     80212d <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802106:	6a 07                	push   $0x7
+  802108:	68 00 80 80 00       	push   $0x808000
+  80210d:	56                   	push   %esi
+  80210e:	ff 35 00 60 80 00    	push   0x806000
+  802114:	e8 da 12 00 00       	call   8033f3 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802119:	83 c4 0c             	add    $0xc,%esp
+  80211c:	6a 00                	push   $0x0
+  80211e:	53                   	push   %ebx
+  80211f:	6a 00                	push   $0x0
+  802121:	e8 b5 12 00 00       	call   8033db <ipc_recv>
+}
+  802126:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802129:	5b                   	pop    %ebx
+  80212a:	5e                   	pop    %esi
+  80212b:	5d                   	pop    %ebp
+  80212c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80212d:	83 ec 0c             	sub    $0xc,%esp
+  802130:	6a 01                	push   $0x1
+  802132:	e8 10 13 00 00       	call   803447 <ipc_find_env>
+  802137:	a3 00 60 80 00       	mov    %eax,0x806000
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	eb c5                	jmp    802106 <fsipc+0x12>
+
+00802141 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802141:	55                   	push   %ebp
+  802142:	89 e5                	mov    %esp,%ebp
+  802144:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802147:	8b 45 08             	mov    0x8(%ebp),%eax
+  80214a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80214d:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  802152:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802155:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80215a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802164:	e8 8b ff ff ff       	call   8020f4 <fsipc>
+}
+  802169:	c9                   	leave
+  80216a:	c3                   	ret
+
+0080216b <devfile_flush>:
+{
+  80216b:	55                   	push   %ebp
+  80216c:	89 e5                	mov    %esp,%ebp
+  80216e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802171:	8b 45 08             	mov    0x8(%ebp),%eax
+  802174:	8b 40 0c             	mov    0xc(%eax),%eax
+  802177:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80217c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802181:	b8 06 00 00 00       	mov    $0x6,%eax
+  802186:	e8 69 ff ff ff       	call   8020f4 <fsipc>
+}
+  80218b:	c9                   	leave
+  80218c:	c3                   	ret
+
+0080218d <devfile_stat>:
+{
+  80218d:	55                   	push   %ebp
+  80218e:	89 e5                	mov    %esp,%ebp
+  802190:	53                   	push   %ebx
+  802191:	83 ec 04             	sub    $0x4,%esp
+  802194:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802197:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80219d:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8021a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021ac:	e8 43 ff ff ff       	call   8020f4 <fsipc>
+  8021b1:	85 c0                	test   %eax,%eax
+  8021b3:	78 2c                	js     8021e1 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021b5:	83 ec 08             	sub    $0x8,%esp
+  8021b8:	68 00 80 80 00       	push   $0x808000
+  8021bd:	53                   	push   %ebx
+  8021be:	e8 b4 e9 ff ff       	call   800b77 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8021c3:	a1 80 80 80 00       	mov    0x808080,%eax
+  8021c8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021ce:	a1 84 80 80 00       	mov    0x808084,%eax
+  8021d3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8021d9:	83 c4 10             	add    $0x10,%esp
+  8021dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e4:	c9                   	leave
+  8021e5:	c3                   	ret
+
+008021e6 <devfile_write>:
+{
+  8021e6:	55                   	push   %ebp
+  8021e7:	89 e5                	mov    %esp,%ebp
+  8021e9:	83 ec 0c             	sub    $0xc,%esp
+  8021ec:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021f2:	8b 52 0c             	mov    0xc(%edx),%edx
+  8021f5:	89 15 00 80 80 00    	mov    %edx,0x808000
+	fsipcbuf.write.req_n = n;
+  8021fb:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  802200:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802205:	39 d0                	cmp    %edx,%eax
+  802207:	0f 47 c2             	cmova  %edx,%eax
+  80220a:	50                   	push   %eax
+  80220b:	ff 75 0c             	push   0xc(%ebp)
+  80220e:	68 08 80 80 00       	push   $0x808008
+  802213:	e8 e5 ea ff ff       	call   800cfd <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802222:	e8 cd fe ff ff       	call   8020f4 <fsipc>
+}
+  802227:	c9                   	leave
+  802228:	c3                   	ret
+
+00802229 <devfile_read>:
+{
+  802229:	55                   	push   %ebp
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	56                   	push   %esi
+  80222d:	53                   	push   %ebx
+  80222e:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802231:	8b 45 08             	mov    0x8(%ebp),%eax
+  802234:	8b 40 0c             	mov    0xc(%eax),%eax
+  802237:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  80223c:	89 35 04 80 80 00    	mov    %esi,0x808004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802242:	ba 00 00 00 00       	mov    $0x0,%edx
+  802247:	b8 03 00 00 00       	mov    $0x3,%eax
+  80224c:	e8 a3 fe ff ff       	call   8020f4 <fsipc>
+  802251:	89 c3                	mov    %eax,%ebx
+  802253:	85 c0                	test   %eax,%eax
+  802255:	78 1f                	js     802276 <devfile_read+0x4d>
+	assert(r <= n);
+  802257:	39 c6                	cmp    %eax,%esi
+  802259:	72 24                	jb     80227f <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80225b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802260:	7f 33                	jg     802295 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802262:	83 ec 04             	sub    $0x4,%esp
+  802265:	50                   	push   %eax
+  802266:	68 00 80 80 00       	push   $0x808000
+  80226b:	ff 75 0c             	push   0xc(%ebp)
+  80226e:	e8 8a ea ff ff       	call   800cfd <memmove>
+	return r;
+  802273:	83 c4 10             	add    $0x10,%esp
+}
+  802276:	89 d8                	mov    %ebx,%eax
+  802278:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80227b:	5b                   	pop    %ebx
+  80227c:	5e                   	pop    %esi
+  80227d:	5d                   	pop    %ebp
+  80227e:	c3                   	ret
+	assert(r <= n);
+  80227f:	68 68 3c 80 00       	push   $0x803c68
+  802284:	68 6f 3c 80 00       	push   $0x803c6f
+  802289:	6a 76                	push   $0x76
+  80228b:	68 84 3c 80 00       	push   $0x803c84
+  802290:	e8 bf e1 ff ff       	call   800454 <_panic>
+	assert(r <= PGSIZE);
+  802295:	68 8f 3c 80 00       	push   $0x803c8f
+  80229a:	68 6f 3c 80 00       	push   $0x803c6f
+  80229f:	6a 77                	push   $0x77
+  8022a1:	68 84 3c 80 00       	push   $0x803c84
+  8022a6:	e8 a9 e1 ff ff       	call   800454 <_panic>
+
+008022ab <open>:
+{
+  8022ab:	55                   	push   %ebp
+  8022ac:	89 e5                	mov    %esp,%ebp
+  8022ae:	56                   	push   %esi
+  8022af:	53                   	push   %ebx
+  8022b0:	83 ec 1c             	sub    $0x1c,%esp
+  8022b3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8022b6:	56                   	push   %esi
+  8022b7:	e8 80 e8 ff ff       	call   800b3c <strlen>
+  8022bc:	83 c4 10             	add    $0x10,%esp
+  8022bf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022c4:	7f 6c                	jg     802332 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8022c6:	83 ec 0c             	sub    $0xc,%esp
+  8022c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022cc:	50                   	push   %eax
+  8022cd:	e8 3a f8 ff ff       	call   801b0c <fd_alloc>
+  8022d2:	89 c3                	mov    %eax,%ebx
+  8022d4:	83 c4 10             	add    $0x10,%esp
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	78 3c                	js     802317 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022db:	83 ec 08             	sub    $0x8,%esp
+  8022de:	56                   	push   %esi
+  8022df:	68 00 80 80 00       	push   $0x808000
+  8022e4:	e8 8e e8 ff ff       	call   800b77 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ec:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022f1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022f9:	e8 f6 fd ff ff       	call   8020f4 <fsipc>
+  8022fe:	89 c3                	mov    %eax,%ebx
+  802300:	83 c4 10             	add    $0x10,%esp
+  802303:	85 c0                	test   %eax,%eax
+  802305:	78 19                	js     802320 <open+0x75>
+	return fd2num(fd);
+  802307:	83 ec 0c             	sub    $0xc,%esp
+  80230a:	ff 75 f4             	push   -0xc(%ebp)
+  80230d:	e8 d3 f7 ff ff       	call   801ae5 <fd2num>
+  802312:	89 c3                	mov    %eax,%ebx
+  802314:	83 c4 10             	add    $0x10,%esp
+}
+  802317:	89 d8                	mov    %ebx,%eax
+  802319:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80231c:	5b                   	pop    %ebx
+  80231d:	5e                   	pop    %esi
+  80231e:	5d                   	pop    %ebp
+  80231f:	c3                   	ret
+		fd_close(fd, 0);
+  802320:	83 ec 08             	sub    $0x8,%esp
+  802323:	6a 00                	push   $0x0
+  802325:	ff 75 f4             	push   -0xc(%ebp)
+  802328:	e8 f8 f8 ff ff       	call   801c25 <fd_close>
+		return r;
+  80232d:	83 c4 10             	add    $0x10,%esp
+  802330:	eb e5                	jmp    802317 <open+0x6c>
+		return -E_BAD_PATH;
+  802332:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802337:	eb de                	jmp    802317 <open+0x6c>
+
+00802339 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80233f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802344:	b8 08 00 00 00       	mov    $0x8,%eax
+  802349:	e8 a6 fd ff ff       	call   8020f4 <fsipc>
+}
+  80234e:	c9                   	leave
+  80234f:	c3                   	ret
+
+00802350 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802350:	55                   	push   %ebp
+  802351:	89 e5                	mov    %esp,%ebp
+  802353:	57                   	push   %edi
+  802354:	56                   	push   %esi
+  802355:	53                   	push   %ebx
+  802356:	81 ec 54 04 00 00    	sub    $0x454,%esp
+	//
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80235c:	6a 00                	push   $0x0
+  80235e:	ff 75 08             	push   0x8(%ebp)
+  802361:	e8 45 ff ff ff       	call   8022ab <open>
+  802366:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  80236c:	83 c4 10             	add    $0x10,%esp
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	0f 88 7a 06 00 00    	js     8029f1 <spawn+0x6a1>
+  802377:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802379:	83 ec 04             	sub    $0x4,%esp
+  80237c:	68 00 02 00 00       	push   $0x200
+  802381:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802387:	50                   	push   %eax
+  802388:	51                   	push   %ecx
+  802389:	e8 01 fb ff ff       	call   801e8f <readn>
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802396:	75 7a                	jne    802412 <spawn+0xc2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802398:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80239f:	45 4c 46 
+  8023a2:	75 6e                	jne    802412 <spawn+0xc2>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8023a4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023a9:	cd 30                	int    $0x30
+  8023ab:	89 85 cc fb ff ff    	mov    %eax,-0x434(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8023b1:	89 c6                	mov    %eax,%esi
+  8023b3:	85 c0                	test   %eax,%eax
+  8023b5:	0f 88 2a 06 00 00    	js     8029e5 <spawn+0x695>
+		return r;
+	child = r;
+
+	// The child's memory is its own, not our demand-zero regions.
+	if ((r = sys_region_release(child, 0, UTOP)) < 0)
+  8023bb:	83 ec 04             	sub    $0x4,%esp
+  8023be:	68 00 00 c0 ee       	push   $0xeec00000
+  8023c3:	6a 00                	push   $0x0
+  8023c5:	50                   	push   %eax
+  8023c6:	e8 1d f3 ff ff       	call   8016e8 <sys_region_release>
+  8023cb:	89 c7                	mov    %eax,%edi
+  8023cd:	83 c4 10             	add    $0x10,%esp
+  8023d0:	85 c0                	test   %eax,%eax
+  8023d2:	0f 88 da 05 00 00    	js     8029b2 <spawn+0x662>
+		goto error;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8023d8:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8023de:	69 f6 58 01 00 00    	imul   $0x158,%esi,%esi
+  8023e4:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8023ea:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8023f0:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8023f5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8023f7:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8023fd:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802403:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802408:	be 00 00 00 00       	mov    $0x0,%esi
+  80240d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802410:	eb 4b                	jmp    80245d <spawn+0x10d>
+		close(fd);
+  802412:	83 ec 0c             	sub    $0xc,%esp
+  802415:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  80241b:	e8 8c f8 ff ff       	call   801cac <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802420:	83 c4 0c             	add    $0xc,%esp
+  802423:	68 7f 45 4c 46       	push   $0x464c457f
+  802428:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  80242e:	68 9b 3c 80 00       	push   $0x803c9b
+  802433:	e8 f7 e0 ff ff       	call   80052f <cprintf>
+		return -E_NOT_EXEC;
+  802438:	83 c4 10             	add    $0x10,%esp
+  80243b:	c7 85 d0 fb ff ff f2 	movl   $0xfffffff2,-0x430(%ebp)
+  802442:	ff ff ff 
+  802445:	e9 a7 05 00 00       	jmp    8029f1 <spawn+0x6a1>
+		string_size += strlen(argv[argc]) + 1;
+  80244a:	83 ec 0c             	sub    $0xc,%esp
+  80244d:	50                   	push   %eax
+  80244e:	e8 e9 e6 ff ff       	call   800b3c <strlen>
+  802453:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802457:	83 c3 01             	add    $0x1,%ebx
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802460:	85 c0                	test   %eax,%eax
+  802462:	75 e6                	jne    80244a <spawn+0xfa>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802464:	89 9d c4 fb ff ff    	mov    %ebx,-0x43c(%ebp)
+  80246a:	b8 00 10 40 00       	mov    $0x401000,%eax
+  80246f:	29 f0                	sub    %esi,%eax
+  802471:	89 c7                	mov    %eax,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802473:	89 c2                	mov    %eax,%edx
+  802475:	83 e2 fc             	and    $0xfffffffc,%edx
+  802478:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80247f:	29 c2                	sub    %eax,%edx
+  802481:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802487:	8d 42 f8             	lea    -0x8(%edx),%eax
+  80248a:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80248f:	0f 86 6a 05 00 00    	jbe    8029ff <spawn+0x6af>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802495:	83 ec 04             	sub    $0x4,%esp
+  802498:	6a 07                	push   $0x7
+  80249a:	68 00 00 40 00       	push   $0x400000
+  80249f:	6a 00                	push   $0x0
+  8024a1:	e8 c9 eb ff ff       	call   80106f <sys_page_alloc>
+  8024a6:	83 c4 10             	add    $0x10,%esp
+  8024a9:	85 c0                	test   %eax,%eax
+  8024ab:	0f 88 53 05 00 00    	js     802a04 <spawn+0x6b4>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8024b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b6:	89 9d c8 fb ff ff    	mov    %ebx,-0x438(%ebp)
+  8024bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8024bf:	eb 30                	jmp    8024f1 <spawn+0x1a1>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8024c1:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8024c7:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  8024cd:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8024d0:	83 ec 08             	sub    $0x8,%esp
+  8024d3:	ff 34 b3             	push   (%ebx,%esi,4)
+  8024d6:	57                   	push   %edi
+  8024d7:	e8 9b e6 ff ff       	call   800b77 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8024dc:	83 c4 04             	add    $0x4,%esp
+  8024df:	ff 34 b3             	push   (%ebx,%esi,4)
+  8024e2:	e8 55 e6 ff ff       	call   800b3c <strlen>
+  8024e7:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8024eb:	83 c6 01             	add    $0x1,%esi
+  8024ee:	83 c4 10             	add    $0x10,%esp
+  8024f1:	39 b5 c8 fb ff ff    	cmp    %esi,-0x438(%ebp)
+  8024f7:	7f c8                	jg     8024c1 <spawn+0x171>
+	}
+	argv_store[argc] = 0;
+  8024f9:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  8024ff:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  802505:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80250c:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802512:	0f 85 85 00 00 00    	jne    80259d <spawn+0x24d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802518:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  80251e:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  802524:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  802527:	89 d0                	mov    %edx,%eax
+  802529:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  80252f:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802532:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802537:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  80253d:	83 ec 0c             	sub    $0xc,%esp
+  802540:	6a 07                	push   $0x7
+  802542:	68 00 d0 bf ee       	push   $0xeebfd000
+  802547:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80254d:	68 00 00 40 00       	push   $0x400000
+  802552:	6a 00                	push   $0x0
+  802554:	e8 83 eb ff ff       	call   8010dc <sys_page_map>
+  802559:	89 c3                	mov    %eax,%ebx
+  80255b:	83 c4 20             	add    $0x20,%esp
+  80255e:	85 c0                	test   %eax,%eax
+  802560:	0f 88 a6 04 00 00    	js     802a0c <spawn+0x6bc>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802566:	83 ec 08             	sub    $0x8,%esp
+  802569:	68 00 00 40 00       	push   $0x400000
+  80256e:	6a 00                	push   $0x0
+  802570:	e8 d5 eb ff ff       	call   80114a <sys_page_unmap>
+  802575:	89 c3                	mov    %eax,%ebx
+  802577:	83 c4 10             	add    $0x10,%esp
+  80257a:	85 c0                	test   %eax,%eax
+  80257c:	0f 88 8a 04 00 00    	js     802a0c <spawn+0x6bc>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802582:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802588:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80258f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802594:	89 df                	mov    %ebx,%edi
+  802596:	89 c3                	mov    %eax,%ebx
+  802598:	e9 8d 01 00 00       	jmp    80272a <spawn+0x3da>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80259d:	68 4c 3d 80 00       	push   $0x803d4c
+  8025a2:	68 6f 3c 80 00       	push   $0x803c6f
+  8025a7:	68 f3 00 00 00       	push   $0xf3
+  8025ac:	68 b5 3c 80 00       	push   $0x803cb5
+  8025b1:	e8 9e de ff ff       	call   800454 <_panic>
+	}
+
+	// The pages that come from the file, a chunk at a time: allocate
+	// the chunk at UTEMP, read it in, and move it to the child.
+	batch_init(&b);
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  8025b6:	01 fe                	add    %edi,%esi
+  8025b8:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+  8025be:	8b 85 c0 fb ff ff    	mov    -0x440(%ebp),%eax
+  8025c4:	39 c6                	cmp    %eax,%esi
+  8025c6:	0f 83 18 01 00 00    	jae    8026e4 <spawn+0x394>
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  8025cc:	8b 9d b8 fb ff ff    	mov    -0x448(%ebp),%ebx
+  8025d2:	29 f3                	sub    %esi,%ebx
+  8025d4:	c1 eb 0c             	shr    $0xc,%ebx
+  8025d7:	b8 40 00 00 00       	mov    $0x40,%eax
+  8025dc:	39 c3                	cmp    %eax,%ebx
+  8025de:	0f 47 d8             	cmova  %eax,%ebx
+  8025e1:	89 df                	mov    %ebx,%edi
+			SEGMENT_CHUNK);
+		batch_alloc(&b, 0, UTEMP, PTE_P|PTE_U|PTE_W, n);
+  8025e3:	83 ec 0c             	sub    $0xc,%esp
+  8025e6:	53                   	push   %ebx
+  8025e7:	6a 07                	push   $0x7
+  8025e9:	68 00 00 40 00       	push   $0x400000
+  8025ee:	6a 00                	push   $0x0
+  8025f0:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8025f6:	50                   	push   %eax
+  8025f7:	e8 0b 10 00 00       	call   803607 <batch_alloc>
+		if ((r = batch_flush(&b)) < 0)
+  8025fc:	83 c4 14             	add    $0x14,%esp
+  8025ff:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802605:	50                   	push   %eax
+  802606:	e8 97 0e 00 00       	call   8034a2 <batch_flush>
+  80260b:	83 c4 10             	add    $0x10,%esp
+  80260e:	85 c0                	test   %eax,%eax
+  802610:	0f 88 9a 03 00 00    	js     8029b0 <spawn+0x660>
+			return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802616:	83 ec 08             	sub    $0x8,%esp
+  802619:	8b 85 bc fb ff ff    	mov    -0x444(%ebp),%eax
+  80261f:	01 f0                	add    %esi,%eax
+  802621:	50                   	push   %eax
+  802622:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802628:	e8 4b f9 ff ff       	call   801f78 <seek>
+  80262d:	83 c4 10             	add    $0x10,%esp
+  802630:	85 c0                	test   %eax,%eax
+  802632:	0f 88 a1 03 00 00    	js     8029d9 <spawn+0x689>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802638:	c1 e7 0c             	shl    $0xc,%edi
+  80263b:	83 ec 04             	sub    $0x4,%esp
+  80263e:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  802644:	8b 8d d4 fb ff ff    	mov    -0x42c(%ebp),%ecx
+  80264a:	29 c8                	sub    %ecx,%eax
+  80264c:	39 f8                	cmp    %edi,%eax
+  80264e:	0f 47 c7             	cmova  %edi,%eax
+  802651:	50                   	push   %eax
+  802652:	68 00 00 40 00       	push   $0x400000
+  802657:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  80265d:	e8 2d f8 ff ff       	call   801e8f <readn>
+  802662:	83 c4 10             	add    $0x10,%esp
+  802665:	85 c0                	test   %eax,%eax
+  802667:	0f 88 70 03 00 00    	js     8029dd <spawn+0x68d>
+			return r;
+		batch_map(&b, 0, UTEMP, child, (void*) (va + i), perm, n);
+  80266d:	83 ec 04             	sub    $0x4,%esp
+  802670:	53                   	push   %ebx
+  802671:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  802677:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  80267d:	8b 95 c4 fb ff ff    	mov    -0x43c(%ebp),%edx
+  802683:	01 d0                	add    %edx,%eax
+  802685:	50                   	push   %eax
+  802686:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80268c:	68 00 00 40 00       	push   $0x400000
+  802691:	6a 00                	push   $0x0
+  802693:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802699:	50                   	push   %eax
+  80269a:	e8 93 0f 00 00       	call   803632 <batch_map>
+		batch_unmap(&b, 0, UTEMP, n);
+  80269f:	83 c4 20             	add    $0x20,%esp
+  8026a2:	53                   	push   %ebx
+  8026a3:	68 00 00 40 00       	push   $0x400000
+  8026a8:	6a 00                	push   $0x0
+  8026aa:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8026b0:	50                   	push   %eax
+  8026b1:	e8 a6 0f 00 00       	call   80365c <batch_unmap>
+		if ((r = batch_flush(&b)) < 0)
+  8026b6:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8026bc:	89 04 24             	mov    %eax,(%esp)
+  8026bf:	e8 de 0d 00 00       	call   8034a2 <batch_flush>
+  8026c4:	83 c4 10             	add    $0x10,%esp
+  8026c7:	85 c0                	test   %eax,%eax
+  8026c9:	0f 89 e7 fe ff ff    	jns    8025b6 <spawn+0x266>
+			panic("spawn: sys_page_map data: %e", r);
+  8026cf:	50                   	push   %eax
+  8026d0:	68 c1 3c 80 00       	push   $0x803cc1
+  8026d5:	68 2b 01 00 00       	push   $0x12b
+  8026da:	68 b5 3c 80 00       	push   $0x803cb5
+  8026df:	e8 70 dd ff ff       	call   800454 <_panic>
+	}
+
+	// the blank pages are demand-zero
+	if (i < memsz)
+  8026e4:	8b 9d ac fb ff ff    	mov    -0x454(%ebp),%ebx
+  8026ea:	8b bd a8 fb ff ff    	mov    -0x458(%ebp),%edi
+  8026f0:	89 f2                	mov    %esi,%edx
+  8026f2:	8b 85 b0 fb ff ff    	mov    -0x450(%ebp),%eax
+  8026f8:	39 c6                	cmp    %eax,%esi
+  8026fa:	73 28                	jae    802724 <spawn+0x3d4>
+		return sys_region_reserve(child, (void*) (va + i), memsz - i,
+  8026fc:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  802702:	29 f0                	sub    %esi,%eax
+  802704:	50                   	push   %eax
+  802705:	8b 85 c4 fb ff ff    	mov    -0x43c(%ebp),%eax
+  80270b:	01 c2                	add    %eax,%edx
+  80270d:	52                   	push   %edx
+  80270e:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802714:	e8 63 ef ff ff       	call   80167c <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802719:	83 c4 10             	add    $0x10,%esp
+  80271c:	85 c0                	test   %eax,%eax
+  80271e:	0f 88 bd 02 00 00    	js     8029e1 <spawn+0x691>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802724:	83 c3 01             	add    $0x1,%ebx
+  802727:	83 c7 20             	add    $0x20,%edi
+  80272a:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802731:	39 d8                	cmp    %ebx,%eax
+  802733:	0f 8e b2 00 00 00    	jle    8027eb <spawn+0x49b>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802739:	83 3f 01             	cmpl   $0x1,(%edi)
+  80273c:	75 e6                	jne    802724 <spawn+0x3d4>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  80273e:	8b 47 18             	mov    0x18(%edi),%eax
+  802741:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802744:	83 f8 01             	cmp    $0x1,%eax
+  802747:	19 c0                	sbb    %eax,%eax
+  802749:	83 e0 fe             	and    $0xfffffffe,%eax
+  80274c:	83 c0 07             	add    $0x7,%eax
+  80274f:	89 85 b4 fb ff ff    	mov    %eax,-0x44c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802755:	8b 57 04             	mov    0x4(%edi),%edx
+  802758:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+  80275e:	8b 77 10             	mov    0x10(%edi),%esi
+  802761:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+  802767:	8b 47 14             	mov    0x14(%edi),%eax
+  80276a:	89 85 b0 fb ff ff    	mov    %eax,-0x450(%ebp)
+  802770:	8b 4f 08             	mov    0x8(%edi),%ecx
+  802773:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+	if ((i = PGOFF(va))) {
+  802779:	89 c8                	mov    %ecx,%eax
+  80277b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802780:	74 1e                	je     8027a0 <spawn+0x450>
+		va -= i;
+  802782:	29 c1                	sub    %eax,%ecx
+  802784:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+		memsz += i;
+  80278a:	01 85 b0 fb ff ff    	add    %eax,-0x450(%ebp)
+		filesz += i;
+  802790:	01 c6                	add    %eax,%esi
+  802792:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+		fileoffset -= i;
+  802798:	29 c2                	sub    %eax,%edx
+  80279a:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+	batch_init(&b);
+  8027a0:	83 ec 0c             	sub    $0xc,%esp
+  8027a3:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8027a9:	50                   	push   %eax
+  8027aa:	e8 d7 0c 00 00       	call   803486 <batch_init>
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  8027af:	83 c4 10             	add    $0x10,%esp
+  8027b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b7:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  8027bd:	8b 8d b0 fb ff ff    	mov    -0x450(%ebp),%ecx
+  8027c3:	39 c8                	cmp    %ecx,%eax
+  8027c5:	0f 46 c8             	cmovbe %eax,%ecx
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  8027c8:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  8027ce:	89 85 b8 fb ff ff    	mov    %eax,-0x448(%ebp)
+  8027d4:	89 9d ac fb ff ff    	mov    %ebx,-0x454(%ebp)
+  8027da:	89 bd a8 fb ff ff    	mov    %edi,-0x458(%ebp)
+  8027e0:	89 8d c0 fb ff ff    	mov    %ecx,-0x440(%ebp)
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  8027e6:	e9 cd fd ff ff       	jmp    8025b8 <spawn+0x268>
+	close(fd);
+  8027eb:	83 ec 0c             	sub    $0xc,%esp
+  8027ee:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8027f4:	e8 b3 f4 ff ff       	call   801cac <close>
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	struct Batch b;
+	int i, r;
+	cprintf("copy_shared_pages(%x);\n", child);
+  8027f9:	83 c4 08             	add    $0x8,%esp
+  8027fc:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802802:	68 de 3c 80 00       	push   $0x803cde
+  802807:	e8 23 dd ff ff       	call   80052f <cprintf>
+	
+	batch_init(&b);
+  80280c:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802812:	89 04 24             	mov    %eax,(%esp)
+  802815:	e8 6c 0c 00 00       	call   803486 <batch_init>
+	
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  80281a:	83 c4 10             	add    $0x10,%esp
+  80281d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		// Handle PTE flags
+		assert(uvpt[i] & PTE_U);
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+		
+		// Map page (adjacent pages are mapped with one operation)
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  802822:	8d bd dc fb ff ff    	lea    -0x424(%ebp),%edi
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  802828:	eb 22                	jmp    80284c <spawn+0x4fc>
+			if (uvpd[i / NPTENTRIES] & PTE_SHARE)
+  80282a:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802831:	f6 c6 04             	test   $0x4,%dh
+  802834:	0f 85 97 00 00 00    	jne    8028d1 <spawn+0x581>
+			i = ROUNDUP(i + 1, NPTENTRIES) - 1;
+  80283a:	8d 9e 00 04 00 00    	lea    0x400(%esi),%ebx
+  802840:	81 e3 00 fc ff ff    	and    $0xfffffc00,%ebx
+  802846:	83 eb 01             	sub    $0x1,%ebx
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  802849:	83 c3 01             	add    $0x1,%ebx
+  80284c:	89 de                	mov    %ebx,%esi
+  80284e:	81 fb fd eb 0e 00    	cmp    $0xeebfd,%ebx
+  802854:	0f 87 bd 00 00 00    	ja     802917 <spawn+0x5c7>
+		if (! (uvpd[i / NPTENTRIES] & PTE_P))
+  80285a:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+  802860:	85 db                	test   %ebx,%ebx
+  802862:	0f 49 c3             	cmovns %ebx,%eax
+  802865:	c1 f8 0a             	sar    $0xa,%eax
+  802868:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80286f:	f6 c2 01             	test   $0x1,%dl
+  802872:	74 d5                	je     802849 <spawn+0x4f9>
+		if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  802874:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80287b:	f6 c2 80             	test   $0x80,%dl
+  80287e:	75 aa                	jne    80282a <spawn+0x4da>
+		if (! (uvpt[i] & PTE_P))
+  802880:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802887:	a8 01                	test   $0x1,%al
+  802889:	74 be                	je     802849 <spawn+0x4f9>
+		if (! (uvpt[i] & PTE_SHARE))
+  80288b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802892:	f6 c4 04             	test   $0x4,%ah
+  802895:	74 b2                	je     802849 <spawn+0x4f9>
+		assert(uvpt[i] & PTE_U);
+  802897:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80289e:	a8 04                	test   $0x4,%al
+  8028a0:	74 5c                	je     8028fe <spawn+0x5ae>
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  8028a2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  8028a9:	89 da                	mov    %ebx,%edx
+  8028ab:	c1 e2 0c             	shl    $0xc,%edx
+  8028ae:	83 ec 04             	sub    $0x4,%esp
+  8028b1:	6a 01                	push   $0x1
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  8028b3:	25 07 0e 00 00       	and    $0xe07,%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  8028b8:	50                   	push   %eax
+  8028b9:	52                   	push   %edx
+  8028ba:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8028c0:	52                   	push   %edx
+  8028c1:	6a 00                	push   $0x0
+  8028c3:	57                   	push   %edi
+  8028c4:	e8 69 0d 00 00       	call   803632 <batch_map>
+  8028c9:	83 c4 20             	add    $0x20,%esp
+  8028cc:	e9 78 ff ff ff       	jmp    802849 <spawn+0x4f9>
+					  uvpd[i / NPTENTRIES] & PTE_SYSCALL, 1);
+  8028d1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+					  (void *) (i * PGSIZE),
+  8028d8:	c1 e3 0c             	shl    $0xc,%ebx
+				batch_map(&b, 0, (void *) (i * PGSIZE), child,
+  8028db:	83 ec 04             	sub    $0x4,%esp
+  8028de:	6a 01                	push   $0x1
+  8028e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8028e5:	50                   	push   %eax
+  8028e6:	53                   	push   %ebx
+  8028e7:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8028ed:	53                   	push   %ebx
+  8028ee:	6a 00                	push   $0x0
+  8028f0:	57                   	push   %edi
+  8028f1:	e8 3c 0d 00 00       	call   803632 <batch_map>
+  8028f6:	83 c4 20             	add    $0x20,%esp
+  8028f9:	e9 3c ff ff ff       	jmp    80283a <spawn+0x4ea>
+		assert(uvpt[i] & PTE_U);
+  8028fe:	68 f6 3c 80 00       	push   $0x803cf6
+  802903:	68 6f 3c 80 00       	push   $0x803c6f
+  802908:	68 58 01 00 00       	push   $0x158
+  80290d:	68 b5 3c 80 00       	push   $0x803cb5
+  802912:	e8 3d db ff ff       	call   800454 <_panic>
+	}
+	if ((r = batch_flush(&b)) < 0)
+  802917:	83 ec 0c             	sub    $0xc,%esp
+  80291a:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802920:	50                   	push   %eax
+  802921:	e8 7c 0b 00 00       	call   8034a2 <batch_flush>
+  802926:	83 c4 10             	add    $0x10,%esp
+  802929:	85 c0                	test   %eax,%eax
+  80292b:	78 44                	js     802971 <spawn+0x621>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80292d:	83 ec 08             	sub    $0x8,%esp
+  802930:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802936:	50                   	push   %eax
+  802937:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80293d:	e8 de e8 ff ff       	call   801220 <sys_env_set_trapframe>
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	85 c0                	test   %eax,%eax
+  802947:	78 3d                	js     802986 <spawn+0x636>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802949:	83 ec 08             	sub    $0x8,%esp
+  80294c:	6a 02                	push   $0x2
+  80294e:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802954:	e8 5c e8 ff ff       	call   8011b5 <sys_env_set_status>
+  802959:	83 c4 10             	add    $0x10,%esp
+  80295c:	85 c0                	test   %eax,%eax
+  80295e:	78 3b                	js     80299b <spawn+0x64b>
+	return child;
+  802960:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  802966:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  80296c:	e9 80 00 00 00       	jmp    8029f1 <spawn+0x6a1>
+		panic("cannot map page: %e", r);
+  802971:	50                   	push   %eax
+  802972:	68 06 3d 80 00       	push   $0x803d06
+  802977:	68 5f 01 00 00       	push   $0x15f
+  80297c:	68 b5 3c 80 00       	push   $0x803cb5
+  802981:	e8 ce da ff ff       	call   800454 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  802986:	50                   	push   %eax
+  802987:	68 1a 3d 80 00       	push   $0x803d1a
+  80298c:	68 87 00 00 00       	push   $0x87
+  802991:	68 b5 3c 80 00       	push   $0x803cb5
+  802996:	e8 b9 da ff ff       	call   800454 <_panic>
+		panic("sys_env_set_status: %e", r);
+  80299b:	50                   	push   %eax
+  80299c:	68 34 3d 80 00       	push   $0x803d34
+  8029a1:	68 8a 00 00 00       	push   $0x8a
+  8029a6:	68 b5 3c 80 00       	push   $0x803cb5
+  8029ab:	e8 a4 da ff ff       	call   800454 <_panic>
+  8029b0:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  8029b2:	83 ec 0c             	sub    $0xc,%esp
+  8029b5:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8029bb:	e8 ba e5 ff ff       	call   800f7a <sys_env_destroy>
+	close(fd);
+  8029c0:	83 c4 04             	add    $0x4,%esp
+  8029c3:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8029c9:	e8 de f2 ff ff       	call   801cac <close>
+	return r;
+  8029ce:	83 c4 10             	add    $0x10,%esp
+  8029d1:	89 bd d0 fb ff ff    	mov    %edi,-0x430(%ebp)
+  8029d7:	eb 18                	jmp    8029f1 <spawn+0x6a1>
+  8029d9:	89 c7                	mov    %eax,%edi
+  8029db:	eb d5                	jmp    8029b2 <spawn+0x662>
+  8029dd:	89 c7                	mov    %eax,%edi
+  8029df:	eb d1                	jmp    8029b2 <spawn+0x662>
+  8029e1:	89 c7                	mov    %eax,%edi
+  8029e3:	eb cd                	jmp    8029b2 <spawn+0x662>
+		return r;
+  8029e5:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  8029eb:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+}
+  8029f1:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+  8029f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029fa:	5b                   	pop    %ebx
+  8029fb:	5e                   	pop    %esi
+  8029fc:	5f                   	pop    %edi
+  8029fd:	5d                   	pop    %ebp
+  8029fe:	c3                   	ret
+		return -E_NO_MEM;
+  8029ff:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802a04:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802a0a:	eb e5                	jmp    8029f1 <spawn+0x6a1>
+	sys_page_unmap(0, UTEMP);
+  802a0c:	83 ec 08             	sub    $0x8,%esp
+  802a0f:	68 00 00 40 00       	push   $0x400000
+  802a14:	6a 00                	push   $0x0
+  802a16:	e8 2f e7 ff ff       	call   80114a <sys_page_unmap>
+  802a1b:	83 c4 10             	add    $0x10,%esp
+  802a1e:	89 9d d0 fb ff ff    	mov    %ebx,-0x430(%ebp)
+  802a24:	eb cb                	jmp    8029f1 <spawn+0x6a1>
+
+00802a26 <spawnl>:
+{
+  802a26:	55                   	push   %ebp
+  802a27:	89 e5                	mov    %esp,%ebp
+  802a29:	56                   	push   %esi
+  802a2a:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802a2b:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802a33:	eb 05                	jmp    802a3a <spawnl+0x14>
+		argc++;
+  802a35:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802a38:	89 ca                	mov    %ecx,%edx
+  802a3a:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802a3d:	83 3a 00             	cmpl   $0x0,(%edx)
+  802a40:	75 f3                	jne    802a35 <spawnl+0xf>
+	const char *argv[argc+2];
+  802a42:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802a49:	83 e2 f0             	and    $0xfffffff0,%edx
+  802a4c:	29 d4                	sub    %edx,%esp
+  802a4e:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802a52:	89 da                	mov    %ebx,%edx
+  802a54:	c1 ea 02             	shr    $0x2,%edx
+  802a57:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802a5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a5d:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802a64:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802a6b:	00 
+	va_start(vl, arg0);
+  802a6c:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802a6f:	89 c2                	mov    %eax,%edx
+  802a71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a76:	eb 0b                	jmp    802a83 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802a78:	83 c0 01             	add    $0x1,%eax
+  802a7b:	8b 31                	mov    (%ecx),%esi
+  802a7d:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802a80:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802a83:	39 d0                	cmp    %edx,%eax
+  802a85:	75 f1                	jne    802a78 <spawnl+0x52>
+	return spawn(prog, argv);
+  802a87:	83 ec 08             	sub    $0x8,%esp
+  802a8a:	53                   	push   %ebx
+  802a8b:	ff 75 08             	push   0x8(%ebp)
+  802a8e:	e8 bd f8 ff ff       	call   802350 <spawn>
+}
+  802a93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a96:	5b                   	pop    %ebx
+  802a97:	5e                   	pop    %esi
+  802a98:	5d                   	pop    %ebp
+  802a99:	c3                   	ret
+
+00802a9a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a9a:	55                   	push   %ebp
+  802a9b:	89 e5                	mov    %esp,%ebp
+  802a9d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802aa0:	68 72 3d 80 00       	push   $0x803d72
+  802aa5:	ff 75 0c             	push   0xc(%ebp)
+  802aa8:	e8 ca e0 ff ff       	call   800b77 <strcpy>
+	return 0;
+}
+  802aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab2:	c9                   	leave
+  802ab3:	c3                   	ret
+
+00802ab4 <devsock_close>:
+{
+  802ab4:	55                   	push   %ebp
+  802ab5:	89 e5                	mov    %esp,%ebp
+  802ab7:	53                   	push   %ebx
+  802ab8:	83 ec 10             	sub    $0x10,%esp
+  802abb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802abe:	53                   	push   %ebx
+  802abf:	e8 e4 0b 00 00       	call   8036a8 <pageref>
+  802ac4:	89 c2                	mov    %eax,%edx
+  802ac6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802ace:	83 fa 01             	cmp    $0x1,%edx
+  802ad1:	74 05                	je     802ad8 <devsock_close+0x24>
+}
+  802ad3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad6:	c9                   	leave
+  802ad7:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802ad8:	83 ec 0c             	sub    $0xc,%esp
+  802adb:	ff 73 0c             	push   0xc(%ebx)
+  802ade:	e8 b7 02 00 00       	call   802d9a <nsipc_close>
+  802ae3:	83 c4 10             	add    $0x10,%esp
+  802ae6:	eb eb                	jmp    802ad3 <devsock_close+0x1f>
+
+00802ae8 <devsock_write>:
+{
+  802ae8:	55                   	push   %ebp
+  802ae9:	89 e5                	mov    %esp,%ebp
+  802aeb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802aee:	6a 00                	push   $0x0
+  802af0:	ff 75 10             	push   0x10(%ebp)
+  802af3:	ff 75 0c             	push   0xc(%ebp)
+  802af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af9:	ff 70 0c             	push   0xc(%eax)
+  802afc:	e8 79 03 00 00       	call   802e7a <nsipc_send>
+}
+  802b01:	c9                   	leave
+  802b02:	c3                   	ret
+
+00802b03 <devsock_read>:
+{
+  802b03:	55                   	push   %ebp
+  802b04:	89 e5                	mov    %esp,%ebp
+  802b06:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b09:	6a 00                	push   $0x0
+  802b0b:	ff 75 10             	push   0x10(%ebp)
+  802b0e:	ff 75 0c             	push   0xc(%ebp)
+  802b11:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b14:	ff 70 0c             	push   0xc(%eax)
+  802b17:	e8 ef 02 00 00       	call   802e0b <nsipc_recv>
+}
+  802b1c:	c9                   	leave
+  802b1d:	c3                   	ret
+
+00802b1e <fd2sockid>:
+{
+  802b1e:	55                   	push   %ebp
+  802b1f:	89 e5                	mov    %esp,%ebp
+  802b21:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b24:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b27:	52                   	push   %edx
+  802b28:	50                   	push   %eax
+  802b29:	e8 34 f0 ff ff       	call   801b62 <fd_lookup>
+  802b2e:	83 c4 10             	add    $0x10,%esp
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	78 10                	js     802b45 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b38:	8b 0d ac 57 80 00    	mov    0x8057ac,%ecx
+  802b3e:	39 08                	cmp    %ecx,(%eax)
+  802b40:	75 05                	jne    802b47 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b42:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b45:	c9                   	leave
+  802b46:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b47:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b4c:	eb f7                	jmp    802b45 <fd2sockid+0x27>
+
+00802b4e <alloc_sockfd>:
+{
+  802b4e:	55                   	push   %ebp
+  802b4f:	89 e5                	mov    %esp,%ebp
+  802b51:	56                   	push   %esi
+  802b52:	53                   	push   %ebx
+  802b53:	83 ec 1c             	sub    $0x1c,%esp
+  802b56:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b5b:	50                   	push   %eax
+  802b5c:	e8 ab ef ff ff       	call   801b0c <fd_alloc>
+  802b61:	89 c3                	mov    %eax,%ebx
+  802b63:	83 c4 10             	add    $0x10,%esp
+  802b66:	85 c0                	test   %eax,%eax
+  802b68:	78 43                	js     802bad <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b6a:	83 ec 04             	sub    $0x4,%esp
+  802b6d:	68 07 04 00 00       	push   $0x407
+  802b72:	ff 75 f4             	push   -0xc(%ebp)
+  802b75:	6a 00                	push   $0x0
+  802b77:	e8 f3 e4 ff ff       	call   80106f <sys_page_alloc>
+  802b7c:	89 c3                	mov    %eax,%ebx
+  802b7e:	83 c4 10             	add    $0x10,%esp
+  802b81:	85 c0                	test   %eax,%eax
+  802b83:	78 28                	js     802bad <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b88:	8b 15 ac 57 80 00    	mov    0x8057ac,%edx
+  802b8e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b93:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b9a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b9d:	83 ec 0c             	sub    $0xc,%esp
+  802ba0:	50                   	push   %eax
+  802ba1:	e8 3f ef ff ff       	call   801ae5 <fd2num>
+  802ba6:	89 c3                	mov    %eax,%ebx
+  802ba8:	83 c4 10             	add    $0x10,%esp
+  802bab:	eb 0c                	jmp    802bb9 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802bad:	83 ec 0c             	sub    $0xc,%esp
+  802bb0:	56                   	push   %esi
+  802bb1:	e8 e4 01 00 00       	call   802d9a <nsipc_close>
+		return r;
+  802bb6:	83 c4 10             	add    $0x10,%esp
+}
+  802bb9:	89 d8                	mov    %ebx,%eax
+  802bbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bbe:	5b                   	pop    %ebx
+  802bbf:	5e                   	pop    %esi
+  802bc0:	5d                   	pop    %ebp
+  802bc1:	c3                   	ret
+
+00802bc2 <accept>:
+{
+  802bc2:	55                   	push   %ebp
+  802bc3:	89 e5                	mov    %esp,%ebp
+  802bc5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcb:	e8 4e ff ff ff       	call   802b1e <fd2sockid>
+  802bd0:	85 c0                	test   %eax,%eax
+  802bd2:	78 1b                	js     802bef <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802bd4:	83 ec 04             	sub    $0x4,%esp
+  802bd7:	ff 75 10             	push   0x10(%ebp)
+  802bda:	ff 75 0c             	push   0xc(%ebp)
+  802bdd:	50                   	push   %eax
+  802bde:	e8 0e 01 00 00       	call   802cf1 <nsipc_accept>
+  802be3:	83 c4 10             	add    $0x10,%esp
+  802be6:	85 c0                	test   %eax,%eax
+  802be8:	78 05                	js     802bef <accept+0x2d>
+	return alloc_sockfd(r);
+  802bea:	e8 5f ff ff ff       	call   802b4e <alloc_sockfd>
+}
+  802bef:	c9                   	leave
+  802bf0:	c3                   	ret
+
+00802bf1 <bind>:
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+  802bf4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfa:	e8 1f ff ff ff       	call   802b1e <fd2sockid>
+  802bff:	85 c0                	test   %eax,%eax
+  802c01:	78 12                	js     802c15 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c03:	83 ec 04             	sub    $0x4,%esp
+  802c06:	ff 75 10             	push   0x10(%ebp)
+  802c09:	ff 75 0c             	push   0xc(%ebp)
+  802c0c:	50                   	push   %eax
+  802c0d:	e8 31 01 00 00       	call   802d43 <nsipc_bind>
+  802c12:	83 c4 10             	add    $0x10,%esp
+}
+  802c15:	c9                   	leave
+  802c16:	c3                   	ret
+
+00802c17 <shutdown>:
+{
+  802c17:	55                   	push   %ebp
+  802c18:	89 e5                	mov    %esp,%ebp
+  802c1a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c20:	e8 f9 fe ff ff       	call   802b1e <fd2sockid>
+  802c25:	85 c0                	test   %eax,%eax
+  802c27:	78 0f                	js     802c38 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c29:	83 ec 08             	sub    $0x8,%esp
+  802c2c:	ff 75 0c             	push   0xc(%ebp)
+  802c2f:	50                   	push   %eax
+  802c30:	e8 43 01 00 00       	call   802d78 <nsipc_shutdown>
+  802c35:	83 c4 10             	add    $0x10,%esp
+}
+  802c38:	c9                   	leave
+  802c39:	c3                   	ret
+
+00802c3a <connect>:
+{
+  802c3a:	55                   	push   %ebp
+  802c3b:	89 e5                	mov    %esp,%ebp
+  802c3d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c40:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c43:	e8 d6 fe ff ff       	call   802b1e <fd2sockid>
+  802c48:	85 c0                	test   %eax,%eax
+  802c4a:	78 12                	js     802c5e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c4c:	83 ec 04             	sub    $0x4,%esp
+  802c4f:	ff 75 10             	push   0x10(%ebp)
+  802c52:	ff 75 0c             	push   0xc(%ebp)
+  802c55:	50                   	push   %eax
+  802c56:	e8 59 01 00 00       	call   802db4 <nsipc_connect>
+  802c5b:	83 c4 10             	add    $0x10,%esp
+}
+  802c5e:	c9                   	leave
+  802c5f:	c3                   	ret
+
+00802c60 <listen>:
+{
+  802c60:	55                   	push   %ebp
+  802c61:	89 e5                	mov    %esp,%ebp
+  802c63:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c66:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c69:	e8 b0 fe ff ff       	call   802b1e <fd2sockid>
+  802c6e:	85 c0                	test   %eax,%eax
+  802c70:	78 0f                	js     802c81 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c72:	83 ec 08             	sub    $0x8,%esp
+  802c75:	ff 75 0c             	push   0xc(%ebp)
+  802c78:	50                   	push   %eax
+  802c79:	e8 6b 01 00 00       	call   802de9 <nsipc_listen>
+  802c7e:	83 c4 10             	add    $0x10,%esp
+}
+  802c81:	c9                   	leave
+  802c82:	c3                   	ret
+
+00802c83 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c83:	55                   	push   %ebp
+  802c84:	89 e5                	mov    %esp,%ebp
+  802c86:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c89:	ff 75 10             	push   0x10(%ebp)
+  802c8c:	ff 75 0c             	push   0xc(%ebp)
+  802c8f:	ff 75 08             	push   0x8(%ebp)
+  802c92:	e8 41 02 00 00       	call   802ed8 <nsipc_socket>
+  802c97:	83 c4 10             	add    $0x10,%esp
+  802c9a:	85 c0                	test   %eax,%eax
+  802c9c:	78 05                	js     802ca3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c9e:	e8 ab fe ff ff       	call   802b4e <alloc_sockfd>
+}
+  802ca3:	c9                   	leave
+  802ca4:	c3                   	ret
+
+00802ca5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802ca5:	55                   	push   %ebp
+  802ca6:	89 e5                	mov    %esp,%ebp
+  802ca8:	53                   	push   %ebx
+  802ca9:	83 ec 04             	sub    $0x4,%esp
+  802cac:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802cae:	83 3d 04 60 80 00 00 	cmpl   $0x0,0x806004
+  802cb5:	74 26                	je     802cdd <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802cb7:	6a 07                	push   $0x7
+  802cb9:	68 00 90 80 00       	push   $0x809000
+  802cbe:	53                   	push   %ebx
+  802cbf:	ff 35 04 60 80 00    	push   0x806004
+  802cc5:	e8 29 07 00 00       	call   8033f3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802cca:	83 c4 0c             	add    $0xc,%esp
+  802ccd:	6a 00                	push   $0x0
+  802ccf:	6a 00                	push   $0x0
+  802cd1:	6a 00                	push   $0x0
+  802cd3:	e8 03 07 00 00       	call   8033db <ipc_recv>
+}
+  802cd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cdb:	c9                   	leave
+  802cdc:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cdd:	83 ec 0c             	sub    $0xc,%esp
+  802ce0:	6a 02                	push   $0x2
+  802ce2:	e8 60 07 00 00       	call   803447 <ipc_find_env>
+  802ce7:	a3 04 60 80 00       	mov    %eax,0x806004
+  802cec:	83 c4 10             	add    $0x10,%esp
+  802cef:	eb c6                	jmp    802cb7 <nsipc+0x12>
+
+00802cf1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802cf1:	55                   	push   %ebp
+  802cf2:	89 e5                	mov    %esp,%ebp
+  802cf4:	56                   	push   %esi
+  802cf5:	53                   	push   %ebx
+  802cf6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cfc:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d01:	8b 06                	mov    (%esi),%eax
+  802d03:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d08:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d0d:	e8 93 ff ff ff       	call   802ca5 <nsipc>
+  802d12:	89 c3                	mov    %eax,%ebx
+  802d14:	85 c0                	test   %eax,%eax
+  802d16:	79 09                	jns    802d21 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d18:	89 d8                	mov    %ebx,%eax
+  802d1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d1d:	5b                   	pop    %ebx
+  802d1e:	5e                   	pop    %esi
+  802d1f:	5d                   	pop    %ebp
+  802d20:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d21:	83 ec 04             	sub    $0x4,%esp
+  802d24:	ff 35 10 90 80 00    	push   0x809010
+  802d2a:	68 00 90 80 00       	push   $0x809000
+  802d2f:	ff 75 0c             	push   0xc(%ebp)
+  802d32:	e8 c6 df ff ff       	call   800cfd <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d37:	a1 10 90 80 00       	mov    0x809010,%eax
+  802d3c:	89 06                	mov    %eax,(%esi)
+  802d3e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d41:	eb d5                	jmp    802d18 <nsipc_accept+0x27>
+
+00802d43 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d43:	55                   	push   %ebp
+  802d44:	89 e5                	mov    %esp,%ebp
+  802d46:	53                   	push   %ebx
+  802d47:	83 ec 08             	sub    $0x8,%esp
+  802d4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d50:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d55:	53                   	push   %ebx
+  802d56:	ff 75 0c             	push   0xc(%ebp)
+  802d59:	68 04 90 80 00       	push   $0x809004
+  802d5e:	e8 9a df ff ff       	call   800cfd <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d63:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802d69:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d6e:	e8 32 ff ff ff       	call   802ca5 <nsipc>
+}
+  802d73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d76:	c9                   	leave
+  802d77:	c3                   	ret
+
+00802d78 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d78:	55                   	push   %ebp
+  802d79:	89 e5                	mov    %esp,%ebp
+  802d7b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d81:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802d86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d89:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d8e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d93:	e8 0d ff ff ff       	call   802ca5 <nsipc>
+}
+  802d98:	c9                   	leave
+  802d99:	c3                   	ret
+
+00802d9a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d9a:	55                   	push   %ebp
+  802d9b:	89 e5                	mov    %esp,%ebp
+  802d9d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802da0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da3:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802da8:	b8 04 00 00 00       	mov    $0x4,%eax
+  802dad:	e8 f3 fe ff ff       	call   802ca5 <nsipc>
+}
+  802db2:	c9                   	leave
+  802db3:	c3                   	ret
+
+00802db4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802db4:	55                   	push   %ebp
+  802db5:	89 e5                	mov    %esp,%ebp
+  802db7:	53                   	push   %ebx
+  802db8:	83 ec 08             	sub    $0x8,%esp
+  802dbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc1:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802dc6:	53                   	push   %ebx
+  802dc7:	ff 75 0c             	push   0xc(%ebp)
+  802dca:	68 04 90 80 00       	push   $0x809004
+  802dcf:	e8 29 df ff ff       	call   800cfd <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802dd4:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  802dda:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ddf:	e8 c1 fe ff ff       	call   802ca5 <nsipc>
+}
+  802de4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802de7:	c9                   	leave
+  802de8:	c3                   	ret
+
+00802de9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802de9:	55                   	push   %ebp
+  802dea:	89 e5                	mov    %esp,%ebp
+  802dec:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802def:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df2:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  802df7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dfa:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  802dff:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e04:	e8 9c fe ff ff       	call   802ca5 <nsipc>
+}
+  802e09:	c9                   	leave
+  802e0a:	c3                   	ret
+
+00802e0b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e0b:	55                   	push   %ebp
+  802e0c:	89 e5                	mov    %esp,%ebp
+  802e0e:	56                   	push   %esi
+  802e0f:	53                   	push   %ebx
+  802e10:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e16:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  802e1b:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  802e21:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e24:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e29:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e2e:	e8 72 fe ff ff       	call   802ca5 <nsipc>
+  802e33:	89 c3                	mov    %eax,%ebx
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	78 22                	js     802e5b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e39:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e3e:	39 c6                	cmp    %eax,%esi
+  802e40:	0f 4e c6             	cmovle %esi,%eax
+  802e43:	39 c3                	cmp    %eax,%ebx
+  802e45:	7f 1d                	jg     802e64 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e47:	83 ec 04             	sub    $0x4,%esp
+  802e4a:	53                   	push   %ebx
+  802e4b:	68 00 90 80 00       	push   $0x809000
+  802e50:	ff 75 0c             	push   0xc(%ebp)
+  802e53:	e8 a5 de ff ff       	call   800cfd <memmove>
+  802e58:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e5b:	89 d8                	mov    %ebx,%eax
+  802e5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e60:	5b                   	pop    %ebx
+  802e61:	5e                   	pop    %esi
+  802e62:	5d                   	pop    %ebp
+  802e63:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e64:	68 7e 3d 80 00       	push   $0x803d7e
+  802e69:	68 6f 3c 80 00       	push   $0x803c6f
+  802e6e:	6a 62                	push   $0x62
+  802e70:	68 93 3d 80 00       	push   $0x803d93
+  802e75:	e8 da d5 ff ff       	call   800454 <_panic>
+
+00802e7a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e7a:	55                   	push   %ebp
+  802e7b:	89 e5                	mov    %esp,%ebp
+  802e7d:	53                   	push   %ebx
+  802e7e:	83 ec 04             	sub    $0x4,%esp
+  802e81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e84:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e87:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  802e8c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e92:	7f 2e                	jg     802ec2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e94:	83 ec 04             	sub    $0x4,%esp
+  802e97:	53                   	push   %ebx
+  802e98:	ff 75 0c             	push   0xc(%ebp)
+  802e9b:	68 0c 90 80 00       	push   $0x80900c
+  802ea0:	e8 58 de ff ff       	call   800cfd <memmove>
+	nsipcbuf.send.req_size = size;
+  802ea5:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  802eab:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eae:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802eb3:	b8 08 00 00 00       	mov    $0x8,%eax
+  802eb8:	e8 e8 fd ff ff       	call   802ca5 <nsipc>
+}
+  802ebd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ec0:	c9                   	leave
+  802ec1:	c3                   	ret
+	assert(size < 1600);
+  802ec2:	68 9f 3d 80 00       	push   $0x803d9f
+  802ec7:	68 6f 3c 80 00       	push   $0x803c6f
+  802ecc:	6a 6d                	push   $0x6d
+  802ece:	68 93 3d 80 00       	push   $0x803d93
+  802ed3:	e8 7c d5 ff ff       	call   800454 <_panic>
+
+00802ed8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802ed8:	55                   	push   %ebp
+  802ed9:	89 e5                	mov    %esp,%ebp
+  802edb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802ede:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee1:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802ee6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ee9:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802eee:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ef1:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802ef6:	b8 09 00 00 00       	mov    $0x9,%eax
+  802efb:	e8 a5 fd ff ff       	call   802ca5 <nsipc>
+}
+  802f00:	c9                   	leave
+  802f01:	c3                   	ret
+
+00802f02 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f02:	55                   	push   %ebp
+  802f03:	89 e5                	mov    %esp,%ebp
+  802f05:	56                   	push   %esi
+  802f06:	53                   	push   %ebx
+  802f07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f0a:	83 ec 0c             	sub    $0xc,%esp
+  802f0d:	ff 75 08             	push   0x8(%ebp)
+  802f10:	e8 e0 eb ff ff       	call   801af5 <fd2data>
+  802f15:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f17:	83 c4 08             	add    $0x8,%esp
+  802f1a:	68 ab 3d 80 00       	push   $0x803dab
+  802f1f:	53                   	push   %ebx
+  802f20:	e8 52 dc ff ff       	call   800b77 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f25:	8b 46 04             	mov    0x4(%esi),%eax
+  802f28:	2b 06                	sub    (%esi),%eax
+  802f2a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f30:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f37:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f3a:	c7 83 88 00 00 00 c8 	movl   $0x8057c8,0x88(%ebx)
+  802f41:	57 80 00 
+	return 0;
+}
+  802f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f4c:	5b                   	pop    %ebx
+  802f4d:	5e                   	pop    %esi
+  802f4e:	5d                   	pop    %ebp
+  802f4f:	c3                   	ret
+
+00802f50 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f50:	55                   	push   %ebp
+  802f51:	89 e5                	mov    %esp,%ebp
+  802f53:	53                   	push   %ebx
+  802f54:	83 ec 0c             	sub    $0xc,%esp
+  802f57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f5a:	53                   	push   %ebx
+  802f5b:	6a 00                	push   $0x0
+  802f5d:	e8 e8 e1 ff ff       	call   80114a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f62:	89 1c 24             	mov    %ebx,(%esp)
+  802f65:	e8 8b eb ff ff       	call   801af5 <fd2data>
+  802f6a:	83 c4 08             	add    $0x8,%esp
+  802f6d:	50                   	push   %eax
+  802f6e:	6a 00                	push   $0x0
+  802f70:	e8 d5 e1 ff ff       	call   80114a <sys_page_unmap>
+}
+  802f75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f78:	c9                   	leave
+  802f79:	c3                   	ret
+
+00802f7a <_pipeisclosed>:
+{
+  802f7a:	55                   	push   %ebp
+  802f7b:	89 e5                	mov    %esp,%ebp
+  802f7d:	57                   	push   %edi
+  802f7e:	56                   	push   %esi
+  802f7f:	53                   	push   %ebx
+  802f80:	83 ec 1c             	sub    $0x1c,%esp
+  802f83:	89 c7                	mov    %eax,%edi
+  802f85:	89 d6                	mov    %edx,%esi
+  802f87:	eb 3c                	jmp    802fc5 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802f89:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f8c:	83 ec 0c             	sub    $0xc,%esp
+  802f8f:	57                   	push   %edi
+  802f90:	e8 13 07 00 00       	call   8036a8 <pageref>
+  802f95:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f98:	89 34 24             	mov    %esi,(%esp)
+  802f9b:	e8 08 07 00 00       	call   8036a8 <pageref>
+  802fa0:	89 c2                	mov    %eax,%edx
+  802fa2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fa4:	05 00 00 00 20       	add    $0x20000000,%eax
+  802fa9:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802fac:	8b 0d 90 77 80 00    	mov    0x807790,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fb2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802fb7:	76 31                	jbe    802fea <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802fb9:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802fbc:	39 c3                	cmp    %eax,%ebx
+  802fbe:	74 76                	je     803036 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802fc0:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802fc3:	74 36                	je     802ffb <_pipeisclosed+0x81>
+  802fc5:	89 e0                	mov    %esp,%eax
+  802fc7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802fcc:	8b 15 90 77 80 00    	mov    0x807790,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fd2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802fd7:	77 b0                	ja     802f89 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802fd9:	c1 e8 10             	shr    $0x10,%eax
+  802fdc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fe2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802fe8:	eb 9f                	jmp    802f89 <_pipeisclosed+0xf>
+  802fea:	c1 e8 10             	shr    $0x10,%eax
+  802fed:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ff3:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802ff9:	eb be                	jmp    802fb9 <_pipeisclosed+0x3f>
+  802ffb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ffd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803002:	8b 15 90 77 80 00    	mov    0x807790,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803008:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80300d:	76 16                	jbe    803025 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80300f:	8b 42 58             	mov    0x58(%edx),%eax
+  803012:	6a 01                	push   $0x1
+  803014:	50                   	push   %eax
+  803015:	53                   	push   %ebx
+  803016:	68 b2 3d 80 00       	push   $0x803db2
+  80301b:	e8 0f d5 ff ff       	call   80052f <cprintf>
+  803020:	83 c4 10             	add    $0x10,%esp
+  803023:	eb a0                	jmp    802fc5 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803025:	c1 e8 10             	shr    $0x10,%eax
+  803028:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80302e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803034:	eb d9                	jmp    80300f <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  803036:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  803039:	0f 94 c0             	sete   %al
+  80303c:	0f b6 c0             	movzbl %al,%eax
+}
+  80303f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803042:	5b                   	pop    %ebx
+  803043:	5e                   	pop    %esi
+  803044:	5f                   	pop    %edi
+  803045:	5d                   	pop    %ebp
+  803046:	c3                   	ret
+
+00803047 <devpipe_write>:
+{
+  803047:	55                   	push   %ebp
+  803048:	89 e5                	mov    %esp,%ebp
+  80304a:	57                   	push   %edi
+  80304b:	56                   	push   %esi
+  80304c:	53                   	push   %ebx
+  80304d:	83 ec 28             	sub    $0x28,%esp
+  803050:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803053:	56                   	push   %esi
+  803054:	e8 9c ea ff ff       	call   801af5 <fd2data>
+  803059:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80305b:	83 c4 10             	add    $0x10,%esp
+  80305e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803063:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803066:	75 09                	jne    803071 <devpipe_write+0x2a>
+	return i;
+  803068:	89 f8                	mov    %edi,%eax
+  80306a:	eb 23                	jmp    80308f <devpipe_write+0x48>
+			sys_yield();
+  80306c:	e8 b8 df ff ff       	call   801029 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803071:	8b 43 04             	mov    0x4(%ebx),%eax
+  803074:	8b 0b                	mov    (%ebx),%ecx
+  803076:	8d 51 20             	lea    0x20(%ecx),%edx
+  803079:	39 d0                	cmp    %edx,%eax
+  80307b:	72 1a                	jb     803097 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80307d:	89 da                	mov    %ebx,%edx
+  80307f:	89 f0                	mov    %esi,%eax
+  803081:	e8 f4 fe ff ff       	call   802f7a <_pipeisclosed>
+  803086:	85 c0                	test   %eax,%eax
+  803088:	74 e2                	je     80306c <devpipe_write+0x25>
+				return 0;
+  80308a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80308f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803092:	5b                   	pop    %ebx
+  803093:	5e                   	pop    %esi
+  803094:	5f                   	pop    %edi
+  803095:	5d                   	pop    %ebp
+  803096:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80309a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80309e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030a1:	89 c2                	mov    %eax,%edx
+  8030a3:	c1 fa 1f             	sar    $0x1f,%edx
+  8030a6:	89 d1                	mov    %edx,%ecx
+  8030a8:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030ab:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030ae:	83 e2 1f             	and    $0x1f,%edx
+  8030b1:	29 ca                	sub    %ecx,%edx
+  8030b3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030b7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8030bb:	83 c0 01             	add    $0x1,%eax
+  8030be:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030c1:	83 c7 01             	add    $0x1,%edi
+  8030c4:	eb 9d                	jmp    803063 <devpipe_write+0x1c>
+
+008030c6 <devpipe_read>:
+{
+  8030c6:	55                   	push   %ebp
+  8030c7:	89 e5                	mov    %esp,%ebp
+  8030c9:	57                   	push   %edi
+  8030ca:	56                   	push   %esi
+  8030cb:	53                   	push   %ebx
+  8030cc:	83 ec 18             	sub    $0x18,%esp
+  8030cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8030d2:	57                   	push   %edi
+  8030d3:	e8 1d ea ff ff       	call   801af5 <fd2data>
+  8030d8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030da:	83 c4 10             	add    $0x10,%esp
+  8030dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030e5:	75 13                	jne    8030fa <devpipe_read+0x34>
+	return i;
+  8030e7:	89 f0                	mov    %esi,%eax
+  8030e9:	eb 02                	jmp    8030ed <devpipe_read+0x27>
+				return i;
+  8030eb:	89 f0                	mov    %esi,%eax
+}
+  8030ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030f0:	5b                   	pop    %ebx
+  8030f1:	5e                   	pop    %esi
+  8030f2:	5f                   	pop    %edi
+  8030f3:	5d                   	pop    %ebp
+  8030f4:	c3                   	ret
+			sys_yield();
+  8030f5:	e8 2f df ff ff       	call   801029 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8030fa:	8b 03                	mov    (%ebx),%eax
+  8030fc:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030ff:	75 18                	jne    803119 <devpipe_read+0x53>
+			if (i > 0)
+  803101:	85 f6                	test   %esi,%esi
+  803103:	75 e6                	jne    8030eb <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803105:	89 da                	mov    %ebx,%edx
+  803107:	89 f8                	mov    %edi,%eax
+  803109:	e8 6c fe ff ff       	call   802f7a <_pipeisclosed>
+  80310e:	85 c0                	test   %eax,%eax
+  803110:	74 e3                	je     8030f5 <devpipe_read+0x2f>
+				return 0;
+  803112:	b8 00 00 00 00       	mov    $0x0,%eax
+  803117:	eb d4                	jmp    8030ed <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803119:	99                   	cltd
+  80311a:	c1 ea 1b             	shr    $0x1b,%edx
+  80311d:	01 d0                	add    %edx,%eax
+  80311f:	83 e0 1f             	and    $0x1f,%eax
+  803122:	29 d0                	sub    %edx,%eax
+  803124:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80312c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80312f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803132:	83 c6 01             	add    $0x1,%esi
+  803135:	eb ab                	jmp    8030e2 <devpipe_read+0x1c>
+
+00803137 <pipe>:
+{
+  803137:	55                   	push   %ebp
+  803138:	89 e5                	mov    %esp,%ebp
+  80313a:	56                   	push   %esi
+  80313b:	53                   	push   %ebx
+  80313c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80313f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803142:	50                   	push   %eax
+  803143:	e8 c4 e9 ff ff       	call   801b0c <fd_alloc>
+  803148:	89 c3                	mov    %eax,%ebx
+  80314a:	83 c4 10             	add    $0x10,%esp
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	0f 88 23 01 00 00    	js     803278 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803155:	83 ec 04             	sub    $0x4,%esp
+  803158:	68 07 04 00 00       	push   $0x407
+  80315d:	ff 75 f4             	push   -0xc(%ebp)
+  803160:	6a 00                	push   $0x0
+  803162:	e8 08 df ff ff       	call   80106f <sys_page_alloc>
+  803167:	89 c3                	mov    %eax,%ebx
+  803169:	83 c4 10             	add    $0x10,%esp
+  80316c:	85 c0                	test   %eax,%eax
+  80316e:	0f 88 04 01 00 00    	js     803278 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803174:	83 ec 0c             	sub    $0xc,%esp
+  803177:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80317a:	50                   	push   %eax
+  80317b:	e8 8c e9 ff ff       	call   801b0c <fd_alloc>
+  803180:	89 c3                	mov    %eax,%ebx
+  803182:	83 c4 10             	add    $0x10,%esp
+  803185:	85 c0                	test   %eax,%eax
+  803187:	0f 88 db 00 00 00    	js     803268 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80318d:	83 ec 04             	sub    $0x4,%esp
+  803190:	68 07 04 00 00       	push   $0x407
+  803195:	ff 75 f0             	push   -0x10(%ebp)
+  803198:	6a 00                	push   $0x0
+  80319a:	e8 d0 de ff ff       	call   80106f <sys_page_alloc>
+  80319f:	89 c3                	mov    %eax,%ebx
+  8031a1:	83 c4 10             	add    $0x10,%esp
+  8031a4:	85 c0                	test   %eax,%eax
+  8031a6:	0f 88 bc 00 00 00    	js     803268 <pipe+0x131>
+	va = fd2data(fd0);
+  8031ac:	83 ec 0c             	sub    $0xc,%esp
+  8031af:	ff 75 f4             	push   -0xc(%ebp)
+  8031b2:	e8 3e e9 ff ff       	call   801af5 <fd2data>
+  8031b7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031b9:	83 c4 0c             	add    $0xc,%esp
+  8031bc:	68 07 04 00 00       	push   $0x407
+  8031c1:	50                   	push   %eax
+  8031c2:	6a 00                	push   $0x0
+  8031c4:	e8 a6 de ff ff       	call   80106f <sys_page_alloc>
+  8031c9:	89 c3                	mov    %eax,%ebx
+  8031cb:	83 c4 10             	add    $0x10,%esp
+  8031ce:	85 c0                	test   %eax,%eax
+  8031d0:	0f 88 82 00 00 00    	js     803258 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031d6:	83 ec 0c             	sub    $0xc,%esp
+  8031d9:	ff 75 f0             	push   -0x10(%ebp)
+  8031dc:	e8 14 e9 ff ff       	call   801af5 <fd2data>
+  8031e1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8031e8:	50                   	push   %eax
+  8031e9:	6a 00                	push   $0x0
+  8031eb:	56                   	push   %esi
+  8031ec:	6a 00                	push   $0x0
+  8031ee:	e8 e9 de ff ff       	call   8010dc <sys_page_map>
+  8031f3:	89 c3                	mov    %eax,%ebx
+  8031f5:	83 c4 20             	add    $0x20,%esp
+  8031f8:	85 c0                	test   %eax,%eax
+  8031fa:	78 4e                	js     80324a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031fc:	a1 c8 57 80 00       	mov    0x8057c8,%eax
+  803201:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803204:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803206:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803209:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803210:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803213:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803215:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803218:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80321f:	83 ec 0c             	sub    $0xc,%esp
+  803222:	ff 75 f4             	push   -0xc(%ebp)
+  803225:	e8 bb e8 ff ff       	call   801ae5 <fd2num>
+  80322a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80322d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80322f:	83 c4 04             	add    $0x4,%esp
+  803232:	ff 75 f0             	push   -0x10(%ebp)
+  803235:	e8 ab e8 ff ff       	call   801ae5 <fd2num>
+  80323a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80323d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803240:	83 c4 10             	add    $0x10,%esp
+  803243:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803248:	eb 2e                	jmp    803278 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80324a:	83 ec 08             	sub    $0x8,%esp
+  80324d:	56                   	push   %esi
+  80324e:	6a 00                	push   $0x0
+  803250:	e8 f5 de ff ff       	call   80114a <sys_page_unmap>
+  803255:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803258:	83 ec 08             	sub    $0x8,%esp
+  80325b:	ff 75 f0             	push   -0x10(%ebp)
+  80325e:	6a 00                	push   $0x0
+  803260:	e8 e5 de ff ff       	call   80114a <sys_page_unmap>
+  803265:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803268:	83 ec 08             	sub    $0x8,%esp
+  80326b:	ff 75 f4             	push   -0xc(%ebp)
+  80326e:	6a 00                	push   $0x0
+  803270:	e8 d5 de ff ff       	call   80114a <sys_page_unmap>
+  803275:	83 c4 10             	add    $0x10,%esp
+}
+  803278:	89 d8                	mov    %ebx,%eax
+  80327a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80327d:	5b                   	pop    %ebx
+  80327e:	5e                   	pop    %esi
+  80327f:	5d                   	pop    %ebp
+  803280:	c3                   	ret
+
+00803281 <pipeisclosed>:
+{
+  803281:	55                   	push   %ebp
+  803282:	89 e5                	mov    %esp,%ebp
+  803284:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803287:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80328a:	50                   	push   %eax
+  80328b:	ff 75 08             	push   0x8(%ebp)
+  80328e:	e8 cf e8 ff ff       	call   801b62 <fd_lookup>
+  803293:	83 c4 10             	add    $0x10,%esp
+  803296:	85 c0                	test   %eax,%eax
+  803298:	78 18                	js     8032b2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80329a:	83 ec 0c             	sub    $0xc,%esp
+  80329d:	ff 75 f4             	push   -0xc(%ebp)
+  8032a0:	e8 50 e8 ff ff       	call   801af5 <fd2data>
+  8032a5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032aa:	e8 cb fc ff ff       	call   802f7a <_pipeisclosed>
+  8032af:	83 c4 10             	add    $0x10,%esp
+}
+  8032b2:	c9                   	leave
+  8032b3:	c3                   	ret
+
+008032b4 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8032b4:	55                   	push   %ebp
+  8032b5:	89 e5                	mov    %esp,%ebp
+  8032b7:	56                   	push   %esi
+  8032b8:	53                   	push   %ebx
+  8032b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8032bc:	85 f6                	test   %esi,%esi
+  8032be:	74 16                	je     8032d6 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  8032c0:	89 f3                	mov    %esi,%ebx
+  8032c2:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8032c8:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  8032ce:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8032d4:	eb 1b                	jmp    8032f1 <wait+0x3d>
+	assert(envid != 0);
+  8032d6:	68 ca 3d 80 00       	push   $0x803dca
+  8032db:	68 6f 3c 80 00       	push   $0x803c6f
+  8032e0:	6a 09                	push   $0x9
+  8032e2:	68 d5 3d 80 00       	push   $0x803dd5
+  8032e7:	e8 68 d1 ff ff       	call   800454 <_panic>
+		sys_yield();
+  8032ec:	e8 38 dd ff ff       	call   801029 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8032f1:	8b 43 48             	mov    0x48(%ebx),%eax
+  8032f4:	39 f0                	cmp    %esi,%eax
+  8032f6:	75 07                	jne    8032ff <wait+0x4b>
+  8032f8:	8b 43 54             	mov    0x54(%ebx),%eax
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	75 ed                	jne    8032ec <wait+0x38>
+}
+  8032ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803302:	5b                   	pop    %ebx
+  803303:	5e                   	pop    %esi
+  803304:	5d                   	pop    %ebp
+  803305:	c3                   	ret
+
+00803306 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  803306:	55                   	push   %ebp
+  803307:	89 e5                	mov    %esp,%ebp
+  803309:	56                   	push   %esi
+  80330a:	53                   	push   %ebx
+  80330b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80330e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803311:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803314:	85 c0                	test   %eax,%eax
+  803316:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80331b:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  80331e:	83 ec 08             	sub    $0x8,%esp
+  803321:	ff 75 14             	push   0x14(%ebp)
+  803324:	50                   	push   %eax
+  803325:	e8 56 e1 ff ff       	call   801480 <sys_ipc_recv_until>
+  80332a:	83 c4 10             	add    $0x10,%esp
+  80332d:	85 c0                	test   %eax,%eax
+  80332f:	78 61                	js     803392 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  803331:	85 f6                	test   %esi,%esi
+  803333:	74 1c                	je     803351 <ipc_recv_until+0x4b>
+  803335:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803337:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80333c:	8b 15 90 77 80 00    	mov    0x807790,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803342:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803347:	76 5f                	jbe    8033a8 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  803349:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  80334f:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803351:	85 db                	test   %ebx,%ebx
+  803353:	74 1c                	je     803371 <ipc_recv_until+0x6b>
+  803355:	89 e0                	mov    %esp,%eax
+  803357:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80335c:	8b 15 90 77 80 00    	mov    0x807790,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803362:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803367:	76 50                	jbe    8033b9 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  803369:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  80336f:	89 03                	mov    %eax,(%ebx)
+  803371:	89 e0                	mov    %esp,%eax
+  803373:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803378:	8b 15 90 77 80 00    	mov    0x807790,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80337e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803383:	76 45                	jbe    8033ca <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803385:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80338b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80338e:	5b                   	pop    %ebx
+  80338f:	5e                   	pop    %esi
+  803390:	5d                   	pop    %ebp
+  803391:	c3                   	ret
+		if (from_env_store)
+  803392:	85 f6                	test   %esi,%esi
+  803394:	74 06                	je     80339c <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803396:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  80339c:	85 db                	test   %ebx,%ebx
+  80339e:	74 eb                	je     80338b <ipc_recv_until+0x85>
+			*perm_store = 0;
+  8033a0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8033a6:	eb e3                	jmp    80338b <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8033a8:	c1 e8 10             	shr    $0x10,%eax
+  8033ab:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033b1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033b7:	eb 90                	jmp    803349 <ipc_recv_until+0x43>
+  8033b9:	c1 e8 10             	shr    $0x10,%eax
+  8033bc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033c2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033c8:	eb 9f                	jmp    803369 <ipc_recv_until+0x63>
+  8033ca:	c1 e8 10             	shr    $0x10,%eax
+  8033cd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033d3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033d9:	eb aa                	jmp    803385 <ipc_recv_until+0x7f>
+
+008033db <ipc_recv>:
+{
+  8033db:	55                   	push   %ebp
+  8033dc:	89 e5                	mov    %esp,%ebp
+  8033de:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8033e1:	6a 00                	push   $0x0
+  8033e3:	ff 75 10             	push   0x10(%ebp)
+  8033e6:	ff 75 0c             	push   0xc(%ebp)
+  8033e9:	ff 75 08             	push   0x8(%ebp)
+  8033ec:	e8 15 ff ff ff       	call   803306 <ipc_recv_until>
+}
+  8033f1:	c9                   	leave
+  8033f2:	c3                   	ret
+
+008033f3 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8033f3:	55                   	push   %ebp
+  8033f4:	89 e5                	mov    %esp,%ebp
+  8033f6:	57                   	push   %edi
+  8033f7:	56                   	push   %esi
+  8033f8:	53                   	push   %ebx
+  8033f9:	83 ec 0c             	sub    $0xc,%esp
+  8033fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033ff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803402:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803405:	85 db                	test   %ebx,%ebx
+  803407:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80340c:	0f 44 d8             	cmove  %eax,%ebx
+  80340f:	eb 05                	jmp    803416 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803411:	e8 13 dc ff ff       	call   801029 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  803416:	ff 75 14             	push   0x14(%ebp)
+  803419:	53                   	push   %ebx
+  80341a:	56                   	push   %esi
+  80341b:	57                   	push   %edi
+  80341c:	e8 ab df ff ff       	call   8013cc <sys_ipc_try_send>
+  803421:	83 c4 10             	add    $0x10,%esp
+  803424:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803427:	74 e8                	je     803411 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  803429:	85 c0                	test   %eax,%eax
+  80342b:	78 08                	js     803435 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  80342d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803430:	5b                   	pop    %ebx
+  803431:	5e                   	pop    %esi
+  803432:	5f                   	pop    %edi
+  803433:	5d                   	pop    %ebp
+  803434:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  803435:	50                   	push   %eax
+  803436:	68 e0 3d 80 00       	push   $0x803de0
+  80343b:	6a 4f                	push   $0x4f
+  80343d:	68 f3 3d 80 00       	push   $0x803df3
+  803442:	e8 0d d0 ff ff       	call   800454 <_panic>
+
+00803447 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80344d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803452:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  803458:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80345e:	8b 52 50             	mov    0x50(%edx),%edx
+  803461:	39 ca                	cmp    %ecx,%edx
+  803463:	74 11                	je     803476 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803465:	83 c0 01             	add    $0x1,%eax
+  803468:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80346d:	75 e3                	jne    803452 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80346f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803474:	eb 0e                	jmp    803484 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803476:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80347c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803481:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803484:	5d                   	pop    %ebp
+  803485:	c3                   	ret
+
+00803486 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  803486:	55                   	push   %ebp
+  803487:	89 e5                	mov    %esp,%ebp
+  803489:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  80348c:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  803493:	00 00 00 
+	b->b_error = 0;
+  803496:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  80349d:	00 00 00 
+}
+  8034a0:	5d                   	pop    %ebp
+  8034a1:	c3                   	ret
+
+008034a2 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  8034a2:	55                   	push   %ebp
+  8034a3:	89 e5                	mov    %esp,%ebp
+  8034a5:	53                   	push   %ebx
+  8034a6:	83 ec 04             	sub    $0x4,%esp
+  8034a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  8034ac:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8034b2:	85 c0                	test   %eax,%eax
+  8034b4:	7e 09                	jle    8034bf <batch_flush+0x1d>
+  8034b6:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  8034bd:	74 15                	je     8034d4 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  8034bf:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  8034c6:	00 00 00 
+	return b->b_error;
+  8034c9:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  8034cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034d2:	c9                   	leave
+  8034d3:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  8034d4:	83 ec 08             	sub    $0x8,%esp
+  8034d7:	50                   	push   %eax
+  8034d8:	53                   	push   %ebx
+  8034d9:	e8 77 e2 ff ff       	call   801755 <sys_batch>
+  8034de:	83 c4 10             	add    $0x10,%esp
+  8034e1:	85 c0                	test   %eax,%eax
+  8034e3:	79 da                	jns    8034bf <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  8034e5:	f7 d8                	neg    %eax
+  8034e7:	0f b6 c0             	movzbl %al,%eax
+  8034ea:	f7 d8                	neg    %eax
+  8034ec:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  8034f2:	eb cb                	jmp    8034bf <batch_flush+0x1d>
+
+008034f4 <batch_reserve>:
+{
+  8034f4:	55                   	push   %ebp
+  8034f5:	89 e5                	mov    %esp,%ebp
+  8034f7:	83 ec 08             	sub    $0x8,%esp
+  8034fa:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  8034fd:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  803503:	03 45 0c             	add    0xc(%ebp),%eax
+  803506:	83 f8 10             	cmp    $0x10,%eax
+  803509:	7f 02                	jg     80350d <batch_reserve+0x19>
+}
+  80350b:	c9                   	leave
+  80350c:	c3                   	ret
+		batch_flush(b);
+  80350d:	83 ec 0c             	sub    $0xc,%esp
+  803510:	52                   	push   %edx
+  803511:	e8 8c ff ff ff       	call   8034a2 <batch_flush>
+  803516:	83 c4 10             	add    $0x10,%esp
+}
+  803519:	eb f0                	jmp    80350b <batch_reserve+0x17>
+
+0080351b <batch_next>:
+{
+  80351b:	55                   	push   %ebp
+  80351c:	89 e5                	mov    %esp,%ebp
+  80351e:	53                   	push   %ebx
+  80351f:	83 ec 04             	sub    $0x4,%esp
+  803522:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  803524:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  80352b:	74 28                	je     803555 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  80352d:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  803533:	8d 50 01             	lea    0x1(%eax),%edx
+  803536:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  80353c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80353f:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  803541:	83 ec 04             	sub    $0x4,%esp
+  803544:	6a 1c                	push   $0x1c
+  803546:	6a 00                	push   $0x0
+  803548:	53                   	push   %ebx
+  803549:	e8 7a d7 ff ff       	call   800cc8 <memset>
+}
+  80354e:	89 d8                	mov    %ebx,%eax
+  803550:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803553:	c9                   	leave
+  803554:	c3                   	ret
+		batch_flush(b);
+  803555:	83 ec 0c             	sub    $0xc,%esp
+  803558:	50                   	push   %eax
+  803559:	e8 44 ff ff ff       	call   8034a2 <batch_flush>
+  80355e:	83 c4 10             	add    $0x10,%esp
+  803561:	eb ca                	jmp    80352d <batch_next+0x12>
+
+00803563 <batch_page>:
+{
+  803563:	55                   	push   %ebp
+  803564:	89 e5                	mov    %esp,%ebp
+  803566:	57                   	push   %edi
+  803567:	56                   	push   %esi
+  803568:	53                   	push   %ebx
+  803569:	83 ec 1c             	sub    $0x1c,%esp
+  80356c:	89 d3                	mov    %edx,%ebx
+  80356e:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  803570:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  803576:	85 d2                	test   %edx,%edx
+  803578:	74 50                	je     8035ca <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  80357a:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  80357d:	01 c1                	add    %eax,%ecx
+  80357f:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  803582:	75 46                	jne    8035ca <batch_page+0x67>
+  803584:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  803587:	75 41                	jne    8035ca <batch_page+0x67>
+  803589:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  80358c:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  80358f:	75 39                	jne    8035ca <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  803591:	83 ea 01             	sub    $0x1,%edx
+  803594:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  803597:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  80359a:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  80359e:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8035a1:	75 27                	jne    8035ca <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8035a3:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8035a6:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8035aa:	89 fa                	mov    %edi,%edx
+  8035ac:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8035af:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8035b2:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8035b5:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8035b8:	75 10                	jne    8035ca <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8035ba:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8035be:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8035c1:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8035c5:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8035c8:	74 2a                	je     8035f4 <batch_page+0x91>
+	op = batch_next(b);
+  8035ca:	e8 4c ff ff ff       	call   80351b <batch_next>
+	op->bo_op = opcode;
+  8035cf:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  8035d1:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  8035d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035d7:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  8035da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8035dd:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  8035e0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8035e3:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  8035e6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8035e9:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  8035ec:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8035ef:	89 78 14             	mov    %edi,0x14(%eax)
+  8035f2:	eb 0b                	jmp    8035ff <batch_page+0x9c>
+		op->bo_npages += npages;
+  8035f4:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  8035f8:	03 7d 18             	add    0x18(%ebp),%edi
+  8035fb:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  8035ff:	83 c4 1c             	add    $0x1c,%esp
+  803602:	5b                   	pop    %ebx
+  803603:	5e                   	pop    %esi
+  803604:	5f                   	pop    %edi
+  803605:	5d                   	pop    %ebp
+  803606:	c3                   	ret
+
+00803607 <batch_alloc>:
+{
+  803607:	55                   	push   %ebp
+  803608:	89 e5                	mov    %esp,%ebp
+  80360a:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  80360d:	ff 75 18             	push   0x18(%ebp)
+  803610:	ff 75 14             	push   0x14(%ebp)
+  803613:	ff 75 10             	push   0x10(%ebp)
+  803616:	ff 75 0c             	push   0xc(%ebp)
+  803619:	6a 00                	push   $0x0
+  80361b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803620:	ba 00 00 00 00       	mov    $0x0,%edx
+  803625:	8b 45 08             	mov    0x8(%ebp),%eax
+  803628:	e8 36 ff ff ff       	call   803563 <batch_page>
+}
+  80362d:	83 c4 20             	add    $0x20,%esp
+  803630:	c9                   	leave
+  803631:	c3                   	ret
+
+00803632 <batch_map>:
+{
+  803632:	55                   	push   %ebp
+  803633:	89 e5                	mov    %esp,%ebp
+  803635:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  803638:	ff 75 20             	push   0x20(%ebp)
+  80363b:	ff 75 1c             	push   0x1c(%ebp)
+  80363e:	ff 75 18             	push   0x18(%ebp)
+  803641:	ff 75 14             	push   0x14(%ebp)
+  803644:	ff 75 10             	push   0x10(%ebp)
+  803647:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80364a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80364f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803652:	e8 0c ff ff ff       	call   803563 <batch_page>
+}
+  803657:	83 c4 20             	add    $0x20,%esp
+  80365a:	c9                   	leave
+  80365b:	c3                   	ret
+
+0080365c <batch_unmap>:
+{
+  80365c:	55                   	push   %ebp
+  80365d:	89 e5                	mov    %esp,%ebp
+  80365f:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  803662:	ff 75 14             	push   0x14(%ebp)
+  803665:	6a 00                	push   $0x0
+  803667:	ff 75 10             	push   0x10(%ebp)
+  80366a:	ff 75 0c             	push   0xc(%ebp)
+  80366d:	6a 00                	push   $0x0
+  80366f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803674:	ba 02 00 00 00       	mov    $0x2,%edx
+  803679:	8b 45 08             	mov    0x8(%ebp),%eax
+  80367c:	e8 e2 fe ff ff       	call   803563 <batch_page>
+}
+  803681:	83 c4 20             	add    $0x20,%esp
+  803684:	c9                   	leave
+  803685:	c3                   	ret
+
+00803686 <batch_set_status>:
+{
+  803686:	55                   	push   %ebp
+  803687:	89 e5                	mov    %esp,%ebp
+  803689:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  80368c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80368f:	e8 87 fe ff ff       	call   80351b <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  803694:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  80369a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80369d:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8036a0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036a3:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8036a6:	c9                   	leave
+  8036a7:	c3                   	ret
+
+008036a8 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8036a8:	55                   	push   %ebp
+  8036a9:	89 e5                	mov    %esp,%ebp
+  8036ab:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036ae:	89 c2                	mov    %eax,%edx
+  8036b0:	c1 ea 16             	shr    $0x16,%edx
+  8036b3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8036ba:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036bf:	f6 c1 01             	test   $0x1,%cl
+  8036c2:	74 1a                	je     8036de <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  8036c4:	c1 e8 0c             	shr    $0xc,%eax
+  8036c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8036ce:	a8 01                	test   $0x1,%al
+  8036d0:	74 0c                	je     8036de <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8036d2:	c1 e8 0c             	shr    $0xc,%eax
+  8036d5:	c1 e0 04             	shl    $0x4,%eax
+  8036d8:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8036de:	89 d0                	mov    %edx,%eax
+  8036e0:	5d                   	pop    %ebp
+  8036e1:	c3                   	ret
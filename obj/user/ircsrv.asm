@@ -0,0 +1,6801 @@
+
+obj/user/ircsrv.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 be 04 00 00       	call   8004ef <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <die>:
+    return -1;
+}
+
+static void
+die(char *m)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  800039:	50                   	push   %eax
+  80003a:	68 50 30 80 00       	push   $0x803050
+  80003f:	e8 4a 06 00 00       	call   80068e <cprintf>
+	exit();
+  800044:	e8 50 05 00 00       	call   800599 <exit>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <handle_client>:
+
+void
+handle_client(int sock)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	57                   	push   %edi
+  800052:	56                   	push   %esi
+  800053:	53                   	push   %ebx
+  800054:	83 ec 30             	sub    $0x30,%esp
+  800057:	8b 75 08             	mov    0x8(%ebp),%esi
+	char buffer[BUFFSIZE];
+	int received = -1;
+	// Receive message
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80005a:	6a 20                	push   $0x20
+  80005c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	56                   	push   %esi
+  800061:	e8 e1 1e 00 00       	call   801f47 <read>
+  800066:	89 c3                	mov    %eax,%ebx
+  800068:	83 c4 10             	add    $0x10,%esp
+		die("Failed to receive initial bytes from client");
+
+	// Send bytes and check for more incoming data in loop
+	while (received > 0) {
+		// Send back received data
+		if (write(sock, buffer, received) != received)
+  80006b:	8d 7d c8             	lea    -0x38(%ebp),%edi
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	79 33                	jns    8000a5 <handle_client+0x57>
+		die("Failed to receive initial bytes from client");
+  800072:	b8 54 30 80 00       	mov    $0x803054,%eax
+  800077:	e8 b7 ff ff ff       	call   800033 <die>
+
+		// Check for more data
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+			die("Failed to receive additional bytes from client");
+	}
+	close(sock);
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	56                   	push   %esi
+  800080:	e8 86 1d 00 00       	call   801e0b <close>
+}
+  800085:	83 c4 10             	add    $0x10,%esp
+  800088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5f                   	pop    %edi
+  80008e:	5d                   	pop    %ebp
+  80008f:	c3                   	ret
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  800090:	83 ec 04             	sub    $0x4,%esp
+  800093:	6a 20                	push   $0x20
+  800095:	57                   	push   %edi
+  800096:	56                   	push   %esi
+  800097:	e8 ab 1e 00 00       	call   801f47 <read>
+  80009c:	89 c3                	mov    %eax,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	85 c0                	test   %eax,%eax
+  8000a3:	78 22                	js     8000c7 <handle_client+0x79>
+	while (received > 0) {
+  8000a5:	85 db                	test   %ebx,%ebx
+  8000a7:	7e d3                	jle    80007c <handle_client+0x2e>
+		if (write(sock, buffer, received) != received)
+  8000a9:	83 ec 04             	sub    $0x4,%esp
+  8000ac:	53                   	push   %ebx
+  8000ad:	57                   	push   %edi
+  8000ae:	56                   	push   %esi
+  8000af:	e8 81 1f 00 00       	call   802035 <write>
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	39 d8                	cmp    %ebx,%eax
+  8000b9:	74 d5                	je     800090 <handle_client+0x42>
+			die("Failed to send bytes to client");
+  8000bb:	b8 80 30 80 00       	mov    $0x803080,%eax
+  8000c0:	e8 6e ff ff ff       	call   800033 <die>
+  8000c5:	eb c9                	jmp    800090 <handle_client+0x42>
+			die("Failed to receive additional bytes from client");
+  8000c7:	b8 a0 30 80 00       	mov    $0x8030a0,%eax
+  8000cc:	e8 62 ff ff ff       	call   800033 <die>
+  8000d1:	eb d2                	jmp    8000a5 <handle_client+0x57>
+
+008000d3 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	57                   	push   %edi
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+  8000d9:	83 ec 40             	sub    $0x40,%esp
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  8000dc:	6a 06                	push   $0x6
+  8000de:	6a 01                	push   $0x1
+  8000e0:	6a 02                	push   $0x2
+  8000e2:	e8 b1 25 00 00       	call   802698 <socket>
+  8000e7:	89 c6                	mov    %eax,%esi
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	85 c0                	test   %eax,%eax
+  8000ee:	0f 88 86 00 00 00    	js     80017a <umain+0xa7>
+		die("Failed to create socket");
+
+	cprintf("opened socket\n");
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	68 18 30 80 00       	push   $0x803018
+  8000fc:	e8 8d 05 00 00       	call   80068e <cprintf>
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	6a 10                	push   $0x10
+  800106:	6a 00                	push   $0x0
+  800108:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80010b:	53                   	push   %ebx
+  80010c:	e8 16 0d 00 00       	call   800e27 <memset>
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  800111:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	echoserver.sin_addr.s_addr = htonl(INADDR_ANY);   // IP address
+  800115:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80011c:	e8 90 01 00 00       	call   8002b1 <htonl>
+  800121:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  800124:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80012b:	e8 67 01 00 00       	call   800297 <htons>
+  800130:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+
+	cprintf("trying to bind\n");
+  800134:	c7 04 24 27 30 80 00 	movl   $0x803027,(%esp)
+  80013b:	e8 4e 05 00 00       	call   80068e <cprintf>
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &echoserver,
+  800140:	83 c4 0c             	add    $0xc,%esp
+  800143:	6a 10                	push   $0x10
+  800145:	53                   	push   %ebx
+  800146:	56                   	push   %esi
+  800147:	e8 ba 24 00 00       	call   802606 <bind>
+  80014c:	83 c4 10             	add    $0x10,%esp
+  80014f:	85 c0                	test   %eax,%eax
+  800151:	78 36                	js     800189 <umain+0xb6>
+		 sizeof(echoserver)) < 0) {
+		die("Failed to bind the server socket");
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800153:	83 ec 08             	sub    $0x8,%esp
+  800156:	6a 05                	push   $0x5
+  800158:	56                   	push   %esi
+  800159:	e8 17 25 00 00       	call   802675 <listen>
+  80015e:	83 c4 10             	add    $0x10,%esp
+  800161:	85 c0                	test   %eax,%eax
+  800163:	78 30                	js     800195 <umain+0xc2>
+		die("Failed to listen on server socket");
+
+	cprintf("bound\n");
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  800168:	68 37 30 80 00       	push   $0x803037
+  80016d:	e8 1c 05 00 00       	call   80068e <cprintf>
+  800172:	83 c4 10             	add    $0x10,%esp
+	// Run until canceled
+	while (1) {
+		unsigned int clientlen = sizeof(echoclient);
+		// Wait for client connection
+		if ((clientsock =
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  800175:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+  800178:	eb 55                	jmp    8001cf <umain+0xfc>
+		die("Failed to create socket");
+  80017a:	b8 00 30 80 00       	mov    $0x803000,%eax
+  80017f:	e8 af fe ff ff       	call   800033 <die>
+  800184:	e9 6b ff ff ff       	jmp    8000f4 <umain+0x21>
+		die("Failed to bind the server socket");
+  800189:	b8 d0 30 80 00       	mov    $0x8030d0,%eax
+  80018e:	e8 a0 fe ff ff       	call   800033 <die>
+  800193:	eb be                	jmp    800153 <umain+0x80>
+		die("Failed to listen on server socket");
+  800195:	b8 f4 30 80 00       	mov    $0x8030f4,%eax
+  80019a:	e8 94 fe ff ff       	call   800033 <die>
+  80019f:	eb c4                	jmp    800165 <umain+0x92>
+			    &clientlen)) < 0) {
+			die("Failed to accept client connection");
+  8001a1:	b8 18 31 80 00       	mov    $0x803118,%eax
+  8001a6:	e8 88 fe ff ff       	call   800033 <die>
+		}
+		cprintf("Client connected: %s\n", inet_ntoa(echoclient.sin_addr));
+  8001ab:	83 ec 0c             	sub    $0xc,%esp
+  8001ae:	ff 75 cc             	push   -0x34(%ebp)
+  8001b1:	e8 39 00 00 00       	call   8001ef <inet_ntoa>
+  8001b6:	83 c4 08             	add    $0x8,%esp
+  8001b9:	50                   	push   %eax
+  8001ba:	68 3e 30 80 00       	push   $0x80303e
+  8001bf:	e8 ca 04 00 00       	call   80068e <cprintf>
+		handle_client(clientsock);
+  8001c4:	89 1c 24             	mov    %ebx,(%esp)
+  8001c7:	e8 82 fe ff ff       	call   80004e <handle_client>
+	while (1) {
+  8001cc:	83 c4 10             	add    $0x10,%esp
+		unsigned int clientlen = sizeof(echoclient);
+  8001cf:	c7 45 c4 10 00 00 00 	movl   $0x10,-0x3c(%ebp)
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  8001d6:	83 ec 04             	sub    $0x4,%esp
+  8001d9:	57                   	push   %edi
+  8001da:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8001dd:	50                   	push   %eax
+  8001de:	56                   	push   %esi
+  8001df:	e8 f3 23 00 00       	call   8025d7 <accept>
+  8001e4:	89 c3                	mov    %eax,%ebx
+		if ((clientsock =
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	85 c0                	test   %eax,%eax
+  8001eb:	78 b4                	js     8001a1 <umain+0xce>
+  8001ed:	eb bc                	jmp    8001ab <umain+0xd8>
+
+008001ef <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8001ef:	55                   	push   %ebp
+  8001f0:	89 e5                	mov    %esp,%ebp
+  8001f2:	57                   	push   %edi
+  8001f3:	56                   	push   %esi
+  8001f4:	53                   	push   %ebx
+  8001f5:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8001f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  8001fe:	8d 7d f0             	lea    -0x10(%ebp),%edi
+  rp = str;
+  800201:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+    do {
+      rem = *ap % (u8_t)10;
+  800206:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  80020b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80020e:	eb 31                	jmp    800241 <inet_ntoa+0x52>
+      *ap /= (u8_t)10;
+      inv[i++] = '0' + rem;
+    } while(*ap);
+    while(i--)
+      *rp++ = inv[i];
+  800210:	0f b6 c8             	movzbl %al,%ecx
+  800213:	0f b6 4c 0d ed       	movzbl -0x13(%ebp,%ecx,1),%ecx
+  800218:	88 0a                	mov    %cl,(%edx)
+  80021a:	83 c2 01             	add    $0x1,%edx
+    while(i--)
+  80021d:	83 e8 01             	sub    $0x1,%eax
+  800220:	3c ff                	cmp    $0xff,%al
+  800222:	75 ec                	jne    800210 <inet_ntoa+0x21>
+  800224:	0f b6 db             	movzbl %bl,%ebx
+  800227:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80022a:	01 d8                	add    %ebx,%eax
+  80022c:	89 c3                	mov    %eax,%ebx
+    *rp++ = '.';
+  80022e:	8d 40 01             	lea    0x1(%eax),%eax
+  800231:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800234:	c6 03 2e             	movb   $0x2e,(%ebx)
+    ap++;
+  800237:	83 c7 01             	add    $0x1,%edi
+  for(n = 0; n < 4; n++) {
+  80023a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80023d:	39 c7                	cmp    %eax,%edi
+  80023f:	74 46                	je     800287 <inet_ntoa+0x98>
+  800241:	0f b6 17             	movzbl (%edi),%edx
+    i = 0;
+  800244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800249:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      rem = *ap % (u8_t)10;
+  80024c:	89 f0                	mov    %esi,%eax
+  80024e:	f6 e2                	mul    %dl
+  800250:	66 c1 e8 0b          	shr    $0xb,%ax
+  800254:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  800257:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+  80025a:	01 c9                	add    %ecx,%ecx
+  80025c:	89 d0                	mov    %edx,%eax
+  80025e:	29 c8                	sub    %ecx,%eax
+      *ap /= (u8_t)10;
+  800260:	89 d7                	mov    %edx,%edi
+  800262:	0f b6 55 e3          	movzbl -0x1d(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800266:	89 d9                	mov    %ebx,%ecx
+  800268:	83 c3 01             	add    $0x1,%ebx
+  80026b:	0f b6 c9             	movzbl %cl,%ecx
+  80026e:	83 c0 30             	add    $0x30,%eax
+  800271:	88 44 0d ed          	mov    %al,-0x13(%ebp,%ecx,1)
+    } while(*ap);
+  800275:	89 f8                	mov    %edi,%eax
+  800277:	3c 09                	cmp    $0x9,%al
+  800279:	77 d1                	ja     80024c <inet_ntoa+0x5d>
+  80027b:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  80027e:	88 17                	mov    %dl,(%edi)
+  800280:	8b 55 dc             	mov    -0x24(%ebp),%edx
+      inv[i++] = '0' + rem;
+  800283:	89 d8                	mov    %ebx,%eax
+  800285:	eb 96                	jmp    80021d <inet_ntoa+0x2e>
+  }
+  *--rp = 0;
+  800287:	c6 03 00             	movb   $0x0,(%ebx)
+  return str;
+}
+  80028a:	b8 00 50 80 00       	mov    $0x805000,%eax
+  80028f:	83 c4 1c             	add    $0x1c,%esp
+  800292:	5b                   	pop    %ebx
+  800293:	5e                   	pop    %esi
+  800294:	5f                   	pop    %edi
+  800295:	5d                   	pop    %ebp
+  800296:	c3                   	ret
+
+00800297 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80029a:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80029e:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+
+008002a4 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8002a7:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  8002ab:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+
+008002b1 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  8002b7:	89 d0                	mov    %edx,%eax
+  8002b9:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  8002bc:	89 d1                	mov    %edx,%ecx
+  8002be:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002c1:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	c1 e1 08             	shl    $0x8,%ecx
+  8002c8:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  8002ce:	09 c8                	or     %ecx,%eax
+  8002d0:	c1 ea 08             	shr    $0x8,%edx
+  8002d3:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  8002d9:	09 d0                	or     %edx,%eax
+}
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+
+008002dd <inet_aton>:
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	57                   	push   %edi
+  8002e1:	56                   	push   %esi
+  8002e2:	53                   	push   %ebx
+  8002e3:	83 ec 2c             	sub    $0x2c,%esp
+  8002e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  8002e9:	0f be 02             	movsbl (%edx),%eax
+  u32_t *pp = parts;
+  8002ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  8002ef:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  8002f2:	e9 9b 00 00 00       	jmp    800392 <inet_aton+0xb5>
+      c = *++cp;
+  8002f7:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  8002fb:	89 c1                	mov    %eax,%ecx
+  8002fd:	83 e1 df             	and    $0xffffffdf,%ecx
+  800300:	80 f9 58             	cmp    $0x58,%cl
+  800303:	74 10                	je     800315 <inet_aton+0x38>
+      c = *++cp;
+  800305:	83 c2 01             	add    $0x1,%edx
+  800308:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  80030b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800310:	e9 97 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        c = *++cp;
+  800315:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  800319:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  80031c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800321:	e9 86 00 00 00       	jmp    8003ac <inet_aton+0xcf>
+        val = (val * base) + (int)(c - '0');
+  800326:	0f af d7             	imul   %edi,%edx
+  800329:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  80032d:	0f be 01             	movsbl (%ecx),%eax
+  800330:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  800333:	88 45 d7             	mov    %al,-0x29(%ebp)
+  800336:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  800339:	80 fb 09             	cmp    $0x9,%bl
+  80033c:	76 e8                	jbe    800326 <inet_aton+0x49>
+      } else if (base == 16 && isxdigit(c)) {
+  80033e:	83 ff 10             	cmp    $0x10,%edi
+  800341:	75 2e                	jne    800371 <inet_aton+0x94>
+  800343:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  800347:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  80034a:	83 e3 df             	and    $0xffffffdf,%ebx
+  80034d:	83 eb 41             	sub    $0x41,%ebx
+  800350:	80 fb 05             	cmp    $0x5,%bl
+  800353:	77 1c                	ja     800371 <inet_aton+0x94>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  800355:	c1 e2 04             	shl    $0x4,%edx
+  800358:	83 c0 0a             	add    $0xa,%eax
+  80035b:	89 f3                	mov    %esi,%ebx
+  80035d:	80 fb 1a             	cmp    $0x1a,%bl
+  800360:	19 db                	sbb    %ebx,%ebx
+  800362:	83 e3 20             	and    $0x20,%ebx
+  800365:	83 c3 41             	add    $0x41,%ebx
+  800368:	29 d8                	sub    %ebx,%eax
+  80036a:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  80036c:	0f be 01             	movsbl (%ecx),%eax
+  80036f:	eb bf                	jmp    800330 <inet_aton+0x53>
+    if (c == '.') {
+  800371:	83 f8 2e             	cmp    $0x2e,%eax
+  800374:	75 43                	jne    8003b9 <inet_aton+0xdc>
+      if (pp >= parts + 3)
+  800376:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800379:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80037c:	39 f0                	cmp    %esi,%eax
+  80037e:	0f 84 22 01 00 00    	je     8004a6 <inet_aton+0x1c9>
+      *pp++ = val;
+  800384:	83 c0 04             	add    $0x4,%eax
+  800387:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038a:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  80038d:	89 ca                	mov    %ecx,%edx
+  80038f:	0f be 01             	movsbl (%ecx),%eax
+    if (!isdigit(c))
+  800392:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800395:	80 f9 09             	cmp    $0x9,%cl
+  800398:	0f 87 01 01 00 00    	ja     80049f <inet_aton+0x1c2>
+    base = 10;
+  80039e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  8003a3:	83 f8 30             	cmp    $0x30,%eax
+  8003a6:	0f 84 4b ff ff ff    	je     8002f7 <inet_aton+0x1a>
+  8003ac:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  8003af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b4:	e9 7a ff ff ff       	jmp    800333 <inet_aton+0x56>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003b9:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  8003bd:	89 d6                	mov    %edx,%esi
+  8003bf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8003c2:	85 c0                	test   %eax,%eax
+  8003c4:	74 2e                	je     8003f4 <inet_aton+0x117>
+    return (0);
+  8003c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003cb:	89 fa                	mov    %edi,%edx
+  8003cd:	80 fa 1f             	cmp    $0x1f,%dl
+  8003d0:	0f 86 d5 00 00 00    	jbe    8004ab <inet_aton+0x1ce>
+  8003d6:	84 c0                	test   %al,%al
+  8003d8:	0f 88 cd 00 00 00    	js     8004ab <inet_aton+0x1ce>
+  8003de:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  8003e1:	83 f9 04             	cmp    $0x4,%ecx
+  8003e4:	76 0e                	jbe    8003f4 <inet_aton+0x117>
+    return (0);
+  8003e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8003eb:	83 f8 20             	cmp    $0x20,%eax
+  8003ee:	0f 85 b7 00 00 00    	jne    8004ab <inet_aton+0x1ce>
+  n = pp - parts + 1;
+  8003f4:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  8003f7:	89 d8                	mov    %ebx,%eax
+  8003f9:	29 c8                	sub    %ecx,%eax
+  8003fb:	c1 f8 02             	sar    $0x2,%eax
+  8003fe:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  800401:	83 f8 02             	cmp    $0x2,%eax
+  800404:	74 7a                	je     800480 <inet_aton+0x1a3>
+  800406:	83 f9 03             	cmp    $0x3,%ecx
+  800409:	7f 49                	jg     800454 <inet_aton+0x177>
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	0f 84 98 00 00 00    	je     8004ab <inet_aton+0x1ce>
+  800413:	83 f9 02             	cmp    $0x2,%ecx
+  800416:	75 19                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800418:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  80041d:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  800423:	0f 87 82 00 00 00    	ja     8004ab <inet_aton+0x1ce>
+    val |= parts[0] << 24;
+  800429:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80042c:	c1 e0 18             	shl    $0x18,%eax
+  80042f:	09 c6                	or     %eax,%esi
+  return (1);
+  800431:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  800436:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80043a:	74 6f                	je     8004ab <inet_aton+0x1ce>
+    addr->s_addr = htonl(val);
+  80043c:	83 ec 0c             	sub    $0xc,%esp
+  80043f:	56                   	push   %esi
+  800440:	e8 6c fe ff ff       	call   8002b1 <htonl>
+  800445:	83 c4 10             	add    $0x10,%esp
+  800448:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80044b:	89 06                	mov    %eax,(%esi)
+  return (1);
+  80044d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800452:	eb 57                	jmp    8004ab <inet_aton+0x1ce>
+  switch (n) {
+  800454:	83 f9 04             	cmp    $0x4,%ecx
+  800457:	75 d8                	jne    800431 <inet_aton+0x154>
+      return (0);
+  800459:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  80045e:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  800464:	77 45                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  800466:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800469:	c1 e0 18             	shl    $0x18,%eax
+  80046c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80046f:	c1 e1 10             	shl    $0x10,%ecx
+  800472:	09 c8                	or     %ecx,%eax
+  800474:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800477:	c1 e1 08             	shl    $0x8,%ecx
+  80047a:	09 c8                	or     %ecx,%eax
+  80047c:	09 c6                	or     %eax,%esi
+    break;
+  80047e:	eb b1                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  800480:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  800485:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80048b:	77 1e                	ja     8004ab <inet_aton+0x1ce>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80048d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800490:	c1 e0 18             	shl    $0x18,%eax
+  800493:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800496:	c1 e1 10             	shl    $0x10,%ecx
+  800499:	09 c8                	or     %ecx,%eax
+  80049b:	09 c6                	or     %eax,%esi
+    break;
+  80049d:	eb 92                	jmp    800431 <inet_aton+0x154>
+      return (0);
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a4:	eb 05                	jmp    8004ab <inet_aton+0x1ce>
+        return (0);
+  8004a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  8004ab:	89 c8                	mov    %ecx,%eax
+  8004ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+
+008004b5 <inet_addr>:
+{
+  8004b5:	55                   	push   %ebp
+  8004b6:	89 e5                	mov    %esp,%ebp
+  8004b8:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  8004bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004be:	50                   	push   %eax
+  8004bf:	ff 75 08             	push   0x8(%ebp)
+  8004c2:	e8 16 fe ff ff       	call   8002dd <inet_aton>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8004cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8004d1:	85 d2                	test   %edx,%edx
+  8004d3:	75 02                	jne    8004d7 <inet_addr+0x22>
+}
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+    return (val.s_addr);
+  8004d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004da:	eb f9                	jmp    8004d5 <inet_addr+0x20>
+
+008004dc <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8004dc:	55                   	push   %ebp
+  8004dd:	89 e5                	mov    %esp,%ebp
+  8004df:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8004e2:	ff 75 08             	push   0x8(%ebp)
+  8004e5:	e8 c7 fd ff ff       	call   8002b1 <htonl>
+  8004ea:	83 c4 10             	add    $0x10,%esp
+}
+  8004ed:	c9                   	leave
+  8004ee:	c3                   	ret
+
+008004ef <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	57                   	push   %edi
+  8004f3:	56                   	push   %esi
+  8004f4:	53                   	push   %ebx
+  8004f5:	83 ec 0c             	sub    $0xc,%esp
+  8004f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8004fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8004fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800503:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800505:	c1 ea 0b             	shr    $0xb,%edx
+  800508:	83 f2 01             	xor    $0x1,%edx
+  80050b:	83 e2 01             	and    $0x1,%edx
+  80050e:	88 15 1c 50 80 00    	mov    %dl,0x80501c
+
+	mainenv = NULL;
+  800514:	c7 05 18 50 80 00 00 	movl   $0x0,0x805018
+  80051b:	00 00 00 
+	envid = sys_getenvid();
+  80051e:	e8 1f 0c 00 00       	call   801142 <sys_getenvid>
+  800523:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800525:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80052a:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800530:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800536:	8b 52 48             	mov    0x48(%edx),%edx
+  800539:	39 ca                	cmp    %ecx,%edx
+  80053b:	74 27                	je     800564 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80053d:	83 c0 01             	add    $0x1,%eax
+  800540:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800545:	75 e3                	jne    80052a <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800547:	83 3d 18 50 80 00 00 	cmpl   $0x0,0x805018
+  80054e:	75 24                	jne    800574 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800550:	83 ec 04             	sub    $0x4,%esp
+  800553:	68 3c 31 80 00       	push   $0x80313c
+  800558:	6a 23                	push   $0x23
+  80055a:	68 5f 31 80 00       	push   $0x80315f
+  80055f:	e8 4f 00 00 00       	call   8005b3 <_panic>
+			mainenv = &envs[i];
+  800564:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80056a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80056f:	a3 18 50 80 00       	mov    %eax,0x805018
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800574:	85 ff                	test   %edi,%edi
+  800576:	7e 07                	jle    80057f <libmain+0x90>
+		binaryname = argv[0];
+  800578:	8b 06                	mov    (%esi),%eax
+  80057a:	a3 10 40 80 00       	mov    %eax,0x804010
+
+	// call user main routine
+	umain(argc, argv);
+  80057f:	83 ec 08             	sub    $0x8,%esp
+  800582:	56                   	push   %esi
+  800583:	57                   	push   %edi
+  800584:	e8 4a fb ff ff       	call   8000d3 <umain>
+
+	// exit gracefully
+	exit();
+  800589:	e8 0b 00 00 00       	call   800599 <exit>
+}
+  80058e:	83 c4 10             	add    $0x10,%esp
+  800591:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800594:	5b                   	pop    %ebx
+  800595:	5e                   	pop    %esi
+  800596:	5f                   	pop    %edi
+  800597:	5d                   	pop    %ebp
+  800598:	c3                   	ret
+
+00800599 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800599:	55                   	push   %ebp
+  80059a:	89 e5                	mov    %esp,%ebp
+  80059c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80059f:	e8 94 18 00 00       	call   801e38 <close_all>
+	sys_env_destroy(0);
+  8005a4:	83 ec 0c             	sub    $0xc,%esp
+  8005a7:	6a 00                	push   $0x0
+  8005a9:	e8 2b 0b 00 00       	call   8010d9 <sys_env_destroy>
+}
+  8005ae:	83 c4 10             	add    $0x10,%esp
+  8005b1:	c9                   	leave
+  8005b2:	c3                   	ret
+
+008005b3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005b3:	55                   	push   %ebp
+  8005b4:	89 e5                	mov    %esp,%ebp
+  8005b6:	56                   	push   %esi
+  8005b7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005b8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005bb:	8b 35 10 40 80 00    	mov    0x804010,%esi
+  8005c1:	e8 7c 0b 00 00       	call   801142 <sys_getenvid>
+  8005c6:	83 ec 0c             	sub    $0xc,%esp
+  8005c9:	ff 75 0c             	push   0xc(%ebp)
+  8005cc:	ff 75 08             	push   0x8(%ebp)
+  8005cf:	56                   	push   %esi
+  8005d0:	50                   	push   %eax
+  8005d1:	68 78 31 80 00       	push   $0x803178
+  8005d6:	e8 b3 00 00 00       	call   80068e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005db:	83 c4 18             	add    $0x18,%esp
+  8005de:	53                   	push   %ebx
+  8005df:	ff 75 10             	push   0x10(%ebp)
+  8005e2:	e8 56 00 00 00       	call   80063d <vcprintf>
+	cprintf("\n");
+  8005e7:	c7 04 24 ec 35 80 00 	movl   $0x8035ec,(%esp)
+  8005ee:	e8 9b 00 00 00       	call   80068e <cprintf>
+  8005f3:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005f6:	cc                   	int3
+	while (1)
+  8005f7:	eb fd                	jmp    8005f6 <_panic+0x43>
+
+008005f9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8005f9:	55                   	push   %ebp
+  8005fa:	89 e5                	mov    %esp,%ebp
+  8005fc:	53                   	push   %ebx
+  8005fd:	83 ec 04             	sub    $0x4,%esp
+  800600:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800603:	8b 13                	mov    (%ebx),%edx
+  800605:	8d 42 01             	lea    0x1(%edx),%eax
+  800608:	89 03                	mov    %eax,(%ebx)
+  80060a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80060d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800611:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800616:	74 09                	je     800621 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800618:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80061c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80061f:	c9                   	leave
+  800620:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800621:	83 ec 08             	sub    $0x8,%esp
+  800624:	68 ff 00 00 00       	push   $0xff
+  800629:	8d 43 08             	lea    0x8(%ebx),%eax
+  80062c:	50                   	push   %eax
+  80062d:	e8 1d 0a 00 00       	call   80104f <sys_cputs>
+		b->idx = 0;
+  800632:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800638:	83 c4 10             	add    $0x10,%esp
+  80063b:	eb db                	jmp    800618 <putch+0x1f>
+
+0080063d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80063d:	55                   	push   %ebp
+  80063e:	89 e5                	mov    %esp,%ebp
+  800640:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800646:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80064d:	00 00 00 
+	b.cnt = 0;
+  800650:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800657:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80065a:	ff 75 0c             	push   0xc(%ebp)
+  80065d:	ff 75 08             	push   0x8(%ebp)
+  800660:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800666:	50                   	push   %eax
+  800667:	68 f9 05 80 00       	push   $0x8005f9
+  80066c:	e8 fb 00 00 00       	call   80076c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800671:	83 c4 08             	add    $0x8,%esp
+  800674:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80067a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800680:	50                   	push   %eax
+  800681:	e8 c9 09 00 00       	call   80104f <sys_cputs>
+
+	return b.cnt;
+}
+  800686:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80068c:	c9                   	leave
+  80068d:	c3                   	ret
+
+0080068e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80068e:	55                   	push   %ebp
+  80068f:	89 e5                	mov    %esp,%ebp
+  800691:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800694:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800697:	50                   	push   %eax
+  800698:	ff 75 08             	push   0x8(%ebp)
+  80069b:	e8 9d ff ff ff       	call   80063d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8006a0:	c9                   	leave
+  8006a1:	c3                   	ret
+
+008006a2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8006a2:	55                   	push   %ebp
+  8006a3:	89 e5                	mov    %esp,%ebp
+  8006a5:	57                   	push   %edi
+  8006a6:	56                   	push   %esi
+  8006a7:	53                   	push   %ebx
+  8006a8:	83 ec 1c             	sub    $0x1c,%esp
+  8006ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ae:	89 d6                	mov    %edx,%esi
+  8006b0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8006b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8006b6:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8006b9:	73 0b                	jae    8006c6 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8006bb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006be:	c1 e7 08             	shl    $0x8,%edi
+  8006c1:	0b 7d 10             	or     0x10(%ebp),%edi
+  8006c4:	eb 36                	jmp    8006fc <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8006c6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ce:	f7 75 08             	divl   0x8(%ebp)
+  8006d1:	89 c1                	mov    %eax,%ecx
+  8006d3:	ff 75 14             	push   0x14(%ebp)
+  8006d6:	ff 75 10             	push   0x10(%ebp)
+  8006d9:	83 eb 01             	sub    $0x1,%ebx
+  8006dc:	53                   	push   %ebx
+  8006dd:	ff 75 08             	push   0x8(%ebp)
+  8006e0:	89 f2                	mov    %esi,%edx
+  8006e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006e5:	e8 b8 ff ff ff       	call   8006a2 <printnum>
+  8006ea:	83 c4 10             	add    $0x10,%esp
+  8006ed:	eb 14                	jmp    800703 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8006ef:	83 ec 08             	sub    $0x8,%esp
+  8006f2:	56                   	push   %esi
+  8006f3:	57                   	push   %edi
+  8006f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006f7:	ff d0                	call   *%eax
+  8006f9:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8006fc:	83 eb 01             	sub    $0x1,%ebx
+  8006ff:	85 db                	test   %ebx,%ebx
+  800701:	7f ec                	jg     8006ef <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800703:	83 ec 08             	sub    $0x8,%esp
+  800706:	56                   	push   %esi
+  800707:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80070a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80070f:	f7 75 08             	divl   0x8(%ebp)
+  800712:	0f be 92 9b 31 80 00 	movsbl 0x80319b(%edx),%edx
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	c1 e0 08             	shl    $0x8,%eax
+  80071f:	09 d0                	or     %edx,%eax
+  800721:	50                   	push   %eax
+  800722:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800725:	ff d0                	call   *%eax
+}
+  800727:	83 c4 10             	add    $0x10,%esp
+  80072a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80072d:	5b                   	pop    %ebx
+  80072e:	5e                   	pop    %esi
+  80072f:	5f                   	pop    %edi
+  800730:	5d                   	pop    %ebp
+  800731:	c3                   	ret
+
+00800732 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800732:	55                   	push   %ebp
+  800733:	89 e5                	mov    %esp,%ebp
+  800735:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800738:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80073c:	8b 10                	mov    (%eax),%edx
+  80073e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800741:	73 0a                	jae    80074d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800743:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800746:	89 08                	mov    %ecx,(%eax)
+  800748:	8b 45 08             	mov    0x8(%ebp),%eax
+  80074b:	88 02                	mov    %al,(%edx)
+}
+  80074d:	5d                   	pop    %ebp
+  80074e:	c3                   	ret
+
+0080074f <printfmt>:
+{
+  80074f:	55                   	push   %ebp
+  800750:	89 e5                	mov    %esp,%ebp
+  800752:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800755:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800758:	50                   	push   %eax
+  800759:	ff 75 10             	push   0x10(%ebp)
+  80075c:	ff 75 0c             	push   0xc(%ebp)
+  80075f:	ff 75 08             	push   0x8(%ebp)
+  800762:	e8 05 00 00 00       	call   80076c <vprintfmt>
+}
+  800767:	83 c4 10             	add    $0x10,%esp
+  80076a:	c9                   	leave
+  80076b:	c3                   	ret
+
+0080076c <vprintfmt>:
+{
+  80076c:	55                   	push   %ebp
+  80076d:	89 e5                	mov    %esp,%ebp
+  80076f:	57                   	push   %edi
+  800770:	56                   	push   %esi
+  800771:	53                   	push   %ebx
+  800772:	83 ec 3c             	sub    $0x3c,%esp
+  800775:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800778:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80077b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800782:	eb 16                	jmp    80079a <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800784:	83 ec 08             	sub    $0x8,%esp
+  800787:	ff 75 0c             	push   0xc(%ebp)
+  80078a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80078d:	c1 e2 08             	shl    $0x8,%edx
+  800790:	09 d0                	or     %edx,%eax
+  800792:	50                   	push   %eax
+  800793:	ff d7                	call   *%edi
+  800795:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800798:	89 de                	mov    %ebx,%esi
+  80079a:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80079d:	0f b6 06             	movzbl (%esi),%eax
+  8007a0:	83 f8 25             	cmp    $0x25,%eax
+  8007a3:	74 0c                	je     8007b1 <vprintfmt+0x45>
+			if (ch == '\0')
+  8007a5:	85 c0                	test   %eax,%eax
+  8007a7:	75 db                	jne    800784 <vprintfmt+0x18>
+}
+  8007a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ac:	5b                   	pop    %ebx
+  8007ad:	5e                   	pop    %esi
+  8007ae:	5f                   	pop    %edi
+  8007af:	5d                   	pop    %ebp
+  8007b0:	c3                   	ret
+		padc = ' ';
+  8007b1:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8007b5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8007bc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8007c3:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8007ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007cf:	8d 73 01             	lea    0x1(%ebx),%esi
+  8007d2:	0f b6 13             	movzbl (%ebx),%edx
+  8007d5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8007d8:	3c 55                	cmp    $0x55,%al
+  8007da:	0f 87 2c 04 00 00    	ja     800c0c <vprintfmt+0x4a0>
+  8007e0:	0f b6 c0             	movzbl %al,%eax
+  8007e3:	ff 24 85 e0 32 80 00 	jmp    *0x8032e0(,%eax,4)
+  8007ea:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8007ec:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8007f0:	eb dd                	jmp    8007cf <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007f2:	89 f3                	mov    %esi,%ebx
+  8007f4:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8007f8:	eb d5                	jmp    8007cf <vprintfmt+0x63>
+  8007fa:	0f b6 d2             	movzbl %dl,%edx
+  8007fd:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8007ff:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800804:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800807:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80080b:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80080e:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800811:	83 fe 09             	cmp    $0x9,%esi
+  800814:	0f 87 8a 00 00 00    	ja     8008a4 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80081a:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80081d:	eb e5                	jmp    800804 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80081f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800822:	8b 00                	mov    (%eax),%eax
+  800824:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082a:	8d 40 04             	lea    0x4(%eax),%eax
+  80082d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800830:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800832:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800836:	79 97                	jns    8007cf <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800838:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80083b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80083e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800845:	eb 88                	jmp    8007cf <vprintfmt+0x63>
+			if (width < 0)
+  800847:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80084a:	85 db                	test   %ebx,%ebx
+  80084c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800851:	0f 49 c3             	cmovns %ebx,%eax
+  800854:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800857:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800859:	e9 71 ff ff ff       	jmp    8007cf <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80085e:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800860:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800867:	e9 63 ff ff ff       	jmp    8007cf <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80086c:	8d 73 02             	lea    0x2(%ebx),%esi
+  80086f:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800873:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80087a:	3c 67                	cmp    $0x67,%al
+  80087c:	0f 84 18 ff ff ff    	je     80079a <vprintfmt+0x2e>
+					attrib = 0x04;
+  800882:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800889:	3c 72                	cmp    $0x72,%al
+  80088b:	0f 84 09 ff ff ff    	je     80079a <vprintfmt+0x2e>
+					attrib = 0x00;
+  800891:	3c 62                	cmp    $0x62,%al
+  800893:	0f 94 c0             	sete   %al
+  800896:	0f b6 c0             	movzbl %al,%eax
+  800899:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80089c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80089f:	e9 f6 fe ff ff       	jmp    80079a <vprintfmt+0x2e>
+  8008a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008a7:	eb 89                	jmp    800832 <vprintfmt+0xc6>
+			lflag++;
+  8008a9:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8008ac:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8008ae:	e9 1c ff ff ff       	jmp    8007cf <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8008b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b6:	8d 58 04             	lea    0x4(%eax),%ebx
+  8008b9:	83 ec 08             	sub    $0x8,%esp
+  8008bc:	ff 75 0c             	push   0xc(%ebp)
+  8008bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008c2:	c1 e0 08             	shl    $0x8,%eax
+  8008c5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8008c8:	0b 01                	or     (%ecx),%eax
+  8008ca:	50                   	push   %eax
+  8008cb:	ff d7                	call   *%edi
+			break;
+  8008cd:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8008d0:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8008d3:	e9 c2 fe ff ff       	jmp    80079a <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8008d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008db:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8008de:	8b 10                	mov    (%eax),%edx
+  8008e0:	89 d0                	mov    %edx,%eax
+  8008e2:	f7 d8                	neg    %eax
+  8008e4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008e7:	83 f8 12             	cmp    $0x12,%eax
+  8008ea:	7f 25                	jg     800911 <vprintfmt+0x1a5>
+  8008ec:	8b 14 85 40 34 80 00 	mov    0x803440(,%eax,4),%edx
+  8008f3:	85 d2                	test   %edx,%edx
+  8008f5:	74 1a                	je     800911 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8008f7:	52                   	push   %edx
+  8008f8:	68 81 35 80 00       	push   $0x803581
+  8008fd:	ff 75 0c             	push   0xc(%ebp)
+  800900:	57                   	push   %edi
+  800901:	e8 49 fe ff ff       	call   80074f <printfmt>
+  800906:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800909:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80090c:	e9 89 fe ff ff       	jmp    80079a <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800911:	50                   	push   %eax
+  800912:	68 b3 31 80 00       	push   $0x8031b3
+  800917:	ff 75 0c             	push   0xc(%ebp)
+  80091a:	57                   	push   %edi
+  80091b:	e8 2f fe ff ff       	call   80074f <printfmt>
+  800920:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800923:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800926:	e9 6f fe ff ff       	jmp    80079a <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80092b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092e:	83 c0 04             	add    $0x4,%eax
+  800931:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800934:	8b 45 14             	mov    0x14(%ebp),%eax
+  800937:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800939:	85 c9                	test   %ecx,%ecx
+  80093b:	b8 ac 31 80 00       	mov    $0x8031ac,%eax
+  800940:	0f 45 c1             	cmovne %ecx,%eax
+  800943:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800946:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80094a:	7e 06                	jle    800952 <vprintfmt+0x1e6>
+  80094c:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800950:	75 1a                	jne    80096c <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800952:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800955:	c1 e0 08             	shl    $0x8,%eax
+  800958:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80095b:	83 c8 3f             	or     $0x3f,%eax
+  80095e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800961:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800964:	89 75 10             	mov    %esi,0x10(%ebp)
+  800967:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80096a:	eb 6d                	jmp    8009d9 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80096c:	83 ec 08             	sub    $0x8,%esp
+  80096f:	ff 75 d0             	push   -0x30(%ebp)
+  800972:	ff 75 c8             	push   -0x38(%ebp)
+  800975:	e8 39 03 00 00       	call   800cb3 <strnlen>
+  80097a:	89 c2                	mov    %eax,%edx
+  80097c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80097f:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800981:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800984:	c1 e1 08             	shl    $0x8,%ecx
+  800987:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80098b:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80098d:	83 c4 10             	add    $0x10,%esp
+  800990:	89 c3                	mov    %eax,%ebx
+  800992:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800995:	89 75 10             	mov    %esi,0x10(%ebp)
+  800998:	89 ce                	mov    %ecx,%esi
+  80099a:	eb 0f                	jmp    8009ab <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80099c:	83 ec 08             	sub    $0x8,%esp
+  80099f:	ff 75 0c             	push   0xc(%ebp)
+  8009a2:	56                   	push   %esi
+  8009a3:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009a5:	83 eb 01             	sub    $0x1,%ebx
+  8009a8:	83 c4 10             	add    $0x10,%esp
+  8009ab:	85 db                	test   %ebx,%ebx
+  8009ad:	7f ed                	jg     80099c <vprintfmt+0x230>
+  8009af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009b2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8009b5:	85 c0                	test   %eax,%eax
+  8009b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009bc:	0f 49 d0             	cmovns %eax,%edx
+  8009bf:	29 d0                	sub    %edx,%eax
+  8009c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009c4:	eb 8c                	jmp    800952 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8009c6:	83 ec 08             	sub    $0x8,%esp
+  8009c9:	ff 75 0c             	push   0xc(%ebp)
+  8009cc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8009cf:	09 c2                	or     %eax,%edx
+  8009d1:	52                   	push   %edx
+  8009d2:	ff d7                	call   *%edi
+  8009d4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009d7:	89 d9                	mov    %ebx,%ecx
+  8009d9:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8009dc:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8009e0:	0f be d0             	movsbl %al,%edx
+  8009e3:	85 d2                	test   %edx,%edx
+  8009e5:	74 2a                	je     800a11 <vprintfmt+0x2a5>
+  8009e7:	85 f6                	test   %esi,%esi
+  8009e9:	78 05                	js     8009f0 <vprintfmt+0x284>
+  8009eb:	83 ee 01             	sub    $0x1,%esi
+  8009ee:	78 3b                	js     800a2b <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009f0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8009f4:	74 d0                	je     8009c6 <vprintfmt+0x25a>
+  8009f6:	0f be c0             	movsbl %al,%eax
+  8009f9:	83 e8 20             	sub    $0x20,%eax
+  8009fc:	83 f8 5e             	cmp    $0x5e,%eax
+  8009ff:	76 c5                	jbe    8009c6 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800a01:	83 ec 08             	sub    $0x8,%esp
+  800a04:	ff 75 0c             	push   0xc(%ebp)
+  800a07:	ff 75 cc             	push   -0x34(%ebp)
+  800a0a:	ff d7                	call   *%edi
+  800a0c:	83 c4 10             	add    $0x10,%esp
+  800a0f:	eb c6                	jmp    8009d7 <vprintfmt+0x26b>
+  800a11:	8b 75 10             	mov    0x10(%ebp),%esi
+  800a14:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800a17:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a1a:	01 c3                	add    %eax,%ebx
+  800a1c:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800a1e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800a21:	83 c8 20             	or     $0x20,%eax
+  800a24:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a27:	89 c6                	mov    %eax,%esi
+  800a29:	eb 14                	jmp    800a3f <vprintfmt+0x2d3>
+  800a2b:	8b 75 10             	mov    0x10(%ebp),%esi
+  800a2e:	eb e4                	jmp    800a14 <vprintfmt+0x2a8>
+  800a30:	83 ec 08             	sub    $0x8,%esp
+  800a33:	ff 75 0c             	push   0xc(%ebp)
+  800a36:	56                   	push   %esi
+  800a37:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800a39:	83 eb 01             	sub    $0x1,%ebx
+  800a3c:	83 c4 10             	add    $0x10,%esp
+  800a3f:	85 db                	test   %ebx,%ebx
+  800a41:	7f ed                	jg     800a30 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a43:	8b 75 10             	mov    0x10(%ebp),%esi
+  800a46:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800a49:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a4c:	e9 49 fd ff ff       	jmp    80079a <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800a51:	83 f9 01             	cmp    $0x1,%ecx
+  800a54:	7f 1f                	jg     800a75 <vprintfmt+0x309>
+	else if (lflag)
+  800a56:	85 c9                	test   %ecx,%ecx
+  800a58:	74 69                	je     800ac3 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800a5a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5d:	8b 00                	mov    (%eax),%eax
+  800a5f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a62:	89 c1                	mov    %eax,%ecx
+  800a64:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a67:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a70:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a73:	eb 17                	jmp    800a8c <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800a75:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a78:	8b 50 04             	mov    0x4(%eax),%edx
+  800a7b:	8b 00                	mov    (%eax),%eax
+  800a7d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a80:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a86:	8d 40 08             	lea    0x8(%eax),%eax
+  800a89:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a8c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800a8f:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800a92:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800a97:	85 db                	test   %ebx,%ebx
+  800a99:	0f 89 f6 00 00 00    	jns    800b95 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800a9f:	83 ec 08             	sub    $0x8,%esp
+  800aa2:	ff 75 0c             	push   0xc(%ebp)
+  800aa5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800aa8:	c1 e0 08             	shl    $0x8,%eax
+  800aab:	83 c8 2d             	or     $0x2d,%eax
+  800aae:	50                   	push   %eax
+  800aaf:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800ab1:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800ab4:	f7 d9                	neg    %ecx
+  800ab6:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ab9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800abe:	e9 d2 00 00 00       	jmp    800b95 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800ac3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac6:	8b 00                	mov    (%eax),%eax
+  800ac8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800acb:	89 c1                	mov    %eax,%ecx
+  800acd:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ad0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ad3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad6:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad9:	89 45 14             	mov    %eax,0x14(%ebp)
+  800adc:	eb ae                	jmp    800a8c <vprintfmt+0x320>
+	if (lflag >= 2)
+  800ade:	83 f9 01             	cmp    $0x1,%ecx
+  800ae1:	7f 19                	jg     800afc <vprintfmt+0x390>
+	else if (lflag)
+  800ae3:	85 c9                	test   %ecx,%ecx
+  800ae5:	74 2a                	je     800b11 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800ae7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aea:	8b 08                	mov    (%eax),%ecx
+  800aec:	8d 40 04             	lea    0x4(%eax),%eax
+  800aef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800af2:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800af7:	e9 99 00 00 00       	jmp    800b95 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800afc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aff:	8b 08                	mov    (%eax),%ecx
+  800b01:	8d 40 08             	lea    0x8(%eax),%eax
+  800b04:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b07:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800b0c:	e9 84 00 00 00       	jmp    800b95 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800b11:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b14:	8b 08                	mov    (%eax),%ecx
+  800b16:	8d 40 04             	lea    0x4(%eax),%eax
+  800b19:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b1c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800b21:	eb 72                	jmp    800b95 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800b23:	83 f9 01             	cmp    $0x1,%ecx
+  800b26:	7f 16                	jg     800b3e <vprintfmt+0x3d2>
+	else if (lflag)
+  800b28:	85 c9                	test   %ecx,%ecx
+  800b2a:	74 24                	je     800b50 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800b2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b2f:	8b 08                	mov    (%eax),%ecx
+  800b31:	8d 40 04             	lea    0x4(%eax),%eax
+  800b34:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b37:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800b3c:	eb 57                	jmp    800b95 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800b3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b41:	8b 08                	mov    (%eax),%ecx
+  800b43:	8d 40 08             	lea    0x8(%eax),%eax
+  800b46:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b49:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800b4e:	eb 45                	jmp    800b95 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800b50:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b53:	8b 08                	mov    (%eax),%ecx
+  800b55:	8d 40 04             	lea    0x4(%eax),%eax
+  800b58:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b5b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800b60:	eb 33                	jmp    800b95 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800b62:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b65:	c1 e3 08             	shl    $0x8,%ebx
+  800b68:	83 ec 08             	sub    $0x8,%esp
+  800b6b:	ff 75 0c             	push   0xc(%ebp)
+  800b6e:	89 d8                	mov    %ebx,%eax
+  800b70:	83 c8 30             	or     $0x30,%eax
+  800b73:	50                   	push   %eax
+  800b74:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800b76:	83 c4 08             	add    $0x8,%esp
+  800b79:	ff 75 0c             	push   0xc(%ebp)
+  800b7c:	83 cb 78             	or     $0x78,%ebx
+  800b7f:	53                   	push   %ebx
+  800b80:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800b82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b85:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800b87:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b8a:	8d 40 04             	lea    0x4(%eax),%eax
+  800b8d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b90:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800b95:	ff 75 e4             	push   -0x1c(%ebp)
+  800b98:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800b9c:	52                   	push   %edx
+  800b9d:	ff 75 e0             	push   -0x20(%ebp)
+  800ba0:	50                   	push   %eax
+  800ba1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ba4:	89 f8                	mov    %edi,%eax
+  800ba6:	e8 f7 fa ff ff       	call   8006a2 <printnum>
+			break;
+  800bab:	83 c4 10             	add    $0x10,%esp
+  800bae:	e9 e7 fb ff ff       	jmp    80079a <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800bb3:	83 f9 01             	cmp    $0x1,%ecx
+  800bb6:	7f 16                	jg     800bce <vprintfmt+0x462>
+	else if (lflag)
+  800bb8:	85 c9                	test   %ecx,%ecx
+  800bba:	74 24                	je     800be0 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800bbc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bbf:	8b 08                	mov    (%eax),%ecx
+  800bc1:	8d 40 04             	lea    0x4(%eax),%eax
+  800bc4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bc7:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800bcc:	eb c7                	jmp    800b95 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800bce:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd1:	8b 08                	mov    (%eax),%ecx
+  800bd3:	8d 40 08             	lea    0x8(%eax),%eax
+  800bd6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bd9:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800bde:	eb b5                	jmp    800b95 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800be0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be3:	8b 08                	mov    (%eax),%ecx
+  800be5:	8d 40 04             	lea    0x4(%eax),%eax
+  800be8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800beb:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800bf0:	eb a3                	jmp    800b95 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800bf2:	83 ec 08             	sub    $0x8,%esp
+  800bf5:	ff 75 0c             	push   0xc(%ebp)
+  800bf8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800bfb:	c1 e0 08             	shl    $0x8,%eax
+  800bfe:	83 c8 25             	or     $0x25,%eax
+  800c01:	50                   	push   %eax
+  800c02:	ff d7                	call   *%edi
+			break;
+  800c04:	83 c4 10             	add    $0x10,%esp
+  800c07:	e9 8e fb ff ff       	jmp    80079a <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800c0c:	83 ec 08             	sub    $0x8,%esp
+  800c0f:	ff 75 0c             	push   0xc(%ebp)
+  800c12:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800c15:	c1 e0 08             	shl    $0x8,%eax
+  800c18:	83 c8 25             	or     $0x25,%eax
+  800c1b:	50                   	push   %eax
+  800c1c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c1e:	83 c4 10             	add    $0x10,%esp
+  800c21:	89 de                	mov    %ebx,%esi
+  800c23:	eb 03                	jmp    800c28 <vprintfmt+0x4bc>
+  800c25:	83 ee 01             	sub    $0x1,%esi
+  800c28:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800c2c:	75 f7                	jne    800c25 <vprintfmt+0x4b9>
+  800c2e:	e9 67 fb ff ff       	jmp    80079a <vprintfmt+0x2e>
+
+00800c33 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c33:	55                   	push   %ebp
+  800c34:	89 e5                	mov    %esp,%ebp
+  800c36:	83 ec 18             	sub    $0x18,%esp
+  800c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c3f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c42:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c46:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c49:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c50:	85 c0                	test   %eax,%eax
+  800c52:	74 26                	je     800c7a <vsnprintf+0x47>
+  800c54:	85 d2                	test   %edx,%edx
+  800c56:	7e 22                	jle    800c7a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c58:	ff 75 14             	push   0x14(%ebp)
+  800c5b:	ff 75 10             	push   0x10(%ebp)
+  800c5e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c61:	50                   	push   %eax
+  800c62:	68 32 07 80 00       	push   $0x800732
+  800c67:	e8 00 fb ff ff       	call   80076c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c6c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c6f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c75:	83 c4 10             	add    $0x10,%esp
+}
+  800c78:	c9                   	leave
+  800c79:	c3                   	ret
+		return -E_INVAL;
+  800c7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c7f:	eb f7                	jmp    800c78 <vsnprintf+0x45>
+
+00800c81 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800c87:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c8a:	50                   	push   %eax
+  800c8b:	ff 75 10             	push   0x10(%ebp)
+  800c8e:	ff 75 0c             	push   0xc(%ebp)
+  800c91:	ff 75 08             	push   0x8(%ebp)
+  800c94:	e8 9a ff ff ff       	call   800c33 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800c99:	c9                   	leave
+  800c9a:	c3                   	ret
+
+00800c9b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca6:	eb 03                	jmp    800cab <strlen+0x10>
+		n++;
+  800ca8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800cab:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800caf:	75 f7                	jne    800ca8 <strlen+0xd>
+	return n;
+}
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+
+00800cb3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cb9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc1:	eb 03                	jmp    800cc6 <strnlen+0x13>
+		n++;
+  800cc3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cc6:	39 d0                	cmp    %edx,%eax
+  800cc8:	74 08                	je     800cd2 <strnlen+0x1f>
+  800cca:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800cce:	75 f3                	jne    800cc3 <strnlen+0x10>
+  800cd0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800cd2:	89 d0                	mov    %edx,%eax
+  800cd4:	5d                   	pop    %ebp
+  800cd5:	c3                   	ret
+
+00800cd6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800cd6:	55                   	push   %ebp
+  800cd7:	89 e5                	mov    %esp,%ebp
+  800cd9:	53                   	push   %ebx
+  800cda:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cdd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ce9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800cec:	83 c0 01             	add    $0x1,%eax
+  800cef:	84 d2                	test   %dl,%dl
+  800cf1:	75 f2                	jne    800ce5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800cf3:	89 c8                	mov    %ecx,%eax
+  800cf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cf8:	c9                   	leave
+  800cf9:	c3                   	ret
+
+00800cfa <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800cfa:	55                   	push   %ebp
+  800cfb:	89 e5                	mov    %esp,%ebp
+  800cfd:	53                   	push   %ebx
+  800cfe:	83 ec 10             	sub    $0x10,%esp
+  800d01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d04:	53                   	push   %ebx
+  800d05:	e8 91 ff ff ff       	call   800c9b <strlen>
+  800d0a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d0d:	ff 75 0c             	push   0xc(%ebp)
+  800d10:	01 d8                	add    %ebx,%eax
+  800d12:	50                   	push   %eax
+  800d13:	e8 be ff ff ff       	call   800cd6 <strcpy>
+	return dst;
+}
+  800d18:	89 d8                	mov    %ebx,%eax
+  800d1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d1d:	c9                   	leave
+  800d1e:	c3                   	ret
+
+00800d1f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d1f:	55                   	push   %ebp
+  800d20:	89 e5                	mov    %esp,%ebp
+  800d22:	56                   	push   %esi
+  800d23:	53                   	push   %ebx
+  800d24:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d27:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d2a:	89 f3                	mov    %esi,%ebx
+  800d2c:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d2f:	89 f0                	mov    %esi,%eax
+  800d31:	eb 0f                	jmp    800d42 <strncpy+0x23>
+		*dst++ = *src;
+  800d33:	83 c0 01             	add    $0x1,%eax
+  800d36:	0f b6 0a             	movzbl (%edx),%ecx
+  800d39:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d3c:	80 f9 01             	cmp    $0x1,%cl
+  800d3f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d42:	39 d8                	cmp    %ebx,%eax
+  800d44:	75 ed                	jne    800d33 <strncpy+0x14>
+	}
+	return ret;
+}
+  800d46:	89 f0                	mov    %esi,%eax
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	56                   	push   %esi
+  800d50:	53                   	push   %ebx
+  800d51:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d57:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d5a:	89 f0                	mov    %esi,%eax
+  800d5c:	85 d2                	test   %edx,%edx
+  800d5e:	74 21                	je     800d81 <strlcpy+0x35>
+  800d60:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d64:	89 f2                	mov    %esi,%edx
+  800d66:	eb 09                	jmp    800d71 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d68:	83 c1 01             	add    $0x1,%ecx
+  800d6b:	83 c2 01             	add    $0x1,%edx
+  800d6e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800d71:	39 c2                	cmp    %eax,%edx
+  800d73:	74 09                	je     800d7e <strlcpy+0x32>
+  800d75:	0f b6 19             	movzbl (%ecx),%ebx
+  800d78:	84 db                	test   %bl,%bl
+  800d7a:	75 ec                	jne    800d68 <strlcpy+0x1c>
+  800d7c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800d7e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800d81:	29 f0                	sub    %esi,%eax
+}
+  800d83:	5b                   	pop    %ebx
+  800d84:	5e                   	pop    %esi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+
+00800d87 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800d90:	eb 06                	jmp    800d98 <strcmp+0x11>
+		p++, q++;
+  800d92:	83 c1 01             	add    $0x1,%ecx
+  800d95:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800d98:	0f b6 01             	movzbl (%ecx),%eax
+  800d9b:	84 c0                	test   %al,%al
+  800d9d:	74 04                	je     800da3 <strcmp+0x1c>
+  800d9f:	3a 02                	cmp    (%edx),%al
+  800da1:	74 ef                	je     800d92 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800da3:	0f b6 c0             	movzbl %al,%eax
+  800da6:	0f b6 12             	movzbl (%edx),%edx
+  800da9:	29 d0                	sub    %edx,%eax
+}
+  800dab:	5d                   	pop    %ebp
+  800dac:	c3                   	ret
+
+00800dad <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800dad:	55                   	push   %ebp
+  800dae:	89 e5                	mov    %esp,%ebp
+  800db0:	53                   	push   %ebx
+  800db1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800dba:	eb 09                	jmp    800dc5 <strncmp+0x18>
+		n--, p++, q++;
+  800dbc:	83 ea 01             	sub    $0x1,%edx
+  800dbf:	83 c0 01             	add    $0x1,%eax
+  800dc2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800dc5:	85 d2                	test   %edx,%edx
+  800dc7:	74 18                	je     800de1 <strncmp+0x34>
+  800dc9:	0f b6 18             	movzbl (%eax),%ebx
+  800dcc:	84 db                	test   %bl,%bl
+  800dce:	74 04                	je     800dd4 <strncmp+0x27>
+  800dd0:	3a 19                	cmp    (%ecx),%bl
+  800dd2:	74 e8                	je     800dbc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dd4:	0f b6 00             	movzbl (%eax),%eax
+  800dd7:	0f b6 11             	movzbl (%ecx),%edx
+  800dda:	29 d0                	sub    %edx,%eax
+}
+  800ddc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ddf:	c9                   	leave
+  800de0:	c3                   	ret
+		return 0;
+  800de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de6:	eb f4                	jmp    800ddc <strncmp+0x2f>
+
+00800de8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dee:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800df2:	eb 03                	jmp    800df7 <strchr+0xf>
+  800df4:	83 c0 01             	add    $0x1,%eax
+  800df7:	0f b6 10             	movzbl (%eax),%edx
+  800dfa:	84 d2                	test   %dl,%dl
+  800dfc:	74 06                	je     800e04 <strchr+0x1c>
+		if (*s == c)
+  800dfe:	38 ca                	cmp    %cl,%dl
+  800e00:	75 f2                	jne    800df4 <strchr+0xc>
+  800e02:	eb 05                	jmp    800e09 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800e04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+
+00800e0b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e11:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e15:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e18:	38 ca                	cmp    %cl,%dl
+  800e1a:	74 09                	je     800e25 <strfind+0x1a>
+  800e1c:	84 d2                	test   %dl,%dl
+  800e1e:	74 05                	je     800e25 <strfind+0x1a>
+	for (; *s; s++)
+  800e20:	83 c0 01             	add    $0x1,%eax
+  800e23:	eb f0                	jmp    800e15 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e2e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e31:	85 c9                	test   %ecx,%ecx
+  800e33:	74 20                	je     800e55 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e35:	89 f8                	mov    %edi,%eax
+  800e37:	09 c8                	or     %ecx,%eax
+  800e39:	a8 03                	test   $0x3,%al
+  800e3b:	75 12                	jne    800e4f <memset+0x28>
+		c &= 0xFF;
+  800e3d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e41:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e47:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e4a:	fc                   	cld
+  800e4b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e4d:	eb 06                	jmp    800e55 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e52:	fc                   	cld
+  800e53:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e55:	89 f8                	mov    %edi,%eax
+  800e57:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e5a:	c9                   	leave
+  800e5b:	c3                   	ret
+
+00800e5c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e5c:	55                   	push   %ebp
+  800e5d:	89 e5                	mov    %esp,%ebp
+  800e5f:	57                   	push   %edi
+  800e60:	56                   	push   %esi
+  800e61:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e64:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e67:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e6a:	39 c6                	cmp    %eax,%esi
+  800e6c:	73 32                	jae    800ea0 <memmove+0x44>
+  800e6e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e71:	39 d0                	cmp    %edx,%eax
+  800e73:	73 2b                	jae    800ea0 <memmove+0x44>
+		s += n;
+		d += n;
+  800e75:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e78:	89 d6                	mov    %edx,%esi
+  800e7a:	09 fe                	or     %edi,%esi
+  800e7c:	09 ce                	or     %ecx,%esi
+  800e7e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e84:	75 0e                	jne    800e94 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e86:	83 ef 04             	sub    $0x4,%edi
+  800e89:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e8c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e8f:	fd                   	std
+  800e90:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e92:	eb 09                	jmp    800e9d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e94:	83 ef 01             	sub    $0x1,%edi
+  800e97:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e9a:	fd                   	std
+  800e9b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e9d:	fc                   	cld
+  800e9e:	eb 1a                	jmp    800eba <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ea0:	89 f2                	mov    %esi,%edx
+  800ea2:	09 c2                	or     %eax,%edx
+  800ea4:	09 ca                	or     %ecx,%edx
+  800ea6:	f6 c2 03             	test   $0x3,%dl
+  800ea9:	75 0a                	jne    800eb5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800eab:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800eae:	89 c7                	mov    %eax,%edi
+  800eb0:	fc                   	cld
+  800eb1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800eb3:	eb 05                	jmp    800eba <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800eb5:	89 c7                	mov    %eax,%edi
+  800eb7:	fc                   	cld
+  800eb8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+
+00800ebe <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ebe:	55                   	push   %ebp
+  800ebf:	89 e5                	mov    %esp,%ebp
+  800ec1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ec4:	ff 75 10             	push   0x10(%ebp)
+  800ec7:	ff 75 0c             	push   0xc(%ebp)
+  800eca:	ff 75 08             	push   0x8(%ebp)
+  800ecd:	e8 8a ff ff ff       	call   800e5c <memmove>
+}
+  800ed2:	c9                   	leave
+  800ed3:	c3                   	ret
+
+00800ed4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	56                   	push   %esi
+  800ed8:	53                   	push   %ebx
+  800ed9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800edc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800edf:	89 c6                	mov    %eax,%esi
+  800ee1:	03 75 10             	add    0x10(%ebp),%esi
+  800ee4:	eb 06                	jmp    800eec <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ee6:	83 c0 01             	add    $0x1,%eax
+  800ee9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800eec:	39 f0                	cmp    %esi,%eax
+  800eee:	74 14                	je     800f04 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ef0:	0f b6 08             	movzbl (%eax),%ecx
+  800ef3:	0f b6 1a             	movzbl (%edx),%ebx
+  800ef6:	38 d9                	cmp    %bl,%cl
+  800ef8:	74 ec                	je     800ee6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800efa:	0f b6 c1             	movzbl %cl,%eax
+  800efd:	0f b6 db             	movzbl %bl,%ebx
+  800f00:	29 d8                	sub    %ebx,%eax
+  800f02:	eb 05                	jmp    800f09 <memcmp+0x35>
+	}
+
+	return 0;
+  800f04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+
+00800f0d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f16:	89 c2                	mov    %eax,%edx
+  800f18:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f1b:	eb 03                	jmp    800f20 <memfind+0x13>
+  800f1d:	83 c0 01             	add    $0x1,%eax
+  800f20:	39 d0                	cmp    %edx,%eax
+  800f22:	73 04                	jae    800f28 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f24:	38 08                	cmp    %cl,(%eax)
+  800f26:	75 f5                	jne    800f1d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f28:	5d                   	pop    %ebp
+  800f29:	c3                   	ret
+
+00800f2a <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+  800f30:	83 ec 1c             	sub    $0x1c,%esp
+  800f33:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f36:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f39:	eb 03                	jmp    800f3e <strtol+0x14>
+		s++;
+  800f3b:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800f3e:	0f b6 06             	movzbl (%esi),%eax
+  800f41:	3c 20                	cmp    $0x20,%al
+  800f43:	74 f6                	je     800f3b <strtol+0x11>
+  800f45:	3c 09                	cmp    $0x9,%al
+  800f47:	74 f2                	je     800f3b <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f49:	3c 2b                	cmp    $0x2b,%al
+  800f4b:	74 43                	je     800f90 <strtol+0x66>
+	int neg = 0;
+  800f4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800f52:	3c 2d                	cmp    $0x2d,%al
+  800f54:	74 44                	je     800f9a <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f56:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800f5c:	75 0f                	jne    800f6d <strtol+0x43>
+  800f5e:	80 3e 30             	cmpb   $0x30,(%esi)
+  800f61:	74 41                	je     800fa4 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f63:	85 ff                	test   %edi,%edi
+  800f65:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f6a:	0f 44 f8             	cmove  %eax,%edi
+  800f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f72:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800f77:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800f7a:	89 fb                	mov    %edi,%ebx
+  800f7c:	c1 fb 1f             	sar    $0x1f,%ebx
+  800f7f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800f82:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800f85:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800f88:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800f8b:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f8e:	eb 67                	jmp    800ff7 <strtol+0xcd>
+		s++;
+  800f90:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800f93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f98:	eb bc                	jmp    800f56 <strtol+0x2c>
+		s++, neg = 1;
+  800f9a:	83 c6 01             	add    $0x1,%esi
+  800f9d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800fa2:	eb b2                	jmp    800f56 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fa4:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800fa8:	74 0e                	je     800fb8 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800faa:	85 ff                	test   %edi,%edi
+  800fac:	75 bf                	jne    800f6d <strtol+0x43>
+		s++, base = 8;
+  800fae:	83 c6 01             	add    $0x1,%esi
+  800fb1:	bf 08 00 00 00       	mov    $0x8,%edi
+  800fb6:	eb b5                	jmp    800f6d <strtol+0x43>
+		s += 2, base = 16;
+  800fb8:	83 c6 02             	add    $0x2,%esi
+  800fbb:	bf 10 00 00 00       	mov    $0x10,%edi
+  800fc0:	eb ab                	jmp    800f6d <strtol+0x43>
+			dig = *s - '0';
+  800fc2:	0f be c9             	movsbl %cl,%ecx
+  800fc5:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800fc8:	39 f9                	cmp    %edi,%ecx
+  800fca:	7d 59                	jge    801025 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800fcc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800fd0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800fd3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800fd6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800fd9:	0f af d8             	imul   %eax,%ebx
+  800fdc:	0f af d7             	imul   %edi,%edx
+  800fdf:	01 d3                	add    %edx,%ebx
+  800fe1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800fe4:	f7 e7                	mul    %edi
+  800fe6:	01 da                	add    %ebx,%edx
+  800fe8:	89 cb                	mov    %ecx,%ebx
+  800fea:	c1 fb 1f             	sar    $0x1f,%ebx
+  800fed:	01 c8                	add    %ecx,%eax
+  800fef:	11 da                	adc    %ebx,%edx
+  800ff1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ff4:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800ff7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ffa:	0f b6 08             	movzbl (%eax),%ecx
+  800ffd:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  801000:	80 fb 09             	cmp    $0x9,%bl
+  801003:	76 bd                	jbe    800fc2 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  801005:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  801008:	80 fb 19             	cmp    $0x19,%bl
+  80100b:	77 08                	ja     801015 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  80100d:	0f be c9             	movsbl %cl,%ecx
+  801010:	83 e9 57             	sub    $0x57,%ecx
+  801013:	eb b3                	jmp    800fc8 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  801015:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  801018:	80 fb 19             	cmp    $0x19,%bl
+  80101b:	77 08                	ja     801025 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  80101d:	0f be c9             	movsbl %cl,%ecx
+  801020:	83 e9 37             	sub    $0x37,%ecx
+  801023:	eb a3                	jmp    800fc8 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801025:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801028:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80102b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  80102e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801031:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801035:	74 05                	je     80103c <strtol+0x112>
+		*endptr = (char *) s;
+  801037:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80103a:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  80103c:	85 c9                	test   %ecx,%ecx
+  80103e:	74 07                	je     801047 <strtol+0x11d>
+  801040:	f7 d8                	neg    %eax
+  801042:	83 d2 00             	adc    $0x0,%edx
+  801045:	f7 da                	neg    %edx
+}
+  801047:	83 c4 1c             	add    $0x1c,%esp
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+
+0080104f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801055:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80105c:	74 18                	je     801076 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  80105e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	89 c3                	mov    %eax,%ebx
+  80106b:	89 c7                	mov    %eax,%edi
+  80106d:	89 c6                	mov    %eax,%esi
+  80106f:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801071:	5b                   	pop    %ebx
+  801072:	5e                   	pop    %esi
+  801073:	5f                   	pop    %edi
+  801074:	5d                   	pop    %ebp
+  801075:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801081:	89 c3                	mov    %eax,%ebx
+  801083:	89 c7                	mov    %eax,%edi
+  801085:	55                   	push   %ebp
+  801086:	89 e5                	mov    %esp,%ebp
+  801088:	8d 35 90 10 80 00    	lea    0x801090,%esi
+  80108e:	0f 34                	sysenter
+  801090:	5d                   	pop    %ebp
+		goto out;
+  801091:	eb de                	jmp    801071 <sys_cputs+0x22>
+
+00801093 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801099:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8010a0:	74 19                	je     8010bb <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  8010a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010ac:	89 d1                	mov    %edx,%ecx
+  8010ae:	89 d3                	mov    %edx,%ebx
+  8010b0:	89 d7                	mov    %edx,%edi
+  8010b2:	89 d6                	mov    %edx,%esi
+  8010b4:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8010b6:	5b                   	pop    %ebx
+  8010b7:	5e                   	pop    %esi
+  8010b8:	5f                   	pop    %edi
+  8010b9:	5d                   	pop    %ebp
+  8010ba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c5:	89 d1                	mov    %edx,%ecx
+  8010c7:	89 d3                	mov    %edx,%ebx
+  8010c9:	89 d7                	mov    %edx,%edi
+  8010cb:	55                   	push   %ebp
+  8010cc:	89 e5                	mov    %esp,%ebp
+  8010ce:	8d 35 d6 10 80 00    	lea    0x8010d6,%esi
+  8010d4:	0f 34                	sysenter
+  8010d6:	5d                   	pop    %ebp
+		goto out;
+  8010d7:	eb dd                	jmp    8010b6 <sys_cgetc+0x23>
+
+008010d9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8010d9:	55                   	push   %ebp
+  8010da:	89 e5                	mov    %esp,%ebp
+  8010dc:	57                   	push   %edi
+  8010dd:	56                   	push   %esi
+  8010de:	53                   	push   %ebx
+  8010df:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010e2:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8010e9:	74 21                	je     80110c <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  8010eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f8:	89 cb                	mov    %ecx,%ebx
+  8010fa:	89 cf                	mov    %ecx,%edi
+  8010fc:	89 ce                	mov    %ecx,%esi
+  8010fe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801100:	85 c0                	test   %eax,%eax
+  801102:	7f 27                	jg     80112b <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801104:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801107:	5b                   	pop    %ebx
+  801108:	5e                   	pop    %esi
+  801109:	5f                   	pop    %edi
+  80110a:	5d                   	pop    %ebp
+  80110b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80110c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801114:	b8 03 00 00 00       	mov    $0x3,%eax
+  801119:	89 cb                	mov    %ecx,%ebx
+  80111b:	89 cf                	mov    %ecx,%edi
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	8d 35 28 11 80 00    	lea    0x801128,%esi
+  801126:	0f 34                	sysenter
+  801128:	5d                   	pop    %ebp
+		goto out;
+  801129:	eb d5                	jmp    801100 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	50                   	push   %eax
+  80112f:	6a 03                	push   $0x3
+  801131:	68 ab 34 80 00       	push   $0x8034ab
+  801136:	6a 3f                	push   $0x3f
+  801138:	68 c8 34 80 00       	push   $0x8034c8
+  80113d:	e8 71 f4 ff ff       	call   8005b3 <_panic>
+
+00801142 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	57                   	push   %edi
+  801146:	56                   	push   %esi
+  801147:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801148:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80114f:	74 19                	je     80116a <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  801151:	ba 00 00 00 00       	mov    $0x0,%edx
+  801156:	b8 02 00 00 00       	mov    $0x2,%eax
+  80115b:	89 d1                	mov    %edx,%ecx
+  80115d:	89 d3                	mov    %edx,%ebx
+  80115f:	89 d7                	mov    %edx,%edi
+  801161:	89 d6                	mov    %edx,%esi
+  801163:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801165:	5b                   	pop    %ebx
+  801166:	5e                   	pop    %esi
+  801167:	5f                   	pop    %edi
+  801168:	5d                   	pop    %ebp
+  801169:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80116a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801174:	89 d1                	mov    %edx,%ecx
+  801176:	89 d3                	mov    %edx,%ebx
+  801178:	89 d7                	mov    %edx,%edi
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	8d 35 85 11 80 00    	lea    0x801185,%esi
+  801183:	0f 34                	sysenter
+  801185:	5d                   	pop    %ebp
+		goto out;
+  801186:	eb dd                	jmp    801165 <sys_getenvid+0x23>
+
+00801188 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	57                   	push   %edi
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80118e:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801195:	74 19                	je     8011b0 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  801197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011a1:	89 d1                	mov    %edx,%ecx
+  8011a3:	89 d3                	mov    %edx,%ebx
+  8011a5:	89 d7                	mov    %edx,%edi
+  8011a7:	89 d6                	mov    %edx,%esi
+  8011a9:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011ba:	89 d1                	mov    %edx,%ecx
+  8011bc:	89 d3                	mov    %edx,%ebx
+  8011be:	89 d7                	mov    %edx,%edi
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	8d 35 cb 11 80 00    	lea    0x8011cb,%esi
+  8011c9:	0f 34                	sysenter
+  8011cb:	5d                   	pop    %ebp
+		goto out;
+  8011cc:	eb dd                	jmp    8011ab <sys_yield+0x23>
+
+008011ce <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	57                   	push   %edi
+  8011d2:	56                   	push   %esi
+  8011d3:	53                   	push   %ebx
+  8011d4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011d7:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8011de:	74 23                	je     801203 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  8011e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f3:	89 f7                	mov    %esi,%edi
+  8011f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011f7:	85 c0                	test   %eax,%eax
+  8011f9:	7f 29                	jg     801224 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8011fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011fe:	5b                   	pop    %ebx
+  8011ff:	5e                   	pop    %esi
+  801200:	5f                   	pop    %edi
+  801201:	5d                   	pop    %ebp
+  801202:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801203:	8b 55 08             	mov    0x8(%ebp),%edx
+  801206:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801209:	b8 04 00 00 00       	mov    $0x4,%eax
+  80120e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801213:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	8d 35 21 12 80 00    	lea    0x801221,%esi
+  80121f:	0f 34                	sysenter
+  801221:	5d                   	pop    %ebp
+		goto out;
+  801222:	eb d3                	jmp    8011f7 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801224:	83 ec 0c             	sub    $0xc,%esp
+  801227:	50                   	push   %eax
+  801228:	6a 04                	push   $0x4
+  80122a:	68 ab 34 80 00       	push   $0x8034ab
+  80122f:	6a 3f                	push   $0x3f
+  801231:	68 c8 34 80 00       	push   $0x8034c8
+  801236:	e8 78 f3 ff ff       	call   8005b3 <_panic>
+
+0080123b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80123b:	55                   	push   %ebp
+  80123c:	89 e5                	mov    %esp,%ebp
+  80123e:	57                   	push   %edi
+  80123f:	56                   	push   %esi
+  801240:	53                   	push   %ebx
+  801241:	83 ec 0c             	sub    $0xc,%esp
+  801244:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  801247:	85 f6                	test   %esi,%esi
+  801249:	75 09                	jne    801254 <sys_page_map+0x19>
+  80124b:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801252:	74 1f                	je     801273 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  801254:	b8 05 00 00 00       	mov    $0x5,%eax
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801262:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801265:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801267:	85 c0                	test   %eax,%eax
+  801269:	7f 27                	jg     801292 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80126b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126e:	5b                   	pop    %ebx
+  80126f:	5e                   	pop    %esi
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801273:	8b 55 08             	mov    0x8(%ebp),%edx
+  801276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801279:	b8 05 00 00 00       	mov    $0x5,%eax
+  80127e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801281:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	8d 35 8f 12 80 00    	lea    0x80128f,%esi
+  80128d:	0f 34                	sysenter
+  80128f:	5d                   	pop    %ebp
+		goto out;
+  801290:	eb d5                	jmp    801267 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801292:	83 ec 0c             	sub    $0xc,%esp
+  801295:	50                   	push   %eax
+  801296:	6a 05                	push   $0x5
+  801298:	68 ab 34 80 00       	push   $0x8034ab
+  80129d:	6a 3f                	push   $0x3f
+  80129f:	68 c8 34 80 00       	push   $0x8034c8
+  8012a4:	e8 0a f3 ff ff       	call   8005b3 <_panic>
+
+008012a9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	57                   	push   %edi
+  8012ad:	56                   	push   %esi
+  8012ae:	53                   	push   %ebx
+  8012af:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012b2:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8012b9:	74 22                	je     8012dd <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  8012bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cb:	89 df                	mov    %ebx,%edi
+  8012cd:	89 de                	mov    %ebx,%esi
+  8012cf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012d1:	85 c0                	test   %eax,%eax
+  8012d3:	7f 28                	jg     8012fd <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8012d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d8:	5b                   	pop    %ebx
+  8012d9:	5e                   	pop    %esi
+  8012da:	5f                   	pop    %edi
+  8012db:	5d                   	pop    %ebp
+  8012dc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012ed:	89 df                	mov    %ebx,%edi
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	8d 35 fa 12 80 00    	lea    0x8012fa,%esi
+  8012f8:	0f 34                	sysenter
+  8012fa:	5d                   	pop    %ebp
+		goto out;
+  8012fb:	eb d4                	jmp    8012d1 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012fd:	83 ec 0c             	sub    $0xc,%esp
+  801300:	50                   	push   %eax
+  801301:	6a 06                	push   $0x6
+  801303:	68 ab 34 80 00       	push   $0x8034ab
+  801308:	6a 3f                	push   $0x3f
+  80130a:	68 c8 34 80 00       	push   $0x8034c8
+  80130f:	e8 9f f2 ff ff       	call   8005b3 <_panic>
+
+00801314 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	57                   	push   %edi
+  801318:	56                   	push   %esi
+  801319:	53                   	push   %ebx
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80131d:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801324:	74 22                	je     801348 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801326:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801330:	8b 55 08             	mov    0x8(%ebp),%edx
+  801333:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801336:	89 df                	mov    %ebx,%edi
+  801338:	89 de                	mov    %ebx,%esi
+  80133a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80133c:	85 c0                	test   %eax,%eax
+  80133e:	7f 28                	jg     801368 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801343:	5b                   	pop    %ebx
+  801344:	5e                   	pop    %esi
+  801345:	5f                   	pop    %edi
+  801346:	5d                   	pop    %ebp
+  801347:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801348:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801350:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801353:	b8 08 00 00 00       	mov    $0x8,%eax
+  801358:	89 df                	mov    %ebx,%edi
+  80135a:	55                   	push   %ebp
+  80135b:	89 e5                	mov    %esp,%ebp
+  80135d:	8d 35 65 13 80 00    	lea    0x801365,%esi
+  801363:	0f 34                	sysenter
+  801365:	5d                   	pop    %ebp
+		goto out;
+  801366:	eb d4                	jmp    80133c <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801368:	83 ec 0c             	sub    $0xc,%esp
+  80136b:	50                   	push   %eax
+  80136c:	6a 08                	push   $0x8
+  80136e:	68 ab 34 80 00       	push   $0x8034ab
+  801373:	6a 3f                	push   $0x3f
+  801375:	68 c8 34 80 00       	push   $0x8034c8
+  80137a:	e8 34 f2 ff ff       	call   8005b3 <_panic>
+
+0080137f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80137f:	55                   	push   %ebp
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	57                   	push   %edi
+  801383:	56                   	push   %esi
+  801384:	53                   	push   %ebx
+  801385:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801388:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80138f:	74 22                	je     8013b3 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801391:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801396:	b8 09 00 00 00       	mov    $0x9,%eax
+  80139b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a1:	89 df                	mov    %ebx,%edi
+  8013a3:	89 de                	mov    %ebx,%esi
+  8013a5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013a7:	85 c0                	test   %eax,%eax
+  8013a9:	7f 28                	jg     8013d3 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8013ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ae:	5b                   	pop    %ebx
+  8013af:	5e                   	pop    %esi
+  8013b0:	5f                   	pop    %edi
+  8013b1:	5d                   	pop    %ebp
+  8013b2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013be:	b8 09 00 00 00       	mov    $0x9,%eax
+  8013c3:	89 df                	mov    %ebx,%edi
+  8013c5:	55                   	push   %ebp
+  8013c6:	89 e5                	mov    %esp,%ebp
+  8013c8:	8d 35 d0 13 80 00    	lea    0x8013d0,%esi
+  8013ce:	0f 34                	sysenter
+  8013d0:	5d                   	pop    %ebp
+		goto out;
+  8013d1:	eb d4                	jmp    8013a7 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	50                   	push   %eax
+  8013d7:	6a 09                	push   $0x9
+  8013d9:	68 ab 34 80 00       	push   $0x8034ab
+  8013de:	6a 3f                	push   $0x3f
+  8013e0:	68 c8 34 80 00       	push   $0x8034c8
+  8013e5:	e8 c9 f1 ff ff       	call   8005b3 <_panic>
+
+008013ea <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	57                   	push   %edi
+  8013ee:	56                   	push   %esi
+  8013ef:	53                   	push   %ebx
+  8013f0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013f3:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8013fa:	74 22                	je     80141e <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8013fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801401:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801406:	8b 55 08             	mov    0x8(%ebp),%edx
+  801409:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140c:	89 df                	mov    %ebx,%edi
+  80140e:	89 de                	mov    %ebx,%esi
+  801410:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801412:	85 c0                	test   %eax,%eax
+  801414:	7f 28                	jg     80143e <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801419:	5b                   	pop    %ebx
+  80141a:	5e                   	pop    %esi
+  80141b:	5f                   	pop    %edi
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80141e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801423:	8b 55 08             	mov    0x8(%ebp),%edx
+  801426:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801429:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80142e:	89 df                	mov    %ebx,%edi
+  801430:	55                   	push   %ebp
+  801431:	89 e5                	mov    %esp,%ebp
+  801433:	8d 35 3b 14 80 00    	lea    0x80143b,%esi
+  801439:	0f 34                	sysenter
+  80143b:	5d                   	pop    %ebp
+		goto out;
+  80143c:	eb d4                	jmp    801412 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80143e:	83 ec 0c             	sub    $0xc,%esp
+  801441:	50                   	push   %eax
+  801442:	6a 0a                	push   $0xa
+  801444:	68 ab 34 80 00       	push   $0x8034ab
+  801449:	6a 3f                	push   $0x3f
+  80144b:	68 c8 34 80 00       	push   $0x8034c8
+  801450:	e8 5e f1 ff ff       	call   8005b3 <_panic>
+
+00801455 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	57                   	push   %edi
+  801459:	56                   	push   %esi
+  80145a:	53                   	push   %ebx
+  80145b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80145e:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801465:	74 22                	je     801489 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801467:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801471:	8b 55 08             	mov    0x8(%ebp),%edx
+  801474:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801477:	89 df                	mov    %ebx,%edi
+  801479:	89 de                	mov    %ebx,%esi
+  80147b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80147d:	85 c0                	test   %eax,%eax
+  80147f:	7f 28                	jg     8014a9 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801484:	5b                   	pop    %ebx
+  801485:	5e                   	pop    %esi
+  801486:	5f                   	pop    %edi
+  801487:	5d                   	pop    %ebp
+  801488:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801489:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801491:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801494:	b8 17 00 00 00       	mov    $0x17,%eax
+  801499:	89 df                	mov    %ebx,%edi
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	8d 35 a6 14 80 00    	lea    0x8014a6,%esi
+  8014a4:	0f 34                	sysenter
+  8014a6:	5d                   	pop    %ebp
+		goto out;
+  8014a7:	eb d4                	jmp    80147d <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014a9:	83 ec 0c             	sub    $0xc,%esp
+  8014ac:	50                   	push   %eax
+  8014ad:	6a 17                	push   $0x17
+  8014af:	68 ab 34 80 00       	push   $0x8034ab
+  8014b4:	6a 3f                	push   $0x3f
+  8014b6:	68 c8 34 80 00       	push   $0x8034c8
+  8014bb:	e8 f3 f0 ff ff       	call   8005b3 <_panic>
+
+008014c0 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8014c0:	55                   	push   %ebp
+  8014c1:	89 e5                	mov    %esp,%ebp
+  8014c3:	57                   	push   %edi
+  8014c4:	56                   	push   %esi
+  8014c5:	53                   	push   %ebx
+  8014c6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014c9:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8014d0:	74 22                	je     8014f4 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8014d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d7:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e2:	89 df                	mov    %ebx,%edi
+  8014e4:	89 de                	mov    %ebx,%esi
+  8014e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	7f 28                	jg     801514 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8014ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5f                   	pop    %edi
+  8014f2:	5d                   	pop    %ebp
+  8014f3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ff:	b8 18 00 00 00       	mov    $0x18,%eax
+  801504:	89 df                	mov    %ebx,%edi
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	8d 35 11 15 80 00    	lea    0x801511,%esi
+  80150f:	0f 34                	sysenter
+  801511:	5d                   	pop    %ebp
+		goto out;
+  801512:	eb d4                	jmp    8014e8 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801514:	83 ec 0c             	sub    $0xc,%esp
+  801517:	50                   	push   %eax
+  801518:	6a 18                	push   $0x18
+  80151a:	68 ab 34 80 00       	push   $0x8034ab
+  80151f:	6a 3f                	push   $0x3f
+  801521:	68 c8 34 80 00       	push   $0x8034c8
+  801526:	e8 88 f0 ff ff       	call   8005b3 <_panic>
+
+0080152b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80152b:	55                   	push   %ebp
+  80152c:	89 e5                	mov    %esp,%ebp
+  80152e:	57                   	push   %edi
+  80152f:	56                   	push   %esi
+  801530:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801531:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801538:	74 1d                	je     801557 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80153a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80153f:	be 00 00 00 00       	mov    $0x0,%esi
+  801544:	8b 55 08             	mov    0x8(%ebp),%edx
+  801547:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801550:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801552:	5b                   	pop    %ebx
+  801553:	5e                   	pop    %esi
+  801554:	5f                   	pop    %edi
+  801555:	5d                   	pop    %ebp
+  801556:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801562:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801565:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	8d 35 73 15 80 00    	lea    0x801573,%esi
+  801571:	0f 34                	sysenter
+  801573:	5d                   	pop    %ebp
+		goto out;
+  801574:	eb dc                	jmp    801552 <sys_ipc_try_send+0x27>
+
+00801576 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	57                   	push   %edi
+  80157a:	56                   	push   %esi
+  80157b:	53                   	push   %ebx
+  80157c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80157f:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801586:	74 21                	je     8015a9 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801588:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801592:	8b 55 08             	mov    0x8(%ebp),%edx
+  801595:	89 cb                	mov    %ecx,%ebx
+  801597:	89 cf                	mov    %ecx,%edi
+  801599:	89 ce                	mov    %ecx,%esi
+  80159b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80159d:	85 c0                	test   %eax,%eax
+  80159f:	7f 27                	jg     8015c8 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8015a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a4:	5b                   	pop    %ebx
+  8015a5:	5e                   	pop    %esi
+  8015a6:	5f                   	pop    %edi
+  8015a7:	5d                   	pop    %ebp
+  8015a8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015b6:	89 cb                	mov    %ecx,%ebx
+  8015b8:	89 cf                	mov    %ecx,%edi
+  8015ba:	55                   	push   %ebp
+  8015bb:	89 e5                	mov    %esp,%ebp
+  8015bd:	8d 35 c5 15 80 00    	lea    0x8015c5,%esi
+  8015c3:	0f 34                	sysenter
+  8015c5:	5d                   	pop    %ebp
+		goto out;
+  8015c6:	eb d5                	jmp    80159d <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c8:	83 ec 0c             	sub    $0xc,%esp
+  8015cb:	50                   	push   %eax
+  8015cc:	6a 0d                	push   $0xd
+  8015ce:	68 ab 34 80 00       	push   $0x8034ab
+  8015d3:	6a 3f                	push   $0x3f
+  8015d5:	68 c8 34 80 00       	push   $0x8034c8
+  8015da:	e8 d4 ef ff ff       	call   8005b3 <_panic>
+
+008015df <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	57                   	push   %edi
+  8015e3:	56                   	push   %esi
+  8015e4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015e5:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8015ec:	74 1b                	je     801609 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8015ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fe:	89 df                	mov    %ebx,%edi
+  801600:	89 de                	mov    %ebx,%esi
+  801602:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801604:	5b                   	pop    %ebx
+  801605:	5e                   	pop    %esi
+  801606:	5f                   	pop    %edi
+  801607:	5d                   	pop    %ebp
+  801608:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801609:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801611:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801614:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801619:	89 df                	mov    %ebx,%edi
+  80161b:	55                   	push   %ebp
+  80161c:	89 e5                	mov    %esp,%ebp
+  80161e:	8d 35 26 16 80 00    	lea    0x801626,%esi
+  801624:	0f 34                	sysenter
+  801626:	5d                   	pop    %ebp
+		goto out;
+  801627:	eb db                	jmp    801604 <sys_ipc_recv_until+0x25>
+
+00801629 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	57                   	push   %edi
+  80162d:	56                   	push   %esi
+  80162e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80162f:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801636:	74 19                	je     801651 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801638:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801642:	89 d1                	mov    %edx,%ecx
+  801644:	89 d3                	mov    %edx,%ebx
+  801646:	89 d7                	mov    %edx,%edi
+  801648:	89 d6                	mov    %edx,%esi
+  80164a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80164c:	5b                   	pop    %ebx
+  80164d:	5e                   	pop    %esi
+  80164e:	5f                   	pop    %edi
+  80164f:	5d                   	pop    %ebp
+  801650:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801651:	ba 00 00 00 00       	mov    $0x0,%edx
+  801656:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80165b:	89 d1                	mov    %edx,%ecx
+  80165d:	89 d3                	mov    %edx,%ebx
+  80165f:	89 d7                	mov    %edx,%edi
+  801661:	55                   	push   %ebp
+  801662:	89 e5                	mov    %esp,%ebp
+  801664:	8d 35 6c 16 80 00    	lea    0x80166c,%esi
+  80166a:	0f 34                	sysenter
+  80166c:	5d                   	pop    %ebp
+		goto out;
+  80166d:	eb dd                	jmp    80164c <sys_time_msec+0x23>
+
+0080166f <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80166f:	55                   	push   %ebp
+  801670:	89 e5                	mov    %esp,%ebp
+  801672:	57                   	push   %edi
+  801673:	56                   	push   %esi
+  801674:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801675:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80167c:	74 1a                	je     801698 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80167e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801683:	b8 10 00 00 00       	mov    $0x10,%eax
+  801688:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168b:	89 cb                	mov    %ecx,%ebx
+  80168d:	89 cf                	mov    %ecx,%edi
+  80168f:	89 ce                	mov    %ecx,%esi
+  801691:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801693:	5b                   	pop    %ebx
+  801694:	5e                   	pop    %esi
+  801695:	5f                   	pop    %edi
+  801696:	5d                   	pop    %ebp
+  801697:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801698:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016a0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8016a5:	89 cb                	mov    %ecx,%ebx
+  8016a7:	89 cf                	mov    %ecx,%edi
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	8d 35 b4 16 80 00    	lea    0x8016b4,%esi
+  8016b2:	0f 34                	sysenter
+  8016b4:	5d                   	pop    %ebp
+		goto out;
+  8016b5:	eb dc                	jmp    801693 <sys_sleep_until+0x24>
+
+008016b7 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	57                   	push   %edi
+  8016bb:	56                   	push   %esi
+  8016bc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016bd:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8016c4:	74 1a                	je     8016e0 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8016c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016cb:	b8 11 00 00 00       	mov    $0x11,%eax
+  8016d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d3:	89 cb                	mov    %ecx,%ebx
+  8016d5:	89 cf                	mov    %ecx,%edi
+  8016d7:	89 ce                	mov    %ecx,%esi
+  8016d9:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8016db:	5b                   	pop    %ebx
+  8016dc:	5e                   	pop    %esi
+  8016dd:	5f                   	pop    %edi
+  8016de:	5d                   	pop    %ebp
+  8016df:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016e8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8016ed:	89 cb                	mov    %ecx,%ebx
+  8016ef:	89 cf                	mov    %ecx,%edi
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	8d 35 fc 16 80 00    	lea    0x8016fc,%esi
+  8016fa:	0f 34                	sysenter
+  8016fc:	5d                   	pop    %ebp
+		goto out;
+  8016fd:	eb dc                	jmp    8016db <sys_env_print_stats+0x24>
+
+008016ff <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8016ff:	55                   	push   %ebp
+  801700:	89 e5                	mov    %esp,%ebp
+  801702:	57                   	push   %edi
+  801703:	56                   	push   %esi
+  801704:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801705:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80170c:	74 1b                	je     801729 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80170e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801713:	b8 19 00 00 00       	mov    $0x19,%eax
+  801718:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171e:	89 df                	mov    %ebx,%edi
+  801720:	89 de                	mov    %ebx,%esi
+  801722:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801724:	5b                   	pop    %ebx
+  801725:	5e                   	pop    %esi
+  801726:	5f                   	pop    %edi
+  801727:	5d                   	pop    %ebp
+  801728:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801729:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801731:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801734:	b8 19 00 00 00       	mov    $0x19,%eax
+  801739:	89 df                	mov    %ebx,%edi
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	8d 35 46 17 80 00    	lea    0x801746,%esi
+  801744:	0f 34                	sysenter
+  801746:	5d                   	pop    %ebp
+		goto out;
+  801747:	eb db                	jmp    801724 <sys_perf+0x25>
+
+00801749 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801749:	55                   	push   %ebp
+  80174a:	89 e5                	mov    %esp,%ebp
+  80174c:	57                   	push   %edi
+  80174d:	56                   	push   %esi
+  80174e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80174f:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801756:	74 19                	je     801771 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801758:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801762:	89 d1                	mov    %edx,%ecx
+  801764:	89 d3                	mov    %edx,%ebx
+  801766:	89 d7                	mov    %edx,%edi
+  801768:	89 d6                	mov    %edx,%esi
+  80176a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80176c:	5b                   	pop    %ebx
+  80176d:	5e                   	pop    %esi
+  80176e:	5f                   	pop    %edi
+  80176f:	5d                   	pop    %ebp
+  801770:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801771:	ba 00 00 00 00       	mov    $0x0,%edx
+  801776:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80177b:	89 d1                	mov    %edx,%ecx
+  80177d:	89 d3                	mov    %edx,%ebx
+  80177f:	89 d7                	mov    %edx,%edi
+  801781:	55                   	push   %ebp
+  801782:	89 e5                	mov    %esp,%ebp
+  801784:	8d 35 8c 17 80 00    	lea    0x80178c,%esi
+  80178a:	0f 34                	sysenter
+  80178c:	5d                   	pop    %ebp
+		goto out;
+  80178d:	eb dd                	jmp    80176c <sys_fork+0x23>
+
+0080178f <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80178f:	55                   	push   %ebp
+  801790:	89 e5                	mov    %esp,%ebp
+  801792:	57                   	push   %edi
+  801793:	56                   	push   %esi
+  801794:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801795:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80179c:	74 1c                	je     8017ba <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80179e:	be 00 00 00 00       	mov    $0x0,%esi
+  8017a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8017a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017b1:	89 f7                	mov    %esi,%edi
+  8017b3:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8017b5:	5b                   	pop    %ebx
+  8017b6:	5e                   	pop    %esi
+  8017b7:	5f                   	pop    %edi
+  8017b8:	5d                   	pop    %ebp
+  8017b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8017c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017cd:	55                   	push   %ebp
+  8017ce:	89 e5                	mov    %esp,%ebp
+  8017d0:	8d 35 d8 17 80 00    	lea    0x8017d8,%esi
+  8017d6:	0f 34                	sysenter
+  8017d8:	5d                   	pop    %ebp
+		goto out;
+  8017d9:	eb da                	jmp    8017b5 <sys_thread_create+0x26>
+
+008017db <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8017db:	55                   	push   %ebp
+  8017dc:	89 e5                	mov    %esp,%ebp
+  8017de:	57                   	push   %edi
+  8017df:	56                   	push   %esi
+  8017e0:	53                   	push   %ebx
+  8017e1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017e4:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8017eb:	74 24                	je     801811 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8017ed:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8017f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801800:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801803:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801805:	85 c0                	test   %eax,%eax
+  801807:	7f 27                	jg     801830 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80180c:	5b                   	pop    %ebx
+  80180d:	5e                   	pop    %esi
+  80180e:	5f                   	pop    %edi
+  80180f:	5d                   	pop    %ebp
+  801810:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801811:	8b 55 08             	mov    0x8(%ebp),%edx
+  801814:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801817:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80181c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80181f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801822:	55                   	push   %ebp
+  801823:	89 e5                	mov    %esp,%ebp
+  801825:	8d 35 2d 18 80 00    	lea    0x80182d,%esi
+  80182b:	0f 34                	sysenter
+  80182d:	5d                   	pop    %ebp
+		goto out;
+  80182e:	eb d5                	jmp    801805 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801830:	83 ec 0c             	sub    $0xc,%esp
+  801833:	50                   	push   %eax
+  801834:	6a 1f                	push   $0x1f
+  801836:	68 ab 34 80 00       	push   $0x8034ab
+  80183b:	6a 3f                	push   $0x3f
+  80183d:	68 c8 34 80 00       	push   $0x8034c8
+  801842:	e8 6c ed ff ff       	call   8005b3 <_panic>
+
+00801847 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	57                   	push   %edi
+  80184b:	56                   	push   %esi
+  80184c:	53                   	push   %ebx
+  80184d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801850:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801857:	74 23                	je     80187c <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801859:	be 00 00 00 00       	mov    $0x0,%esi
+  80185e:	b8 20 00 00 00       	mov    $0x20,%eax
+  801863:	8b 55 08             	mov    0x8(%ebp),%edx
+  801866:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801869:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186c:	89 f7                	mov    %esi,%edi
+  80186e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801870:	85 c0                	test   %eax,%eax
+  801872:	7f 29                	jg     80189d <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801877:	5b                   	pop    %ebx
+  801878:	5e                   	pop    %esi
+  801879:	5f                   	pop    %edi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80187c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801882:	b8 20 00 00 00       	mov    $0x20,%eax
+  801887:	bf 00 00 00 00       	mov    $0x0,%edi
+  80188c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80188f:	55                   	push   %ebp
+  801890:	89 e5                	mov    %esp,%ebp
+  801892:	8d 35 9a 18 80 00    	lea    0x80189a,%esi
+  801898:	0f 34                	sysenter
+  80189a:	5d                   	pop    %ebp
+		goto out;
+  80189b:	eb d3                	jmp    801870 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80189d:	83 ec 0c             	sub    $0xc,%esp
+  8018a0:	50                   	push   %eax
+  8018a1:	6a 20                	push   $0x20
+  8018a3:	68 ab 34 80 00       	push   $0x8034ab
+  8018a8:	6a 3f                	push   $0x3f
+  8018aa:	68 c8 34 80 00       	push   $0x8034c8
+  8018af:	e8 ff ec ff ff       	call   8005b3 <_panic>
+
+008018b4 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8018b4:	55                   	push   %ebp
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	57                   	push   %edi
+  8018b8:	56                   	push   %esi
+  8018b9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018ba:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8018c1:	74 1b                	je     8018de <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8018c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8018cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d3:	89 df                	mov    %ebx,%edi
+  8018d5:	89 de                	mov    %ebx,%esi
+  8018d7:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8018d9:	5b                   	pop    %ebx
+  8018da:	5e                   	pop    %esi
+  8018db:	5f                   	pop    %edi
+  8018dc:	5d                   	pop    %ebp
+  8018dd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8018ee:	89 df                	mov    %ebx,%edi
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	8d 35 fb 18 80 00    	lea    0x8018fb,%esi
+  8018f9:	0f 34                	sysenter
+  8018fb:	5d                   	pop    %ebp
+		goto out;
+  8018fc:	eb db                	jmp    8018d9 <sys_batch+0x25>
+
+008018fe <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	57                   	push   %edi
+  801902:	56                   	push   %esi
+  801903:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801904:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80190b:	74 1a                	je     801927 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80190d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801912:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801917:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191a:	89 cb                	mov    %ecx,%ebx
+  80191c:	89 cf                	mov    %ecx,%edi
+  80191e:	89 ce                	mov    %ecx,%esi
+  801920:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801922:	5b                   	pop    %ebx
+  801923:	5e                   	pop    %esi
+  801924:	5f                   	pop    %edi
+  801925:	5d                   	pop    %ebp
+  801926:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801927:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80192f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801934:	89 cb                	mov    %ecx,%ebx
+  801936:	89 cf                	mov    %ecx,%edi
+  801938:	55                   	push   %ebp
+  801939:	89 e5                	mov    %esp,%ebp
+  80193b:	8d 35 43 19 80 00    	lea    0x801943,%esi
+  801941:	0f 34                	sysenter
+  801943:	5d                   	pop    %ebp
+		goto out;
+  801944:	eb dc                	jmp    801922 <sys_trace_ctl+0x24>
+
+00801946 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801946:	55                   	push   %ebp
+  801947:	89 e5                	mov    %esp,%ebp
+  801949:	57                   	push   %edi
+  80194a:	56                   	push   %esi
+  80194b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80194c:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801953:	74 1c                	je     801971 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801955:	be 00 00 00 00       	mov    $0x0,%esi
+  80195a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80195f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801962:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801965:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801968:	89 f7                	mov    %esi,%edi
+  80196a:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80196c:	5b                   	pop    %ebx
+  80196d:	5e                   	pop    %esi
+  80196e:	5f                   	pop    %edi
+  80196f:	5d                   	pop    %ebp
+  801970:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801971:	8b 55 08             	mov    0x8(%ebp),%edx
+  801974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801977:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80197c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801981:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	8d 35 8f 19 80 00    	lea    0x80198f,%esi
+  80198d:	0f 34                	sysenter
+  80198f:	5d                   	pop    %ebp
+		goto out;
+  801990:	eb da                	jmp    80196c <sys_trace_read+0x26>
+
+00801992 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801992:	55                   	push   %ebp
+  801993:	89 e5                	mov    %esp,%ebp
+  801995:	57                   	push   %edi
+  801996:	56                   	push   %esi
+  801997:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801998:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  80199f:	74 1c                	je     8019bd <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8019a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8019ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019b4:	89 f7                	mov    %esi,%edi
+  8019b6:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8019b8:	5b                   	pop    %ebx
+  8019b9:	5e                   	pop    %esi
+  8019ba:	5f                   	pop    %edi
+  8019bb:	5d                   	pop    %ebp
+  8019bc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c3:	b8 21 00 00 00       	mov    $0x21,%eax
+  8019c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019d0:	55                   	push   %ebp
+  8019d1:	89 e5                	mov    %esp,%ebp
+  8019d3:	8d 35 db 19 80 00    	lea    0x8019db,%esi
+  8019d9:	0f 34                	sysenter
+  8019db:	5d                   	pop    %ebp
+		goto out;
+  8019dc:	eb da                	jmp    8019b8 <sys_meminfo+0x26>
+
+008019de <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8019de:	55                   	push   %ebp
+  8019df:	89 e5                	mov    %esp,%ebp
+  8019e1:	57                   	push   %edi
+  8019e2:	56                   	push   %esi
+  8019e3:	53                   	push   %ebx
+  8019e4:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8019e7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8019eb:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  8019f2:	74 1f                	je     801a13 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8019f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f9:	b8 22 00 00 00       	mov    $0x22,%eax
+  8019fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a01:	89 df                	mov    %ebx,%edi
+  801a03:	89 de                	mov    %ebx,%esi
+  801a05:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a07:	85 c0                	test   %eax,%eax
+  801a09:	7f 25                	jg     801a30 <sys_env_set_ksm+0x52>
+}
+  801a0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0e:	5b                   	pop    %ebx
+  801a0f:	5e                   	pop    %esi
+  801a10:	5f                   	pop    %edi
+  801a11:	5d                   	pop    %ebp
+  801a12:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a18:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1b:	b8 22 00 00 00       	mov    $0x22,%eax
+  801a20:	89 df                	mov    %ebx,%edi
+  801a22:	55                   	push   %ebp
+  801a23:	89 e5                	mov    %esp,%ebp
+  801a25:	8d 35 2d 1a 80 00    	lea    0x801a2d,%esi
+  801a2b:	0f 34                	sysenter
+  801a2d:	5d                   	pop    %ebp
+		goto out;
+  801a2e:	eb d7                	jmp    801a07 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a30:	83 ec 0c             	sub    $0xc,%esp
+  801a33:	50                   	push   %eax
+  801a34:	6a 22                	push   $0x22
+  801a36:	68 ab 34 80 00       	push   $0x8034ab
+  801a3b:	6a 3f                	push   $0x3f
+  801a3d:	68 c8 34 80 00       	push   $0x8034c8
+  801a42:	e8 6c eb ff ff       	call   8005b3 <_panic>
+
+00801a47 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801a47:	55                   	push   %ebp
+  801a48:	89 e5                	mov    %esp,%ebp
+  801a4a:	57                   	push   %edi
+  801a4b:	56                   	push   %esi
+  801a4c:	53                   	push   %ebx
+  801a4d:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801a50:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801a53:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801a5a:	74 24                	je     801a80 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801a5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a61:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a66:	89 cb                	mov    %ecx,%ebx
+  801a68:	89 cf                	mov    %ecx,%edi
+  801a6a:	89 ce                	mov    %ecx,%esi
+  801a6c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	7f 2a                	jg     801a9c <sys_time_nsec+0x55>
+	return ns;
+}
+  801a72:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a75:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a7b:	5b                   	pop    %ebx
+  801a7c:	5e                   	pop    %esi
+  801a7d:	5f                   	pop    %edi
+  801a7e:	5d                   	pop    %ebp
+  801a7f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a85:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a8a:	89 cb                	mov    %ecx,%ebx
+  801a8c:	89 cf                	mov    %ecx,%edi
+  801a8e:	55                   	push   %ebp
+  801a8f:	89 e5                	mov    %esp,%ebp
+  801a91:	8d 35 99 1a 80 00    	lea    0x801a99,%esi
+  801a97:	0f 34                	sysenter
+  801a99:	5d                   	pop    %ebp
+		goto out;
+  801a9a:	eb d2                	jmp    801a6e <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a9c:	83 ec 0c             	sub    $0xc,%esp
+  801a9f:	50                   	push   %eax
+  801aa0:	6a 0f                	push   $0xf
+  801aa2:	68 ab 34 80 00       	push   $0x8034ab
+  801aa7:	6a 3f                	push   $0x3f
+  801aa9:	68 c8 34 80 00       	push   $0x8034c8
+  801aae:	e8 00 eb ff ff       	call   8005b3 <_panic>
+
+00801ab3 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801ab3:	55                   	push   %ebp
+  801ab4:	89 e5                	mov    %esp,%ebp
+  801ab6:	57                   	push   %edi
+  801ab7:	56                   	push   %esi
+  801ab8:	53                   	push   %ebx
+  801ab9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801abc:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801ac3:	74 22                	je     801ae7 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801ac5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aca:	b8 12 00 00 00       	mov    $0x12,%eax
+  801acf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad5:	89 df                	mov    %ebx,%edi
+  801ad7:	89 de                	mov    %ebx,%esi
+  801ad9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801adb:	85 c0                	test   %eax,%eax
+  801add:	7f 28                	jg     801b07 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801adf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae2:	5b                   	pop    %ebx
+  801ae3:	5e                   	pop    %esi
+  801ae4:	5f                   	pop    %edi
+  801ae5:	5d                   	pop    %ebp
+  801ae6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ae7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aec:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801af2:	b8 12 00 00 00       	mov    $0x12,%eax
+  801af7:	89 df                	mov    %ebx,%edi
+  801af9:	55                   	push   %ebp
+  801afa:	89 e5                	mov    %esp,%ebp
+  801afc:	8d 35 04 1b 80 00    	lea    0x801b04,%esi
+  801b02:	0f 34                	sysenter
+  801b04:	5d                   	pop    %ebp
+		goto out;
+  801b05:	eb d4                	jmp    801adb <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b07:	83 ec 0c             	sub    $0xc,%esp
+  801b0a:	50                   	push   %eax
+  801b0b:	6a 12                	push   $0x12
+  801b0d:	68 ab 34 80 00       	push   $0x8034ab
+  801b12:	6a 3f                	push   $0x3f
+  801b14:	68 c8 34 80 00       	push   $0x8034c8
+  801b19:	e8 95 ea ff ff       	call   8005b3 <_panic>
+
+00801b1e <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801b1e:	55                   	push   %ebp
+  801b1f:	89 e5                	mov    %esp,%ebp
+  801b21:	57                   	push   %edi
+  801b22:	56                   	push   %esi
+  801b23:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b24:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801b2b:	74 1b                	je     801b48 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801b2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b32:	b8 13 00 00 00       	mov    $0x13,%eax
+  801b37:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b3d:	89 df                	mov    %ebx,%edi
+  801b3f:	89 de                	mov    %ebx,%esi
+  801b41:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801b43:	5b                   	pop    %ebx
+  801b44:	5e                   	pop    %esi
+  801b45:	5f                   	pop    %edi
+  801b46:	5d                   	pop    %ebp
+  801b47:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b53:	b8 13 00 00 00       	mov    $0x13,%eax
+  801b58:	89 df                	mov    %ebx,%edi
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	8d 35 65 1b 80 00    	lea    0x801b65,%esi
+  801b63:	0f 34                	sysenter
+  801b65:	5d                   	pop    %ebp
+		goto out;
+  801b66:	eb db                	jmp    801b43 <sys_e1000_receive+0x25>
+
+00801b68 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801b68:	55                   	push   %ebp
+  801b69:	89 e5                	mov    %esp,%ebp
+  801b6b:	57                   	push   %edi
+  801b6c:	56                   	push   %esi
+  801b6d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b6e:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801b75:	74 1b                	je     801b92 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801b77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b7c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b87:	89 df                	mov    %ebx,%edi
+  801b89:	89 de                	mov    %ebx,%esi
+  801b8b:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801b8d:	5b                   	pop    %ebx
+  801b8e:	5e                   	pop    %esi
+  801b8f:	5f                   	pop    %edi
+  801b90:	5d                   	pop    %ebp
+  801b91:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b9d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ba2:	89 df                	mov    %ebx,%edi
+  801ba4:	55                   	push   %ebp
+  801ba5:	89 e5                	mov    %esp,%ebp
+  801ba7:	8d 35 af 1b 80 00    	lea    0x801baf,%esi
+  801bad:	0f 34                	sysenter
+  801baf:	5d                   	pop    %ebp
+		goto out;
+  801bb0:	eb db                	jmp    801b8d <sys_e1000_read_hwaddr+0x25>
+
+00801bb2 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801bb2:	55                   	push   %ebp
+  801bb3:	89 e5                	mov    %esp,%ebp
+  801bb5:	57                   	push   %edi
+  801bb6:	56                   	push   %esi
+  801bb7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801bb8:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801bbf:	74 1a                	je     801bdb <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801bc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bc6:	b8 15 00 00 00       	mov    $0x15,%eax
+  801bcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bce:	89 cb                	mov    %ecx,%ebx
+  801bd0:	89 cf                	mov    %ecx,%edi
+  801bd2:	89 ce                	mov    %ecx,%esi
+  801bd4:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801bd6:	5b                   	pop    %ebx
+  801bd7:	5e                   	pop    %esi
+  801bd8:	5f                   	pop    %edi
+  801bd9:	5d                   	pop    %ebp
+  801bda:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801bdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bde:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be3:	b8 15 00 00 00       	mov    $0x15,%eax
+  801be8:	89 cb                	mov    %ecx,%ebx
+  801bea:	89 cf                	mov    %ecx,%edi
+  801bec:	55                   	push   %ebp
+  801bed:	89 e5                	mov    %esp,%ebp
+  801bef:	8d 35 f7 1b 80 00    	lea    0x801bf7,%esi
+  801bf5:	0f 34                	sysenter
+  801bf7:	5d                   	pop    %ebp
+		goto out;
+  801bf8:	eb dc                	jmp    801bd6 <sys_sb16_read_version+0x24>
+
+00801bfa <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	57                   	push   %edi
+  801bfe:	56                   	push   %esi
+  801bff:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801c00:	80 3d 1c 50 80 00 00 	cmpb   $0x0,0x80501c
+  801c07:	74 1b                	je     801c24 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801c09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c0e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801c13:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c19:	89 df                	mov    %ebx,%edi
+  801c1b:	89 de                	mov    %ebx,%esi
+  801c1d:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801c1f:	5b                   	pop    %ebx
+  801c20:	5e                   	pop    %esi
+  801c21:	5f                   	pop    %edi
+  801c22:	5d                   	pop    %ebp
+  801c23:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c29:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c2f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801c34:	89 df                	mov    %ebx,%edi
+  801c36:	55                   	push   %ebp
+  801c37:	89 e5                	mov    %esp,%ebp
+  801c39:	8d 35 41 1c 80 00    	lea    0x801c41,%esi
+  801c3f:	0f 34                	sysenter
+  801c41:	5d                   	pop    %ebp
+		goto out;
+  801c42:	eb db                	jmp    801c1f <sys_sb16_play+0x25>
+
+00801c44 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c47:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4a:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c4f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+
+00801c54 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801c54:	55                   	push   %ebp
+  801c55:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801c5f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c64:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801c69:	5d                   	pop    %ebp
+  801c6a:	c3                   	ret
+
+00801c6b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801c6b:	55                   	push   %ebp
+  801c6c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801c6e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801c73:	eb 02                	jmp    801c77 <fd_alloc+0xc>
+  801c75:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c77:	89 c2                	mov    %eax,%edx
+  801c79:	c1 ea 16             	shr    $0x16,%edx
+  801c7c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c83:	f6 c2 01             	test   $0x1,%dl
+  801c86:	74 2b                	je     801cb3 <fd_alloc+0x48>
+  801c88:	89 c2                	mov    %eax,%edx
+  801c8a:	c1 ea 0c             	shr    $0xc,%edx
+  801c8d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801c94:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801c9a:	f6 c1 01             	test   $0x1,%cl
+  801c9d:	74 14                	je     801cb3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801c9f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801ca5:	75 ce                	jne    801c75 <fd_alloc+0xa>
+  801ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801cac:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801cb1:	eb 05                	jmp    801cb8 <fd_alloc+0x4d>
+			return 0;
+  801cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cbb:	89 02                	mov    %eax,(%edx)
+}
+  801cbd:	89 c8                	mov    %ecx,%eax
+  801cbf:	5d                   	pop    %ebp
+  801cc0:	c3                   	ret
+
+00801cc1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801cc7:	83 f8 1f             	cmp    $0x1f,%eax
+  801cca:	77 30                	ja     801cfc <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801ccc:	c1 e0 0c             	shl    $0xc,%eax
+  801ccf:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801cd4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801cda:	f6 c2 01             	test   $0x1,%dl
+  801cdd:	74 24                	je     801d03 <fd_lookup+0x42>
+  801cdf:	89 c2                	mov    %eax,%edx
+  801ce1:	c1 ea 0c             	shr    $0xc,%edx
+  801ce4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ceb:	f6 c2 01             	test   $0x1,%dl
+  801cee:	74 1a                	je     801d0a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801cf0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cf3:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cfa:	5d                   	pop    %ebp
+  801cfb:	c3                   	ret
+		return -E_INVAL;
+  801cfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d01:	eb f7                	jmp    801cfa <fd_lookup+0x39>
+		return -E_INVAL;
+  801d03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d08:	eb f0                	jmp    801cfa <fd_lookup+0x39>
+  801d0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d0f:	eb e9                	jmp    801cfa <fd_lookup+0x39>
+
+00801d11 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801d11:	55                   	push   %ebp
+  801d12:	89 e5                	mov    %esp,%ebp
+  801d14:	53                   	push   %ebx
+  801d15:	83 ec 04             	sub    $0x4,%esp
+  801d18:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d20:	eb 03                	jmp    801d25 <dev_lookup+0x14>
+  801d22:	83 c0 01             	add    $0x1,%eax
+  801d25:	8b 1c 85 54 35 80 00 	mov    0x803554(,%eax,4),%ebx
+  801d2c:	85 db                	test   %ebx,%ebx
+  801d2e:	74 0b                	je     801d3b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801d30:	39 13                	cmp    %edx,(%ebx)
+  801d32:	75 ee                	jne    801d22 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d39:	eb 2e                	jmp    801d69 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801d3b:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d3d:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801d42:	8b 0d 18 50 80 00    	mov    0x805018,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d48:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d4d:	76 24                	jbe    801d73 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d4f:	8b 41 48             	mov    0x48(%ecx),%eax
+  801d52:	83 ec 04             	sub    $0x4,%esp
+  801d55:	52                   	push   %edx
+  801d56:	50                   	push   %eax
+  801d57:	68 d8 34 80 00       	push   $0x8034d8
+  801d5c:	e8 2d e9 ff ff       	call   80068e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801d69:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d6c:	89 1a                	mov    %ebx,(%edx)
+}
+  801d6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d71:	c9                   	leave
+  801d72:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d73:	c1 e8 10             	shr    $0x10,%eax
+  801d76:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d7c:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801d82:	eb cb                	jmp    801d4f <dev_lookup+0x3e>
+
+00801d84 <fd_close>:
+{
+  801d84:	55                   	push   %ebp
+  801d85:	89 e5                	mov    %esp,%ebp
+  801d87:	57                   	push   %edi
+  801d88:	56                   	push   %esi
+  801d89:	53                   	push   %ebx
+  801d8a:	83 ec 24             	sub    $0x24,%esp
+  801d8d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d90:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d93:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d96:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d97:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d9d:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801da0:	50                   	push   %eax
+  801da1:	e8 1b ff ff ff       	call   801cc1 <fd_lookup>
+  801da6:	89 c3                	mov    %eax,%ebx
+  801da8:	83 c4 10             	add    $0x10,%esp
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 05                	js     801db4 <fd_close+0x30>
+	    || fd != fd2)
+  801daf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801db2:	74 16                	je     801dca <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801db4:	89 f8                	mov    %edi,%eax
+  801db6:	84 c0                	test   %al,%al
+  801db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dbd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801dc0:	89 d8                	mov    %ebx,%eax
+  801dc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc5:	5b                   	pop    %ebx
+  801dc6:	5e                   	pop    %esi
+  801dc7:	5f                   	pop    %edi
+  801dc8:	5d                   	pop    %ebp
+  801dc9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801dca:	83 ec 08             	sub    $0x8,%esp
+  801dcd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801dd0:	50                   	push   %eax
+  801dd1:	ff 36                	push   (%esi)
+  801dd3:	e8 39 ff ff ff       	call   801d11 <dev_lookup>
+  801dd8:	89 c3                	mov    %eax,%ebx
+  801dda:	83 c4 10             	add    $0x10,%esp
+  801ddd:	85 c0                	test   %eax,%eax
+  801ddf:	78 1a                	js     801dfb <fd_close+0x77>
+		if (dev->dev_close)
+  801de1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801de4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801de7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801dec:	85 c0                	test   %eax,%eax
+  801dee:	74 0b                	je     801dfb <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801df0:	83 ec 0c             	sub    $0xc,%esp
+  801df3:	56                   	push   %esi
+  801df4:	ff d0                	call   *%eax
+  801df6:	89 c3                	mov    %eax,%ebx
+  801df8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801dfb:	83 ec 08             	sub    $0x8,%esp
+  801dfe:	56                   	push   %esi
+  801dff:	6a 00                	push   $0x0
+  801e01:	e8 a3 f4 ff ff       	call   8012a9 <sys_page_unmap>
+	return r;
+  801e06:	83 c4 10             	add    $0x10,%esp
+  801e09:	eb b5                	jmp    801dc0 <fd_close+0x3c>
+
+00801e0b <close>:
+
+int
+close(int fdnum)
+{
+  801e0b:	55                   	push   %ebp
+  801e0c:	89 e5                	mov    %esp,%ebp
+  801e0e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e14:	50                   	push   %eax
+  801e15:	ff 75 08             	push   0x8(%ebp)
+  801e18:	e8 a4 fe ff ff       	call   801cc1 <fd_lookup>
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	79 02                	jns    801e26 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801e24:	c9                   	leave
+  801e25:	c3                   	ret
+		return fd_close(fd, 1);
+  801e26:	83 ec 08             	sub    $0x8,%esp
+  801e29:	6a 01                	push   $0x1
+  801e2b:	ff 75 f4             	push   -0xc(%ebp)
+  801e2e:	e8 51 ff ff ff       	call   801d84 <fd_close>
+  801e33:	83 c4 10             	add    $0x10,%esp
+  801e36:	eb ec                	jmp    801e24 <close+0x19>
+
+00801e38 <close_all>:
+
+void
+close_all(void)
+{
+  801e38:	55                   	push   %ebp
+  801e39:	89 e5                	mov    %esp,%ebp
+  801e3b:	53                   	push   %ebx
+  801e3c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801e3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801e44:	83 ec 0c             	sub    $0xc,%esp
+  801e47:	53                   	push   %ebx
+  801e48:	e8 be ff ff ff       	call   801e0b <close>
+	for (i = 0; i < MAXFD; i++)
+  801e4d:	83 c3 01             	add    $0x1,%ebx
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	83 fb 20             	cmp    $0x20,%ebx
+  801e56:	75 ec                	jne    801e44 <close_all+0xc>
+}
+  801e58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5b:	c9                   	leave
+  801e5c:	c3                   	ret
+
+00801e5d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801e5d:	55                   	push   %ebp
+  801e5e:	89 e5                	mov    %esp,%ebp
+  801e60:	57                   	push   %edi
+  801e61:	56                   	push   %esi
+  801e62:	53                   	push   %ebx
+  801e63:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801e66:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e69:	50                   	push   %eax
+  801e6a:	ff 75 08             	push   0x8(%ebp)
+  801e6d:	e8 4f fe ff ff       	call   801cc1 <fd_lookup>
+  801e72:	89 c3                	mov    %eax,%ebx
+  801e74:	83 c4 10             	add    $0x10,%esp
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	78 7f                	js     801efa <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801e7b:	83 ec 0c             	sub    $0xc,%esp
+  801e7e:	ff 75 0c             	push   0xc(%ebp)
+  801e81:	e8 85 ff ff ff       	call   801e0b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e86:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e89:	c1 e6 0c             	shl    $0xc,%esi
+  801e8c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801e92:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e95:	89 3c 24             	mov    %edi,(%esp)
+  801e98:	e8 b7 fd ff ff       	call   801c54 <fd2data>
+  801e9d:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e9f:	89 34 24             	mov    %esi,(%esp)
+  801ea2:	e8 ad fd ff ff       	call   801c54 <fd2data>
+  801ea7:	83 c4 10             	add    $0x10,%esp
+  801eaa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801ead:	89 d8                	mov    %ebx,%eax
+  801eaf:	c1 e8 16             	shr    $0x16,%eax
+  801eb2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801eb9:	a8 01                	test   $0x1,%al
+  801ebb:	74 11                	je     801ece <dup+0x71>
+  801ebd:	89 d8                	mov    %ebx,%eax
+  801ebf:	c1 e8 0c             	shr    $0xc,%eax
+  801ec2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ec9:	f6 c2 01             	test   $0x1,%dl
+  801ecc:	75 36                	jne    801f04 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ece:	89 f8                	mov    %edi,%eax
+  801ed0:	c1 e8 0c             	shr    $0xc,%eax
+  801ed3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801eda:	83 ec 0c             	sub    $0xc,%esp
+  801edd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ee2:	50                   	push   %eax
+  801ee3:	56                   	push   %esi
+  801ee4:	6a 00                	push   $0x0
+  801ee6:	57                   	push   %edi
+  801ee7:	6a 00                	push   $0x0
+  801ee9:	e8 4d f3 ff ff       	call   80123b <sys_page_map>
+  801eee:	89 c3                	mov    %eax,%ebx
+  801ef0:	83 c4 20             	add    $0x20,%esp
+  801ef3:	85 c0                	test   %eax,%eax
+  801ef5:	78 33                	js     801f2a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801ef7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801efa:	89 d8                	mov    %ebx,%eax
+  801efc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eff:	5b                   	pop    %ebx
+  801f00:	5e                   	pop    %esi
+  801f01:	5f                   	pop    %edi
+  801f02:	5d                   	pop    %ebp
+  801f03:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801f04:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801f0b:	83 ec 0c             	sub    $0xc,%esp
+  801f0e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801f13:	50                   	push   %eax
+  801f14:	ff 75 d4             	push   -0x2c(%ebp)
+  801f17:	6a 00                	push   $0x0
+  801f19:	53                   	push   %ebx
+  801f1a:	6a 00                	push   $0x0
+  801f1c:	e8 1a f3 ff ff       	call   80123b <sys_page_map>
+  801f21:	89 c3                	mov    %eax,%ebx
+  801f23:	83 c4 20             	add    $0x20,%esp
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	79 a4                	jns    801ece <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801f2a:	83 ec 08             	sub    $0x8,%esp
+  801f2d:	56                   	push   %esi
+  801f2e:	6a 00                	push   $0x0
+  801f30:	e8 74 f3 ff ff       	call   8012a9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801f35:	83 c4 08             	add    $0x8,%esp
+  801f38:	ff 75 d4             	push   -0x2c(%ebp)
+  801f3b:	6a 00                	push   $0x0
+  801f3d:	e8 67 f3 ff ff       	call   8012a9 <sys_page_unmap>
+	return r;
+  801f42:	83 c4 10             	add    $0x10,%esp
+  801f45:	eb b3                	jmp    801efa <dup+0x9d>
+
+00801f47 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801f47:	55                   	push   %ebp
+  801f48:	89 e5                	mov    %esp,%ebp
+  801f4a:	56                   	push   %esi
+  801f4b:	53                   	push   %ebx
+  801f4c:	83 ec 18             	sub    $0x18,%esp
+  801f4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f52:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f55:	50                   	push   %eax
+  801f56:	53                   	push   %ebx
+  801f57:	e8 65 fd ff ff       	call   801cc1 <fd_lookup>
+  801f5c:	83 c4 10             	add    $0x10,%esp
+  801f5f:	85 c0                	test   %eax,%eax
+  801f61:	78 3c                	js     801f9f <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f63:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f66:	83 ec 08             	sub    $0x8,%esp
+  801f69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f6c:	50                   	push   %eax
+  801f6d:	ff 36                	push   (%esi)
+  801f6f:	e8 9d fd ff ff       	call   801d11 <dev_lookup>
+  801f74:	83 c4 10             	add    $0x10,%esp
+  801f77:	85 c0                	test   %eax,%eax
+  801f79:	78 24                	js     801f9f <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f7b:	8b 46 08             	mov    0x8(%esi),%eax
+  801f7e:	83 e0 03             	and    $0x3,%eax
+  801f81:	83 f8 01             	cmp    $0x1,%eax
+  801f84:	74 20                	je     801fa6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f89:	8b 40 08             	mov    0x8(%eax),%eax
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	74 57                	je     801fe7 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801f90:	83 ec 04             	sub    $0x4,%esp
+  801f93:	ff 75 10             	push   0x10(%ebp)
+  801f96:	ff 75 0c             	push   0xc(%ebp)
+  801f99:	56                   	push   %esi
+  801f9a:	ff d0                	call   *%eax
+  801f9c:	83 c4 10             	add    $0x10,%esp
+}
+  801f9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa2:	5b                   	pop    %ebx
+  801fa3:	5e                   	pop    %esi
+  801fa4:	5d                   	pop    %ebp
+  801fa5:	c3                   	ret
+  801fa6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fa8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801fad:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fb3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801fb8:	76 1c                	jbe    801fd6 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fba:	8b 42 48             	mov    0x48(%edx),%eax
+  801fbd:	83 ec 04             	sub    $0x4,%esp
+  801fc0:	53                   	push   %ebx
+  801fc1:	50                   	push   %eax
+  801fc2:	68 19 35 80 00       	push   $0x803519
+  801fc7:	e8 c2 e6 ff ff       	call   80068e <cprintf>
+		return -E_INVAL;
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fd4:	eb c9                	jmp    801f9f <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801fd6:	c1 e8 10             	shr    $0x10,%eax
+  801fd9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801fdf:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801fe5:	eb d3                	jmp    801fba <read+0x73>
+		return -E_NOT_SUPP;
+  801fe7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fec:	eb b1                	jmp    801f9f <read+0x58>
+
+00801fee <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801fee:	55                   	push   %ebp
+  801fef:	89 e5                	mov    %esp,%ebp
+  801ff1:	57                   	push   %edi
+  801ff2:	56                   	push   %esi
+  801ff3:	53                   	push   %ebx
+  801ff4:	83 ec 0c             	sub    $0xc,%esp
+  801ff7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ffa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801ffd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802002:	eb 02                	jmp    802006 <readn+0x18>
+  802004:	01 c3                	add    %eax,%ebx
+  802006:	39 f3                	cmp    %esi,%ebx
+  802008:	73 21                	jae    80202b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80200a:	83 ec 04             	sub    $0x4,%esp
+  80200d:	89 f0                	mov    %esi,%eax
+  80200f:	29 d8                	sub    %ebx,%eax
+  802011:	50                   	push   %eax
+  802012:	89 d8                	mov    %ebx,%eax
+  802014:	03 45 0c             	add    0xc(%ebp),%eax
+  802017:	50                   	push   %eax
+  802018:	57                   	push   %edi
+  802019:	e8 29 ff ff ff       	call   801f47 <read>
+		if (m < 0)
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	85 c0                	test   %eax,%eax
+  802023:	78 04                	js     802029 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802025:	75 dd                	jne    802004 <readn+0x16>
+  802027:	eb 02                	jmp    80202b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802029:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80202b:	89 d8                	mov    %ebx,%eax
+  80202d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802030:	5b                   	pop    %ebx
+  802031:	5e                   	pop    %esi
+  802032:	5f                   	pop    %edi
+  802033:	5d                   	pop    %ebp
+  802034:	c3                   	ret
+
+00802035 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	56                   	push   %esi
+  802039:	53                   	push   %ebx
+  80203a:	83 ec 18             	sub    $0x18,%esp
+  80203d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802040:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802043:	50                   	push   %eax
+  802044:	53                   	push   %ebx
+  802045:	e8 77 fc ff ff       	call   801cc1 <fd_lookup>
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 37                	js     802088 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802051:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802054:	83 ec 08             	sub    $0x8,%esp
+  802057:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80205a:	50                   	push   %eax
+  80205b:	ff 36                	push   (%esi)
+  80205d:	e8 af fc ff ff       	call   801d11 <dev_lookup>
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 1f                	js     802088 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802069:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80206d:	74 20                	je     80208f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80206f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802072:	8b 40 0c             	mov    0xc(%eax),%eax
+  802075:	85 c0                	test   %eax,%eax
+  802077:	74 57                	je     8020d0 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802079:	83 ec 04             	sub    $0x4,%esp
+  80207c:	ff 75 10             	push   0x10(%ebp)
+  80207f:	ff 75 0c             	push   0xc(%ebp)
+  802082:	56                   	push   %esi
+  802083:	ff d0                	call   *%eax
+  802085:	83 c4 10             	add    $0x10,%esp
+}
+  802088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80208b:	5b                   	pop    %ebx
+  80208c:	5e                   	pop    %esi
+  80208d:	5d                   	pop    %ebp
+  80208e:	c3                   	ret
+  80208f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802091:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802096:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80209c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8020a1:	76 1c                	jbe    8020bf <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020a3:	8b 42 48             	mov    0x48(%edx),%eax
+  8020a6:	83 ec 04             	sub    $0x4,%esp
+  8020a9:	53                   	push   %ebx
+  8020aa:	50                   	push   %eax
+  8020ab:	68 35 35 80 00       	push   $0x803535
+  8020b0:	e8 d9 e5 ff ff       	call   80068e <cprintf>
+		return -E_INVAL;
+  8020b5:	83 c4 10             	add    $0x10,%esp
+  8020b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020bd:	eb c9                	jmp    802088 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8020bf:	c1 e8 10             	shr    $0x10,%eax
+  8020c2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8020c8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8020ce:	eb d3                	jmp    8020a3 <write+0x6e>
+		return -E_NOT_SUPP;
+  8020d0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020d5:	eb b1                	jmp    802088 <write+0x53>
+
+008020d7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8020d7:	55                   	push   %ebp
+  8020d8:	89 e5                	mov    %esp,%ebp
+  8020da:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e0:	50                   	push   %eax
+  8020e1:	ff 75 08             	push   0x8(%ebp)
+  8020e4:	e8 d8 fb ff ff       	call   801cc1 <fd_lookup>
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	85 c0                	test   %eax,%eax
+  8020ee:	78 0e                	js     8020fe <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8020f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+
+00802100 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	56                   	push   %esi
+  802104:	53                   	push   %ebx
+  802105:	83 ec 18             	sub    $0x18,%esp
+  802108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80210b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80210e:	50                   	push   %eax
+  80210f:	53                   	push   %ebx
+  802110:	e8 ac fb ff ff       	call   801cc1 <fd_lookup>
+  802115:	83 c4 10             	add    $0x10,%esp
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	78 34                	js     802150 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80211c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80211f:	83 ec 08             	sub    $0x8,%esp
+  802122:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802125:	50                   	push   %eax
+  802126:	ff 36                	push   (%esi)
+  802128:	e8 e4 fb ff ff       	call   801d11 <dev_lookup>
+  80212d:	83 c4 10             	add    $0x10,%esp
+  802130:	85 c0                	test   %eax,%eax
+  802132:	78 1c                	js     802150 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802134:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802138:	74 1d                	je     802157 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80213a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80213d:	8b 40 18             	mov    0x18(%eax),%eax
+  802140:	85 c0                	test   %eax,%eax
+  802142:	74 54                	je     802198 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802144:	83 ec 08             	sub    $0x8,%esp
+  802147:	ff 75 0c             	push   0xc(%ebp)
+  80214a:	56                   	push   %esi
+  80214b:	ff d0                	call   *%eax
+  80214d:	83 c4 10             	add    $0x10,%esp
+}
+  802150:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802153:	5b                   	pop    %ebx
+  802154:	5e                   	pop    %esi
+  802155:	5d                   	pop    %ebp
+  802156:	c3                   	ret
+  802157:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802159:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80215e:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802164:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802169:	76 1c                	jbe    802187 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  80216b:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80216e:	83 ec 04             	sub    $0x4,%esp
+  802171:	53                   	push   %ebx
+  802172:	50                   	push   %eax
+  802173:	68 f8 34 80 00       	push   $0x8034f8
+  802178:	e8 11 e5 ff ff       	call   80068e <cprintf>
+		return -E_INVAL;
+  80217d:	83 c4 10             	add    $0x10,%esp
+  802180:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802185:	eb c9                	jmp    802150 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802187:	c1 e8 10             	shr    $0x10,%eax
+  80218a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802190:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802196:	eb d3                	jmp    80216b <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802198:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80219d:	eb b1                	jmp    802150 <ftruncate+0x50>
+
+0080219f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80219f:	55                   	push   %ebp
+  8021a0:	89 e5                	mov    %esp,%ebp
+  8021a2:	56                   	push   %esi
+  8021a3:	53                   	push   %ebx
+  8021a4:	83 ec 18             	sub    $0x18,%esp
+  8021a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021ad:	50                   	push   %eax
+  8021ae:	ff 75 08             	push   0x8(%ebp)
+  8021b1:	e8 0b fb ff ff       	call   801cc1 <fd_lookup>
+  8021b6:	83 c4 10             	add    $0x10,%esp
+  8021b9:	85 c0                	test   %eax,%eax
+  8021bb:	78 49                	js     802206 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021bd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021c0:	83 ec 08             	sub    $0x8,%esp
+  8021c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c6:	50                   	push   %eax
+  8021c7:	ff 36                	push   (%esi)
+  8021c9:	e8 43 fb ff ff       	call   801d11 <dev_lookup>
+  8021ce:	83 c4 10             	add    $0x10,%esp
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	78 31                	js     802206 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8021d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021d8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8021dc:	74 2f                	je     80220d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8021de:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8021e1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8021e8:	00 00 00 
+	stat->st_isdir = 0;
+  8021eb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021f2:	00 00 00 
+	stat->st_dev = dev;
+  8021f5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8021fb:	83 ec 08             	sub    $0x8,%esp
+  8021fe:	53                   	push   %ebx
+  8021ff:	56                   	push   %esi
+  802200:	ff 50 14             	call   *0x14(%eax)
+  802203:	83 c4 10             	add    $0x10,%esp
+}
+  802206:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802209:	5b                   	pop    %ebx
+  80220a:	5e                   	pop    %esi
+  80220b:	5d                   	pop    %ebp
+  80220c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80220d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802212:	eb f2                	jmp    802206 <fstat+0x67>
+
+00802214 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	56                   	push   %esi
+  802218:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802219:	83 ec 08             	sub    $0x8,%esp
+  80221c:	6a 00                	push   $0x0
+  80221e:	ff 75 08             	push   0x8(%ebp)
+  802221:	e8 e4 01 00 00       	call   80240a <open>
+  802226:	89 c3                	mov    %eax,%ebx
+  802228:	83 c4 10             	add    $0x10,%esp
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	78 1b                	js     80224a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80222f:	83 ec 08             	sub    $0x8,%esp
+  802232:	ff 75 0c             	push   0xc(%ebp)
+  802235:	50                   	push   %eax
+  802236:	e8 64 ff ff ff       	call   80219f <fstat>
+  80223b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80223d:	89 1c 24             	mov    %ebx,(%esp)
+  802240:	e8 c6 fb ff ff       	call   801e0b <close>
+	return r;
+  802245:	83 c4 10             	add    $0x10,%esp
+  802248:	89 f3                	mov    %esi,%ebx
+}
+  80224a:	89 d8                	mov    %ebx,%eax
+  80224c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80224f:	5b                   	pop    %ebx
+  802250:	5e                   	pop    %esi
+  802251:	5d                   	pop    %ebp
+  802252:	c3                   	ret
+
+00802253 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	56                   	push   %esi
+  802257:	53                   	push   %ebx
+  802258:	89 c6                	mov    %eax,%esi
+  80225a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80225c:	83 3d 10 50 80 00 00 	cmpl   $0x0,0x805010
+  802263:	74 27                	je     80228c <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802265:	6a 07                	push   $0x7
+  802267:	68 00 60 80 00       	push   $0x806000
+  80226c:	56                   	push   %esi
+  80226d:	ff 35 10 50 80 00    	push   0x805010
+  802273:	e8 b2 0c 00 00       	call   802f2a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802278:	83 c4 0c             	add    $0xc,%esp
+  80227b:	6a 00                	push   $0x0
+  80227d:	53                   	push   %ebx
+  80227e:	6a 00                	push   $0x0
+  802280:	e8 8d 0c 00 00       	call   802f12 <ipc_recv>
+}
+  802285:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802288:	5b                   	pop    %ebx
+  802289:	5e                   	pop    %esi
+  80228a:	5d                   	pop    %ebp
+  80228b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80228c:	83 ec 0c             	sub    $0xc,%esp
+  80228f:	6a 01                	push   $0x1
+  802291:	e8 e8 0c 00 00       	call   802f7e <ipc_find_env>
+  802296:	a3 10 50 80 00       	mov    %eax,0x805010
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	eb c5                	jmp    802265 <fsipc+0x12>
+
+008022a0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8022a0:	55                   	push   %ebp
+  8022a1:	89 e5                	mov    %esp,%ebp
+  8022a3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022ac:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8022b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022b4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8022b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022be:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022c3:	e8 8b ff ff ff       	call   802253 <fsipc>
+}
+  8022c8:	c9                   	leave
+  8022c9:	c3                   	ret
+
+008022ca <devfile_flush>:
+{
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022d6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8022db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022e5:	e8 69 ff ff ff       	call   802253 <fsipc>
+}
+  8022ea:	c9                   	leave
+  8022eb:	c3                   	ret
+
+008022ec <devfile_stat>:
+{
+  8022ec:	55                   	push   %ebp
+  8022ed:	89 e5                	mov    %esp,%ebp
+  8022ef:	53                   	push   %ebx
+  8022f0:	83 ec 04             	sub    $0x4,%esp
+  8022f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022fc:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802301:	ba 00 00 00 00       	mov    $0x0,%edx
+  802306:	b8 05 00 00 00       	mov    $0x5,%eax
+  80230b:	e8 43 ff ff ff       	call   802253 <fsipc>
+  802310:	85 c0                	test   %eax,%eax
+  802312:	78 2c                	js     802340 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802314:	83 ec 08             	sub    $0x8,%esp
+  802317:	68 00 60 80 00       	push   $0x806000
+  80231c:	53                   	push   %ebx
+  80231d:	e8 b4 e9 ff ff       	call   800cd6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802322:	a1 80 60 80 00       	mov    0x806080,%eax
+  802327:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80232d:	a1 84 60 80 00       	mov    0x806084,%eax
+  802332:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802338:	83 c4 10             	add    $0x10,%esp
+  80233b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802343:	c9                   	leave
+  802344:	c3                   	ret
+
+00802345 <devfile_write>:
+{
+  802345:	55                   	push   %ebp
+  802346:	89 e5                	mov    %esp,%ebp
+  802348:	83 ec 0c             	sub    $0xc,%esp
+  80234b:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80234e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802351:	8b 52 0c             	mov    0xc(%edx),%edx
+  802354:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  80235a:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80235f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802364:	39 d0                	cmp    %edx,%eax
+  802366:	0f 47 c2             	cmova  %edx,%eax
+  802369:	50                   	push   %eax
+  80236a:	ff 75 0c             	push   0xc(%ebp)
+  80236d:	68 08 60 80 00       	push   $0x806008
+  802372:	e8 e5 ea ff ff       	call   800e5c <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802377:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802381:	e8 cd fe ff ff       	call   802253 <fsipc>
+}
+  802386:	c9                   	leave
+  802387:	c3                   	ret
+
+00802388 <devfile_read>:
+{
+  802388:	55                   	push   %ebp
+  802389:	89 e5                	mov    %esp,%ebp
+  80238b:	56                   	push   %esi
+  80238c:	53                   	push   %ebx
+  80238d:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802390:	8b 45 08             	mov    0x8(%ebp),%eax
+  802393:	8b 40 0c             	mov    0xc(%eax),%eax
+  802396:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80239b:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8023a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023ab:	e8 a3 fe ff ff       	call   802253 <fsipc>
+  8023b0:	89 c3                	mov    %eax,%ebx
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 1f                	js     8023d5 <devfile_read+0x4d>
+	assert(r <= n);
+  8023b6:	39 c6                	cmp    %eax,%esi
+  8023b8:	72 24                	jb     8023de <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8023ba:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8023bf:	7f 33                	jg     8023f4 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8023c1:	83 ec 04             	sub    $0x4,%esp
+  8023c4:	50                   	push   %eax
+  8023c5:	68 00 60 80 00       	push   $0x806000
+  8023ca:	ff 75 0c             	push   0xc(%ebp)
+  8023cd:	e8 8a ea ff ff       	call   800e5c <memmove>
+	return r;
+  8023d2:	83 c4 10             	add    $0x10,%esp
+}
+  8023d5:	89 d8                	mov    %ebx,%eax
+  8023d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023da:	5b                   	pop    %ebx
+  8023db:	5e                   	pop    %esi
+  8023dc:	5d                   	pop    %ebp
+  8023dd:	c3                   	ret
+	assert(r <= n);
+  8023de:	68 68 35 80 00       	push   $0x803568
+  8023e3:	68 6f 35 80 00       	push   $0x80356f
+  8023e8:	6a 76                	push   $0x76
+  8023ea:	68 84 35 80 00       	push   $0x803584
+  8023ef:	e8 bf e1 ff ff       	call   8005b3 <_panic>
+	assert(r <= PGSIZE);
+  8023f4:	68 8f 35 80 00       	push   $0x80358f
+  8023f9:	68 6f 35 80 00       	push   $0x80356f
+  8023fe:	6a 77                	push   $0x77
+  802400:	68 84 35 80 00       	push   $0x803584
+  802405:	e8 a9 e1 ff ff       	call   8005b3 <_panic>
+
+0080240a <open>:
+{
+  80240a:	55                   	push   %ebp
+  80240b:	89 e5                	mov    %esp,%ebp
+  80240d:	56                   	push   %esi
+  80240e:	53                   	push   %ebx
+  80240f:	83 ec 1c             	sub    $0x1c,%esp
+  802412:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802415:	56                   	push   %esi
+  802416:	e8 80 e8 ff ff       	call   800c9b <strlen>
+  80241b:	83 c4 10             	add    $0x10,%esp
+  80241e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802423:	7f 6c                	jg     802491 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802425:	83 ec 0c             	sub    $0xc,%esp
+  802428:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80242b:	50                   	push   %eax
+  80242c:	e8 3a f8 ff ff       	call   801c6b <fd_alloc>
+  802431:	89 c3                	mov    %eax,%ebx
+  802433:	83 c4 10             	add    $0x10,%esp
+  802436:	85 c0                	test   %eax,%eax
+  802438:	78 3c                	js     802476 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80243a:	83 ec 08             	sub    $0x8,%esp
+  80243d:	56                   	push   %esi
+  80243e:	68 00 60 80 00       	push   $0x806000
+  802443:	e8 8e e8 ff ff       	call   800cd6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802448:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80244b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802450:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802453:	b8 01 00 00 00       	mov    $0x1,%eax
+  802458:	e8 f6 fd ff ff       	call   802253 <fsipc>
+  80245d:	89 c3                	mov    %eax,%ebx
+  80245f:	83 c4 10             	add    $0x10,%esp
+  802462:	85 c0                	test   %eax,%eax
+  802464:	78 19                	js     80247f <open+0x75>
+	return fd2num(fd);
+  802466:	83 ec 0c             	sub    $0xc,%esp
+  802469:	ff 75 f4             	push   -0xc(%ebp)
+  80246c:	e8 d3 f7 ff ff       	call   801c44 <fd2num>
+  802471:	89 c3                	mov    %eax,%ebx
+  802473:	83 c4 10             	add    $0x10,%esp
+}
+  802476:	89 d8                	mov    %ebx,%eax
+  802478:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80247b:	5b                   	pop    %ebx
+  80247c:	5e                   	pop    %esi
+  80247d:	5d                   	pop    %ebp
+  80247e:	c3                   	ret
+		fd_close(fd, 0);
+  80247f:	83 ec 08             	sub    $0x8,%esp
+  802482:	6a 00                	push   $0x0
+  802484:	ff 75 f4             	push   -0xc(%ebp)
+  802487:	e8 f8 f8 ff ff       	call   801d84 <fd_close>
+		return r;
+  80248c:	83 c4 10             	add    $0x10,%esp
+  80248f:	eb e5                	jmp    802476 <open+0x6c>
+		return -E_BAD_PATH;
+  802491:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802496:	eb de                	jmp    802476 <open+0x6c>
+
+00802498 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802498:	55                   	push   %ebp
+  802499:	89 e5                	mov    %esp,%ebp
+  80249b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80249e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024a8:	e8 a6 fd ff ff       	call   802253 <fsipc>
+}
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+
+008024af <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024af:	55                   	push   %ebp
+  8024b0:	89 e5                	mov    %esp,%ebp
+  8024b2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8024b5:	68 9b 35 80 00       	push   $0x80359b
+  8024ba:	ff 75 0c             	push   0xc(%ebp)
+  8024bd:	e8 14 e8 ff ff       	call   800cd6 <strcpy>
+	return 0;
+}
+  8024c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c7:	c9                   	leave
+  8024c8:	c3                   	ret
+
+008024c9 <devsock_close>:
+{
+  8024c9:	55                   	push   %ebp
+  8024ca:	89 e5                	mov    %esp,%ebp
+  8024cc:	53                   	push   %ebx
+  8024cd:	83 ec 10             	sub    $0x10,%esp
+  8024d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8024d3:	53                   	push   %ebx
+  8024d4:	e8 e4 0a 00 00       	call   802fbd <pageref>
+  8024d9:	89 c2                	mov    %eax,%edx
+  8024db:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8024de:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8024e3:	83 fa 01             	cmp    $0x1,%edx
+  8024e6:	74 05                	je     8024ed <devsock_close+0x24>
+}
+  8024e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024eb:	c9                   	leave
+  8024ec:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8024ed:	83 ec 0c             	sub    $0xc,%esp
+  8024f0:	ff 73 0c             	push   0xc(%ebx)
+  8024f3:	e8 b7 02 00 00       	call   8027af <nsipc_close>
+  8024f8:	83 c4 10             	add    $0x10,%esp
+  8024fb:	eb eb                	jmp    8024e8 <devsock_close+0x1f>
+
+008024fd <devsock_write>:
+{
+  8024fd:	55                   	push   %ebp
+  8024fe:	89 e5                	mov    %esp,%ebp
+  802500:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802503:	6a 00                	push   $0x0
+  802505:	ff 75 10             	push   0x10(%ebp)
+  802508:	ff 75 0c             	push   0xc(%ebp)
+  80250b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250e:	ff 70 0c             	push   0xc(%eax)
+  802511:	e8 79 03 00 00       	call   80288f <nsipc_send>
+}
+  802516:	c9                   	leave
+  802517:	c3                   	ret
+
+00802518 <devsock_read>:
+{
+  802518:	55                   	push   %ebp
+  802519:	89 e5                	mov    %esp,%ebp
+  80251b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80251e:	6a 00                	push   $0x0
+  802520:	ff 75 10             	push   0x10(%ebp)
+  802523:	ff 75 0c             	push   0xc(%ebp)
+  802526:	8b 45 08             	mov    0x8(%ebp),%eax
+  802529:	ff 70 0c             	push   0xc(%eax)
+  80252c:	e8 ef 02 00 00       	call   802820 <nsipc_recv>
+}
+  802531:	c9                   	leave
+  802532:	c3                   	ret
+
+00802533 <fd2sockid>:
+{
+  802533:	55                   	push   %ebp
+  802534:	89 e5                	mov    %esp,%ebp
+  802536:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802539:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80253c:	52                   	push   %edx
+  80253d:	50                   	push   %eax
+  80253e:	e8 7e f7 ff ff       	call   801cc1 <fd_lookup>
+  802543:	83 c4 10             	add    $0x10,%esp
+  802546:	85 c0                	test   %eax,%eax
+  802548:	78 10                	js     80255a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80254a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80254d:	8b 0d 30 40 80 00    	mov    0x804030,%ecx
+  802553:	39 08                	cmp    %ecx,(%eax)
+  802555:	75 05                	jne    80255c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802557:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80255a:	c9                   	leave
+  80255b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80255c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802561:	eb f7                	jmp    80255a <fd2sockid+0x27>
+
+00802563 <alloc_sockfd>:
+{
+  802563:	55                   	push   %ebp
+  802564:	89 e5                	mov    %esp,%ebp
+  802566:	56                   	push   %esi
+  802567:	53                   	push   %ebx
+  802568:	83 ec 1c             	sub    $0x1c,%esp
+  80256b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80256d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802570:	50                   	push   %eax
+  802571:	e8 f5 f6 ff ff       	call   801c6b <fd_alloc>
+  802576:	89 c3                	mov    %eax,%ebx
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	85 c0                	test   %eax,%eax
+  80257d:	78 43                	js     8025c2 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80257f:	83 ec 04             	sub    $0x4,%esp
+  802582:	68 07 04 00 00       	push   $0x407
+  802587:	ff 75 f4             	push   -0xc(%ebp)
+  80258a:	6a 00                	push   $0x0
+  80258c:	e8 3d ec ff ff       	call   8011ce <sys_page_alloc>
+  802591:	89 c3                	mov    %eax,%ebx
+  802593:	83 c4 10             	add    $0x10,%esp
+  802596:	85 c0                	test   %eax,%eax
+  802598:	78 28                	js     8025c2 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80259a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80259d:	8b 15 30 40 80 00    	mov    0x804030,%edx
+  8025a3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8025a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025a8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8025af:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8025b2:	83 ec 0c             	sub    $0xc,%esp
+  8025b5:	50                   	push   %eax
+  8025b6:	e8 89 f6 ff ff       	call   801c44 <fd2num>
+  8025bb:	89 c3                	mov    %eax,%ebx
+  8025bd:	83 c4 10             	add    $0x10,%esp
+  8025c0:	eb 0c                	jmp    8025ce <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8025c2:	83 ec 0c             	sub    $0xc,%esp
+  8025c5:	56                   	push   %esi
+  8025c6:	e8 e4 01 00 00       	call   8027af <nsipc_close>
+		return r;
+  8025cb:	83 c4 10             	add    $0x10,%esp
+}
+  8025ce:	89 d8                	mov    %ebx,%eax
+  8025d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d3:	5b                   	pop    %ebx
+  8025d4:	5e                   	pop    %esi
+  8025d5:	5d                   	pop    %ebp
+  8025d6:	c3                   	ret
+
+008025d7 <accept>:
+{
+  8025d7:	55                   	push   %ebp
+  8025d8:	89 e5                	mov    %esp,%ebp
+  8025da:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e0:	e8 4e ff ff ff       	call   802533 <fd2sockid>
+  8025e5:	85 c0                	test   %eax,%eax
+  8025e7:	78 1b                	js     802604 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8025e9:	83 ec 04             	sub    $0x4,%esp
+  8025ec:	ff 75 10             	push   0x10(%ebp)
+  8025ef:	ff 75 0c             	push   0xc(%ebp)
+  8025f2:	50                   	push   %eax
+  8025f3:	e8 0e 01 00 00       	call   802706 <nsipc_accept>
+  8025f8:	83 c4 10             	add    $0x10,%esp
+  8025fb:	85 c0                	test   %eax,%eax
+  8025fd:	78 05                	js     802604 <accept+0x2d>
+	return alloc_sockfd(r);
+  8025ff:	e8 5f ff ff ff       	call   802563 <alloc_sockfd>
+}
+  802604:	c9                   	leave
+  802605:	c3                   	ret
+
+00802606 <bind>:
+{
+  802606:	55                   	push   %ebp
+  802607:	89 e5                	mov    %esp,%ebp
+  802609:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80260c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80260f:	e8 1f ff ff ff       	call   802533 <fd2sockid>
+  802614:	85 c0                	test   %eax,%eax
+  802616:	78 12                	js     80262a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802618:	83 ec 04             	sub    $0x4,%esp
+  80261b:	ff 75 10             	push   0x10(%ebp)
+  80261e:	ff 75 0c             	push   0xc(%ebp)
+  802621:	50                   	push   %eax
+  802622:	e8 31 01 00 00       	call   802758 <nsipc_bind>
+  802627:	83 c4 10             	add    $0x10,%esp
+}
+  80262a:	c9                   	leave
+  80262b:	c3                   	ret
+
+0080262c <shutdown>:
+{
+  80262c:	55                   	push   %ebp
+  80262d:	89 e5                	mov    %esp,%ebp
+  80262f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802632:	8b 45 08             	mov    0x8(%ebp),%eax
+  802635:	e8 f9 fe ff ff       	call   802533 <fd2sockid>
+  80263a:	85 c0                	test   %eax,%eax
+  80263c:	78 0f                	js     80264d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80263e:	83 ec 08             	sub    $0x8,%esp
+  802641:	ff 75 0c             	push   0xc(%ebp)
+  802644:	50                   	push   %eax
+  802645:	e8 43 01 00 00       	call   80278d <nsipc_shutdown>
+  80264a:	83 c4 10             	add    $0x10,%esp
+}
+  80264d:	c9                   	leave
+  80264e:	c3                   	ret
+
+0080264f <connect>:
+{
+  80264f:	55                   	push   %ebp
+  802650:	89 e5                	mov    %esp,%ebp
+  802652:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802655:	8b 45 08             	mov    0x8(%ebp),%eax
+  802658:	e8 d6 fe ff ff       	call   802533 <fd2sockid>
+  80265d:	85 c0                	test   %eax,%eax
+  80265f:	78 12                	js     802673 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802661:	83 ec 04             	sub    $0x4,%esp
+  802664:	ff 75 10             	push   0x10(%ebp)
+  802667:	ff 75 0c             	push   0xc(%ebp)
+  80266a:	50                   	push   %eax
+  80266b:	e8 59 01 00 00       	call   8027c9 <nsipc_connect>
+  802670:	83 c4 10             	add    $0x10,%esp
+}
+  802673:	c9                   	leave
+  802674:	c3                   	ret
+
+00802675 <listen>:
+{
+  802675:	55                   	push   %ebp
+  802676:	89 e5                	mov    %esp,%ebp
+  802678:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80267b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80267e:	e8 b0 fe ff ff       	call   802533 <fd2sockid>
+  802683:	85 c0                	test   %eax,%eax
+  802685:	78 0f                	js     802696 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802687:	83 ec 08             	sub    $0x8,%esp
+  80268a:	ff 75 0c             	push   0xc(%ebp)
+  80268d:	50                   	push   %eax
+  80268e:	e8 6b 01 00 00       	call   8027fe <nsipc_listen>
+  802693:	83 c4 10             	add    $0x10,%esp
+}
+  802696:	c9                   	leave
+  802697:	c3                   	ret
+
+00802698 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802698:	55                   	push   %ebp
+  802699:	89 e5                	mov    %esp,%ebp
+  80269b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80269e:	ff 75 10             	push   0x10(%ebp)
+  8026a1:	ff 75 0c             	push   0xc(%ebp)
+  8026a4:	ff 75 08             	push   0x8(%ebp)
+  8026a7:	e8 41 02 00 00       	call   8028ed <nsipc_socket>
+  8026ac:	83 c4 10             	add    $0x10,%esp
+  8026af:	85 c0                	test   %eax,%eax
+  8026b1:	78 05                	js     8026b8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8026b3:	e8 ab fe ff ff       	call   802563 <alloc_sockfd>
+}
+  8026b8:	c9                   	leave
+  8026b9:	c3                   	ret
+
+008026ba <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8026ba:	55                   	push   %ebp
+  8026bb:	89 e5                	mov    %esp,%ebp
+  8026bd:	53                   	push   %ebx
+  8026be:	83 ec 04             	sub    $0x4,%esp
+  8026c1:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8026c3:	83 3d 14 50 80 00 00 	cmpl   $0x0,0x805014
+  8026ca:	74 26                	je     8026f2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8026cc:	6a 07                	push   $0x7
+  8026ce:	68 00 70 80 00       	push   $0x807000
+  8026d3:	53                   	push   %ebx
+  8026d4:	ff 35 14 50 80 00    	push   0x805014
+  8026da:	e8 4b 08 00 00       	call   802f2a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8026df:	83 c4 0c             	add    $0xc,%esp
+  8026e2:	6a 00                	push   $0x0
+  8026e4:	6a 00                	push   $0x0
+  8026e6:	6a 00                	push   $0x0
+  8026e8:	e8 25 08 00 00       	call   802f12 <ipc_recv>
+}
+  8026ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026f0:	c9                   	leave
+  8026f1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8026f2:	83 ec 0c             	sub    $0xc,%esp
+  8026f5:	6a 02                	push   $0x2
+  8026f7:	e8 82 08 00 00       	call   802f7e <ipc_find_env>
+  8026fc:	a3 14 50 80 00       	mov    %eax,0x805014
+  802701:	83 c4 10             	add    $0x10,%esp
+  802704:	eb c6                	jmp    8026cc <nsipc+0x12>
+
+00802706 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802706:	55                   	push   %ebp
+  802707:	89 e5                	mov    %esp,%ebp
+  802709:	56                   	push   %esi
+  80270a:	53                   	push   %ebx
+  80270b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80270e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802711:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802716:	8b 06                	mov    (%esi),%eax
+  802718:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80271d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802722:	e8 93 ff ff ff       	call   8026ba <nsipc>
+  802727:	89 c3                	mov    %eax,%ebx
+  802729:	85 c0                	test   %eax,%eax
+  80272b:	79 09                	jns    802736 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80272d:	89 d8                	mov    %ebx,%eax
+  80272f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802732:	5b                   	pop    %ebx
+  802733:	5e                   	pop    %esi
+  802734:	5d                   	pop    %ebp
+  802735:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802736:	83 ec 04             	sub    $0x4,%esp
+  802739:	ff 35 10 70 80 00    	push   0x807010
+  80273f:	68 00 70 80 00       	push   $0x807000
+  802744:	ff 75 0c             	push   0xc(%ebp)
+  802747:	e8 10 e7 ff ff       	call   800e5c <memmove>
+		*addrlen = ret->ret_addrlen;
+  80274c:	a1 10 70 80 00       	mov    0x807010,%eax
+  802751:	89 06                	mov    %eax,(%esi)
+  802753:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802756:	eb d5                	jmp    80272d <nsipc_accept+0x27>
+
+00802758 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802758:	55                   	push   %ebp
+  802759:	89 e5                	mov    %esp,%ebp
+  80275b:	53                   	push   %ebx
+  80275c:	83 ec 08             	sub    $0x8,%esp
+  80275f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802762:	8b 45 08             	mov    0x8(%ebp),%eax
+  802765:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80276a:	53                   	push   %ebx
+  80276b:	ff 75 0c             	push   0xc(%ebp)
+  80276e:	68 04 70 80 00       	push   $0x807004
+  802773:	e8 e4 e6 ff ff       	call   800e5c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802778:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80277e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802783:	e8 32 ff ff ff       	call   8026ba <nsipc>
+}
+  802788:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80278b:	c9                   	leave
+  80278c:	c3                   	ret
+
+0080278d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80278d:	55                   	push   %ebp
+  80278e:	89 e5                	mov    %esp,%ebp
+  802790:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802793:	8b 45 08             	mov    0x8(%ebp),%eax
+  802796:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80279b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80279e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8027a3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8027a8:	e8 0d ff ff ff       	call   8026ba <nsipc>
+}
+  8027ad:	c9                   	leave
+  8027ae:	c3                   	ret
+
+008027af <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8027af:	55                   	push   %ebp
+  8027b0:	89 e5                	mov    %esp,%ebp
+  8027b2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8027b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027b8:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8027bd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027c2:	e8 f3 fe ff ff       	call   8026ba <nsipc>
+}
+  8027c7:	c9                   	leave
+  8027c8:	c3                   	ret
+
+008027c9 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8027c9:	55                   	push   %ebp
+  8027ca:	89 e5                	mov    %esp,%ebp
+  8027cc:	53                   	push   %ebx
+  8027cd:	83 ec 08             	sub    $0x8,%esp
+  8027d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8027d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d6:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8027db:	53                   	push   %ebx
+  8027dc:	ff 75 0c             	push   0xc(%ebp)
+  8027df:	68 04 70 80 00       	push   $0x807004
+  8027e4:	e8 73 e6 ff ff       	call   800e5c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8027e9:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8027ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027f4:	e8 c1 fe ff ff       	call   8026ba <nsipc>
+}
+  8027f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027fc:	c9                   	leave
+  8027fd:	c3                   	ret
+
+008027fe <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8027fe:	55                   	push   %ebp
+  8027ff:	89 e5                	mov    %esp,%ebp
+  802801:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802804:	8b 45 08             	mov    0x8(%ebp),%eax
+  802807:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80280c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80280f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802814:	b8 06 00 00 00       	mov    $0x6,%eax
+  802819:	e8 9c fe ff ff       	call   8026ba <nsipc>
+}
+  80281e:	c9                   	leave
+  80281f:	c3                   	ret
+
+00802820 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802820:	55                   	push   %ebp
+  802821:	89 e5                	mov    %esp,%ebp
+  802823:	56                   	push   %esi
+  802824:	53                   	push   %ebx
+  802825:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802828:	8b 45 08             	mov    0x8(%ebp),%eax
+  80282b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802830:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802836:	8b 45 14             	mov    0x14(%ebp),%eax
+  802839:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80283e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802843:	e8 72 fe ff ff       	call   8026ba <nsipc>
+  802848:	89 c3                	mov    %eax,%ebx
+  80284a:	85 c0                	test   %eax,%eax
+  80284c:	78 22                	js     802870 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80284e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802853:	39 c6                	cmp    %eax,%esi
+  802855:	0f 4e c6             	cmovle %esi,%eax
+  802858:	39 c3                	cmp    %eax,%ebx
+  80285a:	7f 1d                	jg     802879 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80285c:	83 ec 04             	sub    $0x4,%esp
+  80285f:	53                   	push   %ebx
+  802860:	68 00 70 80 00       	push   $0x807000
+  802865:	ff 75 0c             	push   0xc(%ebp)
+  802868:	e8 ef e5 ff ff       	call   800e5c <memmove>
+  80286d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802870:	89 d8                	mov    %ebx,%eax
+  802872:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802875:	5b                   	pop    %ebx
+  802876:	5e                   	pop    %esi
+  802877:	5d                   	pop    %ebp
+  802878:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802879:	68 a7 35 80 00       	push   $0x8035a7
+  80287e:	68 6f 35 80 00       	push   $0x80356f
+  802883:	6a 62                	push   $0x62
+  802885:	68 bc 35 80 00       	push   $0x8035bc
+  80288a:	e8 24 dd ff ff       	call   8005b3 <_panic>
+
+0080288f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80288f:	55                   	push   %ebp
+  802890:	89 e5                	mov    %esp,%ebp
+  802892:	53                   	push   %ebx
+  802893:	83 ec 04             	sub    $0x4,%esp
+  802896:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802899:	8b 45 08             	mov    0x8(%ebp),%eax
+  80289c:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8028a1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8028a7:	7f 2e                	jg     8028d7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8028a9:	83 ec 04             	sub    $0x4,%esp
+  8028ac:	53                   	push   %ebx
+  8028ad:	ff 75 0c             	push   0xc(%ebp)
+  8028b0:	68 0c 70 80 00       	push   $0x80700c
+  8028b5:	e8 a2 e5 ff ff       	call   800e5c <memmove>
+	nsipcbuf.send.req_size = size;
+  8028ba:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8028c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028c3:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8028c8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8028cd:	e8 e8 fd ff ff       	call   8026ba <nsipc>
+}
+  8028d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d5:	c9                   	leave
+  8028d6:	c3                   	ret
+	assert(size < 1600);
+  8028d7:	68 c8 35 80 00       	push   $0x8035c8
+  8028dc:	68 6f 35 80 00       	push   $0x80356f
+  8028e1:	6a 6d                	push   $0x6d
+  8028e3:	68 bc 35 80 00       	push   $0x8035bc
+  8028e8:	e8 c6 dc ff ff       	call   8005b3 <_panic>
+
+008028ed <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8028ed:	55                   	push   %ebp
+  8028ee:	89 e5                	mov    %esp,%ebp
+  8028f0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8028f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8028fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028fe:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802903:	8b 45 10             	mov    0x10(%ebp),%eax
+  802906:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80290b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802910:	e8 a5 fd ff ff       	call   8026ba <nsipc>
+}
+  802915:	c9                   	leave
+  802916:	c3                   	ret
+
+00802917 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802917:	55                   	push   %ebp
+  802918:	89 e5                	mov    %esp,%ebp
+  80291a:	56                   	push   %esi
+  80291b:	53                   	push   %ebx
+  80291c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80291f:	83 ec 0c             	sub    $0xc,%esp
+  802922:	ff 75 08             	push   0x8(%ebp)
+  802925:	e8 2a f3 ff ff       	call   801c54 <fd2data>
+  80292a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80292c:	83 c4 08             	add    $0x8,%esp
+  80292f:	68 d4 35 80 00       	push   $0x8035d4
+  802934:	53                   	push   %ebx
+  802935:	e8 9c e3 ff ff       	call   800cd6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80293a:	8b 46 04             	mov    0x4(%esi),%eax
+  80293d:	2b 06                	sub    (%esi),%eax
+  80293f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802945:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80294c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80294f:	c7 83 88 00 00 00 4c 	movl   $0x80404c,0x88(%ebx)
+  802956:	40 80 00 
+	return 0;
+}
+  802959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802961:	5b                   	pop    %ebx
+  802962:	5e                   	pop    %esi
+  802963:	5d                   	pop    %ebp
+  802964:	c3                   	ret
+
+00802965 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802965:	55                   	push   %ebp
+  802966:	89 e5                	mov    %esp,%ebp
+  802968:	53                   	push   %ebx
+  802969:	83 ec 0c             	sub    $0xc,%esp
+  80296c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80296f:	53                   	push   %ebx
+  802970:	6a 00                	push   $0x0
+  802972:	e8 32 e9 ff ff       	call   8012a9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802977:	89 1c 24             	mov    %ebx,(%esp)
+  80297a:	e8 d5 f2 ff ff       	call   801c54 <fd2data>
+  80297f:	83 c4 08             	add    $0x8,%esp
+  802982:	50                   	push   %eax
+  802983:	6a 00                	push   $0x0
+  802985:	e8 1f e9 ff ff       	call   8012a9 <sys_page_unmap>
+}
+  80298a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298d:	c9                   	leave
+  80298e:	c3                   	ret
+
+0080298f <_pipeisclosed>:
+{
+  80298f:	55                   	push   %ebp
+  802990:	89 e5                	mov    %esp,%ebp
+  802992:	57                   	push   %edi
+  802993:	56                   	push   %esi
+  802994:	53                   	push   %ebx
+  802995:	83 ec 1c             	sub    $0x1c,%esp
+  802998:	89 c7                	mov    %eax,%edi
+  80299a:	89 d6                	mov    %edx,%esi
+  80299c:	eb 3c                	jmp    8029da <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  80299e:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8029a1:	83 ec 0c             	sub    $0xc,%esp
+  8029a4:	57                   	push   %edi
+  8029a5:	e8 13 06 00 00       	call   802fbd <pageref>
+  8029aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8029ad:	89 34 24             	mov    %esi,(%esp)
+  8029b0:	e8 08 06 00 00       	call   802fbd <pageref>
+  8029b5:	89 c2                	mov    %eax,%edx
+  8029b7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029b9:	05 00 00 00 20       	add    $0x20000000,%eax
+  8029be:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8029c1:	8b 0d 18 50 80 00    	mov    0x805018,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029c7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029cc:	76 31                	jbe    8029ff <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8029ce:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8029d1:	39 c3                	cmp    %eax,%ebx
+  8029d3:	74 76                	je     802a4b <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8029d5:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8029d8:	74 36                	je     802a10 <_pipeisclosed+0x81>
+  8029da:	89 e0                	mov    %esp,%eax
+  8029dc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029e1:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029e7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029ec:	77 b0                	ja     80299e <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8029ee:	c1 e8 10             	shr    $0x10,%eax
+  8029f1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8029f7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8029fd:	eb 9f                	jmp    80299e <_pipeisclosed+0xf>
+  8029ff:	c1 e8 10             	shr    $0x10,%eax
+  802a02:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a08:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802a0e:	eb be                	jmp    8029ce <_pipeisclosed+0x3f>
+  802a10:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a12:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a17:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a1d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a22:	76 16                	jbe    802a3a <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802a24:	8b 42 58             	mov    0x58(%edx),%eax
+  802a27:	6a 01                	push   $0x1
+  802a29:	50                   	push   %eax
+  802a2a:	53                   	push   %ebx
+  802a2b:	68 db 35 80 00       	push   $0x8035db
+  802a30:	e8 59 dc ff ff       	call   80068e <cprintf>
+  802a35:	83 c4 10             	add    $0x10,%esp
+  802a38:	eb a0                	jmp    8029da <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a3a:	c1 e8 10             	shr    $0x10,%eax
+  802a3d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a43:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a49:	eb d9                	jmp    802a24 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802a4b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802a4e:	0f 94 c0             	sete   %al
+  802a51:	0f b6 c0             	movzbl %al,%eax
+}
+  802a54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a57:	5b                   	pop    %ebx
+  802a58:	5e                   	pop    %esi
+  802a59:	5f                   	pop    %edi
+  802a5a:	5d                   	pop    %ebp
+  802a5b:	c3                   	ret
+
+00802a5c <devpipe_write>:
+{
+  802a5c:	55                   	push   %ebp
+  802a5d:	89 e5                	mov    %esp,%ebp
+  802a5f:	57                   	push   %edi
+  802a60:	56                   	push   %esi
+  802a61:	53                   	push   %ebx
+  802a62:	83 ec 28             	sub    $0x28,%esp
+  802a65:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802a68:	56                   	push   %esi
+  802a69:	e8 e6 f1 ff ff       	call   801c54 <fd2data>
+  802a6e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802a70:	83 c4 10             	add    $0x10,%esp
+  802a73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a78:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a7b:	75 09                	jne    802a86 <devpipe_write+0x2a>
+	return i;
+  802a7d:	89 f8                	mov    %edi,%eax
+  802a7f:	eb 23                	jmp    802aa4 <devpipe_write+0x48>
+			sys_yield();
+  802a81:	e8 02 e7 ff ff       	call   801188 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802a86:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a89:	8b 0b                	mov    (%ebx),%ecx
+  802a8b:	8d 51 20             	lea    0x20(%ecx),%edx
+  802a8e:	39 d0                	cmp    %edx,%eax
+  802a90:	72 1a                	jb     802aac <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802a92:	89 da                	mov    %ebx,%edx
+  802a94:	89 f0                	mov    %esi,%eax
+  802a96:	e8 f4 fe ff ff       	call   80298f <_pipeisclosed>
+  802a9b:	85 c0                	test   %eax,%eax
+  802a9d:	74 e2                	je     802a81 <devpipe_write+0x25>
+				return 0;
+  802a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802aa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aa7:	5b                   	pop    %ebx
+  802aa8:	5e                   	pop    %esi
+  802aa9:	5f                   	pop    %edi
+  802aaa:	5d                   	pop    %ebp
+  802aab:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802aac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802aaf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802ab3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802ab6:	89 c2                	mov    %eax,%edx
+  802ab8:	c1 fa 1f             	sar    $0x1f,%edx
+  802abb:	89 d1                	mov    %edx,%ecx
+  802abd:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ac0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ac3:	83 e2 1f             	and    $0x1f,%edx
+  802ac6:	29 ca                	sub    %ecx,%edx
+  802ac8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802acc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802ad0:	83 c0 01             	add    $0x1,%eax
+  802ad3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802ad6:	83 c7 01             	add    $0x1,%edi
+  802ad9:	eb 9d                	jmp    802a78 <devpipe_write+0x1c>
+
+00802adb <devpipe_read>:
+{
+  802adb:	55                   	push   %ebp
+  802adc:	89 e5                	mov    %esp,%ebp
+  802ade:	57                   	push   %edi
+  802adf:	56                   	push   %esi
+  802ae0:	53                   	push   %ebx
+  802ae1:	83 ec 18             	sub    $0x18,%esp
+  802ae4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802ae7:	57                   	push   %edi
+  802ae8:	e8 67 f1 ff ff       	call   801c54 <fd2data>
+  802aed:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802aef:	83 c4 10             	add    $0x10,%esp
+  802af2:	be 00 00 00 00       	mov    $0x0,%esi
+  802af7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802afa:	75 13                	jne    802b0f <devpipe_read+0x34>
+	return i;
+  802afc:	89 f0                	mov    %esi,%eax
+  802afe:	eb 02                	jmp    802b02 <devpipe_read+0x27>
+				return i;
+  802b00:	89 f0                	mov    %esi,%eax
+}
+  802b02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b05:	5b                   	pop    %ebx
+  802b06:	5e                   	pop    %esi
+  802b07:	5f                   	pop    %edi
+  802b08:	5d                   	pop    %ebp
+  802b09:	c3                   	ret
+			sys_yield();
+  802b0a:	e8 79 e6 ff ff       	call   801188 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802b0f:	8b 03                	mov    (%ebx),%eax
+  802b11:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802b14:	75 18                	jne    802b2e <devpipe_read+0x53>
+			if (i > 0)
+  802b16:	85 f6                	test   %esi,%esi
+  802b18:	75 e6                	jne    802b00 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802b1a:	89 da                	mov    %ebx,%edx
+  802b1c:	89 f8                	mov    %edi,%eax
+  802b1e:	e8 6c fe ff ff       	call   80298f <_pipeisclosed>
+  802b23:	85 c0                	test   %eax,%eax
+  802b25:	74 e3                	je     802b0a <devpipe_read+0x2f>
+				return 0;
+  802b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2c:	eb d4                	jmp    802b02 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802b2e:	99                   	cltd
+  802b2f:	c1 ea 1b             	shr    $0x1b,%edx
+  802b32:	01 d0                	add    %edx,%eax
+  802b34:	83 e0 1f             	and    $0x1f,%eax
+  802b37:	29 d0                	sub    %edx,%eax
+  802b39:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802b3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b41:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802b44:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802b47:	83 c6 01             	add    $0x1,%esi
+  802b4a:	eb ab                	jmp    802af7 <devpipe_read+0x1c>
+
+00802b4c <pipe>:
+{
+  802b4c:	55                   	push   %ebp
+  802b4d:	89 e5                	mov    %esp,%ebp
+  802b4f:	56                   	push   %esi
+  802b50:	53                   	push   %ebx
+  802b51:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802b54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b57:	50                   	push   %eax
+  802b58:	e8 0e f1 ff ff       	call   801c6b <fd_alloc>
+  802b5d:	89 c3                	mov    %eax,%ebx
+  802b5f:	83 c4 10             	add    $0x10,%esp
+  802b62:	85 c0                	test   %eax,%eax
+  802b64:	0f 88 23 01 00 00    	js     802c8d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b6a:	83 ec 04             	sub    $0x4,%esp
+  802b6d:	68 07 04 00 00       	push   $0x407
+  802b72:	ff 75 f4             	push   -0xc(%ebp)
+  802b75:	6a 00                	push   $0x0
+  802b77:	e8 52 e6 ff ff       	call   8011ce <sys_page_alloc>
+  802b7c:	89 c3                	mov    %eax,%ebx
+  802b7e:	83 c4 10             	add    $0x10,%esp
+  802b81:	85 c0                	test   %eax,%eax
+  802b83:	0f 88 04 01 00 00    	js     802c8d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802b89:	83 ec 0c             	sub    $0xc,%esp
+  802b8c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802b8f:	50                   	push   %eax
+  802b90:	e8 d6 f0 ff ff       	call   801c6b <fd_alloc>
+  802b95:	89 c3                	mov    %eax,%ebx
+  802b97:	83 c4 10             	add    $0x10,%esp
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	0f 88 db 00 00 00    	js     802c7d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ba2:	83 ec 04             	sub    $0x4,%esp
+  802ba5:	68 07 04 00 00       	push   $0x407
+  802baa:	ff 75 f0             	push   -0x10(%ebp)
+  802bad:	6a 00                	push   $0x0
+  802baf:	e8 1a e6 ff ff       	call   8011ce <sys_page_alloc>
+  802bb4:	89 c3                	mov    %eax,%ebx
+  802bb6:	83 c4 10             	add    $0x10,%esp
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	0f 88 bc 00 00 00    	js     802c7d <pipe+0x131>
+	va = fd2data(fd0);
+  802bc1:	83 ec 0c             	sub    $0xc,%esp
+  802bc4:	ff 75 f4             	push   -0xc(%ebp)
+  802bc7:	e8 88 f0 ff ff       	call   801c54 <fd2data>
+  802bcc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802bce:	83 c4 0c             	add    $0xc,%esp
+  802bd1:	68 07 04 00 00       	push   $0x407
+  802bd6:	50                   	push   %eax
+  802bd7:	6a 00                	push   $0x0
+  802bd9:	e8 f0 e5 ff ff       	call   8011ce <sys_page_alloc>
+  802bde:	89 c3                	mov    %eax,%ebx
+  802be0:	83 c4 10             	add    $0x10,%esp
+  802be3:	85 c0                	test   %eax,%eax
+  802be5:	0f 88 82 00 00 00    	js     802c6d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802beb:	83 ec 0c             	sub    $0xc,%esp
+  802bee:	ff 75 f0             	push   -0x10(%ebp)
+  802bf1:	e8 5e f0 ff ff       	call   801c54 <fd2data>
+  802bf6:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802bfd:	50                   	push   %eax
+  802bfe:	6a 00                	push   $0x0
+  802c00:	56                   	push   %esi
+  802c01:	6a 00                	push   $0x0
+  802c03:	e8 33 e6 ff ff       	call   80123b <sys_page_map>
+  802c08:	89 c3                	mov    %eax,%ebx
+  802c0a:	83 c4 20             	add    $0x20,%esp
+  802c0d:	85 c0                	test   %eax,%eax
+  802c0f:	78 4e                	js     802c5f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802c11:	a1 4c 40 80 00       	mov    0x80404c,%eax
+  802c16:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c19:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802c1b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c1e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802c25:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802c28:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802c2a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802c2d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802c34:	83 ec 0c             	sub    $0xc,%esp
+  802c37:	ff 75 f4             	push   -0xc(%ebp)
+  802c3a:	e8 05 f0 ff ff       	call   801c44 <fd2num>
+  802c3f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c42:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802c44:	83 c4 04             	add    $0x4,%esp
+  802c47:	ff 75 f0             	push   -0x10(%ebp)
+  802c4a:	e8 f5 ef ff ff       	call   801c44 <fd2num>
+  802c4f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c52:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802c55:	83 c4 10             	add    $0x10,%esp
+  802c58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c5d:	eb 2e                	jmp    802c8d <pipe+0x141>
+	sys_page_unmap(0, va);
+  802c5f:	83 ec 08             	sub    $0x8,%esp
+  802c62:	56                   	push   %esi
+  802c63:	6a 00                	push   $0x0
+  802c65:	e8 3f e6 ff ff       	call   8012a9 <sys_page_unmap>
+  802c6a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802c6d:	83 ec 08             	sub    $0x8,%esp
+  802c70:	ff 75 f0             	push   -0x10(%ebp)
+  802c73:	6a 00                	push   $0x0
+  802c75:	e8 2f e6 ff ff       	call   8012a9 <sys_page_unmap>
+  802c7a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802c7d:	83 ec 08             	sub    $0x8,%esp
+  802c80:	ff 75 f4             	push   -0xc(%ebp)
+  802c83:	6a 00                	push   $0x0
+  802c85:	e8 1f e6 ff ff       	call   8012a9 <sys_page_unmap>
+  802c8a:	83 c4 10             	add    $0x10,%esp
+}
+  802c8d:	89 d8                	mov    %ebx,%eax
+  802c8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c92:	5b                   	pop    %ebx
+  802c93:	5e                   	pop    %esi
+  802c94:	5d                   	pop    %ebp
+  802c95:	c3                   	ret
+
+00802c96 <pipeisclosed>:
+{
+  802c96:	55                   	push   %ebp
+  802c97:	89 e5                	mov    %esp,%ebp
+  802c99:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c9f:	50                   	push   %eax
+  802ca0:	ff 75 08             	push   0x8(%ebp)
+  802ca3:	e8 19 f0 ff ff       	call   801cc1 <fd_lookup>
+  802ca8:	83 c4 10             	add    $0x10,%esp
+  802cab:	85 c0                	test   %eax,%eax
+  802cad:	78 18                	js     802cc7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802caf:	83 ec 0c             	sub    $0xc,%esp
+  802cb2:	ff 75 f4             	push   -0xc(%ebp)
+  802cb5:	e8 9a ef ff ff       	call   801c54 <fd2data>
+  802cba:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802cbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cbf:	e8 cb fc ff ff       	call   80298f <_pipeisclosed>
+  802cc4:	83 c4 10             	add    $0x10,%esp
+}
+  802cc7:	c9                   	leave
+  802cc8:	c3                   	ret
+
+00802cc9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cce:	c3                   	ret
+
+00802ccf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ccf:	55                   	push   %ebp
+  802cd0:	89 e5                	mov    %esp,%ebp
+  802cd2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802cd5:	68 f3 35 80 00       	push   $0x8035f3
+  802cda:	ff 75 0c             	push   0xc(%ebp)
+  802cdd:	e8 f4 df ff ff       	call   800cd6 <strcpy>
+	return 0;
+}
+  802ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce7:	c9                   	leave
+  802ce8:	c3                   	ret
+
+00802ce9 <devcons_write>:
+{
+  802ce9:	55                   	push   %ebp
+  802cea:	89 e5                	mov    %esp,%ebp
+  802cec:	57                   	push   %edi
+  802ced:	56                   	push   %esi
+  802cee:	53                   	push   %ebx
+  802cef:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802cf5:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802cfa:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802d00:	eb 2e                	jmp    802d30 <devcons_write+0x47>
+		m = n - tot;
+  802d02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d05:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802d07:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d0c:	39 c3                	cmp    %eax,%ebx
+  802d0e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802d11:	83 ec 04             	sub    $0x4,%esp
+  802d14:	53                   	push   %ebx
+  802d15:	89 f0                	mov    %esi,%eax
+  802d17:	03 45 0c             	add    0xc(%ebp),%eax
+  802d1a:	50                   	push   %eax
+  802d1b:	57                   	push   %edi
+  802d1c:	e8 3b e1 ff ff       	call   800e5c <memmove>
+		sys_cputs(buf, m);
+  802d21:	83 c4 08             	add    $0x8,%esp
+  802d24:	53                   	push   %ebx
+  802d25:	57                   	push   %edi
+  802d26:	e8 24 e3 ff ff       	call   80104f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802d2b:	01 de                	add    %ebx,%esi
+  802d2d:	83 c4 10             	add    $0x10,%esp
+  802d30:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d33:	72 cd                	jb     802d02 <devcons_write+0x19>
+}
+  802d35:	89 f0                	mov    %esi,%eax
+  802d37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d3a:	5b                   	pop    %ebx
+  802d3b:	5e                   	pop    %esi
+  802d3c:	5f                   	pop    %edi
+  802d3d:	5d                   	pop    %ebp
+  802d3e:	c3                   	ret
+
+00802d3f <devcons_read>:
+{
+  802d3f:	55                   	push   %ebp
+  802d40:	89 e5                	mov    %esp,%ebp
+  802d42:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d4e:	75 07                	jne    802d57 <devcons_read+0x18>
+  802d50:	eb 1f                	jmp    802d71 <devcons_read+0x32>
+		sys_yield();
+  802d52:	e8 31 e4 ff ff       	call   801188 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802d57:	e8 37 e3 ff ff       	call   801093 <sys_cgetc>
+  802d5c:	85 c0                	test   %eax,%eax
+  802d5e:	74 f2                	je     802d52 <devcons_read+0x13>
+	if (c < 0)
+  802d60:	78 0f                	js     802d71 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802d62:	83 f8 04             	cmp    $0x4,%eax
+  802d65:	74 0c                	je     802d73 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802d67:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d6a:	88 02                	mov    %al,(%edx)
+	return 1;
+  802d6c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802d71:	c9                   	leave
+  802d72:	c3                   	ret
+		return 0;
+  802d73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d78:	eb f7                	jmp    802d71 <devcons_read+0x32>
+
+00802d7a <cputchar>:
+{
+  802d7a:	55                   	push   %ebp
+  802d7b:	89 e5                	mov    %esp,%ebp
+  802d7d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802d80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d83:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802d86:	6a 01                	push   $0x1
+  802d88:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d8b:	50                   	push   %eax
+  802d8c:	e8 be e2 ff ff       	call   80104f <sys_cputs>
+}
+  802d91:	83 c4 10             	add    $0x10,%esp
+  802d94:	c9                   	leave
+  802d95:	c3                   	ret
+
+00802d96 <getchar>:
+{
+  802d96:	55                   	push   %ebp
+  802d97:	89 e5                	mov    %esp,%ebp
+  802d99:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802d9c:	6a 01                	push   $0x1
+  802d9e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802da1:	50                   	push   %eax
+  802da2:	6a 00                	push   $0x0
+  802da4:	e8 9e f1 ff ff       	call   801f47 <read>
+	if (r < 0)
+  802da9:	83 c4 10             	add    $0x10,%esp
+  802dac:	85 c0                	test   %eax,%eax
+  802dae:	78 06                	js     802db6 <getchar+0x20>
+	if (r < 1)
+  802db0:	74 06                	je     802db8 <getchar+0x22>
+	return c;
+  802db2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802db6:	c9                   	leave
+  802db7:	c3                   	ret
+		return -E_EOF;
+  802db8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802dbd:	eb f7                	jmp    802db6 <getchar+0x20>
+
+00802dbf <iscons>:
+{
+  802dbf:	55                   	push   %ebp
+  802dc0:	89 e5                	mov    %esp,%ebp
+  802dc2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dc5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dc8:	50                   	push   %eax
+  802dc9:	ff 75 08             	push   0x8(%ebp)
+  802dcc:	e8 f0 ee ff ff       	call   801cc1 <fd_lookup>
+  802dd1:	83 c4 10             	add    $0x10,%esp
+  802dd4:	85 c0                	test   %eax,%eax
+  802dd6:	78 11                	js     802de9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802dd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ddb:	8b 15 68 40 80 00    	mov    0x804068,%edx
+  802de1:	39 10                	cmp    %edx,(%eax)
+  802de3:	0f 94 c0             	sete   %al
+  802de6:	0f b6 c0             	movzbl %al,%eax
+}
+  802de9:	c9                   	leave
+  802dea:	c3                   	ret
+
+00802deb <opencons>:
+{
+  802deb:	55                   	push   %ebp
+  802dec:	89 e5                	mov    %esp,%ebp
+  802dee:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802df1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802df4:	50                   	push   %eax
+  802df5:	e8 71 ee ff ff       	call   801c6b <fd_alloc>
+  802dfa:	83 c4 10             	add    $0x10,%esp
+  802dfd:	85 c0                	test   %eax,%eax
+  802dff:	78 3a                	js     802e3b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802e01:	83 ec 04             	sub    $0x4,%esp
+  802e04:	68 07 04 00 00       	push   $0x407
+  802e09:	ff 75 f4             	push   -0xc(%ebp)
+  802e0c:	6a 00                	push   $0x0
+  802e0e:	e8 bb e3 ff ff       	call   8011ce <sys_page_alloc>
+  802e13:	83 c4 10             	add    $0x10,%esp
+  802e16:	85 c0                	test   %eax,%eax
+  802e18:	78 21                	js     802e3b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802e1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e1d:	8b 15 68 40 80 00    	mov    0x804068,%edx
+  802e23:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802e25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e28:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802e2f:	83 ec 0c             	sub    $0xc,%esp
+  802e32:	50                   	push   %eax
+  802e33:	e8 0c ee ff ff       	call   801c44 <fd2num>
+  802e38:	83 c4 10             	add    $0x10,%esp
+}
+  802e3b:	c9                   	leave
+  802e3c:	c3                   	ret
+
+00802e3d <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802e3d:	55                   	push   %ebp
+  802e3e:	89 e5                	mov    %esp,%ebp
+  802e40:	56                   	push   %esi
+  802e41:	53                   	push   %ebx
+  802e42:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802e4b:	85 c0                	test   %eax,%eax
+  802e4d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802e52:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802e55:	83 ec 08             	sub    $0x8,%esp
+  802e58:	ff 75 14             	push   0x14(%ebp)
+  802e5b:	50                   	push   %eax
+  802e5c:	e8 7e e7 ff ff       	call   8015df <sys_ipc_recv_until>
+  802e61:	83 c4 10             	add    $0x10,%esp
+  802e64:	85 c0                	test   %eax,%eax
+  802e66:	78 61                	js     802ec9 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802e68:	85 f6                	test   %esi,%esi
+  802e6a:	74 1c                	je     802e88 <ipc_recv_until+0x4b>
+  802e6c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e6e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e73:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e79:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e7e:	76 5f                	jbe    802edf <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802e80:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802e86:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802e88:	85 db                	test   %ebx,%ebx
+  802e8a:	74 1c                	je     802ea8 <ipc_recv_until+0x6b>
+  802e8c:	89 e0                	mov    %esp,%eax
+  802e8e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e93:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e99:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e9e:	76 50                	jbe    802ef0 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802ea0:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802ea6:	89 03                	mov    %eax,(%ebx)
+  802ea8:	89 e0                	mov    %esp,%eax
+  802eaa:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802eaf:	8b 15 18 50 80 00    	mov    0x805018,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802eb5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802eba:	76 45                	jbe    802f01 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802ebc:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802ec2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ec5:	5b                   	pop    %ebx
+  802ec6:	5e                   	pop    %esi
+  802ec7:	5d                   	pop    %ebp
+  802ec8:	c3                   	ret
+		if (from_env_store)
+  802ec9:	85 f6                	test   %esi,%esi
+  802ecb:	74 06                	je     802ed3 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802ecd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ed3:	85 db                	test   %ebx,%ebx
+  802ed5:	74 eb                	je     802ec2 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802ed7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802edd:	eb e3                	jmp    802ec2 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802edf:	c1 e8 10             	shr    $0x10,%eax
+  802ee2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ee8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802eee:	eb 90                	jmp    802e80 <ipc_recv_until+0x43>
+  802ef0:	c1 e8 10             	shr    $0x10,%eax
+  802ef3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ef9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802eff:	eb 9f                	jmp    802ea0 <ipc_recv_until+0x63>
+  802f01:	c1 e8 10             	shr    $0x10,%eax
+  802f04:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f0a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f10:	eb aa                	jmp    802ebc <ipc_recv_until+0x7f>
+
+00802f12 <ipc_recv>:
+{
+  802f12:	55                   	push   %ebp
+  802f13:	89 e5                	mov    %esp,%ebp
+  802f15:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802f18:	6a 00                	push   $0x0
+  802f1a:	ff 75 10             	push   0x10(%ebp)
+  802f1d:	ff 75 0c             	push   0xc(%ebp)
+  802f20:	ff 75 08             	push   0x8(%ebp)
+  802f23:	e8 15 ff ff ff       	call   802e3d <ipc_recv_until>
+}
+  802f28:	c9                   	leave
+  802f29:	c3                   	ret
+
+00802f2a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802f2a:	55                   	push   %ebp
+  802f2b:	89 e5                	mov    %esp,%ebp
+  802f2d:	57                   	push   %edi
+  802f2e:	56                   	push   %esi
+  802f2f:	53                   	push   %ebx
+  802f30:	83 ec 0c             	sub    $0xc,%esp
+  802f33:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f36:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802f39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802f3c:	85 db                	test   %ebx,%ebx
+  802f3e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f43:	0f 44 d8             	cmove  %eax,%ebx
+  802f46:	eb 05                	jmp    802f4d <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802f48:	e8 3b e2 ff ff       	call   801188 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802f4d:	ff 75 14             	push   0x14(%ebp)
+  802f50:	53                   	push   %ebx
+  802f51:	56                   	push   %esi
+  802f52:	57                   	push   %edi
+  802f53:	e8 d3 e5 ff ff       	call   80152b <sys_ipc_try_send>
+  802f58:	83 c4 10             	add    $0x10,%esp
+  802f5b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f5e:	74 e8                	je     802f48 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802f60:	85 c0                	test   %eax,%eax
+  802f62:	78 08                	js     802f6c <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f67:	5b                   	pop    %ebx
+  802f68:	5e                   	pop    %esi
+  802f69:	5f                   	pop    %edi
+  802f6a:	5d                   	pop    %ebp
+  802f6b:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802f6c:	50                   	push   %eax
+  802f6d:	68 ff 35 80 00       	push   $0x8035ff
+  802f72:	6a 4f                	push   $0x4f
+  802f74:	68 12 36 80 00       	push   $0x803612
+  802f79:	e8 35 d6 ff ff       	call   8005b3 <_panic>
+
+00802f7e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802f7e:	55                   	push   %ebp
+  802f7f:	89 e5                	mov    %esp,%ebp
+  802f81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802f84:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802f89:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802f8f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f95:	8b 52 50             	mov    0x50(%edx),%edx
+  802f98:	39 ca                	cmp    %ecx,%edx
+  802f9a:	74 11                	je     802fad <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802f9c:	83 c0 01             	add    $0x1,%eax
+  802f9f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802fa4:	75 e3                	jne    802f89 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fab:	eb 0e                	jmp    802fbb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802fad:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fb3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802fb8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802fbb:	5d                   	pop    %ebp
+  802fbc:	c3                   	ret
+
+00802fbd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802fbd:	55                   	push   %ebp
+  802fbe:	89 e5                	mov    %esp,%ebp
+  802fc0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802fc3:	89 c2                	mov    %eax,%edx
+  802fc5:	c1 ea 16             	shr    $0x16,%edx
+  802fc8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802fd4:	f6 c1 01             	test   $0x1,%cl
+  802fd7:	74 1a                	je     802ff3 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802fd9:	c1 e8 0c             	shr    $0xc,%eax
+  802fdc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802fe3:	a8 01                	test   $0x1,%al
+  802fe5:	74 0c                	je     802ff3 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802fe7:	c1 e8 0c             	shr    $0xc,%eax
+  802fea:	c1 e0 04             	shl    $0x4,%eax
+  802fed:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802ff3:	89 d0                	mov    %edx,%eax
+  802ff5:	5d                   	pop    %ebp
+  802ff6:	c3                   	ret
@@ -0,0 +1,6846 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9b 02 00 00       	call   8002cc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ls1>:
+		panic("error reading directory %s: %e", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	const char *sep;
+
+	if(flag['l'])
+  80003e:	83 3d d0 51 80 00 00 	cmpl   $0x0,0x8051d0
+  800045:	74 20                	je     800067 <ls1+0x34>
+		printf("%11d %c ", size, isdir ? 'd' : '-');
+  800047:	89 f0                	mov    %esi,%eax
+  800049:	3c 01                	cmp    $0x1,%al
+  80004b:	19 c0                	sbb    %eax,%eax
+  80004d:	83 e0 c9             	and    $0xffffffc9,%eax
+  800050:	83 c0 64             	add    $0x64,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	ff 75 10             	push   0x10(%ebp)
+  80005a:	68 42 30 80 00       	push   $0x803042
+  80005f:	e8 75 24 00 00       	call   8024d9 <printf>
+  800064:	83 c4 10             	add    $0x10,%esp
+	if(prefix) {
+  800067:	85 db                	test   %ebx,%ebx
+  800069:	74 1c                	je     800087 <ls1+0x54>
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+			sep = "/";
+		else
+			sep = "";
+  80006b:	b8 a8 30 80 00       	mov    $0x8030a8,%eax
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  800070:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800073:	75 4b                	jne    8000c0 <ls1+0x8d>
+		printf("%s%s", prefix, sep);
+  800075:	83 ec 04             	sub    $0x4,%esp
+  800078:	50                   	push   %eax
+  800079:	53                   	push   %ebx
+  80007a:	68 4b 30 80 00       	push   $0x80304b
+  80007f:	e8 55 24 00 00       	call   8024d9 <printf>
+  800084:	83 c4 10             	add    $0x10,%esp
+	}
+	printf("%s", name);
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	ff 75 14             	push   0x14(%ebp)
+  80008d:	68 21 35 80 00       	push   $0x803521
+  800092:	e8 42 24 00 00       	call   8024d9 <printf>
+	if(flag['F'] && isdir)
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	83 3d 38 51 80 00 00 	cmpl   $0x0,0x805138
+  8000a1:	74 06                	je     8000a9 <ls1+0x76>
+  8000a3:	89 f0                	mov    %esi,%eax
+  8000a5:	84 c0                	test   %al,%al
+  8000a7:	75 37                	jne    8000e0 <ls1+0xad>
+		printf("/");
+	printf("\n");
+  8000a9:	83 ec 0c             	sub    $0xc,%esp
+  8000ac:	68 a7 30 80 00       	push   $0x8030a7
+  8000b1:	e8 23 24 00 00       	call   8024d9 <printf>
+}
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8000c0:	83 ec 0c             	sub    $0xc,%esp
+  8000c3:	53                   	push   %ebx
+  8000c4:	e8 af 09 00 00       	call   800a78 <strlen>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+			sep = "/";
+  8000cc:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000d1:	b8 a8 30 80 00       	mov    $0x8030a8,%eax
+  8000d6:	ba 40 30 80 00       	mov    $0x803040,%edx
+  8000db:	0f 45 c2             	cmovne %edx,%eax
+  8000de:	eb 95                	jmp    800075 <ls1+0x42>
+		printf("/");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 40 30 80 00       	push   $0x803040
+  8000e8:	e8 ec 23 00 00       	call   8024d9 <printf>
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	eb b7                	jmp    8000a9 <ls1+0x76>
+
+008000f2 <lsdir>:
+{
+  8000f2:	55                   	push   %ebp
+  8000f3:	89 e5                	mov    %esp,%ebp
+  8000f5:	57                   	push   %edi
+  8000f6:	56                   	push   %esi
+  8000f7:	53                   	push   %ebx
+  8000f8:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  8000fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800101:	6a 00                	push   $0x0
+  800103:	57                   	push   %edi
+  800104:	e8 2d 22 00 00       	call   802336 <open>
+  800109:	89 c3                	mov    %eax,%ebx
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	78 50                	js     800162 <lsdir+0x70>
+	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800112:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800118:	83 ec 04             	sub    $0x4,%esp
+  80011b:	68 00 01 00 00       	push   $0x100
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	e8 f3 1d 00 00       	call   801f1a <readn>
+  800127:	83 c4 10             	add    $0x10,%esp
+  80012a:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80012f:	75 47                	jne    800178 <lsdir+0x86>
+		if (f.f_name[0])
+  800131:	80 bd e8 fe ff ff 00 	cmpb   $0x0,-0x118(%ebp)
+  800138:	74 de                	je     800118 <lsdir+0x26>
+			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
+  80013a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  800140:	50                   	push   %eax
+  800141:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  800147:	83 bd 6c ff ff ff 01 	cmpl   $0x1,-0x94(%ebp)
+  80014e:	0f 94 c0             	sete   %al
+  800151:	0f b6 c0             	movzbl %al,%eax
+  800154:	50                   	push   %eax
+  800155:	ff 75 0c             	push   0xc(%ebp)
+  800158:	e8 d6 fe ff ff       	call   800033 <ls1>
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	eb b6                	jmp    800118 <lsdir+0x26>
+		panic("open %s: %e", path, fd);
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	50                   	push   %eax
+  800166:	57                   	push   %edi
+  800167:	68 50 30 80 00       	push   $0x803050
+  80016c:	6a 1d                	push   $0x1d
+  80016e:	68 5c 30 80 00       	push   $0x80305c
+  800173:	e8 18 02 00 00       	call   800390 <_panic>
+	if (n > 0)
+  800178:	85 c0                	test   %eax,%eax
+  80017a:	7f 0a                	jg     800186 <lsdir+0x94>
+	if (n < 0)
+  80017c:	78 1a                	js     800198 <lsdir+0xa6>
+}
+  80017e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+		panic("short read in directory %s", path);
+  800186:	57                   	push   %edi
+  800187:	68 66 30 80 00       	push   $0x803066
+  80018c:	6a 22                	push   $0x22
+  80018e:	68 5c 30 80 00       	push   $0x80305c
+  800193:	e8 f8 01 00 00       	call   800390 <_panic>
+		panic("error reading directory %s: %e", path, n);
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	50                   	push   %eax
+  80019c:	57                   	push   %edi
+  80019d:	68 ac 30 80 00       	push   $0x8030ac
+  8001a2:	6a 24                	push   $0x24
+  8001a4:	68 5c 30 80 00       	push   $0x80305c
+  8001a9:	e8 e2 01 00 00       	call   800390 <_panic>
+
+008001ae <ls>:
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	53                   	push   %ebx
+  8001b2:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = stat(path, &st)) < 0)
+  8001bb:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001c1:	50                   	push   %eax
+  8001c2:	53                   	push   %ebx
+  8001c3:	e8 78 1f 00 00       	call   802140 <stat>
+  8001c8:	83 c4 10             	add    $0x10,%esp
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	78 2c                	js     8001fb <ls+0x4d>
+	if (st.st_isdir && !flag['d'])
+  8001cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8001d2:	85 c0                	test   %eax,%eax
+  8001d4:	74 09                	je     8001df <ls+0x31>
+  8001d6:	83 3d b0 51 80 00 00 	cmpl   $0x0,0x8051b0
+  8001dd:	74 32                	je     800211 <ls+0x63>
+		ls1(0, st.st_isdir, st.st_size, path);
+  8001df:	53                   	push   %ebx
+  8001e0:	ff 75 ec             	push   -0x14(%ebp)
+  8001e3:	85 c0                	test   %eax,%eax
+  8001e5:	0f 95 c0             	setne  %al
+  8001e8:	0f b6 c0             	movzbl %al,%eax
+  8001eb:	50                   	push   %eax
+  8001ec:	6a 00                	push   $0x0
+  8001ee:	e8 40 fe ff ff       	call   800033 <ls1>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+}
+  8001f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+		panic("stat %s: %e", path, r);
+  8001fb:	83 ec 0c             	sub    $0xc,%esp
+  8001fe:	50                   	push   %eax
+  8001ff:	53                   	push   %ebx
+  800200:	68 81 30 80 00       	push   $0x803081
+  800205:	6a 0f                	push   $0xf
+  800207:	68 5c 30 80 00       	push   $0x80305c
+  80020c:	e8 7f 01 00 00       	call   800390 <_panic>
+		lsdir(path, prefix);
+  800211:	83 ec 08             	sub    $0x8,%esp
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	53                   	push   %ebx
+  800218:	e8 d5 fe ff ff       	call   8000f2 <lsdir>
+  80021d:	83 c4 10             	add    $0x10,%esp
+  800220:	eb d4                	jmp    8001f6 <ls+0x48>
+
+00800222 <usage>:
+
+void
+usage(void)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 14             	sub    $0x14,%esp
+	printf("usage: ls [-dFl] [file...]\n");
+  800228:	68 8d 30 80 00       	push   $0x80308d
+  80022d:	e8 a7 22 00 00       	call   8024d9 <printf>
+	exit();
+  800232:	e8 3f 01 00 00       	call   800376 <exit>
+}
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	56                   	push   %esi
+  800240:	53                   	push   %ebx
+  800241:	83 ec 14             	sub    $0x14,%esp
+  800244:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800247:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80024a:	50                   	push   %eax
+  80024b:	56                   	push   %esi
+  80024c:	8d 45 08             	lea    0x8(%ebp),%eax
+  80024f:	50                   	push   %eax
+  800250:	e8 cc 17 00 00       	call   801a21 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  80025b:	eb 08                	jmp    800265 <umain+0x29>
+		switch (i) {
+		case 'd':
+		case 'F':
+		case 'l':
+			flag[i]++;
+  80025d:	83 04 85 20 50 80 00 	addl   $0x1,0x805020(,%eax,4)
+  800264:	01 
+	while ((i = argnext(&args)) >= 0)
+  800265:	83 ec 0c             	sub    $0xc,%esp
+  800268:	53                   	push   %ebx
+  800269:	e8 e3 17 00 00       	call   801a51 <argnext>
+  80026e:	83 c4 10             	add    $0x10,%esp
+  800271:	85 c0                	test   %eax,%eax
+  800273:	78 16                	js     80028b <umain+0x4f>
+		switch (i) {
+  800275:	89 c2                	mov    %eax,%edx
+  800277:	83 e2 f7             	and    $0xfffffff7,%edx
+  80027a:	83 fa 64             	cmp    $0x64,%edx
+  80027d:	74 de                	je     80025d <umain+0x21>
+  80027f:	83 f8 46             	cmp    $0x46,%eax
+  800282:	74 d9                	je     80025d <umain+0x21>
+			break;
+		default:
+			usage();
+  800284:	e8 99 ff ff ff       	call   800222 <usage>
+  800289:	eb da                	jmp    800265 <umain+0x29>
+		}
+
+	if (argc == 1)
+		ls("/", "");
+	else {
+		for (i = 1; i < argc; i++)
+  80028b:	bb 01 00 00 00       	mov    $0x1,%ebx
+	if (argc == 1)
+  800290:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800294:	75 2a                	jne    8002c0 <umain+0x84>
+		ls("/", "");
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	68 a8 30 80 00       	push   $0x8030a8
+  80029e:	68 40 30 80 00       	push   $0x803040
+  8002a3:	e8 06 ff ff ff       	call   8001ae <ls>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	eb 18                	jmp    8002c5 <umain+0x89>
+			ls(argv[i], argv[i]);
+  8002ad:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	50                   	push   %eax
+  8002b4:	50                   	push   %eax
+  8002b5:	e8 f4 fe ff ff       	call   8001ae <ls>
+		for (i = 1; i < argc; i++)
+  8002ba:	83 c3 01             	add    $0x1,%ebx
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002c3:	7f e8                	jg     8002ad <umain+0x71>
+	}
+}
+  8002c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002c8:	5b                   	pop    %ebx
+  8002c9:	5e                   	pop    %esi
+  8002ca:	5d                   	pop    %ebp
+  8002cb:	c3                   	ret
+
+008002cc <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	57                   	push   %edi
+  8002d0:	56                   	push   %esi
+  8002d1:	53                   	push   %ebx
+  8002d2:	83 ec 0c             	sub    $0xc,%esp
+  8002d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8002db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002e0:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8002e2:	c1 ea 0b             	shr    $0xb,%edx
+  8002e5:	83 f2 01             	xor    $0x1,%edx
+  8002e8:	83 e2 01             	and    $0x1,%edx
+  8002eb:	88 15 24 54 80 00    	mov    %dl,0x805424
+
+	mainenv = NULL;
+  8002f1:	c7 05 20 54 80 00 00 	movl   $0x0,0x805420
+  8002f8:	00 00 00 
+	envid = sys_getenvid();
+  8002fb:	e8 1f 0c 00 00       	call   800f1f <sys_getenvid>
+  800300:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800302:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800307:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80030d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800313:	8b 52 48             	mov    0x48(%edx),%edx
+  800316:	39 ca                	cmp    %ecx,%edx
+  800318:	74 27                	je     800341 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80031a:	83 c0 01             	add    $0x1,%eax
+  80031d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800322:	75 e3                	jne    800307 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800324:	83 3d 20 54 80 00 00 	cmpl   $0x0,0x805420
+  80032b:	75 24                	jne    800351 <libmain+0x85>
+		panic("libmain can't find the environment");
+  80032d:	83 ec 04             	sub    $0x4,%esp
+  800330:	68 cc 30 80 00       	push   $0x8030cc
+  800335:	6a 23                	push   $0x23
+  800337:	68 ef 30 80 00       	push   $0x8030ef
+  80033c:	e8 4f 00 00 00       	call   800390 <_panic>
+			mainenv = &envs[i];
+  800341:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800347:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80034c:	a3 20 54 80 00       	mov    %eax,0x805420
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800351:	85 ff                	test   %edi,%edi
+  800353:	7e 07                	jle    80035c <libmain+0x90>
+		binaryname = argv[0];
+  800355:	8b 06                	mov    (%esi),%eax
+  800357:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80035c:	83 ec 08             	sub    $0x8,%esp
+  80035f:	56                   	push   %esi
+  800360:	57                   	push   %edi
+  800361:	e8 d6 fe ff ff       	call   80023c <umain>
+
+	// exit gracefully
+	exit();
+  800366:	e8 0b 00 00 00       	call   800376 <exit>
+}
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800371:	5b                   	pop    %ebx
+  800372:	5e                   	pop    %esi
+  800373:	5f                   	pop    %edi
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+
+00800376 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80037c:	e8 e3 19 00 00       	call   801d64 <close_all>
+	sys_env_destroy(0);
+  800381:	83 ec 0c             	sub    $0xc,%esp
+  800384:	6a 00                	push   $0x0
+  800386:	e8 2b 0b 00 00       	call   800eb6 <sys_env_destroy>
+}
+  80038b:	83 c4 10             	add    $0x10,%esp
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	56                   	push   %esi
+  800394:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800395:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800398:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80039e:	e8 7c 0b 00 00       	call   800f1f <sys_getenvid>
+  8003a3:	83 ec 0c             	sub    $0xc,%esp
+  8003a6:	ff 75 0c             	push   0xc(%ebp)
+  8003a9:	ff 75 08             	push   0x8(%ebp)
+  8003ac:	56                   	push   %esi
+  8003ad:	50                   	push   %eax
+  8003ae:	68 08 31 80 00       	push   $0x803108
+  8003b3:	e8 b3 00 00 00       	call   80046b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003b8:	83 c4 18             	add    $0x18,%esp
+  8003bb:	53                   	push   %ebx
+  8003bc:	ff 75 10             	push   0x10(%ebp)
+  8003bf:	e8 56 00 00 00       	call   80041a <vcprintf>
+	cprintf("\n");
+  8003c4:	c7 04 24 a7 30 80 00 	movl   $0x8030a7,(%esp)
+  8003cb:	e8 9b 00 00 00       	call   80046b <cprintf>
+  8003d0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003d3:	cc                   	int3
+	while (1)
+  8003d4:	eb fd                	jmp    8003d3 <_panic+0x43>
+
+008003d6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003d6:	55                   	push   %ebp
+  8003d7:	89 e5                	mov    %esp,%ebp
+  8003d9:	53                   	push   %ebx
+  8003da:	83 ec 04             	sub    $0x4,%esp
+  8003dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003e0:	8b 13                	mov    (%ebx),%edx
+  8003e2:	8d 42 01             	lea    0x1(%edx),%eax
+  8003e5:	89 03                	mov    %eax,(%ebx)
+  8003e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003ea:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003ee:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003f3:	74 09                	je     8003fe <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003f5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003fc:	c9                   	leave
+  8003fd:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003fe:	83 ec 08             	sub    $0x8,%esp
+  800401:	68 ff 00 00 00       	push   $0xff
+  800406:	8d 43 08             	lea    0x8(%ebx),%eax
+  800409:	50                   	push   %eax
+  80040a:	e8 1d 0a 00 00       	call   800e2c <sys_cputs>
+		b->idx = 0;
+  80040f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	eb db                	jmp    8003f5 <putch+0x1f>
+
+0080041a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80041a:	55                   	push   %ebp
+  80041b:	89 e5                	mov    %esp,%ebp
+  80041d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800423:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80042a:	00 00 00 
+	b.cnt = 0;
+  80042d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800434:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800437:	ff 75 0c             	push   0xc(%ebp)
+  80043a:	ff 75 08             	push   0x8(%ebp)
+  80043d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800443:	50                   	push   %eax
+  800444:	68 d6 03 80 00       	push   $0x8003d6
+  800449:	e8 fb 00 00 00       	call   800549 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80044e:	83 c4 08             	add    $0x8,%esp
+  800451:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800457:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80045d:	50                   	push   %eax
+  80045e:	e8 c9 09 00 00       	call   800e2c <sys_cputs>
+
+	return b.cnt;
+}
+  800463:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800469:	c9                   	leave
+  80046a:	c3                   	ret
+
+0080046b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80046b:	55                   	push   %ebp
+  80046c:	89 e5                	mov    %esp,%ebp
+  80046e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800471:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800474:	50                   	push   %eax
+  800475:	ff 75 08             	push   0x8(%ebp)
+  800478:	e8 9d ff ff ff       	call   80041a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80047d:	c9                   	leave
+  80047e:	c3                   	ret
+
+0080047f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80047f:	55                   	push   %ebp
+  800480:	89 e5                	mov    %esp,%ebp
+  800482:	57                   	push   %edi
+  800483:	56                   	push   %esi
+  800484:	53                   	push   %ebx
+  800485:	83 ec 1c             	sub    $0x1c,%esp
+  800488:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80048b:	89 d6                	mov    %edx,%esi
+  80048d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800490:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800493:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800496:	73 0b                	jae    8004a3 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800498:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80049b:	c1 e7 08             	shl    $0x8,%edi
+  80049e:	0b 7d 10             	or     0x10(%ebp),%edi
+  8004a1:	eb 36                	jmp    8004d9 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8004a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ab:	f7 75 08             	divl   0x8(%ebp)
+  8004ae:	89 c1                	mov    %eax,%ecx
+  8004b0:	ff 75 14             	push   0x14(%ebp)
+  8004b3:	ff 75 10             	push   0x10(%ebp)
+  8004b6:	83 eb 01             	sub    $0x1,%ebx
+  8004b9:	53                   	push   %ebx
+  8004ba:	ff 75 08             	push   0x8(%ebp)
+  8004bd:	89 f2                	mov    %esi,%edx
+  8004bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004c2:	e8 b8 ff ff ff       	call   80047f <printnum>
+  8004c7:	83 c4 10             	add    $0x10,%esp
+  8004ca:	eb 14                	jmp    8004e0 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	56                   	push   %esi
+  8004d0:	57                   	push   %edi
+  8004d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004d4:	ff d0                	call   *%eax
+  8004d6:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8004d9:	83 eb 01             	sub    $0x1,%ebx
+  8004dc:	85 db                	test   %ebx,%ebx
+  8004de:	7f ec                	jg     8004cc <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8004e0:	83 ec 08             	sub    $0x8,%esp
+  8004e3:	56                   	push   %esi
+  8004e4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ec:	f7 75 08             	divl   0x8(%ebp)
+  8004ef:	0f be 92 2b 31 80 00 	movsbl 0x80312b(%edx),%edx
+  8004f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f9:	c1 e0 08             	shl    $0x8,%eax
+  8004fc:	09 d0                	or     %edx,%eax
+  8004fe:	50                   	push   %eax
+  8004ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800502:	ff d0                	call   *%eax
+}
+  800504:	83 c4 10             	add    $0x10,%esp
+  800507:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80050a:	5b                   	pop    %ebx
+  80050b:	5e                   	pop    %esi
+  80050c:	5f                   	pop    %edi
+  80050d:	5d                   	pop    %ebp
+  80050e:	c3                   	ret
+
+0080050f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80050f:	55                   	push   %ebp
+  800510:	89 e5                	mov    %esp,%ebp
+  800512:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800515:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800519:	8b 10                	mov    (%eax),%edx
+  80051b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80051e:	73 0a                	jae    80052a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800520:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800523:	89 08                	mov    %ecx,(%eax)
+  800525:	8b 45 08             	mov    0x8(%ebp),%eax
+  800528:	88 02                	mov    %al,(%edx)
+}
+  80052a:	5d                   	pop    %ebp
+  80052b:	c3                   	ret
+
+0080052c <printfmt>:
+{
+  80052c:	55                   	push   %ebp
+  80052d:	89 e5                	mov    %esp,%ebp
+  80052f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800532:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800535:	50                   	push   %eax
+  800536:	ff 75 10             	push   0x10(%ebp)
+  800539:	ff 75 0c             	push   0xc(%ebp)
+  80053c:	ff 75 08             	push   0x8(%ebp)
+  80053f:	e8 05 00 00 00       	call   800549 <vprintfmt>
+}
+  800544:	83 c4 10             	add    $0x10,%esp
+  800547:	c9                   	leave
+  800548:	c3                   	ret
+
+00800549 <vprintfmt>:
+{
+  800549:	55                   	push   %ebp
+  80054a:	89 e5                	mov    %esp,%ebp
+  80054c:	57                   	push   %edi
+  80054d:	56                   	push   %esi
+  80054e:	53                   	push   %ebx
+  80054f:	83 ec 3c             	sub    $0x3c,%esp
+  800552:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800555:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800558:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80055f:	eb 16                	jmp    800577 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800561:	83 ec 08             	sub    $0x8,%esp
+  800564:	ff 75 0c             	push   0xc(%ebp)
+  800567:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80056a:	c1 e2 08             	shl    $0x8,%edx
+  80056d:	09 d0                	or     %edx,%eax
+  80056f:	50                   	push   %eax
+  800570:	ff d7                	call   *%edi
+  800572:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800575:	89 de                	mov    %ebx,%esi
+  800577:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80057a:	0f b6 06             	movzbl (%esi),%eax
+  80057d:	83 f8 25             	cmp    $0x25,%eax
+  800580:	74 0c                	je     80058e <vprintfmt+0x45>
+			if (ch == '\0')
+  800582:	85 c0                	test   %eax,%eax
+  800584:	75 db                	jne    800561 <vprintfmt+0x18>
+}
+  800586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800589:	5b                   	pop    %ebx
+  80058a:	5e                   	pop    %esi
+  80058b:	5f                   	pop    %edi
+  80058c:	5d                   	pop    %ebp
+  80058d:	c3                   	ret
+		padc = ' ';
+  80058e:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800592:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800599:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8005a0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8005a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ac:	8d 73 01             	lea    0x1(%ebx),%esi
+  8005af:	0f b6 13             	movzbl (%ebx),%edx
+  8005b2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005b5:	3c 55                	cmp    $0x55,%al
+  8005b7:	0f 87 2c 04 00 00    	ja     8009e9 <vprintfmt+0x4a0>
+  8005bd:	0f b6 c0             	movzbl %al,%eax
+  8005c0:	ff 24 85 80 32 80 00 	jmp    *0x803280(,%eax,4)
+  8005c7:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8005c9:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8005cd:	eb dd                	jmp    8005ac <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005cf:	89 f3                	mov    %esi,%ebx
+  8005d1:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8005d5:	eb d5                	jmp    8005ac <vprintfmt+0x63>
+  8005d7:	0f b6 d2             	movzbl %dl,%edx
+  8005da:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8005dc:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8005e1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005e4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005e8:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8005eb:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8005ee:	83 fe 09             	cmp    $0x9,%esi
+  8005f1:	0f 87 8a 00 00 00    	ja     800681 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8005f7:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8005fa:	eb e5                	jmp    8005e1 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8005fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ff:	8b 00                	mov    (%eax),%eax
+  800601:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8d 40 04             	lea    0x4(%eax),%eax
+  80060a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80060d:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80060f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800613:	79 97                	jns    8005ac <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800615:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800618:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80061b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800622:	eb 88                	jmp    8005ac <vprintfmt+0x63>
+			if (width < 0)
+  800624:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062e:	0f 49 c3             	cmovns %ebx,%eax
+  800631:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800634:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800636:	e9 71 ff ff ff       	jmp    8005ac <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80063b:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80063d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800644:	e9 63 ff ff ff       	jmp    8005ac <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800649:	8d 73 02             	lea    0x2(%ebx),%esi
+  80064c:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800650:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800657:	3c 67                	cmp    $0x67,%al
+  800659:	0f 84 18 ff ff ff    	je     800577 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80065f:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800666:	3c 72                	cmp    $0x72,%al
+  800668:	0f 84 09 ff ff ff    	je     800577 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80066e:	3c 62                	cmp    $0x62,%al
+  800670:	0f 94 c0             	sete   %al
+  800673:	0f b6 c0             	movzbl %al,%eax
+  800676:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800679:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80067c:	e9 f6 fe ff ff       	jmp    800577 <vprintfmt+0x2e>
+  800681:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800684:	eb 89                	jmp    80060f <vprintfmt+0xc6>
+			lflag++;
+  800686:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800689:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80068b:	e9 1c ff ff ff       	jmp    8005ac <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8d 58 04             	lea    0x4(%eax),%ebx
+  800696:	83 ec 08             	sub    $0x8,%esp
+  800699:	ff 75 0c             	push   0xc(%ebp)
+  80069c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80069f:	c1 e0 08             	shl    $0x8,%eax
+  8006a2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8006a5:	0b 01                	or     (%ecx),%eax
+  8006a7:	50                   	push   %eax
+  8006a8:	ff d7                	call   *%edi
+			break;
+  8006aa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8006ad:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8006b0:	e9 c2 fe ff ff       	jmp    800577 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8006bb:	8b 10                	mov    (%eax),%edx
+  8006bd:	89 d0                	mov    %edx,%eax
+  8006bf:	f7 d8                	neg    %eax
+  8006c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006c4:	83 f8 12             	cmp    $0x12,%eax
+  8006c7:	7f 25                	jg     8006ee <vprintfmt+0x1a5>
+  8006c9:	8b 14 85 e0 33 80 00 	mov    0x8033e0(,%eax,4),%edx
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	74 1a                	je     8006ee <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8006d4:	52                   	push   %edx
+  8006d5:	68 21 35 80 00       	push   $0x803521
+  8006da:	ff 75 0c             	push   0xc(%ebp)
+  8006dd:	57                   	push   %edi
+  8006de:	e8 49 fe ff ff       	call   80052c <printfmt>
+  8006e3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006e6:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8006e9:	e9 89 fe ff ff       	jmp    800577 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8006ee:	50                   	push   %eax
+  8006ef:	68 43 31 80 00       	push   $0x803143
+  8006f4:	ff 75 0c             	push   0xc(%ebp)
+  8006f7:	57                   	push   %edi
+  8006f8:	e8 2f fe ff ff       	call   80052c <printfmt>
+  8006fd:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800700:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800703:	e9 6f fe ff ff       	jmp    800577 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	83 c0 04             	add    $0x4,%eax
+  80070e:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800716:	85 c9                	test   %ecx,%ecx
+  800718:	b8 3c 31 80 00       	mov    $0x80313c,%eax
+  80071d:	0f 45 c1             	cmovne %ecx,%eax
+  800720:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800723:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800727:	7e 06                	jle    80072f <vprintfmt+0x1e6>
+  800729:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80072d:	75 1a                	jne    800749 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80072f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800732:	c1 e0 08             	shl    $0x8,%eax
+  800735:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800738:	83 c8 3f             	or     $0x3f,%eax
+  80073b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80073e:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800741:	89 75 10             	mov    %esi,0x10(%ebp)
+  800744:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800747:	eb 6d                	jmp    8007b6 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	ff 75 d0             	push   -0x30(%ebp)
+  80074f:	ff 75 c8             	push   -0x38(%ebp)
+  800752:	e8 39 03 00 00       	call   800a90 <strnlen>
+  800757:	89 c2                	mov    %eax,%edx
+  800759:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80075c:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80075e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800761:	c1 e1 08             	shl    $0x8,%ecx
+  800764:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800768:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80076a:	83 c4 10             	add    $0x10,%esp
+  80076d:	89 c3                	mov    %eax,%ebx
+  80076f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800772:	89 75 10             	mov    %esi,0x10(%ebp)
+  800775:	89 ce                	mov    %ecx,%esi
+  800777:	eb 0f                	jmp    800788 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800779:	83 ec 08             	sub    $0x8,%esp
+  80077c:	ff 75 0c             	push   0xc(%ebp)
+  80077f:	56                   	push   %esi
+  800780:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800782:	83 eb 01             	sub    $0x1,%ebx
+  800785:	83 c4 10             	add    $0x10,%esp
+  800788:	85 db                	test   %ebx,%ebx
+  80078a:	7f ed                	jg     800779 <vprintfmt+0x230>
+  80078c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80078f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800792:	85 c0                	test   %eax,%eax
+  800794:	ba 00 00 00 00       	mov    $0x0,%edx
+  800799:	0f 49 d0             	cmovns %eax,%edx
+  80079c:	29 d0                	sub    %edx,%eax
+  80079e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007a1:	eb 8c                	jmp    80072f <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8007a3:	83 ec 08             	sub    $0x8,%esp
+  8007a6:	ff 75 0c             	push   0xc(%ebp)
+  8007a9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8007ac:	09 c2                	or     %eax,%edx
+  8007ae:	52                   	push   %edx
+  8007af:	ff d7                	call   *%edi
+  8007b1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007b4:	89 d9                	mov    %ebx,%ecx
+  8007b6:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8007b9:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8007bd:	0f be d0             	movsbl %al,%edx
+  8007c0:	85 d2                	test   %edx,%edx
+  8007c2:	74 2a                	je     8007ee <vprintfmt+0x2a5>
+  8007c4:	85 f6                	test   %esi,%esi
+  8007c6:	78 05                	js     8007cd <vprintfmt+0x284>
+  8007c8:	83 ee 01             	sub    $0x1,%esi
+  8007cb:	78 3b                	js     800808 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007cd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007d1:	74 d0                	je     8007a3 <vprintfmt+0x25a>
+  8007d3:	0f be c0             	movsbl %al,%eax
+  8007d6:	83 e8 20             	sub    $0x20,%eax
+  8007d9:	83 f8 5e             	cmp    $0x5e,%eax
+  8007dc:	76 c5                	jbe    8007a3 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8007de:	83 ec 08             	sub    $0x8,%esp
+  8007e1:	ff 75 0c             	push   0xc(%ebp)
+  8007e4:	ff 75 cc             	push   -0x34(%ebp)
+  8007e7:	ff d7                	call   *%edi
+  8007e9:	83 c4 10             	add    $0x10,%esp
+  8007ec:	eb c6                	jmp    8007b4 <vprintfmt+0x26b>
+  8007ee:	8b 75 10             	mov    0x10(%ebp),%esi
+  8007f1:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8007f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007f7:	01 c3                	add    %eax,%ebx
+  8007f9:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8007fb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8007fe:	83 c8 20             	or     $0x20,%eax
+  800801:	89 75 10             	mov    %esi,0x10(%ebp)
+  800804:	89 c6                	mov    %eax,%esi
+  800806:	eb 14                	jmp    80081c <vprintfmt+0x2d3>
+  800808:	8b 75 10             	mov    0x10(%ebp),%esi
+  80080b:	eb e4                	jmp    8007f1 <vprintfmt+0x2a8>
+  80080d:	83 ec 08             	sub    $0x8,%esp
+  800810:	ff 75 0c             	push   0xc(%ebp)
+  800813:	56                   	push   %esi
+  800814:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800816:	83 eb 01             	sub    $0x1,%ebx
+  800819:	83 c4 10             	add    $0x10,%esp
+  80081c:	85 db                	test   %ebx,%ebx
+  80081e:	7f ed                	jg     80080d <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800820:	8b 75 10             	mov    0x10(%ebp),%esi
+  800823:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800826:	89 45 14             	mov    %eax,0x14(%ebp)
+  800829:	e9 49 fd ff ff       	jmp    800577 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80082e:	83 f9 01             	cmp    $0x1,%ecx
+  800831:	7f 1f                	jg     800852 <vprintfmt+0x309>
+	else if (lflag)
+  800833:	85 c9                	test   %ecx,%ecx
+  800835:	74 69                	je     8008a0 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8b 00                	mov    (%eax),%eax
+  80083c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80083f:	89 c1                	mov    %eax,%ecx
+  800841:	c1 f9 1f             	sar    $0x1f,%ecx
+  800844:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800847:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084a:	8d 40 04             	lea    0x4(%eax),%eax
+  80084d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800850:	eb 17                	jmp    800869 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	8b 50 04             	mov    0x4(%eax),%edx
+  800858:	8b 00                	mov    (%eax),%eax
+  80085a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80085d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800860:	8b 45 14             	mov    0x14(%ebp),%eax
+  800863:	8d 40 08             	lea    0x8(%eax),%eax
+  800866:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800869:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80086c:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80086f:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800874:	85 db                	test   %ebx,%ebx
+  800876:	0f 89 f6 00 00 00    	jns    800972 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80087c:	83 ec 08             	sub    $0x8,%esp
+  80087f:	ff 75 0c             	push   0xc(%ebp)
+  800882:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800885:	c1 e0 08             	shl    $0x8,%eax
+  800888:	83 c8 2d             	or     $0x2d,%eax
+  80088b:	50                   	push   %eax
+  80088c:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80088e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800891:	f7 d9                	neg    %ecx
+  800893:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800896:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80089b:	e9 d2 00 00 00       	jmp    800972 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 00                	mov    (%eax),%eax
+  8008a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008a8:	89 c1                	mov    %eax,%ecx
+  8008aa:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008ad:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b9:	eb ae                	jmp    800869 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8008bb:	83 f9 01             	cmp    $0x1,%ecx
+  8008be:	7f 19                	jg     8008d9 <vprintfmt+0x390>
+	else if (lflag)
+  8008c0:	85 c9                	test   %ecx,%ecx
+  8008c2:	74 2a                	je     8008ee <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8008c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c7:	8b 08                	mov    (%eax),%ecx
+  8008c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8008d4:	e9 99 00 00 00       	jmp    800972 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008dc:	8b 08                	mov    (%eax),%ecx
+  8008de:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8008e9:	e9 84 00 00 00       	jmp    800972 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8b 08                	mov    (%eax),%ecx
+  8008f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8008fe:	eb 72                	jmp    800972 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800900:	83 f9 01             	cmp    $0x1,%ecx
+  800903:	7f 16                	jg     80091b <vprintfmt+0x3d2>
+	else if (lflag)
+  800905:	85 c9                	test   %ecx,%ecx
+  800907:	74 24                	je     80092d <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800909:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090c:	8b 08                	mov    (%eax),%ecx
+  80090e:	8d 40 04             	lea    0x4(%eax),%eax
+  800911:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800914:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800919:	eb 57                	jmp    800972 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80091b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091e:	8b 08                	mov    (%eax),%ecx
+  800920:	8d 40 08             	lea    0x8(%eax),%eax
+  800923:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800926:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80092b:	eb 45                	jmp    800972 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80092d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800930:	8b 08                	mov    (%eax),%ecx
+  800932:	8d 40 04             	lea    0x4(%eax),%eax
+  800935:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800938:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80093d:	eb 33                	jmp    800972 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  80093f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800942:	c1 e3 08             	shl    $0x8,%ebx
+  800945:	83 ec 08             	sub    $0x8,%esp
+  800948:	ff 75 0c             	push   0xc(%ebp)
+  80094b:	89 d8                	mov    %ebx,%eax
+  80094d:	83 c8 30             	or     $0x30,%eax
+  800950:	50                   	push   %eax
+  800951:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800953:	83 c4 08             	add    $0x8,%esp
+  800956:	ff 75 0c             	push   0xc(%ebp)
+  800959:	83 cb 78             	or     $0x78,%ebx
+  80095c:	53                   	push   %ebx
+  80095d:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80095f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800962:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800964:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800967:	8d 40 04             	lea    0x4(%eax),%eax
+  80096a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80096d:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800972:	ff 75 e4             	push   -0x1c(%ebp)
+  800975:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800979:	52                   	push   %edx
+  80097a:	ff 75 e0             	push   -0x20(%ebp)
+  80097d:	50                   	push   %eax
+  80097e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800981:	89 f8                	mov    %edi,%eax
+  800983:	e8 f7 fa ff ff       	call   80047f <printnum>
+			break;
+  800988:	83 c4 10             	add    $0x10,%esp
+  80098b:	e9 e7 fb ff ff       	jmp    800577 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800990:	83 f9 01             	cmp    $0x1,%ecx
+  800993:	7f 16                	jg     8009ab <vprintfmt+0x462>
+	else if (lflag)
+  800995:	85 c9                	test   %ecx,%ecx
+  800997:	74 24                	je     8009bd <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099c:	8b 08                	mov    (%eax),%ecx
+  80099e:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009a4:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8009a9:	eb c7                	jmp    800972 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8009ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ae:	8b 08                	mov    (%eax),%ecx
+  8009b0:	8d 40 08             	lea    0x8(%eax),%eax
+  8009b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009b6:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8009bb:	eb b5                	jmp    800972 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8009bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c0:	8b 08                	mov    (%eax),%ecx
+  8009c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009c8:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8009cd:	eb a3                	jmp    800972 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8009cf:	83 ec 08             	sub    $0x8,%esp
+  8009d2:	ff 75 0c             	push   0xc(%ebp)
+  8009d5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009d8:	c1 e0 08             	shl    $0x8,%eax
+  8009db:	83 c8 25             	or     $0x25,%eax
+  8009de:	50                   	push   %eax
+  8009df:	ff d7                	call   *%edi
+			break;
+  8009e1:	83 c4 10             	add    $0x10,%esp
+  8009e4:	e9 8e fb ff ff       	jmp    800577 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8009e9:	83 ec 08             	sub    $0x8,%esp
+  8009ec:	ff 75 0c             	push   0xc(%ebp)
+  8009ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009f2:	c1 e0 08             	shl    $0x8,%eax
+  8009f5:	83 c8 25             	or     $0x25,%eax
+  8009f8:	50                   	push   %eax
+  8009f9:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009fb:	83 c4 10             	add    $0x10,%esp
+  8009fe:	89 de                	mov    %ebx,%esi
+  800a00:	eb 03                	jmp    800a05 <vprintfmt+0x4bc>
+  800a02:	83 ee 01             	sub    $0x1,%esi
+  800a05:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a09:	75 f7                	jne    800a02 <vprintfmt+0x4b9>
+  800a0b:	e9 67 fb ff ff       	jmp    800577 <vprintfmt+0x2e>
+
+00800a10 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a10:	55                   	push   %ebp
+  800a11:	89 e5                	mov    %esp,%ebp
+  800a13:	83 ec 18             	sub    $0x18,%esp
+  800a16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a19:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a1c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a1f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a23:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a26:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800a2d:	85 c0                	test   %eax,%eax
+  800a2f:	74 26                	je     800a57 <vsnprintf+0x47>
+  800a31:	85 d2                	test   %edx,%edx
+  800a33:	7e 22                	jle    800a57 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a35:	ff 75 14             	push   0x14(%ebp)
+  800a38:	ff 75 10             	push   0x10(%ebp)
+  800a3b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a3e:	50                   	push   %eax
+  800a3f:	68 0f 05 80 00       	push   $0x80050f
+  800a44:	e8 00 fb ff ff       	call   800549 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a49:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a4c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a52:	83 c4 10             	add    $0x10,%esp
+}
+  800a55:	c9                   	leave
+  800a56:	c3                   	ret
+		return -E_INVAL;
+  800a57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a5c:	eb f7                	jmp    800a55 <vsnprintf+0x45>
+
+00800a5e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800a64:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a67:	50                   	push   %eax
+  800a68:	ff 75 10             	push   0x10(%ebp)
+  800a6b:	ff 75 0c             	push   0xc(%ebp)
+  800a6e:	ff 75 08             	push   0x8(%ebp)
+  800a71:	e8 9a ff ff ff       	call   800a10 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a76:	c9                   	leave
+  800a77:	c3                   	ret
+
+00800a78 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a83:	eb 03                	jmp    800a88 <strlen+0x10>
+		n++;
+  800a85:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a88:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a8c:	75 f7                	jne    800a85 <strlen+0xd>
+	return n;
+}
+  800a8e:	5d                   	pop    %ebp
+  800a8f:	c3                   	ret
+
+00800a90 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a96:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9e:	eb 03                	jmp    800aa3 <strnlen+0x13>
+		n++;
+  800aa0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aa3:	39 d0                	cmp    %edx,%eax
+  800aa5:	74 08                	je     800aaf <strnlen+0x1f>
+  800aa7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800aab:	75 f3                	jne    800aa0 <strnlen+0x10>
+  800aad:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800aaf:	89 d0                	mov    %edx,%eax
+  800ab1:	5d                   	pop    %ebp
+  800ab2:	c3                   	ret
+
+00800ab3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ab3:	55                   	push   %ebp
+  800ab4:	89 e5                	mov    %esp,%ebp
+  800ab6:	53                   	push   %ebx
+  800ab7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ac6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ac9:	83 c0 01             	add    $0x1,%eax
+  800acc:	84 d2                	test   %dl,%dl
+  800ace:	75 f2                	jne    800ac2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ad0:	89 c8                	mov    %ecx,%eax
+  800ad2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad5:	c9                   	leave
+  800ad6:	c3                   	ret
+
+00800ad7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	53                   	push   %ebx
+  800adb:	83 ec 10             	sub    $0x10,%esp
+  800ade:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ae1:	53                   	push   %ebx
+  800ae2:	e8 91 ff ff ff       	call   800a78 <strlen>
+  800ae7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800aea:	ff 75 0c             	push   0xc(%ebp)
+  800aed:	01 d8                	add    %ebx,%eax
+  800aef:	50                   	push   %eax
+  800af0:	e8 be ff ff ff       	call   800ab3 <strcpy>
+	return dst;
+}
+  800af5:	89 d8                	mov    %ebx,%eax
+  800af7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800afa:	c9                   	leave
+  800afb:	c3                   	ret
+
+00800afc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	56                   	push   %esi
+  800b00:	53                   	push   %ebx
+  800b01:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b04:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b07:	89 f3                	mov    %esi,%ebx
+  800b09:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b0c:	89 f0                	mov    %esi,%eax
+  800b0e:	eb 0f                	jmp    800b1f <strncpy+0x23>
+		*dst++ = *src;
+  800b10:	83 c0 01             	add    $0x1,%eax
+  800b13:	0f b6 0a             	movzbl (%edx),%ecx
+  800b16:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b19:	80 f9 01             	cmp    $0x1,%cl
+  800b1c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b1f:	39 d8                	cmp    %ebx,%eax
+  800b21:	75 ed                	jne    800b10 <strncpy+0x14>
+	}
+	return ret;
+}
+  800b23:	89 f0                	mov    %esi,%eax
+  800b25:	5b                   	pop    %ebx
+  800b26:	5e                   	pop    %esi
+  800b27:	5d                   	pop    %ebp
+  800b28:	c3                   	ret
+
+00800b29 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b29:	55                   	push   %ebp
+  800b2a:	89 e5                	mov    %esp,%ebp
+  800b2c:	56                   	push   %esi
+  800b2d:	53                   	push   %ebx
+  800b2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b34:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b37:	89 f0                	mov    %esi,%eax
+  800b39:	85 d2                	test   %edx,%edx
+  800b3b:	74 21                	je     800b5e <strlcpy+0x35>
+  800b3d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b41:	89 f2                	mov    %esi,%edx
+  800b43:	eb 09                	jmp    800b4e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b45:	83 c1 01             	add    $0x1,%ecx
+  800b48:	83 c2 01             	add    $0x1,%edx
+  800b4b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b4e:	39 c2                	cmp    %eax,%edx
+  800b50:	74 09                	je     800b5b <strlcpy+0x32>
+  800b52:	0f b6 19             	movzbl (%ecx),%ebx
+  800b55:	84 db                	test   %bl,%bl
+  800b57:	75 ec                	jne    800b45 <strlcpy+0x1c>
+  800b59:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b5b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b5e:	29 f0                	sub    %esi,%eax
+}
+  800b60:	5b                   	pop    %ebx
+  800b61:	5e                   	pop    %esi
+  800b62:	5d                   	pop    %ebp
+  800b63:	c3                   	ret
+
+00800b64 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b64:	55                   	push   %ebp
+  800b65:	89 e5                	mov    %esp,%ebp
+  800b67:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b6d:	eb 06                	jmp    800b75 <strcmp+0x11>
+		p++, q++;
+  800b6f:	83 c1 01             	add    $0x1,%ecx
+  800b72:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b75:	0f b6 01             	movzbl (%ecx),%eax
+  800b78:	84 c0                	test   %al,%al
+  800b7a:	74 04                	je     800b80 <strcmp+0x1c>
+  800b7c:	3a 02                	cmp    (%edx),%al
+  800b7e:	74 ef                	je     800b6f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b80:	0f b6 c0             	movzbl %al,%eax
+  800b83:	0f b6 12             	movzbl (%edx),%edx
+  800b86:	29 d0                	sub    %edx,%eax
+}
+  800b88:	5d                   	pop    %ebp
+  800b89:	c3                   	ret
+
+00800b8a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b8a:	55                   	push   %ebp
+  800b8b:	89 e5                	mov    %esp,%ebp
+  800b8d:	53                   	push   %ebx
+  800b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b94:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b97:	eb 09                	jmp    800ba2 <strncmp+0x18>
+		n--, p++, q++;
+  800b99:	83 ea 01             	sub    $0x1,%edx
+  800b9c:	83 c0 01             	add    $0x1,%eax
+  800b9f:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ba2:	85 d2                	test   %edx,%edx
+  800ba4:	74 18                	je     800bbe <strncmp+0x34>
+  800ba6:	0f b6 18             	movzbl (%eax),%ebx
+  800ba9:	84 db                	test   %bl,%bl
+  800bab:	74 04                	je     800bb1 <strncmp+0x27>
+  800bad:	3a 19                	cmp    (%ecx),%bl
+  800baf:	74 e8                	je     800b99 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bb1:	0f b6 00             	movzbl (%eax),%eax
+  800bb4:	0f b6 11             	movzbl (%ecx),%edx
+  800bb7:	29 d0                	sub    %edx,%eax
+}
+  800bb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bbc:	c9                   	leave
+  800bbd:	c3                   	ret
+		return 0;
+  800bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc3:	eb f4                	jmp    800bb9 <strncmp+0x2f>
+
+00800bc5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bcf:	eb 03                	jmp    800bd4 <strchr+0xf>
+  800bd1:	83 c0 01             	add    $0x1,%eax
+  800bd4:	0f b6 10             	movzbl (%eax),%edx
+  800bd7:	84 d2                	test   %dl,%dl
+  800bd9:	74 06                	je     800be1 <strchr+0x1c>
+		if (*s == c)
+  800bdb:	38 ca                	cmp    %cl,%dl
+  800bdd:	75 f2                	jne    800bd1 <strchr+0xc>
+  800bdf:	eb 05                	jmp    800be6 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800be1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800be6:	5d                   	pop    %ebp
+  800be7:	c3                   	ret
+
+00800be8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bee:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bf2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bf5:	38 ca                	cmp    %cl,%dl
+  800bf7:	74 09                	je     800c02 <strfind+0x1a>
+  800bf9:	84 d2                	test   %dl,%dl
+  800bfb:	74 05                	je     800c02 <strfind+0x1a>
+	for (; *s; s++)
+  800bfd:	83 c0 01             	add    $0x1,%eax
+  800c00:	eb f0                	jmp    800bf2 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c02:	5d                   	pop    %ebp
+  800c03:	c3                   	ret
+
+00800c04 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c04:	55                   	push   %ebp
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	57                   	push   %edi
+  800c08:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c0b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c0e:	85 c9                	test   %ecx,%ecx
+  800c10:	74 20                	je     800c32 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c12:	89 f8                	mov    %edi,%eax
+  800c14:	09 c8                	or     %ecx,%eax
+  800c16:	a8 03                	test   $0x3,%al
+  800c18:	75 12                	jne    800c2c <memset+0x28>
+		c &= 0xFF;
+  800c1a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c1e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c24:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c27:	fc                   	cld
+  800c28:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c2a:	eb 06                	jmp    800c32 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c2f:	fc                   	cld
+  800c30:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c32:	89 f8                	mov    %edi,%eax
+  800c34:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c37:	c9                   	leave
+  800c38:	c3                   	ret
+
+00800c39 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c39:	55                   	push   %ebp
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	57                   	push   %edi
+  800c3d:	56                   	push   %esi
+  800c3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c41:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c44:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c47:	39 c6                	cmp    %eax,%esi
+  800c49:	73 32                	jae    800c7d <memmove+0x44>
+  800c4b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c4e:	39 d0                	cmp    %edx,%eax
+  800c50:	73 2b                	jae    800c7d <memmove+0x44>
+		s += n;
+		d += n;
+  800c52:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c55:	89 d6                	mov    %edx,%esi
+  800c57:	09 fe                	or     %edi,%esi
+  800c59:	09 ce                	or     %ecx,%esi
+  800c5b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c61:	75 0e                	jne    800c71 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c63:	83 ef 04             	sub    $0x4,%edi
+  800c66:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c69:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c6c:	fd                   	std
+  800c6d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c6f:	eb 09                	jmp    800c7a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c71:	83 ef 01             	sub    $0x1,%edi
+  800c74:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c77:	fd                   	std
+  800c78:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c7a:	fc                   	cld
+  800c7b:	eb 1a                	jmp    800c97 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c7d:	89 f2                	mov    %esi,%edx
+  800c7f:	09 c2                	or     %eax,%edx
+  800c81:	09 ca                	or     %ecx,%edx
+  800c83:	f6 c2 03             	test   $0x3,%dl
+  800c86:	75 0a                	jne    800c92 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c88:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c8b:	89 c7                	mov    %eax,%edi
+  800c8d:	fc                   	cld
+  800c8e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c90:	eb 05                	jmp    800c97 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c92:	89 c7                	mov    %eax,%edi
+  800c94:	fc                   	cld
+  800c95:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+
+00800c9b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ca1:	ff 75 10             	push   0x10(%ebp)
+  800ca4:	ff 75 0c             	push   0xc(%ebp)
+  800ca7:	ff 75 08             	push   0x8(%ebp)
+  800caa:	e8 8a ff ff ff       	call   800c39 <memmove>
+}
+  800caf:	c9                   	leave
+  800cb0:	c3                   	ret
+
+00800cb1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cb1:	55                   	push   %ebp
+  800cb2:	89 e5                	mov    %esp,%ebp
+  800cb4:	56                   	push   %esi
+  800cb5:	53                   	push   %ebx
+  800cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cbc:	89 c6                	mov    %eax,%esi
+  800cbe:	03 75 10             	add    0x10(%ebp),%esi
+  800cc1:	eb 06                	jmp    800cc9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cc3:	83 c0 01             	add    $0x1,%eax
+  800cc6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cc9:	39 f0                	cmp    %esi,%eax
+  800ccb:	74 14                	je     800ce1 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ccd:	0f b6 08             	movzbl (%eax),%ecx
+  800cd0:	0f b6 1a             	movzbl (%edx),%ebx
+  800cd3:	38 d9                	cmp    %bl,%cl
+  800cd5:	74 ec                	je     800cc3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800cd7:	0f b6 c1             	movzbl %cl,%eax
+  800cda:	0f b6 db             	movzbl %bl,%ebx
+  800cdd:	29 d8                	sub    %ebx,%eax
+  800cdf:	eb 05                	jmp    800ce6 <memcmp+0x35>
+	}
+
+	return 0;
+  800ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ce6:	5b                   	pop    %ebx
+  800ce7:	5e                   	pop    %esi
+  800ce8:	5d                   	pop    %ebp
+  800ce9:	c3                   	ret
+
+00800cea <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cf3:	89 c2                	mov    %eax,%edx
+  800cf5:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cf8:	eb 03                	jmp    800cfd <memfind+0x13>
+  800cfa:	83 c0 01             	add    $0x1,%eax
+  800cfd:	39 d0                	cmp    %edx,%eax
+  800cff:	73 04                	jae    800d05 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d01:	38 08                	cmp    %cl,(%eax)
+  800d03:	75 f5                	jne    800cfa <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d05:	5d                   	pop    %ebp
+  800d06:	c3                   	ret
+
+00800d07 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	57                   	push   %edi
+  800d0b:	56                   	push   %esi
+  800d0c:	53                   	push   %ebx
+  800d0d:	83 ec 1c             	sub    $0x1c,%esp
+  800d10:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d13:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d16:	eb 03                	jmp    800d1b <strtol+0x14>
+		s++;
+  800d18:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800d1b:	0f b6 06             	movzbl (%esi),%eax
+  800d1e:	3c 20                	cmp    $0x20,%al
+  800d20:	74 f6                	je     800d18 <strtol+0x11>
+  800d22:	3c 09                	cmp    $0x9,%al
+  800d24:	74 f2                	je     800d18 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d26:	3c 2b                	cmp    $0x2b,%al
+  800d28:	74 43                	je     800d6d <strtol+0x66>
+	int neg = 0;
+  800d2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800d2f:	3c 2d                	cmp    $0x2d,%al
+  800d31:	74 44                	je     800d77 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d33:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800d39:	75 0f                	jne    800d4a <strtol+0x43>
+  800d3b:	80 3e 30             	cmpb   $0x30,(%esi)
+  800d3e:	74 41                	je     800d81 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d40:	85 ff                	test   %edi,%edi
+  800d42:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d47:	0f 44 f8             	cmove  %eax,%edi
+  800d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800d54:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800d57:	89 fb                	mov    %edi,%ebx
+  800d59:	c1 fb 1f             	sar    $0x1f,%ebx
+  800d5c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800d5f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d62:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d65:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800d68:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d6b:	eb 67                	jmp    800dd4 <strtol+0xcd>
+		s++;
+  800d6d:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800d70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d75:	eb bc                	jmp    800d33 <strtol+0x2c>
+		s++, neg = 1;
+  800d77:	83 c6 01             	add    $0x1,%esi
+  800d7a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d7f:	eb b2                	jmp    800d33 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d81:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800d85:	74 0e                	je     800d95 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800d87:	85 ff                	test   %edi,%edi
+  800d89:	75 bf                	jne    800d4a <strtol+0x43>
+		s++, base = 8;
+  800d8b:	83 c6 01             	add    $0x1,%esi
+  800d8e:	bf 08 00 00 00       	mov    $0x8,%edi
+  800d93:	eb b5                	jmp    800d4a <strtol+0x43>
+		s += 2, base = 16;
+  800d95:	83 c6 02             	add    $0x2,%esi
+  800d98:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d9d:	eb ab                	jmp    800d4a <strtol+0x43>
+			dig = *s - '0';
+  800d9f:	0f be c9             	movsbl %cl,%ecx
+  800da2:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800da5:	39 f9                	cmp    %edi,%ecx
+  800da7:	7d 59                	jge    800e02 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800da9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800dad:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800db0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800db3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800db6:	0f af d8             	imul   %eax,%ebx
+  800db9:	0f af d7             	imul   %edi,%edx
+  800dbc:	01 d3                	add    %edx,%ebx
+  800dbe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800dc1:	f7 e7                	mul    %edi
+  800dc3:	01 da                	add    %ebx,%edx
+  800dc5:	89 cb                	mov    %ecx,%ebx
+  800dc7:	c1 fb 1f             	sar    $0x1f,%ebx
+  800dca:	01 c8                	add    %ecx,%eax
+  800dcc:	11 da                	adc    %ebx,%edx
+  800dce:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800dd1:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800dd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd7:	0f b6 08             	movzbl (%eax),%ecx
+  800dda:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800ddd:	80 fb 09             	cmp    $0x9,%bl
+  800de0:	76 bd                	jbe    800d9f <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800de2:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800de5:	80 fb 19             	cmp    $0x19,%bl
+  800de8:	77 08                	ja     800df2 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800dea:	0f be c9             	movsbl %cl,%ecx
+  800ded:	83 e9 57             	sub    $0x57,%ecx
+  800df0:	eb b3                	jmp    800da5 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800df2:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800df5:	80 fb 19             	cmp    $0x19,%bl
+  800df8:	77 08                	ja     800e02 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800dfa:	0f be c9             	movsbl %cl,%ecx
+  800dfd:	83 e9 37             	sub    $0x37,%ecx
+  800e00:	eb a3                	jmp    800da5 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e02:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800e05:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e08:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800e0b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e0e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e12:	74 05                	je     800e19 <strtol+0x112>
+		*endptr = (char *) s;
+  800e14:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e17:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800e19:	85 c9                	test   %ecx,%ecx
+  800e1b:	74 07                	je     800e24 <strtol+0x11d>
+  800e1d:	f7 d8                	neg    %eax
+  800e1f:	83 d2 00             	adc    $0x0,%edx
+  800e22:	f7 da                	neg    %edx
+}
+  800e24:	83 c4 1c             	add    $0x1c,%esp
+  800e27:	5b                   	pop    %ebx
+  800e28:	5e                   	pop    %esi
+  800e29:	5f                   	pop    %edi
+  800e2a:	5d                   	pop    %ebp
+  800e2b:	c3                   	ret
+
+00800e2c <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	57                   	push   %edi
+  800e30:	56                   	push   %esi
+  800e31:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e32:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800e39:	74 18                	je     800e53 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e46:	89 c3                	mov    %eax,%ebx
+  800e48:	89 c7                	mov    %eax,%edi
+  800e4a:	89 c6                	mov    %eax,%esi
+  800e4c:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5e:	89 c3                	mov    %eax,%ebx
+  800e60:	89 c7                	mov    %eax,%edi
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	8d 35 6d 0e 80 00    	lea    0x800e6d,%esi
+  800e6b:	0f 34                	sysenter
+  800e6d:	5d                   	pop    %ebp
+		goto out;
+  800e6e:	eb de                	jmp    800e4e <sys_cputs+0x22>
+
+00800e70 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e76:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800e7d:	74 19                	je     800e98 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e84:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e89:	89 d1                	mov    %edx,%ecx
+  800e8b:	89 d3                	mov    %edx,%ebx
+  800e8d:	89 d7                	mov    %edx,%edi
+  800e8f:	89 d6                	mov    %edx,%esi
+  800e91:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e93:	5b                   	pop    %ebx
+  800e94:	5e                   	pop    %esi
+  800e95:	5f                   	pop    %edi
+  800e96:	5d                   	pop    %ebp
+  800e97:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ea2:	89 d1                	mov    %edx,%ecx
+  800ea4:	89 d3                	mov    %edx,%ebx
+  800ea6:	89 d7                	mov    %edx,%edi
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	8d 35 b3 0e 80 00    	lea    0x800eb3,%esi
+  800eb1:	0f 34                	sysenter
+  800eb3:	5d                   	pop    %ebp
+		goto out;
+  800eb4:	eb dd                	jmp    800e93 <sys_cgetc+0x23>
+
+00800eb6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ebf:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800ec6:	74 21                	je     800ee9 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800ec8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ecd:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ed2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed5:	89 cb                	mov    %ecx,%ebx
+  800ed7:	89 cf                	mov    %ecx,%edi
+  800ed9:	89 ce                	mov    %ecx,%esi
+  800edb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800edd:	85 c0                	test   %eax,%eax
+  800edf:	7f 27                	jg     800f08 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ee1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee4:	5b                   	pop    %ebx
+  800ee5:	5e                   	pop    %esi
+  800ee6:	5f                   	pop    %edi
+  800ee7:	5d                   	pop    %ebp
+  800ee8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef1:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ef6:	89 cb                	mov    %ecx,%ebx
+  800ef8:	89 cf                	mov    %ecx,%edi
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	8d 35 05 0f 80 00    	lea    0x800f05,%esi
+  800f03:	0f 34                	sysenter
+  800f05:	5d                   	pop    %ebp
+		goto out;
+  800f06:	eb d5                	jmp    800edd <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f08:	83 ec 0c             	sub    $0xc,%esp
+  800f0b:	50                   	push   %eax
+  800f0c:	6a 03                	push   $0x3
+  800f0e:	68 4b 34 80 00       	push   $0x80344b
+  800f13:	6a 3f                	push   $0x3f
+  800f15:	68 68 34 80 00       	push   $0x803468
+  800f1a:	e8 71 f4 ff ff       	call   800390 <_panic>
+
+00800f1f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f25:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800f2c:	74 19                	je     800f47 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f33:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f38:	89 d1                	mov    %edx,%ecx
+  800f3a:	89 d3                	mov    %edx,%ebx
+  800f3c:	89 d7                	mov    %edx,%edi
+  800f3e:	89 d6                	mov    %edx,%esi
+  800f40:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f42:	5b                   	pop    %ebx
+  800f43:	5e                   	pop    %esi
+  800f44:	5f                   	pop    %edi
+  800f45:	5d                   	pop    %ebp
+  800f46:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f51:	89 d1                	mov    %edx,%ecx
+  800f53:	89 d3                	mov    %edx,%ebx
+  800f55:	89 d7                	mov    %edx,%edi
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	8d 35 62 0f 80 00    	lea    0x800f62,%esi
+  800f60:	0f 34                	sysenter
+  800f62:	5d                   	pop    %ebp
+		goto out;
+  800f63:	eb dd                	jmp    800f42 <sys_getenvid+0x23>
+
+00800f65 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f65:	55                   	push   %ebp
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	57                   	push   %edi
+  800f69:	56                   	push   %esi
+  800f6a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f6b:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800f72:	74 19                	je     800f8d <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f79:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f7e:	89 d1                	mov    %edx,%ecx
+  800f80:	89 d3                	mov    %edx,%ebx
+  800f82:	89 d7                	mov    %edx,%edi
+  800f84:	89 d6                	mov    %edx,%esi
+  800f86:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f92:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f97:	89 d1                	mov    %edx,%ecx
+  800f99:	89 d3                	mov    %edx,%ebx
+  800f9b:	89 d7                	mov    %edx,%edi
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	8d 35 a8 0f 80 00    	lea    0x800fa8,%esi
+  800fa6:	0f 34                	sysenter
+  800fa8:	5d                   	pop    %ebp
+		goto out;
+  800fa9:	eb dd                	jmp    800f88 <sys_yield+0x23>
+
+00800fab <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fab:	55                   	push   %ebp
+  800fac:	89 e5                	mov    %esp,%ebp
+  800fae:	57                   	push   %edi
+  800faf:	56                   	push   %esi
+  800fb0:	53                   	push   %ebx
+  800fb1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fb4:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800fbb:	74 23                	je     800fe0 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800fbd:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd0:	89 f7                	mov    %esi,%edi
+  800fd2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd4:	85 c0                	test   %eax,%eax
+  800fd6:	7f 29                	jg     801001 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdb:	5b                   	pop    %ebx
+  800fdc:	5e                   	pop    %esi
+  800fdd:	5f                   	pop    %edi
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800feb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	8d 35 fe 0f 80 00    	lea    0x800ffe,%esi
+  800ffc:	0f 34                	sysenter
+  800ffe:	5d                   	pop    %ebp
+		goto out;
+  800fff:	eb d3                	jmp    800fd4 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801001:	83 ec 0c             	sub    $0xc,%esp
+  801004:	50                   	push   %eax
+  801005:	6a 04                	push   $0x4
+  801007:	68 4b 34 80 00       	push   $0x80344b
+  80100c:	6a 3f                	push   $0x3f
+  80100e:	68 68 34 80 00       	push   $0x803468
+  801013:	e8 78 f3 ff ff       	call   800390 <_panic>
+
+00801018 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801018:	55                   	push   %ebp
+  801019:	89 e5                	mov    %esp,%ebp
+  80101b:	57                   	push   %edi
+  80101c:	56                   	push   %esi
+  80101d:	53                   	push   %ebx
+  80101e:	83 ec 0c             	sub    $0xc,%esp
+  801021:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  801024:	85 f6                	test   %esi,%esi
+  801026:	75 09                	jne    801031 <sys_page_map+0x19>
+  801028:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80102f:	74 1f                	je     801050 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  801031:	b8 05 00 00 00       	mov    $0x5,%eax
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801042:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801044:	85 c0                	test   %eax,%eax
+  801046:	7f 27                	jg     80106f <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801048:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104b:	5b                   	pop    %ebx
+  80104c:	5e                   	pop    %esi
+  80104d:	5f                   	pop    %edi
+  80104e:	5d                   	pop    %ebp
+  80104f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801056:	b8 05 00 00 00       	mov    $0x5,%eax
+  80105b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80105e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	8d 35 6c 10 80 00    	lea    0x80106c,%esi
+  80106a:	0f 34                	sysenter
+  80106c:	5d                   	pop    %ebp
+		goto out;
+  80106d:	eb d5                	jmp    801044 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	50                   	push   %eax
+  801073:	6a 05                	push   $0x5
+  801075:	68 4b 34 80 00       	push   $0x80344b
+  80107a:	6a 3f                	push   $0x3f
+  80107c:	68 68 34 80 00       	push   $0x803468
+  801081:	e8 0a f3 ff ff       	call   800390 <_panic>
+
+00801086 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80108f:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801096:	74 22                	je     8010ba <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801098:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109d:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	89 df                	mov    %ebx,%edi
+  8010aa:	89 de                	mov    %ebx,%esi
+  8010ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	7f 28                	jg     8010da <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8010b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010ca:	89 df                	mov    %ebx,%edi
+  8010cc:	55                   	push   %ebp
+  8010cd:	89 e5                	mov    %esp,%ebp
+  8010cf:	8d 35 d7 10 80 00    	lea    0x8010d7,%esi
+  8010d5:	0f 34                	sysenter
+  8010d7:	5d                   	pop    %ebp
+		goto out;
+  8010d8:	eb d4                	jmp    8010ae <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010da:	83 ec 0c             	sub    $0xc,%esp
+  8010dd:	50                   	push   %eax
+  8010de:	6a 06                	push   $0x6
+  8010e0:	68 4b 34 80 00       	push   $0x80344b
+  8010e5:	6a 3f                	push   $0x3f
+  8010e7:	68 68 34 80 00       	push   $0x803468
+  8010ec:	e8 9f f2 ff ff       	call   800390 <_panic>
+
+008010f1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+  8010f7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010fa:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801101:	74 22                	je     801125 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801103:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801108:	b8 08 00 00 00       	mov    $0x8,%eax
+  80110d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801110:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801113:	89 df                	mov    %ebx,%edi
+  801115:	89 de                	mov    %ebx,%esi
+  801117:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	7f 28                	jg     801145 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80111d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5f                   	pop    %edi
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801125:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801130:	b8 08 00 00 00       	mov    $0x8,%eax
+  801135:	89 df                	mov    %ebx,%edi
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	8d 35 42 11 80 00    	lea    0x801142,%esi
+  801140:	0f 34                	sysenter
+  801142:	5d                   	pop    %ebp
+		goto out;
+  801143:	eb d4                	jmp    801119 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801145:	83 ec 0c             	sub    $0xc,%esp
+  801148:	50                   	push   %eax
+  801149:	6a 08                	push   $0x8
+  80114b:	68 4b 34 80 00       	push   $0x80344b
+  801150:	6a 3f                	push   $0x3f
+  801152:	68 68 34 80 00       	push   $0x803468
+  801157:	e8 34 f2 ff ff       	call   800390 <_panic>
+
+0080115c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	57                   	push   %edi
+  801160:	56                   	push   %esi
+  801161:	53                   	push   %ebx
+  801162:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801165:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80116c:	74 22                	je     801190 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80116e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801173:	b8 09 00 00 00       	mov    $0x9,%eax
+  801178:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117e:	89 df                	mov    %ebx,%edi
+  801180:	89 de                	mov    %ebx,%esi
+  801182:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801184:	85 c0                	test   %eax,%eax
+  801186:	7f 28                	jg     8011b0 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118b:	5b                   	pop    %ebx
+  80118c:	5e                   	pop    %esi
+  80118d:	5f                   	pop    %edi
+  80118e:	5d                   	pop    %ebp
+  80118f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801190:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119b:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011a0:	89 df                	mov    %ebx,%edi
+  8011a2:	55                   	push   %ebp
+  8011a3:	89 e5                	mov    %esp,%ebp
+  8011a5:	8d 35 ad 11 80 00    	lea    0x8011ad,%esi
+  8011ab:	0f 34                	sysenter
+  8011ad:	5d                   	pop    %ebp
+		goto out;
+  8011ae:	eb d4                	jmp    801184 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b0:	83 ec 0c             	sub    $0xc,%esp
+  8011b3:	50                   	push   %eax
+  8011b4:	6a 09                	push   $0x9
+  8011b6:	68 4b 34 80 00       	push   $0x80344b
+  8011bb:	6a 3f                	push   $0x3f
+  8011bd:	68 68 34 80 00       	push   $0x803468
+  8011c2:	e8 c9 f1 ff ff       	call   800390 <_panic>
+
+008011c7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	57                   	push   %edi
+  8011cb:	56                   	push   %esi
+  8011cc:	53                   	push   %ebx
+  8011cd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011d0:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8011d7:	74 22                	je     8011fb <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8011d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011de:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e9:	89 df                	mov    %ebx,%edi
+  8011eb:	89 de                	mov    %ebx,%esi
+  8011ed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ef:	85 c0                	test   %eax,%eax
+  8011f1:	7f 28                	jg     80121b <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f6:	5b                   	pop    %ebx
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80120b:	89 df                	mov    %ebx,%edi
+  80120d:	55                   	push   %ebp
+  80120e:	89 e5                	mov    %esp,%ebp
+  801210:	8d 35 18 12 80 00    	lea    0x801218,%esi
+  801216:	0f 34                	sysenter
+  801218:	5d                   	pop    %ebp
+		goto out;
+  801219:	eb d4                	jmp    8011ef <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80121b:	83 ec 0c             	sub    $0xc,%esp
+  80121e:	50                   	push   %eax
+  80121f:	6a 0a                	push   $0xa
+  801221:	68 4b 34 80 00       	push   $0x80344b
+  801226:	6a 3f                	push   $0x3f
+  801228:	68 68 34 80 00       	push   $0x803468
+  80122d:	e8 5e f1 ff ff       	call   800390 <_panic>
+
+00801232 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	57                   	push   %edi
+  801236:	56                   	push   %esi
+  801237:	53                   	push   %ebx
+  801238:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80123b:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801242:	74 22                	je     801266 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801249:	b8 17 00 00 00       	mov    $0x17,%eax
+  80124e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801251:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801254:	89 df                	mov    %ebx,%edi
+  801256:	89 de                	mov    %ebx,%esi
+  801258:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	7f 28                	jg     801286 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80125e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801261:	5b                   	pop    %ebx
+  801262:	5e                   	pop    %esi
+  801263:	5f                   	pop    %edi
+  801264:	5d                   	pop    %ebp
+  801265:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801266:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801271:	b8 17 00 00 00       	mov    $0x17,%eax
+  801276:	89 df                	mov    %ebx,%edi
+  801278:	55                   	push   %ebp
+  801279:	89 e5                	mov    %esp,%ebp
+  80127b:	8d 35 83 12 80 00    	lea    0x801283,%esi
+  801281:	0f 34                	sysenter
+  801283:	5d                   	pop    %ebp
+		goto out;
+  801284:	eb d4                	jmp    80125a <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801286:	83 ec 0c             	sub    $0xc,%esp
+  801289:	50                   	push   %eax
+  80128a:	6a 17                	push   $0x17
+  80128c:	68 4b 34 80 00       	push   $0x80344b
+  801291:	6a 3f                	push   $0x3f
+  801293:	68 68 34 80 00       	push   $0x803468
+  801298:	e8 f3 f0 ff ff       	call   800390 <_panic>
+
+0080129d <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80129d:	55                   	push   %ebp
+  80129e:	89 e5                	mov    %esp,%ebp
+  8012a0:	57                   	push   %edi
+  8012a1:	56                   	push   %esi
+  8012a2:	53                   	push   %ebx
+  8012a3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012a6:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8012ad:	74 22                	je     8012d1 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8012af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bf:	89 df                	mov    %ebx,%edi
+  8012c1:	89 de                	mov    %ebx,%esi
+  8012c3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	7f 28                	jg     8012f1 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8012c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cc:	5b                   	pop    %ebx
+  8012cd:	5e                   	pop    %esi
+  8012ce:	5f                   	pop    %edi
+  8012cf:	5d                   	pop    %ebp
+  8012d0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dc:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012e1:	89 df                	mov    %ebx,%edi
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	8d 35 ee 12 80 00    	lea    0x8012ee,%esi
+  8012ec:	0f 34                	sysenter
+  8012ee:	5d                   	pop    %ebp
+		goto out;
+  8012ef:	eb d4                	jmp    8012c5 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f1:	83 ec 0c             	sub    $0xc,%esp
+  8012f4:	50                   	push   %eax
+  8012f5:	6a 18                	push   $0x18
+  8012f7:	68 4b 34 80 00       	push   $0x80344b
+  8012fc:	6a 3f                	push   $0x3f
+  8012fe:	68 68 34 80 00       	push   $0x803468
+  801303:	e8 88 f0 ff ff       	call   800390 <_panic>
+
+00801308 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801308:	55                   	push   %ebp
+  801309:	89 e5                	mov    %esp,%ebp
+  80130b:	57                   	push   %edi
+  80130c:	56                   	push   %esi
+  80130d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80130e:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801315:	74 1d                	je     801334 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801317:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80131c:	be 00 00 00 00       	mov    $0x0,%esi
+  801321:	8b 55 08             	mov    0x8(%ebp),%edx
+  801324:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801327:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80132a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80132d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80132f:	5b                   	pop    %ebx
+  801330:	5e                   	pop    %esi
+  801331:	5f                   	pop    %edi
+  801332:	5d                   	pop    %ebp
+  801333:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801334:	8b 55 08             	mov    0x8(%ebp),%edx
+  801337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80133f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801342:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	8d 35 50 13 80 00    	lea    0x801350,%esi
+  80134e:	0f 34                	sysenter
+  801350:	5d                   	pop    %ebp
+		goto out;
+  801351:	eb dc                	jmp    80132f <sys_ipc_try_send+0x27>
+
+00801353 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	57                   	push   %edi
+  801357:	56                   	push   %esi
+  801358:	53                   	push   %ebx
+  801359:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80135c:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801363:	74 21                	je     801386 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801365:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80136a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80136f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801372:	89 cb                	mov    %ecx,%ebx
+  801374:	89 cf                	mov    %ecx,%edi
+  801376:	89 ce                	mov    %ecx,%esi
+  801378:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80137a:	85 c0                	test   %eax,%eax
+  80137c:	7f 27                	jg     8013a5 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80137e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801381:	5b                   	pop    %ebx
+  801382:	5e                   	pop    %esi
+  801383:	5f                   	pop    %edi
+  801384:	5d                   	pop    %ebp
+  801385:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801386:	8b 55 08             	mov    0x8(%ebp),%edx
+  801389:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80138e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801393:	89 cb                	mov    %ecx,%ebx
+  801395:	89 cf                	mov    %ecx,%edi
+  801397:	55                   	push   %ebp
+  801398:	89 e5                	mov    %esp,%ebp
+  80139a:	8d 35 a2 13 80 00    	lea    0x8013a2,%esi
+  8013a0:	0f 34                	sysenter
+  8013a2:	5d                   	pop    %ebp
+		goto out;
+  8013a3:	eb d5                	jmp    80137a <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013a5:	83 ec 0c             	sub    $0xc,%esp
+  8013a8:	50                   	push   %eax
+  8013a9:	6a 0d                	push   $0xd
+  8013ab:	68 4b 34 80 00       	push   $0x80344b
+  8013b0:	6a 3f                	push   $0x3f
+  8013b2:	68 68 34 80 00       	push   $0x803468
+  8013b7:	e8 d4 ef ff ff       	call   800390 <_panic>
+
+008013bc <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8013bc:	55                   	push   %ebp
+  8013bd:	89 e5                	mov    %esp,%ebp
+  8013bf:	57                   	push   %edi
+  8013c0:	56                   	push   %esi
+  8013c1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013c2:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8013c9:	74 1b                	je     8013e6 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8013cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013db:	89 df                	mov    %ebx,%edi
+  8013dd:	89 de                	mov    %ebx,%esi
+  8013df:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8013e1:	5b                   	pop    %ebx
+  8013e2:	5e                   	pop    %esi
+  8013e3:	5f                   	pop    %edi
+  8013e4:	5d                   	pop    %ebp
+  8013e5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013f6:	89 df                	mov    %ebx,%edi
+  8013f8:	55                   	push   %ebp
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	8d 35 03 14 80 00    	lea    0x801403,%esi
+  801401:	0f 34                	sysenter
+  801403:	5d                   	pop    %ebp
+		goto out;
+  801404:	eb db                	jmp    8013e1 <sys_ipc_recv_until+0x25>
+
+00801406 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801406:	55                   	push   %ebp
+  801407:	89 e5                	mov    %esp,%ebp
+  801409:	57                   	push   %edi
+  80140a:	56                   	push   %esi
+  80140b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80140c:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801413:	74 19                	je     80142e <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801415:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80141f:	89 d1                	mov    %edx,%ecx
+  801421:	89 d3                	mov    %edx,%ebx
+  801423:	89 d7                	mov    %edx,%edi
+  801425:	89 d6                	mov    %edx,%esi
+  801427:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80142e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801433:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801438:	89 d1                	mov    %edx,%ecx
+  80143a:	89 d3                	mov    %edx,%ebx
+  80143c:	89 d7                	mov    %edx,%edi
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	8d 35 49 14 80 00    	lea    0x801449,%esi
+  801447:	0f 34                	sysenter
+  801449:	5d                   	pop    %ebp
+		goto out;
+  80144a:	eb dd                	jmp    801429 <sys_time_msec+0x23>
+
+0080144c <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80144c:	55                   	push   %ebp
+  80144d:	89 e5                	mov    %esp,%ebp
+  80144f:	57                   	push   %edi
+  801450:	56                   	push   %esi
+  801451:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801452:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801459:	74 1a                	je     801475 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80145b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801460:	b8 10 00 00 00       	mov    $0x10,%eax
+  801465:	8b 55 08             	mov    0x8(%ebp),%edx
+  801468:	89 cb                	mov    %ecx,%ebx
+  80146a:	89 cf                	mov    %ecx,%edi
+  80146c:	89 ce                	mov    %ecx,%esi
+  80146e:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5f                   	pop    %edi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801475:	8b 55 08             	mov    0x8(%ebp),%edx
+  801478:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80147d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801482:	89 cb                	mov    %ecx,%ebx
+  801484:	89 cf                	mov    %ecx,%edi
+  801486:	55                   	push   %ebp
+  801487:	89 e5                	mov    %esp,%ebp
+  801489:	8d 35 91 14 80 00    	lea    0x801491,%esi
+  80148f:	0f 34                	sysenter
+  801491:	5d                   	pop    %ebp
+		goto out;
+  801492:	eb dc                	jmp    801470 <sys_sleep_until+0x24>
+
+00801494 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	57                   	push   %edi
+  801498:	56                   	push   %esi
+  801499:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80149a:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8014a1:	74 1a                	je     8014bd <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8014a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	89 cb                	mov    %ecx,%ebx
+  8014b2:	89 cf                	mov    %ecx,%edi
+  8014b4:	89 ce                	mov    %ecx,%esi
+  8014b6:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8014b8:	5b                   	pop    %ebx
+  8014b9:	5e                   	pop    %esi
+  8014ba:	5f                   	pop    %edi
+  8014bb:	5d                   	pop    %ebp
+  8014bc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8014ca:	89 cb                	mov    %ecx,%ebx
+  8014cc:	89 cf                	mov    %ecx,%edi
+  8014ce:	55                   	push   %ebp
+  8014cf:	89 e5                	mov    %esp,%ebp
+  8014d1:	8d 35 d9 14 80 00    	lea    0x8014d9,%esi
+  8014d7:	0f 34                	sysenter
+  8014d9:	5d                   	pop    %ebp
+		goto out;
+  8014da:	eb dc                	jmp    8014b8 <sys_env_print_stats+0x24>
+
+008014dc <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8014dc:	55                   	push   %ebp
+  8014dd:	89 e5                	mov    %esp,%ebp
+  8014df:	57                   	push   %edi
+  8014e0:	56                   	push   %esi
+  8014e1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014e2:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8014e9:	74 1b                	je     801506 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8014eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f0:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014fb:	89 df                	mov    %ebx,%edi
+  8014fd:	89 de                	mov    %ebx,%esi
+  8014ff:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801501:	5b                   	pop    %ebx
+  801502:	5e                   	pop    %esi
+  801503:	5f                   	pop    %edi
+  801504:	5d                   	pop    %ebp
+  801505:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801506:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801511:	b8 19 00 00 00       	mov    $0x19,%eax
+  801516:	89 df                	mov    %ebx,%edi
+  801518:	55                   	push   %ebp
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	8d 35 23 15 80 00    	lea    0x801523,%esi
+  801521:	0f 34                	sysenter
+  801523:	5d                   	pop    %ebp
+		goto out;
+  801524:	eb db                	jmp    801501 <sys_perf+0x25>
+
+00801526 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801526:	55                   	push   %ebp
+  801527:	89 e5                	mov    %esp,%ebp
+  801529:	57                   	push   %edi
+  80152a:	56                   	push   %esi
+  80152b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80152c:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801533:	74 19                	je     80154e <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801535:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80153f:	89 d1                	mov    %edx,%ecx
+  801541:	89 d3                	mov    %edx,%ebx
+  801543:	89 d7                	mov    %edx,%edi
+  801545:	89 d6                	mov    %edx,%esi
+  801547:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801549:	5b                   	pop    %ebx
+  80154a:	5e                   	pop    %esi
+  80154b:	5f                   	pop    %edi
+  80154c:	5d                   	pop    %ebp
+  80154d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80154e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801553:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801558:	89 d1                	mov    %edx,%ecx
+  80155a:	89 d3                	mov    %edx,%ebx
+  80155c:	89 d7                	mov    %edx,%edi
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	8d 35 69 15 80 00    	lea    0x801569,%esi
+  801567:	0f 34                	sysenter
+  801569:	5d                   	pop    %ebp
+		goto out;
+  80156a:	eb dd                	jmp    801549 <sys_fork+0x23>
+
+0080156c <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80156c:	55                   	push   %ebp
+  80156d:	89 e5                	mov    %esp,%ebp
+  80156f:	57                   	push   %edi
+  801570:	56                   	push   %esi
+  801571:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801572:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801579:	74 1c                	je     801597 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80157b:	be 00 00 00 00       	mov    $0x0,%esi
+  801580:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801585:	8b 55 08             	mov    0x8(%ebp),%edx
+  801588:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80158b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158e:	89 f7                	mov    %esi,%edi
+  801590:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801592:	5b                   	pop    %ebx
+  801593:	5e                   	pop    %esi
+  801594:	5f                   	pop    %edi
+  801595:	5d                   	pop    %ebp
+  801596:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801597:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8015a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015aa:	55                   	push   %ebp
+  8015ab:	89 e5                	mov    %esp,%ebp
+  8015ad:	8d 35 b5 15 80 00    	lea    0x8015b5,%esi
+  8015b3:	0f 34                	sysenter
+  8015b5:	5d                   	pop    %ebp
+		goto out;
+  8015b6:	eb da                	jmp    801592 <sys_thread_create+0x26>
+
+008015b8 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8015b8:	55                   	push   %ebp
+  8015b9:	89 e5                	mov    %esp,%ebp
+  8015bb:	57                   	push   %edi
+  8015bc:	56                   	push   %esi
+  8015bd:	53                   	push   %ebx
+  8015be:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8015c1:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8015c8:	74 24                	je     8015ee <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8015ca:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8015cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015dd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015e2:	85 c0                	test   %eax,%eax
+  8015e4:	7f 27                	jg     80160d <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8015e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e9:	5b                   	pop    %ebx
+  8015ea:	5e                   	pop    %esi
+  8015eb:	5f                   	pop    %edi
+  8015ec:	5d                   	pop    %ebp
+  8015ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8015f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+  801602:	8d 35 0a 16 80 00    	lea    0x80160a,%esi
+  801608:	0f 34                	sysenter
+  80160a:	5d                   	pop    %ebp
+		goto out;
+  80160b:	eb d5                	jmp    8015e2 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80160d:	83 ec 0c             	sub    $0xc,%esp
+  801610:	50                   	push   %eax
+  801611:	6a 1f                	push   $0x1f
+  801613:	68 4b 34 80 00       	push   $0x80344b
+  801618:	6a 3f                	push   $0x3f
+  80161a:	68 68 34 80 00       	push   $0x803468
+  80161f:	e8 6c ed ff ff       	call   800390 <_panic>
+
+00801624 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801624:	55                   	push   %ebp
+  801625:	89 e5                	mov    %esp,%ebp
+  801627:	57                   	push   %edi
+  801628:	56                   	push   %esi
+  801629:	53                   	push   %ebx
+  80162a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80162d:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801634:	74 23                	je     801659 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801636:	be 00 00 00 00       	mov    $0x0,%esi
+  80163b:	b8 20 00 00 00       	mov    $0x20,%eax
+  801640:	8b 55 08             	mov    0x8(%ebp),%edx
+  801643:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801646:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801649:	89 f7                	mov    %esi,%edi
+  80164b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	7f 29                	jg     80167a <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801651:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801654:	5b                   	pop    %ebx
+  801655:	5e                   	pop    %esi
+  801656:	5f                   	pop    %edi
+  801657:	5d                   	pop    %ebp
+  801658:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801659:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165f:	b8 20 00 00 00       	mov    $0x20,%eax
+  801664:	bf 00 00 00 00       	mov    $0x0,%edi
+  801669:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80166c:	55                   	push   %ebp
+  80166d:	89 e5                	mov    %esp,%ebp
+  80166f:	8d 35 77 16 80 00    	lea    0x801677,%esi
+  801675:	0f 34                	sysenter
+  801677:	5d                   	pop    %ebp
+		goto out;
+  801678:	eb d3                	jmp    80164d <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80167a:	83 ec 0c             	sub    $0xc,%esp
+  80167d:	50                   	push   %eax
+  80167e:	6a 20                	push   $0x20
+  801680:	68 4b 34 80 00       	push   $0x80344b
+  801685:	6a 3f                	push   $0x3f
+  801687:	68 68 34 80 00       	push   $0x803468
+  80168c:	e8 ff ec ff ff       	call   800390 <_panic>
+
+00801691 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801691:	55                   	push   %ebp
+  801692:	89 e5                	mov    %esp,%ebp
+  801694:	57                   	push   %edi
+  801695:	56                   	push   %esi
+  801696:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801697:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80169e:	74 1b                	je     8016bb <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8016a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8016aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b0:	89 df                	mov    %ebx,%edi
+  8016b2:	89 de                	mov    %ebx,%esi
+  8016b4:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8016b6:	5b                   	pop    %ebx
+  8016b7:	5e                   	pop    %esi
+  8016b8:	5f                   	pop    %edi
+  8016b9:	5d                   	pop    %ebp
+  8016ba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8016cb:	89 df                	mov    %ebx,%edi
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	8d 35 d8 16 80 00    	lea    0x8016d8,%esi
+  8016d6:	0f 34                	sysenter
+  8016d8:	5d                   	pop    %ebp
+		goto out;
+  8016d9:	eb db                	jmp    8016b6 <sys_batch+0x25>
+
+008016db <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8016db:	55                   	push   %ebp
+  8016dc:	89 e5                	mov    %esp,%ebp
+  8016de:	57                   	push   %edi
+  8016df:	56                   	push   %esi
+  8016e0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016e1:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8016e8:	74 1a                	je     801704 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8016ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ef:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8016f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f7:	89 cb                	mov    %ecx,%ebx
+  8016f9:	89 cf                	mov    %ecx,%edi
+  8016fb:	89 ce                	mov    %ecx,%esi
+  8016fd:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8016ff:	5b                   	pop    %ebx
+  801700:	5e                   	pop    %esi
+  801701:	5f                   	pop    %edi
+  801702:	5d                   	pop    %ebp
+  801703:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801704:	8b 55 08             	mov    0x8(%ebp),%edx
+  801707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80170c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801711:	89 cb                	mov    %ecx,%ebx
+  801713:	89 cf                	mov    %ecx,%edi
+  801715:	55                   	push   %ebp
+  801716:	89 e5                	mov    %esp,%ebp
+  801718:	8d 35 20 17 80 00    	lea    0x801720,%esi
+  80171e:	0f 34                	sysenter
+  801720:	5d                   	pop    %ebp
+		goto out;
+  801721:	eb dc                	jmp    8016ff <sys_trace_ctl+0x24>
+
+00801723 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801723:	55                   	push   %ebp
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	57                   	push   %edi
+  801727:	56                   	push   %esi
+  801728:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801729:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801730:	74 1c                	je     80174e <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801732:	be 00 00 00 00       	mov    $0x0,%esi
+  801737:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80173c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801742:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801745:	89 f7                	mov    %esi,%edi
+  801747:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801749:	5b                   	pop    %ebx
+  80174a:	5e                   	pop    %esi
+  80174b:	5f                   	pop    %edi
+  80174c:	5d                   	pop    %ebp
+  80174d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80174e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801751:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801754:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801759:	bf 00 00 00 00       	mov    $0x0,%edi
+  80175e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	8d 35 6c 17 80 00    	lea    0x80176c,%esi
+  80176a:	0f 34                	sysenter
+  80176c:	5d                   	pop    %ebp
+		goto out;
+  80176d:	eb da                	jmp    801749 <sys_trace_read+0x26>
+
+0080176f <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	57                   	push   %edi
+  801773:	56                   	push   %esi
+  801774:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801775:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80177c:	74 1c                	je     80179a <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80177e:	be 00 00 00 00       	mov    $0x0,%esi
+  801783:	b8 21 00 00 00       	mov    $0x21,%eax
+  801788:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801791:	89 f7                	mov    %esi,%edi
+  801793:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801795:	5b                   	pop    %ebx
+  801796:	5e                   	pop    %esi
+  801797:	5f                   	pop    %edi
+  801798:	5d                   	pop    %ebp
+  801799:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80179a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a0:	b8 21 00 00 00       	mov    $0x21,%eax
+  8017a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017ad:	55                   	push   %ebp
+  8017ae:	89 e5                	mov    %esp,%ebp
+  8017b0:	8d 35 b8 17 80 00    	lea    0x8017b8,%esi
+  8017b6:	0f 34                	sysenter
+  8017b8:	5d                   	pop    %ebp
+		goto out;
+  8017b9:	eb da                	jmp    801795 <sys_meminfo+0x26>
+
+008017bb <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8017bb:	55                   	push   %ebp
+  8017bc:	89 e5                	mov    %esp,%ebp
+  8017be:	57                   	push   %edi
+  8017bf:	56                   	push   %esi
+  8017c0:	53                   	push   %ebx
+  8017c1:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8017c4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8017c8:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8017cf:	74 1f                	je     8017f0 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8017d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d6:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017de:	89 df                	mov    %ebx,%edi
+  8017e0:	89 de                	mov    %ebx,%esi
+  8017e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017e4:	85 c0                	test   %eax,%eax
+  8017e6:	7f 25                	jg     80180d <sys_env_set_ksm+0x52>
+}
+  8017e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017eb:	5b                   	pop    %ebx
+  8017ec:	5e                   	pop    %esi
+  8017ed:	5f                   	pop    %edi
+  8017ee:	5d                   	pop    %ebp
+  8017ef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f8:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017fd:	89 df                	mov    %ebx,%edi
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	8d 35 0a 18 80 00    	lea    0x80180a,%esi
+  801808:	0f 34                	sysenter
+  80180a:	5d                   	pop    %ebp
+		goto out;
+  80180b:	eb d7                	jmp    8017e4 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80180d:	83 ec 0c             	sub    $0xc,%esp
+  801810:	50                   	push   %eax
+  801811:	6a 22                	push   $0x22
+  801813:	68 4b 34 80 00       	push   $0x80344b
+  801818:	6a 3f                	push   $0x3f
+  80181a:	68 68 34 80 00       	push   $0x803468
+  80181f:	e8 6c eb ff ff       	call   800390 <_panic>
+
+00801824 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801824:	55                   	push   %ebp
+  801825:	89 e5                	mov    %esp,%ebp
+  801827:	57                   	push   %edi
+  801828:	56                   	push   %esi
+  801829:	53                   	push   %ebx
+  80182a:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80182d:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801830:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801837:	74 24                	je     80185d <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801839:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80183e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801843:	89 cb                	mov    %ecx,%ebx
+  801845:	89 cf                	mov    %ecx,%edi
+  801847:	89 ce                	mov    %ecx,%esi
+  801849:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	7f 2a                	jg     801879 <sys_time_nsec+0x55>
+	return ns;
+}
+  80184f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801852:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801855:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801858:	5b                   	pop    %ebx
+  801859:	5e                   	pop    %esi
+  80185a:	5f                   	pop    %edi
+  80185b:	5d                   	pop    %ebp
+  80185c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80185d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801862:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801867:	89 cb                	mov    %ecx,%ebx
+  801869:	89 cf                	mov    %ecx,%edi
+  80186b:	55                   	push   %ebp
+  80186c:	89 e5                	mov    %esp,%ebp
+  80186e:	8d 35 76 18 80 00    	lea    0x801876,%esi
+  801874:	0f 34                	sysenter
+  801876:	5d                   	pop    %ebp
+		goto out;
+  801877:	eb d2                	jmp    80184b <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801879:	83 ec 0c             	sub    $0xc,%esp
+  80187c:	50                   	push   %eax
+  80187d:	6a 0f                	push   $0xf
+  80187f:	68 4b 34 80 00       	push   $0x80344b
+  801884:	6a 3f                	push   $0x3f
+  801886:	68 68 34 80 00       	push   $0x803468
+  80188b:	e8 00 eb ff ff       	call   800390 <_panic>
+
+00801890 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801890:	55                   	push   %ebp
+  801891:	89 e5                	mov    %esp,%ebp
+  801893:	57                   	push   %edi
+  801894:	56                   	push   %esi
+  801895:	53                   	push   %ebx
+  801896:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801899:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8018a0:	74 22                	je     8018c4 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8018a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8018ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b2:	89 df                	mov    %ebx,%edi
+  8018b4:	89 de                	mov    %ebx,%esi
+  8018b6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018b8:	85 c0                	test   %eax,%eax
+  8018ba:	7f 28                	jg     8018e4 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8018bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018bf:	5b                   	pop    %ebx
+  8018c0:	5e                   	pop    %esi
+  8018c1:	5f                   	pop    %edi
+  8018c2:	5d                   	pop    %ebp
+  8018c3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018cf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8018d4:	89 df                	mov    %ebx,%edi
+  8018d6:	55                   	push   %ebp
+  8018d7:	89 e5                	mov    %esp,%ebp
+  8018d9:	8d 35 e1 18 80 00    	lea    0x8018e1,%esi
+  8018df:	0f 34                	sysenter
+  8018e1:	5d                   	pop    %ebp
+		goto out;
+  8018e2:	eb d4                	jmp    8018b8 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018e4:	83 ec 0c             	sub    $0xc,%esp
+  8018e7:	50                   	push   %eax
+  8018e8:	6a 12                	push   $0x12
+  8018ea:	68 4b 34 80 00       	push   $0x80344b
+  8018ef:	6a 3f                	push   $0x3f
+  8018f1:	68 68 34 80 00       	push   $0x803468
+  8018f6:	e8 95 ea ff ff       	call   800390 <_panic>
+
+008018fb <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8018fb:	55                   	push   %ebp
+  8018fc:	89 e5                	mov    %esp,%ebp
+  8018fe:	57                   	push   %edi
+  8018ff:	56                   	push   %esi
+  801900:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801901:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801908:	74 1b                	je     801925 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80190a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801914:	8b 55 08             	mov    0x8(%ebp),%edx
+  801917:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80191a:	89 df                	mov    %ebx,%edi
+  80191c:	89 de                	mov    %ebx,%esi
+  80191e:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801920:	5b                   	pop    %ebx
+  801921:	5e                   	pop    %esi
+  801922:	5f                   	pop    %edi
+  801923:	5d                   	pop    %ebp
+  801924:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801925:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801930:	b8 13 00 00 00       	mov    $0x13,%eax
+  801935:	89 df                	mov    %ebx,%edi
+  801937:	55                   	push   %ebp
+  801938:	89 e5                	mov    %esp,%ebp
+  80193a:	8d 35 42 19 80 00    	lea    0x801942,%esi
+  801940:	0f 34                	sysenter
+  801942:	5d                   	pop    %ebp
+		goto out;
+  801943:	eb db                	jmp    801920 <sys_e1000_receive+0x25>
+
+00801945 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801945:	55                   	push   %ebp
+  801946:	89 e5                	mov    %esp,%ebp
+  801948:	57                   	push   %edi
+  801949:	56                   	push   %esi
+  80194a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80194b:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801952:	74 1b                	je     80196f <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801954:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801959:	b8 14 00 00 00       	mov    $0x14,%eax
+  80195e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801961:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801964:	89 df                	mov    %ebx,%edi
+  801966:	89 de                	mov    %ebx,%esi
+  801968:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80196a:	5b                   	pop    %ebx
+  80196b:	5e                   	pop    %esi
+  80196c:	5f                   	pop    %edi
+  80196d:	5d                   	pop    %ebp
+  80196e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80196f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801974:	8b 55 08             	mov    0x8(%ebp),%edx
+  801977:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80197a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80197f:	89 df                	mov    %ebx,%edi
+  801981:	55                   	push   %ebp
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	8d 35 8c 19 80 00    	lea    0x80198c,%esi
+  80198a:	0f 34                	sysenter
+  80198c:	5d                   	pop    %ebp
+		goto out;
+  80198d:	eb db                	jmp    80196a <sys_e1000_read_hwaddr+0x25>
+
+0080198f <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80198f:	55                   	push   %ebp
+  801990:	89 e5                	mov    %esp,%ebp
+  801992:	57                   	push   %edi
+  801993:	56                   	push   %esi
+  801994:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801995:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80199c:	74 1a                	je     8019b8 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80199e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019a3:	b8 15 00 00 00       	mov    $0x15,%eax
+  8019a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ab:	89 cb                	mov    %ecx,%ebx
+  8019ad:	89 cf                	mov    %ecx,%edi
+  8019af:	89 ce                	mov    %ecx,%esi
+  8019b1:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8019b3:	5b                   	pop    %ebx
+  8019b4:	5e                   	pop    %esi
+  8019b5:	5f                   	pop    %edi
+  8019b6:	5d                   	pop    %ebp
+  8019b7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019c0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8019c5:	89 cb                	mov    %ecx,%ebx
+  8019c7:	89 cf                	mov    %ecx,%edi
+  8019c9:	55                   	push   %ebp
+  8019ca:	89 e5                	mov    %esp,%ebp
+  8019cc:	8d 35 d4 19 80 00    	lea    0x8019d4,%esi
+  8019d2:	0f 34                	sysenter
+  8019d4:	5d                   	pop    %ebp
+		goto out;
+  8019d5:	eb dc                	jmp    8019b3 <sys_sb16_read_version+0x24>
+
+008019d7 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8019d7:	55                   	push   %ebp
+  8019d8:	89 e5                	mov    %esp,%ebp
+  8019da:	57                   	push   %edi
+  8019db:	56                   	push   %esi
+  8019dc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019dd:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8019e4:	74 1b                	je     801a01 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8019e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019eb:	b8 16 00 00 00       	mov    $0x16,%eax
+  8019f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f6:	89 df                	mov    %ebx,%edi
+  8019f8:	89 de                	mov    %ebx,%esi
+  8019fa:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8019fc:	5b                   	pop    %ebx
+  8019fd:	5e                   	pop    %esi
+  8019fe:	5f                   	pop    %edi
+  8019ff:	5d                   	pop    %ebp
+  801a00:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a0c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801a11:	89 df                	mov    %ebx,%edi
+  801a13:	55                   	push   %ebp
+  801a14:	89 e5                	mov    %esp,%ebp
+  801a16:	8d 35 1e 1a 80 00    	lea    0x801a1e,%esi
+  801a1c:	0f 34                	sysenter
+  801a1e:	5d                   	pop    %ebp
+		goto out;
+  801a1f:	eb db                	jmp    8019fc <sys_sb16_play+0x25>
+
+00801a21 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801a21:	55                   	push   %ebp
+  801a22:	89 e5                	mov    %esp,%ebp
+  801a24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a2a:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801a2d:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801a2f:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801a32:	83 3a 01             	cmpl   $0x1,(%edx)
+  801a35:	7e 09                	jle    801a40 <argstart+0x1f>
+  801a37:	ba a8 30 80 00       	mov    $0x8030a8,%edx
+  801a3c:	85 c9                	test   %ecx,%ecx
+  801a3e:	75 05                	jne    801a45 <argstart+0x24>
+  801a40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a45:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  801a48:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801a4f:	5d                   	pop    %ebp
+  801a50:	c3                   	ret
+
+00801a51 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801a51:	55                   	push   %ebp
+  801a52:	89 e5                	mov    %esp,%ebp
+  801a54:	53                   	push   %ebx
+  801a55:	83 ec 04             	sub    $0x4,%esp
+  801a58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  801a5b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  801a62:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	74 74                	je     801add <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  801a69:	80 38 00             	cmpb   $0x0,(%eax)
+  801a6c:	75 48                	jne    801ab6 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  801a6e:	8b 0b                	mov    (%ebx),%ecx
+  801a70:	83 39 01             	cmpl   $0x1,(%ecx)
+  801a73:	74 5a                	je     801acf <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  801a75:	8b 53 04             	mov    0x4(%ebx),%edx
+  801a78:	8b 42 04             	mov    0x4(%edx),%eax
+  801a7b:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801a7e:	75 4f                	jne    801acf <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  801a80:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801a84:	74 49                	je     801acf <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  801a86:	83 c0 01             	add    $0x1,%eax
+  801a89:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801a8c:	83 ec 04             	sub    $0x4,%esp
+  801a8f:	8b 01                	mov    (%ecx),%eax
+  801a91:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801a98:	50                   	push   %eax
+  801a99:	8d 42 08             	lea    0x8(%edx),%eax
+  801a9c:	50                   	push   %eax
+  801a9d:	83 c2 04             	add    $0x4,%edx
+  801aa0:	52                   	push   %edx
+  801aa1:	e8 93 f1 ff ff       	call   800c39 <memmove>
+		(*args->argc)--;
+  801aa6:	8b 03                	mov    (%ebx),%eax
+  801aa8:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801aab:	8b 43 08             	mov    0x8(%ebx),%eax
+  801aae:	83 c4 10             	add    $0x10,%esp
+  801ab1:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801ab4:	74 13                	je     801ac9 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  801ab6:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ab9:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801abc:	83 c0 01             	add    $0x1,%eax
+  801abf:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801ac2:	89 d0                	mov    %edx,%eax
+  801ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac7:	c9                   	leave
+  801ac8:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801ac9:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801acd:	75 e7                	jne    801ab6 <argnext+0x65>
+	args->curarg = 0;
+  801acf:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  801ad6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801adb:	eb e5                	jmp    801ac2 <argnext+0x71>
+		return -1;
+  801add:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801ae2:	eb de                	jmp    801ac2 <argnext+0x71>
+
+00801ae4 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801ae4:	55                   	push   %ebp
+  801ae5:	89 e5                	mov    %esp,%ebp
+  801ae7:	53                   	push   %ebx
+  801ae8:	83 ec 04             	sub    $0x4,%esp
+  801aeb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  801aee:	8b 43 08             	mov    0x8(%ebx),%eax
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	74 12                	je     801b07 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  801af5:	80 38 00             	cmpb   $0x0,(%eax)
+  801af8:	74 12                	je     801b0c <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  801afa:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801afd:	c7 43 08 a8 30 80 00 	movl   $0x8030a8,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801b04:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801b07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0a:	c9                   	leave
+  801b0b:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801b0c:	8b 13                	mov    (%ebx),%edx
+  801b0e:	83 3a 01             	cmpl   $0x1,(%edx)
+  801b11:	7f 10                	jg     801b23 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801b13:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  801b1a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801b21:	eb e1                	jmp    801b04 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801b23:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b26:	8b 48 04             	mov    0x4(%eax),%ecx
+  801b29:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801b2c:	83 ec 04             	sub    $0x4,%esp
+  801b2f:	8b 12                	mov    (%edx),%edx
+  801b31:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  801b38:	52                   	push   %edx
+  801b39:	8d 50 08             	lea    0x8(%eax),%edx
+  801b3c:	52                   	push   %edx
+  801b3d:	83 c0 04             	add    $0x4,%eax
+  801b40:	50                   	push   %eax
+  801b41:	e8 f3 f0 ff ff       	call   800c39 <memmove>
+		(*args->argc)--;
+  801b46:	8b 03                	mov    (%ebx),%eax
+  801b48:	83 28 01             	subl   $0x1,(%eax)
+  801b4b:	83 c4 10             	add    $0x10,%esp
+  801b4e:	eb b4                	jmp    801b04 <argnextvalue+0x20>
+
+00801b50 <argvalue>:
+{
+  801b50:	55                   	push   %ebp
+  801b51:	89 e5                	mov    %esp,%ebp
+  801b53:	83 ec 08             	sub    $0x8,%esp
+  801b56:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801b59:	8b 42 0c             	mov    0xc(%edx),%eax
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	74 02                	je     801b62 <argvalue+0x12>
+}
+  801b60:	c9                   	leave
+  801b61:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  801b62:	83 ec 0c             	sub    $0xc,%esp
+  801b65:	52                   	push   %edx
+  801b66:	e8 79 ff ff ff       	call   801ae4 <argnextvalue>
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	eb f0                	jmp    801b60 <argvalue+0x10>
+
+00801b70 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801b70:	55                   	push   %ebp
+  801b71:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b76:	05 00 00 00 30       	add    $0x30000000,%eax
+  801b7b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801b7e:	5d                   	pop    %ebp
+  801b7f:	c3                   	ret
+
+00801b80 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b86:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801b8b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801b90:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801b95:	5d                   	pop    %ebp
+  801b96:	c3                   	ret
+
+00801b97 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801b97:	55                   	push   %ebp
+  801b98:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801b9a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801b9f:	eb 02                	jmp    801ba3 <fd_alloc+0xc>
+  801ba1:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801ba3:	89 c2                	mov    %eax,%edx
+  801ba5:	c1 ea 16             	shr    $0x16,%edx
+  801ba8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801baf:	f6 c2 01             	test   $0x1,%dl
+  801bb2:	74 2b                	je     801bdf <fd_alloc+0x48>
+  801bb4:	89 c2                	mov    %eax,%edx
+  801bb6:	c1 ea 0c             	shr    $0xc,%edx
+  801bb9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801bc0:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801bc6:	f6 c1 01             	test   $0x1,%cl
+  801bc9:	74 14                	je     801bdf <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801bcb:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801bd1:	75 ce                	jne    801ba1 <fd_alloc+0xa>
+  801bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801bd8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801bdd:	eb 05                	jmp    801be4 <fd_alloc+0x4d>
+			return 0;
+  801bdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801be4:	8b 55 08             	mov    0x8(%ebp),%edx
+  801be7:	89 02                	mov    %eax,(%edx)
+}
+  801be9:	89 c8                	mov    %ecx,%eax
+  801beb:	5d                   	pop    %ebp
+  801bec:	c3                   	ret
+
+00801bed <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801bed:	55                   	push   %ebp
+  801bee:	89 e5                	mov    %esp,%ebp
+  801bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801bf3:	83 f8 1f             	cmp    $0x1f,%eax
+  801bf6:	77 30                	ja     801c28 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801bf8:	c1 e0 0c             	shl    $0xc,%eax
+  801bfb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801c00:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c06:	f6 c2 01             	test   $0x1,%dl
+  801c09:	74 24                	je     801c2f <fd_lookup+0x42>
+  801c0b:	89 c2                	mov    %eax,%edx
+  801c0d:	c1 ea 0c             	shr    $0xc,%edx
+  801c10:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c17:	f6 c2 01             	test   $0x1,%dl
+  801c1a:	74 1a                	je     801c36 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c1f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c26:	5d                   	pop    %ebp
+  801c27:	c3                   	ret
+		return -E_INVAL;
+  801c28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c2d:	eb f7                	jmp    801c26 <fd_lookup+0x39>
+		return -E_INVAL;
+  801c2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c34:	eb f0                	jmp    801c26 <fd_lookup+0x39>
+  801c36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c3b:	eb e9                	jmp    801c26 <fd_lookup+0x39>
+
+00801c3d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c3d:	55                   	push   %ebp
+  801c3e:	89 e5                	mov    %esp,%ebp
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 04             	sub    $0x4,%esp
+  801c44:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4c:	eb 03                	jmp    801c51 <dev_lookup+0x14>
+  801c4e:	83 c0 01             	add    $0x1,%eax
+  801c51:	8b 1c 85 f4 34 80 00 	mov    0x8034f4(,%eax,4),%ebx
+  801c58:	85 db                	test   %ebx,%ebx
+  801c5a:	74 0b                	je     801c67 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801c5c:	39 13                	cmp    %edx,(%ebx)
+  801c5e:	75 ee                	jne    801c4e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c65:	eb 2e                	jmp    801c95 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801c67:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c69:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801c6e:	8b 0d 20 54 80 00    	mov    0x805420,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c74:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c79:	76 24                	jbe    801c9f <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c7b:	8b 41 48             	mov    0x48(%ecx),%eax
+  801c7e:	83 ec 04             	sub    $0x4,%esp
+  801c81:	52                   	push   %edx
+  801c82:	50                   	push   %eax
+  801c83:	68 78 34 80 00       	push   $0x803478
+  801c88:	e8 de e7 ff ff       	call   80046b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801c95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c98:	89 1a                	mov    %ebx,(%edx)
+}
+  801c9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c9d:	c9                   	leave
+  801c9e:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c9f:	c1 e8 10             	shr    $0x10,%eax
+  801ca2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ca8:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801cae:	eb cb                	jmp    801c7b <dev_lookup+0x3e>
+
+00801cb0 <fd_close>:
+{
+  801cb0:	55                   	push   %ebp
+  801cb1:	89 e5                	mov    %esp,%ebp
+  801cb3:	57                   	push   %edi
+  801cb4:	56                   	push   %esi
+  801cb5:	53                   	push   %ebx
+  801cb6:	83 ec 24             	sub    $0x24,%esp
+  801cb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cbc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801cbf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cc2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801cc3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801cc9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ccc:	50                   	push   %eax
+  801ccd:	e8 1b ff ff ff       	call   801bed <fd_lookup>
+  801cd2:	89 c3                	mov    %eax,%ebx
+  801cd4:	83 c4 10             	add    $0x10,%esp
+  801cd7:	85 c0                	test   %eax,%eax
+  801cd9:	78 05                	js     801ce0 <fd_close+0x30>
+	    || fd != fd2)
+  801cdb:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801cde:	74 16                	je     801cf6 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ce0:	89 f8                	mov    %edi,%eax
+  801ce2:	84 c0                	test   %al,%al
+  801ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce9:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801cec:	89 d8                	mov    %ebx,%eax
+  801cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf1:	5b                   	pop    %ebx
+  801cf2:	5e                   	pop    %esi
+  801cf3:	5f                   	pop    %edi
+  801cf4:	5d                   	pop    %ebp
+  801cf5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cf6:	83 ec 08             	sub    $0x8,%esp
+  801cf9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801cfc:	50                   	push   %eax
+  801cfd:	ff 36                	push   (%esi)
+  801cff:	e8 39 ff ff ff       	call   801c3d <dev_lookup>
+  801d04:	89 c3                	mov    %eax,%ebx
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	78 1a                	js     801d27 <fd_close+0x77>
+		if (dev->dev_close)
+  801d0d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d10:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d13:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	74 0b                	je     801d27 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801d1c:	83 ec 0c             	sub    $0xc,%esp
+  801d1f:	56                   	push   %esi
+  801d20:	ff d0                	call   *%eax
+  801d22:	89 c3                	mov    %eax,%ebx
+  801d24:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d27:	83 ec 08             	sub    $0x8,%esp
+  801d2a:	56                   	push   %esi
+  801d2b:	6a 00                	push   $0x0
+  801d2d:	e8 54 f3 ff ff       	call   801086 <sys_page_unmap>
+	return r;
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	eb b5                	jmp    801cec <fd_close+0x3c>
+
+00801d37 <close>:
+
+int
+close(int fdnum)
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d40:	50                   	push   %eax
+  801d41:	ff 75 08             	push   0x8(%ebp)
+  801d44:	e8 a4 fe ff ff       	call   801bed <fd_lookup>
+  801d49:	83 c4 10             	add    $0x10,%esp
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	79 02                	jns    801d52 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d50:	c9                   	leave
+  801d51:	c3                   	ret
+		return fd_close(fd, 1);
+  801d52:	83 ec 08             	sub    $0x8,%esp
+  801d55:	6a 01                	push   $0x1
+  801d57:	ff 75 f4             	push   -0xc(%ebp)
+  801d5a:	e8 51 ff ff ff       	call   801cb0 <fd_close>
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	eb ec                	jmp    801d50 <close+0x19>
+
+00801d64 <close_all>:
+
+void
+close_all(void)
+{
+  801d64:	55                   	push   %ebp
+  801d65:	89 e5                	mov    %esp,%ebp
+  801d67:	53                   	push   %ebx
+  801d68:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801d6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801d70:	83 ec 0c             	sub    $0xc,%esp
+  801d73:	53                   	push   %ebx
+  801d74:	e8 be ff ff ff       	call   801d37 <close>
+	for (i = 0; i < MAXFD; i++)
+  801d79:	83 c3 01             	add    $0x1,%ebx
+  801d7c:	83 c4 10             	add    $0x10,%esp
+  801d7f:	83 fb 20             	cmp    $0x20,%ebx
+  801d82:	75 ec                	jne    801d70 <close_all+0xc>
+}
+  801d84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d87:	c9                   	leave
+  801d88:	c3                   	ret
+
+00801d89 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	57                   	push   %edi
+  801d8d:	56                   	push   %esi
+  801d8e:	53                   	push   %ebx
+  801d8f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801d92:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d95:	50                   	push   %eax
+  801d96:	ff 75 08             	push   0x8(%ebp)
+  801d99:	e8 4f fe ff ff       	call   801bed <fd_lookup>
+  801d9e:	89 c3                	mov    %eax,%ebx
+  801da0:	83 c4 10             	add    $0x10,%esp
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	78 7f                	js     801e26 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801da7:	83 ec 0c             	sub    $0xc,%esp
+  801daa:	ff 75 0c             	push   0xc(%ebp)
+  801dad:	e8 85 ff ff ff       	call   801d37 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801db2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801db5:	c1 e6 0c             	shl    $0xc,%esi
+  801db8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801dbe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801dc1:	89 3c 24             	mov    %edi,(%esp)
+  801dc4:	e8 b7 fd ff ff       	call   801b80 <fd2data>
+  801dc9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801dcb:	89 34 24             	mov    %esi,(%esp)
+  801dce:	e8 ad fd ff ff       	call   801b80 <fd2data>
+  801dd3:	83 c4 10             	add    $0x10,%esp
+  801dd6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801dd9:	89 d8                	mov    %ebx,%eax
+  801ddb:	c1 e8 16             	shr    $0x16,%eax
+  801dde:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801de5:	a8 01                	test   $0x1,%al
+  801de7:	74 11                	je     801dfa <dup+0x71>
+  801de9:	89 d8                	mov    %ebx,%eax
+  801deb:	c1 e8 0c             	shr    $0xc,%eax
+  801dee:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801df5:	f6 c2 01             	test   $0x1,%dl
+  801df8:	75 36                	jne    801e30 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801dfa:	89 f8                	mov    %edi,%eax
+  801dfc:	c1 e8 0c             	shr    $0xc,%eax
+  801dff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e06:	83 ec 0c             	sub    $0xc,%esp
+  801e09:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e0e:	50                   	push   %eax
+  801e0f:	56                   	push   %esi
+  801e10:	6a 00                	push   $0x0
+  801e12:	57                   	push   %edi
+  801e13:	6a 00                	push   $0x0
+  801e15:	e8 fe f1 ff ff       	call   801018 <sys_page_map>
+  801e1a:	89 c3                	mov    %eax,%ebx
+  801e1c:	83 c4 20             	add    $0x20,%esp
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	78 33                	js     801e56 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e26:	89 d8                	mov    %ebx,%eax
+  801e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e2b:	5b                   	pop    %ebx
+  801e2c:	5e                   	pop    %esi
+  801e2d:	5f                   	pop    %edi
+  801e2e:	5d                   	pop    %ebp
+  801e2f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e30:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e37:	83 ec 0c             	sub    $0xc,%esp
+  801e3a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e3f:	50                   	push   %eax
+  801e40:	ff 75 d4             	push   -0x2c(%ebp)
+  801e43:	6a 00                	push   $0x0
+  801e45:	53                   	push   %ebx
+  801e46:	6a 00                	push   $0x0
+  801e48:	e8 cb f1 ff ff       	call   801018 <sys_page_map>
+  801e4d:	89 c3                	mov    %eax,%ebx
+  801e4f:	83 c4 20             	add    $0x20,%esp
+  801e52:	85 c0                	test   %eax,%eax
+  801e54:	79 a4                	jns    801dfa <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e56:	83 ec 08             	sub    $0x8,%esp
+  801e59:	56                   	push   %esi
+  801e5a:	6a 00                	push   $0x0
+  801e5c:	e8 25 f2 ff ff       	call   801086 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e61:	83 c4 08             	add    $0x8,%esp
+  801e64:	ff 75 d4             	push   -0x2c(%ebp)
+  801e67:	6a 00                	push   $0x0
+  801e69:	e8 18 f2 ff ff       	call   801086 <sys_page_unmap>
+	return r;
+  801e6e:	83 c4 10             	add    $0x10,%esp
+  801e71:	eb b3                	jmp    801e26 <dup+0x9d>
+
+00801e73 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	56                   	push   %esi
+  801e77:	53                   	push   %ebx
+  801e78:	83 ec 18             	sub    $0x18,%esp
+  801e7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e7e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e81:	50                   	push   %eax
+  801e82:	53                   	push   %ebx
+  801e83:	e8 65 fd ff ff       	call   801bed <fd_lookup>
+  801e88:	83 c4 10             	add    $0x10,%esp
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	78 3c                	js     801ecb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e8f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e92:	83 ec 08             	sub    $0x8,%esp
+  801e95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e98:	50                   	push   %eax
+  801e99:	ff 36                	push   (%esi)
+  801e9b:	e8 9d fd ff ff       	call   801c3d <dev_lookup>
+  801ea0:	83 c4 10             	add    $0x10,%esp
+  801ea3:	85 c0                	test   %eax,%eax
+  801ea5:	78 24                	js     801ecb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ea7:	8b 46 08             	mov    0x8(%esi),%eax
+  801eaa:	83 e0 03             	and    $0x3,%eax
+  801ead:	83 f8 01             	cmp    $0x1,%eax
+  801eb0:	74 20                	je     801ed2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801eb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eb5:	8b 40 08             	mov    0x8(%eax),%eax
+  801eb8:	85 c0                	test   %eax,%eax
+  801eba:	74 57                	je     801f13 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ebc:	83 ec 04             	sub    $0x4,%esp
+  801ebf:	ff 75 10             	push   0x10(%ebp)
+  801ec2:	ff 75 0c             	push   0xc(%ebp)
+  801ec5:	56                   	push   %esi
+  801ec6:	ff d0                	call   *%eax
+  801ec8:	83 c4 10             	add    $0x10,%esp
+}
+  801ecb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ece:	5b                   	pop    %ebx
+  801ecf:	5e                   	pop    %esi
+  801ed0:	5d                   	pop    %ebp
+  801ed1:	c3                   	ret
+  801ed2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ed4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ed9:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801edf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ee4:	76 1c                	jbe    801f02 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ee6:	8b 42 48             	mov    0x48(%edx),%eax
+  801ee9:	83 ec 04             	sub    $0x4,%esp
+  801eec:	53                   	push   %ebx
+  801eed:	50                   	push   %eax
+  801eee:	68 b9 34 80 00       	push   $0x8034b9
+  801ef3:	e8 73 e5 ff ff       	call   80046b <cprintf>
+		return -E_INVAL;
+  801ef8:	83 c4 10             	add    $0x10,%esp
+  801efb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f00:	eb c9                	jmp    801ecb <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801f02:	c1 e8 10             	shr    $0x10,%eax
+  801f05:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f0b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f11:	eb d3                	jmp    801ee6 <read+0x73>
+		return -E_NOT_SUPP;
+  801f13:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f18:	eb b1                	jmp    801ecb <read+0x58>
+
+00801f1a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f1a:	55                   	push   %ebp
+  801f1b:	89 e5                	mov    %esp,%ebp
+  801f1d:	57                   	push   %edi
+  801f1e:	56                   	push   %esi
+  801f1f:	53                   	push   %ebx
+  801f20:	83 ec 0c             	sub    $0xc,%esp
+  801f23:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f26:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f2e:	eb 02                	jmp    801f32 <readn+0x18>
+  801f30:	01 c3                	add    %eax,%ebx
+  801f32:	39 f3                	cmp    %esi,%ebx
+  801f34:	73 21                	jae    801f57 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f36:	83 ec 04             	sub    $0x4,%esp
+  801f39:	89 f0                	mov    %esi,%eax
+  801f3b:	29 d8                	sub    %ebx,%eax
+  801f3d:	50                   	push   %eax
+  801f3e:	89 d8                	mov    %ebx,%eax
+  801f40:	03 45 0c             	add    0xc(%ebp),%eax
+  801f43:	50                   	push   %eax
+  801f44:	57                   	push   %edi
+  801f45:	e8 29 ff ff ff       	call   801e73 <read>
+		if (m < 0)
+  801f4a:	83 c4 10             	add    $0x10,%esp
+  801f4d:	85 c0                	test   %eax,%eax
+  801f4f:	78 04                	js     801f55 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801f51:	75 dd                	jne    801f30 <readn+0x16>
+  801f53:	eb 02                	jmp    801f57 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f55:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801f57:	89 d8                	mov    %ebx,%eax
+  801f59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f5c:	5b                   	pop    %ebx
+  801f5d:	5e                   	pop    %esi
+  801f5e:	5f                   	pop    %edi
+  801f5f:	5d                   	pop    %ebp
+  801f60:	c3                   	ret
+
+00801f61 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f61:	55                   	push   %ebp
+  801f62:	89 e5                	mov    %esp,%ebp
+  801f64:	56                   	push   %esi
+  801f65:	53                   	push   %ebx
+  801f66:	83 ec 18             	sub    $0x18,%esp
+  801f69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f6c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f6f:	50                   	push   %eax
+  801f70:	53                   	push   %ebx
+  801f71:	e8 77 fc ff ff       	call   801bed <fd_lookup>
+  801f76:	83 c4 10             	add    $0x10,%esp
+  801f79:	85 c0                	test   %eax,%eax
+  801f7b:	78 37                	js     801fb4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f7d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f80:	83 ec 08             	sub    $0x8,%esp
+  801f83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f86:	50                   	push   %eax
+  801f87:	ff 36                	push   (%esi)
+  801f89:	e8 af fc ff ff       	call   801c3d <dev_lookup>
+  801f8e:	83 c4 10             	add    $0x10,%esp
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	78 1f                	js     801fb4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f95:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f99:	74 20                	je     801fbb <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801f9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	74 57                	je     801ffc <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801fa5:	83 ec 04             	sub    $0x4,%esp
+  801fa8:	ff 75 10             	push   0x10(%ebp)
+  801fab:	ff 75 0c             	push   0xc(%ebp)
+  801fae:	56                   	push   %esi
+  801faf:	ff d0                	call   *%eax
+  801fb1:	83 c4 10             	add    $0x10,%esp
+}
+  801fb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb7:	5b                   	pop    %ebx
+  801fb8:	5e                   	pop    %esi
+  801fb9:	5d                   	pop    %ebp
+  801fba:	c3                   	ret
+  801fbb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fbd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801fc2:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fc8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801fcd:	76 1c                	jbe    801feb <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fcf:	8b 42 48             	mov    0x48(%edx),%eax
+  801fd2:	83 ec 04             	sub    $0x4,%esp
+  801fd5:	53                   	push   %ebx
+  801fd6:	50                   	push   %eax
+  801fd7:	68 d5 34 80 00       	push   $0x8034d5
+  801fdc:	e8 8a e4 ff ff       	call   80046b <cprintf>
+		return -E_INVAL;
+  801fe1:	83 c4 10             	add    $0x10,%esp
+  801fe4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe9:	eb c9                	jmp    801fb4 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801feb:	c1 e8 10             	shr    $0x10,%eax
+  801fee:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ff4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ffa:	eb d3                	jmp    801fcf <write+0x6e>
+		return -E_NOT_SUPP;
+  801ffc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802001:	eb b1                	jmp    801fb4 <write+0x53>
+
+00802003 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802003:	55                   	push   %ebp
+  802004:	89 e5                	mov    %esp,%ebp
+  802006:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802009:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80200c:	50                   	push   %eax
+  80200d:	ff 75 08             	push   0x8(%ebp)
+  802010:	e8 d8 fb ff ff       	call   801bed <fd_lookup>
+  802015:	83 c4 10             	add    $0x10,%esp
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	78 0e                	js     80202a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80201c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80201f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802022:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802025:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80202a:	c9                   	leave
+  80202b:	c3                   	ret
+
+0080202c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	56                   	push   %esi
+  802030:	53                   	push   %ebx
+  802031:	83 ec 18             	sub    $0x18,%esp
+  802034:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802037:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80203a:	50                   	push   %eax
+  80203b:	53                   	push   %ebx
+  80203c:	e8 ac fb ff ff       	call   801bed <fd_lookup>
+  802041:	83 c4 10             	add    $0x10,%esp
+  802044:	85 c0                	test   %eax,%eax
+  802046:	78 34                	js     80207c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802048:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80204b:	83 ec 08             	sub    $0x8,%esp
+  80204e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802051:	50                   	push   %eax
+  802052:	ff 36                	push   (%esi)
+  802054:	e8 e4 fb ff ff       	call   801c3d <dev_lookup>
+  802059:	83 c4 10             	add    $0x10,%esp
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	78 1c                	js     80207c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802060:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802064:	74 1d                	je     802083 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802066:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802069:	8b 40 18             	mov    0x18(%eax),%eax
+  80206c:	85 c0                	test   %eax,%eax
+  80206e:	74 54                	je     8020c4 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802070:	83 ec 08             	sub    $0x8,%esp
+  802073:	ff 75 0c             	push   0xc(%ebp)
+  802076:	56                   	push   %esi
+  802077:	ff d0                	call   *%eax
+  802079:	83 c4 10             	add    $0x10,%esp
+}
+  80207c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80207f:	5b                   	pop    %ebx
+  802080:	5e                   	pop    %esi
+  802081:	5d                   	pop    %ebp
+  802082:	c3                   	ret
+  802083:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802085:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80208a:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802090:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802095:	76 1c                	jbe    8020b3 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802097:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80209a:	83 ec 04             	sub    $0x4,%esp
+  80209d:	53                   	push   %ebx
+  80209e:	50                   	push   %eax
+  80209f:	68 98 34 80 00       	push   $0x803498
+  8020a4:	e8 c2 e3 ff ff       	call   80046b <cprintf>
+		return -E_INVAL;
+  8020a9:	83 c4 10             	add    $0x10,%esp
+  8020ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b1:	eb c9                	jmp    80207c <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8020b3:	c1 e8 10             	shr    $0x10,%eax
+  8020b6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8020bc:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8020c2:	eb d3                	jmp    802097 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8020c4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020c9:	eb b1                	jmp    80207c <ftruncate+0x50>
+
+008020cb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8020cb:	55                   	push   %ebp
+  8020cc:	89 e5                	mov    %esp,%ebp
+  8020ce:	56                   	push   %esi
+  8020cf:	53                   	push   %ebx
+  8020d0:	83 ec 18             	sub    $0x18,%esp
+  8020d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020d9:	50                   	push   %eax
+  8020da:	ff 75 08             	push   0x8(%ebp)
+  8020dd:	e8 0b fb ff ff       	call   801bed <fd_lookup>
+  8020e2:	83 c4 10             	add    $0x10,%esp
+  8020e5:	85 c0                	test   %eax,%eax
+  8020e7:	78 49                	js     802132 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020e9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020ec:	83 ec 08             	sub    $0x8,%esp
+  8020ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020f2:	50                   	push   %eax
+  8020f3:	ff 36                	push   (%esi)
+  8020f5:	e8 43 fb ff ff       	call   801c3d <dev_lookup>
+  8020fa:	83 c4 10             	add    $0x10,%esp
+  8020fd:	85 c0                	test   %eax,%eax
+  8020ff:	78 31                	js     802132 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802101:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802104:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802108:	74 2f                	je     802139 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80210a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80210d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802114:	00 00 00 
+	stat->st_isdir = 0;
+  802117:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80211e:	00 00 00 
+	stat->st_dev = dev;
+  802121:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802127:	83 ec 08             	sub    $0x8,%esp
+  80212a:	53                   	push   %ebx
+  80212b:	56                   	push   %esi
+  80212c:	ff 50 14             	call   *0x14(%eax)
+  80212f:	83 c4 10             	add    $0x10,%esp
+}
+  802132:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802135:	5b                   	pop    %ebx
+  802136:	5e                   	pop    %esi
+  802137:	5d                   	pop    %ebp
+  802138:	c3                   	ret
+		return -E_NOT_SUPP;
+  802139:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80213e:	eb f2                	jmp    802132 <fstat+0x67>
+
+00802140 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	56                   	push   %esi
+  802144:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802145:	83 ec 08             	sub    $0x8,%esp
+  802148:	6a 00                	push   $0x0
+  80214a:	ff 75 08             	push   0x8(%ebp)
+  80214d:	e8 e4 01 00 00       	call   802336 <open>
+  802152:	89 c3                	mov    %eax,%ebx
+  802154:	83 c4 10             	add    $0x10,%esp
+  802157:	85 c0                	test   %eax,%eax
+  802159:	78 1b                	js     802176 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80215b:	83 ec 08             	sub    $0x8,%esp
+  80215e:	ff 75 0c             	push   0xc(%ebp)
+  802161:	50                   	push   %eax
+  802162:	e8 64 ff ff ff       	call   8020cb <fstat>
+  802167:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802169:	89 1c 24             	mov    %ebx,(%esp)
+  80216c:	e8 c6 fb ff ff       	call   801d37 <close>
+	return r;
+  802171:	83 c4 10             	add    $0x10,%esp
+  802174:	89 f3                	mov    %esi,%ebx
+}
+  802176:	89 d8                	mov    %ebx,%eax
+  802178:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80217b:	5b                   	pop    %ebx
+  80217c:	5e                   	pop    %esi
+  80217d:	5d                   	pop    %ebp
+  80217e:	c3                   	ret
+
+0080217f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	56                   	push   %esi
+  802183:	53                   	push   %ebx
+  802184:	89 c6                	mov    %eax,%esi
+  802186:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802188:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80218f:	74 27                	je     8021b8 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802191:	6a 07                	push   $0x7
+  802193:	68 00 60 80 00       	push   $0x806000
+  802198:	56                   	push   %esi
+  802199:	ff 35 00 50 80 00    	push   0x805000
+  80219f:	e8 c6 0d 00 00       	call   802f6a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8021a4:	83 c4 0c             	add    $0xc,%esp
+  8021a7:	6a 00                	push   $0x0
+  8021a9:	53                   	push   %ebx
+  8021aa:	6a 00                	push   $0x0
+  8021ac:	e8 a1 0d 00 00       	call   802f52 <ipc_recv>
+}
+  8021b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b4:	5b                   	pop    %ebx
+  8021b5:	5e                   	pop    %esi
+  8021b6:	5d                   	pop    %ebp
+  8021b7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021b8:	83 ec 0c             	sub    $0xc,%esp
+  8021bb:	6a 01                	push   $0x1
+  8021bd:	e8 fc 0d 00 00       	call   802fbe <ipc_find_env>
+  8021c2:	a3 00 50 80 00       	mov    %eax,0x805000
+  8021c7:	83 c4 10             	add    $0x10,%esp
+  8021ca:	eb c5                	jmp    802191 <fsipc+0x12>
+
+008021cc <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8021cc:	55                   	push   %ebp
+  8021cd:	89 e5                	mov    %esp,%ebp
+  8021cf:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021d8:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8021dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021e0:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8021e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ea:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021ef:	e8 8b ff ff ff       	call   80217f <fsipc>
+}
+  8021f4:	c9                   	leave
+  8021f5:	c3                   	ret
+
+008021f6 <devfile_flush>:
+{
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  802202:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802207:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802211:	e8 69 ff ff ff       	call   80217f <fsipc>
+}
+  802216:	c9                   	leave
+  802217:	c3                   	ret
+
+00802218 <devfile_stat>:
+{
+  802218:	55                   	push   %ebp
+  802219:	89 e5                	mov    %esp,%ebp
+  80221b:	53                   	push   %ebx
+  80221c:	83 ec 04             	sub    $0x4,%esp
+  80221f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802222:	8b 45 08             	mov    0x8(%ebp),%eax
+  802225:	8b 40 0c             	mov    0xc(%eax),%eax
+  802228:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80222d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802232:	b8 05 00 00 00       	mov    $0x5,%eax
+  802237:	e8 43 ff ff ff       	call   80217f <fsipc>
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	78 2c                	js     80226c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802240:	83 ec 08             	sub    $0x8,%esp
+  802243:	68 00 60 80 00       	push   $0x806000
+  802248:	53                   	push   %ebx
+  802249:	e8 65 e8 ff ff       	call   800ab3 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80224e:	a1 80 60 80 00       	mov    0x806080,%eax
+  802253:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802259:	a1 84 60 80 00       	mov    0x806084,%eax
+  80225e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802264:	83 c4 10             	add    $0x10,%esp
+  802267:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80226c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80226f:	c9                   	leave
+  802270:	c3                   	ret
+
+00802271 <devfile_write>:
+{
+  802271:	55                   	push   %ebp
+  802272:	89 e5                	mov    %esp,%ebp
+  802274:	83 ec 0c             	sub    $0xc,%esp
+  802277:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80227a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80227d:	8b 52 0c             	mov    0xc(%edx),%edx
+  802280:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802286:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80228b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802290:	39 d0                	cmp    %edx,%eax
+  802292:	0f 47 c2             	cmova  %edx,%eax
+  802295:	50                   	push   %eax
+  802296:	ff 75 0c             	push   0xc(%ebp)
+  802299:	68 08 60 80 00       	push   $0x806008
+  80229e:	e8 96 e9 ff ff       	call   800c39 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8022a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022ad:	e8 cd fe ff ff       	call   80217f <fsipc>
+}
+  8022b2:	c9                   	leave
+  8022b3:	c3                   	ret
+
+008022b4 <devfile_read>:
+{
+  8022b4:	55                   	push   %ebp
+  8022b5:	89 e5                	mov    %esp,%ebp
+  8022b7:	56                   	push   %esi
+  8022b8:	53                   	push   %ebx
+  8022b9:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c2:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8022c7:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8022cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022d7:	e8 a3 fe ff ff       	call   80217f <fsipc>
+  8022dc:	89 c3                	mov    %eax,%ebx
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	78 1f                	js     802301 <devfile_read+0x4d>
+	assert(r <= n);
+  8022e2:	39 c6                	cmp    %eax,%esi
+  8022e4:	72 24                	jb     80230a <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8022e6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022eb:	7f 33                	jg     802320 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022ed:	83 ec 04             	sub    $0x4,%esp
+  8022f0:	50                   	push   %eax
+  8022f1:	68 00 60 80 00       	push   $0x806000
+  8022f6:	ff 75 0c             	push   0xc(%ebp)
+  8022f9:	e8 3b e9 ff ff       	call   800c39 <memmove>
+	return r;
+  8022fe:	83 c4 10             	add    $0x10,%esp
+}
+  802301:	89 d8                	mov    %ebx,%eax
+  802303:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802306:	5b                   	pop    %ebx
+  802307:	5e                   	pop    %esi
+  802308:	5d                   	pop    %ebp
+  802309:	c3                   	ret
+	assert(r <= n);
+  80230a:	68 08 35 80 00       	push   $0x803508
+  80230f:	68 0f 35 80 00       	push   $0x80350f
+  802314:	6a 76                	push   $0x76
+  802316:	68 24 35 80 00       	push   $0x803524
+  80231b:	e8 70 e0 ff ff       	call   800390 <_panic>
+	assert(r <= PGSIZE);
+  802320:	68 2f 35 80 00       	push   $0x80352f
+  802325:	68 0f 35 80 00       	push   $0x80350f
+  80232a:	6a 77                	push   $0x77
+  80232c:	68 24 35 80 00       	push   $0x803524
+  802331:	e8 5a e0 ff ff       	call   800390 <_panic>
+
+00802336 <open>:
+{
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	56                   	push   %esi
+  80233a:	53                   	push   %ebx
+  80233b:	83 ec 1c             	sub    $0x1c,%esp
+  80233e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802341:	56                   	push   %esi
+  802342:	e8 31 e7 ff ff       	call   800a78 <strlen>
+  802347:	83 c4 10             	add    $0x10,%esp
+  80234a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80234f:	7f 6c                	jg     8023bd <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802351:	83 ec 0c             	sub    $0xc,%esp
+  802354:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802357:	50                   	push   %eax
+  802358:	e8 3a f8 ff ff       	call   801b97 <fd_alloc>
+  80235d:	89 c3                	mov    %eax,%ebx
+  80235f:	83 c4 10             	add    $0x10,%esp
+  802362:	85 c0                	test   %eax,%eax
+  802364:	78 3c                	js     8023a2 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802366:	83 ec 08             	sub    $0x8,%esp
+  802369:	56                   	push   %esi
+  80236a:	68 00 60 80 00       	push   $0x806000
+  80236f:	e8 3f e7 ff ff       	call   800ab3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802374:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802377:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80237c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80237f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802384:	e8 f6 fd ff ff       	call   80217f <fsipc>
+  802389:	89 c3                	mov    %eax,%ebx
+  80238b:	83 c4 10             	add    $0x10,%esp
+  80238e:	85 c0                	test   %eax,%eax
+  802390:	78 19                	js     8023ab <open+0x75>
+	return fd2num(fd);
+  802392:	83 ec 0c             	sub    $0xc,%esp
+  802395:	ff 75 f4             	push   -0xc(%ebp)
+  802398:	e8 d3 f7 ff ff       	call   801b70 <fd2num>
+  80239d:	89 c3                	mov    %eax,%ebx
+  80239f:	83 c4 10             	add    $0x10,%esp
+}
+  8023a2:	89 d8                	mov    %ebx,%eax
+  8023a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023a7:	5b                   	pop    %ebx
+  8023a8:	5e                   	pop    %esi
+  8023a9:	5d                   	pop    %ebp
+  8023aa:	c3                   	ret
+		fd_close(fd, 0);
+  8023ab:	83 ec 08             	sub    $0x8,%esp
+  8023ae:	6a 00                	push   $0x0
+  8023b0:	ff 75 f4             	push   -0xc(%ebp)
+  8023b3:	e8 f8 f8 ff ff       	call   801cb0 <fd_close>
+		return r;
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	eb e5                	jmp    8023a2 <open+0x6c>
+		return -E_BAD_PATH;
+  8023bd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023c2:	eb de                	jmp    8023a2 <open+0x6c>
+
+008023c4 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8023ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023cf:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023d4:	e8 a6 fd ff ff       	call   80217f <fsipc>
+}
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+
+008023db <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8023db:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8023df:	7f 01                	jg     8023e2 <writebuf+0x7>
+  8023e1:	c3                   	ret
+{
+  8023e2:	55                   	push   %ebp
+  8023e3:	89 e5                	mov    %esp,%ebp
+  8023e5:	53                   	push   %ebx
+  8023e6:	83 ec 08             	sub    $0x8,%esp
+  8023e9:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8023eb:	ff 70 04             	push   0x4(%eax)
+  8023ee:	8d 40 10             	lea    0x10(%eax),%eax
+  8023f1:	50                   	push   %eax
+  8023f2:	ff 33                	push   (%ebx)
+  8023f4:	e8 68 fb ff ff       	call   801f61 <write>
+		if (result > 0)
+  8023f9:	83 c4 10             	add    $0x10,%esp
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	7e 03                	jle    802403 <writebuf+0x28>
+			b->result += result;
+  802400:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802403:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802406:	74 0d                	je     802415 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802408:	85 c0                	test   %eax,%eax
+  80240a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80240f:	0f 4f c2             	cmovg  %edx,%eax
+  802412:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802418:	c9                   	leave
+  802419:	c3                   	ret
+
+0080241a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80241a:	55                   	push   %ebp
+  80241b:	89 e5                	mov    %esp,%ebp
+  80241d:	53                   	push   %ebx
+  80241e:	83 ec 04             	sub    $0x4,%esp
+  802421:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802424:	8b 53 04             	mov    0x4(%ebx),%edx
+  802427:	8d 42 01             	lea    0x1(%edx),%eax
+  80242a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80242d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802430:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802434:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802439:	74 05                	je     802440 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80243b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80243e:	c9                   	leave
+  80243f:	c3                   	ret
+		writebuf(b);
+  802440:	89 d8                	mov    %ebx,%eax
+  802442:	e8 94 ff ff ff       	call   8023db <writebuf>
+		b->idx = 0;
+  802447:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80244e:	eb eb                	jmp    80243b <putch+0x21>
+
+00802450 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802450:	55                   	push   %ebp
+  802451:	89 e5                	mov    %esp,%ebp
+  802453:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80245c:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802462:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802469:	00 00 00 
+	b.result = 0;
+  80246c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802473:	00 00 00 
+	b.error = 1;
+  802476:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80247d:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  802480:	ff 75 10             	push   0x10(%ebp)
+  802483:	ff 75 0c             	push   0xc(%ebp)
+  802486:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80248c:	50                   	push   %eax
+  80248d:	68 1a 24 80 00       	push   $0x80241a
+  802492:	e8 b2 e0 ff ff       	call   800549 <vprintfmt>
+	if (b.idx > 0)
+  802497:	83 c4 10             	add    $0x10,%esp
+  80249a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8024a1:	7f 12                	jg     8024b5 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8024a3:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8024a9:	85 c0                	test   %eax,%eax
+  8024ab:	75 06                	jne    8024b3 <vfprintf+0x63>
+  8024ad:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8024b3:	c9                   	leave
+  8024b4:	c3                   	ret
+		writebuf(&b);
+  8024b5:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8024bb:	e8 1b ff ff ff       	call   8023db <writebuf>
+  8024c0:	eb e1                	jmp    8024a3 <vfprintf+0x53>
+
+008024c2 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8024c2:	55                   	push   %ebp
+  8024c3:	89 e5                	mov    %esp,%ebp
+  8024c5:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8024c8:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8024cb:	50                   	push   %eax
+  8024cc:	ff 75 0c             	push   0xc(%ebp)
+  8024cf:	ff 75 08             	push   0x8(%ebp)
+  8024d2:	e8 79 ff ff ff       	call   802450 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8024d7:	c9                   	leave
+  8024d8:	c3                   	ret
+
+008024d9 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8024d9:	55                   	push   %ebp
+  8024da:	89 e5                	mov    %esp,%ebp
+  8024dc:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8024df:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8024e2:	50                   	push   %eax
+  8024e3:	ff 75 08             	push   0x8(%ebp)
+  8024e6:	6a 01                	push   $0x1
+  8024e8:	e8 63 ff ff ff       	call   802450 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8024ed:	c9                   	leave
+  8024ee:	c3                   	ret
+
+008024ef <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024ef:	55                   	push   %ebp
+  8024f0:	89 e5                	mov    %esp,%ebp
+  8024f2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8024f5:	68 3b 35 80 00       	push   $0x80353b
+  8024fa:	ff 75 0c             	push   0xc(%ebp)
+  8024fd:	e8 b1 e5 ff ff       	call   800ab3 <strcpy>
+	return 0;
+}
+  802502:	b8 00 00 00 00       	mov    $0x0,%eax
+  802507:	c9                   	leave
+  802508:	c3                   	ret
+
+00802509 <devsock_close>:
+{
+  802509:	55                   	push   %ebp
+  80250a:	89 e5                	mov    %esp,%ebp
+  80250c:	53                   	push   %ebx
+  80250d:	83 ec 10             	sub    $0x10,%esp
+  802510:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802513:	53                   	push   %ebx
+  802514:	e8 e4 0a 00 00       	call   802ffd <pageref>
+  802519:	89 c2                	mov    %eax,%edx
+  80251b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80251e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802523:	83 fa 01             	cmp    $0x1,%edx
+  802526:	74 05                	je     80252d <devsock_close+0x24>
+}
+  802528:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80252b:	c9                   	leave
+  80252c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80252d:	83 ec 0c             	sub    $0xc,%esp
+  802530:	ff 73 0c             	push   0xc(%ebx)
+  802533:	e8 b7 02 00 00       	call   8027ef <nsipc_close>
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	eb eb                	jmp    802528 <devsock_close+0x1f>
+
+0080253d <devsock_write>:
+{
+  80253d:	55                   	push   %ebp
+  80253e:	89 e5                	mov    %esp,%ebp
+  802540:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802543:	6a 00                	push   $0x0
+  802545:	ff 75 10             	push   0x10(%ebp)
+  802548:	ff 75 0c             	push   0xc(%ebp)
+  80254b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80254e:	ff 70 0c             	push   0xc(%eax)
+  802551:	e8 79 03 00 00       	call   8028cf <nsipc_send>
+}
+  802556:	c9                   	leave
+  802557:	c3                   	ret
+
+00802558 <devsock_read>:
+{
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80255e:	6a 00                	push   $0x0
+  802560:	ff 75 10             	push   0x10(%ebp)
+  802563:	ff 75 0c             	push   0xc(%ebp)
+  802566:	8b 45 08             	mov    0x8(%ebp),%eax
+  802569:	ff 70 0c             	push   0xc(%eax)
+  80256c:	e8 ef 02 00 00       	call   802860 <nsipc_recv>
+}
+  802571:	c9                   	leave
+  802572:	c3                   	ret
+
+00802573 <fd2sockid>:
+{
+  802573:	55                   	push   %ebp
+  802574:	89 e5                	mov    %esp,%ebp
+  802576:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802579:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80257c:	52                   	push   %edx
+  80257d:	50                   	push   %eax
+  80257e:	e8 6a f6 ff ff       	call   801bed <fd_lookup>
+  802583:	83 c4 10             	add    $0x10,%esp
+  802586:	85 c0                	test   %eax,%eax
+  802588:	78 10                	js     80259a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80258a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80258d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802593:	39 08                	cmp    %ecx,(%eax)
+  802595:	75 05                	jne    80259c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802597:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80259c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025a1:	eb f7                	jmp    80259a <fd2sockid+0x27>
+
+008025a3 <alloc_sockfd>:
+{
+  8025a3:	55                   	push   %ebp
+  8025a4:	89 e5                	mov    %esp,%ebp
+  8025a6:	56                   	push   %esi
+  8025a7:	53                   	push   %ebx
+  8025a8:	83 ec 1c             	sub    $0x1c,%esp
+  8025ab:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8025ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b0:	50                   	push   %eax
+  8025b1:	e8 e1 f5 ff ff       	call   801b97 <fd_alloc>
+  8025b6:	89 c3                	mov    %eax,%ebx
+  8025b8:	83 c4 10             	add    $0x10,%esp
+  8025bb:	85 c0                	test   %eax,%eax
+  8025bd:	78 43                	js     802602 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8025bf:	83 ec 04             	sub    $0x4,%esp
+  8025c2:	68 07 04 00 00       	push   $0x407
+  8025c7:	ff 75 f4             	push   -0xc(%ebp)
+  8025ca:	6a 00                	push   $0x0
+  8025cc:	e8 da e9 ff ff       	call   800fab <sys_page_alloc>
+  8025d1:	89 c3                	mov    %eax,%ebx
+  8025d3:	83 c4 10             	add    $0x10,%esp
+  8025d6:	85 c0                	test   %eax,%eax
+  8025d8:	78 28                	js     802602 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8025da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025dd:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8025e3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8025e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8025ef:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8025f2:	83 ec 0c             	sub    $0xc,%esp
+  8025f5:	50                   	push   %eax
+  8025f6:	e8 75 f5 ff ff       	call   801b70 <fd2num>
+  8025fb:	89 c3                	mov    %eax,%ebx
+  8025fd:	83 c4 10             	add    $0x10,%esp
+  802600:	eb 0c                	jmp    80260e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802602:	83 ec 0c             	sub    $0xc,%esp
+  802605:	56                   	push   %esi
+  802606:	e8 e4 01 00 00       	call   8027ef <nsipc_close>
+		return r;
+  80260b:	83 c4 10             	add    $0x10,%esp
+}
+  80260e:	89 d8                	mov    %ebx,%eax
+  802610:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802613:	5b                   	pop    %ebx
+  802614:	5e                   	pop    %esi
+  802615:	5d                   	pop    %ebp
+  802616:	c3                   	ret
+
+00802617 <accept>:
+{
+  802617:	55                   	push   %ebp
+  802618:	89 e5                	mov    %esp,%ebp
+  80261a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80261d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802620:	e8 4e ff ff ff       	call   802573 <fd2sockid>
+  802625:	85 c0                	test   %eax,%eax
+  802627:	78 1b                	js     802644 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802629:	83 ec 04             	sub    $0x4,%esp
+  80262c:	ff 75 10             	push   0x10(%ebp)
+  80262f:	ff 75 0c             	push   0xc(%ebp)
+  802632:	50                   	push   %eax
+  802633:	e8 0e 01 00 00       	call   802746 <nsipc_accept>
+  802638:	83 c4 10             	add    $0x10,%esp
+  80263b:	85 c0                	test   %eax,%eax
+  80263d:	78 05                	js     802644 <accept+0x2d>
+	return alloc_sockfd(r);
+  80263f:	e8 5f ff ff ff       	call   8025a3 <alloc_sockfd>
+}
+  802644:	c9                   	leave
+  802645:	c3                   	ret
+
+00802646 <bind>:
+{
+  802646:	55                   	push   %ebp
+  802647:	89 e5                	mov    %esp,%ebp
+  802649:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80264c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264f:	e8 1f ff ff ff       	call   802573 <fd2sockid>
+  802654:	85 c0                	test   %eax,%eax
+  802656:	78 12                	js     80266a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802658:	83 ec 04             	sub    $0x4,%esp
+  80265b:	ff 75 10             	push   0x10(%ebp)
+  80265e:	ff 75 0c             	push   0xc(%ebp)
+  802661:	50                   	push   %eax
+  802662:	e8 31 01 00 00       	call   802798 <nsipc_bind>
+  802667:	83 c4 10             	add    $0x10,%esp
+}
+  80266a:	c9                   	leave
+  80266b:	c3                   	ret
+
+0080266c <shutdown>:
+{
+  80266c:	55                   	push   %ebp
+  80266d:	89 e5                	mov    %esp,%ebp
+  80266f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802672:	8b 45 08             	mov    0x8(%ebp),%eax
+  802675:	e8 f9 fe ff ff       	call   802573 <fd2sockid>
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	78 0f                	js     80268d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80267e:	83 ec 08             	sub    $0x8,%esp
+  802681:	ff 75 0c             	push   0xc(%ebp)
+  802684:	50                   	push   %eax
+  802685:	e8 43 01 00 00       	call   8027cd <nsipc_shutdown>
+  80268a:	83 c4 10             	add    $0x10,%esp
+}
+  80268d:	c9                   	leave
+  80268e:	c3                   	ret
+
+0080268f <connect>:
+{
+  80268f:	55                   	push   %ebp
+  802690:	89 e5                	mov    %esp,%ebp
+  802692:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802695:	8b 45 08             	mov    0x8(%ebp),%eax
+  802698:	e8 d6 fe ff ff       	call   802573 <fd2sockid>
+  80269d:	85 c0                	test   %eax,%eax
+  80269f:	78 12                	js     8026b3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8026a1:	83 ec 04             	sub    $0x4,%esp
+  8026a4:	ff 75 10             	push   0x10(%ebp)
+  8026a7:	ff 75 0c             	push   0xc(%ebp)
+  8026aa:	50                   	push   %eax
+  8026ab:	e8 59 01 00 00       	call   802809 <nsipc_connect>
+  8026b0:	83 c4 10             	add    $0x10,%esp
+}
+  8026b3:	c9                   	leave
+  8026b4:	c3                   	ret
+
+008026b5 <listen>:
+{
+  8026b5:	55                   	push   %ebp
+  8026b6:	89 e5                	mov    %esp,%ebp
+  8026b8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8026bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026be:	e8 b0 fe ff ff       	call   802573 <fd2sockid>
+  8026c3:	85 c0                	test   %eax,%eax
+  8026c5:	78 0f                	js     8026d6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8026c7:	83 ec 08             	sub    $0x8,%esp
+  8026ca:	ff 75 0c             	push   0xc(%ebp)
+  8026cd:	50                   	push   %eax
+  8026ce:	e8 6b 01 00 00       	call   80283e <nsipc_listen>
+  8026d3:	83 c4 10             	add    $0x10,%esp
+}
+  8026d6:	c9                   	leave
+  8026d7:	c3                   	ret
+
+008026d8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8026d8:	55                   	push   %ebp
+  8026d9:	89 e5                	mov    %esp,%ebp
+  8026db:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8026de:	ff 75 10             	push   0x10(%ebp)
+  8026e1:	ff 75 0c             	push   0xc(%ebp)
+  8026e4:	ff 75 08             	push   0x8(%ebp)
+  8026e7:	e8 41 02 00 00       	call   80292d <nsipc_socket>
+  8026ec:	83 c4 10             	add    $0x10,%esp
+  8026ef:	85 c0                	test   %eax,%eax
+  8026f1:	78 05                	js     8026f8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8026f3:	e8 ab fe ff ff       	call   8025a3 <alloc_sockfd>
+}
+  8026f8:	c9                   	leave
+  8026f9:	c3                   	ret
+
+008026fa <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8026fa:	55                   	push   %ebp
+  8026fb:	89 e5                	mov    %esp,%ebp
+  8026fd:	53                   	push   %ebx
+  8026fe:	83 ec 04             	sub    $0x4,%esp
+  802701:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802703:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80270a:	74 26                	je     802732 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80270c:	6a 07                	push   $0x7
+  80270e:	68 00 70 80 00       	push   $0x807000
+  802713:	53                   	push   %ebx
+  802714:	ff 35 04 50 80 00    	push   0x805004
+  80271a:	e8 4b 08 00 00       	call   802f6a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80271f:	83 c4 0c             	add    $0xc,%esp
+  802722:	6a 00                	push   $0x0
+  802724:	6a 00                	push   $0x0
+  802726:	6a 00                	push   $0x0
+  802728:	e8 25 08 00 00       	call   802f52 <ipc_recv>
+}
+  80272d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802730:	c9                   	leave
+  802731:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802732:	83 ec 0c             	sub    $0xc,%esp
+  802735:	6a 02                	push   $0x2
+  802737:	e8 82 08 00 00       	call   802fbe <ipc_find_env>
+  80273c:	a3 04 50 80 00       	mov    %eax,0x805004
+  802741:	83 c4 10             	add    $0x10,%esp
+  802744:	eb c6                	jmp    80270c <nsipc+0x12>
+
+00802746 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802746:	55                   	push   %ebp
+  802747:	89 e5                	mov    %esp,%ebp
+  802749:	56                   	push   %esi
+  80274a:	53                   	push   %ebx
+  80274b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80274e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802751:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802756:	8b 06                	mov    (%esi),%eax
+  802758:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80275d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802762:	e8 93 ff ff ff       	call   8026fa <nsipc>
+  802767:	89 c3                	mov    %eax,%ebx
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	79 09                	jns    802776 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80276d:	89 d8                	mov    %ebx,%eax
+  80276f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802772:	5b                   	pop    %ebx
+  802773:	5e                   	pop    %esi
+  802774:	5d                   	pop    %ebp
+  802775:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802776:	83 ec 04             	sub    $0x4,%esp
+  802779:	ff 35 10 70 80 00    	push   0x807010
+  80277f:	68 00 70 80 00       	push   $0x807000
+  802784:	ff 75 0c             	push   0xc(%ebp)
+  802787:	e8 ad e4 ff ff       	call   800c39 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80278c:	a1 10 70 80 00       	mov    0x807010,%eax
+  802791:	89 06                	mov    %eax,(%esi)
+  802793:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802796:	eb d5                	jmp    80276d <nsipc_accept+0x27>
+
+00802798 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802798:	55                   	push   %ebp
+  802799:	89 e5                	mov    %esp,%ebp
+  80279b:	53                   	push   %ebx
+  80279c:	83 ec 08             	sub    $0x8,%esp
+  80279f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8027a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a5:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8027aa:	53                   	push   %ebx
+  8027ab:	ff 75 0c             	push   0xc(%ebp)
+  8027ae:	68 04 70 80 00       	push   $0x807004
+  8027b3:	e8 81 e4 ff ff       	call   800c39 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8027b8:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8027be:	b8 02 00 00 00       	mov    $0x2,%eax
+  8027c3:	e8 32 ff ff ff       	call   8026fa <nsipc>
+}
+  8027c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027cb:	c9                   	leave
+  8027cc:	c3                   	ret
+
+008027cd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8027cd:	55                   	push   %ebp
+  8027ce:	89 e5                	mov    %esp,%ebp
+  8027d0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8027d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8027db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027de:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8027e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8027e8:	e8 0d ff ff ff       	call   8026fa <nsipc>
+}
+  8027ed:	c9                   	leave
+  8027ee:	c3                   	ret
+
+008027ef <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8027ef:	55                   	push   %ebp
+  8027f0:	89 e5                	mov    %esp,%ebp
+  8027f2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8027f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f8:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8027fd:	b8 04 00 00 00       	mov    $0x4,%eax
+  802802:	e8 f3 fe ff ff       	call   8026fa <nsipc>
+}
+  802807:	c9                   	leave
+  802808:	c3                   	ret
+
+00802809 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802809:	55                   	push   %ebp
+  80280a:	89 e5                	mov    %esp,%ebp
+  80280c:	53                   	push   %ebx
+  80280d:	83 ec 08             	sub    $0x8,%esp
+  802810:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802813:	8b 45 08             	mov    0x8(%ebp),%eax
+  802816:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80281b:	53                   	push   %ebx
+  80281c:	ff 75 0c             	push   0xc(%ebp)
+  80281f:	68 04 70 80 00       	push   $0x807004
+  802824:	e8 10 e4 ff ff       	call   800c39 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802829:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80282f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802834:	e8 c1 fe ff ff       	call   8026fa <nsipc>
+}
+  802839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80283c:	c9                   	leave
+  80283d:	c3                   	ret
+
+0080283e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80283e:	55                   	push   %ebp
+  80283f:	89 e5                	mov    %esp,%ebp
+  802841:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802844:	8b 45 08             	mov    0x8(%ebp),%eax
+  802847:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80284c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80284f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802854:	b8 06 00 00 00       	mov    $0x6,%eax
+  802859:	e8 9c fe ff ff       	call   8026fa <nsipc>
+}
+  80285e:	c9                   	leave
+  80285f:	c3                   	ret
+
+00802860 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802860:	55                   	push   %ebp
+  802861:	89 e5                	mov    %esp,%ebp
+  802863:	56                   	push   %esi
+  802864:	53                   	push   %ebx
+  802865:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802868:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802870:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802876:	8b 45 14             	mov    0x14(%ebp),%eax
+  802879:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80287e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802883:	e8 72 fe ff ff       	call   8026fa <nsipc>
+  802888:	89 c3                	mov    %eax,%ebx
+  80288a:	85 c0                	test   %eax,%eax
+  80288c:	78 22                	js     8028b0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80288e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802893:	39 c6                	cmp    %eax,%esi
+  802895:	0f 4e c6             	cmovle %esi,%eax
+  802898:	39 c3                	cmp    %eax,%ebx
+  80289a:	7f 1d                	jg     8028b9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80289c:	83 ec 04             	sub    $0x4,%esp
+  80289f:	53                   	push   %ebx
+  8028a0:	68 00 70 80 00       	push   $0x807000
+  8028a5:	ff 75 0c             	push   0xc(%ebp)
+  8028a8:	e8 8c e3 ff ff       	call   800c39 <memmove>
+  8028ad:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8028b0:	89 d8                	mov    %ebx,%eax
+  8028b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028b5:	5b                   	pop    %ebx
+  8028b6:	5e                   	pop    %esi
+  8028b7:	5d                   	pop    %ebp
+  8028b8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8028b9:	68 47 35 80 00       	push   $0x803547
+  8028be:	68 0f 35 80 00       	push   $0x80350f
+  8028c3:	6a 62                	push   $0x62
+  8028c5:	68 5c 35 80 00       	push   $0x80355c
+  8028ca:	e8 c1 da ff ff       	call   800390 <_panic>
+
+008028cf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	53                   	push   %ebx
+  8028d3:	83 ec 04             	sub    $0x4,%esp
+  8028d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8028d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028dc:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8028e1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8028e7:	7f 2e                	jg     802917 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8028e9:	83 ec 04             	sub    $0x4,%esp
+  8028ec:	53                   	push   %ebx
+  8028ed:	ff 75 0c             	push   0xc(%ebp)
+  8028f0:	68 0c 70 80 00       	push   $0x80700c
+  8028f5:	e8 3f e3 ff ff       	call   800c39 <memmove>
+	nsipcbuf.send.req_size = size;
+  8028fa:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802900:	8b 45 14             	mov    0x14(%ebp),%eax
+  802903:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802908:	b8 08 00 00 00       	mov    $0x8,%eax
+  80290d:	e8 e8 fd ff ff       	call   8026fa <nsipc>
+}
+  802912:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802915:	c9                   	leave
+  802916:	c3                   	ret
+	assert(size < 1600);
+  802917:	68 68 35 80 00       	push   $0x803568
+  80291c:	68 0f 35 80 00       	push   $0x80350f
+  802921:	6a 6d                	push   $0x6d
+  802923:	68 5c 35 80 00       	push   $0x80355c
+  802928:	e8 63 da ff ff       	call   800390 <_panic>
+
+0080292d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80292d:	55                   	push   %ebp
+  80292e:	89 e5                	mov    %esp,%ebp
+  802930:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802933:	8b 45 08             	mov    0x8(%ebp),%eax
+  802936:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80293b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80293e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802943:	8b 45 10             	mov    0x10(%ebp),%eax
+  802946:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80294b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802950:	e8 a5 fd ff ff       	call   8026fa <nsipc>
+}
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+
+00802957 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	56                   	push   %esi
+  80295b:	53                   	push   %ebx
+  80295c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80295f:	83 ec 0c             	sub    $0xc,%esp
+  802962:	ff 75 08             	push   0x8(%ebp)
+  802965:	e8 16 f2 ff ff       	call   801b80 <fd2data>
+  80296a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80296c:	83 c4 08             	add    $0x8,%esp
+  80296f:	68 74 35 80 00       	push   $0x803574
+  802974:	53                   	push   %ebx
+  802975:	e8 39 e1 ff ff       	call   800ab3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80297a:	8b 46 04             	mov    0x4(%esi),%eax
+  80297d:	2b 06                	sub    (%esi),%eax
+  80297f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802985:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80298c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80298f:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802996:	40 80 00 
+	return 0;
+}
+  802999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029a1:	5b                   	pop    %ebx
+  8029a2:	5e                   	pop    %esi
+  8029a3:	5d                   	pop    %ebp
+  8029a4:	c3                   	ret
+
+008029a5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8029a5:	55                   	push   %ebp
+  8029a6:	89 e5                	mov    %esp,%ebp
+  8029a8:	53                   	push   %ebx
+  8029a9:	83 ec 0c             	sub    $0xc,%esp
+  8029ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8029af:	53                   	push   %ebx
+  8029b0:	6a 00                	push   $0x0
+  8029b2:	e8 cf e6 ff ff       	call   801086 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8029b7:	89 1c 24             	mov    %ebx,(%esp)
+  8029ba:	e8 c1 f1 ff ff       	call   801b80 <fd2data>
+  8029bf:	83 c4 08             	add    $0x8,%esp
+  8029c2:	50                   	push   %eax
+  8029c3:	6a 00                	push   $0x0
+  8029c5:	e8 bc e6 ff ff       	call   801086 <sys_page_unmap>
+}
+  8029ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029cd:	c9                   	leave
+  8029ce:	c3                   	ret
+
+008029cf <_pipeisclosed>:
+{
+  8029cf:	55                   	push   %ebp
+  8029d0:	89 e5                	mov    %esp,%ebp
+  8029d2:	57                   	push   %edi
+  8029d3:	56                   	push   %esi
+  8029d4:	53                   	push   %ebx
+  8029d5:	83 ec 1c             	sub    $0x1c,%esp
+  8029d8:	89 c7                	mov    %eax,%edi
+  8029da:	89 d6                	mov    %edx,%esi
+  8029dc:	eb 3c                	jmp    802a1a <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8029de:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8029e1:	83 ec 0c             	sub    $0xc,%esp
+  8029e4:	57                   	push   %edi
+  8029e5:	e8 13 06 00 00       	call   802ffd <pageref>
+  8029ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8029ed:	89 34 24             	mov    %esi,(%esp)
+  8029f0:	e8 08 06 00 00       	call   802ffd <pageref>
+  8029f5:	89 c2                	mov    %eax,%edx
+  8029f7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029f9:	05 00 00 00 20       	add    $0x20000000,%eax
+  8029fe:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802a01:	8b 0d 20 54 80 00    	mov    0x805420,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a07:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a0c:	76 31                	jbe    802a3f <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802a0e:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802a11:	39 c3                	cmp    %eax,%ebx
+  802a13:	74 76                	je     802a8b <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802a15:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802a18:	74 36                	je     802a50 <_pipeisclosed+0x81>
+  802a1a:	89 e0                	mov    %esp,%eax
+  802a1c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a21:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a27:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a2c:	77 b0                	ja     8029de <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a2e:	c1 e8 10             	shr    $0x10,%eax
+  802a31:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a37:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a3d:	eb 9f                	jmp    8029de <_pipeisclosed+0xf>
+  802a3f:	c1 e8 10             	shr    $0x10,%eax
+  802a42:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a48:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802a4e:	eb be                	jmp    802a0e <_pipeisclosed+0x3f>
+  802a50:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a52:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a57:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a5d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a62:	76 16                	jbe    802a7a <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802a64:	8b 42 58             	mov    0x58(%edx),%eax
+  802a67:	6a 01                	push   $0x1
+  802a69:	50                   	push   %eax
+  802a6a:	53                   	push   %ebx
+  802a6b:	68 7b 35 80 00       	push   $0x80357b
+  802a70:	e8 f6 d9 ff ff       	call   80046b <cprintf>
+  802a75:	83 c4 10             	add    $0x10,%esp
+  802a78:	eb a0                	jmp    802a1a <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a7a:	c1 e8 10             	shr    $0x10,%eax
+  802a7d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a83:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a89:	eb d9                	jmp    802a64 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802a8b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802a8e:	0f 94 c0             	sete   %al
+  802a91:	0f b6 c0             	movzbl %al,%eax
+}
+  802a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a97:	5b                   	pop    %ebx
+  802a98:	5e                   	pop    %esi
+  802a99:	5f                   	pop    %edi
+  802a9a:	5d                   	pop    %ebp
+  802a9b:	c3                   	ret
+
+00802a9c <devpipe_write>:
+{
+  802a9c:	55                   	push   %ebp
+  802a9d:	89 e5                	mov    %esp,%ebp
+  802a9f:	57                   	push   %edi
+  802aa0:	56                   	push   %esi
+  802aa1:	53                   	push   %ebx
+  802aa2:	83 ec 28             	sub    $0x28,%esp
+  802aa5:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802aa8:	56                   	push   %esi
+  802aa9:	e8 d2 f0 ff ff       	call   801b80 <fd2data>
+  802aae:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ab0:	83 c4 10             	add    $0x10,%esp
+  802ab3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ab8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802abb:	75 09                	jne    802ac6 <devpipe_write+0x2a>
+	return i;
+  802abd:	89 f8                	mov    %edi,%eax
+  802abf:	eb 23                	jmp    802ae4 <devpipe_write+0x48>
+			sys_yield();
+  802ac1:	e8 9f e4 ff ff       	call   800f65 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802ac6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ac9:	8b 0b                	mov    (%ebx),%ecx
+  802acb:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ace:	39 d0                	cmp    %edx,%eax
+  802ad0:	72 1a                	jb     802aec <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802ad2:	89 da                	mov    %ebx,%edx
+  802ad4:	89 f0                	mov    %esi,%eax
+  802ad6:	e8 f4 fe ff ff       	call   8029cf <_pipeisclosed>
+  802adb:	85 c0                	test   %eax,%eax
+  802add:	74 e2                	je     802ac1 <devpipe_write+0x25>
+				return 0;
+  802adf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ae4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae7:	5b                   	pop    %ebx
+  802ae8:	5e                   	pop    %esi
+  802ae9:	5f                   	pop    %edi
+  802aea:	5d                   	pop    %ebp
+  802aeb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802aec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802aef:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802af3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802af6:	89 c2                	mov    %eax,%edx
+  802af8:	c1 fa 1f             	sar    $0x1f,%edx
+  802afb:	89 d1                	mov    %edx,%ecx
+  802afd:	c1 e9 1b             	shr    $0x1b,%ecx
+  802b00:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b03:	83 e2 1f             	and    $0x1f,%edx
+  802b06:	29 ca                	sub    %ecx,%edx
+  802b08:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802b0c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802b10:	83 c0 01             	add    $0x1,%eax
+  802b13:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802b16:	83 c7 01             	add    $0x1,%edi
+  802b19:	eb 9d                	jmp    802ab8 <devpipe_write+0x1c>
+
+00802b1b <devpipe_read>:
+{
+  802b1b:	55                   	push   %ebp
+  802b1c:	89 e5                	mov    %esp,%ebp
+  802b1e:	57                   	push   %edi
+  802b1f:	56                   	push   %esi
+  802b20:	53                   	push   %ebx
+  802b21:	83 ec 18             	sub    $0x18,%esp
+  802b24:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802b27:	57                   	push   %edi
+  802b28:	e8 53 f0 ff ff       	call   801b80 <fd2data>
+  802b2d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802b2f:	83 c4 10             	add    $0x10,%esp
+  802b32:	be 00 00 00 00       	mov    $0x0,%esi
+  802b37:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802b3a:	75 13                	jne    802b4f <devpipe_read+0x34>
+	return i;
+  802b3c:	89 f0                	mov    %esi,%eax
+  802b3e:	eb 02                	jmp    802b42 <devpipe_read+0x27>
+				return i;
+  802b40:	89 f0                	mov    %esi,%eax
+}
+  802b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b45:	5b                   	pop    %ebx
+  802b46:	5e                   	pop    %esi
+  802b47:	5f                   	pop    %edi
+  802b48:	5d                   	pop    %ebp
+  802b49:	c3                   	ret
+			sys_yield();
+  802b4a:	e8 16 e4 ff ff       	call   800f65 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802b4f:	8b 03                	mov    (%ebx),%eax
+  802b51:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802b54:	75 18                	jne    802b6e <devpipe_read+0x53>
+			if (i > 0)
+  802b56:	85 f6                	test   %esi,%esi
+  802b58:	75 e6                	jne    802b40 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802b5a:	89 da                	mov    %ebx,%edx
+  802b5c:	89 f8                	mov    %edi,%eax
+  802b5e:	e8 6c fe ff ff       	call   8029cf <_pipeisclosed>
+  802b63:	85 c0                	test   %eax,%eax
+  802b65:	74 e3                	je     802b4a <devpipe_read+0x2f>
+				return 0;
+  802b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6c:	eb d4                	jmp    802b42 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802b6e:	99                   	cltd
+  802b6f:	c1 ea 1b             	shr    $0x1b,%edx
+  802b72:	01 d0                	add    %edx,%eax
+  802b74:	83 e0 1f             	and    $0x1f,%eax
+  802b77:	29 d0                	sub    %edx,%eax
+  802b79:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802b7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b81:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802b84:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802b87:	83 c6 01             	add    $0x1,%esi
+  802b8a:	eb ab                	jmp    802b37 <devpipe_read+0x1c>
+
+00802b8c <pipe>:
+{
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+  802b8f:	56                   	push   %esi
+  802b90:	53                   	push   %ebx
+  802b91:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802b94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b97:	50                   	push   %eax
+  802b98:	e8 fa ef ff ff       	call   801b97 <fd_alloc>
+  802b9d:	89 c3                	mov    %eax,%ebx
+  802b9f:	83 c4 10             	add    $0x10,%esp
+  802ba2:	85 c0                	test   %eax,%eax
+  802ba4:	0f 88 23 01 00 00    	js     802ccd <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802baa:	83 ec 04             	sub    $0x4,%esp
+  802bad:	68 07 04 00 00       	push   $0x407
+  802bb2:	ff 75 f4             	push   -0xc(%ebp)
+  802bb5:	6a 00                	push   $0x0
+  802bb7:	e8 ef e3 ff ff       	call   800fab <sys_page_alloc>
+  802bbc:	89 c3                	mov    %eax,%ebx
+  802bbe:	83 c4 10             	add    $0x10,%esp
+  802bc1:	85 c0                	test   %eax,%eax
+  802bc3:	0f 88 04 01 00 00    	js     802ccd <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802bc9:	83 ec 0c             	sub    $0xc,%esp
+  802bcc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802bcf:	50                   	push   %eax
+  802bd0:	e8 c2 ef ff ff       	call   801b97 <fd_alloc>
+  802bd5:	89 c3                	mov    %eax,%ebx
+  802bd7:	83 c4 10             	add    $0x10,%esp
+  802bda:	85 c0                	test   %eax,%eax
+  802bdc:	0f 88 db 00 00 00    	js     802cbd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802be2:	83 ec 04             	sub    $0x4,%esp
+  802be5:	68 07 04 00 00       	push   $0x407
+  802bea:	ff 75 f0             	push   -0x10(%ebp)
+  802bed:	6a 00                	push   $0x0
+  802bef:	e8 b7 e3 ff ff       	call   800fab <sys_page_alloc>
+  802bf4:	89 c3                	mov    %eax,%ebx
+  802bf6:	83 c4 10             	add    $0x10,%esp
+  802bf9:	85 c0                	test   %eax,%eax
+  802bfb:	0f 88 bc 00 00 00    	js     802cbd <pipe+0x131>
+	va = fd2data(fd0);
+  802c01:	83 ec 0c             	sub    $0xc,%esp
+  802c04:	ff 75 f4             	push   -0xc(%ebp)
+  802c07:	e8 74 ef ff ff       	call   801b80 <fd2data>
+  802c0c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c0e:	83 c4 0c             	add    $0xc,%esp
+  802c11:	68 07 04 00 00       	push   $0x407
+  802c16:	50                   	push   %eax
+  802c17:	6a 00                	push   $0x0
+  802c19:	e8 8d e3 ff ff       	call   800fab <sys_page_alloc>
+  802c1e:	89 c3                	mov    %eax,%ebx
+  802c20:	83 c4 10             	add    $0x10,%esp
+  802c23:	85 c0                	test   %eax,%eax
+  802c25:	0f 88 82 00 00 00    	js     802cad <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c2b:	83 ec 0c             	sub    $0xc,%esp
+  802c2e:	ff 75 f0             	push   -0x10(%ebp)
+  802c31:	e8 4a ef ff ff       	call   801b80 <fd2data>
+  802c36:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802c3d:	50                   	push   %eax
+  802c3e:	6a 00                	push   $0x0
+  802c40:	56                   	push   %esi
+  802c41:	6a 00                	push   $0x0
+  802c43:	e8 d0 e3 ff ff       	call   801018 <sys_page_map>
+  802c48:	89 c3                	mov    %eax,%ebx
+  802c4a:	83 c4 20             	add    $0x20,%esp
+  802c4d:	85 c0                	test   %eax,%eax
+  802c4f:	78 4e                	js     802c9f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802c51:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802c56:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c59:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802c5b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802c5e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802c65:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802c68:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802c6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802c6d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802c74:	83 ec 0c             	sub    $0xc,%esp
+  802c77:	ff 75 f4             	push   -0xc(%ebp)
+  802c7a:	e8 f1 ee ff ff       	call   801b70 <fd2num>
+  802c7f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c82:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802c84:	83 c4 04             	add    $0x4,%esp
+  802c87:	ff 75 f0             	push   -0x10(%ebp)
+  802c8a:	e8 e1 ee ff ff       	call   801b70 <fd2num>
+  802c8f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c92:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802c95:	83 c4 10             	add    $0x10,%esp
+  802c98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c9d:	eb 2e                	jmp    802ccd <pipe+0x141>
+	sys_page_unmap(0, va);
+  802c9f:	83 ec 08             	sub    $0x8,%esp
+  802ca2:	56                   	push   %esi
+  802ca3:	6a 00                	push   $0x0
+  802ca5:	e8 dc e3 ff ff       	call   801086 <sys_page_unmap>
+  802caa:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802cad:	83 ec 08             	sub    $0x8,%esp
+  802cb0:	ff 75 f0             	push   -0x10(%ebp)
+  802cb3:	6a 00                	push   $0x0
+  802cb5:	e8 cc e3 ff ff       	call   801086 <sys_page_unmap>
+  802cba:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802cbd:	83 ec 08             	sub    $0x8,%esp
+  802cc0:	ff 75 f4             	push   -0xc(%ebp)
+  802cc3:	6a 00                	push   $0x0
+  802cc5:	e8 bc e3 ff ff       	call   801086 <sys_page_unmap>
+  802cca:	83 c4 10             	add    $0x10,%esp
+}
+  802ccd:	89 d8                	mov    %ebx,%eax
+  802ccf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cd2:	5b                   	pop    %ebx
+  802cd3:	5e                   	pop    %esi
+  802cd4:	5d                   	pop    %ebp
+  802cd5:	c3                   	ret
+
+00802cd6 <pipeisclosed>:
+{
+  802cd6:	55                   	push   %ebp
+  802cd7:	89 e5                	mov    %esp,%ebp
+  802cd9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cdf:	50                   	push   %eax
+  802ce0:	ff 75 08             	push   0x8(%ebp)
+  802ce3:	e8 05 ef ff ff       	call   801bed <fd_lookup>
+  802ce8:	83 c4 10             	add    $0x10,%esp
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	78 18                	js     802d07 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802cef:	83 ec 0c             	sub    $0xc,%esp
+  802cf2:	ff 75 f4             	push   -0xc(%ebp)
+  802cf5:	e8 86 ee ff ff       	call   801b80 <fd2data>
+  802cfa:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802cfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cff:	e8 cb fc ff ff       	call   8029cf <_pipeisclosed>
+  802d04:	83 c4 10             	add    $0x10,%esp
+}
+  802d07:	c9                   	leave
+  802d08:	c3                   	ret
+
+00802d09 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0e:	c3                   	ret
+
+00802d0f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d0f:	55                   	push   %ebp
+  802d10:	89 e5                	mov    %esp,%ebp
+  802d12:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802d15:	68 93 35 80 00       	push   $0x803593
+  802d1a:	ff 75 0c             	push   0xc(%ebp)
+  802d1d:	e8 91 dd ff ff       	call   800ab3 <strcpy>
+	return 0;
+}
+  802d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d27:	c9                   	leave
+  802d28:	c3                   	ret
+
+00802d29 <devcons_write>:
+{
+  802d29:	55                   	push   %ebp
+  802d2a:	89 e5                	mov    %esp,%ebp
+  802d2c:	57                   	push   %edi
+  802d2d:	56                   	push   %esi
+  802d2e:	53                   	push   %ebx
+  802d2f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802d35:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802d3a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802d40:	eb 2e                	jmp    802d70 <devcons_write+0x47>
+		m = n - tot;
+  802d42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d45:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802d47:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d4c:	39 c3                	cmp    %eax,%ebx
+  802d4e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802d51:	83 ec 04             	sub    $0x4,%esp
+  802d54:	53                   	push   %ebx
+  802d55:	89 f0                	mov    %esi,%eax
+  802d57:	03 45 0c             	add    0xc(%ebp),%eax
+  802d5a:	50                   	push   %eax
+  802d5b:	57                   	push   %edi
+  802d5c:	e8 d8 de ff ff       	call   800c39 <memmove>
+		sys_cputs(buf, m);
+  802d61:	83 c4 08             	add    $0x8,%esp
+  802d64:	53                   	push   %ebx
+  802d65:	57                   	push   %edi
+  802d66:	e8 c1 e0 ff ff       	call   800e2c <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802d6b:	01 de                	add    %ebx,%esi
+  802d6d:	83 c4 10             	add    $0x10,%esp
+  802d70:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d73:	72 cd                	jb     802d42 <devcons_write+0x19>
+}
+  802d75:	89 f0                	mov    %esi,%eax
+  802d77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d7a:	5b                   	pop    %ebx
+  802d7b:	5e                   	pop    %esi
+  802d7c:	5f                   	pop    %edi
+  802d7d:	5d                   	pop    %ebp
+  802d7e:	c3                   	ret
+
+00802d7f <devcons_read>:
+{
+  802d7f:	55                   	push   %ebp
+  802d80:	89 e5                	mov    %esp,%ebp
+  802d82:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802d85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d8e:	75 07                	jne    802d97 <devcons_read+0x18>
+  802d90:	eb 1f                	jmp    802db1 <devcons_read+0x32>
+		sys_yield();
+  802d92:	e8 ce e1 ff ff       	call   800f65 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802d97:	e8 d4 e0 ff ff       	call   800e70 <sys_cgetc>
+  802d9c:	85 c0                	test   %eax,%eax
+  802d9e:	74 f2                	je     802d92 <devcons_read+0x13>
+	if (c < 0)
+  802da0:	78 0f                	js     802db1 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802da2:	83 f8 04             	cmp    $0x4,%eax
+  802da5:	74 0c                	je     802db3 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802da7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802daa:	88 02                	mov    %al,(%edx)
+	return 1;
+  802dac:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802db1:	c9                   	leave
+  802db2:	c3                   	ret
+		return 0;
+  802db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db8:	eb f7                	jmp    802db1 <devcons_read+0x32>
+
+00802dba <cputchar>:
+{
+  802dba:	55                   	push   %ebp
+  802dbb:	89 e5                	mov    %esp,%ebp
+  802dbd:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802dc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802dc6:	6a 01                	push   $0x1
+  802dc8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802dcb:	50                   	push   %eax
+  802dcc:	e8 5b e0 ff ff       	call   800e2c <sys_cputs>
+}
+  802dd1:	83 c4 10             	add    $0x10,%esp
+  802dd4:	c9                   	leave
+  802dd5:	c3                   	ret
+
+00802dd6 <getchar>:
+{
+  802dd6:	55                   	push   %ebp
+  802dd7:	89 e5                	mov    %esp,%ebp
+  802dd9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802ddc:	6a 01                	push   $0x1
+  802dde:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802de1:	50                   	push   %eax
+  802de2:	6a 00                	push   $0x0
+  802de4:	e8 8a f0 ff ff       	call   801e73 <read>
+	if (r < 0)
+  802de9:	83 c4 10             	add    $0x10,%esp
+  802dec:	85 c0                	test   %eax,%eax
+  802dee:	78 06                	js     802df6 <getchar+0x20>
+	if (r < 1)
+  802df0:	74 06                	je     802df8 <getchar+0x22>
+	return c;
+  802df2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802df6:	c9                   	leave
+  802df7:	c3                   	ret
+		return -E_EOF;
+  802df8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802dfd:	eb f7                	jmp    802df6 <getchar+0x20>
+
+00802dff <iscons>:
+{
+  802dff:	55                   	push   %ebp
+  802e00:	89 e5                	mov    %esp,%ebp
+  802e02:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e08:	50                   	push   %eax
+  802e09:	ff 75 08             	push   0x8(%ebp)
+  802e0c:	e8 dc ed ff ff       	call   801bed <fd_lookup>
+  802e11:	83 c4 10             	add    $0x10,%esp
+  802e14:	85 c0                	test   %eax,%eax
+  802e16:	78 11                	js     802e29 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802e18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e1b:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802e21:	39 10                	cmp    %edx,(%eax)
+  802e23:	0f 94 c0             	sete   %al
+  802e26:	0f b6 c0             	movzbl %al,%eax
+}
+  802e29:	c9                   	leave
+  802e2a:	c3                   	ret
+
+00802e2b <opencons>:
+{
+  802e2b:	55                   	push   %ebp
+  802e2c:	89 e5                	mov    %esp,%ebp
+  802e2e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802e31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e34:	50                   	push   %eax
+  802e35:	e8 5d ed ff ff       	call   801b97 <fd_alloc>
+  802e3a:	83 c4 10             	add    $0x10,%esp
+  802e3d:	85 c0                	test   %eax,%eax
+  802e3f:	78 3a                	js     802e7b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802e41:	83 ec 04             	sub    $0x4,%esp
+  802e44:	68 07 04 00 00       	push   $0x407
+  802e49:	ff 75 f4             	push   -0xc(%ebp)
+  802e4c:	6a 00                	push   $0x0
+  802e4e:	e8 58 e1 ff ff       	call   800fab <sys_page_alloc>
+  802e53:	83 c4 10             	add    $0x10,%esp
+  802e56:	85 c0                	test   %eax,%eax
+  802e58:	78 21                	js     802e7b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802e5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e5d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802e63:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802e65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e68:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802e6f:	83 ec 0c             	sub    $0xc,%esp
+  802e72:	50                   	push   %eax
+  802e73:	e8 f8 ec ff ff       	call   801b70 <fd2num>
+  802e78:	83 c4 10             	add    $0x10,%esp
+}
+  802e7b:	c9                   	leave
+  802e7c:	c3                   	ret
+
+00802e7d <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802e7d:	55                   	push   %ebp
+  802e7e:	89 e5                	mov    %esp,%ebp
+  802e80:	56                   	push   %esi
+  802e81:	53                   	push   %ebx
+  802e82:	8b 75 08             	mov    0x8(%ebp),%esi
+  802e85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802e8b:	85 c0                	test   %eax,%eax
+  802e8d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802e92:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802e95:	83 ec 08             	sub    $0x8,%esp
+  802e98:	ff 75 14             	push   0x14(%ebp)
+  802e9b:	50                   	push   %eax
+  802e9c:	e8 1b e5 ff ff       	call   8013bc <sys_ipc_recv_until>
+  802ea1:	83 c4 10             	add    $0x10,%esp
+  802ea4:	85 c0                	test   %eax,%eax
+  802ea6:	78 61                	js     802f09 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802ea8:	85 f6                	test   %esi,%esi
+  802eaa:	74 1c                	je     802ec8 <ipc_recv_until+0x4b>
+  802eac:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802eae:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802eb3:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802eb9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ebe:	76 5f                	jbe    802f1f <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802ec0:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802ec6:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802ec8:	85 db                	test   %ebx,%ebx
+  802eca:	74 1c                	je     802ee8 <ipc_recv_until+0x6b>
+  802ecc:	89 e0                	mov    %esp,%eax
+  802ece:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ed3:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ed9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ede:	76 50                	jbe    802f30 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802ee0:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802ee6:	89 03                	mov    %eax,(%ebx)
+  802ee8:	89 e0                	mov    %esp,%eax
+  802eea:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802eef:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ef5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802efa:	76 45                	jbe    802f41 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802efc:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802f02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f05:	5b                   	pop    %ebx
+  802f06:	5e                   	pop    %esi
+  802f07:	5d                   	pop    %ebp
+  802f08:	c3                   	ret
+		if (from_env_store)
+  802f09:	85 f6                	test   %esi,%esi
+  802f0b:	74 06                	je     802f13 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802f0d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802f13:	85 db                	test   %ebx,%ebx
+  802f15:	74 eb                	je     802f02 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802f17:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802f1d:	eb e3                	jmp    802f02 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f1f:	c1 e8 10             	shr    $0x10,%eax
+  802f22:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f28:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f2e:	eb 90                	jmp    802ec0 <ipc_recv_until+0x43>
+  802f30:	c1 e8 10             	shr    $0x10,%eax
+  802f33:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f39:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f3f:	eb 9f                	jmp    802ee0 <ipc_recv_until+0x63>
+  802f41:	c1 e8 10             	shr    $0x10,%eax
+  802f44:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f4a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f50:	eb aa                	jmp    802efc <ipc_recv_until+0x7f>
+
+00802f52 <ipc_recv>:
+{
+  802f52:	55                   	push   %ebp
+  802f53:	89 e5                	mov    %esp,%ebp
+  802f55:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802f58:	6a 00                	push   $0x0
+  802f5a:	ff 75 10             	push   0x10(%ebp)
+  802f5d:	ff 75 0c             	push   0xc(%ebp)
+  802f60:	ff 75 08             	push   0x8(%ebp)
+  802f63:	e8 15 ff ff ff       	call   802e7d <ipc_recv_until>
+}
+  802f68:	c9                   	leave
+  802f69:	c3                   	ret
+
+00802f6a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802f6a:	55                   	push   %ebp
+  802f6b:	89 e5                	mov    %esp,%ebp
+  802f6d:	57                   	push   %edi
+  802f6e:	56                   	push   %esi
+  802f6f:	53                   	push   %ebx
+  802f70:	83 ec 0c             	sub    $0xc,%esp
+  802f73:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f76:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802f79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802f7c:	85 db                	test   %ebx,%ebx
+  802f7e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f83:	0f 44 d8             	cmove  %eax,%ebx
+  802f86:	eb 05                	jmp    802f8d <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802f88:	e8 d8 df ff ff       	call   800f65 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802f8d:	ff 75 14             	push   0x14(%ebp)
+  802f90:	53                   	push   %ebx
+  802f91:	56                   	push   %esi
+  802f92:	57                   	push   %edi
+  802f93:	e8 70 e3 ff ff       	call   801308 <sys_ipc_try_send>
+  802f98:	83 c4 10             	add    $0x10,%esp
+  802f9b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f9e:	74 e8                	je     802f88 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802fa0:	85 c0                	test   %eax,%eax
+  802fa2:	78 08                	js     802fac <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802fa4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fa7:	5b                   	pop    %ebx
+  802fa8:	5e                   	pop    %esi
+  802fa9:	5f                   	pop    %edi
+  802faa:	5d                   	pop    %ebp
+  802fab:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802fac:	50                   	push   %eax
+  802fad:	68 9f 35 80 00       	push   $0x80359f
+  802fb2:	6a 4f                	push   $0x4f
+  802fb4:	68 b2 35 80 00       	push   $0x8035b2
+  802fb9:	e8 d2 d3 ff ff       	call   800390 <_panic>
+
+00802fbe <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802fbe:	55                   	push   %ebp
+  802fbf:	89 e5                	mov    %esp,%ebp
+  802fc1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802fc9:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802fcf:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802fd5:	8b 52 50             	mov    0x50(%edx),%edx
+  802fd8:	39 ca                	cmp    %ecx,%edx
+  802fda:	74 11                	je     802fed <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802fdc:	83 c0 01             	add    $0x1,%eax
+  802fdf:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802fe4:	75 e3                	jne    802fc9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802feb:	eb 0e                	jmp    802ffb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802fed:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ff3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ff8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802ffb:	5d                   	pop    %ebp
+  802ffc:	c3                   	ret
+
+00802ffd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802ffd:	55                   	push   %ebp
+  802ffe:	89 e5                	mov    %esp,%ebp
+  803000:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803003:	89 c2                	mov    %eax,%edx
+  803005:	c1 ea 16             	shr    $0x16,%edx
+  803008:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80300f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803014:	f6 c1 01             	test   $0x1,%cl
+  803017:	74 1a                	je     803033 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803019:	c1 e8 0c             	shr    $0xc,%eax
+  80301c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803023:	a8 01                	test   $0x1,%al
+  803025:	74 0c                	je     803033 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803027:	c1 e8 0c             	shr    $0xc,%eax
+  80302a:	c1 e0 04             	shl    $0x4,%eax
+  80302d:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803033:	89 d0                	mov    %edx,%eax
+  803035:	5d                   	pop    %ebp
+  803036:	c3                   	ret
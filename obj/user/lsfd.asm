@@ -0,0 +1,6650 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: lsfd [-1]\n");
+  800039:	68 80 2e 80 00       	push   $0x802e80
+  80003e:	e8 6d 02 00 00       	call   8002b0 <cprintf>
+	exit();
+  800043:	e8 73 01 00 00       	call   8001bb <exit>
+}
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	c9                   	leave
+  80004c:	c3                   	ret
+
+0080004d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+	int i, usefprint = 0;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800059:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	ff 75 0c             	push   0xc(%ebp)
+  800063:	8d 45 08             	lea    0x8(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 fa 17 00 00       	call   801866 <argstart>
+	while ((i = argnext(&args)) >= 0)
+  80006c:	83 c4 10             	add    $0x10,%esp
+	int i, usefprint = 0;
+  80006f:	be 00 00 00 00       	mov    $0x0,%esi
+	while ((i = argnext(&args)) >= 0)
+  800074:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+		if (i == '1')
+			usefprint = 1;
+  80007a:	bf 01 00 00 00       	mov    $0x1,%edi
+	while ((i = argnext(&args)) >= 0)
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	53                   	push   %ebx
+  800083:	e8 0e 18 00 00       	call   801896 <argnext>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 10                	js     80009f <umain+0x52>
+		if (i == '1')
+  80008f:	83 f8 31             	cmp    $0x31,%eax
+  800092:	75 04                	jne    800098 <umain+0x4b>
+			usefprint = 1;
+  800094:	89 fe                	mov    %edi,%esi
+  800096:	eb e7                	jmp    80007f <umain+0x32>
+		else
+			usage();
+  800098:	e8 96 ff ff ff       	call   800033 <usage>
+  80009d:	eb e0                	jmp    80007f <umain+0x32>
+
+	for (i = 0; i < 32; i++)
+  80009f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fstat(i, &st) >= 0) {
+  8000a4:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  8000aa:	eb 26                	jmp    8000d2 <umain+0x85>
+			if (usefprint)
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+			else
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b2:	ff 70 04             	push   0x4(%eax)
+  8000b5:	ff 75 dc             	push   -0x24(%ebp)
+  8000b8:	ff 75 e0             	push   -0x20(%ebp)
+  8000bb:	57                   	push   %edi
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 94 2e 80 00       	push   $0x802e94
+  8000c2:	e8 e9 01 00 00       	call   8002b0 <cprintf>
+  8000c7:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < 32; i++)
+  8000ca:	83 c3 01             	add    $0x1,%ebx
+  8000cd:	83 fb 20             	cmp    $0x20,%ebx
+  8000d0:	74 37                	je     800109 <umain+0xbc>
+		if (fstat(i, &st) >= 0) {
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	57                   	push   %edi
+  8000d6:	53                   	push   %ebx
+  8000d7:	e8 34 1e 00 00       	call   801f10 <fstat>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 e7                	js     8000ca <umain+0x7d>
+			if (usefprint)
+  8000e3:	85 f6                	test   %esi,%esi
+  8000e5:	74 c5                	je     8000ac <umain+0x5f>
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ed:	ff 70 04             	push   0x4(%eax)
+  8000f0:	ff 75 dc             	push   -0x24(%ebp)
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	57                   	push   %edi
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 94 2e 80 00       	push   $0x802e94
+  8000fd:	6a 01                	push   $0x1
+  8000ff:	e8 03 22 00 00       	call   802307 <fprintf>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	eb c1                	jmp    8000ca <umain+0x7d>
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+		}
+}
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	57                   	push   %edi
+  800115:	56                   	push   %esi
+  800116:	53                   	push   %ebx
+  800117:	83 ec 0c             	sub    $0xc,%esp
+  80011a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80011d:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800120:	b8 01 00 00 00       	mov    $0x1,%eax
+  800125:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800127:	c1 ea 0b             	shr    $0xb,%edx
+  80012a:	83 f2 01             	xor    $0x1,%edx
+  80012d:	83 e2 01             	and    $0x1,%edx
+  800130:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800136:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80013d:	00 00 00 
+	envid = sys_getenvid();
+  800140:	e8 1f 0c 00 00       	call   800d64 <sys_getenvid>
+  800145:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80014c:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800152:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800158:	8b 52 48             	mov    0x48(%edx),%edx
+  80015b:	39 ca                	cmp    %ecx,%edx
+  80015d:	74 27                	je     800186 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80015f:	83 c0 01             	add    $0x1,%eax
+  800162:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800167:	75 e3                	jne    80014c <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800169:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800170:	75 24                	jne    800196 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800172:	83 ec 04             	sub    $0x4,%esp
+  800175:	68 bc 2e 80 00       	push   $0x802ebc
+  80017a:	6a 23                	push   $0x23
+  80017c:	68 df 2e 80 00       	push   $0x802edf
+  800181:	e8 4f 00 00 00       	call   8001d5 <_panic>
+			mainenv = &envs[i];
+  800186:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80018c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800191:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800196:	85 ff                	test   %edi,%edi
+  800198:	7e 07                	jle    8001a1 <libmain+0x90>
+		binaryname = argv[0];
+  80019a:	8b 06                	mov    (%esi),%eax
+  80019c:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001a1:	83 ec 08             	sub    $0x8,%esp
+  8001a4:	56                   	push   %esi
+  8001a5:	57                   	push   %edi
+  8001a6:	e8 a2 fe ff ff       	call   80004d <umain>
+
+	// exit gracefully
+	exit();
+  8001ab:	e8 0b 00 00 00       	call   8001bb <exit>
+}
+  8001b0:	83 c4 10             	add    $0x10,%esp
+  8001b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b6:	5b                   	pop    %ebx
+  8001b7:	5e                   	pop    %esi
+  8001b8:	5f                   	pop    %edi
+  8001b9:	5d                   	pop    %ebp
+  8001ba:	c3                   	ret
+
+008001bb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001bb:	55                   	push   %ebp
+  8001bc:	89 e5                	mov    %esp,%ebp
+  8001be:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001c1:	e8 e3 19 00 00       	call   801ba9 <close_all>
+	sys_env_destroy(0);
+  8001c6:	83 ec 0c             	sub    $0xc,%esp
+  8001c9:	6a 00                	push   $0x0
+  8001cb:	e8 2b 0b 00 00       	call   800cfb <sys_env_destroy>
+}
+  8001d0:	83 c4 10             	add    $0x10,%esp
+  8001d3:	c9                   	leave
+  8001d4:	c3                   	ret
+
+008001d5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001d5:	55                   	push   %ebp
+  8001d6:	89 e5                	mov    %esp,%ebp
+  8001d8:	56                   	push   %esi
+  8001d9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001da:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001dd:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001e3:	e8 7c 0b 00 00       	call   800d64 <sys_getenvid>
+  8001e8:	83 ec 0c             	sub    $0xc,%esp
+  8001eb:	ff 75 0c             	push   0xc(%ebp)
+  8001ee:	ff 75 08             	push   0x8(%ebp)
+  8001f1:	56                   	push   %esi
+  8001f2:	50                   	push   %eax
+  8001f3:	68 f8 2e 80 00       	push   $0x802ef8
+  8001f8:	e8 b3 00 00 00       	call   8002b0 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001fd:	83 c4 18             	add    $0x18,%esp
+  800200:	53                   	push   %ebx
+  800201:	ff 75 10             	push   0x10(%ebp)
+  800204:	e8 56 00 00 00       	call   80025f <vcprintf>
+	cprintf("\n");
+  800209:	c7 04 24 90 2e 80 00 	movl   $0x802e90,(%esp)
+  800210:	e8 9b 00 00 00       	call   8002b0 <cprintf>
+  800215:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800218:	cc                   	int3
+	while (1)
+  800219:	eb fd                	jmp    800218 <_panic+0x43>
+
+0080021b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80021b:	55                   	push   %ebp
+  80021c:	89 e5                	mov    %esp,%ebp
+  80021e:	53                   	push   %ebx
+  80021f:	83 ec 04             	sub    $0x4,%esp
+  800222:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800225:	8b 13                	mov    (%ebx),%edx
+  800227:	8d 42 01             	lea    0x1(%edx),%eax
+  80022a:	89 03                	mov    %eax,(%ebx)
+  80022c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80022f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800233:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800238:	74 09                	je     800243 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80023a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80023e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800241:	c9                   	leave
+  800242:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800243:	83 ec 08             	sub    $0x8,%esp
+  800246:	68 ff 00 00 00       	push   $0xff
+  80024b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80024e:	50                   	push   %eax
+  80024f:	e8 1d 0a 00 00       	call   800c71 <sys_cputs>
+		b->idx = 0;
+  800254:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80025a:	83 c4 10             	add    $0x10,%esp
+  80025d:	eb db                	jmp    80023a <putch+0x1f>
+
+0080025f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80025f:	55                   	push   %ebp
+  800260:	89 e5                	mov    %esp,%ebp
+  800262:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800268:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80026f:	00 00 00 
+	b.cnt = 0;
+  800272:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800279:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	ff 75 08             	push   0x8(%ebp)
+  800282:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800288:	50                   	push   %eax
+  800289:	68 1b 02 80 00       	push   $0x80021b
+  80028e:	e8 fb 00 00 00       	call   80038e <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800293:	83 c4 08             	add    $0x8,%esp
+  800296:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80029c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002a2:	50                   	push   %eax
+  8002a3:	e8 c9 09 00 00       	call   800c71 <sys_cputs>
+
+	return b.cnt;
+}
+  8002a8:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+008002b0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002b6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002b9:	50                   	push   %eax
+  8002ba:	ff 75 08             	push   0x8(%ebp)
+  8002bd:	e8 9d ff ff ff       	call   80025f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002c2:	c9                   	leave
+  8002c3:	c3                   	ret
+
+008002c4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8002c4:	55                   	push   %ebp
+  8002c5:	89 e5                	mov    %esp,%ebp
+  8002c7:	57                   	push   %edi
+  8002c8:	56                   	push   %esi
+  8002c9:	53                   	push   %ebx
+  8002ca:	83 ec 1c             	sub    $0x1c,%esp
+  8002cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002d0:	89 d6                	mov    %edx,%esi
+  8002d2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002d8:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002db:	73 0b                	jae    8002e8 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002dd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002e0:	c1 e7 08             	shl    $0x8,%edi
+  8002e3:	0b 7d 10             	or     0x10(%ebp),%edi
+  8002e6:	eb 36                	jmp    80031e <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8002e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002f0:	f7 75 08             	divl   0x8(%ebp)
+  8002f3:	89 c1                	mov    %eax,%ecx
+  8002f5:	ff 75 14             	push   0x14(%ebp)
+  8002f8:	ff 75 10             	push   0x10(%ebp)
+  8002fb:	83 eb 01             	sub    $0x1,%ebx
+  8002fe:	53                   	push   %ebx
+  8002ff:	ff 75 08             	push   0x8(%ebp)
+  800302:	89 f2                	mov    %esi,%edx
+  800304:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800307:	e8 b8 ff ff ff       	call   8002c4 <printnum>
+  80030c:	83 c4 10             	add    $0x10,%esp
+  80030f:	eb 14                	jmp    800325 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800311:	83 ec 08             	sub    $0x8,%esp
+  800314:	56                   	push   %esi
+  800315:	57                   	push   %edi
+  800316:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800319:	ff d0                	call   *%eax
+  80031b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80031e:	83 eb 01             	sub    $0x1,%ebx
+  800321:	85 db                	test   %ebx,%ebx
+  800323:	7f ec                	jg     800311 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800325:	83 ec 08             	sub    $0x8,%esp
+  800328:	56                   	push   %esi
+  800329:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80032c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800331:	f7 75 08             	divl   0x8(%ebp)
+  800334:	0f be 92 1b 2f 80 00 	movsbl 0x802f1b(%edx),%edx
+  80033b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033e:	c1 e0 08             	shl    $0x8,%eax
+  800341:	09 d0                	or     %edx,%eax
+  800343:	50                   	push   %eax
+  800344:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800347:	ff d0                	call   *%eax
+}
+  800349:	83 c4 10             	add    $0x10,%esp
+  80034c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034f:	5b                   	pop    %ebx
+  800350:	5e                   	pop    %esi
+  800351:	5f                   	pop    %edi
+  800352:	5d                   	pop    %ebp
+  800353:	c3                   	ret
+
+00800354 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800354:	55                   	push   %ebp
+  800355:	89 e5                	mov    %esp,%ebp
+  800357:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80035a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80035e:	8b 10                	mov    (%eax),%edx
+  800360:	3b 50 04             	cmp    0x4(%eax),%edx
+  800363:	73 0a                	jae    80036f <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800365:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800368:	89 08                	mov    %ecx,(%eax)
+  80036a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80036d:	88 02                	mov    %al,(%edx)
+}
+  80036f:	5d                   	pop    %ebp
+  800370:	c3                   	ret
+
+00800371 <printfmt>:
+{
+  800371:	55                   	push   %ebp
+  800372:	89 e5                	mov    %esp,%ebp
+  800374:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800377:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80037a:	50                   	push   %eax
+  80037b:	ff 75 10             	push   0x10(%ebp)
+  80037e:	ff 75 0c             	push   0xc(%ebp)
+  800381:	ff 75 08             	push   0x8(%ebp)
+  800384:	e8 05 00 00 00       	call   80038e <vprintfmt>
+}
+  800389:	83 c4 10             	add    $0x10,%esp
+  80038c:	c9                   	leave
+  80038d:	c3                   	ret
+
+0080038e <vprintfmt>:
+{
+  80038e:	55                   	push   %ebp
+  80038f:	89 e5                	mov    %esp,%ebp
+  800391:	57                   	push   %edi
+  800392:	56                   	push   %esi
+  800393:	53                   	push   %ebx
+  800394:	83 ec 3c             	sub    $0x3c,%esp
+  800397:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80039a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80039d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003a4:	eb 16                	jmp    8003bc <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8003a6:	83 ec 08             	sub    $0x8,%esp
+  8003a9:	ff 75 0c             	push   0xc(%ebp)
+  8003ac:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003af:	c1 e2 08             	shl    $0x8,%edx
+  8003b2:	09 d0                	or     %edx,%eax
+  8003b4:	50                   	push   %eax
+  8003b5:	ff d7                	call   *%edi
+  8003b7:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003ba:	89 de                	mov    %ebx,%esi
+  8003bc:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003bf:	0f b6 06             	movzbl (%esi),%eax
+  8003c2:	83 f8 25             	cmp    $0x25,%eax
+  8003c5:	74 0c                	je     8003d3 <vprintfmt+0x45>
+			if (ch == '\0')
+  8003c7:	85 c0                	test   %eax,%eax
+  8003c9:	75 db                	jne    8003a6 <vprintfmt+0x18>
+}
+  8003cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ce:	5b                   	pop    %ebx
+  8003cf:	5e                   	pop    %esi
+  8003d0:	5f                   	pop    %edi
+  8003d1:	5d                   	pop    %ebp
+  8003d2:	c3                   	ret
+		padc = ' ';
+  8003d3:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003d7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003de:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003e5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f1:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003f4:	0f b6 13             	movzbl (%ebx),%edx
+  8003f7:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003fa:	3c 55                	cmp    $0x55,%al
+  8003fc:	0f 87 2c 04 00 00    	ja     80082e <vprintfmt+0x4a0>
+  800402:	0f b6 c0             	movzbl %al,%eax
+  800405:	ff 24 85 60 30 80 00 	jmp    *0x803060(,%eax,4)
+  80040c:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80040e:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800412:	eb dd                	jmp    8003f1 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800414:	89 f3                	mov    %esi,%ebx
+  800416:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80041a:	eb d5                	jmp    8003f1 <vprintfmt+0x63>
+  80041c:	0f b6 d2             	movzbl %dl,%edx
+  80041f:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800421:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800426:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800429:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80042d:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800430:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800433:	83 fe 09             	cmp    $0x9,%esi
+  800436:	0f 87 8a 00 00 00    	ja     8004c6 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80043c:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80043f:	eb e5                	jmp    800426 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800441:	8b 45 14             	mov    0x14(%ebp),%eax
+  800444:	8b 00                	mov    (%eax),%eax
+  800446:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800449:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044c:	8d 40 04             	lea    0x4(%eax),%eax
+  80044f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800452:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800454:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800458:	79 97                	jns    8003f1 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80045a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80045d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800460:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800467:	eb 88                	jmp    8003f1 <vprintfmt+0x63>
+			if (width < 0)
+  800469:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80046c:	85 db                	test   %ebx,%ebx
+  80046e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800473:	0f 49 c3             	cmovns %ebx,%eax
+  800476:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800479:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80047b:	e9 71 ff ff ff       	jmp    8003f1 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800480:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800482:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800489:	e9 63 ff ff ff       	jmp    8003f1 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80048e:	8d 73 02             	lea    0x2(%ebx),%esi
+  800491:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800495:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80049c:	3c 67                	cmp    $0x67,%al
+  80049e:	0f 84 18 ff ff ff    	je     8003bc <vprintfmt+0x2e>
+					attrib = 0x04;
+  8004a4:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8004ab:	3c 72                	cmp    $0x72,%al
+  8004ad:	0f 84 09 ff ff ff    	je     8003bc <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004b3:	3c 62                	cmp    $0x62,%al
+  8004b5:	0f 94 c0             	sete   %al
+  8004b8:	0f b6 c0             	movzbl %al,%eax
+  8004bb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c1:	e9 f6 fe ff ff       	jmp    8003bc <vprintfmt+0x2e>
+  8004c6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c9:	eb 89                	jmp    800454 <vprintfmt+0xc6>
+			lflag++;
+  8004cb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ce:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004d0:	e9 1c ff ff ff       	jmp    8003f1 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004db:	83 ec 08             	sub    $0x8,%esp
+  8004de:	ff 75 0c             	push   0xc(%ebp)
+  8004e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004e4:	c1 e0 08             	shl    $0x8,%eax
+  8004e7:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8004ea:	0b 01                	or     (%ecx),%eax
+  8004ec:	50                   	push   %eax
+  8004ed:	ff d7                	call   *%edi
+			break;
+  8004ef:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004f2:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004f5:	e9 c2 fe ff ff       	jmp    8003bc <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fd:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800500:	8b 10                	mov    (%eax),%edx
+  800502:	89 d0                	mov    %edx,%eax
+  800504:	f7 d8                	neg    %eax
+  800506:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800509:	83 f8 12             	cmp    $0x12,%eax
+  80050c:	7f 25                	jg     800533 <vprintfmt+0x1a5>
+  80050e:	8b 14 85 c0 31 80 00 	mov    0x8031c0(,%eax,4),%edx
+  800515:	85 d2                	test   %edx,%edx
+  800517:	74 1a                	je     800533 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800519:	52                   	push   %edx
+  80051a:	68 01 33 80 00       	push   $0x803301
+  80051f:	ff 75 0c             	push   0xc(%ebp)
+  800522:	57                   	push   %edi
+  800523:	e8 49 fe ff ff       	call   800371 <printfmt>
+  800528:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80052b:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80052e:	e9 89 fe ff ff       	jmp    8003bc <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800533:	50                   	push   %eax
+  800534:	68 33 2f 80 00       	push   $0x802f33
+  800539:	ff 75 0c             	push   0xc(%ebp)
+  80053c:	57                   	push   %edi
+  80053d:	e8 2f fe ff ff       	call   800371 <printfmt>
+  800542:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800545:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800548:	e9 6f fe ff ff       	jmp    8003bc <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80054d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800550:	83 c0 04             	add    $0x4,%eax
+  800553:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80055b:	85 c9                	test   %ecx,%ecx
+  80055d:	b8 2c 2f 80 00       	mov    $0x802f2c,%eax
+  800562:	0f 45 c1             	cmovne %ecx,%eax
+  800565:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800568:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80056c:	7e 06                	jle    800574 <vprintfmt+0x1e6>
+  80056e:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800572:	75 1a                	jne    80058e <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800574:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800577:	c1 e0 08             	shl    $0x8,%eax
+  80057a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80057d:	83 c8 3f             	or     $0x3f,%eax
+  800580:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800583:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800586:	89 75 10             	mov    %esi,0x10(%ebp)
+  800589:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80058c:	eb 6d                	jmp    8005fb <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80058e:	83 ec 08             	sub    $0x8,%esp
+  800591:	ff 75 d0             	push   -0x30(%ebp)
+  800594:	ff 75 c8             	push   -0x38(%ebp)
+  800597:	e8 39 03 00 00       	call   8008d5 <strnlen>
+  80059c:	89 c2                	mov    %eax,%edx
+  80059e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a1:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8005a3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005a6:	c1 e1 08             	shl    $0x8,%ecx
+  8005a9:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8005ad:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005af:	83 c4 10             	add    $0x10,%esp
+  8005b2:	89 c3                	mov    %eax,%ebx
+  8005b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005ba:	89 ce                	mov    %ecx,%esi
+  8005bc:	eb 0f                	jmp    8005cd <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005be:	83 ec 08             	sub    $0x8,%esp
+  8005c1:	ff 75 0c             	push   0xc(%ebp)
+  8005c4:	56                   	push   %esi
+  8005c5:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c7:	83 eb 01             	sub    $0x1,%ebx
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	85 db                	test   %ebx,%ebx
+  8005cf:	7f ed                	jg     8005be <vprintfmt+0x230>
+  8005d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005d4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005d7:	85 c0                	test   %eax,%eax
+  8005d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005de:	0f 49 d0             	cmovns %eax,%edx
+  8005e1:	29 d0                	sub    %edx,%eax
+  8005e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e6:	eb 8c                	jmp    800574 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8005e8:	83 ec 08             	sub    $0x8,%esp
+  8005eb:	ff 75 0c             	push   0xc(%ebp)
+  8005ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005f1:	09 c2                	or     %eax,%edx
+  8005f3:	52                   	push   %edx
+  8005f4:	ff d7                	call   *%edi
+  8005f6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005f9:	89 d9                	mov    %ebx,%ecx
+  8005fb:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005fe:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800602:	0f be d0             	movsbl %al,%edx
+  800605:	85 d2                	test   %edx,%edx
+  800607:	74 2a                	je     800633 <vprintfmt+0x2a5>
+  800609:	85 f6                	test   %esi,%esi
+  80060b:	78 05                	js     800612 <vprintfmt+0x284>
+  80060d:	83 ee 01             	sub    $0x1,%esi
+  800610:	78 3b                	js     80064d <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800612:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800616:	74 d0                	je     8005e8 <vprintfmt+0x25a>
+  800618:	0f be c0             	movsbl %al,%eax
+  80061b:	83 e8 20             	sub    $0x20,%eax
+  80061e:	83 f8 5e             	cmp    $0x5e,%eax
+  800621:	76 c5                	jbe    8005e8 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800623:	83 ec 08             	sub    $0x8,%esp
+  800626:	ff 75 0c             	push   0xc(%ebp)
+  800629:	ff 75 cc             	push   -0x34(%ebp)
+  80062c:	ff d7                	call   *%edi
+  80062e:	83 c4 10             	add    $0x10,%esp
+  800631:	eb c6                	jmp    8005f9 <vprintfmt+0x26b>
+  800633:	8b 75 10             	mov    0x10(%ebp),%esi
+  800636:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800639:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80063c:	01 c3                	add    %eax,%ebx
+  80063e:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800640:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800643:	83 c8 20             	or     $0x20,%eax
+  800646:	89 75 10             	mov    %esi,0x10(%ebp)
+  800649:	89 c6                	mov    %eax,%esi
+  80064b:	eb 14                	jmp    800661 <vprintfmt+0x2d3>
+  80064d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800650:	eb e4                	jmp    800636 <vprintfmt+0x2a8>
+  800652:	83 ec 08             	sub    $0x8,%esp
+  800655:	ff 75 0c             	push   0xc(%ebp)
+  800658:	56                   	push   %esi
+  800659:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80065b:	83 eb 01             	sub    $0x1,%ebx
+  80065e:	83 c4 10             	add    $0x10,%esp
+  800661:	85 db                	test   %ebx,%ebx
+  800663:	7f ed                	jg     800652 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800665:	8b 75 10             	mov    0x10(%ebp),%esi
+  800668:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80066b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066e:	e9 49 fd ff ff       	jmp    8003bc <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800673:	83 f9 01             	cmp    $0x1,%ecx
+  800676:	7f 1f                	jg     800697 <vprintfmt+0x309>
+	else if (lflag)
+  800678:	85 c9                	test   %ecx,%ecx
+  80067a:	74 69                	je     8006e5 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8b 00                	mov    (%eax),%eax
+  800681:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800684:	89 c1                	mov    %eax,%ecx
+  800686:	c1 f9 1f             	sar    $0x1f,%ecx
+  800689:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8d 40 04             	lea    0x4(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+  800695:	eb 17                	jmp    8006ae <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 50 04             	mov    0x4(%eax),%edx
+  80069d:	8b 00                	mov    (%eax),%eax
+  80069f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ae:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006b1:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006b9:	85 db                	test   %ebx,%ebx
+  8006bb:	0f 89 f6 00 00 00    	jns    8007b7 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006c1:	83 ec 08             	sub    $0x8,%esp
+  8006c4:	ff 75 0c             	push   0xc(%ebp)
+  8006c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006ca:	c1 e0 08             	shl    $0x8,%eax
+  8006cd:	83 c8 2d             	or     $0x2d,%eax
+  8006d0:	50                   	push   %eax
+  8006d1:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006d3:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006d6:	f7 d9                	neg    %ecx
+  8006d8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006db:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006e0:	e9 d2 00 00 00       	jmp    8007b7 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	8b 00                	mov    (%eax),%eax
+  8006ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ed:	89 c1                	mov    %eax,%ecx
+  8006ef:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fe:	eb ae                	jmp    8006ae <vprintfmt+0x320>
+	if (lflag >= 2)
+  800700:	83 f9 01             	cmp    $0x1,%ecx
+  800703:	7f 19                	jg     80071e <vprintfmt+0x390>
+	else if (lflag)
+  800705:	85 c9                	test   %ecx,%ecx
+  800707:	74 2a                	je     800733 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070c:	8b 08                	mov    (%eax),%ecx
+  80070e:	8d 40 04             	lea    0x4(%eax),%eax
+  800711:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800714:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800719:	e9 99 00 00 00       	jmp    8007b7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	8b 08                	mov    (%eax),%ecx
+  800723:	8d 40 08             	lea    0x8(%eax),%eax
+  800726:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800729:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80072e:	e9 84 00 00 00       	jmp    8007b7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 08                	mov    (%eax),%ecx
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073e:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800743:	eb 72                	jmp    8007b7 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800745:	83 f9 01             	cmp    $0x1,%ecx
+  800748:	7f 16                	jg     800760 <vprintfmt+0x3d2>
+	else if (lflag)
+  80074a:	85 c9                	test   %ecx,%ecx
+  80074c:	74 24                	je     800772 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 08                	mov    (%eax),%ecx
+  800753:	8d 40 04             	lea    0x4(%eax),%eax
+  800756:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800759:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80075e:	eb 57                	jmp    8007b7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 08                	mov    (%eax),%ecx
+  800765:	8d 40 08             	lea    0x8(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80076b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800770:	eb 45                	jmp    8007b7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 08                	mov    (%eax),%ecx
+  800777:	8d 40 04             	lea    0x4(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80077d:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800782:	eb 33                	jmp    8007b7 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800784:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800787:	c1 e3 08             	shl    $0x8,%ebx
+  80078a:	83 ec 08             	sub    $0x8,%esp
+  80078d:	ff 75 0c             	push   0xc(%ebp)
+  800790:	89 d8                	mov    %ebx,%eax
+  800792:	83 c8 30             	or     $0x30,%eax
+  800795:	50                   	push   %eax
+  800796:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800798:	83 c4 08             	add    $0x8,%esp
+  80079b:	ff 75 0c             	push   0xc(%ebp)
+  80079e:	83 cb 78             	or     $0x78,%ebx
+  8007a1:	53                   	push   %ebx
+  8007a2:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a7:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8007a9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8007af:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b2:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007b7:	ff 75 e4             	push   -0x1c(%ebp)
+  8007ba:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007be:	52                   	push   %edx
+  8007bf:	ff 75 e0             	push   -0x20(%ebp)
+  8007c2:	50                   	push   %eax
+  8007c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007c6:	89 f8                	mov    %edi,%eax
+  8007c8:	e8 f7 fa ff ff       	call   8002c4 <printnum>
+			break;
+  8007cd:	83 c4 10             	add    $0x10,%esp
+  8007d0:	e9 e7 fb ff ff       	jmp    8003bc <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007d5:	83 f9 01             	cmp    $0x1,%ecx
+  8007d8:	7f 16                	jg     8007f0 <vprintfmt+0x462>
+	else if (lflag)
+  8007da:	85 c9                	test   %ecx,%ecx
+  8007dc:	74 24                	je     800802 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	8b 08                	mov    (%eax),%ecx
+  8007e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e9:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8007ee:	eb c7                	jmp    8007b7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f3:	8b 08                	mov    (%eax),%ecx
+  8007f5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007fb:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800800:	eb b5                	jmp    8007b7 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800802:	8b 45 14             	mov    0x14(%ebp),%eax
+  800805:	8b 08                	mov    (%eax),%ecx
+  800807:	8d 40 04             	lea    0x4(%eax),%eax
+  80080a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800812:	eb a3                	jmp    8007b7 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800814:	83 ec 08             	sub    $0x8,%esp
+  800817:	ff 75 0c             	push   0xc(%ebp)
+  80081a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80081d:	c1 e0 08             	shl    $0x8,%eax
+  800820:	83 c8 25             	or     $0x25,%eax
+  800823:	50                   	push   %eax
+  800824:	ff d7                	call   *%edi
+			break;
+  800826:	83 c4 10             	add    $0x10,%esp
+  800829:	e9 8e fb ff ff       	jmp    8003bc <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80082e:	83 ec 08             	sub    $0x8,%esp
+  800831:	ff 75 0c             	push   0xc(%ebp)
+  800834:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800837:	c1 e0 08             	shl    $0x8,%eax
+  80083a:	83 c8 25             	or     $0x25,%eax
+  80083d:	50                   	push   %eax
+  80083e:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800840:	83 c4 10             	add    $0x10,%esp
+  800843:	89 de                	mov    %ebx,%esi
+  800845:	eb 03                	jmp    80084a <vprintfmt+0x4bc>
+  800847:	83 ee 01             	sub    $0x1,%esi
+  80084a:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80084e:	75 f7                	jne    800847 <vprintfmt+0x4b9>
+  800850:	e9 67 fb ff ff       	jmp    8003bc <vprintfmt+0x2e>
+
+00800855 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800855:	55                   	push   %ebp
+  800856:	89 e5                	mov    %esp,%ebp
+  800858:	83 ec 18             	sub    $0x18,%esp
+  80085b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800861:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800864:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800868:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80086b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800872:	85 c0                	test   %eax,%eax
+  800874:	74 26                	je     80089c <vsnprintf+0x47>
+  800876:	85 d2                	test   %edx,%edx
+  800878:	7e 22                	jle    80089c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80087a:	ff 75 14             	push   0x14(%ebp)
+  80087d:	ff 75 10             	push   0x10(%ebp)
+  800880:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800883:	50                   	push   %eax
+  800884:	68 54 03 80 00       	push   $0x800354
+  800889:	e8 00 fb ff ff       	call   80038e <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80088e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800891:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800894:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800897:	83 c4 10             	add    $0x10,%esp
+}
+  80089a:	c9                   	leave
+  80089b:	c3                   	ret
+		return -E_INVAL;
+  80089c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a1:	eb f7                	jmp    80089a <vsnprintf+0x45>
+
+008008a3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008a3:	55                   	push   %ebp
+  8008a4:	89 e5                	mov    %esp,%ebp
+  8008a6:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8008a9:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008ac:	50                   	push   %eax
+  8008ad:	ff 75 10             	push   0x10(%ebp)
+  8008b0:	ff 75 0c             	push   0xc(%ebp)
+  8008b3:	ff 75 08             	push   0x8(%ebp)
+  8008b6:	e8 9a ff ff ff       	call   800855 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008bb:	c9                   	leave
+  8008bc:	c3                   	ret
+
+008008bd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008bd:	55                   	push   %ebp
+  8008be:	89 e5                	mov    %esp,%ebp
+  8008c0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c8:	eb 03                	jmp    8008cd <strlen+0x10>
+		n++;
+  8008ca:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008cd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d1:	75 f7                	jne    8008ca <strlen+0xd>
+	return n;
+}
+  8008d3:	5d                   	pop    %ebp
+  8008d4:	c3                   	ret
+
+008008d5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e3:	eb 03                	jmp    8008e8 <strnlen+0x13>
+		n++;
+  8008e5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e8:	39 d0                	cmp    %edx,%eax
+  8008ea:	74 08                	je     8008f4 <strnlen+0x1f>
+  8008ec:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008f0:	75 f3                	jne    8008e5 <strnlen+0x10>
+  8008f2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008f4:	89 d0                	mov    %edx,%eax
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+
+008008f8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	53                   	push   %ebx
+  8008fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800902:	b8 00 00 00 00       	mov    $0x0,%eax
+  800907:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80090b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80090e:	83 c0 01             	add    $0x1,%eax
+  800911:	84 d2                	test   %dl,%dl
+  800913:	75 f2                	jne    800907 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800915:	89 c8                	mov    %ecx,%eax
+  800917:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80091a:	c9                   	leave
+  80091b:	c3                   	ret
+
+0080091c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80091c:	55                   	push   %ebp
+  80091d:	89 e5                	mov    %esp,%ebp
+  80091f:	53                   	push   %ebx
+  800920:	83 ec 10             	sub    $0x10,%esp
+  800923:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800926:	53                   	push   %ebx
+  800927:	e8 91 ff ff ff       	call   8008bd <strlen>
+  80092c:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80092f:	ff 75 0c             	push   0xc(%ebp)
+  800932:	01 d8                	add    %ebx,%eax
+  800934:	50                   	push   %eax
+  800935:	e8 be ff ff ff       	call   8008f8 <strcpy>
+	return dst;
+}
+  80093a:	89 d8                	mov    %ebx,%eax
+  80093c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093f:	c9                   	leave
+  800940:	c3                   	ret
+
+00800941 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	56                   	push   %esi
+  800945:	53                   	push   %ebx
+  800946:	8b 75 08             	mov    0x8(%ebp),%esi
+  800949:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80094c:	89 f3                	mov    %esi,%ebx
+  80094e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800951:	89 f0                	mov    %esi,%eax
+  800953:	eb 0f                	jmp    800964 <strncpy+0x23>
+		*dst++ = *src;
+  800955:	83 c0 01             	add    $0x1,%eax
+  800958:	0f b6 0a             	movzbl (%edx),%ecx
+  80095b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095e:	80 f9 01             	cmp    $0x1,%cl
+  800961:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800964:	39 d8                	cmp    %ebx,%eax
+  800966:	75 ed                	jne    800955 <strncpy+0x14>
+	}
+	return ret;
+}
+  800968:	89 f0                	mov    %esi,%eax
+  80096a:	5b                   	pop    %ebx
+  80096b:	5e                   	pop    %esi
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	56                   	push   %esi
+  800972:	53                   	push   %ebx
+  800973:	8b 75 08             	mov    0x8(%ebp),%esi
+  800976:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800979:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80097c:	89 f0                	mov    %esi,%eax
+  80097e:	85 d2                	test   %edx,%edx
+  800980:	74 21                	je     8009a3 <strlcpy+0x35>
+  800982:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800986:	89 f2                	mov    %esi,%edx
+  800988:	eb 09                	jmp    800993 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80098a:	83 c1 01             	add    $0x1,%ecx
+  80098d:	83 c2 01             	add    $0x1,%edx
+  800990:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800993:	39 c2                	cmp    %eax,%edx
+  800995:	74 09                	je     8009a0 <strlcpy+0x32>
+  800997:	0f b6 19             	movzbl (%ecx),%ebx
+  80099a:	84 db                	test   %bl,%bl
+  80099c:	75 ec                	jne    80098a <strlcpy+0x1c>
+  80099e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009a0:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009a3:	29 f0                	sub    %esi,%eax
+}
+  8009a5:	5b                   	pop    %ebx
+  8009a6:	5e                   	pop    %esi
+  8009a7:	5d                   	pop    %ebp
+  8009a8:	c3                   	ret
+
+008009a9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009af:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009b2:	eb 06                	jmp    8009ba <strcmp+0x11>
+		p++, q++;
+  8009b4:	83 c1 01             	add    $0x1,%ecx
+  8009b7:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009ba:	0f b6 01             	movzbl (%ecx),%eax
+  8009bd:	84 c0                	test   %al,%al
+  8009bf:	74 04                	je     8009c5 <strcmp+0x1c>
+  8009c1:	3a 02                	cmp    (%edx),%al
+  8009c3:	74 ef                	je     8009b4 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c5:	0f b6 c0             	movzbl %al,%eax
+  8009c8:	0f b6 12             	movzbl (%edx),%edx
+  8009cb:	29 d0                	sub    %edx,%eax
+}
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+
+008009cf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	53                   	push   %ebx
+  8009d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d9:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009dc:	eb 09                	jmp    8009e7 <strncmp+0x18>
+		n--, p++, q++;
+  8009de:	83 ea 01             	sub    $0x1,%edx
+  8009e1:	83 c0 01             	add    $0x1,%eax
+  8009e4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e7:	85 d2                	test   %edx,%edx
+  8009e9:	74 18                	je     800a03 <strncmp+0x34>
+  8009eb:	0f b6 18             	movzbl (%eax),%ebx
+  8009ee:	84 db                	test   %bl,%bl
+  8009f0:	74 04                	je     8009f6 <strncmp+0x27>
+  8009f2:	3a 19                	cmp    (%ecx),%bl
+  8009f4:	74 e8                	je     8009de <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f6:	0f b6 00             	movzbl (%eax),%eax
+  8009f9:	0f b6 11             	movzbl (%ecx),%edx
+  8009fc:	29 d0                	sub    %edx,%eax
+}
+  8009fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a01:	c9                   	leave
+  800a02:	c3                   	ret
+		return 0;
+  800a03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a08:	eb f4                	jmp    8009fe <strncmp+0x2f>
+
+00800a0a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a10:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a14:	eb 03                	jmp    800a19 <strchr+0xf>
+  800a16:	83 c0 01             	add    $0x1,%eax
+  800a19:	0f b6 10             	movzbl (%eax),%edx
+  800a1c:	84 d2                	test   %dl,%dl
+  800a1e:	74 06                	je     800a26 <strchr+0x1c>
+		if (*s == c)
+  800a20:	38 ca                	cmp    %cl,%dl
+  800a22:	75 f2                	jne    800a16 <strchr+0xc>
+  800a24:	eb 05                	jmp    800a2b <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a2b:	5d                   	pop    %ebp
+  800a2c:	c3                   	ret
+
+00800a2d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a33:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a37:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a3a:	38 ca                	cmp    %cl,%dl
+  800a3c:	74 09                	je     800a47 <strfind+0x1a>
+  800a3e:	84 d2                	test   %dl,%dl
+  800a40:	74 05                	je     800a47 <strfind+0x1a>
+	for (; *s; s++)
+  800a42:	83 c0 01             	add    $0x1,%eax
+  800a45:	eb f0                	jmp    800a37 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a47:	5d                   	pop    %ebp
+  800a48:	c3                   	ret
+
+00800a49 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a49:	55                   	push   %ebp
+  800a4a:	89 e5                	mov    %esp,%ebp
+  800a4c:	57                   	push   %edi
+  800a4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a50:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a53:	85 c9                	test   %ecx,%ecx
+  800a55:	74 20                	je     800a77 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a57:	89 f8                	mov    %edi,%eax
+  800a59:	09 c8                	or     %ecx,%eax
+  800a5b:	a8 03                	test   $0x3,%al
+  800a5d:	75 12                	jne    800a71 <memset+0x28>
+		c &= 0xFF;
+  800a5f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a63:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a69:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a6c:	fc                   	cld
+  800a6d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a6f:	eb 06                	jmp    800a77 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a74:	fc                   	cld
+  800a75:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a77:	89 f8                	mov    %edi,%eax
+  800a79:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a7c:	c9                   	leave
+  800a7d:	c3                   	ret
+
+00800a7e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	57                   	push   %edi
+  800a82:	56                   	push   %esi
+  800a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a86:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a89:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a8c:	39 c6                	cmp    %eax,%esi
+  800a8e:	73 32                	jae    800ac2 <memmove+0x44>
+  800a90:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a93:	39 d0                	cmp    %edx,%eax
+  800a95:	73 2b                	jae    800ac2 <memmove+0x44>
+		s += n;
+		d += n;
+  800a97:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a9a:	89 d6                	mov    %edx,%esi
+  800a9c:	09 fe                	or     %edi,%esi
+  800a9e:	09 ce                	or     %ecx,%esi
+  800aa0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa6:	75 0e                	jne    800ab6 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa8:	83 ef 04             	sub    $0x4,%edi
+  800aab:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aae:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ab1:	fd                   	std
+  800ab2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab4:	eb 09                	jmp    800abf <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab6:	83 ef 01             	sub    $0x1,%edi
+  800ab9:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800abc:	fd                   	std
+  800abd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800abf:	fc                   	cld
+  800ac0:	eb 1a                	jmp    800adc <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac2:	89 f2                	mov    %esi,%edx
+  800ac4:	09 c2                	or     %eax,%edx
+  800ac6:	09 ca                	or     %ecx,%edx
+  800ac8:	f6 c2 03             	test   $0x3,%dl
+  800acb:	75 0a                	jne    800ad7 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800acd:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ad0:	89 c7                	mov    %eax,%edi
+  800ad2:	fc                   	cld
+  800ad3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad5:	eb 05                	jmp    800adc <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad7:	89 c7                	mov    %eax,%edi
+  800ad9:	fc                   	cld
+  800ada:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800adc:	5e                   	pop    %esi
+  800add:	5f                   	pop    %edi
+  800ade:	5d                   	pop    %ebp
+  800adf:	c3                   	ret
+
+00800ae0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae6:	ff 75 10             	push   0x10(%ebp)
+  800ae9:	ff 75 0c             	push   0xc(%ebp)
+  800aec:	ff 75 08             	push   0x8(%ebp)
+  800aef:	e8 8a ff ff ff       	call   800a7e <memmove>
+}
+  800af4:	c9                   	leave
+  800af5:	c3                   	ret
+
+00800af6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af6:	55                   	push   %ebp
+  800af7:	89 e5                	mov    %esp,%ebp
+  800af9:	56                   	push   %esi
+  800afa:	53                   	push   %ebx
+  800afb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b01:	89 c6                	mov    %eax,%esi
+  800b03:	03 75 10             	add    0x10(%ebp),%esi
+  800b06:	eb 06                	jmp    800b0e <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b08:	83 c0 01             	add    $0x1,%eax
+  800b0b:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b0e:	39 f0                	cmp    %esi,%eax
+  800b10:	74 14                	je     800b26 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b12:	0f b6 08             	movzbl (%eax),%ecx
+  800b15:	0f b6 1a             	movzbl (%edx),%ebx
+  800b18:	38 d9                	cmp    %bl,%cl
+  800b1a:	74 ec                	je     800b08 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b1c:	0f b6 c1             	movzbl %cl,%eax
+  800b1f:	0f b6 db             	movzbl %bl,%ebx
+  800b22:	29 d8                	sub    %ebx,%eax
+  800b24:	eb 05                	jmp    800b2b <memcmp+0x35>
+	}
+
+	return 0;
+  800b26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b2b:	5b                   	pop    %ebx
+  800b2c:	5e                   	pop    %esi
+  800b2d:	5d                   	pop    %ebp
+  800b2e:	c3                   	ret
+
+00800b2f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b2f:	55                   	push   %ebp
+  800b30:	89 e5                	mov    %esp,%ebp
+  800b32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b38:	89 c2                	mov    %eax,%edx
+  800b3a:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b3d:	eb 03                	jmp    800b42 <memfind+0x13>
+  800b3f:	83 c0 01             	add    $0x1,%eax
+  800b42:	39 d0                	cmp    %edx,%eax
+  800b44:	73 04                	jae    800b4a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b46:	38 08                	cmp    %cl,(%eax)
+  800b48:	75 f5                	jne    800b3f <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b4a:	5d                   	pop    %ebp
+  800b4b:	c3                   	ret
+
+00800b4c <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b4c:	55                   	push   %ebp
+  800b4d:	89 e5                	mov    %esp,%ebp
+  800b4f:	57                   	push   %edi
+  800b50:	56                   	push   %esi
+  800b51:	53                   	push   %ebx
+  800b52:	83 ec 1c             	sub    $0x1c,%esp
+  800b55:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b58:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b5b:	eb 03                	jmp    800b60 <strtol+0x14>
+		s++;
+  800b5d:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b60:	0f b6 06             	movzbl (%esi),%eax
+  800b63:	3c 20                	cmp    $0x20,%al
+  800b65:	74 f6                	je     800b5d <strtol+0x11>
+  800b67:	3c 09                	cmp    $0x9,%al
+  800b69:	74 f2                	je     800b5d <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b6b:	3c 2b                	cmp    $0x2b,%al
+  800b6d:	74 43                	je     800bb2 <strtol+0x66>
+	int neg = 0;
+  800b6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b74:	3c 2d                	cmp    $0x2d,%al
+  800b76:	74 44                	je     800bbc <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b78:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b7e:	75 0f                	jne    800b8f <strtol+0x43>
+  800b80:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b83:	74 41                	je     800bc6 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b85:	85 ff                	test   %edi,%edi
+  800b87:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b8c:	0f 44 f8             	cmove  %eax,%edi
+  800b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b94:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b99:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b9c:	89 fb                	mov    %edi,%ebx
+  800b9e:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ba1:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ba4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ba7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800baa:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800bad:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bb0:	eb 67                	jmp    800c19 <strtol+0xcd>
+		s++;
+  800bb2:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800bb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bba:	eb bc                	jmp    800b78 <strtol+0x2c>
+		s++, neg = 1;
+  800bbc:	83 c6 01             	add    $0x1,%esi
+  800bbf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bc4:	eb b2                	jmp    800b78 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bc6:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800bca:	74 0e                	je     800bda <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800bcc:	85 ff                	test   %edi,%edi
+  800bce:	75 bf                	jne    800b8f <strtol+0x43>
+		s++, base = 8;
+  800bd0:	83 c6 01             	add    $0x1,%esi
+  800bd3:	bf 08 00 00 00       	mov    $0x8,%edi
+  800bd8:	eb b5                	jmp    800b8f <strtol+0x43>
+		s += 2, base = 16;
+  800bda:	83 c6 02             	add    $0x2,%esi
+  800bdd:	bf 10 00 00 00       	mov    $0x10,%edi
+  800be2:	eb ab                	jmp    800b8f <strtol+0x43>
+			dig = *s - '0';
+  800be4:	0f be c9             	movsbl %cl,%ecx
+  800be7:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800bea:	39 f9                	cmp    %edi,%ecx
+  800bec:	7d 59                	jge    800c47 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800bee:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800bf2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bf5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bf8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bfb:	0f af d8             	imul   %eax,%ebx
+  800bfe:	0f af d7             	imul   %edi,%edx
+  800c01:	01 d3                	add    %edx,%ebx
+  800c03:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c06:	f7 e7                	mul    %edi
+  800c08:	01 da                	add    %ebx,%edx
+  800c0a:	89 cb                	mov    %ecx,%ebx
+  800c0c:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c0f:	01 c8                	add    %ecx,%eax
+  800c11:	11 da                	adc    %ebx,%edx
+  800c13:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c16:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1c:	0f b6 08             	movzbl (%eax),%ecx
+  800c1f:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c22:	80 fb 09             	cmp    $0x9,%bl
+  800c25:	76 bd                	jbe    800be4 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c27:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c2a:	80 fb 19             	cmp    $0x19,%bl
+  800c2d:	77 08                	ja     800c37 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c2f:	0f be c9             	movsbl %cl,%ecx
+  800c32:	83 e9 57             	sub    $0x57,%ecx
+  800c35:	eb b3                	jmp    800bea <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c37:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c3a:	80 fb 19             	cmp    $0x19,%bl
+  800c3d:	77 08                	ja     800c47 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c3f:	0f be c9             	movsbl %cl,%ecx
+  800c42:	83 e9 37             	sub    $0x37,%ecx
+  800c45:	eb a3                	jmp    800bea <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c47:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c4a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c4d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c50:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c53:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c57:	74 05                	je     800c5e <strtol+0x112>
+		*endptr = (char *) s;
+  800c59:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c5c:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c5e:	85 c9                	test   %ecx,%ecx
+  800c60:	74 07                	je     800c69 <strtol+0x11d>
+  800c62:	f7 d8                	neg    %eax
+  800c64:	83 d2 00             	adc    $0x0,%edx
+  800c67:	f7 da                	neg    %edx
+}
+  800c69:	83 c4 1c             	add    $0x1c,%esp
+  800c6c:	5b                   	pop    %ebx
+  800c6d:	5e                   	pop    %esi
+  800c6e:	5f                   	pop    %edi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+
+00800c71 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	57                   	push   %edi
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c77:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c7e:	74 18                	je     800c98 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8b:	89 c3                	mov    %eax,%ebx
+  800c8d:	89 c7                	mov    %eax,%edi
+  800c8f:	89 c6                	mov    %eax,%esi
+  800c91:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c93:	5b                   	pop    %ebx
+  800c94:	5e                   	pop    %esi
+  800c95:	5f                   	pop    %edi
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca3:	89 c3                	mov    %eax,%ebx
+  800ca5:	89 c7                	mov    %eax,%edi
+  800ca7:	55                   	push   %ebp
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	8d 35 b2 0c 80 00    	lea    0x800cb2,%esi
+  800cb0:	0f 34                	sysenter
+  800cb2:	5d                   	pop    %ebp
+		goto out;
+  800cb3:	eb de                	jmp    800c93 <sys_cputs+0x22>
+
+00800cb5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	57                   	push   %edi
+  800cb9:	56                   	push   %esi
+  800cba:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cbb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cc2:	74 19                	je     800cdd <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800cc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cce:	89 d1                	mov    %edx,%ecx
+  800cd0:	89 d3                	mov    %edx,%ebx
+  800cd2:	89 d7                	mov    %edx,%edi
+  800cd4:	89 d6                	mov    %edx,%esi
+  800cd6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cd8:	5b                   	pop    %ebx
+  800cd9:	5e                   	pop    %esi
+  800cda:	5f                   	pop    %edi
+  800cdb:	5d                   	pop    %ebp
+  800cdc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce2:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ce7:	89 d1                	mov    %edx,%ecx
+  800ce9:	89 d3                	mov    %edx,%ebx
+  800ceb:	89 d7                	mov    %edx,%edi
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	8d 35 f8 0c 80 00    	lea    0x800cf8,%esi
+  800cf6:	0f 34                	sysenter
+  800cf8:	5d                   	pop    %ebp
+		goto out;
+  800cf9:	eb dd                	jmp    800cd8 <sys_cgetc+0x23>
+
+00800cfb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cfb:	55                   	push   %ebp
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	57                   	push   %edi
+  800cff:	56                   	push   %esi
+  800d00:	53                   	push   %ebx
+  800d01:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d04:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d0b:	74 21                	je     800d2e <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d12:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1a:	89 cb                	mov    %ecx,%ebx
+  800d1c:	89 cf                	mov    %ecx,%edi
+  800d1e:	89 ce                	mov    %ecx,%esi
+  800d20:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d22:	85 c0                	test   %eax,%eax
+  800d24:	7f 27                	jg     800d4d <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d29:	5b                   	pop    %ebx
+  800d2a:	5e                   	pop    %esi
+  800d2b:	5f                   	pop    %edi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d36:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d3b:	89 cb                	mov    %ecx,%ebx
+  800d3d:	89 cf                	mov    %ecx,%edi
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	8d 35 4a 0d 80 00    	lea    0x800d4a,%esi
+  800d48:	0f 34                	sysenter
+  800d4a:	5d                   	pop    %ebp
+		goto out;
+  800d4b:	eb d5                	jmp    800d22 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4d:	83 ec 0c             	sub    $0xc,%esp
+  800d50:	50                   	push   %eax
+  800d51:	6a 03                	push   $0x3
+  800d53:	68 2b 32 80 00       	push   $0x80322b
+  800d58:	6a 3f                	push   $0x3f
+  800d5a:	68 48 32 80 00       	push   $0x803248
+  800d5f:	e8 71 f4 ff ff       	call   8001d5 <_panic>
+
+00800d64 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d6a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d71:	74 19                	je     800d8c <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d78:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d7d:	89 d1                	mov    %edx,%ecx
+  800d7f:	89 d3                	mov    %edx,%ebx
+  800d81:	89 d7                	mov    %edx,%edi
+  800d83:	89 d6                	mov    %edx,%esi
+  800d85:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d87:	5b                   	pop    %ebx
+  800d88:	5e                   	pop    %esi
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d91:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d96:	89 d1                	mov    %edx,%ecx
+  800d98:	89 d3                	mov    %edx,%ebx
+  800d9a:	89 d7                	mov    %edx,%edi
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	8d 35 a7 0d 80 00    	lea    0x800da7,%esi
+  800da5:	0f 34                	sysenter
+  800da7:	5d                   	pop    %ebp
+		goto out;
+  800da8:	eb dd                	jmp    800d87 <sys_getenvid+0x23>
+
+00800daa <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800db0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800db7:	74 19                	je     800dd2 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800db9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbe:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dc3:	89 d1                	mov    %edx,%ecx
+  800dc5:	89 d3                	mov    %edx,%ebx
+  800dc7:	89 d7                	mov    %edx,%edi
+  800dc9:	89 d6                	mov    %edx,%esi
+  800dcb:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dcd:	5b                   	pop    %ebx
+  800dce:	5e                   	pop    %esi
+  800dcf:	5f                   	pop    %edi
+  800dd0:	5d                   	pop    %ebp
+  800dd1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ddc:	89 d1                	mov    %edx,%ecx
+  800dde:	89 d3                	mov    %edx,%ebx
+  800de0:	89 d7                	mov    %edx,%edi
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	8d 35 ed 0d 80 00    	lea    0x800ded,%esi
+  800deb:	0f 34                	sysenter
+  800ded:	5d                   	pop    %ebp
+		goto out;
+  800dee:	eb dd                	jmp    800dcd <sys_yield+0x23>
+
+00800df0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	57                   	push   %edi
+  800df4:	56                   	push   %esi
+  800df5:	53                   	push   %ebx
+  800df6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800df9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e00:	74 23                	je     800e25 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e02:	be 00 00 00 00       	mov    $0x0,%esi
+  800e07:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e15:	89 f7                	mov    %esi,%edi
+  800e17:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e19:	85 c0                	test   %eax,%eax
+  800e1b:	7f 29                	jg     800e46 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5f                   	pop    %edi
+  800e23:	5d                   	pop    %ebp
+  800e24:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e30:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	8d 35 43 0e 80 00    	lea    0x800e43,%esi
+  800e41:	0f 34                	sysenter
+  800e43:	5d                   	pop    %ebp
+		goto out;
+  800e44:	eb d3                	jmp    800e19 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e46:	83 ec 0c             	sub    $0xc,%esp
+  800e49:	50                   	push   %eax
+  800e4a:	6a 04                	push   $0x4
+  800e4c:	68 2b 32 80 00       	push   $0x80322b
+  800e51:	6a 3f                	push   $0x3f
+  800e53:	68 48 32 80 00       	push   $0x803248
+  800e58:	e8 78 f3 ff ff       	call   8001d5 <_panic>
+
+00800e5d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	57                   	push   %edi
+  800e61:	56                   	push   %esi
+  800e62:	53                   	push   %ebx
+  800e63:	83 ec 0c             	sub    $0xc,%esp
+  800e66:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e69:	85 f6                	test   %esi,%esi
+  800e6b:	75 09                	jne    800e76 <sys_page_map+0x19>
+  800e6d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e74:	74 1f                	je     800e95 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e76:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	7f 27                	jg     800eb4 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ea0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	8d 35 b1 0e 80 00    	lea    0x800eb1,%esi
+  800eaf:	0f 34                	sysenter
+  800eb1:	5d                   	pop    %ebp
+		goto out;
+  800eb2:	eb d5                	jmp    800e89 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+  800eb7:	50                   	push   %eax
+  800eb8:	6a 05                	push   $0x5
+  800eba:	68 2b 32 80 00       	push   $0x80322b
+  800ebf:	6a 3f                	push   $0x3f
+  800ec1:	68 48 32 80 00       	push   $0x803248
+  800ec6:	e8 0a f3 ff ff       	call   8001d5 <_panic>
+
+00800ecb <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	57                   	push   %edi
+  800ecf:	56                   	push   %esi
+  800ed0:	53                   	push   %ebx
+  800ed1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ed4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800edb:	74 22                	je     800eff <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800edd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee2:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	89 df                	mov    %ebx,%edi
+  800eef:	89 de                	mov    %ebx,%esi
+  800ef1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef3:	85 c0                	test   %eax,%eax
+  800ef5:	7f 28                	jg     800f1f <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ef7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efa:	5b                   	pop    %ebx
+  800efb:	5e                   	pop    %esi
+  800efc:	5f                   	pop    %edi
+  800efd:	5d                   	pop    %ebp
+  800efe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f0f:	89 df                	mov    %ebx,%edi
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	8d 35 1c 0f 80 00    	lea    0x800f1c,%esi
+  800f1a:	0f 34                	sysenter
+  800f1c:	5d                   	pop    %ebp
+		goto out;
+  800f1d:	eb d4                	jmp    800ef3 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+  800f22:	50                   	push   %eax
+  800f23:	6a 06                	push   $0x6
+  800f25:	68 2b 32 80 00       	push   $0x80322b
+  800f2a:	6a 3f                	push   $0x3f
+  800f2c:	68 48 32 80 00       	push   $0x803248
+  800f31:	e8 9f f2 ff ff       	call   8001d5 <_panic>
+
+00800f36 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+  800f39:	57                   	push   %edi
+  800f3a:	56                   	push   %esi
+  800f3b:	53                   	push   %ebx
+  800f3c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f3f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f46:	74 22                	je     800f6a <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f48:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f58:	89 df                	mov    %ebx,%edi
+  800f5a:	89 de                	mov    %ebx,%esi
+  800f5c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5e:	85 c0                	test   %eax,%eax
+  800f60:	7f 28                	jg     800f8a <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f65:	5b                   	pop    %ebx
+  800f66:	5e                   	pop    %esi
+  800f67:	5f                   	pop    %edi
+  800f68:	5d                   	pop    %ebp
+  800f69:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f7a:	89 df                	mov    %ebx,%edi
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	8d 35 87 0f 80 00    	lea    0x800f87,%esi
+  800f85:	0f 34                	sysenter
+  800f87:	5d                   	pop    %ebp
+		goto out;
+  800f88:	eb d4                	jmp    800f5e <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+  800f8d:	50                   	push   %eax
+  800f8e:	6a 08                	push   $0x8
+  800f90:	68 2b 32 80 00       	push   $0x80322b
+  800f95:	6a 3f                	push   $0x3f
+  800f97:	68 48 32 80 00       	push   $0x803248
+  800f9c:	e8 34 f2 ff ff       	call   8001d5 <_panic>
+
+00800fa1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	57                   	push   %edi
+  800fa5:	56                   	push   %esi
+  800fa6:	53                   	push   %ebx
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800faa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fb1:	74 22                	je     800fd5 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb8:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc3:	89 df                	mov    %ebx,%edi
+  800fc5:	89 de                	mov    %ebx,%esi
+  800fc7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc9:	85 c0                	test   %eax,%eax
+  800fcb:	7f 28                	jg     800ff5 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd0:	5b                   	pop    %ebx
+  800fd1:	5e                   	pop    %esi
+  800fd2:	5f                   	pop    %edi
+  800fd3:	5d                   	pop    %ebp
+  800fd4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe0:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fe5:	89 df                	mov    %ebx,%edi
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	8d 35 f2 0f 80 00    	lea    0x800ff2,%esi
+  800ff0:	0f 34                	sysenter
+  800ff2:	5d                   	pop    %ebp
+		goto out;
+  800ff3:	eb d4                	jmp    800fc9 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff5:	83 ec 0c             	sub    $0xc,%esp
+  800ff8:	50                   	push   %eax
+  800ff9:	6a 09                	push   $0x9
+  800ffb:	68 2b 32 80 00       	push   $0x80322b
+  801000:	6a 3f                	push   $0x3f
+  801002:	68 48 32 80 00       	push   $0x803248
+  801007:	e8 c9 f1 ff ff       	call   8001d5 <_panic>
+
+0080100c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	57                   	push   %edi
+  801010:	56                   	push   %esi
+  801011:	53                   	push   %ebx
+  801012:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801015:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80101c:	74 22                	je     801040 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80101e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801023:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102e:	89 df                	mov    %ebx,%edi
+  801030:	89 de                	mov    %ebx,%esi
+  801032:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801034:	85 c0                	test   %eax,%eax
+  801036:	7f 28                	jg     801060 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801038:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103b:	5b                   	pop    %ebx
+  80103c:	5e                   	pop    %esi
+  80103d:	5f                   	pop    %edi
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801040:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801045:	8b 55 08             	mov    0x8(%ebp),%edx
+  801048:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801050:	89 df                	mov    %ebx,%edi
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	8d 35 5d 10 80 00    	lea    0x80105d,%esi
+  80105b:	0f 34                	sysenter
+  80105d:	5d                   	pop    %ebp
+		goto out;
+  80105e:	eb d4                	jmp    801034 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801060:	83 ec 0c             	sub    $0xc,%esp
+  801063:	50                   	push   %eax
+  801064:	6a 0a                	push   $0xa
+  801066:	68 2b 32 80 00       	push   $0x80322b
+  80106b:	6a 3f                	push   $0x3f
+  80106d:	68 48 32 80 00       	push   $0x803248
+  801072:	e8 5e f1 ff ff       	call   8001d5 <_panic>
+
+00801077 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801080:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801087:	74 22                	je     8010ab <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801089:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801093:	8b 55 08             	mov    0x8(%ebp),%edx
+  801096:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801099:	89 df                	mov    %ebx,%edi
+  80109b:	89 de                	mov    %ebx,%esi
+  80109d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109f:	85 c0                	test   %eax,%eax
+  8010a1:	7f 28                	jg     8010cb <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8010a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a6:	5b                   	pop    %ebx
+  8010a7:	5e                   	pop    %esi
+  8010a8:	5f                   	pop    %edi
+  8010a9:	5d                   	pop    %ebp
+  8010aa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010bb:	89 df                	mov    %ebx,%edi
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	8d 35 c8 10 80 00    	lea    0x8010c8,%esi
+  8010c6:	0f 34                	sysenter
+  8010c8:	5d                   	pop    %ebp
+		goto out;
+  8010c9:	eb d4                	jmp    80109f <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 17                	push   $0x17
+  8010d1:	68 2b 32 80 00       	push   $0x80322b
+  8010d6:	6a 3f                	push   $0x3f
+  8010d8:	68 48 32 80 00       	push   $0x803248
+  8010dd:	e8 f3 f0 ff ff       	call   8001d5 <_panic>
+
+008010e2 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+  8010e8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010eb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010f2:	74 22                	je     801116 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f9:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801104:	89 df                	mov    %ebx,%edi
+  801106:	89 de                	mov    %ebx,%esi
+  801108:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	7f 28                	jg     801136 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80110e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801111:	5b                   	pop    %ebx
+  801112:	5e                   	pop    %esi
+  801113:	5f                   	pop    %edi
+  801114:	5d                   	pop    %ebp
+  801115:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801116:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801121:	b8 18 00 00 00       	mov    $0x18,%eax
+  801126:	89 df                	mov    %ebx,%edi
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	8d 35 33 11 80 00    	lea    0x801133,%esi
+  801131:	0f 34                	sysenter
+  801133:	5d                   	pop    %ebp
+		goto out;
+  801134:	eb d4                	jmp    80110a <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801136:	83 ec 0c             	sub    $0xc,%esp
+  801139:	50                   	push   %eax
+  80113a:	6a 18                	push   $0x18
+  80113c:	68 2b 32 80 00       	push   $0x80322b
+  801141:	6a 3f                	push   $0x3f
+  801143:	68 48 32 80 00       	push   $0x803248
+  801148:	e8 88 f0 ff ff       	call   8001d5 <_panic>
+
+0080114d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80114d:	55                   	push   %ebp
+  80114e:	89 e5                	mov    %esp,%ebp
+  801150:	57                   	push   %edi
+  801151:	56                   	push   %esi
+  801152:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801153:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80115a:	74 1d                	je     801179 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80115c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801161:	be 00 00 00 00       	mov    $0x0,%esi
+  801166:	8b 55 08             	mov    0x8(%ebp),%edx
+  801169:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801172:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801174:	5b                   	pop    %ebx
+  801175:	5e                   	pop    %esi
+  801176:	5f                   	pop    %edi
+  801177:	5d                   	pop    %ebp
+  801178:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801179:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801184:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801187:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	8d 35 95 11 80 00    	lea    0x801195,%esi
+  801193:	0f 34                	sysenter
+  801195:	5d                   	pop    %ebp
+		goto out;
+  801196:	eb dc                	jmp    801174 <sys_ipc_try_send+0x27>
+
+00801198 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801198:	55                   	push   %ebp
+  801199:	89 e5                	mov    %esp,%ebp
+  80119b:	57                   	push   %edi
+  80119c:	56                   	push   %esi
+  80119d:	53                   	push   %ebx
+  80119e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011a1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011a8:	74 21                	je     8011cb <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8011aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011af:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b7:	89 cb                	mov    %ecx,%ebx
+  8011b9:	89 cf                	mov    %ecx,%edi
+  8011bb:	89 ce                	mov    %ecx,%esi
+  8011bd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011bf:	85 c0                	test   %eax,%eax
+  8011c1:	7f 27                	jg     8011ea <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c6:	5b                   	pop    %ebx
+  8011c7:	5e                   	pop    %esi
+  8011c8:	5f                   	pop    %edi
+  8011c9:	5d                   	pop    %ebp
+  8011ca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011d8:	89 cb                	mov    %ecx,%ebx
+  8011da:	89 cf                	mov    %ecx,%edi
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	8d 35 e7 11 80 00    	lea    0x8011e7,%esi
+  8011e5:	0f 34                	sysenter
+  8011e7:	5d                   	pop    %ebp
+		goto out;
+  8011e8:	eb d5                	jmp    8011bf <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ea:	83 ec 0c             	sub    $0xc,%esp
+  8011ed:	50                   	push   %eax
+  8011ee:	6a 0d                	push   $0xd
+  8011f0:	68 2b 32 80 00       	push   $0x80322b
+  8011f5:	6a 3f                	push   $0x3f
+  8011f7:	68 48 32 80 00       	push   $0x803248
+  8011fc:	e8 d4 ef ff ff       	call   8001d5 <_panic>
+
+00801201 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	57                   	push   %edi
+  801205:	56                   	push   %esi
+  801206:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801207:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80120e:	74 1b                	je     80122b <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801215:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80121a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801220:	89 df                	mov    %ebx,%edi
+  801222:	89 de                	mov    %ebx,%esi
+  801224:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801226:	5b                   	pop    %ebx
+  801227:	5e                   	pop    %esi
+  801228:	5f                   	pop    %edi
+  801229:	5d                   	pop    %ebp
+  80122a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80122b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801230:	8b 55 08             	mov    0x8(%ebp),%edx
+  801233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801236:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80123b:	89 df                	mov    %ebx,%edi
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	8d 35 48 12 80 00    	lea    0x801248,%esi
+  801246:	0f 34                	sysenter
+  801248:	5d                   	pop    %ebp
+		goto out;
+  801249:	eb db                	jmp    801226 <sys_ipc_recv_until+0x25>
+
+0080124b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801251:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801258:	74 19                	je     801273 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80125a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801264:	89 d1                	mov    %edx,%ecx
+  801266:	89 d3                	mov    %edx,%ebx
+  801268:	89 d7                	mov    %edx,%edi
+  80126a:	89 d6                	mov    %edx,%esi
+  80126c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80126e:	5b                   	pop    %ebx
+  80126f:	5e                   	pop    %esi
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801273:	ba 00 00 00 00       	mov    $0x0,%edx
+  801278:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80127d:	89 d1                	mov    %edx,%ecx
+  80127f:	89 d3                	mov    %edx,%ebx
+  801281:	89 d7                	mov    %edx,%edi
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	8d 35 8e 12 80 00    	lea    0x80128e,%esi
+  80128c:	0f 34                	sysenter
+  80128e:	5d                   	pop    %ebp
+		goto out;
+  80128f:	eb dd                	jmp    80126e <sys_time_msec+0x23>
+
+00801291 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801291:	55                   	push   %ebp
+  801292:	89 e5                	mov    %esp,%ebp
+  801294:	57                   	push   %edi
+  801295:	56                   	push   %esi
+  801296:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801297:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80129e:	74 1a                	je     8012ba <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8012a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012a5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ad:	89 cb                	mov    %ecx,%ebx
+  8012af:	89 cf                	mov    %ecx,%edi
+  8012b1:	89 ce                	mov    %ecx,%esi
+  8012b3:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012b5:	5b                   	pop    %ebx
+  8012b6:	5e                   	pop    %esi
+  8012b7:	5f                   	pop    %edi
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012c7:	89 cb                	mov    %ecx,%ebx
+  8012c9:	89 cf                	mov    %ecx,%edi
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	8d 35 d6 12 80 00    	lea    0x8012d6,%esi
+  8012d4:	0f 34                	sysenter
+  8012d6:	5d                   	pop    %ebp
+		goto out;
+  8012d7:	eb dc                	jmp    8012b5 <sys_sleep_until+0x24>
+
+008012d9 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	57                   	push   %edi
+  8012dd:	56                   	push   %esi
+  8012de:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012df:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012e6:	74 1a                	je     801302 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8012e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ed:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f5:	89 cb                	mov    %ecx,%ebx
+  8012f7:	89 cf                	mov    %ecx,%edi
+  8012f9:	89 ce                	mov    %ecx,%esi
+  8012fb:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012fd:	5b                   	pop    %ebx
+  8012fe:	5e                   	pop    %esi
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801302:	8b 55 08             	mov    0x8(%ebp),%edx
+  801305:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80130f:	89 cb                	mov    %ecx,%ebx
+  801311:	89 cf                	mov    %ecx,%edi
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  801316:	8d 35 1e 13 80 00    	lea    0x80131e,%esi
+  80131c:	0f 34                	sysenter
+  80131e:	5d                   	pop    %ebp
+		goto out;
+  80131f:	eb dc                	jmp    8012fd <sys_env_print_stats+0x24>
+
+00801321 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801321:	55                   	push   %ebp
+  801322:	89 e5                	mov    %esp,%ebp
+  801324:	57                   	push   %edi
+  801325:	56                   	push   %esi
+  801326:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801327:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80132e:	74 1b                	je     80134b <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801335:	b8 19 00 00 00       	mov    $0x19,%eax
+  80133a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	89 df                	mov    %ebx,%edi
+  801342:	89 de                	mov    %ebx,%esi
+  801344:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801346:	5b                   	pop    %ebx
+  801347:	5e                   	pop    %esi
+  801348:	5f                   	pop    %edi
+  801349:	5d                   	pop    %ebp
+  80134a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80134b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801350:	8b 55 08             	mov    0x8(%ebp),%edx
+  801353:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801356:	b8 19 00 00 00       	mov    $0x19,%eax
+  80135b:	89 df                	mov    %ebx,%edi
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	8d 35 68 13 80 00    	lea    0x801368,%esi
+  801366:	0f 34                	sysenter
+  801368:	5d                   	pop    %ebp
+		goto out;
+  801369:	eb db                	jmp    801346 <sys_perf+0x25>
+
+0080136b <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80136b:	55                   	push   %ebp
+  80136c:	89 e5                	mov    %esp,%ebp
+  80136e:	57                   	push   %edi
+  80136f:	56                   	push   %esi
+  801370:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801371:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801378:	74 19                	je     801393 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80137a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801384:	89 d1                	mov    %edx,%ecx
+  801386:	89 d3                	mov    %edx,%ebx
+  801388:	89 d7                	mov    %edx,%edi
+  80138a:	89 d6                	mov    %edx,%esi
+  80138c:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80138e:	5b                   	pop    %ebx
+  80138f:	5e                   	pop    %esi
+  801390:	5f                   	pop    %edi
+  801391:	5d                   	pop    %ebp
+  801392:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801393:	ba 00 00 00 00       	mov    $0x0,%edx
+  801398:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80139d:	89 d1                	mov    %edx,%ecx
+  80139f:	89 d3                	mov    %edx,%ebx
+  8013a1:	89 d7                	mov    %edx,%edi
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	8d 35 ae 13 80 00    	lea    0x8013ae,%esi
+  8013ac:	0f 34                	sysenter
+  8013ae:	5d                   	pop    %ebp
+		goto out;
+  8013af:	eb dd                	jmp    80138e <sys_fork+0x23>
+
+008013b1 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8013b1:	55                   	push   %ebp
+  8013b2:	89 e5                	mov    %esp,%ebp
+  8013b4:	57                   	push   %edi
+  8013b5:	56                   	push   %esi
+  8013b6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013b7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013be:	74 1c                	je     8013dc <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d3:	89 f7                	mov    %esi,%edi
+  8013d5:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013d7:	5b                   	pop    %ebx
+  8013d8:	5e                   	pop    %esi
+  8013d9:	5f                   	pop    %edi
+  8013da:	5d                   	pop    %ebp
+  8013db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ef:	55                   	push   %ebp
+  8013f0:	89 e5                	mov    %esp,%ebp
+  8013f2:	8d 35 fa 13 80 00    	lea    0x8013fa,%esi
+  8013f8:	0f 34                	sysenter
+  8013fa:	5d                   	pop    %ebp
+		goto out;
+  8013fb:	eb da                	jmp    8013d7 <sys_thread_create+0x26>
+
+008013fd <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013fd:	55                   	push   %ebp
+  8013fe:	89 e5                	mov    %esp,%ebp
+  801400:	57                   	push   %edi
+  801401:	56                   	push   %esi
+  801402:	53                   	push   %ebx
+  801403:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801406:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80140d:	74 24                	je     801433 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80140f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801414:	be 00 00 00 00       	mov    $0x0,%esi
+  801419:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801422:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801425:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801427:	85 c0                	test   %eax,%eax
+  801429:	7f 27                	jg     801452 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80142b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142e:	5b                   	pop    %ebx
+  80142f:	5e                   	pop    %esi
+  801430:	5f                   	pop    %edi
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801433:	8b 55 08             	mov    0x8(%ebp),%edx
+  801436:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801439:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80143e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801441:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801444:	55                   	push   %ebp
+  801445:	89 e5                	mov    %esp,%ebp
+  801447:	8d 35 4f 14 80 00    	lea    0x80144f,%esi
+  80144d:	0f 34                	sysenter
+  80144f:	5d                   	pop    %ebp
+		goto out;
+  801450:	eb d5                	jmp    801427 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801452:	83 ec 0c             	sub    $0xc,%esp
+  801455:	50                   	push   %eax
+  801456:	6a 1f                	push   $0x1f
+  801458:	68 2b 32 80 00       	push   $0x80322b
+  80145d:	6a 3f                	push   $0x3f
+  80145f:	68 48 32 80 00       	push   $0x803248
+  801464:	e8 6c ed ff ff       	call   8001d5 <_panic>
+
+00801469 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  80146c:	57                   	push   %edi
+  80146d:	56                   	push   %esi
+  80146e:	53                   	push   %ebx
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801472:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801479:	74 23                	je     80149e <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80147b:	be 00 00 00 00       	mov    $0x0,%esi
+  801480:	b8 20 00 00 00       	mov    $0x20,%eax
+  801485:	8b 55 08             	mov    0x8(%ebp),%edx
+  801488:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80148e:	89 f7                	mov    %esi,%edi
+  801490:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801492:	85 c0                	test   %eax,%eax
+  801494:	7f 29                	jg     8014bf <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801496:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801499:	5b                   	pop    %ebx
+  80149a:	5e                   	pop    %esi
+  80149b:	5f                   	pop    %edi
+  80149c:	5d                   	pop    %ebp
+  80149d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80149e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	8d 35 bc 14 80 00    	lea    0x8014bc,%esi
+  8014ba:	0f 34                	sysenter
+  8014bc:	5d                   	pop    %ebp
+		goto out;
+  8014bd:	eb d3                	jmp    801492 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014bf:	83 ec 0c             	sub    $0xc,%esp
+  8014c2:	50                   	push   %eax
+  8014c3:	6a 20                	push   $0x20
+  8014c5:	68 2b 32 80 00       	push   $0x80322b
+  8014ca:	6a 3f                	push   $0x3f
+  8014cc:	68 48 32 80 00       	push   $0x803248
+  8014d1:	e8 ff ec ff ff       	call   8001d5 <_panic>
+
+008014d6 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014d6:	55                   	push   %ebp
+  8014d7:	89 e5                	mov    %esp,%ebp
+  8014d9:	57                   	push   %edi
+  8014da:	56                   	push   %esi
+  8014db:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014dc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e3:	74 1b                	je     801500 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8014e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ea:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f5:	89 df                	mov    %ebx,%edi
+  8014f7:	89 de                	mov    %ebx,%esi
+  8014f9:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014fb:	5b                   	pop    %ebx
+  8014fc:	5e                   	pop    %esi
+  8014fd:	5f                   	pop    %edi
+  8014fe:	5d                   	pop    %ebp
+  8014ff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801500:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801505:	8b 55 08             	mov    0x8(%ebp),%edx
+  801508:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801510:	89 df                	mov    %ebx,%edi
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	8d 35 1d 15 80 00    	lea    0x80151d,%esi
+  80151b:	0f 34                	sysenter
+  80151d:	5d                   	pop    %ebp
+		goto out;
+  80151e:	eb db                	jmp    8014fb <sys_batch+0x25>
+
+00801520 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801520:	55                   	push   %ebp
+  801521:	89 e5                	mov    %esp,%ebp
+  801523:	57                   	push   %edi
+  801524:	56                   	push   %esi
+  801525:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801526:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80152d:	74 1a                	je     801549 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80152f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801534:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801539:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153c:	89 cb                	mov    %ecx,%ebx
+  80153e:	89 cf                	mov    %ecx,%edi
+  801540:	89 ce                	mov    %ecx,%esi
+  801542:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801544:	5b                   	pop    %ebx
+  801545:	5e                   	pop    %esi
+  801546:	5f                   	pop    %edi
+  801547:	5d                   	pop    %ebp
+  801548:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801549:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801551:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801556:	89 cb                	mov    %ecx,%ebx
+  801558:	89 cf                	mov    %ecx,%edi
+  80155a:	55                   	push   %ebp
+  80155b:	89 e5                	mov    %esp,%ebp
+  80155d:	8d 35 65 15 80 00    	lea    0x801565,%esi
+  801563:	0f 34                	sysenter
+  801565:	5d                   	pop    %ebp
+		goto out;
+  801566:	eb dc                	jmp    801544 <sys_trace_ctl+0x24>
+
+00801568 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	57                   	push   %edi
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80156e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801575:	74 1c                	je     801593 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801577:	be 00 00 00 00       	mov    $0x0,%esi
+  80157c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801581:	8b 55 08             	mov    0x8(%ebp),%edx
+  801584:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801587:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158a:	89 f7                	mov    %esi,%edi
+  80158c:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80158e:	5b                   	pop    %ebx
+  80158f:	5e                   	pop    %esi
+  801590:	5f                   	pop    %edi
+  801591:	5d                   	pop    %ebp
+  801592:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801593:	8b 55 08             	mov    0x8(%ebp),%edx
+  801596:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801599:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80159e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a6:	55                   	push   %ebp
+  8015a7:	89 e5                	mov    %esp,%ebp
+  8015a9:	8d 35 b1 15 80 00    	lea    0x8015b1,%esi
+  8015af:	0f 34                	sysenter
+  8015b1:	5d                   	pop    %ebp
+		goto out;
+  8015b2:	eb da                	jmp    80158e <sys_trace_read+0x26>
+
+008015b4 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015b4:	55                   	push   %ebp
+  8015b5:	89 e5                	mov    %esp,%ebp
+  8015b7:	57                   	push   %edi
+  8015b8:	56                   	push   %esi
+  8015b9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015ba:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015c1:	74 1c                	je     8015df <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8015c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c8:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d6:	89 f7                	mov    %esi,%edi
+  8015d8:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015da:	5b                   	pop    %ebx
+  8015db:	5e                   	pop    %esi
+  8015dc:	5f                   	pop    %edi
+  8015dd:	5d                   	pop    %ebp
+  8015de:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e5:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	8d 35 fd 15 80 00    	lea    0x8015fd,%esi
+  8015fb:	0f 34                	sysenter
+  8015fd:	5d                   	pop    %ebp
+		goto out;
+  8015fe:	eb da                	jmp    8015da <sys_meminfo+0x26>
+
+00801600 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801600:	55                   	push   %ebp
+  801601:	89 e5                	mov    %esp,%ebp
+  801603:	57                   	push   %edi
+  801604:	56                   	push   %esi
+  801605:	53                   	push   %ebx
+  801606:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801609:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80160d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801614:	74 1f                	je     801635 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801616:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161b:	b8 22 00 00 00       	mov    $0x22,%eax
+  801620:	8b 55 08             	mov    0x8(%ebp),%edx
+  801623:	89 df                	mov    %ebx,%edi
+  801625:	89 de                	mov    %ebx,%esi
+  801627:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801629:	85 c0                	test   %eax,%eax
+  80162b:	7f 25                	jg     801652 <sys_env_set_ksm+0x52>
+}
+  80162d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801630:	5b                   	pop    %ebx
+  801631:	5e                   	pop    %esi
+  801632:	5f                   	pop    %edi
+  801633:	5d                   	pop    %ebp
+  801634:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801635:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163d:	b8 22 00 00 00       	mov    $0x22,%eax
+  801642:	89 df                	mov    %ebx,%edi
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	8d 35 4f 16 80 00    	lea    0x80164f,%esi
+  80164d:	0f 34                	sysenter
+  80164f:	5d                   	pop    %ebp
+		goto out;
+  801650:	eb d7                	jmp    801629 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801652:	83 ec 0c             	sub    $0xc,%esp
+  801655:	50                   	push   %eax
+  801656:	6a 22                	push   $0x22
+  801658:	68 2b 32 80 00       	push   $0x80322b
+  80165d:	6a 3f                	push   $0x3f
+  80165f:	68 48 32 80 00       	push   $0x803248
+  801664:	e8 6c eb ff ff       	call   8001d5 <_panic>
+
+00801669 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801669:	55                   	push   %ebp
+  80166a:	89 e5                	mov    %esp,%ebp
+  80166c:	57                   	push   %edi
+  80166d:	56                   	push   %esi
+  80166e:	53                   	push   %ebx
+  80166f:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801672:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801675:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80167c:	74 24                	je     8016a2 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80167e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801683:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801688:	89 cb                	mov    %ecx,%ebx
+  80168a:	89 cf                	mov    %ecx,%edi
+  80168c:	89 ce                	mov    %ecx,%esi
+  80168e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801690:	85 c0                	test   %eax,%eax
+  801692:	7f 2a                	jg     8016be <sys_time_nsec+0x55>
+	return ns;
+}
+  801694:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801697:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80169a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169d:	5b                   	pop    %ebx
+  80169e:	5e                   	pop    %esi
+  80169f:	5f                   	pop    %edi
+  8016a0:	5d                   	pop    %ebp
+  8016a1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016a7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016ac:	89 cb                	mov    %ecx,%ebx
+  8016ae:	89 cf                	mov    %ecx,%edi
+  8016b0:	55                   	push   %ebp
+  8016b1:	89 e5                	mov    %esp,%ebp
+  8016b3:	8d 35 bb 16 80 00    	lea    0x8016bb,%esi
+  8016b9:	0f 34                	sysenter
+  8016bb:	5d                   	pop    %ebp
+		goto out;
+  8016bc:	eb d2                	jmp    801690 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016be:	83 ec 0c             	sub    $0xc,%esp
+  8016c1:	50                   	push   %eax
+  8016c2:	6a 0f                	push   $0xf
+  8016c4:	68 2b 32 80 00       	push   $0x80322b
+  8016c9:	6a 3f                	push   $0x3f
+  8016cb:	68 48 32 80 00       	push   $0x803248
+  8016d0:	e8 00 eb ff ff       	call   8001d5 <_panic>
+
+008016d5 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	57                   	push   %edi
+  8016d9:	56                   	push   %esi
+  8016da:	53                   	push   %ebx
+  8016db:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016de:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016e5:	74 22                	je     801709 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8016e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ec:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f7:	89 df                	mov    %ebx,%edi
+  8016f9:	89 de                	mov    %ebx,%esi
+  8016fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	7f 28                	jg     801729 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801701:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801704:	5b                   	pop    %ebx
+  801705:	5e                   	pop    %esi
+  801706:	5f                   	pop    %edi
+  801707:	5d                   	pop    %ebp
+  801708:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801709:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801711:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801714:	b8 12 00 00 00       	mov    $0x12,%eax
+  801719:	89 df                	mov    %ebx,%edi
+  80171b:	55                   	push   %ebp
+  80171c:	89 e5                	mov    %esp,%ebp
+  80171e:	8d 35 26 17 80 00    	lea    0x801726,%esi
+  801724:	0f 34                	sysenter
+  801726:	5d                   	pop    %ebp
+		goto out;
+  801727:	eb d4                	jmp    8016fd <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801729:	83 ec 0c             	sub    $0xc,%esp
+  80172c:	50                   	push   %eax
+  80172d:	6a 12                	push   $0x12
+  80172f:	68 2b 32 80 00       	push   $0x80322b
+  801734:	6a 3f                	push   $0x3f
+  801736:	68 48 32 80 00       	push   $0x803248
+  80173b:	e8 95 ea ff ff       	call   8001d5 <_panic>
+
+00801740 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801740:	55                   	push   %ebp
+  801741:	89 e5                	mov    %esp,%ebp
+  801743:	57                   	push   %edi
+  801744:	56                   	push   %esi
+  801745:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801746:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80174d:	74 1b                	je     80176a <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80174f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801754:	b8 13 00 00 00       	mov    $0x13,%eax
+  801759:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175f:	89 df                	mov    %ebx,%edi
+  801761:	89 de                	mov    %ebx,%esi
+  801763:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801765:	5b                   	pop    %ebx
+  801766:	5e                   	pop    %esi
+  801767:	5f                   	pop    %edi
+  801768:	5d                   	pop    %ebp
+  801769:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80176a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801772:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801775:	b8 13 00 00 00       	mov    $0x13,%eax
+  80177a:	89 df                	mov    %ebx,%edi
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	8d 35 87 17 80 00    	lea    0x801787,%esi
+  801785:	0f 34                	sysenter
+  801787:	5d                   	pop    %ebp
+		goto out;
+  801788:	eb db                	jmp    801765 <sys_e1000_receive+0x25>
+
+0080178a <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	57                   	push   %edi
+  80178e:	56                   	push   %esi
+  80178f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801790:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801797:	74 1b                	je     8017b4 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801799:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179e:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a9:	89 df                	mov    %ebx,%edi
+  8017ab:	89 de                	mov    %ebx,%esi
+  8017ad:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017af:	5b                   	pop    %ebx
+  8017b0:	5e                   	pop    %esi
+  8017b1:	5f                   	pop    %edi
+  8017b2:	5d                   	pop    %ebp
+  8017b3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017bf:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017c4:	89 df                	mov    %ebx,%edi
+  8017c6:	55                   	push   %ebp
+  8017c7:	89 e5                	mov    %esp,%ebp
+  8017c9:	8d 35 d1 17 80 00    	lea    0x8017d1,%esi
+  8017cf:	0f 34                	sysenter
+  8017d1:	5d                   	pop    %ebp
+		goto out;
+  8017d2:	eb db                	jmp    8017af <sys_e1000_read_hwaddr+0x25>
+
+008017d4 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	57                   	push   %edi
+  8017d8:	56                   	push   %esi
+  8017d9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017da:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017e1:	74 1a                	je     8017fd <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8017e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017e8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f0:	89 cb                	mov    %ecx,%ebx
+  8017f2:	89 cf                	mov    %ecx,%edi
+  8017f4:	89 ce                	mov    %ecx,%esi
+  8017f6:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017f8:	5b                   	pop    %ebx
+  8017f9:	5e                   	pop    %esi
+  8017fa:	5f                   	pop    %edi
+  8017fb:	5d                   	pop    %ebp
+  8017fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801800:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801805:	b8 15 00 00 00       	mov    $0x15,%eax
+  80180a:	89 cb                	mov    %ecx,%ebx
+  80180c:	89 cf                	mov    %ecx,%edi
+  80180e:	55                   	push   %ebp
+  80180f:	89 e5                	mov    %esp,%ebp
+  801811:	8d 35 19 18 80 00    	lea    0x801819,%esi
+  801817:	0f 34                	sysenter
+  801819:	5d                   	pop    %ebp
+		goto out;
+  80181a:	eb dc                	jmp    8017f8 <sys_sb16_read_version+0x24>
+
+0080181c <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80181c:	55                   	push   %ebp
+  80181d:	89 e5                	mov    %esp,%ebp
+  80181f:	57                   	push   %edi
+  801820:	56                   	push   %esi
+  801821:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801822:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801829:	74 1b                	je     801846 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80182b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801830:	b8 16 00 00 00       	mov    $0x16,%eax
+  801835:	8b 55 08             	mov    0x8(%ebp),%edx
+  801838:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80183b:	89 df                	mov    %ebx,%edi
+  80183d:	89 de                	mov    %ebx,%esi
+  80183f:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801841:	5b                   	pop    %ebx
+  801842:	5e                   	pop    %esi
+  801843:	5f                   	pop    %edi
+  801844:	5d                   	pop    %ebp
+  801845:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801851:	b8 16 00 00 00       	mov    $0x16,%eax
+  801856:	89 df                	mov    %ebx,%edi
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	8d 35 63 18 80 00    	lea    0x801863,%esi
+  801861:	0f 34                	sysenter
+  801863:	5d                   	pop    %ebp
+		goto out;
+  801864:	eb db                	jmp    801841 <sys_sb16_play+0x25>
+
+00801866 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80186f:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  801872:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  801874:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  801877:	83 3a 01             	cmpl   $0x1,(%edx)
+  80187a:	7e 09                	jle    801885 <argstart+0x1f>
+  80187c:	ba 91 2e 80 00       	mov    $0x802e91,%edx
+  801881:	85 c9                	test   %ecx,%ecx
+  801883:	75 05                	jne    80188a <argstart+0x24>
+  801885:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188a:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  80188d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801894:	5d                   	pop    %ebp
+  801895:	c3                   	ret
+
+00801896 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801896:	55                   	push   %ebp
+  801897:	89 e5                	mov    %esp,%ebp
+  801899:	53                   	push   %ebx
+  80189a:	83 ec 04             	sub    $0x4,%esp
+  80189d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  8018a0:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  8018a7:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018aa:	85 c0                	test   %eax,%eax
+  8018ac:	74 74                	je     801922 <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  8018ae:	80 38 00             	cmpb   $0x0,(%eax)
+  8018b1:	75 48                	jne    8018fb <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8018b3:	8b 0b                	mov    (%ebx),%ecx
+  8018b5:	83 39 01             	cmpl   $0x1,(%ecx)
+  8018b8:	74 5a                	je     801914 <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  8018ba:	8b 53 04             	mov    0x4(%ebx),%edx
+  8018bd:	8b 42 04             	mov    0x4(%edx),%eax
+  8018c0:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8018c3:	75 4f                	jne    801914 <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  8018c5:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  8018c9:	74 49                	je     801914 <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  8018cb:	83 c0 01             	add    $0x1,%eax
+  8018ce:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8018d1:	83 ec 04             	sub    $0x4,%esp
+  8018d4:	8b 01                	mov    (%ecx),%eax
+  8018d6:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  8018dd:	50                   	push   %eax
+  8018de:	8d 42 08             	lea    0x8(%edx),%eax
+  8018e1:	50                   	push   %eax
+  8018e2:	83 c2 04             	add    $0x4,%edx
+  8018e5:	52                   	push   %edx
+  8018e6:	e8 93 f1 ff ff       	call   800a7e <memmove>
+		(*args->argc)--;
+  8018eb:	8b 03                	mov    (%ebx),%eax
+  8018ed:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  8018f0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	80 38 2d             	cmpb   $0x2d,(%eax)
+  8018f9:	74 13                	je     80190e <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  8018fb:	8b 43 08             	mov    0x8(%ebx),%eax
+  8018fe:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  801901:	83 c0 01             	add    $0x1,%eax
+  801904:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  801907:	89 d0                	mov    %edx,%eax
+  801909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190c:	c9                   	leave
+  80190d:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80190e:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801912:	75 e7                	jne    8018fb <argnext+0x65>
+	args->curarg = 0;
+  801914:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  80191b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801920:	eb e5                	jmp    801907 <argnext+0x71>
+		return -1;
+  801922:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801927:	eb de                	jmp    801907 <argnext+0x71>
+
+00801929 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801929:	55                   	push   %ebp
+  80192a:	89 e5                	mov    %esp,%ebp
+  80192c:	53                   	push   %ebx
+  80192d:	83 ec 04             	sub    $0x4,%esp
+  801930:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  801933:	8b 43 08             	mov    0x8(%ebx),%eax
+  801936:	85 c0                	test   %eax,%eax
+  801938:	74 12                	je     80194c <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  80193a:	80 38 00             	cmpb   $0x0,(%eax)
+  80193d:	74 12                	je     801951 <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  80193f:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  801942:	c7 43 08 91 2e 80 00 	movl   $0x802e91,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  801949:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  80194c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80194f:	c9                   	leave
+  801950:	c3                   	ret
+	} else if (*args->argc > 1) {
+  801951:	8b 13                	mov    (%ebx),%edx
+  801953:	83 3a 01             	cmpl   $0x1,(%edx)
+  801956:	7f 10                	jg     801968 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  801958:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  80195f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  801966:	eb e1                	jmp    801949 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  801968:	8b 43 04             	mov    0x4(%ebx),%eax
+  80196b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80196e:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801971:	83 ec 04             	sub    $0x4,%esp
+  801974:	8b 12                	mov    (%edx),%edx
+  801976:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  80197d:	52                   	push   %edx
+  80197e:	8d 50 08             	lea    0x8(%eax),%edx
+  801981:	52                   	push   %edx
+  801982:	83 c0 04             	add    $0x4,%eax
+  801985:	50                   	push   %eax
+  801986:	e8 f3 f0 ff ff       	call   800a7e <memmove>
+		(*args->argc)--;
+  80198b:	8b 03                	mov    (%ebx),%eax
+  80198d:	83 28 01             	subl   $0x1,(%eax)
+  801990:	83 c4 10             	add    $0x10,%esp
+  801993:	eb b4                	jmp    801949 <argnextvalue+0x20>
+
+00801995 <argvalue>:
+{
+  801995:	55                   	push   %ebp
+  801996:	89 e5                	mov    %esp,%ebp
+  801998:	83 ec 08             	sub    $0x8,%esp
+  80199b:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  80199e:	8b 42 0c             	mov    0xc(%edx),%eax
+  8019a1:	85 c0                	test   %eax,%eax
+  8019a3:	74 02                	je     8019a7 <argvalue+0x12>
+}
+  8019a5:	c9                   	leave
+  8019a6:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8019a7:	83 ec 0c             	sub    $0xc,%esp
+  8019aa:	52                   	push   %edx
+  8019ab:	e8 79 ff ff ff       	call   801929 <argnextvalue>
+  8019b0:	83 c4 10             	add    $0x10,%esp
+  8019b3:	eb f0                	jmp    8019a5 <argvalue+0x10>
+
+008019b5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8019b5:	55                   	push   %ebp
+  8019b6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019bb:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019c0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019c3:	5d                   	pop    %ebp
+  8019c4:	c3                   	ret
+
+008019c5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019cb:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019d0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019d5:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019da:	5d                   	pop    %ebp
+  8019db:	c3                   	ret
+
+008019dc <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019dc:	55                   	push   %ebp
+  8019dd:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8019df:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8019e4:	eb 02                	jmp    8019e8 <fd_alloc+0xc>
+  8019e6:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019e8:	89 c2                	mov    %eax,%edx
+  8019ea:	c1 ea 16             	shr    $0x16,%edx
+  8019ed:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019f4:	f6 c2 01             	test   $0x1,%dl
+  8019f7:	74 2b                	je     801a24 <fd_alloc+0x48>
+  8019f9:	89 c2                	mov    %eax,%edx
+  8019fb:	c1 ea 0c             	shr    $0xc,%edx
+  8019fe:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a05:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801a0b:	f6 c1 01             	test   $0x1,%cl
+  801a0e:	74 14                	je     801a24 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801a10:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801a16:	75 ce                	jne    8019e6 <fd_alloc+0xa>
+  801a18:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a1d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a22:	eb 05                	jmp    801a29 <fd_alloc+0x4d>
+			return 0;
+  801a24:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a29:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2c:	89 02                	mov    %eax,(%edx)
+}
+  801a2e:	89 c8                	mov    %ecx,%eax
+  801a30:	5d                   	pop    %ebp
+  801a31:	c3                   	ret
+
+00801a32 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a32:	55                   	push   %ebp
+  801a33:	89 e5                	mov    %esp,%ebp
+  801a35:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a38:	83 f8 1f             	cmp    $0x1f,%eax
+  801a3b:	77 30                	ja     801a6d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a3d:	c1 e0 0c             	shl    $0xc,%eax
+  801a40:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a45:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a4b:	f6 c2 01             	test   $0x1,%dl
+  801a4e:	74 24                	je     801a74 <fd_lookup+0x42>
+  801a50:	89 c2                	mov    %eax,%edx
+  801a52:	c1 ea 0c             	shr    $0xc,%edx
+  801a55:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a5c:	f6 c2 01             	test   $0x1,%dl
+  801a5f:	74 1a                	je     801a7b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a64:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a6b:	5d                   	pop    %ebp
+  801a6c:	c3                   	ret
+		return -E_INVAL;
+  801a6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a72:	eb f7                	jmp    801a6b <fd_lookup+0x39>
+		return -E_INVAL;
+  801a74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a79:	eb f0                	jmp    801a6b <fd_lookup+0x39>
+  801a7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a80:	eb e9                	jmp    801a6b <fd_lookup+0x39>
+
+00801a82 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a82:	55                   	push   %ebp
+  801a83:	89 e5                	mov    %esp,%ebp
+  801a85:	53                   	push   %ebx
+  801a86:	83 ec 04             	sub    $0x4,%esp
+  801a89:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a91:	eb 03                	jmp    801a96 <dev_lookup+0x14>
+  801a93:	83 c0 01             	add    $0x1,%eax
+  801a96:	8b 1c 85 d4 32 80 00 	mov    0x8032d4(,%eax,4),%ebx
+  801a9d:	85 db                	test   %ebx,%ebx
+  801a9f:	74 0b                	je     801aac <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801aa1:	39 13                	cmp    %edx,(%ebx)
+  801aa3:	75 ee                	jne    801a93 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aaa:	eb 2e                	jmp    801ada <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801aac:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801aae:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801ab3:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ab9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801abe:	76 24                	jbe    801ae4 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ac0:	8b 41 48             	mov    0x48(%ecx),%eax
+  801ac3:	83 ec 04             	sub    $0x4,%esp
+  801ac6:	52                   	push   %edx
+  801ac7:	50                   	push   %eax
+  801ac8:	68 58 32 80 00       	push   $0x803258
+  801acd:	e8 de e7 ff ff       	call   8002b0 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801ada:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801add:	89 1a                	mov    %ebx,(%edx)
+}
+  801adf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae2:	c9                   	leave
+  801ae3:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ae4:	c1 e8 10             	shr    $0x10,%eax
+  801ae7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801aed:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801af3:	eb cb                	jmp    801ac0 <dev_lookup+0x3e>
+
+00801af5 <fd_close>:
+{
+  801af5:	55                   	push   %ebp
+  801af6:	89 e5                	mov    %esp,%ebp
+  801af8:	57                   	push   %edi
+  801af9:	56                   	push   %esi
+  801afa:	53                   	push   %ebx
+  801afb:	83 ec 24             	sub    $0x24,%esp
+  801afe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b01:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b04:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b07:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b08:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b0e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b11:	50                   	push   %eax
+  801b12:	e8 1b ff ff ff       	call   801a32 <fd_lookup>
+  801b17:	89 c3                	mov    %eax,%ebx
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	85 c0                	test   %eax,%eax
+  801b1e:	78 05                	js     801b25 <fd_close+0x30>
+	    || fd != fd2)
+  801b20:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b23:	74 16                	je     801b3b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801b25:	89 f8                	mov    %edi,%eax
+  801b27:	84 c0                	test   %al,%al
+  801b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b31:	89 d8                	mov    %ebx,%eax
+  801b33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b36:	5b                   	pop    %ebx
+  801b37:	5e                   	pop    %esi
+  801b38:	5f                   	pop    %edi
+  801b39:	5d                   	pop    %ebp
+  801b3a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b3b:	83 ec 08             	sub    $0x8,%esp
+  801b3e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b41:	50                   	push   %eax
+  801b42:	ff 36                	push   (%esi)
+  801b44:	e8 39 ff ff ff       	call   801a82 <dev_lookup>
+  801b49:	89 c3                	mov    %eax,%ebx
+  801b4b:	83 c4 10             	add    $0x10,%esp
+  801b4e:	85 c0                	test   %eax,%eax
+  801b50:	78 1a                	js     801b6c <fd_close+0x77>
+		if (dev->dev_close)
+  801b52:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b55:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b58:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	74 0b                	je     801b6c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b61:	83 ec 0c             	sub    $0xc,%esp
+  801b64:	56                   	push   %esi
+  801b65:	ff d0                	call   *%eax
+  801b67:	89 c3                	mov    %eax,%ebx
+  801b69:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b6c:	83 ec 08             	sub    $0x8,%esp
+  801b6f:	56                   	push   %esi
+  801b70:	6a 00                	push   $0x0
+  801b72:	e8 54 f3 ff ff       	call   800ecb <sys_page_unmap>
+	return r;
+  801b77:	83 c4 10             	add    $0x10,%esp
+  801b7a:	eb b5                	jmp    801b31 <fd_close+0x3c>
+
+00801b7c <close>:
+
+int
+close(int fdnum)
+{
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b85:	50                   	push   %eax
+  801b86:	ff 75 08             	push   0x8(%ebp)
+  801b89:	e8 a4 fe ff ff       	call   801a32 <fd_lookup>
+  801b8e:	83 c4 10             	add    $0x10,%esp
+  801b91:	85 c0                	test   %eax,%eax
+  801b93:	79 02                	jns    801b97 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b95:	c9                   	leave
+  801b96:	c3                   	ret
+		return fd_close(fd, 1);
+  801b97:	83 ec 08             	sub    $0x8,%esp
+  801b9a:	6a 01                	push   $0x1
+  801b9c:	ff 75 f4             	push   -0xc(%ebp)
+  801b9f:	e8 51 ff ff ff       	call   801af5 <fd_close>
+  801ba4:	83 c4 10             	add    $0x10,%esp
+  801ba7:	eb ec                	jmp    801b95 <close+0x19>
+
+00801ba9 <close_all>:
+
+void
+close_all(void)
+{
+  801ba9:	55                   	push   %ebp
+  801baa:	89 e5                	mov    %esp,%ebp
+  801bac:	53                   	push   %ebx
+  801bad:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801bb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801bb5:	83 ec 0c             	sub    $0xc,%esp
+  801bb8:	53                   	push   %ebx
+  801bb9:	e8 be ff ff ff       	call   801b7c <close>
+	for (i = 0; i < MAXFD; i++)
+  801bbe:	83 c3 01             	add    $0x1,%ebx
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	83 fb 20             	cmp    $0x20,%ebx
+  801bc7:	75 ec                	jne    801bb5 <close_all+0xc>
+}
+  801bc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bcc:	c9                   	leave
+  801bcd:	c3                   	ret
+
+00801bce <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801bce:	55                   	push   %ebp
+  801bcf:	89 e5                	mov    %esp,%ebp
+  801bd1:	57                   	push   %edi
+  801bd2:	56                   	push   %esi
+  801bd3:	53                   	push   %ebx
+  801bd4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801bd7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bda:	50                   	push   %eax
+  801bdb:	ff 75 08             	push   0x8(%ebp)
+  801bde:	e8 4f fe ff ff       	call   801a32 <fd_lookup>
+  801be3:	89 c3                	mov    %eax,%ebx
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	78 7f                	js     801c6b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801bec:	83 ec 0c             	sub    $0xc,%esp
+  801bef:	ff 75 0c             	push   0xc(%ebp)
+  801bf2:	e8 85 ff ff ff       	call   801b7c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801bf7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bfa:	c1 e6 0c             	shl    $0xc,%esi
+  801bfd:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c03:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c06:	89 3c 24             	mov    %edi,(%esp)
+  801c09:	e8 b7 fd ff ff       	call   8019c5 <fd2data>
+  801c0e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c10:	89 34 24             	mov    %esi,(%esp)
+  801c13:	e8 ad fd ff ff       	call   8019c5 <fd2data>
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801c1e:	89 d8                	mov    %ebx,%eax
+  801c20:	c1 e8 16             	shr    $0x16,%eax
+  801c23:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c2a:	a8 01                	test   $0x1,%al
+  801c2c:	74 11                	je     801c3f <dup+0x71>
+  801c2e:	89 d8                	mov    %ebx,%eax
+  801c30:	c1 e8 0c             	shr    $0xc,%eax
+  801c33:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c3a:	f6 c2 01             	test   $0x1,%dl
+  801c3d:	75 36                	jne    801c75 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c3f:	89 f8                	mov    %edi,%eax
+  801c41:	c1 e8 0c             	shr    $0xc,%eax
+  801c44:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c4b:	83 ec 0c             	sub    $0xc,%esp
+  801c4e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c53:	50                   	push   %eax
+  801c54:	56                   	push   %esi
+  801c55:	6a 00                	push   $0x0
+  801c57:	57                   	push   %edi
+  801c58:	6a 00                	push   $0x0
+  801c5a:	e8 fe f1 ff ff       	call   800e5d <sys_page_map>
+  801c5f:	89 c3                	mov    %eax,%ebx
+  801c61:	83 c4 20             	add    $0x20,%esp
+  801c64:	85 c0                	test   %eax,%eax
+  801c66:	78 33                	js     801c9b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c6b:	89 d8                	mov    %ebx,%eax
+  801c6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c70:	5b                   	pop    %ebx
+  801c71:	5e                   	pop    %esi
+  801c72:	5f                   	pop    %edi
+  801c73:	5d                   	pop    %ebp
+  801c74:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c75:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c7c:	83 ec 0c             	sub    $0xc,%esp
+  801c7f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c84:	50                   	push   %eax
+  801c85:	ff 75 d4             	push   -0x2c(%ebp)
+  801c88:	6a 00                	push   $0x0
+  801c8a:	53                   	push   %ebx
+  801c8b:	6a 00                	push   $0x0
+  801c8d:	e8 cb f1 ff ff       	call   800e5d <sys_page_map>
+  801c92:	89 c3                	mov    %eax,%ebx
+  801c94:	83 c4 20             	add    $0x20,%esp
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	79 a4                	jns    801c3f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c9b:	83 ec 08             	sub    $0x8,%esp
+  801c9e:	56                   	push   %esi
+  801c9f:	6a 00                	push   $0x0
+  801ca1:	e8 25 f2 ff ff       	call   800ecb <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ca6:	83 c4 08             	add    $0x8,%esp
+  801ca9:	ff 75 d4             	push   -0x2c(%ebp)
+  801cac:	6a 00                	push   $0x0
+  801cae:	e8 18 f2 ff ff       	call   800ecb <sys_page_unmap>
+	return r;
+  801cb3:	83 c4 10             	add    $0x10,%esp
+  801cb6:	eb b3                	jmp    801c6b <dup+0x9d>
+
+00801cb8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801cb8:	55                   	push   %ebp
+  801cb9:	89 e5                	mov    %esp,%ebp
+  801cbb:	56                   	push   %esi
+  801cbc:	53                   	push   %ebx
+  801cbd:	83 ec 18             	sub    $0x18,%esp
+  801cc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cc3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cc6:	50                   	push   %eax
+  801cc7:	53                   	push   %ebx
+  801cc8:	e8 65 fd ff ff       	call   801a32 <fd_lookup>
+  801ccd:	83 c4 10             	add    $0x10,%esp
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	78 3c                	js     801d10 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cd4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cd7:	83 ec 08             	sub    $0x8,%esp
+  801cda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cdd:	50                   	push   %eax
+  801cde:	ff 36                	push   (%esi)
+  801ce0:	e8 9d fd ff ff       	call   801a82 <dev_lookup>
+  801ce5:	83 c4 10             	add    $0x10,%esp
+  801ce8:	85 c0                	test   %eax,%eax
+  801cea:	78 24                	js     801d10 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cec:	8b 46 08             	mov    0x8(%esi),%eax
+  801cef:	83 e0 03             	and    $0x3,%eax
+  801cf2:	83 f8 01             	cmp    $0x1,%eax
+  801cf5:	74 20                	je     801d17 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801cf7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cfa:	8b 40 08             	mov    0x8(%eax),%eax
+  801cfd:	85 c0                	test   %eax,%eax
+  801cff:	74 57                	je     801d58 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d01:	83 ec 04             	sub    $0x4,%esp
+  801d04:	ff 75 10             	push   0x10(%ebp)
+  801d07:	ff 75 0c             	push   0xc(%ebp)
+  801d0a:	56                   	push   %esi
+  801d0b:	ff d0                	call   *%eax
+  801d0d:	83 c4 10             	add    $0x10,%esp
+}
+  801d10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d13:	5b                   	pop    %ebx
+  801d14:	5e                   	pop    %esi
+  801d15:	5d                   	pop    %ebp
+  801d16:	c3                   	ret
+  801d17:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d19:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d1e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d24:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d29:	76 1c                	jbe    801d47 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d2b:	8b 42 48             	mov    0x48(%edx),%eax
+  801d2e:	83 ec 04             	sub    $0x4,%esp
+  801d31:	53                   	push   %ebx
+  801d32:	50                   	push   %eax
+  801d33:	68 99 32 80 00       	push   $0x803299
+  801d38:	e8 73 e5 ff ff       	call   8002b0 <cprintf>
+		return -E_INVAL;
+  801d3d:	83 c4 10             	add    $0x10,%esp
+  801d40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d45:	eb c9                	jmp    801d10 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d47:	c1 e8 10             	shr    $0x10,%eax
+  801d4a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d50:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d56:	eb d3                	jmp    801d2b <read+0x73>
+		return -E_NOT_SUPP;
+  801d58:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d5d:	eb b1                	jmp    801d10 <read+0x58>
+
+00801d5f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d5f:	55                   	push   %ebp
+  801d60:	89 e5                	mov    %esp,%ebp
+  801d62:	57                   	push   %edi
+  801d63:	56                   	push   %esi
+  801d64:	53                   	push   %ebx
+  801d65:	83 ec 0c             	sub    $0xc,%esp
+  801d68:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d6b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d73:	eb 02                	jmp    801d77 <readn+0x18>
+  801d75:	01 c3                	add    %eax,%ebx
+  801d77:	39 f3                	cmp    %esi,%ebx
+  801d79:	73 21                	jae    801d9c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d7b:	83 ec 04             	sub    $0x4,%esp
+  801d7e:	89 f0                	mov    %esi,%eax
+  801d80:	29 d8                	sub    %ebx,%eax
+  801d82:	50                   	push   %eax
+  801d83:	89 d8                	mov    %ebx,%eax
+  801d85:	03 45 0c             	add    0xc(%ebp),%eax
+  801d88:	50                   	push   %eax
+  801d89:	57                   	push   %edi
+  801d8a:	e8 29 ff ff ff       	call   801cb8 <read>
+		if (m < 0)
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	78 04                	js     801d9a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d96:	75 dd                	jne    801d75 <readn+0x16>
+  801d98:	eb 02                	jmp    801d9c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d9a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d9c:	89 d8                	mov    %ebx,%eax
+  801d9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da1:	5b                   	pop    %ebx
+  801da2:	5e                   	pop    %esi
+  801da3:	5f                   	pop    %edi
+  801da4:	5d                   	pop    %ebp
+  801da5:	c3                   	ret
+
+00801da6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	56                   	push   %esi
+  801daa:	53                   	push   %ebx
+  801dab:	83 ec 18             	sub    $0x18,%esp
+  801dae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801db1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801db4:	50                   	push   %eax
+  801db5:	53                   	push   %ebx
+  801db6:	e8 77 fc ff ff       	call   801a32 <fd_lookup>
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	78 37                	js     801df9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dc2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dc5:	83 ec 08             	sub    $0x8,%esp
+  801dc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dcb:	50                   	push   %eax
+  801dcc:	ff 36                	push   (%esi)
+  801dce:	e8 af fc ff ff       	call   801a82 <dev_lookup>
+  801dd3:	83 c4 10             	add    $0x10,%esp
+  801dd6:	85 c0                	test   %eax,%eax
+  801dd8:	78 1f                	js     801df9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dda:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dde:	74 20                	je     801e00 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801de0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801de6:	85 c0                	test   %eax,%eax
+  801de8:	74 57                	je     801e41 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801dea:	83 ec 04             	sub    $0x4,%esp
+  801ded:	ff 75 10             	push   0x10(%ebp)
+  801df0:	ff 75 0c             	push   0xc(%ebp)
+  801df3:	56                   	push   %esi
+  801df4:	ff d0                	call   *%eax
+  801df6:	83 c4 10             	add    $0x10,%esp
+}
+  801df9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfc:	5b                   	pop    %ebx
+  801dfd:	5e                   	pop    %esi
+  801dfe:	5d                   	pop    %ebp
+  801dff:	c3                   	ret
+  801e00:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e02:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e07:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e0d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e12:	76 1c                	jbe    801e30 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e14:	8b 42 48             	mov    0x48(%edx),%eax
+  801e17:	83 ec 04             	sub    $0x4,%esp
+  801e1a:	53                   	push   %ebx
+  801e1b:	50                   	push   %eax
+  801e1c:	68 b5 32 80 00       	push   $0x8032b5
+  801e21:	e8 8a e4 ff ff       	call   8002b0 <cprintf>
+		return -E_INVAL;
+  801e26:	83 c4 10             	add    $0x10,%esp
+  801e29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e2e:	eb c9                	jmp    801df9 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e30:	c1 e8 10             	shr    $0x10,%eax
+  801e33:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e39:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e3f:	eb d3                	jmp    801e14 <write+0x6e>
+		return -E_NOT_SUPP;
+  801e41:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e46:	eb b1                	jmp    801df9 <write+0x53>
+
+00801e48 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e48:	55                   	push   %ebp
+  801e49:	89 e5                	mov    %esp,%ebp
+  801e4b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e51:	50                   	push   %eax
+  801e52:	ff 75 08             	push   0x8(%ebp)
+  801e55:	e8 d8 fb ff ff       	call   801a32 <fd_lookup>
+  801e5a:	83 c4 10             	add    $0x10,%esp
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	78 0e                	js     801e6f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e67:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e6f:	c9                   	leave
+  801e70:	c3                   	ret
+
+00801e71 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e71:	55                   	push   %ebp
+  801e72:	89 e5                	mov    %esp,%ebp
+  801e74:	56                   	push   %esi
+  801e75:	53                   	push   %ebx
+  801e76:	83 ec 18             	sub    $0x18,%esp
+  801e79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e7c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e7f:	50                   	push   %eax
+  801e80:	53                   	push   %ebx
+  801e81:	e8 ac fb ff ff       	call   801a32 <fd_lookup>
+  801e86:	83 c4 10             	add    $0x10,%esp
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	78 34                	js     801ec1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e8d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e90:	83 ec 08             	sub    $0x8,%esp
+  801e93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e96:	50                   	push   %eax
+  801e97:	ff 36                	push   (%esi)
+  801e99:	e8 e4 fb ff ff       	call   801a82 <dev_lookup>
+  801e9e:	83 c4 10             	add    $0x10,%esp
+  801ea1:	85 c0                	test   %eax,%eax
+  801ea3:	78 1c                	js     801ec1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ea5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ea9:	74 1d                	je     801ec8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801eab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eae:	8b 40 18             	mov    0x18(%eax),%eax
+  801eb1:	85 c0                	test   %eax,%eax
+  801eb3:	74 54                	je     801f09 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801eb5:	83 ec 08             	sub    $0x8,%esp
+  801eb8:	ff 75 0c             	push   0xc(%ebp)
+  801ebb:	56                   	push   %esi
+  801ebc:	ff d0                	call   *%eax
+  801ebe:	83 c4 10             	add    $0x10,%esp
+}
+  801ec1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec4:	5b                   	pop    %ebx
+  801ec5:	5e                   	pop    %esi
+  801ec6:	5d                   	pop    %ebp
+  801ec7:	c3                   	ret
+  801ec8:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801eca:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ecf:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ed5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801eda:	76 1c                	jbe    801ef8 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801edc:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801edf:	83 ec 04             	sub    $0x4,%esp
+  801ee2:	53                   	push   %ebx
+  801ee3:	50                   	push   %eax
+  801ee4:	68 78 32 80 00       	push   $0x803278
+  801ee9:	e8 c2 e3 ff ff       	call   8002b0 <cprintf>
+		return -E_INVAL;
+  801eee:	83 c4 10             	add    $0x10,%esp
+  801ef1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef6:	eb c9                	jmp    801ec1 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ef8:	c1 e8 10             	shr    $0x10,%eax
+  801efb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f01:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f07:	eb d3                	jmp    801edc <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801f09:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f0e:	eb b1                	jmp    801ec1 <ftruncate+0x50>
+
+00801f10 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	56                   	push   %esi
+  801f14:	53                   	push   %ebx
+  801f15:	83 ec 18             	sub    $0x18,%esp
+  801f18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f1b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f1e:	50                   	push   %eax
+  801f1f:	ff 75 08             	push   0x8(%ebp)
+  801f22:	e8 0b fb ff ff       	call   801a32 <fd_lookup>
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	78 49                	js     801f77 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f2e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f31:	83 ec 08             	sub    $0x8,%esp
+  801f34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f37:	50                   	push   %eax
+  801f38:	ff 36                	push   (%esi)
+  801f3a:	e8 43 fb ff ff       	call   801a82 <dev_lookup>
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 31                	js     801f77 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f49:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f4d:	74 2f                	je     801f7e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f4f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f52:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f59:	00 00 00 
+	stat->st_isdir = 0;
+  801f5c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f63:	00 00 00 
+	stat->st_dev = dev;
+  801f66:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f6c:	83 ec 08             	sub    $0x8,%esp
+  801f6f:	53                   	push   %ebx
+  801f70:	56                   	push   %esi
+  801f71:	ff 50 14             	call   *0x14(%eax)
+  801f74:	83 c4 10             	add    $0x10,%esp
+}
+  801f77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f7a:	5b                   	pop    %ebx
+  801f7b:	5e                   	pop    %esi
+  801f7c:	5d                   	pop    %ebp
+  801f7d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f7e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f83:	eb f2                	jmp    801f77 <fstat+0x67>
+
+00801f85 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	56                   	push   %esi
+  801f89:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f8a:	83 ec 08             	sub    $0x8,%esp
+  801f8d:	6a 00                	push   $0x0
+  801f8f:	ff 75 08             	push   0x8(%ebp)
+  801f92:	e8 e4 01 00 00       	call   80217b <open>
+  801f97:	89 c3                	mov    %eax,%ebx
+  801f99:	83 c4 10             	add    $0x10,%esp
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	78 1b                	js     801fbb <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801fa0:	83 ec 08             	sub    $0x8,%esp
+  801fa3:	ff 75 0c             	push   0xc(%ebp)
+  801fa6:	50                   	push   %eax
+  801fa7:	e8 64 ff ff ff       	call   801f10 <fstat>
+  801fac:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801fae:	89 1c 24             	mov    %ebx,(%esp)
+  801fb1:	e8 c6 fb ff ff       	call   801b7c <close>
+	return r;
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	89 f3                	mov    %esi,%ebx
+}
+  801fbb:	89 d8                	mov    %ebx,%eax
+  801fbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc0:	5b                   	pop    %ebx
+  801fc1:	5e                   	pop    %esi
+  801fc2:	5d                   	pop    %ebp
+  801fc3:	c3                   	ret
+
+00801fc4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801fc4:	55                   	push   %ebp
+  801fc5:	89 e5                	mov    %esp,%ebp
+  801fc7:	56                   	push   %esi
+  801fc8:	53                   	push   %ebx
+  801fc9:	89 c6                	mov    %eax,%esi
+  801fcb:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801fcd:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801fd4:	74 27                	je     801ffd <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801fd6:	6a 07                	push   $0x7
+  801fd8:	68 00 60 80 00       	push   $0x806000
+  801fdd:	56                   	push   %esi
+  801fde:	ff 35 00 50 80 00    	push   0x805000
+  801fe4:	e8 c6 0d 00 00       	call   802daf <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801fe9:	83 c4 0c             	add    $0xc,%esp
+  801fec:	6a 00                	push   $0x0
+  801fee:	53                   	push   %ebx
+  801fef:	6a 00                	push   $0x0
+  801ff1:	e8 a1 0d 00 00       	call   802d97 <ipc_recv>
+}
+  801ff6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff9:	5b                   	pop    %ebx
+  801ffa:	5e                   	pop    %esi
+  801ffb:	5d                   	pop    %ebp
+  801ffc:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ffd:	83 ec 0c             	sub    $0xc,%esp
+  802000:	6a 01                	push   $0x1
+  802002:	e8 fc 0d 00 00       	call   802e03 <ipc_find_env>
+  802007:	a3 00 50 80 00       	mov    %eax,0x805000
+  80200c:	83 c4 10             	add    $0x10,%esp
+  80200f:	eb c5                	jmp    801fd6 <fsipc+0x12>
+
+00802011 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802017:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80201d:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802022:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802025:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80202a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80202f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802034:	e8 8b ff ff ff       	call   801fc4 <fsipc>
+}
+  802039:	c9                   	leave
+  80203a:	c3                   	ret
+
+0080203b <devfile_flush>:
+{
+  80203b:	55                   	push   %ebp
+  80203c:	89 e5                	mov    %esp,%ebp
+  80203e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802041:	8b 45 08             	mov    0x8(%ebp),%eax
+  802044:	8b 40 0c             	mov    0xc(%eax),%eax
+  802047:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80204c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802051:	b8 06 00 00 00       	mov    $0x6,%eax
+  802056:	e8 69 ff ff ff       	call   801fc4 <fsipc>
+}
+  80205b:	c9                   	leave
+  80205c:	c3                   	ret
+
+0080205d <devfile_stat>:
+{
+  80205d:	55                   	push   %ebp
+  80205e:	89 e5                	mov    %esp,%ebp
+  802060:	53                   	push   %ebx
+  802061:	83 ec 04             	sub    $0x4,%esp
+  802064:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802067:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80206d:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802072:	ba 00 00 00 00       	mov    $0x0,%edx
+  802077:	b8 05 00 00 00       	mov    $0x5,%eax
+  80207c:	e8 43 ff ff ff       	call   801fc4 <fsipc>
+  802081:	85 c0                	test   %eax,%eax
+  802083:	78 2c                	js     8020b1 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802085:	83 ec 08             	sub    $0x8,%esp
+  802088:	68 00 60 80 00       	push   $0x806000
+  80208d:	53                   	push   %ebx
+  80208e:	e8 65 e8 ff ff       	call   8008f8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802093:	a1 80 60 80 00       	mov    0x806080,%eax
+  802098:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80209e:	a1 84 60 80 00       	mov    0x806084,%eax
+  8020a3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8020a9:	83 c4 10             	add    $0x10,%esp
+  8020ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b4:	c9                   	leave
+  8020b5:	c3                   	ret
+
+008020b6 <devfile_write>:
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	83 ec 0c             	sub    $0xc,%esp
+  8020bc:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020c2:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020c5:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8020cb:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8020d0:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8020d5:	39 d0                	cmp    %edx,%eax
+  8020d7:	0f 47 c2             	cmova  %edx,%eax
+  8020da:	50                   	push   %eax
+  8020db:	ff 75 0c             	push   0xc(%ebp)
+  8020de:	68 08 60 80 00       	push   $0x806008
+  8020e3:	e8 96 e9 ff ff       	call   800a7e <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8020e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ed:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020f2:	e8 cd fe ff ff       	call   801fc4 <fsipc>
+}
+  8020f7:	c9                   	leave
+  8020f8:	c3                   	ret
+
+008020f9 <devfile_read>:
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+  8020fc:	56                   	push   %esi
+  8020fd:	53                   	push   %ebx
+  8020fe:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802101:	8b 45 08             	mov    0x8(%ebp),%eax
+  802104:	8b 40 0c             	mov    0xc(%eax),%eax
+  802107:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80210c:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802112:	ba 00 00 00 00       	mov    $0x0,%edx
+  802117:	b8 03 00 00 00       	mov    $0x3,%eax
+  80211c:	e8 a3 fe ff ff       	call   801fc4 <fsipc>
+  802121:	89 c3                	mov    %eax,%ebx
+  802123:	85 c0                	test   %eax,%eax
+  802125:	78 1f                	js     802146 <devfile_read+0x4d>
+	assert(r <= n);
+  802127:	39 c6                	cmp    %eax,%esi
+  802129:	72 24                	jb     80214f <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80212b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802130:	7f 33                	jg     802165 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802132:	83 ec 04             	sub    $0x4,%esp
+  802135:	50                   	push   %eax
+  802136:	68 00 60 80 00       	push   $0x806000
+  80213b:	ff 75 0c             	push   0xc(%ebp)
+  80213e:	e8 3b e9 ff ff       	call   800a7e <memmove>
+	return r;
+  802143:	83 c4 10             	add    $0x10,%esp
+}
+  802146:	89 d8                	mov    %ebx,%eax
+  802148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80214b:	5b                   	pop    %ebx
+  80214c:	5e                   	pop    %esi
+  80214d:	5d                   	pop    %ebp
+  80214e:	c3                   	ret
+	assert(r <= n);
+  80214f:	68 e8 32 80 00       	push   $0x8032e8
+  802154:	68 ef 32 80 00       	push   $0x8032ef
+  802159:	6a 76                	push   $0x76
+  80215b:	68 04 33 80 00       	push   $0x803304
+  802160:	e8 70 e0 ff ff       	call   8001d5 <_panic>
+	assert(r <= PGSIZE);
+  802165:	68 0f 33 80 00       	push   $0x80330f
+  80216a:	68 ef 32 80 00       	push   $0x8032ef
+  80216f:	6a 77                	push   $0x77
+  802171:	68 04 33 80 00       	push   $0x803304
+  802176:	e8 5a e0 ff ff       	call   8001d5 <_panic>
+
+0080217b <open>:
+{
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	56                   	push   %esi
+  80217f:	53                   	push   %ebx
+  802180:	83 ec 1c             	sub    $0x1c,%esp
+  802183:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802186:	56                   	push   %esi
+  802187:	e8 31 e7 ff ff       	call   8008bd <strlen>
+  80218c:	83 c4 10             	add    $0x10,%esp
+  80218f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802194:	7f 6c                	jg     802202 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802196:	83 ec 0c             	sub    $0xc,%esp
+  802199:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80219c:	50                   	push   %eax
+  80219d:	e8 3a f8 ff ff       	call   8019dc <fd_alloc>
+  8021a2:	89 c3                	mov    %eax,%ebx
+  8021a4:	83 c4 10             	add    $0x10,%esp
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	78 3c                	js     8021e7 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021ab:	83 ec 08             	sub    $0x8,%esp
+  8021ae:	56                   	push   %esi
+  8021af:	68 00 60 80 00       	push   $0x806000
+  8021b4:	e8 3f e7 ff ff       	call   8008f8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021bc:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021c1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021c9:	e8 f6 fd ff ff       	call   801fc4 <fsipc>
+  8021ce:	89 c3                	mov    %eax,%ebx
+  8021d0:	83 c4 10             	add    $0x10,%esp
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 19                	js     8021f0 <open+0x75>
+	return fd2num(fd);
+  8021d7:	83 ec 0c             	sub    $0xc,%esp
+  8021da:	ff 75 f4             	push   -0xc(%ebp)
+  8021dd:	e8 d3 f7 ff ff       	call   8019b5 <fd2num>
+  8021e2:	89 c3                	mov    %eax,%ebx
+  8021e4:	83 c4 10             	add    $0x10,%esp
+}
+  8021e7:	89 d8                	mov    %ebx,%eax
+  8021e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ec:	5b                   	pop    %ebx
+  8021ed:	5e                   	pop    %esi
+  8021ee:	5d                   	pop    %ebp
+  8021ef:	c3                   	ret
+		fd_close(fd, 0);
+  8021f0:	83 ec 08             	sub    $0x8,%esp
+  8021f3:	6a 00                	push   $0x0
+  8021f5:	ff 75 f4             	push   -0xc(%ebp)
+  8021f8:	e8 f8 f8 ff ff       	call   801af5 <fd_close>
+		return r;
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	eb e5                	jmp    8021e7 <open+0x6c>
+		return -E_BAD_PATH;
+  802202:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802207:	eb de                	jmp    8021e7 <open+0x6c>
+
+00802209 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80220f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802214:	b8 08 00 00 00       	mov    $0x8,%eax
+  802219:	e8 a6 fd ff ff       	call   801fc4 <fsipc>
+}
+  80221e:	c9                   	leave
+  80221f:	c3                   	ret
+
+00802220 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802220:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802224:	7f 01                	jg     802227 <writebuf+0x7>
+  802226:	c3                   	ret
+{
+  802227:	55                   	push   %ebp
+  802228:	89 e5                	mov    %esp,%ebp
+  80222a:	53                   	push   %ebx
+  80222b:	83 ec 08             	sub    $0x8,%esp
+  80222e:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802230:	ff 70 04             	push   0x4(%eax)
+  802233:	8d 40 10             	lea    0x10(%eax),%eax
+  802236:	50                   	push   %eax
+  802237:	ff 33                	push   (%ebx)
+  802239:	e8 68 fb ff ff       	call   801da6 <write>
+		if (result > 0)
+  80223e:	83 c4 10             	add    $0x10,%esp
+  802241:	85 c0                	test   %eax,%eax
+  802243:	7e 03                	jle    802248 <writebuf+0x28>
+			b->result += result;
+  802245:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802248:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80224b:	74 0d                	je     80225a <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802254:	0f 4f c2             	cmovg  %edx,%eax
+  802257:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  80225a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225d:	c9                   	leave
+  80225e:	c3                   	ret
+
+0080225f <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80225f:	55                   	push   %ebp
+  802260:	89 e5                	mov    %esp,%ebp
+  802262:	53                   	push   %ebx
+  802263:	83 ec 04             	sub    $0x4,%esp
+  802266:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802269:	8b 53 04             	mov    0x4(%ebx),%edx
+  80226c:	8d 42 01             	lea    0x1(%edx),%eax
+  80226f:	89 43 04             	mov    %eax,0x4(%ebx)
+  802272:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802275:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802279:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80227e:	74 05                	je     802285 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802280:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+		writebuf(b);
+  802285:	89 d8                	mov    %ebx,%eax
+  802287:	e8 94 ff ff ff       	call   802220 <writebuf>
+		b->idx = 0;
+  80228c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802293:	eb eb                	jmp    802280 <putch+0x21>
+
+00802295 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802295:	55                   	push   %ebp
+  802296:	89 e5                	mov    %esp,%ebp
+  802298:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80229e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a1:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8022a7:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8022ae:	00 00 00 
+	b.result = 0;
+  8022b1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8022b8:	00 00 00 
+	b.error = 1;
+  8022bb:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8022c2:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8022c5:	ff 75 10             	push   0x10(%ebp)
+  8022c8:	ff 75 0c             	push   0xc(%ebp)
+  8022cb:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8022d1:	50                   	push   %eax
+  8022d2:	68 5f 22 80 00       	push   $0x80225f
+  8022d7:	e8 b2 e0 ff ff       	call   80038e <vprintfmt>
+	if (b.idx > 0)
+  8022dc:	83 c4 10             	add    $0x10,%esp
+  8022df:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8022e6:	7f 12                	jg     8022fa <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8022e8:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8022ee:	85 c0                	test   %eax,%eax
+  8022f0:	75 06                	jne    8022f8 <vfprintf+0x63>
+  8022f2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8022f8:	c9                   	leave
+  8022f9:	c3                   	ret
+		writebuf(&b);
+  8022fa:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802300:	e8 1b ff ff ff       	call   802220 <writebuf>
+  802305:	eb e1                	jmp    8022e8 <vfprintf+0x53>
+
+00802307 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802307:	55                   	push   %ebp
+  802308:	89 e5                	mov    %esp,%ebp
+  80230a:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80230d:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802310:	50                   	push   %eax
+  802311:	ff 75 0c             	push   0xc(%ebp)
+  802314:	ff 75 08             	push   0x8(%ebp)
+  802317:	e8 79 ff ff ff       	call   802295 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80231c:	c9                   	leave
+  80231d:	c3                   	ret
+
+0080231e <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  80231e:	55                   	push   %ebp
+  80231f:	89 e5                	mov    %esp,%ebp
+  802321:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802324:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802327:	50                   	push   %eax
+  802328:	ff 75 08             	push   0x8(%ebp)
+  80232b:	6a 01                	push   $0x1
+  80232d:	e8 63 ff ff ff       	call   802295 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802332:	c9                   	leave
+  802333:	c3                   	ret
+
+00802334 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802334:	55                   	push   %ebp
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80233a:	68 1b 33 80 00       	push   $0x80331b
+  80233f:	ff 75 0c             	push   0xc(%ebp)
+  802342:	e8 b1 e5 ff ff       	call   8008f8 <strcpy>
+	return 0;
+}
+  802347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80234c:	c9                   	leave
+  80234d:	c3                   	ret
+
+0080234e <devsock_close>:
+{
+  80234e:	55                   	push   %ebp
+  80234f:	89 e5                	mov    %esp,%ebp
+  802351:	53                   	push   %ebx
+  802352:	83 ec 10             	sub    $0x10,%esp
+  802355:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802358:	53                   	push   %ebx
+  802359:	e8 e4 0a 00 00       	call   802e42 <pageref>
+  80235e:	89 c2                	mov    %eax,%edx
+  802360:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802363:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802368:	83 fa 01             	cmp    $0x1,%edx
+  80236b:	74 05                	je     802372 <devsock_close+0x24>
+}
+  80236d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802370:	c9                   	leave
+  802371:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802372:	83 ec 0c             	sub    $0xc,%esp
+  802375:	ff 73 0c             	push   0xc(%ebx)
+  802378:	e8 b7 02 00 00       	call   802634 <nsipc_close>
+  80237d:	83 c4 10             	add    $0x10,%esp
+  802380:	eb eb                	jmp    80236d <devsock_close+0x1f>
+
+00802382 <devsock_write>:
+{
+  802382:	55                   	push   %ebp
+  802383:	89 e5                	mov    %esp,%ebp
+  802385:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802388:	6a 00                	push   $0x0
+  80238a:	ff 75 10             	push   0x10(%ebp)
+  80238d:	ff 75 0c             	push   0xc(%ebp)
+  802390:	8b 45 08             	mov    0x8(%ebp),%eax
+  802393:	ff 70 0c             	push   0xc(%eax)
+  802396:	e8 79 03 00 00       	call   802714 <nsipc_send>
+}
+  80239b:	c9                   	leave
+  80239c:	c3                   	ret
+
+0080239d <devsock_read>:
+{
+  80239d:	55                   	push   %ebp
+  80239e:	89 e5                	mov    %esp,%ebp
+  8023a0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8023a3:	6a 00                	push   $0x0
+  8023a5:	ff 75 10             	push   0x10(%ebp)
+  8023a8:	ff 75 0c             	push   0xc(%ebp)
+  8023ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ae:	ff 70 0c             	push   0xc(%eax)
+  8023b1:	e8 ef 02 00 00       	call   8026a5 <nsipc_recv>
+}
+  8023b6:	c9                   	leave
+  8023b7:	c3                   	ret
+
+008023b8 <fd2sockid>:
+{
+  8023b8:	55                   	push   %ebp
+  8023b9:	89 e5                	mov    %esp,%ebp
+  8023bb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8023be:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023c1:	52                   	push   %edx
+  8023c2:	50                   	push   %eax
+  8023c3:	e8 6a f6 ff ff       	call   801a32 <fd_lookup>
+  8023c8:	83 c4 10             	add    $0x10,%esp
+  8023cb:	85 c0                	test   %eax,%eax
+  8023cd:	78 10                	js     8023df <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8023cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023d2:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8023d8:	39 08                	cmp    %ecx,(%eax)
+  8023da:	75 05                	jne    8023e1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8023dc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023e1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023e6:	eb f7                	jmp    8023df <fd2sockid+0x27>
+
+008023e8 <alloc_sockfd>:
+{
+  8023e8:	55                   	push   %ebp
+  8023e9:	89 e5                	mov    %esp,%ebp
+  8023eb:	56                   	push   %esi
+  8023ec:	53                   	push   %ebx
+  8023ed:	83 ec 1c             	sub    $0x1c,%esp
+  8023f0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8023f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023f5:	50                   	push   %eax
+  8023f6:	e8 e1 f5 ff ff       	call   8019dc <fd_alloc>
+  8023fb:	89 c3                	mov    %eax,%ebx
+  8023fd:	83 c4 10             	add    $0x10,%esp
+  802400:	85 c0                	test   %eax,%eax
+  802402:	78 43                	js     802447 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802404:	83 ec 04             	sub    $0x4,%esp
+  802407:	68 07 04 00 00       	push   $0x407
+  80240c:	ff 75 f4             	push   -0xc(%ebp)
+  80240f:	6a 00                	push   $0x0
+  802411:	e8 da e9 ff ff       	call   800df0 <sys_page_alloc>
+  802416:	89 c3                	mov    %eax,%ebx
+  802418:	83 c4 10             	add    $0x10,%esp
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	78 28                	js     802447 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80241f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802422:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802428:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80242a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80242d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802434:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802437:	83 ec 0c             	sub    $0xc,%esp
+  80243a:	50                   	push   %eax
+  80243b:	e8 75 f5 ff ff       	call   8019b5 <fd2num>
+  802440:	89 c3                	mov    %eax,%ebx
+  802442:	83 c4 10             	add    $0x10,%esp
+  802445:	eb 0c                	jmp    802453 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802447:	83 ec 0c             	sub    $0xc,%esp
+  80244a:	56                   	push   %esi
+  80244b:	e8 e4 01 00 00       	call   802634 <nsipc_close>
+		return r;
+  802450:	83 c4 10             	add    $0x10,%esp
+}
+  802453:	89 d8                	mov    %ebx,%eax
+  802455:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802458:	5b                   	pop    %ebx
+  802459:	5e                   	pop    %esi
+  80245a:	5d                   	pop    %ebp
+  80245b:	c3                   	ret
+
+0080245c <accept>:
+{
+  80245c:	55                   	push   %ebp
+  80245d:	89 e5                	mov    %esp,%ebp
+  80245f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802462:	8b 45 08             	mov    0x8(%ebp),%eax
+  802465:	e8 4e ff ff ff       	call   8023b8 <fd2sockid>
+  80246a:	85 c0                	test   %eax,%eax
+  80246c:	78 1b                	js     802489 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80246e:	83 ec 04             	sub    $0x4,%esp
+  802471:	ff 75 10             	push   0x10(%ebp)
+  802474:	ff 75 0c             	push   0xc(%ebp)
+  802477:	50                   	push   %eax
+  802478:	e8 0e 01 00 00       	call   80258b <nsipc_accept>
+  80247d:	83 c4 10             	add    $0x10,%esp
+  802480:	85 c0                	test   %eax,%eax
+  802482:	78 05                	js     802489 <accept+0x2d>
+	return alloc_sockfd(r);
+  802484:	e8 5f ff ff ff       	call   8023e8 <alloc_sockfd>
+}
+  802489:	c9                   	leave
+  80248a:	c3                   	ret
+
+0080248b <bind>:
+{
+  80248b:	55                   	push   %ebp
+  80248c:	89 e5                	mov    %esp,%ebp
+  80248e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802491:	8b 45 08             	mov    0x8(%ebp),%eax
+  802494:	e8 1f ff ff ff       	call   8023b8 <fd2sockid>
+  802499:	85 c0                	test   %eax,%eax
+  80249b:	78 12                	js     8024af <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80249d:	83 ec 04             	sub    $0x4,%esp
+  8024a0:	ff 75 10             	push   0x10(%ebp)
+  8024a3:	ff 75 0c             	push   0xc(%ebp)
+  8024a6:	50                   	push   %eax
+  8024a7:	e8 31 01 00 00       	call   8025dd <nsipc_bind>
+  8024ac:	83 c4 10             	add    $0x10,%esp
+}
+  8024af:	c9                   	leave
+  8024b0:	c3                   	ret
+
+008024b1 <shutdown>:
+{
+  8024b1:	55                   	push   %ebp
+  8024b2:	89 e5                	mov    %esp,%ebp
+  8024b4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ba:	e8 f9 fe ff ff       	call   8023b8 <fd2sockid>
+  8024bf:	85 c0                	test   %eax,%eax
+  8024c1:	78 0f                	js     8024d2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8024c3:	83 ec 08             	sub    $0x8,%esp
+  8024c6:	ff 75 0c             	push   0xc(%ebp)
+  8024c9:	50                   	push   %eax
+  8024ca:	e8 43 01 00 00       	call   802612 <nsipc_shutdown>
+  8024cf:	83 c4 10             	add    $0x10,%esp
+}
+  8024d2:	c9                   	leave
+  8024d3:	c3                   	ret
+
+008024d4 <connect>:
+{
+  8024d4:	55                   	push   %ebp
+  8024d5:	89 e5                	mov    %esp,%ebp
+  8024d7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024dd:	e8 d6 fe ff ff       	call   8023b8 <fd2sockid>
+  8024e2:	85 c0                	test   %eax,%eax
+  8024e4:	78 12                	js     8024f8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8024e6:	83 ec 04             	sub    $0x4,%esp
+  8024e9:	ff 75 10             	push   0x10(%ebp)
+  8024ec:	ff 75 0c             	push   0xc(%ebp)
+  8024ef:	50                   	push   %eax
+  8024f0:	e8 59 01 00 00       	call   80264e <nsipc_connect>
+  8024f5:	83 c4 10             	add    $0x10,%esp
+}
+  8024f8:	c9                   	leave
+  8024f9:	c3                   	ret
+
+008024fa <listen>:
+{
+  8024fa:	55                   	push   %ebp
+  8024fb:	89 e5                	mov    %esp,%ebp
+  8024fd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802500:	8b 45 08             	mov    0x8(%ebp),%eax
+  802503:	e8 b0 fe ff ff       	call   8023b8 <fd2sockid>
+  802508:	85 c0                	test   %eax,%eax
+  80250a:	78 0f                	js     80251b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80250c:	83 ec 08             	sub    $0x8,%esp
+  80250f:	ff 75 0c             	push   0xc(%ebp)
+  802512:	50                   	push   %eax
+  802513:	e8 6b 01 00 00       	call   802683 <nsipc_listen>
+  802518:	83 c4 10             	add    $0x10,%esp
+}
+  80251b:	c9                   	leave
+  80251c:	c3                   	ret
+
+0080251d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80251d:	55                   	push   %ebp
+  80251e:	89 e5                	mov    %esp,%ebp
+  802520:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802523:	ff 75 10             	push   0x10(%ebp)
+  802526:	ff 75 0c             	push   0xc(%ebp)
+  802529:	ff 75 08             	push   0x8(%ebp)
+  80252c:	e8 41 02 00 00       	call   802772 <nsipc_socket>
+  802531:	83 c4 10             	add    $0x10,%esp
+  802534:	85 c0                	test   %eax,%eax
+  802536:	78 05                	js     80253d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802538:	e8 ab fe ff ff       	call   8023e8 <alloc_sockfd>
+}
+  80253d:	c9                   	leave
+  80253e:	c3                   	ret
+
+0080253f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80253f:	55                   	push   %ebp
+  802540:	89 e5                	mov    %esp,%ebp
+  802542:	53                   	push   %ebx
+  802543:	83 ec 04             	sub    $0x4,%esp
+  802546:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802548:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80254f:	74 26                	je     802577 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802551:	6a 07                	push   $0x7
+  802553:	68 00 70 80 00       	push   $0x807000
+  802558:	53                   	push   %ebx
+  802559:	ff 35 04 50 80 00    	push   0x805004
+  80255f:	e8 4b 08 00 00       	call   802daf <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802564:	83 c4 0c             	add    $0xc,%esp
+  802567:	6a 00                	push   $0x0
+  802569:	6a 00                	push   $0x0
+  80256b:	6a 00                	push   $0x0
+  80256d:	e8 25 08 00 00       	call   802d97 <ipc_recv>
+}
+  802572:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802575:	c9                   	leave
+  802576:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802577:	83 ec 0c             	sub    $0xc,%esp
+  80257a:	6a 02                	push   $0x2
+  80257c:	e8 82 08 00 00       	call   802e03 <ipc_find_env>
+  802581:	a3 04 50 80 00       	mov    %eax,0x805004
+  802586:	83 c4 10             	add    $0x10,%esp
+  802589:	eb c6                	jmp    802551 <nsipc+0x12>
+
+0080258b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80258b:	55                   	push   %ebp
+  80258c:	89 e5                	mov    %esp,%ebp
+  80258e:	56                   	push   %esi
+  80258f:	53                   	push   %ebx
+  802590:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802593:	8b 45 08             	mov    0x8(%ebp),%eax
+  802596:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80259b:	8b 06                	mov    (%esi),%eax
+  80259d:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8025a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025a7:	e8 93 ff ff ff       	call   80253f <nsipc>
+  8025ac:	89 c3                	mov    %eax,%ebx
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	79 09                	jns    8025bb <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8025b2:	89 d8                	mov    %ebx,%eax
+  8025b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025b7:	5b                   	pop    %ebx
+  8025b8:	5e                   	pop    %esi
+  8025b9:	5d                   	pop    %ebp
+  8025ba:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8025bb:	83 ec 04             	sub    $0x4,%esp
+  8025be:	ff 35 10 70 80 00    	push   0x807010
+  8025c4:	68 00 70 80 00       	push   $0x807000
+  8025c9:	ff 75 0c             	push   0xc(%ebp)
+  8025cc:	e8 ad e4 ff ff       	call   800a7e <memmove>
+		*addrlen = ret->ret_addrlen;
+  8025d1:	a1 10 70 80 00       	mov    0x807010,%eax
+  8025d6:	89 06                	mov    %eax,(%esi)
+  8025d8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8025db:	eb d5                	jmp    8025b2 <nsipc_accept+0x27>
+
+008025dd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8025dd:	55                   	push   %ebp
+  8025de:	89 e5                	mov    %esp,%ebp
+  8025e0:	53                   	push   %ebx
+  8025e1:	83 ec 08             	sub    $0x8,%esp
+  8025e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8025e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ea:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8025ef:	53                   	push   %ebx
+  8025f0:	ff 75 0c             	push   0xc(%ebp)
+  8025f3:	68 04 70 80 00       	push   $0x807004
+  8025f8:	e8 81 e4 ff ff       	call   800a7e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8025fd:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802603:	b8 02 00 00 00       	mov    $0x2,%eax
+  802608:	e8 32 ff ff ff       	call   80253f <nsipc>
+}
+  80260d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802610:	c9                   	leave
+  802611:	c3                   	ret
+
+00802612 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802612:	55                   	push   %ebp
+  802613:	89 e5                	mov    %esp,%ebp
+  802615:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802618:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802620:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802623:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802628:	b8 03 00 00 00       	mov    $0x3,%eax
+  80262d:	e8 0d ff ff ff       	call   80253f <nsipc>
+}
+  802632:	c9                   	leave
+  802633:	c3                   	ret
+
+00802634 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+  802637:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80263a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80263d:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802642:	b8 04 00 00 00       	mov    $0x4,%eax
+  802647:	e8 f3 fe ff ff       	call   80253f <nsipc>
+}
+  80264c:	c9                   	leave
+  80264d:	c3                   	ret
+
+0080264e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80264e:	55                   	push   %ebp
+  80264f:	89 e5                	mov    %esp,%ebp
+  802651:	53                   	push   %ebx
+  802652:	83 ec 08             	sub    $0x8,%esp
+  802655:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802658:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265b:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802660:	53                   	push   %ebx
+  802661:	ff 75 0c             	push   0xc(%ebp)
+  802664:	68 04 70 80 00       	push   $0x807004
+  802669:	e8 10 e4 ff ff       	call   800a7e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80266e:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802674:	b8 05 00 00 00       	mov    $0x5,%eax
+  802679:	e8 c1 fe ff ff       	call   80253f <nsipc>
+}
+  80267e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802681:	c9                   	leave
+  802682:	c3                   	ret
+
+00802683 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802683:	55                   	push   %ebp
+  802684:	89 e5                	mov    %esp,%ebp
+  802686:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802691:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802694:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802699:	b8 06 00 00 00       	mov    $0x6,%eax
+  80269e:	e8 9c fe ff ff       	call   80253f <nsipc>
+}
+  8026a3:	c9                   	leave
+  8026a4:	c3                   	ret
+
+008026a5 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8026a5:	55                   	push   %ebp
+  8026a6:	89 e5                	mov    %esp,%ebp
+  8026a8:	56                   	push   %esi
+  8026a9:	53                   	push   %ebx
+  8026aa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8026ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b0:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8026b5:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8026bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026be:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8026c3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026c8:	e8 72 fe ff ff       	call   80253f <nsipc>
+  8026cd:	89 c3                	mov    %eax,%ebx
+  8026cf:	85 c0                	test   %eax,%eax
+  8026d1:	78 22                	js     8026f5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8026d3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8026d8:	39 c6                	cmp    %eax,%esi
+  8026da:	0f 4e c6             	cmovle %esi,%eax
+  8026dd:	39 c3                	cmp    %eax,%ebx
+  8026df:	7f 1d                	jg     8026fe <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8026e1:	83 ec 04             	sub    $0x4,%esp
+  8026e4:	53                   	push   %ebx
+  8026e5:	68 00 70 80 00       	push   $0x807000
+  8026ea:	ff 75 0c             	push   0xc(%ebp)
+  8026ed:	e8 8c e3 ff ff       	call   800a7e <memmove>
+  8026f2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8026f5:	89 d8                	mov    %ebx,%eax
+  8026f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fa:	5b                   	pop    %ebx
+  8026fb:	5e                   	pop    %esi
+  8026fc:	5d                   	pop    %ebp
+  8026fd:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8026fe:	68 27 33 80 00       	push   $0x803327
+  802703:	68 ef 32 80 00       	push   $0x8032ef
+  802708:	6a 62                	push   $0x62
+  80270a:	68 3c 33 80 00       	push   $0x80333c
+  80270f:	e8 c1 da ff ff       	call   8001d5 <_panic>
+
+00802714 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802714:	55                   	push   %ebp
+  802715:	89 e5                	mov    %esp,%ebp
+  802717:	53                   	push   %ebx
+  802718:	83 ec 04             	sub    $0x4,%esp
+  80271b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80271e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802721:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802726:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80272c:	7f 2e                	jg     80275c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80272e:	83 ec 04             	sub    $0x4,%esp
+  802731:	53                   	push   %ebx
+  802732:	ff 75 0c             	push   0xc(%ebp)
+  802735:	68 0c 70 80 00       	push   $0x80700c
+  80273a:	e8 3f e3 ff ff       	call   800a7e <memmove>
+	nsipcbuf.send.req_size = size;
+  80273f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802745:	8b 45 14             	mov    0x14(%ebp),%eax
+  802748:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80274d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802752:	e8 e8 fd ff ff       	call   80253f <nsipc>
+}
+  802757:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80275a:	c9                   	leave
+  80275b:	c3                   	ret
+	assert(size < 1600);
+  80275c:	68 48 33 80 00       	push   $0x803348
+  802761:	68 ef 32 80 00       	push   $0x8032ef
+  802766:	6a 6d                	push   $0x6d
+  802768:	68 3c 33 80 00       	push   $0x80333c
+  80276d:	e8 63 da ff ff       	call   8001d5 <_panic>
+
+00802772 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802772:	55                   	push   %ebp
+  802773:	89 e5                	mov    %esp,%ebp
+  802775:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802778:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802780:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802783:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802788:	8b 45 10             	mov    0x10(%ebp),%eax
+  80278b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802790:	b8 09 00 00 00       	mov    $0x9,%eax
+  802795:	e8 a5 fd ff ff       	call   80253f <nsipc>
+}
+  80279a:	c9                   	leave
+  80279b:	c3                   	ret
+
+0080279c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80279c:	55                   	push   %ebp
+  80279d:	89 e5                	mov    %esp,%ebp
+  80279f:	56                   	push   %esi
+  8027a0:	53                   	push   %ebx
+  8027a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8027a4:	83 ec 0c             	sub    $0xc,%esp
+  8027a7:	ff 75 08             	push   0x8(%ebp)
+  8027aa:	e8 16 f2 ff ff       	call   8019c5 <fd2data>
+  8027af:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8027b1:	83 c4 08             	add    $0x8,%esp
+  8027b4:	68 54 33 80 00       	push   $0x803354
+  8027b9:	53                   	push   %ebx
+  8027ba:	e8 39 e1 ff ff       	call   8008f8 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8027bf:	8b 46 04             	mov    0x4(%esi),%eax
+  8027c2:	2b 06                	sub    (%esi),%eax
+  8027c4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8027ca:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8027d1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8027d4:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8027db:	40 80 00 
+	return 0;
+}
+  8027de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027e6:	5b                   	pop    %ebx
+  8027e7:	5e                   	pop    %esi
+  8027e8:	5d                   	pop    %ebp
+  8027e9:	c3                   	ret
+
+008027ea <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027ea:	55                   	push   %ebp
+  8027eb:	89 e5                	mov    %esp,%ebp
+  8027ed:	53                   	push   %ebx
+  8027ee:	83 ec 0c             	sub    $0xc,%esp
+  8027f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8027f4:	53                   	push   %ebx
+  8027f5:	6a 00                	push   $0x0
+  8027f7:	e8 cf e6 ff ff       	call   800ecb <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8027fc:	89 1c 24             	mov    %ebx,(%esp)
+  8027ff:	e8 c1 f1 ff ff       	call   8019c5 <fd2data>
+  802804:	83 c4 08             	add    $0x8,%esp
+  802807:	50                   	push   %eax
+  802808:	6a 00                	push   $0x0
+  80280a:	e8 bc e6 ff ff       	call   800ecb <sys_page_unmap>
+}
+  80280f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+
+00802814 <_pipeisclosed>:
+{
+  802814:	55                   	push   %ebp
+  802815:	89 e5                	mov    %esp,%ebp
+  802817:	57                   	push   %edi
+  802818:	56                   	push   %esi
+  802819:	53                   	push   %ebx
+  80281a:	83 ec 1c             	sub    $0x1c,%esp
+  80281d:	89 c7                	mov    %eax,%edi
+  80281f:	89 d6                	mov    %edx,%esi
+  802821:	eb 3c                	jmp    80285f <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802823:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802826:	83 ec 0c             	sub    $0xc,%esp
+  802829:	57                   	push   %edi
+  80282a:	e8 13 06 00 00       	call   802e42 <pageref>
+  80282f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802832:	89 34 24             	mov    %esi,(%esp)
+  802835:	e8 08 06 00 00       	call   802e42 <pageref>
+  80283a:	89 c2                	mov    %eax,%edx
+  80283c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80283e:	05 00 00 00 20       	add    $0x20000000,%eax
+  802843:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802846:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80284c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802851:	76 31                	jbe    802884 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802853:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802856:	39 c3                	cmp    %eax,%ebx
+  802858:	74 76                	je     8028d0 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80285a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80285d:	74 36                	je     802895 <_pipeisclosed+0x81>
+  80285f:	89 e0                	mov    %esp,%eax
+  802861:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802866:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80286c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802871:	77 b0                	ja     802823 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802873:	c1 e8 10             	shr    $0x10,%eax
+  802876:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80287c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802882:	eb 9f                	jmp    802823 <_pipeisclosed+0xf>
+  802884:	c1 e8 10             	shr    $0x10,%eax
+  802887:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80288d:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802893:	eb be                	jmp    802853 <_pipeisclosed+0x3f>
+  802895:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802897:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80289c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8028a2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8028a7:	76 16                	jbe    8028bf <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8028a9:	8b 42 58             	mov    0x58(%edx),%eax
+  8028ac:	6a 01                	push   $0x1
+  8028ae:	50                   	push   %eax
+  8028af:	53                   	push   %ebx
+  8028b0:	68 5b 33 80 00       	push   $0x80335b
+  8028b5:	e8 f6 d9 ff ff       	call   8002b0 <cprintf>
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	eb a0                	jmp    80285f <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8028bf:	c1 e8 10             	shr    $0x10,%eax
+  8028c2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8028c8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8028ce:	eb d9                	jmp    8028a9 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8028d0:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8028d3:	0f 94 c0             	sete   %al
+  8028d6:	0f b6 c0             	movzbl %al,%eax
+}
+  8028d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028dc:	5b                   	pop    %ebx
+  8028dd:	5e                   	pop    %esi
+  8028de:	5f                   	pop    %edi
+  8028df:	5d                   	pop    %ebp
+  8028e0:	c3                   	ret
+
+008028e1 <devpipe_write>:
+{
+  8028e1:	55                   	push   %ebp
+  8028e2:	89 e5                	mov    %esp,%ebp
+  8028e4:	57                   	push   %edi
+  8028e5:	56                   	push   %esi
+  8028e6:	53                   	push   %ebx
+  8028e7:	83 ec 28             	sub    $0x28,%esp
+  8028ea:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8028ed:	56                   	push   %esi
+  8028ee:	e8 d2 f0 ff ff       	call   8019c5 <fd2data>
+  8028f3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8028f5:	83 c4 10             	add    $0x10,%esp
+  8028f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fd:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802900:	75 09                	jne    80290b <devpipe_write+0x2a>
+	return i;
+  802902:	89 f8                	mov    %edi,%eax
+  802904:	eb 23                	jmp    802929 <devpipe_write+0x48>
+			sys_yield();
+  802906:	e8 9f e4 ff ff       	call   800daa <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80290b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80290e:	8b 0b                	mov    (%ebx),%ecx
+  802910:	8d 51 20             	lea    0x20(%ecx),%edx
+  802913:	39 d0                	cmp    %edx,%eax
+  802915:	72 1a                	jb     802931 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802917:	89 da                	mov    %ebx,%edx
+  802919:	89 f0                	mov    %esi,%eax
+  80291b:	e8 f4 fe ff ff       	call   802814 <_pipeisclosed>
+  802920:	85 c0                	test   %eax,%eax
+  802922:	74 e2                	je     802906 <devpipe_write+0x25>
+				return 0;
+  802924:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292c:	5b                   	pop    %ebx
+  80292d:	5e                   	pop    %esi
+  80292e:	5f                   	pop    %edi
+  80292f:	5d                   	pop    %ebp
+  802930:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802931:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802934:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802938:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80293b:	89 c2                	mov    %eax,%edx
+  80293d:	c1 fa 1f             	sar    $0x1f,%edx
+  802940:	89 d1                	mov    %edx,%ecx
+  802942:	c1 e9 1b             	shr    $0x1b,%ecx
+  802945:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802948:	83 e2 1f             	and    $0x1f,%edx
+  80294b:	29 ca                	sub    %ecx,%edx
+  80294d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802951:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802955:	83 c0 01             	add    $0x1,%eax
+  802958:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80295b:	83 c7 01             	add    $0x1,%edi
+  80295e:	eb 9d                	jmp    8028fd <devpipe_write+0x1c>
+
+00802960 <devpipe_read>:
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	57                   	push   %edi
+  802964:	56                   	push   %esi
+  802965:	53                   	push   %ebx
+  802966:	83 ec 18             	sub    $0x18,%esp
+  802969:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80296c:	57                   	push   %edi
+  80296d:	e8 53 f0 ff ff       	call   8019c5 <fd2data>
+  802972:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802974:	83 c4 10             	add    $0x10,%esp
+  802977:	be 00 00 00 00       	mov    $0x0,%esi
+  80297c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80297f:	75 13                	jne    802994 <devpipe_read+0x34>
+	return i;
+  802981:	89 f0                	mov    %esi,%eax
+  802983:	eb 02                	jmp    802987 <devpipe_read+0x27>
+				return i;
+  802985:	89 f0                	mov    %esi,%eax
+}
+  802987:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80298a:	5b                   	pop    %ebx
+  80298b:	5e                   	pop    %esi
+  80298c:	5f                   	pop    %edi
+  80298d:	5d                   	pop    %ebp
+  80298e:	c3                   	ret
+			sys_yield();
+  80298f:	e8 16 e4 ff ff       	call   800daa <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802994:	8b 03                	mov    (%ebx),%eax
+  802996:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802999:	75 18                	jne    8029b3 <devpipe_read+0x53>
+			if (i > 0)
+  80299b:	85 f6                	test   %esi,%esi
+  80299d:	75 e6                	jne    802985 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80299f:	89 da                	mov    %ebx,%edx
+  8029a1:	89 f8                	mov    %edi,%eax
+  8029a3:	e8 6c fe ff ff       	call   802814 <_pipeisclosed>
+  8029a8:	85 c0                	test   %eax,%eax
+  8029aa:	74 e3                	je     80298f <devpipe_read+0x2f>
+				return 0;
+  8029ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b1:	eb d4                	jmp    802987 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8029b3:	99                   	cltd
+  8029b4:	c1 ea 1b             	shr    $0x1b,%edx
+  8029b7:	01 d0                	add    %edx,%eax
+  8029b9:	83 e0 1f             	and    $0x1f,%eax
+  8029bc:	29 d0                	sub    %edx,%eax
+  8029be:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8029c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029c6:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8029c9:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8029cc:	83 c6 01             	add    $0x1,%esi
+  8029cf:	eb ab                	jmp    80297c <devpipe_read+0x1c>
+
+008029d1 <pipe>:
+{
+  8029d1:	55                   	push   %ebp
+  8029d2:	89 e5                	mov    %esp,%ebp
+  8029d4:	56                   	push   %esi
+  8029d5:	53                   	push   %ebx
+  8029d6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8029d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029dc:	50                   	push   %eax
+  8029dd:	e8 fa ef ff ff       	call   8019dc <fd_alloc>
+  8029e2:	89 c3                	mov    %eax,%ebx
+  8029e4:	83 c4 10             	add    $0x10,%esp
+  8029e7:	85 c0                	test   %eax,%eax
+  8029e9:	0f 88 23 01 00 00    	js     802b12 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029ef:	83 ec 04             	sub    $0x4,%esp
+  8029f2:	68 07 04 00 00       	push   $0x407
+  8029f7:	ff 75 f4             	push   -0xc(%ebp)
+  8029fa:	6a 00                	push   $0x0
+  8029fc:	e8 ef e3 ff ff       	call   800df0 <sys_page_alloc>
+  802a01:	89 c3                	mov    %eax,%ebx
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	0f 88 04 01 00 00    	js     802b12 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802a0e:	83 ec 0c             	sub    $0xc,%esp
+  802a11:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a14:	50                   	push   %eax
+  802a15:	e8 c2 ef ff ff       	call   8019dc <fd_alloc>
+  802a1a:	89 c3                	mov    %eax,%ebx
+  802a1c:	83 c4 10             	add    $0x10,%esp
+  802a1f:	85 c0                	test   %eax,%eax
+  802a21:	0f 88 db 00 00 00    	js     802b02 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a27:	83 ec 04             	sub    $0x4,%esp
+  802a2a:	68 07 04 00 00       	push   $0x407
+  802a2f:	ff 75 f0             	push   -0x10(%ebp)
+  802a32:	6a 00                	push   $0x0
+  802a34:	e8 b7 e3 ff ff       	call   800df0 <sys_page_alloc>
+  802a39:	89 c3                	mov    %eax,%ebx
+  802a3b:	83 c4 10             	add    $0x10,%esp
+  802a3e:	85 c0                	test   %eax,%eax
+  802a40:	0f 88 bc 00 00 00    	js     802b02 <pipe+0x131>
+	va = fd2data(fd0);
+  802a46:	83 ec 0c             	sub    $0xc,%esp
+  802a49:	ff 75 f4             	push   -0xc(%ebp)
+  802a4c:	e8 74 ef ff ff       	call   8019c5 <fd2data>
+  802a51:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a53:	83 c4 0c             	add    $0xc,%esp
+  802a56:	68 07 04 00 00       	push   $0x407
+  802a5b:	50                   	push   %eax
+  802a5c:	6a 00                	push   $0x0
+  802a5e:	e8 8d e3 ff ff       	call   800df0 <sys_page_alloc>
+  802a63:	89 c3                	mov    %eax,%ebx
+  802a65:	83 c4 10             	add    $0x10,%esp
+  802a68:	85 c0                	test   %eax,%eax
+  802a6a:	0f 88 82 00 00 00    	js     802af2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a70:	83 ec 0c             	sub    $0xc,%esp
+  802a73:	ff 75 f0             	push   -0x10(%ebp)
+  802a76:	e8 4a ef ff ff       	call   8019c5 <fd2data>
+  802a7b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a82:	50                   	push   %eax
+  802a83:	6a 00                	push   $0x0
+  802a85:	56                   	push   %esi
+  802a86:	6a 00                	push   $0x0
+  802a88:	e8 d0 e3 ff ff       	call   800e5d <sys_page_map>
+  802a8d:	89 c3                	mov    %eax,%ebx
+  802a8f:	83 c4 20             	add    $0x20,%esp
+  802a92:	85 c0                	test   %eax,%eax
+  802a94:	78 4e                	js     802ae4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802a96:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802a9b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a9e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802aa0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802aa3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802aaa:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802aad:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802aaf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802ab2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802ab9:	83 ec 0c             	sub    $0xc,%esp
+  802abc:	ff 75 f4             	push   -0xc(%ebp)
+  802abf:	e8 f1 ee ff ff       	call   8019b5 <fd2num>
+  802ac4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ac7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802ac9:	83 c4 04             	add    $0x4,%esp
+  802acc:	ff 75 f0             	push   -0x10(%ebp)
+  802acf:	e8 e1 ee ff ff       	call   8019b5 <fd2num>
+  802ad4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ad7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802ada:	83 c4 10             	add    $0x10,%esp
+  802add:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ae2:	eb 2e                	jmp    802b12 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802ae4:	83 ec 08             	sub    $0x8,%esp
+  802ae7:	56                   	push   %esi
+  802ae8:	6a 00                	push   $0x0
+  802aea:	e8 dc e3 ff ff       	call   800ecb <sys_page_unmap>
+  802aef:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802af2:	83 ec 08             	sub    $0x8,%esp
+  802af5:	ff 75 f0             	push   -0x10(%ebp)
+  802af8:	6a 00                	push   $0x0
+  802afa:	e8 cc e3 ff ff       	call   800ecb <sys_page_unmap>
+  802aff:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802b02:	83 ec 08             	sub    $0x8,%esp
+  802b05:	ff 75 f4             	push   -0xc(%ebp)
+  802b08:	6a 00                	push   $0x0
+  802b0a:	e8 bc e3 ff ff       	call   800ecb <sys_page_unmap>
+  802b0f:	83 c4 10             	add    $0x10,%esp
+}
+  802b12:	89 d8                	mov    %ebx,%eax
+  802b14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b17:	5b                   	pop    %ebx
+  802b18:	5e                   	pop    %esi
+  802b19:	5d                   	pop    %ebp
+  802b1a:	c3                   	ret
+
+00802b1b <pipeisclosed>:
+{
+  802b1b:	55                   	push   %ebp
+  802b1c:	89 e5                	mov    %esp,%ebp
+  802b1e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b24:	50                   	push   %eax
+  802b25:	ff 75 08             	push   0x8(%ebp)
+  802b28:	e8 05 ef ff ff       	call   801a32 <fd_lookup>
+  802b2d:	83 c4 10             	add    $0x10,%esp
+  802b30:	85 c0                	test   %eax,%eax
+  802b32:	78 18                	js     802b4c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802b34:	83 ec 0c             	sub    $0xc,%esp
+  802b37:	ff 75 f4             	push   -0xc(%ebp)
+  802b3a:	e8 86 ee ff ff       	call   8019c5 <fd2data>
+  802b3f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802b41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b44:	e8 cb fc ff ff       	call   802814 <_pipeisclosed>
+  802b49:	83 c4 10             	add    $0x10,%esp
+}
+  802b4c:	c9                   	leave
+  802b4d:	c3                   	ret
+
+00802b4e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b53:	c3                   	ret
+
+00802b54 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b54:	55                   	push   %ebp
+  802b55:	89 e5                	mov    %esp,%ebp
+  802b57:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802b5a:	68 73 33 80 00       	push   $0x803373
+  802b5f:	ff 75 0c             	push   0xc(%ebp)
+  802b62:	e8 91 dd ff ff       	call   8008f8 <strcpy>
+	return 0;
+}
+  802b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6c:	c9                   	leave
+  802b6d:	c3                   	ret
+
+00802b6e <devcons_write>:
+{
+  802b6e:	55                   	push   %ebp
+  802b6f:	89 e5                	mov    %esp,%ebp
+  802b71:	57                   	push   %edi
+  802b72:	56                   	push   %esi
+  802b73:	53                   	push   %ebx
+  802b74:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802b7a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802b7f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802b85:	eb 2e                	jmp    802bb5 <devcons_write+0x47>
+		m = n - tot;
+  802b87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b8a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802b8c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b91:	39 c3                	cmp    %eax,%ebx
+  802b93:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802b96:	83 ec 04             	sub    $0x4,%esp
+  802b99:	53                   	push   %ebx
+  802b9a:	89 f0                	mov    %esi,%eax
+  802b9c:	03 45 0c             	add    0xc(%ebp),%eax
+  802b9f:	50                   	push   %eax
+  802ba0:	57                   	push   %edi
+  802ba1:	e8 d8 de ff ff       	call   800a7e <memmove>
+		sys_cputs(buf, m);
+  802ba6:	83 c4 08             	add    $0x8,%esp
+  802ba9:	53                   	push   %ebx
+  802baa:	57                   	push   %edi
+  802bab:	e8 c1 e0 ff ff       	call   800c71 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802bb0:	01 de                	add    %ebx,%esi
+  802bb2:	83 c4 10             	add    $0x10,%esp
+  802bb5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802bb8:	72 cd                	jb     802b87 <devcons_write+0x19>
+}
+  802bba:	89 f0                	mov    %esi,%eax
+  802bbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bbf:	5b                   	pop    %ebx
+  802bc0:	5e                   	pop    %esi
+  802bc1:	5f                   	pop    %edi
+  802bc2:	5d                   	pop    %ebp
+  802bc3:	c3                   	ret
+
+00802bc4 <devcons_read>:
+{
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802bd3:	75 07                	jne    802bdc <devcons_read+0x18>
+  802bd5:	eb 1f                	jmp    802bf6 <devcons_read+0x32>
+		sys_yield();
+  802bd7:	e8 ce e1 ff ff       	call   800daa <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802bdc:	e8 d4 e0 ff ff       	call   800cb5 <sys_cgetc>
+  802be1:	85 c0                	test   %eax,%eax
+  802be3:	74 f2                	je     802bd7 <devcons_read+0x13>
+	if (c < 0)
+  802be5:	78 0f                	js     802bf6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802be7:	83 f8 04             	cmp    $0x4,%eax
+  802bea:	74 0c                	je     802bf8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802bec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bef:	88 02                	mov    %al,(%edx)
+	return 1;
+  802bf1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802bf6:	c9                   	leave
+  802bf7:	c3                   	ret
+		return 0;
+  802bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfd:	eb f7                	jmp    802bf6 <devcons_read+0x32>
+
+00802bff <cputchar>:
+{
+  802bff:	55                   	push   %ebp
+  802c00:	89 e5                	mov    %esp,%ebp
+  802c02:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c08:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802c0b:	6a 01                	push   $0x1
+  802c0d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c10:	50                   	push   %eax
+  802c11:	e8 5b e0 ff ff       	call   800c71 <sys_cputs>
+}
+  802c16:	83 c4 10             	add    $0x10,%esp
+  802c19:	c9                   	leave
+  802c1a:	c3                   	ret
+
+00802c1b <getchar>:
+{
+  802c1b:	55                   	push   %ebp
+  802c1c:	89 e5                	mov    %esp,%ebp
+  802c1e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802c21:	6a 01                	push   $0x1
+  802c23:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c26:	50                   	push   %eax
+  802c27:	6a 00                	push   $0x0
+  802c29:	e8 8a f0 ff ff       	call   801cb8 <read>
+	if (r < 0)
+  802c2e:	83 c4 10             	add    $0x10,%esp
+  802c31:	85 c0                	test   %eax,%eax
+  802c33:	78 06                	js     802c3b <getchar+0x20>
+	if (r < 1)
+  802c35:	74 06                	je     802c3d <getchar+0x22>
+	return c;
+  802c37:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c3b:	c9                   	leave
+  802c3c:	c3                   	ret
+		return -E_EOF;
+  802c3d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c42:	eb f7                	jmp    802c3b <getchar+0x20>
+
+00802c44 <iscons>:
+{
+  802c44:	55                   	push   %ebp
+  802c45:	89 e5                	mov    %esp,%ebp
+  802c47:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c4d:	50                   	push   %eax
+  802c4e:	ff 75 08             	push   0x8(%ebp)
+  802c51:	e8 dc ed ff ff       	call   801a32 <fd_lookup>
+  802c56:	83 c4 10             	add    $0x10,%esp
+  802c59:	85 c0                	test   %eax,%eax
+  802c5b:	78 11                	js     802c6e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802c5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c60:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c66:	39 10                	cmp    %edx,(%eax)
+  802c68:	0f 94 c0             	sete   %al
+  802c6b:	0f b6 c0             	movzbl %al,%eax
+}
+  802c6e:	c9                   	leave
+  802c6f:	c3                   	ret
+
+00802c70 <opencons>:
+{
+  802c70:	55                   	push   %ebp
+  802c71:	89 e5                	mov    %esp,%ebp
+  802c73:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802c76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c79:	50                   	push   %eax
+  802c7a:	e8 5d ed ff ff       	call   8019dc <fd_alloc>
+  802c7f:	83 c4 10             	add    $0x10,%esp
+  802c82:	85 c0                	test   %eax,%eax
+  802c84:	78 3a                	js     802cc0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c86:	83 ec 04             	sub    $0x4,%esp
+  802c89:	68 07 04 00 00       	push   $0x407
+  802c8e:	ff 75 f4             	push   -0xc(%ebp)
+  802c91:	6a 00                	push   $0x0
+  802c93:	e8 58 e1 ff ff       	call   800df0 <sys_page_alloc>
+  802c98:	83 c4 10             	add    $0x10,%esp
+  802c9b:	85 c0                	test   %eax,%eax
+  802c9d:	78 21                	js     802cc0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802c9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ca2:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802ca8:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802caa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cad:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802cb4:	83 ec 0c             	sub    $0xc,%esp
+  802cb7:	50                   	push   %eax
+  802cb8:	e8 f8 ec ff ff       	call   8019b5 <fd2num>
+  802cbd:	83 c4 10             	add    $0x10,%esp
+}
+  802cc0:	c9                   	leave
+  802cc1:	c3                   	ret
+
+00802cc2 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802cc2:	55                   	push   %ebp
+  802cc3:	89 e5                	mov    %esp,%ebp
+  802cc5:	56                   	push   %esi
+  802cc6:	53                   	push   %ebx
+  802cc7:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ccd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802cd0:	85 c0                	test   %eax,%eax
+  802cd2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802cd7:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802cda:	83 ec 08             	sub    $0x8,%esp
+  802cdd:	ff 75 14             	push   0x14(%ebp)
+  802ce0:	50                   	push   %eax
+  802ce1:	e8 1b e5 ff ff       	call   801201 <sys_ipc_recv_until>
+  802ce6:	83 c4 10             	add    $0x10,%esp
+  802ce9:	85 c0                	test   %eax,%eax
+  802ceb:	78 61                	js     802d4e <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802ced:	85 f6                	test   %esi,%esi
+  802cef:	74 1c                	je     802d0d <ipc_recv_until+0x4b>
+  802cf1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cf3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802cf8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cfe:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d03:	76 5f                	jbe    802d64 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802d05:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802d0b:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802d0d:	85 db                	test   %ebx,%ebx
+  802d0f:	74 1c                	je     802d2d <ipc_recv_until+0x6b>
+  802d11:	89 e0                	mov    %esp,%eax
+  802d13:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d18:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d1e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d23:	76 50                	jbe    802d75 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802d25:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802d2b:	89 03                	mov    %eax,(%ebx)
+  802d2d:	89 e0                	mov    %esp,%eax
+  802d2f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d34:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d3a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d3f:	76 45                	jbe    802d86 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802d41:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802d47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d4a:	5b                   	pop    %ebx
+  802d4b:	5e                   	pop    %esi
+  802d4c:	5d                   	pop    %ebp
+  802d4d:	c3                   	ret
+		if (from_env_store)
+  802d4e:	85 f6                	test   %esi,%esi
+  802d50:	74 06                	je     802d58 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802d52:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802d58:	85 db                	test   %ebx,%ebx
+  802d5a:	74 eb                	je     802d47 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802d5c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802d62:	eb e3                	jmp    802d47 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d64:	c1 e8 10             	shr    $0x10,%eax
+  802d67:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d6d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d73:	eb 90                	jmp    802d05 <ipc_recv_until+0x43>
+  802d75:	c1 e8 10             	shr    $0x10,%eax
+  802d78:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d7e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d84:	eb 9f                	jmp    802d25 <ipc_recv_until+0x63>
+  802d86:	c1 e8 10             	shr    $0x10,%eax
+  802d89:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d8f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d95:	eb aa                	jmp    802d41 <ipc_recv_until+0x7f>
+
+00802d97 <ipc_recv>:
+{
+  802d97:	55                   	push   %ebp
+  802d98:	89 e5                	mov    %esp,%ebp
+  802d9a:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802d9d:	6a 00                	push   $0x0
+  802d9f:	ff 75 10             	push   0x10(%ebp)
+  802da2:	ff 75 0c             	push   0xc(%ebp)
+  802da5:	ff 75 08             	push   0x8(%ebp)
+  802da8:	e8 15 ff ff ff       	call   802cc2 <ipc_recv_until>
+}
+  802dad:	c9                   	leave
+  802dae:	c3                   	ret
+
+00802daf <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802daf:	55                   	push   %ebp
+  802db0:	89 e5                	mov    %esp,%ebp
+  802db2:	57                   	push   %edi
+  802db3:	56                   	push   %esi
+  802db4:	53                   	push   %ebx
+  802db5:	83 ec 0c             	sub    $0xc,%esp
+  802db8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802dbb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802dbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802dc1:	85 db                	test   %ebx,%ebx
+  802dc3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802dc8:	0f 44 d8             	cmove  %eax,%ebx
+  802dcb:	eb 05                	jmp    802dd2 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802dcd:	e8 d8 df ff ff       	call   800daa <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802dd2:	ff 75 14             	push   0x14(%ebp)
+  802dd5:	53                   	push   %ebx
+  802dd6:	56                   	push   %esi
+  802dd7:	57                   	push   %edi
+  802dd8:	e8 70 e3 ff ff       	call   80114d <sys_ipc_try_send>
+  802ddd:	83 c4 10             	add    $0x10,%esp
+  802de0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802de3:	74 e8                	je     802dcd <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	78 08                	js     802df1 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802de9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dec:	5b                   	pop    %ebx
+  802ded:	5e                   	pop    %esi
+  802dee:	5f                   	pop    %edi
+  802def:	5d                   	pop    %ebp
+  802df0:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802df1:	50                   	push   %eax
+  802df2:	68 7f 33 80 00       	push   $0x80337f
+  802df7:	6a 4f                	push   $0x4f
+  802df9:	68 92 33 80 00       	push   $0x803392
+  802dfe:	e8 d2 d3 ff ff       	call   8001d5 <_panic>
+
+00802e03 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e03:	55                   	push   %ebp
+  802e04:	89 e5                	mov    %esp,%ebp
+  802e06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802e09:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802e0e:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802e14:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802e1a:	8b 52 50             	mov    0x50(%edx),%edx
+  802e1d:	39 ca                	cmp    %ecx,%edx
+  802e1f:	74 11                	je     802e32 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802e21:	83 c0 01             	add    $0x1,%eax
+  802e24:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802e29:	75 e3                	jne    802e0e <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e30:	eb 0e                	jmp    802e40 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802e32:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e38:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e3d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e40:	5d                   	pop    %ebp
+  802e41:	c3                   	ret
+
+00802e42 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e42:	55                   	push   %ebp
+  802e43:	89 e5                	mov    %esp,%ebp
+  802e45:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e48:	89 c2                	mov    %eax,%edx
+  802e4a:	c1 ea 16             	shr    $0x16,%edx
+  802e4d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802e54:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e59:	f6 c1 01             	test   $0x1,%cl
+  802e5c:	74 1a                	je     802e78 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802e5e:	c1 e8 0c             	shr    $0xc,%eax
+  802e61:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802e68:	a8 01                	test   $0x1,%al
+  802e6a:	74 0c                	je     802e78 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802e6c:	c1 e8 0c             	shr    $0xc,%eax
+  802e6f:	c1 e0 04             	shl    $0x4,%eax
+  802e72:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802e78:	89 d0                	mov    %edx,%eax
+  802e7a:	5d                   	pop    %ebp
+  802e7b:	c3                   	ret
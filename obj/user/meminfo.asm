@@ -0,0 +1,6441 @@
+
+obj/user/meminfo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1c 01 00 00       	call   80014d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+static struct EnvMemInfo envinfo[NENV];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+	struct MemInfo mi;
+	int i, n;
+
+	if (argc != 1) {
+  80003c:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800040:	0f 85 99 00 00 00    	jne    8000df <umain+0xac>
+		printf("usage: meminfo\n");
+		exit();
+	}
+	if ((n = sys_meminfo(&mi, envinfo, NENV)) < 0) {
+  800046:	83 ec 04             	sub    $0x4,%esp
+  800049:	68 00 04 00 00       	push   $0x400
+  80004e:	68 00 50 80 00       	push   $0x805000
+  800053:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  800056:	50                   	push   %eax
+  800057:	e8 94 15 00 00       	call   8015f0 <sys_meminfo>
+  80005c:	89 c7                	mov    %eax,%edi
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 90 00 00 00    	js     8000f9 <umain+0xc6>
+		printf("meminfo: %e\n", n);
+		exit();
+	}
+	n = MIN(n, NENV);
+  800069:	b8 00 04 00 00       	mov    $0x400,%eax
+  80006e:	39 c7                	cmp    %eax,%edi
+  800070:	0f 4f f8             	cmovg  %eax,%edi
+
+	printf("memory: %uK total, %uK free (%uK zeroed), %uK used\n",
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800079:	c1 e0 02             	shl    $0x2,%eax
+  80007c:	50                   	push   %eax
+  80007d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800080:	c1 e0 02             	shl    $0x2,%eax
+  800083:	50                   	push   %eax
+  800084:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  800087:	c1 e0 02             	shl    $0x2,%eax
+  80008a:	50                   	push   %eax
+  80008b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80008e:	c1 e0 02             	shl    $0x2,%eax
+  800091:	50                   	push   %eax
+  800092:	68 e4 2d 80 00       	push   $0x802de4
+  800097:	e8 6f 21 00 00       	call   80220b <printf>
+	       mi.mi_total * (PGSIZE / 1024), mi.mi_free * (PGSIZE / 1024),
+	       mi.mi_zeroed * (PGSIZE / 1024), mi.mi_used * (PGSIZE / 1024));
+	printf("merging identical pages saves %uK\n",
+  80009c:	83 c4 18             	add    $0x18,%esp
+  80009f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000a2:	c1 e0 02             	shl    $0x2,%eax
+  8000a5:	50                   	push   %eax
+  8000a6:	68 18 2e 80 00       	push   $0x802e18
+  8000ab:	e8 5b 21 00 00       	call   80220b <printf>
+	       mi.mi_merged * (PGSIZE / 1024));
+	printf("%8s %9s %9s %9s\n", "envid", "resident", "shared", "ptables");
+  8000b0:	c7 04 24 9d 2d 80 00 	movl   $0x802d9d,(%esp)
+  8000b7:	68 a5 2d 80 00       	push   $0x802da5
+  8000bc:	68 ac 2d 80 00       	push   $0x802dac
+  8000c1:	68 b5 2d 80 00       	push   $0x802db5
+  8000c6:	68 bb 2d 80 00       	push   $0x802dbb
+  8000cb:	e8 3b 21 00 00       	call   80220b <printf>
+	for (i = 0; i < n; i++)
+  8000d0:	bb 00 50 80 00       	mov    $0x805000,%ebx
+  8000d5:	83 c4 20             	add    $0x20,%esp
+  8000d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8000dd:	eb 62                	jmp    800141 <umain+0x10e>
+		printf("usage: meminfo\n");
+  8000df:	83 ec 0c             	sub    $0xc,%esp
+  8000e2:	68 80 2d 80 00       	push   $0x802d80
+  8000e7:	e8 1f 21 00 00       	call   80220b <printf>
+		exit();
+  8000ec:	e8 06 01 00 00       	call   8001f7 <exit>
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	e9 4d ff ff ff       	jmp    800046 <umain+0x13>
+		printf("meminfo: %e\n", n);
+  8000f9:	83 ec 08             	sub    $0x8,%esp
+  8000fc:	50                   	push   %eax
+  8000fd:	68 90 2d 80 00       	push   $0x802d90
+  800102:	e8 04 21 00 00       	call   80220b <printf>
+		exit();
+  800107:	e8 eb 00 00 00       	call   8001f7 <exit>
+  80010c:	83 c4 10             	add    $0x10,%esp
+  80010f:	e9 55 ff ff ff       	jmp    800069 <umain+0x36>
+		printf("%08x %8uK %8uK %8uK\n", envinfo[i].em_envid,
+  800114:	83 ec 0c             	sub    $0xc,%esp
+  800117:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80011a:	c1 e0 02             	shl    $0x2,%eax
+  80011d:	50                   	push   %eax
+  80011e:	8b 43 08             	mov    0x8(%ebx),%eax
+  800121:	c1 e0 02             	shl    $0x2,%eax
+  800124:	50                   	push   %eax
+  800125:	8b 43 04             	mov    0x4(%ebx),%eax
+  800128:	c1 e0 02             	shl    $0x2,%eax
+  80012b:	50                   	push   %eax
+  80012c:	ff 33                	push   (%ebx)
+  80012e:	68 cc 2d 80 00       	push   $0x802dcc
+  800133:	e8 d3 20 00 00       	call   80220b <printf>
+	for (i = 0; i < n; i++)
+  800138:	83 c6 01             	add    $0x1,%esi
+  80013b:	83 c3 10             	add    $0x10,%ebx
+  80013e:	83 c4 20             	add    $0x20,%esp
+  800141:	39 fe                	cmp    %edi,%esi
+  800143:	7c cf                	jl     800114 <umain+0xe1>
+		       envinfo[i].em_resident * (PGSIZE / 1024),
+		       envinfo[i].em_shared * (PGSIZE / 1024),
+		       envinfo[i].em_ptables * (PGSIZE / 1024));
+}
+  800145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800148:	5b                   	pop    %ebx
+  800149:	5e                   	pop    %esi
+  80014a:	5f                   	pop    %edi
+  80014b:	5d                   	pop    %ebp
+  80014c:	c3                   	ret
+
+0080014d <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80014d:	55                   	push   %ebp
+  80014e:	89 e5                	mov    %esp,%ebp
+  800150:	57                   	push   %edi
+  800151:	56                   	push   %esi
+  800152:	53                   	push   %ebx
+  800153:	83 ec 0c             	sub    $0xc,%esp
+  800156:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800159:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80015c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800161:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800163:	c1 ea 0b             	shr    $0xb,%edx
+  800166:	83 f2 01             	xor    $0x1,%edx
+  800169:	83 e2 01             	and    $0x1,%edx
+  80016c:	88 15 0c 90 80 00    	mov    %dl,0x80900c
+
+	mainenv = NULL;
+  800172:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  800179:	00 00 00 
+	envid = sys_getenvid();
+  80017c:	e8 1f 0c 00 00       	call   800da0 <sys_getenvid>
+  800181:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800183:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800188:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80018e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800194:	8b 52 48             	mov    0x48(%edx),%edx
+  800197:	39 ca                	cmp    %ecx,%edx
+  800199:	74 27                	je     8001c2 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80019b:	83 c0 01             	add    $0x1,%eax
+  80019e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001a3:	75 e3                	jne    800188 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8001a5:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  8001ac:	75 24                	jne    8001d2 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8001ae:	83 ec 04             	sub    $0x4,%esp
+  8001b1:	68 3c 2e 80 00       	push   $0x802e3c
+  8001b6:	6a 23                	push   $0x23
+  8001b8:	68 5f 2e 80 00       	push   $0x802e5f
+  8001bd:	e8 4f 00 00 00       	call   800211 <_panic>
+			mainenv = &envs[i];
+  8001c2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001cd:	a3 08 90 80 00       	mov    %eax,0x809008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001d2:	85 ff                	test   %edi,%edi
+  8001d4:	7e 07                	jle    8001dd <libmain+0x90>
+		binaryname = argv[0];
+  8001d6:	8b 06                	mov    (%esi),%eax
+  8001d8:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+  8001e0:	56                   	push   %esi
+  8001e1:	57                   	push   %edi
+  8001e2:	e8 4c fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001e7:	e8 0b 00 00 00       	call   8001f7 <exit>
+}
+  8001ec:	83 c4 10             	add    $0x10,%esp
+  8001ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f2:	5b                   	pop    %ebx
+  8001f3:	5e                   	pop    %esi
+  8001f4:	5f                   	pop    %edi
+  8001f5:	5d                   	pop    %ebp
+  8001f6:	c3                   	ret
+
+008001f7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001f7:	55                   	push   %ebp
+  8001f8:	89 e5                	mov    %esp,%ebp
+  8001fa:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001fd:	e8 94 18 00 00       	call   801a96 <close_all>
+	sys_env_destroy(0);
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	6a 00                	push   $0x0
+  800207:	e8 2b 0b 00 00       	call   800d37 <sys_env_destroy>
+}
+  80020c:	83 c4 10             	add    $0x10,%esp
+  80020f:	c9                   	leave
+  800210:	c3                   	ret
+
+00800211 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800211:	55                   	push   %ebp
+  800212:	89 e5                	mov    %esp,%ebp
+  800214:	56                   	push   %esi
+  800215:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800216:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800219:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80021f:	e8 7c 0b 00 00       	call   800da0 <sys_getenvid>
+  800224:	83 ec 0c             	sub    $0xc,%esp
+  800227:	ff 75 0c             	push   0xc(%ebp)
+  80022a:	ff 75 08             	push   0x8(%ebp)
+  80022d:	56                   	push   %esi
+  80022e:	50                   	push   %eax
+  80022f:	68 78 2e 80 00       	push   $0x802e78
+  800234:	e8 b3 00 00 00       	call   8002ec <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800239:	83 c4 18             	add    $0x18,%esp
+  80023c:	53                   	push   %ebx
+  80023d:	ff 75 10             	push   0x10(%ebp)
+  800240:	e8 56 00 00 00       	call   80029b <vcprintf>
+	cprintf("\n");
+  800245:	c7 04 24 df 2d 80 00 	movl   $0x802ddf,(%esp)
+  80024c:	e8 9b 00 00 00       	call   8002ec <cprintf>
+  800251:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800254:	cc                   	int3
+	while (1)
+  800255:	eb fd                	jmp    800254 <_panic+0x43>
+
+00800257 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800257:	55                   	push   %ebp
+  800258:	89 e5                	mov    %esp,%ebp
+  80025a:	53                   	push   %ebx
+  80025b:	83 ec 04             	sub    $0x4,%esp
+  80025e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800261:	8b 13                	mov    (%ebx),%edx
+  800263:	8d 42 01             	lea    0x1(%edx),%eax
+  800266:	89 03                	mov    %eax,(%ebx)
+  800268:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80026b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80026f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800274:	74 09                	je     80027f <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800276:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80027a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80027d:	c9                   	leave
+  80027e:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80027f:	83 ec 08             	sub    $0x8,%esp
+  800282:	68 ff 00 00 00       	push   $0xff
+  800287:	8d 43 08             	lea    0x8(%ebx),%eax
+  80028a:	50                   	push   %eax
+  80028b:	e8 1d 0a 00 00       	call   800cad <sys_cputs>
+		b->idx = 0;
+  800290:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800296:	83 c4 10             	add    $0x10,%esp
+  800299:	eb db                	jmp    800276 <putch+0x1f>
+
+0080029b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80029b:	55                   	push   %ebp
+  80029c:	89 e5                	mov    %esp,%ebp
+  80029e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002a4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002ab:	00 00 00 
+	b.cnt = 0;
+  8002ae:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002b5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002b8:	ff 75 0c             	push   0xc(%ebp)
+  8002bb:	ff 75 08             	push   0x8(%ebp)
+  8002be:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002c4:	50                   	push   %eax
+  8002c5:	68 57 02 80 00       	push   $0x800257
+  8002ca:	e8 fb 00 00 00       	call   8003ca <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002cf:	83 c4 08             	add    $0x8,%esp
+  8002d2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002d8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	e8 c9 09 00 00       	call   800cad <sys_cputs>
+
+	return b.cnt;
+}
+  8002e4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002ea:	c9                   	leave
+  8002eb:	c3                   	ret
+
+008002ec <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002ec:	55                   	push   %ebp
+  8002ed:	89 e5                	mov    %esp,%ebp
+  8002ef:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002f2:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002f5:	50                   	push   %eax
+  8002f6:	ff 75 08             	push   0x8(%ebp)
+  8002f9:	e8 9d ff ff ff       	call   80029b <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002fe:	c9                   	leave
+  8002ff:	c3                   	ret
+
+00800300 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	57                   	push   %edi
+  800304:	56                   	push   %esi
+  800305:	53                   	push   %ebx
+  800306:	83 ec 1c             	sub    $0x1c,%esp
+  800309:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80030c:	89 d6                	mov    %edx,%esi
+  80030e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800311:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800314:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800317:	73 0b                	jae    800324 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800319:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80031c:	c1 e7 08             	shl    $0x8,%edi
+  80031f:	0b 7d 10             	or     0x10(%ebp),%edi
+  800322:	eb 36                	jmp    80035a <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800324:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800327:	ba 00 00 00 00       	mov    $0x0,%edx
+  80032c:	f7 75 08             	divl   0x8(%ebp)
+  80032f:	89 c1                	mov    %eax,%ecx
+  800331:	ff 75 14             	push   0x14(%ebp)
+  800334:	ff 75 10             	push   0x10(%ebp)
+  800337:	83 eb 01             	sub    $0x1,%ebx
+  80033a:	53                   	push   %ebx
+  80033b:	ff 75 08             	push   0x8(%ebp)
+  80033e:	89 f2                	mov    %esi,%edx
+  800340:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800343:	e8 b8 ff ff ff       	call   800300 <printnum>
+  800348:	83 c4 10             	add    $0x10,%esp
+  80034b:	eb 14                	jmp    800361 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80034d:	83 ec 08             	sub    $0x8,%esp
+  800350:	56                   	push   %esi
+  800351:	57                   	push   %edi
+  800352:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800355:	ff d0                	call   *%eax
+  800357:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80035a:	83 eb 01             	sub    $0x1,%ebx
+  80035d:	85 db                	test   %ebx,%ebx
+  80035f:	7f ec                	jg     80034d <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800361:	83 ec 08             	sub    $0x8,%esp
+  800364:	56                   	push   %esi
+  800365:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036d:	f7 75 08             	divl   0x8(%ebp)
+  800370:	0f be 92 9b 2e 80 00 	movsbl 0x802e9b(%edx),%edx
+  800377:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037a:	c1 e0 08             	shl    $0x8,%eax
+  80037d:	09 d0                	or     %edx,%eax
+  80037f:	50                   	push   %eax
+  800380:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800383:	ff d0                	call   *%eax
+}
+  800385:	83 c4 10             	add    $0x10,%esp
+  800388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038b:	5b                   	pop    %ebx
+  80038c:	5e                   	pop    %esi
+  80038d:	5f                   	pop    %edi
+  80038e:	5d                   	pop    %ebp
+  80038f:	c3                   	ret
+
+00800390 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800396:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80039a:	8b 10                	mov    (%eax),%edx
+  80039c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80039f:	73 0a                	jae    8003ab <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003a1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a4:	89 08                	mov    %ecx,(%eax)
+  8003a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a9:	88 02                	mov    %al,(%edx)
+}
+  8003ab:	5d                   	pop    %ebp
+  8003ac:	c3                   	ret
+
+008003ad <printfmt>:
+{
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b6:	50                   	push   %eax
+  8003b7:	ff 75 10             	push   0x10(%ebp)
+  8003ba:	ff 75 0c             	push   0xc(%ebp)
+  8003bd:	ff 75 08             	push   0x8(%ebp)
+  8003c0:	e8 05 00 00 00       	call   8003ca <vprintfmt>
+}
+  8003c5:	83 c4 10             	add    $0x10,%esp
+  8003c8:	c9                   	leave
+  8003c9:	c3                   	ret
+
+008003ca <vprintfmt>:
+{
+  8003ca:	55                   	push   %ebp
+  8003cb:	89 e5                	mov    %esp,%ebp
+  8003cd:	57                   	push   %edi
+  8003ce:	56                   	push   %esi
+  8003cf:	53                   	push   %ebx
+  8003d0:	83 ec 3c             	sub    $0x3c,%esp
+  8003d3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8003d6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8003d9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003e0:	eb 16                	jmp    8003f8 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8003e2:	83 ec 08             	sub    $0x8,%esp
+  8003e5:	ff 75 0c             	push   0xc(%ebp)
+  8003e8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003eb:	c1 e2 08             	shl    $0x8,%edx
+  8003ee:	09 d0                	or     %edx,%eax
+  8003f0:	50                   	push   %eax
+  8003f1:	ff d7                	call   *%edi
+  8003f3:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003f6:	89 de                	mov    %ebx,%esi
+  8003f8:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003fb:	0f b6 06             	movzbl (%esi),%eax
+  8003fe:	83 f8 25             	cmp    $0x25,%eax
+  800401:	74 0c                	je     80040f <vprintfmt+0x45>
+			if (ch == '\0')
+  800403:	85 c0                	test   %eax,%eax
+  800405:	75 db                	jne    8003e2 <vprintfmt+0x18>
+}
+  800407:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040a:	5b                   	pop    %ebx
+  80040b:	5e                   	pop    %esi
+  80040c:	5f                   	pop    %edi
+  80040d:	5d                   	pop    %ebp
+  80040e:	c3                   	ret
+		padc = ' ';
+  80040f:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800413:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80041a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800421:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800428:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042d:	8d 73 01             	lea    0x1(%ebx),%esi
+  800430:	0f b6 13             	movzbl (%ebx),%edx
+  800433:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800436:	3c 55                	cmp    $0x55,%al
+  800438:	0f 87 2c 04 00 00    	ja     80086a <vprintfmt+0x4a0>
+  80043e:	0f b6 c0             	movzbl %al,%eax
+  800441:	ff 24 85 e0 2f 80 00 	jmp    *0x802fe0(,%eax,4)
+  800448:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80044a:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80044e:	eb dd                	jmp    80042d <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800450:	89 f3                	mov    %esi,%ebx
+  800452:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800456:	eb d5                	jmp    80042d <vprintfmt+0x63>
+  800458:	0f b6 d2             	movzbl %dl,%edx
+  80045b:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800462:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800465:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800469:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80046c:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80046f:	83 fe 09             	cmp    $0x9,%esi
+  800472:	0f 87 8a 00 00 00    	ja     800502 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800478:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80047b:	eb e5                	jmp    800462 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80047d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800480:	8b 00                	mov    (%eax),%eax
+  800482:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800485:	8b 45 14             	mov    0x14(%ebp),%eax
+  800488:	8d 40 04             	lea    0x4(%eax),%eax
+  80048b:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80048e:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800490:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800494:	79 97                	jns    80042d <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800496:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800499:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80049c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004a3:	eb 88                	jmp    80042d <vprintfmt+0x63>
+			if (width < 0)
+  8004a5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8004a8:	85 db                	test   %ebx,%ebx
+  8004aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004af:	0f 49 c3             	cmovns %ebx,%eax
+  8004b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b5:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004b7:	e9 71 ff ff ff       	jmp    80042d <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bc:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8004be:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004c5:	e9 63 ff ff ff       	jmp    80042d <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8004ca:	8d 73 02             	lea    0x2(%ebx),%esi
+  8004cd:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8004d1:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8004d8:	3c 67                	cmp    $0x67,%al
+  8004da:	0f 84 18 ff ff ff    	je     8003f8 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8004e0:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8004e7:	3c 72                	cmp    $0x72,%al
+  8004e9:	0f 84 09 ff ff ff    	je     8003f8 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004ef:	3c 62                	cmp    $0x62,%al
+  8004f1:	0f 94 c0             	sete   %al
+  8004f4:	0f b6 c0             	movzbl %al,%eax
+  8004f7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004fd:	e9 f6 fe ff ff       	jmp    8003f8 <vprintfmt+0x2e>
+  800502:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800505:	eb 89                	jmp    800490 <vprintfmt+0xc6>
+			lflag++;
+  800507:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80050a:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80050c:	e9 1c ff ff ff       	jmp    80042d <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800511:	8b 45 14             	mov    0x14(%ebp),%eax
+  800514:	8d 58 04             	lea    0x4(%eax),%ebx
+  800517:	83 ec 08             	sub    $0x8,%esp
+  80051a:	ff 75 0c             	push   0xc(%ebp)
+  80051d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800520:	c1 e0 08             	shl    $0x8,%eax
+  800523:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800526:	0b 01                	or     (%ecx),%eax
+  800528:	50                   	push   %eax
+  800529:	ff d7                	call   *%edi
+			break;
+  80052b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80052e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800531:	e9 c2 fe ff ff       	jmp    8003f8 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800536:	8b 45 14             	mov    0x14(%ebp),%eax
+  800539:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80053c:	8b 10                	mov    (%eax),%edx
+  80053e:	89 d0                	mov    %edx,%eax
+  800540:	f7 d8                	neg    %eax
+  800542:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800545:	83 f8 12             	cmp    $0x12,%eax
+  800548:	7f 25                	jg     80056f <vprintfmt+0x1a5>
+  80054a:	8b 14 85 40 31 80 00 	mov    0x803140(,%eax,4),%edx
+  800551:	85 d2                	test   %edx,%edx
+  800553:	74 1a                	je     80056f <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800555:	52                   	push   %edx
+  800556:	68 81 32 80 00       	push   $0x803281
+  80055b:	ff 75 0c             	push   0xc(%ebp)
+  80055e:	57                   	push   %edi
+  80055f:	e8 49 fe ff ff       	call   8003ad <printfmt>
+  800564:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800567:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80056a:	e9 89 fe ff ff       	jmp    8003f8 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80056f:	50                   	push   %eax
+  800570:	68 b3 2e 80 00       	push   $0x802eb3
+  800575:	ff 75 0c             	push   0xc(%ebp)
+  800578:	57                   	push   %edi
+  800579:	e8 2f fe ff ff       	call   8003ad <printfmt>
+  80057e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800581:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800584:	e9 6f fe ff ff       	jmp    8003f8 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058c:	83 c0 04             	add    $0x4,%eax
+  80058f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800597:	85 c9                	test   %ecx,%ecx
+  800599:	b8 ac 2e 80 00       	mov    $0x802eac,%eax
+  80059e:	0f 45 c1             	cmovne %ecx,%eax
+  8005a1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8005a4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005a8:	7e 06                	jle    8005b0 <vprintfmt+0x1e6>
+  8005aa:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8005ae:	75 1a                	jne    8005ca <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8005b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005b3:	c1 e0 08             	shl    $0x8,%eax
+  8005b6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8005b9:	83 c8 3f             	or     $0x3f,%eax
+  8005bc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005bf:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8005c2:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005c5:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8005c8:	eb 6d                	jmp    800637 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ca:	83 ec 08             	sub    $0x8,%esp
+  8005cd:	ff 75 d0             	push   -0x30(%ebp)
+  8005d0:	ff 75 c8             	push   -0x38(%ebp)
+  8005d3:	e8 39 03 00 00       	call   800911 <strnlen>
+  8005d8:	89 c2                	mov    %eax,%edx
+  8005da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005dd:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8005df:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005e2:	c1 e1 08             	shl    $0x8,%ecx
+  8005e5:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8005e9:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	89 c3                	mov    %eax,%ebx
+  8005f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005f6:	89 ce                	mov    %ecx,%esi
+  8005f8:	eb 0f                	jmp    800609 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005fa:	83 ec 08             	sub    $0x8,%esp
+  8005fd:	ff 75 0c             	push   0xc(%ebp)
+  800600:	56                   	push   %esi
+  800601:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800603:	83 eb 01             	sub    $0x1,%ebx
+  800606:	83 c4 10             	add    $0x10,%esp
+  800609:	85 db                	test   %ebx,%ebx
+  80060b:	7f ed                	jg     8005fa <vprintfmt+0x230>
+  80060d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800610:	8b 75 10             	mov    0x10(%ebp),%esi
+  800613:	85 c0                	test   %eax,%eax
+  800615:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061a:	0f 49 d0             	cmovns %eax,%edx
+  80061d:	29 d0                	sub    %edx,%eax
+  80061f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800622:	eb 8c                	jmp    8005b0 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800624:	83 ec 08             	sub    $0x8,%esp
+  800627:	ff 75 0c             	push   0xc(%ebp)
+  80062a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80062d:	09 c2                	or     %eax,%edx
+  80062f:	52                   	push   %edx
+  800630:	ff d7                	call   *%edi
+  800632:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800635:	89 d9                	mov    %ebx,%ecx
+  800637:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80063a:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80063e:	0f be d0             	movsbl %al,%edx
+  800641:	85 d2                	test   %edx,%edx
+  800643:	74 2a                	je     80066f <vprintfmt+0x2a5>
+  800645:	85 f6                	test   %esi,%esi
+  800647:	78 05                	js     80064e <vprintfmt+0x284>
+  800649:	83 ee 01             	sub    $0x1,%esi
+  80064c:	78 3b                	js     800689 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80064e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800652:	74 d0                	je     800624 <vprintfmt+0x25a>
+  800654:	0f be c0             	movsbl %al,%eax
+  800657:	83 e8 20             	sub    $0x20,%eax
+  80065a:	83 f8 5e             	cmp    $0x5e,%eax
+  80065d:	76 c5                	jbe    800624 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80065f:	83 ec 08             	sub    $0x8,%esp
+  800662:	ff 75 0c             	push   0xc(%ebp)
+  800665:	ff 75 cc             	push   -0x34(%ebp)
+  800668:	ff d7                	call   *%edi
+  80066a:	83 c4 10             	add    $0x10,%esp
+  80066d:	eb c6                	jmp    800635 <vprintfmt+0x26b>
+  80066f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800672:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800675:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800678:	01 c3                	add    %eax,%ebx
+  80067a:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80067c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80067f:	83 c8 20             	or     $0x20,%eax
+  800682:	89 75 10             	mov    %esi,0x10(%ebp)
+  800685:	89 c6                	mov    %eax,%esi
+  800687:	eb 14                	jmp    80069d <vprintfmt+0x2d3>
+  800689:	8b 75 10             	mov    0x10(%ebp),%esi
+  80068c:	eb e4                	jmp    800672 <vprintfmt+0x2a8>
+  80068e:	83 ec 08             	sub    $0x8,%esp
+  800691:	ff 75 0c             	push   0xc(%ebp)
+  800694:	56                   	push   %esi
+  800695:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800697:	83 eb 01             	sub    $0x1,%ebx
+  80069a:	83 c4 10             	add    $0x10,%esp
+  80069d:	85 db                	test   %ebx,%ebx
+  80069f:	7f ed                	jg     80068e <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006a1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006a4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8006a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006aa:	e9 49 fd ff ff       	jmp    8003f8 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006af:	83 f9 01             	cmp    $0x1,%ecx
+  8006b2:	7f 1f                	jg     8006d3 <vprintfmt+0x309>
+	else if (lflag)
+  8006b4:	85 c9                	test   %ecx,%ecx
+  8006b6:	74 69                	je     800721 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 00                	mov    (%eax),%eax
+  8006bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c0:	89 c1                	mov    %eax,%ecx
+  8006c2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006c5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d1:	eb 17                	jmp    8006ea <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8006d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d6:	8b 50 04             	mov    0x4(%eax),%edx
+  8006d9:	8b 00                	mov    (%eax),%eax
+  8006db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006de:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ea:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006ed:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006f0:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006f5:	85 db                	test   %ebx,%ebx
+  8006f7:	0f 89 f6 00 00 00    	jns    8007f3 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006fd:	83 ec 08             	sub    $0x8,%esp
+  800700:	ff 75 0c             	push   0xc(%ebp)
+  800703:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800706:	c1 e0 08             	shl    $0x8,%eax
+  800709:	83 c8 2d             	or     $0x2d,%eax
+  80070c:	50                   	push   %eax
+  80070d:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80070f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800712:	f7 d9                	neg    %ecx
+  800714:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800717:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80071c:	e9 d2 00 00 00       	jmp    8007f3 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 00                	mov    (%eax),%eax
+  800726:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800729:	89 c1                	mov    %eax,%ecx
+  80072b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80072e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8d 40 04             	lea    0x4(%eax),%eax
+  800737:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073a:	eb ae                	jmp    8006ea <vprintfmt+0x320>
+	if (lflag >= 2)
+  80073c:	83 f9 01             	cmp    $0x1,%ecx
+  80073f:	7f 19                	jg     80075a <vprintfmt+0x390>
+	else if (lflag)
+  800741:	85 c9                	test   %ecx,%ecx
+  800743:	74 2a                	je     80076f <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 08                	mov    (%eax),%ecx
+  80074a:	8d 40 04             	lea    0x4(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800750:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800755:	e9 99 00 00 00       	jmp    8007f3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80075a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075d:	8b 08                	mov    (%eax),%ecx
+  80075f:	8d 40 08             	lea    0x8(%eax),%eax
+  800762:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800765:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80076a:	e9 84 00 00 00       	jmp    8007f3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	8b 08                	mov    (%eax),%ecx
+  800774:	8d 40 04             	lea    0x4(%eax),%eax
+  800777:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80077a:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  80077f:	eb 72                	jmp    8007f3 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800781:	83 f9 01             	cmp    $0x1,%ecx
+  800784:	7f 16                	jg     80079c <vprintfmt+0x3d2>
+	else if (lflag)
+  800786:	85 c9                	test   %ecx,%ecx
+  800788:	74 24                	je     8007ae <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80078a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078d:	8b 08                	mov    (%eax),%ecx
+  80078f:	8d 40 04             	lea    0x4(%eax),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800795:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80079a:	eb 57                	jmp    8007f3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80079c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079f:	8b 08                	mov    (%eax),%ecx
+  8007a1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007a7:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8007ac:	eb 45                	jmp    8007f3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b1:	8b 08                	mov    (%eax),%ecx
+  8007b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007b9:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8007be:	eb 33                	jmp    8007f3 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8007c0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007c3:	c1 e3 08             	shl    $0x8,%ebx
+  8007c6:	83 ec 08             	sub    $0x8,%esp
+  8007c9:	ff 75 0c             	push   0xc(%ebp)
+  8007cc:	89 d8                	mov    %ebx,%eax
+  8007ce:	83 c8 30             	or     $0x30,%eax
+  8007d1:	50                   	push   %eax
+  8007d2:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8007d4:	83 c4 08             	add    $0x8,%esp
+  8007d7:	ff 75 0c             	push   0xc(%ebp)
+  8007da:	83 cb 78             	or     $0x78,%ebx
+  8007dd:	53                   	push   %ebx
+  8007de:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e3:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8007e5:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ee:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8007f6:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007fa:	52                   	push   %edx
+  8007fb:	ff 75 e0             	push   -0x20(%ebp)
+  8007fe:	50                   	push   %eax
+  8007ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800802:	89 f8                	mov    %edi,%eax
+  800804:	e8 f7 fa ff ff       	call   800300 <printnum>
+			break;
+  800809:	83 c4 10             	add    $0x10,%esp
+  80080c:	e9 e7 fb ff ff       	jmp    8003f8 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800811:	83 f9 01             	cmp    $0x1,%ecx
+  800814:	7f 16                	jg     80082c <vprintfmt+0x462>
+	else if (lflag)
+  800816:	85 c9                	test   %ecx,%ecx
+  800818:	74 24                	je     80083e <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80081a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081d:	8b 08                	mov    (%eax),%ecx
+  80081f:	8d 40 04             	lea    0x4(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800825:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80082a:	eb c7                	jmp    8007f3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80082c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082f:	8b 08                	mov    (%eax),%ecx
+  800831:	8d 40 08             	lea    0x8(%eax),%eax
+  800834:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800837:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80083c:	eb b5                	jmp    8007f3 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80083e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800841:	8b 08                	mov    (%eax),%ecx
+  800843:	8d 40 04             	lea    0x4(%eax),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800849:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80084e:	eb a3                	jmp    8007f3 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800850:	83 ec 08             	sub    $0x8,%esp
+  800853:	ff 75 0c             	push   0xc(%ebp)
+  800856:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800859:	c1 e0 08             	shl    $0x8,%eax
+  80085c:	83 c8 25             	or     $0x25,%eax
+  80085f:	50                   	push   %eax
+  800860:	ff d7                	call   *%edi
+			break;
+  800862:	83 c4 10             	add    $0x10,%esp
+  800865:	e9 8e fb ff ff       	jmp    8003f8 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80086a:	83 ec 08             	sub    $0x8,%esp
+  80086d:	ff 75 0c             	push   0xc(%ebp)
+  800870:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800873:	c1 e0 08             	shl    $0x8,%eax
+  800876:	83 c8 25             	or     $0x25,%eax
+  800879:	50                   	push   %eax
+  80087a:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80087c:	83 c4 10             	add    $0x10,%esp
+  80087f:	89 de                	mov    %ebx,%esi
+  800881:	eb 03                	jmp    800886 <vprintfmt+0x4bc>
+  800883:	83 ee 01             	sub    $0x1,%esi
+  800886:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80088a:	75 f7                	jne    800883 <vprintfmt+0x4b9>
+  80088c:	e9 67 fb ff ff       	jmp    8003f8 <vprintfmt+0x2e>
+
+00800891 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800891:	55                   	push   %ebp
+  800892:	89 e5                	mov    %esp,%ebp
+  800894:	83 ec 18             	sub    $0x18,%esp
+  800897:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80089d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008a0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008a4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008ae:	85 c0                	test   %eax,%eax
+  8008b0:	74 26                	je     8008d8 <vsnprintf+0x47>
+  8008b2:	85 d2                	test   %edx,%edx
+  8008b4:	7e 22                	jle    8008d8 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008b6:	ff 75 14             	push   0x14(%ebp)
+  8008b9:	ff 75 10             	push   0x10(%ebp)
+  8008bc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008bf:	50                   	push   %eax
+  8008c0:	68 90 03 80 00       	push   $0x800390
+  8008c5:	e8 00 fb ff ff       	call   8003ca <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008cd:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d3:	83 c4 10             	add    $0x10,%esp
+}
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+		return -E_INVAL;
+  8008d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008dd:	eb f7                	jmp    8008d6 <vsnprintf+0x45>
+
+008008df <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8008e5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008e8:	50                   	push   %eax
+  8008e9:	ff 75 10             	push   0x10(%ebp)
+  8008ec:	ff 75 0c             	push   0xc(%ebp)
+  8008ef:	ff 75 08             	push   0x8(%ebp)
+  8008f2:	e8 9a ff ff ff       	call   800891 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008f7:	c9                   	leave
+  8008f8:	c3                   	ret
+
+008008f9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800904:	eb 03                	jmp    800909 <strlen+0x10>
+		n++;
+  800906:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800909:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80090d:	75 f7                	jne    800906 <strlen+0xd>
+	return n;
+}
+  80090f:	5d                   	pop    %ebp
+  800910:	c3                   	ret
+
+00800911 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800911:	55                   	push   %ebp
+  800912:	89 e5                	mov    %esp,%ebp
+  800914:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800917:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80091a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091f:	eb 03                	jmp    800924 <strnlen+0x13>
+		n++;
+  800921:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800924:	39 d0                	cmp    %edx,%eax
+  800926:	74 08                	je     800930 <strnlen+0x1f>
+  800928:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80092c:	75 f3                	jne    800921 <strnlen+0x10>
+  80092e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800930:	89 d0                	mov    %edx,%eax
+  800932:	5d                   	pop    %ebp
+  800933:	c3                   	ret
+
+00800934 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	53                   	push   %ebx
+  800938:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800943:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800947:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80094a:	83 c0 01             	add    $0x1,%eax
+  80094d:	84 d2                	test   %dl,%dl
+  80094f:	75 f2                	jne    800943 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800951:	89 c8                	mov    %ecx,%eax
+  800953:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800956:	c9                   	leave
+  800957:	c3                   	ret
+
+00800958 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	53                   	push   %ebx
+  80095c:	83 ec 10             	sub    $0x10,%esp
+  80095f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800962:	53                   	push   %ebx
+  800963:	e8 91 ff ff ff       	call   8008f9 <strlen>
+  800968:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80096b:	ff 75 0c             	push   0xc(%ebp)
+  80096e:	01 d8                	add    %ebx,%eax
+  800970:	50                   	push   %eax
+  800971:	e8 be ff ff ff       	call   800934 <strcpy>
+	return dst;
+}
+  800976:	89 d8                	mov    %ebx,%eax
+  800978:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097b:	c9                   	leave
+  80097c:	c3                   	ret
+
+0080097d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80097d:	55                   	push   %ebp
+  80097e:	89 e5                	mov    %esp,%ebp
+  800980:	56                   	push   %esi
+  800981:	53                   	push   %ebx
+  800982:	8b 75 08             	mov    0x8(%ebp),%esi
+  800985:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800988:	89 f3                	mov    %esi,%ebx
+  80098a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80098d:	89 f0                	mov    %esi,%eax
+  80098f:	eb 0f                	jmp    8009a0 <strncpy+0x23>
+		*dst++ = *src;
+  800991:	83 c0 01             	add    $0x1,%eax
+  800994:	0f b6 0a             	movzbl (%edx),%ecx
+  800997:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80099a:	80 f9 01             	cmp    $0x1,%cl
+  80099d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009a0:	39 d8                	cmp    %ebx,%eax
+  8009a2:	75 ed                	jne    800991 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009a4:	89 f0                	mov    %esi,%eax
+  8009a6:	5b                   	pop    %ebx
+  8009a7:	5e                   	pop    %esi
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+
+008009aa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	56                   	push   %esi
+  8009ae:	53                   	push   %ebx
+  8009af:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009b5:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009b8:	89 f0                	mov    %esi,%eax
+  8009ba:	85 d2                	test   %edx,%edx
+  8009bc:	74 21                	je     8009df <strlcpy+0x35>
+  8009be:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009c2:	89 f2                	mov    %esi,%edx
+  8009c4:	eb 09                	jmp    8009cf <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009c6:	83 c1 01             	add    $0x1,%ecx
+  8009c9:	83 c2 01             	add    $0x1,%edx
+  8009cc:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009cf:	39 c2                	cmp    %eax,%edx
+  8009d1:	74 09                	je     8009dc <strlcpy+0x32>
+  8009d3:	0f b6 19             	movzbl (%ecx),%ebx
+  8009d6:	84 db                	test   %bl,%bl
+  8009d8:	75 ec                	jne    8009c6 <strlcpy+0x1c>
+  8009da:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009dc:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009df:	29 f0                	sub    %esi,%eax
+}
+  8009e1:	5b                   	pop    %ebx
+  8009e2:	5e                   	pop    %esi
+  8009e3:	5d                   	pop    %ebp
+  8009e4:	c3                   	ret
+
+008009e5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ee:	eb 06                	jmp    8009f6 <strcmp+0x11>
+		p++, q++;
+  8009f0:	83 c1 01             	add    $0x1,%ecx
+  8009f3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009f6:	0f b6 01             	movzbl (%ecx),%eax
+  8009f9:	84 c0                	test   %al,%al
+  8009fb:	74 04                	je     800a01 <strcmp+0x1c>
+  8009fd:	3a 02                	cmp    (%edx),%al
+  8009ff:	74 ef                	je     8009f0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a01:	0f b6 c0             	movzbl %al,%eax
+  800a04:	0f b6 12             	movzbl (%edx),%edx
+  800a07:	29 d0                	sub    %edx,%eax
+}
+  800a09:	5d                   	pop    %ebp
+  800a0a:	c3                   	ret
+
+00800a0b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	53                   	push   %ebx
+  800a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a15:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a18:	eb 09                	jmp    800a23 <strncmp+0x18>
+		n--, p++, q++;
+  800a1a:	83 ea 01             	sub    $0x1,%edx
+  800a1d:	83 c0 01             	add    $0x1,%eax
+  800a20:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a23:	85 d2                	test   %edx,%edx
+  800a25:	74 18                	je     800a3f <strncmp+0x34>
+  800a27:	0f b6 18             	movzbl (%eax),%ebx
+  800a2a:	84 db                	test   %bl,%bl
+  800a2c:	74 04                	je     800a32 <strncmp+0x27>
+  800a2e:	3a 19                	cmp    (%ecx),%bl
+  800a30:	74 e8                	je     800a1a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a32:	0f b6 00             	movzbl (%eax),%eax
+  800a35:	0f b6 11             	movzbl (%ecx),%edx
+  800a38:	29 d0                	sub    %edx,%eax
+}
+  800a3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3d:	c9                   	leave
+  800a3e:	c3                   	ret
+		return 0;
+  800a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a44:	eb f4                	jmp    800a3a <strncmp+0x2f>
+
+00800a46 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a50:	eb 03                	jmp    800a55 <strchr+0xf>
+  800a52:	83 c0 01             	add    $0x1,%eax
+  800a55:	0f b6 10             	movzbl (%eax),%edx
+  800a58:	84 d2                	test   %dl,%dl
+  800a5a:	74 06                	je     800a62 <strchr+0x1c>
+		if (*s == c)
+  800a5c:	38 ca                	cmp    %cl,%dl
+  800a5e:	75 f2                	jne    800a52 <strchr+0xc>
+  800a60:	eb 05                	jmp    800a67 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a67:	5d                   	pop    %ebp
+  800a68:	c3                   	ret
+
+00800a69 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a73:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a76:	38 ca                	cmp    %cl,%dl
+  800a78:	74 09                	je     800a83 <strfind+0x1a>
+  800a7a:	84 d2                	test   %dl,%dl
+  800a7c:	74 05                	je     800a83 <strfind+0x1a>
+	for (; *s; s++)
+  800a7e:	83 c0 01             	add    $0x1,%eax
+  800a81:	eb f0                	jmp    800a73 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a83:	5d                   	pop    %ebp
+  800a84:	c3                   	ret
+
+00800a85 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	57                   	push   %edi
+  800a89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a8c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a8f:	85 c9                	test   %ecx,%ecx
+  800a91:	74 20                	je     800ab3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a93:	89 f8                	mov    %edi,%eax
+  800a95:	09 c8                	or     %ecx,%eax
+  800a97:	a8 03                	test   $0x3,%al
+  800a99:	75 12                	jne    800aad <memset+0x28>
+		c &= 0xFF;
+  800a9b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a9f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800aa5:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800aa8:	fc                   	cld
+  800aa9:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aab:	eb 06                	jmp    800ab3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800aad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab0:	fc                   	cld
+  800ab1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ab3:	89 f8                	mov    %edi,%eax
+  800ab5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ab8:	c9                   	leave
+  800ab9:	c3                   	ret
+
+00800aba <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	57                   	push   %edi
+  800abe:	56                   	push   %esi
+  800abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ac5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ac8:	39 c6                	cmp    %eax,%esi
+  800aca:	73 32                	jae    800afe <memmove+0x44>
+  800acc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800acf:	39 d0                	cmp    %edx,%eax
+  800ad1:	73 2b                	jae    800afe <memmove+0x44>
+		s += n;
+		d += n;
+  800ad3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ad6:	89 d6                	mov    %edx,%esi
+  800ad8:	09 fe                	or     %edi,%esi
+  800ada:	09 ce                	or     %ecx,%esi
+  800adc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ae2:	75 0e                	jne    800af2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ae4:	83 ef 04             	sub    $0x4,%edi
+  800ae7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aea:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aed:	fd                   	std
+  800aee:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af0:	eb 09                	jmp    800afb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800af2:	83 ef 01             	sub    $0x1,%edi
+  800af5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800af8:	fd                   	std
+  800af9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800afb:	fc                   	cld
+  800afc:	eb 1a                	jmp    800b18 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800afe:	89 f2                	mov    %esi,%edx
+  800b00:	09 c2                	or     %eax,%edx
+  800b02:	09 ca                	or     %ecx,%edx
+  800b04:	f6 c2 03             	test   $0x3,%dl
+  800b07:	75 0a                	jne    800b13 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b09:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b0c:	89 c7                	mov    %eax,%edi
+  800b0e:	fc                   	cld
+  800b0f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b11:	eb 05                	jmp    800b18 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b13:	89 c7                	mov    %eax,%edi
+  800b15:	fc                   	cld
+  800b16:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b18:	5e                   	pop    %esi
+  800b19:	5f                   	pop    %edi
+  800b1a:	5d                   	pop    %ebp
+  800b1b:	c3                   	ret
+
+00800b1c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b22:	ff 75 10             	push   0x10(%ebp)
+  800b25:	ff 75 0c             	push   0xc(%ebp)
+  800b28:	ff 75 08             	push   0x8(%ebp)
+  800b2b:	e8 8a ff ff ff       	call   800aba <memmove>
+}
+  800b30:	c9                   	leave
+  800b31:	c3                   	ret
+
+00800b32 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  800b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b3d:	89 c6                	mov    %eax,%esi
+  800b3f:	03 75 10             	add    0x10(%ebp),%esi
+  800b42:	eb 06                	jmp    800b4a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b44:	83 c0 01             	add    $0x1,%eax
+  800b47:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b4a:	39 f0                	cmp    %esi,%eax
+  800b4c:	74 14                	je     800b62 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b4e:	0f b6 08             	movzbl (%eax),%ecx
+  800b51:	0f b6 1a             	movzbl (%edx),%ebx
+  800b54:	38 d9                	cmp    %bl,%cl
+  800b56:	74 ec                	je     800b44 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b58:	0f b6 c1             	movzbl %cl,%eax
+  800b5b:	0f b6 db             	movzbl %bl,%ebx
+  800b5e:	29 d8                	sub    %ebx,%eax
+  800b60:	eb 05                	jmp    800b67 <memcmp+0x35>
+	}
+
+	return 0;
+  800b62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b67:	5b                   	pop    %ebx
+  800b68:	5e                   	pop    %esi
+  800b69:	5d                   	pop    %ebp
+  800b6a:	c3                   	ret
+
+00800b6b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b6b:	55                   	push   %ebp
+  800b6c:	89 e5                	mov    %esp,%ebp
+  800b6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b74:	89 c2                	mov    %eax,%edx
+  800b76:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b79:	eb 03                	jmp    800b7e <memfind+0x13>
+  800b7b:	83 c0 01             	add    $0x1,%eax
+  800b7e:	39 d0                	cmp    %edx,%eax
+  800b80:	73 04                	jae    800b86 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b82:	38 08                	cmp    %cl,(%eax)
+  800b84:	75 f5                	jne    800b7b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+
+00800b88 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	57                   	push   %edi
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+  800b8e:	83 ec 1c             	sub    $0x1c,%esp
+  800b91:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b94:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b97:	eb 03                	jmp    800b9c <strtol+0x14>
+		s++;
+  800b99:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b9c:	0f b6 06             	movzbl (%esi),%eax
+  800b9f:	3c 20                	cmp    $0x20,%al
+  800ba1:	74 f6                	je     800b99 <strtol+0x11>
+  800ba3:	3c 09                	cmp    $0x9,%al
+  800ba5:	74 f2                	je     800b99 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ba7:	3c 2b                	cmp    $0x2b,%al
+  800ba9:	74 43                	je     800bee <strtol+0x66>
+	int neg = 0;
+  800bab:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800bb0:	3c 2d                	cmp    $0x2d,%al
+  800bb2:	74 44                	je     800bf8 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb4:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800bba:	75 0f                	jne    800bcb <strtol+0x43>
+  800bbc:	80 3e 30             	cmpb   $0x30,(%esi)
+  800bbf:	74 41                	je     800c02 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bc1:	85 ff                	test   %edi,%edi
+  800bc3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bc8:	0f 44 f8             	cmove  %eax,%edi
+  800bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800bd5:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800bd8:	89 fb                	mov    %edi,%ebx
+  800bda:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bdd:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800be0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800be3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800be6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800be9:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bec:	eb 67                	jmp    800c55 <strtol+0xcd>
+		s++;
+  800bee:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800bf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf6:	eb bc                	jmp    800bb4 <strtol+0x2c>
+		s++, neg = 1;
+  800bf8:	83 c6 01             	add    $0x1,%esi
+  800bfb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c00:	eb b2                	jmp    800bb4 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c02:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c06:	74 0e                	je     800c16 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c08:	85 ff                	test   %edi,%edi
+  800c0a:	75 bf                	jne    800bcb <strtol+0x43>
+		s++, base = 8;
+  800c0c:	83 c6 01             	add    $0x1,%esi
+  800c0f:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c14:	eb b5                	jmp    800bcb <strtol+0x43>
+		s += 2, base = 16;
+  800c16:	83 c6 02             	add    $0x2,%esi
+  800c19:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c1e:	eb ab                	jmp    800bcb <strtol+0x43>
+			dig = *s - '0';
+  800c20:	0f be c9             	movsbl %cl,%ecx
+  800c23:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c26:	39 f9                	cmp    %edi,%ecx
+  800c28:	7d 59                	jge    800c83 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c2a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c2e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c31:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c34:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c37:	0f af d8             	imul   %eax,%ebx
+  800c3a:	0f af d7             	imul   %edi,%edx
+  800c3d:	01 d3                	add    %edx,%ebx
+  800c3f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c42:	f7 e7                	mul    %edi
+  800c44:	01 da                	add    %ebx,%edx
+  800c46:	89 cb                	mov    %ecx,%ebx
+  800c48:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c4b:	01 c8                	add    %ecx,%eax
+  800c4d:	11 da                	adc    %ebx,%edx
+  800c4f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c52:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c58:	0f b6 08             	movzbl (%eax),%ecx
+  800c5b:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c5e:	80 fb 09             	cmp    $0x9,%bl
+  800c61:	76 bd                	jbe    800c20 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c63:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c66:	80 fb 19             	cmp    $0x19,%bl
+  800c69:	77 08                	ja     800c73 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c6b:	0f be c9             	movsbl %cl,%ecx
+  800c6e:	83 e9 57             	sub    $0x57,%ecx
+  800c71:	eb b3                	jmp    800c26 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c73:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c76:	80 fb 19             	cmp    $0x19,%bl
+  800c79:	77 08                	ja     800c83 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c7b:	0f be c9             	movsbl %cl,%ecx
+  800c7e:	83 e9 37             	sub    $0x37,%ecx
+  800c81:	eb a3                	jmp    800c26 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c83:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c86:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c89:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c8f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c93:	74 05                	je     800c9a <strtol+0x112>
+		*endptr = (char *) s;
+  800c95:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c98:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c9a:	85 c9                	test   %ecx,%ecx
+  800c9c:	74 07                	je     800ca5 <strtol+0x11d>
+  800c9e:	f7 d8                	neg    %eax
+  800ca0:	83 d2 00             	adc    $0x0,%edx
+  800ca3:	f7 da                	neg    %edx
+}
+  800ca5:	83 c4 1c             	add    $0x1c,%esp
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5f                   	pop    %edi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+
+00800cad <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cb3:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800cba:	74 18                	je     800cd4 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc7:	89 c3                	mov    %eax,%ebx
+  800cc9:	89 c7                	mov    %eax,%edi
+  800ccb:	89 c6                	mov    %eax,%esi
+  800ccd:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ccf:	5b                   	pop    %ebx
+  800cd0:	5e                   	pop    %esi
+  800cd1:	5f                   	pop    %edi
+  800cd2:	5d                   	pop    %ebp
+  800cd3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cdf:	89 c3                	mov    %eax,%ebx
+  800ce1:	89 c7                	mov    %eax,%edi
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	8d 35 ee 0c 80 00    	lea    0x800cee,%esi
+  800cec:	0f 34                	sysenter
+  800cee:	5d                   	pop    %ebp
+		goto out;
+  800cef:	eb de                	jmp    800ccf <sys_cputs+0x22>
+
+00800cf1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cf7:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800cfe:	74 19                	je     800d19 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d0a:	89 d1                	mov    %edx,%ecx
+  800d0c:	89 d3                	mov    %edx,%ebx
+  800d0e:	89 d7                	mov    %edx,%edi
+  800d10:	89 d6                	mov    %edx,%esi
+  800d12:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d14:	5b                   	pop    %ebx
+  800d15:	5e                   	pop    %esi
+  800d16:	5f                   	pop    %edi
+  800d17:	5d                   	pop    %ebp
+  800d18:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d23:	89 d1                	mov    %edx,%ecx
+  800d25:	89 d3                	mov    %edx,%ebx
+  800d27:	89 d7                	mov    %edx,%edi
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	8d 35 34 0d 80 00    	lea    0x800d34,%esi
+  800d32:	0f 34                	sysenter
+  800d34:	5d                   	pop    %ebp
+		goto out;
+  800d35:	eb dd                	jmp    800d14 <sys_cgetc+0x23>
+
+00800d37 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	56                   	push   %esi
+  800d3c:	53                   	push   %ebx
+  800d3d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d40:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800d47:	74 21                	je     800d6a <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d4e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d56:	89 cb                	mov    %ecx,%ebx
+  800d58:	89 cf                	mov    %ecx,%edi
+  800d5a:	89 ce                	mov    %ecx,%esi
+  800d5c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d5e:	85 c0                	test   %eax,%eax
+  800d60:	7f 27                	jg     800d89 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d65:	5b                   	pop    %ebx
+  800d66:	5e                   	pop    %esi
+  800d67:	5f                   	pop    %edi
+  800d68:	5d                   	pop    %ebp
+  800d69:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d72:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d77:	89 cb                	mov    %ecx,%ebx
+  800d79:	89 cf                	mov    %ecx,%edi
+  800d7b:	55                   	push   %ebp
+  800d7c:	89 e5                	mov    %esp,%ebp
+  800d7e:	8d 35 86 0d 80 00    	lea    0x800d86,%esi
+  800d84:	0f 34                	sysenter
+  800d86:	5d                   	pop    %ebp
+		goto out;
+  800d87:	eb d5                	jmp    800d5e <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d89:	83 ec 0c             	sub    $0xc,%esp
+  800d8c:	50                   	push   %eax
+  800d8d:	6a 03                	push   $0x3
+  800d8f:	68 ab 31 80 00       	push   $0x8031ab
+  800d94:	6a 3f                	push   $0x3f
+  800d96:	68 c8 31 80 00       	push   $0x8031c8
+  800d9b:	e8 71 f4 ff ff       	call   800211 <_panic>
+
+00800da0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da0:	55                   	push   %ebp
+  800da1:	89 e5                	mov    %esp,%ebp
+  800da3:	57                   	push   %edi
+  800da4:	56                   	push   %esi
+  800da5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800da6:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800dad:	74 19                	je     800dc8 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800daf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db9:	89 d1                	mov    %edx,%ecx
+  800dbb:	89 d3                	mov    %edx,%ebx
+  800dbd:	89 d7                	mov    %edx,%edi
+  800dbf:	89 d6                	mov    %edx,%esi
+  800dc1:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5f                   	pop    %edi
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd2:	89 d1                	mov    %edx,%ecx
+  800dd4:	89 d3                	mov    %edx,%ebx
+  800dd6:	89 d7                	mov    %edx,%edi
+  800dd8:	55                   	push   %ebp
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	8d 35 e3 0d 80 00    	lea    0x800de3,%esi
+  800de1:	0f 34                	sysenter
+  800de3:	5d                   	pop    %ebp
+		goto out;
+  800de4:	eb dd                	jmp    800dc3 <sys_getenvid+0x23>
+
+00800de6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	57                   	push   %edi
+  800dea:	56                   	push   %esi
+  800deb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dec:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800df3:	74 19                	je     800e0e <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800df5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfa:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dff:	89 d1                	mov    %edx,%ecx
+  800e01:	89 d3                	mov    %edx,%ebx
+  800e03:	89 d7                	mov    %edx,%edi
+  800e05:	89 d6                	mov    %edx,%esi
+  800e07:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e09:	5b                   	pop    %ebx
+  800e0a:	5e                   	pop    %esi
+  800e0b:	5f                   	pop    %edi
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e13:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e18:	89 d1                	mov    %edx,%ecx
+  800e1a:	89 d3                	mov    %edx,%ebx
+  800e1c:	89 d7                	mov    %edx,%edi
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	8d 35 29 0e 80 00    	lea    0x800e29,%esi
+  800e27:	0f 34                	sysenter
+  800e29:	5d                   	pop    %ebp
+		goto out;
+  800e2a:	eb dd                	jmp    800e09 <sys_yield+0x23>
+
+00800e2c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e2c:	55                   	push   %ebp
+  800e2d:	89 e5                	mov    %esp,%ebp
+  800e2f:	57                   	push   %edi
+  800e30:	56                   	push   %esi
+  800e31:	53                   	push   %ebx
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e35:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800e3c:	74 23                	je     800e61 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e3e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e43:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e51:	89 f7                	mov    %esi,%edi
+  800e53:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e55:	85 c0                	test   %eax,%eax
+  800e57:	7f 29                	jg     800e82 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5c:	5b                   	pop    %ebx
+  800e5d:	5e                   	pop    %esi
+  800e5e:	5f                   	pop    %edi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e67:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	8d 35 7f 0e 80 00    	lea    0x800e7f,%esi
+  800e7d:	0f 34                	sysenter
+  800e7f:	5d                   	pop    %ebp
+		goto out;
+  800e80:	eb d3                	jmp    800e55 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e82:	83 ec 0c             	sub    $0xc,%esp
+  800e85:	50                   	push   %eax
+  800e86:	6a 04                	push   $0x4
+  800e88:	68 ab 31 80 00       	push   $0x8031ab
+  800e8d:	6a 3f                	push   $0x3f
+  800e8f:	68 c8 31 80 00       	push   $0x8031c8
+  800e94:	e8 78 f3 ff ff       	call   800211 <_panic>
+
+00800e99 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e99:	55                   	push   %ebp
+  800e9a:	89 e5                	mov    %esp,%ebp
+  800e9c:	57                   	push   %edi
+  800e9d:	56                   	push   %esi
+  800e9e:	53                   	push   %ebx
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800ea5:	85 f6                	test   %esi,%esi
+  800ea7:	75 09                	jne    800eb2 <sys_page_map+0x19>
+  800ea9:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800eb0:	74 1f                	je     800ed1 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800eb2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	7f 27                	jg     800ef0 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ec9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ed1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800edc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800edf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ee2:	55                   	push   %ebp
+  800ee3:	89 e5                	mov    %esp,%ebp
+  800ee5:	8d 35 ed 0e 80 00    	lea    0x800eed,%esi
+  800eeb:	0f 34                	sysenter
+  800eed:	5d                   	pop    %ebp
+		goto out;
+  800eee:	eb d5                	jmp    800ec5 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	50                   	push   %eax
+  800ef4:	6a 05                	push   $0x5
+  800ef6:	68 ab 31 80 00       	push   $0x8031ab
+  800efb:	6a 3f                	push   $0x3f
+  800efd:	68 c8 31 80 00       	push   $0x8031c8
+  800f02:	e8 0a f3 ff ff       	call   800211 <_panic>
+
+00800f07 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f10:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800f17:	74 22                	je     800f3b <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f23:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f29:	89 df                	mov    %ebx,%edi
+  800f2b:	89 de                	mov    %ebx,%esi
+  800f2d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	7f 28                	jg     800f5b <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f46:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f4b:	89 df                	mov    %ebx,%edi
+  800f4d:	55                   	push   %ebp
+  800f4e:	89 e5                	mov    %esp,%ebp
+  800f50:	8d 35 58 0f 80 00    	lea    0x800f58,%esi
+  800f56:	0f 34                	sysenter
+  800f58:	5d                   	pop    %ebp
+		goto out;
+  800f59:	eb d4                	jmp    800f2f <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+  800f5e:	50                   	push   %eax
+  800f5f:	6a 06                	push   $0x6
+  800f61:	68 ab 31 80 00       	push   $0x8031ab
+  800f66:	6a 3f                	push   $0x3f
+  800f68:	68 c8 31 80 00       	push   $0x8031c8
+  800f6d:	e8 9f f2 ff ff       	call   800211 <_panic>
+
+00800f72 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	57                   	push   %edi
+  800f76:	56                   	push   %esi
+  800f77:	53                   	push   %ebx
+  800f78:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f7b:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800f82:	74 22                	je     800fa6 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f89:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f94:	89 df                	mov    %ebx,%edi
+  800f96:	89 de                	mov    %ebx,%esi
+  800f98:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9a:	85 c0                	test   %eax,%eax
+  800f9c:	7f 28                	jg     800fc6 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa1:	5b                   	pop    %ebx
+  800fa2:	5e                   	pop    %esi
+  800fa3:	5f                   	pop    %edi
+  800fa4:	5d                   	pop    %ebp
+  800fa5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fb6:	89 df                	mov    %ebx,%edi
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	8d 35 c3 0f 80 00    	lea    0x800fc3,%esi
+  800fc1:	0f 34                	sysenter
+  800fc3:	5d                   	pop    %ebp
+		goto out;
+  800fc4:	eb d4                	jmp    800f9a <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	50                   	push   %eax
+  800fca:	6a 08                	push   $0x8
+  800fcc:	68 ab 31 80 00       	push   $0x8031ab
+  800fd1:	6a 3f                	push   $0x3f
+  800fd3:	68 c8 31 80 00       	push   $0x8031c8
+  800fd8:	e8 34 f2 ff ff       	call   800211 <_panic>
+
+00800fdd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fe6:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800fed:	74 22                	je     801011 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800fef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ff9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fff:	89 df                	mov    %ebx,%edi
+  801001:	89 de                	mov    %ebx,%esi
+  801003:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801005:	85 c0                	test   %eax,%eax
+  801007:	7f 28                	jg     801031 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801009:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100c:	5b                   	pop    %ebx
+  80100d:	5e                   	pop    %esi
+  80100e:	5f                   	pop    %edi
+  80100f:	5d                   	pop    %ebp
+  801010:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801011:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801016:	8b 55 08             	mov    0x8(%ebp),%edx
+  801019:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801021:	89 df                	mov    %ebx,%edi
+  801023:	55                   	push   %ebp
+  801024:	89 e5                	mov    %esp,%ebp
+  801026:	8d 35 2e 10 80 00    	lea    0x80102e,%esi
+  80102c:	0f 34                	sysenter
+  80102e:	5d                   	pop    %ebp
+		goto out;
+  80102f:	eb d4                	jmp    801005 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801031:	83 ec 0c             	sub    $0xc,%esp
+  801034:	50                   	push   %eax
+  801035:	6a 09                	push   $0x9
+  801037:	68 ab 31 80 00       	push   $0x8031ab
+  80103c:	6a 3f                	push   $0x3f
+  80103e:	68 c8 31 80 00       	push   $0x8031c8
+  801043:	e8 c9 f1 ff ff       	call   800211 <_panic>
+
+00801048 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801048:	55                   	push   %ebp
+  801049:	89 e5                	mov    %esp,%ebp
+  80104b:	57                   	push   %edi
+  80104c:	56                   	push   %esi
+  80104d:	53                   	push   %ebx
+  80104e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801051:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801058:	74 22                	je     80107c <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80105a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801064:	8b 55 08             	mov    0x8(%ebp),%edx
+  801067:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106a:	89 df                	mov    %ebx,%edi
+  80106c:	89 de                	mov    %ebx,%esi
+  80106e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801070:	85 c0                	test   %eax,%eax
+  801072:	7f 28                	jg     80109c <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801074:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801077:	5b                   	pop    %ebx
+  801078:	5e                   	pop    %esi
+  801079:	5f                   	pop    %edi
+  80107a:	5d                   	pop    %ebp
+  80107b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80107c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801087:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80108c:	89 df                	mov    %ebx,%edi
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	8d 35 99 10 80 00    	lea    0x801099,%esi
+  801097:	0f 34                	sysenter
+  801099:	5d                   	pop    %ebp
+		goto out;
+  80109a:	eb d4                	jmp    801070 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109c:	83 ec 0c             	sub    $0xc,%esp
+  80109f:	50                   	push   %eax
+  8010a0:	6a 0a                	push   $0xa
+  8010a2:	68 ab 31 80 00       	push   $0x8031ab
+  8010a7:	6a 3f                	push   $0x3f
+  8010a9:	68 c8 31 80 00       	push   $0x8031c8
+  8010ae:	e8 5e f1 ff ff       	call   800211 <_panic>
+
+008010b3 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	57                   	push   %edi
+  8010b7:	56                   	push   %esi
+  8010b8:	53                   	push   %ebx
+  8010b9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010bc:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8010c3:	74 22                	je     8010e7 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8010c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ca:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d5:	89 df                	mov    %ebx,%edi
+  8010d7:	89 de                	mov    %ebx,%esi
+  8010d9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010db:	85 c0                	test   %eax,%eax
+  8010dd:	7f 28                	jg     801107 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8010df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e2:	5b                   	pop    %ebx
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5f                   	pop    %edi
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f2:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010f7:	89 df                	mov    %ebx,%edi
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	8d 35 04 11 80 00    	lea    0x801104,%esi
+  801102:	0f 34                	sysenter
+  801104:	5d                   	pop    %ebp
+		goto out;
+  801105:	eb d4                	jmp    8010db <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801107:	83 ec 0c             	sub    $0xc,%esp
+  80110a:	50                   	push   %eax
+  80110b:	6a 17                	push   $0x17
+  80110d:	68 ab 31 80 00       	push   $0x8031ab
+  801112:	6a 3f                	push   $0x3f
+  801114:	68 c8 31 80 00       	push   $0x8031c8
+  801119:	e8 f3 f0 ff ff       	call   800211 <_panic>
+
+0080111e <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80111e:	55                   	push   %ebp
+  80111f:	89 e5                	mov    %esp,%ebp
+  801121:	57                   	push   %edi
+  801122:	56                   	push   %esi
+  801123:	53                   	push   %ebx
+  801124:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801127:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  80112e:	74 22                	je     801152 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801130:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801135:	b8 18 00 00 00       	mov    $0x18,%eax
+  80113a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801140:	89 df                	mov    %ebx,%edi
+  801142:	89 de                	mov    %ebx,%esi
+  801144:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801146:	85 c0                	test   %eax,%eax
+  801148:	7f 28                	jg     801172 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80114a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114d:	5b                   	pop    %ebx
+  80114e:	5e                   	pop    %esi
+  80114f:	5f                   	pop    %edi
+  801150:	5d                   	pop    %ebp
+  801151:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801152:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801162:	89 df                	mov    %ebx,%edi
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	8d 35 6f 11 80 00    	lea    0x80116f,%esi
+  80116d:	0f 34                	sysenter
+  80116f:	5d                   	pop    %ebp
+		goto out;
+  801170:	eb d4                	jmp    801146 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801172:	83 ec 0c             	sub    $0xc,%esp
+  801175:	50                   	push   %eax
+  801176:	6a 18                	push   $0x18
+  801178:	68 ab 31 80 00       	push   $0x8031ab
+  80117d:	6a 3f                	push   $0x3f
+  80117f:	68 c8 31 80 00       	push   $0x8031c8
+  801184:	e8 88 f0 ff ff       	call   800211 <_panic>
+
+00801189 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80118f:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801196:	74 1d                	je     8011b5 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801198:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80119d:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ae:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011b0:	5b                   	pop    %ebx
+  8011b1:	5e                   	pop    %esi
+  8011b2:	5f                   	pop    %edi
+  8011b3:	5d                   	pop    %ebp
+  8011b4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011c0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c6:	55                   	push   %ebp
+  8011c7:	89 e5                	mov    %esp,%ebp
+  8011c9:	8d 35 d1 11 80 00    	lea    0x8011d1,%esi
+  8011cf:	0f 34                	sysenter
+  8011d1:	5d                   	pop    %ebp
+		goto out;
+  8011d2:	eb dc                	jmp    8011b0 <sys_ipc_try_send+0x27>
+
+008011d4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011d4:	55                   	push   %ebp
+  8011d5:	89 e5                	mov    %esp,%ebp
+  8011d7:	57                   	push   %edi
+  8011d8:	56                   	push   %esi
+  8011d9:	53                   	push   %ebx
+  8011da:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011dd:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8011e4:	74 21                	je     801207 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8011e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f3:	89 cb                	mov    %ecx,%ebx
+  8011f5:	89 cf                	mov    %ecx,%edi
+  8011f7:	89 ce                	mov    %ecx,%esi
+  8011f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011fb:	85 c0                	test   %eax,%eax
+  8011fd:	7f 27                	jg     801226 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801202:	5b                   	pop    %ebx
+  801203:	5e                   	pop    %esi
+  801204:	5f                   	pop    %edi
+  801205:	5d                   	pop    %ebp
+  801206:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801207:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80120f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801214:	89 cb                	mov    %ecx,%ebx
+  801216:	89 cf                	mov    %ecx,%edi
+  801218:	55                   	push   %ebp
+  801219:	89 e5                	mov    %esp,%ebp
+  80121b:	8d 35 23 12 80 00    	lea    0x801223,%esi
+  801221:	0f 34                	sysenter
+  801223:	5d                   	pop    %ebp
+		goto out;
+  801224:	eb d5                	jmp    8011fb <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801226:	83 ec 0c             	sub    $0xc,%esp
+  801229:	50                   	push   %eax
+  80122a:	6a 0d                	push   $0xd
+  80122c:	68 ab 31 80 00       	push   $0x8031ab
+  801231:	6a 3f                	push   $0x3f
+  801233:	68 c8 31 80 00       	push   $0x8031c8
+  801238:	e8 d4 ef ff ff       	call   800211 <_panic>
+
+0080123d <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	57                   	push   %edi
+  801241:	56                   	push   %esi
+  801242:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801243:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  80124a:	74 1b                	je     801267 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80124c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801251:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801256:	8b 55 08             	mov    0x8(%ebp),%edx
+  801259:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125c:	89 df                	mov    %ebx,%edi
+  80125e:	89 de                	mov    %ebx,%esi
+  801260:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801262:	5b                   	pop    %ebx
+  801263:	5e                   	pop    %esi
+  801264:	5f                   	pop    %edi
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801267:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801272:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801277:	89 df                	mov    %ebx,%edi
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	8d 35 84 12 80 00    	lea    0x801284,%esi
+  801282:	0f 34                	sysenter
+  801284:	5d                   	pop    %ebp
+		goto out;
+  801285:	eb db                	jmp    801262 <sys_ipc_recv_until+0x25>
+
+00801287 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801287:	55                   	push   %ebp
+  801288:	89 e5                	mov    %esp,%ebp
+  80128a:	57                   	push   %edi
+  80128b:	56                   	push   %esi
+  80128c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80128d:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801294:	74 19                	je     8012af <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012a0:	89 d1                	mov    %edx,%ecx
+  8012a2:	89 d3                	mov    %edx,%ebx
+  8012a4:	89 d7                	mov    %edx,%edi
+  8012a6:	89 d6                	mov    %edx,%esi
+  8012a8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012aa:	5b                   	pop    %ebx
+  8012ab:	5e                   	pop    %esi
+  8012ac:	5f                   	pop    %edi
+  8012ad:	5d                   	pop    %ebp
+  8012ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012b9:	89 d1                	mov    %edx,%ecx
+  8012bb:	89 d3                	mov    %edx,%ebx
+  8012bd:	89 d7                	mov    %edx,%edi
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	8d 35 ca 12 80 00    	lea    0x8012ca,%esi
+  8012c8:	0f 34                	sysenter
+  8012ca:	5d                   	pop    %ebp
+		goto out;
+  8012cb:	eb dd                	jmp    8012aa <sys_time_msec+0x23>
+
+008012cd <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	57                   	push   %edi
+  8012d1:	56                   	push   %esi
+  8012d2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012d3:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8012da:	74 1a                	je     8012f6 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8012dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e9:	89 cb                	mov    %ecx,%ebx
+  8012eb:	89 cf                	mov    %ecx,%edi
+  8012ed:	89 ce                	mov    %ecx,%esi
+  8012ef:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5f                   	pop    %edi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012fe:	b8 10 00 00 00       	mov    $0x10,%eax
+  801303:	89 cb                	mov    %ecx,%ebx
+  801305:	89 cf                	mov    %ecx,%edi
+  801307:	55                   	push   %ebp
+  801308:	89 e5                	mov    %esp,%ebp
+  80130a:	8d 35 12 13 80 00    	lea    0x801312,%esi
+  801310:	0f 34                	sysenter
+  801312:	5d                   	pop    %ebp
+		goto out;
+  801313:	eb dc                	jmp    8012f1 <sys_sleep_until+0x24>
+
+00801315 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801315:	55                   	push   %ebp
+  801316:	89 e5                	mov    %esp,%ebp
+  801318:	57                   	push   %edi
+  801319:	56                   	push   %esi
+  80131a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80131b:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801322:	74 1a                	je     80133e <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801324:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801329:	b8 11 00 00 00       	mov    $0x11,%eax
+  80132e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801331:	89 cb                	mov    %ecx,%ebx
+  801333:	89 cf                	mov    %ecx,%edi
+  801335:	89 ce                	mov    %ecx,%esi
+  801337:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801339:	5b                   	pop    %ebx
+  80133a:	5e                   	pop    %esi
+  80133b:	5f                   	pop    %edi
+  80133c:	5d                   	pop    %ebp
+  80133d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80133e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801341:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801346:	b8 11 00 00 00       	mov    $0x11,%eax
+  80134b:	89 cb                	mov    %ecx,%ebx
+  80134d:	89 cf                	mov    %ecx,%edi
+  80134f:	55                   	push   %ebp
+  801350:	89 e5                	mov    %esp,%ebp
+  801352:	8d 35 5a 13 80 00    	lea    0x80135a,%esi
+  801358:	0f 34                	sysenter
+  80135a:	5d                   	pop    %ebp
+		goto out;
+  80135b:	eb dc                	jmp    801339 <sys_env_print_stats+0x24>
+
+0080135d <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	57                   	push   %edi
+  801361:	56                   	push   %esi
+  801362:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801363:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  80136a:	74 1b                	je     801387 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80136c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801371:	b8 19 00 00 00       	mov    $0x19,%eax
+  801376:	8b 55 08             	mov    0x8(%ebp),%edx
+  801379:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137c:	89 df                	mov    %ebx,%edi
+  80137e:	89 de                	mov    %ebx,%esi
+  801380:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801382:	5b                   	pop    %ebx
+  801383:	5e                   	pop    %esi
+  801384:	5f                   	pop    %edi
+  801385:	5d                   	pop    %ebp
+  801386:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801387:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801392:	b8 19 00 00 00       	mov    $0x19,%eax
+  801397:	89 df                	mov    %ebx,%edi
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	8d 35 a4 13 80 00    	lea    0x8013a4,%esi
+  8013a2:	0f 34                	sysenter
+  8013a4:	5d                   	pop    %ebp
+		goto out;
+  8013a5:	eb db                	jmp    801382 <sys_perf+0x25>
+
+008013a7 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	57                   	push   %edi
+  8013ab:	56                   	push   %esi
+  8013ac:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013ad:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8013b4:	74 19                	je     8013cf <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8013b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013c0:	89 d1                	mov    %edx,%ecx
+  8013c2:	89 d3                	mov    %edx,%ebx
+  8013c4:	89 d7                	mov    %edx,%edi
+  8013c6:	89 d6                	mov    %edx,%esi
+  8013c8:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013ca:	5b                   	pop    %ebx
+  8013cb:	5e                   	pop    %esi
+  8013cc:	5f                   	pop    %edi
+  8013cd:	5d                   	pop    %ebp
+  8013ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013d9:	89 d1                	mov    %edx,%ecx
+  8013db:	89 d3                	mov    %edx,%ebx
+  8013dd:	89 d7                	mov    %edx,%edi
+  8013df:	55                   	push   %ebp
+  8013e0:	89 e5                	mov    %esp,%ebp
+  8013e2:	8d 35 ea 13 80 00    	lea    0x8013ea,%esi
+  8013e8:	0f 34                	sysenter
+  8013ea:	5d                   	pop    %ebp
+		goto out;
+  8013eb:	eb dd                	jmp    8013ca <sys_fork+0x23>
+
+008013ed <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8013ed:	55                   	push   %ebp
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	57                   	push   %edi
+  8013f1:	56                   	push   %esi
+  8013f2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013f3:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8013fa:	74 1c                	je     801418 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801401:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801406:	8b 55 08             	mov    0x8(%ebp),%edx
+  801409:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80140f:	89 f7                	mov    %esi,%edi
+  801411:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801413:	5b                   	pop    %ebx
+  801414:	5e                   	pop    %esi
+  801415:	5f                   	pop    %edi
+  801416:	5d                   	pop    %ebp
+  801417:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801423:	bf 00 00 00 00       	mov    $0x0,%edi
+  801428:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142b:	55                   	push   %ebp
+  80142c:	89 e5                	mov    %esp,%ebp
+  80142e:	8d 35 36 14 80 00    	lea    0x801436,%esi
+  801434:	0f 34                	sysenter
+  801436:	5d                   	pop    %ebp
+		goto out;
+  801437:	eb da                	jmp    801413 <sys_thread_create+0x26>
+
+00801439 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	57                   	push   %edi
+  80143d:	56                   	push   %esi
+  80143e:	53                   	push   %ebx
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801442:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801449:	74 24                	je     80146f <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80144b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801450:	be 00 00 00 00       	mov    $0x0,%esi
+  801455:	8b 55 08             	mov    0x8(%ebp),%edx
+  801458:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80145e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801461:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801463:	85 c0                	test   %eax,%eax
+  801465:	7f 27                	jg     80148e <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801467:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146a:	5b                   	pop    %ebx
+  80146b:	5e                   	pop    %esi
+  80146c:	5f                   	pop    %edi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80146f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801472:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801475:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80147a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801480:	55                   	push   %ebp
+  801481:	89 e5                	mov    %esp,%ebp
+  801483:	8d 35 8b 14 80 00    	lea    0x80148b,%esi
+  801489:	0f 34                	sysenter
+  80148b:	5d                   	pop    %ebp
+		goto out;
+  80148c:	eb d5                	jmp    801463 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80148e:	83 ec 0c             	sub    $0xc,%esp
+  801491:	50                   	push   %eax
+  801492:	6a 1f                	push   $0x1f
+  801494:	68 ab 31 80 00       	push   $0x8031ab
+  801499:	6a 3f                	push   $0x3f
+  80149b:	68 c8 31 80 00       	push   $0x8031c8
+  8014a0:	e8 6c ed ff ff       	call   800211 <_panic>
+
+008014a5 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8014a5:	55                   	push   %ebp
+  8014a6:	89 e5                	mov    %esp,%ebp
+  8014a8:	57                   	push   %edi
+  8014a9:	56                   	push   %esi
+  8014aa:	53                   	push   %ebx
+  8014ab:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014ae:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8014b5:	74 23                	je     8014da <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8014b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bc:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ca:	89 f7                	mov    %esi,%edi
+  8014cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014ce:	85 c0                	test   %eax,%eax
+  8014d0:	7f 29                	jg     8014fb <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8014d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d5:	5b                   	pop    %ebx
+  8014d6:	5e                   	pop    %esi
+  8014d7:	5f                   	pop    %edi
+  8014d8:	5d                   	pop    %ebp
+  8014d9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e0:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	8d 35 f8 14 80 00    	lea    0x8014f8,%esi
+  8014f6:	0f 34                	sysenter
+  8014f8:	5d                   	pop    %ebp
+		goto out;
+  8014f9:	eb d3                	jmp    8014ce <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014fb:	83 ec 0c             	sub    $0xc,%esp
+  8014fe:	50                   	push   %eax
+  8014ff:	6a 20                	push   $0x20
+  801501:	68 ab 31 80 00       	push   $0x8031ab
+  801506:	6a 3f                	push   $0x3f
+  801508:	68 c8 31 80 00       	push   $0x8031c8
+  80150d:	e8 ff ec ff ff       	call   800211 <_panic>
+
+00801512 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	57                   	push   %edi
+  801516:	56                   	push   %esi
+  801517:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801518:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  80151f:	74 1b                	je     80153c <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801526:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80152b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801531:	89 df                	mov    %ebx,%edi
+  801533:	89 de                	mov    %ebx,%esi
+  801535:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801537:	5b                   	pop    %ebx
+  801538:	5e                   	pop    %esi
+  801539:	5f                   	pop    %edi
+  80153a:	5d                   	pop    %ebp
+  80153b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80153c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801541:	8b 55 08             	mov    0x8(%ebp),%edx
+  801544:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801547:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80154c:	89 df                	mov    %ebx,%edi
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	8d 35 59 15 80 00    	lea    0x801559,%esi
+  801557:	0f 34                	sysenter
+  801559:	5d                   	pop    %ebp
+		goto out;
+  80155a:	eb db                	jmp    801537 <sys_batch+0x25>
+
+0080155c <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80155c:	55                   	push   %ebp
+  80155d:	89 e5                	mov    %esp,%ebp
+  80155f:	57                   	push   %edi
+  801560:	56                   	push   %esi
+  801561:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801562:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801569:	74 1a                	je     801585 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80156b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801570:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801575:	8b 55 08             	mov    0x8(%ebp),%edx
+  801578:	89 cb                	mov    %ecx,%ebx
+  80157a:	89 cf                	mov    %ecx,%edi
+  80157c:	89 ce                	mov    %ecx,%esi
+  80157e:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801580:	5b                   	pop    %ebx
+  801581:	5e                   	pop    %esi
+  801582:	5f                   	pop    %edi
+  801583:	5d                   	pop    %ebp
+  801584:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801585:	8b 55 08             	mov    0x8(%ebp),%edx
+  801588:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801592:	89 cb                	mov    %ecx,%ebx
+  801594:	89 cf                	mov    %ecx,%edi
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	8d 35 a1 15 80 00    	lea    0x8015a1,%esi
+  80159f:	0f 34                	sysenter
+  8015a1:	5d                   	pop    %ebp
+		goto out;
+  8015a2:	eb dc                	jmp    801580 <sys_trace_ctl+0x24>
+
+008015a4 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	57                   	push   %edi
+  8015a8:	56                   	push   %esi
+  8015a9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015aa:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8015b1:	74 1c                	je     8015cf <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8015b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c6:	89 f7                	mov    %esi,%edi
+  8015c8:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8015ca:	5b                   	pop    %ebx
+  8015cb:	5e                   	pop    %esi
+  8015cc:	5f                   	pop    %edi
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	8d 35 ed 15 80 00    	lea    0x8015ed,%esi
+  8015eb:	0f 34                	sysenter
+  8015ed:	5d                   	pop    %ebp
+		goto out;
+  8015ee:	eb da                	jmp    8015ca <sys_trace_read+0x26>
+
+008015f0 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015f0:	55                   	push   %ebp
+  8015f1:	89 e5                	mov    %esp,%ebp
+  8015f3:	57                   	push   %edi
+  8015f4:	56                   	push   %esi
+  8015f5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015f6:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8015fd:	74 1c                	je     80161b <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8015ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801604:	b8 21 00 00 00       	mov    $0x21,%eax
+  801609:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801612:	89 f7                	mov    %esi,%edi
+  801614:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801616:	5b                   	pop    %ebx
+  801617:	5e                   	pop    %esi
+  801618:	5f                   	pop    %edi
+  801619:	5d                   	pop    %ebp
+  80161a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80161b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801621:	b8 21 00 00 00       	mov    $0x21,%eax
+  801626:	bf 00 00 00 00       	mov    $0x0,%edi
+  80162b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80162e:	55                   	push   %ebp
+  80162f:	89 e5                	mov    %esp,%ebp
+  801631:	8d 35 39 16 80 00    	lea    0x801639,%esi
+  801637:	0f 34                	sysenter
+  801639:	5d                   	pop    %ebp
+		goto out;
+  80163a:	eb da                	jmp    801616 <sys_meminfo+0x26>
+
+0080163c <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80163c:	55                   	push   %ebp
+  80163d:	89 e5                	mov    %esp,%ebp
+  80163f:	57                   	push   %edi
+  801640:	56                   	push   %esi
+  801641:	53                   	push   %ebx
+  801642:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801645:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801649:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801650:	74 1f                	je     801671 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801652:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801657:	b8 22 00 00 00       	mov    $0x22,%eax
+  80165c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165f:	89 df                	mov    %ebx,%edi
+  801661:	89 de                	mov    %ebx,%esi
+  801663:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801665:	85 c0                	test   %eax,%eax
+  801667:	7f 25                	jg     80168e <sys_env_set_ksm+0x52>
+}
+  801669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166c:	5b                   	pop    %ebx
+  80166d:	5e                   	pop    %esi
+  80166e:	5f                   	pop    %edi
+  80166f:	5d                   	pop    %ebp
+  801670:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801671:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801676:	8b 55 08             	mov    0x8(%ebp),%edx
+  801679:	b8 22 00 00 00       	mov    $0x22,%eax
+  80167e:	89 df                	mov    %ebx,%edi
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	8d 35 8b 16 80 00    	lea    0x80168b,%esi
+  801689:	0f 34                	sysenter
+  80168b:	5d                   	pop    %ebp
+		goto out;
+  80168c:	eb d7                	jmp    801665 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80168e:	83 ec 0c             	sub    $0xc,%esp
+  801691:	50                   	push   %eax
+  801692:	6a 22                	push   $0x22
+  801694:	68 ab 31 80 00       	push   $0x8031ab
+  801699:	6a 3f                	push   $0x3f
+  80169b:	68 c8 31 80 00       	push   $0x8031c8
+  8016a0:	e8 6c eb ff ff       	call   800211 <_panic>
+
+008016a5 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8016a5:	55                   	push   %ebp
+  8016a6:	89 e5                	mov    %esp,%ebp
+  8016a8:	57                   	push   %edi
+  8016a9:	56                   	push   %esi
+  8016aa:	53                   	push   %ebx
+  8016ab:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8016ae:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8016b1:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8016b8:	74 24                	je     8016de <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8016ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016c4:	89 cb                	mov    %ecx,%ebx
+  8016c6:	89 cf                	mov    %ecx,%edi
+  8016c8:	89 ce                	mov    %ecx,%esi
+  8016ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	7f 2a                	jg     8016fa <sys_time_nsec+0x55>
+	return ns;
+}
+  8016d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016d3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d9:	5b                   	pop    %ebx
+  8016da:	5e                   	pop    %esi
+  8016db:	5f                   	pop    %edi
+  8016dc:	5d                   	pop    %ebp
+  8016dd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016e8:	89 cb                	mov    %ecx,%ebx
+  8016ea:	89 cf                	mov    %ecx,%edi
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	8d 35 f7 16 80 00    	lea    0x8016f7,%esi
+  8016f5:	0f 34                	sysenter
+  8016f7:	5d                   	pop    %ebp
+		goto out;
+  8016f8:	eb d2                	jmp    8016cc <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016fa:	83 ec 0c             	sub    $0xc,%esp
+  8016fd:	50                   	push   %eax
+  8016fe:	6a 0f                	push   $0xf
+  801700:	68 ab 31 80 00       	push   $0x8031ab
+  801705:	6a 3f                	push   $0x3f
+  801707:	68 c8 31 80 00       	push   $0x8031c8
+  80170c:	e8 00 eb ff ff       	call   800211 <_panic>
+
+00801711 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801711:	55                   	push   %ebp
+  801712:	89 e5                	mov    %esp,%ebp
+  801714:	57                   	push   %edi
+  801715:	56                   	push   %esi
+  801716:	53                   	push   %ebx
+  801717:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80171a:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801721:	74 22                	je     801745 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801723:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801728:	b8 12 00 00 00       	mov    $0x12,%eax
+  80172d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801730:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801733:	89 df                	mov    %ebx,%edi
+  801735:	89 de                	mov    %ebx,%esi
+  801737:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801739:	85 c0                	test   %eax,%eax
+  80173b:	7f 28                	jg     801765 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80173d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801740:	5b                   	pop    %ebx
+  801741:	5e                   	pop    %esi
+  801742:	5f                   	pop    %edi
+  801743:	5d                   	pop    %ebp
+  801744:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801745:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801750:	b8 12 00 00 00       	mov    $0x12,%eax
+  801755:	89 df                	mov    %ebx,%edi
+  801757:	55                   	push   %ebp
+  801758:	89 e5                	mov    %esp,%ebp
+  80175a:	8d 35 62 17 80 00    	lea    0x801762,%esi
+  801760:	0f 34                	sysenter
+  801762:	5d                   	pop    %ebp
+		goto out;
+  801763:	eb d4                	jmp    801739 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801765:	83 ec 0c             	sub    $0xc,%esp
+  801768:	50                   	push   %eax
+  801769:	6a 12                	push   $0x12
+  80176b:	68 ab 31 80 00       	push   $0x8031ab
+  801770:	6a 3f                	push   $0x3f
+  801772:	68 c8 31 80 00       	push   $0x8031c8
+  801777:	e8 95 ea ff ff       	call   800211 <_panic>
+
+0080177c <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80177c:	55                   	push   %ebp
+  80177d:	89 e5                	mov    %esp,%ebp
+  80177f:	57                   	push   %edi
+  801780:	56                   	push   %esi
+  801781:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801782:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801789:	74 1b                	je     8017a6 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80178b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801790:	b8 13 00 00 00       	mov    $0x13,%eax
+  801795:	8b 55 08             	mov    0x8(%ebp),%edx
+  801798:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80179b:	89 df                	mov    %ebx,%edi
+  80179d:	89 de                	mov    %ebx,%esi
+  80179f:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017a1:	5b                   	pop    %ebx
+  8017a2:	5e                   	pop    %esi
+  8017a3:	5f                   	pop    %edi
+  8017a4:	5d                   	pop    %ebp
+  8017a5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017b6:	89 df                	mov    %ebx,%edi
+  8017b8:	55                   	push   %ebp
+  8017b9:	89 e5                	mov    %esp,%ebp
+  8017bb:	8d 35 c3 17 80 00    	lea    0x8017c3,%esi
+  8017c1:	0f 34                	sysenter
+  8017c3:	5d                   	pop    %ebp
+		goto out;
+  8017c4:	eb db                	jmp    8017a1 <sys_e1000_receive+0x25>
+
+008017c6 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8017c6:	55                   	push   %ebp
+  8017c7:	89 e5                	mov    %esp,%ebp
+  8017c9:	57                   	push   %edi
+  8017ca:	56                   	push   %esi
+  8017cb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017cc:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8017d3:	74 1b                	je     8017f0 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8017d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017da:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e5:	89 df                	mov    %ebx,%edi
+  8017e7:	89 de                	mov    %ebx,%esi
+  8017e9:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017eb:	5b                   	pop    %ebx
+  8017ec:	5e                   	pop    %esi
+  8017ed:	5f                   	pop    %edi
+  8017ee:	5d                   	pop    %ebp
+  8017ef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fb:	b8 14 00 00 00       	mov    $0x14,%eax
+  801800:	89 df                	mov    %ebx,%edi
+  801802:	55                   	push   %ebp
+  801803:	89 e5                	mov    %esp,%ebp
+  801805:	8d 35 0d 18 80 00    	lea    0x80180d,%esi
+  80180b:	0f 34                	sysenter
+  80180d:	5d                   	pop    %ebp
+		goto out;
+  80180e:	eb db                	jmp    8017eb <sys_e1000_read_hwaddr+0x25>
+
+00801810 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801810:	55                   	push   %ebp
+  801811:	89 e5                	mov    %esp,%ebp
+  801813:	57                   	push   %edi
+  801814:	56                   	push   %esi
+  801815:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801816:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  80181d:	74 1a                	je     801839 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80181f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801824:	b8 15 00 00 00       	mov    $0x15,%eax
+  801829:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182c:	89 cb                	mov    %ecx,%ebx
+  80182e:	89 cf                	mov    %ecx,%edi
+  801830:	89 ce                	mov    %ecx,%esi
+  801832:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801834:	5b                   	pop    %ebx
+  801835:	5e                   	pop    %esi
+  801836:	5f                   	pop    %edi
+  801837:	5d                   	pop    %ebp
+  801838:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801839:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801841:	b8 15 00 00 00       	mov    $0x15,%eax
+  801846:	89 cb                	mov    %ecx,%ebx
+  801848:	89 cf                	mov    %ecx,%edi
+  80184a:	55                   	push   %ebp
+  80184b:	89 e5                	mov    %esp,%ebp
+  80184d:	8d 35 55 18 80 00    	lea    0x801855,%esi
+  801853:	0f 34                	sysenter
+  801855:	5d                   	pop    %ebp
+		goto out;
+  801856:	eb dc                	jmp    801834 <sys_sb16_read_version+0x24>
+
+00801858 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	57                   	push   %edi
+  80185c:	56                   	push   %esi
+  80185d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80185e:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801865:	74 1b                	je     801882 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801867:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801871:	8b 55 08             	mov    0x8(%ebp),%edx
+  801874:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801877:	89 df                	mov    %ebx,%edi
+  801879:	89 de                	mov    %ebx,%esi
+  80187b:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80187d:	5b                   	pop    %ebx
+  80187e:	5e                   	pop    %esi
+  80187f:	5f                   	pop    %edi
+  801880:	5d                   	pop    %ebp
+  801881:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801882:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801887:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80188d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801892:	89 df                	mov    %ebx,%edi
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	8d 35 9f 18 80 00    	lea    0x80189f,%esi
+  80189d:	0f 34                	sysenter
+  80189f:	5d                   	pop    %ebp
+		goto out;
+  8018a0:	eb db                	jmp    80187d <sys_sb16_play+0x25>
+
+008018a2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018a2:	55                   	push   %ebp
+  8018a3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018ad:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018b0:	5d                   	pop    %ebp
+  8018b1:	c3                   	ret
+
+008018b2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018b2:	55                   	push   %ebp
+  8018b3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018bd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018c2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018c7:	5d                   	pop    %ebp
+  8018c8:	c3                   	ret
+
+008018c9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018c9:	55                   	push   %ebp
+  8018ca:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018cc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018d1:	eb 02                	jmp    8018d5 <fd_alloc+0xc>
+  8018d3:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018d5:	89 c2                	mov    %eax,%edx
+  8018d7:	c1 ea 16             	shr    $0x16,%edx
+  8018da:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018e1:	f6 c2 01             	test   $0x1,%dl
+  8018e4:	74 2b                	je     801911 <fd_alloc+0x48>
+  8018e6:	89 c2                	mov    %eax,%edx
+  8018e8:	c1 ea 0c             	shr    $0xc,%edx
+  8018eb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018f2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018f8:	f6 c1 01             	test   $0x1,%cl
+  8018fb:	74 14                	je     801911 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018fd:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801903:	75 ce                	jne    8018d3 <fd_alloc+0xa>
+  801905:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80190a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80190f:	eb 05                	jmp    801916 <fd_alloc+0x4d>
+			return 0;
+  801911:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801916:	8b 55 08             	mov    0x8(%ebp),%edx
+  801919:	89 02                	mov    %eax,(%edx)
+}
+  80191b:	89 c8                	mov    %ecx,%eax
+  80191d:	5d                   	pop    %ebp
+  80191e:	c3                   	ret
+
+0080191f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80191f:	55                   	push   %ebp
+  801920:	89 e5                	mov    %esp,%ebp
+  801922:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801925:	83 f8 1f             	cmp    $0x1f,%eax
+  801928:	77 30                	ja     80195a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80192a:	c1 e0 0c             	shl    $0xc,%eax
+  80192d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801932:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801938:	f6 c2 01             	test   $0x1,%dl
+  80193b:	74 24                	je     801961 <fd_lookup+0x42>
+  80193d:	89 c2                	mov    %eax,%edx
+  80193f:	c1 ea 0c             	shr    $0xc,%edx
+  801942:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801949:	f6 c2 01             	test   $0x1,%dl
+  80194c:	74 1a                	je     801968 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80194e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801951:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801953:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801958:	5d                   	pop    %ebp
+  801959:	c3                   	ret
+		return -E_INVAL;
+  80195a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80195f:	eb f7                	jmp    801958 <fd_lookup+0x39>
+		return -E_INVAL;
+  801961:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801966:	eb f0                	jmp    801958 <fd_lookup+0x39>
+  801968:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80196d:	eb e9                	jmp    801958 <fd_lookup+0x39>
+
+0080196f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80196f:	55                   	push   %ebp
+  801970:	89 e5                	mov    %esp,%ebp
+  801972:	53                   	push   %ebx
+  801973:	83 ec 04             	sub    $0x4,%esp
+  801976:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197e:	eb 03                	jmp    801983 <dev_lookup+0x14>
+  801980:	83 c0 01             	add    $0x1,%eax
+  801983:	8b 1c 85 54 32 80 00 	mov    0x803254(,%eax,4),%ebx
+  80198a:	85 db                	test   %ebx,%ebx
+  80198c:	74 0b                	je     801999 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80198e:	39 13                	cmp    %edx,(%ebx)
+  801990:	75 ee                	jne    801980 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801992:	b8 00 00 00 00       	mov    $0x0,%eax
+  801997:	eb 2e                	jmp    8019c7 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801999:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80199b:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8019a0:	8b 0d 08 90 80 00    	mov    0x809008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8019a6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8019ab:	76 24                	jbe    8019d1 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019ad:	8b 41 48             	mov    0x48(%ecx),%eax
+  8019b0:	83 ec 04             	sub    $0x4,%esp
+  8019b3:	52                   	push   %edx
+  8019b4:	50                   	push   %eax
+  8019b5:	68 d8 31 80 00       	push   $0x8031d8
+  8019ba:	e8 2d e9 ff ff       	call   8002ec <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019ca:	89 1a                	mov    %ebx,(%edx)
+}
+  8019cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8019d1:	c1 e8 10             	shr    $0x10,%eax
+  8019d4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8019da:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8019e0:	eb cb                	jmp    8019ad <dev_lookup+0x3e>
+
+008019e2 <fd_close>:
+{
+  8019e2:	55                   	push   %ebp
+  8019e3:	89 e5                	mov    %esp,%ebp
+  8019e5:	57                   	push   %edi
+  8019e6:	56                   	push   %esi
+  8019e7:	53                   	push   %ebx
+  8019e8:	83 ec 24             	sub    $0x24,%esp
+  8019eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019f4:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019f5:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019fb:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019fe:	50                   	push   %eax
+  8019ff:	e8 1b ff ff ff       	call   80191f <fd_lookup>
+  801a04:	89 c3                	mov    %eax,%ebx
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	78 05                	js     801a12 <fd_close+0x30>
+	    || fd != fd2)
+  801a0d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a10:	74 16                	je     801a28 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a12:	89 f8                	mov    %edi,%eax
+  801a14:	84 c0                	test   %al,%al
+  801a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a1e:	89 d8                	mov    %ebx,%eax
+  801a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a23:	5b                   	pop    %ebx
+  801a24:	5e                   	pop    %esi
+  801a25:	5f                   	pop    %edi
+  801a26:	5d                   	pop    %ebp
+  801a27:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a28:	83 ec 08             	sub    $0x8,%esp
+  801a2b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a2e:	50                   	push   %eax
+  801a2f:	ff 36                	push   (%esi)
+  801a31:	e8 39 ff ff ff       	call   80196f <dev_lookup>
+  801a36:	89 c3                	mov    %eax,%ebx
+  801a38:	83 c4 10             	add    $0x10,%esp
+  801a3b:	85 c0                	test   %eax,%eax
+  801a3d:	78 1a                	js     801a59 <fd_close+0x77>
+		if (dev->dev_close)
+  801a3f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a42:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a45:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	74 0b                	je     801a59 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a4e:	83 ec 0c             	sub    $0xc,%esp
+  801a51:	56                   	push   %esi
+  801a52:	ff d0                	call   *%eax
+  801a54:	89 c3                	mov    %eax,%ebx
+  801a56:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a59:	83 ec 08             	sub    $0x8,%esp
+  801a5c:	56                   	push   %esi
+  801a5d:	6a 00                	push   $0x0
+  801a5f:	e8 a3 f4 ff ff       	call   800f07 <sys_page_unmap>
+	return r;
+  801a64:	83 c4 10             	add    $0x10,%esp
+  801a67:	eb b5                	jmp    801a1e <fd_close+0x3c>
+
+00801a69 <close>:
+
+int
+close(int fdnum)
+{
+  801a69:	55                   	push   %ebp
+  801a6a:	89 e5                	mov    %esp,%ebp
+  801a6c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a72:	50                   	push   %eax
+  801a73:	ff 75 08             	push   0x8(%ebp)
+  801a76:	e8 a4 fe ff ff       	call   80191f <fd_lookup>
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	79 02                	jns    801a84 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a82:	c9                   	leave
+  801a83:	c3                   	ret
+		return fd_close(fd, 1);
+  801a84:	83 ec 08             	sub    $0x8,%esp
+  801a87:	6a 01                	push   $0x1
+  801a89:	ff 75 f4             	push   -0xc(%ebp)
+  801a8c:	e8 51 ff ff ff       	call   8019e2 <fd_close>
+  801a91:	83 c4 10             	add    $0x10,%esp
+  801a94:	eb ec                	jmp    801a82 <close+0x19>
+
+00801a96 <close_all>:
+
+void
+close_all(void)
+{
+  801a96:	55                   	push   %ebp
+  801a97:	89 e5                	mov    %esp,%ebp
+  801a99:	53                   	push   %ebx
+  801a9a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801aa2:	83 ec 0c             	sub    $0xc,%esp
+  801aa5:	53                   	push   %ebx
+  801aa6:	e8 be ff ff ff       	call   801a69 <close>
+	for (i = 0; i < MAXFD; i++)
+  801aab:	83 c3 01             	add    $0x1,%ebx
+  801aae:	83 c4 10             	add    $0x10,%esp
+  801ab1:	83 fb 20             	cmp    $0x20,%ebx
+  801ab4:	75 ec                	jne    801aa2 <close_all+0xc>
+}
+  801ab6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ab9:	c9                   	leave
+  801aba:	c3                   	ret
+
+00801abb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801abb:	55                   	push   %ebp
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	57                   	push   %edi
+  801abf:	56                   	push   %esi
+  801ac0:	53                   	push   %ebx
+  801ac1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ac4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ac7:	50                   	push   %eax
+  801ac8:	ff 75 08             	push   0x8(%ebp)
+  801acb:	e8 4f fe ff ff       	call   80191f <fd_lookup>
+  801ad0:	89 c3                	mov    %eax,%ebx
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	78 7f                	js     801b58 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801ad9:	83 ec 0c             	sub    $0xc,%esp
+  801adc:	ff 75 0c             	push   0xc(%ebp)
+  801adf:	e8 85 ff ff ff       	call   801a69 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801ae4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ae7:	c1 e6 0c             	shl    $0xc,%esi
+  801aea:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801af0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801af3:	89 3c 24             	mov    %edi,(%esp)
+  801af6:	e8 b7 fd ff ff       	call   8018b2 <fd2data>
+  801afb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801afd:	89 34 24             	mov    %esi,(%esp)
+  801b00:	e8 ad fd ff ff       	call   8018b2 <fd2data>
+  801b05:	83 c4 10             	add    $0x10,%esp
+  801b08:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b0b:	89 d8                	mov    %ebx,%eax
+  801b0d:	c1 e8 16             	shr    $0x16,%eax
+  801b10:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b17:	a8 01                	test   $0x1,%al
+  801b19:	74 11                	je     801b2c <dup+0x71>
+  801b1b:	89 d8                	mov    %ebx,%eax
+  801b1d:	c1 e8 0c             	shr    $0xc,%eax
+  801b20:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b27:	f6 c2 01             	test   $0x1,%dl
+  801b2a:	75 36                	jne    801b62 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b2c:	89 f8                	mov    %edi,%eax
+  801b2e:	c1 e8 0c             	shr    $0xc,%eax
+  801b31:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b38:	83 ec 0c             	sub    $0xc,%esp
+  801b3b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b40:	50                   	push   %eax
+  801b41:	56                   	push   %esi
+  801b42:	6a 00                	push   $0x0
+  801b44:	57                   	push   %edi
+  801b45:	6a 00                	push   $0x0
+  801b47:	e8 4d f3 ff ff       	call   800e99 <sys_page_map>
+  801b4c:	89 c3                	mov    %eax,%ebx
+  801b4e:	83 c4 20             	add    $0x20,%esp
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	78 33                	js     801b88 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b55:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b58:	89 d8                	mov    %ebx,%eax
+  801b5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b5d:	5b                   	pop    %ebx
+  801b5e:	5e                   	pop    %esi
+  801b5f:	5f                   	pop    %edi
+  801b60:	5d                   	pop    %ebp
+  801b61:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b62:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b69:	83 ec 0c             	sub    $0xc,%esp
+  801b6c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b71:	50                   	push   %eax
+  801b72:	ff 75 d4             	push   -0x2c(%ebp)
+  801b75:	6a 00                	push   $0x0
+  801b77:	53                   	push   %ebx
+  801b78:	6a 00                	push   $0x0
+  801b7a:	e8 1a f3 ff ff       	call   800e99 <sys_page_map>
+  801b7f:	89 c3                	mov    %eax,%ebx
+  801b81:	83 c4 20             	add    $0x20,%esp
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	79 a4                	jns    801b2c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b88:	83 ec 08             	sub    $0x8,%esp
+  801b8b:	56                   	push   %esi
+  801b8c:	6a 00                	push   $0x0
+  801b8e:	e8 74 f3 ff ff       	call   800f07 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b93:	83 c4 08             	add    $0x8,%esp
+  801b96:	ff 75 d4             	push   -0x2c(%ebp)
+  801b99:	6a 00                	push   $0x0
+  801b9b:	e8 67 f3 ff ff       	call   800f07 <sys_page_unmap>
+	return r;
+  801ba0:	83 c4 10             	add    $0x10,%esp
+  801ba3:	eb b3                	jmp    801b58 <dup+0x9d>
+
+00801ba5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ba5:	55                   	push   %ebp
+  801ba6:	89 e5                	mov    %esp,%ebp
+  801ba8:	56                   	push   %esi
+  801ba9:	53                   	push   %ebx
+  801baa:	83 ec 18             	sub    $0x18,%esp
+  801bad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bb0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bb3:	50                   	push   %eax
+  801bb4:	53                   	push   %ebx
+  801bb5:	e8 65 fd ff ff       	call   80191f <fd_lookup>
+  801bba:	83 c4 10             	add    $0x10,%esp
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	78 3c                	js     801bfd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bc1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bc4:	83 ec 08             	sub    $0x8,%esp
+  801bc7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bca:	50                   	push   %eax
+  801bcb:	ff 36                	push   (%esi)
+  801bcd:	e8 9d fd ff ff       	call   80196f <dev_lookup>
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	78 24                	js     801bfd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bd9:	8b 46 08             	mov    0x8(%esi),%eax
+  801bdc:	83 e0 03             	and    $0x3,%eax
+  801bdf:	83 f8 01             	cmp    $0x1,%eax
+  801be2:	74 20                	je     801c04 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801be4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801be7:	8b 40 08             	mov    0x8(%eax),%eax
+  801bea:	85 c0                	test   %eax,%eax
+  801bec:	74 57                	je     801c45 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bee:	83 ec 04             	sub    $0x4,%esp
+  801bf1:	ff 75 10             	push   0x10(%ebp)
+  801bf4:	ff 75 0c             	push   0xc(%ebp)
+  801bf7:	56                   	push   %esi
+  801bf8:	ff d0                	call   *%eax
+  801bfa:	83 c4 10             	add    $0x10,%esp
+}
+  801bfd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c00:	5b                   	pop    %ebx
+  801c01:	5e                   	pop    %esi
+  801c02:	5d                   	pop    %ebp
+  801c03:	c3                   	ret
+  801c04:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c06:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c0b:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c11:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c16:	76 1c                	jbe    801c34 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c18:	8b 42 48             	mov    0x48(%edx),%eax
+  801c1b:	83 ec 04             	sub    $0x4,%esp
+  801c1e:	53                   	push   %ebx
+  801c1f:	50                   	push   %eax
+  801c20:	68 19 32 80 00       	push   $0x803219
+  801c25:	e8 c2 e6 ff ff       	call   8002ec <cprintf>
+		return -E_INVAL;
+  801c2a:	83 c4 10             	add    $0x10,%esp
+  801c2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c32:	eb c9                	jmp    801bfd <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c34:	c1 e8 10             	shr    $0x10,%eax
+  801c37:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c3d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c43:	eb d3                	jmp    801c18 <read+0x73>
+		return -E_NOT_SUPP;
+  801c45:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c4a:	eb b1                	jmp    801bfd <read+0x58>
+
+00801c4c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c4c:	55                   	push   %ebp
+  801c4d:	89 e5                	mov    %esp,%ebp
+  801c4f:	57                   	push   %edi
+  801c50:	56                   	push   %esi
+  801c51:	53                   	push   %ebx
+  801c52:	83 ec 0c             	sub    $0xc,%esp
+  801c55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c58:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c60:	eb 02                	jmp    801c64 <readn+0x18>
+  801c62:	01 c3                	add    %eax,%ebx
+  801c64:	39 f3                	cmp    %esi,%ebx
+  801c66:	73 21                	jae    801c89 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c68:	83 ec 04             	sub    $0x4,%esp
+  801c6b:	89 f0                	mov    %esi,%eax
+  801c6d:	29 d8                	sub    %ebx,%eax
+  801c6f:	50                   	push   %eax
+  801c70:	89 d8                	mov    %ebx,%eax
+  801c72:	03 45 0c             	add    0xc(%ebp),%eax
+  801c75:	50                   	push   %eax
+  801c76:	57                   	push   %edi
+  801c77:	e8 29 ff ff ff       	call   801ba5 <read>
+		if (m < 0)
+  801c7c:	83 c4 10             	add    $0x10,%esp
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	78 04                	js     801c87 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c83:	75 dd                	jne    801c62 <readn+0x16>
+  801c85:	eb 02                	jmp    801c89 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c87:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c89:	89 d8                	mov    %ebx,%eax
+  801c8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c8e:	5b                   	pop    %ebx
+  801c8f:	5e                   	pop    %esi
+  801c90:	5f                   	pop    %edi
+  801c91:	5d                   	pop    %ebp
+  801c92:	c3                   	ret
+
+00801c93 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c93:	55                   	push   %ebp
+  801c94:	89 e5                	mov    %esp,%ebp
+  801c96:	56                   	push   %esi
+  801c97:	53                   	push   %ebx
+  801c98:	83 ec 18             	sub    $0x18,%esp
+  801c9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c9e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca1:	50                   	push   %eax
+  801ca2:	53                   	push   %ebx
+  801ca3:	e8 77 fc ff ff       	call   80191f <fd_lookup>
+  801ca8:	83 c4 10             	add    $0x10,%esp
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	78 37                	js     801ce6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801caf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cb2:	83 ec 08             	sub    $0x8,%esp
+  801cb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb8:	50                   	push   %eax
+  801cb9:	ff 36                	push   (%esi)
+  801cbb:	e8 af fc ff ff       	call   80196f <dev_lookup>
+  801cc0:	83 c4 10             	add    $0x10,%esp
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 1f                	js     801ce6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cc7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ccb:	74 20                	je     801ced <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ccd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cd3:	85 c0                	test   %eax,%eax
+  801cd5:	74 57                	je     801d2e <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801cd7:	83 ec 04             	sub    $0x4,%esp
+  801cda:	ff 75 10             	push   0x10(%ebp)
+  801cdd:	ff 75 0c             	push   0xc(%ebp)
+  801ce0:	56                   	push   %esi
+  801ce1:	ff d0                	call   *%eax
+  801ce3:	83 c4 10             	add    $0x10,%esp
+}
+  801ce6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce9:	5b                   	pop    %ebx
+  801cea:	5e                   	pop    %esi
+  801ceb:	5d                   	pop    %ebp
+  801cec:	c3                   	ret
+  801ced:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cef:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cf4:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cfa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cff:	76 1c                	jbe    801d1d <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d01:	8b 42 48             	mov    0x48(%edx),%eax
+  801d04:	83 ec 04             	sub    $0x4,%esp
+  801d07:	53                   	push   %ebx
+  801d08:	50                   	push   %eax
+  801d09:	68 35 32 80 00       	push   $0x803235
+  801d0e:	e8 d9 e5 ff ff       	call   8002ec <cprintf>
+		return -E_INVAL;
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1b:	eb c9                	jmp    801ce6 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d1d:	c1 e8 10             	shr    $0x10,%eax
+  801d20:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d26:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d2c:	eb d3                	jmp    801d01 <write+0x6e>
+		return -E_NOT_SUPP;
+  801d2e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d33:	eb b1                	jmp    801ce6 <write+0x53>
+
+00801d35 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d35:	55                   	push   %ebp
+  801d36:	89 e5                	mov    %esp,%ebp
+  801d38:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3e:	50                   	push   %eax
+  801d3f:	ff 75 08             	push   0x8(%ebp)
+  801d42:	e8 d8 fb ff ff       	call   80191f <fd_lookup>
+  801d47:	83 c4 10             	add    $0x10,%esp
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	78 0e                	js     801d5c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d54:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d5c:	c9                   	leave
+  801d5d:	c3                   	ret
+
+00801d5e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	56                   	push   %esi
+  801d62:	53                   	push   %ebx
+  801d63:	83 ec 18             	sub    $0x18,%esp
+  801d66:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d69:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d6c:	50                   	push   %eax
+  801d6d:	53                   	push   %ebx
+  801d6e:	e8 ac fb ff ff       	call   80191f <fd_lookup>
+  801d73:	83 c4 10             	add    $0x10,%esp
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 34                	js     801dae <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d7a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d7d:	83 ec 08             	sub    $0x8,%esp
+  801d80:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d83:	50                   	push   %eax
+  801d84:	ff 36                	push   (%esi)
+  801d86:	e8 e4 fb ff ff       	call   80196f <dev_lookup>
+  801d8b:	83 c4 10             	add    $0x10,%esp
+  801d8e:	85 c0                	test   %eax,%eax
+  801d90:	78 1c                	js     801dae <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d92:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d96:	74 1d                	je     801db5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d9b:	8b 40 18             	mov    0x18(%eax),%eax
+  801d9e:	85 c0                	test   %eax,%eax
+  801da0:	74 54                	je     801df6 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801da2:	83 ec 08             	sub    $0x8,%esp
+  801da5:	ff 75 0c             	push   0xc(%ebp)
+  801da8:	56                   	push   %esi
+  801da9:	ff d0                	call   *%eax
+  801dab:	83 c4 10             	add    $0x10,%esp
+}
+  801dae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db1:	5b                   	pop    %ebx
+  801db2:	5e                   	pop    %esi
+  801db3:	5d                   	pop    %ebp
+  801db4:	c3                   	ret
+  801db5:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801db7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801dbc:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dc2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801dc7:	76 1c                	jbe    801de5 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801dc9:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dcc:	83 ec 04             	sub    $0x4,%esp
+  801dcf:	53                   	push   %ebx
+  801dd0:	50                   	push   %eax
+  801dd1:	68 f8 31 80 00       	push   $0x8031f8
+  801dd6:	e8 11 e5 ff ff       	call   8002ec <cprintf>
+		return -E_INVAL;
+  801ddb:	83 c4 10             	add    $0x10,%esp
+  801dde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de3:	eb c9                	jmp    801dae <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801de5:	c1 e8 10             	shr    $0x10,%eax
+  801de8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dee:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801df4:	eb d3                	jmp    801dc9 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801df6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dfb:	eb b1                	jmp    801dae <ftruncate+0x50>
+
+00801dfd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dfd:	55                   	push   %ebp
+  801dfe:	89 e5                	mov    %esp,%ebp
+  801e00:	56                   	push   %esi
+  801e01:	53                   	push   %ebx
+  801e02:	83 ec 18             	sub    $0x18,%esp
+  801e05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e08:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e0b:	50                   	push   %eax
+  801e0c:	ff 75 08             	push   0x8(%ebp)
+  801e0f:	e8 0b fb ff ff       	call   80191f <fd_lookup>
+  801e14:	83 c4 10             	add    $0x10,%esp
+  801e17:	85 c0                	test   %eax,%eax
+  801e19:	78 49                	js     801e64 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e1b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e1e:	83 ec 08             	sub    $0x8,%esp
+  801e21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e24:	50                   	push   %eax
+  801e25:	ff 36                	push   (%esi)
+  801e27:	e8 43 fb ff ff       	call   80196f <dev_lookup>
+  801e2c:	83 c4 10             	add    $0x10,%esp
+  801e2f:	85 c0                	test   %eax,%eax
+  801e31:	78 31                	js     801e64 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e36:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e3a:	74 2f                	je     801e6b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e3c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e3f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e46:	00 00 00 
+	stat->st_isdir = 0;
+  801e49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e50:	00 00 00 
+	stat->st_dev = dev;
+  801e53:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e59:	83 ec 08             	sub    $0x8,%esp
+  801e5c:	53                   	push   %ebx
+  801e5d:	56                   	push   %esi
+  801e5e:	ff 50 14             	call   *0x14(%eax)
+  801e61:	83 c4 10             	add    $0x10,%esp
+}
+  801e64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e67:	5b                   	pop    %ebx
+  801e68:	5e                   	pop    %esi
+  801e69:	5d                   	pop    %ebp
+  801e6a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e6b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e70:	eb f2                	jmp    801e64 <fstat+0x67>
+
+00801e72 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	56                   	push   %esi
+  801e76:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e77:	83 ec 08             	sub    $0x8,%esp
+  801e7a:	6a 00                	push   $0x0
+  801e7c:	ff 75 08             	push   0x8(%ebp)
+  801e7f:	e8 e4 01 00 00       	call   802068 <open>
+  801e84:	89 c3                	mov    %eax,%ebx
+  801e86:	83 c4 10             	add    $0x10,%esp
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	78 1b                	js     801ea8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e8d:	83 ec 08             	sub    $0x8,%esp
+  801e90:	ff 75 0c             	push   0xc(%ebp)
+  801e93:	50                   	push   %eax
+  801e94:	e8 64 ff ff ff       	call   801dfd <fstat>
+  801e99:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e9b:	89 1c 24             	mov    %ebx,(%esp)
+  801e9e:	e8 c6 fb ff ff       	call   801a69 <close>
+	return r;
+  801ea3:	83 c4 10             	add    $0x10,%esp
+  801ea6:	89 f3                	mov    %esi,%ebx
+}
+  801ea8:	89 d8                	mov    %ebx,%eax
+  801eaa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ead:	5b                   	pop    %ebx
+  801eae:	5e                   	pop    %esi
+  801eaf:	5d                   	pop    %ebp
+  801eb0:	c3                   	ret
+
+00801eb1 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801eb1:	55                   	push   %ebp
+  801eb2:	89 e5                	mov    %esp,%ebp
+  801eb4:	56                   	push   %esi
+  801eb5:	53                   	push   %ebx
+  801eb6:	89 c6                	mov    %eax,%esi
+  801eb8:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801eba:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  801ec1:	74 27                	je     801eea <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ec3:	6a 07                	push   $0x7
+  801ec5:	68 00 a0 80 00       	push   $0x80a000
+  801eca:	56                   	push   %esi
+  801ecb:	ff 35 00 90 80 00    	push   0x809000
+  801ed1:	e8 c6 0d 00 00       	call   802c9c <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ed6:	83 c4 0c             	add    $0xc,%esp
+  801ed9:	6a 00                	push   $0x0
+  801edb:	53                   	push   %ebx
+  801edc:	6a 00                	push   $0x0
+  801ede:	e8 a1 0d 00 00       	call   802c84 <ipc_recv>
+}
+  801ee3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee6:	5b                   	pop    %ebx
+  801ee7:	5e                   	pop    %esi
+  801ee8:	5d                   	pop    %ebp
+  801ee9:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801eea:	83 ec 0c             	sub    $0xc,%esp
+  801eed:	6a 01                	push   $0x1
+  801eef:	e8 fc 0d 00 00       	call   802cf0 <ipc_find_env>
+  801ef4:	a3 00 90 80 00       	mov    %eax,0x809000
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	eb c5                	jmp    801ec3 <fsipc+0x12>
+
+00801efe <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801efe:	55                   	push   %ebp
+  801eff:	89 e5                	mov    %esp,%ebp
+  801f01:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f07:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f0a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.set_size.req_size = newsize;
+  801f0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f12:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f21:	e8 8b ff ff ff       	call   801eb1 <fsipc>
+}
+  801f26:	c9                   	leave
+  801f27:	c3                   	ret
+
+00801f28 <devfile_flush>:
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f31:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f34:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f43:	e8 69 ff ff ff       	call   801eb1 <fsipc>
+}
+  801f48:	c9                   	leave
+  801f49:	c3                   	ret
+
+00801f4a <devfile_stat>:
+{
+  801f4a:	55                   	push   %ebp
+  801f4b:	89 e5                	mov    %esp,%ebp
+  801f4d:	53                   	push   %ebx
+  801f4e:	83 ec 04             	sub    $0x4,%esp
+  801f51:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f57:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f5a:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f64:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f69:	e8 43 ff ff ff       	call   801eb1 <fsipc>
+  801f6e:	85 c0                	test   %eax,%eax
+  801f70:	78 2c                	js     801f9e <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f72:	83 ec 08             	sub    $0x8,%esp
+  801f75:	68 00 a0 80 00       	push   $0x80a000
+  801f7a:	53                   	push   %ebx
+  801f7b:	e8 b4 e9 ff ff       	call   800934 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f80:	a1 80 a0 80 00       	mov    0x80a080,%eax
+  801f85:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f8b:	a1 84 a0 80 00       	mov    0x80a084,%eax
+  801f90:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f96:	83 c4 10             	add    $0x10,%esp
+  801f99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fa1:	c9                   	leave
+  801fa2:	c3                   	ret
+
+00801fa3 <devfile_write>:
+{
+  801fa3:	55                   	push   %ebp
+  801fa4:	89 e5                	mov    %esp,%ebp
+  801fa6:	83 ec 0c             	sub    $0xc,%esp
+  801fa9:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fac:	8b 55 08             	mov    0x8(%ebp),%edx
+  801faf:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fb2:	89 15 00 a0 80 00    	mov    %edx,0x80a000
+	fsipcbuf.write.req_n = n;
+  801fb8:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801fbd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fc2:	39 d0                	cmp    %edx,%eax
+  801fc4:	0f 47 c2             	cmova  %edx,%eax
+  801fc7:	50                   	push   %eax
+  801fc8:	ff 75 0c             	push   0xc(%ebp)
+  801fcb:	68 08 a0 80 00       	push   $0x80a008
+  801fd0:	e8 e5 ea ff ff       	call   800aba <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801fd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fda:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fdf:	e8 cd fe ff ff       	call   801eb1 <fsipc>
+}
+  801fe4:	c9                   	leave
+  801fe5:	c3                   	ret
+
+00801fe6 <devfile_read>:
+{
+  801fe6:	55                   	push   %ebp
+  801fe7:	89 e5                	mov    %esp,%ebp
+  801fe9:	56                   	push   %esi
+  801fea:	53                   	push   %ebx
+  801feb:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ff4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.read.req_n = n;
+  801ff9:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802004:	b8 03 00 00 00       	mov    $0x3,%eax
+  802009:	e8 a3 fe ff ff       	call   801eb1 <fsipc>
+  80200e:	89 c3                	mov    %eax,%ebx
+  802010:	85 c0                	test   %eax,%eax
+  802012:	78 1f                	js     802033 <devfile_read+0x4d>
+	assert(r <= n);
+  802014:	39 c6                	cmp    %eax,%esi
+  802016:	72 24                	jb     80203c <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802018:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80201d:	7f 33                	jg     802052 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80201f:	83 ec 04             	sub    $0x4,%esp
+  802022:	50                   	push   %eax
+  802023:	68 00 a0 80 00       	push   $0x80a000
+  802028:	ff 75 0c             	push   0xc(%ebp)
+  80202b:	e8 8a ea ff ff       	call   800aba <memmove>
+	return r;
+  802030:	83 c4 10             	add    $0x10,%esp
+}
+  802033:	89 d8                	mov    %ebx,%eax
+  802035:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802038:	5b                   	pop    %ebx
+  802039:	5e                   	pop    %esi
+  80203a:	5d                   	pop    %ebp
+  80203b:	c3                   	ret
+	assert(r <= n);
+  80203c:	68 68 32 80 00       	push   $0x803268
+  802041:	68 6f 32 80 00       	push   $0x80326f
+  802046:	6a 76                	push   $0x76
+  802048:	68 84 32 80 00       	push   $0x803284
+  80204d:	e8 bf e1 ff ff       	call   800211 <_panic>
+	assert(r <= PGSIZE);
+  802052:	68 8f 32 80 00       	push   $0x80328f
+  802057:	68 6f 32 80 00       	push   $0x80326f
+  80205c:	6a 77                	push   $0x77
+  80205e:	68 84 32 80 00       	push   $0x803284
+  802063:	e8 a9 e1 ff ff       	call   800211 <_panic>
+
+00802068 <open>:
+{
+  802068:	55                   	push   %ebp
+  802069:	89 e5                	mov    %esp,%ebp
+  80206b:	56                   	push   %esi
+  80206c:	53                   	push   %ebx
+  80206d:	83 ec 1c             	sub    $0x1c,%esp
+  802070:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802073:	56                   	push   %esi
+  802074:	e8 80 e8 ff ff       	call   8008f9 <strlen>
+  802079:	83 c4 10             	add    $0x10,%esp
+  80207c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802081:	7f 6c                	jg     8020ef <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802083:	83 ec 0c             	sub    $0xc,%esp
+  802086:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802089:	50                   	push   %eax
+  80208a:	e8 3a f8 ff ff       	call   8018c9 <fd_alloc>
+  80208f:	89 c3                	mov    %eax,%ebx
+  802091:	83 c4 10             	add    $0x10,%esp
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 3c                	js     8020d4 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802098:	83 ec 08             	sub    $0x8,%esp
+  80209b:	56                   	push   %esi
+  80209c:	68 00 a0 80 00       	push   $0x80a000
+  8020a1:	e8 8e e8 ff ff       	call   800934 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020a9:	a3 00 a4 80 00       	mov    %eax,0x80a400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020ae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020b6:	e8 f6 fd ff ff       	call   801eb1 <fsipc>
+  8020bb:	89 c3                	mov    %eax,%ebx
+  8020bd:	83 c4 10             	add    $0x10,%esp
+  8020c0:	85 c0                	test   %eax,%eax
+  8020c2:	78 19                	js     8020dd <open+0x75>
+	return fd2num(fd);
+  8020c4:	83 ec 0c             	sub    $0xc,%esp
+  8020c7:	ff 75 f4             	push   -0xc(%ebp)
+  8020ca:	e8 d3 f7 ff ff       	call   8018a2 <fd2num>
+  8020cf:	89 c3                	mov    %eax,%ebx
+  8020d1:	83 c4 10             	add    $0x10,%esp
+}
+  8020d4:	89 d8                	mov    %ebx,%eax
+  8020d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d9:	5b                   	pop    %ebx
+  8020da:	5e                   	pop    %esi
+  8020db:	5d                   	pop    %ebp
+  8020dc:	c3                   	ret
+		fd_close(fd, 0);
+  8020dd:	83 ec 08             	sub    $0x8,%esp
+  8020e0:	6a 00                	push   $0x0
+  8020e2:	ff 75 f4             	push   -0xc(%ebp)
+  8020e5:	e8 f8 f8 ff ff       	call   8019e2 <fd_close>
+		return r;
+  8020ea:	83 c4 10             	add    $0x10,%esp
+  8020ed:	eb e5                	jmp    8020d4 <open+0x6c>
+		return -E_BAD_PATH;
+  8020ef:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020f4:	eb de                	jmp    8020d4 <open+0x6c>
+
+008020f6 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802101:	b8 08 00 00 00       	mov    $0x8,%eax
+  802106:	e8 a6 fd ff ff       	call   801eb1 <fsipc>
+}
+  80210b:	c9                   	leave
+  80210c:	c3                   	ret
+
+0080210d <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  80210d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802111:	7f 01                	jg     802114 <writebuf+0x7>
+  802113:	c3                   	ret
+{
+  802114:	55                   	push   %ebp
+  802115:	89 e5                	mov    %esp,%ebp
+  802117:	53                   	push   %ebx
+  802118:	83 ec 08             	sub    $0x8,%esp
+  80211b:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80211d:	ff 70 04             	push   0x4(%eax)
+  802120:	8d 40 10             	lea    0x10(%eax),%eax
+  802123:	50                   	push   %eax
+  802124:	ff 33                	push   (%ebx)
+  802126:	e8 68 fb ff ff       	call   801c93 <write>
+		if (result > 0)
+  80212b:	83 c4 10             	add    $0x10,%esp
+  80212e:	85 c0                	test   %eax,%eax
+  802130:	7e 03                	jle    802135 <writebuf+0x28>
+			b->result += result;
+  802132:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802135:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802138:	74 0d                	je     802147 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  80213a:	85 c0                	test   %eax,%eax
+  80213c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802141:	0f 4f c2             	cmovg  %edx,%eax
+  802144:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214a:	c9                   	leave
+  80214b:	c3                   	ret
+
+0080214c <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80214c:	55                   	push   %ebp
+  80214d:	89 e5                	mov    %esp,%ebp
+  80214f:	53                   	push   %ebx
+  802150:	83 ec 04             	sub    $0x4,%esp
+  802153:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802156:	8b 53 04             	mov    0x4(%ebx),%edx
+  802159:	8d 42 01             	lea    0x1(%edx),%eax
+  80215c:	89 43 04             	mov    %eax,0x4(%ebx)
+  80215f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802162:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802166:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80216b:	74 05                	je     802172 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80216d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802170:	c9                   	leave
+  802171:	c3                   	ret
+		writebuf(b);
+  802172:	89 d8                	mov    %ebx,%eax
+  802174:	e8 94 ff ff ff       	call   80210d <writebuf>
+		b->idx = 0;
+  802179:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802180:	eb eb                	jmp    80216d <putch+0x21>
+
+00802182 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802182:	55                   	push   %ebp
+  802183:	89 e5                	mov    %esp,%ebp
+  802185:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80218b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218e:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802194:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80219b:	00 00 00 
+	b.result = 0;
+  80219e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8021a5:	00 00 00 
+	b.error = 1;
+  8021a8:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8021af:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8021b2:	ff 75 10             	push   0x10(%ebp)
+  8021b5:	ff 75 0c             	push   0xc(%ebp)
+  8021b8:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8021be:	50                   	push   %eax
+  8021bf:	68 4c 21 80 00       	push   $0x80214c
+  8021c4:	e8 01 e2 ff ff       	call   8003ca <vprintfmt>
+	if (b.idx > 0)
+  8021c9:	83 c4 10             	add    $0x10,%esp
+  8021cc:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8021d3:	7f 12                	jg     8021e7 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8021d5:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8021db:	85 c0                	test   %eax,%eax
+  8021dd:	75 06                	jne    8021e5 <vfprintf+0x63>
+  8021df:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8021e5:	c9                   	leave
+  8021e6:	c3                   	ret
+		writebuf(&b);
+  8021e7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8021ed:	e8 1b ff ff ff       	call   80210d <writebuf>
+  8021f2:	eb e1                	jmp    8021d5 <vfprintf+0x53>
+
+008021f4 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8021f4:	55                   	push   %ebp
+  8021f5:	89 e5                	mov    %esp,%ebp
+  8021f7:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8021fa:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8021fd:	50                   	push   %eax
+  8021fe:	ff 75 0c             	push   0xc(%ebp)
+  802201:	ff 75 08             	push   0x8(%ebp)
+  802204:	e8 79 ff ff ff       	call   802182 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802209:	c9                   	leave
+  80220a:	c3                   	ret
+
+0080220b <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802211:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802214:	50                   	push   %eax
+  802215:	ff 75 08             	push   0x8(%ebp)
+  802218:	6a 01                	push   $0x1
+  80221a:	e8 63 ff ff ff       	call   802182 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80221f:	c9                   	leave
+  802220:	c3                   	ret
+
+00802221 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802221:	55                   	push   %ebp
+  802222:	89 e5                	mov    %esp,%ebp
+  802224:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802227:	68 9b 32 80 00       	push   $0x80329b
+  80222c:	ff 75 0c             	push   0xc(%ebp)
+  80222f:	e8 00 e7 ff ff       	call   800934 <strcpy>
+	return 0;
+}
+  802234:	b8 00 00 00 00       	mov    $0x0,%eax
+  802239:	c9                   	leave
+  80223a:	c3                   	ret
+
+0080223b <devsock_close>:
+{
+  80223b:	55                   	push   %ebp
+  80223c:	89 e5                	mov    %esp,%ebp
+  80223e:	53                   	push   %ebx
+  80223f:	83 ec 10             	sub    $0x10,%esp
+  802242:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802245:	53                   	push   %ebx
+  802246:	e8 e4 0a 00 00       	call   802d2f <pageref>
+  80224b:	89 c2                	mov    %eax,%edx
+  80224d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802250:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802255:	83 fa 01             	cmp    $0x1,%edx
+  802258:	74 05                	je     80225f <devsock_close+0x24>
+}
+  80225a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225d:	c9                   	leave
+  80225e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80225f:	83 ec 0c             	sub    $0xc,%esp
+  802262:	ff 73 0c             	push   0xc(%ebx)
+  802265:	e8 b7 02 00 00       	call   802521 <nsipc_close>
+  80226a:	83 c4 10             	add    $0x10,%esp
+  80226d:	eb eb                	jmp    80225a <devsock_close+0x1f>
+
+0080226f <devsock_write>:
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802275:	6a 00                	push   $0x0
+  802277:	ff 75 10             	push   0x10(%ebp)
+  80227a:	ff 75 0c             	push   0xc(%ebp)
+  80227d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802280:	ff 70 0c             	push   0xc(%eax)
+  802283:	e8 79 03 00 00       	call   802601 <nsipc_send>
+}
+  802288:	c9                   	leave
+  802289:	c3                   	ret
+
+0080228a <devsock_read>:
+{
+  80228a:	55                   	push   %ebp
+  80228b:	89 e5                	mov    %esp,%ebp
+  80228d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802290:	6a 00                	push   $0x0
+  802292:	ff 75 10             	push   0x10(%ebp)
+  802295:	ff 75 0c             	push   0xc(%ebp)
+  802298:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229b:	ff 70 0c             	push   0xc(%eax)
+  80229e:	e8 ef 02 00 00       	call   802592 <nsipc_recv>
+}
+  8022a3:	c9                   	leave
+  8022a4:	c3                   	ret
+
+008022a5 <fd2sockid>:
+{
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8022ab:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022ae:	52                   	push   %edx
+  8022af:	50                   	push   %eax
+  8022b0:	e8 6a f6 ff ff       	call   80191f <fd_lookup>
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	85 c0                	test   %eax,%eax
+  8022ba:	78 10                	js     8022cc <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8022bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022bf:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022c5:	39 08                	cmp    %ecx,(%eax)
+  8022c7:	75 05                	jne    8022ce <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8022c9:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8022cc:	c9                   	leave
+  8022cd:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022ce:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022d3:	eb f7                	jmp    8022cc <fd2sockid+0x27>
+
+008022d5 <alloc_sockfd>:
+{
+  8022d5:	55                   	push   %ebp
+  8022d6:	89 e5                	mov    %esp,%ebp
+  8022d8:	56                   	push   %esi
+  8022d9:	53                   	push   %ebx
+  8022da:	83 ec 1c             	sub    $0x1c,%esp
+  8022dd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8022df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e2:	50                   	push   %eax
+  8022e3:	e8 e1 f5 ff ff       	call   8018c9 <fd_alloc>
+  8022e8:	89 c3                	mov    %eax,%ebx
+  8022ea:	83 c4 10             	add    $0x10,%esp
+  8022ed:	85 c0                	test   %eax,%eax
+  8022ef:	78 43                	js     802334 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8022f1:	83 ec 04             	sub    $0x4,%esp
+  8022f4:	68 07 04 00 00       	push   $0x407
+  8022f9:	ff 75 f4             	push   -0xc(%ebp)
+  8022fc:	6a 00                	push   $0x0
+  8022fe:	e8 29 eb ff ff       	call   800e2c <sys_page_alloc>
+  802303:	89 c3                	mov    %eax,%ebx
+  802305:	83 c4 10             	add    $0x10,%esp
+  802308:	85 c0                	test   %eax,%eax
+  80230a:	78 28                	js     802334 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80230c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80230f:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802315:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80231a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802321:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802324:	83 ec 0c             	sub    $0xc,%esp
+  802327:	50                   	push   %eax
+  802328:	e8 75 f5 ff ff       	call   8018a2 <fd2num>
+  80232d:	89 c3                	mov    %eax,%ebx
+  80232f:	83 c4 10             	add    $0x10,%esp
+  802332:	eb 0c                	jmp    802340 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802334:	83 ec 0c             	sub    $0xc,%esp
+  802337:	56                   	push   %esi
+  802338:	e8 e4 01 00 00       	call   802521 <nsipc_close>
+		return r;
+  80233d:	83 c4 10             	add    $0x10,%esp
+}
+  802340:	89 d8                	mov    %ebx,%eax
+  802342:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802345:	5b                   	pop    %ebx
+  802346:	5e                   	pop    %esi
+  802347:	5d                   	pop    %ebp
+  802348:	c3                   	ret
+
+00802349 <accept>:
+{
+  802349:	55                   	push   %ebp
+  80234a:	89 e5                	mov    %esp,%ebp
+  80234c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80234f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802352:	e8 4e ff ff ff       	call   8022a5 <fd2sockid>
+  802357:	85 c0                	test   %eax,%eax
+  802359:	78 1b                	js     802376 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80235b:	83 ec 04             	sub    $0x4,%esp
+  80235e:	ff 75 10             	push   0x10(%ebp)
+  802361:	ff 75 0c             	push   0xc(%ebp)
+  802364:	50                   	push   %eax
+  802365:	e8 0e 01 00 00       	call   802478 <nsipc_accept>
+  80236a:	83 c4 10             	add    $0x10,%esp
+  80236d:	85 c0                	test   %eax,%eax
+  80236f:	78 05                	js     802376 <accept+0x2d>
+	return alloc_sockfd(r);
+  802371:	e8 5f ff ff ff       	call   8022d5 <alloc_sockfd>
+}
+  802376:	c9                   	leave
+  802377:	c3                   	ret
+
+00802378 <bind>:
+{
+  802378:	55                   	push   %ebp
+  802379:	89 e5                	mov    %esp,%ebp
+  80237b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80237e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802381:	e8 1f ff ff ff       	call   8022a5 <fd2sockid>
+  802386:	85 c0                	test   %eax,%eax
+  802388:	78 12                	js     80239c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80238a:	83 ec 04             	sub    $0x4,%esp
+  80238d:	ff 75 10             	push   0x10(%ebp)
+  802390:	ff 75 0c             	push   0xc(%ebp)
+  802393:	50                   	push   %eax
+  802394:	e8 31 01 00 00       	call   8024ca <nsipc_bind>
+  802399:	83 c4 10             	add    $0x10,%esp
+}
+  80239c:	c9                   	leave
+  80239d:	c3                   	ret
+
+0080239e <shutdown>:
+{
+  80239e:	55                   	push   %ebp
+  80239f:	89 e5                	mov    %esp,%ebp
+  8023a1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a7:	e8 f9 fe ff ff       	call   8022a5 <fd2sockid>
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	78 0f                	js     8023bf <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8023b0:	83 ec 08             	sub    $0x8,%esp
+  8023b3:	ff 75 0c             	push   0xc(%ebp)
+  8023b6:	50                   	push   %eax
+  8023b7:	e8 43 01 00 00       	call   8024ff <nsipc_shutdown>
+  8023bc:	83 c4 10             	add    $0x10,%esp
+}
+  8023bf:	c9                   	leave
+  8023c0:	c3                   	ret
+
+008023c1 <connect>:
+{
+  8023c1:	55                   	push   %ebp
+  8023c2:	89 e5                	mov    %esp,%ebp
+  8023c4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ca:	e8 d6 fe ff ff       	call   8022a5 <fd2sockid>
+  8023cf:	85 c0                	test   %eax,%eax
+  8023d1:	78 12                	js     8023e5 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8023d3:	83 ec 04             	sub    $0x4,%esp
+  8023d6:	ff 75 10             	push   0x10(%ebp)
+  8023d9:	ff 75 0c             	push   0xc(%ebp)
+  8023dc:	50                   	push   %eax
+  8023dd:	e8 59 01 00 00       	call   80253b <nsipc_connect>
+  8023e2:	83 c4 10             	add    $0x10,%esp
+}
+  8023e5:	c9                   	leave
+  8023e6:	c3                   	ret
+
+008023e7 <listen>:
+{
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f0:	e8 b0 fe ff ff       	call   8022a5 <fd2sockid>
+  8023f5:	85 c0                	test   %eax,%eax
+  8023f7:	78 0f                	js     802408 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8023f9:	83 ec 08             	sub    $0x8,%esp
+  8023fc:	ff 75 0c             	push   0xc(%ebp)
+  8023ff:	50                   	push   %eax
+  802400:	e8 6b 01 00 00       	call   802570 <nsipc_listen>
+  802405:	83 c4 10             	add    $0x10,%esp
+}
+  802408:	c9                   	leave
+  802409:	c3                   	ret
+
+0080240a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80240a:	55                   	push   %ebp
+  80240b:	89 e5                	mov    %esp,%ebp
+  80240d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802410:	ff 75 10             	push   0x10(%ebp)
+  802413:	ff 75 0c             	push   0xc(%ebp)
+  802416:	ff 75 08             	push   0x8(%ebp)
+  802419:	e8 41 02 00 00       	call   80265f <nsipc_socket>
+  80241e:	83 c4 10             	add    $0x10,%esp
+  802421:	85 c0                	test   %eax,%eax
+  802423:	78 05                	js     80242a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802425:	e8 ab fe ff ff       	call   8022d5 <alloc_sockfd>
+}
+  80242a:	c9                   	leave
+  80242b:	c3                   	ret
+
+0080242c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80242c:	55                   	push   %ebp
+  80242d:	89 e5                	mov    %esp,%ebp
+  80242f:	53                   	push   %ebx
+  802430:	83 ec 04             	sub    $0x4,%esp
+  802433:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802435:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  80243c:	74 26                	je     802464 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80243e:	6a 07                	push   $0x7
+  802440:	68 00 b0 80 00       	push   $0x80b000
+  802445:	53                   	push   %ebx
+  802446:	ff 35 04 90 80 00    	push   0x809004
+  80244c:	e8 4b 08 00 00       	call   802c9c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802451:	83 c4 0c             	add    $0xc,%esp
+  802454:	6a 00                	push   $0x0
+  802456:	6a 00                	push   $0x0
+  802458:	6a 00                	push   $0x0
+  80245a:	e8 25 08 00 00       	call   802c84 <ipc_recv>
+}
+  80245f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802462:	c9                   	leave
+  802463:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802464:	83 ec 0c             	sub    $0xc,%esp
+  802467:	6a 02                	push   $0x2
+  802469:	e8 82 08 00 00       	call   802cf0 <ipc_find_env>
+  80246e:	a3 04 90 80 00       	mov    %eax,0x809004
+  802473:	83 c4 10             	add    $0x10,%esp
+  802476:	eb c6                	jmp    80243e <nsipc+0x12>
+
+00802478 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802478:	55                   	push   %ebp
+  802479:	89 e5                	mov    %esp,%ebp
+  80247b:	56                   	push   %esi
+  80247c:	53                   	push   %ebx
+  80247d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802480:	8b 45 08             	mov    0x8(%ebp),%eax
+  802483:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802488:	8b 06                	mov    (%esi),%eax
+  80248a:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80248f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802494:	e8 93 ff ff ff       	call   80242c <nsipc>
+  802499:	89 c3                	mov    %eax,%ebx
+  80249b:	85 c0                	test   %eax,%eax
+  80249d:	79 09                	jns    8024a8 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80249f:	89 d8                	mov    %ebx,%eax
+  8024a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024a4:	5b                   	pop    %ebx
+  8024a5:	5e                   	pop    %esi
+  8024a6:	5d                   	pop    %ebp
+  8024a7:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8024a8:	83 ec 04             	sub    $0x4,%esp
+  8024ab:	ff 35 10 b0 80 00    	push   0x80b010
+  8024b1:	68 00 b0 80 00       	push   $0x80b000
+  8024b6:	ff 75 0c             	push   0xc(%ebp)
+  8024b9:	e8 fc e5 ff ff       	call   800aba <memmove>
+		*addrlen = ret->ret_addrlen;
+  8024be:	a1 10 b0 80 00       	mov    0x80b010,%eax
+  8024c3:	89 06                	mov    %eax,(%esi)
+  8024c5:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8024c8:	eb d5                	jmp    80249f <nsipc_accept+0x27>
+
+008024ca <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8024ca:	55                   	push   %ebp
+  8024cb:	89 e5                	mov    %esp,%ebp
+  8024cd:	53                   	push   %ebx
+  8024ce:	83 ec 08             	sub    $0x8,%esp
+  8024d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8024d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d7:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8024dc:	53                   	push   %ebx
+  8024dd:	ff 75 0c             	push   0xc(%ebp)
+  8024e0:	68 04 b0 80 00       	push   $0x80b004
+  8024e5:	e8 d0 e5 ff ff       	call   800aba <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8024ea:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  8024f0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024f5:	e8 32 ff ff ff       	call   80242c <nsipc>
+}
+  8024fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024fd:	c9                   	leave
+  8024fe:	c3                   	ret
+
+008024ff <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8024ff:	55                   	push   %ebp
+  802500:	89 e5                	mov    %esp,%ebp
+  802502:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802505:	8b 45 08             	mov    0x8(%ebp),%eax
+  802508:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  80250d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802510:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  802515:	b8 03 00 00 00       	mov    $0x3,%eax
+  80251a:	e8 0d ff ff ff       	call   80242c <nsipc>
+}
+  80251f:	c9                   	leave
+  802520:	c3                   	ret
+
+00802521 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802527:	8b 45 08             	mov    0x8(%ebp),%eax
+  80252a:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  80252f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802534:	e8 f3 fe ff ff       	call   80242c <nsipc>
+}
+  802539:	c9                   	leave
+  80253a:	c3                   	ret
+
+0080253b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80253b:	55                   	push   %ebp
+  80253c:	89 e5                	mov    %esp,%ebp
+  80253e:	53                   	push   %ebx
+  80253f:	83 ec 08             	sub    $0x8,%esp
+  802542:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802545:	8b 45 08             	mov    0x8(%ebp),%eax
+  802548:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80254d:	53                   	push   %ebx
+  80254e:	ff 75 0c             	push   0xc(%ebp)
+  802551:	68 04 b0 80 00       	push   $0x80b004
+  802556:	e8 5f e5 ff ff       	call   800aba <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80255b:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  802561:	b8 05 00 00 00       	mov    $0x5,%eax
+  802566:	e8 c1 fe ff ff       	call   80242c <nsipc>
+}
+  80256b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80256e:	c9                   	leave
+  80256f:	c3                   	ret
+
+00802570 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802570:	55                   	push   %ebp
+  802571:	89 e5                	mov    %esp,%ebp
+  802573:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802576:	8b 45 08             	mov    0x8(%ebp),%eax
+  802579:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  80257e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802581:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  802586:	b8 06 00 00 00       	mov    $0x6,%eax
+  80258b:	e8 9c fe ff ff       	call   80242c <nsipc>
+}
+  802590:	c9                   	leave
+  802591:	c3                   	ret
+
+00802592 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802592:	55                   	push   %ebp
+  802593:	89 e5                	mov    %esp,%ebp
+  802595:	56                   	push   %esi
+  802596:	53                   	push   %ebx
+  802597:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80259a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80259d:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  8025a2:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  8025a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025ab:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8025b0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025b5:	e8 72 fe ff ff       	call   80242c <nsipc>
+  8025ba:	89 c3                	mov    %eax,%ebx
+  8025bc:	85 c0                	test   %eax,%eax
+  8025be:	78 22                	js     8025e2 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8025c0:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8025c5:	39 c6                	cmp    %eax,%esi
+  8025c7:	0f 4e c6             	cmovle %esi,%eax
+  8025ca:	39 c3                	cmp    %eax,%ebx
+  8025cc:	7f 1d                	jg     8025eb <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8025ce:	83 ec 04             	sub    $0x4,%esp
+  8025d1:	53                   	push   %ebx
+  8025d2:	68 00 b0 80 00       	push   $0x80b000
+  8025d7:	ff 75 0c             	push   0xc(%ebp)
+  8025da:	e8 db e4 ff ff       	call   800aba <memmove>
+  8025df:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8025e2:	89 d8                	mov    %ebx,%eax
+  8025e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025e7:	5b                   	pop    %ebx
+  8025e8:	5e                   	pop    %esi
+  8025e9:	5d                   	pop    %ebp
+  8025ea:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8025eb:	68 a7 32 80 00       	push   $0x8032a7
+  8025f0:	68 6f 32 80 00       	push   $0x80326f
+  8025f5:	6a 62                	push   $0x62
+  8025f7:	68 bc 32 80 00       	push   $0x8032bc
+  8025fc:	e8 10 dc ff ff       	call   800211 <_panic>
+
+00802601 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802601:	55                   	push   %ebp
+  802602:	89 e5                	mov    %esp,%ebp
+  802604:	53                   	push   %ebx
+  802605:	83 ec 04             	sub    $0x4,%esp
+  802608:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80260b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80260e:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  802613:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802619:	7f 2e                	jg     802649 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80261b:	83 ec 04             	sub    $0x4,%esp
+  80261e:	53                   	push   %ebx
+  80261f:	ff 75 0c             	push   0xc(%ebp)
+  802622:	68 0c b0 80 00       	push   $0x80b00c
+  802627:	e8 8e e4 ff ff       	call   800aba <memmove>
+	nsipcbuf.send.req_size = size;
+  80262c:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  802632:	8b 45 14             	mov    0x14(%ebp),%eax
+  802635:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  80263a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80263f:	e8 e8 fd ff ff       	call   80242c <nsipc>
+}
+  802644:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802647:	c9                   	leave
+  802648:	c3                   	ret
+	assert(size < 1600);
+  802649:	68 c8 32 80 00       	push   $0x8032c8
+  80264e:	68 6f 32 80 00       	push   $0x80326f
+  802653:	6a 6d                	push   $0x6d
+  802655:	68 bc 32 80 00       	push   $0x8032bc
+  80265a:	e8 b2 db ff ff       	call   800211 <_panic>
+
+0080265f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80265f:	55                   	push   %ebp
+  802660:	89 e5                	mov    %esp,%ebp
+  802662:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802665:	8b 45 08             	mov    0x8(%ebp),%eax
+  802668:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  80266d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802670:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  802675:	8b 45 10             	mov    0x10(%ebp),%eax
+  802678:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  80267d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802682:	e8 a5 fd ff ff       	call   80242c <nsipc>
+}
+  802687:	c9                   	leave
+  802688:	c3                   	ret
+
+00802689 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802689:	55                   	push   %ebp
+  80268a:	89 e5                	mov    %esp,%ebp
+  80268c:	56                   	push   %esi
+  80268d:	53                   	push   %ebx
+  80268e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802691:	83 ec 0c             	sub    $0xc,%esp
+  802694:	ff 75 08             	push   0x8(%ebp)
+  802697:	e8 16 f2 ff ff       	call   8018b2 <fd2data>
+  80269c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80269e:	83 c4 08             	add    $0x8,%esp
+  8026a1:	68 d4 32 80 00       	push   $0x8032d4
+  8026a6:	53                   	push   %ebx
+  8026a7:	e8 88 e2 ff ff       	call   800934 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8026ac:	8b 46 04             	mov    0x4(%esi),%eax
+  8026af:	2b 06                	sub    (%esi),%eax
+  8026b1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8026b7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026be:	00 00 00 
+	stat->st_dev = &devpipe;
+  8026c1:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8026c8:	40 80 00 
+	return 0;
+}
+  8026cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026d3:	5b                   	pop    %ebx
+  8026d4:	5e                   	pop    %esi
+  8026d5:	5d                   	pop    %ebp
+  8026d6:	c3                   	ret
+
+008026d7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8026d7:	55                   	push   %ebp
+  8026d8:	89 e5                	mov    %esp,%ebp
+  8026da:	53                   	push   %ebx
+  8026db:	83 ec 0c             	sub    $0xc,%esp
+  8026de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8026e1:	53                   	push   %ebx
+  8026e2:	6a 00                	push   $0x0
+  8026e4:	e8 1e e8 ff ff       	call   800f07 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8026e9:	89 1c 24             	mov    %ebx,(%esp)
+  8026ec:	e8 c1 f1 ff ff       	call   8018b2 <fd2data>
+  8026f1:	83 c4 08             	add    $0x8,%esp
+  8026f4:	50                   	push   %eax
+  8026f5:	6a 00                	push   $0x0
+  8026f7:	e8 0b e8 ff ff       	call   800f07 <sys_page_unmap>
+}
+  8026fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ff:	c9                   	leave
+  802700:	c3                   	ret
+
+00802701 <_pipeisclosed>:
+{
+  802701:	55                   	push   %ebp
+  802702:	89 e5                	mov    %esp,%ebp
+  802704:	57                   	push   %edi
+  802705:	56                   	push   %esi
+  802706:	53                   	push   %ebx
+  802707:	83 ec 1c             	sub    $0x1c,%esp
+  80270a:	89 c7                	mov    %eax,%edi
+  80270c:	89 d6                	mov    %edx,%esi
+  80270e:	eb 3c                	jmp    80274c <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802710:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802713:	83 ec 0c             	sub    $0xc,%esp
+  802716:	57                   	push   %edi
+  802717:	e8 13 06 00 00       	call   802d2f <pageref>
+  80271c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80271f:	89 34 24             	mov    %esi,(%esp)
+  802722:	e8 08 06 00 00       	call   802d2f <pageref>
+  802727:	89 c2                	mov    %eax,%edx
+  802729:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80272b:	05 00 00 00 20       	add    $0x20000000,%eax
+  802730:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802733:	8b 0d 08 90 80 00    	mov    0x809008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802739:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80273e:	76 31                	jbe    802771 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802740:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802743:	39 c3                	cmp    %eax,%ebx
+  802745:	74 76                	je     8027bd <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802747:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80274a:	74 36                	je     802782 <_pipeisclosed+0x81>
+  80274c:	89 e0                	mov    %esp,%eax
+  80274e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802753:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802759:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80275e:	77 b0                	ja     802710 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802760:	c1 e8 10             	shr    $0x10,%eax
+  802763:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802769:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80276f:	eb 9f                	jmp    802710 <_pipeisclosed+0xf>
+  802771:	c1 e8 10             	shr    $0x10,%eax
+  802774:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80277a:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802780:	eb be                	jmp    802740 <_pipeisclosed+0x3f>
+  802782:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802784:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802789:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80278f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802794:	76 16                	jbe    8027ac <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802796:	8b 42 58             	mov    0x58(%edx),%eax
+  802799:	6a 01                	push   $0x1
+  80279b:	50                   	push   %eax
+  80279c:	53                   	push   %ebx
+  80279d:	68 db 32 80 00       	push   $0x8032db
+  8027a2:	e8 45 db ff ff       	call   8002ec <cprintf>
+  8027a7:	83 c4 10             	add    $0x10,%esp
+  8027aa:	eb a0                	jmp    80274c <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8027ac:	c1 e8 10             	shr    $0x10,%eax
+  8027af:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027b5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8027bb:	eb d9                	jmp    802796 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8027bd:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8027c0:	0f 94 c0             	sete   %al
+  8027c3:	0f b6 c0             	movzbl %al,%eax
+}
+  8027c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c9:	5b                   	pop    %ebx
+  8027ca:	5e                   	pop    %esi
+  8027cb:	5f                   	pop    %edi
+  8027cc:	5d                   	pop    %ebp
+  8027cd:	c3                   	ret
+
+008027ce <devpipe_write>:
+{
+  8027ce:	55                   	push   %ebp
+  8027cf:	89 e5                	mov    %esp,%ebp
+  8027d1:	57                   	push   %edi
+  8027d2:	56                   	push   %esi
+  8027d3:	53                   	push   %ebx
+  8027d4:	83 ec 28             	sub    $0x28,%esp
+  8027d7:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8027da:	56                   	push   %esi
+  8027db:	e8 d2 f0 ff ff       	call   8018b2 <fd2data>
+  8027e0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8027e2:	83 c4 10             	add    $0x10,%esp
+  8027e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ea:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027ed:	75 09                	jne    8027f8 <devpipe_write+0x2a>
+	return i;
+  8027ef:	89 f8                	mov    %edi,%eax
+  8027f1:	eb 23                	jmp    802816 <devpipe_write+0x48>
+			sys_yield();
+  8027f3:	e8 ee e5 ff ff       	call   800de6 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8027f8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027fb:	8b 0b                	mov    (%ebx),%ecx
+  8027fd:	8d 51 20             	lea    0x20(%ecx),%edx
+  802800:	39 d0                	cmp    %edx,%eax
+  802802:	72 1a                	jb     80281e <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802804:	89 da                	mov    %ebx,%edx
+  802806:	89 f0                	mov    %esi,%eax
+  802808:	e8 f4 fe ff ff       	call   802701 <_pipeisclosed>
+  80280d:	85 c0                	test   %eax,%eax
+  80280f:	74 e2                	je     8027f3 <devpipe_write+0x25>
+				return 0;
+  802811:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802816:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802819:	5b                   	pop    %ebx
+  80281a:	5e                   	pop    %esi
+  80281b:	5f                   	pop    %edi
+  80281c:	5d                   	pop    %ebp
+  80281d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80281e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802821:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802825:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802828:	89 c2                	mov    %eax,%edx
+  80282a:	c1 fa 1f             	sar    $0x1f,%edx
+  80282d:	89 d1                	mov    %edx,%ecx
+  80282f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802832:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802835:	83 e2 1f             	and    $0x1f,%edx
+  802838:	29 ca                	sub    %ecx,%edx
+  80283a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80283e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802842:	83 c0 01             	add    $0x1,%eax
+  802845:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802848:	83 c7 01             	add    $0x1,%edi
+  80284b:	eb 9d                	jmp    8027ea <devpipe_write+0x1c>
+
+0080284d <devpipe_read>:
+{
+  80284d:	55                   	push   %ebp
+  80284e:	89 e5                	mov    %esp,%ebp
+  802850:	57                   	push   %edi
+  802851:	56                   	push   %esi
+  802852:	53                   	push   %ebx
+  802853:	83 ec 18             	sub    $0x18,%esp
+  802856:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802859:	57                   	push   %edi
+  80285a:	e8 53 f0 ff ff       	call   8018b2 <fd2data>
+  80285f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802861:	83 c4 10             	add    $0x10,%esp
+  802864:	be 00 00 00 00       	mov    $0x0,%esi
+  802869:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80286c:	75 13                	jne    802881 <devpipe_read+0x34>
+	return i;
+  80286e:	89 f0                	mov    %esi,%eax
+  802870:	eb 02                	jmp    802874 <devpipe_read+0x27>
+				return i;
+  802872:	89 f0                	mov    %esi,%eax
+}
+  802874:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802877:	5b                   	pop    %ebx
+  802878:	5e                   	pop    %esi
+  802879:	5f                   	pop    %edi
+  80287a:	5d                   	pop    %ebp
+  80287b:	c3                   	ret
+			sys_yield();
+  80287c:	e8 65 e5 ff ff       	call   800de6 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802881:	8b 03                	mov    (%ebx),%eax
+  802883:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802886:	75 18                	jne    8028a0 <devpipe_read+0x53>
+			if (i > 0)
+  802888:	85 f6                	test   %esi,%esi
+  80288a:	75 e6                	jne    802872 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80288c:	89 da                	mov    %ebx,%edx
+  80288e:	89 f8                	mov    %edi,%eax
+  802890:	e8 6c fe ff ff       	call   802701 <_pipeisclosed>
+  802895:	85 c0                	test   %eax,%eax
+  802897:	74 e3                	je     80287c <devpipe_read+0x2f>
+				return 0;
+  802899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289e:	eb d4                	jmp    802874 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8028a0:	99                   	cltd
+  8028a1:	c1 ea 1b             	shr    $0x1b,%edx
+  8028a4:	01 d0                	add    %edx,%eax
+  8028a6:	83 e0 1f             	and    $0x1f,%eax
+  8028a9:	29 d0                	sub    %edx,%eax
+  8028ab:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028b3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8028b6:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8028b9:	83 c6 01             	add    $0x1,%esi
+  8028bc:	eb ab                	jmp    802869 <devpipe_read+0x1c>
+
+008028be <pipe>:
+{
+  8028be:	55                   	push   %ebp
+  8028bf:	89 e5                	mov    %esp,%ebp
+  8028c1:	56                   	push   %esi
+  8028c2:	53                   	push   %ebx
+  8028c3:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8028c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028c9:	50                   	push   %eax
+  8028ca:	e8 fa ef ff ff       	call   8018c9 <fd_alloc>
+  8028cf:	89 c3                	mov    %eax,%ebx
+  8028d1:	83 c4 10             	add    $0x10,%esp
+  8028d4:	85 c0                	test   %eax,%eax
+  8028d6:	0f 88 23 01 00 00    	js     8029ff <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028dc:	83 ec 04             	sub    $0x4,%esp
+  8028df:	68 07 04 00 00       	push   $0x407
+  8028e4:	ff 75 f4             	push   -0xc(%ebp)
+  8028e7:	6a 00                	push   $0x0
+  8028e9:	e8 3e e5 ff ff       	call   800e2c <sys_page_alloc>
+  8028ee:	89 c3                	mov    %eax,%ebx
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	0f 88 04 01 00 00    	js     8029ff <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8028fb:	83 ec 0c             	sub    $0xc,%esp
+  8028fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802901:	50                   	push   %eax
+  802902:	e8 c2 ef ff ff       	call   8018c9 <fd_alloc>
+  802907:	89 c3                	mov    %eax,%ebx
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	0f 88 db 00 00 00    	js     8029ef <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802914:	83 ec 04             	sub    $0x4,%esp
+  802917:	68 07 04 00 00       	push   $0x407
+  80291c:	ff 75 f0             	push   -0x10(%ebp)
+  80291f:	6a 00                	push   $0x0
+  802921:	e8 06 e5 ff ff       	call   800e2c <sys_page_alloc>
+  802926:	89 c3                	mov    %eax,%ebx
+  802928:	83 c4 10             	add    $0x10,%esp
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	0f 88 bc 00 00 00    	js     8029ef <pipe+0x131>
+	va = fd2data(fd0);
+  802933:	83 ec 0c             	sub    $0xc,%esp
+  802936:	ff 75 f4             	push   -0xc(%ebp)
+  802939:	e8 74 ef ff ff       	call   8018b2 <fd2data>
+  80293e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802940:	83 c4 0c             	add    $0xc,%esp
+  802943:	68 07 04 00 00       	push   $0x407
+  802948:	50                   	push   %eax
+  802949:	6a 00                	push   $0x0
+  80294b:	e8 dc e4 ff ff       	call   800e2c <sys_page_alloc>
+  802950:	89 c3                	mov    %eax,%ebx
+  802952:	83 c4 10             	add    $0x10,%esp
+  802955:	85 c0                	test   %eax,%eax
+  802957:	0f 88 82 00 00 00    	js     8029df <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80295d:	83 ec 0c             	sub    $0xc,%esp
+  802960:	ff 75 f0             	push   -0x10(%ebp)
+  802963:	e8 4a ef ff ff       	call   8018b2 <fd2data>
+  802968:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80296f:	50                   	push   %eax
+  802970:	6a 00                	push   $0x0
+  802972:	56                   	push   %esi
+  802973:	6a 00                	push   $0x0
+  802975:	e8 1f e5 ff ff       	call   800e99 <sys_page_map>
+  80297a:	89 c3                	mov    %eax,%ebx
+  80297c:	83 c4 20             	add    $0x20,%esp
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	78 4e                	js     8029d1 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802983:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802988:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80298b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80298d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802990:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802997:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80299a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80299c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80299f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8029a6:	83 ec 0c             	sub    $0xc,%esp
+  8029a9:	ff 75 f4             	push   -0xc(%ebp)
+  8029ac:	e8 f1 ee ff ff       	call   8018a2 <fd2num>
+  8029b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029b4:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8029b6:	83 c4 04             	add    $0x4,%esp
+  8029b9:	ff 75 f0             	push   -0x10(%ebp)
+  8029bc:	e8 e1 ee ff ff       	call   8018a2 <fd2num>
+  8029c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029c4:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8029c7:	83 c4 10             	add    $0x10,%esp
+  8029ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029cf:	eb 2e                	jmp    8029ff <pipe+0x141>
+	sys_page_unmap(0, va);
+  8029d1:	83 ec 08             	sub    $0x8,%esp
+  8029d4:	56                   	push   %esi
+  8029d5:	6a 00                	push   $0x0
+  8029d7:	e8 2b e5 ff ff       	call   800f07 <sys_page_unmap>
+  8029dc:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8029df:	83 ec 08             	sub    $0x8,%esp
+  8029e2:	ff 75 f0             	push   -0x10(%ebp)
+  8029e5:	6a 00                	push   $0x0
+  8029e7:	e8 1b e5 ff ff       	call   800f07 <sys_page_unmap>
+  8029ec:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8029ef:	83 ec 08             	sub    $0x8,%esp
+  8029f2:	ff 75 f4             	push   -0xc(%ebp)
+  8029f5:	6a 00                	push   $0x0
+  8029f7:	e8 0b e5 ff ff       	call   800f07 <sys_page_unmap>
+  8029fc:	83 c4 10             	add    $0x10,%esp
+}
+  8029ff:	89 d8                	mov    %ebx,%eax
+  802a01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a04:	5b                   	pop    %ebx
+  802a05:	5e                   	pop    %esi
+  802a06:	5d                   	pop    %ebp
+  802a07:	c3                   	ret
+
+00802a08 <pipeisclosed>:
+{
+  802a08:	55                   	push   %ebp
+  802a09:	89 e5                	mov    %esp,%ebp
+  802a0b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a11:	50                   	push   %eax
+  802a12:	ff 75 08             	push   0x8(%ebp)
+  802a15:	e8 05 ef ff ff       	call   80191f <fd_lookup>
+  802a1a:	83 c4 10             	add    $0x10,%esp
+  802a1d:	85 c0                	test   %eax,%eax
+  802a1f:	78 18                	js     802a39 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802a21:	83 ec 0c             	sub    $0xc,%esp
+  802a24:	ff 75 f4             	push   -0xc(%ebp)
+  802a27:	e8 86 ee ff ff       	call   8018b2 <fd2data>
+  802a2c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802a2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a31:	e8 cb fc ff ff       	call   802701 <_pipeisclosed>
+  802a36:	83 c4 10             	add    $0x10,%esp
+}
+  802a39:	c9                   	leave
+  802a3a:	c3                   	ret
+
+00802a3b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a40:	c3                   	ret
+
+00802a41 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a41:	55                   	push   %ebp
+  802a42:	89 e5                	mov    %esp,%ebp
+  802a44:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802a47:	68 f3 32 80 00       	push   $0x8032f3
+  802a4c:	ff 75 0c             	push   0xc(%ebp)
+  802a4f:	e8 e0 de ff ff       	call   800934 <strcpy>
+	return 0;
+}
+  802a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a59:	c9                   	leave
+  802a5a:	c3                   	ret
+
+00802a5b <devcons_write>:
+{
+  802a5b:	55                   	push   %ebp
+  802a5c:	89 e5                	mov    %esp,%ebp
+  802a5e:	57                   	push   %edi
+  802a5f:	56                   	push   %esi
+  802a60:	53                   	push   %ebx
+  802a61:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802a67:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802a6c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802a72:	eb 2e                	jmp    802aa2 <devcons_write+0x47>
+		m = n - tot;
+  802a74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a77:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802a79:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a7e:	39 c3                	cmp    %eax,%ebx
+  802a80:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802a83:	83 ec 04             	sub    $0x4,%esp
+  802a86:	53                   	push   %ebx
+  802a87:	89 f0                	mov    %esi,%eax
+  802a89:	03 45 0c             	add    0xc(%ebp),%eax
+  802a8c:	50                   	push   %eax
+  802a8d:	57                   	push   %edi
+  802a8e:	e8 27 e0 ff ff       	call   800aba <memmove>
+		sys_cputs(buf, m);
+  802a93:	83 c4 08             	add    $0x8,%esp
+  802a96:	53                   	push   %ebx
+  802a97:	57                   	push   %edi
+  802a98:	e8 10 e2 ff ff       	call   800cad <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802a9d:	01 de                	add    %ebx,%esi
+  802a9f:	83 c4 10             	add    $0x10,%esp
+  802aa2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802aa5:	72 cd                	jb     802a74 <devcons_write+0x19>
+}
+  802aa7:	89 f0                	mov    %esi,%eax
+  802aa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aac:	5b                   	pop    %ebx
+  802aad:	5e                   	pop    %esi
+  802aae:	5f                   	pop    %edi
+  802aaf:	5d                   	pop    %ebp
+  802ab0:	c3                   	ret
+
+00802ab1 <devcons_read>:
+{
+  802ab1:	55                   	push   %ebp
+  802ab2:	89 e5                	mov    %esp,%ebp
+  802ab4:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802abc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ac0:	75 07                	jne    802ac9 <devcons_read+0x18>
+  802ac2:	eb 1f                	jmp    802ae3 <devcons_read+0x32>
+		sys_yield();
+  802ac4:	e8 1d e3 ff ff       	call   800de6 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802ac9:	e8 23 e2 ff ff       	call   800cf1 <sys_cgetc>
+  802ace:	85 c0                	test   %eax,%eax
+  802ad0:	74 f2                	je     802ac4 <devcons_read+0x13>
+	if (c < 0)
+  802ad2:	78 0f                	js     802ae3 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802ad4:	83 f8 04             	cmp    $0x4,%eax
+  802ad7:	74 0c                	je     802ae5 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802ad9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802adc:	88 02                	mov    %al,(%edx)
+	return 1;
+  802ade:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802ae3:	c9                   	leave
+  802ae4:	c3                   	ret
+		return 0;
+  802ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aea:	eb f7                	jmp    802ae3 <devcons_read+0x32>
+
+00802aec <cputchar>:
+{
+  802aec:	55                   	push   %ebp
+  802aed:	89 e5                	mov    %esp,%ebp
+  802aef:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802af8:	6a 01                	push   $0x1
+  802afa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802afd:	50                   	push   %eax
+  802afe:	e8 aa e1 ff ff       	call   800cad <sys_cputs>
+}
+  802b03:	83 c4 10             	add    $0x10,%esp
+  802b06:	c9                   	leave
+  802b07:	c3                   	ret
+
+00802b08 <getchar>:
+{
+  802b08:	55                   	push   %ebp
+  802b09:	89 e5                	mov    %esp,%ebp
+  802b0b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802b0e:	6a 01                	push   $0x1
+  802b10:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b13:	50                   	push   %eax
+  802b14:	6a 00                	push   $0x0
+  802b16:	e8 8a f0 ff ff       	call   801ba5 <read>
+	if (r < 0)
+  802b1b:	83 c4 10             	add    $0x10,%esp
+  802b1e:	85 c0                	test   %eax,%eax
+  802b20:	78 06                	js     802b28 <getchar+0x20>
+	if (r < 1)
+  802b22:	74 06                	je     802b2a <getchar+0x22>
+	return c;
+  802b24:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+		return -E_EOF;
+  802b2a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802b2f:	eb f7                	jmp    802b28 <getchar+0x20>
+
+00802b31 <iscons>:
+{
+  802b31:	55                   	push   %ebp
+  802b32:	89 e5                	mov    %esp,%ebp
+  802b34:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b3a:	50                   	push   %eax
+  802b3b:	ff 75 08             	push   0x8(%ebp)
+  802b3e:	e8 dc ed ff ff       	call   80191f <fd_lookup>
+  802b43:	83 c4 10             	add    $0x10,%esp
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	78 11                	js     802b5b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802b4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b4d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b53:	39 10                	cmp    %edx,(%eax)
+  802b55:	0f 94 c0             	sete   %al
+  802b58:	0f b6 c0             	movzbl %al,%eax
+}
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+
+00802b5d <opencons>:
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802b63:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b66:	50                   	push   %eax
+  802b67:	e8 5d ed ff ff       	call   8018c9 <fd_alloc>
+  802b6c:	83 c4 10             	add    $0x10,%esp
+  802b6f:	85 c0                	test   %eax,%eax
+  802b71:	78 3a                	js     802bad <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802b73:	83 ec 04             	sub    $0x4,%esp
+  802b76:	68 07 04 00 00       	push   $0x407
+  802b7b:	ff 75 f4             	push   -0xc(%ebp)
+  802b7e:	6a 00                	push   $0x0
+  802b80:	e8 a7 e2 ff ff       	call   800e2c <sys_page_alloc>
+  802b85:	83 c4 10             	add    $0x10,%esp
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	78 21                	js     802bad <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802b8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b8f:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b95:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802b97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b9a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802ba1:	83 ec 0c             	sub    $0xc,%esp
+  802ba4:	50                   	push   %eax
+  802ba5:	e8 f8 ec ff ff       	call   8018a2 <fd2num>
+  802baa:	83 c4 10             	add    $0x10,%esp
+}
+  802bad:	c9                   	leave
+  802bae:	c3                   	ret
+
+00802baf <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802baf:	55                   	push   %ebp
+  802bb0:	89 e5                	mov    %esp,%ebp
+  802bb2:	56                   	push   %esi
+  802bb3:	53                   	push   %ebx
+  802bb4:	8b 75 08             	mov    0x8(%ebp),%esi
+  802bb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802bbd:	85 c0                	test   %eax,%eax
+  802bbf:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802bc4:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802bc7:	83 ec 08             	sub    $0x8,%esp
+  802bca:	ff 75 14             	push   0x14(%ebp)
+  802bcd:	50                   	push   %eax
+  802bce:	e8 6a e6 ff ff       	call   80123d <sys_ipc_recv_until>
+  802bd3:	83 c4 10             	add    $0x10,%esp
+  802bd6:	85 c0                	test   %eax,%eax
+  802bd8:	78 61                	js     802c3b <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802bda:	85 f6                	test   %esi,%esi
+  802bdc:	74 1c                	je     802bfa <ipc_recv_until+0x4b>
+  802bde:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802be0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802be5:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802beb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802bf0:	76 5f                	jbe    802c51 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802bf2:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802bf8:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802bfa:	85 db                	test   %ebx,%ebx
+  802bfc:	74 1c                	je     802c1a <ipc_recv_until+0x6b>
+  802bfe:	89 e0                	mov    %esp,%eax
+  802c00:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c05:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c0b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c10:	76 50                	jbe    802c62 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802c12:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802c18:	89 03                	mov    %eax,(%ebx)
+  802c1a:	89 e0                	mov    %esp,%eax
+  802c1c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c21:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c27:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c2c:	76 45                	jbe    802c73 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802c2e:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802c34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c37:	5b                   	pop    %ebx
+  802c38:	5e                   	pop    %esi
+  802c39:	5d                   	pop    %ebp
+  802c3a:	c3                   	ret
+		if (from_env_store)
+  802c3b:	85 f6                	test   %esi,%esi
+  802c3d:	74 06                	je     802c45 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802c3f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802c45:	85 db                	test   %ebx,%ebx
+  802c47:	74 eb                	je     802c34 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802c49:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802c4f:	eb e3                	jmp    802c34 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802c51:	c1 e8 10             	shr    $0x10,%eax
+  802c54:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c5a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c60:	eb 90                	jmp    802bf2 <ipc_recv_until+0x43>
+  802c62:	c1 e8 10             	shr    $0x10,%eax
+  802c65:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c6b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c71:	eb 9f                	jmp    802c12 <ipc_recv_until+0x63>
+  802c73:	c1 e8 10             	shr    $0x10,%eax
+  802c76:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c7c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c82:	eb aa                	jmp    802c2e <ipc_recv_until+0x7f>
+
+00802c84 <ipc_recv>:
+{
+  802c84:	55                   	push   %ebp
+  802c85:	89 e5                	mov    %esp,%ebp
+  802c87:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802c8a:	6a 00                	push   $0x0
+  802c8c:	ff 75 10             	push   0x10(%ebp)
+  802c8f:	ff 75 0c             	push   0xc(%ebp)
+  802c92:	ff 75 08             	push   0x8(%ebp)
+  802c95:	e8 15 ff ff ff       	call   802baf <ipc_recv_until>
+}
+  802c9a:	c9                   	leave
+  802c9b:	c3                   	ret
+
+00802c9c <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802c9c:	55                   	push   %ebp
+  802c9d:	89 e5                	mov    %esp,%ebp
+  802c9f:	57                   	push   %edi
+  802ca0:	56                   	push   %esi
+  802ca1:	53                   	push   %ebx
+  802ca2:	83 ec 0c             	sub    $0xc,%esp
+  802ca5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ca8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802cab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802cae:	85 db                	test   %ebx,%ebx
+  802cb0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802cb5:	0f 44 d8             	cmove  %eax,%ebx
+  802cb8:	eb 05                	jmp    802cbf <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802cba:	e8 27 e1 ff ff       	call   800de6 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802cbf:	ff 75 14             	push   0x14(%ebp)
+  802cc2:	53                   	push   %ebx
+  802cc3:	56                   	push   %esi
+  802cc4:	57                   	push   %edi
+  802cc5:	e8 bf e4 ff ff       	call   801189 <sys_ipc_try_send>
+  802cca:	83 c4 10             	add    $0x10,%esp
+  802ccd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802cd0:	74 e8                	je     802cba <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802cd2:	85 c0                	test   %eax,%eax
+  802cd4:	78 08                	js     802cde <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cd9:	5b                   	pop    %ebx
+  802cda:	5e                   	pop    %esi
+  802cdb:	5f                   	pop    %edi
+  802cdc:	5d                   	pop    %ebp
+  802cdd:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802cde:	50                   	push   %eax
+  802cdf:	68 ff 32 80 00       	push   $0x8032ff
+  802ce4:	6a 4f                	push   $0x4f
+  802ce6:	68 12 33 80 00       	push   $0x803312
+  802ceb:	e8 21 d5 ff ff       	call   800211 <_panic>
+
+00802cf0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802cf0:	55                   	push   %ebp
+  802cf1:	89 e5                	mov    %esp,%ebp
+  802cf3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802cfb:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802d01:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d07:	8b 52 50             	mov    0x50(%edx),%edx
+  802d0a:	39 ca                	cmp    %ecx,%edx
+  802d0c:	74 11                	je     802d1f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802d0e:	83 c0 01             	add    $0x1,%eax
+  802d11:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802d16:	75 e3                	jne    802cfb <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1d:	eb 0e                	jmp    802d2d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802d1f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d25:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d2a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802d2d:	5d                   	pop    %ebp
+  802d2e:	c3                   	ret
+
+00802d2f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d2f:	55                   	push   %ebp
+  802d30:	89 e5                	mov    %esp,%ebp
+  802d32:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d35:	89 c2                	mov    %eax,%edx
+  802d37:	c1 ea 16             	shr    $0x16,%edx
+  802d3a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802d41:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d46:	f6 c1 01             	test   $0x1,%cl
+  802d49:	74 1a                	je     802d65 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802d4b:	c1 e8 0c             	shr    $0xc,%eax
+  802d4e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802d55:	a8 01                	test   $0x1,%al
+  802d57:	74 0c                	je     802d65 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802d59:	c1 e8 0c             	shr    $0xc,%eax
+  802d5c:	c1 e0 04             	shl    $0x4,%eax
+  802d5f:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802d65:	89 d0                	mov    %edx,%eax
+  802d67:	5d                   	pop    %ebp
+  802d68:	c3                   	ret
@@ -0,0 +1,6486 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 01 00 00       	call   80017b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	8b 75 08             	mov    0x8(%ebp),%esi
+	long n;
+	int r;
+	char c;
+
+	while ((n = read(f, &c, 1)) > 0) {
+  80003e:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+  800041:	eb 1b                	jmp    80005e <num+0x2b>
+		if (bol) {
+			printf("%5d ", ++line);
+			bol = 0;
+		}
+		if ((r = write(1, &c, 1)) != 1)
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	6a 01                	push   $0x1
+  800048:	53                   	push   %ebx
+  800049:	6a 01                	push   $0x1
+  80004b:	e8 71 1c 00 00       	call   801cc1 <write>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	83 f8 01             	cmp    $0x1,%eax
+  800056:	75 4c                	jne    8000a4 <num+0x71>
+			panic("write error copying %s: %e", s, r);
+		if (c == '\n')
+  800058:	80 7d f7 0a          	cmpb   $0xa,-0x9(%ebp)
+  80005c:	74 5e                	je     8000bc <num+0x89>
+	while ((n = read(f, &c, 1)) > 0) {
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	6a 01                	push   $0x1
+  800063:	53                   	push   %ebx
+  800064:	56                   	push   %esi
+  800065:	e8 69 1b 00 00       	call   801bd3 <read>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	85 c0                	test   %eax,%eax
+  80006f:	7e 57                	jle    8000c8 <num+0x95>
+		if (bol) {
+  800071:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800078:	74 c9                	je     800043 <num+0x10>
+			printf("%5d ", ++line);
+  80007a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80007f:	83 c0 01             	add    $0x1,%eax
+  800082:	a3 00 50 80 00       	mov    %eax,0x805000
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	50                   	push   %eax
+  80008b:	68 a0 2d 80 00       	push   $0x802da0
+  800090:	e8 a4 21 00 00       	call   802239 <printf>
+			bol = 0;
+  800095:	c7 05 00 40 80 00 00 	movl   $0x0,0x804000
+  80009c:	00 00 00 
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	eb 9f                	jmp    800043 <num+0x10>
+			panic("write error copying %s: %e", s, r);
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	50                   	push   %eax
+  8000a8:	ff 75 0c             	push   0xc(%ebp)
+  8000ab:	68 a5 2d 80 00       	push   $0x802da5
+  8000b0:	6a 13                	push   $0x13
+  8000b2:	68 c0 2d 80 00       	push   $0x802dc0
+  8000b7:	e8 83 01 00 00       	call   80023f <_panic>
+			bol = 1;
+  8000bc:	c7 05 00 40 80 00 01 	movl   $0x1,0x804000
+  8000c3:	00 00 00 
+  8000c6:	eb 96                	jmp    80005e <num+0x2b>
+	}
+	if (n < 0)
+  8000c8:	78 07                	js     8000d1 <num+0x9e>
+		panic("error reading %s: %e", s, n);
+}
+  8000ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+		panic("error reading %s: %e", s, n);
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	50                   	push   %eax
+  8000d5:	ff 75 0c             	push   0xc(%ebp)
+  8000d8:	68 cb 2d 80 00       	push   $0x802dcb
+  8000dd:	6a 18                	push   $0x18
+  8000df:	68 c0 2d 80 00       	push   $0x802dc0
+  8000e4:	e8 56 01 00 00       	call   80023f <_panic>
+
+008000e9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e9:	55                   	push   %ebp
+  8000ea:	89 e5                	mov    %esp,%ebp
+  8000ec:	57                   	push   %edi
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+	int f, i;
+
+	binaryname = "num";
+  8000f2:	c7 05 04 40 80 00 e0 	movl   $0x802de0,0x804004
+  8000f9:	2d 80 00 
+	if (argc == 1)
+  8000fc:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800100:	74 0d                	je     80010f <umain+0x26>
+  800102:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800105:	8d 70 04             	lea    0x4(%eax),%esi
+		num(0, "<stdin>");
+	else
+		for (i = 1; i < argc; i++) {
+  800108:	bf 01 00 00 00       	mov    $0x1,%edi
+  80010d:	eb 3b                	jmp    80014a <umain+0x61>
+		num(0, "<stdin>");
+  80010f:	83 ec 08             	sub    $0x8,%esp
+  800112:	68 e4 2d 80 00       	push   $0x802de4
+  800117:	6a 00                	push   $0x0
+  800119:	e8 15 ff ff ff       	call   800033 <num>
+  80011e:	83 c4 10             	add    $0x10,%esp
+			else {
+				num(f, argv[i]);
+				close(f);
+			}
+		}
+	exit();
+  800121:	e8 ff 00 00 00       	call   800225 <exit>
+}
+  800126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5f                   	pop    %edi
+  80012c:	5d                   	pop    %ebp
+  80012d:	c3                   	ret
+				num(f, argv[i]);
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	ff 36                	push   (%esi)
+  800133:	50                   	push   %eax
+  800134:	e8 fa fe ff ff       	call   800033 <num>
+				close(f);
+  800139:	89 1c 24             	mov    %ebx,(%esp)
+  80013c:	e8 56 19 00 00       	call   801a97 <close>
+		for (i = 1; i < argc; i++) {
+  800141:	83 c7 01             	add    $0x1,%edi
+  800144:	83 c6 04             	add    $0x4,%esi
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80014d:	7d d2                	jge    800121 <umain+0x38>
+			f = open(argv[i], O_RDONLY);
+  80014f:	83 ec 08             	sub    $0x8,%esp
+  800152:	6a 00                	push   $0x0
+  800154:	ff 36                	push   (%esi)
+  800156:	e8 3b 1f 00 00       	call   802096 <open>
+  80015b:	89 c3                	mov    %eax,%ebx
+			if (f < 0)
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	85 c0                	test   %eax,%eax
+  800162:	79 ca                	jns    80012e <umain+0x45>
+				panic("can't open %s: %e", argv[i], f);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	50                   	push   %eax
+  800168:	ff 36                	push   (%esi)
+  80016a:	68 ec 2d 80 00       	push   $0x802dec
+  80016f:	6a 27                	push   $0x27
+  800171:	68 c0 2d 80 00       	push   $0x802dc0
+  800176:	e8 c4 00 00 00       	call   80023f <_panic>
+
+0080017b <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	57                   	push   %edi
+  80017f:	56                   	push   %esi
+  800180:	53                   	push   %ebx
+  800181:	83 ec 0c             	sub    $0xc,%esp
+  800184:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800187:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80018a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80018f:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800191:	c1 ea 0b             	shr    $0xb,%edx
+  800194:	83 f2 01             	xor    $0x1,%edx
+  800197:	83 e2 01             	and    $0x1,%edx
+  80019a:	88 15 10 50 80 00    	mov    %dl,0x805010
+
+	mainenv = NULL;
+  8001a0:	c7 05 0c 50 80 00 00 	movl   $0x0,0x80500c
+  8001a7:	00 00 00 
+	envid = sys_getenvid();
+  8001aa:	e8 1f 0c 00 00       	call   800dce <sys_getenvid>
+  8001af:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8001b1:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8001b6:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8001bc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8001c2:	8b 52 48             	mov    0x48(%edx),%edx
+  8001c5:	39 ca                	cmp    %ecx,%edx
+  8001c7:	74 27                	je     8001f0 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8001c9:	83 c0 01             	add    $0x1,%eax
+  8001cc:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001d1:	75 e3                	jne    8001b6 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8001d3:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  8001da:	75 24                	jne    800200 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8001dc:	83 ec 04             	sub    $0x4,%esp
+  8001df:	68 00 2e 80 00       	push   $0x802e00
+  8001e4:	6a 23                	push   $0x23
+  8001e6:	68 23 2e 80 00       	push   $0x802e23
+  8001eb:	e8 4f 00 00 00       	call   80023f <_panic>
+			mainenv = &envs[i];
+  8001f0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001f6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001fb:	a3 0c 50 80 00       	mov    %eax,0x80500c
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800200:	85 ff                	test   %edi,%edi
+  800202:	7e 07                	jle    80020b <libmain+0x90>
+		binaryname = argv[0];
+  800204:	8b 06                	mov    (%esi),%eax
+  800206:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  80020b:	83 ec 08             	sub    $0x8,%esp
+  80020e:	56                   	push   %esi
+  80020f:	57                   	push   %edi
+  800210:	e8 d4 fe ff ff       	call   8000e9 <umain>
+
+	// exit gracefully
+	exit();
+  800215:	e8 0b 00 00 00       	call   800225 <exit>
+}
+  80021a:	83 c4 10             	add    $0x10,%esp
+  80021d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800220:	5b                   	pop    %ebx
+  800221:	5e                   	pop    %esi
+  800222:	5f                   	pop    %edi
+  800223:	5d                   	pop    %ebp
+  800224:	c3                   	ret
+
+00800225 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800225:	55                   	push   %ebp
+  800226:	89 e5                	mov    %esp,%ebp
+  800228:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80022b:	e8 94 18 00 00       	call   801ac4 <close_all>
+	sys_env_destroy(0);
+  800230:	83 ec 0c             	sub    $0xc,%esp
+  800233:	6a 00                	push   $0x0
+  800235:	e8 2b 0b 00 00       	call   800d65 <sys_env_destroy>
+}
+  80023a:	83 c4 10             	add    $0x10,%esp
+  80023d:	c9                   	leave
+  80023e:	c3                   	ret
+
+0080023f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80023f:	55                   	push   %ebp
+  800240:	89 e5                	mov    %esp,%ebp
+  800242:	56                   	push   %esi
+  800243:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800244:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800247:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  80024d:	e8 7c 0b 00 00       	call   800dce <sys_getenvid>
+  800252:	83 ec 0c             	sub    $0xc,%esp
+  800255:	ff 75 0c             	push   0xc(%ebp)
+  800258:	ff 75 08             	push   0x8(%ebp)
+  80025b:	56                   	push   %esi
+  80025c:	50                   	push   %eax
+  80025d:	68 3c 2e 80 00       	push   $0x802e3c
+  800262:	e8 b3 00 00 00       	call   80031a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800267:	83 c4 18             	add    $0x18,%esp
+  80026a:	53                   	push   %ebx
+  80026b:	ff 75 10             	push   0x10(%ebp)
+  80026e:	e8 56 00 00 00       	call   8002c9 <vcprintf>
+	cprintf("\n");
+  800273:	c7 04 24 ac 32 80 00 	movl   $0x8032ac,(%esp)
+  80027a:	e8 9b 00 00 00       	call   80031a <cprintf>
+  80027f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800282:	cc                   	int3
+	while (1)
+  800283:	eb fd                	jmp    800282 <_panic+0x43>
+
+00800285 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800285:	55                   	push   %ebp
+  800286:	89 e5                	mov    %esp,%ebp
+  800288:	53                   	push   %ebx
+  800289:	83 ec 04             	sub    $0x4,%esp
+  80028c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80028f:	8b 13                	mov    (%ebx),%edx
+  800291:	8d 42 01             	lea    0x1(%edx),%eax
+  800294:	89 03                	mov    %eax,(%ebx)
+  800296:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800299:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80029d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002a2:	74 09                	je     8002ad <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002a4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002ab:	c9                   	leave
+  8002ac:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002ad:	83 ec 08             	sub    $0x8,%esp
+  8002b0:	68 ff 00 00 00       	push   $0xff
+  8002b5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b8:	50                   	push   %eax
+  8002b9:	e8 1d 0a 00 00       	call   800cdb <sys_cputs>
+		b->idx = 0;
+  8002be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c4:	83 c4 10             	add    $0x10,%esp
+  8002c7:	eb db                	jmp    8002a4 <putch+0x1f>
+
+008002c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c9:	55                   	push   %ebp
+  8002ca:	89 e5                	mov    %esp,%ebp
+  8002cc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002d2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d9:	00 00 00 
+	b.cnt = 0;
+  8002dc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002e3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002e6:	ff 75 0c             	push   0xc(%ebp)
+  8002e9:	ff 75 08             	push   0x8(%ebp)
+  8002ec:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002f2:	50                   	push   %eax
+  8002f3:	68 85 02 80 00       	push   $0x800285
+  8002f8:	e8 fb 00 00 00       	call   8003f8 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002fd:	83 c4 08             	add    $0x8,%esp
+  800300:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800306:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80030c:	50                   	push   %eax
+  80030d:	e8 c9 09 00 00       	call   800cdb <sys_cputs>
+
+	return b.cnt;
+}
+  800312:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800318:	c9                   	leave
+  800319:	c3                   	ret
+
+0080031a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80031a:	55                   	push   %ebp
+  80031b:	89 e5                	mov    %esp,%ebp
+  80031d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800320:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800323:	50                   	push   %eax
+  800324:	ff 75 08             	push   0x8(%ebp)
+  800327:	e8 9d ff ff ff       	call   8002c9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80032c:	c9                   	leave
+  80032d:	c3                   	ret
+
+0080032e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80032e:	55                   	push   %ebp
+  80032f:	89 e5                	mov    %esp,%ebp
+  800331:	57                   	push   %edi
+  800332:	56                   	push   %esi
+  800333:	53                   	push   %ebx
+  800334:	83 ec 1c             	sub    $0x1c,%esp
+  800337:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80033a:	89 d6                	mov    %edx,%esi
+  80033c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80033f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800342:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800345:	73 0b                	jae    800352 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800347:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80034a:	c1 e7 08             	shl    $0x8,%edi
+  80034d:	0b 7d 10             	or     0x10(%ebp),%edi
+  800350:	eb 36                	jmp    800388 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800352:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80035a:	f7 75 08             	divl   0x8(%ebp)
+  80035d:	89 c1                	mov    %eax,%ecx
+  80035f:	ff 75 14             	push   0x14(%ebp)
+  800362:	ff 75 10             	push   0x10(%ebp)
+  800365:	83 eb 01             	sub    $0x1,%ebx
+  800368:	53                   	push   %ebx
+  800369:	ff 75 08             	push   0x8(%ebp)
+  80036c:	89 f2                	mov    %esi,%edx
+  80036e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800371:	e8 b8 ff ff ff       	call   80032e <printnum>
+  800376:	83 c4 10             	add    $0x10,%esp
+  800379:	eb 14                	jmp    80038f <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80037b:	83 ec 08             	sub    $0x8,%esp
+  80037e:	56                   	push   %esi
+  80037f:	57                   	push   %edi
+  800380:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800383:	ff d0                	call   *%eax
+  800385:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800388:	83 eb 01             	sub    $0x1,%ebx
+  80038b:	85 db                	test   %ebx,%ebx
+  80038d:	7f ec                	jg     80037b <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80038f:	83 ec 08             	sub    $0x8,%esp
+  800392:	56                   	push   %esi
+  800393:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800396:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039b:	f7 75 08             	divl   0x8(%ebp)
+  80039e:	0f be 92 5f 2e 80 00 	movsbl 0x802e5f(%edx),%edx
+  8003a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a8:	c1 e0 08             	shl    $0x8,%eax
+  8003ab:	09 d0                	or     %edx,%eax
+  8003ad:	50                   	push   %eax
+  8003ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003b1:	ff d0                	call   *%eax
+}
+  8003b3:	83 c4 10             	add    $0x10,%esp
+  8003b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b9:	5b                   	pop    %ebx
+  8003ba:	5e                   	pop    %esi
+  8003bb:	5f                   	pop    %edi
+  8003bc:	5d                   	pop    %ebp
+  8003bd:	c3                   	ret
+
+008003be <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003be:	55                   	push   %ebp
+  8003bf:	89 e5                	mov    %esp,%ebp
+  8003c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003c4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003c8:	8b 10                	mov    (%eax),%edx
+  8003ca:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003cd:	73 0a                	jae    8003d9 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003cf:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003d2:	89 08                	mov    %ecx,(%eax)
+  8003d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003d7:	88 02                	mov    %al,(%edx)
+}
+  8003d9:	5d                   	pop    %ebp
+  8003da:	c3                   	ret
+
+008003db <printfmt>:
+{
+  8003db:	55                   	push   %ebp
+  8003dc:	89 e5                	mov    %esp,%ebp
+  8003de:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003e1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003e4:	50                   	push   %eax
+  8003e5:	ff 75 10             	push   0x10(%ebp)
+  8003e8:	ff 75 0c             	push   0xc(%ebp)
+  8003eb:	ff 75 08             	push   0x8(%ebp)
+  8003ee:	e8 05 00 00 00       	call   8003f8 <vprintfmt>
+}
+  8003f3:	83 c4 10             	add    $0x10,%esp
+  8003f6:	c9                   	leave
+  8003f7:	c3                   	ret
+
+008003f8 <vprintfmt>:
+{
+  8003f8:	55                   	push   %ebp
+  8003f9:	89 e5                	mov    %esp,%ebp
+  8003fb:	57                   	push   %edi
+  8003fc:	56                   	push   %esi
+  8003fd:	53                   	push   %ebx
+  8003fe:	83 ec 3c             	sub    $0x3c,%esp
+  800401:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800404:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800407:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80040e:	eb 16                	jmp    800426 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800410:	83 ec 08             	sub    $0x8,%esp
+  800413:	ff 75 0c             	push   0xc(%ebp)
+  800416:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800419:	c1 e2 08             	shl    $0x8,%edx
+  80041c:	09 d0                	or     %edx,%eax
+  80041e:	50                   	push   %eax
+  80041f:	ff d7                	call   *%edi
+  800421:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800424:	89 de                	mov    %ebx,%esi
+  800426:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800429:	0f b6 06             	movzbl (%esi),%eax
+  80042c:	83 f8 25             	cmp    $0x25,%eax
+  80042f:	74 0c                	je     80043d <vprintfmt+0x45>
+			if (ch == '\0')
+  800431:	85 c0                	test   %eax,%eax
+  800433:	75 db                	jne    800410 <vprintfmt+0x18>
+}
+  800435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800438:	5b                   	pop    %ebx
+  800439:	5e                   	pop    %esi
+  80043a:	5f                   	pop    %edi
+  80043b:	5d                   	pop    %ebp
+  80043c:	c3                   	ret
+		padc = ' ';
+  80043d:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800441:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800448:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80044f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800456:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80045b:	8d 73 01             	lea    0x1(%ebx),%esi
+  80045e:	0f b6 13             	movzbl (%ebx),%edx
+  800461:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800464:	3c 55                	cmp    $0x55,%al
+  800466:	0f 87 2c 04 00 00    	ja     800898 <vprintfmt+0x4a0>
+  80046c:	0f b6 c0             	movzbl %al,%eax
+  80046f:	ff 24 85 a0 2f 80 00 	jmp    *0x802fa0(,%eax,4)
+  800476:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800478:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80047c:	eb dd                	jmp    80045b <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047e:	89 f3                	mov    %esi,%ebx
+  800480:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800484:	eb d5                	jmp    80045b <vprintfmt+0x63>
+  800486:	0f b6 d2             	movzbl %dl,%edx
+  800489:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80048b:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800490:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800493:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800497:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80049a:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80049d:	83 fe 09             	cmp    $0x9,%esi
+  8004a0:	0f 87 8a 00 00 00    	ja     800530 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8004a6:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8004a9:	eb e5                	jmp    800490 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8004ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ae:	8b 00                	mov    (%eax),%eax
+  8004b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bc:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8004be:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c2:	79 97                	jns    80045b <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8004c4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d1:	eb 88                	jmp    80045b <vprintfmt+0x63>
+			if (width < 0)
+  8004d3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8004d6:	85 db                	test   %ebx,%ebx
+  8004d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004dd:	0f 49 c3             	cmovns %ebx,%eax
+  8004e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e3:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004e5:	e9 71 ff ff ff       	jmp    80045b <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ea:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8004ec:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f3:	e9 63 ff ff ff       	jmp    80045b <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8004f8:	8d 73 02             	lea    0x2(%ebx),%esi
+  8004fb:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8004ff:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800506:	3c 67                	cmp    $0x67,%al
+  800508:	0f 84 18 ff ff ff    	je     800426 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80050e:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800515:	3c 72                	cmp    $0x72,%al
+  800517:	0f 84 09 ff ff ff    	je     800426 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80051d:	3c 62                	cmp    $0x62,%al
+  80051f:	0f 94 c0             	sete   %al
+  800522:	0f b6 c0             	movzbl %al,%eax
+  800525:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800528:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80052b:	e9 f6 fe ff ff       	jmp    800426 <vprintfmt+0x2e>
+  800530:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800533:	eb 89                	jmp    8004be <vprintfmt+0xc6>
+			lflag++;
+  800535:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800538:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80053a:	e9 1c ff ff ff       	jmp    80045b <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80053f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800542:	8d 58 04             	lea    0x4(%eax),%ebx
+  800545:	83 ec 08             	sub    $0x8,%esp
+  800548:	ff 75 0c             	push   0xc(%ebp)
+  80054b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80054e:	c1 e0 08             	shl    $0x8,%eax
+  800551:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800554:	0b 01                	or     (%ecx),%eax
+  800556:	50                   	push   %eax
+  800557:	ff d7                	call   *%edi
+			break;
+  800559:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80055c:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80055f:	e9 c2 fe ff ff       	jmp    800426 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80056a:	8b 10                	mov    (%eax),%edx
+  80056c:	89 d0                	mov    %edx,%eax
+  80056e:	f7 d8                	neg    %eax
+  800570:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800573:	83 f8 12             	cmp    $0x12,%eax
+  800576:	7f 25                	jg     80059d <vprintfmt+0x1a5>
+  800578:	8b 14 85 00 31 80 00 	mov    0x803100(,%eax,4),%edx
+  80057f:	85 d2                	test   %edx,%edx
+  800581:	74 1a                	je     80059d <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800583:	52                   	push   %edx
+  800584:	68 41 32 80 00       	push   $0x803241
+  800589:	ff 75 0c             	push   0xc(%ebp)
+  80058c:	57                   	push   %edi
+  80058d:	e8 49 fe ff ff       	call   8003db <printfmt>
+  800592:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800595:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800598:	e9 89 fe ff ff       	jmp    800426 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80059d:	50                   	push   %eax
+  80059e:	68 77 2e 80 00       	push   $0x802e77
+  8005a3:	ff 75 0c             	push   0xc(%ebp)
+  8005a6:	57                   	push   %edi
+  8005a7:	e8 2f fe ff ff       	call   8003db <printfmt>
+  8005ac:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005af:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005b2:	e9 6f fe ff ff       	jmp    800426 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	83 c0 04             	add    $0x4,%eax
+  8005bd:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8005c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005c5:	85 c9                	test   %ecx,%ecx
+  8005c7:	b8 70 2e 80 00       	mov    $0x802e70,%eax
+  8005cc:	0f 45 c1             	cmovne %ecx,%eax
+  8005cf:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8005d2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005d6:	7e 06                	jle    8005de <vprintfmt+0x1e6>
+  8005d8:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8005dc:	75 1a                	jne    8005f8 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8005de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005e1:	c1 e0 08             	shl    $0x8,%eax
+  8005e4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8005e7:	83 c8 3f             	or     $0x3f,%eax
+  8005ea:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005ed:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8005f0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005f3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8005f6:	eb 6d                	jmp    800665 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f8:	83 ec 08             	sub    $0x8,%esp
+  8005fb:	ff 75 d0             	push   -0x30(%ebp)
+  8005fe:	ff 75 c8             	push   -0x38(%ebp)
+  800601:	e8 39 03 00 00       	call   80093f <strnlen>
+  800606:	89 c2                	mov    %eax,%edx
+  800608:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80060b:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80060d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800610:	c1 e1 08             	shl    $0x8,%ecx
+  800613:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800617:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800619:	83 c4 10             	add    $0x10,%esp
+  80061c:	89 c3                	mov    %eax,%ebx
+  80061e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800621:	89 75 10             	mov    %esi,0x10(%ebp)
+  800624:	89 ce                	mov    %ecx,%esi
+  800626:	eb 0f                	jmp    800637 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800628:	83 ec 08             	sub    $0x8,%esp
+  80062b:	ff 75 0c             	push   0xc(%ebp)
+  80062e:	56                   	push   %esi
+  80062f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800631:	83 eb 01             	sub    $0x1,%ebx
+  800634:	83 c4 10             	add    $0x10,%esp
+  800637:	85 db                	test   %ebx,%ebx
+  800639:	7f ed                	jg     800628 <vprintfmt+0x230>
+  80063b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80063e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800641:	85 c0                	test   %eax,%eax
+  800643:	ba 00 00 00 00       	mov    $0x0,%edx
+  800648:	0f 49 d0             	cmovns %eax,%edx
+  80064b:	29 d0                	sub    %edx,%eax
+  80064d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800650:	eb 8c                	jmp    8005de <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800652:	83 ec 08             	sub    $0x8,%esp
+  800655:	ff 75 0c             	push   0xc(%ebp)
+  800658:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80065b:	09 c2                	or     %eax,%edx
+  80065d:	52                   	push   %edx
+  80065e:	ff d7                	call   *%edi
+  800660:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800663:	89 d9                	mov    %ebx,%ecx
+  800665:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800668:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80066c:	0f be d0             	movsbl %al,%edx
+  80066f:	85 d2                	test   %edx,%edx
+  800671:	74 2a                	je     80069d <vprintfmt+0x2a5>
+  800673:	85 f6                	test   %esi,%esi
+  800675:	78 05                	js     80067c <vprintfmt+0x284>
+  800677:	83 ee 01             	sub    $0x1,%esi
+  80067a:	78 3b                	js     8006b7 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80067c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800680:	74 d0                	je     800652 <vprintfmt+0x25a>
+  800682:	0f be c0             	movsbl %al,%eax
+  800685:	83 e8 20             	sub    $0x20,%eax
+  800688:	83 f8 5e             	cmp    $0x5e,%eax
+  80068b:	76 c5                	jbe    800652 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80068d:	83 ec 08             	sub    $0x8,%esp
+  800690:	ff 75 0c             	push   0xc(%ebp)
+  800693:	ff 75 cc             	push   -0x34(%ebp)
+  800696:	ff d7                	call   *%edi
+  800698:	83 c4 10             	add    $0x10,%esp
+  80069b:	eb c6                	jmp    800663 <vprintfmt+0x26b>
+  80069d:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006a0:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8006a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006a6:	01 c3                	add    %eax,%ebx
+  8006a8:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8006aa:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006ad:	83 c8 20             	or     $0x20,%eax
+  8006b0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006b3:	89 c6                	mov    %eax,%esi
+  8006b5:	eb 14                	jmp    8006cb <vprintfmt+0x2d3>
+  8006b7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006ba:	eb e4                	jmp    8006a0 <vprintfmt+0x2a8>
+  8006bc:	83 ec 08             	sub    $0x8,%esp
+  8006bf:	ff 75 0c             	push   0xc(%ebp)
+  8006c2:	56                   	push   %esi
+  8006c3:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006c5:	83 eb 01             	sub    $0x1,%ebx
+  8006c8:	83 c4 10             	add    $0x10,%esp
+  8006cb:	85 db                	test   %ebx,%ebx
+  8006cd:	7f ed                	jg     8006bc <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006cf:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006d2:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d8:	e9 49 fd ff ff       	jmp    800426 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006dd:	83 f9 01             	cmp    $0x1,%ecx
+  8006e0:	7f 1f                	jg     800701 <vprintfmt+0x309>
+	else if (lflag)
+  8006e2:	85 c9                	test   %ecx,%ecx
+  8006e4:	74 69                	je     80074f <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8b 00                	mov    (%eax),%eax
+  8006eb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ee:	89 c1                	mov    %eax,%ecx
+  8006f0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ff:	eb 17                	jmp    800718 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 50 04             	mov    0x4(%eax),%edx
+  800707:	8b 00                	mov    (%eax),%eax
+  800709:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8d 40 08             	lea    0x8(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800718:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80071b:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80071e:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800723:	85 db                	test   %ebx,%ebx
+  800725:	0f 89 f6 00 00 00    	jns    800821 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	ff 75 0c             	push   0xc(%ebp)
+  800731:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800734:	c1 e0 08             	shl    $0x8,%eax
+  800737:	83 c8 2d             	or     $0x2d,%eax
+  80073a:	50                   	push   %eax
+  80073b:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80073d:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800740:	f7 d9                	neg    %ecx
+  800742:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800745:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80074a:	e9 d2 00 00 00       	jmp    800821 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80074f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800752:	8b 00                	mov    (%eax),%eax
+  800754:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800757:	89 c1                	mov    %eax,%ecx
+  800759:	c1 f9 1f             	sar    $0x1f,%ecx
+  80075c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8d 40 04             	lea    0x4(%eax),%eax
+  800765:	89 45 14             	mov    %eax,0x14(%ebp)
+  800768:	eb ae                	jmp    800718 <vprintfmt+0x320>
+	if (lflag >= 2)
+  80076a:	83 f9 01             	cmp    $0x1,%ecx
+  80076d:	7f 19                	jg     800788 <vprintfmt+0x390>
+	else if (lflag)
+  80076f:	85 c9                	test   %ecx,%ecx
+  800771:	74 2a                	je     80079d <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800773:	8b 45 14             	mov    0x14(%ebp),%eax
+  800776:	8b 08                	mov    (%eax),%ecx
+  800778:	8d 40 04             	lea    0x4(%eax),%eax
+  80077b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80077e:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800783:	e9 99 00 00 00       	jmp    800821 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8b 08                	mov    (%eax),%ecx
+  80078d:	8d 40 08             	lea    0x8(%eax),%eax
+  800790:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800793:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800798:	e9 84 00 00 00       	jmp    800821 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80079d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a0:	8b 08                	mov    (%eax),%ecx
+  8007a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8007ad:	eb 72                	jmp    800821 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8007af:	83 f9 01             	cmp    $0x1,%ecx
+  8007b2:	7f 16                	jg     8007ca <vprintfmt+0x3d2>
+	else if (lflag)
+  8007b4:	85 c9                	test   %ecx,%ecx
+  8007b6:	74 24                	je     8007dc <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 08                	mov    (%eax),%ecx
+  8007bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007c3:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8007c8:	eb 57                	jmp    800821 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cd:	8b 08                	mov    (%eax),%ecx
+  8007cf:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007d5:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8007da:	eb 45                	jmp    800821 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8b 08                	mov    (%eax),%ecx
+  8007e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007e7:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8007ec:	eb 33                	jmp    800821 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8007ee:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007f1:	c1 e3 08             	shl    $0x8,%ebx
+  8007f4:	83 ec 08             	sub    $0x8,%esp
+  8007f7:	ff 75 0c             	push   0xc(%ebp)
+  8007fa:	89 d8                	mov    %ebx,%eax
+  8007fc:	83 c8 30             	or     $0x30,%eax
+  8007ff:	50                   	push   %eax
+  800800:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800802:	83 c4 08             	add    $0x8,%esp
+  800805:	ff 75 0c             	push   0xc(%ebp)
+  800808:	83 cb 78             	or     $0x78,%ebx
+  80080b:	53                   	push   %ebx
+  80080c:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80080e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800811:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800813:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800816:	8d 40 04             	lea    0x4(%eax),%eax
+  800819:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081c:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800821:	ff 75 e4             	push   -0x1c(%ebp)
+  800824:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800828:	52                   	push   %edx
+  800829:	ff 75 e0             	push   -0x20(%ebp)
+  80082c:	50                   	push   %eax
+  80082d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800830:	89 f8                	mov    %edi,%eax
+  800832:	e8 f7 fa ff ff       	call   80032e <printnum>
+			break;
+  800837:	83 c4 10             	add    $0x10,%esp
+  80083a:	e9 e7 fb ff ff       	jmp    800426 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80083f:	83 f9 01             	cmp    $0x1,%ecx
+  800842:	7f 16                	jg     80085a <vprintfmt+0x462>
+	else if (lflag)
+  800844:	85 c9                	test   %ecx,%ecx
+  800846:	74 24                	je     80086c <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800848:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084b:	8b 08                	mov    (%eax),%ecx
+  80084d:	8d 40 04             	lea    0x4(%eax),%eax
+  800850:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800853:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800858:	eb c7                	jmp    800821 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80085a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085d:	8b 08                	mov    (%eax),%ecx
+  80085f:	8d 40 08             	lea    0x8(%eax),%eax
+  800862:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800865:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80086a:	eb b5                	jmp    800821 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80086c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086f:	8b 08                	mov    (%eax),%ecx
+  800871:	8d 40 04             	lea    0x4(%eax),%eax
+  800874:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800877:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80087c:	eb a3                	jmp    800821 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80087e:	83 ec 08             	sub    $0x8,%esp
+  800881:	ff 75 0c             	push   0xc(%ebp)
+  800884:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800887:	c1 e0 08             	shl    $0x8,%eax
+  80088a:	83 c8 25             	or     $0x25,%eax
+  80088d:	50                   	push   %eax
+  80088e:	ff d7                	call   *%edi
+			break;
+  800890:	83 c4 10             	add    $0x10,%esp
+  800893:	e9 8e fb ff ff       	jmp    800426 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800898:	83 ec 08             	sub    $0x8,%esp
+  80089b:	ff 75 0c             	push   0xc(%ebp)
+  80089e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008a1:	c1 e0 08             	shl    $0x8,%eax
+  8008a4:	83 c8 25             	or     $0x25,%eax
+  8008a7:	50                   	push   %eax
+  8008a8:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008aa:	83 c4 10             	add    $0x10,%esp
+  8008ad:	89 de                	mov    %ebx,%esi
+  8008af:	eb 03                	jmp    8008b4 <vprintfmt+0x4bc>
+  8008b1:	83 ee 01             	sub    $0x1,%esi
+  8008b4:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008b8:	75 f7                	jne    8008b1 <vprintfmt+0x4b9>
+  8008ba:	e9 67 fb ff ff       	jmp    800426 <vprintfmt+0x2e>
+
+008008bf <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	83 ec 18             	sub    $0x18,%esp
+  8008c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008cb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008ce:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008d2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008d5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008dc:	85 c0                	test   %eax,%eax
+  8008de:	74 26                	je     800906 <vsnprintf+0x47>
+  8008e0:	85 d2                	test   %edx,%edx
+  8008e2:	7e 22                	jle    800906 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008e4:	ff 75 14             	push   0x14(%ebp)
+  8008e7:	ff 75 10             	push   0x10(%ebp)
+  8008ea:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008ed:	50                   	push   %eax
+  8008ee:	68 be 03 80 00       	push   $0x8003be
+  8008f3:	e8 00 fb ff ff       	call   8003f8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008fb:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800901:	83 c4 10             	add    $0x10,%esp
+}
+  800904:	c9                   	leave
+  800905:	c3                   	ret
+		return -E_INVAL;
+  800906:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80090b:	eb f7                	jmp    800904 <vsnprintf+0x45>
+
+0080090d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80090d:	55                   	push   %ebp
+  80090e:	89 e5                	mov    %esp,%ebp
+  800910:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800913:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800916:	50                   	push   %eax
+  800917:	ff 75 10             	push   0x10(%ebp)
+  80091a:	ff 75 0c             	push   0xc(%ebp)
+  80091d:	ff 75 08             	push   0x8(%ebp)
+  800920:	e8 9a ff ff ff       	call   8008bf <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800925:	c9                   	leave
+  800926:	c3                   	ret
+
+00800927 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80092d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800932:	eb 03                	jmp    800937 <strlen+0x10>
+		n++;
+  800934:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800937:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80093b:	75 f7                	jne    800934 <strlen+0xd>
+	return n;
+}
+  80093d:	5d                   	pop    %ebp
+  80093e:	c3                   	ret
+
+0080093f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800945:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094d:	eb 03                	jmp    800952 <strnlen+0x13>
+		n++;
+  80094f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800952:	39 d0                	cmp    %edx,%eax
+  800954:	74 08                	je     80095e <strnlen+0x1f>
+  800956:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80095a:	75 f3                	jne    80094f <strnlen+0x10>
+  80095c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80095e:	89 d0                	mov    %edx,%eax
+  800960:	5d                   	pop    %ebp
+  800961:	c3                   	ret
+
+00800962 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	53                   	push   %ebx
+  800966:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800969:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80096c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800971:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800975:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800978:	83 c0 01             	add    $0x1,%eax
+  80097b:	84 d2                	test   %dl,%dl
+  80097d:	75 f2                	jne    800971 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80097f:	89 c8                	mov    %ecx,%eax
+  800981:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800984:	c9                   	leave
+  800985:	c3                   	ret
+
+00800986 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	53                   	push   %ebx
+  80098a:	83 ec 10             	sub    $0x10,%esp
+  80098d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800990:	53                   	push   %ebx
+  800991:	e8 91 ff ff ff       	call   800927 <strlen>
+  800996:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800999:	ff 75 0c             	push   0xc(%ebp)
+  80099c:	01 d8                	add    %ebx,%eax
+  80099e:	50                   	push   %eax
+  80099f:	e8 be ff ff ff       	call   800962 <strcpy>
+	return dst;
+}
+  8009a4:	89 d8                	mov    %ebx,%eax
+  8009a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a9:	c9                   	leave
+  8009aa:	c3                   	ret
+
+008009ab <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009ab:	55                   	push   %ebp
+  8009ac:	89 e5                	mov    %esp,%ebp
+  8009ae:	56                   	push   %esi
+  8009af:	53                   	push   %ebx
+  8009b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009b6:	89 f3                	mov    %esi,%ebx
+  8009b8:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009bb:	89 f0                	mov    %esi,%eax
+  8009bd:	eb 0f                	jmp    8009ce <strncpy+0x23>
+		*dst++ = *src;
+  8009bf:	83 c0 01             	add    $0x1,%eax
+  8009c2:	0f b6 0a             	movzbl (%edx),%ecx
+  8009c5:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009c8:	80 f9 01             	cmp    $0x1,%cl
+  8009cb:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009ce:	39 d8                	cmp    %ebx,%eax
+  8009d0:	75 ed                	jne    8009bf <strncpy+0x14>
+	}
+	return ret;
+}
+  8009d2:	89 f0                	mov    %esi,%eax
+  8009d4:	5b                   	pop    %ebx
+  8009d5:	5e                   	pop    %esi
+  8009d6:	5d                   	pop    %ebp
+  8009d7:	c3                   	ret
+
+008009d8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009d8:	55                   	push   %ebp
+  8009d9:	89 e5                	mov    %esp,%ebp
+  8009db:	56                   	push   %esi
+  8009dc:	53                   	push   %ebx
+  8009dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009e6:	89 f0                	mov    %esi,%eax
+  8009e8:	85 d2                	test   %edx,%edx
+  8009ea:	74 21                	je     800a0d <strlcpy+0x35>
+  8009ec:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009f0:	89 f2                	mov    %esi,%edx
+  8009f2:	eb 09                	jmp    8009fd <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009f4:	83 c1 01             	add    $0x1,%ecx
+  8009f7:	83 c2 01             	add    $0x1,%edx
+  8009fa:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009fd:	39 c2                	cmp    %eax,%edx
+  8009ff:	74 09                	je     800a0a <strlcpy+0x32>
+  800a01:	0f b6 19             	movzbl (%ecx),%ebx
+  800a04:	84 db                	test   %bl,%bl
+  800a06:	75 ec                	jne    8009f4 <strlcpy+0x1c>
+  800a08:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a0a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a0d:	29 f0                	sub    %esi,%eax
+}
+  800a0f:	5b                   	pop    %ebx
+  800a10:	5e                   	pop    %esi
+  800a11:	5d                   	pop    %ebp
+  800a12:	c3                   	ret
+
+00800a13 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a13:	55                   	push   %ebp
+  800a14:	89 e5                	mov    %esp,%ebp
+  800a16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a19:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a1c:	eb 06                	jmp    800a24 <strcmp+0x11>
+		p++, q++;
+  800a1e:	83 c1 01             	add    $0x1,%ecx
+  800a21:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a24:	0f b6 01             	movzbl (%ecx),%eax
+  800a27:	84 c0                	test   %al,%al
+  800a29:	74 04                	je     800a2f <strcmp+0x1c>
+  800a2b:	3a 02                	cmp    (%edx),%al
+  800a2d:	74 ef                	je     800a1e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a2f:	0f b6 c0             	movzbl %al,%eax
+  800a32:	0f b6 12             	movzbl (%edx),%edx
+  800a35:	29 d0                	sub    %edx,%eax
+}
+  800a37:	5d                   	pop    %ebp
+  800a38:	c3                   	ret
+
+00800a39 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	53                   	push   %ebx
+  800a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a43:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a46:	eb 09                	jmp    800a51 <strncmp+0x18>
+		n--, p++, q++;
+  800a48:	83 ea 01             	sub    $0x1,%edx
+  800a4b:	83 c0 01             	add    $0x1,%eax
+  800a4e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a51:	85 d2                	test   %edx,%edx
+  800a53:	74 18                	je     800a6d <strncmp+0x34>
+  800a55:	0f b6 18             	movzbl (%eax),%ebx
+  800a58:	84 db                	test   %bl,%bl
+  800a5a:	74 04                	je     800a60 <strncmp+0x27>
+  800a5c:	3a 19                	cmp    (%ecx),%bl
+  800a5e:	74 e8                	je     800a48 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a60:	0f b6 00             	movzbl (%eax),%eax
+  800a63:	0f b6 11             	movzbl (%ecx),%edx
+  800a66:	29 d0                	sub    %edx,%eax
+}
+  800a68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a6b:	c9                   	leave
+  800a6c:	c3                   	ret
+		return 0;
+  800a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a72:	eb f4                	jmp    800a68 <strncmp+0x2f>
+
+00800a74 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a7a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a7e:	eb 03                	jmp    800a83 <strchr+0xf>
+  800a80:	83 c0 01             	add    $0x1,%eax
+  800a83:	0f b6 10             	movzbl (%eax),%edx
+  800a86:	84 d2                	test   %dl,%dl
+  800a88:	74 06                	je     800a90 <strchr+0x1c>
+		if (*s == c)
+  800a8a:	38 ca                	cmp    %cl,%dl
+  800a8c:	75 f2                	jne    800a80 <strchr+0xc>
+  800a8e:	eb 05                	jmp    800a95 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a95:	5d                   	pop    %ebp
+  800a96:	c3                   	ret
+
+00800a97 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800aa1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800aa4:	38 ca                	cmp    %cl,%dl
+  800aa6:	74 09                	je     800ab1 <strfind+0x1a>
+  800aa8:	84 d2                	test   %dl,%dl
+  800aaa:	74 05                	je     800ab1 <strfind+0x1a>
+	for (; *s; s++)
+  800aac:	83 c0 01             	add    $0x1,%eax
+  800aaf:	eb f0                	jmp    800aa1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ab1:	5d                   	pop    %ebp
+  800ab2:	c3                   	ret
+
+00800ab3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ab3:	55                   	push   %ebp
+  800ab4:	89 e5                	mov    %esp,%ebp
+  800ab6:	57                   	push   %edi
+  800ab7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800aba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800abd:	85 c9                	test   %ecx,%ecx
+  800abf:	74 20                	je     800ae1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ac1:	89 f8                	mov    %edi,%eax
+  800ac3:	09 c8                	or     %ecx,%eax
+  800ac5:	a8 03                	test   $0x3,%al
+  800ac7:	75 12                	jne    800adb <memset+0x28>
+		c &= 0xFF;
+  800ac9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800acd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ad3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ad6:	fc                   	cld
+  800ad7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ad9:	eb 06                	jmp    800ae1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800adb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ade:	fc                   	cld
+  800adf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ae1:	89 f8                	mov    %edi,%eax
+  800ae3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ae6:	c9                   	leave
+  800ae7:	c3                   	ret
+
+00800ae8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	57                   	push   %edi
+  800aec:	56                   	push   %esi
+  800aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800af3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800af6:	39 c6                	cmp    %eax,%esi
+  800af8:	73 32                	jae    800b2c <memmove+0x44>
+  800afa:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800afd:	39 d0                	cmp    %edx,%eax
+  800aff:	73 2b                	jae    800b2c <memmove+0x44>
+		s += n;
+		d += n;
+  800b01:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b04:	89 d6                	mov    %edx,%esi
+  800b06:	09 fe                	or     %edi,%esi
+  800b08:	09 ce                	or     %ecx,%esi
+  800b0a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b10:	75 0e                	jne    800b20 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b12:	83 ef 04             	sub    $0x4,%edi
+  800b15:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b18:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b1b:	fd                   	std
+  800b1c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b1e:	eb 09                	jmp    800b29 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b20:	83 ef 01             	sub    $0x1,%edi
+  800b23:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b26:	fd                   	std
+  800b27:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b29:	fc                   	cld
+  800b2a:	eb 1a                	jmp    800b46 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b2c:	89 f2                	mov    %esi,%edx
+  800b2e:	09 c2                	or     %eax,%edx
+  800b30:	09 ca                	or     %ecx,%edx
+  800b32:	f6 c2 03             	test   $0x3,%dl
+  800b35:	75 0a                	jne    800b41 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b37:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b3a:	89 c7                	mov    %eax,%edi
+  800b3c:	fc                   	cld
+  800b3d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b3f:	eb 05                	jmp    800b46 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b41:	89 c7                	mov    %eax,%edi
+  800b43:	fc                   	cld
+  800b44:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b46:	5e                   	pop    %esi
+  800b47:	5f                   	pop    %edi
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+
+00800b4a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b4a:	55                   	push   %ebp
+  800b4b:	89 e5                	mov    %esp,%ebp
+  800b4d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b50:	ff 75 10             	push   0x10(%ebp)
+  800b53:	ff 75 0c             	push   0xc(%ebp)
+  800b56:	ff 75 08             	push   0x8(%ebp)
+  800b59:	e8 8a ff ff ff       	call   800ae8 <memmove>
+}
+  800b5e:	c9                   	leave
+  800b5f:	c3                   	ret
+
+00800b60 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	56                   	push   %esi
+  800b64:	53                   	push   %ebx
+  800b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b68:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b6b:	89 c6                	mov    %eax,%esi
+  800b6d:	03 75 10             	add    0x10(%ebp),%esi
+  800b70:	eb 06                	jmp    800b78 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b72:	83 c0 01             	add    $0x1,%eax
+  800b75:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b78:	39 f0                	cmp    %esi,%eax
+  800b7a:	74 14                	je     800b90 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b7c:	0f b6 08             	movzbl (%eax),%ecx
+  800b7f:	0f b6 1a             	movzbl (%edx),%ebx
+  800b82:	38 d9                	cmp    %bl,%cl
+  800b84:	74 ec                	je     800b72 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b86:	0f b6 c1             	movzbl %cl,%eax
+  800b89:	0f b6 db             	movzbl %bl,%ebx
+  800b8c:	29 d8                	sub    %ebx,%eax
+  800b8e:	eb 05                	jmp    800b95 <memcmp+0x35>
+	}
+
+	return 0;
+  800b90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b95:	5b                   	pop    %ebx
+  800b96:	5e                   	pop    %esi
+  800b97:	5d                   	pop    %ebp
+  800b98:	c3                   	ret
+
+00800b99 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b99:	55                   	push   %ebp
+  800b9a:	89 e5                	mov    %esp,%ebp
+  800b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ba2:	89 c2                	mov    %eax,%edx
+  800ba4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba7:	eb 03                	jmp    800bac <memfind+0x13>
+  800ba9:	83 c0 01             	add    $0x1,%eax
+  800bac:	39 d0                	cmp    %edx,%eax
+  800bae:	73 04                	jae    800bb4 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bb0:	38 08                	cmp    %cl,(%eax)
+  800bb2:	75 f5                	jne    800ba9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bb4:	5d                   	pop    %ebp
+  800bb5:	c3                   	ret
+
+00800bb6 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	57                   	push   %edi
+  800bba:	56                   	push   %esi
+  800bbb:	53                   	push   %ebx
+  800bbc:	83 ec 1c             	sub    $0x1c,%esp
+  800bbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc2:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bc5:	eb 03                	jmp    800bca <strtol+0x14>
+		s++;
+  800bc7:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800bca:	0f b6 06             	movzbl (%esi),%eax
+  800bcd:	3c 20                	cmp    $0x20,%al
+  800bcf:	74 f6                	je     800bc7 <strtol+0x11>
+  800bd1:	3c 09                	cmp    $0x9,%al
+  800bd3:	74 f2                	je     800bc7 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bd5:	3c 2b                	cmp    $0x2b,%al
+  800bd7:	74 43                	je     800c1c <strtol+0x66>
+	int neg = 0;
+  800bd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800bde:	3c 2d                	cmp    $0x2d,%al
+  800be0:	74 44                	je     800c26 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be2:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800be8:	75 0f                	jne    800bf9 <strtol+0x43>
+  800bea:	80 3e 30             	cmpb   $0x30,(%esi)
+  800bed:	74 41                	je     800c30 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bef:	85 ff                	test   %edi,%edi
+  800bf1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bf6:	0f 44 f8             	cmove  %eax,%edi
+  800bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c03:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c06:	89 fb                	mov    %edi,%ebx
+  800c08:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c0b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c0e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c11:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c14:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c17:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c1a:	eb 67                	jmp    800c83 <strtol+0xcd>
+		s++;
+  800c1c:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c24:	eb bc                	jmp    800be2 <strtol+0x2c>
+		s++, neg = 1;
+  800c26:	83 c6 01             	add    $0x1,%esi
+  800c29:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c2e:	eb b2                	jmp    800be2 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c30:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c34:	74 0e                	je     800c44 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c36:	85 ff                	test   %edi,%edi
+  800c38:	75 bf                	jne    800bf9 <strtol+0x43>
+		s++, base = 8;
+  800c3a:	83 c6 01             	add    $0x1,%esi
+  800c3d:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c42:	eb b5                	jmp    800bf9 <strtol+0x43>
+		s += 2, base = 16;
+  800c44:	83 c6 02             	add    $0x2,%esi
+  800c47:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c4c:	eb ab                	jmp    800bf9 <strtol+0x43>
+			dig = *s - '0';
+  800c4e:	0f be c9             	movsbl %cl,%ecx
+  800c51:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c54:	39 f9                	cmp    %edi,%ecx
+  800c56:	7d 59                	jge    800cb1 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c58:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c5c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c5f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c62:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c65:	0f af d8             	imul   %eax,%ebx
+  800c68:	0f af d7             	imul   %edi,%edx
+  800c6b:	01 d3                	add    %edx,%ebx
+  800c6d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c70:	f7 e7                	mul    %edi
+  800c72:	01 da                	add    %ebx,%edx
+  800c74:	89 cb                	mov    %ecx,%ebx
+  800c76:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c79:	01 c8                	add    %ecx,%eax
+  800c7b:	11 da                	adc    %ebx,%edx
+  800c7d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c80:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c86:	0f b6 08             	movzbl (%eax),%ecx
+  800c89:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c8c:	80 fb 09             	cmp    $0x9,%bl
+  800c8f:	76 bd                	jbe    800c4e <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c91:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c94:	80 fb 19             	cmp    $0x19,%bl
+  800c97:	77 08                	ja     800ca1 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c99:	0f be c9             	movsbl %cl,%ecx
+  800c9c:	83 e9 57             	sub    $0x57,%ecx
+  800c9f:	eb b3                	jmp    800c54 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ca1:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800ca4:	80 fb 19             	cmp    $0x19,%bl
+  800ca7:	77 08                	ja     800cb1 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800ca9:	0f be c9             	movsbl %cl,%ecx
+  800cac:	83 e9 37             	sub    $0x37,%ecx
+  800caf:	eb a3                	jmp    800c54 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cb1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800cb4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cb7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cba:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cbd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cc1:	74 05                	je     800cc8 <strtol+0x112>
+		*endptr = (char *) s;
+  800cc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cc6:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800cc8:	85 c9                	test   %ecx,%ecx
+  800cca:	74 07                	je     800cd3 <strtol+0x11d>
+  800ccc:	f7 d8                	neg    %eax
+  800cce:	83 d2 00             	adc    $0x0,%edx
+  800cd1:	f7 da                	neg    %edx
+}
+  800cd3:	83 c4 1c             	add    $0x1c,%esp
+  800cd6:	5b                   	pop    %ebx
+  800cd7:	5e                   	pop    %esi
+  800cd8:	5f                   	pop    %edi
+  800cd9:	5d                   	pop    %ebp
+  800cda:	c3                   	ret
+
+00800cdb <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	57                   	push   %edi
+  800cdf:	56                   	push   %esi
+  800ce0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ce1:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800ce8:	74 18                	je     800d02 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf5:	89 c3                	mov    %eax,%ebx
+  800cf7:	89 c7                	mov    %eax,%edi
+  800cf9:	89 c6                	mov    %eax,%esi
+  800cfb:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cfd:	5b                   	pop    %ebx
+  800cfe:	5e                   	pop    %esi
+  800cff:	5f                   	pop    %edi
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0d:	89 c3                	mov    %eax,%ebx
+  800d0f:	89 c7                	mov    %eax,%edi
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	8d 35 1c 0d 80 00    	lea    0x800d1c,%esi
+  800d1a:	0f 34                	sysenter
+  800d1c:	5d                   	pop    %ebp
+		goto out;
+  800d1d:	eb de                	jmp    800cfd <sys_cputs+0x22>
+
+00800d1f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d1f:	55                   	push   %ebp
+  800d20:	89 e5                	mov    %esp,%ebp
+  800d22:	57                   	push   %edi
+  800d23:	56                   	push   %esi
+  800d24:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d25:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800d2c:	74 19                	je     800d47 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d33:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d38:	89 d1                	mov    %edx,%ecx
+  800d3a:	89 d3                	mov    %edx,%ebx
+  800d3c:	89 d7                	mov    %edx,%edi
+  800d3e:	89 d6                	mov    %edx,%esi
+  800d40:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d42:	5b                   	pop    %ebx
+  800d43:	5e                   	pop    %esi
+  800d44:	5f                   	pop    %edi
+  800d45:	5d                   	pop    %ebp
+  800d46:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d51:	89 d1                	mov    %edx,%ecx
+  800d53:	89 d3                	mov    %edx,%ebx
+  800d55:	89 d7                	mov    %edx,%edi
+  800d57:	55                   	push   %ebp
+  800d58:	89 e5                	mov    %esp,%ebp
+  800d5a:	8d 35 62 0d 80 00    	lea    0x800d62,%esi
+  800d60:	0f 34                	sysenter
+  800d62:	5d                   	pop    %ebp
+		goto out;
+  800d63:	eb dd                	jmp    800d42 <sys_cgetc+0x23>
+
+00800d65 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	57                   	push   %edi
+  800d69:	56                   	push   %esi
+  800d6a:	53                   	push   %ebx
+  800d6b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d6e:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800d75:	74 21                	je     800d98 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d84:	89 cb                	mov    %ecx,%ebx
+  800d86:	89 cf                	mov    %ecx,%edi
+  800d88:	89 ce                	mov    %ecx,%esi
+  800d8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d8c:	85 c0                	test   %eax,%eax
+  800d8e:	7f 27                	jg     800db7 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d93:	5b                   	pop    %ebx
+  800d94:	5e                   	pop    %esi
+  800d95:	5f                   	pop    %edi
+  800d96:	5d                   	pop    %ebp
+  800d97:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800da5:	89 cb                	mov    %ecx,%ebx
+  800da7:	89 cf                	mov    %ecx,%edi
+  800da9:	55                   	push   %ebp
+  800daa:	89 e5                	mov    %esp,%ebp
+  800dac:	8d 35 b4 0d 80 00    	lea    0x800db4,%esi
+  800db2:	0f 34                	sysenter
+  800db4:	5d                   	pop    %ebp
+		goto out;
+  800db5:	eb d5                	jmp    800d8c <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db7:	83 ec 0c             	sub    $0xc,%esp
+  800dba:	50                   	push   %eax
+  800dbb:	6a 03                	push   $0x3
+  800dbd:	68 6b 31 80 00       	push   $0x80316b
+  800dc2:	6a 3f                	push   $0x3f
+  800dc4:	68 88 31 80 00       	push   $0x803188
+  800dc9:	e8 71 f4 ff ff       	call   80023f <_panic>
+
+00800dce <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	57                   	push   %edi
+  800dd2:	56                   	push   %esi
+  800dd3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dd4:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800ddb:	74 19                	je     800df6 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800ddd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800de7:	89 d1                	mov    %edx,%ecx
+  800de9:	89 d3                	mov    %edx,%ebx
+  800deb:	89 d7                	mov    %edx,%edi
+  800ded:	89 d6                	mov    %edx,%esi
+  800def:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800df1:	5b                   	pop    %ebx
+  800df2:	5e                   	pop    %esi
+  800df3:	5f                   	pop    %edi
+  800df4:	5d                   	pop    %ebp
+  800df5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800df6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e00:	89 d1                	mov    %edx,%ecx
+  800e02:	89 d3                	mov    %edx,%ebx
+  800e04:	89 d7                	mov    %edx,%edi
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	8d 35 11 0e 80 00    	lea    0x800e11,%esi
+  800e0f:	0f 34                	sysenter
+  800e11:	5d                   	pop    %ebp
+		goto out;
+  800e12:	eb dd                	jmp    800df1 <sys_getenvid+0x23>
+
+00800e14 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	57                   	push   %edi
+  800e18:	56                   	push   %esi
+  800e19:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e1a:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e21:	74 19                	je     800e3c <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e23:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e28:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e2d:	89 d1                	mov    %edx,%ecx
+  800e2f:	89 d3                	mov    %edx,%ebx
+  800e31:	89 d7                	mov    %edx,%edi
+  800e33:	89 d6                	mov    %edx,%esi
+  800e35:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e37:	5b                   	pop    %ebx
+  800e38:	5e                   	pop    %esi
+  800e39:	5f                   	pop    %edi
+  800e3a:	5d                   	pop    %ebp
+  800e3b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e41:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e46:	89 d1                	mov    %edx,%ecx
+  800e48:	89 d3                	mov    %edx,%ebx
+  800e4a:	89 d7                	mov    %edx,%edi
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	8d 35 57 0e 80 00    	lea    0x800e57,%esi
+  800e55:	0f 34                	sysenter
+  800e57:	5d                   	pop    %ebp
+		goto out;
+  800e58:	eb dd                	jmp    800e37 <sys_yield+0x23>
+
+00800e5a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e5a:	55                   	push   %ebp
+  800e5b:	89 e5                	mov    %esp,%ebp
+  800e5d:	57                   	push   %edi
+  800e5e:	56                   	push   %esi
+  800e5f:	53                   	push   %ebx
+  800e60:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e63:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e6a:	74 23                	je     800e8f <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e6c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e71:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7f:	89 f7                	mov    %esi,%edi
+  800e81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	7f 29                	jg     800eb0 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e95:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea2:	55                   	push   %ebp
+  800ea3:	89 e5                	mov    %esp,%ebp
+  800ea5:	8d 35 ad 0e 80 00    	lea    0x800ead,%esi
+  800eab:	0f 34                	sysenter
+  800ead:	5d                   	pop    %ebp
+		goto out;
+  800eae:	eb d3                	jmp    800e83 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+  800eb3:	50                   	push   %eax
+  800eb4:	6a 04                	push   $0x4
+  800eb6:	68 6b 31 80 00       	push   $0x80316b
+  800ebb:	6a 3f                	push   $0x3f
+  800ebd:	68 88 31 80 00       	push   $0x803188
+  800ec2:	e8 78 f3 ff ff       	call   80023f <_panic>
+
+00800ec7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ec7:	55                   	push   %ebp
+  800ec8:	89 e5                	mov    %esp,%ebp
+  800eca:	57                   	push   %edi
+  800ecb:	56                   	push   %esi
+  800ecc:	53                   	push   %ebx
+  800ecd:	83 ec 0c             	sub    $0xc,%esp
+  800ed0:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800ed3:	85 f6                	test   %esi,%esi
+  800ed5:	75 09                	jne    800ee0 <sys_page_map+0x19>
+  800ed7:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800ede:	74 1f                	je     800eff <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800ee0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ee5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eeb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef3:	85 c0                	test   %eax,%eax
+  800ef5:	7f 27                	jg     800f1e <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ef7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efa:	5b                   	pop    %ebx
+  800efb:	5e                   	pop    %esi
+  800efc:	5f                   	pop    %edi
+  800efd:	5d                   	pop    %ebp
+  800efe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f05:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	8d 35 1b 0f 80 00    	lea    0x800f1b,%esi
+  800f19:	0f 34                	sysenter
+  800f1b:	5d                   	pop    %ebp
+		goto out;
+  800f1c:	eb d5                	jmp    800ef3 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1e:	83 ec 0c             	sub    $0xc,%esp
+  800f21:	50                   	push   %eax
+  800f22:	6a 05                	push   $0x5
+  800f24:	68 6b 31 80 00       	push   $0x80316b
+  800f29:	6a 3f                	push   $0x3f
+  800f2b:	68 88 31 80 00       	push   $0x803188
+  800f30:	e8 0a f3 ff ff       	call   80023f <_panic>
+
+00800f35 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	56                   	push   %esi
+  800f3a:	53                   	push   %ebx
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f3e:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800f45:	74 22                	je     800f69 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f57:	89 df                	mov    %ebx,%edi
+  800f59:	89 de                	mov    %ebx,%esi
+  800f5b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5d:	85 c0                	test   %eax,%eax
+  800f5f:	7f 28                	jg     800f89 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f64:	5b                   	pop    %ebx
+  800f65:	5e                   	pop    %esi
+  800f66:	5f                   	pop    %edi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f74:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f79:	89 df                	mov    %ebx,%edi
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	8d 35 86 0f 80 00    	lea    0x800f86,%esi
+  800f84:	0f 34                	sysenter
+  800f86:	5d                   	pop    %ebp
+		goto out;
+  800f87:	eb d4                	jmp    800f5d <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	50                   	push   %eax
+  800f8d:	6a 06                	push   $0x6
+  800f8f:	68 6b 31 80 00       	push   $0x80316b
+  800f94:	6a 3f                	push   $0x3f
+  800f96:	68 88 31 80 00       	push   $0x803188
+  800f9b:	e8 9f f2 ff ff       	call   80023f <_panic>
+
+00800fa0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+  800fa6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fa9:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800fb0:	74 22                	je     800fd4 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb7:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc2:	89 df                	mov    %ebx,%edi
+  800fc4:	89 de                	mov    %ebx,%esi
+  800fc6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc8:	85 c0                	test   %eax,%eax
+  800fca:	7f 28                	jg     800ff4 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5f                   	pop    %edi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fe4:	89 df                	mov    %ebx,%edi
+  800fe6:	55                   	push   %ebp
+  800fe7:	89 e5                	mov    %esp,%ebp
+  800fe9:	8d 35 f1 0f 80 00    	lea    0x800ff1,%esi
+  800fef:	0f 34                	sysenter
+  800ff1:	5d                   	pop    %ebp
+		goto out;
+  800ff2:	eb d4                	jmp    800fc8 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff4:	83 ec 0c             	sub    $0xc,%esp
+  800ff7:	50                   	push   %eax
+  800ff8:	6a 08                	push   $0x8
+  800ffa:	68 6b 31 80 00       	push   $0x80316b
+  800fff:	6a 3f                	push   $0x3f
+  801001:	68 88 31 80 00       	push   $0x803188
+  801006:	e8 34 f2 ff ff       	call   80023f <_panic>
+
+0080100b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	57                   	push   %edi
+  80100f:	56                   	push   %esi
+  801010:	53                   	push   %ebx
+  801011:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801014:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80101b:	74 22                	je     80103f <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80101d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801022:	b8 09 00 00 00       	mov    $0x9,%eax
+  801027:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102d:	89 df                	mov    %ebx,%edi
+  80102f:	89 de                	mov    %ebx,%esi
+  801031:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801033:	85 c0                	test   %eax,%eax
+  801035:	7f 28                	jg     80105f <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801037:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103a:	5b                   	pop    %ebx
+  80103b:	5e                   	pop    %esi
+  80103c:	5f                   	pop    %edi
+  80103d:	5d                   	pop    %ebp
+  80103e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80103f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801044:	8b 55 08             	mov    0x8(%ebp),%edx
+  801047:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80104f:	89 df                	mov    %ebx,%edi
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	8d 35 5c 10 80 00    	lea    0x80105c,%esi
+  80105a:	0f 34                	sysenter
+  80105c:	5d                   	pop    %ebp
+		goto out;
+  80105d:	eb d4                	jmp    801033 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105f:	83 ec 0c             	sub    $0xc,%esp
+  801062:	50                   	push   %eax
+  801063:	6a 09                	push   $0x9
+  801065:	68 6b 31 80 00       	push   $0x80316b
+  80106a:	6a 3f                	push   $0x3f
+  80106c:	68 88 31 80 00       	push   $0x803188
+  801071:	e8 c9 f1 ff ff       	call   80023f <_panic>
+
+00801076 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801076:	55                   	push   %ebp
+  801077:	89 e5                	mov    %esp,%ebp
+  801079:	57                   	push   %edi
+  80107a:	56                   	push   %esi
+  80107b:	53                   	push   %ebx
+  80107c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80107f:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801086:	74 22                	je     8010aa <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801088:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801092:	8b 55 08             	mov    0x8(%ebp),%edx
+  801095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801098:	89 df                	mov    %ebx,%edi
+  80109a:	89 de                	mov    %ebx,%esi
+  80109c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109e:	85 c0                	test   %eax,%eax
+  8010a0:	7f 28                	jg     8010ca <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a5:	5b                   	pop    %ebx
+  8010a6:	5e                   	pop    %esi
+  8010a7:	5f                   	pop    %edi
+  8010a8:	5d                   	pop    %ebp
+  8010a9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ba:	89 df                	mov    %ebx,%edi
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	8d 35 c7 10 80 00    	lea    0x8010c7,%esi
+  8010c5:	0f 34                	sysenter
+  8010c7:	5d                   	pop    %ebp
+		goto out;
+  8010c8:	eb d4                	jmp    80109e <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ca:	83 ec 0c             	sub    $0xc,%esp
+  8010cd:	50                   	push   %eax
+  8010ce:	6a 0a                	push   $0xa
+  8010d0:	68 6b 31 80 00       	push   $0x80316b
+  8010d5:	6a 3f                	push   $0x3f
+  8010d7:	68 88 31 80 00       	push   $0x803188
+  8010dc:	e8 5e f1 ff ff       	call   80023f <_panic>
+
+008010e1 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8010e1:	55                   	push   %ebp
+  8010e2:	89 e5                	mov    %esp,%ebp
+  8010e4:	57                   	push   %edi
+  8010e5:	56                   	push   %esi
+  8010e6:	53                   	push   %ebx
+  8010e7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010ea:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8010f1:	74 22                	je     801115 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8010f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801100:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801103:	89 df                	mov    %ebx,%edi
+  801105:	89 de                	mov    %ebx,%esi
+  801107:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801109:	85 c0                	test   %eax,%eax
+  80110b:	7f 28                	jg     801135 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80110d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801110:	5b                   	pop    %ebx
+  801111:	5e                   	pop    %esi
+  801112:	5f                   	pop    %edi
+  801113:	5d                   	pop    %ebp
+  801114:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801120:	b8 17 00 00 00       	mov    $0x17,%eax
+  801125:	89 df                	mov    %ebx,%edi
+  801127:	55                   	push   %ebp
+  801128:	89 e5                	mov    %esp,%ebp
+  80112a:	8d 35 32 11 80 00    	lea    0x801132,%esi
+  801130:	0f 34                	sysenter
+  801132:	5d                   	pop    %ebp
+		goto out;
+  801133:	eb d4                	jmp    801109 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801135:	83 ec 0c             	sub    $0xc,%esp
+  801138:	50                   	push   %eax
+  801139:	6a 17                	push   $0x17
+  80113b:	68 6b 31 80 00       	push   $0x80316b
+  801140:	6a 3f                	push   $0x3f
+  801142:	68 88 31 80 00       	push   $0x803188
+  801147:	e8 f3 f0 ff ff       	call   80023f <_panic>
+
+0080114c <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801155:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80115c:	74 22                	je     801180 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80115e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801163:	b8 18 00 00 00       	mov    $0x18,%eax
+  801168:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116e:	89 df                	mov    %ebx,%edi
+  801170:	89 de                	mov    %ebx,%esi
+  801172:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801174:	85 c0                	test   %eax,%eax
+  801176:	7f 28                	jg     8011a0 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801178:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117b:	5b                   	pop    %ebx
+  80117c:	5e                   	pop    %esi
+  80117d:	5f                   	pop    %edi
+  80117e:	5d                   	pop    %ebp
+  80117f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801190:	89 df                	mov    %ebx,%edi
+  801192:	55                   	push   %ebp
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	8d 35 9d 11 80 00    	lea    0x80119d,%esi
+  80119b:	0f 34                	sysenter
+  80119d:	5d                   	pop    %ebp
+		goto out;
+  80119e:	eb d4                	jmp    801174 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a0:	83 ec 0c             	sub    $0xc,%esp
+  8011a3:	50                   	push   %eax
+  8011a4:	6a 18                	push   $0x18
+  8011a6:	68 6b 31 80 00       	push   $0x80316b
+  8011ab:	6a 3f                	push   $0x3f
+  8011ad:	68 88 31 80 00       	push   $0x803188
+  8011b2:	e8 88 f0 ff ff       	call   80023f <_panic>
+
+008011b7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011b7:	55                   	push   %ebp
+  8011b8:	89 e5                	mov    %esp,%ebp
+  8011ba:	57                   	push   %edi
+  8011bb:	56                   	push   %esi
+  8011bc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011bd:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8011c4:	74 1d                	je     8011e3 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8011c6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011dc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011de:	5b                   	pop    %ebx
+  8011df:	5e                   	pop    %esi
+  8011e0:	5f                   	pop    %edi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011f4:	55                   	push   %ebp
+  8011f5:	89 e5                	mov    %esp,%ebp
+  8011f7:	8d 35 ff 11 80 00    	lea    0x8011ff,%esi
+  8011fd:	0f 34                	sysenter
+  8011ff:	5d                   	pop    %ebp
+		goto out;
+  801200:	eb dc                	jmp    8011de <sys_ipc_try_send+0x27>
+
+00801202 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	57                   	push   %edi
+  801206:	56                   	push   %esi
+  801207:	53                   	push   %ebx
+  801208:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80120b:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801212:	74 21                	je     801235 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801214:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801219:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80121e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801221:	89 cb                	mov    %ecx,%ebx
+  801223:	89 cf                	mov    %ecx,%edi
+  801225:	89 ce                	mov    %ecx,%esi
+  801227:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801229:	85 c0                	test   %eax,%eax
+  80122b:	7f 27                	jg     801254 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80122d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801230:	5b                   	pop    %ebx
+  801231:	5e                   	pop    %esi
+  801232:	5f                   	pop    %edi
+  801233:	5d                   	pop    %ebp
+  801234:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801235:	8b 55 08             	mov    0x8(%ebp),%edx
+  801238:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80123d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801242:	89 cb                	mov    %ecx,%ebx
+  801244:	89 cf                	mov    %ecx,%edi
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	8d 35 51 12 80 00    	lea    0x801251,%esi
+  80124f:	0f 34                	sysenter
+  801251:	5d                   	pop    %ebp
+		goto out;
+  801252:	eb d5                	jmp    801229 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801254:	83 ec 0c             	sub    $0xc,%esp
+  801257:	50                   	push   %eax
+  801258:	6a 0d                	push   $0xd
+  80125a:	68 6b 31 80 00       	push   $0x80316b
+  80125f:	6a 3f                	push   $0x3f
+  801261:	68 88 31 80 00       	push   $0x803188
+  801266:	e8 d4 ef ff ff       	call   80023f <_panic>
+
+0080126b <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	57                   	push   %edi
+  80126f:	56                   	push   %esi
+  801270:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801271:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801278:	74 1b                	je     801295 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80127a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801284:	8b 55 08             	mov    0x8(%ebp),%edx
+  801287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128a:	89 df                	mov    %ebx,%edi
+  80128c:	89 de                	mov    %ebx,%esi
+  80128e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801290:	5b                   	pop    %ebx
+  801291:	5e                   	pop    %esi
+  801292:	5f                   	pop    %edi
+  801293:	5d                   	pop    %ebp
+  801294:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801295:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012a5:	89 df                	mov    %ebx,%edi
+  8012a7:	55                   	push   %ebp
+  8012a8:	89 e5                	mov    %esp,%ebp
+  8012aa:	8d 35 b2 12 80 00    	lea    0x8012b2,%esi
+  8012b0:	0f 34                	sysenter
+  8012b2:	5d                   	pop    %ebp
+		goto out;
+  8012b3:	eb db                	jmp    801290 <sys_ipc_recv_until+0x25>
+
+008012b5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	57                   	push   %edi
+  8012b9:	56                   	push   %esi
+  8012ba:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012bb:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8012c2:	74 19                	je     8012dd <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8012c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012ce:	89 d1                	mov    %edx,%ecx
+  8012d0:	89 d3                	mov    %edx,%ebx
+  8012d2:	89 d7                	mov    %edx,%edi
+  8012d4:	89 d6                	mov    %edx,%esi
+  8012d6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012d8:	5b                   	pop    %ebx
+  8012d9:	5e                   	pop    %esi
+  8012da:	5f                   	pop    %edi
+  8012db:	5d                   	pop    %ebp
+  8012dc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e7:	89 d1                	mov    %edx,%ecx
+  8012e9:	89 d3                	mov    %edx,%ebx
+  8012eb:	89 d7                	mov    %edx,%edi
+  8012ed:	55                   	push   %ebp
+  8012ee:	89 e5                	mov    %esp,%ebp
+  8012f0:	8d 35 f8 12 80 00    	lea    0x8012f8,%esi
+  8012f6:	0f 34                	sysenter
+  8012f8:	5d                   	pop    %ebp
+		goto out;
+  8012f9:	eb dd                	jmp    8012d8 <sys_time_msec+0x23>
+
+008012fb <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8012fb:	55                   	push   %ebp
+  8012fc:	89 e5                	mov    %esp,%ebp
+  8012fe:	57                   	push   %edi
+  8012ff:	56                   	push   %esi
+  801300:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801301:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801308:	74 1a                	je     801324 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80130a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801314:	8b 55 08             	mov    0x8(%ebp),%edx
+  801317:	89 cb                	mov    %ecx,%ebx
+  801319:	89 cf                	mov    %ecx,%edi
+  80131b:	89 ce                	mov    %ecx,%esi
+  80131d:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80131f:	5b                   	pop    %ebx
+  801320:	5e                   	pop    %esi
+  801321:	5f                   	pop    %edi
+  801322:	5d                   	pop    %ebp
+  801323:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801324:	8b 55 08             	mov    0x8(%ebp),%edx
+  801327:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80132c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801331:	89 cb                	mov    %ecx,%ebx
+  801333:	89 cf                	mov    %ecx,%edi
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	8d 35 40 13 80 00    	lea    0x801340,%esi
+  80133e:	0f 34                	sysenter
+  801340:	5d                   	pop    %ebp
+		goto out;
+  801341:	eb dc                	jmp    80131f <sys_sleep_until+0x24>
+
+00801343 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801343:	55                   	push   %ebp
+  801344:	89 e5                	mov    %esp,%ebp
+  801346:	57                   	push   %edi
+  801347:	56                   	push   %esi
+  801348:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801349:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801350:	74 1a                	je     80136c <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801352:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801357:	b8 11 00 00 00       	mov    $0x11,%eax
+  80135c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135f:	89 cb                	mov    %ecx,%ebx
+  801361:	89 cf                	mov    %ecx,%edi
+  801363:	89 ce                	mov    %ecx,%esi
+  801365:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801367:	5b                   	pop    %ebx
+  801368:	5e                   	pop    %esi
+  801369:	5f                   	pop    %edi
+  80136a:	5d                   	pop    %ebp
+  80136b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80136c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801374:	b8 11 00 00 00       	mov    $0x11,%eax
+  801379:	89 cb                	mov    %ecx,%ebx
+  80137b:	89 cf                	mov    %ecx,%edi
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+  801380:	8d 35 88 13 80 00    	lea    0x801388,%esi
+  801386:	0f 34                	sysenter
+  801388:	5d                   	pop    %ebp
+		goto out;
+  801389:	eb dc                	jmp    801367 <sys_env_print_stats+0x24>
+
+0080138b <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80138b:	55                   	push   %ebp
+  80138c:	89 e5                	mov    %esp,%ebp
+  80138e:	57                   	push   %edi
+  80138f:	56                   	push   %esi
+  801390:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801391:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801398:	74 1b                	je     8013b5 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80139a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139f:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013aa:	89 df                	mov    %ebx,%edi
+  8013ac:	89 de                	mov    %ebx,%esi
+  8013ae:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8013b0:	5b                   	pop    %ebx
+  8013b1:	5e                   	pop    %esi
+  8013b2:	5f                   	pop    %edi
+  8013b3:	5d                   	pop    %ebp
+  8013b4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c0:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013c5:	89 df                	mov    %ebx,%edi
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	8d 35 d2 13 80 00    	lea    0x8013d2,%esi
+  8013d0:	0f 34                	sysenter
+  8013d2:	5d                   	pop    %ebp
+		goto out;
+  8013d3:	eb db                	jmp    8013b0 <sys_perf+0x25>
+
+008013d5 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8013d5:	55                   	push   %ebp
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	57                   	push   %edi
+  8013d9:	56                   	push   %esi
+  8013da:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013db:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8013e2:	74 19                	je     8013fd <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8013e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013ee:	89 d1                	mov    %edx,%ecx
+  8013f0:	89 d3                	mov    %edx,%ebx
+  8013f2:	89 d7                	mov    %edx,%edi
+  8013f4:	89 d6                	mov    %edx,%esi
+  8013f6:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013f8:	5b                   	pop    %ebx
+  8013f9:	5e                   	pop    %esi
+  8013fa:	5f                   	pop    %edi
+  8013fb:	5d                   	pop    %ebp
+  8013fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801402:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801407:	89 d1                	mov    %edx,%ecx
+  801409:	89 d3                	mov    %edx,%ebx
+  80140b:	89 d7                	mov    %edx,%edi
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	8d 35 18 14 80 00    	lea    0x801418,%esi
+  801416:	0f 34                	sysenter
+  801418:	5d                   	pop    %ebp
+		goto out;
+  801419:	eb dd                	jmp    8013f8 <sys_fork+0x23>
+
+0080141b <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	57                   	push   %edi
+  80141f:	56                   	push   %esi
+  801420:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801421:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801428:	74 1c                	je     801446 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80142a:	be 00 00 00 00       	mov    $0x0,%esi
+  80142f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801434:	8b 55 08             	mov    0x8(%ebp),%edx
+  801437:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143d:	89 f7                	mov    %esi,%edi
+  80143f:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801441:	5b                   	pop    %ebx
+  801442:	5e                   	pop    %esi
+  801443:	5f                   	pop    %edi
+  801444:	5d                   	pop    %ebp
+  801445:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801446:	8b 55 08             	mov    0x8(%ebp),%edx
+  801449:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801451:	bf 00 00 00 00       	mov    $0x0,%edi
+  801456:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	8d 35 64 14 80 00    	lea    0x801464,%esi
+  801462:	0f 34                	sysenter
+  801464:	5d                   	pop    %ebp
+		goto out;
+  801465:	eb da                	jmp    801441 <sys_thread_create+0x26>
+
+00801467 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801467:	55                   	push   %ebp
+  801468:	89 e5                	mov    %esp,%ebp
+  80146a:	57                   	push   %edi
+  80146b:	56                   	push   %esi
+  80146c:	53                   	push   %ebx
+  80146d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801470:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801477:	74 24                	je     80149d <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801479:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80147e:	be 00 00 00 00       	mov    $0x0,%esi
+  801483:	8b 55 08             	mov    0x8(%ebp),%edx
+  801486:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801489:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80148c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80148f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801491:	85 c0                	test   %eax,%eax
+  801493:	7f 27                	jg     8014bc <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801495:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801498:	5b                   	pop    %ebx
+  801499:	5e                   	pop    %esi
+  80149a:	5f                   	pop    %edi
+  80149b:	5d                   	pop    %ebp
+  80149c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80149d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	8d 35 b9 14 80 00    	lea    0x8014b9,%esi
+  8014b7:	0f 34                	sysenter
+  8014b9:	5d                   	pop    %ebp
+		goto out;
+  8014ba:	eb d5                	jmp    801491 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014bc:	83 ec 0c             	sub    $0xc,%esp
+  8014bf:	50                   	push   %eax
+  8014c0:	6a 1f                	push   $0x1f
+  8014c2:	68 6b 31 80 00       	push   $0x80316b
+  8014c7:	6a 3f                	push   $0x3f
+  8014c9:	68 88 31 80 00       	push   $0x803188
+  8014ce:	e8 6c ed ff ff       	call   80023f <_panic>
+
+008014d3 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	57                   	push   %edi
+  8014d7:	56                   	push   %esi
+  8014d8:	53                   	push   %ebx
+  8014d9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014dc:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8014e3:	74 23                	je     801508 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8014e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ea:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f8:	89 f7                	mov    %esi,%edi
+  8014fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014fc:	85 c0                	test   %eax,%eax
+  8014fe:	7f 29                	jg     801529 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801503:	5b                   	pop    %ebx
+  801504:	5e                   	pop    %esi
+  801505:	5f                   	pop    %edi
+  801506:	5d                   	pop    %ebp
+  801507:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801508:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150e:	b8 20 00 00 00       	mov    $0x20,%eax
+  801513:	bf 00 00 00 00       	mov    $0x0,%edi
+  801518:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	8d 35 26 15 80 00    	lea    0x801526,%esi
+  801524:	0f 34                	sysenter
+  801526:	5d                   	pop    %ebp
+		goto out;
+  801527:	eb d3                	jmp    8014fc <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801529:	83 ec 0c             	sub    $0xc,%esp
+  80152c:	50                   	push   %eax
+  80152d:	6a 20                	push   $0x20
+  80152f:	68 6b 31 80 00       	push   $0x80316b
+  801534:	6a 3f                	push   $0x3f
+  801536:	68 88 31 80 00       	push   $0x803188
+  80153b:	e8 ff ec ff ff       	call   80023f <_panic>
+
+00801540 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	57                   	push   %edi
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801546:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80154d:	74 1b                	je     80156a <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80154f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801554:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801559:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155f:	89 df                	mov    %ebx,%edi
+  801561:	89 de                	mov    %ebx,%esi
+  801563:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801565:	5b                   	pop    %ebx
+  801566:	5e                   	pop    %esi
+  801567:	5f                   	pop    %edi
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80156a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801572:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801575:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80157a:	89 df                	mov    %ebx,%edi
+  80157c:	55                   	push   %ebp
+  80157d:	89 e5                	mov    %esp,%ebp
+  80157f:	8d 35 87 15 80 00    	lea    0x801587,%esi
+  801585:	0f 34                	sysenter
+  801587:	5d                   	pop    %ebp
+		goto out;
+  801588:	eb db                	jmp    801565 <sys_batch+0x25>
+
+0080158a <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80158a:	55                   	push   %ebp
+  80158b:	89 e5                	mov    %esp,%ebp
+  80158d:	57                   	push   %edi
+  80158e:	56                   	push   %esi
+  80158f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801590:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801597:	74 1a                	je     8015b3 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801599:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80159e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a6:	89 cb                	mov    %ecx,%ebx
+  8015a8:	89 cf                	mov    %ecx,%edi
+  8015aa:	89 ce                	mov    %ecx,%esi
+  8015ac:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8015ae:	5b                   	pop    %ebx
+  8015af:	5e                   	pop    %esi
+  8015b0:	5f                   	pop    %edi
+  8015b1:	5d                   	pop    %ebp
+  8015b2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015c0:	89 cb                	mov    %ecx,%ebx
+  8015c2:	89 cf                	mov    %ecx,%edi
+  8015c4:	55                   	push   %ebp
+  8015c5:	89 e5                	mov    %esp,%ebp
+  8015c7:	8d 35 cf 15 80 00    	lea    0x8015cf,%esi
+  8015cd:	0f 34                	sysenter
+  8015cf:	5d                   	pop    %ebp
+		goto out;
+  8015d0:	eb dc                	jmp    8015ae <sys_trace_ctl+0x24>
+
+008015d2 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8015d2:	55                   	push   %ebp
+  8015d3:	89 e5                	mov    %esp,%ebp
+  8015d5:	57                   	push   %edi
+  8015d6:	56                   	push   %esi
+  8015d7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015d8:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8015df:	74 1c                	je     8015fd <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8015e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f4:	89 f7                	mov    %esi,%edi
+  8015f6:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8015f8:	5b                   	pop    %ebx
+  8015f9:	5e                   	pop    %esi
+  8015fa:	5f                   	pop    %edi
+  8015fb:	5d                   	pop    %ebp
+  8015fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801600:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801603:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801608:	bf 00 00 00 00       	mov    $0x0,%edi
+  80160d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801610:	55                   	push   %ebp
+  801611:	89 e5                	mov    %esp,%ebp
+  801613:	8d 35 1b 16 80 00    	lea    0x80161b,%esi
+  801619:	0f 34                	sysenter
+  80161b:	5d                   	pop    %ebp
+		goto out;
+  80161c:	eb da                	jmp    8015f8 <sys_trace_read+0x26>
+
+0080161e <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80161e:	55                   	push   %ebp
+  80161f:	89 e5                	mov    %esp,%ebp
+  801621:	57                   	push   %edi
+  801622:	56                   	push   %esi
+  801623:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801624:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80162b:	74 1c                	je     801649 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80162d:	be 00 00 00 00       	mov    $0x0,%esi
+  801632:	b8 21 00 00 00       	mov    $0x21,%eax
+  801637:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801640:	89 f7                	mov    %esi,%edi
+  801642:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801644:	5b                   	pop    %ebx
+  801645:	5e                   	pop    %esi
+  801646:	5f                   	pop    %edi
+  801647:	5d                   	pop    %ebp
+  801648:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801649:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164f:	b8 21 00 00 00       	mov    $0x21,%eax
+  801654:	bf 00 00 00 00       	mov    $0x0,%edi
+  801659:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80165c:	55                   	push   %ebp
+  80165d:	89 e5                	mov    %esp,%ebp
+  80165f:	8d 35 67 16 80 00    	lea    0x801667,%esi
+  801665:	0f 34                	sysenter
+  801667:	5d                   	pop    %ebp
+		goto out;
+  801668:	eb da                	jmp    801644 <sys_meminfo+0x26>
+
+0080166a <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80166a:	55                   	push   %ebp
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	57                   	push   %edi
+  80166e:	56                   	push   %esi
+  80166f:	53                   	push   %ebx
+  801670:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801673:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801677:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80167e:	74 1f                	je     80169f <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801680:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801685:	b8 22 00 00 00       	mov    $0x22,%eax
+  80168a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168d:	89 df                	mov    %ebx,%edi
+  80168f:	89 de                	mov    %ebx,%esi
+  801691:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801693:	85 c0                	test   %eax,%eax
+  801695:	7f 25                	jg     8016bc <sys_env_set_ksm+0x52>
+}
+  801697:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169a:	5b                   	pop    %ebx
+  80169b:	5e                   	pop    %esi
+  80169c:	5f                   	pop    %edi
+  80169d:	5d                   	pop    %ebp
+  80169e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80169f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a7:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016ac:	89 df                	mov    %ebx,%edi
+  8016ae:	55                   	push   %ebp
+  8016af:	89 e5                	mov    %esp,%ebp
+  8016b1:	8d 35 b9 16 80 00    	lea    0x8016b9,%esi
+  8016b7:	0f 34                	sysenter
+  8016b9:	5d                   	pop    %ebp
+		goto out;
+  8016ba:	eb d7                	jmp    801693 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016bc:	83 ec 0c             	sub    $0xc,%esp
+  8016bf:	50                   	push   %eax
+  8016c0:	6a 22                	push   $0x22
+  8016c2:	68 6b 31 80 00       	push   $0x80316b
+  8016c7:	6a 3f                	push   $0x3f
+  8016c9:	68 88 31 80 00       	push   $0x803188
+  8016ce:	e8 6c eb ff ff       	call   80023f <_panic>
+
+008016d3 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	57                   	push   %edi
+  8016d7:	56                   	push   %esi
+  8016d8:	53                   	push   %ebx
+  8016d9:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8016dc:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8016df:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8016e6:	74 24                	je     80170c <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8016e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ed:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016f2:	89 cb                	mov    %ecx,%ebx
+  8016f4:	89 cf                	mov    %ecx,%edi
+  8016f6:	89 ce                	mov    %ecx,%esi
+  8016f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	7f 2a                	jg     801728 <sys_time_nsec+0x55>
+	return ns;
+}
+  8016fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801701:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801704:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801707:	5b                   	pop    %ebx
+  801708:	5e                   	pop    %esi
+  801709:	5f                   	pop    %edi
+  80170a:	5d                   	pop    %ebp
+  80170b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80170c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801711:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801716:	89 cb                	mov    %ecx,%ebx
+  801718:	89 cf                	mov    %ecx,%edi
+  80171a:	55                   	push   %ebp
+  80171b:	89 e5                	mov    %esp,%ebp
+  80171d:	8d 35 25 17 80 00    	lea    0x801725,%esi
+  801723:	0f 34                	sysenter
+  801725:	5d                   	pop    %ebp
+		goto out;
+  801726:	eb d2                	jmp    8016fa <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801728:	83 ec 0c             	sub    $0xc,%esp
+  80172b:	50                   	push   %eax
+  80172c:	6a 0f                	push   $0xf
+  80172e:	68 6b 31 80 00       	push   $0x80316b
+  801733:	6a 3f                	push   $0x3f
+  801735:	68 88 31 80 00       	push   $0x803188
+  80173a:	e8 00 eb ff ff       	call   80023f <_panic>
+
+0080173f <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80173f:	55                   	push   %ebp
+  801740:	89 e5                	mov    %esp,%ebp
+  801742:	57                   	push   %edi
+  801743:	56                   	push   %esi
+  801744:	53                   	push   %ebx
+  801745:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801748:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80174f:	74 22                	je     801773 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801751:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801756:	b8 12 00 00 00       	mov    $0x12,%eax
+  80175b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801761:	89 df                	mov    %ebx,%edi
+  801763:	89 de                	mov    %ebx,%esi
+  801765:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801767:	85 c0                	test   %eax,%eax
+  801769:	7f 28                	jg     801793 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80176b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176e:	5b                   	pop    %ebx
+  80176f:	5e                   	pop    %esi
+  801770:	5f                   	pop    %edi
+  801771:	5d                   	pop    %ebp
+  801772:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801773:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801778:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801783:	89 df                	mov    %ebx,%edi
+  801785:	55                   	push   %ebp
+  801786:	89 e5                	mov    %esp,%ebp
+  801788:	8d 35 90 17 80 00    	lea    0x801790,%esi
+  80178e:	0f 34                	sysenter
+  801790:	5d                   	pop    %ebp
+		goto out;
+  801791:	eb d4                	jmp    801767 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801793:	83 ec 0c             	sub    $0xc,%esp
+  801796:	50                   	push   %eax
+  801797:	6a 12                	push   $0x12
+  801799:	68 6b 31 80 00       	push   $0x80316b
+  80179e:	6a 3f                	push   $0x3f
+  8017a0:	68 88 31 80 00       	push   $0x803188
+  8017a5:	e8 95 ea ff ff       	call   80023f <_panic>
+
+008017aa <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8017aa:	55                   	push   %ebp
+  8017ab:	89 e5                	mov    %esp,%ebp
+  8017ad:	57                   	push   %edi
+  8017ae:	56                   	push   %esi
+  8017af:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017b0:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8017b7:	74 1b                	je     8017d4 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8017b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017be:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c9:	89 df                	mov    %ebx,%edi
+  8017cb:	89 de                	mov    %ebx,%esi
+  8017cd:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017cf:	5b                   	pop    %ebx
+  8017d0:	5e                   	pop    %esi
+  8017d1:	5f                   	pop    %edi
+  8017d2:	5d                   	pop    %ebp
+  8017d3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017df:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017e4:	89 df                	mov    %ebx,%edi
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+  8017e9:	8d 35 f1 17 80 00    	lea    0x8017f1,%esi
+  8017ef:	0f 34                	sysenter
+  8017f1:	5d                   	pop    %ebp
+		goto out;
+  8017f2:	eb db                	jmp    8017cf <sys_e1000_receive+0x25>
+
+008017f4 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8017f4:	55                   	push   %ebp
+  8017f5:	89 e5                	mov    %esp,%ebp
+  8017f7:	57                   	push   %edi
+  8017f8:	56                   	push   %esi
+  8017f9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017fa:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801801:	74 1b                	je     80181e <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801803:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801808:	b8 14 00 00 00       	mov    $0x14,%eax
+  80180d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801810:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801813:	89 df                	mov    %ebx,%edi
+  801815:	89 de                	mov    %ebx,%esi
+  801817:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801819:	5b                   	pop    %ebx
+  80181a:	5e                   	pop    %esi
+  80181b:	5f                   	pop    %edi
+  80181c:	5d                   	pop    %ebp
+  80181d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80181e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801823:	8b 55 08             	mov    0x8(%ebp),%edx
+  801826:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801829:	b8 14 00 00 00       	mov    $0x14,%eax
+  80182e:	89 df                	mov    %ebx,%edi
+  801830:	55                   	push   %ebp
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	8d 35 3b 18 80 00    	lea    0x80183b,%esi
+  801839:	0f 34                	sysenter
+  80183b:	5d                   	pop    %ebp
+		goto out;
+  80183c:	eb db                	jmp    801819 <sys_e1000_read_hwaddr+0x25>
+
+0080183e <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80183e:	55                   	push   %ebp
+  80183f:	89 e5                	mov    %esp,%ebp
+  801841:	57                   	push   %edi
+  801842:	56                   	push   %esi
+  801843:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801844:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80184b:	74 1a                	je     801867 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80184d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801852:	b8 15 00 00 00       	mov    $0x15,%eax
+  801857:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185a:	89 cb                	mov    %ecx,%ebx
+  80185c:	89 cf                	mov    %ecx,%edi
+  80185e:	89 ce                	mov    %ecx,%esi
+  801860:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801862:	5b                   	pop    %ebx
+  801863:	5e                   	pop    %esi
+  801864:	5f                   	pop    %edi
+  801865:	5d                   	pop    %ebp
+  801866:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801867:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80186f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801874:	89 cb                	mov    %ecx,%ebx
+  801876:	89 cf                	mov    %ecx,%edi
+  801878:	55                   	push   %ebp
+  801879:	89 e5                	mov    %esp,%ebp
+  80187b:	8d 35 83 18 80 00    	lea    0x801883,%esi
+  801881:	0f 34                	sysenter
+  801883:	5d                   	pop    %ebp
+		goto out;
+  801884:	eb dc                	jmp    801862 <sys_sb16_read_version+0x24>
+
+00801886 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801886:	55                   	push   %ebp
+  801887:	89 e5                	mov    %esp,%ebp
+  801889:	57                   	push   %edi
+  80188a:	56                   	push   %esi
+  80188b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80188c:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801893:	74 1b                	je     8018b0 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801895:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80189f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a5:	89 df                	mov    %ebx,%edi
+  8018a7:	89 de                	mov    %ebx,%esi
+  8018a9:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8018ab:	5b                   	pop    %ebx
+  8018ac:	5e                   	pop    %esi
+  8018ad:	5f                   	pop    %edi
+  8018ae:	5d                   	pop    %ebp
+  8018af:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018bb:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018c0:	89 df                	mov    %ebx,%edi
+  8018c2:	55                   	push   %ebp
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	8d 35 cd 18 80 00    	lea    0x8018cd,%esi
+  8018cb:	0f 34                	sysenter
+  8018cd:	5d                   	pop    %ebp
+		goto out;
+  8018ce:	eb db                	jmp    8018ab <sys_sb16_play+0x25>
+
+008018d0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018db:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018de:	5d                   	pop    %ebp
+  8018df:	c3                   	ret
+
+008018e0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018eb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018f0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018f5:	5d                   	pop    %ebp
+  8018f6:	c3                   	ret
+
+008018f7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018f7:	55                   	push   %ebp
+  8018f8:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018fa:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018ff:	eb 02                	jmp    801903 <fd_alloc+0xc>
+  801901:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801903:	89 c2                	mov    %eax,%edx
+  801905:	c1 ea 16             	shr    $0x16,%edx
+  801908:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80190f:	f6 c2 01             	test   $0x1,%dl
+  801912:	74 2b                	je     80193f <fd_alloc+0x48>
+  801914:	89 c2                	mov    %eax,%edx
+  801916:	c1 ea 0c             	shr    $0xc,%edx
+  801919:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801920:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801926:	f6 c1 01             	test   $0x1,%cl
+  801929:	74 14                	je     80193f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80192b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801931:	75 ce                	jne    801901 <fd_alloc+0xa>
+  801933:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801938:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80193d:	eb 05                	jmp    801944 <fd_alloc+0x4d>
+			return 0;
+  80193f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801944:	8b 55 08             	mov    0x8(%ebp),%edx
+  801947:	89 02                	mov    %eax,(%edx)
+}
+  801949:	89 c8                	mov    %ecx,%eax
+  80194b:	5d                   	pop    %ebp
+  80194c:	c3                   	ret
+
+0080194d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80194d:	55                   	push   %ebp
+  80194e:	89 e5                	mov    %esp,%ebp
+  801950:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801953:	83 f8 1f             	cmp    $0x1f,%eax
+  801956:	77 30                	ja     801988 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801958:	c1 e0 0c             	shl    $0xc,%eax
+  80195b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801960:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801966:	f6 c2 01             	test   $0x1,%dl
+  801969:	74 24                	je     80198f <fd_lookup+0x42>
+  80196b:	89 c2                	mov    %eax,%edx
+  80196d:	c1 ea 0c             	shr    $0xc,%edx
+  801970:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801977:	f6 c2 01             	test   $0x1,%dl
+  80197a:	74 1a                	je     801996 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80197c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80197f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801981:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801986:	5d                   	pop    %ebp
+  801987:	c3                   	ret
+		return -E_INVAL;
+  801988:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80198d:	eb f7                	jmp    801986 <fd_lookup+0x39>
+		return -E_INVAL;
+  80198f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801994:	eb f0                	jmp    801986 <fd_lookup+0x39>
+  801996:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80199b:	eb e9                	jmp    801986 <fd_lookup+0x39>
+
+0080199d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80199d:	55                   	push   %ebp
+  80199e:	89 e5                	mov    %esp,%ebp
+  8019a0:	53                   	push   %ebx
+  8019a1:	83 ec 04             	sub    $0x4,%esp
+  8019a4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8019a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ac:	eb 03                	jmp    8019b1 <dev_lookup+0x14>
+  8019ae:	83 c0 01             	add    $0x1,%eax
+  8019b1:	8b 1c 85 14 32 80 00 	mov    0x803214(,%eax,4),%ebx
+  8019b8:	85 db                	test   %ebx,%ebx
+  8019ba:	74 0b                	je     8019c7 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8019bc:	39 13                	cmp    %edx,(%ebx)
+  8019be:	75 ee                	jne    8019ae <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8019c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c5:	eb 2e                	jmp    8019f5 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8019c7:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8019c9:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8019ce:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8019d4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8019d9:	76 24                	jbe    8019ff <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019db:	8b 41 48             	mov    0x48(%ecx),%eax
+  8019de:	83 ec 04             	sub    $0x4,%esp
+  8019e1:	52                   	push   %edx
+  8019e2:	50                   	push   %eax
+  8019e3:	68 98 31 80 00       	push   $0x803198
+  8019e8:	e8 2d e9 ff ff       	call   80031a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019ed:	83 c4 10             	add    $0x10,%esp
+  8019f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f8:	89 1a                	mov    %ebx,(%edx)
+}
+  8019fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019fd:	c9                   	leave
+  8019fe:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8019ff:	c1 e8 10             	shr    $0x10,%eax
+  801a02:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801a08:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801a0e:	eb cb                	jmp    8019db <dev_lookup+0x3e>
+
+00801a10 <fd_close>:
+{
+  801a10:	55                   	push   %ebp
+  801a11:	89 e5                	mov    %esp,%ebp
+  801a13:	57                   	push   %edi
+  801a14:	56                   	push   %esi
+  801a15:	53                   	push   %ebx
+  801a16:	83 ec 24             	sub    $0x24,%esp
+  801a19:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a1c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a1f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a22:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a23:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a29:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a2c:	50                   	push   %eax
+  801a2d:	e8 1b ff ff ff       	call   80194d <fd_lookup>
+  801a32:	89 c3                	mov    %eax,%ebx
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	78 05                	js     801a40 <fd_close+0x30>
+	    || fd != fd2)
+  801a3b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a3e:	74 16                	je     801a56 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a40:	89 f8                	mov    %edi,%eax
+  801a42:	84 c0                	test   %al,%al
+  801a44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a49:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a4c:	89 d8                	mov    %ebx,%eax
+  801a4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a51:	5b                   	pop    %ebx
+  801a52:	5e                   	pop    %esi
+  801a53:	5f                   	pop    %edi
+  801a54:	5d                   	pop    %ebp
+  801a55:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a56:	83 ec 08             	sub    $0x8,%esp
+  801a59:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a5c:	50                   	push   %eax
+  801a5d:	ff 36                	push   (%esi)
+  801a5f:	e8 39 ff ff ff       	call   80199d <dev_lookup>
+  801a64:	89 c3                	mov    %eax,%ebx
+  801a66:	83 c4 10             	add    $0x10,%esp
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	78 1a                	js     801a87 <fd_close+0x77>
+		if (dev->dev_close)
+  801a6d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a70:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a73:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a78:	85 c0                	test   %eax,%eax
+  801a7a:	74 0b                	je     801a87 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a7c:	83 ec 0c             	sub    $0xc,%esp
+  801a7f:	56                   	push   %esi
+  801a80:	ff d0                	call   *%eax
+  801a82:	89 c3                	mov    %eax,%ebx
+  801a84:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a87:	83 ec 08             	sub    $0x8,%esp
+  801a8a:	56                   	push   %esi
+  801a8b:	6a 00                	push   $0x0
+  801a8d:	e8 a3 f4 ff ff       	call   800f35 <sys_page_unmap>
+	return r;
+  801a92:	83 c4 10             	add    $0x10,%esp
+  801a95:	eb b5                	jmp    801a4c <fd_close+0x3c>
+
+00801a97 <close>:
+
+int
+close(int fdnum)
+{
+  801a97:	55                   	push   %ebp
+  801a98:	89 e5                	mov    %esp,%ebp
+  801a9a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a9d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa0:	50                   	push   %eax
+  801aa1:	ff 75 08             	push   0x8(%ebp)
+  801aa4:	e8 a4 fe ff ff       	call   80194d <fd_lookup>
+  801aa9:	83 c4 10             	add    $0x10,%esp
+  801aac:	85 c0                	test   %eax,%eax
+  801aae:	79 02                	jns    801ab2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ab0:	c9                   	leave
+  801ab1:	c3                   	ret
+		return fd_close(fd, 1);
+  801ab2:	83 ec 08             	sub    $0x8,%esp
+  801ab5:	6a 01                	push   $0x1
+  801ab7:	ff 75 f4             	push   -0xc(%ebp)
+  801aba:	e8 51 ff ff ff       	call   801a10 <fd_close>
+  801abf:	83 c4 10             	add    $0x10,%esp
+  801ac2:	eb ec                	jmp    801ab0 <close+0x19>
+
+00801ac4 <close_all>:
+
+void
+close_all(void)
+{
+  801ac4:	55                   	push   %ebp
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	53                   	push   %ebx
+  801ac8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801acb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801ad0:	83 ec 0c             	sub    $0xc,%esp
+  801ad3:	53                   	push   %ebx
+  801ad4:	e8 be ff ff ff       	call   801a97 <close>
+	for (i = 0; i < MAXFD; i++)
+  801ad9:	83 c3 01             	add    $0x1,%ebx
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	83 fb 20             	cmp    $0x20,%ebx
+  801ae2:	75 ec                	jne    801ad0 <close_all+0xc>
+}
+  801ae4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+00801ae9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ae9:	55                   	push   %ebp
+  801aea:	89 e5                	mov    %esp,%ebp
+  801aec:	57                   	push   %edi
+  801aed:	56                   	push   %esi
+  801aee:	53                   	push   %ebx
+  801aef:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801af2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801af5:	50                   	push   %eax
+  801af6:	ff 75 08             	push   0x8(%ebp)
+  801af9:	e8 4f fe ff ff       	call   80194d <fd_lookup>
+  801afe:	89 c3                	mov    %eax,%ebx
+  801b00:	83 c4 10             	add    $0x10,%esp
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	78 7f                	js     801b86 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b07:	83 ec 0c             	sub    $0xc,%esp
+  801b0a:	ff 75 0c             	push   0xc(%ebp)
+  801b0d:	e8 85 ff ff ff       	call   801a97 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b12:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b15:	c1 e6 0c             	shl    $0xc,%esi
+  801b18:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b1e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b21:	89 3c 24             	mov    %edi,(%esp)
+  801b24:	e8 b7 fd ff ff       	call   8018e0 <fd2data>
+  801b29:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b2b:	89 34 24             	mov    %esi,(%esp)
+  801b2e:	e8 ad fd ff ff       	call   8018e0 <fd2data>
+  801b33:	83 c4 10             	add    $0x10,%esp
+  801b36:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b39:	89 d8                	mov    %ebx,%eax
+  801b3b:	c1 e8 16             	shr    $0x16,%eax
+  801b3e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b45:	a8 01                	test   $0x1,%al
+  801b47:	74 11                	je     801b5a <dup+0x71>
+  801b49:	89 d8                	mov    %ebx,%eax
+  801b4b:	c1 e8 0c             	shr    $0xc,%eax
+  801b4e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b55:	f6 c2 01             	test   $0x1,%dl
+  801b58:	75 36                	jne    801b90 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b5a:	89 f8                	mov    %edi,%eax
+  801b5c:	c1 e8 0c             	shr    $0xc,%eax
+  801b5f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b66:	83 ec 0c             	sub    $0xc,%esp
+  801b69:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b6e:	50                   	push   %eax
+  801b6f:	56                   	push   %esi
+  801b70:	6a 00                	push   $0x0
+  801b72:	57                   	push   %edi
+  801b73:	6a 00                	push   $0x0
+  801b75:	e8 4d f3 ff ff       	call   800ec7 <sys_page_map>
+  801b7a:	89 c3                	mov    %eax,%ebx
+  801b7c:	83 c4 20             	add    $0x20,%esp
+  801b7f:	85 c0                	test   %eax,%eax
+  801b81:	78 33                	js     801bb6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b83:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b86:	89 d8                	mov    %ebx,%eax
+  801b88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8b:	5b                   	pop    %ebx
+  801b8c:	5e                   	pop    %esi
+  801b8d:	5f                   	pop    %edi
+  801b8e:	5d                   	pop    %ebp
+  801b8f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b90:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b97:	83 ec 0c             	sub    $0xc,%esp
+  801b9a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b9f:	50                   	push   %eax
+  801ba0:	ff 75 d4             	push   -0x2c(%ebp)
+  801ba3:	6a 00                	push   $0x0
+  801ba5:	53                   	push   %ebx
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	e8 1a f3 ff ff       	call   800ec7 <sys_page_map>
+  801bad:	89 c3                	mov    %eax,%ebx
+  801baf:	83 c4 20             	add    $0x20,%esp
+  801bb2:	85 c0                	test   %eax,%eax
+  801bb4:	79 a4                	jns    801b5a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bb6:	83 ec 08             	sub    $0x8,%esp
+  801bb9:	56                   	push   %esi
+  801bba:	6a 00                	push   $0x0
+  801bbc:	e8 74 f3 ff ff       	call   800f35 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801bc1:	83 c4 08             	add    $0x8,%esp
+  801bc4:	ff 75 d4             	push   -0x2c(%ebp)
+  801bc7:	6a 00                	push   $0x0
+  801bc9:	e8 67 f3 ff ff       	call   800f35 <sys_page_unmap>
+	return r;
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	eb b3                	jmp    801b86 <dup+0x9d>
+
+00801bd3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801bd3:	55                   	push   %ebp
+  801bd4:	89 e5                	mov    %esp,%ebp
+  801bd6:	56                   	push   %esi
+  801bd7:	53                   	push   %ebx
+  801bd8:	83 ec 18             	sub    $0x18,%esp
+  801bdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bde:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801be1:	50                   	push   %eax
+  801be2:	53                   	push   %ebx
+  801be3:	e8 65 fd ff ff       	call   80194d <fd_lookup>
+  801be8:	83 c4 10             	add    $0x10,%esp
+  801beb:	85 c0                	test   %eax,%eax
+  801bed:	78 3c                	js     801c2b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bf2:	83 ec 08             	sub    $0x8,%esp
+  801bf5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bf8:	50                   	push   %eax
+  801bf9:	ff 36                	push   (%esi)
+  801bfb:	e8 9d fd ff ff       	call   80199d <dev_lookup>
+  801c00:	83 c4 10             	add    $0x10,%esp
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	78 24                	js     801c2b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c07:	8b 46 08             	mov    0x8(%esi),%eax
+  801c0a:	83 e0 03             	and    $0x3,%eax
+  801c0d:	83 f8 01             	cmp    $0x1,%eax
+  801c10:	74 20                	je     801c32 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c15:	8b 40 08             	mov    0x8(%eax),%eax
+  801c18:	85 c0                	test   %eax,%eax
+  801c1a:	74 57                	je     801c73 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c1c:	83 ec 04             	sub    $0x4,%esp
+  801c1f:	ff 75 10             	push   0x10(%ebp)
+  801c22:	ff 75 0c             	push   0xc(%ebp)
+  801c25:	56                   	push   %esi
+  801c26:	ff d0                	call   *%eax
+  801c28:	83 c4 10             	add    $0x10,%esp
+}
+  801c2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c2e:	5b                   	pop    %ebx
+  801c2f:	5e                   	pop    %esi
+  801c30:	5d                   	pop    %ebp
+  801c31:	c3                   	ret
+  801c32:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c34:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c39:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c3f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c44:	76 1c                	jbe    801c62 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c46:	8b 42 48             	mov    0x48(%edx),%eax
+  801c49:	83 ec 04             	sub    $0x4,%esp
+  801c4c:	53                   	push   %ebx
+  801c4d:	50                   	push   %eax
+  801c4e:	68 d9 31 80 00       	push   $0x8031d9
+  801c53:	e8 c2 e6 ff ff       	call   80031a <cprintf>
+		return -E_INVAL;
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c60:	eb c9                	jmp    801c2b <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c62:	c1 e8 10             	shr    $0x10,%eax
+  801c65:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c6b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c71:	eb d3                	jmp    801c46 <read+0x73>
+		return -E_NOT_SUPP;
+  801c73:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c78:	eb b1                	jmp    801c2b <read+0x58>
+
+00801c7a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	57                   	push   %edi
+  801c7e:	56                   	push   %esi
+  801c7f:	53                   	push   %ebx
+  801c80:	83 ec 0c             	sub    $0xc,%esp
+  801c83:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c86:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8e:	eb 02                	jmp    801c92 <readn+0x18>
+  801c90:	01 c3                	add    %eax,%ebx
+  801c92:	39 f3                	cmp    %esi,%ebx
+  801c94:	73 21                	jae    801cb7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c96:	83 ec 04             	sub    $0x4,%esp
+  801c99:	89 f0                	mov    %esi,%eax
+  801c9b:	29 d8                	sub    %ebx,%eax
+  801c9d:	50                   	push   %eax
+  801c9e:	89 d8                	mov    %ebx,%eax
+  801ca0:	03 45 0c             	add    0xc(%ebp),%eax
+  801ca3:	50                   	push   %eax
+  801ca4:	57                   	push   %edi
+  801ca5:	e8 29 ff ff ff       	call   801bd3 <read>
+		if (m < 0)
+  801caa:	83 c4 10             	add    $0x10,%esp
+  801cad:	85 c0                	test   %eax,%eax
+  801caf:	78 04                	js     801cb5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801cb1:	75 dd                	jne    801c90 <readn+0x16>
+  801cb3:	eb 02                	jmp    801cb7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cb5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801cb7:	89 d8                	mov    %ebx,%eax
+  801cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbc:	5b                   	pop    %ebx
+  801cbd:	5e                   	pop    %esi
+  801cbe:	5f                   	pop    %edi
+  801cbf:	5d                   	pop    %ebp
+  801cc0:	c3                   	ret
+
+00801cc1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	56                   	push   %esi
+  801cc5:	53                   	push   %ebx
+  801cc6:	83 ec 18             	sub    $0x18,%esp
+  801cc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ccc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ccf:	50                   	push   %eax
+  801cd0:	53                   	push   %ebx
+  801cd1:	e8 77 fc ff ff       	call   80194d <fd_lookup>
+  801cd6:	83 c4 10             	add    $0x10,%esp
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	78 37                	js     801d14 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cdd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ce0:	83 ec 08             	sub    $0x8,%esp
+  801ce3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce6:	50                   	push   %eax
+  801ce7:	ff 36                	push   (%esi)
+  801ce9:	e8 af fc ff ff       	call   80199d <dev_lookup>
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 1f                	js     801d14 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cf5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cf9:	74 20                	je     801d1b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cfe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d01:	85 c0                	test   %eax,%eax
+  801d03:	74 57                	je     801d5c <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d05:	83 ec 04             	sub    $0x4,%esp
+  801d08:	ff 75 10             	push   0x10(%ebp)
+  801d0b:	ff 75 0c             	push   0xc(%ebp)
+  801d0e:	56                   	push   %esi
+  801d0f:	ff d0                	call   *%eax
+  801d11:	83 c4 10             	add    $0x10,%esp
+}
+  801d14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d17:	5b                   	pop    %ebx
+  801d18:	5e                   	pop    %esi
+  801d19:	5d                   	pop    %ebp
+  801d1a:	c3                   	ret
+  801d1b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d1d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d22:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d28:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d2d:	76 1c                	jbe    801d4b <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d2f:	8b 42 48             	mov    0x48(%edx),%eax
+  801d32:	83 ec 04             	sub    $0x4,%esp
+  801d35:	53                   	push   %ebx
+  801d36:	50                   	push   %eax
+  801d37:	68 f5 31 80 00       	push   $0x8031f5
+  801d3c:	e8 d9 e5 ff ff       	call   80031a <cprintf>
+		return -E_INVAL;
+  801d41:	83 c4 10             	add    $0x10,%esp
+  801d44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d49:	eb c9                	jmp    801d14 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d4b:	c1 e8 10             	shr    $0x10,%eax
+  801d4e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d54:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d5a:	eb d3                	jmp    801d2f <write+0x6e>
+		return -E_NOT_SUPP;
+  801d5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d61:	eb b1                	jmp    801d14 <write+0x53>
+
+00801d63 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d63:	55                   	push   %ebp
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6c:	50                   	push   %eax
+  801d6d:	ff 75 08             	push   0x8(%ebp)
+  801d70:	e8 d8 fb ff ff       	call   80194d <fd_lookup>
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 0e                	js     801d8a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d82:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d8a:	c9                   	leave
+  801d8b:	c3                   	ret
+
+00801d8c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 18             	sub    $0x18,%esp
+  801d94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d9a:	50                   	push   %eax
+  801d9b:	53                   	push   %ebx
+  801d9c:	e8 ac fb ff ff       	call   80194d <fd_lookup>
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 34                	js     801ddc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801da8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dab:	83 ec 08             	sub    $0x8,%esp
+  801dae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db1:	50                   	push   %eax
+  801db2:	ff 36                	push   (%esi)
+  801db4:	e8 e4 fb ff ff       	call   80199d <dev_lookup>
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 1c                	js     801ddc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dc0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dc4:	74 1d                	je     801de3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801dc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc9:	8b 40 18             	mov    0x18(%eax),%eax
+  801dcc:	85 c0                	test   %eax,%eax
+  801dce:	74 54                	je     801e24 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801dd0:	83 ec 08             	sub    $0x8,%esp
+  801dd3:	ff 75 0c             	push   0xc(%ebp)
+  801dd6:	56                   	push   %esi
+  801dd7:	ff d0                	call   *%eax
+  801dd9:	83 c4 10             	add    $0x10,%esp
+}
+  801ddc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ddf:	5b                   	pop    %ebx
+  801de0:	5e                   	pop    %esi
+  801de1:	5d                   	pop    %ebp
+  801de2:	c3                   	ret
+  801de3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801de5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801dea:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801df0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801df5:	76 1c                	jbe    801e13 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801df7:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dfa:	83 ec 04             	sub    $0x4,%esp
+  801dfd:	53                   	push   %ebx
+  801dfe:	50                   	push   %eax
+  801dff:	68 b8 31 80 00       	push   $0x8031b8
+  801e04:	e8 11 e5 ff ff       	call   80031a <cprintf>
+		return -E_INVAL;
+  801e09:	83 c4 10             	add    $0x10,%esp
+  801e0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e11:	eb c9                	jmp    801ddc <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e13:	c1 e8 10             	shr    $0x10,%eax
+  801e16:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e1c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e22:	eb d3                	jmp    801df7 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801e24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e29:	eb b1                	jmp    801ddc <ftruncate+0x50>
+
+00801e2b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e2b:	55                   	push   %ebp
+  801e2c:	89 e5                	mov    %esp,%ebp
+  801e2e:	56                   	push   %esi
+  801e2f:	53                   	push   %ebx
+  801e30:	83 ec 18             	sub    $0x18,%esp
+  801e33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e36:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e39:	50                   	push   %eax
+  801e3a:	ff 75 08             	push   0x8(%ebp)
+  801e3d:	e8 0b fb ff ff       	call   80194d <fd_lookup>
+  801e42:	83 c4 10             	add    $0x10,%esp
+  801e45:	85 c0                	test   %eax,%eax
+  801e47:	78 49                	js     801e92 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e49:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e4c:	83 ec 08             	sub    $0x8,%esp
+  801e4f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e52:	50                   	push   %eax
+  801e53:	ff 36                	push   (%esi)
+  801e55:	e8 43 fb ff ff       	call   80199d <dev_lookup>
+  801e5a:	83 c4 10             	add    $0x10,%esp
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	78 31                	js     801e92 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e64:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e68:	74 2f                	je     801e99 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e6a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e6d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e74:	00 00 00 
+	stat->st_isdir = 0;
+  801e77:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e7e:	00 00 00 
+	stat->st_dev = dev;
+  801e81:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e87:	83 ec 08             	sub    $0x8,%esp
+  801e8a:	53                   	push   %ebx
+  801e8b:	56                   	push   %esi
+  801e8c:	ff 50 14             	call   *0x14(%eax)
+  801e8f:	83 c4 10             	add    $0x10,%esp
+}
+  801e92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e95:	5b                   	pop    %ebx
+  801e96:	5e                   	pop    %esi
+  801e97:	5d                   	pop    %ebp
+  801e98:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e99:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e9e:	eb f2                	jmp    801e92 <fstat+0x67>
+
+00801ea0 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ea0:	55                   	push   %ebp
+  801ea1:	89 e5                	mov    %esp,%ebp
+  801ea3:	56                   	push   %esi
+  801ea4:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801ea5:	83 ec 08             	sub    $0x8,%esp
+  801ea8:	6a 00                	push   $0x0
+  801eaa:	ff 75 08             	push   0x8(%ebp)
+  801ead:	e8 e4 01 00 00       	call   802096 <open>
+  801eb2:	89 c3                	mov    %eax,%ebx
+  801eb4:	83 c4 10             	add    $0x10,%esp
+  801eb7:	85 c0                	test   %eax,%eax
+  801eb9:	78 1b                	js     801ed6 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801ebb:	83 ec 08             	sub    $0x8,%esp
+  801ebe:	ff 75 0c             	push   0xc(%ebp)
+  801ec1:	50                   	push   %eax
+  801ec2:	e8 64 ff ff ff       	call   801e2b <fstat>
+  801ec7:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ec9:	89 1c 24             	mov    %ebx,(%esp)
+  801ecc:	e8 c6 fb ff ff       	call   801a97 <close>
+	return r;
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	89 f3                	mov    %esi,%ebx
+}
+  801ed6:	89 d8                	mov    %ebx,%eax
+  801ed8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edb:	5b                   	pop    %ebx
+  801edc:	5e                   	pop    %esi
+  801edd:	5d                   	pop    %ebp
+  801ede:	c3                   	ret
+
+00801edf <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801edf:	55                   	push   %ebp
+  801ee0:	89 e5                	mov    %esp,%ebp
+  801ee2:	56                   	push   %esi
+  801ee3:	53                   	push   %ebx
+  801ee4:	89 c6                	mov    %eax,%esi
+  801ee6:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ee8:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  801eef:	74 27                	je     801f18 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ef1:	6a 07                	push   $0x7
+  801ef3:	68 00 60 80 00       	push   $0x806000
+  801ef8:	56                   	push   %esi
+  801ef9:	ff 35 04 50 80 00    	push   0x805004
+  801eff:	e8 c6 0d 00 00       	call   802cca <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801f04:	83 c4 0c             	add    $0xc,%esp
+  801f07:	6a 00                	push   $0x0
+  801f09:	53                   	push   %ebx
+  801f0a:	6a 00                	push   $0x0
+  801f0c:	e8 a1 0d 00 00       	call   802cb2 <ipc_recv>
+}
+  801f11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f14:	5b                   	pop    %ebx
+  801f15:	5e                   	pop    %esi
+  801f16:	5d                   	pop    %ebp
+  801f17:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f18:	83 ec 0c             	sub    $0xc,%esp
+  801f1b:	6a 01                	push   $0x1
+  801f1d:	e8 fc 0d 00 00       	call   802d1e <ipc_find_env>
+  801f22:	a3 04 50 80 00       	mov    %eax,0x805004
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	eb c5                	jmp    801ef1 <fsipc+0x12>
+
+00801f2c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f35:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f38:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801f3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f40:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f4f:	e8 8b ff ff ff       	call   801edf <fsipc>
+}
+  801f54:	c9                   	leave
+  801f55:	c3                   	ret
+
+00801f56 <devfile_flush>:
+{
+  801f56:	55                   	push   %ebp
+  801f57:	89 e5                	mov    %esp,%ebp
+  801f59:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f62:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f67:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f71:	e8 69 ff ff ff       	call   801edf <fsipc>
+}
+  801f76:	c9                   	leave
+  801f77:	c3                   	ret
+
+00801f78 <devfile_stat>:
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	53                   	push   %ebx
+  801f7c:	83 ec 04             	sub    $0x4,%esp
+  801f7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f85:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f88:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f92:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f97:	e8 43 ff ff ff       	call   801edf <fsipc>
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	78 2c                	js     801fcc <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fa0:	83 ec 08             	sub    $0x8,%esp
+  801fa3:	68 00 60 80 00       	push   $0x806000
+  801fa8:	53                   	push   %ebx
+  801fa9:	e8 b4 e9 ff ff       	call   800962 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801fae:	a1 80 60 80 00       	mov    0x806080,%eax
+  801fb3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fb9:	a1 84 60 80 00       	mov    0x806084,%eax
+  801fbe:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801fc4:	83 c4 10             	add    $0x10,%esp
+  801fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcf:	c9                   	leave
+  801fd0:	c3                   	ret
+
+00801fd1 <devfile_write>:
+{
+  801fd1:	55                   	push   %ebp
+  801fd2:	89 e5                	mov    %esp,%ebp
+  801fd4:	83 ec 0c             	sub    $0xc,%esp
+  801fd7:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fda:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fdd:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fe0:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801fe6:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801feb:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ff0:	39 d0                	cmp    %edx,%eax
+  801ff2:	0f 47 c2             	cmova  %edx,%eax
+  801ff5:	50                   	push   %eax
+  801ff6:	ff 75 0c             	push   0xc(%ebp)
+  801ff9:	68 08 60 80 00       	push   $0x806008
+  801ffe:	e8 e5 ea ff ff       	call   800ae8 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802003:	ba 00 00 00 00       	mov    $0x0,%edx
+  802008:	b8 04 00 00 00       	mov    $0x4,%eax
+  80200d:	e8 cd fe ff ff       	call   801edf <fsipc>
+}
+  802012:	c9                   	leave
+  802013:	c3                   	ret
+
+00802014 <devfile_read>:
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	56                   	push   %esi
+  802018:	53                   	push   %ebx
+  802019:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80201c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802022:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802027:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80202d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802032:	b8 03 00 00 00       	mov    $0x3,%eax
+  802037:	e8 a3 fe ff ff       	call   801edf <fsipc>
+  80203c:	89 c3                	mov    %eax,%ebx
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	78 1f                	js     802061 <devfile_read+0x4d>
+	assert(r <= n);
+  802042:	39 c6                	cmp    %eax,%esi
+  802044:	72 24                	jb     80206a <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802046:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80204b:	7f 33                	jg     802080 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80204d:	83 ec 04             	sub    $0x4,%esp
+  802050:	50                   	push   %eax
+  802051:	68 00 60 80 00       	push   $0x806000
+  802056:	ff 75 0c             	push   0xc(%ebp)
+  802059:	e8 8a ea ff ff       	call   800ae8 <memmove>
+	return r;
+  80205e:	83 c4 10             	add    $0x10,%esp
+}
+  802061:	89 d8                	mov    %ebx,%eax
+  802063:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802066:	5b                   	pop    %ebx
+  802067:	5e                   	pop    %esi
+  802068:	5d                   	pop    %ebp
+  802069:	c3                   	ret
+	assert(r <= n);
+  80206a:	68 28 32 80 00       	push   $0x803228
+  80206f:	68 2f 32 80 00       	push   $0x80322f
+  802074:	6a 76                	push   $0x76
+  802076:	68 44 32 80 00       	push   $0x803244
+  80207b:	e8 bf e1 ff ff       	call   80023f <_panic>
+	assert(r <= PGSIZE);
+  802080:	68 4f 32 80 00       	push   $0x80324f
+  802085:	68 2f 32 80 00       	push   $0x80322f
+  80208a:	6a 77                	push   $0x77
+  80208c:	68 44 32 80 00       	push   $0x803244
+  802091:	e8 a9 e1 ff ff       	call   80023f <_panic>
+
+00802096 <open>:
+{
+  802096:	55                   	push   %ebp
+  802097:	89 e5                	mov    %esp,%ebp
+  802099:	56                   	push   %esi
+  80209a:	53                   	push   %ebx
+  80209b:	83 ec 1c             	sub    $0x1c,%esp
+  80209e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8020a1:	56                   	push   %esi
+  8020a2:	e8 80 e8 ff ff       	call   800927 <strlen>
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020af:	7f 6c                	jg     80211d <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8020b1:	83 ec 0c             	sub    $0xc,%esp
+  8020b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020b7:	50                   	push   %eax
+  8020b8:	e8 3a f8 ff ff       	call   8018f7 <fd_alloc>
+  8020bd:	89 c3                	mov    %eax,%ebx
+  8020bf:	83 c4 10             	add    $0x10,%esp
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	78 3c                	js     802102 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8020c6:	83 ec 08             	sub    $0x8,%esp
+  8020c9:	56                   	push   %esi
+  8020ca:	68 00 60 80 00       	push   $0x806000
+  8020cf:	e8 8e e8 ff ff       	call   800962 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020d7:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020e4:	e8 f6 fd ff ff       	call   801edf <fsipc>
+  8020e9:	89 c3                	mov    %eax,%ebx
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	78 19                	js     80210b <open+0x75>
+	return fd2num(fd);
+  8020f2:	83 ec 0c             	sub    $0xc,%esp
+  8020f5:	ff 75 f4             	push   -0xc(%ebp)
+  8020f8:	e8 d3 f7 ff ff       	call   8018d0 <fd2num>
+  8020fd:	89 c3                	mov    %eax,%ebx
+  8020ff:	83 c4 10             	add    $0x10,%esp
+}
+  802102:	89 d8                	mov    %ebx,%eax
+  802104:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802107:	5b                   	pop    %ebx
+  802108:	5e                   	pop    %esi
+  802109:	5d                   	pop    %ebp
+  80210a:	c3                   	ret
+		fd_close(fd, 0);
+  80210b:	83 ec 08             	sub    $0x8,%esp
+  80210e:	6a 00                	push   $0x0
+  802110:	ff 75 f4             	push   -0xc(%ebp)
+  802113:	e8 f8 f8 ff ff       	call   801a10 <fd_close>
+		return r;
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	eb e5                	jmp    802102 <open+0x6c>
+		return -E_BAD_PATH;
+  80211d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802122:	eb de                	jmp    802102 <open+0x6c>
+
+00802124 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802124:	55                   	push   %ebp
+  802125:	89 e5                	mov    %esp,%ebp
+  802127:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80212a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802134:	e8 a6 fd ff ff       	call   801edf <fsipc>
+}
+  802139:	c9                   	leave
+  80213a:	c3                   	ret
+
+0080213b <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  80213b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80213f:	7f 01                	jg     802142 <writebuf+0x7>
+  802141:	c3                   	ret
+{
+  802142:	55                   	push   %ebp
+  802143:	89 e5                	mov    %esp,%ebp
+  802145:	53                   	push   %ebx
+  802146:	83 ec 08             	sub    $0x8,%esp
+  802149:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80214b:	ff 70 04             	push   0x4(%eax)
+  80214e:	8d 40 10             	lea    0x10(%eax),%eax
+  802151:	50                   	push   %eax
+  802152:	ff 33                	push   (%ebx)
+  802154:	e8 68 fb ff ff       	call   801cc1 <write>
+		if (result > 0)
+  802159:	83 c4 10             	add    $0x10,%esp
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	7e 03                	jle    802163 <writebuf+0x28>
+			b->result += result;
+  802160:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802163:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802166:	74 0d                	je     802175 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802168:	85 c0                	test   %eax,%eax
+  80216a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216f:	0f 4f c2             	cmovg  %edx,%eax
+  802172:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802175:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802178:	c9                   	leave
+  802179:	c3                   	ret
+
+0080217a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80217a:	55                   	push   %ebp
+  80217b:	89 e5                	mov    %esp,%ebp
+  80217d:	53                   	push   %ebx
+  80217e:	83 ec 04             	sub    $0x4,%esp
+  802181:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802184:	8b 53 04             	mov    0x4(%ebx),%edx
+  802187:	8d 42 01             	lea    0x1(%edx),%eax
+  80218a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80218d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802190:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802194:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802199:	74 05                	je     8021a0 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80219b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219e:	c9                   	leave
+  80219f:	c3                   	ret
+		writebuf(b);
+  8021a0:	89 d8                	mov    %ebx,%eax
+  8021a2:	e8 94 ff ff ff       	call   80213b <writebuf>
+		b->idx = 0;
+  8021a7:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8021ae:	eb eb                	jmp    80219b <putch+0x21>
+
+008021b0 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  8021b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bc:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8021c2:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8021c9:	00 00 00 
+	b.result = 0;
+  8021cc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8021d3:	00 00 00 
+	b.error = 1;
+  8021d6:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8021dd:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8021e0:	ff 75 10             	push   0x10(%ebp)
+  8021e3:	ff 75 0c             	push   0xc(%ebp)
+  8021e6:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8021ec:	50                   	push   %eax
+  8021ed:	68 7a 21 80 00       	push   $0x80217a
+  8021f2:	e8 01 e2 ff ff       	call   8003f8 <vprintfmt>
+	if (b.idx > 0)
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802201:	7f 12                	jg     802215 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802203:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	75 06                	jne    802213 <vfprintf+0x63>
+  80220d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802213:	c9                   	leave
+  802214:	c3                   	ret
+		writebuf(&b);
+  802215:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80221b:	e8 1b ff ff ff       	call   80213b <writebuf>
+  802220:	eb e1                	jmp    802203 <vfprintf+0x53>
+
+00802222 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802228:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  80222b:	50                   	push   %eax
+  80222c:	ff 75 0c             	push   0xc(%ebp)
+  80222f:	ff 75 08             	push   0x8(%ebp)
+  802232:	e8 79 ff ff ff       	call   8021b0 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802237:	c9                   	leave
+  802238:	c3                   	ret
+
+00802239 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802239:	55                   	push   %ebp
+  80223a:	89 e5                	mov    %esp,%ebp
+  80223c:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80223f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802242:	50                   	push   %eax
+  802243:	ff 75 08             	push   0x8(%ebp)
+  802246:	6a 01                	push   $0x1
+  802248:	e8 63 ff ff ff       	call   8021b0 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80224d:	c9                   	leave
+  80224e:	c3                   	ret
+
+0080224f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80224f:	55                   	push   %ebp
+  802250:	89 e5                	mov    %esp,%ebp
+  802252:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802255:	68 5b 32 80 00       	push   $0x80325b
+  80225a:	ff 75 0c             	push   0xc(%ebp)
+  80225d:	e8 00 e7 ff ff       	call   800962 <strcpy>
+	return 0;
+}
+  802262:	b8 00 00 00 00       	mov    $0x0,%eax
+  802267:	c9                   	leave
+  802268:	c3                   	ret
+
+00802269 <devsock_close>:
+{
+  802269:	55                   	push   %ebp
+  80226a:	89 e5                	mov    %esp,%ebp
+  80226c:	53                   	push   %ebx
+  80226d:	83 ec 10             	sub    $0x10,%esp
+  802270:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802273:	53                   	push   %ebx
+  802274:	e8 e4 0a 00 00       	call   802d5d <pageref>
+  802279:	89 c2                	mov    %eax,%edx
+  80227b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80227e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802283:	83 fa 01             	cmp    $0x1,%edx
+  802286:	74 05                	je     80228d <devsock_close+0x24>
+}
+  802288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80228b:	c9                   	leave
+  80228c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80228d:	83 ec 0c             	sub    $0xc,%esp
+  802290:	ff 73 0c             	push   0xc(%ebx)
+  802293:	e8 b7 02 00 00       	call   80254f <nsipc_close>
+  802298:	83 c4 10             	add    $0x10,%esp
+  80229b:	eb eb                	jmp    802288 <devsock_close+0x1f>
+
+0080229d <devsock_write>:
+{
+  80229d:	55                   	push   %ebp
+  80229e:	89 e5                	mov    %esp,%ebp
+  8022a0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8022a3:	6a 00                	push   $0x0
+  8022a5:	ff 75 10             	push   0x10(%ebp)
+  8022a8:	ff 75 0c             	push   0xc(%ebp)
+  8022ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ae:	ff 70 0c             	push   0xc(%eax)
+  8022b1:	e8 79 03 00 00       	call   80262f <nsipc_send>
+}
+  8022b6:	c9                   	leave
+  8022b7:	c3                   	ret
+
+008022b8 <devsock_read>:
+{
+  8022b8:	55                   	push   %ebp
+  8022b9:	89 e5                	mov    %esp,%ebp
+  8022bb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8022be:	6a 00                	push   $0x0
+  8022c0:	ff 75 10             	push   0x10(%ebp)
+  8022c3:	ff 75 0c             	push   0xc(%ebp)
+  8022c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c9:	ff 70 0c             	push   0xc(%eax)
+  8022cc:	e8 ef 02 00 00       	call   8025c0 <nsipc_recv>
+}
+  8022d1:	c9                   	leave
+  8022d2:	c3                   	ret
+
+008022d3 <fd2sockid>:
+{
+  8022d3:	55                   	push   %ebp
+  8022d4:	89 e5                	mov    %esp,%ebp
+  8022d6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8022d9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022dc:	52                   	push   %edx
+  8022dd:	50                   	push   %eax
+  8022de:	e8 6a f6 ff ff       	call   80194d <fd_lookup>
+  8022e3:	83 c4 10             	add    $0x10,%esp
+  8022e6:	85 c0                	test   %eax,%eax
+  8022e8:	78 10                	js     8022fa <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8022ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ed:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  8022f3:	39 08                	cmp    %ecx,(%eax)
+  8022f5:	75 05                	jne    8022fc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8022f7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8022fa:	c9                   	leave
+  8022fb:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022fc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802301:	eb f7                	jmp    8022fa <fd2sockid+0x27>
+
+00802303 <alloc_sockfd>:
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	56                   	push   %esi
+  802307:	53                   	push   %ebx
+  802308:	83 ec 1c             	sub    $0x1c,%esp
+  80230b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80230d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802310:	50                   	push   %eax
+  802311:	e8 e1 f5 ff ff       	call   8018f7 <fd_alloc>
+  802316:	89 c3                	mov    %eax,%ebx
+  802318:	83 c4 10             	add    $0x10,%esp
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	78 43                	js     802362 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80231f:	83 ec 04             	sub    $0x4,%esp
+  802322:	68 07 04 00 00       	push   $0x407
+  802327:	ff 75 f4             	push   -0xc(%ebp)
+  80232a:	6a 00                	push   $0x0
+  80232c:	e8 29 eb ff ff       	call   800e5a <sys_page_alloc>
+  802331:	89 c3                	mov    %eax,%ebx
+  802333:	83 c4 10             	add    $0x10,%esp
+  802336:	85 c0                	test   %eax,%eax
+  802338:	78 28                	js     802362 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80233a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80233d:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  802343:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802345:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802348:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80234f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802352:	83 ec 0c             	sub    $0xc,%esp
+  802355:	50                   	push   %eax
+  802356:	e8 75 f5 ff ff       	call   8018d0 <fd2num>
+  80235b:	89 c3                	mov    %eax,%ebx
+  80235d:	83 c4 10             	add    $0x10,%esp
+  802360:	eb 0c                	jmp    80236e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802362:	83 ec 0c             	sub    $0xc,%esp
+  802365:	56                   	push   %esi
+  802366:	e8 e4 01 00 00       	call   80254f <nsipc_close>
+		return r;
+  80236b:	83 c4 10             	add    $0x10,%esp
+}
+  80236e:	89 d8                	mov    %ebx,%eax
+  802370:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802373:	5b                   	pop    %ebx
+  802374:	5e                   	pop    %esi
+  802375:	5d                   	pop    %ebp
+  802376:	c3                   	ret
+
+00802377 <accept>:
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80237d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802380:	e8 4e ff ff ff       	call   8022d3 <fd2sockid>
+  802385:	85 c0                	test   %eax,%eax
+  802387:	78 1b                	js     8023a4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802389:	83 ec 04             	sub    $0x4,%esp
+  80238c:	ff 75 10             	push   0x10(%ebp)
+  80238f:	ff 75 0c             	push   0xc(%ebp)
+  802392:	50                   	push   %eax
+  802393:	e8 0e 01 00 00       	call   8024a6 <nsipc_accept>
+  802398:	83 c4 10             	add    $0x10,%esp
+  80239b:	85 c0                	test   %eax,%eax
+  80239d:	78 05                	js     8023a4 <accept+0x2d>
+	return alloc_sockfd(r);
+  80239f:	e8 5f ff ff ff       	call   802303 <alloc_sockfd>
+}
+  8023a4:	c9                   	leave
+  8023a5:	c3                   	ret
+
+008023a6 <bind>:
+{
+  8023a6:	55                   	push   %ebp
+  8023a7:	89 e5                	mov    %esp,%ebp
+  8023a9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023af:	e8 1f ff ff ff       	call   8022d3 <fd2sockid>
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	78 12                	js     8023ca <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8023b8:	83 ec 04             	sub    $0x4,%esp
+  8023bb:	ff 75 10             	push   0x10(%ebp)
+  8023be:	ff 75 0c             	push   0xc(%ebp)
+  8023c1:	50                   	push   %eax
+  8023c2:	e8 31 01 00 00       	call   8024f8 <nsipc_bind>
+  8023c7:	83 c4 10             	add    $0x10,%esp
+}
+  8023ca:	c9                   	leave
+  8023cb:	c3                   	ret
+
+008023cc <shutdown>:
+{
+  8023cc:	55                   	push   %ebp
+  8023cd:	89 e5                	mov    %esp,%ebp
+  8023cf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d5:	e8 f9 fe ff ff       	call   8022d3 <fd2sockid>
+  8023da:	85 c0                	test   %eax,%eax
+  8023dc:	78 0f                	js     8023ed <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8023de:	83 ec 08             	sub    $0x8,%esp
+  8023e1:	ff 75 0c             	push   0xc(%ebp)
+  8023e4:	50                   	push   %eax
+  8023e5:	e8 43 01 00 00       	call   80252d <nsipc_shutdown>
+  8023ea:	83 c4 10             	add    $0x10,%esp
+}
+  8023ed:	c9                   	leave
+  8023ee:	c3                   	ret
+
+008023ef <connect>:
+{
+  8023ef:	55                   	push   %ebp
+  8023f0:	89 e5                	mov    %esp,%ebp
+  8023f2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f8:	e8 d6 fe ff ff       	call   8022d3 <fd2sockid>
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	78 12                	js     802413 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802401:	83 ec 04             	sub    $0x4,%esp
+  802404:	ff 75 10             	push   0x10(%ebp)
+  802407:	ff 75 0c             	push   0xc(%ebp)
+  80240a:	50                   	push   %eax
+  80240b:	e8 59 01 00 00       	call   802569 <nsipc_connect>
+  802410:	83 c4 10             	add    $0x10,%esp
+}
+  802413:	c9                   	leave
+  802414:	c3                   	ret
+
+00802415 <listen>:
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80241b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80241e:	e8 b0 fe ff ff       	call   8022d3 <fd2sockid>
+  802423:	85 c0                	test   %eax,%eax
+  802425:	78 0f                	js     802436 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802427:	83 ec 08             	sub    $0x8,%esp
+  80242a:	ff 75 0c             	push   0xc(%ebp)
+  80242d:	50                   	push   %eax
+  80242e:	e8 6b 01 00 00       	call   80259e <nsipc_listen>
+  802433:	83 c4 10             	add    $0x10,%esp
+}
+  802436:	c9                   	leave
+  802437:	c3                   	ret
+
+00802438 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802438:	55                   	push   %ebp
+  802439:	89 e5                	mov    %esp,%ebp
+  80243b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80243e:	ff 75 10             	push   0x10(%ebp)
+  802441:	ff 75 0c             	push   0xc(%ebp)
+  802444:	ff 75 08             	push   0x8(%ebp)
+  802447:	e8 41 02 00 00       	call   80268d <nsipc_socket>
+  80244c:	83 c4 10             	add    $0x10,%esp
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	78 05                	js     802458 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802453:	e8 ab fe ff ff       	call   802303 <alloc_sockfd>
+}
+  802458:	c9                   	leave
+  802459:	c3                   	ret
+
+0080245a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80245a:	55                   	push   %ebp
+  80245b:	89 e5                	mov    %esp,%ebp
+  80245d:	53                   	push   %ebx
+  80245e:	83 ec 04             	sub    $0x4,%esp
+  802461:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802463:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80246a:	74 26                	je     802492 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80246c:	6a 07                	push   $0x7
+  80246e:	68 00 70 80 00       	push   $0x807000
+  802473:	53                   	push   %ebx
+  802474:	ff 35 08 50 80 00    	push   0x805008
+  80247a:	e8 4b 08 00 00       	call   802cca <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80247f:	83 c4 0c             	add    $0xc,%esp
+  802482:	6a 00                	push   $0x0
+  802484:	6a 00                	push   $0x0
+  802486:	6a 00                	push   $0x0
+  802488:	e8 25 08 00 00       	call   802cb2 <ipc_recv>
+}
+  80248d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802490:	c9                   	leave
+  802491:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802492:	83 ec 0c             	sub    $0xc,%esp
+  802495:	6a 02                	push   $0x2
+  802497:	e8 82 08 00 00       	call   802d1e <ipc_find_env>
+  80249c:	a3 08 50 80 00       	mov    %eax,0x805008
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	eb c6                	jmp    80246c <nsipc+0x12>
+
+008024a6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8024a6:	55                   	push   %ebp
+  8024a7:	89 e5                	mov    %esp,%ebp
+  8024a9:	56                   	push   %esi
+  8024aa:	53                   	push   %ebx
+  8024ab:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8024ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8024b6:	8b 06                	mov    (%esi),%eax
+  8024b8:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8024bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024c2:	e8 93 ff ff ff       	call   80245a <nsipc>
+  8024c7:	89 c3                	mov    %eax,%ebx
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	79 09                	jns    8024d6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8024cd:	89 d8                	mov    %ebx,%eax
+  8024cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d2:	5b                   	pop    %ebx
+  8024d3:	5e                   	pop    %esi
+  8024d4:	5d                   	pop    %ebp
+  8024d5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8024d6:	83 ec 04             	sub    $0x4,%esp
+  8024d9:	ff 35 10 70 80 00    	push   0x807010
+  8024df:	68 00 70 80 00       	push   $0x807000
+  8024e4:	ff 75 0c             	push   0xc(%ebp)
+  8024e7:	e8 fc e5 ff ff       	call   800ae8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8024ec:	a1 10 70 80 00       	mov    0x807010,%eax
+  8024f1:	89 06                	mov    %eax,(%esi)
+  8024f3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8024f6:	eb d5                	jmp    8024cd <nsipc_accept+0x27>
+
+008024f8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8024f8:	55                   	push   %ebp
+  8024f9:	89 e5                	mov    %esp,%ebp
+  8024fb:	53                   	push   %ebx
+  8024fc:	83 ec 08             	sub    $0x8,%esp
+  8024ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802502:	8b 45 08             	mov    0x8(%ebp),%eax
+  802505:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80250a:	53                   	push   %ebx
+  80250b:	ff 75 0c             	push   0xc(%ebp)
+  80250e:	68 04 70 80 00       	push   $0x807004
+  802513:	e8 d0 e5 ff ff       	call   800ae8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802518:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80251e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802523:	e8 32 ff ff ff       	call   80245a <nsipc>
+}
+  802528:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80252b:	c9                   	leave
+  80252c:	c3                   	ret
+
+0080252d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80252d:	55                   	push   %ebp
+  80252e:	89 e5                	mov    %esp,%ebp
+  802530:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802533:	8b 45 08             	mov    0x8(%ebp),%eax
+  802536:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80253b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80253e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802543:	b8 03 00 00 00       	mov    $0x3,%eax
+  802548:	e8 0d ff ff ff       	call   80245a <nsipc>
+}
+  80254d:	c9                   	leave
+  80254e:	c3                   	ret
+
+0080254f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80254f:	55                   	push   %ebp
+  802550:	89 e5                	mov    %esp,%ebp
+  802552:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802555:	8b 45 08             	mov    0x8(%ebp),%eax
+  802558:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80255d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802562:	e8 f3 fe ff ff       	call   80245a <nsipc>
+}
+  802567:	c9                   	leave
+  802568:	c3                   	ret
+
+00802569 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802569:	55                   	push   %ebp
+  80256a:	89 e5                	mov    %esp,%ebp
+  80256c:	53                   	push   %ebx
+  80256d:	83 ec 08             	sub    $0x8,%esp
+  802570:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802573:	8b 45 08             	mov    0x8(%ebp),%eax
+  802576:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80257b:	53                   	push   %ebx
+  80257c:	ff 75 0c             	push   0xc(%ebp)
+  80257f:	68 04 70 80 00       	push   $0x807004
+  802584:	e8 5f e5 ff ff       	call   800ae8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802589:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80258f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802594:	e8 c1 fe ff ff       	call   80245a <nsipc>
+}
+  802599:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+
+0080259e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80259e:	55                   	push   %ebp
+  80259f:	89 e5                	mov    %esp,%ebp
+  8025a1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8025a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a7:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8025ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025af:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8025b4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025b9:	e8 9c fe ff ff       	call   80245a <nsipc>
+}
+  8025be:	c9                   	leave
+  8025bf:	c3                   	ret
+
+008025c0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8025c0:	55                   	push   %ebp
+  8025c1:	89 e5                	mov    %esp,%ebp
+  8025c3:	56                   	push   %esi
+  8025c4:	53                   	push   %ebx
+  8025c5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8025c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025cb:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8025d0:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8025d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025d9:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8025de:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025e3:	e8 72 fe ff ff       	call   80245a <nsipc>
+  8025e8:	89 c3                	mov    %eax,%ebx
+  8025ea:	85 c0                	test   %eax,%eax
+  8025ec:	78 22                	js     802610 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8025ee:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8025f3:	39 c6                	cmp    %eax,%esi
+  8025f5:	0f 4e c6             	cmovle %esi,%eax
+  8025f8:	39 c3                	cmp    %eax,%ebx
+  8025fa:	7f 1d                	jg     802619 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8025fc:	83 ec 04             	sub    $0x4,%esp
+  8025ff:	53                   	push   %ebx
+  802600:	68 00 70 80 00       	push   $0x807000
+  802605:	ff 75 0c             	push   0xc(%ebp)
+  802608:	e8 db e4 ff ff       	call   800ae8 <memmove>
+  80260d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802610:	89 d8                	mov    %ebx,%eax
+  802612:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802615:	5b                   	pop    %ebx
+  802616:	5e                   	pop    %esi
+  802617:	5d                   	pop    %ebp
+  802618:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802619:	68 67 32 80 00       	push   $0x803267
+  80261e:	68 2f 32 80 00       	push   $0x80322f
+  802623:	6a 62                	push   $0x62
+  802625:	68 7c 32 80 00       	push   $0x80327c
+  80262a:	e8 10 dc ff ff       	call   80023f <_panic>
+
+0080262f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80262f:	55                   	push   %ebp
+  802630:	89 e5                	mov    %esp,%ebp
+  802632:	53                   	push   %ebx
+  802633:	83 ec 04             	sub    $0x4,%esp
+  802636:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802639:	8b 45 08             	mov    0x8(%ebp),%eax
+  80263c:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802641:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802647:	7f 2e                	jg     802677 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802649:	83 ec 04             	sub    $0x4,%esp
+  80264c:	53                   	push   %ebx
+  80264d:	ff 75 0c             	push   0xc(%ebp)
+  802650:	68 0c 70 80 00       	push   $0x80700c
+  802655:	e8 8e e4 ff ff       	call   800ae8 <memmove>
+	nsipcbuf.send.req_size = size;
+  80265a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802660:	8b 45 14             	mov    0x14(%ebp),%eax
+  802663:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802668:	b8 08 00 00 00       	mov    $0x8,%eax
+  80266d:	e8 e8 fd ff ff       	call   80245a <nsipc>
+}
+  802672:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802675:	c9                   	leave
+  802676:	c3                   	ret
+	assert(size < 1600);
+  802677:	68 88 32 80 00       	push   $0x803288
+  80267c:	68 2f 32 80 00       	push   $0x80322f
+  802681:	6a 6d                	push   $0x6d
+  802683:	68 7c 32 80 00       	push   $0x80327c
+  802688:	e8 b2 db ff ff       	call   80023f <_panic>
+
+0080268d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802693:	8b 45 08             	mov    0x8(%ebp),%eax
+  802696:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80269b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80269e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8026a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026a6:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8026ab:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026b0:	e8 a5 fd ff ff       	call   80245a <nsipc>
+}
+  8026b5:	c9                   	leave
+  8026b6:	c3                   	ret
+
+008026b7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026b7:	55                   	push   %ebp
+  8026b8:	89 e5                	mov    %esp,%ebp
+  8026ba:	56                   	push   %esi
+  8026bb:	53                   	push   %ebx
+  8026bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8026bf:	83 ec 0c             	sub    $0xc,%esp
+  8026c2:	ff 75 08             	push   0x8(%ebp)
+  8026c5:	e8 16 f2 ff ff       	call   8018e0 <fd2data>
+  8026ca:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8026cc:	83 c4 08             	add    $0x8,%esp
+  8026cf:	68 94 32 80 00       	push   $0x803294
+  8026d4:	53                   	push   %ebx
+  8026d5:	e8 88 e2 ff ff       	call   800962 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8026da:	8b 46 04             	mov    0x4(%esi),%eax
+  8026dd:	2b 06                	sub    (%esi),%eax
+  8026df:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8026e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026ec:	00 00 00 
+	stat->st_dev = &devpipe;
+  8026ef:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  8026f6:	40 80 00 
+	return 0;
+}
+  8026f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802701:	5b                   	pop    %ebx
+  802702:	5e                   	pop    %esi
+  802703:	5d                   	pop    %ebp
+  802704:	c3                   	ret
+
+00802705 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	53                   	push   %ebx
+  802709:	83 ec 0c             	sub    $0xc,%esp
+  80270c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80270f:	53                   	push   %ebx
+  802710:	6a 00                	push   $0x0
+  802712:	e8 1e e8 ff ff       	call   800f35 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802717:	89 1c 24             	mov    %ebx,(%esp)
+  80271a:	e8 c1 f1 ff ff       	call   8018e0 <fd2data>
+  80271f:	83 c4 08             	add    $0x8,%esp
+  802722:	50                   	push   %eax
+  802723:	6a 00                	push   $0x0
+  802725:	e8 0b e8 ff ff       	call   800f35 <sys_page_unmap>
+}
+  80272a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272d:	c9                   	leave
+  80272e:	c3                   	ret
+
+0080272f <_pipeisclosed>:
+{
+  80272f:	55                   	push   %ebp
+  802730:	89 e5                	mov    %esp,%ebp
+  802732:	57                   	push   %edi
+  802733:	56                   	push   %esi
+  802734:	53                   	push   %ebx
+  802735:	83 ec 1c             	sub    $0x1c,%esp
+  802738:	89 c7                	mov    %eax,%edi
+  80273a:	89 d6                	mov    %edx,%esi
+  80273c:	eb 3c                	jmp    80277a <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  80273e:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802741:	83 ec 0c             	sub    $0xc,%esp
+  802744:	57                   	push   %edi
+  802745:	e8 13 06 00 00       	call   802d5d <pageref>
+  80274a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80274d:	89 34 24             	mov    %esi,(%esp)
+  802750:	e8 08 06 00 00       	call   802d5d <pageref>
+  802755:	89 c2                	mov    %eax,%edx
+  802757:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802759:	05 00 00 00 20       	add    $0x20000000,%eax
+  80275e:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802761:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802767:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80276c:	76 31                	jbe    80279f <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  80276e:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802771:	39 c3                	cmp    %eax,%ebx
+  802773:	74 76                	je     8027eb <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802775:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802778:	74 36                	je     8027b0 <_pipeisclosed+0x81>
+  80277a:	89 e0                	mov    %esp,%eax
+  80277c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802781:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802787:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80278c:	77 b0                	ja     80273e <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80278e:	c1 e8 10             	shr    $0x10,%eax
+  802791:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802797:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80279d:	eb 9f                	jmp    80273e <_pipeisclosed+0xf>
+  80279f:	c1 e8 10             	shr    $0x10,%eax
+  8027a2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027a8:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8027ae:	eb be                	jmp    80276e <_pipeisclosed+0x3f>
+  8027b0:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027b2:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8027b7:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027bd:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8027c2:	76 16                	jbe    8027da <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027c4:	8b 42 58             	mov    0x58(%edx),%eax
+  8027c7:	6a 01                	push   $0x1
+  8027c9:	50                   	push   %eax
+  8027ca:	53                   	push   %ebx
+  8027cb:	68 9b 32 80 00       	push   $0x80329b
+  8027d0:	e8 45 db ff ff       	call   80031a <cprintf>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+  8027d8:	eb a0                	jmp    80277a <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8027da:	c1 e8 10             	shr    $0x10,%eax
+  8027dd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027e3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8027e9:	eb d9                	jmp    8027c4 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8027eb:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8027ee:	0f 94 c0             	sete   %al
+  8027f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8027f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f7:	5b                   	pop    %ebx
+  8027f8:	5e                   	pop    %esi
+  8027f9:	5f                   	pop    %edi
+  8027fa:	5d                   	pop    %ebp
+  8027fb:	c3                   	ret
+
+008027fc <devpipe_write>:
+{
+  8027fc:	55                   	push   %ebp
+  8027fd:	89 e5                	mov    %esp,%ebp
+  8027ff:	57                   	push   %edi
+  802800:	56                   	push   %esi
+  802801:	53                   	push   %ebx
+  802802:	83 ec 28             	sub    $0x28,%esp
+  802805:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802808:	56                   	push   %esi
+  802809:	e8 d2 f0 ff ff       	call   8018e0 <fd2data>
+  80280e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802810:	83 c4 10             	add    $0x10,%esp
+  802813:	bf 00 00 00 00       	mov    $0x0,%edi
+  802818:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80281b:	75 09                	jne    802826 <devpipe_write+0x2a>
+	return i;
+  80281d:	89 f8                	mov    %edi,%eax
+  80281f:	eb 23                	jmp    802844 <devpipe_write+0x48>
+			sys_yield();
+  802821:	e8 ee e5 ff ff       	call   800e14 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802826:	8b 43 04             	mov    0x4(%ebx),%eax
+  802829:	8b 0b                	mov    (%ebx),%ecx
+  80282b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80282e:	39 d0                	cmp    %edx,%eax
+  802830:	72 1a                	jb     80284c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802832:	89 da                	mov    %ebx,%edx
+  802834:	89 f0                	mov    %esi,%eax
+  802836:	e8 f4 fe ff ff       	call   80272f <_pipeisclosed>
+  80283b:	85 c0                	test   %eax,%eax
+  80283d:	74 e2                	je     802821 <devpipe_write+0x25>
+				return 0;
+  80283f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802847:	5b                   	pop    %ebx
+  802848:	5e                   	pop    %esi
+  802849:	5f                   	pop    %edi
+  80284a:	5d                   	pop    %ebp
+  80284b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80284c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80284f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802853:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802856:	89 c2                	mov    %eax,%edx
+  802858:	c1 fa 1f             	sar    $0x1f,%edx
+  80285b:	89 d1                	mov    %edx,%ecx
+  80285d:	c1 e9 1b             	shr    $0x1b,%ecx
+  802860:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802863:	83 e2 1f             	and    $0x1f,%edx
+  802866:	29 ca                	sub    %ecx,%edx
+  802868:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80286c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802870:	83 c0 01             	add    $0x1,%eax
+  802873:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802876:	83 c7 01             	add    $0x1,%edi
+  802879:	eb 9d                	jmp    802818 <devpipe_write+0x1c>
+
+0080287b <devpipe_read>:
+{
+  80287b:	55                   	push   %ebp
+  80287c:	89 e5                	mov    %esp,%ebp
+  80287e:	57                   	push   %edi
+  80287f:	56                   	push   %esi
+  802880:	53                   	push   %ebx
+  802881:	83 ec 18             	sub    $0x18,%esp
+  802884:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802887:	57                   	push   %edi
+  802888:	e8 53 f0 ff ff       	call   8018e0 <fd2data>
+  80288d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80288f:	83 c4 10             	add    $0x10,%esp
+  802892:	be 00 00 00 00       	mov    $0x0,%esi
+  802897:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80289a:	75 13                	jne    8028af <devpipe_read+0x34>
+	return i;
+  80289c:	89 f0                	mov    %esi,%eax
+  80289e:	eb 02                	jmp    8028a2 <devpipe_read+0x27>
+				return i;
+  8028a0:	89 f0                	mov    %esi,%eax
+}
+  8028a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a5:	5b                   	pop    %ebx
+  8028a6:	5e                   	pop    %esi
+  8028a7:	5f                   	pop    %edi
+  8028a8:	5d                   	pop    %ebp
+  8028a9:	c3                   	ret
+			sys_yield();
+  8028aa:	e8 65 e5 ff ff       	call   800e14 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8028af:	8b 03                	mov    (%ebx),%eax
+  8028b1:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028b4:	75 18                	jne    8028ce <devpipe_read+0x53>
+			if (i > 0)
+  8028b6:	85 f6                	test   %esi,%esi
+  8028b8:	75 e6                	jne    8028a0 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8028ba:	89 da                	mov    %ebx,%edx
+  8028bc:	89 f8                	mov    %edi,%eax
+  8028be:	e8 6c fe ff ff       	call   80272f <_pipeisclosed>
+  8028c3:	85 c0                	test   %eax,%eax
+  8028c5:	74 e3                	je     8028aa <devpipe_read+0x2f>
+				return 0;
+  8028c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cc:	eb d4                	jmp    8028a2 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8028ce:	99                   	cltd
+  8028cf:	c1 ea 1b             	shr    $0x1b,%edx
+  8028d2:	01 d0                	add    %edx,%eax
+  8028d4:	83 e0 1f             	and    $0x1f,%eax
+  8028d7:	29 d0                	sub    %edx,%eax
+  8028d9:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028e1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8028e4:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8028e7:	83 c6 01             	add    $0x1,%esi
+  8028ea:	eb ab                	jmp    802897 <devpipe_read+0x1c>
+
+008028ec <pipe>:
+{
+  8028ec:	55                   	push   %ebp
+  8028ed:	89 e5                	mov    %esp,%ebp
+  8028ef:	56                   	push   %esi
+  8028f0:	53                   	push   %ebx
+  8028f1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8028f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028f7:	50                   	push   %eax
+  8028f8:	e8 fa ef ff ff       	call   8018f7 <fd_alloc>
+  8028fd:	89 c3                	mov    %eax,%ebx
+  8028ff:	83 c4 10             	add    $0x10,%esp
+  802902:	85 c0                	test   %eax,%eax
+  802904:	0f 88 23 01 00 00    	js     802a2d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80290a:	83 ec 04             	sub    $0x4,%esp
+  80290d:	68 07 04 00 00       	push   $0x407
+  802912:	ff 75 f4             	push   -0xc(%ebp)
+  802915:	6a 00                	push   $0x0
+  802917:	e8 3e e5 ff ff       	call   800e5a <sys_page_alloc>
+  80291c:	89 c3                	mov    %eax,%ebx
+  80291e:	83 c4 10             	add    $0x10,%esp
+  802921:	85 c0                	test   %eax,%eax
+  802923:	0f 88 04 01 00 00    	js     802a2d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802929:	83 ec 0c             	sub    $0xc,%esp
+  80292c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80292f:	50                   	push   %eax
+  802930:	e8 c2 ef ff ff       	call   8018f7 <fd_alloc>
+  802935:	89 c3                	mov    %eax,%ebx
+  802937:	83 c4 10             	add    $0x10,%esp
+  80293a:	85 c0                	test   %eax,%eax
+  80293c:	0f 88 db 00 00 00    	js     802a1d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802942:	83 ec 04             	sub    $0x4,%esp
+  802945:	68 07 04 00 00       	push   $0x407
+  80294a:	ff 75 f0             	push   -0x10(%ebp)
+  80294d:	6a 00                	push   $0x0
+  80294f:	e8 06 e5 ff ff       	call   800e5a <sys_page_alloc>
+  802954:	89 c3                	mov    %eax,%ebx
+  802956:	83 c4 10             	add    $0x10,%esp
+  802959:	85 c0                	test   %eax,%eax
+  80295b:	0f 88 bc 00 00 00    	js     802a1d <pipe+0x131>
+	va = fd2data(fd0);
+  802961:	83 ec 0c             	sub    $0xc,%esp
+  802964:	ff 75 f4             	push   -0xc(%ebp)
+  802967:	e8 74 ef ff ff       	call   8018e0 <fd2data>
+  80296c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80296e:	83 c4 0c             	add    $0xc,%esp
+  802971:	68 07 04 00 00       	push   $0x407
+  802976:	50                   	push   %eax
+  802977:	6a 00                	push   $0x0
+  802979:	e8 dc e4 ff ff       	call   800e5a <sys_page_alloc>
+  80297e:	89 c3                	mov    %eax,%ebx
+  802980:	83 c4 10             	add    $0x10,%esp
+  802983:	85 c0                	test   %eax,%eax
+  802985:	0f 88 82 00 00 00    	js     802a0d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80298b:	83 ec 0c             	sub    $0xc,%esp
+  80298e:	ff 75 f0             	push   -0x10(%ebp)
+  802991:	e8 4a ef ff ff       	call   8018e0 <fd2data>
+  802996:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80299d:	50                   	push   %eax
+  80299e:	6a 00                	push   $0x0
+  8029a0:	56                   	push   %esi
+  8029a1:	6a 00                	push   $0x0
+  8029a3:	e8 1f e5 ff ff       	call   800ec7 <sys_page_map>
+  8029a8:	89 c3                	mov    %eax,%ebx
+  8029aa:	83 c4 20             	add    $0x20,%esp
+  8029ad:	85 c0                	test   %eax,%eax
+  8029af:	78 4e                	js     8029ff <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8029b1:	a1 40 40 80 00       	mov    0x804040,%eax
+  8029b6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029b9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8029bb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029be:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8029c5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8029c8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8029ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029cd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8029d4:	83 ec 0c             	sub    $0xc,%esp
+  8029d7:	ff 75 f4             	push   -0xc(%ebp)
+  8029da:	e8 f1 ee ff ff       	call   8018d0 <fd2num>
+  8029df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029e2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8029e4:	83 c4 04             	add    $0x4,%esp
+  8029e7:	ff 75 f0             	push   -0x10(%ebp)
+  8029ea:	e8 e1 ee ff ff       	call   8018d0 <fd2num>
+  8029ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029f2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8029f5:	83 c4 10             	add    $0x10,%esp
+  8029f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029fd:	eb 2e                	jmp    802a2d <pipe+0x141>
+	sys_page_unmap(0, va);
+  8029ff:	83 ec 08             	sub    $0x8,%esp
+  802a02:	56                   	push   %esi
+  802a03:	6a 00                	push   $0x0
+  802a05:	e8 2b e5 ff ff       	call   800f35 <sys_page_unmap>
+  802a0a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802a0d:	83 ec 08             	sub    $0x8,%esp
+  802a10:	ff 75 f0             	push   -0x10(%ebp)
+  802a13:	6a 00                	push   $0x0
+  802a15:	e8 1b e5 ff ff       	call   800f35 <sys_page_unmap>
+  802a1a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802a1d:	83 ec 08             	sub    $0x8,%esp
+  802a20:	ff 75 f4             	push   -0xc(%ebp)
+  802a23:	6a 00                	push   $0x0
+  802a25:	e8 0b e5 ff ff       	call   800f35 <sys_page_unmap>
+  802a2a:	83 c4 10             	add    $0x10,%esp
+}
+  802a2d:	89 d8                	mov    %ebx,%eax
+  802a2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a32:	5b                   	pop    %ebx
+  802a33:	5e                   	pop    %esi
+  802a34:	5d                   	pop    %ebp
+  802a35:	c3                   	ret
+
+00802a36 <pipeisclosed>:
+{
+  802a36:	55                   	push   %ebp
+  802a37:	89 e5                	mov    %esp,%ebp
+  802a39:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a3f:	50                   	push   %eax
+  802a40:	ff 75 08             	push   0x8(%ebp)
+  802a43:	e8 05 ef ff ff       	call   80194d <fd_lookup>
+  802a48:	83 c4 10             	add    $0x10,%esp
+  802a4b:	85 c0                	test   %eax,%eax
+  802a4d:	78 18                	js     802a67 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802a4f:	83 ec 0c             	sub    $0xc,%esp
+  802a52:	ff 75 f4             	push   -0xc(%ebp)
+  802a55:	e8 86 ee ff ff       	call   8018e0 <fd2data>
+  802a5a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802a5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a5f:	e8 cb fc ff ff       	call   80272f <_pipeisclosed>
+  802a64:	83 c4 10             	add    $0x10,%esp
+}
+  802a67:	c9                   	leave
+  802a68:	c3                   	ret
+
+00802a69 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6e:	c3                   	ret
+
+00802a6f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a6f:	55                   	push   %ebp
+  802a70:	89 e5                	mov    %esp,%ebp
+  802a72:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802a75:	68 b3 32 80 00       	push   $0x8032b3
+  802a7a:	ff 75 0c             	push   0xc(%ebp)
+  802a7d:	e8 e0 de ff ff       	call   800962 <strcpy>
+	return 0;
+}
+  802a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a87:	c9                   	leave
+  802a88:	c3                   	ret
+
+00802a89 <devcons_write>:
+{
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	57                   	push   %edi
+  802a8d:	56                   	push   %esi
+  802a8e:	53                   	push   %ebx
+  802a8f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802a95:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802a9a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802aa0:	eb 2e                	jmp    802ad0 <devcons_write+0x47>
+		m = n - tot;
+  802aa2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802aa5:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802aa7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802aac:	39 c3                	cmp    %eax,%ebx
+  802aae:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802ab1:	83 ec 04             	sub    $0x4,%esp
+  802ab4:	53                   	push   %ebx
+  802ab5:	89 f0                	mov    %esi,%eax
+  802ab7:	03 45 0c             	add    0xc(%ebp),%eax
+  802aba:	50                   	push   %eax
+  802abb:	57                   	push   %edi
+  802abc:	e8 27 e0 ff ff       	call   800ae8 <memmove>
+		sys_cputs(buf, m);
+  802ac1:	83 c4 08             	add    $0x8,%esp
+  802ac4:	53                   	push   %ebx
+  802ac5:	57                   	push   %edi
+  802ac6:	e8 10 e2 ff ff       	call   800cdb <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802acb:	01 de                	add    %ebx,%esi
+  802acd:	83 c4 10             	add    $0x10,%esp
+  802ad0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ad3:	72 cd                	jb     802aa2 <devcons_write+0x19>
+}
+  802ad5:	89 f0                	mov    %esi,%eax
+  802ad7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ada:	5b                   	pop    %ebx
+  802adb:	5e                   	pop    %esi
+  802adc:	5f                   	pop    %edi
+  802add:	5d                   	pop    %ebp
+  802ade:	c3                   	ret
+
+00802adf <devcons_read>:
+{
+  802adf:	55                   	push   %ebp
+  802ae0:	89 e5                	mov    %esp,%ebp
+  802ae2:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aea:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802aee:	75 07                	jne    802af7 <devcons_read+0x18>
+  802af0:	eb 1f                	jmp    802b11 <devcons_read+0x32>
+		sys_yield();
+  802af2:	e8 1d e3 ff ff       	call   800e14 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802af7:	e8 23 e2 ff ff       	call   800d1f <sys_cgetc>
+  802afc:	85 c0                	test   %eax,%eax
+  802afe:	74 f2                	je     802af2 <devcons_read+0x13>
+	if (c < 0)
+  802b00:	78 0f                	js     802b11 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802b02:	83 f8 04             	cmp    $0x4,%eax
+  802b05:	74 0c                	je     802b13 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802b07:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b0a:	88 02                	mov    %al,(%edx)
+	return 1;
+  802b0c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802b11:	c9                   	leave
+  802b12:	c3                   	ret
+		return 0;
+  802b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b18:	eb f7                	jmp    802b11 <devcons_read+0x32>
+
+00802b1a <cputchar>:
+{
+  802b1a:	55                   	push   %ebp
+  802b1b:	89 e5                	mov    %esp,%ebp
+  802b1d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802b20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b23:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802b26:	6a 01                	push   $0x1
+  802b28:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b2b:	50                   	push   %eax
+  802b2c:	e8 aa e1 ff ff       	call   800cdb <sys_cputs>
+}
+  802b31:	83 c4 10             	add    $0x10,%esp
+  802b34:	c9                   	leave
+  802b35:	c3                   	ret
+
+00802b36 <getchar>:
+{
+  802b36:	55                   	push   %ebp
+  802b37:	89 e5                	mov    %esp,%ebp
+  802b39:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802b3c:	6a 01                	push   $0x1
+  802b3e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b41:	50                   	push   %eax
+  802b42:	6a 00                	push   $0x0
+  802b44:	e8 8a f0 ff ff       	call   801bd3 <read>
+	if (r < 0)
+  802b49:	83 c4 10             	add    $0x10,%esp
+  802b4c:	85 c0                	test   %eax,%eax
+  802b4e:	78 06                	js     802b56 <getchar+0x20>
+	if (r < 1)
+  802b50:	74 06                	je     802b58 <getchar+0x22>
+	return c;
+  802b52:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802b56:	c9                   	leave
+  802b57:	c3                   	ret
+		return -E_EOF;
+  802b58:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802b5d:	eb f7                	jmp    802b56 <getchar+0x20>
+
+00802b5f <iscons>:
+{
+  802b5f:	55                   	push   %ebp
+  802b60:	89 e5                	mov    %esp,%ebp
+  802b62:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b65:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b68:	50                   	push   %eax
+  802b69:	ff 75 08             	push   0x8(%ebp)
+  802b6c:	e8 dc ed ff ff       	call   80194d <fd_lookup>
+  802b71:	83 c4 10             	add    $0x10,%esp
+  802b74:	85 c0                	test   %eax,%eax
+  802b76:	78 11                	js     802b89 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b7b:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802b81:	39 10                	cmp    %edx,(%eax)
+  802b83:	0f 94 c0             	sete   %al
+  802b86:	0f b6 c0             	movzbl %al,%eax
+}
+  802b89:	c9                   	leave
+  802b8a:	c3                   	ret
+
+00802b8b <opencons>:
+{
+  802b8b:	55                   	push   %ebp
+  802b8c:	89 e5                	mov    %esp,%ebp
+  802b8e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802b91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b94:	50                   	push   %eax
+  802b95:	e8 5d ed ff ff       	call   8018f7 <fd_alloc>
+  802b9a:	83 c4 10             	add    $0x10,%esp
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	78 3a                	js     802bdb <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ba1:	83 ec 04             	sub    $0x4,%esp
+  802ba4:	68 07 04 00 00       	push   $0x407
+  802ba9:	ff 75 f4             	push   -0xc(%ebp)
+  802bac:	6a 00                	push   $0x0
+  802bae:	e8 a7 e2 ff ff       	call   800e5a <sys_page_alloc>
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	85 c0                	test   %eax,%eax
+  802bb8:	78 21                	js     802bdb <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802bba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bbd:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  802bc3:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802bc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bc8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802bcf:	83 ec 0c             	sub    $0xc,%esp
+  802bd2:	50                   	push   %eax
+  802bd3:	e8 f8 ec ff ff       	call   8018d0 <fd2num>
+  802bd8:	83 c4 10             	add    $0x10,%esp
+}
+  802bdb:	c9                   	leave
+  802bdc:	c3                   	ret
+
+00802bdd <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802bdd:	55                   	push   %ebp
+  802bde:	89 e5                	mov    %esp,%ebp
+  802be0:	56                   	push   %esi
+  802be1:	53                   	push   %ebx
+  802be2:	8b 75 08             	mov    0x8(%ebp),%esi
+  802be5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802be8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802beb:	85 c0                	test   %eax,%eax
+  802bed:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802bf2:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802bf5:	83 ec 08             	sub    $0x8,%esp
+  802bf8:	ff 75 14             	push   0x14(%ebp)
+  802bfb:	50                   	push   %eax
+  802bfc:	e8 6a e6 ff ff       	call   80126b <sys_ipc_recv_until>
+  802c01:	83 c4 10             	add    $0x10,%esp
+  802c04:	85 c0                	test   %eax,%eax
+  802c06:	78 61                	js     802c69 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802c08:	85 f6                	test   %esi,%esi
+  802c0a:	74 1c                	je     802c28 <ipc_recv_until+0x4b>
+  802c0c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c0e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c13:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c19:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c1e:	76 5f                	jbe    802c7f <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802c20:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802c26:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802c28:	85 db                	test   %ebx,%ebx
+  802c2a:	74 1c                	je     802c48 <ipc_recv_until+0x6b>
+  802c2c:	89 e0                	mov    %esp,%eax
+  802c2e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c33:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c39:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c3e:	76 50                	jbe    802c90 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802c40:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802c46:	89 03                	mov    %eax,(%ebx)
+  802c48:	89 e0                	mov    %esp,%eax
+  802c4a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c4f:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c55:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c5a:	76 45                	jbe    802ca1 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802c5c:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802c62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c65:	5b                   	pop    %ebx
+  802c66:	5e                   	pop    %esi
+  802c67:	5d                   	pop    %ebp
+  802c68:	c3                   	ret
+		if (from_env_store)
+  802c69:	85 f6                	test   %esi,%esi
+  802c6b:	74 06                	je     802c73 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802c6d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802c73:	85 db                	test   %ebx,%ebx
+  802c75:	74 eb                	je     802c62 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802c77:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802c7d:	eb e3                	jmp    802c62 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802c7f:	c1 e8 10             	shr    $0x10,%eax
+  802c82:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c88:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c8e:	eb 90                	jmp    802c20 <ipc_recv_until+0x43>
+  802c90:	c1 e8 10             	shr    $0x10,%eax
+  802c93:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c99:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c9f:	eb 9f                	jmp    802c40 <ipc_recv_until+0x63>
+  802ca1:	c1 e8 10             	shr    $0x10,%eax
+  802ca4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802caa:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802cb0:	eb aa                	jmp    802c5c <ipc_recv_until+0x7f>
+
+00802cb2 <ipc_recv>:
+{
+  802cb2:	55                   	push   %ebp
+  802cb3:	89 e5                	mov    %esp,%ebp
+  802cb5:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802cb8:	6a 00                	push   $0x0
+  802cba:	ff 75 10             	push   0x10(%ebp)
+  802cbd:	ff 75 0c             	push   0xc(%ebp)
+  802cc0:	ff 75 08             	push   0x8(%ebp)
+  802cc3:	e8 15 ff ff ff       	call   802bdd <ipc_recv_until>
+}
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+
+00802cca <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802cca:	55                   	push   %ebp
+  802ccb:	89 e5                	mov    %esp,%ebp
+  802ccd:	57                   	push   %edi
+  802cce:	56                   	push   %esi
+  802ccf:	53                   	push   %ebx
+  802cd0:	83 ec 0c             	sub    $0xc,%esp
+  802cd3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cd6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802cd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802cdc:	85 db                	test   %ebx,%ebx
+  802cde:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ce3:	0f 44 d8             	cmove  %eax,%ebx
+  802ce6:	eb 05                	jmp    802ced <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802ce8:	e8 27 e1 ff ff       	call   800e14 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802ced:	ff 75 14             	push   0x14(%ebp)
+  802cf0:	53                   	push   %ebx
+  802cf1:	56                   	push   %esi
+  802cf2:	57                   	push   %edi
+  802cf3:	e8 bf e4 ff ff       	call   8011b7 <sys_ipc_try_send>
+  802cf8:	83 c4 10             	add    $0x10,%esp
+  802cfb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802cfe:	74 e8                	je     802ce8 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802d00:	85 c0                	test   %eax,%eax
+  802d02:	78 08                	js     802d0c <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802d04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d07:	5b                   	pop    %ebx
+  802d08:	5e                   	pop    %esi
+  802d09:	5f                   	pop    %edi
+  802d0a:	5d                   	pop    %ebp
+  802d0b:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802d0c:	50                   	push   %eax
+  802d0d:	68 bf 32 80 00       	push   $0x8032bf
+  802d12:	6a 4f                	push   $0x4f
+  802d14:	68 d2 32 80 00       	push   $0x8032d2
+  802d19:	e8 21 d5 ff ff       	call   80023f <_panic>
+
+00802d1e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d1e:	55                   	push   %ebp
+  802d1f:	89 e5                	mov    %esp,%ebp
+  802d21:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802d24:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802d29:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802d2f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d35:	8b 52 50             	mov    0x50(%edx),%edx
+  802d38:	39 ca                	cmp    %ecx,%edx
+  802d3a:	74 11                	je     802d4d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802d3c:	83 c0 01             	add    $0x1,%eax
+  802d3f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802d44:	75 e3                	jne    802d29 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4b:	eb 0e                	jmp    802d5b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802d4d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d53:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d58:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802d5b:	5d                   	pop    %ebp
+  802d5c:	c3                   	ret
+
+00802d5d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d5d:	55                   	push   %ebp
+  802d5e:	89 e5                	mov    %esp,%ebp
+  802d60:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d63:	89 c2                	mov    %eax,%edx
+  802d65:	c1 ea 16             	shr    $0x16,%edx
+  802d68:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802d6f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d74:	f6 c1 01             	test   $0x1,%cl
+  802d77:	74 1a                	je     802d93 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802d79:	c1 e8 0c             	shr    $0xc,%eax
+  802d7c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802d83:	a8 01                	test   $0x1,%al
+  802d85:	74 0c                	je     802d93 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802d87:	c1 e8 0c             	shr    $0xc,%eax
+  802d8a:	c1 e0 04             	shl    $0x4,%eax
+  802d8d:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802d93:	89 d0                	mov    %edx,%eax
+  802d95:	5d                   	pop    %ebp
+  802d96:	c3                   	ret
@@ -0,0 +1,6458 @@
+
+obj/user/perf.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 47 01 00 00       	call   800178 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	unsigned arg;
+	int r;
+
+	if (argc < 2 || argc > 3) {
+  80003e:	8d 50 fe             	lea    -0x2(%eax),%edx
+  800041:	83 fa 01             	cmp    $0x1,%edx
+  800044:	77 42                	ja     800088 <umain+0x55>
+		usage();
+		return;
+	}
+	arg = argc == 3 ? strtol(argv[2], 0, 10) : 0;
+  800046:	83 f8 03             	cmp    $0x3,%eax
+  800049:	74 54                	je     80009f <umain+0x6c>
+	if (strcmp(argv[1], "start") == 0)
+  80004b:	83 ec 08             	sub    $0x8,%esp
+  80004e:	68 d6 2d 80 00       	push   $0x802dd6
+  800053:	ff 73 04             	push   0x4(%ebx)
+  800056:	e8 b5 09 00 00       	call   800a10 <strcmp>
+  80005b:	83 c4 10             	add    $0x10,%esp
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	0f 85 a2 00 00 00    	jne    800108 <umain+0xd5>
+	arg = argc == 3 ? strtol(argv[2], 0, 10) : 0;
+  800066:	be 00 00 00 00       	mov    $0x0,%esi
+		r = sys_perf(PERF_START, arg);
+  80006b:	83 ec 08             	sub    $0x8,%esp
+  80006e:	56                   	push   %esi
+  80006f:	6a 00                	push   $0x0
+  800071:	e8 12 13 00 00       	call   801388 <sys_perf>
+  800076:	83 c4 10             	add    $0x10,%esp
+		r = sys_perf(PERF_REPORT, argc == 3 ? arg : 20);
+	else {
+		usage();
+		return;
+	}
+	if (r < 0)
+  800079:	85 c0                	test   %eax,%eax
+  80007b:	0f 88 e1 00 00 00    	js     800162 <umain+0x12f>
+		printf("perf: %e\n", r);
+}
+  800081:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800084:	5b                   	pop    %ebx
+  800085:	5e                   	pop    %esi
+  800086:	5d                   	pop    %ebp
+  800087:	c3                   	ret
+	printf("usage: perf start [hz] | perf stop | perf report [n]\n");
+  800088:	83 ec 0c             	sub    $0xc,%esp
+  80008b:	68 a0 2d 80 00       	push   $0x802da0
+  800090:	e8 a1 21 00 00       	call   802236 <printf>
+	exit();
+  800095:	e8 88 01 00 00       	call   800222 <exit>
+}
+  80009a:	83 c4 10             	add    $0x10,%esp
+  80009d:	eb e2                	jmp    800081 <umain+0x4e>
+	arg = argc == 3 ? strtol(argv[2], 0, 10) : 0;
+  80009f:	83 ec 04             	sub    $0x4,%esp
+  8000a2:	6a 0a                	push   $0xa
+  8000a4:	6a 00                	push   $0x0
+  8000a6:	ff 73 08             	push   0x8(%ebx)
+  8000a9:	e8 05 0b 00 00       	call   800bb3 <strtol>
+  8000ae:	89 c6                	mov    %eax,%esi
+	if (strcmp(argv[1], "start") == 0)
+  8000b0:	83 c4 08             	add    $0x8,%esp
+  8000b3:	68 d6 2d 80 00       	push   $0x802dd6
+  8000b8:	ff 73 04             	push   0x4(%ebx)
+  8000bb:	e8 50 09 00 00       	call   800a10 <strcmp>
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	74 a4                	je     80006b <umain+0x38>
+	else if (strcmp(argv[1], "stop") == 0 && argc == 2)
+  8000c7:	83 ec 08             	sub    $0x8,%esp
+  8000ca:	68 dc 2d 80 00       	push   $0x802ddc
+  8000cf:	ff 73 04             	push   0x4(%ebx)
+  8000d2:	e8 39 09 00 00       	call   800a10 <strcmp>
+	else if (strcmp(argv[1], "report") == 0)
+  8000d7:	83 c4 08             	add    $0x8,%esp
+  8000da:	68 eb 2d 80 00       	push   $0x802deb
+  8000df:	ff 73 04             	push   0x4(%ebx)
+  8000e2:	e8 29 09 00 00       	call   800a10 <strcmp>
+  8000e7:	83 c4 10             	add    $0x10,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	74 4d                	je     80013b <umain+0x108>
+	printf("usage: perf start [hz] | perf stop | perf report [n]\n");
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  8000f1:	68 a0 2d 80 00       	push   $0x802da0
+  8000f6:	e8 3b 21 00 00       	call   802236 <printf>
+	exit();
+  8000fb:	e8 22 01 00 00       	call   800222 <exit>
+}
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	e9 79 ff ff ff       	jmp    800081 <umain+0x4e>
+	else if (strcmp(argv[1], "stop") == 0 && argc == 2)
+  800108:	83 ec 08             	sub    $0x8,%esp
+  80010b:	68 dc 2d 80 00       	push   $0x802ddc
+  800110:	ff 73 04             	push   0x4(%ebx)
+  800113:	e8 f8 08 00 00       	call   800a10 <strcmp>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	85 c0                	test   %eax,%eax
+  80011d:	74 2f                	je     80014e <umain+0x11b>
+	else if (strcmp(argv[1], "report") == 0)
+  80011f:	83 ec 08             	sub    $0x8,%esp
+  800122:	68 eb 2d 80 00       	push   $0x802deb
+  800127:	ff 73 04             	push   0x4(%ebx)
+  80012a:	e8 e1 08 00 00       	call   800a10 <strcmp>
+  80012f:	83 c4 10             	add    $0x10,%esp
+		r = sys_perf(PERF_REPORT, argc == 3 ? arg : 20);
+  800132:	be 14 00 00 00       	mov    $0x14,%esi
+	else if (strcmp(argv[1], "report") == 0)
+  800137:	85 c0                	test   %eax,%eax
+  800139:	75 b3                	jne    8000ee <umain+0xbb>
+		r = sys_perf(PERF_REPORT, argc == 3 ? arg : 20);
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	56                   	push   %esi
+  80013f:	6a 02                	push   $0x2
+  800141:	e8 42 12 00 00       	call   801388 <sys_perf>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	e9 2b ff ff ff       	jmp    800079 <umain+0x46>
+		r = sys_perf(PERF_STOP, 0);
+  80014e:	83 ec 08             	sub    $0x8,%esp
+  800151:	6a 00                	push   $0x0
+  800153:	6a 01                	push   $0x1
+  800155:	e8 2e 12 00 00       	call   801388 <sys_perf>
+  80015a:	83 c4 10             	add    $0x10,%esp
+  80015d:	e9 17 ff ff ff       	jmp    800079 <umain+0x46>
+		printf("perf: %e\n", r);
+  800162:	83 ec 08             	sub    $0x8,%esp
+  800165:	50                   	push   %eax
+  800166:	68 e1 2d 80 00       	push   $0x802de1
+  80016b:	e8 c6 20 00 00       	call   802236 <printf>
+  800170:	83 c4 10             	add    $0x10,%esp
+  800173:	e9 09 ff ff ff       	jmp    800081 <umain+0x4e>
+
+00800178 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	57                   	push   %edi
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800184:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800187:	b8 01 00 00 00       	mov    $0x1,%eax
+  80018c:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80018e:	c1 ea 0b             	shr    $0xb,%edx
+  800191:	83 f2 01             	xor    $0x1,%edx
+  800194:	83 e2 01             	and    $0x1,%edx
+  800197:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80019d:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8001a4:	00 00 00 
+	envid = sys_getenvid();
+  8001a7:	e8 1f 0c 00 00       	call   800dcb <sys_getenvid>
+  8001ac:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8001ae:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8001b3:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8001b9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8001bf:	8b 52 48             	mov    0x48(%edx),%edx
+  8001c2:	39 ca                	cmp    %ecx,%edx
+  8001c4:	74 27                	je     8001ed <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8001c6:	83 c0 01             	add    $0x1,%eax
+  8001c9:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001ce:	75 e3                	jne    8001b3 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8001d0:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8001d7:	75 24                	jne    8001fd <libmain+0x85>
+		panic("libmain can't find the environment");
+  8001d9:	83 ec 04             	sub    $0x4,%esp
+  8001dc:	68 f4 2d 80 00       	push   $0x802df4
+  8001e1:	6a 23                	push   $0x23
+  8001e3:	68 17 2e 80 00       	push   $0x802e17
+  8001e8:	e8 4f 00 00 00       	call   80023c <_panic>
+			mainenv = &envs[i];
+  8001ed:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001f3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f8:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001fd:	85 ff                	test   %edi,%edi
+  8001ff:	7e 07                	jle    800208 <libmain+0x90>
+		binaryname = argv[0];
+  800201:	8b 06                	mov    (%esi),%eax
+  800203:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800208:	83 ec 08             	sub    $0x8,%esp
+  80020b:	56                   	push   %esi
+  80020c:	57                   	push   %edi
+  80020d:	e8 21 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800212:	e8 0b 00 00 00       	call   800222 <exit>
+}
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021d:	5b                   	pop    %ebx
+  80021e:	5e                   	pop    %esi
+  80021f:	5f                   	pop    %edi
+  800220:	5d                   	pop    %ebp
+  800221:	c3                   	ret
+
+00800222 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800228:	e8 94 18 00 00       	call   801ac1 <close_all>
+	sys_env_destroy(0);
+  80022d:	83 ec 0c             	sub    $0xc,%esp
+  800230:	6a 00                	push   $0x0
+  800232:	e8 2b 0b 00 00       	call   800d62 <sys_env_destroy>
+}
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	56                   	push   %esi
+  800240:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800241:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800244:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80024a:	e8 7c 0b 00 00       	call   800dcb <sys_getenvid>
+  80024f:	83 ec 0c             	sub    $0xc,%esp
+  800252:	ff 75 0c             	push   0xc(%ebp)
+  800255:	ff 75 08             	push   0x8(%ebp)
+  800258:	56                   	push   %esi
+  800259:	50                   	push   %eax
+  80025a:	68 30 2e 80 00       	push   $0x802e30
+  80025f:	e8 b3 00 00 00       	call   800317 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800264:	83 c4 18             	add    $0x18,%esp
+  800267:	53                   	push   %ebx
+  800268:	ff 75 10             	push   0x10(%ebp)
+  80026b:	e8 56 00 00 00       	call   8002c6 <vcprintf>
+	cprintf("\n");
+  800270:	c7 04 24 ac 32 80 00 	movl   $0x8032ac,(%esp)
+  800277:	e8 9b 00 00 00       	call   800317 <cprintf>
+  80027c:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80027f:	cc                   	int3
+	while (1)
+  800280:	eb fd                	jmp    80027f <_panic+0x43>
+
+00800282 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800282:	55                   	push   %ebp
+  800283:	89 e5                	mov    %esp,%ebp
+  800285:	53                   	push   %ebx
+  800286:	83 ec 04             	sub    $0x4,%esp
+  800289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80028c:	8b 13                	mov    (%ebx),%edx
+  80028e:	8d 42 01             	lea    0x1(%edx),%eax
+  800291:	89 03                	mov    %eax,(%ebx)
+  800293:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800296:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80029a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80029f:	74 09                	je     8002aa <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002a1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a8:	c9                   	leave
+  8002a9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002aa:	83 ec 08             	sub    $0x8,%esp
+  8002ad:	68 ff 00 00 00       	push   $0xff
+  8002b2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b5:	50                   	push   %eax
+  8002b6:	e8 1d 0a 00 00       	call   800cd8 <sys_cputs>
+		b->idx = 0;
+  8002bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	eb db                	jmp    8002a1 <putch+0x1f>
+
+008002c6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002cf:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d6:	00 00 00 
+	b.cnt = 0;
+  8002d9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002e0:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002e3:	ff 75 0c             	push   0xc(%ebp)
+  8002e6:	ff 75 08             	push   0x8(%ebp)
+  8002e9:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002ef:	50                   	push   %eax
+  8002f0:	68 82 02 80 00       	push   $0x800282
+  8002f5:	e8 fb 00 00 00       	call   8003f5 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002fa:	83 c4 08             	add    $0x8,%esp
+  8002fd:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800303:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800309:	50                   	push   %eax
+  80030a:	e8 c9 09 00 00       	call   800cd8 <sys_cputs>
+
+	return b.cnt;
+}
+  80030f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800315:	c9                   	leave
+  800316:	c3                   	ret
+
+00800317 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80031d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800320:	50                   	push   %eax
+  800321:	ff 75 08             	push   0x8(%ebp)
+  800324:	e8 9d ff ff ff       	call   8002c6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800329:	c9                   	leave
+  80032a:	c3                   	ret
+
+0080032b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80032b:	55                   	push   %ebp
+  80032c:	89 e5                	mov    %esp,%ebp
+  80032e:	57                   	push   %edi
+  80032f:	56                   	push   %esi
+  800330:	53                   	push   %ebx
+  800331:	83 ec 1c             	sub    $0x1c,%esp
+  800334:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800337:	89 d6                	mov    %edx,%esi
+  800339:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80033c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80033f:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800342:	73 0b                	jae    80034f <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800344:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800347:	c1 e7 08             	shl    $0x8,%edi
+  80034a:	0b 7d 10             	or     0x10(%ebp),%edi
+  80034d:	eb 36                	jmp    800385 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80034f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800352:	ba 00 00 00 00       	mov    $0x0,%edx
+  800357:	f7 75 08             	divl   0x8(%ebp)
+  80035a:	89 c1                	mov    %eax,%ecx
+  80035c:	ff 75 14             	push   0x14(%ebp)
+  80035f:	ff 75 10             	push   0x10(%ebp)
+  800362:	83 eb 01             	sub    $0x1,%ebx
+  800365:	53                   	push   %ebx
+  800366:	ff 75 08             	push   0x8(%ebp)
+  800369:	89 f2                	mov    %esi,%edx
+  80036b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80036e:	e8 b8 ff ff ff       	call   80032b <printnum>
+  800373:	83 c4 10             	add    $0x10,%esp
+  800376:	eb 14                	jmp    80038c <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800378:	83 ec 08             	sub    $0x8,%esp
+  80037b:	56                   	push   %esi
+  80037c:	57                   	push   %edi
+  80037d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800380:	ff d0                	call   *%eax
+  800382:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800385:	83 eb 01             	sub    $0x1,%ebx
+  800388:	85 db                	test   %ebx,%ebx
+  80038a:	7f ec                	jg     800378 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80038c:	83 ec 08             	sub    $0x8,%esp
+  80038f:	56                   	push   %esi
+  800390:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800393:	ba 00 00 00 00       	mov    $0x0,%edx
+  800398:	f7 75 08             	divl   0x8(%ebp)
+  80039b:	0f be 92 53 2e 80 00 	movsbl 0x802e53(%edx),%edx
+  8003a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a5:	c1 e0 08             	shl    $0x8,%eax
+  8003a8:	09 d0                	or     %edx,%eax
+  8003aa:	50                   	push   %eax
+  8003ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003ae:	ff d0                	call   *%eax
+}
+  8003b0:	83 c4 10             	add    $0x10,%esp
+  8003b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b6:	5b                   	pop    %ebx
+  8003b7:	5e                   	pop    %esi
+  8003b8:	5f                   	pop    %edi
+  8003b9:	5d                   	pop    %ebp
+  8003ba:	c3                   	ret
+
+008003bb <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003bb:	55                   	push   %ebp
+  8003bc:	89 e5                	mov    %esp,%ebp
+  8003be:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003c1:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003c5:	8b 10                	mov    (%eax),%edx
+  8003c7:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003ca:	73 0a                	jae    8003d6 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003cc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003cf:	89 08                	mov    %ecx,(%eax)
+  8003d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003d4:	88 02                	mov    %al,(%edx)
+}
+  8003d6:	5d                   	pop    %ebp
+  8003d7:	c3                   	ret
+
+008003d8 <printfmt>:
+{
+  8003d8:	55                   	push   %ebp
+  8003d9:	89 e5                	mov    %esp,%ebp
+  8003db:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003de:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003e1:	50                   	push   %eax
+  8003e2:	ff 75 10             	push   0x10(%ebp)
+  8003e5:	ff 75 0c             	push   0xc(%ebp)
+  8003e8:	ff 75 08             	push   0x8(%ebp)
+  8003eb:	e8 05 00 00 00       	call   8003f5 <vprintfmt>
+}
+  8003f0:	83 c4 10             	add    $0x10,%esp
+  8003f3:	c9                   	leave
+  8003f4:	c3                   	ret
+
+008003f5 <vprintfmt>:
+{
+  8003f5:	55                   	push   %ebp
+  8003f6:	89 e5                	mov    %esp,%ebp
+  8003f8:	57                   	push   %edi
+  8003f9:	56                   	push   %esi
+  8003fa:	53                   	push   %ebx
+  8003fb:	83 ec 3c             	sub    $0x3c,%esp
+  8003fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800401:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800404:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80040b:	eb 16                	jmp    800423 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80040d:	83 ec 08             	sub    $0x8,%esp
+  800410:	ff 75 0c             	push   0xc(%ebp)
+  800413:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800416:	c1 e2 08             	shl    $0x8,%edx
+  800419:	09 d0                	or     %edx,%eax
+  80041b:	50                   	push   %eax
+  80041c:	ff d7                	call   *%edi
+  80041e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800421:	89 de                	mov    %ebx,%esi
+  800423:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800426:	0f b6 06             	movzbl (%esi),%eax
+  800429:	83 f8 25             	cmp    $0x25,%eax
+  80042c:	74 0c                	je     80043a <vprintfmt+0x45>
+			if (ch == '\0')
+  80042e:	85 c0                	test   %eax,%eax
+  800430:	75 db                	jne    80040d <vprintfmt+0x18>
+}
+  800432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800435:	5b                   	pop    %ebx
+  800436:	5e                   	pop    %esi
+  800437:	5f                   	pop    %edi
+  800438:	5d                   	pop    %ebp
+  800439:	c3                   	ret
+		padc = ' ';
+  80043a:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80043e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800445:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80044c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800453:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800458:	8d 73 01             	lea    0x1(%ebx),%esi
+  80045b:	0f b6 13             	movzbl (%ebx),%edx
+  80045e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800461:	3c 55                	cmp    $0x55,%al
+  800463:	0f 87 2c 04 00 00    	ja     800895 <vprintfmt+0x4a0>
+  800469:	0f b6 c0             	movzbl %al,%eax
+  80046c:	ff 24 85 a0 2f 80 00 	jmp    *0x802fa0(,%eax,4)
+  800473:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800475:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800479:	eb dd                	jmp    800458 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047b:	89 f3                	mov    %esi,%ebx
+  80047d:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800481:	eb d5                	jmp    800458 <vprintfmt+0x63>
+  800483:	0f b6 d2             	movzbl %dl,%edx
+  800486:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800488:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80048d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800490:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800494:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800497:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80049a:	83 fe 09             	cmp    $0x9,%esi
+  80049d:	0f 87 8a 00 00 00    	ja     80052d <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8004a3:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8004a6:	eb e5                	jmp    80048d <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8b 00                	mov    (%eax),%eax
+  8004ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8004b6:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b9:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8004bb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004bf:	79 97                	jns    800458 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8004c1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004ce:	eb 88                	jmp    800458 <vprintfmt+0x63>
+			if (width < 0)
+  8004d0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8004d3:	85 db                	test   %ebx,%ebx
+  8004d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004da:	0f 49 c3             	cmovns %ebx,%eax
+  8004dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e0:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004e2:	e9 71 ff ff ff       	jmp    800458 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e7:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8004e9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004f0:	e9 63 ff ff ff       	jmp    800458 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8004f5:	8d 73 02             	lea    0x2(%ebx),%esi
+  8004f8:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8004fc:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800503:	3c 67                	cmp    $0x67,%al
+  800505:	0f 84 18 ff ff ff    	je     800423 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80050b:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800512:	3c 72                	cmp    $0x72,%al
+  800514:	0f 84 09 ff ff ff    	je     800423 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80051a:	3c 62                	cmp    $0x62,%al
+  80051c:	0f 94 c0             	sete   %al
+  80051f:	0f b6 c0             	movzbl %al,%eax
+  800522:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800525:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800528:	e9 f6 fe ff ff       	jmp    800423 <vprintfmt+0x2e>
+  80052d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800530:	eb 89                	jmp    8004bb <vprintfmt+0xc6>
+			lflag++;
+  800532:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800535:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800537:	e9 1c ff ff ff       	jmp    800458 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80053c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053f:	8d 58 04             	lea    0x4(%eax),%ebx
+  800542:	83 ec 08             	sub    $0x8,%esp
+  800545:	ff 75 0c             	push   0xc(%ebp)
+  800548:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80054b:	c1 e0 08             	shl    $0x8,%eax
+  80054e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800551:	0b 01                	or     (%ecx),%eax
+  800553:	50                   	push   %eax
+  800554:	ff d7                	call   *%edi
+			break;
+  800556:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800559:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80055c:	e9 c2 fe ff ff       	jmp    800423 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800561:	8b 45 14             	mov    0x14(%ebp),%eax
+  800564:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800567:	8b 10                	mov    (%eax),%edx
+  800569:	89 d0                	mov    %edx,%eax
+  80056b:	f7 d8                	neg    %eax
+  80056d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800570:	83 f8 12             	cmp    $0x12,%eax
+  800573:	7f 25                	jg     80059a <vprintfmt+0x1a5>
+  800575:	8b 14 85 00 31 80 00 	mov    0x803100(,%eax,4),%edx
+  80057c:	85 d2                	test   %edx,%edx
+  80057e:	74 1a                	je     80059a <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800580:	52                   	push   %edx
+  800581:	68 41 32 80 00       	push   $0x803241
+  800586:	ff 75 0c             	push   0xc(%ebp)
+  800589:	57                   	push   %edi
+  80058a:	e8 49 fe ff ff       	call   8003d8 <printfmt>
+  80058f:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800592:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800595:	e9 89 fe ff ff       	jmp    800423 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80059a:	50                   	push   %eax
+  80059b:	68 6b 2e 80 00       	push   $0x802e6b
+  8005a0:	ff 75 0c             	push   0xc(%ebp)
+  8005a3:	57                   	push   %edi
+  8005a4:	e8 2f fe ff ff       	call   8003d8 <printfmt>
+  8005a9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005ac:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005af:	e9 6f fe ff ff       	jmp    800423 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b7:	83 c0 04             	add    $0x4,%eax
+  8005ba:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8005bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c0:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005c2:	85 c9                	test   %ecx,%ecx
+  8005c4:	b8 64 2e 80 00       	mov    $0x802e64,%eax
+  8005c9:	0f 45 c1             	cmovne %ecx,%eax
+  8005cc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8005cf:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005d3:	7e 06                	jle    8005db <vprintfmt+0x1e6>
+  8005d5:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8005d9:	75 1a                	jne    8005f5 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8005db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005de:	c1 e0 08             	shl    $0x8,%eax
+  8005e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8005e4:	83 c8 3f             	or     $0x3f,%eax
+  8005e7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005ea:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8005ed:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005f0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8005f3:	eb 6d                	jmp    800662 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f5:	83 ec 08             	sub    $0x8,%esp
+  8005f8:	ff 75 d0             	push   -0x30(%ebp)
+  8005fb:	ff 75 c8             	push   -0x38(%ebp)
+  8005fe:	e8 39 03 00 00       	call   80093c <strnlen>
+  800603:	89 c2                	mov    %eax,%edx
+  800605:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800608:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80060a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80060d:	c1 e1 08             	shl    $0x8,%ecx
+  800610:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800614:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800616:	83 c4 10             	add    $0x10,%esp
+  800619:	89 c3                	mov    %eax,%ebx
+  80061b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80061e:	89 75 10             	mov    %esi,0x10(%ebp)
+  800621:	89 ce                	mov    %ecx,%esi
+  800623:	eb 0f                	jmp    800634 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800625:	83 ec 08             	sub    $0x8,%esp
+  800628:	ff 75 0c             	push   0xc(%ebp)
+  80062b:	56                   	push   %esi
+  80062c:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80062e:	83 eb 01             	sub    $0x1,%ebx
+  800631:	83 c4 10             	add    $0x10,%esp
+  800634:	85 db                	test   %ebx,%ebx
+  800636:	7f ed                	jg     800625 <vprintfmt+0x230>
+  800638:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80063b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80063e:	85 c0                	test   %eax,%eax
+  800640:	ba 00 00 00 00       	mov    $0x0,%edx
+  800645:	0f 49 d0             	cmovns %eax,%edx
+  800648:	29 d0                	sub    %edx,%eax
+  80064a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80064d:	eb 8c                	jmp    8005db <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80064f:	83 ec 08             	sub    $0x8,%esp
+  800652:	ff 75 0c             	push   0xc(%ebp)
+  800655:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800658:	09 c2                	or     %eax,%edx
+  80065a:	52                   	push   %edx
+  80065b:	ff d7                	call   *%edi
+  80065d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800660:	89 d9                	mov    %ebx,%ecx
+  800662:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800665:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800669:	0f be d0             	movsbl %al,%edx
+  80066c:	85 d2                	test   %edx,%edx
+  80066e:	74 2a                	je     80069a <vprintfmt+0x2a5>
+  800670:	85 f6                	test   %esi,%esi
+  800672:	78 05                	js     800679 <vprintfmt+0x284>
+  800674:	83 ee 01             	sub    $0x1,%esi
+  800677:	78 3b                	js     8006b4 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800679:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80067d:	74 d0                	je     80064f <vprintfmt+0x25a>
+  80067f:	0f be c0             	movsbl %al,%eax
+  800682:	83 e8 20             	sub    $0x20,%eax
+  800685:	83 f8 5e             	cmp    $0x5e,%eax
+  800688:	76 c5                	jbe    80064f <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80068a:	83 ec 08             	sub    $0x8,%esp
+  80068d:	ff 75 0c             	push   0xc(%ebp)
+  800690:	ff 75 cc             	push   -0x34(%ebp)
+  800693:	ff d7                	call   *%edi
+  800695:	83 c4 10             	add    $0x10,%esp
+  800698:	eb c6                	jmp    800660 <vprintfmt+0x26b>
+  80069a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80069d:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8006a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006a3:	01 c3                	add    %eax,%ebx
+  8006a5:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8006a7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006aa:	83 c8 20             	or     $0x20,%eax
+  8006ad:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006b0:	89 c6                	mov    %eax,%esi
+  8006b2:	eb 14                	jmp    8006c8 <vprintfmt+0x2d3>
+  8006b4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006b7:	eb e4                	jmp    80069d <vprintfmt+0x2a8>
+  8006b9:	83 ec 08             	sub    $0x8,%esp
+  8006bc:	ff 75 0c             	push   0xc(%ebp)
+  8006bf:	56                   	push   %esi
+  8006c0:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006c2:	83 eb 01             	sub    $0x1,%ebx
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	85 db                	test   %ebx,%ebx
+  8006ca:	7f ed                	jg     8006b9 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006cc:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006cf:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8006d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d5:	e9 49 fd ff ff       	jmp    800423 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006da:	83 f9 01             	cmp    $0x1,%ecx
+  8006dd:	7f 1f                	jg     8006fe <vprintfmt+0x309>
+	else if (lflag)
+  8006df:	85 c9                	test   %ecx,%ecx
+  8006e1:	74 69                	je     80074c <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 00                	mov    (%eax),%eax
+  8006e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006eb:	89 c1                	mov    %eax,%ecx
+  8006ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fc:	eb 17                	jmp    800715 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 50 04             	mov    0x4(%eax),%edx
+  800704:	8b 00                	mov    (%eax),%eax
+  800706:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800709:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80070c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070f:	8d 40 08             	lea    0x8(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800715:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800718:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80071b:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800720:	85 db                	test   %ebx,%ebx
+  800722:	0f 89 f6 00 00 00    	jns    80081e <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800728:	83 ec 08             	sub    $0x8,%esp
+  80072b:	ff 75 0c             	push   0xc(%ebp)
+  80072e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800731:	c1 e0 08             	shl    $0x8,%eax
+  800734:	83 c8 2d             	or     $0x2d,%eax
+  800737:	50                   	push   %eax
+  800738:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80073a:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80073d:	f7 d9                	neg    %ecx
+  80073f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800742:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800747:	e9 d2 00 00 00       	jmp    80081e <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80074c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074f:	8b 00                	mov    (%eax),%eax
+  800751:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800754:	89 c1                	mov    %eax,%ecx
+  800756:	c1 f9 1f             	sar    $0x1f,%ecx
+  800759:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80075c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075f:	8d 40 04             	lea    0x4(%eax),%eax
+  800762:	89 45 14             	mov    %eax,0x14(%ebp)
+  800765:	eb ae                	jmp    800715 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800767:	83 f9 01             	cmp    $0x1,%ecx
+  80076a:	7f 19                	jg     800785 <vprintfmt+0x390>
+	else if (lflag)
+  80076c:	85 c9                	test   %ecx,%ecx
+  80076e:	74 2a                	je     80079a <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800770:	8b 45 14             	mov    0x14(%ebp),%eax
+  800773:	8b 08                	mov    (%eax),%ecx
+  800775:	8d 40 04             	lea    0x4(%eax),%eax
+  800778:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80077b:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800780:	e9 99 00 00 00       	jmp    80081e <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 08                	mov    (%eax),%ecx
+  80078a:	8d 40 08             	lea    0x8(%eax),%eax
+  80078d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800790:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800795:	e9 84 00 00 00       	jmp    80081e <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8b 08                	mov    (%eax),%ecx
+  80079f:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007a5:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8007aa:	eb 72                	jmp    80081e <vprintfmt+0x429>
+	if (lflag >= 2)
+  8007ac:	83 f9 01             	cmp    $0x1,%ecx
+  8007af:	7f 16                	jg     8007c7 <vprintfmt+0x3d2>
+	else if (lflag)
+  8007b1:	85 c9                	test   %ecx,%ecx
+  8007b3:	74 24                	je     8007d9 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 08                	mov    (%eax),%ecx
+  8007ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007c0:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8007c5:	eb 57                	jmp    80081e <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ca:	8b 08                	mov    (%eax),%ecx
+  8007cc:	8d 40 08             	lea    0x8(%eax),%eax
+  8007cf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007d2:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8007d7:	eb 45                	jmp    80081e <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007dc:	8b 08                	mov    (%eax),%ecx
+  8007de:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007e4:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8007e9:	eb 33                	jmp    80081e <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8007eb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007ee:	c1 e3 08             	shl    $0x8,%ebx
+  8007f1:	83 ec 08             	sub    $0x8,%esp
+  8007f4:	ff 75 0c             	push   0xc(%ebp)
+  8007f7:	89 d8                	mov    %ebx,%eax
+  8007f9:	83 c8 30             	or     $0x30,%eax
+  8007fc:	50                   	push   %eax
+  8007fd:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8007ff:	83 c4 08             	add    $0x8,%esp
+  800802:	ff 75 0c             	push   0xc(%ebp)
+  800805:	83 cb 78             	or     $0x78,%ebx
+  800808:	53                   	push   %ebx
+  800809:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80080b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080e:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800810:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800813:	8d 40 04             	lea    0x4(%eax),%eax
+  800816:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800819:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80081e:	ff 75 e4             	push   -0x1c(%ebp)
+  800821:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800825:	52                   	push   %edx
+  800826:	ff 75 e0             	push   -0x20(%ebp)
+  800829:	50                   	push   %eax
+  80082a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80082d:	89 f8                	mov    %edi,%eax
+  80082f:	e8 f7 fa ff ff       	call   80032b <printnum>
+			break;
+  800834:	83 c4 10             	add    $0x10,%esp
+  800837:	e9 e7 fb ff ff       	jmp    800423 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80083c:	83 f9 01             	cmp    $0x1,%ecx
+  80083f:	7f 16                	jg     800857 <vprintfmt+0x462>
+	else if (lflag)
+  800841:	85 c9                	test   %ecx,%ecx
+  800843:	74 24                	je     800869 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800845:	8b 45 14             	mov    0x14(%ebp),%eax
+  800848:	8b 08                	mov    (%eax),%ecx
+  80084a:	8d 40 04             	lea    0x4(%eax),%eax
+  80084d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800850:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800855:	eb c7                	jmp    80081e <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800857:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085a:	8b 08                	mov    (%eax),%ecx
+  80085c:	8d 40 08             	lea    0x8(%eax),%eax
+  80085f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800862:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800867:	eb b5                	jmp    80081e <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800869:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086c:	8b 08                	mov    (%eax),%ecx
+  80086e:	8d 40 04             	lea    0x4(%eax),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800874:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800879:	eb a3                	jmp    80081e <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80087b:	83 ec 08             	sub    $0x8,%esp
+  80087e:	ff 75 0c             	push   0xc(%ebp)
+  800881:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800884:	c1 e0 08             	shl    $0x8,%eax
+  800887:	83 c8 25             	or     $0x25,%eax
+  80088a:	50                   	push   %eax
+  80088b:	ff d7                	call   *%edi
+			break;
+  80088d:	83 c4 10             	add    $0x10,%esp
+  800890:	e9 8e fb ff ff       	jmp    800423 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800895:	83 ec 08             	sub    $0x8,%esp
+  800898:	ff 75 0c             	push   0xc(%ebp)
+  80089b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80089e:	c1 e0 08             	shl    $0x8,%eax
+  8008a1:	83 c8 25             	or     $0x25,%eax
+  8008a4:	50                   	push   %eax
+  8008a5:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008a7:	83 c4 10             	add    $0x10,%esp
+  8008aa:	89 de                	mov    %ebx,%esi
+  8008ac:	eb 03                	jmp    8008b1 <vprintfmt+0x4bc>
+  8008ae:	83 ee 01             	sub    $0x1,%esi
+  8008b1:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008b5:	75 f7                	jne    8008ae <vprintfmt+0x4b9>
+  8008b7:	e9 67 fb ff ff       	jmp    800423 <vprintfmt+0x2e>
+
+008008bc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008bc:	55                   	push   %ebp
+  8008bd:	89 e5                	mov    %esp,%ebp
+  8008bf:	83 ec 18             	sub    $0x18,%esp
+  8008c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008cb:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008cf:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008d2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008d9:	85 c0                	test   %eax,%eax
+  8008db:	74 26                	je     800903 <vsnprintf+0x47>
+  8008dd:	85 d2                	test   %edx,%edx
+  8008df:	7e 22                	jle    800903 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008e1:	ff 75 14             	push   0x14(%ebp)
+  8008e4:	ff 75 10             	push   0x10(%ebp)
+  8008e7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008ea:	50                   	push   %eax
+  8008eb:	68 bb 03 80 00       	push   $0x8003bb
+  8008f0:	e8 00 fb ff ff       	call   8003f5 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008f5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008f8:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008fe:	83 c4 10             	add    $0x10,%esp
+}
+  800901:	c9                   	leave
+  800902:	c3                   	ret
+		return -E_INVAL;
+  800903:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800908:	eb f7                	jmp    800901 <vsnprintf+0x45>
+
+0080090a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800910:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800913:	50                   	push   %eax
+  800914:	ff 75 10             	push   0x10(%ebp)
+  800917:	ff 75 0c             	push   0xc(%ebp)
+  80091a:	ff 75 08             	push   0x8(%ebp)
+  80091d:	e8 9a ff ff ff       	call   8008bc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+
+00800924 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80092a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092f:	eb 03                	jmp    800934 <strlen+0x10>
+		n++;
+  800931:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800934:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800938:	75 f7                	jne    800931 <strlen+0xd>
+	return n;
+}
+  80093a:	5d                   	pop    %ebp
+  80093b:	c3                   	ret
+
+0080093c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800942:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094a:	eb 03                	jmp    80094f <strnlen+0x13>
+		n++;
+  80094c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80094f:	39 d0                	cmp    %edx,%eax
+  800951:	74 08                	je     80095b <strnlen+0x1f>
+  800953:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800957:	75 f3                	jne    80094c <strnlen+0x10>
+  800959:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80095b:	89 d0                	mov    %edx,%eax
+  80095d:	5d                   	pop    %ebp
+  80095e:	c3                   	ret
+
+0080095f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80095f:	55                   	push   %ebp
+  800960:	89 e5                	mov    %esp,%ebp
+  800962:	53                   	push   %ebx
+  800963:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800966:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800972:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800975:	83 c0 01             	add    $0x1,%eax
+  800978:	84 d2                	test   %dl,%dl
+  80097a:	75 f2                	jne    80096e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80097c:	89 c8                	mov    %ecx,%eax
+  80097e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800981:	c9                   	leave
+  800982:	c3                   	ret
+
+00800983 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800983:	55                   	push   %ebp
+  800984:	89 e5                	mov    %esp,%ebp
+  800986:	53                   	push   %ebx
+  800987:	83 ec 10             	sub    $0x10,%esp
+  80098a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80098d:	53                   	push   %ebx
+  80098e:	e8 91 ff ff ff       	call   800924 <strlen>
+  800993:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800996:	ff 75 0c             	push   0xc(%ebp)
+  800999:	01 d8                	add    %ebx,%eax
+  80099b:	50                   	push   %eax
+  80099c:	e8 be ff ff ff       	call   80095f <strcpy>
+	return dst;
+}
+  8009a1:	89 d8                	mov    %ebx,%eax
+  8009a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a6:	c9                   	leave
+  8009a7:	c3                   	ret
+
+008009a8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	56                   	push   %esi
+  8009ac:	53                   	push   %ebx
+  8009ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009b3:	89 f3                	mov    %esi,%ebx
+  8009b5:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009b8:	89 f0                	mov    %esi,%eax
+  8009ba:	eb 0f                	jmp    8009cb <strncpy+0x23>
+		*dst++ = *src;
+  8009bc:	83 c0 01             	add    $0x1,%eax
+  8009bf:	0f b6 0a             	movzbl (%edx),%ecx
+  8009c2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009c5:	80 f9 01             	cmp    $0x1,%cl
+  8009c8:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009cb:	39 d8                	cmp    %ebx,%eax
+  8009cd:	75 ed                	jne    8009bc <strncpy+0x14>
+	}
+	return ret;
+}
+  8009cf:	89 f0                	mov    %esi,%eax
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5d                   	pop    %ebp
+  8009d4:	c3                   	ret
+
+008009d5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009d5:	55                   	push   %ebp
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	56                   	push   %esi
+  8009d9:	53                   	push   %ebx
+  8009da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e0:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009e3:	89 f0                	mov    %esi,%eax
+  8009e5:	85 d2                	test   %edx,%edx
+  8009e7:	74 21                	je     800a0a <strlcpy+0x35>
+  8009e9:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009ed:	89 f2                	mov    %esi,%edx
+  8009ef:	eb 09                	jmp    8009fa <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009f1:	83 c1 01             	add    $0x1,%ecx
+  8009f4:	83 c2 01             	add    $0x1,%edx
+  8009f7:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009fa:	39 c2                	cmp    %eax,%edx
+  8009fc:	74 09                	je     800a07 <strlcpy+0x32>
+  8009fe:	0f b6 19             	movzbl (%ecx),%ebx
+  800a01:	84 db                	test   %bl,%bl
+  800a03:	75 ec                	jne    8009f1 <strlcpy+0x1c>
+  800a05:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a07:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a0a:	29 f0                	sub    %esi,%eax
+}
+  800a0c:	5b                   	pop    %ebx
+  800a0d:	5e                   	pop    %esi
+  800a0e:	5d                   	pop    %ebp
+  800a0f:	c3                   	ret
+
+00800a10 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a10:	55                   	push   %ebp
+  800a11:	89 e5                	mov    %esp,%ebp
+  800a13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a16:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a19:	eb 06                	jmp    800a21 <strcmp+0x11>
+		p++, q++;
+  800a1b:	83 c1 01             	add    $0x1,%ecx
+  800a1e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a21:	0f b6 01             	movzbl (%ecx),%eax
+  800a24:	84 c0                	test   %al,%al
+  800a26:	74 04                	je     800a2c <strcmp+0x1c>
+  800a28:	3a 02                	cmp    (%edx),%al
+  800a2a:	74 ef                	je     800a1b <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a2c:	0f b6 c0             	movzbl %al,%eax
+  800a2f:	0f b6 12             	movzbl (%edx),%edx
+  800a32:	29 d0                	sub    %edx,%eax
+}
+  800a34:	5d                   	pop    %ebp
+  800a35:	c3                   	ret
+
+00800a36 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	53                   	push   %ebx
+  800a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a40:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a43:	eb 09                	jmp    800a4e <strncmp+0x18>
+		n--, p++, q++;
+  800a45:	83 ea 01             	sub    $0x1,%edx
+  800a48:	83 c0 01             	add    $0x1,%eax
+  800a4b:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a4e:	85 d2                	test   %edx,%edx
+  800a50:	74 18                	je     800a6a <strncmp+0x34>
+  800a52:	0f b6 18             	movzbl (%eax),%ebx
+  800a55:	84 db                	test   %bl,%bl
+  800a57:	74 04                	je     800a5d <strncmp+0x27>
+  800a59:	3a 19                	cmp    (%ecx),%bl
+  800a5b:	74 e8                	je     800a45 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a5d:	0f b6 00             	movzbl (%eax),%eax
+  800a60:	0f b6 11             	movzbl (%ecx),%edx
+  800a63:	29 d0                	sub    %edx,%eax
+}
+  800a65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a68:	c9                   	leave
+  800a69:	c3                   	ret
+		return 0;
+  800a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6f:	eb f4                	jmp    800a65 <strncmp+0x2f>
+
+00800a71 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a77:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a7b:	eb 03                	jmp    800a80 <strchr+0xf>
+  800a7d:	83 c0 01             	add    $0x1,%eax
+  800a80:	0f b6 10             	movzbl (%eax),%edx
+  800a83:	84 d2                	test   %dl,%dl
+  800a85:	74 06                	je     800a8d <strchr+0x1c>
+		if (*s == c)
+  800a87:	38 ca                	cmp    %cl,%dl
+  800a89:	75 f2                	jne    800a7d <strchr+0xc>
+  800a8b:	eb 05                	jmp    800a92 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a92:	5d                   	pop    %ebp
+  800a93:	c3                   	ret
+
+00800a94 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a94:	55                   	push   %ebp
+  800a95:	89 e5                	mov    %esp,%ebp
+  800a97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a9e:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800aa1:	38 ca                	cmp    %cl,%dl
+  800aa3:	74 09                	je     800aae <strfind+0x1a>
+  800aa5:	84 d2                	test   %dl,%dl
+  800aa7:	74 05                	je     800aae <strfind+0x1a>
+	for (; *s; s++)
+  800aa9:	83 c0 01             	add    $0x1,%eax
+  800aac:	eb f0                	jmp    800a9e <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800aae:	5d                   	pop    %ebp
+  800aaf:	c3                   	ret
+
+00800ab0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	57                   	push   %edi
+  800ab4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800aba:	85 c9                	test   %ecx,%ecx
+  800abc:	74 20                	je     800ade <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800abe:	89 f8                	mov    %edi,%eax
+  800ac0:	09 c8                	or     %ecx,%eax
+  800ac2:	a8 03                	test   $0x3,%al
+  800ac4:	75 12                	jne    800ad8 <memset+0x28>
+		c &= 0xFF;
+  800ac6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800aca:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ad0:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ad3:	fc                   	cld
+  800ad4:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ad6:	eb 06                	jmp    800ade <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ad8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800adb:	fc                   	cld
+  800adc:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ade:	89 f8                	mov    %edi,%eax
+  800ae0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ae3:	c9                   	leave
+  800ae4:	c3                   	ret
+
+00800ae5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ae5:	55                   	push   %ebp
+  800ae6:	89 e5                	mov    %esp,%ebp
+  800ae8:	57                   	push   %edi
+  800ae9:	56                   	push   %esi
+  800aea:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800af0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800af3:	39 c6                	cmp    %eax,%esi
+  800af5:	73 32                	jae    800b29 <memmove+0x44>
+  800af7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800afa:	39 d0                	cmp    %edx,%eax
+  800afc:	73 2b                	jae    800b29 <memmove+0x44>
+		s += n;
+		d += n;
+  800afe:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b01:	89 d6                	mov    %edx,%esi
+  800b03:	09 fe                	or     %edi,%esi
+  800b05:	09 ce                	or     %ecx,%esi
+  800b07:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b0d:	75 0e                	jne    800b1d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b0f:	83 ef 04             	sub    $0x4,%edi
+  800b12:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b15:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b18:	fd                   	std
+  800b19:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b1b:	eb 09                	jmp    800b26 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b1d:	83 ef 01             	sub    $0x1,%edi
+  800b20:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b23:	fd                   	std
+  800b24:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b26:	fc                   	cld
+  800b27:	eb 1a                	jmp    800b43 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b29:	89 f2                	mov    %esi,%edx
+  800b2b:	09 c2                	or     %eax,%edx
+  800b2d:	09 ca                	or     %ecx,%edx
+  800b2f:	f6 c2 03             	test   $0x3,%dl
+  800b32:	75 0a                	jne    800b3e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b34:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b37:	89 c7                	mov    %eax,%edi
+  800b39:	fc                   	cld
+  800b3a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b3c:	eb 05                	jmp    800b43 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b3e:	89 c7                	mov    %eax,%edi
+  800b40:	fc                   	cld
+  800b41:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b43:	5e                   	pop    %esi
+  800b44:	5f                   	pop    %edi
+  800b45:	5d                   	pop    %ebp
+  800b46:	c3                   	ret
+
+00800b47 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b47:	55                   	push   %ebp
+  800b48:	89 e5                	mov    %esp,%ebp
+  800b4a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b4d:	ff 75 10             	push   0x10(%ebp)
+  800b50:	ff 75 0c             	push   0xc(%ebp)
+  800b53:	ff 75 08             	push   0x8(%ebp)
+  800b56:	e8 8a ff ff ff       	call   800ae5 <memmove>
+}
+  800b5b:	c9                   	leave
+  800b5c:	c3                   	ret
+
+00800b5d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b5d:	55                   	push   %ebp
+  800b5e:	89 e5                	mov    %esp,%ebp
+  800b60:	56                   	push   %esi
+  800b61:	53                   	push   %ebx
+  800b62:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b65:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b68:	89 c6                	mov    %eax,%esi
+  800b6a:	03 75 10             	add    0x10(%ebp),%esi
+  800b6d:	eb 06                	jmp    800b75 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b6f:	83 c0 01             	add    $0x1,%eax
+  800b72:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b75:	39 f0                	cmp    %esi,%eax
+  800b77:	74 14                	je     800b8d <memcmp+0x30>
+		if (*s1 != *s2)
+  800b79:	0f b6 08             	movzbl (%eax),%ecx
+  800b7c:	0f b6 1a             	movzbl (%edx),%ebx
+  800b7f:	38 d9                	cmp    %bl,%cl
+  800b81:	74 ec                	je     800b6f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b83:	0f b6 c1             	movzbl %cl,%eax
+  800b86:	0f b6 db             	movzbl %bl,%ebx
+  800b89:	29 d8                	sub    %ebx,%eax
+  800b8b:	eb 05                	jmp    800b92 <memcmp+0x35>
+	}
+
+	return 0;
+  800b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b92:	5b                   	pop    %ebx
+  800b93:	5e                   	pop    %esi
+  800b94:	5d                   	pop    %ebp
+  800b95:	c3                   	ret
+
+00800b96 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b96:	55                   	push   %ebp
+  800b97:	89 e5                	mov    %esp,%ebp
+  800b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b9f:	89 c2                	mov    %eax,%edx
+  800ba1:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba4:	eb 03                	jmp    800ba9 <memfind+0x13>
+  800ba6:	83 c0 01             	add    $0x1,%eax
+  800ba9:	39 d0                	cmp    %edx,%eax
+  800bab:	73 04                	jae    800bb1 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bad:	38 08                	cmp    %cl,(%eax)
+  800baf:	75 f5                	jne    800ba6 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bb1:	5d                   	pop    %ebp
+  800bb2:	c3                   	ret
+
+00800bb3 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800bb3:	55                   	push   %ebp
+  800bb4:	89 e5                	mov    %esp,%ebp
+  800bb6:	57                   	push   %edi
+  800bb7:	56                   	push   %esi
+  800bb8:	53                   	push   %ebx
+  800bb9:	83 ec 1c             	sub    $0x1c,%esp
+  800bbc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bbf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bc2:	eb 03                	jmp    800bc7 <strtol+0x14>
+		s++;
+  800bc4:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800bc7:	0f b6 06             	movzbl (%esi),%eax
+  800bca:	3c 20                	cmp    $0x20,%al
+  800bcc:	74 f6                	je     800bc4 <strtol+0x11>
+  800bce:	3c 09                	cmp    $0x9,%al
+  800bd0:	74 f2                	je     800bc4 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bd2:	3c 2b                	cmp    $0x2b,%al
+  800bd4:	74 43                	je     800c19 <strtol+0x66>
+	int neg = 0;
+  800bd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800bdb:	3c 2d                	cmp    $0x2d,%al
+  800bdd:	74 44                	je     800c23 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bdf:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800be5:	75 0f                	jne    800bf6 <strtol+0x43>
+  800be7:	80 3e 30             	cmpb   $0x30,(%esi)
+  800bea:	74 41                	je     800c2d <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bec:	85 ff                	test   %edi,%edi
+  800bee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bf3:	0f 44 f8             	cmove  %eax,%edi
+  800bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfb:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c00:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c03:	89 fb                	mov    %edi,%ebx
+  800c05:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c08:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c0b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c0e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c11:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c14:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c17:	eb 67                	jmp    800c80 <strtol+0xcd>
+		s++;
+  800c19:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c21:	eb bc                	jmp    800bdf <strtol+0x2c>
+		s++, neg = 1;
+  800c23:	83 c6 01             	add    $0x1,%esi
+  800c26:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c2b:	eb b2                	jmp    800bdf <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c2d:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c31:	74 0e                	je     800c41 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c33:	85 ff                	test   %edi,%edi
+  800c35:	75 bf                	jne    800bf6 <strtol+0x43>
+		s++, base = 8;
+  800c37:	83 c6 01             	add    $0x1,%esi
+  800c3a:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c3f:	eb b5                	jmp    800bf6 <strtol+0x43>
+		s += 2, base = 16;
+  800c41:	83 c6 02             	add    $0x2,%esi
+  800c44:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c49:	eb ab                	jmp    800bf6 <strtol+0x43>
+			dig = *s - '0';
+  800c4b:	0f be c9             	movsbl %cl,%ecx
+  800c4e:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c51:	39 f9                	cmp    %edi,%ecx
+  800c53:	7d 59                	jge    800cae <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c55:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c59:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c5c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c5f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c62:	0f af d8             	imul   %eax,%ebx
+  800c65:	0f af d7             	imul   %edi,%edx
+  800c68:	01 d3                	add    %edx,%ebx
+  800c6a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c6d:	f7 e7                	mul    %edi
+  800c6f:	01 da                	add    %ebx,%edx
+  800c71:	89 cb                	mov    %ecx,%ebx
+  800c73:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c76:	01 c8                	add    %ecx,%eax
+  800c78:	11 da                	adc    %ebx,%edx
+  800c7a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c7d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c80:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c83:	0f b6 08             	movzbl (%eax),%ecx
+  800c86:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c89:	80 fb 09             	cmp    $0x9,%bl
+  800c8c:	76 bd                	jbe    800c4b <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c8e:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c91:	80 fb 19             	cmp    $0x19,%bl
+  800c94:	77 08                	ja     800c9e <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c96:	0f be c9             	movsbl %cl,%ecx
+  800c99:	83 e9 57             	sub    $0x57,%ecx
+  800c9c:	eb b3                	jmp    800c51 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c9e:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800ca1:	80 fb 19             	cmp    $0x19,%bl
+  800ca4:	77 08                	ja     800cae <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800ca6:	0f be c9             	movsbl %cl,%ecx
+  800ca9:	83 e9 37             	sub    $0x37,%ecx
+  800cac:	eb a3                	jmp    800c51 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800cb1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cb4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cb7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cba:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cbe:	74 05                	je     800cc5 <strtol+0x112>
+		*endptr = (char *) s;
+  800cc0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cc3:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800cc5:	85 c9                	test   %ecx,%ecx
+  800cc7:	74 07                	je     800cd0 <strtol+0x11d>
+  800cc9:	f7 d8                	neg    %eax
+  800ccb:	83 d2 00             	adc    $0x0,%edx
+  800cce:	f7 da                	neg    %edx
+}
+  800cd0:	83 c4 1c             	add    $0x1c,%esp
+  800cd3:	5b                   	pop    %ebx
+  800cd4:	5e                   	pop    %esi
+  800cd5:	5f                   	pop    %edi
+  800cd6:	5d                   	pop    %ebp
+  800cd7:	c3                   	ret
+
+00800cd8 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cd8:	55                   	push   %ebp
+  800cd9:	89 e5                	mov    %esp,%ebp
+  800cdb:	57                   	push   %edi
+  800cdc:	56                   	push   %esi
+  800cdd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cde:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ce5:	74 18                	je     800cff <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf2:	89 c3                	mov    %eax,%ebx
+  800cf4:	89 c7                	mov    %eax,%edi
+  800cf6:	89 c6                	mov    %eax,%esi
+  800cf8:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cfa:	5b                   	pop    %ebx
+  800cfb:	5e                   	pop    %esi
+  800cfc:	5f                   	pop    %edi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0a:	89 c3                	mov    %eax,%ebx
+  800d0c:	89 c7                	mov    %eax,%edi
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	8d 35 19 0d 80 00    	lea    0x800d19,%esi
+  800d17:	0f 34                	sysenter
+  800d19:	5d                   	pop    %ebp
+		goto out;
+  800d1a:	eb de                	jmp    800cfa <sys_cputs+0x22>
+
+00800d1c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	57                   	push   %edi
+  800d20:	56                   	push   %esi
+  800d21:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d22:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d29:	74 19                	je     800d44 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d30:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d35:	89 d1                	mov    %edx,%ecx
+  800d37:	89 d3                	mov    %edx,%ebx
+  800d39:	89 d7                	mov    %edx,%edi
+  800d3b:	89 d6                	mov    %edx,%esi
+  800d3d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d3f:	5b                   	pop    %ebx
+  800d40:	5e                   	pop    %esi
+  800d41:	5f                   	pop    %edi
+  800d42:	5d                   	pop    %ebp
+  800d43:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d49:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d4e:	89 d1                	mov    %edx,%ecx
+  800d50:	89 d3                	mov    %edx,%ebx
+  800d52:	89 d7                	mov    %edx,%edi
+  800d54:	55                   	push   %ebp
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	8d 35 5f 0d 80 00    	lea    0x800d5f,%esi
+  800d5d:	0f 34                	sysenter
+  800d5f:	5d                   	pop    %ebp
+		goto out;
+  800d60:	eb dd                	jmp    800d3f <sys_cgetc+0x23>
+
+00800d62 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	56                   	push   %esi
+  800d67:	53                   	push   %ebx
+  800d68:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d6b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d72:	74 21                	je     800d95 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d79:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d81:	89 cb                	mov    %ecx,%ebx
+  800d83:	89 cf                	mov    %ecx,%edi
+  800d85:	89 ce                	mov    %ecx,%esi
+  800d87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	7f 27                	jg     800db4 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d9d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800da2:	89 cb                	mov    %ecx,%ebx
+  800da4:	89 cf                	mov    %ecx,%edi
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	8d 35 b1 0d 80 00    	lea    0x800db1,%esi
+  800daf:	0f 34                	sysenter
+  800db1:	5d                   	pop    %ebp
+		goto out;
+  800db2:	eb d5                	jmp    800d89 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db4:	83 ec 0c             	sub    $0xc,%esp
+  800db7:	50                   	push   %eax
+  800db8:	6a 03                	push   $0x3
+  800dba:	68 6b 31 80 00       	push   $0x80316b
+  800dbf:	6a 3f                	push   $0x3f
+  800dc1:	68 88 31 80 00       	push   $0x803188
+  800dc6:	e8 71 f4 ff ff       	call   80023c <_panic>
+
+00800dcb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	57                   	push   %edi
+  800dcf:	56                   	push   %esi
+  800dd0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dd1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dd8:	74 19                	je     800df3 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800dda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800de4:	89 d1                	mov    %edx,%ecx
+  800de6:	89 d3                	mov    %edx,%ebx
+  800de8:	89 d7                	mov    %edx,%edi
+  800dea:	89 d6                	mov    %edx,%esi
+  800dec:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dee:	5b                   	pop    %ebx
+  800def:	5e                   	pop    %esi
+  800df0:	5f                   	pop    %edi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df8:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dfd:	89 d1                	mov    %edx,%ecx
+  800dff:	89 d3                	mov    %edx,%ebx
+  800e01:	89 d7                	mov    %edx,%edi
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	8d 35 0e 0e 80 00    	lea    0x800e0e,%esi
+  800e0c:	0f 34                	sysenter
+  800e0e:	5d                   	pop    %ebp
+		goto out;
+  800e0f:	eb dd                	jmp    800dee <sys_getenvid+0x23>
+
+00800e11 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e17:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e1e:	74 19                	je     800e39 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e25:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e2a:	89 d1                	mov    %edx,%ecx
+  800e2c:	89 d3                	mov    %edx,%ebx
+  800e2e:	89 d7                	mov    %edx,%edi
+  800e30:	89 d6                	mov    %edx,%esi
+  800e32:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e34:	5b                   	pop    %ebx
+  800e35:	5e                   	pop    %esi
+  800e36:	5f                   	pop    %edi
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e39:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e43:	89 d1                	mov    %edx,%ecx
+  800e45:	89 d3                	mov    %edx,%ebx
+  800e47:	89 d7                	mov    %edx,%edi
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	8d 35 54 0e 80 00    	lea    0x800e54,%esi
+  800e52:	0f 34                	sysenter
+  800e54:	5d                   	pop    %ebp
+		goto out;
+  800e55:	eb dd                	jmp    800e34 <sys_yield+0x23>
+
+00800e57 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	57                   	push   %edi
+  800e5b:	56                   	push   %esi
+  800e5c:	53                   	push   %ebx
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e60:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e67:	74 23                	je     800e8c <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e69:	be 00 00 00 00       	mov    $0x0,%esi
+  800e6e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7c:	89 f7                	mov    %esi,%edi
+  800e7e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e80:	85 c0                	test   %eax,%eax
+  800e82:	7f 29                	jg     800ead <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e87:	5b                   	pop    %ebx
+  800e88:	5e                   	pop    %esi
+  800e89:	5f                   	pop    %edi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e92:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e97:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	8d 35 aa 0e 80 00    	lea    0x800eaa,%esi
+  800ea8:	0f 34                	sysenter
+  800eaa:	5d                   	pop    %ebp
+		goto out;
+  800eab:	eb d3                	jmp    800e80 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ead:	83 ec 0c             	sub    $0xc,%esp
+  800eb0:	50                   	push   %eax
+  800eb1:	6a 04                	push   $0x4
+  800eb3:	68 6b 31 80 00       	push   $0x80316b
+  800eb8:	6a 3f                	push   $0x3f
+  800eba:	68 88 31 80 00       	push   $0x803188
+  800ebf:	e8 78 f3 ff ff       	call   80023c <_panic>
+
+00800ec4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	56                   	push   %esi
+  800ec9:	53                   	push   %ebx
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  800ecd:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800ed0:	85 f6                	test   %esi,%esi
+  800ed2:	75 09                	jne    800edd <sys_page_map+0x19>
+  800ed4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800edb:	74 1f                	je     800efc <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800edd:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eeb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eee:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 27                	jg     800f1b <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f02:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	8d 35 18 0f 80 00    	lea    0x800f18,%esi
+  800f16:	0f 34                	sysenter
+  800f18:	5d                   	pop    %ebp
+		goto out;
+  800f19:	eb d5                	jmp    800ef0 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1b:	83 ec 0c             	sub    $0xc,%esp
+  800f1e:	50                   	push   %eax
+  800f1f:	6a 05                	push   $0x5
+  800f21:	68 6b 31 80 00       	push   $0x80316b
+  800f26:	6a 3f                	push   $0x3f
+  800f28:	68 88 31 80 00       	push   $0x803188
+  800f2d:	e8 0a f3 ff ff       	call   80023c <_panic>
+
+00800f32 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	57                   	push   %edi
+  800f36:	56                   	push   %esi
+  800f37:	53                   	push   %ebx
+  800f38:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f3b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f42:	74 22                	je     800f66 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f49:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	89 df                	mov    %ebx,%edi
+  800f56:	89 de                	mov    %ebx,%esi
+  800f58:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5a:	85 c0                	test   %eax,%eax
+  800f5c:	7f 28                	jg     800f86 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f61:	5b                   	pop    %ebx
+  800f62:	5e                   	pop    %esi
+  800f63:	5f                   	pop    %edi
+  800f64:	5d                   	pop    %ebp
+  800f65:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f71:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f76:	89 df                	mov    %ebx,%edi
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	8d 35 83 0f 80 00    	lea    0x800f83,%esi
+  800f81:	0f 34                	sysenter
+  800f83:	5d                   	pop    %ebp
+		goto out;
+  800f84:	eb d4                	jmp    800f5a <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f86:	83 ec 0c             	sub    $0xc,%esp
+  800f89:	50                   	push   %eax
+  800f8a:	6a 06                	push   $0x6
+  800f8c:	68 6b 31 80 00       	push   $0x80316b
+  800f91:	6a 3f                	push   $0x3f
+  800f93:	68 88 31 80 00       	push   $0x803188
+  800f98:	e8 9f f2 ff ff       	call   80023c <_panic>
+
+00800f9d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	57                   	push   %edi
+  800fa1:	56                   	push   %esi
+  800fa2:	53                   	push   %ebx
+  800fa3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fa6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fad:	74 22                	je     800fd1 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800faf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb4:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbf:	89 df                	mov    %ebx,%edi
+  800fc1:	89 de                	mov    %ebx,%esi
+  800fc3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc5:	85 c0                	test   %eax,%eax
+  800fc7:	7f 28                	jg     800ff1 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fe1:	89 df                	mov    %ebx,%edi
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	8d 35 ee 0f 80 00    	lea    0x800fee,%esi
+  800fec:	0f 34                	sysenter
+  800fee:	5d                   	pop    %ebp
+		goto out;
+  800fef:	eb d4                	jmp    800fc5 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff1:	83 ec 0c             	sub    $0xc,%esp
+  800ff4:	50                   	push   %eax
+  800ff5:	6a 08                	push   $0x8
+  800ff7:	68 6b 31 80 00       	push   $0x80316b
+  800ffc:	6a 3f                	push   $0x3f
+  800ffe:	68 88 31 80 00       	push   $0x803188
+  801003:	e8 34 f2 ff ff       	call   80023c <_panic>
+
+00801008 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801008:	55                   	push   %ebp
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	57                   	push   %edi
+  80100c:	56                   	push   %esi
+  80100d:	53                   	push   %ebx
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801011:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801018:	74 22                	je     80103c <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80101a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801024:	8b 55 08             	mov    0x8(%ebp),%edx
+  801027:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102a:	89 df                	mov    %ebx,%edi
+  80102c:	89 de                	mov    %ebx,%esi
+  80102e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801030:	85 c0                	test   %eax,%eax
+  801032:	7f 28                	jg     80105c <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801034:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80103c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	b8 09 00 00 00       	mov    $0x9,%eax
+  80104c:	89 df                	mov    %ebx,%edi
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	8d 35 59 10 80 00    	lea    0x801059,%esi
+  801057:	0f 34                	sysenter
+  801059:	5d                   	pop    %ebp
+		goto out;
+  80105a:	eb d4                	jmp    801030 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+  80105f:	50                   	push   %eax
+  801060:	6a 09                	push   $0x9
+  801062:	68 6b 31 80 00       	push   $0x80316b
+  801067:	6a 3f                	push   $0x3f
+  801069:	68 88 31 80 00       	push   $0x803188
+  80106e:	e8 c9 f1 ff ff       	call   80023c <_panic>
+
+00801073 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	57                   	push   %edi
+  801077:	56                   	push   %esi
+  801078:	53                   	push   %ebx
+  801079:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80107c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801083:	74 22                	je     8010a7 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801085:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80108f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801092:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801095:	89 df                	mov    %ebx,%edi
+  801097:	89 de                	mov    %ebx,%esi
+  801099:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109b:	85 c0                	test   %eax,%eax
+  80109d:	7f 28                	jg     8010c7 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80109f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a2:	5b                   	pop    %ebx
+  8010a3:	5e                   	pop    %esi
+  8010a4:	5f                   	pop    %edi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010b7:	89 df                	mov    %ebx,%edi
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	8d 35 c4 10 80 00    	lea    0x8010c4,%esi
+  8010c2:	0f 34                	sysenter
+  8010c4:	5d                   	pop    %ebp
+		goto out;
+  8010c5:	eb d4                	jmp    80109b <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c7:	83 ec 0c             	sub    $0xc,%esp
+  8010ca:	50                   	push   %eax
+  8010cb:	6a 0a                	push   $0xa
+  8010cd:	68 6b 31 80 00       	push   $0x80316b
+  8010d2:	6a 3f                	push   $0x3f
+  8010d4:	68 88 31 80 00       	push   $0x803188
+  8010d9:	e8 5e f1 ff ff       	call   80023c <_panic>
+
+008010de <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	56                   	push   %esi
+  8010e3:	53                   	push   %ebx
+  8010e4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010e7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010ee:	74 22                	je     801112 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8010f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f5:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801100:	89 df                	mov    %ebx,%edi
+  801102:	89 de                	mov    %ebx,%esi
+  801104:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801106:	85 c0                	test   %eax,%eax
+  801108:	7f 28                	jg     801132 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80110a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110d:	5b                   	pop    %ebx
+  80110e:	5e                   	pop    %esi
+  80110f:	5f                   	pop    %edi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801112:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801122:	89 df                	mov    %ebx,%edi
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	8d 35 2f 11 80 00    	lea    0x80112f,%esi
+  80112d:	0f 34                	sysenter
+  80112f:	5d                   	pop    %ebp
+		goto out;
+  801130:	eb d4                	jmp    801106 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801132:	83 ec 0c             	sub    $0xc,%esp
+  801135:	50                   	push   %eax
+  801136:	6a 17                	push   $0x17
+  801138:	68 6b 31 80 00       	push   $0x80316b
+  80113d:	6a 3f                	push   $0x3f
+  80113f:	68 88 31 80 00       	push   $0x803188
+  801144:	e8 f3 f0 ff ff       	call   80023c <_panic>
+
+00801149 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	57                   	push   %edi
+  80114d:	56                   	push   %esi
+  80114e:	53                   	push   %ebx
+  80114f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801152:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801159:	74 22                	je     80117d <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80115b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801160:	b8 18 00 00 00       	mov    $0x18,%eax
+  801165:	8b 55 08             	mov    0x8(%ebp),%edx
+  801168:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116b:	89 df                	mov    %ebx,%edi
+  80116d:	89 de                	mov    %ebx,%esi
+  80116f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801171:	85 c0                	test   %eax,%eax
+  801173:	7f 28                	jg     80119d <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80117d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801182:	8b 55 08             	mov    0x8(%ebp),%edx
+  801185:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801188:	b8 18 00 00 00       	mov    $0x18,%eax
+  80118d:	89 df                	mov    %ebx,%edi
+  80118f:	55                   	push   %ebp
+  801190:	89 e5                	mov    %esp,%ebp
+  801192:	8d 35 9a 11 80 00    	lea    0x80119a,%esi
+  801198:	0f 34                	sysenter
+  80119a:	5d                   	pop    %ebp
+		goto out;
+  80119b:	eb d4                	jmp    801171 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80119d:	83 ec 0c             	sub    $0xc,%esp
+  8011a0:	50                   	push   %eax
+  8011a1:	6a 18                	push   $0x18
+  8011a3:	68 6b 31 80 00       	push   $0x80316b
+  8011a8:	6a 3f                	push   $0x3f
+  8011aa:	68 88 31 80 00       	push   $0x803188
+  8011af:	e8 88 f0 ff ff       	call   80023c <_panic>
+
+008011b4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011b4:	55                   	push   %ebp
+  8011b5:	89 e5                	mov    %esp,%ebp
+  8011b7:	57                   	push   %edi
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011ba:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011c1:	74 1d                	je     8011e0 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8011c3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011d9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011db:	5b                   	pop    %ebx
+  8011dc:	5e                   	pop    %esi
+  8011dd:	5f                   	pop    %edi
+  8011de:	5d                   	pop    %ebp
+  8011df:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011f1:	55                   	push   %ebp
+  8011f2:	89 e5                	mov    %esp,%ebp
+  8011f4:	8d 35 fc 11 80 00    	lea    0x8011fc,%esi
+  8011fa:	0f 34                	sysenter
+  8011fc:	5d                   	pop    %ebp
+		goto out;
+  8011fd:	eb dc                	jmp    8011db <sys_ipc_try_send+0x27>
+
+008011ff <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011ff:	55                   	push   %ebp
+  801200:	89 e5                	mov    %esp,%ebp
+  801202:	57                   	push   %edi
+  801203:	56                   	push   %esi
+  801204:	53                   	push   %ebx
+  801205:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801208:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80120f:	74 21                	je     801232 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801211:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801216:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	89 cb                	mov    %ecx,%ebx
+  801220:	89 cf                	mov    %ecx,%edi
+  801222:	89 ce                	mov    %ecx,%esi
+  801224:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801226:	85 c0                	test   %eax,%eax
+  801228:	7f 27                	jg     801251 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80122a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122d:	5b                   	pop    %ebx
+  80122e:	5e                   	pop    %esi
+  80122f:	5f                   	pop    %edi
+  801230:	5d                   	pop    %ebp
+  801231:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801232:	8b 55 08             	mov    0x8(%ebp),%edx
+  801235:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80123a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80123f:	89 cb                	mov    %ecx,%ebx
+  801241:	89 cf                	mov    %ecx,%edi
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	8d 35 4e 12 80 00    	lea    0x80124e,%esi
+  80124c:	0f 34                	sysenter
+  80124e:	5d                   	pop    %ebp
+		goto out;
+  80124f:	eb d5                	jmp    801226 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801251:	83 ec 0c             	sub    $0xc,%esp
+  801254:	50                   	push   %eax
+  801255:	6a 0d                	push   $0xd
+  801257:	68 6b 31 80 00       	push   $0x80316b
+  80125c:	6a 3f                	push   $0x3f
+  80125e:	68 88 31 80 00       	push   $0x803188
+  801263:	e8 d4 ef ff ff       	call   80023c <_panic>
+
+00801268 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	57                   	push   %edi
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80126e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801275:	74 1b                	je     801292 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801277:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801281:	8b 55 08             	mov    0x8(%ebp),%edx
+  801284:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801287:	89 df                	mov    %ebx,%edi
+  801289:	89 de                	mov    %ebx,%esi
+  80128b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80128d:	5b                   	pop    %ebx
+  80128e:	5e                   	pop    %esi
+  80128f:	5f                   	pop    %edi
+  801290:	5d                   	pop    %ebp
+  801291:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801292:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801297:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012a2:	89 df                	mov    %ebx,%edi
+  8012a4:	55                   	push   %ebp
+  8012a5:	89 e5                	mov    %esp,%ebp
+  8012a7:	8d 35 af 12 80 00    	lea    0x8012af,%esi
+  8012ad:	0f 34                	sysenter
+  8012af:	5d                   	pop    %ebp
+		goto out;
+  8012b0:	eb db                	jmp    80128d <sys_ipc_recv_until+0x25>
+
+008012b2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	57                   	push   %edi
+  8012b6:	56                   	push   %esi
+  8012b7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012b8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012bf:	74 19                	je     8012da <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8012c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012cb:	89 d1                	mov    %edx,%ecx
+  8012cd:	89 d3                	mov    %edx,%ebx
+  8012cf:	89 d7                	mov    %edx,%edi
+  8012d1:	89 d6                	mov    %edx,%esi
+  8012d3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012d5:	5b                   	pop    %ebx
+  8012d6:	5e                   	pop    %esi
+  8012d7:	5f                   	pop    %edi
+  8012d8:	5d                   	pop    %ebp
+  8012d9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012df:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e4:	89 d1                	mov    %edx,%ecx
+  8012e6:	89 d3                	mov    %edx,%ebx
+  8012e8:	89 d7                	mov    %edx,%edi
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	8d 35 f5 12 80 00    	lea    0x8012f5,%esi
+  8012f3:	0f 34                	sysenter
+  8012f5:	5d                   	pop    %ebp
+		goto out;
+  8012f6:	eb dd                	jmp    8012d5 <sys_time_msec+0x23>
+
+008012f8 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012fe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801305:	74 1a                	je     801321 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801307:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801311:	8b 55 08             	mov    0x8(%ebp),%edx
+  801314:	89 cb                	mov    %ecx,%ebx
+  801316:	89 cf                	mov    %ecx,%edi
+  801318:	89 ce                	mov    %ecx,%esi
+  80131a:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80131c:	5b                   	pop    %ebx
+  80131d:	5e                   	pop    %esi
+  80131e:	5f                   	pop    %edi
+  80131f:	5d                   	pop    %ebp
+  801320:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801321:	8b 55 08             	mov    0x8(%ebp),%edx
+  801324:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801329:	b8 10 00 00 00       	mov    $0x10,%eax
+  80132e:	89 cb                	mov    %ecx,%ebx
+  801330:	89 cf                	mov    %ecx,%edi
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	8d 35 3d 13 80 00    	lea    0x80133d,%esi
+  80133b:	0f 34                	sysenter
+  80133d:	5d                   	pop    %ebp
+		goto out;
+  80133e:	eb dc                	jmp    80131c <sys_sleep_until+0x24>
+
+00801340 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  801343:	57                   	push   %edi
+  801344:	56                   	push   %esi
+  801345:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801346:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80134d:	74 1a                	je     801369 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80134f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801354:	b8 11 00 00 00       	mov    $0x11,%eax
+  801359:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135c:	89 cb                	mov    %ecx,%ebx
+  80135e:	89 cf                	mov    %ecx,%edi
+  801360:	89 ce                	mov    %ecx,%esi
+  801362:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801369:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801371:	b8 11 00 00 00       	mov    $0x11,%eax
+  801376:	89 cb                	mov    %ecx,%ebx
+  801378:	89 cf                	mov    %ecx,%edi
+  80137a:	55                   	push   %ebp
+  80137b:	89 e5                	mov    %esp,%ebp
+  80137d:	8d 35 85 13 80 00    	lea    0x801385,%esi
+  801383:	0f 34                	sysenter
+  801385:	5d                   	pop    %ebp
+		goto out;
+  801386:	eb dc                	jmp    801364 <sys_env_print_stats+0x24>
+
+00801388 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	57                   	push   %edi
+  80138c:	56                   	push   %esi
+  80138d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80138e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801395:	74 1b                	je     8013b2 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801397:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139c:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a7:	89 df                	mov    %ebx,%edi
+  8013a9:	89 de                	mov    %ebx,%esi
+  8013ab:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8013ad:	5b                   	pop    %ebx
+  8013ae:	5e                   	pop    %esi
+  8013af:	5f                   	pop    %edi
+  8013b0:	5d                   	pop    %ebp
+  8013b1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bd:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013c2:	89 df                	mov    %ebx,%edi
+  8013c4:	55                   	push   %ebp
+  8013c5:	89 e5                	mov    %esp,%ebp
+  8013c7:	8d 35 cf 13 80 00    	lea    0x8013cf,%esi
+  8013cd:	0f 34                	sysenter
+  8013cf:	5d                   	pop    %ebp
+		goto out;
+  8013d0:	eb db                	jmp    8013ad <sys_perf+0x25>
+
+008013d2 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+  8013d5:	57                   	push   %edi
+  8013d6:	56                   	push   %esi
+  8013d7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013d8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013df:	74 19                	je     8013fa <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8013e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013eb:	89 d1                	mov    %edx,%ecx
+  8013ed:	89 d3                	mov    %edx,%ebx
+  8013ef:	89 d7                	mov    %edx,%edi
+  8013f1:	89 d6                	mov    %edx,%esi
+  8013f3:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013f5:	5b                   	pop    %ebx
+  8013f6:	5e                   	pop    %esi
+  8013f7:	5f                   	pop    %edi
+  8013f8:	5d                   	pop    %ebp
+  8013f9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ff:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801404:	89 d1                	mov    %edx,%ecx
+  801406:	89 d3                	mov    %edx,%ebx
+  801408:	89 d7                	mov    %edx,%edi
+  80140a:	55                   	push   %ebp
+  80140b:	89 e5                	mov    %esp,%ebp
+  80140d:	8d 35 15 14 80 00    	lea    0x801415,%esi
+  801413:	0f 34                	sysenter
+  801415:	5d                   	pop    %ebp
+		goto out;
+  801416:	eb dd                	jmp    8013f5 <sys_fork+0x23>
+
+00801418 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+  80141b:	57                   	push   %edi
+  80141c:	56                   	push   %esi
+  80141d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80141e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801425:	74 1c                	je     801443 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801427:	be 00 00 00 00       	mov    $0x0,%esi
+  80142c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801431:	8b 55 08             	mov    0x8(%ebp),%edx
+  801434:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801437:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143a:	89 f7                	mov    %esi,%edi
+  80143c:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80143e:	5b                   	pop    %ebx
+  80143f:	5e                   	pop    %esi
+  801440:	5f                   	pop    %edi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801443:	8b 55 08             	mov    0x8(%ebp),%edx
+  801446:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801449:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80144e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801453:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801456:	55                   	push   %ebp
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	8d 35 61 14 80 00    	lea    0x801461,%esi
+  80145f:	0f 34                	sysenter
+  801461:	5d                   	pop    %ebp
+		goto out;
+  801462:	eb da                	jmp    80143e <sys_thread_create+0x26>
+
+00801464 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801464:	55                   	push   %ebp
+  801465:	89 e5                	mov    %esp,%ebp
+  801467:	57                   	push   %edi
+  801468:	56                   	push   %esi
+  801469:	53                   	push   %ebx
+  80146a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80146d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801474:	74 24                	je     80149a <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801476:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80147b:	be 00 00 00 00       	mov    $0x0,%esi
+  801480:	8b 55 08             	mov    0x8(%ebp),%edx
+  801483:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801486:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801489:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80148c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80148e:	85 c0                	test   %eax,%eax
+  801490:	7f 27                	jg     8014b9 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801495:	5b                   	pop    %ebx
+  801496:	5e                   	pop    %esi
+  801497:	5f                   	pop    %edi
+  801498:	5d                   	pop    %ebp
+  801499:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80149a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014ab:	55                   	push   %ebp
+  8014ac:	89 e5                	mov    %esp,%ebp
+  8014ae:	8d 35 b6 14 80 00    	lea    0x8014b6,%esi
+  8014b4:	0f 34                	sysenter
+  8014b6:	5d                   	pop    %ebp
+		goto out;
+  8014b7:	eb d5                	jmp    80148e <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014b9:	83 ec 0c             	sub    $0xc,%esp
+  8014bc:	50                   	push   %eax
+  8014bd:	6a 1f                	push   $0x1f
+  8014bf:	68 6b 31 80 00       	push   $0x80316b
+  8014c4:	6a 3f                	push   $0x3f
+  8014c6:	68 88 31 80 00       	push   $0x803188
+  8014cb:	e8 6c ed ff ff       	call   80023c <_panic>
+
+008014d0 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8014d0:	55                   	push   %ebp
+  8014d1:	89 e5                	mov    %esp,%ebp
+  8014d3:	57                   	push   %edi
+  8014d4:	56                   	push   %esi
+  8014d5:	53                   	push   %ebx
+  8014d6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014d9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e0:	74 23                	je     801505 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8014e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f5:	89 f7                	mov    %esi,%edi
+  8014f7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	7f 29                	jg     801526 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8014fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801500:	5b                   	pop    %ebx
+  801501:	5e                   	pop    %esi
+  801502:	5f                   	pop    %edi
+  801503:	5d                   	pop    %ebp
+  801504:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801505:	8b 55 08             	mov    0x8(%ebp),%edx
+  801508:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150b:	b8 20 00 00 00       	mov    $0x20,%eax
+  801510:	bf 00 00 00 00       	mov    $0x0,%edi
+  801515:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801518:	55                   	push   %ebp
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	8d 35 23 15 80 00    	lea    0x801523,%esi
+  801521:	0f 34                	sysenter
+  801523:	5d                   	pop    %ebp
+		goto out;
+  801524:	eb d3                	jmp    8014f9 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801526:	83 ec 0c             	sub    $0xc,%esp
+  801529:	50                   	push   %eax
+  80152a:	6a 20                	push   $0x20
+  80152c:	68 6b 31 80 00       	push   $0x80316b
+  801531:	6a 3f                	push   $0x3f
+  801533:	68 88 31 80 00       	push   $0x803188
+  801538:	e8 ff ec ff ff       	call   80023c <_panic>
+
+0080153d <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80153d:	55                   	push   %ebp
+  80153e:	89 e5                	mov    %esp,%ebp
+  801540:	57                   	push   %edi
+  801541:	56                   	push   %esi
+  801542:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801543:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80154a:	74 1b                	je     801567 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80154c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801551:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801556:	8b 55 08             	mov    0x8(%ebp),%edx
+  801559:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155c:	89 df                	mov    %ebx,%edi
+  80155e:	89 de                	mov    %ebx,%esi
+  801560:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801562:	5b                   	pop    %ebx
+  801563:	5e                   	pop    %esi
+  801564:	5f                   	pop    %edi
+  801565:	5d                   	pop    %ebp
+  801566:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801567:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801572:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801577:	89 df                	mov    %ebx,%edi
+  801579:	55                   	push   %ebp
+  80157a:	89 e5                	mov    %esp,%ebp
+  80157c:	8d 35 84 15 80 00    	lea    0x801584,%esi
+  801582:	0f 34                	sysenter
+  801584:	5d                   	pop    %ebp
+		goto out;
+  801585:	eb db                	jmp    801562 <sys_batch+0x25>
+
+00801587 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	57                   	push   %edi
+  80158b:	56                   	push   %esi
+  80158c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80158d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801594:	74 1a                	je     8015b0 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801596:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80159b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a3:	89 cb                	mov    %ecx,%ebx
+  8015a5:	89 cf                	mov    %ecx,%edi
+  8015a7:	89 ce                	mov    %ecx,%esi
+  8015a9:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8015ab:	5b                   	pop    %ebx
+  8015ac:	5e                   	pop    %esi
+  8015ad:	5f                   	pop    %edi
+  8015ae:	5d                   	pop    %ebp
+  8015af:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015bd:	89 cb                	mov    %ecx,%ebx
+  8015bf:	89 cf                	mov    %ecx,%edi
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	8d 35 cc 15 80 00    	lea    0x8015cc,%esi
+  8015ca:	0f 34                	sysenter
+  8015cc:	5d                   	pop    %ebp
+		goto out;
+  8015cd:	eb dc                	jmp    8015ab <sys_trace_ctl+0x24>
+
+008015cf <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	57                   	push   %edi
+  8015d3:	56                   	push   %esi
+  8015d4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015d5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015dc:	74 1c                	je     8015fa <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8015de:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f1:	89 f7                	mov    %esi,%edi
+  8015f3:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8015f5:	5b                   	pop    %ebx
+  8015f6:	5e                   	pop    %esi
+  8015f7:	5f                   	pop    %edi
+  8015f8:	5d                   	pop    %ebp
+  8015f9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801600:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801605:	bf 00 00 00 00       	mov    $0x0,%edi
+  80160a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	8d 35 18 16 80 00    	lea    0x801618,%esi
+  801616:	0f 34                	sysenter
+  801618:	5d                   	pop    %ebp
+		goto out;
+  801619:	eb da                	jmp    8015f5 <sys_trace_read+0x26>
+
+0080161b <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80161b:	55                   	push   %ebp
+  80161c:	89 e5                	mov    %esp,%ebp
+  80161e:	57                   	push   %edi
+  80161f:	56                   	push   %esi
+  801620:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801621:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801628:	74 1c                	je     801646 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80162a:	be 00 00 00 00       	mov    $0x0,%esi
+  80162f:	b8 21 00 00 00       	mov    $0x21,%eax
+  801634:	8b 55 08             	mov    0x8(%ebp),%edx
+  801637:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80163d:	89 f7                	mov    %esi,%edi
+  80163f:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801641:	5b                   	pop    %ebx
+  801642:	5e                   	pop    %esi
+  801643:	5f                   	pop    %edi
+  801644:	5d                   	pop    %ebp
+  801645:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801646:	8b 55 08             	mov    0x8(%ebp),%edx
+  801649:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80164c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801651:	bf 00 00 00 00       	mov    $0x0,%edi
+  801656:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801659:	55                   	push   %ebp
+  80165a:	89 e5                	mov    %esp,%ebp
+  80165c:	8d 35 64 16 80 00    	lea    0x801664,%esi
+  801662:	0f 34                	sysenter
+  801664:	5d                   	pop    %ebp
+		goto out;
+  801665:	eb da                	jmp    801641 <sys_meminfo+0x26>
+
+00801667 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801667:	55                   	push   %ebp
+  801668:	89 e5                	mov    %esp,%ebp
+  80166a:	57                   	push   %edi
+  80166b:	56                   	push   %esi
+  80166c:	53                   	push   %ebx
+  80166d:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801670:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801674:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80167b:	74 1f                	je     80169c <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80167d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801682:	b8 22 00 00 00       	mov    $0x22,%eax
+  801687:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168a:	89 df                	mov    %ebx,%edi
+  80168c:	89 de                	mov    %ebx,%esi
+  80168e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801690:	85 c0                	test   %eax,%eax
+  801692:	7f 25                	jg     8016b9 <sys_env_set_ksm+0x52>
+}
+  801694:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801697:	5b                   	pop    %ebx
+  801698:	5e                   	pop    %esi
+  801699:	5f                   	pop    %edi
+  80169a:	5d                   	pop    %ebp
+  80169b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80169c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a4:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016a9:	89 df                	mov    %ebx,%edi
+  8016ab:	55                   	push   %ebp
+  8016ac:	89 e5                	mov    %esp,%ebp
+  8016ae:	8d 35 b6 16 80 00    	lea    0x8016b6,%esi
+  8016b4:	0f 34                	sysenter
+  8016b6:	5d                   	pop    %ebp
+		goto out;
+  8016b7:	eb d7                	jmp    801690 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016b9:	83 ec 0c             	sub    $0xc,%esp
+  8016bc:	50                   	push   %eax
+  8016bd:	6a 22                	push   $0x22
+  8016bf:	68 6b 31 80 00       	push   $0x80316b
+  8016c4:	6a 3f                	push   $0x3f
+  8016c6:	68 88 31 80 00       	push   $0x803188
+  8016cb:	e8 6c eb ff ff       	call   80023c <_panic>
+
+008016d0 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8016d0:	55                   	push   %ebp
+  8016d1:	89 e5                	mov    %esp,%ebp
+  8016d3:	57                   	push   %edi
+  8016d4:	56                   	push   %esi
+  8016d5:	53                   	push   %ebx
+  8016d6:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8016d9:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8016dc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016e3:	74 24                	je     801709 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8016e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016ef:	89 cb                	mov    %ecx,%ebx
+  8016f1:	89 cf                	mov    %ecx,%edi
+  8016f3:	89 ce                	mov    %ecx,%esi
+  8016f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016f7:	85 c0                	test   %eax,%eax
+  8016f9:	7f 2a                	jg     801725 <sys_time_nsec+0x55>
+	return ns;
+}
+  8016fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016fe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801701:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801704:	5b                   	pop    %ebx
+  801705:	5e                   	pop    %esi
+  801706:	5f                   	pop    %edi
+  801707:	5d                   	pop    %ebp
+  801708:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801709:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80170e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801713:	89 cb                	mov    %ecx,%ebx
+  801715:	89 cf                	mov    %ecx,%edi
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	8d 35 22 17 80 00    	lea    0x801722,%esi
+  801720:	0f 34                	sysenter
+  801722:	5d                   	pop    %ebp
+		goto out;
+  801723:	eb d2                	jmp    8016f7 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801725:	83 ec 0c             	sub    $0xc,%esp
+  801728:	50                   	push   %eax
+  801729:	6a 0f                	push   $0xf
+  80172b:	68 6b 31 80 00       	push   $0x80316b
+  801730:	6a 3f                	push   $0x3f
+  801732:	68 88 31 80 00       	push   $0x803188
+  801737:	e8 00 eb ff ff       	call   80023c <_panic>
+
+0080173c <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	57                   	push   %edi
+  801740:	56                   	push   %esi
+  801741:	53                   	push   %ebx
+  801742:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801745:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80174c:	74 22                	je     801770 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80174e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801753:	b8 12 00 00 00       	mov    $0x12,%eax
+  801758:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175e:	89 df                	mov    %ebx,%edi
+  801760:	89 de                	mov    %ebx,%esi
+  801762:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801764:	85 c0                	test   %eax,%eax
+  801766:	7f 28                	jg     801790 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801768:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176b:	5b                   	pop    %ebx
+  80176c:	5e                   	pop    %esi
+  80176d:	5f                   	pop    %edi
+  80176e:	5d                   	pop    %ebp
+  80176f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801770:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801775:	8b 55 08             	mov    0x8(%ebp),%edx
+  801778:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801780:	89 df                	mov    %ebx,%edi
+  801782:	55                   	push   %ebp
+  801783:	89 e5                	mov    %esp,%ebp
+  801785:	8d 35 8d 17 80 00    	lea    0x80178d,%esi
+  80178b:	0f 34                	sysenter
+  80178d:	5d                   	pop    %ebp
+		goto out;
+  80178e:	eb d4                	jmp    801764 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801790:	83 ec 0c             	sub    $0xc,%esp
+  801793:	50                   	push   %eax
+  801794:	6a 12                	push   $0x12
+  801796:	68 6b 31 80 00       	push   $0x80316b
+  80179b:	6a 3f                	push   $0x3f
+  80179d:	68 88 31 80 00       	push   $0x803188
+  8017a2:	e8 95 ea ff ff       	call   80023c <_panic>
+
+008017a7 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	57                   	push   %edi
+  8017ab:	56                   	push   %esi
+  8017ac:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ad:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017b4:	74 1b                	je     8017d1 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8017b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bb:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c6:	89 df                	mov    %ebx,%edi
+  8017c8:	89 de                	mov    %ebx,%esi
+  8017ca:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017cc:	5b                   	pop    %ebx
+  8017cd:	5e                   	pop    %esi
+  8017ce:	5f                   	pop    %edi
+  8017cf:	5d                   	pop    %ebp
+  8017d0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017dc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017e1:	89 df                	mov    %ebx,%edi
+  8017e3:	55                   	push   %ebp
+  8017e4:	89 e5                	mov    %esp,%ebp
+  8017e6:	8d 35 ee 17 80 00    	lea    0x8017ee,%esi
+  8017ec:	0f 34                	sysenter
+  8017ee:	5d                   	pop    %ebp
+		goto out;
+  8017ef:	eb db                	jmp    8017cc <sys_e1000_receive+0x25>
+
+008017f1 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8017f1:	55                   	push   %ebp
+  8017f2:	89 e5                	mov    %esp,%ebp
+  8017f4:	57                   	push   %edi
+  8017f5:	56                   	push   %esi
+  8017f6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017f7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017fe:	74 1b                	je     80181b <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801800:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801805:	b8 14 00 00 00       	mov    $0x14,%eax
+  80180a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801810:	89 df                	mov    %ebx,%edi
+  801812:	89 de                	mov    %ebx,%esi
+  801814:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801816:	5b                   	pop    %ebx
+  801817:	5e                   	pop    %esi
+  801818:	5f                   	pop    %edi
+  801819:	5d                   	pop    %ebp
+  80181a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80181b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801820:	8b 55 08             	mov    0x8(%ebp),%edx
+  801823:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801826:	b8 14 00 00 00       	mov    $0x14,%eax
+  80182b:	89 df                	mov    %ebx,%edi
+  80182d:	55                   	push   %ebp
+  80182e:	89 e5                	mov    %esp,%ebp
+  801830:	8d 35 38 18 80 00    	lea    0x801838,%esi
+  801836:	0f 34                	sysenter
+  801838:	5d                   	pop    %ebp
+		goto out;
+  801839:	eb db                	jmp    801816 <sys_e1000_read_hwaddr+0x25>
+
+0080183b <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	57                   	push   %edi
+  80183f:	56                   	push   %esi
+  801840:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801841:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801848:	74 1a                	je     801864 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80184a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80184f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801854:	8b 55 08             	mov    0x8(%ebp),%edx
+  801857:	89 cb                	mov    %ecx,%ebx
+  801859:	89 cf                	mov    %ecx,%edi
+  80185b:	89 ce                	mov    %ecx,%esi
+  80185d:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80185f:	5b                   	pop    %ebx
+  801860:	5e                   	pop    %esi
+  801861:	5f                   	pop    %edi
+  801862:	5d                   	pop    %ebp
+  801863:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801864:	8b 55 08             	mov    0x8(%ebp),%edx
+  801867:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80186c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801871:	89 cb                	mov    %ecx,%ebx
+  801873:	89 cf                	mov    %ecx,%edi
+  801875:	55                   	push   %ebp
+  801876:	89 e5                	mov    %esp,%ebp
+  801878:	8d 35 80 18 80 00    	lea    0x801880,%esi
+  80187e:	0f 34                	sysenter
+  801880:	5d                   	pop    %ebp
+		goto out;
+  801881:	eb dc                	jmp    80185f <sys_sb16_read_version+0x24>
+
+00801883 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801883:	55                   	push   %ebp
+  801884:	89 e5                	mov    %esp,%ebp
+  801886:	57                   	push   %edi
+  801887:	56                   	push   %esi
+  801888:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801889:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801890:	74 1b                	je     8018ad <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801892:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801897:	b8 16 00 00 00       	mov    $0x16,%eax
+  80189c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a2:	89 df                	mov    %ebx,%edi
+  8018a4:	89 de                	mov    %ebx,%esi
+  8018a6:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8018a8:	5b                   	pop    %ebx
+  8018a9:	5e                   	pop    %esi
+  8018aa:	5f                   	pop    %edi
+  8018ab:	5d                   	pop    %ebp
+  8018ac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018bd:	89 df                	mov    %ebx,%edi
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	8d 35 ca 18 80 00    	lea    0x8018ca,%esi
+  8018c8:	0f 34                	sysenter
+  8018ca:	5d                   	pop    %ebp
+		goto out;
+  8018cb:	eb db                	jmp    8018a8 <sys_sb16_play+0x25>
+
+008018cd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018d8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018db:	5d                   	pop    %ebp
+  8018dc:	c3                   	ret
+
+008018dd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018dd:	55                   	push   %ebp
+  8018de:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018e8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018ed:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018f2:	5d                   	pop    %ebp
+  8018f3:	c3                   	ret
+
+008018f4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018f4:	55                   	push   %ebp
+  8018f5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018f7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018fc:	eb 02                	jmp    801900 <fd_alloc+0xc>
+  8018fe:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801900:	89 c2                	mov    %eax,%edx
+  801902:	c1 ea 16             	shr    $0x16,%edx
+  801905:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80190c:	f6 c2 01             	test   $0x1,%dl
+  80190f:	74 2b                	je     80193c <fd_alloc+0x48>
+  801911:	89 c2                	mov    %eax,%edx
+  801913:	c1 ea 0c             	shr    $0xc,%edx
+  801916:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80191d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801923:	f6 c1 01             	test   $0x1,%cl
+  801926:	74 14                	je     80193c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801928:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80192e:	75 ce                	jne    8018fe <fd_alloc+0xa>
+  801930:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801935:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80193a:	eb 05                	jmp    801941 <fd_alloc+0x4d>
+			return 0;
+  80193c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801941:	8b 55 08             	mov    0x8(%ebp),%edx
+  801944:	89 02                	mov    %eax,(%edx)
+}
+  801946:	89 c8                	mov    %ecx,%eax
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+
+0080194a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801950:	83 f8 1f             	cmp    $0x1f,%eax
+  801953:	77 30                	ja     801985 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801955:	c1 e0 0c             	shl    $0xc,%eax
+  801958:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80195d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801963:	f6 c2 01             	test   $0x1,%dl
+  801966:	74 24                	je     80198c <fd_lookup+0x42>
+  801968:	89 c2                	mov    %eax,%edx
+  80196a:	c1 ea 0c             	shr    $0xc,%edx
+  80196d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801974:	f6 c2 01             	test   $0x1,%dl
+  801977:	74 1a                	je     801993 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801979:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80197c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80197e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801983:	5d                   	pop    %ebp
+  801984:	c3                   	ret
+		return -E_INVAL;
+  801985:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80198a:	eb f7                	jmp    801983 <fd_lookup+0x39>
+		return -E_INVAL;
+  80198c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801991:	eb f0                	jmp    801983 <fd_lookup+0x39>
+  801993:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801998:	eb e9                	jmp    801983 <fd_lookup+0x39>
+
+0080199a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80199a:	55                   	push   %ebp
+  80199b:	89 e5                	mov    %esp,%ebp
+  80199d:	53                   	push   %ebx
+  80199e:	83 ec 04             	sub    $0x4,%esp
+  8019a1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8019a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a9:	eb 03                	jmp    8019ae <dev_lookup+0x14>
+  8019ab:	83 c0 01             	add    $0x1,%eax
+  8019ae:	8b 1c 85 14 32 80 00 	mov    0x803214(,%eax,4),%ebx
+  8019b5:	85 db                	test   %ebx,%ebx
+  8019b7:	74 0b                	je     8019c4 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8019b9:	39 13                	cmp    %edx,(%ebx)
+  8019bb:	75 ee                	jne    8019ab <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8019bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c2:	eb 2e                	jmp    8019f2 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8019c4:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8019c6:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8019cb:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8019d1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8019d6:	76 24                	jbe    8019fc <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019d8:	8b 41 48             	mov    0x48(%ecx),%eax
+  8019db:	83 ec 04             	sub    $0x4,%esp
+  8019de:	52                   	push   %edx
+  8019df:	50                   	push   %eax
+  8019e0:	68 98 31 80 00       	push   $0x803198
+  8019e5:	e8 2d e9 ff ff       	call   800317 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019f5:	89 1a                	mov    %ebx,(%edx)
+}
+  8019f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019fa:	c9                   	leave
+  8019fb:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8019fc:	c1 e8 10             	shr    $0x10,%eax
+  8019ff:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801a05:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801a0b:	eb cb                	jmp    8019d8 <dev_lookup+0x3e>
+
+00801a0d <fd_close>:
+{
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	57                   	push   %edi
+  801a11:	56                   	push   %esi
+  801a12:	53                   	push   %ebx
+  801a13:	83 ec 24             	sub    $0x24,%esp
+  801a16:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a19:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a1c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a1f:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a20:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a26:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a29:	50                   	push   %eax
+  801a2a:	e8 1b ff ff ff       	call   80194a <fd_lookup>
+  801a2f:	89 c3                	mov    %eax,%ebx
+  801a31:	83 c4 10             	add    $0x10,%esp
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	78 05                	js     801a3d <fd_close+0x30>
+	    || fd != fd2)
+  801a38:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a3b:	74 16                	je     801a53 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a3d:	89 f8                	mov    %edi,%eax
+  801a3f:	84 c0                	test   %al,%al
+  801a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a46:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a49:	89 d8                	mov    %ebx,%eax
+  801a4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4e:	5b                   	pop    %ebx
+  801a4f:	5e                   	pop    %esi
+  801a50:	5f                   	pop    %edi
+  801a51:	5d                   	pop    %ebp
+  801a52:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a53:	83 ec 08             	sub    $0x8,%esp
+  801a56:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a59:	50                   	push   %eax
+  801a5a:	ff 36                	push   (%esi)
+  801a5c:	e8 39 ff ff ff       	call   80199a <dev_lookup>
+  801a61:	89 c3                	mov    %eax,%ebx
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 1a                	js     801a84 <fd_close+0x77>
+		if (dev->dev_close)
+  801a6a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a6d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a70:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a75:	85 c0                	test   %eax,%eax
+  801a77:	74 0b                	je     801a84 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a79:	83 ec 0c             	sub    $0xc,%esp
+  801a7c:	56                   	push   %esi
+  801a7d:	ff d0                	call   *%eax
+  801a7f:	89 c3                	mov    %eax,%ebx
+  801a81:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a84:	83 ec 08             	sub    $0x8,%esp
+  801a87:	56                   	push   %esi
+  801a88:	6a 00                	push   $0x0
+  801a8a:	e8 a3 f4 ff ff       	call   800f32 <sys_page_unmap>
+	return r;
+  801a8f:	83 c4 10             	add    $0x10,%esp
+  801a92:	eb b5                	jmp    801a49 <fd_close+0x3c>
+
+00801a94 <close>:
+
+int
+close(int fdnum)
+{
+  801a94:	55                   	push   %ebp
+  801a95:	89 e5                	mov    %esp,%ebp
+  801a97:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a9d:	50                   	push   %eax
+  801a9e:	ff 75 08             	push   0x8(%ebp)
+  801aa1:	e8 a4 fe ff ff       	call   80194a <fd_lookup>
+  801aa6:	83 c4 10             	add    $0x10,%esp
+  801aa9:	85 c0                	test   %eax,%eax
+  801aab:	79 02                	jns    801aaf <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801aad:	c9                   	leave
+  801aae:	c3                   	ret
+		return fd_close(fd, 1);
+  801aaf:	83 ec 08             	sub    $0x8,%esp
+  801ab2:	6a 01                	push   $0x1
+  801ab4:	ff 75 f4             	push   -0xc(%ebp)
+  801ab7:	e8 51 ff ff ff       	call   801a0d <fd_close>
+  801abc:	83 c4 10             	add    $0x10,%esp
+  801abf:	eb ec                	jmp    801aad <close+0x19>
+
+00801ac1 <close_all>:
+
+void
+close_all(void)
+{
+  801ac1:	55                   	push   %ebp
+  801ac2:	89 e5                	mov    %esp,%ebp
+  801ac4:	53                   	push   %ebx
+  801ac5:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801ac8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801acd:	83 ec 0c             	sub    $0xc,%esp
+  801ad0:	53                   	push   %ebx
+  801ad1:	e8 be ff ff ff       	call   801a94 <close>
+	for (i = 0; i < MAXFD; i++)
+  801ad6:	83 c3 01             	add    $0x1,%ebx
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	83 fb 20             	cmp    $0x20,%ebx
+  801adf:	75 ec                	jne    801acd <close_all+0xc>
+}
+  801ae1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae4:	c9                   	leave
+  801ae5:	c3                   	ret
+
+00801ae6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	57                   	push   %edi
+  801aea:	56                   	push   %esi
+  801aeb:	53                   	push   %ebx
+  801aec:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801aef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801af2:	50                   	push   %eax
+  801af3:	ff 75 08             	push   0x8(%ebp)
+  801af6:	e8 4f fe ff ff       	call   80194a <fd_lookup>
+  801afb:	89 c3                	mov    %eax,%ebx
+  801afd:	83 c4 10             	add    $0x10,%esp
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	78 7f                	js     801b83 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b04:	83 ec 0c             	sub    $0xc,%esp
+  801b07:	ff 75 0c             	push   0xc(%ebp)
+  801b0a:	e8 85 ff ff ff       	call   801a94 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b0f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b12:	c1 e6 0c             	shl    $0xc,%esi
+  801b15:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b1b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b1e:	89 3c 24             	mov    %edi,(%esp)
+  801b21:	e8 b7 fd ff ff       	call   8018dd <fd2data>
+  801b26:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b28:	89 34 24             	mov    %esi,(%esp)
+  801b2b:	e8 ad fd ff ff       	call   8018dd <fd2data>
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b36:	89 d8                	mov    %ebx,%eax
+  801b38:	c1 e8 16             	shr    $0x16,%eax
+  801b3b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b42:	a8 01                	test   $0x1,%al
+  801b44:	74 11                	je     801b57 <dup+0x71>
+  801b46:	89 d8                	mov    %ebx,%eax
+  801b48:	c1 e8 0c             	shr    $0xc,%eax
+  801b4b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b52:	f6 c2 01             	test   $0x1,%dl
+  801b55:	75 36                	jne    801b8d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b57:	89 f8                	mov    %edi,%eax
+  801b59:	c1 e8 0c             	shr    $0xc,%eax
+  801b5c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b63:	83 ec 0c             	sub    $0xc,%esp
+  801b66:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b6b:	50                   	push   %eax
+  801b6c:	56                   	push   %esi
+  801b6d:	6a 00                	push   $0x0
+  801b6f:	57                   	push   %edi
+  801b70:	6a 00                	push   $0x0
+  801b72:	e8 4d f3 ff ff       	call   800ec4 <sys_page_map>
+  801b77:	89 c3                	mov    %eax,%ebx
+  801b79:	83 c4 20             	add    $0x20,%esp
+  801b7c:	85 c0                	test   %eax,%eax
+  801b7e:	78 33                	js     801bb3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b83:	89 d8                	mov    %ebx,%eax
+  801b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b88:	5b                   	pop    %ebx
+  801b89:	5e                   	pop    %esi
+  801b8a:	5f                   	pop    %edi
+  801b8b:	5d                   	pop    %ebp
+  801b8c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b8d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b94:	83 ec 0c             	sub    $0xc,%esp
+  801b97:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b9c:	50                   	push   %eax
+  801b9d:	ff 75 d4             	push   -0x2c(%ebp)
+  801ba0:	6a 00                	push   $0x0
+  801ba2:	53                   	push   %ebx
+  801ba3:	6a 00                	push   $0x0
+  801ba5:	e8 1a f3 ff ff       	call   800ec4 <sys_page_map>
+  801baa:	89 c3                	mov    %eax,%ebx
+  801bac:	83 c4 20             	add    $0x20,%esp
+  801baf:	85 c0                	test   %eax,%eax
+  801bb1:	79 a4                	jns    801b57 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bb3:	83 ec 08             	sub    $0x8,%esp
+  801bb6:	56                   	push   %esi
+  801bb7:	6a 00                	push   $0x0
+  801bb9:	e8 74 f3 ff ff       	call   800f32 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801bbe:	83 c4 08             	add    $0x8,%esp
+  801bc1:	ff 75 d4             	push   -0x2c(%ebp)
+  801bc4:	6a 00                	push   $0x0
+  801bc6:	e8 67 f3 ff ff       	call   800f32 <sys_page_unmap>
+	return r;
+  801bcb:	83 c4 10             	add    $0x10,%esp
+  801bce:	eb b3                	jmp    801b83 <dup+0x9d>
+
+00801bd0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801bd0:	55                   	push   %ebp
+  801bd1:	89 e5                	mov    %esp,%ebp
+  801bd3:	56                   	push   %esi
+  801bd4:	53                   	push   %ebx
+  801bd5:	83 ec 18             	sub    $0x18,%esp
+  801bd8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bdb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bde:	50                   	push   %eax
+  801bdf:	53                   	push   %ebx
+  801be0:	e8 65 fd ff ff       	call   80194a <fd_lookup>
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	78 3c                	js     801c28 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bef:	83 ec 08             	sub    $0x8,%esp
+  801bf2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bf5:	50                   	push   %eax
+  801bf6:	ff 36                	push   (%esi)
+  801bf8:	e8 9d fd ff ff       	call   80199a <dev_lookup>
+  801bfd:	83 c4 10             	add    $0x10,%esp
+  801c00:	85 c0                	test   %eax,%eax
+  801c02:	78 24                	js     801c28 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c04:	8b 46 08             	mov    0x8(%esi),%eax
+  801c07:	83 e0 03             	and    $0x3,%eax
+  801c0a:	83 f8 01             	cmp    $0x1,%eax
+  801c0d:	74 20                	je     801c2f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c12:	8b 40 08             	mov    0x8(%eax),%eax
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	74 57                	je     801c70 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c19:	83 ec 04             	sub    $0x4,%esp
+  801c1c:	ff 75 10             	push   0x10(%ebp)
+  801c1f:	ff 75 0c             	push   0xc(%ebp)
+  801c22:	56                   	push   %esi
+  801c23:	ff d0                	call   *%eax
+  801c25:	83 c4 10             	add    $0x10,%esp
+}
+  801c28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c2b:	5b                   	pop    %ebx
+  801c2c:	5e                   	pop    %esi
+  801c2d:	5d                   	pop    %ebp
+  801c2e:	c3                   	ret
+  801c2f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c31:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c36:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c3c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c41:	76 1c                	jbe    801c5f <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c43:	8b 42 48             	mov    0x48(%edx),%eax
+  801c46:	83 ec 04             	sub    $0x4,%esp
+  801c49:	53                   	push   %ebx
+  801c4a:	50                   	push   %eax
+  801c4b:	68 d9 31 80 00       	push   $0x8031d9
+  801c50:	e8 c2 e6 ff ff       	call   800317 <cprintf>
+		return -E_INVAL;
+  801c55:	83 c4 10             	add    $0x10,%esp
+  801c58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c5d:	eb c9                	jmp    801c28 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c5f:	c1 e8 10             	shr    $0x10,%eax
+  801c62:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c68:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c6e:	eb d3                	jmp    801c43 <read+0x73>
+		return -E_NOT_SUPP;
+  801c70:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c75:	eb b1                	jmp    801c28 <read+0x58>
+
+00801c77 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c77:	55                   	push   %ebp
+  801c78:	89 e5                	mov    %esp,%ebp
+  801c7a:	57                   	push   %edi
+  801c7b:	56                   	push   %esi
+  801c7c:	53                   	push   %ebx
+  801c7d:	83 ec 0c             	sub    $0xc,%esp
+  801c80:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c83:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8b:	eb 02                	jmp    801c8f <readn+0x18>
+  801c8d:	01 c3                	add    %eax,%ebx
+  801c8f:	39 f3                	cmp    %esi,%ebx
+  801c91:	73 21                	jae    801cb4 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c93:	83 ec 04             	sub    $0x4,%esp
+  801c96:	89 f0                	mov    %esi,%eax
+  801c98:	29 d8                	sub    %ebx,%eax
+  801c9a:	50                   	push   %eax
+  801c9b:	89 d8                	mov    %ebx,%eax
+  801c9d:	03 45 0c             	add    0xc(%ebp),%eax
+  801ca0:	50                   	push   %eax
+  801ca1:	57                   	push   %edi
+  801ca2:	e8 29 ff ff ff       	call   801bd0 <read>
+		if (m < 0)
+  801ca7:	83 c4 10             	add    $0x10,%esp
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	78 04                	js     801cb2 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801cae:	75 dd                	jne    801c8d <readn+0x16>
+  801cb0:	eb 02                	jmp    801cb4 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cb2:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801cb4:	89 d8                	mov    %ebx,%eax
+  801cb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cb9:	5b                   	pop    %ebx
+  801cba:	5e                   	pop    %esi
+  801cbb:	5f                   	pop    %edi
+  801cbc:	5d                   	pop    %ebp
+  801cbd:	c3                   	ret
+
+00801cbe <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	56                   	push   %esi
+  801cc2:	53                   	push   %ebx
+  801cc3:	83 ec 18             	sub    $0x18,%esp
+  801cc6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cc9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ccc:	50                   	push   %eax
+  801ccd:	53                   	push   %ebx
+  801cce:	e8 77 fc ff ff       	call   80194a <fd_lookup>
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 37                	js     801d11 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cda:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cdd:	83 ec 08             	sub    $0x8,%esp
+  801ce0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce3:	50                   	push   %eax
+  801ce4:	ff 36                	push   (%esi)
+  801ce6:	e8 af fc ff ff       	call   80199a <dev_lookup>
+  801ceb:	83 c4 10             	add    $0x10,%esp
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	78 1f                	js     801d11 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cf2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cf6:	74 20                	je     801d18 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cf8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cfb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cfe:	85 c0                	test   %eax,%eax
+  801d00:	74 57                	je     801d59 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d02:	83 ec 04             	sub    $0x4,%esp
+  801d05:	ff 75 10             	push   0x10(%ebp)
+  801d08:	ff 75 0c             	push   0xc(%ebp)
+  801d0b:	56                   	push   %esi
+  801d0c:	ff d0                	call   *%eax
+  801d0e:	83 c4 10             	add    $0x10,%esp
+}
+  801d11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d14:	5b                   	pop    %ebx
+  801d15:	5e                   	pop    %esi
+  801d16:	5d                   	pop    %ebp
+  801d17:	c3                   	ret
+  801d18:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d1a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d1f:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d25:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d2a:	76 1c                	jbe    801d48 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d2c:	8b 42 48             	mov    0x48(%edx),%eax
+  801d2f:	83 ec 04             	sub    $0x4,%esp
+  801d32:	53                   	push   %ebx
+  801d33:	50                   	push   %eax
+  801d34:	68 f5 31 80 00       	push   $0x8031f5
+  801d39:	e8 d9 e5 ff ff       	call   800317 <cprintf>
+		return -E_INVAL;
+  801d3e:	83 c4 10             	add    $0x10,%esp
+  801d41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d46:	eb c9                	jmp    801d11 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d48:	c1 e8 10             	shr    $0x10,%eax
+  801d4b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d51:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d57:	eb d3                	jmp    801d2c <write+0x6e>
+		return -E_NOT_SUPP;
+  801d59:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d5e:	eb b1                	jmp    801d11 <write+0x53>
+
+00801d60 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d69:	50                   	push   %eax
+  801d6a:	ff 75 08             	push   0x8(%ebp)
+  801d6d:	e8 d8 fb ff ff       	call   80194a <fd_lookup>
+  801d72:	83 c4 10             	add    $0x10,%esp
+  801d75:	85 c0                	test   %eax,%eax
+  801d77:	78 0e                	js     801d87 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d79:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d7f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d87:	c9                   	leave
+  801d88:	c3                   	ret
+
+00801d89 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	56                   	push   %esi
+  801d8d:	53                   	push   %ebx
+  801d8e:	83 ec 18             	sub    $0x18,%esp
+  801d91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d94:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d97:	50                   	push   %eax
+  801d98:	53                   	push   %ebx
+  801d99:	e8 ac fb ff ff       	call   80194a <fd_lookup>
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	78 34                	js     801dd9 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801da5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801da8:	83 ec 08             	sub    $0x8,%esp
+  801dab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dae:	50                   	push   %eax
+  801daf:	ff 36                	push   (%esi)
+  801db1:	e8 e4 fb ff ff       	call   80199a <dev_lookup>
+  801db6:	83 c4 10             	add    $0x10,%esp
+  801db9:	85 c0                	test   %eax,%eax
+  801dbb:	78 1c                	js     801dd9 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dbd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dc1:	74 1d                	je     801de0 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801dc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc6:	8b 40 18             	mov    0x18(%eax),%eax
+  801dc9:	85 c0                	test   %eax,%eax
+  801dcb:	74 54                	je     801e21 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801dcd:	83 ec 08             	sub    $0x8,%esp
+  801dd0:	ff 75 0c             	push   0xc(%ebp)
+  801dd3:	56                   	push   %esi
+  801dd4:	ff d0                	call   *%eax
+  801dd6:	83 c4 10             	add    $0x10,%esp
+}
+  801dd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ddc:	5b                   	pop    %ebx
+  801ddd:	5e                   	pop    %esi
+  801dde:	5d                   	pop    %ebp
+  801ddf:	c3                   	ret
+  801de0:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801de2:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801de7:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ded:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801df2:	76 1c                	jbe    801e10 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801df4:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801df7:	83 ec 04             	sub    $0x4,%esp
+  801dfa:	53                   	push   %ebx
+  801dfb:	50                   	push   %eax
+  801dfc:	68 b8 31 80 00       	push   $0x8031b8
+  801e01:	e8 11 e5 ff ff       	call   800317 <cprintf>
+		return -E_INVAL;
+  801e06:	83 c4 10             	add    $0x10,%esp
+  801e09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e0e:	eb c9                	jmp    801dd9 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e10:	c1 e8 10             	shr    $0x10,%eax
+  801e13:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e19:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e1f:	eb d3                	jmp    801df4 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801e21:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e26:	eb b1                	jmp    801dd9 <ftruncate+0x50>
+
+00801e28 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e28:	55                   	push   %ebp
+  801e29:	89 e5                	mov    %esp,%ebp
+  801e2b:	56                   	push   %esi
+  801e2c:	53                   	push   %ebx
+  801e2d:	83 ec 18             	sub    $0x18,%esp
+  801e30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e33:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e36:	50                   	push   %eax
+  801e37:	ff 75 08             	push   0x8(%ebp)
+  801e3a:	e8 0b fb ff ff       	call   80194a <fd_lookup>
+  801e3f:	83 c4 10             	add    $0x10,%esp
+  801e42:	85 c0                	test   %eax,%eax
+  801e44:	78 49                	js     801e8f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e46:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e49:	83 ec 08             	sub    $0x8,%esp
+  801e4c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e4f:	50                   	push   %eax
+  801e50:	ff 36                	push   (%esi)
+  801e52:	e8 43 fb ff ff       	call   80199a <dev_lookup>
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	85 c0                	test   %eax,%eax
+  801e5c:	78 31                	js     801e8f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e61:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e65:	74 2f                	je     801e96 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e67:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e6a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e71:	00 00 00 
+	stat->st_isdir = 0;
+  801e74:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e7b:	00 00 00 
+	stat->st_dev = dev;
+  801e7e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	53                   	push   %ebx
+  801e88:	56                   	push   %esi
+  801e89:	ff 50 14             	call   *0x14(%eax)
+  801e8c:	83 c4 10             	add    $0x10,%esp
+}
+  801e8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e92:	5b                   	pop    %ebx
+  801e93:	5e                   	pop    %esi
+  801e94:	5d                   	pop    %ebp
+  801e95:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e96:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e9b:	eb f2                	jmp    801e8f <fstat+0x67>
+
+00801e9d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e9d:	55                   	push   %ebp
+  801e9e:	89 e5                	mov    %esp,%ebp
+  801ea0:	56                   	push   %esi
+  801ea1:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801ea2:	83 ec 08             	sub    $0x8,%esp
+  801ea5:	6a 00                	push   $0x0
+  801ea7:	ff 75 08             	push   0x8(%ebp)
+  801eaa:	e8 e4 01 00 00       	call   802093 <open>
+  801eaf:	89 c3                	mov    %eax,%ebx
+  801eb1:	83 c4 10             	add    $0x10,%esp
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	78 1b                	js     801ed3 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801eb8:	83 ec 08             	sub    $0x8,%esp
+  801ebb:	ff 75 0c             	push   0xc(%ebp)
+  801ebe:	50                   	push   %eax
+  801ebf:	e8 64 ff ff ff       	call   801e28 <fstat>
+  801ec4:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ec6:	89 1c 24             	mov    %ebx,(%esp)
+  801ec9:	e8 c6 fb ff ff       	call   801a94 <close>
+	return r;
+  801ece:	83 c4 10             	add    $0x10,%esp
+  801ed1:	89 f3                	mov    %esi,%ebx
+}
+  801ed3:	89 d8                	mov    %ebx,%eax
+  801ed5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed8:	5b                   	pop    %ebx
+  801ed9:	5e                   	pop    %esi
+  801eda:	5d                   	pop    %ebp
+  801edb:	c3                   	ret
+
+00801edc <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801edc:	55                   	push   %ebp
+  801edd:	89 e5                	mov    %esp,%ebp
+  801edf:	56                   	push   %esi
+  801ee0:	53                   	push   %ebx
+  801ee1:	89 c6                	mov    %eax,%esi
+  801ee3:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ee5:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801eec:	74 27                	je     801f15 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801eee:	6a 07                	push   $0x7
+  801ef0:	68 00 60 80 00       	push   $0x806000
+  801ef5:	56                   	push   %esi
+  801ef6:	ff 35 00 50 80 00    	push   0x805000
+  801efc:	e8 c6 0d 00 00       	call   802cc7 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801f01:	83 c4 0c             	add    $0xc,%esp
+  801f04:	6a 00                	push   $0x0
+  801f06:	53                   	push   %ebx
+  801f07:	6a 00                	push   $0x0
+  801f09:	e8 a1 0d 00 00       	call   802caf <ipc_recv>
+}
+  801f0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f11:	5b                   	pop    %ebx
+  801f12:	5e                   	pop    %esi
+  801f13:	5d                   	pop    %ebp
+  801f14:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f15:	83 ec 0c             	sub    $0xc,%esp
+  801f18:	6a 01                	push   $0x1
+  801f1a:	e8 fc 0d 00 00       	call   802d1b <ipc_find_env>
+  801f1f:	a3 00 50 80 00       	mov    %eax,0x805000
+  801f24:	83 c4 10             	add    $0x10,%esp
+  801f27:	eb c5                	jmp    801eee <fsipc+0x12>
+
+00801f29 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f32:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f35:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801f3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f3d:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f47:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f4c:	e8 8b ff ff ff       	call   801edc <fsipc>
+}
+  801f51:	c9                   	leave
+  801f52:	c3                   	ret
+
+00801f53 <devfile_flush>:
+{
+  801f53:	55                   	push   %ebp
+  801f54:	89 e5                	mov    %esp,%ebp
+  801f56:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f5f:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f69:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f6e:	e8 69 ff ff ff       	call   801edc <fsipc>
+}
+  801f73:	c9                   	leave
+  801f74:	c3                   	ret
+
+00801f75 <devfile_stat>:
+{
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	53                   	push   %ebx
+  801f79:	83 ec 04             	sub    $0x4,%esp
+  801f7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f82:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f85:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f94:	e8 43 ff ff ff       	call   801edc <fsipc>
+  801f99:	85 c0                	test   %eax,%eax
+  801f9b:	78 2c                	js     801fc9 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f9d:	83 ec 08             	sub    $0x8,%esp
+  801fa0:	68 00 60 80 00       	push   $0x806000
+  801fa5:	53                   	push   %ebx
+  801fa6:	e8 b4 e9 ff ff       	call   80095f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801fab:	a1 80 60 80 00       	mov    0x806080,%eax
+  801fb0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fb6:	a1 84 60 80 00       	mov    0x806084,%eax
+  801fbb:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801fc1:	83 c4 10             	add    $0x10,%esp
+  801fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcc:	c9                   	leave
+  801fcd:	c3                   	ret
+
+00801fce <devfile_write>:
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	83 ec 0c             	sub    $0xc,%esp
+  801fd4:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fda:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fdd:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801fe3:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801fe8:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fed:	39 d0                	cmp    %edx,%eax
+  801fef:	0f 47 c2             	cmova  %edx,%eax
+  801ff2:	50                   	push   %eax
+  801ff3:	ff 75 0c             	push   0xc(%ebp)
+  801ff6:	68 08 60 80 00       	push   $0x806008
+  801ffb:	e8 e5 ea ff ff       	call   800ae5 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802000:	ba 00 00 00 00       	mov    $0x0,%edx
+  802005:	b8 04 00 00 00       	mov    $0x4,%eax
+  80200a:	e8 cd fe ff ff       	call   801edc <fsipc>
+}
+  80200f:	c9                   	leave
+  802010:	c3                   	ret
+
+00802011 <devfile_read>:
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	56                   	push   %esi
+  802015:	53                   	push   %ebx
+  802016:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802019:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80201f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802024:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80202a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80202f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802034:	e8 a3 fe ff ff       	call   801edc <fsipc>
+  802039:	89 c3                	mov    %eax,%ebx
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 1f                	js     80205e <devfile_read+0x4d>
+	assert(r <= n);
+  80203f:	39 c6                	cmp    %eax,%esi
+  802041:	72 24                	jb     802067 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802043:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802048:	7f 33                	jg     80207d <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80204a:	83 ec 04             	sub    $0x4,%esp
+  80204d:	50                   	push   %eax
+  80204e:	68 00 60 80 00       	push   $0x806000
+  802053:	ff 75 0c             	push   0xc(%ebp)
+  802056:	e8 8a ea ff ff       	call   800ae5 <memmove>
+	return r;
+  80205b:	83 c4 10             	add    $0x10,%esp
+}
+  80205e:	89 d8                	mov    %ebx,%eax
+  802060:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802063:	5b                   	pop    %ebx
+  802064:	5e                   	pop    %esi
+  802065:	5d                   	pop    %ebp
+  802066:	c3                   	ret
+	assert(r <= n);
+  802067:	68 28 32 80 00       	push   $0x803228
+  80206c:	68 2f 32 80 00       	push   $0x80322f
+  802071:	6a 76                	push   $0x76
+  802073:	68 44 32 80 00       	push   $0x803244
+  802078:	e8 bf e1 ff ff       	call   80023c <_panic>
+	assert(r <= PGSIZE);
+  80207d:	68 4f 32 80 00       	push   $0x80324f
+  802082:	68 2f 32 80 00       	push   $0x80322f
+  802087:	6a 77                	push   $0x77
+  802089:	68 44 32 80 00       	push   $0x803244
+  80208e:	e8 a9 e1 ff ff       	call   80023c <_panic>
+
+00802093 <open>:
+{
+  802093:	55                   	push   %ebp
+  802094:	89 e5                	mov    %esp,%ebp
+  802096:	56                   	push   %esi
+  802097:	53                   	push   %ebx
+  802098:	83 ec 1c             	sub    $0x1c,%esp
+  80209b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80209e:	56                   	push   %esi
+  80209f:	e8 80 e8 ff ff       	call   800924 <strlen>
+  8020a4:	83 c4 10             	add    $0x10,%esp
+  8020a7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020ac:	7f 6c                	jg     80211a <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8020ae:	83 ec 0c             	sub    $0xc,%esp
+  8020b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020b4:	50                   	push   %eax
+  8020b5:	e8 3a f8 ff ff       	call   8018f4 <fd_alloc>
+  8020ba:	89 c3                	mov    %eax,%ebx
+  8020bc:	83 c4 10             	add    $0x10,%esp
+  8020bf:	85 c0                	test   %eax,%eax
+  8020c1:	78 3c                	js     8020ff <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8020c3:	83 ec 08             	sub    $0x8,%esp
+  8020c6:	56                   	push   %esi
+  8020c7:	68 00 60 80 00       	push   $0x806000
+  8020cc:	e8 8e e8 ff ff       	call   80095f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020d4:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020d9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020e1:	e8 f6 fd ff ff       	call   801edc <fsipc>
+  8020e6:	89 c3                	mov    %eax,%ebx
+  8020e8:	83 c4 10             	add    $0x10,%esp
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 19                	js     802108 <open+0x75>
+	return fd2num(fd);
+  8020ef:	83 ec 0c             	sub    $0xc,%esp
+  8020f2:	ff 75 f4             	push   -0xc(%ebp)
+  8020f5:	e8 d3 f7 ff ff       	call   8018cd <fd2num>
+  8020fa:	89 c3                	mov    %eax,%ebx
+  8020fc:	83 c4 10             	add    $0x10,%esp
+}
+  8020ff:	89 d8                	mov    %ebx,%eax
+  802101:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802104:	5b                   	pop    %ebx
+  802105:	5e                   	pop    %esi
+  802106:	5d                   	pop    %ebp
+  802107:	c3                   	ret
+		fd_close(fd, 0);
+  802108:	83 ec 08             	sub    $0x8,%esp
+  80210b:	6a 00                	push   $0x0
+  80210d:	ff 75 f4             	push   -0xc(%ebp)
+  802110:	e8 f8 f8 ff ff       	call   801a0d <fd_close>
+		return r;
+  802115:	83 c4 10             	add    $0x10,%esp
+  802118:	eb e5                	jmp    8020ff <open+0x6c>
+		return -E_BAD_PATH;
+  80211a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80211f:	eb de                	jmp    8020ff <open+0x6c>
+
+00802121 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802121:	55                   	push   %ebp
+  802122:	89 e5                	mov    %esp,%ebp
+  802124:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802127:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802131:	e8 a6 fd ff ff       	call   801edc <fsipc>
+}
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+
+00802138 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802138:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80213c:	7f 01                	jg     80213f <writebuf+0x7>
+  80213e:	c3                   	ret
+{
+  80213f:	55                   	push   %ebp
+  802140:	89 e5                	mov    %esp,%ebp
+  802142:	53                   	push   %ebx
+  802143:	83 ec 08             	sub    $0x8,%esp
+  802146:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802148:	ff 70 04             	push   0x4(%eax)
+  80214b:	8d 40 10             	lea    0x10(%eax),%eax
+  80214e:	50                   	push   %eax
+  80214f:	ff 33                	push   (%ebx)
+  802151:	e8 68 fb ff ff       	call   801cbe <write>
+		if (result > 0)
+  802156:	83 c4 10             	add    $0x10,%esp
+  802159:	85 c0                	test   %eax,%eax
+  80215b:	7e 03                	jle    802160 <writebuf+0x28>
+			b->result += result;
+  80215d:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802160:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802163:	74 0d                	je     802172 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802165:	85 c0                	test   %eax,%eax
+  802167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216c:	0f 4f c2             	cmovg  %edx,%eax
+  80216f:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802172:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802175:	c9                   	leave
+  802176:	c3                   	ret
+
+00802177 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802177:	55                   	push   %ebp
+  802178:	89 e5                	mov    %esp,%ebp
+  80217a:	53                   	push   %ebx
+  80217b:	83 ec 04             	sub    $0x4,%esp
+  80217e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802181:	8b 53 04             	mov    0x4(%ebx),%edx
+  802184:	8d 42 01             	lea    0x1(%edx),%eax
+  802187:	89 43 04             	mov    %eax,0x4(%ebx)
+  80218a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80218d:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802191:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802196:	74 05                	je     80219d <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  802198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219b:	c9                   	leave
+  80219c:	c3                   	ret
+		writebuf(b);
+  80219d:	89 d8                	mov    %ebx,%eax
+  80219f:	e8 94 ff ff ff       	call   802138 <writebuf>
+		b->idx = 0;
+  8021a4:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8021ab:	eb eb                	jmp    802198 <putch+0x21>
+
+008021ad <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8021ad:	55                   	push   %ebp
+  8021ae:	89 e5                	mov    %esp,%ebp
+  8021b0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  8021b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b9:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8021bf:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8021c6:	00 00 00 
+	b.result = 0;
+  8021c9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8021d0:	00 00 00 
+	b.error = 1;
+  8021d3:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8021da:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8021dd:	ff 75 10             	push   0x10(%ebp)
+  8021e0:	ff 75 0c             	push   0xc(%ebp)
+  8021e3:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8021e9:	50                   	push   %eax
+  8021ea:	68 77 21 80 00       	push   $0x802177
+  8021ef:	e8 01 e2 ff ff       	call   8003f5 <vprintfmt>
+	if (b.idx > 0)
+  8021f4:	83 c4 10             	add    $0x10,%esp
+  8021f7:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8021fe:	7f 12                	jg     802212 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802200:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802206:	85 c0                	test   %eax,%eax
+  802208:	75 06                	jne    802210 <vfprintf+0x63>
+  80220a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+		writebuf(&b);
+  802212:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802218:	e8 1b ff ff ff       	call   802138 <writebuf>
+  80221d:	eb e1                	jmp    802200 <vfprintf+0x53>
+
+0080221f <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802225:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802228:	50                   	push   %eax
+  802229:	ff 75 0c             	push   0xc(%ebp)
+  80222c:	ff 75 08             	push   0x8(%ebp)
+  80222f:	e8 79 ff ff ff       	call   8021ad <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802234:	c9                   	leave
+  802235:	c3                   	ret
+
+00802236 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80223c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  80223f:	50                   	push   %eax
+  802240:	ff 75 08             	push   0x8(%ebp)
+  802243:	6a 01                	push   $0x1
+  802245:	e8 63 ff ff ff       	call   8021ad <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80224a:	c9                   	leave
+  80224b:	c3                   	ret
+
+0080224c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802252:	68 5b 32 80 00       	push   $0x80325b
+  802257:	ff 75 0c             	push   0xc(%ebp)
+  80225a:	e8 00 e7 ff ff       	call   80095f <strcpy>
+	return 0;
+}
+  80225f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802264:	c9                   	leave
+  802265:	c3                   	ret
+
+00802266 <devsock_close>:
+{
+  802266:	55                   	push   %ebp
+  802267:	89 e5                	mov    %esp,%ebp
+  802269:	53                   	push   %ebx
+  80226a:	83 ec 10             	sub    $0x10,%esp
+  80226d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802270:	53                   	push   %ebx
+  802271:	e8 e4 0a 00 00       	call   802d5a <pageref>
+  802276:	89 c2                	mov    %eax,%edx
+  802278:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80227b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802280:	83 fa 01             	cmp    $0x1,%edx
+  802283:	74 05                	je     80228a <devsock_close+0x24>
+}
+  802285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802288:	c9                   	leave
+  802289:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80228a:	83 ec 0c             	sub    $0xc,%esp
+  80228d:	ff 73 0c             	push   0xc(%ebx)
+  802290:	e8 b7 02 00 00       	call   80254c <nsipc_close>
+  802295:	83 c4 10             	add    $0x10,%esp
+  802298:	eb eb                	jmp    802285 <devsock_close+0x1f>
+
+0080229a <devsock_write>:
+{
+  80229a:	55                   	push   %ebp
+  80229b:	89 e5                	mov    %esp,%ebp
+  80229d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8022a0:	6a 00                	push   $0x0
+  8022a2:	ff 75 10             	push   0x10(%ebp)
+  8022a5:	ff 75 0c             	push   0xc(%ebp)
+  8022a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ab:	ff 70 0c             	push   0xc(%eax)
+  8022ae:	e8 79 03 00 00       	call   80262c <nsipc_send>
+}
+  8022b3:	c9                   	leave
+  8022b4:	c3                   	ret
+
+008022b5 <devsock_read>:
+{
+  8022b5:	55                   	push   %ebp
+  8022b6:	89 e5                	mov    %esp,%ebp
+  8022b8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8022bb:	6a 00                	push   $0x0
+  8022bd:	ff 75 10             	push   0x10(%ebp)
+  8022c0:	ff 75 0c             	push   0xc(%ebp)
+  8022c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c6:	ff 70 0c             	push   0xc(%eax)
+  8022c9:	e8 ef 02 00 00       	call   8025bd <nsipc_recv>
+}
+  8022ce:	c9                   	leave
+  8022cf:	c3                   	ret
+
+008022d0 <fd2sockid>:
+{
+  8022d0:	55                   	push   %ebp
+  8022d1:	89 e5                	mov    %esp,%ebp
+  8022d3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8022d6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022d9:	52                   	push   %edx
+  8022da:	50                   	push   %eax
+  8022db:	e8 6a f6 ff ff       	call   80194a <fd_lookup>
+  8022e0:	83 c4 10             	add    $0x10,%esp
+  8022e3:	85 c0                	test   %eax,%eax
+  8022e5:	78 10                	js     8022f7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8022e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ea:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022f0:	39 08                	cmp    %ecx,(%eax)
+  8022f2:	75 05                	jne    8022f9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8022f4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8022f7:	c9                   	leave
+  8022f8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022f9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022fe:	eb f7                	jmp    8022f7 <fd2sockid+0x27>
+
+00802300 <alloc_sockfd>:
+{
+  802300:	55                   	push   %ebp
+  802301:	89 e5                	mov    %esp,%ebp
+  802303:	56                   	push   %esi
+  802304:	53                   	push   %ebx
+  802305:	83 ec 1c             	sub    $0x1c,%esp
+  802308:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80230a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80230d:	50                   	push   %eax
+  80230e:	e8 e1 f5 ff ff       	call   8018f4 <fd_alloc>
+  802313:	89 c3                	mov    %eax,%ebx
+  802315:	83 c4 10             	add    $0x10,%esp
+  802318:	85 c0                	test   %eax,%eax
+  80231a:	78 43                	js     80235f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80231c:	83 ec 04             	sub    $0x4,%esp
+  80231f:	68 07 04 00 00       	push   $0x407
+  802324:	ff 75 f4             	push   -0xc(%ebp)
+  802327:	6a 00                	push   $0x0
+  802329:	e8 29 eb ff ff       	call   800e57 <sys_page_alloc>
+  80232e:	89 c3                	mov    %eax,%ebx
+  802330:	83 c4 10             	add    $0x10,%esp
+  802333:	85 c0                	test   %eax,%eax
+  802335:	78 28                	js     80235f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802337:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80233a:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802340:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802342:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802345:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80234c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80234f:	83 ec 0c             	sub    $0xc,%esp
+  802352:	50                   	push   %eax
+  802353:	e8 75 f5 ff ff       	call   8018cd <fd2num>
+  802358:	89 c3                	mov    %eax,%ebx
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	eb 0c                	jmp    80236b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80235f:	83 ec 0c             	sub    $0xc,%esp
+  802362:	56                   	push   %esi
+  802363:	e8 e4 01 00 00       	call   80254c <nsipc_close>
+		return r;
+  802368:	83 c4 10             	add    $0x10,%esp
+}
+  80236b:	89 d8                	mov    %ebx,%eax
+  80236d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802370:	5b                   	pop    %ebx
+  802371:	5e                   	pop    %esi
+  802372:	5d                   	pop    %ebp
+  802373:	c3                   	ret
+
+00802374 <accept>:
+{
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80237a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237d:	e8 4e ff ff ff       	call   8022d0 <fd2sockid>
+  802382:	85 c0                	test   %eax,%eax
+  802384:	78 1b                	js     8023a1 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802386:	83 ec 04             	sub    $0x4,%esp
+  802389:	ff 75 10             	push   0x10(%ebp)
+  80238c:	ff 75 0c             	push   0xc(%ebp)
+  80238f:	50                   	push   %eax
+  802390:	e8 0e 01 00 00       	call   8024a3 <nsipc_accept>
+  802395:	83 c4 10             	add    $0x10,%esp
+  802398:	85 c0                	test   %eax,%eax
+  80239a:	78 05                	js     8023a1 <accept+0x2d>
+	return alloc_sockfd(r);
+  80239c:	e8 5f ff ff ff       	call   802300 <alloc_sockfd>
+}
+  8023a1:	c9                   	leave
+  8023a2:	c3                   	ret
+
+008023a3 <bind>:
+{
+  8023a3:	55                   	push   %ebp
+  8023a4:	89 e5                	mov    %esp,%ebp
+  8023a6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ac:	e8 1f ff ff ff       	call   8022d0 <fd2sockid>
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	78 12                	js     8023c7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8023b5:	83 ec 04             	sub    $0x4,%esp
+  8023b8:	ff 75 10             	push   0x10(%ebp)
+  8023bb:	ff 75 0c             	push   0xc(%ebp)
+  8023be:	50                   	push   %eax
+  8023bf:	e8 31 01 00 00       	call   8024f5 <nsipc_bind>
+  8023c4:	83 c4 10             	add    $0x10,%esp
+}
+  8023c7:	c9                   	leave
+  8023c8:	c3                   	ret
+
+008023c9 <shutdown>:
+{
+  8023c9:	55                   	push   %ebp
+  8023ca:	89 e5                	mov    %esp,%ebp
+  8023cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d2:	e8 f9 fe ff ff       	call   8022d0 <fd2sockid>
+  8023d7:	85 c0                	test   %eax,%eax
+  8023d9:	78 0f                	js     8023ea <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8023db:	83 ec 08             	sub    $0x8,%esp
+  8023de:	ff 75 0c             	push   0xc(%ebp)
+  8023e1:	50                   	push   %eax
+  8023e2:	e8 43 01 00 00       	call   80252a <nsipc_shutdown>
+  8023e7:	83 c4 10             	add    $0x10,%esp
+}
+  8023ea:	c9                   	leave
+  8023eb:	c3                   	ret
+
+008023ec <connect>:
+{
+  8023ec:	55                   	push   %ebp
+  8023ed:	89 e5                	mov    %esp,%ebp
+  8023ef:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f5:	e8 d6 fe ff ff       	call   8022d0 <fd2sockid>
+  8023fa:	85 c0                	test   %eax,%eax
+  8023fc:	78 12                	js     802410 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8023fe:	83 ec 04             	sub    $0x4,%esp
+  802401:	ff 75 10             	push   0x10(%ebp)
+  802404:	ff 75 0c             	push   0xc(%ebp)
+  802407:	50                   	push   %eax
+  802408:	e8 59 01 00 00       	call   802566 <nsipc_connect>
+  80240d:	83 c4 10             	add    $0x10,%esp
+}
+  802410:	c9                   	leave
+  802411:	c3                   	ret
+
+00802412 <listen>:
+{
+  802412:	55                   	push   %ebp
+  802413:	89 e5                	mov    %esp,%ebp
+  802415:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802418:	8b 45 08             	mov    0x8(%ebp),%eax
+  80241b:	e8 b0 fe ff ff       	call   8022d0 <fd2sockid>
+  802420:	85 c0                	test   %eax,%eax
+  802422:	78 0f                	js     802433 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802424:	83 ec 08             	sub    $0x8,%esp
+  802427:	ff 75 0c             	push   0xc(%ebp)
+  80242a:	50                   	push   %eax
+  80242b:	e8 6b 01 00 00       	call   80259b <nsipc_listen>
+  802430:	83 c4 10             	add    $0x10,%esp
+}
+  802433:	c9                   	leave
+  802434:	c3                   	ret
+
+00802435 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802435:	55                   	push   %ebp
+  802436:	89 e5                	mov    %esp,%ebp
+  802438:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80243b:	ff 75 10             	push   0x10(%ebp)
+  80243e:	ff 75 0c             	push   0xc(%ebp)
+  802441:	ff 75 08             	push   0x8(%ebp)
+  802444:	e8 41 02 00 00       	call   80268a <nsipc_socket>
+  802449:	83 c4 10             	add    $0x10,%esp
+  80244c:	85 c0                	test   %eax,%eax
+  80244e:	78 05                	js     802455 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802450:	e8 ab fe ff ff       	call   802300 <alloc_sockfd>
+}
+  802455:	c9                   	leave
+  802456:	c3                   	ret
+
+00802457 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	53                   	push   %ebx
+  80245b:	83 ec 04             	sub    $0x4,%esp
+  80245e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802460:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802467:	74 26                	je     80248f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802469:	6a 07                	push   $0x7
+  80246b:	68 00 70 80 00       	push   $0x807000
+  802470:	53                   	push   %ebx
+  802471:	ff 35 04 50 80 00    	push   0x805004
+  802477:	e8 4b 08 00 00       	call   802cc7 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80247c:	83 c4 0c             	add    $0xc,%esp
+  80247f:	6a 00                	push   $0x0
+  802481:	6a 00                	push   $0x0
+  802483:	6a 00                	push   $0x0
+  802485:	e8 25 08 00 00       	call   802caf <ipc_recv>
+}
+  80248a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80248d:	c9                   	leave
+  80248e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80248f:	83 ec 0c             	sub    $0xc,%esp
+  802492:	6a 02                	push   $0x2
+  802494:	e8 82 08 00 00       	call   802d1b <ipc_find_env>
+  802499:	a3 04 50 80 00       	mov    %eax,0x805004
+  80249e:	83 c4 10             	add    $0x10,%esp
+  8024a1:	eb c6                	jmp    802469 <nsipc+0x12>
+
+008024a3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8024a3:	55                   	push   %ebp
+  8024a4:	89 e5                	mov    %esp,%ebp
+  8024a6:	56                   	push   %esi
+  8024a7:	53                   	push   %ebx
+  8024a8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8024ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ae:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8024b3:	8b 06                	mov    (%esi),%eax
+  8024b5:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8024ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024bf:	e8 93 ff ff ff       	call   802457 <nsipc>
+  8024c4:	89 c3                	mov    %eax,%ebx
+  8024c6:	85 c0                	test   %eax,%eax
+  8024c8:	79 09                	jns    8024d3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8024ca:	89 d8                	mov    %ebx,%eax
+  8024cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024cf:	5b                   	pop    %ebx
+  8024d0:	5e                   	pop    %esi
+  8024d1:	5d                   	pop    %ebp
+  8024d2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8024d3:	83 ec 04             	sub    $0x4,%esp
+  8024d6:	ff 35 10 70 80 00    	push   0x807010
+  8024dc:	68 00 70 80 00       	push   $0x807000
+  8024e1:	ff 75 0c             	push   0xc(%ebp)
+  8024e4:	e8 fc e5 ff ff       	call   800ae5 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8024e9:	a1 10 70 80 00       	mov    0x807010,%eax
+  8024ee:	89 06                	mov    %eax,(%esi)
+  8024f0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8024f3:	eb d5                	jmp    8024ca <nsipc_accept+0x27>
+
+008024f5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8024f5:	55                   	push   %ebp
+  8024f6:	89 e5                	mov    %esp,%ebp
+  8024f8:	53                   	push   %ebx
+  8024f9:	83 ec 08             	sub    $0x8,%esp
+  8024fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8024ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802502:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802507:	53                   	push   %ebx
+  802508:	ff 75 0c             	push   0xc(%ebp)
+  80250b:	68 04 70 80 00       	push   $0x807004
+  802510:	e8 d0 e5 ff ff       	call   800ae5 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802515:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80251b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802520:	e8 32 ff ff ff       	call   802457 <nsipc>
+}
+  802525:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802528:	c9                   	leave
+  802529:	c3                   	ret
+
+0080252a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80252a:	55                   	push   %ebp
+  80252b:	89 e5                	mov    %esp,%ebp
+  80252d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802530:	8b 45 08             	mov    0x8(%ebp),%eax
+  802533:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802538:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80253b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802540:	b8 03 00 00 00       	mov    $0x3,%eax
+  802545:	e8 0d ff ff ff       	call   802457 <nsipc>
+}
+  80254a:	c9                   	leave
+  80254b:	c3                   	ret
+
+0080254c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80254c:	55                   	push   %ebp
+  80254d:	89 e5                	mov    %esp,%ebp
+  80254f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802552:	8b 45 08             	mov    0x8(%ebp),%eax
+  802555:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80255a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80255f:	e8 f3 fe ff ff       	call   802457 <nsipc>
+}
+  802564:	c9                   	leave
+  802565:	c3                   	ret
+
+00802566 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802566:	55                   	push   %ebp
+  802567:	89 e5                	mov    %esp,%ebp
+  802569:	53                   	push   %ebx
+  80256a:	83 ec 08             	sub    $0x8,%esp
+  80256d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802570:	8b 45 08             	mov    0x8(%ebp),%eax
+  802573:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802578:	53                   	push   %ebx
+  802579:	ff 75 0c             	push   0xc(%ebp)
+  80257c:	68 04 70 80 00       	push   $0x807004
+  802581:	e8 5f e5 ff ff       	call   800ae5 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802586:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80258c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802591:	e8 c1 fe ff ff       	call   802457 <nsipc>
+}
+  802596:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802599:	c9                   	leave
+  80259a:	c3                   	ret
+
+0080259b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80259b:	55                   	push   %ebp
+  80259c:	89 e5                	mov    %esp,%ebp
+  80259e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8025a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8025a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ac:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8025b1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025b6:	e8 9c fe ff ff       	call   802457 <nsipc>
+}
+  8025bb:	c9                   	leave
+  8025bc:	c3                   	ret
+
+008025bd <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8025bd:	55                   	push   %ebp
+  8025be:	89 e5                	mov    %esp,%ebp
+  8025c0:	56                   	push   %esi
+  8025c1:	53                   	push   %ebx
+  8025c2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8025c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8025cd:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8025d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025d6:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8025db:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025e0:	e8 72 fe ff ff       	call   802457 <nsipc>
+  8025e5:	89 c3                	mov    %eax,%ebx
+  8025e7:	85 c0                	test   %eax,%eax
+  8025e9:	78 22                	js     80260d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8025eb:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8025f0:	39 c6                	cmp    %eax,%esi
+  8025f2:	0f 4e c6             	cmovle %esi,%eax
+  8025f5:	39 c3                	cmp    %eax,%ebx
+  8025f7:	7f 1d                	jg     802616 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8025f9:	83 ec 04             	sub    $0x4,%esp
+  8025fc:	53                   	push   %ebx
+  8025fd:	68 00 70 80 00       	push   $0x807000
+  802602:	ff 75 0c             	push   0xc(%ebp)
+  802605:	e8 db e4 ff ff       	call   800ae5 <memmove>
+  80260a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80260d:	89 d8                	mov    %ebx,%eax
+  80260f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802612:	5b                   	pop    %ebx
+  802613:	5e                   	pop    %esi
+  802614:	5d                   	pop    %ebp
+  802615:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802616:	68 67 32 80 00       	push   $0x803267
+  80261b:	68 2f 32 80 00       	push   $0x80322f
+  802620:	6a 62                	push   $0x62
+  802622:	68 7c 32 80 00       	push   $0x80327c
+  802627:	e8 10 dc ff ff       	call   80023c <_panic>
+
+0080262c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80262c:	55                   	push   %ebp
+  80262d:	89 e5                	mov    %esp,%ebp
+  80262f:	53                   	push   %ebx
+  802630:	83 ec 04             	sub    $0x4,%esp
+  802633:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802636:	8b 45 08             	mov    0x8(%ebp),%eax
+  802639:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80263e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802644:	7f 2e                	jg     802674 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802646:	83 ec 04             	sub    $0x4,%esp
+  802649:	53                   	push   %ebx
+  80264a:	ff 75 0c             	push   0xc(%ebp)
+  80264d:	68 0c 70 80 00       	push   $0x80700c
+  802652:	e8 8e e4 ff ff       	call   800ae5 <memmove>
+	nsipcbuf.send.req_size = size;
+  802657:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80265d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802660:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802665:	b8 08 00 00 00       	mov    $0x8,%eax
+  80266a:	e8 e8 fd ff ff       	call   802457 <nsipc>
+}
+  80266f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802672:	c9                   	leave
+  802673:	c3                   	ret
+	assert(size < 1600);
+  802674:	68 88 32 80 00       	push   $0x803288
+  802679:	68 2f 32 80 00       	push   $0x80322f
+  80267e:	6a 6d                	push   $0x6d
+  802680:	68 7c 32 80 00       	push   $0x80327c
+  802685:	e8 b2 db ff ff       	call   80023c <_panic>
+
+0080268a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80268a:	55                   	push   %ebp
+  80268b:	89 e5                	mov    %esp,%ebp
+  80268d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802690:	8b 45 08             	mov    0x8(%ebp),%eax
+  802693:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802698:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80269b:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8026a0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8026a3:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8026a8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026ad:	e8 a5 fd ff ff       	call   802457 <nsipc>
+}
+  8026b2:	c9                   	leave
+  8026b3:	c3                   	ret
+
+008026b4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026b4:	55                   	push   %ebp
+  8026b5:	89 e5                	mov    %esp,%ebp
+  8026b7:	56                   	push   %esi
+  8026b8:	53                   	push   %ebx
+  8026b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8026bc:	83 ec 0c             	sub    $0xc,%esp
+  8026bf:	ff 75 08             	push   0x8(%ebp)
+  8026c2:	e8 16 f2 ff ff       	call   8018dd <fd2data>
+  8026c7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8026c9:	83 c4 08             	add    $0x8,%esp
+  8026cc:	68 94 32 80 00       	push   $0x803294
+  8026d1:	53                   	push   %ebx
+  8026d2:	e8 88 e2 ff ff       	call   80095f <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8026d7:	8b 46 04             	mov    0x4(%esi),%eax
+  8026da:	2b 06                	sub    (%esi),%eax
+  8026dc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8026e2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026e9:	00 00 00 
+	stat->st_dev = &devpipe;
+  8026ec:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8026f3:	40 80 00 
+	return 0;
+}
+  8026f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fe:	5b                   	pop    %ebx
+  8026ff:	5e                   	pop    %esi
+  802700:	5d                   	pop    %ebp
+  802701:	c3                   	ret
+
+00802702 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802702:	55                   	push   %ebp
+  802703:	89 e5                	mov    %esp,%ebp
+  802705:	53                   	push   %ebx
+  802706:	83 ec 0c             	sub    $0xc,%esp
+  802709:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80270c:	53                   	push   %ebx
+  80270d:	6a 00                	push   $0x0
+  80270f:	e8 1e e8 ff ff       	call   800f32 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802714:	89 1c 24             	mov    %ebx,(%esp)
+  802717:	e8 c1 f1 ff ff       	call   8018dd <fd2data>
+  80271c:	83 c4 08             	add    $0x8,%esp
+  80271f:	50                   	push   %eax
+  802720:	6a 00                	push   $0x0
+  802722:	e8 0b e8 ff ff       	call   800f32 <sys_page_unmap>
+}
+  802727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272a:	c9                   	leave
+  80272b:	c3                   	ret
+
+0080272c <_pipeisclosed>:
+{
+  80272c:	55                   	push   %ebp
+  80272d:	89 e5                	mov    %esp,%ebp
+  80272f:	57                   	push   %edi
+  802730:	56                   	push   %esi
+  802731:	53                   	push   %ebx
+  802732:	83 ec 1c             	sub    $0x1c,%esp
+  802735:	89 c7                	mov    %eax,%edi
+  802737:	89 d6                	mov    %edx,%esi
+  802739:	eb 3c                	jmp    802777 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  80273b:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  80273e:	83 ec 0c             	sub    $0xc,%esp
+  802741:	57                   	push   %edi
+  802742:	e8 13 06 00 00       	call   802d5a <pageref>
+  802747:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80274a:	89 34 24             	mov    %esi,(%esp)
+  80274d:	e8 08 06 00 00       	call   802d5a <pageref>
+  802752:	89 c2                	mov    %eax,%edx
+  802754:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802756:	05 00 00 00 20       	add    $0x20000000,%eax
+  80275b:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80275e:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802764:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802769:	76 31                	jbe    80279c <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  80276b:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80276e:	39 c3                	cmp    %eax,%ebx
+  802770:	74 76                	je     8027e8 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802772:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802775:	74 36                	je     8027ad <_pipeisclosed+0x81>
+  802777:	89 e0                	mov    %esp,%eax
+  802779:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80277e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802784:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802789:	77 b0                	ja     80273b <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80278b:	c1 e8 10             	shr    $0x10,%eax
+  80278e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802794:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80279a:	eb 9f                	jmp    80273b <_pipeisclosed+0xf>
+  80279c:	c1 e8 10             	shr    $0x10,%eax
+  80279f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027a5:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8027ab:	eb be                	jmp    80276b <_pipeisclosed+0x3f>
+  8027ad:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027af:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8027b4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027ba:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8027bf:	76 16                	jbe    8027d7 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027c1:	8b 42 58             	mov    0x58(%edx),%eax
+  8027c4:	6a 01                	push   $0x1
+  8027c6:	50                   	push   %eax
+  8027c7:	53                   	push   %ebx
+  8027c8:	68 9b 32 80 00       	push   $0x80329b
+  8027cd:	e8 45 db ff ff       	call   800317 <cprintf>
+  8027d2:	83 c4 10             	add    $0x10,%esp
+  8027d5:	eb a0                	jmp    802777 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8027d7:	c1 e8 10             	shr    $0x10,%eax
+  8027da:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027e0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8027e6:	eb d9                	jmp    8027c1 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8027e8:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8027eb:	0f 94 c0             	sete   %al
+  8027ee:	0f b6 c0             	movzbl %al,%eax
+}
+  8027f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f4:	5b                   	pop    %ebx
+  8027f5:	5e                   	pop    %esi
+  8027f6:	5f                   	pop    %edi
+  8027f7:	5d                   	pop    %ebp
+  8027f8:	c3                   	ret
+
+008027f9 <devpipe_write>:
+{
+  8027f9:	55                   	push   %ebp
+  8027fa:	89 e5                	mov    %esp,%ebp
+  8027fc:	57                   	push   %edi
+  8027fd:	56                   	push   %esi
+  8027fe:	53                   	push   %ebx
+  8027ff:	83 ec 28             	sub    $0x28,%esp
+  802802:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802805:	56                   	push   %esi
+  802806:	e8 d2 f0 ff ff       	call   8018dd <fd2data>
+  80280b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80280d:	83 c4 10             	add    $0x10,%esp
+  802810:	bf 00 00 00 00       	mov    $0x0,%edi
+  802815:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802818:	75 09                	jne    802823 <devpipe_write+0x2a>
+	return i;
+  80281a:	89 f8                	mov    %edi,%eax
+  80281c:	eb 23                	jmp    802841 <devpipe_write+0x48>
+			sys_yield();
+  80281e:	e8 ee e5 ff ff       	call   800e11 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802823:	8b 43 04             	mov    0x4(%ebx),%eax
+  802826:	8b 0b                	mov    (%ebx),%ecx
+  802828:	8d 51 20             	lea    0x20(%ecx),%edx
+  80282b:	39 d0                	cmp    %edx,%eax
+  80282d:	72 1a                	jb     802849 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80282f:	89 da                	mov    %ebx,%edx
+  802831:	89 f0                	mov    %esi,%eax
+  802833:	e8 f4 fe ff ff       	call   80272c <_pipeisclosed>
+  802838:	85 c0                	test   %eax,%eax
+  80283a:	74 e2                	je     80281e <devpipe_write+0x25>
+				return 0;
+  80283c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802841:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802844:	5b                   	pop    %ebx
+  802845:	5e                   	pop    %esi
+  802846:	5f                   	pop    %edi
+  802847:	5d                   	pop    %ebp
+  802848:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802849:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80284c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802850:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802853:	89 c2                	mov    %eax,%edx
+  802855:	c1 fa 1f             	sar    $0x1f,%edx
+  802858:	89 d1                	mov    %edx,%ecx
+  80285a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80285d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802860:	83 e2 1f             	and    $0x1f,%edx
+  802863:	29 ca                	sub    %ecx,%edx
+  802865:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802869:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80286d:	83 c0 01             	add    $0x1,%eax
+  802870:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802873:	83 c7 01             	add    $0x1,%edi
+  802876:	eb 9d                	jmp    802815 <devpipe_write+0x1c>
+
+00802878 <devpipe_read>:
+{
+  802878:	55                   	push   %ebp
+  802879:	89 e5                	mov    %esp,%ebp
+  80287b:	57                   	push   %edi
+  80287c:	56                   	push   %esi
+  80287d:	53                   	push   %ebx
+  80287e:	83 ec 18             	sub    $0x18,%esp
+  802881:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802884:	57                   	push   %edi
+  802885:	e8 53 f0 ff ff       	call   8018dd <fd2data>
+  80288a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80288c:	83 c4 10             	add    $0x10,%esp
+  80288f:	be 00 00 00 00       	mov    $0x0,%esi
+  802894:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802897:	75 13                	jne    8028ac <devpipe_read+0x34>
+	return i;
+  802899:	89 f0                	mov    %esi,%eax
+  80289b:	eb 02                	jmp    80289f <devpipe_read+0x27>
+				return i;
+  80289d:	89 f0                	mov    %esi,%eax
+}
+  80289f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a2:	5b                   	pop    %ebx
+  8028a3:	5e                   	pop    %esi
+  8028a4:	5f                   	pop    %edi
+  8028a5:	5d                   	pop    %ebp
+  8028a6:	c3                   	ret
+			sys_yield();
+  8028a7:	e8 65 e5 ff ff       	call   800e11 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8028ac:	8b 03                	mov    (%ebx),%eax
+  8028ae:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028b1:	75 18                	jne    8028cb <devpipe_read+0x53>
+			if (i > 0)
+  8028b3:	85 f6                	test   %esi,%esi
+  8028b5:	75 e6                	jne    80289d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8028b7:	89 da                	mov    %ebx,%edx
+  8028b9:	89 f8                	mov    %edi,%eax
+  8028bb:	e8 6c fe ff ff       	call   80272c <_pipeisclosed>
+  8028c0:	85 c0                	test   %eax,%eax
+  8028c2:	74 e3                	je     8028a7 <devpipe_read+0x2f>
+				return 0;
+  8028c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c9:	eb d4                	jmp    80289f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8028cb:	99                   	cltd
+  8028cc:	c1 ea 1b             	shr    $0x1b,%edx
+  8028cf:	01 d0                	add    %edx,%eax
+  8028d1:	83 e0 1f             	and    $0x1f,%eax
+  8028d4:	29 d0                	sub    %edx,%eax
+  8028d6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028de:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8028e1:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8028e4:	83 c6 01             	add    $0x1,%esi
+  8028e7:	eb ab                	jmp    802894 <devpipe_read+0x1c>
+
+008028e9 <pipe>:
+{
+  8028e9:	55                   	push   %ebp
+  8028ea:	89 e5                	mov    %esp,%ebp
+  8028ec:	56                   	push   %esi
+  8028ed:	53                   	push   %ebx
+  8028ee:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8028f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028f4:	50                   	push   %eax
+  8028f5:	e8 fa ef ff ff       	call   8018f4 <fd_alloc>
+  8028fa:	89 c3                	mov    %eax,%ebx
+  8028fc:	83 c4 10             	add    $0x10,%esp
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	0f 88 23 01 00 00    	js     802a2a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802907:	83 ec 04             	sub    $0x4,%esp
+  80290a:	68 07 04 00 00       	push   $0x407
+  80290f:	ff 75 f4             	push   -0xc(%ebp)
+  802912:	6a 00                	push   $0x0
+  802914:	e8 3e e5 ff ff       	call   800e57 <sys_page_alloc>
+  802919:	89 c3                	mov    %eax,%ebx
+  80291b:	83 c4 10             	add    $0x10,%esp
+  80291e:	85 c0                	test   %eax,%eax
+  802920:	0f 88 04 01 00 00    	js     802a2a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802926:	83 ec 0c             	sub    $0xc,%esp
+  802929:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80292c:	50                   	push   %eax
+  80292d:	e8 c2 ef ff ff       	call   8018f4 <fd_alloc>
+  802932:	89 c3                	mov    %eax,%ebx
+  802934:	83 c4 10             	add    $0x10,%esp
+  802937:	85 c0                	test   %eax,%eax
+  802939:	0f 88 db 00 00 00    	js     802a1a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80293f:	83 ec 04             	sub    $0x4,%esp
+  802942:	68 07 04 00 00       	push   $0x407
+  802947:	ff 75 f0             	push   -0x10(%ebp)
+  80294a:	6a 00                	push   $0x0
+  80294c:	e8 06 e5 ff ff       	call   800e57 <sys_page_alloc>
+  802951:	89 c3                	mov    %eax,%ebx
+  802953:	83 c4 10             	add    $0x10,%esp
+  802956:	85 c0                	test   %eax,%eax
+  802958:	0f 88 bc 00 00 00    	js     802a1a <pipe+0x131>
+	va = fd2data(fd0);
+  80295e:	83 ec 0c             	sub    $0xc,%esp
+  802961:	ff 75 f4             	push   -0xc(%ebp)
+  802964:	e8 74 ef ff ff       	call   8018dd <fd2data>
+  802969:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80296b:	83 c4 0c             	add    $0xc,%esp
+  80296e:	68 07 04 00 00       	push   $0x407
+  802973:	50                   	push   %eax
+  802974:	6a 00                	push   $0x0
+  802976:	e8 dc e4 ff ff       	call   800e57 <sys_page_alloc>
+  80297b:	89 c3                	mov    %eax,%ebx
+  80297d:	83 c4 10             	add    $0x10,%esp
+  802980:	85 c0                	test   %eax,%eax
+  802982:	0f 88 82 00 00 00    	js     802a0a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802988:	83 ec 0c             	sub    $0xc,%esp
+  80298b:	ff 75 f0             	push   -0x10(%ebp)
+  80298e:	e8 4a ef ff ff       	call   8018dd <fd2data>
+  802993:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80299a:	50                   	push   %eax
+  80299b:	6a 00                	push   $0x0
+  80299d:	56                   	push   %esi
+  80299e:	6a 00                	push   $0x0
+  8029a0:	e8 1f e5 ff ff       	call   800ec4 <sys_page_map>
+  8029a5:	89 c3                	mov    %eax,%ebx
+  8029a7:	83 c4 20             	add    $0x20,%esp
+  8029aa:	85 c0                	test   %eax,%eax
+  8029ac:	78 4e                	js     8029fc <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8029ae:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8029b3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029b6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8029b8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029bb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8029c2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8029c5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8029c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029ca:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8029d1:	83 ec 0c             	sub    $0xc,%esp
+  8029d4:	ff 75 f4             	push   -0xc(%ebp)
+  8029d7:	e8 f1 ee ff ff       	call   8018cd <fd2num>
+  8029dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029df:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8029e1:	83 c4 04             	add    $0x4,%esp
+  8029e4:	ff 75 f0             	push   -0x10(%ebp)
+  8029e7:	e8 e1 ee ff ff       	call   8018cd <fd2num>
+  8029ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029ef:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8029f2:	83 c4 10             	add    $0x10,%esp
+  8029f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029fa:	eb 2e                	jmp    802a2a <pipe+0x141>
+	sys_page_unmap(0, va);
+  8029fc:	83 ec 08             	sub    $0x8,%esp
+  8029ff:	56                   	push   %esi
+  802a00:	6a 00                	push   $0x0
+  802a02:	e8 2b e5 ff ff       	call   800f32 <sys_page_unmap>
+  802a07:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802a0a:	83 ec 08             	sub    $0x8,%esp
+  802a0d:	ff 75 f0             	push   -0x10(%ebp)
+  802a10:	6a 00                	push   $0x0
+  802a12:	e8 1b e5 ff ff       	call   800f32 <sys_page_unmap>
+  802a17:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802a1a:	83 ec 08             	sub    $0x8,%esp
+  802a1d:	ff 75 f4             	push   -0xc(%ebp)
+  802a20:	6a 00                	push   $0x0
+  802a22:	e8 0b e5 ff ff       	call   800f32 <sys_page_unmap>
+  802a27:	83 c4 10             	add    $0x10,%esp
+}
+  802a2a:	89 d8                	mov    %ebx,%eax
+  802a2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a2f:	5b                   	pop    %ebx
+  802a30:	5e                   	pop    %esi
+  802a31:	5d                   	pop    %ebp
+  802a32:	c3                   	ret
+
+00802a33 <pipeisclosed>:
+{
+  802a33:	55                   	push   %ebp
+  802a34:	89 e5                	mov    %esp,%ebp
+  802a36:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a3c:	50                   	push   %eax
+  802a3d:	ff 75 08             	push   0x8(%ebp)
+  802a40:	e8 05 ef ff ff       	call   80194a <fd_lookup>
+  802a45:	83 c4 10             	add    $0x10,%esp
+  802a48:	85 c0                	test   %eax,%eax
+  802a4a:	78 18                	js     802a64 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802a4c:	83 ec 0c             	sub    $0xc,%esp
+  802a4f:	ff 75 f4             	push   -0xc(%ebp)
+  802a52:	e8 86 ee ff ff       	call   8018dd <fd2data>
+  802a57:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802a59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a5c:	e8 cb fc ff ff       	call   80272c <_pipeisclosed>
+  802a61:	83 c4 10             	add    $0x10,%esp
+}
+  802a64:	c9                   	leave
+  802a65:	c3                   	ret
+
+00802a66 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6b:	c3                   	ret
+
+00802a6c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a6c:	55                   	push   %ebp
+  802a6d:	89 e5                	mov    %esp,%ebp
+  802a6f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802a72:	68 b3 32 80 00       	push   $0x8032b3
+  802a77:	ff 75 0c             	push   0xc(%ebp)
+  802a7a:	e8 e0 de ff ff       	call   80095f <strcpy>
+	return 0;
+}
+  802a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a84:	c9                   	leave
+  802a85:	c3                   	ret
+
+00802a86 <devcons_write>:
+{
+  802a86:	55                   	push   %ebp
+  802a87:	89 e5                	mov    %esp,%ebp
+  802a89:	57                   	push   %edi
+  802a8a:	56                   	push   %esi
+  802a8b:	53                   	push   %ebx
+  802a8c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802a92:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802a97:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802a9d:	eb 2e                	jmp    802acd <devcons_write+0x47>
+		m = n - tot;
+  802a9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802aa2:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802aa4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802aa9:	39 c3                	cmp    %eax,%ebx
+  802aab:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802aae:	83 ec 04             	sub    $0x4,%esp
+  802ab1:	53                   	push   %ebx
+  802ab2:	89 f0                	mov    %esi,%eax
+  802ab4:	03 45 0c             	add    0xc(%ebp),%eax
+  802ab7:	50                   	push   %eax
+  802ab8:	57                   	push   %edi
+  802ab9:	e8 27 e0 ff ff       	call   800ae5 <memmove>
+		sys_cputs(buf, m);
+  802abe:	83 c4 08             	add    $0x8,%esp
+  802ac1:	53                   	push   %ebx
+  802ac2:	57                   	push   %edi
+  802ac3:	e8 10 e2 ff ff       	call   800cd8 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802ac8:	01 de                	add    %ebx,%esi
+  802aca:	83 c4 10             	add    $0x10,%esp
+  802acd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ad0:	72 cd                	jb     802a9f <devcons_write+0x19>
+}
+  802ad2:	89 f0                	mov    %esi,%eax
+  802ad4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ad7:	5b                   	pop    %ebx
+  802ad8:	5e                   	pop    %esi
+  802ad9:	5f                   	pop    %edi
+  802ada:	5d                   	pop    %ebp
+  802adb:	c3                   	ret
+
+00802adc <devcons_read>:
+{
+  802adc:	55                   	push   %ebp
+  802add:	89 e5                	mov    %esp,%ebp
+  802adf:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802aeb:	75 07                	jne    802af4 <devcons_read+0x18>
+  802aed:	eb 1f                	jmp    802b0e <devcons_read+0x32>
+		sys_yield();
+  802aef:	e8 1d e3 ff ff       	call   800e11 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802af4:	e8 23 e2 ff ff       	call   800d1c <sys_cgetc>
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	74 f2                	je     802aef <devcons_read+0x13>
+	if (c < 0)
+  802afd:	78 0f                	js     802b0e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802aff:	83 f8 04             	cmp    $0x4,%eax
+  802b02:	74 0c                	je     802b10 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802b04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b07:	88 02                	mov    %al,(%edx)
+	return 1;
+  802b09:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802b0e:	c9                   	leave
+  802b0f:	c3                   	ret
+		return 0;
+  802b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b15:	eb f7                	jmp    802b0e <devcons_read+0x32>
+
+00802b17 <cputchar>:
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b20:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802b23:	6a 01                	push   $0x1
+  802b25:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b28:	50                   	push   %eax
+  802b29:	e8 aa e1 ff ff       	call   800cd8 <sys_cputs>
+}
+  802b2e:	83 c4 10             	add    $0x10,%esp
+  802b31:	c9                   	leave
+  802b32:	c3                   	ret
+
+00802b33 <getchar>:
+{
+  802b33:	55                   	push   %ebp
+  802b34:	89 e5                	mov    %esp,%ebp
+  802b36:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802b39:	6a 01                	push   $0x1
+  802b3b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b3e:	50                   	push   %eax
+  802b3f:	6a 00                	push   $0x0
+  802b41:	e8 8a f0 ff ff       	call   801bd0 <read>
+	if (r < 0)
+  802b46:	83 c4 10             	add    $0x10,%esp
+  802b49:	85 c0                	test   %eax,%eax
+  802b4b:	78 06                	js     802b53 <getchar+0x20>
+	if (r < 1)
+  802b4d:	74 06                	je     802b55 <getchar+0x22>
+	return c;
+  802b4f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802b53:	c9                   	leave
+  802b54:	c3                   	ret
+		return -E_EOF;
+  802b55:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802b5a:	eb f7                	jmp    802b53 <getchar+0x20>
+
+00802b5c <iscons>:
+{
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b65:	50                   	push   %eax
+  802b66:	ff 75 08             	push   0x8(%ebp)
+  802b69:	e8 dc ed ff ff       	call   80194a <fd_lookup>
+  802b6e:	83 c4 10             	add    $0x10,%esp
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	78 11                	js     802b86 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802b75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b78:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b7e:	39 10                	cmp    %edx,(%eax)
+  802b80:	0f 94 c0             	sete   %al
+  802b83:	0f b6 c0             	movzbl %al,%eax
+}
+  802b86:	c9                   	leave
+  802b87:	c3                   	ret
+
+00802b88 <opencons>:
+{
+  802b88:	55                   	push   %ebp
+  802b89:	89 e5                	mov    %esp,%ebp
+  802b8b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802b8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b91:	50                   	push   %eax
+  802b92:	e8 5d ed ff ff       	call   8018f4 <fd_alloc>
+  802b97:	83 c4 10             	add    $0x10,%esp
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	78 3a                	js     802bd8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802b9e:	83 ec 04             	sub    $0x4,%esp
+  802ba1:	68 07 04 00 00       	push   $0x407
+  802ba6:	ff 75 f4             	push   -0xc(%ebp)
+  802ba9:	6a 00                	push   $0x0
+  802bab:	e8 a7 e2 ff ff       	call   800e57 <sys_page_alloc>
+  802bb0:	83 c4 10             	add    $0x10,%esp
+  802bb3:	85 c0                	test   %eax,%eax
+  802bb5:	78 21                	js     802bd8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802bb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bba:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802bc0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802bc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bc5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802bcc:	83 ec 0c             	sub    $0xc,%esp
+  802bcf:	50                   	push   %eax
+  802bd0:	e8 f8 ec ff ff       	call   8018cd <fd2num>
+  802bd5:	83 c4 10             	add    $0x10,%esp
+}
+  802bd8:	c9                   	leave
+  802bd9:	c3                   	ret
+
+00802bda <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802bda:	55                   	push   %ebp
+  802bdb:	89 e5                	mov    %esp,%ebp
+  802bdd:	56                   	push   %esi
+  802bde:	53                   	push   %ebx
+  802bdf:	8b 75 08             	mov    0x8(%ebp),%esi
+  802be2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802be5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802be8:	85 c0                	test   %eax,%eax
+  802bea:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802bef:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802bf2:	83 ec 08             	sub    $0x8,%esp
+  802bf5:	ff 75 14             	push   0x14(%ebp)
+  802bf8:	50                   	push   %eax
+  802bf9:	e8 6a e6 ff ff       	call   801268 <sys_ipc_recv_until>
+  802bfe:	83 c4 10             	add    $0x10,%esp
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	78 61                	js     802c66 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802c05:	85 f6                	test   %esi,%esi
+  802c07:	74 1c                	je     802c25 <ipc_recv_until+0x4b>
+  802c09:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c0b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c10:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c16:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c1b:	76 5f                	jbe    802c7c <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802c1d:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802c23:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802c25:	85 db                	test   %ebx,%ebx
+  802c27:	74 1c                	je     802c45 <ipc_recv_until+0x6b>
+  802c29:	89 e0                	mov    %esp,%eax
+  802c2b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c30:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c36:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c3b:	76 50                	jbe    802c8d <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802c3d:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802c43:	89 03                	mov    %eax,(%ebx)
+  802c45:	89 e0                	mov    %esp,%eax
+  802c47:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c4c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c52:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c57:	76 45                	jbe    802c9e <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802c59:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802c5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c62:	5b                   	pop    %ebx
+  802c63:	5e                   	pop    %esi
+  802c64:	5d                   	pop    %ebp
+  802c65:	c3                   	ret
+		if (from_env_store)
+  802c66:	85 f6                	test   %esi,%esi
+  802c68:	74 06                	je     802c70 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802c6a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802c70:	85 db                	test   %ebx,%ebx
+  802c72:	74 eb                	je     802c5f <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802c74:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802c7a:	eb e3                	jmp    802c5f <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802c7c:	c1 e8 10             	shr    $0x10,%eax
+  802c7f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c85:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c8b:	eb 90                	jmp    802c1d <ipc_recv_until+0x43>
+  802c8d:	c1 e8 10             	shr    $0x10,%eax
+  802c90:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c96:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c9c:	eb 9f                	jmp    802c3d <ipc_recv_until+0x63>
+  802c9e:	c1 e8 10             	shr    $0x10,%eax
+  802ca1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ca7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802cad:	eb aa                	jmp    802c59 <ipc_recv_until+0x7f>
+
+00802caf <ipc_recv>:
+{
+  802caf:	55                   	push   %ebp
+  802cb0:	89 e5                	mov    %esp,%ebp
+  802cb2:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802cb5:	6a 00                	push   $0x0
+  802cb7:	ff 75 10             	push   0x10(%ebp)
+  802cba:	ff 75 0c             	push   0xc(%ebp)
+  802cbd:	ff 75 08             	push   0x8(%ebp)
+  802cc0:	e8 15 ff ff ff       	call   802bda <ipc_recv_until>
+}
+  802cc5:	c9                   	leave
+  802cc6:	c3                   	ret
+
+00802cc7 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802cc7:	55                   	push   %ebp
+  802cc8:	89 e5                	mov    %esp,%ebp
+  802cca:	57                   	push   %edi
+  802ccb:	56                   	push   %esi
+  802ccc:	53                   	push   %ebx
+  802ccd:	83 ec 0c             	sub    $0xc,%esp
+  802cd0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cd3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802cd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802cd9:	85 db                	test   %ebx,%ebx
+  802cdb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ce0:	0f 44 d8             	cmove  %eax,%ebx
+  802ce3:	eb 05                	jmp    802cea <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802ce5:	e8 27 e1 ff ff       	call   800e11 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802cea:	ff 75 14             	push   0x14(%ebp)
+  802ced:	53                   	push   %ebx
+  802cee:	56                   	push   %esi
+  802cef:	57                   	push   %edi
+  802cf0:	e8 bf e4 ff ff       	call   8011b4 <sys_ipc_try_send>
+  802cf5:	83 c4 10             	add    $0x10,%esp
+  802cf8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802cfb:	74 e8                	je     802ce5 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802cfd:	85 c0                	test   %eax,%eax
+  802cff:	78 08                	js     802d09 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802d01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d04:	5b                   	pop    %ebx
+  802d05:	5e                   	pop    %esi
+  802d06:	5f                   	pop    %edi
+  802d07:	5d                   	pop    %ebp
+  802d08:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802d09:	50                   	push   %eax
+  802d0a:	68 bf 32 80 00       	push   $0x8032bf
+  802d0f:	6a 4f                	push   $0x4f
+  802d11:	68 d2 32 80 00       	push   $0x8032d2
+  802d16:	e8 21 d5 ff ff       	call   80023c <_panic>
+
+00802d1b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d1b:	55                   	push   %ebp
+  802d1c:	89 e5                	mov    %esp,%ebp
+  802d1e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802d21:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802d26:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802d2c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d32:	8b 52 50             	mov    0x50(%edx),%edx
+  802d35:	39 ca                	cmp    %ecx,%edx
+  802d37:	74 11                	je     802d4a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802d39:	83 c0 01             	add    $0x1,%eax
+  802d3c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802d41:	75 e3                	jne    802d26 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d48:	eb 0e                	jmp    802d58 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802d4a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d50:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d55:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802d58:	5d                   	pop    %ebp
+  802d59:	c3                   	ret
+
+00802d5a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d5a:	55                   	push   %ebp
+  802d5b:	89 e5                	mov    %esp,%ebp
+  802d5d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d60:	89 c2                	mov    %eax,%edx
+  802d62:	c1 ea 16             	shr    $0x16,%edx
+  802d65:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802d6c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d71:	f6 c1 01             	test   $0x1,%cl
+  802d74:	74 1a                	je     802d90 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802d76:	c1 e8 0c             	shr    $0xc,%eax
+  802d79:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802d80:	a8 01                	test   $0x1,%al
+  802d82:	74 0c                	je     802d90 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802d84:	c1 e8 0c             	shr    $0xc,%eax
+  802d87:	c1 e0 04             	shl    $0x4,%eax
+  802d8a:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802d90:	89 d0                	mov    %edx,%eax
+  802d92:	5d                   	pop    %ebp
+  802d93:	c3                   	ret
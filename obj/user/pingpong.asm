@@ -0,0 +1,7117 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	envid_t who;
+
+	if ((who = fork()) != 0) {
+  80003c:	e8 49 1c 00 00       	call   801c8a <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+		ipc_send(who, 0, 0, 0);
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 78 1d 00 00       	call   801dd0 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 b1 0c 00 00       	call   800d13 <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 76 33 80 00       	push   $0x803376
+  80006a:	e8 f0 01 00 00       	call   80025f <cprintf>
+		if (i == 10)
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+			return;
+		i++;
+  800077:	83 c3 01             	add    $0x1,%ebx
+		ipc_send(who, i, 0, 0);
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 61 1d 00 00       	call   801de8 <ipc_send>
+		if (i == 10)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+			return;
+	}
+
+}
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800099:	e8 75 0c 00 00       	call   800d13 <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 60 33 80 00       	push   $0x803360
+  8000a8:	e8 b2 01 00 00       	call   80025f <cprintf>
+		ipc_send(who, 0, 0, 0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 2d 1d 00 00       	call   801de8 <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  8000c6:	83 ec 0c             	sub    $0xc,%esp
+  8000c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d4:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000d6:	c1 ea 0b             	shr    $0xb,%edx
+  8000d9:	83 f2 01             	xor    $0x1,%edx
+  8000dc:	83 e2 01             	and    $0x1,%edx
+  8000df:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000e5:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000ec:	00 00 00 
+	envid = sys_getenvid();
+  8000ef:	e8 1f 0c 00 00       	call   800d13 <sys_getenvid>
+  8000f4:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8000f6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000fb:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800101:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800107:	8b 52 48             	mov    0x48(%edx),%edx
+  80010a:	39 ca                	cmp    %ecx,%edx
+  80010c:	74 27                	je     800135 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80010e:	83 c0 01             	add    $0x1,%eax
+  800111:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800116:	75 e3                	jne    8000fb <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800118:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80011f:	75 24                	jne    800145 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800121:	83 ec 04             	sub    $0x4,%esp
+  800124:	68 8c 33 80 00       	push   $0x80338c
+  800129:	6a 23                	push   $0x23
+  80012b:	68 af 33 80 00       	push   $0x8033af
+  800130:	e8 4f 00 00 00       	call   800184 <_panic>
+			mainenv = &envs[i];
+  800135:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80013b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800140:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800145:	85 ff                	test   %edi,%edi
+  800147:	7e 07                	jle    800150 <libmain+0x90>
+		binaryname = argv[0];
+  800149:	8b 06                	mov    (%esi),%eax
+  80014b:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800150:	83 ec 08             	sub    $0x8,%esp
+  800153:	56                   	push   %esi
+  800154:	57                   	push   %edi
+  800155:	e8 d9 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80015a:	e8 0b 00 00 00       	call   80016a <exit>
+}
+  80015f:	83 c4 10             	add    $0x10,%esp
+  800162:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800165:	5b                   	pop    %ebx
+  800166:	5e                   	pop    %esi
+  800167:	5f                   	pop    %edi
+  800168:	5d                   	pop    %ebp
+  800169:	c3                   	ret
+
+0080016a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80016a:	55                   	push   %ebp
+  80016b:	89 e5                	mov    %esp,%ebp
+  80016d:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800170:	e8 1c 21 00 00       	call   802291 <close_all>
+	sys_env_destroy(0);
+  800175:	83 ec 0c             	sub    $0xc,%esp
+  800178:	6a 00                	push   $0x0
+  80017a:	e8 2b 0b 00 00       	call   800caa <sys_env_destroy>
+}
+  80017f:	83 c4 10             	add    $0x10,%esp
+  800182:	c9                   	leave
+  800183:	c3                   	ret
+
+00800184 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800184:	55                   	push   %ebp
+  800185:	89 e5                	mov    %esp,%ebp
+  800187:	56                   	push   %esi
+  800188:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800189:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80018c:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800192:	e8 7c 0b 00 00       	call   800d13 <sys_getenvid>
+  800197:	83 ec 0c             	sub    $0xc,%esp
+  80019a:	ff 75 0c             	push   0xc(%ebp)
+  80019d:	ff 75 08             	push   0x8(%ebp)
+  8001a0:	56                   	push   %esi
+  8001a1:	50                   	push   %eax
+  8001a2:	68 c8 33 80 00       	push   $0x8033c8
+  8001a7:	e8 b3 00 00 00       	call   80025f <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001ac:	83 c4 18             	add    $0x18,%esp
+  8001af:	53                   	push   %ebx
+  8001b0:	ff 75 10             	push   0x10(%ebp)
+  8001b3:	e8 56 00 00 00       	call   80020e <vcprintf>
+	cprintf("\n");
+  8001b8:	c7 04 24 6f 39 80 00 	movl   $0x80396f,(%esp)
+  8001bf:	e8 9b 00 00 00       	call   80025f <cprintf>
+  8001c4:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001c7:	cc                   	int3
+	while (1)
+  8001c8:	eb fd                	jmp    8001c7 <_panic+0x43>
+
+008001ca <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	53                   	push   %ebx
+  8001ce:	83 ec 04             	sub    $0x4,%esp
+  8001d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001d4:	8b 13                	mov    (%ebx),%edx
+  8001d6:	8d 42 01             	lea    0x1(%edx),%eax
+  8001d9:	89 03                	mov    %eax,(%ebx)
+  8001db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001de:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001e2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001e7:	74 09                	je     8001f2 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001e9:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f0:	c9                   	leave
+  8001f1:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001f2:	83 ec 08             	sub    $0x8,%esp
+  8001f5:	68 ff 00 00 00       	push   $0xff
+  8001fa:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001fd:	50                   	push   %eax
+  8001fe:	e8 1d 0a 00 00       	call   800c20 <sys_cputs>
+		b->idx = 0;
+  800203:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800209:	83 c4 10             	add    $0x10,%esp
+  80020c:	eb db                	jmp    8001e9 <putch+0x1f>
+
+0080020e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80020e:	55                   	push   %ebp
+  80020f:	89 e5                	mov    %esp,%ebp
+  800211:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800217:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80021e:	00 00 00 
+	b.cnt = 0;
+  800221:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800228:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80022b:	ff 75 0c             	push   0xc(%ebp)
+  80022e:	ff 75 08             	push   0x8(%ebp)
+  800231:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800237:	50                   	push   %eax
+  800238:	68 ca 01 80 00       	push   $0x8001ca
+  80023d:	e8 fb 00 00 00       	call   80033d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800242:	83 c4 08             	add    $0x8,%esp
+  800245:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80024b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800251:	50                   	push   %eax
+  800252:	e8 c9 09 00 00       	call   800c20 <sys_cputs>
+
+	return b.cnt;
+}
+  800257:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80025d:	c9                   	leave
+  80025e:	c3                   	ret
+
+0080025f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80025f:	55                   	push   %ebp
+  800260:	89 e5                	mov    %esp,%ebp
+  800262:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800265:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800268:	50                   	push   %eax
+  800269:	ff 75 08             	push   0x8(%ebp)
+  80026c:	e8 9d ff ff ff       	call   80020e <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800271:	c9                   	leave
+  800272:	c3                   	ret
+
+00800273 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800273:	55                   	push   %ebp
+  800274:	89 e5                	mov    %esp,%ebp
+  800276:	57                   	push   %edi
+  800277:	56                   	push   %esi
+  800278:	53                   	push   %ebx
+  800279:	83 ec 1c             	sub    $0x1c,%esp
+  80027c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80027f:	89 d6                	mov    %edx,%esi
+  800281:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800284:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800287:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80028a:	73 0b                	jae    800297 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80028c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80028f:	c1 e7 08             	shl    $0x8,%edi
+  800292:	0b 7d 10             	or     0x10(%ebp),%edi
+  800295:	eb 36                	jmp    8002cd <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800297:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80029a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80029f:	f7 75 08             	divl   0x8(%ebp)
+  8002a2:	89 c1                	mov    %eax,%ecx
+  8002a4:	ff 75 14             	push   0x14(%ebp)
+  8002a7:	ff 75 10             	push   0x10(%ebp)
+  8002aa:	83 eb 01             	sub    $0x1,%ebx
+  8002ad:	53                   	push   %ebx
+  8002ae:	ff 75 08             	push   0x8(%ebp)
+  8002b1:	89 f2                	mov    %esi,%edx
+  8002b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002b6:	e8 b8 ff ff ff       	call   800273 <printnum>
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	eb 14                	jmp    8002d4 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002c0:	83 ec 08             	sub    $0x8,%esp
+  8002c3:	56                   	push   %esi
+  8002c4:	57                   	push   %edi
+  8002c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002c8:	ff d0                	call   *%eax
+  8002ca:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002cd:	83 eb 01             	sub    $0x1,%ebx
+  8002d0:	85 db                	test   %ebx,%ebx
+  8002d2:	7f ec                	jg     8002c0 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002d4:	83 ec 08             	sub    $0x8,%esp
+  8002d7:	56                   	push   %esi
+  8002d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e0:	f7 75 08             	divl   0x8(%ebp)
+  8002e3:	0f be 92 eb 33 80 00 	movsbl 0x8033eb(%edx),%edx
+  8002ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002ed:	c1 e0 08             	shl    $0x8,%eax
+  8002f0:	09 d0                	or     %edx,%eax
+  8002f2:	50                   	push   %eax
+  8002f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002f6:	ff d0                	call   *%eax
+}
+  8002f8:	83 c4 10             	add    $0x10,%esp
+  8002fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002fe:	5b                   	pop    %ebx
+  8002ff:	5e                   	pop    %esi
+  800300:	5f                   	pop    %edi
+  800301:	5d                   	pop    %ebp
+  800302:	c3                   	ret
+
+00800303 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800309:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80030d:	8b 10                	mov    (%eax),%edx
+  80030f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800312:	73 0a                	jae    80031e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800314:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800317:	89 08                	mov    %ecx,(%eax)
+  800319:	8b 45 08             	mov    0x8(%ebp),%eax
+  80031c:	88 02                	mov    %al,(%edx)
+}
+  80031e:	5d                   	pop    %ebp
+  80031f:	c3                   	ret
+
+00800320 <printfmt>:
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800326:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800329:	50                   	push   %eax
+  80032a:	ff 75 10             	push   0x10(%ebp)
+  80032d:	ff 75 0c             	push   0xc(%ebp)
+  800330:	ff 75 08             	push   0x8(%ebp)
+  800333:	e8 05 00 00 00       	call   80033d <vprintfmt>
+}
+  800338:	83 c4 10             	add    $0x10,%esp
+  80033b:	c9                   	leave
+  80033c:	c3                   	ret
+
+0080033d <vprintfmt>:
+{
+  80033d:	55                   	push   %ebp
+  80033e:	89 e5                	mov    %esp,%ebp
+  800340:	57                   	push   %edi
+  800341:	56                   	push   %esi
+  800342:	53                   	push   %ebx
+  800343:	83 ec 3c             	sub    $0x3c,%esp
+  800346:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800349:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80034c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800353:	eb 16                	jmp    80036b <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800355:	83 ec 08             	sub    $0x8,%esp
+  800358:	ff 75 0c             	push   0xc(%ebp)
+  80035b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80035e:	c1 e2 08             	shl    $0x8,%edx
+  800361:	09 d0                	or     %edx,%eax
+  800363:	50                   	push   %eax
+  800364:	ff d7                	call   *%edi
+  800366:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800369:	89 de                	mov    %ebx,%esi
+  80036b:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80036e:	0f b6 06             	movzbl (%esi),%eax
+  800371:	83 f8 25             	cmp    $0x25,%eax
+  800374:	74 0c                	je     800382 <vprintfmt+0x45>
+			if (ch == '\0')
+  800376:	85 c0                	test   %eax,%eax
+  800378:	75 db                	jne    800355 <vprintfmt+0x18>
+}
+  80037a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037d:	5b                   	pop    %ebx
+  80037e:	5e                   	pop    %esi
+  80037f:	5f                   	pop    %edi
+  800380:	5d                   	pop    %ebp
+  800381:	c3                   	ret
+		padc = ' ';
+  800382:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800386:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80038d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800394:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80039b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a0:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003a3:	0f b6 13             	movzbl (%ebx),%edx
+  8003a6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003a9:	3c 55                	cmp    $0x55,%al
+  8003ab:	0f 87 2c 04 00 00    	ja     8007dd <vprintfmt+0x4a0>
+  8003b1:	0f b6 c0             	movzbl %al,%eax
+  8003b4:	ff 24 85 40 35 80 00 	jmp    *0x803540(,%eax,4)
+  8003bb:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003bd:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003c1:	eb dd                	jmp    8003a0 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c3:	89 f3                	mov    %esi,%ebx
+  8003c5:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003c9:	eb d5                	jmp    8003a0 <vprintfmt+0x63>
+  8003cb:	0f b6 d2             	movzbl %dl,%edx
+  8003ce:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003d0:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003d5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003d8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003dc:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003df:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003e2:	83 fe 09             	cmp    $0x9,%esi
+  8003e5:	0f 87 8a 00 00 00    	ja     800475 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003eb:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003ee:	eb e5                	jmp    8003d5 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f3:	8b 00                	mov    (%eax),%eax
+  8003f5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8003fe:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800401:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800403:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800407:	79 97                	jns    8003a0 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800409:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80040c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80040f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800416:	eb 88                	jmp    8003a0 <vprintfmt+0x63>
+			if (width < 0)
+  800418:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80041b:	85 db                	test   %ebx,%ebx
+  80041d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800422:	0f 49 c3             	cmovns %ebx,%eax
+  800425:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800428:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80042a:	e9 71 ff ff ff       	jmp    8003a0 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80042f:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800431:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800438:	e9 63 ff ff ff       	jmp    8003a0 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80043d:	8d 73 02             	lea    0x2(%ebx),%esi
+  800440:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800444:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80044b:	3c 67                	cmp    $0x67,%al
+  80044d:	0f 84 18 ff ff ff    	je     80036b <vprintfmt+0x2e>
+					attrib = 0x04;
+  800453:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80045a:	3c 72                	cmp    $0x72,%al
+  80045c:	0f 84 09 ff ff ff    	je     80036b <vprintfmt+0x2e>
+					attrib = 0x00;
+  800462:	3c 62                	cmp    $0x62,%al
+  800464:	0f 94 c0             	sete   %al
+  800467:	0f b6 c0             	movzbl %al,%eax
+  80046a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80046d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800470:	e9 f6 fe ff ff       	jmp    80036b <vprintfmt+0x2e>
+  800475:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800478:	eb 89                	jmp    800403 <vprintfmt+0xc6>
+			lflag++;
+  80047a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80047d:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80047f:	e9 1c ff ff ff       	jmp    8003a0 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800484:	8b 45 14             	mov    0x14(%ebp),%eax
+  800487:	8d 58 04             	lea    0x4(%eax),%ebx
+  80048a:	83 ec 08             	sub    $0x8,%esp
+  80048d:	ff 75 0c             	push   0xc(%ebp)
+  800490:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800493:	c1 e0 08             	shl    $0x8,%eax
+  800496:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800499:	0b 01                	or     (%ecx),%eax
+  80049b:	50                   	push   %eax
+  80049c:	ff d7                	call   *%edi
+			break;
+  80049e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004a1:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004a4:	e9 c2 fe ff ff       	jmp    80036b <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ac:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004af:	8b 10                	mov    (%eax),%edx
+  8004b1:	89 d0                	mov    %edx,%eax
+  8004b3:	f7 d8                	neg    %eax
+  8004b5:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004b8:	83 f8 12             	cmp    $0x12,%eax
+  8004bb:	7f 25                	jg     8004e2 <vprintfmt+0x1a5>
+  8004bd:	8b 14 85 a0 36 80 00 	mov    0x8036a0(,%eax,4),%edx
+  8004c4:	85 d2                	test   %edx,%edx
+  8004c6:	74 1a                	je     8004e2 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004c8:	52                   	push   %edx
+  8004c9:	68 e2 37 80 00       	push   $0x8037e2
+  8004ce:	ff 75 0c             	push   0xc(%ebp)
+  8004d1:	57                   	push   %edi
+  8004d2:	e8 49 fe ff ff       	call   800320 <printfmt>
+  8004d7:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004da:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8004dd:	e9 89 fe ff ff       	jmp    80036b <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004e2:	50                   	push   %eax
+  8004e3:	68 03 34 80 00       	push   $0x803403
+  8004e8:	ff 75 0c             	push   0xc(%ebp)
+  8004eb:	57                   	push   %edi
+  8004ec:	e8 2f fe ff ff       	call   800320 <printfmt>
+  8004f1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004f4:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004f7:	e9 6f fe ff ff       	jmp    80036b <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ff:	83 c0 04             	add    $0x4,%eax
+  800502:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800505:	8b 45 14             	mov    0x14(%ebp),%eax
+  800508:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80050a:	85 c9                	test   %ecx,%ecx
+  80050c:	b8 fc 33 80 00       	mov    $0x8033fc,%eax
+  800511:	0f 45 c1             	cmovne %ecx,%eax
+  800514:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800517:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80051b:	7e 06                	jle    800523 <vprintfmt+0x1e6>
+  80051d:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800521:	75 1a                	jne    80053d <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800523:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800526:	c1 e0 08             	shl    $0x8,%eax
+  800529:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80052c:	83 c8 3f             	or     $0x3f,%eax
+  80052f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800532:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800535:	89 75 10             	mov    %esi,0x10(%ebp)
+  800538:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80053b:	eb 6d                	jmp    8005aa <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	ff 75 d0             	push   -0x30(%ebp)
+  800543:	ff 75 c8             	push   -0x38(%ebp)
+  800546:	e8 39 03 00 00       	call   800884 <strnlen>
+  80054b:	89 c2                	mov    %eax,%edx
+  80054d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800550:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800552:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800555:	c1 e1 08             	shl    $0x8,%ecx
+  800558:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80055c:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80055e:	83 c4 10             	add    $0x10,%esp
+  800561:	89 c3                	mov    %eax,%ebx
+  800563:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800566:	89 75 10             	mov    %esi,0x10(%ebp)
+  800569:	89 ce                	mov    %ecx,%esi
+  80056b:	eb 0f                	jmp    80057c <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80056d:	83 ec 08             	sub    $0x8,%esp
+  800570:	ff 75 0c             	push   0xc(%ebp)
+  800573:	56                   	push   %esi
+  800574:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800576:	83 eb 01             	sub    $0x1,%ebx
+  800579:	83 c4 10             	add    $0x10,%esp
+  80057c:	85 db                	test   %ebx,%ebx
+  80057e:	7f ed                	jg     80056d <vprintfmt+0x230>
+  800580:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800583:	8b 75 10             	mov    0x10(%ebp),%esi
+  800586:	85 c0                	test   %eax,%eax
+  800588:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058d:	0f 49 d0             	cmovns %eax,%edx
+  800590:	29 d0                	sub    %edx,%eax
+  800592:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800595:	eb 8c                	jmp    800523 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800597:	83 ec 08             	sub    $0x8,%esp
+  80059a:	ff 75 0c             	push   0xc(%ebp)
+  80059d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005a0:	09 c2                	or     %eax,%edx
+  8005a2:	52                   	push   %edx
+  8005a3:	ff d7                	call   *%edi
+  8005a5:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005a8:	89 d9                	mov    %ebx,%ecx
+  8005aa:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005ad:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005b1:	0f be d0             	movsbl %al,%edx
+  8005b4:	85 d2                	test   %edx,%edx
+  8005b6:	74 2a                	je     8005e2 <vprintfmt+0x2a5>
+  8005b8:	85 f6                	test   %esi,%esi
+  8005ba:	78 05                	js     8005c1 <vprintfmt+0x284>
+  8005bc:	83 ee 01             	sub    $0x1,%esi
+  8005bf:	78 3b                	js     8005fc <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005c1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005c5:	74 d0                	je     800597 <vprintfmt+0x25a>
+  8005c7:	0f be c0             	movsbl %al,%eax
+  8005ca:	83 e8 20             	sub    $0x20,%eax
+  8005cd:	83 f8 5e             	cmp    $0x5e,%eax
+  8005d0:	76 c5                	jbe    800597 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005d2:	83 ec 08             	sub    $0x8,%esp
+  8005d5:	ff 75 0c             	push   0xc(%ebp)
+  8005d8:	ff 75 cc             	push   -0x34(%ebp)
+  8005db:	ff d7                	call   *%edi
+  8005dd:	83 c4 10             	add    $0x10,%esp
+  8005e0:	eb c6                	jmp    8005a8 <vprintfmt+0x26b>
+  8005e2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005e5:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005eb:	01 c3                	add    %eax,%ebx
+  8005ed:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005ef:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005f2:	83 c8 20             	or     $0x20,%eax
+  8005f5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005f8:	89 c6                	mov    %eax,%esi
+  8005fa:	eb 14                	jmp    800610 <vprintfmt+0x2d3>
+  8005fc:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005ff:	eb e4                	jmp    8005e5 <vprintfmt+0x2a8>
+  800601:	83 ec 08             	sub    $0x8,%esp
+  800604:	ff 75 0c             	push   0xc(%ebp)
+  800607:	56                   	push   %esi
+  800608:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80060a:	83 eb 01             	sub    $0x1,%ebx
+  80060d:	83 c4 10             	add    $0x10,%esp
+  800610:	85 db                	test   %ebx,%ebx
+  800612:	7f ed                	jg     800601 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800614:	8b 75 10             	mov    0x10(%ebp),%esi
+  800617:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061d:	e9 49 fd ff ff       	jmp    80036b <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800622:	83 f9 01             	cmp    $0x1,%ecx
+  800625:	7f 1f                	jg     800646 <vprintfmt+0x309>
+	else if (lflag)
+  800627:	85 c9                	test   %ecx,%ecx
+  800629:	74 69                	je     800694 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8b 00                	mov    (%eax),%eax
+  800630:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800633:	89 c1                	mov    %eax,%ecx
+  800635:	c1 f9 1f             	sar    $0x1f,%ecx
+  800638:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+  800644:	eb 17                	jmp    80065d <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8b 50 04             	mov    0x4(%eax),%edx
+  80064c:	8b 00                	mov    (%eax),%eax
+  80064e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800651:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800654:	8b 45 14             	mov    0x14(%ebp),%eax
+  800657:	8d 40 08             	lea    0x8(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80065d:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800660:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800663:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800668:	85 db                	test   %ebx,%ebx
+  80066a:	0f 89 f6 00 00 00    	jns    800766 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800670:	83 ec 08             	sub    $0x8,%esp
+  800673:	ff 75 0c             	push   0xc(%ebp)
+  800676:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800679:	c1 e0 08             	shl    $0x8,%eax
+  80067c:	83 c8 2d             	or     $0x2d,%eax
+  80067f:	50                   	push   %eax
+  800680:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800682:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800685:	f7 d9                	neg    %ecx
+  800687:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80068a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80068f:	e9 d2 00 00 00       	jmp    800766 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8b 00                	mov    (%eax),%eax
+  800699:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069c:	89 c1                	mov    %eax,%ecx
+  80069e:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006a1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ad:	eb ae                	jmp    80065d <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006af:	83 f9 01             	cmp    $0x1,%ecx
+  8006b2:	7f 19                	jg     8006cd <vprintfmt+0x390>
+	else if (lflag)
+  8006b4:	85 c9                	test   %ecx,%ecx
+  8006b6:	74 2a                	je     8006e2 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 08                	mov    (%eax),%ecx
+  8006bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006c8:	e9 99 00 00 00       	jmp    800766 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 08                	mov    (%eax),%ecx
+  8006d2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8006dd:	e9 84 00 00 00       	jmp    800766 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	8b 08                	mov    (%eax),%ecx
+  8006e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006f2:	eb 72                	jmp    800766 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006f4:	83 f9 01             	cmp    $0x1,%ecx
+  8006f7:	7f 16                	jg     80070f <vprintfmt+0x3d2>
+	else if (lflag)
+  8006f9:	85 c9                	test   %ecx,%ecx
+  8006fb:	74 24                	je     800721 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8b 08                	mov    (%eax),%ecx
+  800702:	8d 40 04             	lea    0x4(%eax),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800708:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80070d:	eb 57                	jmp    800766 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8b 08                	mov    (%eax),%ecx
+  800714:	8d 40 08             	lea    0x8(%eax),%eax
+  800717:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80071a:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80071f:	eb 45                	jmp    800766 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 08                	mov    (%eax),%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800731:	eb 33                	jmp    800766 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800733:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800736:	c1 e3 08             	shl    $0x8,%ebx
+  800739:	83 ec 08             	sub    $0x8,%esp
+  80073c:	ff 75 0c             	push   0xc(%ebp)
+  80073f:	89 d8                	mov    %ebx,%eax
+  800741:	83 c8 30             	or     $0x30,%eax
+  800744:	50                   	push   %eax
+  800745:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800747:	83 c4 08             	add    $0x8,%esp
+  80074a:	ff 75 0c             	push   0xc(%ebp)
+  80074d:	83 cb 78             	or     $0x78,%ebx
+  800750:	53                   	push   %ebx
+  800751:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800758:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80075b:	8d 40 04             	lea    0x4(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800761:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800766:	ff 75 e4             	push   -0x1c(%ebp)
+  800769:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80076d:	52                   	push   %edx
+  80076e:	ff 75 e0             	push   -0x20(%ebp)
+  800771:	50                   	push   %eax
+  800772:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800775:	89 f8                	mov    %edi,%eax
+  800777:	e8 f7 fa ff ff       	call   800273 <printnum>
+			break;
+  80077c:	83 c4 10             	add    $0x10,%esp
+  80077f:	e9 e7 fb ff ff       	jmp    80036b <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800784:	83 f9 01             	cmp    $0x1,%ecx
+  800787:	7f 16                	jg     80079f <vprintfmt+0x462>
+	else if (lflag)
+  800789:	85 c9                	test   %ecx,%ecx
+  80078b:	74 24                	je     8007b1 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80078d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800790:	8b 08                	mov    (%eax),%ecx
+  800792:	8d 40 04             	lea    0x4(%eax),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800798:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80079d:	eb c7                	jmp    800766 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80079f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a2:	8b 08                	mov    (%eax),%ecx
+  8007a4:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007aa:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007af:	eb b5                	jmp    800766 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b4:	8b 08                	mov    (%eax),%ecx
+  8007b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007bc:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007c1:	eb a3                	jmp    800766 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007c3:	83 ec 08             	sub    $0x8,%esp
+  8007c6:	ff 75 0c             	push   0xc(%ebp)
+  8007c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007cc:	c1 e0 08             	shl    $0x8,%eax
+  8007cf:	83 c8 25             	or     $0x25,%eax
+  8007d2:	50                   	push   %eax
+  8007d3:	ff d7                	call   *%edi
+			break;
+  8007d5:	83 c4 10             	add    $0x10,%esp
+  8007d8:	e9 8e fb ff ff       	jmp    80036b <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8007dd:	83 ec 08             	sub    $0x8,%esp
+  8007e0:	ff 75 0c             	push   0xc(%ebp)
+  8007e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007e6:	c1 e0 08             	shl    $0x8,%eax
+  8007e9:	83 c8 25             	or     $0x25,%eax
+  8007ec:	50                   	push   %eax
+  8007ed:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ef:	83 c4 10             	add    $0x10,%esp
+  8007f2:	89 de                	mov    %ebx,%esi
+  8007f4:	eb 03                	jmp    8007f9 <vprintfmt+0x4bc>
+  8007f6:	83 ee 01             	sub    $0x1,%esi
+  8007f9:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007fd:	75 f7                	jne    8007f6 <vprintfmt+0x4b9>
+  8007ff:	e9 67 fb ff ff       	jmp    80036b <vprintfmt+0x2e>
+
+00800804 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800804:	55                   	push   %ebp
+  800805:	89 e5                	mov    %esp,%ebp
+  800807:	83 ec 18             	sub    $0x18,%esp
+  80080a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80080d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800810:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800813:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800817:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80081a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800821:	85 c0                	test   %eax,%eax
+  800823:	74 26                	je     80084b <vsnprintf+0x47>
+  800825:	85 d2                	test   %edx,%edx
+  800827:	7e 22                	jle    80084b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800829:	ff 75 14             	push   0x14(%ebp)
+  80082c:	ff 75 10             	push   0x10(%ebp)
+  80082f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800832:	50                   	push   %eax
+  800833:	68 03 03 80 00       	push   $0x800303
+  800838:	e8 00 fb ff ff       	call   80033d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80083d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800840:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800846:	83 c4 10             	add    $0x10,%esp
+}
+  800849:	c9                   	leave
+  80084a:	c3                   	ret
+		return -E_INVAL;
+  80084b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800850:	eb f7                	jmp    800849 <vsnprintf+0x45>
+
+00800852 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800852:	55                   	push   %ebp
+  800853:	89 e5                	mov    %esp,%ebp
+  800855:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800858:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80085b:	50                   	push   %eax
+  80085c:	ff 75 10             	push   0x10(%ebp)
+  80085f:	ff 75 0c             	push   0xc(%ebp)
+  800862:	ff 75 08             	push   0x8(%ebp)
+  800865:	e8 9a ff ff ff       	call   800804 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80086a:	c9                   	leave
+  80086b:	c3                   	ret
+
+0080086c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80086c:	55                   	push   %ebp
+  80086d:	89 e5                	mov    %esp,%ebp
+  80086f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800872:	b8 00 00 00 00       	mov    $0x0,%eax
+  800877:	eb 03                	jmp    80087c <strlen+0x10>
+		n++;
+  800879:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80087c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800880:	75 f7                	jne    800879 <strlen+0xd>
+	return n;
+}
+  800882:	5d                   	pop    %ebp
+  800883:	c3                   	ret
+
+00800884 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80088a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80088d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800892:	eb 03                	jmp    800897 <strnlen+0x13>
+		n++;
+  800894:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800897:	39 d0                	cmp    %edx,%eax
+  800899:	74 08                	je     8008a3 <strnlen+0x1f>
+  80089b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80089f:	75 f3                	jne    800894 <strnlen+0x10>
+  8008a1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008a3:	89 d0                	mov    %edx,%eax
+  8008a5:	5d                   	pop    %ebp
+  8008a6:	c3                   	ret
+
+008008a7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008a7:	55                   	push   %ebp
+  8008a8:	89 e5                	mov    %esp,%ebp
+  8008aa:	53                   	push   %ebx
+  8008ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008ba:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008bd:	83 c0 01             	add    $0x1,%eax
+  8008c0:	84 d2                	test   %dl,%dl
+  8008c2:	75 f2                	jne    8008b6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008c4:	89 c8                	mov    %ecx,%eax
+  8008c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c9:	c9                   	leave
+  8008ca:	c3                   	ret
+
+008008cb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008cb:	55                   	push   %ebp
+  8008cc:	89 e5                	mov    %esp,%ebp
+  8008ce:	53                   	push   %ebx
+  8008cf:	83 ec 10             	sub    $0x10,%esp
+  8008d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008d5:	53                   	push   %ebx
+  8008d6:	e8 91 ff ff ff       	call   80086c <strlen>
+  8008db:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008de:	ff 75 0c             	push   0xc(%ebp)
+  8008e1:	01 d8                	add    %ebx,%eax
+  8008e3:	50                   	push   %eax
+  8008e4:	e8 be ff ff ff       	call   8008a7 <strcpy>
+	return dst;
+}
+  8008e9:	89 d8                	mov    %ebx,%eax
+  8008eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ee:	c9                   	leave
+  8008ef:	c3                   	ret
+
+008008f0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	56                   	push   %esi
+  8008f4:	53                   	push   %ebx
+  8008f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008fb:	89 f3                	mov    %esi,%ebx
+  8008fd:	03 5d 10             	add    0x10(%ebp),%ebx
+  800900:	89 f0                	mov    %esi,%eax
+  800902:	eb 0f                	jmp    800913 <strncpy+0x23>
+		*dst++ = *src;
+  800904:	83 c0 01             	add    $0x1,%eax
+  800907:	0f b6 0a             	movzbl (%edx),%ecx
+  80090a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80090d:	80 f9 01             	cmp    $0x1,%cl
+  800910:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800913:	39 d8                	cmp    %ebx,%eax
+  800915:	75 ed                	jne    800904 <strncpy+0x14>
+	}
+	return ret;
+}
+  800917:	89 f0                	mov    %esi,%eax
+  800919:	5b                   	pop    %ebx
+  80091a:	5e                   	pop    %esi
+  80091b:	5d                   	pop    %ebp
+  80091c:	c3                   	ret
+
+0080091d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80091d:	55                   	push   %ebp
+  80091e:	89 e5                	mov    %esp,%ebp
+  800920:	56                   	push   %esi
+  800921:	53                   	push   %ebx
+  800922:	8b 75 08             	mov    0x8(%ebp),%esi
+  800925:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800928:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80092b:	89 f0                	mov    %esi,%eax
+  80092d:	85 d2                	test   %edx,%edx
+  80092f:	74 21                	je     800952 <strlcpy+0x35>
+  800931:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800935:	89 f2                	mov    %esi,%edx
+  800937:	eb 09                	jmp    800942 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800939:	83 c1 01             	add    $0x1,%ecx
+  80093c:	83 c2 01             	add    $0x1,%edx
+  80093f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800942:	39 c2                	cmp    %eax,%edx
+  800944:	74 09                	je     80094f <strlcpy+0x32>
+  800946:	0f b6 19             	movzbl (%ecx),%ebx
+  800949:	84 db                	test   %bl,%bl
+  80094b:	75 ec                	jne    800939 <strlcpy+0x1c>
+  80094d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80094f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800952:	29 f0                	sub    %esi,%eax
+}
+  800954:	5b                   	pop    %ebx
+  800955:	5e                   	pop    %esi
+  800956:	5d                   	pop    %ebp
+  800957:	c3                   	ret
+
+00800958 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80095e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800961:	eb 06                	jmp    800969 <strcmp+0x11>
+		p++, q++;
+  800963:	83 c1 01             	add    $0x1,%ecx
+  800966:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800969:	0f b6 01             	movzbl (%ecx),%eax
+  80096c:	84 c0                	test   %al,%al
+  80096e:	74 04                	je     800974 <strcmp+0x1c>
+  800970:	3a 02                	cmp    (%edx),%al
+  800972:	74 ef                	je     800963 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800974:	0f b6 c0             	movzbl %al,%eax
+  800977:	0f b6 12             	movzbl (%edx),%edx
+  80097a:	29 d0                	sub    %edx,%eax
+}
+  80097c:	5d                   	pop    %ebp
+  80097d:	c3                   	ret
+
+0080097e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	53                   	push   %ebx
+  800982:	8b 45 08             	mov    0x8(%ebp),%eax
+  800985:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800988:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80098b:	eb 09                	jmp    800996 <strncmp+0x18>
+		n--, p++, q++;
+  80098d:	83 ea 01             	sub    $0x1,%edx
+  800990:	83 c0 01             	add    $0x1,%eax
+  800993:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800996:	85 d2                	test   %edx,%edx
+  800998:	74 18                	je     8009b2 <strncmp+0x34>
+  80099a:	0f b6 18             	movzbl (%eax),%ebx
+  80099d:	84 db                	test   %bl,%bl
+  80099f:	74 04                	je     8009a5 <strncmp+0x27>
+  8009a1:	3a 19                	cmp    (%ecx),%bl
+  8009a3:	74 e8                	je     80098d <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009a5:	0f b6 00             	movzbl (%eax),%eax
+  8009a8:	0f b6 11             	movzbl (%ecx),%edx
+  8009ab:	29 d0                	sub    %edx,%eax
+}
+  8009ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009b0:	c9                   	leave
+  8009b1:	c3                   	ret
+		return 0;
+  8009b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b7:	eb f4                	jmp    8009ad <strncmp+0x2f>
+
+008009b9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009b9:	55                   	push   %ebp
+  8009ba:	89 e5                	mov    %esp,%ebp
+  8009bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c3:	eb 03                	jmp    8009c8 <strchr+0xf>
+  8009c5:	83 c0 01             	add    $0x1,%eax
+  8009c8:	0f b6 10             	movzbl (%eax),%edx
+  8009cb:	84 d2                	test   %dl,%dl
+  8009cd:	74 06                	je     8009d5 <strchr+0x1c>
+		if (*s == c)
+  8009cf:	38 ca                	cmp    %cl,%dl
+  8009d1:	75 f2                	jne    8009c5 <strchr+0xc>
+  8009d3:	eb 05                	jmp    8009da <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009da:	5d                   	pop    %ebp
+  8009db:	c3                   	ret
+
+008009dc <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009e6:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009e9:	38 ca                	cmp    %cl,%dl
+  8009eb:	74 09                	je     8009f6 <strfind+0x1a>
+  8009ed:	84 d2                	test   %dl,%dl
+  8009ef:	74 05                	je     8009f6 <strfind+0x1a>
+	for (; *s; s++)
+  8009f1:	83 c0 01             	add    $0x1,%eax
+  8009f4:	eb f0                	jmp    8009e6 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	57                   	push   %edi
+  8009fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009ff:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a02:	85 c9                	test   %ecx,%ecx
+  800a04:	74 20                	je     800a26 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a06:	89 f8                	mov    %edi,%eax
+  800a08:	09 c8                	or     %ecx,%eax
+  800a0a:	a8 03                	test   $0x3,%al
+  800a0c:	75 12                	jne    800a20 <memset+0x28>
+		c &= 0xFF;
+  800a0e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a12:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a18:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a1b:	fc                   	cld
+  800a1c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a1e:	eb 06                	jmp    800a26 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a23:	fc                   	cld
+  800a24:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a26:	89 f8                	mov    %edi,%eax
+  800a28:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a2b:	c9                   	leave
+  800a2c:	c3                   	ret
+
+00800a2d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	57                   	push   %edi
+  800a31:	56                   	push   %esi
+  800a32:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a35:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a38:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a3b:	39 c6                	cmp    %eax,%esi
+  800a3d:	73 32                	jae    800a71 <memmove+0x44>
+  800a3f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a42:	39 d0                	cmp    %edx,%eax
+  800a44:	73 2b                	jae    800a71 <memmove+0x44>
+		s += n;
+		d += n;
+  800a46:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a49:	89 d6                	mov    %edx,%esi
+  800a4b:	09 fe                	or     %edi,%esi
+  800a4d:	09 ce                	or     %ecx,%esi
+  800a4f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a55:	75 0e                	jne    800a65 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a57:	83 ef 04             	sub    $0x4,%edi
+  800a5a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a5d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a60:	fd                   	std
+  800a61:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a63:	eb 09                	jmp    800a6e <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a65:	83 ef 01             	sub    $0x1,%edi
+  800a68:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a6b:	fd                   	std
+  800a6c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a6e:	fc                   	cld
+  800a6f:	eb 1a                	jmp    800a8b <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a71:	89 f2                	mov    %esi,%edx
+  800a73:	09 c2                	or     %eax,%edx
+  800a75:	09 ca                	or     %ecx,%edx
+  800a77:	f6 c2 03             	test   $0x3,%dl
+  800a7a:	75 0a                	jne    800a86 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a7c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a7f:	89 c7                	mov    %eax,%edi
+  800a81:	fc                   	cld
+  800a82:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a84:	eb 05                	jmp    800a8b <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a86:	89 c7                	mov    %eax,%edi
+  800a88:	fc                   	cld
+  800a89:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a8b:	5e                   	pop    %esi
+  800a8c:	5f                   	pop    %edi
+  800a8d:	5d                   	pop    %ebp
+  800a8e:	c3                   	ret
+
+00800a8f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a95:	ff 75 10             	push   0x10(%ebp)
+  800a98:	ff 75 0c             	push   0xc(%ebp)
+  800a9b:	ff 75 08             	push   0x8(%ebp)
+  800a9e:	e8 8a ff ff ff       	call   800a2d <memmove>
+}
+  800aa3:	c9                   	leave
+  800aa4:	c3                   	ret
+
+00800aa5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aa5:	55                   	push   %ebp
+  800aa6:	89 e5                	mov    %esp,%ebp
+  800aa8:	56                   	push   %esi
+  800aa9:	53                   	push   %ebx
+  800aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aad:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ab0:	89 c6                	mov    %eax,%esi
+  800ab2:	03 75 10             	add    0x10(%ebp),%esi
+  800ab5:	eb 06                	jmp    800abd <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ab7:	83 c0 01             	add    $0x1,%eax
+  800aba:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800abd:	39 f0                	cmp    %esi,%eax
+  800abf:	74 14                	je     800ad5 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ac1:	0f b6 08             	movzbl (%eax),%ecx
+  800ac4:	0f b6 1a             	movzbl (%edx),%ebx
+  800ac7:	38 d9                	cmp    %bl,%cl
+  800ac9:	74 ec                	je     800ab7 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800acb:	0f b6 c1             	movzbl %cl,%eax
+  800ace:	0f b6 db             	movzbl %bl,%ebx
+  800ad1:	29 d8                	sub    %ebx,%eax
+  800ad3:	eb 05                	jmp    800ada <memcmp+0x35>
+	}
+
+	return 0;
+  800ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ada:	5b                   	pop    %ebx
+  800adb:	5e                   	pop    %esi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ae7:	89 c2                	mov    %eax,%edx
+  800ae9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aec:	eb 03                	jmp    800af1 <memfind+0x13>
+  800aee:	83 c0 01             	add    $0x1,%eax
+  800af1:	39 d0                	cmp    %edx,%eax
+  800af3:	73 04                	jae    800af9 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800af5:	38 08                	cmp    %cl,(%eax)
+  800af7:	75 f5                	jne    800aee <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800af9:	5d                   	pop    %ebp
+  800afa:	c3                   	ret
+
+00800afb <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	57                   	push   %edi
+  800aff:	56                   	push   %esi
+  800b00:	53                   	push   %ebx
+  800b01:	83 ec 1c             	sub    $0x1c,%esp
+  800b04:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b07:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b0a:	eb 03                	jmp    800b0f <strtol+0x14>
+		s++;
+  800b0c:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b0f:	0f b6 06             	movzbl (%esi),%eax
+  800b12:	3c 20                	cmp    $0x20,%al
+  800b14:	74 f6                	je     800b0c <strtol+0x11>
+  800b16:	3c 09                	cmp    $0x9,%al
+  800b18:	74 f2                	je     800b0c <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b1a:	3c 2b                	cmp    $0x2b,%al
+  800b1c:	74 43                	je     800b61 <strtol+0x66>
+	int neg = 0;
+  800b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b23:	3c 2d                	cmp    $0x2d,%al
+  800b25:	74 44                	je     800b6b <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b27:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b2d:	75 0f                	jne    800b3e <strtol+0x43>
+  800b2f:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b32:	74 41                	je     800b75 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b34:	85 ff                	test   %edi,%edi
+  800b36:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b3b:	0f 44 f8             	cmove  %eax,%edi
+  800b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b43:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b48:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b4b:	89 fb                	mov    %edi,%ebx
+  800b4d:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b50:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b53:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b56:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b59:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b5c:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b5f:	eb 67                	jmp    800bc8 <strtol+0xcd>
+		s++;
+  800b61:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b69:	eb bc                	jmp    800b27 <strtol+0x2c>
+		s++, neg = 1;
+  800b6b:	83 c6 01             	add    $0x1,%esi
+  800b6e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b73:	eb b2                	jmp    800b27 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b75:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b79:	74 0e                	je     800b89 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b7b:	85 ff                	test   %edi,%edi
+  800b7d:	75 bf                	jne    800b3e <strtol+0x43>
+		s++, base = 8;
+  800b7f:	83 c6 01             	add    $0x1,%esi
+  800b82:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b87:	eb b5                	jmp    800b3e <strtol+0x43>
+		s += 2, base = 16;
+  800b89:	83 c6 02             	add    $0x2,%esi
+  800b8c:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b91:	eb ab                	jmp    800b3e <strtol+0x43>
+			dig = *s - '0';
+  800b93:	0f be c9             	movsbl %cl,%ecx
+  800b96:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b99:	39 f9                	cmp    %edi,%ecx
+  800b9b:	7d 59                	jge    800bf6 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b9d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800ba1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ba4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ba7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800baa:	0f af d8             	imul   %eax,%ebx
+  800bad:	0f af d7             	imul   %edi,%edx
+  800bb0:	01 d3                	add    %edx,%ebx
+  800bb2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bb5:	f7 e7                	mul    %edi
+  800bb7:	01 da                	add    %ebx,%edx
+  800bb9:	89 cb                	mov    %ecx,%ebx
+  800bbb:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bbe:	01 c8                	add    %ecx,%eax
+  800bc0:	11 da                	adc    %ebx,%edx
+  800bc2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bc5:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800bc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcb:	0f b6 08             	movzbl (%eax),%ecx
+  800bce:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800bd1:	80 fb 09             	cmp    $0x9,%bl
+  800bd4:	76 bd                	jbe    800b93 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800bd6:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800bd9:	80 fb 19             	cmp    $0x19,%bl
+  800bdc:	77 08                	ja     800be6 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800bde:	0f be c9             	movsbl %cl,%ecx
+  800be1:	83 e9 57             	sub    $0x57,%ecx
+  800be4:	eb b3                	jmp    800b99 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800be6:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800be9:	80 fb 19             	cmp    $0x19,%bl
+  800bec:	77 08                	ja     800bf6 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800bee:	0f be c9             	movsbl %cl,%ecx
+  800bf1:	83 e9 37             	sub    $0x37,%ecx
+  800bf4:	eb a3                	jmp    800b99 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bf6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bf9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bfc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c02:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c06:	74 05                	je     800c0d <strtol+0x112>
+		*endptr = (char *) s;
+  800c08:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c0b:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c0d:	85 c9                	test   %ecx,%ecx
+  800c0f:	74 07                	je     800c18 <strtol+0x11d>
+  800c11:	f7 d8                	neg    %eax
+  800c13:	83 d2 00             	adc    $0x0,%edx
+  800c16:	f7 da                	neg    %edx
+}
+  800c18:	83 c4 1c             	add    $0x1c,%esp
+  800c1b:	5b                   	pop    %ebx
+  800c1c:	5e                   	pop    %esi
+  800c1d:	5f                   	pop    %edi
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+
+00800c20 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c26:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c2d:	74 18                	je     800c47 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3a:	89 c3                	mov    %eax,%ebx
+  800c3c:	89 c7                	mov    %eax,%edi
+  800c3e:	89 c6                	mov    %eax,%esi
+  800c40:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c42:	5b                   	pop    %ebx
+  800c43:	5e                   	pop    %esi
+  800c44:	5f                   	pop    %edi
+  800c45:	5d                   	pop    %ebp
+  800c46:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c52:	89 c3                	mov    %eax,%ebx
+  800c54:	89 c7                	mov    %eax,%edi
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	8d 35 61 0c 80 00    	lea    0x800c61,%esi
+  800c5f:	0f 34                	sysenter
+  800c61:	5d                   	pop    %ebp
+		goto out;
+  800c62:	eb de                	jmp    800c42 <sys_cputs+0x22>
+
+00800c64 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	57                   	push   %edi
+  800c68:	56                   	push   %esi
+  800c69:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c6a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c71:	74 19                	je     800c8c <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c78:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c7d:	89 d1                	mov    %edx,%ecx
+  800c7f:	89 d3                	mov    %edx,%ebx
+  800c81:	89 d7                	mov    %edx,%edi
+  800c83:	89 d6                	mov    %edx,%esi
+  800c85:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c87:	5b                   	pop    %ebx
+  800c88:	5e                   	pop    %esi
+  800c89:	5f                   	pop    %edi
+  800c8a:	5d                   	pop    %ebp
+  800c8b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c91:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c96:	89 d1                	mov    %edx,%ecx
+  800c98:	89 d3                	mov    %edx,%ebx
+  800c9a:	89 d7                	mov    %edx,%edi
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	8d 35 a7 0c 80 00    	lea    0x800ca7,%esi
+  800ca5:	0f 34                	sysenter
+  800ca7:	5d                   	pop    %ebp
+		goto out;
+  800ca8:	eb dd                	jmp    800c87 <sys_cgetc+0x23>
+
+00800caa <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	57                   	push   %edi
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+  800cb0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800cb3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cba:	74 21                	je     800cdd <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc1:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc9:	89 cb                	mov    %ecx,%ebx
+  800ccb:	89 cf                	mov    %ecx,%edi
+  800ccd:	89 ce                	mov    %ecx,%esi
+  800ccf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cd1:	85 c0                	test   %eax,%eax
+  800cd3:	7f 27                	jg     800cfc <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd8:	5b                   	pop    %ebx
+  800cd9:	5e                   	pop    %esi
+  800cda:	5f                   	pop    %edi
+  800cdb:	5d                   	pop    %ebp
+  800cdc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cea:	89 cb                	mov    %ecx,%ebx
+  800cec:	89 cf                	mov    %ecx,%edi
+  800cee:	55                   	push   %ebp
+  800cef:	89 e5                	mov    %esp,%ebp
+  800cf1:	8d 35 f9 0c 80 00    	lea    0x800cf9,%esi
+  800cf7:	0f 34                	sysenter
+  800cf9:	5d                   	pop    %ebp
+		goto out;
+  800cfa:	eb d5                	jmp    800cd1 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cfc:	83 ec 0c             	sub    $0xc,%esp
+  800cff:	50                   	push   %eax
+  800d00:	6a 03                	push   $0x3
+  800d02:	68 0b 37 80 00       	push   $0x80370b
+  800d07:	6a 3f                	push   $0x3f
+  800d09:	68 28 37 80 00       	push   $0x803728
+  800d0e:	e8 71 f4 ff ff       	call   800184 <_panic>
+
+00800d13 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d13:	55                   	push   %ebp
+  800d14:	89 e5                	mov    %esp,%ebp
+  800d16:	57                   	push   %edi
+  800d17:	56                   	push   %esi
+  800d18:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d19:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d20:	74 19                	je     800d3b <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d22:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d27:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d2c:	89 d1                	mov    %edx,%ecx
+  800d2e:	89 d3                	mov    %edx,%ebx
+  800d30:	89 d7                	mov    %edx,%edi
+  800d32:	89 d6                	mov    %edx,%esi
+  800d34:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d36:	5b                   	pop    %ebx
+  800d37:	5e                   	pop    %esi
+  800d38:	5f                   	pop    %edi
+  800d39:	5d                   	pop    %ebp
+  800d3a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d40:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d45:	89 d1                	mov    %edx,%ecx
+  800d47:	89 d3                	mov    %edx,%ebx
+  800d49:	89 d7                	mov    %edx,%edi
+  800d4b:	55                   	push   %ebp
+  800d4c:	89 e5                	mov    %esp,%ebp
+  800d4e:	8d 35 56 0d 80 00    	lea    0x800d56,%esi
+  800d54:	0f 34                	sysenter
+  800d56:	5d                   	pop    %ebp
+		goto out;
+  800d57:	eb dd                	jmp    800d36 <sys_getenvid+0x23>
+
+00800d59 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	57                   	push   %edi
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d5f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d66:	74 19                	je     800d81 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d72:	89 d1                	mov    %edx,%ecx
+  800d74:	89 d3                	mov    %edx,%ebx
+  800d76:	89 d7                	mov    %edx,%edi
+  800d78:	89 d6                	mov    %edx,%esi
+  800d7a:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d7c:	5b                   	pop    %ebx
+  800d7d:	5e                   	pop    %esi
+  800d7e:	5f                   	pop    %edi
+  800d7f:	5d                   	pop    %ebp
+  800d80:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d86:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d8b:	89 d1                	mov    %edx,%ecx
+  800d8d:	89 d3                	mov    %edx,%ebx
+  800d8f:	89 d7                	mov    %edx,%edi
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	8d 35 9c 0d 80 00    	lea    0x800d9c,%esi
+  800d9a:	0f 34                	sysenter
+  800d9c:	5d                   	pop    %ebp
+		goto out;
+  800d9d:	eb dd                	jmp    800d7c <sys_yield+0x23>
+
+00800d9f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800da8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800daf:	74 23                	je     800dd4 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800db1:	be 00 00 00 00       	mov    $0x0,%esi
+  800db6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc4:	89 f7                	mov    %esi,%edi
+  800dc6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc8:	85 c0                	test   %eax,%eax
+  800dca:	7f 29                	jg     800df5 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcf:	5b                   	pop    %ebx
+  800dd0:	5e                   	pop    %esi
+  800dd1:	5f                   	pop    %edi
+  800dd2:	5d                   	pop    %ebp
+  800dd3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dda:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ddf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800de4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	8d 35 f2 0d 80 00    	lea    0x800df2,%esi
+  800df0:	0f 34                	sysenter
+  800df2:	5d                   	pop    %ebp
+		goto out;
+  800df3:	eb d3                	jmp    800dc8 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df5:	83 ec 0c             	sub    $0xc,%esp
+  800df8:	50                   	push   %eax
+  800df9:	6a 04                	push   $0x4
+  800dfb:	68 0b 37 80 00       	push   $0x80370b
+  800e00:	6a 3f                	push   $0x3f
+  800e02:	68 28 37 80 00       	push   $0x803728
+  800e07:	e8 78 f3 ff ff       	call   800184 <_panic>
+
+00800e0c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e0c:	55                   	push   %ebp
+  800e0d:	89 e5                	mov    %esp,%ebp
+  800e0f:	57                   	push   %edi
+  800e10:	56                   	push   %esi
+  800e11:	53                   	push   %ebx
+  800e12:	83 ec 0c             	sub    $0xc,%esp
+  800e15:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e18:	85 f6                	test   %esi,%esi
+  800e1a:	75 09                	jne    800e25 <sys_page_map+0x19>
+  800e1c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e23:	74 1f                	je     800e44 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e25:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e33:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e36:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e38:	85 c0                	test   %eax,%eax
+  800e3a:	7f 27                	jg     800e63 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3f:	5b                   	pop    %ebx
+  800e40:	5e                   	pop    %esi
+  800e41:	5f                   	pop    %edi
+  800e42:	5d                   	pop    %ebp
+  800e43:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e52:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	8d 35 60 0e 80 00    	lea    0x800e60,%esi
+  800e5e:	0f 34                	sysenter
+  800e60:	5d                   	pop    %ebp
+		goto out;
+  800e61:	eb d5                	jmp    800e38 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e63:	83 ec 0c             	sub    $0xc,%esp
+  800e66:	50                   	push   %eax
+  800e67:	6a 05                	push   $0x5
+  800e69:	68 0b 37 80 00       	push   $0x80370b
+  800e6e:	6a 3f                	push   $0x3f
+  800e70:	68 28 37 80 00       	push   $0x803728
+  800e75:	e8 0a f3 ff ff       	call   800184 <_panic>
+
+00800e7a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e7a:	55                   	push   %ebp
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	57                   	push   %edi
+  800e7e:	56                   	push   %esi
+  800e7f:	53                   	push   %ebx
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e83:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e8a:	74 22                	je     800eae <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e91:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9c:	89 df                	mov    %ebx,%edi
+  800e9e:	89 de                	mov    %ebx,%esi
+  800ea0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	7f 28                	jg     800ece <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ea6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ebe:	89 df                	mov    %ebx,%edi
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	8d 35 cb 0e 80 00    	lea    0x800ecb,%esi
+  800ec9:	0f 34                	sysenter
+  800ecb:	5d                   	pop    %ebp
+		goto out;
+  800ecc:	eb d4                	jmp    800ea2 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+  800ed1:	50                   	push   %eax
+  800ed2:	6a 06                	push   $0x6
+  800ed4:	68 0b 37 80 00       	push   $0x80370b
+  800ed9:	6a 3f                	push   $0x3f
+  800edb:	68 28 37 80 00       	push   $0x803728
+  800ee0:	e8 9f f2 ff ff       	call   800184 <_panic>
+
+00800ee5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ee5:	55                   	push   %ebp
+  800ee6:	89 e5                	mov    %esp,%ebp
+  800ee8:	57                   	push   %edi
+  800ee9:	56                   	push   %esi
+  800eea:	53                   	push   %ebx
+  800eeb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eee:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ef5:	74 22                	je     800f19 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efc:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f07:	89 df                	mov    %ebx,%edi
+  800f09:	89 de                	mov    %ebx,%esi
+  800f0b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0d:	85 c0                	test   %eax,%eax
+  800f0f:	7f 28                	jg     800f39 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f24:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f29:	89 df                	mov    %ebx,%edi
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	8d 35 36 0f 80 00    	lea    0x800f36,%esi
+  800f34:	0f 34                	sysenter
+  800f36:	5d                   	pop    %ebp
+		goto out;
+  800f37:	eb d4                	jmp    800f0d <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f39:	83 ec 0c             	sub    $0xc,%esp
+  800f3c:	50                   	push   %eax
+  800f3d:	6a 08                	push   $0x8
+  800f3f:	68 0b 37 80 00       	push   $0x80370b
+  800f44:	6a 3f                	push   $0x3f
+  800f46:	68 28 37 80 00       	push   $0x803728
+  800f4b:	e8 34 f2 ff ff       	call   800184 <_panic>
+
+00800f50 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f50:	55                   	push   %ebp
+  800f51:	89 e5                	mov    %esp,%ebp
+  800f53:	57                   	push   %edi
+  800f54:	56                   	push   %esi
+  800f55:	53                   	push   %ebx
+  800f56:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f59:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f60:	74 22                	je     800f84 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f67:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f72:	89 df                	mov    %ebx,%edi
+  800f74:	89 de                	mov    %ebx,%esi
+  800f76:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f78:	85 c0                	test   %eax,%eax
+  800f7a:	7f 28                	jg     800fa4 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7f:	5b                   	pop    %ebx
+  800f80:	5e                   	pop    %esi
+  800f81:	5f                   	pop    %edi
+  800f82:	5d                   	pop    %ebp
+  800f83:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f94:	89 df                	mov    %ebx,%edi
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	8d 35 a1 0f 80 00    	lea    0x800fa1,%esi
+  800f9f:	0f 34                	sysenter
+  800fa1:	5d                   	pop    %ebp
+		goto out;
+  800fa2:	eb d4                	jmp    800f78 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa4:	83 ec 0c             	sub    $0xc,%esp
+  800fa7:	50                   	push   %eax
+  800fa8:	6a 09                	push   $0x9
+  800faa:	68 0b 37 80 00       	push   $0x80370b
+  800faf:	6a 3f                	push   $0x3f
+  800fb1:	68 28 37 80 00       	push   $0x803728
+  800fb6:	e8 c9 f1 ff ff       	call   800184 <_panic>
+
+00800fbb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	57                   	push   %edi
+  800fbf:	56                   	push   %esi
+  800fc0:	53                   	push   %ebx
+  800fc1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fc4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fcb:	74 22                	je     800fef <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800fcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdd:	89 df                	mov    %ebx,%edi
+  800fdf:	89 de                	mov    %ebx,%esi
+  800fe1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe3:	85 c0                	test   %eax,%eax
+  800fe5:	7f 28                	jg     80100f <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fe7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5e                   	pop    %esi
+  800fec:	5f                   	pop    %edi
+  800fed:	5d                   	pop    %ebp
+  800fee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fff:	89 df                	mov    %ebx,%edi
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	8d 35 0c 10 80 00    	lea    0x80100c,%esi
+  80100a:	0f 34                	sysenter
+  80100c:	5d                   	pop    %ebp
+		goto out;
+  80100d:	eb d4                	jmp    800fe3 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100f:	83 ec 0c             	sub    $0xc,%esp
+  801012:	50                   	push   %eax
+  801013:	6a 0a                	push   $0xa
+  801015:	68 0b 37 80 00       	push   $0x80370b
+  80101a:	6a 3f                	push   $0x3f
+  80101c:	68 28 37 80 00       	push   $0x803728
+  801021:	e8 5e f1 ff ff       	call   800184 <_panic>
+
+00801026 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801026:	55                   	push   %ebp
+  801027:	89 e5                	mov    %esp,%ebp
+  801029:	57                   	push   %edi
+  80102a:	56                   	push   %esi
+  80102b:	53                   	push   %ebx
+  80102c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80102f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801036:	74 22                	je     80105a <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801038:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801042:	8b 55 08             	mov    0x8(%ebp),%edx
+  801045:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801048:	89 df                	mov    %ebx,%edi
+  80104a:	89 de                	mov    %ebx,%esi
+  80104c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104e:	85 c0                	test   %eax,%eax
+  801050:	7f 28                	jg     80107a <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801052:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801055:	5b                   	pop    %ebx
+  801056:	5e                   	pop    %esi
+  801057:	5f                   	pop    %edi
+  801058:	5d                   	pop    %ebp
+  801059:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80105a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801065:	b8 17 00 00 00       	mov    $0x17,%eax
+  80106a:	89 df                	mov    %ebx,%edi
+  80106c:	55                   	push   %ebp
+  80106d:	89 e5                	mov    %esp,%ebp
+  80106f:	8d 35 77 10 80 00    	lea    0x801077,%esi
+  801075:	0f 34                	sysenter
+  801077:	5d                   	pop    %ebp
+		goto out;
+  801078:	eb d4                	jmp    80104e <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107a:	83 ec 0c             	sub    $0xc,%esp
+  80107d:	50                   	push   %eax
+  80107e:	6a 17                	push   $0x17
+  801080:	68 0b 37 80 00       	push   $0x80370b
+  801085:	6a 3f                	push   $0x3f
+  801087:	68 28 37 80 00       	push   $0x803728
+  80108c:	e8 f3 f0 ff ff       	call   800184 <_panic>
+
+00801091 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801091:	55                   	push   %ebp
+  801092:	89 e5                	mov    %esp,%ebp
+  801094:	57                   	push   %edi
+  801095:	56                   	push   %esi
+  801096:	53                   	push   %ebx
+  801097:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80109a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010a1:	74 22                	je     8010c5 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a8:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b3:	89 df                	mov    %ebx,%edi
+  8010b5:	89 de                	mov    %ebx,%esi
+  8010b7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b9:	85 c0                	test   %eax,%eax
+  8010bb:	7f 28                	jg     8010e5 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c0:	5b                   	pop    %ebx
+  8010c1:	5e                   	pop    %esi
+  8010c2:	5f                   	pop    %edi
+  8010c3:	5d                   	pop    %ebp
+  8010c4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d0:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010d5:	89 df                	mov    %ebx,%edi
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	8d 35 e2 10 80 00    	lea    0x8010e2,%esi
+  8010e0:	0f 34                	sysenter
+  8010e2:	5d                   	pop    %ebp
+		goto out;
+  8010e3:	eb d4                	jmp    8010b9 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	50                   	push   %eax
+  8010e9:	6a 18                	push   $0x18
+  8010eb:	68 0b 37 80 00       	push   $0x80370b
+  8010f0:	6a 3f                	push   $0x3f
+  8010f2:	68 28 37 80 00       	push   $0x803728
+  8010f7:	e8 88 f0 ff ff       	call   800184 <_panic>
+
+008010fc <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	57                   	push   %edi
+  801100:	56                   	push   %esi
+  801101:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801102:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801109:	74 1d                	je     801128 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80110b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801110:	be 00 00 00 00       	mov    $0x0,%esi
+  801115:	8b 55 08             	mov    0x8(%ebp),%edx
+  801118:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801121:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801123:	5b                   	pop    %ebx
+  801124:	5e                   	pop    %esi
+  801125:	5f                   	pop    %edi
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801128:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801133:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801136:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	8d 35 44 11 80 00    	lea    0x801144,%esi
+  801142:	0f 34                	sysenter
+  801144:	5d                   	pop    %ebp
+		goto out;
+  801145:	eb dc                	jmp    801123 <sys_ipc_try_send+0x27>
+
+00801147 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801147:	55                   	push   %ebp
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	57                   	push   %edi
+  80114b:	56                   	push   %esi
+  80114c:	53                   	push   %ebx
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801150:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801157:	74 21                	je     80117a <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801159:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80115e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801163:	8b 55 08             	mov    0x8(%ebp),%edx
+  801166:	89 cb                	mov    %ecx,%ebx
+  801168:	89 cf                	mov    %ecx,%edi
+  80116a:	89 ce                	mov    %ecx,%esi
+  80116c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	7f 27                	jg     801199 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80117a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801182:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801187:	89 cb                	mov    %ecx,%ebx
+  801189:	89 cf                	mov    %ecx,%edi
+  80118b:	55                   	push   %ebp
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	8d 35 96 11 80 00    	lea    0x801196,%esi
+  801194:	0f 34                	sysenter
+  801196:	5d                   	pop    %ebp
+		goto out;
+  801197:	eb d5                	jmp    80116e <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801199:	83 ec 0c             	sub    $0xc,%esp
+  80119c:	50                   	push   %eax
+  80119d:	6a 0d                	push   $0xd
+  80119f:	68 0b 37 80 00       	push   $0x80370b
+  8011a4:	6a 3f                	push   $0x3f
+  8011a6:	68 28 37 80 00       	push   $0x803728
+  8011ab:	e8 d4 ef ff ff       	call   800184 <_panic>
+
+008011b0 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	57                   	push   %edi
+  8011b4:	56                   	push   %esi
+  8011b5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011b6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011bd:	74 1b                	je     8011da <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cf:	89 df                	mov    %ebx,%edi
+  8011d1:	89 de                	mov    %ebx,%esi
+  8011d3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011d5:	5b                   	pop    %ebx
+  8011d6:	5e                   	pop    %esi
+  8011d7:	5f                   	pop    %edi
+  8011d8:	5d                   	pop    %ebp
+  8011d9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ea:	89 df                	mov    %ebx,%edi
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	8d 35 f7 11 80 00    	lea    0x8011f7,%esi
+  8011f5:	0f 34                	sysenter
+  8011f7:	5d                   	pop    %ebp
+		goto out;
+  8011f8:	eb db                	jmp    8011d5 <sys_ipc_recv_until+0x25>
+
+008011fa <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	57                   	push   %edi
+  8011fe:	56                   	push   %esi
+  8011ff:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801200:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801207:	74 19                	je     801222 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801213:	89 d1                	mov    %edx,%ecx
+  801215:	89 d3                	mov    %edx,%ebx
+  801217:	89 d7                	mov    %edx,%edi
+  801219:	89 d6                	mov    %edx,%esi
+  80121b:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80121d:	5b                   	pop    %ebx
+  80121e:	5e                   	pop    %esi
+  80121f:	5f                   	pop    %edi
+  801220:	5d                   	pop    %ebp
+  801221:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801222:	ba 00 00 00 00       	mov    $0x0,%edx
+  801227:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80122c:	89 d1                	mov    %edx,%ecx
+  80122e:	89 d3                	mov    %edx,%ebx
+  801230:	89 d7                	mov    %edx,%edi
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	8d 35 3d 12 80 00    	lea    0x80123d,%esi
+  80123b:	0f 34                	sysenter
+  80123d:	5d                   	pop    %ebp
+		goto out;
+  80123e:	eb dd                	jmp    80121d <sys_time_msec+0x23>
+
+00801240 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	57                   	push   %edi
+  801244:	56                   	push   %esi
+  801245:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801246:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80124d:	74 1a                	je     801269 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80124f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801254:	b8 10 00 00 00       	mov    $0x10,%eax
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	89 cb                	mov    %ecx,%ebx
+  80125e:	89 cf                	mov    %ecx,%edi
+  801260:	89 ce                	mov    %ecx,%esi
+  801262:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801269:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801271:	b8 10 00 00 00       	mov    $0x10,%eax
+  801276:	89 cb                	mov    %ecx,%ebx
+  801278:	89 cf                	mov    %ecx,%edi
+  80127a:	55                   	push   %ebp
+  80127b:	89 e5                	mov    %esp,%ebp
+  80127d:	8d 35 85 12 80 00    	lea    0x801285,%esi
+  801283:	0f 34                	sysenter
+  801285:	5d                   	pop    %ebp
+		goto out;
+  801286:	eb dc                	jmp    801264 <sys_sleep_until+0x24>
+
+00801288 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801288:	55                   	push   %ebp
+  801289:	89 e5                	mov    %esp,%ebp
+  80128b:	57                   	push   %edi
+  80128c:	56                   	push   %esi
+  80128d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80128e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801295:	74 1a                	je     8012b1 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801297:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80129c:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a4:	89 cb                	mov    %ecx,%ebx
+  8012a6:	89 cf                	mov    %ecx,%edi
+  8012a8:	89 ce                	mov    %ecx,%esi
+  8012aa:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012ac:	5b                   	pop    %ebx
+  8012ad:	5e                   	pop    %esi
+  8012ae:	5f                   	pop    %edi
+  8012af:	5d                   	pop    %ebp
+  8012b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b9:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012be:	89 cb                	mov    %ecx,%ebx
+  8012c0:	89 cf                	mov    %ecx,%edi
+  8012c2:	55                   	push   %ebp
+  8012c3:	89 e5                	mov    %esp,%ebp
+  8012c5:	8d 35 cd 12 80 00    	lea    0x8012cd,%esi
+  8012cb:	0f 34                	sysenter
+  8012cd:	5d                   	pop    %ebp
+		goto out;
+  8012ce:	eb dc                	jmp    8012ac <sys_env_print_stats+0x24>
+
+008012d0 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	57                   	push   %edi
+  8012d4:	56                   	push   %esi
+  8012d5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012d6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012dd:	74 1b                	je     8012fa <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ef:	89 df                	mov    %ebx,%edi
+  8012f1:	89 de                	mov    %ebx,%esi
+  8012f3:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012f5:	5b                   	pop    %ebx
+  8012f6:	5e                   	pop    %esi
+  8012f7:	5f                   	pop    %edi
+  8012f8:	5d                   	pop    %ebp
+  8012f9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801302:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801305:	b8 19 00 00 00       	mov    $0x19,%eax
+  80130a:	89 df                	mov    %ebx,%edi
+  80130c:	55                   	push   %ebp
+  80130d:	89 e5                	mov    %esp,%ebp
+  80130f:	8d 35 17 13 80 00    	lea    0x801317,%esi
+  801315:	0f 34                	sysenter
+  801317:	5d                   	pop    %ebp
+		goto out;
+  801318:	eb db                	jmp    8012f5 <sys_perf+0x25>
+
+0080131a <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80131a:	55                   	push   %ebp
+  80131b:	89 e5                	mov    %esp,%ebp
+  80131d:	57                   	push   %edi
+  80131e:	56                   	push   %esi
+  80131f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801320:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801327:	74 19                	je     801342 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801329:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801333:	89 d1                	mov    %edx,%ecx
+  801335:	89 d3                	mov    %edx,%ebx
+  801337:	89 d7                	mov    %edx,%edi
+  801339:	89 d6                	mov    %edx,%esi
+  80133b:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80133d:	5b                   	pop    %ebx
+  80133e:	5e                   	pop    %esi
+  80133f:	5f                   	pop    %edi
+  801340:	5d                   	pop    %ebp
+  801341:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801342:	ba 00 00 00 00       	mov    $0x0,%edx
+  801347:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80134c:	89 d1                	mov    %edx,%ecx
+  80134e:	89 d3                	mov    %edx,%ebx
+  801350:	89 d7                	mov    %edx,%edi
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	8d 35 5d 13 80 00    	lea    0x80135d,%esi
+  80135b:	0f 34                	sysenter
+  80135d:	5d                   	pop    %ebp
+		goto out;
+  80135e:	eb dd                	jmp    80133d <sys_fork+0x23>
+
+00801360 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801360:	55                   	push   %ebp
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	57                   	push   %edi
+  801364:	56                   	push   %esi
+  801365:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801366:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80136d:	74 1c                	je     80138b <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80136f:	be 00 00 00 00       	mov    $0x0,%esi
+  801374:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801379:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801382:	89 f7                	mov    %esi,%edi
+  801384:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80138b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801391:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801396:	bf 00 00 00 00       	mov    $0x0,%edi
+  80139b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139e:	55                   	push   %ebp
+  80139f:	89 e5                	mov    %esp,%ebp
+  8013a1:	8d 35 a9 13 80 00    	lea    0x8013a9,%esi
+  8013a7:	0f 34                	sysenter
+  8013a9:	5d                   	pop    %ebp
+		goto out;
+  8013aa:	eb da                	jmp    801386 <sys_thread_create+0x26>
+
+008013ac <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	57                   	push   %edi
+  8013b0:	56                   	push   %esi
+  8013b1:	53                   	push   %ebx
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013b5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013bc:	74 24                	je     8013e2 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013be:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013d6:	85 c0                	test   %eax,%eax
+  8013d8:	7f 27                	jg     801401 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013dd:	5b                   	pop    %ebx
+  8013de:	5e                   	pop    %esi
+  8013df:	5f                   	pop    %edi
+  8013e0:	5d                   	pop    %ebp
+  8013e1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f3:	55                   	push   %ebp
+  8013f4:	89 e5                	mov    %esp,%ebp
+  8013f6:	8d 35 fe 13 80 00    	lea    0x8013fe,%esi
+  8013fc:	0f 34                	sysenter
+  8013fe:	5d                   	pop    %ebp
+		goto out;
+  8013ff:	eb d5                	jmp    8013d6 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801401:	83 ec 0c             	sub    $0xc,%esp
+  801404:	50                   	push   %eax
+  801405:	6a 1f                	push   $0x1f
+  801407:	68 0b 37 80 00       	push   $0x80370b
+  80140c:	6a 3f                	push   $0x3f
+  80140e:	68 28 37 80 00       	push   $0x803728
+  801413:	e8 6c ed ff ff       	call   800184 <_panic>
+
+00801418 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+  80141b:	57                   	push   %edi
+  80141c:	56                   	push   %esi
+  80141d:	53                   	push   %ebx
+  80141e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801421:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801428:	74 23                	je     80144d <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80142a:	be 00 00 00 00       	mov    $0x0,%esi
+  80142f:	b8 20 00 00 00       	mov    $0x20,%eax
+  801434:	8b 55 08             	mov    0x8(%ebp),%edx
+  801437:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143d:	89 f7                	mov    %esi,%edi
+  80143f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801441:	85 c0                	test   %eax,%eax
+  801443:	7f 29                	jg     80146e <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801445:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801448:	5b                   	pop    %ebx
+  801449:	5e                   	pop    %esi
+  80144a:	5f                   	pop    %edi
+  80144b:	5d                   	pop    %ebp
+  80144c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80144d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801450:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801453:	b8 20 00 00 00       	mov    $0x20,%eax
+  801458:	bf 00 00 00 00       	mov    $0x0,%edi
+  80145d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	8d 35 6b 14 80 00    	lea    0x80146b,%esi
+  801469:	0f 34                	sysenter
+  80146b:	5d                   	pop    %ebp
+		goto out;
+  80146c:	eb d3                	jmp    801441 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80146e:	83 ec 0c             	sub    $0xc,%esp
+  801471:	50                   	push   %eax
+  801472:	6a 20                	push   $0x20
+  801474:	68 0b 37 80 00       	push   $0x80370b
+  801479:	6a 3f                	push   $0x3f
+  80147b:	68 28 37 80 00       	push   $0x803728
+  801480:	e8 ff ec ff ff       	call   800184 <_panic>
+
+00801485 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	57                   	push   %edi
+  801489:	56                   	push   %esi
+  80148a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80148b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801492:	74 1b                	je     8014af <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801499:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80149e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a4:	89 df                	mov    %ebx,%edi
+  8014a6:	89 de                	mov    %ebx,%esi
+  8014a8:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014aa:	5b                   	pop    %ebx
+  8014ab:	5e                   	pop    %esi
+  8014ac:	5f                   	pop    %edi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ba:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014bf:	89 df                	mov    %ebx,%edi
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	8d 35 cc 14 80 00    	lea    0x8014cc,%esi
+  8014ca:	0f 34                	sysenter
+  8014cc:	5d                   	pop    %ebp
+		goto out;
+  8014cd:	eb db                	jmp    8014aa <sys_batch+0x25>
+
+008014cf <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	57                   	push   %edi
+  8014d3:	56                   	push   %esi
+  8014d4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014d5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014dc:	74 1a                	je     8014f8 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8014de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014eb:	89 cb                	mov    %ecx,%ebx
+  8014ed:	89 cf                	mov    %ecx,%edi
+  8014ef:	89 ce                	mov    %ecx,%esi
+  8014f1:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014f3:	5b                   	pop    %ebx
+  8014f4:	5e                   	pop    %esi
+  8014f5:	5f                   	pop    %edi
+  8014f6:	5d                   	pop    %ebp
+  8014f7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801500:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801505:	89 cb                	mov    %ecx,%ebx
+  801507:	89 cf                	mov    %ecx,%edi
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  80150c:	8d 35 14 15 80 00    	lea    0x801514,%esi
+  801512:	0f 34                	sysenter
+  801514:	5d                   	pop    %ebp
+		goto out;
+  801515:	eb dc                	jmp    8014f3 <sys_trace_ctl+0x24>
+
+00801517 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801517:	55                   	push   %ebp
+  801518:	89 e5                	mov    %esp,%ebp
+  80151a:	57                   	push   %edi
+  80151b:	56                   	push   %esi
+  80151c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80151d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801524:	74 1c                	je     801542 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801526:	be 00 00 00 00       	mov    $0x0,%esi
+  80152b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801530:	8b 55 08             	mov    0x8(%ebp),%edx
+  801533:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801536:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801539:	89 f7                	mov    %esi,%edi
+  80153b:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80153d:	5b                   	pop    %ebx
+  80153e:	5e                   	pop    %esi
+  80153f:	5f                   	pop    %edi
+  801540:	5d                   	pop    %ebp
+  801541:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801542:	8b 55 08             	mov    0x8(%ebp),%edx
+  801545:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801548:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80154d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801552:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801555:	55                   	push   %ebp
+  801556:	89 e5                	mov    %esp,%ebp
+  801558:	8d 35 60 15 80 00    	lea    0x801560,%esi
+  80155e:	0f 34                	sysenter
+  801560:	5d                   	pop    %ebp
+		goto out;
+  801561:	eb da                	jmp    80153d <sys_trace_read+0x26>
+
+00801563 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801563:	55                   	push   %ebp
+  801564:	89 e5                	mov    %esp,%ebp
+  801566:	57                   	push   %edi
+  801567:	56                   	push   %esi
+  801568:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801569:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801570:	74 1c                	je     80158e <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801572:	be 00 00 00 00       	mov    $0x0,%esi
+  801577:	b8 21 00 00 00       	mov    $0x21,%eax
+  80157c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801582:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801585:	89 f7                	mov    %esi,%edi
+  801587:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801589:	5b                   	pop    %ebx
+  80158a:	5e                   	pop    %esi
+  80158b:	5f                   	pop    %edi
+  80158c:	5d                   	pop    %ebp
+  80158d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80158e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801591:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801594:	b8 21 00 00 00       	mov    $0x21,%eax
+  801599:	bf 00 00 00 00       	mov    $0x0,%edi
+  80159e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a1:	55                   	push   %ebp
+  8015a2:	89 e5                	mov    %esp,%ebp
+  8015a4:	8d 35 ac 15 80 00    	lea    0x8015ac,%esi
+  8015aa:	0f 34                	sysenter
+  8015ac:	5d                   	pop    %ebp
+		goto out;
+  8015ad:	eb da                	jmp    801589 <sys_meminfo+0x26>
+
+008015af <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	57                   	push   %edi
+  8015b3:	56                   	push   %esi
+  8015b4:	53                   	push   %ebx
+  8015b5:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015b8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015bc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015c3:	74 1f                	je     8015e4 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ca:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d2:	89 df                	mov    %ebx,%edi
+  8015d4:	89 de                	mov    %ebx,%esi
+  8015d6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015d8:	85 c0                	test   %eax,%eax
+  8015da:	7f 25                	jg     801601 <sys_env_set_ksm+0x52>
+}
+  8015dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015df:	5b                   	pop    %ebx
+  8015e0:	5e                   	pop    %esi
+  8015e1:	5f                   	pop    %edi
+  8015e2:	5d                   	pop    %ebp
+  8015e3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ec:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015f1:	89 df                	mov    %ebx,%edi
+  8015f3:	55                   	push   %ebp
+  8015f4:	89 e5                	mov    %esp,%ebp
+  8015f6:	8d 35 fe 15 80 00    	lea    0x8015fe,%esi
+  8015fc:	0f 34                	sysenter
+  8015fe:	5d                   	pop    %ebp
+		goto out;
+  8015ff:	eb d7                	jmp    8015d8 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801601:	83 ec 0c             	sub    $0xc,%esp
+  801604:	50                   	push   %eax
+  801605:	6a 22                	push   $0x22
+  801607:	68 0b 37 80 00       	push   $0x80370b
+  80160c:	6a 3f                	push   $0x3f
+  80160e:	68 28 37 80 00       	push   $0x803728
+  801613:	e8 6c eb ff ff       	call   800184 <_panic>
+
+00801618 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801618:	55                   	push   %ebp
+  801619:	89 e5                	mov    %esp,%ebp
+  80161b:	57                   	push   %edi
+  80161c:	56                   	push   %esi
+  80161d:	53                   	push   %ebx
+  80161e:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801621:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801624:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80162b:	74 24                	je     801651 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80162d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801632:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801637:	89 cb                	mov    %ecx,%ebx
+  801639:	89 cf                	mov    %ecx,%edi
+  80163b:	89 ce                	mov    %ecx,%esi
+  80163d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80163f:	85 c0                	test   %eax,%eax
+  801641:	7f 2a                	jg     80166d <sys_time_nsec+0x55>
+	return ns;
+}
+  801643:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801646:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164c:	5b                   	pop    %ebx
+  80164d:	5e                   	pop    %esi
+  80164e:	5f                   	pop    %edi
+  80164f:	5d                   	pop    %ebp
+  801650:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801651:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801656:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80165b:	89 cb                	mov    %ecx,%ebx
+  80165d:	89 cf                	mov    %ecx,%edi
+  80165f:	55                   	push   %ebp
+  801660:	89 e5                	mov    %esp,%ebp
+  801662:	8d 35 6a 16 80 00    	lea    0x80166a,%esi
+  801668:	0f 34                	sysenter
+  80166a:	5d                   	pop    %ebp
+		goto out;
+  80166b:	eb d2                	jmp    80163f <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80166d:	83 ec 0c             	sub    $0xc,%esp
+  801670:	50                   	push   %eax
+  801671:	6a 0f                	push   $0xf
+  801673:	68 0b 37 80 00       	push   $0x80370b
+  801678:	6a 3f                	push   $0x3f
+  80167a:	68 28 37 80 00       	push   $0x803728
+  80167f:	e8 00 eb ff ff       	call   800184 <_panic>
+
+00801684 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801684:	55                   	push   %ebp
+  801685:	89 e5                	mov    %esp,%ebp
+  801687:	57                   	push   %edi
+  801688:	56                   	push   %esi
+  801689:	53                   	push   %ebx
+  80168a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80168d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801694:	74 22                	je     8016b8 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801696:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169b:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a6:	89 df                	mov    %ebx,%edi
+  8016a8:	89 de                	mov    %ebx,%esi
+  8016aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	7f 28                	jg     8016d8 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b3:	5b                   	pop    %ebx
+  8016b4:	5e                   	pop    %esi
+  8016b5:	5f                   	pop    %edi
+  8016b6:	5d                   	pop    %ebp
+  8016b7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c3:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016c8:	89 df                	mov    %ebx,%edi
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	8d 35 d5 16 80 00    	lea    0x8016d5,%esi
+  8016d3:	0f 34                	sysenter
+  8016d5:	5d                   	pop    %ebp
+		goto out;
+  8016d6:	eb d4                	jmp    8016ac <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d8:	83 ec 0c             	sub    $0xc,%esp
+  8016db:	50                   	push   %eax
+  8016dc:	6a 12                	push   $0x12
+  8016de:	68 0b 37 80 00       	push   $0x80370b
+  8016e3:	6a 3f                	push   $0x3f
+  8016e5:	68 28 37 80 00       	push   $0x803728
+  8016ea:	e8 95 ea ff ff       	call   800184 <_panic>
+
+008016ef <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	57                   	push   %edi
+  8016f3:	56                   	push   %esi
+  8016f4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016fc:	74 1b                	je     801719 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8016fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801703:	b8 13 00 00 00       	mov    $0x13,%eax
+  801708:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170e:	89 df                	mov    %ebx,%edi
+  801710:	89 de                	mov    %ebx,%esi
+  801712:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801714:	5b                   	pop    %ebx
+  801715:	5e                   	pop    %esi
+  801716:	5f                   	pop    %edi
+  801717:	5d                   	pop    %ebp
+  801718:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801719:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801721:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801724:	b8 13 00 00 00       	mov    $0x13,%eax
+  801729:	89 df                	mov    %ebx,%edi
+  80172b:	55                   	push   %ebp
+  80172c:	89 e5                	mov    %esp,%ebp
+  80172e:	8d 35 36 17 80 00    	lea    0x801736,%esi
+  801734:	0f 34                	sysenter
+  801736:	5d                   	pop    %ebp
+		goto out;
+  801737:	eb db                	jmp    801714 <sys_e1000_receive+0x25>
+
+00801739 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801739:	55                   	push   %ebp
+  80173a:	89 e5                	mov    %esp,%ebp
+  80173c:	57                   	push   %edi
+  80173d:	56                   	push   %esi
+  80173e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80173f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801746:	74 1b                	je     801763 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801748:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801752:	8b 55 08             	mov    0x8(%ebp),%edx
+  801755:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801758:	89 df                	mov    %ebx,%edi
+  80175a:	89 de                	mov    %ebx,%esi
+  80175c:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80175e:	5b                   	pop    %ebx
+  80175f:	5e                   	pop    %esi
+  801760:	5f                   	pop    %edi
+  801761:	5d                   	pop    %ebp
+  801762:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801763:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801768:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801773:	89 df                	mov    %ebx,%edi
+  801775:	55                   	push   %ebp
+  801776:	89 e5                	mov    %esp,%ebp
+  801778:	8d 35 80 17 80 00    	lea    0x801780,%esi
+  80177e:	0f 34                	sysenter
+  801780:	5d                   	pop    %ebp
+		goto out;
+  801781:	eb db                	jmp    80175e <sys_e1000_read_hwaddr+0x25>
+
+00801783 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801783:	55                   	push   %ebp
+  801784:	89 e5                	mov    %esp,%ebp
+  801786:	57                   	push   %edi
+  801787:	56                   	push   %esi
+  801788:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801789:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801790:	74 1a                	je     8017ac <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801792:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801797:	b8 15 00 00 00       	mov    $0x15,%eax
+  80179c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179f:	89 cb                	mov    %ecx,%ebx
+  8017a1:	89 cf                	mov    %ecx,%edi
+  8017a3:	89 ce                	mov    %ecx,%esi
+  8017a5:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017a7:	5b                   	pop    %ebx
+  8017a8:	5e                   	pop    %esi
+  8017a9:	5f                   	pop    %edi
+  8017aa:	5d                   	pop    %ebp
+  8017ab:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b4:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017b9:	89 cb                	mov    %ecx,%ebx
+  8017bb:	89 cf                	mov    %ecx,%edi
+  8017bd:	55                   	push   %ebp
+  8017be:	89 e5                	mov    %esp,%ebp
+  8017c0:	8d 35 c8 17 80 00    	lea    0x8017c8,%esi
+  8017c6:	0f 34                	sysenter
+  8017c8:	5d                   	pop    %ebp
+		goto out;
+  8017c9:	eb dc                	jmp    8017a7 <sys_sb16_read_version+0x24>
+
+008017cb <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017cb:	55                   	push   %ebp
+  8017cc:	89 e5                	mov    %esp,%ebp
+  8017ce:	57                   	push   %edi
+  8017cf:	56                   	push   %esi
+  8017d0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017d1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017d8:	74 1b                	je     8017f5 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017df:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ea:	89 df                	mov    %ebx,%edi
+  8017ec:	89 de                	mov    %ebx,%esi
+  8017ee:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017f0:	5b                   	pop    %ebx
+  8017f1:	5e                   	pop    %esi
+  8017f2:	5f                   	pop    %edi
+  8017f3:	5d                   	pop    %ebp
+  8017f4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801800:	b8 16 00 00 00       	mov    $0x16,%eax
+  801805:	89 df                	mov    %ebx,%edi
+  801807:	55                   	push   %ebp
+  801808:	89 e5                	mov    %esp,%ebp
+  80180a:	8d 35 12 18 80 00    	lea    0x801812,%esi
+  801810:	0f 34                	sysenter
+  801812:	5d                   	pop    %ebp
+		goto out;
+  801813:	eb db                	jmp    8017f0 <sys_sb16_play+0x25>
+
+00801815 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	53                   	push   %ebx
+  801819:	83 ec 04             	sub    $0x4,%esp
+  80181c:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  80181e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801825:	f6 c4 04             	test   $0x4,%ah
+  801828:	74 0c                	je     801836 <dupperm+0x21>
+  80182a:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801831:	f6 c4 08             	test   $0x8,%ah
+  801834:	75 62                	jne    801898 <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801836:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  80183d:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801842:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801848:	74 19                	je     801863 <dupperm+0x4e>
+  80184a:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801851:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801856:	83 f8 01             	cmp    $0x1,%eax
+  801859:	19 c0                	sbb    %eax,%eax
+  80185b:	25 00 08 00 00       	and    $0x800,%eax
+  801860:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801863:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  80186a:	89 c1                	mov    %eax,%ecx
+  80186c:	80 cd 04             	or     $0x4,%ch
+  80186f:	f6 c7 04             	test   $0x4,%bh
+  801872:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801875:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80187c:	f6 c1 02             	test   $0x2,%cl
+  80187f:	74 12                	je     801893 <dupperm+0x7e>
+  801881:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801888:	89 c2                	mov    %eax,%edx
+  80188a:	83 ca 02             	or     $0x2,%edx
+  80188d:	f6 c5 04             	test   $0x4,%ch
+  801890:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801893:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801896:	c9                   	leave
+  801897:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801898:	68 38 37 80 00       	push   $0x803738
+  80189d:	68 d0 37 80 00       	push   $0x8037d0
+  8018a2:	6a 39                	push   $0x39
+  8018a4:	68 e5 37 80 00       	push   $0x8037e5
+  8018a9:	e8 d6 e8 ff ff       	call   800184 <_panic>
+
+008018ae <pgfault>:
+{
+  8018ae:	55                   	push   %ebp
+  8018af:	89 e5                	mov    %esp,%ebp
+  8018b1:	53                   	push   %ebx
+  8018b2:	83 ec 04             	sub    $0x4,%esp
+  8018b5:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8018b8:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8018ba:	89 c3                	mov    %eax,%ebx
+  8018bc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8018c2:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8018c6:	74 6d                	je     801935 <pgfault+0x87>
+  8018c8:	89 da                	mov    %ebx,%edx
+  8018ca:	c1 ea 16             	shr    $0x16,%edx
+  8018cd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018d4:	f6 c2 80             	test   $0x80,%dl
+  8018d7:	75 5c                	jne    801935 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8018d9:	c1 e8 0c             	shr    $0xc,%eax
+  8018dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8018e3:	f6 c4 08             	test   $0x8,%ah
+  8018e6:	74 4d                	je     801935 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8018e8:	83 ec 04             	sub    $0x4,%esp
+  8018eb:	6a 07                	push   $0x7
+  8018ed:	68 00 f0 7f 00       	push   $0x7ff000
+  8018f2:	6a 00                	push   $0x0
+  8018f4:	e8 a6 f4 ff ff       	call   800d9f <sys_page_alloc>
+  8018f9:	83 c4 10             	add    $0x10,%esp
+  8018fc:	85 c0                	test   %eax,%eax
+  8018fe:	78 49                	js     801949 <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801900:	83 ec 04             	sub    $0x4,%esp
+  801903:	68 00 10 00 00       	push   $0x1000
+  801908:	53                   	push   %ebx
+  801909:	68 00 f0 7f 00       	push   $0x7ff000
+  80190e:	e8 1a f1 ff ff       	call   800a2d <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801913:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80191a:	53                   	push   %ebx
+  80191b:	6a 00                	push   $0x0
+  80191d:	68 00 f0 7f 00       	push   $0x7ff000
+  801922:	6a 00                	push   $0x0
+  801924:	e8 e3 f4 ff ff       	call   800e0c <sys_page_map>
+  801929:	83 c4 20             	add    $0x20,%esp
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	78 2d                	js     80195d <pgfault+0xaf>
+}
+  801930:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801933:	c9                   	leave
+  801934:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801935:	83 ec 04             	sub    $0x4,%esp
+  801938:	68 f0 37 80 00       	push   $0x8037f0
+  80193d:	6a 1e                	push   $0x1e
+  80193f:	68 e5 37 80 00       	push   $0x8037e5
+  801944:	e8 3b e8 ff ff       	call   800184 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801949:	83 ec 04             	sub    $0x4,%esp
+  80194c:	68 6c 37 80 00       	push   $0x80376c
+  801951:	6a 29                	push   $0x29
+  801953:	68 e5 37 80 00       	push   $0x8037e5
+  801958:	e8 27 e8 ff ff       	call   800184 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  80195d:	50                   	push   %eax
+  80195e:	68 a0 37 80 00       	push   $0x8037a0
+  801963:	6a 2e                	push   $0x2e
+  801965:	68 e5 37 80 00       	push   $0x8037e5
+  80196a:	e8 15 e8 ff ff       	call   800184 <_panic>
+
+0080196f <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  80196f:	55                   	push   %ebp
+  801970:	89 e5                	mov    %esp,%ebp
+  801972:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801975:	ff 75 0c             	push   0xc(%ebp)
+  801978:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80197b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801982:	e8 23 f3 ff ff       	call   800caa <sys_env_destroy>
+}
+  801987:	83 c4 10             	add    $0x10,%esp
+  80198a:	c9                   	leave
+  80198b:	c3                   	ret
+
+0080198c <ufork>:
+{
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	57                   	push   %edi
+  801990:	56                   	push   %esi
+  801991:	53                   	push   %ebx
+  801992:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801998:	b8 07 00 00 00       	mov    $0x7,%eax
+  80199d:	cd 30                	int    $0x30
+  80199f:	89 c6                	mov    %eax,%esi
+  8019a1:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  8019a7:	85 c0                	test   %eax,%eax
+  8019a9:	78 56                	js     801a01 <ufork+0x75>
+	if (pid > 0) {
+  8019ab:	0f 8e b3 02 00 00    	jle    801c64 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  8019b1:	83 ec 0c             	sub    $0xc,%esp
+  8019b4:	68 ae 18 80 00       	push   $0x8018ae
+  8019b9:	e8 d8 18 00 00       	call   803296 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  8019be:	83 c4 08             	add    $0x8,%esp
+  8019c1:	68 fd 32 80 00       	push   $0x8032fd
+  8019c6:	56                   	push   %esi
+  8019c7:	e8 ef f5 ff ff       	call   800fbb <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  8019cc:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  8019d2:	89 1c 24             	mov    %ebx,(%esp)
+  8019d5:	e8 a1 04 00 00       	call   801e7b <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  8019da:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8019e1:	6a 07                	push   $0x7
+  8019e3:	68 00 f0 bf ee       	push   $0xeebff000
+  8019e8:	56                   	push   %esi
+  8019e9:	53                   	push   %ebx
+  8019ea:	e8 0d 06 00 00       	call   801ffc <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  8019ef:	83 c4 20             	add    $0x20,%esp
+  8019f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f7:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  8019fd:	89 fe                	mov    %edi,%esi
+  8019ff:	eb 22                	jmp    801a23 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801a01:	50                   	push   %eax
+  801a02:	68 09 38 80 00       	push   $0x803809
+  801a07:	68 a9 00 00 00       	push   $0xa9
+  801a0c:	68 e5 37 80 00       	push   $0x8037e5
+  801a11:	e8 6e e7 ff ff       	call   800184 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801a16:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801a1c:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801a21:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a23:	89 f7                	mov    %esi,%edi
+  801a25:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801a2b:	0f 87 e9 01 00 00    	ja     801c1a <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801a31:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801a37:	85 f6                	test   %esi,%esi
+  801a39:	0f 49 d6             	cmovns %esi,%edx
+  801a3c:	c1 fa 0a             	sar    $0xa,%edx
+  801a3f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801a46:	f6 c1 01             	test   $0x1,%cl
+  801a49:	74 cb                	je     801a16 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801a4b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a52:	f6 c2 80             	test   $0x80,%dl
+  801a55:	75 17                	jne    801a6e <ufork+0xe2>
+			j = i + 1;
+  801a57:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801a5a:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801a61:	f6 c2 01             	test   $0x1,%dl
+  801a64:	0f 85 f3 00 00 00    	jne    801b5d <ufork+0x1d1>
+			j = i + 1;
+  801a6a:	89 de                	mov    %ebx,%esi
+  801a6c:	eb b5                	jmp    801a23 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801a6e:	89 fb                	mov    %edi,%ebx
+  801a70:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801a73:	89 d8                	mov    %ebx,%eax
+  801a75:	c1 e8 16             	shr    $0x16,%eax
+  801a78:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a7f:	89 c2                	mov    %eax,%edx
+  801a81:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801a87:	25 02 04 00 00       	and    $0x402,%eax
+  801a8c:	83 f8 02             	cmp    $0x2,%eax
+  801a8f:	74 31                	je     801ac2 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801a91:	83 ec 04             	sub    $0x4,%esp
+  801a94:	6a 01                	push   $0x1
+  801a96:	52                   	push   %edx
+  801a97:	53                   	push   %ebx
+  801a98:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801a9e:	53                   	push   %ebx
+  801a9f:	6a 00                	push   $0x0
+  801aa1:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801aa7:	50                   	push   %eax
+  801aa8:	e8 7a 05 00 00       	call   802027 <batch_map>
+		return;
+  801aad:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801ab0:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801ab6:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801abb:	89 c6                	mov    %eax,%esi
+				continue;
+  801abd:	e9 61 ff ff ff       	jmp    801a23 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801ac2:	83 ec 04             	sub    $0x4,%esp
+  801ac5:	80 ca 80             	or     $0x80,%dl
+  801ac8:	52                   	push   %edx
+  801ac9:	53                   	push   %ebx
+  801aca:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801ad0:	e8 ca f2 ff ff       	call   800d9f <sys_page_alloc>
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	78 5d                	js     801b39 <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801adc:	83 ec 0c             	sub    $0xc,%esp
+  801adf:	6a 07                	push   $0x7
+  801ae1:	68 00 00 40 00       	push   $0x400000
+  801ae6:	6a 00                	push   $0x0
+  801ae8:	53                   	push   %ebx
+  801ae9:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801aef:	e8 18 f3 ff ff       	call   800e0c <sys_page_map>
+  801af4:	83 c4 20             	add    $0x20,%esp
+  801af7:	85 c0                	test   %eax,%eax
+  801af9:	78 50                	js     801b4b <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801afb:	83 ec 04             	sub    $0x4,%esp
+  801afe:	68 00 00 40 00       	push   $0x400000
+  801b03:	53                   	push   %ebx
+  801b04:	68 00 00 40 00       	push   $0x400000
+  801b09:	e8 1f ef ff ff       	call   800a2d <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801b0e:	83 c4 08             	add    $0x8,%esp
+  801b11:	68 00 00 40 00       	push   $0x400000
+  801b16:	6a 00                	push   $0x0
+  801b18:	e8 5d f3 ff ff       	call   800e7a <sys_page_unmap>
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	85 c0                	test   %eax,%eax
+  801b22:	79 8c                	jns    801ab0 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801b24:	50                   	push   %eax
+  801b25:	68 3d 38 80 00       	push   $0x80383d
+  801b2a:	68 81 00 00 00       	push   $0x81
+  801b2f:	68 e5 37 80 00       	push   $0x8037e5
+  801b34:	e8 4b e6 ff ff       	call   800184 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801b39:	50                   	push   %eax
+  801b3a:	68 19 38 80 00       	push   $0x803819
+  801b3f:	6a 7c                	push   $0x7c
+  801b41:	68 e5 37 80 00       	push   $0x8037e5
+  801b46:	e8 39 e6 ff ff       	call   800184 <_panic>
+		panic("sys_page_map: %e", r);
+  801b4b:	50                   	push   %eax
+  801b4c:	68 2c 38 80 00       	push   $0x80382c
+  801b51:	6a 7e                	push   $0x7e
+  801b53:	68 e5 37 80 00       	push   $0x8037e5
+  801b58:	e8 27 e6 ff ff       	call   800184 <_panic>
+  801b5d:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801b63:	eb 22                	jmp    801b87 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801b65:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801b6c:	a8 01                	test   $0x1,%al
+  801b6e:	74 35                	je     801ba5 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801b70:	89 d8                	mov    %ebx,%eax
+  801b72:	e8 9e fc ff ff       	call   801815 <dupperm>
+  801b77:	89 c6                	mov    %eax,%esi
+  801b79:	89 f8                	mov    %edi,%eax
+  801b7b:	e8 95 fc ff ff       	call   801815 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801b80:	39 c6                	cmp    %eax,%esi
+  801b82:	75 21                	jne    801ba5 <ufork+0x219>
+				j++;
+  801b84:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801b87:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801b8d:	74 16                	je     801ba5 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801b8f:	89 d8                	mov    %ebx,%eax
+  801b91:	c1 e8 0a             	shr    $0xa,%eax
+  801b94:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b9b:	25 81 00 00 00       	and    $0x81,%eax
+  801ba0:	83 f8 01             	cmp    $0x1,%eax
+  801ba3:	74 c0                	je     801b65 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801ba5:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801bab:	89 d8                	mov    %ebx,%eax
+  801bad:	29 f0                	sub    %esi,%eax
+  801baf:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801bb5:	89 fe                	mov    %edi,%esi
+  801bb7:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801bba:	89 f8                	mov    %edi,%eax
+  801bbc:	e8 54 fc ff ff       	call   801815 <dupperm>
+  801bc1:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801bc3:	83 ec 08             	sub    $0x8,%esp
+  801bc6:	6a 02                	push   $0x2
+  801bc8:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801bce:	51                   	push   %ecx
+  801bcf:	e8 15 03 00 00       	call   801ee9 <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801bd4:	83 c4 0c             	add    $0xc,%esp
+  801bd7:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801bdd:	57                   	push   %edi
+  801bde:	56                   	push   %esi
+  801bdf:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801be5:	56                   	push   %esi
+  801be6:	6a 00                	push   $0x0
+  801be8:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801bee:	51                   	push   %ecx
+  801bef:	e8 33 04 00 00       	call   802027 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801bf4:	83 c4 1c             	add    $0x1c,%esp
+  801bf7:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801bfd:	57                   	push   %edi
+  801bfe:	56                   	push   %esi
+  801bff:	6a 00                	push   $0x0
+  801c01:	56                   	push   %esi
+  801c02:	6a 00                	push   $0x0
+  801c04:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801c0a:	50                   	push   %eax
+  801c0b:	e8 17 04 00 00       	call   802027 <batch_map>
+	return 0;
+  801c10:	83 c4 20             	add    $0x20,%esp
+  801c13:	89 de                	mov    %ebx,%esi
+  801c15:	e9 09 fe ff ff       	jmp    801a23 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801c1a:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801c20:	83 ec 04             	sub    $0x4,%esp
+  801c23:	6a 02                	push   $0x2
+  801c25:	56                   	push   %esi
+  801c26:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801c2c:	53                   	push   %ebx
+  801c2d:	e8 49 04 00 00       	call   80207b <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801c32:	89 1c 24             	mov    %ebx,(%esp)
+  801c35:	e8 5d 02 00 00       	call   801e97 <batch_flush>
+  801c3a:	83 c4 10             	add    $0x10,%esp
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	78 0e                	js     801c4f <ufork+0x2c3>
+}
+  801c41:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801c47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c4a:	5b                   	pop    %ebx
+  801c4b:	5e                   	pop    %esi
+  801c4c:	5f                   	pop    %edi
+  801c4d:	5d                   	pop    %ebp
+  801c4e:	c3                   	ret
+			panic("fork: %e", r);
+  801c4f:	50                   	push   %eax
+  801c50:	68 10 38 80 00       	push   $0x803810
+  801c55:	68 d7 00 00 00       	push   $0xd7
+  801c5a:	68 e5 37 80 00       	push   $0x8037e5
+  801c5f:	e8 20 e5 ff ff       	call   800184 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801c64:	e8 aa f0 ff ff       	call   800d13 <sys_getenvid>
+  801c69:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c6e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c74:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c79:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801c7e:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801c85:	00 00 00 
+  801c88:	eb b7                	jmp    801c41 <ufork+0x2b5>
+
+00801c8a <fork>:
+{
+  801c8a:	55                   	push   %ebp
+  801c8b:	89 e5                	mov    %esp,%ebp
+  801c8d:	53                   	push   %ebx
+  801c8e:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801c91:	68 ae 18 80 00       	push   $0x8018ae
+  801c96:	e8 fb 15 00 00       	call   803296 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801c9b:	e8 7a f6 ff ff       	call   80131a <sys_fork>
+  801ca0:	89 c3                	mov    %eax,%ebx
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 09                	js     801cb2 <fork+0x28>
+	if (pid == 0)
+  801ca9:	74 1c                	je     801cc7 <fork+0x3d>
+}
+  801cab:	89 d8                	mov    %ebx,%eax
+  801cad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb0:	c9                   	leave
+  801cb1:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801cb2:	50                   	push   %eax
+  801cb3:	68 09 38 80 00       	push   $0x803809
+  801cb8:	68 ed 00 00 00       	push   $0xed
+  801cbd:	68 e5 37 80 00       	push   $0x8037e5
+  801cc2:	e8 bd e4 ff ff       	call   800184 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801cc7:	e8 47 f0 ff ff       	call   800d13 <sys_getenvid>
+  801ccc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cd1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cd7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801cdc:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801ce1:	eb c8                	jmp    801cab <fork+0x21>
+
+00801ce3 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801ce3:	55                   	push   %ebp
+  801ce4:	89 e5                	mov    %esp,%ebp
+  801ce6:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801ce9:	ff 75 0c             	push   0xc(%ebp)
+  801cec:	ff 75 08             	push   0x8(%ebp)
+  801cef:	68 6f 19 80 00       	push   $0x80196f
+  801cf4:	e8 67 f6 ff ff       	call   801360 <sys_thread_create>
+}
+  801cf9:	c9                   	leave
+  801cfa:	c3                   	ret
+
+00801cfb <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801cfb:	55                   	push   %ebp
+  801cfc:	89 e5                	mov    %esp,%ebp
+  801cfe:	56                   	push   %esi
+  801cff:	53                   	push   %ebx
+  801d00:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801d10:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801d13:	83 ec 08             	sub    $0x8,%esp
+  801d16:	ff 75 14             	push   0x14(%ebp)
+  801d19:	50                   	push   %eax
+  801d1a:	e8 91 f4 ff ff       	call   8011b0 <sys_ipc_recv_until>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	78 61                	js     801d87 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801d26:	85 f6                	test   %esi,%esi
+  801d28:	74 1c                	je     801d46 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801d2a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d2c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d31:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d37:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d3c:	76 5f                	jbe    801d9d <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801d3e:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801d44:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801d46:	85 db                	test   %ebx,%ebx
+  801d48:	74 1c                	je     801d66 <ipc_recv_until+0x6b>
+  801d4a:	89 e0                	mov    %esp,%eax
+  801d4c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d51:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d57:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d5c:	76 50                	jbe    801dae <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801d5e:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801d64:	89 03                	mov    %eax,(%ebx)
+  801d66:	89 e0                	mov    %esp,%eax
+  801d68:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d6d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d73:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d78:	76 45                	jbe    801dbf <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801d7a:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801d80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d83:	5b                   	pop    %ebx
+  801d84:	5e                   	pop    %esi
+  801d85:	5d                   	pop    %ebp
+  801d86:	c3                   	ret
+		if (from_env_store)
+  801d87:	85 f6                	test   %esi,%esi
+  801d89:	74 06                	je     801d91 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801d8b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801d91:	85 db                	test   %ebx,%ebx
+  801d93:	74 eb                	je     801d80 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801d95:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801d9b:	eb e3                	jmp    801d80 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d9d:	c1 e8 10             	shr    $0x10,%eax
+  801da0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801da6:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801dac:	eb 90                	jmp    801d3e <ipc_recv_until+0x43>
+  801dae:	c1 e8 10             	shr    $0x10,%eax
+  801db1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801db7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801dbd:	eb 9f                	jmp    801d5e <ipc_recv_until+0x63>
+  801dbf:	c1 e8 10             	shr    $0x10,%eax
+  801dc2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dc8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801dce:	eb aa                	jmp    801d7a <ipc_recv_until+0x7f>
+
+00801dd0 <ipc_recv>:
+{
+  801dd0:	55                   	push   %ebp
+  801dd1:	89 e5                	mov    %esp,%ebp
+  801dd3:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801dd6:	6a 00                	push   $0x0
+  801dd8:	ff 75 10             	push   0x10(%ebp)
+  801ddb:	ff 75 0c             	push   0xc(%ebp)
+  801dde:	ff 75 08             	push   0x8(%ebp)
+  801de1:	e8 15 ff ff ff       	call   801cfb <ipc_recv_until>
+}
+  801de6:	c9                   	leave
+  801de7:	c3                   	ret
+
+00801de8 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	57                   	push   %edi
+  801dec:	56                   	push   %esi
+  801ded:	53                   	push   %ebx
+  801dee:	83 ec 0c             	sub    $0xc,%esp
+  801df1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801df4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801df7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801dfa:	85 db                	test   %ebx,%ebx
+  801dfc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801e01:	0f 44 d8             	cmove  %eax,%ebx
+  801e04:	eb 05                	jmp    801e0b <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801e06:	e8 4e ef ff ff       	call   800d59 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801e0b:	ff 75 14             	push   0x14(%ebp)
+  801e0e:	53                   	push   %ebx
+  801e0f:	56                   	push   %esi
+  801e10:	57                   	push   %edi
+  801e11:	e8 e6 f2 ff ff       	call   8010fc <sys_ipc_try_send>
+  801e16:	83 c4 10             	add    $0x10,%esp
+  801e19:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801e1c:	74 e8                	je     801e06 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	78 08                	js     801e2a <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801e22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e25:	5b                   	pop    %ebx
+  801e26:	5e                   	pop    %esi
+  801e27:	5f                   	pop    %edi
+  801e28:	5d                   	pop    %ebp
+  801e29:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801e2a:	50                   	push   %eax
+  801e2b:	68 50 38 80 00       	push   $0x803850
+  801e30:	6a 4f                	push   $0x4f
+  801e32:	68 63 38 80 00       	push   $0x803863
+  801e37:	e8 48 e3 ff ff       	call   800184 <_panic>
+
+00801e3c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801e42:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801e47:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801e4d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801e53:	8b 52 50             	mov    0x50(%edx),%edx
+  801e56:	39 ca                	cmp    %ecx,%edx
+  801e58:	74 11                	je     801e6b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801e5a:	83 c0 01             	add    $0x1,%eax
+  801e5d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801e62:	75 e3                	jne    801e47 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801e64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e69:	eb 0e                	jmp    801e79 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801e6b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e71:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801e76:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801e79:	5d                   	pop    %ebp
+  801e7a:	c3                   	ret
+
+00801e7b <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801e7b:	55                   	push   %ebp
+  801e7c:	89 e5                	mov    %esp,%ebp
+  801e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801e81:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801e88:	00 00 00 
+	b->b_error = 0;
+  801e8b:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801e92:	00 00 00 
+}
+  801e95:	5d                   	pop    %ebp
+  801e96:	c3                   	ret
+
+00801e97 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801e97:	55                   	push   %ebp
+  801e98:	89 e5                	mov    %esp,%ebp
+  801e9a:	53                   	push   %ebx
+  801e9b:	83 ec 04             	sub    $0x4,%esp
+  801e9e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801ea1:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801ea7:	85 c0                	test   %eax,%eax
+  801ea9:	7e 09                	jle    801eb4 <batch_flush+0x1d>
+  801eab:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801eb2:	74 15                	je     801ec9 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801eb4:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801ebb:	00 00 00 
+	return b->b_error;
+  801ebe:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801ec4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ec7:	c9                   	leave
+  801ec8:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801ec9:	83 ec 08             	sub    $0x8,%esp
+  801ecc:	50                   	push   %eax
+  801ecd:	53                   	push   %ebx
+  801ece:	e8 b2 f5 ff ff       	call   801485 <sys_batch>
+  801ed3:	83 c4 10             	add    $0x10,%esp
+  801ed6:	85 c0                	test   %eax,%eax
+  801ed8:	79 da                	jns    801eb4 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801eda:	f7 d8                	neg    %eax
+  801edc:	0f b6 c0             	movzbl %al,%eax
+  801edf:	f7 d8                	neg    %eax
+  801ee1:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801ee7:	eb cb                	jmp    801eb4 <batch_flush+0x1d>
+
+00801ee9 <batch_reserve>:
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	83 ec 08             	sub    $0x8,%esp
+  801eef:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801ef2:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801ef8:	03 45 0c             	add    0xc(%ebp),%eax
+  801efb:	83 f8 10             	cmp    $0x10,%eax
+  801efe:	7f 02                	jg     801f02 <batch_reserve+0x19>
+}
+  801f00:	c9                   	leave
+  801f01:	c3                   	ret
+		batch_flush(b);
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+  801f05:	52                   	push   %edx
+  801f06:	e8 8c ff ff ff       	call   801e97 <batch_flush>
+  801f0b:	83 c4 10             	add    $0x10,%esp
+}
+  801f0e:	eb f0                	jmp    801f00 <batch_reserve+0x17>
+
+00801f10 <batch_next>:
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	53                   	push   %ebx
+  801f14:	83 ec 04             	sub    $0x4,%esp
+  801f17:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801f19:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801f20:	74 28                	je     801f4a <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801f22:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801f28:	8d 50 01             	lea    0x1(%eax),%edx
+  801f2b:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801f31:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f34:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801f36:	83 ec 04             	sub    $0x4,%esp
+  801f39:	6a 1c                	push   $0x1c
+  801f3b:	6a 00                	push   $0x0
+  801f3d:	53                   	push   %ebx
+  801f3e:	e8 b5 ea ff ff       	call   8009f8 <memset>
+}
+  801f43:	89 d8                	mov    %ebx,%eax
+  801f45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f48:	c9                   	leave
+  801f49:	c3                   	ret
+		batch_flush(b);
+  801f4a:	83 ec 0c             	sub    $0xc,%esp
+  801f4d:	50                   	push   %eax
+  801f4e:	e8 44 ff ff ff       	call   801e97 <batch_flush>
+  801f53:	83 c4 10             	add    $0x10,%esp
+  801f56:	eb ca                	jmp    801f22 <batch_next+0x12>
+
+00801f58 <batch_page>:
+{
+  801f58:	55                   	push   %ebp
+  801f59:	89 e5                	mov    %esp,%ebp
+  801f5b:	57                   	push   %edi
+  801f5c:	56                   	push   %esi
+  801f5d:	53                   	push   %ebx
+  801f5e:	83 ec 1c             	sub    $0x1c,%esp
+  801f61:	89 d3                	mov    %edx,%ebx
+  801f63:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801f65:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801f6b:	85 d2                	test   %edx,%edx
+  801f6d:	74 50                	je     801fbf <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801f6f:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801f72:	01 c1                	add    %eax,%ecx
+  801f74:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801f77:	75 46                	jne    801fbf <batch_page+0x67>
+  801f79:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801f7c:	75 41                	jne    801fbf <batch_page+0x67>
+  801f7e:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801f81:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801f84:	75 39                	jne    801fbf <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801f86:	83 ea 01             	sub    $0x1,%edx
+  801f89:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801f8c:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801f8f:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801f93:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801f96:	75 27                	jne    801fbf <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801f98:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801f9b:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801f9f:	89 fa                	mov    %edi,%edx
+  801fa1:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801fa4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801fa7:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801faa:	39 55 08             	cmp    %edx,0x8(%ebp)
+  801fad:	75 10                	jne    801fbf <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801faf:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  801fb3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fb6:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  801fba:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801fbd:	74 2a                	je     801fe9 <batch_page+0x91>
+	op = batch_next(b);
+  801fbf:	e8 4c ff ff ff       	call   801f10 <batch_next>
+	op->bo_op = opcode;
+  801fc4:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  801fc6:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  801fc9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fcc:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  801fcf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fd2:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  801fd5:	8b 75 10             	mov    0x10(%ebp),%esi
+  801fd8:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  801fdb:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801fde:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  801fe1:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801fe4:	89 78 14             	mov    %edi,0x14(%eax)
+  801fe7:	eb 0b                	jmp    801ff4 <batch_page+0x9c>
+		op->bo_npages += npages;
+  801fe9:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  801fed:	03 7d 18             	add    0x18(%ebp),%edi
+  801ff0:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  801ff4:	83 c4 1c             	add    $0x1c,%esp
+  801ff7:	5b                   	pop    %ebx
+  801ff8:	5e                   	pop    %esi
+  801ff9:	5f                   	pop    %edi
+  801ffa:	5d                   	pop    %ebp
+  801ffb:	c3                   	ret
+
+00801ffc <batch_alloc>:
+{
+  801ffc:	55                   	push   %ebp
+  801ffd:	89 e5                	mov    %esp,%ebp
+  801fff:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802002:	ff 75 18             	push   0x18(%ebp)
+  802005:	ff 75 14             	push   0x14(%ebp)
+  802008:	ff 75 10             	push   0x10(%ebp)
+  80200b:	ff 75 0c             	push   0xc(%ebp)
+  80200e:	6a 00                	push   $0x0
+  802010:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802015:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201d:	e8 36 ff ff ff       	call   801f58 <batch_page>
+}
+  802022:	83 c4 20             	add    $0x20,%esp
+  802025:	c9                   	leave
+  802026:	c3                   	ret
+
+00802027 <batch_map>:
+{
+  802027:	55                   	push   %ebp
+  802028:	89 e5                	mov    %esp,%ebp
+  80202a:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  80202d:	ff 75 20             	push   0x20(%ebp)
+  802030:	ff 75 1c             	push   0x1c(%ebp)
+  802033:	ff 75 18             	push   0x18(%ebp)
+  802036:	ff 75 14             	push   0x14(%ebp)
+  802039:	ff 75 10             	push   0x10(%ebp)
+  80203c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80203f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802044:	8b 45 08             	mov    0x8(%ebp),%eax
+  802047:	e8 0c ff ff ff       	call   801f58 <batch_page>
+}
+  80204c:	83 c4 20             	add    $0x20,%esp
+  80204f:	c9                   	leave
+  802050:	c3                   	ret
+
+00802051 <batch_unmap>:
+{
+  802051:	55                   	push   %ebp
+  802052:	89 e5                	mov    %esp,%ebp
+  802054:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  802057:	ff 75 14             	push   0x14(%ebp)
+  80205a:	6a 00                	push   $0x0
+  80205c:	ff 75 10             	push   0x10(%ebp)
+  80205f:	ff 75 0c             	push   0xc(%ebp)
+  802062:	6a 00                	push   $0x0
+  802064:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802069:	ba 02 00 00 00       	mov    $0x2,%edx
+  80206e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802071:	e8 e2 fe ff ff       	call   801f58 <batch_page>
+}
+  802076:	83 c4 20             	add    $0x20,%esp
+  802079:	c9                   	leave
+  80207a:	c3                   	ret
+
+0080207b <batch_set_status>:
+{
+  80207b:	55                   	push   %ebp
+  80207c:	89 e5                	mov    %esp,%ebp
+  80207e:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  802081:	8b 45 08             	mov    0x8(%ebp),%eax
+  802084:	e8 87 fe ff ff       	call   801f10 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  802089:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  80208f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802092:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  802095:	8b 55 10             	mov    0x10(%ebp),%edx
+  802098:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  80209b:	c9                   	leave
+  80209c:	c3                   	ret
+
+0080209d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80209d:	55                   	push   %ebp
+  80209e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8020a8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8020ab:	5d                   	pop    %ebp
+  8020ac:	c3                   	ret
+
+008020ad <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8020b8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8020bd:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8020c2:	5d                   	pop    %ebp
+  8020c3:	c3                   	ret
+
+008020c4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8020c4:	55                   	push   %ebp
+  8020c5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8020c7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8020cc:	eb 02                	jmp    8020d0 <fd_alloc+0xc>
+  8020ce:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8020d0:	89 c2                	mov    %eax,%edx
+  8020d2:	c1 ea 16             	shr    $0x16,%edx
+  8020d5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8020dc:	f6 c2 01             	test   $0x1,%dl
+  8020df:	74 2b                	je     80210c <fd_alloc+0x48>
+  8020e1:	89 c2                	mov    %eax,%edx
+  8020e3:	c1 ea 0c             	shr    $0xc,%edx
+  8020e6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8020ed:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8020f3:	f6 c1 01             	test   $0x1,%cl
+  8020f6:	74 14                	je     80210c <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8020f8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8020fe:	75 ce                	jne    8020ce <fd_alloc+0xa>
+  802100:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802105:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80210a:	eb 05                	jmp    802111 <fd_alloc+0x4d>
+			return 0;
+  80210c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802111:	8b 55 08             	mov    0x8(%ebp),%edx
+  802114:	89 02                	mov    %eax,(%edx)
+}
+  802116:	89 c8                	mov    %ecx,%eax
+  802118:	5d                   	pop    %ebp
+  802119:	c3                   	ret
+
+0080211a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802120:	83 f8 1f             	cmp    $0x1f,%eax
+  802123:	77 30                	ja     802155 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802125:	c1 e0 0c             	shl    $0xc,%eax
+  802128:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80212d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802133:	f6 c2 01             	test   $0x1,%dl
+  802136:	74 24                	je     80215c <fd_lookup+0x42>
+  802138:	89 c2                	mov    %eax,%edx
+  80213a:	c1 ea 0c             	shr    $0xc,%edx
+  80213d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802144:	f6 c2 01             	test   $0x1,%dl
+  802147:	74 1a                	je     802163 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802149:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80214c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80214e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802153:	5d                   	pop    %ebp
+  802154:	c3                   	ret
+		return -E_INVAL;
+  802155:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80215a:	eb f7                	jmp    802153 <fd_lookup+0x39>
+		return -E_INVAL;
+  80215c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802161:	eb f0                	jmp    802153 <fd_lookup+0x39>
+  802163:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802168:	eb e9                	jmp    802153 <fd_lookup+0x39>
+
+0080216a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	53                   	push   %ebx
+  80216e:	83 ec 04             	sub    $0x4,%esp
+  802171:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802174:	b8 00 00 00 00       	mov    $0x0,%eax
+  802179:	eb 03                	jmp    80217e <dev_lookup+0x14>
+  80217b:	83 c0 01             	add    $0x1,%eax
+  80217e:	8b 1c 85 ec 38 80 00 	mov    0x8038ec(,%eax,4),%ebx
+  802185:	85 db                	test   %ebx,%ebx
+  802187:	74 0b                	je     802194 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802189:	39 13                	cmp    %edx,(%ebx)
+  80218b:	75 ee                	jne    80217b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80218d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802192:	eb 2e                	jmp    8021c2 <dev_lookup+0x58>
+  802194:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802196:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80219b:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8021a1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8021a6:	76 24                	jbe    8021cc <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8021a8:	8b 41 48             	mov    0x48(%ecx),%eax
+  8021ab:	83 ec 04             	sub    $0x4,%esp
+  8021ae:	52                   	push   %edx
+  8021af:	50                   	push   %eax
+  8021b0:	68 70 38 80 00       	push   $0x803870
+  8021b5:	e8 a5 e0 ff ff       	call   80025f <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8021ba:	83 c4 10             	add    $0x10,%esp
+  8021bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8021c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c5:	89 1a                	mov    %ebx,(%edx)
+}
+  8021c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8021cc:	c1 e8 10             	shr    $0x10,%eax
+  8021cf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8021d5:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8021db:	eb cb                	jmp    8021a8 <dev_lookup+0x3e>
+
+008021dd <fd_close>:
+{
+  8021dd:	55                   	push   %ebp
+  8021de:	89 e5                	mov    %esp,%ebp
+  8021e0:	57                   	push   %edi
+  8021e1:	56                   	push   %esi
+  8021e2:	53                   	push   %ebx
+  8021e3:	83 ec 24             	sub    $0x24,%esp
+  8021e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8021ec:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021ef:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021f0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8021f6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8021f9:	50                   	push   %eax
+  8021fa:	e8 1b ff ff ff       	call   80211a <fd_lookup>
+  8021ff:	89 c3                	mov    %eax,%ebx
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	85 c0                	test   %eax,%eax
+  802206:	78 05                	js     80220d <fd_close+0x30>
+	    || fd != fd2)
+  802208:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80220b:	74 16                	je     802223 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80220d:	89 f8                	mov    %edi,%eax
+  80220f:	84 c0                	test   %al,%al
+  802211:	b8 00 00 00 00       	mov    $0x0,%eax
+  802216:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802219:	89 d8                	mov    %ebx,%eax
+  80221b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80221e:	5b                   	pop    %ebx
+  80221f:	5e                   	pop    %esi
+  802220:	5f                   	pop    %edi
+  802221:	5d                   	pop    %ebp
+  802222:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802223:	83 ec 08             	sub    $0x8,%esp
+  802226:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802229:	50                   	push   %eax
+  80222a:	ff 36                	push   (%esi)
+  80222c:	e8 39 ff ff ff       	call   80216a <dev_lookup>
+  802231:	89 c3                	mov    %eax,%ebx
+  802233:	83 c4 10             	add    $0x10,%esp
+  802236:	85 c0                	test   %eax,%eax
+  802238:	78 1a                	js     802254 <fd_close+0x77>
+		if (dev->dev_close)
+  80223a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80223d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802240:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802245:	85 c0                	test   %eax,%eax
+  802247:	74 0b                	je     802254 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802249:	83 ec 0c             	sub    $0xc,%esp
+  80224c:	56                   	push   %esi
+  80224d:	ff d0                	call   *%eax
+  80224f:	89 c3                	mov    %eax,%ebx
+  802251:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802254:	83 ec 08             	sub    $0x8,%esp
+  802257:	56                   	push   %esi
+  802258:	6a 00                	push   $0x0
+  80225a:	e8 1b ec ff ff       	call   800e7a <sys_page_unmap>
+	return r;
+  80225f:	83 c4 10             	add    $0x10,%esp
+  802262:	eb b5                	jmp    802219 <fd_close+0x3c>
+
+00802264 <close>:
+
+int
+close(int fdnum)
+{
+  802264:	55                   	push   %ebp
+  802265:	89 e5                	mov    %esp,%ebp
+  802267:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80226a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80226d:	50                   	push   %eax
+  80226e:	ff 75 08             	push   0x8(%ebp)
+  802271:	e8 a4 fe ff ff       	call   80211a <fd_lookup>
+  802276:	83 c4 10             	add    $0x10,%esp
+  802279:	85 c0                	test   %eax,%eax
+  80227b:	79 02                	jns    80227f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80227d:	c9                   	leave
+  80227e:	c3                   	ret
+		return fd_close(fd, 1);
+  80227f:	83 ec 08             	sub    $0x8,%esp
+  802282:	6a 01                	push   $0x1
+  802284:	ff 75 f4             	push   -0xc(%ebp)
+  802287:	e8 51 ff ff ff       	call   8021dd <fd_close>
+  80228c:	83 c4 10             	add    $0x10,%esp
+  80228f:	eb ec                	jmp    80227d <close+0x19>
+
+00802291 <close_all>:
+
+void
+close_all(void)
+{
+  802291:	55                   	push   %ebp
+  802292:	89 e5                	mov    %esp,%ebp
+  802294:	53                   	push   %ebx
+  802295:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802298:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80229d:	83 ec 0c             	sub    $0xc,%esp
+  8022a0:	53                   	push   %ebx
+  8022a1:	e8 be ff ff ff       	call   802264 <close>
+	for (i = 0; i < MAXFD; i++)
+  8022a6:	83 c3 01             	add    $0x1,%ebx
+  8022a9:	83 c4 10             	add    $0x10,%esp
+  8022ac:	83 fb 20             	cmp    $0x20,%ebx
+  8022af:	75 ec                	jne    80229d <close_all+0xc>
+}
+  8022b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b4:	c9                   	leave
+  8022b5:	c3                   	ret
+
+008022b6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8022b6:	55                   	push   %ebp
+  8022b7:	89 e5                	mov    %esp,%ebp
+  8022b9:	57                   	push   %edi
+  8022ba:	56                   	push   %esi
+  8022bb:	53                   	push   %ebx
+  8022bc:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8022bf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022c2:	50                   	push   %eax
+  8022c3:	ff 75 08             	push   0x8(%ebp)
+  8022c6:	e8 4f fe ff ff       	call   80211a <fd_lookup>
+  8022cb:	89 c3                	mov    %eax,%ebx
+  8022cd:	83 c4 10             	add    $0x10,%esp
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	78 7f                	js     802353 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8022d4:	83 ec 0c             	sub    $0xc,%esp
+  8022d7:	ff 75 0c             	push   0xc(%ebp)
+  8022da:	e8 85 ff ff ff       	call   802264 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8022df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8022e2:	c1 e6 0c             	shl    $0xc,%esi
+  8022e5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8022eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022ee:	89 3c 24             	mov    %edi,(%esp)
+  8022f1:	e8 b7 fd ff ff       	call   8020ad <fd2data>
+  8022f6:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8022f8:	89 34 24             	mov    %esi,(%esp)
+  8022fb:	e8 ad fd ff ff       	call   8020ad <fd2data>
+  802300:	83 c4 10             	add    $0x10,%esp
+  802303:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802306:	89 d8                	mov    %ebx,%eax
+  802308:	c1 e8 16             	shr    $0x16,%eax
+  80230b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802312:	a8 01                	test   $0x1,%al
+  802314:	74 11                	je     802327 <dup+0x71>
+  802316:	89 d8                	mov    %ebx,%eax
+  802318:	c1 e8 0c             	shr    $0xc,%eax
+  80231b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802322:	f6 c2 01             	test   $0x1,%dl
+  802325:	75 36                	jne    80235d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802327:	89 f8                	mov    %edi,%eax
+  802329:	c1 e8 0c             	shr    $0xc,%eax
+  80232c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802333:	83 ec 0c             	sub    $0xc,%esp
+  802336:	25 07 0e 00 00       	and    $0xe07,%eax
+  80233b:	50                   	push   %eax
+  80233c:	56                   	push   %esi
+  80233d:	6a 00                	push   $0x0
+  80233f:	57                   	push   %edi
+  802340:	6a 00                	push   $0x0
+  802342:	e8 c5 ea ff ff       	call   800e0c <sys_page_map>
+  802347:	89 c3                	mov    %eax,%ebx
+  802349:	83 c4 20             	add    $0x20,%esp
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	78 33                	js     802383 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802350:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802353:	89 d8                	mov    %ebx,%eax
+  802355:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802358:	5b                   	pop    %ebx
+  802359:	5e                   	pop    %esi
+  80235a:	5f                   	pop    %edi
+  80235b:	5d                   	pop    %ebp
+  80235c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80235d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802364:	83 ec 0c             	sub    $0xc,%esp
+  802367:	25 07 0e 00 00       	and    $0xe07,%eax
+  80236c:	50                   	push   %eax
+  80236d:	ff 75 d4             	push   -0x2c(%ebp)
+  802370:	6a 00                	push   $0x0
+  802372:	53                   	push   %ebx
+  802373:	6a 00                	push   $0x0
+  802375:	e8 92 ea ff ff       	call   800e0c <sys_page_map>
+  80237a:	89 c3                	mov    %eax,%ebx
+  80237c:	83 c4 20             	add    $0x20,%esp
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	79 a4                	jns    802327 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802383:	83 ec 08             	sub    $0x8,%esp
+  802386:	56                   	push   %esi
+  802387:	6a 00                	push   $0x0
+  802389:	e8 ec ea ff ff       	call   800e7a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80238e:	83 c4 08             	add    $0x8,%esp
+  802391:	ff 75 d4             	push   -0x2c(%ebp)
+  802394:	6a 00                	push   $0x0
+  802396:	e8 df ea ff ff       	call   800e7a <sys_page_unmap>
+	return r;
+  80239b:	83 c4 10             	add    $0x10,%esp
+  80239e:	eb b3                	jmp    802353 <dup+0x9d>
+
+008023a0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8023a0:	55                   	push   %ebp
+  8023a1:	89 e5                	mov    %esp,%ebp
+  8023a3:	56                   	push   %esi
+  8023a4:	53                   	push   %ebx
+  8023a5:	83 ec 18             	sub    $0x18,%esp
+  8023a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8023ab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023ae:	50                   	push   %eax
+  8023af:	53                   	push   %ebx
+  8023b0:	e8 65 fd ff ff       	call   80211a <fd_lookup>
+  8023b5:	83 c4 10             	add    $0x10,%esp
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	78 3c                	js     8023f8 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023bc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023bf:	83 ec 08             	sub    $0x8,%esp
+  8023c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023c5:	50                   	push   %eax
+  8023c6:	ff 36                	push   (%esi)
+  8023c8:	e8 9d fd ff ff       	call   80216a <dev_lookup>
+  8023cd:	83 c4 10             	add    $0x10,%esp
+  8023d0:	85 c0                	test   %eax,%eax
+  8023d2:	78 24                	js     8023f8 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8023d4:	8b 46 08             	mov    0x8(%esi),%eax
+  8023d7:	83 e0 03             	and    $0x3,%eax
+  8023da:	83 f8 01             	cmp    $0x1,%eax
+  8023dd:	74 20                	je     8023ff <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8023df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e2:	8b 40 08             	mov    0x8(%eax),%eax
+  8023e5:	85 c0                	test   %eax,%eax
+  8023e7:	74 57                	je     802440 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8023e9:	83 ec 04             	sub    $0x4,%esp
+  8023ec:	ff 75 10             	push   0x10(%ebp)
+  8023ef:	ff 75 0c             	push   0xc(%ebp)
+  8023f2:	56                   	push   %esi
+  8023f3:	ff d0                	call   *%eax
+  8023f5:	83 c4 10             	add    $0x10,%esp
+}
+  8023f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023fb:	5b                   	pop    %ebx
+  8023fc:	5e                   	pop    %esi
+  8023fd:	5d                   	pop    %ebp
+  8023fe:	c3                   	ret
+  8023ff:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802401:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802406:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80240c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802411:	76 1c                	jbe    80242f <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802413:	8b 42 48             	mov    0x48(%edx),%eax
+  802416:	83 ec 04             	sub    $0x4,%esp
+  802419:	53                   	push   %ebx
+  80241a:	50                   	push   %eax
+  80241b:	68 b1 38 80 00       	push   $0x8038b1
+  802420:	e8 3a de ff ff       	call   80025f <cprintf>
+		return -E_INVAL;
+  802425:	83 c4 10             	add    $0x10,%esp
+  802428:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80242d:	eb c9                	jmp    8023f8 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80242f:	c1 e8 10             	shr    $0x10,%eax
+  802432:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802438:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80243e:	eb d3                	jmp    802413 <read+0x73>
+		return -E_NOT_SUPP;
+  802440:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802445:	eb b1                	jmp    8023f8 <read+0x58>
+
+00802447 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	57                   	push   %edi
+  80244b:	56                   	push   %esi
+  80244c:	53                   	push   %ebx
+  80244d:	83 ec 0c             	sub    $0xc,%esp
+  802450:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802453:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802456:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80245b:	eb 02                	jmp    80245f <readn+0x18>
+  80245d:	01 c3                	add    %eax,%ebx
+  80245f:	39 f3                	cmp    %esi,%ebx
+  802461:	73 21                	jae    802484 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802463:	83 ec 04             	sub    $0x4,%esp
+  802466:	89 f0                	mov    %esi,%eax
+  802468:	29 d8                	sub    %ebx,%eax
+  80246a:	50                   	push   %eax
+  80246b:	89 d8                	mov    %ebx,%eax
+  80246d:	03 45 0c             	add    0xc(%ebp),%eax
+  802470:	50                   	push   %eax
+  802471:	57                   	push   %edi
+  802472:	e8 29 ff ff ff       	call   8023a0 <read>
+		if (m < 0)
+  802477:	83 c4 10             	add    $0x10,%esp
+  80247a:	85 c0                	test   %eax,%eax
+  80247c:	78 04                	js     802482 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80247e:	75 dd                	jne    80245d <readn+0x16>
+  802480:	eb 02                	jmp    802484 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802482:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802484:	89 d8                	mov    %ebx,%eax
+  802486:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802489:	5b                   	pop    %ebx
+  80248a:	5e                   	pop    %esi
+  80248b:	5f                   	pop    %edi
+  80248c:	5d                   	pop    %ebp
+  80248d:	c3                   	ret
+
+0080248e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	56                   	push   %esi
+  802492:	53                   	push   %ebx
+  802493:	83 ec 18             	sub    $0x18,%esp
+  802496:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802499:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80249c:	50                   	push   %eax
+  80249d:	53                   	push   %ebx
+  80249e:	e8 77 fc ff ff       	call   80211a <fd_lookup>
+  8024a3:	83 c4 10             	add    $0x10,%esp
+  8024a6:	85 c0                	test   %eax,%eax
+  8024a8:	78 37                	js     8024e1 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024aa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024ad:	83 ec 08             	sub    $0x8,%esp
+  8024b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024b3:	50                   	push   %eax
+  8024b4:	ff 36                	push   (%esi)
+  8024b6:	e8 af fc ff ff       	call   80216a <dev_lookup>
+  8024bb:	83 c4 10             	add    $0x10,%esp
+  8024be:	85 c0                	test   %eax,%eax
+  8024c0:	78 1f                	js     8024e1 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024c2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8024c6:	74 20                	je     8024e8 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8024c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024cb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024ce:	85 c0                	test   %eax,%eax
+  8024d0:	74 57                	je     802529 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8024d2:	83 ec 04             	sub    $0x4,%esp
+  8024d5:	ff 75 10             	push   0x10(%ebp)
+  8024d8:	ff 75 0c             	push   0xc(%ebp)
+  8024db:	56                   	push   %esi
+  8024dc:	ff d0                	call   *%eax
+  8024de:	83 c4 10             	add    $0x10,%esp
+}
+  8024e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e4:	5b                   	pop    %ebx
+  8024e5:	5e                   	pop    %esi
+  8024e6:	5d                   	pop    %ebp
+  8024e7:	c3                   	ret
+  8024e8:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024ea:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8024ef:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024f5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8024fa:	76 1c                	jbe    802518 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024fc:	8b 42 48             	mov    0x48(%edx),%eax
+  8024ff:	83 ec 04             	sub    $0x4,%esp
+  802502:	53                   	push   %ebx
+  802503:	50                   	push   %eax
+  802504:	68 cd 38 80 00       	push   $0x8038cd
+  802509:	e8 51 dd ff ff       	call   80025f <cprintf>
+		return -E_INVAL;
+  80250e:	83 c4 10             	add    $0x10,%esp
+  802511:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802516:	eb c9                	jmp    8024e1 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802518:	c1 e8 10             	shr    $0x10,%eax
+  80251b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802521:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802527:	eb d3                	jmp    8024fc <write+0x6e>
+		return -E_NOT_SUPP;
+  802529:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80252e:	eb b1                	jmp    8024e1 <write+0x53>
+
+00802530 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802530:	55                   	push   %ebp
+  802531:	89 e5                	mov    %esp,%ebp
+  802533:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802536:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802539:	50                   	push   %eax
+  80253a:	ff 75 08             	push   0x8(%ebp)
+  80253d:	e8 d8 fb ff ff       	call   80211a <fd_lookup>
+  802542:	83 c4 10             	add    $0x10,%esp
+  802545:	85 c0                	test   %eax,%eax
+  802547:	78 0e                	js     802557 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802549:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80254c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80254f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802552:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802557:	c9                   	leave
+  802558:	c3                   	ret
+
+00802559 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802559:	55                   	push   %ebp
+  80255a:	89 e5                	mov    %esp,%ebp
+  80255c:	56                   	push   %esi
+  80255d:	53                   	push   %ebx
+  80255e:	83 ec 18             	sub    $0x18,%esp
+  802561:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802564:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802567:	50                   	push   %eax
+  802568:	53                   	push   %ebx
+  802569:	e8 ac fb ff ff       	call   80211a <fd_lookup>
+  80256e:	83 c4 10             	add    $0x10,%esp
+  802571:	85 c0                	test   %eax,%eax
+  802573:	78 34                	js     8025a9 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802575:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802578:	83 ec 08             	sub    $0x8,%esp
+  80257b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80257e:	50                   	push   %eax
+  80257f:	ff 36                	push   (%esi)
+  802581:	e8 e4 fb ff ff       	call   80216a <dev_lookup>
+  802586:	83 c4 10             	add    $0x10,%esp
+  802589:	85 c0                	test   %eax,%eax
+  80258b:	78 1c                	js     8025a9 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80258d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802591:	74 1d                	je     8025b0 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802593:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802596:	8b 40 18             	mov    0x18(%eax),%eax
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	74 54                	je     8025f1 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80259d:	83 ec 08             	sub    $0x8,%esp
+  8025a0:	ff 75 0c             	push   0xc(%ebp)
+  8025a3:	56                   	push   %esi
+  8025a4:	ff d0                	call   *%eax
+  8025a6:	83 c4 10             	add    $0x10,%esp
+}
+  8025a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ac:	5b                   	pop    %ebx
+  8025ad:	5e                   	pop    %esi
+  8025ae:	5d                   	pop    %ebp
+  8025af:	c3                   	ret
+  8025b0:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025b2:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025b7:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025bd:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025c2:	76 1c                	jbe    8025e0 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8025c4:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8025c7:	83 ec 04             	sub    $0x4,%esp
+  8025ca:	53                   	push   %ebx
+  8025cb:	50                   	push   %eax
+  8025cc:	68 90 38 80 00       	push   $0x803890
+  8025d1:	e8 89 dc ff ff       	call   80025f <cprintf>
+		return -E_INVAL;
+  8025d6:	83 c4 10             	add    $0x10,%esp
+  8025d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025de:	eb c9                	jmp    8025a9 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025e0:	c1 e8 10             	shr    $0x10,%eax
+  8025e3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025e9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025ef:	eb d3                	jmp    8025c4 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8025f1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025f6:	eb b1                	jmp    8025a9 <ftruncate+0x50>
+
+008025f8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8025f8:	55                   	push   %ebp
+  8025f9:	89 e5                	mov    %esp,%ebp
+  8025fb:	56                   	push   %esi
+  8025fc:	53                   	push   %ebx
+  8025fd:	83 ec 18             	sub    $0x18,%esp
+  802600:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802603:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802606:	50                   	push   %eax
+  802607:	ff 75 08             	push   0x8(%ebp)
+  80260a:	e8 0b fb ff ff       	call   80211a <fd_lookup>
+  80260f:	83 c4 10             	add    $0x10,%esp
+  802612:	85 c0                	test   %eax,%eax
+  802614:	78 49                	js     80265f <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802616:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802619:	83 ec 08             	sub    $0x8,%esp
+  80261c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80261f:	50                   	push   %eax
+  802620:	ff 36                	push   (%esi)
+  802622:	e8 43 fb ff ff       	call   80216a <dev_lookup>
+  802627:	83 c4 10             	add    $0x10,%esp
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	78 31                	js     80265f <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80262e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802631:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802635:	74 2f                	je     802666 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802637:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80263a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802641:	00 00 00 
+	stat->st_isdir = 0;
+  802644:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80264b:	00 00 00 
+	stat->st_dev = dev;
+  80264e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802654:	83 ec 08             	sub    $0x8,%esp
+  802657:	53                   	push   %ebx
+  802658:	56                   	push   %esi
+  802659:	ff 50 14             	call   *0x14(%eax)
+  80265c:	83 c4 10             	add    $0x10,%esp
+}
+  80265f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802662:	5b                   	pop    %ebx
+  802663:	5e                   	pop    %esi
+  802664:	5d                   	pop    %ebp
+  802665:	c3                   	ret
+		return -E_NOT_SUPP;
+  802666:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80266b:	eb f2                	jmp    80265f <fstat+0x67>
+
+0080266d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80266d:	55                   	push   %ebp
+  80266e:	89 e5                	mov    %esp,%ebp
+  802670:	56                   	push   %esi
+  802671:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802672:	83 ec 08             	sub    $0x8,%esp
+  802675:	6a 00                	push   $0x0
+  802677:	ff 75 08             	push   0x8(%ebp)
+  80267a:	e8 e4 01 00 00       	call   802863 <open>
+  80267f:	89 c3                	mov    %eax,%ebx
+  802681:	83 c4 10             	add    $0x10,%esp
+  802684:	85 c0                	test   %eax,%eax
+  802686:	78 1b                	js     8026a3 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802688:	83 ec 08             	sub    $0x8,%esp
+  80268b:	ff 75 0c             	push   0xc(%ebp)
+  80268e:	50                   	push   %eax
+  80268f:	e8 64 ff ff ff       	call   8025f8 <fstat>
+  802694:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802696:	89 1c 24             	mov    %ebx,(%esp)
+  802699:	e8 c6 fb ff ff       	call   802264 <close>
+	return r;
+  80269e:	83 c4 10             	add    $0x10,%esp
+  8026a1:	89 f3                	mov    %esi,%ebx
+}
+  8026a3:	89 d8                	mov    %ebx,%eax
+  8026a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a8:	5b                   	pop    %ebx
+  8026a9:	5e                   	pop    %esi
+  8026aa:	5d                   	pop    %ebp
+  8026ab:	c3                   	ret
+
+008026ac <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+  8026af:	56                   	push   %esi
+  8026b0:	53                   	push   %ebx
+  8026b1:	89 c6                	mov    %eax,%esi
+  8026b3:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8026b5:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8026bc:	74 27                	je     8026e5 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8026be:	6a 07                	push   $0x7
+  8026c0:	68 00 60 80 00       	push   $0x806000
+  8026c5:	56                   	push   %esi
+  8026c6:	ff 35 00 50 80 00    	push   0x805000
+  8026cc:	e8 17 f7 ff ff       	call   801de8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8026d1:	83 c4 0c             	add    $0xc,%esp
+  8026d4:	6a 00                	push   $0x0
+  8026d6:	53                   	push   %ebx
+  8026d7:	6a 00                	push   $0x0
+  8026d9:	e8 f2 f6 ff ff       	call   801dd0 <ipc_recv>
+}
+  8026de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e1:	5b                   	pop    %ebx
+  8026e2:	5e                   	pop    %esi
+  8026e3:	5d                   	pop    %ebp
+  8026e4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026e5:	83 ec 0c             	sub    $0xc,%esp
+  8026e8:	6a 01                	push   $0x1
+  8026ea:	e8 4d f7 ff ff       	call   801e3c <ipc_find_env>
+  8026ef:	a3 00 50 80 00       	mov    %eax,0x805000
+  8026f4:	83 c4 10             	add    $0x10,%esp
+  8026f7:	eb c5                	jmp    8026be <fsipc+0x12>
+
+008026f9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8026f9:	55                   	push   %ebp
+  8026fa:	89 e5                	mov    %esp,%ebp
+  8026fc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8026ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802702:	8b 40 0c             	mov    0xc(%eax),%eax
+  802705:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80270a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80270d:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802712:	ba 00 00 00 00       	mov    $0x0,%edx
+  802717:	b8 02 00 00 00       	mov    $0x2,%eax
+  80271c:	e8 8b ff ff ff       	call   8026ac <fsipc>
+}
+  802721:	c9                   	leave
+  802722:	c3                   	ret
+
+00802723 <devfile_flush>:
+{
+  802723:	55                   	push   %ebp
+  802724:	89 e5                	mov    %esp,%ebp
+  802726:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80272c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80272f:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802734:	ba 00 00 00 00       	mov    $0x0,%edx
+  802739:	b8 06 00 00 00       	mov    $0x6,%eax
+  80273e:	e8 69 ff ff ff       	call   8026ac <fsipc>
+}
+  802743:	c9                   	leave
+  802744:	c3                   	ret
+
+00802745 <devfile_stat>:
+{
+  802745:	55                   	push   %ebp
+  802746:	89 e5                	mov    %esp,%ebp
+  802748:	53                   	push   %ebx
+  802749:	83 ec 04             	sub    $0x4,%esp
+  80274c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80274f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802752:	8b 40 0c             	mov    0xc(%eax),%eax
+  802755:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80275a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802764:	e8 43 ff ff ff       	call   8026ac <fsipc>
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	78 2c                	js     802799 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80276d:	83 ec 08             	sub    $0x8,%esp
+  802770:	68 00 60 80 00       	push   $0x806000
+  802775:	53                   	push   %ebx
+  802776:	e8 2c e1 ff ff       	call   8008a7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80277b:	a1 80 60 80 00       	mov    0x806080,%eax
+  802780:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802786:	a1 84 60 80 00       	mov    0x806084,%eax
+  80278b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802791:	83 c4 10             	add    $0x10,%esp
+  802794:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802799:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80279c:	c9                   	leave
+  80279d:	c3                   	ret
+
+0080279e <devfile_write>:
+{
+  80279e:	55                   	push   %ebp
+  80279f:	89 e5                	mov    %esp,%ebp
+  8027a1:	83 ec 0c             	sub    $0xc,%esp
+  8027a4:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027aa:	8b 52 0c             	mov    0xc(%edx),%edx
+  8027ad:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8027b3:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8027b8:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8027bd:	39 d0                	cmp    %edx,%eax
+  8027bf:	0f 47 c2             	cmova  %edx,%eax
+  8027c2:	50                   	push   %eax
+  8027c3:	ff 75 0c             	push   0xc(%ebp)
+  8027c6:	68 08 60 80 00       	push   $0x806008
+  8027cb:	e8 5d e2 ff ff       	call   800a2d <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8027d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027da:	e8 cd fe ff ff       	call   8026ac <fsipc>
+}
+  8027df:	c9                   	leave
+  8027e0:	c3                   	ret
+
+008027e1 <devfile_read>:
+{
+  8027e1:	55                   	push   %ebp
+  8027e2:	89 e5                	mov    %esp,%ebp
+  8027e4:	56                   	push   %esi
+  8027e5:	53                   	push   %ebx
+  8027e6:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ec:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027ef:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8027f4:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8027fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ff:	b8 03 00 00 00       	mov    $0x3,%eax
+  802804:	e8 a3 fe ff ff       	call   8026ac <fsipc>
+  802809:	89 c3                	mov    %eax,%ebx
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	78 1f                	js     80282e <devfile_read+0x4d>
+	assert(r <= n);
+  80280f:	39 c6                	cmp    %eax,%esi
+  802811:	72 24                	jb     802837 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802813:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802818:	7f 33                	jg     80284d <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80281a:	83 ec 04             	sub    $0x4,%esp
+  80281d:	50                   	push   %eax
+  80281e:	68 00 60 80 00       	push   $0x806000
+  802823:	ff 75 0c             	push   0xc(%ebp)
+  802826:	e8 02 e2 ff ff       	call   800a2d <memmove>
+	return r;
+  80282b:	83 c4 10             	add    $0x10,%esp
+}
+  80282e:	89 d8                	mov    %ebx,%eax
+  802830:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802833:	5b                   	pop    %ebx
+  802834:	5e                   	pop    %esi
+  802835:	5d                   	pop    %ebp
+  802836:	c3                   	ret
+	assert(r <= n);
+  802837:	68 00 39 80 00       	push   $0x803900
+  80283c:	68 d0 37 80 00       	push   $0x8037d0
+  802841:	6a 76                	push   $0x76
+  802843:	68 07 39 80 00       	push   $0x803907
+  802848:	e8 37 d9 ff ff       	call   800184 <_panic>
+	assert(r <= PGSIZE);
+  80284d:	68 12 39 80 00       	push   $0x803912
+  802852:	68 d0 37 80 00       	push   $0x8037d0
+  802857:	6a 77                	push   $0x77
+  802859:	68 07 39 80 00       	push   $0x803907
+  80285e:	e8 21 d9 ff ff       	call   800184 <_panic>
+
+00802863 <open>:
+{
+  802863:	55                   	push   %ebp
+  802864:	89 e5                	mov    %esp,%ebp
+  802866:	56                   	push   %esi
+  802867:	53                   	push   %ebx
+  802868:	83 ec 1c             	sub    $0x1c,%esp
+  80286b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80286e:	56                   	push   %esi
+  80286f:	e8 f8 df ff ff       	call   80086c <strlen>
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80287c:	7f 6c                	jg     8028ea <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80287e:	83 ec 0c             	sub    $0xc,%esp
+  802881:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802884:	50                   	push   %eax
+  802885:	e8 3a f8 ff ff       	call   8020c4 <fd_alloc>
+  80288a:	89 c3                	mov    %eax,%ebx
+  80288c:	83 c4 10             	add    $0x10,%esp
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	78 3c                	js     8028cf <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802893:	83 ec 08             	sub    $0x8,%esp
+  802896:	56                   	push   %esi
+  802897:	68 00 60 80 00       	push   $0x806000
+  80289c:	e8 06 e0 ff ff       	call   8008a7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8028a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028a4:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8028a9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028b1:	e8 f6 fd ff ff       	call   8026ac <fsipc>
+  8028b6:	89 c3                	mov    %eax,%ebx
+  8028b8:	83 c4 10             	add    $0x10,%esp
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	78 19                	js     8028d8 <open+0x75>
+	return fd2num(fd);
+  8028bf:	83 ec 0c             	sub    $0xc,%esp
+  8028c2:	ff 75 f4             	push   -0xc(%ebp)
+  8028c5:	e8 d3 f7 ff ff       	call   80209d <fd2num>
+  8028ca:	89 c3                	mov    %eax,%ebx
+  8028cc:	83 c4 10             	add    $0x10,%esp
+}
+  8028cf:	89 d8                	mov    %ebx,%eax
+  8028d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028d4:	5b                   	pop    %ebx
+  8028d5:	5e                   	pop    %esi
+  8028d6:	5d                   	pop    %ebp
+  8028d7:	c3                   	ret
+		fd_close(fd, 0);
+  8028d8:	83 ec 08             	sub    $0x8,%esp
+  8028db:	6a 00                	push   $0x0
+  8028dd:	ff 75 f4             	push   -0xc(%ebp)
+  8028e0:	e8 f8 f8 ff ff       	call   8021dd <fd_close>
+		return r;
+  8028e5:	83 c4 10             	add    $0x10,%esp
+  8028e8:	eb e5                	jmp    8028cf <open+0x6c>
+		return -E_BAD_PATH;
+  8028ea:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8028ef:	eb de                	jmp    8028cf <open+0x6c>
+
+008028f1 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8028f1:	55                   	push   %ebp
+  8028f2:	89 e5                	mov    %esp,%ebp
+  8028f4:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8028f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028fc:	b8 08 00 00 00       	mov    $0x8,%eax
+  802901:	e8 a6 fd ff ff       	call   8026ac <fsipc>
+}
+  802906:	c9                   	leave
+  802907:	c3                   	ret
+
+00802908 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802908:	55                   	push   %ebp
+  802909:	89 e5                	mov    %esp,%ebp
+  80290b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80290e:	68 1e 39 80 00       	push   $0x80391e
+  802913:	ff 75 0c             	push   0xc(%ebp)
+  802916:	e8 8c df ff ff       	call   8008a7 <strcpy>
+	return 0;
+}
+  80291b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802920:	c9                   	leave
+  802921:	c3                   	ret
+
+00802922 <devsock_close>:
+{
+  802922:	55                   	push   %ebp
+  802923:	89 e5                	mov    %esp,%ebp
+  802925:	53                   	push   %ebx
+  802926:	83 ec 10             	sub    $0x10,%esp
+  802929:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80292c:	53                   	push   %ebx
+  80292d:	e8 f3 09 00 00       	call   803325 <pageref>
+  802932:	89 c2                	mov    %eax,%edx
+  802934:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80293c:	83 fa 01             	cmp    $0x1,%edx
+  80293f:	74 05                	je     802946 <devsock_close+0x24>
+}
+  802941:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802944:	c9                   	leave
+  802945:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802946:	83 ec 0c             	sub    $0xc,%esp
+  802949:	ff 73 0c             	push   0xc(%ebx)
+  80294c:	e8 b7 02 00 00       	call   802c08 <nsipc_close>
+  802951:	83 c4 10             	add    $0x10,%esp
+  802954:	eb eb                	jmp    802941 <devsock_close+0x1f>
+
+00802956 <devsock_write>:
+{
+  802956:	55                   	push   %ebp
+  802957:	89 e5                	mov    %esp,%ebp
+  802959:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80295c:	6a 00                	push   $0x0
+  80295e:	ff 75 10             	push   0x10(%ebp)
+  802961:	ff 75 0c             	push   0xc(%ebp)
+  802964:	8b 45 08             	mov    0x8(%ebp),%eax
+  802967:	ff 70 0c             	push   0xc(%eax)
+  80296a:	e8 79 03 00 00       	call   802ce8 <nsipc_send>
+}
+  80296f:	c9                   	leave
+  802970:	c3                   	ret
+
+00802971 <devsock_read>:
+{
+  802971:	55                   	push   %ebp
+  802972:	89 e5                	mov    %esp,%ebp
+  802974:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802977:	6a 00                	push   $0x0
+  802979:	ff 75 10             	push   0x10(%ebp)
+  80297c:	ff 75 0c             	push   0xc(%ebp)
+  80297f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802982:	ff 70 0c             	push   0xc(%eax)
+  802985:	e8 ef 02 00 00       	call   802c79 <nsipc_recv>
+}
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <fd2sockid>:
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802992:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802995:	52                   	push   %edx
+  802996:	50                   	push   %eax
+  802997:	e8 7e f7 ff ff       	call   80211a <fd_lookup>
+  80299c:	83 c4 10             	add    $0x10,%esp
+  80299f:	85 c0                	test   %eax,%eax
+  8029a1:	78 10                	js     8029b3 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8029a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029a6:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8029ac:	39 08                	cmp    %ecx,(%eax)
+  8029ae:	75 05                	jne    8029b5 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8029b0:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8029b3:	c9                   	leave
+  8029b4:	c3                   	ret
+		return -E_NOT_SUPP;
+  8029b5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029ba:	eb f7                	jmp    8029b3 <fd2sockid+0x27>
+
+008029bc <alloc_sockfd>:
+{
+  8029bc:	55                   	push   %ebp
+  8029bd:	89 e5                	mov    %esp,%ebp
+  8029bf:	56                   	push   %esi
+  8029c0:	53                   	push   %ebx
+  8029c1:	83 ec 1c             	sub    $0x1c,%esp
+  8029c4:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8029c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029c9:	50                   	push   %eax
+  8029ca:	e8 f5 f6 ff ff       	call   8020c4 <fd_alloc>
+  8029cf:	89 c3                	mov    %eax,%ebx
+  8029d1:	83 c4 10             	add    $0x10,%esp
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	78 43                	js     802a1b <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8029d8:	83 ec 04             	sub    $0x4,%esp
+  8029db:	68 07 04 00 00       	push   $0x407
+  8029e0:	ff 75 f4             	push   -0xc(%ebp)
+  8029e3:	6a 00                	push   $0x0
+  8029e5:	e8 b5 e3 ff ff       	call   800d9f <sys_page_alloc>
+  8029ea:	89 c3                	mov    %eax,%ebx
+  8029ec:	83 c4 10             	add    $0x10,%esp
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	78 28                	js     802a1b <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8029f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029f6:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8029fc:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8029fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a01:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802a08:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802a0b:	83 ec 0c             	sub    $0xc,%esp
+  802a0e:	50                   	push   %eax
+  802a0f:	e8 89 f6 ff ff       	call   80209d <fd2num>
+  802a14:	89 c3                	mov    %eax,%ebx
+  802a16:	83 c4 10             	add    $0x10,%esp
+  802a19:	eb 0c                	jmp    802a27 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a1b:	83 ec 0c             	sub    $0xc,%esp
+  802a1e:	56                   	push   %esi
+  802a1f:	e8 e4 01 00 00       	call   802c08 <nsipc_close>
+		return r;
+  802a24:	83 c4 10             	add    $0x10,%esp
+}
+  802a27:	89 d8                	mov    %ebx,%eax
+  802a29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a2c:	5b                   	pop    %ebx
+  802a2d:	5e                   	pop    %esi
+  802a2e:	5d                   	pop    %ebp
+  802a2f:	c3                   	ret
+
+00802a30 <accept>:
+{
+  802a30:	55                   	push   %ebp
+  802a31:	89 e5                	mov    %esp,%ebp
+  802a33:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a39:	e8 4e ff ff ff       	call   80298c <fd2sockid>
+  802a3e:	85 c0                	test   %eax,%eax
+  802a40:	78 1b                	js     802a5d <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802a42:	83 ec 04             	sub    $0x4,%esp
+  802a45:	ff 75 10             	push   0x10(%ebp)
+  802a48:	ff 75 0c             	push   0xc(%ebp)
+  802a4b:	50                   	push   %eax
+  802a4c:	e8 0e 01 00 00       	call   802b5f <nsipc_accept>
+  802a51:	83 c4 10             	add    $0x10,%esp
+  802a54:	85 c0                	test   %eax,%eax
+  802a56:	78 05                	js     802a5d <accept+0x2d>
+	return alloc_sockfd(r);
+  802a58:	e8 5f ff ff ff       	call   8029bc <alloc_sockfd>
+}
+  802a5d:	c9                   	leave
+  802a5e:	c3                   	ret
+
+00802a5f <bind>:
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a68:	e8 1f ff ff ff       	call   80298c <fd2sockid>
+  802a6d:	85 c0                	test   %eax,%eax
+  802a6f:	78 12                	js     802a83 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802a71:	83 ec 04             	sub    $0x4,%esp
+  802a74:	ff 75 10             	push   0x10(%ebp)
+  802a77:	ff 75 0c             	push   0xc(%ebp)
+  802a7a:	50                   	push   %eax
+  802a7b:	e8 31 01 00 00       	call   802bb1 <nsipc_bind>
+  802a80:	83 c4 10             	add    $0x10,%esp
+}
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+00802a85 <shutdown>:
+{
+  802a85:	55                   	push   %ebp
+  802a86:	89 e5                	mov    %esp,%ebp
+  802a88:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8e:	e8 f9 fe ff ff       	call   80298c <fd2sockid>
+  802a93:	85 c0                	test   %eax,%eax
+  802a95:	78 0f                	js     802aa6 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802a97:	83 ec 08             	sub    $0x8,%esp
+  802a9a:	ff 75 0c             	push   0xc(%ebp)
+  802a9d:	50                   	push   %eax
+  802a9e:	e8 43 01 00 00       	call   802be6 <nsipc_shutdown>
+  802aa3:	83 c4 10             	add    $0x10,%esp
+}
+  802aa6:	c9                   	leave
+  802aa7:	c3                   	ret
+
+00802aa8 <connect>:
+{
+  802aa8:	55                   	push   %ebp
+  802aa9:	89 e5                	mov    %esp,%ebp
+  802aab:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab1:	e8 d6 fe ff ff       	call   80298c <fd2sockid>
+  802ab6:	85 c0                	test   %eax,%eax
+  802ab8:	78 12                	js     802acc <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802aba:	83 ec 04             	sub    $0x4,%esp
+  802abd:	ff 75 10             	push   0x10(%ebp)
+  802ac0:	ff 75 0c             	push   0xc(%ebp)
+  802ac3:	50                   	push   %eax
+  802ac4:	e8 59 01 00 00       	call   802c22 <nsipc_connect>
+  802ac9:	83 c4 10             	add    $0x10,%esp
+}
+  802acc:	c9                   	leave
+  802acd:	c3                   	ret
+
+00802ace <listen>:
+{
+  802ace:	55                   	push   %ebp
+  802acf:	89 e5                	mov    %esp,%ebp
+  802ad1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad7:	e8 b0 fe ff ff       	call   80298c <fd2sockid>
+  802adc:	85 c0                	test   %eax,%eax
+  802ade:	78 0f                	js     802aef <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ae0:	83 ec 08             	sub    $0x8,%esp
+  802ae3:	ff 75 0c             	push   0xc(%ebp)
+  802ae6:	50                   	push   %eax
+  802ae7:	e8 6b 01 00 00       	call   802c57 <nsipc_listen>
+  802aec:	83 c4 10             	add    $0x10,%esp
+}
+  802aef:	c9                   	leave
+  802af0:	c3                   	ret
+
+00802af1 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802af1:	55                   	push   %ebp
+  802af2:	89 e5                	mov    %esp,%ebp
+  802af4:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802af7:	ff 75 10             	push   0x10(%ebp)
+  802afa:	ff 75 0c             	push   0xc(%ebp)
+  802afd:	ff 75 08             	push   0x8(%ebp)
+  802b00:	e8 41 02 00 00       	call   802d46 <nsipc_socket>
+  802b05:	83 c4 10             	add    $0x10,%esp
+  802b08:	85 c0                	test   %eax,%eax
+  802b0a:	78 05                	js     802b11 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b0c:	e8 ab fe ff ff       	call   8029bc <alloc_sockfd>
+}
+  802b11:	c9                   	leave
+  802b12:	c3                   	ret
+
+00802b13 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	53                   	push   %ebx
+  802b17:	83 ec 04             	sub    $0x4,%esp
+  802b1a:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b1c:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802b23:	74 26                	je     802b4b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b25:	6a 07                	push   $0x7
+  802b27:	68 00 70 80 00       	push   $0x807000
+  802b2c:	53                   	push   %ebx
+  802b2d:	ff 35 04 50 80 00    	push   0x805004
+  802b33:	e8 b0 f2 ff ff       	call   801de8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b38:	83 c4 0c             	add    $0xc,%esp
+  802b3b:	6a 00                	push   $0x0
+  802b3d:	6a 00                	push   $0x0
+  802b3f:	6a 00                	push   $0x0
+  802b41:	e8 8a f2 ff ff       	call   801dd0 <ipc_recv>
+}
+  802b46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b4b:	83 ec 0c             	sub    $0xc,%esp
+  802b4e:	6a 02                	push   $0x2
+  802b50:	e8 e7 f2 ff ff       	call   801e3c <ipc_find_env>
+  802b55:	a3 04 50 80 00       	mov    %eax,0x805004
+  802b5a:	83 c4 10             	add    $0x10,%esp
+  802b5d:	eb c6                	jmp    802b25 <nsipc+0x12>
+
+00802b5f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802b5f:	55                   	push   %ebp
+  802b60:	89 e5                	mov    %esp,%ebp
+  802b62:	56                   	push   %esi
+  802b63:	53                   	push   %ebx
+  802b64:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802b6f:	8b 06                	mov    (%esi),%eax
+  802b71:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b76:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b7b:	e8 93 ff ff ff       	call   802b13 <nsipc>
+  802b80:	89 c3                	mov    %eax,%ebx
+  802b82:	85 c0                	test   %eax,%eax
+  802b84:	79 09                	jns    802b8f <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802b86:	89 d8                	mov    %ebx,%eax
+  802b88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b8b:	5b                   	pop    %ebx
+  802b8c:	5e                   	pop    %esi
+  802b8d:	5d                   	pop    %ebp
+  802b8e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b8f:	83 ec 04             	sub    $0x4,%esp
+  802b92:	ff 35 10 70 80 00    	push   0x807010
+  802b98:	68 00 70 80 00       	push   $0x807000
+  802b9d:	ff 75 0c             	push   0xc(%ebp)
+  802ba0:	e8 88 de ff ff       	call   800a2d <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ba5:	a1 10 70 80 00       	mov    0x807010,%eax
+  802baa:	89 06                	mov    %eax,(%esi)
+  802bac:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802baf:	eb d5                	jmp    802b86 <nsipc_accept+0x27>
+
+00802bb1 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802bb1:	55                   	push   %ebp
+  802bb2:	89 e5                	mov    %esp,%ebp
+  802bb4:	53                   	push   %ebx
+  802bb5:	83 ec 08             	sub    $0x8,%esp
+  802bb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802bbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbe:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802bc3:	53                   	push   %ebx
+  802bc4:	ff 75 0c             	push   0xc(%ebp)
+  802bc7:	68 04 70 80 00       	push   $0x807004
+  802bcc:	e8 5c de ff ff       	call   800a2d <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802bd1:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802bd7:	b8 02 00 00 00       	mov    $0x2,%eax
+  802bdc:	e8 32 ff ff ff       	call   802b13 <nsipc>
+}
+  802be1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802be4:	c9                   	leave
+  802be5:	c3                   	ret
+
+00802be6 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bef:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802bf4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bf7:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802bfc:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c01:	e8 0d ff ff ff       	call   802b13 <nsipc>
+}
+  802c06:	c9                   	leave
+  802c07:	c3                   	ret
+
+00802c08 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c08:	55                   	push   %ebp
+  802c09:	89 e5                	mov    %esp,%ebp
+  802c0b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c11:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802c16:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c1b:	e8 f3 fe ff ff       	call   802b13 <nsipc>
+}
+  802c20:	c9                   	leave
+  802c21:	c3                   	ret
+
+00802c22 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c22:	55                   	push   %ebp
+  802c23:	89 e5                	mov    %esp,%ebp
+  802c25:	53                   	push   %ebx
+  802c26:	83 ec 08             	sub    $0x8,%esp
+  802c29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2f:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c34:	53                   	push   %ebx
+  802c35:	ff 75 0c             	push   0xc(%ebp)
+  802c38:	68 04 70 80 00       	push   $0x807004
+  802c3d:	e8 eb dd ff ff       	call   800a2d <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c42:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802c48:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c4d:	e8 c1 fe ff ff       	call   802b13 <nsipc>
+}
+  802c52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c55:	c9                   	leave
+  802c56:	c3                   	ret
+
+00802c57 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802c5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c60:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802c65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c68:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802c6d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c72:	e8 9c fe ff ff       	call   802b13 <nsipc>
+}
+  802c77:	c9                   	leave
+  802c78:	c3                   	ret
+
+00802c79 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802c79:	55                   	push   %ebp
+  802c7a:	89 e5                	mov    %esp,%ebp
+  802c7c:	56                   	push   %esi
+  802c7d:	53                   	push   %ebx
+  802c7e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802c81:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c84:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802c89:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802c8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c92:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c97:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c9c:	e8 72 fe ff ff       	call   802b13 <nsipc>
+  802ca1:	89 c3                	mov    %eax,%ebx
+  802ca3:	85 c0                	test   %eax,%eax
+  802ca5:	78 22                	js     802cc9 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ca7:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802cac:	39 c6                	cmp    %eax,%esi
+  802cae:	0f 4e c6             	cmovle %esi,%eax
+  802cb1:	39 c3                	cmp    %eax,%ebx
+  802cb3:	7f 1d                	jg     802cd2 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802cb5:	83 ec 04             	sub    $0x4,%esp
+  802cb8:	53                   	push   %ebx
+  802cb9:	68 00 70 80 00       	push   $0x807000
+  802cbe:	ff 75 0c             	push   0xc(%ebp)
+  802cc1:	e8 67 dd ff ff       	call   800a2d <memmove>
+  802cc6:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802cc9:	89 d8                	mov    %ebx,%eax
+  802ccb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cce:	5b                   	pop    %ebx
+  802ccf:	5e                   	pop    %esi
+  802cd0:	5d                   	pop    %ebp
+  802cd1:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802cd2:	68 2a 39 80 00       	push   $0x80392a
+  802cd7:	68 d0 37 80 00       	push   $0x8037d0
+  802cdc:	6a 62                	push   $0x62
+  802cde:	68 3f 39 80 00       	push   $0x80393f
+  802ce3:	e8 9c d4 ff ff       	call   800184 <_panic>
+
+00802ce8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ce8:	55                   	push   %ebp
+  802ce9:	89 e5                	mov    %esp,%ebp
+  802ceb:	53                   	push   %ebx
+  802cec:	83 ec 04             	sub    $0x4,%esp
+  802cef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf5:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802cfa:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d00:	7f 2e                	jg     802d30 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d02:	83 ec 04             	sub    $0x4,%esp
+  802d05:	53                   	push   %ebx
+  802d06:	ff 75 0c             	push   0xc(%ebp)
+  802d09:	68 0c 70 80 00       	push   $0x80700c
+  802d0e:	e8 1a dd ff ff       	call   800a2d <memmove>
+	nsipcbuf.send.req_size = size;
+  802d13:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802d19:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d1c:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802d21:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d26:	e8 e8 fd ff ff       	call   802b13 <nsipc>
+}
+  802d2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d2e:	c9                   	leave
+  802d2f:	c3                   	ret
+	assert(size < 1600);
+  802d30:	68 4b 39 80 00       	push   $0x80394b
+  802d35:	68 d0 37 80 00       	push   $0x8037d0
+  802d3a:	6a 6d                	push   $0x6d
+  802d3c:	68 3f 39 80 00       	push   $0x80393f
+  802d41:	e8 3e d4 ff ff       	call   800184 <_panic>
+
+00802d46 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d46:	55                   	push   %ebp
+  802d47:	89 e5                	mov    %esp,%ebp
+  802d49:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802d54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d57:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802d5c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d5f:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802d64:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d69:	e8 a5 fd ff ff       	call   802b13 <nsipc>
+}
+  802d6e:	c9                   	leave
+  802d6f:	c3                   	ret
+
+00802d70 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d70:	55                   	push   %ebp
+  802d71:	89 e5                	mov    %esp,%ebp
+  802d73:	56                   	push   %esi
+  802d74:	53                   	push   %ebx
+  802d75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802d78:	83 ec 0c             	sub    $0xc,%esp
+  802d7b:	ff 75 08             	push   0x8(%ebp)
+  802d7e:	e8 2a f3 ff ff       	call   8020ad <fd2data>
+  802d83:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802d85:	83 c4 08             	add    $0x8,%esp
+  802d88:	68 57 39 80 00       	push   $0x803957
+  802d8d:	53                   	push   %ebx
+  802d8e:	e8 14 db ff ff       	call   8008a7 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802d93:	8b 46 04             	mov    0x4(%esi),%eax
+  802d96:	2b 06                	sub    (%esi),%eax
+  802d98:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802d9e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802da5:	00 00 00 
+	stat->st_dev = &devpipe;
+  802da8:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802daf:	40 80 00 
+	return 0;
+}
+  802db2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dba:	5b                   	pop    %ebx
+  802dbb:	5e                   	pop    %esi
+  802dbc:	5d                   	pop    %ebp
+  802dbd:	c3                   	ret
+
+00802dbe <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802dbe:	55                   	push   %ebp
+  802dbf:	89 e5                	mov    %esp,%ebp
+  802dc1:	53                   	push   %ebx
+  802dc2:	83 ec 0c             	sub    $0xc,%esp
+  802dc5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802dc8:	53                   	push   %ebx
+  802dc9:	6a 00                	push   $0x0
+  802dcb:	e8 aa e0 ff ff       	call   800e7a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802dd0:	89 1c 24             	mov    %ebx,(%esp)
+  802dd3:	e8 d5 f2 ff ff       	call   8020ad <fd2data>
+  802dd8:	83 c4 08             	add    $0x8,%esp
+  802ddb:	50                   	push   %eax
+  802ddc:	6a 00                	push   $0x0
+  802dde:	e8 97 e0 ff ff       	call   800e7a <sys_page_unmap>
+}
+  802de3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802de6:	c9                   	leave
+  802de7:	c3                   	ret
+
+00802de8 <_pipeisclosed>:
+{
+  802de8:	55                   	push   %ebp
+  802de9:	89 e5                	mov    %esp,%ebp
+  802deb:	57                   	push   %edi
+  802dec:	56                   	push   %esi
+  802ded:	53                   	push   %ebx
+  802dee:	83 ec 1c             	sub    $0x1c,%esp
+  802df1:	89 c7                	mov    %eax,%edi
+  802df3:	89 d6                	mov    %edx,%esi
+  802df5:	eb 3c                	jmp    802e33 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802df7:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802dfa:	83 ec 0c             	sub    $0xc,%esp
+  802dfd:	57                   	push   %edi
+  802dfe:	e8 22 05 00 00       	call   803325 <pageref>
+  802e03:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e06:	89 34 24             	mov    %esi,(%esp)
+  802e09:	e8 17 05 00 00       	call   803325 <pageref>
+  802e0e:	89 c2                	mov    %eax,%edx
+  802e10:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e12:	05 00 00 00 20       	add    $0x20000000,%eax
+  802e17:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802e1a:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e20:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e25:	76 31                	jbe    802e58 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802e27:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802e2a:	39 c3                	cmp    %eax,%ebx
+  802e2c:	74 76                	je     802ea4 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802e2e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802e31:	74 36                	je     802e69 <_pipeisclosed+0x81>
+  802e33:	89 e0                	mov    %esp,%eax
+  802e35:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e3a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e40:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e45:	77 b0                	ja     802df7 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e47:	c1 e8 10             	shr    $0x10,%eax
+  802e4a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e50:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e56:	eb 9f                	jmp    802df7 <_pipeisclosed+0xf>
+  802e58:	c1 e8 10             	shr    $0x10,%eax
+  802e5b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e61:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802e67:	eb be                	jmp    802e27 <_pipeisclosed+0x3f>
+  802e69:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e6b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e70:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e76:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e7b:	76 16                	jbe    802e93 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e7d:	8b 42 58             	mov    0x58(%edx),%eax
+  802e80:	6a 01                	push   $0x1
+  802e82:	50                   	push   %eax
+  802e83:	53                   	push   %ebx
+  802e84:	68 5e 39 80 00       	push   $0x80395e
+  802e89:	e8 d1 d3 ff ff       	call   80025f <cprintf>
+  802e8e:	83 c4 10             	add    $0x10,%esp
+  802e91:	eb a0                	jmp    802e33 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e93:	c1 e8 10             	shr    $0x10,%eax
+  802e96:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e9c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ea2:	eb d9                	jmp    802e7d <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802ea4:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802ea7:	0f 94 c0             	sete   %al
+  802eaa:	0f b6 c0             	movzbl %al,%eax
+}
+  802ead:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eb0:	5b                   	pop    %ebx
+  802eb1:	5e                   	pop    %esi
+  802eb2:	5f                   	pop    %edi
+  802eb3:	5d                   	pop    %ebp
+  802eb4:	c3                   	ret
+
+00802eb5 <devpipe_write>:
+{
+  802eb5:	55                   	push   %ebp
+  802eb6:	89 e5                	mov    %esp,%ebp
+  802eb8:	57                   	push   %edi
+  802eb9:	56                   	push   %esi
+  802eba:	53                   	push   %ebx
+  802ebb:	83 ec 28             	sub    $0x28,%esp
+  802ebe:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802ec1:	56                   	push   %esi
+  802ec2:	e8 e6 f1 ff ff       	call   8020ad <fd2data>
+  802ec7:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ec9:	83 c4 10             	add    $0x10,%esp
+  802ecc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ed1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ed4:	75 09                	jne    802edf <devpipe_write+0x2a>
+	return i;
+  802ed6:	89 f8                	mov    %edi,%eax
+  802ed8:	eb 23                	jmp    802efd <devpipe_write+0x48>
+			sys_yield();
+  802eda:	e8 7a de ff ff       	call   800d59 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802edf:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ee2:	8b 0b                	mov    (%ebx),%ecx
+  802ee4:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ee7:	39 d0                	cmp    %edx,%eax
+  802ee9:	72 1a                	jb     802f05 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802eeb:	89 da                	mov    %ebx,%edx
+  802eed:	89 f0                	mov    %esi,%eax
+  802eef:	e8 f4 fe ff ff       	call   802de8 <_pipeisclosed>
+  802ef4:	85 c0                	test   %eax,%eax
+  802ef6:	74 e2                	je     802eda <devpipe_write+0x25>
+				return 0;
+  802ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f00:	5b                   	pop    %ebx
+  802f01:	5e                   	pop    %esi
+  802f02:	5f                   	pop    %edi
+  802f03:	5d                   	pop    %ebp
+  802f04:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f05:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f08:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f0c:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f0f:	89 c2                	mov    %eax,%edx
+  802f11:	c1 fa 1f             	sar    $0x1f,%edx
+  802f14:	89 d1                	mov    %edx,%ecx
+  802f16:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f19:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f1c:	83 e2 1f             	and    $0x1f,%edx
+  802f1f:	29 ca                	sub    %ecx,%edx
+  802f21:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f25:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802f29:	83 c0 01             	add    $0x1,%eax
+  802f2c:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802f2f:	83 c7 01             	add    $0x1,%edi
+  802f32:	eb 9d                	jmp    802ed1 <devpipe_write+0x1c>
+
+00802f34 <devpipe_read>:
+{
+  802f34:	55                   	push   %ebp
+  802f35:	89 e5                	mov    %esp,%ebp
+  802f37:	57                   	push   %edi
+  802f38:	56                   	push   %esi
+  802f39:	53                   	push   %ebx
+  802f3a:	83 ec 18             	sub    $0x18,%esp
+  802f3d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802f40:	57                   	push   %edi
+  802f41:	e8 67 f1 ff ff       	call   8020ad <fd2data>
+  802f46:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f48:	83 c4 10             	add    $0x10,%esp
+  802f4b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f50:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f53:	75 13                	jne    802f68 <devpipe_read+0x34>
+	return i;
+  802f55:	89 f0                	mov    %esi,%eax
+  802f57:	eb 02                	jmp    802f5b <devpipe_read+0x27>
+				return i;
+  802f59:	89 f0                	mov    %esi,%eax
+}
+  802f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5e:	5b                   	pop    %ebx
+  802f5f:	5e                   	pop    %esi
+  802f60:	5f                   	pop    %edi
+  802f61:	5d                   	pop    %ebp
+  802f62:	c3                   	ret
+			sys_yield();
+  802f63:	e8 f1 dd ff ff       	call   800d59 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802f68:	8b 03                	mov    (%ebx),%eax
+  802f6a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f6d:	75 18                	jne    802f87 <devpipe_read+0x53>
+			if (i > 0)
+  802f6f:	85 f6                	test   %esi,%esi
+  802f71:	75 e6                	jne    802f59 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802f73:	89 da                	mov    %ebx,%edx
+  802f75:	89 f8                	mov    %edi,%eax
+  802f77:	e8 6c fe ff ff       	call   802de8 <_pipeisclosed>
+  802f7c:	85 c0                	test   %eax,%eax
+  802f7e:	74 e3                	je     802f63 <devpipe_read+0x2f>
+				return 0;
+  802f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f85:	eb d4                	jmp    802f5b <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f87:	99                   	cltd
+  802f88:	c1 ea 1b             	shr    $0x1b,%edx
+  802f8b:	01 d0                	add    %edx,%eax
+  802f8d:	83 e0 1f             	and    $0x1f,%eax
+  802f90:	29 d0                	sub    %edx,%eax
+  802f92:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f9a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802f9d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802fa0:	83 c6 01             	add    $0x1,%esi
+  802fa3:	eb ab                	jmp    802f50 <devpipe_read+0x1c>
+
+00802fa5 <pipe>:
+{
+  802fa5:	55                   	push   %ebp
+  802fa6:	89 e5                	mov    %esp,%ebp
+  802fa8:	56                   	push   %esi
+  802fa9:	53                   	push   %ebx
+  802faa:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802fad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fb0:	50                   	push   %eax
+  802fb1:	e8 0e f1 ff ff       	call   8020c4 <fd_alloc>
+  802fb6:	89 c3                	mov    %eax,%ebx
+  802fb8:	83 c4 10             	add    $0x10,%esp
+  802fbb:	85 c0                	test   %eax,%eax
+  802fbd:	0f 88 23 01 00 00    	js     8030e6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fc3:	83 ec 04             	sub    $0x4,%esp
+  802fc6:	68 07 04 00 00       	push   $0x407
+  802fcb:	ff 75 f4             	push   -0xc(%ebp)
+  802fce:	6a 00                	push   $0x0
+  802fd0:	e8 ca dd ff ff       	call   800d9f <sys_page_alloc>
+  802fd5:	89 c3                	mov    %eax,%ebx
+  802fd7:	83 c4 10             	add    $0x10,%esp
+  802fda:	85 c0                	test   %eax,%eax
+  802fdc:	0f 88 04 01 00 00    	js     8030e6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802fe2:	83 ec 0c             	sub    $0xc,%esp
+  802fe5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802fe8:	50                   	push   %eax
+  802fe9:	e8 d6 f0 ff ff       	call   8020c4 <fd_alloc>
+  802fee:	89 c3                	mov    %eax,%ebx
+  802ff0:	83 c4 10             	add    $0x10,%esp
+  802ff3:	85 c0                	test   %eax,%eax
+  802ff5:	0f 88 db 00 00 00    	js     8030d6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ffb:	83 ec 04             	sub    $0x4,%esp
+  802ffe:	68 07 04 00 00       	push   $0x407
+  803003:	ff 75 f0             	push   -0x10(%ebp)
+  803006:	6a 00                	push   $0x0
+  803008:	e8 92 dd ff ff       	call   800d9f <sys_page_alloc>
+  80300d:	89 c3                	mov    %eax,%ebx
+  80300f:	83 c4 10             	add    $0x10,%esp
+  803012:	85 c0                	test   %eax,%eax
+  803014:	0f 88 bc 00 00 00    	js     8030d6 <pipe+0x131>
+	va = fd2data(fd0);
+  80301a:	83 ec 0c             	sub    $0xc,%esp
+  80301d:	ff 75 f4             	push   -0xc(%ebp)
+  803020:	e8 88 f0 ff ff       	call   8020ad <fd2data>
+  803025:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803027:	83 c4 0c             	add    $0xc,%esp
+  80302a:	68 07 04 00 00       	push   $0x407
+  80302f:	50                   	push   %eax
+  803030:	6a 00                	push   $0x0
+  803032:	e8 68 dd ff ff       	call   800d9f <sys_page_alloc>
+  803037:	89 c3                	mov    %eax,%ebx
+  803039:	83 c4 10             	add    $0x10,%esp
+  80303c:	85 c0                	test   %eax,%eax
+  80303e:	0f 88 82 00 00 00    	js     8030c6 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803044:	83 ec 0c             	sub    $0xc,%esp
+  803047:	ff 75 f0             	push   -0x10(%ebp)
+  80304a:	e8 5e f0 ff ff       	call   8020ad <fd2data>
+  80304f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803056:	50                   	push   %eax
+  803057:	6a 00                	push   $0x0
+  803059:	56                   	push   %esi
+  80305a:	6a 00                	push   $0x0
+  80305c:	e8 ab dd ff ff       	call   800e0c <sys_page_map>
+  803061:	89 c3                	mov    %eax,%ebx
+  803063:	83 c4 20             	add    $0x20,%esp
+  803066:	85 c0                	test   %eax,%eax
+  803068:	78 4e                	js     8030b8 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80306a:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80306f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803072:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803074:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803077:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80307e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803081:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803083:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803086:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80308d:	83 ec 0c             	sub    $0xc,%esp
+  803090:	ff 75 f4             	push   -0xc(%ebp)
+  803093:	e8 05 f0 ff ff       	call   80209d <fd2num>
+  803098:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80309b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80309d:	83 c4 04             	add    $0x4,%esp
+  8030a0:	ff 75 f0             	push   -0x10(%ebp)
+  8030a3:	e8 f5 ef ff ff       	call   80209d <fd2num>
+  8030a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030ab:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8030ae:	83 c4 10             	add    $0x10,%esp
+  8030b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030b6:	eb 2e                	jmp    8030e6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8030b8:	83 ec 08             	sub    $0x8,%esp
+  8030bb:	56                   	push   %esi
+  8030bc:	6a 00                	push   $0x0
+  8030be:	e8 b7 dd ff ff       	call   800e7a <sys_page_unmap>
+  8030c3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8030c6:	83 ec 08             	sub    $0x8,%esp
+  8030c9:	ff 75 f0             	push   -0x10(%ebp)
+  8030cc:	6a 00                	push   $0x0
+  8030ce:	e8 a7 dd ff ff       	call   800e7a <sys_page_unmap>
+  8030d3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8030d6:	83 ec 08             	sub    $0x8,%esp
+  8030d9:	ff 75 f4             	push   -0xc(%ebp)
+  8030dc:	6a 00                	push   $0x0
+  8030de:	e8 97 dd ff ff       	call   800e7a <sys_page_unmap>
+  8030e3:	83 c4 10             	add    $0x10,%esp
+}
+  8030e6:	89 d8                	mov    %ebx,%eax
+  8030e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030eb:	5b                   	pop    %ebx
+  8030ec:	5e                   	pop    %esi
+  8030ed:	5d                   	pop    %ebp
+  8030ee:	c3                   	ret
+
+008030ef <pipeisclosed>:
+{
+  8030ef:	55                   	push   %ebp
+  8030f0:	89 e5                	mov    %esp,%ebp
+  8030f2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030f8:	50                   	push   %eax
+  8030f9:	ff 75 08             	push   0x8(%ebp)
+  8030fc:	e8 19 f0 ff ff       	call   80211a <fd_lookup>
+  803101:	83 c4 10             	add    $0x10,%esp
+  803104:	85 c0                	test   %eax,%eax
+  803106:	78 18                	js     803120 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803108:	83 ec 0c             	sub    $0xc,%esp
+  80310b:	ff 75 f4             	push   -0xc(%ebp)
+  80310e:	e8 9a ef ff ff       	call   8020ad <fd2data>
+  803113:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803115:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803118:	e8 cb fc ff ff       	call   802de8 <_pipeisclosed>
+  80311d:	83 c4 10             	add    $0x10,%esp
+}
+  803120:	c9                   	leave
+  803121:	c3                   	ret
+
+00803122 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803122:	b8 00 00 00 00       	mov    $0x0,%eax
+  803127:	c3                   	ret
+
+00803128 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803128:	55                   	push   %ebp
+  803129:	89 e5                	mov    %esp,%ebp
+  80312b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80312e:	68 76 39 80 00       	push   $0x803976
+  803133:	ff 75 0c             	push   0xc(%ebp)
+  803136:	e8 6c d7 ff ff       	call   8008a7 <strcpy>
+	return 0;
+}
+  80313b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803140:	c9                   	leave
+  803141:	c3                   	ret
+
+00803142 <devcons_write>:
+{
+  803142:	55                   	push   %ebp
+  803143:	89 e5                	mov    %esp,%ebp
+  803145:	57                   	push   %edi
+  803146:	56                   	push   %esi
+  803147:	53                   	push   %ebx
+  803148:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80314e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803153:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803159:	eb 2e                	jmp    803189 <devcons_write+0x47>
+		m = n - tot;
+  80315b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80315e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803160:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803165:	39 c3                	cmp    %eax,%ebx
+  803167:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80316a:	83 ec 04             	sub    $0x4,%esp
+  80316d:	53                   	push   %ebx
+  80316e:	89 f0                	mov    %esi,%eax
+  803170:	03 45 0c             	add    0xc(%ebp),%eax
+  803173:	50                   	push   %eax
+  803174:	57                   	push   %edi
+  803175:	e8 b3 d8 ff ff       	call   800a2d <memmove>
+		sys_cputs(buf, m);
+  80317a:	83 c4 08             	add    $0x8,%esp
+  80317d:	53                   	push   %ebx
+  80317e:	57                   	push   %edi
+  80317f:	e8 9c da ff ff       	call   800c20 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803184:	01 de                	add    %ebx,%esi
+  803186:	83 c4 10             	add    $0x10,%esp
+  803189:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80318c:	72 cd                	jb     80315b <devcons_write+0x19>
+}
+  80318e:	89 f0                	mov    %esi,%eax
+  803190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803193:	5b                   	pop    %ebx
+  803194:	5e                   	pop    %esi
+  803195:	5f                   	pop    %edi
+  803196:	5d                   	pop    %ebp
+  803197:	c3                   	ret
+
+00803198 <devcons_read>:
+{
+  803198:	55                   	push   %ebp
+  803199:	89 e5                	mov    %esp,%ebp
+  80319b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80319e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8031a7:	75 07                	jne    8031b0 <devcons_read+0x18>
+  8031a9:	eb 1f                	jmp    8031ca <devcons_read+0x32>
+		sys_yield();
+  8031ab:	e8 a9 db ff ff       	call   800d59 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8031b0:	e8 af da ff ff       	call   800c64 <sys_cgetc>
+  8031b5:	85 c0                	test   %eax,%eax
+  8031b7:	74 f2                	je     8031ab <devcons_read+0x13>
+	if (c < 0)
+  8031b9:	78 0f                	js     8031ca <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8031bb:	83 f8 04             	cmp    $0x4,%eax
+  8031be:	74 0c                	je     8031cc <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8031c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8031c3:	88 02                	mov    %al,(%edx)
+	return 1;
+  8031c5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8031ca:	c9                   	leave
+  8031cb:	c3                   	ret
+		return 0;
+  8031cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d1:	eb f7                	jmp    8031ca <devcons_read+0x32>
+
+008031d3 <cputchar>:
+{
+  8031d3:	55                   	push   %ebp
+  8031d4:	89 e5                	mov    %esp,%ebp
+  8031d6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8031d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031dc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8031df:	6a 01                	push   $0x1
+  8031e1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031e4:	50                   	push   %eax
+  8031e5:	e8 36 da ff ff       	call   800c20 <sys_cputs>
+}
+  8031ea:	83 c4 10             	add    $0x10,%esp
+  8031ed:	c9                   	leave
+  8031ee:	c3                   	ret
+
+008031ef <getchar>:
+{
+  8031ef:	55                   	push   %ebp
+  8031f0:	89 e5                	mov    %esp,%ebp
+  8031f2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8031f5:	6a 01                	push   $0x1
+  8031f7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031fa:	50                   	push   %eax
+  8031fb:	6a 00                	push   $0x0
+  8031fd:	e8 9e f1 ff ff       	call   8023a0 <read>
+	if (r < 0)
+  803202:	83 c4 10             	add    $0x10,%esp
+  803205:	85 c0                	test   %eax,%eax
+  803207:	78 06                	js     80320f <getchar+0x20>
+	if (r < 1)
+  803209:	74 06                	je     803211 <getchar+0x22>
+	return c;
+  80320b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80320f:	c9                   	leave
+  803210:	c3                   	ret
+		return -E_EOF;
+  803211:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803216:	eb f7                	jmp    80320f <getchar+0x20>
+
+00803218 <iscons>:
+{
+  803218:	55                   	push   %ebp
+  803219:	89 e5                	mov    %esp,%ebp
+  80321b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80321e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803221:	50                   	push   %eax
+  803222:	ff 75 08             	push   0x8(%ebp)
+  803225:	e8 f0 ee ff ff       	call   80211a <fd_lookup>
+  80322a:	83 c4 10             	add    $0x10,%esp
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	78 11                	js     803242 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803231:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803234:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80323a:	39 10                	cmp    %edx,(%eax)
+  80323c:	0f 94 c0             	sete   %al
+  80323f:	0f b6 c0             	movzbl %al,%eax
+}
+  803242:	c9                   	leave
+  803243:	c3                   	ret
+
+00803244 <opencons>:
+{
+  803244:	55                   	push   %ebp
+  803245:	89 e5                	mov    %esp,%ebp
+  803247:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80324a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80324d:	50                   	push   %eax
+  80324e:	e8 71 ee ff ff       	call   8020c4 <fd_alloc>
+  803253:	83 c4 10             	add    $0x10,%esp
+  803256:	85 c0                	test   %eax,%eax
+  803258:	78 3a                	js     803294 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80325a:	83 ec 04             	sub    $0x4,%esp
+  80325d:	68 07 04 00 00       	push   $0x407
+  803262:	ff 75 f4             	push   -0xc(%ebp)
+  803265:	6a 00                	push   $0x0
+  803267:	e8 33 db ff ff       	call   800d9f <sys_page_alloc>
+  80326c:	83 c4 10             	add    $0x10,%esp
+  80326f:	85 c0                	test   %eax,%eax
+  803271:	78 21                	js     803294 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803273:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803276:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80327c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80327e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803281:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803288:	83 ec 0c             	sub    $0xc,%esp
+  80328b:	50                   	push   %eax
+  80328c:	e8 0c ee ff ff       	call   80209d <fd2num>
+  803291:	83 c4 10             	add    $0x10,%esp
+}
+  803294:	c9                   	leave
+  803295:	c3                   	ret
+
+00803296 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803296:	55                   	push   %ebp
+  803297:	89 e5                	mov    %esp,%ebp
+  803299:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  80329c:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8032a3:	74 0a                	je     8032af <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8032a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032a8:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8032ad:	c9                   	leave
+  8032ae:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8032af:	83 ec 04             	sub    $0x4,%esp
+  8032b2:	6a 07                	push   $0x7
+  8032b4:	68 00 f0 bf ee       	push   $0xeebff000
+  8032b9:	6a 00                	push   $0x0
+  8032bb:	e8 df da ff ff       	call   800d9f <sys_page_alloc>
+  8032c0:	83 c4 10             	add    $0x10,%esp
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	78 14                	js     8032db <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8032c7:	83 ec 08             	sub    $0x8,%esp
+  8032ca:	68 fd 32 80 00       	push   $0x8032fd
+  8032cf:	6a 00                	push   $0x0
+  8032d1:	e8 e5 dc ff ff       	call   800fbb <sys_env_set_pgfault_upcall>
+  8032d6:	83 c4 10             	add    $0x10,%esp
+  8032d9:	eb ca                	jmp    8032a5 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8032db:	83 ec 08             	sub    $0x8,%esp
+  8032de:	50                   	push   %eax
+  8032df:	68 82 39 80 00       	push   $0x803982
+  8032e4:	e8 76 cf ff ff       	call   80025f <cprintf>
+			panic("set_pgfault_handler error");
+  8032e9:	83 c4 0c             	add    $0xc,%esp
+  8032ec:	68 8d 39 80 00       	push   $0x80398d
+  8032f1:	6a 24                	push   $0x24
+  8032f3:	68 a7 39 80 00       	push   $0x8039a7
+  8032f8:	e8 87 ce ff ff       	call   800184 <_panic>
+
+008032fd <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8032fd:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8032fe:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803303:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803305:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803308:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80330c:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  80330f:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803313:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803315:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803319:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  80331a:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  80331e:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  80331f:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803320:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803324:	c3                   	ret
+
+00803325 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803325:	55                   	push   %ebp
+  803326:	89 e5                	mov    %esp,%ebp
+  803328:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80332b:	89 c2                	mov    %eax,%edx
+  80332d:	c1 ea 16             	shr    $0x16,%edx
+  803330:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803337:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80333c:	f6 c1 01             	test   $0x1,%cl
+  80333f:	74 1a                	je     80335b <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803341:	c1 e8 0c             	shr    $0xc,%eax
+  803344:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80334b:	a8 01                	test   $0x1,%al
+  80334d:	74 0c                	je     80335b <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80334f:	c1 e8 0c             	shr    $0xc,%eax
+  803352:	c1 e0 04             	shl    $0x4,%eax
+  803355:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80335b:	89 d0                	mov    %edx,%eax
+  80335d:	5d                   	pop    %ebp
+  80335e:	c3                   	ret
@@ -0,0 +1,7210 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 73 01 00 00       	call   8001a4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <pingpong>:
+
+uint32_t val;
+
+static void
+pingpong(void *arg)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+  80003c:	eb 74                	jmp    8000b2 <pingpong+0x7f>
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80003e:	c1 e8 10             	shr    $0x10,%eax
+  800041:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800047:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80004d:	e9 8b 00 00 00       	jmp    8000dd <pingpong+0xaa>
+  800052:	c1 e8 10             	shr    $0x10,%eax
+  800055:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80005b:	8d 98 00 00 c0 ee    	lea    -0x11400000(%eax),%ebx
+	envid_t who;
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800061:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800064:	8b 35 08 50 80 00    	mov    0x805008,%esi
+  80006a:	e8 88 0d 00 00       	call   800df7 <sys_getenvid>
+  80006f:	83 ec 08             	sub    $0x8,%esp
+  800072:	ff 75 d4             	push   -0x2c(%ebp)
+  800075:	53                   	push   %ebx
+  800076:	57                   	push   %edi
+  800077:	56                   	push   %esi
+  800078:	50                   	push   %eax
+  800079:	68 60 34 80 00       	push   $0x803460
+  80007e:	e8 c0 02 00 00       	call   800343 <cprintf>
+		if (val == 10)
+  800083:	a1 08 50 80 00       	mov    0x805008,%eax
+  800088:	83 c4 20             	add    $0x20,%esp
+  80008b:	83 f8 0a             	cmp    $0xa,%eax
+  80008e:	74 70                	je     800100 <pingpong+0xcd>
+			return;
+		++val;
+  800090:	83 c0 01             	add    $0x1,%eax
+  800093:	a3 08 50 80 00       	mov    %eax,0x805008
+		ipc_send(who, 0, 0, 0);
+  800098:	6a 00                	push   $0x0
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a1:	e8 26 1e 00 00       	call   801ecc <ipc_send>
+		if (val == 10)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	83 3d 08 50 80 00 0a 	cmpl   $0xa,0x805008
+  8000b0:	74 4e                	je     800100 <pingpong+0xcd>
+		ipc_recv(&who, 0, 0);
+  8000b2:	83 ec 04             	sub    $0x4,%esp
+  8000b5:	6a 00                	push   $0x0
+  8000b7:	6a 00                	push   $0x0
+  8000b9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8000bc:	50                   	push   %eax
+  8000bd:	e8 f2 1d 00 00       	call   801eb4 <ipc_recv>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000c2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000c4:	05 00 00 00 20       	add    $0x20000000,%eax
+  8000c9:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8000cc:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000d2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8000d7:	0f 86 61 ff ff ff    	jbe    80003e <pingpong+0xb>
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  8000dd:	8b 42 48             	mov    0x48(%edx),%eax
+  8000e0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8000e3:	89 e0                	mov    %esp,%eax
+  8000e5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8000ea:	8b 1d 0c 50 80 00    	mov    0x80500c,%ebx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000f0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8000f5:	0f 87 66 ff ff ff    	ja     800061 <pingpong+0x2e>
+  8000fb:	e9 52 ff ff ff       	jmp    800052 <pingpong+0x1f>
+			return;
+	}
+}
+  800100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800103:	5b                   	pop    %ebx
+  800104:	5e                   	pop    %esi
+  800105:	5f                   	pop    %edi
+  800106:	5d                   	pop    %ebp
+  800107:	c3                   	ret
+
+00800108 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800108:	55                   	push   %ebp
+  800109:	89 e5                	mov    %esp,%ebp
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+	envid_t who;
+
+	if ((who = sfork(pingpong, NULL)) < 0)
+  80010d:	83 ec 08             	sub    $0x8,%esp
+  800110:	6a 00                	push   $0x0
+  800112:	68 33 00 80 00       	push   $0x800033
+  800117:	e8 ab 1c 00 00       	call   801dc7 <sfork>
+  80011c:	89 c3                	mov    %eax,%ebx
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	85 c0                	test   %eax,%eax
+  800123:	78 5c                	js     800181 <umain+0x79>
+  800125:	89 e0                	mov    %esp,%eax
+  800127:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80012c:	8b 35 0c 50 80 00    	mov    0x80500c,%esi
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800132:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800137:	76 5a                	jbe    800193 <umain+0x8b>
+		panic("sfork: %e", who);
+	cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800139:	e8 b9 0c 00 00       	call   800df7 <sys_getenvid>
+  80013e:	83 ec 04             	sub    $0x4,%esp
+  800141:	56                   	push   %esi
+  800142:	50                   	push   %eax
+  800143:	68 a1 34 80 00       	push   $0x8034a1
+  800148:	e8 f6 01 00 00       	call   800343 <cprintf>
+	// get the ball rolling
+	cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80014d:	e8 a5 0c 00 00       	call   800df7 <sys_getenvid>
+  800152:	83 c4 0c             	add    $0xc,%esp
+  800155:	53                   	push   %ebx
+  800156:	50                   	push   %eax
+  800157:	68 bb 34 80 00       	push   $0x8034bb
+  80015c:	e8 e2 01 00 00       	call   800343 <cprintf>
+	ipc_send(who, 0, 0, 0);
+  800161:	6a 00                	push   $0x0
+  800163:	6a 00                	push   $0x0
+  800165:	6a 00                	push   $0x0
+  800167:	53                   	push   %ebx
+  800168:	e8 5f 1d 00 00       	call   801ecc <ipc_send>
+
+	pingpong(NULL);
+  80016d:	83 c4 14             	add    $0x14,%esp
+  800170:	6a 00                	push   $0x0
+  800172:	e8 bc fe ff ff       	call   800033 <pingpong>
+}
+  800177:	83 c4 10             	add    $0x10,%esp
+  80017a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80017d:	5b                   	pop    %ebx
+  80017e:	5e                   	pop    %esi
+  80017f:	5d                   	pop    %ebp
+  800180:	c3                   	ret
+		panic("sfork: %e", who);
+  800181:	50                   	push   %eax
+  800182:	68 86 34 80 00       	push   $0x803486
+  800187:	6a 1f                	push   $0x1f
+  800189:	68 90 34 80 00       	push   $0x803490
+  80018e:	e8 d5 00 00 00       	call   800268 <_panic>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800193:	c1 e8 10             	shr    $0x10,%eax
+  800196:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80019c:	8d b0 00 00 c0 ee    	lea    -0x11400000(%eax),%esi
+  8001a2:	eb 95                	jmp    800139 <umain+0x31>
+
+008001a4 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	57                   	push   %edi
+  8001a8:	56                   	push   %esi
+  8001a9:	53                   	push   %ebx
+  8001aa:	83 ec 0c             	sub    $0xc,%esp
+  8001ad:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8001b0:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001b8:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8001ba:	c1 ea 0b             	shr    $0xb,%edx
+  8001bd:	83 f2 01             	xor    $0x1,%edx
+  8001c0:	83 e2 01             	and    $0x1,%edx
+  8001c3:	88 15 10 50 80 00    	mov    %dl,0x805010
+
+	mainenv = NULL;
+  8001c9:	c7 05 0c 50 80 00 00 	movl   $0x0,0x80500c
+  8001d0:	00 00 00 
+	envid = sys_getenvid();
+  8001d3:	e8 1f 0c 00 00       	call   800df7 <sys_getenvid>
+  8001d8:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8001da:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8001df:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8001e5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8001eb:	8b 52 48             	mov    0x48(%edx),%edx
+  8001ee:	39 ca                	cmp    %ecx,%edx
+  8001f0:	74 27                	je     800219 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8001f2:	83 c0 01             	add    $0x1,%eax
+  8001f5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001fa:	75 e3                	jne    8001df <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8001fc:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  800203:	75 24                	jne    800229 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800205:	83 ec 04             	sub    $0x4,%esp
+  800208:	68 d4 34 80 00       	push   $0x8034d4
+  80020d:	6a 23                	push   $0x23
+  80020f:	68 f7 34 80 00       	push   $0x8034f7
+  800214:	e8 4f 00 00 00       	call   800268 <_panic>
+			mainenv = &envs[i];
+  800219:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80021f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800224:	a3 0c 50 80 00       	mov    %eax,0x80500c
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800229:	85 ff                	test   %edi,%edi
+  80022b:	7e 07                	jle    800234 <libmain+0x90>
+		binaryname = argv[0];
+  80022d:	8b 06                	mov    (%esi),%eax
+  80022f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800234:	83 ec 08             	sub    $0x8,%esp
+  800237:	56                   	push   %esi
+  800238:	57                   	push   %edi
+  800239:	e8 ca fe ff ff       	call   800108 <umain>
+
+	// exit gracefully
+	exit();
+  80023e:	e8 0b 00 00 00       	call   80024e <exit>
+}
+  800243:	83 c4 10             	add    $0x10,%esp
+  800246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800249:	5b                   	pop    %ebx
+  80024a:	5e                   	pop    %esi
+  80024b:	5f                   	pop    %edi
+  80024c:	5d                   	pop    %ebp
+  80024d:	c3                   	ret
+
+0080024e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80024e:	55                   	push   %ebp
+  80024f:	89 e5                	mov    %esp,%ebp
+  800251:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800254:	e8 1c 21 00 00       	call   802375 <close_all>
+	sys_env_destroy(0);
+  800259:	83 ec 0c             	sub    $0xc,%esp
+  80025c:	6a 00                	push   $0x0
+  80025e:	e8 2b 0b 00 00       	call   800d8e <sys_env_destroy>
+}
+  800263:	83 c4 10             	add    $0x10,%esp
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+
+00800268 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	56                   	push   %esi
+  80026c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80026d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800270:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800276:	e8 7c 0b 00 00       	call   800df7 <sys_getenvid>
+  80027b:	83 ec 0c             	sub    $0xc,%esp
+  80027e:	ff 75 0c             	push   0xc(%ebp)
+  800281:	ff 75 08             	push   0x8(%ebp)
+  800284:	56                   	push   %esi
+  800285:	50                   	push   %eax
+  800286:	68 10 35 80 00       	push   $0x803510
+  80028b:	e8 b3 00 00 00       	call   800343 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800290:	83 c4 18             	add    $0x18,%esp
+  800293:	53                   	push   %ebx
+  800294:	ff 75 10             	push   0x10(%ebp)
+  800297:	e8 56 00 00 00       	call   8002f2 <vcprintf>
+	cprintf("\n");
+  80029c:	c7 04 24 af 3a 80 00 	movl   $0x803aaf,(%esp)
+  8002a3:	e8 9b 00 00 00       	call   800343 <cprintf>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002ab:	cc                   	int3
+	while (1)
+  8002ac:	eb fd                	jmp    8002ab <_panic+0x43>
+
+008002ae <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002ae:	55                   	push   %ebp
+  8002af:	89 e5                	mov    %esp,%ebp
+  8002b1:	53                   	push   %ebx
+  8002b2:	83 ec 04             	sub    $0x4,%esp
+  8002b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002b8:	8b 13                	mov    (%ebx),%edx
+  8002ba:	8d 42 01             	lea    0x1(%edx),%eax
+  8002bd:	89 03                	mov    %eax,(%ebx)
+  8002bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002c2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002c6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002cb:	74 09                	je     8002d6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002cd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002d4:	c9                   	leave
+  8002d5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002d6:	83 ec 08             	sub    $0x8,%esp
+  8002d9:	68 ff 00 00 00       	push   $0xff
+  8002de:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	e8 1d 0a 00 00       	call   800d04 <sys_cputs>
+		b->idx = 0;
+  8002e7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	eb db                	jmp    8002cd <putch+0x1f>
+
+008002f2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002f2:	55                   	push   %ebp
+  8002f3:	89 e5                	mov    %esp,%ebp
+  8002f5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002fb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800302:	00 00 00 
+	b.cnt = 0;
+  800305:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80030c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80030f:	ff 75 0c             	push   0xc(%ebp)
+  800312:	ff 75 08             	push   0x8(%ebp)
+  800315:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	68 ae 02 80 00       	push   $0x8002ae
+  800321:	e8 fb 00 00 00       	call   800421 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800326:	83 c4 08             	add    $0x8,%esp
+  800329:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80032f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800335:	50                   	push   %eax
+  800336:	e8 c9 09 00 00       	call   800d04 <sys_cputs>
+
+	return b.cnt;
+}
+  80033b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800341:	c9                   	leave
+  800342:	c3                   	ret
+
+00800343 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800343:	55                   	push   %ebp
+  800344:	89 e5                	mov    %esp,%ebp
+  800346:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800349:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80034c:	50                   	push   %eax
+  80034d:	ff 75 08             	push   0x8(%ebp)
+  800350:	e8 9d ff ff ff       	call   8002f2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800355:	c9                   	leave
+  800356:	c3                   	ret
+
+00800357 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800357:	55                   	push   %ebp
+  800358:	89 e5                	mov    %esp,%ebp
+  80035a:	57                   	push   %edi
+  80035b:	56                   	push   %esi
+  80035c:	53                   	push   %ebx
+  80035d:	83 ec 1c             	sub    $0x1c,%esp
+  800360:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800363:	89 d6                	mov    %edx,%esi
+  800365:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800368:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80036b:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80036e:	73 0b                	jae    80037b <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800370:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800373:	c1 e7 08             	shl    $0x8,%edi
+  800376:	0b 7d 10             	or     0x10(%ebp),%edi
+  800379:	eb 36                	jmp    8003b1 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80037b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80037e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800383:	f7 75 08             	divl   0x8(%ebp)
+  800386:	89 c1                	mov    %eax,%ecx
+  800388:	ff 75 14             	push   0x14(%ebp)
+  80038b:	ff 75 10             	push   0x10(%ebp)
+  80038e:	83 eb 01             	sub    $0x1,%ebx
+  800391:	53                   	push   %ebx
+  800392:	ff 75 08             	push   0x8(%ebp)
+  800395:	89 f2                	mov    %esi,%edx
+  800397:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80039a:	e8 b8 ff ff ff       	call   800357 <printnum>
+  80039f:	83 c4 10             	add    $0x10,%esp
+  8003a2:	eb 14                	jmp    8003b8 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8003a4:	83 ec 08             	sub    $0x8,%esp
+  8003a7:	56                   	push   %esi
+  8003a8:	57                   	push   %edi
+  8003a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003ac:	ff d0                	call   *%eax
+  8003ae:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003b1:	83 eb 01             	sub    $0x1,%ebx
+  8003b4:	85 db                	test   %ebx,%ebx
+  8003b6:	7f ec                	jg     8003a4 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8003b8:	83 ec 08             	sub    $0x8,%esp
+  8003bb:	56                   	push   %esi
+  8003bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c4:	f7 75 08             	divl   0x8(%ebp)
+  8003c7:	0f be 92 33 35 80 00 	movsbl 0x803533(%edx),%edx
+  8003ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d1:	c1 e0 08             	shl    $0x8,%eax
+  8003d4:	09 d0                	or     %edx,%eax
+  8003d6:	50                   	push   %eax
+  8003d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003da:	ff d0                	call   *%eax
+}
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e2:	5b                   	pop    %ebx
+  8003e3:	5e                   	pop    %esi
+  8003e4:	5f                   	pop    %edi
+  8003e5:	5d                   	pop    %ebp
+  8003e6:	c3                   	ret
+
+008003e7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003e7:	55                   	push   %ebp
+  8003e8:	89 e5                	mov    %esp,%ebp
+  8003ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003ed:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003f1:	8b 10                	mov    (%eax),%edx
+  8003f3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003f6:	73 0a                	jae    800402 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003f8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003fb:	89 08                	mov    %ecx,(%eax)
+  8003fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800400:	88 02                	mov    %al,(%edx)
+}
+  800402:	5d                   	pop    %ebp
+  800403:	c3                   	ret
+
+00800404 <printfmt>:
+{
+  800404:	55                   	push   %ebp
+  800405:	89 e5                	mov    %esp,%ebp
+  800407:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80040a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80040d:	50                   	push   %eax
+  80040e:	ff 75 10             	push   0x10(%ebp)
+  800411:	ff 75 0c             	push   0xc(%ebp)
+  800414:	ff 75 08             	push   0x8(%ebp)
+  800417:	e8 05 00 00 00       	call   800421 <vprintfmt>
+}
+  80041c:	83 c4 10             	add    $0x10,%esp
+  80041f:	c9                   	leave
+  800420:	c3                   	ret
+
+00800421 <vprintfmt>:
+{
+  800421:	55                   	push   %ebp
+  800422:	89 e5                	mov    %esp,%ebp
+  800424:	57                   	push   %edi
+  800425:	56                   	push   %esi
+  800426:	53                   	push   %ebx
+  800427:	83 ec 3c             	sub    $0x3c,%esp
+  80042a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80042d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800430:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800437:	eb 16                	jmp    80044f <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800439:	83 ec 08             	sub    $0x8,%esp
+  80043c:	ff 75 0c             	push   0xc(%ebp)
+  80043f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800442:	c1 e2 08             	shl    $0x8,%edx
+  800445:	09 d0                	or     %edx,%eax
+  800447:	50                   	push   %eax
+  800448:	ff d7                	call   *%edi
+  80044a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80044d:	89 de                	mov    %ebx,%esi
+  80044f:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800452:	0f b6 06             	movzbl (%esi),%eax
+  800455:	83 f8 25             	cmp    $0x25,%eax
+  800458:	74 0c                	je     800466 <vprintfmt+0x45>
+			if (ch == '\0')
+  80045a:	85 c0                	test   %eax,%eax
+  80045c:	75 db                	jne    800439 <vprintfmt+0x18>
+}
+  80045e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800461:	5b                   	pop    %ebx
+  800462:	5e                   	pop    %esi
+  800463:	5f                   	pop    %edi
+  800464:	5d                   	pop    %ebp
+  800465:	c3                   	ret
+		padc = ' ';
+  800466:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80046a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800471:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800478:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80047f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800484:	8d 73 01             	lea    0x1(%ebx),%esi
+  800487:	0f b6 13             	movzbl (%ebx),%edx
+  80048a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80048d:	3c 55                	cmp    $0x55,%al
+  80048f:	0f 87 2c 04 00 00    	ja     8008c1 <vprintfmt+0x4a0>
+  800495:	0f b6 c0             	movzbl %al,%eax
+  800498:	ff 24 85 80 36 80 00 	jmp    *0x803680(,%eax,4)
+  80049f:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8004a1:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8004a5:	eb dd                	jmp    800484 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a7:	89 f3                	mov    %esi,%ebx
+  8004a9:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8004ad:	eb d5                	jmp    800484 <vprintfmt+0x63>
+  8004af:	0f b6 d2             	movzbl %dl,%edx
+  8004b2:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8004b4:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8004b9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004bc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004c0:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8004c3:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8004c6:	83 fe 09             	cmp    $0x9,%esi
+  8004c9:	0f 87 8a 00 00 00    	ja     800559 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8004cf:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8004d2:	eb e5                	jmp    8004b9 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8004d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d7:	8b 00                	mov    (%eax),%eax
+  8004d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e5:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8004e7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004eb:	79 97                	jns    800484 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8004ed:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004fa:	eb 88                	jmp    800484 <vprintfmt+0x63>
+			if (width < 0)
+  8004fc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8004ff:	85 db                	test   %ebx,%ebx
+  800501:	b8 00 00 00 00       	mov    $0x0,%eax
+  800506:	0f 49 c3             	cmovns %ebx,%eax
+  800509:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80050c:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80050e:	e9 71 ff ff ff       	jmp    800484 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800513:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800515:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80051c:	e9 63 ff ff ff       	jmp    800484 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800521:	8d 73 02             	lea    0x2(%ebx),%esi
+  800524:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800528:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80052f:	3c 67                	cmp    $0x67,%al
+  800531:	0f 84 18 ff ff ff    	je     80044f <vprintfmt+0x2e>
+					attrib = 0x04;
+  800537:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80053e:	3c 72                	cmp    $0x72,%al
+  800540:	0f 84 09 ff ff ff    	je     80044f <vprintfmt+0x2e>
+					attrib = 0x00;
+  800546:	3c 62                	cmp    $0x62,%al
+  800548:	0f 94 c0             	sete   %al
+  80054b:	0f b6 c0             	movzbl %al,%eax
+  80054e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800551:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800554:	e9 f6 fe ff ff       	jmp    80044f <vprintfmt+0x2e>
+  800559:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80055c:	eb 89                	jmp    8004e7 <vprintfmt+0xc6>
+			lflag++;
+  80055e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800561:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800563:	e9 1c ff ff ff       	jmp    800484 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800568:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056b:	8d 58 04             	lea    0x4(%eax),%ebx
+  80056e:	83 ec 08             	sub    $0x8,%esp
+  800571:	ff 75 0c             	push   0xc(%ebp)
+  800574:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800577:	c1 e0 08             	shl    $0x8,%eax
+  80057a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80057d:	0b 01                	or     (%ecx),%eax
+  80057f:	50                   	push   %eax
+  800580:	ff d7                	call   *%edi
+			break;
+  800582:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800585:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800588:	e9 c2 fe ff ff       	jmp    80044f <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80058d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800590:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800593:	8b 10                	mov    (%eax),%edx
+  800595:	89 d0                	mov    %edx,%eax
+  800597:	f7 d8                	neg    %eax
+  800599:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80059c:	83 f8 12             	cmp    $0x12,%eax
+  80059f:	7f 25                	jg     8005c6 <vprintfmt+0x1a5>
+  8005a1:	8b 14 85 e0 37 80 00 	mov    0x8037e0(,%eax,4),%edx
+  8005a8:	85 d2                	test   %edx,%edx
+  8005aa:	74 1a                	je     8005c6 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8005ac:	52                   	push   %edx
+  8005ad:	68 22 39 80 00       	push   $0x803922
+  8005b2:	ff 75 0c             	push   0xc(%ebp)
+  8005b5:	57                   	push   %edi
+  8005b6:	e8 49 fe ff ff       	call   800404 <printfmt>
+  8005bb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005be:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8005c1:	e9 89 fe ff ff       	jmp    80044f <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8005c6:	50                   	push   %eax
+  8005c7:	68 4b 35 80 00       	push   $0x80354b
+  8005cc:	ff 75 0c             	push   0xc(%ebp)
+  8005cf:	57                   	push   %edi
+  8005d0:	e8 2f fe ff ff       	call   800404 <printfmt>
+  8005d5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d8:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005db:	e9 6f fe ff ff       	jmp    80044f <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	83 c0 04             	add    $0x4,%eax
+  8005e6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8005e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ec:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005ee:	85 c9                	test   %ecx,%ecx
+  8005f0:	b8 44 35 80 00       	mov    $0x803544,%eax
+  8005f5:	0f 45 c1             	cmovne %ecx,%eax
+  8005f8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8005fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ff:	7e 06                	jle    800607 <vprintfmt+0x1e6>
+  800601:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800605:	75 1a                	jne    800621 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800607:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80060a:	c1 e0 08             	shl    $0x8,%eax
+  80060d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800610:	83 c8 3f             	or     $0x3f,%eax
+  800613:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800616:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800619:	89 75 10             	mov    %esi,0x10(%ebp)
+  80061c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80061f:	eb 6d                	jmp    80068e <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800621:	83 ec 08             	sub    $0x8,%esp
+  800624:	ff 75 d0             	push   -0x30(%ebp)
+  800627:	ff 75 c8             	push   -0x38(%ebp)
+  80062a:	e8 39 03 00 00       	call   800968 <strnlen>
+  80062f:	89 c2                	mov    %eax,%edx
+  800631:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800634:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800636:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800639:	c1 e1 08             	shl    $0x8,%ecx
+  80063c:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800640:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800642:	83 c4 10             	add    $0x10,%esp
+  800645:	89 c3                	mov    %eax,%ebx
+  800647:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80064a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80064d:	89 ce                	mov    %ecx,%esi
+  80064f:	eb 0f                	jmp    800660 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800651:	83 ec 08             	sub    $0x8,%esp
+  800654:	ff 75 0c             	push   0xc(%ebp)
+  800657:	56                   	push   %esi
+  800658:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80065a:	83 eb 01             	sub    $0x1,%ebx
+  80065d:	83 c4 10             	add    $0x10,%esp
+  800660:	85 db                	test   %ebx,%ebx
+  800662:	7f ed                	jg     800651 <vprintfmt+0x230>
+  800664:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800667:	8b 75 10             	mov    0x10(%ebp),%esi
+  80066a:	85 c0                	test   %eax,%eax
+  80066c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800671:	0f 49 d0             	cmovns %eax,%edx
+  800674:	29 d0                	sub    %edx,%eax
+  800676:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800679:	eb 8c                	jmp    800607 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80067b:	83 ec 08             	sub    $0x8,%esp
+  80067e:	ff 75 0c             	push   0xc(%ebp)
+  800681:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800684:	09 c2                	or     %eax,%edx
+  800686:	52                   	push   %edx
+  800687:	ff d7                	call   *%edi
+  800689:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80068c:	89 d9                	mov    %ebx,%ecx
+  80068e:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800691:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800695:	0f be d0             	movsbl %al,%edx
+  800698:	85 d2                	test   %edx,%edx
+  80069a:	74 2a                	je     8006c6 <vprintfmt+0x2a5>
+  80069c:	85 f6                	test   %esi,%esi
+  80069e:	78 05                	js     8006a5 <vprintfmt+0x284>
+  8006a0:	83 ee 01             	sub    $0x1,%esi
+  8006a3:	78 3b                	js     8006e0 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006a5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006a9:	74 d0                	je     80067b <vprintfmt+0x25a>
+  8006ab:	0f be c0             	movsbl %al,%eax
+  8006ae:	83 e8 20             	sub    $0x20,%eax
+  8006b1:	83 f8 5e             	cmp    $0x5e,%eax
+  8006b4:	76 c5                	jbe    80067b <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8006b6:	83 ec 08             	sub    $0x8,%esp
+  8006b9:	ff 75 0c             	push   0xc(%ebp)
+  8006bc:	ff 75 cc             	push   -0x34(%ebp)
+  8006bf:	ff d7                	call   *%edi
+  8006c1:	83 c4 10             	add    $0x10,%esp
+  8006c4:	eb c6                	jmp    80068c <vprintfmt+0x26b>
+  8006c6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006c9:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8006cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006cf:	01 c3                	add    %eax,%ebx
+  8006d1:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8006d3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006d6:	83 c8 20             	or     $0x20,%eax
+  8006d9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006dc:	89 c6                	mov    %eax,%esi
+  8006de:	eb 14                	jmp    8006f4 <vprintfmt+0x2d3>
+  8006e0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006e3:	eb e4                	jmp    8006c9 <vprintfmt+0x2a8>
+  8006e5:	83 ec 08             	sub    $0x8,%esp
+  8006e8:	ff 75 0c             	push   0xc(%ebp)
+  8006eb:	56                   	push   %esi
+  8006ec:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006ee:	83 eb 01             	sub    $0x1,%ebx
+  8006f1:	83 c4 10             	add    $0x10,%esp
+  8006f4:	85 db                	test   %ebx,%ebx
+  8006f6:	7f ed                	jg     8006e5 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006f8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006fb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8006fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800701:	e9 49 fd ff ff       	jmp    80044f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800706:	83 f9 01             	cmp    $0x1,%ecx
+  800709:	7f 1f                	jg     80072a <vprintfmt+0x309>
+	else if (lflag)
+  80070b:	85 c9                	test   %ecx,%ecx
+  80070d:	74 69                	je     800778 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8b 00                	mov    (%eax),%eax
+  800714:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800717:	89 c1                	mov    %eax,%ecx
+  800719:	c1 f9 1f             	sar    $0x1f,%ecx
+  80071c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80071f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800722:	8d 40 04             	lea    0x4(%eax),%eax
+  800725:	89 45 14             	mov    %eax,0x14(%ebp)
+  800728:	eb 17                	jmp    800741 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80072a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072d:	8b 50 04             	mov    0x4(%eax),%edx
+  800730:	8b 00                	mov    (%eax),%eax
+  800732:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800735:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800738:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073b:	8d 40 08             	lea    0x8(%eax),%eax
+  80073e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800741:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800744:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800747:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80074c:	85 db                	test   %ebx,%ebx
+  80074e:	0f 89 f6 00 00 00    	jns    80084a <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800754:	83 ec 08             	sub    $0x8,%esp
+  800757:	ff 75 0c             	push   0xc(%ebp)
+  80075a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80075d:	c1 e0 08             	shl    $0x8,%eax
+  800760:	83 c8 2d             	or     $0x2d,%eax
+  800763:	50                   	push   %eax
+  800764:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800766:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800769:	f7 d9                	neg    %ecx
+  80076b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80076e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800773:	e9 d2 00 00 00       	jmp    80084a <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800778:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077b:	8b 00                	mov    (%eax),%eax
+  80077d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800780:	89 c1                	mov    %eax,%ecx
+  800782:	c1 f9 1f             	sar    $0x1f,%ecx
+  800785:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8d 40 04             	lea    0x4(%eax),%eax
+  80078e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800791:	eb ae                	jmp    800741 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800793:	83 f9 01             	cmp    $0x1,%ecx
+  800796:	7f 19                	jg     8007b1 <vprintfmt+0x390>
+	else if (lflag)
+  800798:	85 c9                	test   %ecx,%ecx
+  80079a:	74 2a                	je     8007c6 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80079c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079f:	8b 08                	mov    (%eax),%ecx
+  8007a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007a7:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8007ac:	e9 99 00 00 00       	jmp    80084a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b4:	8b 08                	mov    (%eax),%ecx
+  8007b6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8007c1:	e9 84 00 00 00       	jmp    80084a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8b 08                	mov    (%eax),%ecx
+  8007cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8007d6:	eb 72                	jmp    80084a <vprintfmt+0x429>
+	if (lflag >= 2)
+  8007d8:	83 f9 01             	cmp    $0x1,%ecx
+  8007db:	7f 16                	jg     8007f3 <vprintfmt+0x3d2>
+	else if (lflag)
+  8007dd:	85 c9                	test   %ecx,%ecx
+  8007df:	74 24                	je     800805 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e4:	8b 08                	mov    (%eax),%ecx
+  8007e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ec:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8007f1:	eb 57                	jmp    80084a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8b 08                	mov    (%eax),%ecx
+  8007f8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007fe:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800803:	eb 45                	jmp    80084a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800805:	8b 45 14             	mov    0x14(%ebp),%eax
+  800808:	8b 08                	mov    (%eax),%ecx
+  80080a:	8d 40 04             	lea    0x4(%eax),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800810:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800815:	eb 33                	jmp    80084a <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800817:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80081a:	c1 e3 08             	shl    $0x8,%ebx
+  80081d:	83 ec 08             	sub    $0x8,%esp
+  800820:	ff 75 0c             	push   0xc(%ebp)
+  800823:	89 d8                	mov    %ebx,%eax
+  800825:	83 c8 30             	or     $0x30,%eax
+  800828:	50                   	push   %eax
+  800829:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80082b:	83 c4 08             	add    $0x8,%esp
+  80082e:	ff 75 0c             	push   0xc(%ebp)
+  800831:	83 cb 78             	or     $0x78,%ebx
+  800834:	53                   	push   %ebx
+  800835:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80083c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80083f:	8d 40 04             	lea    0x4(%eax),%eax
+  800842:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800845:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80084a:	ff 75 e4             	push   -0x1c(%ebp)
+  80084d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800851:	52                   	push   %edx
+  800852:	ff 75 e0             	push   -0x20(%ebp)
+  800855:	50                   	push   %eax
+  800856:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800859:	89 f8                	mov    %edi,%eax
+  80085b:	e8 f7 fa ff ff       	call   800357 <printnum>
+			break;
+  800860:	83 c4 10             	add    $0x10,%esp
+  800863:	e9 e7 fb ff ff       	jmp    80044f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800868:	83 f9 01             	cmp    $0x1,%ecx
+  80086b:	7f 16                	jg     800883 <vprintfmt+0x462>
+	else if (lflag)
+  80086d:	85 c9                	test   %ecx,%ecx
+  80086f:	74 24                	je     800895 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800871:	8b 45 14             	mov    0x14(%ebp),%eax
+  800874:	8b 08                	mov    (%eax),%ecx
+  800876:	8d 40 04             	lea    0x4(%eax),%eax
+  800879:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800881:	eb c7                	jmp    80084a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800883:	8b 45 14             	mov    0x14(%ebp),%eax
+  800886:	8b 08                	mov    (%eax),%ecx
+  800888:	8d 40 08             	lea    0x8(%eax),%eax
+  80088b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80088e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800893:	eb b5                	jmp    80084a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800895:	8b 45 14             	mov    0x14(%ebp),%eax
+  800898:	8b 08                	mov    (%eax),%ecx
+  80089a:	8d 40 04             	lea    0x4(%eax),%eax
+  80089d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a0:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8008a5:	eb a3                	jmp    80084a <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8008a7:	83 ec 08             	sub    $0x8,%esp
+  8008aa:	ff 75 0c             	push   0xc(%ebp)
+  8008ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008b0:	c1 e0 08             	shl    $0x8,%eax
+  8008b3:	83 c8 25             	or     $0x25,%eax
+  8008b6:	50                   	push   %eax
+  8008b7:	ff d7                	call   *%edi
+			break;
+  8008b9:	83 c4 10             	add    $0x10,%esp
+  8008bc:	e9 8e fb ff ff       	jmp    80044f <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8008c1:	83 ec 08             	sub    $0x8,%esp
+  8008c4:	ff 75 0c             	push   0xc(%ebp)
+  8008c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008ca:	c1 e0 08             	shl    $0x8,%eax
+  8008cd:	83 c8 25             	or     $0x25,%eax
+  8008d0:	50                   	push   %eax
+  8008d1:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008d3:	83 c4 10             	add    $0x10,%esp
+  8008d6:	89 de                	mov    %ebx,%esi
+  8008d8:	eb 03                	jmp    8008dd <vprintfmt+0x4bc>
+  8008da:	83 ee 01             	sub    $0x1,%esi
+  8008dd:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008e1:	75 f7                	jne    8008da <vprintfmt+0x4b9>
+  8008e3:	e9 67 fb ff ff       	jmp    80044f <vprintfmt+0x2e>
+
+008008e8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008e8:	55                   	push   %ebp
+  8008e9:	89 e5                	mov    %esp,%ebp
+  8008eb:	83 ec 18             	sub    $0x18,%esp
+  8008ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008f7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008fb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800905:	85 c0                	test   %eax,%eax
+  800907:	74 26                	je     80092f <vsnprintf+0x47>
+  800909:	85 d2                	test   %edx,%edx
+  80090b:	7e 22                	jle    80092f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80090d:	ff 75 14             	push   0x14(%ebp)
+  800910:	ff 75 10             	push   0x10(%ebp)
+  800913:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800916:	50                   	push   %eax
+  800917:	68 e7 03 80 00       	push   $0x8003e7
+  80091c:	e8 00 fb ff ff       	call   800421 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800921:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800924:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800927:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80092a:	83 c4 10             	add    $0x10,%esp
+}
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+		return -E_INVAL;
+  80092f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800934:	eb f7                	jmp    80092d <vsnprintf+0x45>
+
+00800936 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80093c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80093f:	50                   	push   %eax
+  800940:	ff 75 10             	push   0x10(%ebp)
+  800943:	ff 75 0c             	push   0xc(%ebp)
+  800946:	ff 75 08             	push   0x8(%ebp)
+  800949:	e8 9a ff ff ff       	call   8008e8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80094e:	c9                   	leave
+  80094f:	c3                   	ret
+
+00800950 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800956:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095b:	eb 03                	jmp    800960 <strlen+0x10>
+		n++;
+  80095d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800960:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800964:	75 f7                	jne    80095d <strlen+0xd>
+	return n;
+}
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+
+00800968 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80096e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800971:	b8 00 00 00 00       	mov    $0x0,%eax
+  800976:	eb 03                	jmp    80097b <strnlen+0x13>
+		n++;
+  800978:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80097b:	39 d0                	cmp    %edx,%eax
+  80097d:	74 08                	je     800987 <strnlen+0x1f>
+  80097f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800983:	75 f3                	jne    800978 <strnlen+0x10>
+  800985:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800987:	89 d0                	mov    %edx,%eax
+  800989:	5d                   	pop    %ebp
+  80098a:	c3                   	ret
+
+0080098b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	53                   	push   %ebx
+  80098f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800992:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80099e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009a1:	83 c0 01             	add    $0x1,%eax
+  8009a4:	84 d2                	test   %dl,%dl
+  8009a6:	75 f2                	jne    80099a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009a8:	89 c8                	mov    %ecx,%eax
+  8009aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ad:	c9                   	leave
+  8009ae:	c3                   	ret
+
+008009af <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	53                   	push   %ebx
+  8009b3:	83 ec 10             	sub    $0x10,%esp
+  8009b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009b9:	53                   	push   %ebx
+  8009ba:	e8 91 ff ff ff       	call   800950 <strlen>
+  8009bf:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009c2:	ff 75 0c             	push   0xc(%ebp)
+  8009c5:	01 d8                	add    %ebx,%eax
+  8009c7:	50                   	push   %eax
+  8009c8:	e8 be ff ff ff       	call   80098b <strcpy>
+	return dst;
+}
+  8009cd:	89 d8                	mov    %ebx,%eax
+  8009cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d2:	c9                   	leave
+  8009d3:	c3                   	ret
+
+008009d4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	56                   	push   %esi
+  8009d8:	53                   	push   %ebx
+  8009d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009df:	89 f3                	mov    %esi,%ebx
+  8009e1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009e4:	89 f0                	mov    %esi,%eax
+  8009e6:	eb 0f                	jmp    8009f7 <strncpy+0x23>
+		*dst++ = *src;
+  8009e8:	83 c0 01             	add    $0x1,%eax
+  8009eb:	0f b6 0a             	movzbl (%edx),%ecx
+  8009ee:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009f1:	80 f9 01             	cmp    $0x1,%cl
+  8009f4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009f7:	39 d8                	cmp    %ebx,%eax
+  8009f9:	75 ed                	jne    8009e8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009fb:	89 f0                	mov    %esi,%eax
+  8009fd:	5b                   	pop    %ebx
+  8009fe:	5e                   	pop    %esi
+  8009ff:	5d                   	pop    %ebp
+  800a00:	c3                   	ret
+
+00800a01 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	56                   	push   %esi
+  800a05:	53                   	push   %ebx
+  800a06:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a0c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a0f:	89 f0                	mov    %esi,%eax
+  800a11:	85 d2                	test   %edx,%edx
+  800a13:	74 21                	je     800a36 <strlcpy+0x35>
+  800a15:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a19:	89 f2                	mov    %esi,%edx
+  800a1b:	eb 09                	jmp    800a26 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a1d:	83 c1 01             	add    $0x1,%ecx
+  800a20:	83 c2 01             	add    $0x1,%edx
+  800a23:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a26:	39 c2                	cmp    %eax,%edx
+  800a28:	74 09                	je     800a33 <strlcpy+0x32>
+  800a2a:	0f b6 19             	movzbl (%ecx),%ebx
+  800a2d:	84 db                	test   %bl,%bl
+  800a2f:	75 ec                	jne    800a1d <strlcpy+0x1c>
+  800a31:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a33:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a36:	29 f0                	sub    %esi,%eax
+}
+  800a38:	5b                   	pop    %ebx
+  800a39:	5e                   	pop    %esi
+  800a3a:	5d                   	pop    %ebp
+  800a3b:	c3                   	ret
+
+00800a3c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a3c:	55                   	push   %ebp
+  800a3d:	89 e5                	mov    %esp,%ebp
+  800a3f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a42:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a45:	eb 06                	jmp    800a4d <strcmp+0x11>
+		p++, q++;
+  800a47:	83 c1 01             	add    $0x1,%ecx
+  800a4a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a4d:	0f b6 01             	movzbl (%ecx),%eax
+  800a50:	84 c0                	test   %al,%al
+  800a52:	74 04                	je     800a58 <strcmp+0x1c>
+  800a54:	3a 02                	cmp    (%edx),%al
+  800a56:	74 ef                	je     800a47 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a58:	0f b6 c0             	movzbl %al,%eax
+  800a5b:	0f b6 12             	movzbl (%edx),%edx
+  800a5e:	29 d0                	sub    %edx,%eax
+}
+  800a60:	5d                   	pop    %ebp
+  800a61:	c3                   	ret
+
+00800a62 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a62:	55                   	push   %ebp
+  800a63:	89 e5                	mov    %esp,%ebp
+  800a65:	53                   	push   %ebx
+  800a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a6c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a6f:	eb 09                	jmp    800a7a <strncmp+0x18>
+		n--, p++, q++;
+  800a71:	83 ea 01             	sub    $0x1,%edx
+  800a74:	83 c0 01             	add    $0x1,%eax
+  800a77:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a7a:	85 d2                	test   %edx,%edx
+  800a7c:	74 18                	je     800a96 <strncmp+0x34>
+  800a7e:	0f b6 18             	movzbl (%eax),%ebx
+  800a81:	84 db                	test   %bl,%bl
+  800a83:	74 04                	je     800a89 <strncmp+0x27>
+  800a85:	3a 19                	cmp    (%ecx),%bl
+  800a87:	74 e8                	je     800a71 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a89:	0f b6 00             	movzbl (%eax),%eax
+  800a8c:	0f b6 11             	movzbl (%ecx),%edx
+  800a8f:	29 d0                	sub    %edx,%eax
+}
+  800a91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a94:	c9                   	leave
+  800a95:	c3                   	ret
+		return 0;
+  800a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9b:	eb f4                	jmp    800a91 <strncmp+0x2f>
+
+00800a9d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a9d:	55                   	push   %ebp
+  800a9e:	89 e5                	mov    %esp,%ebp
+  800aa0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800aa7:	eb 03                	jmp    800aac <strchr+0xf>
+  800aa9:	83 c0 01             	add    $0x1,%eax
+  800aac:	0f b6 10             	movzbl (%eax),%edx
+  800aaf:	84 d2                	test   %dl,%dl
+  800ab1:	74 06                	je     800ab9 <strchr+0x1c>
+		if (*s == c)
+  800ab3:	38 ca                	cmp    %cl,%dl
+  800ab5:	75 f2                	jne    800aa9 <strchr+0xc>
+  800ab7:	eb 05                	jmp    800abe <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800abe:	5d                   	pop    %ebp
+  800abf:	c3                   	ret
+
+00800ac0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800aca:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800acd:	38 ca                	cmp    %cl,%dl
+  800acf:	74 09                	je     800ada <strfind+0x1a>
+  800ad1:	84 d2                	test   %dl,%dl
+  800ad3:	74 05                	je     800ada <strfind+0x1a>
+	for (; *s; s++)
+  800ad5:	83 c0 01             	add    $0x1,%eax
+  800ad8:	eb f0                	jmp    800aca <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800ada:	5d                   	pop    %ebp
+  800adb:	c3                   	ret
+
+00800adc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800adc:	55                   	push   %ebp
+  800add:	89 e5                	mov    %esp,%ebp
+  800adf:	57                   	push   %edi
+  800ae0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ae3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ae6:	85 c9                	test   %ecx,%ecx
+  800ae8:	74 20                	je     800b0a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800aea:	89 f8                	mov    %edi,%eax
+  800aec:	09 c8                	or     %ecx,%eax
+  800aee:	a8 03                	test   $0x3,%al
+  800af0:	75 12                	jne    800b04 <memset+0x28>
+		c &= 0xFF;
+  800af2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800af6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800afc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800aff:	fc                   	cld
+  800b00:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b02:	eb 06                	jmp    800b0a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b04:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b07:	fc                   	cld
+  800b08:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b0a:	89 f8                	mov    %edi,%eax
+  800b0c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b0f:	c9                   	leave
+  800b10:	c3                   	ret
+
+00800b11 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	57                   	push   %edi
+  800b15:	56                   	push   %esi
+  800b16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b19:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b1c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b1f:	39 c6                	cmp    %eax,%esi
+  800b21:	73 32                	jae    800b55 <memmove+0x44>
+  800b23:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b26:	39 d0                	cmp    %edx,%eax
+  800b28:	73 2b                	jae    800b55 <memmove+0x44>
+		s += n;
+		d += n;
+  800b2a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b2d:	89 d6                	mov    %edx,%esi
+  800b2f:	09 fe                	or     %edi,%esi
+  800b31:	09 ce                	or     %ecx,%esi
+  800b33:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b39:	75 0e                	jne    800b49 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b3b:	83 ef 04             	sub    $0x4,%edi
+  800b3e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b41:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b44:	fd                   	std
+  800b45:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b47:	eb 09                	jmp    800b52 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b49:	83 ef 01             	sub    $0x1,%edi
+  800b4c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b4f:	fd                   	std
+  800b50:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b52:	fc                   	cld
+  800b53:	eb 1a                	jmp    800b6f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b55:	89 f2                	mov    %esi,%edx
+  800b57:	09 c2                	or     %eax,%edx
+  800b59:	09 ca                	or     %ecx,%edx
+  800b5b:	f6 c2 03             	test   $0x3,%dl
+  800b5e:	75 0a                	jne    800b6a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b60:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b63:	89 c7                	mov    %eax,%edi
+  800b65:	fc                   	cld
+  800b66:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b68:	eb 05                	jmp    800b6f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b6a:	89 c7                	mov    %eax,%edi
+  800b6c:	fc                   	cld
+  800b6d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b6f:	5e                   	pop    %esi
+  800b70:	5f                   	pop    %edi
+  800b71:	5d                   	pop    %ebp
+  800b72:	c3                   	ret
+
+00800b73 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b73:	55                   	push   %ebp
+  800b74:	89 e5                	mov    %esp,%ebp
+  800b76:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b79:	ff 75 10             	push   0x10(%ebp)
+  800b7c:	ff 75 0c             	push   0xc(%ebp)
+  800b7f:	ff 75 08             	push   0x8(%ebp)
+  800b82:	e8 8a ff ff ff       	call   800b11 <memmove>
+}
+  800b87:	c9                   	leave
+  800b88:	c3                   	ret
+
+00800b89 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b89:	55                   	push   %ebp
+  800b8a:	89 e5                	mov    %esp,%ebp
+  800b8c:	56                   	push   %esi
+  800b8d:	53                   	push   %ebx
+  800b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b91:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b94:	89 c6                	mov    %eax,%esi
+  800b96:	03 75 10             	add    0x10(%ebp),%esi
+  800b99:	eb 06                	jmp    800ba1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b9b:	83 c0 01             	add    $0x1,%eax
+  800b9e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ba1:	39 f0                	cmp    %esi,%eax
+  800ba3:	74 14                	je     800bb9 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ba5:	0f b6 08             	movzbl (%eax),%ecx
+  800ba8:	0f b6 1a             	movzbl (%edx),%ebx
+  800bab:	38 d9                	cmp    %bl,%cl
+  800bad:	74 ec                	je     800b9b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800baf:	0f b6 c1             	movzbl %cl,%eax
+  800bb2:	0f b6 db             	movzbl %bl,%ebx
+  800bb5:	29 d8                	sub    %ebx,%eax
+  800bb7:	eb 05                	jmp    800bbe <memcmp+0x35>
+	}
+
+	return 0;
+  800bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bbe:	5b                   	pop    %ebx
+  800bbf:	5e                   	pop    %esi
+  800bc0:	5d                   	pop    %ebp
+  800bc1:	c3                   	ret
+
+00800bc2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bcb:	89 c2                	mov    %eax,%edx
+  800bcd:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bd0:	eb 03                	jmp    800bd5 <memfind+0x13>
+  800bd2:	83 c0 01             	add    $0x1,%eax
+  800bd5:	39 d0                	cmp    %edx,%eax
+  800bd7:	73 04                	jae    800bdd <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bd9:	38 08                	cmp    %cl,(%eax)
+  800bdb:	75 f5                	jne    800bd2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bdd:	5d                   	pop    %ebp
+  800bde:	c3                   	ret
+
+00800bdf <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	57                   	push   %edi
+  800be3:	56                   	push   %esi
+  800be4:	53                   	push   %ebx
+  800be5:	83 ec 1c             	sub    $0x1c,%esp
+  800be8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800beb:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bee:	eb 03                	jmp    800bf3 <strtol+0x14>
+		s++;
+  800bf0:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800bf3:	0f b6 06             	movzbl (%esi),%eax
+  800bf6:	3c 20                	cmp    $0x20,%al
+  800bf8:	74 f6                	je     800bf0 <strtol+0x11>
+  800bfa:	3c 09                	cmp    $0x9,%al
+  800bfc:	74 f2                	je     800bf0 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bfe:	3c 2b                	cmp    $0x2b,%al
+  800c00:	74 43                	je     800c45 <strtol+0x66>
+	int neg = 0;
+  800c02:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c07:	3c 2d                	cmp    $0x2d,%al
+  800c09:	74 44                	je     800c4f <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c0b:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c11:	75 0f                	jne    800c22 <strtol+0x43>
+  800c13:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c16:	74 41                	je     800c59 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c18:	85 ff                	test   %edi,%edi
+  800c1a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c1f:	0f 44 f8             	cmove  %eax,%edi
+  800c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c27:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c2c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c2f:	89 fb                	mov    %edi,%ebx
+  800c31:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c34:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c37:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c3a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c3d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c40:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c43:	eb 67                	jmp    800cac <strtol+0xcd>
+		s++;
+  800c45:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c4d:	eb bc                	jmp    800c0b <strtol+0x2c>
+		s++, neg = 1;
+  800c4f:	83 c6 01             	add    $0x1,%esi
+  800c52:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c57:	eb b2                	jmp    800c0b <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c59:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c5d:	74 0e                	je     800c6d <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c5f:	85 ff                	test   %edi,%edi
+  800c61:	75 bf                	jne    800c22 <strtol+0x43>
+		s++, base = 8;
+  800c63:	83 c6 01             	add    $0x1,%esi
+  800c66:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c6b:	eb b5                	jmp    800c22 <strtol+0x43>
+		s += 2, base = 16;
+  800c6d:	83 c6 02             	add    $0x2,%esi
+  800c70:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c75:	eb ab                	jmp    800c22 <strtol+0x43>
+			dig = *s - '0';
+  800c77:	0f be c9             	movsbl %cl,%ecx
+  800c7a:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c7d:	39 f9                	cmp    %edi,%ecx
+  800c7f:	7d 59                	jge    800cda <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c81:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c85:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c88:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c8b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c8e:	0f af d8             	imul   %eax,%ebx
+  800c91:	0f af d7             	imul   %edi,%edx
+  800c94:	01 d3                	add    %edx,%ebx
+  800c96:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c99:	f7 e7                	mul    %edi
+  800c9b:	01 da                	add    %ebx,%edx
+  800c9d:	89 cb                	mov    %ecx,%ebx
+  800c9f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ca2:	01 c8                	add    %ecx,%eax
+  800ca4:	11 da                	adc    %ebx,%edx
+  800ca6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ca9:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800cac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800caf:	0f b6 08             	movzbl (%eax),%ecx
+  800cb2:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800cb5:	80 fb 09             	cmp    $0x9,%bl
+  800cb8:	76 bd                	jbe    800c77 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800cba:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800cbd:	80 fb 19             	cmp    $0x19,%bl
+  800cc0:	77 08                	ja     800cca <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800cc2:	0f be c9             	movsbl %cl,%ecx
+  800cc5:	83 e9 57             	sub    $0x57,%ecx
+  800cc8:	eb b3                	jmp    800c7d <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cca:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800ccd:	80 fb 19             	cmp    $0x19,%bl
+  800cd0:	77 08                	ja     800cda <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800cd2:	0f be c9             	movsbl %cl,%ecx
+  800cd5:	83 e9 37             	sub    $0x37,%ecx
+  800cd8:	eb a3                	jmp    800c7d <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cda:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800cdd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ce0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800ce3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ce6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cea:	74 05                	je     800cf1 <strtol+0x112>
+		*endptr = (char *) s;
+  800cec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cef:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800cf1:	85 c9                	test   %ecx,%ecx
+  800cf3:	74 07                	je     800cfc <strtol+0x11d>
+  800cf5:	f7 d8                	neg    %eax
+  800cf7:	83 d2 00             	adc    $0x0,%edx
+  800cfa:	f7 da                	neg    %edx
+}
+  800cfc:	83 c4 1c             	add    $0x1c,%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+
+00800d04 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d04:	55                   	push   %ebp
+  800d05:	89 e5                	mov    %esp,%ebp
+  800d07:	57                   	push   %edi
+  800d08:	56                   	push   %esi
+  800d09:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d0a:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800d11:	74 18                	je     800d2b <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d1e:	89 c3                	mov    %eax,%ebx
+  800d20:	89 c7                	mov    %eax,%edi
+  800d22:	89 c6                	mov    %eax,%esi
+  800d24:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d36:	89 c3                	mov    %eax,%ebx
+  800d38:	89 c7                	mov    %eax,%edi
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	8d 35 45 0d 80 00    	lea    0x800d45,%esi
+  800d43:	0f 34                	sysenter
+  800d45:	5d                   	pop    %ebp
+		goto out;
+  800d46:	eb de                	jmp    800d26 <sys_cputs+0x22>
+
+00800d48 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	57                   	push   %edi
+  800d4c:	56                   	push   %esi
+  800d4d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d4e:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800d55:	74 19                	je     800d70 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d61:	89 d1                	mov    %edx,%ecx
+  800d63:	89 d3                	mov    %edx,%ebx
+  800d65:	89 d7                	mov    %edx,%edi
+  800d67:	89 d6                	mov    %edx,%esi
+  800d69:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d6b:	5b                   	pop    %ebx
+  800d6c:	5e                   	pop    %esi
+  800d6d:	5f                   	pop    %edi
+  800d6e:	5d                   	pop    %ebp
+  800d6f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d75:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d7a:	89 d1                	mov    %edx,%ecx
+  800d7c:	89 d3                	mov    %edx,%ebx
+  800d7e:	89 d7                	mov    %edx,%edi
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	8d 35 8b 0d 80 00    	lea    0x800d8b,%esi
+  800d89:	0f 34                	sysenter
+  800d8b:	5d                   	pop    %ebp
+		goto out;
+  800d8c:	eb dd                	jmp    800d6b <sys_cgetc+0x23>
+
+00800d8e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	57                   	push   %edi
+  800d92:	56                   	push   %esi
+  800d93:	53                   	push   %ebx
+  800d94:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d97:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800d9e:	74 21                	je     800dc1 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800da0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	89 cb                	mov    %ecx,%ebx
+  800daf:	89 cf                	mov    %ecx,%edi
+  800db1:	89 ce                	mov    %ecx,%esi
+  800db3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db5:	85 c0                	test   %eax,%eax
+  800db7:	7f 27                	jg     800de0 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800db9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbc:	5b                   	pop    %ebx
+  800dbd:	5e                   	pop    %esi
+  800dbe:	5f                   	pop    %edi
+  800dbf:	5d                   	pop    %ebp
+  800dc0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc9:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dce:	89 cb                	mov    %ecx,%ebx
+  800dd0:	89 cf                	mov    %ecx,%edi
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	8d 35 dd 0d 80 00    	lea    0x800ddd,%esi
+  800ddb:	0f 34                	sysenter
+  800ddd:	5d                   	pop    %ebp
+		goto out;
+  800dde:	eb d5                	jmp    800db5 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800de0:	83 ec 0c             	sub    $0xc,%esp
+  800de3:	50                   	push   %eax
+  800de4:	6a 03                	push   $0x3
+  800de6:	68 4b 38 80 00       	push   $0x80384b
+  800deb:	6a 3f                	push   $0x3f
+  800ded:	68 68 38 80 00       	push   $0x803868
+  800df2:	e8 71 f4 ff ff       	call   800268 <_panic>
+
+00800df7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	57                   	push   %edi
+  800dfb:	56                   	push   %esi
+  800dfc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dfd:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e04:	74 19                	je     800e1f <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e10:	89 d1                	mov    %edx,%ecx
+  800e12:	89 d3                	mov    %edx,%ebx
+  800e14:	89 d7                	mov    %edx,%edi
+  800e16:	89 d6                	mov    %edx,%esi
+  800e18:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5f                   	pop    %edi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e24:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e29:	89 d1                	mov    %edx,%ecx
+  800e2b:	89 d3                	mov    %edx,%ebx
+  800e2d:	89 d7                	mov    %edx,%edi
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	8d 35 3a 0e 80 00    	lea    0x800e3a,%esi
+  800e38:	0f 34                	sysenter
+  800e3a:	5d                   	pop    %ebp
+		goto out;
+  800e3b:	eb dd                	jmp    800e1a <sys_getenvid+0x23>
+
+00800e3d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e3d:	55                   	push   %ebp
+  800e3e:	89 e5                	mov    %esp,%ebp
+  800e40:	57                   	push   %edi
+  800e41:	56                   	push   %esi
+  800e42:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e43:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e4a:	74 19                	je     800e65 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e51:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e56:	89 d1                	mov    %edx,%ecx
+  800e58:	89 d3                	mov    %edx,%ebx
+  800e5a:	89 d7                	mov    %edx,%edi
+  800e5c:	89 d6                	mov    %edx,%esi
+  800e5e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e6f:	89 d1                	mov    %edx,%ecx
+  800e71:	89 d3                	mov    %edx,%ebx
+  800e73:	89 d7                	mov    %edx,%edi
+  800e75:	55                   	push   %ebp
+  800e76:	89 e5                	mov    %esp,%ebp
+  800e78:	8d 35 80 0e 80 00    	lea    0x800e80,%esi
+  800e7e:	0f 34                	sysenter
+  800e80:	5d                   	pop    %ebp
+		goto out;
+  800e81:	eb dd                	jmp    800e60 <sys_yield+0x23>
+
+00800e83 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e83:	55                   	push   %ebp
+  800e84:	89 e5                	mov    %esp,%ebp
+  800e86:	57                   	push   %edi
+  800e87:	56                   	push   %esi
+  800e88:	53                   	push   %ebx
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e8c:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e93:	74 23                	je     800eb8 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e95:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea8:	89 f7                	mov    %esi,%edi
+  800eaa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	7f 29                	jg     800ed9 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800eb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5f                   	pop    %edi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebe:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ec3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ec8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	8d 35 d6 0e 80 00    	lea    0x800ed6,%esi
+  800ed4:	0f 34                	sysenter
+  800ed6:	5d                   	pop    %ebp
+		goto out;
+  800ed7:	eb d3                	jmp    800eac <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed9:	83 ec 0c             	sub    $0xc,%esp
+  800edc:	50                   	push   %eax
+  800edd:	6a 04                	push   $0x4
+  800edf:	68 4b 38 80 00       	push   $0x80384b
+  800ee4:	6a 3f                	push   $0x3f
+  800ee6:	68 68 38 80 00       	push   $0x803868
+  800eeb:	e8 78 f3 ff ff       	call   800268 <_panic>
+
+00800ef0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ef0:	55                   	push   %ebp
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	57                   	push   %edi
+  800ef4:	56                   	push   %esi
+  800ef5:	53                   	push   %ebx
+  800ef6:	83 ec 0c             	sub    $0xc,%esp
+  800ef9:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800efc:	85 f6                	test   %esi,%esi
+  800efe:	75 09                	jne    800f09 <sys_page_map+0x19>
+  800f00:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800f07:	74 1f                	je     800f28 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f09:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f17:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f1a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f1c:	85 c0                	test   %eax,%eax
+  800f1e:	7f 27                	jg     800f47 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f23:	5b                   	pop    %ebx
+  800f24:	5e                   	pop    %esi
+  800f25:	5f                   	pop    %edi
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f36:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	8d 35 44 0f 80 00    	lea    0x800f44,%esi
+  800f42:	0f 34                	sysenter
+  800f44:	5d                   	pop    %ebp
+		goto out;
+  800f45:	eb d5                	jmp    800f1c <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f47:	83 ec 0c             	sub    $0xc,%esp
+  800f4a:	50                   	push   %eax
+  800f4b:	6a 05                	push   $0x5
+  800f4d:	68 4b 38 80 00       	push   $0x80384b
+  800f52:	6a 3f                	push   $0x3f
+  800f54:	68 68 38 80 00       	push   $0x803868
+  800f59:	e8 0a f3 ff ff       	call   800268 <_panic>
+
+00800f5e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f67:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800f6e:	74 22                	je     800f92 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f75:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f80:	89 df                	mov    %ebx,%edi
+  800f82:	89 de                	mov    %ebx,%esi
+  800f84:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f86:	85 c0                	test   %eax,%eax
+  800f88:	7f 28                	jg     800fb2 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8d:	5b                   	pop    %ebx
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5f                   	pop    %edi
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fa2:	89 df                	mov    %ebx,%edi
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	8d 35 af 0f 80 00    	lea    0x800faf,%esi
+  800fad:	0f 34                	sysenter
+  800faf:	5d                   	pop    %ebp
+		goto out;
+  800fb0:	eb d4                	jmp    800f86 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+  800fb5:	50                   	push   %eax
+  800fb6:	6a 06                	push   $0x6
+  800fb8:	68 4b 38 80 00       	push   $0x80384b
+  800fbd:	6a 3f                	push   $0x3f
+  800fbf:	68 68 38 80 00       	push   $0x803868
+  800fc4:	e8 9f f2 ff ff       	call   800268 <_panic>
+
+00800fc9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  800fcc:	57                   	push   %edi
+  800fcd:	56                   	push   %esi
+  800fce:	53                   	push   %ebx
+  800fcf:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fd2:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800fd9:	74 22                	je     800ffd <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800fdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe0:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fe5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800feb:	89 df                	mov    %ebx,%edi
+  800fed:	89 de                	mov    %ebx,%esi
+  800fef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff1:	85 c0                	test   %eax,%eax
+  800ff3:	7f 28                	jg     80101d <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ffd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801002:	8b 55 08             	mov    0x8(%ebp),%edx
+  801005:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801008:	b8 08 00 00 00       	mov    $0x8,%eax
+  80100d:	89 df                	mov    %ebx,%edi
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	8d 35 1a 10 80 00    	lea    0x80101a,%esi
+  801018:	0f 34                	sysenter
+  80101a:	5d                   	pop    %ebp
+		goto out;
+  80101b:	eb d4                	jmp    800ff1 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101d:	83 ec 0c             	sub    $0xc,%esp
+  801020:	50                   	push   %eax
+  801021:	6a 08                	push   $0x8
+  801023:	68 4b 38 80 00       	push   $0x80384b
+  801028:	6a 3f                	push   $0x3f
+  80102a:	68 68 38 80 00       	push   $0x803868
+  80102f:	e8 34 f2 ff ff       	call   800268 <_panic>
+
+00801034 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	56                   	push   %esi
+  801039:	53                   	push   %ebx
+  80103a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80103d:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801044:	74 22                	je     801068 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801046:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801056:	89 df                	mov    %ebx,%edi
+  801058:	89 de                	mov    %ebx,%esi
+  80105a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	7f 28                	jg     801088 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801060:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801063:	5b                   	pop    %ebx
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801068:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	b8 09 00 00 00       	mov    $0x9,%eax
+  801078:	89 df                	mov    %ebx,%edi
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	8d 35 85 10 80 00    	lea    0x801085,%esi
+  801083:	0f 34                	sysenter
+  801085:	5d                   	pop    %ebp
+		goto out;
+  801086:	eb d4                	jmp    80105c <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801088:	83 ec 0c             	sub    $0xc,%esp
+  80108b:	50                   	push   %eax
+  80108c:	6a 09                	push   $0x9
+  80108e:	68 4b 38 80 00       	push   $0x80384b
+  801093:	6a 3f                	push   $0x3f
+  801095:	68 68 38 80 00       	push   $0x803868
+  80109a:	e8 c9 f1 ff ff       	call   800268 <_panic>
+
+0080109f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80109f:	55                   	push   %ebp
+  8010a0:	89 e5                	mov    %esp,%ebp
+  8010a2:	57                   	push   %edi
+  8010a3:	56                   	push   %esi
+  8010a4:	53                   	push   %ebx
+  8010a5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010a8:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8010af:	74 22                	je     8010d3 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8010b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c1:	89 df                	mov    %ebx,%edi
+  8010c3:	89 de                	mov    %ebx,%esi
+  8010c5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c7:	85 c0                	test   %eax,%eax
+  8010c9:	7f 28                	jg     8010f3 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ce:	5b                   	pop    %ebx
+  8010cf:	5e                   	pop    %esi
+  8010d0:	5f                   	pop    %edi
+  8010d1:	5d                   	pop    %ebp
+  8010d2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010de:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e3:	89 df                	mov    %ebx,%edi
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	8d 35 f0 10 80 00    	lea    0x8010f0,%esi
+  8010ee:	0f 34                	sysenter
+  8010f0:	5d                   	pop    %ebp
+		goto out;
+  8010f1:	eb d4                	jmp    8010c7 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f3:	83 ec 0c             	sub    $0xc,%esp
+  8010f6:	50                   	push   %eax
+  8010f7:	6a 0a                	push   $0xa
+  8010f9:	68 4b 38 80 00       	push   $0x80384b
+  8010fe:	6a 3f                	push   $0x3f
+  801100:	68 68 38 80 00       	push   $0x803868
+  801105:	e8 5e f1 ff ff       	call   800268 <_panic>
+
+0080110a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80110a:	55                   	push   %ebp
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	57                   	push   %edi
+  80110e:	56                   	push   %esi
+  80110f:	53                   	push   %ebx
+  801110:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801113:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80111a:	74 22                	je     80113e <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80111c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801121:	b8 17 00 00 00       	mov    $0x17,%eax
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112c:	89 df                	mov    %ebx,%edi
+  80112e:	89 de                	mov    %ebx,%esi
+  801130:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801132:	85 c0                	test   %eax,%eax
+  801134:	7f 28                	jg     80115e <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5f                   	pop    %edi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80113e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801143:	8b 55 08             	mov    0x8(%ebp),%edx
+  801146:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801149:	b8 17 00 00 00       	mov    $0x17,%eax
+  80114e:	89 df                	mov    %ebx,%edi
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	8d 35 5b 11 80 00    	lea    0x80115b,%esi
+  801159:	0f 34                	sysenter
+  80115b:	5d                   	pop    %ebp
+		goto out;
+  80115c:	eb d4                	jmp    801132 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115e:	83 ec 0c             	sub    $0xc,%esp
+  801161:	50                   	push   %eax
+  801162:	6a 17                	push   $0x17
+  801164:	68 4b 38 80 00       	push   $0x80384b
+  801169:	6a 3f                	push   $0x3f
+  80116b:	68 68 38 80 00       	push   $0x803868
+  801170:	e8 f3 f0 ff ff       	call   800268 <_panic>
+
+00801175 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801175:	55                   	push   %ebp
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	57                   	push   %edi
+  801179:	56                   	push   %esi
+  80117a:	53                   	push   %ebx
+  80117b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80117e:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801185:	74 22                	je     8011a9 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801191:	8b 55 08             	mov    0x8(%ebp),%edx
+  801194:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801197:	89 df                	mov    %ebx,%edi
+  801199:	89 de                	mov    %ebx,%esi
+  80119b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80119d:	85 c0                	test   %eax,%eax
+  80119f:	7f 28                	jg     8011c9 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8011a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011b9:	89 df                	mov    %ebx,%edi
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	8d 35 c6 11 80 00    	lea    0x8011c6,%esi
+  8011c4:	0f 34                	sysenter
+  8011c6:	5d                   	pop    %ebp
+		goto out;
+  8011c7:	eb d4                	jmp    80119d <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c9:	83 ec 0c             	sub    $0xc,%esp
+  8011cc:	50                   	push   %eax
+  8011cd:	6a 18                	push   $0x18
+  8011cf:	68 4b 38 80 00       	push   $0x80384b
+  8011d4:	6a 3f                	push   $0x3f
+  8011d6:	68 68 38 80 00       	push   $0x803868
+  8011db:	e8 88 f0 ff ff       	call   800268 <_panic>
+
+008011e0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011e0:	55                   	push   %ebp
+  8011e1:	89 e5                	mov    %esp,%ebp
+  8011e3:	57                   	push   %edi
+  8011e4:	56                   	push   %esi
+  8011e5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011e6:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8011ed:	74 1d                	je     80120c <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8011ef:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801202:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801205:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801207:	5b                   	pop    %ebx
+  801208:	5e                   	pop    %esi
+  801209:	5f                   	pop    %edi
+  80120a:	5d                   	pop    %ebp
+  80120b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801217:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80121a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	8d 35 28 12 80 00    	lea    0x801228,%esi
+  801226:	0f 34                	sysenter
+  801228:	5d                   	pop    %ebp
+		goto out;
+  801229:	eb dc                	jmp    801207 <sys_ipc_try_send+0x27>
+
+0080122b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	57                   	push   %edi
+  80122f:	56                   	push   %esi
+  801230:	53                   	push   %ebx
+  801231:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801234:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80123b:	74 21                	je     80125e <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80123d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801242:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801247:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124a:	89 cb                	mov    %ecx,%ebx
+  80124c:	89 cf                	mov    %ecx,%edi
+  80124e:	89 ce                	mov    %ecx,%esi
+  801250:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801252:	85 c0                	test   %eax,%eax
+  801254:	7f 27                	jg     80127d <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801259:	5b                   	pop    %ebx
+  80125a:	5e                   	pop    %esi
+  80125b:	5f                   	pop    %edi
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80125e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801261:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801266:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80126b:	89 cb                	mov    %ecx,%ebx
+  80126d:	89 cf                	mov    %ecx,%edi
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	8d 35 7a 12 80 00    	lea    0x80127a,%esi
+  801278:	0f 34                	sysenter
+  80127a:	5d                   	pop    %ebp
+		goto out;
+  80127b:	eb d5                	jmp    801252 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80127d:	83 ec 0c             	sub    $0xc,%esp
+  801280:	50                   	push   %eax
+  801281:	6a 0d                	push   $0xd
+  801283:	68 4b 38 80 00       	push   $0x80384b
+  801288:	6a 3f                	push   $0x3f
+  80128a:	68 68 38 80 00       	push   $0x803868
+  80128f:	e8 d4 ef ff ff       	call   800268 <_panic>
+
+00801294 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+  801297:	57                   	push   %edi
+  801298:	56                   	push   %esi
+  801299:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80129a:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8012a1:	74 1b                	je     8012be <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8012a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b3:	89 df                	mov    %ebx,%edi
+  8012b5:	89 de                	mov    %ebx,%esi
+  8012b7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8012b9:	5b                   	pop    %ebx
+  8012ba:	5e                   	pop    %esi
+  8012bb:	5f                   	pop    %edi
+  8012bc:	5d                   	pop    %ebp
+  8012bd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012ce:	89 df                	mov    %ebx,%edi
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	8d 35 db 12 80 00    	lea    0x8012db,%esi
+  8012d9:	0f 34                	sysenter
+  8012db:	5d                   	pop    %ebp
+		goto out;
+  8012dc:	eb db                	jmp    8012b9 <sys_ipc_recv_until+0x25>
+
+008012de <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	57                   	push   %edi
+  8012e2:	56                   	push   %esi
+  8012e3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012e4:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8012eb:	74 19                	je     801306 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8012ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012f7:	89 d1                	mov    %edx,%ecx
+  8012f9:	89 d3                	mov    %edx,%ebx
+  8012fb:	89 d7                	mov    %edx,%edi
+  8012fd:	89 d6                	mov    %edx,%esi
+  8012ff:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5f                   	pop    %edi
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801310:	89 d1                	mov    %edx,%ecx
+  801312:	89 d3                	mov    %edx,%ebx
+  801314:	89 d7                	mov    %edx,%edi
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	8d 35 21 13 80 00    	lea    0x801321,%esi
+  80131f:	0f 34                	sysenter
+  801321:	5d                   	pop    %ebp
+		goto out;
+  801322:	eb dd                	jmp    801301 <sys_time_msec+0x23>
+
+00801324 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801324:	55                   	push   %ebp
+  801325:	89 e5                	mov    %esp,%ebp
+  801327:	57                   	push   %edi
+  801328:	56                   	push   %esi
+  801329:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80132a:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801331:	74 1a                	je     80134d <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801333:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801338:	b8 10 00 00 00       	mov    $0x10,%eax
+  80133d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801340:	89 cb                	mov    %ecx,%ebx
+  801342:	89 cf                	mov    %ecx,%edi
+  801344:	89 ce                	mov    %ecx,%esi
+  801346:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801348:	5b                   	pop    %ebx
+  801349:	5e                   	pop    %esi
+  80134a:	5f                   	pop    %edi
+  80134b:	5d                   	pop    %ebp
+  80134c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80134d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801350:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801355:	b8 10 00 00 00       	mov    $0x10,%eax
+  80135a:	89 cb                	mov    %ecx,%ebx
+  80135c:	89 cf                	mov    %ecx,%edi
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	8d 35 69 13 80 00    	lea    0x801369,%esi
+  801367:	0f 34                	sysenter
+  801369:	5d                   	pop    %ebp
+		goto out;
+  80136a:	eb dc                	jmp    801348 <sys_sleep_until+0x24>
+
+0080136c <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80136c:	55                   	push   %ebp
+  80136d:	89 e5                	mov    %esp,%ebp
+  80136f:	57                   	push   %edi
+  801370:	56                   	push   %esi
+  801371:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801372:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801379:	74 1a                	je     801395 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80137b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801380:	b8 11 00 00 00       	mov    $0x11,%eax
+  801385:	8b 55 08             	mov    0x8(%ebp),%edx
+  801388:	89 cb                	mov    %ecx,%ebx
+  80138a:	89 cf                	mov    %ecx,%edi
+  80138c:	89 ce                	mov    %ecx,%esi
+  80138e:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801390:	5b                   	pop    %ebx
+  801391:	5e                   	pop    %esi
+  801392:	5f                   	pop    %edi
+  801393:	5d                   	pop    %ebp
+  801394:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80139d:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013a2:	89 cb                	mov    %ecx,%ebx
+  8013a4:	89 cf                	mov    %ecx,%edi
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	8d 35 b1 13 80 00    	lea    0x8013b1,%esi
+  8013af:	0f 34                	sysenter
+  8013b1:	5d                   	pop    %ebp
+		goto out;
+  8013b2:	eb dc                	jmp    801390 <sys_env_print_stats+0x24>
+
+008013b4 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8013b4:	55                   	push   %ebp
+  8013b5:	89 e5                	mov    %esp,%ebp
+  8013b7:	57                   	push   %edi
+  8013b8:	56                   	push   %esi
+  8013b9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013ba:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8013c1:	74 1b                	je     8013de <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8013c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c8:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d3:	89 df                	mov    %ebx,%edi
+  8013d5:	89 de                	mov    %ebx,%esi
+  8013d7:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8013d9:	5b                   	pop    %ebx
+  8013da:	5e                   	pop    %esi
+  8013db:	5f                   	pop    %edi
+  8013dc:	5d                   	pop    %ebp
+  8013dd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013ee:	89 df                	mov    %ebx,%edi
+  8013f0:	55                   	push   %ebp
+  8013f1:	89 e5                	mov    %esp,%ebp
+  8013f3:	8d 35 fb 13 80 00    	lea    0x8013fb,%esi
+  8013f9:	0f 34                	sysenter
+  8013fb:	5d                   	pop    %ebp
+		goto out;
+  8013fc:	eb db                	jmp    8013d9 <sys_perf+0x25>
+
+008013fe <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8013fe:	55                   	push   %ebp
+  8013ff:	89 e5                	mov    %esp,%ebp
+  801401:	57                   	push   %edi
+  801402:	56                   	push   %esi
+  801403:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801404:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80140b:	74 19                	je     801426 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80140d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801412:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801417:	89 d1                	mov    %edx,%ecx
+  801419:	89 d3                	mov    %edx,%ebx
+  80141b:	89 d7                	mov    %edx,%edi
+  80141d:	89 d6                	mov    %edx,%esi
+  80141f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801421:	5b                   	pop    %ebx
+  801422:	5e                   	pop    %esi
+  801423:	5f                   	pop    %edi
+  801424:	5d                   	pop    %ebp
+  801425:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801426:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801430:	89 d1                	mov    %edx,%ecx
+  801432:	89 d3                	mov    %edx,%ebx
+  801434:	89 d7                	mov    %edx,%edi
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+  801439:	8d 35 41 14 80 00    	lea    0x801441,%esi
+  80143f:	0f 34                	sysenter
+  801441:	5d                   	pop    %ebp
+		goto out;
+  801442:	eb dd                	jmp    801421 <sys_fork+0x23>
+
+00801444 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801444:	55                   	push   %ebp
+  801445:	89 e5                	mov    %esp,%ebp
+  801447:	57                   	push   %edi
+  801448:	56                   	push   %esi
+  801449:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80144a:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801451:	74 1c                	je     80146f <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801453:	be 00 00 00 00       	mov    $0x0,%esi
+  801458:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80145d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801460:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801463:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801466:	89 f7                	mov    %esi,%edi
+  801468:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80146a:	5b                   	pop    %ebx
+  80146b:	5e                   	pop    %esi
+  80146c:	5f                   	pop    %edi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80146f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801472:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801475:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80147a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80147f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	8d 35 8d 14 80 00    	lea    0x80148d,%esi
+  80148b:	0f 34                	sysenter
+  80148d:	5d                   	pop    %ebp
+		goto out;
+  80148e:	eb da                	jmp    80146a <sys_thread_create+0x26>
+
+00801490 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	57                   	push   %edi
+  801494:	56                   	push   %esi
+  801495:	53                   	push   %ebx
+  801496:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801499:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8014a0:	74 24                	je     8014c6 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8014a2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014b8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014ba:	85 c0                	test   %eax,%eax
+  8014bc:	7f 27                	jg     8014e5 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8014be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014c1:	5b                   	pop    %ebx
+  8014c2:	5e                   	pop    %esi
+  8014c3:	5f                   	pop    %edi
+  8014c4:	5d                   	pop    %ebp
+  8014c5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014d7:	55                   	push   %ebp
+  8014d8:	89 e5                	mov    %esp,%ebp
+  8014da:	8d 35 e2 14 80 00    	lea    0x8014e2,%esi
+  8014e0:	0f 34                	sysenter
+  8014e2:	5d                   	pop    %ebp
+		goto out;
+  8014e3:	eb d5                	jmp    8014ba <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e5:	83 ec 0c             	sub    $0xc,%esp
+  8014e8:	50                   	push   %eax
+  8014e9:	6a 1f                	push   $0x1f
+  8014eb:	68 4b 38 80 00       	push   $0x80384b
+  8014f0:	6a 3f                	push   $0x3f
+  8014f2:	68 68 38 80 00       	push   $0x803868
+  8014f7:	e8 6c ed ff ff       	call   800268 <_panic>
+
+008014fc <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8014fc:	55                   	push   %ebp
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	57                   	push   %edi
+  801500:	56                   	push   %esi
+  801501:	53                   	push   %ebx
+  801502:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801505:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80150c:	74 23                	je     801531 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80150e:	be 00 00 00 00       	mov    $0x0,%esi
+  801513:	b8 20 00 00 00       	mov    $0x20,%eax
+  801518:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801521:	89 f7                	mov    %esi,%edi
+  801523:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801525:	85 c0                	test   %eax,%eax
+  801527:	7f 29                	jg     801552 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152c:	5b                   	pop    %ebx
+  80152d:	5e                   	pop    %esi
+  80152e:	5f                   	pop    %edi
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801531:	8b 55 08             	mov    0x8(%ebp),%edx
+  801534:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801537:	b8 20 00 00 00       	mov    $0x20,%eax
+  80153c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801541:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801544:	55                   	push   %ebp
+  801545:	89 e5                	mov    %esp,%ebp
+  801547:	8d 35 4f 15 80 00    	lea    0x80154f,%esi
+  80154d:	0f 34                	sysenter
+  80154f:	5d                   	pop    %ebp
+		goto out;
+  801550:	eb d3                	jmp    801525 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801552:	83 ec 0c             	sub    $0xc,%esp
+  801555:	50                   	push   %eax
+  801556:	6a 20                	push   $0x20
+  801558:	68 4b 38 80 00       	push   $0x80384b
+  80155d:	6a 3f                	push   $0x3f
+  80155f:	68 68 38 80 00       	push   $0x803868
+  801564:	e8 ff ec ff ff       	call   800268 <_panic>
+
+00801569 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	57                   	push   %edi
+  80156d:	56                   	push   %esi
+  80156e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80156f:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801576:	74 1b                	je     801593 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801578:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801582:	8b 55 08             	mov    0x8(%ebp),%edx
+  801585:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801588:	89 df                	mov    %ebx,%edi
+  80158a:	89 de                	mov    %ebx,%esi
+  80158c:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80158e:	5b                   	pop    %ebx
+  80158f:	5e                   	pop    %esi
+  801590:	5f                   	pop    %edi
+  801591:	5d                   	pop    %ebp
+  801592:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801593:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801598:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015a3:	89 df                	mov    %ebx,%edi
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	8d 35 b0 15 80 00    	lea    0x8015b0,%esi
+  8015ae:	0f 34                	sysenter
+  8015b0:	5d                   	pop    %ebp
+		goto out;
+  8015b1:	eb db                	jmp    80158e <sys_batch+0x25>
+
+008015b3 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8015b3:	55                   	push   %ebp
+  8015b4:	89 e5                	mov    %esp,%ebp
+  8015b6:	57                   	push   %edi
+  8015b7:	56                   	push   %esi
+  8015b8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015b9:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8015c0:	74 1a                	je     8015dc <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8015c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015c7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cf:	89 cb                	mov    %ecx,%ebx
+  8015d1:	89 cf                	mov    %ecx,%edi
+  8015d3:	89 ce                	mov    %ecx,%esi
+  8015d5:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8015d7:	5b                   	pop    %ebx
+  8015d8:	5e                   	pop    %esi
+  8015d9:	5f                   	pop    %edi
+  8015da:	5d                   	pop    %ebp
+  8015db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015e9:	89 cb                	mov    %ecx,%ebx
+  8015eb:	89 cf                	mov    %ecx,%edi
+  8015ed:	55                   	push   %ebp
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	8d 35 f8 15 80 00    	lea    0x8015f8,%esi
+  8015f6:	0f 34                	sysenter
+  8015f8:	5d                   	pop    %ebp
+		goto out;
+  8015f9:	eb dc                	jmp    8015d7 <sys_trace_ctl+0x24>
+
+008015fb <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8015fb:	55                   	push   %ebp
+  8015fc:	89 e5                	mov    %esp,%ebp
+  8015fe:	57                   	push   %edi
+  8015ff:	56                   	push   %esi
+  801600:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801601:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801608:	74 1c                	je     801626 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80160a:	be 00 00 00 00       	mov    $0x0,%esi
+  80160f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801614:	8b 55 08             	mov    0x8(%ebp),%edx
+  801617:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80161d:	89 f7                	mov    %esi,%edi
+  80161f:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801621:	5b                   	pop    %ebx
+  801622:	5e                   	pop    %esi
+  801623:	5f                   	pop    %edi
+  801624:	5d                   	pop    %ebp
+  801625:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801626:	8b 55 08             	mov    0x8(%ebp),%edx
+  801629:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80162c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801631:	bf 00 00 00 00       	mov    $0x0,%edi
+  801636:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801639:	55                   	push   %ebp
+  80163a:	89 e5                	mov    %esp,%ebp
+  80163c:	8d 35 44 16 80 00    	lea    0x801644,%esi
+  801642:	0f 34                	sysenter
+  801644:	5d                   	pop    %ebp
+		goto out;
+  801645:	eb da                	jmp    801621 <sys_trace_read+0x26>
+
+00801647 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801647:	55                   	push   %ebp
+  801648:	89 e5                	mov    %esp,%ebp
+  80164a:	57                   	push   %edi
+  80164b:	56                   	push   %esi
+  80164c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80164d:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801654:	74 1c                	je     801672 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801656:	be 00 00 00 00       	mov    $0x0,%esi
+  80165b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801660:	8b 55 08             	mov    0x8(%ebp),%edx
+  801663:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801666:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801669:	89 f7                	mov    %esi,%edi
+  80166b:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80166d:	5b                   	pop    %ebx
+  80166e:	5e                   	pop    %esi
+  80166f:	5f                   	pop    %edi
+  801670:	5d                   	pop    %ebp
+  801671:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801672:	8b 55 08             	mov    0x8(%ebp),%edx
+  801675:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801678:	b8 21 00 00 00       	mov    $0x21,%eax
+  80167d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801682:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	8d 35 90 16 80 00    	lea    0x801690,%esi
+  80168e:	0f 34                	sysenter
+  801690:	5d                   	pop    %ebp
+		goto out;
+  801691:	eb da                	jmp    80166d <sys_meminfo+0x26>
+
+00801693 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	57                   	push   %edi
+  801697:	56                   	push   %esi
+  801698:	53                   	push   %ebx
+  801699:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80169c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8016a0:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8016a7:	74 1f                	je     8016c8 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8016a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ae:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b6:	89 df                	mov    %ebx,%edi
+  8016b8:	89 de                	mov    %ebx,%esi
+  8016ba:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016bc:	85 c0                	test   %eax,%eax
+  8016be:	7f 25                	jg     8016e5 <sys_env_set_ksm+0x52>
+}
+  8016c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c3:	5b                   	pop    %ebx
+  8016c4:	5e                   	pop    %esi
+  8016c5:	5f                   	pop    %edi
+  8016c6:	5d                   	pop    %ebp
+  8016c7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d0:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016d5:	89 df                	mov    %ebx,%edi
+  8016d7:	55                   	push   %ebp
+  8016d8:	89 e5                	mov    %esp,%ebp
+  8016da:	8d 35 e2 16 80 00    	lea    0x8016e2,%esi
+  8016e0:	0f 34                	sysenter
+  8016e2:	5d                   	pop    %ebp
+		goto out;
+  8016e3:	eb d7                	jmp    8016bc <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016e5:	83 ec 0c             	sub    $0xc,%esp
+  8016e8:	50                   	push   %eax
+  8016e9:	6a 22                	push   $0x22
+  8016eb:	68 4b 38 80 00       	push   $0x80384b
+  8016f0:	6a 3f                	push   $0x3f
+  8016f2:	68 68 38 80 00       	push   $0x803868
+  8016f7:	e8 6c eb ff ff       	call   800268 <_panic>
+
+008016fc <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8016fc:	55                   	push   %ebp
+  8016fd:	89 e5                	mov    %esp,%ebp
+  8016ff:	57                   	push   %edi
+  801700:	56                   	push   %esi
+  801701:	53                   	push   %ebx
+  801702:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801705:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801708:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80170f:	74 24                	je     801735 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801711:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801716:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80171b:	89 cb                	mov    %ecx,%ebx
+  80171d:	89 cf                	mov    %ecx,%edi
+  80171f:	89 ce                	mov    %ecx,%esi
+  801721:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801723:	85 c0                	test   %eax,%eax
+  801725:	7f 2a                	jg     801751 <sys_time_nsec+0x55>
+	return ns;
+}
+  801727:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80172a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80172d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801730:	5b                   	pop    %ebx
+  801731:	5e                   	pop    %esi
+  801732:	5f                   	pop    %edi
+  801733:	5d                   	pop    %ebp
+  801734:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801735:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80173f:	89 cb                	mov    %ecx,%ebx
+  801741:	89 cf                	mov    %ecx,%edi
+  801743:	55                   	push   %ebp
+  801744:	89 e5                	mov    %esp,%ebp
+  801746:	8d 35 4e 17 80 00    	lea    0x80174e,%esi
+  80174c:	0f 34                	sysenter
+  80174e:	5d                   	pop    %ebp
+		goto out;
+  80174f:	eb d2                	jmp    801723 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801751:	83 ec 0c             	sub    $0xc,%esp
+  801754:	50                   	push   %eax
+  801755:	6a 0f                	push   $0xf
+  801757:	68 4b 38 80 00       	push   $0x80384b
+  80175c:	6a 3f                	push   $0x3f
+  80175e:	68 68 38 80 00       	push   $0x803868
+  801763:	e8 00 eb ff ff       	call   800268 <_panic>
+
+00801768 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	57                   	push   %edi
+  80176c:	56                   	push   %esi
+  80176d:	53                   	push   %ebx
+  80176e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801771:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801778:	74 22                	je     80179c <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80177a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801784:	8b 55 08             	mov    0x8(%ebp),%edx
+  801787:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178a:	89 df                	mov    %ebx,%edi
+  80178c:	89 de                	mov    %ebx,%esi
+  80178e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801790:	85 c0                	test   %eax,%eax
+  801792:	7f 28                	jg     8017bc <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801794:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801797:	5b                   	pop    %ebx
+  801798:	5e                   	pop    %esi
+  801799:	5f                   	pop    %edi
+  80179a:	5d                   	pop    %ebp
+  80179b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80179c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017ac:	89 df                	mov    %ebx,%edi
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	8d 35 b9 17 80 00    	lea    0x8017b9,%esi
+  8017b7:	0f 34                	sysenter
+  8017b9:	5d                   	pop    %ebp
+		goto out;
+  8017ba:	eb d4                	jmp    801790 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017bc:	83 ec 0c             	sub    $0xc,%esp
+  8017bf:	50                   	push   %eax
+  8017c0:	6a 12                	push   $0x12
+  8017c2:	68 4b 38 80 00       	push   $0x80384b
+  8017c7:	6a 3f                	push   $0x3f
+  8017c9:	68 68 38 80 00       	push   $0x803868
+  8017ce:	e8 95 ea ff ff       	call   800268 <_panic>
+
+008017d3 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8017d3:	55                   	push   %ebp
+  8017d4:	89 e5                	mov    %esp,%ebp
+  8017d6:	57                   	push   %edi
+  8017d7:	56                   	push   %esi
+  8017d8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017d9:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8017e0:	74 1b                	je     8017fd <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8017e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f2:	89 df                	mov    %ebx,%edi
+  8017f4:	89 de                	mov    %ebx,%esi
+  8017f6:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017f8:	5b                   	pop    %ebx
+  8017f9:	5e                   	pop    %esi
+  8017fa:	5f                   	pop    %edi
+  8017fb:	5d                   	pop    %ebp
+  8017fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801802:	8b 55 08             	mov    0x8(%ebp),%edx
+  801805:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801808:	b8 13 00 00 00       	mov    $0x13,%eax
+  80180d:	89 df                	mov    %ebx,%edi
+  80180f:	55                   	push   %ebp
+  801810:	89 e5                	mov    %esp,%ebp
+  801812:	8d 35 1a 18 80 00    	lea    0x80181a,%esi
+  801818:	0f 34                	sysenter
+  80181a:	5d                   	pop    %ebp
+		goto out;
+  80181b:	eb db                	jmp    8017f8 <sys_e1000_receive+0x25>
+
+0080181d <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80181d:	55                   	push   %ebp
+  80181e:	89 e5                	mov    %esp,%ebp
+  801820:	57                   	push   %edi
+  801821:	56                   	push   %esi
+  801822:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801823:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80182a:	74 1b                	je     801847 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80182c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801831:	b8 14 00 00 00       	mov    $0x14,%eax
+  801836:	8b 55 08             	mov    0x8(%ebp),%edx
+  801839:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80183c:	89 df                	mov    %ebx,%edi
+  80183e:	89 de                	mov    %ebx,%esi
+  801840:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801842:	5b                   	pop    %ebx
+  801843:	5e                   	pop    %esi
+  801844:	5f                   	pop    %edi
+  801845:	5d                   	pop    %ebp
+  801846:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801847:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801852:	b8 14 00 00 00       	mov    $0x14,%eax
+  801857:	89 df                	mov    %ebx,%edi
+  801859:	55                   	push   %ebp
+  80185a:	89 e5                	mov    %esp,%ebp
+  80185c:	8d 35 64 18 80 00    	lea    0x801864,%esi
+  801862:	0f 34                	sysenter
+  801864:	5d                   	pop    %ebp
+		goto out;
+  801865:	eb db                	jmp    801842 <sys_e1000_read_hwaddr+0x25>
+
+00801867 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801867:	55                   	push   %ebp
+  801868:	89 e5                	mov    %esp,%ebp
+  80186a:	57                   	push   %edi
+  80186b:	56                   	push   %esi
+  80186c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80186d:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801874:	74 1a                	je     801890 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801876:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80187b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801880:	8b 55 08             	mov    0x8(%ebp),%edx
+  801883:	89 cb                	mov    %ecx,%ebx
+  801885:	89 cf                	mov    %ecx,%edi
+  801887:	89 ce                	mov    %ecx,%esi
+  801889:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80188b:	5b                   	pop    %ebx
+  80188c:	5e                   	pop    %esi
+  80188d:	5f                   	pop    %edi
+  80188e:	5d                   	pop    %ebp
+  80188f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801890:	8b 55 08             	mov    0x8(%ebp),%edx
+  801893:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801898:	b8 15 00 00 00       	mov    $0x15,%eax
+  80189d:	89 cb                	mov    %ecx,%ebx
+  80189f:	89 cf                	mov    %ecx,%edi
+  8018a1:	55                   	push   %ebp
+  8018a2:	89 e5                	mov    %esp,%ebp
+  8018a4:	8d 35 ac 18 80 00    	lea    0x8018ac,%esi
+  8018aa:	0f 34                	sysenter
+  8018ac:	5d                   	pop    %ebp
+		goto out;
+  8018ad:	eb dc                	jmp    80188b <sys_sb16_read_version+0x24>
+
+008018af <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8018af:	55                   	push   %ebp
+  8018b0:	89 e5                	mov    %esp,%ebp
+  8018b2:	57                   	push   %edi
+  8018b3:	56                   	push   %esi
+  8018b4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018b5:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8018bc:	74 1b                	je     8018d9 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8018be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ce:	89 df                	mov    %ebx,%edi
+  8018d0:	89 de                	mov    %ebx,%esi
+  8018d2:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8018d4:	5b                   	pop    %ebx
+  8018d5:	5e                   	pop    %esi
+  8018d6:	5f                   	pop    %edi
+  8018d7:	5d                   	pop    %ebp
+  8018d8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018e9:	89 df                	mov    %ebx,%edi
+  8018eb:	55                   	push   %ebp
+  8018ec:	89 e5                	mov    %esp,%ebp
+  8018ee:	8d 35 f6 18 80 00    	lea    0x8018f6,%esi
+  8018f4:	0f 34                	sysenter
+  8018f6:	5d                   	pop    %ebp
+		goto out;
+  8018f7:	eb db                	jmp    8018d4 <sys_sb16_play+0x25>
+
+008018f9 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  8018f9:	55                   	push   %ebp
+  8018fa:	89 e5                	mov    %esp,%ebp
+  8018fc:	53                   	push   %ebx
+  8018fd:	83 ec 04             	sub    $0x4,%esp
+  801900:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801902:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801909:	f6 c4 04             	test   $0x4,%ah
+  80190c:	74 0c                	je     80191a <dupperm+0x21>
+  80190e:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801915:	f6 c4 08             	test   $0x8,%ah
+  801918:	75 62                	jne    80197c <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80191a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801921:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801926:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80192c:	74 19                	je     801947 <dupperm+0x4e>
+  80192e:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801935:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  80193a:	83 f8 01             	cmp    $0x1,%eax
+  80193d:	19 c0                	sbb    %eax,%eax
+  80193f:	25 00 08 00 00       	and    $0x800,%eax
+  801944:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801947:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  80194e:	89 c1                	mov    %eax,%ecx
+  801950:	80 cd 04             	or     $0x4,%ch
+  801953:	f6 c7 04             	test   $0x4,%bh
+  801956:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801959:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801960:	f6 c1 02             	test   $0x2,%cl
+  801963:	74 12                	je     801977 <dupperm+0x7e>
+  801965:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  80196c:	89 c2                	mov    %eax,%edx
+  80196e:	83 ca 02             	or     $0x2,%edx
+  801971:	f6 c5 04             	test   $0x4,%ch
+  801974:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801977:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80197a:	c9                   	leave
+  80197b:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  80197c:	68 78 38 80 00       	push   $0x803878
+  801981:	68 10 39 80 00       	push   $0x803910
+  801986:	6a 39                	push   $0x39
+  801988:	68 25 39 80 00       	push   $0x803925
+  80198d:	e8 d6 e8 ff ff       	call   800268 <_panic>
+
+00801992 <pgfault>:
+{
+  801992:	55                   	push   %ebp
+  801993:	89 e5                	mov    %esp,%ebp
+  801995:	53                   	push   %ebx
+  801996:	83 ec 04             	sub    $0x4,%esp
+  801999:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80199c:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80199e:	89 c3                	mov    %eax,%ebx
+  8019a0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019a6:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8019aa:	74 6d                	je     801a19 <pgfault+0x87>
+  8019ac:	89 da                	mov    %ebx,%edx
+  8019ae:	c1 ea 16             	shr    $0x16,%edx
+  8019b1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019b8:	f6 c2 80             	test   $0x80,%dl
+  8019bb:	75 5c                	jne    801a19 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8019bd:	c1 e8 0c             	shr    $0xc,%eax
+  8019c0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019c7:	f6 c4 08             	test   $0x8,%ah
+  8019ca:	74 4d                	je     801a19 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8019cc:	83 ec 04             	sub    $0x4,%esp
+  8019cf:	6a 07                	push   $0x7
+  8019d1:	68 00 f0 7f 00       	push   $0x7ff000
+  8019d6:	6a 00                	push   $0x0
+  8019d8:	e8 a6 f4 ff ff       	call   800e83 <sys_page_alloc>
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 49                	js     801a2d <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8019e4:	83 ec 04             	sub    $0x4,%esp
+  8019e7:	68 00 10 00 00       	push   $0x1000
+  8019ec:	53                   	push   %ebx
+  8019ed:	68 00 f0 7f 00       	push   $0x7ff000
+  8019f2:	e8 1a f1 ff ff       	call   800b11 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8019f7:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8019fe:	53                   	push   %ebx
+  8019ff:	6a 00                	push   $0x0
+  801a01:	68 00 f0 7f 00       	push   $0x7ff000
+  801a06:	6a 00                	push   $0x0
+  801a08:	e8 e3 f4 ff ff       	call   800ef0 <sys_page_map>
+  801a0d:	83 c4 20             	add    $0x20,%esp
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	78 2d                	js     801a41 <pgfault+0xaf>
+}
+  801a14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a17:	c9                   	leave
+  801a18:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801a19:	83 ec 04             	sub    $0x4,%esp
+  801a1c:	68 30 39 80 00       	push   $0x803930
+  801a21:	6a 1e                	push   $0x1e
+  801a23:	68 25 39 80 00       	push   $0x803925
+  801a28:	e8 3b e8 ff ff       	call   800268 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801a2d:	83 ec 04             	sub    $0x4,%esp
+  801a30:	68 ac 38 80 00       	push   $0x8038ac
+  801a35:	6a 29                	push   $0x29
+  801a37:	68 25 39 80 00       	push   $0x803925
+  801a3c:	e8 27 e8 ff ff       	call   800268 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801a41:	50                   	push   %eax
+  801a42:	68 e0 38 80 00       	push   $0x8038e0
+  801a47:	6a 2e                	push   $0x2e
+  801a49:	68 25 39 80 00       	push   $0x803925
+  801a4e:	e8 15 e8 ff ff       	call   800268 <_panic>
+
+00801a53 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801a53:	55                   	push   %ebp
+  801a54:	89 e5                	mov    %esp,%ebp
+  801a56:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801a59:	ff 75 0c             	push   0xc(%ebp)
+  801a5c:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801a5f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a66:	e8 23 f3 ff ff       	call   800d8e <sys_env_destroy>
+}
+  801a6b:	83 c4 10             	add    $0x10,%esp
+  801a6e:	c9                   	leave
+  801a6f:	c3                   	ret
+
+00801a70 <ufork>:
+{
+  801a70:	55                   	push   %ebp
+  801a71:	89 e5                	mov    %esp,%ebp
+  801a73:	57                   	push   %edi
+  801a74:	56                   	push   %esi
+  801a75:	53                   	push   %ebx
+  801a76:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801a7c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a81:	cd 30                	int    $0x30
+  801a83:	89 c6                	mov    %eax,%esi
+  801a85:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 56                	js     801ae5 <ufork+0x75>
+	if (pid > 0) {
+  801a8f:	0f 8e b3 02 00 00    	jle    801d48 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801a95:	83 ec 0c             	sub    $0xc,%esp
+  801a98:	68 92 19 80 00       	push   $0x801992
+  801a9d:	e8 d8 18 00 00       	call   80337a <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801aa2:	83 c4 08             	add    $0x8,%esp
+  801aa5:	68 e1 33 80 00       	push   $0x8033e1
+  801aaa:	56                   	push   %esi
+  801aab:	e8 ef f5 ff ff       	call   80109f <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801ab0:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801ab6:	89 1c 24             	mov    %ebx,(%esp)
+  801ab9:	e8 a1 04 00 00       	call   801f5f <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801abe:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801ac5:	6a 07                	push   $0x7
+  801ac7:	68 00 f0 bf ee       	push   $0xeebff000
+  801acc:	56                   	push   %esi
+  801acd:	53                   	push   %ebx
+  801ace:	e8 0d 06 00 00       	call   8020e0 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801ad3:	83 c4 20             	add    $0x20,%esp
+  801ad6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801adb:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801ae1:	89 fe                	mov    %edi,%esi
+  801ae3:	eb 22                	jmp    801b07 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801ae5:	50                   	push   %eax
+  801ae6:	68 49 39 80 00       	push   $0x803949
+  801aeb:	68 a9 00 00 00       	push   $0xa9
+  801af0:	68 25 39 80 00       	push   $0x803925
+  801af5:	e8 6e e7 ff ff       	call   800268 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801afa:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b00:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b05:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b07:	89 f7                	mov    %esi,%edi
+  801b09:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801b0f:	0f 87 e9 01 00 00    	ja     801cfe <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801b15:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801b1b:	85 f6                	test   %esi,%esi
+  801b1d:	0f 49 d6             	cmovns %esi,%edx
+  801b20:	c1 fa 0a             	sar    $0xa,%edx
+  801b23:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801b2a:	f6 c1 01             	test   $0x1,%cl
+  801b2d:	74 cb                	je     801afa <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801b2f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b36:	f6 c2 80             	test   $0x80,%dl
+  801b39:	75 17                	jne    801b52 <ufork+0xe2>
+			j = i + 1;
+  801b3b:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801b3e:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801b45:	f6 c2 01             	test   $0x1,%dl
+  801b48:	0f 85 f3 00 00 00    	jne    801c41 <ufork+0x1d1>
+			j = i + 1;
+  801b4e:	89 de                	mov    %ebx,%esi
+  801b50:	eb b5                	jmp    801b07 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801b52:	89 fb                	mov    %edi,%ebx
+  801b54:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801b57:	89 d8                	mov    %ebx,%eax
+  801b59:	c1 e8 16             	shr    $0x16,%eax
+  801b5c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b63:	89 c2                	mov    %eax,%edx
+  801b65:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801b6b:	25 02 04 00 00       	and    $0x402,%eax
+  801b70:	83 f8 02             	cmp    $0x2,%eax
+  801b73:	74 31                	je     801ba6 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801b75:	83 ec 04             	sub    $0x4,%esp
+  801b78:	6a 01                	push   $0x1
+  801b7a:	52                   	push   %edx
+  801b7b:	53                   	push   %ebx
+  801b7c:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b82:	53                   	push   %ebx
+  801b83:	6a 00                	push   $0x0
+  801b85:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801b8b:	50                   	push   %eax
+  801b8c:	e8 7a 05 00 00       	call   80210b <batch_map>
+		return;
+  801b91:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b94:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b9a:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b9f:	89 c6                	mov    %eax,%esi
+				continue;
+  801ba1:	e9 61 ff ff ff       	jmp    801b07 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801ba6:	83 ec 04             	sub    $0x4,%esp
+  801ba9:	80 ca 80             	or     $0x80,%dl
+  801bac:	52                   	push   %edx
+  801bad:	53                   	push   %ebx
+  801bae:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bb4:	e8 ca f2 ff ff       	call   800e83 <sys_page_alloc>
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 5d                	js     801c1d <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801bc0:	83 ec 0c             	sub    $0xc,%esp
+  801bc3:	6a 07                	push   $0x7
+  801bc5:	68 00 00 40 00       	push   $0x400000
+  801bca:	6a 00                	push   $0x0
+  801bcc:	53                   	push   %ebx
+  801bcd:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bd3:	e8 18 f3 ff ff       	call   800ef0 <sys_page_map>
+  801bd8:	83 c4 20             	add    $0x20,%esp
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	78 50                	js     801c2f <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801bdf:	83 ec 04             	sub    $0x4,%esp
+  801be2:	68 00 00 40 00       	push   $0x400000
+  801be7:	53                   	push   %ebx
+  801be8:	68 00 00 40 00       	push   $0x400000
+  801bed:	e8 1f ef ff ff       	call   800b11 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801bf2:	83 c4 08             	add    $0x8,%esp
+  801bf5:	68 00 00 40 00       	push   $0x400000
+  801bfa:	6a 00                	push   $0x0
+  801bfc:	e8 5d f3 ff ff       	call   800f5e <sys_page_unmap>
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	79 8c                	jns    801b94 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801c08:	50                   	push   %eax
+  801c09:	68 7d 39 80 00       	push   $0x80397d
+  801c0e:	68 81 00 00 00       	push   $0x81
+  801c13:	68 25 39 80 00       	push   $0x803925
+  801c18:	e8 4b e6 ff ff       	call   800268 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801c1d:	50                   	push   %eax
+  801c1e:	68 59 39 80 00       	push   $0x803959
+  801c23:	6a 7c                	push   $0x7c
+  801c25:	68 25 39 80 00       	push   $0x803925
+  801c2a:	e8 39 e6 ff ff       	call   800268 <_panic>
+		panic("sys_page_map: %e", r);
+  801c2f:	50                   	push   %eax
+  801c30:	68 6c 39 80 00       	push   $0x80396c
+  801c35:	6a 7e                	push   $0x7e
+  801c37:	68 25 39 80 00       	push   $0x803925
+  801c3c:	e8 27 e6 ff ff       	call   800268 <_panic>
+  801c41:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801c47:	eb 22                	jmp    801c6b <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801c49:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c50:	a8 01                	test   $0x1,%al
+  801c52:	74 35                	je     801c89 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801c54:	89 d8                	mov    %ebx,%eax
+  801c56:	e8 9e fc ff ff       	call   8018f9 <dupperm>
+  801c5b:	89 c6                	mov    %eax,%esi
+  801c5d:	89 f8                	mov    %edi,%eax
+  801c5f:	e8 95 fc ff ff       	call   8018f9 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c64:	39 c6                	cmp    %eax,%esi
+  801c66:	75 21                	jne    801c89 <ufork+0x219>
+				j++;
+  801c68:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c6b:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801c71:	74 16                	je     801c89 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801c73:	89 d8                	mov    %ebx,%eax
+  801c75:	c1 e8 0a             	shr    $0xa,%eax
+  801c78:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c7f:	25 81 00 00 00       	and    $0x81,%eax
+  801c84:	83 f8 01             	cmp    $0x1,%eax
+  801c87:	74 c0                	je     801c49 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801c89:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801c8f:	89 d8                	mov    %ebx,%eax
+  801c91:	29 f0                	sub    %esi,%eax
+  801c93:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801c99:	89 fe                	mov    %edi,%esi
+  801c9b:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801c9e:	89 f8                	mov    %edi,%eax
+  801ca0:	e8 54 fc ff ff       	call   8018f9 <dupperm>
+  801ca5:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801ca7:	83 ec 08             	sub    $0x8,%esp
+  801caa:	6a 02                	push   $0x2
+  801cac:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801cb2:	51                   	push   %ecx
+  801cb3:	e8 15 03 00 00       	call   801fcd <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801cb8:	83 c4 0c             	add    $0xc,%esp
+  801cbb:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801cc1:	57                   	push   %edi
+  801cc2:	56                   	push   %esi
+  801cc3:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801cc9:	56                   	push   %esi
+  801cca:	6a 00                	push   $0x0
+  801ccc:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801cd2:	51                   	push   %ecx
+  801cd3:	e8 33 04 00 00       	call   80210b <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801cd8:	83 c4 1c             	add    $0x1c,%esp
+  801cdb:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801ce1:	57                   	push   %edi
+  801ce2:	56                   	push   %esi
+  801ce3:	6a 00                	push   $0x0
+  801ce5:	56                   	push   %esi
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801cee:	50                   	push   %eax
+  801cef:	e8 17 04 00 00       	call   80210b <batch_map>
+	return 0;
+  801cf4:	83 c4 20             	add    $0x20,%esp
+  801cf7:	89 de                	mov    %ebx,%esi
+  801cf9:	e9 09 fe ff ff       	jmp    801b07 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801cfe:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801d04:	83 ec 04             	sub    $0x4,%esp
+  801d07:	6a 02                	push   $0x2
+  801d09:	56                   	push   %esi
+  801d0a:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d10:	53                   	push   %ebx
+  801d11:	e8 49 04 00 00       	call   80215f <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801d16:	89 1c 24             	mov    %ebx,(%esp)
+  801d19:	e8 5d 02 00 00       	call   801f7b <batch_flush>
+  801d1e:	83 c4 10             	add    $0x10,%esp
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	78 0e                	js     801d33 <ufork+0x2c3>
+}
+  801d25:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801d2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2e:	5b                   	pop    %ebx
+  801d2f:	5e                   	pop    %esi
+  801d30:	5f                   	pop    %edi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+			panic("fork: %e", r);
+  801d33:	50                   	push   %eax
+  801d34:	68 50 39 80 00       	push   $0x803950
+  801d39:	68 d7 00 00 00       	push   $0xd7
+  801d3e:	68 25 39 80 00       	push   $0x803925
+  801d43:	e8 20 e5 ff ff       	call   800268 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d48:	e8 aa f0 ff ff       	call   800df7 <sys_getenvid>
+  801d4d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d52:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d58:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d5d:	a3 0c 50 80 00       	mov    %eax,0x80500c
+		return 0;
+  801d62:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801d69:	00 00 00 
+  801d6c:	eb b7                	jmp    801d25 <ufork+0x2b5>
+
+00801d6e <fork>:
+{
+  801d6e:	55                   	push   %ebp
+  801d6f:	89 e5                	mov    %esp,%ebp
+  801d71:	53                   	push   %ebx
+  801d72:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801d75:	68 92 19 80 00       	push   $0x801992
+  801d7a:	e8 fb 15 00 00       	call   80337a <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801d7f:	e8 7a f6 ff ff       	call   8013fe <sys_fork>
+  801d84:	89 c3                	mov    %eax,%ebx
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	85 c0                	test   %eax,%eax
+  801d8b:	78 09                	js     801d96 <fork+0x28>
+	if (pid == 0)
+  801d8d:	74 1c                	je     801dab <fork+0x3d>
+}
+  801d8f:	89 d8                	mov    %ebx,%eax
+  801d91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d94:	c9                   	leave
+  801d95:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801d96:	50                   	push   %eax
+  801d97:	68 49 39 80 00       	push   $0x803949
+  801d9c:	68 ed 00 00 00       	push   $0xed
+  801da1:	68 25 39 80 00       	push   $0x803925
+  801da6:	e8 bd e4 ff ff       	call   800268 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801dab:	e8 47 f0 ff ff       	call   800df7 <sys_getenvid>
+  801db0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801db5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dbb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801dc0:	a3 0c 50 80 00       	mov    %eax,0x80500c
+	return pid;
+  801dc5:	eb c8                	jmp    801d8f <fork+0x21>
+
+00801dc7 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801dc7:	55                   	push   %ebp
+  801dc8:	89 e5                	mov    %esp,%ebp
+  801dca:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801dcd:	ff 75 0c             	push   0xc(%ebp)
+  801dd0:	ff 75 08             	push   0x8(%ebp)
+  801dd3:	68 53 1a 80 00       	push   $0x801a53
+  801dd8:	e8 67 f6 ff ff       	call   801444 <sys_thread_create>
+}
+  801ddd:	c9                   	leave
+  801dde:	c3                   	ret
+
+00801ddf <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801ddf:	55                   	push   %ebp
+  801de0:	89 e5                	mov    %esp,%ebp
+  801de2:	56                   	push   %esi
+  801de3:	53                   	push   %ebx
+  801de4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801de7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801ded:	85 c0                	test   %eax,%eax
+  801def:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801df4:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801df7:	83 ec 08             	sub    $0x8,%esp
+  801dfa:	ff 75 14             	push   0x14(%ebp)
+  801dfd:	50                   	push   %eax
+  801dfe:	e8 91 f4 ff ff       	call   801294 <sys_ipc_recv_until>
+  801e03:	83 c4 10             	add    $0x10,%esp
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 61                	js     801e6b <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801e0a:	85 f6                	test   %esi,%esi
+  801e0c:	74 1c                	je     801e2a <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801e0e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e10:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e15:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e1b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e20:	76 5f                	jbe    801e81 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801e22:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801e28:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801e2a:	85 db                	test   %ebx,%ebx
+  801e2c:	74 1c                	je     801e4a <ipc_recv_until+0x6b>
+  801e2e:	89 e0                	mov    %esp,%eax
+  801e30:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e35:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e3b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e40:	76 50                	jbe    801e92 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801e42:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801e48:	89 03                	mov    %eax,(%ebx)
+  801e4a:	89 e0                	mov    %esp,%eax
+  801e4c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e51:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e57:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e5c:	76 45                	jbe    801ea3 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801e5e:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801e64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e67:	5b                   	pop    %ebx
+  801e68:	5e                   	pop    %esi
+  801e69:	5d                   	pop    %ebp
+  801e6a:	c3                   	ret
+		if (from_env_store)
+  801e6b:	85 f6                	test   %esi,%esi
+  801e6d:	74 06                	je     801e75 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801e6f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801e75:	85 db                	test   %ebx,%ebx
+  801e77:	74 eb                	je     801e64 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801e79:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801e7f:	eb e3                	jmp    801e64 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e81:	c1 e8 10             	shr    $0x10,%eax
+  801e84:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e8a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e90:	eb 90                	jmp    801e22 <ipc_recv_until+0x43>
+  801e92:	c1 e8 10             	shr    $0x10,%eax
+  801e95:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e9b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ea1:	eb 9f                	jmp    801e42 <ipc_recv_until+0x63>
+  801ea3:	c1 e8 10             	shr    $0x10,%eax
+  801ea6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801eac:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801eb2:	eb aa                	jmp    801e5e <ipc_recv_until+0x7f>
+
+00801eb4 <ipc_recv>:
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801eba:	6a 00                	push   $0x0
+  801ebc:	ff 75 10             	push   0x10(%ebp)
+  801ebf:	ff 75 0c             	push   0xc(%ebp)
+  801ec2:	ff 75 08             	push   0x8(%ebp)
+  801ec5:	e8 15 ff ff ff       	call   801ddf <ipc_recv_until>
+}
+  801eca:	c9                   	leave
+  801ecb:	c3                   	ret
+
+00801ecc <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801ecc:	55                   	push   %ebp
+  801ecd:	89 e5                	mov    %esp,%ebp
+  801ecf:	57                   	push   %edi
+  801ed0:	56                   	push   %esi
+  801ed1:	53                   	push   %ebx
+  801ed2:	83 ec 0c             	sub    $0xc,%esp
+  801ed5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ed8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801edb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801ede:	85 db                	test   %ebx,%ebx
+  801ee0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801ee5:	0f 44 d8             	cmove  %eax,%ebx
+  801ee8:	eb 05                	jmp    801eef <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801eea:	e8 4e ef ff ff       	call   800e3d <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801eef:	ff 75 14             	push   0x14(%ebp)
+  801ef2:	53                   	push   %ebx
+  801ef3:	56                   	push   %esi
+  801ef4:	57                   	push   %edi
+  801ef5:	e8 e6 f2 ff ff       	call   8011e0 <sys_ipc_try_send>
+  801efa:	83 c4 10             	add    $0x10,%esp
+  801efd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f00:	74 e8                	je     801eea <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801f02:	85 c0                	test   %eax,%eax
+  801f04:	78 08                	js     801f0e <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f09:	5b                   	pop    %ebx
+  801f0a:	5e                   	pop    %esi
+  801f0b:	5f                   	pop    %edi
+  801f0c:	5d                   	pop    %ebp
+  801f0d:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801f0e:	50                   	push   %eax
+  801f0f:	68 90 39 80 00       	push   $0x803990
+  801f14:	6a 4f                	push   $0x4f
+  801f16:	68 a3 39 80 00       	push   $0x8039a3
+  801f1b:	e8 48 e3 ff ff       	call   800268 <_panic>
+
+00801f20 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801f20:	55                   	push   %ebp
+  801f21:	89 e5                	mov    %esp,%ebp
+  801f23:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801f26:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801f2b:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801f31:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801f37:	8b 52 50             	mov    0x50(%edx),%edx
+  801f3a:	39 ca                	cmp    %ecx,%edx
+  801f3c:	74 11                	je     801f4f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801f3e:	83 c0 01             	add    $0x1,%eax
+  801f41:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801f46:	75 e3                	jne    801f2b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4d:	eb 0e                	jmp    801f5d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801f4f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f55:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801f5a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801f5d:	5d                   	pop    %ebp
+  801f5e:	c3                   	ret
+
+00801f5f <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801f5f:	55                   	push   %ebp
+  801f60:	89 e5                	mov    %esp,%ebp
+  801f62:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801f65:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801f6c:	00 00 00 
+	b->b_error = 0;
+  801f6f:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801f76:	00 00 00 
+}
+  801f79:	5d                   	pop    %ebp
+  801f7a:	c3                   	ret
+
+00801f7b <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	53                   	push   %ebx
+  801f7f:	83 ec 04             	sub    $0x4,%esp
+  801f82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801f85:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801f8b:	85 c0                	test   %eax,%eax
+  801f8d:	7e 09                	jle    801f98 <batch_flush+0x1d>
+  801f8f:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801f96:	74 15                	je     801fad <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801f98:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801f9f:	00 00 00 
+	return b->b_error;
+  801fa2:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801fa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fab:	c9                   	leave
+  801fac:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801fad:	83 ec 08             	sub    $0x8,%esp
+  801fb0:	50                   	push   %eax
+  801fb1:	53                   	push   %ebx
+  801fb2:	e8 b2 f5 ff ff       	call   801569 <sys_batch>
+  801fb7:	83 c4 10             	add    $0x10,%esp
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	79 da                	jns    801f98 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801fbe:	f7 d8                	neg    %eax
+  801fc0:	0f b6 c0             	movzbl %al,%eax
+  801fc3:	f7 d8                	neg    %eax
+  801fc5:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801fcb:	eb cb                	jmp    801f98 <batch_flush+0x1d>
+
+00801fcd <batch_reserve>:
+{
+  801fcd:	55                   	push   %ebp
+  801fce:	89 e5                	mov    %esp,%ebp
+  801fd0:	83 ec 08             	sub    $0x8,%esp
+  801fd3:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801fd6:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801fdc:	03 45 0c             	add    0xc(%ebp),%eax
+  801fdf:	83 f8 10             	cmp    $0x10,%eax
+  801fe2:	7f 02                	jg     801fe6 <batch_reserve+0x19>
+}
+  801fe4:	c9                   	leave
+  801fe5:	c3                   	ret
+		batch_flush(b);
+  801fe6:	83 ec 0c             	sub    $0xc,%esp
+  801fe9:	52                   	push   %edx
+  801fea:	e8 8c ff ff ff       	call   801f7b <batch_flush>
+  801fef:	83 c4 10             	add    $0x10,%esp
+}
+  801ff2:	eb f0                	jmp    801fe4 <batch_reserve+0x17>
+
+00801ff4 <batch_next>:
+{
+  801ff4:	55                   	push   %ebp
+  801ff5:	89 e5                	mov    %esp,%ebp
+  801ff7:	53                   	push   %ebx
+  801ff8:	83 ec 04             	sub    $0x4,%esp
+  801ffb:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801ffd:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  802004:	74 28                	je     80202e <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  802006:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  80200c:	8d 50 01             	lea    0x1(%eax),%edx
+  80200f:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  802015:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802018:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  80201a:	83 ec 04             	sub    $0x4,%esp
+  80201d:	6a 1c                	push   $0x1c
+  80201f:	6a 00                	push   $0x0
+  802021:	53                   	push   %ebx
+  802022:	e8 b5 ea ff ff       	call   800adc <memset>
+}
+  802027:	89 d8                	mov    %ebx,%eax
+  802029:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80202c:	c9                   	leave
+  80202d:	c3                   	ret
+		batch_flush(b);
+  80202e:	83 ec 0c             	sub    $0xc,%esp
+  802031:	50                   	push   %eax
+  802032:	e8 44 ff ff ff       	call   801f7b <batch_flush>
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	eb ca                	jmp    802006 <batch_next+0x12>
+
+0080203c <batch_page>:
+{
+  80203c:	55                   	push   %ebp
+  80203d:	89 e5                	mov    %esp,%ebp
+  80203f:	57                   	push   %edi
+  802040:	56                   	push   %esi
+  802041:	53                   	push   %ebx
+  802042:	83 ec 1c             	sub    $0x1c,%esp
+  802045:	89 d3                	mov    %edx,%ebx
+  802047:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  802049:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  80204f:	85 d2                	test   %edx,%edx
+  802051:	74 50                	je     8020a3 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  802053:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  802056:	01 c1                	add    %eax,%ecx
+  802058:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  80205b:	75 46                	jne    8020a3 <batch_page+0x67>
+  80205d:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  802060:	75 41                	jne    8020a3 <batch_page+0x67>
+  802062:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  802065:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  802068:	75 39                	jne    8020a3 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  80206a:	83 ea 01             	sub    $0x1,%edx
+  80206d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  802070:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  802073:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  802077:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  80207a:	75 27                	jne    8020a3 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  80207c:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  80207f:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  802083:	89 fa                	mov    %edi,%edx
+  802085:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802088:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80208b:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  80208e:	39 55 08             	cmp    %edx,0x8(%ebp)
+  802091:	75 10                	jne    8020a3 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802093:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  802097:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80209a:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  80209e:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8020a1:	74 2a                	je     8020cd <batch_page+0x91>
+	op = batch_next(b);
+  8020a3:	e8 4c ff ff ff       	call   801ff4 <batch_next>
+	op->bo_op = opcode;
+  8020a8:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  8020aa:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  8020ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020b0:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  8020b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020b6:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  8020b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020bc:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  8020bf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8020c2:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  8020c5:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8020c8:	89 78 14             	mov    %edi,0x14(%eax)
+  8020cb:	eb 0b                	jmp    8020d8 <batch_page+0x9c>
+		op->bo_npages += npages;
+  8020cd:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  8020d1:	03 7d 18             	add    0x18(%ebp),%edi
+  8020d4:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  8020d8:	83 c4 1c             	add    $0x1c,%esp
+  8020db:	5b                   	pop    %ebx
+  8020dc:	5e                   	pop    %esi
+  8020dd:	5f                   	pop    %edi
+  8020de:	5d                   	pop    %ebp
+  8020df:	c3                   	ret
+
+008020e0 <batch_alloc>:
+{
+  8020e0:	55                   	push   %ebp
+  8020e1:	89 e5                	mov    %esp,%ebp
+  8020e3:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  8020e6:	ff 75 18             	push   0x18(%ebp)
+  8020e9:	ff 75 14             	push   0x14(%ebp)
+  8020ec:	ff 75 10             	push   0x10(%ebp)
+  8020ef:	ff 75 0c             	push   0xc(%ebp)
+  8020f2:	6a 00                	push   $0x0
+  8020f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802101:	e8 36 ff ff ff       	call   80203c <batch_page>
+}
+  802106:	83 c4 20             	add    $0x20,%esp
+  802109:	c9                   	leave
+  80210a:	c3                   	ret
+
+0080210b <batch_map>:
+{
+  80210b:	55                   	push   %ebp
+  80210c:	89 e5                	mov    %esp,%ebp
+  80210e:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802111:	ff 75 20             	push   0x20(%ebp)
+  802114:	ff 75 1c             	push   0x1c(%ebp)
+  802117:	ff 75 18             	push   0x18(%ebp)
+  80211a:	ff 75 14             	push   0x14(%ebp)
+  80211d:	ff 75 10             	push   0x10(%ebp)
+  802120:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802123:	ba 01 00 00 00       	mov    $0x1,%edx
+  802128:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212b:	e8 0c ff ff ff       	call   80203c <batch_page>
+}
+  802130:	83 c4 20             	add    $0x20,%esp
+  802133:	c9                   	leave
+  802134:	c3                   	ret
+
+00802135 <batch_unmap>:
+{
+  802135:	55                   	push   %ebp
+  802136:	89 e5                	mov    %esp,%ebp
+  802138:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  80213b:	ff 75 14             	push   0x14(%ebp)
+  80213e:	6a 00                	push   $0x0
+  802140:	ff 75 10             	push   0x10(%ebp)
+  802143:	ff 75 0c             	push   0xc(%ebp)
+  802146:	6a 00                	push   $0x0
+  802148:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80214d:	ba 02 00 00 00       	mov    $0x2,%edx
+  802152:	8b 45 08             	mov    0x8(%ebp),%eax
+  802155:	e8 e2 fe ff ff       	call   80203c <batch_page>
+}
+  80215a:	83 c4 20             	add    $0x20,%esp
+  80215d:	c9                   	leave
+  80215e:	c3                   	ret
+
+0080215f <batch_set_status>:
+{
+  80215f:	55                   	push   %ebp
+  802160:	89 e5                	mov    %esp,%ebp
+  802162:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  802165:	8b 45 08             	mov    0x8(%ebp),%eax
+  802168:	e8 87 fe ff ff       	call   801ff4 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  80216d:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  802173:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802176:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  802179:	8b 55 10             	mov    0x10(%ebp),%edx
+  80217c:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  80217f:	c9                   	leave
+  802180:	c3                   	ret
+
+00802181 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802181:	55                   	push   %ebp
+  802182:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802184:	8b 45 08             	mov    0x8(%ebp),%eax
+  802187:	05 00 00 00 30       	add    $0x30000000,%eax
+  80218c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80218f:	5d                   	pop    %ebp
+  802190:	c3                   	ret
+
+00802191 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802191:	55                   	push   %ebp
+  802192:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802194:	8b 45 08             	mov    0x8(%ebp),%eax
+  802197:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80219c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021a1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8021a6:	5d                   	pop    %ebp
+  8021a7:	c3                   	ret
+
+008021a8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8021a8:	55                   	push   %ebp
+  8021a9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8021ab:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8021b0:	eb 02                	jmp    8021b4 <fd_alloc+0xc>
+  8021b2:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8021b4:	89 c2                	mov    %eax,%edx
+  8021b6:	c1 ea 16             	shr    $0x16,%edx
+  8021b9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8021c0:	f6 c2 01             	test   $0x1,%dl
+  8021c3:	74 2b                	je     8021f0 <fd_alloc+0x48>
+  8021c5:	89 c2                	mov    %eax,%edx
+  8021c7:	c1 ea 0c             	shr    $0xc,%edx
+  8021ca:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8021d1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8021d7:	f6 c1 01             	test   $0x1,%cl
+  8021da:	74 14                	je     8021f0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8021dc:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8021e2:	75 ce                	jne    8021b2 <fd_alloc+0xa>
+  8021e4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8021e9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8021ee:	eb 05                	jmp    8021f5 <fd_alloc+0x4d>
+			return 0;
+  8021f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8021f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021f8:	89 02                	mov    %eax,(%edx)
+}
+  8021fa:	89 c8                	mov    %ecx,%eax
+  8021fc:	5d                   	pop    %ebp
+  8021fd:	c3                   	ret
+
+008021fe <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8021fe:	55                   	push   %ebp
+  8021ff:	89 e5                	mov    %esp,%ebp
+  802201:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802204:	83 f8 1f             	cmp    $0x1f,%eax
+  802207:	77 30                	ja     802239 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802209:	c1 e0 0c             	shl    $0xc,%eax
+  80220c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802211:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802217:	f6 c2 01             	test   $0x1,%dl
+  80221a:	74 24                	je     802240 <fd_lookup+0x42>
+  80221c:	89 c2                	mov    %eax,%edx
+  80221e:	c1 ea 0c             	shr    $0xc,%edx
+  802221:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802228:	f6 c2 01             	test   $0x1,%dl
+  80222b:	74 1a                	je     802247 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80222d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802230:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802232:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802237:	5d                   	pop    %ebp
+  802238:	c3                   	ret
+		return -E_INVAL;
+  802239:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80223e:	eb f7                	jmp    802237 <fd_lookup+0x39>
+		return -E_INVAL;
+  802240:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802245:	eb f0                	jmp    802237 <fd_lookup+0x39>
+  802247:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80224c:	eb e9                	jmp    802237 <fd_lookup+0x39>
+
+0080224e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	53                   	push   %ebx
+  802252:	83 ec 04             	sub    $0x4,%esp
+  802255:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225d:	eb 03                	jmp    802262 <dev_lookup+0x14>
+  80225f:	83 c0 01             	add    $0x1,%eax
+  802262:	8b 1c 85 2c 3a 80 00 	mov    0x803a2c(,%eax,4),%ebx
+  802269:	85 db                	test   %ebx,%ebx
+  80226b:	74 0b                	je     802278 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80226d:	39 13                	cmp    %edx,(%ebx)
+  80226f:	75 ee                	jne    80225f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802271:	b8 00 00 00 00       	mov    $0x0,%eax
+  802276:	eb 2e                	jmp    8022a6 <dev_lookup+0x58>
+  802278:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80227a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80227f:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802285:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80228a:	76 24                	jbe    8022b0 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80228c:	8b 41 48             	mov    0x48(%ecx),%eax
+  80228f:	83 ec 04             	sub    $0x4,%esp
+  802292:	52                   	push   %edx
+  802293:	50                   	push   %eax
+  802294:	68 b0 39 80 00       	push   $0x8039b0
+  802299:	e8 a5 e0 ff ff       	call   800343 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80229e:	83 c4 10             	add    $0x10,%esp
+  8022a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8022a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022a9:	89 1a                	mov    %ebx,(%edx)
+}
+  8022ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ae:	c9                   	leave
+  8022af:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8022b0:	c1 e8 10             	shr    $0x10,%eax
+  8022b3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8022b9:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8022bf:	eb cb                	jmp    80228c <dev_lookup+0x3e>
+
+008022c1 <fd_close>:
+{
+  8022c1:	55                   	push   %ebp
+  8022c2:	89 e5                	mov    %esp,%ebp
+  8022c4:	57                   	push   %edi
+  8022c5:	56                   	push   %esi
+  8022c6:	53                   	push   %ebx
+  8022c7:	83 ec 24             	sub    $0x24,%esp
+  8022ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022cd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8022d0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022d3:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8022d4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8022da:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8022dd:	50                   	push   %eax
+  8022de:	e8 1b ff ff ff       	call   8021fe <fd_lookup>
+  8022e3:	89 c3                	mov    %eax,%ebx
+  8022e5:	83 c4 10             	add    $0x10,%esp
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	78 05                	js     8022f1 <fd_close+0x30>
+	    || fd != fd2)
+  8022ec:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8022ef:	74 16                	je     802307 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8022f1:	89 f8                	mov    %edi,%eax
+  8022f3:	84 c0                	test   %al,%al
+  8022f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022fa:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8022fd:	89 d8                	mov    %ebx,%eax
+  8022ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802302:	5b                   	pop    %ebx
+  802303:	5e                   	pop    %esi
+  802304:	5f                   	pop    %edi
+  802305:	5d                   	pop    %ebp
+  802306:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802307:	83 ec 08             	sub    $0x8,%esp
+  80230a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80230d:	50                   	push   %eax
+  80230e:	ff 36                	push   (%esi)
+  802310:	e8 39 ff ff ff       	call   80224e <dev_lookup>
+  802315:	89 c3                	mov    %eax,%ebx
+  802317:	83 c4 10             	add    $0x10,%esp
+  80231a:	85 c0                	test   %eax,%eax
+  80231c:	78 1a                	js     802338 <fd_close+0x77>
+		if (dev->dev_close)
+  80231e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802321:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802324:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802329:	85 c0                	test   %eax,%eax
+  80232b:	74 0b                	je     802338 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80232d:	83 ec 0c             	sub    $0xc,%esp
+  802330:	56                   	push   %esi
+  802331:	ff d0                	call   *%eax
+  802333:	89 c3                	mov    %eax,%ebx
+  802335:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802338:	83 ec 08             	sub    $0x8,%esp
+  80233b:	56                   	push   %esi
+  80233c:	6a 00                	push   $0x0
+  80233e:	e8 1b ec ff ff       	call   800f5e <sys_page_unmap>
+	return r;
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	eb b5                	jmp    8022fd <fd_close+0x3c>
+
+00802348 <close>:
+
+int
+close(int fdnum)
+{
+  802348:	55                   	push   %ebp
+  802349:	89 e5                	mov    %esp,%ebp
+  80234b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80234e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802351:	50                   	push   %eax
+  802352:	ff 75 08             	push   0x8(%ebp)
+  802355:	e8 a4 fe ff ff       	call   8021fe <fd_lookup>
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	79 02                	jns    802363 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802361:	c9                   	leave
+  802362:	c3                   	ret
+		return fd_close(fd, 1);
+  802363:	83 ec 08             	sub    $0x8,%esp
+  802366:	6a 01                	push   $0x1
+  802368:	ff 75 f4             	push   -0xc(%ebp)
+  80236b:	e8 51 ff ff ff       	call   8022c1 <fd_close>
+  802370:	83 c4 10             	add    $0x10,%esp
+  802373:	eb ec                	jmp    802361 <close+0x19>
+
+00802375 <close_all>:
+
+void
+close_all(void)
+{
+  802375:	55                   	push   %ebp
+  802376:	89 e5                	mov    %esp,%ebp
+  802378:	53                   	push   %ebx
+  802379:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80237c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802381:	83 ec 0c             	sub    $0xc,%esp
+  802384:	53                   	push   %ebx
+  802385:	e8 be ff ff ff       	call   802348 <close>
+	for (i = 0; i < MAXFD; i++)
+  80238a:	83 c3 01             	add    $0x1,%ebx
+  80238d:	83 c4 10             	add    $0x10,%esp
+  802390:	83 fb 20             	cmp    $0x20,%ebx
+  802393:	75 ec                	jne    802381 <close_all+0xc>
+}
+  802395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802398:	c9                   	leave
+  802399:	c3                   	ret
+
+0080239a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80239a:	55                   	push   %ebp
+  80239b:	89 e5                	mov    %esp,%ebp
+  80239d:	57                   	push   %edi
+  80239e:	56                   	push   %esi
+  80239f:	53                   	push   %ebx
+  8023a0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8023a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023a6:	50                   	push   %eax
+  8023a7:	ff 75 08             	push   0x8(%ebp)
+  8023aa:	e8 4f fe ff ff       	call   8021fe <fd_lookup>
+  8023af:	89 c3                	mov    %eax,%ebx
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	78 7f                	js     802437 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8023b8:	83 ec 0c             	sub    $0xc,%esp
+  8023bb:	ff 75 0c             	push   0xc(%ebp)
+  8023be:	e8 85 ff ff ff       	call   802348 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8023c3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023c6:	c1 e6 0c             	shl    $0xc,%esi
+  8023c9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8023cf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8023d2:	89 3c 24             	mov    %edi,(%esp)
+  8023d5:	e8 b7 fd ff ff       	call   802191 <fd2data>
+  8023da:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8023dc:	89 34 24             	mov    %esi,(%esp)
+  8023df:	e8 ad fd ff ff       	call   802191 <fd2data>
+  8023e4:	83 c4 10             	add    $0x10,%esp
+  8023e7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8023ea:	89 d8                	mov    %ebx,%eax
+  8023ec:	c1 e8 16             	shr    $0x16,%eax
+  8023ef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8023f6:	a8 01                	test   $0x1,%al
+  8023f8:	74 11                	je     80240b <dup+0x71>
+  8023fa:	89 d8                	mov    %ebx,%eax
+  8023fc:	c1 e8 0c             	shr    $0xc,%eax
+  8023ff:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802406:	f6 c2 01             	test   $0x1,%dl
+  802409:	75 36                	jne    802441 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80240b:	89 f8                	mov    %edi,%eax
+  80240d:	c1 e8 0c             	shr    $0xc,%eax
+  802410:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802417:	83 ec 0c             	sub    $0xc,%esp
+  80241a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80241f:	50                   	push   %eax
+  802420:	56                   	push   %esi
+  802421:	6a 00                	push   $0x0
+  802423:	57                   	push   %edi
+  802424:	6a 00                	push   $0x0
+  802426:	e8 c5 ea ff ff       	call   800ef0 <sys_page_map>
+  80242b:	89 c3                	mov    %eax,%ebx
+  80242d:	83 c4 20             	add    $0x20,%esp
+  802430:	85 c0                	test   %eax,%eax
+  802432:	78 33                	js     802467 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802434:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802437:	89 d8                	mov    %ebx,%eax
+  802439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80243c:	5b                   	pop    %ebx
+  80243d:	5e                   	pop    %esi
+  80243e:	5f                   	pop    %edi
+  80243f:	5d                   	pop    %ebp
+  802440:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802441:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802448:	83 ec 0c             	sub    $0xc,%esp
+  80244b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802450:	50                   	push   %eax
+  802451:	ff 75 d4             	push   -0x2c(%ebp)
+  802454:	6a 00                	push   $0x0
+  802456:	53                   	push   %ebx
+  802457:	6a 00                	push   $0x0
+  802459:	e8 92 ea ff ff       	call   800ef0 <sys_page_map>
+  80245e:	89 c3                	mov    %eax,%ebx
+  802460:	83 c4 20             	add    $0x20,%esp
+  802463:	85 c0                	test   %eax,%eax
+  802465:	79 a4                	jns    80240b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802467:	83 ec 08             	sub    $0x8,%esp
+  80246a:	56                   	push   %esi
+  80246b:	6a 00                	push   $0x0
+  80246d:	e8 ec ea ff ff       	call   800f5e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802472:	83 c4 08             	add    $0x8,%esp
+  802475:	ff 75 d4             	push   -0x2c(%ebp)
+  802478:	6a 00                	push   $0x0
+  80247a:	e8 df ea ff ff       	call   800f5e <sys_page_unmap>
+	return r;
+  80247f:	83 c4 10             	add    $0x10,%esp
+  802482:	eb b3                	jmp    802437 <dup+0x9d>
+
+00802484 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	56                   	push   %esi
+  802488:	53                   	push   %ebx
+  802489:	83 ec 18             	sub    $0x18,%esp
+  80248c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80248f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802492:	50                   	push   %eax
+  802493:	53                   	push   %ebx
+  802494:	e8 65 fd ff ff       	call   8021fe <fd_lookup>
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	78 3c                	js     8024dc <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024a0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024a3:	83 ec 08             	sub    $0x8,%esp
+  8024a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024a9:	50                   	push   %eax
+  8024aa:	ff 36                	push   (%esi)
+  8024ac:	e8 9d fd ff ff       	call   80224e <dev_lookup>
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	78 24                	js     8024dc <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8024b8:	8b 46 08             	mov    0x8(%esi),%eax
+  8024bb:	83 e0 03             	and    $0x3,%eax
+  8024be:	83 f8 01             	cmp    $0x1,%eax
+  8024c1:	74 20                	je     8024e3 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8024c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024c6:	8b 40 08             	mov    0x8(%eax),%eax
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	74 57                	je     802524 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8024cd:	83 ec 04             	sub    $0x4,%esp
+  8024d0:	ff 75 10             	push   0x10(%ebp)
+  8024d3:	ff 75 0c             	push   0xc(%ebp)
+  8024d6:	56                   	push   %esi
+  8024d7:	ff d0                	call   *%eax
+  8024d9:	83 c4 10             	add    $0x10,%esp
+}
+  8024dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024df:	5b                   	pop    %ebx
+  8024e0:	5e                   	pop    %esi
+  8024e1:	5d                   	pop    %ebp
+  8024e2:	c3                   	ret
+  8024e3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024e5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8024ea:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024f0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8024f5:	76 1c                	jbe    802513 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024f7:	8b 42 48             	mov    0x48(%edx),%eax
+  8024fa:	83 ec 04             	sub    $0x4,%esp
+  8024fd:	53                   	push   %ebx
+  8024fe:	50                   	push   %eax
+  8024ff:	68 f1 39 80 00       	push   $0x8039f1
+  802504:	e8 3a de ff ff       	call   800343 <cprintf>
+		return -E_INVAL;
+  802509:	83 c4 10             	add    $0x10,%esp
+  80250c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802511:	eb c9                	jmp    8024dc <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802513:	c1 e8 10             	shr    $0x10,%eax
+  802516:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80251c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802522:	eb d3                	jmp    8024f7 <read+0x73>
+		return -E_NOT_SUPP;
+  802524:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802529:	eb b1                	jmp    8024dc <read+0x58>
+
+0080252b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80252b:	55                   	push   %ebp
+  80252c:	89 e5                	mov    %esp,%ebp
+  80252e:	57                   	push   %edi
+  80252f:	56                   	push   %esi
+  802530:	53                   	push   %ebx
+  802531:	83 ec 0c             	sub    $0xc,%esp
+  802534:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802537:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80253a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80253f:	eb 02                	jmp    802543 <readn+0x18>
+  802541:	01 c3                	add    %eax,%ebx
+  802543:	39 f3                	cmp    %esi,%ebx
+  802545:	73 21                	jae    802568 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802547:	83 ec 04             	sub    $0x4,%esp
+  80254a:	89 f0                	mov    %esi,%eax
+  80254c:	29 d8                	sub    %ebx,%eax
+  80254e:	50                   	push   %eax
+  80254f:	89 d8                	mov    %ebx,%eax
+  802551:	03 45 0c             	add    0xc(%ebp),%eax
+  802554:	50                   	push   %eax
+  802555:	57                   	push   %edi
+  802556:	e8 29 ff ff ff       	call   802484 <read>
+		if (m < 0)
+  80255b:	83 c4 10             	add    $0x10,%esp
+  80255e:	85 c0                	test   %eax,%eax
+  802560:	78 04                	js     802566 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802562:	75 dd                	jne    802541 <readn+0x16>
+  802564:	eb 02                	jmp    802568 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802566:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802568:	89 d8                	mov    %ebx,%eax
+  80256a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80256d:	5b                   	pop    %ebx
+  80256e:	5e                   	pop    %esi
+  80256f:	5f                   	pop    %edi
+  802570:	5d                   	pop    %ebp
+  802571:	c3                   	ret
+
+00802572 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802572:	55                   	push   %ebp
+  802573:	89 e5                	mov    %esp,%ebp
+  802575:	56                   	push   %esi
+  802576:	53                   	push   %ebx
+  802577:	83 ec 18             	sub    $0x18,%esp
+  80257a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80257d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802580:	50                   	push   %eax
+  802581:	53                   	push   %ebx
+  802582:	e8 77 fc ff ff       	call   8021fe <fd_lookup>
+  802587:	83 c4 10             	add    $0x10,%esp
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	78 37                	js     8025c5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80258e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802591:	83 ec 08             	sub    $0x8,%esp
+  802594:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802597:	50                   	push   %eax
+  802598:	ff 36                	push   (%esi)
+  80259a:	e8 af fc ff ff       	call   80224e <dev_lookup>
+  80259f:	83 c4 10             	add    $0x10,%esp
+  8025a2:	85 c0                	test   %eax,%eax
+  8025a4:	78 1f                	js     8025c5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025a6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8025aa:	74 20                	je     8025cc <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8025ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025af:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025b2:	85 c0                	test   %eax,%eax
+  8025b4:	74 57                	je     80260d <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8025b6:	83 ec 04             	sub    $0x4,%esp
+  8025b9:	ff 75 10             	push   0x10(%ebp)
+  8025bc:	ff 75 0c             	push   0xc(%ebp)
+  8025bf:	56                   	push   %esi
+  8025c0:	ff d0                	call   *%eax
+  8025c2:	83 c4 10             	add    $0x10,%esp
+}
+  8025c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c8:	5b                   	pop    %ebx
+  8025c9:	5e                   	pop    %esi
+  8025ca:	5d                   	pop    %ebp
+  8025cb:	c3                   	ret
+  8025cc:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025ce:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025d3:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025d9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025de:	76 1c                	jbe    8025fc <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025e0:	8b 42 48             	mov    0x48(%edx),%eax
+  8025e3:	83 ec 04             	sub    $0x4,%esp
+  8025e6:	53                   	push   %ebx
+  8025e7:	50                   	push   %eax
+  8025e8:	68 0d 3a 80 00       	push   $0x803a0d
+  8025ed:	e8 51 dd ff ff       	call   800343 <cprintf>
+		return -E_INVAL;
+  8025f2:	83 c4 10             	add    $0x10,%esp
+  8025f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025fa:	eb c9                	jmp    8025c5 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025fc:	c1 e8 10             	shr    $0x10,%eax
+  8025ff:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802605:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80260b:	eb d3                	jmp    8025e0 <write+0x6e>
+		return -E_NOT_SUPP;
+  80260d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802612:	eb b1                	jmp    8025c5 <write+0x53>
+
+00802614 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802614:	55                   	push   %ebp
+  802615:	89 e5                	mov    %esp,%ebp
+  802617:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80261a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80261d:	50                   	push   %eax
+  80261e:	ff 75 08             	push   0x8(%ebp)
+  802621:	e8 d8 fb ff ff       	call   8021fe <fd_lookup>
+  802626:	83 c4 10             	add    $0x10,%esp
+  802629:	85 c0                	test   %eax,%eax
+  80262b:	78 0e                	js     80263b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80262d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802630:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802633:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802636:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+
+0080263d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80263d:	55                   	push   %ebp
+  80263e:	89 e5                	mov    %esp,%ebp
+  802640:	56                   	push   %esi
+  802641:	53                   	push   %ebx
+  802642:	83 ec 18             	sub    $0x18,%esp
+  802645:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802648:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80264b:	50                   	push   %eax
+  80264c:	53                   	push   %ebx
+  80264d:	e8 ac fb ff ff       	call   8021fe <fd_lookup>
+  802652:	83 c4 10             	add    $0x10,%esp
+  802655:	85 c0                	test   %eax,%eax
+  802657:	78 34                	js     80268d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802659:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80265c:	83 ec 08             	sub    $0x8,%esp
+  80265f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802662:	50                   	push   %eax
+  802663:	ff 36                	push   (%esi)
+  802665:	e8 e4 fb ff ff       	call   80224e <dev_lookup>
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	85 c0                	test   %eax,%eax
+  80266f:	78 1c                	js     80268d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802671:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802675:	74 1d                	je     802694 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802677:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80267a:	8b 40 18             	mov    0x18(%eax),%eax
+  80267d:	85 c0                	test   %eax,%eax
+  80267f:	74 54                	je     8026d5 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802681:	83 ec 08             	sub    $0x8,%esp
+  802684:	ff 75 0c             	push   0xc(%ebp)
+  802687:	56                   	push   %esi
+  802688:	ff d0                	call   *%eax
+  80268a:	83 c4 10             	add    $0x10,%esp
+}
+  80268d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802690:	5b                   	pop    %ebx
+  802691:	5e                   	pop    %esi
+  802692:	5d                   	pop    %ebp
+  802693:	c3                   	ret
+  802694:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802696:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80269b:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026a1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026a6:	76 1c                	jbe    8026c4 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8026a8:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8026ab:	83 ec 04             	sub    $0x4,%esp
+  8026ae:	53                   	push   %ebx
+  8026af:	50                   	push   %eax
+  8026b0:	68 d0 39 80 00       	push   $0x8039d0
+  8026b5:	e8 89 dc ff ff       	call   800343 <cprintf>
+		return -E_INVAL;
+  8026ba:	83 c4 10             	add    $0x10,%esp
+  8026bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026c2:	eb c9                	jmp    80268d <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8026c4:	c1 e8 10             	shr    $0x10,%eax
+  8026c7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026cd:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8026d3:	eb d3                	jmp    8026a8 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8026d5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026da:	eb b1                	jmp    80268d <ftruncate+0x50>
+
+008026dc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8026dc:	55                   	push   %ebp
+  8026dd:	89 e5                	mov    %esp,%ebp
+  8026df:	56                   	push   %esi
+  8026e0:	53                   	push   %ebx
+  8026e1:	83 ec 18             	sub    $0x18,%esp
+  8026e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8026e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026ea:	50                   	push   %eax
+  8026eb:	ff 75 08             	push   0x8(%ebp)
+  8026ee:	e8 0b fb ff ff       	call   8021fe <fd_lookup>
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	85 c0                	test   %eax,%eax
+  8026f8:	78 49                	js     802743 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026fa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026fd:	83 ec 08             	sub    $0x8,%esp
+  802700:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802703:	50                   	push   %eax
+  802704:	ff 36                	push   (%esi)
+  802706:	e8 43 fb ff ff       	call   80224e <dev_lookup>
+  80270b:	83 c4 10             	add    $0x10,%esp
+  80270e:	85 c0                	test   %eax,%eax
+  802710:	78 31                	js     802743 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802712:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802715:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802719:	74 2f                	je     80274a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80271b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80271e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802725:	00 00 00 
+	stat->st_isdir = 0;
+  802728:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80272f:	00 00 00 
+	stat->st_dev = dev;
+  802732:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802738:	83 ec 08             	sub    $0x8,%esp
+  80273b:	53                   	push   %ebx
+  80273c:	56                   	push   %esi
+  80273d:	ff 50 14             	call   *0x14(%eax)
+  802740:	83 c4 10             	add    $0x10,%esp
+}
+  802743:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802746:	5b                   	pop    %ebx
+  802747:	5e                   	pop    %esi
+  802748:	5d                   	pop    %ebp
+  802749:	c3                   	ret
+		return -E_NOT_SUPP;
+  80274a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80274f:	eb f2                	jmp    802743 <fstat+0x67>
+
+00802751 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802751:	55                   	push   %ebp
+  802752:	89 e5                	mov    %esp,%ebp
+  802754:	56                   	push   %esi
+  802755:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802756:	83 ec 08             	sub    $0x8,%esp
+  802759:	6a 00                	push   $0x0
+  80275b:	ff 75 08             	push   0x8(%ebp)
+  80275e:	e8 e4 01 00 00       	call   802947 <open>
+  802763:	89 c3                	mov    %eax,%ebx
+  802765:	83 c4 10             	add    $0x10,%esp
+  802768:	85 c0                	test   %eax,%eax
+  80276a:	78 1b                	js     802787 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80276c:	83 ec 08             	sub    $0x8,%esp
+  80276f:	ff 75 0c             	push   0xc(%ebp)
+  802772:	50                   	push   %eax
+  802773:	e8 64 ff ff ff       	call   8026dc <fstat>
+  802778:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80277a:	89 1c 24             	mov    %ebx,(%esp)
+  80277d:	e8 c6 fb ff ff       	call   802348 <close>
+	return r;
+  802782:	83 c4 10             	add    $0x10,%esp
+  802785:	89 f3                	mov    %esi,%ebx
+}
+  802787:	89 d8                	mov    %ebx,%eax
+  802789:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80278c:	5b                   	pop    %ebx
+  80278d:	5e                   	pop    %esi
+  80278e:	5d                   	pop    %ebp
+  80278f:	c3                   	ret
+
+00802790 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802790:	55                   	push   %ebp
+  802791:	89 e5                	mov    %esp,%ebp
+  802793:	56                   	push   %esi
+  802794:	53                   	push   %ebx
+  802795:	89 c6                	mov    %eax,%esi
+  802797:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802799:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8027a0:	74 27                	je     8027c9 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8027a2:	6a 07                	push   $0x7
+  8027a4:	68 00 60 80 00       	push   $0x806000
+  8027a9:	56                   	push   %esi
+  8027aa:	ff 35 00 50 80 00    	push   0x805000
+  8027b0:	e8 17 f7 ff ff       	call   801ecc <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8027b5:	83 c4 0c             	add    $0xc,%esp
+  8027b8:	6a 00                	push   $0x0
+  8027ba:	53                   	push   %ebx
+  8027bb:	6a 00                	push   $0x0
+  8027bd:	e8 f2 f6 ff ff       	call   801eb4 <ipc_recv>
+}
+  8027c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c5:	5b                   	pop    %ebx
+  8027c6:	5e                   	pop    %esi
+  8027c7:	5d                   	pop    %ebp
+  8027c8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027c9:	83 ec 0c             	sub    $0xc,%esp
+  8027cc:	6a 01                	push   $0x1
+  8027ce:	e8 4d f7 ff ff       	call   801f20 <ipc_find_env>
+  8027d3:	a3 00 50 80 00       	mov    %eax,0x805000
+  8027d8:	83 c4 10             	add    $0x10,%esp
+  8027db:	eb c5                	jmp    8027a2 <fsipc+0x12>
+
+008027dd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8027dd:	55                   	push   %ebp
+  8027de:	89 e5                	mov    %esp,%ebp
+  8027e0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8027e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027e9:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8027ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027f1:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8027f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802800:	e8 8b ff ff ff       	call   802790 <fsipc>
+}
+  802805:	c9                   	leave
+  802806:	c3                   	ret
+
+00802807 <devfile_flush>:
+{
+  802807:	55                   	push   %ebp
+  802808:	89 e5                	mov    %esp,%ebp
+  80280a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80280d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802810:	8b 40 0c             	mov    0xc(%eax),%eax
+  802813:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802818:	ba 00 00 00 00       	mov    $0x0,%edx
+  80281d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802822:	e8 69 ff ff ff       	call   802790 <fsipc>
+}
+  802827:	c9                   	leave
+  802828:	c3                   	ret
+
+00802829 <devfile_stat>:
+{
+  802829:	55                   	push   %ebp
+  80282a:	89 e5                	mov    %esp,%ebp
+  80282c:	53                   	push   %ebx
+  80282d:	83 ec 04             	sub    $0x4,%esp
+  802830:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802833:	8b 45 08             	mov    0x8(%ebp),%eax
+  802836:	8b 40 0c             	mov    0xc(%eax),%eax
+  802839:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80283e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802843:	b8 05 00 00 00       	mov    $0x5,%eax
+  802848:	e8 43 ff ff ff       	call   802790 <fsipc>
+  80284d:	85 c0                	test   %eax,%eax
+  80284f:	78 2c                	js     80287d <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802851:	83 ec 08             	sub    $0x8,%esp
+  802854:	68 00 60 80 00       	push   $0x806000
+  802859:	53                   	push   %ebx
+  80285a:	e8 2c e1 ff ff       	call   80098b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80285f:	a1 80 60 80 00       	mov    0x806080,%eax
+  802864:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80286a:	a1 84 60 80 00       	mov    0x806084,%eax
+  80286f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802875:	83 c4 10             	add    $0x10,%esp
+  802878:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80287d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802880:	c9                   	leave
+  802881:	c3                   	ret
+
+00802882 <devfile_write>:
+{
+  802882:	55                   	push   %ebp
+  802883:	89 e5                	mov    %esp,%ebp
+  802885:	83 ec 0c             	sub    $0xc,%esp
+  802888:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80288b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80288e:	8b 52 0c             	mov    0xc(%edx),%edx
+  802891:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802897:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80289c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8028a1:	39 d0                	cmp    %edx,%eax
+  8028a3:	0f 47 c2             	cmova  %edx,%eax
+  8028a6:	50                   	push   %eax
+  8028a7:	ff 75 0c             	push   0xc(%ebp)
+  8028aa:	68 08 60 80 00       	push   $0x806008
+  8028af:	e8 5d e2 ff ff       	call   800b11 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8028b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028be:	e8 cd fe ff ff       	call   802790 <fsipc>
+}
+  8028c3:	c9                   	leave
+  8028c4:	c3                   	ret
+
+008028c5 <devfile_read>:
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	56                   	push   %esi
+  8028c9:	53                   	push   %ebx
+  8028ca:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8028cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028d3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8028d8:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8028de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028e8:	e8 a3 fe ff ff       	call   802790 <fsipc>
+  8028ed:	89 c3                	mov    %eax,%ebx
+  8028ef:	85 c0                	test   %eax,%eax
+  8028f1:	78 1f                	js     802912 <devfile_read+0x4d>
+	assert(r <= n);
+  8028f3:	39 c6                	cmp    %eax,%esi
+  8028f5:	72 24                	jb     80291b <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8028f7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8028fc:	7f 33                	jg     802931 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8028fe:	83 ec 04             	sub    $0x4,%esp
+  802901:	50                   	push   %eax
+  802902:	68 00 60 80 00       	push   $0x806000
+  802907:	ff 75 0c             	push   0xc(%ebp)
+  80290a:	e8 02 e2 ff ff       	call   800b11 <memmove>
+	return r;
+  80290f:	83 c4 10             	add    $0x10,%esp
+}
+  802912:	89 d8                	mov    %ebx,%eax
+  802914:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802917:	5b                   	pop    %ebx
+  802918:	5e                   	pop    %esi
+  802919:	5d                   	pop    %ebp
+  80291a:	c3                   	ret
+	assert(r <= n);
+  80291b:	68 40 3a 80 00       	push   $0x803a40
+  802920:	68 10 39 80 00       	push   $0x803910
+  802925:	6a 76                	push   $0x76
+  802927:	68 47 3a 80 00       	push   $0x803a47
+  80292c:	e8 37 d9 ff ff       	call   800268 <_panic>
+	assert(r <= PGSIZE);
+  802931:	68 52 3a 80 00       	push   $0x803a52
+  802936:	68 10 39 80 00       	push   $0x803910
+  80293b:	6a 77                	push   $0x77
+  80293d:	68 47 3a 80 00       	push   $0x803a47
+  802942:	e8 21 d9 ff ff       	call   800268 <_panic>
+
+00802947 <open>:
+{
+  802947:	55                   	push   %ebp
+  802948:	89 e5                	mov    %esp,%ebp
+  80294a:	56                   	push   %esi
+  80294b:	53                   	push   %ebx
+  80294c:	83 ec 1c             	sub    $0x1c,%esp
+  80294f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802952:	56                   	push   %esi
+  802953:	e8 f8 df ff ff       	call   800950 <strlen>
+  802958:	83 c4 10             	add    $0x10,%esp
+  80295b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802960:	7f 6c                	jg     8029ce <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802962:	83 ec 0c             	sub    $0xc,%esp
+  802965:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802968:	50                   	push   %eax
+  802969:	e8 3a f8 ff ff       	call   8021a8 <fd_alloc>
+  80296e:	89 c3                	mov    %eax,%ebx
+  802970:	83 c4 10             	add    $0x10,%esp
+  802973:	85 c0                	test   %eax,%eax
+  802975:	78 3c                	js     8029b3 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802977:	83 ec 08             	sub    $0x8,%esp
+  80297a:	56                   	push   %esi
+  80297b:	68 00 60 80 00       	push   $0x806000
+  802980:	e8 06 e0 ff ff       	call   80098b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802985:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802988:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80298d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802990:	b8 01 00 00 00       	mov    $0x1,%eax
+  802995:	e8 f6 fd ff ff       	call   802790 <fsipc>
+  80299a:	89 c3                	mov    %eax,%ebx
+  80299c:	83 c4 10             	add    $0x10,%esp
+  80299f:	85 c0                	test   %eax,%eax
+  8029a1:	78 19                	js     8029bc <open+0x75>
+	return fd2num(fd);
+  8029a3:	83 ec 0c             	sub    $0xc,%esp
+  8029a6:	ff 75 f4             	push   -0xc(%ebp)
+  8029a9:	e8 d3 f7 ff ff       	call   802181 <fd2num>
+  8029ae:	89 c3                	mov    %eax,%ebx
+  8029b0:	83 c4 10             	add    $0x10,%esp
+}
+  8029b3:	89 d8                	mov    %ebx,%eax
+  8029b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029b8:	5b                   	pop    %ebx
+  8029b9:	5e                   	pop    %esi
+  8029ba:	5d                   	pop    %ebp
+  8029bb:	c3                   	ret
+		fd_close(fd, 0);
+  8029bc:	83 ec 08             	sub    $0x8,%esp
+  8029bf:	6a 00                	push   $0x0
+  8029c1:	ff 75 f4             	push   -0xc(%ebp)
+  8029c4:	e8 f8 f8 ff ff       	call   8022c1 <fd_close>
+		return r;
+  8029c9:	83 c4 10             	add    $0x10,%esp
+  8029cc:	eb e5                	jmp    8029b3 <open+0x6c>
+		return -E_BAD_PATH;
+  8029ce:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8029d3:	eb de                	jmp    8029b3 <open+0x6c>
+
+008029d5 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8029d5:	55                   	push   %ebp
+  8029d6:	89 e5                	mov    %esp,%ebp
+  8029d8:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8029db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029e5:	e8 a6 fd ff ff       	call   802790 <fsipc>
+}
+  8029ea:	c9                   	leave
+  8029eb:	c3                   	ret
+
+008029ec <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8029ec:	55                   	push   %ebp
+  8029ed:	89 e5                	mov    %esp,%ebp
+  8029ef:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8029f2:	68 5e 3a 80 00       	push   $0x803a5e
+  8029f7:	ff 75 0c             	push   0xc(%ebp)
+  8029fa:	e8 8c df ff ff       	call   80098b <strcpy>
+	return 0;
+}
+  8029ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a04:	c9                   	leave
+  802a05:	c3                   	ret
+
+00802a06 <devsock_close>:
+{
+  802a06:	55                   	push   %ebp
+  802a07:	89 e5                	mov    %esp,%ebp
+  802a09:	53                   	push   %ebx
+  802a0a:	83 ec 10             	sub    $0x10,%esp
+  802a0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a10:	53                   	push   %ebx
+  802a11:	e8 f3 09 00 00       	call   803409 <pageref>
+  802a16:	89 c2                	mov    %eax,%edx
+  802a18:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a20:	83 fa 01             	cmp    $0x1,%edx
+  802a23:	74 05                	je     802a2a <devsock_close+0x24>
+}
+  802a25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a28:	c9                   	leave
+  802a29:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a2a:	83 ec 0c             	sub    $0xc,%esp
+  802a2d:	ff 73 0c             	push   0xc(%ebx)
+  802a30:	e8 b7 02 00 00       	call   802cec <nsipc_close>
+  802a35:	83 c4 10             	add    $0x10,%esp
+  802a38:	eb eb                	jmp    802a25 <devsock_close+0x1f>
+
+00802a3a <devsock_write>:
+{
+  802a3a:	55                   	push   %ebp
+  802a3b:	89 e5                	mov    %esp,%ebp
+  802a3d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a40:	6a 00                	push   $0x0
+  802a42:	ff 75 10             	push   0x10(%ebp)
+  802a45:	ff 75 0c             	push   0xc(%ebp)
+  802a48:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a4b:	ff 70 0c             	push   0xc(%eax)
+  802a4e:	e8 79 03 00 00       	call   802dcc <nsipc_send>
+}
+  802a53:	c9                   	leave
+  802a54:	c3                   	ret
+
+00802a55 <devsock_read>:
+{
+  802a55:	55                   	push   %ebp
+  802a56:	89 e5                	mov    %esp,%ebp
+  802a58:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802a5b:	6a 00                	push   $0x0
+  802a5d:	ff 75 10             	push   0x10(%ebp)
+  802a60:	ff 75 0c             	push   0xc(%ebp)
+  802a63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a66:	ff 70 0c             	push   0xc(%eax)
+  802a69:	e8 ef 02 00 00       	call   802d5d <nsipc_recv>
+}
+  802a6e:	c9                   	leave
+  802a6f:	c3                   	ret
+
+00802a70 <fd2sockid>:
+{
+  802a70:	55                   	push   %ebp
+  802a71:	89 e5                	mov    %esp,%ebp
+  802a73:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802a76:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a79:	52                   	push   %edx
+  802a7a:	50                   	push   %eax
+  802a7b:	e8 7e f7 ff ff       	call   8021fe <fd_lookup>
+  802a80:	83 c4 10             	add    $0x10,%esp
+  802a83:	85 c0                	test   %eax,%eax
+  802a85:	78 10                	js     802a97 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a8a:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a90:	39 08                	cmp    %ecx,(%eax)
+  802a92:	75 05                	jne    802a99 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802a94:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802a97:	c9                   	leave
+  802a98:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a99:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a9e:	eb f7                	jmp    802a97 <fd2sockid+0x27>
+
+00802aa0 <alloc_sockfd>:
+{
+  802aa0:	55                   	push   %ebp
+  802aa1:	89 e5                	mov    %esp,%ebp
+  802aa3:	56                   	push   %esi
+  802aa4:	53                   	push   %ebx
+  802aa5:	83 ec 1c             	sub    $0x1c,%esp
+  802aa8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802aaa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aad:	50                   	push   %eax
+  802aae:	e8 f5 f6 ff ff       	call   8021a8 <fd_alloc>
+  802ab3:	89 c3                	mov    %eax,%ebx
+  802ab5:	83 c4 10             	add    $0x10,%esp
+  802ab8:	85 c0                	test   %eax,%eax
+  802aba:	78 43                	js     802aff <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802abc:	83 ec 04             	sub    $0x4,%esp
+  802abf:	68 07 04 00 00       	push   $0x407
+  802ac4:	ff 75 f4             	push   -0xc(%ebp)
+  802ac7:	6a 00                	push   $0x0
+  802ac9:	e8 b5 e3 ff ff       	call   800e83 <sys_page_alloc>
+  802ace:	89 c3                	mov    %eax,%ebx
+  802ad0:	83 c4 10             	add    $0x10,%esp
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	78 28                	js     802aff <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802ad7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ada:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802ae0:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802ae2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802aec:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802aef:	83 ec 0c             	sub    $0xc,%esp
+  802af2:	50                   	push   %eax
+  802af3:	e8 89 f6 ff ff       	call   802181 <fd2num>
+  802af8:	89 c3                	mov    %eax,%ebx
+  802afa:	83 c4 10             	add    $0x10,%esp
+  802afd:	eb 0c                	jmp    802b0b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802aff:	83 ec 0c             	sub    $0xc,%esp
+  802b02:	56                   	push   %esi
+  802b03:	e8 e4 01 00 00       	call   802cec <nsipc_close>
+		return r;
+  802b08:	83 c4 10             	add    $0x10,%esp
+}
+  802b0b:	89 d8                	mov    %ebx,%eax
+  802b0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b10:	5b                   	pop    %ebx
+  802b11:	5e                   	pop    %esi
+  802b12:	5d                   	pop    %ebp
+  802b13:	c3                   	ret
+
+00802b14 <accept>:
+{
+  802b14:	55                   	push   %ebp
+  802b15:	89 e5                	mov    %esp,%ebp
+  802b17:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b1d:	e8 4e ff ff ff       	call   802a70 <fd2sockid>
+  802b22:	85 c0                	test   %eax,%eax
+  802b24:	78 1b                	js     802b41 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b26:	83 ec 04             	sub    $0x4,%esp
+  802b29:	ff 75 10             	push   0x10(%ebp)
+  802b2c:	ff 75 0c             	push   0xc(%ebp)
+  802b2f:	50                   	push   %eax
+  802b30:	e8 0e 01 00 00       	call   802c43 <nsipc_accept>
+  802b35:	83 c4 10             	add    $0x10,%esp
+  802b38:	85 c0                	test   %eax,%eax
+  802b3a:	78 05                	js     802b41 <accept+0x2d>
+	return alloc_sockfd(r);
+  802b3c:	e8 5f ff ff ff       	call   802aa0 <alloc_sockfd>
+}
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+
+00802b43 <bind>:
+{
+  802b43:	55                   	push   %ebp
+  802b44:	89 e5                	mov    %esp,%ebp
+  802b46:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b4c:	e8 1f ff ff ff       	call   802a70 <fd2sockid>
+  802b51:	85 c0                	test   %eax,%eax
+  802b53:	78 12                	js     802b67 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802b55:	83 ec 04             	sub    $0x4,%esp
+  802b58:	ff 75 10             	push   0x10(%ebp)
+  802b5b:	ff 75 0c             	push   0xc(%ebp)
+  802b5e:	50                   	push   %eax
+  802b5f:	e8 31 01 00 00       	call   802c95 <nsipc_bind>
+  802b64:	83 c4 10             	add    $0x10,%esp
+}
+  802b67:	c9                   	leave
+  802b68:	c3                   	ret
+
+00802b69 <shutdown>:
+{
+  802b69:	55                   	push   %ebp
+  802b6a:	89 e5                	mov    %esp,%ebp
+  802b6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b72:	e8 f9 fe ff ff       	call   802a70 <fd2sockid>
+  802b77:	85 c0                	test   %eax,%eax
+  802b79:	78 0f                	js     802b8a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802b7b:	83 ec 08             	sub    $0x8,%esp
+  802b7e:	ff 75 0c             	push   0xc(%ebp)
+  802b81:	50                   	push   %eax
+  802b82:	e8 43 01 00 00       	call   802cca <nsipc_shutdown>
+  802b87:	83 c4 10             	add    $0x10,%esp
+}
+  802b8a:	c9                   	leave
+  802b8b:	c3                   	ret
+
+00802b8c <connect>:
+{
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+  802b8f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b95:	e8 d6 fe ff ff       	call   802a70 <fd2sockid>
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	78 12                	js     802bb0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b9e:	83 ec 04             	sub    $0x4,%esp
+  802ba1:	ff 75 10             	push   0x10(%ebp)
+  802ba4:	ff 75 0c             	push   0xc(%ebp)
+  802ba7:	50                   	push   %eax
+  802ba8:	e8 59 01 00 00       	call   802d06 <nsipc_connect>
+  802bad:	83 c4 10             	add    $0x10,%esp
+}
+  802bb0:	c9                   	leave
+  802bb1:	c3                   	ret
+
+00802bb2 <listen>:
+{
+  802bb2:	55                   	push   %ebp
+  802bb3:	89 e5                	mov    %esp,%ebp
+  802bb5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbb:	e8 b0 fe ff ff       	call   802a70 <fd2sockid>
+  802bc0:	85 c0                	test   %eax,%eax
+  802bc2:	78 0f                	js     802bd3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802bc4:	83 ec 08             	sub    $0x8,%esp
+  802bc7:	ff 75 0c             	push   0xc(%ebp)
+  802bca:	50                   	push   %eax
+  802bcb:	e8 6b 01 00 00       	call   802d3b <nsipc_listen>
+  802bd0:	83 c4 10             	add    $0x10,%esp
+}
+  802bd3:	c9                   	leave
+  802bd4:	c3                   	ret
+
+00802bd5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802bd5:	55                   	push   %ebp
+  802bd6:	89 e5                	mov    %esp,%ebp
+  802bd8:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802bdb:	ff 75 10             	push   0x10(%ebp)
+  802bde:	ff 75 0c             	push   0xc(%ebp)
+  802be1:	ff 75 08             	push   0x8(%ebp)
+  802be4:	e8 41 02 00 00       	call   802e2a <nsipc_socket>
+  802be9:	83 c4 10             	add    $0x10,%esp
+  802bec:	85 c0                	test   %eax,%eax
+  802bee:	78 05                	js     802bf5 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802bf0:	e8 ab fe ff ff       	call   802aa0 <alloc_sockfd>
+}
+  802bf5:	c9                   	leave
+  802bf6:	c3                   	ret
+
+00802bf7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802bf7:	55                   	push   %ebp
+  802bf8:	89 e5                	mov    %esp,%ebp
+  802bfa:	53                   	push   %ebx
+  802bfb:	83 ec 04             	sub    $0x4,%esp
+  802bfe:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c00:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802c07:	74 26                	je     802c2f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c09:	6a 07                	push   $0x7
+  802c0b:	68 00 70 80 00       	push   $0x807000
+  802c10:	53                   	push   %ebx
+  802c11:	ff 35 04 50 80 00    	push   0x805004
+  802c17:	e8 b0 f2 ff ff       	call   801ecc <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c1c:	83 c4 0c             	add    $0xc,%esp
+  802c1f:	6a 00                	push   $0x0
+  802c21:	6a 00                	push   $0x0
+  802c23:	6a 00                	push   $0x0
+  802c25:	e8 8a f2 ff ff       	call   801eb4 <ipc_recv>
+}
+  802c2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c2d:	c9                   	leave
+  802c2e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c2f:	83 ec 0c             	sub    $0xc,%esp
+  802c32:	6a 02                	push   $0x2
+  802c34:	e8 e7 f2 ff ff       	call   801f20 <ipc_find_env>
+  802c39:	a3 04 50 80 00       	mov    %eax,0x805004
+  802c3e:	83 c4 10             	add    $0x10,%esp
+  802c41:	eb c6                	jmp    802c09 <nsipc+0x12>
+
+00802c43 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	56                   	push   %esi
+  802c47:	53                   	push   %ebx
+  802c48:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c4e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802c53:	8b 06                	mov    (%esi),%eax
+  802c55:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c5f:	e8 93 ff ff ff       	call   802bf7 <nsipc>
+  802c64:	89 c3                	mov    %eax,%ebx
+  802c66:	85 c0                	test   %eax,%eax
+  802c68:	79 09                	jns    802c73 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c6a:	89 d8                	mov    %ebx,%eax
+  802c6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c6f:	5b                   	pop    %ebx
+  802c70:	5e                   	pop    %esi
+  802c71:	5d                   	pop    %ebp
+  802c72:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c73:	83 ec 04             	sub    $0x4,%esp
+  802c76:	ff 35 10 70 80 00    	push   0x807010
+  802c7c:	68 00 70 80 00       	push   $0x807000
+  802c81:	ff 75 0c             	push   0xc(%ebp)
+  802c84:	e8 88 de ff ff       	call   800b11 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c89:	a1 10 70 80 00       	mov    0x807010,%eax
+  802c8e:	89 06                	mov    %eax,(%esi)
+  802c90:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c93:	eb d5                	jmp    802c6a <nsipc_accept+0x27>
+
+00802c95 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c95:	55                   	push   %ebp
+  802c96:	89 e5                	mov    %esp,%ebp
+  802c98:	53                   	push   %ebx
+  802c99:	83 ec 08             	sub    $0x8,%esp
+  802c9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca2:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802ca7:	53                   	push   %ebx
+  802ca8:	ff 75 0c             	push   0xc(%ebp)
+  802cab:	68 04 70 80 00       	push   $0x807004
+  802cb0:	e8 5c de ff ff       	call   800b11 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802cb5:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802cbb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802cc0:	e8 32 ff ff ff       	call   802bf7 <nsipc>
+}
+  802cc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cc8:	c9                   	leave
+  802cc9:	c3                   	ret
+
+00802cca <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802cca:	55                   	push   %ebp
+  802ccb:	89 e5                	mov    %esp,%ebp
+  802ccd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802cd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802cd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cdb:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802ce0:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ce5:	e8 0d ff ff ff       	call   802bf7 <nsipc>
+}
+  802cea:	c9                   	leave
+  802ceb:	c3                   	ret
+
+00802cec <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802cec:	55                   	push   %ebp
+  802ced:	89 e5                	mov    %esp,%ebp
+  802cef:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf5:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802cfa:	b8 04 00 00 00       	mov    $0x4,%eax
+  802cff:	e8 f3 fe ff ff       	call   802bf7 <nsipc>
+}
+  802d04:	c9                   	leave
+  802d05:	c3                   	ret
+
+00802d06 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d06:	55                   	push   %ebp
+  802d07:	89 e5                	mov    %esp,%ebp
+  802d09:	53                   	push   %ebx
+  802d0a:	83 ec 08             	sub    $0x8,%esp
+  802d0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d10:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d13:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d18:	53                   	push   %ebx
+  802d19:	ff 75 0c             	push   0xc(%ebp)
+  802d1c:	68 04 70 80 00       	push   $0x807004
+  802d21:	e8 eb dd ff ff       	call   800b11 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d26:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802d2c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d31:	e8 c1 fe ff ff       	call   802bf7 <nsipc>
+}
+  802d36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d39:	c9                   	leave
+  802d3a:	c3                   	ret
+
+00802d3b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d3b:	55                   	push   %ebp
+  802d3c:	89 e5                	mov    %esp,%ebp
+  802d3e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d44:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d4c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802d51:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d56:	e8 9c fe ff ff       	call   802bf7 <nsipc>
+}
+  802d5b:	c9                   	leave
+  802d5c:	c3                   	ret
+
+00802d5d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d5d:	55                   	push   %ebp
+  802d5e:	89 e5                	mov    %esp,%ebp
+  802d60:	56                   	push   %esi
+  802d61:	53                   	push   %ebx
+  802d62:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d68:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802d6d:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802d73:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d76:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d7b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d80:	e8 72 fe ff ff       	call   802bf7 <nsipc>
+  802d85:	89 c3                	mov    %eax,%ebx
+  802d87:	85 c0                	test   %eax,%eax
+  802d89:	78 22                	js     802dad <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d8b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d90:	39 c6                	cmp    %eax,%esi
+  802d92:	0f 4e c6             	cmovle %esi,%eax
+  802d95:	39 c3                	cmp    %eax,%ebx
+  802d97:	7f 1d                	jg     802db6 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d99:	83 ec 04             	sub    $0x4,%esp
+  802d9c:	53                   	push   %ebx
+  802d9d:	68 00 70 80 00       	push   $0x807000
+  802da2:	ff 75 0c             	push   0xc(%ebp)
+  802da5:	e8 67 dd ff ff       	call   800b11 <memmove>
+  802daa:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802dad:	89 d8                	mov    %ebx,%eax
+  802daf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802db2:	5b                   	pop    %ebx
+  802db3:	5e                   	pop    %esi
+  802db4:	5d                   	pop    %ebp
+  802db5:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802db6:	68 6a 3a 80 00       	push   $0x803a6a
+  802dbb:	68 10 39 80 00       	push   $0x803910
+  802dc0:	6a 62                	push   $0x62
+  802dc2:	68 7f 3a 80 00       	push   $0x803a7f
+  802dc7:	e8 9c d4 ff ff       	call   800268 <_panic>
+
+00802dcc <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802dcc:	55                   	push   %ebp
+  802dcd:	89 e5                	mov    %esp,%ebp
+  802dcf:	53                   	push   %ebx
+  802dd0:	83 ec 04             	sub    $0x4,%esp
+  802dd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dd9:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802dde:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802de4:	7f 2e                	jg     802e14 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802de6:	83 ec 04             	sub    $0x4,%esp
+  802de9:	53                   	push   %ebx
+  802dea:	ff 75 0c             	push   0xc(%ebp)
+  802ded:	68 0c 70 80 00       	push   $0x80700c
+  802df2:	e8 1a dd ff ff       	call   800b11 <memmove>
+	nsipcbuf.send.req_size = size;
+  802df7:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802dfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e00:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802e05:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e0a:	e8 e8 fd ff ff       	call   802bf7 <nsipc>
+}
+  802e0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e12:	c9                   	leave
+  802e13:	c3                   	ret
+	assert(size < 1600);
+  802e14:	68 8b 3a 80 00       	push   $0x803a8b
+  802e19:	68 10 39 80 00       	push   $0x803910
+  802e1e:	6a 6d                	push   $0x6d
+  802e20:	68 7f 3a 80 00       	push   $0x803a7f
+  802e25:	e8 3e d4 ff ff       	call   800268 <_panic>
+
+00802e2a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e2a:	55                   	push   %ebp
+  802e2b:	89 e5                	mov    %esp,%ebp
+  802e2d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e33:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802e38:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e3b:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e40:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e43:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802e48:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e4d:	e8 a5 fd ff ff       	call   802bf7 <nsipc>
+}
+  802e52:	c9                   	leave
+  802e53:	c3                   	ret
+
+00802e54 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e54:	55                   	push   %ebp
+  802e55:	89 e5                	mov    %esp,%ebp
+  802e57:	56                   	push   %esi
+  802e58:	53                   	push   %ebx
+  802e59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e5c:	83 ec 0c             	sub    $0xc,%esp
+  802e5f:	ff 75 08             	push   0x8(%ebp)
+  802e62:	e8 2a f3 ff ff       	call   802191 <fd2data>
+  802e67:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e69:	83 c4 08             	add    $0x8,%esp
+  802e6c:	68 97 3a 80 00       	push   $0x803a97
+  802e71:	53                   	push   %ebx
+  802e72:	e8 14 db ff ff       	call   80098b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e77:	8b 46 04             	mov    0x4(%esi),%eax
+  802e7a:	2b 06                	sub    (%esi),%eax
+  802e7c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802e82:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802e89:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e8c:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802e93:	40 80 00 
+	return 0;
+}
+  802e96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e9e:	5b                   	pop    %ebx
+  802e9f:	5e                   	pop    %esi
+  802ea0:	5d                   	pop    %ebp
+  802ea1:	c3                   	ret
+
+00802ea2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ea2:	55                   	push   %ebp
+  802ea3:	89 e5                	mov    %esp,%ebp
+  802ea5:	53                   	push   %ebx
+  802ea6:	83 ec 0c             	sub    $0xc,%esp
+  802ea9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802eac:	53                   	push   %ebx
+  802ead:	6a 00                	push   $0x0
+  802eaf:	e8 aa e0 ff ff       	call   800f5e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802eb4:	89 1c 24             	mov    %ebx,(%esp)
+  802eb7:	e8 d5 f2 ff ff       	call   802191 <fd2data>
+  802ebc:	83 c4 08             	add    $0x8,%esp
+  802ebf:	50                   	push   %eax
+  802ec0:	6a 00                	push   $0x0
+  802ec2:	e8 97 e0 ff ff       	call   800f5e <sys_page_unmap>
+}
+  802ec7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eca:	c9                   	leave
+  802ecb:	c3                   	ret
+
+00802ecc <_pipeisclosed>:
+{
+  802ecc:	55                   	push   %ebp
+  802ecd:	89 e5                	mov    %esp,%ebp
+  802ecf:	57                   	push   %edi
+  802ed0:	56                   	push   %esi
+  802ed1:	53                   	push   %ebx
+  802ed2:	83 ec 1c             	sub    $0x1c,%esp
+  802ed5:	89 c7                	mov    %eax,%edi
+  802ed7:	89 d6                	mov    %edx,%esi
+  802ed9:	eb 3c                	jmp    802f17 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802edb:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802ede:	83 ec 0c             	sub    $0xc,%esp
+  802ee1:	57                   	push   %edi
+  802ee2:	e8 22 05 00 00       	call   803409 <pageref>
+  802ee7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802eea:	89 34 24             	mov    %esi,(%esp)
+  802eed:	e8 17 05 00 00       	call   803409 <pageref>
+  802ef2:	89 c2                	mov    %eax,%edx
+  802ef4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ef6:	05 00 00 00 20       	add    $0x20000000,%eax
+  802efb:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802efe:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f04:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f09:	76 31                	jbe    802f3c <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802f0b:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802f0e:	39 c3                	cmp    %eax,%ebx
+  802f10:	74 76                	je     802f88 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802f12:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f15:	74 36                	je     802f4d <_pipeisclosed+0x81>
+  802f17:	89 e0                	mov    %esp,%eax
+  802f19:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f1e:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f24:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f29:	77 b0                	ja     802edb <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f2b:	c1 e8 10             	shr    $0x10,%eax
+  802f2e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f34:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f3a:	eb 9f                	jmp    802edb <_pipeisclosed+0xf>
+  802f3c:	c1 e8 10             	shr    $0x10,%eax
+  802f3f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f45:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802f4b:	eb be                	jmp    802f0b <_pipeisclosed+0x3f>
+  802f4d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f4f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f54:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f5a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f5f:	76 16                	jbe    802f77 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f61:	8b 42 58             	mov    0x58(%edx),%eax
+  802f64:	6a 01                	push   $0x1
+  802f66:	50                   	push   %eax
+  802f67:	53                   	push   %ebx
+  802f68:	68 9e 3a 80 00       	push   $0x803a9e
+  802f6d:	e8 d1 d3 ff ff       	call   800343 <cprintf>
+  802f72:	83 c4 10             	add    $0x10,%esp
+  802f75:	eb a0                	jmp    802f17 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f77:	c1 e8 10             	shr    $0x10,%eax
+  802f7a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f80:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f86:	eb d9                	jmp    802f61 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802f88:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f8b:	0f 94 c0             	sete   %al
+  802f8e:	0f b6 c0             	movzbl %al,%eax
+}
+  802f91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f94:	5b                   	pop    %ebx
+  802f95:	5e                   	pop    %esi
+  802f96:	5f                   	pop    %edi
+  802f97:	5d                   	pop    %ebp
+  802f98:	c3                   	ret
+
+00802f99 <devpipe_write>:
+{
+  802f99:	55                   	push   %ebp
+  802f9a:	89 e5                	mov    %esp,%ebp
+  802f9c:	57                   	push   %edi
+  802f9d:	56                   	push   %esi
+  802f9e:	53                   	push   %ebx
+  802f9f:	83 ec 28             	sub    $0x28,%esp
+  802fa2:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802fa5:	56                   	push   %esi
+  802fa6:	e8 e6 f1 ff ff       	call   802191 <fd2data>
+  802fab:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fad:	83 c4 10             	add    $0x10,%esp
+  802fb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802fb8:	75 09                	jne    802fc3 <devpipe_write+0x2a>
+	return i;
+  802fba:	89 f8                	mov    %edi,%eax
+  802fbc:	eb 23                	jmp    802fe1 <devpipe_write+0x48>
+			sys_yield();
+  802fbe:	e8 7a de ff ff       	call   800e3d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802fc3:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fc6:	8b 0b                	mov    (%ebx),%ecx
+  802fc8:	8d 51 20             	lea    0x20(%ecx),%edx
+  802fcb:	39 d0                	cmp    %edx,%eax
+  802fcd:	72 1a                	jb     802fe9 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802fcf:	89 da                	mov    %ebx,%edx
+  802fd1:	89 f0                	mov    %esi,%eax
+  802fd3:	e8 f4 fe ff ff       	call   802ecc <_pipeisclosed>
+  802fd8:	85 c0                	test   %eax,%eax
+  802fda:	74 e2                	je     802fbe <devpipe_write+0x25>
+				return 0;
+  802fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fe4:	5b                   	pop    %ebx
+  802fe5:	5e                   	pop    %esi
+  802fe6:	5f                   	pop    %edi
+  802fe7:	5d                   	pop    %ebp
+  802fe8:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802fe9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fec:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802ff0:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802ff3:	89 c2                	mov    %eax,%edx
+  802ff5:	c1 fa 1f             	sar    $0x1f,%edx
+  802ff8:	89 d1                	mov    %edx,%ecx
+  802ffa:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ffd:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803000:	83 e2 1f             	and    $0x1f,%edx
+  803003:	29 ca                	sub    %ecx,%edx
+  803005:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803009:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80300d:	83 c0 01             	add    $0x1,%eax
+  803010:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803013:	83 c7 01             	add    $0x1,%edi
+  803016:	eb 9d                	jmp    802fb5 <devpipe_write+0x1c>
+
+00803018 <devpipe_read>:
+{
+  803018:	55                   	push   %ebp
+  803019:	89 e5                	mov    %esp,%ebp
+  80301b:	57                   	push   %edi
+  80301c:	56                   	push   %esi
+  80301d:	53                   	push   %ebx
+  80301e:	83 ec 18             	sub    $0x18,%esp
+  803021:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803024:	57                   	push   %edi
+  803025:	e8 67 f1 ff ff       	call   802191 <fd2data>
+  80302a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80302c:	83 c4 10             	add    $0x10,%esp
+  80302f:	be 00 00 00 00       	mov    $0x0,%esi
+  803034:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803037:	75 13                	jne    80304c <devpipe_read+0x34>
+	return i;
+  803039:	89 f0                	mov    %esi,%eax
+  80303b:	eb 02                	jmp    80303f <devpipe_read+0x27>
+				return i;
+  80303d:	89 f0                	mov    %esi,%eax
+}
+  80303f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803042:	5b                   	pop    %ebx
+  803043:	5e                   	pop    %esi
+  803044:	5f                   	pop    %edi
+  803045:	5d                   	pop    %ebp
+  803046:	c3                   	ret
+			sys_yield();
+  803047:	e8 f1 dd ff ff       	call   800e3d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80304c:	8b 03                	mov    (%ebx),%eax
+  80304e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803051:	75 18                	jne    80306b <devpipe_read+0x53>
+			if (i > 0)
+  803053:	85 f6                	test   %esi,%esi
+  803055:	75 e6                	jne    80303d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803057:	89 da                	mov    %ebx,%edx
+  803059:	89 f8                	mov    %edi,%eax
+  80305b:	e8 6c fe ff ff       	call   802ecc <_pipeisclosed>
+  803060:	85 c0                	test   %eax,%eax
+  803062:	74 e3                	je     803047 <devpipe_read+0x2f>
+				return 0;
+  803064:	b8 00 00 00 00       	mov    $0x0,%eax
+  803069:	eb d4                	jmp    80303f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80306b:	99                   	cltd
+  80306c:	c1 ea 1b             	shr    $0x1b,%edx
+  80306f:	01 d0                	add    %edx,%eax
+  803071:	83 e0 1f             	and    $0x1f,%eax
+  803074:	29 d0                	sub    %edx,%eax
+  803076:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80307b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80307e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803081:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803084:	83 c6 01             	add    $0x1,%esi
+  803087:	eb ab                	jmp    803034 <devpipe_read+0x1c>
+
+00803089 <pipe>:
+{
+  803089:	55                   	push   %ebp
+  80308a:	89 e5                	mov    %esp,%ebp
+  80308c:	56                   	push   %esi
+  80308d:	53                   	push   %ebx
+  80308e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803091:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803094:	50                   	push   %eax
+  803095:	e8 0e f1 ff ff       	call   8021a8 <fd_alloc>
+  80309a:	89 c3                	mov    %eax,%ebx
+  80309c:	83 c4 10             	add    $0x10,%esp
+  80309f:	85 c0                	test   %eax,%eax
+  8030a1:	0f 88 23 01 00 00    	js     8031ca <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030a7:	83 ec 04             	sub    $0x4,%esp
+  8030aa:	68 07 04 00 00       	push   $0x407
+  8030af:	ff 75 f4             	push   -0xc(%ebp)
+  8030b2:	6a 00                	push   $0x0
+  8030b4:	e8 ca dd ff ff       	call   800e83 <sys_page_alloc>
+  8030b9:	89 c3                	mov    %eax,%ebx
+  8030bb:	83 c4 10             	add    $0x10,%esp
+  8030be:	85 c0                	test   %eax,%eax
+  8030c0:	0f 88 04 01 00 00    	js     8031ca <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030c6:	83 ec 0c             	sub    $0xc,%esp
+  8030c9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030cc:	50                   	push   %eax
+  8030cd:	e8 d6 f0 ff ff       	call   8021a8 <fd_alloc>
+  8030d2:	89 c3                	mov    %eax,%ebx
+  8030d4:	83 c4 10             	add    $0x10,%esp
+  8030d7:	85 c0                	test   %eax,%eax
+  8030d9:	0f 88 db 00 00 00    	js     8031ba <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030df:	83 ec 04             	sub    $0x4,%esp
+  8030e2:	68 07 04 00 00       	push   $0x407
+  8030e7:	ff 75 f0             	push   -0x10(%ebp)
+  8030ea:	6a 00                	push   $0x0
+  8030ec:	e8 92 dd ff ff       	call   800e83 <sys_page_alloc>
+  8030f1:	89 c3                	mov    %eax,%ebx
+  8030f3:	83 c4 10             	add    $0x10,%esp
+  8030f6:	85 c0                	test   %eax,%eax
+  8030f8:	0f 88 bc 00 00 00    	js     8031ba <pipe+0x131>
+	va = fd2data(fd0);
+  8030fe:	83 ec 0c             	sub    $0xc,%esp
+  803101:	ff 75 f4             	push   -0xc(%ebp)
+  803104:	e8 88 f0 ff ff       	call   802191 <fd2data>
+  803109:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80310b:	83 c4 0c             	add    $0xc,%esp
+  80310e:	68 07 04 00 00       	push   $0x407
+  803113:	50                   	push   %eax
+  803114:	6a 00                	push   $0x0
+  803116:	e8 68 dd ff ff       	call   800e83 <sys_page_alloc>
+  80311b:	89 c3                	mov    %eax,%ebx
+  80311d:	83 c4 10             	add    $0x10,%esp
+  803120:	85 c0                	test   %eax,%eax
+  803122:	0f 88 82 00 00 00    	js     8031aa <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803128:	83 ec 0c             	sub    $0xc,%esp
+  80312b:	ff 75 f0             	push   -0x10(%ebp)
+  80312e:	e8 5e f0 ff ff       	call   802191 <fd2data>
+  803133:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80313a:	50                   	push   %eax
+  80313b:	6a 00                	push   $0x0
+  80313d:	56                   	push   %esi
+  80313e:	6a 00                	push   $0x0
+  803140:	e8 ab dd ff ff       	call   800ef0 <sys_page_map>
+  803145:	89 c3                	mov    %eax,%ebx
+  803147:	83 c4 20             	add    $0x20,%esp
+  80314a:	85 c0                	test   %eax,%eax
+  80314c:	78 4e                	js     80319c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80314e:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  803153:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803156:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803158:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80315b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803162:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803165:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803167:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80316a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803171:	83 ec 0c             	sub    $0xc,%esp
+  803174:	ff 75 f4             	push   -0xc(%ebp)
+  803177:	e8 05 f0 ff ff       	call   802181 <fd2num>
+  80317c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80317f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803181:	83 c4 04             	add    $0x4,%esp
+  803184:	ff 75 f0             	push   -0x10(%ebp)
+  803187:	e8 f5 ef ff ff       	call   802181 <fd2num>
+  80318c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80318f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803192:	83 c4 10             	add    $0x10,%esp
+  803195:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80319a:	eb 2e                	jmp    8031ca <pipe+0x141>
+	sys_page_unmap(0, va);
+  80319c:	83 ec 08             	sub    $0x8,%esp
+  80319f:	56                   	push   %esi
+  8031a0:	6a 00                	push   $0x0
+  8031a2:	e8 b7 dd ff ff       	call   800f5e <sys_page_unmap>
+  8031a7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031aa:	83 ec 08             	sub    $0x8,%esp
+  8031ad:	ff 75 f0             	push   -0x10(%ebp)
+  8031b0:	6a 00                	push   $0x0
+  8031b2:	e8 a7 dd ff ff       	call   800f5e <sys_page_unmap>
+  8031b7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031ba:	83 ec 08             	sub    $0x8,%esp
+  8031bd:	ff 75 f4             	push   -0xc(%ebp)
+  8031c0:	6a 00                	push   $0x0
+  8031c2:	e8 97 dd ff ff       	call   800f5e <sys_page_unmap>
+  8031c7:	83 c4 10             	add    $0x10,%esp
+}
+  8031ca:	89 d8                	mov    %ebx,%eax
+  8031cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031cf:	5b                   	pop    %ebx
+  8031d0:	5e                   	pop    %esi
+  8031d1:	5d                   	pop    %ebp
+  8031d2:	c3                   	ret
+
+008031d3 <pipeisclosed>:
+{
+  8031d3:	55                   	push   %ebp
+  8031d4:	89 e5                	mov    %esp,%ebp
+  8031d6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031dc:	50                   	push   %eax
+  8031dd:	ff 75 08             	push   0x8(%ebp)
+  8031e0:	e8 19 f0 ff ff       	call   8021fe <fd_lookup>
+  8031e5:	83 c4 10             	add    $0x10,%esp
+  8031e8:	85 c0                	test   %eax,%eax
+  8031ea:	78 18                	js     803204 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8031ec:	83 ec 0c             	sub    $0xc,%esp
+  8031ef:	ff 75 f4             	push   -0xc(%ebp)
+  8031f2:	e8 9a ef ff ff       	call   802191 <fd2data>
+  8031f7:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8031f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031fc:	e8 cb fc ff ff       	call   802ecc <_pipeisclosed>
+  803201:	83 c4 10             	add    $0x10,%esp
+}
+  803204:	c9                   	leave
+  803205:	c3                   	ret
+
+00803206 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320b:	c3                   	ret
+
+0080320c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80320c:	55                   	push   %ebp
+  80320d:	89 e5                	mov    %esp,%ebp
+  80320f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803212:	68 b6 3a 80 00       	push   $0x803ab6
+  803217:	ff 75 0c             	push   0xc(%ebp)
+  80321a:	e8 6c d7 ff ff       	call   80098b <strcpy>
+	return 0;
+}
+  80321f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803224:	c9                   	leave
+  803225:	c3                   	ret
+
+00803226 <devcons_write>:
+{
+  803226:	55                   	push   %ebp
+  803227:	89 e5                	mov    %esp,%ebp
+  803229:	57                   	push   %edi
+  80322a:	56                   	push   %esi
+  80322b:	53                   	push   %ebx
+  80322c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803232:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803237:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80323d:	eb 2e                	jmp    80326d <devcons_write+0x47>
+		m = n - tot;
+  80323f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803242:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803244:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803249:	39 c3                	cmp    %eax,%ebx
+  80324b:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80324e:	83 ec 04             	sub    $0x4,%esp
+  803251:	53                   	push   %ebx
+  803252:	89 f0                	mov    %esi,%eax
+  803254:	03 45 0c             	add    0xc(%ebp),%eax
+  803257:	50                   	push   %eax
+  803258:	57                   	push   %edi
+  803259:	e8 b3 d8 ff ff       	call   800b11 <memmove>
+		sys_cputs(buf, m);
+  80325e:	83 c4 08             	add    $0x8,%esp
+  803261:	53                   	push   %ebx
+  803262:	57                   	push   %edi
+  803263:	e8 9c da ff ff       	call   800d04 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803268:	01 de                	add    %ebx,%esi
+  80326a:	83 c4 10             	add    $0x10,%esp
+  80326d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803270:	72 cd                	jb     80323f <devcons_write+0x19>
+}
+  803272:	89 f0                	mov    %esi,%eax
+  803274:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803277:	5b                   	pop    %ebx
+  803278:	5e                   	pop    %esi
+  803279:	5f                   	pop    %edi
+  80327a:	5d                   	pop    %ebp
+  80327b:	c3                   	ret
+
+0080327c <devcons_read>:
+{
+  80327c:	55                   	push   %ebp
+  80327d:	89 e5                	mov    %esp,%ebp
+  80327f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803282:	b8 00 00 00 00       	mov    $0x0,%eax
+  803287:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80328b:	75 07                	jne    803294 <devcons_read+0x18>
+  80328d:	eb 1f                	jmp    8032ae <devcons_read+0x32>
+		sys_yield();
+  80328f:	e8 a9 db ff ff       	call   800e3d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803294:	e8 af da ff ff       	call   800d48 <sys_cgetc>
+  803299:	85 c0                	test   %eax,%eax
+  80329b:	74 f2                	je     80328f <devcons_read+0x13>
+	if (c < 0)
+  80329d:	78 0f                	js     8032ae <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80329f:	83 f8 04             	cmp    $0x4,%eax
+  8032a2:	74 0c                	je     8032b0 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8032a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032a7:	88 02                	mov    %al,(%edx)
+	return 1;
+  8032a9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8032ae:	c9                   	leave
+  8032af:	c3                   	ret
+		return 0;
+  8032b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b5:	eb f7                	jmp    8032ae <devcons_read+0x32>
+
+008032b7 <cputchar>:
+{
+  8032b7:	55                   	push   %ebp
+  8032b8:	89 e5                	mov    %esp,%ebp
+  8032ba:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8032bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032c0:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8032c3:	6a 01                	push   $0x1
+  8032c5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032c8:	50                   	push   %eax
+  8032c9:	e8 36 da ff ff       	call   800d04 <sys_cputs>
+}
+  8032ce:	83 c4 10             	add    $0x10,%esp
+  8032d1:	c9                   	leave
+  8032d2:	c3                   	ret
+
+008032d3 <getchar>:
+{
+  8032d3:	55                   	push   %ebp
+  8032d4:	89 e5                	mov    %esp,%ebp
+  8032d6:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8032d9:	6a 01                	push   $0x1
+  8032db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032de:	50                   	push   %eax
+  8032df:	6a 00                	push   $0x0
+  8032e1:	e8 9e f1 ff ff       	call   802484 <read>
+	if (r < 0)
+  8032e6:	83 c4 10             	add    $0x10,%esp
+  8032e9:	85 c0                	test   %eax,%eax
+  8032eb:	78 06                	js     8032f3 <getchar+0x20>
+	if (r < 1)
+  8032ed:	74 06                	je     8032f5 <getchar+0x22>
+	return c;
+  8032ef:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8032f3:	c9                   	leave
+  8032f4:	c3                   	ret
+		return -E_EOF;
+  8032f5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8032fa:	eb f7                	jmp    8032f3 <getchar+0x20>
+
+008032fc <iscons>:
+{
+  8032fc:	55                   	push   %ebp
+  8032fd:	89 e5                	mov    %esp,%ebp
+  8032ff:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803302:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803305:	50                   	push   %eax
+  803306:	ff 75 08             	push   0x8(%ebp)
+  803309:	e8 f0 ee ff ff       	call   8021fe <fd_lookup>
+  80330e:	83 c4 10             	add    $0x10,%esp
+  803311:	85 c0                	test   %eax,%eax
+  803313:	78 11                	js     803326 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803315:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803318:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80331e:	39 10                	cmp    %edx,(%eax)
+  803320:	0f 94 c0             	sete   %al
+  803323:	0f b6 c0             	movzbl %al,%eax
+}
+  803326:	c9                   	leave
+  803327:	c3                   	ret
+
+00803328 <opencons>:
+{
+  803328:	55                   	push   %ebp
+  803329:	89 e5                	mov    %esp,%ebp
+  80332b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80332e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803331:	50                   	push   %eax
+  803332:	e8 71 ee ff ff       	call   8021a8 <fd_alloc>
+  803337:	83 c4 10             	add    $0x10,%esp
+  80333a:	85 c0                	test   %eax,%eax
+  80333c:	78 3a                	js     803378 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80333e:	83 ec 04             	sub    $0x4,%esp
+  803341:	68 07 04 00 00       	push   $0x407
+  803346:	ff 75 f4             	push   -0xc(%ebp)
+  803349:	6a 00                	push   $0x0
+  80334b:	e8 33 db ff ff       	call   800e83 <sys_page_alloc>
+  803350:	83 c4 10             	add    $0x10,%esp
+  803353:	85 c0                	test   %eax,%eax
+  803355:	78 21                	js     803378 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803357:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80335a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803360:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803362:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803365:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80336c:	83 ec 0c             	sub    $0xc,%esp
+  80336f:	50                   	push   %eax
+  803370:	e8 0c ee ff ff       	call   802181 <fd2num>
+  803375:	83 c4 10             	add    $0x10,%esp
+}
+  803378:	c9                   	leave
+  803379:	c3                   	ret
+
+0080337a <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80337a:	55                   	push   %ebp
+  80337b:	89 e5                	mov    %esp,%ebp
+  80337d:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803380:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803387:	74 0a                	je     803393 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803389:	8b 45 08             	mov    0x8(%ebp),%eax
+  80338c:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803391:	c9                   	leave
+  803392:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803393:	83 ec 04             	sub    $0x4,%esp
+  803396:	6a 07                	push   $0x7
+  803398:	68 00 f0 bf ee       	push   $0xeebff000
+  80339d:	6a 00                	push   $0x0
+  80339f:	e8 df da ff ff       	call   800e83 <sys_page_alloc>
+  8033a4:	83 c4 10             	add    $0x10,%esp
+  8033a7:	85 c0                	test   %eax,%eax
+  8033a9:	78 14                	js     8033bf <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8033ab:	83 ec 08             	sub    $0x8,%esp
+  8033ae:	68 e1 33 80 00       	push   $0x8033e1
+  8033b3:	6a 00                	push   $0x0
+  8033b5:	e8 e5 dc ff ff       	call   80109f <sys_env_set_pgfault_upcall>
+  8033ba:	83 c4 10             	add    $0x10,%esp
+  8033bd:	eb ca                	jmp    803389 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8033bf:	83 ec 08             	sub    $0x8,%esp
+  8033c2:	50                   	push   %eax
+  8033c3:	68 c2 3a 80 00       	push   $0x803ac2
+  8033c8:	e8 76 cf ff ff       	call   800343 <cprintf>
+			panic("set_pgfault_handler error");
+  8033cd:	83 c4 0c             	add    $0xc,%esp
+  8033d0:	68 cd 3a 80 00       	push   $0x803acd
+  8033d5:	6a 24                	push   $0x24
+  8033d7:	68 e7 3a 80 00       	push   $0x803ae7
+  8033dc:	e8 87 ce ff ff       	call   800268 <_panic>
+
+008033e1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8033e1:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8033e2:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8033e7:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8033e9:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8033ec:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  8033f0:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  8033f3:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  8033f7:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  8033f9:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  8033fd:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8033fe:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803402:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803403:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803404:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803408:	c3                   	ret
+
+00803409 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803409:	55                   	push   %ebp
+  80340a:	89 e5                	mov    %esp,%ebp
+  80340c:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80340f:	89 c2                	mov    %eax,%edx
+  803411:	c1 ea 16             	shr    $0x16,%edx
+  803414:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80341b:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803420:	f6 c1 01             	test   $0x1,%cl
+  803423:	74 1a                	je     80343f <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803425:	c1 e8 0c             	shr    $0xc,%eax
+  803428:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80342f:	a8 01                	test   $0x1,%al
+  803431:	74 0c                	je     80343f <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803433:	c1 e8 0c             	shr    $0xc,%eax
+  803436:	c1 e0 04             	shl    $0x4,%eax
+  803439:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80343f:	89 d0                	mov    %edx,%eax
+  803441:	5d                   	pop    %ebp
+  803442:	c3                   	ret
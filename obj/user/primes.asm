@@ -0,0 +1,7184 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e8 00 00 00       	call   800119 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	eb 22                	jmp    800063 <primeproc+0x30>
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  800041:	8b 42 5c             	mov    0x5c(%edx),%eax
+  800044:	83 ec 04             	sub    $0x4,%esp
+  800047:	53                   	push   %ebx
+  800048:	50                   	push   %eax
+  800049:	68 c0 33 80 00       	push   $0x8033c0
+  80004e:	e8 65 02 00 00       	call   8002b8 <cprintf>
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  800053:	e8 8b 1c 00 00       	call   801ce3 <fork>
+  800058:	89 c7                	mov    %eax,%edi
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 39                	js     80009a <primeproc+0x67>
+		panic("fork: %e", id);
+	if (id == 0)
+  800061:	75 49                	jne    8000ac <primeproc+0x79>
+	p = ipc_recv(&envid, 0, 0);
+  800063:	83 ec 04             	sub    $0x4,%esp
+  800066:	6a 00                	push   $0x0
+  800068:	6a 00                	push   $0x0
+  80006a:	56                   	push   %esi
+  80006b:	e8 b9 1d 00 00       	call   801e29 <ipc_recv>
+  800070:	89 c3                	mov    %eax,%ebx
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800072:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800074:	05 00 00 00 20       	add    $0x20000000,%eax
+  800079:	83 c4 10             	add    $0x10,%esp
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80007c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800082:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800087:	77 b8                	ja     800041 <primeproc+0xe>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800089:	c1 e8 10             	shr    $0x10,%eax
+  80008c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800092:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800098:	eb a7                	jmp    800041 <primeproc+0xe>
+		panic("fork: %e", id);
+  80009a:	50                   	push   %eax
+  80009b:	68 50 38 80 00       	push   $0x803850
+  8000a0:	6a 1a                	push   $0x1a
+  8000a2:	68 cc 33 80 00       	push   $0x8033cc
+  8000a7:	e8 31 01 00 00       	call   8001dd <_panic>
+		goto top;
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  8000ac:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000af:	83 ec 04             	sub    $0x4,%esp
+  8000b2:	6a 00                	push   $0x0
+  8000b4:	6a 00                	push   $0x0
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 6d 1d 00 00       	call   801e29 <ipc_recv>
+  8000bc:	89 c1                	mov    %eax,%ecx
+		if (i % p)
+  8000be:	99                   	cltd
+  8000bf:	f7 fb                	idiv   %ebx
+  8000c1:	83 c4 10             	add    $0x10,%esp
+  8000c4:	85 d2                	test   %edx,%edx
+  8000c6:	74 e7                	je     8000af <primeproc+0x7c>
+			ipc_send(id, i, 0, 0);
+  8000c8:	6a 00                	push   $0x0
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	51                   	push   %ecx
+  8000cd:	57                   	push   %edi
+  8000ce:	e8 6e 1d 00 00       	call   801e41 <ipc_send>
+  8000d3:	83 c4 10             	add    $0x10,%esp
+  8000d6:	eb d7                	jmp    8000af <primeproc+0x7c>
+
+008000d8 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000d8:	55                   	push   %ebp
+  8000d9:	89 e5                	mov    %esp,%ebp
+  8000db:	56                   	push   %esi
+  8000dc:	53                   	push   %ebx
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8000dd:	e8 01 1c 00 00       	call   801ce3 <fork>
+  8000e2:	89 c6                	mov    %eax,%esi
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	78 1a                	js     800102 <umain+0x2a>
+		panic("fork: %e", id);
+	if (id == 0)
+		primeproc();
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  8000e8:	bb 02 00 00 00       	mov    $0x2,%ebx
+	if (id == 0)
+  8000ed:	74 25                	je     800114 <umain+0x3c>
+		ipc_send(id, i, 0, 0);
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	53                   	push   %ebx
+  8000f4:	56                   	push   %esi
+  8000f5:	e8 47 1d 00 00       	call   801e41 <ipc_send>
+	for (i = 2; ; i++)
+  8000fa:	83 c3 01             	add    $0x1,%ebx
+  8000fd:	83 c4 10             	add    $0x10,%esp
+  800100:	eb ed                	jmp    8000ef <umain+0x17>
+		panic("fork: %e", id);
+  800102:	50                   	push   %eax
+  800103:	68 50 38 80 00       	push   $0x803850
+  800108:	6a 2d                	push   $0x2d
+  80010a:	68 cc 33 80 00       	push   $0x8033cc
+  80010f:	e8 c9 00 00 00       	call   8001dd <_panic>
+		primeproc();
+  800114:	e8 1a ff ff ff       	call   800033 <primeproc>
+
+00800119 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800119:	55                   	push   %ebp
+  80011a:	89 e5                	mov    %esp,%ebp
+  80011c:	57                   	push   %edi
+  80011d:	56                   	push   %esi
+  80011e:	53                   	push   %ebx
+  80011f:	83 ec 0c             	sub    $0xc,%esp
+  800122:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800125:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800128:	b8 01 00 00 00       	mov    $0x1,%eax
+  80012d:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80012f:	c1 ea 0b             	shr    $0xb,%edx
+  800132:	83 f2 01             	xor    $0x1,%edx
+  800135:	83 e2 01             	and    $0x1,%edx
+  800138:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80013e:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800145:	00 00 00 
+	envid = sys_getenvid();
+  800148:	e8 1f 0c 00 00       	call   800d6c <sys_getenvid>
+  80014d:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80014f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800154:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80015a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800160:	8b 52 48             	mov    0x48(%edx),%edx
+  800163:	39 ca                	cmp    %ecx,%edx
+  800165:	74 27                	je     80018e <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800167:	83 c0 01             	add    $0x1,%eax
+  80016a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80016f:	75 e3                	jne    800154 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800171:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800178:	75 24                	jne    80019e <libmain+0x85>
+		panic("libmain can't find the environment");
+  80017a:	83 ec 04             	sub    $0x4,%esp
+  80017d:	68 dc 33 80 00       	push   $0x8033dc
+  800182:	6a 23                	push   $0x23
+  800184:	68 ff 33 80 00       	push   $0x8033ff
+  800189:	e8 4f 00 00 00       	call   8001dd <_panic>
+			mainenv = &envs[i];
+  80018e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800194:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800199:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80019e:	85 ff                	test   %edi,%edi
+  8001a0:	7e 07                	jle    8001a9 <libmain+0x90>
+		binaryname = argv[0];
+  8001a2:	8b 06                	mov    (%esi),%eax
+  8001a4:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001a9:	83 ec 08             	sub    $0x8,%esp
+  8001ac:	56                   	push   %esi
+  8001ad:	57                   	push   %edi
+  8001ae:	e8 25 ff ff ff       	call   8000d8 <umain>
+
+	// exit gracefully
+	exit();
+  8001b3:	e8 0b 00 00 00       	call   8001c3 <exit>
+}
+  8001b8:	83 c4 10             	add    $0x10,%esp
+  8001bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001be:	5b                   	pop    %ebx
+  8001bf:	5e                   	pop    %esi
+  8001c0:	5f                   	pop    %edi
+  8001c1:	5d                   	pop    %ebp
+  8001c2:	c3                   	ret
+
+008001c3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c3:	55                   	push   %ebp
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001c9:	e8 1c 21 00 00       	call   8022ea <close_all>
+	sys_env_destroy(0);
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	6a 00                	push   $0x0
+  8001d3:	e8 2b 0b 00 00       	call   800d03 <sys_env_destroy>
+}
+  8001d8:	83 c4 10             	add    $0x10,%esp
+  8001db:	c9                   	leave
+  8001dc:	c3                   	ret
+
+008001dd <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	56                   	push   %esi
+  8001e1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001e2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001e5:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001eb:	e8 7c 0b 00 00       	call   800d6c <sys_getenvid>
+  8001f0:	83 ec 0c             	sub    $0xc,%esp
+  8001f3:	ff 75 0c             	push   0xc(%ebp)
+  8001f6:	ff 75 08             	push   0x8(%ebp)
+  8001f9:	56                   	push   %esi
+  8001fa:	50                   	push   %eax
+  8001fb:	68 18 34 80 00       	push   $0x803418
+  800200:	e8 b3 00 00 00       	call   8002b8 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800205:	83 c4 18             	add    $0x18,%esp
+  800208:	53                   	push   %ebx
+  800209:	ff 75 10             	push   0x10(%ebp)
+  80020c:	e8 56 00 00 00       	call   800267 <vcprintf>
+	cprintf("\n");
+  800211:	c7 04 24 af 39 80 00 	movl   $0x8039af,(%esp)
+  800218:	e8 9b 00 00 00       	call   8002b8 <cprintf>
+  80021d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800220:	cc                   	int3
+	while (1)
+  800221:	eb fd                	jmp    800220 <_panic+0x43>
+
+00800223 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800223:	55                   	push   %ebp
+  800224:	89 e5                	mov    %esp,%ebp
+  800226:	53                   	push   %ebx
+  800227:	83 ec 04             	sub    $0x4,%esp
+  80022a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80022d:	8b 13                	mov    (%ebx),%edx
+  80022f:	8d 42 01             	lea    0x1(%edx),%eax
+  800232:	89 03                	mov    %eax,(%ebx)
+  800234:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800237:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80023b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800240:	74 09                	je     80024b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800242:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800246:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800249:	c9                   	leave
+  80024a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80024b:	83 ec 08             	sub    $0x8,%esp
+  80024e:	68 ff 00 00 00       	push   $0xff
+  800253:	8d 43 08             	lea    0x8(%ebx),%eax
+  800256:	50                   	push   %eax
+  800257:	e8 1d 0a 00 00       	call   800c79 <sys_cputs>
+		b->idx = 0;
+  80025c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800262:	83 c4 10             	add    $0x10,%esp
+  800265:	eb db                	jmp    800242 <putch+0x1f>
+
+00800267 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800267:	55                   	push   %ebp
+  800268:	89 e5                	mov    %esp,%ebp
+  80026a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800270:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800277:	00 00 00 
+	b.cnt = 0;
+  80027a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800281:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800284:	ff 75 0c             	push   0xc(%ebp)
+  800287:	ff 75 08             	push   0x8(%ebp)
+  80028a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800290:	50                   	push   %eax
+  800291:	68 23 02 80 00       	push   $0x800223
+  800296:	e8 fb 00 00 00       	call   800396 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80029b:	83 c4 08             	add    $0x8,%esp
+  80029e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002a4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	e8 c9 09 00 00       	call   800c79 <sys_cputs>
+
+	return b.cnt;
+}
+  8002b0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b6:	c9                   	leave
+  8002b7:	c3                   	ret
+
+008002b8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002be:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002c1:	50                   	push   %eax
+  8002c2:	ff 75 08             	push   0x8(%ebp)
+  8002c5:	e8 9d ff ff ff       	call   800267 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002ca:	c9                   	leave
+  8002cb:	c3                   	ret
+
+008002cc <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	57                   	push   %edi
+  8002d0:	56                   	push   %esi
+  8002d1:	53                   	push   %ebx
+  8002d2:	83 ec 1c             	sub    $0x1c,%esp
+  8002d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002d8:	89 d6                	mov    %edx,%esi
+  8002da:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002e0:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002e3:	73 0b                	jae    8002f0 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002e8:	c1 e7 08             	shl    $0x8,%edi
+  8002eb:	0b 7d 10             	or     0x10(%ebp),%edi
+  8002ee:	eb 36                	jmp    800326 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8002f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002f8:	f7 75 08             	divl   0x8(%ebp)
+  8002fb:	89 c1                	mov    %eax,%ecx
+  8002fd:	ff 75 14             	push   0x14(%ebp)
+  800300:	ff 75 10             	push   0x10(%ebp)
+  800303:	83 eb 01             	sub    $0x1,%ebx
+  800306:	53                   	push   %ebx
+  800307:	ff 75 08             	push   0x8(%ebp)
+  80030a:	89 f2                	mov    %esi,%edx
+  80030c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80030f:	e8 b8 ff ff ff       	call   8002cc <printnum>
+  800314:	83 c4 10             	add    $0x10,%esp
+  800317:	eb 14                	jmp    80032d <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800319:	83 ec 08             	sub    $0x8,%esp
+  80031c:	56                   	push   %esi
+  80031d:	57                   	push   %edi
+  80031e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800321:	ff d0                	call   *%eax
+  800323:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800326:	83 eb 01             	sub    $0x1,%ebx
+  800329:	85 db                	test   %ebx,%ebx
+  80032b:	7f ec                	jg     800319 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80032d:	83 ec 08             	sub    $0x8,%esp
+  800330:	56                   	push   %esi
+  800331:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800334:	ba 00 00 00 00       	mov    $0x0,%edx
+  800339:	f7 75 08             	divl   0x8(%ebp)
+  80033c:	0f be 92 3b 34 80 00 	movsbl 0x80343b(%edx),%edx
+  800343:	8b 45 14             	mov    0x14(%ebp),%eax
+  800346:	c1 e0 08             	shl    $0x8,%eax
+  800349:	09 d0                	or     %edx,%eax
+  80034b:	50                   	push   %eax
+  80034c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80034f:	ff d0                	call   *%eax
+}
+  800351:	83 c4 10             	add    $0x10,%esp
+  800354:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800357:	5b                   	pop    %ebx
+  800358:	5e                   	pop    %esi
+  800359:	5f                   	pop    %edi
+  80035a:	5d                   	pop    %ebp
+  80035b:	c3                   	ret
+
+0080035c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80035c:	55                   	push   %ebp
+  80035d:	89 e5                	mov    %esp,%ebp
+  80035f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800362:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800366:	8b 10                	mov    (%eax),%edx
+  800368:	3b 50 04             	cmp    0x4(%eax),%edx
+  80036b:	73 0a                	jae    800377 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80036d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800370:	89 08                	mov    %ecx,(%eax)
+  800372:	8b 45 08             	mov    0x8(%ebp),%eax
+  800375:	88 02                	mov    %al,(%edx)
+}
+  800377:	5d                   	pop    %ebp
+  800378:	c3                   	ret
+
+00800379 <printfmt>:
+{
+  800379:	55                   	push   %ebp
+  80037a:	89 e5                	mov    %esp,%ebp
+  80037c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80037f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800382:	50                   	push   %eax
+  800383:	ff 75 10             	push   0x10(%ebp)
+  800386:	ff 75 0c             	push   0xc(%ebp)
+  800389:	ff 75 08             	push   0x8(%ebp)
+  80038c:	e8 05 00 00 00       	call   800396 <vprintfmt>
+}
+  800391:	83 c4 10             	add    $0x10,%esp
+  800394:	c9                   	leave
+  800395:	c3                   	ret
+
+00800396 <vprintfmt>:
+{
+  800396:	55                   	push   %ebp
+  800397:	89 e5                	mov    %esp,%ebp
+  800399:	57                   	push   %edi
+  80039a:	56                   	push   %esi
+  80039b:	53                   	push   %ebx
+  80039c:	83 ec 3c             	sub    $0x3c,%esp
+  80039f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8003a2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8003a5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003ac:	eb 16                	jmp    8003c4 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8003ae:	83 ec 08             	sub    $0x8,%esp
+  8003b1:	ff 75 0c             	push   0xc(%ebp)
+  8003b4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003b7:	c1 e2 08             	shl    $0x8,%edx
+  8003ba:	09 d0                	or     %edx,%eax
+  8003bc:	50                   	push   %eax
+  8003bd:	ff d7                	call   *%edi
+  8003bf:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003c2:	89 de                	mov    %ebx,%esi
+  8003c4:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003c7:	0f b6 06             	movzbl (%esi),%eax
+  8003ca:	83 f8 25             	cmp    $0x25,%eax
+  8003cd:	74 0c                	je     8003db <vprintfmt+0x45>
+			if (ch == '\0')
+  8003cf:	85 c0                	test   %eax,%eax
+  8003d1:	75 db                	jne    8003ae <vprintfmt+0x18>
+}
+  8003d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d6:	5b                   	pop    %ebx
+  8003d7:	5e                   	pop    %esi
+  8003d8:	5f                   	pop    %edi
+  8003d9:	5d                   	pop    %ebp
+  8003da:	c3                   	ret
+		padc = ' ';
+  8003db:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003df:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003e6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003ed:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f9:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003fc:	0f b6 13             	movzbl (%ebx),%edx
+  8003ff:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800402:	3c 55                	cmp    $0x55,%al
+  800404:	0f 87 2c 04 00 00    	ja     800836 <vprintfmt+0x4a0>
+  80040a:	0f b6 c0             	movzbl %al,%eax
+  80040d:	ff 24 85 80 35 80 00 	jmp    *0x803580(,%eax,4)
+  800414:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800416:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80041a:	eb dd                	jmp    8003f9 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80041c:	89 f3                	mov    %esi,%ebx
+  80041e:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800422:	eb d5                	jmp    8003f9 <vprintfmt+0x63>
+  800424:	0f b6 d2             	movzbl %dl,%edx
+  800427:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800429:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80042e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800431:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800435:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800438:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80043b:	83 fe 09             	cmp    $0x9,%esi
+  80043e:	0f 87 8a 00 00 00    	ja     8004ce <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800444:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800447:	eb e5                	jmp    80042e <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800449:	8b 45 14             	mov    0x14(%ebp),%eax
+  80044c:	8b 00                	mov    (%eax),%eax
+  80044e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800451:	8b 45 14             	mov    0x14(%ebp),%eax
+  800454:	8d 40 04             	lea    0x4(%eax),%eax
+  800457:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80045a:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80045c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800460:	79 97                	jns    8003f9 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800462:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800465:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800468:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80046f:	eb 88                	jmp    8003f9 <vprintfmt+0x63>
+			if (width < 0)
+  800471:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800474:	85 db                	test   %ebx,%ebx
+  800476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047b:	0f 49 c3             	cmovns %ebx,%eax
+  80047e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800481:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800483:	e9 71 ff ff ff       	jmp    8003f9 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800488:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80048a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800491:	e9 63 ff ff ff       	jmp    8003f9 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800496:	8d 73 02             	lea    0x2(%ebx),%esi
+  800499:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80049d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8004a4:	3c 67                	cmp    $0x67,%al
+  8004a6:	0f 84 18 ff ff ff    	je     8003c4 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8004ac:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8004b3:	3c 72                	cmp    $0x72,%al
+  8004b5:	0f 84 09 ff ff ff    	je     8003c4 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004bb:	3c 62                	cmp    $0x62,%al
+  8004bd:	0f 94 c0             	sete   %al
+  8004c0:	0f b6 c0             	movzbl %al,%eax
+  8004c3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004c9:	e9 f6 fe ff ff       	jmp    8003c4 <vprintfmt+0x2e>
+  8004ce:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004d1:	eb 89                	jmp    80045c <vprintfmt+0xc6>
+			lflag++;
+  8004d3:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d6:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004d8:	e9 1c ff ff ff       	jmp    8003f9 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e0:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004e3:	83 ec 08             	sub    $0x8,%esp
+  8004e6:	ff 75 0c             	push   0xc(%ebp)
+  8004e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004ec:	c1 e0 08             	shl    $0x8,%eax
+  8004ef:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8004f2:	0b 01                	or     (%ecx),%eax
+  8004f4:	50                   	push   %eax
+  8004f5:	ff d7                	call   *%edi
+			break;
+  8004f7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004fa:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004fd:	e9 c2 fe ff ff       	jmp    8003c4 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800502:	8b 45 14             	mov    0x14(%ebp),%eax
+  800505:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800508:	8b 10                	mov    (%eax),%edx
+  80050a:	89 d0                	mov    %edx,%eax
+  80050c:	f7 d8                	neg    %eax
+  80050e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800511:	83 f8 12             	cmp    $0x12,%eax
+  800514:	7f 25                	jg     80053b <vprintfmt+0x1a5>
+  800516:	8b 14 85 e0 36 80 00 	mov    0x8036e0(,%eax,4),%edx
+  80051d:	85 d2                	test   %edx,%edx
+  80051f:	74 1a                	je     80053b <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800521:	52                   	push   %edx
+  800522:	68 22 38 80 00       	push   $0x803822
+  800527:	ff 75 0c             	push   0xc(%ebp)
+  80052a:	57                   	push   %edi
+  80052b:	e8 49 fe ff ff       	call   800379 <printfmt>
+  800530:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800533:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800536:	e9 89 fe ff ff       	jmp    8003c4 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80053b:	50                   	push   %eax
+  80053c:	68 53 34 80 00       	push   $0x803453
+  800541:	ff 75 0c             	push   0xc(%ebp)
+  800544:	57                   	push   %edi
+  800545:	e8 2f fe ff ff       	call   800379 <printfmt>
+  80054a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80054d:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800550:	e9 6f fe ff ff       	jmp    8003c4 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800555:	8b 45 14             	mov    0x14(%ebp),%eax
+  800558:	83 c0 04             	add    $0x4,%eax
+  80055b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80055e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800561:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800563:	85 c9                	test   %ecx,%ecx
+  800565:	b8 4c 34 80 00       	mov    $0x80344c,%eax
+  80056a:	0f 45 c1             	cmovne %ecx,%eax
+  80056d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800570:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800574:	7e 06                	jle    80057c <vprintfmt+0x1e6>
+  800576:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80057a:	75 1a                	jne    800596 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80057c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80057f:	c1 e0 08             	shl    $0x8,%eax
+  800582:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800585:	83 c8 3f             	or     $0x3f,%eax
+  800588:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80058b:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80058e:	89 75 10             	mov    %esi,0x10(%ebp)
+  800591:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800594:	eb 6d                	jmp    800603 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800596:	83 ec 08             	sub    $0x8,%esp
+  800599:	ff 75 d0             	push   -0x30(%ebp)
+  80059c:	ff 75 c8             	push   -0x38(%ebp)
+  80059f:	e8 39 03 00 00       	call   8008dd <strnlen>
+  8005a4:	89 c2                	mov    %eax,%edx
+  8005a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a9:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8005ab:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005ae:	c1 e1 08             	shl    $0x8,%ecx
+  8005b1:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8005b5:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005b7:	83 c4 10             	add    $0x10,%esp
+  8005ba:	89 c3                	mov    %eax,%ebx
+  8005bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005bf:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005c2:	89 ce                	mov    %ecx,%esi
+  8005c4:	eb 0f                	jmp    8005d5 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005c6:	83 ec 08             	sub    $0x8,%esp
+  8005c9:	ff 75 0c             	push   0xc(%ebp)
+  8005cc:	56                   	push   %esi
+  8005cd:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cf:	83 eb 01             	sub    $0x1,%ebx
+  8005d2:	83 c4 10             	add    $0x10,%esp
+  8005d5:	85 db                	test   %ebx,%ebx
+  8005d7:	7f ed                	jg     8005c6 <vprintfmt+0x230>
+  8005d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005dc:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005df:	85 c0                	test   %eax,%eax
+  8005e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e6:	0f 49 d0             	cmovns %eax,%edx
+  8005e9:	29 d0                	sub    %edx,%eax
+  8005eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ee:	eb 8c                	jmp    80057c <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8005f0:	83 ec 08             	sub    $0x8,%esp
+  8005f3:	ff 75 0c             	push   0xc(%ebp)
+  8005f6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005f9:	09 c2                	or     %eax,%edx
+  8005fb:	52                   	push   %edx
+  8005fc:	ff d7                	call   *%edi
+  8005fe:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800601:	89 d9                	mov    %ebx,%ecx
+  800603:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800606:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80060a:	0f be d0             	movsbl %al,%edx
+  80060d:	85 d2                	test   %edx,%edx
+  80060f:	74 2a                	je     80063b <vprintfmt+0x2a5>
+  800611:	85 f6                	test   %esi,%esi
+  800613:	78 05                	js     80061a <vprintfmt+0x284>
+  800615:	83 ee 01             	sub    $0x1,%esi
+  800618:	78 3b                	js     800655 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80061a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80061e:	74 d0                	je     8005f0 <vprintfmt+0x25a>
+  800620:	0f be c0             	movsbl %al,%eax
+  800623:	83 e8 20             	sub    $0x20,%eax
+  800626:	83 f8 5e             	cmp    $0x5e,%eax
+  800629:	76 c5                	jbe    8005f0 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80062b:	83 ec 08             	sub    $0x8,%esp
+  80062e:	ff 75 0c             	push   0xc(%ebp)
+  800631:	ff 75 cc             	push   -0x34(%ebp)
+  800634:	ff d7                	call   *%edi
+  800636:	83 c4 10             	add    $0x10,%esp
+  800639:	eb c6                	jmp    800601 <vprintfmt+0x26b>
+  80063b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80063e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800641:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800644:	01 c3                	add    %eax,%ebx
+  800646:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800648:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80064b:	83 c8 20             	or     $0x20,%eax
+  80064e:	89 75 10             	mov    %esi,0x10(%ebp)
+  800651:	89 c6                	mov    %eax,%esi
+  800653:	eb 14                	jmp    800669 <vprintfmt+0x2d3>
+  800655:	8b 75 10             	mov    0x10(%ebp),%esi
+  800658:	eb e4                	jmp    80063e <vprintfmt+0x2a8>
+  80065a:	83 ec 08             	sub    $0x8,%esp
+  80065d:	ff 75 0c             	push   0xc(%ebp)
+  800660:	56                   	push   %esi
+  800661:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800663:	83 eb 01             	sub    $0x1,%ebx
+  800666:	83 c4 10             	add    $0x10,%esp
+  800669:	85 db                	test   %ebx,%ebx
+  80066b:	7f ed                	jg     80065a <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80066d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800670:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800673:	89 45 14             	mov    %eax,0x14(%ebp)
+  800676:	e9 49 fd ff ff       	jmp    8003c4 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80067b:	83 f9 01             	cmp    $0x1,%ecx
+  80067e:	7f 1f                	jg     80069f <vprintfmt+0x309>
+	else if (lflag)
+  800680:	85 c9                	test   %ecx,%ecx
+  800682:	74 69                	je     8006ed <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 00                	mov    (%eax),%eax
+  800689:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80068c:	89 c1                	mov    %eax,%ecx
+  80068e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800691:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8d 40 04             	lea    0x4(%eax),%eax
+  80069a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069d:	eb 17                	jmp    8006b6 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80069f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a2:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a5:	8b 00                	mov    (%eax),%eax
+  8006a7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006aa:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006b6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006b9:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006c1:	85 db                	test   %ebx,%ebx
+  8006c3:	0f 89 f6 00 00 00    	jns    8007bf <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006c9:	83 ec 08             	sub    $0x8,%esp
+  8006cc:	ff 75 0c             	push   0xc(%ebp)
+  8006cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006d2:	c1 e0 08             	shl    $0x8,%eax
+  8006d5:	83 c8 2d             	or     $0x2d,%eax
+  8006d8:	50                   	push   %eax
+  8006d9:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006db:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006de:	f7 d9                	neg    %ecx
+  8006e0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006e8:	e9 d2 00 00 00       	jmp    8007bf <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 00                	mov    (%eax),%eax
+  8006f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f5:	89 c1                	mov    %eax,%ecx
+  8006f7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006fa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800700:	8d 40 04             	lea    0x4(%eax),%eax
+  800703:	89 45 14             	mov    %eax,0x14(%ebp)
+  800706:	eb ae                	jmp    8006b6 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800708:	83 f9 01             	cmp    $0x1,%ecx
+  80070b:	7f 19                	jg     800726 <vprintfmt+0x390>
+	else if (lflag)
+  80070d:	85 c9                	test   %ecx,%ecx
+  80070f:	74 2a                	je     80073b <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8b 08                	mov    (%eax),%ecx
+  800716:	8d 40 04             	lea    0x4(%eax),%eax
+  800719:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80071c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800721:	e9 99 00 00 00       	jmp    8007bf <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 08                	mov    (%eax),%ecx
+  80072b:	8d 40 08             	lea    0x8(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800731:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800736:	e9 84 00 00 00       	jmp    8007bf <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80073b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073e:	8b 08                	mov    (%eax),%ecx
+  800740:	8d 40 04             	lea    0x4(%eax),%eax
+  800743:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800746:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  80074b:	eb 72                	jmp    8007bf <vprintfmt+0x429>
+	if (lflag >= 2)
+  80074d:	83 f9 01             	cmp    $0x1,%ecx
+  800750:	7f 16                	jg     800768 <vprintfmt+0x3d2>
+	else if (lflag)
+  800752:	85 c9                	test   %ecx,%ecx
+  800754:	74 24                	je     80077a <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	8b 08                	mov    (%eax),%ecx
+  80075b:	8d 40 04             	lea    0x4(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800761:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800766:	eb 57                	jmp    8007bf <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 08                	mov    (%eax),%ecx
+  80076d:	8d 40 08             	lea    0x8(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800773:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800778:	eb 45                	jmp    8007bf <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 08                	mov    (%eax),%ecx
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800785:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80078a:	eb 33                	jmp    8007bf <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  80078c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80078f:	c1 e3 08             	shl    $0x8,%ebx
+  800792:	83 ec 08             	sub    $0x8,%esp
+  800795:	ff 75 0c             	push   0xc(%ebp)
+  800798:	89 d8                	mov    %ebx,%eax
+  80079a:	83 c8 30             	or     $0x30,%eax
+  80079d:	50                   	push   %eax
+  80079e:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8007a0:	83 c4 08             	add    $0x8,%esp
+  8007a3:	ff 75 0c             	push   0xc(%ebp)
+  8007a6:	83 cb 78             	or     $0x78,%ebx
+  8007a9:	53                   	push   %ebx
+  8007aa:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007af:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8007b1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ba:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8007c2:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007c6:	52                   	push   %edx
+  8007c7:	ff 75 e0             	push   -0x20(%ebp)
+  8007ca:	50                   	push   %eax
+  8007cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ce:	89 f8                	mov    %edi,%eax
+  8007d0:	e8 f7 fa ff ff       	call   8002cc <printnum>
+			break;
+  8007d5:	83 c4 10             	add    $0x10,%esp
+  8007d8:	e9 e7 fb ff ff       	jmp    8003c4 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007dd:	83 f9 01             	cmp    $0x1,%ecx
+  8007e0:	7f 16                	jg     8007f8 <vprintfmt+0x462>
+	else if (lflag)
+  8007e2:	85 c9                	test   %ecx,%ecx
+  8007e4:	74 24                	je     80080a <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 08                	mov    (%eax),%ecx
+  8007eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f1:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8007f6:	eb c7                	jmp    8007bf <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fb:	8b 08                	mov    (%eax),%ecx
+  8007fd:	8d 40 08             	lea    0x8(%eax),%eax
+  800800:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800803:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800808:	eb b5                	jmp    8007bf <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80080a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080d:	8b 08                	mov    (%eax),%ecx
+  80080f:	8d 40 04             	lea    0x4(%eax),%eax
+  800812:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800815:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80081a:	eb a3                	jmp    8007bf <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80081c:	83 ec 08             	sub    $0x8,%esp
+  80081f:	ff 75 0c             	push   0xc(%ebp)
+  800822:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800825:	c1 e0 08             	shl    $0x8,%eax
+  800828:	83 c8 25             	or     $0x25,%eax
+  80082b:	50                   	push   %eax
+  80082c:	ff d7                	call   *%edi
+			break;
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	e9 8e fb ff ff       	jmp    8003c4 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800836:	83 ec 08             	sub    $0x8,%esp
+  800839:	ff 75 0c             	push   0xc(%ebp)
+  80083c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80083f:	c1 e0 08             	shl    $0x8,%eax
+  800842:	83 c8 25             	or     $0x25,%eax
+  800845:	50                   	push   %eax
+  800846:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800848:	83 c4 10             	add    $0x10,%esp
+  80084b:	89 de                	mov    %ebx,%esi
+  80084d:	eb 03                	jmp    800852 <vprintfmt+0x4bc>
+  80084f:	83 ee 01             	sub    $0x1,%esi
+  800852:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800856:	75 f7                	jne    80084f <vprintfmt+0x4b9>
+  800858:	e9 67 fb ff ff       	jmp    8003c4 <vprintfmt+0x2e>
+
+0080085d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	83 ec 18             	sub    $0x18,%esp
+  800863:	8b 45 08             	mov    0x8(%ebp),%eax
+  800866:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800869:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80086c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800870:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800873:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80087a:	85 c0                	test   %eax,%eax
+  80087c:	74 26                	je     8008a4 <vsnprintf+0x47>
+  80087e:	85 d2                	test   %edx,%edx
+  800880:	7e 22                	jle    8008a4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800882:	ff 75 14             	push   0x14(%ebp)
+  800885:	ff 75 10             	push   0x10(%ebp)
+  800888:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80088b:	50                   	push   %eax
+  80088c:	68 5c 03 80 00       	push   $0x80035c
+  800891:	e8 00 fb ff ff       	call   800396 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800896:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800899:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80089c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80089f:	83 c4 10             	add    $0x10,%esp
+}
+  8008a2:	c9                   	leave
+  8008a3:	c3                   	ret
+		return -E_INVAL;
+  8008a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a9:	eb f7                	jmp    8008a2 <vsnprintf+0x45>
+
+008008ab <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008ab:	55                   	push   %ebp
+  8008ac:	89 e5                	mov    %esp,%ebp
+  8008ae:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8008b1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008b4:	50                   	push   %eax
+  8008b5:	ff 75 10             	push   0x10(%ebp)
+  8008b8:	ff 75 0c             	push   0xc(%ebp)
+  8008bb:	ff 75 08             	push   0x8(%ebp)
+  8008be:	e8 9a ff ff ff       	call   80085d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008c3:	c9                   	leave
+  8008c4:	c3                   	ret
+
+008008c5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008c5:	55                   	push   %ebp
+  8008c6:	89 e5                	mov    %esp,%ebp
+  8008c8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	eb 03                	jmp    8008d5 <strlen+0x10>
+		n++;
+  8008d2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008d5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d9:	75 f7                	jne    8008d2 <strlen+0xd>
+	return n;
+}
+  8008db:	5d                   	pop    %ebp
+  8008dc:	c3                   	ret
+
+008008dd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	eb 03                	jmp    8008f0 <strnlen+0x13>
+		n++;
+  8008ed:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f0:	39 d0                	cmp    %edx,%eax
+  8008f2:	74 08                	je     8008fc <strnlen+0x1f>
+  8008f4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008f8:	75 f3                	jne    8008ed <strnlen+0x10>
+  8008fa:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008fc:	89 d0                	mov    %edx,%eax
+  8008fe:	5d                   	pop    %ebp
+  8008ff:	c3                   	ret
+
+00800900 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800900:	55                   	push   %ebp
+  800901:	89 e5                	mov    %esp,%ebp
+  800903:	53                   	push   %ebx
+  800904:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800907:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80090a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800913:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800916:	83 c0 01             	add    $0x1,%eax
+  800919:	84 d2                	test   %dl,%dl
+  80091b:	75 f2                	jne    80090f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80091d:	89 c8                	mov    %ecx,%eax
+  80091f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+
+00800924 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	53                   	push   %ebx
+  800928:	83 ec 10             	sub    $0x10,%esp
+  80092b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80092e:	53                   	push   %ebx
+  80092f:	e8 91 ff ff ff       	call   8008c5 <strlen>
+  800934:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800937:	ff 75 0c             	push   0xc(%ebp)
+  80093a:	01 d8                	add    %ebx,%eax
+  80093c:	50                   	push   %eax
+  80093d:	e8 be ff ff ff       	call   800900 <strcpy>
+	return dst;
+}
+  800942:	89 d8                	mov    %ebx,%eax
+  800944:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+00800949 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	56                   	push   %esi
+  80094d:	53                   	push   %ebx
+  80094e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800951:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800954:	89 f3                	mov    %esi,%ebx
+  800956:	03 5d 10             	add    0x10(%ebp),%ebx
+  800959:	89 f0                	mov    %esi,%eax
+  80095b:	eb 0f                	jmp    80096c <strncpy+0x23>
+		*dst++ = *src;
+  80095d:	83 c0 01             	add    $0x1,%eax
+  800960:	0f b6 0a             	movzbl (%edx),%ecx
+  800963:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800966:	80 f9 01             	cmp    $0x1,%cl
+  800969:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80096c:	39 d8                	cmp    %ebx,%eax
+  80096e:	75 ed                	jne    80095d <strncpy+0x14>
+	}
+	return ret;
+}
+  800970:	89 f0                	mov    %esi,%eax
+  800972:	5b                   	pop    %ebx
+  800973:	5e                   	pop    %esi
+  800974:	5d                   	pop    %ebp
+  800975:	c3                   	ret
+
+00800976 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	56                   	push   %esi
+  80097a:	53                   	push   %ebx
+  80097b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80097e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800981:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	85 d2                	test   %edx,%edx
+  800988:	74 21                	je     8009ab <strlcpy+0x35>
+  80098a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80098e:	89 f2                	mov    %esi,%edx
+  800990:	eb 09                	jmp    80099b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800992:	83 c1 01             	add    $0x1,%ecx
+  800995:	83 c2 01             	add    $0x1,%edx
+  800998:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80099b:	39 c2                	cmp    %eax,%edx
+  80099d:	74 09                	je     8009a8 <strlcpy+0x32>
+  80099f:	0f b6 19             	movzbl (%ecx),%ebx
+  8009a2:	84 db                	test   %bl,%bl
+  8009a4:	75 ec                	jne    800992 <strlcpy+0x1c>
+  8009a6:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009a8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009ab:	29 f0                	sub    %esi,%eax
+}
+  8009ad:	5b                   	pop    %ebx
+  8009ae:	5e                   	pop    %esi
+  8009af:	5d                   	pop    %ebp
+  8009b0:	c3                   	ret
+
+008009b1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009ba:	eb 06                	jmp    8009c2 <strcmp+0x11>
+		p++, q++;
+  8009bc:	83 c1 01             	add    $0x1,%ecx
+  8009bf:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009c2:	0f b6 01             	movzbl (%ecx),%eax
+  8009c5:	84 c0                	test   %al,%al
+  8009c7:	74 04                	je     8009cd <strcmp+0x1c>
+  8009c9:	3a 02                	cmp    (%edx),%al
+  8009cb:	74 ef                	je     8009bc <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009cd:	0f b6 c0             	movzbl %al,%eax
+  8009d0:	0f b6 12             	movzbl (%edx),%edx
+  8009d3:	29 d0                	sub    %edx,%eax
+}
+  8009d5:	5d                   	pop    %ebp
+  8009d6:	c3                   	ret
+
+008009d7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	53                   	push   %ebx
+  8009db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009e4:	eb 09                	jmp    8009ef <strncmp+0x18>
+		n--, p++, q++;
+  8009e6:	83 ea 01             	sub    $0x1,%edx
+  8009e9:	83 c0 01             	add    $0x1,%eax
+  8009ec:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009ef:	85 d2                	test   %edx,%edx
+  8009f1:	74 18                	je     800a0b <strncmp+0x34>
+  8009f3:	0f b6 18             	movzbl (%eax),%ebx
+  8009f6:	84 db                	test   %bl,%bl
+  8009f8:	74 04                	je     8009fe <strncmp+0x27>
+  8009fa:	3a 19                	cmp    (%ecx),%bl
+  8009fc:	74 e8                	je     8009e6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009fe:	0f b6 00             	movzbl (%eax),%eax
+  800a01:	0f b6 11             	movzbl (%ecx),%edx
+  800a04:	29 d0                	sub    %edx,%eax
+}
+  800a06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a09:	c9                   	leave
+  800a0a:	c3                   	ret
+		return 0;
+  800a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a10:	eb f4                	jmp    800a06 <strncmp+0x2f>
+
+00800a12 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a1c:	eb 03                	jmp    800a21 <strchr+0xf>
+  800a1e:	83 c0 01             	add    $0x1,%eax
+  800a21:	0f b6 10             	movzbl (%eax),%edx
+  800a24:	84 d2                	test   %dl,%dl
+  800a26:	74 06                	je     800a2e <strchr+0x1c>
+		if (*s == c)
+  800a28:	38 ca                	cmp    %cl,%dl
+  800a2a:	75 f2                	jne    800a1e <strchr+0xc>
+  800a2c:	eb 05                	jmp    800a33 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a33:	5d                   	pop    %ebp
+  800a34:	c3                   	ret
+
+00800a35 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a3f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a42:	38 ca                	cmp    %cl,%dl
+  800a44:	74 09                	je     800a4f <strfind+0x1a>
+  800a46:	84 d2                	test   %dl,%dl
+  800a48:	74 05                	je     800a4f <strfind+0x1a>
+	for (; *s; s++)
+  800a4a:	83 c0 01             	add    $0x1,%eax
+  800a4d:	eb f0                	jmp    800a3f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a4f:	5d                   	pop    %ebp
+  800a50:	c3                   	ret
+
+00800a51 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	57                   	push   %edi
+  800a55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a58:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a5b:	85 c9                	test   %ecx,%ecx
+  800a5d:	74 20                	je     800a7f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a5f:	89 f8                	mov    %edi,%eax
+  800a61:	09 c8                	or     %ecx,%eax
+  800a63:	a8 03                	test   $0x3,%al
+  800a65:	75 12                	jne    800a79 <memset+0x28>
+		c &= 0xFF;
+  800a67:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a6b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a71:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a74:	fc                   	cld
+  800a75:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a77:	eb 06                	jmp    800a7f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a7c:	fc                   	cld
+  800a7d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a7f:	89 f8                	mov    %edi,%eax
+  800a81:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+
+00800a86 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a86:	55                   	push   %ebp
+  800a87:	89 e5                	mov    %esp,%ebp
+  800a89:	57                   	push   %edi
+  800a8a:	56                   	push   %esi
+  800a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a94:	39 c6                	cmp    %eax,%esi
+  800a96:	73 32                	jae    800aca <memmove+0x44>
+  800a98:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a9b:	39 d0                	cmp    %edx,%eax
+  800a9d:	73 2b                	jae    800aca <memmove+0x44>
+		s += n;
+		d += n;
+  800a9f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa2:	89 d6                	mov    %edx,%esi
+  800aa4:	09 fe                	or     %edi,%esi
+  800aa6:	09 ce                	or     %ecx,%esi
+  800aa8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aae:	75 0e                	jne    800abe <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ab0:	83 ef 04             	sub    $0x4,%edi
+  800ab3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ab6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ab9:	fd                   	std
+  800aba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800abc:	eb 09                	jmp    800ac7 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800abe:	83 ef 01             	sub    $0x1,%edi
+  800ac1:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ac4:	fd                   	std
+  800ac5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ac7:	fc                   	cld
+  800ac8:	eb 1a                	jmp    800ae4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aca:	89 f2                	mov    %esi,%edx
+  800acc:	09 c2                	or     %eax,%edx
+  800ace:	09 ca                	or     %ecx,%edx
+  800ad0:	f6 c2 03             	test   $0x3,%dl
+  800ad3:	75 0a                	jne    800adf <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ad5:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ad8:	89 c7                	mov    %eax,%edi
+  800ada:	fc                   	cld
+  800adb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800add:	eb 05                	jmp    800ae4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800adf:	89 c7                	mov    %eax,%edi
+  800ae1:	fc                   	cld
+  800ae2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ae4:	5e                   	pop    %esi
+  800ae5:	5f                   	pop    %edi
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+
+00800ae8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aee:	ff 75 10             	push   0x10(%ebp)
+  800af1:	ff 75 0c             	push   0xc(%ebp)
+  800af4:	ff 75 08             	push   0x8(%ebp)
+  800af7:	e8 8a ff ff ff       	call   800a86 <memmove>
+}
+  800afc:	c9                   	leave
+  800afd:	c3                   	ret
+
+00800afe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	56                   	push   %esi
+  800b02:	53                   	push   %ebx
+  800b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b06:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b09:	89 c6                	mov    %eax,%esi
+  800b0b:	03 75 10             	add    0x10(%ebp),%esi
+  800b0e:	eb 06                	jmp    800b16 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b10:	83 c0 01             	add    $0x1,%eax
+  800b13:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b16:	39 f0                	cmp    %esi,%eax
+  800b18:	74 14                	je     800b2e <memcmp+0x30>
+		if (*s1 != *s2)
+  800b1a:	0f b6 08             	movzbl (%eax),%ecx
+  800b1d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b20:	38 d9                	cmp    %bl,%cl
+  800b22:	74 ec                	je     800b10 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b24:	0f b6 c1             	movzbl %cl,%eax
+  800b27:	0f b6 db             	movzbl %bl,%ebx
+  800b2a:	29 d8                	sub    %ebx,%eax
+  800b2c:	eb 05                	jmp    800b33 <memcmp+0x35>
+	}
+
+	return 0;
+  800b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b33:	5b                   	pop    %ebx
+  800b34:	5e                   	pop    %esi
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b40:	89 c2                	mov    %eax,%edx
+  800b42:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b45:	eb 03                	jmp    800b4a <memfind+0x13>
+  800b47:	83 c0 01             	add    $0x1,%eax
+  800b4a:	39 d0                	cmp    %edx,%eax
+  800b4c:	73 04                	jae    800b52 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b4e:	38 08                	cmp    %cl,(%eax)
+  800b50:	75 f5                	jne    800b47 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+
+00800b54 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	57                   	push   %edi
+  800b58:	56                   	push   %esi
+  800b59:	53                   	push   %ebx
+  800b5a:	83 ec 1c             	sub    $0x1c,%esp
+  800b5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b60:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b63:	eb 03                	jmp    800b68 <strtol+0x14>
+		s++;
+  800b65:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b68:	0f b6 06             	movzbl (%esi),%eax
+  800b6b:	3c 20                	cmp    $0x20,%al
+  800b6d:	74 f6                	je     800b65 <strtol+0x11>
+  800b6f:	3c 09                	cmp    $0x9,%al
+  800b71:	74 f2                	je     800b65 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b73:	3c 2b                	cmp    $0x2b,%al
+  800b75:	74 43                	je     800bba <strtol+0x66>
+	int neg = 0;
+  800b77:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b7c:	3c 2d                	cmp    $0x2d,%al
+  800b7e:	74 44                	je     800bc4 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b80:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b86:	75 0f                	jne    800b97 <strtol+0x43>
+  800b88:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b8b:	74 41                	je     800bce <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b8d:	85 ff                	test   %edi,%edi
+  800b8f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b94:	0f 44 f8             	cmove  %eax,%edi
+  800b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9c:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800ba1:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ba4:	89 fb                	mov    %edi,%ebx
+  800ba6:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ba9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800bac:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800baf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bb2:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800bb5:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bb8:	eb 67                	jmp    800c21 <strtol+0xcd>
+		s++;
+  800bba:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800bbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc2:	eb bc                	jmp    800b80 <strtol+0x2c>
+		s++, neg = 1;
+  800bc4:	83 c6 01             	add    $0x1,%esi
+  800bc7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bcc:	eb b2                	jmp    800b80 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bce:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800bd2:	74 0e                	je     800be2 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800bd4:	85 ff                	test   %edi,%edi
+  800bd6:	75 bf                	jne    800b97 <strtol+0x43>
+		s++, base = 8;
+  800bd8:	83 c6 01             	add    $0x1,%esi
+  800bdb:	bf 08 00 00 00       	mov    $0x8,%edi
+  800be0:	eb b5                	jmp    800b97 <strtol+0x43>
+		s += 2, base = 16;
+  800be2:	83 c6 02             	add    $0x2,%esi
+  800be5:	bf 10 00 00 00       	mov    $0x10,%edi
+  800bea:	eb ab                	jmp    800b97 <strtol+0x43>
+			dig = *s - '0';
+  800bec:	0f be c9             	movsbl %cl,%ecx
+  800bef:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800bf2:	39 f9                	cmp    %edi,%ecx
+  800bf4:	7d 59                	jge    800c4f <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800bf6:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800bfa:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bfd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c00:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c03:	0f af d8             	imul   %eax,%ebx
+  800c06:	0f af d7             	imul   %edi,%edx
+  800c09:	01 d3                	add    %edx,%ebx
+  800c0b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c0e:	f7 e7                	mul    %edi
+  800c10:	01 da                	add    %ebx,%edx
+  800c12:	89 cb                	mov    %ecx,%ebx
+  800c14:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c17:	01 c8                	add    %ecx,%eax
+  800c19:	11 da                	adc    %ebx,%edx
+  800c1b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c1e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c24:	0f b6 08             	movzbl (%eax),%ecx
+  800c27:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c2a:	80 fb 09             	cmp    $0x9,%bl
+  800c2d:	76 bd                	jbe    800bec <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c2f:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c32:	80 fb 19             	cmp    $0x19,%bl
+  800c35:	77 08                	ja     800c3f <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c37:	0f be c9             	movsbl %cl,%ecx
+  800c3a:	83 e9 57             	sub    $0x57,%ecx
+  800c3d:	eb b3                	jmp    800bf2 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c3f:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c42:	80 fb 19             	cmp    $0x19,%bl
+  800c45:	77 08                	ja     800c4f <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c47:	0f be c9             	movsbl %cl,%ecx
+  800c4a:	83 e9 37             	sub    $0x37,%ecx
+  800c4d:	eb a3                	jmp    800bf2 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c4f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c52:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c55:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c58:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c5b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c5f:	74 05                	je     800c66 <strtol+0x112>
+		*endptr = (char *) s;
+  800c61:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c64:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c66:	85 c9                	test   %ecx,%ecx
+  800c68:	74 07                	je     800c71 <strtol+0x11d>
+  800c6a:	f7 d8                	neg    %eax
+  800c6c:	83 d2 00             	adc    $0x0,%edx
+  800c6f:	f7 da                	neg    %edx
+}
+  800c71:	83 c4 1c             	add    $0x1c,%esp
+  800c74:	5b                   	pop    %ebx
+  800c75:	5e                   	pop    %esi
+  800c76:	5f                   	pop    %edi
+  800c77:	5d                   	pop    %ebp
+  800c78:	c3                   	ret
+
+00800c79 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	57                   	push   %edi
+  800c7d:	56                   	push   %esi
+  800c7e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c7f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c86:	74 18                	je     800ca0 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c93:	89 c3                	mov    %eax,%ebx
+  800c95:	89 c7                	mov    %eax,%edi
+  800c97:	89 c6                	mov    %eax,%esi
+  800c99:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c9b:	5b                   	pop    %ebx
+  800c9c:	5e                   	pop    %esi
+  800c9d:	5f                   	pop    %edi
+  800c9e:	5d                   	pop    %ebp
+  800c9f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ca0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cab:	89 c3                	mov    %eax,%ebx
+  800cad:	89 c7                	mov    %eax,%edi
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	8d 35 ba 0c 80 00    	lea    0x800cba,%esi
+  800cb8:	0f 34                	sysenter
+  800cba:	5d                   	pop    %ebp
+		goto out;
+  800cbb:	eb de                	jmp    800c9b <sys_cputs+0x22>
+
+00800cbd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cbd:	55                   	push   %ebp
+  800cbe:	89 e5                	mov    %esp,%ebp
+  800cc0:	57                   	push   %edi
+  800cc1:	56                   	push   %esi
+  800cc2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cc3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cca:	74 19                	je     800ce5 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800ccc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cd6:	89 d1                	mov    %edx,%ecx
+  800cd8:	89 d3                	mov    %edx,%ebx
+  800cda:	89 d7                	mov    %edx,%edi
+  800cdc:	89 d6                	mov    %edx,%esi
+  800cde:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ce0:	5b                   	pop    %ebx
+  800ce1:	5e                   	pop    %esi
+  800ce2:	5f                   	pop    %edi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ce5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cea:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cef:	89 d1                	mov    %edx,%ecx
+  800cf1:	89 d3                	mov    %edx,%ebx
+  800cf3:	89 d7                	mov    %edx,%edi
+  800cf5:	55                   	push   %ebp
+  800cf6:	89 e5                	mov    %esp,%ebp
+  800cf8:	8d 35 00 0d 80 00    	lea    0x800d00,%esi
+  800cfe:	0f 34                	sysenter
+  800d00:	5d                   	pop    %ebp
+		goto out;
+  800d01:	eb dd                	jmp    800ce0 <sys_cgetc+0x23>
+
+00800d03 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d03:	55                   	push   %ebp
+  800d04:	89 e5                	mov    %esp,%ebp
+  800d06:	57                   	push   %edi
+  800d07:	56                   	push   %esi
+  800d08:	53                   	push   %ebx
+  800d09:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d0c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d13:	74 21                	je     800d36 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d22:	89 cb                	mov    %ecx,%ebx
+  800d24:	89 cf                	mov    %ecx,%edi
+  800d26:	89 ce                	mov    %ecx,%esi
+  800d28:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d2a:	85 c0                	test   %eax,%eax
+  800d2c:	7f 27                	jg     800d55 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d43:	89 cb                	mov    %ecx,%ebx
+  800d45:	89 cf                	mov    %ecx,%edi
+  800d47:	55                   	push   %ebp
+  800d48:	89 e5                	mov    %esp,%ebp
+  800d4a:	8d 35 52 0d 80 00    	lea    0x800d52,%esi
+  800d50:	0f 34                	sysenter
+  800d52:	5d                   	pop    %ebp
+		goto out;
+  800d53:	eb d5                	jmp    800d2a <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d55:	83 ec 0c             	sub    $0xc,%esp
+  800d58:	50                   	push   %eax
+  800d59:	6a 03                	push   $0x3
+  800d5b:	68 4b 37 80 00       	push   $0x80374b
+  800d60:	6a 3f                	push   $0x3f
+  800d62:	68 68 37 80 00       	push   $0x803768
+  800d67:	e8 71 f4 ff ff       	call   8001dd <_panic>
+
+00800d6c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d6c:	55                   	push   %ebp
+  800d6d:	89 e5                	mov    %esp,%ebp
+  800d6f:	57                   	push   %edi
+  800d70:	56                   	push   %esi
+  800d71:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d72:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d79:	74 19                	je     800d94 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d80:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d85:	89 d1                	mov    %edx,%ecx
+  800d87:	89 d3                	mov    %edx,%ebx
+  800d89:	89 d7                	mov    %edx,%edi
+  800d8b:	89 d6                	mov    %edx,%esi
+  800d8d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d99:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d9e:	89 d1                	mov    %edx,%ecx
+  800da0:	89 d3                	mov    %edx,%ebx
+  800da2:	89 d7                	mov    %edx,%edi
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	8d 35 af 0d 80 00    	lea    0x800daf,%esi
+  800dad:	0f 34                	sysenter
+  800daf:	5d                   	pop    %ebp
+		goto out;
+  800db0:	eb dd                	jmp    800d8f <sys_getenvid+0x23>
+
+00800db2 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	56                   	push   %esi
+  800db7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800db8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dbf:	74 19                	je     800dda <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800dc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dcb:	89 d1                	mov    %edx,%ecx
+  800dcd:	89 d3                	mov    %edx,%ebx
+  800dcf:	89 d7                	mov    %edx,%edi
+  800dd1:	89 d6                	mov    %edx,%esi
+  800dd3:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dd5:	5b                   	pop    %ebx
+  800dd6:	5e                   	pop    %esi
+  800dd7:	5f                   	pop    %edi
+  800dd8:	5d                   	pop    %ebp
+  800dd9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800de4:	89 d1                	mov    %edx,%ecx
+  800de6:	89 d3                	mov    %edx,%ebx
+  800de8:	89 d7                	mov    %edx,%edi
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	8d 35 f5 0d 80 00    	lea    0x800df5,%esi
+  800df3:	0f 34                	sysenter
+  800df5:	5d                   	pop    %ebp
+		goto out;
+  800df6:	eb dd                	jmp    800dd5 <sys_yield+0x23>
+
+00800df8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	57                   	push   %edi
+  800dfc:	56                   	push   %esi
+  800dfd:	53                   	push   %ebx
+  800dfe:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e01:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e08:	74 23                	je     800e2d <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e0a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e0f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1d:	89 f7                	mov    %esi,%edi
+  800e1f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e21:	85 c0                	test   %eax,%eax
+  800e23:	7f 29                	jg     800e4e <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e28:	5b                   	pop    %ebx
+  800e29:	5e                   	pop    %esi
+  800e2a:	5f                   	pop    %edi
+  800e2b:	5d                   	pop    %ebp
+  800e2c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e33:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e38:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	8d 35 4b 0e 80 00    	lea    0x800e4b,%esi
+  800e49:	0f 34                	sysenter
+  800e4b:	5d                   	pop    %ebp
+		goto out;
+  800e4c:	eb d3                	jmp    800e21 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e4e:	83 ec 0c             	sub    $0xc,%esp
+  800e51:	50                   	push   %eax
+  800e52:	6a 04                	push   $0x4
+  800e54:	68 4b 37 80 00       	push   $0x80374b
+  800e59:	6a 3f                	push   $0x3f
+  800e5b:	68 68 37 80 00       	push   $0x803768
+  800e60:	e8 78 f3 ff ff       	call   8001dd <_panic>
+
+00800e65 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	57                   	push   %edi
+  800e69:	56                   	push   %esi
+  800e6a:	53                   	push   %ebx
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  800e6e:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e71:	85 f6                	test   %esi,%esi
+  800e73:	75 09                	jne    800e7e <sys_page_map+0x19>
+  800e75:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e7c:	74 1f                	je     800e9d <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e91:	85 c0                	test   %eax,%eax
+  800e93:	7f 27                	jg     800ebc <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e98:	5b                   	pop    %ebx
+  800e99:	5e                   	pop    %esi
+  800e9a:	5f                   	pop    %edi
+  800e9b:	5d                   	pop    %ebp
+  800e9c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ea8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	8d 35 b9 0e 80 00    	lea    0x800eb9,%esi
+  800eb7:	0f 34                	sysenter
+  800eb9:	5d                   	pop    %ebp
+		goto out;
+  800eba:	eb d5                	jmp    800e91 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+  800ebf:	50                   	push   %eax
+  800ec0:	6a 05                	push   $0x5
+  800ec2:	68 4b 37 80 00       	push   $0x80374b
+  800ec7:	6a 3f                	push   $0x3f
+  800ec9:	68 68 37 80 00       	push   $0x803768
+  800ece:	e8 0a f3 ff ff       	call   8001dd <_panic>
+
+00800ed3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	57                   	push   %edi
+  800ed7:	56                   	push   %esi
+  800ed8:	53                   	push   %ebx
+  800ed9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800edc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ee3:	74 22                	je     800f07 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800ee5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eea:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef5:	89 df                	mov    %ebx,%edi
+  800ef7:	89 de                	mov    %ebx,%esi
+  800ef9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800efb:	85 c0                	test   %eax,%eax
+  800efd:	7f 28                	jg     800f27 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f02:	5b                   	pop    %ebx
+  800f03:	5e                   	pop    %esi
+  800f04:	5f                   	pop    %edi
+  800f05:	5d                   	pop    %ebp
+  800f06:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f12:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f17:	89 df                	mov    %ebx,%edi
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	8d 35 24 0f 80 00    	lea    0x800f24,%esi
+  800f22:	0f 34                	sysenter
+  800f24:	5d                   	pop    %ebp
+		goto out;
+  800f25:	eb d4                	jmp    800efb <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f27:	83 ec 0c             	sub    $0xc,%esp
+  800f2a:	50                   	push   %eax
+  800f2b:	6a 06                	push   $0x6
+  800f2d:	68 4b 37 80 00       	push   $0x80374b
+  800f32:	6a 3f                	push   $0x3f
+  800f34:	68 68 37 80 00       	push   $0x803768
+  800f39:	e8 9f f2 ff ff       	call   8001dd <_panic>
+
+00800f3e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	56                   	push   %esi
+  800f43:	53                   	push   %ebx
+  800f44:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f47:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f4e:	74 22                	je     800f72 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f55:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f60:	89 df                	mov    %ebx,%edi
+  800f62:	89 de                	mov    %ebx,%esi
+  800f64:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f66:	85 c0                	test   %eax,%eax
+  800f68:	7f 28                	jg     800f92 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6d:	5b                   	pop    %ebx
+  800f6e:	5e                   	pop    %esi
+  800f6f:	5f                   	pop    %edi
+  800f70:	5d                   	pop    %ebp
+  800f71:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f82:	89 df                	mov    %ebx,%edi
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	8d 35 8f 0f 80 00    	lea    0x800f8f,%esi
+  800f8d:	0f 34                	sysenter
+  800f8f:	5d                   	pop    %ebp
+		goto out;
+  800f90:	eb d4                	jmp    800f66 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f92:	83 ec 0c             	sub    $0xc,%esp
+  800f95:	50                   	push   %eax
+  800f96:	6a 08                	push   $0x8
+  800f98:	68 4b 37 80 00       	push   $0x80374b
+  800f9d:	6a 3f                	push   $0x3f
+  800f9f:	68 68 37 80 00       	push   $0x803768
+  800fa4:	e8 34 f2 ff ff       	call   8001dd <_panic>
+
+00800fa9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fa9:	55                   	push   %ebp
+  800faa:	89 e5                	mov    %esp,%ebp
+  800fac:	57                   	push   %edi
+  800fad:	56                   	push   %esi
+  800fae:	53                   	push   %ebx
+  800faf:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fb2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fb9:	74 22                	je     800fdd <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800fbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc0:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcb:	89 df                	mov    %ebx,%edi
+  800fcd:	89 de                	mov    %ebx,%esi
+  800fcf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd1:	85 c0                	test   %eax,%eax
+  800fd3:	7f 28                	jg     800ffd <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe8:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fed:	89 df                	mov    %ebx,%edi
+  800fef:	55                   	push   %ebp
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	8d 35 fa 0f 80 00    	lea    0x800ffa,%esi
+  800ff8:	0f 34                	sysenter
+  800ffa:	5d                   	pop    %ebp
+		goto out;
+  800ffb:	eb d4                	jmp    800fd1 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+  801000:	50                   	push   %eax
+  801001:	6a 09                	push   $0x9
+  801003:	68 4b 37 80 00       	push   $0x80374b
+  801008:	6a 3f                	push   $0x3f
+  80100a:	68 68 37 80 00       	push   $0x803768
+  80100f:	e8 c9 f1 ff ff       	call   8001dd <_panic>
+
+00801014 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	53                   	push   %ebx
+  80101a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80101d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801024:	74 22                	je     801048 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801026:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801030:	8b 55 08             	mov    0x8(%ebp),%edx
+  801033:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801036:	89 df                	mov    %ebx,%edi
+  801038:	89 de                	mov    %ebx,%esi
+  80103a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103c:	85 c0                	test   %eax,%eax
+  80103e:	7f 28                	jg     801068 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801040:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801043:	5b                   	pop    %ebx
+  801044:	5e                   	pop    %esi
+  801045:	5f                   	pop    %edi
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801048:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801053:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801058:	89 df                	mov    %ebx,%edi
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	8d 35 65 10 80 00    	lea    0x801065,%esi
+  801063:	0f 34                	sysenter
+  801065:	5d                   	pop    %ebp
+		goto out;
+  801066:	eb d4                	jmp    80103c <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801068:	83 ec 0c             	sub    $0xc,%esp
+  80106b:	50                   	push   %eax
+  80106c:	6a 0a                	push   $0xa
+  80106e:	68 4b 37 80 00       	push   $0x80374b
+  801073:	6a 3f                	push   $0x3f
+  801075:	68 68 37 80 00       	push   $0x803768
+  80107a:	e8 5e f1 ff ff       	call   8001dd <_panic>
+
+0080107f <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	57                   	push   %edi
+  801083:	56                   	push   %esi
+  801084:	53                   	push   %ebx
+  801085:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801088:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80108f:	74 22                	je     8010b3 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801091:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801096:	b8 17 00 00 00       	mov    $0x17,%eax
+  80109b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a1:	89 df                	mov    %ebx,%edi
+  8010a3:	89 de                	mov    %ebx,%esi
+  8010a5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a7:	85 c0                	test   %eax,%eax
+  8010a9:	7f 28                	jg     8010d3 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8010ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ae:	5b                   	pop    %ebx
+  8010af:	5e                   	pop    %esi
+  8010b0:	5f                   	pop    %edi
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010be:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010c3:	89 df                	mov    %ebx,%edi
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	8d 35 d0 10 80 00    	lea    0x8010d0,%esi
+  8010ce:	0f 34                	sysenter
+  8010d0:	5d                   	pop    %ebp
+		goto out;
+  8010d1:	eb d4                	jmp    8010a7 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d3:	83 ec 0c             	sub    $0xc,%esp
+  8010d6:	50                   	push   %eax
+  8010d7:	6a 17                	push   $0x17
+  8010d9:	68 4b 37 80 00       	push   $0x80374b
+  8010de:	6a 3f                	push   $0x3f
+  8010e0:	68 68 37 80 00       	push   $0x803768
+  8010e5:	e8 f3 f0 ff ff       	call   8001dd <_panic>
+
+008010ea <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8010ea:	55                   	push   %ebp
+  8010eb:	89 e5                	mov    %esp,%ebp
+  8010ed:	57                   	push   %edi
+  8010ee:	56                   	push   %esi
+  8010ef:	53                   	push   %ebx
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010f3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010fa:	74 22                	je     80111e <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801101:	b8 18 00 00 00       	mov    $0x18,%eax
+  801106:	8b 55 08             	mov    0x8(%ebp),%edx
+  801109:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110c:	89 df                	mov    %ebx,%edi
+  80110e:	89 de                	mov    %ebx,%esi
+  801110:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801112:	85 c0                	test   %eax,%eax
+  801114:	7f 28                	jg     80113e <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801116:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801119:	5b                   	pop    %ebx
+  80111a:	5e                   	pop    %esi
+  80111b:	5f                   	pop    %edi
+  80111c:	5d                   	pop    %ebp
+  80111d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80111e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801123:	8b 55 08             	mov    0x8(%ebp),%edx
+  801126:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801129:	b8 18 00 00 00       	mov    $0x18,%eax
+  80112e:	89 df                	mov    %ebx,%edi
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	8d 35 3b 11 80 00    	lea    0x80113b,%esi
+  801139:	0f 34                	sysenter
+  80113b:	5d                   	pop    %ebp
+		goto out;
+  80113c:	eb d4                	jmp    801112 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+  801141:	50                   	push   %eax
+  801142:	6a 18                	push   $0x18
+  801144:	68 4b 37 80 00       	push   $0x80374b
+  801149:	6a 3f                	push   $0x3f
+  80114b:	68 68 37 80 00       	push   $0x803768
+  801150:	e8 88 f0 ff ff       	call   8001dd <_panic>
+
+00801155 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80115b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801162:	74 1d                	je     801181 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801164:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801169:	be 00 00 00 00       	mov    $0x0,%esi
+  80116e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801171:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801174:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801177:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80117c:	5b                   	pop    %ebx
+  80117d:	5e                   	pop    %esi
+  80117e:	5f                   	pop    %edi
+  80117f:	5d                   	pop    %ebp
+  801180:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801181:	8b 55 08             	mov    0x8(%ebp),%edx
+  801184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801187:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80118c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801192:	55                   	push   %ebp
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	8d 35 9d 11 80 00    	lea    0x80119d,%esi
+  80119b:	0f 34                	sysenter
+  80119d:	5d                   	pop    %ebp
+		goto out;
+  80119e:	eb dc                	jmp    80117c <sys_ipc_try_send+0x27>
+
+008011a0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011a0:	55                   	push   %ebp
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	57                   	push   %edi
+  8011a4:	56                   	push   %esi
+  8011a5:	53                   	push   %ebx
+  8011a6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011a9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011b0:	74 21                	je     8011d3 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8011b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bf:	89 cb                	mov    %ecx,%ebx
+  8011c1:	89 cf                	mov    %ecx,%edi
+  8011c3:	89 ce                	mov    %ecx,%esi
+  8011c5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c7:	85 c0                	test   %eax,%eax
+  8011c9:	7f 27                	jg     8011f2 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ce:	5b                   	pop    %ebx
+  8011cf:	5e                   	pop    %esi
+  8011d0:	5f                   	pop    %edi
+  8011d1:	5d                   	pop    %ebp
+  8011d2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011db:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011e0:	89 cb                	mov    %ecx,%ebx
+  8011e2:	89 cf                	mov    %ecx,%edi
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	8d 35 ef 11 80 00    	lea    0x8011ef,%esi
+  8011ed:	0f 34                	sysenter
+  8011ef:	5d                   	pop    %ebp
+		goto out;
+  8011f0:	eb d5                	jmp    8011c7 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f2:	83 ec 0c             	sub    $0xc,%esp
+  8011f5:	50                   	push   %eax
+  8011f6:	6a 0d                	push   $0xd
+  8011f8:	68 4b 37 80 00       	push   $0x80374b
+  8011fd:	6a 3f                	push   $0x3f
+  8011ff:	68 68 37 80 00       	push   $0x803768
+  801204:	e8 d4 ef ff ff       	call   8001dd <_panic>
+
+00801209 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801209:	55                   	push   %ebp
+  80120a:	89 e5                	mov    %esp,%ebp
+  80120c:	57                   	push   %edi
+  80120d:	56                   	push   %esi
+  80120e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80120f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801216:	74 1b                	je     801233 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801218:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801222:	8b 55 08             	mov    0x8(%ebp),%edx
+  801225:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801228:	89 df                	mov    %ebx,%edi
+  80122a:	89 de                	mov    %ebx,%esi
+  80122c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80122e:	5b                   	pop    %ebx
+  80122f:	5e                   	pop    %esi
+  801230:	5f                   	pop    %edi
+  801231:	5d                   	pop    %ebp
+  801232:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801238:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801243:	89 df                	mov    %ebx,%edi
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	8d 35 50 12 80 00    	lea    0x801250,%esi
+  80124e:	0f 34                	sysenter
+  801250:	5d                   	pop    %ebp
+		goto out;
+  801251:	eb db                	jmp    80122e <sys_ipc_recv_until+0x25>
+
+00801253 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801253:	55                   	push   %ebp
+  801254:	89 e5                	mov    %esp,%ebp
+  801256:	57                   	push   %edi
+  801257:	56                   	push   %esi
+  801258:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801259:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801260:	74 19                	je     80127b <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801262:	ba 00 00 00 00       	mov    $0x0,%edx
+  801267:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80126c:	89 d1                	mov    %edx,%ecx
+  80126e:	89 d3                	mov    %edx,%ebx
+  801270:	89 d7                	mov    %edx,%edi
+  801272:	89 d6                	mov    %edx,%esi
+  801274:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801276:	5b                   	pop    %ebx
+  801277:	5e                   	pop    %esi
+  801278:	5f                   	pop    %edi
+  801279:	5d                   	pop    %ebp
+  80127a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80127b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801280:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801285:	89 d1                	mov    %edx,%ecx
+  801287:	89 d3                	mov    %edx,%ebx
+  801289:	89 d7                	mov    %edx,%edi
+  80128b:	55                   	push   %ebp
+  80128c:	89 e5                	mov    %esp,%ebp
+  80128e:	8d 35 96 12 80 00    	lea    0x801296,%esi
+  801294:	0f 34                	sysenter
+  801296:	5d                   	pop    %ebp
+		goto out;
+  801297:	eb dd                	jmp    801276 <sys_time_msec+0x23>
+
+00801299 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	57                   	push   %edi
+  80129d:	56                   	push   %esi
+  80129e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80129f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012a6:	74 1a                	je     8012c2 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8012a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ad:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b5:	89 cb                	mov    %ecx,%ebx
+  8012b7:	89 cf                	mov    %ecx,%edi
+  8012b9:	89 ce                	mov    %ecx,%esi
+  8012bb:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012bd:	5b                   	pop    %ebx
+  8012be:	5e                   	pop    %esi
+  8012bf:	5f                   	pop    %edi
+  8012c0:	5d                   	pop    %ebp
+  8012c1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ca:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012cf:	89 cb                	mov    %ecx,%ebx
+  8012d1:	89 cf                	mov    %ecx,%edi
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	8d 35 de 12 80 00    	lea    0x8012de,%esi
+  8012dc:	0f 34                	sysenter
+  8012de:	5d                   	pop    %ebp
+		goto out;
+  8012df:	eb dc                	jmp    8012bd <sys_sleep_until+0x24>
+
+008012e1 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012e1:	55                   	push   %ebp
+  8012e2:	89 e5                	mov    %esp,%ebp
+  8012e4:	57                   	push   %edi
+  8012e5:	56                   	push   %esi
+  8012e6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012e7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012ee:	74 1a                	je     80130a <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8012f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fd:	89 cb                	mov    %ecx,%ebx
+  8012ff:	89 cf                	mov    %ecx,%edi
+  801301:	89 ce                	mov    %ecx,%esi
+  801303:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801305:	5b                   	pop    %ebx
+  801306:	5e                   	pop    %esi
+  801307:	5f                   	pop    %edi
+  801308:	5d                   	pop    %ebp
+  801309:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80130a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801312:	b8 11 00 00 00       	mov    $0x11,%eax
+  801317:	89 cb                	mov    %ecx,%ebx
+  801319:	89 cf                	mov    %ecx,%edi
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+  80131e:	8d 35 26 13 80 00    	lea    0x801326,%esi
+  801324:	0f 34                	sysenter
+  801326:	5d                   	pop    %ebp
+		goto out;
+  801327:	eb dc                	jmp    801305 <sys_env_print_stats+0x24>
+
+00801329 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801329:	55                   	push   %ebp
+  80132a:	89 e5                	mov    %esp,%ebp
+  80132c:	57                   	push   %edi
+  80132d:	56                   	push   %esi
+  80132e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80132f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801336:	74 1b                	je     801353 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801338:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801342:	8b 55 08             	mov    0x8(%ebp),%edx
+  801345:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801348:	89 df                	mov    %ebx,%edi
+  80134a:	89 de                	mov    %ebx,%esi
+  80134c:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80134e:	5b                   	pop    %ebx
+  80134f:	5e                   	pop    %esi
+  801350:	5f                   	pop    %edi
+  801351:	5d                   	pop    %ebp
+  801352:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801353:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801358:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801363:	89 df                	mov    %ebx,%edi
+  801365:	55                   	push   %ebp
+  801366:	89 e5                	mov    %esp,%ebp
+  801368:	8d 35 70 13 80 00    	lea    0x801370,%esi
+  80136e:	0f 34                	sysenter
+  801370:	5d                   	pop    %ebp
+		goto out;
+  801371:	eb db                	jmp    80134e <sys_perf+0x25>
+
+00801373 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	57                   	push   %edi
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801379:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801380:	74 19                	je     80139b <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801382:	ba 00 00 00 00       	mov    $0x0,%edx
+  801387:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80138c:	89 d1                	mov    %edx,%ecx
+  80138e:	89 d3                	mov    %edx,%ebx
+  801390:	89 d7                	mov    %edx,%edi
+  801392:	89 d6                	mov    %edx,%esi
+  801394:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801396:	5b                   	pop    %ebx
+  801397:	5e                   	pop    %esi
+  801398:	5f                   	pop    %edi
+  801399:	5d                   	pop    %ebp
+  80139a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80139b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013a5:	89 d1                	mov    %edx,%ecx
+  8013a7:	89 d3                	mov    %edx,%ebx
+  8013a9:	89 d7                	mov    %edx,%edi
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	8d 35 b6 13 80 00    	lea    0x8013b6,%esi
+  8013b4:	0f 34                	sysenter
+  8013b6:	5d                   	pop    %ebp
+		goto out;
+  8013b7:	eb dd                	jmp    801396 <sys_fork+0x23>
+
+008013b9 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8013b9:	55                   	push   %ebp
+  8013ba:	89 e5                	mov    %esp,%ebp
+  8013bc:	57                   	push   %edi
+  8013bd:	56                   	push   %esi
+  8013be:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013bf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013c6:	74 1c                	je     8013e4 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013db:	89 f7                	mov    %esi,%edi
+  8013dd:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013df:	5b                   	pop    %ebx
+  8013e0:	5e                   	pop    %esi
+  8013e1:	5f                   	pop    %edi
+  8013e2:	5d                   	pop    %ebp
+  8013e3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ea:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	8d 35 02 14 80 00    	lea    0x801402,%esi
+  801400:	0f 34                	sysenter
+  801402:	5d                   	pop    %ebp
+		goto out;
+  801403:	eb da                	jmp    8013df <sys_thread_create+0x26>
+
+00801405 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801405:	55                   	push   %ebp
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	57                   	push   %edi
+  801409:	56                   	push   %esi
+  80140a:	53                   	push   %ebx
+  80140b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80140e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801415:	74 24                	je     80143b <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801417:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80141c:	be 00 00 00 00       	mov    $0x0,%esi
+  801421:	8b 55 08             	mov    0x8(%ebp),%edx
+  801424:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801427:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80142d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80142f:	85 c0                	test   %eax,%eax
+  801431:	7f 27                	jg     80145a <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801433:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801436:	5b                   	pop    %ebx
+  801437:	5e                   	pop    %esi
+  801438:	5f                   	pop    %edi
+  801439:	5d                   	pop    %ebp
+  80143a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80143b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801441:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801446:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801449:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80144c:	55                   	push   %ebp
+  80144d:	89 e5                	mov    %esp,%ebp
+  80144f:	8d 35 57 14 80 00    	lea    0x801457,%esi
+  801455:	0f 34                	sysenter
+  801457:	5d                   	pop    %ebp
+		goto out;
+  801458:	eb d5                	jmp    80142f <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80145a:	83 ec 0c             	sub    $0xc,%esp
+  80145d:	50                   	push   %eax
+  80145e:	6a 1f                	push   $0x1f
+  801460:	68 4b 37 80 00       	push   $0x80374b
+  801465:	6a 3f                	push   $0x3f
+  801467:	68 68 37 80 00       	push   $0x803768
+  80146c:	e8 6c ed ff ff       	call   8001dd <_panic>
+
+00801471 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801471:	55                   	push   %ebp
+  801472:	89 e5                	mov    %esp,%ebp
+  801474:	57                   	push   %edi
+  801475:	56                   	push   %esi
+  801476:	53                   	push   %ebx
+  801477:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80147a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801481:	74 23                	je     8014a6 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801483:	be 00 00 00 00       	mov    $0x0,%esi
+  801488:	b8 20 00 00 00       	mov    $0x20,%eax
+  80148d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801490:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801493:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801496:	89 f7                	mov    %esi,%edi
+  801498:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	7f 29                	jg     8014c7 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80149e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a1:	5b                   	pop    %ebx
+  8014a2:	5e                   	pop    %esi
+  8014a3:	5f                   	pop    %edi
+  8014a4:	5d                   	pop    %ebp
+  8014a5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ac:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	8d 35 c4 14 80 00    	lea    0x8014c4,%esi
+  8014c2:	0f 34                	sysenter
+  8014c4:	5d                   	pop    %ebp
+		goto out;
+  8014c5:	eb d3                	jmp    80149a <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014c7:	83 ec 0c             	sub    $0xc,%esp
+  8014ca:	50                   	push   %eax
+  8014cb:	6a 20                	push   $0x20
+  8014cd:	68 4b 37 80 00       	push   $0x80374b
+  8014d2:	6a 3f                	push   $0x3f
+  8014d4:	68 68 37 80 00       	push   $0x803768
+  8014d9:	e8 ff ec ff ff       	call   8001dd <_panic>
+
+008014de <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014de:	55                   	push   %ebp
+  8014df:	89 e5                	mov    %esp,%ebp
+  8014e1:	57                   	push   %edi
+  8014e2:	56                   	push   %esi
+  8014e3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014e4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014eb:	74 1b                	je     801508 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8014ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014fd:	89 df                	mov    %ebx,%edi
+  8014ff:	89 de                	mov    %ebx,%esi
+  801501:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801503:	5b                   	pop    %ebx
+  801504:	5e                   	pop    %esi
+  801505:	5f                   	pop    %edi
+  801506:	5d                   	pop    %ebp
+  801507:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801508:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801510:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801513:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801518:	89 df                	mov    %ebx,%edi
+  80151a:	55                   	push   %ebp
+  80151b:	89 e5                	mov    %esp,%ebp
+  80151d:	8d 35 25 15 80 00    	lea    0x801525,%esi
+  801523:	0f 34                	sysenter
+  801525:	5d                   	pop    %ebp
+		goto out;
+  801526:	eb db                	jmp    801503 <sys_batch+0x25>
+
+00801528 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801528:	55                   	push   %ebp
+  801529:	89 e5                	mov    %esp,%ebp
+  80152b:	57                   	push   %edi
+  80152c:	56                   	push   %esi
+  80152d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80152e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801535:	74 1a                	je     801551 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801537:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80153c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801541:	8b 55 08             	mov    0x8(%ebp),%edx
+  801544:	89 cb                	mov    %ecx,%ebx
+  801546:	89 cf                	mov    %ecx,%edi
+  801548:	89 ce                	mov    %ecx,%esi
+  80154a:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80154c:	5b                   	pop    %ebx
+  80154d:	5e                   	pop    %esi
+  80154e:	5f                   	pop    %edi
+  80154f:	5d                   	pop    %ebp
+  801550:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801551:	8b 55 08             	mov    0x8(%ebp),%edx
+  801554:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801559:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80155e:	89 cb                	mov    %ecx,%ebx
+  801560:	89 cf                	mov    %ecx,%edi
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	8d 35 6d 15 80 00    	lea    0x80156d,%esi
+  80156b:	0f 34                	sysenter
+  80156d:	5d                   	pop    %ebp
+		goto out;
+  80156e:	eb dc                	jmp    80154c <sys_trace_ctl+0x24>
+
+00801570 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801570:	55                   	push   %ebp
+  801571:	89 e5                	mov    %esp,%ebp
+  801573:	57                   	push   %edi
+  801574:	56                   	push   %esi
+  801575:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801576:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80157d:	74 1c                	je     80159b <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80157f:	be 00 00 00 00       	mov    $0x0,%esi
+  801584:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801589:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80158f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801592:	89 f7                	mov    %esi,%edi
+  801594:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801596:	5b                   	pop    %ebx
+  801597:	5e                   	pop    %esi
+  801598:	5f                   	pop    %edi
+  801599:	5d                   	pop    %ebp
+  80159a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80159b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ae:	55                   	push   %ebp
+  8015af:	89 e5                	mov    %esp,%ebp
+  8015b1:	8d 35 b9 15 80 00    	lea    0x8015b9,%esi
+  8015b7:	0f 34                	sysenter
+  8015b9:	5d                   	pop    %ebp
+		goto out;
+  8015ba:	eb da                	jmp    801596 <sys_trace_read+0x26>
+
+008015bc <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015bc:	55                   	push   %ebp
+  8015bd:	89 e5                	mov    %esp,%ebp
+  8015bf:	57                   	push   %edi
+  8015c0:	56                   	push   %esi
+  8015c1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015c2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015c9:	74 1c                	je     8015e7 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8015cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d0:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015de:	89 f7                	mov    %esi,%edi
+  8015e0:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015e2:	5b                   	pop    %ebx
+  8015e3:	5e                   	pop    %esi
+  8015e4:	5f                   	pop    %edi
+  8015e5:	5d                   	pop    %ebp
+  8015e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ed:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	8d 35 05 16 80 00    	lea    0x801605,%esi
+  801603:	0f 34                	sysenter
+  801605:	5d                   	pop    %ebp
+		goto out;
+  801606:	eb da                	jmp    8015e2 <sys_meminfo+0x26>
+
+00801608 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801608:	55                   	push   %ebp
+  801609:	89 e5                	mov    %esp,%ebp
+  80160b:	57                   	push   %edi
+  80160c:	56                   	push   %esi
+  80160d:	53                   	push   %ebx
+  80160e:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801611:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801615:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80161c:	74 1f                	je     80163d <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80161e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801623:	b8 22 00 00 00       	mov    $0x22,%eax
+  801628:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162b:	89 df                	mov    %ebx,%edi
+  80162d:	89 de                	mov    %ebx,%esi
+  80162f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801631:	85 c0                	test   %eax,%eax
+  801633:	7f 25                	jg     80165a <sys_env_set_ksm+0x52>
+}
+  801635:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801638:	5b                   	pop    %ebx
+  801639:	5e                   	pop    %esi
+  80163a:	5f                   	pop    %edi
+  80163b:	5d                   	pop    %ebp
+  80163c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80163d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801642:	8b 55 08             	mov    0x8(%ebp),%edx
+  801645:	b8 22 00 00 00       	mov    $0x22,%eax
+  80164a:	89 df                	mov    %ebx,%edi
+  80164c:	55                   	push   %ebp
+  80164d:	89 e5                	mov    %esp,%ebp
+  80164f:	8d 35 57 16 80 00    	lea    0x801657,%esi
+  801655:	0f 34                	sysenter
+  801657:	5d                   	pop    %ebp
+		goto out;
+  801658:	eb d7                	jmp    801631 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80165a:	83 ec 0c             	sub    $0xc,%esp
+  80165d:	50                   	push   %eax
+  80165e:	6a 22                	push   $0x22
+  801660:	68 4b 37 80 00       	push   $0x80374b
+  801665:	6a 3f                	push   $0x3f
+  801667:	68 68 37 80 00       	push   $0x803768
+  80166c:	e8 6c eb ff ff       	call   8001dd <_panic>
+
+00801671 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801671:	55                   	push   %ebp
+  801672:	89 e5                	mov    %esp,%ebp
+  801674:	57                   	push   %edi
+  801675:	56                   	push   %esi
+  801676:	53                   	push   %ebx
+  801677:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80167a:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80167d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801684:	74 24                	je     8016aa <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80168b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801690:	89 cb                	mov    %ecx,%ebx
+  801692:	89 cf                	mov    %ecx,%edi
+  801694:	89 ce                	mov    %ecx,%esi
+  801696:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801698:	85 c0                	test   %eax,%eax
+  80169a:	7f 2a                	jg     8016c6 <sys_time_nsec+0x55>
+	return ns;
+}
+  80169c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80169f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a5:	5b                   	pop    %ebx
+  8016a6:	5e                   	pop    %esi
+  8016a7:	5f                   	pop    %edi
+  8016a8:	5d                   	pop    %ebp
+  8016a9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016af:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016b4:	89 cb                	mov    %ecx,%ebx
+  8016b6:	89 cf                	mov    %ecx,%edi
+  8016b8:	55                   	push   %ebp
+  8016b9:	89 e5                	mov    %esp,%ebp
+  8016bb:	8d 35 c3 16 80 00    	lea    0x8016c3,%esi
+  8016c1:	0f 34                	sysenter
+  8016c3:	5d                   	pop    %ebp
+		goto out;
+  8016c4:	eb d2                	jmp    801698 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016c6:	83 ec 0c             	sub    $0xc,%esp
+  8016c9:	50                   	push   %eax
+  8016ca:	6a 0f                	push   $0xf
+  8016cc:	68 4b 37 80 00       	push   $0x80374b
+  8016d1:	6a 3f                	push   $0x3f
+  8016d3:	68 68 37 80 00       	push   $0x803768
+  8016d8:	e8 00 eb ff ff       	call   8001dd <_panic>
+
+008016dd <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016dd:	55                   	push   %ebp
+  8016de:	89 e5                	mov    %esp,%ebp
+  8016e0:	57                   	push   %edi
+  8016e1:	56                   	push   %esi
+  8016e2:	53                   	push   %ebx
+  8016e3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016e6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016ed:	74 22                	je     801711 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8016ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ff:	89 df                	mov    %ebx,%edi
+  801701:	89 de                	mov    %ebx,%esi
+  801703:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801705:	85 c0                	test   %eax,%eax
+  801707:	7f 28                	jg     801731 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170c:	5b                   	pop    %ebx
+  80170d:	5e                   	pop    %esi
+  80170e:	5f                   	pop    %edi
+  80170f:	5d                   	pop    %ebp
+  801710:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801711:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801716:	8b 55 08             	mov    0x8(%ebp),%edx
+  801719:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801721:	89 df                	mov    %ebx,%edi
+  801723:	55                   	push   %ebp
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	8d 35 2e 17 80 00    	lea    0x80172e,%esi
+  80172c:	0f 34                	sysenter
+  80172e:	5d                   	pop    %ebp
+		goto out;
+  80172f:	eb d4                	jmp    801705 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801731:	83 ec 0c             	sub    $0xc,%esp
+  801734:	50                   	push   %eax
+  801735:	6a 12                	push   $0x12
+  801737:	68 4b 37 80 00       	push   $0x80374b
+  80173c:	6a 3f                	push   $0x3f
+  80173e:	68 68 37 80 00       	push   $0x803768
+  801743:	e8 95 ea ff ff       	call   8001dd <_panic>
+
+00801748 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801748:	55                   	push   %ebp
+  801749:	89 e5                	mov    %esp,%ebp
+  80174b:	57                   	push   %edi
+  80174c:	56                   	push   %esi
+  80174d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80174e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801755:	74 1b                	je     801772 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801757:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801761:	8b 55 08             	mov    0x8(%ebp),%edx
+  801764:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801767:	89 df                	mov    %ebx,%edi
+  801769:	89 de                	mov    %ebx,%esi
+  80176b:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80176d:	5b                   	pop    %ebx
+  80176e:	5e                   	pop    %esi
+  80176f:	5f                   	pop    %edi
+  801770:	5d                   	pop    %ebp
+  801771:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801772:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801777:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801782:	89 df                	mov    %ebx,%edi
+  801784:	55                   	push   %ebp
+  801785:	89 e5                	mov    %esp,%ebp
+  801787:	8d 35 8f 17 80 00    	lea    0x80178f,%esi
+  80178d:	0f 34                	sysenter
+  80178f:	5d                   	pop    %ebp
+		goto out;
+  801790:	eb db                	jmp    80176d <sys_e1000_receive+0x25>
+
+00801792 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	57                   	push   %edi
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801798:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80179f:	74 1b                	je     8017bc <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8017a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b1:	89 df                	mov    %ebx,%edi
+  8017b3:	89 de                	mov    %ebx,%esi
+  8017b5:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017b7:	5b                   	pop    %ebx
+  8017b8:	5e                   	pop    %esi
+  8017b9:	5f                   	pop    %edi
+  8017ba:	5d                   	pop    %ebp
+  8017bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017cc:	89 df                	mov    %ebx,%edi
+  8017ce:	55                   	push   %ebp
+  8017cf:	89 e5                	mov    %esp,%ebp
+  8017d1:	8d 35 d9 17 80 00    	lea    0x8017d9,%esi
+  8017d7:	0f 34                	sysenter
+  8017d9:	5d                   	pop    %ebp
+		goto out;
+  8017da:	eb db                	jmp    8017b7 <sys_e1000_read_hwaddr+0x25>
+
+008017dc <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017dc:	55                   	push   %ebp
+  8017dd:	89 e5                	mov    %esp,%ebp
+  8017df:	57                   	push   %edi
+  8017e0:	56                   	push   %esi
+  8017e1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017e2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017e9:	74 1a                	je     801805 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8017eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017f0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f8:	89 cb                	mov    %ecx,%ebx
+  8017fa:	89 cf                	mov    %ecx,%edi
+  8017fc:	89 ce                	mov    %ecx,%esi
+  8017fe:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801800:	5b                   	pop    %ebx
+  801801:	5e                   	pop    %esi
+  801802:	5f                   	pop    %edi
+  801803:	5d                   	pop    %ebp
+  801804:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801805:	8b 55 08             	mov    0x8(%ebp),%edx
+  801808:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80180d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801812:	89 cb                	mov    %ecx,%ebx
+  801814:	89 cf                	mov    %ecx,%edi
+  801816:	55                   	push   %ebp
+  801817:	89 e5                	mov    %esp,%ebp
+  801819:	8d 35 21 18 80 00    	lea    0x801821,%esi
+  80181f:	0f 34                	sysenter
+  801821:	5d                   	pop    %ebp
+		goto out;
+  801822:	eb dc                	jmp    801800 <sys_sb16_read_version+0x24>
+
+00801824 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801824:	55                   	push   %ebp
+  801825:	89 e5                	mov    %esp,%ebp
+  801827:	57                   	push   %edi
+  801828:	56                   	push   %esi
+  801829:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80182a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801831:	74 1b                	je     80184e <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801833:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801838:	b8 16 00 00 00       	mov    $0x16,%eax
+  80183d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801840:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801843:	89 df                	mov    %ebx,%edi
+  801845:	89 de                	mov    %ebx,%esi
+  801847:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801849:	5b                   	pop    %ebx
+  80184a:	5e                   	pop    %esi
+  80184b:	5f                   	pop    %edi
+  80184c:	5d                   	pop    %ebp
+  80184d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80184e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801853:	8b 55 08             	mov    0x8(%ebp),%edx
+  801856:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801859:	b8 16 00 00 00       	mov    $0x16,%eax
+  80185e:	89 df                	mov    %ebx,%edi
+  801860:	55                   	push   %ebp
+  801861:	89 e5                	mov    %esp,%ebp
+  801863:	8d 35 6b 18 80 00    	lea    0x80186b,%esi
+  801869:	0f 34                	sysenter
+  80186b:	5d                   	pop    %ebp
+		goto out;
+  80186c:	eb db                	jmp    801849 <sys_sb16_play+0x25>
+
+0080186e <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	53                   	push   %ebx
+  801872:	83 ec 04             	sub    $0x4,%esp
+  801875:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801877:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80187e:	f6 c4 04             	test   $0x4,%ah
+  801881:	74 0c                	je     80188f <dupperm+0x21>
+  801883:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80188a:	f6 c4 08             	test   $0x8,%ah
+  80188d:	75 62                	jne    8018f1 <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80188f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801896:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80189b:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8018a1:	74 19                	je     8018bc <dupperm+0x4e>
+  8018a3:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8018aa:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  8018af:	83 f8 01             	cmp    $0x1,%eax
+  8018b2:	19 c0                	sbb    %eax,%eax
+  8018b4:	25 00 08 00 00       	and    $0x800,%eax
+  8018b9:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  8018bc:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  8018c3:	89 c1                	mov    %eax,%ecx
+  8018c5:	80 cd 04             	or     $0x4,%ch
+  8018c8:	f6 c7 04             	test   $0x4,%bh
+  8018cb:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  8018ce:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018d5:	f6 c1 02             	test   $0x2,%cl
+  8018d8:	74 12                	je     8018ec <dupperm+0x7e>
+  8018da:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  8018e1:	89 c2                	mov    %eax,%edx
+  8018e3:	83 ca 02             	or     $0x2,%edx
+  8018e6:	f6 c5 04             	test   $0x4,%ch
+  8018e9:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  8018ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ef:	c9                   	leave
+  8018f0:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8018f1:	68 78 37 80 00       	push   $0x803778
+  8018f6:	68 10 38 80 00       	push   $0x803810
+  8018fb:	6a 39                	push   $0x39
+  8018fd:	68 25 38 80 00       	push   $0x803825
+  801902:	e8 d6 e8 ff ff       	call   8001dd <_panic>
+
+00801907 <pgfault>:
+{
+  801907:	55                   	push   %ebp
+  801908:	89 e5                	mov    %esp,%ebp
+  80190a:	53                   	push   %ebx
+  80190b:	83 ec 04             	sub    $0x4,%esp
+  80190e:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801911:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801913:	89 c3                	mov    %eax,%ebx
+  801915:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  80191b:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  80191f:	74 6d                	je     80198e <pgfault+0x87>
+  801921:	89 da                	mov    %ebx,%edx
+  801923:	c1 ea 16             	shr    $0x16,%edx
+  801926:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80192d:	f6 c2 80             	test   $0x80,%dl
+  801930:	75 5c                	jne    80198e <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801932:	c1 e8 0c             	shr    $0xc,%eax
+  801935:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  80193c:	f6 c4 08             	test   $0x8,%ah
+  80193f:	74 4d                	je     80198e <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801941:	83 ec 04             	sub    $0x4,%esp
+  801944:	6a 07                	push   $0x7
+  801946:	68 00 f0 7f 00       	push   $0x7ff000
+  80194b:	6a 00                	push   $0x0
+  80194d:	e8 a6 f4 ff ff       	call   800df8 <sys_page_alloc>
+  801952:	83 c4 10             	add    $0x10,%esp
+  801955:	85 c0                	test   %eax,%eax
+  801957:	78 49                	js     8019a2 <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801959:	83 ec 04             	sub    $0x4,%esp
+  80195c:	68 00 10 00 00       	push   $0x1000
+  801961:	53                   	push   %ebx
+  801962:	68 00 f0 7f 00       	push   $0x7ff000
+  801967:	e8 1a f1 ff ff       	call   800a86 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  80196c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801973:	53                   	push   %ebx
+  801974:	6a 00                	push   $0x0
+  801976:	68 00 f0 7f 00       	push   $0x7ff000
+  80197b:	6a 00                	push   $0x0
+  80197d:	e8 e3 f4 ff ff       	call   800e65 <sys_page_map>
+  801982:	83 c4 20             	add    $0x20,%esp
+  801985:	85 c0                	test   %eax,%eax
+  801987:	78 2d                	js     8019b6 <pgfault+0xaf>
+}
+  801989:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80198c:	c9                   	leave
+  80198d:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  80198e:	83 ec 04             	sub    $0x4,%esp
+  801991:	68 30 38 80 00       	push   $0x803830
+  801996:	6a 1e                	push   $0x1e
+  801998:	68 25 38 80 00       	push   $0x803825
+  80199d:	e8 3b e8 ff ff       	call   8001dd <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  8019a2:	83 ec 04             	sub    $0x4,%esp
+  8019a5:	68 ac 37 80 00       	push   $0x8037ac
+  8019aa:	6a 29                	push   $0x29
+  8019ac:	68 25 38 80 00       	push   $0x803825
+  8019b1:	e8 27 e8 ff ff       	call   8001dd <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  8019b6:	50                   	push   %eax
+  8019b7:	68 e0 37 80 00       	push   $0x8037e0
+  8019bc:	6a 2e                	push   $0x2e
+  8019be:	68 25 38 80 00       	push   $0x803825
+  8019c3:	e8 15 e8 ff ff       	call   8001dd <_panic>
+
+008019c8 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  8019c8:	55                   	push   %ebp
+  8019c9:	89 e5                	mov    %esp,%ebp
+  8019cb:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  8019ce:	ff 75 0c             	push   0xc(%ebp)
+  8019d1:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8019d4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8019db:	e8 23 f3 ff ff       	call   800d03 <sys_env_destroy>
+}
+  8019e0:	83 c4 10             	add    $0x10,%esp
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+
+008019e5 <ufork>:
+{
+  8019e5:	55                   	push   %ebp
+  8019e6:	89 e5                	mov    %esp,%ebp
+  8019e8:	57                   	push   %edi
+  8019e9:	56                   	push   %esi
+  8019ea:	53                   	push   %ebx
+  8019eb:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8019f1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019f6:	cd 30                	int    $0x30
+  8019f8:	89 c6                	mov    %eax,%esi
+  8019fa:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	78 56                	js     801a5a <ufork+0x75>
+	if (pid > 0) {
+  801a04:	0f 8e b3 02 00 00    	jle    801cbd <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801a0a:	83 ec 0c             	sub    $0xc,%esp
+  801a0d:	68 07 19 80 00       	push   $0x801907
+  801a12:	e8 d8 18 00 00       	call   8032ef <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801a17:	83 c4 08             	add    $0x8,%esp
+  801a1a:	68 56 33 80 00       	push   $0x803356
+  801a1f:	56                   	push   %esi
+  801a20:	e8 ef f5 ff ff       	call   801014 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801a25:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801a2b:	89 1c 24             	mov    %ebx,(%esp)
+  801a2e:	e8 a1 04 00 00       	call   801ed4 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801a33:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801a3a:	6a 07                	push   $0x7
+  801a3c:	68 00 f0 bf ee       	push   $0xeebff000
+  801a41:	56                   	push   %esi
+  801a42:	53                   	push   %ebx
+  801a43:	e8 0d 06 00 00       	call   802055 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a48:	83 c4 20             	add    $0x20,%esp
+  801a4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a50:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801a56:	89 fe                	mov    %edi,%esi
+  801a58:	eb 22                	jmp    801a7c <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801a5a:	50                   	push   %eax
+  801a5b:	68 49 38 80 00       	push   $0x803849
+  801a60:	68 a9 00 00 00       	push   $0xa9
+  801a65:	68 25 38 80 00       	push   $0x803825
+  801a6a:	e8 6e e7 ff ff       	call   8001dd <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801a6f:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801a75:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801a7a:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a7c:	89 f7                	mov    %esi,%edi
+  801a7e:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801a84:	0f 87 e9 01 00 00    	ja     801c73 <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801a8a:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801a90:	85 f6                	test   %esi,%esi
+  801a92:	0f 49 d6             	cmovns %esi,%edx
+  801a95:	c1 fa 0a             	sar    $0xa,%edx
+  801a98:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801a9f:	f6 c1 01             	test   $0x1,%cl
+  801aa2:	74 cb                	je     801a6f <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801aa4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801aab:	f6 c2 80             	test   $0x80,%dl
+  801aae:	75 17                	jne    801ac7 <ufork+0xe2>
+			j = i + 1;
+  801ab0:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801ab3:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801aba:	f6 c2 01             	test   $0x1,%dl
+  801abd:	0f 85 f3 00 00 00    	jne    801bb6 <ufork+0x1d1>
+			j = i + 1;
+  801ac3:	89 de                	mov    %ebx,%esi
+  801ac5:	eb b5                	jmp    801a7c <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801ac7:	89 fb                	mov    %edi,%ebx
+  801ac9:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801acc:	89 d8                	mov    %ebx,%eax
+  801ace:	c1 e8 16             	shr    $0x16,%eax
+  801ad1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ad8:	89 c2                	mov    %eax,%edx
+  801ada:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801ae0:	25 02 04 00 00       	and    $0x402,%eax
+  801ae5:	83 f8 02             	cmp    $0x2,%eax
+  801ae8:	74 31                	je     801b1b <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801aea:	83 ec 04             	sub    $0x4,%esp
+  801aed:	6a 01                	push   $0x1
+  801aef:	52                   	push   %edx
+  801af0:	53                   	push   %ebx
+  801af1:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801af7:	53                   	push   %ebx
+  801af8:	6a 00                	push   $0x0
+  801afa:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801b00:	50                   	push   %eax
+  801b01:	e8 7a 05 00 00       	call   802080 <batch_map>
+		return;
+  801b06:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b09:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b0f:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b14:	89 c6                	mov    %eax,%esi
+				continue;
+  801b16:	e9 61 ff ff ff       	jmp    801a7c <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801b1b:	83 ec 04             	sub    $0x4,%esp
+  801b1e:	80 ca 80             	or     $0x80,%dl
+  801b21:	52                   	push   %edx
+  801b22:	53                   	push   %ebx
+  801b23:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b29:	e8 ca f2 ff ff       	call   800df8 <sys_page_alloc>
+  801b2e:	83 c4 10             	add    $0x10,%esp
+  801b31:	85 c0                	test   %eax,%eax
+  801b33:	78 5d                	js     801b92 <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801b35:	83 ec 0c             	sub    $0xc,%esp
+  801b38:	6a 07                	push   $0x7
+  801b3a:	68 00 00 40 00       	push   $0x400000
+  801b3f:	6a 00                	push   $0x0
+  801b41:	53                   	push   %ebx
+  801b42:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b48:	e8 18 f3 ff ff       	call   800e65 <sys_page_map>
+  801b4d:	83 c4 20             	add    $0x20,%esp
+  801b50:	85 c0                	test   %eax,%eax
+  801b52:	78 50                	js     801ba4 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801b54:	83 ec 04             	sub    $0x4,%esp
+  801b57:	68 00 00 40 00       	push   $0x400000
+  801b5c:	53                   	push   %ebx
+  801b5d:	68 00 00 40 00       	push   $0x400000
+  801b62:	e8 1f ef ff ff       	call   800a86 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801b67:	83 c4 08             	add    $0x8,%esp
+  801b6a:	68 00 00 40 00       	push   $0x400000
+  801b6f:	6a 00                	push   $0x0
+  801b71:	e8 5d f3 ff ff       	call   800ed3 <sys_page_unmap>
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	85 c0                	test   %eax,%eax
+  801b7b:	79 8c                	jns    801b09 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801b7d:	50                   	push   %eax
+  801b7e:	68 7d 38 80 00       	push   $0x80387d
+  801b83:	68 81 00 00 00       	push   $0x81
+  801b88:	68 25 38 80 00       	push   $0x803825
+  801b8d:	e8 4b e6 ff ff       	call   8001dd <_panic>
+		panic("sys_page_alloc: %e", r);
+  801b92:	50                   	push   %eax
+  801b93:	68 59 38 80 00       	push   $0x803859
+  801b98:	6a 7c                	push   $0x7c
+  801b9a:	68 25 38 80 00       	push   $0x803825
+  801b9f:	e8 39 e6 ff ff       	call   8001dd <_panic>
+		panic("sys_page_map: %e", r);
+  801ba4:	50                   	push   %eax
+  801ba5:	68 6c 38 80 00       	push   $0x80386c
+  801baa:	6a 7e                	push   $0x7e
+  801bac:	68 25 38 80 00       	push   $0x803825
+  801bb1:	e8 27 e6 ff ff       	call   8001dd <_panic>
+  801bb6:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801bbc:	eb 22                	jmp    801be0 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801bbe:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801bc5:	a8 01                	test   $0x1,%al
+  801bc7:	74 35                	je     801bfe <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801bc9:	89 d8                	mov    %ebx,%eax
+  801bcb:	e8 9e fc ff ff       	call   80186e <dupperm>
+  801bd0:	89 c6                	mov    %eax,%esi
+  801bd2:	89 f8                	mov    %edi,%eax
+  801bd4:	e8 95 fc ff ff       	call   80186e <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801bd9:	39 c6                	cmp    %eax,%esi
+  801bdb:	75 21                	jne    801bfe <ufork+0x219>
+				j++;
+  801bdd:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801be0:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801be6:	74 16                	je     801bfe <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801be8:	89 d8                	mov    %ebx,%eax
+  801bea:	c1 e8 0a             	shr    $0xa,%eax
+  801bed:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bf4:	25 81 00 00 00       	and    $0x81,%eax
+  801bf9:	83 f8 01             	cmp    $0x1,%eax
+  801bfc:	74 c0                	je     801bbe <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801bfe:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801c04:	89 d8                	mov    %ebx,%eax
+  801c06:	29 f0                	sub    %esi,%eax
+  801c08:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801c0e:	89 fe                	mov    %edi,%esi
+  801c10:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801c13:	89 f8                	mov    %edi,%eax
+  801c15:	e8 54 fc ff ff       	call   80186e <dupperm>
+  801c1a:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801c1c:	83 ec 08             	sub    $0x8,%esp
+  801c1f:	6a 02                	push   $0x2
+  801c21:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801c27:	51                   	push   %ecx
+  801c28:	e8 15 03 00 00       	call   801f42 <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801c2d:	83 c4 0c             	add    $0xc,%esp
+  801c30:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801c36:	57                   	push   %edi
+  801c37:	56                   	push   %esi
+  801c38:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c3e:	56                   	push   %esi
+  801c3f:	6a 00                	push   $0x0
+  801c41:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801c47:	51                   	push   %ecx
+  801c48:	e8 33 04 00 00       	call   802080 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801c4d:	83 c4 1c             	add    $0x1c,%esp
+  801c50:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801c56:	57                   	push   %edi
+  801c57:	56                   	push   %esi
+  801c58:	6a 00                	push   $0x0
+  801c5a:	56                   	push   %esi
+  801c5b:	6a 00                	push   $0x0
+  801c5d:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801c63:	50                   	push   %eax
+  801c64:	e8 17 04 00 00       	call   802080 <batch_map>
+	return 0;
+  801c69:	83 c4 20             	add    $0x20,%esp
+  801c6c:	89 de                	mov    %ebx,%esi
+  801c6e:	e9 09 fe ff ff       	jmp    801a7c <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801c73:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801c79:	83 ec 04             	sub    $0x4,%esp
+  801c7c:	6a 02                	push   $0x2
+  801c7e:	56                   	push   %esi
+  801c7f:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801c85:	53                   	push   %ebx
+  801c86:	e8 49 04 00 00       	call   8020d4 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801c8b:	89 1c 24             	mov    %ebx,(%esp)
+  801c8e:	e8 5d 02 00 00       	call   801ef0 <batch_flush>
+  801c93:	83 c4 10             	add    $0x10,%esp
+  801c96:	85 c0                	test   %eax,%eax
+  801c98:	78 0e                	js     801ca8 <ufork+0x2c3>
+}
+  801c9a:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca3:	5b                   	pop    %ebx
+  801ca4:	5e                   	pop    %esi
+  801ca5:	5f                   	pop    %edi
+  801ca6:	5d                   	pop    %ebp
+  801ca7:	c3                   	ret
+			panic("fork: %e", r);
+  801ca8:	50                   	push   %eax
+  801ca9:	68 50 38 80 00       	push   $0x803850
+  801cae:	68 d7 00 00 00       	push   $0xd7
+  801cb3:	68 25 38 80 00       	push   $0x803825
+  801cb8:	e8 20 e5 ff ff       	call   8001dd <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801cbd:	e8 aa f0 ff ff       	call   800d6c <sys_getenvid>
+  801cc2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cc7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ccd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801cd2:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801cd7:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801cde:	00 00 00 
+  801ce1:	eb b7                	jmp    801c9a <ufork+0x2b5>
+
+00801ce3 <fork>:
+{
+  801ce3:	55                   	push   %ebp
+  801ce4:	89 e5                	mov    %esp,%ebp
+  801ce6:	53                   	push   %ebx
+  801ce7:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801cea:	68 07 19 80 00       	push   $0x801907
+  801cef:	e8 fb 15 00 00       	call   8032ef <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801cf4:	e8 7a f6 ff ff       	call   801373 <sys_fork>
+  801cf9:	89 c3                	mov    %eax,%ebx
+  801cfb:	83 c4 10             	add    $0x10,%esp
+  801cfe:	85 c0                	test   %eax,%eax
+  801d00:	78 09                	js     801d0b <fork+0x28>
+	if (pid == 0)
+  801d02:	74 1c                	je     801d20 <fork+0x3d>
+}
+  801d04:	89 d8                	mov    %ebx,%eax
+  801d06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d09:	c9                   	leave
+  801d0a:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801d0b:	50                   	push   %eax
+  801d0c:	68 49 38 80 00       	push   $0x803849
+  801d11:	68 ed 00 00 00       	push   $0xed
+  801d16:	68 25 38 80 00       	push   $0x803825
+  801d1b:	e8 bd e4 ff ff       	call   8001dd <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d20:	e8 47 f0 ff ff       	call   800d6c <sys_getenvid>
+  801d25:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d2a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d30:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d35:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801d3a:	eb c8                	jmp    801d04 <fork+0x21>
+
+00801d3c <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801d3c:	55                   	push   %ebp
+  801d3d:	89 e5                	mov    %esp,%ebp
+  801d3f:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801d42:	ff 75 0c             	push   0xc(%ebp)
+  801d45:	ff 75 08             	push   0x8(%ebp)
+  801d48:	68 c8 19 80 00       	push   $0x8019c8
+  801d4d:	e8 67 f6 ff ff       	call   8013b9 <sys_thread_create>
+}
+  801d52:	c9                   	leave
+  801d53:	c3                   	ret
+
+00801d54 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801d54:	55                   	push   %ebp
+  801d55:	89 e5                	mov    %esp,%ebp
+  801d57:	56                   	push   %esi
+  801d58:	53                   	push   %ebx
+  801d59:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801d69:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801d6c:	83 ec 08             	sub    $0x8,%esp
+  801d6f:	ff 75 14             	push   0x14(%ebp)
+  801d72:	50                   	push   %eax
+  801d73:	e8 91 f4 ff ff       	call   801209 <sys_ipc_recv_until>
+  801d78:	83 c4 10             	add    $0x10,%esp
+  801d7b:	85 c0                	test   %eax,%eax
+  801d7d:	78 61                	js     801de0 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801d7f:	85 f6                	test   %esi,%esi
+  801d81:	74 1c                	je     801d9f <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801d83:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d85:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d8a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d90:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d95:	76 5f                	jbe    801df6 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801d97:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801d9d:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801d9f:	85 db                	test   %ebx,%ebx
+  801da1:	74 1c                	je     801dbf <ipc_recv_until+0x6b>
+  801da3:	89 e0                	mov    %esp,%eax
+  801da5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801daa:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801db0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801db5:	76 50                	jbe    801e07 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801db7:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801dbd:	89 03                	mov    %eax,(%ebx)
+  801dbf:	89 e0                	mov    %esp,%eax
+  801dc1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801dc6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dcc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801dd1:	76 45                	jbe    801e18 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801dd3:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801dd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ddc:	5b                   	pop    %ebx
+  801ddd:	5e                   	pop    %esi
+  801dde:	5d                   	pop    %ebp
+  801ddf:	c3                   	ret
+		if (from_env_store)
+  801de0:	85 f6                	test   %esi,%esi
+  801de2:	74 06                	je     801dea <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801de4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801dea:	85 db                	test   %ebx,%ebx
+  801dec:	74 eb                	je     801dd9 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801dee:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801df4:	eb e3                	jmp    801dd9 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801df6:	c1 e8 10             	shr    $0x10,%eax
+  801df9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dff:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e05:	eb 90                	jmp    801d97 <ipc_recv_until+0x43>
+  801e07:	c1 e8 10             	shr    $0x10,%eax
+  801e0a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e10:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e16:	eb 9f                	jmp    801db7 <ipc_recv_until+0x63>
+  801e18:	c1 e8 10             	shr    $0x10,%eax
+  801e1b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e21:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e27:	eb aa                	jmp    801dd3 <ipc_recv_until+0x7f>
+
+00801e29 <ipc_recv>:
+{
+  801e29:	55                   	push   %ebp
+  801e2a:	89 e5                	mov    %esp,%ebp
+  801e2c:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801e2f:	6a 00                	push   $0x0
+  801e31:	ff 75 10             	push   0x10(%ebp)
+  801e34:	ff 75 0c             	push   0xc(%ebp)
+  801e37:	ff 75 08             	push   0x8(%ebp)
+  801e3a:	e8 15 ff ff ff       	call   801d54 <ipc_recv_until>
+}
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+00801e41 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	57                   	push   %edi
+  801e45:	56                   	push   %esi
+  801e46:	53                   	push   %ebx
+  801e47:	83 ec 0c             	sub    $0xc,%esp
+  801e4a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e4d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801e53:	85 db                	test   %ebx,%ebx
+  801e55:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801e5a:	0f 44 d8             	cmove  %eax,%ebx
+  801e5d:	eb 05                	jmp    801e64 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801e5f:	e8 4e ef ff ff       	call   800db2 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801e64:	ff 75 14             	push   0x14(%ebp)
+  801e67:	53                   	push   %ebx
+  801e68:	56                   	push   %esi
+  801e69:	57                   	push   %edi
+  801e6a:	e8 e6 f2 ff ff       	call   801155 <sys_ipc_try_send>
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801e75:	74 e8                	je     801e5f <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	78 08                	js     801e83 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801e7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7e:	5b                   	pop    %ebx
+  801e7f:	5e                   	pop    %esi
+  801e80:	5f                   	pop    %edi
+  801e81:	5d                   	pop    %ebp
+  801e82:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801e83:	50                   	push   %eax
+  801e84:	68 90 38 80 00       	push   $0x803890
+  801e89:	6a 4f                	push   $0x4f
+  801e8b:	68 a3 38 80 00       	push   $0x8038a3
+  801e90:	e8 48 e3 ff ff       	call   8001dd <_panic>
+
+00801e95 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801e95:	55                   	push   %ebp
+  801e96:	89 e5                	mov    %esp,%ebp
+  801e98:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801ea0:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801ea6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801eac:	8b 52 50             	mov    0x50(%edx),%edx
+  801eaf:	39 ca                	cmp    %ecx,%edx
+  801eb1:	74 11                	je     801ec4 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801eb3:	83 c0 01             	add    $0x1,%eax
+  801eb6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801ebb:	75 e3                	jne    801ea0 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801ebd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec2:	eb 0e                	jmp    801ed2 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801ec4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801eca:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ecf:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801ed2:	5d                   	pop    %ebp
+  801ed3:	c3                   	ret
+
+00801ed4 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801ed4:	55                   	push   %ebp
+  801ed5:	89 e5                	mov    %esp,%ebp
+  801ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801eda:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801ee1:	00 00 00 
+	b->b_error = 0;
+  801ee4:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801eeb:	00 00 00 
+}
+  801eee:	5d                   	pop    %ebp
+  801eef:	c3                   	ret
+
+00801ef0 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801ef0:	55                   	push   %ebp
+  801ef1:	89 e5                	mov    %esp,%ebp
+  801ef3:	53                   	push   %ebx
+  801ef4:	83 ec 04             	sub    $0x4,%esp
+  801ef7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801efa:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	7e 09                	jle    801f0d <batch_flush+0x1d>
+  801f04:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801f0b:	74 15                	je     801f22 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801f0d:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801f14:	00 00 00 
+	return b->b_error;
+  801f17:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801f1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f20:	c9                   	leave
+  801f21:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801f22:	83 ec 08             	sub    $0x8,%esp
+  801f25:	50                   	push   %eax
+  801f26:	53                   	push   %ebx
+  801f27:	e8 b2 f5 ff ff       	call   8014de <sys_batch>
+  801f2c:	83 c4 10             	add    $0x10,%esp
+  801f2f:	85 c0                	test   %eax,%eax
+  801f31:	79 da                	jns    801f0d <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801f33:	f7 d8                	neg    %eax
+  801f35:	0f b6 c0             	movzbl %al,%eax
+  801f38:	f7 d8                	neg    %eax
+  801f3a:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801f40:	eb cb                	jmp    801f0d <batch_flush+0x1d>
+
+00801f42 <batch_reserve>:
+{
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	83 ec 08             	sub    $0x8,%esp
+  801f48:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801f4b:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801f51:	03 45 0c             	add    0xc(%ebp),%eax
+  801f54:	83 f8 10             	cmp    $0x10,%eax
+  801f57:	7f 02                	jg     801f5b <batch_reserve+0x19>
+}
+  801f59:	c9                   	leave
+  801f5a:	c3                   	ret
+		batch_flush(b);
+  801f5b:	83 ec 0c             	sub    $0xc,%esp
+  801f5e:	52                   	push   %edx
+  801f5f:	e8 8c ff ff ff       	call   801ef0 <batch_flush>
+  801f64:	83 c4 10             	add    $0x10,%esp
+}
+  801f67:	eb f0                	jmp    801f59 <batch_reserve+0x17>
+
+00801f69 <batch_next>:
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	53                   	push   %ebx
+  801f6d:	83 ec 04             	sub    $0x4,%esp
+  801f70:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801f72:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801f79:	74 28                	je     801fa3 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801f7b:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801f81:	8d 50 01             	lea    0x1(%eax),%edx
+  801f84:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801f8a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f8d:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801f8f:	83 ec 04             	sub    $0x4,%esp
+  801f92:	6a 1c                	push   $0x1c
+  801f94:	6a 00                	push   $0x0
+  801f96:	53                   	push   %ebx
+  801f97:	e8 b5 ea ff ff       	call   800a51 <memset>
+}
+  801f9c:	89 d8                	mov    %ebx,%eax
+  801f9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fa1:	c9                   	leave
+  801fa2:	c3                   	ret
+		batch_flush(b);
+  801fa3:	83 ec 0c             	sub    $0xc,%esp
+  801fa6:	50                   	push   %eax
+  801fa7:	e8 44 ff ff ff       	call   801ef0 <batch_flush>
+  801fac:	83 c4 10             	add    $0x10,%esp
+  801faf:	eb ca                	jmp    801f7b <batch_next+0x12>
+
+00801fb1 <batch_page>:
+{
+  801fb1:	55                   	push   %ebp
+  801fb2:	89 e5                	mov    %esp,%ebp
+  801fb4:	57                   	push   %edi
+  801fb5:	56                   	push   %esi
+  801fb6:	53                   	push   %ebx
+  801fb7:	83 ec 1c             	sub    $0x1c,%esp
+  801fba:	89 d3                	mov    %edx,%ebx
+  801fbc:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801fbe:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801fc4:	85 d2                	test   %edx,%edx
+  801fc6:	74 50                	je     802018 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801fc8:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801fcb:	01 c1                	add    %eax,%ecx
+  801fcd:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801fd0:	75 46                	jne    802018 <batch_page+0x67>
+  801fd2:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801fd5:	75 41                	jne    802018 <batch_page+0x67>
+  801fd7:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801fda:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801fdd:	75 39                	jne    802018 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801fdf:	83 ea 01             	sub    $0x1,%edx
+  801fe2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801fe5:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801fe8:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801fec:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801fef:	75 27                	jne    802018 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801ff1:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801ff4:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801ff8:	89 fa                	mov    %edi,%edx
+  801ffa:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801ffd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802000:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  802003:	39 55 08             	cmp    %edx,0x8(%ebp)
+  802006:	75 10                	jne    802018 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802008:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  80200c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80200f:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  802013:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802016:	74 2a                	je     802042 <batch_page+0x91>
+	op = batch_next(b);
+  802018:	e8 4c ff ff ff       	call   801f69 <batch_next>
+	op->bo_op = opcode;
+  80201d:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  80201f:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  802022:	8b 75 08             	mov    0x8(%ebp),%esi
+  802025:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802028:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80202b:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  80202e:	8b 75 10             	mov    0x10(%ebp),%esi
+  802031:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  802034:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802037:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  80203a:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80203d:	89 78 14             	mov    %edi,0x14(%eax)
+  802040:	eb 0b                	jmp    80204d <batch_page+0x9c>
+		op->bo_npages += npages;
+  802042:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  802046:	03 7d 18             	add    0x18(%ebp),%edi
+  802049:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  80204d:	83 c4 1c             	add    $0x1c,%esp
+  802050:	5b                   	pop    %ebx
+  802051:	5e                   	pop    %esi
+  802052:	5f                   	pop    %edi
+  802053:	5d                   	pop    %ebp
+  802054:	c3                   	ret
+
+00802055 <batch_alloc>:
+{
+  802055:	55                   	push   %ebp
+  802056:	89 e5                	mov    %esp,%ebp
+  802058:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  80205b:	ff 75 18             	push   0x18(%ebp)
+  80205e:	ff 75 14             	push   0x14(%ebp)
+  802061:	ff 75 10             	push   0x10(%ebp)
+  802064:	ff 75 0c             	push   0xc(%ebp)
+  802067:	6a 00                	push   $0x0
+  802069:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80206e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802073:	8b 45 08             	mov    0x8(%ebp),%eax
+  802076:	e8 36 ff ff ff       	call   801fb1 <batch_page>
+}
+  80207b:	83 c4 20             	add    $0x20,%esp
+  80207e:	c9                   	leave
+  80207f:	c3                   	ret
+
+00802080 <batch_map>:
+{
+  802080:	55                   	push   %ebp
+  802081:	89 e5                	mov    %esp,%ebp
+  802083:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802086:	ff 75 20             	push   0x20(%ebp)
+  802089:	ff 75 1c             	push   0x1c(%ebp)
+  80208c:	ff 75 18             	push   0x18(%ebp)
+  80208f:	ff 75 14             	push   0x14(%ebp)
+  802092:	ff 75 10             	push   0x10(%ebp)
+  802095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802098:	ba 01 00 00 00       	mov    $0x1,%edx
+  80209d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a0:	e8 0c ff ff ff       	call   801fb1 <batch_page>
+}
+  8020a5:	83 c4 20             	add    $0x20,%esp
+  8020a8:	c9                   	leave
+  8020a9:	c3                   	ret
+
+008020aa <batch_unmap>:
+{
+  8020aa:	55                   	push   %ebp
+  8020ab:	89 e5                	mov    %esp,%ebp
+  8020ad:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  8020b0:	ff 75 14             	push   0x14(%ebp)
+  8020b3:	6a 00                	push   $0x0
+  8020b5:	ff 75 10             	push   0x10(%ebp)
+  8020b8:	ff 75 0c             	push   0xc(%ebp)
+  8020bb:	6a 00                	push   $0x0
+  8020bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c2:	ba 02 00 00 00       	mov    $0x2,%edx
+  8020c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ca:	e8 e2 fe ff ff       	call   801fb1 <batch_page>
+}
+  8020cf:	83 c4 20             	add    $0x20,%esp
+  8020d2:	c9                   	leave
+  8020d3:	c3                   	ret
+
+008020d4 <batch_set_status>:
+{
+  8020d4:	55                   	push   %ebp
+  8020d5:	89 e5                	mov    %esp,%ebp
+  8020d7:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8020da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020dd:	e8 87 fe ff ff       	call   801f69 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8020e2:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8020e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020eb:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8020ee:	8b 55 10             	mov    0x10(%ebp),%edx
+  8020f1:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8020f4:	c9                   	leave
+  8020f5:	c3                   	ret
+
+008020f6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020fc:	05 00 00 00 30       	add    $0x30000000,%eax
+  802101:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802104:	5d                   	pop    %ebp
+  802105:	c3                   	ret
+
+00802106 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802106:	55                   	push   %ebp
+  802107:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802109:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802111:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802116:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80211b:	5d                   	pop    %ebp
+  80211c:	c3                   	ret
+
+0080211d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80211d:	55                   	push   %ebp
+  80211e:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802120:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802125:	eb 02                	jmp    802129 <fd_alloc+0xc>
+  802127:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802129:	89 c2                	mov    %eax,%edx
+  80212b:	c1 ea 16             	shr    $0x16,%edx
+  80212e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802135:	f6 c2 01             	test   $0x1,%dl
+  802138:	74 2b                	je     802165 <fd_alloc+0x48>
+  80213a:	89 c2                	mov    %eax,%edx
+  80213c:	c1 ea 0c             	shr    $0xc,%edx
+  80213f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802146:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80214c:	f6 c1 01             	test   $0x1,%cl
+  80214f:	74 14                	je     802165 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802151:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802157:	75 ce                	jne    802127 <fd_alloc+0xa>
+  802159:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80215e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802163:	eb 05                	jmp    80216a <fd_alloc+0x4d>
+			return 0;
+  802165:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80216a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80216d:	89 02                	mov    %eax,(%edx)
+}
+  80216f:	89 c8                	mov    %ecx,%eax
+  802171:	5d                   	pop    %ebp
+  802172:	c3                   	ret
+
+00802173 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802173:	55                   	push   %ebp
+  802174:	89 e5                	mov    %esp,%ebp
+  802176:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802179:	83 f8 1f             	cmp    $0x1f,%eax
+  80217c:	77 30                	ja     8021ae <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80217e:	c1 e0 0c             	shl    $0xc,%eax
+  802181:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802186:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80218c:	f6 c2 01             	test   $0x1,%dl
+  80218f:	74 24                	je     8021b5 <fd_lookup+0x42>
+  802191:	89 c2                	mov    %eax,%edx
+  802193:	c1 ea 0c             	shr    $0xc,%edx
+  802196:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80219d:	f6 c2 01             	test   $0x1,%dl
+  8021a0:	74 1a                	je     8021bc <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8021a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021a5:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8021a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ac:	5d                   	pop    %ebp
+  8021ad:	c3                   	ret
+		return -E_INVAL;
+  8021ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021b3:	eb f7                	jmp    8021ac <fd_lookup+0x39>
+		return -E_INVAL;
+  8021b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ba:	eb f0                	jmp    8021ac <fd_lookup+0x39>
+  8021bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021c1:	eb e9                	jmp    8021ac <fd_lookup+0x39>
+
+008021c3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8021c3:	55                   	push   %ebp
+  8021c4:	89 e5                	mov    %esp,%ebp
+  8021c6:	53                   	push   %ebx
+  8021c7:	83 ec 04             	sub    $0x4,%esp
+  8021ca:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d2:	eb 03                	jmp    8021d7 <dev_lookup+0x14>
+  8021d4:	83 c0 01             	add    $0x1,%eax
+  8021d7:	8b 1c 85 2c 39 80 00 	mov    0x80392c(,%eax,4),%ebx
+  8021de:	85 db                	test   %ebx,%ebx
+  8021e0:	74 0b                	je     8021ed <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8021e2:	39 13                	cmp    %edx,(%ebx)
+  8021e4:	75 ee                	jne    8021d4 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8021e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021eb:	eb 2e                	jmp    80221b <dev_lookup+0x58>
+  8021ed:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8021ef:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8021f4:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8021fa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8021ff:	76 24                	jbe    802225 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802201:	8b 41 48             	mov    0x48(%ecx),%eax
+  802204:	83 ec 04             	sub    $0x4,%esp
+  802207:	52                   	push   %edx
+  802208:	50                   	push   %eax
+  802209:	68 b0 38 80 00       	push   $0x8038b0
+  80220e:	e8 a5 e0 ff ff       	call   8002b8 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80221b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80221e:	89 1a                	mov    %ebx,(%edx)
+}
+  802220:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802223:	c9                   	leave
+  802224:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802225:	c1 e8 10             	shr    $0x10,%eax
+  802228:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80222e:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802234:	eb cb                	jmp    802201 <dev_lookup+0x3e>
+
+00802236 <fd_close>:
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	57                   	push   %edi
+  80223a:	56                   	push   %esi
+  80223b:	53                   	push   %ebx
+  80223c:	83 ec 24             	sub    $0x24,%esp
+  80223f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802242:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802245:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802248:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802249:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80224f:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802252:	50                   	push   %eax
+  802253:	e8 1b ff ff ff       	call   802173 <fd_lookup>
+  802258:	89 c3                	mov    %eax,%ebx
+  80225a:	83 c4 10             	add    $0x10,%esp
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	78 05                	js     802266 <fd_close+0x30>
+	    || fd != fd2)
+  802261:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802264:	74 16                	je     80227c <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802266:	89 f8                	mov    %edi,%eax
+  802268:	84 c0                	test   %al,%al
+  80226a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802272:	89 d8                	mov    %ebx,%eax
+  802274:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802277:	5b                   	pop    %ebx
+  802278:	5e                   	pop    %esi
+  802279:	5f                   	pop    %edi
+  80227a:	5d                   	pop    %ebp
+  80227b:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80227c:	83 ec 08             	sub    $0x8,%esp
+  80227f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802282:	50                   	push   %eax
+  802283:	ff 36                	push   (%esi)
+  802285:	e8 39 ff ff ff       	call   8021c3 <dev_lookup>
+  80228a:	89 c3                	mov    %eax,%ebx
+  80228c:	83 c4 10             	add    $0x10,%esp
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 1a                	js     8022ad <fd_close+0x77>
+		if (dev->dev_close)
+  802293:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802296:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802299:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	74 0b                	je     8022ad <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8022a2:	83 ec 0c             	sub    $0xc,%esp
+  8022a5:	56                   	push   %esi
+  8022a6:	ff d0                	call   *%eax
+  8022a8:	89 c3                	mov    %eax,%ebx
+  8022aa:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8022ad:	83 ec 08             	sub    $0x8,%esp
+  8022b0:	56                   	push   %esi
+  8022b1:	6a 00                	push   $0x0
+  8022b3:	e8 1b ec ff ff       	call   800ed3 <sys_page_unmap>
+	return r;
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	eb b5                	jmp    802272 <fd_close+0x3c>
+
+008022bd <close>:
+
+int
+close(int fdnum)
+{
+  8022bd:	55                   	push   %ebp
+  8022be:	89 e5                	mov    %esp,%ebp
+  8022c0:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c6:	50                   	push   %eax
+  8022c7:	ff 75 08             	push   0x8(%ebp)
+  8022ca:	e8 a4 fe ff ff       	call   802173 <fd_lookup>
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	79 02                	jns    8022d8 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8022d6:	c9                   	leave
+  8022d7:	c3                   	ret
+		return fd_close(fd, 1);
+  8022d8:	83 ec 08             	sub    $0x8,%esp
+  8022db:	6a 01                	push   $0x1
+  8022dd:	ff 75 f4             	push   -0xc(%ebp)
+  8022e0:	e8 51 ff ff ff       	call   802236 <fd_close>
+  8022e5:	83 c4 10             	add    $0x10,%esp
+  8022e8:	eb ec                	jmp    8022d6 <close+0x19>
+
+008022ea <close_all>:
+
+void
+close_all(void)
+{
+  8022ea:	55                   	push   %ebp
+  8022eb:	89 e5                	mov    %esp,%ebp
+  8022ed:	53                   	push   %ebx
+  8022ee:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8022f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8022f6:	83 ec 0c             	sub    $0xc,%esp
+  8022f9:	53                   	push   %ebx
+  8022fa:	e8 be ff ff ff       	call   8022bd <close>
+	for (i = 0; i < MAXFD; i++)
+  8022ff:	83 c3 01             	add    $0x1,%ebx
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	83 fb 20             	cmp    $0x20,%ebx
+  802308:	75 ec                	jne    8022f6 <close_all+0xc>
+}
+  80230a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80230d:	c9                   	leave
+  80230e:	c3                   	ret
+
+0080230f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80230f:	55                   	push   %ebp
+  802310:	89 e5                	mov    %esp,%ebp
+  802312:	57                   	push   %edi
+  802313:	56                   	push   %esi
+  802314:	53                   	push   %ebx
+  802315:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802318:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80231b:	50                   	push   %eax
+  80231c:	ff 75 08             	push   0x8(%ebp)
+  80231f:	e8 4f fe ff ff       	call   802173 <fd_lookup>
+  802324:	89 c3                	mov    %eax,%ebx
+  802326:	83 c4 10             	add    $0x10,%esp
+  802329:	85 c0                	test   %eax,%eax
+  80232b:	78 7f                	js     8023ac <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80232d:	83 ec 0c             	sub    $0xc,%esp
+  802330:	ff 75 0c             	push   0xc(%ebp)
+  802333:	e8 85 ff ff ff       	call   8022bd <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802338:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80233b:	c1 e6 0c             	shl    $0xc,%esi
+  80233e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802344:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802347:	89 3c 24             	mov    %edi,(%esp)
+  80234a:	e8 b7 fd ff ff       	call   802106 <fd2data>
+  80234f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802351:	89 34 24             	mov    %esi,(%esp)
+  802354:	e8 ad fd ff ff       	call   802106 <fd2data>
+  802359:	83 c4 10             	add    $0x10,%esp
+  80235c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80235f:	89 d8                	mov    %ebx,%eax
+  802361:	c1 e8 16             	shr    $0x16,%eax
+  802364:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80236b:	a8 01                	test   $0x1,%al
+  80236d:	74 11                	je     802380 <dup+0x71>
+  80236f:	89 d8                	mov    %ebx,%eax
+  802371:	c1 e8 0c             	shr    $0xc,%eax
+  802374:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80237b:	f6 c2 01             	test   $0x1,%dl
+  80237e:	75 36                	jne    8023b6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802380:	89 f8                	mov    %edi,%eax
+  802382:	c1 e8 0c             	shr    $0xc,%eax
+  802385:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80238c:	83 ec 0c             	sub    $0xc,%esp
+  80238f:	25 07 0e 00 00       	and    $0xe07,%eax
+  802394:	50                   	push   %eax
+  802395:	56                   	push   %esi
+  802396:	6a 00                	push   $0x0
+  802398:	57                   	push   %edi
+  802399:	6a 00                	push   $0x0
+  80239b:	e8 c5 ea ff ff       	call   800e65 <sys_page_map>
+  8023a0:	89 c3                	mov    %eax,%ebx
+  8023a2:	83 c4 20             	add    $0x20,%esp
+  8023a5:	85 c0                	test   %eax,%eax
+  8023a7:	78 33                	js     8023dc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8023a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8023ac:	89 d8                	mov    %ebx,%eax
+  8023ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023b1:	5b                   	pop    %ebx
+  8023b2:	5e                   	pop    %esi
+  8023b3:	5f                   	pop    %edi
+  8023b4:	5d                   	pop    %ebp
+  8023b5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8023b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8023bd:	83 ec 0c             	sub    $0xc,%esp
+  8023c0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8023c5:	50                   	push   %eax
+  8023c6:	ff 75 d4             	push   -0x2c(%ebp)
+  8023c9:	6a 00                	push   $0x0
+  8023cb:	53                   	push   %ebx
+  8023cc:	6a 00                	push   $0x0
+  8023ce:	e8 92 ea ff ff       	call   800e65 <sys_page_map>
+  8023d3:	89 c3                	mov    %eax,%ebx
+  8023d5:	83 c4 20             	add    $0x20,%esp
+  8023d8:	85 c0                	test   %eax,%eax
+  8023da:	79 a4                	jns    802380 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8023dc:	83 ec 08             	sub    $0x8,%esp
+  8023df:	56                   	push   %esi
+  8023e0:	6a 00                	push   $0x0
+  8023e2:	e8 ec ea ff ff       	call   800ed3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8023e7:	83 c4 08             	add    $0x8,%esp
+  8023ea:	ff 75 d4             	push   -0x2c(%ebp)
+  8023ed:	6a 00                	push   $0x0
+  8023ef:	e8 df ea ff ff       	call   800ed3 <sys_page_unmap>
+	return r;
+  8023f4:	83 c4 10             	add    $0x10,%esp
+  8023f7:	eb b3                	jmp    8023ac <dup+0x9d>
+
+008023f9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8023f9:	55                   	push   %ebp
+  8023fa:	89 e5                	mov    %esp,%ebp
+  8023fc:	56                   	push   %esi
+  8023fd:	53                   	push   %ebx
+  8023fe:	83 ec 18             	sub    $0x18,%esp
+  802401:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802404:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802407:	50                   	push   %eax
+  802408:	53                   	push   %ebx
+  802409:	e8 65 fd ff ff       	call   802173 <fd_lookup>
+  80240e:	83 c4 10             	add    $0x10,%esp
+  802411:	85 c0                	test   %eax,%eax
+  802413:	78 3c                	js     802451 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802415:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802418:	83 ec 08             	sub    $0x8,%esp
+  80241b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80241e:	50                   	push   %eax
+  80241f:	ff 36                	push   (%esi)
+  802421:	e8 9d fd ff ff       	call   8021c3 <dev_lookup>
+  802426:	83 c4 10             	add    $0x10,%esp
+  802429:	85 c0                	test   %eax,%eax
+  80242b:	78 24                	js     802451 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80242d:	8b 46 08             	mov    0x8(%esi),%eax
+  802430:	83 e0 03             	and    $0x3,%eax
+  802433:	83 f8 01             	cmp    $0x1,%eax
+  802436:	74 20                	je     802458 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802438:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80243b:	8b 40 08             	mov    0x8(%eax),%eax
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	74 57                	je     802499 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802442:	83 ec 04             	sub    $0x4,%esp
+  802445:	ff 75 10             	push   0x10(%ebp)
+  802448:	ff 75 0c             	push   0xc(%ebp)
+  80244b:	56                   	push   %esi
+  80244c:	ff d0                	call   *%eax
+  80244e:	83 c4 10             	add    $0x10,%esp
+}
+  802451:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802454:	5b                   	pop    %ebx
+  802455:	5e                   	pop    %esi
+  802456:	5d                   	pop    %ebp
+  802457:	c3                   	ret
+  802458:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80245a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80245f:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802465:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80246a:	76 1c                	jbe    802488 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80246c:	8b 42 48             	mov    0x48(%edx),%eax
+  80246f:	83 ec 04             	sub    $0x4,%esp
+  802472:	53                   	push   %ebx
+  802473:	50                   	push   %eax
+  802474:	68 f1 38 80 00       	push   $0x8038f1
+  802479:	e8 3a de ff ff       	call   8002b8 <cprintf>
+		return -E_INVAL;
+  80247e:	83 c4 10             	add    $0x10,%esp
+  802481:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802486:	eb c9                	jmp    802451 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802488:	c1 e8 10             	shr    $0x10,%eax
+  80248b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802491:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802497:	eb d3                	jmp    80246c <read+0x73>
+		return -E_NOT_SUPP;
+  802499:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80249e:	eb b1                	jmp    802451 <read+0x58>
+
+008024a0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8024a0:	55                   	push   %ebp
+  8024a1:	89 e5                	mov    %esp,%ebp
+  8024a3:	57                   	push   %edi
+  8024a4:	56                   	push   %esi
+  8024a5:	53                   	push   %ebx
+  8024a6:	83 ec 0c             	sub    $0xc,%esp
+  8024a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024ac:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8024af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024b4:	eb 02                	jmp    8024b8 <readn+0x18>
+  8024b6:	01 c3                	add    %eax,%ebx
+  8024b8:	39 f3                	cmp    %esi,%ebx
+  8024ba:	73 21                	jae    8024dd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8024bc:	83 ec 04             	sub    $0x4,%esp
+  8024bf:	89 f0                	mov    %esi,%eax
+  8024c1:	29 d8                	sub    %ebx,%eax
+  8024c3:	50                   	push   %eax
+  8024c4:	89 d8                	mov    %ebx,%eax
+  8024c6:	03 45 0c             	add    0xc(%ebp),%eax
+  8024c9:	50                   	push   %eax
+  8024ca:	57                   	push   %edi
+  8024cb:	e8 29 ff ff ff       	call   8023f9 <read>
+		if (m < 0)
+  8024d0:	83 c4 10             	add    $0x10,%esp
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	78 04                	js     8024db <readn+0x3b>
+			return m;
+		if (m == 0)
+  8024d7:	75 dd                	jne    8024b6 <readn+0x16>
+  8024d9:	eb 02                	jmp    8024dd <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8024db:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8024dd:	89 d8                	mov    %ebx,%eax
+  8024df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e2:	5b                   	pop    %ebx
+  8024e3:	5e                   	pop    %esi
+  8024e4:	5f                   	pop    %edi
+  8024e5:	5d                   	pop    %ebp
+  8024e6:	c3                   	ret
+
+008024e7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	56                   	push   %esi
+  8024eb:	53                   	push   %ebx
+  8024ec:	83 ec 18             	sub    $0x18,%esp
+  8024ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024f2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024f5:	50                   	push   %eax
+  8024f6:	53                   	push   %ebx
+  8024f7:	e8 77 fc ff ff       	call   802173 <fd_lookup>
+  8024fc:	83 c4 10             	add    $0x10,%esp
+  8024ff:	85 c0                	test   %eax,%eax
+  802501:	78 37                	js     80253a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802503:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802506:	83 ec 08             	sub    $0x8,%esp
+  802509:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80250c:	50                   	push   %eax
+  80250d:	ff 36                	push   (%esi)
+  80250f:	e8 af fc ff ff       	call   8021c3 <dev_lookup>
+  802514:	83 c4 10             	add    $0x10,%esp
+  802517:	85 c0                	test   %eax,%eax
+  802519:	78 1f                	js     80253a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80251b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80251f:	74 20                	je     802541 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802521:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802524:	8b 40 0c             	mov    0xc(%eax),%eax
+  802527:	85 c0                	test   %eax,%eax
+  802529:	74 57                	je     802582 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80252b:	83 ec 04             	sub    $0x4,%esp
+  80252e:	ff 75 10             	push   0x10(%ebp)
+  802531:	ff 75 0c             	push   0xc(%ebp)
+  802534:	56                   	push   %esi
+  802535:	ff d0                	call   *%eax
+  802537:	83 c4 10             	add    $0x10,%esp
+}
+  80253a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80253d:	5b                   	pop    %ebx
+  80253e:	5e                   	pop    %esi
+  80253f:	5d                   	pop    %ebp
+  802540:	c3                   	ret
+  802541:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802543:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802548:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80254e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802553:	76 1c                	jbe    802571 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802555:	8b 42 48             	mov    0x48(%edx),%eax
+  802558:	83 ec 04             	sub    $0x4,%esp
+  80255b:	53                   	push   %ebx
+  80255c:	50                   	push   %eax
+  80255d:	68 0d 39 80 00       	push   $0x80390d
+  802562:	e8 51 dd ff ff       	call   8002b8 <cprintf>
+		return -E_INVAL;
+  802567:	83 c4 10             	add    $0x10,%esp
+  80256a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80256f:	eb c9                	jmp    80253a <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802571:	c1 e8 10             	shr    $0x10,%eax
+  802574:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80257a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802580:	eb d3                	jmp    802555 <write+0x6e>
+		return -E_NOT_SUPP;
+  802582:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802587:	eb b1                	jmp    80253a <write+0x53>
+
+00802589 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802589:	55                   	push   %ebp
+  80258a:	89 e5                	mov    %esp,%ebp
+  80258c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80258f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802592:	50                   	push   %eax
+  802593:	ff 75 08             	push   0x8(%ebp)
+  802596:	e8 d8 fb ff ff       	call   802173 <fd_lookup>
+  80259b:	83 c4 10             	add    $0x10,%esp
+  80259e:	85 c0                	test   %eax,%eax
+  8025a0:	78 0e                	js     8025b0 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8025a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8025a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025a8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8025ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b0:	c9                   	leave
+  8025b1:	c3                   	ret
+
+008025b2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8025b2:	55                   	push   %ebp
+  8025b3:	89 e5                	mov    %esp,%ebp
+  8025b5:	56                   	push   %esi
+  8025b6:	53                   	push   %ebx
+  8025b7:	83 ec 18             	sub    $0x18,%esp
+  8025ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025c0:	50                   	push   %eax
+  8025c1:	53                   	push   %ebx
+  8025c2:	e8 ac fb ff ff       	call   802173 <fd_lookup>
+  8025c7:	83 c4 10             	add    $0x10,%esp
+  8025ca:	85 c0                	test   %eax,%eax
+  8025cc:	78 34                	js     802602 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025ce:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025d1:	83 ec 08             	sub    $0x8,%esp
+  8025d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025d7:	50                   	push   %eax
+  8025d8:	ff 36                	push   (%esi)
+  8025da:	e8 e4 fb ff ff       	call   8021c3 <dev_lookup>
+  8025df:	83 c4 10             	add    $0x10,%esp
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	78 1c                	js     802602 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025e6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8025ea:	74 1d                	je     802609 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8025ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025ef:	8b 40 18             	mov    0x18(%eax),%eax
+  8025f2:	85 c0                	test   %eax,%eax
+  8025f4:	74 54                	je     80264a <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8025f6:	83 ec 08             	sub    $0x8,%esp
+  8025f9:	ff 75 0c             	push   0xc(%ebp)
+  8025fc:	56                   	push   %esi
+  8025fd:	ff d0                	call   *%eax
+  8025ff:	83 c4 10             	add    $0x10,%esp
+}
+  802602:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802605:	5b                   	pop    %ebx
+  802606:	5e                   	pop    %esi
+  802607:	5d                   	pop    %ebp
+  802608:	c3                   	ret
+  802609:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80260b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802610:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802616:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80261b:	76 1c                	jbe    802639 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  80261d:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802620:	83 ec 04             	sub    $0x4,%esp
+  802623:	53                   	push   %ebx
+  802624:	50                   	push   %eax
+  802625:	68 d0 38 80 00       	push   $0x8038d0
+  80262a:	e8 89 dc ff ff       	call   8002b8 <cprintf>
+		return -E_INVAL;
+  80262f:	83 c4 10             	add    $0x10,%esp
+  802632:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802637:	eb c9                	jmp    802602 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802639:	c1 e8 10             	shr    $0x10,%eax
+  80263c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802642:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802648:	eb d3                	jmp    80261d <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  80264a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80264f:	eb b1                	jmp    802602 <ftruncate+0x50>
+
+00802651 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802651:	55                   	push   %ebp
+  802652:	89 e5                	mov    %esp,%ebp
+  802654:	56                   	push   %esi
+  802655:	53                   	push   %ebx
+  802656:	83 ec 18             	sub    $0x18,%esp
+  802659:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80265c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80265f:	50                   	push   %eax
+  802660:	ff 75 08             	push   0x8(%ebp)
+  802663:	e8 0b fb ff ff       	call   802173 <fd_lookup>
+  802668:	83 c4 10             	add    $0x10,%esp
+  80266b:	85 c0                	test   %eax,%eax
+  80266d:	78 49                	js     8026b8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80266f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802672:	83 ec 08             	sub    $0x8,%esp
+  802675:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802678:	50                   	push   %eax
+  802679:	ff 36                	push   (%esi)
+  80267b:	e8 43 fb ff ff       	call   8021c3 <dev_lookup>
+  802680:	83 c4 10             	add    $0x10,%esp
+  802683:	85 c0                	test   %eax,%eax
+  802685:	78 31                	js     8026b8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802687:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80268a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80268e:	74 2f                	je     8026bf <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802690:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802693:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80269a:	00 00 00 
+	stat->st_isdir = 0;
+  80269d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026a4:	00 00 00 
+	stat->st_dev = dev;
+  8026a7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8026ad:	83 ec 08             	sub    $0x8,%esp
+  8026b0:	53                   	push   %ebx
+  8026b1:	56                   	push   %esi
+  8026b2:	ff 50 14             	call   *0x14(%eax)
+  8026b5:	83 c4 10             	add    $0x10,%esp
+}
+  8026b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026bb:	5b                   	pop    %ebx
+  8026bc:	5e                   	pop    %esi
+  8026bd:	5d                   	pop    %ebp
+  8026be:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026c4:	eb f2                	jmp    8026b8 <fstat+0x67>
+
+008026c6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	56                   	push   %esi
+  8026ca:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8026cb:	83 ec 08             	sub    $0x8,%esp
+  8026ce:	6a 00                	push   $0x0
+  8026d0:	ff 75 08             	push   0x8(%ebp)
+  8026d3:	e8 e4 01 00 00       	call   8028bc <open>
+  8026d8:	89 c3                	mov    %eax,%ebx
+  8026da:	83 c4 10             	add    $0x10,%esp
+  8026dd:	85 c0                	test   %eax,%eax
+  8026df:	78 1b                	js     8026fc <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8026e1:	83 ec 08             	sub    $0x8,%esp
+  8026e4:	ff 75 0c             	push   0xc(%ebp)
+  8026e7:	50                   	push   %eax
+  8026e8:	e8 64 ff ff ff       	call   802651 <fstat>
+  8026ed:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8026ef:	89 1c 24             	mov    %ebx,(%esp)
+  8026f2:	e8 c6 fb ff ff       	call   8022bd <close>
+	return r;
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	89 f3                	mov    %esi,%ebx
+}
+  8026fc:	89 d8                	mov    %ebx,%eax
+  8026fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802701:	5b                   	pop    %ebx
+  802702:	5e                   	pop    %esi
+  802703:	5d                   	pop    %ebp
+  802704:	c3                   	ret
+
+00802705 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	56                   	push   %esi
+  802709:	53                   	push   %ebx
+  80270a:	89 c6                	mov    %eax,%esi
+  80270c:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80270e:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  802715:	74 27                	je     80273e <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802717:	6a 07                	push   $0x7
+  802719:	68 00 60 80 00       	push   $0x806000
+  80271e:	56                   	push   %esi
+  80271f:	ff 35 00 50 80 00    	push   0x805000
+  802725:	e8 17 f7 ff ff       	call   801e41 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80272a:	83 c4 0c             	add    $0xc,%esp
+  80272d:	6a 00                	push   $0x0
+  80272f:	53                   	push   %ebx
+  802730:	6a 00                	push   $0x0
+  802732:	e8 f2 f6 ff ff       	call   801e29 <ipc_recv>
+}
+  802737:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80273a:	5b                   	pop    %ebx
+  80273b:	5e                   	pop    %esi
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80273e:	83 ec 0c             	sub    $0xc,%esp
+  802741:	6a 01                	push   $0x1
+  802743:	e8 4d f7 ff ff       	call   801e95 <ipc_find_env>
+  802748:	a3 00 50 80 00       	mov    %eax,0x805000
+  80274d:	83 c4 10             	add    $0x10,%esp
+  802750:	eb c5                	jmp    802717 <fsipc+0x12>
+
+00802752 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802758:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80275e:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802763:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802766:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80276b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802770:	b8 02 00 00 00       	mov    $0x2,%eax
+  802775:	e8 8b ff ff ff       	call   802705 <fsipc>
+}
+  80277a:	c9                   	leave
+  80277b:	c3                   	ret
+
+0080277c <devfile_flush>:
+{
+  80277c:	55                   	push   %ebp
+  80277d:	89 e5                	mov    %esp,%ebp
+  80277f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802782:	8b 45 08             	mov    0x8(%ebp),%eax
+  802785:	8b 40 0c             	mov    0xc(%eax),%eax
+  802788:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80278d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802792:	b8 06 00 00 00       	mov    $0x6,%eax
+  802797:	e8 69 ff ff ff       	call   802705 <fsipc>
+}
+  80279c:	c9                   	leave
+  80279d:	c3                   	ret
+
+0080279e <devfile_stat>:
+{
+  80279e:	55                   	push   %ebp
+  80279f:	89 e5                	mov    %esp,%ebp
+  8027a1:	53                   	push   %ebx
+  8027a2:	83 ec 04             	sub    $0x4,%esp
+  8027a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ab:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027ae:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8027b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027bd:	e8 43 ff ff ff       	call   802705 <fsipc>
+  8027c2:	85 c0                	test   %eax,%eax
+  8027c4:	78 2c                	js     8027f2 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8027c6:	83 ec 08             	sub    $0x8,%esp
+  8027c9:	68 00 60 80 00       	push   $0x806000
+  8027ce:	53                   	push   %ebx
+  8027cf:	e8 2c e1 ff ff       	call   800900 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8027d4:	a1 80 60 80 00       	mov    0x806080,%eax
+  8027d9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8027df:	a1 84 60 80 00       	mov    0x806084,%eax
+  8027e4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8027ea:	83 c4 10             	add    $0x10,%esp
+  8027ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027f5:	c9                   	leave
+  8027f6:	c3                   	ret
+
+008027f7 <devfile_write>:
+{
+  8027f7:	55                   	push   %ebp
+  8027f8:	89 e5                	mov    %esp,%ebp
+  8027fa:	83 ec 0c             	sub    $0xc,%esp
+  8027fd:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802800:	8b 55 08             	mov    0x8(%ebp),%edx
+  802803:	8b 52 0c             	mov    0xc(%edx),%edx
+  802806:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  80280c:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  802811:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802816:	39 d0                	cmp    %edx,%eax
+  802818:	0f 47 c2             	cmova  %edx,%eax
+  80281b:	50                   	push   %eax
+  80281c:	ff 75 0c             	push   0xc(%ebp)
+  80281f:	68 08 60 80 00       	push   $0x806008
+  802824:	e8 5d e2 ff ff       	call   800a86 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802829:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802833:	e8 cd fe ff ff       	call   802705 <fsipc>
+}
+  802838:	c9                   	leave
+  802839:	c3                   	ret
+
+0080283a <devfile_read>:
+{
+  80283a:	55                   	push   %ebp
+  80283b:	89 e5                	mov    %esp,%ebp
+  80283d:	56                   	push   %esi
+  80283e:	53                   	push   %ebx
+  80283f:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802842:	8b 45 08             	mov    0x8(%ebp),%eax
+  802845:	8b 40 0c             	mov    0xc(%eax),%eax
+  802848:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80284d:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802853:	ba 00 00 00 00       	mov    $0x0,%edx
+  802858:	b8 03 00 00 00       	mov    $0x3,%eax
+  80285d:	e8 a3 fe ff ff       	call   802705 <fsipc>
+  802862:	89 c3                	mov    %eax,%ebx
+  802864:	85 c0                	test   %eax,%eax
+  802866:	78 1f                	js     802887 <devfile_read+0x4d>
+	assert(r <= n);
+  802868:	39 c6                	cmp    %eax,%esi
+  80286a:	72 24                	jb     802890 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80286c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802871:	7f 33                	jg     8028a6 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802873:	83 ec 04             	sub    $0x4,%esp
+  802876:	50                   	push   %eax
+  802877:	68 00 60 80 00       	push   $0x806000
+  80287c:	ff 75 0c             	push   0xc(%ebp)
+  80287f:	e8 02 e2 ff ff       	call   800a86 <memmove>
+	return r;
+  802884:	83 c4 10             	add    $0x10,%esp
+}
+  802887:	89 d8                	mov    %ebx,%eax
+  802889:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80288c:	5b                   	pop    %ebx
+  80288d:	5e                   	pop    %esi
+  80288e:	5d                   	pop    %ebp
+  80288f:	c3                   	ret
+	assert(r <= n);
+  802890:	68 40 39 80 00       	push   $0x803940
+  802895:	68 10 38 80 00       	push   $0x803810
+  80289a:	6a 76                	push   $0x76
+  80289c:	68 47 39 80 00       	push   $0x803947
+  8028a1:	e8 37 d9 ff ff       	call   8001dd <_panic>
+	assert(r <= PGSIZE);
+  8028a6:	68 52 39 80 00       	push   $0x803952
+  8028ab:	68 10 38 80 00       	push   $0x803810
+  8028b0:	6a 77                	push   $0x77
+  8028b2:	68 47 39 80 00       	push   $0x803947
+  8028b7:	e8 21 d9 ff ff       	call   8001dd <_panic>
+
+008028bc <open>:
+{
+  8028bc:	55                   	push   %ebp
+  8028bd:	89 e5                	mov    %esp,%ebp
+  8028bf:	56                   	push   %esi
+  8028c0:	53                   	push   %ebx
+  8028c1:	83 ec 1c             	sub    $0x1c,%esp
+  8028c4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8028c7:	56                   	push   %esi
+  8028c8:	e8 f8 df ff ff       	call   8008c5 <strlen>
+  8028cd:	83 c4 10             	add    $0x10,%esp
+  8028d0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028d5:	7f 6c                	jg     802943 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8028d7:	83 ec 0c             	sub    $0xc,%esp
+  8028da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028dd:	50                   	push   %eax
+  8028de:	e8 3a f8 ff ff       	call   80211d <fd_alloc>
+  8028e3:	89 c3                	mov    %eax,%ebx
+  8028e5:	83 c4 10             	add    $0x10,%esp
+  8028e8:	85 c0                	test   %eax,%eax
+  8028ea:	78 3c                	js     802928 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8028ec:	83 ec 08             	sub    $0x8,%esp
+  8028ef:	56                   	push   %esi
+  8028f0:	68 00 60 80 00       	push   $0x806000
+  8028f5:	e8 06 e0 ff ff       	call   800900 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8028fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028fd:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802902:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802905:	b8 01 00 00 00       	mov    $0x1,%eax
+  80290a:	e8 f6 fd ff ff       	call   802705 <fsipc>
+  80290f:	89 c3                	mov    %eax,%ebx
+  802911:	83 c4 10             	add    $0x10,%esp
+  802914:	85 c0                	test   %eax,%eax
+  802916:	78 19                	js     802931 <open+0x75>
+	return fd2num(fd);
+  802918:	83 ec 0c             	sub    $0xc,%esp
+  80291b:	ff 75 f4             	push   -0xc(%ebp)
+  80291e:	e8 d3 f7 ff ff       	call   8020f6 <fd2num>
+  802923:	89 c3                	mov    %eax,%ebx
+  802925:	83 c4 10             	add    $0x10,%esp
+}
+  802928:	89 d8                	mov    %ebx,%eax
+  80292a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80292d:	5b                   	pop    %ebx
+  80292e:	5e                   	pop    %esi
+  80292f:	5d                   	pop    %ebp
+  802930:	c3                   	ret
+		fd_close(fd, 0);
+  802931:	83 ec 08             	sub    $0x8,%esp
+  802934:	6a 00                	push   $0x0
+  802936:	ff 75 f4             	push   -0xc(%ebp)
+  802939:	e8 f8 f8 ff ff       	call   802236 <fd_close>
+		return r;
+  80293e:	83 c4 10             	add    $0x10,%esp
+  802941:	eb e5                	jmp    802928 <open+0x6c>
+		return -E_BAD_PATH;
+  802943:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802948:	eb de                	jmp    802928 <open+0x6c>
+
+0080294a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80294a:	55                   	push   %ebp
+  80294b:	89 e5                	mov    %esp,%ebp
+  80294d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802950:	ba 00 00 00 00       	mov    $0x0,%edx
+  802955:	b8 08 00 00 00       	mov    $0x8,%eax
+  80295a:	e8 a6 fd ff ff       	call   802705 <fsipc>
+}
+  80295f:	c9                   	leave
+  802960:	c3                   	ret
+
+00802961 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802961:	55                   	push   %ebp
+  802962:	89 e5                	mov    %esp,%ebp
+  802964:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802967:	68 5e 39 80 00       	push   $0x80395e
+  80296c:	ff 75 0c             	push   0xc(%ebp)
+  80296f:	e8 8c df ff ff       	call   800900 <strcpy>
+	return 0;
+}
+  802974:	b8 00 00 00 00       	mov    $0x0,%eax
+  802979:	c9                   	leave
+  80297a:	c3                   	ret
+
+0080297b <devsock_close>:
+{
+  80297b:	55                   	push   %ebp
+  80297c:	89 e5                	mov    %esp,%ebp
+  80297e:	53                   	push   %ebx
+  80297f:	83 ec 10             	sub    $0x10,%esp
+  802982:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802985:	53                   	push   %ebx
+  802986:	e8 f3 09 00 00       	call   80337e <pageref>
+  80298b:	89 c2                	mov    %eax,%edx
+  80298d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802990:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802995:	83 fa 01             	cmp    $0x1,%edx
+  802998:	74 05                	je     80299f <devsock_close+0x24>
+}
+  80299a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80299d:	c9                   	leave
+  80299e:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80299f:	83 ec 0c             	sub    $0xc,%esp
+  8029a2:	ff 73 0c             	push   0xc(%ebx)
+  8029a5:	e8 b7 02 00 00       	call   802c61 <nsipc_close>
+  8029aa:	83 c4 10             	add    $0x10,%esp
+  8029ad:	eb eb                	jmp    80299a <devsock_close+0x1f>
+
+008029af <devsock_write>:
+{
+  8029af:	55                   	push   %ebp
+  8029b0:	89 e5                	mov    %esp,%ebp
+  8029b2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8029b5:	6a 00                	push   $0x0
+  8029b7:	ff 75 10             	push   0x10(%ebp)
+  8029ba:	ff 75 0c             	push   0xc(%ebp)
+  8029bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c0:	ff 70 0c             	push   0xc(%eax)
+  8029c3:	e8 79 03 00 00       	call   802d41 <nsipc_send>
+}
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+008029ca <devsock_read>:
+{
+  8029ca:	55                   	push   %ebp
+  8029cb:	89 e5                	mov    %esp,%ebp
+  8029cd:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8029d0:	6a 00                	push   $0x0
+  8029d2:	ff 75 10             	push   0x10(%ebp)
+  8029d5:	ff 75 0c             	push   0xc(%ebp)
+  8029d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029db:	ff 70 0c             	push   0xc(%eax)
+  8029de:	e8 ef 02 00 00       	call   802cd2 <nsipc_recv>
+}
+  8029e3:	c9                   	leave
+  8029e4:	c3                   	ret
+
+008029e5 <fd2sockid>:
+{
+  8029e5:	55                   	push   %ebp
+  8029e6:	89 e5                	mov    %esp,%ebp
+  8029e8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8029eb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8029ee:	52                   	push   %edx
+  8029ef:	50                   	push   %eax
+  8029f0:	e8 7e f7 ff ff       	call   802173 <fd_lookup>
+  8029f5:	83 c4 10             	add    $0x10,%esp
+  8029f8:	85 c0                	test   %eax,%eax
+  8029fa:	78 10                	js     802a0c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8029fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ff:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a05:	39 08                	cmp    %ecx,(%eax)
+  802a07:	75 05                	jne    802a0e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802a09:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802a0c:	c9                   	leave
+  802a0d:	c3                   	ret
+		return -E_NOT_SUPP;
+  802a0e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802a13:	eb f7                	jmp    802a0c <fd2sockid+0x27>
+
+00802a15 <alloc_sockfd>:
+{
+  802a15:	55                   	push   %ebp
+  802a16:	89 e5                	mov    %esp,%ebp
+  802a18:	56                   	push   %esi
+  802a19:	53                   	push   %ebx
+  802a1a:	83 ec 1c             	sub    $0x1c,%esp
+  802a1d:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802a1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a22:	50                   	push   %eax
+  802a23:	e8 f5 f6 ff ff       	call   80211d <fd_alloc>
+  802a28:	89 c3                	mov    %eax,%ebx
+  802a2a:	83 c4 10             	add    $0x10,%esp
+  802a2d:	85 c0                	test   %eax,%eax
+  802a2f:	78 43                	js     802a74 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802a31:	83 ec 04             	sub    $0x4,%esp
+  802a34:	68 07 04 00 00       	push   $0x407
+  802a39:	ff 75 f4             	push   -0xc(%ebp)
+  802a3c:	6a 00                	push   $0x0
+  802a3e:	e8 b5 e3 ff ff       	call   800df8 <sys_page_alloc>
+  802a43:	89 c3                	mov    %eax,%ebx
+  802a45:	83 c4 10             	add    $0x10,%esp
+  802a48:	85 c0                	test   %eax,%eax
+  802a4a:	78 28                	js     802a74 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802a4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a4f:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a55:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802a57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a5a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802a61:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802a64:	83 ec 0c             	sub    $0xc,%esp
+  802a67:	50                   	push   %eax
+  802a68:	e8 89 f6 ff ff       	call   8020f6 <fd2num>
+  802a6d:	89 c3                	mov    %eax,%ebx
+  802a6f:	83 c4 10             	add    $0x10,%esp
+  802a72:	eb 0c                	jmp    802a80 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a74:	83 ec 0c             	sub    $0xc,%esp
+  802a77:	56                   	push   %esi
+  802a78:	e8 e4 01 00 00       	call   802c61 <nsipc_close>
+		return r;
+  802a7d:	83 c4 10             	add    $0x10,%esp
+}
+  802a80:	89 d8                	mov    %ebx,%eax
+  802a82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a85:	5b                   	pop    %ebx
+  802a86:	5e                   	pop    %esi
+  802a87:	5d                   	pop    %ebp
+  802a88:	c3                   	ret
+
+00802a89 <accept>:
+{
+  802a89:	55                   	push   %ebp
+  802a8a:	89 e5                	mov    %esp,%ebp
+  802a8c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a92:	e8 4e ff ff ff       	call   8029e5 <fd2sockid>
+  802a97:	85 c0                	test   %eax,%eax
+  802a99:	78 1b                	js     802ab6 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802a9b:	83 ec 04             	sub    $0x4,%esp
+  802a9e:	ff 75 10             	push   0x10(%ebp)
+  802aa1:	ff 75 0c             	push   0xc(%ebp)
+  802aa4:	50                   	push   %eax
+  802aa5:	e8 0e 01 00 00       	call   802bb8 <nsipc_accept>
+  802aaa:	83 c4 10             	add    $0x10,%esp
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 05                	js     802ab6 <accept+0x2d>
+	return alloc_sockfd(r);
+  802ab1:	e8 5f ff ff ff       	call   802a15 <alloc_sockfd>
+}
+  802ab6:	c9                   	leave
+  802ab7:	c3                   	ret
+
+00802ab8 <bind>:
+{
+  802ab8:	55                   	push   %ebp
+  802ab9:	89 e5                	mov    %esp,%ebp
+  802abb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802abe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac1:	e8 1f ff ff ff       	call   8029e5 <fd2sockid>
+  802ac6:	85 c0                	test   %eax,%eax
+  802ac8:	78 12                	js     802adc <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802aca:	83 ec 04             	sub    $0x4,%esp
+  802acd:	ff 75 10             	push   0x10(%ebp)
+  802ad0:	ff 75 0c             	push   0xc(%ebp)
+  802ad3:	50                   	push   %eax
+  802ad4:	e8 31 01 00 00       	call   802c0a <nsipc_bind>
+  802ad9:	83 c4 10             	add    $0x10,%esp
+}
+  802adc:	c9                   	leave
+  802add:	c3                   	ret
+
+00802ade <shutdown>:
+{
+  802ade:	55                   	push   %ebp
+  802adf:	89 e5                	mov    %esp,%ebp
+  802ae1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ae4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae7:	e8 f9 fe ff ff       	call   8029e5 <fd2sockid>
+  802aec:	85 c0                	test   %eax,%eax
+  802aee:	78 0f                	js     802aff <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802af0:	83 ec 08             	sub    $0x8,%esp
+  802af3:	ff 75 0c             	push   0xc(%ebp)
+  802af6:	50                   	push   %eax
+  802af7:	e8 43 01 00 00       	call   802c3f <nsipc_shutdown>
+  802afc:	83 c4 10             	add    $0x10,%esp
+}
+  802aff:	c9                   	leave
+  802b00:	c3                   	ret
+
+00802b01 <connect>:
+{
+  802b01:	55                   	push   %ebp
+  802b02:	89 e5                	mov    %esp,%ebp
+  802b04:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b07:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0a:	e8 d6 fe ff ff       	call   8029e5 <fd2sockid>
+  802b0f:	85 c0                	test   %eax,%eax
+  802b11:	78 12                	js     802b25 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802b13:	83 ec 04             	sub    $0x4,%esp
+  802b16:	ff 75 10             	push   0x10(%ebp)
+  802b19:	ff 75 0c             	push   0xc(%ebp)
+  802b1c:	50                   	push   %eax
+  802b1d:	e8 59 01 00 00       	call   802c7b <nsipc_connect>
+  802b22:	83 c4 10             	add    $0x10,%esp
+}
+  802b25:	c9                   	leave
+  802b26:	c3                   	ret
+
+00802b27 <listen>:
+{
+  802b27:	55                   	push   %ebp
+  802b28:	89 e5                	mov    %esp,%ebp
+  802b2a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b30:	e8 b0 fe ff ff       	call   8029e5 <fd2sockid>
+  802b35:	85 c0                	test   %eax,%eax
+  802b37:	78 0f                	js     802b48 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802b39:	83 ec 08             	sub    $0x8,%esp
+  802b3c:	ff 75 0c             	push   0xc(%ebp)
+  802b3f:	50                   	push   %eax
+  802b40:	e8 6b 01 00 00       	call   802cb0 <nsipc_listen>
+  802b45:	83 c4 10             	add    $0x10,%esp
+}
+  802b48:	c9                   	leave
+  802b49:	c3                   	ret
+
+00802b4a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802b4a:	55                   	push   %ebp
+  802b4b:	89 e5                	mov    %esp,%ebp
+  802b4d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802b50:	ff 75 10             	push   0x10(%ebp)
+  802b53:	ff 75 0c             	push   0xc(%ebp)
+  802b56:	ff 75 08             	push   0x8(%ebp)
+  802b59:	e8 41 02 00 00       	call   802d9f <nsipc_socket>
+  802b5e:	83 c4 10             	add    $0x10,%esp
+  802b61:	85 c0                	test   %eax,%eax
+  802b63:	78 05                	js     802b6a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b65:	e8 ab fe ff ff       	call   802a15 <alloc_sockfd>
+}
+  802b6a:	c9                   	leave
+  802b6b:	c3                   	ret
+
+00802b6c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b6c:	55                   	push   %ebp
+  802b6d:	89 e5                	mov    %esp,%ebp
+  802b6f:	53                   	push   %ebx
+  802b70:	83 ec 04             	sub    $0x4,%esp
+  802b73:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b75:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802b7c:	74 26                	je     802ba4 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b7e:	6a 07                	push   $0x7
+  802b80:	68 00 70 80 00       	push   $0x807000
+  802b85:	53                   	push   %ebx
+  802b86:	ff 35 04 50 80 00    	push   0x805004
+  802b8c:	e8 b0 f2 ff ff       	call   801e41 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b91:	83 c4 0c             	add    $0xc,%esp
+  802b94:	6a 00                	push   $0x0
+  802b96:	6a 00                	push   $0x0
+  802b98:	6a 00                	push   $0x0
+  802b9a:	e8 8a f2 ff ff       	call   801e29 <ipc_recv>
+}
+  802b9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba2:	c9                   	leave
+  802ba3:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ba4:	83 ec 0c             	sub    $0xc,%esp
+  802ba7:	6a 02                	push   $0x2
+  802ba9:	e8 e7 f2 ff ff       	call   801e95 <ipc_find_env>
+  802bae:	a3 04 50 80 00       	mov    %eax,0x805004
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	eb c6                	jmp    802b7e <nsipc+0x12>
+
+00802bb8 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802bb8:	55                   	push   %ebp
+  802bb9:	89 e5                	mov    %esp,%ebp
+  802bbb:	56                   	push   %esi
+  802bbc:	53                   	push   %ebx
+  802bbd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802bc8:	8b 06                	mov    (%esi),%eax
+  802bca:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802bcf:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bd4:	e8 93 ff ff ff       	call   802b6c <nsipc>
+  802bd9:	89 c3                	mov    %eax,%ebx
+  802bdb:	85 c0                	test   %eax,%eax
+  802bdd:	79 09                	jns    802be8 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802bdf:	89 d8                	mov    %ebx,%eax
+  802be1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be4:	5b                   	pop    %ebx
+  802be5:	5e                   	pop    %esi
+  802be6:	5d                   	pop    %ebp
+  802be7:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802be8:	83 ec 04             	sub    $0x4,%esp
+  802beb:	ff 35 10 70 80 00    	push   0x807010
+  802bf1:	68 00 70 80 00       	push   $0x807000
+  802bf6:	ff 75 0c             	push   0xc(%ebp)
+  802bf9:	e8 88 de ff ff       	call   800a86 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802bfe:	a1 10 70 80 00       	mov    0x807010,%eax
+  802c03:	89 06                	mov    %eax,(%esi)
+  802c05:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c08:	eb d5                	jmp    802bdf <nsipc_accept+0x27>
+
+00802c0a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c0a:	55                   	push   %ebp
+  802c0b:	89 e5                	mov    %esp,%ebp
+  802c0d:	53                   	push   %ebx
+  802c0e:	83 ec 08             	sub    $0x8,%esp
+  802c11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c17:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c1c:	53                   	push   %ebx
+  802c1d:	ff 75 0c             	push   0xc(%ebp)
+  802c20:	68 04 70 80 00       	push   $0x807004
+  802c25:	e8 5c de ff ff       	call   800a86 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c2a:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802c30:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c35:	e8 32 ff ff ff       	call   802b6c <nsipc>
+}
+  802c3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c3d:	c9                   	leave
+  802c3e:	c3                   	ret
+
+00802c3f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c3f:	55                   	push   %ebp
+  802c40:	89 e5                	mov    %esp,%ebp
+  802c42:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c48:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802c4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c50:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c55:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c5a:	e8 0d ff ff ff       	call   802b6c <nsipc>
+}
+  802c5f:	c9                   	leave
+  802c60:	c3                   	ret
+
+00802c61 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c61:	55                   	push   %ebp
+  802c62:	89 e5                	mov    %esp,%ebp
+  802c64:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c6a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802c6f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c74:	e8 f3 fe ff ff       	call   802b6c <nsipc>
+}
+  802c79:	c9                   	leave
+  802c7a:	c3                   	ret
+
+00802c7b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c7b:	55                   	push   %ebp
+  802c7c:	89 e5                	mov    %esp,%ebp
+  802c7e:	53                   	push   %ebx
+  802c7f:	83 ec 08             	sub    $0x8,%esp
+  802c82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c88:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c8d:	53                   	push   %ebx
+  802c8e:	ff 75 0c             	push   0xc(%ebp)
+  802c91:	68 04 70 80 00       	push   $0x807004
+  802c96:	e8 eb dd ff ff       	call   800a86 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c9b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802ca1:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ca6:	e8 c1 fe ff ff       	call   802b6c <nsipc>
+}
+  802cab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cae:	c9                   	leave
+  802caf:	c3                   	ret
+
+00802cb0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802cb0:	55                   	push   %ebp
+  802cb1:	89 e5                	mov    %esp,%ebp
+  802cb3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802cb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cb9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802cbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802cc6:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ccb:	e8 9c fe ff ff       	call   802b6c <nsipc>
+}
+  802cd0:	c9                   	leave
+  802cd1:	c3                   	ret
+
+00802cd2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802cd2:	55                   	push   %ebp
+  802cd3:	89 e5                	mov    %esp,%ebp
+  802cd5:	56                   	push   %esi
+  802cd6:	53                   	push   %ebx
+  802cd7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802cda:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cdd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802ce2:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802ce8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ceb:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802cf0:	b8 07 00 00 00       	mov    $0x7,%eax
+  802cf5:	e8 72 fe ff ff       	call   802b6c <nsipc>
+  802cfa:	89 c3                	mov    %eax,%ebx
+  802cfc:	85 c0                	test   %eax,%eax
+  802cfe:	78 22                	js     802d22 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d00:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d05:	39 c6                	cmp    %eax,%esi
+  802d07:	0f 4e c6             	cmovle %esi,%eax
+  802d0a:	39 c3                	cmp    %eax,%ebx
+  802d0c:	7f 1d                	jg     802d2b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d0e:	83 ec 04             	sub    $0x4,%esp
+  802d11:	53                   	push   %ebx
+  802d12:	68 00 70 80 00       	push   $0x807000
+  802d17:	ff 75 0c             	push   0xc(%ebp)
+  802d1a:	e8 67 dd ff ff       	call   800a86 <memmove>
+  802d1f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d22:	89 d8                	mov    %ebx,%eax
+  802d24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d27:	5b                   	pop    %ebx
+  802d28:	5e                   	pop    %esi
+  802d29:	5d                   	pop    %ebp
+  802d2a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d2b:	68 6a 39 80 00       	push   $0x80396a
+  802d30:	68 10 38 80 00       	push   $0x803810
+  802d35:	6a 62                	push   $0x62
+  802d37:	68 7f 39 80 00       	push   $0x80397f
+  802d3c:	e8 9c d4 ff ff       	call   8001dd <_panic>
+
+00802d41 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d41:	55                   	push   %ebp
+  802d42:	89 e5                	mov    %esp,%ebp
+  802d44:	53                   	push   %ebx
+  802d45:	83 ec 04             	sub    $0x4,%esp
+  802d48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4e:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802d53:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d59:	7f 2e                	jg     802d89 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d5b:	83 ec 04             	sub    $0x4,%esp
+  802d5e:	53                   	push   %ebx
+  802d5f:	ff 75 0c             	push   0xc(%ebp)
+  802d62:	68 0c 70 80 00       	push   $0x80700c
+  802d67:	e8 1a dd ff ff       	call   800a86 <memmove>
+	nsipcbuf.send.req_size = size;
+  802d6c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802d72:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d75:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802d7a:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d7f:	e8 e8 fd ff ff       	call   802b6c <nsipc>
+}
+  802d84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d87:	c9                   	leave
+  802d88:	c3                   	ret
+	assert(size < 1600);
+  802d89:	68 8b 39 80 00       	push   $0x80398b
+  802d8e:	68 10 38 80 00       	push   $0x803810
+  802d93:	6a 6d                	push   $0x6d
+  802d95:	68 7f 39 80 00       	push   $0x80397f
+  802d9a:	e8 3e d4 ff ff       	call   8001dd <_panic>
+
+00802d9f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d9f:	55                   	push   %ebp
+  802da0:	89 e5                	mov    %esp,%ebp
+  802da2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802da5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802dad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802db0:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802db5:	8b 45 10             	mov    0x10(%ebp),%eax
+  802db8:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802dbd:	b8 09 00 00 00       	mov    $0x9,%eax
+  802dc2:	e8 a5 fd ff ff       	call   802b6c <nsipc>
+}
+  802dc7:	c9                   	leave
+  802dc8:	c3                   	ret
+
+00802dc9 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802dc9:	55                   	push   %ebp
+  802dca:	89 e5                	mov    %esp,%ebp
+  802dcc:	56                   	push   %esi
+  802dcd:	53                   	push   %ebx
+  802dce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802dd1:	83 ec 0c             	sub    $0xc,%esp
+  802dd4:	ff 75 08             	push   0x8(%ebp)
+  802dd7:	e8 2a f3 ff ff       	call   802106 <fd2data>
+  802ddc:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802dde:	83 c4 08             	add    $0x8,%esp
+  802de1:	68 97 39 80 00       	push   $0x803997
+  802de6:	53                   	push   %ebx
+  802de7:	e8 14 db ff ff       	call   800900 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802dec:	8b 46 04             	mov    0x4(%esi),%eax
+  802def:	2b 06                	sub    (%esi),%eax
+  802df1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802df7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802dfe:	00 00 00 
+	stat->st_dev = &devpipe;
+  802e01:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802e08:	40 80 00 
+	return 0;
+}
+  802e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e13:	5b                   	pop    %ebx
+  802e14:	5e                   	pop    %esi
+  802e15:	5d                   	pop    %ebp
+  802e16:	c3                   	ret
+
+00802e17 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e17:	55                   	push   %ebp
+  802e18:	89 e5                	mov    %esp,%ebp
+  802e1a:	53                   	push   %ebx
+  802e1b:	83 ec 0c             	sub    $0xc,%esp
+  802e1e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e21:	53                   	push   %ebx
+  802e22:	6a 00                	push   $0x0
+  802e24:	e8 aa e0 ff ff       	call   800ed3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e29:	89 1c 24             	mov    %ebx,(%esp)
+  802e2c:	e8 d5 f2 ff ff       	call   802106 <fd2data>
+  802e31:	83 c4 08             	add    $0x8,%esp
+  802e34:	50                   	push   %eax
+  802e35:	6a 00                	push   $0x0
+  802e37:	e8 97 e0 ff ff       	call   800ed3 <sys_page_unmap>
+}
+  802e3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e3f:	c9                   	leave
+  802e40:	c3                   	ret
+
+00802e41 <_pipeisclosed>:
+{
+  802e41:	55                   	push   %ebp
+  802e42:	89 e5                	mov    %esp,%ebp
+  802e44:	57                   	push   %edi
+  802e45:	56                   	push   %esi
+  802e46:	53                   	push   %ebx
+  802e47:	83 ec 1c             	sub    $0x1c,%esp
+  802e4a:	89 c7                	mov    %eax,%edi
+  802e4c:	89 d6                	mov    %edx,%esi
+  802e4e:	eb 3c                	jmp    802e8c <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802e50:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802e53:	83 ec 0c             	sub    $0xc,%esp
+  802e56:	57                   	push   %edi
+  802e57:	e8 22 05 00 00       	call   80337e <pageref>
+  802e5c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e5f:	89 34 24             	mov    %esi,(%esp)
+  802e62:	e8 17 05 00 00       	call   80337e <pageref>
+  802e67:	89 c2                	mov    %eax,%edx
+  802e69:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e6b:	05 00 00 00 20       	add    $0x20000000,%eax
+  802e70:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802e73:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e79:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e7e:	76 31                	jbe    802eb1 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802e80:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802e83:	39 c3                	cmp    %eax,%ebx
+  802e85:	74 76                	je     802efd <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802e87:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802e8a:	74 36                	je     802ec2 <_pipeisclosed+0x81>
+  802e8c:	89 e0                	mov    %esp,%eax
+  802e8e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e93:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e99:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e9e:	77 b0                	ja     802e50 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ea0:	c1 e8 10             	shr    $0x10,%eax
+  802ea3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ea9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802eaf:	eb 9f                	jmp    802e50 <_pipeisclosed+0xf>
+  802eb1:	c1 e8 10             	shr    $0x10,%eax
+  802eb4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802eba:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802ec0:	eb be                	jmp    802e80 <_pipeisclosed+0x3f>
+  802ec2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ec4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ec9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ecf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ed4:	76 16                	jbe    802eec <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ed6:	8b 42 58             	mov    0x58(%edx),%eax
+  802ed9:	6a 01                	push   $0x1
+  802edb:	50                   	push   %eax
+  802edc:	53                   	push   %ebx
+  802edd:	68 9e 39 80 00       	push   $0x80399e
+  802ee2:	e8 d1 d3 ff ff       	call   8002b8 <cprintf>
+  802ee7:	83 c4 10             	add    $0x10,%esp
+  802eea:	eb a0                	jmp    802e8c <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802eec:	c1 e8 10             	shr    $0x10,%eax
+  802eef:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ef5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802efb:	eb d9                	jmp    802ed6 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802efd:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f00:	0f 94 c0             	sete   %al
+  802f03:	0f b6 c0             	movzbl %al,%eax
+}
+  802f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f09:	5b                   	pop    %ebx
+  802f0a:	5e                   	pop    %esi
+  802f0b:	5f                   	pop    %edi
+  802f0c:	5d                   	pop    %ebp
+  802f0d:	c3                   	ret
+
+00802f0e <devpipe_write>:
+{
+  802f0e:	55                   	push   %ebp
+  802f0f:	89 e5                	mov    %esp,%ebp
+  802f11:	57                   	push   %edi
+  802f12:	56                   	push   %esi
+  802f13:	53                   	push   %ebx
+  802f14:	83 ec 28             	sub    $0x28,%esp
+  802f17:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802f1a:	56                   	push   %esi
+  802f1b:	e8 e6 f1 ff ff       	call   802106 <fd2data>
+  802f20:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f22:	83 c4 10             	add    $0x10,%esp
+  802f25:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f2a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802f2d:	75 09                	jne    802f38 <devpipe_write+0x2a>
+	return i;
+  802f2f:	89 f8                	mov    %edi,%eax
+  802f31:	eb 23                	jmp    802f56 <devpipe_write+0x48>
+			sys_yield();
+  802f33:	e8 7a de ff ff       	call   800db2 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802f38:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f3b:	8b 0b                	mov    (%ebx),%ecx
+  802f3d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802f40:	39 d0                	cmp    %edx,%eax
+  802f42:	72 1a                	jb     802f5e <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802f44:	89 da                	mov    %ebx,%edx
+  802f46:	89 f0                	mov    %esi,%eax
+  802f48:	e8 f4 fe ff ff       	call   802e41 <_pipeisclosed>
+  802f4d:	85 c0                	test   %eax,%eax
+  802f4f:	74 e2                	je     802f33 <devpipe_write+0x25>
+				return 0;
+  802f51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f59:	5b                   	pop    %ebx
+  802f5a:	5e                   	pop    %esi
+  802f5b:	5f                   	pop    %edi
+  802f5c:	5d                   	pop    %ebp
+  802f5d:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802f5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f61:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f65:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f68:	89 c2                	mov    %eax,%edx
+  802f6a:	c1 fa 1f             	sar    $0x1f,%edx
+  802f6d:	89 d1                	mov    %edx,%ecx
+  802f6f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f72:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f75:	83 e2 1f             	and    $0x1f,%edx
+  802f78:	29 ca                	sub    %ecx,%edx
+  802f7a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f7e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802f82:	83 c0 01             	add    $0x1,%eax
+  802f85:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802f88:	83 c7 01             	add    $0x1,%edi
+  802f8b:	eb 9d                	jmp    802f2a <devpipe_write+0x1c>
+
+00802f8d <devpipe_read>:
+{
+  802f8d:	55                   	push   %ebp
+  802f8e:	89 e5                	mov    %esp,%ebp
+  802f90:	57                   	push   %edi
+  802f91:	56                   	push   %esi
+  802f92:	53                   	push   %ebx
+  802f93:	83 ec 18             	sub    $0x18,%esp
+  802f96:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802f99:	57                   	push   %edi
+  802f9a:	e8 67 f1 ff ff       	call   802106 <fd2data>
+  802f9f:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fa1:	83 c4 10             	add    $0x10,%esp
+  802fa4:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802fac:	75 13                	jne    802fc1 <devpipe_read+0x34>
+	return i;
+  802fae:	89 f0                	mov    %esi,%eax
+  802fb0:	eb 02                	jmp    802fb4 <devpipe_read+0x27>
+				return i;
+  802fb2:	89 f0                	mov    %esi,%eax
+}
+  802fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb7:	5b                   	pop    %ebx
+  802fb8:	5e                   	pop    %esi
+  802fb9:	5f                   	pop    %edi
+  802fba:	5d                   	pop    %ebp
+  802fbb:	c3                   	ret
+			sys_yield();
+  802fbc:	e8 f1 dd ff ff       	call   800db2 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802fc1:	8b 03                	mov    (%ebx),%eax
+  802fc3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802fc6:	75 18                	jne    802fe0 <devpipe_read+0x53>
+			if (i > 0)
+  802fc8:	85 f6                	test   %esi,%esi
+  802fca:	75 e6                	jne    802fb2 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802fcc:	89 da                	mov    %ebx,%edx
+  802fce:	89 f8                	mov    %edi,%eax
+  802fd0:	e8 6c fe ff ff       	call   802e41 <_pipeisclosed>
+  802fd5:	85 c0                	test   %eax,%eax
+  802fd7:	74 e3                	je     802fbc <devpipe_read+0x2f>
+				return 0;
+  802fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fde:	eb d4                	jmp    802fb4 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802fe0:	99                   	cltd
+  802fe1:	c1 ea 1b             	shr    $0x1b,%edx
+  802fe4:	01 d0                	add    %edx,%eax
+  802fe6:	83 e0 1f             	and    $0x1f,%eax
+  802fe9:	29 d0                	sub    %edx,%eax
+  802feb:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ff0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ff3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802ff6:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802ff9:	83 c6 01             	add    $0x1,%esi
+  802ffc:	eb ab                	jmp    802fa9 <devpipe_read+0x1c>
+
+00802ffe <pipe>:
+{
+  802ffe:	55                   	push   %ebp
+  802fff:	89 e5                	mov    %esp,%ebp
+  803001:	56                   	push   %esi
+  803002:	53                   	push   %ebx
+  803003:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803006:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803009:	50                   	push   %eax
+  80300a:	e8 0e f1 ff ff       	call   80211d <fd_alloc>
+  80300f:	89 c3                	mov    %eax,%ebx
+  803011:	83 c4 10             	add    $0x10,%esp
+  803014:	85 c0                	test   %eax,%eax
+  803016:	0f 88 23 01 00 00    	js     80313f <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80301c:	83 ec 04             	sub    $0x4,%esp
+  80301f:	68 07 04 00 00       	push   $0x407
+  803024:	ff 75 f4             	push   -0xc(%ebp)
+  803027:	6a 00                	push   $0x0
+  803029:	e8 ca dd ff ff       	call   800df8 <sys_page_alloc>
+  80302e:	89 c3                	mov    %eax,%ebx
+  803030:	83 c4 10             	add    $0x10,%esp
+  803033:	85 c0                	test   %eax,%eax
+  803035:	0f 88 04 01 00 00    	js     80313f <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80303b:	83 ec 0c             	sub    $0xc,%esp
+  80303e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803041:	50                   	push   %eax
+  803042:	e8 d6 f0 ff ff       	call   80211d <fd_alloc>
+  803047:	89 c3                	mov    %eax,%ebx
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	85 c0                	test   %eax,%eax
+  80304e:	0f 88 db 00 00 00    	js     80312f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803054:	83 ec 04             	sub    $0x4,%esp
+  803057:	68 07 04 00 00       	push   $0x407
+  80305c:	ff 75 f0             	push   -0x10(%ebp)
+  80305f:	6a 00                	push   $0x0
+  803061:	e8 92 dd ff ff       	call   800df8 <sys_page_alloc>
+  803066:	89 c3                	mov    %eax,%ebx
+  803068:	83 c4 10             	add    $0x10,%esp
+  80306b:	85 c0                	test   %eax,%eax
+  80306d:	0f 88 bc 00 00 00    	js     80312f <pipe+0x131>
+	va = fd2data(fd0);
+  803073:	83 ec 0c             	sub    $0xc,%esp
+  803076:	ff 75 f4             	push   -0xc(%ebp)
+  803079:	e8 88 f0 ff ff       	call   802106 <fd2data>
+  80307e:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803080:	83 c4 0c             	add    $0xc,%esp
+  803083:	68 07 04 00 00       	push   $0x407
+  803088:	50                   	push   %eax
+  803089:	6a 00                	push   $0x0
+  80308b:	e8 68 dd ff ff       	call   800df8 <sys_page_alloc>
+  803090:	89 c3                	mov    %eax,%ebx
+  803092:	83 c4 10             	add    $0x10,%esp
+  803095:	85 c0                	test   %eax,%eax
+  803097:	0f 88 82 00 00 00    	js     80311f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80309d:	83 ec 0c             	sub    $0xc,%esp
+  8030a0:	ff 75 f0             	push   -0x10(%ebp)
+  8030a3:	e8 5e f0 ff ff       	call   802106 <fd2data>
+  8030a8:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8030af:	50                   	push   %eax
+  8030b0:	6a 00                	push   $0x0
+  8030b2:	56                   	push   %esi
+  8030b3:	6a 00                	push   $0x0
+  8030b5:	e8 ab dd ff ff       	call   800e65 <sys_page_map>
+  8030ba:	89 c3                	mov    %eax,%ebx
+  8030bc:	83 c4 20             	add    $0x20,%esp
+  8030bf:	85 c0                	test   %eax,%eax
+  8030c1:	78 4e                	js     803111 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8030c3:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8030c8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030cb:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8030cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8030d0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8030d7:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8030da:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8030dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030df:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8030e6:	83 ec 0c             	sub    $0xc,%esp
+  8030e9:	ff 75 f4             	push   -0xc(%ebp)
+  8030ec:	e8 05 f0 ff ff       	call   8020f6 <fd2num>
+  8030f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030f4:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8030f6:	83 c4 04             	add    $0x4,%esp
+  8030f9:	ff 75 f0             	push   -0x10(%ebp)
+  8030fc:	e8 f5 ef ff ff       	call   8020f6 <fd2num>
+  803101:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803104:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803107:	83 c4 10             	add    $0x10,%esp
+  80310a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80310f:	eb 2e                	jmp    80313f <pipe+0x141>
+	sys_page_unmap(0, va);
+  803111:	83 ec 08             	sub    $0x8,%esp
+  803114:	56                   	push   %esi
+  803115:	6a 00                	push   $0x0
+  803117:	e8 b7 dd ff ff       	call   800ed3 <sys_page_unmap>
+  80311c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80311f:	83 ec 08             	sub    $0x8,%esp
+  803122:	ff 75 f0             	push   -0x10(%ebp)
+  803125:	6a 00                	push   $0x0
+  803127:	e8 a7 dd ff ff       	call   800ed3 <sys_page_unmap>
+  80312c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80312f:	83 ec 08             	sub    $0x8,%esp
+  803132:	ff 75 f4             	push   -0xc(%ebp)
+  803135:	6a 00                	push   $0x0
+  803137:	e8 97 dd ff ff       	call   800ed3 <sys_page_unmap>
+  80313c:	83 c4 10             	add    $0x10,%esp
+}
+  80313f:	89 d8                	mov    %ebx,%eax
+  803141:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803144:	5b                   	pop    %ebx
+  803145:	5e                   	pop    %esi
+  803146:	5d                   	pop    %ebp
+  803147:	c3                   	ret
+
+00803148 <pipeisclosed>:
+{
+  803148:	55                   	push   %ebp
+  803149:	89 e5                	mov    %esp,%ebp
+  80314b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80314e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803151:	50                   	push   %eax
+  803152:	ff 75 08             	push   0x8(%ebp)
+  803155:	e8 19 f0 ff ff       	call   802173 <fd_lookup>
+  80315a:	83 c4 10             	add    $0x10,%esp
+  80315d:	85 c0                	test   %eax,%eax
+  80315f:	78 18                	js     803179 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803161:	83 ec 0c             	sub    $0xc,%esp
+  803164:	ff 75 f4             	push   -0xc(%ebp)
+  803167:	e8 9a ef ff ff       	call   802106 <fd2data>
+  80316c:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80316e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803171:	e8 cb fc ff ff       	call   802e41 <_pipeisclosed>
+  803176:	83 c4 10             	add    $0x10,%esp
+}
+  803179:	c9                   	leave
+  80317a:	c3                   	ret
+
+0080317b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80317b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803180:	c3                   	ret
+
+00803181 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803181:	55                   	push   %ebp
+  803182:	89 e5                	mov    %esp,%ebp
+  803184:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803187:	68 b6 39 80 00       	push   $0x8039b6
+  80318c:	ff 75 0c             	push   0xc(%ebp)
+  80318f:	e8 6c d7 ff ff       	call   800900 <strcpy>
+	return 0;
+}
+  803194:	b8 00 00 00 00       	mov    $0x0,%eax
+  803199:	c9                   	leave
+  80319a:	c3                   	ret
+
+0080319b <devcons_write>:
+{
+  80319b:	55                   	push   %ebp
+  80319c:	89 e5                	mov    %esp,%ebp
+  80319e:	57                   	push   %edi
+  80319f:	56                   	push   %esi
+  8031a0:	53                   	push   %ebx
+  8031a1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8031a7:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8031ac:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8031b2:	eb 2e                	jmp    8031e2 <devcons_write+0x47>
+		m = n - tot;
+  8031b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8031b7:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8031b9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031be:	39 c3                	cmp    %eax,%ebx
+  8031c0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8031c3:	83 ec 04             	sub    $0x4,%esp
+  8031c6:	53                   	push   %ebx
+  8031c7:	89 f0                	mov    %esi,%eax
+  8031c9:	03 45 0c             	add    0xc(%ebp),%eax
+  8031cc:	50                   	push   %eax
+  8031cd:	57                   	push   %edi
+  8031ce:	e8 b3 d8 ff ff       	call   800a86 <memmove>
+		sys_cputs(buf, m);
+  8031d3:	83 c4 08             	add    $0x8,%esp
+  8031d6:	53                   	push   %ebx
+  8031d7:	57                   	push   %edi
+  8031d8:	e8 9c da ff ff       	call   800c79 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8031dd:	01 de                	add    %ebx,%esi
+  8031df:	83 c4 10             	add    $0x10,%esp
+  8031e2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8031e5:	72 cd                	jb     8031b4 <devcons_write+0x19>
+}
+  8031e7:	89 f0                	mov    %esi,%eax
+  8031e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031ec:	5b                   	pop    %ebx
+  8031ed:	5e                   	pop    %esi
+  8031ee:	5f                   	pop    %edi
+  8031ef:	5d                   	pop    %ebp
+  8031f0:	c3                   	ret
+
+008031f1 <devcons_read>:
+{
+  8031f1:	55                   	push   %ebp
+  8031f2:	89 e5                	mov    %esp,%ebp
+  8031f4:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8031f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031fc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803200:	75 07                	jne    803209 <devcons_read+0x18>
+  803202:	eb 1f                	jmp    803223 <devcons_read+0x32>
+		sys_yield();
+  803204:	e8 a9 db ff ff       	call   800db2 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803209:	e8 af da ff ff       	call   800cbd <sys_cgetc>
+  80320e:	85 c0                	test   %eax,%eax
+  803210:	74 f2                	je     803204 <devcons_read+0x13>
+	if (c < 0)
+  803212:	78 0f                	js     803223 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803214:	83 f8 04             	cmp    $0x4,%eax
+  803217:	74 0c                	je     803225 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803219:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80321c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80321e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803223:	c9                   	leave
+  803224:	c3                   	ret
+		return 0;
+  803225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322a:	eb f7                	jmp    803223 <devcons_read+0x32>
+
+0080322c <cputchar>:
+{
+  80322c:	55                   	push   %ebp
+  80322d:	89 e5                	mov    %esp,%ebp
+  80322f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803232:	8b 45 08             	mov    0x8(%ebp),%eax
+  803235:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803238:	6a 01                	push   $0x1
+  80323a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80323d:	50                   	push   %eax
+  80323e:	e8 36 da ff ff       	call   800c79 <sys_cputs>
+}
+  803243:	83 c4 10             	add    $0x10,%esp
+  803246:	c9                   	leave
+  803247:	c3                   	ret
+
+00803248 <getchar>:
+{
+  803248:	55                   	push   %ebp
+  803249:	89 e5                	mov    %esp,%ebp
+  80324b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80324e:	6a 01                	push   $0x1
+  803250:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803253:	50                   	push   %eax
+  803254:	6a 00                	push   $0x0
+  803256:	e8 9e f1 ff ff       	call   8023f9 <read>
+	if (r < 0)
+  80325b:	83 c4 10             	add    $0x10,%esp
+  80325e:	85 c0                	test   %eax,%eax
+  803260:	78 06                	js     803268 <getchar+0x20>
+	if (r < 1)
+  803262:	74 06                	je     80326a <getchar+0x22>
+	return c;
+  803264:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803268:	c9                   	leave
+  803269:	c3                   	ret
+		return -E_EOF;
+  80326a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80326f:	eb f7                	jmp    803268 <getchar+0x20>
+
+00803271 <iscons>:
+{
+  803271:	55                   	push   %ebp
+  803272:	89 e5                	mov    %esp,%ebp
+  803274:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803277:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80327a:	50                   	push   %eax
+  80327b:	ff 75 08             	push   0x8(%ebp)
+  80327e:	e8 f0 ee ff ff       	call   802173 <fd_lookup>
+  803283:	83 c4 10             	add    $0x10,%esp
+  803286:	85 c0                	test   %eax,%eax
+  803288:	78 11                	js     80329b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80328a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80328d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803293:	39 10                	cmp    %edx,(%eax)
+  803295:	0f 94 c0             	sete   %al
+  803298:	0f b6 c0             	movzbl %al,%eax
+}
+  80329b:	c9                   	leave
+  80329c:	c3                   	ret
+
+0080329d <opencons>:
+{
+  80329d:	55                   	push   %ebp
+  80329e:	89 e5                	mov    %esp,%ebp
+  8032a0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8032a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032a6:	50                   	push   %eax
+  8032a7:	e8 71 ee ff ff       	call   80211d <fd_alloc>
+  8032ac:	83 c4 10             	add    $0x10,%esp
+  8032af:	85 c0                	test   %eax,%eax
+  8032b1:	78 3a                	js     8032ed <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8032b3:	83 ec 04             	sub    $0x4,%esp
+  8032b6:	68 07 04 00 00       	push   $0x407
+  8032bb:	ff 75 f4             	push   -0xc(%ebp)
+  8032be:	6a 00                	push   $0x0
+  8032c0:	e8 33 db ff ff       	call   800df8 <sys_page_alloc>
+  8032c5:	83 c4 10             	add    $0x10,%esp
+  8032c8:	85 c0                	test   %eax,%eax
+  8032ca:	78 21                	js     8032ed <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8032cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032cf:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8032d5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8032d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032da:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8032e1:	83 ec 0c             	sub    $0xc,%esp
+  8032e4:	50                   	push   %eax
+  8032e5:	e8 0c ee ff ff       	call   8020f6 <fd2num>
+  8032ea:	83 c4 10             	add    $0x10,%esp
+}
+  8032ed:	c9                   	leave
+  8032ee:	c3                   	ret
+
+008032ef <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8032ef:	55                   	push   %ebp
+  8032f0:	89 e5                	mov    %esp,%ebp
+  8032f2:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8032f5:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8032fc:	74 0a                	je     803308 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8032fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  803301:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803306:	c9                   	leave
+  803307:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803308:	83 ec 04             	sub    $0x4,%esp
+  80330b:	6a 07                	push   $0x7
+  80330d:	68 00 f0 bf ee       	push   $0xeebff000
+  803312:	6a 00                	push   $0x0
+  803314:	e8 df da ff ff       	call   800df8 <sys_page_alloc>
+  803319:	83 c4 10             	add    $0x10,%esp
+  80331c:	85 c0                	test   %eax,%eax
+  80331e:	78 14                	js     803334 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803320:	83 ec 08             	sub    $0x8,%esp
+  803323:	68 56 33 80 00       	push   $0x803356
+  803328:	6a 00                	push   $0x0
+  80332a:	e8 e5 dc ff ff       	call   801014 <sys_env_set_pgfault_upcall>
+  80332f:	83 c4 10             	add    $0x10,%esp
+  803332:	eb ca                	jmp    8032fe <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  803334:	83 ec 08             	sub    $0x8,%esp
+  803337:	50                   	push   %eax
+  803338:	68 c2 39 80 00       	push   $0x8039c2
+  80333d:	e8 76 cf ff ff       	call   8002b8 <cprintf>
+			panic("set_pgfault_handler error");
+  803342:	83 c4 0c             	add    $0xc,%esp
+  803345:	68 cd 39 80 00       	push   $0x8039cd
+  80334a:	6a 24                	push   $0x24
+  80334c:	68 e7 39 80 00       	push   $0x8039e7
+  803351:	e8 87 ce ff ff       	call   8001dd <_panic>
+
+00803356 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803356:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803357:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80335c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80335e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803361:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  803365:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803368:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  80336c:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  80336e:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803372:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803373:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803377:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803378:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803379:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80337d:	c3                   	ret
+
+0080337e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80337e:	55                   	push   %ebp
+  80337f:	89 e5                	mov    %esp,%ebp
+  803381:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803384:	89 c2                	mov    %eax,%edx
+  803386:	c1 ea 16             	shr    $0x16,%edx
+  803389:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803390:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803395:	f6 c1 01             	test   $0x1,%cl
+  803398:	74 1a                	je     8033b4 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  80339a:	c1 e8 0c             	shr    $0xc,%eax
+  80339d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8033a4:	a8 01                	test   $0x1,%al
+  8033a6:	74 0c                	je     8033b4 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8033a8:	c1 e8 0c             	shr    $0xc,%eax
+  8033ab:	c1 e0 04             	shl    $0x4,%eax
+  8033ae:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8033b4:	89 d0                	mov    %edx,%eax
+  8033b6:	5d                   	pop    %ebp
+  8033b7:	c3                   	ret
@@ -0,0 +1,7284 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 02 00 00       	call   800237 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int i, id, p, pfd[2], wfd, r;
+
+	// fetch a prime from our left neighbor
+top:
+	if ((r = readn(fd, &p, 4)) != 4)
+  80003f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+
+	cprintf("%d\n", p);
+
+	// fork a right neighbor to continue the chain
+	if ((i=pipe(pfd)) < 0)
+  800042:	8d 7d d8             	lea    -0x28(%ebp),%edi
+	if ((r = readn(fd, &p, 4)) != 4)
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 04                	push   $0x4
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	e8 ed 23 00 00       	call   80243e <readn>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 04             	cmp    $0x4,%eax
+  800057:	75 49                	jne    8000a2 <primeproc+0x6f>
+	cprintf("%d\n", p);
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	ff 75 e0             	push   -0x20(%ebp)
+  80005f:	68 21 35 80 00       	push   $0x803521
+  800064:	e8 6d 03 00 00       	call   8003d6 <cprintf>
+	if ((i=pipe(pfd)) < 0)
+  800069:	89 3c 24             	mov    %edi,(%esp)
+  80006c:	e8 2b 2f 00 00       	call   802f9c <pipe>
+  800071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 47                	js     8000c2 <primeproc+0x8f>
+		panic("pipe: %e", i);
+	if ((id = fork()) < 0)
+  80007b:	e8 81 1d 00 00       	call   801e01 <fork>
+  800080:	85 c0                	test   %eax,%eax
+  800082:	78 50                	js     8000d4 <primeproc+0xa1>
+		panic("fork: %e", id);
+	if (id == 0) {
+  800084:	75 60                	jne    8000e6 <primeproc+0xb3>
+		close(fd);
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 cc 21 00 00       	call   80225b <close>
+		close(pfd[1]);
+  80008f:	83 c4 04             	add    $0x4,%esp
+  800092:	ff 75 dc             	push   -0x24(%ebp)
+  800095:	e8 c1 21 00 00       	call   80225b <close>
+		fd = pfd[0];
+  80009a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+		goto top;
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	eb a3                	jmp    800045 <primeproc+0x12>
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	0f 4e d0             	cmovle %eax,%edx
+  8000af:	52                   	push   %edx
+  8000b0:	50                   	push   %eax
+  8000b1:	68 e0 34 80 00       	push   $0x8034e0
+  8000b6:	6a 15                	push   $0x15
+  8000b8:	68 0f 35 80 00       	push   $0x80350f
+  8000bd:	e8 39 02 00 00       	call   8002fb <_panic>
+		panic("pipe: %e", i);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 25 35 80 00       	push   $0x803525
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 0f 35 80 00       	push   $0x80350f
+  8000cf:	e8 27 02 00 00       	call   8002fb <_panic>
+		panic("fork: %e", id);
+  8000d4:	50                   	push   %eax
+  8000d5:	68 10 3a 80 00       	push   $0x803a10
+  8000da:	6a 1d                	push   $0x1d
+  8000dc:	68 0f 35 80 00       	push   $0x80350f
+  8000e1:	e8 15 02 00 00       	call   8002fb <_panic>
+	}
+
+	close(pfd[0]);
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	ff 75 d8             	push   -0x28(%ebp)
+  8000ec:	e8 6a 21 00 00       	call   80225b <close>
+	wfd = pfd[1];
+  8000f1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+
+	// filter out multiples of our prime
+	for (;;) {
+		if ((r=readn(fd, &i, 4)) != 4)
+  8000f7:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	e8 38 23 00 00       	call   80243e <readn>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	83 f8 04             	cmp    $0x4,%eax
+  80010c:	75 45                	jne    800153 <primeproc+0x120>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+		if (i%p)
+  80010e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800111:	99                   	cltd
+  800112:	f7 7d e0             	idivl  -0x20(%ebp)
+  800115:	85 d2                	test   %edx,%edx
+  800117:	74 e1                	je     8000fa <primeproc+0xc7>
+			if ((r=write(wfd, &i, 4)) != 4)
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	6a 04                	push   $0x4
+  80011e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	57                   	push   %edi
+  800123:	e8 5d 23 00 00       	call   802485 <write>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	83 f8 04             	cmp    $0x4,%eax
+  80012e:	74 ca                	je     8000fa <primeproc+0xc7>
+				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	85 c0                	test   %eax,%eax
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	0f 4e d0             	cmovle %eax,%edx
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	ff 75 e0             	push   -0x20(%ebp)
+  800142:	68 4a 35 80 00       	push   $0x80354a
+  800147:	6a 2e                	push   $0x2e
+  800149:	68 0f 35 80 00       	push   $0x80350f
+  80014e:	e8 a8 01 00 00       	call   8002fb <_panic>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  800153:	83 ec 04             	sub    $0x4,%esp
+  800156:	85 c0                	test   %eax,%eax
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	0f 4e d0             	cmovle %eax,%edx
+  800160:	52                   	push   %edx
+  800161:	50                   	push   %eax
+  800162:	53                   	push   %ebx
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	68 2e 35 80 00       	push   $0x80352e
+  80016b:	6a 2b                	push   $0x2b
+  80016d:	68 0f 35 80 00       	push   $0x80350f
+  800172:	e8 84 01 00 00       	call   8002fb <_panic>
+
+00800177 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 20             	sub    $0x20,%esp
+	int i, id, p[2], r;
+
+	binaryname = "primespipe";
+  80017e:	c7 05 00 40 80 00 64 	movl   $0x803564,0x804000
+  800185:	35 80 00 
+
+	if ((i=pipe(p)) < 0)
+  800188:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 0b 2e 00 00       	call   802f9c <pipe>
+  800191:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	85 c0                	test   %eax,%eax
+  800199:	78 21                	js     8001bc <umain+0x45>
+		panic("pipe: %e", i);
+
+	// fork the first prime process in the chain
+	if ((id=fork()) < 0)
+  80019b:	e8 61 1c 00 00       	call   801e01 <fork>
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	78 2a                	js     8001ce <umain+0x57>
+		panic("fork: %e", id);
+
+	if (id == 0) {
+  8001a4:	75 3a                	jne    8001e0 <umain+0x69>
+		close(p[1]);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 f0             	push   -0x10(%ebp)
+  8001ac:	e8 aa 20 00 00       	call   80225b <close>
+		primeproc(p[0]);
+  8001b1:	83 c4 04             	add    $0x4,%esp
+  8001b4:	ff 75 ec             	push   -0x14(%ebp)
+  8001b7:	e8 77 fe ff ff       	call   800033 <primeproc>
+		panic("pipe: %e", i);
+  8001bc:	50                   	push   %eax
+  8001bd:	68 25 35 80 00       	push   $0x803525
+  8001c2:	6a 3a                	push   $0x3a
+  8001c4:	68 0f 35 80 00       	push   $0x80350f
+  8001c9:	e8 2d 01 00 00       	call   8002fb <_panic>
+		panic("fork: %e", id);
+  8001ce:	50                   	push   %eax
+  8001cf:	68 10 3a 80 00       	push   $0x803a10
+  8001d4:	6a 3e                	push   $0x3e
+  8001d6:	68 0f 35 80 00       	push   $0x80350f
+  8001db:	e8 1b 01 00 00       	call   8002fb <_panic>
+	}
+
+	close(p[0]);
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	ff 75 ec             	push   -0x14(%ebp)
+  8001e6:	e8 70 20 00 00       	call   80225b <close>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+  8001ee:	b8 02 00 00 00       	mov    $0x2,%eax
+
+	// feed all the integers through
+	for (i=2;; i++)
+		if ((r=write(p[1], &i, 4)) != 4)
+  8001f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001f6:	eb 06                	jmp    8001fe <umain+0x87>
+	for (i=2;; i++)
+  8001f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001fb:	83 c0 01             	add    $0x1,%eax
+  8001fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+		if ((r=write(p[1], &i, 4)) != 4)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	6a 04                	push   $0x4
+  800206:	53                   	push   %ebx
+  800207:	ff 75 f0             	push   -0x10(%ebp)
+  80020a:	e8 76 22 00 00       	call   802485 <write>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	83 f8 04             	cmp    $0x4,%eax
+  800215:	74 e1                	je     8001f8 <umain+0x81>
+			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	0f 4e d0             	cmovle %eax,%edx
+  800224:	52                   	push   %edx
+  800225:	50                   	push   %eax
+  800226:	68 6f 35 80 00       	push   $0x80356f
+  80022b:	6a 4a                	push   $0x4a
+  80022d:	68 0f 35 80 00       	push   $0x80350f
+  800232:	e8 c4 00 00 00       	call   8002fb <_panic>
+
+00800237 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	57                   	push   %edi
+  80023b:	56                   	push   %esi
+  80023c:	53                   	push   %ebx
+  80023d:	83 ec 0c             	sub    $0xc,%esp
+  800240:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800243:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800246:	b8 01 00 00 00       	mov    $0x1,%eax
+  80024b:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80024d:	c1 ea 0b             	shr    $0xb,%edx
+  800250:	83 f2 01             	xor    $0x1,%edx
+  800253:	83 e2 01             	and    $0x1,%edx
+  800256:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80025c:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800263:	00 00 00 
+	envid = sys_getenvid();
+  800266:	e8 1f 0c 00 00       	call   800e8a <sys_getenvid>
+  80026b:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80026d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800272:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800278:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80027e:	8b 52 48             	mov    0x48(%edx),%edx
+  800281:	39 ca                	cmp    %ecx,%edx
+  800283:	74 27                	je     8002ac <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800285:	83 c0 01             	add    $0x1,%eax
+  800288:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80028d:	75 e3                	jne    800272 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80028f:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800296:	75 24                	jne    8002bc <libmain+0x85>
+		panic("libmain can't find the environment");
+  800298:	83 ec 04             	sub    $0x4,%esp
+  80029b:	68 88 35 80 00       	push   $0x803588
+  8002a0:	6a 23                	push   $0x23
+  8002a2:	68 ab 35 80 00       	push   $0x8035ab
+  8002a7:	e8 4f 00 00 00       	call   8002fb <_panic>
+			mainenv = &envs[i];
+  8002ac:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8002b2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002b7:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002bc:	85 ff                	test   %edi,%edi
+  8002be:	7e 07                	jle    8002c7 <libmain+0x90>
+		binaryname = argv[0];
+  8002c0:	8b 06                	mov    (%esi),%eax
+  8002c2:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8002c7:	83 ec 08             	sub    $0x8,%esp
+  8002ca:	56                   	push   %esi
+  8002cb:	57                   	push   %edi
+  8002cc:	e8 a6 fe ff ff       	call   800177 <umain>
+
+	// exit gracefully
+	exit();
+  8002d1:	e8 0b 00 00 00       	call   8002e1 <exit>
+}
+  8002d6:	83 c4 10             	add    $0x10,%esp
+  8002d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002dc:	5b                   	pop    %ebx
+  8002dd:	5e                   	pop    %esi
+  8002de:	5f                   	pop    %edi
+  8002df:	5d                   	pop    %ebp
+  8002e0:	c3                   	ret
+
+008002e1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002e7:	e8 9c 1f 00 00       	call   802288 <close_all>
+	sys_env_destroy(0);
+  8002ec:	83 ec 0c             	sub    $0xc,%esp
+  8002ef:	6a 00                	push   $0x0
+  8002f1:	e8 2b 0b 00 00       	call   800e21 <sys_env_destroy>
+}
+  8002f6:	83 c4 10             	add    $0x10,%esp
+  8002f9:	c9                   	leave
+  8002fa:	c3                   	ret
+
+008002fb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002fb:	55                   	push   %ebp
+  8002fc:	89 e5                	mov    %esp,%ebp
+  8002fe:	56                   	push   %esi
+  8002ff:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800300:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800303:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800309:	e8 7c 0b 00 00       	call   800e8a <sys_getenvid>
+  80030e:	83 ec 0c             	sub    $0xc,%esp
+  800311:	ff 75 0c             	push   0xc(%ebp)
+  800314:	ff 75 08             	push   0x8(%ebp)
+  800317:	56                   	push   %esi
+  800318:	50                   	push   %eax
+  800319:	68 c4 35 80 00       	push   $0x8035c4
+  80031e:	e8 b3 00 00 00       	call   8003d6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800323:	83 c4 18             	add    $0x18,%esp
+  800326:	53                   	push   %ebx
+  800327:	ff 75 10             	push   0x10(%ebp)
+  80032a:	e8 56 00 00 00       	call   800385 <vcprintf>
+	cprintf("\n");
+  80032f:	c7 04 24 23 35 80 00 	movl   $0x803523,(%esp)
+  800336:	e8 9b 00 00 00       	call   8003d6 <cprintf>
+  80033b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80033e:	cc                   	int3
+	while (1)
+  80033f:	eb fd                	jmp    80033e <_panic+0x43>
+
+00800341 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800341:	55                   	push   %ebp
+  800342:	89 e5                	mov    %esp,%ebp
+  800344:	53                   	push   %ebx
+  800345:	83 ec 04             	sub    $0x4,%esp
+  800348:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80034b:	8b 13                	mov    (%ebx),%edx
+  80034d:	8d 42 01             	lea    0x1(%edx),%eax
+  800350:	89 03                	mov    %eax,(%ebx)
+  800352:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800355:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800359:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80035e:	74 09                	je     800369 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800360:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800364:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800369:	83 ec 08             	sub    $0x8,%esp
+  80036c:	68 ff 00 00 00       	push   $0xff
+  800371:	8d 43 08             	lea    0x8(%ebx),%eax
+  800374:	50                   	push   %eax
+  800375:	e8 1d 0a 00 00       	call   800d97 <sys_cputs>
+		b->idx = 0;
+  80037a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800380:	83 c4 10             	add    $0x10,%esp
+  800383:	eb db                	jmp    800360 <putch+0x1f>
+
+00800385 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80038e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800395:	00 00 00 
+	b.cnt = 0;
+  800398:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80039f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003a2:	ff 75 0c             	push   0xc(%ebp)
+  8003a5:	ff 75 08             	push   0x8(%ebp)
+  8003a8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003ae:	50                   	push   %eax
+  8003af:	68 41 03 80 00       	push   $0x800341
+  8003b4:	e8 fb 00 00 00       	call   8004b4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003b9:	83 c4 08             	add    $0x8,%esp
+  8003bc:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003c2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003c8:	50                   	push   %eax
+  8003c9:	e8 c9 09 00 00       	call   800d97 <sys_cputs>
+
+	return b.cnt;
+}
+  8003ce:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003d4:	c9                   	leave
+  8003d5:	c3                   	ret
+
+008003d6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003d6:	55                   	push   %ebp
+  8003d7:	89 e5                	mov    %esp,%ebp
+  8003d9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003dc:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003df:	50                   	push   %eax
+  8003e0:	ff 75 08             	push   0x8(%ebp)
+  8003e3:	e8 9d ff ff ff       	call   800385 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+
+008003ea <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8003ea:	55                   	push   %ebp
+  8003eb:	89 e5                	mov    %esp,%ebp
+  8003ed:	57                   	push   %edi
+  8003ee:	56                   	push   %esi
+  8003ef:	53                   	push   %ebx
+  8003f0:	83 ec 1c             	sub    $0x1c,%esp
+  8003f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003f6:	89 d6                	mov    %edx,%esi
+  8003f8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8003fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003fe:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800401:	73 0b                	jae    80040e <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800403:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800406:	c1 e7 08             	shl    $0x8,%edi
+  800409:	0b 7d 10             	or     0x10(%ebp),%edi
+  80040c:	eb 36                	jmp    800444 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80040e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800411:	ba 00 00 00 00       	mov    $0x0,%edx
+  800416:	f7 75 08             	divl   0x8(%ebp)
+  800419:	89 c1                	mov    %eax,%ecx
+  80041b:	ff 75 14             	push   0x14(%ebp)
+  80041e:	ff 75 10             	push   0x10(%ebp)
+  800421:	83 eb 01             	sub    $0x1,%ebx
+  800424:	53                   	push   %ebx
+  800425:	ff 75 08             	push   0x8(%ebp)
+  800428:	89 f2                	mov    %esi,%edx
+  80042a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80042d:	e8 b8 ff ff ff       	call   8003ea <printnum>
+  800432:	83 c4 10             	add    $0x10,%esp
+  800435:	eb 14                	jmp    80044b <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800437:	83 ec 08             	sub    $0x8,%esp
+  80043a:	56                   	push   %esi
+  80043b:	57                   	push   %edi
+  80043c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80043f:	ff d0                	call   *%eax
+  800441:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800444:	83 eb 01             	sub    $0x1,%ebx
+  800447:	85 db                	test   %ebx,%ebx
+  800449:	7f ec                	jg     800437 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80044b:	83 ec 08             	sub    $0x8,%esp
+  80044e:	56                   	push   %esi
+  80044f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800452:	ba 00 00 00 00       	mov    $0x0,%edx
+  800457:	f7 75 08             	divl   0x8(%ebp)
+  80045a:	0f be 92 e7 35 80 00 	movsbl 0x8035e7(%edx),%edx
+  800461:	8b 45 14             	mov    0x14(%ebp),%eax
+  800464:	c1 e0 08             	shl    $0x8,%eax
+  800467:	09 d0                	or     %edx,%eax
+  800469:	50                   	push   %eax
+  80046a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80046d:	ff d0                	call   *%eax
+}
+  80046f:	83 c4 10             	add    $0x10,%esp
+  800472:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800475:	5b                   	pop    %ebx
+  800476:	5e                   	pop    %esi
+  800477:	5f                   	pop    %edi
+  800478:	5d                   	pop    %ebp
+  800479:	c3                   	ret
+
+0080047a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80047a:	55                   	push   %ebp
+  80047b:	89 e5                	mov    %esp,%ebp
+  80047d:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800480:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800484:	8b 10                	mov    (%eax),%edx
+  800486:	3b 50 04             	cmp    0x4(%eax),%edx
+  800489:	73 0a                	jae    800495 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80048b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80048e:	89 08                	mov    %ecx,(%eax)
+  800490:	8b 45 08             	mov    0x8(%ebp),%eax
+  800493:	88 02                	mov    %al,(%edx)
+}
+  800495:	5d                   	pop    %ebp
+  800496:	c3                   	ret
+
+00800497 <printfmt>:
+{
+  800497:	55                   	push   %ebp
+  800498:	89 e5                	mov    %esp,%ebp
+  80049a:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80049d:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004a0:	50                   	push   %eax
+  8004a1:	ff 75 10             	push   0x10(%ebp)
+  8004a4:	ff 75 0c             	push   0xc(%ebp)
+  8004a7:	ff 75 08             	push   0x8(%ebp)
+  8004aa:	e8 05 00 00 00       	call   8004b4 <vprintfmt>
+}
+  8004af:	83 c4 10             	add    $0x10,%esp
+  8004b2:	c9                   	leave
+  8004b3:	c3                   	ret
+
+008004b4 <vprintfmt>:
+{
+  8004b4:	55                   	push   %ebp
+  8004b5:	89 e5                	mov    %esp,%ebp
+  8004b7:	57                   	push   %edi
+  8004b8:	56                   	push   %esi
+  8004b9:	53                   	push   %ebx
+  8004ba:	83 ec 3c             	sub    $0x3c,%esp
+  8004bd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8004c0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8004c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004ca:	eb 16                	jmp    8004e2 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	ff 75 0c             	push   0xc(%ebp)
+  8004d2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004d5:	c1 e2 08             	shl    $0x8,%edx
+  8004d8:	09 d0                	or     %edx,%eax
+  8004da:	50                   	push   %eax
+  8004db:	ff d7                	call   *%edi
+  8004dd:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004e0:	89 de                	mov    %ebx,%esi
+  8004e2:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8004e5:	0f b6 06             	movzbl (%esi),%eax
+  8004e8:	83 f8 25             	cmp    $0x25,%eax
+  8004eb:	74 0c                	je     8004f9 <vprintfmt+0x45>
+			if (ch == '\0')
+  8004ed:	85 c0                	test   %eax,%eax
+  8004ef:	75 db                	jne    8004cc <vprintfmt+0x18>
+}
+  8004f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f4:	5b                   	pop    %ebx
+  8004f5:	5e                   	pop    %esi
+  8004f6:	5f                   	pop    %edi
+  8004f7:	5d                   	pop    %ebp
+  8004f8:	c3                   	ret
+		padc = ' ';
+  8004f9:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8004fd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800504:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80050b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800512:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800517:	8d 73 01             	lea    0x1(%ebx),%esi
+  80051a:	0f b6 13             	movzbl (%ebx),%edx
+  80051d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800520:	3c 55                	cmp    $0x55,%al
+  800522:	0f 87 2c 04 00 00    	ja     800954 <vprintfmt+0x4a0>
+  800528:	0f b6 c0             	movzbl %al,%eax
+  80052b:	ff 24 85 40 37 80 00 	jmp    *0x803740(,%eax,4)
+  800532:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800534:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800538:	eb dd                	jmp    800517 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80053a:	89 f3                	mov    %esi,%ebx
+  80053c:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800540:	eb d5                	jmp    800517 <vprintfmt+0x63>
+  800542:	0f b6 d2             	movzbl %dl,%edx
+  800545:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800547:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80054c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80054f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800553:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800556:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800559:	83 fe 09             	cmp    $0x9,%esi
+  80055c:	0f 87 8a 00 00 00    	ja     8005ec <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800562:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800565:	eb e5                	jmp    80054c <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800567:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056a:	8b 00                	mov    (%eax),%eax
+  80056c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80056f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800572:	8d 40 04             	lea    0x4(%eax),%eax
+  800575:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800578:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80057a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80057e:	79 97                	jns    800517 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800580:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800583:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800586:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80058d:	eb 88                	jmp    800517 <vprintfmt+0x63>
+			if (width < 0)
+  80058f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800592:	85 db                	test   %ebx,%ebx
+  800594:	b8 00 00 00 00       	mov    $0x0,%eax
+  800599:	0f 49 c3             	cmovns %ebx,%eax
+  80059c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80059f:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005a1:	e9 71 ff ff ff       	jmp    800517 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005a6:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8005a8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005af:	e9 63 ff ff ff       	jmp    800517 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8005b4:	8d 73 02             	lea    0x2(%ebx),%esi
+  8005b7:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8005bb:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8005c2:	3c 67                	cmp    $0x67,%al
+  8005c4:	0f 84 18 ff ff ff    	je     8004e2 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8005ca:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8005d1:	3c 72                	cmp    $0x72,%al
+  8005d3:	0f 84 09 ff ff ff    	je     8004e2 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8005d9:	3c 62                	cmp    $0x62,%al
+  8005db:	0f 94 c0             	sete   %al
+  8005de:	0f b6 c0             	movzbl %al,%eax
+  8005e1:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8005e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005e7:	e9 f6 fe ff ff       	jmp    8004e2 <vprintfmt+0x2e>
+  8005ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ef:	eb 89                	jmp    80057a <vprintfmt+0xc6>
+			lflag++;
+  8005f1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005f4:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005f6:	e9 1c ff ff ff       	jmp    800517 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8d 58 04             	lea    0x4(%eax),%ebx
+  800601:	83 ec 08             	sub    $0x8,%esp
+  800604:	ff 75 0c             	push   0xc(%ebp)
+  800607:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80060a:	c1 e0 08             	shl    $0x8,%eax
+  80060d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800610:	0b 01                	or     (%ecx),%eax
+  800612:	50                   	push   %eax
+  800613:	ff d7                	call   *%edi
+			break;
+  800615:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800618:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80061b:	e9 c2 fe ff ff       	jmp    8004e2 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	89 d0                	mov    %edx,%eax
+  80062a:	f7 d8                	neg    %eax
+  80062c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80062f:	83 f8 12             	cmp    $0x12,%eax
+  800632:	7f 25                	jg     800659 <vprintfmt+0x1a5>
+  800634:	8b 14 85 a0 38 80 00 	mov    0x8038a0(,%eax,4),%edx
+  80063b:	85 d2                	test   %edx,%edx
+  80063d:	74 1a                	je     800659 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80063f:	52                   	push   %edx
+  800640:	68 e2 39 80 00       	push   $0x8039e2
+  800645:	ff 75 0c             	push   0xc(%ebp)
+  800648:	57                   	push   %edi
+  800649:	e8 49 fe ff ff       	call   800497 <printfmt>
+  80064e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800651:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800654:	e9 89 fe ff ff       	jmp    8004e2 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800659:	50                   	push   %eax
+  80065a:	68 ff 35 80 00       	push   $0x8035ff
+  80065f:	ff 75 0c             	push   0xc(%ebp)
+  800662:	57                   	push   %edi
+  800663:	e8 2f fe ff ff       	call   800497 <printfmt>
+  800668:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80066b:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80066e:	e9 6f fe ff ff       	jmp    8004e2 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	83 c0 04             	add    $0x4,%eax
+  800679:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800681:	85 c9                	test   %ecx,%ecx
+  800683:	b8 f8 35 80 00       	mov    $0x8035f8,%eax
+  800688:	0f 45 c1             	cmovne %ecx,%eax
+  80068b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80068e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800692:	7e 06                	jle    80069a <vprintfmt+0x1e6>
+  800694:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800698:	75 1a                	jne    8006b4 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80069a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80069d:	c1 e0 08             	shl    $0x8,%eax
+  8006a0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8006a3:	83 c8 3f             	or     $0x3f,%eax
+  8006a6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006a9:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8006ac:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006af:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8006b2:	eb 6d                	jmp    800721 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006b4:	83 ec 08             	sub    $0x8,%esp
+  8006b7:	ff 75 d0             	push   -0x30(%ebp)
+  8006ba:	ff 75 c8             	push   -0x38(%ebp)
+  8006bd:	e8 39 03 00 00       	call   8009fb <strnlen>
+  8006c2:	89 c2                	mov    %eax,%edx
+  8006c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c7:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8006c9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006cc:	c1 e1 08             	shl    $0x8,%ecx
+  8006cf:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006d3:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d5:	83 c4 10             	add    $0x10,%esp
+  8006d8:	89 c3                	mov    %eax,%ebx
+  8006da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006dd:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006e0:	89 ce                	mov    %ecx,%esi
+  8006e2:	eb 0f                	jmp    8006f3 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	ff 75 0c             	push   0xc(%ebp)
+  8006ea:	56                   	push   %esi
+  8006eb:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006ed:	83 eb 01             	sub    $0x1,%ebx
+  8006f0:	83 c4 10             	add    $0x10,%esp
+  8006f3:	85 db                	test   %ebx,%ebx
+  8006f5:	7f ed                	jg     8006e4 <vprintfmt+0x230>
+  8006f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006fa:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006fd:	85 c0                	test   %eax,%eax
+  8006ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800704:	0f 49 d0             	cmovns %eax,%edx
+  800707:	29 d0                	sub    %edx,%eax
+  800709:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80070c:	eb 8c                	jmp    80069a <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80070e:	83 ec 08             	sub    $0x8,%esp
+  800711:	ff 75 0c             	push   0xc(%ebp)
+  800714:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800717:	09 c2                	or     %eax,%edx
+  800719:	52                   	push   %edx
+  80071a:	ff d7                	call   *%edi
+  80071c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80071f:	89 d9                	mov    %ebx,%ecx
+  800721:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800724:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800728:	0f be d0             	movsbl %al,%edx
+  80072b:	85 d2                	test   %edx,%edx
+  80072d:	74 2a                	je     800759 <vprintfmt+0x2a5>
+  80072f:	85 f6                	test   %esi,%esi
+  800731:	78 05                	js     800738 <vprintfmt+0x284>
+  800733:	83 ee 01             	sub    $0x1,%esi
+  800736:	78 3b                	js     800773 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800738:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80073c:	74 d0                	je     80070e <vprintfmt+0x25a>
+  80073e:	0f be c0             	movsbl %al,%eax
+  800741:	83 e8 20             	sub    $0x20,%eax
+  800744:	83 f8 5e             	cmp    $0x5e,%eax
+  800747:	76 c5                	jbe    80070e <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800749:	83 ec 08             	sub    $0x8,%esp
+  80074c:	ff 75 0c             	push   0xc(%ebp)
+  80074f:	ff 75 cc             	push   -0x34(%ebp)
+  800752:	ff d7                	call   *%edi
+  800754:	83 c4 10             	add    $0x10,%esp
+  800757:	eb c6                	jmp    80071f <vprintfmt+0x26b>
+  800759:	8b 75 10             	mov    0x10(%ebp),%esi
+  80075c:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80075f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800762:	01 c3                	add    %eax,%ebx
+  800764:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800766:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800769:	83 c8 20             	or     $0x20,%eax
+  80076c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80076f:	89 c6                	mov    %eax,%esi
+  800771:	eb 14                	jmp    800787 <vprintfmt+0x2d3>
+  800773:	8b 75 10             	mov    0x10(%ebp),%esi
+  800776:	eb e4                	jmp    80075c <vprintfmt+0x2a8>
+  800778:	83 ec 08             	sub    $0x8,%esp
+  80077b:	ff 75 0c             	push   0xc(%ebp)
+  80077e:	56                   	push   %esi
+  80077f:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800781:	83 eb 01             	sub    $0x1,%ebx
+  800784:	83 c4 10             	add    $0x10,%esp
+  800787:	85 db                	test   %ebx,%ebx
+  800789:	7f ed                	jg     800778 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80078b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80078e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+  800794:	e9 49 fd ff ff       	jmp    8004e2 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800799:	83 f9 01             	cmp    $0x1,%ecx
+  80079c:	7f 1f                	jg     8007bd <vprintfmt+0x309>
+	else if (lflag)
+  80079e:	85 c9                	test   %ecx,%ecx
+  8007a0:	74 69                	je     80080b <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8007a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a5:	8b 00                	mov    (%eax),%eax
+  8007a7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007aa:	89 c1                	mov    %eax,%ecx
+  8007ac:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007af:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007bb:	eb 17                	jmp    8007d4 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8007bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c0:	8b 50 04             	mov    0x4(%eax),%edx
+  8007c3:	8b 00                	mov    (%eax),%eax
+  8007c5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007c8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ce:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d1:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007d4:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007d7:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8007da:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8007df:	85 db                	test   %ebx,%ebx
+  8007e1:	0f 89 f6 00 00 00    	jns    8008dd <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8007e7:	83 ec 08             	sub    $0x8,%esp
+  8007ea:	ff 75 0c             	push   0xc(%ebp)
+  8007ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007f0:	c1 e0 08             	shl    $0x8,%eax
+  8007f3:	83 c8 2d             	or     $0x2d,%eax
+  8007f6:	50                   	push   %eax
+  8007f7:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8007f9:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007fc:	f7 d9                	neg    %ecx
+  8007fe:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800801:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800806:	e9 d2 00 00 00       	jmp    8008dd <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80080b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080e:	8b 00                	mov    (%eax),%eax
+  800810:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800813:	89 c1                	mov    %eax,%ecx
+  800815:	c1 f9 1f             	sar    $0x1f,%ecx
+  800818:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80081b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081e:	8d 40 04             	lea    0x4(%eax),%eax
+  800821:	89 45 14             	mov    %eax,0x14(%ebp)
+  800824:	eb ae                	jmp    8007d4 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800826:	83 f9 01             	cmp    $0x1,%ecx
+  800829:	7f 19                	jg     800844 <vprintfmt+0x390>
+	else if (lflag)
+  80082b:	85 c9                	test   %ecx,%ecx
+  80082d:	74 2a                	je     800859 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80082f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800832:	8b 08                	mov    (%eax),%ecx
+  800834:	8d 40 04             	lea    0x4(%eax),%eax
+  800837:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80083a:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80083f:	e9 99 00 00 00       	jmp    8008dd <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800844:	8b 45 14             	mov    0x14(%ebp),%eax
+  800847:	8b 08                	mov    (%eax),%ecx
+  800849:	8d 40 08             	lea    0x8(%eax),%eax
+  80084c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80084f:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800854:	e9 84 00 00 00       	jmp    8008dd <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8b 08                	mov    (%eax),%ecx
+  80085e:	8d 40 04             	lea    0x4(%eax),%eax
+  800861:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800864:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800869:	eb 72                	jmp    8008dd <vprintfmt+0x429>
+	if (lflag >= 2)
+  80086b:	83 f9 01             	cmp    $0x1,%ecx
+  80086e:	7f 16                	jg     800886 <vprintfmt+0x3d2>
+	else if (lflag)
+  800870:	85 c9                	test   %ecx,%ecx
+  800872:	74 24                	je     800898 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800874:	8b 45 14             	mov    0x14(%ebp),%eax
+  800877:	8b 08                	mov    (%eax),%ecx
+  800879:	8d 40 04             	lea    0x4(%eax),%eax
+  80087c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80087f:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800884:	eb 57                	jmp    8008dd <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800886:	8b 45 14             	mov    0x14(%ebp),%eax
+  800889:	8b 08                	mov    (%eax),%ecx
+  80088b:	8d 40 08             	lea    0x8(%eax),%eax
+  80088e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800891:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800896:	eb 45                	jmp    8008dd <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089b:	8b 08                	mov    (%eax),%ecx
+  80089d:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008a3:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8008a8:	eb 33                	jmp    8008dd <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8008aa:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008ad:	c1 e3 08             	shl    $0x8,%ebx
+  8008b0:	83 ec 08             	sub    $0x8,%esp
+  8008b3:	ff 75 0c             	push   0xc(%ebp)
+  8008b6:	89 d8                	mov    %ebx,%eax
+  8008b8:	83 c8 30             	or     $0x30,%eax
+  8008bb:	50                   	push   %eax
+  8008bc:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8008be:	83 c4 08             	add    $0x8,%esp
+  8008c1:	ff 75 0c             	push   0xc(%ebp)
+  8008c4:	83 cb 78             	or     $0x78,%ebx
+  8008c7:	53                   	push   %ebx
+  8008c8:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8008ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cd:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8008cf:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008d8:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8008dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8008e0:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8008e4:	52                   	push   %edx
+  8008e5:	ff 75 e0             	push   -0x20(%ebp)
+  8008e8:	50                   	push   %eax
+  8008e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008ec:	89 f8                	mov    %edi,%eax
+  8008ee:	e8 f7 fa ff ff       	call   8003ea <printnum>
+			break;
+  8008f3:	83 c4 10             	add    $0x10,%esp
+  8008f6:	e9 e7 fb ff ff       	jmp    8004e2 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008fb:	83 f9 01             	cmp    $0x1,%ecx
+  8008fe:	7f 16                	jg     800916 <vprintfmt+0x462>
+	else if (lflag)
+  800900:	85 c9                	test   %ecx,%ecx
+  800902:	74 24                	je     800928 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800904:	8b 45 14             	mov    0x14(%ebp),%eax
+  800907:	8b 08                	mov    (%eax),%ecx
+  800909:	8d 40 04             	lea    0x4(%eax),%eax
+  80090c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80090f:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800914:	eb c7                	jmp    8008dd <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800916:	8b 45 14             	mov    0x14(%ebp),%eax
+  800919:	8b 08                	mov    (%eax),%ecx
+  80091b:	8d 40 08             	lea    0x8(%eax),%eax
+  80091e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800921:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800926:	eb b5                	jmp    8008dd <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800928:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092b:	8b 08                	mov    (%eax),%ecx
+  80092d:	8d 40 04             	lea    0x4(%eax),%eax
+  800930:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800933:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800938:	eb a3                	jmp    8008dd <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80093a:	83 ec 08             	sub    $0x8,%esp
+  80093d:	ff 75 0c             	push   0xc(%ebp)
+  800940:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800943:	c1 e0 08             	shl    $0x8,%eax
+  800946:	83 c8 25             	or     $0x25,%eax
+  800949:	50                   	push   %eax
+  80094a:	ff d7                	call   *%edi
+			break;
+  80094c:	83 c4 10             	add    $0x10,%esp
+  80094f:	e9 8e fb ff ff       	jmp    8004e2 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800954:	83 ec 08             	sub    $0x8,%esp
+  800957:	ff 75 0c             	push   0xc(%ebp)
+  80095a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80095d:	c1 e0 08             	shl    $0x8,%eax
+  800960:	83 c8 25             	or     $0x25,%eax
+  800963:	50                   	push   %eax
+  800964:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800966:	83 c4 10             	add    $0x10,%esp
+  800969:	89 de                	mov    %ebx,%esi
+  80096b:	eb 03                	jmp    800970 <vprintfmt+0x4bc>
+  80096d:	83 ee 01             	sub    $0x1,%esi
+  800970:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800974:	75 f7                	jne    80096d <vprintfmt+0x4b9>
+  800976:	e9 67 fb ff ff       	jmp    8004e2 <vprintfmt+0x2e>
+
+0080097b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	83 ec 18             	sub    $0x18,%esp
+  800981:	8b 45 08             	mov    0x8(%ebp),%eax
+  800984:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800987:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80098a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80098e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800991:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800998:	85 c0                	test   %eax,%eax
+  80099a:	74 26                	je     8009c2 <vsnprintf+0x47>
+  80099c:	85 d2                	test   %edx,%edx
+  80099e:	7e 22                	jle    8009c2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009a0:	ff 75 14             	push   0x14(%ebp)
+  8009a3:	ff 75 10             	push   0x10(%ebp)
+  8009a6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009a9:	50                   	push   %eax
+  8009aa:	68 7a 04 80 00       	push   $0x80047a
+  8009af:	e8 00 fb ff ff       	call   8004b4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009b4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009b7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009bd:	83 c4 10             	add    $0x10,%esp
+}
+  8009c0:	c9                   	leave
+  8009c1:	c3                   	ret
+		return -E_INVAL;
+  8009c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009c7:	eb f7                	jmp    8009c0 <vsnprintf+0x45>
+
+008009c9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009c9:	55                   	push   %ebp
+  8009ca:	89 e5                	mov    %esp,%ebp
+  8009cc:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8009cf:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009d2:	50                   	push   %eax
+  8009d3:	ff 75 10             	push   0x10(%ebp)
+  8009d6:	ff 75 0c             	push   0xc(%ebp)
+  8009d9:	ff 75 08             	push   0x8(%ebp)
+  8009dc:	e8 9a ff ff ff       	call   80097b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009e1:	c9                   	leave
+  8009e2:	c3                   	ret
+
+008009e3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009e3:	55                   	push   %ebp
+  8009e4:	89 e5                	mov    %esp,%ebp
+  8009e6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ee:	eb 03                	jmp    8009f3 <strlen+0x10>
+		n++;
+  8009f0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009f7:	75 f7                	jne    8009f0 <strlen+0xd>
+	return n;
+}
+  8009f9:	5d                   	pop    %ebp
+  8009fa:	c3                   	ret
+
+008009fb <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a09:	eb 03                	jmp    800a0e <strnlen+0x13>
+		n++;
+  800a0b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a0e:	39 d0                	cmp    %edx,%eax
+  800a10:	74 08                	je     800a1a <strnlen+0x1f>
+  800a12:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a16:	75 f3                	jne    800a0b <strnlen+0x10>
+  800a18:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a1a:	89 d0                	mov    %edx,%eax
+  800a1c:	5d                   	pop    %ebp
+  800a1d:	c3                   	ret
+
+00800a1e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a1e:	55                   	push   %ebp
+  800a1f:	89 e5                	mov    %esp,%ebp
+  800a21:	53                   	push   %ebx
+  800a22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a25:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a2d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a31:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a34:	83 c0 01             	add    $0x1,%eax
+  800a37:	84 d2                	test   %dl,%dl
+  800a39:	75 f2                	jne    800a2d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a3b:	89 c8                	mov    %ecx,%eax
+  800a3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a40:	c9                   	leave
+  800a41:	c3                   	ret
+
+00800a42 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a42:	55                   	push   %ebp
+  800a43:	89 e5                	mov    %esp,%ebp
+  800a45:	53                   	push   %ebx
+  800a46:	83 ec 10             	sub    $0x10,%esp
+  800a49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a4c:	53                   	push   %ebx
+  800a4d:	e8 91 ff ff ff       	call   8009e3 <strlen>
+  800a52:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a55:	ff 75 0c             	push   0xc(%ebp)
+  800a58:	01 d8                	add    %ebx,%eax
+  800a5a:	50                   	push   %eax
+  800a5b:	e8 be ff ff ff       	call   800a1e <strcpy>
+	return dst;
+}
+  800a60:	89 d8                	mov    %ebx,%eax
+  800a62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a65:	c9                   	leave
+  800a66:	c3                   	ret
+
+00800a67 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	56                   	push   %esi
+  800a6b:	53                   	push   %ebx
+  800a6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a72:	89 f3                	mov    %esi,%ebx
+  800a74:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a77:	89 f0                	mov    %esi,%eax
+  800a79:	eb 0f                	jmp    800a8a <strncpy+0x23>
+		*dst++ = *src;
+  800a7b:	83 c0 01             	add    $0x1,%eax
+  800a7e:	0f b6 0a             	movzbl (%edx),%ecx
+  800a81:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a84:	80 f9 01             	cmp    $0x1,%cl
+  800a87:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a8a:	39 d8                	cmp    %ebx,%eax
+  800a8c:	75 ed                	jne    800a7b <strncpy+0x14>
+	}
+	return ret;
+}
+  800a8e:	89 f0                	mov    %esi,%eax
+  800a90:	5b                   	pop    %ebx
+  800a91:	5e                   	pop    %esi
+  800a92:	5d                   	pop    %ebp
+  800a93:	c3                   	ret
+
+00800a94 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a94:	55                   	push   %ebp
+  800a95:	89 e5                	mov    %esp,%ebp
+  800a97:	56                   	push   %esi
+  800a98:	53                   	push   %ebx
+  800a99:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a9f:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800aa2:	89 f0                	mov    %esi,%eax
+  800aa4:	85 d2                	test   %edx,%edx
+  800aa6:	74 21                	je     800ac9 <strlcpy+0x35>
+  800aa8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800aac:	89 f2                	mov    %esi,%edx
+  800aae:	eb 09                	jmp    800ab9 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ab0:	83 c1 01             	add    $0x1,%ecx
+  800ab3:	83 c2 01             	add    $0x1,%edx
+  800ab6:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ab9:	39 c2                	cmp    %eax,%edx
+  800abb:	74 09                	je     800ac6 <strlcpy+0x32>
+  800abd:	0f b6 19             	movzbl (%ecx),%ebx
+  800ac0:	84 db                	test   %bl,%bl
+  800ac2:	75 ec                	jne    800ab0 <strlcpy+0x1c>
+  800ac4:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800ac6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ac9:	29 f0                	sub    %esi,%eax
+}
+  800acb:	5b                   	pop    %ebx
+  800acc:	5e                   	pop    %esi
+  800acd:	5d                   	pop    %ebp
+  800ace:	c3                   	ret
+
+00800acf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800acf:	55                   	push   %ebp
+  800ad0:	89 e5                	mov    %esp,%ebp
+  800ad2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ad5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ad8:	eb 06                	jmp    800ae0 <strcmp+0x11>
+		p++, q++;
+  800ada:	83 c1 01             	add    $0x1,%ecx
+  800add:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ae0:	0f b6 01             	movzbl (%ecx),%eax
+  800ae3:	84 c0                	test   %al,%al
+  800ae5:	74 04                	je     800aeb <strcmp+0x1c>
+  800ae7:	3a 02                	cmp    (%edx),%al
+  800ae9:	74 ef                	je     800ada <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aeb:	0f b6 c0             	movzbl %al,%eax
+  800aee:	0f b6 12             	movzbl (%edx),%edx
+  800af1:	29 d0                	sub    %edx,%eax
+}
+  800af3:	5d                   	pop    %ebp
+  800af4:	c3                   	ret
+
+00800af5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800af5:	55                   	push   %ebp
+  800af6:	89 e5                	mov    %esp,%ebp
+  800af8:	53                   	push   %ebx
+  800af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aff:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b02:	eb 09                	jmp    800b0d <strncmp+0x18>
+		n--, p++, q++;
+  800b04:	83 ea 01             	sub    $0x1,%edx
+  800b07:	83 c0 01             	add    $0x1,%eax
+  800b0a:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b0d:	85 d2                	test   %edx,%edx
+  800b0f:	74 18                	je     800b29 <strncmp+0x34>
+  800b11:	0f b6 18             	movzbl (%eax),%ebx
+  800b14:	84 db                	test   %bl,%bl
+  800b16:	74 04                	je     800b1c <strncmp+0x27>
+  800b18:	3a 19                	cmp    (%ecx),%bl
+  800b1a:	74 e8                	je     800b04 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b1c:	0f b6 00             	movzbl (%eax),%eax
+  800b1f:	0f b6 11             	movzbl (%ecx),%edx
+  800b22:	29 d0                	sub    %edx,%eax
+}
+  800b24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b27:	c9                   	leave
+  800b28:	c3                   	ret
+		return 0;
+  800b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2e:	eb f4                	jmp    800b24 <strncmp+0x2f>
+
+00800b30 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b36:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b3a:	eb 03                	jmp    800b3f <strchr+0xf>
+  800b3c:	83 c0 01             	add    $0x1,%eax
+  800b3f:	0f b6 10             	movzbl (%eax),%edx
+  800b42:	84 d2                	test   %dl,%dl
+  800b44:	74 06                	je     800b4c <strchr+0x1c>
+		if (*s == c)
+  800b46:	38 ca                	cmp    %cl,%dl
+  800b48:	75 f2                	jne    800b3c <strchr+0xc>
+  800b4a:	eb 05                	jmp    800b51 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b59:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b5d:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b60:	38 ca                	cmp    %cl,%dl
+  800b62:	74 09                	je     800b6d <strfind+0x1a>
+  800b64:	84 d2                	test   %dl,%dl
+  800b66:	74 05                	je     800b6d <strfind+0x1a>
+	for (; *s; s++)
+  800b68:	83 c0 01             	add    $0x1,%eax
+  800b6b:	eb f0                	jmp    800b5d <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b6d:	5d                   	pop    %ebp
+  800b6e:	c3                   	ret
+
+00800b6f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	57                   	push   %edi
+  800b73:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b76:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b79:	85 c9                	test   %ecx,%ecx
+  800b7b:	74 20                	je     800b9d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b7d:	89 f8                	mov    %edi,%eax
+  800b7f:	09 c8                	or     %ecx,%eax
+  800b81:	a8 03                	test   $0x3,%al
+  800b83:	75 12                	jne    800b97 <memset+0x28>
+		c &= 0xFF;
+  800b85:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b89:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b8f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b92:	fc                   	cld
+  800b93:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b95:	eb 06                	jmp    800b9d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b9a:	fc                   	cld
+  800b9b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b9d:	89 f8                	mov    %edi,%eax
+  800b9f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+
+00800ba4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	57                   	push   %edi
+  800ba8:	56                   	push   %esi
+  800ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800baf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bb2:	39 c6                	cmp    %eax,%esi
+  800bb4:	73 32                	jae    800be8 <memmove+0x44>
+  800bb6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bb9:	39 d0                	cmp    %edx,%eax
+  800bbb:	73 2b                	jae    800be8 <memmove+0x44>
+		s += n;
+		d += n;
+  800bbd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc0:	89 d6                	mov    %edx,%esi
+  800bc2:	09 fe                	or     %edi,%esi
+  800bc4:	09 ce                	or     %ecx,%esi
+  800bc6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bcc:	75 0e                	jne    800bdc <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bce:	83 ef 04             	sub    $0x4,%edi
+  800bd1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bd4:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bd7:	fd                   	std
+  800bd8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bda:	eb 09                	jmp    800be5 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bdc:	83 ef 01             	sub    $0x1,%edi
+  800bdf:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800be2:	fd                   	std
+  800be3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800be5:	fc                   	cld
+  800be6:	eb 1a                	jmp    800c02 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800be8:	89 f2                	mov    %esi,%edx
+  800bea:	09 c2                	or     %eax,%edx
+  800bec:	09 ca                	or     %ecx,%edx
+  800bee:	f6 c2 03             	test   $0x3,%dl
+  800bf1:	75 0a                	jne    800bfd <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bf3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bf6:	89 c7                	mov    %eax,%edi
+  800bf8:	fc                   	cld
+  800bf9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bfb:	eb 05                	jmp    800c02 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bfd:	89 c7                	mov    %eax,%edi
+  800bff:	fc                   	cld
+  800c00:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c02:	5e                   	pop    %esi
+  800c03:	5f                   	pop    %edi
+  800c04:	5d                   	pop    %ebp
+  800c05:	c3                   	ret
+
+00800c06 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c06:	55                   	push   %ebp
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c0c:	ff 75 10             	push   0x10(%ebp)
+  800c0f:	ff 75 0c             	push   0xc(%ebp)
+  800c12:	ff 75 08             	push   0x8(%ebp)
+  800c15:	e8 8a ff ff ff       	call   800ba4 <memmove>
+}
+  800c1a:	c9                   	leave
+  800c1b:	c3                   	ret
+
+00800c1c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c1c:	55                   	push   %ebp
+  800c1d:	89 e5                	mov    %esp,%ebp
+  800c1f:	56                   	push   %esi
+  800c20:	53                   	push   %ebx
+  800c21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c24:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c27:	89 c6                	mov    %eax,%esi
+  800c29:	03 75 10             	add    0x10(%ebp),%esi
+  800c2c:	eb 06                	jmp    800c34 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c2e:	83 c0 01             	add    $0x1,%eax
+  800c31:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c34:	39 f0                	cmp    %esi,%eax
+  800c36:	74 14                	je     800c4c <memcmp+0x30>
+		if (*s1 != *s2)
+  800c38:	0f b6 08             	movzbl (%eax),%ecx
+  800c3b:	0f b6 1a             	movzbl (%edx),%ebx
+  800c3e:	38 d9                	cmp    %bl,%cl
+  800c40:	74 ec                	je     800c2e <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c42:	0f b6 c1             	movzbl %cl,%eax
+  800c45:	0f b6 db             	movzbl %bl,%ebx
+  800c48:	29 d8                	sub    %ebx,%eax
+  800c4a:	eb 05                	jmp    800c51 <memcmp+0x35>
+	}
+
+	return 0;
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+
+00800c55 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c5e:	89 c2                	mov    %eax,%edx
+  800c60:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c63:	eb 03                	jmp    800c68 <memfind+0x13>
+  800c65:	83 c0 01             	add    $0x1,%eax
+  800c68:	39 d0                	cmp    %edx,%eax
+  800c6a:	73 04                	jae    800c70 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c6c:	38 08                	cmp    %cl,(%eax)
+  800c6e:	75 f5                	jne    800c65 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c70:	5d                   	pop    %ebp
+  800c71:	c3                   	ret
+
+00800c72 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	57                   	push   %edi
+  800c76:	56                   	push   %esi
+  800c77:	53                   	push   %ebx
+  800c78:	83 ec 1c             	sub    $0x1c,%esp
+  800c7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c7e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c81:	eb 03                	jmp    800c86 <strtol+0x14>
+		s++;
+  800c83:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c86:	0f b6 06             	movzbl (%esi),%eax
+  800c89:	3c 20                	cmp    $0x20,%al
+  800c8b:	74 f6                	je     800c83 <strtol+0x11>
+  800c8d:	3c 09                	cmp    $0x9,%al
+  800c8f:	74 f2                	je     800c83 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c91:	3c 2b                	cmp    $0x2b,%al
+  800c93:	74 43                	je     800cd8 <strtol+0x66>
+	int neg = 0;
+  800c95:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c9a:	3c 2d                	cmp    $0x2d,%al
+  800c9c:	74 44                	je     800ce2 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c9e:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ca4:	75 0f                	jne    800cb5 <strtol+0x43>
+  800ca6:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ca9:	74 41                	je     800cec <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cab:	85 ff                	test   %edi,%edi
+  800cad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cb2:	0f 44 f8             	cmove  %eax,%edi
+  800cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cba:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800cbf:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800cc2:	89 fb                	mov    %edi,%ebx
+  800cc4:	c1 fb 1f             	sar    $0x1f,%ebx
+  800cc7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800cca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ccd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800cd0:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800cd3:	89 75 08             	mov    %esi,0x8(%ebp)
+  800cd6:	eb 67                	jmp    800d3f <strtol+0xcd>
+		s++;
+  800cd8:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800cdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce0:	eb bc                	jmp    800c9e <strtol+0x2c>
+		s++, neg = 1;
+  800ce2:	83 c6 01             	add    $0x1,%esi
+  800ce5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cea:	eb b2                	jmp    800c9e <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cec:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800cf0:	74 0e                	je     800d00 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800cf2:	85 ff                	test   %edi,%edi
+  800cf4:	75 bf                	jne    800cb5 <strtol+0x43>
+		s++, base = 8;
+  800cf6:	83 c6 01             	add    $0x1,%esi
+  800cf9:	bf 08 00 00 00       	mov    $0x8,%edi
+  800cfe:	eb b5                	jmp    800cb5 <strtol+0x43>
+		s += 2, base = 16;
+  800d00:	83 c6 02             	add    $0x2,%esi
+  800d03:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d08:	eb ab                	jmp    800cb5 <strtol+0x43>
+			dig = *s - '0';
+  800d0a:	0f be c9             	movsbl %cl,%ecx
+  800d0d:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800d10:	39 f9                	cmp    %edi,%ecx
+  800d12:	7d 59                	jge    800d6d <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800d14:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800d18:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d1b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d1e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d21:	0f af d8             	imul   %eax,%ebx
+  800d24:	0f af d7             	imul   %edi,%edx
+  800d27:	01 d3                	add    %edx,%ebx
+  800d29:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d2c:	f7 e7                	mul    %edi
+  800d2e:	01 da                	add    %ebx,%edx
+  800d30:	89 cb                	mov    %ecx,%ebx
+  800d32:	c1 fb 1f             	sar    $0x1f,%ebx
+  800d35:	01 c8                	add    %ecx,%eax
+  800d37:	11 da                	adc    %ebx,%edx
+  800d39:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d3c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800d3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d42:	0f b6 08             	movzbl (%eax),%ecx
+  800d45:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800d48:	80 fb 09             	cmp    $0x9,%bl
+  800d4b:	76 bd                	jbe    800d0a <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800d4d:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800d50:	80 fb 19             	cmp    $0x19,%bl
+  800d53:	77 08                	ja     800d5d <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800d55:	0f be c9             	movsbl %cl,%ecx
+  800d58:	83 e9 57             	sub    $0x57,%ecx
+  800d5b:	eb b3                	jmp    800d10 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d5d:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800d60:	80 fb 19             	cmp    $0x19,%bl
+  800d63:	77 08                	ja     800d6d <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800d65:	0f be c9             	movsbl %cl,%ecx
+  800d68:	83 e9 37             	sub    $0x37,%ecx
+  800d6b:	eb a3                	jmp    800d10 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d6d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d70:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d73:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d76:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d79:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d7d:	74 05                	je     800d84 <strtol+0x112>
+		*endptr = (char *) s;
+  800d7f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d82:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d84:	85 c9                	test   %ecx,%ecx
+  800d86:	74 07                	je     800d8f <strtol+0x11d>
+  800d88:	f7 d8                	neg    %eax
+  800d8a:	83 d2 00             	adc    $0x0,%edx
+  800d8d:	f7 da                	neg    %edx
+}
+  800d8f:	83 c4 1c             	add    $0x1c,%esp
+  800d92:	5b                   	pop    %ebx
+  800d93:	5e                   	pop    %esi
+  800d94:	5f                   	pop    %edi
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+
+00800d97 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d97:	55                   	push   %ebp
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	57                   	push   %edi
+  800d9b:	56                   	push   %esi
+  800d9c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d9d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800da4:	74 18                	je     800dbe <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db1:	89 c3                	mov    %eax,%ebx
+  800db3:	89 c7                	mov    %eax,%edi
+  800db5:	89 c6                	mov    %eax,%esi
+  800db7:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc9:	89 c3                	mov    %eax,%ebx
+  800dcb:	89 c7                	mov    %eax,%edi
+  800dcd:	55                   	push   %ebp
+  800dce:	89 e5                	mov    %esp,%ebp
+  800dd0:	8d 35 d8 0d 80 00    	lea    0x800dd8,%esi
+  800dd6:	0f 34                	sysenter
+  800dd8:	5d                   	pop    %ebp
+		goto out;
+  800dd9:	eb de                	jmp    800db9 <sys_cputs+0x22>
+
+00800ddb <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	57                   	push   %edi
+  800ddf:	56                   	push   %esi
+  800de0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800de1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800de8:	74 19                	je     800e03 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800dea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800def:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df4:	89 d1                	mov    %edx,%ecx
+  800df6:	89 d3                	mov    %edx,%ebx
+  800df8:	89 d7                	mov    %edx,%edi
+  800dfa:	89 d6                	mov    %edx,%esi
+  800dfc:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5e                   	pop    %esi
+  800e00:	5f                   	pop    %edi
+  800e01:	5d                   	pop    %ebp
+  800e02:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e03:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e08:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e0d:	89 d1                	mov    %edx,%ecx
+  800e0f:	89 d3                	mov    %edx,%ebx
+  800e11:	89 d7                	mov    %edx,%edi
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	8d 35 1e 0e 80 00    	lea    0x800e1e,%esi
+  800e1c:	0f 34                	sysenter
+  800e1e:	5d                   	pop    %ebp
+		goto out;
+  800e1f:	eb dd                	jmp    800dfe <sys_cgetc+0x23>
+
+00800e21 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e21:	55                   	push   %ebp
+  800e22:	89 e5                	mov    %esp,%ebp
+  800e24:	57                   	push   %edi
+  800e25:	56                   	push   %esi
+  800e26:	53                   	push   %ebx
+  800e27:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e2a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e31:	74 21                	je     800e54 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800e33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e38:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e40:	89 cb                	mov    %ecx,%ebx
+  800e42:	89 cf                	mov    %ecx,%edi
+  800e44:	89 ce                	mov    %ecx,%esi
+  800e46:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e48:	85 c0                	test   %eax,%eax
+  800e4a:	7f 27                	jg     800e73 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4f:	5b                   	pop    %ebx
+  800e50:	5e                   	pop    %esi
+  800e51:	5f                   	pop    %edi
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e5c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e61:	89 cb                	mov    %ecx,%ebx
+  800e63:	89 cf                	mov    %ecx,%edi
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	8d 35 70 0e 80 00    	lea    0x800e70,%esi
+  800e6e:	0f 34                	sysenter
+  800e70:	5d                   	pop    %ebp
+		goto out;
+  800e71:	eb d5                	jmp    800e48 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e73:	83 ec 0c             	sub    $0xc,%esp
+  800e76:	50                   	push   %eax
+  800e77:	6a 03                	push   $0x3
+  800e79:	68 0b 39 80 00       	push   $0x80390b
+  800e7e:	6a 3f                	push   $0x3f
+  800e80:	68 28 39 80 00       	push   $0x803928
+  800e85:	e8 71 f4 ff ff       	call   8002fb <_panic>
+
+00800e8a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e90:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e97:	74 19                	je     800eb2 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e99:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ea3:	89 d1                	mov    %edx,%ecx
+  800ea5:	89 d3                	mov    %edx,%ebx
+  800ea7:	89 d7                	mov    %edx,%edi
+  800ea9:	89 d6                	mov    %edx,%esi
+  800eab:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ead:	5b                   	pop    %ebx
+  800eae:	5e                   	pop    %esi
+  800eaf:	5f                   	pop    %edi
+  800eb0:	5d                   	pop    %ebp
+  800eb1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ebc:	89 d1                	mov    %edx,%ecx
+  800ebe:	89 d3                	mov    %edx,%ebx
+  800ec0:	89 d7                	mov    %edx,%edi
+  800ec2:	55                   	push   %ebp
+  800ec3:	89 e5                	mov    %esp,%ebp
+  800ec5:	8d 35 cd 0e 80 00    	lea    0x800ecd,%esi
+  800ecb:	0f 34                	sysenter
+  800ecd:	5d                   	pop    %ebp
+		goto out;
+  800ece:	eb dd                	jmp    800ead <sys_getenvid+0x23>
+
+00800ed0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	57                   	push   %edi
+  800ed4:	56                   	push   %esi
+  800ed5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ed6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800edd:	74 19                	je     800ef8 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ee9:	89 d1                	mov    %edx,%ecx
+  800eeb:	89 d3                	mov    %edx,%ebx
+  800eed:	89 d7                	mov    %edx,%edi
+  800eef:	89 d6                	mov    %edx,%esi
+  800ef1:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ef3:	5b                   	pop    %ebx
+  800ef4:	5e                   	pop    %esi
+  800ef5:	5f                   	pop    %edi
+  800ef6:	5d                   	pop    %ebp
+  800ef7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ef8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800efd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f02:	89 d1                	mov    %edx,%ecx
+  800f04:	89 d3                	mov    %edx,%ebx
+  800f06:	89 d7                	mov    %edx,%edi
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	8d 35 13 0f 80 00    	lea    0x800f13,%esi
+  800f11:	0f 34                	sysenter
+  800f13:	5d                   	pop    %ebp
+		goto out;
+  800f14:	eb dd                	jmp    800ef3 <sys_yield+0x23>
+
+00800f16 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f16:	55                   	push   %ebp
+  800f17:	89 e5                	mov    %esp,%ebp
+  800f19:	57                   	push   %edi
+  800f1a:	56                   	push   %esi
+  800f1b:	53                   	push   %ebx
+  800f1c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f1f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f26:	74 23                	je     800f4b <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800f28:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3b:	89 f7                	mov    %esi,%edi
+  800f3d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	7f 29                	jg     800f6c <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f51:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f56:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	8d 35 69 0f 80 00    	lea    0x800f69,%esi
+  800f67:	0f 34                	sysenter
+  800f69:	5d                   	pop    %ebp
+		goto out;
+  800f6a:	eb d3                	jmp    800f3f <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6c:	83 ec 0c             	sub    $0xc,%esp
+  800f6f:	50                   	push   %eax
+  800f70:	6a 04                	push   $0x4
+  800f72:	68 0b 39 80 00       	push   $0x80390b
+  800f77:	6a 3f                	push   $0x3f
+  800f79:	68 28 39 80 00       	push   $0x803928
+  800f7e:	e8 78 f3 ff ff       	call   8002fb <_panic>
+
+00800f83 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+  800f8c:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f8f:	85 f6                	test   %esi,%esi
+  800f91:	75 09                	jne    800f9c <sys_page_map+0x19>
+  800f93:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f9a:	74 1f                	je     800fbb <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f9c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800faa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fad:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800faf:	85 c0                	test   %eax,%eax
+  800fb1:	7f 27                	jg     800fda <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5f                   	pop    %edi
+  800fb9:	5d                   	pop    %ebp
+  800fba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc1:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	8d 35 d7 0f 80 00    	lea    0x800fd7,%esi
+  800fd5:	0f 34                	sysenter
+  800fd7:	5d                   	pop    %ebp
+		goto out;
+  800fd8:	eb d5                	jmp    800faf <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+  800fdd:	50                   	push   %eax
+  800fde:	6a 05                	push   $0x5
+  800fe0:	68 0b 39 80 00       	push   $0x80390b
+  800fe5:	6a 3f                	push   $0x3f
+  800fe7:	68 28 39 80 00       	push   $0x803928
+  800fec:	e8 0a f3 ff ff       	call   8002fb <_panic>
+
+00800ff1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+  800ff7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ffa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801001:	74 22                	je     801025 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801003:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801008:	b8 06 00 00 00       	mov    $0x6,%eax
+  80100d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801010:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801013:	89 df                	mov    %ebx,%edi
+  801015:	89 de                	mov    %ebx,%esi
+  801017:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801019:	85 c0                	test   %eax,%eax
+  80101b:	7f 28                	jg     801045 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80101d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801020:	5b                   	pop    %ebx
+  801021:	5e                   	pop    %esi
+  801022:	5f                   	pop    %edi
+  801023:	5d                   	pop    %ebp
+  801024:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 06 00 00 00       	mov    $0x6,%eax
+  801035:	89 df                	mov    %ebx,%edi
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	8d 35 42 10 80 00    	lea    0x801042,%esi
+  801040:	0f 34                	sysenter
+  801042:	5d                   	pop    %ebp
+		goto out;
+  801043:	eb d4                	jmp    801019 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801045:	83 ec 0c             	sub    $0xc,%esp
+  801048:	50                   	push   %eax
+  801049:	6a 06                	push   $0x6
+  80104b:	68 0b 39 80 00       	push   $0x80390b
+  801050:	6a 3f                	push   $0x3f
+  801052:	68 28 39 80 00       	push   $0x803928
+  801057:	e8 9f f2 ff ff       	call   8002fb <_panic>
+
+0080105c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	57                   	push   %edi
+  801060:	56                   	push   %esi
+  801061:	53                   	push   %ebx
+  801062:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801065:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80106c:	74 22                	je     801090 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  80106e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801073:	b8 08 00 00 00       	mov    $0x8,%eax
+  801078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107e:	89 df                	mov    %ebx,%edi
+  801080:	89 de                	mov    %ebx,%esi
+  801082:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801084:	85 c0                	test   %eax,%eax
+  801086:	7f 28                	jg     8010b0 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108b:	5b                   	pop    %ebx
+  80108c:	5e                   	pop    %esi
+  80108d:	5f                   	pop    %edi
+  80108e:	5d                   	pop    %ebp
+  80108f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801090:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801095:	8b 55 08             	mov    0x8(%ebp),%edx
+  801098:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109b:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010a0:	89 df                	mov    %ebx,%edi
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	8d 35 ad 10 80 00    	lea    0x8010ad,%esi
+  8010ab:	0f 34                	sysenter
+  8010ad:	5d                   	pop    %ebp
+		goto out;
+  8010ae:	eb d4                	jmp    801084 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b0:	83 ec 0c             	sub    $0xc,%esp
+  8010b3:	50                   	push   %eax
+  8010b4:	6a 08                	push   $0x8
+  8010b6:	68 0b 39 80 00       	push   $0x80390b
+  8010bb:	6a 3f                	push   $0x3f
+  8010bd:	68 28 39 80 00       	push   $0x803928
+  8010c2:	e8 34 f2 ff ff       	call   8002fb <_panic>
+
+008010c7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+  8010cd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010d0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010d7:	74 22                	je     8010fb <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  8010d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010de:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e9:	89 df                	mov    %ebx,%edi
+  8010eb:	89 de                	mov    %ebx,%esi
+  8010ed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	7f 28                	jg     80111b <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801100:	8b 55 08             	mov    0x8(%ebp),%edx
+  801103:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801106:	b8 09 00 00 00       	mov    $0x9,%eax
+  80110b:	89 df                	mov    %ebx,%edi
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	8d 35 18 11 80 00    	lea    0x801118,%esi
+  801116:	0f 34                	sysenter
+  801118:	5d                   	pop    %ebp
+		goto out;
+  801119:	eb d4                	jmp    8010ef <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111b:	83 ec 0c             	sub    $0xc,%esp
+  80111e:	50                   	push   %eax
+  80111f:	6a 09                	push   $0x9
+  801121:	68 0b 39 80 00       	push   $0x80390b
+  801126:	6a 3f                	push   $0x3f
+  801128:	68 28 39 80 00       	push   $0x803928
+  80112d:	e8 c9 f1 ff ff       	call   8002fb <_panic>
+
+00801132 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	57                   	push   %edi
+  801136:	56                   	push   %esi
+  801137:	53                   	push   %ebx
+  801138:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80113b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801142:	74 22                	je     801166 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801144:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801149:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801154:	89 df                	mov    %ebx,%edi
+  801156:	89 de                	mov    %ebx,%esi
+  801158:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	7f 28                	jg     801186 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801166:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801171:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801176:	89 df                	mov    %ebx,%edi
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	8d 35 83 11 80 00    	lea    0x801183,%esi
+  801181:	0f 34                	sysenter
+  801183:	5d                   	pop    %ebp
+		goto out;
+  801184:	eb d4                	jmp    80115a <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801186:	83 ec 0c             	sub    $0xc,%esp
+  801189:	50                   	push   %eax
+  80118a:	6a 0a                	push   $0xa
+  80118c:	68 0b 39 80 00       	push   $0x80390b
+  801191:	6a 3f                	push   $0x3f
+  801193:	68 28 39 80 00       	push   $0x803928
+  801198:	e8 5e f1 ff ff       	call   8002fb <_panic>
+
+0080119d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	57                   	push   %edi
+  8011a1:	56                   	push   %esi
+  8011a2:	53                   	push   %ebx
+  8011a3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011a6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011ad:	74 22                	je     8011d1 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8011af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bf:	89 df                	mov    %ebx,%edi
+  8011c1:	89 de                	mov    %ebx,%esi
+  8011c3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c5:	85 c0                	test   %eax,%eax
+  8011c7:	7f 28                	jg     8011f1 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8011c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cc:	5b                   	pop    %ebx
+  8011cd:	5e                   	pop    %esi
+  8011ce:	5f                   	pop    %edi
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dc:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011e1:	89 df                	mov    %ebx,%edi
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	8d 35 ee 11 80 00    	lea    0x8011ee,%esi
+  8011ec:	0f 34                	sysenter
+  8011ee:	5d                   	pop    %ebp
+		goto out;
+  8011ef:	eb d4                	jmp    8011c5 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f1:	83 ec 0c             	sub    $0xc,%esp
+  8011f4:	50                   	push   %eax
+  8011f5:	6a 17                	push   $0x17
+  8011f7:	68 0b 39 80 00       	push   $0x80390b
+  8011fc:	6a 3f                	push   $0x3f
+  8011fe:	68 28 39 80 00       	push   $0x803928
+  801203:	e8 f3 f0 ff ff       	call   8002fb <_panic>
+
+00801208 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	57                   	push   %edi
+  80120c:	56                   	push   %esi
+  80120d:	53                   	push   %ebx
+  80120e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801211:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801218:	74 22                	je     80123c <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80121a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801224:	8b 55 08             	mov    0x8(%ebp),%edx
+  801227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122a:	89 df                	mov    %ebx,%edi
+  80122c:	89 de                	mov    %ebx,%esi
+  80122e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801230:	85 c0                	test   %eax,%eax
+  801232:	7f 28                	jg     80125c <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801234:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801237:	5b                   	pop    %ebx
+  801238:	5e                   	pop    %esi
+  801239:	5f                   	pop    %edi
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80123c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801241:	8b 55 08             	mov    0x8(%ebp),%edx
+  801244:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801247:	b8 18 00 00 00       	mov    $0x18,%eax
+  80124c:	89 df                	mov    %ebx,%edi
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	8d 35 59 12 80 00    	lea    0x801259,%esi
+  801257:	0f 34                	sysenter
+  801259:	5d                   	pop    %ebp
+		goto out;
+  80125a:	eb d4                	jmp    801230 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125c:	83 ec 0c             	sub    $0xc,%esp
+  80125f:	50                   	push   %eax
+  801260:	6a 18                	push   $0x18
+  801262:	68 0b 39 80 00       	push   $0x80390b
+  801267:	6a 3f                	push   $0x3f
+  801269:	68 28 39 80 00       	push   $0x803928
+  80126e:	e8 88 f0 ff ff       	call   8002fb <_panic>
+
+00801273 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801279:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801280:	74 1d                	je     80129f <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801282:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801287:	be 00 00 00 00       	mov    $0x0,%esi
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801295:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801298:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80129f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b0:	55                   	push   %ebp
+  8012b1:	89 e5                	mov    %esp,%ebp
+  8012b3:	8d 35 bb 12 80 00    	lea    0x8012bb,%esi
+  8012b9:	0f 34                	sysenter
+  8012bb:	5d                   	pop    %ebp
+		goto out;
+  8012bc:	eb dc                	jmp    80129a <sys_ipc_try_send+0x27>
+
+008012be <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	57                   	push   %edi
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+  8012c4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012c7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012ce:	74 21                	je     8012f1 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8012d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012d5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dd:	89 cb                	mov    %ecx,%ebx
+  8012df:	89 cf                	mov    %ecx,%edi
+  8012e1:	89 ce                	mov    %ecx,%esi
+  8012e3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e5:	85 c0                	test   %eax,%eax
+  8012e7:	7f 27                	jg     801310 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8012e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ec:	5b                   	pop    %ebx
+  8012ed:	5e                   	pop    %esi
+  8012ee:	5f                   	pop    %edi
+  8012ef:	5d                   	pop    %ebp
+  8012f0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012fe:	89 cb                	mov    %ecx,%ebx
+  801300:	89 cf                	mov    %ecx,%edi
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	8d 35 0d 13 80 00    	lea    0x80130d,%esi
+  80130b:	0f 34                	sysenter
+  80130d:	5d                   	pop    %ebp
+		goto out;
+  80130e:	eb d5                	jmp    8012e5 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801310:	83 ec 0c             	sub    $0xc,%esp
+  801313:	50                   	push   %eax
+  801314:	6a 0d                	push   $0xd
+  801316:	68 0b 39 80 00       	push   $0x80390b
+  80131b:	6a 3f                	push   $0x3f
+  80131d:	68 28 39 80 00       	push   $0x803928
+  801322:	e8 d4 ef ff ff       	call   8002fb <_panic>
+
+00801327 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801327:	55                   	push   %ebp
+  801328:	89 e5                	mov    %esp,%ebp
+  80132a:	57                   	push   %edi
+  80132b:	56                   	push   %esi
+  80132c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80132d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801334:	74 1b                	je     801351 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801336:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801340:	8b 55 08             	mov    0x8(%ebp),%edx
+  801343:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801346:	89 df                	mov    %ebx,%edi
+  801348:	89 de                	mov    %ebx,%esi
+  80134a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801351:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801356:	8b 55 08             	mov    0x8(%ebp),%edx
+  801359:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801361:	89 df                	mov    %ebx,%edi
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	8d 35 6e 13 80 00    	lea    0x80136e,%esi
+  80136c:	0f 34                	sysenter
+  80136e:	5d                   	pop    %ebp
+		goto out;
+  80136f:	eb db                	jmp    80134c <sys_ipc_recv_until+0x25>
+
+00801371 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801371:	55                   	push   %ebp
+  801372:	89 e5                	mov    %esp,%ebp
+  801374:	57                   	push   %edi
+  801375:	56                   	push   %esi
+  801376:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801377:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80137e:	74 19                	je     801399 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801380:	ba 00 00 00 00       	mov    $0x0,%edx
+  801385:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80138a:	89 d1                	mov    %edx,%ecx
+  80138c:	89 d3                	mov    %edx,%ebx
+  80138e:	89 d7                	mov    %edx,%edi
+  801390:	89 d6                	mov    %edx,%esi
+  801392:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801394:	5b                   	pop    %ebx
+  801395:	5e                   	pop    %esi
+  801396:	5f                   	pop    %edi
+  801397:	5d                   	pop    %ebp
+  801398:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801399:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013a3:	89 d1                	mov    %edx,%ecx
+  8013a5:	89 d3                	mov    %edx,%ebx
+  8013a7:	89 d7                	mov    %edx,%edi
+  8013a9:	55                   	push   %ebp
+  8013aa:	89 e5                	mov    %esp,%ebp
+  8013ac:	8d 35 b4 13 80 00    	lea    0x8013b4,%esi
+  8013b2:	0f 34                	sysenter
+  8013b4:	5d                   	pop    %ebp
+		goto out;
+  8013b5:	eb dd                	jmp    801394 <sys_time_msec+0x23>
+
+008013b7 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8013b7:	55                   	push   %ebp
+  8013b8:	89 e5                	mov    %esp,%ebp
+  8013ba:	57                   	push   %edi
+  8013bb:	56                   	push   %esi
+  8013bc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013bd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013c4:	74 1a                	je     8013e0 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8013c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013cb:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d3:	89 cb                	mov    %ecx,%ebx
+  8013d5:	89 cf                	mov    %ecx,%edi
+  8013d7:	89 ce                	mov    %ecx,%esi
+  8013d9:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013e8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013ed:	89 cb                	mov    %ecx,%ebx
+  8013ef:	89 cf                	mov    %ecx,%edi
+  8013f1:	55                   	push   %ebp
+  8013f2:	89 e5                	mov    %esp,%ebp
+  8013f4:	8d 35 fc 13 80 00    	lea    0x8013fc,%esi
+  8013fa:	0f 34                	sysenter
+  8013fc:	5d                   	pop    %ebp
+		goto out;
+  8013fd:	eb dc                	jmp    8013db <sys_sleep_until+0x24>
+
+008013ff <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8013ff:	55                   	push   %ebp
+  801400:	89 e5                	mov    %esp,%ebp
+  801402:	57                   	push   %edi
+  801403:	56                   	push   %esi
+  801404:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801405:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80140c:	74 1a                	je     801428 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80140e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801413:	b8 11 00 00 00       	mov    $0x11,%eax
+  801418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141b:	89 cb                	mov    %ecx,%ebx
+  80141d:	89 cf                	mov    %ecx,%edi
+  80141f:	89 ce                	mov    %ecx,%esi
+  801421:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801423:	5b                   	pop    %ebx
+  801424:	5e                   	pop    %esi
+  801425:	5f                   	pop    %edi
+  801426:	5d                   	pop    %ebp
+  801427:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801428:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801430:	b8 11 00 00 00       	mov    $0x11,%eax
+  801435:	89 cb                	mov    %ecx,%ebx
+  801437:	89 cf                	mov    %ecx,%edi
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	8d 35 44 14 80 00    	lea    0x801444,%esi
+  801442:	0f 34                	sysenter
+  801444:	5d                   	pop    %ebp
+		goto out;
+  801445:	eb dc                	jmp    801423 <sys_env_print_stats+0x24>
+
+00801447 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801447:	55                   	push   %ebp
+  801448:	89 e5                	mov    %esp,%ebp
+  80144a:	57                   	push   %edi
+  80144b:	56                   	push   %esi
+  80144c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80144d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801454:	74 1b                	je     801471 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801456:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801460:	8b 55 08             	mov    0x8(%ebp),%edx
+  801463:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801466:	89 df                	mov    %ebx,%edi
+  801468:	89 de                	mov    %ebx,%esi
+  80146a:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80146c:	5b                   	pop    %ebx
+  80146d:	5e                   	pop    %esi
+  80146e:	5f                   	pop    %edi
+  80146f:	5d                   	pop    %ebp
+  801470:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801471:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801476:	8b 55 08             	mov    0x8(%ebp),%edx
+  801479:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80147c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801481:	89 df                	mov    %ebx,%edi
+  801483:	55                   	push   %ebp
+  801484:	89 e5                	mov    %esp,%ebp
+  801486:	8d 35 8e 14 80 00    	lea    0x80148e,%esi
+  80148c:	0f 34                	sysenter
+  80148e:	5d                   	pop    %ebp
+		goto out;
+  80148f:	eb db                	jmp    80146c <sys_perf+0x25>
+
+00801491 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801491:	55                   	push   %ebp
+  801492:	89 e5                	mov    %esp,%ebp
+  801494:	57                   	push   %edi
+  801495:	56                   	push   %esi
+  801496:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801497:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80149e:	74 19                	je     8014b9 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8014a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014aa:	89 d1                	mov    %edx,%ecx
+  8014ac:	89 d3                	mov    %edx,%ebx
+  8014ae:	89 d7                	mov    %edx,%edi
+  8014b0:	89 d6                	mov    %edx,%esi
+  8014b2:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8014b4:	5b                   	pop    %ebx
+  8014b5:	5e                   	pop    %esi
+  8014b6:	5f                   	pop    %edi
+  8014b7:	5d                   	pop    %ebp
+  8014b8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014be:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014c3:	89 d1                	mov    %edx,%ecx
+  8014c5:	89 d3                	mov    %edx,%ebx
+  8014c7:	89 d7                	mov    %edx,%edi
+  8014c9:	55                   	push   %ebp
+  8014ca:	89 e5                	mov    %esp,%ebp
+  8014cc:	8d 35 d4 14 80 00    	lea    0x8014d4,%esi
+  8014d2:	0f 34                	sysenter
+  8014d4:	5d                   	pop    %ebp
+		goto out;
+  8014d5:	eb dd                	jmp    8014b4 <sys_fork+0x23>
+
+008014d7 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8014d7:	55                   	push   %ebp
+  8014d8:	89 e5                	mov    %esp,%ebp
+  8014da:	57                   	push   %edi
+  8014db:	56                   	push   %esi
+  8014dc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014dd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e4:	74 1c                	je     801502 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8014e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014eb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f9:	89 f7                	mov    %esi,%edi
+  8014fb:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8014fd:	5b                   	pop    %ebx
+  8014fe:	5e                   	pop    %esi
+  8014ff:	5f                   	pop    %edi
+  801500:	5d                   	pop    %ebp
+  801501:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801502:	8b 55 08             	mov    0x8(%ebp),%edx
+  801505:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801508:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80150d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801512:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801515:	55                   	push   %ebp
+  801516:	89 e5                	mov    %esp,%ebp
+  801518:	8d 35 20 15 80 00    	lea    0x801520,%esi
+  80151e:	0f 34                	sysenter
+  801520:	5d                   	pop    %ebp
+		goto out;
+  801521:	eb da                	jmp    8014fd <sys_thread_create+0x26>
+
+00801523 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801523:	55                   	push   %ebp
+  801524:	89 e5                	mov    %esp,%ebp
+  801526:	57                   	push   %edi
+  801527:	56                   	push   %esi
+  801528:	53                   	push   %ebx
+  801529:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80152c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801533:	74 24                	je     801559 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801535:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80153a:	be 00 00 00 00       	mov    $0x0,%esi
+  80153f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801542:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801545:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801548:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80154b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80154d:	85 c0                	test   %eax,%eax
+  80154f:	7f 27                	jg     801578 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801551:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801554:	5b                   	pop    %ebx
+  801555:	5e                   	pop    %esi
+  801556:	5f                   	pop    %edi
+  801557:	5d                   	pop    %ebp
+  801558:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801559:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801564:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801567:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	8d 35 75 15 80 00    	lea    0x801575,%esi
+  801573:	0f 34                	sysenter
+  801575:	5d                   	pop    %ebp
+		goto out;
+  801576:	eb d5                	jmp    80154d <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801578:	83 ec 0c             	sub    $0xc,%esp
+  80157b:	50                   	push   %eax
+  80157c:	6a 1f                	push   $0x1f
+  80157e:	68 0b 39 80 00       	push   $0x80390b
+  801583:	6a 3f                	push   $0x3f
+  801585:	68 28 39 80 00       	push   $0x803928
+  80158a:	e8 6c ed ff ff       	call   8002fb <_panic>
+
+0080158f <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80158f:	55                   	push   %ebp
+  801590:	89 e5                	mov    %esp,%ebp
+  801592:	57                   	push   %edi
+  801593:	56                   	push   %esi
+  801594:	53                   	push   %ebx
+  801595:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801598:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80159f:	74 23                	je     8015c4 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8015a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a6:	b8 20 00 00 00       	mov    $0x20,%eax
+  8015ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015b4:	89 f7                	mov    %esi,%edi
+  8015b6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	7f 29                	jg     8015e5 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8015bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bf:	5b                   	pop    %ebx
+  8015c0:	5e                   	pop    %esi
+  8015c1:	5f                   	pop    %edi
+  8015c2:	5d                   	pop    %ebp
+  8015c3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ca:	b8 20 00 00 00       	mov    $0x20,%eax
+  8015cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d7:	55                   	push   %ebp
+  8015d8:	89 e5                	mov    %esp,%ebp
+  8015da:	8d 35 e2 15 80 00    	lea    0x8015e2,%esi
+  8015e0:	0f 34                	sysenter
+  8015e2:	5d                   	pop    %ebp
+		goto out;
+  8015e3:	eb d3                	jmp    8015b8 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015e5:	83 ec 0c             	sub    $0xc,%esp
+  8015e8:	50                   	push   %eax
+  8015e9:	6a 20                	push   $0x20
+  8015eb:	68 0b 39 80 00       	push   $0x80390b
+  8015f0:	6a 3f                	push   $0x3f
+  8015f2:	68 28 39 80 00       	push   $0x803928
+  8015f7:	e8 ff ec ff ff       	call   8002fb <_panic>
+
+008015fc <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8015fc:	55                   	push   %ebp
+  8015fd:	89 e5                	mov    %esp,%ebp
+  8015ff:	57                   	push   %edi
+  801600:	56                   	push   %esi
+  801601:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801602:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801609:	74 1b                	je     801626 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80160b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801610:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801615:	8b 55 08             	mov    0x8(%ebp),%edx
+  801618:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161b:	89 df                	mov    %ebx,%edi
+  80161d:	89 de                	mov    %ebx,%esi
+  80161f:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801621:	5b                   	pop    %ebx
+  801622:	5e                   	pop    %esi
+  801623:	5f                   	pop    %edi
+  801624:	5d                   	pop    %ebp
+  801625:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801626:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801631:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801636:	89 df                	mov    %ebx,%edi
+  801638:	55                   	push   %ebp
+  801639:	89 e5                	mov    %esp,%ebp
+  80163b:	8d 35 43 16 80 00    	lea    0x801643,%esi
+  801641:	0f 34                	sysenter
+  801643:	5d                   	pop    %ebp
+		goto out;
+  801644:	eb db                	jmp    801621 <sys_batch+0x25>
+
+00801646 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801646:	55                   	push   %ebp
+  801647:	89 e5                	mov    %esp,%ebp
+  801649:	57                   	push   %edi
+  80164a:	56                   	push   %esi
+  80164b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80164c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801653:	74 1a                	je     80166f <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801655:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80165a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80165f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801662:	89 cb                	mov    %ecx,%ebx
+  801664:	89 cf                	mov    %ecx,%edi
+  801666:	89 ce                	mov    %ecx,%esi
+  801668:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80166a:	5b                   	pop    %ebx
+  80166b:	5e                   	pop    %esi
+  80166c:	5f                   	pop    %edi
+  80166d:	5d                   	pop    %ebp
+  80166e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80166f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801672:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801677:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80167c:	89 cb                	mov    %ecx,%ebx
+  80167e:	89 cf                	mov    %ecx,%edi
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	8d 35 8b 16 80 00    	lea    0x80168b,%esi
+  801689:	0f 34                	sysenter
+  80168b:	5d                   	pop    %ebp
+		goto out;
+  80168c:	eb dc                	jmp    80166a <sys_trace_ctl+0x24>
+
+0080168e <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80168e:	55                   	push   %ebp
+  80168f:	89 e5                	mov    %esp,%ebp
+  801691:	57                   	push   %edi
+  801692:	56                   	push   %esi
+  801693:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801694:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80169b:	74 1c                	je     8016b9 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80169d:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8016a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016b0:	89 f7                	mov    %esi,%edi
+  8016b2:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8016b4:	5b                   	pop    %ebx
+  8016b5:	5e                   	pop    %esi
+  8016b6:	5f                   	pop    %edi
+  8016b7:	5d                   	pop    %ebp
+  8016b8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8016c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	8d 35 d7 16 80 00    	lea    0x8016d7,%esi
+  8016d5:	0f 34                	sysenter
+  8016d7:	5d                   	pop    %ebp
+		goto out;
+  8016d8:	eb da                	jmp    8016b4 <sys_trace_read+0x26>
+
+008016da <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8016da:	55                   	push   %ebp
+  8016db:	89 e5                	mov    %esp,%ebp
+  8016dd:	57                   	push   %edi
+  8016de:	56                   	push   %esi
+  8016df:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016e0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016e7:	74 1c                	je     801705 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8016e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ee:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016fc:	89 f7                	mov    %esi,%edi
+  8016fe:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801700:	5b                   	pop    %ebx
+  801701:	5e                   	pop    %esi
+  801702:	5f                   	pop    %edi
+  801703:	5d                   	pop    %ebp
+  801704:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801705:	8b 55 08             	mov    0x8(%ebp),%edx
+  801708:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801710:	bf 00 00 00 00       	mov    $0x0,%edi
+  801715:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801718:	55                   	push   %ebp
+  801719:	89 e5                	mov    %esp,%ebp
+  80171b:	8d 35 23 17 80 00    	lea    0x801723,%esi
+  801721:	0f 34                	sysenter
+  801723:	5d                   	pop    %ebp
+		goto out;
+  801724:	eb da                	jmp    801700 <sys_meminfo+0x26>
+
+00801726 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801726:	55                   	push   %ebp
+  801727:	89 e5                	mov    %esp,%ebp
+  801729:	57                   	push   %edi
+  80172a:	56                   	push   %esi
+  80172b:	53                   	push   %ebx
+  80172c:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80172f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801733:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80173a:	74 1f                	je     80175b <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80173c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801741:	b8 22 00 00 00       	mov    $0x22,%eax
+  801746:	8b 55 08             	mov    0x8(%ebp),%edx
+  801749:	89 df                	mov    %ebx,%edi
+  80174b:	89 de                	mov    %ebx,%esi
+  80174d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	7f 25                	jg     801778 <sys_env_set_ksm+0x52>
+}
+  801753:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801756:	5b                   	pop    %ebx
+  801757:	5e                   	pop    %esi
+  801758:	5f                   	pop    %edi
+  801759:	5d                   	pop    %ebp
+  80175a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80175b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801760:	8b 55 08             	mov    0x8(%ebp),%edx
+  801763:	b8 22 00 00 00       	mov    $0x22,%eax
+  801768:	89 df                	mov    %ebx,%edi
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	8d 35 75 17 80 00    	lea    0x801775,%esi
+  801773:	0f 34                	sysenter
+  801775:	5d                   	pop    %ebp
+		goto out;
+  801776:	eb d7                	jmp    80174f <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801778:	83 ec 0c             	sub    $0xc,%esp
+  80177b:	50                   	push   %eax
+  80177c:	6a 22                	push   $0x22
+  80177e:	68 0b 39 80 00       	push   $0x80390b
+  801783:	6a 3f                	push   $0x3f
+  801785:	68 28 39 80 00       	push   $0x803928
+  80178a:	e8 6c eb ff ff       	call   8002fb <_panic>
+
+0080178f <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80178f:	55                   	push   %ebp
+  801790:	89 e5                	mov    %esp,%ebp
+  801792:	57                   	push   %edi
+  801793:	56                   	push   %esi
+  801794:	53                   	push   %ebx
+  801795:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801798:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80179b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017a2:	74 24                	je     8017c8 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8017a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8017ae:	89 cb                	mov    %ecx,%ebx
+  8017b0:	89 cf                	mov    %ecx,%edi
+  8017b2:	89 ce                	mov    %ecx,%esi
+  8017b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017b6:	85 c0                	test   %eax,%eax
+  8017b8:	7f 2a                	jg     8017e4 <sys_time_nsec+0x55>
+	return ns;
+}
+  8017ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8017c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c3:	5b                   	pop    %ebx
+  8017c4:	5e                   	pop    %esi
+  8017c5:	5f                   	pop    %edi
+  8017c6:	5d                   	pop    %ebp
+  8017c7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017cd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8017d2:	89 cb                	mov    %ecx,%ebx
+  8017d4:	89 cf                	mov    %ecx,%edi
+  8017d6:	55                   	push   %ebp
+  8017d7:	89 e5                	mov    %esp,%ebp
+  8017d9:	8d 35 e1 17 80 00    	lea    0x8017e1,%esi
+  8017df:	0f 34                	sysenter
+  8017e1:	5d                   	pop    %ebp
+		goto out;
+  8017e2:	eb d2                	jmp    8017b6 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017e4:	83 ec 0c             	sub    $0xc,%esp
+  8017e7:	50                   	push   %eax
+  8017e8:	6a 0f                	push   $0xf
+  8017ea:	68 0b 39 80 00       	push   $0x80390b
+  8017ef:	6a 3f                	push   $0x3f
+  8017f1:	68 28 39 80 00       	push   $0x803928
+  8017f6:	e8 00 eb ff ff       	call   8002fb <_panic>
+
+008017fb <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8017fb:	55                   	push   %ebp
+  8017fc:	89 e5                	mov    %esp,%ebp
+  8017fe:	57                   	push   %edi
+  8017ff:	56                   	push   %esi
+  801800:	53                   	push   %ebx
+  801801:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801804:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80180b:	74 22                	je     80182f <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80180d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801812:	b8 12 00 00 00       	mov    $0x12,%eax
+  801817:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181d:	89 df                	mov    %ebx,%edi
+  80181f:	89 de                	mov    %ebx,%esi
+  801821:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801823:	85 c0                	test   %eax,%eax
+  801825:	7f 28                	jg     80184f <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80182a:	5b                   	pop    %ebx
+  80182b:	5e                   	pop    %esi
+  80182c:	5f                   	pop    %edi
+  80182d:	5d                   	pop    %ebp
+  80182e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80182f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801834:	8b 55 08             	mov    0x8(%ebp),%edx
+  801837:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80183a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80183f:	89 df                	mov    %ebx,%edi
+  801841:	55                   	push   %ebp
+  801842:	89 e5                	mov    %esp,%ebp
+  801844:	8d 35 4c 18 80 00    	lea    0x80184c,%esi
+  80184a:	0f 34                	sysenter
+  80184c:	5d                   	pop    %ebp
+		goto out;
+  80184d:	eb d4                	jmp    801823 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80184f:	83 ec 0c             	sub    $0xc,%esp
+  801852:	50                   	push   %eax
+  801853:	6a 12                	push   $0x12
+  801855:	68 0b 39 80 00       	push   $0x80390b
+  80185a:	6a 3f                	push   $0x3f
+  80185c:	68 28 39 80 00       	push   $0x803928
+  801861:	e8 95 ea ff ff       	call   8002fb <_panic>
+
+00801866 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	57                   	push   %edi
+  80186a:	56                   	push   %esi
+  80186b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80186c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801873:	74 1b                	je     801890 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801875:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80187f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801882:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801885:	89 df                	mov    %ebx,%edi
+  801887:	89 de                	mov    %ebx,%esi
+  801889:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80188b:	5b                   	pop    %ebx
+  80188c:	5e                   	pop    %esi
+  80188d:	5f                   	pop    %edi
+  80188e:	5d                   	pop    %ebp
+  80188f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801890:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801895:	8b 55 08             	mov    0x8(%ebp),%edx
+  801898:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189b:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018a0:	89 df                	mov    %ebx,%edi
+  8018a2:	55                   	push   %ebp
+  8018a3:	89 e5                	mov    %esp,%ebp
+  8018a5:	8d 35 ad 18 80 00    	lea    0x8018ad,%esi
+  8018ab:	0f 34                	sysenter
+  8018ad:	5d                   	pop    %ebp
+		goto out;
+  8018ae:	eb db                	jmp    80188b <sys_e1000_receive+0x25>
+
+008018b0 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	57                   	push   %edi
+  8018b4:	56                   	push   %esi
+  8018b5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018b6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018bd:	74 1b                	je     8018da <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8018bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8018c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018cf:	89 df                	mov    %ebx,%edi
+  8018d1:	89 de                	mov    %ebx,%esi
+  8018d3:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8018d5:	5b                   	pop    %ebx
+  8018d6:	5e                   	pop    %esi
+  8018d7:	5f                   	pop    %edi
+  8018d8:	5d                   	pop    %ebp
+  8018d9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018e5:	b8 14 00 00 00       	mov    $0x14,%eax
+  8018ea:	89 df                	mov    %ebx,%edi
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	8d 35 f7 18 80 00    	lea    0x8018f7,%esi
+  8018f5:	0f 34                	sysenter
+  8018f7:	5d                   	pop    %ebp
+		goto out;
+  8018f8:	eb db                	jmp    8018d5 <sys_e1000_read_hwaddr+0x25>
+
+008018fa <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8018fa:	55                   	push   %ebp
+  8018fb:	89 e5                	mov    %esp,%ebp
+  8018fd:	57                   	push   %edi
+  8018fe:	56                   	push   %esi
+  8018ff:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801900:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801907:	74 1a                	je     801923 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801909:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80190e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801913:	8b 55 08             	mov    0x8(%ebp),%edx
+  801916:	89 cb                	mov    %ecx,%ebx
+  801918:	89 cf                	mov    %ecx,%edi
+  80191a:	89 ce                	mov    %ecx,%esi
+  80191c:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80191e:	5b                   	pop    %ebx
+  80191f:	5e                   	pop    %esi
+  801920:	5f                   	pop    %edi
+  801921:	5d                   	pop    %ebp
+  801922:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801923:	8b 55 08             	mov    0x8(%ebp),%edx
+  801926:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80192b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801930:	89 cb                	mov    %ecx,%ebx
+  801932:	89 cf                	mov    %ecx,%edi
+  801934:	55                   	push   %ebp
+  801935:	89 e5                	mov    %esp,%ebp
+  801937:	8d 35 3f 19 80 00    	lea    0x80193f,%esi
+  80193d:	0f 34                	sysenter
+  80193f:	5d                   	pop    %ebp
+		goto out;
+  801940:	eb dc                	jmp    80191e <sys_sb16_read_version+0x24>
+
+00801942 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801942:	55                   	push   %ebp
+  801943:	89 e5                	mov    %esp,%ebp
+  801945:	57                   	push   %edi
+  801946:	56                   	push   %esi
+  801947:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801948:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80194f:	74 1b                	je     80196c <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801951:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801956:	b8 16 00 00 00       	mov    $0x16,%eax
+  80195b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801961:	89 df                	mov    %ebx,%edi
+  801963:	89 de                	mov    %ebx,%esi
+  801965:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801967:	5b                   	pop    %ebx
+  801968:	5e                   	pop    %esi
+  801969:	5f                   	pop    %edi
+  80196a:	5d                   	pop    %ebp
+  80196b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80196c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801971:	8b 55 08             	mov    0x8(%ebp),%edx
+  801974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801977:	b8 16 00 00 00       	mov    $0x16,%eax
+  80197c:	89 df                	mov    %ebx,%edi
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	8d 35 89 19 80 00    	lea    0x801989,%esi
+  801987:	0f 34                	sysenter
+  801989:	5d                   	pop    %ebp
+		goto out;
+  80198a:	eb db                	jmp    801967 <sys_sb16_play+0x25>
+
+0080198c <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	53                   	push   %ebx
+  801990:	83 ec 04             	sub    $0x4,%esp
+  801993:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801995:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80199c:	f6 c4 04             	test   $0x4,%ah
+  80199f:	74 0c                	je     8019ad <dupperm+0x21>
+  8019a1:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8019a8:	f6 c4 08             	test   $0x8,%ah
+  8019ab:	75 62                	jne    801a0f <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  8019ad:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  8019b4:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  8019b9:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8019bf:	74 19                	je     8019da <dupperm+0x4e>
+  8019c1:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8019c8:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  8019cd:	83 f8 01             	cmp    $0x1,%eax
+  8019d0:	19 c0                	sbb    %eax,%eax
+  8019d2:	25 00 08 00 00       	and    $0x800,%eax
+  8019d7:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  8019da:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  8019e1:	89 c1                	mov    %eax,%ecx
+  8019e3:	80 cd 04             	or     $0x4,%ch
+  8019e6:	f6 c7 04             	test   $0x4,%bh
+  8019e9:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  8019ec:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8019f3:	f6 c1 02             	test   $0x2,%cl
+  8019f6:	74 12                	je     801a0a <dupperm+0x7e>
+  8019f8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  8019ff:	89 c2                	mov    %eax,%edx
+  801a01:	83 ca 02             	or     $0x2,%edx
+  801a04:	f6 c5 04             	test   $0x4,%ch
+  801a07:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801a0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a0d:	c9                   	leave
+  801a0e:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801a0f:	68 38 39 80 00       	push   $0x803938
+  801a14:	68 d0 39 80 00       	push   $0x8039d0
+  801a19:	6a 39                	push   $0x39
+  801a1b:	68 e5 39 80 00       	push   $0x8039e5
+  801a20:	e8 d6 e8 ff ff       	call   8002fb <_panic>
+
+00801a25 <pgfault>:
+{
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	53                   	push   %ebx
+  801a29:	83 ec 04             	sub    $0x4,%esp
+  801a2c:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801a2f:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801a31:	89 c3                	mov    %eax,%ebx
+  801a33:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801a39:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801a3d:	74 6d                	je     801aac <pgfault+0x87>
+  801a3f:	89 da                	mov    %ebx,%edx
+  801a41:	c1 ea 16             	shr    $0x16,%edx
+  801a44:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a4b:	f6 c2 80             	test   $0x80,%dl
+  801a4e:	75 5c                	jne    801aac <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801a50:	c1 e8 0c             	shr    $0xc,%eax
+  801a53:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801a5a:	f6 c4 08             	test   $0x8,%ah
+  801a5d:	74 4d                	je     801aac <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801a5f:	83 ec 04             	sub    $0x4,%esp
+  801a62:	6a 07                	push   $0x7
+  801a64:	68 00 f0 7f 00       	push   $0x7ff000
+  801a69:	6a 00                	push   $0x0
+  801a6b:	e8 a6 f4 ff ff       	call   800f16 <sys_page_alloc>
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	78 49                	js     801ac0 <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801a77:	83 ec 04             	sub    $0x4,%esp
+  801a7a:	68 00 10 00 00       	push   $0x1000
+  801a7f:	53                   	push   %ebx
+  801a80:	68 00 f0 7f 00       	push   $0x7ff000
+  801a85:	e8 1a f1 ff ff       	call   800ba4 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801a8a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801a91:	53                   	push   %ebx
+  801a92:	6a 00                	push   $0x0
+  801a94:	68 00 f0 7f 00       	push   $0x7ff000
+  801a99:	6a 00                	push   $0x0
+  801a9b:	e8 e3 f4 ff ff       	call   800f83 <sys_page_map>
+  801aa0:	83 c4 20             	add    $0x20,%esp
+  801aa3:	85 c0                	test   %eax,%eax
+  801aa5:	78 2d                	js     801ad4 <pgfault+0xaf>
+}
+  801aa7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aaa:	c9                   	leave
+  801aab:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801aac:	83 ec 04             	sub    $0x4,%esp
+  801aaf:	68 f0 39 80 00       	push   $0x8039f0
+  801ab4:	6a 1e                	push   $0x1e
+  801ab6:	68 e5 39 80 00       	push   $0x8039e5
+  801abb:	e8 3b e8 ff ff       	call   8002fb <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801ac0:	83 ec 04             	sub    $0x4,%esp
+  801ac3:	68 6c 39 80 00       	push   $0x80396c
+  801ac8:	6a 29                	push   $0x29
+  801aca:	68 e5 39 80 00       	push   $0x8039e5
+  801acf:	e8 27 e8 ff ff       	call   8002fb <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801ad4:	50                   	push   %eax
+  801ad5:	68 a0 39 80 00       	push   $0x8039a0
+  801ada:	6a 2e                	push   $0x2e
+  801adc:	68 e5 39 80 00       	push   $0x8039e5
+  801ae1:	e8 15 e8 ff ff       	call   8002fb <_panic>
+
+00801ae6 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801aec:	ff 75 0c             	push   0xc(%ebp)
+  801aef:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801af2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801af9:	e8 23 f3 ff ff       	call   800e21 <sys_env_destroy>
+}
+  801afe:	83 c4 10             	add    $0x10,%esp
+  801b01:	c9                   	leave
+  801b02:	c3                   	ret
+
+00801b03 <ufork>:
+{
+  801b03:	55                   	push   %ebp
+  801b04:	89 e5                	mov    %esp,%ebp
+  801b06:	57                   	push   %edi
+  801b07:	56                   	push   %esi
+  801b08:	53                   	push   %ebx
+  801b09:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801b0f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b14:	cd 30                	int    $0x30
+  801b16:	89 c6                	mov    %eax,%esi
+  801b18:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801b1e:	85 c0                	test   %eax,%eax
+  801b20:	78 56                	js     801b78 <ufork+0x75>
+	if (pid > 0) {
+  801b22:	0f 8e b3 02 00 00    	jle    801ddb <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801b28:	83 ec 0c             	sub    $0xc,%esp
+  801b2b:	68 25 1a 80 00       	push   $0x801a25
+  801b30:	e8 58 17 00 00       	call   80328d <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801b35:	83 c4 08             	add    $0x8,%esp
+  801b38:	68 f4 32 80 00       	push   $0x8032f4
+  801b3d:	56                   	push   %esi
+  801b3e:	e8 ef f5 ff ff       	call   801132 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801b43:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801b49:	89 1c 24             	mov    %ebx,(%esp)
+  801b4c:	e8 21 03 00 00       	call   801e72 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801b51:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801b58:	6a 07                	push   $0x7
+  801b5a:	68 00 f0 bf ee       	push   $0xeebff000
+  801b5f:	56                   	push   %esi
+  801b60:	53                   	push   %ebx
+  801b61:	e8 8d 04 00 00       	call   801ff3 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b66:	83 c4 20             	add    $0x20,%esp
+  801b69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b6e:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801b74:	89 fe                	mov    %edi,%esi
+  801b76:	eb 22                	jmp    801b9a <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801b78:	50                   	push   %eax
+  801b79:	68 09 3a 80 00       	push   $0x803a09
+  801b7e:	68 a9 00 00 00       	push   $0xa9
+  801b83:	68 e5 39 80 00       	push   $0x8039e5
+  801b88:	e8 6e e7 ff ff       	call   8002fb <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b8d:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b93:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b98:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b9a:	89 f7                	mov    %esi,%edi
+  801b9c:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801ba2:	0f 87 e9 01 00 00    	ja     801d91 <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801ba8:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801bae:	85 f6                	test   %esi,%esi
+  801bb0:	0f 49 d6             	cmovns %esi,%edx
+  801bb3:	c1 fa 0a             	sar    $0xa,%edx
+  801bb6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801bbd:	f6 c1 01             	test   $0x1,%cl
+  801bc0:	74 cb                	je     801b8d <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801bc2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bc9:	f6 c2 80             	test   $0x80,%dl
+  801bcc:	75 17                	jne    801be5 <ufork+0xe2>
+			j = i + 1;
+  801bce:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801bd1:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801bd8:	f6 c2 01             	test   $0x1,%dl
+  801bdb:	0f 85 f3 00 00 00    	jne    801cd4 <ufork+0x1d1>
+			j = i + 1;
+  801be1:	89 de                	mov    %ebx,%esi
+  801be3:	eb b5                	jmp    801b9a <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801be5:	89 fb                	mov    %edi,%ebx
+  801be7:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801bea:	89 d8                	mov    %ebx,%eax
+  801bec:	c1 e8 16             	shr    $0x16,%eax
+  801bef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bf6:	89 c2                	mov    %eax,%edx
+  801bf8:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801bfe:	25 02 04 00 00       	and    $0x402,%eax
+  801c03:	83 f8 02             	cmp    $0x2,%eax
+  801c06:	74 31                	je     801c39 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801c08:	83 ec 04             	sub    $0x4,%esp
+  801c0b:	6a 01                	push   $0x1
+  801c0d:	52                   	push   %edx
+  801c0e:	53                   	push   %ebx
+  801c0f:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c15:	53                   	push   %ebx
+  801c16:	6a 00                	push   $0x0
+  801c18:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801c1e:	50                   	push   %eax
+  801c1f:	e8 fa 03 00 00       	call   80201e <batch_map>
+		return;
+  801c24:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801c27:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801c2d:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801c32:	89 c6                	mov    %eax,%esi
+				continue;
+  801c34:	e9 61 ff ff ff       	jmp    801b9a <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801c39:	83 ec 04             	sub    $0x4,%esp
+  801c3c:	80 ca 80             	or     $0x80,%dl
+  801c3f:	52                   	push   %edx
+  801c40:	53                   	push   %ebx
+  801c41:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c47:	e8 ca f2 ff ff       	call   800f16 <sys_page_alloc>
+  801c4c:	83 c4 10             	add    $0x10,%esp
+  801c4f:	85 c0                	test   %eax,%eax
+  801c51:	78 5d                	js     801cb0 <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801c53:	83 ec 0c             	sub    $0xc,%esp
+  801c56:	6a 07                	push   $0x7
+  801c58:	68 00 00 40 00       	push   $0x400000
+  801c5d:	6a 00                	push   $0x0
+  801c5f:	53                   	push   %ebx
+  801c60:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c66:	e8 18 f3 ff ff       	call   800f83 <sys_page_map>
+  801c6b:	83 c4 20             	add    $0x20,%esp
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	78 50                	js     801cc2 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801c72:	83 ec 04             	sub    $0x4,%esp
+  801c75:	68 00 00 40 00       	push   $0x400000
+  801c7a:	53                   	push   %ebx
+  801c7b:	68 00 00 40 00       	push   $0x400000
+  801c80:	e8 1f ef ff ff       	call   800ba4 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801c85:	83 c4 08             	add    $0x8,%esp
+  801c88:	68 00 00 40 00       	push   $0x400000
+  801c8d:	6a 00                	push   $0x0
+  801c8f:	e8 5d f3 ff ff       	call   800ff1 <sys_page_unmap>
+  801c94:	83 c4 10             	add    $0x10,%esp
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	79 8c                	jns    801c27 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801c9b:	50                   	push   %eax
+  801c9c:	68 3d 3a 80 00       	push   $0x803a3d
+  801ca1:	68 81 00 00 00       	push   $0x81
+  801ca6:	68 e5 39 80 00       	push   $0x8039e5
+  801cab:	e8 4b e6 ff ff       	call   8002fb <_panic>
+		panic("sys_page_alloc: %e", r);
+  801cb0:	50                   	push   %eax
+  801cb1:	68 19 3a 80 00       	push   $0x803a19
+  801cb6:	6a 7c                	push   $0x7c
+  801cb8:	68 e5 39 80 00       	push   $0x8039e5
+  801cbd:	e8 39 e6 ff ff       	call   8002fb <_panic>
+		panic("sys_page_map: %e", r);
+  801cc2:	50                   	push   %eax
+  801cc3:	68 2c 3a 80 00       	push   $0x803a2c
+  801cc8:	6a 7e                	push   $0x7e
+  801cca:	68 e5 39 80 00       	push   $0x8039e5
+  801ccf:	e8 27 e6 ff ff       	call   8002fb <_panic>
+  801cd4:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801cda:	eb 22                	jmp    801cfe <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801cdc:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801ce3:	a8 01                	test   $0x1,%al
+  801ce5:	74 35                	je     801d1c <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801ce7:	89 d8                	mov    %ebx,%eax
+  801ce9:	e8 9e fc ff ff       	call   80198c <dupperm>
+  801cee:	89 c6                	mov    %eax,%esi
+  801cf0:	89 f8                	mov    %edi,%eax
+  801cf2:	e8 95 fc ff ff       	call   80198c <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cf7:	39 c6                	cmp    %eax,%esi
+  801cf9:	75 21                	jne    801d1c <ufork+0x219>
+				j++;
+  801cfb:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cfe:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801d04:	74 16                	je     801d1c <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801d06:	89 d8                	mov    %ebx,%eax
+  801d08:	c1 e8 0a             	shr    $0xa,%eax
+  801d0b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d12:	25 81 00 00 00       	and    $0x81,%eax
+  801d17:	83 f8 01             	cmp    $0x1,%eax
+  801d1a:	74 c0                	je     801cdc <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801d1c:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801d22:	89 d8                	mov    %ebx,%eax
+  801d24:	29 f0                	sub    %esi,%eax
+  801d26:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801d2c:	89 fe                	mov    %edi,%esi
+  801d2e:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801d31:	89 f8                	mov    %edi,%eax
+  801d33:	e8 54 fc ff ff       	call   80198c <dupperm>
+  801d38:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801d3a:	83 ec 08             	sub    $0x8,%esp
+  801d3d:	6a 02                	push   $0x2
+  801d3f:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d45:	51                   	push   %ecx
+  801d46:	e8 95 01 00 00       	call   801ee0 <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801d4b:	83 c4 0c             	add    $0xc,%esp
+  801d4e:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d54:	57                   	push   %edi
+  801d55:	56                   	push   %esi
+  801d56:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801d5c:	56                   	push   %esi
+  801d5d:	6a 00                	push   $0x0
+  801d5f:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d65:	51                   	push   %ecx
+  801d66:	e8 b3 02 00 00       	call   80201e <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801d6b:	83 c4 1c             	add    $0x1c,%esp
+  801d6e:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d74:	57                   	push   %edi
+  801d75:	56                   	push   %esi
+  801d76:	6a 00                	push   $0x0
+  801d78:	56                   	push   %esi
+  801d79:	6a 00                	push   $0x0
+  801d7b:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d81:	50                   	push   %eax
+  801d82:	e8 97 02 00 00       	call   80201e <batch_map>
+	return 0;
+  801d87:	83 c4 20             	add    $0x20,%esp
+  801d8a:	89 de                	mov    %ebx,%esi
+  801d8c:	e9 09 fe ff ff       	jmp    801b9a <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801d91:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801d97:	83 ec 04             	sub    $0x4,%esp
+  801d9a:	6a 02                	push   $0x2
+  801d9c:	56                   	push   %esi
+  801d9d:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801da3:	53                   	push   %ebx
+  801da4:	e8 c9 02 00 00       	call   802072 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801da9:	89 1c 24             	mov    %ebx,(%esp)
+  801dac:	e8 dd 00 00 00       	call   801e8e <batch_flush>
+  801db1:	83 c4 10             	add    $0x10,%esp
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 0e                	js     801dc6 <ufork+0x2c3>
+}
+  801db8:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801dbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc1:	5b                   	pop    %ebx
+  801dc2:	5e                   	pop    %esi
+  801dc3:	5f                   	pop    %edi
+  801dc4:	5d                   	pop    %ebp
+  801dc5:	c3                   	ret
+			panic("fork: %e", r);
+  801dc6:	50                   	push   %eax
+  801dc7:	68 10 3a 80 00       	push   $0x803a10
+  801dcc:	68 d7 00 00 00       	push   $0xd7
+  801dd1:	68 e5 39 80 00       	push   $0x8039e5
+  801dd6:	e8 20 e5 ff ff       	call   8002fb <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801ddb:	e8 aa f0 ff ff       	call   800e8a <sys_getenvid>
+  801de0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801de5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801deb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801df0:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801df5:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801dfc:	00 00 00 
+  801dff:	eb b7                	jmp    801db8 <ufork+0x2b5>
+
+00801e01 <fork>:
+{
+  801e01:	55                   	push   %ebp
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	53                   	push   %ebx
+  801e05:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801e08:	68 25 1a 80 00       	push   $0x801a25
+  801e0d:	e8 7b 14 00 00       	call   80328d <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801e12:	e8 7a f6 ff ff       	call   801491 <sys_fork>
+  801e17:	89 c3                	mov    %eax,%ebx
+  801e19:	83 c4 10             	add    $0x10,%esp
+  801e1c:	85 c0                	test   %eax,%eax
+  801e1e:	78 09                	js     801e29 <fork+0x28>
+	if (pid == 0)
+  801e20:	74 1c                	je     801e3e <fork+0x3d>
+}
+  801e22:	89 d8                	mov    %ebx,%eax
+  801e24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e27:	c9                   	leave
+  801e28:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801e29:	50                   	push   %eax
+  801e2a:	68 09 3a 80 00       	push   $0x803a09
+  801e2f:	68 ed 00 00 00       	push   $0xed
+  801e34:	68 e5 39 80 00       	push   $0x8039e5
+  801e39:	e8 bd e4 ff ff       	call   8002fb <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801e3e:	e8 47 f0 ff ff       	call   800e8a <sys_getenvid>
+  801e43:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e48:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e4e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801e53:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801e58:	eb c8                	jmp    801e22 <fork+0x21>
+
+00801e5a <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801e5a:	55                   	push   %ebp
+  801e5b:	89 e5                	mov    %esp,%ebp
+  801e5d:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801e60:	ff 75 0c             	push   0xc(%ebp)
+  801e63:	ff 75 08             	push   0x8(%ebp)
+  801e66:	68 e6 1a 80 00       	push   $0x801ae6
+  801e6b:	e8 67 f6 ff ff       	call   8014d7 <sys_thread_create>
+}
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+
+00801e72 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801e78:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801e7f:	00 00 00 
+	b->b_error = 0;
+  801e82:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801e89:	00 00 00 
+}
+  801e8c:	5d                   	pop    %ebp
+  801e8d:	c3                   	ret
+
+00801e8e <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801e8e:	55                   	push   %ebp
+  801e8f:	89 e5                	mov    %esp,%ebp
+  801e91:	53                   	push   %ebx
+  801e92:	83 ec 04             	sub    $0x4,%esp
+  801e95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801e98:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	7e 09                	jle    801eab <batch_flush+0x1d>
+  801ea2:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801ea9:	74 15                	je     801ec0 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801eab:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801eb2:	00 00 00 
+	return b->b_error;
+  801eb5:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801ebb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ebe:	c9                   	leave
+  801ebf:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801ec0:	83 ec 08             	sub    $0x8,%esp
+  801ec3:	50                   	push   %eax
+  801ec4:	53                   	push   %ebx
+  801ec5:	e8 32 f7 ff ff       	call   8015fc <sys_batch>
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	85 c0                	test   %eax,%eax
+  801ecf:	79 da                	jns    801eab <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801ed1:	f7 d8                	neg    %eax
+  801ed3:	0f b6 c0             	movzbl %al,%eax
+  801ed6:	f7 d8                	neg    %eax
+  801ed8:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801ede:	eb cb                	jmp    801eab <batch_flush+0x1d>
+
+00801ee0 <batch_reserve>:
+{
+  801ee0:	55                   	push   %ebp
+  801ee1:	89 e5                	mov    %esp,%ebp
+  801ee3:	83 ec 08             	sub    $0x8,%esp
+  801ee6:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801ee9:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801eef:	03 45 0c             	add    0xc(%ebp),%eax
+  801ef2:	83 f8 10             	cmp    $0x10,%eax
+  801ef5:	7f 02                	jg     801ef9 <batch_reserve+0x19>
+}
+  801ef7:	c9                   	leave
+  801ef8:	c3                   	ret
+		batch_flush(b);
+  801ef9:	83 ec 0c             	sub    $0xc,%esp
+  801efc:	52                   	push   %edx
+  801efd:	e8 8c ff ff ff       	call   801e8e <batch_flush>
+  801f02:	83 c4 10             	add    $0x10,%esp
+}
+  801f05:	eb f0                	jmp    801ef7 <batch_reserve+0x17>
+
+00801f07 <batch_next>:
+{
+  801f07:	55                   	push   %ebp
+  801f08:	89 e5                	mov    %esp,%ebp
+  801f0a:	53                   	push   %ebx
+  801f0b:	83 ec 04             	sub    $0x4,%esp
+  801f0e:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801f10:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801f17:	74 28                	je     801f41 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801f19:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801f1f:	8d 50 01             	lea    0x1(%eax),%edx
+  801f22:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801f28:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f2b:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801f2d:	83 ec 04             	sub    $0x4,%esp
+  801f30:	6a 1c                	push   $0x1c
+  801f32:	6a 00                	push   $0x0
+  801f34:	53                   	push   %ebx
+  801f35:	e8 35 ec ff ff       	call   800b6f <memset>
+}
+  801f3a:	89 d8                	mov    %ebx,%eax
+  801f3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f3f:	c9                   	leave
+  801f40:	c3                   	ret
+		batch_flush(b);
+  801f41:	83 ec 0c             	sub    $0xc,%esp
+  801f44:	50                   	push   %eax
+  801f45:	e8 44 ff ff ff       	call   801e8e <batch_flush>
+  801f4a:	83 c4 10             	add    $0x10,%esp
+  801f4d:	eb ca                	jmp    801f19 <batch_next+0x12>
+
+00801f4f <batch_page>:
+{
+  801f4f:	55                   	push   %ebp
+  801f50:	89 e5                	mov    %esp,%ebp
+  801f52:	57                   	push   %edi
+  801f53:	56                   	push   %esi
+  801f54:	53                   	push   %ebx
+  801f55:	83 ec 1c             	sub    $0x1c,%esp
+  801f58:	89 d3                	mov    %edx,%ebx
+  801f5a:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801f5c:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801f62:	85 d2                	test   %edx,%edx
+  801f64:	74 50                	je     801fb6 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801f66:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801f69:	01 c1                	add    %eax,%ecx
+  801f6b:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801f6e:	75 46                	jne    801fb6 <batch_page+0x67>
+  801f70:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801f73:	75 41                	jne    801fb6 <batch_page+0x67>
+  801f75:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801f78:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801f7b:	75 39                	jne    801fb6 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801f7d:	83 ea 01             	sub    $0x1,%edx
+  801f80:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801f83:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801f86:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801f8a:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801f8d:	75 27                	jne    801fb6 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801f8f:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801f92:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801f96:	89 fa                	mov    %edi,%edx
+  801f98:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801f9b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801f9e:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801fa1:	39 55 08             	cmp    %edx,0x8(%ebp)
+  801fa4:	75 10                	jne    801fb6 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801fa6:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  801faa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801fad:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  801fb1:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801fb4:	74 2a                	je     801fe0 <batch_page+0x91>
+	op = batch_next(b);
+  801fb6:	e8 4c ff ff ff       	call   801f07 <batch_next>
+	op->bo_op = opcode;
+  801fbb:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  801fbd:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  801fc0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fc3:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  801fc6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fc9:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  801fcc:	8b 75 10             	mov    0x10(%ebp),%esi
+  801fcf:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  801fd2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801fd5:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  801fd8:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801fdb:	89 78 14             	mov    %edi,0x14(%eax)
+  801fde:	eb 0b                	jmp    801feb <batch_page+0x9c>
+		op->bo_npages += npages;
+  801fe0:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  801fe4:	03 7d 18             	add    0x18(%ebp),%edi
+  801fe7:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  801feb:	83 c4 1c             	add    $0x1c,%esp
+  801fee:	5b                   	pop    %ebx
+  801fef:	5e                   	pop    %esi
+  801ff0:	5f                   	pop    %edi
+  801ff1:	5d                   	pop    %ebp
+  801ff2:	c3                   	ret
+
+00801ff3 <batch_alloc>:
+{
+  801ff3:	55                   	push   %ebp
+  801ff4:	89 e5                	mov    %esp,%ebp
+  801ff6:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  801ff9:	ff 75 18             	push   0x18(%ebp)
+  801ffc:	ff 75 14             	push   0x14(%ebp)
+  801fff:	ff 75 10             	push   0x10(%ebp)
+  802002:	ff 75 0c             	push   0xc(%ebp)
+  802005:	6a 00                	push   $0x0
+  802007:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80200c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802011:	8b 45 08             	mov    0x8(%ebp),%eax
+  802014:	e8 36 ff ff ff       	call   801f4f <batch_page>
+}
+  802019:	83 c4 20             	add    $0x20,%esp
+  80201c:	c9                   	leave
+  80201d:	c3                   	ret
+
+0080201e <batch_map>:
+{
+  80201e:	55                   	push   %ebp
+  80201f:	89 e5                	mov    %esp,%ebp
+  802021:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802024:	ff 75 20             	push   0x20(%ebp)
+  802027:	ff 75 1c             	push   0x1c(%ebp)
+  80202a:	ff 75 18             	push   0x18(%ebp)
+  80202d:	ff 75 14             	push   0x14(%ebp)
+  802030:	ff 75 10             	push   0x10(%ebp)
+  802033:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802036:	ba 01 00 00 00       	mov    $0x1,%edx
+  80203b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203e:	e8 0c ff ff ff       	call   801f4f <batch_page>
+}
+  802043:	83 c4 20             	add    $0x20,%esp
+  802046:	c9                   	leave
+  802047:	c3                   	ret
+
+00802048 <batch_unmap>:
+{
+  802048:	55                   	push   %ebp
+  802049:	89 e5                	mov    %esp,%ebp
+  80204b:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  80204e:	ff 75 14             	push   0x14(%ebp)
+  802051:	6a 00                	push   $0x0
+  802053:	ff 75 10             	push   0x10(%ebp)
+  802056:	ff 75 0c             	push   0xc(%ebp)
+  802059:	6a 00                	push   $0x0
+  80205b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802060:	ba 02 00 00 00       	mov    $0x2,%edx
+  802065:	8b 45 08             	mov    0x8(%ebp),%eax
+  802068:	e8 e2 fe ff ff       	call   801f4f <batch_page>
+}
+  80206d:	83 c4 20             	add    $0x20,%esp
+  802070:	c9                   	leave
+  802071:	c3                   	ret
+
+00802072 <batch_set_status>:
+{
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  802078:	8b 45 08             	mov    0x8(%ebp),%eax
+  80207b:	e8 87 fe ff ff       	call   801f07 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  802080:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  802086:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802089:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  80208c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80208f:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  802092:	c9                   	leave
+  802093:	c3                   	ret
+
+00802094 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802094:	55                   	push   %ebp
+  802095:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802097:	8b 45 08             	mov    0x8(%ebp),%eax
+  80209a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80209f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8020a2:	5d                   	pop    %ebp
+  8020a3:	c3                   	ret
+
+008020a4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8020a4:	55                   	push   %ebp
+  8020a5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020aa:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8020af:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8020b4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8020b9:	5d                   	pop    %ebp
+  8020ba:	c3                   	ret
+
+008020bb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8020be:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8020c3:	eb 02                	jmp    8020c7 <fd_alloc+0xc>
+  8020c5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8020c7:	89 c2                	mov    %eax,%edx
+  8020c9:	c1 ea 16             	shr    $0x16,%edx
+  8020cc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8020d3:	f6 c2 01             	test   $0x1,%dl
+  8020d6:	74 2b                	je     802103 <fd_alloc+0x48>
+  8020d8:	89 c2                	mov    %eax,%edx
+  8020da:	c1 ea 0c             	shr    $0xc,%edx
+  8020dd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8020e4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8020ea:	f6 c1 01             	test   $0x1,%cl
+  8020ed:	74 14                	je     802103 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8020ef:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8020f5:	75 ce                	jne    8020c5 <fd_alloc+0xa>
+  8020f7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8020fc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802101:	eb 05                	jmp    802108 <fd_alloc+0x4d>
+			return 0;
+  802103:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802108:	8b 55 08             	mov    0x8(%ebp),%edx
+  80210b:	89 02                	mov    %eax,(%edx)
+}
+  80210d:	89 c8                	mov    %ecx,%eax
+  80210f:	5d                   	pop    %ebp
+  802110:	c3                   	ret
+
+00802111 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802111:	55                   	push   %ebp
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802117:	83 f8 1f             	cmp    $0x1f,%eax
+  80211a:	77 30                	ja     80214c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80211c:	c1 e0 0c             	shl    $0xc,%eax
+  80211f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802124:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80212a:	f6 c2 01             	test   $0x1,%dl
+  80212d:	74 24                	je     802153 <fd_lookup+0x42>
+  80212f:	89 c2                	mov    %eax,%edx
+  802131:	c1 ea 0c             	shr    $0xc,%edx
+  802134:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80213b:	f6 c2 01             	test   $0x1,%dl
+  80213e:	74 1a                	je     80215a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802140:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802143:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802145:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80214a:	5d                   	pop    %ebp
+  80214b:	c3                   	ret
+		return -E_INVAL;
+  80214c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802151:	eb f7                	jmp    80214a <fd_lookup+0x39>
+		return -E_INVAL;
+  802153:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802158:	eb f0                	jmp    80214a <fd_lookup+0x39>
+  80215a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80215f:	eb e9                	jmp    80214a <fd_lookup+0x39>
+
+00802161 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802161:	55                   	push   %ebp
+  802162:	89 e5                	mov    %esp,%ebp
+  802164:	53                   	push   %ebx
+  802165:	83 ec 04             	sub    $0x4,%esp
+  802168:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80216b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802170:	eb 03                	jmp    802175 <dev_lookup+0x14>
+  802172:	83 c0 01             	add    $0x1,%eax
+  802175:	8b 1c 85 cc 3a 80 00 	mov    0x803acc(,%eax,4),%ebx
+  80217c:	85 db                	test   %ebx,%ebx
+  80217e:	74 0b                	je     80218b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802180:	39 13                	cmp    %edx,(%ebx)
+  802182:	75 ee                	jne    802172 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802184:	b8 00 00 00 00       	mov    $0x0,%eax
+  802189:	eb 2e                	jmp    8021b9 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80218b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80218d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802192:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802198:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80219d:	76 24                	jbe    8021c3 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80219f:	8b 41 48             	mov    0x48(%ecx),%eax
+  8021a2:	83 ec 04             	sub    $0x4,%esp
+  8021a5:	52                   	push   %edx
+  8021a6:	50                   	push   %eax
+  8021a7:	68 50 3a 80 00       	push   $0x803a50
+  8021ac:	e8 25 e2 ff ff       	call   8003d6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8021b1:	83 c4 10             	add    $0x10,%esp
+  8021b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8021b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021bc:	89 1a                	mov    %ebx,(%edx)
+}
+  8021be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021c1:	c9                   	leave
+  8021c2:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8021c3:	c1 e8 10             	shr    $0x10,%eax
+  8021c6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8021cc:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8021d2:	eb cb                	jmp    80219f <dev_lookup+0x3e>
+
+008021d4 <fd_close>:
+{
+  8021d4:	55                   	push   %ebp
+  8021d5:	89 e5                	mov    %esp,%ebp
+  8021d7:	57                   	push   %edi
+  8021d8:	56                   	push   %esi
+  8021d9:	53                   	push   %ebx
+  8021da:	83 ec 24             	sub    $0x24,%esp
+  8021dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8021e3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021e6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021e7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8021ed:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8021f0:	50                   	push   %eax
+  8021f1:	e8 1b ff ff ff       	call   802111 <fd_lookup>
+  8021f6:	89 c3                	mov    %eax,%ebx
+  8021f8:	83 c4 10             	add    $0x10,%esp
+  8021fb:	85 c0                	test   %eax,%eax
+  8021fd:	78 05                	js     802204 <fd_close+0x30>
+	    || fd != fd2)
+  8021ff:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802202:	74 16                	je     80221a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802204:	89 f8                	mov    %edi,%eax
+  802206:	84 c0                	test   %al,%al
+  802208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802210:	89 d8                	mov    %ebx,%eax
+  802212:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802215:	5b                   	pop    %ebx
+  802216:	5e                   	pop    %esi
+  802217:	5f                   	pop    %edi
+  802218:	5d                   	pop    %ebp
+  802219:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80221a:	83 ec 08             	sub    $0x8,%esp
+  80221d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802220:	50                   	push   %eax
+  802221:	ff 36                	push   (%esi)
+  802223:	e8 39 ff ff ff       	call   802161 <dev_lookup>
+  802228:	89 c3                	mov    %eax,%ebx
+  80222a:	83 c4 10             	add    $0x10,%esp
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	78 1a                	js     80224b <fd_close+0x77>
+		if (dev->dev_close)
+  802231:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802234:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802237:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	74 0b                	je     80224b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802240:	83 ec 0c             	sub    $0xc,%esp
+  802243:	56                   	push   %esi
+  802244:	ff d0                	call   *%eax
+  802246:	89 c3                	mov    %eax,%ebx
+  802248:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80224b:	83 ec 08             	sub    $0x8,%esp
+  80224e:	56                   	push   %esi
+  80224f:	6a 00                	push   $0x0
+  802251:	e8 9b ed ff ff       	call   800ff1 <sys_page_unmap>
+	return r;
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	eb b5                	jmp    802210 <fd_close+0x3c>
+
+0080225b <close>:
+
+int
+close(int fdnum)
+{
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802261:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802264:	50                   	push   %eax
+  802265:	ff 75 08             	push   0x8(%ebp)
+  802268:	e8 a4 fe ff ff       	call   802111 <fd_lookup>
+  80226d:	83 c4 10             	add    $0x10,%esp
+  802270:	85 c0                	test   %eax,%eax
+  802272:	79 02                	jns    802276 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802274:	c9                   	leave
+  802275:	c3                   	ret
+		return fd_close(fd, 1);
+  802276:	83 ec 08             	sub    $0x8,%esp
+  802279:	6a 01                	push   $0x1
+  80227b:	ff 75 f4             	push   -0xc(%ebp)
+  80227e:	e8 51 ff ff ff       	call   8021d4 <fd_close>
+  802283:	83 c4 10             	add    $0x10,%esp
+  802286:	eb ec                	jmp    802274 <close+0x19>
+
+00802288 <close_all>:
+
+void
+close_all(void)
+{
+  802288:	55                   	push   %ebp
+  802289:	89 e5                	mov    %esp,%ebp
+  80228b:	53                   	push   %ebx
+  80228c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80228f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802294:	83 ec 0c             	sub    $0xc,%esp
+  802297:	53                   	push   %ebx
+  802298:	e8 be ff ff ff       	call   80225b <close>
+	for (i = 0; i < MAXFD; i++)
+  80229d:	83 c3 01             	add    $0x1,%ebx
+  8022a0:	83 c4 10             	add    $0x10,%esp
+  8022a3:	83 fb 20             	cmp    $0x20,%ebx
+  8022a6:	75 ec                	jne    802294 <close_all+0xc>
+}
+  8022a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ab:	c9                   	leave
+  8022ac:	c3                   	ret
+
+008022ad <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8022ad:	55                   	push   %ebp
+  8022ae:	89 e5                	mov    %esp,%ebp
+  8022b0:	57                   	push   %edi
+  8022b1:	56                   	push   %esi
+  8022b2:	53                   	push   %ebx
+  8022b3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8022b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022b9:	50                   	push   %eax
+  8022ba:	ff 75 08             	push   0x8(%ebp)
+  8022bd:	e8 4f fe ff ff       	call   802111 <fd_lookup>
+  8022c2:	89 c3                	mov    %eax,%ebx
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  8022c7:	85 c0                	test   %eax,%eax
+  8022c9:	78 7f                	js     80234a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8022cb:	83 ec 0c             	sub    $0xc,%esp
+  8022ce:	ff 75 0c             	push   0xc(%ebp)
+  8022d1:	e8 85 ff ff ff       	call   80225b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8022d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8022d9:	c1 e6 0c             	shl    $0xc,%esi
+  8022dc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8022e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022e5:	89 3c 24             	mov    %edi,(%esp)
+  8022e8:	e8 b7 fd ff ff       	call   8020a4 <fd2data>
+  8022ed:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8022ef:	89 34 24             	mov    %esi,(%esp)
+  8022f2:	e8 ad fd ff ff       	call   8020a4 <fd2data>
+  8022f7:	83 c4 10             	add    $0x10,%esp
+  8022fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8022fd:	89 d8                	mov    %ebx,%eax
+  8022ff:	c1 e8 16             	shr    $0x16,%eax
+  802302:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802309:	a8 01                	test   $0x1,%al
+  80230b:	74 11                	je     80231e <dup+0x71>
+  80230d:	89 d8                	mov    %ebx,%eax
+  80230f:	c1 e8 0c             	shr    $0xc,%eax
+  802312:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802319:	f6 c2 01             	test   $0x1,%dl
+  80231c:	75 36                	jne    802354 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80231e:	89 f8                	mov    %edi,%eax
+  802320:	c1 e8 0c             	shr    $0xc,%eax
+  802323:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80232a:	83 ec 0c             	sub    $0xc,%esp
+  80232d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802332:	50                   	push   %eax
+  802333:	56                   	push   %esi
+  802334:	6a 00                	push   $0x0
+  802336:	57                   	push   %edi
+  802337:	6a 00                	push   $0x0
+  802339:	e8 45 ec ff ff       	call   800f83 <sys_page_map>
+  80233e:	89 c3                	mov    %eax,%ebx
+  802340:	83 c4 20             	add    $0x20,%esp
+  802343:	85 c0                	test   %eax,%eax
+  802345:	78 33                	js     80237a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802347:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80234a:	89 d8                	mov    %ebx,%eax
+  80234c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80234f:	5b                   	pop    %ebx
+  802350:	5e                   	pop    %esi
+  802351:	5f                   	pop    %edi
+  802352:	5d                   	pop    %ebp
+  802353:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802354:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80235b:	83 ec 0c             	sub    $0xc,%esp
+  80235e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802363:	50                   	push   %eax
+  802364:	ff 75 d4             	push   -0x2c(%ebp)
+  802367:	6a 00                	push   $0x0
+  802369:	53                   	push   %ebx
+  80236a:	6a 00                	push   $0x0
+  80236c:	e8 12 ec ff ff       	call   800f83 <sys_page_map>
+  802371:	89 c3                	mov    %eax,%ebx
+  802373:	83 c4 20             	add    $0x20,%esp
+  802376:	85 c0                	test   %eax,%eax
+  802378:	79 a4                	jns    80231e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80237a:	83 ec 08             	sub    $0x8,%esp
+  80237d:	56                   	push   %esi
+  80237e:	6a 00                	push   $0x0
+  802380:	e8 6c ec ff ff       	call   800ff1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802385:	83 c4 08             	add    $0x8,%esp
+  802388:	ff 75 d4             	push   -0x2c(%ebp)
+  80238b:	6a 00                	push   $0x0
+  80238d:	e8 5f ec ff ff       	call   800ff1 <sys_page_unmap>
+	return r;
+  802392:	83 c4 10             	add    $0x10,%esp
+  802395:	eb b3                	jmp    80234a <dup+0x9d>
+
+00802397 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802397:	55                   	push   %ebp
+  802398:	89 e5                	mov    %esp,%ebp
+  80239a:	56                   	push   %esi
+  80239b:	53                   	push   %ebx
+  80239c:	83 ec 18             	sub    $0x18,%esp
+  80239f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8023a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023a5:	50                   	push   %eax
+  8023a6:	53                   	push   %ebx
+  8023a7:	e8 65 fd ff ff       	call   802111 <fd_lookup>
+  8023ac:	83 c4 10             	add    $0x10,%esp
+  8023af:	85 c0                	test   %eax,%eax
+  8023b1:	78 3c                	js     8023ef <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023b3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023b6:	83 ec 08             	sub    $0x8,%esp
+  8023b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023bc:	50                   	push   %eax
+  8023bd:	ff 36                	push   (%esi)
+  8023bf:	e8 9d fd ff ff       	call   802161 <dev_lookup>
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	85 c0                	test   %eax,%eax
+  8023c9:	78 24                	js     8023ef <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8023cb:	8b 46 08             	mov    0x8(%esi),%eax
+  8023ce:	83 e0 03             	and    $0x3,%eax
+  8023d1:	83 f8 01             	cmp    $0x1,%eax
+  8023d4:	74 20                	je     8023f6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8023d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023d9:	8b 40 08             	mov    0x8(%eax),%eax
+  8023dc:	85 c0                	test   %eax,%eax
+  8023de:	74 57                	je     802437 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8023e0:	83 ec 04             	sub    $0x4,%esp
+  8023e3:	ff 75 10             	push   0x10(%ebp)
+  8023e6:	ff 75 0c             	push   0xc(%ebp)
+  8023e9:	56                   	push   %esi
+  8023ea:	ff d0                	call   *%eax
+  8023ec:	83 c4 10             	add    $0x10,%esp
+}
+  8023ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023f2:	5b                   	pop    %ebx
+  8023f3:	5e                   	pop    %esi
+  8023f4:	5d                   	pop    %ebp
+  8023f5:	c3                   	ret
+  8023f6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023f8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8023fd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802403:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802408:	76 1c                	jbe    802426 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80240a:	8b 42 48             	mov    0x48(%edx),%eax
+  80240d:	83 ec 04             	sub    $0x4,%esp
+  802410:	53                   	push   %ebx
+  802411:	50                   	push   %eax
+  802412:	68 91 3a 80 00       	push   $0x803a91
+  802417:	e8 ba df ff ff       	call   8003d6 <cprintf>
+		return -E_INVAL;
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802424:	eb c9                	jmp    8023ef <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802426:	c1 e8 10             	shr    $0x10,%eax
+  802429:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80242f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802435:	eb d3                	jmp    80240a <read+0x73>
+		return -E_NOT_SUPP;
+  802437:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80243c:	eb b1                	jmp    8023ef <read+0x58>
+
+0080243e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80243e:	55                   	push   %ebp
+  80243f:	89 e5                	mov    %esp,%ebp
+  802441:	57                   	push   %edi
+  802442:	56                   	push   %esi
+  802443:	53                   	push   %ebx
+  802444:	83 ec 0c             	sub    $0xc,%esp
+  802447:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80244a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80244d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802452:	eb 02                	jmp    802456 <readn+0x18>
+  802454:	01 c3                	add    %eax,%ebx
+  802456:	39 f3                	cmp    %esi,%ebx
+  802458:	73 21                	jae    80247b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80245a:	83 ec 04             	sub    $0x4,%esp
+  80245d:	89 f0                	mov    %esi,%eax
+  80245f:	29 d8                	sub    %ebx,%eax
+  802461:	50                   	push   %eax
+  802462:	89 d8                	mov    %ebx,%eax
+  802464:	03 45 0c             	add    0xc(%ebp),%eax
+  802467:	50                   	push   %eax
+  802468:	57                   	push   %edi
+  802469:	e8 29 ff ff ff       	call   802397 <read>
+		if (m < 0)
+  80246e:	83 c4 10             	add    $0x10,%esp
+  802471:	85 c0                	test   %eax,%eax
+  802473:	78 04                	js     802479 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802475:	75 dd                	jne    802454 <readn+0x16>
+  802477:	eb 02                	jmp    80247b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802479:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80247b:	89 d8                	mov    %ebx,%eax
+  80247d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802480:	5b                   	pop    %ebx
+  802481:	5e                   	pop    %esi
+  802482:	5f                   	pop    %edi
+  802483:	5d                   	pop    %ebp
+  802484:	c3                   	ret
+
+00802485 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802485:	55                   	push   %ebp
+  802486:	89 e5                	mov    %esp,%ebp
+  802488:	56                   	push   %esi
+  802489:	53                   	push   %ebx
+  80248a:	83 ec 18             	sub    $0x18,%esp
+  80248d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802490:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802493:	50                   	push   %eax
+  802494:	53                   	push   %ebx
+  802495:	e8 77 fc ff ff       	call   802111 <fd_lookup>
+  80249a:	83 c4 10             	add    $0x10,%esp
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	78 37                	js     8024d8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024a1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024a4:	83 ec 08             	sub    $0x8,%esp
+  8024a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024aa:	50                   	push   %eax
+  8024ab:	ff 36                	push   (%esi)
+  8024ad:	e8 af fc ff ff       	call   802161 <dev_lookup>
+  8024b2:	83 c4 10             	add    $0x10,%esp
+  8024b5:	85 c0                	test   %eax,%eax
+  8024b7:	78 1f                	js     8024d8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024b9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8024bd:	74 20                	je     8024df <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8024bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024c2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024c5:	85 c0                	test   %eax,%eax
+  8024c7:	74 57                	je     802520 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8024c9:	83 ec 04             	sub    $0x4,%esp
+  8024cc:	ff 75 10             	push   0x10(%ebp)
+  8024cf:	ff 75 0c             	push   0xc(%ebp)
+  8024d2:	56                   	push   %esi
+  8024d3:	ff d0                	call   *%eax
+  8024d5:	83 c4 10             	add    $0x10,%esp
+}
+  8024d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024db:	5b                   	pop    %ebx
+  8024dc:	5e                   	pop    %esi
+  8024dd:	5d                   	pop    %ebp
+  8024de:	c3                   	ret
+  8024df:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024e1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8024e6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024ec:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8024f1:	76 1c                	jbe    80250f <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024f3:	8b 42 48             	mov    0x48(%edx),%eax
+  8024f6:	83 ec 04             	sub    $0x4,%esp
+  8024f9:	53                   	push   %ebx
+  8024fa:	50                   	push   %eax
+  8024fb:	68 ad 3a 80 00       	push   $0x803aad
+  802500:	e8 d1 de ff ff       	call   8003d6 <cprintf>
+		return -E_INVAL;
+  802505:	83 c4 10             	add    $0x10,%esp
+  802508:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80250d:	eb c9                	jmp    8024d8 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80250f:	c1 e8 10             	shr    $0x10,%eax
+  802512:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802518:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80251e:	eb d3                	jmp    8024f3 <write+0x6e>
+		return -E_NOT_SUPP;
+  802520:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802525:	eb b1                	jmp    8024d8 <write+0x53>
+
+00802527 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802527:	55                   	push   %ebp
+  802528:	89 e5                	mov    %esp,%ebp
+  80252a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80252d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802530:	50                   	push   %eax
+  802531:	ff 75 08             	push   0x8(%ebp)
+  802534:	e8 d8 fb ff ff       	call   802111 <fd_lookup>
+  802539:	83 c4 10             	add    $0x10,%esp
+  80253c:	85 c0                	test   %eax,%eax
+  80253e:	78 0e                	js     80254e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802540:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802543:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802546:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802549:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80254e:	c9                   	leave
+  80254f:	c3                   	ret
+
+00802550 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802550:	55                   	push   %ebp
+  802551:	89 e5                	mov    %esp,%ebp
+  802553:	56                   	push   %esi
+  802554:	53                   	push   %ebx
+  802555:	83 ec 18             	sub    $0x18,%esp
+  802558:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80255b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80255e:	50                   	push   %eax
+  80255f:	53                   	push   %ebx
+  802560:	e8 ac fb ff ff       	call   802111 <fd_lookup>
+  802565:	83 c4 10             	add    $0x10,%esp
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	78 34                	js     8025a0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80256c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80256f:	83 ec 08             	sub    $0x8,%esp
+  802572:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802575:	50                   	push   %eax
+  802576:	ff 36                	push   (%esi)
+  802578:	e8 e4 fb ff ff       	call   802161 <dev_lookup>
+  80257d:	83 c4 10             	add    $0x10,%esp
+  802580:	85 c0                	test   %eax,%eax
+  802582:	78 1c                	js     8025a0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802584:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802588:	74 1d                	je     8025a7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80258a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80258d:	8b 40 18             	mov    0x18(%eax),%eax
+  802590:	85 c0                	test   %eax,%eax
+  802592:	74 54                	je     8025e8 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802594:	83 ec 08             	sub    $0x8,%esp
+  802597:	ff 75 0c             	push   0xc(%ebp)
+  80259a:	56                   	push   %esi
+  80259b:	ff d0                	call   *%eax
+  80259d:	83 c4 10             	add    $0x10,%esp
+}
+  8025a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025a3:	5b                   	pop    %ebx
+  8025a4:	5e                   	pop    %esi
+  8025a5:	5d                   	pop    %ebp
+  8025a6:	c3                   	ret
+  8025a7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025a9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025ae:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025b4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025b9:	76 1c                	jbe    8025d7 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8025bb:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8025be:	83 ec 04             	sub    $0x4,%esp
+  8025c1:	53                   	push   %ebx
+  8025c2:	50                   	push   %eax
+  8025c3:	68 70 3a 80 00       	push   $0x803a70
+  8025c8:	e8 09 de ff ff       	call   8003d6 <cprintf>
+		return -E_INVAL;
+  8025cd:	83 c4 10             	add    $0x10,%esp
+  8025d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025d5:	eb c9                	jmp    8025a0 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025d7:	c1 e8 10             	shr    $0x10,%eax
+  8025da:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025e0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025e6:	eb d3                	jmp    8025bb <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8025e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025ed:	eb b1                	jmp    8025a0 <ftruncate+0x50>
+
+008025ef <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8025ef:	55                   	push   %ebp
+  8025f0:	89 e5                	mov    %esp,%ebp
+  8025f2:	56                   	push   %esi
+  8025f3:	53                   	push   %ebx
+  8025f4:	83 ec 18             	sub    $0x18,%esp
+  8025f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025fd:	50                   	push   %eax
+  8025fe:	ff 75 08             	push   0x8(%ebp)
+  802601:	e8 0b fb ff ff       	call   802111 <fd_lookup>
+  802606:	83 c4 10             	add    $0x10,%esp
+  802609:	85 c0                	test   %eax,%eax
+  80260b:	78 49                	js     802656 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80260d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802610:	83 ec 08             	sub    $0x8,%esp
+  802613:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802616:	50                   	push   %eax
+  802617:	ff 36                	push   (%esi)
+  802619:	e8 43 fb ff ff       	call   802161 <dev_lookup>
+  80261e:	83 c4 10             	add    $0x10,%esp
+  802621:	85 c0                	test   %eax,%eax
+  802623:	78 31                	js     802656 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802625:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802628:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80262c:	74 2f                	je     80265d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80262e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802631:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802638:	00 00 00 
+	stat->st_isdir = 0;
+  80263b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802642:	00 00 00 
+	stat->st_dev = dev;
+  802645:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80264b:	83 ec 08             	sub    $0x8,%esp
+  80264e:	53                   	push   %ebx
+  80264f:	56                   	push   %esi
+  802650:	ff 50 14             	call   *0x14(%eax)
+  802653:	83 c4 10             	add    $0x10,%esp
+}
+  802656:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802659:	5b                   	pop    %ebx
+  80265a:	5e                   	pop    %esi
+  80265b:	5d                   	pop    %ebp
+  80265c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80265d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802662:	eb f2                	jmp    802656 <fstat+0x67>
+
+00802664 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802664:	55                   	push   %ebp
+  802665:	89 e5                	mov    %esp,%ebp
+  802667:	56                   	push   %esi
+  802668:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802669:	83 ec 08             	sub    $0x8,%esp
+  80266c:	6a 00                	push   $0x0
+  80266e:	ff 75 08             	push   0x8(%ebp)
+  802671:	e8 e4 01 00 00       	call   80285a <open>
+  802676:	89 c3                	mov    %eax,%ebx
+  802678:	83 c4 10             	add    $0x10,%esp
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	78 1b                	js     80269a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80267f:	83 ec 08             	sub    $0x8,%esp
+  802682:	ff 75 0c             	push   0xc(%ebp)
+  802685:	50                   	push   %eax
+  802686:	e8 64 ff ff ff       	call   8025ef <fstat>
+  80268b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80268d:	89 1c 24             	mov    %ebx,(%esp)
+  802690:	e8 c6 fb ff ff       	call   80225b <close>
+	return r;
+  802695:	83 c4 10             	add    $0x10,%esp
+  802698:	89 f3                	mov    %esi,%ebx
+}
+  80269a:	89 d8                	mov    %ebx,%eax
+  80269c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80269f:	5b                   	pop    %ebx
+  8026a0:	5e                   	pop    %esi
+  8026a1:	5d                   	pop    %ebp
+  8026a2:	c3                   	ret
+
+008026a3 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8026a3:	55                   	push   %ebp
+  8026a4:	89 e5                	mov    %esp,%ebp
+  8026a6:	56                   	push   %esi
+  8026a7:	53                   	push   %ebx
+  8026a8:	89 c6                	mov    %eax,%esi
+  8026aa:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8026ac:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8026b3:	74 27                	je     8026dc <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8026b5:	6a 07                	push   $0x7
+  8026b7:	68 00 60 80 00       	push   $0x806000
+  8026bc:	56                   	push   %esi
+  8026bd:	ff 35 00 50 80 00    	push   0x805000
+  8026c3:	e8 41 0d 00 00       	call   803409 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8026c8:	83 c4 0c             	add    $0xc,%esp
+  8026cb:	6a 00                	push   $0x0
+  8026cd:	53                   	push   %ebx
+  8026ce:	6a 00                	push   $0x0
+  8026d0:	e8 1c 0d 00 00       	call   8033f1 <ipc_recv>
+}
+  8026d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026d8:	5b                   	pop    %ebx
+  8026d9:	5e                   	pop    %esi
+  8026da:	5d                   	pop    %ebp
+  8026db:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026dc:	83 ec 0c             	sub    $0xc,%esp
+  8026df:	6a 01                	push   $0x1
+  8026e1:	e8 77 0d 00 00       	call   80345d <ipc_find_env>
+  8026e6:	a3 00 50 80 00       	mov    %eax,0x805000
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	eb c5                	jmp    8026b5 <fsipc+0x12>
+
+008026f0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8026f0:	55                   	push   %ebp
+  8026f1:	89 e5                	mov    %esp,%ebp
+  8026f3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8026f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026fc:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802701:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802704:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802709:	ba 00 00 00 00       	mov    $0x0,%edx
+  80270e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802713:	e8 8b ff ff ff       	call   8026a3 <fsipc>
+}
+  802718:	c9                   	leave
+  802719:	c3                   	ret
+
+0080271a <devfile_flush>:
+{
+  80271a:	55                   	push   %ebp
+  80271b:	89 e5                	mov    %esp,%ebp
+  80271d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802720:	8b 45 08             	mov    0x8(%ebp),%eax
+  802723:	8b 40 0c             	mov    0xc(%eax),%eax
+  802726:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80272b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802730:	b8 06 00 00 00       	mov    $0x6,%eax
+  802735:	e8 69 ff ff ff       	call   8026a3 <fsipc>
+}
+  80273a:	c9                   	leave
+  80273b:	c3                   	ret
+
+0080273c <devfile_stat>:
+{
+  80273c:	55                   	push   %ebp
+  80273d:	89 e5                	mov    %esp,%ebp
+  80273f:	53                   	push   %ebx
+  802740:	83 ec 04             	sub    $0x4,%esp
+  802743:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802746:	8b 45 08             	mov    0x8(%ebp),%eax
+  802749:	8b 40 0c             	mov    0xc(%eax),%eax
+  80274c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802751:	ba 00 00 00 00       	mov    $0x0,%edx
+  802756:	b8 05 00 00 00       	mov    $0x5,%eax
+  80275b:	e8 43 ff ff ff       	call   8026a3 <fsipc>
+  802760:	85 c0                	test   %eax,%eax
+  802762:	78 2c                	js     802790 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802764:	83 ec 08             	sub    $0x8,%esp
+  802767:	68 00 60 80 00       	push   $0x806000
+  80276c:	53                   	push   %ebx
+  80276d:	e8 ac e2 ff ff       	call   800a1e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802772:	a1 80 60 80 00       	mov    0x806080,%eax
+  802777:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80277d:	a1 84 60 80 00       	mov    0x806084,%eax
+  802782:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802790:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802793:	c9                   	leave
+  802794:	c3                   	ret
+
+00802795 <devfile_write>:
+{
+  802795:	55                   	push   %ebp
+  802796:	89 e5                	mov    %esp,%ebp
+  802798:	83 ec 0c             	sub    $0xc,%esp
+  80279b:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80279e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027a1:	8b 52 0c             	mov    0xc(%edx),%edx
+  8027a4:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8027aa:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8027af:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8027b4:	39 d0                	cmp    %edx,%eax
+  8027b6:	0f 47 c2             	cmova  %edx,%eax
+  8027b9:	50                   	push   %eax
+  8027ba:	ff 75 0c             	push   0xc(%ebp)
+  8027bd:	68 08 60 80 00       	push   $0x806008
+  8027c2:	e8 dd e3 ff ff       	call   800ba4 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8027c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027cc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027d1:	e8 cd fe ff ff       	call   8026a3 <fsipc>
+}
+  8027d6:	c9                   	leave
+  8027d7:	c3                   	ret
+
+008027d8 <devfile_read>:
+{
+  8027d8:	55                   	push   %ebp
+  8027d9:	89 e5                	mov    %esp,%ebp
+  8027db:	56                   	push   %esi
+  8027dc:	53                   	push   %ebx
+  8027dd:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027e6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8027eb:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8027f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8027fb:	e8 a3 fe ff ff       	call   8026a3 <fsipc>
+  802800:	89 c3                	mov    %eax,%ebx
+  802802:	85 c0                	test   %eax,%eax
+  802804:	78 1f                	js     802825 <devfile_read+0x4d>
+	assert(r <= n);
+  802806:	39 c6                	cmp    %eax,%esi
+  802808:	72 24                	jb     80282e <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80280a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80280f:	7f 33                	jg     802844 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802811:	83 ec 04             	sub    $0x4,%esp
+  802814:	50                   	push   %eax
+  802815:	68 00 60 80 00       	push   $0x806000
+  80281a:	ff 75 0c             	push   0xc(%ebp)
+  80281d:	e8 82 e3 ff ff       	call   800ba4 <memmove>
+	return r;
+  802822:	83 c4 10             	add    $0x10,%esp
+}
+  802825:	89 d8                	mov    %ebx,%eax
+  802827:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80282a:	5b                   	pop    %ebx
+  80282b:	5e                   	pop    %esi
+  80282c:	5d                   	pop    %ebp
+  80282d:	c3                   	ret
+	assert(r <= n);
+  80282e:	68 e0 3a 80 00       	push   $0x803ae0
+  802833:	68 d0 39 80 00       	push   $0x8039d0
+  802838:	6a 76                	push   $0x76
+  80283a:	68 e7 3a 80 00       	push   $0x803ae7
+  80283f:	e8 b7 da ff ff       	call   8002fb <_panic>
+	assert(r <= PGSIZE);
+  802844:	68 f2 3a 80 00       	push   $0x803af2
+  802849:	68 d0 39 80 00       	push   $0x8039d0
+  80284e:	6a 77                	push   $0x77
+  802850:	68 e7 3a 80 00       	push   $0x803ae7
+  802855:	e8 a1 da ff ff       	call   8002fb <_panic>
+
+0080285a <open>:
+{
+  80285a:	55                   	push   %ebp
+  80285b:	89 e5                	mov    %esp,%ebp
+  80285d:	56                   	push   %esi
+  80285e:	53                   	push   %ebx
+  80285f:	83 ec 1c             	sub    $0x1c,%esp
+  802862:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802865:	56                   	push   %esi
+  802866:	e8 78 e1 ff ff       	call   8009e3 <strlen>
+  80286b:	83 c4 10             	add    $0x10,%esp
+  80286e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802873:	7f 6c                	jg     8028e1 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802875:	83 ec 0c             	sub    $0xc,%esp
+  802878:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80287b:	50                   	push   %eax
+  80287c:	e8 3a f8 ff ff       	call   8020bb <fd_alloc>
+  802881:	89 c3                	mov    %eax,%ebx
+  802883:	83 c4 10             	add    $0x10,%esp
+  802886:	85 c0                	test   %eax,%eax
+  802888:	78 3c                	js     8028c6 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80288a:	83 ec 08             	sub    $0x8,%esp
+  80288d:	56                   	push   %esi
+  80288e:	68 00 60 80 00       	push   $0x806000
+  802893:	e8 86 e1 ff ff       	call   800a1e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802898:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80289b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8028a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028a8:	e8 f6 fd ff ff       	call   8026a3 <fsipc>
+  8028ad:	89 c3                	mov    %eax,%ebx
+  8028af:	83 c4 10             	add    $0x10,%esp
+  8028b2:	85 c0                	test   %eax,%eax
+  8028b4:	78 19                	js     8028cf <open+0x75>
+	return fd2num(fd);
+  8028b6:	83 ec 0c             	sub    $0xc,%esp
+  8028b9:	ff 75 f4             	push   -0xc(%ebp)
+  8028bc:	e8 d3 f7 ff ff       	call   802094 <fd2num>
+  8028c1:	89 c3                	mov    %eax,%ebx
+  8028c3:	83 c4 10             	add    $0x10,%esp
+}
+  8028c6:	89 d8                	mov    %ebx,%eax
+  8028c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028cb:	5b                   	pop    %ebx
+  8028cc:	5e                   	pop    %esi
+  8028cd:	5d                   	pop    %ebp
+  8028ce:	c3                   	ret
+		fd_close(fd, 0);
+  8028cf:	83 ec 08             	sub    $0x8,%esp
+  8028d2:	6a 00                	push   $0x0
+  8028d4:	ff 75 f4             	push   -0xc(%ebp)
+  8028d7:	e8 f8 f8 ff ff       	call   8021d4 <fd_close>
+		return r;
+  8028dc:	83 c4 10             	add    $0x10,%esp
+  8028df:	eb e5                	jmp    8028c6 <open+0x6c>
+		return -E_BAD_PATH;
+  8028e1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8028e6:	eb de                	jmp    8028c6 <open+0x6c>
+
+008028e8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8028e8:	55                   	push   %ebp
+  8028e9:	89 e5                	mov    %esp,%ebp
+  8028eb:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8028ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8028f8:	e8 a6 fd ff ff       	call   8026a3 <fsipc>
+}
+  8028fd:	c9                   	leave
+  8028fe:	c3                   	ret
+
+008028ff <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028ff:	55                   	push   %ebp
+  802900:	89 e5                	mov    %esp,%ebp
+  802902:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802905:	68 fe 3a 80 00       	push   $0x803afe
+  80290a:	ff 75 0c             	push   0xc(%ebp)
+  80290d:	e8 0c e1 ff ff       	call   800a1e <strcpy>
+	return 0;
+}
+  802912:	b8 00 00 00 00       	mov    $0x0,%eax
+  802917:	c9                   	leave
+  802918:	c3                   	ret
+
+00802919 <devsock_close>:
+{
+  802919:	55                   	push   %ebp
+  80291a:	89 e5                	mov    %esp,%ebp
+  80291c:	53                   	push   %ebx
+  80291d:	83 ec 10             	sub    $0x10,%esp
+  802920:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802923:	53                   	push   %ebx
+  802924:	e8 73 0b 00 00       	call   80349c <pageref>
+  802929:	89 c2                	mov    %eax,%edx
+  80292b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80292e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802933:	83 fa 01             	cmp    $0x1,%edx
+  802936:	74 05                	je     80293d <devsock_close+0x24>
+}
+  802938:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80293b:	c9                   	leave
+  80293c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80293d:	83 ec 0c             	sub    $0xc,%esp
+  802940:	ff 73 0c             	push   0xc(%ebx)
+  802943:	e8 b7 02 00 00       	call   802bff <nsipc_close>
+  802948:	83 c4 10             	add    $0x10,%esp
+  80294b:	eb eb                	jmp    802938 <devsock_close+0x1f>
+
+0080294d <devsock_write>:
+{
+  80294d:	55                   	push   %ebp
+  80294e:	89 e5                	mov    %esp,%ebp
+  802950:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802953:	6a 00                	push   $0x0
+  802955:	ff 75 10             	push   0x10(%ebp)
+  802958:	ff 75 0c             	push   0xc(%ebp)
+  80295b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80295e:	ff 70 0c             	push   0xc(%eax)
+  802961:	e8 79 03 00 00       	call   802cdf <nsipc_send>
+}
+  802966:	c9                   	leave
+  802967:	c3                   	ret
+
+00802968 <devsock_read>:
+{
+  802968:	55                   	push   %ebp
+  802969:	89 e5                	mov    %esp,%ebp
+  80296b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80296e:	6a 00                	push   $0x0
+  802970:	ff 75 10             	push   0x10(%ebp)
+  802973:	ff 75 0c             	push   0xc(%ebp)
+  802976:	8b 45 08             	mov    0x8(%ebp),%eax
+  802979:	ff 70 0c             	push   0xc(%eax)
+  80297c:	e8 ef 02 00 00       	call   802c70 <nsipc_recv>
+}
+  802981:	c9                   	leave
+  802982:	c3                   	ret
+
+00802983 <fd2sockid>:
+{
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802989:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80298c:	52                   	push   %edx
+  80298d:	50                   	push   %eax
+  80298e:	e8 7e f7 ff ff       	call   802111 <fd_lookup>
+  802993:	83 c4 10             	add    $0x10,%esp
+  802996:	85 c0                	test   %eax,%eax
+  802998:	78 10                	js     8029aa <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80299a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80299d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8029a3:	39 08                	cmp    %ecx,(%eax)
+  8029a5:	75 05                	jne    8029ac <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8029a7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8029aa:	c9                   	leave
+  8029ab:	c3                   	ret
+		return -E_NOT_SUPP;
+  8029ac:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8029b1:	eb f7                	jmp    8029aa <fd2sockid+0x27>
+
+008029b3 <alloc_sockfd>:
+{
+  8029b3:	55                   	push   %ebp
+  8029b4:	89 e5                	mov    %esp,%ebp
+  8029b6:	56                   	push   %esi
+  8029b7:	53                   	push   %ebx
+  8029b8:	83 ec 1c             	sub    $0x1c,%esp
+  8029bb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8029bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029c0:	50                   	push   %eax
+  8029c1:	e8 f5 f6 ff ff       	call   8020bb <fd_alloc>
+  8029c6:	89 c3                	mov    %eax,%ebx
+  8029c8:	83 c4 10             	add    $0x10,%esp
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	78 43                	js     802a12 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8029cf:	83 ec 04             	sub    $0x4,%esp
+  8029d2:	68 07 04 00 00       	push   $0x407
+  8029d7:	ff 75 f4             	push   -0xc(%ebp)
+  8029da:	6a 00                	push   $0x0
+  8029dc:	e8 35 e5 ff ff       	call   800f16 <sys_page_alloc>
+  8029e1:	89 c3                	mov    %eax,%ebx
+  8029e3:	83 c4 10             	add    $0x10,%esp
+  8029e6:	85 c0                	test   %eax,%eax
+  8029e8:	78 28                	js     802a12 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8029ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029ed:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8029f3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8029f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029f8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8029ff:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802a02:	83 ec 0c             	sub    $0xc,%esp
+  802a05:	50                   	push   %eax
+  802a06:	e8 89 f6 ff ff       	call   802094 <fd2num>
+  802a0b:	89 c3                	mov    %eax,%ebx
+  802a0d:	83 c4 10             	add    $0x10,%esp
+  802a10:	eb 0c                	jmp    802a1e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802a12:	83 ec 0c             	sub    $0xc,%esp
+  802a15:	56                   	push   %esi
+  802a16:	e8 e4 01 00 00       	call   802bff <nsipc_close>
+		return r;
+  802a1b:	83 c4 10             	add    $0x10,%esp
+}
+  802a1e:	89 d8                	mov    %ebx,%eax
+  802a20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a23:	5b                   	pop    %ebx
+  802a24:	5e                   	pop    %esi
+  802a25:	5d                   	pop    %ebp
+  802a26:	c3                   	ret
+
+00802a27 <accept>:
+{
+  802a27:	55                   	push   %ebp
+  802a28:	89 e5                	mov    %esp,%ebp
+  802a2a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a30:	e8 4e ff ff ff       	call   802983 <fd2sockid>
+  802a35:	85 c0                	test   %eax,%eax
+  802a37:	78 1b                	js     802a54 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802a39:	83 ec 04             	sub    $0x4,%esp
+  802a3c:	ff 75 10             	push   0x10(%ebp)
+  802a3f:	ff 75 0c             	push   0xc(%ebp)
+  802a42:	50                   	push   %eax
+  802a43:	e8 0e 01 00 00       	call   802b56 <nsipc_accept>
+  802a48:	83 c4 10             	add    $0x10,%esp
+  802a4b:	85 c0                	test   %eax,%eax
+  802a4d:	78 05                	js     802a54 <accept+0x2d>
+	return alloc_sockfd(r);
+  802a4f:	e8 5f ff ff ff       	call   8029b3 <alloc_sockfd>
+}
+  802a54:	c9                   	leave
+  802a55:	c3                   	ret
+
+00802a56 <bind>:
+{
+  802a56:	55                   	push   %ebp
+  802a57:	89 e5                	mov    %esp,%ebp
+  802a59:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5f:	e8 1f ff ff ff       	call   802983 <fd2sockid>
+  802a64:	85 c0                	test   %eax,%eax
+  802a66:	78 12                	js     802a7a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802a68:	83 ec 04             	sub    $0x4,%esp
+  802a6b:	ff 75 10             	push   0x10(%ebp)
+  802a6e:	ff 75 0c             	push   0xc(%ebp)
+  802a71:	50                   	push   %eax
+  802a72:	e8 31 01 00 00       	call   802ba8 <nsipc_bind>
+  802a77:	83 c4 10             	add    $0x10,%esp
+}
+  802a7a:	c9                   	leave
+  802a7b:	c3                   	ret
+
+00802a7c <shutdown>:
+{
+  802a7c:	55                   	push   %ebp
+  802a7d:	89 e5                	mov    %esp,%ebp
+  802a7f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a85:	e8 f9 fe ff ff       	call   802983 <fd2sockid>
+  802a8a:	85 c0                	test   %eax,%eax
+  802a8c:	78 0f                	js     802a9d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802a8e:	83 ec 08             	sub    $0x8,%esp
+  802a91:	ff 75 0c             	push   0xc(%ebp)
+  802a94:	50                   	push   %eax
+  802a95:	e8 43 01 00 00       	call   802bdd <nsipc_shutdown>
+  802a9a:	83 c4 10             	add    $0x10,%esp
+}
+  802a9d:	c9                   	leave
+  802a9e:	c3                   	ret
+
+00802a9f <connect>:
+{
+  802a9f:	55                   	push   %ebp
+  802aa0:	89 e5                	mov    %esp,%ebp
+  802aa2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802aa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa8:	e8 d6 fe ff ff       	call   802983 <fd2sockid>
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 12                	js     802ac3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802ab1:	83 ec 04             	sub    $0x4,%esp
+  802ab4:	ff 75 10             	push   0x10(%ebp)
+  802ab7:	ff 75 0c             	push   0xc(%ebp)
+  802aba:	50                   	push   %eax
+  802abb:	e8 59 01 00 00       	call   802c19 <nsipc_connect>
+  802ac0:	83 c4 10             	add    $0x10,%esp
+}
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <listen>:
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802acb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ace:	e8 b0 fe ff ff       	call   802983 <fd2sockid>
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	78 0f                	js     802ae6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802ad7:	83 ec 08             	sub    $0x8,%esp
+  802ada:	ff 75 0c             	push   0xc(%ebp)
+  802add:	50                   	push   %eax
+  802ade:	e8 6b 01 00 00       	call   802c4e <nsipc_listen>
+  802ae3:	83 c4 10             	add    $0x10,%esp
+}
+  802ae6:	c9                   	leave
+  802ae7:	c3                   	ret
+
+00802ae8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802ae8:	55                   	push   %ebp
+  802ae9:	89 e5                	mov    %esp,%ebp
+  802aeb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802aee:	ff 75 10             	push   0x10(%ebp)
+  802af1:	ff 75 0c             	push   0xc(%ebp)
+  802af4:	ff 75 08             	push   0x8(%ebp)
+  802af7:	e8 41 02 00 00       	call   802d3d <nsipc_socket>
+  802afc:	83 c4 10             	add    $0x10,%esp
+  802aff:	85 c0                	test   %eax,%eax
+  802b01:	78 05                	js     802b08 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b03:	e8 ab fe ff ff       	call   8029b3 <alloc_sockfd>
+}
+  802b08:	c9                   	leave
+  802b09:	c3                   	ret
+
+00802b0a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b0a:	55                   	push   %ebp
+  802b0b:	89 e5                	mov    %esp,%ebp
+  802b0d:	53                   	push   %ebx
+  802b0e:	83 ec 04             	sub    $0x4,%esp
+  802b11:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802b13:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802b1a:	74 26                	je     802b42 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b1c:	6a 07                	push   $0x7
+  802b1e:	68 00 70 80 00       	push   $0x807000
+  802b23:	53                   	push   %ebx
+  802b24:	ff 35 04 50 80 00    	push   0x805004
+  802b2a:	e8 da 08 00 00       	call   803409 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b2f:	83 c4 0c             	add    $0xc,%esp
+  802b32:	6a 00                	push   $0x0
+  802b34:	6a 00                	push   $0x0
+  802b36:	6a 00                	push   $0x0
+  802b38:	e8 b4 08 00 00       	call   8033f1 <ipc_recv>
+}
+  802b3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b40:	c9                   	leave
+  802b41:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b42:	83 ec 0c             	sub    $0xc,%esp
+  802b45:	6a 02                	push   $0x2
+  802b47:	e8 11 09 00 00       	call   80345d <ipc_find_env>
+  802b4c:	a3 04 50 80 00       	mov    %eax,0x805004
+  802b51:	83 c4 10             	add    $0x10,%esp
+  802b54:	eb c6                	jmp    802b1c <nsipc+0x12>
+
+00802b56 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802b56:	55                   	push   %ebp
+  802b57:	89 e5                	mov    %esp,%ebp
+  802b59:	56                   	push   %esi
+  802b5a:	53                   	push   %ebx
+  802b5b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b61:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802b66:	8b 06                	mov    (%esi),%eax
+  802b68:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b72:	e8 93 ff ff ff       	call   802b0a <nsipc>
+  802b77:	89 c3                	mov    %eax,%ebx
+  802b79:	85 c0                	test   %eax,%eax
+  802b7b:	79 09                	jns    802b86 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802b7d:	89 d8                	mov    %ebx,%eax
+  802b7f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b82:	5b                   	pop    %ebx
+  802b83:	5e                   	pop    %esi
+  802b84:	5d                   	pop    %ebp
+  802b85:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b86:	83 ec 04             	sub    $0x4,%esp
+  802b89:	ff 35 10 70 80 00    	push   0x807010
+  802b8f:	68 00 70 80 00       	push   $0x807000
+  802b94:	ff 75 0c             	push   0xc(%ebp)
+  802b97:	e8 08 e0 ff ff       	call   800ba4 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b9c:	a1 10 70 80 00       	mov    0x807010,%eax
+  802ba1:	89 06                	mov    %eax,(%esi)
+  802ba3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ba6:	eb d5                	jmp    802b7d <nsipc_accept+0x27>
+
+00802ba8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ba8:	55                   	push   %ebp
+  802ba9:	89 e5                	mov    %esp,%ebp
+  802bab:	53                   	push   %ebx
+  802bac:	83 ec 08             	sub    $0x8,%esp
+  802baf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802bb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb5:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802bba:	53                   	push   %ebx
+  802bbb:	ff 75 0c             	push   0xc(%ebp)
+  802bbe:	68 04 70 80 00       	push   $0x807004
+  802bc3:	e8 dc df ff ff       	call   800ba4 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802bc8:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802bce:	b8 02 00 00 00       	mov    $0x2,%eax
+  802bd3:	e8 32 ff ff ff       	call   802b0a <nsipc>
+}
+  802bd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bdb:	c9                   	leave
+  802bdc:	c3                   	ret
+
+00802bdd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802bdd:	55                   	push   %ebp
+  802bde:	89 e5                	mov    %esp,%ebp
+  802be0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802beb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bee:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802bf3:	b8 03 00 00 00       	mov    $0x3,%eax
+  802bf8:	e8 0d ff ff ff       	call   802b0a <nsipc>
+}
+  802bfd:	c9                   	leave
+  802bfe:	c3                   	ret
+
+00802bff <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802bff:	55                   	push   %ebp
+  802c00:	89 e5                	mov    %esp,%ebp
+  802c02:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c08:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802c0d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c12:	e8 f3 fe ff ff       	call   802b0a <nsipc>
+}
+  802c17:	c9                   	leave
+  802c18:	c3                   	ret
+
+00802c19 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c19:	55                   	push   %ebp
+  802c1a:	89 e5                	mov    %esp,%ebp
+  802c1c:	53                   	push   %ebx
+  802c1d:	83 ec 08             	sub    $0x8,%esp
+  802c20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c26:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802c2b:	53                   	push   %ebx
+  802c2c:	ff 75 0c             	push   0xc(%ebp)
+  802c2f:	68 04 70 80 00       	push   $0x807004
+  802c34:	e8 6b df ff ff       	call   800ba4 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802c39:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802c3f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802c44:	e8 c1 fe ff ff       	call   802b0a <nsipc>
+}
+  802c49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c4c:	c9                   	leave
+  802c4d:	c3                   	ret
+
+00802c4e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802c4e:	55                   	push   %ebp
+  802c4f:	89 e5                	mov    %esp,%ebp
+  802c51:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802c54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c57:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802c5c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802c64:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c69:	e8 9c fe ff ff       	call   802b0a <nsipc>
+}
+  802c6e:	c9                   	leave
+  802c6f:	c3                   	ret
+
+00802c70 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802c70:	55                   	push   %ebp
+  802c71:	89 e5                	mov    %esp,%ebp
+  802c73:	56                   	push   %esi
+  802c74:	53                   	push   %ebx
+  802c75:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802c78:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802c80:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802c86:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c89:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c8e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c93:	e8 72 fe ff ff       	call   802b0a <nsipc>
+  802c98:	89 c3                	mov    %eax,%ebx
+  802c9a:	85 c0                	test   %eax,%eax
+  802c9c:	78 22                	js     802cc0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c9e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ca3:	39 c6                	cmp    %eax,%esi
+  802ca5:	0f 4e c6             	cmovle %esi,%eax
+  802ca8:	39 c3                	cmp    %eax,%ebx
+  802caa:	7f 1d                	jg     802cc9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802cac:	83 ec 04             	sub    $0x4,%esp
+  802caf:	53                   	push   %ebx
+  802cb0:	68 00 70 80 00       	push   $0x807000
+  802cb5:	ff 75 0c             	push   0xc(%ebp)
+  802cb8:	e8 e7 de ff ff       	call   800ba4 <memmove>
+  802cbd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802cc0:	89 d8                	mov    %ebx,%eax
+  802cc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cc5:	5b                   	pop    %ebx
+  802cc6:	5e                   	pop    %esi
+  802cc7:	5d                   	pop    %ebp
+  802cc8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802cc9:	68 0a 3b 80 00       	push   $0x803b0a
+  802cce:	68 d0 39 80 00       	push   $0x8039d0
+  802cd3:	6a 62                	push   $0x62
+  802cd5:	68 1f 3b 80 00       	push   $0x803b1f
+  802cda:	e8 1c d6 ff ff       	call   8002fb <_panic>
+
+00802cdf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802cdf:	55                   	push   %ebp
+  802ce0:	89 e5                	mov    %esp,%ebp
+  802ce2:	53                   	push   %ebx
+  802ce3:	83 ec 04             	sub    $0x4,%esp
+  802ce6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cec:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802cf1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802cf7:	7f 2e                	jg     802d27 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802cf9:	83 ec 04             	sub    $0x4,%esp
+  802cfc:	53                   	push   %ebx
+  802cfd:	ff 75 0c             	push   0xc(%ebp)
+  802d00:	68 0c 70 80 00       	push   $0x80700c
+  802d05:	e8 9a de ff ff       	call   800ba4 <memmove>
+	nsipcbuf.send.req_size = size;
+  802d0a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802d10:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d13:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802d18:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d1d:	e8 e8 fd ff ff       	call   802b0a <nsipc>
+}
+  802d22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d25:	c9                   	leave
+  802d26:	c3                   	ret
+	assert(size < 1600);
+  802d27:	68 2b 3b 80 00       	push   $0x803b2b
+  802d2c:	68 d0 39 80 00       	push   $0x8039d0
+  802d31:	6a 6d                	push   $0x6d
+  802d33:	68 1f 3b 80 00       	push   $0x803b1f
+  802d38:	e8 be d5 ff ff       	call   8002fb <_panic>
+
+00802d3d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d3d:	55                   	push   %ebp
+  802d3e:	89 e5                	mov    %esp,%ebp
+  802d40:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d46:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802d4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d4e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802d53:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d56:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802d5b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d60:	e8 a5 fd ff ff       	call   802b0a <nsipc>
+}
+  802d65:	c9                   	leave
+  802d66:	c3                   	ret
+
+00802d67 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d67:	55                   	push   %ebp
+  802d68:	89 e5                	mov    %esp,%ebp
+  802d6a:	56                   	push   %esi
+  802d6b:	53                   	push   %ebx
+  802d6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802d6f:	83 ec 0c             	sub    $0xc,%esp
+  802d72:	ff 75 08             	push   0x8(%ebp)
+  802d75:	e8 2a f3 ff ff       	call   8020a4 <fd2data>
+  802d7a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802d7c:	83 c4 08             	add    $0x8,%esp
+  802d7f:	68 37 3b 80 00       	push   $0x803b37
+  802d84:	53                   	push   %ebx
+  802d85:	e8 94 dc ff ff       	call   800a1e <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802d8a:	8b 46 04             	mov    0x4(%esi),%eax
+  802d8d:	2b 06                	sub    (%esi),%eax
+  802d8f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802d95:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802d9c:	00 00 00 
+	stat->st_dev = &devpipe;
+  802d9f:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802da6:	40 80 00 
+	return 0;
+}
+  802da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802db1:	5b                   	pop    %ebx
+  802db2:	5e                   	pop    %esi
+  802db3:	5d                   	pop    %ebp
+  802db4:	c3                   	ret
+
+00802db5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802db5:	55                   	push   %ebp
+  802db6:	89 e5                	mov    %esp,%ebp
+  802db8:	53                   	push   %ebx
+  802db9:	83 ec 0c             	sub    $0xc,%esp
+  802dbc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802dbf:	53                   	push   %ebx
+  802dc0:	6a 00                	push   $0x0
+  802dc2:	e8 2a e2 ff ff       	call   800ff1 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802dc7:	89 1c 24             	mov    %ebx,(%esp)
+  802dca:	e8 d5 f2 ff ff       	call   8020a4 <fd2data>
+  802dcf:	83 c4 08             	add    $0x8,%esp
+  802dd2:	50                   	push   %eax
+  802dd3:	6a 00                	push   $0x0
+  802dd5:	e8 17 e2 ff ff       	call   800ff1 <sys_page_unmap>
+}
+  802dda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ddd:	c9                   	leave
+  802dde:	c3                   	ret
+
+00802ddf <_pipeisclosed>:
+{
+  802ddf:	55                   	push   %ebp
+  802de0:	89 e5                	mov    %esp,%ebp
+  802de2:	57                   	push   %edi
+  802de3:	56                   	push   %esi
+  802de4:	53                   	push   %ebx
+  802de5:	83 ec 1c             	sub    $0x1c,%esp
+  802de8:	89 c7                	mov    %eax,%edi
+  802dea:	89 d6                	mov    %edx,%esi
+  802dec:	eb 3c                	jmp    802e2a <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802dee:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802df1:	83 ec 0c             	sub    $0xc,%esp
+  802df4:	57                   	push   %edi
+  802df5:	e8 a2 06 00 00       	call   80349c <pageref>
+  802dfa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802dfd:	89 34 24             	mov    %esi,(%esp)
+  802e00:	e8 97 06 00 00       	call   80349c <pageref>
+  802e05:	89 c2                	mov    %eax,%edx
+  802e07:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e09:	05 00 00 00 20       	add    $0x20000000,%eax
+  802e0e:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802e11:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e17:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e1c:	76 31                	jbe    802e4f <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802e1e:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802e21:	39 c3                	cmp    %eax,%ebx
+  802e23:	74 76                	je     802e9b <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802e25:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802e28:	74 36                	je     802e60 <_pipeisclosed+0x81>
+  802e2a:	89 e0                	mov    %esp,%eax
+  802e2c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e31:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e37:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e3c:	77 b0                	ja     802dee <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e3e:	c1 e8 10             	shr    $0x10,%eax
+  802e41:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e47:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e4d:	eb 9f                	jmp    802dee <_pipeisclosed+0xf>
+  802e4f:	c1 e8 10             	shr    $0x10,%eax
+  802e52:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e58:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802e5e:	eb be                	jmp    802e1e <_pipeisclosed+0x3f>
+  802e60:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e62:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e67:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e6d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e72:	76 16                	jbe    802e8a <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e74:	8b 42 58             	mov    0x58(%edx),%eax
+  802e77:	6a 01                	push   $0x1
+  802e79:	50                   	push   %eax
+  802e7a:	53                   	push   %ebx
+  802e7b:	68 3e 3b 80 00       	push   $0x803b3e
+  802e80:	e8 51 d5 ff ff       	call   8003d6 <cprintf>
+  802e85:	83 c4 10             	add    $0x10,%esp
+  802e88:	eb a0                	jmp    802e2a <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e8a:	c1 e8 10             	shr    $0x10,%eax
+  802e8d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e93:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e99:	eb d9                	jmp    802e74 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802e9b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802e9e:	0f 94 c0             	sete   %al
+  802ea1:	0f b6 c0             	movzbl %al,%eax
+}
+  802ea4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea7:	5b                   	pop    %ebx
+  802ea8:	5e                   	pop    %esi
+  802ea9:	5f                   	pop    %edi
+  802eaa:	5d                   	pop    %ebp
+  802eab:	c3                   	ret
+
+00802eac <devpipe_write>:
+{
+  802eac:	55                   	push   %ebp
+  802ead:	89 e5                	mov    %esp,%ebp
+  802eaf:	57                   	push   %edi
+  802eb0:	56                   	push   %esi
+  802eb1:	53                   	push   %ebx
+  802eb2:	83 ec 28             	sub    $0x28,%esp
+  802eb5:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802eb8:	56                   	push   %esi
+  802eb9:	e8 e6 f1 ff ff       	call   8020a4 <fd2data>
+  802ebe:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ec0:	83 c4 10             	add    $0x10,%esp
+  802ec3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ecb:	75 09                	jne    802ed6 <devpipe_write+0x2a>
+	return i;
+  802ecd:	89 f8                	mov    %edi,%eax
+  802ecf:	eb 23                	jmp    802ef4 <devpipe_write+0x48>
+			sys_yield();
+  802ed1:	e8 fa df ff ff       	call   800ed0 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802ed6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ed9:	8b 0b                	mov    (%ebx),%ecx
+  802edb:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ede:	39 d0                	cmp    %edx,%eax
+  802ee0:	72 1a                	jb     802efc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802ee2:	89 da                	mov    %ebx,%edx
+  802ee4:	89 f0                	mov    %esi,%eax
+  802ee6:	e8 f4 fe ff ff       	call   802ddf <_pipeisclosed>
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	74 e2                	je     802ed1 <devpipe_write+0x25>
+				return 0;
+  802eef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef7:	5b                   	pop    %ebx
+  802ef8:	5e                   	pop    %esi
+  802ef9:	5f                   	pop    %edi
+  802efa:	5d                   	pop    %ebp
+  802efb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802efc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802eff:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802f03:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802f06:	89 c2                	mov    %eax,%edx
+  802f08:	c1 fa 1f             	sar    $0x1f,%edx
+  802f0b:	89 d1                	mov    %edx,%ecx
+  802f0d:	c1 e9 1b             	shr    $0x1b,%ecx
+  802f10:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802f13:	83 e2 1f             	and    $0x1f,%edx
+  802f16:	29 ca                	sub    %ecx,%edx
+  802f18:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802f1c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802f20:	83 c0 01             	add    $0x1,%eax
+  802f23:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802f26:	83 c7 01             	add    $0x1,%edi
+  802f29:	eb 9d                	jmp    802ec8 <devpipe_write+0x1c>
+
+00802f2b <devpipe_read>:
+{
+  802f2b:	55                   	push   %ebp
+  802f2c:	89 e5                	mov    %esp,%ebp
+  802f2e:	57                   	push   %edi
+  802f2f:	56                   	push   %esi
+  802f30:	53                   	push   %ebx
+  802f31:	83 ec 18             	sub    $0x18,%esp
+  802f34:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802f37:	57                   	push   %edi
+  802f38:	e8 67 f1 ff ff       	call   8020a4 <fd2data>
+  802f3d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802f3f:	83 c4 10             	add    $0x10,%esp
+  802f42:	be 00 00 00 00       	mov    $0x0,%esi
+  802f47:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f4a:	75 13                	jne    802f5f <devpipe_read+0x34>
+	return i;
+  802f4c:	89 f0                	mov    %esi,%eax
+  802f4e:	eb 02                	jmp    802f52 <devpipe_read+0x27>
+				return i;
+  802f50:	89 f0                	mov    %esi,%eax
+}
+  802f52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f55:	5b                   	pop    %ebx
+  802f56:	5e                   	pop    %esi
+  802f57:	5f                   	pop    %edi
+  802f58:	5d                   	pop    %ebp
+  802f59:	c3                   	ret
+			sys_yield();
+  802f5a:	e8 71 df ff ff       	call   800ed0 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802f5f:	8b 03                	mov    (%ebx),%eax
+  802f61:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f64:	75 18                	jne    802f7e <devpipe_read+0x53>
+			if (i > 0)
+  802f66:	85 f6                	test   %esi,%esi
+  802f68:	75 e6                	jne    802f50 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802f6a:	89 da                	mov    %ebx,%edx
+  802f6c:	89 f8                	mov    %edi,%eax
+  802f6e:	e8 6c fe ff ff       	call   802ddf <_pipeisclosed>
+  802f73:	85 c0                	test   %eax,%eax
+  802f75:	74 e3                	je     802f5a <devpipe_read+0x2f>
+				return 0;
+  802f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7c:	eb d4                	jmp    802f52 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f7e:	99                   	cltd
+  802f7f:	c1 ea 1b             	shr    $0x1b,%edx
+  802f82:	01 d0                	add    %edx,%eax
+  802f84:	83 e0 1f             	and    $0x1f,%eax
+  802f87:	29 d0                	sub    %edx,%eax
+  802f89:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f91:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802f94:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802f97:	83 c6 01             	add    $0x1,%esi
+  802f9a:	eb ab                	jmp    802f47 <devpipe_read+0x1c>
+
+00802f9c <pipe>:
+{
+  802f9c:	55                   	push   %ebp
+  802f9d:	89 e5                	mov    %esp,%ebp
+  802f9f:	56                   	push   %esi
+  802fa0:	53                   	push   %ebx
+  802fa1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802fa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fa7:	50                   	push   %eax
+  802fa8:	e8 0e f1 ff ff       	call   8020bb <fd_alloc>
+  802fad:	89 c3                	mov    %eax,%ebx
+  802faf:	83 c4 10             	add    $0x10,%esp
+  802fb2:	85 c0                	test   %eax,%eax
+  802fb4:	0f 88 23 01 00 00    	js     8030dd <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fba:	83 ec 04             	sub    $0x4,%esp
+  802fbd:	68 07 04 00 00       	push   $0x407
+  802fc2:	ff 75 f4             	push   -0xc(%ebp)
+  802fc5:	6a 00                	push   $0x0
+  802fc7:	e8 4a df ff ff       	call   800f16 <sys_page_alloc>
+  802fcc:	89 c3                	mov    %eax,%ebx
+  802fce:	83 c4 10             	add    $0x10,%esp
+  802fd1:	85 c0                	test   %eax,%eax
+  802fd3:	0f 88 04 01 00 00    	js     8030dd <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802fd9:	83 ec 0c             	sub    $0xc,%esp
+  802fdc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802fdf:	50                   	push   %eax
+  802fe0:	e8 d6 f0 ff ff       	call   8020bb <fd_alloc>
+  802fe5:	89 c3                	mov    %eax,%ebx
+  802fe7:	83 c4 10             	add    $0x10,%esp
+  802fea:	85 c0                	test   %eax,%eax
+  802fec:	0f 88 db 00 00 00    	js     8030cd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ff2:	83 ec 04             	sub    $0x4,%esp
+  802ff5:	68 07 04 00 00       	push   $0x407
+  802ffa:	ff 75 f0             	push   -0x10(%ebp)
+  802ffd:	6a 00                	push   $0x0
+  802fff:	e8 12 df ff ff       	call   800f16 <sys_page_alloc>
+  803004:	89 c3                	mov    %eax,%ebx
+  803006:	83 c4 10             	add    $0x10,%esp
+  803009:	85 c0                	test   %eax,%eax
+  80300b:	0f 88 bc 00 00 00    	js     8030cd <pipe+0x131>
+	va = fd2data(fd0);
+  803011:	83 ec 0c             	sub    $0xc,%esp
+  803014:	ff 75 f4             	push   -0xc(%ebp)
+  803017:	e8 88 f0 ff ff       	call   8020a4 <fd2data>
+  80301c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80301e:	83 c4 0c             	add    $0xc,%esp
+  803021:	68 07 04 00 00       	push   $0x407
+  803026:	50                   	push   %eax
+  803027:	6a 00                	push   $0x0
+  803029:	e8 e8 de ff ff       	call   800f16 <sys_page_alloc>
+  80302e:	89 c3                	mov    %eax,%ebx
+  803030:	83 c4 10             	add    $0x10,%esp
+  803033:	85 c0                	test   %eax,%eax
+  803035:	0f 88 82 00 00 00    	js     8030bd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80303b:	83 ec 0c             	sub    $0xc,%esp
+  80303e:	ff 75 f0             	push   -0x10(%ebp)
+  803041:	e8 5e f0 ff ff       	call   8020a4 <fd2data>
+  803046:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80304d:	50                   	push   %eax
+  80304e:	6a 00                	push   $0x0
+  803050:	56                   	push   %esi
+  803051:	6a 00                	push   $0x0
+  803053:	e8 2b df ff ff       	call   800f83 <sys_page_map>
+  803058:	89 c3                	mov    %eax,%ebx
+  80305a:	83 c4 20             	add    $0x20,%esp
+  80305d:	85 c0                	test   %eax,%eax
+  80305f:	78 4e                	js     8030af <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803061:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  803066:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803069:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80306b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80306e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803075:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803078:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80307a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80307d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803084:	83 ec 0c             	sub    $0xc,%esp
+  803087:	ff 75 f4             	push   -0xc(%ebp)
+  80308a:	e8 05 f0 ff ff       	call   802094 <fd2num>
+  80308f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803092:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803094:	83 c4 04             	add    $0x4,%esp
+  803097:	ff 75 f0             	push   -0x10(%ebp)
+  80309a:	e8 f5 ef ff ff       	call   802094 <fd2num>
+  80309f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030a2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8030a5:	83 c4 10             	add    $0x10,%esp
+  8030a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ad:	eb 2e                	jmp    8030dd <pipe+0x141>
+	sys_page_unmap(0, va);
+  8030af:	83 ec 08             	sub    $0x8,%esp
+  8030b2:	56                   	push   %esi
+  8030b3:	6a 00                	push   $0x0
+  8030b5:	e8 37 df ff ff       	call   800ff1 <sys_page_unmap>
+  8030ba:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8030bd:	83 ec 08             	sub    $0x8,%esp
+  8030c0:	ff 75 f0             	push   -0x10(%ebp)
+  8030c3:	6a 00                	push   $0x0
+  8030c5:	e8 27 df ff ff       	call   800ff1 <sys_page_unmap>
+  8030ca:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8030cd:	83 ec 08             	sub    $0x8,%esp
+  8030d0:	ff 75 f4             	push   -0xc(%ebp)
+  8030d3:	6a 00                	push   $0x0
+  8030d5:	e8 17 df ff ff       	call   800ff1 <sys_page_unmap>
+  8030da:	83 c4 10             	add    $0x10,%esp
+}
+  8030dd:	89 d8                	mov    %ebx,%eax
+  8030df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030e2:	5b                   	pop    %ebx
+  8030e3:	5e                   	pop    %esi
+  8030e4:	5d                   	pop    %ebp
+  8030e5:	c3                   	ret
+
+008030e6 <pipeisclosed>:
+{
+  8030e6:	55                   	push   %ebp
+  8030e7:	89 e5                	mov    %esp,%ebp
+  8030e9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030ef:	50                   	push   %eax
+  8030f0:	ff 75 08             	push   0x8(%ebp)
+  8030f3:	e8 19 f0 ff ff       	call   802111 <fd_lookup>
+  8030f8:	83 c4 10             	add    $0x10,%esp
+  8030fb:	85 c0                	test   %eax,%eax
+  8030fd:	78 18                	js     803117 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8030ff:	83 ec 0c             	sub    $0xc,%esp
+  803102:	ff 75 f4             	push   -0xc(%ebp)
+  803105:	e8 9a ef ff ff       	call   8020a4 <fd2data>
+  80310a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80310c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80310f:	e8 cb fc ff ff       	call   802ddf <_pipeisclosed>
+  803114:	83 c4 10             	add    $0x10,%esp
+}
+  803117:	c9                   	leave
+  803118:	c3                   	ret
+
+00803119 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311e:	c3                   	ret
+
+0080311f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80311f:	55                   	push   %ebp
+  803120:	89 e5                	mov    %esp,%ebp
+  803122:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803125:	68 51 3b 80 00       	push   $0x803b51
+  80312a:	ff 75 0c             	push   0xc(%ebp)
+  80312d:	e8 ec d8 ff ff       	call   800a1e <strcpy>
+	return 0;
+}
+  803132:	b8 00 00 00 00       	mov    $0x0,%eax
+  803137:	c9                   	leave
+  803138:	c3                   	ret
+
+00803139 <devcons_write>:
+{
+  803139:	55                   	push   %ebp
+  80313a:	89 e5                	mov    %esp,%ebp
+  80313c:	57                   	push   %edi
+  80313d:	56                   	push   %esi
+  80313e:	53                   	push   %ebx
+  80313f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803145:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80314a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803150:	eb 2e                	jmp    803180 <devcons_write+0x47>
+		m = n - tot;
+  803152:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803155:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803157:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80315c:	39 c3                	cmp    %eax,%ebx
+  80315e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803161:	83 ec 04             	sub    $0x4,%esp
+  803164:	53                   	push   %ebx
+  803165:	89 f0                	mov    %esi,%eax
+  803167:	03 45 0c             	add    0xc(%ebp),%eax
+  80316a:	50                   	push   %eax
+  80316b:	57                   	push   %edi
+  80316c:	e8 33 da ff ff       	call   800ba4 <memmove>
+		sys_cputs(buf, m);
+  803171:	83 c4 08             	add    $0x8,%esp
+  803174:	53                   	push   %ebx
+  803175:	57                   	push   %edi
+  803176:	e8 1c dc ff ff       	call   800d97 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80317b:	01 de                	add    %ebx,%esi
+  80317d:	83 c4 10             	add    $0x10,%esp
+  803180:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803183:	72 cd                	jb     803152 <devcons_write+0x19>
+}
+  803185:	89 f0                	mov    %esi,%eax
+  803187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80318a:	5b                   	pop    %ebx
+  80318b:	5e                   	pop    %esi
+  80318c:	5f                   	pop    %edi
+  80318d:	5d                   	pop    %ebp
+  80318e:	c3                   	ret
+
+0080318f <devcons_read>:
+{
+  80318f:	55                   	push   %ebp
+  803190:	89 e5                	mov    %esp,%ebp
+  803192:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80319e:	75 07                	jne    8031a7 <devcons_read+0x18>
+  8031a0:	eb 1f                	jmp    8031c1 <devcons_read+0x32>
+		sys_yield();
+  8031a2:	e8 29 dd ff ff       	call   800ed0 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8031a7:	e8 2f dc ff ff       	call   800ddb <sys_cgetc>
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	74 f2                	je     8031a2 <devcons_read+0x13>
+	if (c < 0)
+  8031b0:	78 0f                	js     8031c1 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8031b2:	83 f8 04             	cmp    $0x4,%eax
+  8031b5:	74 0c                	je     8031c3 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8031b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8031ba:	88 02                	mov    %al,(%edx)
+	return 1;
+  8031bc:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8031c1:	c9                   	leave
+  8031c2:	c3                   	ret
+		return 0;
+  8031c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c8:	eb f7                	jmp    8031c1 <devcons_read+0x32>
+
+008031ca <cputchar>:
+{
+  8031ca:	55                   	push   %ebp
+  8031cb:	89 e5                	mov    %esp,%ebp
+  8031cd:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8031d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031d3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8031d6:	6a 01                	push   $0x1
+  8031d8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031db:	50                   	push   %eax
+  8031dc:	e8 b6 db ff ff       	call   800d97 <sys_cputs>
+}
+  8031e1:	83 c4 10             	add    $0x10,%esp
+  8031e4:	c9                   	leave
+  8031e5:	c3                   	ret
+
+008031e6 <getchar>:
+{
+  8031e6:	55                   	push   %ebp
+  8031e7:	89 e5                	mov    %esp,%ebp
+  8031e9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8031ec:	6a 01                	push   $0x1
+  8031ee:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031f1:	50                   	push   %eax
+  8031f2:	6a 00                	push   $0x0
+  8031f4:	e8 9e f1 ff ff       	call   802397 <read>
+	if (r < 0)
+  8031f9:	83 c4 10             	add    $0x10,%esp
+  8031fc:	85 c0                	test   %eax,%eax
+  8031fe:	78 06                	js     803206 <getchar+0x20>
+	if (r < 1)
+  803200:	74 06                	je     803208 <getchar+0x22>
+	return c;
+  803202:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803206:	c9                   	leave
+  803207:	c3                   	ret
+		return -E_EOF;
+  803208:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80320d:	eb f7                	jmp    803206 <getchar+0x20>
+
+0080320f <iscons>:
+{
+  80320f:	55                   	push   %ebp
+  803210:	89 e5                	mov    %esp,%ebp
+  803212:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803215:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803218:	50                   	push   %eax
+  803219:	ff 75 08             	push   0x8(%ebp)
+  80321c:	e8 f0 ee ff ff       	call   802111 <fd_lookup>
+  803221:	83 c4 10             	add    $0x10,%esp
+  803224:	85 c0                	test   %eax,%eax
+  803226:	78 11                	js     803239 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803228:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80322b:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803231:	39 10                	cmp    %edx,(%eax)
+  803233:	0f 94 c0             	sete   %al
+  803236:	0f b6 c0             	movzbl %al,%eax
+}
+  803239:	c9                   	leave
+  80323a:	c3                   	ret
+
+0080323b <opencons>:
+{
+  80323b:	55                   	push   %ebp
+  80323c:	89 e5                	mov    %esp,%ebp
+  80323e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803241:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803244:	50                   	push   %eax
+  803245:	e8 71 ee ff ff       	call   8020bb <fd_alloc>
+  80324a:	83 c4 10             	add    $0x10,%esp
+  80324d:	85 c0                	test   %eax,%eax
+  80324f:	78 3a                	js     80328b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803251:	83 ec 04             	sub    $0x4,%esp
+  803254:	68 07 04 00 00       	push   $0x407
+  803259:	ff 75 f4             	push   -0xc(%ebp)
+  80325c:	6a 00                	push   $0x0
+  80325e:	e8 b3 dc ff ff       	call   800f16 <sys_page_alloc>
+  803263:	83 c4 10             	add    $0x10,%esp
+  803266:	85 c0                	test   %eax,%eax
+  803268:	78 21                	js     80328b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80326a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80326d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803273:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803275:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803278:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80327f:	83 ec 0c             	sub    $0xc,%esp
+  803282:	50                   	push   %eax
+  803283:	e8 0c ee ff ff       	call   802094 <fd2num>
+  803288:	83 c4 10             	add    $0x10,%esp
+}
+  80328b:	c9                   	leave
+  80328c:	c3                   	ret
+
+0080328d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80328d:	55                   	push   %ebp
+  80328e:	89 e5                	mov    %esp,%ebp
+  803290:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803293:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80329a:	74 0a                	je     8032a6 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80329c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329f:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8032a6:	83 ec 04             	sub    $0x4,%esp
+  8032a9:	6a 07                	push   $0x7
+  8032ab:	68 00 f0 bf ee       	push   $0xeebff000
+  8032b0:	6a 00                	push   $0x0
+  8032b2:	e8 5f dc ff ff       	call   800f16 <sys_page_alloc>
+  8032b7:	83 c4 10             	add    $0x10,%esp
+  8032ba:	85 c0                	test   %eax,%eax
+  8032bc:	78 14                	js     8032d2 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8032be:	83 ec 08             	sub    $0x8,%esp
+  8032c1:	68 f4 32 80 00       	push   $0x8032f4
+  8032c6:	6a 00                	push   $0x0
+  8032c8:	e8 65 de ff ff       	call   801132 <sys_env_set_pgfault_upcall>
+  8032cd:	83 c4 10             	add    $0x10,%esp
+  8032d0:	eb ca                	jmp    80329c <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8032d2:	83 ec 08             	sub    $0x8,%esp
+  8032d5:	50                   	push   %eax
+  8032d6:	68 5d 3b 80 00       	push   $0x803b5d
+  8032db:	e8 f6 d0 ff ff       	call   8003d6 <cprintf>
+			panic("set_pgfault_handler error");
+  8032e0:	83 c4 0c             	add    $0xc,%esp
+  8032e3:	68 68 3b 80 00       	push   $0x803b68
+  8032e8:	6a 24                	push   $0x24
+  8032ea:	68 82 3b 80 00       	push   $0x803b82
+  8032ef:	e8 07 d0 ff ff       	call   8002fb <_panic>
+
+008032f4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8032f4:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8032f5:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8032fa:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8032fc:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8032ff:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  803303:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803306:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  80330a:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  80330c:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803310:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803311:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803315:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803316:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803317:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80331b:	c3                   	ret
+
+0080331c <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  80331c:	55                   	push   %ebp
+  80331d:	89 e5                	mov    %esp,%ebp
+  80331f:	56                   	push   %esi
+  803320:	53                   	push   %ebx
+  803321:	8b 75 08             	mov    0x8(%ebp),%esi
+  803324:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803327:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80332a:	85 c0                	test   %eax,%eax
+  80332c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803331:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  803334:	83 ec 08             	sub    $0x8,%esp
+  803337:	ff 75 14             	push   0x14(%ebp)
+  80333a:	50                   	push   %eax
+  80333b:	e8 e7 df ff ff       	call   801327 <sys_ipc_recv_until>
+  803340:	83 c4 10             	add    $0x10,%esp
+  803343:	85 c0                	test   %eax,%eax
+  803345:	78 61                	js     8033a8 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  803347:	85 f6                	test   %esi,%esi
+  803349:	74 1c                	je     803367 <ipc_recv_until+0x4b>
+  80334b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80334d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803352:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803358:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80335d:	76 5f                	jbe    8033be <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  80335f:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803365:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803367:	85 db                	test   %ebx,%ebx
+  803369:	74 1c                	je     803387 <ipc_recv_until+0x6b>
+  80336b:	89 e0                	mov    %esp,%eax
+  80336d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803372:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803378:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80337d:	76 50                	jbe    8033cf <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80337f:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803385:	89 03                	mov    %eax,(%ebx)
+  803387:	89 e0                	mov    %esp,%eax
+  803389:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80338e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803394:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803399:	76 45                	jbe    8033e0 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  80339b:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  8033a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033a4:	5b                   	pop    %ebx
+  8033a5:	5e                   	pop    %esi
+  8033a6:	5d                   	pop    %ebp
+  8033a7:	c3                   	ret
+		if (from_env_store)
+  8033a8:	85 f6                	test   %esi,%esi
+  8033aa:	74 06                	je     8033b2 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  8033ac:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8033b2:	85 db                	test   %ebx,%ebx
+  8033b4:	74 eb                	je     8033a1 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  8033b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8033bc:	eb e3                	jmp    8033a1 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8033be:	c1 e8 10             	shr    $0x10,%eax
+  8033c1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033c7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033cd:	eb 90                	jmp    80335f <ipc_recv_until+0x43>
+  8033cf:	c1 e8 10             	shr    $0x10,%eax
+  8033d2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033d8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033de:	eb 9f                	jmp    80337f <ipc_recv_until+0x63>
+  8033e0:	c1 e8 10             	shr    $0x10,%eax
+  8033e3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033e9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033ef:	eb aa                	jmp    80339b <ipc_recv_until+0x7f>
+
+008033f1 <ipc_recv>:
+{
+  8033f1:	55                   	push   %ebp
+  8033f2:	89 e5                	mov    %esp,%ebp
+  8033f4:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8033f7:	6a 00                	push   $0x0
+  8033f9:	ff 75 10             	push   0x10(%ebp)
+  8033fc:	ff 75 0c             	push   0xc(%ebp)
+  8033ff:	ff 75 08             	push   0x8(%ebp)
+  803402:	e8 15 ff ff ff       	call   80331c <ipc_recv_until>
+}
+  803407:	c9                   	leave
+  803408:	c3                   	ret
+
+00803409 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803409:	55                   	push   %ebp
+  80340a:	89 e5                	mov    %esp,%ebp
+  80340c:	57                   	push   %edi
+  80340d:	56                   	push   %esi
+  80340e:	53                   	push   %ebx
+  80340f:	83 ec 0c             	sub    $0xc,%esp
+  803412:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803415:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803418:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80341b:	85 db                	test   %ebx,%ebx
+  80341d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803422:	0f 44 d8             	cmove  %eax,%ebx
+  803425:	eb 05                	jmp    80342c <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803427:	e8 a4 da ff ff       	call   800ed0 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  80342c:	ff 75 14             	push   0x14(%ebp)
+  80342f:	53                   	push   %ebx
+  803430:	56                   	push   %esi
+  803431:	57                   	push   %edi
+  803432:	e8 3c de ff ff       	call   801273 <sys_ipc_try_send>
+  803437:	83 c4 10             	add    $0x10,%esp
+  80343a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80343d:	74 e8                	je     803427 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  80343f:	85 c0                	test   %eax,%eax
+  803441:	78 08                	js     80344b <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  803443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803446:	5b                   	pop    %ebx
+  803447:	5e                   	pop    %esi
+  803448:	5f                   	pop    %edi
+  803449:	5d                   	pop    %ebp
+  80344a:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  80344b:	50                   	push   %eax
+  80344c:	68 90 3b 80 00       	push   $0x803b90
+  803451:	6a 4f                	push   $0x4f
+  803453:	68 a3 3b 80 00       	push   $0x803ba3
+  803458:	e8 9e ce ff ff       	call   8002fb <_panic>
+
+0080345d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80345d:	55                   	push   %ebp
+  80345e:	89 e5                	mov    %esp,%ebp
+  803460:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803463:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803468:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80346e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803474:	8b 52 50             	mov    0x50(%edx),%edx
+  803477:	39 ca                	cmp    %ecx,%edx
+  803479:	74 11                	je     80348c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80347b:	83 c0 01             	add    $0x1,%eax
+  80347e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803483:	75 e3                	jne    803468 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348a:	eb 0e                	jmp    80349a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80348c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803492:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803497:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80349a:	5d                   	pop    %ebp
+  80349b:	c3                   	ret
+
+0080349c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80349c:	55                   	push   %ebp
+  80349d:	89 e5                	mov    %esp,%ebp
+  80349f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034a2:	89 c2                	mov    %eax,%edx
+  8034a4:	c1 ea 16             	shr    $0x16,%edx
+  8034a7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8034ae:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034b3:	f6 c1 01             	test   $0x1,%cl
+  8034b6:	74 1a                	je     8034d2 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  8034b8:	c1 e8 0c             	shr    $0xc,%eax
+  8034bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8034c2:	a8 01                	test   $0x1,%al
+  8034c4:	74 0c                	je     8034d2 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8034c6:	c1 e8 0c             	shr    $0xc,%eax
+  8034c9:	c1 e0 04             	shl    $0x4,%eax
+  8034cc:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8034d2:	89 d0                	mov    %edx,%eax
+  8034d4:	5d                   	pop    %ebp
+  8034d5:	c3                   	ret
@@ -0,0 +1,7253 @@
+
+obj/user/scalebench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d1 01 00 00       	call   800202 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	ipc_send(thisenv->env_parent_id, ncalls, NULL, 0);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 3c             	sub    $0x3c,%esp
+	envid_t workers[NWORKERS], from;
+	unsigned total = 0, n;
+	int i;
+
+	for (i = 0; i < NWORKERS; i++) {
+  80003c:	8d 75 c8             	lea    -0x38(%ebp),%esi
+  80003f:	8d 7d e8             	lea    -0x18(%ebp),%edi
+  800042:	89 f3                	mov    %esi,%ebx
+  800044:	39 fb                	cmp    %edi,%ebx
+  800046:	0f 84 4c 01 00 00    	je     800198 <umain+0x165>
+		if ((workers[i] = fork()) < 0)
+  80004c:	e8 7b 1d 00 00       	call   801dcc <fork>
+  800051:	89 03                	mov    %eax,(%ebx)
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 2a                	js     800081 <umain+0x4e>
+			panic("fork: %e", workers[i]);
+		if (workers[i] == 0) {
+  800057:	83 c3 04             	add    $0x4,%ebx
+  80005a:	85 c0                	test   %eax,%eax
+  80005c:	75 e6                	jne    800044 <umain+0x11>
+	ipc_recv(NULL, NULL, NULL);
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	6a 00                	push   $0x0
+  800065:	6a 00                	push   $0x0
+  800067:	e8 a6 1e 00 00       	call   801f12 <ipc_recv>
+	end = sys_time_msec() + DURATION;
+  80006c:	e8 cb 12 00 00       	call   80133c <sys_time_msec>
+  800071:	8d b0 d0 07 00 00    	lea    0x7d0(%eax),%esi
+	while (sys_time_msec() < end) {
+  800077:	83 c4 10             	add    $0x10,%esp
+	unsigned end, ncalls = 0;
+  80007a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	while (sys_time_msec() < end) {
+  80007f:	eb 4b                	jmp    8000cc <umain+0x99>
+			panic("fork: %e", workers[i]);
+  800081:	50                   	push   %eax
+  800082:	68 f0 39 80 00       	push   $0x8039f0
+  800087:	6a 37                	push   $0x37
+  800089:	68 c0 34 80 00       	push   $0x8034c0
+  80008e:	e8 33 02 00 00       	call   8002c6 <_panic>
+			panic("sys_page_alloc: %e", r);
+  800093:	50                   	push   %eax
+  800094:	68 d2 34 80 00       	push   $0x8034d2
+  800099:	6a 20                	push   $0x20
+  80009b:	68 c0 34 80 00       	push   $0x8034c0
+  8000a0:	e8 21 02 00 00       	call   8002c6 <_panic>
+			panic("sys_page_map: %e", r);
+  8000a5:	50                   	push   %eax
+  8000a6:	68 e5 34 80 00       	push   $0x8034e5
+  8000ab:	6a 22                	push   $0x22
+  8000ad:	68 c0 34 80 00       	push   $0x8034c0
+  8000b2:	e8 0f 02 00 00       	call   8002c6 <_panic>
+			panic("sys_page_unmap: %e", r);
+  8000b7:	50                   	push   %eax
+  8000b8:	68 f6 34 80 00       	push   $0x8034f6
+  8000bd:	6a 24                	push   $0x24
+  8000bf:	68 c0 34 80 00       	push   $0x8034c0
+  8000c4:	e8 fd 01 00 00       	call   8002c6 <_panic>
+		ncalls += 5;
+  8000c9:	83 c3 05             	add    $0x5,%ebx
+	while (sys_time_msec() < end) {
+  8000cc:	e8 6b 12 00 00       	call   80133c <sys_time_msec>
+  8000d1:	39 f0                	cmp    %esi,%eax
+  8000d3:	73 75                	jae    80014a <umain+0x117>
+		if ((r = sys_page_alloc(0, PAGE_A, perm)) < 0)
+  8000d5:	83 ec 04             	sub    $0x4,%esp
+  8000d8:	6a 07                	push   $0x7
+  8000da:	68 00 00 00 a0       	push   $0xa0000000
+  8000df:	6a 00                	push   $0x0
+  8000e1:	e8 fb 0d 00 00       	call   800ee1 <sys_page_alloc>
+  8000e6:	83 c4 10             	add    $0x10,%esp
+  8000e9:	85 c0                	test   %eax,%eax
+  8000eb:	78 a6                	js     800093 <umain+0x60>
+		if ((r = sys_page_map(0, PAGE_A, 0, PAGE_B, perm)) < 0)
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  8000f0:	6a 07                	push   $0x7
+  8000f2:	68 00 10 00 a0       	push   $0xa0001000
+  8000f7:	6a 00                	push   $0x0
+  8000f9:	68 00 00 00 a0       	push   $0xa0000000
+  8000fe:	6a 00                	push   $0x0
+  800100:	e8 49 0e 00 00       	call   800f4e <sys_page_map>
+  800105:	83 c4 20             	add    $0x20,%esp
+  800108:	85 c0                	test   %eax,%eax
+  80010a:	78 99                	js     8000a5 <umain+0x72>
+		if ((r = sys_page_unmap(0, PAGE_B)) < 0)
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	68 00 10 00 a0       	push   $0xa0001000
+  800114:	6a 00                	push   $0x0
+  800116:	e8 a1 0e 00 00       	call   800fbc <sys_page_unmap>
+  80011b:	83 c4 10             	add    $0x10,%esp
+  80011e:	85 c0                	test   %eax,%eax
+  800120:	78 95                	js     8000b7 <umain+0x84>
+		if ((r = sys_page_unmap(0, PAGE_A)) < 0)
+  800122:	83 ec 08             	sub    $0x8,%esp
+  800125:	68 00 00 00 a0       	push   $0xa0000000
+  80012a:	6a 00                	push   $0x0
+  80012c:	e8 8b 0e 00 00       	call   800fbc <sys_page_unmap>
+  800131:	83 c4 10             	add    $0x10,%esp
+  800134:	85 c0                	test   %eax,%eax
+  800136:	79 91                	jns    8000c9 <umain+0x96>
+			panic("sys_page_unmap: %e", r);
+  800138:	50                   	push   %eax
+  800139:	68 f6 34 80 00       	push   $0x8034f6
+  80013e:	6a 26                	push   $0x26
+  800140:	68 c0 34 80 00       	push   $0x8034c0
+  800145:	e8 7c 01 00 00       	call   8002c6 <_panic>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80014a:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80014c:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  800151:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800157:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80015c:	76 16                	jbe    800174 <umain+0x141>
+	ipc_send(thisenv->env_parent_id, ncalls, NULL, 0);
+  80015e:	8b 42 4c             	mov    0x4c(%edx),%eax
+  800161:	6a 00                	push   $0x0
+  800163:	6a 00                	push   $0x0
+  800165:	53                   	push   %ebx
+  800166:	50                   	push   %eax
+  800167:	e8 be 1d 00 00       	call   801f2a <ipc_send>
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	e9 86 00 00 00       	jmp    8001fa <umain+0x1c7>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800174:	c1 e8 10             	shr    $0x10,%eax
+  800177:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80017d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800183:	eb d9                	jmp    80015e <umain+0x12b>
+			return;
+		}
+	}
+
+	for (i = 0; i < NWORKERS; i++)
+		ipc_send(workers[i], 0, NULL, 0);
+  800185:	6a 00                	push   $0x0
+  800187:	6a 00                	push   $0x0
+  800189:	6a 00                	push   $0x0
+  80018b:	ff 36                	push   (%esi)
+  80018d:	e8 98 1d 00 00       	call   801f2a <ipc_send>
+	for (i = 0; i < NWORKERS; i++)
+  800192:	83 c6 04             	add    $0x4,%esi
+  800195:	83 c4 10             	add    $0x10,%esp
+  800198:	39 de                	cmp    %ebx,%esi
+  80019a:	75 e9                	jne    800185 <umain+0x152>
+  80019c:	be 09 00 00 00       	mov    $0x9,%esi
+	unsigned total = 0, n;
+  8001a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a6:	eb 28                	jmp    8001d0 <umain+0x19d>
+
+	for (i = 0; i < NWORKERS; i++) {
+		n = ipc_recv(&from, NULL, NULL);
+  8001a8:	83 ec 04             	sub    $0x4,%esp
+  8001ab:	6a 00                	push   $0x0
+  8001ad:	6a 00                	push   $0x0
+  8001af:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  8001b2:	50                   	push   %eax
+  8001b3:	e8 5a 1d 00 00       	call   801f12 <ipc_recv>
+  8001b8:	89 c3                	mov    %eax,%ebx
+		cprintf("scalebench: worker %08x made %u system calls\n",
+  8001ba:	83 c4 0c             	add    $0xc,%esp
+  8001bd:	50                   	push   %eax
+  8001be:	ff 75 c4             	push   -0x3c(%ebp)
+  8001c1:	68 0c 35 80 00       	push   $0x80350c
+  8001c6:	e8 d6 01 00 00       	call   8003a1 <cprintf>
+			from, n);
+		total += n;
+  8001cb:	01 df                	add    %ebx,%edi
+  8001cd:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NWORKERS; i++) {
+  8001d0:	83 ee 01             	sub    $0x1,%esi
+  8001d3:	75 d3                	jne    8001a8 <umain+0x175>
+	}
+
+	cprintf("scalebench: %d workers, %u system calls in %d ms, %u per ms\n",
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+  8001d8:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+  8001dd:	89 f8                	mov    %edi,%eax
+  8001df:	f7 e2                	mul    %edx
+  8001e1:	c1 ea 07             	shr    $0x7,%edx
+  8001e4:	52                   	push   %edx
+  8001e5:	68 d0 07 00 00       	push   $0x7d0
+  8001ea:	57                   	push   %edi
+  8001eb:	6a 08                	push   $0x8
+  8001ed:	68 3c 35 80 00       	push   $0x80353c
+  8001f2:	e8 aa 01 00 00       	call   8003a1 <cprintf>
+  8001f7:	83 c4 20             	add    $0x20,%esp
+		NWORKERS, total, DURATION, total / DURATION);
+}
+  8001fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001fd:	5b                   	pop    %ebx
+  8001fe:	5e                   	pop    %esi
+  8001ff:	5f                   	pop    %edi
+  800200:	5d                   	pop    %ebp
+  800201:	c3                   	ret
+
+00800202 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800202:	55                   	push   %ebp
+  800203:	89 e5                	mov    %esp,%ebp
+  800205:	57                   	push   %edi
+  800206:	56                   	push   %esi
+  800207:	53                   	push   %ebx
+  800208:	83 ec 0c             	sub    $0xc,%esp
+  80020b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80020e:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800211:	b8 01 00 00 00       	mov    $0x1,%eax
+  800216:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800218:	c1 ea 0b             	shr    $0xb,%edx
+  80021b:	83 f2 01             	xor    $0x1,%edx
+  80021e:	83 e2 01             	and    $0x1,%edx
+  800221:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800227:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80022e:	00 00 00 
+	envid = sys_getenvid();
+  800231:	e8 1f 0c 00 00       	call   800e55 <sys_getenvid>
+  800236:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800238:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80023d:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800243:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800249:	8b 52 48             	mov    0x48(%edx),%edx
+  80024c:	39 ca                	cmp    %ecx,%edx
+  80024e:	74 27                	je     800277 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800250:	83 c0 01             	add    $0x1,%eax
+  800253:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800258:	75 e3                	jne    80023d <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80025a:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800261:	75 24                	jne    800287 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800263:	83 ec 04             	sub    $0x4,%esp
+  800266:	68 7c 35 80 00       	push   $0x80357c
+  80026b:	6a 23                	push   $0x23
+  80026d:	68 9f 35 80 00       	push   $0x80359f
+  800272:	e8 4f 00 00 00       	call   8002c6 <_panic>
+			mainenv = &envs[i];
+  800277:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80027d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800282:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800287:	85 ff                	test   %edi,%edi
+  800289:	7e 07                	jle    800292 <libmain+0x90>
+		binaryname = argv[0];
+  80028b:	8b 06                	mov    (%esi),%eax
+  80028d:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800292:	83 ec 08             	sub    $0x8,%esp
+  800295:	56                   	push   %esi
+  800296:	57                   	push   %edi
+  800297:	e8 97 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80029c:	e8 0b 00 00 00       	call   8002ac <exit>
+}
+  8002a1:	83 c4 10             	add    $0x10,%esp
+  8002a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a7:	5b                   	pop    %ebx
+  8002a8:	5e                   	pop    %esi
+  8002a9:	5f                   	pop    %edi
+  8002aa:	5d                   	pop    %ebp
+  8002ab:	c3                   	ret
+
+008002ac <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002ac:	55                   	push   %ebp
+  8002ad:	89 e5                	mov    %esp,%ebp
+  8002af:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002b2:	e8 1c 21 00 00       	call   8023d3 <close_all>
+	sys_env_destroy(0);
+  8002b7:	83 ec 0c             	sub    $0xc,%esp
+  8002ba:	6a 00                	push   $0x0
+  8002bc:	e8 2b 0b 00 00       	call   800dec <sys_env_destroy>
+}
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+
+008002c6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002cb:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002ce:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002d4:	e8 7c 0b 00 00       	call   800e55 <sys_getenvid>
+  8002d9:	83 ec 0c             	sub    $0xc,%esp
+  8002dc:	ff 75 0c             	push   0xc(%ebp)
+  8002df:	ff 75 08             	push   0x8(%ebp)
+  8002e2:	56                   	push   %esi
+  8002e3:	50                   	push   %eax
+  8002e4:	68 b8 35 80 00       	push   $0x8035b8
+  8002e9:	e8 b3 00 00 00       	call   8003a1 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002ee:	83 c4 18             	add    $0x18,%esp
+  8002f1:	53                   	push   %ebx
+  8002f2:	ff 75 10             	push   0x10(%ebp)
+  8002f5:	e8 56 00 00 00       	call   800350 <vcprintf>
+	cprintf("\n");
+  8002fa:	c7 04 24 17 3b 80 00 	movl   $0x803b17,(%esp)
+  800301:	e8 9b 00 00 00       	call   8003a1 <cprintf>
+  800306:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800309:	cc                   	int3
+	while (1)
+  80030a:	eb fd                	jmp    800309 <_panic+0x43>
+
+0080030c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80030c:	55                   	push   %ebp
+  80030d:	89 e5                	mov    %esp,%ebp
+  80030f:	53                   	push   %ebx
+  800310:	83 ec 04             	sub    $0x4,%esp
+  800313:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800316:	8b 13                	mov    (%ebx),%edx
+  800318:	8d 42 01             	lea    0x1(%edx),%eax
+  80031b:	89 03                	mov    %eax,(%ebx)
+  80031d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800320:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800324:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800329:	74 09                	je     800334 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80032b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80032f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800332:	c9                   	leave
+  800333:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800334:	83 ec 08             	sub    $0x8,%esp
+  800337:	68 ff 00 00 00       	push   $0xff
+  80033c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80033f:	50                   	push   %eax
+  800340:	e8 1d 0a 00 00       	call   800d62 <sys_cputs>
+		b->idx = 0;
+  800345:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80034b:	83 c4 10             	add    $0x10,%esp
+  80034e:	eb db                	jmp    80032b <putch+0x1f>
+
+00800350 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800350:	55                   	push   %ebp
+  800351:	89 e5                	mov    %esp,%ebp
+  800353:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800359:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800360:	00 00 00 
+	b.cnt = 0;
+  800363:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80036a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80036d:	ff 75 0c             	push   0xc(%ebp)
+  800370:	ff 75 08             	push   0x8(%ebp)
+  800373:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800379:	50                   	push   %eax
+  80037a:	68 0c 03 80 00       	push   $0x80030c
+  80037f:	e8 fb 00 00 00       	call   80047f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800384:	83 c4 08             	add    $0x8,%esp
+  800387:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80038d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800393:	50                   	push   %eax
+  800394:	e8 c9 09 00 00       	call   800d62 <sys_cputs>
+
+	return b.cnt;
+}
+  800399:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80039f:	c9                   	leave
+  8003a0:	c3                   	ret
+
+008003a1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003a1:	55                   	push   %ebp
+  8003a2:	89 e5                	mov    %esp,%ebp
+  8003a4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003a7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003aa:	50                   	push   %eax
+  8003ab:	ff 75 08             	push   0x8(%ebp)
+  8003ae:	e8 9d ff ff ff       	call   800350 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003b3:	c9                   	leave
+  8003b4:	c3                   	ret
+
+008003b5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8003b5:	55                   	push   %ebp
+  8003b6:	89 e5                	mov    %esp,%ebp
+  8003b8:	57                   	push   %edi
+  8003b9:	56                   	push   %esi
+  8003ba:	53                   	push   %ebx
+  8003bb:	83 ec 1c             	sub    $0x1c,%esp
+  8003be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003c1:	89 d6                	mov    %edx,%esi
+  8003c3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8003c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003c9:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8003cc:	73 0b                	jae    8003d9 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8003ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003d1:	c1 e7 08             	shl    $0x8,%edi
+  8003d4:	0b 7d 10             	or     0x10(%ebp),%edi
+  8003d7:	eb 36                	jmp    80040f <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8003d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e1:	f7 75 08             	divl   0x8(%ebp)
+  8003e4:	89 c1                	mov    %eax,%ecx
+  8003e6:	ff 75 14             	push   0x14(%ebp)
+  8003e9:	ff 75 10             	push   0x10(%ebp)
+  8003ec:	83 eb 01             	sub    $0x1,%ebx
+  8003ef:	53                   	push   %ebx
+  8003f0:	ff 75 08             	push   0x8(%ebp)
+  8003f3:	89 f2                	mov    %esi,%edx
+  8003f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003f8:	e8 b8 ff ff ff       	call   8003b5 <printnum>
+  8003fd:	83 c4 10             	add    $0x10,%esp
+  800400:	eb 14                	jmp    800416 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	56                   	push   %esi
+  800406:	57                   	push   %edi
+  800407:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80040a:	ff d0                	call   *%eax
+  80040c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80040f:	83 eb 01             	sub    $0x1,%ebx
+  800412:	85 db                	test   %ebx,%ebx
+  800414:	7f ec                	jg     800402 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800416:	83 ec 08             	sub    $0x8,%esp
+  800419:	56                   	push   %esi
+  80041a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80041d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800422:	f7 75 08             	divl   0x8(%ebp)
+  800425:	0f be 92 db 35 80 00 	movsbl 0x8035db(%edx),%edx
+  80042c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042f:	c1 e0 08             	shl    $0x8,%eax
+  800432:	09 d0                	or     %edx,%eax
+  800434:	50                   	push   %eax
+  800435:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800438:	ff d0                	call   *%eax
+}
+  80043a:	83 c4 10             	add    $0x10,%esp
+  80043d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800440:	5b                   	pop    %ebx
+  800441:	5e                   	pop    %esi
+  800442:	5f                   	pop    %edi
+  800443:	5d                   	pop    %ebp
+  800444:	c3                   	ret
+
+00800445 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800445:	55                   	push   %ebp
+  800446:	89 e5                	mov    %esp,%ebp
+  800448:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80044b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80044f:	8b 10                	mov    (%eax),%edx
+  800451:	3b 50 04             	cmp    0x4(%eax),%edx
+  800454:	73 0a                	jae    800460 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800456:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800459:	89 08                	mov    %ecx,(%eax)
+  80045b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80045e:	88 02                	mov    %al,(%edx)
+}
+  800460:	5d                   	pop    %ebp
+  800461:	c3                   	ret
+
+00800462 <printfmt>:
+{
+  800462:	55                   	push   %ebp
+  800463:	89 e5                	mov    %esp,%ebp
+  800465:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800468:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80046b:	50                   	push   %eax
+  80046c:	ff 75 10             	push   0x10(%ebp)
+  80046f:	ff 75 0c             	push   0xc(%ebp)
+  800472:	ff 75 08             	push   0x8(%ebp)
+  800475:	e8 05 00 00 00       	call   80047f <vprintfmt>
+}
+  80047a:	83 c4 10             	add    $0x10,%esp
+  80047d:	c9                   	leave
+  80047e:	c3                   	ret
+
+0080047f <vprintfmt>:
+{
+  80047f:	55                   	push   %ebp
+  800480:	89 e5                	mov    %esp,%ebp
+  800482:	57                   	push   %edi
+  800483:	56                   	push   %esi
+  800484:	53                   	push   %ebx
+  800485:	83 ec 3c             	sub    $0x3c,%esp
+  800488:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80048b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80048e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800495:	eb 16                	jmp    8004ad <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800497:	83 ec 08             	sub    $0x8,%esp
+  80049a:	ff 75 0c             	push   0xc(%ebp)
+  80049d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004a0:	c1 e2 08             	shl    $0x8,%edx
+  8004a3:	09 d0                	or     %edx,%eax
+  8004a5:	50                   	push   %eax
+  8004a6:	ff d7                	call   *%edi
+  8004a8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004ab:	89 de                	mov    %ebx,%esi
+  8004ad:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8004b0:	0f b6 06             	movzbl (%esi),%eax
+  8004b3:	83 f8 25             	cmp    $0x25,%eax
+  8004b6:	74 0c                	je     8004c4 <vprintfmt+0x45>
+			if (ch == '\0')
+  8004b8:	85 c0                	test   %eax,%eax
+  8004ba:	75 db                	jne    800497 <vprintfmt+0x18>
+}
+  8004bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004bf:	5b                   	pop    %ebx
+  8004c0:	5e                   	pop    %esi
+  8004c1:	5f                   	pop    %edi
+  8004c2:	5d                   	pop    %ebp
+  8004c3:	c3                   	ret
+		padc = ' ';
+  8004c4:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8004c8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004cf:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004d6:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e2:	8d 73 01             	lea    0x1(%ebx),%esi
+  8004e5:	0f b6 13             	movzbl (%ebx),%edx
+  8004e8:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004eb:	3c 55                	cmp    $0x55,%al
+  8004ed:	0f 87 2c 04 00 00    	ja     80091f <vprintfmt+0x4a0>
+  8004f3:	0f b6 c0             	movzbl %al,%eax
+  8004f6:	ff 24 85 20 37 80 00 	jmp    *0x803720(,%eax,4)
+  8004fd:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8004ff:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800503:	eb dd                	jmp    8004e2 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800505:	89 f3                	mov    %esi,%ebx
+  800507:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80050b:	eb d5                	jmp    8004e2 <vprintfmt+0x63>
+  80050d:	0f b6 d2             	movzbl %dl,%edx
+  800510:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800512:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800517:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80051a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80051e:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800521:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800524:	83 fe 09             	cmp    $0x9,%esi
+  800527:	0f 87 8a 00 00 00    	ja     8005b7 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80052d:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800530:	eb e5                	jmp    800517 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800532:	8b 45 14             	mov    0x14(%ebp),%eax
+  800535:	8b 00                	mov    (%eax),%eax
+  800537:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80053a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053d:	8d 40 04             	lea    0x4(%eax),%eax
+  800540:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800543:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800545:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800549:	79 97                	jns    8004e2 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80054b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80054e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800551:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800558:	eb 88                	jmp    8004e2 <vprintfmt+0x63>
+			if (width < 0)
+  80055a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80055d:	85 db                	test   %ebx,%ebx
+  80055f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800564:	0f 49 c3             	cmovns %ebx,%eax
+  800567:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80056a:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80056c:	e9 71 ff ff ff       	jmp    8004e2 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800571:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800573:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80057a:	e9 63 ff ff ff       	jmp    8004e2 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80057f:	8d 73 02             	lea    0x2(%ebx),%esi
+  800582:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800586:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80058d:	3c 67                	cmp    $0x67,%al
+  80058f:	0f 84 18 ff ff ff    	je     8004ad <vprintfmt+0x2e>
+					attrib = 0x04;
+  800595:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80059c:	3c 72                	cmp    $0x72,%al
+  80059e:	0f 84 09 ff ff ff    	je     8004ad <vprintfmt+0x2e>
+					attrib = 0x00;
+  8005a4:	3c 62                	cmp    $0x62,%al
+  8005a6:	0f 94 c0             	sete   %al
+  8005a9:	0f b6 c0             	movzbl %al,%eax
+  8005ac:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8005af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005b2:	e9 f6 fe ff ff       	jmp    8004ad <vprintfmt+0x2e>
+  8005b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ba:	eb 89                	jmp    800545 <vprintfmt+0xc6>
+			lflag++;
+  8005bc:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005bf:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005c1:	e9 1c ff ff ff       	jmp    8004e2 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c9:	8d 58 04             	lea    0x4(%eax),%ebx
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	ff 75 0c             	push   0xc(%ebp)
+  8005d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005d5:	c1 e0 08             	shl    $0x8,%eax
+  8005d8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005db:	0b 01                	or     (%ecx),%eax
+  8005dd:	50                   	push   %eax
+  8005de:	ff d7                	call   *%edi
+			break;
+  8005e0:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005e3:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8005e6:	e9 c2 fe ff ff       	jmp    8004ad <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8005f1:	8b 10                	mov    (%eax),%edx
+  8005f3:	89 d0                	mov    %edx,%eax
+  8005f5:	f7 d8                	neg    %eax
+  8005f7:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005fa:	83 f8 12             	cmp    $0x12,%eax
+  8005fd:	7f 25                	jg     800624 <vprintfmt+0x1a5>
+  8005ff:	8b 14 85 80 38 80 00 	mov    0x803880(,%eax,4),%edx
+  800606:	85 d2                	test   %edx,%edx
+  800608:	74 1a                	je     800624 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80060a:	52                   	push   %edx
+  80060b:	68 c2 39 80 00       	push   $0x8039c2
+  800610:	ff 75 0c             	push   0xc(%ebp)
+  800613:	57                   	push   %edi
+  800614:	e8 49 fe ff ff       	call   800462 <printfmt>
+  800619:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80061c:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80061f:	e9 89 fe ff ff       	jmp    8004ad <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800624:	50                   	push   %eax
+  800625:	68 f3 35 80 00       	push   $0x8035f3
+  80062a:	ff 75 0c             	push   0xc(%ebp)
+  80062d:	57                   	push   %edi
+  80062e:	e8 2f fe ff ff       	call   800462 <printfmt>
+  800633:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800636:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800639:	e9 6f fe ff ff       	jmp    8004ad <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80063e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800641:	83 c0 04             	add    $0x4,%eax
+  800644:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80064c:	85 c9                	test   %ecx,%ecx
+  80064e:	b8 ec 35 80 00       	mov    $0x8035ec,%eax
+  800653:	0f 45 c1             	cmovne %ecx,%eax
+  800656:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800659:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80065d:	7e 06                	jle    800665 <vprintfmt+0x1e6>
+  80065f:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800663:	75 1a                	jne    80067f <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800665:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800668:	c1 e0 08             	shl    $0x8,%eax
+  80066b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80066e:	83 c8 3f             	or     $0x3f,%eax
+  800671:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800674:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800677:	89 75 10             	mov    %esi,0x10(%ebp)
+  80067a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80067d:	eb 6d                	jmp    8006ec <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80067f:	83 ec 08             	sub    $0x8,%esp
+  800682:	ff 75 d0             	push   -0x30(%ebp)
+  800685:	ff 75 c8             	push   -0x38(%ebp)
+  800688:	e8 39 03 00 00       	call   8009c6 <strnlen>
+  80068d:	89 c2                	mov    %eax,%edx
+  80068f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800692:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800694:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800697:	c1 e1 08             	shl    $0x8,%ecx
+  80069a:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80069e:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006a0:	83 c4 10             	add    $0x10,%esp
+  8006a3:	89 c3                	mov    %eax,%ebx
+  8006a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006a8:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006ab:	89 ce                	mov    %ecx,%esi
+  8006ad:	eb 0f                	jmp    8006be <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8006af:	83 ec 08             	sub    $0x8,%esp
+  8006b2:	ff 75 0c             	push   0xc(%ebp)
+  8006b5:	56                   	push   %esi
+  8006b6:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006b8:	83 eb 01             	sub    $0x1,%ebx
+  8006bb:	83 c4 10             	add    $0x10,%esp
+  8006be:	85 db                	test   %ebx,%ebx
+  8006c0:	7f ed                	jg     8006af <vprintfmt+0x230>
+  8006c2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006c8:	85 c0                	test   %eax,%eax
+  8006ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006cf:	0f 49 d0             	cmovns %eax,%edx
+  8006d2:	29 d0                	sub    %edx,%eax
+  8006d4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006d7:	eb 8c                	jmp    800665 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8006d9:	83 ec 08             	sub    $0x8,%esp
+  8006dc:	ff 75 0c             	push   0xc(%ebp)
+  8006df:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006e2:	09 c2                	or     %eax,%edx
+  8006e4:	52                   	push   %edx
+  8006e5:	ff d7                	call   *%edi
+  8006e7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006ea:	89 d9                	mov    %ebx,%ecx
+  8006ec:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8006ef:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8006f3:	0f be d0             	movsbl %al,%edx
+  8006f6:	85 d2                	test   %edx,%edx
+  8006f8:	74 2a                	je     800724 <vprintfmt+0x2a5>
+  8006fa:	85 f6                	test   %esi,%esi
+  8006fc:	78 05                	js     800703 <vprintfmt+0x284>
+  8006fe:	83 ee 01             	sub    $0x1,%esi
+  800701:	78 3b                	js     80073e <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800703:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800707:	74 d0                	je     8006d9 <vprintfmt+0x25a>
+  800709:	0f be c0             	movsbl %al,%eax
+  80070c:	83 e8 20             	sub    $0x20,%eax
+  80070f:	83 f8 5e             	cmp    $0x5e,%eax
+  800712:	76 c5                	jbe    8006d9 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800714:	83 ec 08             	sub    $0x8,%esp
+  800717:	ff 75 0c             	push   0xc(%ebp)
+  80071a:	ff 75 cc             	push   -0x34(%ebp)
+  80071d:	ff d7                	call   *%edi
+  80071f:	83 c4 10             	add    $0x10,%esp
+  800722:	eb c6                	jmp    8006ea <vprintfmt+0x26b>
+  800724:	8b 75 10             	mov    0x10(%ebp),%esi
+  800727:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80072a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80072d:	01 c3                	add    %eax,%ebx
+  80072f:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800731:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800734:	83 c8 20             	or     $0x20,%eax
+  800737:	89 75 10             	mov    %esi,0x10(%ebp)
+  80073a:	89 c6                	mov    %eax,%esi
+  80073c:	eb 14                	jmp    800752 <vprintfmt+0x2d3>
+  80073e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800741:	eb e4                	jmp    800727 <vprintfmt+0x2a8>
+  800743:	83 ec 08             	sub    $0x8,%esp
+  800746:	ff 75 0c             	push   0xc(%ebp)
+  800749:	56                   	push   %esi
+  80074a:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80074c:	83 eb 01             	sub    $0x1,%ebx
+  80074f:	83 c4 10             	add    $0x10,%esp
+  800752:	85 db                	test   %ebx,%ebx
+  800754:	7f ed                	jg     800743 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800756:	8b 75 10             	mov    0x10(%ebp),%esi
+  800759:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80075c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80075f:	e9 49 fd ff ff       	jmp    8004ad <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800764:	83 f9 01             	cmp    $0x1,%ecx
+  800767:	7f 1f                	jg     800788 <vprintfmt+0x309>
+	else if (lflag)
+  800769:	85 c9                	test   %ecx,%ecx
+  80076b:	74 69                	je     8007d6 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8b 00                	mov    (%eax),%eax
+  800772:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800775:	89 c1                	mov    %eax,%ecx
+  800777:	c1 f9 1f             	sar    $0x1f,%ecx
+  80077a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80077d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800780:	8d 40 04             	lea    0x4(%eax),%eax
+  800783:	89 45 14             	mov    %eax,0x14(%ebp)
+  800786:	eb 17                	jmp    80079f <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8b 50 04             	mov    0x4(%eax),%edx
+  80078e:	8b 00                	mov    (%eax),%eax
+  800790:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800793:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80079f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007a2:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8007a5:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8007aa:	85 db                	test   %ebx,%ebx
+  8007ac:	0f 89 f6 00 00 00    	jns    8008a8 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8007b2:	83 ec 08             	sub    $0x8,%esp
+  8007b5:	ff 75 0c             	push   0xc(%ebp)
+  8007b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007bb:	c1 e0 08             	shl    $0x8,%eax
+  8007be:	83 c8 2d             	or     $0x2d,%eax
+  8007c1:	50                   	push   %eax
+  8007c2:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8007c4:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007c7:	f7 d9                	neg    %ecx
+  8007c9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8007d1:	e9 d2 00 00 00       	jmp    8008a8 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8007d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d9:	8b 00                	mov    (%eax),%eax
+  8007db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007de:	89 c1                	mov    %eax,%ecx
+  8007e0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007e3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ef:	eb ae                	jmp    80079f <vprintfmt+0x320>
+	if (lflag >= 2)
+  8007f1:	83 f9 01             	cmp    $0x1,%ecx
+  8007f4:	7f 19                	jg     80080f <vprintfmt+0x390>
+	else if (lflag)
+  8007f6:	85 c9                	test   %ecx,%ecx
+  8007f8:	74 2a                	je     800824 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8007fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fd:	8b 08                	mov    (%eax),%ecx
+  8007ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800802:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800805:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80080a:	e9 99 00 00 00       	jmp    8008a8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80080f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800812:	8b 08                	mov    (%eax),%ecx
+  800814:	8d 40 08             	lea    0x8(%eax),%eax
+  800817:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80081a:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80081f:	e9 84 00 00 00       	jmp    8008a8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800824:	8b 45 14             	mov    0x14(%ebp),%eax
+  800827:	8b 08                	mov    (%eax),%ecx
+  800829:	8d 40 04             	lea    0x4(%eax),%eax
+  80082c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80082f:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800834:	eb 72                	jmp    8008a8 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800836:	83 f9 01             	cmp    $0x1,%ecx
+  800839:	7f 16                	jg     800851 <vprintfmt+0x3d2>
+	else if (lflag)
+  80083b:	85 c9                	test   %ecx,%ecx
+  80083d:	74 24                	je     800863 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80083f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800842:	8b 08                	mov    (%eax),%ecx
+  800844:	8d 40 04             	lea    0x4(%eax),%eax
+  800847:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80084a:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80084f:	eb 57                	jmp    8008a8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800851:	8b 45 14             	mov    0x14(%ebp),%eax
+  800854:	8b 08                	mov    (%eax),%ecx
+  800856:	8d 40 08             	lea    0x8(%eax),%eax
+  800859:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80085c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800861:	eb 45                	jmp    8008a8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800863:	8b 45 14             	mov    0x14(%ebp),%eax
+  800866:	8b 08                	mov    (%eax),%ecx
+  800868:	8d 40 04             	lea    0x4(%eax),%eax
+  80086b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80086e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800873:	eb 33                	jmp    8008a8 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800875:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800878:	c1 e3 08             	shl    $0x8,%ebx
+  80087b:	83 ec 08             	sub    $0x8,%esp
+  80087e:	ff 75 0c             	push   0xc(%ebp)
+  800881:	89 d8                	mov    %ebx,%eax
+  800883:	83 c8 30             	or     $0x30,%eax
+  800886:	50                   	push   %eax
+  800887:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800889:	83 c4 08             	add    $0x8,%esp
+  80088c:	ff 75 0c             	push   0xc(%ebp)
+  80088f:	83 cb 78             	or     $0x78,%ebx
+  800892:	53                   	push   %ebx
+  800893:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800895:	8b 45 14             	mov    0x14(%ebp),%eax
+  800898:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80089a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80089d:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a3:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8008a8:	ff 75 e4             	push   -0x1c(%ebp)
+  8008ab:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8008af:	52                   	push   %edx
+  8008b0:	ff 75 e0             	push   -0x20(%ebp)
+  8008b3:	50                   	push   %eax
+  8008b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008b7:	89 f8                	mov    %edi,%eax
+  8008b9:	e8 f7 fa ff ff       	call   8003b5 <printnum>
+			break;
+  8008be:	83 c4 10             	add    $0x10,%esp
+  8008c1:	e9 e7 fb ff ff       	jmp    8004ad <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008c6:	83 f9 01             	cmp    $0x1,%ecx
+  8008c9:	7f 16                	jg     8008e1 <vprintfmt+0x462>
+	else if (lflag)
+  8008cb:	85 c9                	test   %ecx,%ecx
+  8008cd:	74 24                	je     8008f3 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8008cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d2:	8b 08                	mov    (%eax),%ecx
+  8008d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008da:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8008df:	eb c7                	jmp    8008a8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e4:	8b 08                	mov    (%eax),%ecx
+  8008e6:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ec:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8008f1:	eb b5                	jmp    8008a8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f6:	8b 08                	mov    (%eax),%ecx
+  8008f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008fe:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800903:	eb a3                	jmp    8008a8 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800905:	83 ec 08             	sub    $0x8,%esp
+  800908:	ff 75 0c             	push   0xc(%ebp)
+  80090b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80090e:	c1 e0 08             	shl    $0x8,%eax
+  800911:	83 c8 25             	or     $0x25,%eax
+  800914:	50                   	push   %eax
+  800915:	ff d7                	call   *%edi
+			break;
+  800917:	83 c4 10             	add    $0x10,%esp
+  80091a:	e9 8e fb ff ff       	jmp    8004ad <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80091f:	83 ec 08             	sub    $0x8,%esp
+  800922:	ff 75 0c             	push   0xc(%ebp)
+  800925:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800928:	c1 e0 08             	shl    $0x8,%eax
+  80092b:	83 c8 25             	or     $0x25,%eax
+  80092e:	50                   	push   %eax
+  80092f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800931:	83 c4 10             	add    $0x10,%esp
+  800934:	89 de                	mov    %ebx,%esi
+  800936:	eb 03                	jmp    80093b <vprintfmt+0x4bc>
+  800938:	83 ee 01             	sub    $0x1,%esi
+  80093b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80093f:	75 f7                	jne    800938 <vprintfmt+0x4b9>
+  800941:	e9 67 fb ff ff       	jmp    8004ad <vprintfmt+0x2e>
+
+00800946 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800946:	55                   	push   %ebp
+  800947:	89 e5                	mov    %esp,%ebp
+  800949:	83 ec 18             	sub    $0x18,%esp
+  80094c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800952:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800955:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800959:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80095c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800963:	85 c0                	test   %eax,%eax
+  800965:	74 26                	je     80098d <vsnprintf+0x47>
+  800967:	85 d2                	test   %edx,%edx
+  800969:	7e 22                	jle    80098d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80096b:	ff 75 14             	push   0x14(%ebp)
+  80096e:	ff 75 10             	push   0x10(%ebp)
+  800971:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800974:	50                   	push   %eax
+  800975:	68 45 04 80 00       	push   $0x800445
+  80097a:	e8 00 fb ff ff       	call   80047f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80097f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800982:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800985:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800988:	83 c4 10             	add    $0x10,%esp
+}
+  80098b:	c9                   	leave
+  80098c:	c3                   	ret
+		return -E_INVAL;
+  80098d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800992:	eb f7                	jmp    80098b <vsnprintf+0x45>
+
+00800994 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800994:	55                   	push   %ebp
+  800995:	89 e5                	mov    %esp,%ebp
+  800997:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80099a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80099d:	50                   	push   %eax
+  80099e:	ff 75 10             	push   0x10(%ebp)
+  8009a1:	ff 75 0c             	push   0xc(%ebp)
+  8009a4:	ff 75 08             	push   0x8(%ebp)
+  8009a7:	e8 9a ff ff ff       	call   800946 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009ac:	c9                   	leave
+  8009ad:	c3                   	ret
+
+008009ae <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b9:	eb 03                	jmp    8009be <strlen+0x10>
+		n++;
+  8009bb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009be:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009c2:	75 f7                	jne    8009bb <strlen+0xd>
+	return n;
+}
+  8009c4:	5d                   	pop    %ebp
+  8009c5:	c3                   	ret
+
+008009c6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009c6:	55                   	push   %ebp
+  8009c7:	89 e5                	mov    %esp,%ebp
+  8009c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d4:	eb 03                	jmp    8009d9 <strnlen+0x13>
+		n++;
+  8009d6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009d9:	39 d0                	cmp    %edx,%eax
+  8009db:	74 08                	je     8009e5 <strnlen+0x1f>
+  8009dd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009e1:	75 f3                	jne    8009d6 <strnlen+0x10>
+  8009e3:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009e5:	89 d0                	mov    %edx,%eax
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+
+008009e9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	53                   	push   %ebx
+  8009ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009fc:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009ff:	83 c0 01             	add    $0x1,%eax
+  800a02:	84 d2                	test   %dl,%dl
+  800a04:	75 f2                	jne    8009f8 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a06:	89 c8                	mov    %ecx,%eax
+  800a08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a0b:	c9                   	leave
+  800a0c:	c3                   	ret
+
+00800a0d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	53                   	push   %ebx
+  800a11:	83 ec 10             	sub    $0x10,%esp
+  800a14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a17:	53                   	push   %ebx
+  800a18:	e8 91 ff ff ff       	call   8009ae <strlen>
+  800a1d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a20:	ff 75 0c             	push   0xc(%ebp)
+  800a23:	01 d8                	add    %ebx,%eax
+  800a25:	50                   	push   %eax
+  800a26:	e8 be ff ff ff       	call   8009e9 <strcpy>
+	return dst;
+}
+  800a2b:	89 d8                	mov    %ebx,%eax
+  800a2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a30:	c9                   	leave
+  800a31:	c3                   	ret
+
+00800a32 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	56                   	push   %esi
+  800a36:	53                   	push   %ebx
+  800a37:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a3d:	89 f3                	mov    %esi,%ebx
+  800a3f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	eb 0f                	jmp    800a55 <strncpy+0x23>
+		*dst++ = *src;
+  800a46:	83 c0 01             	add    $0x1,%eax
+  800a49:	0f b6 0a             	movzbl (%edx),%ecx
+  800a4c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a4f:	80 f9 01             	cmp    $0x1,%cl
+  800a52:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a55:	39 d8                	cmp    %ebx,%eax
+  800a57:	75 ed                	jne    800a46 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a59:	89 f0                	mov    %esi,%eax
+  800a5b:	5b                   	pop    %ebx
+  800a5c:	5e                   	pop    %esi
+  800a5d:	5d                   	pop    %ebp
+  800a5e:	c3                   	ret
+
+00800a5f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a5f:	55                   	push   %ebp
+  800a60:	89 e5                	mov    %esp,%ebp
+  800a62:	56                   	push   %esi
+  800a63:	53                   	push   %ebx
+  800a64:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a6a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a6d:	89 f0                	mov    %esi,%eax
+  800a6f:	85 d2                	test   %edx,%edx
+  800a71:	74 21                	je     800a94 <strlcpy+0x35>
+  800a73:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a77:	89 f2                	mov    %esi,%edx
+  800a79:	eb 09                	jmp    800a84 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a7b:	83 c1 01             	add    $0x1,%ecx
+  800a7e:	83 c2 01             	add    $0x1,%edx
+  800a81:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a84:	39 c2                	cmp    %eax,%edx
+  800a86:	74 09                	je     800a91 <strlcpy+0x32>
+  800a88:	0f b6 19             	movzbl (%ecx),%ebx
+  800a8b:	84 db                	test   %bl,%bl
+  800a8d:	75 ec                	jne    800a7b <strlcpy+0x1c>
+  800a8f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a91:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a94:	29 f0                	sub    %esi,%eax
+}
+  800a96:	5b                   	pop    %ebx
+  800a97:	5e                   	pop    %esi
+  800a98:	5d                   	pop    %ebp
+  800a99:	c3                   	ret
+
+00800a9a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aa0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800aa3:	eb 06                	jmp    800aab <strcmp+0x11>
+		p++, q++;
+  800aa5:	83 c1 01             	add    $0x1,%ecx
+  800aa8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800aab:	0f b6 01             	movzbl (%ecx),%eax
+  800aae:	84 c0                	test   %al,%al
+  800ab0:	74 04                	je     800ab6 <strcmp+0x1c>
+  800ab2:	3a 02                	cmp    (%edx),%al
+  800ab4:	74 ef                	je     800aa5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ab6:	0f b6 c0             	movzbl %al,%eax
+  800ab9:	0f b6 12             	movzbl (%edx),%edx
+  800abc:	29 d0                	sub    %edx,%eax
+}
+  800abe:	5d                   	pop    %ebp
+  800abf:	c3                   	ret
+
+00800ac0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	53                   	push   %ebx
+  800ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800aca:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800acd:	eb 09                	jmp    800ad8 <strncmp+0x18>
+		n--, p++, q++;
+  800acf:	83 ea 01             	sub    $0x1,%edx
+  800ad2:	83 c0 01             	add    $0x1,%eax
+  800ad5:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ad8:	85 d2                	test   %edx,%edx
+  800ada:	74 18                	je     800af4 <strncmp+0x34>
+  800adc:	0f b6 18             	movzbl (%eax),%ebx
+  800adf:	84 db                	test   %bl,%bl
+  800ae1:	74 04                	je     800ae7 <strncmp+0x27>
+  800ae3:	3a 19                	cmp    (%ecx),%bl
+  800ae5:	74 e8                	je     800acf <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ae7:	0f b6 00             	movzbl (%eax),%eax
+  800aea:	0f b6 11             	movzbl (%ecx),%edx
+  800aed:	29 d0                	sub    %edx,%eax
+}
+  800aef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+		return 0;
+  800af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af9:	eb f4                	jmp    800aef <strncmp+0x2f>
+
+00800afb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b01:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b05:	eb 03                	jmp    800b0a <strchr+0xf>
+  800b07:	83 c0 01             	add    $0x1,%eax
+  800b0a:	0f b6 10             	movzbl (%eax),%edx
+  800b0d:	84 d2                	test   %dl,%dl
+  800b0f:	74 06                	je     800b17 <strchr+0x1c>
+		if (*s == c)
+  800b11:	38 ca                	cmp    %cl,%dl
+  800b13:	75 f2                	jne    800b07 <strchr+0xc>
+  800b15:	eb 05                	jmp    800b1c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b1c:	5d                   	pop    %ebp
+  800b1d:	c3                   	ret
+
+00800b1e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b24:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b28:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b2b:	38 ca                	cmp    %cl,%dl
+  800b2d:	74 09                	je     800b38 <strfind+0x1a>
+  800b2f:	84 d2                	test   %dl,%dl
+  800b31:	74 05                	je     800b38 <strfind+0x1a>
+	for (; *s; s++)
+  800b33:	83 c0 01             	add    $0x1,%eax
+  800b36:	eb f0                	jmp    800b28 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b38:	5d                   	pop    %ebp
+  800b39:	c3                   	ret
+
+00800b3a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	57                   	push   %edi
+  800b3e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b41:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b44:	85 c9                	test   %ecx,%ecx
+  800b46:	74 20                	je     800b68 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b48:	89 f8                	mov    %edi,%eax
+  800b4a:	09 c8                	or     %ecx,%eax
+  800b4c:	a8 03                	test   $0x3,%al
+  800b4e:	75 12                	jne    800b62 <memset+0x28>
+		c &= 0xFF;
+  800b50:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b54:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b5a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b5d:	fc                   	cld
+  800b5e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b60:	eb 06                	jmp    800b68 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b65:	fc                   	cld
+  800b66:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b68:	89 f8                	mov    %edi,%eax
+  800b6a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b6d:	c9                   	leave
+  800b6e:	c3                   	ret
+
+00800b6f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	57                   	push   %edi
+  800b73:	56                   	push   %esi
+  800b74:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b77:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b7a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b7d:	39 c6                	cmp    %eax,%esi
+  800b7f:	73 32                	jae    800bb3 <memmove+0x44>
+  800b81:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b84:	39 d0                	cmp    %edx,%eax
+  800b86:	73 2b                	jae    800bb3 <memmove+0x44>
+		s += n;
+		d += n;
+  800b88:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b8b:	89 d6                	mov    %edx,%esi
+  800b8d:	09 fe                	or     %edi,%esi
+  800b8f:	09 ce                	or     %ecx,%esi
+  800b91:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b97:	75 0e                	jne    800ba7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b99:	83 ef 04             	sub    $0x4,%edi
+  800b9c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b9f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ba2:	fd                   	std
+  800ba3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ba5:	eb 09                	jmp    800bb0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ba7:	83 ef 01             	sub    $0x1,%edi
+  800baa:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bad:	fd                   	std
+  800bae:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bb0:	fc                   	cld
+  800bb1:	eb 1a                	jmp    800bcd <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bb3:	89 f2                	mov    %esi,%edx
+  800bb5:	09 c2                	or     %eax,%edx
+  800bb7:	09 ca                	or     %ecx,%edx
+  800bb9:	f6 c2 03             	test   $0x3,%dl
+  800bbc:	75 0a                	jne    800bc8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bbe:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bc1:	89 c7                	mov    %eax,%edi
+  800bc3:	fc                   	cld
+  800bc4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bc6:	eb 05                	jmp    800bcd <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bc8:	89 c7                	mov    %eax,%edi
+  800bca:	fc                   	cld
+  800bcb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bcd:	5e                   	pop    %esi
+  800bce:	5f                   	pop    %edi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+
+00800bd1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bd1:	55                   	push   %ebp
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bd7:	ff 75 10             	push   0x10(%ebp)
+  800bda:	ff 75 0c             	push   0xc(%ebp)
+  800bdd:	ff 75 08             	push   0x8(%ebp)
+  800be0:	e8 8a ff ff ff       	call   800b6f <memmove>
+}
+  800be5:	c9                   	leave
+  800be6:	c3                   	ret
+
+00800be7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800be7:	55                   	push   %ebp
+  800be8:	89 e5                	mov    %esp,%ebp
+  800bea:	56                   	push   %esi
+  800beb:	53                   	push   %ebx
+  800bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bef:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bf2:	89 c6                	mov    %eax,%esi
+  800bf4:	03 75 10             	add    0x10(%ebp),%esi
+  800bf7:	eb 06                	jmp    800bff <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bf9:	83 c0 01             	add    $0x1,%eax
+  800bfc:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bff:	39 f0                	cmp    %esi,%eax
+  800c01:	74 14                	je     800c17 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c03:	0f b6 08             	movzbl (%eax),%ecx
+  800c06:	0f b6 1a             	movzbl (%edx),%ebx
+  800c09:	38 d9                	cmp    %bl,%cl
+  800c0b:	74 ec                	je     800bf9 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c0d:	0f b6 c1             	movzbl %cl,%eax
+  800c10:	0f b6 db             	movzbl %bl,%ebx
+  800c13:	29 d8                	sub    %ebx,%eax
+  800c15:	eb 05                	jmp    800c1c <memcmp+0x35>
+	}
+
+	return 0;
+  800c17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c1c:	5b                   	pop    %ebx
+  800c1d:	5e                   	pop    %esi
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+
+00800c20 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c26:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c29:	89 c2                	mov    %eax,%edx
+  800c2b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c2e:	eb 03                	jmp    800c33 <memfind+0x13>
+  800c30:	83 c0 01             	add    $0x1,%eax
+  800c33:	39 d0                	cmp    %edx,%eax
+  800c35:	73 04                	jae    800c3b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c37:	38 08                	cmp    %cl,(%eax)
+  800c39:	75 f5                	jne    800c30 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c3b:	5d                   	pop    %ebp
+  800c3c:	c3                   	ret
+
+00800c3d <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c3d:	55                   	push   %ebp
+  800c3e:	89 e5                	mov    %esp,%ebp
+  800c40:	57                   	push   %edi
+  800c41:	56                   	push   %esi
+  800c42:	53                   	push   %ebx
+  800c43:	83 ec 1c             	sub    $0x1c,%esp
+  800c46:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c49:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c4c:	eb 03                	jmp    800c51 <strtol+0x14>
+		s++;
+  800c4e:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c51:	0f b6 06             	movzbl (%esi),%eax
+  800c54:	3c 20                	cmp    $0x20,%al
+  800c56:	74 f6                	je     800c4e <strtol+0x11>
+  800c58:	3c 09                	cmp    $0x9,%al
+  800c5a:	74 f2                	je     800c4e <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c5c:	3c 2b                	cmp    $0x2b,%al
+  800c5e:	74 43                	je     800ca3 <strtol+0x66>
+	int neg = 0;
+  800c60:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c65:	3c 2d                	cmp    $0x2d,%al
+  800c67:	74 44                	je     800cad <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c69:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c6f:	75 0f                	jne    800c80 <strtol+0x43>
+  800c71:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c74:	74 41                	je     800cb7 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c76:	85 ff                	test   %edi,%edi
+  800c78:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c7d:	0f 44 f8             	cmove  %eax,%edi
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c85:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c8a:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c8d:	89 fb                	mov    %edi,%ebx
+  800c8f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c92:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c95:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c98:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c9b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c9e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ca1:	eb 67                	jmp    800d0a <strtol+0xcd>
+		s++;
+  800ca3:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800ca6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cab:	eb bc                	jmp    800c69 <strtol+0x2c>
+		s++, neg = 1;
+  800cad:	83 c6 01             	add    $0x1,%esi
+  800cb0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cb5:	eb b2                	jmp    800c69 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb7:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800cbb:	74 0e                	je     800ccb <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800cbd:	85 ff                	test   %edi,%edi
+  800cbf:	75 bf                	jne    800c80 <strtol+0x43>
+		s++, base = 8;
+  800cc1:	83 c6 01             	add    $0x1,%esi
+  800cc4:	bf 08 00 00 00       	mov    $0x8,%edi
+  800cc9:	eb b5                	jmp    800c80 <strtol+0x43>
+		s += 2, base = 16;
+  800ccb:	83 c6 02             	add    $0x2,%esi
+  800cce:	bf 10 00 00 00       	mov    $0x10,%edi
+  800cd3:	eb ab                	jmp    800c80 <strtol+0x43>
+			dig = *s - '0';
+  800cd5:	0f be c9             	movsbl %cl,%ecx
+  800cd8:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800cdb:	39 f9                	cmp    %edi,%ecx
+  800cdd:	7d 59                	jge    800d38 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800cdf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800ce3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ce6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ce9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cec:	0f af d8             	imul   %eax,%ebx
+  800cef:	0f af d7             	imul   %edi,%edx
+  800cf2:	01 d3                	add    %edx,%ebx
+  800cf4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cf7:	f7 e7                	mul    %edi
+  800cf9:	01 da                	add    %ebx,%edx
+  800cfb:	89 cb                	mov    %ecx,%ebx
+  800cfd:	c1 fb 1f             	sar    $0x1f,%ebx
+  800d00:	01 c8                	add    %ecx,%eax
+  800d02:	11 da                	adc    %ebx,%edx
+  800d04:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d07:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0d:	0f b6 08             	movzbl (%eax),%ecx
+  800d10:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800d13:	80 fb 09             	cmp    $0x9,%bl
+  800d16:	76 bd                	jbe    800cd5 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800d18:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800d1b:	80 fb 19             	cmp    $0x19,%bl
+  800d1e:	77 08                	ja     800d28 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800d20:	0f be c9             	movsbl %cl,%ecx
+  800d23:	83 e9 57             	sub    $0x57,%ecx
+  800d26:	eb b3                	jmp    800cdb <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d28:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800d2b:	80 fb 19             	cmp    $0x19,%bl
+  800d2e:	77 08                	ja     800d38 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800d30:	0f be c9             	movsbl %cl,%ecx
+  800d33:	83 e9 37             	sub    $0x37,%ecx
+  800d36:	eb a3                	jmp    800cdb <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d38:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d3b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d3e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d41:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d44:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d48:	74 05                	je     800d4f <strtol+0x112>
+		*endptr = (char *) s;
+  800d4a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d4d:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d4f:	85 c9                	test   %ecx,%ecx
+  800d51:	74 07                	je     800d5a <strtol+0x11d>
+  800d53:	f7 d8                	neg    %eax
+  800d55:	83 d2 00             	adc    $0x0,%edx
+  800d58:	f7 da                	neg    %edx
+}
+  800d5a:	83 c4 1c             	add    $0x1c,%esp
+  800d5d:	5b                   	pop    %ebx
+  800d5e:	5e                   	pop    %esi
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+
+00800d62 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	56                   	push   %esi
+  800d67:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d68:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d6f:	74 18                	je     800d89 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7c:	89 c3                	mov    %eax,%ebx
+  800d7e:	89 c7                	mov    %eax,%edi
+  800d80:	89 c6                	mov    %eax,%esi
+  800d82:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d84:	5b                   	pop    %ebx
+  800d85:	5e                   	pop    %esi
+  800d86:	5f                   	pop    %edi
+  800d87:	5d                   	pop    %ebp
+  800d88:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d91:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d94:	89 c3                	mov    %eax,%ebx
+  800d96:	89 c7                	mov    %eax,%edi
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	8d 35 a3 0d 80 00    	lea    0x800da3,%esi
+  800da1:	0f 34                	sysenter
+  800da3:	5d                   	pop    %ebp
+		goto out;
+  800da4:	eb de                	jmp    800d84 <sys_cputs+0x22>
+
+00800da6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	57                   	push   %edi
+  800daa:	56                   	push   %esi
+  800dab:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dac:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800db3:	74 19                	je     800dce <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800db5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dba:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dbf:	89 d1                	mov    %edx,%ecx
+  800dc1:	89 d3                	mov    %edx,%ebx
+  800dc3:	89 d7                	mov    %edx,%edi
+  800dc5:	89 d6                	mov    %edx,%esi
+  800dc7:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dce:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd8:	89 d1                	mov    %edx,%ecx
+  800dda:	89 d3                	mov    %edx,%ebx
+  800ddc:	89 d7                	mov    %edx,%edi
+  800dde:	55                   	push   %ebp
+  800ddf:	89 e5                	mov    %esp,%ebp
+  800de1:	8d 35 e9 0d 80 00    	lea    0x800de9,%esi
+  800de7:	0f 34                	sysenter
+  800de9:	5d                   	pop    %ebp
+		goto out;
+  800dea:	eb dd                	jmp    800dc9 <sys_cgetc+0x23>
+
+00800dec <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  800df2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800df5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dfc:	74 21                	je     800e1f <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800dfe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e03:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	89 cb                	mov    %ecx,%ebx
+  800e0d:	89 cf                	mov    %ecx,%edi
+  800e0f:	89 ce                	mov    %ecx,%esi
+  800e11:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e13:	85 c0                	test   %eax,%eax
+  800e15:	7f 27                	jg     800e3e <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5f                   	pop    %edi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e27:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e2c:	89 cb                	mov    %ecx,%ebx
+  800e2e:	89 cf                	mov    %ecx,%edi
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	8d 35 3b 0e 80 00    	lea    0x800e3b,%esi
+  800e39:	0f 34                	sysenter
+  800e3b:	5d                   	pop    %ebp
+		goto out;
+  800e3c:	eb d5                	jmp    800e13 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3e:	83 ec 0c             	sub    $0xc,%esp
+  800e41:	50                   	push   %eax
+  800e42:	6a 03                	push   $0x3
+  800e44:	68 eb 38 80 00       	push   $0x8038eb
+  800e49:	6a 3f                	push   $0x3f
+  800e4b:	68 08 39 80 00       	push   $0x803908
+  800e50:	e8 71 f4 ff ff       	call   8002c6 <_panic>
+
+00800e55 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e5b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e62:	74 19                	je     800e7d <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e69:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e6e:	89 d1                	mov    %edx,%ecx
+  800e70:	89 d3                	mov    %edx,%ebx
+  800e72:	89 d7                	mov    %edx,%edi
+  800e74:	89 d6                	mov    %edx,%esi
+  800e76:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e78:	5b                   	pop    %ebx
+  800e79:	5e                   	pop    %esi
+  800e7a:	5f                   	pop    %edi
+  800e7b:	5d                   	pop    %ebp
+  800e7c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e82:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e87:	89 d1                	mov    %edx,%ecx
+  800e89:	89 d3                	mov    %edx,%ebx
+  800e8b:	89 d7                	mov    %edx,%edi
+  800e8d:	55                   	push   %ebp
+  800e8e:	89 e5                	mov    %esp,%ebp
+  800e90:	8d 35 98 0e 80 00    	lea    0x800e98,%esi
+  800e96:	0f 34                	sysenter
+  800e98:	5d                   	pop    %ebp
+		goto out;
+  800e99:	eb dd                	jmp    800e78 <sys_getenvid+0x23>
+
+00800e9b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	57                   	push   %edi
+  800e9f:	56                   	push   %esi
+  800ea0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ea1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ea8:	74 19                	je     800ec3 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800eaa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eaf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800eb4:	89 d1                	mov    %edx,%ecx
+  800eb6:	89 d3                	mov    %edx,%ebx
+  800eb8:	89 d7                	mov    %edx,%edi
+  800eba:	89 d6                	mov    %edx,%esi
+  800ebc:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ec3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ecd:	89 d1                	mov    %edx,%ecx
+  800ecf:	89 d3                	mov    %edx,%ebx
+  800ed1:	89 d7                	mov    %edx,%edi
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	8d 35 de 0e 80 00    	lea    0x800ede,%esi
+  800edc:	0f 34                	sysenter
+  800ede:	5d                   	pop    %ebp
+		goto out;
+  800edf:	eb dd                	jmp    800ebe <sys_yield+0x23>
+
+00800ee1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+  800ee7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eea:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ef1:	74 23                	je     800f16 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800ef3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f06:	89 f7                	mov    %esi,%edi
+  800f08:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0a:	85 c0                	test   %eax,%eax
+  800f0c:	7f 29                	jg     800f37 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f11:	5b                   	pop    %ebx
+  800f12:	5e                   	pop    %esi
+  800f13:	5f                   	pop    %edi
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f21:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	8d 35 34 0f 80 00    	lea    0x800f34,%esi
+  800f32:	0f 34                	sysenter
+  800f34:	5d                   	pop    %ebp
+		goto out;
+  800f35:	eb d3                	jmp    800f0a <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 04                	push   $0x4
+  800f3d:	68 eb 38 80 00       	push   $0x8038eb
+  800f42:	6a 3f                	push   $0x3f
+  800f44:	68 08 39 80 00       	push   $0x803908
+  800f49:	e8 78 f3 ff ff       	call   8002c6 <_panic>
+
+00800f4e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+  800f57:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f5a:	85 f6                	test   %esi,%esi
+  800f5c:	75 09                	jne    800f67 <sys_page_map+0x19>
+  800f5e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f65:	74 1f                	je     800f86 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f67:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f75:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f78:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7a:	85 c0                	test   %eax,%eax
+  800f7c:	7f 27                	jg     800fa5 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f81:	5b                   	pop    %ebx
+  800f82:	5e                   	pop    %esi
+  800f83:	5f                   	pop    %edi
+  800f84:	5d                   	pop    %ebp
+  800f85:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f94:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	8d 35 a2 0f 80 00    	lea    0x800fa2,%esi
+  800fa0:	0f 34                	sysenter
+  800fa2:	5d                   	pop    %ebp
+		goto out;
+  800fa3:	eb d5                	jmp    800f7a <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa5:	83 ec 0c             	sub    $0xc,%esp
+  800fa8:	50                   	push   %eax
+  800fa9:	6a 05                	push   $0x5
+  800fab:	68 eb 38 80 00       	push   $0x8038eb
+  800fb0:	6a 3f                	push   $0x3f
+  800fb2:	68 08 39 80 00       	push   $0x803908
+  800fb7:	e8 0a f3 ff ff       	call   8002c6 <_panic>
+
+00800fbc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fbc:	55                   	push   %ebp
+  800fbd:	89 e5                	mov    %esp,%ebp
+  800fbf:	57                   	push   %edi
+  800fc0:	56                   	push   %esi
+  800fc1:	53                   	push   %ebx
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fc5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fcc:	74 22                	je     800ff0 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800fce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	89 df                	mov    %ebx,%edi
+  800fe0:	89 de                	mov    %ebx,%esi
+  800fe2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe4:	85 c0                	test   %eax,%eax
+  800fe6:	7f 28                	jg     801010 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fe8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800feb:	5b                   	pop    %ebx
+  800fec:	5e                   	pop    %esi
+  800fed:	5f                   	pop    %edi
+  800fee:	5d                   	pop    %ebp
+  800fef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ff0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffb:	b8 06 00 00 00       	mov    $0x6,%eax
+  801000:	89 df                	mov    %ebx,%edi
+  801002:	55                   	push   %ebp
+  801003:	89 e5                	mov    %esp,%ebp
+  801005:	8d 35 0d 10 80 00    	lea    0x80100d,%esi
+  80100b:	0f 34                	sysenter
+  80100d:	5d                   	pop    %ebp
+		goto out;
+  80100e:	eb d4                	jmp    800fe4 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801010:	83 ec 0c             	sub    $0xc,%esp
+  801013:	50                   	push   %eax
+  801014:	6a 06                	push   $0x6
+  801016:	68 eb 38 80 00       	push   $0x8038eb
+  80101b:	6a 3f                	push   $0x3f
+  80101d:	68 08 39 80 00       	push   $0x803908
+  801022:	e8 9f f2 ff ff       	call   8002c6 <_panic>
+
+00801027 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	56                   	push   %esi
+  80102c:	53                   	push   %ebx
+  80102d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801030:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801037:	74 22                	je     80105b <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801039:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801043:	8b 55 08             	mov    0x8(%ebp),%edx
+  801046:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801049:	89 df                	mov    %ebx,%edi
+  80104b:	89 de                	mov    %ebx,%esi
+  80104d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104f:	85 c0                	test   %eax,%eax
+  801051:	7f 28                	jg     80107b <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801053:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801056:	5b                   	pop    %ebx
+  801057:	5e                   	pop    %esi
+  801058:	5f                   	pop    %edi
+  801059:	5d                   	pop    %ebp
+  80105a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80105b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801066:	b8 08 00 00 00       	mov    $0x8,%eax
+  80106b:	89 df                	mov    %ebx,%edi
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	8d 35 78 10 80 00    	lea    0x801078,%esi
+  801076:	0f 34                	sysenter
+  801078:	5d                   	pop    %ebp
+		goto out;
+  801079:	eb d4                	jmp    80104f <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107b:	83 ec 0c             	sub    $0xc,%esp
+  80107e:	50                   	push   %eax
+  80107f:	6a 08                	push   $0x8
+  801081:	68 eb 38 80 00       	push   $0x8038eb
+  801086:	6a 3f                	push   $0x3f
+  801088:	68 08 39 80 00       	push   $0x803908
+  80108d:	e8 34 f2 ff ff       	call   8002c6 <_panic>
+
+00801092 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801092:	55                   	push   %ebp
+  801093:	89 e5                	mov    %esp,%ebp
+  801095:	57                   	push   %edi
+  801096:	56                   	push   %esi
+  801097:	53                   	push   %ebx
+  801098:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80109b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010a2:	74 22                	je     8010c6 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  8010a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b4:	89 df                	mov    %ebx,%edi
+  8010b6:	89 de                	mov    %ebx,%esi
+  8010b8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ba:	85 c0                	test   %eax,%eax
+  8010bc:	7f 28                	jg     8010e6 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c1:	5b                   	pop    %ebx
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010d6:	89 df                	mov    %ebx,%edi
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	8d 35 e3 10 80 00    	lea    0x8010e3,%esi
+  8010e1:	0f 34                	sysenter
+  8010e3:	5d                   	pop    %ebp
+		goto out;
+  8010e4:	eb d4                	jmp    8010ba <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e6:	83 ec 0c             	sub    $0xc,%esp
+  8010e9:	50                   	push   %eax
+  8010ea:	6a 09                	push   $0x9
+  8010ec:	68 eb 38 80 00       	push   $0x8038eb
+  8010f1:	6a 3f                	push   $0x3f
+  8010f3:	68 08 39 80 00       	push   $0x803908
+  8010f8:	e8 c9 f1 ff ff       	call   8002c6 <_panic>
+
+008010fd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010fd:	55                   	push   %ebp
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	57                   	push   %edi
+  801101:	56                   	push   %esi
+  801102:	53                   	push   %ebx
+  801103:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801106:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80110d:	74 22                	je     801131 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80110f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801114:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801119:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111f:	89 df                	mov    %ebx,%edi
+  801121:	89 de                	mov    %ebx,%esi
+  801123:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801125:	85 c0                	test   %eax,%eax
+  801127:	7f 28                	jg     801151 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801131:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801136:	8b 55 08             	mov    0x8(%ebp),%edx
+  801139:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801141:	89 df                	mov    %ebx,%edi
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	8d 35 4e 11 80 00    	lea    0x80114e,%esi
+  80114c:	0f 34                	sysenter
+  80114e:	5d                   	pop    %ebp
+		goto out;
+  80114f:	eb d4                	jmp    801125 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801151:	83 ec 0c             	sub    $0xc,%esp
+  801154:	50                   	push   %eax
+  801155:	6a 0a                	push   $0xa
+  801157:	68 eb 38 80 00       	push   $0x8038eb
+  80115c:	6a 3f                	push   $0x3f
+  80115e:	68 08 39 80 00       	push   $0x803908
+  801163:	e8 5e f1 ff ff       	call   8002c6 <_panic>
+
+00801168 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	57                   	push   %edi
+  80116c:	56                   	push   %esi
+  80116d:	53                   	push   %ebx
+  80116e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801171:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801178:	74 22                	je     80119c <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80117a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801184:	8b 55 08             	mov    0x8(%ebp),%edx
+  801187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118a:	89 df                	mov    %ebx,%edi
+  80118c:	89 de                	mov    %ebx,%esi
+  80118e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801190:	85 c0                	test   %eax,%eax
+  801192:	7f 28                	jg     8011bc <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80119c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a7:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011ac:	89 df                	mov    %ebx,%edi
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	8d 35 b9 11 80 00    	lea    0x8011b9,%esi
+  8011b7:	0f 34                	sysenter
+  8011b9:	5d                   	pop    %ebp
+		goto out;
+  8011ba:	eb d4                	jmp    801190 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011bc:	83 ec 0c             	sub    $0xc,%esp
+  8011bf:	50                   	push   %eax
+  8011c0:	6a 17                	push   $0x17
+  8011c2:	68 eb 38 80 00       	push   $0x8038eb
+  8011c7:	6a 3f                	push   $0x3f
+  8011c9:	68 08 39 80 00       	push   $0x803908
+  8011ce:	e8 f3 f0 ff ff       	call   8002c6 <_panic>
+
+008011d3 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8011d3:	55                   	push   %ebp
+  8011d4:	89 e5                	mov    %esp,%ebp
+  8011d6:	57                   	push   %edi
+  8011d7:	56                   	push   %esi
+  8011d8:	53                   	push   %ebx
+  8011d9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011dc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011e3:	74 22                	je     801207 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8011e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ea:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f5:	89 df                	mov    %ebx,%edi
+  8011f7:	89 de                	mov    %ebx,%esi
+  8011f9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011fb:	85 c0                	test   %eax,%eax
+  8011fd:	7f 28                	jg     801227 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8011ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801202:	5b                   	pop    %ebx
+  801203:	5e                   	pop    %esi
+  801204:	5f                   	pop    %edi
+  801205:	5d                   	pop    %ebp
+  801206:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	b8 18 00 00 00       	mov    $0x18,%eax
+  801217:	89 df                	mov    %ebx,%edi
+  801219:	55                   	push   %ebp
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	8d 35 24 12 80 00    	lea    0x801224,%esi
+  801222:	0f 34                	sysenter
+  801224:	5d                   	pop    %ebp
+		goto out;
+  801225:	eb d4                	jmp    8011fb <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801227:	83 ec 0c             	sub    $0xc,%esp
+  80122a:	50                   	push   %eax
+  80122b:	6a 18                	push   $0x18
+  80122d:	68 eb 38 80 00       	push   $0x8038eb
+  801232:	6a 3f                	push   $0x3f
+  801234:	68 08 39 80 00       	push   $0x803908
+  801239:	e8 88 f0 ff ff       	call   8002c6 <_panic>
+
+0080123e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  801241:	57                   	push   %edi
+  801242:	56                   	push   %esi
+  801243:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801244:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80124b:	74 1d                	je     80126a <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80124d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801252:	be 00 00 00 00       	mov    $0x0,%esi
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801260:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801263:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801265:	5b                   	pop    %ebx
+  801266:	5e                   	pop    %esi
+  801267:	5f                   	pop    %edi
+  801268:	5d                   	pop    %ebp
+  801269:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80126a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801270:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801275:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801278:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80127b:	55                   	push   %ebp
+  80127c:	89 e5                	mov    %esp,%ebp
+  80127e:	8d 35 86 12 80 00    	lea    0x801286,%esi
+  801284:	0f 34                	sysenter
+  801286:	5d                   	pop    %ebp
+		goto out;
+  801287:	eb dc                	jmp    801265 <sys_ipc_try_send+0x27>
+
+00801289 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801289:	55                   	push   %ebp
+  80128a:	89 e5                	mov    %esp,%ebp
+  80128c:	57                   	push   %edi
+  80128d:	56                   	push   %esi
+  80128e:	53                   	push   %ebx
+  80128f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801292:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801299:	74 21                	je     8012bc <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80129b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012a0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a8:	89 cb                	mov    %ecx,%ebx
+  8012aa:	89 cf                	mov    %ecx,%edi
+  8012ac:	89 ce                	mov    %ecx,%esi
+  8012ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	7f 27                	jg     8012db <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8012b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b7:	5b                   	pop    %ebx
+  8012b8:	5e                   	pop    %esi
+  8012b9:	5f                   	pop    %edi
+  8012ba:	5d                   	pop    %ebp
+  8012bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012c9:	89 cb                	mov    %ecx,%ebx
+  8012cb:	89 cf                	mov    %ecx,%edi
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	8d 35 d8 12 80 00    	lea    0x8012d8,%esi
+  8012d6:	0f 34                	sysenter
+  8012d8:	5d                   	pop    %ebp
+		goto out;
+  8012d9:	eb d5                	jmp    8012b0 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012db:	83 ec 0c             	sub    $0xc,%esp
+  8012de:	50                   	push   %eax
+  8012df:	6a 0d                	push   $0xd
+  8012e1:	68 eb 38 80 00       	push   $0x8038eb
+  8012e6:	6a 3f                	push   $0x3f
+  8012e8:	68 08 39 80 00       	push   $0x803908
+  8012ed:	e8 d4 ef ff ff       	call   8002c6 <_panic>
+
+008012f2 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8012f2:	55                   	push   %ebp
+  8012f3:	89 e5                	mov    %esp,%ebp
+  8012f5:	57                   	push   %edi
+  8012f6:	56                   	push   %esi
+  8012f7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012f8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012ff:	74 1b                	je     80131c <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801301:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801306:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80130b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801311:	89 df                	mov    %ebx,%edi
+  801313:	89 de                	mov    %ebx,%esi
+  801315:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801317:	5b                   	pop    %ebx
+  801318:	5e                   	pop    %esi
+  801319:	5f                   	pop    %edi
+  80131a:	5d                   	pop    %ebp
+  80131b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80131c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801321:	8b 55 08             	mov    0x8(%ebp),%edx
+  801324:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801327:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80132c:	89 df                	mov    %ebx,%edi
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	8d 35 39 13 80 00    	lea    0x801339,%esi
+  801337:	0f 34                	sysenter
+  801339:	5d                   	pop    %ebp
+		goto out;
+  80133a:	eb db                	jmp    801317 <sys_ipc_recv_until+0x25>
+
+0080133c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	57                   	push   %edi
+  801340:	56                   	push   %esi
+  801341:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801342:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801349:	74 19                	je     801364 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80134b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801350:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801355:	89 d1                	mov    %edx,%ecx
+  801357:	89 d3                	mov    %edx,%ebx
+  801359:	89 d7                	mov    %edx,%edi
+  80135b:	89 d6                	mov    %edx,%esi
+  80135d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80135f:	5b                   	pop    %ebx
+  801360:	5e                   	pop    %esi
+  801361:	5f                   	pop    %edi
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801364:	ba 00 00 00 00       	mov    $0x0,%edx
+  801369:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80136e:	89 d1                	mov    %edx,%ecx
+  801370:	89 d3                	mov    %edx,%ebx
+  801372:	89 d7                	mov    %edx,%edi
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	8d 35 7f 13 80 00    	lea    0x80137f,%esi
+  80137d:	0f 34                	sysenter
+  80137f:	5d                   	pop    %ebp
+		goto out;
+  801380:	eb dd                	jmp    80135f <sys_time_msec+0x23>
+
+00801382 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801382:	55                   	push   %ebp
+  801383:	89 e5                	mov    %esp,%ebp
+  801385:	57                   	push   %edi
+  801386:	56                   	push   %esi
+  801387:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801388:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80138f:	74 1a                	je     8013ab <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801391:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801396:	b8 10 00 00 00       	mov    $0x10,%eax
+  80139b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139e:	89 cb                	mov    %ecx,%ebx
+  8013a0:	89 cf                	mov    %ecx,%edi
+  8013a2:	89 ce                	mov    %ecx,%esi
+  8013a4:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8013a6:	5b                   	pop    %ebx
+  8013a7:	5e                   	pop    %esi
+  8013a8:	5f                   	pop    %edi
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013b3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013b8:	89 cb                	mov    %ecx,%ebx
+  8013ba:	89 cf                	mov    %ecx,%edi
+  8013bc:	55                   	push   %ebp
+  8013bd:	89 e5                	mov    %esp,%ebp
+  8013bf:	8d 35 c7 13 80 00    	lea    0x8013c7,%esi
+  8013c5:	0f 34                	sysenter
+  8013c7:	5d                   	pop    %ebp
+		goto out;
+  8013c8:	eb dc                	jmp    8013a6 <sys_sleep_until+0x24>
+
+008013ca <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8013ca:	55                   	push   %ebp
+  8013cb:	89 e5                	mov    %esp,%ebp
+  8013cd:	57                   	push   %edi
+  8013ce:	56                   	push   %esi
+  8013cf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013d0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013d7:	74 1a                	je     8013f3 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8013d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013de:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	89 cb                	mov    %ecx,%ebx
+  8013e8:	89 cf                	mov    %ecx,%edi
+  8013ea:	89 ce                	mov    %ecx,%esi
+  8013ec:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8013ee:	5b                   	pop    %ebx
+  8013ef:	5e                   	pop    %esi
+  8013f0:	5f                   	pop    %edi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013fb:	b8 11 00 00 00       	mov    $0x11,%eax
+  801400:	89 cb                	mov    %ecx,%ebx
+  801402:	89 cf                	mov    %ecx,%edi
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	8d 35 0f 14 80 00    	lea    0x80140f,%esi
+  80140d:	0f 34                	sysenter
+  80140f:	5d                   	pop    %ebp
+		goto out;
+  801410:	eb dc                	jmp    8013ee <sys_env_print_stats+0x24>
+
+00801412 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	57                   	push   %edi
+  801416:	56                   	push   %esi
+  801417:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801418:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80141f:	74 1b                	je     80143c <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801421:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801426:	b8 19 00 00 00       	mov    $0x19,%eax
+  80142b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801431:	89 df                	mov    %ebx,%edi
+  801433:	89 de                	mov    %ebx,%esi
+  801435:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5f                   	pop    %edi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80143c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801441:	8b 55 08             	mov    0x8(%ebp),%edx
+  801444:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801447:	b8 19 00 00 00       	mov    $0x19,%eax
+  80144c:	89 df                	mov    %ebx,%edi
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	8d 35 59 14 80 00    	lea    0x801459,%esi
+  801457:	0f 34                	sysenter
+  801459:	5d                   	pop    %ebp
+		goto out;
+  80145a:	eb db                	jmp    801437 <sys_perf+0x25>
+
+0080145c <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80145c:	55                   	push   %ebp
+  80145d:	89 e5                	mov    %esp,%ebp
+  80145f:	57                   	push   %edi
+  801460:	56                   	push   %esi
+  801461:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801462:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801469:	74 19                	je     801484 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80146b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801470:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801475:	89 d1                	mov    %edx,%ecx
+  801477:	89 d3                	mov    %edx,%ebx
+  801479:	89 d7                	mov    %edx,%edi
+  80147b:	89 d6                	mov    %edx,%esi
+  80147d:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80147f:	5b                   	pop    %ebx
+  801480:	5e                   	pop    %esi
+  801481:	5f                   	pop    %edi
+  801482:	5d                   	pop    %ebp
+  801483:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801484:	ba 00 00 00 00       	mov    $0x0,%edx
+  801489:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80148e:	89 d1                	mov    %edx,%ecx
+  801490:	89 d3                	mov    %edx,%ebx
+  801492:	89 d7                	mov    %edx,%edi
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	8d 35 9f 14 80 00    	lea    0x80149f,%esi
+  80149d:	0f 34                	sysenter
+  80149f:	5d                   	pop    %ebp
+		goto out;
+  8014a0:	eb dd                	jmp    80147f <sys_fork+0x23>
+
+008014a2 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8014a2:	55                   	push   %ebp
+  8014a3:	89 e5                	mov    %esp,%ebp
+  8014a5:	57                   	push   %edi
+  8014a6:	56                   	push   %esi
+  8014a7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014a8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014af:	74 1c                	je     8014cd <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8014b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c4:	89 f7                	mov    %esi,%edi
+  8014c6:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8014c8:	5b                   	pop    %ebx
+  8014c9:	5e                   	pop    %esi
+  8014ca:	5f                   	pop    %edi
+  8014cb:	5d                   	pop    %ebp
+  8014cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e0:	55                   	push   %ebp
+  8014e1:	89 e5                	mov    %esp,%ebp
+  8014e3:	8d 35 eb 14 80 00    	lea    0x8014eb,%esi
+  8014e9:	0f 34                	sysenter
+  8014eb:	5d                   	pop    %ebp
+		goto out;
+  8014ec:	eb da                	jmp    8014c8 <sys_thread_create+0x26>
+
+008014ee <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8014ee:	55                   	push   %ebp
+  8014ef:	89 e5                	mov    %esp,%ebp
+  8014f1:	57                   	push   %edi
+  8014f2:	56                   	push   %esi
+  8014f3:	53                   	push   %ebx
+  8014f4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014f7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014fe:	74 24                	je     801524 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801500:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801505:	be 00 00 00 00       	mov    $0x0,%esi
+  80150a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801510:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801513:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801516:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801518:	85 c0                	test   %eax,%eax
+  80151a:	7f 27                	jg     801543 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80151c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80151f:	5b                   	pop    %ebx
+  801520:	5e                   	pop    %esi
+  801521:	5f                   	pop    %edi
+  801522:	5d                   	pop    %ebp
+  801523:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801524:	8b 55 08             	mov    0x8(%ebp),%edx
+  801527:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80152f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801532:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	8d 35 40 15 80 00    	lea    0x801540,%esi
+  80153e:	0f 34                	sysenter
+  801540:	5d                   	pop    %ebp
+		goto out;
+  801541:	eb d5                	jmp    801518 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801543:	83 ec 0c             	sub    $0xc,%esp
+  801546:	50                   	push   %eax
+  801547:	6a 1f                	push   $0x1f
+  801549:	68 eb 38 80 00       	push   $0x8038eb
+  80154e:	6a 3f                	push   $0x3f
+  801550:	68 08 39 80 00       	push   $0x803908
+  801555:	e8 6c ed ff ff       	call   8002c6 <_panic>
+
+0080155a <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80155a:	55                   	push   %ebp
+  80155b:	89 e5                	mov    %esp,%ebp
+  80155d:	57                   	push   %edi
+  80155e:	56                   	push   %esi
+  80155f:	53                   	push   %ebx
+  801560:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801563:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80156a:	74 23                	je     80158f <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80156c:	be 00 00 00 00       	mov    $0x0,%esi
+  801571:	b8 20 00 00 00       	mov    $0x20,%eax
+  801576:	8b 55 08             	mov    0x8(%ebp),%edx
+  801579:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157f:	89 f7                	mov    %esi,%edi
+  801581:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801583:	85 c0                	test   %eax,%eax
+  801585:	7f 29                	jg     8015b0 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80158a:	5b                   	pop    %ebx
+  80158b:	5e                   	pop    %esi
+  80158c:	5f                   	pop    %edi
+  80158d:	5d                   	pop    %ebp
+  80158e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80158f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801592:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801595:	b8 20 00 00 00       	mov    $0x20,%eax
+  80159a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80159f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	8d 35 ad 15 80 00    	lea    0x8015ad,%esi
+  8015ab:	0f 34                	sysenter
+  8015ad:	5d                   	pop    %ebp
+		goto out;
+  8015ae:	eb d3                	jmp    801583 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015b0:	83 ec 0c             	sub    $0xc,%esp
+  8015b3:	50                   	push   %eax
+  8015b4:	6a 20                	push   $0x20
+  8015b6:	68 eb 38 80 00       	push   $0x8038eb
+  8015bb:	6a 3f                	push   $0x3f
+  8015bd:	68 08 39 80 00       	push   $0x803908
+  8015c2:	e8 ff ec ff ff       	call   8002c6 <_panic>
+
+008015c7 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	57                   	push   %edi
+  8015cb:	56                   	push   %esi
+  8015cc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015cd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015d4:	74 1b                	je     8015f1 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8015d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	89 de                	mov    %ebx,%esi
+  8015ea:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8015ec:	5b                   	pop    %ebx
+  8015ed:	5e                   	pop    %esi
+  8015ee:	5f                   	pop    %edi
+  8015ef:	5d                   	pop    %ebp
+  8015f0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801601:	89 df                	mov    %ebx,%edi
+  801603:	55                   	push   %ebp
+  801604:	89 e5                	mov    %esp,%ebp
+  801606:	8d 35 0e 16 80 00    	lea    0x80160e,%esi
+  80160c:	0f 34                	sysenter
+  80160e:	5d                   	pop    %ebp
+		goto out;
+  80160f:	eb db                	jmp    8015ec <sys_batch+0x25>
+
+00801611 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801611:	55                   	push   %ebp
+  801612:	89 e5                	mov    %esp,%ebp
+  801614:	57                   	push   %edi
+  801615:	56                   	push   %esi
+  801616:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801617:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80161e:	74 1a                	je     80163a <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801625:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80162a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162d:	89 cb                	mov    %ecx,%ebx
+  80162f:	89 cf                	mov    %ecx,%edi
+  801631:	89 ce                	mov    %ecx,%esi
+  801633:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801635:	5b                   	pop    %ebx
+  801636:	5e                   	pop    %esi
+  801637:	5f                   	pop    %edi
+  801638:	5d                   	pop    %ebp
+  801639:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80163a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801642:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801647:	89 cb                	mov    %ecx,%ebx
+  801649:	89 cf                	mov    %ecx,%edi
+  80164b:	55                   	push   %ebp
+  80164c:	89 e5                	mov    %esp,%ebp
+  80164e:	8d 35 56 16 80 00    	lea    0x801656,%esi
+  801654:	0f 34                	sysenter
+  801656:	5d                   	pop    %ebp
+		goto out;
+  801657:	eb dc                	jmp    801635 <sys_trace_ctl+0x24>
+
+00801659 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801659:	55                   	push   %ebp
+  80165a:	89 e5                	mov    %esp,%ebp
+  80165c:	57                   	push   %edi
+  80165d:	56                   	push   %esi
+  80165e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80165f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801666:	74 1c                	je     801684 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801668:	be 00 00 00 00       	mov    $0x0,%esi
+  80166d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801672:	8b 55 08             	mov    0x8(%ebp),%edx
+  801675:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801678:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80167b:	89 f7                	mov    %esi,%edi
+  80167d:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80167f:	5b                   	pop    %ebx
+  801680:	5e                   	pop    %esi
+  801681:	5f                   	pop    %edi
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801684:	8b 55 08             	mov    0x8(%ebp),%edx
+  801687:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80168f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801694:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	8d 35 a2 16 80 00    	lea    0x8016a2,%esi
+  8016a0:	0f 34                	sysenter
+  8016a2:	5d                   	pop    %ebp
+		goto out;
+  8016a3:	eb da                	jmp    80167f <sys_trace_read+0x26>
+
+008016a5 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8016a5:	55                   	push   %ebp
+  8016a6:	89 e5                	mov    %esp,%ebp
+  8016a8:	57                   	push   %edi
+  8016a9:	56                   	push   %esi
+  8016aa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016ab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016b2:	74 1c                	je     8016d0 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8016b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c7:	89 f7                	mov    %esi,%edi
+  8016c9:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8016cb:	5b                   	pop    %ebx
+  8016cc:	5e                   	pop    %esi
+  8016cd:	5f                   	pop    %edi
+  8016ce:	5d                   	pop    %ebp
+  8016cf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+  8016e6:	8d 35 ee 16 80 00    	lea    0x8016ee,%esi
+  8016ec:	0f 34                	sysenter
+  8016ee:	5d                   	pop    %ebp
+		goto out;
+  8016ef:	eb da                	jmp    8016cb <sys_meminfo+0x26>
+
+008016f1 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	57                   	push   %edi
+  8016f5:	56                   	push   %esi
+  8016f6:	53                   	push   %ebx
+  8016f7:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8016fa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8016fe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801705:	74 1f                	je     801726 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801707:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170c:	b8 22 00 00 00       	mov    $0x22,%eax
+  801711:	8b 55 08             	mov    0x8(%ebp),%edx
+  801714:	89 df                	mov    %ebx,%edi
+  801716:	89 de                	mov    %ebx,%esi
+  801718:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80171a:	85 c0                	test   %eax,%eax
+  80171c:	7f 25                	jg     801743 <sys_env_set_ksm+0x52>
+}
+  80171e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801721:	5b                   	pop    %ebx
+  801722:	5e                   	pop    %esi
+  801723:	5f                   	pop    %edi
+  801724:	5d                   	pop    %ebp
+  801725:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801726:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801733:	89 df                	mov    %ebx,%edi
+  801735:	55                   	push   %ebp
+  801736:	89 e5                	mov    %esp,%ebp
+  801738:	8d 35 40 17 80 00    	lea    0x801740,%esi
+  80173e:	0f 34                	sysenter
+  801740:	5d                   	pop    %ebp
+		goto out;
+  801741:	eb d7                	jmp    80171a <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801743:	83 ec 0c             	sub    $0xc,%esp
+  801746:	50                   	push   %eax
+  801747:	6a 22                	push   $0x22
+  801749:	68 eb 38 80 00       	push   $0x8038eb
+  80174e:	6a 3f                	push   $0x3f
+  801750:	68 08 39 80 00       	push   $0x803908
+  801755:	e8 6c eb ff ff       	call   8002c6 <_panic>
+
+0080175a <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80175a:	55                   	push   %ebp
+  80175b:	89 e5                	mov    %esp,%ebp
+  80175d:	57                   	push   %edi
+  80175e:	56                   	push   %esi
+  80175f:	53                   	push   %ebx
+  801760:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801763:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801766:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80176d:	74 24                	je     801793 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80176f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801774:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801779:	89 cb                	mov    %ecx,%ebx
+  80177b:	89 cf                	mov    %ecx,%edi
+  80177d:	89 ce                	mov    %ecx,%esi
+  80177f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801781:	85 c0                	test   %eax,%eax
+  801783:	7f 2a                	jg     8017af <sys_time_nsec+0x55>
+	return ns;
+}
+  801785:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801788:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80178b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178e:	5b                   	pop    %ebx
+  80178f:	5e                   	pop    %esi
+  801790:	5f                   	pop    %edi
+  801791:	5d                   	pop    %ebp
+  801792:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801793:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801798:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80179d:	89 cb                	mov    %ecx,%ebx
+  80179f:	89 cf                	mov    %ecx,%edi
+  8017a1:	55                   	push   %ebp
+  8017a2:	89 e5                	mov    %esp,%ebp
+  8017a4:	8d 35 ac 17 80 00    	lea    0x8017ac,%esi
+  8017aa:	0f 34                	sysenter
+  8017ac:	5d                   	pop    %ebp
+		goto out;
+  8017ad:	eb d2                	jmp    801781 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017af:	83 ec 0c             	sub    $0xc,%esp
+  8017b2:	50                   	push   %eax
+  8017b3:	6a 0f                	push   $0xf
+  8017b5:	68 eb 38 80 00       	push   $0x8038eb
+  8017ba:	6a 3f                	push   $0x3f
+  8017bc:	68 08 39 80 00       	push   $0x803908
+  8017c1:	e8 00 eb ff ff       	call   8002c6 <_panic>
+
+008017c6 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8017c6:	55                   	push   %ebp
+  8017c7:	89 e5                	mov    %esp,%ebp
+  8017c9:	57                   	push   %edi
+  8017ca:	56                   	push   %esi
+  8017cb:	53                   	push   %ebx
+  8017cc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017cf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017d6:	74 22                	je     8017fa <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8017d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017dd:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e8:	89 df                	mov    %ebx,%edi
+  8017ea:	89 de                	mov    %ebx,%esi
+  8017ec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	7f 28                	jg     80181a <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8017f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f5:	5b                   	pop    %ebx
+  8017f6:	5e                   	pop    %esi
+  8017f7:	5f                   	pop    %edi
+  8017f8:	5d                   	pop    %ebp
+  8017f9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801802:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801805:	b8 12 00 00 00       	mov    $0x12,%eax
+  80180a:	89 df                	mov    %ebx,%edi
+  80180c:	55                   	push   %ebp
+  80180d:	89 e5                	mov    %esp,%ebp
+  80180f:	8d 35 17 18 80 00    	lea    0x801817,%esi
+  801815:	0f 34                	sysenter
+  801817:	5d                   	pop    %ebp
+		goto out;
+  801818:	eb d4                	jmp    8017ee <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80181a:	83 ec 0c             	sub    $0xc,%esp
+  80181d:	50                   	push   %eax
+  80181e:	6a 12                	push   $0x12
+  801820:	68 eb 38 80 00       	push   $0x8038eb
+  801825:	6a 3f                	push   $0x3f
+  801827:	68 08 39 80 00       	push   $0x803908
+  80182c:	e8 95 ea ff ff       	call   8002c6 <_panic>
+
+00801831 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	57                   	push   %edi
+  801835:	56                   	push   %esi
+  801836:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801837:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80183e:	74 1b                	je     80185b <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801840:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801845:	b8 13 00 00 00       	mov    $0x13,%eax
+  80184a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801850:	89 df                	mov    %ebx,%edi
+  801852:	89 de                	mov    %ebx,%esi
+  801854:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801856:	5b                   	pop    %ebx
+  801857:	5e                   	pop    %esi
+  801858:	5f                   	pop    %edi
+  801859:	5d                   	pop    %ebp
+  80185a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80185b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801860:	8b 55 08             	mov    0x8(%ebp),%edx
+  801863:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801866:	b8 13 00 00 00       	mov    $0x13,%eax
+  80186b:	89 df                	mov    %ebx,%edi
+  80186d:	55                   	push   %ebp
+  80186e:	89 e5                	mov    %esp,%ebp
+  801870:	8d 35 78 18 80 00    	lea    0x801878,%esi
+  801876:	0f 34                	sysenter
+  801878:	5d                   	pop    %ebp
+		goto out;
+  801879:	eb db                	jmp    801856 <sys_e1000_receive+0x25>
+
+0080187b <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80187b:	55                   	push   %ebp
+  80187c:	89 e5                	mov    %esp,%ebp
+  80187e:	57                   	push   %edi
+  80187f:	56                   	push   %esi
+  801880:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801881:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801888:	74 1b                	je     8018a5 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80188a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188f:	b8 14 00 00 00       	mov    $0x14,%eax
+  801894:	8b 55 08             	mov    0x8(%ebp),%edx
+  801897:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189a:	89 df                	mov    %ebx,%edi
+  80189c:	89 de                	mov    %ebx,%esi
+  80189e:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8018a0:	5b                   	pop    %ebx
+  8018a1:	5e                   	pop    %esi
+  8018a2:	5f                   	pop    %edi
+  8018a3:	5d                   	pop    %ebp
+  8018a4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8018b5:	89 df                	mov    %ebx,%edi
+  8018b7:	55                   	push   %ebp
+  8018b8:	89 e5                	mov    %esp,%ebp
+  8018ba:	8d 35 c2 18 80 00    	lea    0x8018c2,%esi
+  8018c0:	0f 34                	sysenter
+  8018c2:	5d                   	pop    %ebp
+		goto out;
+  8018c3:	eb db                	jmp    8018a0 <sys_e1000_read_hwaddr+0x25>
+
+008018c5 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8018c5:	55                   	push   %ebp
+  8018c6:	89 e5                	mov    %esp,%ebp
+  8018c8:	57                   	push   %edi
+  8018c9:	56                   	push   %esi
+  8018ca:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018cb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018d2:	74 1a                	je     8018ee <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8018d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018d9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e1:	89 cb                	mov    %ecx,%ebx
+  8018e3:	89 cf                	mov    %ecx,%edi
+  8018e5:	89 ce                	mov    %ecx,%esi
+  8018e7:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8018e9:	5b                   	pop    %ebx
+  8018ea:	5e                   	pop    %esi
+  8018eb:	5f                   	pop    %edi
+  8018ec:	5d                   	pop    %ebp
+  8018ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018f6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018fb:	89 cb                	mov    %ecx,%ebx
+  8018fd:	89 cf                	mov    %ecx,%edi
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+  801902:	8d 35 0a 19 80 00    	lea    0x80190a,%esi
+  801908:	0f 34                	sysenter
+  80190a:	5d                   	pop    %ebp
+		goto out;
+  80190b:	eb dc                	jmp    8018e9 <sys_sb16_read_version+0x24>
+
+0080190d <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+  801910:	57                   	push   %edi
+  801911:	56                   	push   %esi
+  801912:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801913:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80191a:	74 1b                	je     801937 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80191c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801921:	b8 16 00 00 00       	mov    $0x16,%eax
+  801926:	8b 55 08             	mov    0x8(%ebp),%edx
+  801929:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80192c:	89 df                	mov    %ebx,%edi
+  80192e:	89 de                	mov    %ebx,%esi
+  801930:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801932:	5b                   	pop    %ebx
+  801933:	5e                   	pop    %esi
+  801934:	5f                   	pop    %edi
+  801935:	5d                   	pop    %ebp
+  801936:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801937:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801942:	b8 16 00 00 00       	mov    $0x16,%eax
+  801947:	89 df                	mov    %ebx,%edi
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	8d 35 54 19 80 00    	lea    0x801954,%esi
+  801952:	0f 34                	sysenter
+  801954:	5d                   	pop    %ebp
+		goto out;
+  801955:	eb db                	jmp    801932 <sys_sb16_play+0x25>
+
+00801957 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801957:	55                   	push   %ebp
+  801958:	89 e5                	mov    %esp,%ebp
+  80195a:	53                   	push   %ebx
+  80195b:	83 ec 04             	sub    $0x4,%esp
+  80195e:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801960:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801967:	f6 c4 04             	test   $0x4,%ah
+  80196a:	74 0c                	je     801978 <dupperm+0x21>
+  80196c:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801973:	f6 c4 08             	test   $0x8,%ah
+  801976:	75 62                	jne    8019da <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801978:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  80197f:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801984:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80198a:	74 19                	je     8019a5 <dupperm+0x4e>
+  80198c:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801993:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801998:	83 f8 01             	cmp    $0x1,%eax
+  80199b:	19 c0                	sbb    %eax,%eax
+  80199d:	25 00 08 00 00       	and    $0x800,%eax
+  8019a2:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  8019a5:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  8019ac:	89 c1                	mov    %eax,%ecx
+  8019ae:	80 cd 04             	or     $0x4,%ch
+  8019b1:	f6 c7 04             	test   $0x4,%bh
+  8019b4:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  8019b7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8019be:	f6 c1 02             	test   $0x2,%cl
+  8019c1:	74 12                	je     8019d5 <dupperm+0x7e>
+  8019c3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  8019ca:	89 c2                	mov    %eax,%edx
+  8019cc:	83 ca 02             	or     $0x2,%edx
+  8019cf:	f6 c5 04             	test   $0x4,%ch
+  8019d2:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  8019d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d8:	c9                   	leave
+  8019d9:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8019da:	68 18 39 80 00       	push   $0x803918
+  8019df:	68 b0 39 80 00       	push   $0x8039b0
+  8019e4:	6a 39                	push   $0x39
+  8019e6:	68 c5 39 80 00       	push   $0x8039c5
+  8019eb:	e8 d6 e8 ff ff       	call   8002c6 <_panic>
+
+008019f0 <pgfault>:
+{
+  8019f0:	55                   	push   %ebp
+  8019f1:	89 e5                	mov    %esp,%ebp
+  8019f3:	53                   	push   %ebx
+  8019f4:	83 ec 04             	sub    $0x4,%esp
+  8019f7:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8019fa:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8019fc:	89 c3                	mov    %eax,%ebx
+  8019fe:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801a04:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801a08:	74 6d                	je     801a77 <pgfault+0x87>
+  801a0a:	89 da                	mov    %ebx,%edx
+  801a0c:	c1 ea 16             	shr    $0x16,%edx
+  801a0f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a16:	f6 c2 80             	test   $0x80,%dl
+  801a19:	75 5c                	jne    801a77 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801a1b:	c1 e8 0c             	shr    $0xc,%eax
+  801a1e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801a25:	f6 c4 08             	test   $0x8,%ah
+  801a28:	74 4d                	je     801a77 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801a2a:	83 ec 04             	sub    $0x4,%esp
+  801a2d:	6a 07                	push   $0x7
+  801a2f:	68 00 f0 7f 00       	push   $0x7ff000
+  801a34:	6a 00                	push   $0x0
+  801a36:	e8 a6 f4 ff ff       	call   800ee1 <sys_page_alloc>
+  801a3b:	83 c4 10             	add    $0x10,%esp
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 49                	js     801a8b <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801a42:	83 ec 04             	sub    $0x4,%esp
+  801a45:	68 00 10 00 00       	push   $0x1000
+  801a4a:	53                   	push   %ebx
+  801a4b:	68 00 f0 7f 00       	push   $0x7ff000
+  801a50:	e8 1a f1 ff ff       	call   800b6f <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801a55:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801a5c:	53                   	push   %ebx
+  801a5d:	6a 00                	push   $0x0
+  801a5f:	68 00 f0 7f 00       	push   $0x7ff000
+  801a64:	6a 00                	push   $0x0
+  801a66:	e8 e3 f4 ff ff       	call   800f4e <sys_page_map>
+  801a6b:	83 c4 20             	add    $0x20,%esp
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	78 2d                	js     801a9f <pgfault+0xaf>
+}
+  801a72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a75:	c9                   	leave
+  801a76:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801a77:	83 ec 04             	sub    $0x4,%esp
+  801a7a:	68 d0 39 80 00       	push   $0x8039d0
+  801a7f:	6a 1e                	push   $0x1e
+  801a81:	68 c5 39 80 00       	push   $0x8039c5
+  801a86:	e8 3b e8 ff ff       	call   8002c6 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801a8b:	83 ec 04             	sub    $0x4,%esp
+  801a8e:	68 4c 39 80 00       	push   $0x80394c
+  801a93:	6a 29                	push   $0x29
+  801a95:	68 c5 39 80 00       	push   $0x8039c5
+  801a9a:	e8 27 e8 ff ff       	call   8002c6 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801a9f:	50                   	push   %eax
+  801aa0:	68 80 39 80 00       	push   $0x803980
+  801aa5:	6a 2e                	push   $0x2e
+  801aa7:	68 c5 39 80 00       	push   $0x8039c5
+  801aac:	e8 15 e8 ff ff       	call   8002c6 <_panic>
+
+00801ab1 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801ab1:	55                   	push   %ebp
+  801ab2:	89 e5                	mov    %esp,%ebp
+  801ab4:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801ab7:	ff 75 0c             	push   0xc(%ebp)
+  801aba:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801abd:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ac4:	e8 23 f3 ff ff       	call   800dec <sys_env_destroy>
+}
+  801ac9:	83 c4 10             	add    $0x10,%esp
+  801acc:	c9                   	leave
+  801acd:	c3                   	ret
+
+00801ace <ufork>:
+{
+  801ace:	55                   	push   %ebp
+  801acf:	89 e5                	mov    %esp,%ebp
+  801ad1:	57                   	push   %edi
+  801ad2:	56                   	push   %esi
+  801ad3:	53                   	push   %ebx
+  801ad4:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801ada:	b8 07 00 00 00       	mov    $0x7,%eax
+  801adf:	cd 30                	int    $0x30
+  801ae1:	89 c6                	mov    %eax,%esi
+  801ae3:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	78 56                	js     801b43 <ufork+0x75>
+	if (pid > 0) {
+  801aed:	0f 8e b3 02 00 00    	jle    801da6 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801af3:	83 ec 0c             	sub    $0xc,%esp
+  801af6:	68 f0 19 80 00       	push   $0x8019f0
+  801afb:	e8 d8 18 00 00       	call   8033d8 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801b00:	83 c4 08             	add    $0x8,%esp
+  801b03:	68 3f 34 80 00       	push   $0x80343f
+  801b08:	56                   	push   %esi
+  801b09:	e8 ef f5 ff ff       	call   8010fd <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801b0e:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801b14:	89 1c 24             	mov    %ebx,(%esp)
+  801b17:	e8 a1 04 00 00       	call   801fbd <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801b1c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801b23:	6a 07                	push   $0x7
+  801b25:	68 00 f0 bf ee       	push   $0xeebff000
+  801b2a:	56                   	push   %esi
+  801b2b:	53                   	push   %ebx
+  801b2c:	e8 0d 06 00 00       	call   80213e <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b31:	83 c4 20             	add    $0x20,%esp
+  801b34:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b39:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801b3f:	89 fe                	mov    %edi,%esi
+  801b41:	eb 22                	jmp    801b65 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801b43:	50                   	push   %eax
+  801b44:	68 e9 39 80 00       	push   $0x8039e9
+  801b49:	68 a9 00 00 00       	push   $0xa9
+  801b4e:	68 c5 39 80 00       	push   $0x8039c5
+  801b53:	e8 6e e7 ff ff       	call   8002c6 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b58:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b5e:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b63:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b65:	89 f7                	mov    %esi,%edi
+  801b67:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801b6d:	0f 87 e9 01 00 00    	ja     801d5c <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801b73:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801b79:	85 f6                	test   %esi,%esi
+  801b7b:	0f 49 d6             	cmovns %esi,%edx
+  801b7e:	c1 fa 0a             	sar    $0xa,%edx
+  801b81:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801b88:	f6 c1 01             	test   $0x1,%cl
+  801b8b:	74 cb                	je     801b58 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801b8d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b94:	f6 c2 80             	test   $0x80,%dl
+  801b97:	75 17                	jne    801bb0 <ufork+0xe2>
+			j = i + 1;
+  801b99:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801b9c:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801ba3:	f6 c2 01             	test   $0x1,%dl
+  801ba6:	0f 85 f3 00 00 00    	jne    801c9f <ufork+0x1d1>
+			j = i + 1;
+  801bac:	89 de                	mov    %ebx,%esi
+  801bae:	eb b5                	jmp    801b65 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801bb0:	89 fb                	mov    %edi,%ebx
+  801bb2:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801bb5:	89 d8                	mov    %ebx,%eax
+  801bb7:	c1 e8 16             	shr    $0x16,%eax
+  801bba:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bc1:	89 c2                	mov    %eax,%edx
+  801bc3:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801bc9:	25 02 04 00 00       	and    $0x402,%eax
+  801bce:	83 f8 02             	cmp    $0x2,%eax
+  801bd1:	74 31                	je     801c04 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801bd3:	83 ec 04             	sub    $0x4,%esp
+  801bd6:	6a 01                	push   $0x1
+  801bd8:	52                   	push   %edx
+  801bd9:	53                   	push   %ebx
+  801bda:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801be0:	53                   	push   %ebx
+  801be1:	6a 00                	push   $0x0
+  801be3:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801be9:	50                   	push   %eax
+  801bea:	e8 7a 05 00 00       	call   802169 <batch_map>
+		return;
+  801bef:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801bf2:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801bf8:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801bfd:	89 c6                	mov    %eax,%esi
+				continue;
+  801bff:	e9 61 ff ff ff       	jmp    801b65 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801c04:	83 ec 04             	sub    $0x4,%esp
+  801c07:	80 ca 80             	or     $0x80,%dl
+  801c0a:	52                   	push   %edx
+  801c0b:	53                   	push   %ebx
+  801c0c:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c12:	e8 ca f2 ff ff       	call   800ee1 <sys_page_alloc>
+  801c17:	83 c4 10             	add    $0x10,%esp
+  801c1a:	85 c0                	test   %eax,%eax
+  801c1c:	78 5d                	js     801c7b <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801c1e:	83 ec 0c             	sub    $0xc,%esp
+  801c21:	6a 07                	push   $0x7
+  801c23:	68 00 00 40 00       	push   $0x400000
+  801c28:	6a 00                	push   $0x0
+  801c2a:	53                   	push   %ebx
+  801c2b:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c31:	e8 18 f3 ff ff       	call   800f4e <sys_page_map>
+  801c36:	83 c4 20             	add    $0x20,%esp
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	78 50                	js     801c8d <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801c3d:	83 ec 04             	sub    $0x4,%esp
+  801c40:	68 00 00 40 00       	push   $0x400000
+  801c45:	53                   	push   %ebx
+  801c46:	68 00 00 40 00       	push   $0x400000
+  801c4b:	e8 1f ef ff ff       	call   800b6f <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801c50:	83 c4 08             	add    $0x8,%esp
+  801c53:	68 00 00 40 00       	push   $0x400000
+  801c58:	6a 00                	push   $0x0
+  801c5a:	e8 5d f3 ff ff       	call   800fbc <sys_page_unmap>
+  801c5f:	83 c4 10             	add    $0x10,%esp
+  801c62:	85 c0                	test   %eax,%eax
+  801c64:	79 8c                	jns    801bf2 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801c66:	50                   	push   %eax
+  801c67:	68 f6 34 80 00       	push   $0x8034f6
+  801c6c:	68 81 00 00 00       	push   $0x81
+  801c71:	68 c5 39 80 00       	push   $0x8039c5
+  801c76:	e8 4b e6 ff ff       	call   8002c6 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801c7b:	50                   	push   %eax
+  801c7c:	68 d2 34 80 00       	push   $0x8034d2
+  801c81:	6a 7c                	push   $0x7c
+  801c83:	68 c5 39 80 00       	push   $0x8039c5
+  801c88:	e8 39 e6 ff ff       	call   8002c6 <_panic>
+		panic("sys_page_map: %e", r);
+  801c8d:	50                   	push   %eax
+  801c8e:	68 e5 34 80 00       	push   $0x8034e5
+  801c93:	6a 7e                	push   $0x7e
+  801c95:	68 c5 39 80 00       	push   $0x8039c5
+  801c9a:	e8 27 e6 ff ff       	call   8002c6 <_panic>
+  801c9f:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801ca5:	eb 22                	jmp    801cc9 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801ca7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cae:	a8 01                	test   $0x1,%al
+  801cb0:	74 35                	je     801ce7 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801cb2:	89 d8                	mov    %ebx,%eax
+  801cb4:	e8 9e fc ff ff       	call   801957 <dupperm>
+  801cb9:	89 c6                	mov    %eax,%esi
+  801cbb:	89 f8                	mov    %edi,%eax
+  801cbd:	e8 95 fc ff ff       	call   801957 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cc2:	39 c6                	cmp    %eax,%esi
+  801cc4:	75 21                	jne    801ce7 <ufork+0x219>
+				j++;
+  801cc6:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cc9:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801ccf:	74 16                	je     801ce7 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801cd1:	89 d8                	mov    %ebx,%eax
+  801cd3:	c1 e8 0a             	shr    $0xa,%eax
+  801cd6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cdd:	25 81 00 00 00       	and    $0x81,%eax
+  801ce2:	83 f8 01             	cmp    $0x1,%eax
+  801ce5:	74 c0                	je     801ca7 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801ce7:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801ced:	89 d8                	mov    %ebx,%eax
+  801cef:	29 f0                	sub    %esi,%eax
+  801cf1:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801cf7:	89 fe                	mov    %edi,%esi
+  801cf9:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801cfc:	89 f8                	mov    %edi,%eax
+  801cfe:	e8 54 fc ff ff       	call   801957 <dupperm>
+  801d03:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801d05:	83 ec 08             	sub    $0x8,%esp
+  801d08:	6a 02                	push   $0x2
+  801d0a:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d10:	51                   	push   %ecx
+  801d11:	e8 15 03 00 00       	call   80202b <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801d16:	83 c4 0c             	add    $0xc,%esp
+  801d19:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d1f:	57                   	push   %edi
+  801d20:	56                   	push   %esi
+  801d21:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801d27:	56                   	push   %esi
+  801d28:	6a 00                	push   $0x0
+  801d2a:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d30:	51                   	push   %ecx
+  801d31:	e8 33 04 00 00       	call   802169 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801d36:	83 c4 1c             	add    $0x1c,%esp
+  801d39:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d3f:	57                   	push   %edi
+  801d40:	56                   	push   %esi
+  801d41:	6a 00                	push   $0x0
+  801d43:	56                   	push   %esi
+  801d44:	6a 00                	push   $0x0
+  801d46:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d4c:	50                   	push   %eax
+  801d4d:	e8 17 04 00 00       	call   802169 <batch_map>
+	return 0;
+  801d52:	83 c4 20             	add    $0x20,%esp
+  801d55:	89 de                	mov    %ebx,%esi
+  801d57:	e9 09 fe ff ff       	jmp    801b65 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801d5c:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801d62:	83 ec 04             	sub    $0x4,%esp
+  801d65:	6a 02                	push   $0x2
+  801d67:	56                   	push   %esi
+  801d68:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d6e:	53                   	push   %ebx
+  801d6f:	e8 49 04 00 00       	call   8021bd <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801d74:	89 1c 24             	mov    %ebx,(%esp)
+  801d77:	e8 5d 02 00 00       	call   801fd9 <batch_flush>
+  801d7c:	83 c4 10             	add    $0x10,%esp
+  801d7f:	85 c0                	test   %eax,%eax
+  801d81:	78 0e                	js     801d91 <ufork+0x2c3>
+}
+  801d83:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801d89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d8c:	5b                   	pop    %ebx
+  801d8d:	5e                   	pop    %esi
+  801d8e:	5f                   	pop    %edi
+  801d8f:	5d                   	pop    %ebp
+  801d90:	c3                   	ret
+			panic("fork: %e", r);
+  801d91:	50                   	push   %eax
+  801d92:	68 f0 39 80 00       	push   $0x8039f0
+  801d97:	68 d7 00 00 00       	push   $0xd7
+  801d9c:	68 c5 39 80 00       	push   $0x8039c5
+  801da1:	e8 20 e5 ff ff       	call   8002c6 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801da6:	e8 aa f0 ff ff       	call   800e55 <sys_getenvid>
+  801dab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801db0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801db6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801dbb:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801dc0:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801dc7:	00 00 00 
+  801dca:	eb b7                	jmp    801d83 <ufork+0x2b5>
+
+00801dcc <fork>:
+{
+  801dcc:	55                   	push   %ebp
+  801dcd:	89 e5                	mov    %esp,%ebp
+  801dcf:	53                   	push   %ebx
+  801dd0:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801dd3:	68 f0 19 80 00       	push   $0x8019f0
+  801dd8:	e8 fb 15 00 00       	call   8033d8 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801ddd:	e8 7a f6 ff ff       	call   80145c <sys_fork>
+  801de2:	89 c3                	mov    %eax,%ebx
+  801de4:	83 c4 10             	add    $0x10,%esp
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 09                	js     801df4 <fork+0x28>
+	if (pid == 0)
+  801deb:	74 1c                	je     801e09 <fork+0x3d>
+}
+  801ded:	89 d8                	mov    %ebx,%eax
+  801def:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801df4:	50                   	push   %eax
+  801df5:	68 e9 39 80 00       	push   $0x8039e9
+  801dfa:	68 ed 00 00 00       	push   $0xed
+  801dff:	68 c5 39 80 00       	push   $0x8039c5
+  801e04:	e8 bd e4 ff ff       	call   8002c6 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801e09:	e8 47 f0 ff ff       	call   800e55 <sys_getenvid>
+  801e0e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e13:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e19:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801e1e:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801e23:	eb c8                	jmp    801ded <fork+0x21>
+
+00801e25 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801e25:	55                   	push   %ebp
+  801e26:	89 e5                	mov    %esp,%ebp
+  801e28:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801e2b:	ff 75 0c             	push   0xc(%ebp)
+  801e2e:	ff 75 08             	push   0x8(%ebp)
+  801e31:	68 b1 1a 80 00       	push   $0x801ab1
+  801e36:	e8 67 f6 ff ff       	call   8014a2 <sys_thread_create>
+}
+  801e3b:	c9                   	leave
+  801e3c:	c3                   	ret
+
+00801e3d <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801e3d:	55                   	push   %ebp
+  801e3e:	89 e5                	mov    %esp,%ebp
+  801e40:	56                   	push   %esi
+  801e41:	53                   	push   %ebx
+  801e42:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801e52:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801e55:	83 ec 08             	sub    $0x8,%esp
+  801e58:	ff 75 14             	push   0x14(%ebp)
+  801e5b:	50                   	push   %eax
+  801e5c:	e8 91 f4 ff ff       	call   8012f2 <sys_ipc_recv_until>
+  801e61:	83 c4 10             	add    $0x10,%esp
+  801e64:	85 c0                	test   %eax,%eax
+  801e66:	78 61                	js     801ec9 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801e68:	85 f6                	test   %esi,%esi
+  801e6a:	74 1c                	je     801e88 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801e6c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e6e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e73:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e79:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e7e:	76 5f                	jbe    801edf <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801e80:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801e86:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801e88:	85 db                	test   %ebx,%ebx
+  801e8a:	74 1c                	je     801ea8 <ipc_recv_until+0x6b>
+  801e8c:	89 e0                	mov    %esp,%eax
+  801e8e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e93:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e99:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e9e:	76 50                	jbe    801ef0 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801ea0:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801ea6:	89 03                	mov    %eax,(%ebx)
+  801ea8:	89 e0                	mov    %esp,%eax
+  801eaa:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801eaf:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801eb5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801eba:	76 45                	jbe    801f01 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801ebc:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801ec2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec5:	5b                   	pop    %ebx
+  801ec6:	5e                   	pop    %esi
+  801ec7:	5d                   	pop    %ebp
+  801ec8:	c3                   	ret
+		if (from_env_store)
+  801ec9:	85 f6                	test   %esi,%esi
+  801ecb:	74 06                	je     801ed3 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801ecd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801ed3:	85 db                	test   %ebx,%ebx
+  801ed5:	74 eb                	je     801ec2 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801ed7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801edd:	eb e3                	jmp    801ec2 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801edf:	c1 e8 10             	shr    $0x10,%eax
+  801ee2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ee8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801eee:	eb 90                	jmp    801e80 <ipc_recv_until+0x43>
+  801ef0:	c1 e8 10             	shr    $0x10,%eax
+  801ef3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ef9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801eff:	eb 9f                	jmp    801ea0 <ipc_recv_until+0x63>
+  801f01:	c1 e8 10             	shr    $0x10,%eax
+  801f04:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f0a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f10:	eb aa                	jmp    801ebc <ipc_recv_until+0x7f>
+
+00801f12 <ipc_recv>:
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801f18:	6a 00                	push   $0x0
+  801f1a:	ff 75 10             	push   0x10(%ebp)
+  801f1d:	ff 75 0c             	push   0xc(%ebp)
+  801f20:	ff 75 08             	push   0x8(%ebp)
+  801f23:	e8 15 ff ff ff       	call   801e3d <ipc_recv_until>
+}
+  801f28:	c9                   	leave
+  801f29:	c3                   	ret
+
+00801f2a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	57                   	push   %edi
+  801f2e:	56                   	push   %esi
+  801f2f:	53                   	push   %ebx
+  801f30:	83 ec 0c             	sub    $0xc,%esp
+  801f33:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f36:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801f3c:	85 db                	test   %ebx,%ebx
+  801f3e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f43:	0f 44 d8             	cmove  %eax,%ebx
+  801f46:	eb 05                	jmp    801f4d <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801f48:	e8 4e ef ff ff       	call   800e9b <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801f4d:	ff 75 14             	push   0x14(%ebp)
+  801f50:	53                   	push   %ebx
+  801f51:	56                   	push   %esi
+  801f52:	57                   	push   %edi
+  801f53:	e8 e6 f2 ff ff       	call   80123e <sys_ipc_try_send>
+  801f58:	83 c4 10             	add    $0x10,%esp
+  801f5b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f5e:	74 e8                	je     801f48 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	78 08                	js     801f6c <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f67:	5b                   	pop    %ebx
+  801f68:	5e                   	pop    %esi
+  801f69:	5f                   	pop    %edi
+  801f6a:	5d                   	pop    %ebp
+  801f6b:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801f6c:	50                   	push   %eax
+  801f6d:	68 f9 39 80 00       	push   $0x8039f9
+  801f72:	6a 4f                	push   $0x4f
+  801f74:	68 0c 3a 80 00       	push   $0x803a0c
+  801f79:	e8 48 e3 ff ff       	call   8002c6 <_panic>
+
+00801f7e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801f7e:	55                   	push   %ebp
+  801f7f:	89 e5                	mov    %esp,%ebp
+  801f81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801f84:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801f89:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801f8f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801f95:	8b 52 50             	mov    0x50(%edx),%edx
+  801f98:	39 ca                	cmp    %ecx,%edx
+  801f9a:	74 11                	je     801fad <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801f9c:	83 c0 01             	add    $0x1,%eax
+  801f9f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801fa4:	75 e3                	jne    801f89 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fab:	eb 0e                	jmp    801fbb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801fad:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801fb3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fb8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801fbb:	5d                   	pop    %ebp
+  801fbc:	c3                   	ret
+
+00801fbd <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801fbd:	55                   	push   %ebp
+  801fbe:	89 e5                	mov    %esp,%ebp
+  801fc0:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801fc3:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801fca:	00 00 00 
+	b->b_error = 0;
+  801fcd:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801fd4:	00 00 00 
+}
+  801fd7:	5d                   	pop    %ebp
+  801fd8:	c3                   	ret
+
+00801fd9 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801fd9:	55                   	push   %ebp
+  801fda:	89 e5                	mov    %esp,%ebp
+  801fdc:	53                   	push   %ebx
+  801fdd:	83 ec 04             	sub    $0x4,%esp
+  801fe0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801fe3:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	7e 09                	jle    801ff6 <batch_flush+0x1d>
+  801fed:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801ff4:	74 15                	je     80200b <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801ff6:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801ffd:	00 00 00 
+	return b->b_error;
+  802000:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  802006:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802009:	c9                   	leave
+  80200a:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  80200b:	83 ec 08             	sub    $0x8,%esp
+  80200e:	50                   	push   %eax
+  80200f:	53                   	push   %ebx
+  802010:	e8 b2 f5 ff ff       	call   8015c7 <sys_batch>
+  802015:	83 c4 10             	add    $0x10,%esp
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	79 da                	jns    801ff6 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  80201c:	f7 d8                	neg    %eax
+  80201e:	0f b6 c0             	movzbl %al,%eax
+  802021:	f7 d8                	neg    %eax
+  802023:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  802029:	eb cb                	jmp    801ff6 <batch_flush+0x1d>
+
+0080202b <batch_reserve>:
+{
+  80202b:	55                   	push   %ebp
+  80202c:	89 e5                	mov    %esp,%ebp
+  80202e:	83 ec 08             	sub    $0x8,%esp
+  802031:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  802034:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  80203a:	03 45 0c             	add    0xc(%ebp),%eax
+  80203d:	83 f8 10             	cmp    $0x10,%eax
+  802040:	7f 02                	jg     802044 <batch_reserve+0x19>
+}
+  802042:	c9                   	leave
+  802043:	c3                   	ret
+		batch_flush(b);
+  802044:	83 ec 0c             	sub    $0xc,%esp
+  802047:	52                   	push   %edx
+  802048:	e8 8c ff ff ff       	call   801fd9 <batch_flush>
+  80204d:	83 c4 10             	add    $0x10,%esp
+}
+  802050:	eb f0                	jmp    802042 <batch_reserve+0x17>
+
+00802052 <batch_next>:
+{
+  802052:	55                   	push   %ebp
+  802053:	89 e5                	mov    %esp,%ebp
+  802055:	53                   	push   %ebx
+  802056:	83 ec 04             	sub    $0x4,%esp
+  802059:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  80205b:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  802062:	74 28                	je     80208c <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  802064:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  80206a:	8d 50 01             	lea    0x1(%eax),%edx
+  80206d:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  802073:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802076:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  802078:	83 ec 04             	sub    $0x4,%esp
+  80207b:	6a 1c                	push   $0x1c
+  80207d:	6a 00                	push   $0x0
+  80207f:	53                   	push   %ebx
+  802080:	e8 b5 ea ff ff       	call   800b3a <memset>
+}
+  802085:	89 d8                	mov    %ebx,%eax
+  802087:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80208a:	c9                   	leave
+  80208b:	c3                   	ret
+		batch_flush(b);
+  80208c:	83 ec 0c             	sub    $0xc,%esp
+  80208f:	50                   	push   %eax
+  802090:	e8 44 ff ff ff       	call   801fd9 <batch_flush>
+  802095:	83 c4 10             	add    $0x10,%esp
+  802098:	eb ca                	jmp    802064 <batch_next+0x12>
+
+0080209a <batch_page>:
+{
+  80209a:	55                   	push   %ebp
+  80209b:	89 e5                	mov    %esp,%ebp
+  80209d:	57                   	push   %edi
+  80209e:	56                   	push   %esi
+  80209f:	53                   	push   %ebx
+  8020a0:	83 ec 1c             	sub    $0x1c,%esp
+  8020a3:	89 d3                	mov    %edx,%ebx
+  8020a5:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  8020a7:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  8020ad:	85 d2                	test   %edx,%edx
+  8020af:	74 50                	je     802101 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  8020b1:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  8020b4:	01 c1                	add    %eax,%ecx
+  8020b6:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  8020b9:	75 46                	jne    802101 <batch_page+0x67>
+  8020bb:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  8020be:	75 41                	jne    802101 <batch_page+0x67>
+  8020c0:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  8020c3:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  8020c6:	75 39                	jne    802101 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  8020c8:	83 ea 01             	sub    $0x1,%edx
+  8020cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020ce:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020d1:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  8020d5:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8020d8:	75 27                	jne    802101 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8020da:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020dd:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8020e1:	89 fa                	mov    %edi,%edx
+  8020e3:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020e6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8020e9:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020ec:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8020ef:	75 10                	jne    802101 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020f1:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8020f5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8020f8:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8020fc:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8020ff:	74 2a                	je     80212b <batch_page+0x91>
+	op = batch_next(b);
+  802101:	e8 4c ff ff ff       	call   802052 <batch_next>
+	op->bo_op = opcode;
+  802106:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  802108:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  80210b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80210e:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802111:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802114:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  802117:	8b 75 10             	mov    0x10(%ebp),%esi
+  80211a:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  80211d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802120:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802123:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802126:	89 78 14             	mov    %edi,0x14(%eax)
+  802129:	eb 0b                	jmp    802136 <batch_page+0x9c>
+		op->bo_npages += npages;
+  80212b:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  80212f:	03 7d 18             	add    0x18(%ebp),%edi
+  802132:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802136:	83 c4 1c             	add    $0x1c,%esp
+  802139:	5b                   	pop    %ebx
+  80213a:	5e                   	pop    %esi
+  80213b:	5f                   	pop    %edi
+  80213c:	5d                   	pop    %ebp
+  80213d:	c3                   	ret
+
+0080213e <batch_alloc>:
+{
+  80213e:	55                   	push   %ebp
+  80213f:	89 e5                	mov    %esp,%ebp
+  802141:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802144:	ff 75 18             	push   0x18(%ebp)
+  802147:	ff 75 14             	push   0x14(%ebp)
+  80214a:	ff 75 10             	push   0x10(%ebp)
+  80214d:	ff 75 0c             	push   0xc(%ebp)
+  802150:	6a 00                	push   $0x0
+  802152:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80215f:	e8 36 ff ff ff       	call   80209a <batch_page>
+}
+  802164:	83 c4 20             	add    $0x20,%esp
+  802167:	c9                   	leave
+  802168:	c3                   	ret
+
+00802169 <batch_map>:
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  80216f:	ff 75 20             	push   0x20(%ebp)
+  802172:	ff 75 1c             	push   0x1c(%ebp)
+  802175:	ff 75 18             	push   0x18(%ebp)
+  802178:	ff 75 14             	push   0x14(%ebp)
+  80217b:	ff 75 10             	push   0x10(%ebp)
+  80217e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802181:	ba 01 00 00 00       	mov    $0x1,%edx
+  802186:	8b 45 08             	mov    0x8(%ebp),%eax
+  802189:	e8 0c ff ff ff       	call   80209a <batch_page>
+}
+  80218e:	83 c4 20             	add    $0x20,%esp
+  802191:	c9                   	leave
+  802192:	c3                   	ret
+
+00802193 <batch_unmap>:
+{
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  802199:	ff 75 14             	push   0x14(%ebp)
+  80219c:	6a 00                	push   $0x0
+  80219e:	ff 75 10             	push   0x10(%ebp)
+  8021a1:	ff 75 0c             	push   0xc(%ebp)
+  8021a4:	6a 00                	push   $0x0
+  8021a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021ab:	ba 02 00 00 00       	mov    $0x2,%edx
+  8021b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b3:	e8 e2 fe ff ff       	call   80209a <batch_page>
+}
+  8021b8:	83 c4 20             	add    $0x20,%esp
+  8021bb:	c9                   	leave
+  8021bc:	c3                   	ret
+
+008021bd <batch_set_status>:
+{
+  8021bd:	55                   	push   %ebp
+  8021be:	89 e5                	mov    %esp,%ebp
+  8021c0:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8021c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c6:	e8 87 fe ff ff       	call   802052 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8021cb:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8021d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021d4:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8021d7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021da:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8021dd:	c9                   	leave
+  8021de:	c3                   	ret
+
+008021df <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8021df:	55                   	push   %ebp
+  8021e0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8021ea:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8021ed:	5d                   	pop    %ebp
+  8021ee:	c3                   	ret
+
+008021ef <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8021ef:	55                   	push   %ebp
+  8021f0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8021fa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021ff:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802204:	5d                   	pop    %ebp
+  802205:	c3                   	ret
+
+00802206 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802206:	55                   	push   %ebp
+  802207:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802209:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80220e:	eb 02                	jmp    802212 <fd_alloc+0xc>
+  802210:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802212:	89 c2                	mov    %eax,%edx
+  802214:	c1 ea 16             	shr    $0x16,%edx
+  802217:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80221e:	f6 c2 01             	test   $0x1,%dl
+  802221:	74 2b                	je     80224e <fd_alloc+0x48>
+  802223:	89 c2                	mov    %eax,%edx
+  802225:	c1 ea 0c             	shr    $0xc,%edx
+  802228:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80222f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802235:	f6 c1 01             	test   $0x1,%cl
+  802238:	74 14                	je     80224e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80223a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802240:	75 ce                	jne    802210 <fd_alloc+0xa>
+  802242:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802247:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80224c:	eb 05                	jmp    802253 <fd_alloc+0x4d>
+			return 0;
+  80224e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802253:	8b 55 08             	mov    0x8(%ebp),%edx
+  802256:	89 02                	mov    %eax,(%edx)
+}
+  802258:	89 c8                	mov    %ecx,%eax
+  80225a:	5d                   	pop    %ebp
+  80225b:	c3                   	ret
+
+0080225c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80225c:	55                   	push   %ebp
+  80225d:	89 e5                	mov    %esp,%ebp
+  80225f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802262:	83 f8 1f             	cmp    $0x1f,%eax
+  802265:	77 30                	ja     802297 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802267:	c1 e0 0c             	shl    $0xc,%eax
+  80226a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80226f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802275:	f6 c2 01             	test   $0x1,%dl
+  802278:	74 24                	je     80229e <fd_lookup+0x42>
+  80227a:	89 c2                	mov    %eax,%edx
+  80227c:	c1 ea 0c             	shr    $0xc,%edx
+  80227f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802286:	f6 c2 01             	test   $0x1,%dl
+  802289:	74 1a                	je     8022a5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80228b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80228e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802290:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802295:	5d                   	pop    %ebp
+  802296:	c3                   	ret
+		return -E_INVAL;
+  802297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80229c:	eb f7                	jmp    802295 <fd_lookup+0x39>
+		return -E_INVAL;
+  80229e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a3:	eb f0                	jmp    802295 <fd_lookup+0x39>
+  8022a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022aa:	eb e9                	jmp    802295 <fd_lookup+0x39>
+
+008022ac <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8022ac:	55                   	push   %ebp
+  8022ad:	89 e5                	mov    %esp,%ebp
+  8022af:	53                   	push   %ebx
+  8022b0:	83 ec 04             	sub    $0x4,%esp
+  8022b3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8022b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bb:	eb 03                	jmp    8022c0 <dev_lookup+0x14>
+  8022bd:	83 c0 01             	add    $0x1,%eax
+  8022c0:	8b 1c 85 94 3a 80 00 	mov    0x803a94(,%eax,4),%ebx
+  8022c7:	85 db                	test   %ebx,%ebx
+  8022c9:	74 0b                	je     8022d6 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8022cb:	39 13                	cmp    %edx,(%ebx)
+  8022cd:	75 ee                	jne    8022bd <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8022cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d4:	eb 2e                	jmp    802304 <dev_lookup+0x58>
+  8022d6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022d8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022dd:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022e3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8022e8:	76 24                	jbe    80230e <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022ea:	8b 41 48             	mov    0x48(%ecx),%eax
+  8022ed:	83 ec 04             	sub    $0x4,%esp
+  8022f0:	52                   	push   %edx
+  8022f1:	50                   	push   %eax
+  8022f2:	68 18 3a 80 00       	push   $0x803a18
+  8022f7:	e8 a5 e0 ff ff       	call   8003a1 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8022fc:	83 c4 10             	add    $0x10,%esp
+  8022ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802304:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802307:	89 1a                	mov    %ebx,(%edx)
+}
+  802309:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80230c:	c9                   	leave
+  80230d:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80230e:	c1 e8 10             	shr    $0x10,%eax
+  802311:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802317:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80231d:	eb cb                	jmp    8022ea <dev_lookup+0x3e>
+
+0080231f <fd_close>:
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	57                   	push   %edi
+  802323:	56                   	push   %esi
+  802324:	53                   	push   %ebx
+  802325:	83 ec 24             	sub    $0x24,%esp
+  802328:	8b 75 08             	mov    0x8(%ebp),%esi
+  80232b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80232e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802331:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802332:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802338:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80233b:	50                   	push   %eax
+  80233c:	e8 1b ff ff ff       	call   80225c <fd_lookup>
+  802341:	89 c3                	mov    %eax,%ebx
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	85 c0                	test   %eax,%eax
+  802348:	78 05                	js     80234f <fd_close+0x30>
+	    || fd != fd2)
+  80234a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80234d:	74 16                	je     802365 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80234f:	89 f8                	mov    %edi,%eax
+  802351:	84 c0                	test   %al,%al
+  802353:	b8 00 00 00 00       	mov    $0x0,%eax
+  802358:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80235b:	89 d8                	mov    %ebx,%eax
+  80235d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802360:	5b                   	pop    %ebx
+  802361:	5e                   	pop    %esi
+  802362:	5f                   	pop    %edi
+  802363:	5d                   	pop    %ebp
+  802364:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802365:	83 ec 08             	sub    $0x8,%esp
+  802368:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80236b:	50                   	push   %eax
+  80236c:	ff 36                	push   (%esi)
+  80236e:	e8 39 ff ff ff       	call   8022ac <dev_lookup>
+  802373:	89 c3                	mov    %eax,%ebx
+  802375:	83 c4 10             	add    $0x10,%esp
+  802378:	85 c0                	test   %eax,%eax
+  80237a:	78 1a                	js     802396 <fd_close+0x77>
+		if (dev->dev_close)
+  80237c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80237f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802382:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802387:	85 c0                	test   %eax,%eax
+  802389:	74 0b                	je     802396 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80238b:	83 ec 0c             	sub    $0xc,%esp
+  80238e:	56                   	push   %esi
+  80238f:	ff d0                	call   *%eax
+  802391:	89 c3                	mov    %eax,%ebx
+  802393:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802396:	83 ec 08             	sub    $0x8,%esp
+  802399:	56                   	push   %esi
+  80239a:	6a 00                	push   $0x0
+  80239c:	e8 1b ec ff ff       	call   800fbc <sys_page_unmap>
+	return r;
+  8023a1:	83 c4 10             	add    $0x10,%esp
+  8023a4:	eb b5                	jmp    80235b <fd_close+0x3c>
+
+008023a6 <close>:
+
+int
+close(int fdnum)
+{
+  8023a6:	55                   	push   %ebp
+  8023a7:	89 e5                	mov    %esp,%ebp
+  8023a9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023af:	50                   	push   %eax
+  8023b0:	ff 75 08             	push   0x8(%ebp)
+  8023b3:	e8 a4 fe ff ff       	call   80225c <fd_lookup>
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	85 c0                	test   %eax,%eax
+  8023bd:	79 02                	jns    8023c1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8023bf:	c9                   	leave
+  8023c0:	c3                   	ret
+		return fd_close(fd, 1);
+  8023c1:	83 ec 08             	sub    $0x8,%esp
+  8023c4:	6a 01                	push   $0x1
+  8023c6:	ff 75 f4             	push   -0xc(%ebp)
+  8023c9:	e8 51 ff ff ff       	call   80231f <fd_close>
+  8023ce:	83 c4 10             	add    $0x10,%esp
+  8023d1:	eb ec                	jmp    8023bf <close+0x19>
+
+008023d3 <close_all>:
+
+void
+close_all(void)
+{
+  8023d3:	55                   	push   %ebp
+  8023d4:	89 e5                	mov    %esp,%ebp
+  8023d6:	53                   	push   %ebx
+  8023d7:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8023da:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8023df:	83 ec 0c             	sub    $0xc,%esp
+  8023e2:	53                   	push   %ebx
+  8023e3:	e8 be ff ff ff       	call   8023a6 <close>
+	for (i = 0; i < MAXFD; i++)
+  8023e8:	83 c3 01             	add    $0x1,%ebx
+  8023eb:	83 c4 10             	add    $0x10,%esp
+  8023ee:	83 fb 20             	cmp    $0x20,%ebx
+  8023f1:	75 ec                	jne    8023df <close_all+0xc>
+}
+  8023f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f6:	c9                   	leave
+  8023f7:	c3                   	ret
+
+008023f8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8023f8:	55                   	push   %ebp
+  8023f9:	89 e5                	mov    %esp,%ebp
+  8023fb:	57                   	push   %edi
+  8023fc:	56                   	push   %esi
+  8023fd:	53                   	push   %ebx
+  8023fe:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802401:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802404:	50                   	push   %eax
+  802405:	ff 75 08             	push   0x8(%ebp)
+  802408:	e8 4f fe ff ff       	call   80225c <fd_lookup>
+  80240d:	89 c3                	mov    %eax,%ebx
+  80240f:	83 c4 10             	add    $0x10,%esp
+  802412:	85 c0                	test   %eax,%eax
+  802414:	78 7f                	js     802495 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802416:	83 ec 0c             	sub    $0xc,%esp
+  802419:	ff 75 0c             	push   0xc(%ebp)
+  80241c:	e8 85 ff ff ff       	call   8023a6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802421:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802424:	c1 e6 0c             	shl    $0xc,%esi
+  802427:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80242d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802430:	89 3c 24             	mov    %edi,(%esp)
+  802433:	e8 b7 fd ff ff       	call   8021ef <fd2data>
+  802438:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80243a:	89 34 24             	mov    %esi,(%esp)
+  80243d:	e8 ad fd ff ff       	call   8021ef <fd2data>
+  802442:	83 c4 10             	add    $0x10,%esp
+  802445:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802448:	89 d8                	mov    %ebx,%eax
+  80244a:	c1 e8 16             	shr    $0x16,%eax
+  80244d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802454:	a8 01                	test   $0x1,%al
+  802456:	74 11                	je     802469 <dup+0x71>
+  802458:	89 d8                	mov    %ebx,%eax
+  80245a:	c1 e8 0c             	shr    $0xc,%eax
+  80245d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802464:	f6 c2 01             	test   $0x1,%dl
+  802467:	75 36                	jne    80249f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802469:	89 f8                	mov    %edi,%eax
+  80246b:	c1 e8 0c             	shr    $0xc,%eax
+  80246e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802475:	83 ec 0c             	sub    $0xc,%esp
+  802478:	25 07 0e 00 00       	and    $0xe07,%eax
+  80247d:	50                   	push   %eax
+  80247e:	56                   	push   %esi
+  80247f:	6a 00                	push   $0x0
+  802481:	57                   	push   %edi
+  802482:	6a 00                	push   $0x0
+  802484:	e8 c5 ea ff ff       	call   800f4e <sys_page_map>
+  802489:	89 c3                	mov    %eax,%ebx
+  80248b:	83 c4 20             	add    $0x20,%esp
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	78 33                	js     8024c5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802492:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802495:	89 d8                	mov    %ebx,%eax
+  802497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80249a:	5b                   	pop    %ebx
+  80249b:	5e                   	pop    %esi
+  80249c:	5f                   	pop    %edi
+  80249d:	5d                   	pop    %ebp
+  80249e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80249f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8024a6:	83 ec 0c             	sub    $0xc,%esp
+  8024a9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8024ae:	50                   	push   %eax
+  8024af:	ff 75 d4             	push   -0x2c(%ebp)
+  8024b2:	6a 00                	push   $0x0
+  8024b4:	53                   	push   %ebx
+  8024b5:	6a 00                	push   $0x0
+  8024b7:	e8 92 ea ff ff       	call   800f4e <sys_page_map>
+  8024bc:	89 c3                	mov    %eax,%ebx
+  8024be:	83 c4 20             	add    $0x20,%esp
+  8024c1:	85 c0                	test   %eax,%eax
+  8024c3:	79 a4                	jns    802469 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8024c5:	83 ec 08             	sub    $0x8,%esp
+  8024c8:	56                   	push   %esi
+  8024c9:	6a 00                	push   $0x0
+  8024cb:	e8 ec ea ff ff       	call   800fbc <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8024d0:	83 c4 08             	add    $0x8,%esp
+  8024d3:	ff 75 d4             	push   -0x2c(%ebp)
+  8024d6:	6a 00                	push   $0x0
+  8024d8:	e8 df ea ff ff       	call   800fbc <sys_page_unmap>
+	return r;
+  8024dd:	83 c4 10             	add    $0x10,%esp
+  8024e0:	eb b3                	jmp    802495 <dup+0x9d>
+
+008024e2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8024e2:	55                   	push   %ebp
+  8024e3:	89 e5                	mov    %esp,%ebp
+  8024e5:	56                   	push   %esi
+  8024e6:	53                   	push   %ebx
+  8024e7:	83 ec 18             	sub    $0x18,%esp
+  8024ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024f0:	50                   	push   %eax
+  8024f1:	53                   	push   %ebx
+  8024f2:	e8 65 fd ff ff       	call   80225c <fd_lookup>
+  8024f7:	83 c4 10             	add    $0x10,%esp
+  8024fa:	85 c0                	test   %eax,%eax
+  8024fc:	78 3c                	js     80253a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802501:	83 ec 08             	sub    $0x8,%esp
+  802504:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802507:	50                   	push   %eax
+  802508:	ff 36                	push   (%esi)
+  80250a:	e8 9d fd ff ff       	call   8022ac <dev_lookup>
+  80250f:	83 c4 10             	add    $0x10,%esp
+  802512:	85 c0                	test   %eax,%eax
+  802514:	78 24                	js     80253a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802516:	8b 46 08             	mov    0x8(%esi),%eax
+  802519:	83 e0 03             	and    $0x3,%eax
+  80251c:	83 f8 01             	cmp    $0x1,%eax
+  80251f:	74 20                	je     802541 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802521:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802524:	8b 40 08             	mov    0x8(%eax),%eax
+  802527:	85 c0                	test   %eax,%eax
+  802529:	74 57                	je     802582 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80252b:	83 ec 04             	sub    $0x4,%esp
+  80252e:	ff 75 10             	push   0x10(%ebp)
+  802531:	ff 75 0c             	push   0xc(%ebp)
+  802534:	56                   	push   %esi
+  802535:	ff d0                	call   *%eax
+  802537:	83 c4 10             	add    $0x10,%esp
+}
+  80253a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80253d:	5b                   	pop    %ebx
+  80253e:	5e                   	pop    %esi
+  80253f:	5d                   	pop    %ebp
+  802540:	c3                   	ret
+  802541:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802543:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802548:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80254e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802553:	76 1c                	jbe    802571 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802555:	8b 42 48             	mov    0x48(%edx),%eax
+  802558:	83 ec 04             	sub    $0x4,%esp
+  80255b:	53                   	push   %ebx
+  80255c:	50                   	push   %eax
+  80255d:	68 59 3a 80 00       	push   $0x803a59
+  802562:	e8 3a de ff ff       	call   8003a1 <cprintf>
+		return -E_INVAL;
+  802567:	83 c4 10             	add    $0x10,%esp
+  80256a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80256f:	eb c9                	jmp    80253a <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802571:	c1 e8 10             	shr    $0x10,%eax
+  802574:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80257a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802580:	eb d3                	jmp    802555 <read+0x73>
+		return -E_NOT_SUPP;
+  802582:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802587:	eb b1                	jmp    80253a <read+0x58>
+
+00802589 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802589:	55                   	push   %ebp
+  80258a:	89 e5                	mov    %esp,%ebp
+  80258c:	57                   	push   %edi
+  80258d:	56                   	push   %esi
+  80258e:	53                   	push   %ebx
+  80258f:	83 ec 0c             	sub    $0xc,%esp
+  802592:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802595:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802598:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80259d:	eb 02                	jmp    8025a1 <readn+0x18>
+  80259f:	01 c3                	add    %eax,%ebx
+  8025a1:	39 f3                	cmp    %esi,%ebx
+  8025a3:	73 21                	jae    8025c6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8025a5:	83 ec 04             	sub    $0x4,%esp
+  8025a8:	89 f0                	mov    %esi,%eax
+  8025aa:	29 d8                	sub    %ebx,%eax
+  8025ac:	50                   	push   %eax
+  8025ad:	89 d8                	mov    %ebx,%eax
+  8025af:	03 45 0c             	add    0xc(%ebp),%eax
+  8025b2:	50                   	push   %eax
+  8025b3:	57                   	push   %edi
+  8025b4:	e8 29 ff ff ff       	call   8024e2 <read>
+		if (m < 0)
+  8025b9:	83 c4 10             	add    $0x10,%esp
+  8025bc:	85 c0                	test   %eax,%eax
+  8025be:	78 04                	js     8025c4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8025c0:	75 dd                	jne    80259f <readn+0x16>
+  8025c2:	eb 02                	jmp    8025c6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8025c4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8025c6:	89 d8                	mov    %ebx,%eax
+  8025c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025cb:	5b                   	pop    %ebx
+  8025cc:	5e                   	pop    %esi
+  8025cd:	5f                   	pop    %edi
+  8025ce:	5d                   	pop    %ebp
+  8025cf:	c3                   	ret
+
+008025d0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8025d0:	55                   	push   %ebp
+  8025d1:	89 e5                	mov    %esp,%ebp
+  8025d3:	56                   	push   %esi
+  8025d4:	53                   	push   %ebx
+  8025d5:	83 ec 18             	sub    $0x18,%esp
+  8025d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025de:	50                   	push   %eax
+  8025df:	53                   	push   %ebx
+  8025e0:	e8 77 fc ff ff       	call   80225c <fd_lookup>
+  8025e5:	83 c4 10             	add    $0x10,%esp
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	78 37                	js     802623 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025ec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025ef:	83 ec 08             	sub    $0x8,%esp
+  8025f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025f5:	50                   	push   %eax
+  8025f6:	ff 36                	push   (%esi)
+  8025f8:	e8 af fc ff ff       	call   8022ac <dev_lookup>
+  8025fd:	83 c4 10             	add    $0x10,%esp
+  802600:	85 c0                	test   %eax,%eax
+  802602:	78 1f                	js     802623 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802604:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802608:	74 20                	je     80262a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80260a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80260d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802610:	85 c0                	test   %eax,%eax
+  802612:	74 57                	je     80266b <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802614:	83 ec 04             	sub    $0x4,%esp
+  802617:	ff 75 10             	push   0x10(%ebp)
+  80261a:	ff 75 0c             	push   0xc(%ebp)
+  80261d:	56                   	push   %esi
+  80261e:	ff d0                	call   *%eax
+  802620:	83 c4 10             	add    $0x10,%esp
+}
+  802623:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802626:	5b                   	pop    %ebx
+  802627:	5e                   	pop    %esi
+  802628:	5d                   	pop    %ebp
+  802629:	c3                   	ret
+  80262a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80262c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802631:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802637:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80263c:	76 1c                	jbe    80265a <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80263e:	8b 42 48             	mov    0x48(%edx),%eax
+  802641:	83 ec 04             	sub    $0x4,%esp
+  802644:	53                   	push   %ebx
+  802645:	50                   	push   %eax
+  802646:	68 75 3a 80 00       	push   $0x803a75
+  80264b:	e8 51 dd ff ff       	call   8003a1 <cprintf>
+		return -E_INVAL;
+  802650:	83 c4 10             	add    $0x10,%esp
+  802653:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802658:	eb c9                	jmp    802623 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80265a:	c1 e8 10             	shr    $0x10,%eax
+  80265d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802663:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802669:	eb d3                	jmp    80263e <write+0x6e>
+		return -E_NOT_SUPP;
+  80266b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802670:	eb b1                	jmp    802623 <write+0x53>
+
+00802672 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802672:	55                   	push   %ebp
+  802673:	89 e5                	mov    %esp,%ebp
+  802675:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802678:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80267b:	50                   	push   %eax
+  80267c:	ff 75 08             	push   0x8(%ebp)
+  80267f:	e8 d8 fb ff ff       	call   80225c <fd_lookup>
+  802684:	83 c4 10             	add    $0x10,%esp
+  802687:	85 c0                	test   %eax,%eax
+  802689:	78 0e                	js     802699 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80268b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80268e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802691:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802694:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802699:	c9                   	leave
+  80269a:	c3                   	ret
+
+0080269b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80269b:	55                   	push   %ebp
+  80269c:	89 e5                	mov    %esp,%ebp
+  80269e:	56                   	push   %esi
+  80269f:	53                   	push   %ebx
+  8026a0:	83 ec 18             	sub    $0x18,%esp
+  8026a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8026a6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026a9:	50                   	push   %eax
+  8026aa:	53                   	push   %ebx
+  8026ab:	e8 ac fb ff ff       	call   80225c <fd_lookup>
+  8026b0:	83 c4 10             	add    $0x10,%esp
+  8026b3:	85 c0                	test   %eax,%eax
+  8026b5:	78 34                	js     8026eb <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026b7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026ba:	83 ec 08             	sub    $0x8,%esp
+  8026bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c0:	50                   	push   %eax
+  8026c1:	ff 36                	push   (%esi)
+  8026c3:	e8 e4 fb ff ff       	call   8022ac <dev_lookup>
+  8026c8:	83 c4 10             	add    $0x10,%esp
+  8026cb:	85 c0                	test   %eax,%eax
+  8026cd:	78 1c                	js     8026eb <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026cf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8026d3:	74 1d                	je     8026f2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8026d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d8:	8b 40 18             	mov    0x18(%eax),%eax
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	74 54                	je     802733 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8026df:	83 ec 08             	sub    $0x8,%esp
+  8026e2:	ff 75 0c             	push   0xc(%ebp)
+  8026e5:	56                   	push   %esi
+  8026e6:	ff d0                	call   *%eax
+  8026e8:	83 c4 10             	add    $0x10,%esp
+}
+  8026eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ee:	5b                   	pop    %ebx
+  8026ef:	5e                   	pop    %esi
+  8026f0:	5d                   	pop    %ebp
+  8026f1:	c3                   	ret
+  8026f2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026f4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026f9:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026ff:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802704:	76 1c                	jbe    802722 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802706:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802709:	83 ec 04             	sub    $0x4,%esp
+  80270c:	53                   	push   %ebx
+  80270d:	50                   	push   %eax
+  80270e:	68 38 3a 80 00       	push   $0x803a38
+  802713:	e8 89 dc ff ff       	call   8003a1 <cprintf>
+		return -E_INVAL;
+  802718:	83 c4 10             	add    $0x10,%esp
+  80271b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802720:	eb c9                	jmp    8026eb <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802722:	c1 e8 10             	shr    $0x10,%eax
+  802725:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80272b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802731:	eb d3                	jmp    802706 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802733:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802738:	eb b1                	jmp    8026eb <ftruncate+0x50>
+
+0080273a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80273a:	55                   	push   %ebp
+  80273b:	89 e5                	mov    %esp,%ebp
+  80273d:	56                   	push   %esi
+  80273e:	53                   	push   %ebx
+  80273f:	83 ec 18             	sub    $0x18,%esp
+  802742:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802745:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802748:	50                   	push   %eax
+  802749:	ff 75 08             	push   0x8(%ebp)
+  80274c:	e8 0b fb ff ff       	call   80225c <fd_lookup>
+  802751:	83 c4 10             	add    $0x10,%esp
+  802754:	85 c0                	test   %eax,%eax
+  802756:	78 49                	js     8027a1 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802758:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80275b:	83 ec 08             	sub    $0x8,%esp
+  80275e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802761:	50                   	push   %eax
+  802762:	ff 36                	push   (%esi)
+  802764:	e8 43 fb ff ff       	call   8022ac <dev_lookup>
+  802769:	83 c4 10             	add    $0x10,%esp
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	78 31                	js     8027a1 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802770:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802773:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802777:	74 2f                	je     8027a8 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802779:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80277c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802783:	00 00 00 
+	stat->st_isdir = 0;
+  802786:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80278d:	00 00 00 
+	stat->st_dev = dev;
+  802790:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802796:	83 ec 08             	sub    $0x8,%esp
+  802799:	53                   	push   %ebx
+  80279a:	56                   	push   %esi
+  80279b:	ff 50 14             	call   *0x14(%eax)
+  80279e:	83 c4 10             	add    $0x10,%esp
+}
+  8027a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a4:	5b                   	pop    %ebx
+  8027a5:	5e                   	pop    %esi
+  8027a6:	5d                   	pop    %ebp
+  8027a7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027a8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027ad:	eb f2                	jmp    8027a1 <fstat+0x67>
+
+008027af <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8027af:	55                   	push   %ebp
+  8027b0:	89 e5                	mov    %esp,%ebp
+  8027b2:	56                   	push   %esi
+  8027b3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8027b4:	83 ec 08             	sub    $0x8,%esp
+  8027b7:	6a 00                	push   $0x0
+  8027b9:	ff 75 08             	push   0x8(%ebp)
+  8027bc:	e8 e4 01 00 00       	call   8029a5 <open>
+  8027c1:	89 c3                	mov    %eax,%ebx
+  8027c3:	83 c4 10             	add    $0x10,%esp
+  8027c6:	85 c0                	test   %eax,%eax
+  8027c8:	78 1b                	js     8027e5 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8027ca:	83 ec 08             	sub    $0x8,%esp
+  8027cd:	ff 75 0c             	push   0xc(%ebp)
+  8027d0:	50                   	push   %eax
+  8027d1:	e8 64 ff ff ff       	call   80273a <fstat>
+  8027d6:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8027d8:	89 1c 24             	mov    %ebx,(%esp)
+  8027db:	e8 c6 fb ff ff       	call   8023a6 <close>
+	return r;
+  8027e0:	83 c4 10             	add    $0x10,%esp
+  8027e3:	89 f3                	mov    %esi,%ebx
+}
+  8027e5:	89 d8                	mov    %ebx,%eax
+  8027e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ea:	5b                   	pop    %ebx
+  8027eb:	5e                   	pop    %esi
+  8027ec:	5d                   	pop    %ebp
+  8027ed:	c3                   	ret
+
+008027ee <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8027ee:	55                   	push   %ebp
+  8027ef:	89 e5                	mov    %esp,%ebp
+  8027f1:	56                   	push   %esi
+  8027f2:	53                   	push   %ebx
+  8027f3:	89 c6                	mov    %eax,%esi
+  8027f5:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8027f7:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8027fe:	74 27                	je     802827 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802800:	6a 07                	push   $0x7
+  802802:	68 00 60 80 00       	push   $0x806000
+  802807:	56                   	push   %esi
+  802808:	ff 35 00 50 80 00    	push   0x805000
+  80280e:	e8 17 f7 ff ff       	call   801f2a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802813:	83 c4 0c             	add    $0xc,%esp
+  802816:	6a 00                	push   $0x0
+  802818:	53                   	push   %ebx
+  802819:	6a 00                	push   $0x0
+  80281b:	e8 f2 f6 ff ff       	call   801f12 <ipc_recv>
+}
+  802820:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802823:	5b                   	pop    %ebx
+  802824:	5e                   	pop    %esi
+  802825:	5d                   	pop    %ebp
+  802826:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802827:	83 ec 0c             	sub    $0xc,%esp
+  80282a:	6a 01                	push   $0x1
+  80282c:	e8 4d f7 ff ff       	call   801f7e <ipc_find_env>
+  802831:	a3 00 50 80 00       	mov    %eax,0x805000
+  802836:	83 c4 10             	add    $0x10,%esp
+  802839:	eb c5                	jmp    802800 <fsipc+0x12>
+
+0080283b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80283b:	55                   	push   %ebp
+  80283c:	89 e5                	mov    %esp,%ebp
+  80283e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802841:	8b 45 08             	mov    0x8(%ebp),%eax
+  802844:	8b 40 0c             	mov    0xc(%eax),%eax
+  802847:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80284c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80284f:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802854:	ba 00 00 00 00       	mov    $0x0,%edx
+  802859:	b8 02 00 00 00       	mov    $0x2,%eax
+  80285e:	e8 8b ff ff ff       	call   8027ee <fsipc>
+}
+  802863:	c9                   	leave
+  802864:	c3                   	ret
+
+00802865 <devfile_flush>:
+{
+  802865:	55                   	push   %ebp
+  802866:	89 e5                	mov    %esp,%ebp
+  802868:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80286b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802871:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802880:	e8 69 ff ff ff       	call   8027ee <fsipc>
+}
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+00802887 <devfile_stat>:
+{
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	53                   	push   %ebx
+  80288b:	83 ec 04             	sub    $0x4,%esp
+  80288e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802891:	8b 45 08             	mov    0x8(%ebp),%eax
+  802894:	8b 40 0c             	mov    0xc(%eax),%eax
+  802897:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80289c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028a1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8028a6:	e8 43 ff ff ff       	call   8027ee <fsipc>
+  8028ab:	85 c0                	test   %eax,%eax
+  8028ad:	78 2c                	js     8028db <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8028af:	83 ec 08             	sub    $0x8,%esp
+  8028b2:	68 00 60 80 00       	push   $0x806000
+  8028b7:	53                   	push   %ebx
+  8028b8:	e8 2c e1 ff ff       	call   8009e9 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8028bd:	a1 80 60 80 00       	mov    0x806080,%eax
+  8028c2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8028c8:	a1 84 60 80 00       	mov    0x806084,%eax
+  8028cd:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8028d3:	83 c4 10             	add    $0x10,%esp
+  8028d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028de:	c9                   	leave
+  8028df:	c3                   	ret
+
+008028e0 <devfile_write>:
+{
+  8028e0:	55                   	push   %ebp
+  8028e1:	89 e5                	mov    %esp,%ebp
+  8028e3:	83 ec 0c             	sub    $0xc,%esp
+  8028e6:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028ec:	8b 52 0c             	mov    0xc(%edx),%edx
+  8028ef:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8028f5:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8028fa:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8028ff:	39 d0                	cmp    %edx,%eax
+  802901:	0f 47 c2             	cmova  %edx,%eax
+  802904:	50                   	push   %eax
+  802905:	ff 75 0c             	push   0xc(%ebp)
+  802908:	68 08 60 80 00       	push   $0x806008
+  80290d:	e8 5d e2 ff ff       	call   800b6f <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802912:	ba 00 00 00 00       	mov    $0x0,%edx
+  802917:	b8 04 00 00 00       	mov    $0x4,%eax
+  80291c:	e8 cd fe ff ff       	call   8027ee <fsipc>
+}
+  802921:	c9                   	leave
+  802922:	c3                   	ret
+
+00802923 <devfile_read>:
+{
+  802923:	55                   	push   %ebp
+  802924:	89 e5                	mov    %esp,%ebp
+  802926:	56                   	push   %esi
+  802927:	53                   	push   %ebx
+  802928:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80292b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802931:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802936:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80293c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802941:	b8 03 00 00 00       	mov    $0x3,%eax
+  802946:	e8 a3 fe ff ff       	call   8027ee <fsipc>
+  80294b:	89 c3                	mov    %eax,%ebx
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	78 1f                	js     802970 <devfile_read+0x4d>
+	assert(r <= n);
+  802951:	39 c6                	cmp    %eax,%esi
+  802953:	72 24                	jb     802979 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802955:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80295a:	7f 33                	jg     80298f <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80295c:	83 ec 04             	sub    $0x4,%esp
+  80295f:	50                   	push   %eax
+  802960:	68 00 60 80 00       	push   $0x806000
+  802965:	ff 75 0c             	push   0xc(%ebp)
+  802968:	e8 02 e2 ff ff       	call   800b6f <memmove>
+	return r;
+  80296d:	83 c4 10             	add    $0x10,%esp
+}
+  802970:	89 d8                	mov    %ebx,%eax
+  802972:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802975:	5b                   	pop    %ebx
+  802976:	5e                   	pop    %esi
+  802977:	5d                   	pop    %ebp
+  802978:	c3                   	ret
+	assert(r <= n);
+  802979:	68 a8 3a 80 00       	push   $0x803aa8
+  80297e:	68 b0 39 80 00       	push   $0x8039b0
+  802983:	6a 76                	push   $0x76
+  802985:	68 af 3a 80 00       	push   $0x803aaf
+  80298a:	e8 37 d9 ff ff       	call   8002c6 <_panic>
+	assert(r <= PGSIZE);
+  80298f:	68 ba 3a 80 00       	push   $0x803aba
+  802994:	68 b0 39 80 00       	push   $0x8039b0
+  802999:	6a 77                	push   $0x77
+  80299b:	68 af 3a 80 00       	push   $0x803aaf
+  8029a0:	e8 21 d9 ff ff       	call   8002c6 <_panic>
+
+008029a5 <open>:
+{
+  8029a5:	55                   	push   %ebp
+  8029a6:	89 e5                	mov    %esp,%ebp
+  8029a8:	56                   	push   %esi
+  8029a9:	53                   	push   %ebx
+  8029aa:	83 ec 1c             	sub    $0x1c,%esp
+  8029ad:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8029b0:	56                   	push   %esi
+  8029b1:	e8 f8 df ff ff       	call   8009ae <strlen>
+  8029b6:	83 c4 10             	add    $0x10,%esp
+  8029b9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029be:	7f 6c                	jg     802a2c <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8029c0:	83 ec 0c             	sub    $0xc,%esp
+  8029c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029c6:	50                   	push   %eax
+  8029c7:	e8 3a f8 ff ff       	call   802206 <fd_alloc>
+  8029cc:	89 c3                	mov    %eax,%ebx
+  8029ce:	83 c4 10             	add    $0x10,%esp
+  8029d1:	85 c0                	test   %eax,%eax
+  8029d3:	78 3c                	js     802a11 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8029d5:	83 ec 08             	sub    $0x8,%esp
+  8029d8:	56                   	push   %esi
+  8029d9:	68 00 60 80 00       	push   $0x806000
+  8029de:	e8 06 e0 ff ff       	call   8009e9 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8029e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029e6:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8029eb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029f3:	e8 f6 fd ff ff       	call   8027ee <fsipc>
+  8029f8:	89 c3                	mov    %eax,%ebx
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 19                	js     802a1a <open+0x75>
+	return fd2num(fd);
+  802a01:	83 ec 0c             	sub    $0xc,%esp
+  802a04:	ff 75 f4             	push   -0xc(%ebp)
+  802a07:	e8 d3 f7 ff ff       	call   8021df <fd2num>
+  802a0c:	89 c3                	mov    %eax,%ebx
+  802a0e:	83 c4 10             	add    $0x10,%esp
+}
+  802a11:	89 d8                	mov    %ebx,%eax
+  802a13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a16:	5b                   	pop    %ebx
+  802a17:	5e                   	pop    %esi
+  802a18:	5d                   	pop    %ebp
+  802a19:	c3                   	ret
+		fd_close(fd, 0);
+  802a1a:	83 ec 08             	sub    $0x8,%esp
+  802a1d:	6a 00                	push   $0x0
+  802a1f:	ff 75 f4             	push   -0xc(%ebp)
+  802a22:	e8 f8 f8 ff ff       	call   80231f <fd_close>
+		return r;
+  802a27:	83 c4 10             	add    $0x10,%esp
+  802a2a:	eb e5                	jmp    802a11 <open+0x6c>
+		return -E_BAD_PATH;
+  802a2c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802a31:	eb de                	jmp    802a11 <open+0x6c>
+
+00802a33 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a33:	55                   	push   %ebp
+  802a34:	89 e5                	mov    %esp,%ebp
+  802a36:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a39:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a3e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a43:	e8 a6 fd ff ff       	call   8027ee <fsipc>
+}
+  802a48:	c9                   	leave
+  802a49:	c3                   	ret
+
+00802a4a <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a4a:	55                   	push   %ebp
+  802a4b:	89 e5                	mov    %esp,%ebp
+  802a4d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a50:	68 c6 3a 80 00       	push   $0x803ac6
+  802a55:	ff 75 0c             	push   0xc(%ebp)
+  802a58:	e8 8c df ff ff       	call   8009e9 <strcpy>
+	return 0;
+}
+  802a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a62:	c9                   	leave
+  802a63:	c3                   	ret
+
+00802a64 <devsock_close>:
+{
+  802a64:	55                   	push   %ebp
+  802a65:	89 e5                	mov    %esp,%ebp
+  802a67:	53                   	push   %ebx
+  802a68:	83 ec 10             	sub    $0x10,%esp
+  802a6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a6e:	53                   	push   %ebx
+  802a6f:	e8 f3 09 00 00       	call   803467 <pageref>
+  802a74:	89 c2                	mov    %eax,%edx
+  802a76:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a79:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a7e:	83 fa 01             	cmp    $0x1,%edx
+  802a81:	74 05                	je     802a88 <devsock_close+0x24>
+}
+  802a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a86:	c9                   	leave
+  802a87:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a88:	83 ec 0c             	sub    $0xc,%esp
+  802a8b:	ff 73 0c             	push   0xc(%ebx)
+  802a8e:	e8 b7 02 00 00       	call   802d4a <nsipc_close>
+  802a93:	83 c4 10             	add    $0x10,%esp
+  802a96:	eb eb                	jmp    802a83 <devsock_close+0x1f>
+
+00802a98 <devsock_write>:
+{
+  802a98:	55                   	push   %ebp
+  802a99:	89 e5                	mov    %esp,%ebp
+  802a9b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a9e:	6a 00                	push   $0x0
+  802aa0:	ff 75 10             	push   0x10(%ebp)
+  802aa3:	ff 75 0c             	push   0xc(%ebp)
+  802aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa9:	ff 70 0c             	push   0xc(%eax)
+  802aac:	e8 79 03 00 00       	call   802e2a <nsipc_send>
+}
+  802ab1:	c9                   	leave
+  802ab2:	c3                   	ret
+
+00802ab3 <devsock_read>:
+{
+  802ab3:	55                   	push   %ebp
+  802ab4:	89 e5                	mov    %esp,%ebp
+  802ab6:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ab9:	6a 00                	push   $0x0
+  802abb:	ff 75 10             	push   0x10(%ebp)
+  802abe:	ff 75 0c             	push   0xc(%ebp)
+  802ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac4:	ff 70 0c             	push   0xc(%eax)
+  802ac7:	e8 ef 02 00 00       	call   802dbb <nsipc_recv>
+}
+  802acc:	c9                   	leave
+  802acd:	c3                   	ret
+
+00802ace <fd2sockid>:
+{
+  802ace:	55                   	push   %ebp
+  802acf:	89 e5                	mov    %esp,%ebp
+  802ad1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802ad4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ad7:	52                   	push   %edx
+  802ad8:	50                   	push   %eax
+  802ad9:	e8 7e f7 ff ff       	call   80225c <fd_lookup>
+  802ade:	83 c4 10             	add    $0x10,%esp
+  802ae1:	85 c0                	test   %eax,%eax
+  802ae3:	78 10                	js     802af5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ae5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae8:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802aee:	39 08                	cmp    %ecx,(%eax)
+  802af0:	75 05                	jne    802af7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802af2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802af5:	c9                   	leave
+  802af6:	c3                   	ret
+		return -E_NOT_SUPP;
+  802af7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802afc:	eb f7                	jmp    802af5 <fd2sockid+0x27>
+
+00802afe <alloc_sockfd>:
+{
+  802afe:	55                   	push   %ebp
+  802aff:	89 e5                	mov    %esp,%ebp
+  802b01:	56                   	push   %esi
+  802b02:	53                   	push   %ebx
+  802b03:	83 ec 1c             	sub    $0x1c,%esp
+  802b06:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b0b:	50                   	push   %eax
+  802b0c:	e8 f5 f6 ff ff       	call   802206 <fd_alloc>
+  802b11:	89 c3                	mov    %eax,%ebx
+  802b13:	83 c4 10             	add    $0x10,%esp
+  802b16:	85 c0                	test   %eax,%eax
+  802b18:	78 43                	js     802b5d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b1a:	83 ec 04             	sub    $0x4,%esp
+  802b1d:	68 07 04 00 00       	push   $0x407
+  802b22:	ff 75 f4             	push   -0xc(%ebp)
+  802b25:	6a 00                	push   $0x0
+  802b27:	e8 b5 e3 ff ff       	call   800ee1 <sys_page_alloc>
+  802b2c:	89 c3                	mov    %eax,%ebx
+  802b2e:	83 c4 10             	add    $0x10,%esp
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	78 28                	js     802b5d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b38:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802b3e:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b43:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b4a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b4d:	83 ec 0c             	sub    $0xc,%esp
+  802b50:	50                   	push   %eax
+  802b51:	e8 89 f6 ff ff       	call   8021df <fd2num>
+  802b56:	89 c3                	mov    %eax,%ebx
+  802b58:	83 c4 10             	add    $0x10,%esp
+  802b5b:	eb 0c                	jmp    802b69 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b5d:	83 ec 0c             	sub    $0xc,%esp
+  802b60:	56                   	push   %esi
+  802b61:	e8 e4 01 00 00       	call   802d4a <nsipc_close>
+		return r;
+  802b66:	83 c4 10             	add    $0x10,%esp
+}
+  802b69:	89 d8                	mov    %ebx,%eax
+  802b6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b6e:	5b                   	pop    %ebx
+  802b6f:	5e                   	pop    %esi
+  802b70:	5d                   	pop    %ebp
+  802b71:	c3                   	ret
+
+00802b72 <accept>:
+{
+  802b72:	55                   	push   %ebp
+  802b73:	89 e5                	mov    %esp,%ebp
+  802b75:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b78:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7b:	e8 4e ff ff ff       	call   802ace <fd2sockid>
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	78 1b                	js     802b9f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b84:	83 ec 04             	sub    $0x4,%esp
+  802b87:	ff 75 10             	push   0x10(%ebp)
+  802b8a:	ff 75 0c             	push   0xc(%ebp)
+  802b8d:	50                   	push   %eax
+  802b8e:	e8 0e 01 00 00       	call   802ca1 <nsipc_accept>
+  802b93:	83 c4 10             	add    $0x10,%esp
+  802b96:	85 c0                	test   %eax,%eax
+  802b98:	78 05                	js     802b9f <accept+0x2d>
+	return alloc_sockfd(r);
+  802b9a:	e8 5f ff ff ff       	call   802afe <alloc_sockfd>
+}
+  802b9f:	c9                   	leave
+  802ba0:	c3                   	ret
+
+00802ba1 <bind>:
+{
+  802ba1:	55                   	push   %ebp
+  802ba2:	89 e5                	mov    %esp,%ebp
+  802ba4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802baa:	e8 1f ff ff ff       	call   802ace <fd2sockid>
+  802baf:	85 c0                	test   %eax,%eax
+  802bb1:	78 12                	js     802bc5 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802bb3:	83 ec 04             	sub    $0x4,%esp
+  802bb6:	ff 75 10             	push   0x10(%ebp)
+  802bb9:	ff 75 0c             	push   0xc(%ebp)
+  802bbc:	50                   	push   %eax
+  802bbd:	e8 31 01 00 00       	call   802cf3 <nsipc_bind>
+  802bc2:	83 c4 10             	add    $0x10,%esp
+}
+  802bc5:	c9                   	leave
+  802bc6:	c3                   	ret
+
+00802bc7 <shutdown>:
+{
+  802bc7:	55                   	push   %ebp
+  802bc8:	89 e5                	mov    %esp,%ebp
+  802bca:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd0:	e8 f9 fe ff ff       	call   802ace <fd2sockid>
+  802bd5:	85 c0                	test   %eax,%eax
+  802bd7:	78 0f                	js     802be8 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802bd9:	83 ec 08             	sub    $0x8,%esp
+  802bdc:	ff 75 0c             	push   0xc(%ebp)
+  802bdf:	50                   	push   %eax
+  802be0:	e8 43 01 00 00       	call   802d28 <nsipc_shutdown>
+  802be5:	83 c4 10             	add    $0x10,%esp
+}
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+
+00802bea <connect>:
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf3:	e8 d6 fe ff ff       	call   802ace <fd2sockid>
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	78 12                	js     802c0e <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802bfc:	83 ec 04             	sub    $0x4,%esp
+  802bff:	ff 75 10             	push   0x10(%ebp)
+  802c02:	ff 75 0c             	push   0xc(%ebp)
+  802c05:	50                   	push   %eax
+  802c06:	e8 59 01 00 00       	call   802d64 <nsipc_connect>
+  802c0b:	83 c4 10             	add    $0x10,%esp
+}
+  802c0e:	c9                   	leave
+  802c0f:	c3                   	ret
+
+00802c10 <listen>:
+{
+  802c10:	55                   	push   %ebp
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c16:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c19:	e8 b0 fe ff ff       	call   802ace <fd2sockid>
+  802c1e:	85 c0                	test   %eax,%eax
+  802c20:	78 0f                	js     802c31 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c22:	83 ec 08             	sub    $0x8,%esp
+  802c25:	ff 75 0c             	push   0xc(%ebp)
+  802c28:	50                   	push   %eax
+  802c29:	e8 6b 01 00 00       	call   802d99 <nsipc_listen>
+  802c2e:	83 c4 10             	add    $0x10,%esp
+}
+  802c31:	c9                   	leave
+  802c32:	c3                   	ret
+
+00802c33 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c33:	55                   	push   %ebp
+  802c34:	89 e5                	mov    %esp,%ebp
+  802c36:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c39:	ff 75 10             	push   0x10(%ebp)
+  802c3c:	ff 75 0c             	push   0xc(%ebp)
+  802c3f:	ff 75 08             	push   0x8(%ebp)
+  802c42:	e8 41 02 00 00       	call   802e88 <nsipc_socket>
+  802c47:	83 c4 10             	add    $0x10,%esp
+  802c4a:	85 c0                	test   %eax,%eax
+  802c4c:	78 05                	js     802c53 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c4e:	e8 ab fe ff ff       	call   802afe <alloc_sockfd>
+}
+  802c53:	c9                   	leave
+  802c54:	c3                   	ret
+
+00802c55 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c55:	55                   	push   %ebp
+  802c56:	89 e5                	mov    %esp,%ebp
+  802c58:	53                   	push   %ebx
+  802c59:	83 ec 04             	sub    $0x4,%esp
+  802c5c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c5e:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802c65:	74 26                	je     802c8d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c67:	6a 07                	push   $0x7
+  802c69:	68 00 70 80 00       	push   $0x807000
+  802c6e:	53                   	push   %ebx
+  802c6f:	ff 35 04 50 80 00    	push   0x805004
+  802c75:	e8 b0 f2 ff ff       	call   801f2a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c7a:	83 c4 0c             	add    $0xc,%esp
+  802c7d:	6a 00                	push   $0x0
+  802c7f:	6a 00                	push   $0x0
+  802c81:	6a 00                	push   $0x0
+  802c83:	e8 8a f2 ff ff       	call   801f12 <ipc_recv>
+}
+  802c88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c8b:	c9                   	leave
+  802c8c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c8d:	83 ec 0c             	sub    $0xc,%esp
+  802c90:	6a 02                	push   $0x2
+  802c92:	e8 e7 f2 ff ff       	call   801f7e <ipc_find_env>
+  802c97:	a3 04 50 80 00       	mov    %eax,0x805004
+  802c9c:	83 c4 10             	add    $0x10,%esp
+  802c9f:	eb c6                	jmp    802c67 <nsipc+0x12>
+
+00802ca1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	56                   	push   %esi
+  802ca5:	53                   	push   %ebx
+  802ca6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cac:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802cb1:	8b 06                	mov    (%esi),%eax
+  802cb3:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802cb8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cbd:	e8 93 ff ff ff       	call   802c55 <nsipc>
+  802cc2:	89 c3                	mov    %eax,%ebx
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	79 09                	jns    802cd1 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802cc8:	89 d8                	mov    %ebx,%eax
+  802cca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ccd:	5b                   	pop    %ebx
+  802cce:	5e                   	pop    %esi
+  802ccf:	5d                   	pop    %ebp
+  802cd0:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802cd1:	83 ec 04             	sub    $0x4,%esp
+  802cd4:	ff 35 10 70 80 00    	push   0x807010
+  802cda:	68 00 70 80 00       	push   $0x807000
+  802cdf:	ff 75 0c             	push   0xc(%ebp)
+  802ce2:	e8 88 de ff ff       	call   800b6f <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ce7:	a1 10 70 80 00       	mov    0x807010,%eax
+  802cec:	89 06                	mov    %eax,(%esi)
+  802cee:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802cf1:	eb d5                	jmp    802cc8 <nsipc_accept+0x27>
+
+00802cf3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802cf3:	55                   	push   %ebp
+  802cf4:	89 e5                	mov    %esp,%ebp
+  802cf6:	53                   	push   %ebx
+  802cf7:	83 ec 08             	sub    $0x8,%esp
+  802cfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d00:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d05:	53                   	push   %ebx
+  802d06:	ff 75 0c             	push   0xc(%ebp)
+  802d09:	68 04 70 80 00       	push   $0x807004
+  802d0e:	e8 5c de ff ff       	call   800b6f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d13:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802d19:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d1e:	e8 32 ff ff ff       	call   802c55 <nsipc>
+}
+  802d23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d26:	c9                   	leave
+  802d27:	c3                   	ret
+
+00802d28 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d28:	55                   	push   %ebp
+  802d29:	89 e5                	mov    %esp,%ebp
+  802d2b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d31:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802d36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d39:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d3e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d43:	e8 0d ff ff ff       	call   802c55 <nsipc>
+}
+  802d48:	c9                   	leave
+  802d49:	c3                   	ret
+
+00802d4a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d4a:	55                   	push   %ebp
+  802d4b:	89 e5                	mov    %esp,%ebp
+  802d4d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d50:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d53:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802d58:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d5d:	e8 f3 fe ff ff       	call   802c55 <nsipc>
+}
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+
+00802d64 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d64:	55                   	push   %ebp
+  802d65:	89 e5                	mov    %esp,%ebp
+  802d67:	53                   	push   %ebx
+  802d68:	83 ec 08             	sub    $0x8,%esp
+  802d6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d71:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d76:	53                   	push   %ebx
+  802d77:	ff 75 0c             	push   0xc(%ebp)
+  802d7a:	68 04 70 80 00       	push   $0x807004
+  802d7f:	e8 eb dd ff ff       	call   800b6f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d84:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802d8a:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d8f:	e8 c1 fe ff ff       	call   802c55 <nsipc>
+}
+  802d94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d97:	c9                   	leave
+  802d98:	c3                   	ret
+
+00802d99 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d99:	55                   	push   %ebp
+  802d9a:	89 e5                	mov    %esp,%ebp
+  802d9c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802da7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802daa:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802daf:	b8 06 00 00 00       	mov    $0x6,%eax
+  802db4:	e8 9c fe ff ff       	call   802c55 <nsipc>
+}
+  802db9:	c9                   	leave
+  802dba:	c3                   	ret
+
+00802dbb <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802dbb:	55                   	push   %ebp
+  802dbc:	89 e5                	mov    %esp,%ebp
+  802dbe:	56                   	push   %esi
+  802dbf:	53                   	push   %ebx
+  802dc0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802dcb:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802dd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dd4:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802dd9:	b8 07 00 00 00       	mov    $0x7,%eax
+  802dde:	e8 72 fe ff ff       	call   802c55 <nsipc>
+  802de3:	89 c3                	mov    %eax,%ebx
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	78 22                	js     802e0b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802de9:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802dee:	39 c6                	cmp    %eax,%esi
+  802df0:	0f 4e c6             	cmovle %esi,%eax
+  802df3:	39 c3                	cmp    %eax,%ebx
+  802df5:	7f 1d                	jg     802e14 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802df7:	83 ec 04             	sub    $0x4,%esp
+  802dfa:	53                   	push   %ebx
+  802dfb:	68 00 70 80 00       	push   $0x807000
+  802e00:	ff 75 0c             	push   0xc(%ebp)
+  802e03:	e8 67 dd ff ff       	call   800b6f <memmove>
+  802e08:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e0b:	89 d8                	mov    %ebx,%eax
+  802e0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e10:	5b                   	pop    %ebx
+  802e11:	5e                   	pop    %esi
+  802e12:	5d                   	pop    %ebp
+  802e13:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e14:	68 d2 3a 80 00       	push   $0x803ad2
+  802e19:	68 b0 39 80 00       	push   $0x8039b0
+  802e1e:	6a 62                	push   $0x62
+  802e20:	68 e7 3a 80 00       	push   $0x803ae7
+  802e25:	e8 9c d4 ff ff       	call   8002c6 <_panic>
+
+00802e2a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e2a:	55                   	push   %ebp
+  802e2b:	89 e5                	mov    %esp,%ebp
+  802e2d:	53                   	push   %ebx
+  802e2e:	83 ec 04             	sub    $0x4,%esp
+  802e31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e34:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e37:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802e3c:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e42:	7f 2e                	jg     802e72 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e44:	83 ec 04             	sub    $0x4,%esp
+  802e47:	53                   	push   %ebx
+  802e48:	ff 75 0c             	push   0xc(%ebp)
+  802e4b:	68 0c 70 80 00       	push   $0x80700c
+  802e50:	e8 1a dd ff ff       	call   800b6f <memmove>
+	nsipcbuf.send.req_size = size;
+  802e55:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802e5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e5e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802e63:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e68:	e8 e8 fd ff ff       	call   802c55 <nsipc>
+}
+  802e6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e70:	c9                   	leave
+  802e71:	c3                   	ret
+	assert(size < 1600);
+  802e72:	68 f3 3a 80 00       	push   $0x803af3
+  802e77:	68 b0 39 80 00       	push   $0x8039b0
+  802e7c:	6a 6d                	push   $0x6d
+  802e7e:	68 e7 3a 80 00       	push   $0x803ae7
+  802e83:	e8 3e d4 ff ff       	call   8002c6 <_panic>
+
+00802e88 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e88:	55                   	push   %ebp
+  802e89:	89 e5                	mov    %esp,%ebp
+  802e8b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e91:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802e96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e99:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e9e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ea1:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802ea6:	b8 09 00 00 00       	mov    $0x9,%eax
+  802eab:	e8 a5 fd ff ff       	call   802c55 <nsipc>
+}
+  802eb0:	c9                   	leave
+  802eb1:	c3                   	ret
+
+00802eb2 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802eb2:	55                   	push   %ebp
+  802eb3:	89 e5                	mov    %esp,%ebp
+  802eb5:	56                   	push   %esi
+  802eb6:	53                   	push   %ebx
+  802eb7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802eba:	83 ec 0c             	sub    $0xc,%esp
+  802ebd:	ff 75 08             	push   0x8(%ebp)
+  802ec0:	e8 2a f3 ff ff       	call   8021ef <fd2data>
+  802ec5:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802ec7:	83 c4 08             	add    $0x8,%esp
+  802eca:	68 ff 3a 80 00       	push   $0x803aff
+  802ecf:	53                   	push   %ebx
+  802ed0:	e8 14 db ff ff       	call   8009e9 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ed5:	8b 46 04             	mov    0x4(%esi),%eax
+  802ed8:	2b 06                	sub    (%esi),%eax
+  802eda:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ee0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ee7:	00 00 00 
+	stat->st_dev = &devpipe;
+  802eea:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802ef1:	40 80 00 
+	return 0;
+}
+  802ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802efc:	5b                   	pop    %ebx
+  802efd:	5e                   	pop    %esi
+  802efe:	5d                   	pop    %ebp
+  802eff:	c3                   	ret
+
+00802f00 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f00:	55                   	push   %ebp
+  802f01:	89 e5                	mov    %esp,%ebp
+  802f03:	53                   	push   %ebx
+  802f04:	83 ec 0c             	sub    $0xc,%esp
+  802f07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f0a:	53                   	push   %ebx
+  802f0b:	6a 00                	push   $0x0
+  802f0d:	e8 aa e0 ff ff       	call   800fbc <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f12:	89 1c 24             	mov    %ebx,(%esp)
+  802f15:	e8 d5 f2 ff ff       	call   8021ef <fd2data>
+  802f1a:	83 c4 08             	add    $0x8,%esp
+  802f1d:	50                   	push   %eax
+  802f1e:	6a 00                	push   $0x0
+  802f20:	e8 97 e0 ff ff       	call   800fbc <sys_page_unmap>
+}
+  802f25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f28:	c9                   	leave
+  802f29:	c3                   	ret
+
+00802f2a <_pipeisclosed>:
+{
+  802f2a:	55                   	push   %ebp
+  802f2b:	89 e5                	mov    %esp,%ebp
+  802f2d:	57                   	push   %edi
+  802f2e:	56                   	push   %esi
+  802f2f:	53                   	push   %ebx
+  802f30:	83 ec 1c             	sub    $0x1c,%esp
+  802f33:	89 c7                	mov    %eax,%edi
+  802f35:	89 d6                	mov    %edx,%esi
+  802f37:	eb 3c                	jmp    802f75 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802f39:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f3c:	83 ec 0c             	sub    $0xc,%esp
+  802f3f:	57                   	push   %edi
+  802f40:	e8 22 05 00 00       	call   803467 <pageref>
+  802f45:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f48:	89 34 24             	mov    %esi,(%esp)
+  802f4b:	e8 17 05 00 00       	call   803467 <pageref>
+  802f50:	89 c2                	mov    %eax,%edx
+  802f52:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f54:	05 00 00 00 20       	add    $0x20000000,%eax
+  802f59:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802f5c:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f62:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f67:	76 31                	jbe    802f9a <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802f69:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802f6c:	39 c3                	cmp    %eax,%ebx
+  802f6e:	74 76                	je     802fe6 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802f70:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f73:	74 36                	je     802fab <_pipeisclosed+0x81>
+  802f75:	89 e0                	mov    %esp,%eax
+  802f77:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f7c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f82:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f87:	77 b0                	ja     802f39 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f89:	c1 e8 10             	shr    $0x10,%eax
+  802f8c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f92:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f98:	eb 9f                	jmp    802f39 <_pipeisclosed+0xf>
+  802f9a:	c1 e8 10             	shr    $0x10,%eax
+  802f9d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fa3:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802fa9:	eb be                	jmp    802f69 <_pipeisclosed+0x3f>
+  802fab:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fad:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802fb2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fb8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802fbd:	76 16                	jbe    802fd5 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fbf:	8b 42 58             	mov    0x58(%edx),%eax
+  802fc2:	6a 01                	push   $0x1
+  802fc4:	50                   	push   %eax
+  802fc5:	53                   	push   %ebx
+  802fc6:	68 06 3b 80 00       	push   $0x803b06
+  802fcb:	e8 d1 d3 ff ff       	call   8003a1 <cprintf>
+  802fd0:	83 c4 10             	add    $0x10,%esp
+  802fd3:	eb a0                	jmp    802f75 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802fd5:	c1 e8 10             	shr    $0x10,%eax
+  802fd8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fde:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802fe4:	eb d9                	jmp    802fbf <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802fe6:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802fe9:	0f 94 c0             	sete   %al
+  802fec:	0f b6 c0             	movzbl %al,%eax
+}
+  802fef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ff2:	5b                   	pop    %ebx
+  802ff3:	5e                   	pop    %esi
+  802ff4:	5f                   	pop    %edi
+  802ff5:	5d                   	pop    %ebp
+  802ff6:	c3                   	ret
+
+00802ff7 <devpipe_write>:
+{
+  802ff7:	55                   	push   %ebp
+  802ff8:	89 e5                	mov    %esp,%ebp
+  802ffa:	57                   	push   %edi
+  802ffb:	56                   	push   %esi
+  802ffc:	53                   	push   %ebx
+  802ffd:	83 ec 28             	sub    $0x28,%esp
+  803000:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803003:	56                   	push   %esi
+  803004:	e8 e6 f1 ff ff       	call   8021ef <fd2data>
+  803009:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80300b:	83 c4 10             	add    $0x10,%esp
+  80300e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803013:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803016:	75 09                	jne    803021 <devpipe_write+0x2a>
+	return i;
+  803018:	89 f8                	mov    %edi,%eax
+  80301a:	eb 23                	jmp    80303f <devpipe_write+0x48>
+			sys_yield();
+  80301c:	e8 7a de ff ff       	call   800e9b <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803021:	8b 43 04             	mov    0x4(%ebx),%eax
+  803024:	8b 0b                	mov    (%ebx),%ecx
+  803026:	8d 51 20             	lea    0x20(%ecx),%edx
+  803029:	39 d0                	cmp    %edx,%eax
+  80302b:	72 1a                	jb     803047 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80302d:	89 da                	mov    %ebx,%edx
+  80302f:	89 f0                	mov    %esi,%eax
+  803031:	e8 f4 fe ff ff       	call   802f2a <_pipeisclosed>
+  803036:	85 c0                	test   %eax,%eax
+  803038:	74 e2                	je     80301c <devpipe_write+0x25>
+				return 0;
+  80303a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80303f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803042:	5b                   	pop    %ebx
+  803043:	5e                   	pop    %esi
+  803044:	5f                   	pop    %edi
+  803045:	5d                   	pop    %ebp
+  803046:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803047:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80304a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80304e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803051:	89 c2                	mov    %eax,%edx
+  803053:	c1 fa 1f             	sar    $0x1f,%edx
+  803056:	89 d1                	mov    %edx,%ecx
+  803058:	c1 e9 1b             	shr    $0x1b,%ecx
+  80305b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80305e:	83 e2 1f             	and    $0x1f,%edx
+  803061:	29 ca                	sub    %ecx,%edx
+  803063:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803067:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80306b:	83 c0 01             	add    $0x1,%eax
+  80306e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803071:	83 c7 01             	add    $0x1,%edi
+  803074:	eb 9d                	jmp    803013 <devpipe_write+0x1c>
+
+00803076 <devpipe_read>:
+{
+  803076:	55                   	push   %ebp
+  803077:	89 e5                	mov    %esp,%ebp
+  803079:	57                   	push   %edi
+  80307a:	56                   	push   %esi
+  80307b:	53                   	push   %ebx
+  80307c:	83 ec 18             	sub    $0x18,%esp
+  80307f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803082:	57                   	push   %edi
+  803083:	e8 67 f1 ff ff       	call   8021ef <fd2data>
+  803088:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80308a:	83 c4 10             	add    $0x10,%esp
+  80308d:	be 00 00 00 00       	mov    $0x0,%esi
+  803092:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803095:	75 13                	jne    8030aa <devpipe_read+0x34>
+	return i;
+  803097:	89 f0                	mov    %esi,%eax
+  803099:	eb 02                	jmp    80309d <devpipe_read+0x27>
+				return i;
+  80309b:	89 f0                	mov    %esi,%eax
+}
+  80309d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030a0:	5b                   	pop    %ebx
+  8030a1:	5e                   	pop    %esi
+  8030a2:	5f                   	pop    %edi
+  8030a3:	5d                   	pop    %ebp
+  8030a4:	c3                   	ret
+			sys_yield();
+  8030a5:	e8 f1 dd ff ff       	call   800e9b <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8030aa:	8b 03                	mov    (%ebx),%eax
+  8030ac:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030af:	75 18                	jne    8030c9 <devpipe_read+0x53>
+			if (i > 0)
+  8030b1:	85 f6                	test   %esi,%esi
+  8030b3:	75 e6                	jne    80309b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8030b5:	89 da                	mov    %ebx,%edx
+  8030b7:	89 f8                	mov    %edi,%eax
+  8030b9:	e8 6c fe ff ff       	call   802f2a <_pipeisclosed>
+  8030be:	85 c0                	test   %eax,%eax
+  8030c0:	74 e3                	je     8030a5 <devpipe_read+0x2f>
+				return 0;
+  8030c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c7:	eb d4                	jmp    80309d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030c9:	99                   	cltd
+  8030ca:	c1 ea 1b             	shr    $0x1b,%edx
+  8030cd:	01 d0                	add    %edx,%eax
+  8030cf:	83 e0 1f             	and    $0x1f,%eax
+  8030d2:	29 d0                	sub    %edx,%eax
+  8030d4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8030d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030dc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030df:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8030e2:	83 c6 01             	add    $0x1,%esi
+  8030e5:	eb ab                	jmp    803092 <devpipe_read+0x1c>
+
+008030e7 <pipe>:
+{
+  8030e7:	55                   	push   %ebp
+  8030e8:	89 e5                	mov    %esp,%ebp
+  8030ea:	56                   	push   %esi
+  8030eb:	53                   	push   %ebx
+  8030ec:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030f2:	50                   	push   %eax
+  8030f3:	e8 0e f1 ff ff       	call   802206 <fd_alloc>
+  8030f8:	89 c3                	mov    %eax,%ebx
+  8030fa:	83 c4 10             	add    $0x10,%esp
+  8030fd:	85 c0                	test   %eax,%eax
+  8030ff:	0f 88 23 01 00 00    	js     803228 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803105:	83 ec 04             	sub    $0x4,%esp
+  803108:	68 07 04 00 00       	push   $0x407
+  80310d:	ff 75 f4             	push   -0xc(%ebp)
+  803110:	6a 00                	push   $0x0
+  803112:	e8 ca dd ff ff       	call   800ee1 <sys_page_alloc>
+  803117:	89 c3                	mov    %eax,%ebx
+  803119:	83 c4 10             	add    $0x10,%esp
+  80311c:	85 c0                	test   %eax,%eax
+  80311e:	0f 88 04 01 00 00    	js     803228 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803124:	83 ec 0c             	sub    $0xc,%esp
+  803127:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80312a:	50                   	push   %eax
+  80312b:	e8 d6 f0 ff ff       	call   802206 <fd_alloc>
+  803130:	89 c3                	mov    %eax,%ebx
+  803132:	83 c4 10             	add    $0x10,%esp
+  803135:	85 c0                	test   %eax,%eax
+  803137:	0f 88 db 00 00 00    	js     803218 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80313d:	83 ec 04             	sub    $0x4,%esp
+  803140:	68 07 04 00 00       	push   $0x407
+  803145:	ff 75 f0             	push   -0x10(%ebp)
+  803148:	6a 00                	push   $0x0
+  80314a:	e8 92 dd ff ff       	call   800ee1 <sys_page_alloc>
+  80314f:	89 c3                	mov    %eax,%ebx
+  803151:	83 c4 10             	add    $0x10,%esp
+  803154:	85 c0                	test   %eax,%eax
+  803156:	0f 88 bc 00 00 00    	js     803218 <pipe+0x131>
+	va = fd2data(fd0);
+  80315c:	83 ec 0c             	sub    $0xc,%esp
+  80315f:	ff 75 f4             	push   -0xc(%ebp)
+  803162:	e8 88 f0 ff ff       	call   8021ef <fd2data>
+  803167:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803169:	83 c4 0c             	add    $0xc,%esp
+  80316c:	68 07 04 00 00       	push   $0x407
+  803171:	50                   	push   %eax
+  803172:	6a 00                	push   $0x0
+  803174:	e8 68 dd ff ff       	call   800ee1 <sys_page_alloc>
+  803179:	89 c3                	mov    %eax,%ebx
+  80317b:	83 c4 10             	add    $0x10,%esp
+  80317e:	85 c0                	test   %eax,%eax
+  803180:	0f 88 82 00 00 00    	js     803208 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803186:	83 ec 0c             	sub    $0xc,%esp
+  803189:	ff 75 f0             	push   -0x10(%ebp)
+  80318c:	e8 5e f0 ff ff       	call   8021ef <fd2data>
+  803191:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803198:	50                   	push   %eax
+  803199:	6a 00                	push   $0x0
+  80319b:	56                   	push   %esi
+  80319c:	6a 00                	push   $0x0
+  80319e:	e8 ab dd ff ff       	call   800f4e <sys_page_map>
+  8031a3:	89 c3                	mov    %eax,%ebx
+  8031a5:	83 c4 20             	add    $0x20,%esp
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	78 4e                	js     8031fa <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031ac:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8031b1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031b4:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031b6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031b9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031c0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031c3:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031c8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031cf:	83 ec 0c             	sub    $0xc,%esp
+  8031d2:	ff 75 f4             	push   -0xc(%ebp)
+  8031d5:	e8 05 f0 ff ff       	call   8021df <fd2num>
+  8031da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031dd:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031df:	83 c4 04             	add    $0x4,%esp
+  8031e2:	ff 75 f0             	push   -0x10(%ebp)
+  8031e5:	e8 f5 ef ff ff       	call   8021df <fd2num>
+  8031ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031ed:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031f0:	83 c4 10             	add    $0x10,%esp
+  8031f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f8:	eb 2e                	jmp    803228 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031fa:	83 ec 08             	sub    $0x8,%esp
+  8031fd:	56                   	push   %esi
+  8031fe:	6a 00                	push   $0x0
+  803200:	e8 b7 dd ff ff       	call   800fbc <sys_page_unmap>
+  803205:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803208:	83 ec 08             	sub    $0x8,%esp
+  80320b:	ff 75 f0             	push   -0x10(%ebp)
+  80320e:	6a 00                	push   $0x0
+  803210:	e8 a7 dd ff ff       	call   800fbc <sys_page_unmap>
+  803215:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803218:	83 ec 08             	sub    $0x8,%esp
+  80321b:	ff 75 f4             	push   -0xc(%ebp)
+  80321e:	6a 00                	push   $0x0
+  803220:	e8 97 dd ff ff       	call   800fbc <sys_page_unmap>
+  803225:	83 c4 10             	add    $0x10,%esp
+}
+  803228:	89 d8                	mov    %ebx,%eax
+  80322a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80322d:	5b                   	pop    %ebx
+  80322e:	5e                   	pop    %esi
+  80322f:	5d                   	pop    %ebp
+  803230:	c3                   	ret
+
+00803231 <pipeisclosed>:
+{
+  803231:	55                   	push   %ebp
+  803232:	89 e5                	mov    %esp,%ebp
+  803234:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803237:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80323a:	50                   	push   %eax
+  80323b:	ff 75 08             	push   0x8(%ebp)
+  80323e:	e8 19 f0 ff ff       	call   80225c <fd_lookup>
+  803243:	83 c4 10             	add    $0x10,%esp
+  803246:	85 c0                	test   %eax,%eax
+  803248:	78 18                	js     803262 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80324a:	83 ec 0c             	sub    $0xc,%esp
+  80324d:	ff 75 f4             	push   -0xc(%ebp)
+  803250:	e8 9a ef ff ff       	call   8021ef <fd2data>
+  803255:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803257:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80325a:	e8 cb fc ff ff       	call   802f2a <_pipeisclosed>
+  80325f:	83 c4 10             	add    $0x10,%esp
+}
+  803262:	c9                   	leave
+  803263:	c3                   	ret
+
+00803264 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803264:	b8 00 00 00 00       	mov    $0x0,%eax
+  803269:	c3                   	ret
+
+0080326a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80326a:	55                   	push   %ebp
+  80326b:	89 e5                	mov    %esp,%ebp
+  80326d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803270:	68 1e 3b 80 00       	push   $0x803b1e
+  803275:	ff 75 0c             	push   0xc(%ebp)
+  803278:	e8 6c d7 ff ff       	call   8009e9 <strcpy>
+	return 0;
+}
+  80327d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803282:	c9                   	leave
+  803283:	c3                   	ret
+
+00803284 <devcons_write>:
+{
+  803284:	55                   	push   %ebp
+  803285:	89 e5                	mov    %esp,%ebp
+  803287:	57                   	push   %edi
+  803288:	56                   	push   %esi
+  803289:	53                   	push   %ebx
+  80328a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803290:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803295:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80329b:	eb 2e                	jmp    8032cb <devcons_write+0x47>
+		m = n - tot;
+  80329d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8032a0:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8032a2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032a7:	39 c3                	cmp    %eax,%ebx
+  8032a9:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8032ac:	83 ec 04             	sub    $0x4,%esp
+  8032af:	53                   	push   %ebx
+  8032b0:	89 f0                	mov    %esi,%eax
+  8032b2:	03 45 0c             	add    0xc(%ebp),%eax
+  8032b5:	50                   	push   %eax
+  8032b6:	57                   	push   %edi
+  8032b7:	e8 b3 d8 ff ff       	call   800b6f <memmove>
+		sys_cputs(buf, m);
+  8032bc:	83 c4 08             	add    $0x8,%esp
+  8032bf:	53                   	push   %ebx
+  8032c0:	57                   	push   %edi
+  8032c1:	e8 9c da ff ff       	call   800d62 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8032c6:	01 de                	add    %ebx,%esi
+  8032c8:	83 c4 10             	add    $0x10,%esp
+  8032cb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8032ce:	72 cd                	jb     80329d <devcons_write+0x19>
+}
+  8032d0:	89 f0                	mov    %esi,%eax
+  8032d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032d5:	5b                   	pop    %ebx
+  8032d6:	5e                   	pop    %esi
+  8032d7:	5f                   	pop    %edi
+  8032d8:	5d                   	pop    %ebp
+  8032d9:	c3                   	ret
+
+008032da <devcons_read>:
+{
+  8032da:	55                   	push   %ebp
+  8032db:	89 e5                	mov    %esp,%ebp
+  8032dd:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8032e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032e9:	75 07                	jne    8032f2 <devcons_read+0x18>
+  8032eb:	eb 1f                	jmp    80330c <devcons_read+0x32>
+		sys_yield();
+  8032ed:	e8 a9 db ff ff       	call   800e9b <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8032f2:	e8 af da ff ff       	call   800da6 <sys_cgetc>
+  8032f7:	85 c0                	test   %eax,%eax
+  8032f9:	74 f2                	je     8032ed <devcons_read+0x13>
+	if (c < 0)
+  8032fb:	78 0f                	js     80330c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8032fd:	83 f8 04             	cmp    $0x4,%eax
+  803300:	74 0c                	je     80330e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803302:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803305:	88 02                	mov    %al,(%edx)
+	return 1;
+  803307:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80330c:	c9                   	leave
+  80330d:	c3                   	ret
+		return 0;
+  80330e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803313:	eb f7                	jmp    80330c <devcons_read+0x32>
+
+00803315 <cputchar>:
+{
+  803315:	55                   	push   %ebp
+  803316:	89 e5                	mov    %esp,%ebp
+  803318:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80331b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80331e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803321:	6a 01                	push   $0x1
+  803323:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803326:	50                   	push   %eax
+  803327:	e8 36 da ff ff       	call   800d62 <sys_cputs>
+}
+  80332c:	83 c4 10             	add    $0x10,%esp
+  80332f:	c9                   	leave
+  803330:	c3                   	ret
+
+00803331 <getchar>:
+{
+  803331:	55                   	push   %ebp
+  803332:	89 e5                	mov    %esp,%ebp
+  803334:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803337:	6a 01                	push   $0x1
+  803339:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80333c:	50                   	push   %eax
+  80333d:	6a 00                	push   $0x0
+  80333f:	e8 9e f1 ff ff       	call   8024e2 <read>
+	if (r < 0)
+  803344:	83 c4 10             	add    $0x10,%esp
+  803347:	85 c0                	test   %eax,%eax
+  803349:	78 06                	js     803351 <getchar+0x20>
+	if (r < 1)
+  80334b:	74 06                	je     803353 <getchar+0x22>
+	return c;
+  80334d:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803351:	c9                   	leave
+  803352:	c3                   	ret
+		return -E_EOF;
+  803353:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803358:	eb f7                	jmp    803351 <getchar+0x20>
+
+0080335a <iscons>:
+{
+  80335a:	55                   	push   %ebp
+  80335b:	89 e5                	mov    %esp,%ebp
+  80335d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803360:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803363:	50                   	push   %eax
+  803364:	ff 75 08             	push   0x8(%ebp)
+  803367:	e8 f0 ee ff ff       	call   80225c <fd_lookup>
+  80336c:	83 c4 10             	add    $0x10,%esp
+  80336f:	85 c0                	test   %eax,%eax
+  803371:	78 11                	js     803384 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803373:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803376:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80337c:	39 10                	cmp    %edx,(%eax)
+  80337e:	0f 94 c0             	sete   %al
+  803381:	0f b6 c0             	movzbl %al,%eax
+}
+  803384:	c9                   	leave
+  803385:	c3                   	ret
+
+00803386 <opencons>:
+{
+  803386:	55                   	push   %ebp
+  803387:	89 e5                	mov    %esp,%ebp
+  803389:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80338c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80338f:	50                   	push   %eax
+  803390:	e8 71 ee ff ff       	call   802206 <fd_alloc>
+  803395:	83 c4 10             	add    $0x10,%esp
+  803398:	85 c0                	test   %eax,%eax
+  80339a:	78 3a                	js     8033d6 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80339c:	83 ec 04             	sub    $0x4,%esp
+  80339f:	68 07 04 00 00       	push   $0x407
+  8033a4:	ff 75 f4             	push   -0xc(%ebp)
+  8033a7:	6a 00                	push   $0x0
+  8033a9:	e8 33 db ff ff       	call   800ee1 <sys_page_alloc>
+  8033ae:	83 c4 10             	add    $0x10,%esp
+  8033b1:	85 c0                	test   %eax,%eax
+  8033b3:	78 21                	js     8033d6 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8033b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033b8:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8033be:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8033c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033c3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8033ca:	83 ec 0c             	sub    $0xc,%esp
+  8033cd:	50                   	push   %eax
+  8033ce:	e8 0c ee ff ff       	call   8021df <fd2num>
+  8033d3:	83 c4 10             	add    $0x10,%esp
+}
+  8033d6:	c9                   	leave
+  8033d7:	c3                   	ret
+
+008033d8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8033d8:	55                   	push   %ebp
+  8033d9:	89 e5                	mov    %esp,%ebp
+  8033db:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8033de:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8033e5:	74 0a                	je     8033f1 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8033e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ea:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8033ef:	c9                   	leave
+  8033f0:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8033f1:	83 ec 04             	sub    $0x4,%esp
+  8033f4:	6a 07                	push   $0x7
+  8033f6:	68 00 f0 bf ee       	push   $0xeebff000
+  8033fb:	6a 00                	push   $0x0
+  8033fd:	e8 df da ff ff       	call   800ee1 <sys_page_alloc>
+  803402:	83 c4 10             	add    $0x10,%esp
+  803405:	85 c0                	test   %eax,%eax
+  803407:	78 14                	js     80341d <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803409:	83 ec 08             	sub    $0x8,%esp
+  80340c:	68 3f 34 80 00       	push   $0x80343f
+  803411:	6a 00                	push   $0x0
+  803413:	e8 e5 dc ff ff       	call   8010fd <sys_env_set_pgfault_upcall>
+  803418:	83 c4 10             	add    $0x10,%esp
+  80341b:	eb ca                	jmp    8033e7 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  80341d:	83 ec 08             	sub    $0x8,%esp
+  803420:	50                   	push   %eax
+  803421:	68 2a 3b 80 00       	push   $0x803b2a
+  803426:	e8 76 cf ff ff       	call   8003a1 <cprintf>
+			panic("set_pgfault_handler error");
+  80342b:	83 c4 0c             	add    $0xc,%esp
+  80342e:	68 35 3b 80 00       	push   $0x803b35
+  803433:	6a 24                	push   $0x24
+  803435:	68 4f 3b 80 00       	push   $0x803b4f
+  80343a:	e8 87 ce ff ff       	call   8002c6 <_panic>
+
+0080343f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80343f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803440:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803445:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803447:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  80344a:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80344e:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803451:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803455:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803457:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  80345b:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  80345c:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803460:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803461:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803462:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803466:	c3                   	ret
+
+00803467 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803467:	55                   	push   %ebp
+  803468:	89 e5                	mov    %esp,%ebp
+  80346a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80346d:	89 c2                	mov    %eax,%edx
+  80346f:	c1 ea 16             	shr    $0x16,%edx
+  803472:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803479:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80347e:	f6 c1 01             	test   $0x1,%cl
+  803481:	74 1a                	je     80349d <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803483:	c1 e8 0c             	shr    $0xc,%eax
+  803486:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80348d:	a8 01                	test   $0x1,%al
+  80348f:	74 0c                	je     80349d <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803491:	c1 e8 0c             	shr    $0xc,%eax
+  803494:	c1 e0 04             	shl    $0x4,%eax
+  803497:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80349d:	89 d0                	mov    %edx,%eax
+  80349f:	5d                   	pop    %ebp
+  8034a0:	c3                   	ret
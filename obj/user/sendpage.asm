@@ -0,0 +1,7190 @@
+
+obj/user/sendpage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9a 01 00 00       	call   8001cb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define TEMP_ADDR	((char*)0xa00000)
+#define TEMP_ADDR_CHILD	((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 18             	sub    $0x18,%esp
+	envid_t who;
+
+	if ((who = fork()) == 0) {
+  800039:	e8 57 1d 00 00       	call   801d95 <fork>
+  80003e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 b8 00 00 00    	je     800101 <umain+0xce>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800049:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80004b:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  800050:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800056:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80005b:	0f 86 41 01 00 00    	jbe    8001a2 <umain+0x16f>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+		return;
+	}
+
+	// Parent
+	sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800061:	8b 42 48             	mov    0x48(%edx),%eax
+  800064:	83 ec 04             	sub    $0x4,%esp
+  800067:	6a 07                	push   $0x7
+  800069:	68 00 00 a0 00       	push   $0xa00000
+  80006e:	50                   	push   %eax
+  80006f:	e8 36 0e 00 00       	call   800eaa <sys_page_alloc>
+	memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800074:	83 c4 04             	add    $0x4,%esp
+  800077:	ff 35 04 40 80 00    	push   0x804004
+  80007d:	e8 f5 08 00 00       	call   800977 <strlen>
+  800082:	83 c4 0c             	add    $0xc,%esp
+  800085:	83 c0 01             	add    $0x1,%eax
+  800088:	50                   	push   %eax
+  800089:	ff 35 04 40 80 00    	push   0x804004
+  80008f:	68 00 00 a0 00       	push   $0xa00000
+  800094:	e8 01 0b 00 00       	call   800b9a <memcpy>
+	ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800099:	6a 07                	push   $0x7
+  80009b:	68 00 00 a0 00       	push   $0xa00000
+  8000a0:	6a 00                	push   $0x0
+  8000a2:	ff 75 f4             	push   -0xc(%ebp)
+  8000a5:	e8 49 1e 00 00       	call   801ef3 <ipc_send>
+
+	ipc_recv(&who, TEMP_ADDR, 0);
+  8000aa:	83 c4 1c             	add    $0x1c,%esp
+  8000ad:	6a 00                	push   $0x0
+  8000af:	68 00 00 a0 00       	push   $0xa00000
+  8000b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000b7:	50                   	push   %eax
+  8000b8:	e8 1e 1e 00 00       	call   801edb <ipc_recv>
+	cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  8000bd:	83 c4 0c             	add    $0xc,%esp
+  8000c0:	68 00 00 a0 00       	push   $0xa00000
+  8000c5:	ff 75 f4             	push   -0xc(%ebp)
+  8000c8:	68 80 34 80 00       	push   $0x803480
+  8000cd:	e8 98 02 00 00       	call   80036a <cprintf>
+	if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  8000d2:	83 c4 04             	add    $0x4,%esp
+  8000d5:	ff 35 00 40 80 00    	push   0x804000
+  8000db:	e8 97 08 00 00       	call   800977 <strlen>
+  8000e0:	83 c4 0c             	add    $0xc,%esp
+  8000e3:	50                   	push   %eax
+  8000e4:	ff 35 00 40 80 00    	push   0x804000
+  8000ea:	68 00 00 a0 00       	push   $0xa00000
+  8000ef:	e8 95 09 00 00       	call   800a89 <strncmp>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	0f 84 b7 00 00 00    	je     8001b6 <umain+0x183>
+		cprintf("parent received correct message\n");
+	return;
+}
+  8000ff:	c9                   	leave
+  800100:	c3                   	ret
+		ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  800101:	83 ec 04             	sub    $0x4,%esp
+  800104:	6a 00                	push   $0x0
+  800106:	68 00 00 b0 00       	push   $0xb00000
+  80010b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80010e:	50                   	push   %eax
+  80010f:	e8 c7 1d 00 00       	call   801edb <ipc_recv>
+		cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  800114:	83 c4 0c             	add    $0xc,%esp
+  800117:	68 00 00 b0 00       	push   $0xb00000
+  80011c:	ff 75 f4             	push   -0xc(%ebp)
+  80011f:	68 80 34 80 00       	push   $0x803480
+  800124:	e8 41 02 00 00       	call   80036a <cprintf>
+		if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  800129:	83 c4 04             	add    $0x4,%esp
+  80012c:	ff 35 04 40 80 00    	push   0x804004
+  800132:	e8 40 08 00 00       	call   800977 <strlen>
+  800137:	83 c4 0c             	add    $0xc,%esp
+  80013a:	50                   	push   %eax
+  80013b:	ff 35 04 40 80 00    	push   0x804004
+  800141:	68 00 00 b0 00       	push   $0xb00000
+  800146:	e8 3e 09 00 00       	call   800a89 <strncmp>
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	85 c0                	test   %eax,%eax
+  800150:	74 3e                	je     800190 <umain+0x15d>
+		memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  800152:	83 ec 0c             	sub    $0xc,%esp
+  800155:	ff 35 00 40 80 00    	push   0x804000
+  80015b:	e8 17 08 00 00       	call   800977 <strlen>
+  800160:	83 c4 0c             	add    $0xc,%esp
+  800163:	83 c0 01             	add    $0x1,%eax
+  800166:	50                   	push   %eax
+  800167:	ff 35 00 40 80 00    	push   0x804000
+  80016d:	68 00 00 b0 00       	push   $0xb00000
+  800172:	e8 23 0a 00 00       	call   800b9a <memcpy>
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  800177:	6a 07                	push   $0x7
+  800179:	68 00 00 b0 00       	push   $0xb00000
+  80017e:	6a 00                	push   $0x0
+  800180:	ff 75 f4             	push   -0xc(%ebp)
+  800183:	e8 6b 1d 00 00       	call   801ef3 <ipc_send>
+		return;
+  800188:	83 c4 20             	add    $0x20,%esp
+  80018b:	e9 6f ff ff ff       	jmp    8000ff <umain+0xcc>
+			cprintf("child received correct message\n");
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 94 34 80 00       	push   $0x803494
+  800198:	e8 cd 01 00 00       	call   80036a <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	eb b0                	jmp    800152 <umain+0x11f>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8001a2:	c1 e8 10             	shr    $0x10,%eax
+  8001a5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001ab:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8001b1:	e9 ab fe ff ff       	jmp    800061 <umain+0x2e>
+		cprintf("parent received correct message\n");
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	68 b4 34 80 00       	push   $0x8034b4
+  8001be:	e8 a7 01 00 00       	call   80036a <cprintf>
+  8001c3:	83 c4 10             	add    $0x10,%esp
+  8001c6:	e9 34 ff ff ff       	jmp    8000ff <umain+0xcc>
+
+008001cb <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	57                   	push   %edi
+  8001cf:	56                   	push   %esi
+  8001d0:	53                   	push   %ebx
+  8001d1:	83 ec 0c             	sub    $0xc,%esp
+  8001d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8001d7:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001da:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001df:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8001e1:	c1 ea 0b             	shr    $0xb,%edx
+  8001e4:	83 f2 01             	xor    $0x1,%edx
+  8001e7:	83 e2 01             	and    $0x1,%edx
+  8001ea:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8001f0:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8001f7:	00 00 00 
+	envid = sys_getenvid();
+  8001fa:	e8 1f 0c 00 00       	call   800e1e <sys_getenvid>
+  8001ff:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800201:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800206:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80020c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800212:	8b 52 48             	mov    0x48(%edx),%edx
+  800215:	39 ca                	cmp    %ecx,%edx
+  800217:	74 27                	je     800240 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800219:	83 c0 01             	add    $0x1,%eax
+  80021c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800221:	75 e3                	jne    800206 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800223:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80022a:	75 24                	jne    800250 <libmain+0x85>
+		panic("libmain can't find the environment");
+  80022c:	83 ec 04             	sub    $0x4,%esp
+  80022f:	68 24 35 80 00       	push   $0x803524
+  800234:	6a 23                	push   $0x23
+  800236:	68 47 35 80 00       	push   $0x803547
+  80023b:	e8 4f 00 00 00       	call   80028f <_panic>
+			mainenv = &envs[i];
+  800240:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800246:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80024b:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800250:	85 ff                	test   %edi,%edi
+  800252:	7e 07                	jle    80025b <libmain+0x90>
+		binaryname = argv[0];
+  800254:	8b 06                	mov    (%esi),%eax
+  800256:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// call user main routine
+	umain(argc, argv);
+  80025b:	83 ec 08             	sub    $0x8,%esp
+  80025e:	56                   	push   %esi
+  80025f:	57                   	push   %edi
+  800260:	e8 ce fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800265:	e8 0b 00 00 00       	call   800275 <exit>
+}
+  80026a:	83 c4 10             	add    $0x10,%esp
+  80026d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800270:	5b                   	pop    %ebx
+  800271:	5e                   	pop    %esi
+  800272:	5f                   	pop    %edi
+  800273:	5d                   	pop    %ebp
+  800274:	c3                   	ret
+
+00800275 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80027b:	e8 1c 21 00 00       	call   80239c <close_all>
+	sys_env_destroy(0);
+  800280:	83 ec 0c             	sub    $0xc,%esp
+  800283:	6a 00                	push   $0x0
+  800285:	e8 2b 0b 00 00       	call   800db5 <sys_env_destroy>
+}
+  80028a:	83 c4 10             	add    $0x10,%esp
+  80028d:	c9                   	leave
+  80028e:	c3                   	ret
+
+0080028f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80028f:	55                   	push   %ebp
+  800290:	89 e5                	mov    %esp,%ebp
+  800292:	56                   	push   %esi
+  800293:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800294:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800297:	8b 35 08 40 80 00    	mov    0x804008,%esi
+  80029d:	e8 7c 0b 00 00       	call   800e1e <sys_getenvid>
+  8002a2:	83 ec 0c             	sub    $0xc,%esp
+  8002a5:	ff 75 0c             	push   0xc(%ebp)
+  8002a8:	ff 75 08             	push   0x8(%ebp)
+  8002ab:	56                   	push   %esi
+  8002ac:	50                   	push   %eax
+  8002ad:	68 60 35 80 00       	push   $0x803560
+  8002b2:	e8 b3 00 00 00       	call   80036a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002b7:	83 c4 18             	add    $0x18,%esp
+  8002ba:	53                   	push   %ebx
+  8002bb:	ff 75 10             	push   0x10(%ebp)
+  8002be:	e8 56 00 00 00       	call   800319 <vcprintf>
+	cprintf("\n");
+  8002c3:	c7 04 24 ef 3a 80 00 	movl   $0x803aef,(%esp)
+  8002ca:	e8 9b 00 00 00       	call   80036a <cprintf>
+  8002cf:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002d2:	cc                   	int3
+	while (1)
+  8002d3:	eb fd                	jmp    8002d2 <_panic+0x43>
+
+008002d5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	53                   	push   %ebx
+  8002d9:	83 ec 04             	sub    $0x4,%esp
+  8002dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002df:	8b 13                	mov    (%ebx),%edx
+  8002e1:	8d 42 01             	lea    0x1(%edx),%eax
+  8002e4:	89 03                	mov    %eax,(%ebx)
+  8002e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002e9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002ed:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002f2:	74 09                	je     8002fd <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002f4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002fb:	c9                   	leave
+  8002fc:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002fd:	83 ec 08             	sub    $0x8,%esp
+  800300:	68 ff 00 00 00       	push   $0xff
+  800305:	8d 43 08             	lea    0x8(%ebx),%eax
+  800308:	50                   	push   %eax
+  800309:	e8 1d 0a 00 00       	call   800d2b <sys_cputs>
+		b->idx = 0;
+  80030e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800314:	83 c4 10             	add    $0x10,%esp
+  800317:	eb db                	jmp    8002f4 <putch+0x1f>
+
+00800319 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800319:	55                   	push   %ebp
+  80031a:	89 e5                	mov    %esp,%ebp
+  80031c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800322:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800329:	00 00 00 
+	b.cnt = 0;
+  80032c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800333:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800336:	ff 75 0c             	push   0xc(%ebp)
+  800339:	ff 75 08             	push   0x8(%ebp)
+  80033c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800342:	50                   	push   %eax
+  800343:	68 d5 02 80 00       	push   $0x8002d5
+  800348:	e8 fb 00 00 00       	call   800448 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80034d:	83 c4 08             	add    $0x8,%esp
+  800350:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800356:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80035c:	50                   	push   %eax
+  80035d:	e8 c9 09 00 00       	call   800d2b <sys_cputs>
+
+	return b.cnt;
+}
+  800362:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800368:	c9                   	leave
+  800369:	c3                   	ret
+
+0080036a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80036a:	55                   	push   %ebp
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800370:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800373:	50                   	push   %eax
+  800374:	ff 75 08             	push   0x8(%ebp)
+  800377:	e8 9d ff ff ff       	call   800319 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80037c:	c9                   	leave
+  80037d:	c3                   	ret
+
+0080037e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80037e:	55                   	push   %ebp
+  80037f:	89 e5                	mov    %esp,%ebp
+  800381:	57                   	push   %edi
+  800382:	56                   	push   %esi
+  800383:	53                   	push   %ebx
+  800384:	83 ec 1c             	sub    $0x1c,%esp
+  800387:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80038a:	89 d6                	mov    %edx,%esi
+  80038c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80038f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800392:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800395:	73 0b                	jae    8003a2 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800397:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80039a:	c1 e7 08             	shl    $0x8,%edi
+  80039d:	0b 7d 10             	or     0x10(%ebp),%edi
+  8003a0:	eb 36                	jmp    8003d8 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8003a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003aa:	f7 75 08             	divl   0x8(%ebp)
+  8003ad:	89 c1                	mov    %eax,%ecx
+  8003af:	ff 75 14             	push   0x14(%ebp)
+  8003b2:	ff 75 10             	push   0x10(%ebp)
+  8003b5:	83 eb 01             	sub    $0x1,%ebx
+  8003b8:	53                   	push   %ebx
+  8003b9:	ff 75 08             	push   0x8(%ebp)
+  8003bc:	89 f2                	mov    %esi,%edx
+  8003be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003c1:	e8 b8 ff ff ff       	call   80037e <printnum>
+  8003c6:	83 c4 10             	add    $0x10,%esp
+  8003c9:	eb 14                	jmp    8003df <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8003cb:	83 ec 08             	sub    $0x8,%esp
+  8003ce:	56                   	push   %esi
+  8003cf:	57                   	push   %edi
+  8003d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003d3:	ff d0                	call   *%eax
+  8003d5:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003d8:	83 eb 01             	sub    $0x1,%ebx
+  8003db:	85 db                	test   %ebx,%ebx
+  8003dd:	7f ec                	jg     8003cb <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8003df:	83 ec 08             	sub    $0x8,%esp
+  8003e2:	56                   	push   %esi
+  8003e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003eb:	f7 75 08             	divl   0x8(%ebp)
+  8003ee:	0f be 92 83 35 80 00 	movsbl 0x803583(%edx),%edx
+  8003f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f8:	c1 e0 08             	shl    $0x8,%eax
+  8003fb:	09 d0                	or     %edx,%eax
+  8003fd:	50                   	push   %eax
+  8003fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800401:	ff d0                	call   *%eax
+}
+  800403:	83 c4 10             	add    $0x10,%esp
+  800406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800409:	5b                   	pop    %ebx
+  80040a:	5e                   	pop    %esi
+  80040b:	5f                   	pop    %edi
+  80040c:	5d                   	pop    %ebp
+  80040d:	c3                   	ret
+
+0080040e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80040e:	55                   	push   %ebp
+  80040f:	89 e5                	mov    %esp,%ebp
+  800411:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800414:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800418:	8b 10                	mov    (%eax),%edx
+  80041a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80041d:	73 0a                	jae    800429 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80041f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800422:	89 08                	mov    %ecx,(%eax)
+  800424:	8b 45 08             	mov    0x8(%ebp),%eax
+  800427:	88 02                	mov    %al,(%edx)
+}
+  800429:	5d                   	pop    %ebp
+  80042a:	c3                   	ret
+
+0080042b <printfmt>:
+{
+  80042b:	55                   	push   %ebp
+  80042c:	89 e5                	mov    %esp,%ebp
+  80042e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800431:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800434:	50                   	push   %eax
+  800435:	ff 75 10             	push   0x10(%ebp)
+  800438:	ff 75 0c             	push   0xc(%ebp)
+  80043b:	ff 75 08             	push   0x8(%ebp)
+  80043e:	e8 05 00 00 00       	call   800448 <vprintfmt>
+}
+  800443:	83 c4 10             	add    $0x10,%esp
+  800446:	c9                   	leave
+  800447:	c3                   	ret
+
+00800448 <vprintfmt>:
+{
+  800448:	55                   	push   %ebp
+  800449:	89 e5                	mov    %esp,%ebp
+  80044b:	57                   	push   %edi
+  80044c:	56                   	push   %esi
+  80044d:	53                   	push   %ebx
+  80044e:	83 ec 3c             	sub    $0x3c,%esp
+  800451:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800454:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800457:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80045e:	eb 16                	jmp    800476 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800460:	83 ec 08             	sub    $0x8,%esp
+  800463:	ff 75 0c             	push   0xc(%ebp)
+  800466:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800469:	c1 e2 08             	shl    $0x8,%edx
+  80046c:	09 d0                	or     %edx,%eax
+  80046e:	50                   	push   %eax
+  80046f:	ff d7                	call   *%edi
+  800471:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800474:	89 de                	mov    %ebx,%esi
+  800476:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800479:	0f b6 06             	movzbl (%esi),%eax
+  80047c:	83 f8 25             	cmp    $0x25,%eax
+  80047f:	74 0c                	je     80048d <vprintfmt+0x45>
+			if (ch == '\0')
+  800481:	85 c0                	test   %eax,%eax
+  800483:	75 db                	jne    800460 <vprintfmt+0x18>
+}
+  800485:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800488:	5b                   	pop    %ebx
+  800489:	5e                   	pop    %esi
+  80048a:	5f                   	pop    %edi
+  80048b:	5d                   	pop    %ebp
+  80048c:	c3                   	ret
+		padc = ' ';
+  80048d:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800491:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800498:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80049f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ab:	8d 73 01             	lea    0x1(%ebx),%esi
+  8004ae:	0f b6 13             	movzbl (%ebx),%edx
+  8004b1:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004b4:	3c 55                	cmp    $0x55,%al
+  8004b6:	0f 87 2c 04 00 00    	ja     8008e8 <vprintfmt+0x4a0>
+  8004bc:	0f b6 c0             	movzbl %al,%eax
+  8004bf:	ff 24 85 c0 36 80 00 	jmp    *0x8036c0(,%eax,4)
+  8004c6:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8004c8:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8004cc:	eb dd                	jmp    8004ab <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ce:	89 f3                	mov    %esi,%ebx
+  8004d0:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8004d4:	eb d5                	jmp    8004ab <vprintfmt+0x63>
+  8004d6:	0f b6 d2             	movzbl %dl,%edx
+  8004d9:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8004db:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8004e0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004e3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004e7:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8004ea:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8004ed:	83 fe 09             	cmp    $0x9,%esi
+  8004f0:	0f 87 8a 00 00 00    	ja     800580 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8004f6:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8004f9:	eb e5                	jmp    8004e0 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8004fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fe:	8b 00                	mov    (%eax),%eax
+  800500:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800503:	8b 45 14             	mov    0x14(%ebp),%eax
+  800506:	8d 40 04             	lea    0x4(%eax),%eax
+  800509:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80050c:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80050e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800512:	79 97                	jns    8004ab <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800514:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800517:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800521:	eb 88                	jmp    8004ab <vprintfmt+0x63>
+			if (width < 0)
+  800523:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800526:	85 db                	test   %ebx,%ebx
+  800528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052d:	0f 49 c3             	cmovns %ebx,%eax
+  800530:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800533:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800535:	e9 71 ff ff ff       	jmp    8004ab <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80053a:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80053c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800543:	e9 63 ff ff ff       	jmp    8004ab <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800548:	8d 73 02             	lea    0x2(%ebx),%esi
+  80054b:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80054f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800556:	3c 67                	cmp    $0x67,%al
+  800558:	0f 84 18 ff ff ff    	je     800476 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80055e:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800565:	3c 72                	cmp    $0x72,%al
+  800567:	0f 84 09 ff ff ff    	je     800476 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80056d:	3c 62                	cmp    $0x62,%al
+  80056f:	0f 94 c0             	sete   %al
+  800572:	0f b6 c0             	movzbl %al,%eax
+  800575:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800578:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80057b:	e9 f6 fe ff ff       	jmp    800476 <vprintfmt+0x2e>
+  800580:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800583:	eb 89                	jmp    80050e <vprintfmt+0xc6>
+			lflag++;
+  800585:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800588:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80058a:	e9 1c ff ff ff       	jmp    8004ab <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8d 58 04             	lea    0x4(%eax),%ebx
+  800595:	83 ec 08             	sub    $0x8,%esp
+  800598:	ff 75 0c             	push   0xc(%ebp)
+  80059b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80059e:	c1 e0 08             	shl    $0x8,%eax
+  8005a1:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005a4:	0b 01                	or     (%ecx),%eax
+  8005a6:	50                   	push   %eax
+  8005a7:	ff d7                	call   *%edi
+			break;
+  8005a9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005ac:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8005af:	e9 c2 fe ff ff       	jmp    800476 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8005b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b7:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8005ba:	8b 10                	mov    (%eax),%edx
+  8005bc:	89 d0                	mov    %edx,%eax
+  8005be:	f7 d8                	neg    %eax
+  8005c0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005c3:	83 f8 12             	cmp    $0x12,%eax
+  8005c6:	7f 25                	jg     8005ed <vprintfmt+0x1a5>
+  8005c8:	8b 14 85 20 38 80 00 	mov    0x803820(,%eax,4),%edx
+  8005cf:	85 d2                	test   %edx,%edx
+  8005d1:	74 1a                	je     8005ed <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8005d3:	52                   	push   %edx
+  8005d4:	68 62 39 80 00       	push   $0x803962
+  8005d9:	ff 75 0c             	push   0xc(%ebp)
+  8005dc:	57                   	push   %edi
+  8005dd:	e8 49 fe ff ff       	call   80042b <printfmt>
+  8005e2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e5:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8005e8:	e9 89 fe ff ff       	jmp    800476 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8005ed:	50                   	push   %eax
+  8005ee:	68 9b 35 80 00       	push   $0x80359b
+  8005f3:	ff 75 0c             	push   0xc(%ebp)
+  8005f6:	57                   	push   %edi
+  8005f7:	e8 2f fe ff ff       	call   80042b <printfmt>
+  8005fc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005ff:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800602:	e9 6f fe ff ff       	jmp    800476 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	83 c0 04             	add    $0x4,%eax
+  80060d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800615:	85 c9                	test   %ecx,%ecx
+  800617:	b8 94 35 80 00       	mov    $0x803594,%eax
+  80061c:	0f 45 c1             	cmovne %ecx,%eax
+  80061f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800622:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800626:	7e 06                	jle    80062e <vprintfmt+0x1e6>
+  800628:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80062c:	75 1a                	jne    800648 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80062e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800631:	c1 e0 08             	shl    $0x8,%eax
+  800634:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800637:	83 c8 3f             	or     $0x3f,%eax
+  80063a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80063d:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800640:	89 75 10             	mov    %esi,0x10(%ebp)
+  800643:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800646:	eb 6d                	jmp    8006b5 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800648:	83 ec 08             	sub    $0x8,%esp
+  80064b:	ff 75 d0             	push   -0x30(%ebp)
+  80064e:	ff 75 c8             	push   -0x38(%ebp)
+  800651:	e8 39 03 00 00       	call   80098f <strnlen>
+  800656:	89 c2                	mov    %eax,%edx
+  800658:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80065b:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80065d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800660:	c1 e1 08             	shl    $0x8,%ecx
+  800663:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800667:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800669:	83 c4 10             	add    $0x10,%esp
+  80066c:	89 c3                	mov    %eax,%ebx
+  80066e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800671:	89 75 10             	mov    %esi,0x10(%ebp)
+  800674:	89 ce                	mov    %ecx,%esi
+  800676:	eb 0f                	jmp    800687 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800678:	83 ec 08             	sub    $0x8,%esp
+  80067b:	ff 75 0c             	push   0xc(%ebp)
+  80067e:	56                   	push   %esi
+  80067f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800681:	83 eb 01             	sub    $0x1,%ebx
+  800684:	83 c4 10             	add    $0x10,%esp
+  800687:	85 db                	test   %ebx,%ebx
+  800689:	7f ed                	jg     800678 <vprintfmt+0x230>
+  80068b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80068e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800691:	85 c0                	test   %eax,%eax
+  800693:	ba 00 00 00 00       	mov    $0x0,%edx
+  800698:	0f 49 d0             	cmovns %eax,%edx
+  80069b:	29 d0                	sub    %edx,%eax
+  80069d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006a0:	eb 8c                	jmp    80062e <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8006a2:	83 ec 08             	sub    $0x8,%esp
+  8006a5:	ff 75 0c             	push   0xc(%ebp)
+  8006a8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006ab:	09 c2                	or     %eax,%edx
+  8006ad:	52                   	push   %edx
+  8006ae:	ff d7                	call   *%edi
+  8006b0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006b3:	89 d9                	mov    %ebx,%ecx
+  8006b5:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8006b8:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8006bc:	0f be d0             	movsbl %al,%edx
+  8006bf:	85 d2                	test   %edx,%edx
+  8006c1:	74 2a                	je     8006ed <vprintfmt+0x2a5>
+  8006c3:	85 f6                	test   %esi,%esi
+  8006c5:	78 05                	js     8006cc <vprintfmt+0x284>
+  8006c7:	83 ee 01             	sub    $0x1,%esi
+  8006ca:	78 3b                	js     800707 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006cc:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006d0:	74 d0                	je     8006a2 <vprintfmt+0x25a>
+  8006d2:	0f be c0             	movsbl %al,%eax
+  8006d5:	83 e8 20             	sub    $0x20,%eax
+  8006d8:	83 f8 5e             	cmp    $0x5e,%eax
+  8006db:	76 c5                	jbe    8006a2 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8006dd:	83 ec 08             	sub    $0x8,%esp
+  8006e0:	ff 75 0c             	push   0xc(%ebp)
+  8006e3:	ff 75 cc             	push   -0x34(%ebp)
+  8006e6:	ff d7                	call   *%edi
+  8006e8:	83 c4 10             	add    $0x10,%esp
+  8006eb:	eb c6                	jmp    8006b3 <vprintfmt+0x26b>
+  8006ed:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006f0:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8006f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f6:	01 c3                	add    %eax,%ebx
+  8006f8:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8006fa:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006fd:	83 c8 20             	or     $0x20,%eax
+  800700:	89 75 10             	mov    %esi,0x10(%ebp)
+  800703:	89 c6                	mov    %eax,%esi
+  800705:	eb 14                	jmp    80071b <vprintfmt+0x2d3>
+  800707:	8b 75 10             	mov    0x10(%ebp),%esi
+  80070a:	eb e4                	jmp    8006f0 <vprintfmt+0x2a8>
+  80070c:	83 ec 08             	sub    $0x8,%esp
+  80070f:	ff 75 0c             	push   0xc(%ebp)
+  800712:	56                   	push   %esi
+  800713:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800715:	83 eb 01             	sub    $0x1,%ebx
+  800718:	83 c4 10             	add    $0x10,%esp
+  80071b:	85 db                	test   %ebx,%ebx
+  80071d:	7f ed                	jg     80070c <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80071f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800722:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800725:	89 45 14             	mov    %eax,0x14(%ebp)
+  800728:	e9 49 fd ff ff       	jmp    800476 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80072d:	83 f9 01             	cmp    $0x1,%ecx
+  800730:	7f 1f                	jg     800751 <vprintfmt+0x309>
+	else if (lflag)
+  800732:	85 c9                	test   %ecx,%ecx
+  800734:	74 69                	je     80079f <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800736:	8b 45 14             	mov    0x14(%ebp),%eax
+  800739:	8b 00                	mov    (%eax),%eax
+  80073b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80073e:	89 c1                	mov    %eax,%ecx
+  800740:	c1 f9 1f             	sar    $0x1f,%ecx
+  800743:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8d 40 04             	lea    0x4(%eax),%eax
+  80074c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074f:	eb 17                	jmp    800768 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8b 50 04             	mov    0x4(%eax),%edx
+  800757:	8b 00                	mov    (%eax),%eax
+  800759:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8d 40 08             	lea    0x8(%eax),%eax
+  800765:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800768:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80076b:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80076e:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800773:	85 db                	test   %ebx,%ebx
+  800775:	0f 89 f6 00 00 00    	jns    800871 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80077b:	83 ec 08             	sub    $0x8,%esp
+  80077e:	ff 75 0c             	push   0xc(%ebp)
+  800781:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800784:	c1 e0 08             	shl    $0x8,%eax
+  800787:	83 c8 2d             	or     $0x2d,%eax
+  80078a:	50                   	push   %eax
+  80078b:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80078d:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800790:	f7 d9                	neg    %ecx
+  800792:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800795:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80079a:	e9 d2 00 00 00       	jmp    800871 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80079f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a2:	8b 00                	mov    (%eax),%eax
+  8007a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a7:	89 c1                	mov    %eax,%ecx
+  8007a9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007ac:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b8:	eb ae                	jmp    800768 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8007ba:	83 f9 01             	cmp    $0x1,%ecx
+  8007bd:	7f 19                	jg     8007d8 <vprintfmt+0x390>
+	else if (lflag)
+  8007bf:	85 c9                	test   %ecx,%ecx
+  8007c1:	74 2a                	je     8007ed <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8007c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c6:	8b 08                	mov    (%eax),%ecx
+  8007c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ce:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8007d3:	e9 99 00 00 00       	jmp    800871 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007db:	8b 08                	mov    (%eax),%ecx
+  8007dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8007e8:	e9 84 00 00 00       	jmp    800871 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f0:	8b 08                	mov    (%eax),%ecx
+  8007f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8007fd:	eb 72                	jmp    800871 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8007ff:	83 f9 01             	cmp    $0x1,%ecx
+  800802:	7f 16                	jg     80081a <vprintfmt+0x3d2>
+	else if (lflag)
+  800804:	85 c9                	test   %ecx,%ecx
+  800806:	74 24                	je     80082c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800808:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080b:	8b 08                	mov    (%eax),%ecx
+  80080d:	8d 40 04             	lea    0x4(%eax),%eax
+  800810:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800813:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800818:	eb 57                	jmp    800871 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80081a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081d:	8b 08                	mov    (%eax),%ecx
+  80081f:	8d 40 08             	lea    0x8(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800825:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80082a:	eb 45                	jmp    800871 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80082c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082f:	8b 08                	mov    (%eax),%ecx
+  800831:	8d 40 04             	lea    0x4(%eax),%eax
+  800834:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800837:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80083c:	eb 33                	jmp    800871 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  80083e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800841:	c1 e3 08             	shl    $0x8,%ebx
+  800844:	83 ec 08             	sub    $0x8,%esp
+  800847:	ff 75 0c             	push   0xc(%ebp)
+  80084a:	89 d8                	mov    %ebx,%eax
+  80084c:	83 c8 30             	or     $0x30,%eax
+  80084f:	50                   	push   %eax
+  800850:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800852:	83 c4 08             	add    $0x8,%esp
+  800855:	ff 75 0c             	push   0xc(%ebp)
+  800858:	83 cb 78             	or     $0x78,%ebx
+  80085b:	53                   	push   %ebx
+  80085c:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80085e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800861:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800863:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800866:	8d 40 04             	lea    0x4(%eax),%eax
+  800869:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80086c:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800871:	ff 75 e4             	push   -0x1c(%ebp)
+  800874:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800878:	52                   	push   %edx
+  800879:	ff 75 e0             	push   -0x20(%ebp)
+  80087c:	50                   	push   %eax
+  80087d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800880:	89 f8                	mov    %edi,%eax
+  800882:	e8 f7 fa ff ff       	call   80037e <printnum>
+			break;
+  800887:	83 c4 10             	add    $0x10,%esp
+  80088a:	e9 e7 fb ff ff       	jmp    800476 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80088f:	83 f9 01             	cmp    $0x1,%ecx
+  800892:	7f 16                	jg     8008aa <vprintfmt+0x462>
+	else if (lflag)
+  800894:	85 c9                	test   %ecx,%ecx
+  800896:	74 24                	je     8008bc <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089b:	8b 08                	mov    (%eax),%ecx
+  80089d:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a3:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8008a8:	eb c7                	jmp    800871 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ad:	8b 08                	mov    (%eax),%ecx
+  8008af:	8d 40 08             	lea    0x8(%eax),%eax
+  8008b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008b5:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8008ba:	eb b5                	jmp    800871 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bf:	8b 08                	mov    (%eax),%ecx
+  8008c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008c7:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8008cc:	eb a3                	jmp    800871 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8008ce:	83 ec 08             	sub    $0x8,%esp
+  8008d1:	ff 75 0c             	push   0xc(%ebp)
+  8008d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008d7:	c1 e0 08             	shl    $0x8,%eax
+  8008da:	83 c8 25             	or     $0x25,%eax
+  8008dd:	50                   	push   %eax
+  8008de:	ff d7                	call   *%edi
+			break;
+  8008e0:	83 c4 10             	add    $0x10,%esp
+  8008e3:	e9 8e fb ff ff       	jmp    800476 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8008e8:	83 ec 08             	sub    $0x8,%esp
+  8008eb:	ff 75 0c             	push   0xc(%ebp)
+  8008ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008f1:	c1 e0 08             	shl    $0x8,%eax
+  8008f4:	83 c8 25             	or     $0x25,%eax
+  8008f7:	50                   	push   %eax
+  8008f8:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008fa:	83 c4 10             	add    $0x10,%esp
+  8008fd:	89 de                	mov    %ebx,%esi
+  8008ff:	eb 03                	jmp    800904 <vprintfmt+0x4bc>
+  800901:	83 ee 01             	sub    $0x1,%esi
+  800904:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800908:	75 f7                	jne    800901 <vprintfmt+0x4b9>
+  80090a:	e9 67 fb ff ff       	jmp    800476 <vprintfmt+0x2e>
+
+0080090f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80090f:	55                   	push   %ebp
+  800910:	89 e5                	mov    %esp,%ebp
+  800912:	83 ec 18             	sub    $0x18,%esp
+  800915:	8b 45 08             	mov    0x8(%ebp),%eax
+  800918:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80091b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80091e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800922:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800925:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80092c:	85 c0                	test   %eax,%eax
+  80092e:	74 26                	je     800956 <vsnprintf+0x47>
+  800930:	85 d2                	test   %edx,%edx
+  800932:	7e 22                	jle    800956 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800934:	ff 75 14             	push   0x14(%ebp)
+  800937:	ff 75 10             	push   0x10(%ebp)
+  80093a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80093d:	50                   	push   %eax
+  80093e:	68 0e 04 80 00       	push   $0x80040e
+  800943:	e8 00 fb ff ff       	call   800448 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800948:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80094b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80094e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800951:	83 c4 10             	add    $0x10,%esp
+}
+  800954:	c9                   	leave
+  800955:	c3                   	ret
+		return -E_INVAL;
+  800956:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80095b:	eb f7                	jmp    800954 <vsnprintf+0x45>
+
+0080095d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80095d:	55                   	push   %ebp
+  80095e:	89 e5                	mov    %esp,%ebp
+  800960:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800963:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800966:	50                   	push   %eax
+  800967:	ff 75 10             	push   0x10(%ebp)
+  80096a:	ff 75 0c             	push   0xc(%ebp)
+  80096d:	ff 75 08             	push   0x8(%ebp)
+  800970:	e8 9a ff ff ff       	call   80090f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800975:	c9                   	leave
+  800976:	c3                   	ret
+
+00800977 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80097d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800982:	eb 03                	jmp    800987 <strlen+0x10>
+		n++;
+  800984:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800987:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80098b:	75 f7                	jne    800984 <strlen+0xd>
+	return n;
+}
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800995:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800998:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099d:	eb 03                	jmp    8009a2 <strnlen+0x13>
+		n++;
+  80099f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a2:	39 d0                	cmp    %edx,%eax
+  8009a4:	74 08                	je     8009ae <strnlen+0x1f>
+  8009a6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009aa:	75 f3                	jne    80099f <strnlen+0x10>
+  8009ac:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009ae:	89 d0                	mov    %edx,%eax
+  8009b0:	5d                   	pop    %ebp
+  8009b1:	c3                   	ret
+
+008009b2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009b2:	55                   	push   %ebp
+  8009b3:	89 e5                	mov    %esp,%ebp
+  8009b5:	53                   	push   %ebx
+  8009b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009c5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009c8:	83 c0 01             	add    $0x1,%eax
+  8009cb:	84 d2                	test   %dl,%dl
+  8009cd:	75 f2                	jne    8009c1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009cf:	89 c8                	mov    %ecx,%eax
+  8009d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d4:	c9                   	leave
+  8009d5:	c3                   	ret
+
+008009d6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	53                   	push   %ebx
+  8009da:	83 ec 10             	sub    $0x10,%esp
+  8009dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009e0:	53                   	push   %ebx
+  8009e1:	e8 91 ff ff ff       	call   800977 <strlen>
+  8009e6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009e9:	ff 75 0c             	push   0xc(%ebp)
+  8009ec:	01 d8                	add    %ebx,%eax
+  8009ee:	50                   	push   %eax
+  8009ef:	e8 be ff ff ff       	call   8009b2 <strcpy>
+	return dst;
+}
+  8009f4:	89 d8                	mov    %ebx,%eax
+  8009f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f9:	c9                   	leave
+  8009fa:	c3                   	ret
+
+008009fb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	56                   	push   %esi
+  8009ff:	53                   	push   %ebx
+  800a00:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a03:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a06:	89 f3                	mov    %esi,%ebx
+  800a08:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a0b:	89 f0                	mov    %esi,%eax
+  800a0d:	eb 0f                	jmp    800a1e <strncpy+0x23>
+		*dst++ = *src;
+  800a0f:	83 c0 01             	add    $0x1,%eax
+  800a12:	0f b6 0a             	movzbl (%edx),%ecx
+  800a15:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a18:	80 f9 01             	cmp    $0x1,%cl
+  800a1b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a1e:	39 d8                	cmp    %ebx,%eax
+  800a20:	75 ed                	jne    800a0f <strncpy+0x14>
+	}
+	return ret;
+}
+  800a22:	89 f0                	mov    %esi,%eax
+  800a24:	5b                   	pop    %ebx
+  800a25:	5e                   	pop    %esi
+  800a26:	5d                   	pop    %ebp
+  800a27:	c3                   	ret
+
+00800a28 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a28:	55                   	push   %ebp
+  800a29:	89 e5                	mov    %esp,%ebp
+  800a2b:	56                   	push   %esi
+  800a2c:	53                   	push   %ebx
+  800a2d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a33:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a36:	89 f0                	mov    %esi,%eax
+  800a38:	85 d2                	test   %edx,%edx
+  800a3a:	74 21                	je     800a5d <strlcpy+0x35>
+  800a3c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a40:	89 f2                	mov    %esi,%edx
+  800a42:	eb 09                	jmp    800a4d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a44:	83 c1 01             	add    $0x1,%ecx
+  800a47:	83 c2 01             	add    $0x1,%edx
+  800a4a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a4d:	39 c2                	cmp    %eax,%edx
+  800a4f:	74 09                	je     800a5a <strlcpy+0x32>
+  800a51:	0f b6 19             	movzbl (%ecx),%ebx
+  800a54:	84 db                	test   %bl,%bl
+  800a56:	75 ec                	jne    800a44 <strlcpy+0x1c>
+  800a58:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a5a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a5d:	29 f0                	sub    %esi,%eax
+}
+  800a5f:	5b                   	pop    %ebx
+  800a60:	5e                   	pop    %esi
+  800a61:	5d                   	pop    %ebp
+  800a62:	c3                   	ret
+
+00800a63 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a69:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a6c:	eb 06                	jmp    800a74 <strcmp+0x11>
+		p++, q++;
+  800a6e:	83 c1 01             	add    $0x1,%ecx
+  800a71:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a74:	0f b6 01             	movzbl (%ecx),%eax
+  800a77:	84 c0                	test   %al,%al
+  800a79:	74 04                	je     800a7f <strcmp+0x1c>
+  800a7b:	3a 02                	cmp    (%edx),%al
+  800a7d:	74 ef                	je     800a6e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a7f:	0f b6 c0             	movzbl %al,%eax
+  800a82:	0f b6 12             	movzbl (%edx),%edx
+  800a85:	29 d0                	sub    %edx,%eax
+}
+  800a87:	5d                   	pop    %ebp
+  800a88:	c3                   	ret
+
+00800a89 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a89:	55                   	push   %ebp
+  800a8a:	89 e5                	mov    %esp,%ebp
+  800a8c:	53                   	push   %ebx
+  800a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a93:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a96:	eb 09                	jmp    800aa1 <strncmp+0x18>
+		n--, p++, q++;
+  800a98:	83 ea 01             	sub    $0x1,%edx
+  800a9b:	83 c0 01             	add    $0x1,%eax
+  800a9e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800aa1:	85 d2                	test   %edx,%edx
+  800aa3:	74 18                	je     800abd <strncmp+0x34>
+  800aa5:	0f b6 18             	movzbl (%eax),%ebx
+  800aa8:	84 db                	test   %bl,%bl
+  800aaa:	74 04                	je     800ab0 <strncmp+0x27>
+  800aac:	3a 19                	cmp    (%ecx),%bl
+  800aae:	74 e8                	je     800a98 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ab0:	0f b6 00             	movzbl (%eax),%eax
+  800ab3:	0f b6 11             	movzbl (%ecx),%edx
+  800ab6:	29 d0                	sub    %edx,%eax
+}
+  800ab8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+		return 0;
+  800abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac2:	eb f4                	jmp    800ab8 <strncmp+0x2f>
+
+00800ac4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aca:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ace:	eb 03                	jmp    800ad3 <strchr+0xf>
+  800ad0:	83 c0 01             	add    $0x1,%eax
+  800ad3:	0f b6 10             	movzbl (%eax),%edx
+  800ad6:	84 d2                	test   %dl,%dl
+  800ad8:	74 06                	je     800ae0 <strchr+0x1c>
+		if (*s == c)
+  800ada:	38 ca                	cmp    %cl,%dl
+  800adc:	75 f2                	jne    800ad0 <strchr+0xc>
+  800ade:	eb 05                	jmp    800ae5 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae5:	5d                   	pop    %ebp
+  800ae6:	c3                   	ret
+
+00800ae7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ae7:	55                   	push   %ebp
+  800ae8:	89 e5                	mov    %esp,%ebp
+  800aea:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aed:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800af1:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800af4:	38 ca                	cmp    %cl,%dl
+  800af6:	74 09                	je     800b01 <strfind+0x1a>
+  800af8:	84 d2                	test   %dl,%dl
+  800afa:	74 05                	je     800b01 <strfind+0x1a>
+	for (; *s; s++)
+  800afc:	83 c0 01             	add    $0x1,%eax
+  800aff:	eb f0                	jmp    800af1 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b01:	5d                   	pop    %ebp
+  800b02:	c3                   	ret
+
+00800b03 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	57                   	push   %edi
+  800b07:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b0a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b0d:	85 c9                	test   %ecx,%ecx
+  800b0f:	74 20                	je     800b31 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b11:	89 f8                	mov    %edi,%eax
+  800b13:	09 c8                	or     %ecx,%eax
+  800b15:	a8 03                	test   $0x3,%al
+  800b17:	75 12                	jne    800b2b <memset+0x28>
+		c &= 0xFF;
+  800b19:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b1d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b23:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b26:	fc                   	cld
+  800b27:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b29:	eb 06                	jmp    800b31 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b2e:	fc                   	cld
+  800b2f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b31:	89 f8                	mov    %edi,%eax
+  800b33:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b36:	c9                   	leave
+  800b37:	c3                   	ret
+
+00800b38 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	57                   	push   %edi
+  800b3c:	56                   	push   %esi
+  800b3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b40:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b43:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b46:	39 c6                	cmp    %eax,%esi
+  800b48:	73 32                	jae    800b7c <memmove+0x44>
+  800b4a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b4d:	39 d0                	cmp    %edx,%eax
+  800b4f:	73 2b                	jae    800b7c <memmove+0x44>
+		s += n;
+		d += n;
+  800b51:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b54:	89 d6                	mov    %edx,%esi
+  800b56:	09 fe                	or     %edi,%esi
+  800b58:	09 ce                	or     %ecx,%esi
+  800b5a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b60:	75 0e                	jne    800b70 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b62:	83 ef 04             	sub    $0x4,%edi
+  800b65:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b68:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b6b:	fd                   	std
+  800b6c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b6e:	eb 09                	jmp    800b79 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b70:	83 ef 01             	sub    $0x1,%edi
+  800b73:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b76:	fd                   	std
+  800b77:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b79:	fc                   	cld
+  800b7a:	eb 1a                	jmp    800b96 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b7c:	89 f2                	mov    %esi,%edx
+  800b7e:	09 c2                	or     %eax,%edx
+  800b80:	09 ca                	or     %ecx,%edx
+  800b82:	f6 c2 03             	test   $0x3,%dl
+  800b85:	75 0a                	jne    800b91 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b87:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b8a:	89 c7                	mov    %eax,%edi
+  800b8c:	fc                   	cld
+  800b8d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b8f:	eb 05                	jmp    800b96 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b91:	89 c7                	mov    %eax,%edi
+  800b93:	fc                   	cld
+  800b94:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b96:	5e                   	pop    %esi
+  800b97:	5f                   	pop    %edi
+  800b98:	5d                   	pop    %ebp
+  800b99:	c3                   	ret
+
+00800b9a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ba0:	ff 75 10             	push   0x10(%ebp)
+  800ba3:	ff 75 0c             	push   0xc(%ebp)
+  800ba6:	ff 75 08             	push   0x8(%ebp)
+  800ba9:	e8 8a ff ff ff       	call   800b38 <memmove>
+}
+  800bae:	c9                   	leave
+  800baf:	c3                   	ret
+
+00800bb0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+  800bb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bbb:	89 c6                	mov    %eax,%esi
+  800bbd:	03 75 10             	add    0x10(%ebp),%esi
+  800bc0:	eb 06                	jmp    800bc8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bc2:	83 c0 01             	add    $0x1,%eax
+  800bc5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bc8:	39 f0                	cmp    %esi,%eax
+  800bca:	74 14                	je     800be0 <memcmp+0x30>
+		if (*s1 != *s2)
+  800bcc:	0f b6 08             	movzbl (%eax),%ecx
+  800bcf:	0f b6 1a             	movzbl (%edx),%ebx
+  800bd2:	38 d9                	cmp    %bl,%cl
+  800bd4:	74 ec                	je     800bc2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bd6:	0f b6 c1             	movzbl %cl,%eax
+  800bd9:	0f b6 db             	movzbl %bl,%ebx
+  800bdc:	29 d8                	sub    %ebx,%eax
+  800bde:	eb 05                	jmp    800be5 <memcmp+0x35>
+	}
+
+	return 0;
+  800be0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800be5:	5b                   	pop    %ebx
+  800be6:	5e                   	pop    %esi
+  800be7:	5d                   	pop    %ebp
+  800be8:	c3                   	ret
+
+00800be9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800be9:	55                   	push   %ebp
+  800bea:	89 e5                	mov    %esp,%ebp
+  800bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bf2:	89 c2                	mov    %eax,%edx
+  800bf4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bf7:	eb 03                	jmp    800bfc <memfind+0x13>
+  800bf9:	83 c0 01             	add    $0x1,%eax
+  800bfc:	39 d0                	cmp    %edx,%eax
+  800bfe:	73 04                	jae    800c04 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c00:	38 08                	cmp    %cl,(%eax)
+  800c02:	75 f5                	jne    800bf9 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c04:	5d                   	pop    %ebp
+  800c05:	c3                   	ret
+
+00800c06 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c06:	55                   	push   %ebp
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	57                   	push   %edi
+  800c0a:	56                   	push   %esi
+  800c0b:	53                   	push   %ebx
+  800c0c:	83 ec 1c             	sub    $0x1c,%esp
+  800c0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c12:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c15:	eb 03                	jmp    800c1a <strtol+0x14>
+		s++;
+  800c17:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c1a:	0f b6 06             	movzbl (%esi),%eax
+  800c1d:	3c 20                	cmp    $0x20,%al
+  800c1f:	74 f6                	je     800c17 <strtol+0x11>
+  800c21:	3c 09                	cmp    $0x9,%al
+  800c23:	74 f2                	je     800c17 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c25:	3c 2b                	cmp    $0x2b,%al
+  800c27:	74 43                	je     800c6c <strtol+0x66>
+	int neg = 0;
+  800c29:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c2e:	3c 2d                	cmp    $0x2d,%al
+  800c30:	74 44                	je     800c76 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c32:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c38:	75 0f                	jne    800c49 <strtol+0x43>
+  800c3a:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c3d:	74 41                	je     800c80 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c3f:	85 ff                	test   %edi,%edi
+  800c41:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c46:	0f 44 f8             	cmove  %eax,%edi
+  800c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4e:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c53:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c56:	89 fb                	mov    %edi,%ebx
+  800c58:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c5b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c5e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c61:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c64:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c67:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c6a:	eb 67                	jmp    800cd3 <strtol+0xcd>
+		s++;
+  800c6c:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c74:	eb bc                	jmp    800c32 <strtol+0x2c>
+		s++, neg = 1;
+  800c76:	83 c6 01             	add    $0x1,%esi
+  800c79:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c7e:	eb b2                	jmp    800c32 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c80:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c84:	74 0e                	je     800c94 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c86:	85 ff                	test   %edi,%edi
+  800c88:	75 bf                	jne    800c49 <strtol+0x43>
+		s++, base = 8;
+  800c8a:	83 c6 01             	add    $0x1,%esi
+  800c8d:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c92:	eb b5                	jmp    800c49 <strtol+0x43>
+		s += 2, base = 16;
+  800c94:	83 c6 02             	add    $0x2,%esi
+  800c97:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c9c:	eb ab                	jmp    800c49 <strtol+0x43>
+			dig = *s - '0';
+  800c9e:	0f be c9             	movsbl %cl,%ecx
+  800ca1:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800ca4:	39 f9                	cmp    %edi,%ecx
+  800ca6:	7d 59                	jge    800d01 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800ca8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800cac:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800caf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cb2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cb5:	0f af d8             	imul   %eax,%ebx
+  800cb8:	0f af d7             	imul   %edi,%edx
+  800cbb:	01 d3                	add    %edx,%ebx
+  800cbd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cc0:	f7 e7                	mul    %edi
+  800cc2:	01 da                	add    %ebx,%edx
+  800cc4:	89 cb                	mov    %ecx,%ebx
+  800cc6:	c1 fb 1f             	sar    $0x1f,%ebx
+  800cc9:	01 c8                	add    %ecx,%eax
+  800ccb:	11 da                	adc    %ebx,%edx
+  800ccd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800cd0:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800cd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd6:	0f b6 08             	movzbl (%eax),%ecx
+  800cd9:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800cdc:	80 fb 09             	cmp    $0x9,%bl
+  800cdf:	76 bd                	jbe    800c9e <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce1:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800ce4:	80 fb 19             	cmp    $0x19,%bl
+  800ce7:	77 08                	ja     800cf1 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800ce9:	0f be c9             	movsbl %cl,%ecx
+  800cec:	83 e9 57             	sub    $0x57,%ecx
+  800cef:	eb b3                	jmp    800ca4 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cf1:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800cf4:	80 fb 19             	cmp    $0x19,%bl
+  800cf7:	77 08                	ja     800d01 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800cf9:	0f be c9             	movsbl %cl,%ecx
+  800cfc:	83 e9 37             	sub    $0x37,%ecx
+  800cff:	eb a3                	jmp    800ca4 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d01:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d04:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d07:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d0a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d0d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d11:	74 05                	je     800d18 <strtol+0x112>
+		*endptr = (char *) s;
+  800d13:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d16:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d18:	85 c9                	test   %ecx,%ecx
+  800d1a:	74 07                	je     800d23 <strtol+0x11d>
+  800d1c:	f7 d8                	neg    %eax
+  800d1e:	83 d2 00             	adc    $0x0,%edx
+  800d21:	f7 da                	neg    %edx
+}
+  800d23:	83 c4 1c             	add    $0x1c,%esp
+  800d26:	5b                   	pop    %ebx
+  800d27:	5e                   	pop    %esi
+  800d28:	5f                   	pop    %edi
+  800d29:	5d                   	pop    %ebp
+  800d2a:	c3                   	ret
+
+00800d2b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	57                   	push   %edi
+  800d2f:	56                   	push   %esi
+  800d30:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d31:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d38:	74 18                	je     800d52 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d45:	89 c3                	mov    %eax,%ebx
+  800d47:	89 c7                	mov    %eax,%edi
+  800d49:	89 c6                	mov    %eax,%esi
+  800d4b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d4d:	5b                   	pop    %ebx
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5f                   	pop    %edi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5d:	89 c3                	mov    %eax,%ebx
+  800d5f:	89 c7                	mov    %eax,%edi
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	8d 35 6c 0d 80 00    	lea    0x800d6c,%esi
+  800d6a:	0f 34                	sysenter
+  800d6c:	5d                   	pop    %ebp
+		goto out;
+  800d6d:	eb de                	jmp    800d4d <sys_cputs+0x22>
+
+00800d6f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d75:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d7c:	74 19                	je     800d97 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d88:	89 d1                	mov    %edx,%ecx
+  800d8a:	89 d3                	mov    %edx,%ebx
+  800d8c:	89 d7                	mov    %edx,%edi
+  800d8e:	89 d6                	mov    %edx,%esi
+  800d90:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d92:	5b                   	pop    %ebx
+  800d93:	5e                   	pop    %esi
+  800d94:	5f                   	pop    %edi
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da1:	89 d1                	mov    %edx,%ecx
+  800da3:	89 d3                	mov    %edx,%ebx
+  800da5:	89 d7                	mov    %edx,%edi
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	8d 35 b2 0d 80 00    	lea    0x800db2,%esi
+  800db0:	0f 34                	sysenter
+  800db2:	5d                   	pop    %ebp
+		goto out;
+  800db3:	eb dd                	jmp    800d92 <sys_cgetc+0x23>
+
+00800db5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	57                   	push   %edi
+  800db9:	56                   	push   %esi
+  800dba:	53                   	push   %ebx
+  800dbb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dbe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dc5:	74 21                	je     800de8 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800dc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dcc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd4:	89 cb                	mov    %ecx,%ebx
+  800dd6:	89 cf                	mov    %ecx,%edi
+  800dd8:	89 ce                	mov    %ecx,%esi
+  800dda:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddc:	85 c0                	test   %eax,%eax
+  800dde:	7f 27                	jg     800e07 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800de0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800de8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800deb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df5:	89 cb                	mov    %ecx,%ebx
+  800df7:	89 cf                	mov    %ecx,%edi
+  800df9:	55                   	push   %ebp
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	8d 35 04 0e 80 00    	lea    0x800e04,%esi
+  800e02:	0f 34                	sysenter
+  800e04:	5d                   	pop    %ebp
+		goto out;
+  800e05:	eb d5                	jmp    800ddc <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+  800e0a:	50                   	push   %eax
+  800e0b:	6a 03                	push   $0x3
+  800e0d:	68 8b 38 80 00       	push   $0x80388b
+  800e12:	6a 3f                	push   $0x3f
+  800e14:	68 a8 38 80 00       	push   $0x8038a8
+  800e19:	e8 71 f4 ff ff       	call   80028f <_panic>
+
+00800e1e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	57                   	push   %edi
+  800e22:	56                   	push   %esi
+  800e23:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e24:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e2b:	74 19                	je     800e46 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e32:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e37:	89 d1                	mov    %edx,%ecx
+  800e39:	89 d3                	mov    %edx,%ebx
+  800e3b:	89 d7                	mov    %edx,%edi
+  800e3d:	89 d6                	mov    %edx,%esi
+  800e3f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e50:	89 d1                	mov    %edx,%ecx
+  800e52:	89 d3                	mov    %edx,%ebx
+  800e54:	89 d7                	mov    %edx,%edi
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	8d 35 61 0e 80 00    	lea    0x800e61,%esi
+  800e5f:	0f 34                	sysenter
+  800e61:	5d                   	pop    %ebp
+		goto out;
+  800e62:	eb dd                	jmp    800e41 <sys_getenvid+0x23>
+
+00800e64 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	57                   	push   %edi
+  800e68:	56                   	push   %esi
+  800e69:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e6a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e71:	74 19                	je     800e8c <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e78:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e7d:	89 d1                	mov    %edx,%ecx
+  800e7f:	89 d3                	mov    %edx,%ebx
+  800e81:	89 d7                	mov    %edx,%edi
+  800e83:	89 d6                	mov    %edx,%esi
+  800e85:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e87:	5b                   	pop    %ebx
+  800e88:	5e                   	pop    %esi
+  800e89:	5f                   	pop    %edi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e91:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e96:	89 d1                	mov    %edx,%ecx
+  800e98:	89 d3                	mov    %edx,%ebx
+  800e9a:	89 d7                	mov    %edx,%edi
+  800e9c:	55                   	push   %ebp
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	8d 35 a7 0e 80 00    	lea    0x800ea7,%esi
+  800ea5:	0f 34                	sysenter
+  800ea7:	5d                   	pop    %ebp
+		goto out;
+  800ea8:	eb dd                	jmp    800e87 <sys_yield+0x23>
+
+00800eaa <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eb3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eba:	74 23                	je     800edf <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800ebc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecf:	89 f7                	mov    %esi,%edi
+  800ed1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed3:	85 c0                	test   %eax,%eax
+  800ed5:	7f 29                	jg     800f00 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ed7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800eea:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	8d 35 fd 0e 80 00    	lea    0x800efd,%esi
+  800efb:	0f 34                	sysenter
+  800efd:	5d                   	pop    %ebp
+		goto out;
+  800efe:	eb d3                	jmp    800ed3 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  800f03:	50                   	push   %eax
+  800f04:	6a 04                	push   $0x4
+  800f06:	68 8b 38 80 00       	push   $0x80388b
+  800f0b:	6a 3f                	push   $0x3f
+  800f0d:	68 a8 38 80 00       	push   $0x8038a8
+  800f12:	e8 78 f3 ff ff       	call   80028f <_panic>
+
+00800f17 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	57                   	push   %edi
+  800f1b:	56                   	push   %esi
+  800f1c:	53                   	push   %ebx
+  800f1d:	83 ec 0c             	sub    $0xc,%esp
+  800f20:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f23:	85 f6                	test   %esi,%esi
+  800f25:	75 09                	jne    800f30 <sys_page_map+0x19>
+  800f27:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f2e:	74 1f                	je     800f4f <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f30:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f41:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	7f 27                	jg     800f6e <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4a:	5b                   	pop    %ebx
+  800f4b:	5e                   	pop    %esi
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f55:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f60:	55                   	push   %ebp
+  800f61:	89 e5                	mov    %esp,%ebp
+  800f63:	8d 35 6b 0f 80 00    	lea    0x800f6b,%esi
+  800f69:	0f 34                	sysenter
+  800f6b:	5d                   	pop    %ebp
+		goto out;
+  800f6c:	eb d5                	jmp    800f43 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6e:	83 ec 0c             	sub    $0xc,%esp
+  800f71:	50                   	push   %eax
+  800f72:	6a 05                	push   $0x5
+  800f74:	68 8b 38 80 00       	push   $0x80388b
+  800f79:	6a 3f                	push   $0x3f
+  800f7b:	68 a8 38 80 00       	push   $0x8038a8
+  800f80:	e8 0a f3 ff ff       	call   80028f <_panic>
+
+00800f85 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f85:	55                   	push   %ebp
+  800f86:	89 e5                	mov    %esp,%ebp
+  800f88:	57                   	push   %edi
+  800f89:	56                   	push   %esi
+  800f8a:	53                   	push   %ebx
+  800f8b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f8e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f95:	74 22                	je     800fb9 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa7:	89 df                	mov    %ebx,%edi
+  800fa9:	89 de                	mov    %ebx,%esi
+  800fab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 28                	jg     800fd9 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc4:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fc9:	89 df                	mov    %ebx,%edi
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	8d 35 d6 0f 80 00    	lea    0x800fd6,%esi
+  800fd4:	0f 34                	sysenter
+  800fd6:	5d                   	pop    %ebp
+		goto out;
+  800fd7:	eb d4                	jmp    800fad <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd9:	83 ec 0c             	sub    $0xc,%esp
+  800fdc:	50                   	push   %eax
+  800fdd:	6a 06                	push   $0x6
+  800fdf:	68 8b 38 80 00       	push   $0x80388b
+  800fe4:	6a 3f                	push   $0x3f
+  800fe6:	68 a8 38 80 00       	push   $0x8038a8
+  800feb:	e8 9f f2 ff ff       	call   80028f <_panic>
+
+00800ff0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ff0:	55                   	push   %ebp
+  800ff1:	89 e5                	mov    %esp,%ebp
+  800ff3:	57                   	push   %edi
+  800ff4:	56                   	push   %esi
+  800ff5:	53                   	push   %ebx
+  800ff6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ff9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801000:	74 22                	je     801024 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	b8 08 00 00 00       	mov    $0x8,%eax
+  80100c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801012:	89 df                	mov    %ebx,%edi
+  801014:	89 de                	mov    %ebx,%esi
+  801016:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801018:	85 c0                	test   %eax,%eax
+  80101a:	7f 28                	jg     801044 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80101c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801024:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801034:	89 df                	mov    %ebx,%edi
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	8d 35 41 10 80 00    	lea    0x801041,%esi
+  80103f:	0f 34                	sysenter
+  801041:	5d                   	pop    %ebp
+		goto out;
+  801042:	eb d4                	jmp    801018 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801044:	83 ec 0c             	sub    $0xc,%esp
+  801047:	50                   	push   %eax
+  801048:	6a 08                	push   $0x8
+  80104a:	68 8b 38 80 00       	push   $0x80388b
+  80104f:	6a 3f                	push   $0x3f
+  801051:	68 a8 38 80 00       	push   $0x8038a8
+  801056:	e8 34 f2 ff ff       	call   80028f <_panic>
+
+0080105b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80105b:	55                   	push   %ebp
+  80105c:	89 e5                	mov    %esp,%ebp
+  80105e:	57                   	push   %edi
+  80105f:	56                   	push   %esi
+  801060:	53                   	push   %ebx
+  801061:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801064:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80106b:	74 22                	je     80108f <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80106d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801072:	b8 09 00 00 00       	mov    $0x9,%eax
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	89 df                	mov    %ebx,%edi
+  80107f:	89 de                	mov    %ebx,%esi
+  801081:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801083:	85 c0                	test   %eax,%eax
+  801085:	7f 28                	jg     8010af <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801087:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108a:	5b                   	pop    %ebx
+  80108b:	5e                   	pop    %esi
+  80108c:	5f                   	pop    %edi
+  80108d:	5d                   	pop    %ebp
+  80108e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80108f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80109f:	89 df                	mov    %ebx,%edi
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	8d 35 ac 10 80 00    	lea    0x8010ac,%esi
+  8010aa:	0f 34                	sysenter
+  8010ac:	5d                   	pop    %ebp
+		goto out;
+  8010ad:	eb d4                	jmp    801083 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010af:	83 ec 0c             	sub    $0xc,%esp
+  8010b2:	50                   	push   %eax
+  8010b3:	6a 09                	push   $0x9
+  8010b5:	68 8b 38 80 00       	push   $0x80388b
+  8010ba:	6a 3f                	push   $0x3f
+  8010bc:	68 a8 38 80 00       	push   $0x8038a8
+  8010c1:	e8 c9 f1 ff ff       	call   80028f <_panic>
+
+008010c6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010cf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010d6:	74 22                	je     8010fa <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8010d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e8:	89 df                	mov    %ebx,%edi
+  8010ea:	89 de                	mov    %ebx,%esi
+  8010ec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ee:	85 c0                	test   %eax,%eax
+  8010f0:	7f 28                	jg     80111a <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801102:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801105:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80110a:	89 df                	mov    %ebx,%edi
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	8d 35 17 11 80 00    	lea    0x801117,%esi
+  801115:	0f 34                	sysenter
+  801117:	5d                   	pop    %ebp
+		goto out;
+  801118:	eb d4                	jmp    8010ee <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111a:	83 ec 0c             	sub    $0xc,%esp
+  80111d:	50                   	push   %eax
+  80111e:	6a 0a                	push   $0xa
+  801120:	68 8b 38 80 00       	push   $0x80388b
+  801125:	6a 3f                	push   $0x3f
+  801127:	68 a8 38 80 00       	push   $0x8038a8
+  80112c:	e8 5e f1 ff ff       	call   80028f <_panic>
+
+00801131 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801131:	55                   	push   %ebp
+  801132:	89 e5                	mov    %esp,%ebp
+  801134:	57                   	push   %edi
+  801135:	56                   	push   %esi
+  801136:	53                   	push   %ebx
+  801137:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80113a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801141:	74 22                	je     801165 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801143:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801148:	b8 17 00 00 00       	mov    $0x17,%eax
+  80114d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801150:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801153:	89 df                	mov    %ebx,%edi
+  801155:	89 de                	mov    %ebx,%esi
+  801157:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801159:	85 c0                	test   %eax,%eax
+  80115b:	7f 28                	jg     801185 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80115d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801160:	5b                   	pop    %ebx
+  801161:	5e                   	pop    %esi
+  801162:	5f                   	pop    %edi
+  801163:	5d                   	pop    %ebp
+  801164:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801165:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801170:	b8 17 00 00 00       	mov    $0x17,%eax
+  801175:	89 df                	mov    %ebx,%edi
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	8d 35 82 11 80 00    	lea    0x801182,%esi
+  801180:	0f 34                	sysenter
+  801182:	5d                   	pop    %ebp
+		goto out;
+  801183:	eb d4                	jmp    801159 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801185:	83 ec 0c             	sub    $0xc,%esp
+  801188:	50                   	push   %eax
+  801189:	6a 17                	push   $0x17
+  80118b:	68 8b 38 80 00       	push   $0x80388b
+  801190:	6a 3f                	push   $0x3f
+  801192:	68 a8 38 80 00       	push   $0x8038a8
+  801197:	e8 f3 f0 ff ff       	call   80028f <_panic>
+
+0080119c <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	57                   	push   %edi
+  8011a0:	56                   	push   %esi
+  8011a1:	53                   	push   %ebx
+  8011a2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011a5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011ac:	74 22                	je     8011d0 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8011ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011be:	89 df                	mov    %ebx,%edi
+  8011c0:	89 de                	mov    %ebx,%esi
+  8011c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c4:	85 c0                	test   %eax,%eax
+  8011c6:	7f 28                	jg     8011f0 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8011c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cb:	5b                   	pop    %ebx
+  8011cc:	5e                   	pop    %esi
+  8011cd:	5f                   	pop    %edi
+  8011ce:	5d                   	pop    %ebp
+  8011cf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011db:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011e0:	89 df                	mov    %ebx,%edi
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  8011e5:	8d 35 ed 11 80 00    	lea    0x8011ed,%esi
+  8011eb:	0f 34                	sysenter
+  8011ed:	5d                   	pop    %ebp
+		goto out;
+  8011ee:	eb d4                	jmp    8011c4 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f0:	83 ec 0c             	sub    $0xc,%esp
+  8011f3:	50                   	push   %eax
+  8011f4:	6a 18                	push   $0x18
+  8011f6:	68 8b 38 80 00       	push   $0x80388b
+  8011fb:	6a 3f                	push   $0x3f
+  8011fd:	68 a8 38 80 00       	push   $0x8038a8
+  801202:	e8 88 f0 ff ff       	call   80028f <_panic>
+
+00801207 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	57                   	push   %edi
+  80120b:	56                   	push   %esi
+  80120c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80120d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801214:	74 1d                	je     801233 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801216:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80121b:	be 00 00 00 00       	mov    $0x0,%esi
+  801220:	8b 55 08             	mov    0x8(%ebp),%edx
+  801223:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801226:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801229:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80122c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80122e:	5b                   	pop    %ebx
+  80122f:	5e                   	pop    %esi
+  801230:	5f                   	pop    %edi
+  801231:	5d                   	pop    %ebp
+  801232:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801233:	8b 55 08             	mov    0x8(%ebp),%edx
+  801236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801239:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80123e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801241:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801244:	55                   	push   %ebp
+  801245:	89 e5                	mov    %esp,%ebp
+  801247:	8d 35 4f 12 80 00    	lea    0x80124f,%esi
+  80124d:	0f 34                	sysenter
+  80124f:	5d                   	pop    %ebp
+		goto out;
+  801250:	eb dc                	jmp    80122e <sys_ipc_try_send+0x27>
+
+00801252 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801252:	55                   	push   %ebp
+  801253:	89 e5                	mov    %esp,%ebp
+  801255:	57                   	push   %edi
+  801256:	56                   	push   %esi
+  801257:	53                   	push   %ebx
+  801258:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80125b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801262:	74 21                	je     801285 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801264:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801269:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80126e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801271:	89 cb                	mov    %ecx,%ebx
+  801273:	89 cf                	mov    %ecx,%edi
+  801275:	89 ce                	mov    %ecx,%esi
+  801277:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801279:	85 c0                	test   %eax,%eax
+  80127b:	7f 27                	jg     8012a4 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80127d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801280:	5b                   	pop    %ebx
+  801281:	5e                   	pop    %esi
+  801282:	5f                   	pop    %edi
+  801283:	5d                   	pop    %ebp
+  801284:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801285:	8b 55 08             	mov    0x8(%ebp),%edx
+  801288:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80128d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801292:	89 cb                	mov    %ecx,%ebx
+  801294:	89 cf                	mov    %ecx,%edi
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	8d 35 a1 12 80 00    	lea    0x8012a1,%esi
+  80129f:	0f 34                	sysenter
+  8012a1:	5d                   	pop    %ebp
+		goto out;
+  8012a2:	eb d5                	jmp    801279 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a4:	83 ec 0c             	sub    $0xc,%esp
+  8012a7:	50                   	push   %eax
+  8012a8:	6a 0d                	push   $0xd
+  8012aa:	68 8b 38 80 00       	push   $0x80388b
+  8012af:	6a 3f                	push   $0x3f
+  8012b1:	68 a8 38 80 00       	push   $0x8038a8
+  8012b6:	e8 d4 ef ff ff       	call   80028f <_panic>
+
+008012bb <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8012bb:	55                   	push   %ebp
+  8012bc:	89 e5                	mov    %esp,%ebp
+  8012be:	57                   	push   %edi
+  8012bf:	56                   	push   %esi
+  8012c0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012c1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012c8:	74 1b                	je     8012e5 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8012ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012da:	89 df                	mov    %ebx,%edi
+  8012dc:	89 de                	mov    %ebx,%esi
+  8012de:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5f                   	pop    %edi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012f5:	89 df                	mov    %ebx,%edi
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	8d 35 02 13 80 00    	lea    0x801302,%esi
+  801300:	0f 34                	sysenter
+  801302:	5d                   	pop    %ebp
+		goto out;
+  801303:	eb db                	jmp    8012e0 <sys_ipc_recv_until+0x25>
+
+00801305 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	57                   	push   %edi
+  801309:	56                   	push   %esi
+  80130a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80130b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801312:	74 19                	je     80132d <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801314:	ba 00 00 00 00       	mov    $0x0,%edx
+  801319:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80131e:	89 d1                	mov    %edx,%ecx
+  801320:	89 d3                	mov    %edx,%ebx
+  801322:	89 d7                	mov    %edx,%edi
+  801324:	89 d6                	mov    %edx,%esi
+  801326:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801328:	5b                   	pop    %ebx
+  801329:	5e                   	pop    %esi
+  80132a:	5f                   	pop    %edi
+  80132b:	5d                   	pop    %ebp
+  80132c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80132d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801332:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801337:	89 d1                	mov    %edx,%ecx
+  801339:	89 d3                	mov    %edx,%ebx
+  80133b:	89 d7                	mov    %edx,%edi
+  80133d:	55                   	push   %ebp
+  80133e:	89 e5                	mov    %esp,%ebp
+  801340:	8d 35 48 13 80 00    	lea    0x801348,%esi
+  801346:	0f 34                	sysenter
+  801348:	5d                   	pop    %ebp
+		goto out;
+  801349:	eb dd                	jmp    801328 <sys_time_msec+0x23>
+
+0080134b <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	57                   	push   %edi
+  80134f:	56                   	push   %esi
+  801350:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801351:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801358:	74 1a                	je     801374 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80135a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80135f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801364:	8b 55 08             	mov    0x8(%ebp),%edx
+  801367:	89 cb                	mov    %ecx,%ebx
+  801369:	89 cf                	mov    %ecx,%edi
+  80136b:	89 ce                	mov    %ecx,%esi
+  80136d:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80136f:	5b                   	pop    %ebx
+  801370:	5e                   	pop    %esi
+  801371:	5f                   	pop    %edi
+  801372:	5d                   	pop    %ebp
+  801373:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801374:	8b 55 08             	mov    0x8(%ebp),%edx
+  801377:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801381:	89 cb                	mov    %ecx,%ebx
+  801383:	89 cf                	mov    %ecx,%edi
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	8d 35 90 13 80 00    	lea    0x801390,%esi
+  80138e:	0f 34                	sysenter
+  801390:	5d                   	pop    %ebp
+		goto out;
+  801391:	eb dc                	jmp    80136f <sys_sleep_until+0x24>
+
+00801393 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	57                   	push   %edi
+  801397:	56                   	push   %esi
+  801398:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801399:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013a0:	74 1a                	je     8013bc <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8013a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013af:	89 cb                	mov    %ecx,%ebx
+  8013b1:	89 cf                	mov    %ecx,%edi
+  8013b3:	89 ce                	mov    %ecx,%esi
+  8013b5:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8013b7:	5b                   	pop    %ebx
+  8013b8:	5e                   	pop    %esi
+  8013b9:	5f                   	pop    %edi
+  8013ba:	5d                   	pop    %ebp
+  8013bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013c9:	89 cb                	mov    %ecx,%ebx
+  8013cb:	89 cf                	mov    %ecx,%edi
+  8013cd:	55                   	push   %ebp
+  8013ce:	89 e5                	mov    %esp,%ebp
+  8013d0:	8d 35 d8 13 80 00    	lea    0x8013d8,%esi
+  8013d6:	0f 34                	sysenter
+  8013d8:	5d                   	pop    %ebp
+		goto out;
+  8013d9:	eb dc                	jmp    8013b7 <sys_env_print_stats+0x24>
+
+008013db <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8013db:	55                   	push   %ebp
+  8013dc:	89 e5                	mov    %esp,%ebp
+  8013de:	57                   	push   %edi
+  8013df:	56                   	push   %esi
+  8013e0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013e1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013e8:	74 1b                	je     801405 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8013ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ef:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fa:	89 df                	mov    %ebx,%edi
+  8013fc:	89 de                	mov    %ebx,%esi
+  8013fe:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5f                   	pop    %edi
+  801403:	5d                   	pop    %ebp
+  801404:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801405:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801410:	b8 19 00 00 00       	mov    $0x19,%eax
+  801415:	89 df                	mov    %ebx,%edi
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	8d 35 22 14 80 00    	lea    0x801422,%esi
+  801420:	0f 34                	sysenter
+  801422:	5d                   	pop    %ebp
+		goto out;
+  801423:	eb db                	jmp    801400 <sys_perf+0x25>
+
+00801425 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801425:	55                   	push   %ebp
+  801426:	89 e5                	mov    %esp,%ebp
+  801428:	57                   	push   %edi
+  801429:	56                   	push   %esi
+  80142a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80142b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801432:	74 19                	je     80144d <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801434:	ba 00 00 00 00       	mov    $0x0,%edx
+  801439:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80143e:	89 d1                	mov    %edx,%ecx
+  801440:	89 d3                	mov    %edx,%ebx
+  801442:	89 d7                	mov    %edx,%edi
+  801444:	89 d6                	mov    %edx,%esi
+  801446:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801448:	5b                   	pop    %ebx
+  801449:	5e                   	pop    %esi
+  80144a:	5f                   	pop    %edi
+  80144b:	5d                   	pop    %ebp
+  80144c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80144d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801452:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801457:	89 d1                	mov    %edx,%ecx
+  801459:	89 d3                	mov    %edx,%ebx
+  80145b:	89 d7                	mov    %edx,%edi
+  80145d:	55                   	push   %ebp
+  80145e:	89 e5                	mov    %esp,%ebp
+  801460:	8d 35 68 14 80 00    	lea    0x801468,%esi
+  801466:	0f 34                	sysenter
+  801468:	5d                   	pop    %ebp
+		goto out;
+  801469:	eb dd                	jmp    801448 <sys_fork+0x23>
+
+0080146b <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	57                   	push   %edi
+  80146f:	56                   	push   %esi
+  801470:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801471:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801478:	74 1c                	je     801496 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80147a:	be 00 00 00 00       	mov    $0x0,%esi
+  80147f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801484:	8b 55 08             	mov    0x8(%ebp),%edx
+  801487:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80148d:	89 f7                	mov    %esi,%edi
+  80148f:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801491:	5b                   	pop    %ebx
+  801492:	5e                   	pop    %esi
+  801493:	5f                   	pop    %edi
+  801494:	5d                   	pop    %ebp
+  801495:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801496:	8b 55 08             	mov    0x8(%ebp),%edx
+  801499:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a9:	55                   	push   %ebp
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	8d 35 b4 14 80 00    	lea    0x8014b4,%esi
+  8014b2:	0f 34                	sysenter
+  8014b4:	5d                   	pop    %ebp
+		goto out;
+  8014b5:	eb da                	jmp    801491 <sys_thread_create+0x26>
+
+008014b7 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8014b7:	55                   	push   %ebp
+  8014b8:	89 e5                	mov    %esp,%ebp
+  8014ba:	57                   	push   %edi
+  8014bb:	56                   	push   %esi
+  8014bc:	53                   	push   %ebx
+  8014bd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014c0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014c7:	74 24                	je     8014ed <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8014c9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014df:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	7f 27                	jg     80150c <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8014e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5f                   	pop    %edi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	8d 35 09 15 80 00    	lea    0x801509,%esi
+  801507:	0f 34                	sysenter
+  801509:	5d                   	pop    %ebp
+		goto out;
+  80150a:	eb d5                	jmp    8014e1 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80150c:	83 ec 0c             	sub    $0xc,%esp
+  80150f:	50                   	push   %eax
+  801510:	6a 1f                	push   $0x1f
+  801512:	68 8b 38 80 00       	push   $0x80388b
+  801517:	6a 3f                	push   $0x3f
+  801519:	68 a8 38 80 00       	push   $0x8038a8
+  80151e:	e8 6c ed ff ff       	call   80028f <_panic>
+
+00801523 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801523:	55                   	push   %ebp
+  801524:	89 e5                	mov    %esp,%ebp
+  801526:	57                   	push   %edi
+  801527:	56                   	push   %esi
+  801528:	53                   	push   %ebx
+  801529:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80152c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801533:	74 23                	je     801558 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801535:	be 00 00 00 00       	mov    $0x0,%esi
+  80153a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80153f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801542:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801545:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801548:	89 f7                	mov    %esi,%edi
+  80154a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	7f 29                	jg     801579 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801550:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801553:	5b                   	pop    %ebx
+  801554:	5e                   	pop    %esi
+  801555:	5f                   	pop    %edi
+  801556:	5d                   	pop    %ebp
+  801557:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801558:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155e:	b8 20 00 00 00       	mov    $0x20,%eax
+  801563:	bf 00 00 00 00       	mov    $0x0,%edi
+  801568:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156b:	55                   	push   %ebp
+  80156c:	89 e5                	mov    %esp,%ebp
+  80156e:	8d 35 76 15 80 00    	lea    0x801576,%esi
+  801574:	0f 34                	sysenter
+  801576:	5d                   	pop    %ebp
+		goto out;
+  801577:	eb d3                	jmp    80154c <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801579:	83 ec 0c             	sub    $0xc,%esp
+  80157c:	50                   	push   %eax
+  80157d:	6a 20                	push   $0x20
+  80157f:	68 8b 38 80 00       	push   $0x80388b
+  801584:	6a 3f                	push   $0x3f
+  801586:	68 a8 38 80 00       	push   $0x8038a8
+  80158b:	e8 ff ec ff ff       	call   80028f <_panic>
+
+00801590 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801590:	55                   	push   %ebp
+  801591:	89 e5                	mov    %esp,%ebp
+  801593:	57                   	push   %edi
+  801594:	56                   	push   %esi
+  801595:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801596:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80159d:	74 1b                	je     8015ba <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80159f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015af:	89 df                	mov    %ebx,%edi
+  8015b1:	89 de                	mov    %ebx,%esi
+  8015b3:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8015b5:	5b                   	pop    %ebx
+  8015b6:	5e                   	pop    %esi
+  8015b7:	5f                   	pop    %edi
+  8015b8:	5d                   	pop    %ebp
+  8015b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015ca:	89 df                	mov    %ebx,%edi
+  8015cc:	55                   	push   %ebp
+  8015cd:	89 e5                	mov    %esp,%ebp
+  8015cf:	8d 35 d7 15 80 00    	lea    0x8015d7,%esi
+  8015d5:	0f 34                	sysenter
+  8015d7:	5d                   	pop    %ebp
+		goto out;
+  8015d8:	eb db                	jmp    8015b5 <sys_batch+0x25>
+
+008015da <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8015da:	55                   	push   %ebp
+  8015db:	89 e5                	mov    %esp,%ebp
+  8015dd:	57                   	push   %edi
+  8015de:	56                   	push   %esi
+  8015df:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015e0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015e7:	74 1a                	je     801603 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8015e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ee:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f6:	89 cb                	mov    %ecx,%ebx
+  8015f8:	89 cf                	mov    %ecx,%edi
+  8015fa:	89 ce                	mov    %ecx,%esi
+  8015fc:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8015fe:	5b                   	pop    %ebx
+  8015ff:	5e                   	pop    %esi
+  801600:	5f                   	pop    %edi
+  801601:	5d                   	pop    %ebp
+  801602:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801603:	8b 55 08             	mov    0x8(%ebp),%edx
+  801606:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80160b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801610:	89 cb                	mov    %ecx,%ebx
+  801612:	89 cf                	mov    %ecx,%edi
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+  801617:	8d 35 1f 16 80 00    	lea    0x80161f,%esi
+  80161d:	0f 34                	sysenter
+  80161f:	5d                   	pop    %ebp
+		goto out;
+  801620:	eb dc                	jmp    8015fe <sys_trace_ctl+0x24>
+
+00801622 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  801625:	57                   	push   %edi
+  801626:	56                   	push   %esi
+  801627:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801628:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80162f:	74 1c                	je     80164d <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801631:	be 00 00 00 00       	mov    $0x0,%esi
+  801636:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80163b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801641:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801644:	89 f7                	mov    %esi,%edi
+  801646:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801648:	5b                   	pop    %ebx
+  801649:	5e                   	pop    %esi
+  80164a:	5f                   	pop    %edi
+  80164b:	5d                   	pop    %ebp
+  80164c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80164d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801650:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801653:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801658:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	8d 35 6b 16 80 00    	lea    0x80166b,%esi
+  801669:	0f 34                	sysenter
+  80166b:	5d                   	pop    %ebp
+		goto out;
+  80166c:	eb da                	jmp    801648 <sys_trace_read+0x26>
+
+0080166e <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80166e:	55                   	push   %ebp
+  80166f:	89 e5                	mov    %esp,%ebp
+  801671:	57                   	push   %edi
+  801672:	56                   	push   %esi
+  801673:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801674:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80167b:	74 1c                	je     801699 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80167d:	be 00 00 00 00       	mov    $0x0,%esi
+  801682:	b8 21 00 00 00       	mov    $0x21,%eax
+  801687:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801690:	89 f7                	mov    %esi,%edi
+  801692:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801694:	5b                   	pop    %ebx
+  801695:	5e                   	pop    %esi
+  801696:	5f                   	pop    %edi
+  801697:	5d                   	pop    %ebp
+  801698:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801699:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169f:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016ac:	55                   	push   %ebp
+  8016ad:	89 e5                	mov    %esp,%ebp
+  8016af:	8d 35 b7 16 80 00    	lea    0x8016b7,%esi
+  8016b5:	0f 34                	sysenter
+  8016b7:	5d                   	pop    %ebp
+		goto out;
+  8016b8:	eb da                	jmp    801694 <sys_meminfo+0x26>
+
+008016ba <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8016ba:	55                   	push   %ebp
+  8016bb:	89 e5                	mov    %esp,%ebp
+  8016bd:	57                   	push   %edi
+  8016be:	56                   	push   %esi
+  8016bf:	53                   	push   %ebx
+  8016c0:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8016c3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8016c7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016ce:	74 1f                	je     8016ef <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8016d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016dd:	89 df                	mov    %ebx,%edi
+  8016df:	89 de                	mov    %ebx,%esi
+  8016e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016e3:	85 c0                	test   %eax,%eax
+  8016e5:	7f 25                	jg     80170c <sys_env_set_ksm+0x52>
+}
+  8016e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ea:	5b                   	pop    %ebx
+  8016eb:	5e                   	pop    %esi
+  8016ec:	5f                   	pop    %edi
+  8016ed:	5d                   	pop    %ebp
+  8016ee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f7:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016fc:	89 df                	mov    %ebx,%edi
+  8016fe:	55                   	push   %ebp
+  8016ff:	89 e5                	mov    %esp,%ebp
+  801701:	8d 35 09 17 80 00    	lea    0x801709,%esi
+  801707:	0f 34                	sysenter
+  801709:	5d                   	pop    %ebp
+		goto out;
+  80170a:	eb d7                	jmp    8016e3 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80170c:	83 ec 0c             	sub    $0xc,%esp
+  80170f:	50                   	push   %eax
+  801710:	6a 22                	push   $0x22
+  801712:	68 8b 38 80 00       	push   $0x80388b
+  801717:	6a 3f                	push   $0x3f
+  801719:	68 a8 38 80 00       	push   $0x8038a8
+  80171e:	e8 6c eb ff ff       	call   80028f <_panic>
+
+00801723 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801723:	55                   	push   %ebp
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	57                   	push   %edi
+  801727:	56                   	push   %esi
+  801728:	53                   	push   %ebx
+  801729:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80172c:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80172f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801736:	74 24                	je     80175c <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801738:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801742:	89 cb                	mov    %ecx,%ebx
+  801744:	89 cf                	mov    %ecx,%edi
+  801746:	89 ce                	mov    %ecx,%esi
+  801748:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80174a:	85 c0                	test   %eax,%eax
+  80174c:	7f 2a                	jg     801778 <sys_time_nsec+0x55>
+	return ns;
+}
+  80174e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801751:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801757:	5b                   	pop    %ebx
+  801758:	5e                   	pop    %esi
+  801759:	5f                   	pop    %edi
+  80175a:	5d                   	pop    %ebp
+  80175b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80175c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801761:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801766:	89 cb                	mov    %ecx,%ebx
+  801768:	89 cf                	mov    %ecx,%edi
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	8d 35 75 17 80 00    	lea    0x801775,%esi
+  801773:	0f 34                	sysenter
+  801775:	5d                   	pop    %ebp
+		goto out;
+  801776:	eb d2                	jmp    80174a <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801778:	83 ec 0c             	sub    $0xc,%esp
+  80177b:	50                   	push   %eax
+  80177c:	6a 0f                	push   $0xf
+  80177e:	68 8b 38 80 00       	push   $0x80388b
+  801783:	6a 3f                	push   $0x3f
+  801785:	68 a8 38 80 00       	push   $0x8038a8
+  80178a:	e8 00 eb ff ff       	call   80028f <_panic>
+
+0080178f <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80178f:	55                   	push   %ebp
+  801790:	89 e5                	mov    %esp,%ebp
+  801792:	57                   	push   %edi
+  801793:	56                   	push   %esi
+  801794:	53                   	push   %ebx
+  801795:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801798:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80179f:	74 22                	je     8017c3 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8017a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b1:	89 df                	mov    %ebx,%edi
+  8017b3:	89 de                	mov    %ebx,%esi
+  8017b5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017b7:	85 c0                	test   %eax,%eax
+  8017b9:	7f 28                	jg     8017e3 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8017bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017be:	5b                   	pop    %ebx
+  8017bf:	5e                   	pop    %esi
+  8017c0:	5f                   	pop    %edi
+  8017c1:	5d                   	pop    %ebp
+  8017c2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ce:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017d3:	89 df                	mov    %ebx,%edi
+  8017d5:	55                   	push   %ebp
+  8017d6:	89 e5                	mov    %esp,%ebp
+  8017d8:	8d 35 e0 17 80 00    	lea    0x8017e0,%esi
+  8017de:	0f 34                	sysenter
+  8017e0:	5d                   	pop    %ebp
+		goto out;
+  8017e1:	eb d4                	jmp    8017b7 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+  8017e6:	50                   	push   %eax
+  8017e7:	6a 12                	push   $0x12
+  8017e9:	68 8b 38 80 00       	push   $0x80388b
+  8017ee:	6a 3f                	push   $0x3f
+  8017f0:	68 a8 38 80 00       	push   $0x8038a8
+  8017f5:	e8 95 ea ff ff       	call   80028f <_panic>
+
+008017fa <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	57                   	push   %edi
+  8017fe:	56                   	push   %esi
+  8017ff:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801800:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801807:	74 1b                	je     801824 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801809:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801813:	8b 55 08             	mov    0x8(%ebp),%edx
+  801816:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801819:	89 df                	mov    %ebx,%edi
+  80181b:	89 de                	mov    %ebx,%esi
+  80181d:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80181f:	5b                   	pop    %ebx
+  801820:	5e                   	pop    %esi
+  801821:	5f                   	pop    %edi
+  801822:	5d                   	pop    %ebp
+  801823:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801824:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801829:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80182f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801834:	89 df                	mov    %ebx,%edi
+  801836:	55                   	push   %ebp
+  801837:	89 e5                	mov    %esp,%ebp
+  801839:	8d 35 41 18 80 00    	lea    0x801841,%esi
+  80183f:	0f 34                	sysenter
+  801841:	5d                   	pop    %ebp
+		goto out;
+  801842:	eb db                	jmp    80181f <sys_e1000_receive+0x25>
+
+00801844 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801844:	55                   	push   %ebp
+  801845:	89 e5                	mov    %esp,%ebp
+  801847:	57                   	push   %edi
+  801848:	56                   	push   %esi
+  801849:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80184a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801851:	74 1b                	je     80186e <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801853:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801858:	b8 14 00 00 00       	mov    $0x14,%eax
+  80185d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801860:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801863:	89 df                	mov    %ebx,%edi
+  801865:	89 de                	mov    %ebx,%esi
+  801867:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801869:	5b                   	pop    %ebx
+  80186a:	5e                   	pop    %esi
+  80186b:	5f                   	pop    %edi
+  80186c:	5d                   	pop    %ebp
+  80186d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80186e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801873:	8b 55 08             	mov    0x8(%ebp),%edx
+  801876:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801879:	b8 14 00 00 00       	mov    $0x14,%eax
+  80187e:	89 df                	mov    %ebx,%edi
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	8d 35 8b 18 80 00    	lea    0x80188b,%esi
+  801889:	0f 34                	sysenter
+  80188b:	5d                   	pop    %ebp
+		goto out;
+  80188c:	eb db                	jmp    801869 <sys_e1000_read_hwaddr+0x25>
+
+0080188e <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80188e:	55                   	push   %ebp
+  80188f:	89 e5                	mov    %esp,%ebp
+  801891:	57                   	push   %edi
+  801892:	56                   	push   %esi
+  801893:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801894:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80189b:	74 1a                	je     8018b7 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80189d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018aa:	89 cb                	mov    %ecx,%ebx
+  8018ac:	89 cf                	mov    %ecx,%edi
+  8018ae:	89 ce                	mov    %ecx,%esi
+  8018b0:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8018b2:	5b                   	pop    %ebx
+  8018b3:	5e                   	pop    %esi
+  8018b4:	5f                   	pop    %edi
+  8018b5:	5d                   	pop    %ebp
+  8018b6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018bf:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018c4:	89 cb                	mov    %ecx,%ebx
+  8018c6:	89 cf                	mov    %ecx,%edi
+  8018c8:	55                   	push   %ebp
+  8018c9:	89 e5                	mov    %esp,%ebp
+  8018cb:	8d 35 d3 18 80 00    	lea    0x8018d3,%esi
+  8018d1:	0f 34                	sysenter
+  8018d3:	5d                   	pop    %ebp
+		goto out;
+  8018d4:	eb dc                	jmp    8018b2 <sys_sb16_read_version+0x24>
+
+008018d6 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8018d6:	55                   	push   %ebp
+  8018d7:	89 e5                	mov    %esp,%ebp
+  8018d9:	57                   	push   %edi
+  8018da:	56                   	push   %esi
+  8018db:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018dc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018e3:	74 1b                	je     801900 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8018e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ea:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f5:	89 df                	mov    %ebx,%edi
+  8018f7:	89 de                	mov    %ebx,%esi
+  8018f9:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8018fb:	5b                   	pop    %ebx
+  8018fc:	5e                   	pop    %esi
+  8018fd:	5f                   	pop    %edi
+  8018fe:	5d                   	pop    %ebp
+  8018ff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801900:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801905:	8b 55 08             	mov    0x8(%ebp),%edx
+  801908:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80190b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801910:	89 df                	mov    %ebx,%edi
+  801912:	55                   	push   %ebp
+  801913:	89 e5                	mov    %esp,%ebp
+  801915:	8d 35 1d 19 80 00    	lea    0x80191d,%esi
+  80191b:	0f 34                	sysenter
+  80191d:	5d                   	pop    %ebp
+		goto out;
+  80191e:	eb db                	jmp    8018fb <sys_sb16_play+0x25>
+
+00801920 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	53                   	push   %ebx
+  801924:	83 ec 04             	sub    $0x4,%esp
+  801927:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801929:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801930:	f6 c4 04             	test   $0x4,%ah
+  801933:	74 0c                	je     801941 <dupperm+0x21>
+  801935:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80193c:	f6 c4 08             	test   $0x8,%ah
+  80193f:	75 62                	jne    8019a3 <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801941:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801948:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80194d:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801953:	74 19                	je     80196e <dupperm+0x4e>
+  801955:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80195c:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801961:	83 f8 01             	cmp    $0x1,%eax
+  801964:	19 c0                	sbb    %eax,%eax
+  801966:	25 00 08 00 00       	and    $0x800,%eax
+  80196b:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  80196e:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  801975:	89 c1                	mov    %eax,%ecx
+  801977:	80 cd 04             	or     $0x4,%ch
+  80197a:	f6 c7 04             	test   $0x4,%bh
+  80197d:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801980:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801987:	f6 c1 02             	test   $0x2,%cl
+  80198a:	74 12                	je     80199e <dupperm+0x7e>
+  80198c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801993:	89 c2                	mov    %eax,%edx
+  801995:	83 ca 02             	or     $0x2,%edx
+  801998:	f6 c5 04             	test   $0x4,%ch
+  80199b:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  80199e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a1:	c9                   	leave
+  8019a2:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8019a3:	68 b8 38 80 00       	push   $0x8038b8
+  8019a8:	68 50 39 80 00       	push   $0x803950
+  8019ad:	6a 39                	push   $0x39
+  8019af:	68 65 39 80 00       	push   $0x803965
+  8019b4:	e8 d6 e8 ff ff       	call   80028f <_panic>
+
+008019b9 <pgfault>:
+{
+  8019b9:	55                   	push   %ebp
+  8019ba:	89 e5                	mov    %esp,%ebp
+  8019bc:	53                   	push   %ebx
+  8019bd:	83 ec 04             	sub    $0x4,%esp
+  8019c0:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8019c3:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8019c5:	89 c3                	mov    %eax,%ebx
+  8019c7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019cd:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8019d1:	74 6d                	je     801a40 <pgfault+0x87>
+  8019d3:	89 da                	mov    %ebx,%edx
+  8019d5:	c1 ea 16             	shr    $0x16,%edx
+  8019d8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019df:	f6 c2 80             	test   $0x80,%dl
+  8019e2:	75 5c                	jne    801a40 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8019e4:	c1 e8 0c             	shr    $0xc,%eax
+  8019e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019ee:	f6 c4 08             	test   $0x8,%ah
+  8019f1:	74 4d                	je     801a40 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8019f3:	83 ec 04             	sub    $0x4,%esp
+  8019f6:	6a 07                	push   $0x7
+  8019f8:	68 00 f0 7f 00       	push   $0x7ff000
+  8019fd:	6a 00                	push   $0x0
+  8019ff:	e8 a6 f4 ff ff       	call   800eaa <sys_page_alloc>
+  801a04:	83 c4 10             	add    $0x10,%esp
+  801a07:	85 c0                	test   %eax,%eax
+  801a09:	78 49                	js     801a54 <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801a0b:	83 ec 04             	sub    $0x4,%esp
+  801a0e:	68 00 10 00 00       	push   $0x1000
+  801a13:	53                   	push   %ebx
+  801a14:	68 00 f0 7f 00       	push   $0x7ff000
+  801a19:	e8 1a f1 ff ff       	call   800b38 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801a1e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801a25:	53                   	push   %ebx
+  801a26:	6a 00                	push   $0x0
+  801a28:	68 00 f0 7f 00       	push   $0x7ff000
+  801a2d:	6a 00                	push   $0x0
+  801a2f:	e8 e3 f4 ff ff       	call   800f17 <sys_page_map>
+  801a34:	83 c4 20             	add    $0x20,%esp
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	78 2d                	js     801a68 <pgfault+0xaf>
+}
+  801a3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3e:	c9                   	leave
+  801a3f:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801a40:	83 ec 04             	sub    $0x4,%esp
+  801a43:	68 70 39 80 00       	push   $0x803970
+  801a48:	6a 1e                	push   $0x1e
+  801a4a:	68 65 39 80 00       	push   $0x803965
+  801a4f:	e8 3b e8 ff ff       	call   80028f <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801a54:	83 ec 04             	sub    $0x4,%esp
+  801a57:	68 ec 38 80 00       	push   $0x8038ec
+  801a5c:	6a 29                	push   $0x29
+  801a5e:	68 65 39 80 00       	push   $0x803965
+  801a63:	e8 27 e8 ff ff       	call   80028f <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801a68:	50                   	push   %eax
+  801a69:	68 20 39 80 00       	push   $0x803920
+  801a6e:	6a 2e                	push   $0x2e
+  801a70:	68 65 39 80 00       	push   $0x803965
+  801a75:	e8 15 e8 ff ff       	call   80028f <_panic>
+
+00801a7a <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801a7a:	55                   	push   %ebp
+  801a7b:	89 e5                	mov    %esp,%ebp
+  801a7d:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801a80:	ff 75 0c             	push   0xc(%ebp)
+  801a83:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801a86:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a8d:	e8 23 f3 ff ff       	call   800db5 <sys_env_destroy>
+}
+  801a92:	83 c4 10             	add    $0x10,%esp
+  801a95:	c9                   	leave
+  801a96:	c3                   	ret
+
+00801a97 <ufork>:
+{
+  801a97:	55                   	push   %ebp
+  801a98:	89 e5                	mov    %esp,%ebp
+  801a9a:	57                   	push   %edi
+  801a9b:	56                   	push   %esi
+  801a9c:	53                   	push   %ebx
+  801a9d:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801aa3:	b8 07 00 00 00       	mov    $0x7,%eax
+  801aa8:	cd 30                	int    $0x30
+  801aaa:	89 c6                	mov    %eax,%esi
+  801aac:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	78 56                	js     801b0c <ufork+0x75>
+	if (pid > 0) {
+  801ab6:	0f 8e b3 02 00 00    	jle    801d6f <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801abc:	83 ec 0c             	sub    $0xc,%esp
+  801abf:	68 b9 19 80 00       	push   $0x8019b9
+  801ac4:	e8 d8 18 00 00       	call   8033a1 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801ac9:	83 c4 08             	add    $0x8,%esp
+  801acc:	68 08 34 80 00       	push   $0x803408
+  801ad1:	56                   	push   %esi
+  801ad2:	e8 ef f5 ff ff       	call   8010c6 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801ad7:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801add:	89 1c 24             	mov    %ebx,(%esp)
+  801ae0:	e8 a1 04 00 00       	call   801f86 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801ae5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801aec:	6a 07                	push   $0x7
+  801aee:	68 00 f0 bf ee       	push   $0xeebff000
+  801af3:	56                   	push   %esi
+  801af4:	53                   	push   %ebx
+  801af5:	e8 0d 06 00 00       	call   802107 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801afa:	83 c4 20             	add    $0x20,%esp
+  801afd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b02:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801b08:	89 fe                	mov    %edi,%esi
+  801b0a:	eb 22                	jmp    801b2e <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801b0c:	50                   	push   %eax
+  801b0d:	68 89 39 80 00       	push   $0x803989
+  801b12:	68 a9 00 00 00       	push   $0xa9
+  801b17:	68 65 39 80 00       	push   $0x803965
+  801b1c:	e8 6e e7 ff ff       	call   80028f <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b21:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b27:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b2c:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b2e:	89 f7                	mov    %esi,%edi
+  801b30:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801b36:	0f 87 e9 01 00 00    	ja     801d25 <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801b3c:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801b42:	85 f6                	test   %esi,%esi
+  801b44:	0f 49 d6             	cmovns %esi,%edx
+  801b47:	c1 fa 0a             	sar    $0xa,%edx
+  801b4a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801b51:	f6 c1 01             	test   $0x1,%cl
+  801b54:	74 cb                	je     801b21 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801b56:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b5d:	f6 c2 80             	test   $0x80,%dl
+  801b60:	75 17                	jne    801b79 <ufork+0xe2>
+			j = i + 1;
+  801b62:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801b65:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801b6c:	f6 c2 01             	test   $0x1,%dl
+  801b6f:	0f 85 f3 00 00 00    	jne    801c68 <ufork+0x1d1>
+			j = i + 1;
+  801b75:	89 de                	mov    %ebx,%esi
+  801b77:	eb b5                	jmp    801b2e <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801b79:	89 fb                	mov    %edi,%ebx
+  801b7b:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801b7e:	89 d8                	mov    %ebx,%eax
+  801b80:	c1 e8 16             	shr    $0x16,%eax
+  801b83:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b8a:	89 c2                	mov    %eax,%edx
+  801b8c:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801b92:	25 02 04 00 00       	and    $0x402,%eax
+  801b97:	83 f8 02             	cmp    $0x2,%eax
+  801b9a:	74 31                	je     801bcd <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801b9c:	83 ec 04             	sub    $0x4,%esp
+  801b9f:	6a 01                	push   $0x1
+  801ba1:	52                   	push   %edx
+  801ba2:	53                   	push   %ebx
+  801ba3:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801ba9:	53                   	push   %ebx
+  801baa:	6a 00                	push   $0x0
+  801bac:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801bb2:	50                   	push   %eax
+  801bb3:	e8 7a 05 00 00       	call   802132 <batch_map>
+		return;
+  801bb8:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801bbb:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801bc1:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801bc6:	89 c6                	mov    %eax,%esi
+				continue;
+  801bc8:	e9 61 ff ff ff       	jmp    801b2e <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801bcd:	83 ec 04             	sub    $0x4,%esp
+  801bd0:	80 ca 80             	or     $0x80,%dl
+  801bd3:	52                   	push   %edx
+  801bd4:	53                   	push   %ebx
+  801bd5:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bdb:	e8 ca f2 ff ff       	call   800eaa <sys_page_alloc>
+  801be0:	83 c4 10             	add    $0x10,%esp
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	78 5d                	js     801c44 <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801be7:	83 ec 0c             	sub    $0xc,%esp
+  801bea:	6a 07                	push   $0x7
+  801bec:	68 00 00 40 00       	push   $0x400000
+  801bf1:	6a 00                	push   $0x0
+  801bf3:	53                   	push   %ebx
+  801bf4:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bfa:	e8 18 f3 ff ff       	call   800f17 <sys_page_map>
+  801bff:	83 c4 20             	add    $0x20,%esp
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	78 50                	js     801c56 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801c06:	83 ec 04             	sub    $0x4,%esp
+  801c09:	68 00 00 40 00       	push   $0x400000
+  801c0e:	53                   	push   %ebx
+  801c0f:	68 00 00 40 00       	push   $0x400000
+  801c14:	e8 1f ef ff ff       	call   800b38 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801c19:	83 c4 08             	add    $0x8,%esp
+  801c1c:	68 00 00 40 00       	push   $0x400000
+  801c21:	6a 00                	push   $0x0
+  801c23:	e8 5d f3 ff ff       	call   800f85 <sys_page_unmap>
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	79 8c                	jns    801bbb <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801c2f:	50                   	push   %eax
+  801c30:	68 bd 39 80 00       	push   $0x8039bd
+  801c35:	68 81 00 00 00       	push   $0x81
+  801c3a:	68 65 39 80 00       	push   $0x803965
+  801c3f:	e8 4b e6 ff ff       	call   80028f <_panic>
+		panic("sys_page_alloc: %e", r);
+  801c44:	50                   	push   %eax
+  801c45:	68 99 39 80 00       	push   $0x803999
+  801c4a:	6a 7c                	push   $0x7c
+  801c4c:	68 65 39 80 00       	push   $0x803965
+  801c51:	e8 39 e6 ff ff       	call   80028f <_panic>
+		panic("sys_page_map: %e", r);
+  801c56:	50                   	push   %eax
+  801c57:	68 ac 39 80 00       	push   $0x8039ac
+  801c5c:	6a 7e                	push   $0x7e
+  801c5e:	68 65 39 80 00       	push   $0x803965
+  801c63:	e8 27 e6 ff ff       	call   80028f <_panic>
+  801c68:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801c6e:	eb 22                	jmp    801c92 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801c70:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c77:	a8 01                	test   $0x1,%al
+  801c79:	74 35                	je     801cb0 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801c7b:	89 d8                	mov    %ebx,%eax
+  801c7d:	e8 9e fc ff ff       	call   801920 <dupperm>
+  801c82:	89 c6                	mov    %eax,%esi
+  801c84:	89 f8                	mov    %edi,%eax
+  801c86:	e8 95 fc ff ff       	call   801920 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c8b:	39 c6                	cmp    %eax,%esi
+  801c8d:	75 21                	jne    801cb0 <ufork+0x219>
+				j++;
+  801c8f:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c92:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801c98:	74 16                	je     801cb0 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801c9a:	89 d8                	mov    %ebx,%eax
+  801c9c:	c1 e8 0a             	shr    $0xa,%eax
+  801c9f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ca6:	25 81 00 00 00       	and    $0x81,%eax
+  801cab:	83 f8 01             	cmp    $0x1,%eax
+  801cae:	74 c0                	je     801c70 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801cb0:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801cb6:	89 d8                	mov    %ebx,%eax
+  801cb8:	29 f0                	sub    %esi,%eax
+  801cba:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801cc0:	89 fe                	mov    %edi,%esi
+  801cc2:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801cc5:	89 f8                	mov    %edi,%eax
+  801cc7:	e8 54 fc ff ff       	call   801920 <dupperm>
+  801ccc:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801cce:	83 ec 08             	sub    $0x8,%esp
+  801cd1:	6a 02                	push   $0x2
+  801cd3:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801cd9:	51                   	push   %ecx
+  801cda:	e8 15 03 00 00       	call   801ff4 <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801cdf:	83 c4 0c             	add    $0xc,%esp
+  801ce2:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801ce8:	57                   	push   %edi
+  801ce9:	56                   	push   %esi
+  801cea:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801cf0:	56                   	push   %esi
+  801cf1:	6a 00                	push   $0x0
+  801cf3:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801cf9:	51                   	push   %ecx
+  801cfa:	e8 33 04 00 00       	call   802132 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801cff:	83 c4 1c             	add    $0x1c,%esp
+  801d02:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d08:	57                   	push   %edi
+  801d09:	56                   	push   %esi
+  801d0a:	6a 00                	push   $0x0
+  801d0c:	56                   	push   %esi
+  801d0d:	6a 00                	push   $0x0
+  801d0f:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d15:	50                   	push   %eax
+  801d16:	e8 17 04 00 00       	call   802132 <batch_map>
+	return 0;
+  801d1b:	83 c4 20             	add    $0x20,%esp
+  801d1e:	89 de                	mov    %ebx,%esi
+  801d20:	e9 09 fe ff ff       	jmp    801b2e <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801d25:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801d2b:	83 ec 04             	sub    $0x4,%esp
+  801d2e:	6a 02                	push   $0x2
+  801d30:	56                   	push   %esi
+  801d31:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d37:	53                   	push   %ebx
+  801d38:	e8 49 04 00 00       	call   802186 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801d3d:	89 1c 24             	mov    %ebx,(%esp)
+  801d40:	e8 5d 02 00 00       	call   801fa2 <batch_flush>
+  801d45:	83 c4 10             	add    $0x10,%esp
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 0e                	js     801d5a <ufork+0x2c3>
+}
+  801d4c:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801d52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d55:	5b                   	pop    %ebx
+  801d56:	5e                   	pop    %esi
+  801d57:	5f                   	pop    %edi
+  801d58:	5d                   	pop    %ebp
+  801d59:	c3                   	ret
+			panic("fork: %e", r);
+  801d5a:	50                   	push   %eax
+  801d5b:	68 90 39 80 00       	push   $0x803990
+  801d60:	68 d7 00 00 00       	push   $0xd7
+  801d65:	68 65 39 80 00       	push   $0x803965
+  801d6a:	e8 20 e5 ff ff       	call   80028f <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d6f:	e8 aa f0 ff ff       	call   800e1e <sys_getenvid>
+  801d74:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d79:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d7f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d84:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801d89:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801d90:	00 00 00 
+  801d93:	eb b7                	jmp    801d4c <ufork+0x2b5>
+
+00801d95 <fork>:
+{
+  801d95:	55                   	push   %ebp
+  801d96:	89 e5                	mov    %esp,%ebp
+  801d98:	53                   	push   %ebx
+  801d99:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801d9c:	68 b9 19 80 00       	push   $0x8019b9
+  801da1:	e8 fb 15 00 00       	call   8033a1 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801da6:	e8 7a f6 ff ff       	call   801425 <sys_fork>
+  801dab:	89 c3                	mov    %eax,%ebx
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 09                	js     801dbd <fork+0x28>
+	if (pid == 0)
+  801db4:	74 1c                	je     801dd2 <fork+0x3d>
+}
+  801db6:	89 d8                	mov    %ebx,%eax
+  801db8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dbb:	c9                   	leave
+  801dbc:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801dbd:	50                   	push   %eax
+  801dbe:	68 89 39 80 00       	push   $0x803989
+  801dc3:	68 ed 00 00 00       	push   $0xed
+  801dc8:	68 65 39 80 00       	push   $0x803965
+  801dcd:	e8 bd e4 ff ff       	call   80028f <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801dd2:	e8 47 f0 ff ff       	call   800e1e <sys_getenvid>
+  801dd7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ddc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801de2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801de7:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801dec:	eb c8                	jmp    801db6 <fork+0x21>
+
+00801dee <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801dee:	55                   	push   %ebp
+  801def:	89 e5                	mov    %esp,%ebp
+  801df1:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801df4:	ff 75 0c             	push   0xc(%ebp)
+  801df7:	ff 75 08             	push   0x8(%ebp)
+  801dfa:	68 7a 1a 80 00       	push   $0x801a7a
+  801dff:	e8 67 f6 ff ff       	call   80146b <sys_thread_create>
+}
+  801e04:	c9                   	leave
+  801e05:	c3                   	ret
+
+00801e06 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801e06:	55                   	push   %ebp
+  801e07:	89 e5                	mov    %esp,%ebp
+  801e09:	56                   	push   %esi
+  801e0a:	53                   	push   %ebx
+  801e0b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801e14:	85 c0                	test   %eax,%eax
+  801e16:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801e1b:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801e1e:	83 ec 08             	sub    $0x8,%esp
+  801e21:	ff 75 14             	push   0x14(%ebp)
+  801e24:	50                   	push   %eax
+  801e25:	e8 91 f4 ff ff       	call   8012bb <sys_ipc_recv_until>
+  801e2a:	83 c4 10             	add    $0x10,%esp
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 61                	js     801e92 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801e31:	85 f6                	test   %esi,%esi
+  801e33:	74 1c                	je     801e51 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801e35:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e37:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e3c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e42:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e47:	76 5f                	jbe    801ea8 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801e49:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801e4f:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801e51:	85 db                	test   %ebx,%ebx
+  801e53:	74 1c                	je     801e71 <ipc_recv_until+0x6b>
+  801e55:	89 e0                	mov    %esp,%eax
+  801e57:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e5c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e62:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e67:	76 50                	jbe    801eb9 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801e69:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801e6f:	89 03                	mov    %eax,(%ebx)
+  801e71:	89 e0                	mov    %esp,%eax
+  801e73:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e78:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e7e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e83:	76 45                	jbe    801eca <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801e85:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801e8b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8e:	5b                   	pop    %ebx
+  801e8f:	5e                   	pop    %esi
+  801e90:	5d                   	pop    %ebp
+  801e91:	c3                   	ret
+		if (from_env_store)
+  801e92:	85 f6                	test   %esi,%esi
+  801e94:	74 06                	je     801e9c <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801e96:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801e9c:	85 db                	test   %ebx,%ebx
+  801e9e:	74 eb                	je     801e8b <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801ea0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801ea6:	eb e3                	jmp    801e8b <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ea8:	c1 e8 10             	shr    $0x10,%eax
+  801eab:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801eb1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801eb7:	eb 90                	jmp    801e49 <ipc_recv_until+0x43>
+  801eb9:	c1 e8 10             	shr    $0x10,%eax
+  801ebc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ec2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ec8:	eb 9f                	jmp    801e69 <ipc_recv_until+0x63>
+  801eca:	c1 e8 10             	shr    $0x10,%eax
+  801ecd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ed3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ed9:	eb aa                	jmp    801e85 <ipc_recv_until+0x7f>
+
+00801edb <ipc_recv>:
+{
+  801edb:	55                   	push   %ebp
+  801edc:	89 e5                	mov    %esp,%ebp
+  801ede:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801ee1:	6a 00                	push   $0x0
+  801ee3:	ff 75 10             	push   0x10(%ebp)
+  801ee6:	ff 75 0c             	push   0xc(%ebp)
+  801ee9:	ff 75 08             	push   0x8(%ebp)
+  801eec:	e8 15 ff ff ff       	call   801e06 <ipc_recv_until>
+}
+  801ef1:	c9                   	leave
+  801ef2:	c3                   	ret
+
+00801ef3 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	57                   	push   %edi
+  801ef7:	56                   	push   %esi
+  801ef8:	53                   	push   %ebx
+  801ef9:	83 ec 0c             	sub    $0xc,%esp
+  801efc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801eff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801f05:	85 db                	test   %ebx,%ebx
+  801f07:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f0c:	0f 44 d8             	cmove  %eax,%ebx
+  801f0f:	eb 05                	jmp    801f16 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801f11:	e8 4e ef ff ff       	call   800e64 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801f16:	ff 75 14             	push   0x14(%ebp)
+  801f19:	53                   	push   %ebx
+  801f1a:	56                   	push   %esi
+  801f1b:	57                   	push   %edi
+  801f1c:	e8 e6 f2 ff ff       	call   801207 <sys_ipc_try_send>
+  801f21:	83 c4 10             	add    $0x10,%esp
+  801f24:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f27:	74 e8                	je     801f11 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	78 08                	js     801f35 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f30:	5b                   	pop    %ebx
+  801f31:	5e                   	pop    %esi
+  801f32:	5f                   	pop    %edi
+  801f33:	5d                   	pop    %ebp
+  801f34:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801f35:	50                   	push   %eax
+  801f36:	68 d0 39 80 00       	push   $0x8039d0
+  801f3b:	6a 4f                	push   $0x4f
+  801f3d:	68 e3 39 80 00       	push   $0x8039e3
+  801f42:	e8 48 e3 ff ff       	call   80028f <_panic>
+
+00801f47 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801f47:	55                   	push   %ebp
+  801f48:	89 e5                	mov    %esp,%ebp
+  801f4a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801f52:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801f58:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801f5e:	8b 52 50             	mov    0x50(%edx),%edx
+  801f61:	39 ca                	cmp    %ecx,%edx
+  801f63:	74 11                	je     801f76 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801f65:	83 c0 01             	add    $0x1,%eax
+  801f68:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801f6d:	75 e3                	jne    801f52 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f74:	eb 0e                	jmp    801f84 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801f76:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f7c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801f81:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801f84:	5d                   	pop    %ebp
+  801f85:	c3                   	ret
+
+00801f86 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801f86:	55                   	push   %ebp
+  801f87:	89 e5                	mov    %esp,%ebp
+  801f89:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801f8c:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801f93:	00 00 00 
+	b->b_error = 0;
+  801f96:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801f9d:	00 00 00 
+}
+  801fa0:	5d                   	pop    %ebp
+  801fa1:	c3                   	ret
+
+00801fa2 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801fa2:	55                   	push   %ebp
+  801fa3:	89 e5                	mov    %esp,%ebp
+  801fa5:	53                   	push   %ebx
+  801fa6:	83 ec 04             	sub    $0x4,%esp
+  801fa9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801fac:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801fb2:	85 c0                	test   %eax,%eax
+  801fb4:	7e 09                	jle    801fbf <batch_flush+0x1d>
+  801fb6:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801fbd:	74 15                	je     801fd4 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801fbf:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801fc6:	00 00 00 
+	return b->b_error;
+  801fc9:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801fcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd2:	c9                   	leave
+  801fd3:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801fd4:	83 ec 08             	sub    $0x8,%esp
+  801fd7:	50                   	push   %eax
+  801fd8:	53                   	push   %ebx
+  801fd9:	e8 b2 f5 ff ff       	call   801590 <sys_batch>
+  801fde:	83 c4 10             	add    $0x10,%esp
+  801fe1:	85 c0                	test   %eax,%eax
+  801fe3:	79 da                	jns    801fbf <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801fe5:	f7 d8                	neg    %eax
+  801fe7:	0f b6 c0             	movzbl %al,%eax
+  801fea:	f7 d8                	neg    %eax
+  801fec:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801ff2:	eb cb                	jmp    801fbf <batch_flush+0x1d>
+
+00801ff4 <batch_reserve>:
+{
+  801ff4:	55                   	push   %ebp
+  801ff5:	89 e5                	mov    %esp,%ebp
+  801ff7:	83 ec 08             	sub    $0x8,%esp
+  801ffa:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801ffd:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  802003:	03 45 0c             	add    0xc(%ebp),%eax
+  802006:	83 f8 10             	cmp    $0x10,%eax
+  802009:	7f 02                	jg     80200d <batch_reserve+0x19>
+}
+  80200b:	c9                   	leave
+  80200c:	c3                   	ret
+		batch_flush(b);
+  80200d:	83 ec 0c             	sub    $0xc,%esp
+  802010:	52                   	push   %edx
+  802011:	e8 8c ff ff ff       	call   801fa2 <batch_flush>
+  802016:	83 c4 10             	add    $0x10,%esp
+}
+  802019:	eb f0                	jmp    80200b <batch_reserve+0x17>
+
+0080201b <batch_next>:
+{
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	53                   	push   %ebx
+  80201f:	83 ec 04             	sub    $0x4,%esp
+  802022:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  802024:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  80202b:	74 28                	je     802055 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  80202d:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  802033:	8d 50 01             	lea    0x1(%eax),%edx
+  802036:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  80203c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80203f:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  802041:	83 ec 04             	sub    $0x4,%esp
+  802044:	6a 1c                	push   $0x1c
+  802046:	6a 00                	push   $0x0
+  802048:	53                   	push   %ebx
+  802049:	e8 b5 ea ff ff       	call   800b03 <memset>
+}
+  80204e:	89 d8                	mov    %ebx,%eax
+  802050:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802053:	c9                   	leave
+  802054:	c3                   	ret
+		batch_flush(b);
+  802055:	83 ec 0c             	sub    $0xc,%esp
+  802058:	50                   	push   %eax
+  802059:	e8 44 ff ff ff       	call   801fa2 <batch_flush>
+  80205e:	83 c4 10             	add    $0x10,%esp
+  802061:	eb ca                	jmp    80202d <batch_next+0x12>
+
+00802063 <batch_page>:
+{
+  802063:	55                   	push   %ebp
+  802064:	89 e5                	mov    %esp,%ebp
+  802066:	57                   	push   %edi
+  802067:	56                   	push   %esi
+  802068:	53                   	push   %ebx
+  802069:	83 ec 1c             	sub    $0x1c,%esp
+  80206c:	89 d3                	mov    %edx,%ebx
+  80206e:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  802070:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  802076:	85 d2                	test   %edx,%edx
+  802078:	74 50                	je     8020ca <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  80207a:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  80207d:	01 c1                	add    %eax,%ecx
+  80207f:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  802082:	75 46                	jne    8020ca <batch_page+0x67>
+  802084:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  802087:	75 41                	jne    8020ca <batch_page+0x67>
+  802089:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  80208c:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  80208f:	75 39                	jne    8020ca <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  802091:	83 ea 01             	sub    $0x1,%edx
+  802094:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  802097:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  80209a:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  80209e:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8020a1:	75 27                	jne    8020ca <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8020a3:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020a6:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8020aa:	89 fa                	mov    %edi,%edx
+  8020ac:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020af:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8020b2:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020b5:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8020b8:	75 10                	jne    8020ca <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020ba:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8020be:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8020c1:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8020c5:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8020c8:	74 2a                	je     8020f4 <batch_page+0x91>
+	op = batch_next(b);
+  8020ca:	e8 4c ff ff ff       	call   80201b <batch_next>
+	op->bo_op = opcode;
+  8020cf:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  8020d1:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  8020d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020d7:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  8020da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8020dd:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  8020e0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8020e3:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  8020e6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8020e9:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  8020ec:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8020ef:	89 78 14             	mov    %edi,0x14(%eax)
+  8020f2:	eb 0b                	jmp    8020ff <batch_page+0x9c>
+		op->bo_npages += npages;
+  8020f4:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  8020f8:	03 7d 18             	add    0x18(%ebp),%edi
+  8020fb:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  8020ff:	83 c4 1c             	add    $0x1c,%esp
+  802102:	5b                   	pop    %ebx
+  802103:	5e                   	pop    %esi
+  802104:	5f                   	pop    %edi
+  802105:	5d                   	pop    %ebp
+  802106:	c3                   	ret
+
+00802107 <batch_alloc>:
+{
+  802107:	55                   	push   %ebp
+  802108:	89 e5                	mov    %esp,%ebp
+  80210a:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  80210d:	ff 75 18             	push   0x18(%ebp)
+  802110:	ff 75 14             	push   0x14(%ebp)
+  802113:	ff 75 10             	push   0x10(%ebp)
+  802116:	ff 75 0c             	push   0xc(%ebp)
+  802119:	6a 00                	push   $0x0
+  80211b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802120:	ba 00 00 00 00       	mov    $0x0,%edx
+  802125:	8b 45 08             	mov    0x8(%ebp),%eax
+  802128:	e8 36 ff ff ff       	call   802063 <batch_page>
+}
+  80212d:	83 c4 20             	add    $0x20,%esp
+  802130:	c9                   	leave
+  802131:	c3                   	ret
+
+00802132 <batch_map>:
+{
+  802132:	55                   	push   %ebp
+  802133:	89 e5                	mov    %esp,%ebp
+  802135:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802138:	ff 75 20             	push   0x20(%ebp)
+  80213b:	ff 75 1c             	push   0x1c(%ebp)
+  80213e:	ff 75 18             	push   0x18(%ebp)
+  802141:	ff 75 14             	push   0x14(%ebp)
+  802144:	ff 75 10             	push   0x10(%ebp)
+  802147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80214a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80214f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802152:	e8 0c ff ff ff       	call   802063 <batch_page>
+}
+  802157:	83 c4 20             	add    $0x20,%esp
+  80215a:	c9                   	leave
+  80215b:	c3                   	ret
+
+0080215c <batch_unmap>:
+{
+  80215c:	55                   	push   %ebp
+  80215d:	89 e5                	mov    %esp,%ebp
+  80215f:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  802162:	ff 75 14             	push   0x14(%ebp)
+  802165:	6a 00                	push   $0x0
+  802167:	ff 75 10             	push   0x10(%ebp)
+  80216a:	ff 75 0c             	push   0xc(%ebp)
+  80216d:	6a 00                	push   $0x0
+  80216f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802174:	ba 02 00 00 00       	mov    $0x2,%edx
+  802179:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217c:	e8 e2 fe ff ff       	call   802063 <batch_page>
+}
+  802181:	83 c4 20             	add    $0x20,%esp
+  802184:	c9                   	leave
+  802185:	c3                   	ret
+
+00802186 <batch_set_status>:
+{
+  802186:	55                   	push   %ebp
+  802187:	89 e5                	mov    %esp,%ebp
+  802189:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  80218c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80218f:	e8 87 fe ff ff       	call   80201b <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  802194:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  80219a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80219d:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8021a0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021a3:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8021a6:	c9                   	leave
+  8021a7:	c3                   	ret
+
+008021a8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8021a8:	55                   	push   %ebp
+  8021a9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ae:	05 00 00 00 30       	add    $0x30000000,%eax
+  8021b3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8021b6:	5d                   	pop    %ebp
+  8021b7:	c3                   	ret
+
+008021b8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021be:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8021c3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021c8:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8021cd:	5d                   	pop    %ebp
+  8021ce:	c3                   	ret
+
+008021cf <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8021d2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8021d7:	eb 02                	jmp    8021db <fd_alloc+0xc>
+  8021d9:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8021db:	89 c2                	mov    %eax,%edx
+  8021dd:	c1 ea 16             	shr    $0x16,%edx
+  8021e0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8021e7:	f6 c2 01             	test   $0x1,%dl
+  8021ea:	74 2b                	je     802217 <fd_alloc+0x48>
+  8021ec:	89 c2                	mov    %eax,%edx
+  8021ee:	c1 ea 0c             	shr    $0xc,%edx
+  8021f1:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8021f8:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8021fe:	f6 c1 01             	test   $0x1,%cl
+  802201:	74 14                	je     802217 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802203:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802209:	75 ce                	jne    8021d9 <fd_alloc+0xa>
+  80220b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802210:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802215:	eb 05                	jmp    80221c <fd_alloc+0x4d>
+			return 0;
+  802217:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80221c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80221f:	89 02                	mov    %eax,(%edx)
+}
+  802221:	89 c8                	mov    %ecx,%eax
+  802223:	5d                   	pop    %ebp
+  802224:	c3                   	ret
+
+00802225 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802225:	55                   	push   %ebp
+  802226:	89 e5                	mov    %esp,%ebp
+  802228:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80222b:	83 f8 1f             	cmp    $0x1f,%eax
+  80222e:	77 30                	ja     802260 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802230:	c1 e0 0c             	shl    $0xc,%eax
+  802233:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802238:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80223e:	f6 c2 01             	test   $0x1,%dl
+  802241:	74 24                	je     802267 <fd_lookup+0x42>
+  802243:	89 c2                	mov    %eax,%edx
+  802245:	c1 ea 0c             	shr    $0xc,%edx
+  802248:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80224f:	f6 c2 01             	test   $0x1,%dl
+  802252:	74 1a                	je     80226e <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802254:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802257:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802259:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225e:	5d                   	pop    %ebp
+  80225f:	c3                   	ret
+		return -E_INVAL;
+  802260:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802265:	eb f7                	jmp    80225e <fd_lookup+0x39>
+		return -E_INVAL;
+  802267:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80226c:	eb f0                	jmp    80225e <fd_lookup+0x39>
+  80226e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802273:	eb e9                	jmp    80225e <fd_lookup+0x39>
+
+00802275 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802275:	55                   	push   %ebp
+  802276:	89 e5                	mov    %esp,%ebp
+  802278:	53                   	push   %ebx
+  802279:	83 ec 04             	sub    $0x4,%esp
+  80227c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80227f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802284:	eb 03                	jmp    802289 <dev_lookup+0x14>
+  802286:	83 c0 01             	add    $0x1,%eax
+  802289:	8b 1c 85 6c 3a 80 00 	mov    0x803a6c(,%eax,4),%ebx
+  802290:	85 db                	test   %ebx,%ebx
+  802292:	74 0b                	je     80229f <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802294:	39 13                	cmp    %edx,(%ebx)
+  802296:	75 ee                	jne    802286 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80229d:	eb 2e                	jmp    8022cd <dev_lookup+0x58>
+  80229f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022a1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022a6:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022ac:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8022b1:	76 24                	jbe    8022d7 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022b3:	8b 41 48             	mov    0x48(%ecx),%eax
+  8022b6:	83 ec 04             	sub    $0x4,%esp
+  8022b9:	52                   	push   %edx
+  8022ba:	50                   	push   %eax
+  8022bb:	68 f0 39 80 00       	push   $0x8039f0
+  8022c0:	e8 a5 e0 ff ff       	call   80036a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8022c5:	83 c4 10             	add    $0x10,%esp
+  8022c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8022cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022d0:	89 1a                	mov    %ebx,(%edx)
+}
+  8022d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d5:	c9                   	leave
+  8022d6:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8022d7:	c1 e8 10             	shr    $0x10,%eax
+  8022da:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8022e0:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8022e6:	eb cb                	jmp    8022b3 <dev_lookup+0x3e>
+
+008022e8 <fd_close>:
+{
+  8022e8:	55                   	push   %ebp
+  8022e9:	89 e5                	mov    %esp,%ebp
+  8022eb:	57                   	push   %edi
+  8022ec:	56                   	push   %esi
+  8022ed:	53                   	push   %ebx
+  8022ee:	83 ec 24             	sub    $0x24,%esp
+  8022f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022f4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8022f7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022fa:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8022fb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802301:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802304:	50                   	push   %eax
+  802305:	e8 1b ff ff ff       	call   802225 <fd_lookup>
+  80230a:	89 c3                	mov    %eax,%ebx
+  80230c:	83 c4 10             	add    $0x10,%esp
+  80230f:	85 c0                	test   %eax,%eax
+  802311:	78 05                	js     802318 <fd_close+0x30>
+	    || fd != fd2)
+  802313:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802316:	74 16                	je     80232e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802318:	89 f8                	mov    %edi,%eax
+  80231a:	84 c0                	test   %al,%al
+  80231c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802321:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802324:	89 d8                	mov    %ebx,%eax
+  802326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802329:	5b                   	pop    %ebx
+  80232a:	5e                   	pop    %esi
+  80232b:	5f                   	pop    %edi
+  80232c:	5d                   	pop    %ebp
+  80232d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80232e:	83 ec 08             	sub    $0x8,%esp
+  802331:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802334:	50                   	push   %eax
+  802335:	ff 36                	push   (%esi)
+  802337:	e8 39 ff ff ff       	call   802275 <dev_lookup>
+  80233c:	89 c3                	mov    %eax,%ebx
+  80233e:	83 c4 10             	add    $0x10,%esp
+  802341:	85 c0                	test   %eax,%eax
+  802343:	78 1a                	js     80235f <fd_close+0x77>
+		if (dev->dev_close)
+  802345:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802348:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80234b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802350:	85 c0                	test   %eax,%eax
+  802352:	74 0b                	je     80235f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802354:	83 ec 0c             	sub    $0xc,%esp
+  802357:	56                   	push   %esi
+  802358:	ff d0                	call   *%eax
+  80235a:	89 c3                	mov    %eax,%ebx
+  80235c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80235f:	83 ec 08             	sub    $0x8,%esp
+  802362:	56                   	push   %esi
+  802363:	6a 00                	push   $0x0
+  802365:	e8 1b ec ff ff       	call   800f85 <sys_page_unmap>
+	return r;
+  80236a:	83 c4 10             	add    $0x10,%esp
+  80236d:	eb b5                	jmp    802324 <fd_close+0x3c>
+
+0080236f <close>:
+
+int
+close(int fdnum)
+{
+  80236f:	55                   	push   %ebp
+  802370:	89 e5                	mov    %esp,%ebp
+  802372:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802375:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802378:	50                   	push   %eax
+  802379:	ff 75 08             	push   0x8(%ebp)
+  80237c:	e8 a4 fe ff ff       	call   802225 <fd_lookup>
+  802381:	83 c4 10             	add    $0x10,%esp
+  802384:	85 c0                	test   %eax,%eax
+  802386:	79 02                	jns    80238a <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802388:	c9                   	leave
+  802389:	c3                   	ret
+		return fd_close(fd, 1);
+  80238a:	83 ec 08             	sub    $0x8,%esp
+  80238d:	6a 01                	push   $0x1
+  80238f:	ff 75 f4             	push   -0xc(%ebp)
+  802392:	e8 51 ff ff ff       	call   8022e8 <fd_close>
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	eb ec                	jmp    802388 <close+0x19>
+
+0080239c <close_all>:
+
+void
+close_all(void)
+{
+  80239c:	55                   	push   %ebp
+  80239d:	89 e5                	mov    %esp,%ebp
+  80239f:	53                   	push   %ebx
+  8023a0:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8023a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8023a8:	83 ec 0c             	sub    $0xc,%esp
+  8023ab:	53                   	push   %ebx
+  8023ac:	e8 be ff ff ff       	call   80236f <close>
+	for (i = 0; i < MAXFD; i++)
+  8023b1:	83 c3 01             	add    $0x1,%ebx
+  8023b4:	83 c4 10             	add    $0x10,%esp
+  8023b7:	83 fb 20             	cmp    $0x20,%ebx
+  8023ba:	75 ec                	jne    8023a8 <close_all+0xc>
+}
+  8023bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023bf:	c9                   	leave
+  8023c0:	c3                   	ret
+
+008023c1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8023c1:	55                   	push   %ebp
+  8023c2:	89 e5                	mov    %esp,%ebp
+  8023c4:	57                   	push   %edi
+  8023c5:	56                   	push   %esi
+  8023c6:	53                   	push   %ebx
+  8023c7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8023ca:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023cd:	50                   	push   %eax
+  8023ce:	ff 75 08             	push   0x8(%ebp)
+  8023d1:	e8 4f fe ff ff       	call   802225 <fd_lookup>
+  8023d6:	89 c3                	mov    %eax,%ebx
+  8023d8:	83 c4 10             	add    $0x10,%esp
+  8023db:	85 c0                	test   %eax,%eax
+  8023dd:	78 7f                	js     80245e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8023df:	83 ec 0c             	sub    $0xc,%esp
+  8023e2:	ff 75 0c             	push   0xc(%ebp)
+  8023e5:	e8 85 ff ff ff       	call   80236f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8023ea:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8023ed:	c1 e6 0c             	shl    $0xc,%esi
+  8023f0:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8023f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8023f9:	89 3c 24             	mov    %edi,(%esp)
+  8023fc:	e8 b7 fd ff ff       	call   8021b8 <fd2data>
+  802401:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802403:	89 34 24             	mov    %esi,(%esp)
+  802406:	e8 ad fd ff ff       	call   8021b8 <fd2data>
+  80240b:	83 c4 10             	add    $0x10,%esp
+  80240e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802411:	89 d8                	mov    %ebx,%eax
+  802413:	c1 e8 16             	shr    $0x16,%eax
+  802416:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80241d:	a8 01                	test   $0x1,%al
+  80241f:	74 11                	je     802432 <dup+0x71>
+  802421:	89 d8                	mov    %ebx,%eax
+  802423:	c1 e8 0c             	shr    $0xc,%eax
+  802426:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80242d:	f6 c2 01             	test   $0x1,%dl
+  802430:	75 36                	jne    802468 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802432:	89 f8                	mov    %edi,%eax
+  802434:	c1 e8 0c             	shr    $0xc,%eax
+  802437:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80243e:	83 ec 0c             	sub    $0xc,%esp
+  802441:	25 07 0e 00 00       	and    $0xe07,%eax
+  802446:	50                   	push   %eax
+  802447:	56                   	push   %esi
+  802448:	6a 00                	push   $0x0
+  80244a:	57                   	push   %edi
+  80244b:	6a 00                	push   $0x0
+  80244d:	e8 c5 ea ff ff       	call   800f17 <sys_page_map>
+  802452:	89 c3                	mov    %eax,%ebx
+  802454:	83 c4 20             	add    $0x20,%esp
+  802457:	85 c0                	test   %eax,%eax
+  802459:	78 33                	js     80248e <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80245b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80245e:	89 d8                	mov    %ebx,%eax
+  802460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802463:	5b                   	pop    %ebx
+  802464:	5e                   	pop    %esi
+  802465:	5f                   	pop    %edi
+  802466:	5d                   	pop    %ebp
+  802467:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802468:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80246f:	83 ec 0c             	sub    $0xc,%esp
+  802472:	25 07 0e 00 00       	and    $0xe07,%eax
+  802477:	50                   	push   %eax
+  802478:	ff 75 d4             	push   -0x2c(%ebp)
+  80247b:	6a 00                	push   $0x0
+  80247d:	53                   	push   %ebx
+  80247e:	6a 00                	push   $0x0
+  802480:	e8 92 ea ff ff       	call   800f17 <sys_page_map>
+  802485:	89 c3                	mov    %eax,%ebx
+  802487:	83 c4 20             	add    $0x20,%esp
+  80248a:	85 c0                	test   %eax,%eax
+  80248c:	79 a4                	jns    802432 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80248e:	83 ec 08             	sub    $0x8,%esp
+  802491:	56                   	push   %esi
+  802492:	6a 00                	push   $0x0
+  802494:	e8 ec ea ff ff       	call   800f85 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802499:	83 c4 08             	add    $0x8,%esp
+  80249c:	ff 75 d4             	push   -0x2c(%ebp)
+  80249f:	6a 00                	push   $0x0
+  8024a1:	e8 df ea ff ff       	call   800f85 <sys_page_unmap>
+	return r;
+  8024a6:	83 c4 10             	add    $0x10,%esp
+  8024a9:	eb b3                	jmp    80245e <dup+0x9d>
+
+008024ab <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8024ab:	55                   	push   %ebp
+  8024ac:	89 e5                	mov    %esp,%ebp
+  8024ae:	56                   	push   %esi
+  8024af:	53                   	push   %ebx
+  8024b0:	83 ec 18             	sub    $0x18,%esp
+  8024b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024b6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024b9:	50                   	push   %eax
+  8024ba:	53                   	push   %ebx
+  8024bb:	e8 65 fd ff ff       	call   802225 <fd_lookup>
+  8024c0:	83 c4 10             	add    $0x10,%esp
+  8024c3:	85 c0                	test   %eax,%eax
+  8024c5:	78 3c                	js     802503 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024c7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024ca:	83 ec 08             	sub    $0x8,%esp
+  8024cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d0:	50                   	push   %eax
+  8024d1:	ff 36                	push   (%esi)
+  8024d3:	e8 9d fd ff ff       	call   802275 <dev_lookup>
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	78 24                	js     802503 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8024df:	8b 46 08             	mov    0x8(%esi),%eax
+  8024e2:	83 e0 03             	and    $0x3,%eax
+  8024e5:	83 f8 01             	cmp    $0x1,%eax
+  8024e8:	74 20                	je     80250a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8024ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ed:	8b 40 08             	mov    0x8(%eax),%eax
+  8024f0:	85 c0                	test   %eax,%eax
+  8024f2:	74 57                	je     80254b <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8024f4:	83 ec 04             	sub    $0x4,%esp
+  8024f7:	ff 75 10             	push   0x10(%ebp)
+  8024fa:	ff 75 0c             	push   0xc(%ebp)
+  8024fd:	56                   	push   %esi
+  8024fe:	ff d0                	call   *%eax
+  802500:	83 c4 10             	add    $0x10,%esp
+}
+  802503:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802506:	5b                   	pop    %ebx
+  802507:	5e                   	pop    %esi
+  802508:	5d                   	pop    %ebp
+  802509:	c3                   	ret
+  80250a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80250c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802511:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802517:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80251c:	76 1c                	jbe    80253a <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80251e:	8b 42 48             	mov    0x48(%edx),%eax
+  802521:	83 ec 04             	sub    $0x4,%esp
+  802524:	53                   	push   %ebx
+  802525:	50                   	push   %eax
+  802526:	68 31 3a 80 00       	push   $0x803a31
+  80252b:	e8 3a de ff ff       	call   80036a <cprintf>
+		return -E_INVAL;
+  802530:	83 c4 10             	add    $0x10,%esp
+  802533:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802538:	eb c9                	jmp    802503 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80253a:	c1 e8 10             	shr    $0x10,%eax
+  80253d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802543:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802549:	eb d3                	jmp    80251e <read+0x73>
+		return -E_NOT_SUPP;
+  80254b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802550:	eb b1                	jmp    802503 <read+0x58>
+
+00802552 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802552:	55                   	push   %ebp
+  802553:	89 e5                	mov    %esp,%ebp
+  802555:	57                   	push   %edi
+  802556:	56                   	push   %esi
+  802557:	53                   	push   %ebx
+  802558:	83 ec 0c             	sub    $0xc,%esp
+  80255b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80255e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802561:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802566:	eb 02                	jmp    80256a <readn+0x18>
+  802568:	01 c3                	add    %eax,%ebx
+  80256a:	39 f3                	cmp    %esi,%ebx
+  80256c:	73 21                	jae    80258f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80256e:	83 ec 04             	sub    $0x4,%esp
+  802571:	89 f0                	mov    %esi,%eax
+  802573:	29 d8                	sub    %ebx,%eax
+  802575:	50                   	push   %eax
+  802576:	89 d8                	mov    %ebx,%eax
+  802578:	03 45 0c             	add    0xc(%ebp),%eax
+  80257b:	50                   	push   %eax
+  80257c:	57                   	push   %edi
+  80257d:	e8 29 ff ff ff       	call   8024ab <read>
+		if (m < 0)
+  802582:	83 c4 10             	add    $0x10,%esp
+  802585:	85 c0                	test   %eax,%eax
+  802587:	78 04                	js     80258d <readn+0x3b>
+			return m;
+		if (m == 0)
+  802589:	75 dd                	jne    802568 <readn+0x16>
+  80258b:	eb 02                	jmp    80258f <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80258d:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80258f:	89 d8                	mov    %ebx,%eax
+  802591:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802594:	5b                   	pop    %ebx
+  802595:	5e                   	pop    %esi
+  802596:	5f                   	pop    %edi
+  802597:	5d                   	pop    %ebp
+  802598:	c3                   	ret
+
+00802599 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802599:	55                   	push   %ebp
+  80259a:	89 e5                	mov    %esp,%ebp
+  80259c:	56                   	push   %esi
+  80259d:	53                   	push   %ebx
+  80259e:	83 ec 18             	sub    $0x18,%esp
+  8025a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025a4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025a7:	50                   	push   %eax
+  8025a8:	53                   	push   %ebx
+  8025a9:	e8 77 fc ff ff       	call   802225 <fd_lookup>
+  8025ae:	83 c4 10             	add    $0x10,%esp
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	78 37                	js     8025ec <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025b5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025b8:	83 ec 08             	sub    $0x8,%esp
+  8025bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025be:	50                   	push   %eax
+  8025bf:	ff 36                	push   (%esi)
+  8025c1:	e8 af fc ff ff       	call   802275 <dev_lookup>
+  8025c6:	83 c4 10             	add    $0x10,%esp
+  8025c9:	85 c0                	test   %eax,%eax
+  8025cb:	78 1f                	js     8025ec <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025cd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8025d1:	74 20                	je     8025f3 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8025d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025d6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025d9:	85 c0                	test   %eax,%eax
+  8025db:	74 57                	je     802634 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8025dd:	83 ec 04             	sub    $0x4,%esp
+  8025e0:	ff 75 10             	push   0x10(%ebp)
+  8025e3:	ff 75 0c             	push   0xc(%ebp)
+  8025e6:	56                   	push   %esi
+  8025e7:	ff d0                	call   *%eax
+  8025e9:	83 c4 10             	add    $0x10,%esp
+}
+  8025ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ef:	5b                   	pop    %ebx
+  8025f0:	5e                   	pop    %esi
+  8025f1:	5d                   	pop    %ebp
+  8025f2:	c3                   	ret
+  8025f3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025f5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025fa:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802600:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802605:	76 1c                	jbe    802623 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802607:	8b 42 48             	mov    0x48(%edx),%eax
+  80260a:	83 ec 04             	sub    $0x4,%esp
+  80260d:	53                   	push   %ebx
+  80260e:	50                   	push   %eax
+  80260f:	68 4d 3a 80 00       	push   $0x803a4d
+  802614:	e8 51 dd ff ff       	call   80036a <cprintf>
+		return -E_INVAL;
+  802619:	83 c4 10             	add    $0x10,%esp
+  80261c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802621:	eb c9                	jmp    8025ec <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802623:	c1 e8 10             	shr    $0x10,%eax
+  802626:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80262c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802632:	eb d3                	jmp    802607 <write+0x6e>
+		return -E_NOT_SUPP;
+  802634:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802639:	eb b1                	jmp    8025ec <write+0x53>
+
+0080263b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80263b:	55                   	push   %ebp
+  80263c:	89 e5                	mov    %esp,%ebp
+  80263e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802641:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802644:	50                   	push   %eax
+  802645:	ff 75 08             	push   0x8(%ebp)
+  802648:	e8 d8 fb ff ff       	call   802225 <fd_lookup>
+  80264d:	83 c4 10             	add    $0x10,%esp
+  802650:	85 c0                	test   %eax,%eax
+  802652:	78 0e                	js     802662 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802654:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802657:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80265a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802662:	c9                   	leave
+  802663:	c3                   	ret
+
+00802664 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802664:	55                   	push   %ebp
+  802665:	89 e5                	mov    %esp,%ebp
+  802667:	56                   	push   %esi
+  802668:	53                   	push   %ebx
+  802669:	83 ec 18             	sub    $0x18,%esp
+  80266c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80266f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802672:	50                   	push   %eax
+  802673:	53                   	push   %ebx
+  802674:	e8 ac fb ff ff       	call   802225 <fd_lookup>
+  802679:	83 c4 10             	add    $0x10,%esp
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	78 34                	js     8026b4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802680:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802683:	83 ec 08             	sub    $0x8,%esp
+  802686:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802689:	50                   	push   %eax
+  80268a:	ff 36                	push   (%esi)
+  80268c:	e8 e4 fb ff ff       	call   802275 <dev_lookup>
+  802691:	83 c4 10             	add    $0x10,%esp
+  802694:	85 c0                	test   %eax,%eax
+  802696:	78 1c                	js     8026b4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802698:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80269c:	74 1d                	je     8026bb <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80269e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026a1:	8b 40 18             	mov    0x18(%eax),%eax
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	74 54                	je     8026fc <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8026a8:	83 ec 08             	sub    $0x8,%esp
+  8026ab:	ff 75 0c             	push   0xc(%ebp)
+  8026ae:	56                   	push   %esi
+  8026af:	ff d0                	call   *%eax
+  8026b1:	83 c4 10             	add    $0x10,%esp
+}
+  8026b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b7:	5b                   	pop    %ebx
+  8026b8:	5e                   	pop    %esi
+  8026b9:	5d                   	pop    %ebp
+  8026ba:	c3                   	ret
+  8026bb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026bd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026c2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026c8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026cd:	76 1c                	jbe    8026eb <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8026cf:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8026d2:	83 ec 04             	sub    $0x4,%esp
+  8026d5:	53                   	push   %ebx
+  8026d6:	50                   	push   %eax
+  8026d7:	68 10 3a 80 00       	push   $0x803a10
+  8026dc:	e8 89 dc ff ff       	call   80036a <cprintf>
+		return -E_INVAL;
+  8026e1:	83 c4 10             	add    $0x10,%esp
+  8026e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026e9:	eb c9                	jmp    8026b4 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8026eb:	c1 e8 10             	shr    $0x10,%eax
+  8026ee:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026f4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8026fa:	eb d3                	jmp    8026cf <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8026fc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802701:	eb b1                	jmp    8026b4 <ftruncate+0x50>
+
+00802703 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802703:	55                   	push   %ebp
+  802704:	89 e5                	mov    %esp,%ebp
+  802706:	56                   	push   %esi
+  802707:	53                   	push   %ebx
+  802708:	83 ec 18             	sub    $0x18,%esp
+  80270b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80270e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802711:	50                   	push   %eax
+  802712:	ff 75 08             	push   0x8(%ebp)
+  802715:	e8 0b fb ff ff       	call   802225 <fd_lookup>
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	85 c0                	test   %eax,%eax
+  80271f:	78 49                	js     80276a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802721:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802724:	83 ec 08             	sub    $0x8,%esp
+  802727:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80272a:	50                   	push   %eax
+  80272b:	ff 36                	push   (%esi)
+  80272d:	e8 43 fb ff ff       	call   802275 <dev_lookup>
+  802732:	83 c4 10             	add    $0x10,%esp
+  802735:	85 c0                	test   %eax,%eax
+  802737:	78 31                	js     80276a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802739:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80273c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802740:	74 2f                	je     802771 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802742:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802745:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80274c:	00 00 00 
+	stat->st_isdir = 0;
+  80274f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802756:	00 00 00 
+	stat->st_dev = dev;
+  802759:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80275f:	83 ec 08             	sub    $0x8,%esp
+  802762:	53                   	push   %ebx
+  802763:	56                   	push   %esi
+  802764:	ff 50 14             	call   *0x14(%eax)
+  802767:	83 c4 10             	add    $0x10,%esp
+}
+  80276a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80276d:	5b                   	pop    %ebx
+  80276e:	5e                   	pop    %esi
+  80276f:	5d                   	pop    %ebp
+  802770:	c3                   	ret
+		return -E_NOT_SUPP;
+  802771:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802776:	eb f2                	jmp    80276a <fstat+0x67>
+
+00802778 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802778:	55                   	push   %ebp
+  802779:	89 e5                	mov    %esp,%ebp
+  80277b:	56                   	push   %esi
+  80277c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80277d:	83 ec 08             	sub    $0x8,%esp
+  802780:	6a 00                	push   $0x0
+  802782:	ff 75 08             	push   0x8(%ebp)
+  802785:	e8 e4 01 00 00       	call   80296e <open>
+  80278a:	89 c3                	mov    %eax,%ebx
+  80278c:	83 c4 10             	add    $0x10,%esp
+  80278f:	85 c0                	test   %eax,%eax
+  802791:	78 1b                	js     8027ae <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802793:	83 ec 08             	sub    $0x8,%esp
+  802796:	ff 75 0c             	push   0xc(%ebp)
+  802799:	50                   	push   %eax
+  80279a:	e8 64 ff ff ff       	call   802703 <fstat>
+  80279f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8027a1:	89 1c 24             	mov    %ebx,(%esp)
+  8027a4:	e8 c6 fb ff ff       	call   80236f <close>
+	return r;
+  8027a9:	83 c4 10             	add    $0x10,%esp
+  8027ac:	89 f3                	mov    %esi,%ebx
+}
+  8027ae:	89 d8                	mov    %ebx,%eax
+  8027b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027b3:	5b                   	pop    %ebx
+  8027b4:	5e                   	pop    %esi
+  8027b5:	5d                   	pop    %ebp
+  8027b6:	c3                   	ret
+
+008027b7 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8027b7:	55                   	push   %ebp
+  8027b8:	89 e5                	mov    %esp,%ebp
+  8027ba:	56                   	push   %esi
+  8027bb:	53                   	push   %ebx
+  8027bc:	89 c6                	mov    %eax,%esi
+  8027be:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8027c0:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8027c7:	74 27                	je     8027f0 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8027c9:	6a 07                	push   $0x7
+  8027cb:	68 00 60 80 00       	push   $0x806000
+  8027d0:	56                   	push   %esi
+  8027d1:	ff 35 00 50 80 00    	push   0x805000
+  8027d7:	e8 17 f7 ff ff       	call   801ef3 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8027dc:	83 c4 0c             	add    $0xc,%esp
+  8027df:	6a 00                	push   $0x0
+  8027e1:	53                   	push   %ebx
+  8027e2:	6a 00                	push   $0x0
+  8027e4:	e8 f2 f6 ff ff       	call   801edb <ipc_recv>
+}
+  8027e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ec:	5b                   	pop    %ebx
+  8027ed:	5e                   	pop    %esi
+  8027ee:	5d                   	pop    %ebp
+  8027ef:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8027f0:	83 ec 0c             	sub    $0xc,%esp
+  8027f3:	6a 01                	push   $0x1
+  8027f5:	e8 4d f7 ff ff       	call   801f47 <ipc_find_env>
+  8027fa:	a3 00 50 80 00       	mov    %eax,0x805000
+  8027ff:	83 c4 10             	add    $0x10,%esp
+  802802:	eb c5                	jmp    8027c9 <fsipc+0x12>
+
+00802804 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802804:	55                   	push   %ebp
+  802805:	89 e5                	mov    %esp,%ebp
+  802807:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80280a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80280d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802810:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802815:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802818:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80281d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802822:	b8 02 00 00 00       	mov    $0x2,%eax
+  802827:	e8 8b ff ff ff       	call   8027b7 <fsipc>
+}
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+
+0080282e <devfile_flush>:
+{
+  80282e:	55                   	push   %ebp
+  80282f:	89 e5                	mov    %esp,%ebp
+  802831:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802834:	8b 45 08             	mov    0x8(%ebp),%eax
+  802837:	8b 40 0c             	mov    0xc(%eax),%eax
+  80283a:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80283f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802844:	b8 06 00 00 00       	mov    $0x6,%eax
+  802849:	e8 69 ff ff ff       	call   8027b7 <fsipc>
+}
+  80284e:	c9                   	leave
+  80284f:	c3                   	ret
+
+00802850 <devfile_stat>:
+{
+  802850:	55                   	push   %ebp
+  802851:	89 e5                	mov    %esp,%ebp
+  802853:	53                   	push   %ebx
+  802854:	83 ec 04             	sub    $0x4,%esp
+  802857:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80285a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80285d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802860:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802865:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80286f:	e8 43 ff ff ff       	call   8027b7 <fsipc>
+  802874:	85 c0                	test   %eax,%eax
+  802876:	78 2c                	js     8028a4 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802878:	83 ec 08             	sub    $0x8,%esp
+  80287b:	68 00 60 80 00       	push   $0x806000
+  802880:	53                   	push   %ebx
+  802881:	e8 2c e1 ff ff       	call   8009b2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802886:	a1 80 60 80 00       	mov    0x806080,%eax
+  80288b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802891:	a1 84 60 80 00       	mov    0x806084,%eax
+  802896:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80289c:	83 c4 10             	add    $0x10,%esp
+  80289f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028a7:	c9                   	leave
+  8028a8:	c3                   	ret
+
+008028a9 <devfile_write>:
+{
+  8028a9:	55                   	push   %ebp
+  8028aa:	89 e5                	mov    %esp,%ebp
+  8028ac:	83 ec 0c             	sub    $0xc,%esp
+  8028af:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028b5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8028b8:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8028be:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8028c3:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8028c8:	39 d0                	cmp    %edx,%eax
+  8028ca:	0f 47 c2             	cmova  %edx,%eax
+  8028cd:	50                   	push   %eax
+  8028ce:	ff 75 0c             	push   0xc(%ebp)
+  8028d1:	68 08 60 80 00       	push   $0x806008
+  8028d6:	e8 5d e2 ff ff       	call   800b38 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8028db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8028e5:	e8 cd fe ff ff       	call   8027b7 <fsipc>
+}
+  8028ea:	c9                   	leave
+  8028eb:	c3                   	ret
+
+008028ec <devfile_read>:
+{
+  8028ec:	55                   	push   %ebp
+  8028ed:	89 e5                	mov    %esp,%ebp
+  8028ef:	56                   	push   %esi
+  8028f0:	53                   	push   %ebx
+  8028f1:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8028f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028fa:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8028ff:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802905:	ba 00 00 00 00       	mov    $0x0,%edx
+  80290a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80290f:	e8 a3 fe ff ff       	call   8027b7 <fsipc>
+  802914:	89 c3                	mov    %eax,%ebx
+  802916:	85 c0                	test   %eax,%eax
+  802918:	78 1f                	js     802939 <devfile_read+0x4d>
+	assert(r <= n);
+  80291a:	39 c6                	cmp    %eax,%esi
+  80291c:	72 24                	jb     802942 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80291e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802923:	7f 33                	jg     802958 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802925:	83 ec 04             	sub    $0x4,%esp
+  802928:	50                   	push   %eax
+  802929:	68 00 60 80 00       	push   $0x806000
+  80292e:	ff 75 0c             	push   0xc(%ebp)
+  802931:	e8 02 e2 ff ff       	call   800b38 <memmove>
+	return r;
+  802936:	83 c4 10             	add    $0x10,%esp
+}
+  802939:	89 d8                	mov    %ebx,%eax
+  80293b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80293e:	5b                   	pop    %ebx
+  80293f:	5e                   	pop    %esi
+  802940:	5d                   	pop    %ebp
+  802941:	c3                   	ret
+	assert(r <= n);
+  802942:	68 80 3a 80 00       	push   $0x803a80
+  802947:	68 50 39 80 00       	push   $0x803950
+  80294c:	6a 76                	push   $0x76
+  80294e:	68 87 3a 80 00       	push   $0x803a87
+  802953:	e8 37 d9 ff ff       	call   80028f <_panic>
+	assert(r <= PGSIZE);
+  802958:	68 92 3a 80 00       	push   $0x803a92
+  80295d:	68 50 39 80 00       	push   $0x803950
+  802962:	6a 77                	push   $0x77
+  802964:	68 87 3a 80 00       	push   $0x803a87
+  802969:	e8 21 d9 ff ff       	call   80028f <_panic>
+
+0080296e <open>:
+{
+  80296e:	55                   	push   %ebp
+  80296f:	89 e5                	mov    %esp,%ebp
+  802971:	56                   	push   %esi
+  802972:	53                   	push   %ebx
+  802973:	83 ec 1c             	sub    $0x1c,%esp
+  802976:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802979:	56                   	push   %esi
+  80297a:	e8 f8 df ff ff       	call   800977 <strlen>
+  80297f:	83 c4 10             	add    $0x10,%esp
+  802982:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802987:	7f 6c                	jg     8029f5 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802989:	83 ec 0c             	sub    $0xc,%esp
+  80298c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80298f:	50                   	push   %eax
+  802990:	e8 3a f8 ff ff       	call   8021cf <fd_alloc>
+  802995:	89 c3                	mov    %eax,%ebx
+  802997:	83 c4 10             	add    $0x10,%esp
+  80299a:	85 c0                	test   %eax,%eax
+  80299c:	78 3c                	js     8029da <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80299e:	83 ec 08             	sub    $0x8,%esp
+  8029a1:	56                   	push   %esi
+  8029a2:	68 00 60 80 00       	push   $0x806000
+  8029a7:	e8 06 e0 ff ff       	call   8009b2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8029ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029af:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8029b4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029bc:	e8 f6 fd ff ff       	call   8027b7 <fsipc>
+  8029c1:	89 c3                	mov    %eax,%ebx
+  8029c3:	83 c4 10             	add    $0x10,%esp
+  8029c6:	85 c0                	test   %eax,%eax
+  8029c8:	78 19                	js     8029e3 <open+0x75>
+	return fd2num(fd);
+  8029ca:	83 ec 0c             	sub    $0xc,%esp
+  8029cd:	ff 75 f4             	push   -0xc(%ebp)
+  8029d0:	e8 d3 f7 ff ff       	call   8021a8 <fd2num>
+  8029d5:	89 c3                	mov    %eax,%ebx
+  8029d7:	83 c4 10             	add    $0x10,%esp
+}
+  8029da:	89 d8                	mov    %ebx,%eax
+  8029dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029df:	5b                   	pop    %ebx
+  8029e0:	5e                   	pop    %esi
+  8029e1:	5d                   	pop    %ebp
+  8029e2:	c3                   	ret
+		fd_close(fd, 0);
+  8029e3:	83 ec 08             	sub    $0x8,%esp
+  8029e6:	6a 00                	push   $0x0
+  8029e8:	ff 75 f4             	push   -0xc(%ebp)
+  8029eb:	e8 f8 f8 ff ff       	call   8022e8 <fd_close>
+		return r;
+  8029f0:	83 c4 10             	add    $0x10,%esp
+  8029f3:	eb e5                	jmp    8029da <open+0x6c>
+		return -E_BAD_PATH;
+  8029f5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8029fa:	eb de                	jmp    8029da <open+0x6c>
+
+008029fc <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8029fc:	55                   	push   %ebp
+  8029fd:	89 e5                	mov    %esp,%ebp
+  8029ff:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a07:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a0c:	e8 a6 fd ff ff       	call   8027b7 <fsipc>
+}
+  802a11:	c9                   	leave
+  802a12:	c3                   	ret
+
+00802a13 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a13:	55                   	push   %ebp
+  802a14:	89 e5                	mov    %esp,%ebp
+  802a16:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a19:	68 9e 3a 80 00       	push   $0x803a9e
+  802a1e:	ff 75 0c             	push   0xc(%ebp)
+  802a21:	e8 8c df ff ff       	call   8009b2 <strcpy>
+	return 0;
+}
+  802a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2b:	c9                   	leave
+  802a2c:	c3                   	ret
+
+00802a2d <devsock_close>:
+{
+  802a2d:	55                   	push   %ebp
+  802a2e:	89 e5                	mov    %esp,%ebp
+  802a30:	53                   	push   %ebx
+  802a31:	83 ec 10             	sub    $0x10,%esp
+  802a34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a37:	53                   	push   %ebx
+  802a38:	e8 f3 09 00 00       	call   803430 <pageref>
+  802a3d:	89 c2                	mov    %eax,%edx
+  802a3f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a42:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a47:	83 fa 01             	cmp    $0x1,%edx
+  802a4a:	74 05                	je     802a51 <devsock_close+0x24>
+}
+  802a4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a4f:	c9                   	leave
+  802a50:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a51:	83 ec 0c             	sub    $0xc,%esp
+  802a54:	ff 73 0c             	push   0xc(%ebx)
+  802a57:	e8 b7 02 00 00       	call   802d13 <nsipc_close>
+  802a5c:	83 c4 10             	add    $0x10,%esp
+  802a5f:	eb eb                	jmp    802a4c <devsock_close+0x1f>
+
+00802a61 <devsock_write>:
+{
+  802a61:	55                   	push   %ebp
+  802a62:	89 e5                	mov    %esp,%ebp
+  802a64:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a67:	6a 00                	push   $0x0
+  802a69:	ff 75 10             	push   0x10(%ebp)
+  802a6c:	ff 75 0c             	push   0xc(%ebp)
+  802a6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a72:	ff 70 0c             	push   0xc(%eax)
+  802a75:	e8 79 03 00 00       	call   802df3 <nsipc_send>
+}
+  802a7a:	c9                   	leave
+  802a7b:	c3                   	ret
+
+00802a7c <devsock_read>:
+{
+  802a7c:	55                   	push   %ebp
+  802a7d:	89 e5                	mov    %esp,%ebp
+  802a7f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802a82:	6a 00                	push   $0x0
+  802a84:	ff 75 10             	push   0x10(%ebp)
+  802a87:	ff 75 0c             	push   0xc(%ebp)
+  802a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8d:	ff 70 0c             	push   0xc(%eax)
+  802a90:	e8 ef 02 00 00       	call   802d84 <nsipc_recv>
+}
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+
+00802a97 <fd2sockid>:
+{
+  802a97:	55                   	push   %ebp
+  802a98:	89 e5                	mov    %esp,%ebp
+  802a9a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802a9d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802aa0:	52                   	push   %edx
+  802aa1:	50                   	push   %eax
+  802aa2:	e8 7e f7 ff ff       	call   802225 <fd_lookup>
+  802aa7:	83 c4 10             	add    $0x10,%esp
+  802aaa:	85 c0                	test   %eax,%eax
+  802aac:	78 10                	js     802abe <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802aae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ab1:	8b 0d 28 40 80 00    	mov    0x804028,%ecx
+  802ab7:	39 08                	cmp    %ecx,(%eax)
+  802ab9:	75 05                	jne    802ac0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802abb:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802abe:	c9                   	leave
+  802abf:	c3                   	ret
+		return -E_NOT_SUPP;
+  802ac0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ac5:	eb f7                	jmp    802abe <fd2sockid+0x27>
+
+00802ac7 <alloc_sockfd>:
+{
+  802ac7:	55                   	push   %ebp
+  802ac8:	89 e5                	mov    %esp,%ebp
+  802aca:	56                   	push   %esi
+  802acb:	53                   	push   %ebx
+  802acc:	83 ec 1c             	sub    $0x1c,%esp
+  802acf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802ad1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ad4:	50                   	push   %eax
+  802ad5:	e8 f5 f6 ff ff       	call   8021cf <fd_alloc>
+  802ada:	89 c3                	mov    %eax,%ebx
+  802adc:	83 c4 10             	add    $0x10,%esp
+  802adf:	85 c0                	test   %eax,%eax
+  802ae1:	78 43                	js     802b26 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802ae3:	83 ec 04             	sub    $0x4,%esp
+  802ae6:	68 07 04 00 00       	push   $0x407
+  802aeb:	ff 75 f4             	push   -0xc(%ebp)
+  802aee:	6a 00                	push   $0x0
+  802af0:	e8 b5 e3 ff ff       	call   800eaa <sys_page_alloc>
+  802af5:	89 c3                	mov    %eax,%ebx
+  802af7:	83 c4 10             	add    $0x10,%esp
+  802afa:	85 c0                	test   %eax,%eax
+  802afc:	78 28                	js     802b26 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802afe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b01:	8b 15 28 40 80 00    	mov    0x804028,%edx
+  802b07:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b0c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b13:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b16:	83 ec 0c             	sub    $0xc,%esp
+  802b19:	50                   	push   %eax
+  802b1a:	e8 89 f6 ff ff       	call   8021a8 <fd2num>
+  802b1f:	89 c3                	mov    %eax,%ebx
+  802b21:	83 c4 10             	add    $0x10,%esp
+  802b24:	eb 0c                	jmp    802b32 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b26:	83 ec 0c             	sub    $0xc,%esp
+  802b29:	56                   	push   %esi
+  802b2a:	e8 e4 01 00 00       	call   802d13 <nsipc_close>
+		return r;
+  802b2f:	83 c4 10             	add    $0x10,%esp
+}
+  802b32:	89 d8                	mov    %ebx,%eax
+  802b34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b37:	5b                   	pop    %ebx
+  802b38:	5e                   	pop    %esi
+  802b39:	5d                   	pop    %ebp
+  802b3a:	c3                   	ret
+
+00802b3b <accept>:
+{
+  802b3b:	55                   	push   %ebp
+  802b3c:	89 e5                	mov    %esp,%ebp
+  802b3e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b44:	e8 4e ff ff ff       	call   802a97 <fd2sockid>
+  802b49:	85 c0                	test   %eax,%eax
+  802b4b:	78 1b                	js     802b68 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b4d:	83 ec 04             	sub    $0x4,%esp
+  802b50:	ff 75 10             	push   0x10(%ebp)
+  802b53:	ff 75 0c             	push   0xc(%ebp)
+  802b56:	50                   	push   %eax
+  802b57:	e8 0e 01 00 00       	call   802c6a <nsipc_accept>
+  802b5c:	83 c4 10             	add    $0x10,%esp
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	78 05                	js     802b68 <accept+0x2d>
+	return alloc_sockfd(r);
+  802b63:	e8 5f ff ff ff       	call   802ac7 <alloc_sockfd>
+}
+  802b68:	c9                   	leave
+  802b69:	c3                   	ret
+
+00802b6a <bind>:
+{
+  802b6a:	55                   	push   %ebp
+  802b6b:	89 e5                	mov    %esp,%ebp
+  802b6d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b73:	e8 1f ff ff ff       	call   802a97 <fd2sockid>
+  802b78:	85 c0                	test   %eax,%eax
+  802b7a:	78 12                	js     802b8e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802b7c:	83 ec 04             	sub    $0x4,%esp
+  802b7f:	ff 75 10             	push   0x10(%ebp)
+  802b82:	ff 75 0c             	push   0xc(%ebp)
+  802b85:	50                   	push   %eax
+  802b86:	e8 31 01 00 00       	call   802cbc <nsipc_bind>
+  802b8b:	83 c4 10             	add    $0x10,%esp
+}
+  802b8e:	c9                   	leave
+  802b8f:	c3                   	ret
+
+00802b90 <shutdown>:
+{
+  802b90:	55                   	push   %ebp
+  802b91:	89 e5                	mov    %esp,%ebp
+  802b93:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b96:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b99:	e8 f9 fe ff ff       	call   802a97 <fd2sockid>
+  802b9e:	85 c0                	test   %eax,%eax
+  802ba0:	78 0f                	js     802bb1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802ba2:	83 ec 08             	sub    $0x8,%esp
+  802ba5:	ff 75 0c             	push   0xc(%ebp)
+  802ba8:	50                   	push   %eax
+  802ba9:	e8 43 01 00 00       	call   802cf1 <nsipc_shutdown>
+  802bae:	83 c4 10             	add    $0x10,%esp
+}
+  802bb1:	c9                   	leave
+  802bb2:	c3                   	ret
+
+00802bb3 <connect>:
+{
+  802bb3:	55                   	push   %ebp
+  802bb4:	89 e5                	mov    %esp,%ebp
+  802bb6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbc:	e8 d6 fe ff ff       	call   802a97 <fd2sockid>
+  802bc1:	85 c0                	test   %eax,%eax
+  802bc3:	78 12                	js     802bd7 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802bc5:	83 ec 04             	sub    $0x4,%esp
+  802bc8:	ff 75 10             	push   0x10(%ebp)
+  802bcb:	ff 75 0c             	push   0xc(%ebp)
+  802bce:	50                   	push   %eax
+  802bcf:	e8 59 01 00 00       	call   802d2d <nsipc_connect>
+  802bd4:	83 c4 10             	add    $0x10,%esp
+}
+  802bd7:	c9                   	leave
+  802bd8:	c3                   	ret
+
+00802bd9 <listen>:
+{
+  802bd9:	55                   	push   %ebp
+  802bda:	89 e5                	mov    %esp,%ebp
+  802bdc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be2:	e8 b0 fe ff ff       	call   802a97 <fd2sockid>
+  802be7:	85 c0                	test   %eax,%eax
+  802be9:	78 0f                	js     802bfa <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802beb:	83 ec 08             	sub    $0x8,%esp
+  802bee:	ff 75 0c             	push   0xc(%ebp)
+  802bf1:	50                   	push   %eax
+  802bf2:	e8 6b 01 00 00       	call   802d62 <nsipc_listen>
+  802bf7:	83 c4 10             	add    $0x10,%esp
+}
+  802bfa:	c9                   	leave
+  802bfb:	c3                   	ret
+
+00802bfc <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802bfc:	55                   	push   %ebp
+  802bfd:	89 e5                	mov    %esp,%ebp
+  802bff:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c02:	ff 75 10             	push   0x10(%ebp)
+  802c05:	ff 75 0c             	push   0xc(%ebp)
+  802c08:	ff 75 08             	push   0x8(%ebp)
+  802c0b:	e8 41 02 00 00       	call   802e51 <nsipc_socket>
+  802c10:	83 c4 10             	add    $0x10,%esp
+  802c13:	85 c0                	test   %eax,%eax
+  802c15:	78 05                	js     802c1c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c17:	e8 ab fe ff ff       	call   802ac7 <alloc_sockfd>
+}
+  802c1c:	c9                   	leave
+  802c1d:	c3                   	ret
+
+00802c1e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c1e:	55                   	push   %ebp
+  802c1f:	89 e5                	mov    %esp,%ebp
+  802c21:	53                   	push   %ebx
+  802c22:	83 ec 04             	sub    $0x4,%esp
+  802c25:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c27:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802c2e:	74 26                	je     802c56 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c30:	6a 07                	push   $0x7
+  802c32:	68 00 70 80 00       	push   $0x807000
+  802c37:	53                   	push   %ebx
+  802c38:	ff 35 04 50 80 00    	push   0x805004
+  802c3e:	e8 b0 f2 ff ff       	call   801ef3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c43:	83 c4 0c             	add    $0xc,%esp
+  802c46:	6a 00                	push   $0x0
+  802c48:	6a 00                	push   $0x0
+  802c4a:	6a 00                	push   $0x0
+  802c4c:	e8 8a f2 ff ff       	call   801edb <ipc_recv>
+}
+  802c51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c54:	c9                   	leave
+  802c55:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c56:	83 ec 0c             	sub    $0xc,%esp
+  802c59:	6a 02                	push   $0x2
+  802c5b:	e8 e7 f2 ff ff       	call   801f47 <ipc_find_env>
+  802c60:	a3 04 50 80 00       	mov    %eax,0x805004
+  802c65:	83 c4 10             	add    $0x10,%esp
+  802c68:	eb c6                	jmp    802c30 <nsipc+0x12>
+
+00802c6a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802c6a:	55                   	push   %ebp
+  802c6b:	89 e5                	mov    %esp,%ebp
+  802c6d:	56                   	push   %esi
+  802c6e:	53                   	push   %ebx
+  802c6f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c75:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802c7a:	8b 06                	mov    (%esi),%eax
+  802c7c:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802c81:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c86:	e8 93 ff ff ff       	call   802c1e <nsipc>
+  802c8b:	89 c3                	mov    %eax,%ebx
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	79 09                	jns    802c9a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802c91:	89 d8                	mov    %ebx,%eax
+  802c93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c96:	5b                   	pop    %ebx
+  802c97:	5e                   	pop    %esi
+  802c98:	5d                   	pop    %ebp
+  802c99:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c9a:	83 ec 04             	sub    $0x4,%esp
+  802c9d:	ff 35 10 70 80 00    	push   0x807010
+  802ca3:	68 00 70 80 00       	push   $0x807000
+  802ca8:	ff 75 0c             	push   0xc(%ebp)
+  802cab:	e8 88 de ff ff       	call   800b38 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802cb0:	a1 10 70 80 00       	mov    0x807010,%eax
+  802cb5:	89 06                	mov    %eax,(%esi)
+  802cb7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802cba:	eb d5                	jmp    802c91 <nsipc_accept+0x27>
+
+00802cbc <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802cbc:	55                   	push   %ebp
+  802cbd:	89 e5                	mov    %esp,%ebp
+  802cbf:	53                   	push   %ebx
+  802cc0:	83 ec 08             	sub    $0x8,%esp
+  802cc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc9:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802cce:	53                   	push   %ebx
+  802ccf:	ff 75 0c             	push   0xc(%ebp)
+  802cd2:	68 04 70 80 00       	push   $0x807004
+  802cd7:	e8 5c de ff ff       	call   800b38 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802cdc:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802ce2:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ce7:	e8 32 ff ff ff       	call   802c1e <nsipc>
+}
+  802cec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cef:	c9                   	leave
+  802cf0:	c3                   	ret
+
+00802cf1 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802cf1:	55                   	push   %ebp
+  802cf2:	89 e5                	mov    %esp,%ebp
+  802cf4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802cf7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cfa:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802cff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d02:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d07:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d0c:	e8 0d ff ff ff       	call   802c1e <nsipc>
+}
+  802d11:	c9                   	leave
+  802d12:	c3                   	ret
+
+00802d13 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d13:	55                   	push   %ebp
+  802d14:	89 e5                	mov    %esp,%ebp
+  802d16:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d1c:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802d21:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d26:	e8 f3 fe ff ff       	call   802c1e <nsipc>
+}
+  802d2b:	c9                   	leave
+  802d2c:	c3                   	ret
+
+00802d2d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d2d:	55                   	push   %ebp
+  802d2e:	89 e5                	mov    %esp,%ebp
+  802d30:	53                   	push   %ebx
+  802d31:	83 ec 08             	sub    $0x8,%esp
+  802d34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3a:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d3f:	53                   	push   %ebx
+  802d40:	ff 75 0c             	push   0xc(%ebp)
+  802d43:	68 04 70 80 00       	push   $0x807004
+  802d48:	e8 eb dd ff ff       	call   800b38 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d4d:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802d53:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d58:	e8 c1 fe ff ff       	call   802c1e <nsipc>
+}
+  802d5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d60:	c9                   	leave
+  802d61:	c3                   	ret
+
+00802d62 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d62:	55                   	push   %ebp
+  802d63:	89 e5                	mov    %esp,%ebp
+  802d65:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d73:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802d78:	b8 06 00 00 00       	mov    $0x6,%eax
+  802d7d:	e8 9c fe ff ff       	call   802c1e <nsipc>
+}
+  802d82:	c9                   	leave
+  802d83:	c3                   	ret
+
+00802d84 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802d84:	55                   	push   %ebp
+  802d85:	89 e5                	mov    %esp,%ebp
+  802d87:	56                   	push   %esi
+  802d88:	53                   	push   %ebx
+  802d89:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802d8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802d94:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802d9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d9d:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802da2:	b8 07 00 00 00       	mov    $0x7,%eax
+  802da7:	e8 72 fe ff ff       	call   802c1e <nsipc>
+  802dac:	89 c3                	mov    %eax,%ebx
+  802dae:	85 c0                	test   %eax,%eax
+  802db0:	78 22                	js     802dd4 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802db2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802db7:	39 c6                	cmp    %eax,%esi
+  802db9:	0f 4e c6             	cmovle %esi,%eax
+  802dbc:	39 c3                	cmp    %eax,%ebx
+  802dbe:	7f 1d                	jg     802ddd <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802dc0:	83 ec 04             	sub    $0x4,%esp
+  802dc3:	53                   	push   %ebx
+  802dc4:	68 00 70 80 00       	push   $0x807000
+  802dc9:	ff 75 0c             	push   0xc(%ebp)
+  802dcc:	e8 67 dd ff ff       	call   800b38 <memmove>
+  802dd1:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802dd4:	89 d8                	mov    %ebx,%eax
+  802dd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802dd9:	5b                   	pop    %ebx
+  802dda:	5e                   	pop    %esi
+  802ddb:	5d                   	pop    %ebp
+  802ddc:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802ddd:	68 aa 3a 80 00       	push   $0x803aaa
+  802de2:	68 50 39 80 00       	push   $0x803950
+  802de7:	6a 62                	push   $0x62
+  802de9:	68 bf 3a 80 00       	push   $0x803abf
+  802dee:	e8 9c d4 ff ff       	call   80028f <_panic>
+
+00802df3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802df3:	55                   	push   %ebp
+  802df4:	89 e5                	mov    %esp,%ebp
+  802df6:	53                   	push   %ebx
+  802df7:	83 ec 04             	sub    $0x4,%esp
+  802dfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802dfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e00:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802e05:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e0b:	7f 2e                	jg     802e3b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e0d:	83 ec 04             	sub    $0x4,%esp
+  802e10:	53                   	push   %ebx
+  802e11:	ff 75 0c             	push   0xc(%ebp)
+  802e14:	68 0c 70 80 00       	push   $0x80700c
+  802e19:	e8 1a dd ff ff       	call   800b38 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e1e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802e24:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e27:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802e2c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e31:	e8 e8 fd ff ff       	call   802c1e <nsipc>
+}
+  802e36:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e39:	c9                   	leave
+  802e3a:	c3                   	ret
+	assert(size < 1600);
+  802e3b:	68 cb 3a 80 00       	push   $0x803acb
+  802e40:	68 50 39 80 00       	push   $0x803950
+  802e45:	6a 6d                	push   $0x6d
+  802e47:	68 bf 3a 80 00       	push   $0x803abf
+  802e4c:	e8 3e d4 ff ff       	call   80028f <_panic>
+
+00802e51 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e51:	55                   	push   %ebp
+  802e52:	89 e5                	mov    %esp,%ebp
+  802e54:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e57:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e5a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802e5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e62:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e67:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e6a:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802e6f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e74:	e8 a5 fd ff ff       	call   802c1e <nsipc>
+}
+  802e79:	c9                   	leave
+  802e7a:	c3                   	ret
+
+00802e7b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e7b:	55                   	push   %ebp
+  802e7c:	89 e5                	mov    %esp,%ebp
+  802e7e:	56                   	push   %esi
+  802e7f:	53                   	push   %ebx
+  802e80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802e83:	83 ec 0c             	sub    $0xc,%esp
+  802e86:	ff 75 08             	push   0x8(%ebp)
+  802e89:	e8 2a f3 ff ff       	call   8021b8 <fd2data>
+  802e8e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802e90:	83 c4 08             	add    $0x8,%esp
+  802e93:	68 d7 3a 80 00       	push   $0x803ad7
+  802e98:	53                   	push   %ebx
+  802e99:	e8 14 db ff ff       	call   8009b2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802e9e:	8b 46 04             	mov    0x4(%esi),%eax
+  802ea1:	2b 06                	sub    (%esi),%eax
+  802ea3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ea9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802eb0:	00 00 00 
+	stat->st_dev = &devpipe;
+  802eb3:	c7 83 88 00 00 00 44 	movl   $0x804044,0x88(%ebx)
+  802eba:	40 80 00 
+	return 0;
+}
+  802ebd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ec5:	5b                   	pop    %ebx
+  802ec6:	5e                   	pop    %esi
+  802ec7:	5d                   	pop    %ebp
+  802ec8:	c3                   	ret
+
+00802ec9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ec9:	55                   	push   %ebp
+  802eca:	89 e5                	mov    %esp,%ebp
+  802ecc:	53                   	push   %ebx
+  802ecd:	83 ec 0c             	sub    $0xc,%esp
+  802ed0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802ed3:	53                   	push   %ebx
+  802ed4:	6a 00                	push   $0x0
+  802ed6:	e8 aa e0 ff ff       	call   800f85 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802edb:	89 1c 24             	mov    %ebx,(%esp)
+  802ede:	e8 d5 f2 ff ff       	call   8021b8 <fd2data>
+  802ee3:	83 c4 08             	add    $0x8,%esp
+  802ee6:	50                   	push   %eax
+  802ee7:	6a 00                	push   $0x0
+  802ee9:	e8 97 e0 ff ff       	call   800f85 <sys_page_unmap>
+}
+  802eee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ef1:	c9                   	leave
+  802ef2:	c3                   	ret
+
+00802ef3 <_pipeisclosed>:
+{
+  802ef3:	55                   	push   %ebp
+  802ef4:	89 e5                	mov    %esp,%ebp
+  802ef6:	57                   	push   %edi
+  802ef7:	56                   	push   %esi
+  802ef8:	53                   	push   %ebx
+  802ef9:	83 ec 1c             	sub    $0x1c,%esp
+  802efc:	89 c7                	mov    %eax,%edi
+  802efe:	89 d6                	mov    %edx,%esi
+  802f00:	eb 3c                	jmp    802f3e <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802f02:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f05:	83 ec 0c             	sub    $0xc,%esp
+  802f08:	57                   	push   %edi
+  802f09:	e8 22 05 00 00       	call   803430 <pageref>
+  802f0e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f11:	89 34 24             	mov    %esi,(%esp)
+  802f14:	e8 17 05 00 00       	call   803430 <pageref>
+  802f19:	89 c2                	mov    %eax,%edx
+  802f1b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f1d:	05 00 00 00 20       	add    $0x20000000,%eax
+  802f22:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802f25:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f2b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f30:	76 31                	jbe    802f63 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802f32:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802f35:	39 c3                	cmp    %eax,%ebx
+  802f37:	74 76                	je     802faf <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802f39:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f3c:	74 36                	je     802f74 <_pipeisclosed+0x81>
+  802f3e:	89 e0                	mov    %esp,%eax
+  802f40:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f45:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f4b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f50:	77 b0                	ja     802f02 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f52:	c1 e8 10             	shr    $0x10,%eax
+  802f55:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f5b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f61:	eb 9f                	jmp    802f02 <_pipeisclosed+0xf>
+  802f63:	c1 e8 10             	shr    $0x10,%eax
+  802f66:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f6c:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802f72:	eb be                	jmp    802f32 <_pipeisclosed+0x3f>
+  802f74:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f76:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f7b:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f81:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f86:	76 16                	jbe    802f9e <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802f88:	8b 42 58             	mov    0x58(%edx),%eax
+  802f8b:	6a 01                	push   $0x1
+  802f8d:	50                   	push   %eax
+  802f8e:	53                   	push   %ebx
+  802f8f:	68 de 3a 80 00       	push   $0x803ade
+  802f94:	e8 d1 d3 ff ff       	call   80036a <cprintf>
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	eb a0                	jmp    802f3e <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f9e:	c1 e8 10             	shr    $0x10,%eax
+  802fa1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fa7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802fad:	eb d9                	jmp    802f88 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802faf:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802fb2:	0f 94 c0             	sete   %al
+  802fb5:	0f b6 c0             	movzbl %al,%eax
+}
+  802fb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fbb:	5b                   	pop    %ebx
+  802fbc:	5e                   	pop    %esi
+  802fbd:	5f                   	pop    %edi
+  802fbe:	5d                   	pop    %ebp
+  802fbf:	c3                   	ret
+
+00802fc0 <devpipe_write>:
+{
+  802fc0:	55                   	push   %ebp
+  802fc1:	89 e5                	mov    %esp,%ebp
+  802fc3:	57                   	push   %edi
+  802fc4:	56                   	push   %esi
+  802fc5:	53                   	push   %ebx
+  802fc6:	83 ec 28             	sub    $0x28,%esp
+  802fc9:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802fcc:	56                   	push   %esi
+  802fcd:	e8 e6 f1 ff ff       	call   8021b8 <fd2data>
+  802fd2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802fd4:	83 c4 10             	add    $0x10,%esp
+  802fd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fdc:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802fdf:	75 09                	jne    802fea <devpipe_write+0x2a>
+	return i;
+  802fe1:	89 f8                	mov    %edi,%eax
+  802fe3:	eb 23                	jmp    803008 <devpipe_write+0x48>
+			sys_yield();
+  802fe5:	e8 7a de ff ff       	call   800e64 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802fea:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fed:	8b 0b                	mov    (%ebx),%ecx
+  802fef:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ff2:	39 d0                	cmp    %edx,%eax
+  802ff4:	72 1a                	jb     803010 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802ff6:	89 da                	mov    %ebx,%edx
+  802ff8:	89 f0                	mov    %esi,%eax
+  802ffa:	e8 f4 fe ff ff       	call   802ef3 <_pipeisclosed>
+  802fff:	85 c0                	test   %eax,%eax
+  803001:	74 e2                	je     802fe5 <devpipe_write+0x25>
+				return 0;
+  803003:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803008:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80300b:	5b                   	pop    %ebx
+  80300c:	5e                   	pop    %esi
+  80300d:	5f                   	pop    %edi
+  80300e:	5d                   	pop    %ebp
+  80300f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803010:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803013:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803017:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80301a:	89 c2                	mov    %eax,%edx
+  80301c:	c1 fa 1f             	sar    $0x1f,%edx
+  80301f:	89 d1                	mov    %edx,%ecx
+  803021:	c1 e9 1b             	shr    $0x1b,%ecx
+  803024:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803027:	83 e2 1f             	and    $0x1f,%edx
+  80302a:	29 ca                	sub    %ecx,%edx
+  80302c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803030:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803034:	83 c0 01             	add    $0x1,%eax
+  803037:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80303a:	83 c7 01             	add    $0x1,%edi
+  80303d:	eb 9d                	jmp    802fdc <devpipe_write+0x1c>
+
+0080303f <devpipe_read>:
+{
+  80303f:	55                   	push   %ebp
+  803040:	89 e5                	mov    %esp,%ebp
+  803042:	57                   	push   %edi
+  803043:	56                   	push   %esi
+  803044:	53                   	push   %ebx
+  803045:	83 ec 18             	sub    $0x18,%esp
+  803048:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80304b:	57                   	push   %edi
+  80304c:	e8 67 f1 ff ff       	call   8021b8 <fd2data>
+  803051:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803053:	83 c4 10             	add    $0x10,%esp
+  803056:	be 00 00 00 00       	mov    $0x0,%esi
+  80305b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80305e:	75 13                	jne    803073 <devpipe_read+0x34>
+	return i;
+  803060:	89 f0                	mov    %esi,%eax
+  803062:	eb 02                	jmp    803066 <devpipe_read+0x27>
+				return i;
+  803064:	89 f0                	mov    %esi,%eax
+}
+  803066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803069:	5b                   	pop    %ebx
+  80306a:	5e                   	pop    %esi
+  80306b:	5f                   	pop    %edi
+  80306c:	5d                   	pop    %ebp
+  80306d:	c3                   	ret
+			sys_yield();
+  80306e:	e8 f1 dd ff ff       	call   800e64 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803073:	8b 03                	mov    (%ebx),%eax
+  803075:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803078:	75 18                	jne    803092 <devpipe_read+0x53>
+			if (i > 0)
+  80307a:	85 f6                	test   %esi,%esi
+  80307c:	75 e6                	jne    803064 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80307e:	89 da                	mov    %ebx,%edx
+  803080:	89 f8                	mov    %edi,%eax
+  803082:	e8 6c fe ff ff       	call   802ef3 <_pipeisclosed>
+  803087:	85 c0                	test   %eax,%eax
+  803089:	74 e3                	je     80306e <devpipe_read+0x2f>
+				return 0;
+  80308b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803090:	eb d4                	jmp    803066 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803092:	99                   	cltd
+  803093:	c1 ea 1b             	shr    $0x1b,%edx
+  803096:	01 d0                	add    %edx,%eax
+  803098:	83 e0 1f             	and    $0x1f,%eax
+  80309b:	29 d0                	sub    %edx,%eax
+  80309d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8030a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030a5:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030a8:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8030ab:	83 c6 01             	add    $0x1,%esi
+  8030ae:	eb ab                	jmp    80305b <devpipe_read+0x1c>
+
+008030b0 <pipe>:
+{
+  8030b0:	55                   	push   %ebp
+  8030b1:	89 e5                	mov    %esp,%ebp
+  8030b3:	56                   	push   %esi
+  8030b4:	53                   	push   %ebx
+  8030b5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030bb:	50                   	push   %eax
+  8030bc:	e8 0e f1 ff ff       	call   8021cf <fd_alloc>
+  8030c1:	89 c3                	mov    %eax,%ebx
+  8030c3:	83 c4 10             	add    $0x10,%esp
+  8030c6:	85 c0                	test   %eax,%eax
+  8030c8:	0f 88 23 01 00 00    	js     8031f1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030ce:	83 ec 04             	sub    $0x4,%esp
+  8030d1:	68 07 04 00 00       	push   $0x407
+  8030d6:	ff 75 f4             	push   -0xc(%ebp)
+  8030d9:	6a 00                	push   $0x0
+  8030db:	e8 ca dd ff ff       	call   800eaa <sys_page_alloc>
+  8030e0:	89 c3                	mov    %eax,%ebx
+  8030e2:	83 c4 10             	add    $0x10,%esp
+  8030e5:	85 c0                	test   %eax,%eax
+  8030e7:	0f 88 04 01 00 00    	js     8031f1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030ed:	83 ec 0c             	sub    $0xc,%esp
+  8030f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030f3:	50                   	push   %eax
+  8030f4:	e8 d6 f0 ff ff       	call   8021cf <fd_alloc>
+  8030f9:	89 c3                	mov    %eax,%ebx
+  8030fb:	83 c4 10             	add    $0x10,%esp
+  8030fe:	85 c0                	test   %eax,%eax
+  803100:	0f 88 db 00 00 00    	js     8031e1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803106:	83 ec 04             	sub    $0x4,%esp
+  803109:	68 07 04 00 00       	push   $0x407
+  80310e:	ff 75 f0             	push   -0x10(%ebp)
+  803111:	6a 00                	push   $0x0
+  803113:	e8 92 dd ff ff       	call   800eaa <sys_page_alloc>
+  803118:	89 c3                	mov    %eax,%ebx
+  80311a:	83 c4 10             	add    $0x10,%esp
+  80311d:	85 c0                	test   %eax,%eax
+  80311f:	0f 88 bc 00 00 00    	js     8031e1 <pipe+0x131>
+	va = fd2data(fd0);
+  803125:	83 ec 0c             	sub    $0xc,%esp
+  803128:	ff 75 f4             	push   -0xc(%ebp)
+  80312b:	e8 88 f0 ff ff       	call   8021b8 <fd2data>
+  803130:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803132:	83 c4 0c             	add    $0xc,%esp
+  803135:	68 07 04 00 00       	push   $0x407
+  80313a:	50                   	push   %eax
+  80313b:	6a 00                	push   $0x0
+  80313d:	e8 68 dd ff ff       	call   800eaa <sys_page_alloc>
+  803142:	89 c3                	mov    %eax,%ebx
+  803144:	83 c4 10             	add    $0x10,%esp
+  803147:	85 c0                	test   %eax,%eax
+  803149:	0f 88 82 00 00 00    	js     8031d1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80314f:	83 ec 0c             	sub    $0xc,%esp
+  803152:	ff 75 f0             	push   -0x10(%ebp)
+  803155:	e8 5e f0 ff ff       	call   8021b8 <fd2data>
+  80315a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803161:	50                   	push   %eax
+  803162:	6a 00                	push   $0x0
+  803164:	56                   	push   %esi
+  803165:	6a 00                	push   $0x0
+  803167:	e8 ab dd ff ff       	call   800f17 <sys_page_map>
+  80316c:	89 c3                	mov    %eax,%ebx
+  80316e:	83 c4 20             	add    $0x20,%esp
+  803171:	85 c0                	test   %eax,%eax
+  803173:	78 4e                	js     8031c3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803175:	a1 44 40 80 00       	mov    0x804044,%eax
+  80317a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80317d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80317f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803182:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803189:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80318c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80318e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803191:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803198:	83 ec 0c             	sub    $0xc,%esp
+  80319b:	ff 75 f4             	push   -0xc(%ebp)
+  80319e:	e8 05 f0 ff ff       	call   8021a8 <fd2num>
+  8031a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031a6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031a8:	83 c4 04             	add    $0x4,%esp
+  8031ab:	ff 75 f0             	push   -0x10(%ebp)
+  8031ae:	e8 f5 ef ff ff       	call   8021a8 <fd2num>
+  8031b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031b6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031b9:	83 c4 10             	add    $0x10,%esp
+  8031bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031c1:	eb 2e                	jmp    8031f1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031c3:	83 ec 08             	sub    $0x8,%esp
+  8031c6:	56                   	push   %esi
+  8031c7:	6a 00                	push   $0x0
+  8031c9:	e8 b7 dd ff ff       	call   800f85 <sys_page_unmap>
+  8031ce:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031d1:	83 ec 08             	sub    $0x8,%esp
+  8031d4:	ff 75 f0             	push   -0x10(%ebp)
+  8031d7:	6a 00                	push   $0x0
+  8031d9:	e8 a7 dd ff ff       	call   800f85 <sys_page_unmap>
+  8031de:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031e1:	83 ec 08             	sub    $0x8,%esp
+  8031e4:	ff 75 f4             	push   -0xc(%ebp)
+  8031e7:	6a 00                	push   $0x0
+  8031e9:	e8 97 dd ff ff       	call   800f85 <sys_page_unmap>
+  8031ee:	83 c4 10             	add    $0x10,%esp
+}
+  8031f1:	89 d8                	mov    %ebx,%eax
+  8031f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031f6:	5b                   	pop    %ebx
+  8031f7:	5e                   	pop    %esi
+  8031f8:	5d                   	pop    %ebp
+  8031f9:	c3                   	ret
+
+008031fa <pipeisclosed>:
+{
+  8031fa:	55                   	push   %ebp
+  8031fb:	89 e5                	mov    %esp,%ebp
+  8031fd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803200:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803203:	50                   	push   %eax
+  803204:	ff 75 08             	push   0x8(%ebp)
+  803207:	e8 19 f0 ff ff       	call   802225 <fd_lookup>
+  80320c:	83 c4 10             	add    $0x10,%esp
+  80320f:	85 c0                	test   %eax,%eax
+  803211:	78 18                	js     80322b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803213:	83 ec 0c             	sub    $0xc,%esp
+  803216:	ff 75 f4             	push   -0xc(%ebp)
+  803219:	e8 9a ef ff ff       	call   8021b8 <fd2data>
+  80321e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803220:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803223:	e8 cb fc ff ff       	call   802ef3 <_pipeisclosed>
+  803228:	83 c4 10             	add    $0x10,%esp
+}
+  80322b:	c9                   	leave
+  80322c:	c3                   	ret
+
+0080322d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80322d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803232:	c3                   	ret
+
+00803233 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803233:	55                   	push   %ebp
+  803234:	89 e5                	mov    %esp,%ebp
+  803236:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803239:	68 f6 3a 80 00       	push   $0x803af6
+  80323e:	ff 75 0c             	push   0xc(%ebp)
+  803241:	e8 6c d7 ff ff       	call   8009b2 <strcpy>
+	return 0;
+}
+  803246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324b:	c9                   	leave
+  80324c:	c3                   	ret
+
+0080324d <devcons_write>:
+{
+  80324d:	55                   	push   %ebp
+  80324e:	89 e5                	mov    %esp,%ebp
+  803250:	57                   	push   %edi
+  803251:	56                   	push   %esi
+  803252:	53                   	push   %ebx
+  803253:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803259:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80325e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803264:	eb 2e                	jmp    803294 <devcons_write+0x47>
+		m = n - tot;
+  803266:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803269:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80326b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803270:	39 c3                	cmp    %eax,%ebx
+  803272:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803275:	83 ec 04             	sub    $0x4,%esp
+  803278:	53                   	push   %ebx
+  803279:	89 f0                	mov    %esi,%eax
+  80327b:	03 45 0c             	add    0xc(%ebp),%eax
+  80327e:	50                   	push   %eax
+  80327f:	57                   	push   %edi
+  803280:	e8 b3 d8 ff ff       	call   800b38 <memmove>
+		sys_cputs(buf, m);
+  803285:	83 c4 08             	add    $0x8,%esp
+  803288:	53                   	push   %ebx
+  803289:	57                   	push   %edi
+  80328a:	e8 9c da ff ff       	call   800d2b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80328f:	01 de                	add    %ebx,%esi
+  803291:	83 c4 10             	add    $0x10,%esp
+  803294:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803297:	72 cd                	jb     803266 <devcons_write+0x19>
+}
+  803299:	89 f0                	mov    %esi,%eax
+  80329b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80329e:	5b                   	pop    %ebx
+  80329f:	5e                   	pop    %esi
+  8032a0:	5f                   	pop    %edi
+  8032a1:	5d                   	pop    %ebp
+  8032a2:	c3                   	ret
+
+008032a3 <devcons_read>:
+{
+  8032a3:	55                   	push   %ebp
+  8032a4:	89 e5                	mov    %esp,%ebp
+  8032a6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8032a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ae:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8032b2:	75 07                	jne    8032bb <devcons_read+0x18>
+  8032b4:	eb 1f                	jmp    8032d5 <devcons_read+0x32>
+		sys_yield();
+  8032b6:	e8 a9 db ff ff       	call   800e64 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8032bb:	e8 af da ff ff       	call   800d6f <sys_cgetc>
+  8032c0:	85 c0                	test   %eax,%eax
+  8032c2:	74 f2                	je     8032b6 <devcons_read+0x13>
+	if (c < 0)
+  8032c4:	78 0f                	js     8032d5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8032c6:	83 f8 04             	cmp    $0x4,%eax
+  8032c9:	74 0c                	je     8032d7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8032cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032ce:	88 02                	mov    %al,(%edx)
+	return 1;
+  8032d0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8032d5:	c9                   	leave
+  8032d6:	c3                   	ret
+		return 0;
+  8032d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032dc:	eb f7                	jmp    8032d5 <devcons_read+0x32>
+
+008032de <cputchar>:
+{
+  8032de:	55                   	push   %ebp
+  8032df:	89 e5                	mov    %esp,%ebp
+  8032e1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8032e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8032ea:	6a 01                	push   $0x1
+  8032ec:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032ef:	50                   	push   %eax
+  8032f0:	e8 36 da ff ff       	call   800d2b <sys_cputs>
+}
+  8032f5:	83 c4 10             	add    $0x10,%esp
+  8032f8:	c9                   	leave
+  8032f9:	c3                   	ret
+
+008032fa <getchar>:
+{
+  8032fa:	55                   	push   %ebp
+  8032fb:	89 e5                	mov    %esp,%ebp
+  8032fd:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803300:	6a 01                	push   $0x1
+  803302:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803305:	50                   	push   %eax
+  803306:	6a 00                	push   $0x0
+  803308:	e8 9e f1 ff ff       	call   8024ab <read>
+	if (r < 0)
+  80330d:	83 c4 10             	add    $0x10,%esp
+  803310:	85 c0                	test   %eax,%eax
+  803312:	78 06                	js     80331a <getchar+0x20>
+	if (r < 1)
+  803314:	74 06                	je     80331c <getchar+0x22>
+	return c;
+  803316:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80331a:	c9                   	leave
+  80331b:	c3                   	ret
+		return -E_EOF;
+  80331c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803321:	eb f7                	jmp    80331a <getchar+0x20>
+
+00803323 <iscons>:
+{
+  803323:	55                   	push   %ebp
+  803324:	89 e5                	mov    %esp,%ebp
+  803326:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803329:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80332c:	50                   	push   %eax
+  80332d:	ff 75 08             	push   0x8(%ebp)
+  803330:	e8 f0 ee ff ff       	call   802225 <fd_lookup>
+  803335:	83 c4 10             	add    $0x10,%esp
+  803338:	85 c0                	test   %eax,%eax
+  80333a:	78 11                	js     80334d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80333c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80333f:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  803345:	39 10                	cmp    %edx,(%eax)
+  803347:	0f 94 c0             	sete   %al
+  80334a:	0f b6 c0             	movzbl %al,%eax
+}
+  80334d:	c9                   	leave
+  80334e:	c3                   	ret
+
+0080334f <opencons>:
+{
+  80334f:	55                   	push   %ebp
+  803350:	89 e5                	mov    %esp,%ebp
+  803352:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803355:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803358:	50                   	push   %eax
+  803359:	e8 71 ee ff ff       	call   8021cf <fd_alloc>
+  80335e:	83 c4 10             	add    $0x10,%esp
+  803361:	85 c0                	test   %eax,%eax
+  803363:	78 3a                	js     80339f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803365:	83 ec 04             	sub    $0x4,%esp
+  803368:	68 07 04 00 00       	push   $0x407
+  80336d:	ff 75 f4             	push   -0xc(%ebp)
+  803370:	6a 00                	push   $0x0
+  803372:	e8 33 db ff ff       	call   800eaa <sys_page_alloc>
+  803377:	83 c4 10             	add    $0x10,%esp
+  80337a:	85 c0                	test   %eax,%eax
+  80337c:	78 21                	js     80339f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80337e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803381:	8b 15 60 40 80 00    	mov    0x804060,%edx
+  803387:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803389:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80338c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803393:	83 ec 0c             	sub    $0xc,%esp
+  803396:	50                   	push   %eax
+  803397:	e8 0c ee ff ff       	call   8021a8 <fd2num>
+  80339c:	83 c4 10             	add    $0x10,%esp
+}
+  80339f:	c9                   	leave
+  8033a0:	c3                   	ret
+
+008033a1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8033a1:	55                   	push   %ebp
+  8033a2:	89 e5                	mov    %esp,%ebp
+  8033a4:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8033a7:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8033ae:	74 0a                	je     8033ba <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8033b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033b3:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8033b8:	c9                   	leave
+  8033b9:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8033ba:	83 ec 04             	sub    $0x4,%esp
+  8033bd:	6a 07                	push   $0x7
+  8033bf:	68 00 f0 bf ee       	push   $0xeebff000
+  8033c4:	6a 00                	push   $0x0
+  8033c6:	e8 df da ff ff       	call   800eaa <sys_page_alloc>
+  8033cb:	83 c4 10             	add    $0x10,%esp
+  8033ce:	85 c0                	test   %eax,%eax
+  8033d0:	78 14                	js     8033e6 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8033d2:	83 ec 08             	sub    $0x8,%esp
+  8033d5:	68 08 34 80 00       	push   $0x803408
+  8033da:	6a 00                	push   $0x0
+  8033dc:	e8 e5 dc ff ff       	call   8010c6 <sys_env_set_pgfault_upcall>
+  8033e1:	83 c4 10             	add    $0x10,%esp
+  8033e4:	eb ca                	jmp    8033b0 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8033e6:	83 ec 08             	sub    $0x8,%esp
+  8033e9:	50                   	push   %eax
+  8033ea:	68 02 3b 80 00       	push   $0x803b02
+  8033ef:	e8 76 cf ff ff       	call   80036a <cprintf>
+			panic("set_pgfault_handler error");
+  8033f4:	83 c4 0c             	add    $0xc,%esp
+  8033f7:	68 0d 3b 80 00       	push   $0x803b0d
+  8033fc:	6a 24                	push   $0x24
+  8033fe:	68 27 3b 80 00       	push   $0x803b27
+  803403:	e8 87 ce ff ff       	call   80028f <_panic>
+
+00803408 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803408:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803409:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80340e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803410:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803413:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  803417:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  80341a:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  80341e:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803420:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803424:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803425:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803429:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  80342a:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  80342b:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80342f:	c3                   	ret
+
+00803430 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803430:	55                   	push   %ebp
+  803431:	89 e5                	mov    %esp,%ebp
+  803433:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803436:	89 c2                	mov    %eax,%edx
+  803438:	c1 ea 16             	shr    $0x16,%edx
+  80343b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803442:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803447:	f6 c1 01             	test   $0x1,%cl
+  80344a:	74 1a                	je     803466 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  80344c:	c1 e8 0c             	shr    $0xc,%eax
+  80344f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803456:	a8 01                	test   $0x1,%al
+  803458:	74 0c                	je     803466 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80345a:	c1 e8 0c             	shr    $0xc,%eax
+  80345d:	c1 e0 04             	shl    $0x4,%eax
+  803460:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803466:	89 d0                	mov    %edx,%eax
+  803468:	5d                   	pop    %ebp
+  803469:	c3                   	ret
@@ -0,0 +1,9249 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a3 0a 00 00       	call   800ad4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <_gettoken>:
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	int t;
+
+	if (s == 0) {
+  800042:	85 db                	test   %ebx,%ebx
+  800044:	74 1a                	je     800060 <_gettoken+0x2d>
+		if (debug > 1)
+			cprintf("GETTOKEN NULL\n");
+		return 0;
+	}
+
+	if (debug > 1)
+  800046:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80004d:	7f 31                	jg     800080 <_gettoken+0x4d>
+		cprintf("GETTOKEN: %s\n", s);
+
+	*p1 = 0;
+  80004f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	*p2 = 0;
+  800055:	8b 45 10             	mov    0x10(%ebp),%eax
+  800058:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+	while (strchr(WHITESPACE, *s))
+  80005e:	eb 3a                	jmp    80009a <_gettoken+0x67>
+		return 0;
+  800060:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  800065:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80006c:	7e 59                	jle    8000c7 <_gettoken+0x94>
+			cprintf("GETTOKEN NULL\n");
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	68 00 47 80 00       	push   $0x804700
+  800076:	e8 f8 0b 00 00       	call   800c73 <cprintf>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	eb 47                	jmp    8000c7 <_gettoken+0x94>
+		cprintf("GETTOKEN: %s\n", s);
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	53                   	push   %ebx
+  800084:	68 0f 47 80 00       	push   $0x80470f
+  800089:	e8 e5 0b 00 00       	call   800c73 <cprintf>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	eb bc                	jmp    80004f <_gettoken+0x1c>
+		*s++ = 0;
+  800093:	83 c3 01             	add    $0x1,%ebx
+  800096:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+	while (strchr(WHITESPACE, *s))
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	0f be 03             	movsbl (%ebx),%eax
+  8000a0:	50                   	push   %eax
+  8000a1:	68 1d 47 80 00       	push   $0x80471d
+  8000a6:	e8 12 14 00 00       	call   8014bd <strchr>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 e1                	jne    800093 <_gettoken+0x60>
+	if (*s == 0) {
+  8000b2:	0f b6 03             	movzbl (%ebx),%eax
+  8000b5:	84 c0                	test   %al,%al
+  8000b7:	75 2a                	jne    8000e3 <_gettoken+0xb0>
+		if (debug > 1)
+			cprintf("EOL\n");
+		return 0;
+  8000b9:	be 00 00 00 00       	mov    $0x0,%esi
+		if (debug > 1)
+  8000be:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  8000c5:	7f 0a                	jg     8000d1 <_gettoken+0x9e>
+		**p2 = 0;
+		cprintf("WORD: %s\n", *p1);
+		**p2 = t;
+	}
+	return 'w';
+}
+  8000c7:	89 f0                	mov    %esi,%eax
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+			cprintf("EOL\n");
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	68 22 47 80 00       	push   $0x804722
+  8000d9:	e8 95 0b 00 00       	call   800c73 <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	eb e4                	jmp    8000c7 <_gettoken+0x94>
+	if (strchr(SYMBOLS, *s)) {
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	0f be c0             	movsbl %al,%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	68 33 47 80 00       	push   $0x804733
+  8000ef:	e8 c9 13 00 00       	call   8014bd <strchr>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	74 2c                	je     800127 <_gettoken+0xf4>
+		t = *s;
+  8000fb:	0f be 33             	movsbl (%ebx),%esi
+		*p1 = s;
+  8000fe:	89 1f                	mov    %ebx,(%edi)
+		*s++ = 0;
+  800100:	c6 03 00             	movb   $0x0,(%ebx)
+  800103:	83 c3 01             	add    $0x1,%ebx
+  800106:	8b 45 10             	mov    0x10(%ebp),%eax
+  800109:	89 18                	mov    %ebx,(%eax)
+		if (debug > 1)
+  80010b:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  800112:	7e b3                	jle    8000c7 <_gettoken+0x94>
+			cprintf("TOK %c\n", t);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	68 27 47 80 00       	push   $0x804727
+  80011d:	e8 51 0b 00 00       	call   800c73 <cprintf>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb a0                	jmp    8000c7 <_gettoken+0x94>
+	*p1 = s;
+  800127:	89 1f                	mov    %ebx,(%edi)
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800129:	eb 03                	jmp    80012e <_gettoken+0xfb>
+		s++;
+  80012b:	83 c3 01             	add    $0x1,%ebx
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80012e:	0f b6 03             	movzbl (%ebx),%eax
+  800131:	84 c0                	test   %al,%al
+  800133:	74 18                	je     80014d <_gettoken+0x11a>
+  800135:	83 ec 08             	sub    $0x8,%esp
+  800138:	0f be c0             	movsbl %al,%eax
+  80013b:	50                   	push   %eax
+  80013c:	68 2f 47 80 00       	push   $0x80472f
+  800141:	e8 77 13 00 00       	call   8014bd <strchr>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	74 de                	je     80012b <_gettoken+0xf8>
+	*p2 = s;
+  80014d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800150:	89 18                	mov    %ebx,(%eax)
+	return 'w';
+  800152:	be 77 00 00 00       	mov    $0x77,%esi
+	if (debug > 1) {
+  800157:	83 3d 00 60 80 00 01 	cmpl   $0x1,0x806000
+  80015e:	0f 8e 63 ff ff ff    	jle    8000c7 <_gettoken+0x94>
+		t = **p2;
+  800164:	0f b6 33             	movzbl (%ebx),%esi
+		**p2 = 0;
+  800167:	c6 03 00             	movb   $0x0,(%ebx)
+		cprintf("WORD: %s\n", *p1);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	ff 37                	push   (%edi)
+  80016f:	68 3b 47 80 00       	push   $0x80473b
+  800174:	e8 fa 0a 00 00       	call   800c73 <cprintf>
+		**p2 = t;
+  800179:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017c:	8b 00                	mov    (%eax),%eax
+  80017e:	89 f2                	mov    %esi,%edx
+  800180:	88 10                	mov    %dl,(%eax)
+  800182:	83 c4 10             	add    $0x10,%esp
+	return 'w';
+  800185:	be 77 00 00 00       	mov    $0x77,%esi
+  80018a:	e9 38 ff ff ff       	jmp    8000c7 <_gettoken+0x94>
+
+0080018f <gettoken>:
+
+int
+gettoken(char *s, char **p1)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	83 ec 08             	sub    $0x8,%esp
+  800195:	8b 45 08             	mov    0x8(%ebp),%eax
+	static int c, nc;
+	static char* np1, *np2;
+
+	if (s) {
+  800198:	85 c0                	test   %eax,%eax
+  80019a:	74 22                	je     8001be <gettoken+0x2f>
+		nc = _gettoken(s, &np1, &np2);
+  80019c:	83 ec 04             	sub    $0x4,%esp
+  80019f:	68 0c 60 80 00       	push   $0x80600c
+  8001a4:	68 10 60 80 00       	push   $0x806010
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 84 fe ff ff       	call   800033 <_gettoken>
+  8001af:	a3 08 60 80 00       	mov    %eax,0x806008
+		return 0;
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	c = nc;
+	*p1 = np1;
+	nc = _gettoken(np2, &np1, &np2);
+	return c;
+}
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+	c = nc;
+  8001be:	a1 08 60 80 00       	mov    0x806008,%eax
+  8001c3:	a3 04 60 80 00       	mov    %eax,0x806004
+	*p1 = np1;
+  8001c8:	8b 15 10 60 80 00    	mov    0x806010,%edx
+  8001ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d1:	89 10                	mov    %edx,(%eax)
+	nc = _gettoken(np2, &np1, &np2);
+  8001d3:	83 ec 04             	sub    $0x4,%esp
+  8001d6:	68 0c 60 80 00       	push   $0x80600c
+  8001db:	68 10 60 80 00       	push   $0x806010
+  8001e0:	ff 35 0c 60 80 00    	push   0x80600c
+  8001e6:	e8 48 fe ff ff       	call   800033 <_gettoken>
+  8001eb:	a3 08 60 80 00       	mov    %eax,0x806008
+	return c;
+  8001f0:	a1 04 60 80 00       	mov    0x806004,%eax
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	eb c2                	jmp    8001bc <gettoken+0x2d>
+
+008001fa <runcmd>:
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	81 ec 74 04 00 00    	sub    $0x474,%esp
+	gettoken(s, 0);
+  800206:	6a 00                	push   $0x0
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	e8 7f ff ff ff       	call   80018f <gettoken>
+  800210:	83 c4 10             	add    $0x10,%esp
+		switch ((c = gettoken(0, &t))) {
+  800213:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	argc = 0;
+  800216:	bb 00 00 00 00       	mov    $0x0,%ebx
+		switch ((c = gettoken(0, &t))) {
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	56                   	push   %esi
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 69 ff ff ff       	call   80018f <gettoken>
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	83 f8 3e             	cmp    $0x3e,%eax
+  80022e:	0f 84 3f 01 00 00    	je     800373 <runcmd+0x179>
+  800234:	7f 53                	jg     800289 <runcmd+0x8f>
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 84 36 02 00 00    	je     800474 <runcmd+0x27a>
+  80023e:	83 f8 3c             	cmp    $0x3c,%eax
+  800241:	0f 85 cc 02 00 00    	jne    800513 <runcmd+0x319>
+			if (gettoken(0, &t) != 'w') {
+  800247:	83 ec 08             	sub    $0x8,%esp
+  80024a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	6a 00                	push   $0x0
+  800250:	e8 3a ff ff ff       	call   80018f <gettoken>
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	83 f8 77             	cmp    $0x77,%eax
+  80025b:	0f 85 c1 00 00 00    	jne    800322 <runcmd+0x128>
+			if ((fd = open(t, O_RDONLY)) < 0) {
+  800261:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800264:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  80026a:	83 ec 08             	sub    $0x8,%esp
+  80026d:	6a 00                	push   $0x0
+  80026f:	50                   	push   %eax
+  800270:	e8 c1 30 00 00       	call   803336 <open>
+  800275:	89 c7                	mov    %eax,%edi
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 ba 00 00 00    	js     80033c <runcmd+0x142>
+			if (fd != 0) {
+  800282:	74 97                	je     80021b <runcmd+0x21>
+  800284:	e9 cf 00 00 00       	jmp    800358 <runcmd+0x15e>
+		switch ((c = gettoken(0, &t))) {
+  800289:	83 f8 77             	cmp    $0x77,%eax
+  80028c:	74 69                	je     8002f7 <runcmd+0xfd>
+  80028e:	83 f8 7c             	cmp    $0x7c,%eax
+  800291:	0f 85 7c 02 00 00    	jne    800513 <runcmd+0x319>
+			if ((r = pipe(p)) < 0) {
+  800297:	83 ec 0c             	sub    $0xc,%esp
+  80029a:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  8002a0:	50                   	push   %eax
+  8002a1:	e8 30 40 00 00       	call   8042d6 <pipe>
+  8002a6:	83 c4 10             	add    $0x10,%esp
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	0f 88 51 01 00 00    	js     800402 <runcmd+0x208>
+			if (debug)
+  8002b1:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8002b8:	0f 85 5f 01 00 00    	jne    80041d <runcmd+0x223>
+			if ((r = fork()) < 0) {
+  8002be:	e8 cb 24 00 00       	call   80278e <fork>
+  8002c3:	89 c7                	mov    %eax,%edi
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	0f 88 71 01 00 00    	js     80043e <runcmd+0x244>
+			if (r == 0) {
+  8002cd:	0f 85 81 01 00 00    	jne    800454 <runcmd+0x25a>
+				if (p[0] != 0) {
+  8002d3:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	0f 85 f0 01 00 00    	jne    8004d1 <runcmd+0x2d7>
+				close(p[1]);
+  8002e1:	83 ec 0c             	sub    $0xc,%esp
+  8002e4:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8002ea:	e8 48 2a 00 00       	call   802d37 <close>
+				goto again;
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	e9 1f ff ff ff       	jmp    800216 <runcmd+0x1c>
+			if (argc == MAXARGS) {
+  8002f7:	83 fb 10             	cmp    $0x10,%ebx
+  8002fa:	74 0f                	je     80030b <runcmd+0x111>
+			argv[argc++] = t;
+  8002fc:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8002ff:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  800303:	8d 5b 01             	lea    0x1(%ebx),%ebx
+			break;
+  800306:	e9 10 ff ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("too many arguments\n");
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  80030e:	68 45 47 80 00       	push   $0x804745
+  800313:	e8 5b 09 00 00       	call   800c73 <cprintf>
+				exit();
+  800318:	e8 61 08 00 00       	call   800b7e <exit>
+  80031d:	83 c4 10             	add    $0x10,%esp
+  800320:	eb da                	jmp    8002fc <runcmd+0x102>
+				cprintf("syntax error: < not followed by word\n");
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	68 7c 48 80 00       	push   $0x80487c
+  80032a:	e8 44 09 00 00       	call   800c73 <cprintf>
+				exit();
+  80032f:	e8 4a 08 00 00       	call   800b7e <exit>
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	e9 25 ff ff ff       	jmp    800261 <runcmd+0x67>
+				cprintf("open %s for write: %e", t, fd);
+  80033c:	83 ec 04             	sub    $0x4,%esp
+  80033f:	50                   	push   %eax
+  800340:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  800346:	68 59 47 80 00       	push   $0x804759
+  80034b:	e8 23 09 00 00       	call   800c73 <cprintf>
+				exit();
+  800350:	e8 29 08 00 00       	call   800b7e <exit>
+  800355:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 0);
+  800358:	83 ec 08             	sub    $0x8,%esp
+  80035b:	6a 00                	push   $0x0
+  80035d:	57                   	push   %edi
+  80035e:	e8 26 2a 00 00       	call   802d89 <dup>
+				close(fd);
+  800363:	89 3c 24             	mov    %edi,(%esp)
+  800366:	e8 cc 29 00 00       	call   802d37 <close>
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	e9 a8 fe ff ff       	jmp    80021b <runcmd+0x21>
+			if (gettoken(0, &t) != 'w') {
+  800373:	83 ec 08             	sub    $0x8,%esp
+  800376:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  800379:	50                   	push   %eax
+  80037a:	6a 00                	push   $0x0
+  80037c:	e8 0e fe ff ff       	call   80018f <gettoken>
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	83 f8 77             	cmp    $0x77,%eax
+  800387:	75 2b                	jne    8003b4 <runcmd+0x1ba>
+			if ((fd = open(t, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  800389:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  80038c:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  800392:	83 ec 08             	sub    $0x8,%esp
+  800395:	68 01 03 00 00       	push   $0x301
+  80039a:	50                   	push   %eax
+  80039b:	e8 96 2f 00 00       	call   803336 <open>
+  8003a0:	89 c7                	mov    %eax,%edi
+  8003a2:	83 c4 10             	add    $0x10,%esp
+  8003a5:	85 c0                	test   %eax,%eax
+  8003a7:	78 22                	js     8003cb <runcmd+0x1d1>
+			if (fd != 1) {
+  8003a9:	83 f8 01             	cmp    $0x1,%eax
+  8003ac:	0f 84 69 fe ff ff    	je     80021b <runcmd+0x21>
+  8003b2:	eb 33                	jmp    8003e7 <runcmd+0x1ed>
+				cprintf("syntax error: > not followed by word\n");
+  8003b4:	83 ec 0c             	sub    $0xc,%esp
+  8003b7:	68 a4 48 80 00       	push   $0x8048a4
+  8003bc:	e8 b2 08 00 00       	call   800c73 <cprintf>
+				exit();
+  8003c1:	e8 b8 07 00 00       	call   800b7e <exit>
+  8003c6:	83 c4 10             	add    $0x10,%esp
+  8003c9:	eb be                	jmp    800389 <runcmd+0x18f>
+				cprintf("open %s for write: %e", t, fd);
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	50                   	push   %eax
+  8003cf:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  8003d5:	68 59 47 80 00       	push   $0x804759
+  8003da:	e8 94 08 00 00       	call   800c73 <cprintf>
+				exit();
+  8003df:	e8 9a 07 00 00       	call   800b7e <exit>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+				dup(fd, 1);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	6a 01                	push   $0x1
+  8003ec:	57                   	push   %edi
+  8003ed:	e8 97 29 00 00       	call   802d89 <dup>
+				close(fd);
+  8003f2:	89 3c 24             	mov    %edi,(%esp)
+  8003f5:	e8 3d 29 00 00       	call   802d37 <close>
+  8003fa:	83 c4 10             	add    $0x10,%esp
+  8003fd:	e9 19 fe ff ff       	jmp    80021b <runcmd+0x21>
+				cprintf("pipe: %e", r);
+  800402:	83 ec 08             	sub    $0x8,%esp
+  800405:	50                   	push   %eax
+  800406:	68 6f 47 80 00       	push   $0x80476f
+  80040b:	e8 63 08 00 00       	call   800c73 <cprintf>
+				exit();
+  800410:	e8 69 07 00 00       	call   800b7e <exit>
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	e9 94 fe ff ff       	jmp    8002b1 <runcmd+0xb7>
+				cprintf("PIPE: %d %d\n", p[0], p[1]);
+  80041d:	83 ec 04             	sub    $0x4,%esp
+  800420:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800426:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80042c:	68 78 47 80 00       	push   $0x804778
+  800431:	e8 3d 08 00 00       	call   800c73 <cprintf>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	e9 80 fe ff ff       	jmp    8002be <runcmd+0xc4>
+				cprintf("fork: %e", r);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	50                   	push   %eax
+  800442:	68 6b 4d 80 00       	push   $0x804d6b
+  800447:	e8 27 08 00 00       	call   800c73 <cprintf>
+				exit();
+  80044c:	e8 2d 07 00 00       	call   800b7e <exit>
+  800451:	83 c4 10             	add    $0x10,%esp
+				if (p[1] != 1) {
+  800454:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  80045a:	83 f8 01             	cmp    $0x1,%eax
+  80045d:	0f 85 8f 00 00 00    	jne    8004f2 <runcmd+0x2f8>
+				close(p[0]);
+  800463:	83 ec 0c             	sub    $0xc,%esp
+  800466:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80046c:	e8 c6 28 00 00       	call   802d37 <close>
+				goto runit;
+  800471:	83 c4 10             	add    $0x10,%esp
+	if(argc == 0) {
+  800474:	85 db                	test   %ebx,%ebx
+  800476:	0f 84 a9 00 00 00    	je     800525 <runcmd+0x32b>
+	if (argv[0][0] != '/') {
+  80047c:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  80047f:	80 38 2f             	cmpb   $0x2f,(%eax)
+  800482:	0f 85 bf 00 00 00    	jne    800547 <runcmd+0x34d>
+	argv[argc] = 0;
+  800488:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  80048f:	00 
+	if (debug) {
+  800490:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800497:	0f 84 11 01 00 00    	je     8005ae <runcmd+0x3b4>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80049d:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80049f:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8004a4:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8004aa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8004af:	0f 86 ba 00 00 00    	jbe    80056f <runcmd+0x375>
+		cprintf("[%08x] SPAWN:", thisenv->env_id);
+  8004b5:	8b 42 48             	mov    0x48(%edx),%eax
+  8004b8:	83 ec 08             	sub    $0x8,%esp
+  8004bb:	50                   	push   %eax
+  8004bc:	68 ba 47 80 00       	push   $0x8047ba
+  8004c1:	e8 ad 07 00 00       	call   800c73 <cprintf>
+		for (i = 0; argv[i]; i++)
+  8004c6:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  8004c9:	83 c4 10             	add    $0x10,%esp
+  8004cc:	e9 c3 00 00 00       	jmp    800594 <runcmd+0x39a>
+					dup(p[0], 0);
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	6a 00                	push   $0x0
+  8004d6:	50                   	push   %eax
+  8004d7:	e8 ad 28 00 00       	call   802d89 <dup>
+					close(p[0]);
+  8004dc:	83 c4 04             	add    $0x4,%esp
+  8004df:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  8004e5:	e8 4d 28 00 00       	call   802d37 <close>
+  8004ea:	83 c4 10             	add    $0x10,%esp
+  8004ed:	e9 ef fd ff ff       	jmp    8002e1 <runcmd+0xe7>
+					dup(p[1], 1);
+  8004f2:	83 ec 08             	sub    $0x8,%esp
+  8004f5:	6a 01                	push   $0x1
+  8004f7:	50                   	push   %eax
+  8004f8:	e8 8c 28 00 00       	call   802d89 <dup>
+					close(p[1]);
+  8004fd:	83 c4 04             	add    $0x4,%esp
+  800500:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800506:	e8 2c 28 00 00       	call   802d37 <close>
+  80050b:	83 c4 10             	add    $0x10,%esp
+  80050e:	e9 50 ff ff ff       	jmp    800463 <runcmd+0x269>
+			panic("bad return %d from gettoken", c);
+  800513:	57                   	push   %edi
+  800514:	68 85 47 80 00       	push   $0x804785
+  800519:	6a 77                	push   $0x77
+  80051b:	68 a1 47 80 00       	push   $0x8047a1
+  800520:	e8 73 06 00 00       	call   800b98 <_panic>
+		if (debug)
+  800525:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80052c:	0f 84 86 01 00 00    	je     8006b8 <runcmd+0x4be>
+			cprintf("EMPTY COMMAND\n");
+  800532:	83 ec 0c             	sub    $0xc,%esp
+  800535:	68 ab 47 80 00       	push   $0x8047ab
+  80053a:	e8 34 07 00 00       	call   800c73 <cprintf>
+  80053f:	83 c4 10             	add    $0x10,%esp
+		return;
+  800542:	e9 71 01 00 00       	jmp    8006b8 <runcmd+0x4be>
+		argv0buf[0] = '/';
+  800547:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+		strcpy(argv0buf + 1, argv[0]);
+  80054e:	83 ec 08             	sub    $0x8,%esp
+  800551:	50                   	push   %eax
+  800552:	8d b5 a4 fb ff ff    	lea    -0x45c(%ebp),%esi
+  800558:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  80055e:	50                   	push   %eax
+  80055f:	e8 47 0e 00 00       	call   8013ab <strcpy>
+		argv[0] = argv0buf;
+  800564:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  800567:	83 c4 10             	add    $0x10,%esp
+  80056a:	e9 19 ff ff ff       	jmp    800488 <runcmd+0x28e>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80056f:	c1 e8 10             	shr    $0x10,%eax
+  800572:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800578:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80057e:	e9 32 ff ff ff       	jmp    8004b5 <runcmd+0x2bb>
+			cprintf(" %s", argv[i]);
+  800583:	83 ec 08             	sub    $0x8,%esp
+  800586:	50                   	push   %eax
+  800587:	68 42 48 80 00       	push   $0x804842
+  80058c:	e8 e2 06 00 00       	call   800c73 <cprintf>
+  800591:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; argv[i]; i++)
+  800594:	83 c3 04             	add    $0x4,%ebx
+  800597:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  80059a:	85 c0                	test   %eax,%eax
+  80059c:	75 e5                	jne    800583 <runcmd+0x389>
+		cprintf("\n");
+  80059e:	83 ec 0c             	sub    $0xc,%esp
+  8005a1:	68 20 47 80 00       	push   $0x804720
+  8005a6:	e8 c8 06 00 00       	call   800c73 <cprintf>
+  8005ab:	83 c4 10             	add    $0x10,%esp
+	if ((r = spawn(argv[0], (const char**) argv)) < 0)
+  8005ae:	83 ec 08             	sub    $0x8,%esp
+  8005b1:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8005b4:	50                   	push   %eax
+  8005b5:	ff 75 a8             	push   -0x58(%ebp)
+  8005b8:	e8 32 2f 00 00       	call   8034ef <spawn>
+  8005bd:	89 c3                	mov    %eax,%ebx
+  8005bf:	83 c4 10             	add    $0x10,%esp
+  8005c2:	85 c0                	test   %eax,%eax
+  8005c4:	78 59                	js     80061f <runcmd+0x425>
+	close_all();
+  8005c6:	e8 99 27 00 00       	call   802d64 <close_all>
+		if (debug)
+  8005cb:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8005d2:	0f 85 e8 00 00 00    	jne    8006c0 <runcmd+0x4c6>
+		wait(r);
+  8005d8:	83 ec 0c             	sub    $0xc,%esp
+  8005db:	53                   	push   %ebx
+  8005dc:	e8 72 3e 00 00       	call   804453 <wait>
+		if (debug)
+  8005e1:	83 c4 10             	add    $0x10,%esp
+  8005e4:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  8005eb:	0f 84 4b 01 00 00    	je     80073c <runcmd+0x542>
+  8005f1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8005f3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8005f8:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8005fe:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800603:	0f 86 f7 00 00 00    	jbe    800700 <runcmd+0x506>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  800609:	8b 42 48             	mov    0x48(%edx),%eax
+  80060c:	83 ec 08             	sub    $0x8,%esp
+  80060f:	50                   	push   %eax
+  800610:	68 eb 47 80 00       	push   $0x8047eb
+  800615:	e8 59 06 00 00       	call   800c73 <cprintf>
+  80061a:	83 c4 10             	add    $0x10,%esp
+  80061d:	eb 19                	jmp    800638 <runcmd+0x43e>
+		cprintf("spawn %s: %e\n", argv[0], r);
+  80061f:	83 ec 04             	sub    $0x4,%esp
+  800622:	50                   	push   %eax
+  800623:	ff 75 a8             	push   -0x58(%ebp)
+  800626:	68 c8 47 80 00       	push   $0x8047c8
+  80062b:	e8 43 06 00 00       	call   800c73 <cprintf>
+	close_all();
+  800630:	e8 2f 27 00 00       	call   802d64 <close_all>
+	if (r >= 0) {
+  800635:	83 c4 10             	add    $0x10,%esp
+	if (pipe_child) {
+  800638:	85 ff                	test   %edi,%edi
+  80063a:	74 77                	je     8006b3 <runcmd+0x4b9>
+		if (debug)
+  80063c:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800643:	74 2d                	je     800672 <runcmd+0x478>
+  800645:	89 e0                	mov    %esp,%eax
+  800647:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80064c:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800652:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800657:	0f 86 b7 00 00 00    	jbe    800714 <runcmd+0x51a>
+			cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  80065d:	8b 42 48             	mov    0x48(%edx),%eax
+  800660:	83 ec 04             	sub    $0x4,%esp
+  800663:	57                   	push   %edi
+  800664:	50                   	push   %eax
+  800665:	68 01 48 80 00       	push   $0x804801
+  80066a:	e8 04 06 00 00       	call   800c73 <cprintf>
+  80066f:	83 c4 10             	add    $0x10,%esp
+		wait(pipe_child);
+  800672:	83 ec 0c             	sub    $0xc,%esp
+  800675:	57                   	push   %edi
+  800676:	e8 d8 3d 00 00       	call   804453 <wait>
+		if (debug)
+  80067b:	83 c4 10             	add    $0x10,%esp
+  80067e:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800685:	74 2c                	je     8006b3 <runcmd+0x4b9>
+  800687:	89 e0                	mov    %esp,%eax
+  800689:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80068e:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800694:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800699:	0f 86 89 00 00 00    	jbe    800728 <runcmd+0x52e>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  80069f:	8b 42 48             	mov    0x48(%edx),%eax
+  8006a2:	83 ec 08             	sub    $0x8,%esp
+  8006a5:	50                   	push   %eax
+  8006a6:	68 eb 47 80 00       	push   $0x8047eb
+  8006ab:	e8 c3 05 00 00       	call   800c73 <cprintf>
+  8006b0:	83 c4 10             	add    $0x10,%esp
+	exit();
+  8006b3:	e8 c6 04 00 00       	call   800b7e <exit>
+}
+  8006b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006bb:	5b                   	pop    %ebx
+  8006bc:	5e                   	pop    %esi
+  8006bd:	5f                   	pop    %edi
+  8006be:	5d                   	pop    %ebp
+  8006bf:	c3                   	ret
+			cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  8006c0:	8b 55 a8             	mov    -0x58(%ebp),%edx
+  8006c3:	89 e0                	mov    %esp,%eax
+  8006c5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8006ca:	8b 0d 28 64 80 00    	mov    0x806428,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8006d0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8006d5:	76 18                	jbe    8006ef <runcmd+0x4f5>
+  8006d7:	8b 41 48             	mov    0x48(%ecx),%eax
+  8006da:	53                   	push   %ebx
+  8006db:	52                   	push   %edx
+  8006dc:	50                   	push   %eax
+  8006dd:	68 d6 47 80 00       	push   $0x8047d6
+  8006e2:	e8 8c 05 00 00       	call   800c73 <cprintf>
+  8006e7:	83 c4 10             	add    $0x10,%esp
+  8006ea:	e9 e9 fe ff ff       	jmp    8005d8 <runcmd+0x3de>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8006ef:	c1 e8 10             	shr    $0x10,%eax
+  8006f2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8006f8:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8006fe:	eb d7                	jmp    8006d7 <runcmd+0x4dd>
+  800700:	c1 e8 10             	shr    $0x10,%eax
+  800703:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800709:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80070f:	e9 f5 fe ff ff       	jmp    800609 <runcmd+0x40f>
+  800714:	c1 e8 10             	shr    $0x10,%eax
+  800717:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80071d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800723:	e9 35 ff ff ff       	jmp    80065d <runcmd+0x463>
+  800728:	c1 e8 10             	shr    $0x10,%eax
+  80072b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800731:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800737:	e9 63 ff ff ff       	jmp    80069f <runcmd+0x4a5>
+	if (pipe_child) {
+  80073c:	85 ff                	test   %edi,%edi
+  80073e:	0f 85 2e ff ff ff    	jne    800672 <runcmd+0x478>
+  800744:	e9 6a ff ff ff       	jmp    8006b3 <runcmd+0x4b9>
+
+00800749 <usage>:
+
+
+void
+usage(void)
+{
+  800749:	55                   	push   %ebp
+  80074a:	89 e5                	mov    %esp,%ebp
+  80074c:	83 ec 14             	sub    $0x14,%esp
+	cprintf("usage: sh [-dix] [command-file]\n");
+  80074f:	68 cc 48 80 00       	push   $0x8048cc
+  800754:	e8 1a 05 00 00       	call   800c73 <cprintf>
+	exit();
+  800759:	e8 20 04 00 00       	call   800b7e <exit>
+}
+  80075e:	83 c4 10             	add    $0x10,%esp
+  800761:	c9                   	leave
+  800762:	c3                   	ret
+
+00800763 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800763:	55                   	push   %ebp
+  800764:	89 e5                	mov    %esp,%ebp
+  800766:	57                   	push   %edi
+  800767:	56                   	push   %esi
+  800768:	53                   	push   %ebx
+  800769:	83 ec 30             	sub    $0x30,%esp
+	int r, interactive, echocmds;
+	struct Argstate args;
+
+	interactive = '?';
+	echocmds = 0;
+	argstart(&argc, argv, &args);
+  80076c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  80076f:	50                   	push   %eax
+  800770:	ff 75 0c             	push   0xc(%ebp)
+  800773:	8d 45 08             	lea    0x8(%ebp),%eax
+  800776:	50                   	push   %eax
+  800777:	e8 a5 22 00 00       	call   802a21 <argstart>
+	while ((r = argnext(&args)) >= 0)
+  80077c:	83 c4 10             	add    $0x10,%esp
+	echocmds = 0;
+  80077f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	interactive = '?';
+  800786:	bf 3f 00 00 00       	mov    $0x3f,%edi
+	while ((r = argnext(&args)) >= 0)
+  80078b:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+		switch (r) {
+		case 'd':
+			debug++;
+			break;
+		case 'i':
+			interactive = 1;
+  80078e:	be 01 00 00 00       	mov    $0x1,%esi
+	while ((r = argnext(&args)) >= 0)
+  800793:	eb 10                	jmp    8007a5 <umain+0x42>
+			debug++;
+  800795:	83 05 00 60 80 00 01 	addl   $0x1,0x806000
+			break;
+  80079c:	eb 07                	jmp    8007a5 <umain+0x42>
+			interactive = 1;
+  80079e:	89 f7                	mov    %esi,%edi
+  8007a0:	eb 03                	jmp    8007a5 <umain+0x42>
+		switch (r) {
+  8007a2:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	while ((r = argnext(&args)) >= 0)
+  8007a5:	83 ec 0c             	sub    $0xc,%esp
+  8007a8:	53                   	push   %ebx
+  8007a9:	e8 a3 22 00 00       	call   802a51 <argnext>
+  8007ae:	83 c4 10             	add    $0x10,%esp
+  8007b1:	85 c0                	test   %eax,%eax
+  8007b3:	78 16                	js     8007cb <umain+0x68>
+		switch (r) {
+  8007b5:	83 f8 69             	cmp    $0x69,%eax
+  8007b8:	74 e4                	je     80079e <umain+0x3b>
+  8007ba:	83 f8 78             	cmp    $0x78,%eax
+  8007bd:	74 e3                	je     8007a2 <umain+0x3f>
+  8007bf:	83 f8 64             	cmp    $0x64,%eax
+  8007c2:	74 d1                	je     800795 <umain+0x32>
+			break;
+		case 'x':
+			echocmds = 1;
+			break;
+		default:
+			usage();
+  8007c4:	e8 80 ff ff ff       	call   800749 <usage>
+  8007c9:	eb da                	jmp    8007a5 <umain+0x42>
+		}
+
+	if (argc > 2)
+  8007cb:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8007cf:	7f 1f                	jg     8007f0 <umain+0x8d>
+		usage();
+	if (argc == 2) {
+  8007d1:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8007d5:	74 20                	je     8007f7 <umain+0x94>
+		close(0);
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+			panic("open %s: %e", argv[1], r);
+		assert(r == 0);
+	}
+	if (interactive == '?')
+  8007d7:	83 ff 3f             	cmp    $0x3f,%edi
+  8007da:	74 75                	je     800851 <umain+0xee>
+  8007dc:	85 ff                	test   %edi,%edi
+  8007de:	bf 46 48 80 00       	mov    $0x804846,%edi
+  8007e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e8:	0f 44 f8             	cmove  %eax,%edi
+  8007eb:	e9 06 01 00 00       	jmp    8008f6 <umain+0x193>
+		usage();
+  8007f0:	e8 54 ff ff ff       	call   800749 <usage>
+  8007f5:	eb da                	jmp    8007d1 <umain+0x6e>
+		close(0);
+  8007f7:	83 ec 0c             	sub    $0xc,%esp
+  8007fa:	6a 00                	push   $0x0
+  8007fc:	e8 36 25 00 00       	call   802d37 <close>
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+  800801:	83 c4 08             	add    $0x8,%esp
+  800804:	6a 00                	push   $0x0
+  800806:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800809:	ff 70 04             	push   0x4(%eax)
+  80080c:	e8 25 2b 00 00       	call   803336 <open>
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	85 c0                	test   %eax,%eax
+  800816:	78 1b                	js     800833 <umain+0xd0>
+		assert(r == 0);
+  800818:	74 bd                	je     8007d7 <umain+0x74>
+  80081a:	68 2a 48 80 00       	push   $0x80482a
+  80081f:	68 31 48 80 00       	push   $0x804831
+  800824:	68 28 01 00 00       	push   $0x128
+  800829:	68 a1 47 80 00       	push   $0x8047a1
+  80082e:	e8 65 03 00 00       	call   800b98 <_panic>
+			panic("open %s: %e", argv[1], r);
+  800833:	83 ec 0c             	sub    $0xc,%esp
+  800836:	50                   	push   %eax
+  800837:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80083a:	ff 70 04             	push   0x4(%eax)
+  80083d:	68 1e 48 80 00       	push   $0x80481e
+  800842:	68 27 01 00 00       	push   $0x127
+  800847:	68 a1 47 80 00       	push   $0x8047a1
+  80084c:	e8 47 03 00 00       	call   800b98 <_panic>
+		interactive = iscons(0);
+  800851:	83 ec 0c             	sub    $0xc,%esp
+  800854:	6a 00                	push   $0x0
+  800856:	e8 fb 01 00 00       	call   800a56 <iscons>
+  80085b:	89 c7                	mov    %eax,%edi
+  80085d:	83 c4 10             	add    $0x10,%esp
+  800860:	e9 77 ff ff ff       	jmp    8007dc <umain+0x79>
+	while (1) {
+		char *buf;
+
+		buf = readline(interactive ? "$ " : NULL);
+		if (buf == NULL) {
+			if (debug)
+  800865:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80086c:	75 0a                	jne    800878 <umain+0x115>
+				cprintf("EXITING\n");
+			exit();	// end of file
+  80086e:	e8 0b 03 00 00       	call   800b7e <exit>
+  800873:	e9 94 00 00 00       	jmp    80090c <umain+0x1a9>
+				cprintf("EXITING\n");
+  800878:	83 ec 0c             	sub    $0xc,%esp
+  80087b:	68 49 48 80 00       	push   $0x804849
+  800880:	e8 ee 03 00 00       	call   800c73 <cprintf>
+  800885:	83 c4 10             	add    $0x10,%esp
+  800888:	eb e4                	jmp    80086e <umain+0x10b>
+		}
+		if (debug)
+			cprintf("LINE: %s\n", buf);
+  80088a:	83 ec 08             	sub    $0x8,%esp
+  80088d:	53                   	push   %ebx
+  80088e:	68 52 48 80 00       	push   $0x804852
+  800893:	e8 db 03 00 00       	call   800c73 <cprintf>
+  800898:	83 c4 10             	add    $0x10,%esp
+  80089b:	eb 7c                	jmp    800919 <umain+0x1b6>
+		if (buf[0] == '#')
+			continue;
+		if (echocmds)
+			printf("# %s\n", buf);
+  80089d:	83 ec 08             	sub    $0x8,%esp
+  8008a0:	53                   	push   %ebx
+  8008a1:	68 5c 48 80 00       	push   $0x80485c
+  8008a6:	e8 2e 2c 00 00       	call   8034d9 <printf>
+  8008ab:	83 c4 10             	add    $0x10,%esp
+  8008ae:	eb 78                	jmp    800928 <umain+0x1c5>
+		if (debug)
+			cprintf("BEFORE FORK\n");
+  8008b0:	83 ec 0c             	sub    $0xc,%esp
+  8008b3:	68 62 48 80 00       	push   $0x804862
+  8008b8:	e8 b6 03 00 00       	call   800c73 <cprintf>
+  8008bd:	83 c4 10             	add    $0x10,%esp
+  8008c0:	eb 73                	jmp    800935 <umain+0x1d2>
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+  8008c2:	50                   	push   %eax
+  8008c3:	68 6b 4d 80 00       	push   $0x804d6b
+  8008c8:	68 3f 01 00 00       	push   $0x13f
+  8008cd:	68 a1 47 80 00       	push   $0x8047a1
+  8008d2:	e8 c1 02 00 00       	call   800b98 <_panic>
+		if (debug)
+			cprintf("FORK: %d\n", r);
+  8008d7:	83 ec 08             	sub    $0x8,%esp
+  8008da:	50                   	push   %eax
+  8008db:	68 6f 48 80 00       	push   $0x80486f
+  8008e0:	e8 8e 03 00 00       	call   800c73 <cprintf>
+  8008e5:	83 c4 10             	add    $0x10,%esp
+  8008e8:	eb 5f                	jmp    800949 <umain+0x1e6>
+		if (r == 0) {
+			runcmd(buf);
+			exit();
+		} else
+			wait(r);
+  8008ea:	83 ec 0c             	sub    $0xc,%esp
+  8008ed:	56                   	push   %esi
+  8008ee:	e8 60 3b 00 00       	call   804453 <wait>
+  8008f3:	83 c4 10             	add    $0x10,%esp
+		buf = readline(interactive ? "$ " : NULL);
+  8008f6:	83 ec 0c             	sub    $0xc,%esp
+  8008f9:	57                   	push   %edi
+  8008fa:	e8 81 09 00 00       	call   801280 <readline>
+  8008ff:	89 c3                	mov    %eax,%ebx
+		if (buf == NULL) {
+  800901:	83 c4 10             	add    $0x10,%esp
+  800904:	85 c0                	test   %eax,%eax
+  800906:	0f 84 59 ff ff ff    	je     800865 <umain+0x102>
+		if (debug)
+  80090c:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800913:	0f 85 71 ff ff ff    	jne    80088a <umain+0x127>
+		if (buf[0] == '#')
+  800919:	80 3b 23             	cmpb   $0x23,(%ebx)
+  80091c:	74 d8                	je     8008f6 <umain+0x193>
+		if (echocmds)
+  80091e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  800922:	0f 85 75 ff ff ff    	jne    80089d <umain+0x13a>
+		if (debug)
+  800928:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80092f:	0f 85 7b ff ff ff    	jne    8008b0 <umain+0x14d>
+		if ((r = fork()) < 0)
+  800935:	e8 54 1e 00 00       	call   80278e <fork>
+  80093a:	89 c6                	mov    %eax,%esi
+  80093c:	85 c0                	test   %eax,%eax
+  80093e:	78 82                	js     8008c2 <umain+0x15f>
+		if (debug)
+  800940:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800947:	75 8e                	jne    8008d7 <umain+0x174>
+		if (r == 0) {
+  800949:	85 f6                	test   %esi,%esi
+  80094b:	75 9d                	jne    8008ea <umain+0x187>
+			runcmd(buf);
+  80094d:	83 ec 0c             	sub    $0xc,%esp
+  800950:	53                   	push   %ebx
+  800951:	e8 a4 f8 ff ff       	call   8001fa <runcmd>
+			exit();
+  800956:	e8 23 02 00 00       	call   800b7e <exit>
+  80095b:	83 c4 10             	add    $0x10,%esp
+  80095e:	eb 96                	jmp    8008f6 <umain+0x193>
+
+00800960 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800960:	b8 00 00 00 00       	mov    $0x0,%eax
+  800965:	c3                   	ret
+
+00800966 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800966:	55                   	push   %ebp
+  800967:	89 e5                	mov    %esp,%ebp
+  800969:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80096c:	68 ed 48 80 00       	push   $0x8048ed
+  800971:	ff 75 0c             	push   0xc(%ebp)
+  800974:	e8 32 0a 00 00       	call   8013ab <strcpy>
+	return 0;
+}
+  800979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097e:	c9                   	leave
+  80097f:	c3                   	ret
+
+00800980 <devcons_write>:
+{
+  800980:	55                   	push   %ebp
+  800981:	89 e5                	mov    %esp,%ebp
+  800983:	57                   	push   %edi
+  800984:	56                   	push   %esi
+  800985:	53                   	push   %ebx
+  800986:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80098c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800991:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800997:	eb 2e                	jmp    8009c7 <devcons_write+0x47>
+		m = n - tot;
+  800999:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80099c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80099e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8009a3:	39 c3                	cmp    %eax,%ebx
+  8009a5:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8009a8:	83 ec 04             	sub    $0x4,%esp
+  8009ab:	53                   	push   %ebx
+  8009ac:	89 f0                	mov    %esi,%eax
+  8009ae:	03 45 0c             	add    0xc(%ebp),%eax
+  8009b1:	50                   	push   %eax
+  8009b2:	57                   	push   %edi
+  8009b3:	e8 79 0b 00 00       	call   801531 <memmove>
+		sys_cputs(buf, m);
+  8009b8:	83 c4 08             	add    $0x8,%esp
+  8009bb:	53                   	push   %ebx
+  8009bc:	57                   	push   %edi
+  8009bd:	e8 62 0d 00 00       	call   801724 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8009c2:	01 de                	add    %ebx,%esi
+  8009c4:	83 c4 10             	add    $0x10,%esp
+  8009c7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8009ca:	72 cd                	jb     800999 <devcons_write+0x19>
+}
+  8009cc:	89 f0                	mov    %esi,%eax
+  8009ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5f                   	pop    %edi
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+
+008009d6 <devcons_read>:
+{
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8009dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8009e5:	75 07                	jne    8009ee <devcons_read+0x18>
+  8009e7:	eb 1f                	jmp    800a08 <devcons_read+0x32>
+		sys_yield();
+  8009e9:	e8 6f 0e 00 00       	call   80185d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8009ee:	e8 75 0d 00 00       	call   801768 <sys_cgetc>
+  8009f3:	85 c0                	test   %eax,%eax
+  8009f5:	74 f2                	je     8009e9 <devcons_read+0x13>
+	if (c < 0)
+  8009f7:	78 0f                	js     800a08 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8009f9:	83 f8 04             	cmp    $0x4,%eax
+  8009fc:	74 0c                	je     800a0a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8009fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a01:	88 02                	mov    %al,(%edx)
+	return 1;
+  800a03:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800a08:	c9                   	leave
+  800a09:	c3                   	ret
+		return 0;
+  800a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0f:	eb f7                	jmp    800a08 <devcons_read+0x32>
+
+00800a11 <cputchar>:
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800a17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  800a1d:	6a 01                	push   $0x1
+  800a1f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800a22:	50                   	push   %eax
+  800a23:	e8 fc 0c 00 00       	call   801724 <sys_cputs>
+}
+  800a28:	83 c4 10             	add    $0x10,%esp
+  800a2b:	c9                   	leave
+  800a2c:	c3                   	ret
+
+00800a2d <getchar>:
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  800a33:	6a 01                	push   $0x1
+  800a35:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800a38:	50                   	push   %eax
+  800a39:	6a 00                	push   $0x0
+  800a3b:	e8 33 24 00 00       	call   802e73 <read>
+	if (r < 0)
+  800a40:	83 c4 10             	add    $0x10,%esp
+  800a43:	85 c0                	test   %eax,%eax
+  800a45:	78 06                	js     800a4d <getchar+0x20>
+	if (r < 1)
+  800a47:	74 06                	je     800a4f <getchar+0x22>
+	return c;
+  800a49:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800a4d:	c9                   	leave
+  800a4e:	c3                   	ret
+		return -E_EOF;
+  800a4f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800a54:	eb f7                	jmp    800a4d <getchar+0x20>
+
+00800a56 <iscons>:
+{
+  800a56:	55                   	push   %ebp
+  800a57:	89 e5                	mov    %esp,%ebp
+  800a59:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a5f:	50                   	push   %eax
+  800a60:	ff 75 08             	push   0x8(%ebp)
+  800a63:	e8 85 21 00 00       	call   802bed <fd_lookup>
+  800a68:	83 c4 10             	add    $0x10,%esp
+  800a6b:	85 c0                	test   %eax,%eax
+  800a6d:	78 11                	js     800a80 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800a6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a72:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800a78:	39 10                	cmp    %edx,(%eax)
+  800a7a:	0f 94 c0             	sete   %al
+  800a7d:	0f b6 c0             	movzbl %al,%eax
+}
+  800a80:	c9                   	leave
+  800a81:	c3                   	ret
+
+00800a82 <opencons>:
+{
+  800a82:	55                   	push   %ebp
+  800a83:	89 e5                	mov    %esp,%ebp
+  800a85:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800a88:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a8b:	50                   	push   %eax
+  800a8c:	e8 06 21 00 00       	call   802b97 <fd_alloc>
+  800a91:	83 c4 10             	add    $0x10,%esp
+  800a94:	85 c0                	test   %eax,%eax
+  800a96:	78 3a                	js     800ad2 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800a98:	83 ec 04             	sub    $0x4,%esp
+  800a9b:	68 07 04 00 00       	push   $0x407
+  800aa0:	ff 75 f4             	push   -0xc(%ebp)
+  800aa3:	6a 00                	push   $0x0
+  800aa5:	e8 f9 0d 00 00       	call   8018a3 <sys_page_alloc>
+  800aaa:	83 c4 10             	add    $0x10,%esp
+  800aad:	85 c0                	test   %eax,%eax
+  800aaf:	78 21                	js     800ad2 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800ab1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ab4:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800aba:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800abc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800abf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800ac6:	83 ec 0c             	sub    $0xc,%esp
+  800ac9:	50                   	push   %eax
+  800aca:	e8 a1 20 00 00       	call   802b70 <fd2num>
+  800acf:	83 c4 10             	add    $0x10,%esp
+}
+  800ad2:	c9                   	leave
+  800ad3:	c3                   	ret
+
+00800ad4 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	57                   	push   %edi
+  800ad8:	56                   	push   %esi
+  800ad9:	53                   	push   %ebx
+  800ada:	83 ec 0c             	sub    $0xc,%esp
+  800add:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ae0:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800ae3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ae8:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800aea:	c1 ea 0b             	shr    $0xb,%edx
+  800aed:	83 f2 01             	xor    $0x1,%edx
+  800af0:	83 e2 01             	and    $0x1,%edx
+  800af3:	88 15 2c 64 80 00    	mov    %dl,0x80642c
+
+	mainenv = NULL;
+  800af9:	c7 05 28 64 80 00 00 	movl   $0x0,0x806428
+  800b00:	00 00 00 
+	envid = sys_getenvid();
+  800b03:	e8 0f 0d 00 00       	call   801817 <sys_getenvid>
+  800b08:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800b0f:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800b15:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800b1b:	8b 52 48             	mov    0x48(%edx),%edx
+  800b1e:	39 ca                	cmp    %ecx,%edx
+  800b20:	74 27                	je     800b49 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800b22:	83 c0 01             	add    $0x1,%eax
+  800b25:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800b2a:	75 e3                	jne    800b0f <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800b2c:	83 3d 28 64 80 00 00 	cmpl   $0x0,0x806428
+  800b33:	75 24                	jne    800b59 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800b35:	83 ec 04             	sub    $0x4,%esp
+  800b38:	68 fc 48 80 00       	push   $0x8048fc
+  800b3d:	6a 23                	push   $0x23
+  800b3f:	68 1f 49 80 00       	push   $0x80491f
+  800b44:	e8 4f 00 00 00       	call   800b98 <_panic>
+			mainenv = &envs[i];
+  800b49:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800b4f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800b54:	a3 28 64 80 00       	mov    %eax,0x806428
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800b59:	85 ff                	test   %edi,%edi
+  800b5b:	7e 07                	jle    800b64 <libmain+0x90>
+		binaryname = argv[0];
+  800b5d:	8b 06                	mov    (%esi),%eax
+  800b5f:	a3 1c 50 80 00       	mov    %eax,0x80501c
+
+	// call user main routine
+	umain(argc, argv);
+  800b64:	83 ec 08             	sub    $0x8,%esp
+  800b67:	56                   	push   %esi
+  800b68:	57                   	push   %edi
+  800b69:	e8 f5 fb ff ff       	call   800763 <umain>
+
+	// exit gracefully
+	exit();
+  800b6e:	e8 0b 00 00 00       	call   800b7e <exit>
+}
+  800b73:	83 c4 10             	add    $0x10,%esp
+  800b76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b79:	5b                   	pop    %ebx
+  800b7a:	5e                   	pop    %esi
+  800b7b:	5f                   	pop    %edi
+  800b7c:	5d                   	pop    %ebp
+  800b7d:	c3                   	ret
+
+00800b7e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800b7e:	55                   	push   %ebp
+  800b7f:	89 e5                	mov    %esp,%ebp
+  800b81:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800b84:	e8 db 21 00 00       	call   802d64 <close_all>
+	sys_env_destroy(0);
+  800b89:	83 ec 0c             	sub    $0xc,%esp
+  800b8c:	6a 00                	push   $0x0
+  800b8e:	e8 1b 0c 00 00       	call   8017ae <sys_env_destroy>
+}
+  800b93:	83 c4 10             	add    $0x10,%esp
+  800b96:	c9                   	leave
+  800b97:	c3                   	ret
+
+00800b98 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800b98:	55                   	push   %ebp
+  800b99:	89 e5                	mov    %esp,%ebp
+  800b9b:	56                   	push   %esi
+  800b9c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800b9d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800ba0:	8b 35 1c 50 80 00    	mov    0x80501c,%esi
+  800ba6:	e8 6c 0c 00 00       	call   801817 <sys_getenvid>
+  800bab:	83 ec 0c             	sub    $0xc,%esp
+  800bae:	ff 75 0c             	push   0xc(%ebp)
+  800bb1:	ff 75 08             	push   0x8(%ebp)
+  800bb4:	56                   	push   %esi
+  800bb5:	50                   	push   %eax
+  800bb6:	68 38 49 80 00       	push   $0x804938
+  800bbb:	e8 b3 00 00 00       	call   800c73 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800bc0:	83 c4 18             	add    $0x18,%esp
+  800bc3:	53                   	push   %ebx
+  800bc4:	ff 75 10             	push   0x10(%ebp)
+  800bc7:	e8 56 00 00 00       	call   800c22 <vcprintf>
+	cprintf("\n");
+  800bcc:	c7 04 24 20 47 80 00 	movl   $0x804720,(%esp)
+  800bd3:	e8 9b 00 00 00       	call   800c73 <cprintf>
+  800bd8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800bdb:	cc                   	int3
+	while (1)
+  800bdc:	eb fd                	jmp    800bdb <_panic+0x43>
+
+00800bde <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	53                   	push   %ebx
+  800be2:	83 ec 04             	sub    $0x4,%esp
+  800be5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800be8:	8b 13                	mov    (%ebx),%edx
+  800bea:	8d 42 01             	lea    0x1(%edx),%eax
+  800bed:	89 03                	mov    %eax,(%ebx)
+  800bef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bf2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800bf6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800bfb:	74 09                	je     800c06 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800bfd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800c01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800c06:	83 ec 08             	sub    $0x8,%esp
+  800c09:	68 ff 00 00 00       	push   $0xff
+  800c0e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800c11:	50                   	push   %eax
+  800c12:	e8 0d 0b 00 00       	call   801724 <sys_cputs>
+		b->idx = 0;
+  800c17:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800c1d:	83 c4 10             	add    $0x10,%esp
+  800c20:	eb db                	jmp    800bfd <putch+0x1f>
+
+00800c22 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800c2b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800c32:	00 00 00 
+	b.cnt = 0;
+  800c35:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800c3c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800c3f:	ff 75 0c             	push   0xc(%ebp)
+  800c42:	ff 75 08             	push   0x8(%ebp)
+  800c45:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800c4b:	50                   	push   %eax
+  800c4c:	68 de 0b 80 00       	push   $0x800bde
+  800c51:	e8 fb 00 00 00       	call   800d51 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800c56:	83 c4 08             	add    $0x8,%esp
+  800c59:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800c5f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800c65:	50                   	push   %eax
+  800c66:	e8 b9 0a 00 00       	call   801724 <sys_cputs>
+
+	return b.cnt;
+}
+  800c6b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800c71:	c9                   	leave
+  800c72:	c3                   	ret
+
+00800c73 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800c79:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800c7c:	50                   	push   %eax
+  800c7d:	ff 75 08             	push   0x8(%ebp)
+  800c80:	e8 9d ff ff ff       	call   800c22 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800c85:	c9                   	leave
+  800c86:	c3                   	ret
+
+00800c87 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800c87:	55                   	push   %ebp
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	57                   	push   %edi
+  800c8b:	56                   	push   %esi
+  800c8c:	53                   	push   %ebx
+  800c8d:	83 ec 1c             	sub    $0x1c,%esp
+  800c90:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c93:	89 d6                	mov    %edx,%esi
+  800c95:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c98:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800c9b:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800c9e:	73 0b                	jae    800cab <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800ca0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ca3:	c1 e7 08             	shl    $0x8,%edi
+  800ca6:	0b 7d 10             	or     0x10(%ebp),%edi
+  800ca9:	eb 36                	jmp    800ce1 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800cab:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800cae:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb3:	f7 75 08             	divl   0x8(%ebp)
+  800cb6:	89 c1                	mov    %eax,%ecx
+  800cb8:	ff 75 14             	push   0x14(%ebp)
+  800cbb:	ff 75 10             	push   0x10(%ebp)
+  800cbe:	83 eb 01             	sub    $0x1,%ebx
+  800cc1:	53                   	push   %ebx
+  800cc2:	ff 75 08             	push   0x8(%ebp)
+  800cc5:	89 f2                	mov    %esi,%edx
+  800cc7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800cca:	e8 b8 ff ff ff       	call   800c87 <printnum>
+  800ccf:	83 c4 10             	add    $0x10,%esp
+  800cd2:	eb 14                	jmp    800ce8 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800cd4:	83 ec 08             	sub    $0x8,%esp
+  800cd7:	56                   	push   %esi
+  800cd8:	57                   	push   %edi
+  800cd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800cdc:	ff d0                	call   *%eax
+  800cde:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800ce1:	83 eb 01             	sub    $0x1,%ebx
+  800ce4:	85 db                	test   %ebx,%ebx
+  800ce6:	7f ec                	jg     800cd4 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800ce8:	83 ec 08             	sub    $0x8,%esp
+  800ceb:	56                   	push   %esi
+  800cec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800cef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf4:	f7 75 08             	divl   0x8(%ebp)
+  800cf7:	0f be 92 5b 49 80 00 	movsbl 0x80495b(%edx),%edx
+  800cfe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d01:	c1 e0 08             	shl    $0x8,%eax
+  800d04:	09 d0                	or     %edx,%eax
+  800d06:	50                   	push   %eax
+  800d07:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800d0a:	ff d0                	call   *%eax
+}
+  800d0c:	83 c4 10             	add    $0x10,%esp
+  800d0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+
+00800d17 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800d1d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800d21:	8b 10                	mov    (%eax),%edx
+  800d23:	3b 50 04             	cmp    0x4(%eax),%edx
+  800d26:	73 0a                	jae    800d32 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800d28:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800d2b:	89 08                	mov    %ecx,(%eax)
+  800d2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d30:	88 02                	mov    %al,(%edx)
+}
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+
+00800d34 <printfmt>:
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800d3a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800d3d:	50                   	push   %eax
+  800d3e:	ff 75 10             	push   0x10(%ebp)
+  800d41:	ff 75 0c             	push   0xc(%ebp)
+  800d44:	ff 75 08             	push   0x8(%ebp)
+  800d47:	e8 05 00 00 00       	call   800d51 <vprintfmt>
+}
+  800d4c:	83 c4 10             	add    $0x10,%esp
+  800d4f:	c9                   	leave
+  800d50:	c3                   	ret
+
+00800d51 <vprintfmt>:
+{
+  800d51:	55                   	push   %ebp
+  800d52:	89 e5                	mov    %esp,%ebp
+  800d54:	57                   	push   %edi
+  800d55:	56                   	push   %esi
+  800d56:	53                   	push   %ebx
+  800d57:	83 ec 3c             	sub    $0x3c,%esp
+  800d5a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d5d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800d60:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800d67:	eb 16                	jmp    800d7f <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800d69:	83 ec 08             	sub    $0x8,%esp
+  800d6c:	ff 75 0c             	push   0xc(%ebp)
+  800d6f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800d72:	c1 e2 08             	shl    $0x8,%edx
+  800d75:	09 d0                	or     %edx,%eax
+  800d77:	50                   	push   %eax
+  800d78:	ff d7                	call   *%edi
+  800d7a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d7d:	89 de                	mov    %ebx,%esi
+  800d7f:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800d82:	0f b6 06             	movzbl (%esi),%eax
+  800d85:	83 f8 25             	cmp    $0x25,%eax
+  800d88:	74 0c                	je     800d96 <vprintfmt+0x45>
+			if (ch == '\0')
+  800d8a:	85 c0                	test   %eax,%eax
+  800d8c:	75 db                	jne    800d69 <vprintfmt+0x18>
+}
+  800d8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d91:	5b                   	pop    %ebx
+  800d92:	5e                   	pop    %esi
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+		padc = ' ';
+  800d96:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800d9a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800da1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800da8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800daf:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800db4:	8d 73 01             	lea    0x1(%ebx),%esi
+  800db7:	0f b6 13             	movzbl (%ebx),%edx
+  800dba:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800dbd:	3c 55                	cmp    $0x55,%al
+  800dbf:	0f 87 2c 04 00 00    	ja     8011f1 <vprintfmt+0x4a0>
+  800dc5:	0f b6 c0             	movzbl %al,%eax
+  800dc8:	ff 24 85 a0 4a 80 00 	jmp    *0x804aa0(,%eax,4)
+  800dcf:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800dd1:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800dd5:	eb dd                	jmp    800db4 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800dd7:	89 f3                	mov    %esi,%ebx
+  800dd9:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800ddd:	eb d5                	jmp    800db4 <vprintfmt+0x63>
+  800ddf:	0f b6 d2             	movzbl %dl,%edx
+  800de2:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800de9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800dec:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800df0:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800df3:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800df6:	83 fe 09             	cmp    $0x9,%esi
+  800df9:	0f 87 8a 00 00 00    	ja     800e89 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800dff:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800e02:	eb e5                	jmp    800de9 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800e04:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e07:	8b 00                	mov    (%eax),%eax
+  800e09:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e0f:	8d 40 04             	lea    0x4(%eax),%eax
+  800e12:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800e15:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800e17:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800e1b:	79 97                	jns    800db4 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800e1d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800e20:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e23:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800e2a:	eb 88                	jmp    800db4 <vprintfmt+0x63>
+			if (width < 0)
+  800e2c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800e2f:	85 db                	test   %ebx,%ebx
+  800e31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e36:	0f 49 c3             	cmovns %ebx,%eax
+  800e39:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800e3c:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800e3e:	e9 71 ff ff ff       	jmp    800db4 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800e43:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800e45:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800e4c:	e9 63 ff ff ff       	jmp    800db4 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800e51:	8d 73 02             	lea    0x2(%ebx),%esi
+  800e54:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800e58:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800e5f:	3c 67                	cmp    $0x67,%al
+  800e61:	0f 84 18 ff ff ff    	je     800d7f <vprintfmt+0x2e>
+					attrib = 0x04;
+  800e67:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800e6e:	3c 72                	cmp    $0x72,%al
+  800e70:	0f 84 09 ff ff ff    	je     800d7f <vprintfmt+0x2e>
+					attrib = 0x00;
+  800e76:	3c 62                	cmp    $0x62,%al
+  800e78:	0f 94 c0             	sete   %al
+  800e7b:	0f b6 c0             	movzbl %al,%eax
+  800e7e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800e81:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800e84:	e9 f6 fe ff ff       	jmp    800d7f <vprintfmt+0x2e>
+  800e89:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800e8c:	eb 89                	jmp    800e17 <vprintfmt+0xc6>
+			lflag++;
+  800e8e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800e91:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800e93:	e9 1c ff ff ff       	jmp    800db4 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800e98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e9b:	8d 58 04             	lea    0x4(%eax),%ebx
+  800e9e:	83 ec 08             	sub    $0x8,%esp
+  800ea1:	ff 75 0c             	push   0xc(%ebp)
+  800ea4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800ea7:	c1 e0 08             	shl    $0x8,%eax
+  800eaa:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800ead:	0b 01                	or     (%ecx),%eax
+  800eaf:	50                   	push   %eax
+  800eb0:	ff d7                	call   *%edi
+			break;
+  800eb2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800eb5:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800eb8:	e9 c2 fe ff ff       	jmp    800d7f <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800ebd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ec0:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800ec3:	8b 10                	mov    (%eax),%edx
+  800ec5:	89 d0                	mov    %edx,%eax
+  800ec7:	f7 d8                	neg    %eax
+  800ec9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800ecc:	83 f8 12             	cmp    $0x12,%eax
+  800ecf:	7f 25                	jg     800ef6 <vprintfmt+0x1a5>
+  800ed1:	8b 14 85 00 4c 80 00 	mov    0x804c00(,%eax,4),%edx
+  800ed8:	85 d2                	test   %edx,%edx
+  800eda:	74 1a                	je     800ef6 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800edc:	52                   	push   %edx
+  800edd:	68 43 48 80 00       	push   $0x804843
+  800ee2:	ff 75 0c             	push   0xc(%ebp)
+  800ee5:	57                   	push   %edi
+  800ee6:	e8 49 fe ff ff       	call   800d34 <printfmt>
+  800eeb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800eee:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800ef1:	e9 89 fe ff ff       	jmp    800d7f <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800ef6:	50                   	push   %eax
+  800ef7:	68 73 49 80 00       	push   $0x804973
+  800efc:	ff 75 0c             	push   0xc(%ebp)
+  800eff:	57                   	push   %edi
+  800f00:	e8 2f fe ff ff       	call   800d34 <printfmt>
+  800f05:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800f08:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800f0b:	e9 6f fe ff ff       	jmp    800d7f <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800f10:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f13:	83 c0 04             	add    $0x4,%eax
+  800f16:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800f19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f1c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800f1e:	85 c9                	test   %ecx,%ecx
+  800f20:	b8 6c 49 80 00       	mov    $0x80496c,%eax
+  800f25:	0f 45 c1             	cmovne %ecx,%eax
+  800f28:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800f2b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800f2f:	7e 06                	jle    800f37 <vprintfmt+0x1e6>
+  800f31:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800f35:	75 1a                	jne    800f51 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800f37:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800f3a:	c1 e0 08             	shl    $0x8,%eax
+  800f3d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800f40:	83 c8 3f             	or     $0x3f,%eax
+  800f43:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800f46:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800f49:	89 75 10             	mov    %esi,0x10(%ebp)
+  800f4c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800f4f:	eb 6d                	jmp    800fbe <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f51:	83 ec 08             	sub    $0x8,%esp
+  800f54:	ff 75 d0             	push   -0x30(%ebp)
+  800f57:	ff 75 c8             	push   -0x38(%ebp)
+  800f5a:	e8 29 04 00 00       	call   801388 <strnlen>
+  800f5f:	89 c2                	mov    %eax,%edx
+  800f61:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f64:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800f66:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800f69:	c1 e1 08             	shl    $0x8,%ecx
+  800f6c:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800f70:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f72:	83 c4 10             	add    $0x10,%esp
+  800f75:	89 c3                	mov    %eax,%ebx
+  800f77:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800f7a:	89 75 10             	mov    %esi,0x10(%ebp)
+  800f7d:	89 ce                	mov    %ecx,%esi
+  800f7f:	eb 0f                	jmp    800f90 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800f81:	83 ec 08             	sub    $0x8,%esp
+  800f84:	ff 75 0c             	push   0xc(%ebp)
+  800f87:	56                   	push   %esi
+  800f88:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f8a:	83 eb 01             	sub    $0x1,%ebx
+  800f8d:	83 c4 10             	add    $0x10,%esp
+  800f90:	85 db                	test   %ebx,%ebx
+  800f92:	7f ed                	jg     800f81 <vprintfmt+0x230>
+  800f94:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800f97:	8b 75 10             	mov    0x10(%ebp),%esi
+  800f9a:	85 c0                	test   %eax,%eax
+  800f9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa1:	0f 49 d0             	cmovns %eax,%edx
+  800fa4:	29 d0                	sub    %edx,%eax
+  800fa6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800fa9:	eb 8c                	jmp    800f37 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800fab:	83 ec 08             	sub    $0x8,%esp
+  800fae:	ff 75 0c             	push   0xc(%ebp)
+  800fb1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fb4:	09 c2                	or     %eax,%edx
+  800fb6:	52                   	push   %edx
+  800fb7:	ff d7                	call   *%edi
+  800fb9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800fbc:	89 d9                	mov    %ebx,%ecx
+  800fbe:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800fc1:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800fc5:	0f be d0             	movsbl %al,%edx
+  800fc8:	85 d2                	test   %edx,%edx
+  800fca:	74 2a                	je     800ff6 <vprintfmt+0x2a5>
+  800fcc:	85 f6                	test   %esi,%esi
+  800fce:	78 05                	js     800fd5 <vprintfmt+0x284>
+  800fd0:	83 ee 01             	sub    $0x1,%esi
+  800fd3:	78 3b                	js     801010 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800fd5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800fd9:	74 d0                	je     800fab <vprintfmt+0x25a>
+  800fdb:	0f be c0             	movsbl %al,%eax
+  800fde:	83 e8 20             	sub    $0x20,%eax
+  800fe1:	83 f8 5e             	cmp    $0x5e,%eax
+  800fe4:	76 c5                	jbe    800fab <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800fe6:	83 ec 08             	sub    $0x8,%esp
+  800fe9:	ff 75 0c             	push   0xc(%ebp)
+  800fec:	ff 75 cc             	push   -0x34(%ebp)
+  800fef:	ff d7                	call   *%edi
+  800ff1:	83 c4 10             	add    $0x10,%esp
+  800ff4:	eb c6                	jmp    800fbc <vprintfmt+0x26b>
+  800ff6:	8b 75 10             	mov    0x10(%ebp),%esi
+  800ff9:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800ffc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800fff:	01 c3                	add    %eax,%ebx
+  801001:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  801003:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801006:	83 c8 20             	or     $0x20,%eax
+  801009:	89 75 10             	mov    %esi,0x10(%ebp)
+  80100c:	89 c6                	mov    %eax,%esi
+  80100e:	eb 14                	jmp    801024 <vprintfmt+0x2d3>
+  801010:	8b 75 10             	mov    0x10(%ebp),%esi
+  801013:	eb e4                	jmp    800ff9 <vprintfmt+0x2a8>
+  801015:	83 ec 08             	sub    $0x8,%esp
+  801018:	ff 75 0c             	push   0xc(%ebp)
+  80101b:	56                   	push   %esi
+  80101c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80101e:	83 eb 01             	sub    $0x1,%ebx
+  801021:	83 c4 10             	add    $0x10,%esp
+  801024:	85 db                	test   %ebx,%ebx
+  801026:	7f ed                	jg     801015 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  801028:	8b 75 10             	mov    0x10(%ebp),%esi
+  80102b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80102e:	89 45 14             	mov    %eax,0x14(%ebp)
+  801031:	e9 49 fd ff ff       	jmp    800d7f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  801036:	83 f9 01             	cmp    $0x1,%ecx
+  801039:	7f 1f                	jg     80105a <vprintfmt+0x309>
+	else if (lflag)
+  80103b:	85 c9                	test   %ecx,%ecx
+  80103d:	74 69                	je     8010a8 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80103f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801042:	8b 00                	mov    (%eax),%eax
+  801044:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801047:	89 c1                	mov    %eax,%ecx
+  801049:	c1 f9 1f             	sar    $0x1f,%ecx
+  80104c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80104f:	8b 45 14             	mov    0x14(%ebp),%eax
+  801052:	8d 40 04             	lea    0x4(%eax),%eax
+  801055:	89 45 14             	mov    %eax,0x14(%ebp)
+  801058:	eb 17                	jmp    801071 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80105a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80105d:	8b 50 04             	mov    0x4(%eax),%edx
+  801060:	8b 00                	mov    (%eax),%eax
+  801062:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  801065:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  801068:	8b 45 14             	mov    0x14(%ebp),%eax
+  80106b:	8d 40 08             	lea    0x8(%eax),%eax
+  80106e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  801071:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801074:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  801077:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80107c:	85 db                	test   %ebx,%ebx
+  80107e:	0f 89 f6 00 00 00    	jns    80117a <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  801084:	83 ec 08             	sub    $0x8,%esp
+  801087:	ff 75 0c             	push   0xc(%ebp)
+  80108a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80108d:	c1 e0 08             	shl    $0x8,%eax
+  801090:	83 c8 2d             	or     $0x2d,%eax
+  801093:	50                   	push   %eax
+  801094:	ff d7                	call   *%edi
+				num = -(long long) num;
+  801096:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  801099:	f7 d9                	neg    %ecx
+  80109b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80109e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010a3:	e9 d2 00 00 00       	jmp    80117a <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8010a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010ab:	8b 00                	mov    (%eax),%eax
+  8010ad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8010b0:	89 c1                	mov    %eax,%ecx
+  8010b2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8010b5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8010b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8010be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8010c1:	eb ae                	jmp    801071 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8010c3:	83 f9 01             	cmp    $0x1,%ecx
+  8010c6:	7f 19                	jg     8010e1 <vprintfmt+0x390>
+	else if (lflag)
+  8010c8:	85 c9                	test   %ecx,%ecx
+  8010ca:	74 2a                	je     8010f6 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8010cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010cf:	8b 08                	mov    (%eax),%ecx
+  8010d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8010d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8010d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8010dc:	e9 99 00 00 00       	jmp    80117a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8010e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010e4:	8b 08                	mov    (%eax),%ecx
+  8010e6:	8d 40 08             	lea    0x8(%eax),%eax
+  8010e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8010ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8010f1:	e9 84 00 00 00       	jmp    80117a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8010f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8010f9:	8b 08                	mov    (%eax),%ecx
+  8010fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8010fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  801101:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  801106:	eb 72                	jmp    80117a <vprintfmt+0x429>
+	if (lflag >= 2)
+  801108:	83 f9 01             	cmp    $0x1,%ecx
+  80110b:	7f 16                	jg     801123 <vprintfmt+0x3d2>
+	else if (lflag)
+  80110d:	85 c9                	test   %ecx,%ecx
+  80110f:	74 24                	je     801135 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  801111:	8b 45 14             	mov    0x14(%ebp),%eax
+  801114:	8b 08                	mov    (%eax),%ecx
+  801116:	8d 40 04             	lea    0x4(%eax),%eax
+  801119:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80111c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  801121:	eb 57                	jmp    80117a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  801123:	8b 45 14             	mov    0x14(%ebp),%eax
+  801126:	8b 08                	mov    (%eax),%ecx
+  801128:	8d 40 08             	lea    0x8(%eax),%eax
+  80112b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80112e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  801133:	eb 45                	jmp    80117a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  801135:	8b 45 14             	mov    0x14(%ebp),%eax
+  801138:	8b 08                	mov    (%eax),%ecx
+  80113a:	8d 40 04             	lea    0x4(%eax),%eax
+  80113d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  801140:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  801145:	eb 33                	jmp    80117a <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  801147:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80114a:	c1 e3 08             	shl    $0x8,%ebx
+  80114d:	83 ec 08             	sub    $0x8,%esp
+  801150:	ff 75 0c             	push   0xc(%ebp)
+  801153:	89 d8                	mov    %ebx,%eax
+  801155:	83 c8 30             	or     $0x30,%eax
+  801158:	50                   	push   %eax
+  801159:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80115b:	83 c4 08             	add    $0x8,%esp
+  80115e:	ff 75 0c             	push   0xc(%ebp)
+  801161:	83 cb 78             	or     $0x78,%ebx
+  801164:	53                   	push   %ebx
+  801165:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  801167:	8b 45 14             	mov    0x14(%ebp),%eax
+  80116a:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80116c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80116f:	8d 40 04             	lea    0x4(%eax),%eax
+  801172:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801175:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80117a:	ff 75 e4             	push   -0x1c(%ebp)
+  80117d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  801181:	52                   	push   %edx
+  801182:	ff 75 e0             	push   -0x20(%ebp)
+  801185:	50                   	push   %eax
+  801186:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801189:	89 f8                	mov    %edi,%eax
+  80118b:	e8 f7 fa ff ff       	call   800c87 <printnum>
+			break;
+  801190:	83 c4 10             	add    $0x10,%esp
+  801193:	e9 e7 fb ff ff       	jmp    800d7f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  801198:	83 f9 01             	cmp    $0x1,%ecx
+  80119b:	7f 16                	jg     8011b3 <vprintfmt+0x462>
+	else if (lflag)
+  80119d:	85 c9                	test   %ecx,%ecx
+  80119f:	74 24                	je     8011c5 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8011a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011a4:	8b 08                	mov    (%eax),%ecx
+  8011a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8011a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8011ac:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8011b1:	eb c7                	jmp    80117a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8011b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011b6:	8b 08                	mov    (%eax),%ecx
+  8011b8:	8d 40 08             	lea    0x8(%eax),%eax
+  8011bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8011be:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8011c3:	eb b5                	jmp    80117a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8011c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8011c8:	8b 08                	mov    (%eax),%ecx
+  8011ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8011cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8011d0:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8011d5:	eb a3                	jmp    80117a <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8011d7:	83 ec 08             	sub    $0x8,%esp
+  8011da:	ff 75 0c             	push   0xc(%ebp)
+  8011dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8011e0:	c1 e0 08             	shl    $0x8,%eax
+  8011e3:	83 c8 25             	or     $0x25,%eax
+  8011e6:	50                   	push   %eax
+  8011e7:	ff d7                	call   *%edi
+			break;
+  8011e9:	83 c4 10             	add    $0x10,%esp
+  8011ec:	e9 8e fb ff ff       	jmp    800d7f <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8011f1:	83 ec 08             	sub    $0x8,%esp
+  8011f4:	ff 75 0c             	push   0xc(%ebp)
+  8011f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8011fa:	c1 e0 08             	shl    $0x8,%eax
+  8011fd:	83 c8 25             	or     $0x25,%eax
+  801200:	50                   	push   %eax
+  801201:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801203:	83 c4 10             	add    $0x10,%esp
+  801206:	89 de                	mov    %ebx,%esi
+  801208:	eb 03                	jmp    80120d <vprintfmt+0x4bc>
+  80120a:	83 ee 01             	sub    $0x1,%esi
+  80120d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  801211:	75 f7                	jne    80120a <vprintfmt+0x4b9>
+  801213:	e9 67 fb ff ff       	jmp    800d7f <vprintfmt+0x2e>
+
+00801218 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801218:	55                   	push   %ebp
+  801219:	89 e5                	mov    %esp,%ebp
+  80121b:	83 ec 18             	sub    $0x18,%esp
+  80121e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801221:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801224:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801227:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80122b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80122e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  801235:	85 c0                	test   %eax,%eax
+  801237:	74 26                	je     80125f <vsnprintf+0x47>
+  801239:	85 d2                	test   %edx,%edx
+  80123b:	7e 22                	jle    80125f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80123d:	ff 75 14             	push   0x14(%ebp)
+  801240:	ff 75 10             	push   0x10(%ebp)
+  801243:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  801246:	50                   	push   %eax
+  801247:	68 17 0d 80 00       	push   $0x800d17
+  80124c:	e8 00 fb ff ff       	call   800d51 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801251:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801254:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801257:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80125a:	83 c4 10             	add    $0x10,%esp
+}
+  80125d:	c9                   	leave
+  80125e:	c3                   	ret
+		return -E_INVAL;
+  80125f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801264:	eb f7                	jmp    80125d <vsnprintf+0x45>
+
+00801266 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80126c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80126f:	50                   	push   %eax
+  801270:	ff 75 10             	push   0x10(%ebp)
+  801273:	ff 75 0c             	push   0xc(%ebp)
+  801276:	ff 75 08             	push   0x8(%ebp)
+  801279:	e8 9a ff ff ff       	call   801218 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80127e:	c9                   	leave
+  80127f:	c3                   	ret
+
+00801280 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+  801286:	83 ec 0c             	sub    $0xc,%esp
+  801289:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  80128c:	85 c0                	test   %eax,%eax
+  80128e:	74 13                	je     8012a3 <readline+0x23>
+		fprintf(1, "%s", prompt);
+  801290:	83 ec 04             	sub    $0x4,%esp
+  801293:	50                   	push   %eax
+  801294:	68 43 48 80 00       	push   $0x804843
+  801299:	6a 01                	push   $0x1
+  80129b:	e8 22 22 00 00       	call   8034c2 <fprintf>
+  8012a0:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  8012a3:	83 ec 0c             	sub    $0xc,%esp
+  8012a6:	6a 00                	push   $0x0
+  8012a8:	e8 a9 f7 ff ff       	call   800a56 <iscons>
+  8012ad:	89 c7                	mov    %eax,%edi
+  8012af:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  8012b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b7:	eb 4b                	jmp    801304 <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  8012be:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  8012c1:	75 08                	jne    8012cb <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  8012c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c6:	5b                   	pop    %ebx
+  8012c7:	5e                   	pop    %esi
+  8012c8:	5f                   	pop    %edi
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  8012cb:	83 ec 08             	sub    $0x8,%esp
+  8012ce:	53                   	push   %ebx
+  8012cf:	68 6b 4c 80 00       	push   $0x804c6b
+  8012d4:	e8 9a f9 ff ff       	call   800c73 <cprintf>
+  8012d9:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  8012dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e1:	eb e0                	jmp    8012c3 <readline+0x43>
+			if (echoing)
+  8012e3:	85 ff                	test   %edi,%edi
+  8012e5:	75 05                	jne    8012ec <readline+0x6c>
+			i--;
+  8012e7:	83 ee 01             	sub    $0x1,%esi
+  8012ea:	eb 18                	jmp    801304 <readline+0x84>
+				cputchar('\b');
+  8012ec:	83 ec 0c             	sub    $0xc,%esp
+  8012ef:	6a 08                	push   $0x8
+  8012f1:	e8 1b f7 ff ff       	call   800a11 <cputchar>
+  8012f6:	83 c4 10             	add    $0x10,%esp
+  8012f9:	eb ec                	jmp    8012e7 <readline+0x67>
+			buf[i++] = c;
+  8012fb:	88 9e 20 60 80 00    	mov    %bl,0x806020(%esi)
+  801301:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  801304:	e8 24 f7 ff ff       	call   800a2d <getchar>
+  801309:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  80130b:	85 c0                	test   %eax,%eax
+  80130d:	78 aa                	js     8012b9 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  80130f:	83 f8 08             	cmp    $0x8,%eax
+  801312:	0f 94 c0             	sete   %al
+  801315:	83 fb 7f             	cmp    $0x7f,%ebx
+  801318:	0f 94 c2             	sete   %dl
+  80131b:	08 d0                	or     %dl,%al
+  80131d:	74 04                	je     801323 <readline+0xa3>
+  80131f:	85 f6                	test   %esi,%esi
+  801321:	7f c0                	jg     8012e3 <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  801323:	83 fb 1f             	cmp    $0x1f,%ebx
+  801326:	7e 1a                	jle    801342 <readline+0xc2>
+  801328:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  80132e:	7f 12                	jg     801342 <readline+0xc2>
+			if (echoing)
+  801330:	85 ff                	test   %edi,%edi
+  801332:	74 c7                	je     8012fb <readline+0x7b>
+				cputchar(c);
+  801334:	83 ec 0c             	sub    $0xc,%esp
+  801337:	53                   	push   %ebx
+  801338:	e8 d4 f6 ff ff       	call   800a11 <cputchar>
+  80133d:	83 c4 10             	add    $0x10,%esp
+  801340:	eb b9                	jmp    8012fb <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  801342:	83 fb 0a             	cmp    $0xa,%ebx
+  801345:	74 05                	je     80134c <readline+0xcc>
+  801347:	83 fb 0d             	cmp    $0xd,%ebx
+  80134a:	75 b8                	jne    801304 <readline+0x84>
+			if (echoing)
+  80134c:	85 ff                	test   %edi,%edi
+  80134e:	75 11                	jne    801361 <readline+0xe1>
+			buf[i] = 0;
+  801350:	c6 86 20 60 80 00 00 	movb   $0x0,0x806020(%esi)
+			return buf;
+  801357:	b8 20 60 80 00       	mov    $0x806020,%eax
+  80135c:	e9 62 ff ff ff       	jmp    8012c3 <readline+0x43>
+				cputchar('\n');
+  801361:	83 ec 0c             	sub    $0xc,%esp
+  801364:	6a 0a                	push   $0xa
+  801366:	e8 a6 f6 ff ff       	call   800a11 <cputchar>
+  80136b:	83 c4 10             	add    $0x10,%esp
+  80136e:	eb e0                	jmp    801350 <readline+0xd0>
+
+00801370 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801370:	55                   	push   %ebp
+  801371:	89 e5                	mov    %esp,%ebp
+  801373:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137b:	eb 03                	jmp    801380 <strlen+0x10>
+		n++;
+  80137d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801380:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801384:	75 f7                	jne    80137d <strlen+0xd>
+	return n;
+}
+  801386:	5d                   	pop    %ebp
+  801387:	c3                   	ret
+
+00801388 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80138e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801391:	b8 00 00 00 00       	mov    $0x0,%eax
+  801396:	eb 03                	jmp    80139b <strnlen+0x13>
+		n++;
+  801398:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80139b:	39 d0                	cmp    %edx,%eax
+  80139d:	74 08                	je     8013a7 <strnlen+0x1f>
+  80139f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8013a3:	75 f3                	jne    801398 <strnlen+0x10>
+  8013a5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8013a7:	89 d0                	mov    %edx,%eax
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	c3                   	ret
+
+008013ab <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8013ab:	55                   	push   %ebp
+  8013ac:	89 e5                	mov    %esp,%ebp
+  8013ae:	53                   	push   %ebx
+  8013af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8013b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8013b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ba:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8013be:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8013c1:	83 c0 01             	add    $0x1,%eax
+  8013c4:	84 d2                	test   %dl,%dl
+  8013c6:	75 f2                	jne    8013ba <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8013c8:	89 c8                	mov    %ecx,%eax
+  8013ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013cd:	c9                   	leave
+  8013ce:	c3                   	ret
+
+008013cf <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	53                   	push   %ebx
+  8013d3:	83 ec 10             	sub    $0x10,%esp
+  8013d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8013d9:	53                   	push   %ebx
+  8013da:	e8 91 ff ff ff       	call   801370 <strlen>
+  8013df:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8013e2:	ff 75 0c             	push   0xc(%ebp)
+  8013e5:	01 d8                	add    %ebx,%eax
+  8013e7:	50                   	push   %eax
+  8013e8:	e8 be ff ff ff       	call   8013ab <strcpy>
+	return dst;
+}
+  8013ed:	89 d8                	mov    %ebx,%eax
+  8013ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f2:	c9                   	leave
+  8013f3:	c3                   	ret
+
+008013f4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8013f4:	55                   	push   %ebp
+  8013f5:	89 e5                	mov    %esp,%ebp
+  8013f7:	56                   	push   %esi
+  8013f8:	53                   	push   %ebx
+  8013f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8013ff:	89 f3                	mov    %esi,%ebx
+  801401:	03 5d 10             	add    0x10(%ebp),%ebx
+  801404:	89 f0                	mov    %esi,%eax
+  801406:	eb 0f                	jmp    801417 <strncpy+0x23>
+		*dst++ = *src;
+  801408:	83 c0 01             	add    $0x1,%eax
+  80140b:	0f b6 0a             	movzbl (%edx),%ecx
+  80140e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  801411:	80 f9 01             	cmp    $0x1,%cl
+  801414:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801417:	39 d8                	cmp    %ebx,%eax
+  801419:	75 ed                	jne    801408 <strncpy+0x14>
+	}
+	return ret;
+}
+  80141b:	89 f0                	mov    %esi,%eax
+  80141d:	5b                   	pop    %ebx
+  80141e:	5e                   	pop    %esi
+  80141f:	5d                   	pop    %ebp
+  801420:	c3                   	ret
+
+00801421 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801421:	55                   	push   %ebp
+  801422:	89 e5                	mov    %esp,%ebp
+  801424:	56                   	push   %esi
+  801425:	53                   	push   %ebx
+  801426:	8b 75 08             	mov    0x8(%ebp),%esi
+  801429:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80142f:	89 f0                	mov    %esi,%eax
+  801431:	85 d2                	test   %edx,%edx
+  801433:	74 21                	je     801456 <strlcpy+0x35>
+  801435:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801439:	89 f2                	mov    %esi,%edx
+  80143b:	eb 09                	jmp    801446 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80143d:	83 c1 01             	add    $0x1,%ecx
+  801440:	83 c2 01             	add    $0x1,%edx
+  801443:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  801446:	39 c2                	cmp    %eax,%edx
+  801448:	74 09                	je     801453 <strlcpy+0x32>
+  80144a:	0f b6 19             	movzbl (%ecx),%ebx
+  80144d:	84 db                	test   %bl,%bl
+  80144f:	75 ec                	jne    80143d <strlcpy+0x1c>
+  801451:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801453:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  801456:	29 f0                	sub    %esi,%eax
+}
+  801458:	5b                   	pop    %ebx
+  801459:	5e                   	pop    %esi
+  80145a:	5d                   	pop    %ebp
+  80145b:	c3                   	ret
+
+0080145c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80145c:	55                   	push   %ebp
+  80145d:	89 e5                	mov    %esp,%ebp
+  80145f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801462:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801465:	eb 06                	jmp    80146d <strcmp+0x11>
+		p++, q++;
+  801467:	83 c1 01             	add    $0x1,%ecx
+  80146a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80146d:	0f b6 01             	movzbl (%ecx),%eax
+  801470:	84 c0                	test   %al,%al
+  801472:	74 04                	je     801478 <strcmp+0x1c>
+  801474:	3a 02                	cmp    (%edx),%al
+  801476:	74 ef                	je     801467 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801478:	0f b6 c0             	movzbl %al,%eax
+  80147b:	0f b6 12             	movzbl (%edx),%edx
+  80147e:	29 d0                	sub    %edx,%eax
+}
+  801480:	5d                   	pop    %ebp
+  801481:	c3                   	ret
+
+00801482 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	53                   	push   %ebx
+  801486:	8b 45 08             	mov    0x8(%ebp),%eax
+  801489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80148f:	eb 09                	jmp    80149a <strncmp+0x18>
+		n--, p++, q++;
+  801491:	83 ea 01             	sub    $0x1,%edx
+  801494:	83 c0 01             	add    $0x1,%eax
+  801497:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80149a:	85 d2                	test   %edx,%edx
+  80149c:	74 18                	je     8014b6 <strncmp+0x34>
+  80149e:	0f b6 18             	movzbl (%eax),%ebx
+  8014a1:	84 db                	test   %bl,%bl
+  8014a3:	74 04                	je     8014a9 <strncmp+0x27>
+  8014a5:	3a 19                	cmp    (%ecx),%bl
+  8014a7:	74 e8                	je     801491 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8014a9:	0f b6 00             	movzbl (%eax),%eax
+  8014ac:	0f b6 11             	movzbl (%ecx),%edx
+  8014af:	29 d0                	sub    %edx,%eax
+}
+  8014b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b4:	c9                   	leave
+  8014b5:	c3                   	ret
+		return 0;
+  8014b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014bb:	eb f4                	jmp    8014b1 <strncmp+0x2f>
+
+008014bd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8014bd:	55                   	push   %ebp
+  8014be:	89 e5                	mov    %esp,%ebp
+  8014c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8014c7:	eb 03                	jmp    8014cc <strchr+0xf>
+  8014c9:	83 c0 01             	add    $0x1,%eax
+  8014cc:	0f b6 10             	movzbl (%eax),%edx
+  8014cf:	84 d2                	test   %dl,%dl
+  8014d1:	74 06                	je     8014d9 <strchr+0x1c>
+		if (*s == c)
+  8014d3:	38 ca                	cmp    %cl,%dl
+  8014d5:	75 f2                	jne    8014c9 <strchr+0xc>
+  8014d7:	eb 05                	jmp    8014de <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8014d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014de:	5d                   	pop    %ebp
+  8014df:	c3                   	ret
+
+008014e0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8014e0:	55                   	push   %ebp
+  8014e1:	89 e5                	mov    %esp,%ebp
+  8014e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8014ea:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8014ed:	38 ca                	cmp    %cl,%dl
+  8014ef:	74 09                	je     8014fa <strfind+0x1a>
+  8014f1:	84 d2                	test   %dl,%dl
+  8014f3:	74 05                	je     8014fa <strfind+0x1a>
+	for (; *s; s++)
+  8014f5:	83 c0 01             	add    $0x1,%eax
+  8014f8:	eb f0                	jmp    8014ea <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8014fa:	5d                   	pop    %ebp
+  8014fb:	c3                   	ret
+
+008014fc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8014fc:	55                   	push   %ebp
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	57                   	push   %edi
+  801500:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801503:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  801506:	85 c9                	test   %ecx,%ecx
+  801508:	74 20                	je     80152a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80150a:	89 f8                	mov    %edi,%eax
+  80150c:	09 c8                	or     %ecx,%eax
+  80150e:	a8 03                	test   $0x3,%al
+  801510:	75 12                	jne    801524 <memset+0x28>
+		c &= 0xFF;
+  801512:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801516:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80151c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  80151f:	fc                   	cld
+  801520:	f3 ab                	rep stos %eax,%es:(%edi)
+  801522:	eb 06                	jmp    80152a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801524:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801527:	fc                   	cld
+  801528:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80152a:	89 f8                	mov    %edi,%eax
+  80152c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80152f:	c9                   	leave
+  801530:	c3                   	ret
+
+00801531 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	8b 45 08             	mov    0x8(%ebp),%eax
+  801539:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80153c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80153f:	39 c6                	cmp    %eax,%esi
+  801541:	73 32                	jae    801575 <memmove+0x44>
+  801543:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801546:	39 d0                	cmp    %edx,%eax
+  801548:	73 2b                	jae    801575 <memmove+0x44>
+		s += n;
+		d += n;
+  80154a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80154d:	89 d6                	mov    %edx,%esi
+  80154f:	09 fe                	or     %edi,%esi
+  801551:	09 ce                	or     %ecx,%esi
+  801553:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801559:	75 0e                	jne    801569 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80155b:	83 ef 04             	sub    $0x4,%edi
+  80155e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801561:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801564:	fd                   	std
+  801565:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801567:	eb 09                	jmp    801572 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801569:	83 ef 01             	sub    $0x1,%edi
+  80156c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80156f:	fd                   	std
+  801570:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801572:	fc                   	cld
+  801573:	eb 1a                	jmp    80158f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801575:	89 f2                	mov    %esi,%edx
+  801577:	09 c2                	or     %eax,%edx
+  801579:	09 ca                	or     %ecx,%edx
+  80157b:	f6 c2 03             	test   $0x3,%dl
+  80157e:	75 0a                	jne    80158a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801580:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801583:	89 c7                	mov    %eax,%edi
+  801585:	fc                   	cld
+  801586:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801588:	eb 05                	jmp    80158f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80158a:	89 c7                	mov    %eax,%edi
+  80158c:	fc                   	cld
+  80158d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80158f:	5e                   	pop    %esi
+  801590:	5f                   	pop    %edi
+  801591:	5d                   	pop    %ebp
+  801592:	c3                   	ret
+
+00801593 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801599:	ff 75 10             	push   0x10(%ebp)
+  80159c:	ff 75 0c             	push   0xc(%ebp)
+  80159f:	ff 75 08             	push   0x8(%ebp)
+  8015a2:	e8 8a ff ff ff       	call   801531 <memmove>
+}
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+008015a9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	56                   	push   %esi
+  8015ad:	53                   	push   %ebx
+  8015ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8015b4:	89 c6                	mov    %eax,%esi
+  8015b6:	03 75 10             	add    0x10(%ebp),%esi
+  8015b9:	eb 06                	jmp    8015c1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8015bb:	83 c0 01             	add    $0x1,%eax
+  8015be:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8015c1:	39 f0                	cmp    %esi,%eax
+  8015c3:	74 14                	je     8015d9 <memcmp+0x30>
+		if (*s1 != *s2)
+  8015c5:	0f b6 08             	movzbl (%eax),%ecx
+  8015c8:	0f b6 1a             	movzbl (%edx),%ebx
+  8015cb:	38 d9                	cmp    %bl,%cl
+  8015cd:	74 ec                	je     8015bb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8015cf:	0f b6 c1             	movzbl %cl,%eax
+  8015d2:	0f b6 db             	movzbl %bl,%ebx
+  8015d5:	29 d8                	sub    %ebx,%eax
+  8015d7:	eb 05                	jmp    8015de <memcmp+0x35>
+	}
+
+	return 0;
+  8015d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015de:	5b                   	pop    %ebx
+  8015df:	5e                   	pop    %esi
+  8015e0:	5d                   	pop    %ebp
+  8015e1:	c3                   	ret
+
+008015e2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8015eb:	89 c2                	mov    %eax,%edx
+  8015ed:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8015f0:	eb 03                	jmp    8015f5 <memfind+0x13>
+  8015f2:	83 c0 01             	add    $0x1,%eax
+  8015f5:	39 d0                	cmp    %edx,%eax
+  8015f7:	73 04                	jae    8015fd <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8015f9:	38 08                	cmp    %cl,(%eax)
+  8015fb:	75 f5                	jne    8015f2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8015fd:	5d                   	pop    %ebp
+  8015fe:	c3                   	ret
+
+008015ff <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+  801602:	57                   	push   %edi
+  801603:	56                   	push   %esi
+  801604:	53                   	push   %ebx
+  801605:	83 ec 1c             	sub    $0x1c,%esp
+  801608:	8b 75 08             	mov    0x8(%ebp),%esi
+  80160b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80160e:	eb 03                	jmp    801613 <strtol+0x14>
+		s++;
+  801610:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  801613:	0f b6 06             	movzbl (%esi),%eax
+  801616:	3c 20                	cmp    $0x20,%al
+  801618:	74 f6                	je     801610 <strtol+0x11>
+  80161a:	3c 09                	cmp    $0x9,%al
+  80161c:	74 f2                	je     801610 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  80161e:	3c 2b                	cmp    $0x2b,%al
+  801620:	74 43                	je     801665 <strtol+0x66>
+	int neg = 0;
+  801622:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  801627:	3c 2d                	cmp    $0x2d,%al
+  801629:	74 44                	je     80166f <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80162b:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  801631:	75 0f                	jne    801642 <strtol+0x43>
+  801633:	80 3e 30             	cmpb   $0x30,(%esi)
+  801636:	74 41                	je     801679 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801638:	85 ff                	test   %edi,%edi
+  80163a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80163f:	0f 44 f8             	cmove  %eax,%edi
+  801642:	b8 00 00 00 00       	mov    $0x0,%eax
+  801647:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  80164c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80164f:	89 fb                	mov    %edi,%ebx
+  801651:	c1 fb 1f             	sar    $0x1f,%ebx
+  801654:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  801657:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80165a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  80165d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  801660:	89 75 08             	mov    %esi,0x8(%ebp)
+  801663:	eb 67                	jmp    8016cc <strtol+0xcd>
+		s++;
+  801665:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  801668:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166d:	eb bc                	jmp    80162b <strtol+0x2c>
+		s++, neg = 1;
+  80166f:	83 c6 01             	add    $0x1,%esi
+  801672:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801677:	eb b2                	jmp    80162b <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801679:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  80167d:	74 0e                	je     80168d <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  80167f:	85 ff                	test   %edi,%edi
+  801681:	75 bf                	jne    801642 <strtol+0x43>
+		s++, base = 8;
+  801683:	83 c6 01             	add    $0x1,%esi
+  801686:	bf 08 00 00 00       	mov    $0x8,%edi
+  80168b:	eb b5                	jmp    801642 <strtol+0x43>
+		s += 2, base = 16;
+  80168d:	83 c6 02             	add    $0x2,%esi
+  801690:	bf 10 00 00 00       	mov    $0x10,%edi
+  801695:	eb ab                	jmp    801642 <strtol+0x43>
+			dig = *s - '0';
+  801697:	0f be c9             	movsbl %cl,%ecx
+  80169a:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  80169d:	39 f9                	cmp    %edi,%ecx
+  80169f:	7d 59                	jge    8016fa <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  8016a1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8016a5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8016a8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8016ab:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  8016ae:	0f af d8             	imul   %eax,%ebx
+  8016b1:	0f af d7             	imul   %edi,%edx
+  8016b4:	01 d3                	add    %edx,%ebx
+  8016b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8016b9:	f7 e7                	mul    %edi
+  8016bb:	01 da                	add    %ebx,%edx
+  8016bd:	89 cb                	mov    %ecx,%ebx
+  8016bf:	c1 fb 1f             	sar    $0x1f,%ebx
+  8016c2:	01 c8                	add    %ecx,%eax
+  8016c4:	11 da                	adc    %ebx,%edx
+  8016c6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  8016c9:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  8016cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016cf:	0f b6 08             	movzbl (%eax),%ecx
+  8016d2:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  8016d5:	80 fb 09             	cmp    $0x9,%bl
+  8016d8:	76 bd                	jbe    801697 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  8016da:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  8016dd:	80 fb 19             	cmp    $0x19,%bl
+  8016e0:	77 08                	ja     8016ea <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  8016e2:	0f be c9             	movsbl %cl,%ecx
+  8016e5:	83 e9 57             	sub    $0x57,%ecx
+  8016e8:	eb b3                	jmp    80169d <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  8016ea:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  8016ed:	80 fb 19             	cmp    $0x19,%bl
+  8016f0:	77 08                	ja     8016fa <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  8016f2:	0f be c9             	movsbl %cl,%ecx
+  8016f5:	83 e9 37             	sub    $0x37,%ecx
+  8016f8:	eb a3                	jmp    80169d <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8016fa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8016fd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801700:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  801703:	8b 75 08             	mov    0x8(%ebp),%esi
+  801706:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80170a:	74 05                	je     801711 <strtol+0x112>
+		*endptr = (char *) s;
+  80170c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80170f:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  801711:	85 c9                	test   %ecx,%ecx
+  801713:	74 07                	je     80171c <strtol+0x11d>
+  801715:	f7 d8                	neg    %eax
+  801717:	83 d2 00             	adc    $0x0,%edx
+  80171a:	f7 da                	neg    %edx
+}
+  80171c:	83 c4 1c             	add    $0x1c,%esp
+  80171f:	5b                   	pop    %ebx
+  801720:	5e                   	pop    %esi
+  801721:	5f                   	pop    %edi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+
+00801724 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801724:	55                   	push   %ebp
+  801725:	89 e5                	mov    %esp,%ebp
+  801727:	57                   	push   %edi
+  801728:	56                   	push   %esi
+  801729:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80172a:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801731:	74 18                	je     80174b <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  801733:	b8 00 00 00 00       	mov    $0x0,%eax
+  801738:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173e:	89 c3                	mov    %eax,%ebx
+  801740:	89 c7                	mov    %eax,%edi
+  801742:	89 c6                	mov    %eax,%esi
+  801744:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801746:	5b                   	pop    %ebx
+  801747:	5e                   	pop    %esi
+  801748:	5f                   	pop    %edi
+  801749:	5d                   	pop    %ebp
+  80174a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80174b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801750:	8b 55 08             	mov    0x8(%ebp),%edx
+  801753:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801756:	89 c3                	mov    %eax,%ebx
+  801758:	89 c7                	mov    %eax,%edi
+  80175a:	55                   	push   %ebp
+  80175b:	89 e5                	mov    %esp,%ebp
+  80175d:	8d 35 65 17 80 00    	lea    0x801765,%esi
+  801763:	0f 34                	sysenter
+  801765:	5d                   	pop    %ebp
+		goto out;
+  801766:	eb de                	jmp    801746 <sys_cputs+0x22>
+
+00801768 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	57                   	push   %edi
+  80176c:	56                   	push   %esi
+  80176d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80176e:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801775:	74 19                	je     801790 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  801777:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801781:	89 d1                	mov    %edx,%ecx
+  801783:	89 d3                	mov    %edx,%ebx
+  801785:	89 d7                	mov    %edx,%edi
+  801787:	89 d6                	mov    %edx,%esi
+  801789:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80178b:	5b                   	pop    %ebx
+  80178c:	5e                   	pop    %esi
+  80178d:	5f                   	pop    %edi
+  80178e:	5d                   	pop    %ebp
+  80178f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801790:	ba 00 00 00 00       	mov    $0x0,%edx
+  801795:	b8 01 00 00 00       	mov    $0x1,%eax
+  80179a:	89 d1                	mov    %edx,%ecx
+  80179c:	89 d3                	mov    %edx,%ebx
+  80179e:	89 d7                	mov    %edx,%edi
+  8017a0:	55                   	push   %ebp
+  8017a1:	89 e5                	mov    %esp,%ebp
+  8017a3:	8d 35 ab 17 80 00    	lea    0x8017ab,%esi
+  8017a9:	0f 34                	sysenter
+  8017ab:	5d                   	pop    %ebp
+		goto out;
+  8017ac:	eb dd                	jmp    80178b <sys_cgetc+0x23>
+
+008017ae <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	57                   	push   %edi
+  8017b2:	56                   	push   %esi
+  8017b3:	53                   	push   %ebx
+  8017b4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017b7:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  8017be:	74 21                	je     8017e1 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  8017c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017c5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8017ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cd:	89 cb                	mov    %ecx,%ebx
+  8017cf:	89 cf                	mov    %ecx,%edi
+  8017d1:	89 ce                	mov    %ecx,%esi
+  8017d3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017d5:	85 c0                	test   %eax,%eax
+  8017d7:	7f 27                	jg     801800 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8017d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017dc:	5b                   	pop    %ebx
+  8017dd:	5e                   	pop    %esi
+  8017de:	5f                   	pop    %edi
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017e9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8017ee:	89 cb                	mov    %ecx,%ebx
+  8017f0:	89 cf                	mov    %ecx,%edi
+  8017f2:	55                   	push   %ebp
+  8017f3:	89 e5                	mov    %esp,%ebp
+  8017f5:	8d 35 fd 17 80 00    	lea    0x8017fd,%esi
+  8017fb:	0f 34                	sysenter
+  8017fd:	5d                   	pop    %ebp
+		goto out;
+  8017fe:	eb d5                	jmp    8017d5 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801800:	83 ec 0c             	sub    $0xc,%esp
+  801803:	50                   	push   %eax
+  801804:	6a 03                	push   $0x3
+  801806:	68 7b 4c 80 00       	push   $0x804c7b
+  80180b:	6a 3f                	push   $0x3f
+  80180d:	68 98 4c 80 00       	push   $0x804c98
+  801812:	e8 81 f3 ff ff       	call   800b98 <_panic>
+
+00801817 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	57                   	push   %edi
+  80181b:	56                   	push   %esi
+  80181c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80181d:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801824:	74 19                	je     80183f <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  801826:	ba 00 00 00 00       	mov    $0x0,%edx
+  80182b:	b8 02 00 00 00       	mov    $0x2,%eax
+  801830:	89 d1                	mov    %edx,%ecx
+  801832:	89 d3                	mov    %edx,%ebx
+  801834:	89 d7                	mov    %edx,%edi
+  801836:	89 d6                	mov    %edx,%esi
+  801838:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80183a:	5b                   	pop    %ebx
+  80183b:	5e                   	pop    %esi
+  80183c:	5f                   	pop    %edi
+  80183d:	5d                   	pop    %ebp
+  80183e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80183f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801844:	b8 02 00 00 00       	mov    $0x2,%eax
+  801849:	89 d1                	mov    %edx,%ecx
+  80184b:	89 d3                	mov    %edx,%ebx
+  80184d:	89 d7                	mov    %edx,%edi
+  80184f:	55                   	push   %ebp
+  801850:	89 e5                	mov    %esp,%ebp
+  801852:	8d 35 5a 18 80 00    	lea    0x80185a,%esi
+  801858:	0f 34                	sysenter
+  80185a:	5d                   	pop    %ebp
+		goto out;
+  80185b:	eb dd                	jmp    80183a <sys_getenvid+0x23>
+
+0080185d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80185d:	55                   	push   %ebp
+  80185e:	89 e5                	mov    %esp,%ebp
+  801860:	57                   	push   %edi
+  801861:	56                   	push   %esi
+  801862:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801863:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  80186a:	74 19                	je     801885 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  80186c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801871:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801876:	89 d1                	mov    %edx,%ecx
+  801878:	89 d3                	mov    %edx,%ebx
+  80187a:	89 d7                	mov    %edx,%edi
+  80187c:	89 d6                	mov    %edx,%esi
+  80187e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801880:	5b                   	pop    %ebx
+  801881:	5e                   	pop    %esi
+  801882:	5f                   	pop    %edi
+  801883:	5d                   	pop    %ebp
+  801884:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801885:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80188f:	89 d1                	mov    %edx,%ecx
+  801891:	89 d3                	mov    %edx,%ebx
+  801893:	89 d7                	mov    %edx,%edi
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  801898:	8d 35 a0 18 80 00    	lea    0x8018a0,%esi
+  80189e:	0f 34                	sysenter
+  8018a0:	5d                   	pop    %ebp
+		goto out;
+  8018a1:	eb dd                	jmp    801880 <sys_yield+0x23>
+
+008018a3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+  8018a6:	57                   	push   %edi
+  8018a7:	56                   	push   %esi
+  8018a8:	53                   	push   %ebx
+  8018a9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8018ac:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  8018b3:	74 23                	je     8018d8 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  8018b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ba:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018c8:	89 f7                	mov    %esi,%edi
+  8018ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	7f 29                	jg     8018f9 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8018d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d3:	5b                   	pop    %ebx
+  8018d4:	5e                   	pop    %esi
+  8018d5:	5f                   	pop    %edi
+  8018d6:	5d                   	pop    %ebp
+  8018d7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018de:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018eb:	55                   	push   %ebp
+  8018ec:	89 e5                	mov    %esp,%ebp
+  8018ee:	8d 35 f6 18 80 00    	lea    0x8018f6,%esi
+  8018f4:	0f 34                	sysenter
+  8018f6:	5d                   	pop    %ebp
+		goto out;
+  8018f7:	eb d3                	jmp    8018cc <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018f9:	83 ec 0c             	sub    $0xc,%esp
+  8018fc:	50                   	push   %eax
+  8018fd:	6a 04                	push   $0x4
+  8018ff:	68 7b 4c 80 00       	push   $0x804c7b
+  801904:	6a 3f                	push   $0x3f
+  801906:	68 98 4c 80 00       	push   $0x804c98
+  80190b:	e8 88 f2 ff ff       	call   800b98 <_panic>
+
+00801910 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801910:	55                   	push   %ebp
+  801911:	89 e5                	mov    %esp,%ebp
+  801913:	57                   	push   %edi
+  801914:	56                   	push   %esi
+  801915:	53                   	push   %ebx
+  801916:	83 ec 0c             	sub    $0xc,%esp
+  801919:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  80191c:	85 f6                	test   %esi,%esi
+  80191e:	75 09                	jne    801929 <sys_page_map+0x19>
+  801920:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801927:	74 1f                	je     801948 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  801929:	b8 05 00 00 00       	mov    $0x5,%eax
+  80192e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801931:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801934:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801937:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80193a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	7f 27                	jg     801967 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801943:	5b                   	pop    %ebx
+  801944:	5e                   	pop    %esi
+  801945:	5f                   	pop    %edi
+  801946:	5d                   	pop    %ebp
+  801947:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801948:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801953:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801956:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801959:	55                   	push   %ebp
+  80195a:	89 e5                	mov    %esp,%ebp
+  80195c:	8d 35 64 19 80 00    	lea    0x801964,%esi
+  801962:	0f 34                	sysenter
+  801964:	5d                   	pop    %ebp
+		goto out;
+  801965:	eb d5                	jmp    80193c <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801967:	83 ec 0c             	sub    $0xc,%esp
+  80196a:	50                   	push   %eax
+  80196b:	6a 05                	push   $0x5
+  80196d:	68 7b 4c 80 00       	push   $0x804c7b
+  801972:	6a 3f                	push   $0x3f
+  801974:	68 98 4c 80 00       	push   $0x804c98
+  801979:	e8 1a f2 ff ff       	call   800b98 <_panic>
+
+0080197e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	57                   	push   %edi
+  801982:	56                   	push   %esi
+  801983:	53                   	push   %ebx
+  801984:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801987:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  80198e:	74 22                	je     8019b2 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801990:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801995:	b8 06 00 00 00       	mov    $0x6,%eax
+  80199a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a0:	89 df                	mov    %ebx,%edi
+  8019a2:	89 de                	mov    %ebx,%esi
+  8019a4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	7f 28                	jg     8019d2 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8019aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ad:	5b                   	pop    %ebx
+  8019ae:	5e                   	pop    %esi
+  8019af:	5f                   	pop    %edi
+  8019b0:	5d                   	pop    %ebp
+  8019b1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019bd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019c2:	89 df                	mov    %ebx,%edi
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	8d 35 cf 19 80 00    	lea    0x8019cf,%esi
+  8019cd:	0f 34                	sysenter
+  8019cf:	5d                   	pop    %ebp
+		goto out;
+  8019d0:	eb d4                	jmp    8019a6 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019d2:	83 ec 0c             	sub    $0xc,%esp
+  8019d5:	50                   	push   %eax
+  8019d6:	6a 06                	push   $0x6
+  8019d8:	68 7b 4c 80 00       	push   $0x804c7b
+  8019dd:	6a 3f                	push   $0x3f
+  8019df:	68 98 4c 80 00       	push   $0x804c98
+  8019e4:	e8 af f1 ff ff       	call   800b98 <_panic>
+
+008019e9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8019e9:	55                   	push   %ebp
+  8019ea:	89 e5                	mov    %esp,%ebp
+  8019ec:	57                   	push   %edi
+  8019ed:	56                   	push   %esi
+  8019ee:	53                   	push   %ebx
+  8019ef:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8019f2:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  8019f9:	74 22                	je     801a1d <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8019fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a00:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a05:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a0b:	89 df                	mov    %ebx,%edi
+  801a0d:	89 de                	mov    %ebx,%esi
+  801a0f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a11:	85 c0                	test   %eax,%eax
+  801a13:	7f 28                	jg     801a3d <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a18:	5b                   	pop    %ebx
+  801a19:	5e                   	pop    %esi
+  801a1a:	5f                   	pop    %edi
+  801a1b:	5d                   	pop    %ebp
+  801a1c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a22:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a28:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a2d:	89 df                	mov    %ebx,%edi
+  801a2f:	55                   	push   %ebp
+  801a30:	89 e5                	mov    %esp,%ebp
+  801a32:	8d 35 3a 1a 80 00    	lea    0x801a3a,%esi
+  801a38:	0f 34                	sysenter
+  801a3a:	5d                   	pop    %ebp
+		goto out;
+  801a3b:	eb d4                	jmp    801a11 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a3d:	83 ec 0c             	sub    $0xc,%esp
+  801a40:	50                   	push   %eax
+  801a41:	6a 08                	push   $0x8
+  801a43:	68 7b 4c 80 00       	push   $0x804c7b
+  801a48:	6a 3f                	push   $0x3f
+  801a4a:	68 98 4c 80 00       	push   $0x804c98
+  801a4f:	e8 44 f1 ff ff       	call   800b98 <_panic>
+
+00801a54 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801a54:	55                   	push   %ebp
+  801a55:	89 e5                	mov    %esp,%ebp
+  801a57:	57                   	push   %edi
+  801a58:	56                   	push   %esi
+  801a59:	53                   	push   %ebx
+  801a5a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801a5d:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801a64:	74 22                	je     801a88 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801a66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a70:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a76:	89 df                	mov    %ebx,%edi
+  801a78:	89 de                	mov    %ebx,%esi
+  801a7a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	7f 28                	jg     801aa8 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801a80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a83:	5b                   	pop    %ebx
+  801a84:	5e                   	pop    %esi
+  801a85:	5f                   	pop    %edi
+  801a86:	5d                   	pop    %ebp
+  801a87:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a93:	b8 09 00 00 00       	mov    $0x9,%eax
+  801a98:	89 df                	mov    %ebx,%edi
+  801a9a:	55                   	push   %ebp
+  801a9b:	89 e5                	mov    %esp,%ebp
+  801a9d:	8d 35 a5 1a 80 00    	lea    0x801aa5,%esi
+  801aa3:	0f 34                	sysenter
+  801aa5:	5d                   	pop    %ebp
+		goto out;
+  801aa6:	eb d4                	jmp    801a7c <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801aa8:	83 ec 0c             	sub    $0xc,%esp
+  801aab:	50                   	push   %eax
+  801aac:	6a 09                	push   $0x9
+  801aae:	68 7b 4c 80 00       	push   $0x804c7b
+  801ab3:	6a 3f                	push   $0x3f
+  801ab5:	68 98 4c 80 00       	push   $0x804c98
+  801aba:	e8 d9 f0 ff ff       	call   800b98 <_panic>
+
+00801abf <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801abf:	55                   	push   %ebp
+  801ac0:	89 e5                	mov    %esp,%ebp
+  801ac2:	57                   	push   %edi
+  801ac3:	56                   	push   %esi
+  801ac4:	53                   	push   %ebx
+  801ac5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801ac8:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801acf:	74 22                	je     801af3 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801ad1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801adb:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ade:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ae1:	89 df                	mov    %ebx,%edi
+  801ae3:	89 de                	mov    %ebx,%esi
+  801ae5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ae7:	85 c0                	test   %eax,%eax
+  801ae9:	7f 28                	jg     801b13 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801aeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aee:	5b                   	pop    %ebx
+  801aef:	5e                   	pop    %esi
+  801af0:	5f                   	pop    %edi
+  801af1:	5d                   	pop    %ebp
+  801af2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801af3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801afb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801afe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b03:	89 df                	mov    %ebx,%edi
+  801b05:	55                   	push   %ebp
+  801b06:	89 e5                	mov    %esp,%ebp
+  801b08:	8d 35 10 1b 80 00    	lea    0x801b10,%esi
+  801b0e:	0f 34                	sysenter
+  801b10:	5d                   	pop    %ebp
+		goto out;
+  801b11:	eb d4                	jmp    801ae7 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b13:	83 ec 0c             	sub    $0xc,%esp
+  801b16:	50                   	push   %eax
+  801b17:	6a 0a                	push   $0xa
+  801b19:	68 7b 4c 80 00       	push   $0x804c7b
+  801b1e:	6a 3f                	push   $0x3f
+  801b20:	68 98 4c 80 00       	push   $0x804c98
+  801b25:	e8 6e f0 ff ff       	call   800b98 <_panic>
+
+00801b2a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801b2a:	55                   	push   %ebp
+  801b2b:	89 e5                	mov    %esp,%ebp
+  801b2d:	57                   	push   %edi
+  801b2e:	56                   	push   %esi
+  801b2f:	53                   	push   %ebx
+  801b30:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801b33:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801b3a:	74 22                	je     801b5e <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801b3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b41:	b8 17 00 00 00       	mov    $0x17,%eax
+  801b46:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b4c:	89 df                	mov    %ebx,%edi
+  801b4e:	89 de                	mov    %ebx,%esi
+  801b50:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	7f 28                	jg     801b7e <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801b56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b59:	5b                   	pop    %ebx
+  801b5a:	5e                   	pop    %esi
+  801b5b:	5f                   	pop    %edi
+  801b5c:	5d                   	pop    %ebp
+  801b5d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b63:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b69:	b8 17 00 00 00       	mov    $0x17,%eax
+  801b6e:	89 df                	mov    %ebx,%edi
+  801b70:	55                   	push   %ebp
+  801b71:	89 e5                	mov    %esp,%ebp
+  801b73:	8d 35 7b 1b 80 00    	lea    0x801b7b,%esi
+  801b79:	0f 34                	sysenter
+  801b7b:	5d                   	pop    %ebp
+		goto out;
+  801b7c:	eb d4                	jmp    801b52 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b7e:	83 ec 0c             	sub    $0xc,%esp
+  801b81:	50                   	push   %eax
+  801b82:	6a 17                	push   $0x17
+  801b84:	68 7b 4c 80 00       	push   $0x804c7b
+  801b89:	6a 3f                	push   $0x3f
+  801b8b:	68 98 4c 80 00       	push   $0x804c98
+  801b90:	e8 03 f0 ff ff       	call   800b98 <_panic>
+
+00801b95 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801b95:	55                   	push   %ebp
+  801b96:	89 e5                	mov    %esp,%ebp
+  801b98:	57                   	push   %edi
+  801b99:	56                   	push   %esi
+  801b9a:	53                   	push   %ebx
+  801b9b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801b9e:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801ba5:	74 22                	je     801bc9 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801ba7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bac:	b8 18 00 00 00       	mov    $0x18,%eax
+  801bb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bb7:	89 df                	mov    %ebx,%edi
+  801bb9:	89 de                	mov    %ebx,%esi
+  801bbb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	7f 28                	jg     801be9 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801bc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bc4:	5b                   	pop    %ebx
+  801bc5:	5e                   	pop    %esi
+  801bc6:	5f                   	pop    %edi
+  801bc7:	5d                   	pop    %ebp
+  801bc8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801bc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bce:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bd4:	b8 18 00 00 00       	mov    $0x18,%eax
+  801bd9:	89 df                	mov    %ebx,%edi
+  801bdb:	55                   	push   %ebp
+  801bdc:	89 e5                	mov    %esp,%ebp
+  801bde:	8d 35 e6 1b 80 00    	lea    0x801be6,%esi
+  801be4:	0f 34                	sysenter
+  801be6:	5d                   	pop    %ebp
+		goto out;
+  801be7:	eb d4                	jmp    801bbd <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801be9:	83 ec 0c             	sub    $0xc,%esp
+  801bec:	50                   	push   %eax
+  801bed:	6a 18                	push   $0x18
+  801bef:	68 7b 4c 80 00       	push   $0x804c7b
+  801bf4:	6a 3f                	push   $0x3f
+  801bf6:	68 98 4c 80 00       	push   $0x804c98
+  801bfb:	e8 98 ef ff ff       	call   800b98 <_panic>
+
+00801c00 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	57                   	push   %edi
+  801c04:	56                   	push   %esi
+  801c05:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801c06:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801c0d:	74 1d                	je     801c2c <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801c0f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c14:	be 00 00 00 00       	mov    $0x0,%esi
+  801c19:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c22:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c25:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801c27:	5b                   	pop    %ebx
+  801c28:	5e                   	pop    %esi
+  801c29:	5f                   	pop    %edi
+  801c2a:	5d                   	pop    %ebp
+  801c2b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c32:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801c3a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801c3d:	55                   	push   %ebp
+  801c3e:	89 e5                	mov    %esp,%ebp
+  801c40:	8d 35 48 1c 80 00    	lea    0x801c48,%esi
+  801c46:	0f 34                	sysenter
+  801c48:	5d                   	pop    %ebp
+		goto out;
+  801c49:	eb dc                	jmp    801c27 <sys_ipc_try_send+0x27>
+
+00801c4b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801c4b:	55                   	push   %ebp
+  801c4c:	89 e5                	mov    %esp,%ebp
+  801c4e:	57                   	push   %edi
+  801c4f:	56                   	push   %esi
+  801c50:	53                   	push   %ebx
+  801c51:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801c54:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801c5b:	74 21                	je     801c7e <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801c5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c62:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c67:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c6a:	89 cb                	mov    %ecx,%ebx
+  801c6c:	89 cf                	mov    %ecx,%edi
+  801c6e:	89 ce                	mov    %ecx,%esi
+  801c70:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801c72:	85 c0                	test   %eax,%eax
+  801c74:	7f 27                	jg     801c9d <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801c76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c79:	5b                   	pop    %ebx
+  801c7a:	5e                   	pop    %esi
+  801c7b:	5f                   	pop    %edi
+  801c7c:	5d                   	pop    %ebp
+  801c7d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c86:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c8b:	89 cb                	mov    %ecx,%ebx
+  801c8d:	89 cf                	mov    %ecx,%edi
+  801c8f:	55                   	push   %ebp
+  801c90:	89 e5                	mov    %esp,%ebp
+  801c92:	8d 35 9a 1c 80 00    	lea    0x801c9a,%esi
+  801c98:	0f 34                	sysenter
+  801c9a:	5d                   	pop    %ebp
+		goto out;
+  801c9b:	eb d5                	jmp    801c72 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c9d:	83 ec 0c             	sub    $0xc,%esp
+  801ca0:	50                   	push   %eax
+  801ca1:	6a 0d                	push   $0xd
+  801ca3:	68 7b 4c 80 00       	push   $0x804c7b
+  801ca8:	6a 3f                	push   $0x3f
+  801caa:	68 98 4c 80 00       	push   $0x804c98
+  801caf:	e8 e4 ee ff ff       	call   800b98 <_panic>
+
+00801cb4 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801cb4:	55                   	push   %ebp
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	57                   	push   %edi
+  801cb8:	56                   	push   %esi
+  801cb9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801cba:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801cc1:	74 1b                	je     801cde <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801cc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801ccd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801cd3:	89 df                	mov    %ebx,%edi
+  801cd5:	89 de                	mov    %ebx,%esi
+  801cd7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801cd9:	5b                   	pop    %ebx
+  801cda:	5e                   	pop    %esi
+  801cdb:	5f                   	pop    %edi
+  801cdc:	5d                   	pop    %ebp
+  801cdd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801cde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ce6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ce9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801cee:	89 df                	mov    %ebx,%edi
+  801cf0:	55                   	push   %ebp
+  801cf1:	89 e5                	mov    %esp,%ebp
+  801cf3:	8d 35 fb 1c 80 00    	lea    0x801cfb,%esi
+  801cf9:	0f 34                	sysenter
+  801cfb:	5d                   	pop    %ebp
+		goto out;
+  801cfc:	eb db                	jmp    801cd9 <sys_ipc_recv_until+0x25>
+
+00801cfe <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	57                   	push   %edi
+  801d02:	56                   	push   %esi
+  801d03:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801d04:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801d0b:	74 19                	je     801d26 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d12:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d17:	89 d1                	mov    %edx,%ecx
+  801d19:	89 d3                	mov    %edx,%ebx
+  801d1b:	89 d7                	mov    %edx,%edi
+  801d1d:	89 d6                	mov    %edx,%esi
+  801d1f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801d21:	5b                   	pop    %ebx
+  801d22:	5e                   	pop    %esi
+  801d23:	5f                   	pop    %edi
+  801d24:	5d                   	pop    %ebp
+  801d25:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801d26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d30:	89 d1                	mov    %edx,%ecx
+  801d32:	89 d3                	mov    %edx,%ebx
+  801d34:	89 d7                	mov    %edx,%edi
+  801d36:	55                   	push   %ebp
+  801d37:	89 e5                	mov    %esp,%ebp
+  801d39:	8d 35 41 1d 80 00    	lea    0x801d41,%esi
+  801d3f:	0f 34                	sysenter
+  801d41:	5d                   	pop    %ebp
+		goto out;
+  801d42:	eb dd                	jmp    801d21 <sys_time_msec+0x23>
+
+00801d44 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	57                   	push   %edi
+  801d48:	56                   	push   %esi
+  801d49:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801d4a:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801d51:	74 1a                	je     801d6d <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801d53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d58:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d60:	89 cb                	mov    %ecx,%ebx
+  801d62:	89 cf                	mov    %ecx,%edi
+  801d64:	89 ce                	mov    %ecx,%esi
+  801d66:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801d68:	5b                   	pop    %ebx
+  801d69:	5e                   	pop    %esi
+  801d6a:	5f                   	pop    %edi
+  801d6b:	5d                   	pop    %ebp
+  801d6c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801d6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d75:	b8 10 00 00 00       	mov    $0x10,%eax
+  801d7a:	89 cb                	mov    %ecx,%ebx
+  801d7c:	89 cf                	mov    %ecx,%edi
+  801d7e:	55                   	push   %ebp
+  801d7f:	89 e5                	mov    %esp,%ebp
+  801d81:	8d 35 89 1d 80 00    	lea    0x801d89,%esi
+  801d87:	0f 34                	sysenter
+  801d89:	5d                   	pop    %ebp
+		goto out;
+  801d8a:	eb dc                	jmp    801d68 <sys_sleep_until+0x24>
+
+00801d8c <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	57                   	push   %edi
+  801d90:	56                   	push   %esi
+  801d91:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801d92:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801d99:	74 1a                	je     801db5 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801d9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801da0:	b8 11 00 00 00       	mov    $0x11,%eax
+  801da5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da8:	89 cb                	mov    %ecx,%ebx
+  801daa:	89 cf                	mov    %ecx,%edi
+  801dac:	89 ce                	mov    %ecx,%esi
+  801dae:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801db0:	5b                   	pop    %ebx
+  801db1:	5e                   	pop    %esi
+  801db2:	5f                   	pop    %edi
+  801db3:	5d                   	pop    %ebp
+  801db4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801db5:	8b 55 08             	mov    0x8(%ebp),%edx
+  801db8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dbd:	b8 11 00 00 00       	mov    $0x11,%eax
+  801dc2:	89 cb                	mov    %ecx,%ebx
+  801dc4:	89 cf                	mov    %ecx,%edi
+  801dc6:	55                   	push   %ebp
+  801dc7:	89 e5                	mov    %esp,%ebp
+  801dc9:	8d 35 d1 1d 80 00    	lea    0x801dd1,%esi
+  801dcf:	0f 34                	sysenter
+  801dd1:	5d                   	pop    %ebp
+		goto out;
+  801dd2:	eb dc                	jmp    801db0 <sys_env_print_stats+0x24>
+
+00801dd4 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801dd4:	55                   	push   %ebp
+  801dd5:	89 e5                	mov    %esp,%ebp
+  801dd7:	57                   	push   %edi
+  801dd8:	56                   	push   %esi
+  801dd9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801dda:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801de1:	74 1b                	je     801dfe <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801de3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801de8:	b8 19 00 00 00       	mov    $0x19,%eax
+  801ded:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801df3:	89 df                	mov    %ebx,%edi
+  801df5:	89 de                	mov    %ebx,%esi
+  801df7:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801df9:	5b                   	pop    %ebx
+  801dfa:	5e                   	pop    %esi
+  801dfb:	5f                   	pop    %edi
+  801dfc:	5d                   	pop    %ebp
+  801dfd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e03:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e09:	b8 19 00 00 00       	mov    $0x19,%eax
+  801e0e:	89 df                	mov    %ebx,%edi
+  801e10:	55                   	push   %ebp
+  801e11:	89 e5                	mov    %esp,%ebp
+  801e13:	8d 35 1b 1e 80 00    	lea    0x801e1b,%esi
+  801e19:	0f 34                	sysenter
+  801e1b:	5d                   	pop    %ebp
+		goto out;
+  801e1c:	eb db                	jmp    801df9 <sys_perf+0x25>
+
+00801e1e <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801e1e:	55                   	push   %ebp
+  801e1f:	89 e5                	mov    %esp,%ebp
+  801e21:	57                   	push   %edi
+  801e22:	56                   	push   %esi
+  801e23:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801e24:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801e2b:	74 19                	je     801e46 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801e2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e32:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801e37:	89 d1                	mov    %edx,%ecx
+  801e39:	89 d3                	mov    %edx,%ebx
+  801e3b:	89 d7                	mov    %edx,%edi
+  801e3d:	89 d6                	mov    %edx,%esi
+  801e3f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801e41:	5b                   	pop    %ebx
+  801e42:	5e                   	pop    %esi
+  801e43:	5f                   	pop    %edi
+  801e44:	5d                   	pop    %ebp
+  801e45:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801e50:	89 d1                	mov    %edx,%ecx
+  801e52:	89 d3                	mov    %edx,%ebx
+  801e54:	89 d7                	mov    %edx,%edi
+  801e56:	55                   	push   %ebp
+  801e57:	89 e5                	mov    %esp,%ebp
+  801e59:	8d 35 61 1e 80 00    	lea    0x801e61,%esi
+  801e5f:	0f 34                	sysenter
+  801e61:	5d                   	pop    %ebp
+		goto out;
+  801e62:	eb dd                	jmp    801e41 <sys_fork+0x23>
+
+00801e64 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	57                   	push   %edi
+  801e68:	56                   	push   %esi
+  801e69:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801e6a:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801e71:	74 1c                	je     801e8f <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801e73:	be 00 00 00 00       	mov    $0x0,%esi
+  801e78:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801e86:	89 f7                	mov    %esi,%edi
+  801e88:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801e8a:	5b                   	pop    %ebx
+  801e8b:	5e                   	pop    %esi
+  801e8c:	5f                   	pop    %edi
+  801e8d:	5d                   	pop    %ebp
+  801e8e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801e95:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801e9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ea2:	55                   	push   %ebp
+  801ea3:	89 e5                	mov    %esp,%ebp
+  801ea5:	8d 35 ad 1e 80 00    	lea    0x801ead,%esi
+  801eab:	0f 34                	sysenter
+  801ead:	5d                   	pop    %ebp
+		goto out;
+  801eae:	eb da                	jmp    801e8a <sys_thread_create+0x26>
+
+00801eb0 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801eb0:	55                   	push   %ebp
+  801eb1:	89 e5                	mov    %esp,%ebp
+  801eb3:	57                   	push   %edi
+  801eb4:	56                   	push   %esi
+  801eb5:	53                   	push   %ebx
+  801eb6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801eb9:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801ec0:	74 24                	je     801ee6 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801ec2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ecf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ed2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ed5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ed8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801eda:	85 c0                	test   %eax,%eax
+  801edc:	7f 27                	jg     801f05 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801ede:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee1:	5b                   	pop    %ebx
+  801ee2:	5e                   	pop    %esi
+  801ee3:	5f                   	pop    %edi
+  801ee4:	5d                   	pop    %ebp
+  801ee5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ee6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ee9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eec:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801ef1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801ef4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801ef7:	55                   	push   %ebp
+  801ef8:	89 e5                	mov    %esp,%ebp
+  801efa:	8d 35 02 1f 80 00    	lea    0x801f02,%esi
+  801f00:	0f 34                	sysenter
+  801f02:	5d                   	pop    %ebp
+		goto out;
+  801f03:	eb d5                	jmp    801eda <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f05:	83 ec 0c             	sub    $0xc,%esp
+  801f08:	50                   	push   %eax
+  801f09:	6a 1f                	push   $0x1f
+  801f0b:	68 7b 4c 80 00       	push   $0x804c7b
+  801f10:	6a 3f                	push   $0x3f
+  801f12:	68 98 4c 80 00       	push   $0x804c98
+  801f17:	e8 7c ec ff ff       	call   800b98 <_panic>
+
+00801f1c <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801f1c:	55                   	push   %ebp
+  801f1d:	89 e5                	mov    %esp,%ebp
+  801f1f:	57                   	push   %edi
+  801f20:	56                   	push   %esi
+  801f21:	53                   	push   %ebx
+  801f22:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801f25:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801f2c:	74 23                	je     801f51 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801f2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f33:	b8 20 00 00 00       	mov    $0x20,%eax
+  801f38:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f41:	89 f7                	mov    %esi,%edi
+  801f43:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801f45:	85 c0                	test   %eax,%eax
+  801f47:	7f 29                	jg     801f72 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801f49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f4c:	5b                   	pop    %ebx
+  801f4d:	5e                   	pop    %esi
+  801f4e:	5f                   	pop    %edi
+  801f4f:	5d                   	pop    %ebp
+  801f50:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801f51:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f57:	b8 20 00 00 00       	mov    $0x20,%eax
+  801f5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f64:	55                   	push   %ebp
+  801f65:	89 e5                	mov    %esp,%ebp
+  801f67:	8d 35 6f 1f 80 00    	lea    0x801f6f,%esi
+  801f6d:	0f 34                	sysenter
+  801f6f:	5d                   	pop    %ebp
+		goto out;
+  801f70:	eb d3                	jmp    801f45 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f72:	83 ec 0c             	sub    $0xc,%esp
+  801f75:	50                   	push   %eax
+  801f76:	6a 20                	push   $0x20
+  801f78:	68 7b 4c 80 00       	push   $0x804c7b
+  801f7d:	6a 3f                	push   $0x3f
+  801f7f:	68 98 4c 80 00       	push   $0x804c98
+  801f84:	e8 0f ec ff ff       	call   800b98 <_panic>
+
+00801f89 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801f89:	55                   	push   %ebp
+  801f8a:	89 e5                	mov    %esp,%ebp
+  801f8c:	57                   	push   %edi
+  801f8d:	56                   	push   %esi
+  801f8e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801f8f:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801f96:	74 1b                	je     801fb3 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f9d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fa8:	89 df                	mov    %ebx,%edi
+  801faa:	89 de                	mov    %ebx,%esi
+  801fac:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801fae:	5b                   	pop    %ebx
+  801faf:	5e                   	pop    %esi
+  801fb0:	5f                   	pop    %edi
+  801fb1:	5d                   	pop    %ebp
+  801fb2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fbe:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801fc3:	89 df                	mov    %ebx,%edi
+  801fc5:	55                   	push   %ebp
+  801fc6:	89 e5                	mov    %esp,%ebp
+  801fc8:	8d 35 d0 1f 80 00    	lea    0x801fd0,%esi
+  801fce:	0f 34                	sysenter
+  801fd0:	5d                   	pop    %ebp
+		goto out;
+  801fd1:	eb db                	jmp    801fae <sys_batch+0x25>
+
+00801fd3 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801fd3:	55                   	push   %ebp
+  801fd4:	89 e5                	mov    %esp,%ebp
+  801fd6:	57                   	push   %edi
+  801fd7:	56                   	push   %esi
+  801fd8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801fd9:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  801fe0:	74 1a                	je     801ffc <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801fe2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801fec:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fef:	89 cb                	mov    %ecx,%ebx
+  801ff1:	89 cf                	mov    %ecx,%edi
+  801ff3:	89 ce                	mov    %ecx,%esi
+  801ff5:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801ff7:	5b                   	pop    %ebx
+  801ff8:	5e                   	pop    %esi
+  801ff9:	5f                   	pop    %edi
+  801ffa:	5d                   	pop    %ebp
+  801ffb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ffc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802004:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  802009:	89 cb                	mov    %ecx,%ebx
+  80200b:	89 cf                	mov    %ecx,%edi
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	8d 35 18 20 80 00    	lea    0x802018,%esi
+  802016:	0f 34                	sysenter
+  802018:	5d                   	pop    %ebp
+		goto out;
+  802019:	eb dc                	jmp    801ff7 <sys_trace_ctl+0x24>
+
+0080201b <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	57                   	push   %edi
+  80201f:	56                   	push   %esi
+  802020:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802021:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  802028:	74 1c                	je     802046 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80202a:	be 00 00 00 00       	mov    $0x0,%esi
+  80202f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  802034:	8b 55 08             	mov    0x8(%ebp),%edx
+  802037:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80203a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80203d:	89 f7                	mov    %esi,%edi
+  80203f:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  802041:	5b                   	pop    %ebx
+  802042:	5e                   	pop    %esi
+  802043:	5f                   	pop    %edi
+  802044:	5d                   	pop    %ebp
+  802045:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802046:	8b 55 08             	mov    0x8(%ebp),%edx
+  802049:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80204c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  802051:	bf 00 00 00 00       	mov    $0x0,%edi
+  802056:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802059:	55                   	push   %ebp
+  80205a:	89 e5                	mov    %esp,%ebp
+  80205c:	8d 35 64 20 80 00    	lea    0x802064,%esi
+  802062:	0f 34                	sysenter
+  802064:	5d                   	pop    %ebp
+		goto out;
+  802065:	eb da                	jmp    802041 <sys_trace_read+0x26>
+
+00802067 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  802067:	55                   	push   %ebp
+  802068:	89 e5                	mov    %esp,%ebp
+  80206a:	57                   	push   %edi
+  80206b:	56                   	push   %esi
+  80206c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80206d:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  802074:	74 1c                	je     802092 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  802076:	be 00 00 00 00       	mov    $0x0,%esi
+  80207b:	b8 21 00 00 00       	mov    $0x21,%eax
+  802080:	8b 55 08             	mov    0x8(%ebp),%edx
+  802083:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802086:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802089:	89 f7                	mov    %esi,%edi
+  80208b:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80208d:	5b                   	pop    %ebx
+  80208e:	5e                   	pop    %esi
+  80208f:	5f                   	pop    %edi
+  802090:	5d                   	pop    %ebp
+  802091:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802092:	8b 55 08             	mov    0x8(%ebp),%edx
+  802095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802098:	b8 21 00 00 00       	mov    $0x21,%eax
+  80209d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	8d 35 b0 20 80 00    	lea    0x8020b0,%esi
+  8020ae:	0f 34                	sysenter
+  8020b0:	5d                   	pop    %ebp
+		goto out;
+  8020b1:	eb da                	jmp    80208d <sys_meminfo+0x26>
+
+008020b3 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8020b3:	55                   	push   %ebp
+  8020b4:	89 e5                	mov    %esp,%ebp
+  8020b6:	57                   	push   %edi
+  8020b7:	56                   	push   %esi
+  8020b8:	53                   	push   %ebx
+  8020b9:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8020bc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8020c0:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  8020c7:	74 1f                	je     8020e8 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8020c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ce:	b8 22 00 00 00       	mov    $0x22,%eax
+  8020d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020d6:	89 df                	mov    %ebx,%edi
+  8020d8:	89 de                	mov    %ebx,%esi
+  8020da:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8020dc:	85 c0                	test   %eax,%eax
+  8020de:	7f 25                	jg     802105 <sys_env_set_ksm+0x52>
+}
+  8020e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e3:	5b                   	pop    %ebx
+  8020e4:	5e                   	pop    %esi
+  8020e5:	5f                   	pop    %edi
+  8020e6:	5d                   	pop    %ebp
+  8020e7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8020e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020f0:	b8 22 00 00 00       	mov    $0x22,%eax
+  8020f5:	89 df                	mov    %ebx,%edi
+  8020f7:	55                   	push   %ebp
+  8020f8:	89 e5                	mov    %esp,%ebp
+  8020fa:	8d 35 02 21 80 00    	lea    0x802102,%esi
+  802100:	0f 34                	sysenter
+  802102:	5d                   	pop    %ebp
+		goto out;
+  802103:	eb d7                	jmp    8020dc <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802105:	83 ec 0c             	sub    $0xc,%esp
+  802108:	50                   	push   %eax
+  802109:	6a 22                	push   $0x22
+  80210b:	68 7b 4c 80 00       	push   $0x804c7b
+  802110:	6a 3f                	push   $0x3f
+  802112:	68 98 4c 80 00       	push   $0x804c98
+  802117:	e8 7c ea ff ff       	call   800b98 <_panic>
+
+0080211c <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	57                   	push   %edi
+  802120:	56                   	push   %esi
+  802121:	53                   	push   %ebx
+  802122:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  802125:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  802128:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  80212f:	74 24                	je     802155 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  802131:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802136:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80213b:	89 cb                	mov    %ecx,%ebx
+  80213d:	89 cf                	mov    %ecx,%edi
+  80213f:	89 ce                	mov    %ecx,%esi
+  802141:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  802143:	85 c0                	test   %eax,%eax
+  802145:	7f 2a                	jg     802171 <sys_time_nsec+0x55>
+	return ns;
+}
+  802147:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80214a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80214d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802150:	5b                   	pop    %ebx
+  802151:	5e                   	pop    %esi
+  802152:	5f                   	pop    %edi
+  802153:	5d                   	pop    %ebp
+  802154:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802155:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80215a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80215f:	89 cb                	mov    %ecx,%ebx
+  802161:	89 cf                	mov    %ecx,%edi
+  802163:	55                   	push   %ebp
+  802164:	89 e5                	mov    %esp,%ebp
+  802166:	8d 35 6e 21 80 00    	lea    0x80216e,%esi
+  80216c:	0f 34                	sysenter
+  80216e:	5d                   	pop    %ebp
+		goto out;
+  80216f:	eb d2                	jmp    802143 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802171:	83 ec 0c             	sub    $0xc,%esp
+  802174:	50                   	push   %eax
+  802175:	6a 0f                	push   $0xf
+  802177:	68 7b 4c 80 00       	push   $0x804c7b
+  80217c:	6a 3f                	push   $0x3f
+  80217e:	68 98 4c 80 00       	push   $0x804c98
+  802183:	e8 10 ea ff ff       	call   800b98 <_panic>
+
+00802188 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  802188:	55                   	push   %ebp
+  802189:	89 e5                	mov    %esp,%ebp
+  80218b:	57                   	push   %edi
+  80218c:	56                   	push   %esi
+  80218d:	53                   	push   %ebx
+  80218e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  802191:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  802198:	74 22                	je     8021bc <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80219a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80219f:	b8 12 00 00 00       	mov    $0x12,%eax
+  8021a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021aa:	89 df                	mov    %ebx,%edi
+  8021ac:	89 de                	mov    %ebx,%esi
+  8021ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8021b0:	85 c0                	test   %eax,%eax
+  8021b2:	7f 28                	jg     8021dc <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8021b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b7:	5b                   	pop    %ebx
+  8021b8:	5e                   	pop    %esi
+  8021b9:	5f                   	pop    %edi
+  8021ba:	5d                   	pop    %ebp
+  8021bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8021bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021c7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8021cc:	89 df                	mov    %ebx,%edi
+  8021ce:	55                   	push   %ebp
+  8021cf:	89 e5                	mov    %esp,%ebp
+  8021d1:	8d 35 d9 21 80 00    	lea    0x8021d9,%esi
+  8021d7:	0f 34                	sysenter
+  8021d9:	5d                   	pop    %ebp
+		goto out;
+  8021da:	eb d4                	jmp    8021b0 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8021dc:	83 ec 0c             	sub    $0xc,%esp
+  8021df:	50                   	push   %eax
+  8021e0:	6a 12                	push   $0x12
+  8021e2:	68 7b 4c 80 00       	push   $0x804c7b
+  8021e7:	6a 3f                	push   $0x3f
+  8021e9:	68 98 4c 80 00       	push   $0x804c98
+  8021ee:	e8 a5 e9 ff ff       	call   800b98 <_panic>
+
+008021f3 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	57                   	push   %edi
+  8021f7:	56                   	push   %esi
+  8021f8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8021f9:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  802200:	74 1b                	je     80221d <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  802202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802207:	b8 13 00 00 00       	mov    $0x13,%eax
+  80220c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80220f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802212:	89 df                	mov    %ebx,%edi
+  802214:	89 de                	mov    %ebx,%esi
+  802216:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  802218:	5b                   	pop    %ebx
+  802219:	5e                   	pop    %esi
+  80221a:	5f                   	pop    %edi
+  80221b:	5d                   	pop    %ebp
+  80221c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80221d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802222:	8b 55 08             	mov    0x8(%ebp),%edx
+  802225:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802228:	b8 13 00 00 00       	mov    $0x13,%eax
+  80222d:	89 df                	mov    %ebx,%edi
+  80222f:	55                   	push   %ebp
+  802230:	89 e5                	mov    %esp,%ebp
+  802232:	8d 35 3a 22 80 00    	lea    0x80223a,%esi
+  802238:	0f 34                	sysenter
+  80223a:	5d                   	pop    %ebp
+		goto out;
+  80223b:	eb db                	jmp    802218 <sys_e1000_receive+0x25>
+
+0080223d <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80223d:	55                   	push   %ebp
+  80223e:	89 e5                	mov    %esp,%ebp
+  802240:	57                   	push   %edi
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  802243:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  80224a:	74 1b                	je     802267 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80224c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802251:	b8 14 00 00 00       	mov    $0x14,%eax
+  802256:	8b 55 08             	mov    0x8(%ebp),%edx
+  802259:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80225c:	89 df                	mov    %ebx,%edi
+  80225e:	89 de                	mov    %ebx,%esi
+  802260:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  802262:	5b                   	pop    %ebx
+  802263:	5e                   	pop    %esi
+  802264:	5f                   	pop    %edi
+  802265:	5d                   	pop    %ebp
+  802266:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  802267:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80226c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80226f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802272:	b8 14 00 00 00       	mov    $0x14,%eax
+  802277:	89 df                	mov    %ebx,%edi
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	8d 35 84 22 80 00    	lea    0x802284,%esi
+  802282:	0f 34                	sysenter
+  802284:	5d                   	pop    %ebp
+		goto out;
+  802285:	eb db                	jmp    802262 <sys_e1000_read_hwaddr+0x25>
+
+00802287 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	57                   	push   %edi
+  80228b:	56                   	push   %esi
+  80228c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80228d:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  802294:	74 1a                	je     8022b0 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  802296:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80229b:	b8 15 00 00 00       	mov    $0x15,%eax
+  8022a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022a3:	89 cb                	mov    %ecx,%ebx
+  8022a5:	89 cf                	mov    %ecx,%edi
+  8022a7:	89 ce                	mov    %ecx,%esi
+  8022a9:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8022ab:	5b                   	pop    %ebx
+  8022ac:	5e                   	pop    %esi
+  8022ad:	5f                   	pop    %edi
+  8022ae:	5d                   	pop    %ebp
+  8022af:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8022b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022b8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8022bd:	89 cb                	mov    %ecx,%ebx
+  8022bf:	89 cf                	mov    %ecx,%edi
+  8022c1:	55                   	push   %ebp
+  8022c2:	89 e5                	mov    %esp,%ebp
+  8022c4:	8d 35 cc 22 80 00    	lea    0x8022cc,%esi
+  8022ca:	0f 34                	sysenter
+  8022cc:	5d                   	pop    %ebp
+		goto out;
+  8022cd:	eb dc                	jmp    8022ab <sys_sb16_read_version+0x24>
+
+008022cf <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8022cf:	55                   	push   %ebp
+  8022d0:	89 e5                	mov    %esp,%ebp
+  8022d2:	57                   	push   %edi
+  8022d3:	56                   	push   %esi
+  8022d4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8022d5:	80 3d 2c 64 80 00 00 	cmpb   $0x0,0x80642c
+  8022dc:	74 1b                	je     8022f9 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8022de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022e3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8022e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ee:	89 df                	mov    %ebx,%edi
+  8022f0:	89 de                	mov    %ebx,%esi
+  8022f2:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8022f4:	5b                   	pop    %ebx
+  8022f5:	5e                   	pop    %esi
+  8022f6:	5f                   	pop    %edi
+  8022f7:	5d                   	pop    %ebp
+  8022f8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8022f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  802301:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802304:	b8 16 00 00 00       	mov    $0x16,%eax
+  802309:	89 df                	mov    %ebx,%edi
+  80230b:	55                   	push   %ebp
+  80230c:	89 e5                	mov    %esp,%ebp
+  80230e:	8d 35 16 23 80 00    	lea    0x802316,%esi
+  802314:	0f 34                	sysenter
+  802316:	5d                   	pop    %ebp
+		goto out;
+  802317:	eb db                	jmp    8022f4 <sys_sb16_play+0x25>
+
+00802319 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  802319:	55                   	push   %ebp
+  80231a:	89 e5                	mov    %esp,%ebp
+  80231c:	53                   	push   %ebx
+  80231d:	83 ec 04             	sub    $0x4,%esp
+  802320:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  802322:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802329:	f6 c4 04             	test   $0x4,%ah
+  80232c:	74 0c                	je     80233a <dupperm+0x21>
+  80232e:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  802335:	f6 c4 08             	test   $0x8,%ah
+  802338:	75 62                	jne    80239c <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80233a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  802341:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  802346:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80234c:	74 19                	je     802367 <dupperm+0x4e>
+  80234e:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  802355:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  80235a:	83 f8 01             	cmp    $0x1,%eax
+  80235d:	19 c0                	sbb    %eax,%eax
+  80235f:	25 00 08 00 00       	and    $0x800,%eax
+  802364:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  802367:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  80236e:	89 c1                	mov    %eax,%ecx
+  802370:	80 cd 04             	or     $0x4,%ch
+  802373:	f6 c7 04             	test   $0x4,%bh
+  802376:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  802379:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802380:	f6 c1 02             	test   $0x2,%cl
+  802383:	74 12                	je     802397 <dupperm+0x7e>
+  802385:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  80238c:	89 c2                	mov    %eax,%edx
+  80238e:	83 ca 02             	or     $0x2,%edx
+  802391:	f6 c5 04             	test   $0x4,%ch
+  802394:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  802397:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80239a:	c9                   	leave
+  80239b:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  80239c:	68 a8 4c 80 00       	push   $0x804ca8
+  8023a1:	68 31 48 80 00       	push   $0x804831
+  8023a6:	6a 39                	push   $0x39
+  8023a8:	68 40 4d 80 00       	push   $0x804d40
+  8023ad:	e8 e6 e7 ff ff       	call   800b98 <_panic>
+
+008023b2 <pgfault>:
+{
+  8023b2:	55                   	push   %ebp
+  8023b3:	89 e5                	mov    %esp,%ebp
+  8023b5:	53                   	push   %ebx
+  8023b6:	83 ec 04             	sub    $0x4,%esp
+  8023b9:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8023bc:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8023be:	89 c3                	mov    %eax,%ebx
+  8023c0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8023c6:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8023ca:	74 6d                	je     802439 <pgfault+0x87>
+  8023cc:	89 da                	mov    %ebx,%edx
+  8023ce:	c1 ea 16             	shr    $0x16,%edx
+  8023d1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8023d8:	f6 c2 80             	test   $0x80,%dl
+  8023db:	75 5c                	jne    802439 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8023dd:	c1 e8 0c             	shr    $0xc,%eax
+  8023e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8023e7:	f6 c4 08             	test   $0x8,%ah
+  8023ea:	74 4d                	je     802439 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8023ec:	83 ec 04             	sub    $0x4,%esp
+  8023ef:	6a 07                	push   $0x7
+  8023f1:	68 00 f0 7f 00       	push   $0x7ff000
+  8023f6:	6a 00                	push   $0x0
+  8023f8:	e8 a6 f4 ff ff       	call   8018a3 <sys_page_alloc>
+  8023fd:	83 c4 10             	add    $0x10,%esp
+  802400:	85 c0                	test   %eax,%eax
+  802402:	78 49                	js     80244d <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802404:	83 ec 04             	sub    $0x4,%esp
+  802407:	68 00 10 00 00       	push   $0x1000
+  80240c:	53                   	push   %ebx
+  80240d:	68 00 f0 7f 00       	push   $0x7ff000
+  802412:	e8 1a f1 ff ff       	call   801531 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  802417:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80241e:	53                   	push   %ebx
+  80241f:	6a 00                	push   $0x0
+  802421:	68 00 f0 7f 00       	push   $0x7ff000
+  802426:	6a 00                	push   $0x0
+  802428:	e8 e3 f4 ff ff       	call   801910 <sys_page_map>
+  80242d:	83 c4 20             	add    $0x20,%esp
+  802430:	85 c0                	test   %eax,%eax
+  802432:	78 2d                	js     802461 <pgfault+0xaf>
+}
+  802434:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802437:	c9                   	leave
+  802438:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  802439:	83 ec 04             	sub    $0x4,%esp
+  80243c:	68 4b 4d 80 00       	push   $0x804d4b
+  802441:	6a 1e                	push   $0x1e
+  802443:	68 40 4d 80 00       	push   $0x804d40
+  802448:	e8 4b e7 ff ff       	call   800b98 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  80244d:	83 ec 04             	sub    $0x4,%esp
+  802450:	68 dc 4c 80 00       	push   $0x804cdc
+  802455:	6a 29                	push   $0x29
+  802457:	68 40 4d 80 00       	push   $0x804d40
+  80245c:	e8 37 e7 ff ff       	call   800b98 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  802461:	50                   	push   %eax
+  802462:	68 10 4d 80 00       	push   $0x804d10
+  802467:	6a 2e                	push   $0x2e
+  802469:	68 40 4d 80 00       	push   $0x804d40
+  80246e:	e8 25 e7 ff ff       	call   800b98 <_panic>
+
+00802473 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  802473:	55                   	push   %ebp
+  802474:	89 e5                	mov    %esp,%ebp
+  802476:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  802479:	ff 75 0c             	push   0xc(%ebp)
+  80247c:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80247f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802486:	e8 23 f3 ff ff       	call   8017ae <sys_env_destroy>
+}
+  80248b:	83 c4 10             	add    $0x10,%esp
+  80248e:	c9                   	leave
+  80248f:	c3                   	ret
+
+00802490 <ufork>:
+{
+  802490:	55                   	push   %ebp
+  802491:	89 e5                	mov    %esp,%ebp
+  802493:	57                   	push   %edi
+  802494:	56                   	push   %esi
+  802495:	53                   	push   %ebx
+  802496:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80249c:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024a1:	cd 30                	int    $0x30
+  8024a3:	89 c6                	mov    %eax,%esi
+  8024a5:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  8024ab:	85 c0                	test   %eax,%eax
+  8024ad:	78 56                	js     802505 <ufork+0x75>
+	if (pid > 0) {
+  8024af:	0f 8e b3 02 00 00    	jle    802768 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  8024b5:	83 ec 0c             	sub    $0xc,%esp
+  8024b8:	68 b2 23 80 00       	push   $0x8023b2
+  8024bd:	e8 e3 1f 00 00       	call   8044a5 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  8024c2:	83 c4 08             	add    $0x8,%esp
+  8024c5:	68 0c 45 80 00       	push   $0x80450c
+  8024ca:	56                   	push   %esi
+  8024cb:	e8 ef f5 ff ff       	call   801abf <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  8024d0:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  8024d6:	89 1c 24             	mov    %ebx,(%esp)
+  8024d9:	e8 21 03 00 00       	call   8027ff <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  8024de:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8024e5:	6a 07                	push   $0x7
+  8024e7:	68 00 f0 bf ee       	push   $0xeebff000
+  8024ec:	56                   	push   %esi
+  8024ed:	53                   	push   %ebx
+  8024ee:	e8 8d 04 00 00       	call   802980 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  8024f3:	83 c4 20             	add    $0x20,%esp
+  8024f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024fb:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  802501:	89 fe                	mov    %edi,%esi
+  802503:	eb 22                	jmp    802527 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  802505:	50                   	push   %eax
+  802506:	68 64 4d 80 00       	push   $0x804d64
+  80250b:	68 a9 00 00 00       	push   $0xa9
+  802510:	68 40 4d 80 00       	push   $0x804d40
+  802515:	e8 7e e6 ff ff       	call   800b98 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  80251a:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  802520:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  802525:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  802527:	89 f7                	mov    %esi,%edi
+  802529:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  80252f:	0f 87 e9 01 00 00    	ja     80271e <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  802535:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  80253b:	85 f6                	test   %esi,%esi
+  80253d:	0f 49 d6             	cmovns %esi,%edx
+  802540:	c1 fa 0a             	sar    $0xa,%edx
+  802543:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  80254a:	f6 c1 01             	test   $0x1,%cl
+  80254d:	74 cb                	je     80251a <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  80254f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802556:	f6 c2 80             	test   $0x80,%dl
+  802559:	75 17                	jne    802572 <ufork+0xe2>
+			j = i + 1;
+  80255b:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  80255e:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  802565:	f6 c2 01             	test   $0x1,%dl
+  802568:	0f 85 f3 00 00 00    	jne    802661 <ufork+0x1d1>
+			j = i + 1;
+  80256e:	89 de                	mov    %ebx,%esi
+  802570:	eb b5                	jmp    802527 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  802572:	89 fb                	mov    %edi,%ebx
+  802574:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  802577:	89 d8                	mov    %ebx,%eax
+  802579:	c1 e8 16             	shr    $0x16,%eax
+  80257c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802583:	89 c2                	mov    %eax,%edx
+  802585:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  80258b:	25 02 04 00 00       	and    $0x402,%eax
+  802590:	83 f8 02             	cmp    $0x2,%eax
+  802593:	74 31                	je     8025c6 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  802595:	83 ec 04             	sub    $0x4,%esp
+  802598:	6a 01                	push   $0x1
+  80259a:	52                   	push   %edx
+  80259b:	53                   	push   %ebx
+  80259c:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  8025a2:	53                   	push   %ebx
+  8025a3:	6a 00                	push   $0x0
+  8025a5:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  8025ab:	50                   	push   %eax
+  8025ac:	e8 fa 03 00 00       	call   8029ab <batch_map>
+		return;
+  8025b1:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  8025b4:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  8025ba:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  8025bf:	89 c6                	mov    %eax,%esi
+				continue;
+  8025c1:	e9 61 ff ff ff       	jmp    802527 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  8025c6:	83 ec 04             	sub    $0x4,%esp
+  8025c9:	80 ca 80             	or     $0x80,%dl
+  8025cc:	52                   	push   %edx
+  8025cd:	53                   	push   %ebx
+  8025ce:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  8025d4:	e8 ca f2 ff ff       	call   8018a3 <sys_page_alloc>
+  8025d9:	83 c4 10             	add    $0x10,%esp
+  8025dc:	85 c0                	test   %eax,%eax
+  8025de:	78 5d                	js     80263d <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8025e0:	83 ec 0c             	sub    $0xc,%esp
+  8025e3:	6a 07                	push   $0x7
+  8025e5:	68 00 00 40 00       	push   $0x400000
+  8025ea:	6a 00                	push   $0x0
+  8025ec:	53                   	push   %ebx
+  8025ed:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  8025f3:	e8 18 f3 ff ff       	call   801910 <sys_page_map>
+  8025f8:	83 c4 20             	add    $0x20,%esp
+  8025fb:	85 c0                	test   %eax,%eax
+  8025fd:	78 50                	js     80264f <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  8025ff:	83 ec 04             	sub    $0x4,%esp
+  802602:	68 00 00 40 00       	push   $0x400000
+  802607:	53                   	push   %ebx
+  802608:	68 00 00 40 00       	push   $0x400000
+  80260d:	e8 1f ef ff ff       	call   801531 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802612:	83 c4 08             	add    $0x8,%esp
+  802615:	68 00 00 40 00       	push   $0x400000
+  80261a:	6a 00                	push   $0x0
+  80261c:	e8 5d f3 ff ff       	call   80197e <sys_page_unmap>
+  802621:	83 c4 10             	add    $0x10,%esp
+  802624:	85 c0                	test   %eax,%eax
+  802626:	79 8c                	jns    8025b4 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  802628:	50                   	push   %eax
+  802629:	68 98 4d 80 00       	push   $0x804d98
+  80262e:	68 81 00 00 00       	push   $0x81
+  802633:	68 40 4d 80 00       	push   $0x804d40
+  802638:	e8 5b e5 ff ff       	call   800b98 <_panic>
+		panic("sys_page_alloc: %e", r);
+  80263d:	50                   	push   %eax
+  80263e:	68 74 4d 80 00       	push   $0x804d74
+  802643:	6a 7c                	push   $0x7c
+  802645:	68 40 4d 80 00       	push   $0x804d40
+  80264a:	e8 49 e5 ff ff       	call   800b98 <_panic>
+		panic("sys_page_map: %e", r);
+  80264f:	50                   	push   %eax
+  802650:	68 87 4d 80 00       	push   $0x804d87
+  802655:	6a 7e                	push   $0x7e
+  802657:	68 40 4d 80 00       	push   $0x804d40
+  80265c:	e8 37 e5 ff ff       	call   800b98 <_panic>
+  802661:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  802667:	eb 22                	jmp    80268b <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  802669:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  802670:	a8 01                	test   $0x1,%al
+  802672:	74 35                	je     8026a9 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  802674:	89 d8                	mov    %ebx,%eax
+  802676:	e8 9e fc ff ff       	call   802319 <dupperm>
+  80267b:	89 c6                	mov    %eax,%esi
+  80267d:	89 f8                	mov    %edi,%eax
+  80267f:	e8 95 fc ff ff       	call   802319 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  802684:	39 c6                	cmp    %eax,%esi
+  802686:	75 21                	jne    8026a9 <ufork+0x219>
+				j++;
+  802688:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  80268b:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  802691:	74 16                	je     8026a9 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  802693:	89 d8                	mov    %ebx,%eax
+  802695:	c1 e8 0a             	shr    $0xa,%eax
+  802698:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80269f:	25 81 00 00 00       	and    $0x81,%eax
+  8026a4:	83 f8 01             	cmp    $0x1,%eax
+  8026a7:	74 c0                	je     802669 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  8026a9:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  8026af:	89 d8                	mov    %ebx,%eax
+  8026b1:	29 f0                	sub    %esi,%eax
+  8026b3:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  8026b9:	89 fe                	mov    %edi,%esi
+  8026bb:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  8026be:	89 f8                	mov    %edi,%eax
+  8026c0:	e8 54 fc ff ff       	call   802319 <dupperm>
+  8026c5:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  8026c7:	83 ec 08             	sub    $0x8,%esp
+  8026ca:	6a 02                	push   $0x2
+  8026cc:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  8026d2:	51                   	push   %ecx
+  8026d3:	e8 95 01 00 00       	call   80286d <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  8026d8:	83 c4 0c             	add    $0xc,%esp
+  8026db:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  8026e1:	57                   	push   %edi
+  8026e2:	56                   	push   %esi
+  8026e3:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  8026e9:	56                   	push   %esi
+  8026ea:	6a 00                	push   $0x0
+  8026ec:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  8026f2:	51                   	push   %ecx
+  8026f3:	e8 b3 02 00 00       	call   8029ab <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  8026f8:	83 c4 1c             	add    $0x1c,%esp
+  8026fb:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  802701:	57                   	push   %edi
+  802702:	56                   	push   %esi
+  802703:	6a 00                	push   $0x0
+  802705:	56                   	push   %esi
+  802706:	6a 00                	push   $0x0
+  802708:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  80270e:	50                   	push   %eax
+  80270f:	e8 97 02 00 00       	call   8029ab <batch_map>
+	return 0;
+  802714:	83 c4 20             	add    $0x20,%esp
+  802717:	89 de                	mov    %ebx,%esi
+  802719:	e9 09 fe ff ff       	jmp    802527 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  80271e:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  802724:	83 ec 04             	sub    $0x4,%esp
+  802727:	6a 02                	push   $0x2
+  802729:	56                   	push   %esi
+  80272a:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  802730:	53                   	push   %ebx
+  802731:	e8 c9 02 00 00       	call   8029ff <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  802736:	89 1c 24             	mov    %ebx,(%esp)
+  802739:	e8 dd 00 00 00       	call   80281b <batch_flush>
+  80273e:	83 c4 10             	add    $0x10,%esp
+  802741:	85 c0                	test   %eax,%eax
+  802743:	78 0e                	js     802753 <ufork+0x2c3>
+}
+  802745:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  80274b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274e:	5b                   	pop    %ebx
+  80274f:	5e                   	pop    %esi
+  802750:	5f                   	pop    %edi
+  802751:	5d                   	pop    %ebp
+  802752:	c3                   	ret
+			panic("fork: %e", r);
+  802753:	50                   	push   %eax
+  802754:	68 6b 4d 80 00       	push   $0x804d6b
+  802759:	68 d7 00 00 00       	push   $0xd7
+  80275e:	68 40 4d 80 00       	push   $0x804d40
+  802763:	e8 30 e4 ff ff       	call   800b98 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  802768:	e8 aa f0 ff ff       	call   801817 <sys_getenvid>
+  80276d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802772:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802778:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80277d:	a3 28 64 80 00       	mov    %eax,0x806428
+		return 0;
+  802782:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  802789:	00 00 00 
+  80278c:	eb b7                	jmp    802745 <ufork+0x2b5>
+
+0080278e <fork>:
+{
+  80278e:	55                   	push   %ebp
+  80278f:	89 e5                	mov    %esp,%ebp
+  802791:	53                   	push   %ebx
+  802792:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  802795:	68 b2 23 80 00       	push   $0x8023b2
+  80279a:	e8 06 1d 00 00       	call   8044a5 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  80279f:	e8 7a f6 ff ff       	call   801e1e <sys_fork>
+  8027a4:	89 c3                	mov    %eax,%ebx
+  8027a6:	83 c4 10             	add    $0x10,%esp
+  8027a9:	85 c0                	test   %eax,%eax
+  8027ab:	78 09                	js     8027b6 <fork+0x28>
+	if (pid == 0)
+  8027ad:	74 1c                	je     8027cb <fork+0x3d>
+}
+  8027af:	89 d8                	mov    %ebx,%eax
+  8027b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027b4:	c9                   	leave
+  8027b5:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  8027b6:	50                   	push   %eax
+  8027b7:	68 64 4d 80 00       	push   $0x804d64
+  8027bc:	68 ed 00 00 00       	push   $0xed
+  8027c1:	68 40 4d 80 00       	push   $0x804d40
+  8027c6:	e8 cd e3 ff ff       	call   800b98 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  8027cb:	e8 47 f0 ff ff       	call   801817 <sys_getenvid>
+  8027d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8027d5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8027e0:	a3 28 64 80 00       	mov    %eax,0x806428
+	return pid;
+  8027e5:	eb c8                	jmp    8027af <fork+0x21>
+
+008027e7 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  8027e7:	55                   	push   %ebp
+  8027e8:	89 e5                	mov    %esp,%ebp
+  8027ea:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  8027ed:	ff 75 0c             	push   0xc(%ebp)
+  8027f0:	ff 75 08             	push   0x8(%ebp)
+  8027f3:	68 73 24 80 00       	push   $0x802473
+  8027f8:	e8 67 f6 ff ff       	call   801e64 <sys_thread_create>
+}
+  8027fd:	c9                   	leave
+  8027fe:	c3                   	ret
+
+008027ff <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  8027ff:	55                   	push   %ebp
+  802800:	89 e5                	mov    %esp,%ebp
+  802802:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  802805:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  80280c:	00 00 00 
+	b->b_error = 0;
+  80280f:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  802816:	00 00 00 
+}
+  802819:	5d                   	pop    %ebp
+  80281a:	c3                   	ret
+
+0080281b <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  80281b:	55                   	push   %ebp
+  80281c:	89 e5                	mov    %esp,%ebp
+  80281e:	53                   	push   %ebx
+  80281f:	83 ec 04             	sub    $0x4,%esp
+  802822:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  802825:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  80282b:	85 c0                	test   %eax,%eax
+  80282d:	7e 09                	jle    802838 <batch_flush+0x1d>
+  80282f:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  802836:	74 15                	je     80284d <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  802838:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  80283f:	00 00 00 
+	return b->b_error;
+  802842:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  802848:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80284b:	c9                   	leave
+  80284c:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  80284d:	83 ec 08             	sub    $0x8,%esp
+  802850:	50                   	push   %eax
+  802851:	53                   	push   %ebx
+  802852:	e8 32 f7 ff ff       	call   801f89 <sys_batch>
+  802857:	83 c4 10             	add    $0x10,%esp
+  80285a:	85 c0                	test   %eax,%eax
+  80285c:	79 da                	jns    802838 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  80285e:	f7 d8                	neg    %eax
+  802860:	0f b6 c0             	movzbl %al,%eax
+  802863:	f7 d8                	neg    %eax
+  802865:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  80286b:	eb cb                	jmp    802838 <batch_flush+0x1d>
+
+0080286d <batch_reserve>:
+{
+  80286d:	55                   	push   %ebp
+  80286e:	89 e5                	mov    %esp,%ebp
+  802870:	83 ec 08             	sub    $0x8,%esp
+  802873:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  802876:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  80287c:	03 45 0c             	add    0xc(%ebp),%eax
+  80287f:	83 f8 10             	cmp    $0x10,%eax
+  802882:	7f 02                	jg     802886 <batch_reserve+0x19>
+}
+  802884:	c9                   	leave
+  802885:	c3                   	ret
+		batch_flush(b);
+  802886:	83 ec 0c             	sub    $0xc,%esp
+  802889:	52                   	push   %edx
+  80288a:	e8 8c ff ff ff       	call   80281b <batch_flush>
+  80288f:	83 c4 10             	add    $0x10,%esp
+}
+  802892:	eb f0                	jmp    802884 <batch_reserve+0x17>
+
+00802894 <batch_next>:
+{
+  802894:	55                   	push   %ebp
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	53                   	push   %ebx
+  802898:	83 ec 04             	sub    $0x4,%esp
+  80289b:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  80289d:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  8028a4:	74 28                	je     8028ce <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  8028a6:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8028ac:	8d 50 01             	lea    0x1(%eax),%edx
+  8028af:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  8028b5:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8028b8:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  8028ba:	83 ec 04             	sub    $0x4,%esp
+  8028bd:	6a 1c                	push   $0x1c
+  8028bf:	6a 00                	push   $0x0
+  8028c1:	53                   	push   %ebx
+  8028c2:	e8 35 ec ff ff       	call   8014fc <memset>
+}
+  8028c7:	89 d8                	mov    %ebx,%eax
+  8028c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028cc:	c9                   	leave
+  8028cd:	c3                   	ret
+		batch_flush(b);
+  8028ce:	83 ec 0c             	sub    $0xc,%esp
+  8028d1:	50                   	push   %eax
+  8028d2:	e8 44 ff ff ff       	call   80281b <batch_flush>
+  8028d7:	83 c4 10             	add    $0x10,%esp
+  8028da:	eb ca                	jmp    8028a6 <batch_next+0x12>
+
+008028dc <batch_page>:
+{
+  8028dc:	55                   	push   %ebp
+  8028dd:	89 e5                	mov    %esp,%ebp
+  8028df:	57                   	push   %edi
+  8028e0:	56                   	push   %esi
+  8028e1:	53                   	push   %ebx
+  8028e2:	83 ec 1c             	sub    $0x1c,%esp
+  8028e5:	89 d3                	mov    %edx,%ebx
+  8028e7:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  8028e9:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  8028ef:	85 d2                	test   %edx,%edx
+  8028f1:	74 50                	je     802943 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  8028f3:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  8028f6:	01 c1                	add    %eax,%ecx
+  8028f8:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  8028fb:	75 46                	jne    802943 <batch_page+0x67>
+  8028fd:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  802900:	75 41                	jne    802943 <batch_page+0x67>
+  802902:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  802905:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  802908:	75 39                	jne    802943 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  80290a:	83 ea 01             	sub    $0x1,%edx
+  80290d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  802910:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  802913:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  802917:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  80291a:	75 27                	jne    802943 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  80291c:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  80291f:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  802923:	89 fa                	mov    %edi,%edx
+  802925:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802928:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80292b:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  80292e:	39 55 08             	cmp    %edx,0x8(%ebp)
+  802931:	75 10                	jne    802943 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802933:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  802937:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80293a:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  80293e:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802941:	74 2a                	je     80296d <batch_page+0x91>
+	op = batch_next(b);
+  802943:	e8 4c ff ff ff       	call   802894 <batch_next>
+	op->bo_op = opcode;
+  802948:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  80294a:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  80294d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802950:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802953:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802956:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  802959:	8b 75 10             	mov    0x10(%ebp),%esi
+  80295c:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  80295f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802962:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802965:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802968:	89 78 14             	mov    %edi,0x14(%eax)
+  80296b:	eb 0b                	jmp    802978 <batch_page+0x9c>
+		op->bo_npages += npages;
+  80296d:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  802971:	03 7d 18             	add    0x18(%ebp),%edi
+  802974:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802978:	83 c4 1c             	add    $0x1c,%esp
+  80297b:	5b                   	pop    %ebx
+  80297c:	5e                   	pop    %esi
+  80297d:	5f                   	pop    %edi
+  80297e:	5d                   	pop    %ebp
+  80297f:	c3                   	ret
+
+00802980 <batch_alloc>:
+{
+  802980:	55                   	push   %ebp
+  802981:	89 e5                	mov    %esp,%ebp
+  802983:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802986:	ff 75 18             	push   0x18(%ebp)
+  802989:	ff 75 14             	push   0x14(%ebp)
+  80298c:	ff 75 10             	push   0x10(%ebp)
+  80298f:	ff 75 0c             	push   0xc(%ebp)
+  802992:	6a 00                	push   $0x0
+  802994:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802999:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a1:	e8 36 ff ff ff       	call   8028dc <batch_page>
+}
+  8029a6:	83 c4 20             	add    $0x20,%esp
+  8029a9:	c9                   	leave
+  8029aa:	c3                   	ret
+
+008029ab <batch_map>:
+{
+  8029ab:	55                   	push   %ebp
+  8029ac:	89 e5                	mov    %esp,%ebp
+  8029ae:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  8029b1:	ff 75 20             	push   0x20(%ebp)
+  8029b4:	ff 75 1c             	push   0x1c(%ebp)
+  8029b7:	ff 75 18             	push   0x18(%ebp)
+  8029ba:	ff 75 14             	push   0x14(%ebp)
+  8029bd:	ff 75 10             	push   0x10(%ebp)
+  8029c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029c3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8029c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029cb:	e8 0c ff ff ff       	call   8028dc <batch_page>
+}
+  8029d0:	83 c4 20             	add    $0x20,%esp
+  8029d3:	c9                   	leave
+  8029d4:	c3                   	ret
+
+008029d5 <batch_unmap>:
+{
+  8029d5:	55                   	push   %ebp
+  8029d6:	89 e5                	mov    %esp,%ebp
+  8029d8:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  8029db:	ff 75 14             	push   0x14(%ebp)
+  8029de:	6a 00                	push   $0x0
+  8029e0:	ff 75 10             	push   0x10(%ebp)
+  8029e3:	ff 75 0c             	push   0xc(%ebp)
+  8029e6:	6a 00                	push   $0x0
+  8029e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029ed:	ba 02 00 00 00       	mov    $0x2,%edx
+  8029f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f5:	e8 e2 fe ff ff       	call   8028dc <batch_page>
+}
+  8029fa:	83 c4 20             	add    $0x20,%esp
+  8029fd:	c9                   	leave
+  8029fe:	c3                   	ret
+
+008029ff <batch_set_status>:
+{
+  8029ff:	55                   	push   %ebp
+  802a00:	89 e5                	mov    %esp,%ebp
+  802a02:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  802a05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a08:	e8 87 fe ff ff       	call   802894 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  802a0d:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  802a13:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a16:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  802a19:	8b 55 10             	mov    0x10(%ebp),%edx
+  802a1c:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  802a1f:	c9                   	leave
+  802a20:	c3                   	ret
+
+00802a21 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a2a:	8b 45 10             	mov    0x10(%ebp),%eax
+	args->argc = argc;
+  802a2d:	89 10                	mov    %edx,(%eax)
+	args->argv = (const char **) argv;
+  802a2f:	89 48 04             	mov    %ecx,0x4(%eax)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  802a32:	83 3a 01             	cmpl   $0x1,(%edx)
+  802a35:	7e 09                	jle    802a40 <argstart+0x1f>
+  802a37:	ba 21 47 80 00       	mov    $0x804721,%edx
+  802a3c:	85 c9                	test   %ecx,%ecx
+  802a3e:	75 05                	jne    802a45 <argstart+0x24>
+  802a40:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a45:	89 50 08             	mov    %edx,0x8(%eax)
+	args->argvalue = 0;
+  802a48:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  802a4f:	5d                   	pop    %ebp
+  802a50:	c3                   	ret
+
+00802a51 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  802a51:	55                   	push   %ebp
+  802a52:	89 e5                	mov    %esp,%ebp
+  802a54:	53                   	push   %ebx
+  802a55:	83 ec 04             	sub    $0x4,%esp
+  802a58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int arg;
+
+	args->argvalue = 0;
+  802a5b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  802a62:	8b 43 08             	mov    0x8(%ebx),%eax
+  802a65:	85 c0                	test   %eax,%eax
+  802a67:	74 74                	je     802add <argnext+0x8c>
+		return -1;
+
+	if (!*args->curarg) {
+  802a69:	80 38 00             	cmpb   $0x0,(%eax)
+  802a6c:	75 48                	jne    802ab6 <argnext+0x65>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  802a6e:	8b 0b                	mov    (%ebx),%ecx
+  802a70:	83 39 01             	cmpl   $0x1,(%ecx)
+  802a73:	74 5a                	je     802acf <argnext+0x7e>
+		    || args->argv[1][0] != '-'
+  802a75:	8b 53 04             	mov    0x4(%ebx),%edx
+  802a78:	8b 42 04             	mov    0x4(%edx),%eax
+  802a7b:	80 38 2d             	cmpb   $0x2d,(%eax)
+  802a7e:	75 4f                	jne    802acf <argnext+0x7e>
+		    || args->argv[1][1] == '\0')
+  802a80:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  802a84:	74 49                	je     802acf <argnext+0x7e>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  802a86:	83 c0 01             	add    $0x1,%eax
+  802a89:	89 43 08             	mov    %eax,0x8(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802a8c:	83 ec 04             	sub    $0x4,%esp
+  802a8f:	8b 01                	mov    (%ecx),%eax
+  802a91:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  802a98:	50                   	push   %eax
+  802a99:	8d 42 08             	lea    0x8(%edx),%eax
+  802a9c:	50                   	push   %eax
+  802a9d:	83 c2 04             	add    $0x4,%edx
+  802aa0:	52                   	push   %edx
+  802aa1:	e8 8b ea ff ff       	call   801531 <memmove>
+		(*args->argc)--;
+  802aa6:	8b 03                	mov    (%ebx),%eax
+  802aa8:	83 28 01             	subl   $0x1,(%eax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802aab:	8b 43 08             	mov    0x8(%ebx),%eax
+  802aae:	83 c4 10             	add    $0x10,%esp
+  802ab1:	80 38 2d             	cmpb   $0x2d,(%eax)
+  802ab4:	74 13                	je     802ac9 <argnext+0x78>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  802ab6:	8b 43 08             	mov    0x8(%ebx),%eax
+  802ab9:	0f b6 10             	movzbl (%eax),%edx
+	args->curarg++;
+  802abc:	83 c0 01             	add    $0x1,%eax
+  802abf:	89 43 08             	mov    %eax,0x8(%ebx)
+	return arg;
+
+    endofargs:
+	args->curarg = 0;
+	return -1;
+}
+  802ac2:	89 d0                	mov    %edx,%eax
+  802ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac7:	c9                   	leave
+  802ac8:	c3                   	ret
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802ac9:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  802acd:	75 e7                	jne    802ab6 <argnext+0x65>
+	args->curarg = 0;
+  802acf:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+	return -1;
+  802ad6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802adb:	eb e5                	jmp    802ac2 <argnext+0x71>
+		return -1;
+  802add:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  802ae2:	eb de                	jmp    802ac2 <argnext+0x71>
+
+00802ae4 <argnextvalue>:
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  802ae4:	55                   	push   %ebp
+  802ae5:	89 e5                	mov    %esp,%ebp
+  802ae7:	53                   	push   %ebx
+  802ae8:	83 ec 04             	sub    $0x4,%esp
+  802aeb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (!args->curarg)
+  802aee:	8b 43 08             	mov    0x8(%ebx),%eax
+  802af1:	85 c0                	test   %eax,%eax
+  802af3:	74 12                	je     802b07 <argnextvalue+0x23>
+		return 0;
+	if (*args->curarg) {
+  802af5:	80 38 00             	cmpb   $0x0,(%eax)
+  802af8:	74 12                	je     802b0c <argnextvalue+0x28>
+		args->argvalue = args->curarg;
+  802afa:	89 43 0c             	mov    %eax,0xc(%ebx)
+		args->curarg = "";
+  802afd:	c7 43 08 21 47 80 00 	movl   $0x804721,0x8(%ebx)
+		(*args->argc)--;
+	} else {
+		args->argvalue = 0;
+		args->curarg = 0;
+	}
+	return (char*) args->argvalue;
+  802b04:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  802b07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b0a:	c9                   	leave
+  802b0b:	c3                   	ret
+	} else if (*args->argc > 1) {
+  802b0c:	8b 13                	mov    (%ebx),%edx
+  802b0e:	83 3a 01             	cmpl   $0x1,(%edx)
+  802b11:	7f 10                	jg     802b23 <argnextvalue+0x3f>
+		args->argvalue = 0;
+  802b13:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		args->curarg = 0;
+  802b1a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  802b21:	eb e1                	jmp    802b04 <argnextvalue+0x20>
+		args->argvalue = args->argv[1];
+  802b23:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b26:	8b 48 04             	mov    0x4(%eax),%ecx
+  802b29:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802b2c:	83 ec 04             	sub    $0x4,%esp
+  802b2f:	8b 12                	mov    (%edx),%edx
+  802b31:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  802b38:	52                   	push   %edx
+  802b39:	8d 50 08             	lea    0x8(%eax),%edx
+  802b3c:	52                   	push   %edx
+  802b3d:	83 c0 04             	add    $0x4,%eax
+  802b40:	50                   	push   %eax
+  802b41:	e8 eb e9 ff ff       	call   801531 <memmove>
+		(*args->argc)--;
+  802b46:	8b 03                	mov    (%ebx),%eax
+  802b48:	83 28 01             	subl   $0x1,(%eax)
+  802b4b:	83 c4 10             	add    $0x10,%esp
+  802b4e:	eb b4                	jmp    802b04 <argnextvalue+0x20>
+
+00802b50 <argvalue>:
+{
+  802b50:	55                   	push   %ebp
+  802b51:	89 e5                	mov    %esp,%ebp
+  802b53:	83 ec 08             	sub    $0x8,%esp
+  802b56:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  802b59:	8b 42 0c             	mov    0xc(%edx),%eax
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	74 02                	je     802b62 <argvalue+0x12>
+}
+  802b60:	c9                   	leave
+  802b61:	c3                   	ret
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  802b62:	83 ec 0c             	sub    $0xc,%esp
+  802b65:	52                   	push   %edx
+  802b66:	e8 79 ff ff ff       	call   802ae4 <argnextvalue>
+  802b6b:	83 c4 10             	add    $0x10,%esp
+  802b6e:	eb f0                	jmp    802b60 <argvalue+0x10>
+
+00802b70 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802b70:	55                   	push   %ebp
+  802b71:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b76:	05 00 00 00 30       	add    $0x30000000,%eax
+  802b7b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802b7e:	5d                   	pop    %ebp
+  802b7f:	c3                   	ret
+
+00802b80 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802b80:	55                   	push   %ebp
+  802b81:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b86:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802b8b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b90:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802b95:	5d                   	pop    %ebp
+  802b96:	c3                   	ret
+
+00802b97 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802b97:	55                   	push   %ebp
+  802b98:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802b9a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802b9f:	eb 02                	jmp    802ba3 <fd_alloc+0xc>
+  802ba1:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802ba3:	89 c2                	mov    %eax,%edx
+  802ba5:	c1 ea 16             	shr    $0x16,%edx
+  802ba8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802baf:	f6 c2 01             	test   $0x1,%dl
+  802bb2:	74 2b                	je     802bdf <fd_alloc+0x48>
+  802bb4:	89 c2                	mov    %eax,%edx
+  802bb6:	c1 ea 0c             	shr    $0xc,%edx
+  802bb9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802bc0:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802bc6:	f6 c1 01             	test   $0x1,%cl
+  802bc9:	74 14                	je     802bdf <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802bcb:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802bd1:	75 ce                	jne    802ba1 <fd_alloc+0xa>
+  802bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802bd8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802bdd:	eb 05                	jmp    802be4 <fd_alloc+0x4d>
+			return 0;
+  802bdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802be4:	8b 55 08             	mov    0x8(%ebp),%edx
+  802be7:	89 02                	mov    %eax,(%edx)
+}
+  802be9:	89 c8                	mov    %ecx,%eax
+  802beb:	5d                   	pop    %ebp
+  802bec:	c3                   	ret
+
+00802bed <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802bed:	55                   	push   %ebp
+  802bee:	89 e5                	mov    %esp,%ebp
+  802bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802bf3:	83 f8 1f             	cmp    $0x1f,%eax
+  802bf6:	77 30                	ja     802c28 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802bf8:	c1 e0 0c             	shl    $0xc,%eax
+  802bfb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802c00:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802c06:	f6 c2 01             	test   $0x1,%dl
+  802c09:	74 24                	je     802c2f <fd_lookup+0x42>
+  802c0b:	89 c2                	mov    %eax,%edx
+  802c0d:	c1 ea 0c             	shr    $0xc,%edx
+  802c10:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802c17:	f6 c2 01             	test   $0x1,%dl
+  802c1a:	74 1a                	je     802c36 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802c1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c1f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802c21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c26:	5d                   	pop    %ebp
+  802c27:	c3                   	ret
+		return -E_INVAL;
+  802c28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c2d:	eb f7                	jmp    802c26 <fd_lookup+0x39>
+		return -E_INVAL;
+  802c2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c34:	eb f0                	jmp    802c26 <fd_lookup+0x39>
+  802c36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c3b:	eb e9                	jmp    802c26 <fd_lookup+0x39>
+
+00802c3d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802c3d:	55                   	push   %ebp
+  802c3e:	89 e5                	mov    %esp,%ebp
+  802c40:	53                   	push   %ebx
+  802c41:	83 ec 04             	sub    $0x4,%esp
+  802c44:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4c:	eb 03                	jmp    802c51 <dev_lookup+0x14>
+  802c4e:	83 c0 01             	add    $0x1,%eax
+  802c51:	8b 1c 85 28 4e 80 00 	mov    0x804e28(,%eax,4),%ebx
+  802c58:	85 db                	test   %ebx,%ebx
+  802c5a:	74 0b                	je     802c67 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802c5c:	39 13                	cmp    %edx,(%ebx)
+  802c5e:	75 ee                	jne    802c4e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c65:	eb 2e                	jmp    802c95 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  802c67:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c69:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c6e:	8b 0d 28 64 80 00    	mov    0x806428,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c74:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c79:	76 24                	jbe    802c9f <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802c7b:	8b 41 48             	mov    0x48(%ecx),%eax
+  802c7e:	83 ec 04             	sub    $0x4,%esp
+  802c81:	52                   	push   %edx
+  802c82:	50                   	push   %eax
+  802c83:	68 ac 4d 80 00       	push   $0x804dac
+  802c88:	e8 e6 df ff ff       	call   800c73 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802c8d:	83 c4 10             	add    $0x10,%esp
+  802c90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802c95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c98:	89 1a                	mov    %ebx,(%edx)
+}
+  802c9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c9d:	c9                   	leave
+  802c9e:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802c9f:	c1 e8 10             	shr    $0x10,%eax
+  802ca2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ca8:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802cae:	eb cb                	jmp    802c7b <dev_lookup+0x3e>
+
+00802cb0 <fd_close>:
+{
+  802cb0:	55                   	push   %ebp
+  802cb1:	89 e5                	mov    %esp,%ebp
+  802cb3:	57                   	push   %edi
+  802cb4:	56                   	push   %esi
+  802cb5:	53                   	push   %ebx
+  802cb6:	83 ec 24             	sub    $0x24,%esp
+  802cb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cbc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802cbf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802cc2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802cc3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802cc9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802ccc:	50                   	push   %eax
+  802ccd:	e8 1b ff ff ff       	call   802bed <fd_lookup>
+  802cd2:	89 c3                	mov    %eax,%ebx
+  802cd4:	83 c4 10             	add    $0x10,%esp
+  802cd7:	85 c0                	test   %eax,%eax
+  802cd9:	78 05                	js     802ce0 <fd_close+0x30>
+	    || fd != fd2)
+  802cdb:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802cde:	74 16                	je     802cf6 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802ce0:	89 f8                	mov    %edi,%eax
+  802ce2:	84 c0                	test   %al,%al
+  802ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce9:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802cec:	89 d8                	mov    %ebx,%eax
+  802cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cf1:	5b                   	pop    %ebx
+  802cf2:	5e                   	pop    %esi
+  802cf3:	5f                   	pop    %edi
+  802cf4:	5d                   	pop    %ebp
+  802cf5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802cf6:	83 ec 08             	sub    $0x8,%esp
+  802cf9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802cfc:	50                   	push   %eax
+  802cfd:	ff 36                	push   (%esi)
+  802cff:	e8 39 ff ff ff       	call   802c3d <dev_lookup>
+  802d04:	89 c3                	mov    %eax,%ebx
+  802d06:	83 c4 10             	add    $0x10,%esp
+  802d09:	85 c0                	test   %eax,%eax
+  802d0b:	78 1a                	js     802d27 <fd_close+0x77>
+		if (dev->dev_close)
+  802d0d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d10:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802d13:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	74 0b                	je     802d27 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802d1c:	83 ec 0c             	sub    $0xc,%esp
+  802d1f:	56                   	push   %esi
+  802d20:	ff d0                	call   *%eax
+  802d22:	89 c3                	mov    %eax,%ebx
+  802d24:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802d27:	83 ec 08             	sub    $0x8,%esp
+  802d2a:	56                   	push   %esi
+  802d2b:	6a 00                	push   $0x0
+  802d2d:	e8 4c ec ff ff       	call   80197e <sys_page_unmap>
+	return r;
+  802d32:	83 c4 10             	add    $0x10,%esp
+  802d35:	eb b5                	jmp    802cec <fd_close+0x3c>
+
+00802d37 <close>:
+
+int
+close(int fdnum)
+{
+  802d37:	55                   	push   %ebp
+  802d38:	89 e5                	mov    %esp,%ebp
+  802d3a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d40:	50                   	push   %eax
+  802d41:	ff 75 08             	push   0x8(%ebp)
+  802d44:	e8 a4 fe ff ff       	call   802bed <fd_lookup>
+  802d49:	83 c4 10             	add    $0x10,%esp
+  802d4c:	85 c0                	test   %eax,%eax
+  802d4e:	79 02                	jns    802d52 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802d50:	c9                   	leave
+  802d51:	c3                   	ret
+		return fd_close(fd, 1);
+  802d52:	83 ec 08             	sub    $0x8,%esp
+  802d55:	6a 01                	push   $0x1
+  802d57:	ff 75 f4             	push   -0xc(%ebp)
+  802d5a:	e8 51 ff ff ff       	call   802cb0 <fd_close>
+  802d5f:	83 c4 10             	add    $0x10,%esp
+  802d62:	eb ec                	jmp    802d50 <close+0x19>
+
+00802d64 <close_all>:
+
+void
+close_all(void)
+{
+  802d64:	55                   	push   %ebp
+  802d65:	89 e5                	mov    %esp,%ebp
+  802d67:	53                   	push   %ebx
+  802d68:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802d6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802d70:	83 ec 0c             	sub    $0xc,%esp
+  802d73:	53                   	push   %ebx
+  802d74:	e8 be ff ff ff       	call   802d37 <close>
+	for (i = 0; i < MAXFD; i++)
+  802d79:	83 c3 01             	add    $0x1,%ebx
+  802d7c:	83 c4 10             	add    $0x10,%esp
+  802d7f:	83 fb 20             	cmp    $0x20,%ebx
+  802d82:	75 ec                	jne    802d70 <close_all+0xc>
+}
+  802d84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d87:	c9                   	leave
+  802d88:	c3                   	ret
+
+00802d89 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802d89:	55                   	push   %ebp
+  802d8a:	89 e5                	mov    %esp,%ebp
+  802d8c:	57                   	push   %edi
+  802d8d:	56                   	push   %esi
+  802d8e:	53                   	push   %ebx
+  802d8f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802d92:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d95:	50                   	push   %eax
+  802d96:	ff 75 08             	push   0x8(%ebp)
+  802d99:	e8 4f fe ff ff       	call   802bed <fd_lookup>
+  802d9e:	89 c3                	mov    %eax,%ebx
+  802da0:	83 c4 10             	add    $0x10,%esp
+  802da3:	85 c0                	test   %eax,%eax
+  802da5:	78 7f                	js     802e26 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802da7:	83 ec 0c             	sub    $0xc,%esp
+  802daa:	ff 75 0c             	push   0xc(%ebp)
+  802dad:	e8 85 ff ff ff       	call   802d37 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802db2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802db5:	c1 e6 0c             	shl    $0xc,%esi
+  802db8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802dbe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802dc1:	89 3c 24             	mov    %edi,(%esp)
+  802dc4:	e8 b7 fd ff ff       	call   802b80 <fd2data>
+  802dc9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802dcb:	89 34 24             	mov    %esi,(%esp)
+  802dce:	e8 ad fd ff ff       	call   802b80 <fd2data>
+  802dd3:	83 c4 10             	add    $0x10,%esp
+  802dd6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802dd9:	89 d8                	mov    %ebx,%eax
+  802ddb:	c1 e8 16             	shr    $0x16,%eax
+  802dde:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802de5:	a8 01                	test   $0x1,%al
+  802de7:	74 11                	je     802dfa <dup+0x71>
+  802de9:	89 d8                	mov    %ebx,%eax
+  802deb:	c1 e8 0c             	shr    $0xc,%eax
+  802dee:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802df5:	f6 c2 01             	test   $0x1,%dl
+  802df8:	75 36                	jne    802e30 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802dfa:	89 f8                	mov    %edi,%eax
+  802dfc:	c1 e8 0c             	shr    $0xc,%eax
+  802dff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802e06:	83 ec 0c             	sub    $0xc,%esp
+  802e09:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e0e:	50                   	push   %eax
+  802e0f:	56                   	push   %esi
+  802e10:	6a 00                	push   $0x0
+  802e12:	57                   	push   %edi
+  802e13:	6a 00                	push   $0x0
+  802e15:	e8 f6 ea ff ff       	call   801910 <sys_page_map>
+  802e1a:	89 c3                	mov    %eax,%ebx
+  802e1c:	83 c4 20             	add    $0x20,%esp
+  802e1f:	85 c0                	test   %eax,%eax
+  802e21:	78 33                	js     802e56 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802e23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802e26:	89 d8                	mov    %ebx,%eax
+  802e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e2b:	5b                   	pop    %ebx
+  802e2c:	5e                   	pop    %esi
+  802e2d:	5f                   	pop    %edi
+  802e2e:	5d                   	pop    %ebp
+  802e2f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802e30:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802e37:	83 ec 0c             	sub    $0xc,%esp
+  802e3a:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e3f:	50                   	push   %eax
+  802e40:	ff 75 d4             	push   -0x2c(%ebp)
+  802e43:	6a 00                	push   $0x0
+  802e45:	53                   	push   %ebx
+  802e46:	6a 00                	push   $0x0
+  802e48:	e8 c3 ea ff ff       	call   801910 <sys_page_map>
+  802e4d:	89 c3                	mov    %eax,%ebx
+  802e4f:	83 c4 20             	add    $0x20,%esp
+  802e52:	85 c0                	test   %eax,%eax
+  802e54:	79 a4                	jns    802dfa <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802e56:	83 ec 08             	sub    $0x8,%esp
+  802e59:	56                   	push   %esi
+  802e5a:	6a 00                	push   $0x0
+  802e5c:	e8 1d eb ff ff       	call   80197e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802e61:	83 c4 08             	add    $0x8,%esp
+  802e64:	ff 75 d4             	push   -0x2c(%ebp)
+  802e67:	6a 00                	push   $0x0
+  802e69:	e8 10 eb ff ff       	call   80197e <sys_page_unmap>
+	return r;
+  802e6e:	83 c4 10             	add    $0x10,%esp
+  802e71:	eb b3                	jmp    802e26 <dup+0x9d>
+
+00802e73 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802e73:	55                   	push   %ebp
+  802e74:	89 e5                	mov    %esp,%ebp
+  802e76:	56                   	push   %esi
+  802e77:	53                   	push   %ebx
+  802e78:	83 ec 18             	sub    $0x18,%esp
+  802e7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802e7e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e81:	50                   	push   %eax
+  802e82:	53                   	push   %ebx
+  802e83:	e8 65 fd ff ff       	call   802bed <fd_lookup>
+  802e88:	83 c4 10             	add    $0x10,%esp
+  802e8b:	85 c0                	test   %eax,%eax
+  802e8d:	78 3c                	js     802ecb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e8f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802e92:	83 ec 08             	sub    $0x8,%esp
+  802e95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e98:	50                   	push   %eax
+  802e99:	ff 36                	push   (%esi)
+  802e9b:	e8 9d fd ff ff       	call   802c3d <dev_lookup>
+  802ea0:	83 c4 10             	add    $0x10,%esp
+  802ea3:	85 c0                	test   %eax,%eax
+  802ea5:	78 24                	js     802ecb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802ea7:	8b 46 08             	mov    0x8(%esi),%eax
+  802eaa:	83 e0 03             	and    $0x3,%eax
+  802ead:	83 f8 01             	cmp    $0x1,%eax
+  802eb0:	74 20                	je     802ed2 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802eb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eb5:	8b 40 08             	mov    0x8(%eax),%eax
+  802eb8:	85 c0                	test   %eax,%eax
+  802eba:	74 57                	je     802f13 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802ebc:	83 ec 04             	sub    $0x4,%esp
+  802ebf:	ff 75 10             	push   0x10(%ebp)
+  802ec2:	ff 75 0c             	push   0xc(%ebp)
+  802ec5:	56                   	push   %esi
+  802ec6:	ff d0                	call   *%eax
+  802ec8:	83 c4 10             	add    $0x10,%esp
+}
+  802ecb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ece:	5b                   	pop    %ebx
+  802ecf:	5e                   	pop    %esi
+  802ed0:	5d                   	pop    %ebp
+  802ed1:	c3                   	ret
+  802ed2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ed4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ed9:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802edf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ee4:	76 1c                	jbe    802f02 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802ee6:	8b 42 48             	mov    0x48(%edx),%eax
+  802ee9:	83 ec 04             	sub    $0x4,%esp
+  802eec:	53                   	push   %ebx
+  802eed:	50                   	push   %eax
+  802eee:	68 ed 4d 80 00       	push   $0x804ded
+  802ef3:	e8 7b dd ff ff       	call   800c73 <cprintf>
+		return -E_INVAL;
+  802ef8:	83 c4 10             	add    $0x10,%esp
+  802efb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f00:	eb c9                	jmp    802ecb <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f02:	c1 e8 10             	shr    $0x10,%eax
+  802f05:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f0b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f11:	eb d3                	jmp    802ee6 <read+0x73>
+		return -E_NOT_SUPP;
+  802f13:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802f18:	eb b1                	jmp    802ecb <read+0x58>
+
+00802f1a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802f1a:	55                   	push   %ebp
+  802f1b:	89 e5                	mov    %esp,%ebp
+  802f1d:	57                   	push   %edi
+  802f1e:	56                   	push   %esi
+  802f1f:	53                   	push   %ebx
+  802f20:	83 ec 0c             	sub    $0xc,%esp
+  802f23:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f26:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f2e:	eb 02                	jmp    802f32 <readn+0x18>
+  802f30:	01 c3                	add    %eax,%ebx
+  802f32:	39 f3                	cmp    %esi,%ebx
+  802f34:	73 21                	jae    802f57 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802f36:	83 ec 04             	sub    $0x4,%esp
+  802f39:	89 f0                	mov    %esi,%eax
+  802f3b:	29 d8                	sub    %ebx,%eax
+  802f3d:	50                   	push   %eax
+  802f3e:	89 d8                	mov    %ebx,%eax
+  802f40:	03 45 0c             	add    0xc(%ebp),%eax
+  802f43:	50                   	push   %eax
+  802f44:	57                   	push   %edi
+  802f45:	e8 29 ff ff ff       	call   802e73 <read>
+		if (m < 0)
+  802f4a:	83 c4 10             	add    $0x10,%esp
+  802f4d:	85 c0                	test   %eax,%eax
+  802f4f:	78 04                	js     802f55 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802f51:	75 dd                	jne    802f30 <readn+0x16>
+  802f53:	eb 02                	jmp    802f57 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802f55:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802f57:	89 d8                	mov    %ebx,%eax
+  802f59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5c:	5b                   	pop    %ebx
+  802f5d:	5e                   	pop    %esi
+  802f5e:	5f                   	pop    %edi
+  802f5f:	5d                   	pop    %ebp
+  802f60:	c3                   	ret
+
+00802f61 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802f61:	55                   	push   %ebp
+  802f62:	89 e5                	mov    %esp,%ebp
+  802f64:	56                   	push   %esi
+  802f65:	53                   	push   %ebx
+  802f66:	83 ec 18             	sub    $0x18,%esp
+  802f69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802f6c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f6f:	50                   	push   %eax
+  802f70:	53                   	push   %ebx
+  802f71:	e8 77 fc ff ff       	call   802bed <fd_lookup>
+  802f76:	83 c4 10             	add    $0x10,%esp
+  802f79:	85 c0                	test   %eax,%eax
+  802f7b:	78 37                	js     802fb4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802f7d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802f80:	83 ec 08             	sub    $0x8,%esp
+  802f83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f86:	50                   	push   %eax
+  802f87:	ff 36                	push   (%esi)
+  802f89:	e8 af fc ff ff       	call   802c3d <dev_lookup>
+  802f8e:	83 c4 10             	add    $0x10,%esp
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	78 1f                	js     802fb4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802f95:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802f99:	74 20                	je     802fbb <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802f9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802fa1:	85 c0                	test   %eax,%eax
+  802fa3:	74 57                	je     802ffc <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802fa5:	83 ec 04             	sub    $0x4,%esp
+  802fa8:	ff 75 10             	push   0x10(%ebp)
+  802fab:	ff 75 0c             	push   0xc(%ebp)
+  802fae:	56                   	push   %esi
+  802faf:	ff d0                	call   *%eax
+  802fb1:	83 c4 10             	add    $0x10,%esp
+}
+  802fb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fb7:	5b                   	pop    %ebx
+  802fb8:	5e                   	pop    %esi
+  802fb9:	5d                   	pop    %ebp
+  802fba:	c3                   	ret
+  802fbb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fbd:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802fc2:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fc8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802fcd:	76 1c                	jbe    802feb <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802fcf:	8b 42 48             	mov    0x48(%edx),%eax
+  802fd2:	83 ec 04             	sub    $0x4,%esp
+  802fd5:	53                   	push   %ebx
+  802fd6:	50                   	push   %eax
+  802fd7:	68 09 4e 80 00       	push   $0x804e09
+  802fdc:	e8 92 dc ff ff       	call   800c73 <cprintf>
+		return -E_INVAL;
+  802fe1:	83 c4 10             	add    $0x10,%esp
+  802fe4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fe9:	eb c9                	jmp    802fb4 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802feb:	c1 e8 10             	shr    $0x10,%eax
+  802fee:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ff4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ffa:	eb d3                	jmp    802fcf <write+0x6e>
+		return -E_NOT_SUPP;
+  802ffc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803001:	eb b1                	jmp    802fb4 <write+0x53>
+
+00803003 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803003:	55                   	push   %ebp
+  803004:	89 e5                	mov    %esp,%ebp
+  803006:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803009:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80300c:	50                   	push   %eax
+  80300d:	ff 75 08             	push   0x8(%ebp)
+  803010:	e8 d8 fb ff ff       	call   802bed <fd_lookup>
+  803015:	83 c4 10             	add    $0x10,%esp
+  803018:	85 c0                	test   %eax,%eax
+  80301a:	78 0e                	js     80302a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80301c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80301f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803022:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  803025:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80302a:	c9                   	leave
+  80302b:	c3                   	ret
+
+0080302c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80302c:	55                   	push   %ebp
+  80302d:	89 e5                	mov    %esp,%ebp
+  80302f:	56                   	push   %esi
+  803030:	53                   	push   %ebx
+  803031:	83 ec 18             	sub    $0x18,%esp
+  803034:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803037:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80303a:	50                   	push   %eax
+  80303b:	53                   	push   %ebx
+  80303c:	e8 ac fb ff ff       	call   802bed <fd_lookup>
+  803041:	83 c4 10             	add    $0x10,%esp
+  803044:	85 c0                	test   %eax,%eax
+  803046:	78 34                	js     80307c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803048:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80304b:	83 ec 08             	sub    $0x8,%esp
+  80304e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803051:	50                   	push   %eax
+  803052:	ff 36                	push   (%esi)
+  803054:	e8 e4 fb ff ff       	call   802c3d <dev_lookup>
+  803059:	83 c4 10             	add    $0x10,%esp
+  80305c:	85 c0                	test   %eax,%eax
+  80305e:	78 1c                	js     80307c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803060:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  803064:	74 1d                	je     803083 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  803066:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803069:	8b 40 18             	mov    0x18(%eax),%eax
+  80306c:	85 c0                	test   %eax,%eax
+  80306e:	74 54                	je     8030c4 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  803070:	83 ec 08             	sub    $0x8,%esp
+  803073:	ff 75 0c             	push   0xc(%ebp)
+  803076:	56                   	push   %esi
+  803077:	ff d0                	call   *%eax
+  803079:	83 c4 10             	add    $0x10,%esp
+}
+  80307c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80307f:	5b                   	pop    %ebx
+  803080:	5e                   	pop    %esi
+  803081:	5d                   	pop    %ebp
+  803082:	c3                   	ret
+  803083:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803085:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80308a:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803090:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803095:	76 1c                	jbe    8030b3 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  803097:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80309a:	83 ec 04             	sub    $0x4,%esp
+  80309d:	53                   	push   %ebx
+  80309e:	50                   	push   %eax
+  80309f:	68 cc 4d 80 00       	push   $0x804dcc
+  8030a4:	e8 ca db ff ff       	call   800c73 <cprintf>
+		return -E_INVAL;
+  8030a9:	83 c4 10             	add    $0x10,%esp
+  8030ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030b1:	eb c9                	jmp    80307c <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8030b3:	c1 e8 10             	shr    $0x10,%eax
+  8030b6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8030bc:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8030c2:	eb d3                	jmp    803097 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8030c4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8030c9:	eb b1                	jmp    80307c <ftruncate+0x50>
+
+008030cb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8030cb:	55                   	push   %ebp
+  8030cc:	89 e5                	mov    %esp,%ebp
+  8030ce:	56                   	push   %esi
+  8030cf:	53                   	push   %ebx
+  8030d0:	83 ec 18             	sub    $0x18,%esp
+  8030d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8030d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030d9:	50                   	push   %eax
+  8030da:	ff 75 08             	push   0x8(%ebp)
+  8030dd:	e8 0b fb ff ff       	call   802bed <fd_lookup>
+  8030e2:	83 c4 10             	add    $0x10,%esp
+  8030e5:	85 c0                	test   %eax,%eax
+  8030e7:	78 49                	js     803132 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030e9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8030ec:	83 ec 08             	sub    $0x8,%esp
+  8030ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030f2:	50                   	push   %eax
+  8030f3:	ff 36                	push   (%esi)
+  8030f5:	e8 43 fb ff ff       	call   802c3d <dev_lookup>
+  8030fa:	83 c4 10             	add    $0x10,%esp
+  8030fd:	85 c0                	test   %eax,%eax
+  8030ff:	78 31                	js     803132 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  803101:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803104:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  803108:	74 2f                	je     803139 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80310a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80310d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  803114:	00 00 00 
+	stat->st_isdir = 0;
+  803117:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80311e:	00 00 00 
+	stat->st_dev = dev;
+  803121:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  803127:	83 ec 08             	sub    $0x8,%esp
+  80312a:	53                   	push   %ebx
+  80312b:	56                   	push   %esi
+  80312c:	ff 50 14             	call   *0x14(%eax)
+  80312f:	83 c4 10             	add    $0x10,%esp
+}
+  803132:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803135:	5b                   	pop    %ebx
+  803136:	5e                   	pop    %esi
+  803137:	5d                   	pop    %ebp
+  803138:	c3                   	ret
+		return -E_NOT_SUPP;
+  803139:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80313e:	eb f2                	jmp    803132 <fstat+0x67>
+
+00803140 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803140:	55                   	push   %ebp
+  803141:	89 e5                	mov    %esp,%ebp
+  803143:	56                   	push   %esi
+  803144:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803145:	83 ec 08             	sub    $0x8,%esp
+  803148:	6a 00                	push   $0x0
+  80314a:	ff 75 08             	push   0x8(%ebp)
+  80314d:	e8 e4 01 00 00       	call   803336 <open>
+  803152:	89 c3                	mov    %eax,%ebx
+  803154:	83 c4 10             	add    $0x10,%esp
+  803157:	85 c0                	test   %eax,%eax
+  803159:	78 1b                	js     803176 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80315b:	83 ec 08             	sub    $0x8,%esp
+  80315e:	ff 75 0c             	push   0xc(%ebp)
+  803161:	50                   	push   %eax
+  803162:	e8 64 ff ff ff       	call   8030cb <fstat>
+  803167:	89 c6                	mov    %eax,%esi
+	close(fd);
+  803169:	89 1c 24             	mov    %ebx,(%esp)
+  80316c:	e8 c6 fb ff ff       	call   802d37 <close>
+	return r;
+  803171:	83 c4 10             	add    $0x10,%esp
+  803174:	89 f3                	mov    %esi,%ebx
+}
+  803176:	89 d8                	mov    %ebx,%eax
+  803178:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80317b:	5b                   	pop    %ebx
+  80317c:	5e                   	pop    %esi
+  80317d:	5d                   	pop    %ebp
+  80317e:	c3                   	ret
+
+0080317f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80317f:	55                   	push   %ebp
+  803180:	89 e5                	mov    %esp,%ebp
+  803182:	56                   	push   %esi
+  803183:	53                   	push   %ebx
+  803184:	89 c6                	mov    %eax,%esi
+  803186:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  803188:	83 3d 20 64 80 00 00 	cmpl   $0x0,0x806420
+  80318f:	74 27                	je     8031b8 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803191:	6a 07                	push   $0x7
+  803193:	68 00 70 80 00       	push   $0x807000
+  803198:	56                   	push   %esi
+  803199:	ff 35 20 64 80 00    	push   0x806420
+  80319f:	e8 7d 14 00 00       	call   804621 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8031a4:	83 c4 0c             	add    $0xc,%esp
+  8031a7:	6a 00                	push   $0x0
+  8031a9:	53                   	push   %ebx
+  8031aa:	6a 00                	push   $0x0
+  8031ac:	e8 58 14 00 00       	call   804609 <ipc_recv>
+}
+  8031b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031b4:	5b                   	pop    %ebx
+  8031b5:	5e                   	pop    %esi
+  8031b6:	5d                   	pop    %ebp
+  8031b7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031b8:	83 ec 0c             	sub    $0xc,%esp
+  8031bb:	6a 01                	push   $0x1
+  8031bd:	e8 b3 14 00 00       	call   804675 <ipc_find_env>
+  8031c2:	a3 20 64 80 00       	mov    %eax,0x806420
+  8031c7:	83 c4 10             	add    $0x10,%esp
+  8031ca:	eb c5                	jmp    803191 <fsipc+0x12>
+
+008031cc <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8031cc:	55                   	push   %ebp
+  8031cd:	89 e5                	mov    %esp,%ebp
+  8031cf:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8031d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031d5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8031d8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8031dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031e0:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8031e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ea:	b8 02 00 00 00       	mov    $0x2,%eax
+  8031ef:	e8 8b ff ff ff       	call   80317f <fsipc>
+}
+  8031f4:	c9                   	leave
+  8031f5:	c3                   	ret
+
+008031f6 <devfile_flush>:
+{
+  8031f6:	55                   	push   %ebp
+  8031f7:	89 e5                	mov    %esp,%ebp
+  8031f9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8031fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  803202:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  803207:	ba 00 00 00 00       	mov    $0x0,%edx
+  80320c:	b8 06 00 00 00       	mov    $0x6,%eax
+  803211:	e8 69 ff ff ff       	call   80317f <fsipc>
+}
+  803216:	c9                   	leave
+  803217:	c3                   	ret
+
+00803218 <devfile_stat>:
+{
+  803218:	55                   	push   %ebp
+  803219:	89 e5                	mov    %esp,%ebp
+  80321b:	53                   	push   %ebx
+  80321c:	83 ec 04             	sub    $0x4,%esp
+  80321f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803222:	8b 45 08             	mov    0x8(%ebp),%eax
+  803225:	8b 40 0c             	mov    0xc(%eax),%eax
+  803228:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80322d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803232:	b8 05 00 00 00       	mov    $0x5,%eax
+  803237:	e8 43 ff ff ff       	call   80317f <fsipc>
+  80323c:	85 c0                	test   %eax,%eax
+  80323e:	78 2c                	js     80326c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803240:	83 ec 08             	sub    $0x8,%esp
+  803243:	68 00 70 80 00       	push   $0x807000
+  803248:	53                   	push   %ebx
+  803249:	e8 5d e1 ff ff       	call   8013ab <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80324e:	a1 80 70 80 00       	mov    0x807080,%eax
+  803253:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803259:	a1 84 70 80 00       	mov    0x807084,%eax
+  80325e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  803264:	83 c4 10             	add    $0x10,%esp
+  803267:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80326c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80326f:	c9                   	leave
+  803270:	c3                   	ret
+
+00803271 <devfile_write>:
+{
+  803271:	55                   	push   %ebp
+  803272:	89 e5                	mov    %esp,%ebp
+  803274:	83 ec 0c             	sub    $0xc,%esp
+  803277:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80327a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80327d:	8b 52 0c             	mov    0xc(%edx),%edx
+  803280:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = n;
+  803286:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80328b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  803290:	39 d0                	cmp    %edx,%eax
+  803292:	0f 47 c2             	cmova  %edx,%eax
+  803295:	50                   	push   %eax
+  803296:	ff 75 0c             	push   0xc(%ebp)
+  803299:	68 08 70 80 00       	push   $0x807008
+  80329e:	e8 8e e2 ff ff       	call   801531 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8032a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8032ad:	e8 cd fe ff ff       	call   80317f <fsipc>
+}
+  8032b2:	c9                   	leave
+  8032b3:	c3                   	ret
+
+008032b4 <devfile_read>:
+{
+  8032b4:	55                   	push   %ebp
+  8032b5:	89 e5                	mov    %esp,%ebp
+  8032b7:	56                   	push   %esi
+  8032b8:	53                   	push   %ebx
+  8032b9:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8032bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8032c2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8032c7:	89 35 04 70 80 00    	mov    %esi,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8032cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8032d7:	e8 a3 fe ff ff       	call   80317f <fsipc>
+  8032dc:	89 c3                	mov    %eax,%ebx
+  8032de:	85 c0                	test   %eax,%eax
+  8032e0:	78 1f                	js     803301 <devfile_read+0x4d>
+	assert(r <= n);
+  8032e2:	39 c6                	cmp    %eax,%esi
+  8032e4:	72 24                	jb     80330a <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8032e6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8032eb:	7f 33                	jg     803320 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8032ed:	83 ec 04             	sub    $0x4,%esp
+  8032f0:	50                   	push   %eax
+  8032f1:	68 00 70 80 00       	push   $0x807000
+  8032f6:	ff 75 0c             	push   0xc(%ebp)
+  8032f9:	e8 33 e2 ff ff       	call   801531 <memmove>
+	return r;
+  8032fe:	83 c4 10             	add    $0x10,%esp
+}
+  803301:	89 d8                	mov    %ebx,%eax
+  803303:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803306:	5b                   	pop    %ebx
+  803307:	5e                   	pop    %esi
+  803308:	5d                   	pop    %ebp
+  803309:	c3                   	ret
+	assert(r <= n);
+  80330a:	68 3c 4e 80 00       	push   $0x804e3c
+  80330f:	68 31 48 80 00       	push   $0x804831
+  803314:	6a 76                	push   $0x76
+  803316:	68 43 4e 80 00       	push   $0x804e43
+  80331b:	e8 78 d8 ff ff       	call   800b98 <_panic>
+	assert(r <= PGSIZE);
+  803320:	68 4e 4e 80 00       	push   $0x804e4e
+  803325:	68 31 48 80 00       	push   $0x804831
+  80332a:	6a 77                	push   $0x77
+  80332c:	68 43 4e 80 00       	push   $0x804e43
+  803331:	e8 62 d8 ff ff       	call   800b98 <_panic>
+
+00803336 <open>:
+{
+  803336:	55                   	push   %ebp
+  803337:	89 e5                	mov    %esp,%ebp
+  803339:	56                   	push   %esi
+  80333a:	53                   	push   %ebx
+  80333b:	83 ec 1c             	sub    $0x1c,%esp
+  80333e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  803341:	56                   	push   %esi
+  803342:	e8 29 e0 ff ff       	call   801370 <strlen>
+  803347:	83 c4 10             	add    $0x10,%esp
+  80334a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80334f:	7f 6c                	jg     8033bd <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  803351:	83 ec 0c             	sub    $0xc,%esp
+  803354:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803357:	50                   	push   %eax
+  803358:	e8 3a f8 ff ff       	call   802b97 <fd_alloc>
+  80335d:	89 c3                	mov    %eax,%ebx
+  80335f:	83 c4 10             	add    $0x10,%esp
+  803362:	85 c0                	test   %eax,%eax
+  803364:	78 3c                	js     8033a2 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  803366:	83 ec 08             	sub    $0x8,%esp
+  803369:	56                   	push   %esi
+  80336a:	68 00 70 80 00       	push   $0x807000
+  80336f:	e8 37 e0 ff ff       	call   8013ab <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  803374:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803377:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80337c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80337f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803384:	e8 f6 fd ff ff       	call   80317f <fsipc>
+  803389:	89 c3                	mov    %eax,%ebx
+  80338b:	83 c4 10             	add    $0x10,%esp
+  80338e:	85 c0                	test   %eax,%eax
+  803390:	78 19                	js     8033ab <open+0x75>
+	return fd2num(fd);
+  803392:	83 ec 0c             	sub    $0xc,%esp
+  803395:	ff 75 f4             	push   -0xc(%ebp)
+  803398:	e8 d3 f7 ff ff       	call   802b70 <fd2num>
+  80339d:	89 c3                	mov    %eax,%ebx
+  80339f:	83 c4 10             	add    $0x10,%esp
+}
+  8033a2:	89 d8                	mov    %ebx,%eax
+  8033a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033a7:	5b                   	pop    %ebx
+  8033a8:	5e                   	pop    %esi
+  8033a9:	5d                   	pop    %ebp
+  8033aa:	c3                   	ret
+		fd_close(fd, 0);
+  8033ab:	83 ec 08             	sub    $0x8,%esp
+  8033ae:	6a 00                	push   $0x0
+  8033b0:	ff 75 f4             	push   -0xc(%ebp)
+  8033b3:	e8 f8 f8 ff ff       	call   802cb0 <fd_close>
+		return r;
+  8033b8:	83 c4 10             	add    $0x10,%esp
+  8033bb:	eb e5                	jmp    8033a2 <open+0x6c>
+		return -E_BAD_PATH;
+  8033bd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8033c2:	eb de                	jmp    8033a2 <open+0x6c>
+
+008033c4 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8033c4:	55                   	push   %ebp
+  8033c5:	89 e5                	mov    %esp,%ebp
+  8033c7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8033ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033cf:	b8 08 00 00 00       	mov    $0x8,%eax
+  8033d4:	e8 a6 fd ff ff       	call   80317f <fsipc>
+}
+  8033d9:	c9                   	leave
+  8033da:	c3                   	ret
+
+008033db <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8033db:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8033df:	7f 01                	jg     8033e2 <writebuf+0x7>
+  8033e1:	c3                   	ret
+{
+  8033e2:	55                   	push   %ebp
+  8033e3:	89 e5                	mov    %esp,%ebp
+  8033e5:	53                   	push   %ebx
+  8033e6:	83 ec 08             	sub    $0x8,%esp
+  8033e9:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8033eb:	ff 70 04             	push   0x4(%eax)
+  8033ee:	8d 40 10             	lea    0x10(%eax),%eax
+  8033f1:	50                   	push   %eax
+  8033f2:	ff 33                	push   (%ebx)
+  8033f4:	e8 68 fb ff ff       	call   802f61 <write>
+		if (result > 0)
+  8033f9:	83 c4 10             	add    $0x10,%esp
+  8033fc:	85 c0                	test   %eax,%eax
+  8033fe:	7e 03                	jle    803403 <writebuf+0x28>
+			b->result += result;
+  803400:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  803403:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803406:	74 0d                	je     803415 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80340f:	0f 4f c2             	cmovg  %edx,%eax
+  803412:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  803415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803418:	c9                   	leave
+  803419:	c3                   	ret
+
+0080341a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80341a:	55                   	push   %ebp
+  80341b:	89 e5                	mov    %esp,%ebp
+  80341d:	53                   	push   %ebx
+  80341e:	83 ec 04             	sub    $0x4,%esp
+  803421:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  803424:	8b 53 04             	mov    0x4(%ebx),%edx
+  803427:	8d 42 01             	lea    0x1(%edx),%eax
+  80342a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80342d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803430:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  803434:	3d 00 01 00 00       	cmp    $0x100,%eax
+  803439:	74 05                	je     803440 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80343b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80343e:	c9                   	leave
+  80343f:	c3                   	ret
+		writebuf(b);
+  803440:	89 d8                	mov    %ebx,%eax
+  803442:	e8 94 ff ff ff       	call   8033db <writebuf>
+		b->idx = 0;
+  803447:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80344e:	eb eb                	jmp    80343b <putch+0x21>
+
+00803450 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  803450:	55                   	push   %ebp
+  803451:	89 e5                	mov    %esp,%ebp
+  803453:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  803459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80345c:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  803462:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  803469:	00 00 00 
+	b.result = 0;
+  80346c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803473:	00 00 00 
+	b.error = 1;
+  803476:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80347d:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  803480:	ff 75 10             	push   0x10(%ebp)
+  803483:	ff 75 0c             	push   0xc(%ebp)
+  803486:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80348c:	50                   	push   %eax
+  80348d:	68 1a 34 80 00       	push   $0x80341a
+  803492:	e8 ba d8 ff ff       	call   800d51 <vprintfmt>
+	if (b.idx > 0)
+  803497:	83 c4 10             	add    $0x10,%esp
+  80349a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8034a1:	7f 12                	jg     8034b5 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8034a3:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	75 06                	jne    8034b3 <vfprintf+0x63>
+  8034ad:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8034b3:	c9                   	leave
+  8034b4:	c3                   	ret
+		writebuf(&b);
+  8034b5:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8034bb:	e8 1b ff ff ff       	call   8033db <writebuf>
+  8034c0:	eb e1                	jmp    8034a3 <vfprintf+0x53>
+
+008034c2 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8034c2:	55                   	push   %ebp
+  8034c3:	89 e5                	mov    %esp,%ebp
+  8034c5:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8034c8:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8034cb:	50                   	push   %eax
+  8034cc:	ff 75 0c             	push   0xc(%ebp)
+  8034cf:	ff 75 08             	push   0x8(%ebp)
+  8034d2:	e8 79 ff ff ff       	call   803450 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8034d7:	c9                   	leave
+  8034d8:	c3                   	ret
+
+008034d9 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8034d9:	55                   	push   %ebp
+  8034da:	89 e5                	mov    %esp,%ebp
+  8034dc:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8034df:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8034e2:	50                   	push   %eax
+  8034e3:	ff 75 08             	push   0x8(%ebp)
+  8034e6:	6a 01                	push   $0x1
+  8034e8:	e8 63 ff ff ff       	call   803450 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8034ed:	c9                   	leave
+  8034ee:	c3                   	ret
+
+008034ef <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8034ef:	55                   	push   %ebp
+  8034f0:	89 e5                	mov    %esp,%ebp
+  8034f2:	57                   	push   %edi
+  8034f3:	56                   	push   %esi
+  8034f4:	53                   	push   %ebx
+  8034f5:	81 ec 54 04 00 00    	sub    $0x454,%esp
+	//
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+	if ((r = open(prog, O_RDONLY)) < 0)
+  8034fb:	6a 00                	push   $0x0
+  8034fd:	ff 75 08             	push   0x8(%ebp)
+  803500:	e8 31 fe ff ff       	call   803336 <open>
+  803505:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  80350b:	83 c4 10             	add    $0x10,%esp
+  80350e:	85 c0                	test   %eax,%eax
+  803510:	0f 88 7a 06 00 00    	js     803b90 <spawn+0x6a1>
+  803516:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  803518:	83 ec 04             	sub    $0x4,%esp
+  80351b:	68 00 02 00 00       	push   $0x200
+  803520:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  803526:	50                   	push   %eax
+  803527:	51                   	push   %ecx
+  803528:	e8 ed f9 ff ff       	call   802f1a <readn>
+  80352d:	83 c4 10             	add    $0x10,%esp
+  803530:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803535:	75 7a                	jne    8035b1 <spawn+0xc2>
+	    || elf->e_magic != ELF_MAGIC) {
+  803537:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80353e:	45 4c 46 
+  803541:	75 6e                	jne    8035b1 <spawn+0xc2>
+	__asm __volatile("int %2"
+  803543:	b8 07 00 00 00       	mov    $0x7,%eax
+  803548:	cd 30                	int    $0x30
+  80354a:	89 85 cc fb ff ff    	mov    %eax,-0x434(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  803550:	89 c6                	mov    %eax,%esi
+  803552:	85 c0                	test   %eax,%eax
+  803554:	0f 88 2a 06 00 00    	js     803b84 <spawn+0x695>
+		return r;
+	child = r;
+
+	// The child's memory is its own, not our demand-zero regions.
+	if ((r = sys_region_release(child, 0, UTOP)) < 0)
+  80355a:	83 ec 04             	sub    $0x4,%esp
+  80355d:	68 00 00 c0 ee       	push   $0xeec00000
+  803562:	6a 00                	push   $0x0
+  803564:	50                   	push   %eax
+  803565:	e8 b2 e9 ff ff       	call   801f1c <sys_region_release>
+  80356a:	89 c7                	mov    %eax,%edi
+  80356c:	83 c4 10             	add    $0x10,%esp
+  80356f:	85 c0                	test   %eax,%eax
+  803571:	0f 88 da 05 00 00    	js     803b51 <spawn+0x662>
+		goto error;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  803577:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80357d:	69 f6 58 01 00 00    	imul   $0x158,%esi,%esi
+  803583:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803589:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80358f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803594:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  803596:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  80359c:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8035a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8035a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8035ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8035af:	eb 4b                	jmp    8035fc <spawn+0x10d>
+		close(fd);
+  8035b1:	83 ec 0c             	sub    $0xc,%esp
+  8035b4:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8035ba:	e8 78 f7 ff ff       	call   802d37 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8035bf:	83 c4 0c             	add    $0xc,%esp
+  8035c2:	68 7f 45 4c 46       	push   $0x464c457f
+  8035c7:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8035cd:	68 5a 4e 80 00       	push   $0x804e5a
+  8035d2:	e8 9c d6 ff ff       	call   800c73 <cprintf>
+		return -E_NOT_EXEC;
+  8035d7:	83 c4 10             	add    $0x10,%esp
+  8035da:	c7 85 d0 fb ff ff f2 	movl   $0xfffffff2,-0x430(%ebp)
+  8035e1:	ff ff ff 
+  8035e4:	e9 a7 05 00 00       	jmp    803b90 <spawn+0x6a1>
+		string_size += strlen(argv[argc]) + 1;
+  8035e9:	83 ec 0c             	sub    $0xc,%esp
+  8035ec:	50                   	push   %eax
+  8035ed:	e8 7e dd ff ff       	call   801370 <strlen>
+  8035f2:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8035f6:	83 c3 01             	add    $0x1,%ebx
+  8035f9:	83 c4 10             	add    $0x10,%esp
+  8035fc:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8035ff:	85 c0                	test   %eax,%eax
+  803601:	75 e6                	jne    8035e9 <spawn+0xfa>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  803603:	89 9d c4 fb ff ff    	mov    %ebx,-0x43c(%ebp)
+  803609:	b8 00 10 40 00       	mov    $0x401000,%eax
+  80360e:	29 f0                	sub    %esi,%eax
+  803610:	89 c7                	mov    %eax,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  803612:	89 c2                	mov    %eax,%edx
+  803614:	83 e2 fc             	and    $0xfffffffc,%edx
+  803617:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80361e:	29 c2                	sub    %eax,%edx
+  803620:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  803626:	8d 42 f8             	lea    -0x8(%edx),%eax
+  803629:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80362e:	0f 86 6a 05 00 00    	jbe    803b9e <spawn+0x6af>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  803634:	83 ec 04             	sub    $0x4,%esp
+  803637:	6a 07                	push   $0x7
+  803639:	68 00 00 40 00       	push   $0x400000
+  80363e:	6a 00                	push   $0x0
+  803640:	e8 5e e2 ff ff       	call   8018a3 <sys_page_alloc>
+  803645:	83 c4 10             	add    $0x10,%esp
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	0f 88 53 05 00 00    	js     803ba3 <spawn+0x6b4>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  803650:	be 00 00 00 00       	mov    $0x0,%esi
+  803655:	89 9d c8 fb ff ff    	mov    %ebx,-0x438(%ebp)
+  80365b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80365e:	eb 30                	jmp    803690 <spawn+0x1a1>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  803660:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  803666:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  80366c:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  80366f:	83 ec 08             	sub    $0x8,%esp
+  803672:	ff 34 b3             	push   (%ebx,%esi,4)
+  803675:	57                   	push   %edi
+  803676:	e8 30 dd ff ff       	call   8013ab <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  80367b:	83 c4 04             	add    $0x4,%esp
+  80367e:	ff 34 b3             	push   (%ebx,%esi,4)
+  803681:	e8 ea dc ff ff       	call   801370 <strlen>
+  803686:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  80368a:	83 c6 01             	add    $0x1,%esi
+  80368d:	83 c4 10             	add    $0x10,%esp
+  803690:	39 b5 c8 fb ff ff    	cmp    %esi,-0x438(%ebp)
+  803696:	7f c8                	jg     803660 <spawn+0x171>
+	}
+	argv_store[argc] = 0;
+  803698:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  80369e:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  8036a4:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8036ab:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8036b1:	0f 85 85 00 00 00    	jne    80373c <spawn+0x24d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8036b7:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  8036bd:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  8036c3:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  8036c6:	89 d0                	mov    %edx,%eax
+  8036c8:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  8036ce:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8036d1:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8036d6:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8036dc:	83 ec 0c             	sub    $0xc,%esp
+  8036df:	6a 07                	push   $0x7
+  8036e1:	68 00 d0 bf ee       	push   $0xeebfd000
+  8036e6:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8036ec:	68 00 00 40 00       	push   $0x400000
+  8036f1:	6a 00                	push   $0x0
+  8036f3:	e8 18 e2 ff ff       	call   801910 <sys_page_map>
+  8036f8:	89 c3                	mov    %eax,%ebx
+  8036fa:	83 c4 20             	add    $0x20,%esp
+  8036fd:	85 c0                	test   %eax,%eax
+  8036ff:	0f 88 a6 04 00 00    	js     803bab <spawn+0x6bc>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  803705:	83 ec 08             	sub    $0x8,%esp
+  803708:	68 00 00 40 00       	push   $0x400000
+  80370d:	6a 00                	push   $0x0
+  80370f:	e8 6a e2 ff ff       	call   80197e <sys_page_unmap>
+  803714:	89 c3                	mov    %eax,%ebx
+  803716:	83 c4 10             	add    $0x10,%esp
+  803719:	85 c0                	test   %eax,%eax
+  80371b:	0f 88 8a 04 00 00    	js     803bab <spawn+0x6bc>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  803721:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  803727:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80372e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803733:	89 df                	mov    %ebx,%edi
+  803735:	89 c3                	mov    %eax,%ebx
+  803737:	e9 8d 01 00 00       	jmp    8038c9 <spawn+0x3da>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80373c:	68 0c 4f 80 00       	push   $0x804f0c
+  803741:	68 31 48 80 00       	push   $0x804831
+  803746:	68 f3 00 00 00       	push   $0xf3
+  80374b:	68 74 4e 80 00       	push   $0x804e74
+  803750:	e8 43 d4 ff ff       	call   800b98 <_panic>
+	}
+
+	// The pages that come from the file, a chunk at a time: allocate
+	// the chunk at UTEMP, read it in, and move it to the child.
+	batch_init(&b);
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  803755:	01 fe                	add    %edi,%esi
+  803757:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+  80375d:	8b 85 c0 fb ff ff    	mov    -0x440(%ebp),%eax
+  803763:	39 c6                	cmp    %eax,%esi
+  803765:	0f 83 18 01 00 00    	jae    803883 <spawn+0x394>
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  80376b:	8b 9d b8 fb ff ff    	mov    -0x448(%ebp),%ebx
+  803771:	29 f3                	sub    %esi,%ebx
+  803773:	c1 eb 0c             	shr    $0xc,%ebx
+  803776:	b8 40 00 00 00       	mov    $0x40,%eax
+  80377b:	39 c3                	cmp    %eax,%ebx
+  80377d:	0f 47 d8             	cmova  %eax,%ebx
+  803780:	89 df                	mov    %ebx,%edi
+			SEGMENT_CHUNK);
+		batch_alloc(&b, 0, UTEMP, PTE_P|PTE_U|PTE_W, n);
+  803782:	83 ec 0c             	sub    $0xc,%esp
+  803785:	53                   	push   %ebx
+  803786:	6a 07                	push   $0x7
+  803788:	68 00 00 40 00       	push   $0x400000
+  80378d:	6a 00                	push   $0x0
+  80378f:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  803795:	50                   	push   %eax
+  803796:	e8 e5 f1 ff ff       	call   802980 <batch_alloc>
+		if ((r = batch_flush(&b)) < 0)
+  80379b:	83 c4 14             	add    $0x14,%esp
+  80379e:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8037a4:	50                   	push   %eax
+  8037a5:	e8 71 f0 ff ff       	call   80281b <batch_flush>
+  8037aa:	83 c4 10             	add    $0x10,%esp
+  8037ad:	85 c0                	test   %eax,%eax
+  8037af:	0f 88 9a 03 00 00    	js     803b4f <spawn+0x660>
+			return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  8037b5:	83 ec 08             	sub    $0x8,%esp
+  8037b8:	8b 85 bc fb ff ff    	mov    -0x444(%ebp),%eax
+  8037be:	01 f0                	add    %esi,%eax
+  8037c0:	50                   	push   %eax
+  8037c1:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8037c7:	e8 37 f8 ff ff       	call   803003 <seek>
+  8037cc:	83 c4 10             	add    $0x10,%esp
+  8037cf:	85 c0                	test   %eax,%eax
+  8037d1:	0f 88 a1 03 00 00    	js     803b78 <spawn+0x689>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  8037d7:	c1 e7 0c             	shl    $0xc,%edi
+  8037da:	83 ec 04             	sub    $0x4,%esp
+  8037dd:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  8037e3:	8b 8d d4 fb ff ff    	mov    -0x42c(%ebp),%ecx
+  8037e9:	29 c8                	sub    %ecx,%eax
+  8037eb:	39 f8                	cmp    %edi,%eax
+  8037ed:	0f 47 c7             	cmova  %edi,%eax
+  8037f0:	50                   	push   %eax
+  8037f1:	68 00 00 40 00       	push   $0x400000
+  8037f6:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8037fc:	e8 19 f7 ff ff       	call   802f1a <readn>
+  803801:	83 c4 10             	add    $0x10,%esp
+  803804:	85 c0                	test   %eax,%eax
+  803806:	0f 88 70 03 00 00    	js     803b7c <spawn+0x68d>
+			return r;
+		batch_map(&b, 0, UTEMP, child, (void*) (va + i), perm, n);
+  80380c:	83 ec 04             	sub    $0x4,%esp
+  80380f:	53                   	push   %ebx
+  803810:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  803816:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  80381c:	8b 95 c4 fb ff ff    	mov    -0x43c(%ebp),%edx
+  803822:	01 d0                	add    %edx,%eax
+  803824:	50                   	push   %eax
+  803825:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80382b:	68 00 00 40 00       	push   $0x400000
+  803830:	6a 00                	push   $0x0
+  803832:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  803838:	50                   	push   %eax
+  803839:	e8 6d f1 ff ff       	call   8029ab <batch_map>
+		batch_unmap(&b, 0, UTEMP, n);
+  80383e:	83 c4 20             	add    $0x20,%esp
+  803841:	53                   	push   %ebx
+  803842:	68 00 00 40 00       	push   $0x400000
+  803847:	6a 00                	push   $0x0
+  803849:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80384f:	50                   	push   %eax
+  803850:	e8 80 f1 ff ff       	call   8029d5 <batch_unmap>
+		if ((r = batch_flush(&b)) < 0)
+  803855:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80385b:	89 04 24             	mov    %eax,(%esp)
+  80385e:	e8 b8 ef ff ff       	call   80281b <batch_flush>
+  803863:	83 c4 10             	add    $0x10,%esp
+  803866:	85 c0                	test   %eax,%eax
+  803868:	0f 89 e7 fe ff ff    	jns    803755 <spawn+0x266>
+			panic("spawn: sys_page_map data: %e", r);
+  80386e:	50                   	push   %eax
+  80386f:	68 80 4e 80 00       	push   $0x804e80
+  803874:	68 2b 01 00 00       	push   $0x12b
+  803879:	68 74 4e 80 00       	push   $0x804e74
+  80387e:	e8 15 d3 ff ff       	call   800b98 <_panic>
+	}
+
+	// the blank pages are demand-zero
+	if (i < memsz)
+  803883:	8b 9d ac fb ff ff    	mov    -0x454(%ebp),%ebx
+  803889:	8b bd a8 fb ff ff    	mov    -0x458(%ebp),%edi
+  80388f:	89 f2                	mov    %esi,%edx
+  803891:	8b 85 b0 fb ff ff    	mov    -0x450(%ebp),%eax
+  803897:	39 c6                	cmp    %eax,%esi
+  803899:	73 28                	jae    8038c3 <spawn+0x3d4>
+		return sys_region_reserve(child, (void*) (va + i), memsz - i,
+  80389b:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  8038a1:	29 f0                	sub    %esi,%eax
+  8038a3:	50                   	push   %eax
+  8038a4:	8b 85 c4 fb ff ff    	mov    -0x43c(%ebp),%eax
+  8038aa:	01 c2                	add    %eax,%edx
+  8038ac:	52                   	push   %edx
+  8038ad:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8038b3:	e8 f8 e5 ff ff       	call   801eb0 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8038b8:	83 c4 10             	add    $0x10,%esp
+  8038bb:	85 c0                	test   %eax,%eax
+  8038bd:	0f 88 bd 02 00 00    	js     803b80 <spawn+0x691>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8038c3:	83 c3 01             	add    $0x1,%ebx
+  8038c6:	83 c7 20             	add    $0x20,%edi
+  8038c9:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8038d0:	39 d8                	cmp    %ebx,%eax
+  8038d2:	0f 8e b2 00 00 00    	jle    80398a <spawn+0x49b>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8038d8:	83 3f 01             	cmpl   $0x1,(%edi)
+  8038db:	75 e6                	jne    8038c3 <spawn+0x3d4>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8038dd:	8b 47 18             	mov    0x18(%edi),%eax
+  8038e0:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8038e3:	83 f8 01             	cmp    $0x1,%eax
+  8038e6:	19 c0                	sbb    %eax,%eax
+  8038e8:	83 e0 fe             	and    $0xfffffffe,%eax
+  8038eb:	83 c0 07             	add    $0x7,%eax
+  8038ee:	89 85 b4 fb ff ff    	mov    %eax,-0x44c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8038f4:	8b 57 04             	mov    0x4(%edi),%edx
+  8038f7:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+  8038fd:	8b 77 10             	mov    0x10(%edi),%esi
+  803900:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+  803906:	8b 47 14             	mov    0x14(%edi),%eax
+  803909:	89 85 b0 fb ff ff    	mov    %eax,-0x450(%ebp)
+  80390f:	8b 4f 08             	mov    0x8(%edi),%ecx
+  803912:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+	if ((i = PGOFF(va))) {
+  803918:	89 c8                	mov    %ecx,%eax
+  80391a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80391f:	74 1e                	je     80393f <spawn+0x450>
+		va -= i;
+  803921:	29 c1                	sub    %eax,%ecx
+  803923:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+		memsz += i;
+  803929:	01 85 b0 fb ff ff    	add    %eax,-0x450(%ebp)
+		filesz += i;
+  80392f:	01 c6                	add    %eax,%esi
+  803931:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+		fileoffset -= i;
+  803937:	29 c2                	sub    %eax,%edx
+  803939:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+	batch_init(&b);
+  80393f:	83 ec 0c             	sub    $0xc,%esp
+  803942:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  803948:	50                   	push   %eax
+  803949:	e8 b1 ee ff ff       	call   8027ff <batch_init>
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  80394e:	83 c4 10             	add    $0x10,%esp
+  803951:	be 00 00 00 00       	mov    $0x0,%esi
+  803956:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  80395c:	8b 8d b0 fb ff ff    	mov    -0x450(%ebp),%ecx
+  803962:	39 c8                	cmp    %ecx,%eax
+  803964:	0f 46 c8             	cmovbe %eax,%ecx
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  803967:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  80396d:	89 85 b8 fb ff ff    	mov    %eax,-0x448(%ebp)
+  803973:	89 9d ac fb ff ff    	mov    %ebx,-0x454(%ebp)
+  803979:	89 bd a8 fb ff ff    	mov    %edi,-0x458(%ebp)
+  80397f:	89 8d c0 fb ff ff    	mov    %ecx,-0x440(%ebp)
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  803985:	e9 cd fd ff ff       	jmp    803757 <spawn+0x268>
+	close(fd);
+  80398a:	83 ec 0c             	sub    $0xc,%esp
+  80398d:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  803993:	e8 9f f3 ff ff       	call   802d37 <close>
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	struct Batch b;
+	int i, r;
+	cprintf("copy_shared_pages(%x);\n", child);
+  803998:	83 c4 08             	add    $0x8,%esp
+  80399b:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8039a1:	68 9d 4e 80 00       	push   $0x804e9d
+  8039a6:	e8 c8 d2 ff ff       	call   800c73 <cprintf>
+	
+	batch_init(&b);
+  8039ab:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8039b1:	89 04 24             	mov    %eax,(%esp)
+  8039b4:	e8 46 ee ff ff       	call   8027ff <batch_init>
+	
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  8039b9:	83 c4 10             	add    $0x10,%esp
+  8039bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		// Handle PTE flags
+		assert(uvpt[i] & PTE_U);
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+		
+		// Map page (adjacent pages are mapped with one operation)
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  8039c1:	8d bd dc fb ff ff    	lea    -0x424(%ebp),%edi
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  8039c7:	eb 22                	jmp    8039eb <spawn+0x4fc>
+			if (uvpd[i / NPTENTRIES] & PTE_SHARE)
+  8039c9:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8039d0:	f6 c6 04             	test   $0x4,%dh
+  8039d3:	0f 85 97 00 00 00    	jne    803a70 <spawn+0x581>
+			i = ROUNDUP(i + 1, NPTENTRIES) - 1;
+  8039d9:	8d 9e 00 04 00 00    	lea    0x400(%esi),%ebx
+  8039df:	81 e3 00 fc ff ff    	and    $0xfffffc00,%ebx
+  8039e5:	83 eb 01             	sub    $0x1,%ebx
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  8039e8:	83 c3 01             	add    $0x1,%ebx
+  8039eb:	89 de                	mov    %ebx,%esi
+  8039ed:	81 fb fd eb 0e 00    	cmp    $0xeebfd,%ebx
+  8039f3:	0f 87 bd 00 00 00    	ja     803ab6 <spawn+0x5c7>
+		if (! (uvpd[i / NPTENTRIES] & PTE_P))
+  8039f9:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+  8039ff:	85 db                	test   %ebx,%ebx
+  803a01:	0f 49 c3             	cmovns %ebx,%eax
+  803a04:	c1 f8 0a             	sar    $0xa,%eax
+  803a07:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803a0e:	f6 c2 01             	test   $0x1,%dl
+  803a11:	74 d5                	je     8039e8 <spawn+0x4f9>
+		if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  803a13:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803a1a:	f6 c2 80             	test   $0x80,%dl
+  803a1d:	75 aa                	jne    8039c9 <spawn+0x4da>
+		if (! (uvpt[i] & PTE_P))
+  803a1f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803a26:	a8 01                	test   $0x1,%al
+  803a28:	74 be                	je     8039e8 <spawn+0x4f9>
+		if (! (uvpt[i] & PTE_SHARE))
+  803a2a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803a31:	f6 c4 04             	test   $0x4,%ah
+  803a34:	74 b2                	je     8039e8 <spawn+0x4f9>
+		assert(uvpt[i] & PTE_U);
+  803a36:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803a3d:	a8 04                	test   $0x4,%al
+  803a3f:	74 5c                	je     803a9d <spawn+0x5ae>
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  803a41:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  803a48:	89 da                	mov    %ebx,%edx
+  803a4a:	c1 e2 0c             	shl    $0xc,%edx
+  803a4d:	83 ec 04             	sub    $0x4,%esp
+  803a50:	6a 01                	push   $0x1
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  803a52:	25 07 0e 00 00       	and    $0xe07,%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  803a57:	50                   	push   %eax
+  803a58:	52                   	push   %edx
+  803a59:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  803a5f:	52                   	push   %edx
+  803a60:	6a 00                	push   $0x0
+  803a62:	57                   	push   %edi
+  803a63:	e8 43 ef ff ff       	call   8029ab <batch_map>
+  803a68:	83 c4 20             	add    $0x20,%esp
+  803a6b:	e9 78 ff ff ff       	jmp    8039e8 <spawn+0x4f9>
+					  uvpd[i / NPTENTRIES] & PTE_SYSCALL, 1);
+  803a70:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+					  (void *) (i * PGSIZE),
+  803a77:	c1 e3 0c             	shl    $0xc,%ebx
+				batch_map(&b, 0, (void *) (i * PGSIZE), child,
+  803a7a:	83 ec 04             	sub    $0x4,%esp
+  803a7d:	6a 01                	push   $0x1
+  803a7f:	25 07 0e 00 00       	and    $0xe07,%eax
+  803a84:	50                   	push   %eax
+  803a85:	53                   	push   %ebx
+  803a86:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  803a8c:	53                   	push   %ebx
+  803a8d:	6a 00                	push   $0x0
+  803a8f:	57                   	push   %edi
+  803a90:	e8 16 ef ff ff       	call   8029ab <batch_map>
+  803a95:	83 c4 20             	add    $0x20,%esp
+  803a98:	e9 3c ff ff ff       	jmp    8039d9 <spawn+0x4ea>
+		assert(uvpt[i] & PTE_U);
+  803a9d:	68 b5 4e 80 00       	push   $0x804eb5
+  803aa2:	68 31 48 80 00       	push   $0x804831
+  803aa7:	68 58 01 00 00       	push   $0x158
+  803aac:	68 74 4e 80 00       	push   $0x804e74
+  803ab1:	e8 e2 d0 ff ff       	call   800b98 <_panic>
+	}
+	if ((r = batch_flush(&b)) < 0)
+  803ab6:	83 ec 0c             	sub    $0xc,%esp
+  803ab9:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  803abf:	50                   	push   %eax
+  803ac0:	e8 56 ed ff ff       	call   80281b <batch_flush>
+  803ac5:	83 c4 10             	add    $0x10,%esp
+  803ac8:	85 c0                	test   %eax,%eax
+  803aca:	78 44                	js     803b10 <spawn+0x621>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803acc:	83 ec 08             	sub    $0x8,%esp
+  803acf:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803ad5:	50                   	push   %eax
+  803ad6:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  803adc:	e8 73 df ff ff       	call   801a54 <sys_env_set_trapframe>
+  803ae1:	83 c4 10             	add    $0x10,%esp
+  803ae4:	85 c0                	test   %eax,%eax
+  803ae6:	78 3d                	js     803b25 <spawn+0x636>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803ae8:	83 ec 08             	sub    $0x8,%esp
+  803aeb:	6a 02                	push   $0x2
+  803aed:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  803af3:	e8 f1 de ff ff       	call   8019e9 <sys_env_set_status>
+  803af8:	83 c4 10             	add    $0x10,%esp
+  803afb:	85 c0                	test   %eax,%eax
+  803afd:	78 3b                	js     803b3a <spawn+0x64b>
+	return child;
+  803aff:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  803b05:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  803b0b:	e9 80 00 00 00       	jmp    803b90 <spawn+0x6a1>
+		panic("cannot map page: %e", r);
+  803b10:	50                   	push   %eax
+  803b11:	68 c5 4e 80 00       	push   $0x804ec5
+  803b16:	68 5f 01 00 00       	push   $0x15f
+  803b1b:	68 74 4e 80 00       	push   $0x804e74
+  803b20:	e8 73 d0 ff ff       	call   800b98 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  803b25:	50                   	push   %eax
+  803b26:	68 d9 4e 80 00       	push   $0x804ed9
+  803b2b:	68 87 00 00 00       	push   $0x87
+  803b30:	68 74 4e 80 00       	push   $0x804e74
+  803b35:	e8 5e d0 ff ff       	call   800b98 <_panic>
+		panic("sys_env_set_status: %e", r);
+  803b3a:	50                   	push   %eax
+  803b3b:	68 f3 4e 80 00       	push   $0x804ef3
+  803b40:	68 8a 00 00 00       	push   $0x8a
+  803b45:	68 74 4e 80 00       	push   $0x804e74
+  803b4a:	e8 49 d0 ff ff       	call   800b98 <_panic>
+  803b4f:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  803b51:	83 ec 0c             	sub    $0xc,%esp
+  803b54:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  803b5a:	e8 4f dc ff ff       	call   8017ae <sys_env_destroy>
+	close(fd);
+  803b5f:	83 c4 04             	add    $0x4,%esp
+  803b62:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  803b68:	e8 ca f1 ff ff       	call   802d37 <close>
+	return r;
+  803b6d:	83 c4 10             	add    $0x10,%esp
+  803b70:	89 bd d0 fb ff ff    	mov    %edi,-0x430(%ebp)
+  803b76:	eb 18                	jmp    803b90 <spawn+0x6a1>
+  803b78:	89 c7                	mov    %eax,%edi
+  803b7a:	eb d5                	jmp    803b51 <spawn+0x662>
+  803b7c:	89 c7                	mov    %eax,%edi
+  803b7e:	eb d1                	jmp    803b51 <spawn+0x662>
+  803b80:	89 c7                	mov    %eax,%edi
+  803b82:	eb cd                	jmp    803b51 <spawn+0x662>
+		return r;
+  803b84:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  803b8a:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+}
+  803b90:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+  803b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b99:	5b                   	pop    %ebx
+  803b9a:	5e                   	pop    %esi
+  803b9b:	5f                   	pop    %edi
+  803b9c:	5d                   	pop    %ebp
+  803b9d:	c3                   	ret
+		return -E_NO_MEM;
+  803b9e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  803ba3:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  803ba9:	eb e5                	jmp    803b90 <spawn+0x6a1>
+	sys_page_unmap(0, UTEMP);
+  803bab:	83 ec 08             	sub    $0x8,%esp
+  803bae:	68 00 00 40 00       	push   $0x400000
+  803bb3:	6a 00                	push   $0x0
+  803bb5:	e8 c4 dd ff ff       	call   80197e <sys_page_unmap>
+  803bba:	83 c4 10             	add    $0x10,%esp
+  803bbd:	89 9d d0 fb ff ff    	mov    %ebx,-0x430(%ebp)
+  803bc3:	eb cb                	jmp    803b90 <spawn+0x6a1>
+
+00803bc5 <spawnl>:
+{
+  803bc5:	55                   	push   %ebp
+  803bc6:	89 e5                	mov    %esp,%ebp
+  803bc8:	56                   	push   %esi
+  803bc9:	53                   	push   %ebx
+	va_start(vl, arg0);
+  803bca:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  803bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  803bd2:	eb 05                	jmp    803bd9 <spawnl+0x14>
+		argc++;
+  803bd4:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  803bd7:	89 ca                	mov    %ecx,%edx
+  803bd9:	8d 4a 04             	lea    0x4(%edx),%ecx
+  803bdc:	83 3a 00             	cmpl   $0x0,(%edx)
+  803bdf:	75 f3                	jne    803bd4 <spawnl+0xf>
+	const char *argv[argc+2];
+  803be1:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  803be8:	83 e2 f0             	and    $0xfffffff0,%edx
+  803beb:	29 d4                	sub    %edx,%esp
+  803bed:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803bf1:	89 da                	mov    %ebx,%edx
+  803bf3:	c1 ea 02             	shr    $0x2,%edx
+  803bf6:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  803bf9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803bfc:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  803c03:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  803c0a:	00 
+	va_start(vl, arg0);
+  803c0b:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  803c0e:	89 c2                	mov    %eax,%edx
+  803c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c15:	eb 0b                	jmp    803c22 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  803c17:	83 c0 01             	add    $0x1,%eax
+  803c1a:	8b 31                	mov    (%ecx),%esi
+  803c1c:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803c1f:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803c22:	39 d0                	cmp    %edx,%eax
+  803c24:	75 f1                	jne    803c17 <spawnl+0x52>
+	return spawn(prog, argv);
+  803c26:	83 ec 08             	sub    $0x8,%esp
+  803c29:	53                   	push   %ebx
+  803c2a:	ff 75 08             	push   0x8(%ebp)
+  803c2d:	e8 bd f8 ff ff       	call   8034ef <spawn>
+}
+  803c32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c35:	5b                   	pop    %ebx
+  803c36:	5e                   	pop    %esi
+  803c37:	5d                   	pop    %ebp
+  803c38:	c3                   	ret
+
+00803c39 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803c39:	55                   	push   %ebp
+  803c3a:	89 e5                	mov    %esp,%ebp
+  803c3c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803c3f:	68 32 4f 80 00       	push   $0x804f32
+  803c44:	ff 75 0c             	push   0xc(%ebp)
+  803c47:	e8 5f d7 ff ff       	call   8013ab <strcpy>
+	return 0;
+}
+  803c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c51:	c9                   	leave
+  803c52:	c3                   	ret
+
+00803c53 <devsock_close>:
+{
+  803c53:	55                   	push   %ebp
+  803c54:	89 e5                	mov    %esp,%ebp
+  803c56:	53                   	push   %ebx
+  803c57:	83 ec 10             	sub    $0x10,%esp
+  803c5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803c5d:	53                   	push   %ebx
+  803c5e:	e8 51 0a 00 00       	call   8046b4 <pageref>
+  803c63:	89 c2                	mov    %eax,%edx
+  803c65:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  803c68:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803c6d:	83 fa 01             	cmp    $0x1,%edx
+  803c70:	74 05                	je     803c77 <devsock_close+0x24>
+}
+  803c72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c75:	c9                   	leave
+  803c76:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  803c77:	83 ec 0c             	sub    $0xc,%esp
+  803c7a:	ff 73 0c             	push   0xc(%ebx)
+  803c7d:	e8 b7 02 00 00       	call   803f39 <nsipc_close>
+  803c82:	83 c4 10             	add    $0x10,%esp
+  803c85:	eb eb                	jmp    803c72 <devsock_close+0x1f>
+
+00803c87 <devsock_write>:
+{
+  803c87:	55                   	push   %ebp
+  803c88:	89 e5                	mov    %esp,%ebp
+  803c8a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803c8d:	6a 00                	push   $0x0
+  803c8f:	ff 75 10             	push   0x10(%ebp)
+  803c92:	ff 75 0c             	push   0xc(%ebp)
+  803c95:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c98:	ff 70 0c             	push   0xc(%eax)
+  803c9b:	e8 79 03 00 00       	call   804019 <nsipc_send>
+}
+  803ca0:	c9                   	leave
+  803ca1:	c3                   	ret
+
+00803ca2 <devsock_read>:
+{
+  803ca2:	55                   	push   %ebp
+  803ca3:	89 e5                	mov    %esp,%ebp
+  803ca5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803ca8:	6a 00                	push   $0x0
+  803caa:	ff 75 10             	push   0x10(%ebp)
+  803cad:	ff 75 0c             	push   0xc(%ebp)
+  803cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cb3:	ff 70 0c             	push   0xc(%eax)
+  803cb6:	e8 ef 02 00 00       	call   803faa <nsipc_recv>
+}
+  803cbb:	c9                   	leave
+  803cbc:	c3                   	ret
+
+00803cbd <fd2sockid>:
+{
+  803cbd:	55                   	push   %ebp
+  803cbe:	89 e5                	mov    %esp,%ebp
+  803cc0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803cc3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803cc6:	52                   	push   %edx
+  803cc7:	50                   	push   %eax
+  803cc8:	e8 20 ef ff ff       	call   802bed <fd_lookup>
+  803ccd:	83 c4 10             	add    $0x10,%esp
+  803cd0:	85 c0                	test   %eax,%eax
+  803cd2:	78 10                	js     803ce4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803cd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cd7:	8b 0d 3c 50 80 00    	mov    0x80503c,%ecx
+  803cdd:	39 08                	cmp    %ecx,(%eax)
+  803cdf:	75 05                	jne    803ce6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803ce1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803ce4:	c9                   	leave
+  803ce5:	c3                   	ret
+		return -E_NOT_SUPP;
+  803ce6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803ceb:	eb f7                	jmp    803ce4 <fd2sockid+0x27>
+
+00803ced <alloc_sockfd>:
+{
+  803ced:	55                   	push   %ebp
+  803cee:	89 e5                	mov    %esp,%ebp
+  803cf0:	56                   	push   %esi
+  803cf1:	53                   	push   %ebx
+  803cf2:	83 ec 1c             	sub    $0x1c,%esp
+  803cf5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803cf7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803cfa:	50                   	push   %eax
+  803cfb:	e8 97 ee ff ff       	call   802b97 <fd_alloc>
+  803d00:	89 c3                	mov    %eax,%ebx
+  803d02:	83 c4 10             	add    $0x10,%esp
+  803d05:	85 c0                	test   %eax,%eax
+  803d07:	78 43                	js     803d4c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803d09:	83 ec 04             	sub    $0x4,%esp
+  803d0c:	68 07 04 00 00       	push   $0x407
+  803d11:	ff 75 f4             	push   -0xc(%ebp)
+  803d14:	6a 00                	push   $0x0
+  803d16:	e8 88 db ff ff       	call   8018a3 <sys_page_alloc>
+  803d1b:	89 c3                	mov    %eax,%ebx
+  803d1d:	83 c4 10             	add    $0x10,%esp
+  803d20:	85 c0                	test   %eax,%eax
+  803d22:	78 28                	js     803d4c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803d24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d27:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803d2d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803d2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d32:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803d39:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803d3c:	83 ec 0c             	sub    $0xc,%esp
+  803d3f:	50                   	push   %eax
+  803d40:	e8 2b ee ff ff       	call   802b70 <fd2num>
+  803d45:	89 c3                	mov    %eax,%ebx
+  803d47:	83 c4 10             	add    $0x10,%esp
+  803d4a:	eb 0c                	jmp    803d58 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803d4c:	83 ec 0c             	sub    $0xc,%esp
+  803d4f:	56                   	push   %esi
+  803d50:	e8 e4 01 00 00       	call   803f39 <nsipc_close>
+		return r;
+  803d55:	83 c4 10             	add    $0x10,%esp
+}
+  803d58:	89 d8                	mov    %ebx,%eax
+  803d5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d5d:	5b                   	pop    %ebx
+  803d5e:	5e                   	pop    %esi
+  803d5f:	5d                   	pop    %ebp
+  803d60:	c3                   	ret
+
+00803d61 <accept>:
+{
+  803d61:	55                   	push   %ebp
+  803d62:	89 e5                	mov    %esp,%ebp
+  803d64:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803d67:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d6a:	e8 4e ff ff ff       	call   803cbd <fd2sockid>
+  803d6f:	85 c0                	test   %eax,%eax
+  803d71:	78 1b                	js     803d8e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803d73:	83 ec 04             	sub    $0x4,%esp
+  803d76:	ff 75 10             	push   0x10(%ebp)
+  803d79:	ff 75 0c             	push   0xc(%ebp)
+  803d7c:	50                   	push   %eax
+  803d7d:	e8 0e 01 00 00       	call   803e90 <nsipc_accept>
+  803d82:	83 c4 10             	add    $0x10,%esp
+  803d85:	85 c0                	test   %eax,%eax
+  803d87:	78 05                	js     803d8e <accept+0x2d>
+	return alloc_sockfd(r);
+  803d89:	e8 5f ff ff ff       	call   803ced <alloc_sockfd>
+}
+  803d8e:	c9                   	leave
+  803d8f:	c3                   	ret
+
+00803d90 <bind>:
+{
+  803d90:	55                   	push   %ebp
+  803d91:	89 e5                	mov    %esp,%ebp
+  803d93:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d99:	e8 1f ff ff ff       	call   803cbd <fd2sockid>
+  803d9e:	85 c0                	test   %eax,%eax
+  803da0:	78 12                	js     803db4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803da2:	83 ec 04             	sub    $0x4,%esp
+  803da5:	ff 75 10             	push   0x10(%ebp)
+  803da8:	ff 75 0c             	push   0xc(%ebp)
+  803dab:	50                   	push   %eax
+  803dac:	e8 31 01 00 00       	call   803ee2 <nsipc_bind>
+  803db1:	83 c4 10             	add    $0x10,%esp
+}
+  803db4:	c9                   	leave
+  803db5:	c3                   	ret
+
+00803db6 <shutdown>:
+{
+  803db6:	55                   	push   %ebp
+  803db7:	89 e5                	mov    %esp,%ebp
+  803db9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dbf:	e8 f9 fe ff ff       	call   803cbd <fd2sockid>
+  803dc4:	85 c0                	test   %eax,%eax
+  803dc6:	78 0f                	js     803dd7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803dc8:	83 ec 08             	sub    $0x8,%esp
+  803dcb:	ff 75 0c             	push   0xc(%ebp)
+  803dce:	50                   	push   %eax
+  803dcf:	e8 43 01 00 00       	call   803f17 <nsipc_shutdown>
+  803dd4:	83 c4 10             	add    $0x10,%esp
+}
+  803dd7:	c9                   	leave
+  803dd8:	c3                   	ret
+
+00803dd9 <connect>:
+{
+  803dd9:	55                   	push   %ebp
+  803dda:	89 e5                	mov    %esp,%ebp
+  803ddc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803ddf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803de2:	e8 d6 fe ff ff       	call   803cbd <fd2sockid>
+  803de7:	85 c0                	test   %eax,%eax
+  803de9:	78 12                	js     803dfd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803deb:	83 ec 04             	sub    $0x4,%esp
+  803dee:	ff 75 10             	push   0x10(%ebp)
+  803df1:	ff 75 0c             	push   0xc(%ebp)
+  803df4:	50                   	push   %eax
+  803df5:	e8 59 01 00 00       	call   803f53 <nsipc_connect>
+  803dfa:	83 c4 10             	add    $0x10,%esp
+}
+  803dfd:	c9                   	leave
+  803dfe:	c3                   	ret
+
+00803dff <listen>:
+{
+  803dff:	55                   	push   %ebp
+  803e00:	89 e5                	mov    %esp,%ebp
+  803e02:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803e05:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e08:	e8 b0 fe ff ff       	call   803cbd <fd2sockid>
+  803e0d:	85 c0                	test   %eax,%eax
+  803e0f:	78 0f                	js     803e20 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803e11:	83 ec 08             	sub    $0x8,%esp
+  803e14:	ff 75 0c             	push   0xc(%ebp)
+  803e17:	50                   	push   %eax
+  803e18:	e8 6b 01 00 00       	call   803f88 <nsipc_listen>
+  803e1d:	83 c4 10             	add    $0x10,%esp
+}
+  803e20:	c9                   	leave
+  803e21:	c3                   	ret
+
+00803e22 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803e22:	55                   	push   %ebp
+  803e23:	89 e5                	mov    %esp,%ebp
+  803e25:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803e28:	ff 75 10             	push   0x10(%ebp)
+  803e2b:	ff 75 0c             	push   0xc(%ebp)
+  803e2e:	ff 75 08             	push   0x8(%ebp)
+  803e31:	e8 41 02 00 00       	call   804077 <nsipc_socket>
+  803e36:	83 c4 10             	add    $0x10,%esp
+  803e39:	85 c0                	test   %eax,%eax
+  803e3b:	78 05                	js     803e42 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803e3d:	e8 ab fe ff ff       	call   803ced <alloc_sockfd>
+}
+  803e42:	c9                   	leave
+  803e43:	c3                   	ret
+
+00803e44 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803e44:	55                   	push   %ebp
+  803e45:	89 e5                	mov    %esp,%ebp
+  803e47:	53                   	push   %ebx
+  803e48:	83 ec 04             	sub    $0x4,%esp
+  803e4b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803e4d:	83 3d 24 64 80 00 00 	cmpl   $0x0,0x806424
+  803e54:	74 26                	je     803e7c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803e56:	6a 07                	push   $0x7
+  803e58:	68 00 80 80 00       	push   $0x808000
+  803e5d:	53                   	push   %ebx
+  803e5e:	ff 35 24 64 80 00    	push   0x806424
+  803e64:	e8 b8 07 00 00       	call   804621 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803e69:	83 c4 0c             	add    $0xc,%esp
+  803e6c:	6a 00                	push   $0x0
+  803e6e:	6a 00                	push   $0x0
+  803e70:	6a 00                	push   $0x0
+  803e72:	e8 92 07 00 00       	call   804609 <ipc_recv>
+}
+  803e77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e7a:	c9                   	leave
+  803e7b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803e7c:	83 ec 0c             	sub    $0xc,%esp
+  803e7f:	6a 02                	push   $0x2
+  803e81:	e8 ef 07 00 00       	call   804675 <ipc_find_env>
+  803e86:	a3 24 64 80 00       	mov    %eax,0x806424
+  803e8b:	83 c4 10             	add    $0x10,%esp
+  803e8e:	eb c6                	jmp    803e56 <nsipc+0x12>
+
+00803e90 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803e90:	55                   	push   %ebp
+  803e91:	89 e5                	mov    %esp,%ebp
+  803e93:	56                   	push   %esi
+  803e94:	53                   	push   %ebx
+  803e95:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803e98:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e9b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  803ea0:	8b 06                	mov    (%esi),%eax
+  803ea2:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803ea7:	b8 01 00 00 00       	mov    $0x1,%eax
+  803eac:	e8 93 ff ff ff       	call   803e44 <nsipc>
+  803eb1:	89 c3                	mov    %eax,%ebx
+  803eb3:	85 c0                	test   %eax,%eax
+  803eb5:	79 09                	jns    803ec0 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803eb7:	89 d8                	mov    %ebx,%eax
+  803eb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ebc:	5b                   	pop    %ebx
+  803ebd:	5e                   	pop    %esi
+  803ebe:	5d                   	pop    %ebp
+  803ebf:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803ec0:	83 ec 04             	sub    $0x4,%esp
+  803ec3:	ff 35 10 80 80 00    	push   0x808010
+  803ec9:	68 00 80 80 00       	push   $0x808000
+  803ece:	ff 75 0c             	push   0xc(%ebp)
+  803ed1:	e8 5b d6 ff ff       	call   801531 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803ed6:	a1 10 80 80 00       	mov    0x808010,%eax
+  803edb:	89 06                	mov    %eax,(%esi)
+  803edd:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803ee0:	eb d5                	jmp    803eb7 <nsipc_accept+0x27>
+
+00803ee2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803ee2:	55                   	push   %ebp
+  803ee3:	89 e5                	mov    %esp,%ebp
+  803ee5:	53                   	push   %ebx
+  803ee6:	83 ec 08             	sub    $0x8,%esp
+  803ee9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803eec:	8b 45 08             	mov    0x8(%ebp),%eax
+  803eef:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803ef4:	53                   	push   %ebx
+  803ef5:	ff 75 0c             	push   0xc(%ebp)
+  803ef8:	68 04 80 80 00       	push   $0x808004
+  803efd:	e8 2f d6 ff ff       	call   801531 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803f02:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  803f08:	b8 02 00 00 00       	mov    $0x2,%eax
+  803f0d:	e8 32 ff ff ff       	call   803e44 <nsipc>
+}
+  803f12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f15:	c9                   	leave
+  803f16:	c3                   	ret
+
+00803f17 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803f17:	55                   	push   %ebp
+  803f18:	89 e5                	mov    %esp,%ebp
+  803f1a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f20:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  803f25:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f28:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  803f2d:	b8 03 00 00 00       	mov    $0x3,%eax
+  803f32:	e8 0d ff ff ff       	call   803e44 <nsipc>
+}
+  803f37:	c9                   	leave
+  803f38:	c3                   	ret
+
+00803f39 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803f39:	55                   	push   %ebp
+  803f3a:	89 e5                	mov    %esp,%ebp
+  803f3c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803f3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f42:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  803f47:	b8 04 00 00 00       	mov    $0x4,%eax
+  803f4c:	e8 f3 fe ff ff       	call   803e44 <nsipc>
+}
+  803f51:	c9                   	leave
+  803f52:	c3                   	ret
+
+00803f53 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803f53:	55                   	push   %ebp
+  803f54:	89 e5                	mov    %esp,%ebp
+  803f56:	53                   	push   %ebx
+  803f57:	83 ec 08             	sub    $0x8,%esp
+  803f5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f60:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803f65:	53                   	push   %ebx
+  803f66:	ff 75 0c             	push   0xc(%ebp)
+  803f69:	68 04 80 80 00       	push   $0x808004
+  803f6e:	e8 be d5 ff ff       	call   801531 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803f73:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  803f79:	b8 05 00 00 00       	mov    $0x5,%eax
+  803f7e:	e8 c1 fe ff ff       	call   803e44 <nsipc>
+}
+  803f83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f86:	c9                   	leave
+  803f87:	c3                   	ret
+
+00803f88 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803f88:	55                   	push   %ebp
+  803f89:	89 e5                	mov    %esp,%ebp
+  803f8b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  803f8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f91:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  803f96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f99:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  803f9e:	b8 06 00 00 00       	mov    $0x6,%eax
+  803fa3:	e8 9c fe ff ff       	call   803e44 <nsipc>
+}
+  803fa8:	c9                   	leave
+  803fa9:	c3                   	ret
+
+00803faa <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803faa:	55                   	push   %ebp
+  803fab:	89 e5                	mov    %esp,%ebp
+  803fad:	56                   	push   %esi
+  803fae:	53                   	push   %ebx
+  803faf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803fb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fb5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  803fba:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  803fc0:	8b 45 14             	mov    0x14(%ebp),%eax
+  803fc3:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803fc8:	b8 07 00 00 00       	mov    $0x7,%eax
+  803fcd:	e8 72 fe ff ff       	call   803e44 <nsipc>
+  803fd2:	89 c3                	mov    %eax,%ebx
+  803fd4:	85 c0                	test   %eax,%eax
+  803fd6:	78 22                	js     803ffa <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803fd8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803fdd:	39 c6                	cmp    %eax,%esi
+  803fdf:	0f 4e c6             	cmovle %esi,%eax
+  803fe2:	39 c3                	cmp    %eax,%ebx
+  803fe4:	7f 1d                	jg     804003 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803fe6:	83 ec 04             	sub    $0x4,%esp
+  803fe9:	53                   	push   %ebx
+  803fea:	68 00 80 80 00       	push   $0x808000
+  803fef:	ff 75 0c             	push   0xc(%ebp)
+  803ff2:	e8 3a d5 ff ff       	call   801531 <memmove>
+  803ff7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803ffa:	89 d8                	mov    %ebx,%eax
+  803ffc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803fff:	5b                   	pop    %ebx
+  804000:	5e                   	pop    %esi
+  804001:	5d                   	pop    %ebp
+  804002:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  804003:	68 3e 4f 80 00       	push   $0x804f3e
+  804008:	68 31 48 80 00       	push   $0x804831
+  80400d:	6a 62                	push   $0x62
+  80400f:	68 53 4f 80 00       	push   $0x804f53
+  804014:	e8 7f cb ff ff       	call   800b98 <_panic>
+
+00804019 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804019:	55                   	push   %ebp
+  80401a:	89 e5                	mov    %esp,%ebp
+  80401c:	53                   	push   %ebx
+  80401d:	83 ec 04             	sub    $0x4,%esp
+  804020:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  804023:	8b 45 08             	mov    0x8(%ebp),%eax
+  804026:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80402b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  804031:	7f 2e                	jg     804061 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  804033:	83 ec 04             	sub    $0x4,%esp
+  804036:	53                   	push   %ebx
+  804037:	ff 75 0c             	push   0xc(%ebp)
+  80403a:	68 0c 80 80 00       	push   $0x80800c
+  80403f:	e8 ed d4 ff ff       	call   801531 <memmove>
+	nsipcbuf.send.req_size = size;
+  804044:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80404a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80404d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  804052:	b8 08 00 00 00       	mov    $0x8,%eax
+  804057:	e8 e8 fd ff ff       	call   803e44 <nsipc>
+}
+  80405c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80405f:	c9                   	leave
+  804060:	c3                   	ret
+	assert(size < 1600);
+  804061:	68 5f 4f 80 00       	push   $0x804f5f
+  804066:	68 31 48 80 00       	push   $0x804831
+  80406b:	6a 6d                	push   $0x6d
+  80406d:	68 53 4f 80 00       	push   $0x804f53
+  804072:	e8 21 cb ff ff       	call   800b98 <_panic>
+
+00804077 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804077:	55                   	push   %ebp
+  804078:	89 e5                	mov    %esp,%ebp
+  80407a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80407d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804080:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  804085:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804088:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80408d:	8b 45 10             	mov    0x10(%ebp),%eax
+  804090:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  804095:	b8 09 00 00 00       	mov    $0x9,%eax
+  80409a:	e8 a5 fd ff ff       	call   803e44 <nsipc>
+}
+  80409f:	c9                   	leave
+  8040a0:	c3                   	ret
+
+008040a1 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8040a1:	55                   	push   %ebp
+  8040a2:	89 e5                	mov    %esp,%ebp
+  8040a4:	56                   	push   %esi
+  8040a5:	53                   	push   %ebx
+  8040a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8040a9:	83 ec 0c             	sub    $0xc,%esp
+  8040ac:	ff 75 08             	push   0x8(%ebp)
+  8040af:	e8 cc ea ff ff       	call   802b80 <fd2data>
+  8040b4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8040b6:	83 c4 08             	add    $0x8,%esp
+  8040b9:	68 6b 4f 80 00       	push   $0x804f6b
+  8040be:	53                   	push   %ebx
+  8040bf:	e8 e7 d2 ff ff       	call   8013ab <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8040c4:	8b 46 04             	mov    0x4(%esi),%eax
+  8040c7:	2b 06                	sub    (%esi),%eax
+  8040c9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8040cf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8040d6:	00 00 00 
+	stat->st_dev = &devpipe;
+  8040d9:	c7 83 88 00 00 00 58 	movl   $0x805058,0x88(%ebx)
+  8040e0:	50 80 00 
+	return 0;
+}
+  8040e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040eb:	5b                   	pop    %ebx
+  8040ec:	5e                   	pop    %esi
+  8040ed:	5d                   	pop    %ebp
+  8040ee:	c3                   	ret
+
+008040ef <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8040ef:	55                   	push   %ebp
+  8040f0:	89 e5                	mov    %esp,%ebp
+  8040f2:	53                   	push   %ebx
+  8040f3:	83 ec 0c             	sub    $0xc,%esp
+  8040f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8040f9:	53                   	push   %ebx
+  8040fa:	6a 00                	push   $0x0
+  8040fc:	e8 7d d8 ff ff       	call   80197e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  804101:	89 1c 24             	mov    %ebx,(%esp)
+  804104:	e8 77 ea ff ff       	call   802b80 <fd2data>
+  804109:	83 c4 08             	add    $0x8,%esp
+  80410c:	50                   	push   %eax
+  80410d:	6a 00                	push   $0x0
+  80410f:	e8 6a d8 ff ff       	call   80197e <sys_page_unmap>
+}
+  804114:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804117:	c9                   	leave
+  804118:	c3                   	ret
+
+00804119 <_pipeisclosed>:
+{
+  804119:	55                   	push   %ebp
+  80411a:	89 e5                	mov    %esp,%ebp
+  80411c:	57                   	push   %edi
+  80411d:	56                   	push   %esi
+  80411e:	53                   	push   %ebx
+  80411f:	83 ec 1c             	sub    $0x1c,%esp
+  804122:	89 c7                	mov    %eax,%edi
+  804124:	89 d6                	mov    %edx,%esi
+  804126:	eb 3c                	jmp    804164 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  804128:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  80412b:	83 ec 0c             	sub    $0xc,%esp
+  80412e:	57                   	push   %edi
+  80412f:	e8 80 05 00 00       	call   8046b4 <pageref>
+  804134:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804137:	89 34 24             	mov    %esi,(%esp)
+  80413a:	e8 75 05 00 00       	call   8046b4 <pageref>
+  80413f:	89 c2                	mov    %eax,%edx
+  804141:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  804143:	05 00 00 00 20       	add    $0x20000000,%eax
+  804148:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80414b:	8b 0d 28 64 80 00    	mov    0x806428,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  804151:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  804156:	76 31                	jbe    804189 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  804158:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80415b:	39 c3                	cmp    %eax,%ebx
+  80415d:	74 76                	je     8041d5 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80415f:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  804162:	74 36                	je     80419a <_pipeisclosed+0x81>
+  804164:	89 e0                	mov    %esp,%eax
+  804166:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80416b:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  804171:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  804176:	77 b0                	ja     804128 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  804178:	c1 e8 10             	shr    $0x10,%eax
+  80417b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  804181:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  804187:	eb 9f                	jmp    804128 <_pipeisclosed+0xf>
+  804189:	c1 e8 10             	shr    $0x10,%eax
+  80418c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  804192:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  804198:	eb be                	jmp    804158 <_pipeisclosed+0x3f>
+  80419a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80419c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8041a1:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8041a7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8041ac:	76 16                	jbe    8041c4 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8041ae:	8b 42 58             	mov    0x58(%edx),%eax
+  8041b1:	6a 01                	push   $0x1
+  8041b3:	50                   	push   %eax
+  8041b4:	53                   	push   %ebx
+  8041b5:	68 72 4f 80 00       	push   $0x804f72
+  8041ba:	e8 b4 ca ff ff       	call   800c73 <cprintf>
+  8041bf:	83 c4 10             	add    $0x10,%esp
+  8041c2:	eb a0                	jmp    804164 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8041c4:	c1 e8 10             	shr    $0x10,%eax
+  8041c7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8041cd:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8041d3:	eb d9                	jmp    8041ae <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8041d5:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8041d8:	0f 94 c0             	sete   %al
+  8041db:	0f b6 c0             	movzbl %al,%eax
+}
+  8041de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041e1:	5b                   	pop    %ebx
+  8041e2:	5e                   	pop    %esi
+  8041e3:	5f                   	pop    %edi
+  8041e4:	5d                   	pop    %ebp
+  8041e5:	c3                   	ret
+
+008041e6 <devpipe_write>:
+{
+  8041e6:	55                   	push   %ebp
+  8041e7:	89 e5                	mov    %esp,%ebp
+  8041e9:	57                   	push   %edi
+  8041ea:	56                   	push   %esi
+  8041eb:	53                   	push   %ebx
+  8041ec:	83 ec 28             	sub    $0x28,%esp
+  8041ef:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8041f2:	56                   	push   %esi
+  8041f3:	e8 88 e9 ff ff       	call   802b80 <fd2data>
+  8041f8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8041fa:	83 c4 10             	add    $0x10,%esp
+  8041fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804202:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  804205:	75 09                	jne    804210 <devpipe_write+0x2a>
+	return i;
+  804207:	89 f8                	mov    %edi,%eax
+  804209:	eb 23                	jmp    80422e <devpipe_write+0x48>
+			sys_yield();
+  80420b:	e8 4d d6 ff ff       	call   80185d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  804210:	8b 43 04             	mov    0x4(%ebx),%eax
+  804213:	8b 0b                	mov    (%ebx),%ecx
+  804215:	8d 51 20             	lea    0x20(%ecx),%edx
+  804218:	39 d0                	cmp    %edx,%eax
+  80421a:	72 1a                	jb     804236 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80421c:	89 da                	mov    %ebx,%edx
+  80421e:	89 f0                	mov    %esi,%eax
+  804220:	e8 f4 fe ff ff       	call   804119 <_pipeisclosed>
+  804225:	85 c0                	test   %eax,%eax
+  804227:	74 e2                	je     80420b <devpipe_write+0x25>
+				return 0;
+  804229:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80422e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804231:	5b                   	pop    %ebx
+  804232:	5e                   	pop    %esi
+  804233:	5f                   	pop    %edi
+  804234:	5d                   	pop    %ebp
+  804235:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804239:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80423d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  804240:	89 c2                	mov    %eax,%edx
+  804242:	c1 fa 1f             	sar    $0x1f,%edx
+  804245:	89 d1                	mov    %edx,%ecx
+  804247:	c1 e9 1b             	shr    $0x1b,%ecx
+  80424a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80424d:	83 e2 1f             	and    $0x1f,%edx
+  804250:	29 ca                	sub    %ecx,%edx
+  804252:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  804256:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80425a:	83 c0 01             	add    $0x1,%eax
+  80425d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  804260:	83 c7 01             	add    $0x1,%edi
+  804263:	eb 9d                	jmp    804202 <devpipe_write+0x1c>
+
+00804265 <devpipe_read>:
+{
+  804265:	55                   	push   %ebp
+  804266:	89 e5                	mov    %esp,%ebp
+  804268:	57                   	push   %edi
+  804269:	56                   	push   %esi
+  80426a:	53                   	push   %ebx
+  80426b:	83 ec 18             	sub    $0x18,%esp
+  80426e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  804271:	57                   	push   %edi
+  804272:	e8 09 e9 ff ff       	call   802b80 <fd2data>
+  804277:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  804279:	83 c4 10             	add    $0x10,%esp
+  80427c:	be 00 00 00 00       	mov    $0x0,%esi
+  804281:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804284:	75 13                	jne    804299 <devpipe_read+0x34>
+	return i;
+  804286:	89 f0                	mov    %esi,%eax
+  804288:	eb 02                	jmp    80428c <devpipe_read+0x27>
+				return i;
+  80428a:	89 f0                	mov    %esi,%eax
+}
+  80428c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80428f:	5b                   	pop    %ebx
+  804290:	5e                   	pop    %esi
+  804291:	5f                   	pop    %edi
+  804292:	5d                   	pop    %ebp
+  804293:	c3                   	ret
+			sys_yield();
+  804294:	e8 c4 d5 ff ff       	call   80185d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  804299:	8b 03                	mov    (%ebx),%eax
+  80429b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80429e:	75 18                	jne    8042b8 <devpipe_read+0x53>
+			if (i > 0)
+  8042a0:	85 f6                	test   %esi,%esi
+  8042a2:	75 e6                	jne    80428a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8042a4:	89 da                	mov    %ebx,%edx
+  8042a6:	89 f8                	mov    %edi,%eax
+  8042a8:	e8 6c fe ff ff       	call   804119 <_pipeisclosed>
+  8042ad:	85 c0                	test   %eax,%eax
+  8042af:	74 e3                	je     804294 <devpipe_read+0x2f>
+				return 0;
+  8042b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b6:	eb d4                	jmp    80428c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8042b8:	99                   	cltd
+  8042b9:	c1 ea 1b             	shr    $0x1b,%edx
+  8042bc:	01 d0                	add    %edx,%eax
+  8042be:	83 e0 1f             	and    $0x1f,%eax
+  8042c1:	29 d0                	sub    %edx,%eax
+  8042c3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8042c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8042cb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8042ce:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8042d1:	83 c6 01             	add    $0x1,%esi
+  8042d4:	eb ab                	jmp    804281 <devpipe_read+0x1c>
+
+008042d6 <pipe>:
+{
+  8042d6:	55                   	push   %ebp
+  8042d7:	89 e5                	mov    %esp,%ebp
+  8042d9:	56                   	push   %esi
+  8042da:	53                   	push   %ebx
+  8042db:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8042de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8042e1:	50                   	push   %eax
+  8042e2:	e8 b0 e8 ff ff       	call   802b97 <fd_alloc>
+  8042e7:	89 c3                	mov    %eax,%ebx
+  8042e9:	83 c4 10             	add    $0x10,%esp
+  8042ec:	85 c0                	test   %eax,%eax
+  8042ee:	0f 88 23 01 00 00    	js     804417 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8042f4:	83 ec 04             	sub    $0x4,%esp
+  8042f7:	68 07 04 00 00       	push   $0x407
+  8042fc:	ff 75 f4             	push   -0xc(%ebp)
+  8042ff:	6a 00                	push   $0x0
+  804301:	e8 9d d5 ff ff       	call   8018a3 <sys_page_alloc>
+  804306:	89 c3                	mov    %eax,%ebx
+  804308:	83 c4 10             	add    $0x10,%esp
+  80430b:	85 c0                	test   %eax,%eax
+  80430d:	0f 88 04 01 00 00    	js     804417 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  804313:	83 ec 0c             	sub    $0xc,%esp
+  804316:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804319:	50                   	push   %eax
+  80431a:	e8 78 e8 ff ff       	call   802b97 <fd_alloc>
+  80431f:	89 c3                	mov    %eax,%ebx
+  804321:	83 c4 10             	add    $0x10,%esp
+  804324:	85 c0                	test   %eax,%eax
+  804326:	0f 88 db 00 00 00    	js     804407 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80432c:	83 ec 04             	sub    $0x4,%esp
+  80432f:	68 07 04 00 00       	push   $0x407
+  804334:	ff 75 f0             	push   -0x10(%ebp)
+  804337:	6a 00                	push   $0x0
+  804339:	e8 65 d5 ff ff       	call   8018a3 <sys_page_alloc>
+  80433e:	89 c3                	mov    %eax,%ebx
+  804340:	83 c4 10             	add    $0x10,%esp
+  804343:	85 c0                	test   %eax,%eax
+  804345:	0f 88 bc 00 00 00    	js     804407 <pipe+0x131>
+	va = fd2data(fd0);
+  80434b:	83 ec 0c             	sub    $0xc,%esp
+  80434e:	ff 75 f4             	push   -0xc(%ebp)
+  804351:	e8 2a e8 ff ff       	call   802b80 <fd2data>
+  804356:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804358:	83 c4 0c             	add    $0xc,%esp
+  80435b:	68 07 04 00 00       	push   $0x407
+  804360:	50                   	push   %eax
+  804361:	6a 00                	push   $0x0
+  804363:	e8 3b d5 ff ff       	call   8018a3 <sys_page_alloc>
+  804368:	89 c3                	mov    %eax,%ebx
+  80436a:	83 c4 10             	add    $0x10,%esp
+  80436d:	85 c0                	test   %eax,%eax
+  80436f:	0f 88 82 00 00 00    	js     8043f7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804375:	83 ec 0c             	sub    $0xc,%esp
+  804378:	ff 75 f0             	push   -0x10(%ebp)
+  80437b:	e8 00 e8 ff ff       	call   802b80 <fd2data>
+  804380:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  804387:	50                   	push   %eax
+  804388:	6a 00                	push   $0x0
+  80438a:	56                   	push   %esi
+  80438b:	6a 00                	push   $0x0
+  80438d:	e8 7e d5 ff ff       	call   801910 <sys_page_map>
+  804392:	89 c3                	mov    %eax,%ebx
+  804394:	83 c4 20             	add    $0x20,%esp
+  804397:	85 c0                	test   %eax,%eax
+  804399:	78 4e                	js     8043e9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80439b:	a1 58 50 80 00       	mov    0x805058,%eax
+  8043a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8043a3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8043a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8043a8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8043af:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8043b2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8043b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8043b7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8043be:	83 ec 0c             	sub    $0xc,%esp
+  8043c1:	ff 75 f4             	push   -0xc(%ebp)
+  8043c4:	e8 a7 e7 ff ff       	call   802b70 <fd2num>
+  8043c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8043cc:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8043ce:	83 c4 04             	add    $0x4,%esp
+  8043d1:	ff 75 f0             	push   -0x10(%ebp)
+  8043d4:	e8 97 e7 ff ff       	call   802b70 <fd2num>
+  8043d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8043dc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8043df:	83 c4 10             	add    $0x10,%esp
+  8043e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043e7:	eb 2e                	jmp    804417 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8043e9:	83 ec 08             	sub    $0x8,%esp
+  8043ec:	56                   	push   %esi
+  8043ed:	6a 00                	push   $0x0
+  8043ef:	e8 8a d5 ff ff       	call   80197e <sys_page_unmap>
+  8043f4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8043f7:	83 ec 08             	sub    $0x8,%esp
+  8043fa:	ff 75 f0             	push   -0x10(%ebp)
+  8043fd:	6a 00                	push   $0x0
+  8043ff:	e8 7a d5 ff ff       	call   80197e <sys_page_unmap>
+  804404:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  804407:	83 ec 08             	sub    $0x8,%esp
+  80440a:	ff 75 f4             	push   -0xc(%ebp)
+  80440d:	6a 00                	push   $0x0
+  80440f:	e8 6a d5 ff ff       	call   80197e <sys_page_unmap>
+  804414:	83 c4 10             	add    $0x10,%esp
+}
+  804417:	89 d8                	mov    %ebx,%eax
+  804419:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80441c:	5b                   	pop    %ebx
+  80441d:	5e                   	pop    %esi
+  80441e:	5d                   	pop    %ebp
+  80441f:	c3                   	ret
+
+00804420 <pipeisclosed>:
+{
+  804420:	55                   	push   %ebp
+  804421:	89 e5                	mov    %esp,%ebp
+  804423:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804426:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804429:	50                   	push   %eax
+  80442a:	ff 75 08             	push   0x8(%ebp)
+  80442d:	e8 bb e7 ff ff       	call   802bed <fd_lookup>
+  804432:	83 c4 10             	add    $0x10,%esp
+  804435:	85 c0                	test   %eax,%eax
+  804437:	78 18                	js     804451 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  804439:	83 ec 0c             	sub    $0xc,%esp
+  80443c:	ff 75 f4             	push   -0xc(%ebp)
+  80443f:	e8 3c e7 ff ff       	call   802b80 <fd2data>
+  804444:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  804446:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804449:	e8 cb fc ff ff       	call   804119 <_pipeisclosed>
+  80444e:	83 c4 10             	add    $0x10,%esp
+}
+  804451:	c9                   	leave
+  804452:	c3                   	ret
+
+00804453 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  804453:	55                   	push   %ebp
+  804454:	89 e5                	mov    %esp,%ebp
+  804456:	56                   	push   %esi
+  804457:	53                   	push   %ebx
+  804458:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80445b:	85 f6                	test   %esi,%esi
+  80445d:	74 16                	je     804475 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  80445f:	89 f3                	mov    %esi,%ebx
+  804461:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804467:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  80446d:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  804473:	eb 1b                	jmp    804490 <wait+0x3d>
+	assert(envid != 0);
+  804475:	68 8a 4f 80 00       	push   $0x804f8a
+  80447a:	68 31 48 80 00       	push   $0x804831
+  80447f:	6a 09                	push   $0x9
+  804481:	68 95 4f 80 00       	push   $0x804f95
+  804486:	e8 0d c7 ff ff       	call   800b98 <_panic>
+		sys_yield();
+  80448b:	e8 cd d3 ff ff       	call   80185d <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804490:	8b 43 48             	mov    0x48(%ebx),%eax
+  804493:	39 f0                	cmp    %esi,%eax
+  804495:	75 07                	jne    80449e <wait+0x4b>
+  804497:	8b 43 54             	mov    0x54(%ebx),%eax
+  80449a:	85 c0                	test   %eax,%eax
+  80449c:	75 ed                	jne    80448b <wait+0x38>
+}
+  80449e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044a1:	5b                   	pop    %ebx
+  8044a2:	5e                   	pop    %esi
+  8044a3:	5d                   	pop    %ebp
+  8044a4:	c3                   	ret
+
+008044a5 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8044a5:	55                   	push   %ebp
+  8044a6:	89 e5                	mov    %esp,%ebp
+  8044a8:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8044ab:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8044b2:	74 0a                	je     8044be <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8044b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044b7:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8044bc:	c9                   	leave
+  8044bd:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8044be:	83 ec 04             	sub    $0x4,%esp
+  8044c1:	6a 07                	push   $0x7
+  8044c3:	68 00 f0 bf ee       	push   $0xeebff000
+  8044c8:	6a 00                	push   $0x0
+  8044ca:	e8 d4 d3 ff ff       	call   8018a3 <sys_page_alloc>
+  8044cf:	83 c4 10             	add    $0x10,%esp
+  8044d2:	85 c0                	test   %eax,%eax
+  8044d4:	78 14                	js     8044ea <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8044d6:	83 ec 08             	sub    $0x8,%esp
+  8044d9:	68 0c 45 80 00       	push   $0x80450c
+  8044de:	6a 00                	push   $0x0
+  8044e0:	e8 da d5 ff ff       	call   801abf <sys_env_set_pgfault_upcall>
+  8044e5:	83 c4 10             	add    $0x10,%esp
+  8044e8:	eb ca                	jmp    8044b4 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8044ea:	83 ec 08             	sub    $0x8,%esp
+  8044ed:	50                   	push   %eax
+  8044ee:	68 70 4c 80 00       	push   $0x804c70
+  8044f3:	e8 7b c7 ff ff       	call   800c73 <cprintf>
+			panic("set_pgfault_handler error");
+  8044f8:	83 c4 0c             	add    $0xc,%esp
+  8044fb:	68 a0 4f 80 00       	push   $0x804fa0
+  804500:	6a 24                	push   $0x24
+  804502:	68 ba 4f 80 00       	push   $0x804fba
+  804507:	e8 8c c6 ff ff       	call   800b98 <_panic>
+
+0080450c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80450c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80450d:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804512:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804514:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  804517:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80451b:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  80451e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  804522:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  804524:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  804528:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  804529:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  80452d:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  80452e:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  80452f:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804533:	c3                   	ret
+
+00804534 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  804534:	55                   	push   %ebp
+  804535:	89 e5                	mov    %esp,%ebp
+  804537:	56                   	push   %esi
+  804538:	53                   	push   %ebx
+  804539:	8b 75 08             	mov    0x8(%ebp),%esi
+  80453c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80453f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  804542:	85 c0                	test   %eax,%eax
+  804544:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804549:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  80454c:	83 ec 08             	sub    $0x8,%esp
+  80454f:	ff 75 14             	push   0x14(%ebp)
+  804552:	50                   	push   %eax
+  804553:	e8 5c d7 ff ff       	call   801cb4 <sys_ipc_recv_until>
+  804558:	83 c4 10             	add    $0x10,%esp
+  80455b:	85 c0                	test   %eax,%eax
+  80455d:	78 61                	js     8045c0 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  80455f:	85 f6                	test   %esi,%esi
+  804561:	74 1c                	je     80457f <ipc_recv_until+0x4b>
+  804563:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  804565:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80456a:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  804570:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  804575:	76 5f                	jbe    8045d6 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  804577:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  80457d:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  80457f:	85 db                	test   %ebx,%ebx
+  804581:	74 1c                	je     80459f <ipc_recv_until+0x6b>
+  804583:	89 e0                	mov    %esp,%eax
+  804585:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80458a:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  804590:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  804595:	76 50                	jbe    8045e7 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  804597:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  80459d:	89 03                	mov    %eax,(%ebx)
+  80459f:	89 e0                	mov    %esp,%eax
+  8045a1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8045a6:	8b 15 28 64 80 00    	mov    0x806428,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8045ac:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8045b1:	76 45                	jbe    8045f8 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  8045b3:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  8045b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8045bc:	5b                   	pop    %ebx
+  8045bd:	5e                   	pop    %esi
+  8045be:	5d                   	pop    %ebp
+  8045bf:	c3                   	ret
+		if (from_env_store)
+  8045c0:	85 f6                	test   %esi,%esi
+  8045c2:	74 06                	je     8045ca <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  8045c4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8045ca:	85 db                	test   %ebx,%ebx
+  8045cc:	74 eb                	je     8045b9 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  8045ce:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8045d4:	eb e3                	jmp    8045b9 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8045d6:	c1 e8 10             	shr    $0x10,%eax
+  8045d9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8045df:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8045e5:	eb 90                	jmp    804577 <ipc_recv_until+0x43>
+  8045e7:	c1 e8 10             	shr    $0x10,%eax
+  8045ea:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8045f0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8045f6:	eb 9f                	jmp    804597 <ipc_recv_until+0x63>
+  8045f8:	c1 e8 10             	shr    $0x10,%eax
+  8045fb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  804601:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  804607:	eb aa                	jmp    8045b3 <ipc_recv_until+0x7f>
+
+00804609 <ipc_recv>:
+{
+  804609:	55                   	push   %ebp
+  80460a:	89 e5                	mov    %esp,%ebp
+  80460c:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  80460f:	6a 00                	push   $0x0
+  804611:	ff 75 10             	push   0x10(%ebp)
+  804614:	ff 75 0c             	push   0xc(%ebp)
+  804617:	ff 75 08             	push   0x8(%ebp)
+  80461a:	e8 15 ff ff ff       	call   804534 <ipc_recv_until>
+}
+  80461f:	c9                   	leave
+  804620:	c3                   	ret
+
+00804621 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  804621:	55                   	push   %ebp
+  804622:	89 e5                	mov    %esp,%ebp
+  804624:	57                   	push   %edi
+  804625:	56                   	push   %esi
+  804626:	53                   	push   %ebx
+  804627:	83 ec 0c             	sub    $0xc,%esp
+  80462a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80462d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804630:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  804633:	85 db                	test   %ebx,%ebx
+  804635:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80463a:	0f 44 d8             	cmove  %eax,%ebx
+  80463d:	eb 05                	jmp    804644 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  80463f:	e8 19 d2 ff ff       	call   80185d <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  804644:	ff 75 14             	push   0x14(%ebp)
+  804647:	53                   	push   %ebx
+  804648:	56                   	push   %esi
+  804649:	57                   	push   %edi
+  80464a:	e8 b1 d5 ff ff       	call   801c00 <sys_ipc_try_send>
+  80464f:	83 c4 10             	add    $0x10,%esp
+  804652:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804655:	74 e8                	je     80463f <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  804657:	85 c0                	test   %eax,%eax
+  804659:	78 08                	js     804663 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  80465b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80465e:	5b                   	pop    %ebx
+  80465f:	5e                   	pop    %esi
+  804660:	5f                   	pop    %edi
+  804661:	5d                   	pop    %ebp
+  804662:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  804663:	50                   	push   %eax
+  804664:	68 c8 4f 80 00       	push   $0x804fc8
+  804669:	6a 4f                	push   $0x4f
+  80466b:	68 db 4f 80 00       	push   $0x804fdb
+  804670:	e8 23 c5 ff ff       	call   800b98 <_panic>
+
+00804675 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804675:	55                   	push   %ebp
+  804676:	89 e5                	mov    %esp,%ebp
+  804678:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80467b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804680:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  804686:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80468c:	8b 52 50             	mov    0x50(%edx),%edx
+  80468f:	39 ca                	cmp    %ecx,%edx
+  804691:	74 11                	je     8046a4 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804693:	83 c0 01             	add    $0x1,%eax
+  804696:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80469b:	75 e3                	jne    804680 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80469d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046a2:	eb 0e                	jmp    8046b2 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8046a4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8046aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8046af:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8046b2:	5d                   	pop    %ebp
+  8046b3:	c3                   	ret
+
+008046b4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8046b4:	55                   	push   %ebp
+  8046b5:	89 e5                	mov    %esp,%ebp
+  8046b7:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8046ba:	89 c2                	mov    %eax,%edx
+  8046bc:	c1 ea 16             	shr    $0x16,%edx
+  8046bf:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8046c6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8046cb:	f6 c1 01             	test   $0x1,%cl
+  8046ce:	74 1a                	je     8046ea <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  8046d0:	c1 e8 0c             	shr    $0xc,%eax
+  8046d3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8046da:	a8 01                	test   $0x1,%al
+  8046dc:	74 0c                	je     8046ea <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8046de:	c1 e8 0c             	shr    $0xc,%eax
+  8046e1:	c1 e0 04             	shl    $0x4,%eax
+  8046e4:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8046ea:	89 d0                	mov    %edx,%eax
+  8046ec:	5d                   	pop    %ebp
+  8046ed:	c3                   	ret
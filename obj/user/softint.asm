@@ -0,0 +1,6150 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	57                   	push   %edi
+  80003a:	56                   	push   %esi
+  80003b:	53                   	push   %ebx
+  80003c:	83 ec 0c             	sub    $0xc,%esp
+  80003f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800045:	b8 01 00 00 00       	mov    $0x1,%eax
+  80004a:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80004c:	c1 ea 0b             	shr    $0xb,%edx
+  80004f:	83 f2 01             	xor    $0x1,%edx
+  800052:	83 e2 01             	and    $0x1,%edx
+  800055:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80005b:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800062:	00 00 00 
+	envid = sys_getenvid();
+  800065:	e8 1f 0c 00 00       	call   800c89 <sys_getenvid>
+  80006a:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80006c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800071:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800077:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80007d:	8b 52 48             	mov    0x48(%edx),%edx
+  800080:	39 ca                	cmp    %ecx,%edx
+  800082:	74 27                	je     8000ab <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800084:	83 c0 01             	add    $0x1,%eax
+  800087:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80008c:	75 e3                	jne    800071 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80008e:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800095:	75 24                	jne    8000bb <libmain+0x85>
+		panic("libmain can't find the environment");
+  800097:	83 ec 04             	sub    $0x4,%esp
+  80009a:	68 40 2b 80 00       	push   $0x802b40
+  80009f:	6a 23                	push   $0x23
+  8000a1:	68 63 2b 80 00       	push   $0x802b63
+  8000a6:	e8 4f 00 00 00       	call   8000fa <_panic>
+			mainenv = &envs[i];
+  8000ab:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000b1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000b6:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bb:	85 ff                	test   %edi,%edi
+  8000bd:	7e 07                	jle    8000c6 <libmain+0x90>
+		binaryname = argv[0];
+  8000bf:	8b 06                	mov    (%esi),%eax
+  8000c1:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000c6:	83 ec 08             	sub    $0x8,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	57                   	push   %edi
+  8000cb:	e8 63 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d0:	e8 0b 00 00 00       	call   8000e0 <exit>
+}
+  8000d5:	83 c4 10             	add    $0x10,%esp
+  8000d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000db:	5b                   	pop    %ebx
+  8000dc:	5e                   	pop    %esi
+  8000dd:	5f                   	pop    %edi
+  8000de:	5d                   	pop    %ebp
+  8000df:	c3                   	ret
+
+008000e0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e0:	55                   	push   %ebp
+  8000e1:	89 e5                	mov    %esp,%ebp
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e6:	e8 94 18 00 00       	call   80197f <close_all>
+	sys_env_destroy(0);
+  8000eb:	83 ec 0c             	sub    $0xc,%esp
+  8000ee:	6a 00                	push   $0x0
+  8000f0:	e8 2b 0b 00 00       	call   800c20 <sys_env_destroy>
+}
+  8000f5:	83 c4 10             	add    $0x10,%esp
+  8000f8:	c9                   	leave
+  8000f9:	c3                   	ret
+
+008000fa <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000fa:	55                   	push   %ebp
+  8000fb:	89 e5                	mov    %esp,%ebp
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8000ff:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800102:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800108:	e8 7c 0b 00 00       	call   800c89 <sys_getenvid>
+  80010d:	83 ec 0c             	sub    $0xc,%esp
+  800110:	ff 75 0c             	push   0xc(%ebp)
+  800113:	ff 75 08             	push   0x8(%ebp)
+  800116:	56                   	push   %esi
+  800117:	50                   	push   %eax
+  800118:	68 7c 2b 80 00       	push   $0x802b7c
+  80011d:	e8 b3 00 00 00       	call   8001d5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800122:	83 c4 18             	add    $0x18,%esp
+  800125:	53                   	push   %ebx
+  800126:	ff 75 10             	push   0x10(%ebp)
+  800129:	e8 56 00 00 00       	call   800184 <vcprintf>
+	cprintf("\n");
+  80012e:	c7 04 24 ec 2f 80 00 	movl   $0x802fec,(%esp)
+  800135:	e8 9b 00 00 00       	call   8001d5 <cprintf>
+  80013a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80013d:	cc                   	int3
+	while (1)
+  80013e:	eb fd                	jmp    80013d <_panic+0x43>
+
+00800140 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800140:	55                   	push   %ebp
+  800141:	89 e5                	mov    %esp,%ebp
+  800143:	53                   	push   %ebx
+  800144:	83 ec 04             	sub    $0x4,%esp
+  800147:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80014a:	8b 13                	mov    (%ebx),%edx
+  80014c:	8d 42 01             	lea    0x1(%edx),%eax
+  80014f:	89 03                	mov    %eax,(%ebx)
+  800151:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800154:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800158:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80015d:	74 09                	je     800168 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80015f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800163:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800166:	c9                   	leave
+  800167:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800168:	83 ec 08             	sub    $0x8,%esp
+  80016b:	68 ff 00 00 00       	push   $0xff
+  800170:	8d 43 08             	lea    0x8(%ebx),%eax
+  800173:	50                   	push   %eax
+  800174:	e8 1d 0a 00 00       	call   800b96 <sys_cputs>
+		b->idx = 0;
+  800179:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80017f:	83 c4 10             	add    $0x10,%esp
+  800182:	eb db                	jmp    80015f <putch+0x1f>
+
+00800184 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800184:	55                   	push   %ebp
+  800185:	89 e5                	mov    %esp,%ebp
+  800187:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80018d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800194:	00 00 00 
+	b.cnt = 0;
+  800197:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80019e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001a1:	ff 75 0c             	push   0xc(%ebp)
+  8001a4:	ff 75 08             	push   0x8(%ebp)
+  8001a7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001ad:	50                   	push   %eax
+  8001ae:	68 40 01 80 00       	push   $0x800140
+  8001b3:	e8 fb 00 00 00       	call   8002b3 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001b8:	83 c4 08             	add    $0x8,%esp
+  8001bb:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001c1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001c7:	50                   	push   %eax
+  8001c8:	e8 c9 09 00 00       	call   800b96 <sys_cputs>
+
+	return b.cnt;
+}
+  8001cd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001d3:	c9                   	leave
+  8001d4:	c3                   	ret
+
+008001d5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001d5:	55                   	push   %ebp
+  8001d6:	89 e5                	mov    %esp,%ebp
+  8001d8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001db:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001de:	50                   	push   %eax
+  8001df:	ff 75 08             	push   0x8(%ebp)
+  8001e2:	e8 9d ff ff ff       	call   800184 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001e7:	c9                   	leave
+  8001e8:	c3                   	ret
+
+008001e9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8001e9:	55                   	push   %ebp
+  8001ea:	89 e5                	mov    %esp,%ebp
+  8001ec:	57                   	push   %edi
+  8001ed:	56                   	push   %esi
+  8001ee:	53                   	push   %ebx
+  8001ef:	83 ec 1c             	sub    $0x1c,%esp
+  8001f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8001f5:	89 d6                	mov    %edx,%esi
+  8001f7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8001fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001fd:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800200:	73 0b                	jae    80020d <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800202:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800205:	c1 e7 08             	shl    $0x8,%edi
+  800208:	0b 7d 10             	or     0x10(%ebp),%edi
+  80020b:	eb 36                	jmp    800243 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80020d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800210:	ba 00 00 00 00       	mov    $0x0,%edx
+  800215:	f7 75 08             	divl   0x8(%ebp)
+  800218:	89 c1                	mov    %eax,%ecx
+  80021a:	ff 75 14             	push   0x14(%ebp)
+  80021d:	ff 75 10             	push   0x10(%ebp)
+  800220:	83 eb 01             	sub    $0x1,%ebx
+  800223:	53                   	push   %ebx
+  800224:	ff 75 08             	push   0x8(%ebp)
+  800227:	89 f2                	mov    %esi,%edx
+  800229:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80022c:	e8 b8 ff ff ff       	call   8001e9 <printnum>
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	eb 14                	jmp    80024a <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800236:	83 ec 08             	sub    $0x8,%esp
+  800239:	56                   	push   %esi
+  80023a:	57                   	push   %edi
+  80023b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80023e:	ff d0                	call   *%eax
+  800240:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800243:	83 eb 01             	sub    $0x1,%ebx
+  800246:	85 db                	test   %ebx,%ebx
+  800248:	7f ec                	jg     800236 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80024a:	83 ec 08             	sub    $0x8,%esp
+  80024d:	56                   	push   %esi
+  80024e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800251:	ba 00 00 00 00       	mov    $0x0,%edx
+  800256:	f7 75 08             	divl   0x8(%ebp)
+  800259:	0f be 92 9f 2b 80 00 	movsbl 0x802b9f(%edx),%edx
+  800260:	8b 45 14             	mov    0x14(%ebp),%eax
+  800263:	c1 e0 08             	shl    $0x8,%eax
+  800266:	09 d0                	or     %edx,%eax
+  800268:	50                   	push   %eax
+  800269:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80026c:	ff d0                	call   *%eax
+}
+  80026e:	83 c4 10             	add    $0x10,%esp
+  800271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800274:	5b                   	pop    %ebx
+  800275:	5e                   	pop    %esi
+  800276:	5f                   	pop    %edi
+  800277:	5d                   	pop    %ebp
+  800278:	c3                   	ret
+
+00800279 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800279:	55                   	push   %ebp
+  80027a:	89 e5                	mov    %esp,%ebp
+  80027c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80027f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800283:	8b 10                	mov    (%eax),%edx
+  800285:	3b 50 04             	cmp    0x4(%eax),%edx
+  800288:	73 0a                	jae    800294 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80028a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80028d:	89 08                	mov    %ecx,(%eax)
+  80028f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800292:	88 02                	mov    %al,(%edx)
+}
+  800294:	5d                   	pop    %ebp
+  800295:	c3                   	ret
+
+00800296 <printfmt>:
+{
+  800296:	55                   	push   %ebp
+  800297:	89 e5                	mov    %esp,%ebp
+  800299:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80029c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80029f:	50                   	push   %eax
+  8002a0:	ff 75 10             	push   0x10(%ebp)
+  8002a3:	ff 75 0c             	push   0xc(%ebp)
+  8002a6:	ff 75 08             	push   0x8(%ebp)
+  8002a9:	e8 05 00 00 00       	call   8002b3 <vprintfmt>
+}
+  8002ae:	83 c4 10             	add    $0x10,%esp
+  8002b1:	c9                   	leave
+  8002b2:	c3                   	ret
+
+008002b3 <vprintfmt>:
+{
+  8002b3:	55                   	push   %ebp
+  8002b4:	89 e5                	mov    %esp,%ebp
+  8002b6:	57                   	push   %edi
+  8002b7:	56                   	push   %esi
+  8002b8:	53                   	push   %ebx
+  8002b9:	83 ec 3c             	sub    $0x3c,%esp
+  8002bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002bf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8002c2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002c9:	eb 16                	jmp    8002e1 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8002cb:	83 ec 08             	sub    $0x8,%esp
+  8002ce:	ff 75 0c             	push   0xc(%ebp)
+  8002d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8002d4:	c1 e2 08             	shl    $0x8,%edx
+  8002d7:	09 d0                	or     %edx,%eax
+  8002d9:	50                   	push   %eax
+  8002da:	ff d7                	call   *%edi
+  8002dc:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002df:	89 de                	mov    %ebx,%esi
+  8002e1:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8002e4:	0f b6 06             	movzbl (%esi),%eax
+  8002e7:	83 f8 25             	cmp    $0x25,%eax
+  8002ea:	74 0c                	je     8002f8 <vprintfmt+0x45>
+			if (ch == '\0')
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	75 db                	jne    8002cb <vprintfmt+0x18>
+}
+  8002f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f3:	5b                   	pop    %ebx
+  8002f4:	5e                   	pop    %esi
+  8002f5:	5f                   	pop    %edi
+  8002f6:	5d                   	pop    %ebp
+  8002f7:	c3                   	ret
+		padc = ' ';
+  8002f8:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8002fc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800303:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80030a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800311:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800316:	8d 73 01             	lea    0x1(%ebx),%esi
+  800319:	0f b6 13             	movzbl (%ebx),%edx
+  80031c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80031f:	3c 55                	cmp    $0x55,%al
+  800321:	0f 87 2c 04 00 00    	ja     800753 <vprintfmt+0x4a0>
+  800327:	0f b6 c0             	movzbl %al,%eax
+  80032a:	ff 24 85 e0 2c 80 00 	jmp    *0x802ce0(,%eax,4)
+  800331:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800333:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800337:	eb dd                	jmp    800316 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800339:	89 f3                	mov    %esi,%ebx
+  80033b:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80033f:	eb d5                	jmp    800316 <vprintfmt+0x63>
+  800341:	0f b6 d2             	movzbl %dl,%edx
+  800344:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800346:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80034b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80034e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800352:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800355:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800358:	83 fe 09             	cmp    $0x9,%esi
+  80035b:	0f 87 8a 00 00 00    	ja     8003eb <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800361:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800364:	eb e5                	jmp    80034b <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800366:	8b 45 14             	mov    0x14(%ebp),%eax
+  800369:	8b 00                	mov    (%eax),%eax
+  80036b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800371:	8d 40 04             	lea    0x4(%eax),%eax
+  800374:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800377:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800379:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80037d:	79 97                	jns    800316 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80037f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800382:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800385:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80038c:	eb 88                	jmp    800316 <vprintfmt+0x63>
+			if (width < 0)
+  80038e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800391:	85 db                	test   %ebx,%ebx
+  800393:	b8 00 00 00 00       	mov    $0x0,%eax
+  800398:	0f 49 c3             	cmovns %ebx,%eax
+  80039b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80039e:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003a0:	e9 71 ff ff ff       	jmp    800316 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a5:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003a7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003ae:	e9 63 ff ff ff       	jmp    800316 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8003b3:	8d 73 02             	lea    0x2(%ebx),%esi
+  8003b6:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8003ba:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8003c1:	3c 67                	cmp    $0x67,%al
+  8003c3:	0f 84 18 ff ff ff    	je     8002e1 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8003c9:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8003d0:	3c 72                	cmp    $0x72,%al
+  8003d2:	0f 84 09 ff ff ff    	je     8002e1 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8003d8:	3c 62                	cmp    $0x62,%al
+  8003da:	0f 94 c0             	sete   %al
+  8003dd:	0f b6 c0             	movzbl %al,%eax
+  8003e0:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003e6:	e9 f6 fe ff ff       	jmp    8002e1 <vprintfmt+0x2e>
+  8003eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ee:	eb 89                	jmp    800379 <vprintfmt+0xc6>
+			lflag++;
+  8003f0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f3:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003f5:	e9 1c ff ff ff       	jmp    800316 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8003fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fd:	8d 58 04             	lea    0x4(%eax),%ebx
+  800400:	83 ec 08             	sub    $0x8,%esp
+  800403:	ff 75 0c             	push   0xc(%ebp)
+  800406:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800409:	c1 e0 08             	shl    $0x8,%eax
+  80040c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80040f:	0b 01                	or     (%ecx),%eax
+  800411:	50                   	push   %eax
+  800412:	ff d7                	call   *%edi
+			break;
+  800414:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800417:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80041a:	e9 c2 fe ff ff       	jmp    8002e1 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80041f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800422:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800425:	8b 10                	mov    (%eax),%edx
+  800427:	89 d0                	mov    %edx,%eax
+  800429:	f7 d8                	neg    %eax
+  80042b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80042e:	83 f8 12             	cmp    $0x12,%eax
+  800431:	7f 25                	jg     800458 <vprintfmt+0x1a5>
+  800433:	8b 14 85 40 2e 80 00 	mov    0x802e40(,%eax,4),%edx
+  80043a:	85 d2                	test   %edx,%edx
+  80043c:	74 1a                	je     800458 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80043e:	52                   	push   %edx
+  80043f:	68 81 2f 80 00       	push   $0x802f81
+  800444:	ff 75 0c             	push   0xc(%ebp)
+  800447:	57                   	push   %edi
+  800448:	e8 49 fe ff ff       	call   800296 <printfmt>
+  80044d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800450:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800453:	e9 89 fe ff ff       	jmp    8002e1 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800458:	50                   	push   %eax
+  800459:	68 b7 2b 80 00       	push   $0x802bb7
+  80045e:	ff 75 0c             	push   0xc(%ebp)
+  800461:	57                   	push   %edi
+  800462:	e8 2f fe ff ff       	call   800296 <printfmt>
+  800467:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80046a:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80046d:	e9 6f fe ff ff       	jmp    8002e1 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800472:	8b 45 14             	mov    0x14(%ebp),%eax
+  800475:	83 c0 04             	add    $0x4,%eax
+  800478:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80047b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800480:	85 c9                	test   %ecx,%ecx
+  800482:	b8 b0 2b 80 00       	mov    $0x802bb0,%eax
+  800487:	0f 45 c1             	cmovne %ecx,%eax
+  80048a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80048d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800491:	7e 06                	jle    800499 <vprintfmt+0x1e6>
+  800493:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800497:	75 1a                	jne    8004b3 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800499:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80049c:	c1 e0 08             	shl    $0x8,%eax
+  80049f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004a2:	83 c8 3f             	or     $0x3f,%eax
+  8004a5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004a8:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004ab:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004ae:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8004b1:	eb 6d                	jmp    800520 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004b3:	83 ec 08             	sub    $0x8,%esp
+  8004b6:	ff 75 d0             	push   -0x30(%ebp)
+  8004b9:	ff 75 c8             	push   -0x38(%ebp)
+  8004bc:	e8 39 03 00 00       	call   8007fa <strnlen>
+  8004c1:	89 c2                	mov    %eax,%edx
+  8004c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c6:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8004c8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004cb:	c1 e1 08             	shl    $0x8,%ecx
+  8004ce:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8004d2:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d4:	83 c4 10             	add    $0x10,%esp
+  8004d7:	89 c3                	mov    %eax,%ebx
+  8004d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004dc:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004df:	89 ce                	mov    %ecx,%esi
+  8004e1:	eb 0f                	jmp    8004f2 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8004e3:	83 ec 08             	sub    $0x8,%esp
+  8004e6:	ff 75 0c             	push   0xc(%ebp)
+  8004e9:	56                   	push   %esi
+  8004ea:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ec:	83 eb 01             	sub    $0x1,%ebx
+  8004ef:	83 c4 10             	add    $0x10,%esp
+  8004f2:	85 db                	test   %ebx,%ebx
+  8004f4:	7f ed                	jg     8004e3 <vprintfmt+0x230>
+  8004f6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004f9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8004fc:	85 c0                	test   %eax,%eax
+  8004fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800503:	0f 49 d0             	cmovns %eax,%edx
+  800506:	29 d0                	sub    %edx,%eax
+  800508:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050b:	eb 8c                	jmp    800499 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80050d:	83 ec 08             	sub    $0x8,%esp
+  800510:	ff 75 0c             	push   0xc(%ebp)
+  800513:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800516:	09 c2                	or     %eax,%edx
+  800518:	52                   	push   %edx
+  800519:	ff d7                	call   *%edi
+  80051b:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80051e:	89 d9                	mov    %ebx,%ecx
+  800520:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800523:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800527:	0f be d0             	movsbl %al,%edx
+  80052a:	85 d2                	test   %edx,%edx
+  80052c:	74 2a                	je     800558 <vprintfmt+0x2a5>
+  80052e:	85 f6                	test   %esi,%esi
+  800530:	78 05                	js     800537 <vprintfmt+0x284>
+  800532:	83 ee 01             	sub    $0x1,%esi
+  800535:	78 3b                	js     800572 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800537:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80053b:	74 d0                	je     80050d <vprintfmt+0x25a>
+  80053d:	0f be c0             	movsbl %al,%eax
+  800540:	83 e8 20             	sub    $0x20,%eax
+  800543:	83 f8 5e             	cmp    $0x5e,%eax
+  800546:	76 c5                	jbe    80050d <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800548:	83 ec 08             	sub    $0x8,%esp
+  80054b:	ff 75 0c             	push   0xc(%ebp)
+  80054e:	ff 75 cc             	push   -0x34(%ebp)
+  800551:	ff d7                	call   *%edi
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	eb c6                	jmp    80051e <vprintfmt+0x26b>
+  800558:	8b 75 10             	mov    0x10(%ebp),%esi
+  80055b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80055e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800561:	01 c3                	add    %eax,%ebx
+  800563:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800565:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800568:	83 c8 20             	or     $0x20,%eax
+  80056b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80056e:	89 c6                	mov    %eax,%esi
+  800570:	eb 14                	jmp    800586 <vprintfmt+0x2d3>
+  800572:	8b 75 10             	mov    0x10(%ebp),%esi
+  800575:	eb e4                	jmp    80055b <vprintfmt+0x2a8>
+  800577:	83 ec 08             	sub    $0x8,%esp
+  80057a:	ff 75 0c             	push   0xc(%ebp)
+  80057d:	56                   	push   %esi
+  80057e:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800580:	83 eb 01             	sub    $0x1,%ebx
+  800583:	83 c4 10             	add    $0x10,%esp
+  800586:	85 db                	test   %ebx,%ebx
+  800588:	7f ed                	jg     800577 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80058a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80058d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800590:	89 45 14             	mov    %eax,0x14(%ebp)
+  800593:	e9 49 fd ff ff       	jmp    8002e1 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800598:	83 f9 01             	cmp    $0x1,%ecx
+  80059b:	7f 1f                	jg     8005bc <vprintfmt+0x309>
+	else if (lflag)
+  80059d:	85 c9                	test   %ecx,%ecx
+  80059f:	74 69                	je     80060a <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	8b 00                	mov    (%eax),%eax
+  8005a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a9:	89 c1                	mov    %eax,%ecx
+  8005ab:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ba:	eb 17                	jmp    8005d3 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8005bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bf:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c2:	8b 00                	mov    (%eax),%eax
+  8005c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005d3:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005d6:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8005d9:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8005de:	85 db                	test   %ebx,%ebx
+  8005e0:	0f 89 f6 00 00 00    	jns    8006dc <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8005e6:	83 ec 08             	sub    $0x8,%esp
+  8005e9:	ff 75 0c             	push   0xc(%ebp)
+  8005ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005ef:	c1 e0 08             	shl    $0x8,%eax
+  8005f2:	83 c8 2d             	or     $0x2d,%eax
+  8005f5:	50                   	push   %eax
+  8005f6:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8005f8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8005fb:	f7 d9                	neg    %ecx
+  8005fd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800600:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800605:	e9 d2 00 00 00       	jmp    8006dc <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8b 00                	mov    (%eax),%eax
+  80060f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800612:	89 c1                	mov    %eax,%ecx
+  800614:	c1 f9 1f             	sar    $0x1f,%ecx
+  800617:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80061a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061d:	8d 40 04             	lea    0x4(%eax),%eax
+  800620:	89 45 14             	mov    %eax,0x14(%ebp)
+  800623:	eb ae                	jmp    8005d3 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800625:	83 f9 01             	cmp    $0x1,%ecx
+  800628:	7f 19                	jg     800643 <vprintfmt+0x390>
+	else if (lflag)
+  80062a:	85 c9                	test   %ecx,%ecx
+  80062c:	74 2a                	je     800658 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 08                	mov    (%eax),%ecx
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800639:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80063e:	e9 99 00 00 00       	jmp    8006dc <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 08                	mov    (%eax),%ecx
+  800648:	8d 40 08             	lea    0x8(%eax),%eax
+  80064b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80064e:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800653:	e9 84 00 00 00       	jmp    8006dc <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800658:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065b:	8b 08                	mov    (%eax),%ecx
+  80065d:	8d 40 04             	lea    0x4(%eax),%eax
+  800660:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800663:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800668:	eb 72                	jmp    8006dc <vprintfmt+0x429>
+	if (lflag >= 2)
+  80066a:	83 f9 01             	cmp    $0x1,%ecx
+  80066d:	7f 16                	jg     800685 <vprintfmt+0x3d2>
+	else if (lflag)
+  80066f:	85 c9                	test   %ecx,%ecx
+  800671:	74 24                	je     800697 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8b 08                	mov    (%eax),%ecx
+  800678:	8d 40 04             	lea    0x4(%eax),%eax
+  80067b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80067e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800683:	eb 57                	jmp    8006dc <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 08                	mov    (%eax),%ecx
+  80068a:	8d 40 08             	lea    0x8(%eax),%eax
+  80068d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800690:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800695:	eb 45                	jmp    8006dc <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 08                	mov    (%eax),%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a2:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006a7:	eb 33                	jmp    8006dc <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006a9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006ac:	c1 e3 08             	shl    $0x8,%ebx
+  8006af:	83 ec 08             	sub    $0x8,%esp
+  8006b2:	ff 75 0c             	push   0xc(%ebp)
+  8006b5:	89 d8                	mov    %ebx,%eax
+  8006b7:	83 c8 30             	or     $0x30,%eax
+  8006ba:	50                   	push   %eax
+  8006bb:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8006bd:	83 c4 08             	add    $0x8,%esp
+  8006c0:	ff 75 0c             	push   0xc(%ebp)
+  8006c3:	83 cb 78             	or     $0x78,%ebx
+  8006c6:	53                   	push   %ebx
+  8006c7:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8006c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cc:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8006ce:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006d7:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8006dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8006df:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006e3:	52                   	push   %edx
+  8006e4:	ff 75 e0             	push   -0x20(%ebp)
+  8006e7:	50                   	push   %eax
+  8006e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006eb:	89 f8                	mov    %edi,%eax
+  8006ed:	e8 f7 fa ff ff       	call   8001e9 <printnum>
+			break;
+  8006f2:	83 c4 10             	add    $0x10,%esp
+  8006f5:	e9 e7 fb ff ff       	jmp    8002e1 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006fa:	83 f9 01             	cmp    $0x1,%ecx
+  8006fd:	7f 16                	jg     800715 <vprintfmt+0x462>
+	else if (lflag)
+  8006ff:	85 c9                	test   %ecx,%ecx
+  800701:	74 24                	je     800727 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800703:	8b 45 14             	mov    0x14(%ebp),%eax
+  800706:	8b 08                	mov    (%eax),%ecx
+  800708:	8d 40 04             	lea    0x4(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80070e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800713:	eb c7                	jmp    8006dc <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800715:	8b 45 14             	mov    0x14(%ebp),%eax
+  800718:	8b 08                	mov    (%eax),%ecx
+  80071a:	8d 40 08             	lea    0x8(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800720:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800725:	eb b5                	jmp    8006dc <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8b 08                	mov    (%eax),%ecx
+  80072c:	8d 40 04             	lea    0x4(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800732:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800737:	eb a3                	jmp    8006dc <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800739:	83 ec 08             	sub    $0x8,%esp
+  80073c:	ff 75 0c             	push   0xc(%ebp)
+  80073f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800742:	c1 e0 08             	shl    $0x8,%eax
+  800745:	83 c8 25             	or     $0x25,%eax
+  800748:	50                   	push   %eax
+  800749:	ff d7                	call   *%edi
+			break;
+  80074b:	83 c4 10             	add    $0x10,%esp
+  80074e:	e9 8e fb ff ff       	jmp    8002e1 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800753:	83 ec 08             	sub    $0x8,%esp
+  800756:	ff 75 0c             	push   0xc(%ebp)
+  800759:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80075c:	c1 e0 08             	shl    $0x8,%eax
+  80075f:	83 c8 25             	or     $0x25,%eax
+  800762:	50                   	push   %eax
+  800763:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800765:	83 c4 10             	add    $0x10,%esp
+  800768:	89 de                	mov    %ebx,%esi
+  80076a:	eb 03                	jmp    80076f <vprintfmt+0x4bc>
+  80076c:	83 ee 01             	sub    $0x1,%esi
+  80076f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800773:	75 f7                	jne    80076c <vprintfmt+0x4b9>
+  800775:	e9 67 fb ff ff       	jmp    8002e1 <vprintfmt+0x2e>
+
+0080077a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80077a:	55                   	push   %ebp
+  80077b:	89 e5                	mov    %esp,%ebp
+  80077d:	83 ec 18             	sub    $0x18,%esp
+  800780:	8b 45 08             	mov    0x8(%ebp),%eax
+  800783:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800786:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800789:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80078d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800790:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800797:	85 c0                	test   %eax,%eax
+  800799:	74 26                	je     8007c1 <vsnprintf+0x47>
+  80079b:	85 d2                	test   %edx,%edx
+  80079d:	7e 22                	jle    8007c1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80079f:	ff 75 14             	push   0x14(%ebp)
+  8007a2:	ff 75 10             	push   0x10(%ebp)
+  8007a5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007a8:	50                   	push   %eax
+  8007a9:	68 79 02 80 00       	push   $0x800279
+  8007ae:	e8 00 fb ff ff       	call   8002b3 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007b3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007b6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007bc:	83 c4 10             	add    $0x10,%esp
+}
+  8007bf:	c9                   	leave
+  8007c0:	c3                   	ret
+		return -E_INVAL;
+  8007c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c6:	eb f7                	jmp    8007bf <vsnprintf+0x45>
+
+008007c8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007c8:	55                   	push   %ebp
+  8007c9:	89 e5                	mov    %esp,%ebp
+  8007cb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8007ce:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d1:	50                   	push   %eax
+  8007d2:	ff 75 10             	push   0x10(%ebp)
+  8007d5:	ff 75 0c             	push   0xc(%ebp)
+  8007d8:	ff 75 08             	push   0x8(%ebp)
+  8007db:	e8 9a ff ff ff       	call   80077a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007e0:	c9                   	leave
+  8007e1:	c3                   	ret
+
+008007e2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ed:	eb 03                	jmp    8007f2 <strlen+0x10>
+		n++;
+  8007ef:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007f2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007f6:	75 f7                	jne    8007ef <strlen+0xd>
+	return n;
+}
+  8007f8:	5d                   	pop    %ebp
+  8007f9:	c3                   	ret
+
+008007fa <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007fa:	55                   	push   %ebp
+  8007fb:	89 e5                	mov    %esp,%ebp
+  8007fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800800:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800803:	b8 00 00 00 00       	mov    $0x0,%eax
+  800808:	eb 03                	jmp    80080d <strnlen+0x13>
+		n++;
+  80080a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80080d:	39 d0                	cmp    %edx,%eax
+  80080f:	74 08                	je     800819 <strnlen+0x1f>
+  800811:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800815:	75 f3                	jne    80080a <strnlen+0x10>
+  800817:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800819:	89 d0                	mov    %edx,%eax
+  80081b:	5d                   	pop    %ebp
+  80081c:	c3                   	ret
+
+0080081d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	53                   	push   %ebx
+  800821:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800824:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800830:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800833:	83 c0 01             	add    $0x1,%eax
+  800836:	84 d2                	test   %dl,%dl
+  800838:	75 f2                	jne    80082c <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80083a:	89 c8                	mov    %ecx,%eax
+  80083c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083f:	c9                   	leave
+  800840:	c3                   	ret
+
+00800841 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800841:	55                   	push   %ebp
+  800842:	89 e5                	mov    %esp,%ebp
+  800844:	53                   	push   %ebx
+  800845:	83 ec 10             	sub    $0x10,%esp
+  800848:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80084b:	53                   	push   %ebx
+  80084c:	e8 91 ff ff ff       	call   8007e2 <strlen>
+  800851:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800854:	ff 75 0c             	push   0xc(%ebp)
+  800857:	01 d8                	add    %ebx,%eax
+  800859:	50                   	push   %eax
+  80085a:	e8 be ff ff ff       	call   80081d <strcpy>
+	return dst;
+}
+  80085f:	89 d8                	mov    %ebx,%eax
+  800861:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800864:	c9                   	leave
+  800865:	c3                   	ret
+
+00800866 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800866:	55                   	push   %ebp
+  800867:	89 e5                	mov    %esp,%ebp
+  800869:	56                   	push   %esi
+  80086a:	53                   	push   %ebx
+  80086b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80086e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800871:	89 f3                	mov    %esi,%ebx
+  800873:	03 5d 10             	add    0x10(%ebp),%ebx
+  800876:	89 f0                	mov    %esi,%eax
+  800878:	eb 0f                	jmp    800889 <strncpy+0x23>
+		*dst++ = *src;
+  80087a:	83 c0 01             	add    $0x1,%eax
+  80087d:	0f b6 0a             	movzbl (%edx),%ecx
+  800880:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800883:	80 f9 01             	cmp    $0x1,%cl
+  800886:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800889:	39 d8                	cmp    %ebx,%eax
+  80088b:	75 ed                	jne    80087a <strncpy+0x14>
+	}
+	return ret;
+}
+  80088d:	89 f0                	mov    %esi,%eax
+  80088f:	5b                   	pop    %ebx
+  800890:	5e                   	pop    %esi
+  800891:	5d                   	pop    %ebp
+  800892:	c3                   	ret
+
+00800893 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800893:	55                   	push   %ebp
+  800894:	89 e5                	mov    %esp,%ebp
+  800896:	56                   	push   %esi
+  800897:	53                   	push   %ebx
+  800898:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80089e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a1:	89 f0                	mov    %esi,%eax
+  8008a3:	85 d2                	test   %edx,%edx
+  8008a5:	74 21                	je     8008c8 <strlcpy+0x35>
+  8008a7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008ab:	89 f2                	mov    %esi,%edx
+  8008ad:	eb 09                	jmp    8008b8 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008af:	83 c1 01             	add    $0x1,%ecx
+  8008b2:	83 c2 01             	add    $0x1,%edx
+  8008b5:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008b8:	39 c2                	cmp    %eax,%edx
+  8008ba:	74 09                	je     8008c5 <strlcpy+0x32>
+  8008bc:	0f b6 19             	movzbl (%ecx),%ebx
+  8008bf:	84 db                	test   %bl,%bl
+  8008c1:	75 ec                	jne    8008af <strlcpy+0x1c>
+  8008c3:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008c5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008c8:	29 f0                	sub    %esi,%eax
+}
+  8008ca:	5b                   	pop    %ebx
+  8008cb:	5e                   	pop    %esi
+  8008cc:	5d                   	pop    %ebp
+  8008cd:	c3                   	ret
+
+008008ce <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008d7:	eb 06                	jmp    8008df <strcmp+0x11>
+		p++, q++;
+  8008d9:	83 c1 01             	add    $0x1,%ecx
+  8008dc:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008df:	0f b6 01             	movzbl (%ecx),%eax
+  8008e2:	84 c0                	test   %al,%al
+  8008e4:	74 04                	je     8008ea <strcmp+0x1c>
+  8008e6:	3a 02                	cmp    (%edx),%al
+  8008e8:	74 ef                	je     8008d9 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ea:	0f b6 c0             	movzbl %al,%eax
+  8008ed:	0f b6 12             	movzbl (%edx),%edx
+  8008f0:	29 d0                	sub    %edx,%eax
+}
+  8008f2:	5d                   	pop    %ebp
+  8008f3:	c3                   	ret
+
+008008f4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	53                   	push   %ebx
+  8008f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008fe:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800901:	eb 09                	jmp    80090c <strncmp+0x18>
+		n--, p++, q++;
+  800903:	83 ea 01             	sub    $0x1,%edx
+  800906:	83 c0 01             	add    $0x1,%eax
+  800909:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80090c:	85 d2                	test   %edx,%edx
+  80090e:	74 18                	je     800928 <strncmp+0x34>
+  800910:	0f b6 18             	movzbl (%eax),%ebx
+  800913:	84 db                	test   %bl,%bl
+  800915:	74 04                	je     80091b <strncmp+0x27>
+  800917:	3a 19                	cmp    (%ecx),%bl
+  800919:	74 e8                	je     800903 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80091b:	0f b6 00             	movzbl (%eax),%eax
+  80091e:	0f b6 11             	movzbl (%ecx),%edx
+  800921:	29 d0                	sub    %edx,%eax
+}
+  800923:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+		return 0;
+  800928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092d:	eb f4                	jmp    800923 <strncmp+0x2f>
+
+0080092f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	8b 45 08             	mov    0x8(%ebp),%eax
+  800935:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800939:	eb 03                	jmp    80093e <strchr+0xf>
+  80093b:	83 c0 01             	add    $0x1,%eax
+  80093e:	0f b6 10             	movzbl (%eax),%edx
+  800941:	84 d2                	test   %dl,%dl
+  800943:	74 06                	je     80094b <strchr+0x1c>
+		if (*s == c)
+  800945:	38 ca                	cmp    %cl,%dl
+  800947:	75 f2                	jne    80093b <strchr+0xc>
+  800949:	eb 05                	jmp    800950 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80094b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800950:	5d                   	pop    %ebp
+  800951:	c3                   	ret
+
+00800952 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	8b 45 08             	mov    0x8(%ebp),%eax
+  800958:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80095c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  80095f:	38 ca                	cmp    %cl,%dl
+  800961:	74 09                	je     80096c <strfind+0x1a>
+  800963:	84 d2                	test   %dl,%dl
+  800965:	74 05                	je     80096c <strfind+0x1a>
+	for (; *s; s++)
+  800967:	83 c0 01             	add    $0x1,%eax
+  80096a:	eb f0                	jmp    80095c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	57                   	push   %edi
+  800972:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800975:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800978:	85 c9                	test   %ecx,%ecx
+  80097a:	74 20                	je     80099c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  80097c:	89 f8                	mov    %edi,%eax
+  80097e:	09 c8                	or     %ecx,%eax
+  800980:	a8 03                	test   $0x3,%al
+  800982:	75 12                	jne    800996 <memset+0x28>
+		c &= 0xFF;
+  800984:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800988:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  80098e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800991:	fc                   	cld
+  800992:	f3 ab                	rep stos %eax,%es:(%edi)
+  800994:	eb 06                	jmp    80099c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800996:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800999:	fc                   	cld
+  80099a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  80099c:	89 f8                	mov    %edi,%eax
+  80099e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a1:	c9                   	leave
+  8009a2:	c3                   	ret
+
+008009a3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	57                   	push   %edi
+  8009a7:	56                   	push   %esi
+  8009a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009ae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b1:	39 c6                	cmp    %eax,%esi
+  8009b3:	73 32                	jae    8009e7 <memmove+0x44>
+  8009b5:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009b8:	39 d0                	cmp    %edx,%eax
+  8009ba:	73 2b                	jae    8009e7 <memmove+0x44>
+		s += n;
+		d += n;
+  8009bc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009bf:	89 d6                	mov    %edx,%esi
+  8009c1:	09 fe                	or     %edi,%esi
+  8009c3:	09 ce                	or     %ecx,%esi
+  8009c5:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009cb:	75 0e                	jne    8009db <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009cd:	83 ef 04             	sub    $0x4,%edi
+  8009d0:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009d3:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009d6:	fd                   	std
+  8009d7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d9:	eb 09                	jmp    8009e4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009db:	83 ef 01             	sub    $0x1,%edi
+  8009de:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e1:	fd                   	std
+  8009e2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009e4:	fc                   	cld
+  8009e5:	eb 1a                	jmp    800a01 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009e7:	89 f2                	mov    %esi,%edx
+  8009e9:	09 c2                	or     %eax,%edx
+  8009eb:	09 ca                	or     %ecx,%edx
+  8009ed:	f6 c2 03             	test   $0x3,%dl
+  8009f0:	75 0a                	jne    8009fc <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009f5:	89 c7                	mov    %eax,%edi
+  8009f7:	fc                   	cld
+  8009f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009fa:	eb 05                	jmp    800a01 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8009fc:	89 c7                	mov    %eax,%edi
+  8009fe:	fc                   	cld
+  8009ff:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a01:	5e                   	pop    %esi
+  800a02:	5f                   	pop    %edi
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a0b:	ff 75 10             	push   0x10(%ebp)
+  800a0e:	ff 75 0c             	push   0xc(%ebp)
+  800a11:	ff 75 08             	push   0x8(%ebp)
+  800a14:	e8 8a ff ff ff       	call   8009a3 <memmove>
+}
+  800a19:	c9                   	leave
+  800a1a:	c3                   	ret
+
+00800a1b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a1b:	55                   	push   %ebp
+  800a1c:	89 e5                	mov    %esp,%ebp
+  800a1e:	56                   	push   %esi
+  800a1f:	53                   	push   %ebx
+  800a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a26:	89 c6                	mov    %eax,%esi
+  800a28:	03 75 10             	add    0x10(%ebp),%esi
+  800a2b:	eb 06                	jmp    800a33 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a2d:	83 c0 01             	add    $0x1,%eax
+  800a30:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a33:	39 f0                	cmp    %esi,%eax
+  800a35:	74 14                	je     800a4b <memcmp+0x30>
+		if (*s1 != *s2)
+  800a37:	0f b6 08             	movzbl (%eax),%ecx
+  800a3a:	0f b6 1a             	movzbl (%edx),%ebx
+  800a3d:	38 d9                	cmp    %bl,%cl
+  800a3f:	74 ec                	je     800a2d <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a41:	0f b6 c1             	movzbl %cl,%eax
+  800a44:	0f b6 db             	movzbl %bl,%ebx
+  800a47:	29 d8                	sub    %ebx,%eax
+  800a49:	eb 05                	jmp    800a50 <memcmp+0x35>
+	}
+
+	return 0;
+  800a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a50:	5b                   	pop    %ebx
+  800a51:	5e                   	pop    %esi
+  800a52:	5d                   	pop    %ebp
+  800a53:	c3                   	ret
+
+00800a54 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a5d:	89 c2                	mov    %eax,%edx
+  800a5f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a62:	eb 03                	jmp    800a67 <memfind+0x13>
+  800a64:	83 c0 01             	add    $0x1,%eax
+  800a67:	39 d0                	cmp    %edx,%eax
+  800a69:	73 04                	jae    800a6f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a6b:	38 08                	cmp    %cl,(%eax)
+  800a6d:	75 f5                	jne    800a64 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a6f:	5d                   	pop    %ebp
+  800a70:	c3                   	ret
+
+00800a71 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	57                   	push   %edi
+  800a75:	56                   	push   %esi
+  800a76:	53                   	push   %ebx
+  800a77:	83 ec 1c             	sub    $0x1c,%esp
+  800a7a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a80:	eb 03                	jmp    800a85 <strtol+0x14>
+		s++;
+  800a82:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800a85:	0f b6 06             	movzbl (%esi),%eax
+  800a88:	3c 20                	cmp    $0x20,%al
+  800a8a:	74 f6                	je     800a82 <strtol+0x11>
+  800a8c:	3c 09                	cmp    $0x9,%al
+  800a8e:	74 f2                	je     800a82 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a90:	3c 2b                	cmp    $0x2b,%al
+  800a92:	74 43                	je     800ad7 <strtol+0x66>
+	int neg = 0;
+  800a94:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800a99:	3c 2d                	cmp    $0x2d,%al
+  800a9b:	74 44                	je     800ae1 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9d:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800aa3:	75 0f                	jne    800ab4 <strtol+0x43>
+  800aa5:	80 3e 30             	cmpb   $0x30,(%esi)
+  800aa8:	74 41                	je     800aeb <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aaa:	85 ff                	test   %edi,%edi
+  800aac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab1:	0f 44 f8             	cmove  %eax,%edi
+  800ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab9:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800abe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800ac1:	89 fb                	mov    %edi,%ebx
+  800ac3:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ac6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ac9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800acc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800acf:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800ad2:	89 75 08             	mov    %esi,0x8(%ebp)
+  800ad5:	eb 67                	jmp    800b3e <strtol+0xcd>
+		s++;
+  800ad7:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800ada:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800adf:	eb bc                	jmp    800a9d <strtol+0x2c>
+		s++, neg = 1;
+  800ae1:	83 c6 01             	add    $0x1,%esi
+  800ae4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ae9:	eb b2                	jmp    800a9d <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aeb:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800aef:	74 0e                	je     800aff <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800af1:	85 ff                	test   %edi,%edi
+  800af3:	75 bf                	jne    800ab4 <strtol+0x43>
+		s++, base = 8;
+  800af5:	83 c6 01             	add    $0x1,%esi
+  800af8:	bf 08 00 00 00       	mov    $0x8,%edi
+  800afd:	eb b5                	jmp    800ab4 <strtol+0x43>
+		s += 2, base = 16;
+  800aff:	83 c6 02             	add    $0x2,%esi
+  800b02:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b07:	eb ab                	jmp    800ab4 <strtol+0x43>
+			dig = *s - '0';
+  800b09:	0f be c9             	movsbl %cl,%ecx
+  800b0c:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b0f:	39 f9                	cmp    %edi,%ecx
+  800b11:	7d 59                	jge    800b6c <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b13:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b17:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b1a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b1d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b20:	0f af d8             	imul   %eax,%ebx
+  800b23:	0f af d7             	imul   %edi,%edx
+  800b26:	01 d3                	add    %edx,%ebx
+  800b28:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b2b:	f7 e7                	mul    %edi
+  800b2d:	01 da                	add    %ebx,%edx
+  800b2f:	89 cb                	mov    %ecx,%ebx
+  800b31:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b34:	01 c8                	add    %ecx,%eax
+  800b36:	11 da                	adc    %ebx,%edx
+  800b38:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b3b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b41:	0f b6 08             	movzbl (%eax),%ecx
+  800b44:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b47:	80 fb 09             	cmp    $0x9,%bl
+  800b4a:	76 bd                	jbe    800b09 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b4c:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800b4f:	80 fb 19             	cmp    $0x19,%bl
+  800b52:	77 08                	ja     800b5c <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800b54:	0f be c9             	movsbl %cl,%ecx
+  800b57:	83 e9 57             	sub    $0x57,%ecx
+  800b5a:	eb b3                	jmp    800b0f <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b5c:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800b5f:	80 fb 19             	cmp    $0x19,%bl
+  800b62:	77 08                	ja     800b6c <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800b64:	0f be c9             	movsbl %cl,%ecx
+  800b67:	83 e9 37             	sub    $0x37,%ecx
+  800b6a:	eb a3                	jmp    800b0f <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b6c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b6f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b72:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b75:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b78:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b7c:	74 05                	je     800b83 <strtol+0x112>
+		*endptr = (char *) s;
+  800b7e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800b81:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800b83:	85 c9                	test   %ecx,%ecx
+  800b85:	74 07                	je     800b8e <strtol+0x11d>
+  800b87:	f7 d8                	neg    %eax
+  800b89:	83 d2 00             	adc    $0x0,%edx
+  800b8c:	f7 da                	neg    %edx
+}
+  800b8e:	83 c4 1c             	add    $0x1c,%esp
+  800b91:	5b                   	pop    %ebx
+  800b92:	5e                   	pop    %esi
+  800b93:	5f                   	pop    %edi
+  800b94:	5d                   	pop    %ebp
+  800b95:	c3                   	ret
+
+00800b96 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b96:	55                   	push   %ebp
+  800b97:	89 e5                	mov    %esp,%ebp
+  800b99:	57                   	push   %edi
+  800b9a:	56                   	push   %esi
+  800b9b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800b9c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ba3:	74 18                	je     800bbd <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800baa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb0:	89 c3                	mov    %eax,%ebx
+  800bb2:	89 c7                	mov    %eax,%edi
+  800bb4:	89 c6                	mov    %eax,%esi
+  800bb6:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bb8:	5b                   	pop    %ebx
+  800bb9:	5e                   	pop    %esi
+  800bba:	5f                   	pop    %edi
+  800bbb:	5d                   	pop    %ebp
+  800bbc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc8:	89 c3                	mov    %eax,%ebx
+  800bca:	89 c7                	mov    %eax,%edi
+  800bcc:	55                   	push   %ebp
+  800bcd:	89 e5                	mov    %esp,%ebp
+  800bcf:	8d 35 d7 0b 80 00    	lea    0x800bd7,%esi
+  800bd5:	0f 34                	sysenter
+  800bd7:	5d                   	pop    %ebp
+		goto out;
+  800bd8:	eb de                	jmp    800bb8 <sys_cputs+0x22>
+
+00800bda <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bda:	55                   	push   %ebp
+  800bdb:	89 e5                	mov    %esp,%ebp
+  800bdd:	57                   	push   %edi
+  800bde:	56                   	push   %esi
+  800bdf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800be0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800be7:	74 19                	je     800c02 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800be9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bee:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bf3:	89 d1                	mov    %edx,%ecx
+  800bf5:	89 d3                	mov    %edx,%ebx
+  800bf7:	89 d7                	mov    %edx,%edi
+  800bf9:	89 d6                	mov    %edx,%esi
+  800bfb:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bfd:	5b                   	pop    %ebx
+  800bfe:	5e                   	pop    %esi
+  800bff:	5f                   	pop    %edi
+  800c00:	5d                   	pop    %ebp
+  800c01:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c07:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c0c:	89 d1                	mov    %edx,%ecx
+  800c0e:	89 d3                	mov    %edx,%ebx
+  800c10:	89 d7                	mov    %edx,%edi
+  800c12:	55                   	push   %ebp
+  800c13:	89 e5                	mov    %esp,%ebp
+  800c15:	8d 35 1d 0c 80 00    	lea    0x800c1d,%esi
+  800c1b:	0f 34                	sysenter
+  800c1d:	5d                   	pop    %ebp
+		goto out;
+  800c1e:	eb dd                	jmp    800bfd <sys_cgetc+0x23>
+
+00800c20 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	57                   	push   %edi
+  800c24:	56                   	push   %esi
+  800c25:	53                   	push   %ebx
+  800c26:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c29:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c30:	74 21                	je     800c53 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c37:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3f:	89 cb                	mov    %ecx,%ebx
+  800c41:	89 cf                	mov    %ecx,%edi
+  800c43:	89 ce                	mov    %ecx,%esi
+  800c45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c47:	85 c0                	test   %eax,%eax
+  800c49:	7f 27                	jg     800c72 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4e:	5b                   	pop    %ebx
+  800c4f:	5e                   	pop    %esi
+  800c50:	5f                   	pop    %edi
+  800c51:	5d                   	pop    %ebp
+  800c52:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c5b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c60:	89 cb                	mov    %ecx,%ebx
+  800c62:	89 cf                	mov    %ecx,%edi
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	8d 35 6f 0c 80 00    	lea    0x800c6f,%esi
+  800c6d:	0f 34                	sysenter
+  800c6f:	5d                   	pop    %ebp
+		goto out;
+  800c70:	eb d5                	jmp    800c47 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+  800c75:	50                   	push   %eax
+  800c76:	6a 03                	push   $0x3
+  800c78:	68 ab 2e 80 00       	push   $0x802eab
+  800c7d:	6a 3f                	push   $0x3f
+  800c7f:	68 c8 2e 80 00       	push   $0x802ec8
+  800c84:	e8 71 f4 ff ff       	call   8000fa <_panic>
+
+00800c89 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	57                   	push   %edi
+  800c8d:	56                   	push   %esi
+  800c8e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c8f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c96:	74 19                	je     800cb1 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800c98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c9d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ca2:	89 d1                	mov    %edx,%ecx
+  800ca4:	89 d3                	mov    %edx,%ebx
+  800ca6:	89 d7                	mov    %edx,%edi
+  800ca8:	89 d6                	mov    %edx,%esi
+  800caa:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cac:	5b                   	pop    %ebx
+  800cad:	5e                   	pop    %esi
+  800cae:	5f                   	pop    %edi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cbb:	89 d1                	mov    %edx,%ecx
+  800cbd:	89 d3                	mov    %edx,%ebx
+  800cbf:	89 d7                	mov    %edx,%edi
+  800cc1:	55                   	push   %ebp
+  800cc2:	89 e5                	mov    %esp,%ebp
+  800cc4:	8d 35 cc 0c 80 00    	lea    0x800ccc,%esi
+  800cca:	0f 34                	sysenter
+  800ccc:	5d                   	pop    %ebp
+		goto out;
+  800ccd:	eb dd                	jmp    800cac <sys_getenvid+0x23>
+
+00800ccf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	57                   	push   %edi
+  800cd3:	56                   	push   %esi
+  800cd4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cd5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cdc:	74 19                	je     800cf7 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800cde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ce8:	89 d1                	mov    %edx,%ecx
+  800cea:	89 d3                	mov    %edx,%ebx
+  800cec:	89 d7                	mov    %edx,%edi
+  800cee:	89 d6                	mov    %edx,%esi
+  800cf0:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cf2:	5b                   	pop    %ebx
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5f                   	pop    %edi
+  800cf5:	5d                   	pop    %ebp
+  800cf6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cf7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cfc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d01:	89 d1                	mov    %edx,%ecx
+  800d03:	89 d3                	mov    %edx,%ebx
+  800d05:	89 d7                	mov    %edx,%edi
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	8d 35 12 0d 80 00    	lea    0x800d12,%esi
+  800d10:	0f 34                	sysenter
+  800d12:	5d                   	pop    %ebp
+		goto out;
+  800d13:	eb dd                	jmp    800cf2 <sys_yield+0x23>
+
+00800d15 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	56                   	push   %esi
+  800d1a:	53                   	push   %ebx
+  800d1b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d1e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d25:	74 23                	je     800d4a <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d27:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3a:	89 f7                	mov    %esi,%edi
+  800d3c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3e:	85 c0                	test   %eax,%eax
+  800d40:	7f 29                	jg     800d6b <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d50:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d55:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5d:	55                   	push   %ebp
+  800d5e:	89 e5                	mov    %esp,%ebp
+  800d60:	8d 35 68 0d 80 00    	lea    0x800d68,%esi
+  800d66:	0f 34                	sysenter
+  800d68:	5d                   	pop    %ebp
+		goto out;
+  800d69:	eb d3                	jmp    800d3e <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6b:	83 ec 0c             	sub    $0xc,%esp
+  800d6e:	50                   	push   %eax
+  800d6f:	6a 04                	push   $0x4
+  800d71:	68 ab 2e 80 00       	push   $0x802eab
+  800d76:	6a 3f                	push   $0x3f
+  800d78:	68 c8 2e 80 00       	push   $0x802ec8
+  800d7d:	e8 78 f3 ff ff       	call   8000fa <_panic>
+
+00800d82 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	57                   	push   %edi
+  800d86:	56                   	push   %esi
+  800d87:	53                   	push   %ebx
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+  800d8b:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800d8e:	85 f6                	test   %esi,%esi
+  800d90:	75 09                	jne    800d9b <sys_page_map+0x19>
+  800d92:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d99:	74 1f                	je     800dba <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800d9b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800da0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dae:	85 c0                	test   %eax,%eax
+  800db0:	7f 27                	jg     800dd9 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800db2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db5:	5b                   	pop    %ebx
+  800db6:	5e                   	pop    %esi
+  800db7:	5f                   	pop    %edi
+  800db8:	5d                   	pop    %ebp
+  800db9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc0:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	8d 35 d6 0d 80 00    	lea    0x800dd6,%esi
+  800dd4:	0f 34                	sysenter
+  800dd6:	5d                   	pop    %ebp
+		goto out;
+  800dd7:	eb d5                	jmp    800dae <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd9:	83 ec 0c             	sub    $0xc,%esp
+  800ddc:	50                   	push   %eax
+  800ddd:	6a 05                	push   $0x5
+  800ddf:	68 ab 2e 80 00       	push   $0x802eab
+  800de4:	6a 3f                	push   $0x3f
+  800de6:	68 c8 2e 80 00       	push   $0x802ec8
+  800deb:	e8 0a f3 ff ff       	call   8000fa <_panic>
+
+00800df0 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800df0:	55                   	push   %ebp
+  800df1:	89 e5                	mov    %esp,%ebp
+  800df3:	57                   	push   %edi
+  800df4:	56                   	push   %esi
+  800df5:	53                   	push   %ebx
+  800df6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800df9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e00:	74 22                	je     800e24 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e07:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e12:	89 df                	mov    %ebx,%edi
+  800e14:	89 de                	mov    %ebx,%esi
+  800e16:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e18:	85 c0                	test   %eax,%eax
+  800e1a:	7f 28                	jg     800e44 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1f:	5b                   	pop    %ebx
+  800e20:	5e                   	pop    %esi
+  800e21:	5f                   	pop    %edi
+  800e22:	5d                   	pop    %ebp
+  800e23:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e34:	89 df                	mov    %ebx,%edi
+  800e36:	55                   	push   %ebp
+  800e37:	89 e5                	mov    %esp,%ebp
+  800e39:	8d 35 41 0e 80 00    	lea    0x800e41,%esi
+  800e3f:	0f 34                	sysenter
+  800e41:	5d                   	pop    %ebp
+		goto out;
+  800e42:	eb d4                	jmp    800e18 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e44:	83 ec 0c             	sub    $0xc,%esp
+  800e47:	50                   	push   %eax
+  800e48:	6a 06                	push   $0x6
+  800e4a:	68 ab 2e 80 00       	push   $0x802eab
+  800e4f:	6a 3f                	push   $0x3f
+  800e51:	68 c8 2e 80 00       	push   $0x802ec8
+  800e56:	e8 9f f2 ff ff       	call   8000fa <_panic>
+
+00800e5b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e5b:	55                   	push   %ebp
+  800e5c:	89 e5                	mov    %esp,%ebp
+  800e5e:	57                   	push   %edi
+  800e5f:	56                   	push   %esi
+  800e60:	53                   	push   %ebx
+  800e61:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e64:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e6b:	74 22                	je     800e8f <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800e6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e72:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7d:	89 df                	mov    %ebx,%edi
+  800e7f:	89 de                	mov    %ebx,%esi
+  800e81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e83:	85 c0                	test   %eax,%eax
+  800e85:	7f 28                	jg     800eaf <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8a:	5b                   	pop    %ebx
+  800e8b:	5e                   	pop    %esi
+  800e8c:	5f                   	pop    %edi
+  800e8d:	5d                   	pop    %ebp
+  800e8e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e9f:	89 df                	mov    %ebx,%edi
+  800ea1:	55                   	push   %ebp
+  800ea2:	89 e5                	mov    %esp,%ebp
+  800ea4:	8d 35 ac 0e 80 00    	lea    0x800eac,%esi
+  800eaa:	0f 34                	sysenter
+  800eac:	5d                   	pop    %ebp
+		goto out;
+  800ead:	eb d4                	jmp    800e83 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eaf:	83 ec 0c             	sub    $0xc,%esp
+  800eb2:	50                   	push   %eax
+  800eb3:	6a 08                	push   $0x8
+  800eb5:	68 ab 2e 80 00       	push   $0x802eab
+  800eba:	6a 3f                	push   $0x3f
+  800ebc:	68 c8 2e 80 00       	push   $0x802ec8
+  800ec1:	e8 34 f2 ff ff       	call   8000fa <_panic>
+
+00800ec6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ec6:	55                   	push   %ebp
+  800ec7:	89 e5                	mov    %esp,%ebp
+  800ec9:	57                   	push   %edi
+  800eca:	56                   	push   %esi
+  800ecb:	53                   	push   %ebx
+  800ecc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ecf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ed6:	74 22                	je     800efa <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ed8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edd:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee8:	89 df                	mov    %ebx,%edi
+  800eea:	89 de                	mov    %ebx,%esi
+  800eec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eee:	85 c0                	test   %eax,%eax
+  800ef0:	7f 28                	jg     800f1a <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ef2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef5:	5b                   	pop    %ebx
+  800ef6:	5e                   	pop    %esi
+  800ef7:	5f                   	pop    %edi
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800efa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f05:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f0a:	89 df                	mov    %ebx,%edi
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	8d 35 17 0f 80 00    	lea    0x800f17,%esi
+  800f15:	0f 34                	sysenter
+  800f17:	5d                   	pop    %ebp
+		goto out;
+  800f18:	eb d4                	jmp    800eee <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f1a:	83 ec 0c             	sub    $0xc,%esp
+  800f1d:	50                   	push   %eax
+  800f1e:	6a 09                	push   $0x9
+  800f20:	68 ab 2e 80 00       	push   $0x802eab
+  800f25:	6a 3f                	push   $0x3f
+  800f27:	68 c8 2e 80 00       	push   $0x802ec8
+  800f2c:	e8 c9 f1 ff ff       	call   8000fa <_panic>
+
+00800f31 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	57                   	push   %edi
+  800f35:	56                   	push   %esi
+  800f36:	53                   	push   %ebx
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f3a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f41:	74 22                	je     800f65 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f48:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f53:	89 df                	mov    %ebx,%edi
+  800f55:	89 de                	mov    %ebx,%esi
+  800f57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f59:	85 c0                	test   %eax,%eax
+  800f5b:	7f 28                	jg     800f85 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f70:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f75:	89 df                	mov    %ebx,%edi
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	8d 35 82 0f 80 00    	lea    0x800f82,%esi
+  800f80:	0f 34                	sysenter
+  800f82:	5d                   	pop    %ebp
+		goto out;
+  800f83:	eb d4                	jmp    800f59 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f85:	83 ec 0c             	sub    $0xc,%esp
+  800f88:	50                   	push   %eax
+  800f89:	6a 0a                	push   $0xa
+  800f8b:	68 ab 2e 80 00       	push   $0x802eab
+  800f90:	6a 3f                	push   $0x3f
+  800f92:	68 c8 2e 80 00       	push   $0x802ec8
+  800f97:	e8 5e f1 ff ff       	call   8000fa <_panic>
+
+00800f9c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800f9c:	55                   	push   %ebp
+  800f9d:	89 e5                	mov    %esp,%ebp
+  800f9f:	57                   	push   %edi
+  800fa0:	56                   	push   %esi
+  800fa1:	53                   	push   %ebx
+  800fa2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fa5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fac:	74 22                	je     800fd0 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  800fae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb3:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbe:	89 df                	mov    %ebx,%edi
+  800fc0:	89 de                	mov    %ebx,%esi
+  800fc2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc4:	85 c0                	test   %eax,%eax
+  800fc6:	7f 28                	jg     800ff0 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  800fc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcb:	5b                   	pop    %ebx
+  800fcc:	5e                   	pop    %esi
+  800fcd:	5f                   	pop    %edi
+  800fce:	5d                   	pop    %ebp
+  800fcf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fd0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdb:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fe0:	89 df                	mov    %ebx,%edi
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	8d 35 ed 0f 80 00    	lea    0x800fed,%esi
+  800feb:	0f 34                	sysenter
+  800fed:	5d                   	pop    %ebp
+		goto out;
+  800fee:	eb d4                	jmp    800fc4 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff0:	83 ec 0c             	sub    $0xc,%esp
+  800ff3:	50                   	push   %eax
+  800ff4:	6a 17                	push   $0x17
+  800ff6:	68 ab 2e 80 00       	push   $0x802eab
+  800ffb:	6a 3f                	push   $0x3f
+  800ffd:	68 c8 2e 80 00       	push   $0x802ec8
+  801002:	e8 f3 f0 ff ff       	call   8000fa <_panic>
+
+00801007 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	56                   	push   %esi
+  80100c:	53                   	push   %ebx
+  80100d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801010:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801017:	74 22                	je     80103b <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801019:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801023:	8b 55 08             	mov    0x8(%ebp),%edx
+  801026:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801029:	89 df                	mov    %ebx,%edi
+  80102b:	89 de                	mov    %ebx,%esi
+  80102d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102f:	85 c0                	test   %eax,%eax
+  801031:	7f 28                	jg     80105b <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801036:	5b                   	pop    %ebx
+  801037:	5e                   	pop    %esi
+  801038:	5f                   	pop    %edi
+  801039:	5d                   	pop    %ebp
+  80103a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80103b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801040:	8b 55 08             	mov    0x8(%ebp),%edx
+  801043:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801046:	b8 18 00 00 00       	mov    $0x18,%eax
+  80104b:	89 df                	mov    %ebx,%edi
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	8d 35 58 10 80 00    	lea    0x801058,%esi
+  801056:	0f 34                	sysenter
+  801058:	5d                   	pop    %ebp
+		goto out;
+  801059:	eb d4                	jmp    80102f <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+  80105e:	50                   	push   %eax
+  80105f:	6a 18                	push   $0x18
+  801061:	68 ab 2e 80 00       	push   $0x802eab
+  801066:	6a 3f                	push   $0x3f
+  801068:	68 c8 2e 80 00       	push   $0x802ec8
+  80106d:	e8 88 f0 ff ff       	call   8000fa <_panic>
+
+00801072 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	57                   	push   %edi
+  801076:	56                   	push   %esi
+  801077:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801078:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80107f:	74 1d                	je     80109e <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801081:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801086:	be 00 00 00 00       	mov    $0x0,%esi
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801094:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801097:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801099:	5b                   	pop    %ebx
+  80109a:	5e                   	pop    %esi
+  80109b:	5f                   	pop    %edi
+  80109c:	5d                   	pop    %ebp
+  80109d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	8d 35 ba 10 80 00    	lea    0x8010ba,%esi
+  8010b8:	0f 34                	sysenter
+  8010ba:	5d                   	pop    %ebp
+		goto out;
+  8010bb:	eb dc                	jmp    801099 <sys_ipc_try_send+0x27>
+
+008010bd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	57                   	push   %edi
+  8010c1:	56                   	push   %esi
+  8010c2:	53                   	push   %ebx
+  8010c3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010c6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010cd:	74 21                	je     8010f0 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8010cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dc:	89 cb                	mov    %ecx,%ebx
+  8010de:	89 cf                	mov    %ecx,%edi
+  8010e0:	89 ce                	mov    %ecx,%esi
+  8010e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e4:	85 c0                	test   %eax,%eax
+  8010e6:	7f 27                	jg     80110f <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8010e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010eb:	5b                   	pop    %ebx
+  8010ec:	5e                   	pop    %esi
+  8010ed:	5f                   	pop    %edi
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010fd:	89 cb                	mov    %ecx,%ebx
+  8010ff:	89 cf                	mov    %ecx,%edi
+  801101:	55                   	push   %ebp
+  801102:	89 e5                	mov    %esp,%ebp
+  801104:	8d 35 0c 11 80 00    	lea    0x80110c,%esi
+  80110a:	0f 34                	sysenter
+  80110c:	5d                   	pop    %ebp
+		goto out;
+  80110d:	eb d5                	jmp    8010e4 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+  801112:	50                   	push   %eax
+  801113:	6a 0d                	push   $0xd
+  801115:	68 ab 2e 80 00       	push   $0x802eab
+  80111a:	6a 3f                	push   $0x3f
+  80111c:	68 c8 2e 80 00       	push   $0x802ec8
+  801121:	e8 d4 ef ff ff       	call   8000fa <_panic>
+
+00801126 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	57                   	push   %edi
+  80112a:	56                   	push   %esi
+  80112b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80112c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801133:	74 1b                	je     801150 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801135:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80113f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801142:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801145:	89 df                	mov    %ebx,%edi
+  801147:	89 de                	mov    %ebx,%esi
+  801149:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80114b:	5b                   	pop    %ebx
+  80114c:	5e                   	pop    %esi
+  80114d:	5f                   	pop    %edi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801150:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801155:	8b 55 08             	mov    0x8(%ebp),%edx
+  801158:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801160:	89 df                	mov    %ebx,%edi
+  801162:	55                   	push   %ebp
+  801163:	89 e5                	mov    %esp,%ebp
+  801165:	8d 35 6d 11 80 00    	lea    0x80116d,%esi
+  80116b:	0f 34                	sysenter
+  80116d:	5d                   	pop    %ebp
+		goto out;
+  80116e:	eb db                	jmp    80114b <sys_ipc_recv_until+0x25>
+
+00801170 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801176:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80117d:	74 19                	je     801198 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80117f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801184:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801189:	89 d1                	mov    %edx,%ecx
+  80118b:	89 d3                	mov    %edx,%ebx
+  80118d:	89 d7                	mov    %edx,%edi
+  80118f:	89 d6                	mov    %edx,%esi
+  801191:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801193:	5b                   	pop    %ebx
+  801194:	5e                   	pop    %esi
+  801195:	5f                   	pop    %edi
+  801196:	5d                   	pop    %ebp
+  801197:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801198:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011a2:	89 d1                	mov    %edx,%ecx
+  8011a4:	89 d3                	mov    %edx,%ebx
+  8011a6:	89 d7                	mov    %edx,%edi
+  8011a8:	55                   	push   %ebp
+  8011a9:	89 e5                	mov    %esp,%ebp
+  8011ab:	8d 35 b3 11 80 00    	lea    0x8011b3,%esi
+  8011b1:	0f 34                	sysenter
+  8011b3:	5d                   	pop    %ebp
+		goto out;
+  8011b4:	eb dd                	jmp    801193 <sys_time_msec+0x23>
+
+008011b6 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8011b6:	55                   	push   %ebp
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	57                   	push   %edi
+  8011ba:	56                   	push   %esi
+  8011bb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011bc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011c3:	74 1a                	je     8011df <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8011c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ca:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d2:	89 cb                	mov    %ecx,%ebx
+  8011d4:	89 cf                	mov    %ecx,%edi
+  8011d6:	89 ce                	mov    %ecx,%esi
+  8011d8:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011ec:	89 cb                	mov    %ecx,%ebx
+  8011ee:	89 cf                	mov    %ecx,%edi
+  8011f0:	55                   	push   %ebp
+  8011f1:	89 e5                	mov    %esp,%ebp
+  8011f3:	8d 35 fb 11 80 00    	lea    0x8011fb,%esi
+  8011f9:	0f 34                	sysenter
+  8011fb:	5d                   	pop    %ebp
+		goto out;
+  8011fc:	eb dc                	jmp    8011da <sys_sleep_until+0x24>
+
+008011fe <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	57                   	push   %edi
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801204:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80120b:	74 1a                	je     801227 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80120d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801212:	b8 11 00 00 00       	mov    $0x11,%eax
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	89 cb                	mov    %ecx,%ebx
+  80121c:	89 cf                	mov    %ecx,%edi
+  80121e:	89 ce                	mov    %ecx,%esi
+  801220:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801222:	5b                   	pop    %ebx
+  801223:	5e                   	pop    %esi
+  801224:	5f                   	pop    %edi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80122f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801234:	89 cb                	mov    %ecx,%ebx
+  801236:	89 cf                	mov    %ecx,%edi
+  801238:	55                   	push   %ebp
+  801239:	89 e5                	mov    %esp,%ebp
+  80123b:	8d 35 43 12 80 00    	lea    0x801243,%esi
+  801241:	0f 34                	sysenter
+  801243:	5d                   	pop    %ebp
+		goto out;
+  801244:	eb dc                	jmp    801222 <sys_env_print_stats+0x24>
+
+00801246 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	57                   	push   %edi
+  80124a:	56                   	push   %esi
+  80124b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80124c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801253:	74 1b                	je     801270 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80125f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801262:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801265:	89 df                	mov    %ebx,%edi
+  801267:	89 de                	mov    %ebx,%esi
+  801269:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80126b:	5b                   	pop    %ebx
+  80126c:	5e                   	pop    %esi
+  80126d:	5f                   	pop    %edi
+  80126e:	5d                   	pop    %ebp
+  80126f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801270:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801275:	8b 55 08             	mov    0x8(%ebp),%edx
+  801278:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801280:	89 df                	mov    %ebx,%edi
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	8d 35 8d 12 80 00    	lea    0x80128d,%esi
+  80128b:	0f 34                	sysenter
+  80128d:	5d                   	pop    %ebp
+		goto out;
+  80128e:	eb db                	jmp    80126b <sys_perf+0x25>
+
+00801290 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	57                   	push   %edi
+  801294:	56                   	push   %esi
+  801295:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801296:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80129d:	74 19                	je     8012b8 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80129f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012a9:	89 d1                	mov    %edx,%ecx
+  8012ab:	89 d3                	mov    %edx,%ebx
+  8012ad:	89 d7                	mov    %edx,%edi
+  8012af:	89 d6                	mov    %edx,%esi
+  8012b1:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012b3:	5b                   	pop    %ebx
+  8012b4:	5e                   	pop    %esi
+  8012b5:	5f                   	pop    %edi
+  8012b6:	5d                   	pop    %ebp
+  8012b7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012c2:	89 d1                	mov    %edx,%ecx
+  8012c4:	89 d3                	mov    %edx,%ebx
+  8012c6:	89 d7                	mov    %edx,%edi
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+  8012cb:	8d 35 d3 12 80 00    	lea    0x8012d3,%esi
+  8012d1:	0f 34                	sysenter
+  8012d3:	5d                   	pop    %ebp
+		goto out;
+  8012d4:	eb dd                	jmp    8012b3 <sys_fork+0x23>
+
+008012d6 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8012d6:	55                   	push   %ebp
+  8012d7:	89 e5                	mov    %esp,%ebp
+  8012d9:	57                   	push   %edi
+  8012da:	56                   	push   %esi
+  8012db:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012dc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012e3:	74 1c                	je     801301 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8012e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ea:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8012ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f8:	89 f7                	mov    %esi,%edi
+  8012fa:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8012fc:	5b                   	pop    %ebx
+  8012fd:	5e                   	pop    %esi
+  8012fe:	5f                   	pop    %edi
+  8012ff:	5d                   	pop    %ebp
+  801300:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801301:	8b 55 08             	mov    0x8(%ebp),%edx
+  801304:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801307:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80130c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801311:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	8d 35 1f 13 80 00    	lea    0x80131f,%esi
+  80131d:	0f 34                	sysenter
+  80131f:	5d                   	pop    %ebp
+		goto out;
+  801320:	eb da                	jmp    8012fc <sys_thread_create+0x26>
+
+00801322 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801322:	55                   	push   %ebp
+  801323:	89 e5                	mov    %esp,%ebp
+  801325:	57                   	push   %edi
+  801326:	56                   	push   %esi
+  801327:	53                   	push   %ebx
+  801328:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80132b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801332:	74 24                	je     801358 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801334:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801339:	be 00 00 00 00       	mov    $0x0,%esi
+  80133e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801341:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801344:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801347:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80134a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80134c:	85 c0                	test   %eax,%eax
+  80134e:	7f 27                	jg     801377 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801350:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801353:	5b                   	pop    %ebx
+  801354:	5e                   	pop    %esi
+  801355:	5f                   	pop    %edi
+  801356:	5d                   	pop    %ebp
+  801357:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801358:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801363:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801366:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	8d 35 74 13 80 00    	lea    0x801374,%esi
+  801372:	0f 34                	sysenter
+  801374:	5d                   	pop    %ebp
+		goto out;
+  801375:	eb d5                	jmp    80134c <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801377:	83 ec 0c             	sub    $0xc,%esp
+  80137a:	50                   	push   %eax
+  80137b:	6a 1f                	push   $0x1f
+  80137d:	68 ab 2e 80 00       	push   $0x802eab
+  801382:	6a 3f                	push   $0x3f
+  801384:	68 c8 2e 80 00       	push   $0x802ec8
+  801389:	e8 6c ed ff ff       	call   8000fa <_panic>
+
+0080138e <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80138e:	55                   	push   %ebp
+  80138f:	89 e5                	mov    %esp,%ebp
+  801391:	57                   	push   %edi
+  801392:	56                   	push   %esi
+  801393:	53                   	push   %ebx
+  801394:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801397:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80139e:	74 23                	je     8013c3 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a5:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b3:	89 f7                	mov    %esi,%edi
+  8013b5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013b7:	85 c0                	test   %eax,%eax
+  8013b9:	7f 29                	jg     8013e4 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8013bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013be:	5b                   	pop    %ebx
+  8013bf:	5e                   	pop    %esi
+  8013c0:	5f                   	pop    %edi
+  8013c1:	5d                   	pop    %ebp
+  8013c2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c9:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d6:	55                   	push   %ebp
+  8013d7:	89 e5                	mov    %esp,%ebp
+  8013d9:	8d 35 e1 13 80 00    	lea    0x8013e1,%esi
+  8013df:	0f 34                	sysenter
+  8013e1:	5d                   	pop    %ebp
+		goto out;
+  8013e2:	eb d3                	jmp    8013b7 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013e4:	83 ec 0c             	sub    $0xc,%esp
+  8013e7:	50                   	push   %eax
+  8013e8:	6a 20                	push   $0x20
+  8013ea:	68 ab 2e 80 00       	push   $0x802eab
+  8013ef:	6a 3f                	push   $0x3f
+  8013f1:	68 c8 2e 80 00       	push   $0x802ec8
+  8013f6:	e8 ff ec ff ff       	call   8000fa <_panic>
+
+008013fb <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8013fb:	55                   	push   %ebp
+  8013fc:	89 e5                	mov    %esp,%ebp
+  8013fe:	57                   	push   %edi
+  8013ff:	56                   	push   %esi
+  801400:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801401:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801408:	74 1b                	je     801425 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80140a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80140f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801414:	8b 55 08             	mov    0x8(%ebp),%edx
+  801417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141a:	89 df                	mov    %ebx,%edi
+  80141c:	89 de                	mov    %ebx,%esi
+  80141e:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801420:	5b                   	pop    %ebx
+  801421:	5e                   	pop    %esi
+  801422:	5f                   	pop    %edi
+  801423:	5d                   	pop    %ebp
+  801424:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801425:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801430:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801435:	89 df                	mov    %ebx,%edi
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	8d 35 42 14 80 00    	lea    0x801442,%esi
+  801440:	0f 34                	sysenter
+  801442:	5d                   	pop    %ebp
+		goto out;
+  801443:	eb db                	jmp    801420 <sys_batch+0x25>
+
+00801445 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	57                   	push   %edi
+  801449:	56                   	push   %esi
+  80144a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80144b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801452:	74 1a                	je     80146e <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801454:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801459:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80145e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801461:	89 cb                	mov    %ecx,%ebx
+  801463:	89 cf                	mov    %ecx,%edi
+  801465:	89 ce                	mov    %ecx,%esi
+  801467:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801469:	5b                   	pop    %ebx
+  80146a:	5e                   	pop    %esi
+  80146b:	5f                   	pop    %edi
+  80146c:	5d                   	pop    %ebp
+  80146d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80146e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801471:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801476:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80147b:	89 cb                	mov    %ecx,%ebx
+  80147d:	89 cf                	mov    %ecx,%edi
+  80147f:	55                   	push   %ebp
+  801480:	89 e5                	mov    %esp,%ebp
+  801482:	8d 35 8a 14 80 00    	lea    0x80148a,%esi
+  801488:	0f 34                	sysenter
+  80148a:	5d                   	pop    %ebp
+		goto out;
+  80148b:	eb dc                	jmp    801469 <sys_trace_ctl+0x24>
+
+0080148d <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80148d:	55                   	push   %ebp
+  80148e:	89 e5                	mov    %esp,%ebp
+  801490:	57                   	push   %edi
+  801491:	56                   	push   %esi
+  801492:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801493:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80149a:	74 1c                	je     8014b8 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80149c:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014af:	89 f7                	mov    %esi,%edi
+  8014b1:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8014b3:	5b                   	pop    %ebx
+  8014b4:	5e                   	pop    %esi
+  8014b5:	5f                   	pop    %edi
+  8014b6:	5d                   	pop    %ebp
+  8014b7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014cb:	55                   	push   %ebp
+  8014cc:	89 e5                	mov    %esp,%ebp
+  8014ce:	8d 35 d6 14 80 00    	lea    0x8014d6,%esi
+  8014d4:	0f 34                	sysenter
+  8014d6:	5d                   	pop    %ebp
+		goto out;
+  8014d7:	eb da                	jmp    8014b3 <sys_trace_read+0x26>
+
+008014d9 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8014d9:	55                   	push   %ebp
+  8014da:	89 e5                	mov    %esp,%ebp
+  8014dc:	57                   	push   %edi
+  8014dd:	56                   	push   %esi
+  8014de:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014df:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e6:	74 1c                	je     801504 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8014e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ed:	b8 21 00 00 00       	mov    $0x21,%eax
+  8014f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fb:	89 f7                	mov    %esi,%edi
+  8014fd:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8014ff:	5b                   	pop    %ebx
+  801500:	5e                   	pop    %esi
+  801501:	5f                   	pop    %edi
+  801502:	5d                   	pop    %ebp
+  801503:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801504:	8b 55 08             	mov    0x8(%ebp),%edx
+  801507:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80150f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801514:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801517:	55                   	push   %ebp
+  801518:	89 e5                	mov    %esp,%ebp
+  80151a:	8d 35 22 15 80 00    	lea    0x801522,%esi
+  801520:	0f 34                	sysenter
+  801522:	5d                   	pop    %ebp
+		goto out;
+  801523:	eb da                	jmp    8014ff <sys_meminfo+0x26>
+
+00801525 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801525:	55                   	push   %ebp
+  801526:	89 e5                	mov    %esp,%ebp
+  801528:	57                   	push   %edi
+  801529:	56                   	push   %esi
+  80152a:	53                   	push   %ebx
+  80152b:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80152e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801532:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801539:	74 1f                	je     80155a <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80153b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801540:	b8 22 00 00 00       	mov    $0x22,%eax
+  801545:	8b 55 08             	mov    0x8(%ebp),%edx
+  801548:	89 df                	mov    %ebx,%edi
+  80154a:	89 de                	mov    %ebx,%esi
+  80154c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80154e:	85 c0                	test   %eax,%eax
+  801550:	7f 25                	jg     801577 <sys_env_set_ksm+0x52>
+}
+  801552:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801555:	5b                   	pop    %ebx
+  801556:	5e                   	pop    %esi
+  801557:	5f                   	pop    %edi
+  801558:	5d                   	pop    %ebp
+  801559:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80155a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801562:	b8 22 00 00 00       	mov    $0x22,%eax
+  801567:	89 df                	mov    %ebx,%edi
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	8d 35 74 15 80 00    	lea    0x801574,%esi
+  801572:	0f 34                	sysenter
+  801574:	5d                   	pop    %ebp
+		goto out;
+  801575:	eb d7                	jmp    80154e <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801577:	83 ec 0c             	sub    $0xc,%esp
+  80157a:	50                   	push   %eax
+  80157b:	6a 22                	push   $0x22
+  80157d:	68 ab 2e 80 00       	push   $0x802eab
+  801582:	6a 3f                	push   $0x3f
+  801584:	68 c8 2e 80 00       	push   $0x802ec8
+  801589:	e8 6c eb ff ff       	call   8000fa <_panic>
+
+0080158e <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	57                   	push   %edi
+  801592:	56                   	push   %esi
+  801593:	53                   	push   %ebx
+  801594:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801597:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80159a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015a1:	74 24                	je     8015c7 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015ad:	89 cb                	mov    %ecx,%ebx
+  8015af:	89 cf                	mov    %ecx,%edi
+  8015b1:	89 ce                	mov    %ecx,%esi
+  8015b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015b5:	85 c0                	test   %eax,%eax
+  8015b7:	7f 2a                	jg     8015e3 <sys_time_nsec+0x55>
+	return ns;
+}
+  8015b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015bc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8015bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c2:	5b                   	pop    %ebx
+  8015c3:	5e                   	pop    %esi
+  8015c4:	5f                   	pop    %edi
+  8015c5:	5d                   	pop    %ebp
+  8015c6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015cc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015d1:	89 cb                	mov    %ecx,%ebx
+  8015d3:	89 cf                	mov    %ecx,%edi
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+  8015d8:	8d 35 e0 15 80 00    	lea    0x8015e0,%esi
+  8015de:	0f 34                	sysenter
+  8015e0:	5d                   	pop    %ebp
+		goto out;
+  8015e1:	eb d2                	jmp    8015b5 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015e3:	83 ec 0c             	sub    $0xc,%esp
+  8015e6:	50                   	push   %eax
+  8015e7:	6a 0f                	push   $0xf
+  8015e9:	68 ab 2e 80 00       	push   $0x802eab
+  8015ee:	6a 3f                	push   $0x3f
+  8015f0:	68 c8 2e 80 00       	push   $0x802ec8
+  8015f5:	e8 00 eb ff ff       	call   8000fa <_panic>
+
+008015fa <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	57                   	push   %edi
+  8015fe:	56                   	push   %esi
+  8015ff:	53                   	push   %ebx
+  801600:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801603:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80160a:	74 22                	je     80162e <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80160c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801611:	b8 12 00 00 00       	mov    $0x12,%eax
+  801616:	8b 55 08             	mov    0x8(%ebp),%edx
+  801619:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161c:	89 df                	mov    %ebx,%edi
+  80161e:	89 de                	mov    %ebx,%esi
+  801620:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801622:	85 c0                	test   %eax,%eax
+  801624:	7f 28                	jg     80164e <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801629:	5b                   	pop    %ebx
+  80162a:	5e                   	pop    %esi
+  80162b:	5f                   	pop    %edi
+  80162c:	5d                   	pop    %ebp
+  80162d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80162e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801633:	8b 55 08             	mov    0x8(%ebp),%edx
+  801636:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801639:	b8 12 00 00 00       	mov    $0x12,%eax
+  80163e:	89 df                	mov    %ebx,%edi
+  801640:	55                   	push   %ebp
+  801641:	89 e5                	mov    %esp,%ebp
+  801643:	8d 35 4b 16 80 00    	lea    0x80164b,%esi
+  801649:	0f 34                	sysenter
+  80164b:	5d                   	pop    %ebp
+		goto out;
+  80164c:	eb d4                	jmp    801622 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80164e:	83 ec 0c             	sub    $0xc,%esp
+  801651:	50                   	push   %eax
+  801652:	6a 12                	push   $0x12
+  801654:	68 ab 2e 80 00       	push   $0x802eab
+  801659:	6a 3f                	push   $0x3f
+  80165b:	68 c8 2e 80 00       	push   $0x802ec8
+  801660:	e8 95 ea ff ff       	call   8000fa <_panic>
+
+00801665 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801665:	55                   	push   %ebp
+  801666:	89 e5                	mov    %esp,%ebp
+  801668:	57                   	push   %edi
+  801669:	56                   	push   %esi
+  80166a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80166b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801672:	74 1b                	je     80168f <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801674:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801679:	b8 13 00 00 00       	mov    $0x13,%eax
+  80167e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801681:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801684:	89 df                	mov    %ebx,%edi
+  801686:	89 de                	mov    %ebx,%esi
+  801688:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80168a:	5b                   	pop    %ebx
+  80168b:	5e                   	pop    %esi
+  80168c:	5f                   	pop    %edi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80168f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801694:	8b 55 08             	mov    0x8(%ebp),%edx
+  801697:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80169f:	89 df                	mov    %ebx,%edi
+  8016a1:	55                   	push   %ebp
+  8016a2:	89 e5                	mov    %esp,%ebp
+  8016a4:	8d 35 ac 16 80 00    	lea    0x8016ac,%esi
+  8016aa:	0f 34                	sysenter
+  8016ac:	5d                   	pop    %ebp
+		goto out;
+  8016ad:	eb db                	jmp    80168a <sys_e1000_receive+0x25>
+
+008016af <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	57                   	push   %edi
+  8016b3:	56                   	push   %esi
+  8016b4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016b5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016bc:	74 1b                	je     8016d9 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8016be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ce:	89 df                	mov    %ebx,%edi
+  8016d0:	89 de                	mov    %ebx,%esi
+  8016d2:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016d4:	5b                   	pop    %ebx
+  8016d5:	5e                   	pop    %esi
+  8016d6:	5f                   	pop    %edi
+  8016d7:	5d                   	pop    %ebp
+  8016d8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016e9:	89 df                	mov    %ebx,%edi
+  8016eb:	55                   	push   %ebp
+  8016ec:	89 e5                	mov    %esp,%ebp
+  8016ee:	8d 35 f6 16 80 00    	lea    0x8016f6,%esi
+  8016f4:	0f 34                	sysenter
+  8016f6:	5d                   	pop    %ebp
+		goto out;
+  8016f7:	eb db                	jmp    8016d4 <sys_e1000_read_hwaddr+0x25>
+
+008016f9 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	57                   	push   %edi
+  8016fd:	56                   	push   %esi
+  8016fe:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016ff:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801706:	74 1a                	je     801722 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801708:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80170d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801712:	8b 55 08             	mov    0x8(%ebp),%edx
+  801715:	89 cb                	mov    %ecx,%ebx
+  801717:	89 cf                	mov    %ecx,%edi
+  801719:	89 ce                	mov    %ecx,%esi
+  80171b:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80171d:	5b                   	pop    %ebx
+  80171e:	5e                   	pop    %esi
+  80171f:	5f                   	pop    %edi
+  801720:	5d                   	pop    %ebp
+  801721:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801722:	8b 55 08             	mov    0x8(%ebp),%edx
+  801725:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80172a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80172f:	89 cb                	mov    %ecx,%ebx
+  801731:	89 cf                	mov    %ecx,%edi
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	8d 35 3e 17 80 00    	lea    0x80173e,%esi
+  80173c:	0f 34                	sysenter
+  80173e:	5d                   	pop    %ebp
+		goto out;
+  80173f:	eb dc                	jmp    80171d <sys_sb16_read_version+0x24>
+
+00801741 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801741:	55                   	push   %ebp
+  801742:	89 e5                	mov    %esp,%ebp
+  801744:	57                   	push   %edi
+  801745:	56                   	push   %esi
+  801746:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801747:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80174e:	74 1b                	je     80176b <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801750:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801755:	b8 16 00 00 00       	mov    $0x16,%eax
+  80175a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801760:	89 df                	mov    %ebx,%edi
+  801762:	89 de                	mov    %ebx,%esi
+  801764:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801766:	5b                   	pop    %ebx
+  801767:	5e                   	pop    %esi
+  801768:	5f                   	pop    %edi
+  801769:	5d                   	pop    %ebp
+  80176a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80176b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801770:	8b 55 08             	mov    0x8(%ebp),%edx
+  801773:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801776:	b8 16 00 00 00       	mov    $0x16,%eax
+  80177b:	89 df                	mov    %ebx,%edi
+  80177d:	55                   	push   %ebp
+  80177e:	89 e5                	mov    %esp,%ebp
+  801780:	8d 35 88 17 80 00    	lea    0x801788,%esi
+  801786:	0f 34                	sysenter
+  801788:	5d                   	pop    %ebp
+		goto out;
+  801789:	eb db                	jmp    801766 <sys_sb16_play+0x25>
+
+0080178b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80178e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801791:	05 00 00 00 30       	add    $0x30000000,%eax
+  801796:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801799:	5d                   	pop    %ebp
+  80179a:	c3                   	ret
+
+0080179b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80179b:	55                   	push   %ebp
+  80179c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80179e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017a1:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017a6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017ab:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017b0:	5d                   	pop    %ebp
+  8017b1:	c3                   	ret
+
+008017b2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8017b5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017ba:	eb 02                	jmp    8017be <fd_alloc+0xc>
+  8017bc:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017be:	89 c2                	mov    %eax,%edx
+  8017c0:	c1 ea 16             	shr    $0x16,%edx
+  8017c3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017ca:	f6 c2 01             	test   $0x1,%dl
+  8017cd:	74 2b                	je     8017fa <fd_alloc+0x48>
+  8017cf:	89 c2                	mov    %eax,%edx
+  8017d1:	c1 ea 0c             	shr    $0xc,%edx
+  8017d4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017db:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017e1:	f6 c1 01             	test   $0x1,%cl
+  8017e4:	74 14                	je     8017fa <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8017e6:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017ec:	75 ce                	jne    8017bc <fd_alloc+0xa>
+  8017ee:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8017f3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8017f8:	eb 05                	jmp    8017ff <fd_alloc+0x4d>
+			return 0;
+  8017fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8017ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801802:	89 02                	mov    %eax,(%edx)
+}
+  801804:	89 c8                	mov    %ecx,%eax
+  801806:	5d                   	pop    %ebp
+  801807:	c3                   	ret
+
+00801808 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80180e:	83 f8 1f             	cmp    $0x1f,%eax
+  801811:	77 30                	ja     801843 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801813:	c1 e0 0c             	shl    $0xc,%eax
+  801816:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80181b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801821:	f6 c2 01             	test   $0x1,%dl
+  801824:	74 24                	je     80184a <fd_lookup+0x42>
+  801826:	89 c2                	mov    %eax,%edx
+  801828:	c1 ea 0c             	shr    $0xc,%edx
+  80182b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801832:	f6 c2 01             	test   $0x1,%dl
+  801835:	74 1a                	je     801851 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801837:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80183a:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80183c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801841:	5d                   	pop    %ebp
+  801842:	c3                   	ret
+		return -E_INVAL;
+  801843:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801848:	eb f7                	jmp    801841 <fd_lookup+0x39>
+		return -E_INVAL;
+  80184a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80184f:	eb f0                	jmp    801841 <fd_lookup+0x39>
+  801851:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801856:	eb e9                	jmp    801841 <fd_lookup+0x39>
+
+00801858 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	53                   	push   %ebx
+  80185c:	83 ec 04             	sub    $0x4,%esp
+  80185f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801862:	b8 00 00 00 00       	mov    $0x0,%eax
+  801867:	eb 03                	jmp    80186c <dev_lookup+0x14>
+  801869:	83 c0 01             	add    $0x1,%eax
+  80186c:	8b 1c 85 54 2f 80 00 	mov    0x802f54(,%eax,4),%ebx
+  801873:	85 db                	test   %ebx,%ebx
+  801875:	74 0b                	je     801882 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801877:	39 13                	cmp    %edx,(%ebx)
+  801879:	75 ee                	jne    801869 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80187b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801880:	eb 2e                	jmp    8018b0 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801882:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801884:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801889:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80188f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801894:	76 24                	jbe    8018ba <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801896:	8b 41 48             	mov    0x48(%ecx),%eax
+  801899:	83 ec 04             	sub    $0x4,%esp
+  80189c:	52                   	push   %edx
+  80189d:	50                   	push   %eax
+  80189e:	68 d8 2e 80 00       	push   $0x802ed8
+  8018a3:	e8 2d e9 ff ff       	call   8001d5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018a8:	83 c4 10             	add    $0x10,%esp
+  8018ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8018b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018b3:	89 1a                	mov    %ebx,(%edx)
+}
+  8018b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b8:	c9                   	leave
+  8018b9:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8018ba:	c1 e8 10             	shr    $0x10,%eax
+  8018bd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8018c3:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8018c9:	eb cb                	jmp    801896 <dev_lookup+0x3e>
+
+008018cb <fd_close>:
+{
+  8018cb:	55                   	push   %ebp
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	57                   	push   %edi
+  8018cf:	56                   	push   %esi
+  8018d0:	53                   	push   %ebx
+  8018d1:	83 ec 24             	sub    $0x24,%esp
+  8018d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018d7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018da:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018dd:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018de:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018e4:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018e7:	50                   	push   %eax
+  8018e8:	e8 1b ff ff ff       	call   801808 <fd_lookup>
+  8018ed:	89 c3                	mov    %eax,%ebx
+  8018ef:	83 c4 10             	add    $0x10,%esp
+  8018f2:	85 c0                	test   %eax,%eax
+  8018f4:	78 05                	js     8018fb <fd_close+0x30>
+	    || fd != fd2)
+  8018f6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018f9:	74 16                	je     801911 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8018fb:	89 f8                	mov    %edi,%eax
+  8018fd:	84 c0                	test   %al,%al
+  8018ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801904:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801907:	89 d8                	mov    %ebx,%eax
+  801909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190c:	5b                   	pop    %ebx
+  80190d:	5e                   	pop    %esi
+  80190e:	5f                   	pop    %edi
+  80190f:	5d                   	pop    %ebp
+  801910:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801911:	83 ec 08             	sub    $0x8,%esp
+  801914:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801917:	50                   	push   %eax
+  801918:	ff 36                	push   (%esi)
+  80191a:	e8 39 ff ff ff       	call   801858 <dev_lookup>
+  80191f:	89 c3                	mov    %eax,%ebx
+  801921:	83 c4 10             	add    $0x10,%esp
+  801924:	85 c0                	test   %eax,%eax
+  801926:	78 1a                	js     801942 <fd_close+0x77>
+		if (dev->dev_close)
+  801928:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80192b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80192e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801933:	85 c0                	test   %eax,%eax
+  801935:	74 0b                	je     801942 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801937:	83 ec 0c             	sub    $0xc,%esp
+  80193a:	56                   	push   %esi
+  80193b:	ff d0                	call   *%eax
+  80193d:	89 c3                	mov    %eax,%ebx
+  80193f:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801942:	83 ec 08             	sub    $0x8,%esp
+  801945:	56                   	push   %esi
+  801946:	6a 00                	push   $0x0
+  801948:	e8 a3 f4 ff ff       	call   800df0 <sys_page_unmap>
+	return r;
+  80194d:	83 c4 10             	add    $0x10,%esp
+  801950:	eb b5                	jmp    801907 <fd_close+0x3c>
+
+00801952 <close>:
+
+int
+close(int fdnum)
+{
+  801952:	55                   	push   %ebp
+  801953:	89 e5                	mov    %esp,%ebp
+  801955:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801958:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80195b:	50                   	push   %eax
+  80195c:	ff 75 08             	push   0x8(%ebp)
+  80195f:	e8 a4 fe ff ff       	call   801808 <fd_lookup>
+  801964:	83 c4 10             	add    $0x10,%esp
+  801967:	85 c0                	test   %eax,%eax
+  801969:	79 02                	jns    80196d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80196b:	c9                   	leave
+  80196c:	c3                   	ret
+		return fd_close(fd, 1);
+  80196d:	83 ec 08             	sub    $0x8,%esp
+  801970:	6a 01                	push   $0x1
+  801972:	ff 75 f4             	push   -0xc(%ebp)
+  801975:	e8 51 ff ff ff       	call   8018cb <fd_close>
+  80197a:	83 c4 10             	add    $0x10,%esp
+  80197d:	eb ec                	jmp    80196b <close+0x19>
+
+0080197f <close_all>:
+
+void
+close_all(void)
+{
+  80197f:	55                   	push   %ebp
+  801980:	89 e5                	mov    %esp,%ebp
+  801982:	53                   	push   %ebx
+  801983:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801986:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80198b:	83 ec 0c             	sub    $0xc,%esp
+  80198e:	53                   	push   %ebx
+  80198f:	e8 be ff ff ff       	call   801952 <close>
+	for (i = 0; i < MAXFD; i++)
+  801994:	83 c3 01             	add    $0x1,%ebx
+  801997:	83 c4 10             	add    $0x10,%esp
+  80199a:	83 fb 20             	cmp    $0x20,%ebx
+  80199d:	75 ec                	jne    80198b <close_all+0xc>
+}
+  80199f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a2:	c9                   	leave
+  8019a3:	c3                   	ret
+
+008019a4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+  8019a7:	57                   	push   %edi
+  8019a8:	56                   	push   %esi
+  8019a9:	53                   	push   %ebx
+  8019aa:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019b0:	50                   	push   %eax
+  8019b1:	ff 75 08             	push   0x8(%ebp)
+  8019b4:	e8 4f fe ff ff       	call   801808 <fd_lookup>
+  8019b9:	89 c3                	mov    %eax,%ebx
+  8019bb:	83 c4 10             	add    $0x10,%esp
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	78 7f                	js     801a41 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8019c2:	83 ec 0c             	sub    $0xc,%esp
+  8019c5:	ff 75 0c             	push   0xc(%ebp)
+  8019c8:	e8 85 ff ff ff       	call   801952 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8019cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019d0:	c1 e6 0c             	shl    $0xc,%esi
+  8019d3:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8019d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8019dc:	89 3c 24             	mov    %edi,(%esp)
+  8019df:	e8 b7 fd ff ff       	call   80179b <fd2data>
+  8019e4:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8019e6:	89 34 24             	mov    %esi,(%esp)
+  8019e9:	e8 ad fd ff ff       	call   80179b <fd2data>
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8019f4:	89 d8                	mov    %ebx,%eax
+  8019f6:	c1 e8 16             	shr    $0x16,%eax
+  8019f9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a00:	a8 01                	test   $0x1,%al
+  801a02:	74 11                	je     801a15 <dup+0x71>
+  801a04:	89 d8                	mov    %ebx,%eax
+  801a06:	c1 e8 0c             	shr    $0xc,%eax
+  801a09:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a10:	f6 c2 01             	test   $0x1,%dl
+  801a13:	75 36                	jne    801a4b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a15:	89 f8                	mov    %edi,%eax
+  801a17:	c1 e8 0c             	shr    $0xc,%eax
+  801a1a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a21:	83 ec 0c             	sub    $0xc,%esp
+  801a24:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a29:	50                   	push   %eax
+  801a2a:	56                   	push   %esi
+  801a2b:	6a 00                	push   $0x0
+  801a2d:	57                   	push   %edi
+  801a2e:	6a 00                	push   $0x0
+  801a30:	e8 4d f3 ff ff       	call   800d82 <sys_page_map>
+  801a35:	89 c3                	mov    %eax,%ebx
+  801a37:	83 c4 20             	add    $0x20,%esp
+  801a3a:	85 c0                	test   %eax,%eax
+  801a3c:	78 33                	js     801a71 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a3e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a41:	89 d8                	mov    %ebx,%eax
+  801a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a46:	5b                   	pop    %ebx
+  801a47:	5e                   	pop    %esi
+  801a48:	5f                   	pop    %edi
+  801a49:	5d                   	pop    %ebp
+  801a4a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a4b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a52:	83 ec 0c             	sub    $0xc,%esp
+  801a55:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a5a:	50                   	push   %eax
+  801a5b:	ff 75 d4             	push   -0x2c(%ebp)
+  801a5e:	6a 00                	push   $0x0
+  801a60:	53                   	push   %ebx
+  801a61:	6a 00                	push   $0x0
+  801a63:	e8 1a f3 ff ff       	call   800d82 <sys_page_map>
+  801a68:	89 c3                	mov    %eax,%ebx
+  801a6a:	83 c4 20             	add    $0x20,%esp
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	79 a4                	jns    801a15 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801a71:	83 ec 08             	sub    $0x8,%esp
+  801a74:	56                   	push   %esi
+  801a75:	6a 00                	push   $0x0
+  801a77:	e8 74 f3 ff ff       	call   800df0 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801a7c:	83 c4 08             	add    $0x8,%esp
+  801a7f:	ff 75 d4             	push   -0x2c(%ebp)
+  801a82:	6a 00                	push   $0x0
+  801a84:	e8 67 f3 ff ff       	call   800df0 <sys_page_unmap>
+	return r;
+  801a89:	83 c4 10             	add    $0x10,%esp
+  801a8c:	eb b3                	jmp    801a41 <dup+0x9d>
+
+00801a8e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a8e:	55                   	push   %ebp
+  801a8f:	89 e5                	mov    %esp,%ebp
+  801a91:	56                   	push   %esi
+  801a92:	53                   	push   %ebx
+  801a93:	83 ec 18             	sub    $0x18,%esp
+  801a96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a99:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a9c:	50                   	push   %eax
+  801a9d:	53                   	push   %ebx
+  801a9e:	e8 65 fd ff ff       	call   801808 <fd_lookup>
+  801aa3:	83 c4 10             	add    $0x10,%esp
+  801aa6:	85 c0                	test   %eax,%eax
+  801aa8:	78 3c                	js     801ae6 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aaa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aad:	83 ec 08             	sub    $0x8,%esp
+  801ab0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab3:	50                   	push   %eax
+  801ab4:	ff 36                	push   (%esi)
+  801ab6:	e8 9d fd ff ff       	call   801858 <dev_lookup>
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	85 c0                	test   %eax,%eax
+  801ac0:	78 24                	js     801ae6 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ac2:	8b 46 08             	mov    0x8(%esi),%eax
+  801ac5:	83 e0 03             	and    $0x3,%eax
+  801ac8:	83 f8 01             	cmp    $0x1,%eax
+  801acb:	74 20                	je     801aed <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801acd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ad0:	8b 40 08             	mov    0x8(%eax),%eax
+  801ad3:	85 c0                	test   %eax,%eax
+  801ad5:	74 57                	je     801b2e <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ad7:	83 ec 04             	sub    $0x4,%esp
+  801ada:	ff 75 10             	push   0x10(%ebp)
+  801add:	ff 75 0c             	push   0xc(%ebp)
+  801ae0:	56                   	push   %esi
+  801ae1:	ff d0                	call   *%eax
+  801ae3:	83 c4 10             	add    $0x10,%esp
+}
+  801ae6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae9:	5b                   	pop    %ebx
+  801aea:	5e                   	pop    %esi
+  801aeb:	5d                   	pop    %ebp
+  801aec:	c3                   	ret
+  801aed:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801aef:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801af4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801afa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801aff:	76 1c                	jbe    801b1d <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b01:	8b 42 48             	mov    0x48(%edx),%eax
+  801b04:	83 ec 04             	sub    $0x4,%esp
+  801b07:	53                   	push   %ebx
+  801b08:	50                   	push   %eax
+  801b09:	68 19 2f 80 00       	push   $0x802f19
+  801b0e:	e8 c2 e6 ff ff       	call   8001d5 <cprintf>
+		return -E_INVAL;
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b1b:	eb c9                	jmp    801ae6 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b1d:	c1 e8 10             	shr    $0x10,%eax
+  801b20:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b26:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b2c:	eb d3                	jmp    801b01 <read+0x73>
+		return -E_NOT_SUPP;
+  801b2e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b33:	eb b1                	jmp    801ae6 <read+0x58>
+
+00801b35 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b35:	55                   	push   %ebp
+  801b36:	89 e5                	mov    %esp,%ebp
+  801b38:	57                   	push   %edi
+  801b39:	56                   	push   %esi
+  801b3a:	53                   	push   %ebx
+  801b3b:	83 ec 0c             	sub    $0xc,%esp
+  801b3e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b41:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b49:	eb 02                	jmp    801b4d <readn+0x18>
+  801b4b:	01 c3                	add    %eax,%ebx
+  801b4d:	39 f3                	cmp    %esi,%ebx
+  801b4f:	73 21                	jae    801b72 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b51:	83 ec 04             	sub    $0x4,%esp
+  801b54:	89 f0                	mov    %esi,%eax
+  801b56:	29 d8                	sub    %ebx,%eax
+  801b58:	50                   	push   %eax
+  801b59:	89 d8                	mov    %ebx,%eax
+  801b5b:	03 45 0c             	add    0xc(%ebp),%eax
+  801b5e:	50                   	push   %eax
+  801b5f:	57                   	push   %edi
+  801b60:	e8 29 ff ff ff       	call   801a8e <read>
+		if (m < 0)
+  801b65:	83 c4 10             	add    $0x10,%esp
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	78 04                	js     801b70 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801b6c:	75 dd                	jne    801b4b <readn+0x16>
+  801b6e:	eb 02                	jmp    801b72 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801b70:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801b72:	89 d8                	mov    %ebx,%eax
+  801b74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b77:	5b                   	pop    %ebx
+  801b78:	5e                   	pop    %esi
+  801b79:	5f                   	pop    %edi
+  801b7a:	5d                   	pop    %ebp
+  801b7b:	c3                   	ret
+
+00801b7c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	56                   	push   %esi
+  801b80:	53                   	push   %ebx
+  801b81:	83 ec 18             	sub    $0x18,%esp
+  801b84:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b87:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b8a:	50                   	push   %eax
+  801b8b:	53                   	push   %ebx
+  801b8c:	e8 77 fc ff ff       	call   801808 <fd_lookup>
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	85 c0                	test   %eax,%eax
+  801b96:	78 37                	js     801bcf <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b98:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b9b:	83 ec 08             	sub    $0x8,%esp
+  801b9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba1:	50                   	push   %eax
+  801ba2:	ff 36                	push   (%esi)
+  801ba4:	e8 af fc ff ff       	call   801858 <dev_lookup>
+  801ba9:	83 c4 10             	add    $0x10,%esp
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	78 1f                	js     801bcf <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bb0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bb4:	74 20                	je     801bd6 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801bb6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bb9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	74 57                	je     801c17 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801bc0:	83 ec 04             	sub    $0x4,%esp
+  801bc3:	ff 75 10             	push   0x10(%ebp)
+  801bc6:	ff 75 0c             	push   0xc(%ebp)
+  801bc9:	56                   	push   %esi
+  801bca:	ff d0                	call   *%eax
+  801bcc:	83 c4 10             	add    $0x10,%esp
+}
+  801bcf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd2:	5b                   	pop    %ebx
+  801bd3:	5e                   	pop    %esi
+  801bd4:	5d                   	pop    %ebp
+  801bd5:	c3                   	ret
+  801bd6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bd8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bdd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801be3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801be8:	76 1c                	jbe    801c06 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bea:	8b 42 48             	mov    0x48(%edx),%eax
+  801bed:	83 ec 04             	sub    $0x4,%esp
+  801bf0:	53                   	push   %ebx
+  801bf1:	50                   	push   %eax
+  801bf2:	68 35 2f 80 00       	push   $0x802f35
+  801bf7:	e8 d9 e5 ff ff       	call   8001d5 <cprintf>
+		return -E_INVAL;
+  801bfc:	83 c4 10             	add    $0x10,%esp
+  801bff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c04:	eb c9                	jmp    801bcf <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c06:	c1 e8 10             	shr    $0x10,%eax
+  801c09:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c0f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c15:	eb d3                	jmp    801bea <write+0x6e>
+		return -E_NOT_SUPP;
+  801c17:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c1c:	eb b1                	jmp    801bcf <write+0x53>
+
+00801c1e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+  801c21:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c27:	50                   	push   %eax
+  801c28:	ff 75 08             	push   0x8(%ebp)
+  801c2b:	e8 d8 fb ff ff       	call   801808 <fd_lookup>
+  801c30:	83 c4 10             	add    $0x10,%esp
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	78 0e                	js     801c45 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c37:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c3d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c45:	c9                   	leave
+  801c46:	c3                   	ret
+
+00801c47 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c47:	55                   	push   %ebp
+  801c48:	89 e5                	mov    %esp,%ebp
+  801c4a:	56                   	push   %esi
+  801c4b:	53                   	push   %ebx
+  801c4c:	83 ec 18             	sub    $0x18,%esp
+  801c4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c52:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c55:	50                   	push   %eax
+  801c56:	53                   	push   %ebx
+  801c57:	e8 ac fb ff ff       	call   801808 <fd_lookup>
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 34                	js     801c97 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c63:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c66:	83 ec 08             	sub    $0x8,%esp
+  801c69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6c:	50                   	push   %eax
+  801c6d:	ff 36                	push   (%esi)
+  801c6f:	e8 e4 fb ff ff       	call   801858 <dev_lookup>
+  801c74:	83 c4 10             	add    $0x10,%esp
+  801c77:	85 c0                	test   %eax,%eax
+  801c79:	78 1c                	js     801c97 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c7b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c7f:	74 1d                	je     801c9e <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801c81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c84:	8b 40 18             	mov    0x18(%eax),%eax
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	74 54                	je     801cdf <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+  801c8e:	ff 75 0c             	push   0xc(%ebp)
+  801c91:	56                   	push   %esi
+  801c92:	ff d0                	call   *%eax
+  801c94:	83 c4 10             	add    $0x10,%esp
+}
+  801c97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c9a:	5b                   	pop    %ebx
+  801c9b:	5e                   	pop    %esi
+  801c9c:	5d                   	pop    %ebp
+  801c9d:	c3                   	ret
+  801c9e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ca0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ca5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cab:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cb0:	76 1c                	jbe    801cce <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801cb2:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cb5:	83 ec 04             	sub    $0x4,%esp
+  801cb8:	53                   	push   %ebx
+  801cb9:	50                   	push   %eax
+  801cba:	68 f8 2e 80 00       	push   $0x802ef8
+  801cbf:	e8 11 e5 ff ff       	call   8001d5 <cprintf>
+		return -E_INVAL;
+  801cc4:	83 c4 10             	add    $0x10,%esp
+  801cc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ccc:	eb c9                	jmp    801c97 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cce:	c1 e8 10             	shr    $0x10,%eax
+  801cd1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cd7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cdd:	eb d3                	jmp    801cb2 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801cdf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce4:	eb b1                	jmp    801c97 <ftruncate+0x50>
+
+00801ce6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	56                   	push   %esi
+  801cea:	53                   	push   %ebx
+  801ceb:	83 ec 18             	sub    $0x18,%esp
+  801cee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cf1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cf4:	50                   	push   %eax
+  801cf5:	ff 75 08             	push   0x8(%ebp)
+  801cf8:	e8 0b fb ff ff       	call   801808 <fd_lookup>
+  801cfd:	83 c4 10             	add    $0x10,%esp
+  801d00:	85 c0                	test   %eax,%eax
+  801d02:	78 49                	js     801d4d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d04:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d07:	83 ec 08             	sub    $0x8,%esp
+  801d0a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d0d:	50                   	push   %eax
+  801d0e:	ff 36                	push   (%esi)
+  801d10:	e8 43 fb ff ff       	call   801858 <dev_lookup>
+  801d15:	83 c4 10             	add    $0x10,%esp
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	78 31                	js     801d4d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d23:	74 2f                	je     801d54 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d25:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d28:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d2f:	00 00 00 
+	stat->st_isdir = 0;
+  801d32:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d39:	00 00 00 
+	stat->st_dev = dev;
+  801d3c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d42:	83 ec 08             	sub    $0x8,%esp
+  801d45:	53                   	push   %ebx
+  801d46:	56                   	push   %esi
+  801d47:	ff 50 14             	call   *0x14(%eax)
+  801d4a:	83 c4 10             	add    $0x10,%esp
+}
+  801d4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d50:	5b                   	pop    %ebx
+  801d51:	5e                   	pop    %esi
+  801d52:	5d                   	pop    %ebp
+  801d53:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d54:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d59:	eb f2                	jmp    801d4d <fstat+0x67>
+
+00801d5b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d5b:	55                   	push   %ebp
+  801d5c:	89 e5                	mov    %esp,%ebp
+  801d5e:	56                   	push   %esi
+  801d5f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801d60:	83 ec 08             	sub    $0x8,%esp
+  801d63:	6a 00                	push   $0x0
+  801d65:	ff 75 08             	push   0x8(%ebp)
+  801d68:	e8 e4 01 00 00       	call   801f51 <open>
+  801d6d:	89 c3                	mov    %eax,%ebx
+  801d6f:	83 c4 10             	add    $0x10,%esp
+  801d72:	85 c0                	test   %eax,%eax
+  801d74:	78 1b                	js     801d91 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801d76:	83 ec 08             	sub    $0x8,%esp
+  801d79:	ff 75 0c             	push   0xc(%ebp)
+  801d7c:	50                   	push   %eax
+  801d7d:	e8 64 ff ff ff       	call   801ce6 <fstat>
+  801d82:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801d84:	89 1c 24             	mov    %ebx,(%esp)
+  801d87:	e8 c6 fb ff ff       	call   801952 <close>
+	return r;
+  801d8c:	83 c4 10             	add    $0x10,%esp
+  801d8f:	89 f3                	mov    %esi,%ebx
+}
+  801d91:	89 d8                	mov    %ebx,%eax
+  801d93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d96:	5b                   	pop    %ebx
+  801d97:	5e                   	pop    %esi
+  801d98:	5d                   	pop    %ebp
+  801d99:	c3                   	ret
+
+00801d9a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d9a:	55                   	push   %ebp
+  801d9b:	89 e5                	mov    %esp,%ebp
+  801d9d:	56                   	push   %esi
+  801d9e:	53                   	push   %ebx
+  801d9f:	89 c6                	mov    %eax,%esi
+  801da1:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801da3:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801daa:	74 27                	je     801dd3 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dac:	6a 07                	push   $0x7
+  801dae:	68 00 60 80 00       	push   $0x806000
+  801db3:	56                   	push   %esi
+  801db4:	ff 35 00 50 80 00    	push   0x805000
+  801dba:	e8 b2 0c 00 00       	call   802a71 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801dbf:	83 c4 0c             	add    $0xc,%esp
+  801dc2:	6a 00                	push   $0x0
+  801dc4:	53                   	push   %ebx
+  801dc5:	6a 00                	push   $0x0
+  801dc7:	e8 8d 0c 00 00       	call   802a59 <ipc_recv>
+}
+  801dcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dcf:	5b                   	pop    %ebx
+  801dd0:	5e                   	pop    %esi
+  801dd1:	5d                   	pop    %ebp
+  801dd2:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dd3:	83 ec 0c             	sub    $0xc,%esp
+  801dd6:	6a 01                	push   $0x1
+  801dd8:	e8 e8 0c 00 00       	call   802ac5 <ipc_find_env>
+  801ddd:	a3 00 50 80 00       	mov    %eax,0x805000
+  801de2:	83 c4 10             	add    $0x10,%esp
+  801de5:	eb c5                	jmp    801dac <fsipc+0x12>
+
+00801de7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801de7:	55                   	push   %ebp
+  801de8:	89 e5                	mov    %esp,%ebp
+  801dea:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ded:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801df3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801df8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dfb:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e00:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e05:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e0a:	e8 8b ff ff ff       	call   801d9a <fsipc>
+}
+  801e0f:	c9                   	leave
+  801e10:	c3                   	ret
+
+00801e11 <devfile_flush>:
+{
+  801e11:	55                   	push   %ebp
+  801e12:	89 e5                	mov    %esp,%ebp
+  801e14:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e17:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e1d:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e22:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e27:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e2c:	e8 69 ff ff ff       	call   801d9a <fsipc>
+}
+  801e31:	c9                   	leave
+  801e32:	c3                   	ret
+
+00801e33 <devfile_stat>:
+{
+  801e33:	55                   	push   %ebp
+  801e34:	89 e5                	mov    %esp,%ebp
+  801e36:	53                   	push   %ebx
+  801e37:	83 ec 04             	sub    $0x4,%esp
+  801e3a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e40:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e43:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e52:	e8 43 ff ff ff       	call   801d9a <fsipc>
+  801e57:	85 c0                	test   %eax,%eax
+  801e59:	78 2c                	js     801e87 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e5b:	83 ec 08             	sub    $0x8,%esp
+  801e5e:	68 00 60 80 00       	push   $0x806000
+  801e63:	53                   	push   %ebx
+  801e64:	e8 b4 e9 ff ff       	call   80081d <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801e69:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e6e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e74:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e79:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801e7f:	83 c4 10             	add    $0x10,%esp
+  801e82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e8a:	c9                   	leave
+  801e8b:	c3                   	ret
+
+00801e8c <devfile_write>:
+{
+  801e8c:	55                   	push   %ebp
+  801e8d:	89 e5                	mov    %esp,%ebp
+  801e8f:	83 ec 0c             	sub    $0xc,%esp
+  801e92:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e95:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e98:	8b 52 0c             	mov    0xc(%edx),%edx
+  801e9b:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801ea1:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801ea6:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801eab:	39 d0                	cmp    %edx,%eax
+  801ead:	0f 47 c2             	cmova  %edx,%eax
+  801eb0:	50                   	push   %eax
+  801eb1:	ff 75 0c             	push   0xc(%ebp)
+  801eb4:	68 08 60 80 00       	push   $0x806008
+  801eb9:	e8 e5 ea ff ff       	call   8009a3 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec3:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ec8:	e8 cd fe ff ff       	call   801d9a <fsipc>
+}
+  801ecd:	c9                   	leave
+  801ece:	c3                   	ret
+
+00801ecf <devfile_read>:
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	56                   	push   %esi
+  801ed3:	53                   	push   %ebx
+  801ed4:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eda:	8b 40 0c             	mov    0xc(%eax),%eax
+  801edd:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ee2:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ee8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eed:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ef2:	e8 a3 fe ff ff       	call   801d9a <fsipc>
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 1f                	js     801f1c <devfile_read+0x4d>
+	assert(r <= n);
+  801efd:	39 c6                	cmp    %eax,%esi
+  801eff:	72 24                	jb     801f25 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f01:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f06:	7f 33                	jg     801f3b <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f08:	83 ec 04             	sub    $0x4,%esp
+  801f0b:	50                   	push   %eax
+  801f0c:	68 00 60 80 00       	push   $0x806000
+  801f11:	ff 75 0c             	push   0xc(%ebp)
+  801f14:	e8 8a ea ff ff       	call   8009a3 <memmove>
+	return r;
+  801f19:	83 c4 10             	add    $0x10,%esp
+}
+  801f1c:	89 d8                	mov    %ebx,%eax
+  801f1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f21:	5b                   	pop    %ebx
+  801f22:	5e                   	pop    %esi
+  801f23:	5d                   	pop    %ebp
+  801f24:	c3                   	ret
+	assert(r <= n);
+  801f25:	68 68 2f 80 00       	push   $0x802f68
+  801f2a:	68 6f 2f 80 00       	push   $0x802f6f
+  801f2f:	6a 76                	push   $0x76
+  801f31:	68 84 2f 80 00       	push   $0x802f84
+  801f36:	e8 bf e1 ff ff       	call   8000fa <_panic>
+	assert(r <= PGSIZE);
+  801f3b:	68 8f 2f 80 00       	push   $0x802f8f
+  801f40:	68 6f 2f 80 00       	push   $0x802f6f
+  801f45:	6a 77                	push   $0x77
+  801f47:	68 84 2f 80 00       	push   $0x802f84
+  801f4c:	e8 a9 e1 ff ff       	call   8000fa <_panic>
+
+00801f51 <open>:
+{
+  801f51:	55                   	push   %ebp
+  801f52:	89 e5                	mov    %esp,%ebp
+  801f54:	56                   	push   %esi
+  801f55:	53                   	push   %ebx
+  801f56:	83 ec 1c             	sub    $0x1c,%esp
+  801f59:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801f5c:	56                   	push   %esi
+  801f5d:	e8 80 e8 ff ff       	call   8007e2 <strlen>
+  801f62:	83 c4 10             	add    $0x10,%esp
+  801f65:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f6a:	7f 6c                	jg     801fd8 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801f6c:	83 ec 0c             	sub    $0xc,%esp
+  801f6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f72:	50                   	push   %eax
+  801f73:	e8 3a f8 ff ff       	call   8017b2 <fd_alloc>
+  801f78:	89 c3                	mov    %eax,%ebx
+  801f7a:	83 c4 10             	add    $0x10,%esp
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	78 3c                	js     801fbd <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801f81:	83 ec 08             	sub    $0x8,%esp
+  801f84:	56                   	push   %esi
+  801f85:	68 00 60 80 00       	push   $0x806000
+  801f8a:	e8 8e e8 ff ff       	call   80081d <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801f8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f92:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f97:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9f:	e8 f6 fd ff ff       	call   801d9a <fsipc>
+  801fa4:	89 c3                	mov    %eax,%ebx
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	78 19                	js     801fc6 <open+0x75>
+	return fd2num(fd);
+  801fad:	83 ec 0c             	sub    $0xc,%esp
+  801fb0:	ff 75 f4             	push   -0xc(%ebp)
+  801fb3:	e8 d3 f7 ff ff       	call   80178b <fd2num>
+  801fb8:	89 c3                	mov    %eax,%ebx
+  801fba:	83 c4 10             	add    $0x10,%esp
+}
+  801fbd:	89 d8                	mov    %ebx,%eax
+  801fbf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc2:	5b                   	pop    %ebx
+  801fc3:	5e                   	pop    %esi
+  801fc4:	5d                   	pop    %ebp
+  801fc5:	c3                   	ret
+		fd_close(fd, 0);
+  801fc6:	83 ec 08             	sub    $0x8,%esp
+  801fc9:	6a 00                	push   $0x0
+  801fcb:	ff 75 f4             	push   -0xc(%ebp)
+  801fce:	e8 f8 f8 ff ff       	call   8018cb <fd_close>
+		return r;
+  801fd3:	83 c4 10             	add    $0x10,%esp
+  801fd6:	eb e5                	jmp    801fbd <open+0x6c>
+		return -E_BAD_PATH;
+  801fd8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fdd:	eb de                	jmp    801fbd <open+0x6c>
+
+00801fdf <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801fdf:	55                   	push   %ebp
+  801fe0:	89 e5                	mov    %esp,%ebp
+  801fe2:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fea:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fef:	e8 a6 fd ff ff       	call   801d9a <fsipc>
+}
+  801ff4:	c9                   	leave
+  801ff5:	c3                   	ret
+
+00801ff6 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ff6:	55                   	push   %ebp
+  801ff7:	89 e5                	mov    %esp,%ebp
+  801ff9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801ffc:	68 9b 2f 80 00       	push   $0x802f9b
+  802001:	ff 75 0c             	push   0xc(%ebp)
+  802004:	e8 14 e8 ff ff       	call   80081d <strcpy>
+	return 0;
+}
+  802009:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200e:	c9                   	leave
+  80200f:	c3                   	ret
+
+00802010 <devsock_close>:
+{
+  802010:	55                   	push   %ebp
+  802011:	89 e5                	mov    %esp,%ebp
+  802013:	53                   	push   %ebx
+  802014:	83 ec 10             	sub    $0x10,%esp
+  802017:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80201a:	53                   	push   %ebx
+  80201b:	e8 e4 0a 00 00       	call   802b04 <pageref>
+  802020:	89 c2                	mov    %eax,%edx
+  802022:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802025:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80202a:	83 fa 01             	cmp    $0x1,%edx
+  80202d:	74 05                	je     802034 <devsock_close+0x24>
+}
+  80202f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802032:	c9                   	leave
+  802033:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802034:	83 ec 0c             	sub    $0xc,%esp
+  802037:	ff 73 0c             	push   0xc(%ebx)
+  80203a:	e8 b7 02 00 00       	call   8022f6 <nsipc_close>
+  80203f:	83 c4 10             	add    $0x10,%esp
+  802042:	eb eb                	jmp    80202f <devsock_close+0x1f>
+
+00802044 <devsock_write>:
+{
+  802044:	55                   	push   %ebp
+  802045:	89 e5                	mov    %esp,%ebp
+  802047:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80204a:	6a 00                	push   $0x0
+  80204c:	ff 75 10             	push   0x10(%ebp)
+  80204f:	ff 75 0c             	push   0xc(%ebp)
+  802052:	8b 45 08             	mov    0x8(%ebp),%eax
+  802055:	ff 70 0c             	push   0xc(%eax)
+  802058:	e8 79 03 00 00       	call   8023d6 <nsipc_send>
+}
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+
+0080205f <devsock_read>:
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802065:	6a 00                	push   $0x0
+  802067:	ff 75 10             	push   0x10(%ebp)
+  80206a:	ff 75 0c             	push   0xc(%ebp)
+  80206d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802070:	ff 70 0c             	push   0xc(%eax)
+  802073:	e8 ef 02 00 00       	call   802367 <nsipc_recv>
+}
+  802078:	c9                   	leave
+  802079:	c3                   	ret
+
+0080207a <fd2sockid>:
+{
+  80207a:	55                   	push   %ebp
+  80207b:	89 e5                	mov    %esp,%ebp
+  80207d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802080:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802083:	52                   	push   %edx
+  802084:	50                   	push   %eax
+  802085:	e8 7e f7 ff ff       	call   801808 <fd_lookup>
+  80208a:	83 c4 10             	add    $0x10,%esp
+  80208d:	85 c0                	test   %eax,%eax
+  80208f:	78 10                	js     8020a1 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802091:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802094:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80209a:	39 08                	cmp    %ecx,(%eax)
+  80209c:	75 05                	jne    8020a3 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80209e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8020a1:	c9                   	leave
+  8020a2:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020a8:	eb f7                	jmp    8020a1 <fd2sockid+0x27>
+
+008020aa <alloc_sockfd>:
+{
+  8020aa:	55                   	push   %ebp
+  8020ab:	89 e5                	mov    %esp,%ebp
+  8020ad:	56                   	push   %esi
+  8020ae:	53                   	push   %ebx
+  8020af:	83 ec 1c             	sub    $0x1c,%esp
+  8020b2:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8020b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020b7:	50                   	push   %eax
+  8020b8:	e8 f5 f6 ff ff       	call   8017b2 <fd_alloc>
+  8020bd:	89 c3                	mov    %eax,%ebx
+  8020bf:	83 c4 10             	add    $0x10,%esp
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	78 43                	js     802109 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020c6:	83 ec 04             	sub    $0x4,%esp
+  8020c9:	68 07 04 00 00       	push   $0x407
+  8020ce:	ff 75 f4             	push   -0xc(%ebp)
+  8020d1:	6a 00                	push   $0x0
+  8020d3:	e8 3d ec ff ff       	call   800d15 <sys_page_alloc>
+  8020d8:	89 c3                	mov    %eax,%ebx
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	78 28                	js     802109 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e4:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8020ea:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8020ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ef:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8020f6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8020f9:	83 ec 0c             	sub    $0xc,%esp
+  8020fc:	50                   	push   %eax
+  8020fd:	e8 89 f6 ff ff       	call   80178b <fd2num>
+  802102:	89 c3                	mov    %eax,%ebx
+  802104:	83 c4 10             	add    $0x10,%esp
+  802107:	eb 0c                	jmp    802115 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802109:	83 ec 0c             	sub    $0xc,%esp
+  80210c:	56                   	push   %esi
+  80210d:	e8 e4 01 00 00       	call   8022f6 <nsipc_close>
+		return r;
+  802112:	83 c4 10             	add    $0x10,%esp
+}
+  802115:	89 d8                	mov    %ebx,%eax
+  802117:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211a:	5b                   	pop    %ebx
+  80211b:	5e                   	pop    %esi
+  80211c:	5d                   	pop    %ebp
+  80211d:	c3                   	ret
+
+0080211e <accept>:
+{
+  80211e:	55                   	push   %ebp
+  80211f:	89 e5                	mov    %esp,%ebp
+  802121:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802124:	8b 45 08             	mov    0x8(%ebp),%eax
+  802127:	e8 4e ff ff ff       	call   80207a <fd2sockid>
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	78 1b                	js     80214b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802130:	83 ec 04             	sub    $0x4,%esp
+  802133:	ff 75 10             	push   0x10(%ebp)
+  802136:	ff 75 0c             	push   0xc(%ebp)
+  802139:	50                   	push   %eax
+  80213a:	e8 0e 01 00 00       	call   80224d <nsipc_accept>
+  80213f:	83 c4 10             	add    $0x10,%esp
+  802142:	85 c0                	test   %eax,%eax
+  802144:	78 05                	js     80214b <accept+0x2d>
+	return alloc_sockfd(r);
+  802146:	e8 5f ff ff ff       	call   8020aa <alloc_sockfd>
+}
+  80214b:	c9                   	leave
+  80214c:	c3                   	ret
+
+0080214d <bind>:
+{
+  80214d:	55                   	push   %ebp
+  80214e:	89 e5                	mov    %esp,%ebp
+  802150:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802153:	8b 45 08             	mov    0x8(%ebp),%eax
+  802156:	e8 1f ff ff ff       	call   80207a <fd2sockid>
+  80215b:	85 c0                	test   %eax,%eax
+  80215d:	78 12                	js     802171 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80215f:	83 ec 04             	sub    $0x4,%esp
+  802162:	ff 75 10             	push   0x10(%ebp)
+  802165:	ff 75 0c             	push   0xc(%ebp)
+  802168:	50                   	push   %eax
+  802169:	e8 31 01 00 00       	call   80229f <nsipc_bind>
+  80216e:	83 c4 10             	add    $0x10,%esp
+}
+  802171:	c9                   	leave
+  802172:	c3                   	ret
+
+00802173 <shutdown>:
+{
+  802173:	55                   	push   %ebp
+  802174:	89 e5                	mov    %esp,%ebp
+  802176:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802179:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217c:	e8 f9 fe ff ff       	call   80207a <fd2sockid>
+  802181:	85 c0                	test   %eax,%eax
+  802183:	78 0f                	js     802194 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802185:	83 ec 08             	sub    $0x8,%esp
+  802188:	ff 75 0c             	push   0xc(%ebp)
+  80218b:	50                   	push   %eax
+  80218c:	e8 43 01 00 00       	call   8022d4 <nsipc_shutdown>
+  802191:	83 c4 10             	add    $0x10,%esp
+}
+  802194:	c9                   	leave
+  802195:	c3                   	ret
+
+00802196 <connect>:
+{
+  802196:	55                   	push   %ebp
+  802197:	89 e5                	mov    %esp,%ebp
+  802199:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80219c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219f:	e8 d6 fe ff ff       	call   80207a <fd2sockid>
+  8021a4:	85 c0                	test   %eax,%eax
+  8021a6:	78 12                	js     8021ba <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8021a8:	83 ec 04             	sub    $0x4,%esp
+  8021ab:	ff 75 10             	push   0x10(%ebp)
+  8021ae:	ff 75 0c             	push   0xc(%ebp)
+  8021b1:	50                   	push   %eax
+  8021b2:	e8 59 01 00 00       	call   802310 <nsipc_connect>
+  8021b7:	83 c4 10             	add    $0x10,%esp
+}
+  8021ba:	c9                   	leave
+  8021bb:	c3                   	ret
+
+008021bc <listen>:
+{
+  8021bc:	55                   	push   %ebp
+  8021bd:	89 e5                	mov    %esp,%ebp
+  8021bf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c5:	e8 b0 fe ff ff       	call   80207a <fd2sockid>
+  8021ca:	85 c0                	test   %eax,%eax
+  8021cc:	78 0f                	js     8021dd <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021ce:	83 ec 08             	sub    $0x8,%esp
+  8021d1:	ff 75 0c             	push   0xc(%ebp)
+  8021d4:	50                   	push   %eax
+  8021d5:	e8 6b 01 00 00       	call   802345 <nsipc_listen>
+  8021da:	83 c4 10             	add    $0x10,%esp
+}
+  8021dd:	c9                   	leave
+  8021de:	c3                   	ret
+
+008021df <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8021df:	55                   	push   %ebp
+  8021e0:	89 e5                	mov    %esp,%ebp
+  8021e2:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8021e5:	ff 75 10             	push   0x10(%ebp)
+  8021e8:	ff 75 0c             	push   0xc(%ebp)
+  8021eb:	ff 75 08             	push   0x8(%ebp)
+  8021ee:	e8 41 02 00 00       	call   802434 <nsipc_socket>
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	85 c0                	test   %eax,%eax
+  8021f8:	78 05                	js     8021ff <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8021fa:	e8 ab fe ff ff       	call   8020aa <alloc_sockfd>
+}
+  8021ff:	c9                   	leave
+  802200:	c3                   	ret
+
+00802201 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802201:	55                   	push   %ebp
+  802202:	89 e5                	mov    %esp,%ebp
+  802204:	53                   	push   %ebx
+  802205:	83 ec 04             	sub    $0x4,%esp
+  802208:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80220a:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802211:	74 26                	je     802239 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802213:	6a 07                	push   $0x7
+  802215:	68 00 70 80 00       	push   $0x807000
+  80221a:	53                   	push   %ebx
+  80221b:	ff 35 04 50 80 00    	push   0x805004
+  802221:	e8 4b 08 00 00       	call   802a71 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802226:	83 c4 0c             	add    $0xc,%esp
+  802229:	6a 00                	push   $0x0
+  80222b:	6a 00                	push   $0x0
+  80222d:	6a 00                	push   $0x0
+  80222f:	e8 25 08 00 00       	call   802a59 <ipc_recv>
+}
+  802234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802237:	c9                   	leave
+  802238:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802239:	83 ec 0c             	sub    $0xc,%esp
+  80223c:	6a 02                	push   $0x2
+  80223e:	e8 82 08 00 00       	call   802ac5 <ipc_find_env>
+  802243:	a3 04 50 80 00       	mov    %eax,0x805004
+  802248:	83 c4 10             	add    $0x10,%esp
+  80224b:	eb c6                	jmp    802213 <nsipc+0x12>
+
+0080224d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80224d:	55                   	push   %ebp
+  80224e:	89 e5                	mov    %esp,%ebp
+  802250:	56                   	push   %esi
+  802251:	53                   	push   %ebx
+  802252:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802255:	8b 45 08             	mov    0x8(%ebp),%eax
+  802258:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80225d:	8b 06                	mov    (%esi),%eax
+  80225f:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802264:	b8 01 00 00 00       	mov    $0x1,%eax
+  802269:	e8 93 ff ff ff       	call   802201 <nsipc>
+  80226e:	89 c3                	mov    %eax,%ebx
+  802270:	85 c0                	test   %eax,%eax
+  802272:	79 09                	jns    80227d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802274:	89 d8                	mov    %ebx,%eax
+  802276:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802279:	5b                   	pop    %ebx
+  80227a:	5e                   	pop    %esi
+  80227b:	5d                   	pop    %ebp
+  80227c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80227d:	83 ec 04             	sub    $0x4,%esp
+  802280:	ff 35 10 70 80 00    	push   0x807010
+  802286:	68 00 70 80 00       	push   $0x807000
+  80228b:	ff 75 0c             	push   0xc(%ebp)
+  80228e:	e8 10 e7 ff ff       	call   8009a3 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802293:	a1 10 70 80 00       	mov    0x807010,%eax
+  802298:	89 06                	mov    %eax,(%esi)
+  80229a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80229d:	eb d5                	jmp    802274 <nsipc_accept+0x27>
+
+0080229f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80229f:	55                   	push   %ebp
+  8022a0:	89 e5                	mov    %esp,%ebp
+  8022a2:	53                   	push   %ebx
+  8022a3:	83 ec 08             	sub    $0x8,%esp
+  8022a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8022a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ac:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8022b1:	53                   	push   %ebx
+  8022b2:	ff 75 0c             	push   0xc(%ebp)
+  8022b5:	68 04 70 80 00       	push   $0x807004
+  8022ba:	e8 e4 e6 ff ff       	call   8009a3 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8022bf:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8022c5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022ca:	e8 32 ff ff ff       	call   802201 <nsipc>
+}
+  8022cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d2:	c9                   	leave
+  8022d3:	c3                   	ret
+
+008022d4 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8022da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022dd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8022e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022e5:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8022ea:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022ef:	e8 0d ff ff ff       	call   802201 <nsipc>
+}
+  8022f4:	c9                   	leave
+  8022f5:	c3                   	ret
+
+008022f6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8022f6:	55                   	push   %ebp
+  8022f7:	89 e5                	mov    %esp,%ebp
+  8022f9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8022fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ff:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802304:	b8 04 00 00 00       	mov    $0x4,%eax
+  802309:	e8 f3 fe ff ff       	call   802201 <nsipc>
+}
+  80230e:	c9                   	leave
+  80230f:	c3                   	ret
+
+00802310 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802310:	55                   	push   %ebp
+  802311:	89 e5                	mov    %esp,%ebp
+  802313:	53                   	push   %ebx
+  802314:	83 ec 08             	sub    $0x8,%esp
+  802317:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80231a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231d:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802322:	53                   	push   %ebx
+  802323:	ff 75 0c             	push   0xc(%ebp)
+  802326:	68 04 70 80 00       	push   $0x807004
+  80232b:	e8 73 e6 ff ff       	call   8009a3 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802330:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802336:	b8 05 00 00 00       	mov    $0x5,%eax
+  80233b:	e8 c1 fe ff ff       	call   802201 <nsipc>
+}
+  802340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802343:	c9                   	leave
+  802344:	c3                   	ret
+
+00802345 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802345:	55                   	push   %ebp
+  802346:	89 e5                	mov    %esp,%ebp
+  802348:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80234b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802353:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802356:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80235b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802360:	e8 9c fe ff ff       	call   802201 <nsipc>
+}
+  802365:	c9                   	leave
+  802366:	c3                   	ret
+
+00802367 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802367:	55                   	push   %ebp
+  802368:	89 e5                	mov    %esp,%ebp
+  80236a:	56                   	push   %esi
+  80236b:	53                   	push   %ebx
+  80236c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80236f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802372:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802377:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80237d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802380:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802385:	b8 07 00 00 00       	mov    $0x7,%eax
+  80238a:	e8 72 fe ff ff       	call   802201 <nsipc>
+  80238f:	89 c3                	mov    %eax,%ebx
+  802391:	85 c0                	test   %eax,%eax
+  802393:	78 22                	js     8023b7 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802395:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80239a:	39 c6                	cmp    %eax,%esi
+  80239c:	0f 4e c6             	cmovle %esi,%eax
+  80239f:	39 c3                	cmp    %eax,%ebx
+  8023a1:	7f 1d                	jg     8023c0 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8023a3:	83 ec 04             	sub    $0x4,%esp
+  8023a6:	53                   	push   %ebx
+  8023a7:	68 00 70 80 00       	push   $0x807000
+  8023ac:	ff 75 0c             	push   0xc(%ebp)
+  8023af:	e8 ef e5 ff ff       	call   8009a3 <memmove>
+  8023b4:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8023b7:	89 d8                	mov    %ebx,%eax
+  8023b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023bc:	5b                   	pop    %ebx
+  8023bd:	5e                   	pop    %esi
+  8023be:	5d                   	pop    %ebp
+  8023bf:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8023c0:	68 a7 2f 80 00       	push   $0x802fa7
+  8023c5:	68 6f 2f 80 00       	push   $0x802f6f
+  8023ca:	6a 62                	push   $0x62
+  8023cc:	68 bc 2f 80 00       	push   $0x802fbc
+  8023d1:	e8 24 dd ff ff       	call   8000fa <_panic>
+
+008023d6 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8023d6:	55                   	push   %ebp
+  8023d7:	89 e5                	mov    %esp,%ebp
+  8023d9:	53                   	push   %ebx
+  8023da:	83 ec 04             	sub    $0x4,%esp
+  8023dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8023e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e3:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8023e8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8023ee:	7f 2e                	jg     80241e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8023f0:	83 ec 04             	sub    $0x4,%esp
+  8023f3:	53                   	push   %ebx
+  8023f4:	ff 75 0c             	push   0xc(%ebp)
+  8023f7:	68 0c 70 80 00       	push   $0x80700c
+  8023fc:	e8 a2 e5 ff ff       	call   8009a3 <memmove>
+	nsipcbuf.send.req_size = size;
+  802401:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802407:	8b 45 14             	mov    0x14(%ebp),%eax
+  80240a:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  80240f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802414:	e8 e8 fd ff ff       	call   802201 <nsipc>
+}
+  802419:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80241c:	c9                   	leave
+  80241d:	c3                   	ret
+	assert(size < 1600);
+  80241e:	68 c8 2f 80 00       	push   $0x802fc8
+  802423:	68 6f 2f 80 00       	push   $0x802f6f
+  802428:	6a 6d                	push   $0x6d
+  80242a:	68 bc 2f 80 00       	push   $0x802fbc
+  80242f:	e8 c6 dc ff ff       	call   8000fa <_panic>
+
+00802434 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802434:	55                   	push   %ebp
+  802435:	89 e5                	mov    %esp,%ebp
+  802437:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80243a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80243d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802442:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802445:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80244a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80244d:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802452:	b8 09 00 00 00       	mov    $0x9,%eax
+  802457:	e8 a5 fd ff ff       	call   802201 <nsipc>
+}
+  80245c:	c9                   	leave
+  80245d:	c3                   	ret
+
+0080245e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80245e:	55                   	push   %ebp
+  80245f:	89 e5                	mov    %esp,%ebp
+  802461:	56                   	push   %esi
+  802462:	53                   	push   %ebx
+  802463:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802466:	83 ec 0c             	sub    $0xc,%esp
+  802469:	ff 75 08             	push   0x8(%ebp)
+  80246c:	e8 2a f3 ff ff       	call   80179b <fd2data>
+  802471:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802473:	83 c4 08             	add    $0x8,%esp
+  802476:	68 d4 2f 80 00       	push   $0x802fd4
+  80247b:	53                   	push   %ebx
+  80247c:	e8 9c e3 ff ff       	call   80081d <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802481:	8b 46 04             	mov    0x4(%esi),%eax
+  802484:	2b 06                	sub    (%esi),%eax
+  802486:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80248c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802493:	00 00 00 
+	stat->st_dev = &devpipe;
+  802496:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80249d:	40 80 00 
+	return 0;
+}
+  8024a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024a8:	5b                   	pop    %ebx
+  8024a9:	5e                   	pop    %esi
+  8024aa:	5d                   	pop    %ebp
+  8024ab:	c3                   	ret
+
+008024ac <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024ac:	55                   	push   %ebp
+  8024ad:	89 e5                	mov    %esp,%ebp
+  8024af:	53                   	push   %ebx
+  8024b0:	83 ec 0c             	sub    $0xc,%esp
+  8024b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8024b6:	53                   	push   %ebx
+  8024b7:	6a 00                	push   $0x0
+  8024b9:	e8 32 e9 ff ff       	call   800df0 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8024be:	89 1c 24             	mov    %ebx,(%esp)
+  8024c1:	e8 d5 f2 ff ff       	call   80179b <fd2data>
+  8024c6:	83 c4 08             	add    $0x8,%esp
+  8024c9:	50                   	push   %eax
+  8024ca:	6a 00                	push   $0x0
+  8024cc:	e8 1f e9 ff ff       	call   800df0 <sys_page_unmap>
+}
+  8024d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024d4:	c9                   	leave
+  8024d5:	c3                   	ret
+
+008024d6 <_pipeisclosed>:
+{
+  8024d6:	55                   	push   %ebp
+  8024d7:	89 e5                	mov    %esp,%ebp
+  8024d9:	57                   	push   %edi
+  8024da:	56                   	push   %esi
+  8024db:	53                   	push   %ebx
+  8024dc:	83 ec 1c             	sub    $0x1c,%esp
+  8024df:	89 c7                	mov    %eax,%edi
+  8024e1:	89 d6                	mov    %edx,%esi
+  8024e3:	eb 3c                	jmp    802521 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8024e5:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8024e8:	83 ec 0c             	sub    $0xc,%esp
+  8024eb:	57                   	push   %edi
+  8024ec:	e8 13 06 00 00       	call   802b04 <pageref>
+  8024f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024f4:	89 34 24             	mov    %esi,(%esp)
+  8024f7:	e8 08 06 00 00       	call   802b04 <pageref>
+  8024fc:	89 c2                	mov    %eax,%edx
+  8024fe:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802500:	05 00 00 00 20       	add    $0x20000000,%eax
+  802505:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802508:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80250e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802513:	76 31                	jbe    802546 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802515:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802518:	39 c3                	cmp    %eax,%ebx
+  80251a:	74 76                	je     802592 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80251c:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80251f:	74 36                	je     802557 <_pipeisclosed+0x81>
+  802521:	89 e0                	mov    %esp,%eax
+  802523:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802528:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80252e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802533:	77 b0                	ja     8024e5 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802535:	c1 e8 10             	shr    $0x10,%eax
+  802538:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80253e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802544:	eb 9f                	jmp    8024e5 <_pipeisclosed+0xf>
+  802546:	c1 e8 10             	shr    $0x10,%eax
+  802549:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80254f:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802555:	eb be                	jmp    802515 <_pipeisclosed+0x3f>
+  802557:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802559:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80255e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802564:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802569:	76 16                	jbe    802581 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80256b:	8b 42 58             	mov    0x58(%edx),%eax
+  80256e:	6a 01                	push   $0x1
+  802570:	50                   	push   %eax
+  802571:	53                   	push   %ebx
+  802572:	68 db 2f 80 00       	push   $0x802fdb
+  802577:	e8 59 dc ff ff       	call   8001d5 <cprintf>
+  80257c:	83 c4 10             	add    $0x10,%esp
+  80257f:	eb a0                	jmp    802521 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802581:	c1 e8 10             	shr    $0x10,%eax
+  802584:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80258a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802590:	eb d9                	jmp    80256b <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802592:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802595:	0f 94 c0             	sete   %al
+  802598:	0f b6 c0             	movzbl %al,%eax
+}
+  80259b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80259e:	5b                   	pop    %ebx
+  80259f:	5e                   	pop    %esi
+  8025a0:	5f                   	pop    %edi
+  8025a1:	5d                   	pop    %ebp
+  8025a2:	c3                   	ret
+
+008025a3 <devpipe_write>:
+{
+  8025a3:	55                   	push   %ebp
+  8025a4:	89 e5                	mov    %esp,%ebp
+  8025a6:	57                   	push   %edi
+  8025a7:	56                   	push   %esi
+  8025a8:	53                   	push   %ebx
+  8025a9:	83 ec 28             	sub    $0x28,%esp
+  8025ac:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8025af:	56                   	push   %esi
+  8025b0:	e8 e6 f1 ff ff       	call   80179b <fd2data>
+  8025b5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8025b7:	83 c4 10             	add    $0x10,%esp
+  8025ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025bf:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025c2:	75 09                	jne    8025cd <devpipe_write+0x2a>
+	return i;
+  8025c4:	89 f8                	mov    %edi,%eax
+  8025c6:	eb 23                	jmp    8025eb <devpipe_write+0x48>
+			sys_yield();
+  8025c8:	e8 02 e7 ff ff       	call   800ccf <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025cd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025d0:	8b 0b                	mov    (%ebx),%ecx
+  8025d2:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025d5:	39 d0                	cmp    %edx,%eax
+  8025d7:	72 1a                	jb     8025f3 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8025d9:	89 da                	mov    %ebx,%edx
+  8025db:	89 f0                	mov    %esi,%eax
+  8025dd:	e8 f4 fe ff ff       	call   8024d6 <_pipeisclosed>
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	74 e2                	je     8025c8 <devpipe_write+0x25>
+				return 0;
+  8025e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ee:	5b                   	pop    %ebx
+  8025ef:	5e                   	pop    %esi
+  8025f0:	5f                   	pop    %edi
+  8025f1:	5d                   	pop    %ebp
+  8025f2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025f6:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025fa:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8025fd:	89 c2                	mov    %eax,%edx
+  8025ff:	c1 fa 1f             	sar    $0x1f,%edx
+  802602:	89 d1                	mov    %edx,%ecx
+  802604:	c1 e9 1b             	shr    $0x1b,%ecx
+  802607:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80260a:	83 e2 1f             	and    $0x1f,%edx
+  80260d:	29 ca                	sub    %ecx,%edx
+  80260f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802613:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802617:	83 c0 01             	add    $0x1,%eax
+  80261a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80261d:	83 c7 01             	add    $0x1,%edi
+  802620:	eb 9d                	jmp    8025bf <devpipe_write+0x1c>
+
+00802622 <devpipe_read>:
+{
+  802622:	55                   	push   %ebp
+  802623:	89 e5                	mov    %esp,%ebp
+  802625:	57                   	push   %edi
+  802626:	56                   	push   %esi
+  802627:	53                   	push   %ebx
+  802628:	83 ec 18             	sub    $0x18,%esp
+  80262b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80262e:	57                   	push   %edi
+  80262f:	e8 67 f1 ff ff       	call   80179b <fd2data>
+  802634:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802636:	83 c4 10             	add    $0x10,%esp
+  802639:	be 00 00 00 00       	mov    $0x0,%esi
+  80263e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802641:	75 13                	jne    802656 <devpipe_read+0x34>
+	return i;
+  802643:	89 f0                	mov    %esi,%eax
+  802645:	eb 02                	jmp    802649 <devpipe_read+0x27>
+				return i;
+  802647:	89 f0                	mov    %esi,%eax
+}
+  802649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264c:	5b                   	pop    %ebx
+  80264d:	5e                   	pop    %esi
+  80264e:	5f                   	pop    %edi
+  80264f:	5d                   	pop    %ebp
+  802650:	c3                   	ret
+			sys_yield();
+  802651:	e8 79 e6 ff ff       	call   800ccf <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802656:	8b 03                	mov    (%ebx),%eax
+  802658:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80265b:	75 18                	jne    802675 <devpipe_read+0x53>
+			if (i > 0)
+  80265d:	85 f6                	test   %esi,%esi
+  80265f:	75 e6                	jne    802647 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802661:	89 da                	mov    %ebx,%edx
+  802663:	89 f8                	mov    %edi,%eax
+  802665:	e8 6c fe ff ff       	call   8024d6 <_pipeisclosed>
+  80266a:	85 c0                	test   %eax,%eax
+  80266c:	74 e3                	je     802651 <devpipe_read+0x2f>
+				return 0;
+  80266e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802673:	eb d4                	jmp    802649 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802675:	99                   	cltd
+  802676:	c1 ea 1b             	shr    $0x1b,%edx
+  802679:	01 d0                	add    %edx,%eax
+  80267b:	83 e0 1f             	and    $0x1f,%eax
+  80267e:	29 d0                	sub    %edx,%eax
+  802680:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802685:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802688:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80268b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80268e:	83 c6 01             	add    $0x1,%esi
+  802691:	eb ab                	jmp    80263e <devpipe_read+0x1c>
+
+00802693 <pipe>:
+{
+  802693:	55                   	push   %ebp
+  802694:	89 e5                	mov    %esp,%ebp
+  802696:	56                   	push   %esi
+  802697:	53                   	push   %ebx
+  802698:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80269b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80269e:	50                   	push   %eax
+  80269f:	e8 0e f1 ff ff       	call   8017b2 <fd_alloc>
+  8026a4:	89 c3                	mov    %eax,%ebx
+  8026a6:	83 c4 10             	add    $0x10,%esp
+  8026a9:	85 c0                	test   %eax,%eax
+  8026ab:	0f 88 23 01 00 00    	js     8027d4 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026b1:	83 ec 04             	sub    $0x4,%esp
+  8026b4:	68 07 04 00 00       	push   $0x407
+  8026b9:	ff 75 f4             	push   -0xc(%ebp)
+  8026bc:	6a 00                	push   $0x0
+  8026be:	e8 52 e6 ff ff       	call   800d15 <sys_page_alloc>
+  8026c3:	89 c3                	mov    %eax,%ebx
+  8026c5:	83 c4 10             	add    $0x10,%esp
+  8026c8:	85 c0                	test   %eax,%eax
+  8026ca:	0f 88 04 01 00 00    	js     8027d4 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8026d0:	83 ec 0c             	sub    $0xc,%esp
+  8026d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026d6:	50                   	push   %eax
+  8026d7:	e8 d6 f0 ff ff       	call   8017b2 <fd_alloc>
+  8026dc:	89 c3                	mov    %eax,%ebx
+  8026de:	83 c4 10             	add    $0x10,%esp
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	0f 88 db 00 00 00    	js     8027c4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026e9:	83 ec 04             	sub    $0x4,%esp
+  8026ec:	68 07 04 00 00       	push   $0x407
+  8026f1:	ff 75 f0             	push   -0x10(%ebp)
+  8026f4:	6a 00                	push   $0x0
+  8026f6:	e8 1a e6 ff ff       	call   800d15 <sys_page_alloc>
+  8026fb:	89 c3                	mov    %eax,%ebx
+  8026fd:	83 c4 10             	add    $0x10,%esp
+  802700:	85 c0                	test   %eax,%eax
+  802702:	0f 88 bc 00 00 00    	js     8027c4 <pipe+0x131>
+	va = fd2data(fd0);
+  802708:	83 ec 0c             	sub    $0xc,%esp
+  80270b:	ff 75 f4             	push   -0xc(%ebp)
+  80270e:	e8 88 f0 ff ff       	call   80179b <fd2data>
+  802713:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802715:	83 c4 0c             	add    $0xc,%esp
+  802718:	68 07 04 00 00       	push   $0x407
+  80271d:	50                   	push   %eax
+  80271e:	6a 00                	push   $0x0
+  802720:	e8 f0 e5 ff ff       	call   800d15 <sys_page_alloc>
+  802725:	89 c3                	mov    %eax,%ebx
+  802727:	83 c4 10             	add    $0x10,%esp
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	0f 88 82 00 00 00    	js     8027b4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802732:	83 ec 0c             	sub    $0xc,%esp
+  802735:	ff 75 f0             	push   -0x10(%ebp)
+  802738:	e8 5e f0 ff ff       	call   80179b <fd2data>
+  80273d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802744:	50                   	push   %eax
+  802745:	6a 00                	push   $0x0
+  802747:	56                   	push   %esi
+  802748:	6a 00                	push   $0x0
+  80274a:	e8 33 e6 ff ff       	call   800d82 <sys_page_map>
+  80274f:	89 c3                	mov    %eax,%ebx
+  802751:	83 c4 20             	add    $0x20,%esp
+  802754:	85 c0                	test   %eax,%eax
+  802756:	78 4e                	js     8027a6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802758:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80275d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802760:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802762:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802765:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80276c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80276f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802771:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802774:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80277b:	83 ec 0c             	sub    $0xc,%esp
+  80277e:	ff 75 f4             	push   -0xc(%ebp)
+  802781:	e8 05 f0 ff ff       	call   80178b <fd2num>
+  802786:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802789:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80278b:	83 c4 04             	add    $0x4,%esp
+  80278e:	ff 75 f0             	push   -0x10(%ebp)
+  802791:	e8 f5 ef ff ff       	call   80178b <fd2num>
+  802796:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802799:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80279c:	83 c4 10             	add    $0x10,%esp
+  80279f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027a4:	eb 2e                	jmp    8027d4 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8027a6:	83 ec 08             	sub    $0x8,%esp
+  8027a9:	56                   	push   %esi
+  8027aa:	6a 00                	push   $0x0
+  8027ac:	e8 3f e6 ff ff       	call   800df0 <sys_page_unmap>
+  8027b1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8027b4:	83 ec 08             	sub    $0x8,%esp
+  8027b7:	ff 75 f0             	push   -0x10(%ebp)
+  8027ba:	6a 00                	push   $0x0
+  8027bc:	e8 2f e6 ff ff       	call   800df0 <sys_page_unmap>
+  8027c1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8027c4:	83 ec 08             	sub    $0x8,%esp
+  8027c7:	ff 75 f4             	push   -0xc(%ebp)
+  8027ca:	6a 00                	push   $0x0
+  8027cc:	e8 1f e6 ff ff       	call   800df0 <sys_page_unmap>
+  8027d1:	83 c4 10             	add    $0x10,%esp
+}
+  8027d4:	89 d8                	mov    %ebx,%eax
+  8027d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027d9:	5b                   	pop    %ebx
+  8027da:	5e                   	pop    %esi
+  8027db:	5d                   	pop    %ebp
+  8027dc:	c3                   	ret
+
+008027dd <pipeisclosed>:
+{
+  8027dd:	55                   	push   %ebp
+  8027de:	89 e5                	mov    %esp,%ebp
+  8027e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027e6:	50                   	push   %eax
+  8027e7:	ff 75 08             	push   0x8(%ebp)
+  8027ea:	e8 19 f0 ff ff       	call   801808 <fd_lookup>
+  8027ef:	83 c4 10             	add    $0x10,%esp
+  8027f2:	85 c0                	test   %eax,%eax
+  8027f4:	78 18                	js     80280e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8027f6:	83 ec 0c             	sub    $0xc,%esp
+  8027f9:	ff 75 f4             	push   -0xc(%ebp)
+  8027fc:	e8 9a ef ff ff       	call   80179b <fd2data>
+  802801:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802803:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802806:	e8 cb fc ff ff       	call   8024d6 <_pipeisclosed>
+  80280b:	83 c4 10             	add    $0x10,%esp
+}
+  80280e:	c9                   	leave
+  80280f:	c3                   	ret
+
+00802810 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802810:	b8 00 00 00 00       	mov    $0x0,%eax
+  802815:	c3                   	ret
+
+00802816 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80281c:	68 f3 2f 80 00       	push   $0x802ff3
+  802821:	ff 75 0c             	push   0xc(%ebp)
+  802824:	e8 f4 df ff ff       	call   80081d <strcpy>
+	return 0;
+}
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282e:	c9                   	leave
+  80282f:	c3                   	ret
+
+00802830 <devcons_write>:
+{
+  802830:	55                   	push   %ebp
+  802831:	89 e5                	mov    %esp,%ebp
+  802833:	57                   	push   %edi
+  802834:	56                   	push   %esi
+  802835:	53                   	push   %ebx
+  802836:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80283c:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802841:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802847:	eb 2e                	jmp    802877 <devcons_write+0x47>
+		m = n - tot;
+  802849:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80284c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80284e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802853:	39 c3                	cmp    %eax,%ebx
+  802855:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802858:	83 ec 04             	sub    $0x4,%esp
+  80285b:	53                   	push   %ebx
+  80285c:	89 f0                	mov    %esi,%eax
+  80285e:	03 45 0c             	add    0xc(%ebp),%eax
+  802861:	50                   	push   %eax
+  802862:	57                   	push   %edi
+  802863:	e8 3b e1 ff ff       	call   8009a3 <memmove>
+		sys_cputs(buf, m);
+  802868:	83 c4 08             	add    $0x8,%esp
+  80286b:	53                   	push   %ebx
+  80286c:	57                   	push   %edi
+  80286d:	e8 24 e3 ff ff       	call   800b96 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802872:	01 de                	add    %ebx,%esi
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80287a:	72 cd                	jb     802849 <devcons_write+0x19>
+}
+  80287c:	89 f0                	mov    %esi,%eax
+  80287e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802881:	5b                   	pop    %ebx
+  802882:	5e                   	pop    %esi
+  802883:	5f                   	pop    %edi
+  802884:	5d                   	pop    %ebp
+  802885:	c3                   	ret
+
+00802886 <devcons_read>:
+{
+  802886:	55                   	push   %ebp
+  802887:	89 e5                	mov    %esp,%ebp
+  802889:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80288c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802891:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802895:	75 07                	jne    80289e <devcons_read+0x18>
+  802897:	eb 1f                	jmp    8028b8 <devcons_read+0x32>
+		sys_yield();
+  802899:	e8 31 e4 ff ff       	call   800ccf <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80289e:	e8 37 e3 ff ff       	call   800bda <sys_cgetc>
+  8028a3:	85 c0                	test   %eax,%eax
+  8028a5:	74 f2                	je     802899 <devcons_read+0x13>
+	if (c < 0)
+  8028a7:	78 0f                	js     8028b8 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8028a9:	83 f8 04             	cmp    $0x4,%eax
+  8028ac:	74 0c                	je     8028ba <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8028ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028b1:	88 02                	mov    %al,(%edx)
+	return 1;
+  8028b3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+		return 0;
+  8028ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bf:	eb f7                	jmp    8028b8 <devcons_read+0x32>
+
+008028c1 <cputchar>:
+{
+  8028c1:	55                   	push   %ebp
+  8028c2:	89 e5                	mov    %esp,%ebp
+  8028c4:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8028c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ca:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8028cd:	6a 01                	push   $0x1
+  8028cf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028d2:	50                   	push   %eax
+  8028d3:	e8 be e2 ff ff       	call   800b96 <sys_cputs>
+}
+  8028d8:	83 c4 10             	add    $0x10,%esp
+  8028db:	c9                   	leave
+  8028dc:	c3                   	ret
+
+008028dd <getchar>:
+{
+  8028dd:	55                   	push   %ebp
+  8028de:	89 e5                	mov    %esp,%ebp
+  8028e0:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8028e3:	6a 01                	push   $0x1
+  8028e5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8028e8:	50                   	push   %eax
+  8028e9:	6a 00                	push   $0x0
+  8028eb:	e8 9e f1 ff ff       	call   801a8e <read>
+	if (r < 0)
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	78 06                	js     8028fd <getchar+0x20>
+	if (r < 1)
+  8028f7:	74 06                	je     8028ff <getchar+0x22>
+	return c;
+  8028f9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8028fd:	c9                   	leave
+  8028fe:	c3                   	ret
+		return -E_EOF;
+  8028ff:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802904:	eb f7                	jmp    8028fd <getchar+0x20>
+
+00802906 <iscons>:
+{
+  802906:	55                   	push   %ebp
+  802907:	89 e5                	mov    %esp,%ebp
+  802909:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80290c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80290f:	50                   	push   %eax
+  802910:	ff 75 08             	push   0x8(%ebp)
+  802913:	e8 f0 ee ff ff       	call   801808 <fd_lookup>
+  802918:	83 c4 10             	add    $0x10,%esp
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	78 11                	js     802930 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80291f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802922:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802928:	39 10                	cmp    %edx,(%eax)
+  80292a:	0f 94 c0             	sete   %al
+  80292d:	0f b6 c0             	movzbl %al,%eax
+}
+  802930:	c9                   	leave
+  802931:	c3                   	ret
+
+00802932 <opencons>:
+{
+  802932:	55                   	push   %ebp
+  802933:	89 e5                	mov    %esp,%ebp
+  802935:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802938:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80293b:	50                   	push   %eax
+  80293c:	e8 71 ee ff ff       	call   8017b2 <fd_alloc>
+  802941:	83 c4 10             	add    $0x10,%esp
+  802944:	85 c0                	test   %eax,%eax
+  802946:	78 3a                	js     802982 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802948:	83 ec 04             	sub    $0x4,%esp
+  80294b:	68 07 04 00 00       	push   $0x407
+  802950:	ff 75 f4             	push   -0xc(%ebp)
+  802953:	6a 00                	push   $0x0
+  802955:	e8 bb e3 ff ff       	call   800d15 <sys_page_alloc>
+  80295a:	83 c4 10             	add    $0x10,%esp
+  80295d:	85 c0                	test   %eax,%eax
+  80295f:	78 21                	js     802982 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802961:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802964:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80296a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80296c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80296f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802976:	83 ec 0c             	sub    $0xc,%esp
+  802979:	50                   	push   %eax
+  80297a:	e8 0c ee ff ff       	call   80178b <fd2num>
+  80297f:	83 c4 10             	add    $0x10,%esp
+}
+  802982:	c9                   	leave
+  802983:	c3                   	ret
+
+00802984 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802984:	55                   	push   %ebp
+  802985:	89 e5                	mov    %esp,%ebp
+  802987:	56                   	push   %esi
+  802988:	53                   	push   %ebx
+  802989:	8b 75 08             	mov    0x8(%ebp),%esi
+  80298c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80298f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802992:	85 c0                	test   %eax,%eax
+  802994:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802999:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  80299c:	83 ec 08             	sub    $0x8,%esp
+  80299f:	ff 75 14             	push   0x14(%ebp)
+  8029a2:	50                   	push   %eax
+  8029a3:	e8 7e e7 ff ff       	call   801126 <sys_ipc_recv_until>
+  8029a8:	83 c4 10             	add    $0x10,%esp
+  8029ab:	85 c0                	test   %eax,%eax
+  8029ad:	78 61                	js     802a10 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8029af:	85 f6                	test   %esi,%esi
+  8029b1:	74 1c                	je     8029cf <ipc_recv_until+0x4b>
+  8029b3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029b5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029ba:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029c0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029c5:	76 5f                	jbe    802a26 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8029c7:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8029cd:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8029cf:	85 db                	test   %ebx,%ebx
+  8029d1:	74 1c                	je     8029ef <ipc_recv_until+0x6b>
+  8029d3:	89 e0                	mov    %esp,%eax
+  8029d5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029da:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029e0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8029e5:	76 50                	jbe    802a37 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8029e7:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8029ed:	89 03                	mov    %eax,(%ebx)
+  8029ef:	89 e0                	mov    %esp,%eax
+  8029f1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8029f6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8029fc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a01:	76 45                	jbe    802a48 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802a03:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802a09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a0c:	5b                   	pop    %ebx
+  802a0d:	5e                   	pop    %esi
+  802a0e:	5d                   	pop    %ebp
+  802a0f:	c3                   	ret
+		if (from_env_store)
+  802a10:	85 f6                	test   %esi,%esi
+  802a12:	74 06                	je     802a1a <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802a14:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802a1a:	85 db                	test   %ebx,%ebx
+  802a1c:	74 eb                	je     802a09 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802a1e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a24:	eb e3                	jmp    802a09 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802a26:	c1 e8 10             	shr    $0x10,%eax
+  802a29:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a2f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a35:	eb 90                	jmp    8029c7 <ipc_recv_until+0x43>
+  802a37:	c1 e8 10             	shr    $0x10,%eax
+  802a3a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a40:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a46:	eb 9f                	jmp    8029e7 <ipc_recv_until+0x63>
+  802a48:	c1 e8 10             	shr    $0x10,%eax
+  802a4b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802a51:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802a57:	eb aa                	jmp    802a03 <ipc_recv_until+0x7f>
+
+00802a59 <ipc_recv>:
+{
+  802a59:	55                   	push   %ebp
+  802a5a:	89 e5                	mov    %esp,%ebp
+  802a5c:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802a5f:	6a 00                	push   $0x0
+  802a61:	ff 75 10             	push   0x10(%ebp)
+  802a64:	ff 75 0c             	push   0xc(%ebp)
+  802a67:	ff 75 08             	push   0x8(%ebp)
+  802a6a:	e8 15 ff ff ff       	call   802984 <ipc_recv_until>
+}
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+
+00802a71 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802a71:	55                   	push   %ebp
+  802a72:	89 e5                	mov    %esp,%ebp
+  802a74:	57                   	push   %edi
+  802a75:	56                   	push   %esi
+  802a76:	53                   	push   %ebx
+  802a77:	83 ec 0c             	sub    $0xc,%esp
+  802a7a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a7d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a80:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a83:	85 db                	test   %ebx,%ebx
+  802a85:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a8a:	0f 44 d8             	cmove  %eax,%ebx
+  802a8d:	eb 05                	jmp    802a94 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802a8f:	e8 3b e2 ff ff       	call   800ccf <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802a94:	ff 75 14             	push   0x14(%ebp)
+  802a97:	53                   	push   %ebx
+  802a98:	56                   	push   %esi
+  802a99:	57                   	push   %edi
+  802a9a:	e8 d3 e5 ff ff       	call   801072 <sys_ipc_try_send>
+  802a9f:	83 c4 10             	add    $0x10,%esp
+  802aa2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802aa5:	74 e8                	je     802a8f <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802aa7:	85 c0                	test   %eax,%eax
+  802aa9:	78 08                	js     802ab3 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802aab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aae:	5b                   	pop    %ebx
+  802aaf:	5e                   	pop    %esi
+  802ab0:	5f                   	pop    %edi
+  802ab1:	5d                   	pop    %ebp
+  802ab2:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802ab3:	50                   	push   %eax
+  802ab4:	68 ff 2f 80 00       	push   $0x802fff
+  802ab9:	6a 4f                	push   $0x4f
+  802abb:	68 12 30 80 00       	push   $0x803012
+  802ac0:	e8 35 d6 ff ff       	call   8000fa <_panic>
+
+00802ac5 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802acb:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ad0:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802ad6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802adc:	8b 52 50             	mov    0x50(%edx),%edx
+  802adf:	39 ca                	cmp    %ecx,%edx
+  802ae1:	74 11                	je     802af4 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802ae3:	83 c0 01             	add    $0x1,%eax
+  802ae6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802aeb:	75 e3                	jne    802ad0 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af2:	eb 0e                	jmp    802b02 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802af4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802afa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802aff:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802b02:	5d                   	pop    %ebp
+  802b03:	c3                   	ret
+
+00802b04 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802b04:	55                   	push   %ebp
+  802b05:	89 e5                	mov    %esp,%ebp
+  802b07:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b0a:	89 c2                	mov    %eax,%edx
+  802b0c:	c1 ea 16             	shr    $0x16,%edx
+  802b0f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802b16:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802b1b:	f6 c1 01             	test   $0x1,%cl
+  802b1e:	74 1a                	je     802b3a <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802b20:	c1 e8 0c             	shr    $0xc,%eax
+  802b23:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802b2a:	a8 01                	test   $0x1,%al
+  802b2c:	74 0c                	je     802b3a <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802b2e:	c1 e8 0c             	shr    $0xc,%eax
+  802b31:	c1 e0 04             	shl    $0x4,%eax
+  802b34:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802b3a:	89 d0                	mov    %edx,%eax
+  802b3c:	5d                   	pop    %ebp
+  802b3d:	c3                   	ret
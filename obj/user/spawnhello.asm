@@ -0,0 +1,7181 @@
+
+obj/user/spawnhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 6d 00 00 00       	call   80009e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800039:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80003b:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  800040:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800046:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80004b:	76 2e                	jbe    80007b <umain+0x48>
+	int r;
+	cprintf("i am parent environment %08x\n", thisenv->env_id);
+  80004d:	8b 42 48             	mov    0x48(%edx),%eax
+  800050:	83 ec 08             	sub    $0x8,%esp
+  800053:	50                   	push   %eax
+  800054:	68 20 35 80 00       	push   $0x803520
+  800059:	e8 df 01 00 00       	call   80023d <cprintf>
+	if ((r = spawnl("hello", "hello", 0)) < 0)
+  80005e:	83 c4 0c             	add    $0xc,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 3e 35 80 00       	push   $0x80353e
+  800068:	68 3e 35 80 00       	push   $0x80353e
+  80006d:	e8 c2 26 00 00       	call   802734 <spawnl>
+  800072:	83 c4 10             	add    $0x10,%esp
+  800075:	85 c0                	test   %eax,%eax
+  800077:	78 13                	js     80008c <umain+0x59>
+		panic("spawn(hello) failed: %e", r);
+}
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80007b:	c1 e8 10             	shr    $0x10,%eax
+  80007e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800084:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80008a:	eb c1                	jmp    80004d <umain+0x1a>
+		panic("spawn(hello) failed: %e", r);
+  80008c:	50                   	push   %eax
+  80008d:	68 44 35 80 00       	push   $0x803544
+  800092:	6a 09                	push   $0x9
+  800094:	68 5c 35 80 00       	push   $0x80355c
+  800099:	e8 c4 00 00 00       	call   800162 <_panic>
+
+0080009e <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80009e:	55                   	push   %ebp
+  80009f:	89 e5                	mov    %esp,%ebp
+  8000a1:	57                   	push   %edi
+  8000a2:	56                   	push   %esi
+  8000a3:	53                   	push   %ebx
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000aa:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000b2:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000b4:	c1 ea 0b             	shr    $0xb,%edx
+  8000b7:	83 f2 01             	xor    $0x1,%edx
+  8000ba:	83 e2 01             	and    $0x1,%edx
+  8000bd:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000c3:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000ca:	00 00 00 
+	envid = sys_getenvid();
+  8000cd:	e8 1f 0c 00 00       	call   800cf1 <sys_getenvid>
+  8000d2:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8000d4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000d9:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8000df:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000e5:	8b 52 48             	mov    0x48(%edx),%edx
+  8000e8:	39 ca                	cmp    %ecx,%edx
+  8000ea:	74 27                	je     800113 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8000ec:	83 c0 01             	add    $0x1,%eax
+  8000ef:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000f4:	75 e3                	jne    8000d9 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000f6:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000fd:	75 24                	jne    800123 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000ff:	83 ec 04             	sub    $0x4,%esp
+  800102:	68 70 35 80 00       	push   $0x803570
+  800107:	6a 23                	push   $0x23
+  800109:	68 93 35 80 00       	push   $0x803593
+  80010e:	e8 4f 00 00 00       	call   800162 <_panic>
+			mainenv = &envs[i];
+  800113:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800119:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80011e:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800123:	85 ff                	test   %edi,%edi
+  800125:	7e 07                	jle    80012e <libmain+0x90>
+		binaryname = argv[0];
+  800127:	8b 06                	mov    (%esi),%eax
+  800129:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	56                   	push   %esi
+  800132:	57                   	push   %edi
+  800133:	e8 fb fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800138:	e8 0b 00 00 00       	call   800148 <exit>
+}
+  80013d:	83 c4 10             	add    $0x10,%esp
+  800140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800143:	5b                   	pop    %ebx
+  800144:	5e                   	pop    %esi
+  800145:	5f                   	pop    %edi
+  800146:	5d                   	pop    %ebp
+  800147:	c3                   	ret
+
+00800148 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80014e:	e8 94 18 00 00       	call   8019e7 <close_all>
+	sys_env_destroy(0);
+  800153:	83 ec 0c             	sub    $0xc,%esp
+  800156:	6a 00                	push   $0x0
+  800158:	e8 2b 0b 00 00       	call   800c88 <sys_env_destroy>
+}
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	c9                   	leave
+  800161:	c3                   	ret
+
+00800162 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800162:	55                   	push   %ebp
+  800163:	89 e5                	mov    %esp,%ebp
+  800165:	56                   	push   %esi
+  800166:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800167:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80016a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800170:	e8 7c 0b 00 00       	call   800cf1 <sys_getenvid>
+  800175:	83 ec 0c             	sub    $0xc,%esp
+  800178:	ff 75 0c             	push   0xc(%ebp)
+  80017b:	ff 75 08             	push   0x8(%ebp)
+  80017e:	56                   	push   %esi
+  80017f:	50                   	push   %eax
+  800180:	68 ac 35 80 00       	push   $0x8035ac
+  800185:	e8 b3 00 00 00       	call   80023d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80018a:	83 c4 18             	add    $0x18,%esp
+  80018d:	53                   	push   %ebx
+  80018e:	ff 75 10             	push   0x10(%ebp)
+  800191:	e8 56 00 00 00       	call   8001ec <vcprintf>
+	cprintf("\n");
+  800196:	c7 04 24 34 3a 80 00 	movl   $0x803a34,(%esp)
+  80019d:	e8 9b 00 00 00       	call   80023d <cprintf>
+  8001a2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001a5:	cc                   	int3
+	while (1)
+  8001a6:	eb fd                	jmp    8001a5 <_panic+0x43>
+
+008001a8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001a8:	55                   	push   %ebp
+  8001a9:	89 e5                	mov    %esp,%ebp
+  8001ab:	53                   	push   %ebx
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001b2:	8b 13                	mov    (%ebx),%edx
+  8001b4:	8d 42 01             	lea    0x1(%edx),%eax
+  8001b7:	89 03                	mov    %eax,(%ebx)
+  8001b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001bc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001c0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001c5:	74 09                	je     8001d0 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001c7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ce:	c9                   	leave
+  8001cf:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	68 ff 00 00 00       	push   $0xff
+  8001d8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001db:	50                   	push   %eax
+  8001dc:	e8 1d 0a 00 00       	call   800bfe <sys_cputs>
+		b->idx = 0;
+  8001e1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001e7:	83 c4 10             	add    $0x10,%esp
+  8001ea:	eb db                	jmp    8001c7 <putch+0x1f>
+
+008001ec <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001ec:	55                   	push   %ebp
+  8001ed:	89 e5                	mov    %esp,%ebp
+  8001ef:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001f5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001fc:	00 00 00 
+	b.cnt = 0;
+  8001ff:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800206:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800209:	ff 75 0c             	push   0xc(%ebp)
+  80020c:	ff 75 08             	push   0x8(%ebp)
+  80020f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800215:	50                   	push   %eax
+  800216:	68 a8 01 80 00       	push   $0x8001a8
+  80021b:	e8 fb 00 00 00       	call   80031b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800220:	83 c4 08             	add    $0x8,%esp
+  800223:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800229:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80022f:	50                   	push   %eax
+  800230:	e8 c9 09 00 00       	call   800bfe <sys_cputs>
+
+	return b.cnt;
+}
+  800235:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800243:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800246:	50                   	push   %eax
+  800247:	ff 75 08             	push   0x8(%ebp)
+  80024a:	e8 9d ff ff ff       	call   8001ec <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80024f:	c9                   	leave
+  800250:	c3                   	ret
+
+00800251 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800251:	55                   	push   %ebp
+  800252:	89 e5                	mov    %esp,%ebp
+  800254:	57                   	push   %edi
+  800255:	56                   	push   %esi
+  800256:	53                   	push   %ebx
+  800257:	83 ec 1c             	sub    $0x1c,%esp
+  80025a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80025d:	89 d6                	mov    %edx,%esi
+  80025f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800262:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800265:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800268:	73 0b                	jae    800275 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80026a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80026d:	c1 e7 08             	shl    $0x8,%edi
+  800270:	0b 7d 10             	or     0x10(%ebp),%edi
+  800273:	eb 36                	jmp    8002ab <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800275:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800278:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027d:	f7 75 08             	divl   0x8(%ebp)
+  800280:	89 c1                	mov    %eax,%ecx
+  800282:	ff 75 14             	push   0x14(%ebp)
+  800285:	ff 75 10             	push   0x10(%ebp)
+  800288:	83 eb 01             	sub    $0x1,%ebx
+  80028b:	53                   	push   %ebx
+  80028c:	ff 75 08             	push   0x8(%ebp)
+  80028f:	89 f2                	mov    %esi,%edx
+  800291:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800294:	e8 b8 ff ff ff       	call   800251 <printnum>
+  800299:	83 c4 10             	add    $0x10,%esp
+  80029c:	eb 14                	jmp    8002b2 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	56                   	push   %esi
+  8002a2:	57                   	push   %edi
+  8002a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002a6:	ff d0                	call   *%eax
+  8002a8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002ab:	83 eb 01             	sub    $0x1,%ebx
+  8002ae:	85 db                	test   %ebx,%ebx
+  8002b0:	7f ec                	jg     80029e <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002b2:	83 ec 08             	sub    $0x8,%esp
+  8002b5:	56                   	push   %esi
+  8002b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002be:	f7 75 08             	divl   0x8(%ebp)
+  8002c1:	0f be 92 cf 35 80 00 	movsbl 0x8035cf(%edx),%edx
+  8002c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002cb:	c1 e0 08             	shl    $0x8,%eax
+  8002ce:	09 d0                	or     %edx,%eax
+  8002d0:	50                   	push   %eax
+  8002d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002d4:	ff d0                	call   *%eax
+}
+  8002d6:	83 c4 10             	add    $0x10,%esp
+  8002d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002dc:	5b                   	pop    %ebx
+  8002dd:	5e                   	pop    %esi
+  8002de:	5f                   	pop    %edi
+  8002df:	5d                   	pop    %ebp
+  8002e0:	c3                   	ret
+
+008002e1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002e7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002eb:	8b 10                	mov    (%eax),%edx
+  8002ed:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f0:	73 0a                	jae    8002fc <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002f2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f5:	89 08                	mov    %ecx,(%eax)
+  8002f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fa:	88 02                	mov    %al,(%edx)
+}
+  8002fc:	5d                   	pop    %ebp
+  8002fd:	c3                   	ret
+
+008002fe <printfmt>:
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800304:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800307:	50                   	push   %eax
+  800308:	ff 75 10             	push   0x10(%ebp)
+  80030b:	ff 75 0c             	push   0xc(%ebp)
+  80030e:	ff 75 08             	push   0x8(%ebp)
+  800311:	e8 05 00 00 00       	call   80031b <vprintfmt>
+}
+  800316:	83 c4 10             	add    $0x10,%esp
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+
+0080031b <vprintfmt>:
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	57                   	push   %edi
+  80031f:	56                   	push   %esi
+  800320:	53                   	push   %ebx
+  800321:	83 ec 3c             	sub    $0x3c,%esp
+  800324:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800327:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80032a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800331:	eb 16                	jmp    800349 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	ff 75 0c             	push   0xc(%ebp)
+  800339:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80033c:	c1 e2 08             	shl    $0x8,%edx
+  80033f:	09 d0                	or     %edx,%eax
+  800341:	50                   	push   %eax
+  800342:	ff d7                	call   *%edi
+  800344:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800347:	89 de                	mov    %ebx,%esi
+  800349:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80034c:	0f b6 06             	movzbl (%esi),%eax
+  80034f:	83 f8 25             	cmp    $0x25,%eax
+  800352:	74 0c                	je     800360 <vprintfmt+0x45>
+			if (ch == '\0')
+  800354:	85 c0                	test   %eax,%eax
+  800356:	75 db                	jne    800333 <vprintfmt+0x18>
+}
+  800358:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035b:	5b                   	pop    %ebx
+  80035c:	5e                   	pop    %esi
+  80035d:	5f                   	pop    %edi
+  80035e:	5d                   	pop    %ebp
+  80035f:	c3                   	ret
+		padc = ' ';
+  800360:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800364:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80036b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800372:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800379:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80037e:	8d 73 01             	lea    0x1(%ebx),%esi
+  800381:	0f b6 13             	movzbl (%ebx),%edx
+  800384:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800387:	3c 55                	cmp    $0x55,%al
+  800389:	0f 87 2c 04 00 00    	ja     8007bb <vprintfmt+0x4a0>
+  80038f:	0f b6 c0             	movzbl %al,%eax
+  800392:	ff 24 85 20 37 80 00 	jmp    *0x803720(,%eax,4)
+  800399:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80039b:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80039f:	eb dd                	jmp    80037e <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a1:	89 f3                	mov    %esi,%ebx
+  8003a3:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003a7:	eb d5                	jmp    80037e <vprintfmt+0x63>
+  8003a9:	0f b6 d2             	movzbl %dl,%edx
+  8003ac:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003ae:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003b3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003b6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003ba:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003bd:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003c0:	83 fe 09             	cmp    $0x9,%esi
+  8003c3:	0f 87 8a 00 00 00    	ja     800453 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003c9:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003cc:	eb e5                	jmp    8003b3 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d1:	8b 00                	mov    (%eax),%eax
+  8003d3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8003dc:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003df:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8003e1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e5:	79 97                	jns    80037e <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8003e7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003ed:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003f4:	eb 88                	jmp    80037e <vprintfmt+0x63>
+			if (width < 0)
+  8003f6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003f9:	85 db                	test   %ebx,%ebx
+  8003fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800400:	0f 49 c3             	cmovns %ebx,%eax
+  800403:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800406:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800408:	e9 71 ff ff ff       	jmp    80037e <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80040d:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80040f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800416:	e9 63 ff ff ff       	jmp    80037e <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80041b:	8d 73 02             	lea    0x2(%ebx),%esi
+  80041e:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800422:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800429:	3c 67                	cmp    $0x67,%al
+  80042b:	0f 84 18 ff ff ff    	je     800349 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800431:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800438:	3c 72                	cmp    $0x72,%al
+  80043a:	0f 84 09 ff ff ff    	je     800349 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800440:	3c 62                	cmp    $0x62,%al
+  800442:	0f 94 c0             	sete   %al
+  800445:	0f b6 c0             	movzbl %al,%eax
+  800448:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80044b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80044e:	e9 f6 fe ff ff       	jmp    800349 <vprintfmt+0x2e>
+  800453:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800456:	eb 89                	jmp    8003e1 <vprintfmt+0xc6>
+			lflag++;
+  800458:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80045b:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80045d:	e9 1c ff ff ff       	jmp    80037e <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800462:	8b 45 14             	mov    0x14(%ebp),%eax
+  800465:	8d 58 04             	lea    0x4(%eax),%ebx
+  800468:	83 ec 08             	sub    $0x8,%esp
+  80046b:	ff 75 0c             	push   0xc(%ebp)
+  80046e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800471:	c1 e0 08             	shl    $0x8,%eax
+  800474:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800477:	0b 01                	or     (%ecx),%eax
+  800479:	50                   	push   %eax
+  80047a:	ff d7                	call   *%edi
+			break;
+  80047c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80047f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800482:	e9 c2 fe ff ff       	jmp    800349 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80048d:	8b 10                	mov    (%eax),%edx
+  80048f:	89 d0                	mov    %edx,%eax
+  800491:	f7 d8                	neg    %eax
+  800493:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800496:	83 f8 12             	cmp    $0x12,%eax
+  800499:	7f 25                	jg     8004c0 <vprintfmt+0x1a5>
+  80049b:	8b 14 85 80 38 80 00 	mov    0x803880(,%eax,4),%edx
+  8004a2:	85 d2                	test   %edx,%edx
+  8004a4:	74 1a                	je     8004c0 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004a6:	52                   	push   %edx
+  8004a7:	68 c1 39 80 00       	push   $0x8039c1
+  8004ac:	ff 75 0c             	push   0xc(%ebp)
+  8004af:	57                   	push   %edi
+  8004b0:	e8 49 fe ff ff       	call   8002fe <printfmt>
+  8004b5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004b8:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8004bb:	e9 89 fe ff ff       	jmp    800349 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004c0:	50                   	push   %eax
+  8004c1:	68 e7 35 80 00       	push   $0x8035e7
+  8004c6:	ff 75 0c             	push   0xc(%ebp)
+  8004c9:	57                   	push   %edi
+  8004ca:	e8 2f fe ff ff       	call   8002fe <printfmt>
+  8004cf:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004d2:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004d5:	e9 6f fe ff ff       	jmp    800349 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dd:	83 c0 04             	add    $0x4,%eax
+  8004e0:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8004e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e6:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004e8:	85 c9                	test   %ecx,%ecx
+  8004ea:	b8 e0 35 80 00       	mov    $0x8035e0,%eax
+  8004ef:	0f 45 c1             	cmovne %ecx,%eax
+  8004f2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004f5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004f9:	7e 06                	jle    800501 <vprintfmt+0x1e6>
+  8004fb:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004ff:	75 1a                	jne    80051b <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800501:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800504:	c1 e0 08             	shl    $0x8,%eax
+  800507:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80050a:	83 c8 3f             	or     $0x3f,%eax
+  80050d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800510:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800513:	89 75 10             	mov    %esi,0x10(%ebp)
+  800516:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800519:	eb 6d                	jmp    800588 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	ff 75 d0             	push   -0x30(%ebp)
+  800521:	ff 75 c8             	push   -0x38(%ebp)
+  800524:	e8 39 03 00 00       	call   800862 <strnlen>
+  800529:	89 c2                	mov    %eax,%edx
+  80052b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80052e:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800530:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800533:	c1 e1 08             	shl    $0x8,%ecx
+  800536:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80053a:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053c:	83 c4 10             	add    $0x10,%esp
+  80053f:	89 c3                	mov    %eax,%ebx
+  800541:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800544:	89 75 10             	mov    %esi,0x10(%ebp)
+  800547:	89 ce                	mov    %ecx,%esi
+  800549:	eb 0f                	jmp    80055a <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  80054b:	83 ec 08             	sub    $0x8,%esp
+  80054e:	ff 75 0c             	push   0xc(%ebp)
+  800551:	56                   	push   %esi
+  800552:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800554:	83 eb 01             	sub    $0x1,%ebx
+  800557:	83 c4 10             	add    $0x10,%esp
+  80055a:	85 db                	test   %ebx,%ebx
+  80055c:	7f ed                	jg     80054b <vprintfmt+0x230>
+  80055e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800561:	8b 75 10             	mov    0x10(%ebp),%esi
+  800564:	85 c0                	test   %eax,%eax
+  800566:	ba 00 00 00 00       	mov    $0x0,%edx
+  80056b:	0f 49 d0             	cmovns %eax,%edx
+  80056e:	29 d0                	sub    %edx,%eax
+  800570:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800573:	eb 8c                	jmp    800501 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800575:	83 ec 08             	sub    $0x8,%esp
+  800578:	ff 75 0c             	push   0xc(%ebp)
+  80057b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80057e:	09 c2                	or     %eax,%edx
+  800580:	52                   	push   %edx
+  800581:	ff d7                	call   *%edi
+  800583:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800586:	89 d9                	mov    %ebx,%ecx
+  800588:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80058b:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80058f:	0f be d0             	movsbl %al,%edx
+  800592:	85 d2                	test   %edx,%edx
+  800594:	74 2a                	je     8005c0 <vprintfmt+0x2a5>
+  800596:	85 f6                	test   %esi,%esi
+  800598:	78 05                	js     80059f <vprintfmt+0x284>
+  80059a:	83 ee 01             	sub    $0x1,%esi
+  80059d:	78 3b                	js     8005da <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80059f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005a3:	74 d0                	je     800575 <vprintfmt+0x25a>
+  8005a5:	0f be c0             	movsbl %al,%eax
+  8005a8:	83 e8 20             	sub    $0x20,%eax
+  8005ab:	83 f8 5e             	cmp    $0x5e,%eax
+  8005ae:	76 c5                	jbe    800575 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005b0:	83 ec 08             	sub    $0x8,%esp
+  8005b3:	ff 75 0c             	push   0xc(%ebp)
+  8005b6:	ff 75 cc             	push   -0x34(%ebp)
+  8005b9:	ff d7                	call   *%edi
+  8005bb:	83 c4 10             	add    $0x10,%esp
+  8005be:	eb c6                	jmp    800586 <vprintfmt+0x26b>
+  8005c0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005c3:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005c6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c9:	01 c3                	add    %eax,%ebx
+  8005cb:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005cd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005d0:	83 c8 20             	or     $0x20,%eax
+  8005d3:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005d6:	89 c6                	mov    %eax,%esi
+  8005d8:	eb 14                	jmp    8005ee <vprintfmt+0x2d3>
+  8005da:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005dd:	eb e4                	jmp    8005c3 <vprintfmt+0x2a8>
+  8005df:	83 ec 08             	sub    $0x8,%esp
+  8005e2:	ff 75 0c             	push   0xc(%ebp)
+  8005e5:	56                   	push   %esi
+  8005e6:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005e8:	83 eb 01             	sub    $0x1,%ebx
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	85 db                	test   %ebx,%ebx
+  8005f0:	7f ed                	jg     8005df <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005f2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005f5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fb:	e9 49 fd ff ff       	jmp    800349 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800600:	83 f9 01             	cmp    $0x1,%ecx
+  800603:	7f 1f                	jg     800624 <vprintfmt+0x309>
+	else if (lflag)
+  800605:	85 c9                	test   %ecx,%ecx
+  800607:	74 69                	je     800672 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060c:	8b 00                	mov    (%eax),%eax
+  80060e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800611:	89 c1                	mov    %eax,%ecx
+  800613:	c1 f9 1f             	sar    $0x1f,%ecx
+  800616:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8d 40 04             	lea    0x4(%eax),%eax
+  80061f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800622:	eb 17                	jmp    80063b <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800624:	8b 45 14             	mov    0x14(%ebp),%eax
+  800627:	8b 50 04             	mov    0x4(%eax),%edx
+  80062a:	8b 00                	mov    (%eax),%eax
+  80062c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8d 40 08             	lea    0x8(%eax),%eax
+  800638:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80063b:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80063e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800641:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800646:	85 db                	test   %ebx,%ebx
+  800648:	0f 89 f6 00 00 00    	jns    800744 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	ff 75 0c             	push   0xc(%ebp)
+  800654:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800657:	c1 e0 08             	shl    $0x8,%eax
+  80065a:	83 c8 2d             	or     $0x2d,%eax
+  80065d:	50                   	push   %eax
+  80065e:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800660:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800663:	f7 d9                	neg    %ecx
+  800665:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800668:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80066d:	e9 d2 00 00 00       	jmp    800744 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 00                	mov    (%eax),%eax
+  800677:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80067a:	89 c1                	mov    %eax,%ecx
+  80067c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80067f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8d 40 04             	lea    0x4(%eax),%eax
+  800688:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068b:	eb ae                	jmp    80063b <vprintfmt+0x320>
+	if (lflag >= 2)
+  80068d:	83 f9 01             	cmp    $0x1,%ecx
+  800690:	7f 19                	jg     8006ab <vprintfmt+0x390>
+	else if (lflag)
+  800692:	85 c9                	test   %ecx,%ecx
+  800694:	74 2a                	je     8006c0 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 08                	mov    (%eax),%ecx
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a1:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006a6:	e9 99 00 00 00       	jmp    800744 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ae:	8b 08                	mov    (%eax),%ecx
+  8006b0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8006bb:	e9 84 00 00 00       	jmp    800744 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8b 08                	mov    (%eax),%ecx
+  8006c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006d0:	eb 72                	jmp    800744 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006d2:	83 f9 01             	cmp    $0x1,%ecx
+  8006d5:	7f 16                	jg     8006ed <vprintfmt+0x3d2>
+	else if (lflag)
+  8006d7:	85 c9                	test   %ecx,%ecx
+  8006d9:	74 24                	je     8006ff <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 08                	mov    (%eax),%ecx
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006e6:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8006eb:	eb 57                	jmp    800744 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8b 08                	mov    (%eax),%ecx
+  8006f2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006f8:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006fd:	eb 45                	jmp    800744 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8b 08                	mov    (%eax),%ecx
+  800704:	8d 40 04             	lea    0x4(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80070a:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80070f:	eb 33                	jmp    800744 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800711:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800714:	c1 e3 08             	shl    $0x8,%ebx
+  800717:	83 ec 08             	sub    $0x8,%esp
+  80071a:	ff 75 0c             	push   0xc(%ebp)
+  80071d:	89 d8                	mov    %ebx,%eax
+  80071f:	83 c8 30             	or     $0x30,%eax
+  800722:	50                   	push   %eax
+  800723:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800725:	83 c4 08             	add    $0x8,%esp
+  800728:	ff 75 0c             	push   0xc(%ebp)
+  80072b:	83 cb 78             	or     $0x78,%ebx
+  80072e:	53                   	push   %ebx
+  80072f:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800736:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800739:	8d 40 04             	lea    0x4(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80073f:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800744:	ff 75 e4             	push   -0x1c(%ebp)
+  800747:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80074b:	52                   	push   %edx
+  80074c:	ff 75 e0             	push   -0x20(%ebp)
+  80074f:	50                   	push   %eax
+  800750:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800753:	89 f8                	mov    %edi,%eax
+  800755:	e8 f7 fa ff ff       	call   800251 <printnum>
+			break;
+  80075a:	83 c4 10             	add    $0x10,%esp
+  80075d:	e9 e7 fb ff ff       	jmp    800349 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800762:	83 f9 01             	cmp    $0x1,%ecx
+  800765:	7f 16                	jg     80077d <vprintfmt+0x462>
+	else if (lflag)
+  800767:	85 c9                	test   %ecx,%ecx
+  800769:	74 24                	je     80078f <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8b 08                	mov    (%eax),%ecx
+  800770:	8d 40 04             	lea    0x4(%eax),%eax
+  800773:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800776:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80077b:	eb c7                	jmp    800744 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80077d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800780:	8b 08                	mov    (%eax),%ecx
+  800782:	8d 40 08             	lea    0x8(%eax),%eax
+  800785:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800788:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80078d:	eb b5                	jmp    800744 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 08                	mov    (%eax),%ecx
+  800794:	8d 40 04             	lea    0x4(%eax),%eax
+  800797:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079a:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80079f:	eb a3                	jmp    800744 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007a1:	83 ec 08             	sub    $0x8,%esp
+  8007a4:	ff 75 0c             	push   0xc(%ebp)
+  8007a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007aa:	c1 e0 08             	shl    $0x8,%eax
+  8007ad:	83 c8 25             	or     $0x25,%eax
+  8007b0:	50                   	push   %eax
+  8007b1:	ff d7                	call   *%edi
+			break;
+  8007b3:	83 c4 10             	add    $0x10,%esp
+  8007b6:	e9 8e fb ff ff       	jmp    800349 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8007bb:	83 ec 08             	sub    $0x8,%esp
+  8007be:	ff 75 0c             	push   0xc(%ebp)
+  8007c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007c4:	c1 e0 08             	shl    $0x8,%eax
+  8007c7:	83 c8 25             	or     $0x25,%eax
+  8007ca:	50                   	push   %eax
+  8007cb:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007cd:	83 c4 10             	add    $0x10,%esp
+  8007d0:	89 de                	mov    %ebx,%esi
+  8007d2:	eb 03                	jmp    8007d7 <vprintfmt+0x4bc>
+  8007d4:	83 ee 01             	sub    $0x1,%esi
+  8007d7:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007db:	75 f7                	jne    8007d4 <vprintfmt+0x4b9>
+  8007dd:	e9 67 fb ff ff       	jmp    800349 <vprintfmt+0x2e>
+
+008007e2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	83 ec 18             	sub    $0x18,%esp
+  8007e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007ee:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007f1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007f5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007f8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007ff:	85 c0                	test   %eax,%eax
+  800801:	74 26                	je     800829 <vsnprintf+0x47>
+  800803:	85 d2                	test   %edx,%edx
+  800805:	7e 22                	jle    800829 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800807:	ff 75 14             	push   0x14(%ebp)
+  80080a:	ff 75 10             	push   0x10(%ebp)
+  80080d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800810:	50                   	push   %eax
+  800811:	68 e1 02 80 00       	push   $0x8002e1
+  800816:	e8 00 fb ff ff       	call   80031b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80081b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80081e:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800821:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800824:	83 c4 10             	add    $0x10,%esp
+}
+  800827:	c9                   	leave
+  800828:	c3                   	ret
+		return -E_INVAL;
+  800829:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80082e:	eb f7                	jmp    800827 <vsnprintf+0x45>
+
+00800830 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800830:	55                   	push   %ebp
+  800831:	89 e5                	mov    %esp,%ebp
+  800833:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800836:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800839:	50                   	push   %eax
+  80083a:	ff 75 10             	push   0x10(%ebp)
+  80083d:	ff 75 0c             	push   0xc(%ebp)
+  800840:	ff 75 08             	push   0x8(%ebp)
+  800843:	e8 9a ff ff ff       	call   8007e2 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800848:	c9                   	leave
+  800849:	c3                   	ret
+
+0080084a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80084a:	55                   	push   %ebp
+  80084b:	89 e5                	mov    %esp,%ebp
+  80084d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800850:	b8 00 00 00 00       	mov    $0x0,%eax
+  800855:	eb 03                	jmp    80085a <strlen+0x10>
+		n++;
+  800857:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80085a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80085e:	75 f7                	jne    800857 <strlen+0xd>
+	return n;
+}
+  800860:	5d                   	pop    %ebp
+  800861:	c3                   	ret
+
+00800862 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800868:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	eb 03                	jmp    800875 <strnlen+0x13>
+		n++;
+  800872:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800875:	39 d0                	cmp    %edx,%eax
+  800877:	74 08                	je     800881 <strnlen+0x1f>
+  800879:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80087d:	75 f3                	jne    800872 <strnlen+0x10>
+  80087f:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800881:	89 d0                	mov    %edx,%eax
+  800883:	5d                   	pop    %ebp
+  800884:	c3                   	ret
+
+00800885 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	53                   	push   %ebx
+  800889:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80088c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80088f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800894:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800898:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80089b:	83 c0 01             	add    $0x1,%eax
+  80089e:	84 d2                	test   %dl,%dl
+  8008a0:	75 f2                	jne    800894 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008a2:	89 c8                	mov    %ecx,%eax
+  8008a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a7:	c9                   	leave
+  8008a8:	c3                   	ret
+
+008008a9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008a9:	55                   	push   %ebp
+  8008aa:	89 e5                	mov    %esp,%ebp
+  8008ac:	53                   	push   %ebx
+  8008ad:	83 ec 10             	sub    $0x10,%esp
+  8008b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008b3:	53                   	push   %ebx
+  8008b4:	e8 91 ff ff ff       	call   80084a <strlen>
+  8008b9:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008bc:	ff 75 0c             	push   0xc(%ebp)
+  8008bf:	01 d8                	add    %ebx,%eax
+  8008c1:	50                   	push   %eax
+  8008c2:	e8 be ff ff ff       	call   800885 <strcpy>
+	return dst;
+}
+  8008c7:	89 d8                	mov    %ebx,%eax
+  8008c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008cc:	c9                   	leave
+  8008cd:	c3                   	ret
+
+008008ce <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008ce:	55                   	push   %ebp
+  8008cf:	89 e5                	mov    %esp,%ebp
+  8008d1:	56                   	push   %esi
+  8008d2:	53                   	push   %ebx
+  8008d3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008d9:	89 f3                	mov    %esi,%ebx
+  8008db:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008de:	89 f0                	mov    %esi,%eax
+  8008e0:	eb 0f                	jmp    8008f1 <strncpy+0x23>
+		*dst++ = *src;
+  8008e2:	83 c0 01             	add    $0x1,%eax
+  8008e5:	0f b6 0a             	movzbl (%edx),%ecx
+  8008e8:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008eb:	80 f9 01             	cmp    $0x1,%cl
+  8008ee:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008f1:	39 d8                	cmp    %ebx,%eax
+  8008f3:	75 ed                	jne    8008e2 <strncpy+0x14>
+	}
+	return ret;
+}
+  8008f5:	89 f0                	mov    %esi,%eax
+  8008f7:	5b                   	pop    %ebx
+  8008f8:	5e                   	pop    %esi
+  8008f9:	5d                   	pop    %ebp
+  8008fa:	c3                   	ret
+
+008008fb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	56                   	push   %esi
+  8008ff:	53                   	push   %ebx
+  800900:	8b 75 08             	mov    0x8(%ebp),%esi
+  800903:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800906:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800909:	89 f0                	mov    %esi,%eax
+  80090b:	85 d2                	test   %edx,%edx
+  80090d:	74 21                	je     800930 <strlcpy+0x35>
+  80090f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800913:	89 f2                	mov    %esi,%edx
+  800915:	eb 09                	jmp    800920 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800917:	83 c1 01             	add    $0x1,%ecx
+  80091a:	83 c2 01             	add    $0x1,%edx
+  80091d:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800920:	39 c2                	cmp    %eax,%edx
+  800922:	74 09                	je     80092d <strlcpy+0x32>
+  800924:	0f b6 19             	movzbl (%ecx),%ebx
+  800927:	84 db                	test   %bl,%bl
+  800929:	75 ec                	jne    800917 <strlcpy+0x1c>
+  80092b:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80092d:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800930:	29 f0                	sub    %esi,%eax
+}
+  800932:	5b                   	pop    %ebx
+  800933:	5e                   	pop    %esi
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80093f:	eb 06                	jmp    800947 <strcmp+0x11>
+		p++, q++;
+  800941:	83 c1 01             	add    $0x1,%ecx
+  800944:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800947:	0f b6 01             	movzbl (%ecx),%eax
+  80094a:	84 c0                	test   %al,%al
+  80094c:	74 04                	je     800952 <strcmp+0x1c>
+  80094e:	3a 02                	cmp    (%edx),%al
+  800950:	74 ef                	je     800941 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800952:	0f b6 c0             	movzbl %al,%eax
+  800955:	0f b6 12             	movzbl (%edx),%edx
+  800958:	29 d0                	sub    %edx,%eax
+}
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+
+0080095c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	53                   	push   %ebx
+  800960:	8b 45 08             	mov    0x8(%ebp),%eax
+  800963:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800966:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800969:	eb 09                	jmp    800974 <strncmp+0x18>
+		n--, p++, q++;
+  80096b:	83 ea 01             	sub    $0x1,%edx
+  80096e:	83 c0 01             	add    $0x1,%eax
+  800971:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800974:	85 d2                	test   %edx,%edx
+  800976:	74 18                	je     800990 <strncmp+0x34>
+  800978:	0f b6 18             	movzbl (%eax),%ebx
+  80097b:	84 db                	test   %bl,%bl
+  80097d:	74 04                	je     800983 <strncmp+0x27>
+  80097f:	3a 19                	cmp    (%ecx),%bl
+  800981:	74 e8                	je     80096b <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800983:	0f b6 00             	movzbl (%eax),%eax
+  800986:	0f b6 11             	movzbl (%ecx),%edx
+  800989:	29 d0                	sub    %edx,%eax
+}
+  80098b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80098e:	c9                   	leave
+  80098f:	c3                   	ret
+		return 0;
+  800990:	b8 00 00 00 00       	mov    $0x0,%eax
+  800995:	eb f4                	jmp    80098b <strncmp+0x2f>
+
+00800997 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009a1:	eb 03                	jmp    8009a6 <strchr+0xf>
+  8009a3:	83 c0 01             	add    $0x1,%eax
+  8009a6:	0f b6 10             	movzbl (%eax),%edx
+  8009a9:	84 d2                	test   %dl,%dl
+  8009ab:	74 06                	je     8009b3 <strchr+0x1c>
+		if (*s == c)
+  8009ad:	38 ca                	cmp    %cl,%dl
+  8009af:	75 f2                	jne    8009a3 <strchr+0xc>
+  8009b1:	eb 05                	jmp    8009b8 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b8:	5d                   	pop    %ebp
+  8009b9:	c3                   	ret
+
+008009ba <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009c4:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009c7:	38 ca                	cmp    %cl,%dl
+  8009c9:	74 09                	je     8009d4 <strfind+0x1a>
+  8009cb:	84 d2                	test   %dl,%dl
+  8009cd:	74 05                	je     8009d4 <strfind+0x1a>
+	for (; *s; s++)
+  8009cf:	83 c0 01             	add    $0x1,%eax
+  8009d2:	eb f0                	jmp    8009c4 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009d4:	5d                   	pop    %ebp
+  8009d5:	c3                   	ret
+
+008009d6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	57                   	push   %edi
+  8009da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009dd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009e0:	85 c9                	test   %ecx,%ecx
+  8009e2:	74 20                	je     800a04 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009e4:	89 f8                	mov    %edi,%eax
+  8009e6:	09 c8                	or     %ecx,%eax
+  8009e8:	a8 03                	test   $0x3,%al
+  8009ea:	75 12                	jne    8009fe <memset+0x28>
+		c &= 0xFF;
+  8009ec:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009f0:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009f6:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009f9:	fc                   	cld
+  8009fa:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009fc:	eb 06                	jmp    800a04 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a01:	fc                   	cld
+  800a02:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a04:	89 f8                	mov    %edi,%eax
+  800a06:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a09:	c9                   	leave
+  800a0a:	c3                   	ret
+
+00800a0b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	57                   	push   %edi
+  800a0f:	56                   	push   %esi
+  800a10:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a13:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a16:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a19:	39 c6                	cmp    %eax,%esi
+  800a1b:	73 32                	jae    800a4f <memmove+0x44>
+  800a1d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a20:	39 d0                	cmp    %edx,%eax
+  800a22:	73 2b                	jae    800a4f <memmove+0x44>
+		s += n;
+		d += n;
+  800a24:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a27:	89 d6                	mov    %edx,%esi
+  800a29:	09 fe                	or     %edi,%esi
+  800a2b:	09 ce                	or     %ecx,%esi
+  800a2d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a33:	75 0e                	jne    800a43 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a35:	83 ef 04             	sub    $0x4,%edi
+  800a38:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a3b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a3e:	fd                   	std
+  800a3f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a41:	eb 09                	jmp    800a4c <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a43:	83 ef 01             	sub    $0x1,%edi
+  800a46:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a49:	fd                   	std
+  800a4a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a4c:	fc                   	cld
+  800a4d:	eb 1a                	jmp    800a69 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a4f:	89 f2                	mov    %esi,%edx
+  800a51:	09 c2                	or     %eax,%edx
+  800a53:	09 ca                	or     %ecx,%edx
+  800a55:	f6 c2 03             	test   $0x3,%dl
+  800a58:	75 0a                	jne    800a64 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a5a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a5d:	89 c7                	mov    %eax,%edi
+  800a5f:	fc                   	cld
+  800a60:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a62:	eb 05                	jmp    800a69 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a64:	89 c7                	mov    %eax,%edi
+  800a66:	fc                   	cld
+  800a67:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a69:	5e                   	pop    %esi
+  800a6a:	5f                   	pop    %edi
+  800a6b:	5d                   	pop    %ebp
+  800a6c:	c3                   	ret
+
+00800a6d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a73:	ff 75 10             	push   0x10(%ebp)
+  800a76:	ff 75 0c             	push   0xc(%ebp)
+  800a79:	ff 75 08             	push   0x8(%ebp)
+  800a7c:	e8 8a ff ff ff       	call   800a0b <memmove>
+}
+  800a81:	c9                   	leave
+  800a82:	c3                   	ret
+
+00800a83 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a83:	55                   	push   %ebp
+  800a84:	89 e5                	mov    %esp,%ebp
+  800a86:	56                   	push   %esi
+  800a87:	53                   	push   %ebx
+  800a88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a8e:	89 c6                	mov    %eax,%esi
+  800a90:	03 75 10             	add    0x10(%ebp),%esi
+  800a93:	eb 06                	jmp    800a9b <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a95:	83 c0 01             	add    $0x1,%eax
+  800a98:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a9b:	39 f0                	cmp    %esi,%eax
+  800a9d:	74 14                	je     800ab3 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a9f:	0f b6 08             	movzbl (%eax),%ecx
+  800aa2:	0f b6 1a             	movzbl (%edx),%ebx
+  800aa5:	38 d9                	cmp    %bl,%cl
+  800aa7:	74 ec                	je     800a95 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800aa9:	0f b6 c1             	movzbl %cl,%eax
+  800aac:	0f b6 db             	movzbl %bl,%ebx
+  800aaf:	29 d8                	sub    %ebx,%eax
+  800ab1:	eb 05                	jmp    800ab8 <memcmp+0x35>
+	}
+
+	return 0;
+  800ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab8:	5b                   	pop    %ebx
+  800ab9:	5e                   	pop    %esi
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+
+00800abc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ac5:	89 c2                	mov    %eax,%edx
+  800ac7:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800aca:	eb 03                	jmp    800acf <memfind+0x13>
+  800acc:	83 c0 01             	add    $0x1,%eax
+  800acf:	39 d0                	cmp    %edx,%eax
+  800ad1:	73 04                	jae    800ad7 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ad3:	38 08                	cmp    %cl,(%eax)
+  800ad5:	75 f5                	jne    800acc <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ad7:	5d                   	pop    %ebp
+  800ad8:	c3                   	ret
+
+00800ad9 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800ad9:	55                   	push   %ebp
+  800ada:	89 e5                	mov    %esp,%ebp
+  800adc:	57                   	push   %edi
+  800add:	56                   	push   %esi
+  800ade:	53                   	push   %ebx
+  800adf:	83 ec 1c             	sub    $0x1c,%esp
+  800ae2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ae5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ae8:	eb 03                	jmp    800aed <strtol+0x14>
+		s++;
+  800aea:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800aed:	0f b6 06             	movzbl (%esi),%eax
+  800af0:	3c 20                	cmp    $0x20,%al
+  800af2:	74 f6                	je     800aea <strtol+0x11>
+  800af4:	3c 09                	cmp    $0x9,%al
+  800af6:	74 f2                	je     800aea <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800af8:	3c 2b                	cmp    $0x2b,%al
+  800afa:	74 43                	je     800b3f <strtol+0x66>
+	int neg = 0;
+  800afc:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b01:	3c 2d                	cmp    $0x2d,%al
+  800b03:	74 44                	je     800b49 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b05:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b0b:	75 0f                	jne    800b1c <strtol+0x43>
+  800b0d:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b10:	74 41                	je     800b53 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b12:	85 ff                	test   %edi,%edi
+  800b14:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b19:	0f 44 f8             	cmove  %eax,%edi
+  800b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b21:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b26:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b29:	89 fb                	mov    %edi,%ebx
+  800b2b:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b2e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b31:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b34:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b37:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b3a:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b3d:	eb 67                	jmp    800ba6 <strtol+0xcd>
+		s++;
+  800b3f:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b47:	eb bc                	jmp    800b05 <strtol+0x2c>
+		s++, neg = 1;
+  800b49:	83 c6 01             	add    $0x1,%esi
+  800b4c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b51:	eb b2                	jmp    800b05 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b53:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b57:	74 0e                	je     800b67 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b59:	85 ff                	test   %edi,%edi
+  800b5b:	75 bf                	jne    800b1c <strtol+0x43>
+		s++, base = 8;
+  800b5d:	83 c6 01             	add    $0x1,%esi
+  800b60:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b65:	eb b5                	jmp    800b1c <strtol+0x43>
+		s += 2, base = 16;
+  800b67:	83 c6 02             	add    $0x2,%esi
+  800b6a:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b6f:	eb ab                	jmp    800b1c <strtol+0x43>
+			dig = *s - '0';
+  800b71:	0f be c9             	movsbl %cl,%ecx
+  800b74:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b77:	39 f9                	cmp    %edi,%ecx
+  800b79:	7d 59                	jge    800bd4 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b7b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b7f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b82:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b85:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b88:	0f af d8             	imul   %eax,%ebx
+  800b8b:	0f af d7             	imul   %edi,%edx
+  800b8e:	01 d3                	add    %edx,%ebx
+  800b90:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b93:	f7 e7                	mul    %edi
+  800b95:	01 da                	add    %ebx,%edx
+  800b97:	89 cb                	mov    %ecx,%ebx
+  800b99:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b9c:	01 c8                	add    %ecx,%eax
+  800b9e:	11 da                	adc    %ebx,%edx
+  800ba0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ba3:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba9:	0f b6 08             	movzbl (%eax),%ecx
+  800bac:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800baf:	80 fb 09             	cmp    $0x9,%bl
+  800bb2:	76 bd                	jbe    800b71 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb4:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800bb7:	80 fb 19             	cmp    $0x19,%bl
+  800bba:	77 08                	ja     800bc4 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800bbc:	0f be c9             	movsbl %cl,%ecx
+  800bbf:	83 e9 57             	sub    $0x57,%ecx
+  800bc2:	eb b3                	jmp    800b77 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc4:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800bc7:	80 fb 19             	cmp    $0x19,%bl
+  800bca:	77 08                	ja     800bd4 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800bcc:	0f be c9             	movsbl %cl,%ecx
+  800bcf:	83 e9 37             	sub    $0x37,%ecx
+  800bd2:	eb a3                	jmp    800b77 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bd4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bd7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bda:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bdd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800be0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800be4:	74 05                	je     800beb <strtol+0x112>
+		*endptr = (char *) s;
+  800be6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800be9:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800beb:	85 c9                	test   %ecx,%ecx
+  800bed:	74 07                	je     800bf6 <strtol+0x11d>
+  800bef:	f7 d8                	neg    %eax
+  800bf1:	83 d2 00             	adc    $0x0,%edx
+  800bf4:	f7 da                	neg    %edx
+}
+  800bf6:	83 c4 1c             	add    $0x1c,%esp
+  800bf9:	5b                   	pop    %ebx
+  800bfa:	5e                   	pop    %esi
+  800bfb:	5f                   	pop    %edi
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+
+00800bfe <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	57                   	push   %edi
+  800c02:	56                   	push   %esi
+  800c03:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c04:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c0b:	74 18                	je     800c25 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c18:	89 c3                	mov    %eax,%ebx
+  800c1a:	89 c7                	mov    %eax,%edi
+  800c1c:	89 c6                	mov    %eax,%esi
+  800c1e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c20:	5b                   	pop    %ebx
+  800c21:	5e                   	pop    %esi
+  800c22:	5f                   	pop    %edi
+  800c23:	5d                   	pop    %ebp
+  800c24:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c30:	89 c3                	mov    %eax,%ebx
+  800c32:	89 c7                	mov    %eax,%edi
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	8d 35 3f 0c 80 00    	lea    0x800c3f,%esi
+  800c3d:	0f 34                	sysenter
+  800c3f:	5d                   	pop    %ebp
+		goto out;
+  800c40:	eb de                	jmp    800c20 <sys_cputs+0x22>
+
+00800c42 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c48:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c4f:	74 19                	je     800c6a <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c56:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c5b:	89 d1                	mov    %edx,%ecx
+  800c5d:	89 d3                	mov    %edx,%ebx
+  800c5f:	89 d7                	mov    %edx,%edi
+  800c61:	89 d6                	mov    %edx,%esi
+  800c63:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c65:	5b                   	pop    %ebx
+  800c66:	5e                   	pop    %esi
+  800c67:	5f                   	pop    %edi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c74:	89 d1                	mov    %edx,%ecx
+  800c76:	89 d3                	mov    %edx,%ebx
+  800c78:	89 d7                	mov    %edx,%edi
+  800c7a:	55                   	push   %ebp
+  800c7b:	89 e5                	mov    %esp,%ebp
+  800c7d:	8d 35 85 0c 80 00    	lea    0x800c85,%esi
+  800c83:	0f 34                	sysenter
+  800c85:	5d                   	pop    %ebp
+		goto out;
+  800c86:	eb dd                	jmp    800c65 <sys_cgetc+0x23>
+
+00800c88 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	57                   	push   %edi
+  800c8c:	56                   	push   %esi
+  800c8d:	53                   	push   %ebx
+  800c8e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c91:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c98:	74 21                	je     800cbb <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ca4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca7:	89 cb                	mov    %ecx,%ebx
+  800ca9:	89 cf                	mov    %ecx,%edi
+  800cab:	89 ce                	mov    %ecx,%esi
+  800cad:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800caf:	85 c0                	test   %eax,%eax
+  800cb1:	7f 27                	jg     800cda <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb6:	5b                   	pop    %ebx
+  800cb7:	5e                   	pop    %esi
+  800cb8:	5f                   	pop    %edi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cc8:	89 cb                	mov    %ecx,%ebx
+  800cca:	89 cf                	mov    %ecx,%edi
+  800ccc:	55                   	push   %ebp
+  800ccd:	89 e5                	mov    %esp,%ebp
+  800ccf:	8d 35 d7 0c 80 00    	lea    0x800cd7,%esi
+  800cd5:	0f 34                	sysenter
+  800cd7:	5d                   	pop    %ebp
+		goto out;
+  800cd8:	eb d5                	jmp    800caf <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cda:	83 ec 0c             	sub    $0xc,%esp
+  800cdd:	50                   	push   %eax
+  800cde:	6a 03                	push   $0x3
+  800ce0:	68 eb 38 80 00       	push   $0x8038eb
+  800ce5:	6a 3f                	push   $0x3f
+  800ce7:	68 08 39 80 00       	push   $0x803908
+  800cec:	e8 71 f4 ff ff       	call   800162 <_panic>
+
+00800cf1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cf7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cfe:	74 19                	je     800d19 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d05:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d0a:	89 d1                	mov    %edx,%ecx
+  800d0c:	89 d3                	mov    %edx,%ebx
+  800d0e:	89 d7                	mov    %edx,%edi
+  800d10:	89 d6                	mov    %edx,%esi
+  800d12:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d14:	5b                   	pop    %ebx
+  800d15:	5e                   	pop    %esi
+  800d16:	5f                   	pop    %edi
+  800d17:	5d                   	pop    %ebp
+  800d18:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d23:	89 d1                	mov    %edx,%ecx
+  800d25:	89 d3                	mov    %edx,%ebx
+  800d27:	89 d7                	mov    %edx,%edi
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	8d 35 34 0d 80 00    	lea    0x800d34,%esi
+  800d32:	0f 34                	sysenter
+  800d34:	5d                   	pop    %ebp
+		goto out;
+  800d35:	eb dd                	jmp    800d14 <sys_getenvid+0x23>
+
+00800d37 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	56                   	push   %esi
+  800d3c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d3d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d44:	74 19                	je     800d5f <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d50:	89 d1                	mov    %edx,%ecx
+  800d52:	89 d3                	mov    %edx,%ebx
+  800d54:	89 d7                	mov    %edx,%edi
+  800d56:	89 d6                	mov    %edx,%esi
+  800d58:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d64:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d69:	89 d1                	mov    %edx,%ecx
+  800d6b:	89 d3                	mov    %edx,%ebx
+  800d6d:	89 d7                	mov    %edx,%edi
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	8d 35 7a 0d 80 00    	lea    0x800d7a,%esi
+  800d78:	0f 34                	sysenter
+  800d7a:	5d                   	pop    %ebp
+		goto out;
+  800d7b:	eb dd                	jmp    800d5a <sys_yield+0x23>
+
+00800d7d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d7d:	55                   	push   %ebp
+  800d7e:	89 e5                	mov    %esp,%ebp
+  800d80:	57                   	push   %edi
+  800d81:	56                   	push   %esi
+  800d82:	53                   	push   %ebx
+  800d83:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d86:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d8d:	74 23                	je     800db2 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d8f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d94:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da2:	89 f7                	mov    %esi,%edi
+  800da4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da6:	85 c0                	test   %eax,%eax
+  800da8:	7f 29                	jg     800dd3 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800db2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dc2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	8d 35 d0 0d 80 00    	lea    0x800dd0,%esi
+  800dce:	0f 34                	sysenter
+  800dd0:	5d                   	pop    %ebp
+		goto out;
+  800dd1:	eb d3                	jmp    800da6 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd3:	83 ec 0c             	sub    $0xc,%esp
+  800dd6:	50                   	push   %eax
+  800dd7:	6a 04                	push   $0x4
+  800dd9:	68 eb 38 80 00       	push   $0x8038eb
+  800dde:	6a 3f                	push   $0x3f
+  800de0:	68 08 39 80 00       	push   $0x803908
+  800de5:	e8 78 f3 ff ff       	call   800162 <_panic>
+
+00800dea <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	57                   	push   %edi
+  800dee:	56                   	push   %esi
+  800def:	53                   	push   %ebx
+  800df0:	83 ec 0c             	sub    $0xc,%esp
+  800df3:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800df6:	85 f6                	test   %esi,%esi
+  800df8:	75 09                	jne    800e03 <sys_page_map+0x19>
+  800dfa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e01:	74 1f                	je     800e22 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e03:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e11:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e14:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e16:	85 c0                	test   %eax,%eax
+  800e18:	7f 27                	jg     800e41 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1d:	5b                   	pop    %ebx
+  800e1e:	5e                   	pop    %esi
+  800e1f:	5f                   	pop    %edi
+  800e20:	5d                   	pop    %ebp
+  800e21:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e28:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	8d 35 3e 0e 80 00    	lea    0x800e3e,%esi
+  800e3c:	0f 34                	sysenter
+  800e3e:	5d                   	pop    %ebp
+		goto out;
+  800e3f:	eb d5                	jmp    800e16 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e41:	83 ec 0c             	sub    $0xc,%esp
+  800e44:	50                   	push   %eax
+  800e45:	6a 05                	push   $0x5
+  800e47:	68 eb 38 80 00       	push   $0x8038eb
+  800e4c:	6a 3f                	push   $0x3f
+  800e4e:	68 08 39 80 00       	push   $0x803908
+  800e53:	e8 0a f3 ff ff       	call   800162 <_panic>
+
+00800e58 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e58:	55                   	push   %ebp
+  800e59:	89 e5                	mov    %esp,%ebp
+  800e5b:	57                   	push   %edi
+  800e5c:	56                   	push   %esi
+  800e5d:	53                   	push   %ebx
+  800e5e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e61:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e68:	74 22                	je     800e8c <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7a:	89 df                	mov    %ebx,%edi
+  800e7c:	89 de                	mov    %ebx,%esi
+  800e7e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e80:	85 c0                	test   %eax,%eax
+  800e82:	7f 28                	jg     800eac <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e87:	5b                   	pop    %ebx
+  800e88:	5e                   	pop    %esi
+  800e89:	5f                   	pop    %edi
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e9c:	89 df                	mov    %ebx,%edi
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	8d 35 a9 0e 80 00    	lea    0x800ea9,%esi
+  800ea7:	0f 34                	sysenter
+  800ea9:	5d                   	pop    %ebp
+		goto out;
+  800eaa:	eb d4                	jmp    800e80 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eac:	83 ec 0c             	sub    $0xc,%esp
+  800eaf:	50                   	push   %eax
+  800eb0:	6a 06                	push   $0x6
+  800eb2:	68 eb 38 80 00       	push   $0x8038eb
+  800eb7:	6a 3f                	push   $0x3f
+  800eb9:	68 08 39 80 00       	push   $0x803908
+  800ebe:	e8 9f f2 ff ff       	call   800162 <_panic>
+
+00800ec3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ec3:	55                   	push   %ebp
+  800ec4:	89 e5                	mov    %esp,%ebp
+  800ec6:	57                   	push   %edi
+  800ec7:	56                   	push   %esi
+  800ec8:	53                   	push   %ebx
+  800ec9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ecc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ed3:	74 22                	je     800ef7 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800ed5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eda:	b8 08 00 00 00       	mov    $0x8,%eax
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	89 df                	mov    %ebx,%edi
+  800ee7:	89 de                	mov    %ebx,%esi
+  800ee9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eeb:	85 c0                	test   %eax,%eax
+  800eed:	7f 28                	jg     800f17 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5e                   	pop    %esi
+  800ef4:	5f                   	pop    %edi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f02:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f07:	89 df                	mov    %ebx,%edi
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	8d 35 14 0f 80 00    	lea    0x800f14,%esi
+  800f12:	0f 34                	sysenter
+  800f14:	5d                   	pop    %ebp
+		goto out;
+  800f15:	eb d4                	jmp    800eeb <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  800f1a:	50                   	push   %eax
+  800f1b:	6a 08                	push   $0x8
+  800f1d:	68 eb 38 80 00       	push   $0x8038eb
+  800f22:	6a 3f                	push   $0x3f
+  800f24:	68 08 39 80 00       	push   $0x803908
+  800f29:	e8 34 f2 ff ff       	call   800162 <_panic>
+
+00800f2e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+  800f34:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f37:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f3e:	74 22                	je     800f62 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f45:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f50:	89 df                	mov    %ebx,%edi
+  800f52:	89 de                	mov    %ebx,%esi
+  800f54:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f56:	85 c0                	test   %eax,%eax
+  800f58:	7f 28                	jg     800f82 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5d:	5b                   	pop    %ebx
+  800f5e:	5e                   	pop    %esi
+  800f5f:	5f                   	pop    %edi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f72:	89 df                	mov    %ebx,%edi
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	8d 35 7f 0f 80 00    	lea    0x800f7f,%esi
+  800f7d:	0f 34                	sysenter
+  800f7f:	5d                   	pop    %ebp
+		goto out;
+  800f80:	eb d4                	jmp    800f56 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+  800f85:	50                   	push   %eax
+  800f86:	6a 09                	push   $0x9
+  800f88:	68 eb 38 80 00       	push   $0x8038eb
+  800f8d:	6a 3f                	push   $0x3f
+  800f8f:	68 08 39 80 00       	push   $0x803908
+  800f94:	e8 c9 f1 ff ff       	call   800162 <_panic>
+
+00800f99 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f99:	55                   	push   %ebp
+  800f9a:	89 e5                	mov    %esp,%ebp
+  800f9c:	57                   	push   %edi
+  800f9d:	56                   	push   %esi
+  800f9e:	53                   	push   %ebx
+  800f9f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fa2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fa9:	74 22                	je     800fcd <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800fab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbb:	89 df                	mov    %ebx,%edi
+  800fbd:	89 de                	mov    %ebx,%esi
+  800fbf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc1:	85 c0                	test   %eax,%eax
+  800fc3:	7f 28                	jg     800fed <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc8:	5b                   	pop    %ebx
+  800fc9:	5e                   	pop    %esi
+  800fca:	5f                   	pop    %edi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fdd:	89 df                	mov    %ebx,%edi
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	8d 35 ea 0f 80 00    	lea    0x800fea,%esi
+  800fe8:	0f 34                	sysenter
+  800fea:	5d                   	pop    %ebp
+		goto out;
+  800feb:	eb d4                	jmp    800fc1 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fed:	83 ec 0c             	sub    $0xc,%esp
+  800ff0:	50                   	push   %eax
+  800ff1:	6a 0a                	push   $0xa
+  800ff3:	68 eb 38 80 00       	push   $0x8038eb
+  800ff8:	6a 3f                	push   $0x3f
+  800ffa:	68 08 39 80 00       	push   $0x803908
+  800fff:	e8 5e f1 ff ff       	call   800162 <_panic>
+
+00801004 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	57                   	push   %edi
+  801008:	56                   	push   %esi
+  801009:	53                   	push   %ebx
+  80100a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80100d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801014:	74 22                	je     801038 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801016:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801020:	8b 55 08             	mov    0x8(%ebp),%edx
+  801023:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801026:	89 df                	mov    %ebx,%edi
+  801028:	89 de                	mov    %ebx,%esi
+  80102a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80102c:	85 c0                	test   %eax,%eax
+  80102e:	7f 28                	jg     801058 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801033:	5b                   	pop    %ebx
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801038:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801040:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801043:	b8 17 00 00 00       	mov    $0x17,%eax
+  801048:	89 df                	mov    %ebx,%edi
+  80104a:	55                   	push   %ebp
+  80104b:	89 e5                	mov    %esp,%ebp
+  80104d:	8d 35 55 10 80 00    	lea    0x801055,%esi
+  801053:	0f 34                	sysenter
+  801055:	5d                   	pop    %ebp
+		goto out;
+  801056:	eb d4                	jmp    80102c <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801058:	83 ec 0c             	sub    $0xc,%esp
+  80105b:	50                   	push   %eax
+  80105c:	6a 17                	push   $0x17
+  80105e:	68 eb 38 80 00       	push   $0x8038eb
+  801063:	6a 3f                	push   $0x3f
+  801065:	68 08 39 80 00       	push   $0x803908
+  80106a:	e8 f3 f0 ff ff       	call   800162 <_panic>
+
+0080106f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+  801075:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801078:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80107f:	74 22                	je     8010a3 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801081:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801086:	b8 18 00 00 00       	mov    $0x18,%eax
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801091:	89 df                	mov    %ebx,%edi
+  801093:	89 de                	mov    %ebx,%esi
+  801095:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801097:	85 c0                	test   %eax,%eax
+  801099:	7f 28                	jg     8010c3 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80109b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109e:	5b                   	pop    %ebx
+  80109f:	5e                   	pop    %esi
+  8010a0:	5f                   	pop    %edi
+  8010a1:	5d                   	pop    %ebp
+  8010a2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ae:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010b3:	89 df                	mov    %ebx,%edi
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	8d 35 c0 10 80 00    	lea    0x8010c0,%esi
+  8010be:	0f 34                	sysenter
+  8010c0:	5d                   	pop    %ebp
+		goto out;
+  8010c1:	eb d4                	jmp    801097 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c3:	83 ec 0c             	sub    $0xc,%esp
+  8010c6:	50                   	push   %eax
+  8010c7:	6a 18                	push   $0x18
+  8010c9:	68 eb 38 80 00       	push   $0x8038eb
+  8010ce:	6a 3f                	push   $0x3f
+  8010d0:	68 08 39 80 00       	push   $0x803908
+  8010d5:	e8 88 f0 ff ff       	call   800162 <_panic>
+
+008010da <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	57                   	push   %edi
+  8010de:	56                   	push   %esi
+  8010df:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010e0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010e7:	74 1d                	je     801106 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8010e9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ff:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801101:	5b                   	pop    %ebx
+  801102:	5e                   	pop    %esi
+  801103:	5f                   	pop    %edi
+  801104:	5d                   	pop    %ebp
+  801105:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801106:	8b 55 08             	mov    0x8(%ebp),%edx
+  801109:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801111:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801114:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801117:	55                   	push   %ebp
+  801118:	89 e5                	mov    %esp,%ebp
+  80111a:	8d 35 22 11 80 00    	lea    0x801122,%esi
+  801120:	0f 34                	sysenter
+  801122:	5d                   	pop    %ebp
+		goto out;
+  801123:	eb dc                	jmp    801101 <sys_ipc_try_send+0x27>
+
+00801125 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80112e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801135:	74 21                	je     801158 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801137:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80113c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801141:	8b 55 08             	mov    0x8(%ebp),%edx
+  801144:	89 cb                	mov    %ecx,%ebx
+  801146:	89 cf                	mov    %ecx,%edi
+  801148:	89 ce                	mov    %ecx,%esi
+  80114a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80114c:	85 c0                	test   %eax,%eax
+  80114e:	7f 27                	jg     801177 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801153:	5b                   	pop    %ebx
+  801154:	5e                   	pop    %esi
+  801155:	5f                   	pop    %edi
+  801156:	5d                   	pop    %ebp
+  801157:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801158:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801160:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801165:	89 cb                	mov    %ecx,%ebx
+  801167:	89 cf                	mov    %ecx,%edi
+  801169:	55                   	push   %ebp
+  80116a:	89 e5                	mov    %esp,%ebp
+  80116c:	8d 35 74 11 80 00    	lea    0x801174,%esi
+  801172:	0f 34                	sysenter
+  801174:	5d                   	pop    %ebp
+		goto out;
+  801175:	eb d5                	jmp    80114c <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801177:	83 ec 0c             	sub    $0xc,%esp
+  80117a:	50                   	push   %eax
+  80117b:	6a 0d                	push   $0xd
+  80117d:	68 eb 38 80 00       	push   $0x8038eb
+  801182:	6a 3f                	push   $0x3f
+  801184:	68 08 39 80 00       	push   $0x803908
+  801189:	e8 d4 ef ff ff       	call   800162 <_panic>
+
+0080118e <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801194:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80119b:	74 1b                	je     8011b8 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80119d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ad:	89 df                	mov    %ebx,%edi
+  8011af:	89 de                	mov    %ebx,%esi
+  8011b1:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011c8:	89 df                	mov    %ebx,%edi
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	8d 35 d5 11 80 00    	lea    0x8011d5,%esi
+  8011d3:	0f 34                	sysenter
+  8011d5:	5d                   	pop    %ebp
+		goto out;
+  8011d6:	eb db                	jmp    8011b3 <sys_ipc_recv_until+0x25>
+
+008011d8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011d8:	55                   	push   %ebp
+  8011d9:	89 e5                	mov    %esp,%ebp
+  8011db:	57                   	push   %edi
+  8011dc:	56                   	push   %esi
+  8011dd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011de:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011e5:	74 19                	je     801200 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8011e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011f1:	89 d1                	mov    %edx,%ecx
+  8011f3:	89 d3                	mov    %edx,%ebx
+  8011f5:	89 d7                	mov    %edx,%edi
+  8011f7:	89 d6                	mov    %edx,%esi
+  8011f9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011fb:	5b                   	pop    %ebx
+  8011fc:	5e                   	pop    %esi
+  8011fd:	5f                   	pop    %edi
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801200:	ba 00 00 00 00       	mov    $0x0,%edx
+  801205:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80120a:	89 d1                	mov    %edx,%ecx
+  80120c:	89 d3                	mov    %edx,%ebx
+  80120e:	89 d7                	mov    %edx,%edi
+  801210:	55                   	push   %ebp
+  801211:	89 e5                	mov    %esp,%ebp
+  801213:	8d 35 1b 12 80 00    	lea    0x80121b,%esi
+  801219:	0f 34                	sysenter
+  80121b:	5d                   	pop    %ebp
+		goto out;
+  80121c:	eb dd                	jmp    8011fb <sys_time_msec+0x23>
+
+0080121e <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80121e:	55                   	push   %ebp
+  80121f:	89 e5                	mov    %esp,%ebp
+  801221:	57                   	push   %edi
+  801222:	56                   	push   %esi
+  801223:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801224:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80122b:	74 1a                	je     801247 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80122d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801232:	b8 10 00 00 00       	mov    $0x10,%eax
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	89 cb                	mov    %ecx,%ebx
+  80123c:	89 cf                	mov    %ecx,%edi
+  80123e:	89 ce                	mov    %ecx,%esi
+  801240:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801242:	5b                   	pop    %ebx
+  801243:	5e                   	pop    %esi
+  801244:	5f                   	pop    %edi
+  801245:	5d                   	pop    %ebp
+  801246:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801247:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801254:	89 cb                	mov    %ecx,%ebx
+  801256:	89 cf                	mov    %ecx,%edi
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	8d 35 63 12 80 00    	lea    0x801263,%esi
+  801261:	0f 34                	sysenter
+  801263:	5d                   	pop    %ebp
+		goto out;
+  801264:	eb dc                	jmp    801242 <sys_sleep_until+0x24>
+
+00801266 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801266:	55                   	push   %ebp
+  801267:	89 e5                	mov    %esp,%ebp
+  801269:	57                   	push   %edi
+  80126a:	56                   	push   %esi
+  80126b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80126c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801273:	74 1a                	je     80128f <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801275:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80127a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80127f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801282:	89 cb                	mov    %ecx,%ebx
+  801284:	89 cf                	mov    %ecx,%edi
+  801286:	89 ce                	mov    %ecx,%esi
+  801288:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80128a:	5b                   	pop    %ebx
+  80128b:	5e                   	pop    %esi
+  80128c:	5f                   	pop    %edi
+  80128d:	5d                   	pop    %ebp
+  80128e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80128f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801292:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801297:	b8 11 00 00 00       	mov    $0x11,%eax
+  80129c:	89 cb                	mov    %ecx,%ebx
+  80129e:	89 cf                	mov    %ecx,%edi
+  8012a0:	55                   	push   %ebp
+  8012a1:	89 e5                	mov    %esp,%ebp
+  8012a3:	8d 35 ab 12 80 00    	lea    0x8012ab,%esi
+  8012a9:	0f 34                	sysenter
+  8012ab:	5d                   	pop    %ebp
+		goto out;
+  8012ac:	eb dc                	jmp    80128a <sys_env_print_stats+0x24>
+
+008012ae <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	57                   	push   %edi
+  8012b2:	56                   	push   %esi
+  8012b3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012b4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012bb:	74 1b                	je     8012d8 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cd:	89 df                	mov    %ebx,%edi
+  8012cf:	89 de                	mov    %ebx,%esi
+  8012d1:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012d3:	5b                   	pop    %ebx
+  8012d4:	5e                   	pop    %esi
+  8012d5:	5f                   	pop    %edi
+  8012d6:	5d                   	pop    %ebp
+  8012d7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e3:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012e8:	89 df                	mov    %ebx,%edi
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	8d 35 f5 12 80 00    	lea    0x8012f5,%esi
+  8012f3:	0f 34                	sysenter
+  8012f5:	5d                   	pop    %ebp
+		goto out;
+  8012f6:	eb db                	jmp    8012d3 <sys_perf+0x25>
+
+008012f8 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012fe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801305:	74 19                	je     801320 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801307:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801311:	89 d1                	mov    %edx,%ecx
+  801313:	89 d3                	mov    %edx,%ebx
+  801315:	89 d7                	mov    %edx,%edi
+  801317:	89 d6                	mov    %edx,%esi
+  801319:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80131b:	5b                   	pop    %ebx
+  80131c:	5e                   	pop    %esi
+  80131d:	5f                   	pop    %edi
+  80131e:	5d                   	pop    %ebp
+  80131f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801320:	ba 00 00 00 00       	mov    $0x0,%edx
+  801325:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80132a:	89 d1                	mov    %edx,%ecx
+  80132c:	89 d3                	mov    %edx,%ebx
+  80132e:	89 d7                	mov    %edx,%edi
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	8d 35 3b 13 80 00    	lea    0x80133b,%esi
+  801339:	0f 34                	sysenter
+  80133b:	5d                   	pop    %ebp
+		goto out;
+  80133c:	eb dd                	jmp    80131b <sys_fork+0x23>
+
+0080133e <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	57                   	push   %edi
+  801342:	56                   	push   %esi
+  801343:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801344:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80134b:	74 1c                	je     801369 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80134d:	be 00 00 00 00       	mov    $0x0,%esi
+  801352:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801357:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801360:	89 f7                	mov    %esi,%edi
+  801362:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801369:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801374:	bf 00 00 00 00       	mov    $0x0,%edi
+  801379:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	8d 35 87 13 80 00    	lea    0x801387,%esi
+  801385:	0f 34                	sysenter
+  801387:	5d                   	pop    %ebp
+		goto out;
+  801388:	eb da                	jmp    801364 <sys_thread_create+0x26>
+
+0080138a <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80138a:	55                   	push   %ebp
+  80138b:	89 e5                	mov    %esp,%ebp
+  80138d:	57                   	push   %edi
+  80138e:	56                   	push   %esi
+  80138f:	53                   	push   %ebx
+  801390:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801393:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80139a:	74 24                	je     8013c0 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80139c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013b2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	7f 27                	jg     8013df <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bb:	5b                   	pop    %ebx
+  8013bc:	5e                   	pop    %esi
+  8013bd:	5f                   	pop    %edi
+  8013be:	5d                   	pop    %ebp
+  8013bf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ce:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	8d 35 dc 13 80 00    	lea    0x8013dc,%esi
+  8013da:	0f 34                	sysenter
+  8013dc:	5d                   	pop    %ebp
+		goto out;
+  8013dd:	eb d5                	jmp    8013b4 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013df:	83 ec 0c             	sub    $0xc,%esp
+  8013e2:	50                   	push   %eax
+  8013e3:	6a 1f                	push   $0x1f
+  8013e5:	68 eb 38 80 00       	push   $0x8038eb
+  8013ea:	6a 3f                	push   $0x3f
+  8013ec:	68 08 39 80 00       	push   $0x803908
+  8013f1:	e8 6c ed ff ff       	call   800162 <_panic>
+
+008013f6 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	57                   	push   %edi
+  8013fa:	56                   	push   %esi
+  8013fb:	53                   	push   %ebx
+  8013fc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013ff:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801406:	74 23                	je     80142b <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801408:	be 00 00 00 00       	mov    $0x0,%esi
+  80140d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801412:	8b 55 08             	mov    0x8(%ebp),%edx
+  801415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801418:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80141b:	89 f7                	mov    %esi,%edi
+  80141d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80141f:	85 c0                	test   %eax,%eax
+  801421:	7f 29                	jg     80144c <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801426:	5b                   	pop    %ebx
+  801427:	5e                   	pop    %esi
+  801428:	5f                   	pop    %edi
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80142b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801431:	b8 20 00 00 00       	mov    $0x20,%eax
+  801436:	bf 00 00 00 00       	mov    $0x0,%edi
+  80143b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	8d 35 49 14 80 00    	lea    0x801449,%esi
+  801447:	0f 34                	sysenter
+  801449:	5d                   	pop    %ebp
+		goto out;
+  80144a:	eb d3                	jmp    80141f <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80144c:	83 ec 0c             	sub    $0xc,%esp
+  80144f:	50                   	push   %eax
+  801450:	6a 20                	push   $0x20
+  801452:	68 eb 38 80 00       	push   $0x8038eb
+  801457:	6a 3f                	push   $0x3f
+  801459:	68 08 39 80 00       	push   $0x803908
+  80145e:	e8 ff ec ff ff       	call   800162 <_panic>
+
+00801463 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801463:	55                   	push   %ebp
+  801464:	89 e5                	mov    %esp,%ebp
+  801466:	57                   	push   %edi
+  801467:	56                   	push   %esi
+  801468:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801469:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801470:	74 1b                	je     80148d <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801472:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801477:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80147c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80147f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801482:	89 df                	mov    %ebx,%edi
+  801484:	89 de                	mov    %ebx,%esi
+  801486:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801488:	5b                   	pop    %ebx
+  801489:	5e                   	pop    %esi
+  80148a:	5f                   	pop    %edi
+  80148b:	5d                   	pop    %ebp
+  80148c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80148d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801492:	8b 55 08             	mov    0x8(%ebp),%edx
+  801495:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801498:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80149d:	89 df                	mov    %ebx,%edi
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	8d 35 aa 14 80 00    	lea    0x8014aa,%esi
+  8014a8:	0f 34                	sysenter
+  8014aa:	5d                   	pop    %ebp
+		goto out;
+  8014ab:	eb db                	jmp    801488 <sys_batch+0x25>
+
+008014ad <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014ad:	55                   	push   %ebp
+  8014ae:	89 e5                	mov    %esp,%ebp
+  8014b0:	57                   	push   %edi
+  8014b1:	56                   	push   %esi
+  8014b2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014b3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ba:	74 1a                	je     8014d6 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8014bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c9:	89 cb                	mov    %ecx,%ebx
+  8014cb:	89 cf                	mov    %ecx,%edi
+  8014cd:	89 ce                	mov    %ecx,%esi
+  8014cf:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014d1:	5b                   	pop    %ebx
+  8014d2:	5e                   	pop    %esi
+  8014d3:	5f                   	pop    %edi
+  8014d4:	5d                   	pop    %ebp
+  8014d5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014de:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014e3:	89 cb                	mov    %ecx,%ebx
+  8014e5:	89 cf                	mov    %ecx,%edi
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+  8014ea:	8d 35 f2 14 80 00    	lea    0x8014f2,%esi
+  8014f0:	0f 34                	sysenter
+  8014f2:	5d                   	pop    %ebp
+		goto out;
+  8014f3:	eb dc                	jmp    8014d1 <sys_trace_ctl+0x24>
+
+008014f5 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014f5:	55                   	push   %ebp
+  8014f6:	89 e5                	mov    %esp,%ebp
+  8014f8:	57                   	push   %edi
+  8014f9:	56                   	push   %esi
+  8014fa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014fb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801502:	74 1c                	je     801520 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801504:	be 00 00 00 00       	mov    $0x0,%esi
+  801509:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80150e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801511:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801514:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801517:	89 f7                	mov    %esi,%edi
+  801519:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80151b:	5b                   	pop    %ebx
+  80151c:	5e                   	pop    %esi
+  80151d:	5f                   	pop    %edi
+  80151e:	5d                   	pop    %ebp
+  80151f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801520:	8b 55 08             	mov    0x8(%ebp),%edx
+  801523:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801526:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80152b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801530:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	8d 35 3e 15 80 00    	lea    0x80153e,%esi
+  80153c:	0f 34                	sysenter
+  80153e:	5d                   	pop    %ebp
+		goto out;
+  80153f:	eb da                	jmp    80151b <sys_trace_read+0x26>
+
+00801541 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801547:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80154e:	74 1c                	je     80156c <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801550:	be 00 00 00 00       	mov    $0x0,%esi
+  801555:	b8 21 00 00 00       	mov    $0x21,%eax
+  80155a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801560:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801563:	89 f7                	mov    %esi,%edi
+  801565:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801567:	5b                   	pop    %ebx
+  801568:	5e                   	pop    %esi
+  801569:	5f                   	pop    %edi
+  80156a:	5d                   	pop    %ebp
+  80156b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80156c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801572:	b8 21 00 00 00       	mov    $0x21,%eax
+  801577:	bf 00 00 00 00       	mov    $0x0,%edi
+  80157c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157f:	55                   	push   %ebp
+  801580:	89 e5                	mov    %esp,%ebp
+  801582:	8d 35 8a 15 80 00    	lea    0x80158a,%esi
+  801588:	0f 34                	sysenter
+  80158a:	5d                   	pop    %ebp
+		goto out;
+  80158b:	eb da                	jmp    801567 <sys_meminfo+0x26>
+
+0080158d <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80158d:	55                   	push   %ebp
+  80158e:	89 e5                	mov    %esp,%ebp
+  801590:	57                   	push   %edi
+  801591:	56                   	push   %esi
+  801592:	53                   	push   %ebx
+  801593:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801596:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80159a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015a1:	74 1f                	je     8015c2 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a8:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b0:	89 df                	mov    %ebx,%edi
+  8015b2:	89 de                	mov    %ebx,%esi
+  8015b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015b6:	85 c0                	test   %eax,%eax
+  8015b8:	7f 25                	jg     8015df <sys_env_set_ksm+0x52>
+}
+  8015ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bd:	5b                   	pop    %ebx
+  8015be:	5e                   	pop    %esi
+  8015bf:	5f                   	pop    %edi
+  8015c0:	5d                   	pop    %ebp
+  8015c1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ca:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015cf:	89 df                	mov    %ebx,%edi
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	8d 35 dc 15 80 00    	lea    0x8015dc,%esi
+  8015da:	0f 34                	sysenter
+  8015dc:	5d                   	pop    %ebp
+		goto out;
+  8015dd:	eb d7                	jmp    8015b6 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015df:	83 ec 0c             	sub    $0xc,%esp
+  8015e2:	50                   	push   %eax
+  8015e3:	6a 22                	push   $0x22
+  8015e5:	68 eb 38 80 00       	push   $0x8038eb
+  8015ea:	6a 3f                	push   $0x3f
+  8015ec:	68 08 39 80 00       	push   $0x803908
+  8015f1:	e8 6c eb ff ff       	call   800162 <_panic>
+
+008015f6 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015f6:	55                   	push   %ebp
+  8015f7:	89 e5                	mov    %esp,%ebp
+  8015f9:	57                   	push   %edi
+  8015fa:	56                   	push   %esi
+  8015fb:	53                   	push   %ebx
+  8015fc:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015ff:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801602:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801609:	74 24                	je     80162f <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80160b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801610:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801615:	89 cb                	mov    %ecx,%ebx
+  801617:	89 cf                	mov    %ecx,%edi
+  801619:	89 ce                	mov    %ecx,%esi
+  80161b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80161d:	85 c0                	test   %eax,%eax
+  80161f:	7f 2a                	jg     80164b <sys_time_nsec+0x55>
+	return ns;
+}
+  801621:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801624:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80162a:	5b                   	pop    %ebx
+  80162b:	5e                   	pop    %esi
+  80162c:	5f                   	pop    %edi
+  80162d:	5d                   	pop    %ebp
+  80162e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80162f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801634:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801639:	89 cb                	mov    %ecx,%ebx
+  80163b:	89 cf                	mov    %ecx,%edi
+  80163d:	55                   	push   %ebp
+  80163e:	89 e5                	mov    %esp,%ebp
+  801640:	8d 35 48 16 80 00    	lea    0x801648,%esi
+  801646:	0f 34                	sysenter
+  801648:	5d                   	pop    %ebp
+		goto out;
+  801649:	eb d2                	jmp    80161d <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80164b:	83 ec 0c             	sub    $0xc,%esp
+  80164e:	50                   	push   %eax
+  80164f:	6a 0f                	push   $0xf
+  801651:	68 eb 38 80 00       	push   $0x8038eb
+  801656:	6a 3f                	push   $0x3f
+  801658:	68 08 39 80 00       	push   $0x803908
+  80165d:	e8 00 eb ff ff       	call   800162 <_panic>
+
+00801662 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801662:	55                   	push   %ebp
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	57                   	push   %edi
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80166b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801672:	74 22                	je     801696 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801674:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801679:	b8 12 00 00 00       	mov    $0x12,%eax
+  80167e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801681:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801684:	89 df                	mov    %ebx,%edi
+  801686:	89 de                	mov    %ebx,%esi
+  801688:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	7f 28                	jg     8016b6 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80168e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801691:	5b                   	pop    %ebx
+  801692:	5e                   	pop    %esi
+  801693:	5f                   	pop    %edi
+  801694:	5d                   	pop    %ebp
+  801695:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801696:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016a6:	89 df                	mov    %ebx,%edi
+  8016a8:	55                   	push   %ebp
+  8016a9:	89 e5                	mov    %esp,%ebp
+  8016ab:	8d 35 b3 16 80 00    	lea    0x8016b3,%esi
+  8016b1:	0f 34                	sysenter
+  8016b3:	5d                   	pop    %ebp
+		goto out;
+  8016b4:	eb d4                	jmp    80168a <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016b6:	83 ec 0c             	sub    $0xc,%esp
+  8016b9:	50                   	push   %eax
+  8016ba:	6a 12                	push   $0x12
+  8016bc:	68 eb 38 80 00       	push   $0x8038eb
+  8016c1:	6a 3f                	push   $0x3f
+  8016c3:	68 08 39 80 00       	push   $0x803908
+  8016c8:	e8 95 ea ff ff       	call   800162 <_panic>
+
+008016cd <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	57                   	push   %edi
+  8016d1:	56                   	push   %esi
+  8016d2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016d3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016da:	74 1b                	je     8016f7 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8016dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ec:	89 df                	mov    %ebx,%edi
+  8016ee:	89 de                	mov    %ebx,%esi
+  8016f0:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5f                   	pop    %edi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801702:	b8 13 00 00 00       	mov    $0x13,%eax
+  801707:	89 df                	mov    %ebx,%edi
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	8d 35 14 17 80 00    	lea    0x801714,%esi
+  801712:	0f 34                	sysenter
+  801714:	5d                   	pop    %ebp
+		goto out;
+  801715:	eb db                	jmp    8016f2 <sys_e1000_receive+0x25>
+
+00801717 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	57                   	push   %edi
+  80171b:	56                   	push   %esi
+  80171c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80171d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801724:	74 1b                	je     801741 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801726:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801730:	8b 55 08             	mov    0x8(%ebp),%edx
+  801733:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801736:	89 df                	mov    %ebx,%edi
+  801738:	89 de                	mov    %ebx,%esi
+  80173a:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80173c:	5b                   	pop    %ebx
+  80173d:	5e                   	pop    %esi
+  80173e:	5f                   	pop    %edi
+  80173f:	5d                   	pop    %ebp
+  801740:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801741:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801746:	8b 55 08             	mov    0x8(%ebp),%edx
+  801749:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801751:	89 df                	mov    %ebx,%edi
+  801753:	55                   	push   %ebp
+  801754:	89 e5                	mov    %esp,%ebp
+  801756:	8d 35 5e 17 80 00    	lea    0x80175e,%esi
+  80175c:	0f 34                	sysenter
+  80175e:	5d                   	pop    %ebp
+		goto out;
+  80175f:	eb db                	jmp    80173c <sys_e1000_read_hwaddr+0x25>
+
+00801761 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	57                   	push   %edi
+  801765:	56                   	push   %esi
+  801766:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801767:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80176e:	74 1a                	je     80178a <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801770:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801775:	b8 15 00 00 00       	mov    $0x15,%eax
+  80177a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177d:	89 cb                	mov    %ecx,%ebx
+  80177f:	89 cf                	mov    %ecx,%edi
+  801781:	89 ce                	mov    %ecx,%esi
+  801783:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801785:	5b                   	pop    %ebx
+  801786:	5e                   	pop    %esi
+  801787:	5f                   	pop    %edi
+  801788:	5d                   	pop    %ebp
+  801789:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80178a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801792:	b8 15 00 00 00       	mov    $0x15,%eax
+  801797:	89 cb                	mov    %ecx,%ebx
+  801799:	89 cf                	mov    %ecx,%edi
+  80179b:	55                   	push   %ebp
+  80179c:	89 e5                	mov    %esp,%ebp
+  80179e:	8d 35 a6 17 80 00    	lea    0x8017a6,%esi
+  8017a4:	0f 34                	sysenter
+  8017a6:	5d                   	pop    %ebp
+		goto out;
+  8017a7:	eb dc                	jmp    801785 <sys_sb16_read_version+0x24>
+
+008017a9 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+  8017ac:	57                   	push   %edi
+  8017ad:	56                   	push   %esi
+  8017ae:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017af:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017b6:	74 1b                	je     8017d3 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bd:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c8:	89 df                	mov    %ebx,%edi
+  8017ca:	89 de                	mov    %ebx,%esi
+  8017cc:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017ce:	5b                   	pop    %ebx
+  8017cf:	5e                   	pop    %esi
+  8017d0:	5f                   	pop    %edi
+  8017d1:	5d                   	pop    %ebp
+  8017d2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017de:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017e3:	89 df                	mov    %ebx,%edi
+  8017e5:	55                   	push   %ebp
+  8017e6:	89 e5                	mov    %esp,%ebp
+  8017e8:	8d 35 f0 17 80 00    	lea    0x8017f0,%esi
+  8017ee:	0f 34                	sysenter
+  8017f0:	5d                   	pop    %ebp
+		goto out;
+  8017f1:	eb db                	jmp    8017ce <sys_sb16_play+0x25>
+
+008017f3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f9:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017fe:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801801:	5d                   	pop    %ebp
+  801802:	c3                   	ret
+
+00801803 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801803:	55                   	push   %ebp
+  801804:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801806:	8b 45 08             	mov    0x8(%ebp),%eax
+  801809:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80180e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801813:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801818:	5d                   	pop    %ebp
+  801819:	c3                   	ret
+
+0080181a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80181a:	55                   	push   %ebp
+  80181b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80181d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801822:	eb 02                	jmp    801826 <fd_alloc+0xc>
+  801824:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801826:	89 c2                	mov    %eax,%edx
+  801828:	c1 ea 16             	shr    $0x16,%edx
+  80182b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801832:	f6 c2 01             	test   $0x1,%dl
+  801835:	74 2b                	je     801862 <fd_alloc+0x48>
+  801837:	89 c2                	mov    %eax,%edx
+  801839:	c1 ea 0c             	shr    $0xc,%edx
+  80183c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801843:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801849:	f6 c1 01             	test   $0x1,%cl
+  80184c:	74 14                	je     801862 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80184e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801854:	75 ce                	jne    801824 <fd_alloc+0xa>
+  801856:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80185b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801860:	eb 05                	jmp    801867 <fd_alloc+0x4d>
+			return 0;
+  801862:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801867:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186a:	89 02                	mov    %eax,(%edx)
+}
+  80186c:	89 c8                	mov    %ecx,%eax
+  80186e:	5d                   	pop    %ebp
+  80186f:	c3                   	ret
+
+00801870 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801870:	55                   	push   %ebp
+  801871:	89 e5                	mov    %esp,%ebp
+  801873:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801876:	83 f8 1f             	cmp    $0x1f,%eax
+  801879:	77 30                	ja     8018ab <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80187b:	c1 e0 0c             	shl    $0xc,%eax
+  80187e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801883:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801889:	f6 c2 01             	test   $0x1,%dl
+  80188c:	74 24                	je     8018b2 <fd_lookup+0x42>
+  80188e:	89 c2                	mov    %eax,%edx
+  801890:	c1 ea 0c             	shr    $0xc,%edx
+  801893:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80189a:	f6 c2 01             	test   $0x1,%dl
+  80189d:	74 1a                	je     8018b9 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80189f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018a2:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a9:	5d                   	pop    %ebp
+  8018aa:	c3                   	ret
+		return -E_INVAL;
+  8018ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b0:	eb f7                	jmp    8018a9 <fd_lookup+0x39>
+		return -E_INVAL;
+  8018b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b7:	eb f0                	jmp    8018a9 <fd_lookup+0x39>
+  8018b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018be:	eb e9                	jmp    8018a9 <fd_lookup+0x39>
+
+008018c0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 04             	sub    $0x4,%esp
+  8018c7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cf:	eb 03                	jmp    8018d4 <dev_lookup+0x14>
+  8018d1:	83 c0 01             	add    $0x1,%eax
+  8018d4:	8b 1c 85 94 39 80 00 	mov    0x803994(,%eax,4),%ebx
+  8018db:	85 db                	test   %ebx,%ebx
+  8018dd:	74 0b                	je     8018ea <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018df:	39 13                	cmp    %edx,(%ebx)
+  8018e1:	75 ee                	jne    8018d1 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e8:	eb 2e                	jmp    801918 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8018ea:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018ec:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8018f1:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018f7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018fc:	76 24                	jbe    801922 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018fe:	8b 41 48             	mov    0x48(%ecx),%eax
+  801901:	83 ec 04             	sub    $0x4,%esp
+  801904:	52                   	push   %edx
+  801905:	50                   	push   %eax
+  801906:	68 18 39 80 00       	push   $0x803918
+  80190b:	e8 2d e9 ff ff       	call   80023d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801910:	83 c4 10             	add    $0x10,%esp
+  801913:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801918:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80191b:	89 1a                	mov    %ebx,(%edx)
+}
+  80191d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801920:	c9                   	leave
+  801921:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801922:	c1 e8 10             	shr    $0x10,%eax
+  801925:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80192b:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801931:	eb cb                	jmp    8018fe <dev_lookup+0x3e>
+
+00801933 <fd_close>:
+{
+  801933:	55                   	push   %ebp
+  801934:	89 e5                	mov    %esp,%ebp
+  801936:	57                   	push   %edi
+  801937:	56                   	push   %esi
+  801938:	53                   	push   %ebx
+  801939:	83 ec 24             	sub    $0x24,%esp
+  80193c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80193f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801942:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801945:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801946:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80194c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80194f:	50                   	push   %eax
+  801950:	e8 1b ff ff ff       	call   801870 <fd_lookup>
+  801955:	89 c3                	mov    %eax,%ebx
+  801957:	83 c4 10             	add    $0x10,%esp
+  80195a:	85 c0                	test   %eax,%eax
+  80195c:	78 05                	js     801963 <fd_close+0x30>
+	    || fd != fd2)
+  80195e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801961:	74 16                	je     801979 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801963:	89 f8                	mov    %edi,%eax
+  801965:	84 c0                	test   %al,%al
+  801967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80196c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80196f:	89 d8                	mov    %ebx,%eax
+  801971:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801974:	5b                   	pop    %ebx
+  801975:	5e                   	pop    %esi
+  801976:	5f                   	pop    %edi
+  801977:	5d                   	pop    %ebp
+  801978:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801979:	83 ec 08             	sub    $0x8,%esp
+  80197c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80197f:	50                   	push   %eax
+  801980:	ff 36                	push   (%esi)
+  801982:	e8 39 ff ff ff       	call   8018c0 <dev_lookup>
+  801987:	89 c3                	mov    %eax,%ebx
+  801989:	83 c4 10             	add    $0x10,%esp
+  80198c:	85 c0                	test   %eax,%eax
+  80198e:	78 1a                	js     8019aa <fd_close+0x77>
+		if (dev->dev_close)
+  801990:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801993:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801996:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80199b:	85 c0                	test   %eax,%eax
+  80199d:	74 0b                	je     8019aa <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80199f:	83 ec 0c             	sub    $0xc,%esp
+  8019a2:	56                   	push   %esi
+  8019a3:	ff d0                	call   *%eax
+  8019a5:	89 c3                	mov    %eax,%ebx
+  8019a7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8019aa:	83 ec 08             	sub    $0x8,%esp
+  8019ad:	56                   	push   %esi
+  8019ae:	6a 00                	push   $0x0
+  8019b0:	e8 a3 f4 ff ff       	call   800e58 <sys_page_unmap>
+	return r;
+  8019b5:	83 c4 10             	add    $0x10,%esp
+  8019b8:	eb b5                	jmp    80196f <fd_close+0x3c>
+
+008019ba <close>:
+
+int
+close(int fdnum)
+{
+  8019ba:	55                   	push   %ebp
+  8019bb:	89 e5                	mov    %esp,%ebp
+  8019bd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c3:	50                   	push   %eax
+  8019c4:	ff 75 08             	push   0x8(%ebp)
+  8019c7:	e8 a4 fe ff ff       	call   801870 <fd_lookup>
+  8019cc:	83 c4 10             	add    $0x10,%esp
+  8019cf:	85 c0                	test   %eax,%eax
+  8019d1:	79 02                	jns    8019d5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8019d3:	c9                   	leave
+  8019d4:	c3                   	ret
+		return fd_close(fd, 1);
+  8019d5:	83 ec 08             	sub    $0x8,%esp
+  8019d8:	6a 01                	push   $0x1
+  8019da:	ff 75 f4             	push   -0xc(%ebp)
+  8019dd:	e8 51 ff ff ff       	call   801933 <fd_close>
+  8019e2:	83 c4 10             	add    $0x10,%esp
+  8019e5:	eb ec                	jmp    8019d3 <close+0x19>
+
+008019e7 <close_all>:
+
+void
+close_all(void)
+{
+  8019e7:	55                   	push   %ebp
+  8019e8:	89 e5                	mov    %esp,%ebp
+  8019ea:	53                   	push   %ebx
+  8019eb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019f3:	83 ec 0c             	sub    $0xc,%esp
+  8019f6:	53                   	push   %ebx
+  8019f7:	e8 be ff ff ff       	call   8019ba <close>
+	for (i = 0; i < MAXFD; i++)
+  8019fc:	83 c3 01             	add    $0x1,%ebx
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	83 fb 20             	cmp    $0x20,%ebx
+  801a05:	75 ec                	jne    8019f3 <close_all+0xc>
+}
+  801a07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a0a:	c9                   	leave
+  801a0b:	c3                   	ret
+
+00801a0c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a0c:	55                   	push   %ebp
+  801a0d:	89 e5                	mov    %esp,%ebp
+  801a0f:	57                   	push   %edi
+  801a10:	56                   	push   %esi
+  801a11:	53                   	push   %ebx
+  801a12:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a15:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a18:	50                   	push   %eax
+  801a19:	ff 75 08             	push   0x8(%ebp)
+  801a1c:	e8 4f fe ff ff       	call   801870 <fd_lookup>
+  801a21:	89 c3                	mov    %eax,%ebx
+  801a23:	83 c4 10             	add    $0x10,%esp
+  801a26:	85 c0                	test   %eax,%eax
+  801a28:	78 7f                	js     801aa9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a2a:	83 ec 0c             	sub    $0xc,%esp
+  801a2d:	ff 75 0c             	push   0xc(%ebp)
+  801a30:	e8 85 ff ff ff       	call   8019ba <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a35:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a38:	c1 e6 0c             	shl    $0xc,%esi
+  801a3b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a41:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a44:	89 3c 24             	mov    %edi,(%esp)
+  801a47:	e8 b7 fd ff ff       	call   801803 <fd2data>
+  801a4c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a4e:	89 34 24             	mov    %esi,(%esp)
+  801a51:	e8 ad fd ff ff       	call   801803 <fd2data>
+  801a56:	83 c4 10             	add    $0x10,%esp
+  801a59:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a5c:	89 d8                	mov    %ebx,%eax
+  801a5e:	c1 e8 16             	shr    $0x16,%eax
+  801a61:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a68:	a8 01                	test   $0x1,%al
+  801a6a:	74 11                	je     801a7d <dup+0x71>
+  801a6c:	89 d8                	mov    %ebx,%eax
+  801a6e:	c1 e8 0c             	shr    $0xc,%eax
+  801a71:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a78:	f6 c2 01             	test   $0x1,%dl
+  801a7b:	75 36                	jne    801ab3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a7d:	89 f8                	mov    %edi,%eax
+  801a7f:	c1 e8 0c             	shr    $0xc,%eax
+  801a82:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a89:	83 ec 0c             	sub    $0xc,%esp
+  801a8c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a91:	50                   	push   %eax
+  801a92:	56                   	push   %esi
+  801a93:	6a 00                	push   $0x0
+  801a95:	57                   	push   %edi
+  801a96:	6a 00                	push   $0x0
+  801a98:	e8 4d f3 ff ff       	call   800dea <sys_page_map>
+  801a9d:	89 c3                	mov    %eax,%ebx
+  801a9f:	83 c4 20             	add    $0x20,%esp
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	78 33                	js     801ad9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801aa6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801aa9:	89 d8                	mov    %ebx,%eax
+  801aab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aae:	5b                   	pop    %ebx
+  801aaf:	5e                   	pop    %esi
+  801ab0:	5f                   	pop    %edi
+  801ab1:	5d                   	pop    %ebp
+  801ab2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801ab3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aba:	83 ec 0c             	sub    $0xc,%esp
+  801abd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ac2:	50                   	push   %eax
+  801ac3:	ff 75 d4             	push   -0x2c(%ebp)
+  801ac6:	6a 00                	push   $0x0
+  801ac8:	53                   	push   %ebx
+  801ac9:	6a 00                	push   $0x0
+  801acb:	e8 1a f3 ff ff       	call   800dea <sys_page_map>
+  801ad0:	89 c3                	mov    %eax,%ebx
+  801ad2:	83 c4 20             	add    $0x20,%esp
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	79 a4                	jns    801a7d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ad9:	83 ec 08             	sub    $0x8,%esp
+  801adc:	56                   	push   %esi
+  801add:	6a 00                	push   $0x0
+  801adf:	e8 74 f3 ff ff       	call   800e58 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ae4:	83 c4 08             	add    $0x8,%esp
+  801ae7:	ff 75 d4             	push   -0x2c(%ebp)
+  801aea:	6a 00                	push   $0x0
+  801aec:	e8 67 f3 ff ff       	call   800e58 <sys_page_unmap>
+	return r;
+  801af1:	83 c4 10             	add    $0x10,%esp
+  801af4:	eb b3                	jmp    801aa9 <dup+0x9d>
+
+00801af6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801af6:	55                   	push   %ebp
+  801af7:	89 e5                	mov    %esp,%ebp
+  801af9:	56                   	push   %esi
+  801afa:	53                   	push   %ebx
+  801afb:	83 ec 18             	sub    $0x18,%esp
+  801afe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b01:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b04:	50                   	push   %eax
+  801b05:	53                   	push   %ebx
+  801b06:	e8 65 fd ff ff       	call   801870 <fd_lookup>
+  801b0b:	83 c4 10             	add    $0x10,%esp
+  801b0e:	85 c0                	test   %eax,%eax
+  801b10:	78 3c                	js     801b4e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b12:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b15:	83 ec 08             	sub    $0x8,%esp
+  801b18:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b1b:	50                   	push   %eax
+  801b1c:	ff 36                	push   (%esi)
+  801b1e:	e8 9d fd ff ff       	call   8018c0 <dev_lookup>
+  801b23:	83 c4 10             	add    $0x10,%esp
+  801b26:	85 c0                	test   %eax,%eax
+  801b28:	78 24                	js     801b4e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b2a:	8b 46 08             	mov    0x8(%esi),%eax
+  801b2d:	83 e0 03             	and    $0x3,%eax
+  801b30:	83 f8 01             	cmp    $0x1,%eax
+  801b33:	74 20                	je     801b55 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b38:	8b 40 08             	mov    0x8(%eax),%eax
+  801b3b:	85 c0                	test   %eax,%eax
+  801b3d:	74 57                	je     801b96 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b3f:	83 ec 04             	sub    $0x4,%esp
+  801b42:	ff 75 10             	push   0x10(%ebp)
+  801b45:	ff 75 0c             	push   0xc(%ebp)
+  801b48:	56                   	push   %esi
+  801b49:	ff d0                	call   *%eax
+  801b4b:	83 c4 10             	add    $0x10,%esp
+}
+  801b4e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b51:	5b                   	pop    %ebx
+  801b52:	5e                   	pop    %esi
+  801b53:	5d                   	pop    %ebp
+  801b54:	c3                   	ret
+  801b55:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b57:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b5c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b62:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b67:	76 1c                	jbe    801b85 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b69:	8b 42 48             	mov    0x48(%edx),%eax
+  801b6c:	83 ec 04             	sub    $0x4,%esp
+  801b6f:	53                   	push   %ebx
+  801b70:	50                   	push   %eax
+  801b71:	68 59 39 80 00       	push   $0x803959
+  801b76:	e8 c2 e6 ff ff       	call   80023d <cprintf>
+		return -E_INVAL;
+  801b7b:	83 c4 10             	add    $0x10,%esp
+  801b7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b83:	eb c9                	jmp    801b4e <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b85:	c1 e8 10             	shr    $0x10,%eax
+  801b88:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b8e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b94:	eb d3                	jmp    801b69 <read+0x73>
+		return -E_NOT_SUPP;
+  801b96:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b9b:	eb b1                	jmp    801b4e <read+0x58>
+
+00801b9d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b9d:	55                   	push   %ebp
+  801b9e:	89 e5                	mov    %esp,%ebp
+  801ba0:	57                   	push   %edi
+  801ba1:	56                   	push   %esi
+  801ba2:	53                   	push   %ebx
+  801ba3:	83 ec 0c             	sub    $0xc,%esp
+  801ba6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ba9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801bac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb1:	eb 02                	jmp    801bb5 <readn+0x18>
+  801bb3:	01 c3                	add    %eax,%ebx
+  801bb5:	39 f3                	cmp    %esi,%ebx
+  801bb7:	73 21                	jae    801bda <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bb9:	83 ec 04             	sub    $0x4,%esp
+  801bbc:	89 f0                	mov    %esi,%eax
+  801bbe:	29 d8                	sub    %ebx,%eax
+  801bc0:	50                   	push   %eax
+  801bc1:	89 d8                	mov    %ebx,%eax
+  801bc3:	03 45 0c             	add    0xc(%ebp),%eax
+  801bc6:	50                   	push   %eax
+  801bc7:	57                   	push   %edi
+  801bc8:	e8 29 ff ff ff       	call   801af6 <read>
+		if (m < 0)
+  801bcd:	83 c4 10             	add    $0x10,%esp
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	78 04                	js     801bd8 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801bd4:	75 dd                	jne    801bb3 <readn+0x16>
+  801bd6:	eb 02                	jmp    801bda <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bd8:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801bda:	89 d8                	mov    %ebx,%eax
+  801bdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bdf:	5b                   	pop    %ebx
+  801be0:	5e                   	pop    %esi
+  801be1:	5f                   	pop    %edi
+  801be2:	5d                   	pop    %ebp
+  801be3:	c3                   	ret
+
+00801be4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+  801be7:	56                   	push   %esi
+  801be8:	53                   	push   %ebx
+  801be9:	83 ec 18             	sub    $0x18,%esp
+  801bec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bf2:	50                   	push   %eax
+  801bf3:	53                   	push   %ebx
+  801bf4:	e8 77 fc ff ff       	call   801870 <fd_lookup>
+  801bf9:	83 c4 10             	add    $0x10,%esp
+  801bfc:	85 c0                	test   %eax,%eax
+  801bfe:	78 37                	js     801c37 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c00:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c03:	83 ec 08             	sub    $0x8,%esp
+  801c06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c09:	50                   	push   %eax
+  801c0a:	ff 36                	push   (%esi)
+  801c0c:	e8 af fc ff ff       	call   8018c0 <dev_lookup>
+  801c11:	83 c4 10             	add    $0x10,%esp
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	78 1f                	js     801c37 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c18:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c1c:	74 20                	je     801c3e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c21:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c24:	85 c0                	test   %eax,%eax
+  801c26:	74 57                	je     801c7f <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c28:	83 ec 04             	sub    $0x4,%esp
+  801c2b:	ff 75 10             	push   0x10(%ebp)
+  801c2e:	ff 75 0c             	push   0xc(%ebp)
+  801c31:	56                   	push   %esi
+  801c32:	ff d0                	call   *%eax
+  801c34:	83 c4 10             	add    $0x10,%esp
+}
+  801c37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3a:	5b                   	pop    %ebx
+  801c3b:	5e                   	pop    %esi
+  801c3c:	5d                   	pop    %ebp
+  801c3d:	c3                   	ret
+  801c3e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c40:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c45:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c4b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c50:	76 1c                	jbe    801c6e <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c52:	8b 42 48             	mov    0x48(%edx),%eax
+  801c55:	83 ec 04             	sub    $0x4,%esp
+  801c58:	53                   	push   %ebx
+  801c59:	50                   	push   %eax
+  801c5a:	68 75 39 80 00       	push   $0x803975
+  801c5f:	e8 d9 e5 ff ff       	call   80023d <cprintf>
+		return -E_INVAL;
+  801c64:	83 c4 10             	add    $0x10,%esp
+  801c67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c6c:	eb c9                	jmp    801c37 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c6e:	c1 e8 10             	shr    $0x10,%eax
+  801c71:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c77:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c7d:	eb d3                	jmp    801c52 <write+0x6e>
+		return -E_NOT_SUPP;
+  801c7f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c84:	eb b1                	jmp    801c37 <write+0x53>
+
+00801c86 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c86:	55                   	push   %ebp
+  801c87:	89 e5                	mov    %esp,%ebp
+  801c89:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c8c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8f:	50                   	push   %eax
+  801c90:	ff 75 08             	push   0x8(%ebp)
+  801c93:	e8 d8 fb ff ff       	call   801870 <fd_lookup>
+  801c98:	83 c4 10             	add    $0x10,%esp
+  801c9b:	85 c0                	test   %eax,%eax
+  801c9d:	78 0e                	js     801cad <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ca2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca5:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cad:	c9                   	leave
+  801cae:	c3                   	ret
+
+00801caf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801caf:	55                   	push   %ebp
+  801cb0:	89 e5                	mov    %esp,%ebp
+  801cb2:	56                   	push   %esi
+  801cb3:	53                   	push   %ebx
+  801cb4:	83 ec 18             	sub    $0x18,%esp
+  801cb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cbd:	50                   	push   %eax
+  801cbe:	53                   	push   %ebx
+  801cbf:	e8 ac fb ff ff       	call   801870 <fd_lookup>
+  801cc4:	83 c4 10             	add    $0x10,%esp
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	78 34                	js     801cff <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ccb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cce:	83 ec 08             	sub    $0x8,%esp
+  801cd1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd4:	50                   	push   %eax
+  801cd5:	ff 36                	push   (%esi)
+  801cd7:	e8 e4 fb ff ff       	call   8018c0 <dev_lookup>
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	78 1c                	js     801cff <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ce3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ce7:	74 1d                	je     801d06 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801ce9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cec:	8b 40 18             	mov    0x18(%eax),%eax
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	74 54                	je     801d47 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801cf3:	83 ec 08             	sub    $0x8,%esp
+  801cf6:	ff 75 0c             	push   0xc(%ebp)
+  801cf9:	56                   	push   %esi
+  801cfa:	ff d0                	call   *%eax
+  801cfc:	83 c4 10             	add    $0x10,%esp
+}
+  801cff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d02:	5b                   	pop    %ebx
+  801d03:	5e                   	pop    %esi
+  801d04:	5d                   	pop    %ebp
+  801d05:	c3                   	ret
+  801d06:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d08:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d0d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d13:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d18:	76 1c                	jbe    801d36 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801d1a:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d1d:	83 ec 04             	sub    $0x4,%esp
+  801d20:	53                   	push   %ebx
+  801d21:	50                   	push   %eax
+  801d22:	68 38 39 80 00       	push   $0x803938
+  801d27:	e8 11 e5 ff ff       	call   80023d <cprintf>
+		return -E_INVAL;
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d34:	eb c9                	jmp    801cff <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d36:	c1 e8 10             	shr    $0x10,%eax
+  801d39:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d3f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d45:	eb d3                	jmp    801d1a <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801d47:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d4c:	eb b1                	jmp    801cff <ftruncate+0x50>
+
+00801d4e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d4e:	55                   	push   %ebp
+  801d4f:	89 e5                	mov    %esp,%ebp
+  801d51:	56                   	push   %esi
+  801d52:	53                   	push   %ebx
+  801d53:	83 ec 18             	sub    $0x18,%esp
+  801d56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d5c:	50                   	push   %eax
+  801d5d:	ff 75 08             	push   0x8(%ebp)
+  801d60:	e8 0b fb ff ff       	call   801870 <fd_lookup>
+  801d65:	83 c4 10             	add    $0x10,%esp
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 49                	js     801db5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d6c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d6f:	83 ec 08             	sub    $0x8,%esp
+  801d72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d75:	50                   	push   %eax
+  801d76:	ff 36                	push   (%esi)
+  801d78:	e8 43 fb ff ff       	call   8018c0 <dev_lookup>
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	85 c0                	test   %eax,%eax
+  801d82:	78 31                	js     801db5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d87:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d8b:	74 2f                	je     801dbc <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d8d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d90:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d97:	00 00 00 
+	stat->st_isdir = 0;
+  801d9a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801da1:	00 00 00 
+	stat->st_dev = dev;
+  801da4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801daa:	83 ec 08             	sub    $0x8,%esp
+  801dad:	53                   	push   %ebx
+  801dae:	56                   	push   %esi
+  801daf:	ff 50 14             	call   *0x14(%eax)
+  801db2:	83 c4 10             	add    $0x10,%esp
+}
+  801db5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db8:	5b                   	pop    %ebx
+  801db9:	5e                   	pop    %esi
+  801dba:	5d                   	pop    %ebp
+  801dbb:	c3                   	ret
+		return -E_NOT_SUPP;
+  801dbc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dc1:	eb f2                	jmp    801db5 <fstat+0x67>
+
+00801dc3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801dc3:	55                   	push   %ebp
+  801dc4:	89 e5                	mov    %esp,%ebp
+  801dc6:	56                   	push   %esi
+  801dc7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801dc8:	83 ec 08             	sub    $0x8,%esp
+  801dcb:	6a 00                	push   $0x0
+  801dcd:	ff 75 08             	push   0x8(%ebp)
+  801dd0:	e8 e4 01 00 00       	call   801fb9 <open>
+  801dd5:	89 c3                	mov    %eax,%ebx
+  801dd7:	83 c4 10             	add    $0x10,%esp
+  801dda:	85 c0                	test   %eax,%eax
+  801ddc:	78 1b                	js     801df9 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801dde:	83 ec 08             	sub    $0x8,%esp
+  801de1:	ff 75 0c             	push   0xc(%ebp)
+  801de4:	50                   	push   %eax
+  801de5:	e8 64 ff ff ff       	call   801d4e <fstat>
+  801dea:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801dec:	89 1c 24             	mov    %ebx,(%esp)
+  801def:	e8 c6 fb ff ff       	call   8019ba <close>
+	return r;
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	89 f3                	mov    %esi,%ebx
+}
+  801df9:	89 d8                	mov    %ebx,%eax
+  801dfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfe:	5b                   	pop    %ebx
+  801dff:	5e                   	pop    %esi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+
+00801e02 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e02:	55                   	push   %ebp
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	56                   	push   %esi
+  801e06:	53                   	push   %ebx
+  801e07:	89 c6                	mov    %eax,%esi
+  801e09:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e0b:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801e12:	74 27                	je     801e3b <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e14:	6a 07                	push   $0x7
+  801e16:	68 00 60 80 00       	push   $0x806000
+  801e1b:	56                   	push   %esi
+  801e1c:	ff 35 00 50 80 00    	push   0x805000
+  801e22:	e8 fc 13 00 00       	call   803223 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e27:	83 c4 0c             	add    $0xc,%esp
+  801e2a:	6a 00                	push   $0x0
+  801e2c:	53                   	push   %ebx
+  801e2d:	6a 00                	push   $0x0
+  801e2f:	e8 d7 13 00 00       	call   80320b <ipc_recv>
+}
+  801e34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e37:	5b                   	pop    %ebx
+  801e38:	5e                   	pop    %esi
+  801e39:	5d                   	pop    %ebp
+  801e3a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e3b:	83 ec 0c             	sub    $0xc,%esp
+  801e3e:	6a 01                	push   $0x1
+  801e40:	e8 32 14 00 00       	call   803277 <ipc_find_env>
+  801e45:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e4a:	83 c4 10             	add    $0x10,%esp
+  801e4d:	eb c5                	jmp    801e14 <fsipc+0x12>
+
+00801e4f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e4f:	55                   	push   %ebp
+  801e50:	89 e5                	mov    %esp,%ebp
+  801e52:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e58:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e5b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e63:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e72:	e8 8b ff ff ff       	call   801e02 <fsipc>
+}
+  801e77:	c9                   	leave
+  801e78:	c3                   	ret
+
+00801e79 <devfile_flush>:
+{
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e82:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e85:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e94:	e8 69 ff ff ff       	call   801e02 <fsipc>
+}
+  801e99:	c9                   	leave
+  801e9a:	c3                   	ret
+
+00801e9b <devfile_stat>:
+{
+  801e9b:	55                   	push   %ebp
+  801e9c:	89 e5                	mov    %esp,%ebp
+  801e9e:	53                   	push   %ebx
+  801e9f:	83 ec 04             	sub    $0x4,%esp
+  801ea2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eab:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801eb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801eba:	e8 43 ff ff ff       	call   801e02 <fsipc>
+  801ebf:	85 c0                	test   %eax,%eax
+  801ec1:	78 2c                	js     801eef <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ec3:	83 ec 08             	sub    $0x8,%esp
+  801ec6:	68 00 60 80 00       	push   $0x806000
+  801ecb:	53                   	push   %ebx
+  801ecc:	e8 b4 e9 ff ff       	call   800885 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ed1:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ed6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801edc:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ee1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801ee7:	83 c4 10             	add    $0x10,%esp
+  801eea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ef2:	c9                   	leave
+  801ef3:	c3                   	ret
+
+00801ef4 <devfile_write>:
+{
+  801ef4:	55                   	push   %ebp
+  801ef5:	89 e5                	mov    %esp,%ebp
+  801ef7:	83 ec 0c             	sub    $0xc,%esp
+  801efa:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f00:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f03:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801f09:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801f0e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f13:	39 d0                	cmp    %edx,%eax
+  801f15:	0f 47 c2             	cmova  %edx,%eax
+  801f18:	50                   	push   %eax
+  801f19:	ff 75 0c             	push   0xc(%ebp)
+  801f1c:	68 08 60 80 00       	push   $0x806008
+  801f21:	e8 e5 ea ff ff       	call   800a0b <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f30:	e8 cd fe ff ff       	call   801e02 <fsipc>
+}
+  801f35:	c9                   	leave
+  801f36:	c3                   	ret
+
+00801f37 <devfile_read>:
+{
+  801f37:	55                   	push   %ebp
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	56                   	push   %esi
+  801f3b:	53                   	push   %ebx
+  801f3c:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f42:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f45:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801f4a:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f55:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f5a:	e8 a3 fe ff ff       	call   801e02 <fsipc>
+  801f5f:	89 c3                	mov    %eax,%ebx
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	78 1f                	js     801f84 <devfile_read+0x4d>
+	assert(r <= n);
+  801f65:	39 c6                	cmp    %eax,%esi
+  801f67:	72 24                	jb     801f8d <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f69:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f6e:	7f 33                	jg     801fa3 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f70:	83 ec 04             	sub    $0x4,%esp
+  801f73:	50                   	push   %eax
+  801f74:	68 00 60 80 00       	push   $0x806000
+  801f79:	ff 75 0c             	push   0xc(%ebp)
+  801f7c:	e8 8a ea ff ff       	call   800a0b <memmove>
+	return r;
+  801f81:	83 c4 10             	add    $0x10,%esp
+}
+  801f84:	89 d8                	mov    %ebx,%eax
+  801f86:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f89:	5b                   	pop    %ebx
+  801f8a:	5e                   	pop    %esi
+  801f8b:	5d                   	pop    %ebp
+  801f8c:	c3                   	ret
+	assert(r <= n);
+  801f8d:	68 a8 39 80 00       	push   $0x8039a8
+  801f92:	68 af 39 80 00       	push   $0x8039af
+  801f97:	6a 76                	push   $0x76
+  801f99:	68 c4 39 80 00       	push   $0x8039c4
+  801f9e:	e8 bf e1 ff ff       	call   800162 <_panic>
+	assert(r <= PGSIZE);
+  801fa3:	68 cf 39 80 00       	push   $0x8039cf
+  801fa8:	68 af 39 80 00       	push   $0x8039af
+  801fad:	6a 77                	push   $0x77
+  801faf:	68 c4 39 80 00       	push   $0x8039c4
+  801fb4:	e8 a9 e1 ff ff       	call   800162 <_panic>
+
+00801fb9 <open>:
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	56                   	push   %esi
+  801fbd:	53                   	push   %ebx
+  801fbe:	83 ec 1c             	sub    $0x1c,%esp
+  801fc1:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801fc4:	56                   	push   %esi
+  801fc5:	e8 80 e8 ff ff       	call   80084a <strlen>
+  801fca:	83 c4 10             	add    $0x10,%esp
+  801fcd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fd2:	7f 6c                	jg     802040 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801fd4:	83 ec 0c             	sub    $0xc,%esp
+  801fd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fda:	50                   	push   %eax
+  801fdb:	e8 3a f8 ff ff       	call   80181a <fd_alloc>
+  801fe0:	89 c3                	mov    %eax,%ebx
+  801fe2:	83 c4 10             	add    $0x10,%esp
+  801fe5:	85 c0                	test   %eax,%eax
+  801fe7:	78 3c                	js     802025 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801fe9:	83 ec 08             	sub    $0x8,%esp
+  801fec:	56                   	push   %esi
+  801fed:	68 00 60 80 00       	push   $0x806000
+  801ff2:	e8 8e e8 ff ff       	call   800885 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ff7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ffa:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802002:	b8 01 00 00 00       	mov    $0x1,%eax
+  802007:	e8 f6 fd ff ff       	call   801e02 <fsipc>
+  80200c:	89 c3                	mov    %eax,%ebx
+  80200e:	83 c4 10             	add    $0x10,%esp
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 19                	js     80202e <open+0x75>
+	return fd2num(fd);
+  802015:	83 ec 0c             	sub    $0xc,%esp
+  802018:	ff 75 f4             	push   -0xc(%ebp)
+  80201b:	e8 d3 f7 ff ff       	call   8017f3 <fd2num>
+  802020:	89 c3                	mov    %eax,%ebx
+  802022:	83 c4 10             	add    $0x10,%esp
+}
+  802025:	89 d8                	mov    %ebx,%eax
+  802027:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202a:	5b                   	pop    %ebx
+  80202b:	5e                   	pop    %esi
+  80202c:	5d                   	pop    %ebp
+  80202d:	c3                   	ret
+		fd_close(fd, 0);
+  80202e:	83 ec 08             	sub    $0x8,%esp
+  802031:	6a 00                	push   $0x0
+  802033:	ff 75 f4             	push   -0xc(%ebp)
+  802036:	e8 f8 f8 ff ff       	call   801933 <fd_close>
+		return r;
+  80203b:	83 c4 10             	add    $0x10,%esp
+  80203e:	eb e5                	jmp    802025 <open+0x6c>
+		return -E_BAD_PATH;
+  802040:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802045:	eb de                	jmp    802025 <open+0x6c>
+
+00802047 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802047:	55                   	push   %ebp
+  802048:	89 e5                	mov    %esp,%ebp
+  80204a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80204d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802052:	b8 08 00 00 00       	mov    $0x8,%eax
+  802057:	e8 a6 fd ff ff       	call   801e02 <fsipc>
+}
+  80205c:	c9                   	leave
+  80205d:	c3                   	ret
+
+0080205e <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80205e:	55                   	push   %ebp
+  80205f:	89 e5                	mov    %esp,%ebp
+  802061:	57                   	push   %edi
+  802062:	56                   	push   %esi
+  802063:	53                   	push   %ebx
+  802064:	81 ec 54 04 00 00    	sub    $0x454,%esp
+	//
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+	if ((r = open(prog, O_RDONLY)) < 0)
+  80206a:	6a 00                	push   $0x0
+  80206c:	ff 75 08             	push   0x8(%ebp)
+  80206f:	e8 45 ff ff ff       	call   801fb9 <open>
+  802074:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  80207a:	83 c4 10             	add    $0x10,%esp
+  80207d:	85 c0                	test   %eax,%eax
+  80207f:	0f 88 7a 06 00 00    	js     8026ff <spawn+0x6a1>
+  802085:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802087:	83 ec 04             	sub    $0x4,%esp
+  80208a:	68 00 02 00 00       	push   $0x200
+  80208f:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802095:	50                   	push   %eax
+  802096:	51                   	push   %ecx
+  802097:	e8 01 fb ff ff       	call   801b9d <readn>
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8020a4:	75 7a                	jne    802120 <spawn+0xc2>
+	    || elf->e_magic != ELF_MAGIC) {
+  8020a6:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8020ad:	45 4c 46 
+  8020b0:	75 6e                	jne    802120 <spawn+0xc2>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8020b2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8020b7:	cd 30                	int    $0x30
+  8020b9:	89 85 cc fb ff ff    	mov    %eax,-0x434(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8020bf:	89 c6                	mov    %eax,%esi
+  8020c1:	85 c0                	test   %eax,%eax
+  8020c3:	0f 88 2a 06 00 00    	js     8026f3 <spawn+0x695>
+		return r;
+	child = r;
+
+	// The child's memory is its own, not our demand-zero regions.
+	if ((r = sys_region_release(child, 0, UTOP)) < 0)
+  8020c9:	83 ec 04             	sub    $0x4,%esp
+  8020cc:	68 00 00 c0 ee       	push   $0xeec00000
+  8020d1:	6a 00                	push   $0x0
+  8020d3:	50                   	push   %eax
+  8020d4:	e8 1d f3 ff ff       	call   8013f6 <sys_region_release>
+  8020d9:	89 c7                	mov    %eax,%edi
+  8020db:	83 c4 10             	add    $0x10,%esp
+  8020de:	85 c0                	test   %eax,%eax
+  8020e0:	0f 88 da 05 00 00    	js     8026c0 <spawn+0x662>
+		goto error;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8020e6:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8020ec:	69 f6 58 01 00 00    	imul   $0x158,%esi,%esi
+  8020f2:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8020f8:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8020fe:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802103:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802105:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  80210b:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802111:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802116:	be 00 00 00 00       	mov    $0x0,%esi
+  80211b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80211e:	eb 4b                	jmp    80216b <spawn+0x10d>
+		close(fd);
+  802120:	83 ec 0c             	sub    $0xc,%esp
+  802123:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802129:	e8 8c f8 ff ff       	call   8019ba <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80212e:	83 c4 0c             	add    $0xc,%esp
+  802131:	68 7f 45 4c 46       	push   $0x464c457f
+  802136:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  80213c:	68 db 39 80 00       	push   $0x8039db
+  802141:	e8 f7 e0 ff ff       	call   80023d <cprintf>
+		return -E_NOT_EXEC;
+  802146:	83 c4 10             	add    $0x10,%esp
+  802149:	c7 85 d0 fb ff ff f2 	movl   $0xfffffff2,-0x430(%ebp)
+  802150:	ff ff ff 
+  802153:	e9 a7 05 00 00       	jmp    8026ff <spawn+0x6a1>
+		string_size += strlen(argv[argc]) + 1;
+  802158:	83 ec 0c             	sub    $0xc,%esp
+  80215b:	50                   	push   %eax
+  80215c:	e8 e9 e6 ff ff       	call   80084a <strlen>
+  802161:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802165:	83 c3 01             	add    $0x1,%ebx
+  802168:	83 c4 10             	add    $0x10,%esp
+  80216b:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	75 e6                	jne    802158 <spawn+0xfa>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802172:	89 9d c4 fb ff ff    	mov    %ebx,-0x43c(%ebp)
+  802178:	b8 00 10 40 00       	mov    $0x401000,%eax
+  80217d:	29 f0                	sub    %esi,%eax
+  80217f:	89 c7                	mov    %eax,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802181:	89 c2                	mov    %eax,%edx
+  802183:	83 e2 fc             	and    $0xfffffffc,%edx
+  802186:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80218d:	29 c2                	sub    %eax,%edx
+  80218f:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802195:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802198:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80219d:	0f 86 6a 05 00 00    	jbe    80270d <spawn+0x6af>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8021a3:	83 ec 04             	sub    $0x4,%esp
+  8021a6:	6a 07                	push   $0x7
+  8021a8:	68 00 00 40 00       	push   $0x400000
+  8021ad:	6a 00                	push   $0x0
+  8021af:	e8 c9 eb ff ff       	call   800d7d <sys_page_alloc>
+  8021b4:	83 c4 10             	add    $0x10,%esp
+  8021b7:	85 c0                	test   %eax,%eax
+  8021b9:	0f 88 53 05 00 00    	js     802712 <spawn+0x6b4>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8021bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c4:	89 9d c8 fb ff ff    	mov    %ebx,-0x438(%ebp)
+  8021ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021cd:	eb 30                	jmp    8021ff <spawn+0x1a1>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8021cf:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8021d5:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  8021db:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8021de:	83 ec 08             	sub    $0x8,%esp
+  8021e1:	ff 34 b3             	push   (%ebx,%esi,4)
+  8021e4:	57                   	push   %edi
+  8021e5:	e8 9b e6 ff ff       	call   800885 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8021ea:	83 c4 04             	add    $0x4,%esp
+  8021ed:	ff 34 b3             	push   (%ebx,%esi,4)
+  8021f0:	e8 55 e6 ff ff       	call   80084a <strlen>
+  8021f5:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8021f9:	83 c6 01             	add    $0x1,%esi
+  8021fc:	83 c4 10             	add    $0x10,%esp
+  8021ff:	39 b5 c8 fb ff ff    	cmp    %esi,-0x438(%ebp)
+  802205:	7f c8                	jg     8021cf <spawn+0x171>
+	}
+	argv_store[argc] = 0;
+  802207:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  80220d:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  802213:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80221a:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802220:	0f 85 85 00 00 00    	jne    8022ab <spawn+0x24d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802226:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  80222c:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  802232:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  802235:	89 d0                	mov    %edx,%eax
+  802237:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  80223d:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802240:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802245:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  80224b:	83 ec 0c             	sub    $0xc,%esp
+  80224e:	6a 07                	push   $0x7
+  802250:	68 00 d0 bf ee       	push   $0xeebfd000
+  802255:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80225b:	68 00 00 40 00       	push   $0x400000
+  802260:	6a 00                	push   $0x0
+  802262:	e8 83 eb ff ff       	call   800dea <sys_page_map>
+  802267:	89 c3                	mov    %eax,%ebx
+  802269:	83 c4 20             	add    $0x20,%esp
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	0f 88 a6 04 00 00    	js     80271a <spawn+0x6bc>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802274:	83 ec 08             	sub    $0x8,%esp
+  802277:	68 00 00 40 00       	push   $0x400000
+  80227c:	6a 00                	push   $0x0
+  80227e:	e8 d5 eb ff ff       	call   800e58 <sys_page_unmap>
+  802283:	89 c3                	mov    %eax,%ebx
+  802285:	83 c4 10             	add    $0x10,%esp
+  802288:	85 c0                	test   %eax,%eax
+  80228a:	0f 88 8a 04 00 00    	js     80271a <spawn+0x6bc>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802290:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802296:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80229d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a2:	89 df                	mov    %ebx,%edi
+  8022a4:	89 c3                	mov    %eax,%ebx
+  8022a6:	e9 8d 01 00 00       	jmp    802438 <spawn+0x3da>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8022ab:	68 8c 3a 80 00       	push   $0x803a8c
+  8022b0:	68 af 39 80 00       	push   $0x8039af
+  8022b5:	68 f3 00 00 00       	push   $0xf3
+  8022ba:	68 f5 39 80 00       	push   $0x8039f5
+  8022bf:	e8 9e de ff ff       	call   800162 <_panic>
+	}
+
+	// The pages that come from the file, a chunk at a time: allocate
+	// the chunk at UTEMP, read it in, and move it to the child.
+	batch_init(&b);
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  8022c4:	01 fe                	add    %edi,%esi
+  8022c6:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+  8022cc:	8b 85 c0 fb ff ff    	mov    -0x440(%ebp),%eax
+  8022d2:	39 c6                	cmp    %eax,%esi
+  8022d4:	0f 83 18 01 00 00    	jae    8023f2 <spawn+0x394>
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  8022da:	8b 9d b8 fb ff ff    	mov    -0x448(%ebp),%ebx
+  8022e0:	29 f3                	sub    %esi,%ebx
+  8022e2:	c1 eb 0c             	shr    $0xc,%ebx
+  8022e5:	b8 40 00 00 00       	mov    $0x40,%eax
+  8022ea:	39 c3                	cmp    %eax,%ebx
+  8022ec:	0f 47 d8             	cmova  %eax,%ebx
+  8022ef:	89 df                	mov    %ebx,%edi
+			SEGMENT_CHUNK);
+		batch_alloc(&b, 0, UTEMP, PTE_P|PTE_U|PTE_W, n);
+  8022f1:	83 ec 0c             	sub    $0xc,%esp
+  8022f4:	53                   	push   %ebx
+  8022f5:	6a 07                	push   $0x7
+  8022f7:	68 00 00 40 00       	push   $0x400000
+  8022fc:	6a 00                	push   $0x0
+  8022fe:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802304:	50                   	push   %eax
+  802305:	e8 2d 11 00 00       	call   803437 <batch_alloc>
+		if ((r = batch_flush(&b)) < 0)
+  80230a:	83 c4 14             	add    $0x14,%esp
+  80230d:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802313:	50                   	push   %eax
+  802314:	e8 b9 0f 00 00       	call   8032d2 <batch_flush>
+  802319:	83 c4 10             	add    $0x10,%esp
+  80231c:	85 c0                	test   %eax,%eax
+  80231e:	0f 88 9a 03 00 00    	js     8026be <spawn+0x660>
+			return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802324:	83 ec 08             	sub    $0x8,%esp
+  802327:	8b 85 bc fb ff ff    	mov    -0x444(%ebp),%eax
+  80232d:	01 f0                	add    %esi,%eax
+  80232f:	50                   	push   %eax
+  802330:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802336:	e8 4b f9 ff ff       	call   801c86 <seek>
+  80233b:	83 c4 10             	add    $0x10,%esp
+  80233e:	85 c0                	test   %eax,%eax
+  802340:	0f 88 a1 03 00 00    	js     8026e7 <spawn+0x689>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802346:	c1 e7 0c             	shl    $0xc,%edi
+  802349:	83 ec 04             	sub    $0x4,%esp
+  80234c:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  802352:	8b 8d d4 fb ff ff    	mov    -0x42c(%ebp),%ecx
+  802358:	29 c8                	sub    %ecx,%eax
+  80235a:	39 f8                	cmp    %edi,%eax
+  80235c:	0f 47 c7             	cmova  %edi,%eax
+  80235f:	50                   	push   %eax
+  802360:	68 00 00 40 00       	push   $0x400000
+  802365:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  80236b:	e8 2d f8 ff ff       	call   801b9d <readn>
+  802370:	83 c4 10             	add    $0x10,%esp
+  802373:	85 c0                	test   %eax,%eax
+  802375:	0f 88 70 03 00 00    	js     8026eb <spawn+0x68d>
+			return r;
+		batch_map(&b, 0, UTEMP, child, (void*) (va + i), perm, n);
+  80237b:	83 ec 04             	sub    $0x4,%esp
+  80237e:	53                   	push   %ebx
+  80237f:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  802385:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  80238b:	8b 95 c4 fb ff ff    	mov    -0x43c(%ebp),%edx
+  802391:	01 d0                	add    %edx,%eax
+  802393:	50                   	push   %eax
+  802394:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80239a:	68 00 00 40 00       	push   $0x400000
+  80239f:	6a 00                	push   $0x0
+  8023a1:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8023a7:	50                   	push   %eax
+  8023a8:	e8 b5 10 00 00       	call   803462 <batch_map>
+		batch_unmap(&b, 0, UTEMP, n);
+  8023ad:	83 c4 20             	add    $0x20,%esp
+  8023b0:	53                   	push   %ebx
+  8023b1:	68 00 00 40 00       	push   $0x400000
+  8023b6:	6a 00                	push   $0x0
+  8023b8:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8023be:	50                   	push   %eax
+  8023bf:	e8 c8 10 00 00       	call   80348c <batch_unmap>
+		if ((r = batch_flush(&b)) < 0)
+  8023c4:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8023ca:	89 04 24             	mov    %eax,(%esp)
+  8023cd:	e8 00 0f 00 00       	call   8032d2 <batch_flush>
+  8023d2:	83 c4 10             	add    $0x10,%esp
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	0f 89 e7 fe ff ff    	jns    8022c4 <spawn+0x266>
+			panic("spawn: sys_page_map data: %e", r);
+  8023dd:	50                   	push   %eax
+  8023de:	68 01 3a 80 00       	push   $0x803a01
+  8023e3:	68 2b 01 00 00       	push   $0x12b
+  8023e8:	68 f5 39 80 00       	push   $0x8039f5
+  8023ed:	e8 70 dd ff ff       	call   800162 <_panic>
+	}
+
+	// the blank pages are demand-zero
+	if (i < memsz)
+  8023f2:	8b 9d ac fb ff ff    	mov    -0x454(%ebp),%ebx
+  8023f8:	8b bd a8 fb ff ff    	mov    -0x458(%ebp),%edi
+  8023fe:	89 f2                	mov    %esi,%edx
+  802400:	8b 85 b0 fb ff ff    	mov    -0x450(%ebp),%eax
+  802406:	39 c6                	cmp    %eax,%esi
+  802408:	73 28                	jae    802432 <spawn+0x3d4>
+		return sys_region_reserve(child, (void*) (va + i), memsz - i,
+  80240a:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  802410:	29 f0                	sub    %esi,%eax
+  802412:	50                   	push   %eax
+  802413:	8b 85 c4 fb ff ff    	mov    -0x43c(%ebp),%eax
+  802419:	01 c2                	add    %eax,%edx
+  80241b:	52                   	push   %edx
+  80241c:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802422:	e8 63 ef ff ff       	call   80138a <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802427:	83 c4 10             	add    $0x10,%esp
+  80242a:	85 c0                	test   %eax,%eax
+  80242c:	0f 88 bd 02 00 00    	js     8026ef <spawn+0x691>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802432:	83 c3 01             	add    $0x1,%ebx
+  802435:	83 c7 20             	add    $0x20,%edi
+  802438:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  80243f:	39 d8                	cmp    %ebx,%eax
+  802441:	0f 8e b2 00 00 00    	jle    8024f9 <spawn+0x49b>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802447:	83 3f 01             	cmpl   $0x1,(%edi)
+  80244a:	75 e6                	jne    802432 <spawn+0x3d4>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  80244c:	8b 47 18             	mov    0x18(%edi),%eax
+  80244f:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802452:	83 f8 01             	cmp    $0x1,%eax
+  802455:	19 c0                	sbb    %eax,%eax
+  802457:	83 e0 fe             	and    $0xfffffffe,%eax
+  80245a:	83 c0 07             	add    $0x7,%eax
+  80245d:	89 85 b4 fb ff ff    	mov    %eax,-0x44c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802463:	8b 57 04             	mov    0x4(%edi),%edx
+  802466:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+  80246c:	8b 77 10             	mov    0x10(%edi),%esi
+  80246f:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+  802475:	8b 47 14             	mov    0x14(%edi),%eax
+  802478:	89 85 b0 fb ff ff    	mov    %eax,-0x450(%ebp)
+  80247e:	8b 4f 08             	mov    0x8(%edi),%ecx
+  802481:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+	if ((i = PGOFF(va))) {
+  802487:	89 c8                	mov    %ecx,%eax
+  802489:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80248e:	74 1e                	je     8024ae <spawn+0x450>
+		va -= i;
+  802490:	29 c1                	sub    %eax,%ecx
+  802492:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+		memsz += i;
+  802498:	01 85 b0 fb ff ff    	add    %eax,-0x450(%ebp)
+		filesz += i;
+  80249e:	01 c6                	add    %eax,%esi
+  8024a0:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+		fileoffset -= i;
+  8024a6:	29 c2                	sub    %eax,%edx
+  8024a8:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+	batch_init(&b);
+  8024ae:	83 ec 0c             	sub    $0xc,%esp
+  8024b1:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  8024b7:	50                   	push   %eax
+  8024b8:	e8 f9 0d 00 00       	call   8032b6 <batch_init>
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  8024bd:	83 c4 10             	add    $0x10,%esp
+  8024c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c5:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  8024cb:	8b 8d b0 fb ff ff    	mov    -0x450(%ebp),%ecx
+  8024d1:	39 c8                	cmp    %ecx,%eax
+  8024d3:	0f 46 c8             	cmovbe %eax,%ecx
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  8024d6:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  8024dc:	89 85 b8 fb ff ff    	mov    %eax,-0x448(%ebp)
+  8024e2:	89 9d ac fb ff ff    	mov    %ebx,-0x454(%ebp)
+  8024e8:	89 bd a8 fb ff ff    	mov    %edi,-0x458(%ebp)
+  8024ee:	89 8d c0 fb ff ff    	mov    %ecx,-0x440(%ebp)
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  8024f4:	e9 cd fd ff ff       	jmp    8022c6 <spawn+0x268>
+	close(fd);
+  8024f9:	83 ec 0c             	sub    $0xc,%esp
+  8024fc:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802502:	e8 b3 f4 ff ff       	call   8019ba <close>
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	struct Batch b;
+	int i, r;
+	cprintf("copy_shared_pages(%x);\n", child);
+  802507:	83 c4 08             	add    $0x8,%esp
+  80250a:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802510:	68 1e 3a 80 00       	push   $0x803a1e
+  802515:	e8 23 dd ff ff       	call   80023d <cprintf>
+	
+	batch_init(&b);
+  80251a:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802520:	89 04 24             	mov    %eax,(%esp)
+  802523:	e8 8e 0d 00 00       	call   8032b6 <batch_init>
+	
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  802528:	83 c4 10             	add    $0x10,%esp
+  80252b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		// Handle PTE flags
+		assert(uvpt[i] & PTE_U);
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+		
+		// Map page (adjacent pages are mapped with one operation)
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  802530:	8d bd dc fb ff ff    	lea    -0x424(%ebp),%edi
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  802536:	eb 22                	jmp    80255a <spawn+0x4fc>
+			if (uvpd[i / NPTENTRIES] & PTE_SHARE)
+  802538:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80253f:	f6 c6 04             	test   $0x4,%dh
+  802542:	0f 85 97 00 00 00    	jne    8025df <spawn+0x581>
+			i = ROUNDUP(i + 1, NPTENTRIES) - 1;
+  802548:	8d 9e 00 04 00 00    	lea    0x400(%esi),%ebx
+  80254e:	81 e3 00 fc ff ff    	and    $0xfffffc00,%ebx
+  802554:	83 eb 01             	sub    $0x1,%ebx
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  802557:	83 c3 01             	add    $0x1,%ebx
+  80255a:	89 de                	mov    %ebx,%esi
+  80255c:	81 fb fd eb 0e 00    	cmp    $0xeebfd,%ebx
+  802562:	0f 87 bd 00 00 00    	ja     802625 <spawn+0x5c7>
+		if (! (uvpd[i / NPTENTRIES] & PTE_P))
+  802568:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+  80256e:	85 db                	test   %ebx,%ebx
+  802570:	0f 49 c3             	cmovns %ebx,%eax
+  802573:	c1 f8 0a             	sar    $0xa,%eax
+  802576:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80257d:	f6 c2 01             	test   $0x1,%dl
+  802580:	74 d5                	je     802557 <spawn+0x4f9>
+		if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  802582:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802589:	f6 c2 80             	test   $0x80,%dl
+  80258c:	75 aa                	jne    802538 <spawn+0x4da>
+		if (! (uvpt[i] & PTE_P))
+  80258e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802595:	a8 01                	test   $0x1,%al
+  802597:	74 be                	je     802557 <spawn+0x4f9>
+		if (! (uvpt[i] & PTE_SHARE))
+  802599:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8025a0:	f6 c4 04             	test   $0x4,%ah
+  8025a3:	74 b2                	je     802557 <spawn+0x4f9>
+		assert(uvpt[i] & PTE_U);
+  8025a5:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8025ac:	a8 04                	test   $0x4,%al
+  8025ae:	74 5c                	je     80260c <spawn+0x5ae>
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  8025b0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  8025b7:	89 da                	mov    %ebx,%edx
+  8025b9:	c1 e2 0c             	shl    $0xc,%edx
+  8025bc:	83 ec 04             	sub    $0x4,%esp
+  8025bf:	6a 01                	push   $0x1
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  8025c1:	25 07 0e 00 00       	and    $0xe07,%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  8025c6:	50                   	push   %eax
+  8025c7:	52                   	push   %edx
+  8025c8:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8025ce:	52                   	push   %edx
+  8025cf:	6a 00                	push   $0x0
+  8025d1:	57                   	push   %edi
+  8025d2:	e8 8b 0e 00 00       	call   803462 <batch_map>
+  8025d7:	83 c4 20             	add    $0x20,%esp
+  8025da:	e9 78 ff ff ff       	jmp    802557 <spawn+0x4f9>
+					  uvpd[i / NPTENTRIES] & PTE_SYSCALL, 1);
+  8025df:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+					  (void *) (i * PGSIZE),
+  8025e6:	c1 e3 0c             	shl    $0xc,%ebx
+				batch_map(&b, 0, (void *) (i * PGSIZE), child,
+  8025e9:	83 ec 04             	sub    $0x4,%esp
+  8025ec:	6a 01                	push   $0x1
+  8025ee:	25 07 0e 00 00       	and    $0xe07,%eax
+  8025f3:	50                   	push   %eax
+  8025f4:	53                   	push   %ebx
+  8025f5:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8025fb:	53                   	push   %ebx
+  8025fc:	6a 00                	push   $0x0
+  8025fe:	57                   	push   %edi
+  8025ff:	e8 5e 0e 00 00       	call   803462 <batch_map>
+  802604:	83 c4 20             	add    $0x20,%esp
+  802607:	e9 3c ff ff ff       	jmp    802548 <spawn+0x4ea>
+		assert(uvpt[i] & PTE_U);
+  80260c:	68 36 3a 80 00       	push   $0x803a36
+  802611:	68 af 39 80 00       	push   $0x8039af
+  802616:	68 58 01 00 00       	push   $0x158
+  80261b:	68 f5 39 80 00       	push   $0x8039f5
+  802620:	e8 3d db ff ff       	call   800162 <_panic>
+	}
+	if ((r = batch_flush(&b)) < 0)
+  802625:	83 ec 0c             	sub    $0xc,%esp
+  802628:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80262e:	50                   	push   %eax
+  80262f:	e8 9e 0c 00 00       	call   8032d2 <batch_flush>
+  802634:	83 c4 10             	add    $0x10,%esp
+  802637:	85 c0                	test   %eax,%eax
+  802639:	78 44                	js     80267f <spawn+0x621>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80263b:	83 ec 08             	sub    $0x8,%esp
+  80263e:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802644:	50                   	push   %eax
+  802645:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80264b:	e8 de e8 ff ff       	call   800f2e <sys_env_set_trapframe>
+  802650:	83 c4 10             	add    $0x10,%esp
+  802653:	85 c0                	test   %eax,%eax
+  802655:	78 3d                	js     802694 <spawn+0x636>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802657:	83 ec 08             	sub    $0x8,%esp
+  80265a:	6a 02                	push   $0x2
+  80265c:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802662:	e8 5c e8 ff ff       	call   800ec3 <sys_env_set_status>
+  802667:	83 c4 10             	add    $0x10,%esp
+  80266a:	85 c0                	test   %eax,%eax
+  80266c:	78 3b                	js     8026a9 <spawn+0x64b>
+	return child;
+  80266e:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  802674:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  80267a:	e9 80 00 00 00       	jmp    8026ff <spawn+0x6a1>
+		panic("cannot map page: %e", r);
+  80267f:	50                   	push   %eax
+  802680:	68 46 3a 80 00       	push   $0x803a46
+  802685:	68 5f 01 00 00       	push   $0x15f
+  80268a:	68 f5 39 80 00       	push   $0x8039f5
+  80268f:	e8 ce da ff ff       	call   800162 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  802694:	50                   	push   %eax
+  802695:	68 5a 3a 80 00       	push   $0x803a5a
+  80269a:	68 87 00 00 00       	push   $0x87
+  80269f:	68 f5 39 80 00       	push   $0x8039f5
+  8026a4:	e8 b9 da ff ff       	call   800162 <_panic>
+		panic("sys_env_set_status: %e", r);
+  8026a9:	50                   	push   %eax
+  8026aa:	68 74 3a 80 00       	push   $0x803a74
+  8026af:	68 8a 00 00 00       	push   $0x8a
+  8026b4:	68 f5 39 80 00       	push   $0x8039f5
+  8026b9:	e8 a4 da ff ff       	call   800162 <_panic>
+  8026be:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  8026c0:	83 ec 0c             	sub    $0xc,%esp
+  8026c3:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8026c9:	e8 ba e5 ff ff       	call   800c88 <sys_env_destroy>
+	close(fd);
+  8026ce:	83 c4 04             	add    $0x4,%esp
+  8026d1:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8026d7:	e8 de f2 ff ff       	call   8019ba <close>
+	return r;
+  8026dc:	83 c4 10             	add    $0x10,%esp
+  8026df:	89 bd d0 fb ff ff    	mov    %edi,-0x430(%ebp)
+  8026e5:	eb 18                	jmp    8026ff <spawn+0x6a1>
+  8026e7:	89 c7                	mov    %eax,%edi
+  8026e9:	eb d5                	jmp    8026c0 <spawn+0x662>
+  8026eb:	89 c7                	mov    %eax,%edi
+  8026ed:	eb d1                	jmp    8026c0 <spawn+0x662>
+  8026ef:	89 c7                	mov    %eax,%edi
+  8026f1:	eb cd                	jmp    8026c0 <spawn+0x662>
+		return r;
+  8026f3:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  8026f9:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+}
+  8026ff:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+  802705:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802708:	5b                   	pop    %ebx
+  802709:	5e                   	pop    %esi
+  80270a:	5f                   	pop    %edi
+  80270b:	5d                   	pop    %ebp
+  80270c:	c3                   	ret
+		return -E_NO_MEM;
+  80270d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802712:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802718:	eb e5                	jmp    8026ff <spawn+0x6a1>
+	sys_page_unmap(0, UTEMP);
+  80271a:	83 ec 08             	sub    $0x8,%esp
+  80271d:	68 00 00 40 00       	push   $0x400000
+  802722:	6a 00                	push   $0x0
+  802724:	e8 2f e7 ff ff       	call   800e58 <sys_page_unmap>
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	89 9d d0 fb ff ff    	mov    %ebx,-0x430(%ebp)
+  802732:	eb cb                	jmp    8026ff <spawn+0x6a1>
+
+00802734 <spawnl>:
+{
+  802734:	55                   	push   %ebp
+  802735:	89 e5                	mov    %esp,%ebp
+  802737:	56                   	push   %esi
+  802738:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802739:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  80273c:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802741:	eb 05                	jmp    802748 <spawnl+0x14>
+		argc++;
+  802743:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802746:	89 ca                	mov    %ecx,%edx
+  802748:	8d 4a 04             	lea    0x4(%edx),%ecx
+  80274b:	83 3a 00             	cmpl   $0x0,(%edx)
+  80274e:	75 f3                	jne    802743 <spawnl+0xf>
+	const char *argv[argc+2];
+  802750:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802757:	83 e2 f0             	and    $0xfffffff0,%edx
+  80275a:	29 d4                	sub    %edx,%esp
+  80275c:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802760:	89 da                	mov    %ebx,%edx
+  802762:	c1 ea 02             	shr    $0x2,%edx
+  802765:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802768:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80276b:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802772:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802779:	00 
+	va_start(vl, arg0);
+  80277a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  80277d:	89 c2                	mov    %eax,%edx
+  80277f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802784:	eb 0b                	jmp    802791 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802786:	83 c0 01             	add    $0x1,%eax
+  802789:	8b 31                	mov    (%ecx),%esi
+  80278b:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  80278e:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802791:	39 d0                	cmp    %edx,%eax
+  802793:	75 f1                	jne    802786 <spawnl+0x52>
+	return spawn(prog, argv);
+  802795:	83 ec 08             	sub    $0x8,%esp
+  802798:	53                   	push   %ebx
+  802799:	ff 75 08             	push   0x8(%ebp)
+  80279c:	e8 bd f8 ff ff       	call   80205e <spawn>
+}
+  8027a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a4:	5b                   	pop    %ebx
+  8027a5:	5e                   	pop    %esi
+  8027a6:	5d                   	pop    %ebp
+  8027a7:	c3                   	ret
+
+008027a8 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027a8:	55                   	push   %ebp
+  8027a9:	89 e5                	mov    %esp,%ebp
+  8027ab:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8027ae:	68 b2 3a 80 00       	push   $0x803ab2
+  8027b3:	ff 75 0c             	push   0xc(%ebp)
+  8027b6:	e8 ca e0 ff ff       	call   800885 <strcpy>
+	return 0;
+}
+  8027bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c0:	c9                   	leave
+  8027c1:	c3                   	ret
+
+008027c2 <devsock_close>:
+{
+  8027c2:	55                   	push   %ebp
+  8027c3:	89 e5                	mov    %esp,%ebp
+  8027c5:	53                   	push   %ebx
+  8027c6:	83 ec 10             	sub    $0x10,%esp
+  8027c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027cc:	53                   	push   %ebx
+  8027cd:	e8 06 0d 00 00       	call   8034d8 <pageref>
+  8027d2:	89 c2                	mov    %eax,%edx
+  8027d4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027d7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027dc:	83 fa 01             	cmp    $0x1,%edx
+  8027df:	74 05                	je     8027e6 <devsock_close+0x24>
+}
+  8027e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027e6:	83 ec 0c             	sub    $0xc,%esp
+  8027e9:	ff 73 0c             	push   0xc(%ebx)
+  8027ec:	e8 b7 02 00 00       	call   802aa8 <nsipc_close>
+  8027f1:	83 c4 10             	add    $0x10,%esp
+  8027f4:	eb eb                	jmp    8027e1 <devsock_close+0x1f>
+
+008027f6 <devsock_write>:
+{
+  8027f6:	55                   	push   %ebp
+  8027f7:	89 e5                	mov    %esp,%ebp
+  8027f9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8027fc:	6a 00                	push   $0x0
+  8027fe:	ff 75 10             	push   0x10(%ebp)
+  802801:	ff 75 0c             	push   0xc(%ebp)
+  802804:	8b 45 08             	mov    0x8(%ebp),%eax
+  802807:	ff 70 0c             	push   0xc(%eax)
+  80280a:	e8 79 03 00 00       	call   802b88 <nsipc_send>
+}
+  80280f:	c9                   	leave
+  802810:	c3                   	ret
+
+00802811 <devsock_read>:
+{
+  802811:	55                   	push   %ebp
+  802812:	89 e5                	mov    %esp,%ebp
+  802814:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802817:	6a 00                	push   $0x0
+  802819:	ff 75 10             	push   0x10(%ebp)
+  80281c:	ff 75 0c             	push   0xc(%ebp)
+  80281f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802822:	ff 70 0c             	push   0xc(%eax)
+  802825:	e8 ef 02 00 00       	call   802b19 <nsipc_recv>
+}
+  80282a:	c9                   	leave
+  80282b:	c3                   	ret
+
+0080282c <fd2sockid>:
+{
+  80282c:	55                   	push   %ebp
+  80282d:	89 e5                	mov    %esp,%ebp
+  80282f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802832:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802835:	52                   	push   %edx
+  802836:	50                   	push   %eax
+  802837:	e8 34 f0 ff ff       	call   801870 <fd_lookup>
+  80283c:	83 c4 10             	add    $0x10,%esp
+  80283f:	85 c0                	test   %eax,%eax
+  802841:	78 10                	js     802853 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802846:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80284c:	39 08                	cmp    %ecx,(%eax)
+  80284e:	75 05                	jne    802855 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802850:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802853:	c9                   	leave
+  802854:	c3                   	ret
+		return -E_NOT_SUPP;
+  802855:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80285a:	eb f7                	jmp    802853 <fd2sockid+0x27>
+
+0080285c <alloc_sockfd>:
+{
+  80285c:	55                   	push   %ebp
+  80285d:	89 e5                	mov    %esp,%ebp
+  80285f:	56                   	push   %esi
+  802860:	53                   	push   %ebx
+  802861:	83 ec 1c             	sub    $0x1c,%esp
+  802864:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802866:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802869:	50                   	push   %eax
+  80286a:	e8 ab ef ff ff       	call   80181a <fd_alloc>
+  80286f:	89 c3                	mov    %eax,%ebx
+  802871:	83 c4 10             	add    $0x10,%esp
+  802874:	85 c0                	test   %eax,%eax
+  802876:	78 43                	js     8028bb <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802878:	83 ec 04             	sub    $0x4,%esp
+  80287b:	68 07 04 00 00       	push   $0x407
+  802880:	ff 75 f4             	push   -0xc(%ebp)
+  802883:	6a 00                	push   $0x0
+  802885:	e8 f3 e4 ff ff       	call   800d7d <sys_page_alloc>
+  80288a:	89 c3                	mov    %eax,%ebx
+  80288c:	83 c4 10             	add    $0x10,%esp
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	78 28                	js     8028bb <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802896:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80289c:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80289e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028a1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8028a8:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8028ab:	83 ec 0c             	sub    $0xc,%esp
+  8028ae:	50                   	push   %eax
+  8028af:	e8 3f ef ff ff       	call   8017f3 <fd2num>
+  8028b4:	89 c3                	mov    %eax,%ebx
+  8028b6:	83 c4 10             	add    $0x10,%esp
+  8028b9:	eb 0c                	jmp    8028c7 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8028bb:	83 ec 0c             	sub    $0xc,%esp
+  8028be:	56                   	push   %esi
+  8028bf:	e8 e4 01 00 00       	call   802aa8 <nsipc_close>
+		return r;
+  8028c4:	83 c4 10             	add    $0x10,%esp
+}
+  8028c7:	89 d8                	mov    %ebx,%eax
+  8028c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028cc:	5b                   	pop    %ebx
+  8028cd:	5e                   	pop    %esi
+  8028ce:	5d                   	pop    %ebp
+  8028cf:	c3                   	ret
+
+008028d0 <accept>:
+{
+  8028d0:	55                   	push   %ebp
+  8028d1:	89 e5                	mov    %esp,%ebp
+  8028d3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d9:	e8 4e ff ff ff       	call   80282c <fd2sockid>
+  8028de:	85 c0                	test   %eax,%eax
+  8028e0:	78 1b                	js     8028fd <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8028e2:	83 ec 04             	sub    $0x4,%esp
+  8028e5:	ff 75 10             	push   0x10(%ebp)
+  8028e8:	ff 75 0c             	push   0xc(%ebp)
+  8028eb:	50                   	push   %eax
+  8028ec:	e8 0e 01 00 00       	call   8029ff <nsipc_accept>
+  8028f1:	83 c4 10             	add    $0x10,%esp
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	78 05                	js     8028fd <accept+0x2d>
+	return alloc_sockfd(r);
+  8028f8:	e8 5f ff ff ff       	call   80285c <alloc_sockfd>
+}
+  8028fd:	c9                   	leave
+  8028fe:	c3                   	ret
+
+008028ff <bind>:
+{
+  8028ff:	55                   	push   %ebp
+  802900:	89 e5                	mov    %esp,%ebp
+  802902:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802905:	8b 45 08             	mov    0x8(%ebp),%eax
+  802908:	e8 1f ff ff ff       	call   80282c <fd2sockid>
+  80290d:	85 c0                	test   %eax,%eax
+  80290f:	78 12                	js     802923 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802911:	83 ec 04             	sub    $0x4,%esp
+  802914:	ff 75 10             	push   0x10(%ebp)
+  802917:	ff 75 0c             	push   0xc(%ebp)
+  80291a:	50                   	push   %eax
+  80291b:	e8 31 01 00 00       	call   802a51 <nsipc_bind>
+  802920:	83 c4 10             	add    $0x10,%esp
+}
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+00802925 <shutdown>:
+{
+  802925:	55                   	push   %ebp
+  802926:	89 e5                	mov    %esp,%ebp
+  802928:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80292b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292e:	e8 f9 fe ff ff       	call   80282c <fd2sockid>
+  802933:	85 c0                	test   %eax,%eax
+  802935:	78 0f                	js     802946 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802937:	83 ec 08             	sub    $0x8,%esp
+  80293a:	ff 75 0c             	push   0xc(%ebp)
+  80293d:	50                   	push   %eax
+  80293e:	e8 43 01 00 00       	call   802a86 <nsipc_shutdown>
+  802943:	83 c4 10             	add    $0x10,%esp
+}
+  802946:	c9                   	leave
+  802947:	c3                   	ret
+
+00802948 <connect>:
+{
+  802948:	55                   	push   %ebp
+  802949:	89 e5                	mov    %esp,%ebp
+  80294b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80294e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802951:	e8 d6 fe ff ff       	call   80282c <fd2sockid>
+  802956:	85 c0                	test   %eax,%eax
+  802958:	78 12                	js     80296c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80295a:	83 ec 04             	sub    $0x4,%esp
+  80295d:	ff 75 10             	push   0x10(%ebp)
+  802960:	ff 75 0c             	push   0xc(%ebp)
+  802963:	50                   	push   %eax
+  802964:	e8 59 01 00 00       	call   802ac2 <nsipc_connect>
+  802969:	83 c4 10             	add    $0x10,%esp
+}
+  80296c:	c9                   	leave
+  80296d:	c3                   	ret
+
+0080296e <listen>:
+{
+  80296e:	55                   	push   %ebp
+  80296f:	89 e5                	mov    %esp,%ebp
+  802971:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802974:	8b 45 08             	mov    0x8(%ebp),%eax
+  802977:	e8 b0 fe ff ff       	call   80282c <fd2sockid>
+  80297c:	85 c0                	test   %eax,%eax
+  80297e:	78 0f                	js     80298f <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802980:	83 ec 08             	sub    $0x8,%esp
+  802983:	ff 75 0c             	push   0xc(%ebp)
+  802986:	50                   	push   %eax
+  802987:	e8 6b 01 00 00       	call   802af7 <nsipc_listen>
+  80298c:	83 c4 10             	add    $0x10,%esp
+}
+  80298f:	c9                   	leave
+  802990:	c3                   	ret
+
+00802991 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802991:	55                   	push   %ebp
+  802992:	89 e5                	mov    %esp,%ebp
+  802994:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802997:	ff 75 10             	push   0x10(%ebp)
+  80299a:	ff 75 0c             	push   0xc(%ebp)
+  80299d:	ff 75 08             	push   0x8(%ebp)
+  8029a0:	e8 41 02 00 00       	call   802be6 <nsipc_socket>
+  8029a5:	83 c4 10             	add    $0x10,%esp
+  8029a8:	85 c0                	test   %eax,%eax
+  8029aa:	78 05                	js     8029b1 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8029ac:	e8 ab fe ff ff       	call   80285c <alloc_sockfd>
+}
+  8029b1:	c9                   	leave
+  8029b2:	c3                   	ret
+
+008029b3 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8029b3:	55                   	push   %ebp
+  8029b4:	89 e5                	mov    %esp,%ebp
+  8029b6:	53                   	push   %ebx
+  8029b7:	83 ec 04             	sub    $0x4,%esp
+  8029ba:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8029bc:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8029c3:	74 26                	je     8029eb <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8029c5:	6a 07                	push   $0x7
+  8029c7:	68 00 70 80 00       	push   $0x807000
+  8029cc:	53                   	push   %ebx
+  8029cd:	ff 35 04 50 80 00    	push   0x805004
+  8029d3:	e8 4b 08 00 00       	call   803223 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029d8:	83 c4 0c             	add    $0xc,%esp
+  8029db:	6a 00                	push   $0x0
+  8029dd:	6a 00                	push   $0x0
+  8029df:	6a 00                	push   $0x0
+  8029e1:	e8 25 08 00 00       	call   80320b <ipc_recv>
+}
+  8029e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029e9:	c9                   	leave
+  8029ea:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029eb:	83 ec 0c             	sub    $0xc,%esp
+  8029ee:	6a 02                	push   $0x2
+  8029f0:	e8 82 08 00 00       	call   803277 <ipc_find_env>
+  8029f5:	a3 04 50 80 00       	mov    %eax,0x805004
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	eb c6                	jmp    8029c5 <nsipc+0x12>
+
+008029ff <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8029ff:	55                   	push   %ebp
+  802a00:	89 e5                	mov    %esp,%ebp
+  802a02:	56                   	push   %esi
+  802a03:	53                   	push   %ebx
+  802a04:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a07:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a0a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a0f:	8b 06                	mov    (%esi),%eax
+  802a11:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a16:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a1b:	e8 93 ff ff ff       	call   8029b3 <nsipc>
+  802a20:	89 c3                	mov    %eax,%ebx
+  802a22:	85 c0                	test   %eax,%eax
+  802a24:	79 09                	jns    802a2f <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a26:	89 d8                	mov    %ebx,%eax
+  802a28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a2b:	5b                   	pop    %ebx
+  802a2c:	5e                   	pop    %esi
+  802a2d:	5d                   	pop    %ebp
+  802a2e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a2f:	83 ec 04             	sub    $0x4,%esp
+  802a32:	ff 35 10 70 80 00    	push   0x807010
+  802a38:	68 00 70 80 00       	push   $0x807000
+  802a3d:	ff 75 0c             	push   0xc(%ebp)
+  802a40:	e8 c6 df ff ff       	call   800a0b <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a45:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a4a:	89 06                	mov    %eax,(%esi)
+  802a4c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a4f:	eb d5                	jmp    802a26 <nsipc_accept+0x27>
+
+00802a51 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a51:	55                   	push   %ebp
+  802a52:	89 e5                	mov    %esp,%ebp
+  802a54:	53                   	push   %ebx
+  802a55:	83 ec 08             	sub    $0x8,%esp
+  802a58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a63:	53                   	push   %ebx
+  802a64:	ff 75 0c             	push   0xc(%ebp)
+  802a67:	68 04 70 80 00       	push   $0x807004
+  802a6c:	e8 9a df ff ff       	call   800a0b <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a71:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802a77:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a7c:	e8 32 ff ff ff       	call   8029b3 <nsipc>
+}
+  802a81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a84:	c9                   	leave
+  802a85:	c3                   	ret
+
+00802a86 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a86:	55                   	push   %ebp
+  802a87:	89 e5                	mov    %esp,%ebp
+  802a89:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802a94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a97:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a9c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802aa1:	e8 0d ff ff ff       	call   8029b3 <nsipc>
+}
+  802aa6:	c9                   	leave
+  802aa7:	c3                   	ret
+
+00802aa8 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802aa8:	55                   	push   %ebp
+  802aa9:	89 e5                	mov    %esp,%ebp
+  802aab:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab1:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802ab6:	b8 04 00 00 00       	mov    $0x4,%eax
+  802abb:	e8 f3 fe ff ff       	call   8029b3 <nsipc>
+}
+  802ac0:	c9                   	leave
+  802ac1:	c3                   	ret
+
+00802ac2 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ac2:	55                   	push   %ebp
+  802ac3:	89 e5                	mov    %esp,%ebp
+  802ac5:	53                   	push   %ebx
+  802ac6:	83 ec 08             	sub    $0x8,%esp
+  802ac9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802acf:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ad4:	53                   	push   %ebx
+  802ad5:	ff 75 0c             	push   0xc(%ebp)
+  802ad8:	68 04 70 80 00       	push   $0x807004
+  802add:	e8 29 df ff ff       	call   800a0b <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ae2:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802ae8:	b8 05 00 00 00       	mov    $0x5,%eax
+  802aed:	e8 c1 fe ff ff       	call   8029b3 <nsipc>
+}
+  802af2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af5:	c9                   	leave
+  802af6:	c3                   	ret
+
+00802af7 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802af7:	55                   	push   %ebp
+  802af8:	89 e5                	mov    %esp,%ebp
+  802afa:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802afd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b00:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b05:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b08:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802b0d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b12:	e8 9c fe ff ff       	call   8029b3 <nsipc>
+}
+  802b17:	c9                   	leave
+  802b18:	c3                   	ret
+
+00802b19 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b19:	55                   	push   %ebp
+  802b1a:	89 e5                	mov    %esp,%ebp
+  802b1c:	56                   	push   %esi
+  802b1d:	53                   	push   %ebx
+  802b1e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b24:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802b29:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802b2f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b32:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b37:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b3c:	e8 72 fe ff ff       	call   8029b3 <nsipc>
+  802b41:	89 c3                	mov    %eax,%ebx
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	78 22                	js     802b69 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b47:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b4c:	39 c6                	cmp    %eax,%esi
+  802b4e:	0f 4e c6             	cmovle %esi,%eax
+  802b51:	39 c3                	cmp    %eax,%ebx
+  802b53:	7f 1d                	jg     802b72 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b55:	83 ec 04             	sub    $0x4,%esp
+  802b58:	53                   	push   %ebx
+  802b59:	68 00 70 80 00       	push   $0x807000
+  802b5e:	ff 75 0c             	push   0xc(%ebp)
+  802b61:	e8 a5 de ff ff       	call   800a0b <memmove>
+  802b66:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b69:	89 d8                	mov    %ebx,%eax
+  802b6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b6e:	5b                   	pop    %ebx
+  802b6f:	5e                   	pop    %esi
+  802b70:	5d                   	pop    %ebp
+  802b71:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b72:	68 be 3a 80 00       	push   $0x803abe
+  802b77:	68 af 39 80 00       	push   $0x8039af
+  802b7c:	6a 62                	push   $0x62
+  802b7e:	68 d3 3a 80 00       	push   $0x803ad3
+  802b83:	e8 da d5 ff ff       	call   800162 <_panic>
+
+00802b88 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b88:	55                   	push   %ebp
+  802b89:	89 e5                	mov    %esp,%ebp
+  802b8b:	53                   	push   %ebx
+  802b8c:	83 ec 04             	sub    $0x4,%esp
+  802b8f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b95:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802b9a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ba0:	7f 2e                	jg     802bd0 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ba2:	83 ec 04             	sub    $0x4,%esp
+  802ba5:	53                   	push   %ebx
+  802ba6:	ff 75 0c             	push   0xc(%ebp)
+  802ba9:	68 0c 70 80 00       	push   $0x80700c
+  802bae:	e8 58 de ff ff       	call   800a0b <memmove>
+	nsipcbuf.send.req_size = size;
+  802bb3:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802bb9:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bbc:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802bc1:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bc6:	e8 e8 fd ff ff       	call   8029b3 <nsipc>
+}
+  802bcb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+	assert(size < 1600);
+  802bd0:	68 df 3a 80 00       	push   $0x803adf
+  802bd5:	68 af 39 80 00       	push   $0x8039af
+  802bda:	6a 6d                	push   $0x6d
+  802bdc:	68 d3 3a 80 00       	push   $0x803ad3
+  802be1:	e8 7c d5 ff ff       	call   800162 <_panic>
+
+00802be6 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bef:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802bf4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bf7:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802bfc:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bff:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802c04:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c09:	e8 a5 fd ff ff       	call   8029b3 <nsipc>
+}
+  802c0e:	c9                   	leave
+  802c0f:	c3                   	ret
+
+00802c10 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c10:	55                   	push   %ebp
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	56                   	push   %esi
+  802c14:	53                   	push   %ebx
+  802c15:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802c18:	83 ec 0c             	sub    $0xc,%esp
+  802c1b:	ff 75 08             	push   0x8(%ebp)
+  802c1e:	e8 e0 eb ff ff       	call   801803 <fd2data>
+  802c23:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802c25:	83 c4 08             	add    $0x8,%esp
+  802c28:	68 eb 3a 80 00       	push   $0x803aeb
+  802c2d:	53                   	push   %ebx
+  802c2e:	e8 52 dc ff ff       	call   800885 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c33:	8b 46 04             	mov    0x4(%esi),%eax
+  802c36:	2b 06                	sub    (%esi),%eax
+  802c38:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802c3e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c45:	00 00 00 
+	stat->st_dev = &devpipe;
+  802c48:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802c4f:	40 80 00 
+	return 0;
+}
+  802c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c5a:	5b                   	pop    %ebx
+  802c5b:	5e                   	pop    %esi
+  802c5c:	5d                   	pop    %ebp
+  802c5d:	c3                   	ret
+
+00802c5e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c5e:	55                   	push   %ebp
+  802c5f:	89 e5                	mov    %esp,%ebp
+  802c61:	53                   	push   %ebx
+  802c62:	83 ec 0c             	sub    $0xc,%esp
+  802c65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c68:	53                   	push   %ebx
+  802c69:	6a 00                	push   $0x0
+  802c6b:	e8 e8 e1 ff ff       	call   800e58 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c70:	89 1c 24             	mov    %ebx,(%esp)
+  802c73:	e8 8b eb ff ff       	call   801803 <fd2data>
+  802c78:	83 c4 08             	add    $0x8,%esp
+  802c7b:	50                   	push   %eax
+  802c7c:	6a 00                	push   $0x0
+  802c7e:	e8 d5 e1 ff ff       	call   800e58 <sys_page_unmap>
+}
+  802c83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c86:	c9                   	leave
+  802c87:	c3                   	ret
+
+00802c88 <_pipeisclosed>:
+{
+  802c88:	55                   	push   %ebp
+  802c89:	89 e5                	mov    %esp,%ebp
+  802c8b:	57                   	push   %edi
+  802c8c:	56                   	push   %esi
+  802c8d:	53                   	push   %ebx
+  802c8e:	83 ec 1c             	sub    $0x1c,%esp
+  802c91:	89 c7                	mov    %eax,%edi
+  802c93:	89 d6                	mov    %edx,%esi
+  802c95:	eb 3c                	jmp    802cd3 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802c97:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802c9a:	83 ec 0c             	sub    $0xc,%esp
+  802c9d:	57                   	push   %edi
+  802c9e:	e8 35 08 00 00       	call   8034d8 <pageref>
+  802ca3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ca6:	89 34 24             	mov    %esi,(%esp)
+  802ca9:	e8 2a 08 00 00       	call   8034d8 <pageref>
+  802cae:	89 c2                	mov    %eax,%edx
+  802cb0:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cb2:	05 00 00 00 20       	add    $0x20000000,%eax
+  802cb7:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802cba:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cc0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cc5:	76 31                	jbe    802cf8 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802cc7:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802cca:	39 c3                	cmp    %eax,%ebx
+  802ccc:	74 76                	je     802d44 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802cce:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802cd1:	74 36                	je     802d09 <_pipeisclosed+0x81>
+  802cd3:	89 e0                	mov    %esp,%eax
+  802cd5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802cda:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ce0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ce5:	77 b0                	ja     802c97 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ce7:	c1 e8 10             	shr    $0x10,%eax
+  802cea:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802cf0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802cf6:	eb 9f                	jmp    802c97 <_pipeisclosed+0xf>
+  802cf8:	c1 e8 10             	shr    $0x10,%eax
+  802cfb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d01:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802d07:	eb be                	jmp    802cc7 <_pipeisclosed+0x3f>
+  802d09:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d0b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d10:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d16:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d1b:	76 16                	jbe    802d33 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d1d:	8b 42 58             	mov    0x58(%edx),%eax
+  802d20:	6a 01                	push   $0x1
+  802d22:	50                   	push   %eax
+  802d23:	53                   	push   %ebx
+  802d24:	68 f2 3a 80 00       	push   $0x803af2
+  802d29:	e8 0f d5 ff ff       	call   80023d <cprintf>
+  802d2e:	83 c4 10             	add    $0x10,%esp
+  802d31:	eb a0                	jmp    802cd3 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d33:	c1 e8 10             	shr    $0x10,%eax
+  802d36:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d3c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d42:	eb d9                	jmp    802d1d <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802d44:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802d47:	0f 94 c0             	sete   %al
+  802d4a:	0f b6 c0             	movzbl %al,%eax
+}
+  802d4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d50:	5b                   	pop    %ebx
+  802d51:	5e                   	pop    %esi
+  802d52:	5f                   	pop    %edi
+  802d53:	5d                   	pop    %ebp
+  802d54:	c3                   	ret
+
+00802d55 <devpipe_write>:
+{
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+  802d58:	57                   	push   %edi
+  802d59:	56                   	push   %esi
+  802d5a:	53                   	push   %ebx
+  802d5b:	83 ec 28             	sub    $0x28,%esp
+  802d5e:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802d61:	56                   	push   %esi
+  802d62:	e8 9c ea ff ff       	call   801803 <fd2data>
+  802d67:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d69:	83 c4 10             	add    $0x10,%esp
+  802d6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d71:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d74:	75 09                	jne    802d7f <devpipe_write+0x2a>
+	return i;
+  802d76:	89 f8                	mov    %edi,%eax
+  802d78:	eb 23                	jmp    802d9d <devpipe_write+0x48>
+			sys_yield();
+  802d7a:	e8 b8 df ff ff       	call   800d37 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d7f:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d82:	8b 0b                	mov    (%ebx),%ecx
+  802d84:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d87:	39 d0                	cmp    %edx,%eax
+  802d89:	72 1a                	jb     802da5 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802d8b:	89 da                	mov    %ebx,%edx
+  802d8d:	89 f0                	mov    %esi,%eax
+  802d8f:	e8 f4 fe ff ff       	call   802c88 <_pipeisclosed>
+  802d94:	85 c0                	test   %eax,%eax
+  802d96:	74 e2                	je     802d7a <devpipe_write+0x25>
+				return 0;
+  802d98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da0:	5b                   	pop    %ebx
+  802da1:	5e                   	pop    %esi
+  802da2:	5f                   	pop    %edi
+  802da3:	5d                   	pop    %ebp
+  802da4:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802da5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802da8:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802dac:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802daf:	89 c2                	mov    %eax,%edx
+  802db1:	c1 fa 1f             	sar    $0x1f,%edx
+  802db4:	89 d1                	mov    %edx,%ecx
+  802db6:	c1 e9 1b             	shr    $0x1b,%ecx
+  802db9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802dbc:	83 e2 1f             	and    $0x1f,%edx
+  802dbf:	29 ca                	sub    %ecx,%edx
+  802dc1:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802dc5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802dc9:	83 c0 01             	add    $0x1,%eax
+  802dcc:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802dcf:	83 c7 01             	add    $0x1,%edi
+  802dd2:	eb 9d                	jmp    802d71 <devpipe_write+0x1c>
+
+00802dd4 <devpipe_read>:
+{
+  802dd4:	55                   	push   %ebp
+  802dd5:	89 e5                	mov    %esp,%ebp
+  802dd7:	57                   	push   %edi
+  802dd8:	56                   	push   %esi
+  802dd9:	53                   	push   %ebx
+  802dda:	83 ec 18             	sub    $0x18,%esp
+  802ddd:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802de0:	57                   	push   %edi
+  802de1:	e8 1d ea ff ff       	call   801803 <fd2data>
+  802de6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802de8:	83 c4 10             	add    $0x10,%esp
+  802deb:	be 00 00 00 00       	mov    $0x0,%esi
+  802df0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802df3:	75 13                	jne    802e08 <devpipe_read+0x34>
+	return i;
+  802df5:	89 f0                	mov    %esi,%eax
+  802df7:	eb 02                	jmp    802dfb <devpipe_read+0x27>
+				return i;
+  802df9:	89 f0                	mov    %esi,%eax
+}
+  802dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dfe:	5b                   	pop    %ebx
+  802dff:	5e                   	pop    %esi
+  802e00:	5f                   	pop    %edi
+  802e01:	5d                   	pop    %ebp
+  802e02:	c3                   	ret
+			sys_yield();
+  802e03:	e8 2f df ff ff       	call   800d37 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802e08:	8b 03                	mov    (%ebx),%eax
+  802e0a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e0d:	75 18                	jne    802e27 <devpipe_read+0x53>
+			if (i > 0)
+  802e0f:	85 f6                	test   %esi,%esi
+  802e11:	75 e6                	jne    802df9 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802e13:	89 da                	mov    %ebx,%edx
+  802e15:	89 f8                	mov    %edi,%eax
+  802e17:	e8 6c fe ff ff       	call   802c88 <_pipeisclosed>
+  802e1c:	85 c0                	test   %eax,%eax
+  802e1e:	74 e3                	je     802e03 <devpipe_read+0x2f>
+				return 0;
+  802e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e25:	eb d4                	jmp    802dfb <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e27:	99                   	cltd
+  802e28:	c1 ea 1b             	shr    $0x1b,%edx
+  802e2b:	01 d0                	add    %edx,%eax
+  802e2d:	83 e0 1f             	and    $0x1f,%eax
+  802e30:	29 d0                	sub    %edx,%eax
+  802e32:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e3a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802e3d:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802e40:	83 c6 01             	add    $0x1,%esi
+  802e43:	eb ab                	jmp    802df0 <devpipe_read+0x1c>
+
+00802e45 <pipe>:
+{
+  802e45:	55                   	push   %ebp
+  802e46:	89 e5                	mov    %esp,%ebp
+  802e48:	56                   	push   %esi
+  802e49:	53                   	push   %ebx
+  802e4a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802e4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e50:	50                   	push   %eax
+  802e51:	e8 c4 e9 ff ff       	call   80181a <fd_alloc>
+  802e56:	89 c3                	mov    %eax,%ebx
+  802e58:	83 c4 10             	add    $0x10,%esp
+  802e5b:	85 c0                	test   %eax,%eax
+  802e5d:	0f 88 23 01 00 00    	js     802f86 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e63:	83 ec 04             	sub    $0x4,%esp
+  802e66:	68 07 04 00 00       	push   $0x407
+  802e6b:	ff 75 f4             	push   -0xc(%ebp)
+  802e6e:	6a 00                	push   $0x0
+  802e70:	e8 08 df ff ff       	call   800d7d <sys_page_alloc>
+  802e75:	89 c3                	mov    %eax,%ebx
+  802e77:	83 c4 10             	add    $0x10,%esp
+  802e7a:	85 c0                	test   %eax,%eax
+  802e7c:	0f 88 04 01 00 00    	js     802f86 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802e82:	83 ec 0c             	sub    $0xc,%esp
+  802e85:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e88:	50                   	push   %eax
+  802e89:	e8 8c e9 ff ff       	call   80181a <fd_alloc>
+  802e8e:	89 c3                	mov    %eax,%ebx
+  802e90:	83 c4 10             	add    $0x10,%esp
+  802e93:	85 c0                	test   %eax,%eax
+  802e95:	0f 88 db 00 00 00    	js     802f76 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e9b:	83 ec 04             	sub    $0x4,%esp
+  802e9e:	68 07 04 00 00       	push   $0x407
+  802ea3:	ff 75 f0             	push   -0x10(%ebp)
+  802ea6:	6a 00                	push   $0x0
+  802ea8:	e8 d0 de ff ff       	call   800d7d <sys_page_alloc>
+  802ead:	89 c3                	mov    %eax,%ebx
+  802eaf:	83 c4 10             	add    $0x10,%esp
+  802eb2:	85 c0                	test   %eax,%eax
+  802eb4:	0f 88 bc 00 00 00    	js     802f76 <pipe+0x131>
+	va = fd2data(fd0);
+  802eba:	83 ec 0c             	sub    $0xc,%esp
+  802ebd:	ff 75 f4             	push   -0xc(%ebp)
+  802ec0:	e8 3e e9 ff ff       	call   801803 <fd2data>
+  802ec5:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ec7:	83 c4 0c             	add    $0xc,%esp
+  802eca:	68 07 04 00 00       	push   $0x407
+  802ecf:	50                   	push   %eax
+  802ed0:	6a 00                	push   $0x0
+  802ed2:	e8 a6 de ff ff       	call   800d7d <sys_page_alloc>
+  802ed7:	89 c3                	mov    %eax,%ebx
+  802ed9:	83 c4 10             	add    $0x10,%esp
+  802edc:	85 c0                	test   %eax,%eax
+  802ede:	0f 88 82 00 00 00    	js     802f66 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ee4:	83 ec 0c             	sub    $0xc,%esp
+  802ee7:	ff 75 f0             	push   -0x10(%ebp)
+  802eea:	e8 14 e9 ff ff       	call   801803 <fd2data>
+  802eef:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ef6:	50                   	push   %eax
+  802ef7:	6a 00                	push   $0x0
+  802ef9:	56                   	push   %esi
+  802efa:	6a 00                	push   $0x0
+  802efc:	e8 e9 de ff ff       	call   800dea <sys_page_map>
+  802f01:	89 c3                	mov    %eax,%ebx
+  802f03:	83 c4 20             	add    $0x20,%esp
+  802f06:	85 c0                	test   %eax,%eax
+  802f08:	78 4e                	js     802f58 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802f0a:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802f0f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f12:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802f14:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f17:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802f1e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f21:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802f23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f26:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802f2d:	83 ec 0c             	sub    $0xc,%esp
+  802f30:	ff 75 f4             	push   -0xc(%ebp)
+  802f33:	e8 bb e8 ff ff       	call   8017f3 <fd2num>
+  802f38:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f3b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802f3d:	83 c4 04             	add    $0x4,%esp
+  802f40:	ff 75 f0             	push   -0x10(%ebp)
+  802f43:	e8 ab e8 ff ff       	call   8017f3 <fd2num>
+  802f48:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f4b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802f4e:	83 c4 10             	add    $0x10,%esp
+  802f51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f56:	eb 2e                	jmp    802f86 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802f58:	83 ec 08             	sub    $0x8,%esp
+  802f5b:	56                   	push   %esi
+  802f5c:	6a 00                	push   $0x0
+  802f5e:	e8 f5 de ff ff       	call   800e58 <sys_page_unmap>
+  802f63:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802f66:	83 ec 08             	sub    $0x8,%esp
+  802f69:	ff 75 f0             	push   -0x10(%ebp)
+  802f6c:	6a 00                	push   $0x0
+  802f6e:	e8 e5 de ff ff       	call   800e58 <sys_page_unmap>
+  802f73:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802f76:	83 ec 08             	sub    $0x8,%esp
+  802f79:	ff 75 f4             	push   -0xc(%ebp)
+  802f7c:	6a 00                	push   $0x0
+  802f7e:	e8 d5 de ff ff       	call   800e58 <sys_page_unmap>
+  802f83:	83 c4 10             	add    $0x10,%esp
+}
+  802f86:	89 d8                	mov    %ebx,%eax
+  802f88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f8b:	5b                   	pop    %ebx
+  802f8c:	5e                   	pop    %esi
+  802f8d:	5d                   	pop    %ebp
+  802f8e:	c3                   	ret
+
+00802f8f <pipeisclosed>:
+{
+  802f8f:	55                   	push   %ebp
+  802f90:	89 e5                	mov    %esp,%ebp
+  802f92:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f98:	50                   	push   %eax
+  802f99:	ff 75 08             	push   0x8(%ebp)
+  802f9c:	e8 cf e8 ff ff       	call   801870 <fd_lookup>
+  802fa1:	83 c4 10             	add    $0x10,%esp
+  802fa4:	85 c0                	test   %eax,%eax
+  802fa6:	78 18                	js     802fc0 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802fa8:	83 ec 0c             	sub    $0xc,%esp
+  802fab:	ff 75 f4             	push   -0xc(%ebp)
+  802fae:	e8 50 e8 ff ff       	call   801803 <fd2data>
+  802fb3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802fb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fb8:	e8 cb fc ff ff       	call   802c88 <_pipeisclosed>
+  802fbd:	83 c4 10             	add    $0x10,%esp
+}
+  802fc0:	c9                   	leave
+  802fc1:	c3                   	ret
+
+00802fc2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc7:	c3                   	ret
+
+00802fc8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fc8:	55                   	push   %ebp
+  802fc9:	89 e5                	mov    %esp,%ebp
+  802fcb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802fce:	68 0a 3b 80 00       	push   $0x803b0a
+  802fd3:	ff 75 0c             	push   0xc(%ebp)
+  802fd6:	e8 aa d8 ff ff       	call   800885 <strcpy>
+	return 0;
+}
+  802fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe0:	c9                   	leave
+  802fe1:	c3                   	ret
+
+00802fe2 <devcons_write>:
+{
+  802fe2:	55                   	push   %ebp
+  802fe3:	89 e5                	mov    %esp,%ebp
+  802fe5:	57                   	push   %edi
+  802fe6:	56                   	push   %esi
+  802fe7:	53                   	push   %ebx
+  802fe8:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802fee:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802ff3:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802ff9:	eb 2e                	jmp    803029 <devcons_write+0x47>
+		m = n - tot;
+  802ffb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ffe:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803000:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803005:	39 c3                	cmp    %eax,%ebx
+  803007:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80300a:	83 ec 04             	sub    $0x4,%esp
+  80300d:	53                   	push   %ebx
+  80300e:	89 f0                	mov    %esi,%eax
+  803010:	03 45 0c             	add    0xc(%ebp),%eax
+  803013:	50                   	push   %eax
+  803014:	57                   	push   %edi
+  803015:	e8 f1 d9 ff ff       	call   800a0b <memmove>
+		sys_cputs(buf, m);
+  80301a:	83 c4 08             	add    $0x8,%esp
+  80301d:	53                   	push   %ebx
+  80301e:	57                   	push   %edi
+  80301f:	e8 da db ff ff       	call   800bfe <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803024:	01 de                	add    %ebx,%esi
+  803026:	83 c4 10             	add    $0x10,%esp
+  803029:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80302c:	72 cd                	jb     802ffb <devcons_write+0x19>
+}
+  80302e:	89 f0                	mov    %esi,%eax
+  803030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803033:	5b                   	pop    %ebx
+  803034:	5e                   	pop    %esi
+  803035:	5f                   	pop    %edi
+  803036:	5d                   	pop    %ebp
+  803037:	c3                   	ret
+
+00803038 <devcons_read>:
+{
+  803038:	55                   	push   %ebp
+  803039:	89 e5                	mov    %esp,%ebp
+  80303b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80303e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803043:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803047:	75 07                	jne    803050 <devcons_read+0x18>
+  803049:	eb 1f                	jmp    80306a <devcons_read+0x32>
+		sys_yield();
+  80304b:	e8 e7 dc ff ff       	call   800d37 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803050:	e8 ed db ff ff       	call   800c42 <sys_cgetc>
+  803055:	85 c0                	test   %eax,%eax
+  803057:	74 f2                	je     80304b <devcons_read+0x13>
+	if (c < 0)
+  803059:	78 0f                	js     80306a <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80305b:	83 f8 04             	cmp    $0x4,%eax
+  80305e:	74 0c                	je     80306c <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803060:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803063:	88 02                	mov    %al,(%edx)
+	return 1;
+  803065:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80306a:	c9                   	leave
+  80306b:	c3                   	ret
+		return 0;
+  80306c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803071:	eb f7                	jmp    80306a <devcons_read+0x32>
+
+00803073 <cputchar>:
+{
+  803073:	55                   	push   %ebp
+  803074:	89 e5                	mov    %esp,%ebp
+  803076:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803079:	8b 45 08             	mov    0x8(%ebp),%eax
+  80307c:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80307f:	6a 01                	push   $0x1
+  803081:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803084:	50                   	push   %eax
+  803085:	e8 74 db ff ff       	call   800bfe <sys_cputs>
+}
+  80308a:	83 c4 10             	add    $0x10,%esp
+  80308d:	c9                   	leave
+  80308e:	c3                   	ret
+
+0080308f <getchar>:
+{
+  80308f:	55                   	push   %ebp
+  803090:	89 e5                	mov    %esp,%ebp
+  803092:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803095:	6a 01                	push   $0x1
+  803097:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80309a:	50                   	push   %eax
+  80309b:	6a 00                	push   $0x0
+  80309d:	e8 54 ea ff ff       	call   801af6 <read>
+	if (r < 0)
+  8030a2:	83 c4 10             	add    $0x10,%esp
+  8030a5:	85 c0                	test   %eax,%eax
+  8030a7:	78 06                	js     8030af <getchar+0x20>
+	if (r < 1)
+  8030a9:	74 06                	je     8030b1 <getchar+0x22>
+	return c;
+  8030ab:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8030af:	c9                   	leave
+  8030b0:	c3                   	ret
+		return -E_EOF;
+  8030b1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8030b6:	eb f7                	jmp    8030af <getchar+0x20>
+
+008030b8 <iscons>:
+{
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030c1:	50                   	push   %eax
+  8030c2:	ff 75 08             	push   0x8(%ebp)
+  8030c5:	e8 a6 e7 ff ff       	call   801870 <fd_lookup>
+  8030ca:	83 c4 10             	add    $0x10,%esp
+  8030cd:	85 c0                	test   %eax,%eax
+  8030cf:	78 11                	js     8030e2 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8030d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030d4:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8030da:	39 10                	cmp    %edx,(%eax)
+  8030dc:	0f 94 c0             	sete   %al
+  8030df:	0f b6 c0             	movzbl %al,%eax
+}
+  8030e2:	c9                   	leave
+  8030e3:	c3                   	ret
+
+008030e4 <opencons>:
+{
+  8030e4:	55                   	push   %ebp
+  8030e5:	89 e5                	mov    %esp,%ebp
+  8030e7:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8030ea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030ed:	50                   	push   %eax
+  8030ee:	e8 27 e7 ff ff       	call   80181a <fd_alloc>
+  8030f3:	83 c4 10             	add    $0x10,%esp
+  8030f6:	85 c0                	test   %eax,%eax
+  8030f8:	78 3a                	js     803134 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8030fa:	83 ec 04             	sub    $0x4,%esp
+  8030fd:	68 07 04 00 00       	push   $0x407
+  803102:	ff 75 f4             	push   -0xc(%ebp)
+  803105:	6a 00                	push   $0x0
+  803107:	e8 71 dc ff ff       	call   800d7d <sys_page_alloc>
+  80310c:	83 c4 10             	add    $0x10,%esp
+  80310f:	85 c0                	test   %eax,%eax
+  803111:	78 21                	js     803134 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803113:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803116:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80311c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80311e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803121:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803128:	83 ec 0c             	sub    $0xc,%esp
+  80312b:	50                   	push   %eax
+  80312c:	e8 c2 e6 ff ff       	call   8017f3 <fd2num>
+  803131:	83 c4 10             	add    $0x10,%esp
+}
+  803134:	c9                   	leave
+  803135:	c3                   	ret
+
+00803136 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  803136:	55                   	push   %ebp
+  803137:	89 e5                	mov    %esp,%ebp
+  803139:	56                   	push   %esi
+  80313a:	53                   	push   %ebx
+  80313b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80313e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803141:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803144:	85 c0                	test   %eax,%eax
+  803146:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80314b:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  80314e:	83 ec 08             	sub    $0x8,%esp
+  803151:	ff 75 14             	push   0x14(%ebp)
+  803154:	50                   	push   %eax
+  803155:	e8 34 e0 ff ff       	call   80118e <sys_ipc_recv_until>
+  80315a:	83 c4 10             	add    $0x10,%esp
+  80315d:	85 c0                	test   %eax,%eax
+  80315f:	78 61                	js     8031c2 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  803161:	85 f6                	test   %esi,%esi
+  803163:	74 1c                	je     803181 <ipc_recv_until+0x4b>
+  803165:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803167:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80316c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803172:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803177:	76 5f                	jbe    8031d8 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  803179:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  80317f:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803181:	85 db                	test   %ebx,%ebx
+  803183:	74 1c                	je     8031a1 <ipc_recv_until+0x6b>
+  803185:	89 e0                	mov    %esp,%eax
+  803187:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80318c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803192:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803197:	76 50                	jbe    8031e9 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  803199:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  80319f:	89 03                	mov    %eax,(%ebx)
+  8031a1:	89 e0                	mov    %esp,%eax
+  8031a3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8031a8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8031ae:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8031b3:	76 45                	jbe    8031fa <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  8031b5:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  8031bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031be:	5b                   	pop    %ebx
+  8031bf:	5e                   	pop    %esi
+  8031c0:	5d                   	pop    %ebp
+  8031c1:	c3                   	ret
+		if (from_env_store)
+  8031c2:	85 f6                	test   %esi,%esi
+  8031c4:	74 06                	je     8031cc <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  8031c6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8031cc:	85 db                	test   %ebx,%ebx
+  8031ce:	74 eb                	je     8031bb <ipc_recv_until+0x85>
+			*perm_store = 0;
+  8031d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8031d6:	eb e3                	jmp    8031bb <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8031d8:	c1 e8 10             	shr    $0x10,%eax
+  8031db:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8031e1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8031e7:	eb 90                	jmp    803179 <ipc_recv_until+0x43>
+  8031e9:	c1 e8 10             	shr    $0x10,%eax
+  8031ec:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8031f2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8031f8:	eb 9f                	jmp    803199 <ipc_recv_until+0x63>
+  8031fa:	c1 e8 10             	shr    $0x10,%eax
+  8031fd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803203:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803209:	eb aa                	jmp    8031b5 <ipc_recv_until+0x7f>
+
+0080320b <ipc_recv>:
+{
+  80320b:	55                   	push   %ebp
+  80320c:	89 e5                	mov    %esp,%ebp
+  80320e:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803211:	6a 00                	push   $0x0
+  803213:	ff 75 10             	push   0x10(%ebp)
+  803216:	ff 75 0c             	push   0xc(%ebp)
+  803219:	ff 75 08             	push   0x8(%ebp)
+  80321c:	e8 15 ff ff ff       	call   803136 <ipc_recv_until>
+}
+  803221:	c9                   	leave
+  803222:	c3                   	ret
+
+00803223 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803223:	55                   	push   %ebp
+  803224:	89 e5                	mov    %esp,%ebp
+  803226:	57                   	push   %edi
+  803227:	56                   	push   %esi
+  803228:	53                   	push   %ebx
+  803229:	83 ec 0c             	sub    $0xc,%esp
+  80322c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80322f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803232:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803235:	85 db                	test   %ebx,%ebx
+  803237:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80323c:	0f 44 d8             	cmove  %eax,%ebx
+  80323f:	eb 05                	jmp    803246 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803241:	e8 f1 da ff ff       	call   800d37 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  803246:	ff 75 14             	push   0x14(%ebp)
+  803249:	53                   	push   %ebx
+  80324a:	56                   	push   %esi
+  80324b:	57                   	push   %edi
+  80324c:	e8 89 de ff ff       	call   8010da <sys_ipc_try_send>
+  803251:	83 c4 10             	add    $0x10,%esp
+  803254:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803257:	74 e8                	je     803241 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  803259:	85 c0                	test   %eax,%eax
+  80325b:	78 08                	js     803265 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  80325d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803260:	5b                   	pop    %ebx
+  803261:	5e                   	pop    %esi
+  803262:	5f                   	pop    %edi
+  803263:	5d                   	pop    %ebp
+  803264:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  803265:	50                   	push   %eax
+  803266:	68 16 3b 80 00       	push   $0x803b16
+  80326b:	6a 4f                	push   $0x4f
+  80326d:	68 29 3b 80 00       	push   $0x803b29
+  803272:	e8 eb ce ff ff       	call   800162 <_panic>
+
+00803277 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803277:	55                   	push   %ebp
+  803278:	89 e5                	mov    %esp,%ebp
+  80327a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80327d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803282:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  803288:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80328e:	8b 52 50             	mov    0x50(%edx),%edx
+  803291:	39 ca                	cmp    %ecx,%edx
+  803293:	74 11                	je     8032a6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803295:	83 c0 01             	add    $0x1,%eax
+  803298:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80329d:	75 e3                	jne    803282 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80329f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a4:	eb 0e                	jmp    8032b4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8032a6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8032ac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8032b1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8032b4:	5d                   	pop    %ebp
+  8032b5:	c3                   	ret
+
+008032b6 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  8032b6:	55                   	push   %ebp
+  8032b7:	89 e5                	mov    %esp,%ebp
+  8032b9:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  8032bc:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  8032c3:	00 00 00 
+	b->b_error = 0;
+  8032c6:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  8032cd:	00 00 00 
+}
+  8032d0:	5d                   	pop    %ebp
+  8032d1:	c3                   	ret
+
+008032d2 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  8032d2:	55                   	push   %ebp
+  8032d3:	89 e5                	mov    %esp,%ebp
+  8032d5:	53                   	push   %ebx
+  8032d6:	83 ec 04             	sub    $0x4,%esp
+  8032d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  8032dc:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8032e2:	85 c0                	test   %eax,%eax
+  8032e4:	7e 09                	jle    8032ef <batch_flush+0x1d>
+  8032e6:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  8032ed:	74 15                	je     803304 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  8032ef:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  8032f6:	00 00 00 
+	return b->b_error;
+  8032f9:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  8032ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803302:	c9                   	leave
+  803303:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  803304:	83 ec 08             	sub    $0x8,%esp
+  803307:	50                   	push   %eax
+  803308:	53                   	push   %ebx
+  803309:	e8 55 e1 ff ff       	call   801463 <sys_batch>
+  80330e:	83 c4 10             	add    $0x10,%esp
+  803311:	85 c0                	test   %eax,%eax
+  803313:	79 da                	jns    8032ef <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  803315:	f7 d8                	neg    %eax
+  803317:	0f b6 c0             	movzbl %al,%eax
+  80331a:	f7 d8                	neg    %eax
+  80331c:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  803322:	eb cb                	jmp    8032ef <batch_flush+0x1d>
+
+00803324 <batch_reserve>:
+{
+  803324:	55                   	push   %ebp
+  803325:	89 e5                	mov    %esp,%ebp
+  803327:	83 ec 08             	sub    $0x8,%esp
+  80332a:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  80332d:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  803333:	03 45 0c             	add    0xc(%ebp),%eax
+  803336:	83 f8 10             	cmp    $0x10,%eax
+  803339:	7f 02                	jg     80333d <batch_reserve+0x19>
+}
+  80333b:	c9                   	leave
+  80333c:	c3                   	ret
+		batch_flush(b);
+  80333d:	83 ec 0c             	sub    $0xc,%esp
+  803340:	52                   	push   %edx
+  803341:	e8 8c ff ff ff       	call   8032d2 <batch_flush>
+  803346:	83 c4 10             	add    $0x10,%esp
+}
+  803349:	eb f0                	jmp    80333b <batch_reserve+0x17>
+
+0080334b <batch_next>:
+{
+  80334b:	55                   	push   %ebp
+  80334c:	89 e5                	mov    %esp,%ebp
+  80334e:	53                   	push   %ebx
+  80334f:	83 ec 04             	sub    $0x4,%esp
+  803352:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  803354:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  80335b:	74 28                	je     803385 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  80335d:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  803363:	8d 50 01             	lea    0x1(%eax),%edx
+  803366:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  80336c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80336f:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  803371:	83 ec 04             	sub    $0x4,%esp
+  803374:	6a 1c                	push   $0x1c
+  803376:	6a 00                	push   $0x0
+  803378:	53                   	push   %ebx
+  803379:	e8 58 d6 ff ff       	call   8009d6 <memset>
+}
+  80337e:	89 d8                	mov    %ebx,%eax
+  803380:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803383:	c9                   	leave
+  803384:	c3                   	ret
+		batch_flush(b);
+  803385:	83 ec 0c             	sub    $0xc,%esp
+  803388:	50                   	push   %eax
+  803389:	e8 44 ff ff ff       	call   8032d2 <batch_flush>
+  80338e:	83 c4 10             	add    $0x10,%esp
+  803391:	eb ca                	jmp    80335d <batch_next+0x12>
+
+00803393 <batch_page>:
+{
+  803393:	55                   	push   %ebp
+  803394:	89 e5                	mov    %esp,%ebp
+  803396:	57                   	push   %edi
+  803397:	56                   	push   %esi
+  803398:	53                   	push   %ebx
+  803399:	83 ec 1c             	sub    $0x1c,%esp
+  80339c:	89 d3                	mov    %edx,%ebx
+  80339e:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  8033a0:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  8033a6:	85 d2                	test   %edx,%edx
+  8033a8:	74 50                	je     8033fa <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  8033aa:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  8033ad:	01 c1                	add    %eax,%ecx
+  8033af:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  8033b2:	75 46                	jne    8033fa <batch_page+0x67>
+  8033b4:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  8033b7:	75 41                	jne    8033fa <batch_page+0x67>
+  8033b9:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  8033bc:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  8033bf:	75 39                	jne    8033fa <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  8033c1:	83 ea 01             	sub    $0x1,%edx
+  8033c4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8033c7:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8033ca:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  8033ce:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8033d1:	75 27                	jne    8033fa <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8033d3:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8033d6:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8033da:	89 fa                	mov    %edi,%edx
+  8033dc:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8033df:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8033e2:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8033e5:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8033e8:	75 10                	jne    8033fa <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8033ea:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8033ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8033f1:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8033f5:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8033f8:	74 2a                	je     803424 <batch_page+0x91>
+	op = batch_next(b);
+  8033fa:	e8 4c ff ff ff       	call   80334b <batch_next>
+	op->bo_op = opcode;
+  8033ff:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  803401:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  803404:	8b 75 08             	mov    0x8(%ebp),%esi
+  803407:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  80340a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80340d:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  803410:	8b 75 10             	mov    0x10(%ebp),%esi
+  803413:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  803416:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803419:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  80341c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80341f:	89 78 14             	mov    %edi,0x14(%eax)
+  803422:	eb 0b                	jmp    80342f <batch_page+0x9c>
+		op->bo_npages += npages;
+  803424:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  803428:	03 7d 18             	add    0x18(%ebp),%edi
+  80342b:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  80342f:	83 c4 1c             	add    $0x1c,%esp
+  803432:	5b                   	pop    %ebx
+  803433:	5e                   	pop    %esi
+  803434:	5f                   	pop    %edi
+  803435:	5d                   	pop    %ebp
+  803436:	c3                   	ret
+
+00803437 <batch_alloc>:
+{
+  803437:	55                   	push   %ebp
+  803438:	89 e5                	mov    %esp,%ebp
+  80343a:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  80343d:	ff 75 18             	push   0x18(%ebp)
+  803440:	ff 75 14             	push   0x14(%ebp)
+  803443:	ff 75 10             	push   0x10(%ebp)
+  803446:	ff 75 0c             	push   0xc(%ebp)
+  803449:	6a 00                	push   $0x0
+  80344b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803450:	ba 00 00 00 00       	mov    $0x0,%edx
+  803455:	8b 45 08             	mov    0x8(%ebp),%eax
+  803458:	e8 36 ff ff ff       	call   803393 <batch_page>
+}
+  80345d:	83 c4 20             	add    $0x20,%esp
+  803460:	c9                   	leave
+  803461:	c3                   	ret
+
+00803462 <batch_map>:
+{
+  803462:	55                   	push   %ebp
+  803463:	89 e5                	mov    %esp,%ebp
+  803465:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  803468:	ff 75 20             	push   0x20(%ebp)
+  80346b:	ff 75 1c             	push   0x1c(%ebp)
+  80346e:	ff 75 18             	push   0x18(%ebp)
+  803471:	ff 75 14             	push   0x14(%ebp)
+  803474:	ff 75 10             	push   0x10(%ebp)
+  803477:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80347a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80347f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803482:	e8 0c ff ff ff       	call   803393 <batch_page>
+}
+  803487:	83 c4 20             	add    $0x20,%esp
+  80348a:	c9                   	leave
+  80348b:	c3                   	ret
+
+0080348c <batch_unmap>:
+{
+  80348c:	55                   	push   %ebp
+  80348d:	89 e5                	mov    %esp,%ebp
+  80348f:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  803492:	ff 75 14             	push   0x14(%ebp)
+  803495:	6a 00                	push   $0x0
+  803497:	ff 75 10             	push   0x10(%ebp)
+  80349a:	ff 75 0c             	push   0xc(%ebp)
+  80349d:	6a 00                	push   $0x0
+  80349f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034a4:	ba 02 00 00 00       	mov    $0x2,%edx
+  8034a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034ac:	e8 e2 fe ff ff       	call   803393 <batch_page>
+}
+  8034b1:	83 c4 20             	add    $0x20,%esp
+  8034b4:	c9                   	leave
+  8034b5:	c3                   	ret
+
+008034b6 <batch_set_status>:
+{
+  8034b6:	55                   	push   %ebp
+  8034b7:	89 e5                	mov    %esp,%ebp
+  8034b9:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8034bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034bf:	e8 87 fe ff ff       	call   80334b <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8034c4:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8034ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034cd:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8034d0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034d3:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8034d6:	c9                   	leave
+  8034d7:	c3                   	ret
+
+008034d8 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8034d8:	55                   	push   %ebp
+  8034d9:	89 e5                	mov    %esp,%ebp
+  8034db:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034de:	89 c2                	mov    %eax,%edx
+  8034e0:	c1 ea 16             	shr    $0x16,%edx
+  8034e3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8034ea:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034ef:	f6 c1 01             	test   $0x1,%cl
+  8034f2:	74 1a                	je     80350e <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  8034f4:	c1 e8 0c             	shr    $0xc,%eax
+  8034f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8034fe:	a8 01                	test   $0x1,%al
+  803500:	74 0c                	je     80350e <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803502:	c1 e8 0c             	shr    $0xc,%eax
+  803505:	c1 e0 04             	shl    $0x4,%eax
+  803508:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80350e:	89 d0                	mov    %edx,%eax
+  803510:	5d                   	pop    %ebp
+  803511:	c3                   	ret
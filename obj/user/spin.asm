@@ -0,0 +1,7097 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  80003a:	68 60 33 80 00       	push   $0x803360
+  80003f:	e8 10 02 00 00       	call   800254 <cprintf>
+	if ((env = fork()) == 0) {
+  800044:	e8 36 1c 00 00       	call   801c7f <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+		cprintf("I am the child.  Spinning...\n");
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 d8 33 80 00       	push   $0x8033d8
+  800058:	e8 f7 01 00 00       	call   800254 <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+		while (1)
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 88 33 80 00       	push   $0x803388
+  80006c:	e8 e3 01 00 00       	call   800254 <cprintf>
+	sys_yield();
+  800071:	e8 d8 0c 00 00       	call   800d4e <sys_yield>
+	sys_yield();
+  800076:	e8 d3 0c 00 00       	call   800d4e <sys_yield>
+	sys_yield();
+  80007b:	e8 ce 0c 00 00       	call   800d4e <sys_yield>
+	sys_yield();
+  800080:	e8 c9 0c 00 00       	call   800d4e <sys_yield>
+	sys_yield();
+  800085:	e8 c4 0c 00 00       	call   800d4e <sys_yield>
+	sys_yield();
+  80008a:	e8 bf 0c 00 00       	call   800d4e <sys_yield>
+	sys_yield();
+  80008f:	e8 ba 0c 00 00       	call   800d4e <sys_yield>
+	sys_yield();
+  800094:	e8 b5 0c 00 00       	call   800d4e <sys_yield>
+
+	cprintf("I am the parent.  Killing the child...\n");
+  800099:	c7 04 24 b0 33 80 00 	movl   $0x8033b0,(%esp)
+  8000a0:	e8 af 01 00 00       	call   800254 <cprintf>
+	sys_env_destroy(env);
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 f2 0b 00 00       	call   800c9f <sys_env_destroy>
+}
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	57                   	push   %edi
+  8000b9:	56                   	push   %esi
+  8000ba:	53                   	push   %ebx
+  8000bb:	83 ec 0c             	sub    $0xc,%esp
+  8000be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000c9:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000cb:	c1 ea 0b             	shr    $0xb,%edx
+  8000ce:	83 f2 01             	xor    $0x1,%edx
+  8000d1:	83 e2 01             	and    $0x1,%edx
+  8000d4:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000da:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000e1:	00 00 00 
+	envid = sys_getenvid();
+  8000e4:	e8 1f 0c 00 00       	call   800d08 <sys_getenvid>
+  8000e9:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8000eb:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000f0:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8000f6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000fc:	8b 52 48             	mov    0x48(%edx),%edx
+  8000ff:	39 ca                	cmp    %ecx,%edx
+  800101:	74 27                	je     80012a <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800103:	83 c0 01             	add    $0x1,%eax
+  800106:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80010b:	75 e3                	jne    8000f0 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80010d:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800114:	75 24                	jne    80013a <libmain+0x85>
+		panic("libmain can't find the environment");
+  800116:	83 ec 04             	sub    $0x4,%esp
+  800119:	68 f8 33 80 00       	push   $0x8033f8
+  80011e:	6a 23                	push   $0x23
+  800120:	68 1b 34 80 00       	push   $0x80341b
+  800125:	e8 4f 00 00 00       	call   800179 <_panic>
+			mainenv = &envs[i];
+  80012a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800130:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800135:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80013a:	85 ff                	test   %edi,%edi
+  80013c:	7e 07                	jle    800145 <libmain+0x90>
+		binaryname = argv[0];
+  80013e:	8b 06                	mov    (%esi),%eax
+  800140:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800145:	83 ec 08             	sub    $0x8,%esp
+  800148:	56                   	push   %esi
+  800149:	57                   	push   %edi
+  80014a:	e8 e4 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80014f:	e8 0b 00 00 00       	call   80015f <exit>
+}
+  800154:	83 c4 10             	add    $0x10,%esp
+  800157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80015a:	5b                   	pop    %ebx
+  80015b:	5e                   	pop    %esi
+  80015c:	5f                   	pop    %edi
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+
+0080015f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800165:	e8 9c 1f 00 00       	call   802106 <close_all>
+	sys_env_destroy(0);
+  80016a:	83 ec 0c             	sub    $0xc,%esp
+  80016d:	6a 00                	push   $0x0
+  80016f:	e8 2b 0b 00 00       	call   800c9f <sys_env_destroy>
+}
+  800174:	83 c4 10             	add    $0x10,%esp
+  800177:	c9                   	leave
+  800178:	c3                   	ret
+
+00800179 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800179:	55                   	push   %ebp
+  80017a:	89 e5                	mov    %esp,%ebp
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80017e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800181:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800187:	e8 7c 0b 00 00       	call   800d08 <sys_getenvid>
+  80018c:	83 ec 0c             	sub    $0xc,%esp
+  80018f:	ff 75 0c             	push   0xc(%ebp)
+  800192:	ff 75 08             	push   0x8(%ebp)
+  800195:	56                   	push   %esi
+  800196:	50                   	push   %eax
+  800197:	68 34 34 80 00       	push   $0x803434
+  80019c:	e8 b3 00 00 00       	call   800254 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001a1:	83 c4 18             	add    $0x18,%esp
+  8001a4:	53                   	push   %ebx
+  8001a5:	ff 75 10             	push   0x10(%ebp)
+  8001a8:	e8 56 00 00 00       	call   800203 <vcprintf>
+	cprintf("\n");
+  8001ad:	c7 04 24 f4 33 80 00 	movl   $0x8033f4,(%esp)
+  8001b4:	e8 9b 00 00 00       	call   800254 <cprintf>
+  8001b9:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001bc:	cc                   	int3
+	while (1)
+  8001bd:	eb fd                	jmp    8001bc <_panic+0x43>
+
+008001bf <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001bf:	55                   	push   %ebp
+  8001c0:	89 e5                	mov    %esp,%ebp
+  8001c2:	53                   	push   %ebx
+  8001c3:	83 ec 04             	sub    $0x4,%esp
+  8001c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001c9:	8b 13                	mov    (%ebx),%edx
+  8001cb:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ce:	89 03                	mov    %eax,(%ebx)
+  8001d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001d3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001d7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001dc:	74 09                	je     8001e7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001de:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001e7:	83 ec 08             	sub    $0x8,%esp
+  8001ea:	68 ff 00 00 00       	push   $0xff
+  8001ef:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001f2:	50                   	push   %eax
+  8001f3:	e8 1d 0a 00 00       	call   800c15 <sys_cputs>
+		b->idx = 0;
+  8001f8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001fe:	83 c4 10             	add    $0x10,%esp
+  800201:	eb db                	jmp    8001de <putch+0x1f>
+
+00800203 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80020c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800213:	00 00 00 
+	b.cnt = 0;
+  800216:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80021d:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800220:	ff 75 0c             	push   0xc(%ebp)
+  800223:	ff 75 08             	push   0x8(%ebp)
+  800226:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80022c:	50                   	push   %eax
+  80022d:	68 bf 01 80 00       	push   $0x8001bf
+  800232:	e8 fb 00 00 00       	call   800332 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800237:	83 c4 08             	add    $0x8,%esp
+  80023a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800240:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800246:	50                   	push   %eax
+  800247:	e8 c9 09 00 00       	call   800c15 <sys_cputs>
+
+	return b.cnt;
+}
+  80024c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800252:	c9                   	leave
+  800253:	c3                   	ret
+
+00800254 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800254:	55                   	push   %ebp
+  800255:	89 e5                	mov    %esp,%ebp
+  800257:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80025a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80025d:	50                   	push   %eax
+  80025e:	ff 75 08             	push   0x8(%ebp)
+  800261:	e8 9d ff ff ff       	call   800203 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+
+00800268 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	57                   	push   %edi
+  80026c:	56                   	push   %esi
+  80026d:	53                   	push   %ebx
+  80026e:	83 ec 1c             	sub    $0x1c,%esp
+  800271:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800274:	89 d6                	mov    %edx,%esi
+  800276:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80027c:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80027f:	73 0b                	jae    80028c <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800281:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800284:	c1 e7 08             	shl    $0x8,%edi
+  800287:	0b 7d 10             	or     0x10(%ebp),%edi
+  80028a:	eb 36                	jmp    8002c2 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80028c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80028f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800294:	f7 75 08             	divl   0x8(%ebp)
+  800297:	89 c1                	mov    %eax,%ecx
+  800299:	ff 75 14             	push   0x14(%ebp)
+  80029c:	ff 75 10             	push   0x10(%ebp)
+  80029f:	83 eb 01             	sub    $0x1,%ebx
+  8002a2:	53                   	push   %ebx
+  8002a3:	ff 75 08             	push   0x8(%ebp)
+  8002a6:	89 f2                	mov    %esi,%edx
+  8002a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002ab:	e8 b8 ff ff ff       	call   800268 <printnum>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	eb 14                	jmp    8002c9 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002b5:	83 ec 08             	sub    $0x8,%esp
+  8002b8:	56                   	push   %esi
+  8002b9:	57                   	push   %edi
+  8002ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002bd:	ff d0                	call   *%eax
+  8002bf:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002c2:	83 eb 01             	sub    $0x1,%ebx
+  8002c5:	85 db                	test   %ebx,%ebx
+  8002c7:	7f ec                	jg     8002b5 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002c9:	83 ec 08             	sub    $0x8,%esp
+  8002cc:	56                   	push   %esi
+  8002cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d5:	f7 75 08             	divl   0x8(%ebp)
+  8002d8:	0f be 92 57 34 80 00 	movsbl 0x803457(%edx),%edx
+  8002df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002e2:	c1 e0 08             	shl    $0x8,%eax
+  8002e5:	09 d0                	or     %edx,%eax
+  8002e7:	50                   	push   %eax
+  8002e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002eb:	ff d0                	call   *%eax
+}
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f3:	5b                   	pop    %ebx
+  8002f4:	5e                   	pop    %esi
+  8002f5:	5f                   	pop    %edi
+  8002f6:	5d                   	pop    %ebp
+  8002f7:	c3                   	ret
+
+008002f8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002f8:	55                   	push   %ebp
+  8002f9:	89 e5                	mov    %esp,%ebp
+  8002fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002fe:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800302:	8b 10                	mov    (%eax),%edx
+  800304:	3b 50 04             	cmp    0x4(%eax),%edx
+  800307:	73 0a                	jae    800313 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800309:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80030c:	89 08                	mov    %ecx,(%eax)
+  80030e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800311:	88 02                	mov    %al,(%edx)
+}
+  800313:	5d                   	pop    %ebp
+  800314:	c3                   	ret
+
+00800315 <printfmt>:
+{
+  800315:	55                   	push   %ebp
+  800316:	89 e5                	mov    %esp,%ebp
+  800318:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80031b:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80031e:	50                   	push   %eax
+  80031f:	ff 75 10             	push   0x10(%ebp)
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	ff 75 08             	push   0x8(%ebp)
+  800328:	e8 05 00 00 00       	call   800332 <vprintfmt>
+}
+  80032d:	83 c4 10             	add    $0x10,%esp
+  800330:	c9                   	leave
+  800331:	c3                   	ret
+
+00800332 <vprintfmt>:
+{
+  800332:	55                   	push   %ebp
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	57                   	push   %edi
+  800336:	56                   	push   %esi
+  800337:	53                   	push   %ebx
+  800338:	83 ec 3c             	sub    $0x3c,%esp
+  80033b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80033e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800341:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800348:	eb 16                	jmp    800360 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80034a:	83 ec 08             	sub    $0x8,%esp
+  80034d:	ff 75 0c             	push   0xc(%ebp)
+  800350:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800353:	c1 e2 08             	shl    $0x8,%edx
+  800356:	09 d0                	or     %edx,%eax
+  800358:	50                   	push   %eax
+  800359:	ff d7                	call   *%edi
+  80035b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80035e:	89 de                	mov    %ebx,%esi
+  800360:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800363:	0f b6 06             	movzbl (%esi),%eax
+  800366:	83 f8 25             	cmp    $0x25,%eax
+  800369:	74 0c                	je     800377 <vprintfmt+0x45>
+			if (ch == '\0')
+  80036b:	85 c0                	test   %eax,%eax
+  80036d:	75 db                	jne    80034a <vprintfmt+0x18>
+}
+  80036f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800372:	5b                   	pop    %ebx
+  800373:	5e                   	pop    %esi
+  800374:	5f                   	pop    %edi
+  800375:	5d                   	pop    %ebp
+  800376:	c3                   	ret
+		padc = ' ';
+  800377:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80037b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800382:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800389:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800390:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800395:	8d 73 01             	lea    0x1(%ebx),%esi
+  800398:	0f b6 13             	movzbl (%ebx),%edx
+  80039b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80039e:	3c 55                	cmp    $0x55,%al
+  8003a0:	0f 87 2c 04 00 00    	ja     8007d2 <vprintfmt+0x4a0>
+  8003a6:	0f b6 c0             	movzbl %al,%eax
+  8003a9:	ff 24 85 a0 35 80 00 	jmp    *0x8035a0(,%eax,4)
+  8003b0:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003b2:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003b6:	eb dd                	jmp    800395 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b8:	89 f3                	mov    %esi,%ebx
+  8003ba:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003be:	eb d5                	jmp    800395 <vprintfmt+0x63>
+  8003c0:	0f b6 d2             	movzbl %dl,%edx
+  8003c3:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003c5:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003ca:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003cd:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003d1:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003d4:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003d7:	83 fe 09             	cmp    $0x9,%esi
+  8003da:	0f 87 8a 00 00 00    	ja     80046a <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003e0:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003e3:	eb e5                	jmp    8003ca <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e8:	8b 00                	mov    (%eax),%eax
+  8003ea:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8003f3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f6:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8003f8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003fc:	79 97                	jns    800395 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8003fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800401:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800404:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80040b:	eb 88                	jmp    800395 <vprintfmt+0x63>
+			if (width < 0)
+  80040d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800410:	85 db                	test   %ebx,%ebx
+  800412:	b8 00 00 00 00       	mov    $0x0,%eax
+  800417:	0f 49 c3             	cmovns %ebx,%eax
+  80041a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80041d:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80041f:	e9 71 ff ff ff       	jmp    800395 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800424:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800426:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80042d:	e9 63 ff ff ff       	jmp    800395 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800432:	8d 73 02             	lea    0x2(%ebx),%esi
+  800435:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800439:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800440:	3c 67                	cmp    $0x67,%al
+  800442:	0f 84 18 ff ff ff    	je     800360 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800448:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80044f:	3c 72                	cmp    $0x72,%al
+  800451:	0f 84 09 ff ff ff    	je     800360 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800457:	3c 62                	cmp    $0x62,%al
+  800459:	0f 94 c0             	sete   %al
+  80045c:	0f b6 c0             	movzbl %al,%eax
+  80045f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800462:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800465:	e9 f6 fe ff ff       	jmp    800360 <vprintfmt+0x2e>
+  80046a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80046d:	eb 89                	jmp    8003f8 <vprintfmt+0xc6>
+			lflag++;
+  80046f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800472:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800474:	e9 1c ff ff ff       	jmp    800395 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800479:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80047f:	83 ec 08             	sub    $0x8,%esp
+  800482:	ff 75 0c             	push   0xc(%ebp)
+  800485:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800488:	c1 e0 08             	shl    $0x8,%eax
+  80048b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80048e:	0b 01                	or     (%ecx),%eax
+  800490:	50                   	push   %eax
+  800491:	ff d7                	call   *%edi
+			break;
+  800493:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800496:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800499:	e9 c2 fe ff ff       	jmp    800360 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80049e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a1:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004a4:	8b 10                	mov    (%eax),%edx
+  8004a6:	89 d0                	mov    %edx,%eax
+  8004a8:	f7 d8                	neg    %eax
+  8004aa:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004ad:	83 f8 12             	cmp    $0x12,%eax
+  8004b0:	7f 25                	jg     8004d7 <vprintfmt+0x1a5>
+  8004b2:	8b 14 85 00 37 80 00 	mov    0x803700(,%eax,4),%edx
+  8004b9:	85 d2                	test   %edx,%edx
+  8004bb:	74 1a                	je     8004d7 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004bd:	52                   	push   %edx
+  8004be:	68 42 38 80 00       	push   $0x803842
+  8004c3:	ff 75 0c             	push   0xc(%ebp)
+  8004c6:	57                   	push   %edi
+  8004c7:	e8 49 fe ff ff       	call   800315 <printfmt>
+  8004cc:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004cf:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8004d2:	e9 89 fe ff ff       	jmp    800360 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004d7:	50                   	push   %eax
+  8004d8:	68 6f 34 80 00       	push   $0x80346f
+  8004dd:	ff 75 0c             	push   0xc(%ebp)
+  8004e0:	57                   	push   %edi
+  8004e1:	e8 2f fe ff ff       	call   800315 <printfmt>
+  8004e6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e9:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004ec:	e9 6f fe ff ff       	jmp    800360 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f4:	83 c0 04             	add    $0x4,%eax
+  8004f7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8004fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004ff:	85 c9                	test   %ecx,%ecx
+  800501:	b8 68 34 80 00       	mov    $0x803468,%eax
+  800506:	0f 45 c1             	cmovne %ecx,%eax
+  800509:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80050c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800510:	7e 06                	jle    800518 <vprintfmt+0x1e6>
+  800512:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800516:	75 1a                	jne    800532 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800518:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80051b:	c1 e0 08             	shl    $0x8,%eax
+  80051e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800521:	83 c8 3f             	or     $0x3f,%eax
+  800524:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800527:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80052a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80052d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800530:	eb 6d                	jmp    80059f <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	ff 75 d0             	push   -0x30(%ebp)
+  800538:	ff 75 c8             	push   -0x38(%ebp)
+  80053b:	e8 39 03 00 00       	call   800879 <strnlen>
+  800540:	89 c2                	mov    %eax,%edx
+  800542:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800545:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800547:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80054a:	c1 e1 08             	shl    $0x8,%ecx
+  80054d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800551:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	89 c3                	mov    %eax,%ebx
+  800558:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80055e:	89 ce                	mov    %ecx,%esi
+  800560:	eb 0f                	jmp    800571 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800562:	83 ec 08             	sub    $0x8,%esp
+  800565:	ff 75 0c             	push   0xc(%ebp)
+  800568:	56                   	push   %esi
+  800569:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80056b:	83 eb 01             	sub    $0x1,%ebx
+  80056e:	83 c4 10             	add    $0x10,%esp
+  800571:	85 db                	test   %ebx,%ebx
+  800573:	7f ed                	jg     800562 <vprintfmt+0x230>
+  800575:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800578:	8b 75 10             	mov    0x10(%ebp),%esi
+  80057b:	85 c0                	test   %eax,%eax
+  80057d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800582:	0f 49 d0             	cmovns %eax,%edx
+  800585:	29 d0                	sub    %edx,%eax
+  800587:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058a:	eb 8c                	jmp    800518 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80058c:	83 ec 08             	sub    $0x8,%esp
+  80058f:	ff 75 0c             	push   0xc(%ebp)
+  800592:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800595:	09 c2                	or     %eax,%edx
+  800597:	52                   	push   %edx
+  800598:	ff d7                	call   *%edi
+  80059a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80059d:	89 d9                	mov    %ebx,%ecx
+  80059f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005a2:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005a6:	0f be d0             	movsbl %al,%edx
+  8005a9:	85 d2                	test   %edx,%edx
+  8005ab:	74 2a                	je     8005d7 <vprintfmt+0x2a5>
+  8005ad:	85 f6                	test   %esi,%esi
+  8005af:	78 05                	js     8005b6 <vprintfmt+0x284>
+  8005b1:	83 ee 01             	sub    $0x1,%esi
+  8005b4:	78 3b                	js     8005f1 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005b6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ba:	74 d0                	je     80058c <vprintfmt+0x25a>
+  8005bc:	0f be c0             	movsbl %al,%eax
+  8005bf:	83 e8 20             	sub    $0x20,%eax
+  8005c2:	83 f8 5e             	cmp    $0x5e,%eax
+  8005c5:	76 c5                	jbe    80058c <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+  8005ca:	ff 75 0c             	push   0xc(%ebp)
+  8005cd:	ff 75 cc             	push   -0x34(%ebp)
+  8005d0:	ff d7                	call   *%edi
+  8005d2:	83 c4 10             	add    $0x10,%esp
+  8005d5:	eb c6                	jmp    80059d <vprintfmt+0x26b>
+  8005d7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005da:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e0:	01 c3                	add    %eax,%ebx
+  8005e2:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005e4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005e7:	83 c8 20             	or     $0x20,%eax
+  8005ea:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005ed:	89 c6                	mov    %eax,%esi
+  8005ef:	eb 14                	jmp    800605 <vprintfmt+0x2d3>
+  8005f1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005f4:	eb e4                	jmp    8005da <vprintfmt+0x2a8>
+  8005f6:	83 ec 08             	sub    $0x8,%esp
+  8005f9:	ff 75 0c             	push   0xc(%ebp)
+  8005fc:	56                   	push   %esi
+  8005fd:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005ff:	83 eb 01             	sub    $0x1,%ebx
+  800602:	83 c4 10             	add    $0x10,%esp
+  800605:	85 db                	test   %ebx,%ebx
+  800607:	7f ed                	jg     8005f6 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800609:	8b 75 10             	mov    0x10(%ebp),%esi
+  80060c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80060f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800612:	e9 49 fd ff ff       	jmp    800360 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800617:	83 f9 01             	cmp    $0x1,%ecx
+  80061a:	7f 1f                	jg     80063b <vprintfmt+0x309>
+	else if (lflag)
+  80061c:	85 c9                	test   %ecx,%ecx
+  80061e:	74 69                	je     800689 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 00                	mov    (%eax),%eax
+  800625:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800628:	89 c1                	mov    %eax,%ecx
+  80062a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80062d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+  800639:	eb 17                	jmp    800652 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 50 04             	mov    0x4(%eax),%edx
+  800641:	8b 00                	mov    (%eax),%eax
+  800643:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800646:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8d 40 08             	lea    0x8(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800652:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800655:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800658:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80065d:	85 db                	test   %ebx,%ebx
+  80065f:	0f 89 f6 00 00 00    	jns    80075b <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800665:	83 ec 08             	sub    $0x8,%esp
+  800668:	ff 75 0c             	push   0xc(%ebp)
+  80066b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80066e:	c1 e0 08             	shl    $0x8,%eax
+  800671:	83 c8 2d             	or     $0x2d,%eax
+  800674:	50                   	push   %eax
+  800675:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800677:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80067a:	f7 d9                	neg    %ecx
+  80067c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80067f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800684:	e9 d2 00 00 00       	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800689:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068c:	8b 00                	mov    (%eax),%eax
+  80068e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800691:	89 c1                	mov    %eax,%ecx
+  800693:	c1 f9 1f             	sar    $0x1f,%ecx
+  800696:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800699:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a2:	eb ae                	jmp    800652 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006a4:	83 f9 01             	cmp    $0x1,%ecx
+  8006a7:	7f 19                	jg     8006c2 <vprintfmt+0x390>
+	else if (lflag)
+  8006a9:	85 c9                	test   %ecx,%ecx
+  8006ab:	74 2a                	je     8006d7 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 08                	mov    (%eax),%ecx
+  8006b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006bd:	e9 99 00 00 00       	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	8b 08                	mov    (%eax),%ecx
+  8006c7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8006d2:	e9 84 00 00 00       	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8b 08                	mov    (%eax),%ecx
+  8006dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006e7:	eb 72                	jmp    80075b <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006e9:	83 f9 01             	cmp    $0x1,%ecx
+  8006ec:	7f 16                	jg     800704 <vprintfmt+0x3d2>
+	else if (lflag)
+  8006ee:	85 c9                	test   %ecx,%ecx
+  8006f0:	74 24                	je     800716 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f5:	8b 08                	mov    (%eax),%ecx
+  8006f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006fd:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800702:	eb 57                	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 08                	mov    (%eax),%ecx
+  800709:	8d 40 08             	lea    0x8(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80070f:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800714:	eb 45                	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8b 08                	mov    (%eax),%ecx
+  80071b:	8d 40 04             	lea    0x4(%eax),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800721:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800726:	eb 33                	jmp    80075b <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800728:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80072b:	c1 e3 08             	shl    $0x8,%ebx
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	ff 75 0c             	push   0xc(%ebp)
+  800734:	89 d8                	mov    %ebx,%eax
+  800736:	83 c8 30             	or     $0x30,%eax
+  800739:	50                   	push   %eax
+  80073a:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80073c:	83 c4 08             	add    $0x8,%esp
+  80073f:	ff 75 0c             	push   0xc(%ebp)
+  800742:	83 cb 78             	or     $0x78,%ebx
+  800745:	53                   	push   %ebx
+  800746:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800748:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074b:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80074d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800750:	8d 40 04             	lea    0x4(%eax),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800756:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80075b:	ff 75 e4             	push   -0x1c(%ebp)
+  80075e:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800762:	52                   	push   %edx
+  800763:	ff 75 e0             	push   -0x20(%ebp)
+  800766:	50                   	push   %eax
+  800767:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80076a:	89 f8                	mov    %edi,%eax
+  80076c:	e8 f7 fa ff ff       	call   800268 <printnum>
+			break;
+  800771:	83 c4 10             	add    $0x10,%esp
+  800774:	e9 e7 fb ff ff       	jmp    800360 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800779:	83 f9 01             	cmp    $0x1,%ecx
+  80077c:	7f 16                	jg     800794 <vprintfmt+0x462>
+	else if (lflag)
+  80077e:	85 c9                	test   %ecx,%ecx
+  800780:	74 24                	je     8007a6 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800782:	8b 45 14             	mov    0x14(%ebp),%eax
+  800785:	8b 08                	mov    (%eax),%ecx
+  800787:	8d 40 04             	lea    0x4(%eax),%eax
+  80078a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800792:	eb c7                	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800794:	8b 45 14             	mov    0x14(%ebp),%eax
+  800797:	8b 08                	mov    (%eax),%ecx
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079f:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007a4:	eb b5                	jmp    80075b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 08                	mov    (%eax),%ecx
+  8007ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b1:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007b6:	eb a3                	jmp    80075b <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007b8:	83 ec 08             	sub    $0x8,%esp
+  8007bb:	ff 75 0c             	push   0xc(%ebp)
+  8007be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007c1:	c1 e0 08             	shl    $0x8,%eax
+  8007c4:	83 c8 25             	or     $0x25,%eax
+  8007c7:	50                   	push   %eax
+  8007c8:	ff d7                	call   *%edi
+			break;
+  8007ca:	83 c4 10             	add    $0x10,%esp
+  8007cd:	e9 8e fb ff ff       	jmp    800360 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8007d2:	83 ec 08             	sub    $0x8,%esp
+  8007d5:	ff 75 0c             	push   0xc(%ebp)
+  8007d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007db:	c1 e0 08             	shl    $0x8,%eax
+  8007de:	83 c8 25             	or     $0x25,%eax
+  8007e1:	50                   	push   %eax
+  8007e2:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	89 de                	mov    %ebx,%esi
+  8007e9:	eb 03                	jmp    8007ee <vprintfmt+0x4bc>
+  8007eb:	83 ee 01             	sub    $0x1,%esi
+  8007ee:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007f2:	75 f7                	jne    8007eb <vprintfmt+0x4b9>
+  8007f4:	e9 67 fb ff ff       	jmp    800360 <vprintfmt+0x2e>
+
+008007f9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	83 ec 18             	sub    $0x18,%esp
+  8007ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800802:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800805:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800808:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80080c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80080f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800816:	85 c0                	test   %eax,%eax
+  800818:	74 26                	je     800840 <vsnprintf+0x47>
+  80081a:	85 d2                	test   %edx,%edx
+  80081c:	7e 22                	jle    800840 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80081e:	ff 75 14             	push   0x14(%ebp)
+  800821:	ff 75 10             	push   0x10(%ebp)
+  800824:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800827:	50                   	push   %eax
+  800828:	68 f8 02 80 00       	push   $0x8002f8
+  80082d:	e8 00 fb ff ff       	call   800332 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800832:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800835:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800838:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80083b:	83 c4 10             	add    $0x10,%esp
+}
+  80083e:	c9                   	leave
+  80083f:	c3                   	ret
+		return -E_INVAL;
+  800840:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800845:	eb f7                	jmp    80083e <vsnprintf+0x45>
+
+00800847 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80084d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800850:	50                   	push   %eax
+  800851:	ff 75 10             	push   0x10(%ebp)
+  800854:	ff 75 0c             	push   0xc(%ebp)
+  800857:	ff 75 08             	push   0x8(%ebp)
+  80085a:	e8 9a ff ff ff       	call   8007f9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80085f:	c9                   	leave
+  800860:	c3                   	ret
+
+00800861 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800867:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086c:	eb 03                	jmp    800871 <strlen+0x10>
+		n++;
+  80086e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800871:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800875:	75 f7                	jne    80086e <strlen+0xd>
+	return n;
+}
+  800877:	5d                   	pop    %ebp
+  800878:	c3                   	ret
+
+00800879 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800879:	55                   	push   %ebp
+  80087a:	89 e5                	mov    %esp,%ebp
+  80087c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800882:	b8 00 00 00 00       	mov    $0x0,%eax
+  800887:	eb 03                	jmp    80088c <strnlen+0x13>
+		n++;
+  800889:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80088c:	39 d0                	cmp    %edx,%eax
+  80088e:	74 08                	je     800898 <strnlen+0x1f>
+  800890:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800894:	75 f3                	jne    800889 <strnlen+0x10>
+  800896:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800898:	89 d0                	mov    %edx,%eax
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+
+0080089c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	53                   	push   %ebx
+  8008a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ab:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008af:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008b2:	83 c0 01             	add    $0x1,%eax
+  8008b5:	84 d2                	test   %dl,%dl
+  8008b7:	75 f2                	jne    8008ab <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008b9:	89 c8                	mov    %ecx,%eax
+  8008bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008be:	c9                   	leave
+  8008bf:	c3                   	ret
+
+008008c0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	53                   	push   %ebx
+  8008c4:	83 ec 10             	sub    $0x10,%esp
+  8008c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008ca:	53                   	push   %ebx
+  8008cb:	e8 91 ff ff ff       	call   800861 <strlen>
+  8008d0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008d3:	ff 75 0c             	push   0xc(%ebp)
+  8008d6:	01 d8                	add    %ebx,%eax
+  8008d8:	50                   	push   %eax
+  8008d9:	e8 be ff ff ff       	call   80089c <strcpy>
+	return dst;
+}
+  8008de:	89 d8                	mov    %ebx,%eax
+  8008e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e3:	c9                   	leave
+  8008e4:	c3                   	ret
+
+008008e5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	56                   	push   %esi
+  8008e9:	53                   	push   %ebx
+  8008ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008f0:	89 f3                	mov    %esi,%ebx
+  8008f2:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008f5:	89 f0                	mov    %esi,%eax
+  8008f7:	eb 0f                	jmp    800908 <strncpy+0x23>
+		*dst++ = *src;
+  8008f9:	83 c0 01             	add    $0x1,%eax
+  8008fc:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ff:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800902:	80 f9 01             	cmp    $0x1,%cl
+  800905:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800908:	39 d8                	cmp    %ebx,%eax
+  80090a:	75 ed                	jne    8008f9 <strncpy+0x14>
+	}
+	return ret;
+}
+  80090c:	89 f0                	mov    %esi,%eax
+  80090e:	5b                   	pop    %ebx
+  80090f:	5e                   	pop    %esi
+  800910:	5d                   	pop    %ebp
+  800911:	c3                   	ret
+
+00800912 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	56                   	push   %esi
+  800916:	53                   	push   %ebx
+  800917:	8b 75 08             	mov    0x8(%ebp),%esi
+  80091a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80091d:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800920:	89 f0                	mov    %esi,%eax
+  800922:	85 d2                	test   %edx,%edx
+  800924:	74 21                	je     800947 <strlcpy+0x35>
+  800926:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80092a:	89 f2                	mov    %esi,%edx
+  80092c:	eb 09                	jmp    800937 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80092e:	83 c1 01             	add    $0x1,%ecx
+  800931:	83 c2 01             	add    $0x1,%edx
+  800934:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800937:	39 c2                	cmp    %eax,%edx
+  800939:	74 09                	je     800944 <strlcpy+0x32>
+  80093b:	0f b6 19             	movzbl (%ecx),%ebx
+  80093e:	84 db                	test   %bl,%bl
+  800940:	75 ec                	jne    80092e <strlcpy+0x1c>
+  800942:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800944:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800947:	29 f0                	sub    %esi,%eax
+}
+  800949:	5b                   	pop    %ebx
+  80094a:	5e                   	pop    %esi
+  80094b:	5d                   	pop    %ebp
+  80094c:	c3                   	ret
+
+0080094d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80094d:	55                   	push   %ebp
+  80094e:	89 e5                	mov    %esp,%ebp
+  800950:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800953:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800956:	eb 06                	jmp    80095e <strcmp+0x11>
+		p++, q++;
+  800958:	83 c1 01             	add    $0x1,%ecx
+  80095b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80095e:	0f b6 01             	movzbl (%ecx),%eax
+  800961:	84 c0                	test   %al,%al
+  800963:	74 04                	je     800969 <strcmp+0x1c>
+  800965:	3a 02                	cmp    (%edx),%al
+  800967:	74 ef                	je     800958 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800969:	0f b6 c0             	movzbl %al,%eax
+  80096c:	0f b6 12             	movzbl (%edx),%edx
+  80096f:	29 d0                	sub    %edx,%eax
+}
+  800971:	5d                   	pop    %ebp
+  800972:	c3                   	ret
+
+00800973 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	53                   	push   %ebx
+  800977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800980:	eb 09                	jmp    80098b <strncmp+0x18>
+		n--, p++, q++;
+  800982:	83 ea 01             	sub    $0x1,%edx
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80098b:	85 d2                	test   %edx,%edx
+  80098d:	74 18                	je     8009a7 <strncmp+0x34>
+  80098f:	0f b6 18             	movzbl (%eax),%ebx
+  800992:	84 db                	test   %bl,%bl
+  800994:	74 04                	je     80099a <strncmp+0x27>
+  800996:	3a 19                	cmp    (%ecx),%bl
+  800998:	74 e8                	je     800982 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80099a:	0f b6 00             	movzbl (%eax),%eax
+  80099d:	0f b6 11             	movzbl (%ecx),%edx
+  8009a0:	29 d0                	sub    %edx,%eax
+}
+  8009a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009a5:	c9                   	leave
+  8009a6:	c3                   	ret
+		return 0;
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	eb f4                	jmp    8009a2 <strncmp+0x2f>
+
+008009ae <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009b8:	eb 03                	jmp    8009bd <strchr+0xf>
+  8009ba:	83 c0 01             	add    $0x1,%eax
+  8009bd:	0f b6 10             	movzbl (%eax),%edx
+  8009c0:	84 d2                	test   %dl,%dl
+  8009c2:	74 06                	je     8009ca <strchr+0x1c>
+		if (*s == c)
+  8009c4:	38 ca                	cmp    %cl,%dl
+  8009c6:	75 f2                	jne    8009ba <strchr+0xc>
+  8009c8:	eb 05                	jmp    8009cf <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009cf:	5d                   	pop    %ebp
+  8009d0:	c3                   	ret
+
+008009d1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009db:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009de:	38 ca                	cmp    %cl,%dl
+  8009e0:	74 09                	je     8009eb <strfind+0x1a>
+  8009e2:	84 d2                	test   %dl,%dl
+  8009e4:	74 05                	je     8009eb <strfind+0x1a>
+	for (; *s; s++)
+  8009e6:	83 c0 01             	add    $0x1,%eax
+  8009e9:	eb f0                	jmp    8009db <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009eb:	5d                   	pop    %ebp
+  8009ec:	c3                   	ret
+
+008009ed <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	57                   	push   %edi
+  8009f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009f4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009f7:	85 c9                	test   %ecx,%ecx
+  8009f9:	74 20                	je     800a1b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009fb:	89 f8                	mov    %edi,%eax
+  8009fd:	09 c8                	or     %ecx,%eax
+  8009ff:	a8 03                	test   $0x3,%al
+  800a01:	75 12                	jne    800a15 <memset+0x28>
+		c &= 0xFF;
+  800a03:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a07:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a0d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a10:	fc                   	cld
+  800a11:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a13:	eb 06                	jmp    800a1b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a18:	fc                   	cld
+  800a19:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a1b:	89 f8                	mov    %edi,%eax
+  800a1d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a20:	c9                   	leave
+  800a21:	c3                   	ret
+
+00800a22 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	57                   	push   %edi
+  800a26:	56                   	push   %esi
+  800a27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a2d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a30:	39 c6                	cmp    %eax,%esi
+  800a32:	73 32                	jae    800a66 <memmove+0x44>
+  800a34:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a37:	39 d0                	cmp    %edx,%eax
+  800a39:	73 2b                	jae    800a66 <memmove+0x44>
+		s += n;
+		d += n;
+  800a3b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a3e:	89 d6                	mov    %edx,%esi
+  800a40:	09 fe                	or     %edi,%esi
+  800a42:	09 ce                	or     %ecx,%esi
+  800a44:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a4a:	75 0e                	jne    800a5a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a4c:	83 ef 04             	sub    $0x4,%edi
+  800a4f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a52:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a55:	fd                   	std
+  800a56:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a58:	eb 09                	jmp    800a63 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a5a:	83 ef 01             	sub    $0x1,%edi
+  800a5d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a60:	fd                   	std
+  800a61:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a63:	fc                   	cld
+  800a64:	eb 1a                	jmp    800a80 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a66:	89 f2                	mov    %esi,%edx
+  800a68:	09 c2                	or     %eax,%edx
+  800a6a:	09 ca                	or     %ecx,%edx
+  800a6c:	f6 c2 03             	test   $0x3,%dl
+  800a6f:	75 0a                	jne    800a7b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a71:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a74:	89 c7                	mov    %eax,%edi
+  800a76:	fc                   	cld
+  800a77:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a79:	eb 05                	jmp    800a80 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a7b:	89 c7                	mov    %eax,%edi
+  800a7d:	fc                   	cld
+  800a7e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a80:	5e                   	pop    %esi
+  800a81:	5f                   	pop    %edi
+  800a82:	5d                   	pop    %ebp
+  800a83:	c3                   	ret
+
+00800a84 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a84:	55                   	push   %ebp
+  800a85:	89 e5                	mov    %esp,%ebp
+  800a87:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a8a:	ff 75 10             	push   0x10(%ebp)
+  800a8d:	ff 75 0c             	push   0xc(%ebp)
+  800a90:	ff 75 08             	push   0x8(%ebp)
+  800a93:	e8 8a ff ff ff       	call   800a22 <memmove>
+}
+  800a98:	c9                   	leave
+  800a99:	c3                   	ret
+
+00800a9a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	56                   	push   %esi
+  800a9e:	53                   	push   %ebx
+  800a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aa5:	89 c6                	mov    %eax,%esi
+  800aa7:	03 75 10             	add    0x10(%ebp),%esi
+  800aaa:	eb 06                	jmp    800ab2 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800aac:	83 c0 01             	add    $0x1,%eax
+  800aaf:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ab2:	39 f0                	cmp    %esi,%eax
+  800ab4:	74 14                	je     800aca <memcmp+0x30>
+		if (*s1 != *s2)
+  800ab6:	0f b6 08             	movzbl (%eax),%ecx
+  800ab9:	0f b6 1a             	movzbl (%edx),%ebx
+  800abc:	38 d9                	cmp    %bl,%cl
+  800abe:	74 ec                	je     800aac <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ac0:	0f b6 c1             	movzbl %cl,%eax
+  800ac3:	0f b6 db             	movzbl %bl,%ebx
+  800ac6:	29 d8                	sub    %ebx,%eax
+  800ac8:	eb 05                	jmp    800acf <memcmp+0x35>
+	}
+
+	return 0;
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800acf:	5b                   	pop    %ebx
+  800ad0:	5e                   	pop    %esi
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	c3                   	ret
+
+00800ad3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800adc:	89 c2                	mov    %eax,%edx
+  800ade:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ae1:	eb 03                	jmp    800ae6 <memfind+0x13>
+  800ae3:	83 c0 01             	add    $0x1,%eax
+  800ae6:	39 d0                	cmp    %edx,%eax
+  800ae8:	73 04                	jae    800aee <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800aea:	38 08                	cmp    %cl,(%eax)
+  800aec:	75 f5                	jne    800ae3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800aee:	5d                   	pop    %ebp
+  800aef:	c3                   	ret
+
+00800af0 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	57                   	push   %edi
+  800af4:	56                   	push   %esi
+  800af5:	53                   	push   %ebx
+  800af6:	83 ec 1c             	sub    $0x1c,%esp
+  800af9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800afc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800aff:	eb 03                	jmp    800b04 <strtol+0x14>
+		s++;
+  800b01:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b04:	0f b6 06             	movzbl (%esi),%eax
+  800b07:	3c 20                	cmp    $0x20,%al
+  800b09:	74 f6                	je     800b01 <strtol+0x11>
+  800b0b:	3c 09                	cmp    $0x9,%al
+  800b0d:	74 f2                	je     800b01 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b0f:	3c 2b                	cmp    $0x2b,%al
+  800b11:	74 43                	je     800b56 <strtol+0x66>
+	int neg = 0;
+  800b13:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b18:	3c 2d                	cmp    $0x2d,%al
+  800b1a:	74 44                	je     800b60 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b1c:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b22:	75 0f                	jne    800b33 <strtol+0x43>
+  800b24:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b27:	74 41                	je     800b6a <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b29:	85 ff                	test   %edi,%edi
+  800b2b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b30:	0f 44 f8             	cmove  %eax,%edi
+  800b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b38:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b3d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b40:	89 fb                	mov    %edi,%ebx
+  800b42:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b45:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b48:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b4b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b4e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b51:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b54:	eb 67                	jmp    800bbd <strtol+0xcd>
+		s++;
+  800b56:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5e:	eb bc                	jmp    800b1c <strtol+0x2c>
+		s++, neg = 1;
+  800b60:	83 c6 01             	add    $0x1,%esi
+  800b63:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b68:	eb b2                	jmp    800b1c <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b6a:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b6e:	74 0e                	je     800b7e <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b70:	85 ff                	test   %edi,%edi
+  800b72:	75 bf                	jne    800b33 <strtol+0x43>
+		s++, base = 8;
+  800b74:	83 c6 01             	add    $0x1,%esi
+  800b77:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b7c:	eb b5                	jmp    800b33 <strtol+0x43>
+		s += 2, base = 16;
+  800b7e:	83 c6 02             	add    $0x2,%esi
+  800b81:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b86:	eb ab                	jmp    800b33 <strtol+0x43>
+			dig = *s - '0';
+  800b88:	0f be c9             	movsbl %cl,%ecx
+  800b8b:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b8e:	39 f9                	cmp    %edi,%ecx
+  800b90:	7d 59                	jge    800beb <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b92:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b96:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b99:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b9c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b9f:	0f af d8             	imul   %eax,%ebx
+  800ba2:	0f af d7             	imul   %edi,%edx
+  800ba5:	01 d3                	add    %edx,%ebx
+  800ba7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800baa:	f7 e7                	mul    %edi
+  800bac:	01 da                	add    %ebx,%edx
+  800bae:	89 cb                	mov    %ecx,%ebx
+  800bb0:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bb3:	01 c8                	add    %ecx,%eax
+  800bb5:	11 da                	adc    %ebx,%edx
+  800bb7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bba:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc0:	0f b6 08             	movzbl (%eax),%ecx
+  800bc3:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800bc6:	80 fb 09             	cmp    $0x9,%bl
+  800bc9:	76 bd                	jbe    800b88 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800bcb:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800bce:	80 fb 19             	cmp    $0x19,%bl
+  800bd1:	77 08                	ja     800bdb <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800bd3:	0f be c9             	movsbl %cl,%ecx
+  800bd6:	83 e9 57             	sub    $0x57,%ecx
+  800bd9:	eb b3                	jmp    800b8e <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bdb:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800bde:	80 fb 19             	cmp    $0x19,%bl
+  800be1:	77 08                	ja     800beb <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800be3:	0f be c9             	movsbl %cl,%ecx
+  800be6:	83 e9 37             	sub    $0x37,%ecx
+  800be9:	eb a3                	jmp    800b8e <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800beb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bf1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bf4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bfb:	74 05                	je     800c02 <strtol+0x112>
+		*endptr = (char *) s;
+  800bfd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c00:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c02:	85 c9                	test   %ecx,%ecx
+  800c04:	74 07                	je     800c0d <strtol+0x11d>
+  800c06:	f7 d8                	neg    %eax
+  800c08:	83 d2 00             	adc    $0x0,%edx
+  800c0b:	f7 da                	neg    %edx
+}
+  800c0d:	83 c4 1c             	add    $0x1c,%esp
+  800c10:	5b                   	pop    %ebx
+  800c11:	5e                   	pop    %esi
+  800c12:	5f                   	pop    %edi
+  800c13:	5d                   	pop    %ebp
+  800c14:	c3                   	ret
+
+00800c15 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c15:	55                   	push   %ebp
+  800c16:	89 e5                	mov    %esp,%ebp
+  800c18:	57                   	push   %edi
+  800c19:	56                   	push   %esi
+  800c1a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c1b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c22:	74 18                	je     800c3c <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c29:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2f:	89 c3                	mov    %eax,%ebx
+  800c31:	89 c7                	mov    %eax,%edi
+  800c33:	89 c6                	mov    %eax,%esi
+  800c35:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c47:	89 c3                	mov    %eax,%ebx
+  800c49:	89 c7                	mov    %eax,%edi
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	8d 35 56 0c 80 00    	lea    0x800c56,%esi
+  800c54:	0f 34                	sysenter
+  800c56:	5d                   	pop    %ebp
+		goto out;
+  800c57:	eb de                	jmp    800c37 <sys_cputs+0x22>
+
+00800c59 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	56                   	push   %esi
+  800c5e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c5f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c66:	74 19                	je     800c81 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c72:	89 d1                	mov    %edx,%ecx
+  800c74:	89 d3                	mov    %edx,%ebx
+  800c76:	89 d7                	mov    %edx,%edi
+  800c78:	89 d6                	mov    %edx,%esi
+  800c7a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c7c:	5b                   	pop    %ebx
+  800c7d:	5e                   	pop    %esi
+  800c7e:	5f                   	pop    %edi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c86:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c8b:	89 d1                	mov    %edx,%ecx
+  800c8d:	89 d3                	mov    %edx,%ebx
+  800c8f:	89 d7                	mov    %edx,%edi
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	8d 35 9c 0c 80 00    	lea    0x800c9c,%esi
+  800c9a:	0f 34                	sysenter
+  800c9c:	5d                   	pop    %ebp
+		goto out;
+  800c9d:	eb dd                	jmp    800c7c <sys_cgetc+0x23>
+
+00800c9f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	57                   	push   %edi
+  800ca3:	56                   	push   %esi
+  800ca4:	53                   	push   %ebx
+  800ca5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ca8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800caf:	74 21                	je     800cd2 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cb6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	89 cb                	mov    %ecx,%ebx
+  800cc0:	89 cf                	mov    %ecx,%edi
+  800cc2:	89 ce                	mov    %ecx,%esi
+  800cc4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cc6:	85 c0                	test   %eax,%eax
+  800cc8:	7f 27                	jg     800cf1 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccd:	5b                   	pop    %ebx
+  800cce:	5e                   	pop    %esi
+  800ccf:	5f                   	pop    %edi
+  800cd0:	5d                   	pop    %ebp
+  800cd1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cda:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cdf:	89 cb                	mov    %ecx,%ebx
+  800ce1:	89 cf                	mov    %ecx,%edi
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	8d 35 ee 0c 80 00    	lea    0x800cee,%esi
+  800cec:	0f 34                	sysenter
+  800cee:	5d                   	pop    %ebp
+		goto out;
+  800cef:	eb d5                	jmp    800cc6 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  800cf4:	50                   	push   %eax
+  800cf5:	6a 03                	push   $0x3
+  800cf7:	68 6b 37 80 00       	push   $0x80376b
+  800cfc:	6a 3f                	push   $0x3f
+  800cfe:	68 88 37 80 00       	push   $0x803788
+  800d03:	e8 71 f4 ff ff       	call   800179 <_panic>
+
+00800d08 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	57                   	push   %edi
+  800d0c:	56                   	push   %esi
+  800d0d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d0e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d15:	74 19                	je     800d30 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d21:	89 d1                	mov    %edx,%ecx
+  800d23:	89 d3                	mov    %edx,%ebx
+  800d25:	89 d7                	mov    %edx,%edi
+  800d27:	89 d6                	mov    %edx,%esi
+  800d29:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d2b:	5b                   	pop    %ebx
+  800d2c:	5e                   	pop    %esi
+  800d2d:	5f                   	pop    %edi
+  800d2e:	5d                   	pop    %ebp
+  800d2f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d35:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d3a:	89 d1                	mov    %edx,%ecx
+  800d3c:	89 d3                	mov    %edx,%ebx
+  800d3e:	89 d7                	mov    %edx,%edi
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	8d 35 4b 0d 80 00    	lea    0x800d4b,%esi
+  800d49:	0f 34                	sysenter
+  800d4b:	5d                   	pop    %ebp
+		goto out;
+  800d4c:	eb dd                	jmp    800d2b <sys_getenvid+0x23>
+
+00800d4e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d4e:	55                   	push   %ebp
+  800d4f:	89 e5                	mov    %esp,%ebp
+  800d51:	57                   	push   %edi
+  800d52:	56                   	push   %esi
+  800d53:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d54:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d5b:	74 19                	je     800d76 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d62:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d67:	89 d1                	mov    %edx,%ecx
+  800d69:	89 d3                	mov    %edx,%ebx
+  800d6b:	89 d7                	mov    %edx,%edi
+  800d6d:	89 d6                	mov    %edx,%esi
+  800d6f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d71:	5b                   	pop    %ebx
+  800d72:	5e                   	pop    %esi
+  800d73:	5f                   	pop    %edi
+  800d74:	5d                   	pop    %ebp
+  800d75:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d80:	89 d1                	mov    %edx,%ecx
+  800d82:	89 d3                	mov    %edx,%ebx
+  800d84:	89 d7                	mov    %edx,%edi
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	8d 35 91 0d 80 00    	lea    0x800d91,%esi
+  800d8f:	0f 34                	sysenter
+  800d91:	5d                   	pop    %ebp
+		goto out;
+  800d92:	eb dd                	jmp    800d71 <sys_yield+0x23>
+
+00800d94 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d9d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800da4:	74 23                	je     800dc9 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800da6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dab:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db9:	89 f7                	mov    %esi,%edi
+  800dbb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dbd:	85 c0                	test   %eax,%eax
+  800dbf:	7f 29                	jg     800dea <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5e                   	pop    %esi
+  800dc6:	5f                   	pop    %edi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcf:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddc:	55                   	push   %ebp
+  800ddd:	89 e5                	mov    %esp,%ebp
+  800ddf:	8d 35 e7 0d 80 00    	lea    0x800de7,%esi
+  800de5:	0f 34                	sysenter
+  800de7:	5d                   	pop    %ebp
+		goto out;
+  800de8:	eb d3                	jmp    800dbd <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dea:	83 ec 0c             	sub    $0xc,%esp
+  800ded:	50                   	push   %eax
+  800dee:	6a 04                	push   $0x4
+  800df0:	68 6b 37 80 00       	push   $0x80376b
+  800df5:	6a 3f                	push   $0x3f
+  800df7:	68 88 37 80 00       	push   $0x803788
+  800dfc:	e8 78 f3 ff ff       	call   800179 <_panic>
+
+00800e01 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+  800e07:	83 ec 0c             	sub    $0xc,%esp
+  800e0a:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e0d:	85 f6                	test   %esi,%esi
+  800e0f:	75 09                	jne    800e1a <sys_page_map+0x19>
+  800e11:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e18:	74 1f                	je     800e39 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e1a:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e28:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e2b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2d:	85 c0                	test   %eax,%eax
+  800e2f:	7f 27                	jg     800e58 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e34:	5b                   	pop    %ebx
+  800e35:	5e                   	pop    %esi
+  800e36:	5f                   	pop    %edi
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	8d 35 55 0e 80 00    	lea    0x800e55,%esi
+  800e53:	0f 34                	sysenter
+  800e55:	5d                   	pop    %ebp
+		goto out;
+  800e56:	eb d5                	jmp    800e2d <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+  800e5b:	50                   	push   %eax
+  800e5c:	6a 05                	push   $0x5
+  800e5e:	68 6b 37 80 00       	push   $0x80376b
+  800e63:	6a 3f                	push   $0x3f
+  800e65:	68 88 37 80 00       	push   $0x803788
+  800e6a:	e8 0a f3 ff ff       	call   800179 <_panic>
+
+00800e6f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	57                   	push   %edi
+  800e73:	56                   	push   %esi
+  800e74:	53                   	push   %ebx
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e78:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e7f:	74 22                	je     800ea3 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e86:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e91:	89 df                	mov    %ebx,%edi
+  800e93:	89 de                	mov    %ebx,%esi
+  800e95:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e97:	85 c0                	test   %eax,%eax
+  800e99:	7f 28                	jg     800ec3 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eae:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eb3:	89 df                	mov    %ebx,%edi
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	8d 35 c0 0e 80 00    	lea    0x800ec0,%esi
+  800ebe:	0f 34                	sysenter
+  800ec0:	5d                   	pop    %ebp
+		goto out;
+  800ec1:	eb d4                	jmp    800e97 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	6a 06                	push   $0x6
+  800ec9:	68 6b 37 80 00       	push   $0x80376b
+  800ece:	6a 3f                	push   $0x3f
+  800ed0:	68 88 37 80 00       	push   $0x803788
+  800ed5:	e8 9f f2 ff ff       	call   800179 <_panic>
+
+00800eda <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ee3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eea:	74 22                	je     800f0e <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800eec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	89 df                	mov    %ebx,%edi
+  800efe:	89 de                	mov    %ebx,%esi
+  800f00:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	7f 28                	jg     800f2e <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f19:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f1e:	89 df                	mov    %ebx,%edi
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	8d 35 2b 0f 80 00    	lea    0x800f2b,%esi
+  800f29:	0f 34                	sysenter
+  800f2b:	5d                   	pop    %ebp
+		goto out;
+  800f2c:	eb d4                	jmp    800f02 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  800f31:	50                   	push   %eax
+  800f32:	6a 08                	push   $0x8
+  800f34:	68 6b 37 80 00       	push   $0x80376b
+  800f39:	6a 3f                	push   $0x3f
+  800f3b:	68 88 37 80 00       	push   $0x803788
+  800f40:	e8 34 f2 ff ff       	call   800179 <_panic>
+
+00800f45 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	57                   	push   %edi
+  800f49:	56                   	push   %esi
+  800f4a:	53                   	push   %ebx
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f4e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f55:	74 22                	je     800f79 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5c:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f67:	89 df                	mov    %ebx,%edi
+  800f69:	89 de                	mov    %ebx,%esi
+  800f6b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6d:	85 c0                	test   %eax,%eax
+  800f6f:	7f 28                	jg     800f99 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f74:	5b                   	pop    %ebx
+  800f75:	5e                   	pop    %esi
+  800f76:	5f                   	pop    %edi
+  800f77:	5d                   	pop    %ebp
+  800f78:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f84:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f89:	89 df                	mov    %ebx,%edi
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	8d 35 96 0f 80 00    	lea    0x800f96,%esi
+  800f94:	0f 34                	sysenter
+  800f96:	5d                   	pop    %ebp
+		goto out;
+  800f97:	eb d4                	jmp    800f6d <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+  800f9c:	50                   	push   %eax
+  800f9d:	6a 09                	push   $0x9
+  800f9f:	68 6b 37 80 00       	push   $0x80376b
+  800fa4:	6a 3f                	push   $0x3f
+  800fa6:	68 88 37 80 00       	push   $0x803788
+  800fab:	e8 c9 f1 ff ff       	call   800179 <_panic>
+
+00800fb0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	57                   	push   %edi
+  800fb4:	56                   	push   %esi
+  800fb5:	53                   	push   %ebx
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fb9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fc0:	74 22                	je     800fe4 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800fc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd2:	89 df                	mov    %ebx,%edi
+  800fd4:	89 de                	mov    %ebx,%esi
+  800fd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 28                	jg     801004 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5f                   	pop    %edi
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fe4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ff4:	89 df                	mov    %ebx,%edi
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	8d 35 01 10 80 00    	lea    0x801001,%esi
+  800fff:	0f 34                	sysenter
+  801001:	5d                   	pop    %ebp
+		goto out;
+  801002:	eb d4                	jmp    800fd8 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 0a                	push   $0xa
+  80100a:	68 6b 37 80 00       	push   $0x80376b
+  80100f:	6a 3f                	push   $0x3f
+  801011:	68 88 37 80 00       	push   $0x803788
+  801016:	e8 5e f1 ff ff       	call   800179 <_panic>
+
+0080101b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801024:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80102b:	74 22                	je     80104f <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80102d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801032:	b8 17 00 00 00       	mov    $0x17,%eax
+  801037:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103d:	89 df                	mov    %ebx,%edi
+  80103f:	89 de                	mov    %ebx,%esi
+  801041:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801043:	85 c0                	test   %eax,%eax
+  801045:	7f 28                	jg     80106f <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104a:	5b                   	pop    %ebx
+  80104b:	5e                   	pop    %esi
+  80104c:	5f                   	pop    %edi
+  80104d:	5d                   	pop    %ebp
+  80104e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80104f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801054:	8b 55 08             	mov    0x8(%ebp),%edx
+  801057:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80105f:	89 df                	mov    %ebx,%edi
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	8d 35 6c 10 80 00    	lea    0x80106c,%esi
+  80106a:	0f 34                	sysenter
+  80106c:	5d                   	pop    %ebp
+		goto out;
+  80106d:	eb d4                	jmp    801043 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	50                   	push   %eax
+  801073:	6a 17                	push   $0x17
+  801075:	68 6b 37 80 00       	push   $0x80376b
+  80107a:	6a 3f                	push   $0x3f
+  80107c:	68 88 37 80 00       	push   $0x803788
+  801081:	e8 f3 f0 ff ff       	call   800179 <_panic>
+
+00801086 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80108f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801096:	74 22                	je     8010ba <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801098:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109d:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	89 df                	mov    %ebx,%edi
+  8010aa:	89 de                	mov    %ebx,%esi
+  8010ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	7f 28                	jg     8010da <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c5:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010ca:	89 df                	mov    %ebx,%edi
+  8010cc:	55                   	push   %ebp
+  8010cd:	89 e5                	mov    %esp,%ebp
+  8010cf:	8d 35 d7 10 80 00    	lea    0x8010d7,%esi
+  8010d5:	0f 34                	sysenter
+  8010d7:	5d                   	pop    %ebp
+		goto out;
+  8010d8:	eb d4                	jmp    8010ae <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010da:	83 ec 0c             	sub    $0xc,%esp
+  8010dd:	50                   	push   %eax
+  8010de:	6a 18                	push   $0x18
+  8010e0:	68 6b 37 80 00       	push   $0x80376b
+  8010e5:	6a 3f                	push   $0x3f
+  8010e7:	68 88 37 80 00       	push   $0x803788
+  8010ec:	e8 88 f0 ff ff       	call   800179 <_panic>
+
+008010f1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010f1:	55                   	push   %ebp
+  8010f2:	89 e5                	mov    %esp,%ebp
+  8010f4:	57                   	push   %edi
+  8010f5:	56                   	push   %esi
+  8010f6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010f7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010fe:	74 1d                	je     80111d <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801100:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801105:	be 00 00 00 00       	mov    $0x0,%esi
+  80110a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801110:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801113:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801116:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801118:	5b                   	pop    %ebx
+  801119:	5e                   	pop    %esi
+  80111a:	5f                   	pop    %edi
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80111d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801120:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801123:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801128:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	8d 35 39 11 80 00    	lea    0x801139,%esi
+  801137:	0f 34                	sysenter
+  801139:	5d                   	pop    %ebp
+		goto out;
+  80113a:	eb dc                	jmp    801118 <sys_ipc_try_send+0x27>
+
+0080113c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+  801142:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801145:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80114c:	74 21                	je     80116f <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80114e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801153:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801158:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115b:	89 cb                	mov    %ecx,%ebx
+  80115d:	89 cf                	mov    %ecx,%edi
+  80115f:	89 ce                	mov    %ecx,%esi
+  801161:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801163:	85 c0                	test   %eax,%eax
+  801165:	7f 27                	jg     80118e <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801167:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116a:	5b                   	pop    %ebx
+  80116b:	5e                   	pop    %esi
+  80116c:	5f                   	pop    %edi
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80116f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801172:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801177:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80117c:	89 cb                	mov    %ecx,%ebx
+  80117e:	89 cf                	mov    %ecx,%edi
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	8d 35 8b 11 80 00    	lea    0x80118b,%esi
+  801189:	0f 34                	sysenter
+  80118b:	5d                   	pop    %ebp
+		goto out;
+  80118c:	eb d5                	jmp    801163 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118e:	83 ec 0c             	sub    $0xc,%esp
+  801191:	50                   	push   %eax
+  801192:	6a 0d                	push   $0xd
+  801194:	68 6b 37 80 00       	push   $0x80376b
+  801199:	6a 3f                	push   $0x3f
+  80119b:	68 88 37 80 00       	push   $0x803788
+  8011a0:	e8 d4 ef ff ff       	call   800179 <_panic>
+
+008011a5 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	57                   	push   %edi
+  8011a9:	56                   	push   %esi
+  8011aa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011ab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011b2:	74 1b                	je     8011cf <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c4:	89 df                	mov    %ebx,%edi
+  8011c6:	89 de                	mov    %ebx,%esi
+  8011c8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011ca:	5b                   	pop    %ebx
+  8011cb:	5e                   	pop    %esi
+  8011cc:	5f                   	pop    %edi
+  8011cd:	5d                   	pop    %ebp
+  8011ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011da:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011df:	89 df                	mov    %ebx,%edi
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+  8011e4:	8d 35 ec 11 80 00    	lea    0x8011ec,%esi
+  8011ea:	0f 34                	sysenter
+  8011ec:	5d                   	pop    %ebp
+		goto out;
+  8011ed:	eb db                	jmp    8011ca <sys_ipc_recv_until+0x25>
+
+008011ef <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011fc:	74 19                	je     801217 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8011fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801203:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801208:	89 d1                	mov    %edx,%ecx
+  80120a:	89 d3                	mov    %edx,%ebx
+  80120c:	89 d7                	mov    %edx,%edi
+  80120e:	89 d6                	mov    %edx,%esi
+  801210:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801221:	89 d1                	mov    %edx,%ecx
+  801223:	89 d3                	mov    %edx,%ebx
+  801225:	89 d7                	mov    %edx,%edi
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	8d 35 32 12 80 00    	lea    0x801232,%esi
+  801230:	0f 34                	sysenter
+  801232:	5d                   	pop    %ebp
+		goto out;
+  801233:	eb dd                	jmp    801212 <sys_time_msec+0x23>
+
+00801235 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  801238:	57                   	push   %edi
+  801239:	56                   	push   %esi
+  80123a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80123b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801242:	74 1a                	je     80125e <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801244:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801249:	b8 10 00 00 00       	mov    $0x10,%eax
+  80124e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801251:	89 cb                	mov    %ecx,%ebx
+  801253:	89 cf                	mov    %ecx,%edi
+  801255:	89 ce                	mov    %ecx,%esi
+  801257:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801259:	5b                   	pop    %ebx
+  80125a:	5e                   	pop    %esi
+  80125b:	5f                   	pop    %edi
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80125e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801261:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801266:	b8 10 00 00 00       	mov    $0x10,%eax
+  80126b:	89 cb                	mov    %ecx,%ebx
+  80126d:	89 cf                	mov    %ecx,%edi
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	8d 35 7a 12 80 00    	lea    0x80127a,%esi
+  801278:	0f 34                	sysenter
+  80127a:	5d                   	pop    %ebp
+		goto out;
+  80127b:	eb dc                	jmp    801259 <sys_sleep_until+0x24>
+
+0080127d <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	57                   	push   %edi
+  801281:	56                   	push   %esi
+  801282:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801283:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80128a:	74 1a                	je     8012a6 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80128c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801291:	b8 11 00 00 00       	mov    $0x11,%eax
+  801296:	8b 55 08             	mov    0x8(%ebp),%edx
+  801299:	89 cb                	mov    %ecx,%ebx
+  80129b:	89 cf                	mov    %ecx,%edi
+  80129d:	89 ce                	mov    %ecx,%esi
+  80129f:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012a1:	5b                   	pop    %ebx
+  8012a2:	5e                   	pop    %esi
+  8012a3:	5f                   	pop    %edi
+  8012a4:	5d                   	pop    %ebp
+  8012a5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ae:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012b3:	89 cb                	mov    %ecx,%ebx
+  8012b5:	89 cf                	mov    %ecx,%edi
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	8d 35 c2 12 80 00    	lea    0x8012c2,%esi
+  8012c0:	0f 34                	sysenter
+  8012c2:	5d                   	pop    %ebp
+		goto out;
+  8012c3:	eb dc                	jmp    8012a1 <sys_env_print_stats+0x24>
+
+008012c5 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012c5:	55                   	push   %ebp
+  8012c6:	89 e5                	mov    %esp,%ebp
+  8012c8:	57                   	push   %edi
+  8012c9:	56                   	push   %esi
+  8012ca:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012cb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012d2:	74 1b                	je     8012ef <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	89 df                	mov    %ebx,%edi
+  8012e6:	89 de                	mov    %ebx,%esi
+  8012e8:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012ff:	89 df                	mov    %ebx,%edi
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  801304:	8d 35 0c 13 80 00    	lea    0x80130c,%esi
+  80130a:	0f 34                	sysenter
+  80130c:	5d                   	pop    %ebp
+		goto out;
+  80130d:	eb db                	jmp    8012ea <sys_perf+0x25>
+
+0080130f <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801315:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80131c:	74 19                	je     801337 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80131e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801323:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801328:	89 d1                	mov    %edx,%ecx
+  80132a:	89 d3                	mov    %edx,%ebx
+  80132c:	89 d7                	mov    %edx,%edi
+  80132e:	89 d6                	mov    %edx,%esi
+  801330:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801332:	5b                   	pop    %ebx
+  801333:	5e                   	pop    %esi
+  801334:	5f                   	pop    %edi
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801341:	89 d1                	mov    %edx,%ecx
+  801343:	89 d3                	mov    %edx,%ebx
+  801345:	89 d7                	mov    %edx,%edi
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	8d 35 52 13 80 00    	lea    0x801352,%esi
+  801350:	0f 34                	sysenter
+  801352:	5d                   	pop    %ebp
+		goto out;
+  801353:	eb dd                	jmp    801332 <sys_fork+0x23>
+
+00801355 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801355:	55                   	push   %ebp
+  801356:	89 e5                	mov    %esp,%ebp
+  801358:	57                   	push   %edi
+  801359:	56                   	push   %esi
+  80135a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80135b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801362:	74 1c                	je     801380 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801364:	be 00 00 00 00       	mov    $0x0,%esi
+  801369:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80136e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801374:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801377:	89 f7                	mov    %esi,%edi
+  801379:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80137b:	5b                   	pop    %ebx
+  80137c:	5e                   	pop    %esi
+  80137d:	5f                   	pop    %edi
+  80137e:	5d                   	pop    %ebp
+  80137f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801380:	8b 55 08             	mov    0x8(%ebp),%edx
+  801383:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801386:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80138b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801390:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	8d 35 9e 13 80 00    	lea    0x80139e,%esi
+  80139c:	0f 34                	sysenter
+  80139e:	5d                   	pop    %ebp
+		goto out;
+  80139f:	eb da                	jmp    80137b <sys_thread_create+0x26>
+
+008013a1 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013a1:	55                   	push   %ebp
+  8013a2:	89 e5                	mov    %esp,%ebp
+  8013a4:	57                   	push   %edi
+  8013a5:	56                   	push   %esi
+  8013a6:	53                   	push   %ebx
+  8013a7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013aa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013b1:	74 24                	je     8013d7 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013b3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013cb:	85 c0                	test   %eax,%eax
+  8013cd:	7f 27                	jg     8013f6 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d2:	5b                   	pop    %ebx
+  8013d3:	5e                   	pop    %esi
+  8013d4:	5f                   	pop    %edi
+  8013d5:	5d                   	pop    %ebp
+  8013d6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013dd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013e8:	55                   	push   %ebp
+  8013e9:	89 e5                	mov    %esp,%ebp
+  8013eb:	8d 35 f3 13 80 00    	lea    0x8013f3,%esi
+  8013f1:	0f 34                	sysenter
+  8013f3:	5d                   	pop    %ebp
+		goto out;
+  8013f4:	eb d5                	jmp    8013cb <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013f6:	83 ec 0c             	sub    $0xc,%esp
+  8013f9:	50                   	push   %eax
+  8013fa:	6a 1f                	push   $0x1f
+  8013fc:	68 6b 37 80 00       	push   $0x80376b
+  801401:	6a 3f                	push   $0x3f
+  801403:	68 88 37 80 00       	push   $0x803788
+  801408:	e8 6c ed ff ff       	call   800179 <_panic>
+
+0080140d <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	57                   	push   %edi
+  801411:	56                   	push   %esi
+  801412:	53                   	push   %ebx
+  801413:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801416:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80141d:	74 23                	je     801442 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80141f:	be 00 00 00 00       	mov    $0x0,%esi
+  801424:	b8 20 00 00 00       	mov    $0x20,%eax
+  801429:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801432:	89 f7                	mov    %esi,%edi
+  801434:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801436:	85 c0                	test   %eax,%eax
+  801438:	7f 29                	jg     801463 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80143a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143d:	5b                   	pop    %ebx
+  80143e:	5e                   	pop    %esi
+  80143f:	5f                   	pop    %edi
+  801440:	5d                   	pop    %ebp
+  801441:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801442:	8b 55 08             	mov    0x8(%ebp),%edx
+  801445:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801448:	b8 20 00 00 00       	mov    $0x20,%eax
+  80144d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801452:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	8d 35 60 14 80 00    	lea    0x801460,%esi
+  80145e:	0f 34                	sysenter
+  801460:	5d                   	pop    %ebp
+		goto out;
+  801461:	eb d3                	jmp    801436 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801463:	83 ec 0c             	sub    $0xc,%esp
+  801466:	50                   	push   %eax
+  801467:	6a 20                	push   $0x20
+  801469:	68 6b 37 80 00       	push   $0x80376b
+  80146e:	6a 3f                	push   $0x3f
+  801470:	68 88 37 80 00       	push   $0x803788
+  801475:	e8 ff ec ff ff       	call   800179 <_panic>
+
+0080147a <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	57                   	push   %edi
+  80147e:	56                   	push   %esi
+  80147f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801480:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801487:	74 1b                	je     8014a4 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801489:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801493:	8b 55 08             	mov    0x8(%ebp),%edx
+  801496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801499:	89 df                	mov    %ebx,%edi
+  80149b:	89 de                	mov    %ebx,%esi
+  80149d:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80149f:	5b                   	pop    %ebx
+  8014a0:	5e                   	pop    %esi
+  8014a1:	5f                   	pop    %edi
+  8014a2:	5d                   	pop    %ebp
+  8014a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014af:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014b4:	89 df                	mov    %ebx,%edi
+  8014b6:	55                   	push   %ebp
+  8014b7:	89 e5                	mov    %esp,%ebp
+  8014b9:	8d 35 c1 14 80 00    	lea    0x8014c1,%esi
+  8014bf:	0f 34                	sysenter
+  8014c1:	5d                   	pop    %ebp
+		goto out;
+  8014c2:	eb db                	jmp    80149f <sys_batch+0x25>
+
+008014c4 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014c4:	55                   	push   %ebp
+  8014c5:	89 e5                	mov    %esp,%ebp
+  8014c7:	57                   	push   %edi
+  8014c8:	56                   	push   %esi
+  8014c9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ca:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014d1:	74 1a                	je     8014ed <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8014d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e0:	89 cb                	mov    %ecx,%ebx
+  8014e2:	89 cf                	mov    %ecx,%edi
+  8014e4:	89 ce                	mov    %ecx,%esi
+  8014e6:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5f                   	pop    %edi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014fa:	89 cb                	mov    %ecx,%ebx
+  8014fc:	89 cf                	mov    %ecx,%edi
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	8d 35 09 15 80 00    	lea    0x801509,%esi
+  801507:	0f 34                	sysenter
+  801509:	5d                   	pop    %ebp
+		goto out;
+  80150a:	eb dc                	jmp    8014e8 <sys_trace_ctl+0x24>
+
+0080150c <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80150c:	55                   	push   %ebp
+  80150d:	89 e5                	mov    %esp,%ebp
+  80150f:	57                   	push   %edi
+  801510:	56                   	push   %esi
+  801511:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801512:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801519:	74 1c                	je     801537 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80151b:	be 00 00 00 00       	mov    $0x0,%esi
+  801520:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801525:	8b 55 08             	mov    0x8(%ebp),%edx
+  801528:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152e:	89 f7                	mov    %esi,%edi
+  801530:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801532:	5b                   	pop    %ebx
+  801533:	5e                   	pop    %esi
+  801534:	5f                   	pop    %edi
+  801535:	5d                   	pop    %ebp
+  801536:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801542:	bf 00 00 00 00       	mov    $0x0,%edi
+  801547:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154a:	55                   	push   %ebp
+  80154b:	89 e5                	mov    %esp,%ebp
+  80154d:	8d 35 55 15 80 00    	lea    0x801555,%esi
+  801553:	0f 34                	sysenter
+  801555:	5d                   	pop    %ebp
+		goto out;
+  801556:	eb da                	jmp    801532 <sys_trace_read+0x26>
+
+00801558 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801558:	55                   	push   %ebp
+  801559:	89 e5                	mov    %esp,%ebp
+  80155b:	57                   	push   %edi
+  80155c:	56                   	push   %esi
+  80155d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80155e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801565:	74 1c                	je     801583 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801567:	be 00 00 00 00       	mov    $0x0,%esi
+  80156c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801571:	8b 55 08             	mov    0x8(%ebp),%edx
+  801574:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801577:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157a:	89 f7                	mov    %esi,%edi
+  80157c:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80157e:	5b                   	pop    %ebx
+  80157f:	5e                   	pop    %esi
+  801580:	5f                   	pop    %edi
+  801581:	5d                   	pop    %ebp
+  801582:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801583:	8b 55 08             	mov    0x8(%ebp),%edx
+  801586:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801589:	b8 21 00 00 00       	mov    $0x21,%eax
+  80158e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801593:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	8d 35 a1 15 80 00    	lea    0x8015a1,%esi
+  80159f:	0f 34                	sysenter
+  8015a1:	5d                   	pop    %ebp
+		goto out;
+  8015a2:	eb da                	jmp    80157e <sys_meminfo+0x26>
+
+008015a4 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015a4:	55                   	push   %ebp
+  8015a5:	89 e5                	mov    %esp,%ebp
+  8015a7:	57                   	push   %edi
+  8015a8:	56                   	push   %esi
+  8015a9:	53                   	push   %ebx
+  8015aa:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015ad:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015b1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015b8:	74 1f                	je     8015d9 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bf:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c7:	89 df                	mov    %ebx,%edi
+  8015c9:	89 de                	mov    %ebx,%esi
+  8015cb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015cd:	85 c0                	test   %eax,%eax
+  8015cf:	7f 25                	jg     8015f6 <sys_env_set_ksm+0x52>
+}
+  8015d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d4:	5b                   	pop    %ebx
+  8015d5:	5e                   	pop    %esi
+  8015d6:	5f                   	pop    %edi
+  8015d7:	5d                   	pop    %ebp
+  8015d8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e1:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	55                   	push   %ebp
+  8015e9:	89 e5                	mov    %esp,%ebp
+  8015eb:	8d 35 f3 15 80 00    	lea    0x8015f3,%esi
+  8015f1:	0f 34                	sysenter
+  8015f3:	5d                   	pop    %ebp
+		goto out;
+  8015f4:	eb d7                	jmp    8015cd <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015f6:	83 ec 0c             	sub    $0xc,%esp
+  8015f9:	50                   	push   %eax
+  8015fa:	6a 22                	push   $0x22
+  8015fc:	68 6b 37 80 00       	push   $0x80376b
+  801601:	6a 3f                	push   $0x3f
+  801603:	68 88 37 80 00       	push   $0x803788
+  801608:	e8 6c eb ff ff       	call   800179 <_panic>
+
+0080160d <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	57                   	push   %edi
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801616:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801619:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801620:	74 24                	je     801646 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801622:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801627:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80162c:	89 cb                	mov    %ecx,%ebx
+  80162e:	89 cf                	mov    %ecx,%edi
+  801630:	89 ce                	mov    %ecx,%esi
+  801632:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801634:	85 c0                	test   %eax,%eax
+  801636:	7f 2a                	jg     801662 <sys_time_nsec+0x55>
+	return ns;
+}
+  801638:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80163b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80163e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801641:	5b                   	pop    %ebx
+  801642:	5e                   	pop    %esi
+  801643:	5f                   	pop    %edi
+  801644:	5d                   	pop    %ebp
+  801645:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801646:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801650:	89 cb                	mov    %ecx,%ebx
+  801652:	89 cf                	mov    %ecx,%edi
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	8d 35 5f 16 80 00    	lea    0x80165f,%esi
+  80165d:	0f 34                	sysenter
+  80165f:	5d                   	pop    %ebp
+		goto out;
+  801660:	eb d2                	jmp    801634 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801662:	83 ec 0c             	sub    $0xc,%esp
+  801665:	50                   	push   %eax
+  801666:	6a 0f                	push   $0xf
+  801668:	68 6b 37 80 00       	push   $0x80376b
+  80166d:	6a 3f                	push   $0x3f
+  80166f:	68 88 37 80 00       	push   $0x803788
+  801674:	e8 00 eb ff ff       	call   800179 <_panic>
+
+00801679 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	57                   	push   %edi
+  80167d:	56                   	push   %esi
+  80167e:	53                   	push   %ebx
+  80167f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801682:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801689:	74 22                	je     8016ad <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80168b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801690:	b8 12 00 00 00       	mov    $0x12,%eax
+  801695:	8b 55 08             	mov    0x8(%ebp),%edx
+  801698:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169b:	89 df                	mov    %ebx,%edi
+  80169d:	89 de                	mov    %ebx,%esi
+  80169f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016a1:	85 c0                	test   %eax,%eax
+  8016a3:	7f 28                	jg     8016cd <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a8:	5b                   	pop    %ebx
+  8016a9:	5e                   	pop    %esi
+  8016aa:	5f                   	pop    %edi
+  8016ab:	5d                   	pop    %ebp
+  8016ac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b8:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016bd:	89 df                	mov    %ebx,%edi
+  8016bf:	55                   	push   %ebp
+  8016c0:	89 e5                	mov    %esp,%ebp
+  8016c2:	8d 35 ca 16 80 00    	lea    0x8016ca,%esi
+  8016c8:	0f 34                	sysenter
+  8016ca:	5d                   	pop    %ebp
+		goto out;
+  8016cb:	eb d4                	jmp    8016a1 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016cd:	83 ec 0c             	sub    $0xc,%esp
+  8016d0:	50                   	push   %eax
+  8016d1:	6a 12                	push   $0x12
+  8016d3:	68 6b 37 80 00       	push   $0x80376b
+  8016d8:	6a 3f                	push   $0x3f
+  8016da:	68 88 37 80 00       	push   $0x803788
+  8016df:	e8 95 ea ff ff       	call   800179 <_panic>
+
+008016e4 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016e4:	55                   	push   %ebp
+  8016e5:	89 e5                	mov    %esp,%ebp
+  8016e7:	57                   	push   %edi
+  8016e8:	56                   	push   %esi
+  8016e9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016ea:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016f1:	74 1b                	je     80170e <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8016f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801700:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801703:	89 df                	mov    %ebx,%edi
+  801705:	89 de                	mov    %ebx,%esi
+  801707:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801709:	5b                   	pop    %ebx
+  80170a:	5e                   	pop    %esi
+  80170b:	5f                   	pop    %edi
+  80170c:	5d                   	pop    %ebp
+  80170d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80170e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801713:	8b 55 08             	mov    0x8(%ebp),%edx
+  801716:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801719:	b8 13 00 00 00       	mov    $0x13,%eax
+  80171e:	89 df                	mov    %ebx,%edi
+  801720:	55                   	push   %ebp
+  801721:	89 e5                	mov    %esp,%ebp
+  801723:	8d 35 2b 17 80 00    	lea    0x80172b,%esi
+  801729:	0f 34                	sysenter
+  80172b:	5d                   	pop    %ebp
+		goto out;
+  80172c:	eb db                	jmp    801709 <sys_e1000_receive+0x25>
+
+0080172e <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	57                   	push   %edi
+  801732:	56                   	push   %esi
+  801733:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801734:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80173b:	74 1b                	je     801758 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80173d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801742:	b8 14 00 00 00       	mov    $0x14,%eax
+  801747:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174d:	89 df                	mov    %ebx,%edi
+  80174f:	89 de                	mov    %ebx,%esi
+  801751:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801753:	5b                   	pop    %ebx
+  801754:	5e                   	pop    %esi
+  801755:	5f                   	pop    %edi
+  801756:	5d                   	pop    %ebp
+  801757:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801758:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801760:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801763:	b8 14 00 00 00       	mov    $0x14,%eax
+  801768:	89 df                	mov    %ebx,%edi
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	8d 35 75 17 80 00    	lea    0x801775,%esi
+  801773:	0f 34                	sysenter
+  801775:	5d                   	pop    %ebp
+		goto out;
+  801776:	eb db                	jmp    801753 <sys_e1000_read_hwaddr+0x25>
+
+00801778 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801778:	55                   	push   %ebp
+  801779:	89 e5                	mov    %esp,%ebp
+  80177b:	57                   	push   %edi
+  80177c:	56                   	push   %esi
+  80177d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80177e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801785:	74 1a                	je     8017a1 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801787:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801791:	8b 55 08             	mov    0x8(%ebp),%edx
+  801794:	89 cb                	mov    %ecx,%ebx
+  801796:	89 cf                	mov    %ecx,%edi
+  801798:	89 ce                	mov    %ecx,%esi
+  80179a:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80179c:	5b                   	pop    %ebx
+  80179d:	5e                   	pop    %esi
+  80179e:	5f                   	pop    %edi
+  80179f:	5d                   	pop    %ebp
+  8017a0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a9:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017ae:	89 cb                	mov    %ecx,%ebx
+  8017b0:	89 cf                	mov    %ecx,%edi
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	8d 35 bd 17 80 00    	lea    0x8017bd,%esi
+  8017bb:	0f 34                	sysenter
+  8017bd:	5d                   	pop    %ebp
+		goto out;
+  8017be:	eb dc                	jmp    80179c <sys_sb16_read_version+0x24>
+
+008017c0 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017c0:	55                   	push   %ebp
+  8017c1:	89 e5                	mov    %esp,%ebp
+  8017c3:	57                   	push   %edi
+  8017c4:	56                   	push   %esi
+  8017c5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017c6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017cd:	74 1b                	je     8017ea <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017df:	89 df                	mov    %ebx,%edi
+  8017e1:	89 de                	mov    %ebx,%esi
+  8017e3:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017e5:	5b                   	pop    %ebx
+  8017e6:	5e                   	pop    %esi
+  8017e7:	5f                   	pop    %edi
+  8017e8:	5d                   	pop    %ebp
+  8017e9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017fa:	89 df                	mov    %ebx,%edi
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	8d 35 07 18 80 00    	lea    0x801807,%esi
+  801805:	0f 34                	sysenter
+  801807:	5d                   	pop    %ebp
+		goto out;
+  801808:	eb db                	jmp    8017e5 <sys_sb16_play+0x25>
+
+0080180a <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	53                   	push   %ebx
+  80180e:	83 ec 04             	sub    $0x4,%esp
+  801811:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801813:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80181a:	f6 c4 04             	test   $0x4,%ah
+  80181d:	74 0c                	je     80182b <dupperm+0x21>
+  80181f:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801826:	f6 c4 08             	test   $0x8,%ah
+  801829:	75 62                	jne    80188d <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80182b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801832:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801837:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80183d:	74 19                	je     801858 <dupperm+0x4e>
+  80183f:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801846:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  80184b:	83 f8 01             	cmp    $0x1,%eax
+  80184e:	19 c0                	sbb    %eax,%eax
+  801850:	25 00 08 00 00       	and    $0x800,%eax
+  801855:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801858:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  80185f:	89 c1                	mov    %eax,%ecx
+  801861:	80 cd 04             	or     $0x4,%ch
+  801864:	f6 c7 04             	test   $0x4,%bh
+  801867:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  80186a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801871:	f6 c1 02             	test   $0x2,%cl
+  801874:	74 12                	je     801888 <dupperm+0x7e>
+  801876:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  80187d:	89 c2                	mov    %eax,%edx
+  80187f:	83 ca 02             	or     $0x2,%edx
+  801882:	f6 c5 04             	test   $0x4,%ch
+  801885:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801888:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  80188d:	68 98 37 80 00       	push   $0x803798
+  801892:	68 30 38 80 00       	push   $0x803830
+  801897:	6a 39                	push   $0x39
+  801899:	68 45 38 80 00       	push   $0x803845
+  80189e:	e8 d6 e8 ff ff       	call   800179 <_panic>
+
+008018a3 <pgfault>:
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+  8018a6:	53                   	push   %ebx
+  8018a7:	83 ec 04             	sub    $0x4,%esp
+  8018aa:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8018ad:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8018af:	89 c3                	mov    %eax,%ebx
+  8018b1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8018b7:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8018bb:	74 6d                	je     80192a <pgfault+0x87>
+  8018bd:	89 da                	mov    %ebx,%edx
+  8018bf:	c1 ea 16             	shr    $0x16,%edx
+  8018c2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018c9:	f6 c2 80             	test   $0x80,%dl
+  8018cc:	75 5c                	jne    80192a <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8018ce:	c1 e8 0c             	shr    $0xc,%eax
+  8018d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8018d8:	f6 c4 08             	test   $0x8,%ah
+  8018db:	74 4d                	je     80192a <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8018dd:	83 ec 04             	sub    $0x4,%esp
+  8018e0:	6a 07                	push   $0x7
+  8018e2:	68 00 f0 7f 00       	push   $0x7ff000
+  8018e7:	6a 00                	push   $0x0
+  8018e9:	e8 a6 f4 ff ff       	call   800d94 <sys_page_alloc>
+  8018ee:	83 c4 10             	add    $0x10,%esp
+  8018f1:	85 c0                	test   %eax,%eax
+  8018f3:	78 49                	js     80193e <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8018f5:	83 ec 04             	sub    $0x4,%esp
+  8018f8:	68 00 10 00 00       	push   $0x1000
+  8018fd:	53                   	push   %ebx
+  8018fe:	68 00 f0 7f 00       	push   $0x7ff000
+  801903:	e8 1a f1 ff ff       	call   800a22 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801908:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80190f:	53                   	push   %ebx
+  801910:	6a 00                	push   $0x0
+  801912:	68 00 f0 7f 00       	push   $0x7ff000
+  801917:	6a 00                	push   $0x0
+  801919:	e8 e3 f4 ff ff       	call   800e01 <sys_page_map>
+  80191e:	83 c4 20             	add    $0x20,%esp
+  801921:	85 c0                	test   %eax,%eax
+  801923:	78 2d                	js     801952 <pgfault+0xaf>
+}
+  801925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801928:	c9                   	leave
+  801929:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  80192a:	83 ec 04             	sub    $0x4,%esp
+  80192d:	68 50 38 80 00       	push   $0x803850
+  801932:	6a 1e                	push   $0x1e
+  801934:	68 45 38 80 00       	push   $0x803845
+  801939:	e8 3b e8 ff ff       	call   800179 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  80193e:	83 ec 04             	sub    $0x4,%esp
+  801941:	68 cc 37 80 00       	push   $0x8037cc
+  801946:	6a 29                	push   $0x29
+  801948:	68 45 38 80 00       	push   $0x803845
+  80194d:	e8 27 e8 ff ff       	call   800179 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801952:	50                   	push   %eax
+  801953:	68 00 38 80 00       	push   $0x803800
+  801958:	6a 2e                	push   $0x2e
+  80195a:	68 45 38 80 00       	push   $0x803845
+  80195f:	e8 15 e8 ff ff       	call   800179 <_panic>
+
+00801964 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801964:	55                   	push   %ebp
+  801965:	89 e5                	mov    %esp,%ebp
+  801967:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  80196a:	ff 75 0c             	push   0xc(%ebp)
+  80196d:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801970:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801977:	e8 23 f3 ff ff       	call   800c9f <sys_env_destroy>
+}
+  80197c:	83 c4 10             	add    $0x10,%esp
+  80197f:	c9                   	leave
+  801980:	c3                   	ret
+
+00801981 <ufork>:
+{
+  801981:	55                   	push   %ebp
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	57                   	push   %edi
+  801985:	56                   	push   %esi
+  801986:	53                   	push   %ebx
+  801987:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80198d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801992:	cd 30                	int    $0x30
+  801994:	89 c6                	mov    %eax,%esi
+  801996:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  80199c:	85 c0                	test   %eax,%eax
+  80199e:	78 56                	js     8019f6 <ufork+0x75>
+	if (pid > 0) {
+  8019a0:	0f 8e b3 02 00 00    	jle    801c59 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  8019a6:	83 ec 0c             	sub    $0xc,%esp
+  8019a9:	68 a3 18 80 00       	push   $0x8018a3
+  8019ae:	e8 58 17 00 00       	call   80310b <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  8019b3:	83 c4 08             	add    $0x8,%esp
+  8019b6:	68 72 31 80 00       	push   $0x803172
+  8019bb:	56                   	push   %esi
+  8019bc:	e8 ef f5 ff ff       	call   800fb0 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  8019c1:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  8019c7:	89 1c 24             	mov    %ebx,(%esp)
+  8019ca:	e8 21 03 00 00       	call   801cf0 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  8019cf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8019d6:	6a 07                	push   $0x7
+  8019d8:	68 00 f0 bf ee       	push   $0xeebff000
+  8019dd:	56                   	push   %esi
+  8019de:	53                   	push   %ebx
+  8019df:	e8 8d 04 00 00       	call   801e71 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  8019e4:	83 c4 20             	add    $0x20,%esp
+  8019e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ec:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  8019f2:	89 fe                	mov    %edi,%esi
+  8019f4:	eb 22                	jmp    801a18 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  8019f6:	50                   	push   %eax
+  8019f7:	68 69 38 80 00       	push   $0x803869
+  8019fc:	68 a9 00 00 00       	push   $0xa9
+  801a01:	68 45 38 80 00       	push   $0x803845
+  801a06:	e8 6e e7 ff ff       	call   800179 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801a0b:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801a11:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801a16:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a18:	89 f7                	mov    %esi,%edi
+  801a1a:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801a20:	0f 87 e9 01 00 00    	ja     801c0f <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801a26:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801a2c:	85 f6                	test   %esi,%esi
+  801a2e:	0f 49 d6             	cmovns %esi,%edx
+  801a31:	c1 fa 0a             	sar    $0xa,%edx
+  801a34:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801a3b:	f6 c1 01             	test   $0x1,%cl
+  801a3e:	74 cb                	je     801a0b <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801a40:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a47:	f6 c2 80             	test   $0x80,%dl
+  801a4a:	75 17                	jne    801a63 <ufork+0xe2>
+			j = i + 1;
+  801a4c:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801a4f:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801a56:	f6 c2 01             	test   $0x1,%dl
+  801a59:	0f 85 f3 00 00 00    	jne    801b52 <ufork+0x1d1>
+			j = i + 1;
+  801a5f:	89 de                	mov    %ebx,%esi
+  801a61:	eb b5                	jmp    801a18 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801a63:	89 fb                	mov    %edi,%ebx
+  801a65:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801a68:	89 d8                	mov    %ebx,%eax
+  801a6a:	c1 e8 16             	shr    $0x16,%eax
+  801a6d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a74:	89 c2                	mov    %eax,%edx
+  801a76:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801a7c:	25 02 04 00 00       	and    $0x402,%eax
+  801a81:	83 f8 02             	cmp    $0x2,%eax
+  801a84:	74 31                	je     801ab7 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801a86:	83 ec 04             	sub    $0x4,%esp
+  801a89:	6a 01                	push   $0x1
+  801a8b:	52                   	push   %edx
+  801a8c:	53                   	push   %ebx
+  801a8d:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801a93:	53                   	push   %ebx
+  801a94:	6a 00                	push   $0x0
+  801a96:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801a9c:	50                   	push   %eax
+  801a9d:	e8 fa 03 00 00       	call   801e9c <batch_map>
+		return;
+  801aa2:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801aa5:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801aab:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801ab0:	89 c6                	mov    %eax,%esi
+				continue;
+  801ab2:	e9 61 ff ff ff       	jmp    801a18 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801ab7:	83 ec 04             	sub    $0x4,%esp
+  801aba:	80 ca 80             	or     $0x80,%dl
+  801abd:	52                   	push   %edx
+  801abe:	53                   	push   %ebx
+  801abf:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801ac5:	e8 ca f2 ff ff       	call   800d94 <sys_page_alloc>
+  801aca:	83 c4 10             	add    $0x10,%esp
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	78 5d                	js     801b2e <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801ad1:	83 ec 0c             	sub    $0xc,%esp
+  801ad4:	6a 07                	push   $0x7
+  801ad6:	68 00 00 40 00       	push   $0x400000
+  801adb:	6a 00                	push   $0x0
+  801add:	53                   	push   %ebx
+  801ade:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801ae4:	e8 18 f3 ff ff       	call   800e01 <sys_page_map>
+  801ae9:	83 c4 20             	add    $0x20,%esp
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	78 50                	js     801b40 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801af0:	83 ec 04             	sub    $0x4,%esp
+  801af3:	68 00 00 40 00       	push   $0x400000
+  801af8:	53                   	push   %ebx
+  801af9:	68 00 00 40 00       	push   $0x400000
+  801afe:	e8 1f ef ff ff       	call   800a22 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801b03:	83 c4 08             	add    $0x8,%esp
+  801b06:	68 00 00 40 00       	push   $0x400000
+  801b0b:	6a 00                	push   $0x0
+  801b0d:	e8 5d f3 ff ff       	call   800e6f <sys_page_unmap>
+  801b12:	83 c4 10             	add    $0x10,%esp
+  801b15:	85 c0                	test   %eax,%eax
+  801b17:	79 8c                	jns    801aa5 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801b19:	50                   	push   %eax
+  801b1a:	68 9d 38 80 00       	push   $0x80389d
+  801b1f:	68 81 00 00 00       	push   $0x81
+  801b24:	68 45 38 80 00       	push   $0x803845
+  801b29:	e8 4b e6 ff ff       	call   800179 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801b2e:	50                   	push   %eax
+  801b2f:	68 79 38 80 00       	push   $0x803879
+  801b34:	6a 7c                	push   $0x7c
+  801b36:	68 45 38 80 00       	push   $0x803845
+  801b3b:	e8 39 e6 ff ff       	call   800179 <_panic>
+		panic("sys_page_map: %e", r);
+  801b40:	50                   	push   %eax
+  801b41:	68 8c 38 80 00       	push   $0x80388c
+  801b46:	6a 7e                	push   $0x7e
+  801b48:	68 45 38 80 00       	push   $0x803845
+  801b4d:	e8 27 e6 ff ff       	call   800179 <_panic>
+  801b52:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801b58:	eb 22                	jmp    801b7c <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801b5a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801b61:	a8 01                	test   $0x1,%al
+  801b63:	74 35                	je     801b9a <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801b65:	89 d8                	mov    %ebx,%eax
+  801b67:	e8 9e fc ff ff       	call   80180a <dupperm>
+  801b6c:	89 c6                	mov    %eax,%esi
+  801b6e:	89 f8                	mov    %edi,%eax
+  801b70:	e8 95 fc ff ff       	call   80180a <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801b75:	39 c6                	cmp    %eax,%esi
+  801b77:	75 21                	jne    801b9a <ufork+0x219>
+				j++;
+  801b79:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801b7c:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801b82:	74 16                	je     801b9a <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801b84:	89 d8                	mov    %ebx,%eax
+  801b86:	c1 e8 0a             	shr    $0xa,%eax
+  801b89:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b90:	25 81 00 00 00       	and    $0x81,%eax
+  801b95:	83 f8 01             	cmp    $0x1,%eax
+  801b98:	74 c0                	je     801b5a <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801b9a:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801ba0:	89 d8                	mov    %ebx,%eax
+  801ba2:	29 f0                	sub    %esi,%eax
+  801ba4:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801baa:	89 fe                	mov    %edi,%esi
+  801bac:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801baf:	89 f8                	mov    %edi,%eax
+  801bb1:	e8 54 fc ff ff       	call   80180a <dupperm>
+  801bb6:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801bb8:	83 ec 08             	sub    $0x8,%esp
+  801bbb:	6a 02                	push   $0x2
+  801bbd:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801bc3:	51                   	push   %ecx
+  801bc4:	e8 95 01 00 00       	call   801d5e <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801bc9:	83 c4 0c             	add    $0xc,%esp
+  801bcc:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801bd2:	57                   	push   %edi
+  801bd3:	56                   	push   %esi
+  801bd4:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bda:	56                   	push   %esi
+  801bdb:	6a 00                	push   $0x0
+  801bdd:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801be3:	51                   	push   %ecx
+  801be4:	e8 b3 02 00 00       	call   801e9c <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801be9:	83 c4 1c             	add    $0x1c,%esp
+  801bec:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801bf2:	57                   	push   %edi
+  801bf3:	56                   	push   %esi
+  801bf4:	6a 00                	push   $0x0
+  801bf6:	56                   	push   %esi
+  801bf7:	6a 00                	push   $0x0
+  801bf9:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801bff:	50                   	push   %eax
+  801c00:	e8 97 02 00 00       	call   801e9c <batch_map>
+	return 0;
+  801c05:	83 c4 20             	add    $0x20,%esp
+  801c08:	89 de                	mov    %ebx,%esi
+  801c0a:	e9 09 fe ff ff       	jmp    801a18 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801c0f:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801c15:	83 ec 04             	sub    $0x4,%esp
+  801c18:	6a 02                	push   $0x2
+  801c1a:	56                   	push   %esi
+  801c1b:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801c21:	53                   	push   %ebx
+  801c22:	e8 c9 02 00 00       	call   801ef0 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801c27:	89 1c 24             	mov    %ebx,(%esp)
+  801c2a:	e8 dd 00 00 00       	call   801d0c <batch_flush>
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	78 0e                	js     801c44 <ufork+0x2c3>
+}
+  801c36:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801c3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5f                   	pop    %edi
+  801c42:	5d                   	pop    %ebp
+  801c43:	c3                   	ret
+			panic("fork: %e", r);
+  801c44:	50                   	push   %eax
+  801c45:	68 70 38 80 00       	push   $0x803870
+  801c4a:	68 d7 00 00 00       	push   $0xd7
+  801c4f:	68 45 38 80 00       	push   $0x803845
+  801c54:	e8 20 e5 ff ff       	call   800179 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801c59:	e8 aa f0 ff ff       	call   800d08 <sys_getenvid>
+  801c5e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801c63:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c69:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801c6e:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801c73:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801c7a:	00 00 00 
+  801c7d:	eb b7                	jmp    801c36 <ufork+0x2b5>
+
+00801c7f <fork>:
+{
+  801c7f:	55                   	push   %ebp
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	53                   	push   %ebx
+  801c83:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801c86:	68 a3 18 80 00       	push   $0x8018a3
+  801c8b:	e8 7b 14 00 00       	call   80310b <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801c90:	e8 7a f6 ff ff       	call   80130f <sys_fork>
+  801c95:	89 c3                	mov    %eax,%ebx
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	78 09                	js     801ca7 <fork+0x28>
+	if (pid == 0)
+  801c9e:	74 1c                	je     801cbc <fork+0x3d>
+}
+  801ca0:	89 d8                	mov    %ebx,%eax
+  801ca2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca5:	c9                   	leave
+  801ca6:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801ca7:	50                   	push   %eax
+  801ca8:	68 69 38 80 00       	push   $0x803869
+  801cad:	68 ed 00 00 00       	push   $0xed
+  801cb2:	68 45 38 80 00       	push   $0x803845
+  801cb7:	e8 bd e4 ff ff       	call   800179 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801cbc:	e8 47 f0 ff ff       	call   800d08 <sys_getenvid>
+  801cc1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cc6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ccc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801cd1:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801cd6:	eb c8                	jmp    801ca0 <fork+0x21>
+
+00801cd8 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801cde:	ff 75 0c             	push   0xc(%ebp)
+  801ce1:	ff 75 08             	push   0x8(%ebp)
+  801ce4:	68 64 19 80 00       	push   $0x801964
+  801ce9:	e8 67 f6 ff ff       	call   801355 <sys_thread_create>
+}
+  801cee:	c9                   	leave
+  801cef:	c3                   	ret
+
+00801cf0 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801cf0:	55                   	push   %ebp
+  801cf1:	89 e5                	mov    %esp,%ebp
+  801cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801cf6:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801cfd:	00 00 00 
+	b->b_error = 0;
+  801d00:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801d07:	00 00 00 
+}
+  801d0a:	5d                   	pop    %ebp
+  801d0b:	c3                   	ret
+
+00801d0c <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801d0c:	55                   	push   %ebp
+  801d0d:	89 e5                	mov    %esp,%ebp
+  801d0f:	53                   	push   %ebx
+  801d10:	83 ec 04             	sub    $0x4,%esp
+  801d13:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801d16:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801d1c:	85 c0                	test   %eax,%eax
+  801d1e:	7e 09                	jle    801d29 <batch_flush+0x1d>
+  801d20:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801d27:	74 15                	je     801d3e <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801d29:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801d30:	00 00 00 
+	return b->b_error;
+  801d33:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801d39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d3c:	c9                   	leave
+  801d3d:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801d3e:	83 ec 08             	sub    $0x8,%esp
+  801d41:	50                   	push   %eax
+  801d42:	53                   	push   %ebx
+  801d43:	e8 32 f7 ff ff       	call   80147a <sys_batch>
+  801d48:	83 c4 10             	add    $0x10,%esp
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	79 da                	jns    801d29 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801d4f:	f7 d8                	neg    %eax
+  801d51:	0f b6 c0             	movzbl %al,%eax
+  801d54:	f7 d8                	neg    %eax
+  801d56:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801d5c:	eb cb                	jmp    801d29 <batch_flush+0x1d>
+
+00801d5e <batch_reserve>:
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	83 ec 08             	sub    $0x8,%esp
+  801d64:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801d67:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801d6d:	03 45 0c             	add    0xc(%ebp),%eax
+  801d70:	83 f8 10             	cmp    $0x10,%eax
+  801d73:	7f 02                	jg     801d77 <batch_reserve+0x19>
+}
+  801d75:	c9                   	leave
+  801d76:	c3                   	ret
+		batch_flush(b);
+  801d77:	83 ec 0c             	sub    $0xc,%esp
+  801d7a:	52                   	push   %edx
+  801d7b:	e8 8c ff ff ff       	call   801d0c <batch_flush>
+  801d80:	83 c4 10             	add    $0x10,%esp
+}
+  801d83:	eb f0                	jmp    801d75 <batch_reserve+0x17>
+
+00801d85 <batch_next>:
+{
+  801d85:	55                   	push   %ebp
+  801d86:	89 e5                	mov    %esp,%ebp
+  801d88:	53                   	push   %ebx
+  801d89:	83 ec 04             	sub    $0x4,%esp
+  801d8c:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801d8e:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801d95:	74 28                	je     801dbf <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801d97:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801d9d:	8d 50 01             	lea    0x1(%eax),%edx
+  801da0:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801da6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801da9:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801dab:	83 ec 04             	sub    $0x4,%esp
+  801dae:	6a 1c                	push   $0x1c
+  801db0:	6a 00                	push   $0x0
+  801db2:	53                   	push   %ebx
+  801db3:	e8 35 ec ff ff       	call   8009ed <memset>
+}
+  801db8:	89 d8                	mov    %ebx,%eax
+  801dba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dbd:	c9                   	leave
+  801dbe:	c3                   	ret
+		batch_flush(b);
+  801dbf:	83 ec 0c             	sub    $0xc,%esp
+  801dc2:	50                   	push   %eax
+  801dc3:	e8 44 ff ff ff       	call   801d0c <batch_flush>
+  801dc8:	83 c4 10             	add    $0x10,%esp
+  801dcb:	eb ca                	jmp    801d97 <batch_next+0x12>
+
+00801dcd <batch_page>:
+{
+  801dcd:	55                   	push   %ebp
+  801dce:	89 e5                	mov    %esp,%ebp
+  801dd0:	57                   	push   %edi
+  801dd1:	56                   	push   %esi
+  801dd2:	53                   	push   %ebx
+  801dd3:	83 ec 1c             	sub    $0x1c,%esp
+  801dd6:	89 d3                	mov    %edx,%ebx
+  801dd8:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801dda:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801de0:	85 d2                	test   %edx,%edx
+  801de2:	74 50                	je     801e34 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801de4:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801de7:	01 c1                	add    %eax,%ecx
+  801de9:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801dec:	75 46                	jne    801e34 <batch_page+0x67>
+  801dee:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801df1:	75 41                	jne    801e34 <batch_page+0x67>
+  801df3:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801df6:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801df9:	75 39                	jne    801e34 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801dfb:	83 ea 01             	sub    $0x1,%edx
+  801dfe:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801e01:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801e04:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801e08:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801e0b:	75 27                	jne    801e34 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801e0d:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801e10:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801e14:	89 fa                	mov    %edi,%edx
+  801e16:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801e19:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801e1c:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801e1f:	39 55 08             	cmp    %edx,0x8(%ebp)
+  801e22:	75 10                	jne    801e34 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801e24:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  801e28:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801e2b:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  801e2f:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801e32:	74 2a                	je     801e5e <batch_page+0x91>
+	op = batch_next(b);
+  801e34:	e8 4c ff ff ff       	call   801d85 <batch_next>
+	op->bo_op = opcode;
+  801e39:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  801e3b:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  801e3e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e41:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  801e44:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e47:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  801e4a:	8b 75 10             	mov    0x10(%ebp),%esi
+  801e4d:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  801e50:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801e53:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  801e56:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801e59:	89 78 14             	mov    %edi,0x14(%eax)
+  801e5c:	eb 0b                	jmp    801e69 <batch_page+0x9c>
+		op->bo_npages += npages;
+  801e5e:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  801e62:	03 7d 18             	add    0x18(%ebp),%edi
+  801e65:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  801e69:	83 c4 1c             	add    $0x1c,%esp
+  801e6c:	5b                   	pop    %ebx
+  801e6d:	5e                   	pop    %esi
+  801e6e:	5f                   	pop    %edi
+  801e6f:	5d                   	pop    %ebp
+  801e70:	c3                   	ret
+
+00801e71 <batch_alloc>:
+{
+  801e71:	55                   	push   %ebp
+  801e72:	89 e5                	mov    %esp,%ebp
+  801e74:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  801e77:	ff 75 18             	push   0x18(%ebp)
+  801e7a:	ff 75 14             	push   0x14(%ebp)
+  801e7d:	ff 75 10             	push   0x10(%ebp)
+  801e80:	ff 75 0c             	push   0xc(%ebp)
+  801e83:	6a 00                	push   $0x0
+  801e85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e92:	e8 36 ff ff ff       	call   801dcd <batch_page>
+}
+  801e97:	83 c4 20             	add    $0x20,%esp
+  801e9a:	c9                   	leave
+  801e9b:	c3                   	ret
+
+00801e9c <batch_map>:
+{
+  801e9c:	55                   	push   %ebp
+  801e9d:	89 e5                	mov    %esp,%ebp
+  801e9f:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  801ea2:	ff 75 20             	push   0x20(%ebp)
+  801ea5:	ff 75 1c             	push   0x1c(%ebp)
+  801ea8:	ff 75 18             	push   0x18(%ebp)
+  801eab:	ff 75 14             	push   0x14(%ebp)
+  801eae:	ff 75 10             	push   0x10(%ebp)
+  801eb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eb4:	ba 01 00 00 00       	mov    $0x1,%edx
+  801eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebc:	e8 0c ff ff ff       	call   801dcd <batch_page>
+}
+  801ec1:	83 c4 20             	add    $0x20,%esp
+  801ec4:	c9                   	leave
+  801ec5:	c3                   	ret
+
+00801ec6 <batch_unmap>:
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  801ecc:	ff 75 14             	push   0x14(%ebp)
+  801ecf:	6a 00                	push   $0x0
+  801ed1:	ff 75 10             	push   0x10(%ebp)
+  801ed4:	ff 75 0c             	push   0xc(%ebp)
+  801ed7:	6a 00                	push   $0x0
+  801ed9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ede:	ba 02 00 00 00       	mov    $0x2,%edx
+  801ee3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee6:	e8 e2 fe ff ff       	call   801dcd <batch_page>
+}
+  801eeb:	83 c4 20             	add    $0x20,%esp
+  801eee:	c9                   	leave
+  801eef:	c3                   	ret
+
+00801ef0 <batch_set_status>:
+{
+  801ef0:	55                   	push   %ebp
+  801ef1:	89 e5                	mov    %esp,%ebp
+  801ef3:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  801ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef9:	e8 87 fe ff ff       	call   801d85 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  801efe:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  801f04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f07:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  801f0a:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f0d:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  801f10:	c9                   	leave
+  801f11:	c3                   	ret
+
+00801f12 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f18:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f1d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801f20:	5d                   	pop    %ebp
+  801f21:	c3                   	ret
+
+00801f22 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801f22:	55                   	push   %ebp
+  801f23:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f28:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801f2d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f32:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801f37:	5d                   	pop    %ebp
+  801f38:	c3                   	ret
+
+00801f39 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801f39:	55                   	push   %ebp
+  801f3a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801f3c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801f41:	eb 02                	jmp    801f45 <fd_alloc+0xc>
+  801f43:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801f45:	89 c2                	mov    %eax,%edx
+  801f47:	c1 ea 16             	shr    $0x16,%edx
+  801f4a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f51:	f6 c2 01             	test   $0x1,%dl
+  801f54:	74 2b                	je     801f81 <fd_alloc+0x48>
+  801f56:	89 c2                	mov    %eax,%edx
+  801f58:	c1 ea 0c             	shr    $0xc,%edx
+  801f5b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801f62:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801f68:	f6 c1 01             	test   $0x1,%cl
+  801f6b:	74 14                	je     801f81 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801f6d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801f73:	75 ce                	jne    801f43 <fd_alloc+0xa>
+  801f75:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801f7a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801f7f:	eb 05                	jmp    801f86 <fd_alloc+0x4d>
+			return 0;
+  801f81:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801f86:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f89:	89 02                	mov    %eax,(%edx)
+}
+  801f8b:	89 c8                	mov    %ecx,%eax
+  801f8d:	5d                   	pop    %ebp
+  801f8e:	c3                   	ret
+
+00801f8f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801f95:	83 f8 1f             	cmp    $0x1f,%eax
+  801f98:	77 30                	ja     801fca <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801f9a:	c1 e0 0c             	shl    $0xc,%eax
+  801f9d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801fa2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801fa8:	f6 c2 01             	test   $0x1,%dl
+  801fab:	74 24                	je     801fd1 <fd_lookup+0x42>
+  801fad:	89 c2                	mov    %eax,%edx
+  801faf:	c1 ea 0c             	shr    $0xc,%edx
+  801fb2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801fb9:	f6 c2 01             	test   $0x1,%dl
+  801fbc:	74 1a                	je     801fd8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801fbe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fc1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc8:	5d                   	pop    %ebp
+  801fc9:	c3                   	ret
+		return -E_INVAL;
+  801fca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fcf:	eb f7                	jmp    801fc8 <fd_lookup+0x39>
+		return -E_INVAL;
+  801fd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fd6:	eb f0                	jmp    801fc8 <fd_lookup+0x39>
+  801fd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fdd:	eb e9                	jmp    801fc8 <fd_lookup+0x39>
+
+00801fdf <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801fdf:	55                   	push   %ebp
+  801fe0:	89 e5                	mov    %esp,%ebp
+  801fe2:	53                   	push   %ebx
+  801fe3:	83 ec 04             	sub    $0x4,%esp
+  801fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fee:	eb 03                	jmp    801ff3 <dev_lookup+0x14>
+  801ff0:	83 c0 01             	add    $0x1,%eax
+  801ff3:	8b 1c 85 2c 39 80 00 	mov    0x80392c(,%eax,4),%ebx
+  801ffa:	85 db                	test   %ebx,%ebx
+  801ffc:	74 0b                	je     802009 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801ffe:	39 13                	cmp    %edx,(%ebx)
+  802000:	75 ee                	jne    801ff0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802002:	b8 00 00 00 00       	mov    $0x0,%eax
+  802007:	eb 2e                	jmp    802037 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  802009:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80200b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802010:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802016:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80201b:	76 24                	jbe    802041 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80201d:	8b 41 48             	mov    0x48(%ecx),%eax
+  802020:	83 ec 04             	sub    $0x4,%esp
+  802023:	52                   	push   %edx
+  802024:	50                   	push   %eax
+  802025:	68 b0 38 80 00       	push   $0x8038b0
+  80202a:	e8 25 e2 ff ff       	call   800254 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80202f:	83 c4 10             	add    $0x10,%esp
+  802032:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802037:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80203a:	89 1a                	mov    %ebx,(%edx)
+}
+  80203c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80203f:	c9                   	leave
+  802040:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802041:	c1 e8 10             	shr    $0x10,%eax
+  802044:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80204a:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802050:	eb cb                	jmp    80201d <dev_lookup+0x3e>
+
+00802052 <fd_close>:
+{
+  802052:	55                   	push   %ebp
+  802053:	89 e5                	mov    %esp,%ebp
+  802055:	57                   	push   %edi
+  802056:	56                   	push   %esi
+  802057:	53                   	push   %ebx
+  802058:	83 ec 24             	sub    $0x24,%esp
+  80205b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80205e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802061:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802064:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802065:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80206b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80206e:	50                   	push   %eax
+  80206f:	e8 1b ff ff ff       	call   801f8f <fd_lookup>
+  802074:	89 c3                	mov    %eax,%ebx
+  802076:	83 c4 10             	add    $0x10,%esp
+  802079:	85 c0                	test   %eax,%eax
+  80207b:	78 05                	js     802082 <fd_close+0x30>
+	    || fd != fd2)
+  80207d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802080:	74 16                	je     802098 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802082:	89 f8                	mov    %edi,%eax
+  802084:	84 c0                	test   %al,%al
+  802086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80208e:	89 d8                	mov    %ebx,%eax
+  802090:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802093:	5b                   	pop    %ebx
+  802094:	5e                   	pop    %esi
+  802095:	5f                   	pop    %edi
+  802096:	5d                   	pop    %ebp
+  802097:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802098:	83 ec 08             	sub    $0x8,%esp
+  80209b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80209e:	50                   	push   %eax
+  80209f:	ff 36                	push   (%esi)
+  8020a1:	e8 39 ff ff ff       	call   801fdf <dev_lookup>
+  8020a6:	89 c3                	mov    %eax,%ebx
+  8020a8:	83 c4 10             	add    $0x10,%esp
+  8020ab:	85 c0                	test   %eax,%eax
+  8020ad:	78 1a                	js     8020c9 <fd_close+0x77>
+		if (dev->dev_close)
+  8020af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020b2:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8020b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8020ba:	85 c0                	test   %eax,%eax
+  8020bc:	74 0b                	je     8020c9 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8020be:	83 ec 0c             	sub    $0xc,%esp
+  8020c1:	56                   	push   %esi
+  8020c2:	ff d0                	call   *%eax
+  8020c4:	89 c3                	mov    %eax,%ebx
+  8020c6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8020c9:	83 ec 08             	sub    $0x8,%esp
+  8020cc:	56                   	push   %esi
+  8020cd:	6a 00                	push   $0x0
+  8020cf:	e8 9b ed ff ff       	call   800e6f <sys_page_unmap>
+	return r;
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	eb b5                	jmp    80208e <fd_close+0x3c>
+
+008020d9 <close>:
+
+int
+close(int fdnum)
+{
+  8020d9:	55                   	push   %ebp
+  8020da:	89 e5                	mov    %esp,%ebp
+  8020dc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e2:	50                   	push   %eax
+  8020e3:	ff 75 08             	push   0x8(%ebp)
+  8020e6:	e8 a4 fe ff ff       	call   801f8f <fd_lookup>
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	79 02                	jns    8020f4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+		return fd_close(fd, 1);
+  8020f4:	83 ec 08             	sub    $0x8,%esp
+  8020f7:	6a 01                	push   $0x1
+  8020f9:	ff 75 f4             	push   -0xc(%ebp)
+  8020fc:	e8 51 ff ff ff       	call   802052 <fd_close>
+  802101:	83 c4 10             	add    $0x10,%esp
+  802104:	eb ec                	jmp    8020f2 <close+0x19>
+
+00802106 <close_all>:
+
+void
+close_all(void)
+{
+  802106:	55                   	push   %ebp
+  802107:	89 e5                	mov    %esp,%ebp
+  802109:	53                   	push   %ebx
+  80210a:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80210d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802112:	83 ec 0c             	sub    $0xc,%esp
+  802115:	53                   	push   %ebx
+  802116:	e8 be ff ff ff       	call   8020d9 <close>
+	for (i = 0; i < MAXFD; i++)
+  80211b:	83 c3 01             	add    $0x1,%ebx
+  80211e:	83 c4 10             	add    $0x10,%esp
+  802121:	83 fb 20             	cmp    $0x20,%ebx
+  802124:	75 ec                	jne    802112 <close_all+0xc>
+}
+  802126:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802129:	c9                   	leave
+  80212a:	c3                   	ret
+
+0080212b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80212b:	55                   	push   %ebp
+  80212c:	89 e5                	mov    %esp,%ebp
+  80212e:	57                   	push   %edi
+  80212f:	56                   	push   %esi
+  802130:	53                   	push   %ebx
+  802131:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802134:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802137:	50                   	push   %eax
+  802138:	ff 75 08             	push   0x8(%ebp)
+  80213b:	e8 4f fe ff ff       	call   801f8f <fd_lookup>
+  802140:	89 c3                	mov    %eax,%ebx
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	85 c0                	test   %eax,%eax
+  802147:	78 7f                	js     8021c8 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802149:	83 ec 0c             	sub    $0xc,%esp
+  80214c:	ff 75 0c             	push   0xc(%ebp)
+  80214f:	e8 85 ff ff ff       	call   8020d9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802154:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802157:	c1 e6 0c             	shl    $0xc,%esi
+  80215a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802160:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802163:	89 3c 24             	mov    %edi,(%esp)
+  802166:	e8 b7 fd ff ff       	call   801f22 <fd2data>
+  80216b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80216d:	89 34 24             	mov    %esi,(%esp)
+  802170:	e8 ad fd ff ff       	call   801f22 <fd2data>
+  802175:	83 c4 10             	add    $0x10,%esp
+  802178:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80217b:	89 d8                	mov    %ebx,%eax
+  80217d:	c1 e8 16             	shr    $0x16,%eax
+  802180:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802187:	a8 01                	test   $0x1,%al
+  802189:	74 11                	je     80219c <dup+0x71>
+  80218b:	89 d8                	mov    %ebx,%eax
+  80218d:	c1 e8 0c             	shr    $0xc,%eax
+  802190:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802197:	f6 c2 01             	test   $0x1,%dl
+  80219a:	75 36                	jne    8021d2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80219c:	89 f8                	mov    %edi,%eax
+  80219e:	c1 e8 0c             	shr    $0xc,%eax
+  8021a1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021a8:	83 ec 0c             	sub    $0xc,%esp
+  8021ab:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021b0:	50                   	push   %eax
+  8021b1:	56                   	push   %esi
+  8021b2:	6a 00                	push   $0x0
+  8021b4:	57                   	push   %edi
+  8021b5:	6a 00                	push   $0x0
+  8021b7:	e8 45 ec ff ff       	call   800e01 <sys_page_map>
+  8021bc:	89 c3                	mov    %eax,%ebx
+  8021be:	83 c4 20             	add    $0x20,%esp
+  8021c1:	85 c0                	test   %eax,%eax
+  8021c3:	78 33                	js     8021f8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8021c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8021c8:	89 d8                	mov    %ebx,%eax
+  8021ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cd:	5b                   	pop    %ebx
+  8021ce:	5e                   	pop    %esi
+  8021cf:	5f                   	pop    %edi
+  8021d0:	5d                   	pop    %ebp
+  8021d1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8021d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021d9:	83 ec 0c             	sub    $0xc,%esp
+  8021dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021e1:	50                   	push   %eax
+  8021e2:	ff 75 d4             	push   -0x2c(%ebp)
+  8021e5:	6a 00                	push   $0x0
+  8021e7:	53                   	push   %ebx
+  8021e8:	6a 00                	push   $0x0
+  8021ea:	e8 12 ec ff ff       	call   800e01 <sys_page_map>
+  8021ef:	89 c3                	mov    %eax,%ebx
+  8021f1:	83 c4 20             	add    $0x20,%esp
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	79 a4                	jns    80219c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8021f8:	83 ec 08             	sub    $0x8,%esp
+  8021fb:	56                   	push   %esi
+  8021fc:	6a 00                	push   $0x0
+  8021fe:	e8 6c ec ff ff       	call   800e6f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802203:	83 c4 08             	add    $0x8,%esp
+  802206:	ff 75 d4             	push   -0x2c(%ebp)
+  802209:	6a 00                	push   $0x0
+  80220b:	e8 5f ec ff ff       	call   800e6f <sys_page_unmap>
+	return r;
+  802210:	83 c4 10             	add    $0x10,%esp
+  802213:	eb b3                	jmp    8021c8 <dup+0x9d>
+
+00802215 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802215:	55                   	push   %ebp
+  802216:	89 e5                	mov    %esp,%ebp
+  802218:	56                   	push   %esi
+  802219:	53                   	push   %ebx
+  80221a:	83 ec 18             	sub    $0x18,%esp
+  80221d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802220:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802223:	50                   	push   %eax
+  802224:	53                   	push   %ebx
+  802225:	e8 65 fd ff ff       	call   801f8f <fd_lookup>
+  80222a:	83 c4 10             	add    $0x10,%esp
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	78 3c                	js     80226d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802231:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802234:	83 ec 08             	sub    $0x8,%esp
+  802237:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80223a:	50                   	push   %eax
+  80223b:	ff 36                	push   (%esi)
+  80223d:	e8 9d fd ff ff       	call   801fdf <dev_lookup>
+  802242:	83 c4 10             	add    $0x10,%esp
+  802245:	85 c0                	test   %eax,%eax
+  802247:	78 24                	js     80226d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802249:	8b 46 08             	mov    0x8(%esi),%eax
+  80224c:	83 e0 03             	and    $0x3,%eax
+  80224f:	83 f8 01             	cmp    $0x1,%eax
+  802252:	74 20                	je     802274 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802254:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802257:	8b 40 08             	mov    0x8(%eax),%eax
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	74 57                	je     8022b5 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80225e:	83 ec 04             	sub    $0x4,%esp
+  802261:	ff 75 10             	push   0x10(%ebp)
+  802264:	ff 75 0c             	push   0xc(%ebp)
+  802267:	56                   	push   %esi
+  802268:	ff d0                	call   *%eax
+  80226a:	83 c4 10             	add    $0x10,%esp
+}
+  80226d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802270:	5b                   	pop    %ebx
+  802271:	5e                   	pop    %esi
+  802272:	5d                   	pop    %ebp
+  802273:	c3                   	ret
+  802274:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802276:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80227b:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802281:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802286:	76 1c                	jbe    8022a4 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802288:	8b 42 48             	mov    0x48(%edx),%eax
+  80228b:	83 ec 04             	sub    $0x4,%esp
+  80228e:	53                   	push   %ebx
+  80228f:	50                   	push   %eax
+  802290:	68 f1 38 80 00       	push   $0x8038f1
+  802295:	e8 ba df ff ff       	call   800254 <cprintf>
+		return -E_INVAL;
+  80229a:	83 c4 10             	add    $0x10,%esp
+  80229d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a2:	eb c9                	jmp    80226d <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8022a4:	c1 e8 10             	shr    $0x10,%eax
+  8022a7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8022ad:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8022b3:	eb d3                	jmp    802288 <read+0x73>
+		return -E_NOT_SUPP;
+  8022b5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022ba:	eb b1                	jmp    80226d <read+0x58>
+
+008022bc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8022bc:	55                   	push   %ebp
+  8022bd:	89 e5                	mov    %esp,%ebp
+  8022bf:	57                   	push   %edi
+  8022c0:	56                   	push   %esi
+  8022c1:	53                   	push   %ebx
+  8022c2:	83 ec 0c             	sub    $0xc,%esp
+  8022c5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022c8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8022cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8022d0:	eb 02                	jmp    8022d4 <readn+0x18>
+  8022d2:	01 c3                	add    %eax,%ebx
+  8022d4:	39 f3                	cmp    %esi,%ebx
+  8022d6:	73 21                	jae    8022f9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8022d8:	83 ec 04             	sub    $0x4,%esp
+  8022db:	89 f0                	mov    %esi,%eax
+  8022dd:	29 d8                	sub    %ebx,%eax
+  8022df:	50                   	push   %eax
+  8022e0:	89 d8                	mov    %ebx,%eax
+  8022e2:	03 45 0c             	add    0xc(%ebp),%eax
+  8022e5:	50                   	push   %eax
+  8022e6:	57                   	push   %edi
+  8022e7:	e8 29 ff ff ff       	call   802215 <read>
+		if (m < 0)
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 04                	js     8022f7 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8022f3:	75 dd                	jne    8022d2 <readn+0x16>
+  8022f5:	eb 02                	jmp    8022f9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8022f7:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8022f9:	89 d8                	mov    %ebx,%eax
+  8022fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022fe:	5b                   	pop    %ebx
+  8022ff:	5e                   	pop    %esi
+  802300:	5f                   	pop    %edi
+  802301:	5d                   	pop    %ebp
+  802302:	c3                   	ret
+
+00802303 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	56                   	push   %esi
+  802307:	53                   	push   %ebx
+  802308:	83 ec 18             	sub    $0x18,%esp
+  80230b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80230e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802311:	50                   	push   %eax
+  802312:	53                   	push   %ebx
+  802313:	e8 77 fc ff ff       	call   801f8f <fd_lookup>
+  802318:	83 c4 10             	add    $0x10,%esp
+  80231b:	85 c0                	test   %eax,%eax
+  80231d:	78 37                	js     802356 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80231f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802322:	83 ec 08             	sub    $0x8,%esp
+  802325:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802328:	50                   	push   %eax
+  802329:	ff 36                	push   (%esi)
+  80232b:	e8 af fc ff ff       	call   801fdf <dev_lookup>
+  802330:	83 c4 10             	add    $0x10,%esp
+  802333:	85 c0                	test   %eax,%eax
+  802335:	78 1f                	js     802356 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802337:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80233b:	74 20                	je     80235d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80233d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802340:	8b 40 0c             	mov    0xc(%eax),%eax
+  802343:	85 c0                	test   %eax,%eax
+  802345:	74 57                	je     80239e <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802347:	83 ec 04             	sub    $0x4,%esp
+  80234a:	ff 75 10             	push   0x10(%ebp)
+  80234d:	ff 75 0c             	push   0xc(%ebp)
+  802350:	56                   	push   %esi
+  802351:	ff d0                	call   *%eax
+  802353:	83 c4 10             	add    $0x10,%esp
+}
+  802356:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802359:	5b                   	pop    %ebx
+  80235a:	5e                   	pop    %esi
+  80235b:	5d                   	pop    %ebp
+  80235c:	c3                   	ret
+  80235d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80235f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802364:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80236a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80236f:	76 1c                	jbe    80238d <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802371:	8b 42 48             	mov    0x48(%edx),%eax
+  802374:	83 ec 04             	sub    $0x4,%esp
+  802377:	53                   	push   %ebx
+  802378:	50                   	push   %eax
+  802379:	68 0d 39 80 00       	push   $0x80390d
+  80237e:	e8 d1 de ff ff       	call   800254 <cprintf>
+		return -E_INVAL;
+  802383:	83 c4 10             	add    $0x10,%esp
+  802386:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80238b:	eb c9                	jmp    802356 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80238d:	c1 e8 10             	shr    $0x10,%eax
+  802390:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802396:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80239c:	eb d3                	jmp    802371 <write+0x6e>
+		return -E_NOT_SUPP;
+  80239e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023a3:	eb b1                	jmp    802356 <write+0x53>
+
+008023a5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8023a5:	55                   	push   %ebp
+  8023a6:	89 e5                	mov    %esp,%ebp
+  8023a8:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ae:	50                   	push   %eax
+  8023af:	ff 75 08             	push   0x8(%ebp)
+  8023b2:	e8 d8 fb ff ff       	call   801f8f <fd_lookup>
+  8023b7:	83 c4 10             	add    $0x10,%esp
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	78 0e                	js     8023cc <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8023be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c4:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8023c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023cc:	c9                   	leave
+  8023cd:	c3                   	ret
+
+008023ce <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8023ce:	55                   	push   %ebp
+  8023cf:	89 e5                	mov    %esp,%ebp
+  8023d1:	56                   	push   %esi
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 18             	sub    $0x18,%esp
+  8023d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8023d9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023dc:	50                   	push   %eax
+  8023dd:	53                   	push   %ebx
+  8023de:	e8 ac fb ff ff       	call   801f8f <fd_lookup>
+  8023e3:	83 c4 10             	add    $0x10,%esp
+  8023e6:	85 c0                	test   %eax,%eax
+  8023e8:	78 34                	js     80241e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023ea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023ed:	83 ec 08             	sub    $0x8,%esp
+  8023f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023f3:	50                   	push   %eax
+  8023f4:	ff 36                	push   (%esi)
+  8023f6:	e8 e4 fb ff ff       	call   801fdf <dev_lookup>
+  8023fb:	83 c4 10             	add    $0x10,%esp
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	78 1c                	js     80241e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802402:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802406:	74 1d                	je     802425 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802408:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80240b:	8b 40 18             	mov    0x18(%eax),%eax
+  80240e:	85 c0                	test   %eax,%eax
+  802410:	74 54                	je     802466 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802412:	83 ec 08             	sub    $0x8,%esp
+  802415:	ff 75 0c             	push   0xc(%ebp)
+  802418:	56                   	push   %esi
+  802419:	ff d0                	call   *%eax
+  80241b:	83 c4 10             	add    $0x10,%esp
+}
+  80241e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802421:	5b                   	pop    %ebx
+  802422:	5e                   	pop    %esi
+  802423:	5d                   	pop    %ebp
+  802424:	c3                   	ret
+  802425:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802427:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80242c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802432:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802437:	76 1c                	jbe    802455 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802439:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80243c:	83 ec 04             	sub    $0x4,%esp
+  80243f:	53                   	push   %ebx
+  802440:	50                   	push   %eax
+  802441:	68 d0 38 80 00       	push   $0x8038d0
+  802446:	e8 09 de ff ff       	call   800254 <cprintf>
+		return -E_INVAL;
+  80244b:	83 c4 10             	add    $0x10,%esp
+  80244e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802453:	eb c9                	jmp    80241e <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802455:	c1 e8 10             	shr    $0x10,%eax
+  802458:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80245e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802464:	eb d3                	jmp    802439 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802466:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80246b:	eb b1                	jmp    80241e <ftruncate+0x50>
+
+0080246d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	56                   	push   %esi
+  802471:	53                   	push   %ebx
+  802472:	83 ec 18             	sub    $0x18,%esp
+  802475:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802478:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80247b:	50                   	push   %eax
+  80247c:	ff 75 08             	push   0x8(%ebp)
+  80247f:	e8 0b fb ff ff       	call   801f8f <fd_lookup>
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	85 c0                	test   %eax,%eax
+  802489:	78 49                	js     8024d4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80248b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80248e:	83 ec 08             	sub    $0x8,%esp
+  802491:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802494:	50                   	push   %eax
+  802495:	ff 36                	push   (%esi)
+  802497:	e8 43 fb ff ff       	call   801fdf <dev_lookup>
+  80249c:	83 c4 10             	add    $0x10,%esp
+  80249f:	85 c0                	test   %eax,%eax
+  8024a1:	78 31                	js     8024d4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8024a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024a6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8024aa:	74 2f                	je     8024db <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8024ac:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8024af:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8024b6:	00 00 00 
+	stat->st_isdir = 0;
+  8024b9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024c0:	00 00 00 
+	stat->st_dev = dev;
+  8024c3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8024c9:	83 ec 08             	sub    $0x8,%esp
+  8024cc:	53                   	push   %ebx
+  8024cd:	56                   	push   %esi
+  8024ce:	ff 50 14             	call   *0x14(%eax)
+  8024d1:	83 c4 10             	add    $0x10,%esp
+}
+  8024d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d7:	5b                   	pop    %ebx
+  8024d8:	5e                   	pop    %esi
+  8024d9:	5d                   	pop    %ebp
+  8024da:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024e0:	eb f2                	jmp    8024d4 <fstat+0x67>
+
+008024e2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8024e2:	55                   	push   %ebp
+  8024e3:	89 e5                	mov    %esp,%ebp
+  8024e5:	56                   	push   %esi
+  8024e6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8024e7:	83 ec 08             	sub    $0x8,%esp
+  8024ea:	6a 00                	push   $0x0
+  8024ec:	ff 75 08             	push   0x8(%ebp)
+  8024ef:	e8 e4 01 00 00       	call   8026d8 <open>
+  8024f4:	89 c3                	mov    %eax,%ebx
+  8024f6:	83 c4 10             	add    $0x10,%esp
+  8024f9:	85 c0                	test   %eax,%eax
+  8024fb:	78 1b                	js     802518 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8024fd:	83 ec 08             	sub    $0x8,%esp
+  802500:	ff 75 0c             	push   0xc(%ebp)
+  802503:	50                   	push   %eax
+  802504:	e8 64 ff ff ff       	call   80246d <fstat>
+  802509:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80250b:	89 1c 24             	mov    %ebx,(%esp)
+  80250e:	e8 c6 fb ff ff       	call   8020d9 <close>
+	return r;
+  802513:	83 c4 10             	add    $0x10,%esp
+  802516:	89 f3                	mov    %esi,%ebx
+}
+  802518:	89 d8                	mov    %ebx,%eax
+  80251a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80251d:	5b                   	pop    %ebx
+  80251e:	5e                   	pop    %esi
+  80251f:	5d                   	pop    %ebp
+  802520:	c3                   	ret
+
+00802521 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	56                   	push   %esi
+  802525:	53                   	push   %ebx
+  802526:	89 c6                	mov    %eax,%esi
+  802528:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80252a:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  802531:	74 27                	je     80255a <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802533:	6a 07                	push   $0x7
+  802535:	68 00 60 80 00       	push   $0x806000
+  80253a:	56                   	push   %esi
+  80253b:	ff 35 00 50 80 00    	push   0x805000
+  802541:	e8 41 0d 00 00       	call   803287 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802546:	83 c4 0c             	add    $0xc,%esp
+  802549:	6a 00                	push   $0x0
+  80254b:	53                   	push   %ebx
+  80254c:	6a 00                	push   $0x0
+  80254e:	e8 1c 0d 00 00       	call   80326f <ipc_recv>
+}
+  802553:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802556:	5b                   	pop    %ebx
+  802557:	5e                   	pop    %esi
+  802558:	5d                   	pop    %ebp
+  802559:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80255a:	83 ec 0c             	sub    $0xc,%esp
+  80255d:	6a 01                	push   $0x1
+  80255f:	e8 77 0d 00 00       	call   8032db <ipc_find_env>
+  802564:	a3 00 50 80 00       	mov    %eax,0x805000
+  802569:	83 c4 10             	add    $0x10,%esp
+  80256c:	eb c5                	jmp    802533 <fsipc+0x12>
+
+0080256e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80256e:	55                   	push   %ebp
+  80256f:	89 e5                	mov    %esp,%ebp
+  802571:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802574:	8b 45 08             	mov    0x8(%ebp),%eax
+  802577:	8b 40 0c             	mov    0xc(%eax),%eax
+  80257a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80257f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802582:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802591:	e8 8b ff ff ff       	call   802521 <fsipc>
+}
+  802596:	c9                   	leave
+  802597:	c3                   	ret
+
+00802598 <devfile_flush>:
+{
+  802598:	55                   	push   %ebp
+  802599:	89 e5                	mov    %esp,%ebp
+  80259b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80259e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025a4:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8025a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ae:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025b3:	e8 69 ff ff ff       	call   802521 <fsipc>
+}
+  8025b8:	c9                   	leave
+  8025b9:	c3                   	ret
+
+008025ba <devfile_stat>:
+{
+  8025ba:	55                   	push   %ebp
+  8025bb:	89 e5                	mov    %esp,%ebp
+  8025bd:	53                   	push   %ebx
+  8025be:	83 ec 04             	sub    $0x4,%esp
+  8025c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8025c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025ca:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8025cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8025d9:	e8 43 ff ff ff       	call   802521 <fsipc>
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 2c                	js     80260e <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8025e2:	83 ec 08             	sub    $0x8,%esp
+  8025e5:	68 00 60 80 00       	push   $0x806000
+  8025ea:	53                   	push   %ebx
+  8025eb:	e8 ac e2 ff ff       	call   80089c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8025f0:	a1 80 60 80 00       	mov    0x806080,%eax
+  8025f5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8025fb:	a1 84 60 80 00       	mov    0x806084,%eax
+  802600:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802606:	83 c4 10             	add    $0x10,%esp
+  802609:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80260e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802611:	c9                   	leave
+  802612:	c3                   	ret
+
+00802613 <devfile_write>:
+{
+  802613:	55                   	push   %ebp
+  802614:	89 e5                	mov    %esp,%ebp
+  802616:	83 ec 0c             	sub    $0xc,%esp
+  802619:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80261c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80261f:	8b 52 0c             	mov    0xc(%edx),%edx
+  802622:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802628:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80262d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802632:	39 d0                	cmp    %edx,%eax
+  802634:	0f 47 c2             	cmova  %edx,%eax
+  802637:	50                   	push   %eax
+  802638:	ff 75 0c             	push   0xc(%ebp)
+  80263b:	68 08 60 80 00       	push   $0x806008
+  802640:	e8 dd e3 ff ff       	call   800a22 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802645:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80264f:	e8 cd fe ff ff       	call   802521 <fsipc>
+}
+  802654:	c9                   	leave
+  802655:	c3                   	ret
+
+00802656 <devfile_read>:
+{
+  802656:	55                   	push   %ebp
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	56                   	push   %esi
+  80265a:	53                   	push   %ebx
+  80265b:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80265e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802661:	8b 40 0c             	mov    0xc(%eax),%eax
+  802664:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802669:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80266f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802674:	b8 03 00 00 00       	mov    $0x3,%eax
+  802679:	e8 a3 fe ff ff       	call   802521 <fsipc>
+  80267e:	89 c3                	mov    %eax,%ebx
+  802680:	85 c0                	test   %eax,%eax
+  802682:	78 1f                	js     8026a3 <devfile_read+0x4d>
+	assert(r <= n);
+  802684:	39 c6                	cmp    %eax,%esi
+  802686:	72 24                	jb     8026ac <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802688:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80268d:	7f 33                	jg     8026c2 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80268f:	83 ec 04             	sub    $0x4,%esp
+  802692:	50                   	push   %eax
+  802693:	68 00 60 80 00       	push   $0x806000
+  802698:	ff 75 0c             	push   0xc(%ebp)
+  80269b:	e8 82 e3 ff ff       	call   800a22 <memmove>
+	return r;
+  8026a0:	83 c4 10             	add    $0x10,%esp
+}
+  8026a3:	89 d8                	mov    %ebx,%eax
+  8026a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a8:	5b                   	pop    %ebx
+  8026a9:	5e                   	pop    %esi
+  8026aa:	5d                   	pop    %ebp
+  8026ab:	c3                   	ret
+	assert(r <= n);
+  8026ac:	68 40 39 80 00       	push   $0x803940
+  8026b1:	68 30 38 80 00       	push   $0x803830
+  8026b6:	6a 76                	push   $0x76
+  8026b8:	68 47 39 80 00       	push   $0x803947
+  8026bd:	e8 b7 da ff ff       	call   800179 <_panic>
+	assert(r <= PGSIZE);
+  8026c2:	68 52 39 80 00       	push   $0x803952
+  8026c7:	68 30 38 80 00       	push   $0x803830
+  8026cc:	6a 77                	push   $0x77
+  8026ce:	68 47 39 80 00       	push   $0x803947
+  8026d3:	e8 a1 da ff ff       	call   800179 <_panic>
+
+008026d8 <open>:
+{
+  8026d8:	55                   	push   %ebp
+  8026d9:	89 e5                	mov    %esp,%ebp
+  8026db:	56                   	push   %esi
+  8026dc:	53                   	push   %ebx
+  8026dd:	83 ec 1c             	sub    $0x1c,%esp
+  8026e0:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8026e3:	56                   	push   %esi
+  8026e4:	e8 78 e1 ff ff       	call   800861 <strlen>
+  8026e9:	83 c4 10             	add    $0x10,%esp
+  8026ec:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026f1:	7f 6c                	jg     80275f <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8026f3:	83 ec 0c             	sub    $0xc,%esp
+  8026f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026f9:	50                   	push   %eax
+  8026fa:	e8 3a f8 ff ff       	call   801f39 <fd_alloc>
+  8026ff:	89 c3                	mov    %eax,%ebx
+  802701:	83 c4 10             	add    $0x10,%esp
+  802704:	85 c0                	test   %eax,%eax
+  802706:	78 3c                	js     802744 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802708:	83 ec 08             	sub    $0x8,%esp
+  80270b:	56                   	push   %esi
+  80270c:	68 00 60 80 00       	push   $0x806000
+  802711:	e8 86 e1 ff ff       	call   80089c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802716:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802719:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80271e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802721:	b8 01 00 00 00       	mov    $0x1,%eax
+  802726:	e8 f6 fd ff ff       	call   802521 <fsipc>
+  80272b:	89 c3                	mov    %eax,%ebx
+  80272d:	83 c4 10             	add    $0x10,%esp
+  802730:	85 c0                	test   %eax,%eax
+  802732:	78 19                	js     80274d <open+0x75>
+	return fd2num(fd);
+  802734:	83 ec 0c             	sub    $0xc,%esp
+  802737:	ff 75 f4             	push   -0xc(%ebp)
+  80273a:	e8 d3 f7 ff ff       	call   801f12 <fd2num>
+  80273f:	89 c3                	mov    %eax,%ebx
+  802741:	83 c4 10             	add    $0x10,%esp
+}
+  802744:	89 d8                	mov    %ebx,%eax
+  802746:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802749:	5b                   	pop    %ebx
+  80274a:	5e                   	pop    %esi
+  80274b:	5d                   	pop    %ebp
+  80274c:	c3                   	ret
+		fd_close(fd, 0);
+  80274d:	83 ec 08             	sub    $0x8,%esp
+  802750:	6a 00                	push   $0x0
+  802752:	ff 75 f4             	push   -0xc(%ebp)
+  802755:	e8 f8 f8 ff ff       	call   802052 <fd_close>
+		return r;
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	eb e5                	jmp    802744 <open+0x6c>
+		return -E_BAD_PATH;
+  80275f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802764:	eb de                	jmp    802744 <open+0x6c>
+
+00802766 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802766:	55                   	push   %ebp
+  802767:	89 e5                	mov    %esp,%ebp
+  802769:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80276c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802771:	b8 08 00 00 00       	mov    $0x8,%eax
+  802776:	e8 a6 fd ff ff       	call   802521 <fsipc>
+}
+  80277b:	c9                   	leave
+  80277c:	c3                   	ret
+
+0080277d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80277d:	55                   	push   %ebp
+  80277e:	89 e5                	mov    %esp,%ebp
+  802780:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802783:	68 5e 39 80 00       	push   $0x80395e
+  802788:	ff 75 0c             	push   0xc(%ebp)
+  80278b:	e8 0c e1 ff ff       	call   80089c <strcpy>
+	return 0;
+}
+  802790:	b8 00 00 00 00       	mov    $0x0,%eax
+  802795:	c9                   	leave
+  802796:	c3                   	ret
+
+00802797 <devsock_close>:
+{
+  802797:	55                   	push   %ebp
+  802798:	89 e5                	mov    %esp,%ebp
+  80279a:	53                   	push   %ebx
+  80279b:	83 ec 10             	sub    $0x10,%esp
+  80279e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027a1:	53                   	push   %ebx
+  8027a2:	e8 73 0b 00 00       	call   80331a <pageref>
+  8027a7:	89 c2                	mov    %eax,%edx
+  8027a9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027ac:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027b1:	83 fa 01             	cmp    $0x1,%edx
+  8027b4:	74 05                	je     8027bb <devsock_close+0x24>
+}
+  8027b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027b9:	c9                   	leave
+  8027ba:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027bb:	83 ec 0c             	sub    $0xc,%esp
+  8027be:	ff 73 0c             	push   0xc(%ebx)
+  8027c1:	e8 b7 02 00 00       	call   802a7d <nsipc_close>
+  8027c6:	83 c4 10             	add    $0x10,%esp
+  8027c9:	eb eb                	jmp    8027b6 <devsock_close+0x1f>
+
+008027cb <devsock_write>:
+{
+  8027cb:	55                   	push   %ebp
+  8027cc:	89 e5                	mov    %esp,%ebp
+  8027ce:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8027d1:	6a 00                	push   $0x0
+  8027d3:	ff 75 10             	push   0x10(%ebp)
+  8027d6:	ff 75 0c             	push   0xc(%ebp)
+  8027d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027dc:	ff 70 0c             	push   0xc(%eax)
+  8027df:	e8 79 03 00 00       	call   802b5d <nsipc_send>
+}
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+
+008027e6 <devsock_read>:
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8027ec:	6a 00                	push   $0x0
+  8027ee:	ff 75 10             	push   0x10(%ebp)
+  8027f1:	ff 75 0c             	push   0xc(%ebp)
+  8027f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f7:	ff 70 0c             	push   0xc(%eax)
+  8027fa:	e8 ef 02 00 00       	call   802aee <nsipc_recv>
+}
+  8027ff:	c9                   	leave
+  802800:	c3                   	ret
+
+00802801 <fd2sockid>:
+{
+  802801:	55                   	push   %ebp
+  802802:	89 e5                	mov    %esp,%ebp
+  802804:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802807:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80280a:	52                   	push   %edx
+  80280b:	50                   	push   %eax
+  80280c:	e8 7e f7 ff ff       	call   801f8f <fd_lookup>
+  802811:	83 c4 10             	add    $0x10,%esp
+  802814:	85 c0                	test   %eax,%eax
+  802816:	78 10                	js     802828 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802818:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80281b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802821:	39 08                	cmp    %ecx,(%eax)
+  802823:	75 05                	jne    80282a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802825:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802828:	c9                   	leave
+  802829:	c3                   	ret
+		return -E_NOT_SUPP;
+  80282a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80282f:	eb f7                	jmp    802828 <fd2sockid+0x27>
+
+00802831 <alloc_sockfd>:
+{
+  802831:	55                   	push   %ebp
+  802832:	89 e5                	mov    %esp,%ebp
+  802834:	56                   	push   %esi
+  802835:	53                   	push   %ebx
+  802836:	83 ec 1c             	sub    $0x1c,%esp
+  802839:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80283b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80283e:	50                   	push   %eax
+  80283f:	e8 f5 f6 ff ff       	call   801f39 <fd_alloc>
+  802844:	89 c3                	mov    %eax,%ebx
+  802846:	83 c4 10             	add    $0x10,%esp
+  802849:	85 c0                	test   %eax,%eax
+  80284b:	78 43                	js     802890 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80284d:	83 ec 04             	sub    $0x4,%esp
+  802850:	68 07 04 00 00       	push   $0x407
+  802855:	ff 75 f4             	push   -0xc(%ebp)
+  802858:	6a 00                	push   $0x0
+  80285a:	e8 35 e5 ff ff       	call   800d94 <sys_page_alloc>
+  80285f:	89 c3                	mov    %eax,%ebx
+  802861:	83 c4 10             	add    $0x10,%esp
+  802864:	85 c0                	test   %eax,%eax
+  802866:	78 28                	js     802890 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802868:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80286b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802871:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802876:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80287d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802880:	83 ec 0c             	sub    $0xc,%esp
+  802883:	50                   	push   %eax
+  802884:	e8 89 f6 ff ff       	call   801f12 <fd2num>
+  802889:	89 c3                	mov    %eax,%ebx
+  80288b:	83 c4 10             	add    $0x10,%esp
+  80288e:	eb 0c                	jmp    80289c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802890:	83 ec 0c             	sub    $0xc,%esp
+  802893:	56                   	push   %esi
+  802894:	e8 e4 01 00 00       	call   802a7d <nsipc_close>
+		return r;
+  802899:	83 c4 10             	add    $0x10,%esp
+}
+  80289c:	89 d8                	mov    %ebx,%eax
+  80289e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a1:	5b                   	pop    %ebx
+  8028a2:	5e                   	pop    %esi
+  8028a3:	5d                   	pop    %ebp
+  8028a4:	c3                   	ret
+
+008028a5 <accept>:
+{
+  8028a5:	55                   	push   %ebp
+  8028a6:	89 e5                	mov    %esp,%ebp
+  8028a8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ae:	e8 4e ff ff ff       	call   802801 <fd2sockid>
+  8028b3:	85 c0                	test   %eax,%eax
+  8028b5:	78 1b                	js     8028d2 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8028b7:	83 ec 04             	sub    $0x4,%esp
+  8028ba:	ff 75 10             	push   0x10(%ebp)
+  8028bd:	ff 75 0c             	push   0xc(%ebp)
+  8028c0:	50                   	push   %eax
+  8028c1:	e8 0e 01 00 00       	call   8029d4 <nsipc_accept>
+  8028c6:	83 c4 10             	add    $0x10,%esp
+  8028c9:	85 c0                	test   %eax,%eax
+  8028cb:	78 05                	js     8028d2 <accept+0x2d>
+	return alloc_sockfd(r);
+  8028cd:	e8 5f ff ff ff       	call   802831 <alloc_sockfd>
+}
+  8028d2:	c9                   	leave
+  8028d3:	c3                   	ret
+
+008028d4 <bind>:
+{
+  8028d4:	55                   	push   %ebp
+  8028d5:	89 e5                	mov    %esp,%ebp
+  8028d7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028dd:	e8 1f ff ff ff       	call   802801 <fd2sockid>
+  8028e2:	85 c0                	test   %eax,%eax
+  8028e4:	78 12                	js     8028f8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8028e6:	83 ec 04             	sub    $0x4,%esp
+  8028e9:	ff 75 10             	push   0x10(%ebp)
+  8028ec:	ff 75 0c             	push   0xc(%ebp)
+  8028ef:	50                   	push   %eax
+  8028f0:	e8 31 01 00 00       	call   802a26 <nsipc_bind>
+  8028f5:	83 c4 10             	add    $0x10,%esp
+}
+  8028f8:	c9                   	leave
+  8028f9:	c3                   	ret
+
+008028fa <shutdown>:
+{
+  8028fa:	55                   	push   %ebp
+  8028fb:	89 e5                	mov    %esp,%ebp
+  8028fd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802900:	8b 45 08             	mov    0x8(%ebp),%eax
+  802903:	e8 f9 fe ff ff       	call   802801 <fd2sockid>
+  802908:	85 c0                	test   %eax,%eax
+  80290a:	78 0f                	js     80291b <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80290c:	83 ec 08             	sub    $0x8,%esp
+  80290f:	ff 75 0c             	push   0xc(%ebp)
+  802912:	50                   	push   %eax
+  802913:	e8 43 01 00 00       	call   802a5b <nsipc_shutdown>
+  802918:	83 c4 10             	add    $0x10,%esp
+}
+  80291b:	c9                   	leave
+  80291c:	c3                   	ret
+
+0080291d <connect>:
+{
+  80291d:	55                   	push   %ebp
+  80291e:	89 e5                	mov    %esp,%ebp
+  802920:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802923:	8b 45 08             	mov    0x8(%ebp),%eax
+  802926:	e8 d6 fe ff ff       	call   802801 <fd2sockid>
+  80292b:	85 c0                	test   %eax,%eax
+  80292d:	78 12                	js     802941 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80292f:	83 ec 04             	sub    $0x4,%esp
+  802932:	ff 75 10             	push   0x10(%ebp)
+  802935:	ff 75 0c             	push   0xc(%ebp)
+  802938:	50                   	push   %eax
+  802939:	e8 59 01 00 00       	call   802a97 <nsipc_connect>
+  80293e:	83 c4 10             	add    $0x10,%esp
+}
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+00802943 <listen>:
+{
+  802943:	55                   	push   %ebp
+  802944:	89 e5                	mov    %esp,%ebp
+  802946:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802949:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294c:	e8 b0 fe ff ff       	call   802801 <fd2sockid>
+  802951:	85 c0                	test   %eax,%eax
+  802953:	78 0f                	js     802964 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802955:	83 ec 08             	sub    $0x8,%esp
+  802958:	ff 75 0c             	push   0xc(%ebp)
+  80295b:	50                   	push   %eax
+  80295c:	e8 6b 01 00 00       	call   802acc <nsipc_listen>
+  802961:	83 c4 10             	add    $0x10,%esp
+}
+  802964:	c9                   	leave
+  802965:	c3                   	ret
+
+00802966 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802966:	55                   	push   %ebp
+  802967:	89 e5                	mov    %esp,%ebp
+  802969:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80296c:	ff 75 10             	push   0x10(%ebp)
+  80296f:	ff 75 0c             	push   0xc(%ebp)
+  802972:	ff 75 08             	push   0x8(%ebp)
+  802975:	e8 41 02 00 00       	call   802bbb <nsipc_socket>
+  80297a:	83 c4 10             	add    $0x10,%esp
+  80297d:	85 c0                	test   %eax,%eax
+  80297f:	78 05                	js     802986 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802981:	e8 ab fe ff ff       	call   802831 <alloc_sockfd>
+}
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+00802988 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802988:	55                   	push   %ebp
+  802989:	89 e5                	mov    %esp,%ebp
+  80298b:	53                   	push   %ebx
+  80298c:	83 ec 04             	sub    $0x4,%esp
+  80298f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802991:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802998:	74 26                	je     8029c0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80299a:	6a 07                	push   $0x7
+  80299c:	68 00 70 80 00       	push   $0x807000
+  8029a1:	53                   	push   %ebx
+  8029a2:	ff 35 04 50 80 00    	push   0x805004
+  8029a8:	e8 da 08 00 00       	call   803287 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029ad:	83 c4 0c             	add    $0xc,%esp
+  8029b0:	6a 00                	push   $0x0
+  8029b2:	6a 00                	push   $0x0
+  8029b4:	6a 00                	push   $0x0
+  8029b6:	e8 b4 08 00 00       	call   80326f <ipc_recv>
+}
+  8029bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029c0:	83 ec 0c             	sub    $0xc,%esp
+  8029c3:	6a 02                	push   $0x2
+  8029c5:	e8 11 09 00 00       	call   8032db <ipc_find_env>
+  8029ca:	a3 04 50 80 00       	mov    %eax,0x805004
+  8029cf:	83 c4 10             	add    $0x10,%esp
+  8029d2:	eb c6                	jmp    80299a <nsipc+0x12>
+
+008029d4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8029d4:	55                   	push   %ebp
+  8029d5:	89 e5                	mov    %esp,%ebp
+  8029d7:	56                   	push   %esi
+  8029d8:	53                   	push   %ebx
+  8029d9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8029dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029df:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8029e4:	8b 06                	mov    (%esi),%eax
+  8029e6:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8029eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029f0:	e8 93 ff ff ff       	call   802988 <nsipc>
+  8029f5:	89 c3                	mov    %eax,%ebx
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	79 09                	jns    802a04 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8029fb:	89 d8                	mov    %ebx,%eax
+  8029fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a00:	5b                   	pop    %ebx
+  802a01:	5e                   	pop    %esi
+  802a02:	5d                   	pop    %ebp
+  802a03:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a04:	83 ec 04             	sub    $0x4,%esp
+  802a07:	ff 35 10 70 80 00    	push   0x807010
+  802a0d:	68 00 70 80 00       	push   $0x807000
+  802a12:	ff 75 0c             	push   0xc(%ebp)
+  802a15:	e8 08 e0 ff ff       	call   800a22 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a1a:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a1f:	89 06                	mov    %eax,(%esi)
+  802a21:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a24:	eb d5                	jmp    8029fb <nsipc_accept+0x27>
+
+00802a26 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a26:	55                   	push   %ebp
+  802a27:	89 e5                	mov    %esp,%ebp
+  802a29:	53                   	push   %ebx
+  802a2a:	83 ec 08             	sub    $0x8,%esp
+  802a2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a33:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a38:	53                   	push   %ebx
+  802a39:	ff 75 0c             	push   0xc(%ebp)
+  802a3c:	68 04 70 80 00       	push   $0x807004
+  802a41:	e8 dc df ff ff       	call   800a22 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a46:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802a4c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a51:	e8 32 ff ff ff       	call   802988 <nsipc>
+}
+  802a56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a59:	c9                   	leave
+  802a5a:	c3                   	ret
+
+00802a5b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a5b:	55                   	push   %ebp
+  802a5c:	89 e5                	mov    %esp,%ebp
+  802a5e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a64:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802a69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a6c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a71:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a76:	e8 0d ff ff ff       	call   802988 <nsipc>
+}
+  802a7b:	c9                   	leave
+  802a7c:	c3                   	ret
+
+00802a7d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a7d:	55                   	push   %ebp
+  802a7e:	89 e5                	mov    %esp,%ebp
+  802a80:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a86:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802a8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a90:	e8 f3 fe ff ff       	call   802988 <nsipc>
+}
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+
+00802a97 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a97:	55                   	push   %ebp
+  802a98:	89 e5                	mov    %esp,%ebp
+  802a9a:	53                   	push   %ebx
+  802a9b:	83 ec 08             	sub    $0x8,%esp
+  802a9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802aa1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa4:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802aa9:	53                   	push   %ebx
+  802aaa:	ff 75 0c             	push   0xc(%ebp)
+  802aad:	68 04 70 80 00       	push   $0x807004
+  802ab2:	e8 6b df ff ff       	call   800a22 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ab7:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802abd:	b8 05 00 00 00       	mov    $0x5,%eax
+  802ac2:	e8 c1 fe ff ff       	call   802988 <nsipc>
+}
+  802ac7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aca:	c9                   	leave
+  802acb:	c3                   	ret
+
+00802acc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802acc:	55                   	push   %ebp
+  802acd:	89 e5                	mov    %esp,%ebp
+  802acf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802ada:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802add:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802ae2:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ae7:	e8 9c fe ff ff       	call   802988 <nsipc>
+}
+  802aec:	c9                   	leave
+  802aed:	c3                   	ret
+
+00802aee <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802aee:	55                   	push   %ebp
+  802aef:	89 e5                	mov    %esp,%ebp
+  802af1:	56                   	push   %esi
+  802af2:	53                   	push   %ebx
+  802af3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802af6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802afe:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802b04:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b07:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b0c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b11:	e8 72 fe ff ff       	call   802988 <nsipc>
+  802b16:	89 c3                	mov    %eax,%ebx
+  802b18:	85 c0                	test   %eax,%eax
+  802b1a:	78 22                	js     802b3e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b1c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b21:	39 c6                	cmp    %eax,%esi
+  802b23:	0f 4e c6             	cmovle %esi,%eax
+  802b26:	39 c3                	cmp    %eax,%ebx
+  802b28:	7f 1d                	jg     802b47 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b2a:	83 ec 04             	sub    $0x4,%esp
+  802b2d:	53                   	push   %ebx
+  802b2e:	68 00 70 80 00       	push   $0x807000
+  802b33:	ff 75 0c             	push   0xc(%ebp)
+  802b36:	e8 e7 de ff ff       	call   800a22 <memmove>
+  802b3b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b3e:	89 d8                	mov    %ebx,%eax
+  802b40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b43:	5b                   	pop    %ebx
+  802b44:	5e                   	pop    %esi
+  802b45:	5d                   	pop    %ebp
+  802b46:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b47:	68 6a 39 80 00       	push   $0x80396a
+  802b4c:	68 30 38 80 00       	push   $0x803830
+  802b51:	6a 62                	push   $0x62
+  802b53:	68 7f 39 80 00       	push   $0x80397f
+  802b58:	e8 1c d6 ff ff       	call   800179 <_panic>
+
+00802b5d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	53                   	push   %ebx
+  802b61:	83 ec 04             	sub    $0x4,%esp
+  802b64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6a:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802b6f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b75:	7f 2e                	jg     802ba5 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b77:	83 ec 04             	sub    $0x4,%esp
+  802b7a:	53                   	push   %ebx
+  802b7b:	ff 75 0c             	push   0xc(%ebp)
+  802b7e:	68 0c 70 80 00       	push   $0x80700c
+  802b83:	e8 9a de ff ff       	call   800a22 <memmove>
+	nsipcbuf.send.req_size = size;
+  802b88:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802b8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b91:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802b96:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b9b:	e8 e8 fd ff ff       	call   802988 <nsipc>
+}
+  802ba0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba3:	c9                   	leave
+  802ba4:	c3                   	ret
+	assert(size < 1600);
+  802ba5:	68 8b 39 80 00       	push   $0x80398b
+  802baa:	68 30 38 80 00       	push   $0x803830
+  802baf:	6a 6d                	push   $0x6d
+  802bb1:	68 7f 39 80 00       	push   $0x80397f
+  802bb6:	e8 be d5 ff ff       	call   800179 <_panic>
+
+00802bbb <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802bbb:	55                   	push   %ebp
+  802bbc:	89 e5                	mov    %esp,%ebp
+  802bbe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802bc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bcc:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802bd1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd4:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802bd9:	b8 09 00 00 00       	mov    $0x9,%eax
+  802bde:	e8 a5 fd ff ff       	call   802988 <nsipc>
+}
+  802be3:	c9                   	leave
+  802be4:	c3                   	ret
+
+00802be5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802be5:	55                   	push   %ebp
+  802be6:	89 e5                	mov    %esp,%ebp
+  802be8:	56                   	push   %esi
+  802be9:	53                   	push   %ebx
+  802bea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802bed:	83 ec 0c             	sub    $0xc,%esp
+  802bf0:	ff 75 08             	push   0x8(%ebp)
+  802bf3:	e8 2a f3 ff ff       	call   801f22 <fd2data>
+  802bf8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802bfa:	83 c4 08             	add    $0x8,%esp
+  802bfd:	68 97 39 80 00       	push   $0x803997
+  802c02:	53                   	push   %ebx
+  802c03:	e8 94 dc ff ff       	call   80089c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c08:	8b 46 04             	mov    0x4(%esi),%eax
+  802c0b:	2b 06                	sub    (%esi),%eax
+  802c0d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802c13:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c1a:	00 00 00 
+	stat->st_dev = &devpipe;
+  802c1d:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802c24:	40 80 00 
+	return 0;
+}
+  802c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c2f:	5b                   	pop    %ebx
+  802c30:	5e                   	pop    %esi
+  802c31:	5d                   	pop    %ebp
+  802c32:	c3                   	ret
+
+00802c33 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c33:	55                   	push   %ebp
+  802c34:	89 e5                	mov    %esp,%ebp
+  802c36:	53                   	push   %ebx
+  802c37:	83 ec 0c             	sub    $0xc,%esp
+  802c3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c3d:	53                   	push   %ebx
+  802c3e:	6a 00                	push   $0x0
+  802c40:	e8 2a e2 ff ff       	call   800e6f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c45:	89 1c 24             	mov    %ebx,(%esp)
+  802c48:	e8 d5 f2 ff ff       	call   801f22 <fd2data>
+  802c4d:	83 c4 08             	add    $0x8,%esp
+  802c50:	50                   	push   %eax
+  802c51:	6a 00                	push   $0x0
+  802c53:	e8 17 e2 ff ff       	call   800e6f <sys_page_unmap>
+}
+  802c58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c5b:	c9                   	leave
+  802c5c:	c3                   	ret
+
+00802c5d <_pipeisclosed>:
+{
+  802c5d:	55                   	push   %ebp
+  802c5e:	89 e5                	mov    %esp,%ebp
+  802c60:	57                   	push   %edi
+  802c61:	56                   	push   %esi
+  802c62:	53                   	push   %ebx
+  802c63:	83 ec 1c             	sub    $0x1c,%esp
+  802c66:	89 c7                	mov    %eax,%edi
+  802c68:	89 d6                	mov    %edx,%esi
+  802c6a:	eb 3c                	jmp    802ca8 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802c6c:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802c6f:	83 ec 0c             	sub    $0xc,%esp
+  802c72:	57                   	push   %edi
+  802c73:	e8 a2 06 00 00       	call   80331a <pageref>
+  802c78:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c7b:	89 34 24             	mov    %esi,(%esp)
+  802c7e:	e8 97 06 00 00       	call   80331a <pageref>
+  802c83:	89 c2                	mov    %eax,%edx
+  802c85:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c87:	05 00 00 00 20       	add    $0x20000000,%eax
+  802c8c:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802c8f:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c95:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c9a:	76 31                	jbe    802ccd <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802c9c:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802c9f:	39 c3                	cmp    %eax,%ebx
+  802ca1:	74 76                	je     802d19 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802ca3:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802ca6:	74 36                	je     802cde <_pipeisclosed+0x81>
+  802ca8:	89 e0                	mov    %esp,%eax
+  802caa:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802caf:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cb5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cba:	77 b0                	ja     802c6c <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802cbc:	c1 e8 10             	shr    $0x10,%eax
+  802cbf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802cc5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ccb:	eb 9f                	jmp    802c6c <_pipeisclosed+0xf>
+  802ccd:	c1 e8 10             	shr    $0x10,%eax
+  802cd0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802cd6:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802cdc:	eb be                	jmp    802c9c <_pipeisclosed+0x3f>
+  802cde:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ce0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ce5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ceb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cf0:	76 16                	jbe    802d08 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802cf2:	8b 42 58             	mov    0x58(%edx),%eax
+  802cf5:	6a 01                	push   $0x1
+  802cf7:	50                   	push   %eax
+  802cf8:	53                   	push   %ebx
+  802cf9:	68 9e 39 80 00       	push   $0x80399e
+  802cfe:	e8 51 d5 ff ff       	call   800254 <cprintf>
+  802d03:	83 c4 10             	add    $0x10,%esp
+  802d06:	eb a0                	jmp    802ca8 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d08:	c1 e8 10             	shr    $0x10,%eax
+  802d0b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d11:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d17:	eb d9                	jmp    802cf2 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802d19:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802d1c:	0f 94 c0             	sete   %al
+  802d1f:	0f b6 c0             	movzbl %al,%eax
+}
+  802d22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d25:	5b                   	pop    %ebx
+  802d26:	5e                   	pop    %esi
+  802d27:	5f                   	pop    %edi
+  802d28:	5d                   	pop    %ebp
+  802d29:	c3                   	ret
+
+00802d2a <devpipe_write>:
+{
+  802d2a:	55                   	push   %ebp
+  802d2b:	89 e5                	mov    %esp,%ebp
+  802d2d:	57                   	push   %edi
+  802d2e:	56                   	push   %esi
+  802d2f:	53                   	push   %ebx
+  802d30:	83 ec 28             	sub    $0x28,%esp
+  802d33:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802d36:	56                   	push   %esi
+  802d37:	e8 e6 f1 ff ff       	call   801f22 <fd2data>
+  802d3c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d3e:	83 c4 10             	add    $0x10,%esp
+  802d41:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d46:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d49:	75 09                	jne    802d54 <devpipe_write+0x2a>
+	return i;
+  802d4b:	89 f8                	mov    %edi,%eax
+  802d4d:	eb 23                	jmp    802d72 <devpipe_write+0x48>
+			sys_yield();
+  802d4f:	e8 fa df ff ff       	call   800d4e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d54:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d57:	8b 0b                	mov    (%ebx),%ecx
+  802d59:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d5c:	39 d0                	cmp    %edx,%eax
+  802d5e:	72 1a                	jb     802d7a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802d60:	89 da                	mov    %ebx,%edx
+  802d62:	89 f0                	mov    %esi,%eax
+  802d64:	e8 f4 fe ff ff       	call   802c5d <_pipeisclosed>
+  802d69:	85 c0                	test   %eax,%eax
+  802d6b:	74 e2                	je     802d4f <devpipe_write+0x25>
+				return 0;
+  802d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d75:	5b                   	pop    %ebx
+  802d76:	5e                   	pop    %esi
+  802d77:	5f                   	pop    %edi
+  802d78:	5d                   	pop    %ebp
+  802d79:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802d7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d7d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802d81:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802d84:	89 c2                	mov    %eax,%edx
+  802d86:	c1 fa 1f             	sar    $0x1f,%edx
+  802d89:	89 d1                	mov    %edx,%ecx
+  802d8b:	c1 e9 1b             	shr    $0x1b,%ecx
+  802d8e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802d91:	83 e2 1f             	and    $0x1f,%edx
+  802d94:	29 ca                	sub    %ecx,%edx
+  802d96:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802d9a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802d9e:	83 c0 01             	add    $0x1,%eax
+  802da1:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802da4:	83 c7 01             	add    $0x1,%edi
+  802da7:	eb 9d                	jmp    802d46 <devpipe_write+0x1c>
+
+00802da9 <devpipe_read>:
+{
+  802da9:	55                   	push   %ebp
+  802daa:	89 e5                	mov    %esp,%ebp
+  802dac:	57                   	push   %edi
+  802dad:	56                   	push   %esi
+  802dae:	53                   	push   %ebx
+  802daf:	83 ec 18             	sub    $0x18,%esp
+  802db2:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802db5:	57                   	push   %edi
+  802db6:	e8 67 f1 ff ff       	call   801f22 <fd2data>
+  802dbb:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802dbd:	83 c4 10             	add    $0x10,%esp
+  802dc0:	be 00 00 00 00       	mov    $0x0,%esi
+  802dc5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802dc8:	75 13                	jne    802ddd <devpipe_read+0x34>
+	return i;
+  802dca:	89 f0                	mov    %esi,%eax
+  802dcc:	eb 02                	jmp    802dd0 <devpipe_read+0x27>
+				return i;
+  802dce:	89 f0                	mov    %esi,%eax
+}
+  802dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dd3:	5b                   	pop    %ebx
+  802dd4:	5e                   	pop    %esi
+  802dd5:	5f                   	pop    %edi
+  802dd6:	5d                   	pop    %ebp
+  802dd7:	c3                   	ret
+			sys_yield();
+  802dd8:	e8 71 df ff ff       	call   800d4e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802ddd:	8b 03                	mov    (%ebx),%eax
+  802ddf:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802de2:	75 18                	jne    802dfc <devpipe_read+0x53>
+			if (i > 0)
+  802de4:	85 f6                	test   %esi,%esi
+  802de6:	75 e6                	jne    802dce <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802de8:	89 da                	mov    %ebx,%edx
+  802dea:	89 f8                	mov    %edi,%eax
+  802dec:	e8 6c fe ff ff       	call   802c5d <_pipeisclosed>
+  802df1:	85 c0                	test   %eax,%eax
+  802df3:	74 e3                	je     802dd8 <devpipe_read+0x2f>
+				return 0;
+  802df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfa:	eb d4                	jmp    802dd0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802dfc:	99                   	cltd
+  802dfd:	c1 ea 1b             	shr    $0x1b,%edx
+  802e00:	01 d0                	add    %edx,%eax
+  802e02:	83 e0 1f             	and    $0x1f,%eax
+  802e05:	29 d0                	sub    %edx,%eax
+  802e07:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e0f:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802e12:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802e15:	83 c6 01             	add    $0x1,%esi
+  802e18:	eb ab                	jmp    802dc5 <devpipe_read+0x1c>
+
+00802e1a <pipe>:
+{
+  802e1a:	55                   	push   %ebp
+  802e1b:	89 e5                	mov    %esp,%ebp
+  802e1d:	56                   	push   %esi
+  802e1e:	53                   	push   %ebx
+  802e1f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802e22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e25:	50                   	push   %eax
+  802e26:	e8 0e f1 ff ff       	call   801f39 <fd_alloc>
+  802e2b:	89 c3                	mov    %eax,%ebx
+  802e2d:	83 c4 10             	add    $0x10,%esp
+  802e30:	85 c0                	test   %eax,%eax
+  802e32:	0f 88 23 01 00 00    	js     802f5b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e38:	83 ec 04             	sub    $0x4,%esp
+  802e3b:	68 07 04 00 00       	push   $0x407
+  802e40:	ff 75 f4             	push   -0xc(%ebp)
+  802e43:	6a 00                	push   $0x0
+  802e45:	e8 4a df ff ff       	call   800d94 <sys_page_alloc>
+  802e4a:	89 c3                	mov    %eax,%ebx
+  802e4c:	83 c4 10             	add    $0x10,%esp
+  802e4f:	85 c0                	test   %eax,%eax
+  802e51:	0f 88 04 01 00 00    	js     802f5b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802e57:	83 ec 0c             	sub    $0xc,%esp
+  802e5a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e5d:	50                   	push   %eax
+  802e5e:	e8 d6 f0 ff ff       	call   801f39 <fd_alloc>
+  802e63:	89 c3                	mov    %eax,%ebx
+  802e65:	83 c4 10             	add    $0x10,%esp
+  802e68:	85 c0                	test   %eax,%eax
+  802e6a:	0f 88 db 00 00 00    	js     802f4b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e70:	83 ec 04             	sub    $0x4,%esp
+  802e73:	68 07 04 00 00       	push   $0x407
+  802e78:	ff 75 f0             	push   -0x10(%ebp)
+  802e7b:	6a 00                	push   $0x0
+  802e7d:	e8 12 df ff ff       	call   800d94 <sys_page_alloc>
+  802e82:	89 c3                	mov    %eax,%ebx
+  802e84:	83 c4 10             	add    $0x10,%esp
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	0f 88 bc 00 00 00    	js     802f4b <pipe+0x131>
+	va = fd2data(fd0);
+  802e8f:	83 ec 0c             	sub    $0xc,%esp
+  802e92:	ff 75 f4             	push   -0xc(%ebp)
+  802e95:	e8 88 f0 ff ff       	call   801f22 <fd2data>
+  802e9a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e9c:	83 c4 0c             	add    $0xc,%esp
+  802e9f:	68 07 04 00 00       	push   $0x407
+  802ea4:	50                   	push   %eax
+  802ea5:	6a 00                	push   $0x0
+  802ea7:	e8 e8 de ff ff       	call   800d94 <sys_page_alloc>
+  802eac:	89 c3                	mov    %eax,%ebx
+  802eae:	83 c4 10             	add    $0x10,%esp
+  802eb1:	85 c0                	test   %eax,%eax
+  802eb3:	0f 88 82 00 00 00    	js     802f3b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802eb9:	83 ec 0c             	sub    $0xc,%esp
+  802ebc:	ff 75 f0             	push   -0x10(%ebp)
+  802ebf:	e8 5e f0 ff ff       	call   801f22 <fd2data>
+  802ec4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ecb:	50                   	push   %eax
+  802ecc:	6a 00                	push   $0x0
+  802ece:	56                   	push   %esi
+  802ecf:	6a 00                	push   $0x0
+  802ed1:	e8 2b df ff ff       	call   800e01 <sys_page_map>
+  802ed6:	89 c3                	mov    %eax,%ebx
+  802ed8:	83 c4 20             	add    $0x20,%esp
+  802edb:	85 c0                	test   %eax,%eax
+  802edd:	78 4e                	js     802f2d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802edf:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802ee4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ee7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802ee9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802eec:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802ef3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802ef6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802ef8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802efb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802f02:	83 ec 0c             	sub    $0xc,%esp
+  802f05:	ff 75 f4             	push   -0xc(%ebp)
+  802f08:	e8 05 f0 ff ff       	call   801f12 <fd2num>
+  802f0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f10:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802f12:	83 c4 04             	add    $0x4,%esp
+  802f15:	ff 75 f0             	push   -0x10(%ebp)
+  802f18:	e8 f5 ef ff ff       	call   801f12 <fd2num>
+  802f1d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f20:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802f23:	83 c4 10             	add    $0x10,%esp
+  802f26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f2b:	eb 2e                	jmp    802f5b <pipe+0x141>
+	sys_page_unmap(0, va);
+  802f2d:	83 ec 08             	sub    $0x8,%esp
+  802f30:	56                   	push   %esi
+  802f31:	6a 00                	push   $0x0
+  802f33:	e8 37 df ff ff       	call   800e6f <sys_page_unmap>
+  802f38:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802f3b:	83 ec 08             	sub    $0x8,%esp
+  802f3e:	ff 75 f0             	push   -0x10(%ebp)
+  802f41:	6a 00                	push   $0x0
+  802f43:	e8 27 df ff ff       	call   800e6f <sys_page_unmap>
+  802f48:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802f4b:	83 ec 08             	sub    $0x8,%esp
+  802f4e:	ff 75 f4             	push   -0xc(%ebp)
+  802f51:	6a 00                	push   $0x0
+  802f53:	e8 17 df ff ff       	call   800e6f <sys_page_unmap>
+  802f58:	83 c4 10             	add    $0x10,%esp
+}
+  802f5b:	89 d8                	mov    %ebx,%eax
+  802f5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f60:	5b                   	pop    %ebx
+  802f61:	5e                   	pop    %esi
+  802f62:	5d                   	pop    %ebp
+  802f63:	c3                   	ret
+
+00802f64 <pipeisclosed>:
+{
+  802f64:	55                   	push   %ebp
+  802f65:	89 e5                	mov    %esp,%ebp
+  802f67:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f6d:	50                   	push   %eax
+  802f6e:	ff 75 08             	push   0x8(%ebp)
+  802f71:	e8 19 f0 ff ff       	call   801f8f <fd_lookup>
+  802f76:	83 c4 10             	add    $0x10,%esp
+  802f79:	85 c0                	test   %eax,%eax
+  802f7b:	78 18                	js     802f95 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802f7d:	83 ec 0c             	sub    $0xc,%esp
+  802f80:	ff 75 f4             	push   -0xc(%ebp)
+  802f83:	e8 9a ef ff ff       	call   801f22 <fd2data>
+  802f88:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802f8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f8d:	e8 cb fc ff ff       	call   802c5d <_pipeisclosed>
+  802f92:	83 c4 10             	add    $0x10,%esp
+}
+  802f95:	c9                   	leave
+  802f96:	c3                   	ret
+
+00802f97 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9c:	c3                   	ret
+
+00802f9d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f9d:	55                   	push   %ebp
+  802f9e:	89 e5                	mov    %esp,%ebp
+  802fa0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802fa3:	68 b6 39 80 00       	push   $0x8039b6
+  802fa8:	ff 75 0c             	push   0xc(%ebp)
+  802fab:	e8 ec d8 ff ff       	call   80089c <strcpy>
+	return 0;
+}
+  802fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb5:	c9                   	leave
+  802fb6:	c3                   	ret
+
+00802fb7 <devcons_write>:
+{
+  802fb7:	55                   	push   %ebp
+  802fb8:	89 e5                	mov    %esp,%ebp
+  802fba:	57                   	push   %edi
+  802fbb:	56                   	push   %esi
+  802fbc:	53                   	push   %ebx
+  802fbd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802fc3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802fc8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802fce:	eb 2e                	jmp    802ffe <devcons_write+0x47>
+		m = n - tot;
+  802fd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802fd3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802fd5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802fda:	39 c3                	cmp    %eax,%ebx
+  802fdc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802fdf:	83 ec 04             	sub    $0x4,%esp
+  802fe2:	53                   	push   %ebx
+  802fe3:	89 f0                	mov    %esi,%eax
+  802fe5:	03 45 0c             	add    0xc(%ebp),%eax
+  802fe8:	50                   	push   %eax
+  802fe9:	57                   	push   %edi
+  802fea:	e8 33 da ff ff       	call   800a22 <memmove>
+		sys_cputs(buf, m);
+  802fef:	83 c4 08             	add    $0x8,%esp
+  802ff2:	53                   	push   %ebx
+  802ff3:	57                   	push   %edi
+  802ff4:	e8 1c dc ff ff       	call   800c15 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802ff9:	01 de                	add    %ebx,%esi
+  802ffb:	83 c4 10             	add    $0x10,%esp
+  802ffe:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803001:	72 cd                	jb     802fd0 <devcons_write+0x19>
+}
+  803003:	89 f0                	mov    %esi,%eax
+  803005:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803008:	5b                   	pop    %ebx
+  803009:	5e                   	pop    %esi
+  80300a:	5f                   	pop    %edi
+  80300b:	5d                   	pop    %ebp
+  80300c:	c3                   	ret
+
+0080300d <devcons_read>:
+{
+  80300d:	55                   	push   %ebp
+  80300e:	89 e5                	mov    %esp,%ebp
+  803010:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803013:	b8 00 00 00 00       	mov    $0x0,%eax
+  803018:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80301c:	75 07                	jne    803025 <devcons_read+0x18>
+  80301e:	eb 1f                	jmp    80303f <devcons_read+0x32>
+		sys_yield();
+  803020:	e8 29 dd ff ff       	call   800d4e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803025:	e8 2f dc ff ff       	call   800c59 <sys_cgetc>
+  80302a:	85 c0                	test   %eax,%eax
+  80302c:	74 f2                	je     803020 <devcons_read+0x13>
+	if (c < 0)
+  80302e:	78 0f                	js     80303f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803030:	83 f8 04             	cmp    $0x4,%eax
+  803033:	74 0c                	je     803041 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803035:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803038:	88 02                	mov    %al,(%edx)
+	return 1;
+  80303a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80303f:	c9                   	leave
+  803040:	c3                   	ret
+		return 0;
+  803041:	b8 00 00 00 00       	mov    $0x0,%eax
+  803046:	eb f7                	jmp    80303f <devcons_read+0x32>
+
+00803048 <cputchar>:
+{
+  803048:	55                   	push   %ebp
+  803049:	89 e5                	mov    %esp,%ebp
+  80304b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80304e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803051:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803054:	6a 01                	push   $0x1
+  803056:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803059:	50                   	push   %eax
+  80305a:	e8 b6 db ff ff       	call   800c15 <sys_cputs>
+}
+  80305f:	83 c4 10             	add    $0x10,%esp
+  803062:	c9                   	leave
+  803063:	c3                   	ret
+
+00803064 <getchar>:
+{
+  803064:	55                   	push   %ebp
+  803065:	89 e5                	mov    %esp,%ebp
+  803067:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80306a:	6a 01                	push   $0x1
+  80306c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80306f:	50                   	push   %eax
+  803070:	6a 00                	push   $0x0
+  803072:	e8 9e f1 ff ff       	call   802215 <read>
+	if (r < 0)
+  803077:	83 c4 10             	add    $0x10,%esp
+  80307a:	85 c0                	test   %eax,%eax
+  80307c:	78 06                	js     803084 <getchar+0x20>
+	if (r < 1)
+  80307e:	74 06                	je     803086 <getchar+0x22>
+	return c;
+  803080:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803084:	c9                   	leave
+  803085:	c3                   	ret
+		return -E_EOF;
+  803086:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80308b:	eb f7                	jmp    803084 <getchar+0x20>
+
+0080308d <iscons>:
+{
+  80308d:	55                   	push   %ebp
+  80308e:	89 e5                	mov    %esp,%ebp
+  803090:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803093:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803096:	50                   	push   %eax
+  803097:	ff 75 08             	push   0x8(%ebp)
+  80309a:	e8 f0 ee ff ff       	call   801f8f <fd_lookup>
+  80309f:	83 c4 10             	add    $0x10,%esp
+  8030a2:	85 c0                	test   %eax,%eax
+  8030a4:	78 11                	js     8030b7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8030a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030a9:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8030af:	39 10                	cmp    %edx,(%eax)
+  8030b1:	0f 94 c0             	sete   %al
+  8030b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8030b7:	c9                   	leave
+  8030b8:	c3                   	ret
+
+008030b9 <opencons>:
+{
+  8030b9:	55                   	push   %ebp
+  8030ba:	89 e5                	mov    %esp,%ebp
+  8030bc:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8030bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030c2:	50                   	push   %eax
+  8030c3:	e8 71 ee ff ff       	call   801f39 <fd_alloc>
+  8030c8:	83 c4 10             	add    $0x10,%esp
+  8030cb:	85 c0                	test   %eax,%eax
+  8030cd:	78 3a                	js     803109 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8030cf:	83 ec 04             	sub    $0x4,%esp
+  8030d2:	68 07 04 00 00       	push   $0x407
+  8030d7:	ff 75 f4             	push   -0xc(%ebp)
+  8030da:	6a 00                	push   $0x0
+  8030dc:	e8 b3 dc ff ff       	call   800d94 <sys_page_alloc>
+  8030e1:	83 c4 10             	add    $0x10,%esp
+  8030e4:	85 c0                	test   %eax,%eax
+  8030e6:	78 21                	js     803109 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8030e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030eb:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8030f1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8030f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030f6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8030fd:	83 ec 0c             	sub    $0xc,%esp
+  803100:	50                   	push   %eax
+  803101:	e8 0c ee ff ff       	call   801f12 <fd2num>
+  803106:	83 c4 10             	add    $0x10,%esp
+}
+  803109:	c9                   	leave
+  80310a:	c3                   	ret
+
+0080310b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80310b:	55                   	push   %ebp
+  80310c:	89 e5                	mov    %esp,%ebp
+  80310e:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803111:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803118:	74 0a                	je     803124 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80311a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80311d:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803122:	c9                   	leave
+  803123:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803124:	83 ec 04             	sub    $0x4,%esp
+  803127:	6a 07                	push   $0x7
+  803129:	68 00 f0 bf ee       	push   $0xeebff000
+  80312e:	6a 00                	push   $0x0
+  803130:	e8 5f dc ff ff       	call   800d94 <sys_page_alloc>
+  803135:	83 c4 10             	add    $0x10,%esp
+  803138:	85 c0                	test   %eax,%eax
+  80313a:	78 14                	js     803150 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80313c:	83 ec 08             	sub    $0x8,%esp
+  80313f:	68 72 31 80 00       	push   $0x803172
+  803144:	6a 00                	push   $0x0
+  803146:	e8 65 de ff ff       	call   800fb0 <sys_env_set_pgfault_upcall>
+  80314b:	83 c4 10             	add    $0x10,%esp
+  80314e:	eb ca                	jmp    80311a <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  803150:	83 ec 08             	sub    $0x8,%esp
+  803153:	50                   	push   %eax
+  803154:	68 c2 39 80 00       	push   $0x8039c2
+  803159:	e8 f6 d0 ff ff       	call   800254 <cprintf>
+			panic("set_pgfault_handler error");
+  80315e:	83 c4 0c             	add    $0xc,%esp
+  803161:	68 cd 39 80 00       	push   $0x8039cd
+  803166:	6a 24                	push   $0x24
+  803168:	68 e7 39 80 00       	push   $0x8039e7
+  80316d:	e8 07 d0 ff ff       	call   800179 <_panic>
+
+00803172 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803172:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803173:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803178:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80317a:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  80317d:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  803181:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803184:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803188:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  80318a:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  80318e:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  80318f:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803193:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803194:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803195:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803199:	c3                   	ret
+
+0080319a <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  80319a:	55                   	push   %ebp
+  80319b:	89 e5                	mov    %esp,%ebp
+  80319d:	56                   	push   %esi
+  80319e:	53                   	push   %ebx
+  80319f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8031af:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8031b2:	83 ec 08             	sub    $0x8,%esp
+  8031b5:	ff 75 14             	push   0x14(%ebp)
+  8031b8:	50                   	push   %eax
+  8031b9:	e8 e7 df ff ff       	call   8011a5 <sys_ipc_recv_until>
+  8031be:	83 c4 10             	add    $0x10,%esp
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	78 61                	js     803226 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8031c5:	85 f6                	test   %esi,%esi
+  8031c7:	74 1c                	je     8031e5 <ipc_recv_until+0x4b>
+  8031c9:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8031cb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8031d0:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8031d6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8031db:	76 5f                	jbe    80323c <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8031dd:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8031e3:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8031e5:	85 db                	test   %ebx,%ebx
+  8031e7:	74 1c                	je     803205 <ipc_recv_until+0x6b>
+  8031e9:	89 e0                	mov    %esp,%eax
+  8031eb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8031f0:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8031f6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8031fb:	76 50                	jbe    80324d <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8031fd:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803203:	89 03                	mov    %eax,(%ebx)
+  803205:	89 e0                	mov    %esp,%eax
+  803207:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80320c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803212:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803217:	76 45                	jbe    80325e <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803219:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80321f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803222:	5b                   	pop    %ebx
+  803223:	5e                   	pop    %esi
+  803224:	5d                   	pop    %ebp
+  803225:	c3                   	ret
+		if (from_env_store)
+  803226:	85 f6                	test   %esi,%esi
+  803228:	74 06                	je     803230 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  80322a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  803230:	85 db                	test   %ebx,%ebx
+  803232:	74 eb                	je     80321f <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803234:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80323a:	eb e3                	jmp    80321f <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80323c:	c1 e8 10             	shr    $0x10,%eax
+  80323f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803245:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80324b:	eb 90                	jmp    8031dd <ipc_recv_until+0x43>
+  80324d:	c1 e8 10             	shr    $0x10,%eax
+  803250:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803256:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80325c:	eb 9f                	jmp    8031fd <ipc_recv_until+0x63>
+  80325e:	c1 e8 10             	shr    $0x10,%eax
+  803261:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803267:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80326d:	eb aa                	jmp    803219 <ipc_recv_until+0x7f>
+
+0080326f <ipc_recv>:
+{
+  80326f:	55                   	push   %ebp
+  803270:	89 e5                	mov    %esp,%ebp
+  803272:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803275:	6a 00                	push   $0x0
+  803277:	ff 75 10             	push   0x10(%ebp)
+  80327a:	ff 75 0c             	push   0xc(%ebp)
+  80327d:	ff 75 08             	push   0x8(%ebp)
+  803280:	e8 15 ff ff ff       	call   80319a <ipc_recv_until>
+}
+  803285:	c9                   	leave
+  803286:	c3                   	ret
+
+00803287 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803287:	55                   	push   %ebp
+  803288:	89 e5                	mov    %esp,%ebp
+  80328a:	57                   	push   %edi
+  80328b:	56                   	push   %esi
+  80328c:	53                   	push   %ebx
+  80328d:	83 ec 0c             	sub    $0xc,%esp
+  803290:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803293:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803296:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803299:	85 db                	test   %ebx,%ebx
+  80329b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8032a0:	0f 44 d8             	cmove  %eax,%ebx
+  8032a3:	eb 05                	jmp    8032aa <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8032a5:	e8 a4 da ff ff       	call   800d4e <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8032aa:	ff 75 14             	push   0x14(%ebp)
+  8032ad:	53                   	push   %ebx
+  8032ae:	56                   	push   %esi
+  8032af:	57                   	push   %edi
+  8032b0:	e8 3c de ff ff       	call   8010f1 <sys_ipc_try_send>
+  8032b5:	83 c4 10             	add    $0x10,%esp
+  8032b8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8032bb:	74 e8                	je     8032a5 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8032bd:	85 c0                	test   %eax,%eax
+  8032bf:	78 08                	js     8032c9 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8032c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032c4:	5b                   	pop    %ebx
+  8032c5:	5e                   	pop    %esi
+  8032c6:	5f                   	pop    %edi
+  8032c7:	5d                   	pop    %ebp
+  8032c8:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8032c9:	50                   	push   %eax
+  8032ca:	68 f5 39 80 00       	push   $0x8039f5
+  8032cf:	6a 4f                	push   $0x4f
+  8032d1:	68 08 3a 80 00       	push   $0x803a08
+  8032d6:	e8 9e ce ff ff       	call   800179 <_panic>
+
+008032db <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8032db:	55                   	push   %ebp
+  8032dc:	89 e5                	mov    %esp,%ebp
+  8032de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8032e1:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8032e6:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8032ec:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8032f2:	8b 52 50             	mov    0x50(%edx),%edx
+  8032f5:	39 ca                	cmp    %ecx,%edx
+  8032f7:	74 11                	je     80330a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8032f9:	83 c0 01             	add    $0x1,%eax
+  8032fc:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803301:	75 e3                	jne    8032e6 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803303:	b8 00 00 00 00       	mov    $0x0,%eax
+  803308:	eb 0e                	jmp    803318 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80330a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803310:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803315:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803318:	5d                   	pop    %ebp
+  803319:	c3                   	ret
+
+0080331a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80331a:	55                   	push   %ebp
+  80331b:	89 e5                	mov    %esp,%ebp
+  80331d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803320:	89 c2                	mov    %eax,%edx
+  803322:	c1 ea 16             	shr    $0x16,%edx
+  803325:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80332c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803331:	f6 c1 01             	test   $0x1,%cl
+  803334:	74 1a                	je     803350 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803336:	c1 e8 0c             	shr    $0xc,%eax
+  803339:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803340:	a8 01                	test   $0x1,%al
+  803342:	74 0c                	je     803350 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803344:	c1 e8 0c             	shr    $0xc,%eax
+  803347:	c1 e0 04             	shl    $0x4,%eax
+  80334a:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803350:	89 d0                	mov    %edx,%eax
+  803352:	5d                   	pop    %ebp
+  803353:	c3                   	ret
@@ -0,0 +1,7172 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 01 01 00 00       	call   800132 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800038:	e8 48 0d 00 00       	call   800d85 <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800044:	e8 b3 1c 00 00       	call   801cfc <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 12                	je     80005f <umain+0x2c>
+	for (i = 0; i < 20; i++)
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+			break;
+	if (i == 20) {
+		sys_yield();
+  800055:	e8 71 0d 00 00       	call   800dcb <sys_yield>
+		return;
+  80005a:	e9 93 00 00 00       	jmp    8000f2 <umain+0xbf>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80005f:	89 f0                	mov    %esi,%eax
+  800061:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800066:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80006c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800071:	eb 02                	jmp    800075 <umain+0x42>
+		asm volatile("pause");
+  800073:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800075:	8b 50 54             	mov    0x54(%eax),%edx
+  800078:	85 d2                	test   %edx,%edx
+  80007a:	75 f7                	jne    800073 <umain+0x40>
+  80007c:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  800081:	eb 12                	jmp    800095 <umain+0x62>
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+		for (j = 0; j < 10000; j++)
+			counter++;
+  800083:	a1 08 50 80 00       	mov    0x805008,%eax
+  800088:	83 c0 01             	add    $0x1,%eax
+  80008b:	a3 08 50 80 00       	mov    %eax,0x805008
+		for (j = 0; j < 10000; j++)
+  800090:	83 ea 01             	sub    $0x1,%edx
+  800093:	75 ee                	jne    800083 <umain+0x50>
+	for (i = 0; i < 10; i++) {
+  800095:	83 eb 01             	sub    $0x1,%ebx
+  800098:	74 0c                	je     8000a6 <umain+0x73>
+		sys_yield();
+  80009a:	e8 2c 0d 00 00       	call   800dcb <sys_yield>
+		for (j = 0; j < 10000; j++)
+  80009f:	ba 11 27 00 00       	mov    $0x2711,%edx
+  8000a4:	eb ea                	jmp    800090 <umain+0x5d>
+	}
+
+	if (counter != 10*10000)
+  8000a6:	a1 08 50 80 00       	mov    0x805008,%eax
+  8000ab:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000b0:	75 47                	jne    8000f9 <umain+0xc6>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000b2:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000b4:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8000b9:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000bf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8000c4:	76 4a                	jbe    800110 <umain+0xdd>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000c6:	8b 4a 5c             	mov    0x5c(%edx),%ecx
+  8000c9:	89 e0                	mov    %esp,%eax
+  8000cb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8000d0:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000d6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8000db:	76 44                	jbe    800121 <umain+0xee>
+  8000dd:	8b 42 48             	mov    0x48(%edx),%eax
+  8000e0:	83 ec 04             	sub    $0x4,%esp
+  8000e3:	51                   	push   %ecx
+  8000e4:	50                   	push   %eax
+  8000e5:	68 1b 34 80 00       	push   $0x80341b
+  8000ea:	e8 e2 01 00 00       	call   8002d1 <cprintf>
+  8000ef:	83 c4 10             	add    $0x10,%esp
+
+}
+  8000f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000f5:	5b                   	pop    %ebx
+  8000f6:	5e                   	pop    %esi
+  8000f7:	5d                   	pop    %ebp
+  8000f8:	c3                   	ret
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  8000f9:	a1 08 50 80 00       	mov    0x805008,%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	68 e0 33 80 00       	push   $0x8033e0
+  800104:	6a 21                	push   $0x21
+  800106:	68 08 34 80 00       	push   $0x803408
+  80010b:	e8 e6 00 00 00       	call   8001f6 <_panic>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800110:	c1 e8 10             	shr    $0x10,%eax
+  800113:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800119:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80011f:	eb a5                	jmp    8000c6 <umain+0x93>
+  800121:	c1 e8 10             	shr    $0x10,%eax
+  800124:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80012a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800130:	eb ab                	jmp    8000dd <umain+0xaa>
+
+00800132 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800132:	55                   	push   %ebp
+  800133:	89 e5                	mov    %esp,%ebp
+  800135:	57                   	push   %edi
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  800138:	83 ec 0c             	sub    $0xc,%esp
+  80013b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80013e:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800141:	b8 01 00 00 00       	mov    $0x1,%eax
+  800146:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800148:	c1 ea 0b             	shr    $0xb,%edx
+  80014b:	83 f2 01             	xor    $0x1,%edx
+  80014e:	83 e2 01             	and    $0x1,%edx
+  800151:	88 15 10 50 80 00    	mov    %dl,0x805010
+
+	mainenv = NULL;
+  800157:	c7 05 0c 50 80 00 00 	movl   $0x0,0x80500c
+  80015e:	00 00 00 
+	envid = sys_getenvid();
+  800161:	e8 1f 0c 00 00       	call   800d85 <sys_getenvid>
+  800166:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80016d:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800173:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800179:	8b 52 48             	mov    0x48(%edx),%edx
+  80017c:	39 ca                	cmp    %ecx,%edx
+  80017e:	74 27                	je     8001a7 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800180:	83 c0 01             	add    $0x1,%eax
+  800183:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800188:	75 e3                	jne    80016d <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80018a:	83 3d 0c 50 80 00 00 	cmpl   $0x0,0x80500c
+  800191:	75 24                	jne    8001b7 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800193:	83 ec 04             	sub    $0x4,%esp
+  800196:	68 3c 34 80 00       	push   $0x80343c
+  80019b:	6a 23                	push   $0x23
+  80019d:	68 5f 34 80 00       	push   $0x80345f
+  8001a2:	e8 4f 00 00 00       	call   8001f6 <_panic>
+			mainenv = &envs[i];
+  8001a7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001ad:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001b2:	a3 0c 50 80 00       	mov    %eax,0x80500c
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001b7:	85 ff                	test   %edi,%edi
+  8001b9:	7e 07                	jle    8001c2 <libmain+0x90>
+		binaryname = argv[0];
+  8001bb:	8b 06                	mov    (%esi),%eax
+  8001bd:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001c2:	83 ec 08             	sub    $0x8,%esp
+  8001c5:	56                   	push   %esi
+  8001c6:	57                   	push   %edi
+  8001c7:	e8 67 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001cc:	e8 0b 00 00 00       	call   8001dc <exit>
+}
+  8001d1:	83 c4 10             	add    $0x10,%esp
+  8001d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d7:	5b                   	pop    %ebx
+  8001d8:	5e                   	pop    %esi
+  8001d9:	5f                   	pop    %edi
+  8001da:	5d                   	pop    %ebp
+  8001db:	c3                   	ret
+
+008001dc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001dc:	55                   	push   %ebp
+  8001dd:	89 e5                	mov    %esp,%ebp
+  8001df:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001e2:	e8 9c 1f 00 00       	call   802183 <close_all>
+	sys_env_destroy(0);
+  8001e7:	83 ec 0c             	sub    $0xc,%esp
+  8001ea:	6a 00                	push   $0x0
+  8001ec:	e8 2b 0b 00 00       	call   800d1c <sys_env_destroy>
+}
+  8001f1:	83 c4 10             	add    $0x10,%esp
+  8001f4:	c9                   	leave
+  8001f5:	c3                   	ret
+
+008001f6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f6:	55                   	push   %ebp
+  8001f7:	89 e5                	mov    %esp,%ebp
+  8001f9:	56                   	push   %esi
+  8001fa:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001fb:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001fe:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800204:	e8 7c 0b 00 00       	call   800d85 <sys_getenvid>
+  800209:	83 ec 0c             	sub    $0xc,%esp
+  80020c:	ff 75 0c             	push   0xc(%ebp)
+  80020f:	ff 75 08             	push   0x8(%ebp)
+  800212:	56                   	push   %esi
+  800213:	50                   	push   %eax
+  800214:	68 78 34 80 00       	push   $0x803478
+  800219:	e8 b3 00 00 00       	call   8002d1 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80021e:	83 c4 18             	add    $0x18,%esp
+  800221:	53                   	push   %ebx
+  800222:	ff 75 10             	push   0x10(%ebp)
+  800225:	e8 56 00 00 00       	call   800280 <vcprintf>
+	cprintf("\n");
+  80022a:	c7 04 24 37 34 80 00 	movl   $0x803437,(%esp)
+  800231:	e8 9b 00 00 00       	call   8002d1 <cprintf>
+  800236:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800239:	cc                   	int3
+	while (1)
+  80023a:	eb fd                	jmp    800239 <_panic+0x43>
+
+0080023c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	53                   	push   %ebx
+  800240:	83 ec 04             	sub    $0x4,%esp
+  800243:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800246:	8b 13                	mov    (%ebx),%edx
+  800248:	8d 42 01             	lea    0x1(%edx),%eax
+  80024b:	89 03                	mov    %eax,(%ebx)
+  80024d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800250:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800254:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800259:	74 09                	je     800264 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80025b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80025f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800262:	c9                   	leave
+  800263:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800264:	83 ec 08             	sub    $0x8,%esp
+  800267:	68 ff 00 00 00       	push   $0xff
+  80026c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80026f:	50                   	push   %eax
+  800270:	e8 1d 0a 00 00       	call   800c92 <sys_cputs>
+		b->idx = 0;
+  800275:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80027b:	83 c4 10             	add    $0x10,%esp
+  80027e:	eb db                	jmp    80025b <putch+0x1f>
+
+00800280 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800289:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800290:	00 00 00 
+	b.cnt = 0;
+  800293:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80029a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80029d:	ff 75 0c             	push   0xc(%ebp)
+  8002a0:	ff 75 08             	push   0x8(%ebp)
+  8002a3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002a9:	50                   	push   %eax
+  8002aa:	68 3c 02 80 00       	push   $0x80023c
+  8002af:	e8 fb 00 00 00       	call   8003af <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002b4:	83 c4 08             	add    $0x8,%esp
+  8002b7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002bd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c3:	50                   	push   %eax
+  8002c4:	e8 c9 09 00 00       	call   800c92 <sys_cputs>
+
+	return b.cnt;
+}
+  8002c9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002cf:	c9                   	leave
+  8002d0:	c3                   	ret
+
+008002d1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002d1:	55                   	push   %ebp
+  8002d2:	89 e5                	mov    %esp,%ebp
+  8002d4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002d7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002da:	50                   	push   %eax
+  8002db:	ff 75 08             	push   0x8(%ebp)
+  8002de:	e8 9d ff ff ff       	call   800280 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002e3:	c9                   	leave
+  8002e4:	c3                   	ret
+
+008002e5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8002e5:	55                   	push   %ebp
+  8002e6:	89 e5                	mov    %esp,%ebp
+  8002e8:	57                   	push   %edi
+  8002e9:	56                   	push   %esi
+  8002ea:	53                   	push   %ebx
+  8002eb:	83 ec 1c             	sub    $0x1c,%esp
+  8002ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002f1:	89 d6                	mov    %edx,%esi
+  8002f3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002f9:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002fc:	73 0b                	jae    800309 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002fe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800301:	c1 e7 08             	shl    $0x8,%edi
+  800304:	0b 7d 10             	or     0x10(%ebp),%edi
+  800307:	eb 36                	jmp    80033f <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800309:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80030c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800311:	f7 75 08             	divl   0x8(%ebp)
+  800314:	89 c1                	mov    %eax,%ecx
+  800316:	ff 75 14             	push   0x14(%ebp)
+  800319:	ff 75 10             	push   0x10(%ebp)
+  80031c:	83 eb 01             	sub    $0x1,%ebx
+  80031f:	53                   	push   %ebx
+  800320:	ff 75 08             	push   0x8(%ebp)
+  800323:	89 f2                	mov    %esi,%edx
+  800325:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800328:	e8 b8 ff ff ff       	call   8002e5 <printnum>
+  80032d:	83 c4 10             	add    $0x10,%esp
+  800330:	eb 14                	jmp    800346 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800332:	83 ec 08             	sub    $0x8,%esp
+  800335:	56                   	push   %esi
+  800336:	57                   	push   %edi
+  800337:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80033a:	ff d0                	call   *%eax
+  80033c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80033f:	83 eb 01             	sub    $0x1,%ebx
+  800342:	85 db                	test   %ebx,%ebx
+  800344:	7f ec                	jg     800332 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800346:	83 ec 08             	sub    $0x8,%esp
+  800349:	56                   	push   %esi
+  80034a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80034d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800352:	f7 75 08             	divl   0x8(%ebp)
+  800355:	0f be 92 9b 34 80 00 	movsbl 0x80349b(%edx),%edx
+  80035c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035f:	c1 e0 08             	shl    $0x8,%eax
+  800362:	09 d0                	or     %edx,%eax
+  800364:	50                   	push   %eax
+  800365:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800368:	ff d0                	call   *%eax
+}
+  80036a:	83 c4 10             	add    $0x10,%esp
+  80036d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800370:	5b                   	pop    %ebx
+  800371:	5e                   	pop    %esi
+  800372:	5f                   	pop    %edi
+  800373:	5d                   	pop    %ebp
+  800374:	c3                   	ret
+
+00800375 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800375:	55                   	push   %ebp
+  800376:	89 e5                	mov    %esp,%ebp
+  800378:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80037b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80037f:	8b 10                	mov    (%eax),%edx
+  800381:	3b 50 04             	cmp    0x4(%eax),%edx
+  800384:	73 0a                	jae    800390 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800386:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800389:	89 08                	mov    %ecx,(%eax)
+  80038b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80038e:	88 02                	mov    %al,(%edx)
+}
+  800390:	5d                   	pop    %ebp
+  800391:	c3                   	ret
+
+00800392 <printfmt>:
+{
+  800392:	55                   	push   %ebp
+  800393:	89 e5                	mov    %esp,%ebp
+  800395:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800398:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80039b:	50                   	push   %eax
+  80039c:	ff 75 10             	push   0x10(%ebp)
+  80039f:	ff 75 0c             	push   0xc(%ebp)
+  8003a2:	ff 75 08             	push   0x8(%ebp)
+  8003a5:	e8 05 00 00 00       	call   8003af <vprintfmt>
+}
+  8003aa:	83 c4 10             	add    $0x10,%esp
+  8003ad:	c9                   	leave
+  8003ae:	c3                   	ret
+
+008003af <vprintfmt>:
+{
+  8003af:	55                   	push   %ebp
+  8003b0:	89 e5                	mov    %esp,%ebp
+  8003b2:	57                   	push   %edi
+  8003b3:	56                   	push   %esi
+  8003b4:	53                   	push   %ebx
+  8003b5:	83 ec 3c             	sub    $0x3c,%esp
+  8003b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8003bb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8003be:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003c5:	eb 16                	jmp    8003dd <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8003c7:	83 ec 08             	sub    $0x8,%esp
+  8003ca:	ff 75 0c             	push   0xc(%ebp)
+  8003cd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003d0:	c1 e2 08             	shl    $0x8,%edx
+  8003d3:	09 d0                	or     %edx,%eax
+  8003d5:	50                   	push   %eax
+  8003d6:	ff d7                	call   *%edi
+  8003d8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003db:	89 de                	mov    %ebx,%esi
+  8003dd:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003e0:	0f b6 06             	movzbl (%esi),%eax
+  8003e3:	83 f8 25             	cmp    $0x25,%eax
+  8003e6:	74 0c                	je     8003f4 <vprintfmt+0x45>
+			if (ch == '\0')
+  8003e8:	85 c0                	test   %eax,%eax
+  8003ea:	75 db                	jne    8003c7 <vprintfmt+0x18>
+}
+  8003ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ef:	5b                   	pop    %ebx
+  8003f0:	5e                   	pop    %esi
+  8003f1:	5f                   	pop    %edi
+  8003f2:	5d                   	pop    %ebp
+  8003f3:	c3                   	ret
+		padc = ' ';
+  8003f4:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003f8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003ff:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800406:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80040d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800412:	8d 73 01             	lea    0x1(%ebx),%esi
+  800415:	0f b6 13             	movzbl (%ebx),%edx
+  800418:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80041b:	3c 55                	cmp    $0x55,%al
+  80041d:	0f 87 2c 04 00 00    	ja     80084f <vprintfmt+0x4a0>
+  800423:	0f b6 c0             	movzbl %al,%eax
+  800426:	ff 24 85 e0 35 80 00 	jmp    *0x8035e0(,%eax,4)
+  80042d:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80042f:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800433:	eb dd                	jmp    800412 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800435:	89 f3                	mov    %esi,%ebx
+  800437:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80043b:	eb d5                	jmp    800412 <vprintfmt+0x63>
+  80043d:	0f b6 d2             	movzbl %dl,%edx
+  800440:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800447:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80044a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80044e:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800451:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800454:	83 fe 09             	cmp    $0x9,%esi
+  800457:	0f 87 8a 00 00 00    	ja     8004e7 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80045d:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800460:	eb e5                	jmp    800447 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800462:	8b 45 14             	mov    0x14(%ebp),%eax
+  800465:	8b 00                	mov    (%eax),%eax
+  800467:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80046a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046d:	8d 40 04             	lea    0x4(%eax),%eax
+  800470:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800473:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800475:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800479:	79 97                	jns    800412 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80047b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80047e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800481:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800488:	eb 88                	jmp    800412 <vprintfmt+0x63>
+			if (width < 0)
+  80048a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80048d:	85 db                	test   %ebx,%ebx
+  80048f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800494:	0f 49 c3             	cmovns %ebx,%eax
+  800497:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80049a:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80049c:	e9 71 ff ff ff       	jmp    800412 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004a1:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8004a3:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004aa:	e9 63 ff ff ff       	jmp    800412 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8004af:	8d 73 02             	lea    0x2(%ebx),%esi
+  8004b2:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8004b6:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8004bd:	3c 67                	cmp    $0x67,%al
+  8004bf:	0f 84 18 ff ff ff    	je     8003dd <vprintfmt+0x2e>
+					attrib = 0x04;
+  8004c5:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8004cc:	3c 72                	cmp    $0x72,%al
+  8004ce:	0f 84 09 ff ff ff    	je     8003dd <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004d4:	3c 62                	cmp    $0x62,%al
+  8004d6:	0f 94 c0             	sete   %al
+  8004d9:	0f b6 c0             	movzbl %al,%eax
+  8004dc:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004e2:	e9 f6 fe ff ff       	jmp    8003dd <vprintfmt+0x2e>
+  8004e7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ea:	eb 89                	jmp    800475 <vprintfmt+0xc6>
+			lflag++;
+  8004ec:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ef:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004f1:	e9 1c ff ff ff       	jmp    800412 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f9:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	ff 75 0c             	push   0xc(%ebp)
+  800502:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800505:	c1 e0 08             	shl    $0x8,%eax
+  800508:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80050b:	0b 01                	or     (%ecx),%eax
+  80050d:	50                   	push   %eax
+  80050e:	ff d7                	call   *%edi
+			break;
+  800510:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800513:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800516:	e9 c2 fe ff ff       	jmp    8003dd <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80051b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051e:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800521:	8b 10                	mov    (%eax),%edx
+  800523:	89 d0                	mov    %edx,%eax
+  800525:	f7 d8                	neg    %eax
+  800527:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80052a:	83 f8 12             	cmp    $0x12,%eax
+  80052d:	7f 25                	jg     800554 <vprintfmt+0x1a5>
+  80052f:	8b 14 85 40 37 80 00 	mov    0x803740(,%eax,4),%edx
+  800536:	85 d2                	test   %edx,%edx
+  800538:	74 1a                	je     800554 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80053a:	52                   	push   %edx
+  80053b:	68 82 38 80 00       	push   $0x803882
+  800540:	ff 75 0c             	push   0xc(%ebp)
+  800543:	57                   	push   %edi
+  800544:	e8 49 fe ff ff       	call   800392 <printfmt>
+  800549:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80054c:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80054f:	e9 89 fe ff ff       	jmp    8003dd <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800554:	50                   	push   %eax
+  800555:	68 b3 34 80 00       	push   $0x8034b3
+  80055a:	ff 75 0c             	push   0xc(%ebp)
+  80055d:	57                   	push   %edi
+  80055e:	e8 2f fe ff ff       	call   800392 <printfmt>
+  800563:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800566:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800569:	e9 6f fe ff ff       	jmp    8003dd <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	83 c0 04             	add    $0x4,%eax
+  800574:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80057c:	85 c9                	test   %ecx,%ecx
+  80057e:	b8 ac 34 80 00       	mov    $0x8034ac,%eax
+  800583:	0f 45 c1             	cmovne %ecx,%eax
+  800586:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800589:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80058d:	7e 06                	jle    800595 <vprintfmt+0x1e6>
+  80058f:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800593:	75 1a                	jne    8005af <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800595:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800598:	c1 e0 08             	shl    $0x8,%eax
+  80059b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80059e:	83 c8 3f             	or     $0x3f,%eax
+  8005a1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005a4:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8005a7:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005aa:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8005ad:	eb 6d                	jmp    80061c <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005af:	83 ec 08             	sub    $0x8,%esp
+  8005b2:	ff 75 d0             	push   -0x30(%ebp)
+  8005b5:	ff 75 c8             	push   -0x38(%ebp)
+  8005b8:	e8 39 03 00 00       	call   8008f6 <strnlen>
+  8005bd:	89 c2                	mov    %eax,%edx
+  8005bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c2:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8005c4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005c7:	c1 e1 08             	shl    $0x8,%ecx
+  8005ca:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8005ce:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d0:	83 c4 10             	add    $0x10,%esp
+  8005d3:	89 c3                	mov    %eax,%ebx
+  8005d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d8:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005db:	89 ce                	mov    %ecx,%esi
+  8005dd:	eb 0f                	jmp    8005ee <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005df:	83 ec 08             	sub    $0x8,%esp
+  8005e2:	ff 75 0c             	push   0xc(%ebp)
+  8005e5:	56                   	push   %esi
+  8005e6:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005e8:	83 eb 01             	sub    $0x1,%ebx
+  8005eb:	83 c4 10             	add    $0x10,%esp
+  8005ee:	85 db                	test   %ebx,%ebx
+  8005f0:	7f ed                	jg     8005df <vprintfmt+0x230>
+  8005f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005f8:	85 c0                	test   %eax,%eax
+  8005fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ff:	0f 49 d0             	cmovns %eax,%edx
+  800602:	29 d0                	sub    %edx,%eax
+  800604:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800607:	eb 8c                	jmp    800595 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800609:	83 ec 08             	sub    $0x8,%esp
+  80060c:	ff 75 0c             	push   0xc(%ebp)
+  80060f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800612:	09 c2                	or     %eax,%edx
+  800614:	52                   	push   %edx
+  800615:	ff d7                	call   *%edi
+  800617:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80061a:	89 d9                	mov    %ebx,%ecx
+  80061c:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80061f:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800623:	0f be d0             	movsbl %al,%edx
+  800626:	85 d2                	test   %edx,%edx
+  800628:	74 2a                	je     800654 <vprintfmt+0x2a5>
+  80062a:	85 f6                	test   %esi,%esi
+  80062c:	78 05                	js     800633 <vprintfmt+0x284>
+  80062e:	83 ee 01             	sub    $0x1,%esi
+  800631:	78 3b                	js     80066e <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800633:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800637:	74 d0                	je     800609 <vprintfmt+0x25a>
+  800639:	0f be c0             	movsbl %al,%eax
+  80063c:	83 e8 20             	sub    $0x20,%eax
+  80063f:	83 f8 5e             	cmp    $0x5e,%eax
+  800642:	76 c5                	jbe    800609 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800644:	83 ec 08             	sub    $0x8,%esp
+  800647:	ff 75 0c             	push   0xc(%ebp)
+  80064a:	ff 75 cc             	push   -0x34(%ebp)
+  80064d:	ff d7                	call   *%edi
+  80064f:	83 c4 10             	add    $0x10,%esp
+  800652:	eb c6                	jmp    80061a <vprintfmt+0x26b>
+  800654:	8b 75 10             	mov    0x10(%ebp),%esi
+  800657:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80065a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80065d:	01 c3                	add    %eax,%ebx
+  80065f:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800661:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800664:	83 c8 20             	or     $0x20,%eax
+  800667:	89 75 10             	mov    %esi,0x10(%ebp)
+  80066a:	89 c6                	mov    %eax,%esi
+  80066c:	eb 14                	jmp    800682 <vprintfmt+0x2d3>
+  80066e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800671:	eb e4                	jmp    800657 <vprintfmt+0x2a8>
+  800673:	83 ec 08             	sub    $0x8,%esp
+  800676:	ff 75 0c             	push   0xc(%ebp)
+  800679:	56                   	push   %esi
+  80067a:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80067c:	83 eb 01             	sub    $0x1,%ebx
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	85 db                	test   %ebx,%ebx
+  800684:	7f ed                	jg     800673 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800686:	8b 75 10             	mov    0x10(%ebp),%esi
+  800689:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80068c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80068f:	e9 49 fd ff ff       	jmp    8003dd <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800694:	83 f9 01             	cmp    $0x1,%ecx
+  800697:	7f 1f                	jg     8006b8 <vprintfmt+0x309>
+	else if (lflag)
+  800699:	85 c9                	test   %ecx,%ecx
+  80069b:	74 69                	je     800706 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8b 00                	mov    (%eax),%eax
+  8006a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a5:	89 c1                	mov    %eax,%ecx
+  8006a7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006aa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b6:	eb 17                	jmp    8006cf <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 50 04             	mov    0x4(%eax),%edx
+  8006be:	8b 00                	mov    (%eax),%eax
+  8006c0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006cf:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006d2:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006da:	85 db                	test   %ebx,%ebx
+  8006dc:	0f 89 f6 00 00 00    	jns    8007d8 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006e2:	83 ec 08             	sub    $0x8,%esp
+  8006e5:	ff 75 0c             	push   0xc(%ebp)
+  8006e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006eb:	c1 e0 08             	shl    $0x8,%eax
+  8006ee:	83 c8 2d             	or     $0x2d,%eax
+  8006f1:	50                   	push   %eax
+  8006f2:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006f4:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006f7:	f7 d9                	neg    %ecx
+  8006f9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800701:	e9 d2 00 00 00       	jmp    8007d8 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8b 00                	mov    (%eax),%eax
+  80070b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070e:	89 c1                	mov    %eax,%ecx
+  800710:	c1 f9 1f             	sar    $0x1f,%ecx
+  800713:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800716:	8b 45 14             	mov    0x14(%ebp),%eax
+  800719:	8d 40 04             	lea    0x4(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80071f:	eb ae                	jmp    8006cf <vprintfmt+0x320>
+	if (lflag >= 2)
+  800721:	83 f9 01             	cmp    $0x1,%ecx
+  800724:	7f 19                	jg     80073f <vprintfmt+0x390>
+	else if (lflag)
+  800726:	85 c9                	test   %ecx,%ecx
+  800728:	74 2a                	je     800754 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80072a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072d:	8b 08                	mov    (%eax),%ecx
+  80072f:	8d 40 04             	lea    0x4(%eax),%eax
+  800732:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800735:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80073a:	e9 99 00 00 00       	jmp    8007d8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80073f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800742:	8b 08                	mov    (%eax),%ecx
+  800744:	8d 40 08             	lea    0x8(%eax),%eax
+  800747:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80074a:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80074f:	e9 84 00 00 00       	jmp    8007d8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800754:	8b 45 14             	mov    0x14(%ebp),%eax
+  800757:	8b 08                	mov    (%eax),%ecx
+  800759:	8d 40 04             	lea    0x4(%eax),%eax
+  80075c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80075f:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800764:	eb 72                	jmp    8007d8 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800766:	83 f9 01             	cmp    $0x1,%ecx
+  800769:	7f 16                	jg     800781 <vprintfmt+0x3d2>
+	else if (lflag)
+  80076b:	85 c9                	test   %ecx,%ecx
+  80076d:	74 24                	je     800793 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	8b 08                	mov    (%eax),%ecx
+  800774:	8d 40 04             	lea    0x4(%eax),%eax
+  800777:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80077a:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80077f:	eb 57                	jmp    8007d8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800781:	8b 45 14             	mov    0x14(%ebp),%eax
+  800784:	8b 08                	mov    (%eax),%ecx
+  800786:	8d 40 08             	lea    0x8(%eax),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80078c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800791:	eb 45                	jmp    8007d8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800793:	8b 45 14             	mov    0x14(%ebp),%eax
+  800796:	8b 08                	mov    (%eax),%ecx
+  800798:	8d 40 04             	lea    0x4(%eax),%eax
+  80079b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80079e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8007a3:	eb 33                	jmp    8007d8 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8007a5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007a8:	c1 e3 08             	shl    $0x8,%ebx
+  8007ab:	83 ec 08             	sub    $0x8,%esp
+  8007ae:	ff 75 0c             	push   0xc(%ebp)
+  8007b1:	89 d8                	mov    %ebx,%eax
+  8007b3:	83 c8 30             	or     $0x30,%eax
+  8007b6:	50                   	push   %eax
+  8007b7:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8007b9:	83 c4 08             	add    $0x8,%esp
+  8007bc:	ff 75 0c             	push   0xc(%ebp)
+  8007bf:	83 cb 78             	or     $0x78,%ebx
+  8007c2:	53                   	push   %ebx
+  8007c3:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c8:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8007ca:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d3:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8007db:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007df:	52                   	push   %edx
+  8007e0:	ff 75 e0             	push   -0x20(%ebp)
+  8007e3:	50                   	push   %eax
+  8007e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e7:	89 f8                	mov    %edi,%eax
+  8007e9:	e8 f7 fa ff ff       	call   8002e5 <printnum>
+			break;
+  8007ee:	83 c4 10             	add    $0x10,%esp
+  8007f1:	e9 e7 fb ff ff       	jmp    8003dd <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007f6:	83 f9 01             	cmp    $0x1,%ecx
+  8007f9:	7f 16                	jg     800811 <vprintfmt+0x462>
+	else if (lflag)
+  8007fb:	85 c9                	test   %ecx,%ecx
+  8007fd:	74 24                	je     800823 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800802:	8b 08                	mov    (%eax),%ecx
+  800804:	8d 40 04             	lea    0x4(%eax),%eax
+  800807:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80080a:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80080f:	eb c7                	jmp    8007d8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800811:	8b 45 14             	mov    0x14(%ebp),%eax
+  800814:	8b 08                	mov    (%eax),%ecx
+  800816:	8d 40 08             	lea    0x8(%eax),%eax
+  800819:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800821:	eb b5                	jmp    8007d8 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800823:	8b 45 14             	mov    0x14(%ebp),%eax
+  800826:	8b 08                	mov    (%eax),%ecx
+  800828:	8d 40 04             	lea    0x4(%eax),%eax
+  80082b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80082e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800833:	eb a3                	jmp    8007d8 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800835:	83 ec 08             	sub    $0x8,%esp
+  800838:	ff 75 0c             	push   0xc(%ebp)
+  80083b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80083e:	c1 e0 08             	shl    $0x8,%eax
+  800841:	83 c8 25             	or     $0x25,%eax
+  800844:	50                   	push   %eax
+  800845:	ff d7                	call   *%edi
+			break;
+  800847:	83 c4 10             	add    $0x10,%esp
+  80084a:	e9 8e fb ff ff       	jmp    8003dd <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80084f:	83 ec 08             	sub    $0x8,%esp
+  800852:	ff 75 0c             	push   0xc(%ebp)
+  800855:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800858:	c1 e0 08             	shl    $0x8,%eax
+  80085b:	83 c8 25             	or     $0x25,%eax
+  80085e:	50                   	push   %eax
+  80085f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800861:	83 c4 10             	add    $0x10,%esp
+  800864:	89 de                	mov    %ebx,%esi
+  800866:	eb 03                	jmp    80086b <vprintfmt+0x4bc>
+  800868:	83 ee 01             	sub    $0x1,%esi
+  80086b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80086f:	75 f7                	jne    800868 <vprintfmt+0x4b9>
+  800871:	e9 67 fb ff ff       	jmp    8003dd <vprintfmt+0x2e>
+
+00800876 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	83 ec 18             	sub    $0x18,%esp
+  80087c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800882:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800885:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800889:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80088c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800893:	85 c0                	test   %eax,%eax
+  800895:	74 26                	je     8008bd <vsnprintf+0x47>
+  800897:	85 d2                	test   %edx,%edx
+  800899:	7e 22                	jle    8008bd <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80089b:	ff 75 14             	push   0x14(%ebp)
+  80089e:	ff 75 10             	push   0x10(%ebp)
+  8008a1:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008a4:	50                   	push   %eax
+  8008a5:	68 75 03 80 00       	push   $0x800375
+  8008aa:	e8 00 fb ff ff       	call   8003af <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008b2:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008b8:	83 c4 10             	add    $0x10,%esp
+}
+  8008bb:	c9                   	leave
+  8008bc:	c3                   	ret
+		return -E_INVAL;
+  8008bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008c2:	eb f7                	jmp    8008bb <vsnprintf+0x45>
+
+008008c4 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008c4:	55                   	push   %ebp
+  8008c5:	89 e5                	mov    %esp,%ebp
+  8008c7:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8008ca:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008cd:	50                   	push   %eax
+  8008ce:	ff 75 10             	push   0x10(%ebp)
+  8008d1:	ff 75 0c             	push   0xc(%ebp)
+  8008d4:	ff 75 08             	push   0x8(%ebp)
+  8008d7:	e8 9a ff ff ff       	call   800876 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008dc:	c9                   	leave
+  8008dd:	c3                   	ret
+
+008008de <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008de:	55                   	push   %ebp
+  8008df:	89 e5                	mov    %esp,%ebp
+  8008e1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e9:	eb 03                	jmp    8008ee <strlen+0x10>
+		n++;
+  8008eb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008ee:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008f2:	75 f7                	jne    8008eb <strlen+0xd>
+	return n;
+}
+  8008f4:	5d                   	pop    %ebp
+  8008f5:	c3                   	ret
+
+008008f6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800904:	eb 03                	jmp    800909 <strnlen+0x13>
+		n++;
+  800906:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800909:	39 d0                	cmp    %edx,%eax
+  80090b:	74 08                	je     800915 <strnlen+0x1f>
+  80090d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800911:	75 f3                	jne    800906 <strnlen+0x10>
+  800913:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800915:	89 d0                	mov    %edx,%eax
+  800917:	5d                   	pop    %ebp
+  800918:	c3                   	ret
+
+00800919 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	53                   	push   %ebx
+  80091d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800920:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800923:	b8 00 00 00 00       	mov    $0x0,%eax
+  800928:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80092c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80092f:	83 c0 01             	add    $0x1,%eax
+  800932:	84 d2                	test   %dl,%dl
+  800934:	75 f2                	jne    800928 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800936:	89 c8                	mov    %ecx,%eax
+  800938:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093b:	c9                   	leave
+  80093c:	c3                   	ret
+
+0080093d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	53                   	push   %ebx
+  800941:	83 ec 10             	sub    $0x10,%esp
+  800944:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800947:	53                   	push   %ebx
+  800948:	e8 91 ff ff ff       	call   8008de <strlen>
+  80094d:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800950:	ff 75 0c             	push   0xc(%ebp)
+  800953:	01 d8                	add    %ebx,%eax
+  800955:	50                   	push   %eax
+  800956:	e8 be ff ff ff       	call   800919 <strcpy>
+	return dst;
+}
+  80095b:	89 d8                	mov    %ebx,%eax
+  80095d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800960:	c9                   	leave
+  800961:	c3                   	ret
+
+00800962 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	56                   	push   %esi
+  800966:	53                   	push   %ebx
+  800967:	8b 75 08             	mov    0x8(%ebp),%esi
+  80096a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80096d:	89 f3                	mov    %esi,%ebx
+  80096f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800972:	89 f0                	mov    %esi,%eax
+  800974:	eb 0f                	jmp    800985 <strncpy+0x23>
+		*dst++ = *src;
+  800976:	83 c0 01             	add    $0x1,%eax
+  800979:	0f b6 0a             	movzbl (%edx),%ecx
+  80097c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80097f:	80 f9 01             	cmp    $0x1,%cl
+  800982:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800985:	39 d8                	cmp    %ebx,%eax
+  800987:	75 ed                	jne    800976 <strncpy+0x14>
+	}
+	return ret;
+}
+  800989:	89 f0                	mov    %esi,%eax
+  80098b:	5b                   	pop    %ebx
+  80098c:	5e                   	pop    %esi
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	56                   	push   %esi
+  800993:	53                   	push   %ebx
+  800994:	8b 75 08             	mov    0x8(%ebp),%esi
+  800997:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80099a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80099d:	89 f0                	mov    %esi,%eax
+  80099f:	85 d2                	test   %edx,%edx
+  8009a1:	74 21                	je     8009c4 <strlcpy+0x35>
+  8009a3:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009a7:	89 f2                	mov    %esi,%edx
+  8009a9:	eb 09                	jmp    8009b4 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009ab:	83 c1 01             	add    $0x1,%ecx
+  8009ae:	83 c2 01             	add    $0x1,%edx
+  8009b1:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009b4:	39 c2                	cmp    %eax,%edx
+  8009b6:	74 09                	je     8009c1 <strlcpy+0x32>
+  8009b8:	0f b6 19             	movzbl (%ecx),%ebx
+  8009bb:	84 db                	test   %bl,%bl
+  8009bd:	75 ec                	jne    8009ab <strlcpy+0x1c>
+  8009bf:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009c1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009c4:	29 f0                	sub    %esi,%eax
+}
+  8009c6:	5b                   	pop    %ebx
+  8009c7:	5e                   	pop    %esi
+  8009c8:	5d                   	pop    %ebp
+  8009c9:	c3                   	ret
+
+008009ca <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009ca:	55                   	push   %ebp
+  8009cb:	89 e5                	mov    %esp,%ebp
+  8009cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009d3:	eb 06                	jmp    8009db <strcmp+0x11>
+		p++, q++;
+  8009d5:	83 c1 01             	add    $0x1,%ecx
+  8009d8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009db:	0f b6 01             	movzbl (%ecx),%eax
+  8009de:	84 c0                	test   %al,%al
+  8009e0:	74 04                	je     8009e6 <strcmp+0x1c>
+  8009e2:	3a 02                	cmp    (%edx),%al
+  8009e4:	74 ef                	je     8009d5 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e6:	0f b6 c0             	movzbl %al,%eax
+  8009e9:	0f b6 12             	movzbl (%edx),%edx
+  8009ec:	29 d0                	sub    %edx,%eax
+}
+  8009ee:	5d                   	pop    %ebp
+  8009ef:	c3                   	ret
+
+008009f0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	53                   	push   %ebx
+  8009f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009fa:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009fd:	eb 09                	jmp    800a08 <strncmp+0x18>
+		n--, p++, q++;
+  8009ff:	83 ea 01             	sub    $0x1,%edx
+  800a02:	83 c0 01             	add    $0x1,%eax
+  800a05:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a08:	85 d2                	test   %edx,%edx
+  800a0a:	74 18                	je     800a24 <strncmp+0x34>
+  800a0c:	0f b6 18             	movzbl (%eax),%ebx
+  800a0f:	84 db                	test   %bl,%bl
+  800a11:	74 04                	je     800a17 <strncmp+0x27>
+  800a13:	3a 19                	cmp    (%ecx),%bl
+  800a15:	74 e8                	je     8009ff <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a17:	0f b6 00             	movzbl (%eax),%eax
+  800a1a:	0f b6 11             	movzbl (%ecx),%edx
+  800a1d:	29 d0                	sub    %edx,%eax
+}
+  800a1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a22:	c9                   	leave
+  800a23:	c3                   	ret
+		return 0;
+  800a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a29:	eb f4                	jmp    800a1f <strncmp+0x2f>
+
+00800a2b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a31:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a35:	eb 03                	jmp    800a3a <strchr+0xf>
+  800a37:	83 c0 01             	add    $0x1,%eax
+  800a3a:	0f b6 10             	movzbl (%eax),%edx
+  800a3d:	84 d2                	test   %dl,%dl
+  800a3f:	74 06                	je     800a47 <strchr+0x1c>
+		if (*s == c)
+  800a41:	38 ca                	cmp    %cl,%dl
+  800a43:	75 f2                	jne    800a37 <strchr+0xc>
+  800a45:	eb 05                	jmp    800a4c <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a4c:	5d                   	pop    %ebp
+  800a4d:	c3                   	ret
+
+00800a4e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a4e:	55                   	push   %ebp
+  800a4f:	89 e5                	mov    %esp,%ebp
+  800a51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a54:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a58:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a5b:	38 ca                	cmp    %cl,%dl
+  800a5d:	74 09                	je     800a68 <strfind+0x1a>
+  800a5f:	84 d2                	test   %dl,%dl
+  800a61:	74 05                	je     800a68 <strfind+0x1a>
+	for (; *s; s++)
+  800a63:	83 c0 01             	add    $0x1,%eax
+  800a66:	eb f0                	jmp    800a58 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a68:	5d                   	pop    %ebp
+  800a69:	c3                   	ret
+
+00800a6a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a6a:	55                   	push   %ebp
+  800a6b:	89 e5                	mov    %esp,%ebp
+  800a6d:	57                   	push   %edi
+  800a6e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a71:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a74:	85 c9                	test   %ecx,%ecx
+  800a76:	74 20                	je     800a98 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a78:	89 f8                	mov    %edi,%eax
+  800a7a:	09 c8                	or     %ecx,%eax
+  800a7c:	a8 03                	test   $0x3,%al
+  800a7e:	75 12                	jne    800a92 <memset+0x28>
+		c &= 0xFF;
+  800a80:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a84:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a8a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a8d:	fc                   	cld
+  800a8e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a90:	eb 06                	jmp    800a98 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a95:	fc                   	cld
+  800a96:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a98:	89 f8                	mov    %edi,%eax
+  800a9a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a9d:	c9                   	leave
+  800a9e:	c3                   	ret
+
+00800a9f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a9f:	55                   	push   %ebp
+  800aa0:	89 e5                	mov    %esp,%ebp
+  800aa2:	57                   	push   %edi
+  800aa3:	56                   	push   %esi
+  800aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aaa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aad:	39 c6                	cmp    %eax,%esi
+  800aaf:	73 32                	jae    800ae3 <memmove+0x44>
+  800ab1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ab4:	39 d0                	cmp    %edx,%eax
+  800ab6:	73 2b                	jae    800ae3 <memmove+0x44>
+		s += n;
+		d += n;
+  800ab8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800abb:	89 d6                	mov    %edx,%esi
+  800abd:	09 fe                	or     %edi,%esi
+  800abf:	09 ce                	or     %ecx,%esi
+  800ac1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ac7:	75 0e                	jne    800ad7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ac9:	83 ef 04             	sub    $0x4,%edi
+  800acc:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800acf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ad2:	fd                   	std
+  800ad3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad5:	eb 09                	jmp    800ae0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ad7:	83 ef 01             	sub    $0x1,%edi
+  800ada:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800add:	fd                   	std
+  800ade:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ae0:	fc                   	cld
+  800ae1:	eb 1a                	jmp    800afd <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ae3:	89 f2                	mov    %esi,%edx
+  800ae5:	09 c2                	or     %eax,%edx
+  800ae7:	09 ca                	or     %ecx,%edx
+  800ae9:	f6 c2 03             	test   $0x3,%dl
+  800aec:	75 0a                	jne    800af8 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800aee:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800af1:	89 c7                	mov    %eax,%edi
+  800af3:	fc                   	cld
+  800af4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af6:	eb 05                	jmp    800afd <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800af8:	89 c7                	mov    %eax,%edi
+  800afa:	fc                   	cld
+  800afb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800afd:	5e                   	pop    %esi
+  800afe:	5f                   	pop    %edi
+  800aff:	5d                   	pop    %ebp
+  800b00:	c3                   	ret
+
+00800b01 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b07:	ff 75 10             	push   0x10(%ebp)
+  800b0a:	ff 75 0c             	push   0xc(%ebp)
+  800b0d:	ff 75 08             	push   0x8(%ebp)
+  800b10:	e8 8a ff ff ff       	call   800a9f <memmove>
+}
+  800b15:	c9                   	leave
+  800b16:	c3                   	ret
+
+00800b17 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	56                   	push   %esi
+  800b1b:	53                   	push   %ebx
+  800b1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b22:	89 c6                	mov    %eax,%esi
+  800b24:	03 75 10             	add    0x10(%ebp),%esi
+  800b27:	eb 06                	jmp    800b2f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b29:	83 c0 01             	add    $0x1,%eax
+  800b2c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b2f:	39 f0                	cmp    %esi,%eax
+  800b31:	74 14                	je     800b47 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b33:	0f b6 08             	movzbl (%eax),%ecx
+  800b36:	0f b6 1a             	movzbl (%edx),%ebx
+  800b39:	38 d9                	cmp    %bl,%cl
+  800b3b:	74 ec                	je     800b29 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b3d:	0f b6 c1             	movzbl %cl,%eax
+  800b40:	0f b6 db             	movzbl %bl,%ebx
+  800b43:	29 d8                	sub    %ebx,%eax
+  800b45:	eb 05                	jmp    800b4c <memcmp+0x35>
+	}
+
+	return 0;
+  800b47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b4c:	5b                   	pop    %ebx
+  800b4d:	5e                   	pop    %esi
+  800b4e:	5d                   	pop    %ebp
+  800b4f:	c3                   	ret
+
+00800b50 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b59:	89 c2                	mov    %eax,%edx
+  800b5b:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b5e:	eb 03                	jmp    800b63 <memfind+0x13>
+  800b60:	83 c0 01             	add    $0x1,%eax
+  800b63:	39 d0                	cmp    %edx,%eax
+  800b65:	73 04                	jae    800b6b <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b67:	38 08                	cmp    %cl,(%eax)
+  800b69:	75 f5                	jne    800b60 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	57                   	push   %edi
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+  800b73:	83 ec 1c             	sub    $0x1c,%esp
+  800b76:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b79:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b7c:	eb 03                	jmp    800b81 <strtol+0x14>
+		s++;
+  800b7e:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b81:	0f b6 06             	movzbl (%esi),%eax
+  800b84:	3c 20                	cmp    $0x20,%al
+  800b86:	74 f6                	je     800b7e <strtol+0x11>
+  800b88:	3c 09                	cmp    $0x9,%al
+  800b8a:	74 f2                	je     800b7e <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b8c:	3c 2b                	cmp    $0x2b,%al
+  800b8e:	74 43                	je     800bd3 <strtol+0x66>
+	int neg = 0;
+  800b90:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b95:	3c 2d                	cmp    $0x2d,%al
+  800b97:	74 44                	je     800bdd <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b99:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b9f:	75 0f                	jne    800bb0 <strtol+0x43>
+  800ba1:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ba4:	74 41                	je     800be7 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ba6:	85 ff                	test   %edi,%edi
+  800ba8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bad:	0f 44 f8             	cmove  %eax,%edi
+  800bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800bba:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800bbd:	89 fb                	mov    %edi,%ebx
+  800bbf:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bc2:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800bc5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bc8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bcb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800bce:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bd1:	eb 67                	jmp    800c3a <strtol+0xcd>
+		s++;
+  800bd3:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800bd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bdb:	eb bc                	jmp    800b99 <strtol+0x2c>
+		s++, neg = 1;
+  800bdd:	83 c6 01             	add    $0x1,%esi
+  800be0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800be5:	eb b2                	jmp    800b99 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be7:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800beb:	74 0e                	je     800bfb <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800bed:	85 ff                	test   %edi,%edi
+  800bef:	75 bf                	jne    800bb0 <strtol+0x43>
+		s++, base = 8;
+  800bf1:	83 c6 01             	add    $0x1,%esi
+  800bf4:	bf 08 00 00 00       	mov    $0x8,%edi
+  800bf9:	eb b5                	jmp    800bb0 <strtol+0x43>
+		s += 2, base = 16;
+  800bfb:	83 c6 02             	add    $0x2,%esi
+  800bfe:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c03:	eb ab                	jmp    800bb0 <strtol+0x43>
+			dig = *s - '0';
+  800c05:	0f be c9             	movsbl %cl,%ecx
+  800c08:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c0b:	39 f9                	cmp    %edi,%ecx
+  800c0d:	7d 59                	jge    800c68 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c0f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c13:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c16:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c19:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c1c:	0f af d8             	imul   %eax,%ebx
+  800c1f:	0f af d7             	imul   %edi,%edx
+  800c22:	01 d3                	add    %edx,%ebx
+  800c24:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c27:	f7 e7                	mul    %edi
+  800c29:	01 da                	add    %ebx,%edx
+  800c2b:	89 cb                	mov    %ecx,%ebx
+  800c2d:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c30:	01 c8                	add    %ecx,%eax
+  800c32:	11 da                	adc    %ebx,%edx
+  800c34:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c37:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3d:	0f b6 08             	movzbl (%eax),%ecx
+  800c40:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c43:	80 fb 09             	cmp    $0x9,%bl
+  800c46:	76 bd                	jbe    800c05 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c48:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c4b:	80 fb 19             	cmp    $0x19,%bl
+  800c4e:	77 08                	ja     800c58 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c50:	0f be c9             	movsbl %cl,%ecx
+  800c53:	83 e9 57             	sub    $0x57,%ecx
+  800c56:	eb b3                	jmp    800c0b <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c58:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c5b:	80 fb 19             	cmp    $0x19,%bl
+  800c5e:	77 08                	ja     800c68 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c60:	0f be c9             	movsbl %cl,%ecx
+  800c63:	83 e9 37             	sub    $0x37,%ecx
+  800c66:	eb a3                	jmp    800c0b <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c68:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c6b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c6e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c71:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c74:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c78:	74 05                	je     800c7f <strtol+0x112>
+		*endptr = (char *) s;
+  800c7a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c7d:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c7f:	85 c9                	test   %ecx,%ecx
+  800c81:	74 07                	je     800c8a <strtol+0x11d>
+  800c83:	f7 d8                	neg    %eax
+  800c85:	83 d2 00             	adc    $0x0,%edx
+  800c88:	f7 da                	neg    %edx
+}
+  800c8a:	83 c4 1c             	add    $0x1c,%esp
+  800c8d:	5b                   	pop    %ebx
+  800c8e:	5e                   	pop    %esi
+  800c8f:	5f                   	pop    %edi
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+
+00800c92 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	57                   	push   %edi
+  800c96:	56                   	push   %esi
+  800c97:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c98:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800c9f:	74 18                	je     800cb9 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cac:	89 c3                	mov    %eax,%ebx
+  800cae:	89 c7                	mov    %eax,%edi
+  800cb0:	89 c6                	mov    %eax,%esi
+  800cb2:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cb4:	5b                   	pop    %ebx
+  800cb5:	5e                   	pop    %esi
+  800cb6:	5f                   	pop    %edi
+  800cb7:	5d                   	pop    %ebp
+  800cb8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc4:	89 c3                	mov    %eax,%ebx
+  800cc6:	89 c7                	mov    %eax,%edi
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	8d 35 d3 0c 80 00    	lea    0x800cd3,%esi
+  800cd1:	0f 34                	sysenter
+  800cd3:	5d                   	pop    %ebp
+		goto out;
+  800cd4:	eb de                	jmp    800cb4 <sys_cputs+0x22>
+
+00800cd6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cd6:	55                   	push   %ebp
+  800cd7:	89 e5                	mov    %esp,%ebp
+  800cd9:	57                   	push   %edi
+  800cda:	56                   	push   %esi
+  800cdb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cdc:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800ce3:	74 19                	je     800cfe <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800ce5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cea:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cef:	89 d1                	mov    %edx,%ecx
+  800cf1:	89 d3                	mov    %edx,%ebx
+  800cf3:	89 d7                	mov    %edx,%edi
+  800cf5:	89 d6                	mov    %edx,%esi
+  800cf7:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cf9:	5b                   	pop    %ebx
+  800cfa:	5e                   	pop    %esi
+  800cfb:	5f                   	pop    %edi
+  800cfc:	5d                   	pop    %ebp
+  800cfd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d03:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d08:	89 d1                	mov    %edx,%ecx
+  800d0a:	89 d3                	mov    %edx,%ebx
+  800d0c:	89 d7                	mov    %edx,%edi
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	8d 35 19 0d 80 00    	lea    0x800d19,%esi
+  800d17:	0f 34                	sysenter
+  800d19:	5d                   	pop    %ebp
+		goto out;
+  800d1a:	eb dd                	jmp    800cf9 <sys_cgetc+0x23>
+
+00800d1c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d1c:	55                   	push   %ebp
+  800d1d:	89 e5                	mov    %esp,%ebp
+  800d1f:	57                   	push   %edi
+  800d20:	56                   	push   %esi
+  800d21:	53                   	push   %ebx
+  800d22:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d25:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800d2c:	74 21                	je     800d4f <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d33:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3b:	89 cb                	mov    %ecx,%ebx
+  800d3d:	89 cf                	mov    %ecx,%edi
+  800d3f:	89 ce                	mov    %ecx,%esi
+  800d41:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d43:	85 c0                	test   %eax,%eax
+  800d45:	7f 27                	jg     800d6e <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d57:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d5c:	89 cb                	mov    %ecx,%ebx
+  800d5e:	89 cf                	mov    %ecx,%edi
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	8d 35 6b 0d 80 00    	lea    0x800d6b,%esi
+  800d69:	0f 34                	sysenter
+  800d6b:	5d                   	pop    %ebp
+		goto out;
+  800d6c:	eb d5                	jmp    800d43 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+  800d71:	50                   	push   %eax
+  800d72:	6a 03                	push   $0x3
+  800d74:	68 ab 37 80 00       	push   $0x8037ab
+  800d79:	6a 3f                	push   $0x3f
+  800d7b:	68 c8 37 80 00       	push   $0x8037c8
+  800d80:	e8 71 f4 ff ff       	call   8001f6 <_panic>
+
+00800d85 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d85:	55                   	push   %ebp
+  800d86:	89 e5                	mov    %esp,%ebp
+  800d88:	57                   	push   %edi
+  800d89:	56                   	push   %esi
+  800d8a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d8b:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800d92:	74 19                	je     800dad <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d99:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d9e:	89 d1                	mov    %edx,%ecx
+  800da0:	89 d3                	mov    %edx,%ebx
+  800da2:	89 d7                	mov    %edx,%edi
+  800da4:	89 d6                	mov    %edx,%esi
+  800da6:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800da8:	5b                   	pop    %ebx
+  800da9:	5e                   	pop    %esi
+  800daa:	5f                   	pop    %edi
+  800dab:	5d                   	pop    %ebp
+  800dac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db7:	89 d1                	mov    %edx,%ecx
+  800db9:	89 d3                	mov    %edx,%ebx
+  800dbb:	89 d7                	mov    %edx,%edi
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	8d 35 c8 0d 80 00    	lea    0x800dc8,%esi
+  800dc6:	0f 34                	sysenter
+  800dc8:	5d                   	pop    %ebp
+		goto out;
+  800dc9:	eb dd                	jmp    800da8 <sys_getenvid+0x23>
+
+00800dcb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	57                   	push   %edi
+  800dcf:	56                   	push   %esi
+  800dd0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dd1:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800dd8:	74 19                	je     800df3 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800dda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800de4:	89 d1                	mov    %edx,%ecx
+  800de6:	89 d3                	mov    %edx,%ebx
+  800de8:	89 d7                	mov    %edx,%edi
+  800dea:	89 d6                	mov    %edx,%esi
+  800dec:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dee:	5b                   	pop    %ebx
+  800def:	5e                   	pop    %esi
+  800df0:	5f                   	pop    %edi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800df3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dfd:	89 d1                	mov    %edx,%ecx
+  800dff:	89 d3                	mov    %edx,%ebx
+  800e01:	89 d7                	mov    %edx,%edi
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	8d 35 0e 0e 80 00    	lea    0x800e0e,%esi
+  800e0c:	0f 34                	sysenter
+  800e0e:	5d                   	pop    %ebp
+		goto out;
+  800e0f:	eb dd                	jmp    800dee <sys_yield+0x23>
+
+00800e11 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	57                   	push   %edi
+  800e15:	56                   	push   %esi
+  800e16:	53                   	push   %ebx
+  800e17:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e1a:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e21:	74 23                	je     800e46 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e23:	be 00 00 00 00       	mov    $0x0,%esi
+  800e28:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e36:	89 f7                	mov    %esi,%edi
+  800e38:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e3a:	85 c0                	test   %eax,%eax
+  800e3c:	7f 29                	jg     800e67 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e51:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	8d 35 64 0e 80 00    	lea    0x800e64,%esi
+  800e62:	0f 34                	sysenter
+  800e64:	5d                   	pop    %ebp
+		goto out;
+  800e65:	eb d3                	jmp    800e3a <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e67:	83 ec 0c             	sub    $0xc,%esp
+  800e6a:	50                   	push   %eax
+  800e6b:	6a 04                	push   $0x4
+  800e6d:	68 ab 37 80 00       	push   $0x8037ab
+  800e72:	6a 3f                	push   $0x3f
+  800e74:	68 c8 37 80 00       	push   $0x8037c8
+  800e79:	e8 78 f3 ff ff       	call   8001f6 <_panic>
+
+00800e7e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e7e:	55                   	push   %ebp
+  800e7f:	89 e5                	mov    %esp,%ebp
+  800e81:	57                   	push   %edi
+  800e82:	56                   	push   %esi
+  800e83:	53                   	push   %ebx
+  800e84:	83 ec 0c             	sub    $0xc,%esp
+  800e87:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e8a:	85 f6                	test   %esi,%esi
+  800e8c:	75 09                	jne    800e97 <sys_page_map+0x19>
+  800e8e:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800e95:	74 1f                	je     800eb6 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e97:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eaa:	85 c0                	test   %eax,%eax
+  800eac:	7f 27                	jg     800ed5 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb1:	5b                   	pop    %ebx
+  800eb2:	5e                   	pop    %esi
+  800eb3:	5f                   	pop    %edi
+  800eb4:	5d                   	pop    %ebp
+  800eb5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebc:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ec1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec7:	55                   	push   %ebp
+  800ec8:	89 e5                	mov    %esp,%ebp
+  800eca:	8d 35 d2 0e 80 00    	lea    0x800ed2,%esi
+  800ed0:	0f 34                	sysenter
+  800ed2:	5d                   	pop    %ebp
+		goto out;
+  800ed3:	eb d5                	jmp    800eaa <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+  800ed8:	50                   	push   %eax
+  800ed9:	6a 05                	push   $0x5
+  800edb:	68 ab 37 80 00       	push   $0x8037ab
+  800ee0:	6a 3f                	push   $0x3f
+  800ee2:	68 c8 37 80 00       	push   $0x8037c8
+  800ee7:	e8 0a f3 ff ff       	call   8001f6 <_panic>
+
+00800eec <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	57                   	push   %edi
+  800ef0:	56                   	push   %esi
+  800ef1:	53                   	push   %ebx
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ef5:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800efc:	74 22                	je     800f20 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800efe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f03:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0e:	89 df                	mov    %ebx,%edi
+  800f10:	89 de                	mov    %ebx,%esi
+  800f12:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f14:	85 c0                	test   %eax,%eax
+  800f16:	7f 28                	jg     800f40 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1b:	5b                   	pop    %ebx
+  800f1c:	5e                   	pop    %esi
+  800f1d:	5f                   	pop    %edi
+  800f1e:	5d                   	pop    %ebp
+  800f1f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f30:	89 df                	mov    %ebx,%edi
+  800f32:	55                   	push   %ebp
+  800f33:	89 e5                	mov    %esp,%ebp
+  800f35:	8d 35 3d 0f 80 00    	lea    0x800f3d,%esi
+  800f3b:	0f 34                	sysenter
+  800f3d:	5d                   	pop    %ebp
+		goto out;
+  800f3e:	eb d4                	jmp    800f14 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f40:	83 ec 0c             	sub    $0xc,%esp
+  800f43:	50                   	push   %eax
+  800f44:	6a 06                	push   $0x6
+  800f46:	68 ab 37 80 00       	push   $0x8037ab
+  800f4b:	6a 3f                	push   $0x3f
+  800f4d:	68 c8 37 80 00       	push   $0x8037c8
+  800f52:	e8 9f f2 ff ff       	call   8001f6 <_panic>
+
+00800f57 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	57                   	push   %edi
+  800f5b:	56                   	push   %esi
+  800f5c:	53                   	push   %ebx
+  800f5d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f60:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800f67:	74 22                	je     800f8b <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f79:	89 df                	mov    %ebx,%edi
+  800f7b:	89 de                	mov    %ebx,%esi
+  800f7d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7f:	85 c0                	test   %eax,%eax
+  800f81:	7f 28                	jg     800fab <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f86:	5b                   	pop    %ebx
+  800f87:	5e                   	pop    %esi
+  800f88:	5f                   	pop    %edi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f96:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f9b:	89 df                	mov    %ebx,%edi
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	8d 35 a8 0f 80 00    	lea    0x800fa8,%esi
+  800fa6:	0f 34                	sysenter
+  800fa8:	5d                   	pop    %ebp
+		goto out;
+  800fa9:	eb d4                	jmp    800f7f <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fab:	83 ec 0c             	sub    $0xc,%esp
+  800fae:	50                   	push   %eax
+  800faf:	6a 08                	push   $0x8
+  800fb1:	68 ab 37 80 00       	push   $0x8037ab
+  800fb6:	6a 3f                	push   $0x3f
+  800fb8:	68 c8 37 80 00       	push   $0x8037c8
+  800fbd:	e8 34 f2 ff ff       	call   8001f6 <_panic>
+
+00800fc2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fc2:	55                   	push   %ebp
+  800fc3:	89 e5                	mov    %esp,%ebp
+  800fc5:	57                   	push   %edi
+  800fc6:	56                   	push   %esi
+  800fc7:	53                   	push   %ebx
+  800fc8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fcb:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  800fd2:	74 22                	je     800ff6 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe4:	89 df                	mov    %ebx,%edi
+  800fe6:	89 de                	mov    %ebx,%esi
+  800fe8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fea:	85 c0                	test   %eax,%eax
+  800fec:	7f 28                	jg     801016 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	b8 09 00 00 00       	mov    $0x9,%eax
+  801006:	89 df                	mov    %ebx,%edi
+  801008:	55                   	push   %ebp
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	8d 35 13 10 80 00    	lea    0x801013,%esi
+  801011:	0f 34                	sysenter
+  801013:	5d                   	pop    %ebp
+		goto out;
+  801014:	eb d4                	jmp    800fea <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801016:	83 ec 0c             	sub    $0xc,%esp
+  801019:	50                   	push   %eax
+  80101a:	6a 09                	push   $0x9
+  80101c:	68 ab 37 80 00       	push   $0x8037ab
+  801021:	6a 3f                	push   $0x3f
+  801023:	68 c8 37 80 00       	push   $0x8037c8
+  801028:	e8 c9 f1 ff ff       	call   8001f6 <_panic>
+
+0080102d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	57                   	push   %edi
+  801031:	56                   	push   %esi
+  801032:	53                   	push   %ebx
+  801033:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801036:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80103d:	74 22                	je     801061 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80103f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801044:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801049:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104f:	89 df                	mov    %ebx,%edi
+  801051:	89 de                	mov    %ebx,%esi
+  801053:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801055:	85 c0                	test   %eax,%eax
+  801057:	7f 28                	jg     801081 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801059:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105c:	5b                   	pop    %ebx
+  80105d:	5e                   	pop    %esi
+  80105e:	5f                   	pop    %edi
+  80105f:	5d                   	pop    %ebp
+  801060:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801061:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801071:	89 df                	mov    %ebx,%edi
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	8d 35 7e 10 80 00    	lea    0x80107e,%esi
+  80107c:	0f 34                	sysenter
+  80107e:	5d                   	pop    %ebp
+		goto out;
+  80107f:	eb d4                	jmp    801055 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801081:	83 ec 0c             	sub    $0xc,%esp
+  801084:	50                   	push   %eax
+  801085:	6a 0a                	push   $0xa
+  801087:	68 ab 37 80 00       	push   $0x8037ab
+  80108c:	6a 3f                	push   $0x3f
+  80108e:	68 c8 37 80 00       	push   $0x8037c8
+  801093:	e8 5e f1 ff ff       	call   8001f6 <_panic>
+
+00801098 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801098:	55                   	push   %ebp
+  801099:	89 e5                	mov    %esp,%ebp
+  80109b:	57                   	push   %edi
+  80109c:	56                   	push   %esi
+  80109d:	53                   	push   %ebx
+  80109e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010a1:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8010a8:	74 22                	je     8010cc <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8010aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010af:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ba:	89 df                	mov    %ebx,%edi
+  8010bc:	89 de                	mov    %ebx,%esi
+  8010be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 28                	jg     8010ec <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8010c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5f                   	pop    %edi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d7:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010dc:	89 df                	mov    %ebx,%edi
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	8d 35 e9 10 80 00    	lea    0x8010e9,%esi
+  8010e7:	0f 34                	sysenter
+  8010e9:	5d                   	pop    %ebp
+		goto out;
+  8010ea:	eb d4                	jmp    8010c0 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ec:	83 ec 0c             	sub    $0xc,%esp
+  8010ef:	50                   	push   %eax
+  8010f0:	6a 17                	push   $0x17
+  8010f2:	68 ab 37 80 00       	push   $0x8037ab
+  8010f7:	6a 3f                	push   $0x3f
+  8010f9:	68 c8 37 80 00       	push   $0x8037c8
+  8010fe:	e8 f3 f0 ff ff       	call   8001f6 <_panic>
+
+00801103 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	57                   	push   %edi
+  801107:	56                   	push   %esi
+  801108:	53                   	push   %ebx
+  801109:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80110c:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801113:	74 22                	je     801137 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801125:	89 df                	mov    %ebx,%edi
+  801127:	89 de                	mov    %ebx,%esi
+  801129:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80112b:	85 c0                	test   %eax,%eax
+  80112d:	7f 28                	jg     801157 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80112f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801132:	5b                   	pop    %ebx
+  801133:	5e                   	pop    %esi
+  801134:	5f                   	pop    %edi
+  801135:	5d                   	pop    %ebp
+  801136:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801137:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801142:	b8 18 00 00 00       	mov    $0x18,%eax
+  801147:	89 df                	mov    %ebx,%edi
+  801149:	55                   	push   %ebp
+  80114a:	89 e5                	mov    %esp,%ebp
+  80114c:	8d 35 54 11 80 00    	lea    0x801154,%esi
+  801152:	0f 34                	sysenter
+  801154:	5d                   	pop    %ebp
+		goto out;
+  801155:	eb d4                	jmp    80112b <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801157:	83 ec 0c             	sub    $0xc,%esp
+  80115a:	50                   	push   %eax
+  80115b:	6a 18                	push   $0x18
+  80115d:	68 ab 37 80 00       	push   $0x8037ab
+  801162:	6a 3f                	push   $0x3f
+  801164:	68 c8 37 80 00       	push   $0x8037c8
+  801169:	e8 88 f0 ff ff       	call   8001f6 <_panic>
+
+0080116e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80116e:	55                   	push   %ebp
+  80116f:	89 e5                	mov    %esp,%ebp
+  801171:	57                   	push   %edi
+  801172:	56                   	push   %esi
+  801173:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801174:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80117b:	74 1d                	je     80119a <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80117d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801182:	be 00 00 00 00       	mov    $0x0,%esi
+  801187:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801190:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801193:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80119a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ab:	55                   	push   %ebp
+  8011ac:	89 e5                	mov    %esp,%ebp
+  8011ae:	8d 35 b6 11 80 00    	lea    0x8011b6,%esi
+  8011b4:	0f 34                	sysenter
+  8011b6:	5d                   	pop    %ebp
+		goto out;
+  8011b7:	eb dc                	jmp    801195 <sys_ipc_try_send+0x27>
+
+008011b9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	53                   	push   %ebx
+  8011bf:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011c2:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8011c9:	74 21                	je     8011ec <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8011cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d8:	89 cb                	mov    %ecx,%ebx
+  8011da:	89 cf                	mov    %ecx,%edi
+  8011dc:	89 ce                	mov    %ecx,%esi
+  8011de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e0:	85 c0                	test   %eax,%eax
+  8011e2:	7f 27                	jg     80120b <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e7:	5b                   	pop    %ebx
+  8011e8:	5e                   	pop    %esi
+  8011e9:	5f                   	pop    %edi
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011f9:	89 cb                	mov    %ecx,%ebx
+  8011fb:	89 cf                	mov    %ecx,%edi
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	8d 35 08 12 80 00    	lea    0x801208,%esi
+  801206:	0f 34                	sysenter
+  801208:	5d                   	pop    %ebp
+		goto out;
+  801209:	eb d5                	jmp    8011e0 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80120b:	83 ec 0c             	sub    $0xc,%esp
+  80120e:	50                   	push   %eax
+  80120f:	6a 0d                	push   $0xd
+  801211:	68 ab 37 80 00       	push   $0x8037ab
+  801216:	6a 3f                	push   $0x3f
+  801218:	68 c8 37 80 00       	push   $0x8037c8
+  80121d:	e8 d4 ef ff ff       	call   8001f6 <_panic>
+
+00801222 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	57                   	push   %edi
+  801226:	56                   	push   %esi
+  801227:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801228:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80122f:	74 1b                	je     80124c <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801231:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801236:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80123b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801241:	89 df                	mov    %ebx,%edi
+  801243:	89 de                	mov    %ebx,%esi
+  801245:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5f                   	pop    %edi
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80124c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801251:	8b 55 08             	mov    0x8(%ebp),%edx
+  801254:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801257:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80125c:	89 df                	mov    %ebx,%edi
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	8d 35 69 12 80 00    	lea    0x801269,%esi
+  801267:	0f 34                	sysenter
+  801269:	5d                   	pop    %ebp
+		goto out;
+  80126a:	eb db                	jmp    801247 <sys_ipc_recv_until+0x25>
+
+0080126c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	57                   	push   %edi
+  801270:	56                   	push   %esi
+  801271:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801272:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801279:	74 19                	je     801294 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80127b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801280:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801285:	89 d1                	mov    %edx,%ecx
+  801287:	89 d3                	mov    %edx,%ebx
+  801289:	89 d7                	mov    %edx,%edi
+  80128b:	89 d6                	mov    %edx,%esi
+  80128d:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80128f:	5b                   	pop    %ebx
+  801290:	5e                   	pop    %esi
+  801291:	5f                   	pop    %edi
+  801292:	5d                   	pop    %ebp
+  801293:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801294:	ba 00 00 00 00       	mov    $0x0,%edx
+  801299:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80129e:	89 d1                	mov    %edx,%ecx
+  8012a0:	89 d3                	mov    %edx,%ebx
+  8012a2:	89 d7                	mov    %edx,%edi
+  8012a4:	55                   	push   %ebp
+  8012a5:	89 e5                	mov    %esp,%ebp
+  8012a7:	8d 35 af 12 80 00    	lea    0x8012af,%esi
+  8012ad:	0f 34                	sysenter
+  8012af:	5d                   	pop    %ebp
+		goto out;
+  8012b0:	eb dd                	jmp    80128f <sys_time_msec+0x23>
+
+008012b2 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	57                   	push   %edi
+  8012b6:	56                   	push   %esi
+  8012b7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012b8:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8012bf:	74 1a                	je     8012db <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8012c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012c6:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ce:	89 cb                	mov    %ecx,%ebx
+  8012d0:	89 cf                	mov    %ecx,%edi
+  8012d2:	89 ce                	mov    %ecx,%esi
+  8012d4:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012d6:	5b                   	pop    %ebx
+  8012d7:	5e                   	pop    %esi
+  8012d8:	5f                   	pop    %edi
+  8012d9:	5d                   	pop    %ebp
+  8012da:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012e8:	89 cb                	mov    %ecx,%ebx
+  8012ea:	89 cf                	mov    %ecx,%edi
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	8d 35 f7 12 80 00    	lea    0x8012f7,%esi
+  8012f5:	0f 34                	sysenter
+  8012f7:	5d                   	pop    %ebp
+		goto out;
+  8012f8:	eb dc                	jmp    8012d6 <sys_sleep_until+0x24>
+
+008012fa <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012fa:	55                   	push   %ebp
+  8012fb:	89 e5                	mov    %esp,%ebp
+  8012fd:	57                   	push   %edi
+  8012fe:	56                   	push   %esi
+  8012ff:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801300:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801307:	74 1a                	je     801323 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801309:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801313:	8b 55 08             	mov    0x8(%ebp),%edx
+  801316:	89 cb                	mov    %ecx,%ebx
+  801318:	89 cf                	mov    %ecx,%edi
+  80131a:	89 ce                	mov    %ecx,%esi
+  80131c:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80131e:	5b                   	pop    %ebx
+  80131f:	5e                   	pop    %esi
+  801320:	5f                   	pop    %edi
+  801321:	5d                   	pop    %ebp
+  801322:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801323:	8b 55 08             	mov    0x8(%ebp),%edx
+  801326:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80132b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801330:	89 cb                	mov    %ecx,%ebx
+  801332:	89 cf                	mov    %ecx,%edi
+  801334:	55                   	push   %ebp
+  801335:	89 e5                	mov    %esp,%ebp
+  801337:	8d 35 3f 13 80 00    	lea    0x80133f,%esi
+  80133d:	0f 34                	sysenter
+  80133f:	5d                   	pop    %ebp
+		goto out;
+  801340:	eb dc                	jmp    80131e <sys_env_print_stats+0x24>
+
+00801342 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	57                   	push   %edi
+  801346:	56                   	push   %esi
+  801347:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801348:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80134f:	74 1b                	je     80136c <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801351:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801356:	b8 19 00 00 00       	mov    $0x19,%eax
+  80135b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801361:	89 df                	mov    %ebx,%edi
+  801363:	89 de                	mov    %ebx,%esi
+  801365:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801367:	5b                   	pop    %ebx
+  801368:	5e                   	pop    %esi
+  801369:	5f                   	pop    %edi
+  80136a:	5d                   	pop    %ebp
+  80136b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80136c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801371:	8b 55 08             	mov    0x8(%ebp),%edx
+  801374:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801377:	b8 19 00 00 00       	mov    $0x19,%eax
+  80137c:	89 df                	mov    %ebx,%edi
+  80137e:	55                   	push   %ebp
+  80137f:	89 e5                	mov    %esp,%ebp
+  801381:	8d 35 89 13 80 00    	lea    0x801389,%esi
+  801387:	0f 34                	sysenter
+  801389:	5d                   	pop    %ebp
+		goto out;
+  80138a:	eb db                	jmp    801367 <sys_perf+0x25>
+
+0080138c <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	57                   	push   %edi
+  801390:	56                   	push   %esi
+  801391:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801392:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801399:	74 19                	je     8013b4 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80139b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013a5:	89 d1                	mov    %edx,%ecx
+  8013a7:	89 d3                	mov    %edx,%ebx
+  8013a9:	89 d7                	mov    %edx,%edi
+  8013ab:	89 d6                	mov    %edx,%esi
+  8013ad:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013be:	89 d1                	mov    %edx,%ecx
+  8013c0:	89 d3                	mov    %edx,%ebx
+  8013c2:	89 d7                	mov    %edx,%edi
+  8013c4:	55                   	push   %ebp
+  8013c5:	89 e5                	mov    %esp,%ebp
+  8013c7:	8d 35 cf 13 80 00    	lea    0x8013cf,%esi
+  8013cd:	0f 34                	sysenter
+  8013cf:	5d                   	pop    %ebp
+		goto out;
+  8013d0:	eb dd                	jmp    8013af <sys_fork+0x23>
+
+008013d2 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+  8013d5:	57                   	push   %edi
+  8013d6:	56                   	push   %esi
+  8013d7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013d8:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8013df:	74 1c                	je     8013fd <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f4:	89 f7                	mov    %esi,%edi
+  8013f6:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013f8:	5b                   	pop    %ebx
+  8013f9:	5e                   	pop    %esi
+  8013fa:	5f                   	pop    %edi
+  8013fb:	5d                   	pop    %ebp
+  8013fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801403:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801408:	bf 00 00 00 00       	mov    $0x0,%edi
+  80140d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801410:	55                   	push   %ebp
+  801411:	89 e5                	mov    %esp,%ebp
+  801413:	8d 35 1b 14 80 00    	lea    0x80141b,%esi
+  801419:	0f 34                	sysenter
+  80141b:	5d                   	pop    %ebp
+		goto out;
+  80141c:	eb da                	jmp    8013f8 <sys_thread_create+0x26>
+
+0080141e <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	57                   	push   %edi
+  801422:	56                   	push   %esi
+  801423:	53                   	push   %ebx
+  801424:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801427:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80142e:	74 24                	je     801454 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801430:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801435:	be 00 00 00 00       	mov    $0x0,%esi
+  80143a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801440:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801443:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801446:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801448:	85 c0                	test   %eax,%eax
+  80144a:	7f 27                	jg     801473 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80144c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144f:	5b                   	pop    %ebx
+  801450:	5e                   	pop    %esi
+  801451:	5f                   	pop    %edi
+  801452:	5d                   	pop    %ebp
+  801453:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801454:	8b 55 08             	mov    0x8(%ebp),%edx
+  801457:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80145f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801462:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	8d 35 70 14 80 00    	lea    0x801470,%esi
+  80146e:	0f 34                	sysenter
+  801470:	5d                   	pop    %ebp
+		goto out;
+  801471:	eb d5                	jmp    801448 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801473:	83 ec 0c             	sub    $0xc,%esp
+  801476:	50                   	push   %eax
+  801477:	6a 1f                	push   $0x1f
+  801479:	68 ab 37 80 00       	push   $0x8037ab
+  80147e:	6a 3f                	push   $0x3f
+  801480:	68 c8 37 80 00       	push   $0x8037c8
+  801485:	e8 6c ed ff ff       	call   8001f6 <_panic>
+
+0080148a <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	57                   	push   %edi
+  80148e:	56                   	push   %esi
+  80148f:	53                   	push   %ebx
+  801490:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801493:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80149a:	74 23                	je     8014bf <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80149c:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a1:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014af:	89 f7                	mov    %esi,%edi
+  8014b1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014b3:	85 c0                	test   %eax,%eax
+  8014b5:	7f 29                	jg     8014e0 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8014b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ba:	5b                   	pop    %ebx
+  8014bb:	5e                   	pop    %esi
+  8014bc:	5f                   	pop    %edi
+  8014bd:	5d                   	pop    %ebp
+  8014be:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c5:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d2:	55                   	push   %ebp
+  8014d3:	89 e5                	mov    %esp,%ebp
+  8014d5:	8d 35 dd 14 80 00    	lea    0x8014dd,%esi
+  8014db:	0f 34                	sysenter
+  8014dd:	5d                   	pop    %ebp
+		goto out;
+  8014de:	eb d3                	jmp    8014b3 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e0:	83 ec 0c             	sub    $0xc,%esp
+  8014e3:	50                   	push   %eax
+  8014e4:	6a 20                	push   $0x20
+  8014e6:	68 ab 37 80 00       	push   $0x8037ab
+  8014eb:	6a 3f                	push   $0x3f
+  8014ed:	68 c8 37 80 00       	push   $0x8037c8
+  8014f2:	e8 ff ec ff ff       	call   8001f6 <_panic>
+
+008014f7 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	57                   	push   %edi
+  8014fb:	56                   	push   %esi
+  8014fc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014fd:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801504:	74 1b                	je     801521 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801506:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801510:	8b 55 08             	mov    0x8(%ebp),%edx
+  801513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801516:	89 df                	mov    %ebx,%edi
+  801518:	89 de                	mov    %ebx,%esi
+  80151a:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80151c:	5b                   	pop    %ebx
+  80151d:	5e                   	pop    %esi
+  80151e:	5f                   	pop    %edi
+  80151f:	5d                   	pop    %ebp
+  801520:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801526:	8b 55 08             	mov    0x8(%ebp),%edx
+  801529:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801531:	89 df                	mov    %ebx,%edi
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	8d 35 3e 15 80 00    	lea    0x80153e,%esi
+  80153c:	0f 34                	sysenter
+  80153e:	5d                   	pop    %ebp
+		goto out;
+  80153f:	eb db                	jmp    80151c <sys_batch+0x25>
+
+00801541 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	57                   	push   %edi
+  801545:	56                   	push   %esi
+  801546:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801547:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80154e:	74 1a                	je     80156a <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801555:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80155a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155d:	89 cb                	mov    %ecx,%ebx
+  80155f:	89 cf                	mov    %ecx,%edi
+  801561:	89 ce                	mov    %ecx,%esi
+  801563:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801565:	5b                   	pop    %ebx
+  801566:	5e                   	pop    %esi
+  801567:	5f                   	pop    %edi
+  801568:	5d                   	pop    %ebp
+  801569:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80156a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801572:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801577:	89 cb                	mov    %ecx,%ebx
+  801579:	89 cf                	mov    %ecx,%edi
+  80157b:	55                   	push   %ebp
+  80157c:	89 e5                	mov    %esp,%ebp
+  80157e:	8d 35 86 15 80 00    	lea    0x801586,%esi
+  801584:	0f 34                	sysenter
+  801586:	5d                   	pop    %ebp
+		goto out;
+  801587:	eb dc                	jmp    801565 <sys_trace_ctl+0x24>
+
+00801589 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801589:	55                   	push   %ebp
+  80158a:	89 e5                	mov    %esp,%ebp
+  80158c:	57                   	push   %edi
+  80158d:	56                   	push   %esi
+  80158e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80158f:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801596:	74 1c                	je     8015b4 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801598:	be 00 00 00 00       	mov    $0x0,%esi
+  80159d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ab:	89 f7                	mov    %esi,%edi
+  8015ad:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8015af:	5b                   	pop    %ebx
+  8015b0:	5e                   	pop    %esi
+  8015b1:	5f                   	pop    %edi
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	8d 35 d2 15 80 00    	lea    0x8015d2,%esi
+  8015d0:	0f 34                	sysenter
+  8015d2:	5d                   	pop    %ebp
+		goto out;
+  8015d3:	eb da                	jmp    8015af <sys_trace_read+0x26>
+
+008015d5 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+  8015d8:	57                   	push   %edi
+  8015d9:	56                   	push   %esi
+  8015da:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015db:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8015e2:	74 1c                	je     801600 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8015e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e9:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f7:	89 f7                	mov    %esi,%edi
+  8015f9:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015fb:	5b                   	pop    %ebx
+  8015fc:	5e                   	pop    %esi
+  8015fd:	5f                   	pop    %edi
+  8015fe:	5d                   	pop    %ebp
+  8015ff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801600:	8b 55 08             	mov    0x8(%ebp),%edx
+  801603:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801606:	b8 21 00 00 00       	mov    $0x21,%eax
+  80160b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801610:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801613:	55                   	push   %ebp
+  801614:	89 e5                	mov    %esp,%ebp
+  801616:	8d 35 1e 16 80 00    	lea    0x80161e,%esi
+  80161c:	0f 34                	sysenter
+  80161e:	5d                   	pop    %ebp
+		goto out;
+  80161f:	eb da                	jmp    8015fb <sys_meminfo+0x26>
+
+00801621 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	57                   	push   %edi
+  801625:	56                   	push   %esi
+  801626:	53                   	push   %ebx
+  801627:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80162a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80162e:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801635:	74 1f                	je     801656 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801637:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80163c:	b8 22 00 00 00       	mov    $0x22,%eax
+  801641:	8b 55 08             	mov    0x8(%ebp),%edx
+  801644:	89 df                	mov    %ebx,%edi
+  801646:	89 de                	mov    %ebx,%esi
+  801648:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80164a:	85 c0                	test   %eax,%eax
+  80164c:	7f 25                	jg     801673 <sys_env_set_ksm+0x52>
+}
+  80164e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801651:	5b                   	pop    %ebx
+  801652:	5e                   	pop    %esi
+  801653:	5f                   	pop    %edi
+  801654:	5d                   	pop    %ebp
+  801655:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801656:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801663:	89 df                	mov    %ebx,%edi
+  801665:	55                   	push   %ebp
+  801666:	89 e5                	mov    %esp,%ebp
+  801668:	8d 35 70 16 80 00    	lea    0x801670,%esi
+  80166e:	0f 34                	sysenter
+  801670:	5d                   	pop    %ebp
+		goto out;
+  801671:	eb d7                	jmp    80164a <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801673:	83 ec 0c             	sub    $0xc,%esp
+  801676:	50                   	push   %eax
+  801677:	6a 22                	push   $0x22
+  801679:	68 ab 37 80 00       	push   $0x8037ab
+  80167e:	6a 3f                	push   $0x3f
+  801680:	68 c8 37 80 00       	push   $0x8037c8
+  801685:	e8 6c eb ff ff       	call   8001f6 <_panic>
+
+0080168a <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80168a:	55                   	push   %ebp
+  80168b:	89 e5                	mov    %esp,%ebp
+  80168d:	57                   	push   %edi
+  80168e:	56                   	push   %esi
+  80168f:	53                   	push   %ebx
+  801690:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801693:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801696:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80169d:	74 24                	je     8016c3 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80169f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016a9:	89 cb                	mov    %ecx,%ebx
+  8016ab:	89 cf                	mov    %ecx,%edi
+  8016ad:	89 ce                	mov    %ecx,%esi
+  8016af:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	7f 2a                	jg     8016df <sys_time_nsec+0x55>
+	return ns;
+}
+  8016b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016be:	5b                   	pop    %ebx
+  8016bf:	5e                   	pop    %esi
+  8016c0:	5f                   	pop    %edi
+  8016c1:	5d                   	pop    %ebp
+  8016c2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016cd:	89 cb                	mov    %ecx,%ebx
+  8016cf:	89 cf                	mov    %ecx,%edi
+  8016d1:	55                   	push   %ebp
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	8d 35 dc 16 80 00    	lea    0x8016dc,%esi
+  8016da:	0f 34                	sysenter
+  8016dc:	5d                   	pop    %ebp
+		goto out;
+  8016dd:	eb d2                	jmp    8016b1 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016df:	83 ec 0c             	sub    $0xc,%esp
+  8016e2:	50                   	push   %eax
+  8016e3:	6a 0f                	push   $0xf
+  8016e5:	68 ab 37 80 00       	push   $0x8037ab
+  8016ea:	6a 3f                	push   $0x3f
+  8016ec:	68 c8 37 80 00       	push   $0x8037c8
+  8016f1:	e8 00 eb ff ff       	call   8001f6 <_panic>
+
+008016f6 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	57                   	push   %edi
+  8016fa:	56                   	push   %esi
+  8016fb:	53                   	push   %ebx
+  8016fc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016ff:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801706:	74 22                	je     80172a <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801708:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801712:	8b 55 08             	mov    0x8(%ebp),%edx
+  801715:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801718:	89 df                	mov    %ebx,%edi
+  80171a:	89 de                	mov    %ebx,%esi
+  80171c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80171e:	85 c0                	test   %eax,%eax
+  801720:	7f 28                	jg     80174a <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801722:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801725:	5b                   	pop    %ebx
+  801726:	5e                   	pop    %esi
+  801727:	5f                   	pop    %edi
+  801728:	5d                   	pop    %ebp
+  801729:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80172a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801732:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801735:	b8 12 00 00 00       	mov    $0x12,%eax
+  80173a:	89 df                	mov    %ebx,%edi
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	8d 35 47 17 80 00    	lea    0x801747,%esi
+  801745:	0f 34                	sysenter
+  801747:	5d                   	pop    %ebp
+		goto out;
+  801748:	eb d4                	jmp    80171e <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80174a:	83 ec 0c             	sub    $0xc,%esp
+  80174d:	50                   	push   %eax
+  80174e:	6a 12                	push   $0x12
+  801750:	68 ab 37 80 00       	push   $0x8037ab
+  801755:	6a 3f                	push   $0x3f
+  801757:	68 c8 37 80 00       	push   $0x8037c8
+  80175c:	e8 95 ea ff ff       	call   8001f6 <_panic>
+
+00801761 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	57                   	push   %edi
+  801765:	56                   	push   %esi
+  801766:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801767:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80176e:	74 1b                	je     80178b <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801770:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801775:	b8 13 00 00 00       	mov    $0x13,%eax
+  80177a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801780:	89 df                	mov    %ebx,%edi
+  801782:	89 de                	mov    %ebx,%esi
+  801784:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801786:	5b                   	pop    %ebx
+  801787:	5e                   	pop    %esi
+  801788:	5f                   	pop    %edi
+  801789:	5d                   	pop    %ebp
+  80178a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80178b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801790:	8b 55 08             	mov    0x8(%ebp),%edx
+  801793:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801796:	b8 13 00 00 00       	mov    $0x13,%eax
+  80179b:	89 df                	mov    %ebx,%edi
+  80179d:	55                   	push   %ebp
+  80179e:	89 e5                	mov    %esp,%ebp
+  8017a0:	8d 35 a8 17 80 00    	lea    0x8017a8,%esi
+  8017a6:	0f 34                	sysenter
+  8017a8:	5d                   	pop    %ebp
+		goto out;
+  8017a9:	eb db                	jmp    801786 <sys_e1000_receive+0x25>
+
+008017ab <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	57                   	push   %edi
+  8017af:	56                   	push   %esi
+  8017b0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017b1:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  8017b8:	74 1b                	je     8017d5 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8017ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bf:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ca:	89 df                	mov    %ebx,%edi
+  8017cc:	89 de                	mov    %ebx,%esi
+  8017ce:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017d0:	5b                   	pop    %ebx
+  8017d1:	5e                   	pop    %esi
+  8017d2:	5f                   	pop    %edi
+  8017d3:	5d                   	pop    %ebp
+  8017d4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e0:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017e5:	89 df                	mov    %ebx,%edi
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	8d 35 f2 17 80 00    	lea    0x8017f2,%esi
+  8017f0:	0f 34                	sysenter
+  8017f2:	5d                   	pop    %ebp
+		goto out;
+  8017f3:	eb db                	jmp    8017d0 <sys_e1000_read_hwaddr+0x25>
+
+008017f5 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017f5:	55                   	push   %ebp
+  8017f6:	89 e5                	mov    %esp,%ebp
+  8017f8:	57                   	push   %edi
+  8017f9:	56                   	push   %esi
+  8017fa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017fb:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  801802:	74 1a                	je     80181e <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801804:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801809:	b8 15 00 00 00       	mov    $0x15,%eax
+  80180e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801811:	89 cb                	mov    %ecx,%ebx
+  801813:	89 cf                	mov    %ecx,%edi
+  801815:	89 ce                	mov    %ecx,%esi
+  801817:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801819:	5b                   	pop    %ebx
+  80181a:	5e                   	pop    %esi
+  80181b:	5f                   	pop    %edi
+  80181c:	5d                   	pop    %ebp
+  80181d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80181e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801821:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801826:	b8 15 00 00 00       	mov    $0x15,%eax
+  80182b:	89 cb                	mov    %ecx,%ebx
+  80182d:	89 cf                	mov    %ecx,%edi
+  80182f:	55                   	push   %ebp
+  801830:	89 e5                	mov    %esp,%ebp
+  801832:	8d 35 3a 18 80 00    	lea    0x80183a,%esi
+  801838:	0f 34                	sysenter
+  80183a:	5d                   	pop    %ebp
+		goto out;
+  80183b:	eb dc                	jmp    801819 <sys_sb16_read_version+0x24>
+
+0080183d <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80183d:	55                   	push   %ebp
+  80183e:	89 e5                	mov    %esp,%ebp
+  801840:	57                   	push   %edi
+  801841:	56                   	push   %esi
+  801842:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801843:	80 3d 10 50 80 00 00 	cmpb   $0x0,0x805010
+  80184a:	74 1b                	je     801867 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80184c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801851:	b8 16 00 00 00       	mov    $0x16,%eax
+  801856:	8b 55 08             	mov    0x8(%ebp),%edx
+  801859:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185c:	89 df                	mov    %ebx,%edi
+  80185e:	89 de                	mov    %ebx,%esi
+  801860:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801862:	5b                   	pop    %ebx
+  801863:	5e                   	pop    %esi
+  801864:	5f                   	pop    %edi
+  801865:	5d                   	pop    %ebp
+  801866:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801867:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801872:	b8 16 00 00 00       	mov    $0x16,%eax
+  801877:	89 df                	mov    %ebx,%edi
+  801879:	55                   	push   %ebp
+  80187a:	89 e5                	mov    %esp,%ebp
+  80187c:	8d 35 84 18 80 00    	lea    0x801884,%esi
+  801882:	0f 34                	sysenter
+  801884:	5d                   	pop    %ebp
+		goto out;
+  801885:	eb db                	jmp    801862 <sys_sb16_play+0x25>
+
+00801887 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	53                   	push   %ebx
+  80188b:	83 ec 04             	sub    $0x4,%esp
+  80188e:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801890:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801897:	f6 c4 04             	test   $0x4,%ah
+  80189a:	74 0c                	je     8018a8 <dupperm+0x21>
+  80189c:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8018a3:	f6 c4 08             	test   $0x8,%ah
+  8018a6:	75 62                	jne    80190a <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  8018a8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  8018af:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  8018b4:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  8018ba:	74 19                	je     8018d5 <dupperm+0x4e>
+  8018bc:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8018c3:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  8018c8:	83 f8 01             	cmp    $0x1,%eax
+  8018cb:	19 c0                	sbb    %eax,%eax
+  8018cd:	25 00 08 00 00       	and    $0x800,%eax
+  8018d2:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  8018d5:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  8018dc:	89 c1                	mov    %eax,%ecx
+  8018de:	80 cd 04             	or     $0x4,%ch
+  8018e1:	f6 c7 04             	test   $0x4,%bh
+  8018e4:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  8018e7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018ee:	f6 c1 02             	test   $0x2,%cl
+  8018f1:	74 12                	je     801905 <dupperm+0x7e>
+  8018f3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  8018fa:	89 c2                	mov    %eax,%edx
+  8018fc:	83 ca 02             	or     $0x2,%edx
+  8018ff:	f6 c5 04             	test   $0x4,%ch
+  801902:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801905:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801908:	c9                   	leave
+  801909:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  80190a:	68 d8 37 80 00       	push   $0x8037d8
+  80190f:	68 70 38 80 00       	push   $0x803870
+  801914:	6a 39                	push   $0x39
+  801916:	68 85 38 80 00       	push   $0x803885
+  80191b:	e8 d6 e8 ff ff       	call   8001f6 <_panic>
+
+00801920 <pgfault>:
+{
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	53                   	push   %ebx
+  801924:	83 ec 04             	sub    $0x4,%esp
+  801927:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80192a:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80192c:	89 c3                	mov    %eax,%ebx
+  80192e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801934:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801938:	74 6d                	je     8019a7 <pgfault+0x87>
+  80193a:	89 da                	mov    %ebx,%edx
+  80193c:	c1 ea 16             	shr    $0x16,%edx
+  80193f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801946:	f6 c2 80             	test   $0x80,%dl
+  801949:	75 5c                	jne    8019a7 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  80194b:	c1 e8 0c             	shr    $0xc,%eax
+  80194e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801955:	f6 c4 08             	test   $0x8,%ah
+  801958:	74 4d                	je     8019a7 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  80195a:	83 ec 04             	sub    $0x4,%esp
+  80195d:	6a 07                	push   $0x7
+  80195f:	68 00 f0 7f 00       	push   $0x7ff000
+  801964:	6a 00                	push   $0x0
+  801966:	e8 a6 f4 ff ff       	call   800e11 <sys_page_alloc>
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	78 49                	js     8019bb <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801972:	83 ec 04             	sub    $0x4,%esp
+  801975:	68 00 10 00 00       	push   $0x1000
+  80197a:	53                   	push   %ebx
+  80197b:	68 00 f0 7f 00       	push   $0x7ff000
+  801980:	e8 1a f1 ff ff       	call   800a9f <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801985:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80198c:	53                   	push   %ebx
+  80198d:	6a 00                	push   $0x0
+  80198f:	68 00 f0 7f 00       	push   $0x7ff000
+  801994:	6a 00                	push   $0x0
+  801996:	e8 e3 f4 ff ff       	call   800e7e <sys_page_map>
+  80199b:	83 c4 20             	add    $0x20,%esp
+  80199e:	85 c0                	test   %eax,%eax
+  8019a0:	78 2d                	js     8019cf <pgfault+0xaf>
+}
+  8019a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a5:	c9                   	leave
+  8019a6:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  8019a7:	83 ec 04             	sub    $0x4,%esp
+  8019aa:	68 90 38 80 00       	push   $0x803890
+  8019af:	6a 1e                	push   $0x1e
+  8019b1:	68 85 38 80 00       	push   $0x803885
+  8019b6:	e8 3b e8 ff ff       	call   8001f6 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  8019bb:	83 ec 04             	sub    $0x4,%esp
+  8019be:	68 0c 38 80 00       	push   $0x80380c
+  8019c3:	6a 29                	push   $0x29
+  8019c5:	68 85 38 80 00       	push   $0x803885
+  8019ca:	e8 27 e8 ff ff       	call   8001f6 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  8019cf:	50                   	push   %eax
+  8019d0:	68 40 38 80 00       	push   $0x803840
+  8019d5:	6a 2e                	push   $0x2e
+  8019d7:	68 85 38 80 00       	push   $0x803885
+  8019dc:	e8 15 e8 ff ff       	call   8001f6 <_panic>
+
+008019e1 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  8019e1:	55                   	push   %ebp
+  8019e2:	89 e5                	mov    %esp,%ebp
+  8019e4:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  8019e7:	ff 75 0c             	push   0xc(%ebp)
+  8019ea:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8019ed:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8019f4:	e8 23 f3 ff ff       	call   800d1c <sys_env_destroy>
+}
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	c9                   	leave
+  8019fd:	c3                   	ret
+
+008019fe <ufork>:
+{
+  8019fe:	55                   	push   %ebp
+  8019ff:	89 e5                	mov    %esp,%ebp
+  801a01:	57                   	push   %edi
+  801a02:	56                   	push   %esi
+  801a03:	53                   	push   %ebx
+  801a04:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801a0a:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a0f:	cd 30                	int    $0x30
+  801a11:	89 c6                	mov    %eax,%esi
+  801a13:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	78 56                	js     801a73 <ufork+0x75>
+	if (pid > 0) {
+  801a1d:	0f 8e b3 02 00 00    	jle    801cd6 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801a23:	83 ec 0c             	sub    $0xc,%esp
+  801a26:	68 20 19 80 00       	push   $0x801920
+  801a2b:	e8 58 17 00 00       	call   803188 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801a30:	83 c4 08             	add    $0x8,%esp
+  801a33:	68 ef 31 80 00       	push   $0x8031ef
+  801a38:	56                   	push   %esi
+  801a39:	e8 ef f5 ff ff       	call   80102d <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801a3e:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801a44:	89 1c 24             	mov    %ebx,(%esp)
+  801a47:	e8 21 03 00 00       	call   801d6d <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801a4c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801a53:	6a 07                	push   $0x7
+  801a55:	68 00 f0 bf ee       	push   $0xeebff000
+  801a5a:	56                   	push   %esi
+  801a5b:	53                   	push   %ebx
+  801a5c:	e8 8d 04 00 00       	call   801eee <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a61:	83 c4 20             	add    $0x20,%esp
+  801a64:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a69:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801a6f:	89 fe                	mov    %edi,%esi
+  801a71:	eb 22                	jmp    801a95 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801a73:	50                   	push   %eax
+  801a74:	68 a9 38 80 00       	push   $0x8038a9
+  801a79:	68 a9 00 00 00       	push   $0xa9
+  801a7e:	68 85 38 80 00       	push   $0x803885
+  801a83:	e8 6e e7 ff ff       	call   8001f6 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801a88:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801a8e:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801a93:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801a95:	89 f7                	mov    %esi,%edi
+  801a97:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801a9d:	0f 87 e9 01 00 00    	ja     801c8c <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801aa3:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801aa9:	85 f6                	test   %esi,%esi
+  801aab:	0f 49 d6             	cmovns %esi,%edx
+  801aae:	c1 fa 0a             	sar    $0xa,%edx
+  801ab1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801ab8:	f6 c1 01             	test   $0x1,%cl
+  801abb:	74 cb                	je     801a88 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801abd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ac4:	f6 c2 80             	test   $0x80,%dl
+  801ac7:	75 17                	jne    801ae0 <ufork+0xe2>
+			j = i + 1;
+  801ac9:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801acc:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801ad3:	f6 c2 01             	test   $0x1,%dl
+  801ad6:	0f 85 f3 00 00 00    	jne    801bcf <ufork+0x1d1>
+			j = i + 1;
+  801adc:	89 de                	mov    %ebx,%esi
+  801ade:	eb b5                	jmp    801a95 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801ae0:	89 fb                	mov    %edi,%ebx
+  801ae2:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801ae5:	89 d8                	mov    %ebx,%eax
+  801ae7:	c1 e8 16             	shr    $0x16,%eax
+  801aea:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801af1:	89 c2                	mov    %eax,%edx
+  801af3:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801af9:	25 02 04 00 00       	and    $0x402,%eax
+  801afe:	83 f8 02             	cmp    $0x2,%eax
+  801b01:	74 31                	je     801b34 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801b03:	83 ec 04             	sub    $0x4,%esp
+  801b06:	6a 01                	push   $0x1
+  801b08:	52                   	push   %edx
+  801b09:	53                   	push   %ebx
+  801b0a:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b10:	53                   	push   %ebx
+  801b11:	6a 00                	push   $0x0
+  801b13:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801b19:	50                   	push   %eax
+  801b1a:	e8 fa 03 00 00       	call   801f19 <batch_map>
+		return;
+  801b1f:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b22:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b28:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b2d:	89 c6                	mov    %eax,%esi
+				continue;
+  801b2f:	e9 61 ff ff ff       	jmp    801a95 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801b34:	83 ec 04             	sub    $0x4,%esp
+  801b37:	80 ca 80             	or     $0x80,%dl
+  801b3a:	52                   	push   %edx
+  801b3b:	53                   	push   %ebx
+  801b3c:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b42:	e8 ca f2 ff ff       	call   800e11 <sys_page_alloc>
+  801b47:	83 c4 10             	add    $0x10,%esp
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 5d                	js     801bab <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801b4e:	83 ec 0c             	sub    $0xc,%esp
+  801b51:	6a 07                	push   $0x7
+  801b53:	68 00 00 40 00       	push   $0x400000
+  801b58:	6a 00                	push   $0x0
+  801b5a:	53                   	push   %ebx
+  801b5b:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b61:	e8 18 f3 ff ff       	call   800e7e <sys_page_map>
+  801b66:	83 c4 20             	add    $0x20,%esp
+  801b69:	85 c0                	test   %eax,%eax
+  801b6b:	78 50                	js     801bbd <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801b6d:	83 ec 04             	sub    $0x4,%esp
+  801b70:	68 00 00 40 00       	push   $0x400000
+  801b75:	53                   	push   %ebx
+  801b76:	68 00 00 40 00       	push   $0x400000
+  801b7b:	e8 1f ef ff ff       	call   800a9f <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801b80:	83 c4 08             	add    $0x8,%esp
+  801b83:	68 00 00 40 00       	push   $0x400000
+  801b88:	6a 00                	push   $0x0
+  801b8a:	e8 5d f3 ff ff       	call   800eec <sys_page_unmap>
+  801b8f:	83 c4 10             	add    $0x10,%esp
+  801b92:	85 c0                	test   %eax,%eax
+  801b94:	79 8c                	jns    801b22 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801b96:	50                   	push   %eax
+  801b97:	68 dd 38 80 00       	push   $0x8038dd
+  801b9c:	68 81 00 00 00       	push   $0x81
+  801ba1:	68 85 38 80 00       	push   $0x803885
+  801ba6:	e8 4b e6 ff ff       	call   8001f6 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801bab:	50                   	push   %eax
+  801bac:	68 b9 38 80 00       	push   $0x8038b9
+  801bb1:	6a 7c                	push   $0x7c
+  801bb3:	68 85 38 80 00       	push   $0x803885
+  801bb8:	e8 39 e6 ff ff       	call   8001f6 <_panic>
+		panic("sys_page_map: %e", r);
+  801bbd:	50                   	push   %eax
+  801bbe:	68 cc 38 80 00       	push   $0x8038cc
+  801bc3:	6a 7e                	push   $0x7e
+  801bc5:	68 85 38 80 00       	push   $0x803885
+  801bca:	e8 27 e6 ff ff       	call   8001f6 <_panic>
+  801bcf:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801bd5:	eb 22                	jmp    801bf9 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801bd7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801bde:	a8 01                	test   $0x1,%al
+  801be0:	74 35                	je     801c17 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801be2:	89 d8                	mov    %ebx,%eax
+  801be4:	e8 9e fc ff ff       	call   801887 <dupperm>
+  801be9:	89 c6                	mov    %eax,%esi
+  801beb:	89 f8                	mov    %edi,%eax
+  801bed:	e8 95 fc ff ff       	call   801887 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801bf2:	39 c6                	cmp    %eax,%esi
+  801bf4:	75 21                	jne    801c17 <ufork+0x219>
+				j++;
+  801bf6:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801bf9:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801bff:	74 16                	je     801c17 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801c01:	89 d8                	mov    %ebx,%eax
+  801c03:	c1 e8 0a             	shr    $0xa,%eax
+  801c06:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c0d:	25 81 00 00 00       	and    $0x81,%eax
+  801c12:	83 f8 01             	cmp    $0x1,%eax
+  801c15:	74 c0                	je     801bd7 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801c17:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801c1d:	89 d8                	mov    %ebx,%eax
+  801c1f:	29 f0                	sub    %esi,%eax
+  801c21:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801c27:	89 fe                	mov    %edi,%esi
+  801c29:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801c2c:	89 f8                	mov    %edi,%eax
+  801c2e:	e8 54 fc ff ff       	call   801887 <dupperm>
+  801c33:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801c35:	83 ec 08             	sub    $0x8,%esp
+  801c38:	6a 02                	push   $0x2
+  801c3a:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801c40:	51                   	push   %ecx
+  801c41:	e8 95 01 00 00       	call   801ddb <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801c46:	83 c4 0c             	add    $0xc,%esp
+  801c49:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801c4f:	57                   	push   %edi
+  801c50:	56                   	push   %esi
+  801c51:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c57:	56                   	push   %esi
+  801c58:	6a 00                	push   $0x0
+  801c5a:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801c60:	51                   	push   %ecx
+  801c61:	e8 b3 02 00 00       	call   801f19 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801c66:	83 c4 1c             	add    $0x1c,%esp
+  801c69:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801c6f:	57                   	push   %edi
+  801c70:	56                   	push   %esi
+  801c71:	6a 00                	push   $0x0
+  801c73:	56                   	push   %esi
+  801c74:	6a 00                	push   $0x0
+  801c76:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801c7c:	50                   	push   %eax
+  801c7d:	e8 97 02 00 00       	call   801f19 <batch_map>
+	return 0;
+  801c82:	83 c4 20             	add    $0x20,%esp
+  801c85:	89 de                	mov    %ebx,%esi
+  801c87:	e9 09 fe ff ff       	jmp    801a95 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801c8c:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801c92:	83 ec 04             	sub    $0x4,%esp
+  801c95:	6a 02                	push   $0x2
+  801c97:	56                   	push   %esi
+  801c98:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801c9e:	53                   	push   %ebx
+  801c9f:	e8 c9 02 00 00       	call   801f6d <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801ca4:	89 1c 24             	mov    %ebx,(%esp)
+  801ca7:	e8 dd 00 00 00       	call   801d89 <batch_flush>
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	78 0e                	js     801cc1 <ufork+0x2c3>
+}
+  801cb3:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbc:	5b                   	pop    %ebx
+  801cbd:	5e                   	pop    %esi
+  801cbe:	5f                   	pop    %edi
+  801cbf:	5d                   	pop    %ebp
+  801cc0:	c3                   	ret
+			panic("fork: %e", r);
+  801cc1:	50                   	push   %eax
+  801cc2:	68 b0 38 80 00       	push   $0x8038b0
+  801cc7:	68 d7 00 00 00       	push   $0xd7
+  801ccc:	68 85 38 80 00       	push   $0x803885
+  801cd1:	e8 20 e5 ff ff       	call   8001f6 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801cd6:	e8 aa f0 ff ff       	call   800d85 <sys_getenvid>
+  801cdb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ce0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ce6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ceb:	a3 0c 50 80 00       	mov    %eax,0x80500c
+		return 0;
+  801cf0:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801cf7:	00 00 00 
+  801cfa:	eb b7                	jmp    801cb3 <ufork+0x2b5>
+
+00801cfc <fork>:
+{
+  801cfc:	55                   	push   %ebp
+  801cfd:	89 e5                	mov    %esp,%ebp
+  801cff:	53                   	push   %ebx
+  801d00:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801d03:	68 20 19 80 00       	push   $0x801920
+  801d08:	e8 7b 14 00 00       	call   803188 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801d0d:	e8 7a f6 ff ff       	call   80138c <sys_fork>
+  801d12:	89 c3                	mov    %eax,%ebx
+  801d14:	83 c4 10             	add    $0x10,%esp
+  801d17:	85 c0                	test   %eax,%eax
+  801d19:	78 09                	js     801d24 <fork+0x28>
+	if (pid == 0)
+  801d1b:	74 1c                	je     801d39 <fork+0x3d>
+}
+  801d1d:	89 d8                	mov    %ebx,%eax
+  801d1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d22:	c9                   	leave
+  801d23:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801d24:	50                   	push   %eax
+  801d25:	68 a9 38 80 00       	push   $0x8038a9
+  801d2a:	68 ed 00 00 00       	push   $0xed
+  801d2f:	68 85 38 80 00       	push   $0x803885
+  801d34:	e8 bd e4 ff ff       	call   8001f6 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d39:	e8 47 f0 ff ff       	call   800d85 <sys_getenvid>
+  801d3e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d43:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d49:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d4e:	a3 0c 50 80 00       	mov    %eax,0x80500c
+	return pid;
+  801d53:	eb c8                	jmp    801d1d <fork+0x21>
+
+00801d55 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801d55:	55                   	push   %ebp
+  801d56:	89 e5                	mov    %esp,%ebp
+  801d58:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801d5b:	ff 75 0c             	push   0xc(%ebp)
+  801d5e:	ff 75 08             	push   0x8(%ebp)
+  801d61:	68 e1 19 80 00       	push   $0x8019e1
+  801d66:	e8 67 f6 ff ff       	call   8013d2 <sys_thread_create>
+}
+  801d6b:	c9                   	leave
+  801d6c:	c3                   	ret
+
+00801d6d <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801d6d:	55                   	push   %ebp
+  801d6e:	89 e5                	mov    %esp,%ebp
+  801d70:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801d73:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801d7a:	00 00 00 
+	b->b_error = 0;
+  801d7d:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801d84:	00 00 00 
+}
+  801d87:	5d                   	pop    %ebp
+  801d88:	c3                   	ret
+
+00801d89 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	53                   	push   %ebx
+  801d8d:	83 ec 04             	sub    $0x4,%esp
+  801d90:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801d93:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	7e 09                	jle    801da6 <batch_flush+0x1d>
+  801d9d:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801da4:	74 15                	je     801dbb <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801da6:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801dad:	00 00 00 
+	return b->b_error;
+  801db0:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801db6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801dbb:	83 ec 08             	sub    $0x8,%esp
+  801dbe:	50                   	push   %eax
+  801dbf:	53                   	push   %ebx
+  801dc0:	e8 32 f7 ff ff       	call   8014f7 <sys_batch>
+  801dc5:	83 c4 10             	add    $0x10,%esp
+  801dc8:	85 c0                	test   %eax,%eax
+  801dca:	79 da                	jns    801da6 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801dcc:	f7 d8                	neg    %eax
+  801dce:	0f b6 c0             	movzbl %al,%eax
+  801dd1:	f7 d8                	neg    %eax
+  801dd3:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801dd9:	eb cb                	jmp    801da6 <batch_flush+0x1d>
+
+00801ddb <batch_reserve>:
+{
+  801ddb:	55                   	push   %ebp
+  801ddc:	89 e5                	mov    %esp,%ebp
+  801dde:	83 ec 08             	sub    $0x8,%esp
+  801de1:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801de4:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801dea:	03 45 0c             	add    0xc(%ebp),%eax
+  801ded:	83 f8 10             	cmp    $0x10,%eax
+  801df0:	7f 02                	jg     801df4 <batch_reserve+0x19>
+}
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+		batch_flush(b);
+  801df4:	83 ec 0c             	sub    $0xc,%esp
+  801df7:	52                   	push   %edx
+  801df8:	e8 8c ff ff ff       	call   801d89 <batch_flush>
+  801dfd:	83 c4 10             	add    $0x10,%esp
+}
+  801e00:	eb f0                	jmp    801df2 <batch_reserve+0x17>
+
+00801e02 <batch_next>:
+{
+  801e02:	55                   	push   %ebp
+  801e03:	89 e5                	mov    %esp,%ebp
+  801e05:	53                   	push   %ebx
+  801e06:	83 ec 04             	sub    $0x4,%esp
+  801e09:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801e0b:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801e12:	74 28                	je     801e3c <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801e14:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801e1a:	8d 50 01             	lea    0x1(%eax),%edx
+  801e1d:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801e23:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801e26:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801e28:	83 ec 04             	sub    $0x4,%esp
+  801e2b:	6a 1c                	push   $0x1c
+  801e2d:	6a 00                	push   $0x0
+  801e2f:	53                   	push   %ebx
+  801e30:	e8 35 ec ff ff       	call   800a6a <memset>
+}
+  801e35:	89 d8                	mov    %ebx,%eax
+  801e37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e3a:	c9                   	leave
+  801e3b:	c3                   	ret
+		batch_flush(b);
+  801e3c:	83 ec 0c             	sub    $0xc,%esp
+  801e3f:	50                   	push   %eax
+  801e40:	e8 44 ff ff ff       	call   801d89 <batch_flush>
+  801e45:	83 c4 10             	add    $0x10,%esp
+  801e48:	eb ca                	jmp    801e14 <batch_next+0x12>
+
+00801e4a <batch_page>:
+{
+  801e4a:	55                   	push   %ebp
+  801e4b:	89 e5                	mov    %esp,%ebp
+  801e4d:	57                   	push   %edi
+  801e4e:	56                   	push   %esi
+  801e4f:	53                   	push   %ebx
+  801e50:	83 ec 1c             	sub    $0x1c,%esp
+  801e53:	89 d3                	mov    %edx,%ebx
+  801e55:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801e57:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801e5d:	85 d2                	test   %edx,%edx
+  801e5f:	74 50                	je     801eb1 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801e61:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801e64:	01 c1                	add    %eax,%ecx
+  801e66:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801e69:	75 46                	jne    801eb1 <batch_page+0x67>
+  801e6b:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801e6e:	75 41                	jne    801eb1 <batch_page+0x67>
+  801e70:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801e73:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801e76:	75 39                	jne    801eb1 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801e78:	83 ea 01             	sub    $0x1,%edx
+  801e7b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801e7e:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801e81:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801e85:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801e88:	75 27                	jne    801eb1 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801e8a:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801e8d:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801e91:	89 fa                	mov    %edi,%edx
+  801e93:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801e96:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801e99:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801e9c:	39 55 08             	cmp    %edx,0x8(%ebp)
+  801e9f:	75 10                	jne    801eb1 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801ea1:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  801ea5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801ea8:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  801eac:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801eaf:	74 2a                	je     801edb <batch_page+0x91>
+	op = batch_next(b);
+  801eb1:	e8 4c ff ff ff       	call   801e02 <batch_next>
+	op->bo_op = opcode;
+  801eb6:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  801eb8:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  801ebb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ebe:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  801ec1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801ec4:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  801ec7:	8b 75 10             	mov    0x10(%ebp),%esi
+  801eca:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  801ecd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801ed0:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  801ed3:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801ed6:	89 78 14             	mov    %edi,0x14(%eax)
+  801ed9:	eb 0b                	jmp    801ee6 <batch_page+0x9c>
+		op->bo_npages += npages;
+  801edb:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  801edf:	03 7d 18             	add    0x18(%ebp),%edi
+  801ee2:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  801ee6:	83 c4 1c             	add    $0x1c,%esp
+  801ee9:	5b                   	pop    %ebx
+  801eea:	5e                   	pop    %esi
+  801eeb:	5f                   	pop    %edi
+  801eec:	5d                   	pop    %ebp
+  801eed:	c3                   	ret
+
+00801eee <batch_alloc>:
+{
+  801eee:	55                   	push   %ebp
+  801eef:	89 e5                	mov    %esp,%ebp
+  801ef1:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  801ef4:	ff 75 18             	push   0x18(%ebp)
+  801ef7:	ff 75 14             	push   0x14(%ebp)
+  801efa:	ff 75 10             	push   0x10(%ebp)
+  801efd:	ff 75 0c             	push   0xc(%ebp)
+  801f00:	6a 00                	push   $0x0
+  801f02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f07:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0f:	e8 36 ff ff ff       	call   801e4a <batch_page>
+}
+  801f14:	83 c4 20             	add    $0x20,%esp
+  801f17:	c9                   	leave
+  801f18:	c3                   	ret
+
+00801f19 <batch_map>:
+{
+  801f19:	55                   	push   %ebp
+  801f1a:	89 e5                	mov    %esp,%ebp
+  801f1c:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  801f1f:	ff 75 20             	push   0x20(%ebp)
+  801f22:	ff 75 1c             	push   0x1c(%ebp)
+  801f25:	ff 75 18             	push   0x18(%ebp)
+  801f28:	ff 75 14             	push   0x14(%ebp)
+  801f2b:	ff 75 10             	push   0x10(%ebp)
+  801f2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f31:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f39:	e8 0c ff ff ff       	call   801e4a <batch_page>
+}
+  801f3e:	83 c4 20             	add    $0x20,%esp
+  801f41:	c9                   	leave
+  801f42:	c3                   	ret
+
+00801f43 <batch_unmap>:
+{
+  801f43:	55                   	push   %ebp
+  801f44:	89 e5                	mov    %esp,%ebp
+  801f46:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  801f49:	ff 75 14             	push   0x14(%ebp)
+  801f4c:	6a 00                	push   $0x0
+  801f4e:	ff 75 10             	push   0x10(%ebp)
+  801f51:	ff 75 0c             	push   0xc(%ebp)
+  801f54:	6a 00                	push   $0x0
+  801f56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f5b:	ba 02 00 00 00       	mov    $0x2,%edx
+  801f60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f63:	e8 e2 fe ff ff       	call   801e4a <batch_page>
+}
+  801f68:	83 c4 20             	add    $0x20,%esp
+  801f6b:	c9                   	leave
+  801f6c:	c3                   	ret
+
+00801f6d <batch_set_status>:
+{
+  801f6d:	55                   	push   %ebp
+  801f6e:	89 e5                	mov    %esp,%ebp
+  801f70:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  801f73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f76:	e8 87 fe ff ff       	call   801e02 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  801f7b:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  801f81:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f84:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  801f87:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f8a:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+00801f8f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f95:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f9a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801f9d:	5d                   	pop    %ebp
+  801f9e:	c3                   	ret
+
+00801f9f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801f9f:	55                   	push   %ebp
+  801fa0:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801fa2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa5:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801faa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801faf:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801fb4:	5d                   	pop    %ebp
+  801fb5:	c3                   	ret
+
+00801fb6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801fb9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801fbe:	eb 02                	jmp    801fc2 <fd_alloc+0xc>
+  801fc0:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801fc2:	89 c2                	mov    %eax,%edx
+  801fc4:	c1 ea 16             	shr    $0x16,%edx
+  801fc7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801fce:	f6 c2 01             	test   $0x1,%dl
+  801fd1:	74 2b                	je     801ffe <fd_alloc+0x48>
+  801fd3:	89 c2                	mov    %eax,%edx
+  801fd5:	c1 ea 0c             	shr    $0xc,%edx
+  801fd8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801fdf:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801fe5:	f6 c1 01             	test   $0x1,%cl
+  801fe8:	74 14                	je     801ffe <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801fea:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801ff0:	75 ce                	jne    801fc0 <fd_alloc+0xa>
+  801ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801ff7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801ffc:	eb 05                	jmp    802003 <fd_alloc+0x4d>
+			return 0;
+  801ffe:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802003:	8b 55 08             	mov    0x8(%ebp),%edx
+  802006:	89 02                	mov    %eax,(%edx)
+}
+  802008:	89 c8                	mov    %ecx,%eax
+  80200a:	5d                   	pop    %ebp
+  80200b:	c3                   	ret
+
+0080200c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80200c:	55                   	push   %ebp
+  80200d:	89 e5                	mov    %esp,%ebp
+  80200f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802012:	83 f8 1f             	cmp    $0x1f,%eax
+  802015:	77 30                	ja     802047 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802017:	c1 e0 0c             	shl    $0xc,%eax
+  80201a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80201f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802025:	f6 c2 01             	test   $0x1,%dl
+  802028:	74 24                	je     80204e <fd_lookup+0x42>
+  80202a:	89 c2                	mov    %eax,%edx
+  80202c:	c1 ea 0c             	shr    $0xc,%edx
+  80202f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802036:	f6 c2 01             	test   $0x1,%dl
+  802039:	74 1a                	je     802055 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80203b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80203e:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802040:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802045:	5d                   	pop    %ebp
+  802046:	c3                   	ret
+		return -E_INVAL;
+  802047:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80204c:	eb f7                	jmp    802045 <fd_lookup+0x39>
+		return -E_INVAL;
+  80204e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802053:	eb f0                	jmp    802045 <fd_lookup+0x39>
+  802055:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80205a:	eb e9                	jmp    802045 <fd_lookup+0x39>
+
+0080205c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	53                   	push   %ebx
+  802060:	83 ec 04             	sub    $0x4,%esp
+  802063:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206b:	eb 03                	jmp    802070 <dev_lookup+0x14>
+  80206d:	83 c0 01             	add    $0x1,%eax
+  802070:	8b 1c 85 6c 39 80 00 	mov    0x80396c(,%eax,4),%ebx
+  802077:	85 db                	test   %ebx,%ebx
+  802079:	74 0b                	je     802086 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80207b:	39 13                	cmp    %edx,(%ebx)
+  80207d:	75 ee                	jne    80206d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80207f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802084:	eb 2e                	jmp    8020b4 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  802086:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802088:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80208d:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802093:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802098:	76 24                	jbe    8020be <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80209a:	8b 41 48             	mov    0x48(%ecx),%eax
+  80209d:	83 ec 04             	sub    $0x4,%esp
+  8020a0:	52                   	push   %edx
+  8020a1:	50                   	push   %eax
+  8020a2:	68 f0 38 80 00       	push   $0x8038f0
+  8020a7:	e8 25 e2 ff ff       	call   8002d1 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8020ac:	83 c4 10             	add    $0x10,%esp
+  8020af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8020b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020b7:	89 1a                	mov    %ebx,(%edx)
+}
+  8020b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020bc:	c9                   	leave
+  8020bd:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8020be:	c1 e8 10             	shr    $0x10,%eax
+  8020c1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8020c7:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8020cd:	eb cb                	jmp    80209a <dev_lookup+0x3e>
+
+008020cf <fd_close>:
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	57                   	push   %edi
+  8020d3:	56                   	push   %esi
+  8020d4:	53                   	push   %ebx
+  8020d5:	83 ec 24             	sub    $0x24,%esp
+  8020d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8020de:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020e1:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020e2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8020e8:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8020eb:	50                   	push   %eax
+  8020ec:	e8 1b ff ff ff       	call   80200c <fd_lookup>
+  8020f1:	89 c3                	mov    %eax,%ebx
+  8020f3:	83 c4 10             	add    $0x10,%esp
+  8020f6:	85 c0                	test   %eax,%eax
+  8020f8:	78 05                	js     8020ff <fd_close+0x30>
+	    || fd != fd2)
+  8020fa:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8020fd:	74 16                	je     802115 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8020ff:	89 f8                	mov    %edi,%eax
+  802101:	84 c0                	test   %al,%al
+  802103:	b8 00 00 00 00       	mov    $0x0,%eax
+  802108:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80210b:	89 d8                	mov    %ebx,%eax
+  80210d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802110:	5b                   	pop    %ebx
+  802111:	5e                   	pop    %esi
+  802112:	5f                   	pop    %edi
+  802113:	5d                   	pop    %ebp
+  802114:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802115:	83 ec 08             	sub    $0x8,%esp
+  802118:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80211b:	50                   	push   %eax
+  80211c:	ff 36                	push   (%esi)
+  80211e:	e8 39 ff ff ff       	call   80205c <dev_lookup>
+  802123:	89 c3                	mov    %eax,%ebx
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 1a                	js     802146 <fd_close+0x77>
+		if (dev->dev_close)
+  80212c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80212f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802132:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802137:	85 c0                	test   %eax,%eax
+  802139:	74 0b                	je     802146 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80213b:	83 ec 0c             	sub    $0xc,%esp
+  80213e:	56                   	push   %esi
+  80213f:	ff d0                	call   *%eax
+  802141:	89 c3                	mov    %eax,%ebx
+  802143:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802146:	83 ec 08             	sub    $0x8,%esp
+  802149:	56                   	push   %esi
+  80214a:	6a 00                	push   $0x0
+  80214c:	e8 9b ed ff ff       	call   800eec <sys_page_unmap>
+	return r;
+  802151:	83 c4 10             	add    $0x10,%esp
+  802154:	eb b5                	jmp    80210b <fd_close+0x3c>
+
+00802156 <close>:
+
+int
+close(int fdnum)
+{
+  802156:	55                   	push   %ebp
+  802157:	89 e5                	mov    %esp,%ebp
+  802159:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80215c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215f:	50                   	push   %eax
+  802160:	ff 75 08             	push   0x8(%ebp)
+  802163:	e8 a4 fe ff ff       	call   80200c <fd_lookup>
+  802168:	83 c4 10             	add    $0x10,%esp
+  80216b:	85 c0                	test   %eax,%eax
+  80216d:	79 02                	jns    802171 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+		return fd_close(fd, 1);
+  802171:	83 ec 08             	sub    $0x8,%esp
+  802174:	6a 01                	push   $0x1
+  802176:	ff 75 f4             	push   -0xc(%ebp)
+  802179:	e8 51 ff ff ff       	call   8020cf <fd_close>
+  80217e:	83 c4 10             	add    $0x10,%esp
+  802181:	eb ec                	jmp    80216f <close+0x19>
+
+00802183 <close_all>:
+
+void
+close_all(void)
+{
+  802183:	55                   	push   %ebp
+  802184:	89 e5                	mov    %esp,%ebp
+  802186:	53                   	push   %ebx
+  802187:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80218a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80218f:	83 ec 0c             	sub    $0xc,%esp
+  802192:	53                   	push   %ebx
+  802193:	e8 be ff ff ff       	call   802156 <close>
+	for (i = 0; i < MAXFD; i++)
+  802198:	83 c3 01             	add    $0x1,%ebx
+  80219b:	83 c4 10             	add    $0x10,%esp
+  80219e:	83 fb 20             	cmp    $0x20,%ebx
+  8021a1:	75 ec                	jne    80218f <close_all+0xc>
+}
+  8021a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021a6:	c9                   	leave
+  8021a7:	c3                   	ret
+
+008021a8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8021a8:	55                   	push   %ebp
+  8021a9:	89 e5                	mov    %esp,%ebp
+  8021ab:	57                   	push   %edi
+  8021ac:	56                   	push   %esi
+  8021ad:	53                   	push   %ebx
+  8021ae:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8021b1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021b4:	50                   	push   %eax
+  8021b5:	ff 75 08             	push   0x8(%ebp)
+  8021b8:	e8 4f fe ff ff       	call   80200c <fd_lookup>
+  8021bd:	89 c3                	mov    %eax,%ebx
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	78 7f                	js     802245 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8021c6:	83 ec 0c             	sub    $0xc,%esp
+  8021c9:	ff 75 0c             	push   0xc(%ebp)
+  8021cc:	e8 85 ff ff ff       	call   802156 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8021d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8021d4:	c1 e6 0c             	shl    $0xc,%esi
+  8021d7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8021dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8021e0:	89 3c 24             	mov    %edi,(%esp)
+  8021e3:	e8 b7 fd ff ff       	call   801f9f <fd2data>
+  8021e8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8021ea:	89 34 24             	mov    %esi,(%esp)
+  8021ed:	e8 ad fd ff ff       	call   801f9f <fd2data>
+  8021f2:	83 c4 10             	add    $0x10,%esp
+  8021f5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8021f8:	89 d8                	mov    %ebx,%eax
+  8021fa:	c1 e8 16             	shr    $0x16,%eax
+  8021fd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802204:	a8 01                	test   $0x1,%al
+  802206:	74 11                	je     802219 <dup+0x71>
+  802208:	89 d8                	mov    %ebx,%eax
+  80220a:	c1 e8 0c             	shr    $0xc,%eax
+  80220d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802214:	f6 c2 01             	test   $0x1,%dl
+  802217:	75 36                	jne    80224f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802219:	89 f8                	mov    %edi,%eax
+  80221b:	c1 e8 0c             	shr    $0xc,%eax
+  80221e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802225:	83 ec 0c             	sub    $0xc,%esp
+  802228:	25 07 0e 00 00       	and    $0xe07,%eax
+  80222d:	50                   	push   %eax
+  80222e:	56                   	push   %esi
+  80222f:	6a 00                	push   $0x0
+  802231:	57                   	push   %edi
+  802232:	6a 00                	push   $0x0
+  802234:	e8 45 ec ff ff       	call   800e7e <sys_page_map>
+  802239:	89 c3                	mov    %eax,%ebx
+  80223b:	83 c4 20             	add    $0x20,%esp
+  80223e:	85 c0                	test   %eax,%eax
+  802240:	78 33                	js     802275 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802242:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802245:	89 d8                	mov    %ebx,%eax
+  802247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80224a:	5b                   	pop    %ebx
+  80224b:	5e                   	pop    %esi
+  80224c:	5f                   	pop    %edi
+  80224d:	5d                   	pop    %ebp
+  80224e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80224f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802256:	83 ec 0c             	sub    $0xc,%esp
+  802259:	25 07 0e 00 00       	and    $0xe07,%eax
+  80225e:	50                   	push   %eax
+  80225f:	ff 75 d4             	push   -0x2c(%ebp)
+  802262:	6a 00                	push   $0x0
+  802264:	53                   	push   %ebx
+  802265:	6a 00                	push   $0x0
+  802267:	e8 12 ec ff ff       	call   800e7e <sys_page_map>
+  80226c:	89 c3                	mov    %eax,%ebx
+  80226e:	83 c4 20             	add    $0x20,%esp
+  802271:	85 c0                	test   %eax,%eax
+  802273:	79 a4                	jns    802219 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802275:	83 ec 08             	sub    $0x8,%esp
+  802278:	56                   	push   %esi
+  802279:	6a 00                	push   $0x0
+  80227b:	e8 6c ec ff ff       	call   800eec <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802280:	83 c4 08             	add    $0x8,%esp
+  802283:	ff 75 d4             	push   -0x2c(%ebp)
+  802286:	6a 00                	push   $0x0
+  802288:	e8 5f ec ff ff       	call   800eec <sys_page_unmap>
+	return r;
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	eb b3                	jmp    802245 <dup+0x9d>
+
+00802292 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802292:	55                   	push   %ebp
+  802293:	89 e5                	mov    %esp,%ebp
+  802295:	56                   	push   %esi
+  802296:	53                   	push   %ebx
+  802297:	83 ec 18             	sub    $0x18,%esp
+  80229a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80229d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022a0:	50                   	push   %eax
+  8022a1:	53                   	push   %ebx
+  8022a2:	e8 65 fd ff ff       	call   80200c <fd_lookup>
+  8022a7:	83 c4 10             	add    $0x10,%esp
+  8022aa:	85 c0                	test   %eax,%eax
+  8022ac:	78 3c                	js     8022ea <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022ae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022b1:	83 ec 08             	sub    $0x8,%esp
+  8022b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022b7:	50                   	push   %eax
+  8022b8:	ff 36                	push   (%esi)
+  8022ba:	e8 9d fd ff ff       	call   80205c <dev_lookup>
+  8022bf:	83 c4 10             	add    $0x10,%esp
+  8022c2:	85 c0                	test   %eax,%eax
+  8022c4:	78 24                	js     8022ea <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8022c6:	8b 46 08             	mov    0x8(%esi),%eax
+  8022c9:	83 e0 03             	and    $0x3,%eax
+  8022cc:	83 f8 01             	cmp    $0x1,%eax
+  8022cf:	74 20                	je     8022f1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8022d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022d4:	8b 40 08             	mov    0x8(%eax),%eax
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	74 57                	je     802332 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8022db:	83 ec 04             	sub    $0x4,%esp
+  8022de:	ff 75 10             	push   0x10(%ebp)
+  8022e1:	ff 75 0c             	push   0xc(%ebp)
+  8022e4:	56                   	push   %esi
+  8022e5:	ff d0                	call   *%eax
+  8022e7:	83 c4 10             	add    $0x10,%esp
+}
+  8022ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ed:	5b                   	pop    %ebx
+  8022ee:	5e                   	pop    %esi
+  8022ef:	5d                   	pop    %ebp
+  8022f0:	c3                   	ret
+  8022f1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022f3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022f8:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022fe:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802303:	76 1c                	jbe    802321 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802305:	8b 42 48             	mov    0x48(%edx),%eax
+  802308:	83 ec 04             	sub    $0x4,%esp
+  80230b:	53                   	push   %ebx
+  80230c:	50                   	push   %eax
+  80230d:	68 31 39 80 00       	push   $0x803931
+  802312:	e8 ba df ff ff       	call   8002d1 <cprintf>
+		return -E_INVAL;
+  802317:	83 c4 10             	add    $0x10,%esp
+  80231a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80231f:	eb c9                	jmp    8022ea <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802321:	c1 e8 10             	shr    $0x10,%eax
+  802324:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80232a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802330:	eb d3                	jmp    802305 <read+0x73>
+		return -E_NOT_SUPP;
+  802332:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802337:	eb b1                	jmp    8022ea <read+0x58>
+
+00802339 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	57                   	push   %edi
+  80233d:	56                   	push   %esi
+  80233e:	53                   	push   %ebx
+  80233f:	83 ec 0c             	sub    $0xc,%esp
+  802342:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802345:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802348:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80234d:	eb 02                	jmp    802351 <readn+0x18>
+  80234f:	01 c3                	add    %eax,%ebx
+  802351:	39 f3                	cmp    %esi,%ebx
+  802353:	73 21                	jae    802376 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802355:	83 ec 04             	sub    $0x4,%esp
+  802358:	89 f0                	mov    %esi,%eax
+  80235a:	29 d8                	sub    %ebx,%eax
+  80235c:	50                   	push   %eax
+  80235d:	89 d8                	mov    %ebx,%eax
+  80235f:	03 45 0c             	add    0xc(%ebp),%eax
+  802362:	50                   	push   %eax
+  802363:	57                   	push   %edi
+  802364:	e8 29 ff ff ff       	call   802292 <read>
+		if (m < 0)
+  802369:	83 c4 10             	add    $0x10,%esp
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	78 04                	js     802374 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802370:	75 dd                	jne    80234f <readn+0x16>
+  802372:	eb 02                	jmp    802376 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802374:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802376:	89 d8                	mov    %ebx,%eax
+  802378:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80237b:	5b                   	pop    %ebx
+  80237c:	5e                   	pop    %esi
+  80237d:	5f                   	pop    %edi
+  80237e:	5d                   	pop    %ebp
+  80237f:	c3                   	ret
+
+00802380 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	56                   	push   %esi
+  802384:	53                   	push   %ebx
+  802385:	83 ec 18             	sub    $0x18,%esp
+  802388:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80238b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80238e:	50                   	push   %eax
+  80238f:	53                   	push   %ebx
+  802390:	e8 77 fc ff ff       	call   80200c <fd_lookup>
+  802395:	83 c4 10             	add    $0x10,%esp
+  802398:	85 c0                	test   %eax,%eax
+  80239a:	78 37                	js     8023d3 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80239c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80239f:	83 ec 08             	sub    $0x8,%esp
+  8023a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a5:	50                   	push   %eax
+  8023a6:	ff 36                	push   (%esi)
+  8023a8:	e8 af fc ff ff       	call   80205c <dev_lookup>
+  8023ad:	83 c4 10             	add    $0x10,%esp
+  8023b0:	85 c0                	test   %eax,%eax
+  8023b2:	78 1f                	js     8023d3 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023b4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8023b8:	74 20                	je     8023da <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8023ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023bd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023c0:	85 c0                	test   %eax,%eax
+  8023c2:	74 57                	je     80241b <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8023c4:	83 ec 04             	sub    $0x4,%esp
+  8023c7:	ff 75 10             	push   0x10(%ebp)
+  8023ca:	ff 75 0c             	push   0xc(%ebp)
+  8023cd:	56                   	push   %esi
+  8023ce:	ff d0                	call   *%eax
+  8023d0:	83 c4 10             	add    $0x10,%esp
+}
+  8023d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d6:	5b                   	pop    %ebx
+  8023d7:	5e                   	pop    %esi
+  8023d8:	5d                   	pop    %ebp
+  8023d9:	c3                   	ret
+  8023da:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023dc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8023e1:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023e7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8023ec:	76 1c                	jbe    80240a <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023ee:	8b 42 48             	mov    0x48(%edx),%eax
+  8023f1:	83 ec 04             	sub    $0x4,%esp
+  8023f4:	53                   	push   %ebx
+  8023f5:	50                   	push   %eax
+  8023f6:	68 4d 39 80 00       	push   $0x80394d
+  8023fb:	e8 d1 de ff ff       	call   8002d1 <cprintf>
+		return -E_INVAL;
+  802400:	83 c4 10             	add    $0x10,%esp
+  802403:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802408:	eb c9                	jmp    8023d3 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80240a:	c1 e8 10             	shr    $0x10,%eax
+  80240d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802413:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802419:	eb d3                	jmp    8023ee <write+0x6e>
+		return -E_NOT_SUPP;
+  80241b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802420:	eb b1                	jmp    8023d3 <write+0x53>
+
+00802422 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802422:	55                   	push   %ebp
+  802423:	89 e5                	mov    %esp,%ebp
+  802425:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802428:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80242b:	50                   	push   %eax
+  80242c:	ff 75 08             	push   0x8(%ebp)
+  80242f:	e8 d8 fb ff ff       	call   80200c <fd_lookup>
+  802434:	83 c4 10             	add    $0x10,%esp
+  802437:	85 c0                	test   %eax,%eax
+  802439:	78 0e                	js     802449 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80243b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80243e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802441:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802444:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802449:	c9                   	leave
+  80244a:	c3                   	ret
+
+0080244b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	56                   	push   %esi
+  80244f:	53                   	push   %ebx
+  802450:	83 ec 18             	sub    $0x18,%esp
+  802453:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802456:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802459:	50                   	push   %eax
+  80245a:	53                   	push   %ebx
+  80245b:	e8 ac fb ff ff       	call   80200c <fd_lookup>
+  802460:	83 c4 10             	add    $0x10,%esp
+  802463:	85 c0                	test   %eax,%eax
+  802465:	78 34                	js     80249b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802467:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80246a:	83 ec 08             	sub    $0x8,%esp
+  80246d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802470:	50                   	push   %eax
+  802471:	ff 36                	push   (%esi)
+  802473:	e8 e4 fb ff ff       	call   80205c <dev_lookup>
+  802478:	83 c4 10             	add    $0x10,%esp
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 1c                	js     80249b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80247f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802483:	74 1d                	je     8024a2 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802488:	8b 40 18             	mov    0x18(%eax),%eax
+  80248b:	85 c0                	test   %eax,%eax
+  80248d:	74 54                	je     8024e3 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80248f:	83 ec 08             	sub    $0x8,%esp
+  802492:	ff 75 0c             	push   0xc(%ebp)
+  802495:	56                   	push   %esi
+  802496:	ff d0                	call   *%eax
+  802498:	83 c4 10             	add    $0x10,%esp
+}
+  80249b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80249e:	5b                   	pop    %ebx
+  80249f:	5e                   	pop    %esi
+  8024a0:	5d                   	pop    %ebp
+  8024a1:	c3                   	ret
+  8024a2:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024a4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8024a9:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8024af:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8024b4:	76 1c                	jbe    8024d2 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8024b6:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8024b9:	83 ec 04             	sub    $0x4,%esp
+  8024bc:	53                   	push   %ebx
+  8024bd:	50                   	push   %eax
+  8024be:	68 10 39 80 00       	push   $0x803910
+  8024c3:	e8 09 de ff ff       	call   8002d1 <cprintf>
+		return -E_INVAL;
+  8024c8:	83 c4 10             	add    $0x10,%esp
+  8024cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024d0:	eb c9                	jmp    80249b <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8024d2:	c1 e8 10             	shr    $0x10,%eax
+  8024d5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8024db:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8024e1:	eb d3                	jmp    8024b6 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8024e3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024e8:	eb b1                	jmp    80249b <ftruncate+0x50>
+
+008024ea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8024ea:	55                   	push   %ebp
+  8024eb:	89 e5                	mov    %esp,%ebp
+  8024ed:	56                   	push   %esi
+  8024ee:	53                   	push   %ebx
+  8024ef:	83 ec 18             	sub    $0x18,%esp
+  8024f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024f5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024f8:	50                   	push   %eax
+  8024f9:	ff 75 08             	push   0x8(%ebp)
+  8024fc:	e8 0b fb ff ff       	call   80200c <fd_lookup>
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	85 c0                	test   %eax,%eax
+  802506:	78 49                	js     802551 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802508:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80250b:	83 ec 08             	sub    $0x8,%esp
+  80250e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802511:	50                   	push   %eax
+  802512:	ff 36                	push   (%esi)
+  802514:	e8 43 fb ff ff       	call   80205c <dev_lookup>
+  802519:	83 c4 10             	add    $0x10,%esp
+  80251c:	85 c0                	test   %eax,%eax
+  80251e:	78 31                	js     802551 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802520:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802523:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802527:	74 2f                	je     802558 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802529:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80252c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802533:	00 00 00 
+	stat->st_isdir = 0;
+  802536:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80253d:	00 00 00 
+	stat->st_dev = dev;
+  802540:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802546:	83 ec 08             	sub    $0x8,%esp
+  802549:	53                   	push   %ebx
+  80254a:	56                   	push   %esi
+  80254b:	ff 50 14             	call   *0x14(%eax)
+  80254e:	83 c4 10             	add    $0x10,%esp
+}
+  802551:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802554:	5b                   	pop    %ebx
+  802555:	5e                   	pop    %esi
+  802556:	5d                   	pop    %ebp
+  802557:	c3                   	ret
+		return -E_NOT_SUPP;
+  802558:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80255d:	eb f2                	jmp    802551 <fstat+0x67>
+
+0080255f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80255f:	55                   	push   %ebp
+  802560:	89 e5                	mov    %esp,%ebp
+  802562:	56                   	push   %esi
+  802563:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802564:	83 ec 08             	sub    $0x8,%esp
+  802567:	6a 00                	push   $0x0
+  802569:	ff 75 08             	push   0x8(%ebp)
+  80256c:	e8 e4 01 00 00       	call   802755 <open>
+  802571:	89 c3                	mov    %eax,%ebx
+  802573:	83 c4 10             	add    $0x10,%esp
+  802576:	85 c0                	test   %eax,%eax
+  802578:	78 1b                	js     802595 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80257a:	83 ec 08             	sub    $0x8,%esp
+  80257d:	ff 75 0c             	push   0xc(%ebp)
+  802580:	50                   	push   %eax
+  802581:	e8 64 ff ff ff       	call   8024ea <fstat>
+  802586:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802588:	89 1c 24             	mov    %ebx,(%esp)
+  80258b:	e8 c6 fb ff ff       	call   802156 <close>
+	return r;
+  802590:	83 c4 10             	add    $0x10,%esp
+  802593:	89 f3                	mov    %esi,%ebx
+}
+  802595:	89 d8                	mov    %ebx,%eax
+  802597:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80259a:	5b                   	pop    %ebx
+  80259b:	5e                   	pop    %esi
+  80259c:	5d                   	pop    %ebp
+  80259d:	c3                   	ret
+
+0080259e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80259e:	55                   	push   %ebp
+  80259f:	89 e5                	mov    %esp,%ebp
+  8025a1:	56                   	push   %esi
+  8025a2:	53                   	push   %ebx
+  8025a3:	89 c6                	mov    %eax,%esi
+  8025a5:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8025a7:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8025ae:	74 27                	je     8025d7 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8025b0:	6a 07                	push   $0x7
+  8025b2:	68 00 60 80 00       	push   $0x806000
+  8025b7:	56                   	push   %esi
+  8025b8:	ff 35 00 50 80 00    	push   0x805000
+  8025be:	e8 41 0d 00 00       	call   803304 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8025c3:	83 c4 0c             	add    $0xc,%esp
+  8025c6:	6a 00                	push   $0x0
+  8025c8:	53                   	push   %ebx
+  8025c9:	6a 00                	push   $0x0
+  8025cb:	e8 1c 0d 00 00       	call   8032ec <ipc_recv>
+}
+  8025d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d3:	5b                   	pop    %ebx
+  8025d4:	5e                   	pop    %esi
+  8025d5:	5d                   	pop    %ebp
+  8025d6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8025d7:	83 ec 0c             	sub    $0xc,%esp
+  8025da:	6a 01                	push   $0x1
+  8025dc:	e8 77 0d 00 00       	call   803358 <ipc_find_env>
+  8025e1:	a3 00 50 80 00       	mov    %eax,0x805000
+  8025e6:	83 c4 10             	add    $0x10,%esp
+  8025e9:	eb c5                	jmp    8025b0 <fsipc+0x12>
+
+008025eb <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8025eb:	55                   	push   %ebp
+  8025ec:	89 e5                	mov    %esp,%ebp
+  8025ee:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8025f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025f7:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8025fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ff:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802604:	ba 00 00 00 00       	mov    $0x0,%edx
+  802609:	b8 02 00 00 00       	mov    $0x2,%eax
+  80260e:	e8 8b ff ff ff       	call   80259e <fsipc>
+}
+  802613:	c9                   	leave
+  802614:	c3                   	ret
+
+00802615 <devfile_flush>:
+{
+  802615:	55                   	push   %ebp
+  802616:	89 e5                	mov    %esp,%ebp
+  802618:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80261b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80261e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802621:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802626:	ba 00 00 00 00       	mov    $0x0,%edx
+  80262b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802630:	e8 69 ff ff ff       	call   80259e <fsipc>
+}
+  802635:	c9                   	leave
+  802636:	c3                   	ret
+
+00802637 <devfile_stat>:
+{
+  802637:	55                   	push   %ebp
+  802638:	89 e5                	mov    %esp,%ebp
+  80263a:	53                   	push   %ebx
+  80263b:	83 ec 04             	sub    $0x4,%esp
+  80263e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802641:	8b 45 08             	mov    0x8(%ebp),%eax
+  802644:	8b 40 0c             	mov    0xc(%eax),%eax
+  802647:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80264c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802651:	b8 05 00 00 00       	mov    $0x5,%eax
+  802656:	e8 43 ff ff ff       	call   80259e <fsipc>
+  80265b:	85 c0                	test   %eax,%eax
+  80265d:	78 2c                	js     80268b <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80265f:	83 ec 08             	sub    $0x8,%esp
+  802662:	68 00 60 80 00       	push   $0x806000
+  802667:	53                   	push   %ebx
+  802668:	e8 ac e2 ff ff       	call   800919 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80266d:	a1 80 60 80 00       	mov    0x806080,%eax
+  802672:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802678:	a1 84 60 80 00       	mov    0x806084,%eax
+  80267d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802683:	83 c4 10             	add    $0x10,%esp
+  802686:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80268e:	c9                   	leave
+  80268f:	c3                   	ret
+
+00802690 <devfile_write>:
+{
+  802690:	55                   	push   %ebp
+  802691:	89 e5                	mov    %esp,%ebp
+  802693:	83 ec 0c             	sub    $0xc,%esp
+  802696:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802699:	8b 55 08             	mov    0x8(%ebp),%edx
+  80269c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80269f:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8026a5:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8026aa:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8026af:	39 d0                	cmp    %edx,%eax
+  8026b1:	0f 47 c2             	cmova  %edx,%eax
+  8026b4:	50                   	push   %eax
+  8026b5:	ff 75 0c             	push   0xc(%ebp)
+  8026b8:	68 08 60 80 00       	push   $0x806008
+  8026bd:	e8 dd e3 ff ff       	call   800a9f <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8026c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026cc:	e8 cd fe ff ff       	call   80259e <fsipc>
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+008026d3 <devfile_read>:
+{
+  8026d3:	55                   	push   %ebp
+  8026d4:	89 e5                	mov    %esp,%ebp
+  8026d6:	56                   	push   %esi
+  8026d7:	53                   	push   %ebx
+  8026d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8026db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026de:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026e1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8026e6:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8026ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026f6:	e8 a3 fe ff ff       	call   80259e <fsipc>
+  8026fb:	89 c3                	mov    %eax,%ebx
+  8026fd:	85 c0                	test   %eax,%eax
+  8026ff:	78 1f                	js     802720 <devfile_read+0x4d>
+	assert(r <= n);
+  802701:	39 c6                	cmp    %eax,%esi
+  802703:	72 24                	jb     802729 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802705:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80270a:	7f 33                	jg     80273f <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80270c:	83 ec 04             	sub    $0x4,%esp
+  80270f:	50                   	push   %eax
+  802710:	68 00 60 80 00       	push   $0x806000
+  802715:	ff 75 0c             	push   0xc(%ebp)
+  802718:	e8 82 e3 ff ff       	call   800a9f <memmove>
+	return r;
+  80271d:	83 c4 10             	add    $0x10,%esp
+}
+  802720:	89 d8                	mov    %ebx,%eax
+  802722:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802725:	5b                   	pop    %ebx
+  802726:	5e                   	pop    %esi
+  802727:	5d                   	pop    %ebp
+  802728:	c3                   	ret
+	assert(r <= n);
+  802729:	68 80 39 80 00       	push   $0x803980
+  80272e:	68 70 38 80 00       	push   $0x803870
+  802733:	6a 76                	push   $0x76
+  802735:	68 87 39 80 00       	push   $0x803987
+  80273a:	e8 b7 da ff ff       	call   8001f6 <_panic>
+	assert(r <= PGSIZE);
+  80273f:	68 92 39 80 00       	push   $0x803992
+  802744:	68 70 38 80 00       	push   $0x803870
+  802749:	6a 77                	push   $0x77
+  80274b:	68 87 39 80 00       	push   $0x803987
+  802750:	e8 a1 da ff ff       	call   8001f6 <_panic>
+
+00802755 <open>:
+{
+  802755:	55                   	push   %ebp
+  802756:	89 e5                	mov    %esp,%ebp
+  802758:	56                   	push   %esi
+  802759:	53                   	push   %ebx
+  80275a:	83 ec 1c             	sub    $0x1c,%esp
+  80275d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802760:	56                   	push   %esi
+  802761:	e8 78 e1 ff ff       	call   8008de <strlen>
+  802766:	83 c4 10             	add    $0x10,%esp
+  802769:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80276e:	7f 6c                	jg     8027dc <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802770:	83 ec 0c             	sub    $0xc,%esp
+  802773:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802776:	50                   	push   %eax
+  802777:	e8 3a f8 ff ff       	call   801fb6 <fd_alloc>
+  80277c:	89 c3                	mov    %eax,%ebx
+  80277e:	83 c4 10             	add    $0x10,%esp
+  802781:	85 c0                	test   %eax,%eax
+  802783:	78 3c                	js     8027c1 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802785:	83 ec 08             	sub    $0x8,%esp
+  802788:	56                   	push   %esi
+  802789:	68 00 60 80 00       	push   $0x806000
+  80278e:	e8 86 e1 ff ff       	call   800919 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802793:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802796:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80279b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80279e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027a3:	e8 f6 fd ff ff       	call   80259e <fsipc>
+  8027a8:	89 c3                	mov    %eax,%ebx
+  8027aa:	83 c4 10             	add    $0x10,%esp
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	78 19                	js     8027ca <open+0x75>
+	return fd2num(fd);
+  8027b1:	83 ec 0c             	sub    $0xc,%esp
+  8027b4:	ff 75 f4             	push   -0xc(%ebp)
+  8027b7:	e8 d3 f7 ff ff       	call   801f8f <fd2num>
+  8027bc:	89 c3                	mov    %eax,%ebx
+  8027be:	83 c4 10             	add    $0x10,%esp
+}
+  8027c1:	89 d8                	mov    %ebx,%eax
+  8027c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c6:	5b                   	pop    %ebx
+  8027c7:	5e                   	pop    %esi
+  8027c8:	5d                   	pop    %ebp
+  8027c9:	c3                   	ret
+		fd_close(fd, 0);
+  8027ca:	83 ec 08             	sub    $0x8,%esp
+  8027cd:	6a 00                	push   $0x0
+  8027cf:	ff 75 f4             	push   -0xc(%ebp)
+  8027d2:	e8 f8 f8 ff ff       	call   8020cf <fd_close>
+		return r;
+  8027d7:	83 c4 10             	add    $0x10,%esp
+  8027da:	eb e5                	jmp    8027c1 <open+0x6c>
+		return -E_BAD_PATH;
+  8027dc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8027e1:	eb de                	jmp    8027c1 <open+0x6c>
+
+008027e3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8027e3:	55                   	push   %ebp
+  8027e4:	89 e5                	mov    %esp,%ebp
+  8027e6:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8027e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ee:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027f3:	e8 a6 fd ff ff       	call   80259e <fsipc>
+}
+  8027f8:	c9                   	leave
+  8027f9:	c3                   	ret
+
+008027fa <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027fa:	55                   	push   %ebp
+  8027fb:	89 e5                	mov    %esp,%ebp
+  8027fd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802800:	68 9e 39 80 00       	push   $0x80399e
+  802805:	ff 75 0c             	push   0xc(%ebp)
+  802808:	e8 0c e1 ff ff       	call   800919 <strcpy>
+	return 0;
+}
+  80280d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+
+00802814 <devsock_close>:
+{
+  802814:	55                   	push   %ebp
+  802815:	89 e5                	mov    %esp,%ebp
+  802817:	53                   	push   %ebx
+  802818:	83 ec 10             	sub    $0x10,%esp
+  80281b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80281e:	53                   	push   %ebx
+  80281f:	e8 73 0b 00 00       	call   803397 <pageref>
+  802824:	89 c2                	mov    %eax,%edx
+  802826:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80282e:	83 fa 01             	cmp    $0x1,%edx
+  802831:	74 05                	je     802838 <devsock_close+0x24>
+}
+  802833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802836:	c9                   	leave
+  802837:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802838:	83 ec 0c             	sub    $0xc,%esp
+  80283b:	ff 73 0c             	push   0xc(%ebx)
+  80283e:	e8 b7 02 00 00       	call   802afa <nsipc_close>
+  802843:	83 c4 10             	add    $0x10,%esp
+  802846:	eb eb                	jmp    802833 <devsock_close+0x1f>
+
+00802848 <devsock_write>:
+{
+  802848:	55                   	push   %ebp
+  802849:	89 e5                	mov    %esp,%ebp
+  80284b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80284e:	6a 00                	push   $0x0
+  802850:	ff 75 10             	push   0x10(%ebp)
+  802853:	ff 75 0c             	push   0xc(%ebp)
+  802856:	8b 45 08             	mov    0x8(%ebp),%eax
+  802859:	ff 70 0c             	push   0xc(%eax)
+  80285c:	e8 79 03 00 00       	call   802bda <nsipc_send>
+}
+  802861:	c9                   	leave
+  802862:	c3                   	ret
+
+00802863 <devsock_read>:
+{
+  802863:	55                   	push   %ebp
+  802864:	89 e5                	mov    %esp,%ebp
+  802866:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802869:	6a 00                	push   $0x0
+  80286b:	ff 75 10             	push   0x10(%ebp)
+  80286e:	ff 75 0c             	push   0xc(%ebp)
+  802871:	8b 45 08             	mov    0x8(%ebp),%eax
+  802874:	ff 70 0c             	push   0xc(%eax)
+  802877:	e8 ef 02 00 00       	call   802b6b <nsipc_recv>
+}
+  80287c:	c9                   	leave
+  80287d:	c3                   	ret
+
+0080287e <fd2sockid>:
+{
+  80287e:	55                   	push   %ebp
+  80287f:	89 e5                	mov    %esp,%ebp
+  802881:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802884:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802887:	52                   	push   %edx
+  802888:	50                   	push   %eax
+  802889:	e8 7e f7 ff ff       	call   80200c <fd_lookup>
+  80288e:	83 c4 10             	add    $0x10,%esp
+  802891:	85 c0                	test   %eax,%eax
+  802893:	78 10                	js     8028a5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802898:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80289e:	39 08                	cmp    %ecx,(%eax)
+  8028a0:	75 05                	jne    8028a7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8028a2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8028a5:	c9                   	leave
+  8028a6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028ac:	eb f7                	jmp    8028a5 <fd2sockid+0x27>
+
+008028ae <alloc_sockfd>:
+{
+  8028ae:	55                   	push   %ebp
+  8028af:	89 e5                	mov    %esp,%ebp
+  8028b1:	56                   	push   %esi
+  8028b2:	53                   	push   %ebx
+  8028b3:	83 ec 1c             	sub    $0x1c,%esp
+  8028b6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8028b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028bb:	50                   	push   %eax
+  8028bc:	e8 f5 f6 ff ff       	call   801fb6 <fd_alloc>
+  8028c1:	89 c3                	mov    %eax,%ebx
+  8028c3:	83 c4 10             	add    $0x10,%esp
+  8028c6:	85 c0                	test   %eax,%eax
+  8028c8:	78 43                	js     80290d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8028ca:	83 ec 04             	sub    $0x4,%esp
+  8028cd:	68 07 04 00 00       	push   $0x407
+  8028d2:	ff 75 f4             	push   -0xc(%ebp)
+  8028d5:	6a 00                	push   $0x0
+  8028d7:	e8 35 e5 ff ff       	call   800e11 <sys_page_alloc>
+  8028dc:	89 c3                	mov    %eax,%ebx
+  8028de:	83 c4 10             	add    $0x10,%esp
+  8028e1:	85 c0                	test   %eax,%eax
+  8028e3:	78 28                	js     80290d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8028e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028e8:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8028ee:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8028f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028f3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8028fa:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8028fd:	83 ec 0c             	sub    $0xc,%esp
+  802900:	50                   	push   %eax
+  802901:	e8 89 f6 ff ff       	call   801f8f <fd2num>
+  802906:	89 c3                	mov    %eax,%ebx
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	eb 0c                	jmp    802919 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80290d:	83 ec 0c             	sub    $0xc,%esp
+  802910:	56                   	push   %esi
+  802911:	e8 e4 01 00 00       	call   802afa <nsipc_close>
+		return r;
+  802916:	83 c4 10             	add    $0x10,%esp
+}
+  802919:	89 d8                	mov    %ebx,%eax
+  80291b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80291e:	5b                   	pop    %ebx
+  80291f:	5e                   	pop    %esi
+  802920:	5d                   	pop    %ebp
+  802921:	c3                   	ret
+
+00802922 <accept>:
+{
+  802922:	55                   	push   %ebp
+  802923:	89 e5                	mov    %esp,%ebp
+  802925:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292b:	e8 4e ff ff ff       	call   80287e <fd2sockid>
+  802930:	85 c0                	test   %eax,%eax
+  802932:	78 1b                	js     80294f <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802934:	83 ec 04             	sub    $0x4,%esp
+  802937:	ff 75 10             	push   0x10(%ebp)
+  80293a:	ff 75 0c             	push   0xc(%ebp)
+  80293d:	50                   	push   %eax
+  80293e:	e8 0e 01 00 00       	call   802a51 <nsipc_accept>
+  802943:	83 c4 10             	add    $0x10,%esp
+  802946:	85 c0                	test   %eax,%eax
+  802948:	78 05                	js     80294f <accept+0x2d>
+	return alloc_sockfd(r);
+  80294a:	e8 5f ff ff ff       	call   8028ae <alloc_sockfd>
+}
+  80294f:	c9                   	leave
+  802950:	c3                   	ret
+
+00802951 <bind>:
+{
+  802951:	55                   	push   %ebp
+  802952:	89 e5                	mov    %esp,%ebp
+  802954:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802957:	8b 45 08             	mov    0x8(%ebp),%eax
+  80295a:	e8 1f ff ff ff       	call   80287e <fd2sockid>
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	78 12                	js     802975 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802963:	83 ec 04             	sub    $0x4,%esp
+  802966:	ff 75 10             	push   0x10(%ebp)
+  802969:	ff 75 0c             	push   0xc(%ebp)
+  80296c:	50                   	push   %eax
+  80296d:	e8 31 01 00 00       	call   802aa3 <nsipc_bind>
+  802972:	83 c4 10             	add    $0x10,%esp
+}
+  802975:	c9                   	leave
+  802976:	c3                   	ret
+
+00802977 <shutdown>:
+{
+  802977:	55                   	push   %ebp
+  802978:	89 e5                	mov    %esp,%ebp
+  80297a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80297d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802980:	e8 f9 fe ff ff       	call   80287e <fd2sockid>
+  802985:	85 c0                	test   %eax,%eax
+  802987:	78 0f                	js     802998 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802989:	83 ec 08             	sub    $0x8,%esp
+  80298c:	ff 75 0c             	push   0xc(%ebp)
+  80298f:	50                   	push   %eax
+  802990:	e8 43 01 00 00       	call   802ad8 <nsipc_shutdown>
+  802995:	83 c4 10             	add    $0x10,%esp
+}
+  802998:	c9                   	leave
+  802999:	c3                   	ret
+
+0080299a <connect>:
+{
+  80299a:	55                   	push   %ebp
+  80299b:	89 e5                	mov    %esp,%ebp
+  80299d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a3:	e8 d6 fe ff ff       	call   80287e <fd2sockid>
+  8029a8:	85 c0                	test   %eax,%eax
+  8029aa:	78 12                	js     8029be <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8029ac:	83 ec 04             	sub    $0x4,%esp
+  8029af:	ff 75 10             	push   0x10(%ebp)
+  8029b2:	ff 75 0c             	push   0xc(%ebp)
+  8029b5:	50                   	push   %eax
+  8029b6:	e8 59 01 00 00       	call   802b14 <nsipc_connect>
+  8029bb:	83 c4 10             	add    $0x10,%esp
+}
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+
+008029c0 <listen>:
+{
+  8029c0:	55                   	push   %ebp
+  8029c1:	89 e5                	mov    %esp,%ebp
+  8029c3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c9:	e8 b0 fe ff ff       	call   80287e <fd2sockid>
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	78 0f                	js     8029e1 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8029d2:	83 ec 08             	sub    $0x8,%esp
+  8029d5:	ff 75 0c             	push   0xc(%ebp)
+  8029d8:	50                   	push   %eax
+  8029d9:	e8 6b 01 00 00       	call   802b49 <nsipc_listen>
+  8029de:	83 c4 10             	add    $0x10,%esp
+}
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+
+008029e3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8029e3:	55                   	push   %ebp
+  8029e4:	89 e5                	mov    %esp,%ebp
+  8029e6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8029e9:	ff 75 10             	push   0x10(%ebp)
+  8029ec:	ff 75 0c             	push   0xc(%ebp)
+  8029ef:	ff 75 08             	push   0x8(%ebp)
+  8029f2:	e8 41 02 00 00       	call   802c38 <nsipc_socket>
+  8029f7:	83 c4 10             	add    $0x10,%esp
+  8029fa:	85 c0                	test   %eax,%eax
+  8029fc:	78 05                	js     802a03 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8029fe:	e8 ab fe ff ff       	call   8028ae <alloc_sockfd>
+}
+  802a03:	c9                   	leave
+  802a04:	c3                   	ret
+
+00802a05 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a05:	55                   	push   %ebp
+  802a06:	89 e5                	mov    %esp,%ebp
+  802a08:	53                   	push   %ebx
+  802a09:	83 ec 04             	sub    $0x4,%esp
+  802a0c:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802a0e:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802a15:	74 26                	je     802a3d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a17:	6a 07                	push   $0x7
+  802a19:	68 00 70 80 00       	push   $0x807000
+  802a1e:	53                   	push   %ebx
+  802a1f:	ff 35 04 50 80 00    	push   0x805004
+  802a25:	e8 da 08 00 00       	call   803304 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a2a:	83 c4 0c             	add    $0xc,%esp
+  802a2d:	6a 00                	push   $0x0
+  802a2f:	6a 00                	push   $0x0
+  802a31:	6a 00                	push   $0x0
+  802a33:	e8 b4 08 00 00       	call   8032ec <ipc_recv>
+}
+  802a38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a3b:	c9                   	leave
+  802a3c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a3d:	83 ec 0c             	sub    $0xc,%esp
+  802a40:	6a 02                	push   $0x2
+  802a42:	e8 11 09 00 00       	call   803358 <ipc_find_env>
+  802a47:	a3 04 50 80 00       	mov    %eax,0x805004
+  802a4c:	83 c4 10             	add    $0x10,%esp
+  802a4f:	eb c6                	jmp    802a17 <nsipc+0x12>
+
+00802a51 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a51:	55                   	push   %ebp
+  802a52:	89 e5                	mov    %esp,%ebp
+  802a54:	56                   	push   %esi
+  802a55:	53                   	push   %ebx
+  802a56:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5c:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a61:	8b 06                	mov    (%esi),%eax
+  802a63:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a68:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a6d:	e8 93 ff ff ff       	call   802a05 <nsipc>
+  802a72:	89 c3                	mov    %eax,%ebx
+  802a74:	85 c0                	test   %eax,%eax
+  802a76:	79 09                	jns    802a81 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a78:	89 d8                	mov    %ebx,%eax
+  802a7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a7d:	5b                   	pop    %ebx
+  802a7e:	5e                   	pop    %esi
+  802a7f:	5d                   	pop    %ebp
+  802a80:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a81:	83 ec 04             	sub    $0x4,%esp
+  802a84:	ff 35 10 70 80 00    	push   0x807010
+  802a8a:	68 00 70 80 00       	push   $0x807000
+  802a8f:	ff 75 0c             	push   0xc(%ebp)
+  802a92:	e8 08 e0 ff ff       	call   800a9f <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a97:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a9c:	89 06                	mov    %eax,(%esi)
+  802a9e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802aa1:	eb d5                	jmp    802a78 <nsipc_accept+0x27>
+
+00802aa3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802aa3:	55                   	push   %ebp
+  802aa4:	89 e5                	mov    %esp,%ebp
+  802aa6:	53                   	push   %ebx
+  802aa7:	83 ec 08             	sub    $0x8,%esp
+  802aaa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802aad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab0:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802ab5:	53                   	push   %ebx
+  802ab6:	ff 75 0c             	push   0xc(%ebp)
+  802ab9:	68 04 70 80 00       	push   $0x807004
+  802abe:	e8 dc df ff ff       	call   800a9f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802ac3:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802ac9:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ace:	e8 32 ff ff ff       	call   802a05 <nsipc>
+}
+  802ad3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad6:	c9                   	leave
+  802ad7:	c3                   	ret
+
+00802ad8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ad8:	55                   	push   %ebp
+  802ad9:	89 e5                	mov    %esp,%ebp
+  802adb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802ade:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802ae6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ae9:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802aee:	b8 03 00 00 00       	mov    $0x3,%eax
+  802af3:	e8 0d ff ff ff       	call   802a05 <nsipc>
+}
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+00802afa <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b00:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b03:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802b08:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b0d:	e8 f3 fe ff ff       	call   802a05 <nsipc>
+}
+  802b12:	c9                   	leave
+  802b13:	c3                   	ret
+
+00802b14 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b14:	55                   	push   %ebp
+  802b15:	89 e5                	mov    %esp,%ebp
+  802b17:	53                   	push   %ebx
+  802b18:	83 ec 08             	sub    $0x8,%esp
+  802b1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b21:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b26:	53                   	push   %ebx
+  802b27:	ff 75 0c             	push   0xc(%ebp)
+  802b2a:	68 04 70 80 00       	push   $0x807004
+  802b2f:	e8 6b df ff ff       	call   800a9f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b34:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802b3a:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b3f:	e8 c1 fe ff ff       	call   802a05 <nsipc>
+}
+  802b44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b47:	c9                   	leave
+  802b48:	c3                   	ret
+
+00802b49 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b49:	55                   	push   %ebp
+  802b4a:	89 e5                	mov    %esp,%ebp
+  802b4c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b52:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b5a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802b5f:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b64:	e8 9c fe ff ff       	call   802a05 <nsipc>
+}
+  802b69:	c9                   	leave
+  802b6a:	c3                   	ret
+
+00802b6b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	56                   	push   %esi
+  802b6f:	53                   	push   %ebx
+  802b70:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b76:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802b7b:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802b81:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b84:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b89:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b8e:	e8 72 fe ff ff       	call   802a05 <nsipc>
+  802b93:	89 c3                	mov    %eax,%ebx
+  802b95:	85 c0                	test   %eax,%eax
+  802b97:	78 22                	js     802bbb <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b99:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b9e:	39 c6                	cmp    %eax,%esi
+  802ba0:	0f 4e c6             	cmovle %esi,%eax
+  802ba3:	39 c3                	cmp    %eax,%ebx
+  802ba5:	7f 1d                	jg     802bc4 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ba7:	83 ec 04             	sub    $0x4,%esp
+  802baa:	53                   	push   %ebx
+  802bab:	68 00 70 80 00       	push   $0x807000
+  802bb0:	ff 75 0c             	push   0xc(%ebp)
+  802bb3:	e8 e7 de ff ff       	call   800a9f <memmove>
+  802bb8:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802bbb:	89 d8                	mov    %ebx,%eax
+  802bbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bc0:	5b                   	pop    %ebx
+  802bc1:	5e                   	pop    %esi
+  802bc2:	5d                   	pop    %ebp
+  802bc3:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802bc4:	68 aa 39 80 00       	push   $0x8039aa
+  802bc9:	68 70 38 80 00       	push   $0x803870
+  802bce:	6a 62                	push   $0x62
+  802bd0:	68 bf 39 80 00       	push   $0x8039bf
+  802bd5:	e8 1c d6 ff ff       	call   8001f6 <_panic>
+
+00802bda <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802bda:	55                   	push   %ebp
+  802bdb:	89 e5                	mov    %esp,%ebp
+  802bdd:	53                   	push   %ebx
+  802bde:	83 ec 04             	sub    $0x4,%esp
+  802be1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802be4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be7:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802bec:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bf2:	7f 2e                	jg     802c22 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802bf4:	83 ec 04             	sub    $0x4,%esp
+  802bf7:	53                   	push   %ebx
+  802bf8:	ff 75 0c             	push   0xc(%ebp)
+  802bfb:	68 0c 70 80 00       	push   $0x80700c
+  802c00:	e8 9a de ff ff       	call   800a9f <memmove>
+	nsipcbuf.send.req_size = size;
+  802c05:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802c0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c0e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802c13:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c18:	e8 e8 fd ff ff       	call   802a05 <nsipc>
+}
+  802c1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c20:	c9                   	leave
+  802c21:	c3                   	ret
+	assert(size < 1600);
+  802c22:	68 cb 39 80 00       	push   $0x8039cb
+  802c27:	68 70 38 80 00       	push   $0x803870
+  802c2c:	6a 6d                	push   $0x6d
+  802c2e:	68 bf 39 80 00       	push   $0x8039bf
+  802c33:	e8 be d5 ff ff       	call   8001f6 <_panic>
+
+00802c38 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c38:	55                   	push   %ebp
+  802c39:	89 e5                	mov    %esp,%ebp
+  802c3b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c41:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802c46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c49:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c4e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c51:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802c56:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c5b:	e8 a5 fd ff ff       	call   802a05 <nsipc>
+}
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+00802c62 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	56                   	push   %esi
+  802c66:	53                   	push   %ebx
+  802c67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802c6a:	83 ec 0c             	sub    $0xc,%esp
+  802c6d:	ff 75 08             	push   0x8(%ebp)
+  802c70:	e8 2a f3 ff ff       	call   801f9f <fd2data>
+  802c75:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802c77:	83 c4 08             	add    $0x8,%esp
+  802c7a:	68 d7 39 80 00       	push   $0x8039d7
+  802c7f:	53                   	push   %ebx
+  802c80:	e8 94 dc ff ff       	call   800919 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c85:	8b 46 04             	mov    0x4(%esi),%eax
+  802c88:	2b 06                	sub    (%esi),%eax
+  802c8a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802c90:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c97:	00 00 00 
+	stat->st_dev = &devpipe;
+  802c9a:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802ca1:	40 80 00 
+	return 0;
+}
+  802ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cac:	5b                   	pop    %ebx
+  802cad:	5e                   	pop    %esi
+  802cae:	5d                   	pop    %ebp
+  802caf:	c3                   	ret
+
+00802cb0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802cb0:	55                   	push   %ebp
+  802cb1:	89 e5                	mov    %esp,%ebp
+  802cb3:	53                   	push   %ebx
+  802cb4:	83 ec 0c             	sub    $0xc,%esp
+  802cb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802cba:	53                   	push   %ebx
+  802cbb:	6a 00                	push   $0x0
+  802cbd:	e8 2a e2 ff ff       	call   800eec <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802cc2:	89 1c 24             	mov    %ebx,(%esp)
+  802cc5:	e8 d5 f2 ff ff       	call   801f9f <fd2data>
+  802cca:	83 c4 08             	add    $0x8,%esp
+  802ccd:	50                   	push   %eax
+  802cce:	6a 00                	push   $0x0
+  802cd0:	e8 17 e2 ff ff       	call   800eec <sys_page_unmap>
+}
+  802cd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd8:	c9                   	leave
+  802cd9:	c3                   	ret
+
+00802cda <_pipeisclosed>:
+{
+  802cda:	55                   	push   %ebp
+  802cdb:	89 e5                	mov    %esp,%ebp
+  802cdd:	57                   	push   %edi
+  802cde:	56                   	push   %esi
+  802cdf:	53                   	push   %ebx
+  802ce0:	83 ec 1c             	sub    $0x1c,%esp
+  802ce3:	89 c7                	mov    %eax,%edi
+  802ce5:	89 d6                	mov    %edx,%esi
+  802ce7:	eb 3c                	jmp    802d25 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802ce9:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802cec:	83 ec 0c             	sub    $0xc,%esp
+  802cef:	57                   	push   %edi
+  802cf0:	e8 a2 06 00 00       	call   803397 <pageref>
+  802cf5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802cf8:	89 34 24             	mov    %esi,(%esp)
+  802cfb:	e8 97 06 00 00       	call   803397 <pageref>
+  802d00:	89 c2                	mov    %eax,%edx
+  802d02:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d04:	05 00 00 00 20       	add    $0x20000000,%eax
+  802d09:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802d0c:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d12:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d17:	76 31                	jbe    802d4a <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802d19:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802d1c:	39 c3                	cmp    %eax,%ebx
+  802d1e:	74 76                	je     802d96 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802d20:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802d23:	74 36                	je     802d5b <_pipeisclosed+0x81>
+  802d25:	89 e0                	mov    %esp,%eax
+  802d27:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d2c:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d32:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d37:	77 b0                	ja     802ce9 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d39:	c1 e8 10             	shr    $0x10,%eax
+  802d3c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d42:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d48:	eb 9f                	jmp    802ce9 <_pipeisclosed+0xf>
+  802d4a:	c1 e8 10             	shr    $0x10,%eax
+  802d4d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d53:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802d59:	eb be                	jmp    802d19 <_pipeisclosed+0x3f>
+  802d5b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d5d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d62:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d68:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d6d:	76 16                	jbe    802d85 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d6f:	8b 42 58             	mov    0x58(%edx),%eax
+  802d72:	6a 01                	push   $0x1
+  802d74:	50                   	push   %eax
+  802d75:	53                   	push   %ebx
+  802d76:	68 de 39 80 00       	push   $0x8039de
+  802d7b:	e8 51 d5 ff ff       	call   8002d1 <cprintf>
+  802d80:	83 c4 10             	add    $0x10,%esp
+  802d83:	eb a0                	jmp    802d25 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d85:	c1 e8 10             	shr    $0x10,%eax
+  802d88:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d8e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d94:	eb d9                	jmp    802d6f <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802d96:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802d99:	0f 94 c0             	sete   %al
+  802d9c:	0f b6 c0             	movzbl %al,%eax
+}
+  802d9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da2:	5b                   	pop    %ebx
+  802da3:	5e                   	pop    %esi
+  802da4:	5f                   	pop    %edi
+  802da5:	5d                   	pop    %ebp
+  802da6:	c3                   	ret
+
+00802da7 <devpipe_write>:
+{
+  802da7:	55                   	push   %ebp
+  802da8:	89 e5                	mov    %esp,%ebp
+  802daa:	57                   	push   %edi
+  802dab:	56                   	push   %esi
+  802dac:	53                   	push   %ebx
+  802dad:	83 ec 28             	sub    $0x28,%esp
+  802db0:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802db3:	56                   	push   %esi
+  802db4:	e8 e6 f1 ff ff       	call   801f9f <fd2data>
+  802db9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802dbb:	83 c4 10             	add    $0x10,%esp
+  802dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802dc6:	75 09                	jne    802dd1 <devpipe_write+0x2a>
+	return i;
+  802dc8:	89 f8                	mov    %edi,%eax
+  802dca:	eb 23                	jmp    802def <devpipe_write+0x48>
+			sys_yield();
+  802dcc:	e8 fa df ff ff       	call   800dcb <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802dd1:	8b 43 04             	mov    0x4(%ebx),%eax
+  802dd4:	8b 0b                	mov    (%ebx),%ecx
+  802dd6:	8d 51 20             	lea    0x20(%ecx),%edx
+  802dd9:	39 d0                	cmp    %edx,%eax
+  802ddb:	72 1a                	jb     802df7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802ddd:	89 da                	mov    %ebx,%edx
+  802ddf:	89 f0                	mov    %esi,%eax
+  802de1:	e8 f4 fe ff ff       	call   802cda <_pipeisclosed>
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	74 e2                	je     802dcc <devpipe_write+0x25>
+				return 0;
+  802dea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df2:	5b                   	pop    %ebx
+  802df3:	5e                   	pop    %esi
+  802df4:	5f                   	pop    %edi
+  802df5:	5d                   	pop    %ebp
+  802df6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802df7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dfa:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802dfe:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802e01:	89 c2                	mov    %eax,%edx
+  802e03:	c1 fa 1f             	sar    $0x1f,%edx
+  802e06:	89 d1                	mov    %edx,%ecx
+  802e08:	c1 e9 1b             	shr    $0x1b,%ecx
+  802e0b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e0e:	83 e2 1f             	and    $0x1f,%edx
+  802e11:	29 ca                	sub    %ecx,%edx
+  802e13:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802e17:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802e1b:	83 c0 01             	add    $0x1,%eax
+  802e1e:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802e21:	83 c7 01             	add    $0x1,%edi
+  802e24:	eb 9d                	jmp    802dc3 <devpipe_write+0x1c>
+
+00802e26 <devpipe_read>:
+{
+  802e26:	55                   	push   %ebp
+  802e27:	89 e5                	mov    %esp,%ebp
+  802e29:	57                   	push   %edi
+  802e2a:	56                   	push   %esi
+  802e2b:	53                   	push   %ebx
+  802e2c:	83 ec 18             	sub    $0x18,%esp
+  802e2f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802e32:	57                   	push   %edi
+  802e33:	e8 67 f1 ff ff       	call   801f9f <fd2data>
+  802e38:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802e3a:	83 c4 10             	add    $0x10,%esp
+  802e3d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e42:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e45:	75 13                	jne    802e5a <devpipe_read+0x34>
+	return i;
+  802e47:	89 f0                	mov    %esi,%eax
+  802e49:	eb 02                	jmp    802e4d <devpipe_read+0x27>
+				return i;
+  802e4b:	89 f0                	mov    %esi,%eax
+}
+  802e4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e50:	5b                   	pop    %ebx
+  802e51:	5e                   	pop    %esi
+  802e52:	5f                   	pop    %edi
+  802e53:	5d                   	pop    %ebp
+  802e54:	c3                   	ret
+			sys_yield();
+  802e55:	e8 71 df ff ff       	call   800dcb <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802e5a:	8b 03                	mov    (%ebx),%eax
+  802e5c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e5f:	75 18                	jne    802e79 <devpipe_read+0x53>
+			if (i > 0)
+  802e61:	85 f6                	test   %esi,%esi
+  802e63:	75 e6                	jne    802e4b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802e65:	89 da                	mov    %ebx,%edx
+  802e67:	89 f8                	mov    %edi,%eax
+  802e69:	e8 6c fe ff ff       	call   802cda <_pipeisclosed>
+  802e6e:	85 c0                	test   %eax,%eax
+  802e70:	74 e3                	je     802e55 <devpipe_read+0x2f>
+				return 0;
+  802e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e77:	eb d4                	jmp    802e4d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e79:	99                   	cltd
+  802e7a:	c1 ea 1b             	shr    $0x1b,%edx
+  802e7d:	01 d0                	add    %edx,%eax
+  802e7f:	83 e0 1f             	and    $0x1f,%eax
+  802e82:	29 d0                	sub    %edx,%eax
+  802e84:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e8c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802e8f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802e92:	83 c6 01             	add    $0x1,%esi
+  802e95:	eb ab                	jmp    802e42 <devpipe_read+0x1c>
+
+00802e97 <pipe>:
+{
+  802e97:	55                   	push   %ebp
+  802e98:	89 e5                	mov    %esp,%ebp
+  802e9a:	56                   	push   %esi
+  802e9b:	53                   	push   %ebx
+  802e9c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802e9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ea2:	50                   	push   %eax
+  802ea3:	e8 0e f1 ff ff       	call   801fb6 <fd_alloc>
+  802ea8:	89 c3                	mov    %eax,%ebx
+  802eaa:	83 c4 10             	add    $0x10,%esp
+  802ead:	85 c0                	test   %eax,%eax
+  802eaf:	0f 88 23 01 00 00    	js     802fd8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802eb5:	83 ec 04             	sub    $0x4,%esp
+  802eb8:	68 07 04 00 00       	push   $0x407
+  802ebd:	ff 75 f4             	push   -0xc(%ebp)
+  802ec0:	6a 00                	push   $0x0
+  802ec2:	e8 4a df ff ff       	call   800e11 <sys_page_alloc>
+  802ec7:	89 c3                	mov    %eax,%ebx
+  802ec9:	83 c4 10             	add    $0x10,%esp
+  802ecc:	85 c0                	test   %eax,%eax
+  802ece:	0f 88 04 01 00 00    	js     802fd8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802ed4:	83 ec 0c             	sub    $0xc,%esp
+  802ed7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802eda:	50                   	push   %eax
+  802edb:	e8 d6 f0 ff ff       	call   801fb6 <fd_alloc>
+  802ee0:	89 c3                	mov    %eax,%ebx
+  802ee2:	83 c4 10             	add    $0x10,%esp
+  802ee5:	85 c0                	test   %eax,%eax
+  802ee7:	0f 88 db 00 00 00    	js     802fc8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802eed:	83 ec 04             	sub    $0x4,%esp
+  802ef0:	68 07 04 00 00       	push   $0x407
+  802ef5:	ff 75 f0             	push   -0x10(%ebp)
+  802ef8:	6a 00                	push   $0x0
+  802efa:	e8 12 df ff ff       	call   800e11 <sys_page_alloc>
+  802eff:	89 c3                	mov    %eax,%ebx
+  802f01:	83 c4 10             	add    $0x10,%esp
+  802f04:	85 c0                	test   %eax,%eax
+  802f06:	0f 88 bc 00 00 00    	js     802fc8 <pipe+0x131>
+	va = fd2data(fd0);
+  802f0c:	83 ec 0c             	sub    $0xc,%esp
+  802f0f:	ff 75 f4             	push   -0xc(%ebp)
+  802f12:	e8 88 f0 ff ff       	call   801f9f <fd2data>
+  802f17:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f19:	83 c4 0c             	add    $0xc,%esp
+  802f1c:	68 07 04 00 00       	push   $0x407
+  802f21:	50                   	push   %eax
+  802f22:	6a 00                	push   $0x0
+  802f24:	e8 e8 de ff ff       	call   800e11 <sys_page_alloc>
+  802f29:	89 c3                	mov    %eax,%ebx
+  802f2b:	83 c4 10             	add    $0x10,%esp
+  802f2e:	85 c0                	test   %eax,%eax
+  802f30:	0f 88 82 00 00 00    	js     802fb8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f36:	83 ec 0c             	sub    $0xc,%esp
+  802f39:	ff 75 f0             	push   -0x10(%ebp)
+  802f3c:	e8 5e f0 ff ff       	call   801f9f <fd2data>
+  802f41:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802f48:	50                   	push   %eax
+  802f49:	6a 00                	push   $0x0
+  802f4b:	56                   	push   %esi
+  802f4c:	6a 00                	push   $0x0
+  802f4e:	e8 2b df ff ff       	call   800e7e <sys_page_map>
+  802f53:	89 c3                	mov    %eax,%ebx
+  802f55:	83 c4 20             	add    $0x20,%esp
+  802f58:	85 c0                	test   %eax,%eax
+  802f5a:	78 4e                	js     802faa <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802f5c:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802f61:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f64:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802f66:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f69:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802f70:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f73:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802f75:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f78:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802f7f:	83 ec 0c             	sub    $0xc,%esp
+  802f82:	ff 75 f4             	push   -0xc(%ebp)
+  802f85:	e8 05 f0 ff ff       	call   801f8f <fd2num>
+  802f8a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f8d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802f8f:	83 c4 04             	add    $0x4,%esp
+  802f92:	ff 75 f0             	push   -0x10(%ebp)
+  802f95:	e8 f5 ef ff ff       	call   801f8f <fd2num>
+  802f9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f9d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802fa0:	83 c4 10             	add    $0x10,%esp
+  802fa3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fa8:	eb 2e                	jmp    802fd8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802faa:	83 ec 08             	sub    $0x8,%esp
+  802fad:	56                   	push   %esi
+  802fae:	6a 00                	push   $0x0
+  802fb0:	e8 37 df ff ff       	call   800eec <sys_page_unmap>
+  802fb5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802fb8:	83 ec 08             	sub    $0x8,%esp
+  802fbb:	ff 75 f0             	push   -0x10(%ebp)
+  802fbe:	6a 00                	push   $0x0
+  802fc0:	e8 27 df ff ff       	call   800eec <sys_page_unmap>
+  802fc5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802fc8:	83 ec 08             	sub    $0x8,%esp
+  802fcb:	ff 75 f4             	push   -0xc(%ebp)
+  802fce:	6a 00                	push   $0x0
+  802fd0:	e8 17 df ff ff       	call   800eec <sys_page_unmap>
+  802fd5:	83 c4 10             	add    $0x10,%esp
+}
+  802fd8:	89 d8                	mov    %ebx,%eax
+  802fda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fdd:	5b                   	pop    %ebx
+  802fde:	5e                   	pop    %esi
+  802fdf:	5d                   	pop    %ebp
+  802fe0:	c3                   	ret
+
+00802fe1 <pipeisclosed>:
+{
+  802fe1:	55                   	push   %ebp
+  802fe2:	89 e5                	mov    %esp,%ebp
+  802fe4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fe7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fea:	50                   	push   %eax
+  802feb:	ff 75 08             	push   0x8(%ebp)
+  802fee:	e8 19 f0 ff ff       	call   80200c <fd_lookup>
+  802ff3:	83 c4 10             	add    $0x10,%esp
+  802ff6:	85 c0                	test   %eax,%eax
+  802ff8:	78 18                	js     803012 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802ffa:	83 ec 0c             	sub    $0xc,%esp
+  802ffd:	ff 75 f4             	push   -0xc(%ebp)
+  803000:	e8 9a ef ff ff       	call   801f9f <fd2data>
+  803005:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803007:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80300a:	e8 cb fc ff ff       	call   802cda <_pipeisclosed>
+  80300f:	83 c4 10             	add    $0x10,%esp
+}
+  803012:	c9                   	leave
+  803013:	c3                   	ret
+
+00803014 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803014:	b8 00 00 00 00       	mov    $0x0,%eax
+  803019:	c3                   	ret
+
+0080301a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80301a:	55                   	push   %ebp
+  80301b:	89 e5                	mov    %esp,%ebp
+  80301d:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803020:	68 f6 39 80 00       	push   $0x8039f6
+  803025:	ff 75 0c             	push   0xc(%ebp)
+  803028:	e8 ec d8 ff ff       	call   800919 <strcpy>
+	return 0;
+}
+  80302d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803032:	c9                   	leave
+  803033:	c3                   	ret
+
+00803034 <devcons_write>:
+{
+  803034:	55                   	push   %ebp
+  803035:	89 e5                	mov    %esp,%ebp
+  803037:	57                   	push   %edi
+  803038:	56                   	push   %esi
+  803039:	53                   	push   %ebx
+  80303a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803040:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803045:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80304b:	eb 2e                	jmp    80307b <devcons_write+0x47>
+		m = n - tot;
+  80304d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803050:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803052:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803057:	39 c3                	cmp    %eax,%ebx
+  803059:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80305c:	83 ec 04             	sub    $0x4,%esp
+  80305f:	53                   	push   %ebx
+  803060:	89 f0                	mov    %esi,%eax
+  803062:	03 45 0c             	add    0xc(%ebp),%eax
+  803065:	50                   	push   %eax
+  803066:	57                   	push   %edi
+  803067:	e8 33 da ff ff       	call   800a9f <memmove>
+		sys_cputs(buf, m);
+  80306c:	83 c4 08             	add    $0x8,%esp
+  80306f:	53                   	push   %ebx
+  803070:	57                   	push   %edi
+  803071:	e8 1c dc ff ff       	call   800c92 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803076:	01 de                	add    %ebx,%esi
+  803078:	83 c4 10             	add    $0x10,%esp
+  80307b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80307e:	72 cd                	jb     80304d <devcons_write+0x19>
+}
+  803080:	89 f0                	mov    %esi,%eax
+  803082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803085:	5b                   	pop    %ebx
+  803086:	5e                   	pop    %esi
+  803087:	5f                   	pop    %edi
+  803088:	5d                   	pop    %ebp
+  803089:	c3                   	ret
+
+0080308a <devcons_read>:
+{
+  80308a:	55                   	push   %ebp
+  80308b:	89 e5                	mov    %esp,%ebp
+  80308d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803090:	b8 00 00 00 00       	mov    $0x0,%eax
+  803095:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803099:	75 07                	jne    8030a2 <devcons_read+0x18>
+  80309b:	eb 1f                	jmp    8030bc <devcons_read+0x32>
+		sys_yield();
+  80309d:	e8 29 dd ff ff       	call   800dcb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8030a2:	e8 2f dc ff ff       	call   800cd6 <sys_cgetc>
+  8030a7:	85 c0                	test   %eax,%eax
+  8030a9:	74 f2                	je     80309d <devcons_read+0x13>
+	if (c < 0)
+  8030ab:	78 0f                	js     8030bc <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8030ad:	83 f8 04             	cmp    $0x4,%eax
+  8030b0:	74 0c                	je     8030be <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8030b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8030b5:	88 02                	mov    %al,(%edx)
+	return 1;
+  8030b7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8030bc:	c9                   	leave
+  8030bd:	c3                   	ret
+		return 0;
+  8030be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c3:	eb f7                	jmp    8030bc <devcons_read+0x32>
+
+008030c5 <cputchar>:
+{
+  8030c5:	55                   	push   %ebp
+  8030c6:	89 e5                	mov    %esp,%ebp
+  8030c8:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8030cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ce:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8030d1:	6a 01                	push   $0x1
+  8030d3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8030d6:	50                   	push   %eax
+  8030d7:	e8 b6 db ff ff       	call   800c92 <sys_cputs>
+}
+  8030dc:	83 c4 10             	add    $0x10,%esp
+  8030df:	c9                   	leave
+  8030e0:	c3                   	ret
+
+008030e1 <getchar>:
+{
+  8030e1:	55                   	push   %ebp
+  8030e2:	89 e5                	mov    %esp,%ebp
+  8030e4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8030e7:	6a 01                	push   $0x1
+  8030e9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8030ec:	50                   	push   %eax
+  8030ed:	6a 00                	push   $0x0
+  8030ef:	e8 9e f1 ff ff       	call   802292 <read>
+	if (r < 0)
+  8030f4:	83 c4 10             	add    $0x10,%esp
+  8030f7:	85 c0                	test   %eax,%eax
+  8030f9:	78 06                	js     803101 <getchar+0x20>
+	if (r < 1)
+  8030fb:	74 06                	je     803103 <getchar+0x22>
+	return c;
+  8030fd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803101:	c9                   	leave
+  803102:	c3                   	ret
+		return -E_EOF;
+  803103:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803108:	eb f7                	jmp    803101 <getchar+0x20>
+
+0080310a <iscons>:
+{
+  80310a:	55                   	push   %ebp
+  80310b:	89 e5                	mov    %esp,%ebp
+  80310d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803110:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803113:	50                   	push   %eax
+  803114:	ff 75 08             	push   0x8(%ebp)
+  803117:	e8 f0 ee ff ff       	call   80200c <fd_lookup>
+  80311c:	83 c4 10             	add    $0x10,%esp
+  80311f:	85 c0                	test   %eax,%eax
+  803121:	78 11                	js     803134 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803123:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803126:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80312c:	39 10                	cmp    %edx,(%eax)
+  80312e:	0f 94 c0             	sete   %al
+  803131:	0f b6 c0             	movzbl %al,%eax
+}
+  803134:	c9                   	leave
+  803135:	c3                   	ret
+
+00803136 <opencons>:
+{
+  803136:	55                   	push   %ebp
+  803137:	89 e5                	mov    %esp,%ebp
+  803139:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80313c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80313f:	50                   	push   %eax
+  803140:	e8 71 ee ff ff       	call   801fb6 <fd_alloc>
+  803145:	83 c4 10             	add    $0x10,%esp
+  803148:	85 c0                	test   %eax,%eax
+  80314a:	78 3a                	js     803186 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80314c:	83 ec 04             	sub    $0x4,%esp
+  80314f:	68 07 04 00 00       	push   $0x407
+  803154:	ff 75 f4             	push   -0xc(%ebp)
+  803157:	6a 00                	push   $0x0
+  803159:	e8 b3 dc ff ff       	call   800e11 <sys_page_alloc>
+  80315e:	83 c4 10             	add    $0x10,%esp
+  803161:	85 c0                	test   %eax,%eax
+  803163:	78 21                	js     803186 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803165:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803168:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80316e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803170:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803173:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80317a:	83 ec 0c             	sub    $0xc,%esp
+  80317d:	50                   	push   %eax
+  80317e:	e8 0c ee ff ff       	call   801f8f <fd2num>
+  803183:	83 c4 10             	add    $0x10,%esp
+}
+  803186:	c9                   	leave
+  803187:	c3                   	ret
+
+00803188 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803188:	55                   	push   %ebp
+  803189:	89 e5                	mov    %esp,%ebp
+  80318b:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  80318e:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803195:	74 0a                	je     8031a1 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803197:	8b 45 08             	mov    0x8(%ebp),%eax
+  80319a:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80319f:	c9                   	leave
+  8031a0:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8031a1:	83 ec 04             	sub    $0x4,%esp
+  8031a4:	6a 07                	push   $0x7
+  8031a6:	68 00 f0 bf ee       	push   $0xeebff000
+  8031ab:	6a 00                	push   $0x0
+  8031ad:	e8 5f dc ff ff       	call   800e11 <sys_page_alloc>
+  8031b2:	83 c4 10             	add    $0x10,%esp
+  8031b5:	85 c0                	test   %eax,%eax
+  8031b7:	78 14                	js     8031cd <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8031b9:	83 ec 08             	sub    $0x8,%esp
+  8031bc:	68 ef 31 80 00       	push   $0x8031ef
+  8031c1:	6a 00                	push   $0x0
+  8031c3:	e8 65 de ff ff       	call   80102d <sys_env_set_pgfault_upcall>
+  8031c8:	83 c4 10             	add    $0x10,%esp
+  8031cb:	eb ca                	jmp    803197 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8031cd:	83 ec 08             	sub    $0x8,%esp
+  8031d0:	50                   	push   %eax
+  8031d1:	68 02 3a 80 00       	push   $0x803a02
+  8031d6:	e8 f6 d0 ff ff       	call   8002d1 <cprintf>
+			panic("set_pgfault_handler error");
+  8031db:	83 c4 0c             	add    $0xc,%esp
+  8031de:	68 0d 3a 80 00       	push   $0x803a0d
+  8031e3:	6a 24                	push   $0x24
+  8031e5:	68 27 3a 80 00       	push   $0x803a27
+  8031ea:	e8 07 d0 ff ff       	call   8001f6 <_panic>
+
+008031ef <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8031ef:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8031f0:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8031f5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8031f7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8031fa:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  8031fe:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803201:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803205:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803207:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  80320b:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  80320c:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803210:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803211:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803212:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803216:	c3                   	ret
+
+00803217 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  803217:	55                   	push   %ebp
+  803218:	89 e5                	mov    %esp,%ebp
+  80321a:	56                   	push   %esi
+  80321b:	53                   	push   %ebx
+  80321c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80321f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803222:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803225:	85 c0                	test   %eax,%eax
+  803227:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80322c:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  80322f:	83 ec 08             	sub    $0x8,%esp
+  803232:	ff 75 14             	push   0x14(%ebp)
+  803235:	50                   	push   %eax
+  803236:	e8 e7 df ff ff       	call   801222 <sys_ipc_recv_until>
+  80323b:	83 c4 10             	add    $0x10,%esp
+  80323e:	85 c0                	test   %eax,%eax
+  803240:	78 61                	js     8032a3 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  803242:	85 f6                	test   %esi,%esi
+  803244:	74 1c                	je     803262 <ipc_recv_until+0x4b>
+  803246:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803248:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80324d:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803253:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803258:	76 5f                	jbe    8032b9 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  80325a:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803260:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803262:	85 db                	test   %ebx,%ebx
+  803264:	74 1c                	je     803282 <ipc_recv_until+0x6b>
+  803266:	89 e0                	mov    %esp,%eax
+  803268:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80326d:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803273:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803278:	76 50                	jbe    8032ca <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80327a:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803280:	89 03                	mov    %eax,(%ebx)
+  803282:	89 e0                	mov    %esp,%eax
+  803284:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803289:	8b 15 0c 50 80 00    	mov    0x80500c,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80328f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803294:	76 45                	jbe    8032db <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803296:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80329c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80329f:	5b                   	pop    %ebx
+  8032a0:	5e                   	pop    %esi
+  8032a1:	5d                   	pop    %ebp
+  8032a2:	c3                   	ret
+		if (from_env_store)
+  8032a3:	85 f6                	test   %esi,%esi
+  8032a5:	74 06                	je     8032ad <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  8032a7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8032ad:	85 db                	test   %ebx,%ebx
+  8032af:	74 eb                	je     80329c <ipc_recv_until+0x85>
+			*perm_store = 0;
+  8032b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8032b7:	eb e3                	jmp    80329c <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8032b9:	c1 e8 10             	shr    $0x10,%eax
+  8032bc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8032c2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8032c8:	eb 90                	jmp    80325a <ipc_recv_until+0x43>
+  8032ca:	c1 e8 10             	shr    $0x10,%eax
+  8032cd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8032d3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8032d9:	eb 9f                	jmp    80327a <ipc_recv_until+0x63>
+  8032db:	c1 e8 10             	shr    $0x10,%eax
+  8032de:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8032e4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8032ea:	eb aa                	jmp    803296 <ipc_recv_until+0x7f>
+
+008032ec <ipc_recv>:
+{
+  8032ec:	55                   	push   %ebp
+  8032ed:	89 e5                	mov    %esp,%ebp
+  8032ef:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8032f2:	6a 00                	push   $0x0
+  8032f4:	ff 75 10             	push   0x10(%ebp)
+  8032f7:	ff 75 0c             	push   0xc(%ebp)
+  8032fa:	ff 75 08             	push   0x8(%ebp)
+  8032fd:	e8 15 ff ff ff       	call   803217 <ipc_recv_until>
+}
+  803302:	c9                   	leave
+  803303:	c3                   	ret
+
+00803304 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803304:	55                   	push   %ebp
+  803305:	89 e5                	mov    %esp,%ebp
+  803307:	57                   	push   %edi
+  803308:	56                   	push   %esi
+  803309:	53                   	push   %ebx
+  80330a:	83 ec 0c             	sub    $0xc,%esp
+  80330d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803310:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803313:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803316:	85 db                	test   %ebx,%ebx
+  803318:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80331d:	0f 44 d8             	cmove  %eax,%ebx
+  803320:	eb 05                	jmp    803327 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803322:	e8 a4 da ff ff       	call   800dcb <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  803327:	ff 75 14             	push   0x14(%ebp)
+  80332a:	53                   	push   %ebx
+  80332b:	56                   	push   %esi
+  80332c:	57                   	push   %edi
+  80332d:	e8 3c de ff ff       	call   80116e <sys_ipc_try_send>
+  803332:	83 c4 10             	add    $0x10,%esp
+  803335:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803338:	74 e8                	je     803322 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  80333a:	85 c0                	test   %eax,%eax
+  80333c:	78 08                	js     803346 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  80333e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803341:	5b                   	pop    %ebx
+  803342:	5e                   	pop    %esi
+  803343:	5f                   	pop    %edi
+  803344:	5d                   	pop    %ebp
+  803345:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  803346:	50                   	push   %eax
+  803347:	68 35 3a 80 00       	push   $0x803a35
+  80334c:	6a 4f                	push   $0x4f
+  80334e:	68 48 3a 80 00       	push   $0x803a48
+  803353:	e8 9e ce ff ff       	call   8001f6 <_panic>
+
+00803358 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803358:	55                   	push   %ebp
+  803359:	89 e5                	mov    %esp,%ebp
+  80335b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80335e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803363:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  803369:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80336f:	8b 52 50             	mov    0x50(%edx),%edx
+  803372:	39 ca                	cmp    %ecx,%edx
+  803374:	74 11                	je     803387 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803376:	83 c0 01             	add    $0x1,%eax
+  803379:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80337e:	75 e3                	jne    803363 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803380:	b8 00 00 00 00       	mov    $0x0,%eax
+  803385:	eb 0e                	jmp    803395 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803387:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80338d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803392:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803395:	5d                   	pop    %ebp
+  803396:	c3                   	ret
+
+00803397 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803397:	55                   	push   %ebp
+  803398:	89 e5                	mov    %esp,%ebp
+  80339a:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80339d:	89 c2                	mov    %eax,%edx
+  80339f:	c1 ea 16             	shr    $0x16,%edx
+  8033a2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8033a9:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8033ae:	f6 c1 01             	test   $0x1,%cl
+  8033b1:	74 1a                	je     8033cd <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  8033b3:	c1 e8 0c             	shr    $0xc,%eax
+  8033b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8033bd:	a8 01                	test   $0x1,%al
+  8033bf:	74 0c                	je     8033cd <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8033c1:	c1 e8 0c             	shr    $0xc,%eax
+  8033c4:	c1 e0 04             	shl    $0x4,%eax
+  8033c7:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8033cd:	89 d0                	mov    %edx,%eax
+  8033cf:	5d                   	pop    %ebp
+  8033d0:	c3                   	ret
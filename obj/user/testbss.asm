@@ -0,0 +1,6211 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+	int i;
+
+	cprintf("Making sure bss works right...\n");
+  800039:	68 00 2c 80 00       	push   $0x802c00
+  80003e:	e8 38 02 00 00       	call   80027b <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAYSIZE; i++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != 0)
+  80004b:	83 3c 85 20 50 80 00 	cmpl   $0x0,0x805020(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+			panic("bigarray[%d] isn't cleared!\n", i);
+	for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+		bigarray[i] = i;
+  800064:	89 04 85 20 50 80 00 	mov    %eax,0x805020(,%eax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != i)
+  80007a:	39 04 85 20 50 80 00 	cmp    %eax,0x805020(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+
+	cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 48 2c 80 00       	push   $0x802c48
+  800095:	e8 e1 01 00 00       	call   80027b <cprintf>
+	bigarray[ARRAYSIZE+1024] = 0;
+  80009a:	c7 05 20 60 c0 00 00 	movl   $0x0,0xc06020
+  8000a1:	00 00 00 
+	panic("SHOULD HAVE TRAPPED!!!");
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 a7 2c 80 00       	push   $0x802ca7
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 98 2c 80 00       	push   $0x802c98
+  8000b3:	e8 e8 00 00 00       	call   8001a0 <_panic>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 7b 2c 80 00       	push   $0x802c7b
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 98 2c 80 00       	push   $0x802c98
+  8000c5:	e8 d6 00 00 00       	call   8001a0 <_panic>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 20 2c 80 00       	push   $0x802c20
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 98 2c 80 00       	push   $0x802c98
+  8000d7:	e8 c4 00 00 00       	call   8001a0 <_panic>
+
+008000dc <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	57                   	push   %edi
+  8000e0:	56                   	push   %esi
+  8000e1:	53                   	push   %ebx
+  8000e2:	83 ec 0c             	sub    $0xc,%esp
+  8000e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8000e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8000eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000f0:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8000f2:	c1 ea 0b             	shr    $0xb,%edx
+  8000f5:	83 f2 01             	xor    $0x1,%edx
+  8000f8:	83 e2 01             	and    $0x1,%edx
+  8000fb:	88 15 24 50 c0 00    	mov    %dl,0xc05024
+
+	mainenv = NULL;
+  800101:	c7 05 20 50 c0 00 00 	movl   $0x0,0xc05020
+  800108:	00 00 00 
+	envid = sys_getenvid();
+  80010b:	e8 1f 0c 00 00       	call   800d2f <sys_getenvid>
+  800110:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800117:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80011d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800123:	8b 52 48             	mov    0x48(%edx),%edx
+  800126:	39 ca                	cmp    %ecx,%edx
+  800128:	74 27                	je     800151 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80012a:	83 c0 01             	add    $0x1,%eax
+  80012d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800132:	75 e3                	jne    800117 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800134:	83 3d 20 50 c0 00 00 	cmpl   $0x0,0xc05020
+  80013b:	75 24                	jne    800161 <libmain+0x85>
+		panic("libmain can't find the environment");
+  80013d:	83 ec 04             	sub    $0x4,%esp
+  800140:	68 c0 2c 80 00       	push   $0x802cc0
+  800145:	6a 23                	push   $0x23
+  800147:	68 e3 2c 80 00       	push   $0x802ce3
+  80014c:	e8 4f 00 00 00       	call   8001a0 <_panic>
+			mainenv = &envs[i];
+  800151:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800157:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80015c:	a3 20 50 c0 00       	mov    %eax,0xc05020
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800161:	85 ff                	test   %edi,%edi
+  800163:	7e 07                	jle    80016c <libmain+0x90>
+		binaryname = argv[0];
+  800165:	8b 06                	mov    (%esi),%eax
+  800167:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80016c:	83 ec 08             	sub    $0x8,%esp
+  80016f:	56                   	push   %esi
+  800170:	57                   	push   %edi
+  800171:	e8 bd fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800176:	e8 0b 00 00 00       	call   800186 <exit>
+}
+  80017b:	83 c4 10             	add    $0x10,%esp
+  80017e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+
+00800186 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800186:	55                   	push   %ebp
+  800187:	89 e5                	mov    %esp,%ebp
+  800189:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80018c:	e8 94 18 00 00       	call   801a25 <close_all>
+	sys_env_destroy(0);
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	6a 00                	push   $0x0
+  800196:	e8 2b 0b 00 00       	call   800cc6 <sys_env_destroy>
+}
+  80019b:	83 c4 10             	add    $0x10,%esp
+  80019e:	c9                   	leave
+  80019f:	c3                   	ret
+
+008001a0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	56                   	push   %esi
+  8001a4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001a5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001a8:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001ae:	e8 7c 0b 00 00       	call   800d2f <sys_getenvid>
+  8001b3:	83 ec 0c             	sub    $0xc,%esp
+  8001b6:	ff 75 0c             	push   0xc(%ebp)
+  8001b9:	ff 75 08             	push   0x8(%ebp)
+  8001bc:	56                   	push   %esi
+  8001bd:	50                   	push   %eax
+  8001be:	68 fc 2c 80 00       	push   $0x802cfc
+  8001c3:	e8 b3 00 00 00       	call   80027b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001c8:	83 c4 18             	add    $0x18,%esp
+  8001cb:	53                   	push   %ebx
+  8001cc:	ff 75 10             	push   0x10(%ebp)
+  8001cf:	e8 56 00 00 00       	call   80022a <vcprintf>
+	cprintf("\n");
+  8001d4:	c7 04 24 96 2c 80 00 	movl   $0x802c96,(%esp)
+  8001db:	e8 9b 00 00 00       	call   80027b <cprintf>
+  8001e0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001e3:	cc                   	int3
+	while (1)
+  8001e4:	eb fd                	jmp    8001e3 <_panic+0x43>
+
+008001e6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001e6:	55                   	push   %ebp
+  8001e7:	89 e5                	mov    %esp,%ebp
+  8001e9:	53                   	push   %ebx
+  8001ea:	83 ec 04             	sub    $0x4,%esp
+  8001ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001f0:	8b 13                	mov    (%ebx),%edx
+  8001f2:	8d 42 01             	lea    0x1(%edx),%eax
+  8001f5:	89 03                	mov    %eax,(%ebx)
+  8001f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001fa:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001fe:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800203:	74 09                	je     80020e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800205:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800209:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80020c:	c9                   	leave
+  80020d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80020e:	83 ec 08             	sub    $0x8,%esp
+  800211:	68 ff 00 00 00       	push   $0xff
+  800216:	8d 43 08             	lea    0x8(%ebx),%eax
+  800219:	50                   	push   %eax
+  80021a:	e8 1d 0a 00 00       	call   800c3c <sys_cputs>
+		b->idx = 0;
+  80021f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800225:	83 c4 10             	add    $0x10,%esp
+  800228:	eb db                	jmp    800205 <putch+0x1f>
+
+0080022a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80022a:	55                   	push   %ebp
+  80022b:	89 e5                	mov    %esp,%ebp
+  80022d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800233:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80023a:	00 00 00 
+	b.cnt = 0;
+  80023d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800244:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800247:	ff 75 0c             	push   0xc(%ebp)
+  80024a:	ff 75 08             	push   0x8(%ebp)
+  80024d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800253:	50                   	push   %eax
+  800254:	68 e6 01 80 00       	push   $0x8001e6
+  800259:	e8 fb 00 00 00       	call   800359 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80025e:	83 c4 08             	add    $0x8,%esp
+  800261:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800267:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	e8 c9 09 00 00       	call   800c3c <sys_cputs>
+
+	return b.cnt;
+}
+  800273:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800279:	c9                   	leave
+  80027a:	c3                   	ret
+
+0080027b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80027b:	55                   	push   %ebp
+  80027c:	89 e5                	mov    %esp,%ebp
+  80027e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800281:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800284:	50                   	push   %eax
+  800285:	ff 75 08             	push   0x8(%ebp)
+  800288:	e8 9d ff ff ff       	call   80022a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80028d:	c9                   	leave
+  80028e:	c3                   	ret
+
+0080028f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80028f:	55                   	push   %ebp
+  800290:	89 e5                	mov    %esp,%ebp
+  800292:	57                   	push   %edi
+  800293:	56                   	push   %esi
+  800294:	53                   	push   %ebx
+  800295:	83 ec 1c             	sub    $0x1c,%esp
+  800298:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80029b:	89 d6                	mov    %edx,%esi
+  80029d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002a3:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002a6:	73 0b                	jae    8002b3 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002a8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002ab:	c1 e7 08             	shl    $0x8,%edi
+  8002ae:	0b 7d 10             	or     0x10(%ebp),%edi
+  8002b1:	eb 36                	jmp    8002e9 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8002b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002bb:	f7 75 08             	divl   0x8(%ebp)
+  8002be:	89 c1                	mov    %eax,%ecx
+  8002c0:	ff 75 14             	push   0x14(%ebp)
+  8002c3:	ff 75 10             	push   0x10(%ebp)
+  8002c6:	83 eb 01             	sub    $0x1,%ebx
+  8002c9:	53                   	push   %ebx
+  8002ca:	ff 75 08             	push   0x8(%ebp)
+  8002cd:	89 f2                	mov    %esi,%edx
+  8002cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002d2:	e8 b8 ff ff ff       	call   80028f <printnum>
+  8002d7:	83 c4 10             	add    $0x10,%esp
+  8002da:	eb 14                	jmp    8002f0 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002dc:	83 ec 08             	sub    $0x8,%esp
+  8002df:	56                   	push   %esi
+  8002e0:	57                   	push   %edi
+  8002e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002e4:	ff d0                	call   *%eax
+  8002e6:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002e9:	83 eb 01             	sub    $0x1,%ebx
+  8002ec:	85 db                	test   %ebx,%ebx
+  8002ee:	7f ec                	jg     8002dc <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8002f0:	83 ec 08             	sub    $0x8,%esp
+  8002f3:	56                   	push   %esi
+  8002f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002fc:	f7 75 08             	divl   0x8(%ebp)
+  8002ff:	0f be 92 1f 2d 80 00 	movsbl 0x802d1f(%edx),%edx
+  800306:	8b 45 14             	mov    0x14(%ebp),%eax
+  800309:	c1 e0 08             	shl    $0x8,%eax
+  80030c:	09 d0                	or     %edx,%eax
+  80030e:	50                   	push   %eax
+  80030f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800312:	ff d0                	call   *%eax
+}
+  800314:	83 c4 10             	add    $0x10,%esp
+  800317:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031a:	5b                   	pop    %ebx
+  80031b:	5e                   	pop    %esi
+  80031c:	5f                   	pop    %edi
+  80031d:	5d                   	pop    %ebp
+  80031e:	c3                   	ret
+
+0080031f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80031f:	55                   	push   %ebp
+  800320:	89 e5                	mov    %esp,%ebp
+  800322:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800325:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800329:	8b 10                	mov    (%eax),%edx
+  80032b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80032e:	73 0a                	jae    80033a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800330:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800333:	89 08                	mov    %ecx,(%eax)
+  800335:	8b 45 08             	mov    0x8(%ebp),%eax
+  800338:	88 02                	mov    %al,(%edx)
+}
+  80033a:	5d                   	pop    %ebp
+  80033b:	c3                   	ret
+
+0080033c <printfmt>:
+{
+  80033c:	55                   	push   %ebp
+  80033d:	89 e5                	mov    %esp,%ebp
+  80033f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800342:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800345:	50                   	push   %eax
+  800346:	ff 75 10             	push   0x10(%ebp)
+  800349:	ff 75 0c             	push   0xc(%ebp)
+  80034c:	ff 75 08             	push   0x8(%ebp)
+  80034f:	e8 05 00 00 00       	call   800359 <vprintfmt>
+}
+  800354:	83 c4 10             	add    $0x10,%esp
+  800357:	c9                   	leave
+  800358:	c3                   	ret
+
+00800359 <vprintfmt>:
+{
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	57                   	push   %edi
+  80035d:	56                   	push   %esi
+  80035e:	53                   	push   %ebx
+  80035f:	83 ec 3c             	sub    $0x3c,%esp
+  800362:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800365:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800368:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80036f:	eb 16                	jmp    800387 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800371:	83 ec 08             	sub    $0x8,%esp
+  800374:	ff 75 0c             	push   0xc(%ebp)
+  800377:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80037a:	c1 e2 08             	shl    $0x8,%edx
+  80037d:	09 d0                	or     %edx,%eax
+  80037f:	50                   	push   %eax
+  800380:	ff d7                	call   *%edi
+  800382:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800385:	89 de                	mov    %ebx,%esi
+  800387:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80038a:	0f b6 06             	movzbl (%esi),%eax
+  80038d:	83 f8 25             	cmp    $0x25,%eax
+  800390:	74 0c                	je     80039e <vprintfmt+0x45>
+			if (ch == '\0')
+  800392:	85 c0                	test   %eax,%eax
+  800394:	75 db                	jne    800371 <vprintfmt+0x18>
+}
+  800396:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800399:	5b                   	pop    %ebx
+  80039a:	5e                   	pop    %esi
+  80039b:	5f                   	pop    %edi
+  80039c:	5d                   	pop    %ebp
+  80039d:	c3                   	ret
+		padc = ' ';
+  80039e:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003a2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003a9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003b0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003bf:	0f b6 13             	movzbl (%ebx),%edx
+  8003c2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003c5:	3c 55                	cmp    $0x55,%al
+  8003c7:	0f 87 2c 04 00 00    	ja     8007f9 <vprintfmt+0x4a0>
+  8003cd:	0f b6 c0             	movzbl %al,%eax
+  8003d0:	ff 24 85 60 2e 80 00 	jmp    *0x802e60(,%eax,4)
+  8003d7:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003d9:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003dd:	eb dd                	jmp    8003bc <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003df:	89 f3                	mov    %esi,%ebx
+  8003e1:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003e5:	eb d5                	jmp    8003bc <vprintfmt+0x63>
+  8003e7:	0f b6 d2             	movzbl %dl,%edx
+  8003ea:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8003ec:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8003f1:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003f4:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003f8:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003fb:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003fe:	83 fe 09             	cmp    $0x9,%esi
+  800401:	0f 87 8a 00 00 00    	ja     800491 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800407:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80040a:	eb e5                	jmp    8003f1 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80040c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040f:	8b 00                	mov    (%eax),%eax
+  800411:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800414:	8b 45 14             	mov    0x14(%ebp),%eax
+  800417:	8d 40 04             	lea    0x4(%eax),%eax
+  80041a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80041d:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80041f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800423:	79 97                	jns    8003bc <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800425:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800428:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800432:	eb 88                	jmp    8003bc <vprintfmt+0x63>
+			if (width < 0)
+  800434:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800437:	85 db                	test   %ebx,%ebx
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	0f 49 c3             	cmovns %ebx,%eax
+  800441:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800444:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800446:	e9 71 ff ff ff       	jmp    8003bc <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80044b:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80044d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800454:	e9 63 ff ff ff       	jmp    8003bc <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800459:	8d 73 02             	lea    0x2(%ebx),%esi
+  80045c:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800460:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800467:	3c 67                	cmp    $0x67,%al
+  800469:	0f 84 18 ff ff ff    	je     800387 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80046f:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800476:	3c 72                	cmp    $0x72,%al
+  800478:	0f 84 09 ff ff ff    	je     800387 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80047e:	3c 62                	cmp    $0x62,%al
+  800480:	0f 94 c0             	sete   %al
+  800483:	0f b6 c0             	movzbl %al,%eax
+  800486:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800489:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80048c:	e9 f6 fe ff ff       	jmp    800387 <vprintfmt+0x2e>
+  800491:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800494:	eb 89                	jmp    80041f <vprintfmt+0xc6>
+			lflag++;
+  800496:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800499:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80049b:	e9 1c ff ff ff       	jmp    8003bc <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a3:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004a6:	83 ec 08             	sub    $0x8,%esp
+  8004a9:	ff 75 0c             	push   0xc(%ebp)
+  8004ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004af:	c1 e0 08             	shl    $0x8,%eax
+  8004b2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8004b5:	0b 01                	or     (%ecx),%eax
+  8004b7:	50                   	push   %eax
+  8004b8:	ff d7                	call   *%edi
+			break;
+  8004ba:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004bd:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004c0:	e9 c2 fe ff ff       	jmp    800387 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c8:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004cb:	8b 10                	mov    (%eax),%edx
+  8004cd:	89 d0                	mov    %edx,%eax
+  8004cf:	f7 d8                	neg    %eax
+  8004d1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004d4:	83 f8 12             	cmp    $0x12,%eax
+  8004d7:	7f 25                	jg     8004fe <vprintfmt+0x1a5>
+  8004d9:	8b 14 85 c0 2f 80 00 	mov    0x802fc0(,%eax,4),%edx
+  8004e0:	85 d2                	test   %edx,%edx
+  8004e2:	74 1a                	je     8004fe <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004e4:	52                   	push   %edx
+  8004e5:	68 01 31 80 00       	push   $0x803101
+  8004ea:	ff 75 0c             	push   0xc(%ebp)
+  8004ed:	57                   	push   %edi
+  8004ee:	e8 49 fe ff ff       	call   80033c <printfmt>
+  8004f3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004f6:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8004f9:	e9 89 fe ff ff       	jmp    800387 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004fe:	50                   	push   %eax
+  8004ff:	68 37 2d 80 00       	push   $0x802d37
+  800504:	ff 75 0c             	push   0xc(%ebp)
+  800507:	57                   	push   %edi
+  800508:	e8 2f fe ff ff       	call   80033c <printfmt>
+  80050d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800510:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800513:	e9 6f fe ff ff       	jmp    800387 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	83 c0 04             	add    $0x4,%eax
+  80051e:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800521:	8b 45 14             	mov    0x14(%ebp),%eax
+  800524:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800526:	85 c9                	test   %ecx,%ecx
+  800528:	b8 30 2d 80 00       	mov    $0x802d30,%eax
+  80052d:	0f 45 c1             	cmovne %ecx,%eax
+  800530:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800533:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800537:	7e 06                	jle    80053f <vprintfmt+0x1e6>
+  800539:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80053d:	75 1a                	jne    800559 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80053f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800542:	c1 e0 08             	shl    $0x8,%eax
+  800545:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800548:	83 c8 3f             	or     $0x3f,%eax
+  80054b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80054e:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800551:	89 75 10             	mov    %esi,0x10(%ebp)
+  800554:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800557:	eb 6d                	jmp    8005c6 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800559:	83 ec 08             	sub    $0x8,%esp
+  80055c:	ff 75 d0             	push   -0x30(%ebp)
+  80055f:	ff 75 c8             	push   -0x38(%ebp)
+  800562:	e8 39 03 00 00       	call   8008a0 <strnlen>
+  800567:	89 c2                	mov    %eax,%edx
+  800569:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80056c:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80056e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800571:	c1 e1 08             	shl    $0x8,%ecx
+  800574:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800578:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80057a:	83 c4 10             	add    $0x10,%esp
+  80057d:	89 c3                	mov    %eax,%ebx
+  80057f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800582:	89 75 10             	mov    %esi,0x10(%ebp)
+  800585:	89 ce                	mov    %ecx,%esi
+  800587:	eb 0f                	jmp    800598 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800589:	83 ec 08             	sub    $0x8,%esp
+  80058c:	ff 75 0c             	push   0xc(%ebp)
+  80058f:	56                   	push   %esi
+  800590:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800592:	83 eb 01             	sub    $0x1,%ebx
+  800595:	83 c4 10             	add    $0x10,%esp
+  800598:	85 db                	test   %ebx,%ebx
+  80059a:	7f ed                	jg     800589 <vprintfmt+0x230>
+  80059c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80059f:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005a2:	85 c0                	test   %eax,%eax
+  8005a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a9:	0f 49 d0             	cmovns %eax,%edx
+  8005ac:	29 d0                	sub    %edx,%eax
+  8005ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b1:	eb 8c                	jmp    80053f <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8005b3:	83 ec 08             	sub    $0x8,%esp
+  8005b6:	ff 75 0c             	push   0xc(%ebp)
+  8005b9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005bc:	09 c2                	or     %eax,%edx
+  8005be:	52                   	push   %edx
+  8005bf:	ff d7                	call   *%edi
+  8005c1:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005c4:	89 d9                	mov    %ebx,%ecx
+  8005c6:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005c9:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005cd:	0f be d0             	movsbl %al,%edx
+  8005d0:	85 d2                	test   %edx,%edx
+  8005d2:	74 2a                	je     8005fe <vprintfmt+0x2a5>
+  8005d4:	85 f6                	test   %esi,%esi
+  8005d6:	78 05                	js     8005dd <vprintfmt+0x284>
+  8005d8:	83 ee 01             	sub    $0x1,%esi
+  8005db:	78 3b                	js     800618 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005dd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e1:	74 d0                	je     8005b3 <vprintfmt+0x25a>
+  8005e3:	0f be c0             	movsbl %al,%eax
+  8005e6:	83 e8 20             	sub    $0x20,%eax
+  8005e9:	83 f8 5e             	cmp    $0x5e,%eax
+  8005ec:	76 c5                	jbe    8005b3 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8005ee:	83 ec 08             	sub    $0x8,%esp
+  8005f1:	ff 75 0c             	push   0xc(%ebp)
+  8005f4:	ff 75 cc             	push   -0x34(%ebp)
+  8005f7:	ff d7                	call   *%edi
+  8005f9:	83 c4 10             	add    $0x10,%esp
+  8005fc:	eb c6                	jmp    8005c4 <vprintfmt+0x26b>
+  8005fe:	8b 75 10             	mov    0x10(%ebp),%esi
+  800601:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800604:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800607:	01 c3                	add    %eax,%ebx
+  800609:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80060b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80060e:	83 c8 20             	or     $0x20,%eax
+  800611:	89 75 10             	mov    %esi,0x10(%ebp)
+  800614:	89 c6                	mov    %eax,%esi
+  800616:	eb 14                	jmp    80062c <vprintfmt+0x2d3>
+  800618:	8b 75 10             	mov    0x10(%ebp),%esi
+  80061b:	eb e4                	jmp    800601 <vprintfmt+0x2a8>
+  80061d:	83 ec 08             	sub    $0x8,%esp
+  800620:	ff 75 0c             	push   0xc(%ebp)
+  800623:	56                   	push   %esi
+  800624:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800626:	83 eb 01             	sub    $0x1,%ebx
+  800629:	83 c4 10             	add    $0x10,%esp
+  80062c:	85 db                	test   %ebx,%ebx
+  80062e:	7f ed                	jg     80061d <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800630:	8b 75 10             	mov    0x10(%ebp),%esi
+  800633:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+  800639:	e9 49 fd ff ff       	jmp    800387 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80063e:	83 f9 01             	cmp    $0x1,%ecx
+  800641:	7f 1f                	jg     800662 <vprintfmt+0x309>
+	else if (lflag)
+  800643:	85 c9                	test   %ecx,%ecx
+  800645:	74 69                	je     8006b0 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 00                	mov    (%eax),%eax
+  80064c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064f:	89 c1                	mov    %eax,%ecx
+  800651:	c1 f9 1f             	sar    $0x1f,%ecx
+  800654:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800660:	eb 17                	jmp    800679 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 50 04             	mov    0x4(%eax),%edx
+  800668:	8b 00                	mov    (%eax),%eax
+  80066a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80066d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8d 40 08             	lea    0x8(%eax),%eax
+  800676:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800679:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80067c:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80067f:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800684:	85 db                	test   %ebx,%ebx
+  800686:	0f 89 f6 00 00 00    	jns    800782 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80068c:	83 ec 08             	sub    $0x8,%esp
+  80068f:	ff 75 0c             	push   0xc(%ebp)
+  800692:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800695:	c1 e0 08             	shl    $0x8,%eax
+  800698:	83 c8 2d             	or     $0x2d,%eax
+  80069b:	50                   	push   %eax
+  80069c:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80069e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006a1:	f7 d9                	neg    %ecx
+  8006a3:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006ab:	e9 d2 00 00 00       	jmp    800782 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8b 00                	mov    (%eax),%eax
+  8006b5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b8:	89 c1                	mov    %eax,%ecx
+  8006ba:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006bd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c9:	eb ae                	jmp    800679 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006cb:	83 f9 01             	cmp    $0x1,%ecx
+  8006ce:	7f 19                	jg     8006e9 <vprintfmt+0x390>
+	else if (lflag)
+  8006d0:	85 c9                	test   %ecx,%ecx
+  8006d2:	74 2a                	je     8006fe <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d7:	8b 08                	mov    (%eax),%ecx
+  8006d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006df:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006e4:	e9 99 00 00 00       	jmp    800782 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ec:	8b 08                	mov    (%eax),%ecx
+  8006ee:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8006f9:	e9 84 00 00 00       	jmp    800782 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 08                	mov    (%eax),%ecx
+  800703:	8d 40 04             	lea    0x4(%eax),%eax
+  800706:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800709:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  80070e:	eb 72                	jmp    800782 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800710:	83 f9 01             	cmp    $0x1,%ecx
+  800713:	7f 16                	jg     80072b <vprintfmt+0x3d2>
+	else if (lflag)
+  800715:	85 c9                	test   %ecx,%ecx
+  800717:	74 24                	je     80073d <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 08                	mov    (%eax),%ecx
+  80071e:	8d 40 04             	lea    0x4(%eax),%eax
+  800721:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800724:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800729:	eb 57                	jmp    800782 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80072b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072e:	8b 08                	mov    (%eax),%ecx
+  800730:	8d 40 08             	lea    0x8(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800736:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80073b:	eb 45                	jmp    800782 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80073d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800740:	8b 08                	mov    (%eax),%ecx
+  800742:	8d 40 04             	lea    0x4(%eax),%eax
+  800745:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800748:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80074d:	eb 33                	jmp    800782 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  80074f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800752:	c1 e3 08             	shl    $0x8,%ebx
+  800755:	83 ec 08             	sub    $0x8,%esp
+  800758:	ff 75 0c             	push   0xc(%ebp)
+  80075b:	89 d8                	mov    %ebx,%eax
+  80075d:	83 c8 30             	or     $0x30,%eax
+  800760:	50                   	push   %eax
+  800761:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800763:	83 c4 08             	add    $0x8,%esp
+  800766:	ff 75 0c             	push   0xc(%ebp)
+  800769:	83 cb 78             	or     $0x78,%ebx
+  80076c:	53                   	push   %ebx
+  80076d:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800774:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800777:	8d 40 04             	lea    0x4(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80077d:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800782:	ff 75 e4             	push   -0x1c(%ebp)
+  800785:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800789:	52                   	push   %edx
+  80078a:	ff 75 e0             	push   -0x20(%ebp)
+  80078d:	50                   	push   %eax
+  80078e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800791:	89 f8                	mov    %edi,%eax
+  800793:	e8 f7 fa ff ff       	call   80028f <printnum>
+			break;
+  800798:	83 c4 10             	add    $0x10,%esp
+  80079b:	e9 e7 fb ff ff       	jmp    800387 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007a0:	83 f9 01             	cmp    $0x1,%ecx
+  8007a3:	7f 16                	jg     8007bb <vprintfmt+0x462>
+	else if (lflag)
+  8007a5:	85 c9                	test   %ecx,%ecx
+  8007a7:	74 24                	je     8007cd <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8b 08                	mov    (%eax),%ecx
+  8007ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b4:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8007b9:	eb c7                	jmp    800782 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007be:	8b 08                	mov    (%eax),%ecx
+  8007c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c6:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007cb:	eb b5                	jmp    800782 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 08                	mov    (%eax),%ecx
+  8007d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d8:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007dd:	eb a3                	jmp    800782 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	ff 75 0c             	push   0xc(%ebp)
+  8007e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007e8:	c1 e0 08             	shl    $0x8,%eax
+  8007eb:	83 c8 25             	or     $0x25,%eax
+  8007ee:	50                   	push   %eax
+  8007ef:	ff d7                	call   *%edi
+			break;
+  8007f1:	83 c4 10             	add    $0x10,%esp
+  8007f4:	e9 8e fb ff ff       	jmp    800387 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8007f9:	83 ec 08             	sub    $0x8,%esp
+  8007fc:	ff 75 0c             	push   0xc(%ebp)
+  8007ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800802:	c1 e0 08             	shl    $0x8,%eax
+  800805:	83 c8 25             	or     $0x25,%eax
+  800808:	50                   	push   %eax
+  800809:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80080b:	83 c4 10             	add    $0x10,%esp
+  80080e:	89 de                	mov    %ebx,%esi
+  800810:	eb 03                	jmp    800815 <vprintfmt+0x4bc>
+  800812:	83 ee 01             	sub    $0x1,%esi
+  800815:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800819:	75 f7                	jne    800812 <vprintfmt+0x4b9>
+  80081b:	e9 67 fb ff ff       	jmp    800387 <vprintfmt+0x2e>
+
+00800820 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800820:	55                   	push   %ebp
+  800821:	89 e5                	mov    %esp,%ebp
+  800823:	83 ec 18             	sub    $0x18,%esp
+  800826:	8b 45 08             	mov    0x8(%ebp),%eax
+  800829:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80082c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80082f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800833:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800836:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80083d:	85 c0                	test   %eax,%eax
+  80083f:	74 26                	je     800867 <vsnprintf+0x47>
+  800841:	85 d2                	test   %edx,%edx
+  800843:	7e 22                	jle    800867 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800845:	ff 75 14             	push   0x14(%ebp)
+  800848:	ff 75 10             	push   0x10(%ebp)
+  80084b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80084e:	50                   	push   %eax
+  80084f:	68 1f 03 80 00       	push   $0x80031f
+  800854:	e8 00 fb ff ff       	call   800359 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800859:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80085c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80085f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800862:	83 c4 10             	add    $0x10,%esp
+}
+  800865:	c9                   	leave
+  800866:	c3                   	ret
+		return -E_INVAL;
+  800867:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80086c:	eb f7                	jmp    800865 <vsnprintf+0x45>
+
+0080086e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80086e:	55                   	push   %ebp
+  80086f:	89 e5                	mov    %esp,%ebp
+  800871:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800874:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800877:	50                   	push   %eax
+  800878:	ff 75 10             	push   0x10(%ebp)
+  80087b:	ff 75 0c             	push   0xc(%ebp)
+  80087e:	ff 75 08             	push   0x8(%ebp)
+  800881:	e8 9a ff ff ff       	call   800820 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800886:	c9                   	leave
+  800887:	c3                   	ret
+
+00800888 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80088e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800893:	eb 03                	jmp    800898 <strlen+0x10>
+		n++;
+  800895:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800898:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80089c:	75 f7                	jne    800895 <strlen+0xd>
+	return n;
+}
+  80089e:	5d                   	pop    %ebp
+  80089f:	c3                   	ret
+
+008008a0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008a0:	55                   	push   %ebp
+  8008a1:	89 e5                	mov    %esp,%ebp
+  8008a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	eb 03                	jmp    8008b3 <strnlen+0x13>
+		n++;
+  8008b0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b3:	39 d0                	cmp    %edx,%eax
+  8008b5:	74 08                	je     8008bf <strnlen+0x1f>
+  8008b7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008bb:	75 f3                	jne    8008b0 <strnlen+0x10>
+  8008bd:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008bf:	89 d0                	mov    %edx,%eax
+  8008c1:	5d                   	pop    %ebp
+  8008c2:	c3                   	ret
+
+008008c3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	53                   	push   %ebx
+  8008c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008d9:	83 c0 01             	add    $0x1,%eax
+  8008dc:	84 d2                	test   %dl,%dl
+  8008de:	75 f2                	jne    8008d2 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008e0:	89 c8                	mov    %ecx,%eax
+  8008e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e5:	c9                   	leave
+  8008e6:	c3                   	ret
+
+008008e7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008e7:	55                   	push   %ebp
+  8008e8:	89 e5                	mov    %esp,%ebp
+  8008ea:	53                   	push   %ebx
+  8008eb:	83 ec 10             	sub    $0x10,%esp
+  8008ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008f1:	53                   	push   %ebx
+  8008f2:	e8 91 ff ff ff       	call   800888 <strlen>
+  8008f7:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008fa:	ff 75 0c             	push   0xc(%ebp)
+  8008fd:	01 d8                	add    %ebx,%eax
+  8008ff:	50                   	push   %eax
+  800900:	e8 be ff ff ff       	call   8008c3 <strcpy>
+	return dst;
+}
+  800905:	89 d8                	mov    %ebx,%eax
+  800907:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090a:	c9                   	leave
+  80090b:	c3                   	ret
+
+0080090c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80090c:	55                   	push   %ebp
+  80090d:	89 e5                	mov    %esp,%ebp
+  80090f:	56                   	push   %esi
+  800910:	53                   	push   %ebx
+  800911:	8b 75 08             	mov    0x8(%ebp),%esi
+  800914:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800917:	89 f3                	mov    %esi,%ebx
+  800919:	03 5d 10             	add    0x10(%ebp),%ebx
+  80091c:	89 f0                	mov    %esi,%eax
+  80091e:	eb 0f                	jmp    80092f <strncpy+0x23>
+		*dst++ = *src;
+  800920:	83 c0 01             	add    $0x1,%eax
+  800923:	0f b6 0a             	movzbl (%edx),%ecx
+  800926:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800929:	80 f9 01             	cmp    $0x1,%cl
+  80092c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80092f:	39 d8                	cmp    %ebx,%eax
+  800931:	75 ed                	jne    800920 <strncpy+0x14>
+	}
+	return ret;
+}
+  800933:	89 f0                	mov    %esi,%eax
+  800935:	5b                   	pop    %ebx
+  800936:	5e                   	pop    %esi
+  800937:	5d                   	pop    %ebp
+  800938:	c3                   	ret
+
+00800939 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	56                   	push   %esi
+  80093d:	53                   	push   %ebx
+  80093e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800941:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800944:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800947:	89 f0                	mov    %esi,%eax
+  800949:	85 d2                	test   %edx,%edx
+  80094b:	74 21                	je     80096e <strlcpy+0x35>
+  80094d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800951:	89 f2                	mov    %esi,%edx
+  800953:	eb 09                	jmp    80095e <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800955:	83 c1 01             	add    $0x1,%ecx
+  800958:	83 c2 01             	add    $0x1,%edx
+  80095b:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80095e:	39 c2                	cmp    %eax,%edx
+  800960:	74 09                	je     80096b <strlcpy+0x32>
+  800962:	0f b6 19             	movzbl (%ecx),%ebx
+  800965:	84 db                	test   %bl,%bl
+  800967:	75 ec                	jne    800955 <strlcpy+0x1c>
+  800969:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80096b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80096e:	29 f0                	sub    %esi,%eax
+}
+  800970:	5b                   	pop    %ebx
+  800971:	5e                   	pop    %esi
+  800972:	5d                   	pop    %ebp
+  800973:	c3                   	ret
+
+00800974 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800974:	55                   	push   %ebp
+  800975:	89 e5                	mov    %esp,%ebp
+  800977:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80097a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80097d:	eb 06                	jmp    800985 <strcmp+0x11>
+		p++, q++;
+  80097f:	83 c1 01             	add    $0x1,%ecx
+  800982:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800985:	0f b6 01             	movzbl (%ecx),%eax
+  800988:	84 c0                	test   %al,%al
+  80098a:	74 04                	je     800990 <strcmp+0x1c>
+  80098c:	3a 02                	cmp    (%edx),%al
+  80098e:	74 ef                	je     80097f <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800990:	0f b6 c0             	movzbl %al,%eax
+  800993:	0f b6 12             	movzbl (%edx),%edx
+  800996:	29 d0                	sub    %edx,%eax
+}
+  800998:	5d                   	pop    %ebp
+  800999:	c3                   	ret
+
+0080099a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80099a:	55                   	push   %ebp
+  80099b:	89 e5                	mov    %esp,%ebp
+  80099d:	53                   	push   %ebx
+  80099e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009a7:	eb 09                	jmp    8009b2 <strncmp+0x18>
+		n--, p++, q++;
+  8009a9:	83 ea 01             	sub    $0x1,%edx
+  8009ac:	83 c0 01             	add    $0x1,%eax
+  8009af:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009b2:	85 d2                	test   %edx,%edx
+  8009b4:	74 18                	je     8009ce <strncmp+0x34>
+  8009b6:	0f b6 18             	movzbl (%eax),%ebx
+  8009b9:	84 db                	test   %bl,%bl
+  8009bb:	74 04                	je     8009c1 <strncmp+0x27>
+  8009bd:	3a 19                	cmp    (%ecx),%bl
+  8009bf:	74 e8                	je     8009a9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c1:	0f b6 00             	movzbl (%eax),%eax
+  8009c4:	0f b6 11             	movzbl (%ecx),%edx
+  8009c7:	29 d0                	sub    %edx,%eax
+}
+  8009c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009cc:	c9                   	leave
+  8009cd:	c3                   	ret
+		return 0;
+  8009ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d3:	eb f4                	jmp    8009c9 <strncmp+0x2f>
+
+008009d5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d5:	55                   	push   %ebp
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009db:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009df:	eb 03                	jmp    8009e4 <strchr+0xf>
+  8009e1:	83 c0 01             	add    $0x1,%eax
+  8009e4:	0f b6 10             	movzbl (%eax),%edx
+  8009e7:	84 d2                	test   %dl,%dl
+  8009e9:	74 06                	je     8009f1 <strchr+0x1c>
+		if (*s == c)
+  8009eb:	38 ca                	cmp    %cl,%dl
+  8009ed:	75 f2                	jne    8009e1 <strchr+0xc>
+  8009ef:	eb 05                	jmp    8009f6 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f6:	5d                   	pop    %ebp
+  8009f7:	c3                   	ret
+
+008009f8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a02:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a05:	38 ca                	cmp    %cl,%dl
+  800a07:	74 09                	je     800a12 <strfind+0x1a>
+  800a09:	84 d2                	test   %dl,%dl
+  800a0b:	74 05                	je     800a12 <strfind+0x1a>
+	for (; *s; s++)
+  800a0d:	83 c0 01             	add    $0x1,%eax
+  800a10:	eb f0                	jmp    800a02 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a12:	5d                   	pop    %ebp
+  800a13:	c3                   	ret
+
+00800a14 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a14:	55                   	push   %ebp
+  800a15:	89 e5                	mov    %esp,%ebp
+  800a17:	57                   	push   %edi
+  800a18:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a1b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a1e:	85 c9                	test   %ecx,%ecx
+  800a20:	74 20                	je     800a42 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a22:	89 f8                	mov    %edi,%eax
+  800a24:	09 c8                	or     %ecx,%eax
+  800a26:	a8 03                	test   $0x3,%al
+  800a28:	75 12                	jne    800a3c <memset+0x28>
+		c &= 0xFF;
+  800a2a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a2e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a34:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a37:	fc                   	cld
+  800a38:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a3a:	eb 06                	jmp    800a42 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a3f:	fc                   	cld
+  800a40:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a42:	89 f8                	mov    %edi,%eax
+  800a44:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a47:	c9                   	leave
+  800a48:	c3                   	ret
+
+00800a49 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a49:	55                   	push   %ebp
+  800a4a:	89 e5                	mov    %esp,%ebp
+  800a4c:	57                   	push   %edi
+  800a4d:	56                   	push   %esi
+  800a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a51:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a54:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a57:	39 c6                	cmp    %eax,%esi
+  800a59:	73 32                	jae    800a8d <memmove+0x44>
+  800a5b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a5e:	39 d0                	cmp    %edx,%eax
+  800a60:	73 2b                	jae    800a8d <memmove+0x44>
+		s += n;
+		d += n;
+  800a62:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a65:	89 d6                	mov    %edx,%esi
+  800a67:	09 fe                	or     %edi,%esi
+  800a69:	09 ce                	or     %ecx,%esi
+  800a6b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a71:	75 0e                	jne    800a81 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a73:	83 ef 04             	sub    $0x4,%edi
+  800a76:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a79:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a7c:	fd                   	std
+  800a7d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a7f:	eb 09                	jmp    800a8a <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a81:	83 ef 01             	sub    $0x1,%edi
+  800a84:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a87:	fd                   	std
+  800a88:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a8a:	fc                   	cld
+  800a8b:	eb 1a                	jmp    800aa7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8d:	89 f2                	mov    %esi,%edx
+  800a8f:	09 c2                	or     %eax,%edx
+  800a91:	09 ca                	or     %ecx,%edx
+  800a93:	f6 c2 03             	test   $0x3,%dl
+  800a96:	75 0a                	jne    800aa2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a98:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a9b:	89 c7                	mov    %eax,%edi
+  800a9d:	fc                   	cld
+  800a9e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa0:	eb 05                	jmp    800aa7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800aa2:	89 c7                	mov    %eax,%edi
+  800aa4:	fc                   	cld
+  800aa5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aa7:	5e                   	pop    %esi
+  800aa8:	5f                   	pop    %edi
+  800aa9:	5d                   	pop    %ebp
+  800aaa:	c3                   	ret
+
+00800aab <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ab1:	ff 75 10             	push   0x10(%ebp)
+  800ab4:	ff 75 0c             	push   0xc(%ebp)
+  800ab7:	ff 75 08             	push   0x8(%ebp)
+  800aba:	e8 8a ff ff ff       	call   800a49 <memmove>
+}
+  800abf:	c9                   	leave
+  800ac0:	c3                   	ret
+
+00800ac1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	56                   	push   %esi
+  800ac5:	53                   	push   %ebx
+  800ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800acc:	89 c6                	mov    %eax,%esi
+  800ace:	03 75 10             	add    0x10(%ebp),%esi
+  800ad1:	eb 06                	jmp    800ad9 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ad3:	83 c0 01             	add    $0x1,%eax
+  800ad6:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ad9:	39 f0                	cmp    %esi,%eax
+  800adb:	74 14                	je     800af1 <memcmp+0x30>
+		if (*s1 != *s2)
+  800add:	0f b6 08             	movzbl (%eax),%ecx
+  800ae0:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae3:	38 d9                	cmp    %bl,%cl
+  800ae5:	74 ec                	je     800ad3 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ae7:	0f b6 c1             	movzbl %cl,%eax
+  800aea:	0f b6 db             	movzbl %bl,%ebx
+  800aed:	29 d8                	sub    %ebx,%eax
+  800aef:	eb 05                	jmp    800af6 <memcmp+0x35>
+	}
+
+	return 0;
+  800af1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af6:	5b                   	pop    %ebx
+  800af7:	5e                   	pop    %esi
+  800af8:	5d                   	pop    %ebp
+  800af9:	c3                   	ret
+
+00800afa <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800afa:	55                   	push   %ebp
+  800afb:	89 e5                	mov    %esp,%ebp
+  800afd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b03:	89 c2                	mov    %eax,%edx
+  800b05:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b08:	eb 03                	jmp    800b0d <memfind+0x13>
+  800b0a:	83 c0 01             	add    $0x1,%eax
+  800b0d:	39 d0                	cmp    %edx,%eax
+  800b0f:	73 04                	jae    800b15 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b11:	38 08                	cmp    %cl,(%eax)
+  800b13:	75 f5                	jne    800b0a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b15:	5d                   	pop    %ebp
+  800b16:	c3                   	ret
+
+00800b17 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	57                   	push   %edi
+  800b1b:	56                   	push   %esi
+  800b1c:	53                   	push   %ebx
+  800b1d:	83 ec 1c             	sub    $0x1c,%esp
+  800b20:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b23:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b26:	eb 03                	jmp    800b2b <strtol+0x14>
+		s++;
+  800b28:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b2b:	0f b6 06             	movzbl (%esi),%eax
+  800b2e:	3c 20                	cmp    $0x20,%al
+  800b30:	74 f6                	je     800b28 <strtol+0x11>
+  800b32:	3c 09                	cmp    $0x9,%al
+  800b34:	74 f2                	je     800b28 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b36:	3c 2b                	cmp    $0x2b,%al
+  800b38:	74 43                	je     800b7d <strtol+0x66>
+	int neg = 0;
+  800b3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b3f:	3c 2d                	cmp    $0x2d,%al
+  800b41:	74 44                	je     800b87 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b43:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b49:	75 0f                	jne    800b5a <strtol+0x43>
+  800b4b:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b4e:	74 41                	je     800b91 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b50:	85 ff                	test   %edi,%edi
+  800b52:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b57:	0f 44 f8             	cmove  %eax,%edi
+  800b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5f:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b64:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b67:	89 fb                	mov    %edi,%ebx
+  800b69:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b6c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b6f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b72:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b75:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b78:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b7b:	eb 67                	jmp    800be4 <strtol+0xcd>
+		s++;
+  800b7d:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b85:	eb bc                	jmp    800b43 <strtol+0x2c>
+		s++, neg = 1;
+  800b87:	83 c6 01             	add    $0x1,%esi
+  800b8a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b8f:	eb b2                	jmp    800b43 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b91:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b95:	74 0e                	je     800ba5 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b97:	85 ff                	test   %edi,%edi
+  800b99:	75 bf                	jne    800b5a <strtol+0x43>
+		s++, base = 8;
+  800b9b:	83 c6 01             	add    $0x1,%esi
+  800b9e:	bf 08 00 00 00       	mov    $0x8,%edi
+  800ba3:	eb b5                	jmp    800b5a <strtol+0x43>
+		s += 2, base = 16;
+  800ba5:	83 c6 02             	add    $0x2,%esi
+  800ba8:	bf 10 00 00 00       	mov    $0x10,%edi
+  800bad:	eb ab                	jmp    800b5a <strtol+0x43>
+			dig = *s - '0';
+  800baf:	0f be c9             	movsbl %cl,%ecx
+  800bb2:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800bb5:	39 f9                	cmp    %edi,%ecx
+  800bb7:	7d 59                	jge    800c12 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800bb9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800bbd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bc0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bc3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bc6:	0f af d8             	imul   %eax,%ebx
+  800bc9:	0f af d7             	imul   %edi,%edx
+  800bcc:	01 d3                	add    %edx,%ebx
+  800bce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bd1:	f7 e7                	mul    %edi
+  800bd3:	01 da                	add    %ebx,%edx
+  800bd5:	89 cb                	mov    %ecx,%ebx
+  800bd7:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bda:	01 c8                	add    %ecx,%eax
+  800bdc:	11 da                	adc    %ebx,%edx
+  800bde:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800be1:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800be4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be7:	0f b6 08             	movzbl (%eax),%ecx
+  800bea:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800bed:	80 fb 09             	cmp    $0x9,%bl
+  800bf0:	76 bd                	jbe    800baf <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800bf2:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800bf5:	80 fb 19             	cmp    $0x19,%bl
+  800bf8:	77 08                	ja     800c02 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800bfa:	0f be c9             	movsbl %cl,%ecx
+  800bfd:	83 e9 57             	sub    $0x57,%ecx
+  800c00:	eb b3                	jmp    800bb5 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c02:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c05:	80 fb 19             	cmp    $0x19,%bl
+  800c08:	77 08                	ja     800c12 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c0a:	0f be c9             	movsbl %cl,%ecx
+  800c0d:	83 e9 37             	sub    $0x37,%ecx
+  800c10:	eb a3                	jmp    800bb5 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c12:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c15:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c18:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c1b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c1e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c22:	74 05                	je     800c29 <strtol+0x112>
+		*endptr = (char *) s;
+  800c24:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c27:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c29:	85 c9                	test   %ecx,%ecx
+  800c2b:	74 07                	je     800c34 <strtol+0x11d>
+  800c2d:	f7 d8                	neg    %eax
+  800c2f:	83 d2 00             	adc    $0x0,%edx
+  800c32:	f7 da                	neg    %edx
+}
+  800c34:	83 c4 1c             	add    $0x1c,%esp
+  800c37:	5b                   	pop    %ebx
+  800c38:	5e                   	pop    %esi
+  800c39:	5f                   	pop    %edi
+  800c3a:	5d                   	pop    %ebp
+  800c3b:	c3                   	ret
+
+00800c3c <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c3c:	55                   	push   %ebp
+  800c3d:	89 e5                	mov    %esp,%ebp
+  800c3f:	57                   	push   %edi
+  800c40:	56                   	push   %esi
+  800c41:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c42:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800c49:	74 18                	je     800c63 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c56:	89 c3                	mov    %eax,%ebx
+  800c58:	89 c7                	mov    %eax,%edi
+  800c5a:	89 c6                	mov    %eax,%esi
+  800c5c:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c5e:	5b                   	pop    %ebx
+  800c5f:	5e                   	pop    %esi
+  800c60:	5f                   	pop    %edi
+  800c61:	5d                   	pop    %ebp
+  800c62:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6e:	89 c3                	mov    %eax,%ebx
+  800c70:	89 c7                	mov    %eax,%edi
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	8d 35 7d 0c 80 00    	lea    0x800c7d,%esi
+  800c7b:	0f 34                	sysenter
+  800c7d:	5d                   	pop    %ebp
+		goto out;
+  800c7e:	eb de                	jmp    800c5e <sys_cputs+0x22>
+
+00800c80 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	57                   	push   %edi
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c86:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800c8d:	74 19                	je     800ca8 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c94:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c99:	89 d1                	mov    %edx,%ecx
+  800c9b:	89 d3                	mov    %edx,%ebx
+  800c9d:	89 d7                	mov    %edx,%edi
+  800c9f:	89 d6                	mov    %edx,%esi
+  800ca1:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ca3:	5b                   	pop    %ebx
+  800ca4:	5e                   	pop    %esi
+  800ca5:	5f                   	pop    %edi
+  800ca6:	5d                   	pop    %ebp
+  800ca7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ca8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cad:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb2:	89 d1                	mov    %edx,%ecx
+  800cb4:	89 d3                	mov    %edx,%ebx
+  800cb6:	89 d7                	mov    %edx,%edi
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	8d 35 c3 0c 80 00    	lea    0x800cc3,%esi
+  800cc1:	0f 34                	sysenter
+  800cc3:	5d                   	pop    %ebp
+		goto out;
+  800cc4:	eb dd                	jmp    800ca3 <sys_cgetc+0x23>
+
+00800cc6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	57                   	push   %edi
+  800cca:	56                   	push   %esi
+  800ccb:	53                   	push   %ebx
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ccf:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800cd6:	74 21                	je     800cf9 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdd:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ce2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce5:	89 cb                	mov    %ecx,%ebx
+  800ce7:	89 cf                	mov    %ecx,%edi
+  800ce9:	89 ce                	mov    %ecx,%esi
+  800ceb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ced:	85 c0                	test   %eax,%eax
+  800cef:	7f 27                	jg     800d18 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf4:	5b                   	pop    %ebx
+  800cf5:	5e                   	pop    %esi
+  800cf6:	5f                   	pop    %edi
+  800cf7:	5d                   	pop    %ebp
+  800cf8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d01:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d06:	89 cb                	mov    %ecx,%ebx
+  800d08:	89 cf                	mov    %ecx,%edi
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	8d 35 15 0d 80 00    	lea    0x800d15,%esi
+  800d13:	0f 34                	sysenter
+  800d15:	5d                   	pop    %ebp
+		goto out;
+  800d16:	eb d5                	jmp    800ced <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+  800d1b:	50                   	push   %eax
+  800d1c:	6a 03                	push   $0x3
+  800d1e:	68 2b 30 80 00       	push   $0x80302b
+  800d23:	6a 3f                	push   $0x3f
+  800d25:	68 48 30 80 00       	push   $0x803048
+  800d2a:	e8 71 f4 ff ff       	call   8001a0 <_panic>
+
+00800d2f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	57                   	push   %edi
+  800d33:	56                   	push   %esi
+  800d34:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d35:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800d3c:	74 19                	je     800d57 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d43:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d48:	89 d1                	mov    %edx,%ecx
+  800d4a:	89 d3                	mov    %edx,%ebx
+  800d4c:	89 d7                	mov    %edx,%edi
+  800d4e:	89 d6                	mov    %edx,%esi
+  800d50:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d52:	5b                   	pop    %ebx
+  800d53:	5e                   	pop    %esi
+  800d54:	5f                   	pop    %edi
+  800d55:	5d                   	pop    %ebp
+  800d56:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d57:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d61:	89 d1                	mov    %edx,%ecx
+  800d63:	89 d3                	mov    %edx,%ebx
+  800d65:	89 d7                	mov    %edx,%edi
+  800d67:	55                   	push   %ebp
+  800d68:	89 e5                	mov    %esp,%ebp
+  800d6a:	8d 35 72 0d 80 00    	lea    0x800d72,%esi
+  800d70:	0f 34                	sysenter
+  800d72:	5d                   	pop    %ebp
+		goto out;
+  800d73:	eb dd                	jmp    800d52 <sys_getenvid+0x23>
+
+00800d75 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d7b:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800d82:	74 19                	je     800d9d <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d89:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d8e:	89 d1                	mov    %edx,%ecx
+  800d90:	89 d3                	mov    %edx,%ebx
+  800d92:	89 d7                	mov    %edx,%edi
+  800d94:	89 d6                	mov    %edx,%esi
+  800d96:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d98:	5b                   	pop    %ebx
+  800d99:	5e                   	pop    %esi
+  800d9a:	5f                   	pop    %edi
+  800d9b:	5d                   	pop    %ebp
+  800d9c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800da7:	89 d1                	mov    %edx,%ecx
+  800da9:	89 d3                	mov    %edx,%ebx
+  800dab:	89 d7                	mov    %edx,%edi
+  800dad:	55                   	push   %ebp
+  800dae:	89 e5                	mov    %esp,%ebp
+  800db0:	8d 35 b8 0d 80 00    	lea    0x800db8,%esi
+  800db6:	0f 34                	sysenter
+  800db8:	5d                   	pop    %ebp
+		goto out;
+  800db9:	eb dd                	jmp    800d98 <sys_yield+0x23>
+
+00800dbb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	57                   	push   %edi
+  800dbf:	56                   	push   %esi
+  800dc0:	53                   	push   %ebx
+  800dc1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dc4:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800dcb:	74 23                	je     800df0 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800dcd:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd2:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de0:	89 f7                	mov    %esi,%edi
+  800de2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de4:	85 c0                	test   %eax,%eax
+  800de6:	7f 29                	jg     800e11 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	8d 35 0e 0e 80 00    	lea    0x800e0e,%esi
+  800e0c:	0f 34                	sysenter
+  800e0e:	5d                   	pop    %ebp
+		goto out;
+  800e0f:	eb d3                	jmp    800de4 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+  800e14:	50                   	push   %eax
+  800e15:	6a 04                	push   $0x4
+  800e17:	68 2b 30 80 00       	push   $0x80302b
+  800e1c:	6a 3f                	push   $0x3f
+  800e1e:	68 48 30 80 00       	push   $0x803048
+  800e23:	e8 78 f3 ff ff       	call   8001a0 <_panic>
+
+00800e28 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+  800e31:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e34:	85 f6                	test   %esi,%esi
+  800e36:	75 09                	jne    800e41 <sys_page_map+0x19>
+  800e38:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800e3f:	74 1f                	je     800e60 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e41:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e52:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e54:	85 c0                	test   %eax,%eax
+  800e56:	7f 27                	jg     800e7f <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5b:	5b                   	pop    %ebx
+  800e5c:	5e                   	pop    %esi
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e66:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	8d 35 7c 0e 80 00    	lea    0x800e7c,%esi
+  800e7a:	0f 34                	sysenter
+  800e7c:	5d                   	pop    %ebp
+		goto out;
+  800e7d:	eb d5                	jmp    800e54 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+  800e82:	50                   	push   %eax
+  800e83:	6a 05                	push   $0x5
+  800e85:	68 2b 30 80 00       	push   $0x80302b
+  800e8a:	6a 3f                	push   $0x3f
+  800e8c:	68 48 30 80 00       	push   $0x803048
+  800e91:	e8 0a f3 ff ff       	call   8001a0 <_panic>
+
+00800e96 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e96:	55                   	push   %ebp
+  800e97:	89 e5                	mov    %esp,%ebp
+  800e99:	57                   	push   %edi
+  800e9a:	56                   	push   %esi
+  800e9b:	53                   	push   %ebx
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e9f:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800ea6:	74 22                	je     800eca <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800ea8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ead:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb8:	89 df                	mov    %ebx,%edi
+  800eba:	89 de                	mov    %ebx,%esi
+  800ebc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	7f 28                	jg     800eea <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ec2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec5:	5b                   	pop    %ebx
+  800ec6:	5e                   	pop    %esi
+  800ec7:	5f                   	pop    %edi
+  800ec8:	5d                   	pop    %ebp
+  800ec9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ecf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800eda:	89 df                	mov    %ebx,%edi
+  800edc:	55                   	push   %ebp
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	8d 35 e7 0e 80 00    	lea    0x800ee7,%esi
+  800ee5:	0f 34                	sysenter
+  800ee7:	5d                   	pop    %ebp
+		goto out;
+  800ee8:	eb d4                	jmp    800ebe <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+  800eed:	50                   	push   %eax
+  800eee:	6a 06                	push   $0x6
+  800ef0:	68 2b 30 80 00       	push   $0x80302b
+  800ef5:	6a 3f                	push   $0x3f
+  800ef7:	68 48 30 80 00       	push   $0x803048
+  800efc:	e8 9f f2 ff ff       	call   8001a0 <_panic>
+
+00800f01 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f01:	55                   	push   %ebp
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	57                   	push   %edi
+  800f05:	56                   	push   %esi
+  800f06:	53                   	push   %ebx
+  800f07:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f0a:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800f11:	74 22                	je     800f35 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f18:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	89 df                	mov    %ebx,%edi
+  800f25:	89 de                	mov    %ebx,%esi
+  800f27:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	7f 28                	jg     800f55 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f40:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f45:	89 df                	mov    %ebx,%edi
+  800f47:	55                   	push   %ebp
+  800f48:	89 e5                	mov    %esp,%ebp
+  800f4a:	8d 35 52 0f 80 00    	lea    0x800f52,%esi
+  800f50:	0f 34                	sysenter
+  800f52:	5d                   	pop    %ebp
+		goto out;
+  800f53:	eb d4                	jmp    800f29 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f55:	83 ec 0c             	sub    $0xc,%esp
+  800f58:	50                   	push   %eax
+  800f59:	6a 08                	push   $0x8
+  800f5b:	68 2b 30 80 00       	push   $0x80302b
+  800f60:	6a 3f                	push   $0x3f
+  800f62:	68 48 30 80 00       	push   $0x803048
+  800f67:	e8 34 f2 ff ff       	call   8001a0 <_panic>
+
+00800f6c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+  800f72:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f75:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800f7c:	74 22                	je     800fa0 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f83:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8e:	89 df                	mov    %ebx,%edi
+  800f90:	89 de                	mov    %ebx,%esi
+  800f92:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	7f 28                	jg     800fc0 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fa0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fab:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fb0:	89 df                	mov    %ebx,%edi
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	8d 35 bd 0f 80 00    	lea    0x800fbd,%esi
+  800fbb:	0f 34                	sysenter
+  800fbd:	5d                   	pop    %ebp
+		goto out;
+  800fbe:	eb d4                	jmp    800f94 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc0:	83 ec 0c             	sub    $0xc,%esp
+  800fc3:	50                   	push   %eax
+  800fc4:	6a 09                	push   $0x9
+  800fc6:	68 2b 30 80 00       	push   $0x80302b
+  800fcb:	6a 3f                	push   $0x3f
+  800fcd:	68 48 30 80 00       	push   $0x803048
+  800fd2:	e8 c9 f1 ff ff       	call   8001a0 <_panic>
+
+00800fd7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fd7:	55                   	push   %ebp
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	57                   	push   %edi
+  800fdb:	56                   	push   %esi
+  800fdc:	53                   	push   %ebx
+  800fdd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fe0:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  800fe7:	74 22                	je     80100b <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800fe9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ff3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff9:	89 df                	mov    %ebx,%edi
+  800ffb:	89 de                	mov    %ebx,%esi
+  800ffd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fff:	85 c0                	test   %eax,%eax
+  801001:	7f 28                	jg     80102b <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801003:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801006:	5b                   	pop    %ebx
+  801007:	5e                   	pop    %esi
+  801008:	5f                   	pop    %edi
+  801009:	5d                   	pop    %ebp
+  80100a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80100b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801010:	8b 55 08             	mov    0x8(%ebp),%edx
+  801013:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801016:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80101b:	89 df                	mov    %ebx,%edi
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	8d 35 28 10 80 00    	lea    0x801028,%esi
+  801026:	0f 34                	sysenter
+  801028:	5d                   	pop    %ebp
+		goto out;
+  801029:	eb d4                	jmp    800fff <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80102b:	83 ec 0c             	sub    $0xc,%esp
+  80102e:	50                   	push   %eax
+  80102f:	6a 0a                	push   $0xa
+  801031:	68 2b 30 80 00       	push   $0x80302b
+  801036:	6a 3f                	push   $0x3f
+  801038:	68 48 30 80 00       	push   $0x803048
+  80103d:	e8 5e f1 ff ff       	call   8001a0 <_panic>
+
+00801042 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+  801048:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80104b:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801052:	74 22                	je     801076 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801054:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801059:	b8 17 00 00 00       	mov    $0x17,%eax
+  80105e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801061:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801064:	89 df                	mov    %ebx,%edi
+  801066:	89 de                	mov    %ebx,%esi
+  801068:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106a:	85 c0                	test   %eax,%eax
+  80106c:	7f 28                	jg     801096 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80106e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801071:	5b                   	pop    %ebx
+  801072:	5e                   	pop    %esi
+  801073:	5f                   	pop    %edi
+  801074:	5d                   	pop    %ebp
+  801075:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801076:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801081:	b8 17 00 00 00       	mov    $0x17,%eax
+  801086:	89 df                	mov    %ebx,%edi
+  801088:	55                   	push   %ebp
+  801089:	89 e5                	mov    %esp,%ebp
+  80108b:	8d 35 93 10 80 00    	lea    0x801093,%esi
+  801091:	0f 34                	sysenter
+  801093:	5d                   	pop    %ebp
+		goto out;
+  801094:	eb d4                	jmp    80106a <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801096:	83 ec 0c             	sub    $0xc,%esp
+  801099:	50                   	push   %eax
+  80109a:	6a 17                	push   $0x17
+  80109c:	68 2b 30 80 00       	push   $0x80302b
+  8010a1:	6a 3f                	push   $0x3f
+  8010a3:	68 48 30 80 00       	push   $0x803048
+  8010a8:	e8 f3 f0 ff ff       	call   8001a0 <_panic>
+
+008010ad <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+  8010b3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010b6:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8010bd:	74 22                	je     8010e1 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cf:	89 df                	mov    %ebx,%edi
+  8010d1:	89 de                	mov    %ebx,%esi
+  8010d3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d5:	85 c0                	test   %eax,%eax
+  8010d7:	7f 28                	jg     801101 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010dc:	5b                   	pop    %ebx
+  8010dd:	5e                   	pop    %esi
+  8010de:	5f                   	pop    %edi
+  8010df:	5d                   	pop    %ebp
+  8010e0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010f1:	89 df                	mov    %ebx,%edi
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	8d 35 fe 10 80 00    	lea    0x8010fe,%esi
+  8010fc:	0f 34                	sysenter
+  8010fe:	5d                   	pop    %ebp
+		goto out;
+  8010ff:	eb d4                	jmp    8010d5 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801101:	83 ec 0c             	sub    $0xc,%esp
+  801104:	50                   	push   %eax
+  801105:	6a 18                	push   $0x18
+  801107:	68 2b 30 80 00       	push   $0x80302b
+  80110c:	6a 3f                	push   $0x3f
+  80110e:	68 48 30 80 00       	push   $0x803048
+  801113:	e8 88 f0 ff ff       	call   8001a0 <_panic>
+
+00801118 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80111e:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801125:	74 1d                	je     801144 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801127:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80112c:	be 00 00 00 00       	mov    $0x0,%esi
+  801131:	8b 55 08             	mov    0x8(%ebp),%edx
+  801134:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801137:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80113d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80113f:	5b                   	pop    %ebx
+  801140:	5e                   	pop    %esi
+  801141:	5f                   	pop    %edi
+  801142:	5d                   	pop    %ebp
+  801143:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801144:	8b 55 08             	mov    0x8(%ebp),%edx
+  801147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80114f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801152:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	8d 35 60 11 80 00    	lea    0x801160,%esi
+  80115e:	0f 34                	sysenter
+  801160:	5d                   	pop    %ebp
+		goto out;
+  801161:	eb dc                	jmp    80113f <sys_ipc_try_send+0x27>
+
+00801163 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801163:	55                   	push   %ebp
+  801164:	89 e5                	mov    %esp,%ebp
+  801166:	57                   	push   %edi
+  801167:	56                   	push   %esi
+  801168:	53                   	push   %ebx
+  801169:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80116c:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801173:	74 21                	je     801196 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801175:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80117a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	89 cb                	mov    %ecx,%ebx
+  801184:	89 cf                	mov    %ecx,%edi
+  801186:	89 ce                	mov    %ecx,%esi
+  801188:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118a:	85 c0                	test   %eax,%eax
+  80118c:	7f 27                	jg     8011b5 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80118e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801191:	5b                   	pop    %ebx
+  801192:	5e                   	pop    %esi
+  801193:	5f                   	pop    %edi
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801196:	8b 55 08             	mov    0x8(%ebp),%edx
+  801199:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011a3:	89 cb                	mov    %ecx,%ebx
+  8011a5:	89 cf                	mov    %ecx,%edi
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	8d 35 b2 11 80 00    	lea    0x8011b2,%esi
+  8011b0:	0f 34                	sysenter
+  8011b2:	5d                   	pop    %ebp
+		goto out;
+  8011b3:	eb d5                	jmp    80118a <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b5:	83 ec 0c             	sub    $0xc,%esp
+  8011b8:	50                   	push   %eax
+  8011b9:	6a 0d                	push   $0xd
+  8011bb:	68 2b 30 80 00       	push   $0x80302b
+  8011c0:	6a 3f                	push   $0x3f
+  8011c2:	68 48 30 80 00       	push   $0x803048
+  8011c7:	e8 d4 ef ff ff       	call   8001a0 <_panic>
+
+008011cc <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011cc:	55                   	push   %ebp
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	57                   	push   %edi
+  8011d0:	56                   	push   %esi
+  8011d1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011d2:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8011d9:	74 1b                	je     8011f6 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011eb:	89 df                	mov    %ebx,%edi
+  8011ed:	89 de                	mov    %ebx,%esi
+  8011ef:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8011f1:	5b                   	pop    %ebx
+  8011f2:	5e                   	pop    %esi
+  8011f3:	5f                   	pop    %edi
+  8011f4:	5d                   	pop    %ebp
+  8011f5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801201:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801206:	89 df                	mov    %ebx,%edi
+  801208:	55                   	push   %ebp
+  801209:	89 e5                	mov    %esp,%ebp
+  80120b:	8d 35 13 12 80 00    	lea    0x801213,%esi
+  801211:	0f 34                	sysenter
+  801213:	5d                   	pop    %ebp
+		goto out;
+  801214:	eb db                	jmp    8011f1 <sys_ipc_recv_until+0x25>
+
+00801216 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+  801219:	57                   	push   %edi
+  80121a:	56                   	push   %esi
+  80121b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80121c:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801223:	74 19                	je     80123e <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80122f:	89 d1                	mov    %edx,%ecx
+  801231:	89 d3                	mov    %edx,%ebx
+  801233:	89 d7                	mov    %edx,%edi
+  801235:	89 d6                	mov    %edx,%esi
+  801237:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801239:	5b                   	pop    %ebx
+  80123a:	5e                   	pop    %esi
+  80123b:	5f                   	pop    %edi
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80123e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801243:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801248:	89 d1                	mov    %edx,%ecx
+  80124a:	89 d3                	mov    %edx,%ebx
+  80124c:	89 d7                	mov    %edx,%edi
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	8d 35 59 12 80 00    	lea    0x801259,%esi
+  801257:	0f 34                	sysenter
+  801259:	5d                   	pop    %ebp
+		goto out;
+  80125a:	eb dd                	jmp    801239 <sys_time_msec+0x23>
+
+0080125c <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	57                   	push   %edi
+  801260:	56                   	push   %esi
+  801261:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801262:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801269:	74 1a                	je     801285 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80126b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801270:	b8 10 00 00 00       	mov    $0x10,%eax
+  801275:	8b 55 08             	mov    0x8(%ebp),%edx
+  801278:	89 cb                	mov    %ecx,%ebx
+  80127a:	89 cf                	mov    %ecx,%edi
+  80127c:	89 ce                	mov    %ecx,%esi
+  80127e:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801280:	5b                   	pop    %ebx
+  801281:	5e                   	pop    %esi
+  801282:	5f                   	pop    %edi
+  801283:	5d                   	pop    %ebp
+  801284:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801285:	8b 55 08             	mov    0x8(%ebp),%edx
+  801288:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80128d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801292:	89 cb                	mov    %ecx,%ebx
+  801294:	89 cf                	mov    %ecx,%edi
+  801296:	55                   	push   %ebp
+  801297:	89 e5                	mov    %esp,%ebp
+  801299:	8d 35 a1 12 80 00    	lea    0x8012a1,%esi
+  80129f:	0f 34                	sysenter
+  8012a1:	5d                   	pop    %ebp
+		goto out;
+  8012a2:	eb dc                	jmp    801280 <sys_sleep_until+0x24>
+
+008012a4 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012a4:	55                   	push   %ebp
+  8012a5:	89 e5                	mov    %esp,%ebp
+  8012a7:	57                   	push   %edi
+  8012a8:	56                   	push   %esi
+  8012a9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012aa:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8012b1:	74 1a                	je     8012cd <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8012b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c0:	89 cb                	mov    %ecx,%ebx
+  8012c2:	89 cf                	mov    %ecx,%edi
+  8012c4:	89 ce                	mov    %ecx,%esi
+  8012c6:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012c8:	5b                   	pop    %ebx
+  8012c9:	5e                   	pop    %esi
+  8012ca:	5f                   	pop    %edi
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012d5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012da:	89 cb                	mov    %ecx,%ebx
+  8012dc:	89 cf                	mov    %ecx,%edi
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	8d 35 e9 12 80 00    	lea    0x8012e9,%esi
+  8012e7:	0f 34                	sysenter
+  8012e9:	5d                   	pop    %ebp
+		goto out;
+  8012ea:	eb dc                	jmp    8012c8 <sys_env_print_stats+0x24>
+
+008012ec <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	57                   	push   %edi
+  8012f0:	56                   	push   %esi
+  8012f1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012f2:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8012f9:	74 1b                	je     801316 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801300:	b8 19 00 00 00       	mov    $0x19,%eax
+  801305:	8b 55 08             	mov    0x8(%ebp),%edx
+  801308:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130b:	89 df                	mov    %ebx,%edi
+  80130d:	89 de                	mov    %ebx,%esi
+  80130f:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801311:	5b                   	pop    %ebx
+  801312:	5e                   	pop    %esi
+  801313:	5f                   	pop    %edi
+  801314:	5d                   	pop    %ebp
+  801315:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801316:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801321:	b8 19 00 00 00       	mov    $0x19,%eax
+  801326:	89 df                	mov    %ebx,%edi
+  801328:	55                   	push   %ebp
+  801329:	89 e5                	mov    %esp,%ebp
+  80132b:	8d 35 33 13 80 00    	lea    0x801333,%esi
+  801331:	0f 34                	sysenter
+  801333:	5d                   	pop    %ebp
+		goto out;
+  801334:	eb db                	jmp    801311 <sys_perf+0x25>
+
+00801336 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80133c:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801343:	74 19                	je     80135e <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80134f:	89 d1                	mov    %edx,%ecx
+  801351:	89 d3                	mov    %edx,%ebx
+  801353:	89 d7                	mov    %edx,%edi
+  801355:	89 d6                	mov    %edx,%esi
+  801357:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801359:	5b                   	pop    %ebx
+  80135a:	5e                   	pop    %esi
+  80135b:	5f                   	pop    %edi
+  80135c:	5d                   	pop    %ebp
+  80135d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80135e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801363:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801368:	89 d1                	mov    %edx,%ecx
+  80136a:	89 d3                	mov    %edx,%ebx
+  80136c:	89 d7                	mov    %edx,%edi
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	8d 35 79 13 80 00    	lea    0x801379,%esi
+  801377:	0f 34                	sysenter
+  801379:	5d                   	pop    %ebp
+		goto out;
+  80137a:	eb dd                	jmp    801359 <sys_fork+0x23>
+
+0080137c <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80137c:	55                   	push   %ebp
+  80137d:	89 e5                	mov    %esp,%ebp
+  80137f:	57                   	push   %edi
+  801380:	56                   	push   %esi
+  801381:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801382:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801389:	74 1c                	je     8013a7 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80138b:	be 00 00 00 00       	mov    $0x0,%esi
+  801390:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139e:	89 f7                	mov    %esi,%edi
+  8013a0:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013a2:	5b                   	pop    %ebx
+  8013a3:	5e                   	pop    %esi
+  8013a4:	5f                   	pop    %edi
+  8013a5:	5d                   	pop    %ebp
+  8013a6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ad:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+  8013bd:	8d 35 c5 13 80 00    	lea    0x8013c5,%esi
+  8013c3:	0f 34                	sysenter
+  8013c5:	5d                   	pop    %ebp
+		goto out;
+  8013c6:	eb da                	jmp    8013a2 <sys_thread_create+0x26>
+
+008013c8 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	57                   	push   %edi
+  8013cc:	56                   	push   %esi
+  8013cd:	53                   	push   %ebx
+  8013ce:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013d1:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8013d8:	74 24                	je     8013fe <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013da:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013df:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ed:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013f2:	85 c0                	test   %eax,%eax
+  8013f4:	7f 27                	jg     80141d <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f9:	5b                   	pop    %ebx
+  8013fa:	5e                   	pop    %esi
+  8013fb:	5f                   	pop    %edi
+  8013fc:	5d                   	pop    %ebp
+  8013fd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801401:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801404:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801409:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80140c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	8d 35 1a 14 80 00    	lea    0x80141a,%esi
+  801418:	0f 34                	sysenter
+  80141a:	5d                   	pop    %ebp
+		goto out;
+  80141b:	eb d5                	jmp    8013f2 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80141d:	83 ec 0c             	sub    $0xc,%esp
+  801420:	50                   	push   %eax
+  801421:	6a 1f                	push   $0x1f
+  801423:	68 2b 30 80 00       	push   $0x80302b
+  801428:	6a 3f                	push   $0x3f
+  80142a:	68 48 30 80 00       	push   $0x803048
+  80142f:	e8 6c ed ff ff       	call   8001a0 <_panic>
+
+00801434 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801434:	55                   	push   %ebp
+  801435:	89 e5                	mov    %esp,%ebp
+  801437:	57                   	push   %edi
+  801438:	56                   	push   %esi
+  801439:	53                   	push   %ebx
+  80143a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80143d:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801444:	74 23                	je     801469 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801446:	be 00 00 00 00       	mov    $0x0,%esi
+  80144b:	b8 20 00 00 00       	mov    $0x20,%eax
+  801450:	8b 55 08             	mov    0x8(%ebp),%edx
+  801453:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801456:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801459:	89 f7                	mov    %esi,%edi
+  80145b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	7f 29                	jg     80148a <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801461:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801464:	5b                   	pop    %ebx
+  801465:	5e                   	pop    %esi
+  801466:	5f                   	pop    %edi
+  801467:	5d                   	pop    %ebp
+  801468:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801469:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146f:	b8 20 00 00 00       	mov    $0x20,%eax
+  801474:	bf 00 00 00 00       	mov    $0x0,%edi
+  801479:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	8d 35 87 14 80 00    	lea    0x801487,%esi
+  801485:	0f 34                	sysenter
+  801487:	5d                   	pop    %ebp
+		goto out;
+  801488:	eb d3                	jmp    80145d <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80148a:	83 ec 0c             	sub    $0xc,%esp
+  80148d:	50                   	push   %eax
+  80148e:	6a 20                	push   $0x20
+  801490:	68 2b 30 80 00       	push   $0x80302b
+  801495:	6a 3f                	push   $0x3f
+  801497:	68 48 30 80 00       	push   $0x803048
+  80149c:	e8 ff ec ff ff       	call   8001a0 <_panic>
+
+008014a1 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	57                   	push   %edi
+  8014a5:	56                   	push   %esi
+  8014a6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014a7:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8014ae:	74 1b                	je     8014cb <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8014b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c0:	89 df                	mov    %ebx,%edi
+  8014c2:	89 de                	mov    %ebx,%esi
+  8014c4:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014c6:	5b                   	pop    %ebx
+  8014c7:	5e                   	pop    %esi
+  8014c8:	5f                   	pop    %edi
+  8014c9:	5d                   	pop    %ebp
+  8014ca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014db:	89 df                	mov    %ebx,%edi
+  8014dd:	55                   	push   %ebp
+  8014de:	89 e5                	mov    %esp,%ebp
+  8014e0:	8d 35 e8 14 80 00    	lea    0x8014e8,%esi
+  8014e6:	0f 34                	sysenter
+  8014e8:	5d                   	pop    %ebp
+		goto out;
+  8014e9:	eb db                	jmp    8014c6 <sys_batch+0x25>
+
+008014eb <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	57                   	push   %edi
+  8014ef:	56                   	push   %esi
+  8014f0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014f1:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8014f8:	74 1a                	je     801514 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8014fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ff:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801504:	8b 55 08             	mov    0x8(%ebp),%edx
+  801507:	89 cb                	mov    %ecx,%ebx
+  801509:	89 cf                	mov    %ecx,%edi
+  80150b:	89 ce                	mov    %ecx,%esi
+  80150d:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5f                   	pop    %edi
+  801512:	5d                   	pop    %ebp
+  801513:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801514:	8b 55 08             	mov    0x8(%ebp),%edx
+  801517:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801521:	89 cb                	mov    %ecx,%ebx
+  801523:	89 cf                	mov    %ecx,%edi
+  801525:	55                   	push   %ebp
+  801526:	89 e5                	mov    %esp,%ebp
+  801528:	8d 35 30 15 80 00    	lea    0x801530,%esi
+  80152e:	0f 34                	sysenter
+  801530:	5d                   	pop    %ebp
+		goto out;
+  801531:	eb dc                	jmp    80150f <sys_trace_ctl+0x24>
+
+00801533 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  801536:	57                   	push   %edi
+  801537:	56                   	push   %esi
+  801538:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801539:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801540:	74 1c                	je     80155e <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801542:	be 00 00 00 00       	mov    $0x0,%esi
+  801547:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80154c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801552:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801555:	89 f7                	mov    %esi,%edi
+  801557:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801559:	5b                   	pop    %ebx
+  80155a:	5e                   	pop    %esi
+  80155b:	5f                   	pop    %edi
+  80155c:	5d                   	pop    %ebp
+  80155d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80155e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801561:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801564:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801569:	bf 00 00 00 00       	mov    $0x0,%edi
+  80156e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801571:	55                   	push   %ebp
+  801572:	89 e5                	mov    %esp,%ebp
+  801574:	8d 35 7c 15 80 00    	lea    0x80157c,%esi
+  80157a:	0f 34                	sysenter
+  80157c:	5d                   	pop    %ebp
+		goto out;
+  80157d:	eb da                	jmp    801559 <sys_trace_read+0x26>
+
+0080157f <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80157f:	55                   	push   %ebp
+  801580:	89 e5                	mov    %esp,%ebp
+  801582:	57                   	push   %edi
+  801583:	56                   	push   %esi
+  801584:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801585:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  80158c:	74 1c                	je     8015aa <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80158e:	be 00 00 00 00       	mov    $0x0,%esi
+  801593:	b8 21 00 00 00       	mov    $0x21,%eax
+  801598:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a1:	89 f7                	mov    %esi,%edi
+  8015a3:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015a5:	5b                   	pop    %ebx
+  8015a6:	5e                   	pop    %esi
+  8015a7:	5f                   	pop    %edi
+  8015a8:	5d                   	pop    %ebp
+  8015a9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b0:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015bd:	55                   	push   %ebp
+  8015be:	89 e5                	mov    %esp,%ebp
+  8015c0:	8d 35 c8 15 80 00    	lea    0x8015c8,%esi
+  8015c6:	0f 34                	sysenter
+  8015c8:	5d                   	pop    %ebp
+		goto out;
+  8015c9:	eb da                	jmp    8015a5 <sys_meminfo+0x26>
+
+008015cb <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	57                   	push   %edi
+  8015cf:	56                   	push   %esi
+  8015d0:	53                   	push   %ebx
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015d4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015d8:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8015df:	74 1f                	je     801600 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e6:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ee:	89 df                	mov    %ebx,%edi
+  8015f0:	89 de                	mov    %ebx,%esi
+  8015f2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	7f 25                	jg     80161d <sys_env_set_ksm+0x52>
+}
+  8015f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015fb:	5b                   	pop    %ebx
+  8015fc:	5e                   	pop    %esi
+  8015fd:	5f                   	pop    %edi
+  8015fe:	5d                   	pop    %ebp
+  8015ff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801600:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801605:	8b 55 08             	mov    0x8(%ebp),%edx
+  801608:	b8 22 00 00 00       	mov    $0x22,%eax
+  80160d:	89 df                	mov    %ebx,%edi
+  80160f:	55                   	push   %ebp
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	8d 35 1a 16 80 00    	lea    0x80161a,%esi
+  801618:	0f 34                	sysenter
+  80161a:	5d                   	pop    %ebp
+		goto out;
+  80161b:	eb d7                	jmp    8015f4 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80161d:	83 ec 0c             	sub    $0xc,%esp
+  801620:	50                   	push   %eax
+  801621:	6a 22                	push   $0x22
+  801623:	68 2b 30 80 00       	push   $0x80302b
+  801628:	6a 3f                	push   $0x3f
+  80162a:	68 48 30 80 00       	push   $0x803048
+  80162f:	e8 6c eb ff ff       	call   8001a0 <_panic>
+
+00801634 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801634:	55                   	push   %ebp
+  801635:	89 e5                	mov    %esp,%ebp
+  801637:	57                   	push   %edi
+  801638:	56                   	push   %esi
+  801639:	53                   	push   %ebx
+  80163a:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80163d:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801640:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801647:	74 24                	je     80166d <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801649:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80164e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801653:	89 cb                	mov    %ecx,%ebx
+  801655:	89 cf                	mov    %ecx,%edi
+  801657:	89 ce                	mov    %ecx,%esi
+  801659:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80165b:	85 c0                	test   %eax,%eax
+  80165d:	7f 2a                	jg     801689 <sys_time_nsec+0x55>
+	return ns;
+}
+  80165f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801662:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801665:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801668:	5b                   	pop    %ebx
+  801669:	5e                   	pop    %esi
+  80166a:	5f                   	pop    %edi
+  80166b:	5d                   	pop    %ebp
+  80166c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80166d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801672:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801677:	89 cb                	mov    %ecx,%ebx
+  801679:	89 cf                	mov    %ecx,%edi
+  80167b:	55                   	push   %ebp
+  80167c:	89 e5                	mov    %esp,%ebp
+  80167e:	8d 35 86 16 80 00    	lea    0x801686,%esi
+  801684:	0f 34                	sysenter
+  801686:	5d                   	pop    %ebp
+		goto out;
+  801687:	eb d2                	jmp    80165b <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801689:	83 ec 0c             	sub    $0xc,%esp
+  80168c:	50                   	push   %eax
+  80168d:	6a 0f                	push   $0xf
+  80168f:	68 2b 30 80 00       	push   $0x80302b
+  801694:	6a 3f                	push   $0x3f
+  801696:	68 48 30 80 00       	push   $0x803048
+  80169b:	e8 00 eb ff ff       	call   8001a0 <_panic>
+
+008016a0 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016a0:	55                   	push   %ebp
+  8016a1:	89 e5                	mov    %esp,%ebp
+  8016a3:	57                   	push   %edi
+  8016a4:	56                   	push   %esi
+  8016a5:	53                   	push   %ebx
+  8016a6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016a9:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8016b0:	74 22                	je     8016d4 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8016b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c2:	89 df                	mov    %ebx,%edi
+  8016c4:	89 de                	mov    %ebx,%esi
+  8016c6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016c8:	85 c0                	test   %eax,%eax
+  8016ca:	7f 28                	jg     8016f4 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016cf:	5b                   	pop    %ebx
+  8016d0:	5e                   	pop    %esi
+  8016d1:	5f                   	pop    %edi
+  8016d2:	5d                   	pop    %ebp
+  8016d3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016df:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016e4:	89 df                	mov    %ebx,%edi
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	8d 35 f1 16 80 00    	lea    0x8016f1,%esi
+  8016ef:	0f 34                	sysenter
+  8016f1:	5d                   	pop    %ebp
+		goto out;
+  8016f2:	eb d4                	jmp    8016c8 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016f4:	83 ec 0c             	sub    $0xc,%esp
+  8016f7:	50                   	push   %eax
+  8016f8:	6a 12                	push   $0x12
+  8016fa:	68 2b 30 80 00       	push   $0x80302b
+  8016ff:	6a 3f                	push   $0x3f
+  801701:	68 48 30 80 00       	push   $0x803048
+  801706:	e8 95 ea ff ff       	call   8001a0 <_panic>
+
+0080170b <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80170b:	55                   	push   %ebp
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	57                   	push   %edi
+  80170f:	56                   	push   %esi
+  801710:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801711:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801718:	74 1b                	je     801735 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80171a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801724:	8b 55 08             	mov    0x8(%ebp),%edx
+  801727:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80172a:	89 df                	mov    %ebx,%edi
+  80172c:	89 de                	mov    %ebx,%esi
+  80172e:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801730:	5b                   	pop    %ebx
+  801731:	5e                   	pop    %esi
+  801732:	5f                   	pop    %edi
+  801733:	5d                   	pop    %ebp
+  801734:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801735:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801740:	b8 13 00 00 00       	mov    $0x13,%eax
+  801745:	89 df                	mov    %ebx,%edi
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	8d 35 52 17 80 00    	lea    0x801752,%esi
+  801750:	0f 34                	sysenter
+  801752:	5d                   	pop    %ebp
+		goto out;
+  801753:	eb db                	jmp    801730 <sys_e1000_receive+0x25>
+
+00801755 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801755:	55                   	push   %ebp
+  801756:	89 e5                	mov    %esp,%ebp
+  801758:	57                   	push   %edi
+  801759:	56                   	push   %esi
+  80175a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80175b:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  801762:	74 1b                	je     80177f <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801764:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801769:	b8 14 00 00 00       	mov    $0x14,%eax
+  80176e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801771:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801774:	89 df                	mov    %ebx,%edi
+  801776:	89 de                	mov    %ebx,%esi
+  801778:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80177a:	5b                   	pop    %ebx
+  80177b:	5e                   	pop    %esi
+  80177c:	5f                   	pop    %edi
+  80177d:	5d                   	pop    %ebp
+  80177e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80177f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801784:	8b 55 08             	mov    0x8(%ebp),%edx
+  801787:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80178f:	89 df                	mov    %ebx,%edi
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	8d 35 9c 17 80 00    	lea    0x80179c,%esi
+  80179a:	0f 34                	sysenter
+  80179c:	5d                   	pop    %ebp
+		goto out;
+  80179d:	eb db                	jmp    80177a <sys_e1000_read_hwaddr+0x25>
+
+0080179f <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80179f:	55                   	push   %ebp
+  8017a0:	89 e5                	mov    %esp,%ebp
+  8017a2:	57                   	push   %edi
+  8017a3:	56                   	push   %esi
+  8017a4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017a5:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8017ac:	74 1a                	je     8017c8 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8017ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b3:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017bb:	89 cb                	mov    %ecx,%ebx
+  8017bd:	89 cf                	mov    %ecx,%edi
+  8017bf:	89 ce                	mov    %ecx,%esi
+  8017c1:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017c3:	5b                   	pop    %ebx
+  8017c4:	5e                   	pop    %esi
+  8017c5:	5f                   	pop    %edi
+  8017c6:	5d                   	pop    %ebp
+  8017c7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017d0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017d5:	89 cb                	mov    %ecx,%ebx
+  8017d7:	89 cf                	mov    %ecx,%edi
+  8017d9:	55                   	push   %ebp
+  8017da:	89 e5                	mov    %esp,%ebp
+  8017dc:	8d 35 e4 17 80 00    	lea    0x8017e4,%esi
+  8017e2:	0f 34                	sysenter
+  8017e4:	5d                   	pop    %ebp
+		goto out;
+  8017e5:	eb dc                	jmp    8017c3 <sys_sb16_read_version+0x24>
+
+008017e7 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8017e7:	55                   	push   %ebp
+  8017e8:	89 e5                	mov    %esp,%ebp
+  8017ea:	57                   	push   %edi
+  8017eb:	56                   	push   %esi
+  8017ec:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ed:	80 3d 24 50 c0 00 00 	cmpb   $0x0,0xc05024
+  8017f4:	74 1b                	je     801811 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fb:	b8 16 00 00 00       	mov    $0x16,%eax
+  801800:	8b 55 08             	mov    0x8(%ebp),%edx
+  801803:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801806:	89 df                	mov    %ebx,%edi
+  801808:	89 de                	mov    %ebx,%esi
+  80180a:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80180c:	5b                   	pop    %ebx
+  80180d:	5e                   	pop    %esi
+  80180e:	5f                   	pop    %edi
+  80180f:	5d                   	pop    %ebp
+  801810:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801816:	8b 55 08             	mov    0x8(%ebp),%edx
+  801819:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181c:	b8 16 00 00 00       	mov    $0x16,%eax
+  801821:	89 df                	mov    %ebx,%edi
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	8d 35 2e 18 80 00    	lea    0x80182e,%esi
+  80182c:	0f 34                	sysenter
+  80182e:	5d                   	pop    %ebp
+		goto out;
+  80182f:	eb db                	jmp    80180c <sys_sb16_play+0x25>
+
+00801831 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801834:	8b 45 08             	mov    0x8(%ebp),%eax
+  801837:	05 00 00 00 30       	add    $0x30000000,%eax
+  80183c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80183f:	5d                   	pop    %ebp
+  801840:	c3                   	ret
+
+00801841 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801841:	55                   	push   %ebp
+  801842:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801844:	8b 45 08             	mov    0x8(%ebp),%eax
+  801847:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80184c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801851:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801856:	5d                   	pop    %ebp
+  801857:	c3                   	ret
+
+00801858 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80185b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801860:	eb 02                	jmp    801864 <fd_alloc+0xc>
+  801862:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801864:	89 c2                	mov    %eax,%edx
+  801866:	c1 ea 16             	shr    $0x16,%edx
+  801869:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801870:	f6 c2 01             	test   $0x1,%dl
+  801873:	74 2b                	je     8018a0 <fd_alloc+0x48>
+  801875:	89 c2                	mov    %eax,%edx
+  801877:	c1 ea 0c             	shr    $0xc,%edx
+  80187a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801881:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801887:	f6 c1 01             	test   $0x1,%cl
+  80188a:	74 14                	je     8018a0 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80188c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801892:	75 ce                	jne    801862 <fd_alloc+0xa>
+  801894:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801899:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80189e:	eb 05                	jmp    8018a5 <fd_alloc+0x4d>
+			return 0;
+  8018a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a8:	89 02                	mov    %eax,(%edx)
+}
+  8018aa:	89 c8                	mov    %ecx,%eax
+  8018ac:	5d                   	pop    %ebp
+  8018ad:	c3                   	ret
+
+008018ae <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018ae:	55                   	push   %ebp
+  8018af:	89 e5                	mov    %esp,%ebp
+  8018b1:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018b4:	83 f8 1f             	cmp    $0x1f,%eax
+  8018b7:	77 30                	ja     8018e9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018b9:	c1 e0 0c             	shl    $0xc,%eax
+  8018bc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018c1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018c7:	f6 c2 01             	test   $0x1,%dl
+  8018ca:	74 24                	je     8018f0 <fd_lookup+0x42>
+  8018cc:	89 c2                	mov    %eax,%edx
+  8018ce:	c1 ea 0c             	shr    $0xc,%edx
+  8018d1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018d8:	f6 c2 01             	test   $0x1,%dl
+  8018db:	74 1a                	je     8018f7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018e0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018e7:	5d                   	pop    %ebp
+  8018e8:	c3                   	ret
+		return -E_INVAL;
+  8018e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ee:	eb f7                	jmp    8018e7 <fd_lookup+0x39>
+		return -E_INVAL;
+  8018f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018f5:	eb f0                	jmp    8018e7 <fd_lookup+0x39>
+  8018f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018fc:	eb e9                	jmp    8018e7 <fd_lookup+0x39>
+
+008018fe <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018fe:	55                   	push   %ebp
+  8018ff:	89 e5                	mov    %esp,%ebp
+  801901:	53                   	push   %ebx
+  801902:	83 ec 04             	sub    $0x4,%esp
+  801905:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190d:	eb 03                	jmp    801912 <dev_lookup+0x14>
+  80190f:	83 c0 01             	add    $0x1,%eax
+  801912:	8b 1c 85 d4 30 80 00 	mov    0x8030d4(,%eax,4),%ebx
+  801919:	85 db                	test   %ebx,%ebx
+  80191b:	74 0b                	je     801928 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80191d:	39 13                	cmp    %edx,(%ebx)
+  80191f:	75 ee                	jne    80190f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801921:	b8 00 00 00 00       	mov    $0x0,%eax
+  801926:	eb 2e                	jmp    801956 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801928:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80192a:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80192f:	8b 0d 20 50 c0 00    	mov    0xc05020,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801935:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80193a:	76 24                	jbe    801960 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80193c:	8b 41 48             	mov    0x48(%ecx),%eax
+  80193f:	83 ec 04             	sub    $0x4,%esp
+  801942:	52                   	push   %edx
+  801943:	50                   	push   %eax
+  801944:	68 58 30 80 00       	push   $0x803058
+  801949:	e8 2d e9 ff ff       	call   80027b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80194e:	83 c4 10             	add    $0x10,%esp
+  801951:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801956:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801959:	89 1a                	mov    %ebx,(%edx)
+}
+  80195b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195e:	c9                   	leave
+  80195f:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801960:	c1 e8 10             	shr    $0x10,%eax
+  801963:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801969:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80196f:	eb cb                	jmp    80193c <dev_lookup+0x3e>
+
+00801971 <fd_close>:
+{
+  801971:	55                   	push   %ebp
+  801972:	89 e5                	mov    %esp,%ebp
+  801974:	57                   	push   %edi
+  801975:	56                   	push   %esi
+  801976:	53                   	push   %ebx
+  801977:	83 ec 24             	sub    $0x24,%esp
+  80197a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80197d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801980:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801983:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801984:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80198a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80198d:	50                   	push   %eax
+  80198e:	e8 1b ff ff ff       	call   8018ae <fd_lookup>
+  801993:	89 c3                	mov    %eax,%ebx
+  801995:	83 c4 10             	add    $0x10,%esp
+  801998:	85 c0                	test   %eax,%eax
+  80199a:	78 05                	js     8019a1 <fd_close+0x30>
+	    || fd != fd2)
+  80199c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80199f:	74 16                	je     8019b7 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019a1:	89 f8                	mov    %edi,%eax
+  8019a3:	84 c0                	test   %al,%al
+  8019a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019aa:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019ad:	89 d8                	mov    %ebx,%eax
+  8019af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019b2:	5b                   	pop    %ebx
+  8019b3:	5e                   	pop    %esi
+  8019b4:	5f                   	pop    %edi
+  8019b5:	5d                   	pop    %ebp
+  8019b6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019b7:	83 ec 08             	sub    $0x8,%esp
+  8019ba:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019bd:	50                   	push   %eax
+  8019be:	ff 36                	push   (%esi)
+  8019c0:	e8 39 ff ff ff       	call   8018fe <dev_lookup>
+  8019c5:	89 c3                	mov    %eax,%ebx
+  8019c7:	83 c4 10             	add    $0x10,%esp
+  8019ca:	85 c0                	test   %eax,%eax
+  8019cc:	78 1a                	js     8019e8 <fd_close+0x77>
+		if (dev->dev_close)
+  8019ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019d1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019d9:	85 c0                	test   %eax,%eax
+  8019db:	74 0b                	je     8019e8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8019dd:	83 ec 0c             	sub    $0xc,%esp
+  8019e0:	56                   	push   %esi
+  8019e1:	ff d0                	call   *%eax
+  8019e3:	89 c3                	mov    %eax,%ebx
+  8019e5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8019e8:	83 ec 08             	sub    $0x8,%esp
+  8019eb:	56                   	push   %esi
+  8019ec:	6a 00                	push   $0x0
+  8019ee:	e8 a3 f4 ff ff       	call   800e96 <sys_page_unmap>
+	return r;
+  8019f3:	83 c4 10             	add    $0x10,%esp
+  8019f6:	eb b5                	jmp    8019ad <fd_close+0x3c>
+
+008019f8 <close>:
+
+int
+close(int fdnum)
+{
+  8019f8:	55                   	push   %ebp
+  8019f9:	89 e5                	mov    %esp,%ebp
+  8019fb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a01:	50                   	push   %eax
+  801a02:	ff 75 08             	push   0x8(%ebp)
+  801a05:	e8 a4 fe ff ff       	call   8018ae <fd_lookup>
+  801a0a:	83 c4 10             	add    $0x10,%esp
+  801a0d:	85 c0                	test   %eax,%eax
+  801a0f:	79 02                	jns    801a13 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a11:	c9                   	leave
+  801a12:	c3                   	ret
+		return fd_close(fd, 1);
+  801a13:	83 ec 08             	sub    $0x8,%esp
+  801a16:	6a 01                	push   $0x1
+  801a18:	ff 75 f4             	push   -0xc(%ebp)
+  801a1b:	e8 51 ff ff ff       	call   801971 <fd_close>
+  801a20:	83 c4 10             	add    $0x10,%esp
+  801a23:	eb ec                	jmp    801a11 <close+0x19>
+
+00801a25 <close_all>:
+
+void
+close_all(void)
+{
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	53                   	push   %ebx
+  801a29:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a31:	83 ec 0c             	sub    $0xc,%esp
+  801a34:	53                   	push   %ebx
+  801a35:	e8 be ff ff ff       	call   8019f8 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a3a:	83 c3 01             	add    $0x1,%ebx
+  801a3d:	83 c4 10             	add    $0x10,%esp
+  801a40:	83 fb 20             	cmp    $0x20,%ebx
+  801a43:	75 ec                	jne    801a31 <close_all+0xc>
+}
+  801a45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a48:	c9                   	leave
+  801a49:	c3                   	ret
+
+00801a4a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	57                   	push   %edi
+  801a4e:	56                   	push   %esi
+  801a4f:	53                   	push   %ebx
+  801a50:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a53:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a56:	50                   	push   %eax
+  801a57:	ff 75 08             	push   0x8(%ebp)
+  801a5a:	e8 4f fe ff ff       	call   8018ae <fd_lookup>
+  801a5f:	89 c3                	mov    %eax,%ebx
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	78 7f                	js     801ae7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a68:	83 ec 0c             	sub    $0xc,%esp
+  801a6b:	ff 75 0c             	push   0xc(%ebp)
+  801a6e:	e8 85 ff ff ff       	call   8019f8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a73:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a76:	c1 e6 0c             	shl    $0xc,%esi
+  801a79:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a7f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a82:	89 3c 24             	mov    %edi,(%esp)
+  801a85:	e8 b7 fd ff ff       	call   801841 <fd2data>
+  801a8a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a8c:	89 34 24             	mov    %esi,(%esp)
+  801a8f:	e8 ad fd ff ff       	call   801841 <fd2data>
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a9a:	89 d8                	mov    %ebx,%eax
+  801a9c:	c1 e8 16             	shr    $0x16,%eax
+  801a9f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801aa6:	a8 01                	test   $0x1,%al
+  801aa8:	74 11                	je     801abb <dup+0x71>
+  801aaa:	89 d8                	mov    %ebx,%eax
+  801aac:	c1 e8 0c             	shr    $0xc,%eax
+  801aaf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ab6:	f6 c2 01             	test   $0x1,%dl
+  801ab9:	75 36                	jne    801af1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801abb:	89 f8                	mov    %edi,%eax
+  801abd:	c1 e8 0c             	shr    $0xc,%eax
+  801ac0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ac7:	83 ec 0c             	sub    $0xc,%esp
+  801aca:	25 07 0e 00 00       	and    $0xe07,%eax
+  801acf:	50                   	push   %eax
+  801ad0:	56                   	push   %esi
+  801ad1:	6a 00                	push   $0x0
+  801ad3:	57                   	push   %edi
+  801ad4:	6a 00                	push   $0x0
+  801ad6:	e8 4d f3 ff ff       	call   800e28 <sys_page_map>
+  801adb:	89 c3                	mov    %eax,%ebx
+  801add:	83 c4 20             	add    $0x20,%esp
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	78 33                	js     801b17 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801ae4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801ae7:	89 d8                	mov    %ebx,%eax
+  801ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aec:	5b                   	pop    %ebx
+  801aed:	5e                   	pop    %esi
+  801aee:	5f                   	pop    %edi
+  801aef:	5d                   	pop    %ebp
+  801af0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801af1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801af8:	83 ec 0c             	sub    $0xc,%esp
+  801afb:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b00:	50                   	push   %eax
+  801b01:	ff 75 d4             	push   -0x2c(%ebp)
+  801b04:	6a 00                	push   $0x0
+  801b06:	53                   	push   %ebx
+  801b07:	6a 00                	push   $0x0
+  801b09:	e8 1a f3 ff ff       	call   800e28 <sys_page_map>
+  801b0e:	89 c3                	mov    %eax,%ebx
+  801b10:	83 c4 20             	add    $0x20,%esp
+  801b13:	85 c0                	test   %eax,%eax
+  801b15:	79 a4                	jns    801abb <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b17:	83 ec 08             	sub    $0x8,%esp
+  801b1a:	56                   	push   %esi
+  801b1b:	6a 00                	push   $0x0
+  801b1d:	e8 74 f3 ff ff       	call   800e96 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b22:	83 c4 08             	add    $0x8,%esp
+  801b25:	ff 75 d4             	push   -0x2c(%ebp)
+  801b28:	6a 00                	push   $0x0
+  801b2a:	e8 67 f3 ff ff       	call   800e96 <sys_page_unmap>
+	return r;
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	eb b3                	jmp    801ae7 <dup+0x9d>
+
+00801b34 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b34:	55                   	push   %ebp
+  801b35:	89 e5                	mov    %esp,%ebp
+  801b37:	56                   	push   %esi
+  801b38:	53                   	push   %ebx
+  801b39:	83 ec 18             	sub    $0x18,%esp
+  801b3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b3f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b42:	50                   	push   %eax
+  801b43:	53                   	push   %ebx
+  801b44:	e8 65 fd ff ff       	call   8018ae <fd_lookup>
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	78 3c                	js     801b8c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b50:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b53:	83 ec 08             	sub    $0x8,%esp
+  801b56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b59:	50                   	push   %eax
+  801b5a:	ff 36                	push   (%esi)
+  801b5c:	e8 9d fd ff ff       	call   8018fe <dev_lookup>
+  801b61:	83 c4 10             	add    $0x10,%esp
+  801b64:	85 c0                	test   %eax,%eax
+  801b66:	78 24                	js     801b8c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b68:	8b 46 08             	mov    0x8(%esi),%eax
+  801b6b:	83 e0 03             	and    $0x3,%eax
+  801b6e:	83 f8 01             	cmp    $0x1,%eax
+  801b71:	74 20                	je     801b93 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b76:	8b 40 08             	mov    0x8(%eax),%eax
+  801b79:	85 c0                	test   %eax,%eax
+  801b7b:	74 57                	je     801bd4 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b7d:	83 ec 04             	sub    $0x4,%esp
+  801b80:	ff 75 10             	push   0x10(%ebp)
+  801b83:	ff 75 0c             	push   0xc(%ebp)
+  801b86:	56                   	push   %esi
+  801b87:	ff d0                	call   *%eax
+  801b89:	83 c4 10             	add    $0x10,%esp
+}
+  801b8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b8f:	5b                   	pop    %ebx
+  801b90:	5e                   	pop    %esi
+  801b91:	5d                   	pop    %ebp
+  801b92:	c3                   	ret
+  801b93:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b95:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b9a:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ba0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ba5:	76 1c                	jbe    801bc3 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ba7:	8b 42 48             	mov    0x48(%edx),%eax
+  801baa:	83 ec 04             	sub    $0x4,%esp
+  801bad:	53                   	push   %ebx
+  801bae:	50                   	push   %eax
+  801baf:	68 99 30 80 00       	push   $0x803099
+  801bb4:	e8 c2 e6 ff ff       	call   80027b <cprintf>
+		return -E_INVAL;
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bc1:	eb c9                	jmp    801b8c <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801bc3:	c1 e8 10             	shr    $0x10,%eax
+  801bc6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801bcc:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801bd2:	eb d3                	jmp    801ba7 <read+0x73>
+		return -E_NOT_SUPP;
+  801bd4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bd9:	eb b1                	jmp    801b8c <read+0x58>
+
+00801bdb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801bdb:	55                   	push   %ebp
+  801bdc:	89 e5                	mov    %esp,%ebp
+  801bde:	57                   	push   %edi
+  801bdf:	56                   	push   %esi
+  801be0:	53                   	push   %ebx
+  801be1:	83 ec 0c             	sub    $0xc,%esp
+  801be4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801be7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801bea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bef:	eb 02                	jmp    801bf3 <readn+0x18>
+  801bf1:	01 c3                	add    %eax,%ebx
+  801bf3:	39 f3                	cmp    %esi,%ebx
+  801bf5:	73 21                	jae    801c18 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bf7:	83 ec 04             	sub    $0x4,%esp
+  801bfa:	89 f0                	mov    %esi,%eax
+  801bfc:	29 d8                	sub    %ebx,%eax
+  801bfe:	50                   	push   %eax
+  801bff:	89 d8                	mov    %ebx,%eax
+  801c01:	03 45 0c             	add    0xc(%ebp),%eax
+  801c04:	50                   	push   %eax
+  801c05:	57                   	push   %edi
+  801c06:	e8 29 ff ff ff       	call   801b34 <read>
+		if (m < 0)
+  801c0b:	83 c4 10             	add    $0x10,%esp
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	78 04                	js     801c16 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c12:	75 dd                	jne    801bf1 <readn+0x16>
+  801c14:	eb 02                	jmp    801c18 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c16:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c18:	89 d8                	mov    %ebx,%eax
+  801c1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c1d:	5b                   	pop    %ebx
+  801c1e:	5e                   	pop    %esi
+  801c1f:	5f                   	pop    %edi
+  801c20:	5d                   	pop    %ebp
+  801c21:	c3                   	ret
+
+00801c22 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	56                   	push   %esi
+  801c26:	53                   	push   %ebx
+  801c27:	83 ec 18             	sub    $0x18,%esp
+  801c2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c2d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c30:	50                   	push   %eax
+  801c31:	53                   	push   %ebx
+  801c32:	e8 77 fc ff ff       	call   8018ae <fd_lookup>
+  801c37:	83 c4 10             	add    $0x10,%esp
+  801c3a:	85 c0                	test   %eax,%eax
+  801c3c:	78 37                	js     801c75 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c3e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c41:	83 ec 08             	sub    $0x8,%esp
+  801c44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c47:	50                   	push   %eax
+  801c48:	ff 36                	push   (%esi)
+  801c4a:	e8 af fc ff ff       	call   8018fe <dev_lookup>
+  801c4f:	83 c4 10             	add    $0x10,%esp
+  801c52:	85 c0                	test   %eax,%eax
+  801c54:	78 1f                	js     801c75 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c56:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c5a:	74 20                	je     801c7c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c5f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c62:	85 c0                	test   %eax,%eax
+  801c64:	74 57                	je     801cbd <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c66:	83 ec 04             	sub    $0x4,%esp
+  801c69:	ff 75 10             	push   0x10(%ebp)
+  801c6c:	ff 75 0c             	push   0xc(%ebp)
+  801c6f:	56                   	push   %esi
+  801c70:	ff d0                	call   *%eax
+  801c72:	83 c4 10             	add    $0x10,%esp
+}
+  801c75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c78:	5b                   	pop    %ebx
+  801c79:	5e                   	pop    %esi
+  801c7a:	5d                   	pop    %ebp
+  801c7b:	c3                   	ret
+  801c7c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c7e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c83:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c89:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c8e:	76 1c                	jbe    801cac <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c90:	8b 42 48             	mov    0x48(%edx),%eax
+  801c93:	83 ec 04             	sub    $0x4,%esp
+  801c96:	53                   	push   %ebx
+  801c97:	50                   	push   %eax
+  801c98:	68 b5 30 80 00       	push   $0x8030b5
+  801c9d:	e8 d9 e5 ff ff       	call   80027b <cprintf>
+		return -E_INVAL;
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801caa:	eb c9                	jmp    801c75 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cac:	c1 e8 10             	shr    $0x10,%eax
+  801caf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cb5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cbb:	eb d3                	jmp    801c90 <write+0x6e>
+		return -E_NOT_SUPP;
+  801cbd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cc2:	eb b1                	jmp    801c75 <write+0x53>
+
+00801cc4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cc4:	55                   	push   %ebp
+  801cc5:	89 e5                	mov    %esp,%ebp
+  801cc7:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ccd:	50                   	push   %eax
+  801cce:	ff 75 08             	push   0x8(%ebp)
+  801cd1:	e8 d8 fb ff ff       	call   8018ae <fd_lookup>
+  801cd6:	83 c4 10             	add    $0x10,%esp
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	78 0e                	js     801ceb <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801cdd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ce0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ceb:	c9                   	leave
+  801cec:	c3                   	ret
+
+00801ced <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ced:	55                   	push   %ebp
+  801cee:	89 e5                	mov    %esp,%ebp
+  801cf0:	56                   	push   %esi
+  801cf1:	53                   	push   %ebx
+  801cf2:	83 ec 18             	sub    $0x18,%esp
+  801cf5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cf8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cfb:	50                   	push   %eax
+  801cfc:	53                   	push   %ebx
+  801cfd:	e8 ac fb ff ff       	call   8018ae <fd_lookup>
+  801d02:	83 c4 10             	add    $0x10,%esp
+  801d05:	85 c0                	test   %eax,%eax
+  801d07:	78 34                	js     801d3d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d09:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d0c:	83 ec 08             	sub    $0x8,%esp
+  801d0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d12:	50                   	push   %eax
+  801d13:	ff 36                	push   (%esi)
+  801d15:	e8 e4 fb ff ff       	call   8018fe <dev_lookup>
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	78 1c                	js     801d3d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d21:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d25:	74 1d                	je     801d44 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d2a:	8b 40 18             	mov    0x18(%eax),%eax
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	74 54                	je     801d85 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d31:	83 ec 08             	sub    $0x8,%esp
+  801d34:	ff 75 0c             	push   0xc(%ebp)
+  801d37:	56                   	push   %esi
+  801d38:	ff d0                	call   *%eax
+  801d3a:	83 c4 10             	add    $0x10,%esp
+}
+  801d3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d40:	5b                   	pop    %ebx
+  801d41:	5e                   	pop    %esi
+  801d42:	5d                   	pop    %ebp
+  801d43:	c3                   	ret
+  801d44:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d46:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d4b:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d51:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d56:	76 1c                	jbe    801d74 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801d58:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d5b:	83 ec 04             	sub    $0x4,%esp
+  801d5e:	53                   	push   %ebx
+  801d5f:	50                   	push   %eax
+  801d60:	68 78 30 80 00       	push   $0x803078
+  801d65:	e8 11 e5 ff ff       	call   80027b <cprintf>
+		return -E_INVAL;
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d72:	eb c9                	jmp    801d3d <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d74:	c1 e8 10             	shr    $0x10,%eax
+  801d77:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d7d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d83:	eb d3                	jmp    801d58 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801d85:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d8a:	eb b1                	jmp    801d3d <ftruncate+0x50>
+
+00801d8c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 18             	sub    $0x18,%esp
+  801d94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d9a:	50                   	push   %eax
+  801d9b:	ff 75 08             	push   0x8(%ebp)
+  801d9e:	e8 0b fb ff ff       	call   8018ae <fd_lookup>
+  801da3:	83 c4 10             	add    $0x10,%esp
+  801da6:	85 c0                	test   %eax,%eax
+  801da8:	78 49                	js     801df3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801daa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dad:	83 ec 08             	sub    $0x8,%esp
+  801db0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db3:	50                   	push   %eax
+  801db4:	ff 36                	push   (%esi)
+  801db6:	e8 43 fb ff ff       	call   8018fe <dev_lookup>
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	78 31                	js     801df3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801dc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dc9:	74 2f                	je     801dfa <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801dcb:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801dce:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801dd5:	00 00 00 
+	stat->st_isdir = 0;
+  801dd8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ddf:	00 00 00 
+	stat->st_dev = dev;
+  801de2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801de8:	83 ec 08             	sub    $0x8,%esp
+  801deb:	53                   	push   %ebx
+  801dec:	56                   	push   %esi
+  801ded:	ff 50 14             	call   *0x14(%eax)
+  801df0:	83 c4 10             	add    $0x10,%esp
+}
+  801df3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df6:	5b                   	pop    %ebx
+  801df7:	5e                   	pop    %esi
+  801df8:	5d                   	pop    %ebp
+  801df9:	c3                   	ret
+		return -E_NOT_SUPP;
+  801dfa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dff:	eb f2                	jmp    801df3 <fstat+0x67>
+
+00801e01 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e01:	55                   	push   %ebp
+  801e02:	89 e5                	mov    %esp,%ebp
+  801e04:	56                   	push   %esi
+  801e05:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e06:	83 ec 08             	sub    $0x8,%esp
+  801e09:	6a 00                	push   $0x0
+  801e0b:	ff 75 08             	push   0x8(%ebp)
+  801e0e:	e8 e4 01 00 00       	call   801ff7 <open>
+  801e13:	89 c3                	mov    %eax,%ebx
+  801e15:	83 c4 10             	add    $0x10,%esp
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	78 1b                	js     801e37 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e1c:	83 ec 08             	sub    $0x8,%esp
+  801e1f:	ff 75 0c             	push   0xc(%ebp)
+  801e22:	50                   	push   %eax
+  801e23:	e8 64 ff ff ff       	call   801d8c <fstat>
+  801e28:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e2a:	89 1c 24             	mov    %ebx,(%esp)
+  801e2d:	e8 c6 fb ff ff       	call   8019f8 <close>
+	return r;
+  801e32:	83 c4 10             	add    $0x10,%esp
+  801e35:	89 f3                	mov    %esi,%ebx
+}
+  801e37:	89 d8                	mov    %ebx,%eax
+  801e39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e3c:	5b                   	pop    %ebx
+  801e3d:	5e                   	pop    %esi
+  801e3e:	5d                   	pop    %ebp
+  801e3f:	c3                   	ret
+
+00801e40 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	56                   	push   %esi
+  801e44:	53                   	push   %ebx
+  801e45:	89 c6                	mov    %eax,%esi
+  801e47:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e49:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801e50:	74 27                	je     801e79 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e52:	6a 07                	push   $0x7
+  801e54:	68 00 60 c0 00       	push   $0xc06000
+  801e59:	56                   	push   %esi
+  801e5a:	ff 35 00 50 80 00    	push   0x805000
+  801e60:	e8 b2 0c 00 00       	call   802b17 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e65:	83 c4 0c             	add    $0xc,%esp
+  801e68:	6a 00                	push   $0x0
+  801e6a:	53                   	push   %ebx
+  801e6b:	6a 00                	push   $0x0
+  801e6d:	e8 8d 0c 00 00       	call   802aff <ipc_recv>
+}
+  801e72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e75:	5b                   	pop    %ebx
+  801e76:	5e                   	pop    %esi
+  801e77:	5d                   	pop    %ebp
+  801e78:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e79:	83 ec 0c             	sub    $0xc,%esp
+  801e7c:	6a 01                	push   $0x1
+  801e7e:	e8 e8 0c 00 00       	call   802b6b <ipc_find_env>
+  801e83:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e88:	83 c4 10             	add    $0x10,%esp
+  801e8b:	eb c5                	jmp    801e52 <fsipc+0x12>
+
+00801e8d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e8d:	55                   	push   %ebp
+  801e8e:	89 e5                	mov    %esp,%ebp
+  801e90:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e93:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e96:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e99:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	fsipcbuf.set_size.req_size = newsize;
+  801e9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ea1:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ea6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eab:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eb0:	e8 8b ff ff ff       	call   801e40 <fsipc>
+}
+  801eb5:	c9                   	leave
+  801eb6:	c3                   	ret
+
+00801eb7 <devfile_flush>:
+{
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ec3:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801ec8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ecd:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ed2:	e8 69 ff ff ff       	call   801e40 <fsipc>
+}
+  801ed7:	c9                   	leave
+  801ed8:	c3                   	ret
+
+00801ed9 <devfile_stat>:
+{
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	53                   	push   %ebx
+  801edd:	83 ec 04             	sub    $0x4,%esp
+  801ee0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ee3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee9:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801eee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef3:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ef8:	e8 43 ff ff ff       	call   801e40 <fsipc>
+  801efd:	85 c0                	test   %eax,%eax
+  801eff:	78 2c                	js     801f2d <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f01:	83 ec 08             	sub    $0x8,%esp
+  801f04:	68 00 60 c0 00       	push   $0xc06000
+  801f09:	53                   	push   %ebx
+  801f0a:	e8 b4 e9 ff ff       	call   8008c3 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f0f:	a1 80 60 c0 00       	mov    0xc06080,%eax
+  801f14:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f1a:	a1 84 60 c0 00       	mov    0xc06084,%eax
+  801f1f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f25:	83 c4 10             	add    $0x10,%esp
+  801f28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f30:	c9                   	leave
+  801f31:	c3                   	ret
+
+00801f32 <devfile_write>:
+{
+  801f32:	55                   	push   %ebp
+  801f33:	89 e5                	mov    %esp,%ebp
+  801f35:	83 ec 0c             	sub    $0xc,%esp
+  801f38:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f3e:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f41:	89 15 00 60 c0 00    	mov    %edx,0xc06000
+	fsipcbuf.write.req_n = n;
+  801f47:	a3 04 60 c0 00       	mov    %eax,0xc06004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801f4c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f51:	39 d0                	cmp    %edx,%eax
+  801f53:	0f 47 c2             	cmova  %edx,%eax
+  801f56:	50                   	push   %eax
+  801f57:	ff 75 0c             	push   0xc(%ebp)
+  801f5a:	68 08 60 c0 00       	push   $0xc06008
+  801f5f:	e8 e5 ea ff ff       	call   800a49 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f69:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f6e:	e8 cd fe ff ff       	call   801e40 <fsipc>
+}
+  801f73:	c9                   	leave
+  801f74:	c3                   	ret
+
+00801f75 <devfile_read>:
+{
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	56                   	push   %esi
+  801f79:	53                   	push   %ebx
+  801f7a:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f80:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f83:	a3 00 60 c0 00       	mov    %eax,0xc06000
+	fsipcbuf.read.req_n = n;
+  801f88:	89 35 04 60 c0 00    	mov    %esi,0xc06004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f93:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f98:	e8 a3 fe ff ff       	call   801e40 <fsipc>
+  801f9d:	89 c3                	mov    %eax,%ebx
+  801f9f:	85 c0                	test   %eax,%eax
+  801fa1:	78 1f                	js     801fc2 <devfile_read+0x4d>
+	assert(r <= n);
+  801fa3:	39 c6                	cmp    %eax,%esi
+  801fa5:	72 24                	jb     801fcb <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801fa7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fac:	7f 33                	jg     801fe1 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fae:	83 ec 04             	sub    $0x4,%esp
+  801fb1:	50                   	push   %eax
+  801fb2:	68 00 60 c0 00       	push   $0xc06000
+  801fb7:	ff 75 0c             	push   0xc(%ebp)
+  801fba:	e8 8a ea ff ff       	call   800a49 <memmove>
+	return r;
+  801fbf:	83 c4 10             	add    $0x10,%esp
+}
+  801fc2:	89 d8                	mov    %ebx,%eax
+  801fc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc7:	5b                   	pop    %ebx
+  801fc8:	5e                   	pop    %esi
+  801fc9:	5d                   	pop    %ebp
+  801fca:	c3                   	ret
+	assert(r <= n);
+  801fcb:	68 e8 30 80 00       	push   $0x8030e8
+  801fd0:	68 ef 30 80 00       	push   $0x8030ef
+  801fd5:	6a 76                	push   $0x76
+  801fd7:	68 04 31 80 00       	push   $0x803104
+  801fdc:	e8 bf e1 ff ff       	call   8001a0 <_panic>
+	assert(r <= PGSIZE);
+  801fe1:	68 0f 31 80 00       	push   $0x80310f
+  801fe6:	68 ef 30 80 00       	push   $0x8030ef
+  801feb:	6a 77                	push   $0x77
+  801fed:	68 04 31 80 00       	push   $0x803104
+  801ff2:	e8 a9 e1 ff ff       	call   8001a0 <_panic>
+
+00801ff7 <open>:
+{
+  801ff7:	55                   	push   %ebp
+  801ff8:	89 e5                	mov    %esp,%ebp
+  801ffa:	56                   	push   %esi
+  801ffb:	53                   	push   %ebx
+  801ffc:	83 ec 1c             	sub    $0x1c,%esp
+  801fff:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802002:	56                   	push   %esi
+  802003:	e8 80 e8 ff ff       	call   800888 <strlen>
+  802008:	83 c4 10             	add    $0x10,%esp
+  80200b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802010:	7f 6c                	jg     80207e <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802012:	83 ec 0c             	sub    $0xc,%esp
+  802015:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802018:	50                   	push   %eax
+  802019:	e8 3a f8 ff ff       	call   801858 <fd_alloc>
+  80201e:	89 c3                	mov    %eax,%ebx
+  802020:	83 c4 10             	add    $0x10,%esp
+  802023:	85 c0                	test   %eax,%eax
+  802025:	78 3c                	js     802063 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802027:	83 ec 08             	sub    $0x8,%esp
+  80202a:	56                   	push   %esi
+  80202b:	68 00 60 c0 00       	push   $0xc06000
+  802030:	e8 8e e8 ff ff       	call   8008c3 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802035:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802038:	a3 00 64 c0 00       	mov    %eax,0xc06400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80203d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802040:	b8 01 00 00 00       	mov    $0x1,%eax
+  802045:	e8 f6 fd ff ff       	call   801e40 <fsipc>
+  80204a:	89 c3                	mov    %eax,%ebx
+  80204c:	83 c4 10             	add    $0x10,%esp
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	78 19                	js     80206c <open+0x75>
+	return fd2num(fd);
+  802053:	83 ec 0c             	sub    $0xc,%esp
+  802056:	ff 75 f4             	push   -0xc(%ebp)
+  802059:	e8 d3 f7 ff ff       	call   801831 <fd2num>
+  80205e:	89 c3                	mov    %eax,%ebx
+  802060:	83 c4 10             	add    $0x10,%esp
+}
+  802063:	89 d8                	mov    %ebx,%eax
+  802065:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802068:	5b                   	pop    %ebx
+  802069:	5e                   	pop    %esi
+  80206a:	5d                   	pop    %ebp
+  80206b:	c3                   	ret
+		fd_close(fd, 0);
+  80206c:	83 ec 08             	sub    $0x8,%esp
+  80206f:	6a 00                	push   $0x0
+  802071:	ff 75 f4             	push   -0xc(%ebp)
+  802074:	e8 f8 f8 ff ff       	call   801971 <fd_close>
+		return r;
+  802079:	83 c4 10             	add    $0x10,%esp
+  80207c:	eb e5                	jmp    802063 <open+0x6c>
+		return -E_BAD_PATH;
+  80207e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802083:	eb de                	jmp    802063 <open+0x6c>
+
+00802085 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80208b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802090:	b8 08 00 00 00       	mov    $0x8,%eax
+  802095:	e8 a6 fd ff ff       	call   801e40 <fsipc>
+}
+  80209a:	c9                   	leave
+  80209b:	c3                   	ret
+
+0080209c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80209c:	55                   	push   %ebp
+  80209d:	89 e5                	mov    %esp,%ebp
+  80209f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8020a2:	68 1b 31 80 00       	push   $0x80311b
+  8020a7:	ff 75 0c             	push   0xc(%ebp)
+  8020aa:	e8 14 e8 ff ff       	call   8008c3 <strcpy>
+	return 0;
+}
+  8020af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b4:	c9                   	leave
+  8020b5:	c3                   	ret
+
+008020b6 <devsock_close>:
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	53                   	push   %ebx
+  8020ba:	83 ec 10             	sub    $0x10,%esp
+  8020bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8020c0:	53                   	push   %ebx
+  8020c1:	e8 e4 0a 00 00       	call   802baa <pageref>
+  8020c6:	89 c2                	mov    %eax,%edx
+  8020c8:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020cb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8020d0:	83 fa 01             	cmp    $0x1,%edx
+  8020d3:	74 05                	je     8020da <devsock_close+0x24>
+}
+  8020d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d8:	c9                   	leave
+  8020d9:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8020da:	83 ec 0c             	sub    $0xc,%esp
+  8020dd:	ff 73 0c             	push   0xc(%ebx)
+  8020e0:	e8 b7 02 00 00       	call   80239c <nsipc_close>
+  8020e5:	83 c4 10             	add    $0x10,%esp
+  8020e8:	eb eb                	jmp    8020d5 <devsock_close+0x1f>
+
+008020ea <devsock_write>:
+{
+  8020ea:	55                   	push   %ebp
+  8020eb:	89 e5                	mov    %esp,%ebp
+  8020ed:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8020f0:	6a 00                	push   $0x0
+  8020f2:	ff 75 10             	push   0x10(%ebp)
+  8020f5:	ff 75 0c             	push   0xc(%ebp)
+  8020f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020fb:	ff 70 0c             	push   0xc(%eax)
+  8020fe:	e8 79 03 00 00       	call   80247c <nsipc_send>
+}
+  802103:	c9                   	leave
+  802104:	c3                   	ret
+
+00802105 <devsock_read>:
+{
+  802105:	55                   	push   %ebp
+  802106:	89 e5                	mov    %esp,%ebp
+  802108:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80210b:	6a 00                	push   $0x0
+  80210d:	ff 75 10             	push   0x10(%ebp)
+  802110:	ff 75 0c             	push   0xc(%ebp)
+  802113:	8b 45 08             	mov    0x8(%ebp),%eax
+  802116:	ff 70 0c             	push   0xc(%eax)
+  802119:	e8 ef 02 00 00       	call   80240d <nsipc_recv>
+}
+  80211e:	c9                   	leave
+  80211f:	c3                   	ret
+
+00802120 <fd2sockid>:
+{
+  802120:	55                   	push   %ebp
+  802121:	89 e5                	mov    %esp,%ebp
+  802123:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802126:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802129:	52                   	push   %edx
+  80212a:	50                   	push   %eax
+  80212b:	e8 7e f7 ff ff       	call   8018ae <fd_lookup>
+  802130:	83 c4 10             	add    $0x10,%esp
+  802133:	85 c0                	test   %eax,%eax
+  802135:	78 10                	js     802147 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802137:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80213a:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802140:	39 08                	cmp    %ecx,(%eax)
+  802142:	75 05                	jne    802149 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802144:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802147:	c9                   	leave
+  802148:	c3                   	ret
+		return -E_NOT_SUPP;
+  802149:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80214e:	eb f7                	jmp    802147 <fd2sockid+0x27>
+
+00802150 <alloc_sockfd>:
+{
+  802150:	55                   	push   %ebp
+  802151:	89 e5                	mov    %esp,%ebp
+  802153:	56                   	push   %esi
+  802154:	53                   	push   %ebx
+  802155:	83 ec 1c             	sub    $0x1c,%esp
+  802158:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80215a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215d:	50                   	push   %eax
+  80215e:	e8 f5 f6 ff ff       	call   801858 <fd_alloc>
+  802163:	89 c3                	mov    %eax,%ebx
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	85 c0                	test   %eax,%eax
+  80216a:	78 43                	js     8021af <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80216c:	83 ec 04             	sub    $0x4,%esp
+  80216f:	68 07 04 00 00       	push   $0x407
+  802174:	ff 75 f4             	push   -0xc(%ebp)
+  802177:	6a 00                	push   $0x0
+  802179:	e8 3d ec ff ff       	call   800dbb <sys_page_alloc>
+  80217e:	89 c3                	mov    %eax,%ebx
+  802180:	83 c4 10             	add    $0x10,%esp
+  802183:	85 c0                	test   %eax,%eax
+  802185:	78 28                	js     8021af <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802187:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80218a:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802190:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802192:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802195:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80219c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80219f:	83 ec 0c             	sub    $0xc,%esp
+  8021a2:	50                   	push   %eax
+  8021a3:	e8 89 f6 ff ff       	call   801831 <fd2num>
+  8021a8:	89 c3                	mov    %eax,%ebx
+  8021aa:	83 c4 10             	add    $0x10,%esp
+  8021ad:	eb 0c                	jmp    8021bb <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8021af:	83 ec 0c             	sub    $0xc,%esp
+  8021b2:	56                   	push   %esi
+  8021b3:	e8 e4 01 00 00       	call   80239c <nsipc_close>
+		return r;
+  8021b8:	83 c4 10             	add    $0x10,%esp
+}
+  8021bb:	89 d8                	mov    %ebx,%eax
+  8021bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c0:	5b                   	pop    %ebx
+  8021c1:	5e                   	pop    %esi
+  8021c2:	5d                   	pop    %ebp
+  8021c3:	c3                   	ret
+
+008021c4 <accept>:
+{
+  8021c4:	55                   	push   %ebp
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021cd:	e8 4e ff ff ff       	call   802120 <fd2sockid>
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 1b                	js     8021f1 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8021d6:	83 ec 04             	sub    $0x4,%esp
+  8021d9:	ff 75 10             	push   0x10(%ebp)
+  8021dc:	ff 75 0c             	push   0xc(%ebp)
+  8021df:	50                   	push   %eax
+  8021e0:	e8 0e 01 00 00       	call   8022f3 <nsipc_accept>
+  8021e5:	83 c4 10             	add    $0x10,%esp
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	78 05                	js     8021f1 <accept+0x2d>
+	return alloc_sockfd(r);
+  8021ec:	e8 5f ff ff ff       	call   802150 <alloc_sockfd>
+}
+  8021f1:	c9                   	leave
+  8021f2:	c3                   	ret
+
+008021f3 <bind>:
+{
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fc:	e8 1f ff ff ff       	call   802120 <fd2sockid>
+  802201:	85 c0                	test   %eax,%eax
+  802203:	78 12                	js     802217 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802205:	83 ec 04             	sub    $0x4,%esp
+  802208:	ff 75 10             	push   0x10(%ebp)
+  80220b:	ff 75 0c             	push   0xc(%ebp)
+  80220e:	50                   	push   %eax
+  80220f:	e8 31 01 00 00       	call   802345 <nsipc_bind>
+  802214:	83 c4 10             	add    $0x10,%esp
+}
+  802217:	c9                   	leave
+  802218:	c3                   	ret
+
+00802219 <shutdown>:
+{
+  802219:	55                   	push   %ebp
+  80221a:	89 e5                	mov    %esp,%ebp
+  80221c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80221f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802222:	e8 f9 fe ff ff       	call   802120 <fd2sockid>
+  802227:	85 c0                	test   %eax,%eax
+  802229:	78 0f                	js     80223a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80222b:	83 ec 08             	sub    $0x8,%esp
+  80222e:	ff 75 0c             	push   0xc(%ebp)
+  802231:	50                   	push   %eax
+  802232:	e8 43 01 00 00       	call   80237a <nsipc_shutdown>
+  802237:	83 c4 10             	add    $0x10,%esp
+}
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+
+0080223c <connect>:
+{
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802242:	8b 45 08             	mov    0x8(%ebp),%eax
+  802245:	e8 d6 fe ff ff       	call   802120 <fd2sockid>
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	78 12                	js     802260 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80224e:	83 ec 04             	sub    $0x4,%esp
+  802251:	ff 75 10             	push   0x10(%ebp)
+  802254:	ff 75 0c             	push   0xc(%ebp)
+  802257:	50                   	push   %eax
+  802258:	e8 59 01 00 00       	call   8023b6 <nsipc_connect>
+  80225d:	83 c4 10             	add    $0x10,%esp
+}
+  802260:	c9                   	leave
+  802261:	c3                   	ret
+
+00802262 <listen>:
+{
+  802262:	55                   	push   %ebp
+  802263:	89 e5                	mov    %esp,%ebp
+  802265:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802268:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226b:	e8 b0 fe ff ff       	call   802120 <fd2sockid>
+  802270:	85 c0                	test   %eax,%eax
+  802272:	78 0f                	js     802283 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802274:	83 ec 08             	sub    $0x8,%esp
+  802277:	ff 75 0c             	push   0xc(%ebp)
+  80227a:	50                   	push   %eax
+  80227b:	e8 6b 01 00 00       	call   8023eb <nsipc_listen>
+  802280:	83 c4 10             	add    $0x10,%esp
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+00802285 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80228b:	ff 75 10             	push   0x10(%ebp)
+  80228e:	ff 75 0c             	push   0xc(%ebp)
+  802291:	ff 75 08             	push   0x8(%ebp)
+  802294:	e8 41 02 00 00       	call   8024da <nsipc_socket>
+  802299:	83 c4 10             	add    $0x10,%esp
+  80229c:	85 c0                	test   %eax,%eax
+  80229e:	78 05                	js     8022a5 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8022a0:	e8 ab fe ff ff       	call   802150 <alloc_sockfd>
+}
+  8022a5:	c9                   	leave
+  8022a6:	c3                   	ret
+
+008022a7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8022a7:	55                   	push   %ebp
+  8022a8:	89 e5                	mov    %esp,%ebp
+  8022aa:	53                   	push   %ebx
+  8022ab:	83 ec 04             	sub    $0x4,%esp
+  8022ae:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8022b0:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8022b7:	74 26                	je     8022df <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8022b9:	6a 07                	push   $0x7
+  8022bb:	68 00 70 c0 00       	push   $0xc07000
+  8022c0:	53                   	push   %ebx
+  8022c1:	ff 35 04 50 80 00    	push   0x805004
+  8022c7:	e8 4b 08 00 00       	call   802b17 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8022cc:	83 c4 0c             	add    $0xc,%esp
+  8022cf:	6a 00                	push   $0x0
+  8022d1:	6a 00                	push   $0x0
+  8022d3:	6a 00                	push   $0x0
+  8022d5:	e8 25 08 00 00       	call   802aff <ipc_recv>
+}
+  8022da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022dd:	c9                   	leave
+  8022de:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8022df:	83 ec 0c             	sub    $0xc,%esp
+  8022e2:	6a 02                	push   $0x2
+  8022e4:	e8 82 08 00 00       	call   802b6b <ipc_find_env>
+  8022e9:	a3 04 50 80 00       	mov    %eax,0x805004
+  8022ee:	83 c4 10             	add    $0x10,%esp
+  8022f1:	eb c6                	jmp    8022b9 <nsipc+0x12>
+
+008022f3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8022f3:	55                   	push   %ebp
+  8022f4:	89 e5                	mov    %esp,%ebp
+  8022f6:	56                   	push   %esi
+  8022f7:	53                   	push   %ebx
+  8022f8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8022fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022fe:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802303:	8b 06                	mov    (%esi),%eax
+  802305:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80230a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80230f:	e8 93 ff ff ff       	call   8022a7 <nsipc>
+  802314:	89 c3                	mov    %eax,%ebx
+  802316:	85 c0                	test   %eax,%eax
+  802318:	79 09                	jns    802323 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80231a:	89 d8                	mov    %ebx,%eax
+  80231c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80231f:	5b                   	pop    %ebx
+  802320:	5e                   	pop    %esi
+  802321:	5d                   	pop    %ebp
+  802322:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802323:	83 ec 04             	sub    $0x4,%esp
+  802326:	ff 35 10 70 c0 00    	push   0xc07010
+  80232c:	68 00 70 c0 00       	push   $0xc07000
+  802331:	ff 75 0c             	push   0xc(%ebp)
+  802334:	e8 10 e7 ff ff       	call   800a49 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802339:	a1 10 70 c0 00       	mov    0xc07010,%eax
+  80233e:	89 06                	mov    %eax,(%esi)
+  802340:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802343:	eb d5                	jmp    80231a <nsipc_accept+0x27>
+
+00802345 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802345:	55                   	push   %ebp
+  802346:	89 e5                	mov    %esp,%ebp
+  802348:	53                   	push   %ebx
+  802349:	83 ec 08             	sub    $0x8,%esp
+  80234c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80234f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802352:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802357:	53                   	push   %ebx
+  802358:	ff 75 0c             	push   0xc(%ebp)
+  80235b:	68 04 70 c0 00       	push   $0xc07004
+  802360:	e8 e4 e6 ff ff       	call   800a49 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802365:	89 1d 14 70 c0 00    	mov    %ebx,0xc07014
+	return nsipc(NSREQ_BIND);
+  80236b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802370:	e8 32 ff ff ff       	call   8022a7 <nsipc>
+}
+  802375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802378:	c9                   	leave
+  802379:	c3                   	ret
+
+0080237a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80237a:	55                   	push   %ebp
+  80237b:	89 e5                	mov    %esp,%ebp
+  80237d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802380:	8b 45 08             	mov    0x8(%ebp),%eax
+  802383:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	nsipcbuf.shutdown.req_how = how;
+  802388:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80238b:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	return nsipc(NSREQ_SHUTDOWN);
+  802390:	b8 03 00 00 00       	mov    $0x3,%eax
+  802395:	e8 0d ff ff ff       	call   8022a7 <nsipc>
+}
+  80239a:	c9                   	leave
+  80239b:	c3                   	ret
+
+0080239c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80239c:	55                   	push   %ebp
+  80239d:	89 e5                	mov    %esp,%ebp
+  80239f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8023a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a5:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	return nsipc(NSREQ_CLOSE);
+  8023aa:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023af:	e8 f3 fe ff ff       	call   8022a7 <nsipc>
+}
+  8023b4:	c9                   	leave
+  8023b5:	c3                   	ret
+
+008023b6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8023b6:	55                   	push   %ebp
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	53                   	push   %ebx
+  8023ba:	83 ec 08             	sub    $0x8,%esp
+  8023bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8023c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c3:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8023c8:	53                   	push   %ebx
+  8023c9:	ff 75 0c             	push   0xc(%ebp)
+  8023cc:	68 04 70 c0 00       	push   $0xc07004
+  8023d1:	e8 73 e6 ff ff       	call   800a49 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8023d6:	89 1d 14 70 c0 00    	mov    %ebx,0xc07014
+	return nsipc(NSREQ_CONNECT);
+  8023dc:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023e1:	e8 c1 fe ff ff       	call   8022a7 <nsipc>
+}
+  8023e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e9:	c9                   	leave
+  8023ea:	c3                   	ret
+
+008023eb <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8023eb:	55                   	push   %ebp
+  8023ec:	89 e5                	mov    %esp,%ebp
+  8023ee:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8023f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f4:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	nsipcbuf.listen.req_backlog = backlog;
+  8023f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023fc:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	return nsipc(NSREQ_LISTEN);
+  802401:	b8 06 00 00 00       	mov    $0x6,%eax
+  802406:	e8 9c fe ff ff       	call   8022a7 <nsipc>
+}
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+
+0080240d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80240d:	55                   	push   %ebp
+  80240e:	89 e5                	mov    %esp,%ebp
+  802410:	56                   	push   %esi
+  802411:	53                   	push   %ebx
+  802412:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802415:	8b 45 08             	mov    0x8(%ebp),%eax
+  802418:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	nsipcbuf.recv.req_len = len;
+  80241d:	89 35 04 70 c0 00    	mov    %esi,0xc07004
+	nsipcbuf.recv.req_flags = flags;
+  802423:	8b 45 14             	mov    0x14(%ebp),%eax
+  802426:	a3 08 70 c0 00       	mov    %eax,0xc07008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80242b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802430:	e8 72 fe ff ff       	call   8022a7 <nsipc>
+  802435:	89 c3                	mov    %eax,%ebx
+  802437:	85 c0                	test   %eax,%eax
+  802439:	78 22                	js     80245d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80243b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802440:	39 c6                	cmp    %eax,%esi
+  802442:	0f 4e c6             	cmovle %esi,%eax
+  802445:	39 c3                	cmp    %eax,%ebx
+  802447:	7f 1d                	jg     802466 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802449:	83 ec 04             	sub    $0x4,%esp
+  80244c:	53                   	push   %ebx
+  80244d:	68 00 70 c0 00       	push   $0xc07000
+  802452:	ff 75 0c             	push   0xc(%ebp)
+  802455:	e8 ef e5 ff ff       	call   800a49 <memmove>
+  80245a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80245d:	89 d8                	mov    %ebx,%eax
+  80245f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802462:	5b                   	pop    %ebx
+  802463:	5e                   	pop    %esi
+  802464:	5d                   	pop    %ebp
+  802465:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802466:	68 27 31 80 00       	push   $0x803127
+  80246b:	68 ef 30 80 00       	push   $0x8030ef
+  802470:	6a 62                	push   $0x62
+  802472:	68 3c 31 80 00       	push   $0x80313c
+  802477:	e8 24 dd ff ff       	call   8001a0 <_panic>
+
+0080247c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80247c:	55                   	push   %ebp
+  80247d:	89 e5                	mov    %esp,%ebp
+  80247f:	53                   	push   %ebx
+  802480:	83 ec 04             	sub    $0x4,%esp
+  802483:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802486:	8b 45 08             	mov    0x8(%ebp),%eax
+  802489:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	assert(size < 1600);
+  80248e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802494:	7f 2e                	jg     8024c4 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802496:	83 ec 04             	sub    $0x4,%esp
+  802499:	53                   	push   %ebx
+  80249a:	ff 75 0c             	push   0xc(%ebp)
+  80249d:	68 0c 70 c0 00       	push   $0xc0700c
+  8024a2:	e8 a2 e5 ff ff       	call   800a49 <memmove>
+	nsipcbuf.send.req_size = size;
+  8024a7:	89 1d 04 70 c0 00    	mov    %ebx,0xc07004
+	nsipcbuf.send.req_flags = flags;
+  8024ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024b0:	a3 08 70 c0 00       	mov    %eax,0xc07008
+	return nsipc(NSREQ_SEND);
+  8024b5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024ba:	e8 e8 fd ff ff       	call   8022a7 <nsipc>
+}
+  8024bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c2:	c9                   	leave
+  8024c3:	c3                   	ret
+	assert(size < 1600);
+  8024c4:	68 48 31 80 00       	push   $0x803148
+  8024c9:	68 ef 30 80 00       	push   $0x8030ef
+  8024ce:	6a 6d                	push   $0x6d
+  8024d0:	68 3c 31 80 00       	push   $0x80313c
+  8024d5:	e8 c6 dc ff ff       	call   8001a0 <_panic>
+
+008024da <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8024e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e3:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	nsipcbuf.socket.req_type = type;
+  8024e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024eb:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	nsipcbuf.socket.req_protocol = protocol;
+  8024f0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024f3:	a3 08 70 c0 00       	mov    %eax,0xc07008
+	return nsipc(NSREQ_SOCKET);
+  8024f8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024fd:	e8 a5 fd ff ff       	call   8022a7 <nsipc>
+}
+  802502:	c9                   	leave
+  802503:	c3                   	ret
+
+00802504 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802504:	55                   	push   %ebp
+  802505:	89 e5                	mov    %esp,%ebp
+  802507:	56                   	push   %esi
+  802508:	53                   	push   %ebx
+  802509:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80250c:	83 ec 0c             	sub    $0xc,%esp
+  80250f:	ff 75 08             	push   0x8(%ebp)
+  802512:	e8 2a f3 ff ff       	call   801841 <fd2data>
+  802517:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802519:	83 c4 08             	add    $0x8,%esp
+  80251c:	68 54 31 80 00       	push   $0x803154
+  802521:	53                   	push   %ebx
+  802522:	e8 9c e3 ff ff       	call   8008c3 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802527:	8b 46 04             	mov    0x4(%esi),%eax
+  80252a:	2b 06                	sub    (%esi),%eax
+  80252c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802532:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802539:	00 00 00 
+	stat->st_dev = &devpipe;
+  80253c:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802543:	40 80 00 
+	return 0;
+}
+  802546:	b8 00 00 00 00       	mov    $0x0,%eax
+  80254b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80254e:	5b                   	pop    %ebx
+  80254f:	5e                   	pop    %esi
+  802550:	5d                   	pop    %ebp
+  802551:	c3                   	ret
+
+00802552 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802552:	55                   	push   %ebp
+  802553:	89 e5                	mov    %esp,%ebp
+  802555:	53                   	push   %ebx
+  802556:	83 ec 0c             	sub    $0xc,%esp
+  802559:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80255c:	53                   	push   %ebx
+  80255d:	6a 00                	push   $0x0
+  80255f:	e8 32 e9 ff ff       	call   800e96 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802564:	89 1c 24             	mov    %ebx,(%esp)
+  802567:	e8 d5 f2 ff ff       	call   801841 <fd2data>
+  80256c:	83 c4 08             	add    $0x8,%esp
+  80256f:	50                   	push   %eax
+  802570:	6a 00                	push   $0x0
+  802572:	e8 1f e9 ff ff       	call   800e96 <sys_page_unmap>
+}
+  802577:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80257a:	c9                   	leave
+  80257b:	c3                   	ret
+
+0080257c <_pipeisclosed>:
+{
+  80257c:	55                   	push   %ebp
+  80257d:	89 e5                	mov    %esp,%ebp
+  80257f:	57                   	push   %edi
+  802580:	56                   	push   %esi
+  802581:	53                   	push   %ebx
+  802582:	83 ec 1c             	sub    $0x1c,%esp
+  802585:	89 c7                	mov    %eax,%edi
+  802587:	89 d6                	mov    %edx,%esi
+  802589:	eb 3c                	jmp    8025c7 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  80258b:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  80258e:	83 ec 0c             	sub    $0xc,%esp
+  802591:	57                   	push   %edi
+  802592:	e8 13 06 00 00       	call   802baa <pageref>
+  802597:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80259a:	89 34 24             	mov    %esi,(%esp)
+  80259d:	e8 08 06 00 00       	call   802baa <pageref>
+  8025a2:	89 c2                	mov    %eax,%edx
+  8025a4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025a6:	05 00 00 00 20       	add    $0x20000000,%eax
+  8025ab:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8025ae:	8b 0d 20 50 c0 00    	mov    0xc05020,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025b4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025b9:	76 31                	jbe    8025ec <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8025bb:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8025be:	39 c3                	cmp    %eax,%ebx
+  8025c0:	74 76                	je     802638 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8025c2:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025c5:	74 36                	je     8025fd <_pipeisclosed+0x81>
+  8025c7:	89 e0                	mov    %esp,%eax
+  8025c9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025ce:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025d4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025d9:	77 b0                	ja     80258b <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025db:	c1 e8 10             	shr    $0x10,%eax
+  8025de:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025e4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025ea:	eb 9f                	jmp    80258b <_pipeisclosed+0xf>
+  8025ec:	c1 e8 10             	shr    $0x10,%eax
+  8025ef:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025f5:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8025fb:	eb be                	jmp    8025bb <_pipeisclosed+0x3f>
+  8025fd:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025ff:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802604:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80260a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80260f:	76 16                	jbe    802627 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802611:	8b 42 58             	mov    0x58(%edx),%eax
+  802614:	6a 01                	push   $0x1
+  802616:	50                   	push   %eax
+  802617:	53                   	push   %ebx
+  802618:	68 5b 31 80 00       	push   $0x80315b
+  80261d:	e8 59 dc ff ff       	call   80027b <cprintf>
+  802622:	83 c4 10             	add    $0x10,%esp
+  802625:	eb a0                	jmp    8025c7 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802627:	c1 e8 10             	shr    $0x10,%eax
+  80262a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802630:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802636:	eb d9                	jmp    802611 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802638:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80263b:	0f 94 c0             	sete   %al
+  80263e:	0f b6 c0             	movzbl %al,%eax
+}
+  802641:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802644:	5b                   	pop    %ebx
+  802645:	5e                   	pop    %esi
+  802646:	5f                   	pop    %edi
+  802647:	5d                   	pop    %ebp
+  802648:	c3                   	ret
+
+00802649 <devpipe_write>:
+{
+  802649:	55                   	push   %ebp
+  80264a:	89 e5                	mov    %esp,%ebp
+  80264c:	57                   	push   %edi
+  80264d:	56                   	push   %esi
+  80264e:	53                   	push   %ebx
+  80264f:	83 ec 28             	sub    $0x28,%esp
+  802652:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802655:	56                   	push   %esi
+  802656:	e8 e6 f1 ff ff       	call   801841 <fd2data>
+  80265b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80265d:	83 c4 10             	add    $0x10,%esp
+  802660:	bf 00 00 00 00       	mov    $0x0,%edi
+  802665:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802668:	75 09                	jne    802673 <devpipe_write+0x2a>
+	return i;
+  80266a:	89 f8                	mov    %edi,%eax
+  80266c:	eb 23                	jmp    802691 <devpipe_write+0x48>
+			sys_yield();
+  80266e:	e8 02 e7 ff ff       	call   800d75 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802673:	8b 43 04             	mov    0x4(%ebx),%eax
+  802676:	8b 0b                	mov    (%ebx),%ecx
+  802678:	8d 51 20             	lea    0x20(%ecx),%edx
+  80267b:	39 d0                	cmp    %edx,%eax
+  80267d:	72 1a                	jb     802699 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80267f:	89 da                	mov    %ebx,%edx
+  802681:	89 f0                	mov    %esi,%eax
+  802683:	e8 f4 fe ff ff       	call   80257c <_pipeisclosed>
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	74 e2                	je     80266e <devpipe_write+0x25>
+				return 0;
+  80268c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802691:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802694:	5b                   	pop    %ebx
+  802695:	5e                   	pop    %esi
+  802696:	5f                   	pop    %edi
+  802697:	5d                   	pop    %ebp
+  802698:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802699:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80269c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8026a0:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8026a3:	89 c2                	mov    %eax,%edx
+  8026a5:	c1 fa 1f             	sar    $0x1f,%edx
+  8026a8:	89 d1                	mov    %edx,%ecx
+  8026aa:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026ad:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026b0:	83 e2 1f             	and    $0x1f,%edx
+  8026b3:	29 ca                	sub    %ecx,%edx
+  8026b5:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8026b9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8026bd:	83 c0 01             	add    $0x1,%eax
+  8026c0:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8026c3:	83 c7 01             	add    $0x1,%edi
+  8026c6:	eb 9d                	jmp    802665 <devpipe_write+0x1c>
+
+008026c8 <devpipe_read>:
+{
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	57                   	push   %edi
+  8026cc:	56                   	push   %esi
+  8026cd:	53                   	push   %ebx
+  8026ce:	83 ec 18             	sub    $0x18,%esp
+  8026d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8026d4:	57                   	push   %edi
+  8026d5:	e8 67 f1 ff ff       	call   801841 <fd2data>
+  8026da:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8026dc:	83 c4 10             	add    $0x10,%esp
+  8026df:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8026e7:	75 13                	jne    8026fc <devpipe_read+0x34>
+	return i;
+  8026e9:	89 f0                	mov    %esi,%eax
+  8026eb:	eb 02                	jmp    8026ef <devpipe_read+0x27>
+				return i;
+  8026ed:	89 f0                	mov    %esi,%eax
+}
+  8026ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f2:	5b                   	pop    %ebx
+  8026f3:	5e                   	pop    %esi
+  8026f4:	5f                   	pop    %edi
+  8026f5:	5d                   	pop    %ebp
+  8026f6:	c3                   	ret
+			sys_yield();
+  8026f7:	e8 79 e6 ff ff       	call   800d75 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8026fc:	8b 03                	mov    (%ebx),%eax
+  8026fe:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802701:	75 18                	jne    80271b <devpipe_read+0x53>
+			if (i > 0)
+  802703:	85 f6                	test   %esi,%esi
+  802705:	75 e6                	jne    8026ed <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802707:	89 da                	mov    %ebx,%edx
+  802709:	89 f8                	mov    %edi,%eax
+  80270b:	e8 6c fe ff ff       	call   80257c <_pipeisclosed>
+  802710:	85 c0                	test   %eax,%eax
+  802712:	74 e3                	je     8026f7 <devpipe_read+0x2f>
+				return 0;
+  802714:	b8 00 00 00 00       	mov    $0x0,%eax
+  802719:	eb d4                	jmp    8026ef <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80271b:	99                   	cltd
+  80271c:	c1 ea 1b             	shr    $0x1b,%edx
+  80271f:	01 d0                	add    %edx,%eax
+  802721:	83 e0 1f             	and    $0x1f,%eax
+  802724:	29 d0                	sub    %edx,%eax
+  802726:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80272b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80272e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802731:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802734:	83 c6 01             	add    $0x1,%esi
+  802737:	eb ab                	jmp    8026e4 <devpipe_read+0x1c>
+
+00802739 <pipe>:
+{
+  802739:	55                   	push   %ebp
+  80273a:	89 e5                	mov    %esp,%ebp
+  80273c:	56                   	push   %esi
+  80273d:	53                   	push   %ebx
+  80273e:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802741:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802744:	50                   	push   %eax
+  802745:	e8 0e f1 ff ff       	call   801858 <fd_alloc>
+  80274a:	89 c3                	mov    %eax,%ebx
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	85 c0                	test   %eax,%eax
+  802751:	0f 88 23 01 00 00    	js     80287a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802757:	83 ec 04             	sub    $0x4,%esp
+  80275a:	68 07 04 00 00       	push   $0x407
+  80275f:	ff 75 f4             	push   -0xc(%ebp)
+  802762:	6a 00                	push   $0x0
+  802764:	e8 52 e6 ff ff       	call   800dbb <sys_page_alloc>
+  802769:	89 c3                	mov    %eax,%ebx
+  80276b:	83 c4 10             	add    $0x10,%esp
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	0f 88 04 01 00 00    	js     80287a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802776:	83 ec 0c             	sub    $0xc,%esp
+  802779:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80277c:	50                   	push   %eax
+  80277d:	e8 d6 f0 ff ff       	call   801858 <fd_alloc>
+  802782:	89 c3                	mov    %eax,%ebx
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	85 c0                	test   %eax,%eax
+  802789:	0f 88 db 00 00 00    	js     80286a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80278f:	83 ec 04             	sub    $0x4,%esp
+  802792:	68 07 04 00 00       	push   $0x407
+  802797:	ff 75 f0             	push   -0x10(%ebp)
+  80279a:	6a 00                	push   $0x0
+  80279c:	e8 1a e6 ff ff       	call   800dbb <sys_page_alloc>
+  8027a1:	89 c3                	mov    %eax,%ebx
+  8027a3:	83 c4 10             	add    $0x10,%esp
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	0f 88 bc 00 00 00    	js     80286a <pipe+0x131>
+	va = fd2data(fd0);
+  8027ae:	83 ec 0c             	sub    $0xc,%esp
+  8027b1:	ff 75 f4             	push   -0xc(%ebp)
+  8027b4:	e8 88 f0 ff ff       	call   801841 <fd2data>
+  8027b9:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027bb:	83 c4 0c             	add    $0xc,%esp
+  8027be:	68 07 04 00 00       	push   $0x407
+  8027c3:	50                   	push   %eax
+  8027c4:	6a 00                	push   $0x0
+  8027c6:	e8 f0 e5 ff ff       	call   800dbb <sys_page_alloc>
+  8027cb:	89 c3                	mov    %eax,%ebx
+  8027cd:	83 c4 10             	add    $0x10,%esp
+  8027d0:	85 c0                	test   %eax,%eax
+  8027d2:	0f 88 82 00 00 00    	js     80285a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027d8:	83 ec 0c             	sub    $0xc,%esp
+  8027db:	ff 75 f0             	push   -0x10(%ebp)
+  8027de:	e8 5e f0 ff ff       	call   801841 <fd2data>
+  8027e3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8027ea:	50                   	push   %eax
+  8027eb:	6a 00                	push   $0x0
+  8027ed:	56                   	push   %esi
+  8027ee:	6a 00                	push   $0x0
+  8027f0:	e8 33 e6 ff ff       	call   800e28 <sys_page_map>
+  8027f5:	89 c3                	mov    %eax,%ebx
+  8027f7:	83 c4 20             	add    $0x20,%esp
+  8027fa:	85 c0                	test   %eax,%eax
+  8027fc:	78 4e                	js     80284c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8027fe:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802803:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802806:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802808:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80280b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802812:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802815:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802817:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80281a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802821:	83 ec 0c             	sub    $0xc,%esp
+  802824:	ff 75 f4             	push   -0xc(%ebp)
+  802827:	e8 05 f0 ff ff       	call   801831 <fd2num>
+  80282c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80282f:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802831:	83 c4 04             	add    $0x4,%esp
+  802834:	ff 75 f0             	push   -0x10(%ebp)
+  802837:	e8 f5 ef ff ff       	call   801831 <fd2num>
+  80283c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80283f:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802842:	83 c4 10             	add    $0x10,%esp
+  802845:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80284a:	eb 2e                	jmp    80287a <pipe+0x141>
+	sys_page_unmap(0, va);
+  80284c:	83 ec 08             	sub    $0x8,%esp
+  80284f:	56                   	push   %esi
+  802850:	6a 00                	push   $0x0
+  802852:	e8 3f e6 ff ff       	call   800e96 <sys_page_unmap>
+  802857:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80285a:	83 ec 08             	sub    $0x8,%esp
+  80285d:	ff 75 f0             	push   -0x10(%ebp)
+  802860:	6a 00                	push   $0x0
+  802862:	e8 2f e6 ff ff       	call   800e96 <sys_page_unmap>
+  802867:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80286a:	83 ec 08             	sub    $0x8,%esp
+  80286d:	ff 75 f4             	push   -0xc(%ebp)
+  802870:	6a 00                	push   $0x0
+  802872:	e8 1f e6 ff ff       	call   800e96 <sys_page_unmap>
+  802877:	83 c4 10             	add    $0x10,%esp
+}
+  80287a:	89 d8                	mov    %ebx,%eax
+  80287c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80287f:	5b                   	pop    %ebx
+  802880:	5e                   	pop    %esi
+  802881:	5d                   	pop    %ebp
+  802882:	c3                   	ret
+
+00802883 <pipeisclosed>:
+{
+  802883:	55                   	push   %ebp
+  802884:	89 e5                	mov    %esp,%ebp
+  802886:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802889:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80288c:	50                   	push   %eax
+  80288d:	ff 75 08             	push   0x8(%ebp)
+  802890:	e8 19 f0 ff ff       	call   8018ae <fd_lookup>
+  802895:	83 c4 10             	add    $0x10,%esp
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	78 18                	js     8028b4 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80289c:	83 ec 0c             	sub    $0xc,%esp
+  80289f:	ff 75 f4             	push   -0xc(%ebp)
+  8028a2:	e8 9a ef ff ff       	call   801841 <fd2data>
+  8028a7:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8028a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028ac:	e8 cb fc ff ff       	call   80257c <_pipeisclosed>
+  8028b1:	83 c4 10             	add    $0x10,%esp
+}
+  8028b4:	c9                   	leave
+  8028b5:	c3                   	ret
+
+008028b6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8028b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028bb:	c3                   	ret
+
+008028bc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028bc:	55                   	push   %ebp
+  8028bd:	89 e5                	mov    %esp,%ebp
+  8028bf:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8028c2:	68 73 31 80 00       	push   $0x803173
+  8028c7:	ff 75 0c             	push   0xc(%ebp)
+  8028ca:	e8 f4 df ff ff       	call   8008c3 <strcpy>
+	return 0;
+}
+  8028cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d4:	c9                   	leave
+  8028d5:	c3                   	ret
+
+008028d6 <devcons_write>:
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	57                   	push   %edi
+  8028da:	56                   	push   %esi
+  8028db:	53                   	push   %ebx
+  8028dc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8028e2:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8028e7:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8028ed:	eb 2e                	jmp    80291d <devcons_write+0x47>
+		m = n - tot;
+  8028ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028f2:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8028f4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8028f9:	39 c3                	cmp    %eax,%ebx
+  8028fb:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8028fe:	83 ec 04             	sub    $0x4,%esp
+  802901:	53                   	push   %ebx
+  802902:	89 f0                	mov    %esi,%eax
+  802904:	03 45 0c             	add    0xc(%ebp),%eax
+  802907:	50                   	push   %eax
+  802908:	57                   	push   %edi
+  802909:	e8 3b e1 ff ff       	call   800a49 <memmove>
+		sys_cputs(buf, m);
+  80290e:	83 c4 08             	add    $0x8,%esp
+  802911:	53                   	push   %ebx
+  802912:	57                   	push   %edi
+  802913:	e8 24 e3 ff ff       	call   800c3c <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802918:	01 de                	add    %ebx,%esi
+  80291a:	83 c4 10             	add    $0x10,%esp
+  80291d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802920:	72 cd                	jb     8028ef <devcons_write+0x19>
+}
+  802922:	89 f0                	mov    %esi,%eax
+  802924:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802927:	5b                   	pop    %ebx
+  802928:	5e                   	pop    %esi
+  802929:	5f                   	pop    %edi
+  80292a:	5d                   	pop    %ebp
+  80292b:	c3                   	ret
+
+0080292c <devcons_read>:
+{
+  80292c:	55                   	push   %ebp
+  80292d:	89 e5                	mov    %esp,%ebp
+  80292f:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802932:	b8 00 00 00 00       	mov    $0x0,%eax
+  802937:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80293b:	75 07                	jne    802944 <devcons_read+0x18>
+  80293d:	eb 1f                	jmp    80295e <devcons_read+0x32>
+		sys_yield();
+  80293f:	e8 31 e4 ff ff       	call   800d75 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802944:	e8 37 e3 ff ff       	call   800c80 <sys_cgetc>
+  802949:	85 c0                	test   %eax,%eax
+  80294b:	74 f2                	je     80293f <devcons_read+0x13>
+	if (c < 0)
+  80294d:	78 0f                	js     80295e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80294f:	83 f8 04             	cmp    $0x4,%eax
+  802952:	74 0c                	je     802960 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802954:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802957:	88 02                	mov    %al,(%edx)
+	return 1;
+  802959:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80295e:	c9                   	leave
+  80295f:	c3                   	ret
+		return 0;
+  802960:	b8 00 00 00 00       	mov    $0x0,%eax
+  802965:	eb f7                	jmp    80295e <devcons_read+0x32>
+
+00802967 <cputchar>:
+{
+  802967:	55                   	push   %ebp
+  802968:	89 e5                	mov    %esp,%ebp
+  80296a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80296d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802970:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802973:	6a 01                	push   $0x1
+  802975:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802978:	50                   	push   %eax
+  802979:	e8 be e2 ff ff       	call   800c3c <sys_cputs>
+}
+  80297e:	83 c4 10             	add    $0x10,%esp
+  802981:	c9                   	leave
+  802982:	c3                   	ret
+
+00802983 <getchar>:
+{
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802989:	6a 01                	push   $0x1
+  80298b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80298e:	50                   	push   %eax
+  80298f:	6a 00                	push   $0x0
+  802991:	e8 9e f1 ff ff       	call   801b34 <read>
+	if (r < 0)
+  802996:	83 c4 10             	add    $0x10,%esp
+  802999:	85 c0                	test   %eax,%eax
+  80299b:	78 06                	js     8029a3 <getchar+0x20>
+	if (r < 1)
+  80299d:	74 06                	je     8029a5 <getchar+0x22>
+	return c;
+  80299f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029a3:	c9                   	leave
+  8029a4:	c3                   	ret
+		return -E_EOF;
+  8029a5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029aa:	eb f7                	jmp    8029a3 <getchar+0x20>
+
+008029ac <iscons>:
+{
+  8029ac:	55                   	push   %ebp
+  8029ad:	89 e5                	mov    %esp,%ebp
+  8029af:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029b5:	50                   	push   %eax
+  8029b6:	ff 75 08             	push   0x8(%ebp)
+  8029b9:	e8 f0 ee ff ff       	call   8018ae <fd_lookup>
+  8029be:	83 c4 10             	add    $0x10,%esp
+  8029c1:	85 c0                	test   %eax,%eax
+  8029c3:	78 11                	js     8029d6 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8029c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c8:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8029ce:	39 10                	cmp    %edx,(%eax)
+  8029d0:	0f 94 c0             	sete   %al
+  8029d3:	0f b6 c0             	movzbl %al,%eax
+}
+  8029d6:	c9                   	leave
+  8029d7:	c3                   	ret
+
+008029d8 <opencons>:
+{
+  8029d8:	55                   	push   %ebp
+  8029d9:	89 e5                	mov    %esp,%ebp
+  8029db:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8029de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029e1:	50                   	push   %eax
+  8029e2:	e8 71 ee ff ff       	call   801858 <fd_alloc>
+  8029e7:	83 c4 10             	add    $0x10,%esp
+  8029ea:	85 c0                	test   %eax,%eax
+  8029ec:	78 3a                	js     802a28 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029ee:	83 ec 04             	sub    $0x4,%esp
+  8029f1:	68 07 04 00 00       	push   $0x407
+  8029f6:	ff 75 f4             	push   -0xc(%ebp)
+  8029f9:	6a 00                	push   $0x0
+  8029fb:	e8 bb e3 ff ff       	call   800dbb <sys_page_alloc>
+  802a00:	83 c4 10             	add    $0x10,%esp
+  802a03:	85 c0                	test   %eax,%eax
+  802a05:	78 21                	js     802a28 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802a07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a0a:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a10:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a15:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802a1c:	83 ec 0c             	sub    $0xc,%esp
+  802a1f:	50                   	push   %eax
+  802a20:	e8 0c ee ff ff       	call   801831 <fd2num>
+  802a25:	83 c4 10             	add    $0x10,%esp
+}
+  802a28:	c9                   	leave
+  802a29:	c3                   	ret
+
+00802a2a <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802a2a:	55                   	push   %ebp
+  802a2b:	89 e5                	mov    %esp,%ebp
+  802a2d:	56                   	push   %esi
+  802a2e:	53                   	push   %ebx
+  802a2f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a38:	85 c0                	test   %eax,%eax
+  802a3a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a3f:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802a42:	83 ec 08             	sub    $0x8,%esp
+  802a45:	ff 75 14             	push   0x14(%ebp)
+  802a48:	50                   	push   %eax
+  802a49:	e8 7e e7 ff ff       	call   8011cc <sys_ipc_recv_until>
+  802a4e:	83 c4 10             	add    $0x10,%esp
+  802a51:	85 c0                	test   %eax,%eax
+  802a53:	78 61                	js     802ab6 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802a55:	85 f6                	test   %esi,%esi
+  802a57:	74 1c                	je     802a75 <ipc_recv_until+0x4b>
+  802a59:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a5b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a60:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a66:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a6b:	76 5f                	jbe    802acc <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802a6d:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802a73:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802a75:	85 db                	test   %ebx,%ebx
+  802a77:	74 1c                	je     802a95 <ipc_recv_until+0x6b>
+  802a79:	89 e0                	mov    %esp,%eax
+  802a7b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a80:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a86:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a8b:	76 50                	jbe    802add <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802a8d:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802a93:	89 03                	mov    %eax,(%ebx)
+  802a95:	89 e0                	mov    %esp,%eax
+  802a97:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a9c:	8b 15 20 50 c0 00    	mov    0xc05020,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802aa2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802aa7:	76 45                	jbe    802aee <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802aa9:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802aaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ab2:	5b                   	pop    %ebx
+  802ab3:	5e                   	pop    %esi
+  802ab4:	5d                   	pop    %ebp
+  802ab5:	c3                   	ret
+		if (from_env_store)
+  802ab6:	85 f6                	test   %esi,%esi
+  802ab8:	74 06                	je     802ac0 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802aba:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ac0:	85 db                	test   %ebx,%ebx
+  802ac2:	74 eb                	je     802aaf <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802ac4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802aca:	eb e3                	jmp    802aaf <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802acc:	c1 e8 10             	shr    $0x10,%eax
+  802acf:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ad5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802adb:	eb 90                	jmp    802a6d <ipc_recv_until+0x43>
+  802add:	c1 e8 10             	shr    $0x10,%eax
+  802ae0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ae6:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802aec:	eb 9f                	jmp    802a8d <ipc_recv_until+0x63>
+  802aee:	c1 e8 10             	shr    $0x10,%eax
+  802af1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802af7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802afd:	eb aa                	jmp    802aa9 <ipc_recv_until+0x7f>
+
+00802aff <ipc_recv>:
+{
+  802aff:	55                   	push   %ebp
+  802b00:	89 e5                	mov    %esp,%ebp
+  802b02:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802b05:	6a 00                	push   $0x0
+  802b07:	ff 75 10             	push   0x10(%ebp)
+  802b0a:	ff 75 0c             	push   0xc(%ebp)
+  802b0d:	ff 75 08             	push   0x8(%ebp)
+  802b10:	e8 15 ff ff ff       	call   802a2a <ipc_recv_until>
+}
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	57                   	push   %edi
+  802b1b:	56                   	push   %esi
+  802b1c:	53                   	push   %ebx
+  802b1d:	83 ec 0c             	sub    $0xc,%esp
+  802b20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b23:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b29:	85 db                	test   %ebx,%ebx
+  802b2b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b30:	0f 44 d8             	cmove  %eax,%ebx
+  802b33:	eb 05                	jmp    802b3a <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802b35:	e8 3b e2 ff ff       	call   800d75 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802b3a:	ff 75 14             	push   0x14(%ebp)
+  802b3d:	53                   	push   %ebx
+  802b3e:	56                   	push   %esi
+  802b3f:	57                   	push   %edi
+  802b40:	e8 d3 e5 ff ff       	call   801118 <sys_ipc_try_send>
+  802b45:	83 c4 10             	add    $0x10,%esp
+  802b48:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b4b:	74 e8                	je     802b35 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802b4d:	85 c0                	test   %eax,%eax
+  802b4f:	78 08                	js     802b59 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802b51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b54:	5b                   	pop    %ebx
+  802b55:	5e                   	pop    %esi
+  802b56:	5f                   	pop    %edi
+  802b57:	5d                   	pop    %ebp
+  802b58:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802b59:	50                   	push   %eax
+  802b5a:	68 7f 31 80 00       	push   $0x80317f
+  802b5f:	6a 4f                	push   $0x4f
+  802b61:	68 92 31 80 00       	push   $0x803192
+  802b66:	e8 35 d6 ff ff       	call   8001a0 <_panic>
+
+00802b6b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802b71:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802b76:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802b7c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b82:	8b 52 50             	mov    0x50(%edx),%edx
+  802b85:	39 ca                	cmp    %ecx,%edx
+  802b87:	74 11                	je     802b9a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802b89:	83 c0 01             	add    $0x1,%eax
+  802b8c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802b91:	75 e3                	jne    802b76 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b98:	eb 0e                	jmp    802ba8 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802b9a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ba0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ba5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802ba8:	5d                   	pop    %ebp
+  802ba9:	c3                   	ret
+
+00802baa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802baa:	55                   	push   %ebp
+  802bab:	89 e5                	mov    %esp,%ebp
+  802bad:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bb0:	89 c2                	mov    %eax,%edx
+  802bb2:	c1 ea 16             	shr    $0x16,%edx
+  802bb5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bc1:	f6 c1 01             	test   $0x1,%cl
+  802bc4:	74 1a                	je     802be0 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802bc6:	c1 e8 0c             	shr    $0xc,%eax
+  802bc9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802bd0:	a8 01                	test   $0x1,%al
+  802bd2:	74 0c                	je     802be0 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802bd4:	c1 e8 0c             	shr    $0xc,%eax
+  802bd7:	c1 e0 04             	shl    $0x4,%eax
+  802bda:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802be0:	89 d0                	mov    %edx,%eax
+  802be2:	5d                   	pop    %ebp
+  802be3:	c3                   	ret
@@ -0,0 +1,6457 @@
+
+obj/user/testclock.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1e 01 00 00       	call   80014f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t a, b, c;
+	unsigned ms, kms;
+	int i;
+
+	if (timeinfo.ti_tsc_khz == 0)
+  80003c:	a1 08 f0 ff ee       	mov    0xeefff008,%eax
+  800041:	85 c0                	test   %eax,%eax
+  800043:	74 5f                	je     8000a4 <umain+0x71>
+		panic("no TSC calibration at UTIME");
+	cprintf("TSC runs at %u kHz\n", timeinfo.ti_tsc_khz);
+  800045:	a1 08 f0 ff ee       	mov    0xeefff008,%eax
+  80004a:	83 ec 08             	sub    $0x8,%esp
+  80004d:	50                   	push   %eax
+  80004e:	68 cd 2d 80 00       	push   $0x802dcd
+  800053:	e8 96 02 00 00       	call   8002ee <cprintf>
+
+	// The clock never goes backwards, in or out of the kernel.
+	for (i = 0; i < 1000; i++) {
+  800058:	83 c4 10             	add    $0x10,%esp
+  80005b:	bf e9 03 00 00       	mov    $0x3e9,%edi
+  800060:	83 ef 01             	sub    $0x1,%edi
+  800063:	74 53                	je     8000b8 <umain+0x85>
+		a = time_nsec();
+  800065:	e8 bf 28 00 00       	call   802929 <time_nsec>
+  80006a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80006d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+		b = sys_time_nsec();
+  800070:	e8 32 16 00 00       	call   8016a7 <sys_time_nsec>
+  800075:	89 c6                	mov    %eax,%esi
+  800077:	89 d3                	mov    %edx,%ebx
+		c = time_nsec();
+  800079:	e8 ab 28 00 00       	call   802929 <time_nsec>
+		if (b < a || c < b)
+  80007e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  800081:	39 ce                	cmp    %ecx,%esi
+  800083:	89 d9                	mov    %ebx,%ecx
+  800085:	1b 4d dc             	sbb    -0x24(%ebp),%ecx
+  800088:	72 06                	jb     800090 <umain+0x5d>
+  80008a:	39 f0                	cmp    %esi,%eax
+  80008c:	19 da                	sbb    %ebx,%edx
+  80008e:	73 d0                	jae    800060 <umain+0x2d>
+			panic("clock went backwards");
+  800090:	83 ec 04             	sub    $0x4,%esp
+  800093:	68 e1 2d 80 00       	push   $0x802de1
+  800098:	6a 16                	push   $0x16
+  80009a:	68 bc 2d 80 00       	push   $0x802dbc
+  80009f:	e8 6f 01 00 00       	call   800213 <_panic>
+		panic("no TSC calibration at UTIME");
+  8000a4:	83 ec 04             	sub    $0x4,%esp
+  8000a7:	68 a0 2d 80 00       	push   $0x802da0
+  8000ac:	6a 0d                	push   $0xd
+  8000ae:	68 bc 2d 80 00       	push   $0x802dbc
+  8000b3:	e8 5b 01 00 00       	call   800213 <_panic>
+	}
+
+	// Both millisecond clocks agree.
+	ms = time_msec();
+  8000b8:	e8 0f 29 00 00       	call   8029cc <time_msec>
+  8000bd:	89 c3                	mov    %eax,%ebx
+	kms = sys_time_msec();
+  8000bf:	e8 c5 11 00 00       	call   801289 <sys_time_msec>
+  8000c4:	89 c7                	mov    %eax,%edi
+	if (kms < ms || kms - ms > 1)
+  8000c6:	39 d8                	cmp    %ebx,%eax
+  8000c8:	72 1e                	jb     8000e8 <umain+0xb5>
+  8000ca:	29 d8                	sub    %ebx,%eax
+  8000cc:	83 f8 01             	cmp    $0x1,%eax
+  8000cf:	77 17                	ja     8000e8 <umain+0xb5>
+		panic("time_msec %u, sys_time_msec %u", ms, kms);
+
+	// And they move: wait 100ms by the nanosecond clock.
+	a = time_nsec();
+  8000d1:	e8 53 28 00 00       	call   802929 <time_nsec>
+  8000d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8000d9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	while (time_nsec() - a < 100000000)
+  8000dc:	be ff e0 f5 05       	mov    $0x5f5e0ff,%esi
+  8000e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8000e6:	eb 1b                	jmp    800103 <umain+0xd0>
+		panic("time_msec %u, sys_time_msec %u", ms, kms);
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	57                   	push   %edi
+  8000ec:	53                   	push   %ebx
+  8000ed:	68 18 2e 80 00       	push   $0x802e18
+  8000f2:	6a 1d                	push   $0x1d
+  8000f4:	68 bc 2d 80 00       	push   $0x802dbc
+  8000f9:	e8 15 01 00 00       	call   800213 <_panic>
+		sys_yield();
+  8000fe:	e8 e5 0c 00 00       	call   800de8 <sys_yield>
+	while (time_nsec() - a < 100000000)
+  800103:	e8 21 28 00 00       	call   802929 <time_nsec>
+  800108:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  80010b:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  80010e:	39 c6                	cmp    %eax,%esi
+  800110:	89 d9                	mov    %ebx,%ecx
+  800112:	19 d1                	sbb    %edx,%ecx
+  800114:	73 e8                	jae    8000fe <umain+0xcb>
+	kms = sys_time_msec() - kms;
+  800116:	e8 6e 11 00 00       	call   801289 <sys_time_msec>
+  80011b:	29 f8                	sub    %edi,%eax
+	if (kms < 100 || kms > 150)
+  80011d:	8d 50 9c             	lea    -0x64(%eax),%edx
+  800120:	83 fa 32             	cmp    $0x32,%edx
+  800123:	77 18                	ja     80013d <umain+0x10a>
+		panic("100ms took %u ms", kms);
+
+	cprintf("testclock: OK\n");
+  800125:	83 ec 0c             	sub    $0xc,%esp
+  800128:	68 07 2e 80 00       	push   $0x802e07
+  80012d:	e8 bc 01 00 00       	call   8002ee <cprintf>
+}
+  800132:	83 c4 10             	add    $0x10,%esp
+  800135:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800138:	5b                   	pop    %ebx
+  800139:	5e                   	pop    %esi
+  80013a:	5f                   	pop    %edi
+  80013b:	5d                   	pop    %ebp
+  80013c:	c3                   	ret
+		panic("100ms took %u ms", kms);
+  80013d:	50                   	push   %eax
+  80013e:	68 f6 2d 80 00       	push   $0x802df6
+  800143:	6a 25                	push   $0x25
+  800145:	68 bc 2d 80 00       	push   $0x802dbc
+  80014a:	e8 c4 00 00 00       	call   800213 <_panic>
+
+0080014f <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80014f:	55                   	push   %ebp
+  800150:	89 e5                	mov    %esp,%ebp
+  800152:	57                   	push   %edi
+  800153:	56                   	push   %esi
+  800154:	53                   	push   %ebx
+  800155:	83 ec 0c             	sub    $0xc,%esp
+  800158:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80015b:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80015e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800163:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800165:	c1 ea 0b             	shr    $0xb,%edx
+  800168:	83 f2 01             	xor    $0x1,%edx
+  80016b:	83 e2 01             	and    $0x1,%edx
+  80016e:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800174:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80017b:	00 00 00 
+	envid = sys_getenvid();
+  80017e:	e8 1f 0c 00 00       	call   800da2 <sys_getenvid>
+  800183:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800185:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80018a:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800190:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800196:	8b 52 48             	mov    0x48(%edx),%edx
+  800199:	39 ca                	cmp    %ecx,%edx
+  80019b:	74 27                	je     8001c4 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80019d:	83 c0 01             	add    $0x1,%eax
+  8001a0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001a5:	75 e3                	jne    80018a <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8001a7:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8001ae:	75 24                	jne    8001d4 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8001b0:	83 ec 04             	sub    $0x4,%esp
+  8001b3:	68 38 2e 80 00       	push   $0x802e38
+  8001b8:	6a 23                	push   $0x23
+  8001ba:	68 5b 2e 80 00       	push   $0x802e5b
+  8001bf:	e8 4f 00 00 00       	call   800213 <_panic>
+			mainenv = &envs[i];
+  8001c4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001ca:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001cf:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001d4:	85 ff                	test   %edi,%edi
+  8001d6:	7e 07                	jle    8001df <libmain+0x90>
+		binaryname = argv[0];
+  8001d8:	8b 06                	mov    (%esi),%eax
+  8001da:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8001df:	83 ec 08             	sub    $0x8,%esp
+  8001e2:	56                   	push   %esi
+  8001e3:	57                   	push   %edi
+  8001e4:	e8 4a fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001e9:	e8 0b 00 00 00       	call   8001f9 <exit>
+}
+  8001ee:	83 c4 10             	add    $0x10,%esp
+  8001f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f4:	5b                   	pop    %ebx
+  8001f5:	5e                   	pop    %esi
+  8001f6:	5f                   	pop    %edi
+  8001f7:	5d                   	pop    %ebp
+  8001f8:	c3                   	ret
+
+008001f9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001f9:	55                   	push   %ebp
+  8001fa:	89 e5                	mov    %esp,%ebp
+  8001fc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001ff:	e8 94 18 00 00       	call   801a98 <close_all>
+	sys_env_destroy(0);
+  800204:	83 ec 0c             	sub    $0xc,%esp
+  800207:	6a 00                	push   $0x0
+  800209:	e8 2b 0b 00 00       	call   800d39 <sys_env_destroy>
+}
+  80020e:	83 c4 10             	add    $0x10,%esp
+  800211:	c9                   	leave
+  800212:	c3                   	ret
+
+00800213 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	56                   	push   %esi
+  800217:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800218:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80021b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800221:	e8 7c 0b 00 00       	call   800da2 <sys_getenvid>
+  800226:	83 ec 0c             	sub    $0xc,%esp
+  800229:	ff 75 0c             	push   0xc(%ebp)
+  80022c:	ff 75 08             	push   0x8(%ebp)
+  80022f:	56                   	push   %esi
+  800230:	50                   	push   %eax
+  800231:	68 74 2e 80 00       	push   $0x802e74
+  800236:	e8 b3 00 00 00       	call   8002ee <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80023b:	83 c4 18             	add    $0x18,%esp
+  80023e:	53                   	push   %ebx
+  80023f:	ff 75 10             	push   0x10(%ebp)
+  800242:	e8 56 00 00 00       	call   80029d <vcprintf>
+	cprintf("\n");
+  800247:	c7 04 24 14 2e 80 00 	movl   $0x802e14,(%esp)
+  80024e:	e8 9b 00 00 00       	call   8002ee <cprintf>
+  800253:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800256:	cc                   	int3
+	while (1)
+  800257:	eb fd                	jmp    800256 <_panic+0x43>
+
+00800259 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	53                   	push   %ebx
+  80025d:	83 ec 04             	sub    $0x4,%esp
+  800260:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800263:	8b 13                	mov    (%ebx),%edx
+  800265:	8d 42 01             	lea    0x1(%edx),%eax
+  800268:	89 03                	mov    %eax,(%ebx)
+  80026a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80026d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800271:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800276:	74 09                	je     800281 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800278:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80027c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80027f:	c9                   	leave
+  800280:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800281:	83 ec 08             	sub    $0x8,%esp
+  800284:	68 ff 00 00 00       	push   $0xff
+  800289:	8d 43 08             	lea    0x8(%ebx),%eax
+  80028c:	50                   	push   %eax
+  80028d:	e8 1d 0a 00 00       	call   800caf <sys_cputs>
+		b->idx = 0;
+  800292:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800298:	83 c4 10             	add    $0x10,%esp
+  80029b:	eb db                	jmp    800278 <putch+0x1f>
+
+0080029d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002a6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002ad:	00 00 00 
+	b.cnt = 0;
+  8002b0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002b7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002ba:	ff 75 0c             	push   0xc(%ebp)
+  8002bd:	ff 75 08             	push   0x8(%ebp)
+  8002c0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002c6:	50                   	push   %eax
+  8002c7:	68 59 02 80 00       	push   $0x800259
+  8002cc:	e8 fb 00 00 00       	call   8003cc <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002d1:	83 c4 08             	add    $0x8,%esp
+  8002d4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002da:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002e0:	50                   	push   %eax
+  8002e1:	e8 c9 09 00 00       	call   800caf <sys_cputs>
+
+	return b.cnt;
+}
+  8002e6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002ec:	c9                   	leave
+  8002ed:	c3                   	ret
+
+008002ee <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002ee:	55                   	push   %ebp
+  8002ef:	89 e5                	mov    %esp,%ebp
+  8002f1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002f4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002f7:	50                   	push   %eax
+  8002f8:	ff 75 08             	push   0x8(%ebp)
+  8002fb:	e8 9d ff ff ff       	call   80029d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800300:	c9                   	leave
+  800301:	c3                   	ret
+
+00800302 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800302:	55                   	push   %ebp
+  800303:	89 e5                	mov    %esp,%ebp
+  800305:	57                   	push   %edi
+  800306:	56                   	push   %esi
+  800307:	53                   	push   %ebx
+  800308:	83 ec 1c             	sub    $0x1c,%esp
+  80030b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80030e:	89 d6                	mov    %edx,%esi
+  800310:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800313:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800316:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800319:	73 0b                	jae    800326 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80031b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80031e:	c1 e7 08             	shl    $0x8,%edi
+  800321:	0b 7d 10             	or     0x10(%ebp),%edi
+  800324:	eb 36                	jmp    80035c <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800326:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800329:	ba 00 00 00 00       	mov    $0x0,%edx
+  80032e:	f7 75 08             	divl   0x8(%ebp)
+  800331:	89 c1                	mov    %eax,%ecx
+  800333:	ff 75 14             	push   0x14(%ebp)
+  800336:	ff 75 10             	push   0x10(%ebp)
+  800339:	83 eb 01             	sub    $0x1,%ebx
+  80033c:	53                   	push   %ebx
+  80033d:	ff 75 08             	push   0x8(%ebp)
+  800340:	89 f2                	mov    %esi,%edx
+  800342:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800345:	e8 b8 ff ff ff       	call   800302 <printnum>
+  80034a:	83 c4 10             	add    $0x10,%esp
+  80034d:	eb 14                	jmp    800363 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80034f:	83 ec 08             	sub    $0x8,%esp
+  800352:	56                   	push   %esi
+  800353:	57                   	push   %edi
+  800354:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800357:	ff d0                	call   *%eax
+  800359:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80035c:	83 eb 01             	sub    $0x1,%ebx
+  80035f:	85 db                	test   %ebx,%ebx
+  800361:	7f ec                	jg     80034f <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800363:	83 ec 08             	sub    $0x8,%esp
+  800366:	56                   	push   %esi
+  800367:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80036a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036f:	f7 75 08             	divl   0x8(%ebp)
+  800372:	0f be 92 97 2e 80 00 	movsbl 0x802e97(%edx),%edx
+  800379:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037c:	c1 e0 08             	shl    $0x8,%eax
+  80037f:	09 d0                	or     %edx,%eax
+  800381:	50                   	push   %eax
+  800382:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800385:	ff d0                	call   *%eax
+}
+  800387:	83 c4 10             	add    $0x10,%esp
+  80038a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038d:	5b                   	pop    %ebx
+  80038e:	5e                   	pop    %esi
+  80038f:	5f                   	pop    %edi
+  800390:	5d                   	pop    %ebp
+  800391:	c3                   	ret
+
+00800392 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800392:	55                   	push   %ebp
+  800393:	89 e5                	mov    %esp,%ebp
+  800395:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800398:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80039c:	8b 10                	mov    (%eax),%edx
+  80039e:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003a1:	73 0a                	jae    8003ad <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003a3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a6:	89 08                	mov    %ecx,(%eax)
+  8003a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ab:	88 02                	mov    %al,(%edx)
+}
+  8003ad:	5d                   	pop    %ebp
+  8003ae:	c3                   	ret
+
+008003af <printfmt>:
+{
+  8003af:	55                   	push   %ebp
+  8003b0:	89 e5                	mov    %esp,%ebp
+  8003b2:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b5:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b8:	50                   	push   %eax
+  8003b9:	ff 75 10             	push   0x10(%ebp)
+  8003bc:	ff 75 0c             	push   0xc(%ebp)
+  8003bf:	ff 75 08             	push   0x8(%ebp)
+  8003c2:	e8 05 00 00 00       	call   8003cc <vprintfmt>
+}
+  8003c7:	83 c4 10             	add    $0x10,%esp
+  8003ca:	c9                   	leave
+  8003cb:	c3                   	ret
+
+008003cc <vprintfmt>:
+{
+  8003cc:	55                   	push   %ebp
+  8003cd:	89 e5                	mov    %esp,%ebp
+  8003cf:	57                   	push   %edi
+  8003d0:	56                   	push   %esi
+  8003d1:	53                   	push   %ebx
+  8003d2:	83 ec 3c             	sub    $0x3c,%esp
+  8003d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8003d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8003db:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003e2:	eb 16                	jmp    8003fa <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8003e4:	83 ec 08             	sub    $0x8,%esp
+  8003e7:	ff 75 0c             	push   0xc(%ebp)
+  8003ea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8003ed:	c1 e2 08             	shl    $0x8,%edx
+  8003f0:	09 d0                	or     %edx,%eax
+  8003f2:	50                   	push   %eax
+  8003f3:	ff d7                	call   *%edi
+  8003f5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003f8:	89 de                	mov    %ebx,%esi
+  8003fa:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003fd:	0f b6 06             	movzbl (%esi),%eax
+  800400:	83 f8 25             	cmp    $0x25,%eax
+  800403:	74 0c                	je     800411 <vprintfmt+0x45>
+			if (ch == '\0')
+  800405:	85 c0                	test   %eax,%eax
+  800407:	75 db                	jne    8003e4 <vprintfmt+0x18>
+}
+  800409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040c:	5b                   	pop    %ebx
+  80040d:	5e                   	pop    %esi
+  80040e:	5f                   	pop    %edi
+  80040f:	5d                   	pop    %ebp
+  800410:	c3                   	ret
+		padc = ' ';
+  800411:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800415:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80041c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800423:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80042a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042f:	8d 73 01             	lea    0x1(%ebx),%esi
+  800432:	0f b6 13             	movzbl (%ebx),%edx
+  800435:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800438:	3c 55                	cmp    $0x55,%al
+  80043a:	0f 87 2c 04 00 00    	ja     80086c <vprintfmt+0x4a0>
+  800440:	0f b6 c0             	movzbl %al,%eax
+  800443:	ff 24 85 e0 2f 80 00 	jmp    *0x802fe0(,%eax,4)
+  80044a:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80044c:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800450:	eb dd                	jmp    80042f <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800452:	89 f3                	mov    %esi,%ebx
+  800454:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800458:	eb d5                	jmp    80042f <vprintfmt+0x63>
+  80045a:	0f b6 d2             	movzbl %dl,%edx
+  80045d:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80045f:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800464:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800467:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80046b:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80046e:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800471:	83 fe 09             	cmp    $0x9,%esi
+  800474:	0f 87 8a 00 00 00    	ja     800504 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80047a:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80047d:	eb e5                	jmp    800464 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80047f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800482:	8b 00                	mov    (%eax),%eax
+  800484:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	8d 40 04             	lea    0x4(%eax),%eax
+  80048d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800490:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800492:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800496:	79 97                	jns    80042f <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800498:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80049b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80049e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004a5:	eb 88                	jmp    80042f <vprintfmt+0x63>
+			if (width < 0)
+  8004a7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8004aa:	85 db                	test   %ebx,%ebx
+  8004ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b1:	0f 49 c3             	cmovns %ebx,%eax
+  8004b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b7:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004b9:	e9 71 ff ff ff       	jmp    80042f <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004be:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8004c0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004c7:	e9 63 ff ff ff       	jmp    80042f <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8004cc:	8d 73 02             	lea    0x2(%ebx),%esi
+  8004cf:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8004d3:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8004da:	3c 67                	cmp    $0x67,%al
+  8004dc:	0f 84 18 ff ff ff    	je     8003fa <vprintfmt+0x2e>
+					attrib = 0x04;
+  8004e2:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8004e9:	3c 72                	cmp    $0x72,%al
+  8004eb:	0f 84 09 ff ff ff    	je     8003fa <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004f1:	3c 62                	cmp    $0x62,%al
+  8004f3:	0f 94 c0             	sete   %al
+  8004f6:	0f b6 c0             	movzbl %al,%eax
+  8004f9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004ff:	e9 f6 fe ff ff       	jmp    8003fa <vprintfmt+0x2e>
+  800504:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800507:	eb 89                	jmp    800492 <vprintfmt+0xc6>
+			lflag++;
+  800509:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80050c:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80050e:	e9 1c ff ff ff       	jmp    80042f <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800513:	8b 45 14             	mov    0x14(%ebp),%eax
+  800516:	8d 58 04             	lea    0x4(%eax),%ebx
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	ff 75 0c             	push   0xc(%ebp)
+  80051f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800522:	c1 e0 08             	shl    $0x8,%eax
+  800525:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800528:	0b 01                	or     (%ecx),%eax
+  80052a:	50                   	push   %eax
+  80052b:	ff d7                	call   *%edi
+			break;
+  80052d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800530:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800533:	e9 c2 fe ff ff       	jmp    8003fa <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800538:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053b:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80053e:	8b 10                	mov    (%eax),%edx
+  800540:	89 d0                	mov    %edx,%eax
+  800542:	f7 d8                	neg    %eax
+  800544:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800547:	83 f8 12             	cmp    $0x12,%eax
+  80054a:	7f 25                	jg     800571 <vprintfmt+0x1a5>
+  80054c:	8b 14 85 40 31 80 00 	mov    0x803140(,%eax,4),%edx
+  800553:	85 d2                	test   %edx,%edx
+  800555:	74 1a                	je     800571 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800557:	52                   	push   %edx
+  800558:	68 81 32 80 00       	push   $0x803281
+  80055d:	ff 75 0c             	push   0xc(%ebp)
+  800560:	57                   	push   %edi
+  800561:	e8 49 fe ff ff       	call   8003af <printfmt>
+  800566:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800569:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80056c:	e9 89 fe ff ff       	jmp    8003fa <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800571:	50                   	push   %eax
+  800572:	68 af 2e 80 00       	push   $0x802eaf
+  800577:	ff 75 0c             	push   0xc(%ebp)
+  80057a:	57                   	push   %edi
+  80057b:	e8 2f fe ff ff       	call   8003af <printfmt>
+  800580:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800583:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800586:	e9 6f fe ff ff       	jmp    8003fa <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	83 c0 04             	add    $0x4,%eax
+  800591:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800594:	8b 45 14             	mov    0x14(%ebp),%eax
+  800597:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800599:	85 c9                	test   %ecx,%ecx
+  80059b:	b8 a8 2e 80 00       	mov    $0x802ea8,%eax
+  8005a0:	0f 45 c1             	cmovne %ecx,%eax
+  8005a3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8005a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005aa:	7e 06                	jle    8005b2 <vprintfmt+0x1e6>
+  8005ac:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8005b0:	75 1a                	jne    8005cc <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8005b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005b5:	c1 e0 08             	shl    $0x8,%eax
+  8005b8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8005bb:	83 c8 3f             	or     $0x3f,%eax
+  8005be:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005c1:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8005c4:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005c7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8005ca:	eb 6d                	jmp    800639 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	ff 75 d0             	push   -0x30(%ebp)
+  8005d2:	ff 75 c8             	push   -0x38(%ebp)
+  8005d5:	e8 39 03 00 00       	call   800913 <strnlen>
+  8005da:	89 c2                	mov    %eax,%edx
+  8005dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005df:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8005e1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005e4:	c1 e1 08             	shl    $0x8,%ecx
+  8005e7:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8005eb:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ed:	83 c4 10             	add    $0x10,%esp
+  8005f0:	89 c3                	mov    %eax,%ebx
+  8005f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005f8:	89 ce                	mov    %ecx,%esi
+  8005fa:	eb 0f                	jmp    80060b <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005fc:	83 ec 08             	sub    $0x8,%esp
+  8005ff:	ff 75 0c             	push   0xc(%ebp)
+  800602:	56                   	push   %esi
+  800603:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800605:	83 eb 01             	sub    $0x1,%ebx
+  800608:	83 c4 10             	add    $0x10,%esp
+  80060b:	85 db                	test   %ebx,%ebx
+  80060d:	7f ed                	jg     8005fc <vprintfmt+0x230>
+  80060f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800612:	8b 75 10             	mov    0x10(%ebp),%esi
+  800615:	85 c0                	test   %eax,%eax
+  800617:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061c:	0f 49 d0             	cmovns %eax,%edx
+  80061f:	29 d0                	sub    %edx,%eax
+  800621:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800624:	eb 8c                	jmp    8005b2 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800626:	83 ec 08             	sub    $0x8,%esp
+  800629:	ff 75 0c             	push   0xc(%ebp)
+  80062c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80062f:	09 c2                	or     %eax,%edx
+  800631:	52                   	push   %edx
+  800632:	ff d7                	call   *%edi
+  800634:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800637:	89 d9                	mov    %ebx,%ecx
+  800639:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80063c:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800640:	0f be d0             	movsbl %al,%edx
+  800643:	85 d2                	test   %edx,%edx
+  800645:	74 2a                	je     800671 <vprintfmt+0x2a5>
+  800647:	85 f6                	test   %esi,%esi
+  800649:	78 05                	js     800650 <vprintfmt+0x284>
+  80064b:	83 ee 01             	sub    $0x1,%esi
+  80064e:	78 3b                	js     80068b <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800650:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800654:	74 d0                	je     800626 <vprintfmt+0x25a>
+  800656:	0f be c0             	movsbl %al,%eax
+  800659:	83 e8 20             	sub    $0x20,%eax
+  80065c:	83 f8 5e             	cmp    $0x5e,%eax
+  80065f:	76 c5                	jbe    800626 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800661:	83 ec 08             	sub    $0x8,%esp
+  800664:	ff 75 0c             	push   0xc(%ebp)
+  800667:	ff 75 cc             	push   -0x34(%ebp)
+  80066a:	ff d7                	call   *%edi
+  80066c:	83 c4 10             	add    $0x10,%esp
+  80066f:	eb c6                	jmp    800637 <vprintfmt+0x26b>
+  800671:	8b 75 10             	mov    0x10(%ebp),%esi
+  800674:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800677:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80067a:	01 c3                	add    %eax,%ebx
+  80067c:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80067e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800681:	83 c8 20             	or     $0x20,%eax
+  800684:	89 75 10             	mov    %esi,0x10(%ebp)
+  800687:	89 c6                	mov    %eax,%esi
+  800689:	eb 14                	jmp    80069f <vprintfmt+0x2d3>
+  80068b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80068e:	eb e4                	jmp    800674 <vprintfmt+0x2a8>
+  800690:	83 ec 08             	sub    $0x8,%esp
+  800693:	ff 75 0c             	push   0xc(%ebp)
+  800696:	56                   	push   %esi
+  800697:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800699:	83 eb 01             	sub    $0x1,%ebx
+  80069c:	83 c4 10             	add    $0x10,%esp
+  80069f:	85 db                	test   %ebx,%ebx
+  8006a1:	7f ed                	jg     800690 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006a3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006a6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ac:	e9 49 fd ff ff       	jmp    8003fa <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006b1:	83 f9 01             	cmp    $0x1,%ecx
+  8006b4:	7f 1f                	jg     8006d5 <vprintfmt+0x309>
+	else if (lflag)
+  8006b6:	85 c9                	test   %ecx,%ecx
+  8006b8:	74 69                	je     800723 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8006ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bd:	8b 00                	mov    (%eax),%eax
+  8006bf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c2:	89 c1                	mov    %eax,%ecx
+  8006c4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006d3:	eb 17                	jmp    8006ec <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8006d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d8:	8b 50 04             	mov    0x4(%eax),%edx
+  8006db:	8b 00                	mov    (%eax),%eax
+  8006dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ec:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006ef:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006f2:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006f7:	85 db                	test   %ebx,%ebx
+  8006f9:	0f 89 f6 00 00 00    	jns    8007f5 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006ff:	83 ec 08             	sub    $0x8,%esp
+  800702:	ff 75 0c             	push   0xc(%ebp)
+  800705:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800708:	c1 e0 08             	shl    $0x8,%eax
+  80070b:	83 c8 2d             	or     $0x2d,%eax
+  80070e:	50                   	push   %eax
+  80070f:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800711:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800714:	f7 d9                	neg    %ecx
+  800716:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800719:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80071e:	e9 d2 00 00 00       	jmp    8007f5 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800723:	8b 45 14             	mov    0x14(%ebp),%eax
+  800726:	8b 00                	mov    (%eax),%eax
+  800728:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80072b:	89 c1                	mov    %eax,%ecx
+  80072d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800730:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8d 40 04             	lea    0x4(%eax),%eax
+  800739:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073c:	eb ae                	jmp    8006ec <vprintfmt+0x320>
+	if (lflag >= 2)
+  80073e:	83 f9 01             	cmp    $0x1,%ecx
+  800741:	7f 19                	jg     80075c <vprintfmt+0x390>
+	else if (lflag)
+  800743:	85 c9                	test   %ecx,%ecx
+  800745:	74 2a                	je     800771 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800747:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074a:	8b 08                	mov    (%eax),%ecx
+  80074c:	8d 40 04             	lea    0x4(%eax),%eax
+  80074f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800752:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800757:	e9 99 00 00 00       	jmp    8007f5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80075c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075f:	8b 08                	mov    (%eax),%ecx
+  800761:	8d 40 08             	lea    0x8(%eax),%eax
+  800764:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800767:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80076c:	e9 84 00 00 00       	jmp    8007f5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 08                	mov    (%eax),%ecx
+  800776:	8d 40 04             	lea    0x4(%eax),%eax
+  800779:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80077c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800781:	eb 72                	jmp    8007f5 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800783:	83 f9 01             	cmp    $0x1,%ecx
+  800786:	7f 16                	jg     80079e <vprintfmt+0x3d2>
+	else if (lflag)
+  800788:	85 c9                	test   %ecx,%ecx
+  80078a:	74 24                	je     8007b0 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 08                	mov    (%eax),%ecx
+  800791:	8d 40 04             	lea    0x4(%eax),%eax
+  800794:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800797:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80079c:	eb 57                	jmp    8007f5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8b 08                	mov    (%eax),%ecx
+  8007a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007a9:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8007ae:	eb 45                	jmp    8007f5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8b 08                	mov    (%eax),%ecx
+  8007b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007bb:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8007c0:	eb 33                	jmp    8007f5 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8007c2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007c5:	c1 e3 08             	shl    $0x8,%ebx
+  8007c8:	83 ec 08             	sub    $0x8,%esp
+  8007cb:	ff 75 0c             	push   0xc(%ebp)
+  8007ce:	89 d8                	mov    %ebx,%eax
+  8007d0:	83 c8 30             	or     $0x30,%eax
+  8007d3:	50                   	push   %eax
+  8007d4:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8007d6:	83 c4 08             	add    $0x8,%esp
+  8007d9:	ff 75 0c             	push   0xc(%ebp)
+  8007dc:	83 cb 78             	or     $0x78,%ebx
+  8007df:	53                   	push   %ebx
+  8007e0:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8007e7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f0:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007f5:	ff 75 e4             	push   -0x1c(%ebp)
+  8007f8:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007fc:	52                   	push   %edx
+  8007fd:	ff 75 e0             	push   -0x20(%ebp)
+  800800:	50                   	push   %eax
+  800801:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800804:	89 f8                	mov    %edi,%eax
+  800806:	e8 f7 fa ff ff       	call   800302 <printnum>
+			break;
+  80080b:	83 c4 10             	add    $0x10,%esp
+  80080e:	e9 e7 fb ff ff       	jmp    8003fa <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800813:	83 f9 01             	cmp    $0x1,%ecx
+  800816:	7f 16                	jg     80082e <vprintfmt+0x462>
+	else if (lflag)
+  800818:	85 c9                	test   %ecx,%ecx
+  80081a:	74 24                	je     800840 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  80081c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081f:	8b 08                	mov    (%eax),%ecx
+  800821:	8d 40 04             	lea    0x4(%eax),%eax
+  800824:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800827:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80082c:	eb c7                	jmp    8007f5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80082e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800831:	8b 08                	mov    (%eax),%ecx
+  800833:	8d 40 08             	lea    0x8(%eax),%eax
+  800836:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800839:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80083e:	eb b5                	jmp    8007f5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800840:	8b 45 14             	mov    0x14(%ebp),%eax
+  800843:	8b 08                	mov    (%eax),%ecx
+  800845:	8d 40 04             	lea    0x4(%eax),%eax
+  800848:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80084b:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800850:	eb a3                	jmp    8007f5 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800852:	83 ec 08             	sub    $0x8,%esp
+  800855:	ff 75 0c             	push   0xc(%ebp)
+  800858:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80085b:	c1 e0 08             	shl    $0x8,%eax
+  80085e:	83 c8 25             	or     $0x25,%eax
+  800861:	50                   	push   %eax
+  800862:	ff d7                	call   *%edi
+			break;
+  800864:	83 c4 10             	add    $0x10,%esp
+  800867:	e9 8e fb ff ff       	jmp    8003fa <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80086c:	83 ec 08             	sub    $0x8,%esp
+  80086f:	ff 75 0c             	push   0xc(%ebp)
+  800872:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800875:	c1 e0 08             	shl    $0x8,%eax
+  800878:	83 c8 25             	or     $0x25,%eax
+  80087b:	50                   	push   %eax
+  80087c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80087e:	83 c4 10             	add    $0x10,%esp
+  800881:	89 de                	mov    %ebx,%esi
+  800883:	eb 03                	jmp    800888 <vprintfmt+0x4bc>
+  800885:	83 ee 01             	sub    $0x1,%esi
+  800888:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80088c:	75 f7                	jne    800885 <vprintfmt+0x4b9>
+  80088e:	e9 67 fb ff ff       	jmp    8003fa <vprintfmt+0x2e>
+
+00800893 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800893:	55                   	push   %ebp
+  800894:	89 e5                	mov    %esp,%ebp
+  800896:	83 ec 18             	sub    $0x18,%esp
+  800899:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80089f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008a2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008a6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008a9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008b0:	85 c0                	test   %eax,%eax
+  8008b2:	74 26                	je     8008da <vsnprintf+0x47>
+  8008b4:	85 d2                	test   %edx,%edx
+  8008b6:	7e 22                	jle    8008da <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008b8:	ff 75 14             	push   0x14(%ebp)
+  8008bb:	ff 75 10             	push   0x10(%ebp)
+  8008be:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008c1:	50                   	push   %eax
+  8008c2:	68 92 03 80 00       	push   $0x800392
+  8008c7:	e8 00 fb ff ff       	call   8003cc <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008cc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008cf:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008d5:	83 c4 10             	add    $0x10,%esp
+}
+  8008d8:	c9                   	leave
+  8008d9:	c3                   	ret
+		return -E_INVAL;
+  8008da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008df:	eb f7                	jmp    8008d8 <vsnprintf+0x45>
+
+008008e1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8008e7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008ea:	50                   	push   %eax
+  8008eb:	ff 75 10             	push   0x10(%ebp)
+  8008ee:	ff 75 0c             	push   0xc(%ebp)
+  8008f1:	ff 75 08             	push   0x8(%ebp)
+  8008f4:	e8 9a ff ff ff       	call   800893 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008f9:	c9                   	leave
+  8008fa:	c3                   	ret
+
+008008fb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008fb:	55                   	push   %ebp
+  8008fc:	89 e5                	mov    %esp,%ebp
+  8008fe:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	eb 03                	jmp    80090b <strlen+0x10>
+		n++;
+  800908:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80090b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80090f:	75 f7                	jne    800908 <strlen+0xd>
+	return n;
+}
+  800911:	5d                   	pop    %ebp
+  800912:	c3                   	ret
+
+00800913 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800919:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80091c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800921:	eb 03                	jmp    800926 <strnlen+0x13>
+		n++;
+  800923:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800926:	39 d0                	cmp    %edx,%eax
+  800928:	74 08                	je     800932 <strnlen+0x1f>
+  80092a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80092e:	75 f3                	jne    800923 <strnlen+0x10>
+  800930:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800932:	89 d0                	mov    %edx,%eax
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	53                   	push   %ebx
+  80093a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80093d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800940:	b8 00 00 00 00       	mov    $0x0,%eax
+  800945:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800949:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80094c:	83 c0 01             	add    $0x1,%eax
+  80094f:	84 d2                	test   %dl,%dl
+  800951:	75 f2                	jne    800945 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800953:	89 c8                	mov    %ecx,%eax
+  800955:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800958:	c9                   	leave
+  800959:	c3                   	ret
+
+0080095a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80095a:	55                   	push   %ebp
+  80095b:	89 e5                	mov    %esp,%ebp
+  80095d:	53                   	push   %ebx
+  80095e:	83 ec 10             	sub    $0x10,%esp
+  800961:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800964:	53                   	push   %ebx
+  800965:	e8 91 ff ff ff       	call   8008fb <strlen>
+  80096a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80096d:	ff 75 0c             	push   0xc(%ebp)
+  800970:	01 d8                	add    %ebx,%eax
+  800972:	50                   	push   %eax
+  800973:	e8 be ff ff ff       	call   800936 <strcpy>
+	return dst;
+}
+  800978:	89 d8                	mov    %ebx,%eax
+  80097a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80097d:	c9                   	leave
+  80097e:	c3                   	ret
+
+0080097f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80097f:	55                   	push   %ebp
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	56                   	push   %esi
+  800983:	53                   	push   %ebx
+  800984:	8b 75 08             	mov    0x8(%ebp),%esi
+  800987:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80098a:	89 f3                	mov    %esi,%ebx
+  80098c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80098f:	89 f0                	mov    %esi,%eax
+  800991:	eb 0f                	jmp    8009a2 <strncpy+0x23>
+		*dst++ = *src;
+  800993:	83 c0 01             	add    $0x1,%eax
+  800996:	0f b6 0a             	movzbl (%edx),%ecx
+  800999:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80099c:	80 f9 01             	cmp    $0x1,%cl
+  80099f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009a2:	39 d8                	cmp    %ebx,%eax
+  8009a4:	75 ed                	jne    800993 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009a6:	89 f0                	mov    %esi,%eax
+  8009a8:	5b                   	pop    %ebx
+  8009a9:	5e                   	pop    %esi
+  8009aa:	5d                   	pop    %ebp
+  8009ab:	c3                   	ret
+
+008009ac <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009ac:	55                   	push   %ebp
+  8009ad:	89 e5                	mov    %esp,%ebp
+  8009af:	56                   	push   %esi
+  8009b0:	53                   	push   %ebx
+  8009b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009b7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009ba:	89 f0                	mov    %esi,%eax
+  8009bc:	85 d2                	test   %edx,%edx
+  8009be:	74 21                	je     8009e1 <strlcpy+0x35>
+  8009c0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009c4:	89 f2                	mov    %esi,%edx
+  8009c6:	eb 09                	jmp    8009d1 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009c8:	83 c1 01             	add    $0x1,%ecx
+  8009cb:	83 c2 01             	add    $0x1,%edx
+  8009ce:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009d1:	39 c2                	cmp    %eax,%edx
+  8009d3:	74 09                	je     8009de <strlcpy+0x32>
+  8009d5:	0f b6 19             	movzbl (%ecx),%ebx
+  8009d8:	84 db                	test   %bl,%bl
+  8009da:	75 ec                	jne    8009c8 <strlcpy+0x1c>
+  8009dc:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009de:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009e1:	29 f0                	sub    %esi,%eax
+}
+  8009e3:	5b                   	pop    %ebx
+  8009e4:	5e                   	pop    %esi
+  8009e5:	5d                   	pop    %ebp
+  8009e6:	c3                   	ret
+
+008009e7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009f0:	eb 06                	jmp    8009f8 <strcmp+0x11>
+		p++, q++;
+  8009f2:	83 c1 01             	add    $0x1,%ecx
+  8009f5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009f8:	0f b6 01             	movzbl (%ecx),%eax
+  8009fb:	84 c0                	test   %al,%al
+  8009fd:	74 04                	je     800a03 <strcmp+0x1c>
+  8009ff:	3a 02                	cmp    (%edx),%al
+  800a01:	74 ef                	je     8009f2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a03:	0f b6 c0             	movzbl %al,%eax
+  800a06:	0f b6 12             	movzbl (%edx),%edx
+  800a09:	29 d0                	sub    %edx,%eax
+}
+  800a0b:	5d                   	pop    %ebp
+  800a0c:	c3                   	ret
+
+00800a0d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a0d:	55                   	push   %ebp
+  800a0e:	89 e5                	mov    %esp,%ebp
+  800a10:	53                   	push   %ebx
+  800a11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a17:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a1a:	eb 09                	jmp    800a25 <strncmp+0x18>
+		n--, p++, q++;
+  800a1c:	83 ea 01             	sub    $0x1,%edx
+  800a1f:	83 c0 01             	add    $0x1,%eax
+  800a22:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a25:	85 d2                	test   %edx,%edx
+  800a27:	74 18                	je     800a41 <strncmp+0x34>
+  800a29:	0f b6 18             	movzbl (%eax),%ebx
+  800a2c:	84 db                	test   %bl,%bl
+  800a2e:	74 04                	je     800a34 <strncmp+0x27>
+  800a30:	3a 19                	cmp    (%ecx),%bl
+  800a32:	74 e8                	je     800a1c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a34:	0f b6 00             	movzbl (%eax),%eax
+  800a37:	0f b6 11             	movzbl (%ecx),%edx
+  800a3a:	29 d0                	sub    %edx,%eax
+}
+  800a3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3f:	c9                   	leave
+  800a40:	c3                   	ret
+		return 0;
+  800a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a46:	eb f4                	jmp    800a3c <strncmp+0x2f>
+
+00800a48 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a52:	eb 03                	jmp    800a57 <strchr+0xf>
+  800a54:	83 c0 01             	add    $0x1,%eax
+  800a57:	0f b6 10             	movzbl (%eax),%edx
+  800a5a:	84 d2                	test   %dl,%dl
+  800a5c:	74 06                	je     800a64 <strchr+0x1c>
+		if (*s == c)
+  800a5e:	38 ca                	cmp    %cl,%dl
+  800a60:	75 f2                	jne    800a54 <strchr+0xc>
+  800a62:	eb 05                	jmp    800a69 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a69:	5d                   	pop    %ebp
+  800a6a:	c3                   	ret
+
+00800a6b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a6b:	55                   	push   %ebp
+  800a6c:	89 e5                	mov    %esp,%ebp
+  800a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a71:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a75:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a78:	38 ca                	cmp    %cl,%dl
+  800a7a:	74 09                	je     800a85 <strfind+0x1a>
+  800a7c:	84 d2                	test   %dl,%dl
+  800a7e:	74 05                	je     800a85 <strfind+0x1a>
+	for (; *s; s++)
+  800a80:	83 c0 01             	add    $0x1,%eax
+  800a83:	eb f0                	jmp    800a75 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a85:	5d                   	pop    %ebp
+  800a86:	c3                   	ret
+
+00800a87 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a87:	55                   	push   %ebp
+  800a88:	89 e5                	mov    %esp,%ebp
+  800a8a:	57                   	push   %edi
+  800a8b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a8e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a91:	85 c9                	test   %ecx,%ecx
+  800a93:	74 20                	je     800ab5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a95:	89 f8                	mov    %edi,%eax
+  800a97:	09 c8                	or     %ecx,%eax
+  800a99:	a8 03                	test   $0x3,%al
+  800a9b:	75 12                	jne    800aaf <memset+0x28>
+		c &= 0xFF;
+  800a9d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800aa1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800aa7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800aaa:	fc                   	cld
+  800aab:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aad:	eb 06                	jmp    800ab5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800aaf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ab2:	fc                   	cld
+  800ab3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ab5:	89 f8                	mov    %edi,%eax
+  800ab7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aba:	c9                   	leave
+  800abb:	c3                   	ret
+
+00800abc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	57                   	push   %edi
+  800ac0:	56                   	push   %esi
+  800ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ac7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aca:	39 c6                	cmp    %eax,%esi
+  800acc:	73 32                	jae    800b00 <memmove+0x44>
+  800ace:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ad1:	39 d0                	cmp    %edx,%eax
+  800ad3:	73 2b                	jae    800b00 <memmove+0x44>
+		s += n;
+		d += n;
+  800ad5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ad8:	89 d6                	mov    %edx,%esi
+  800ada:	09 fe                	or     %edi,%esi
+  800adc:	09 ce                	or     %ecx,%esi
+  800ade:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ae4:	75 0e                	jne    800af4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ae6:	83 ef 04             	sub    $0x4,%edi
+  800ae9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aec:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800aef:	fd                   	std
+  800af0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af2:	eb 09                	jmp    800afd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800af4:	83 ef 01             	sub    $0x1,%edi
+  800af7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800afa:	fd                   	std
+  800afb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800afd:	fc                   	cld
+  800afe:	eb 1a                	jmp    800b1a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b00:	89 f2                	mov    %esi,%edx
+  800b02:	09 c2                	or     %eax,%edx
+  800b04:	09 ca                	or     %ecx,%edx
+  800b06:	f6 c2 03             	test   $0x3,%dl
+  800b09:	75 0a                	jne    800b15 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b0b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b0e:	89 c7                	mov    %eax,%edi
+  800b10:	fc                   	cld
+  800b11:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b13:	eb 05                	jmp    800b1a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b15:	89 c7                	mov    %eax,%edi
+  800b17:	fc                   	cld
+  800b18:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b1a:	5e                   	pop    %esi
+  800b1b:	5f                   	pop    %edi
+  800b1c:	5d                   	pop    %ebp
+  800b1d:	c3                   	ret
+
+00800b1e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b24:	ff 75 10             	push   0x10(%ebp)
+  800b27:	ff 75 0c             	push   0xc(%ebp)
+  800b2a:	ff 75 08             	push   0x8(%ebp)
+  800b2d:	e8 8a ff ff ff       	call   800abc <memmove>
+}
+  800b32:	c9                   	leave
+  800b33:	c3                   	ret
+
+00800b34 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b34:	55                   	push   %ebp
+  800b35:	89 e5                	mov    %esp,%ebp
+  800b37:	56                   	push   %esi
+  800b38:	53                   	push   %ebx
+  800b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b3f:	89 c6                	mov    %eax,%esi
+  800b41:	03 75 10             	add    0x10(%ebp),%esi
+  800b44:	eb 06                	jmp    800b4c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b46:	83 c0 01             	add    $0x1,%eax
+  800b49:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b4c:	39 f0                	cmp    %esi,%eax
+  800b4e:	74 14                	je     800b64 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b50:	0f b6 08             	movzbl (%eax),%ecx
+  800b53:	0f b6 1a             	movzbl (%edx),%ebx
+  800b56:	38 d9                	cmp    %bl,%cl
+  800b58:	74 ec                	je     800b46 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b5a:	0f b6 c1             	movzbl %cl,%eax
+  800b5d:	0f b6 db             	movzbl %bl,%ebx
+  800b60:	29 d8                	sub    %ebx,%eax
+  800b62:	eb 05                	jmp    800b69 <memcmp+0x35>
+	}
+
+	return 0;
+  800b64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b69:	5b                   	pop    %ebx
+  800b6a:	5e                   	pop    %esi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b76:	89 c2                	mov    %eax,%edx
+  800b78:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b7b:	eb 03                	jmp    800b80 <memfind+0x13>
+  800b7d:	83 c0 01             	add    $0x1,%eax
+  800b80:	39 d0                	cmp    %edx,%eax
+  800b82:	73 04                	jae    800b88 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b84:	38 08                	cmp    %cl,(%eax)
+  800b86:	75 f5                	jne    800b7d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b88:	5d                   	pop    %ebp
+  800b89:	c3                   	ret
+
+00800b8a <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b8a:	55                   	push   %ebp
+  800b8b:	89 e5                	mov    %esp,%ebp
+  800b8d:	57                   	push   %edi
+  800b8e:	56                   	push   %esi
+  800b8f:	53                   	push   %ebx
+  800b90:	83 ec 1c             	sub    $0x1c,%esp
+  800b93:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b96:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b99:	eb 03                	jmp    800b9e <strtol+0x14>
+		s++;
+  800b9b:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b9e:	0f b6 06             	movzbl (%esi),%eax
+  800ba1:	3c 20                	cmp    $0x20,%al
+  800ba3:	74 f6                	je     800b9b <strtol+0x11>
+  800ba5:	3c 09                	cmp    $0x9,%al
+  800ba7:	74 f2                	je     800b9b <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ba9:	3c 2b                	cmp    $0x2b,%al
+  800bab:	74 43                	je     800bf0 <strtol+0x66>
+	int neg = 0;
+  800bad:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800bb2:	3c 2d                	cmp    $0x2d,%al
+  800bb4:	74 44                	je     800bfa <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb6:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800bbc:	75 0f                	jne    800bcd <strtol+0x43>
+  800bbe:	80 3e 30             	cmpb   $0x30,(%esi)
+  800bc1:	74 41                	je     800c04 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bc3:	85 ff                	test   %edi,%edi
+  800bc5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bca:	0f 44 f8             	cmove  %eax,%edi
+  800bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd2:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800bd7:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800bda:	89 fb                	mov    %edi,%ebx
+  800bdc:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bdf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800be2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800be5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800be8:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800beb:	89 75 08             	mov    %esi,0x8(%ebp)
+  800bee:	eb 67                	jmp    800c57 <strtol+0xcd>
+		s++;
+  800bf0:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800bf3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf8:	eb bc                	jmp    800bb6 <strtol+0x2c>
+		s++, neg = 1;
+  800bfa:	83 c6 01             	add    $0x1,%esi
+  800bfd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c02:	eb b2                	jmp    800bb6 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c04:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c08:	74 0e                	je     800c18 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c0a:	85 ff                	test   %edi,%edi
+  800c0c:	75 bf                	jne    800bcd <strtol+0x43>
+		s++, base = 8;
+  800c0e:	83 c6 01             	add    $0x1,%esi
+  800c11:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c16:	eb b5                	jmp    800bcd <strtol+0x43>
+		s += 2, base = 16;
+  800c18:	83 c6 02             	add    $0x2,%esi
+  800c1b:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c20:	eb ab                	jmp    800bcd <strtol+0x43>
+			dig = *s - '0';
+  800c22:	0f be c9             	movsbl %cl,%ecx
+  800c25:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c28:	39 f9                	cmp    %edi,%ecx
+  800c2a:	7d 59                	jge    800c85 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c2c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c30:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c33:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c36:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c39:	0f af d8             	imul   %eax,%ebx
+  800c3c:	0f af d7             	imul   %edi,%edx
+  800c3f:	01 d3                	add    %edx,%ebx
+  800c41:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c44:	f7 e7                	mul    %edi
+  800c46:	01 da                	add    %ebx,%edx
+  800c48:	89 cb                	mov    %ecx,%ebx
+  800c4a:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c4d:	01 c8                	add    %ecx,%eax
+  800c4f:	11 da                	adc    %ebx,%edx
+  800c51:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c54:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c5a:	0f b6 08             	movzbl (%eax),%ecx
+  800c5d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c60:	80 fb 09             	cmp    $0x9,%bl
+  800c63:	76 bd                	jbe    800c22 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c65:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c68:	80 fb 19             	cmp    $0x19,%bl
+  800c6b:	77 08                	ja     800c75 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c6d:	0f be c9             	movsbl %cl,%ecx
+  800c70:	83 e9 57             	sub    $0x57,%ecx
+  800c73:	eb b3                	jmp    800c28 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c75:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c78:	80 fb 19             	cmp    $0x19,%bl
+  800c7b:	77 08                	ja     800c85 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c7d:	0f be c9             	movsbl %cl,%ecx
+  800c80:	83 e9 37             	sub    $0x37,%ecx
+  800c83:	eb a3                	jmp    800c28 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c85:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c88:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c8b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c91:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c95:	74 05                	je     800c9c <strtol+0x112>
+		*endptr = (char *) s;
+  800c97:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c9a:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c9c:	85 c9                	test   %ecx,%ecx
+  800c9e:	74 07                	je     800ca7 <strtol+0x11d>
+  800ca0:	f7 d8                	neg    %eax
+  800ca2:	83 d2 00             	adc    $0x0,%edx
+  800ca5:	f7 da                	neg    %edx
+}
+  800ca7:	83 c4 1c             	add    $0x1c,%esp
+  800caa:	5b                   	pop    %ebx
+  800cab:	5e                   	pop    %esi
+  800cac:	5f                   	pop    %edi
+  800cad:	5d                   	pop    %ebp
+  800cae:	c3                   	ret
+
+00800caf <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	57                   	push   %edi
+  800cb3:	56                   	push   %esi
+  800cb4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cb5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cbc:	74 18                	je     800cd6 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc9:	89 c3                	mov    %eax,%ebx
+  800ccb:	89 c7                	mov    %eax,%edi
+  800ccd:	89 c6                	mov    %eax,%esi
+  800ccf:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cd1:	5b                   	pop    %ebx
+  800cd2:	5e                   	pop    %esi
+  800cd3:	5f                   	pop    %edi
+  800cd4:	5d                   	pop    %ebp
+  800cd5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce1:	89 c3                	mov    %eax,%ebx
+  800ce3:	89 c7                	mov    %eax,%edi
+  800ce5:	55                   	push   %ebp
+  800ce6:	89 e5                	mov    %esp,%ebp
+  800ce8:	8d 35 f0 0c 80 00    	lea    0x800cf0,%esi
+  800cee:	0f 34                	sysenter
+  800cf0:	5d                   	pop    %ebp
+		goto out;
+  800cf1:	eb de                	jmp    800cd1 <sys_cputs+0x22>
+
+00800cf3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cf3:	55                   	push   %ebp
+  800cf4:	89 e5                	mov    %esp,%ebp
+  800cf6:	57                   	push   %edi
+  800cf7:	56                   	push   %esi
+  800cf8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cf9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d00:	74 19                	je     800d1b <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d07:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d0c:	89 d1                	mov    %edx,%ecx
+  800d0e:	89 d3                	mov    %edx,%ebx
+  800d10:	89 d7                	mov    %edx,%edi
+  800d12:	89 d6                	mov    %edx,%esi
+  800d14:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d16:	5b                   	pop    %ebx
+  800d17:	5e                   	pop    %esi
+  800d18:	5f                   	pop    %edi
+  800d19:	5d                   	pop    %ebp
+  800d1a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d25:	89 d1                	mov    %edx,%ecx
+  800d27:	89 d3                	mov    %edx,%ebx
+  800d29:	89 d7                	mov    %edx,%edi
+  800d2b:	55                   	push   %ebp
+  800d2c:	89 e5                	mov    %esp,%ebp
+  800d2e:	8d 35 36 0d 80 00    	lea    0x800d36,%esi
+  800d34:	0f 34                	sysenter
+  800d36:	5d                   	pop    %ebp
+		goto out;
+  800d37:	eb dd                	jmp    800d16 <sys_cgetc+0x23>
+
+00800d39 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d39:	55                   	push   %ebp
+  800d3a:	89 e5                	mov    %esp,%ebp
+  800d3c:	57                   	push   %edi
+  800d3d:	56                   	push   %esi
+  800d3e:	53                   	push   %ebx
+  800d3f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d42:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d49:	74 21                	je     800d6c <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d50:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d58:	89 cb                	mov    %ecx,%ebx
+  800d5a:	89 cf                	mov    %ecx,%edi
+  800d5c:	89 ce                	mov    %ecx,%esi
+  800d5e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d60:	85 c0                	test   %eax,%eax
+  800d62:	7f 27                	jg     800d8b <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d67:	5b                   	pop    %ebx
+  800d68:	5e                   	pop    %esi
+  800d69:	5f                   	pop    %edi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d74:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d79:	89 cb                	mov    %ecx,%ebx
+  800d7b:	89 cf                	mov    %ecx,%edi
+  800d7d:	55                   	push   %ebp
+  800d7e:	89 e5                	mov    %esp,%ebp
+  800d80:	8d 35 88 0d 80 00    	lea    0x800d88,%esi
+  800d86:	0f 34                	sysenter
+  800d88:	5d                   	pop    %ebp
+		goto out;
+  800d89:	eb d5                	jmp    800d60 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8b:	83 ec 0c             	sub    $0xc,%esp
+  800d8e:	50                   	push   %eax
+  800d8f:	6a 03                	push   $0x3
+  800d91:	68 ab 31 80 00       	push   $0x8031ab
+  800d96:	6a 3f                	push   $0x3f
+  800d98:	68 c8 31 80 00       	push   $0x8031c8
+  800d9d:	e8 71 f4 ff ff       	call   800213 <_panic>
+
+00800da2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	57                   	push   %edi
+  800da6:	56                   	push   %esi
+  800da7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800da8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800daf:	74 19                	je     800dca <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800db1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db6:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dbb:	89 d1                	mov    %edx,%ecx
+  800dbd:	89 d3                	mov    %edx,%ebx
+  800dbf:	89 d7                	mov    %edx,%edi
+  800dc1:	89 d6                	mov    %edx,%esi
+  800dc3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc5:	5b                   	pop    %ebx
+  800dc6:	5e                   	pop    %esi
+  800dc7:	5f                   	pop    %edi
+  800dc8:	5d                   	pop    %ebp
+  800dc9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd4:	89 d1                	mov    %edx,%ecx
+  800dd6:	89 d3                	mov    %edx,%ebx
+  800dd8:	89 d7                	mov    %edx,%edi
+  800dda:	55                   	push   %ebp
+  800ddb:	89 e5                	mov    %esp,%ebp
+  800ddd:	8d 35 e5 0d 80 00    	lea    0x800de5,%esi
+  800de3:	0f 34                	sysenter
+  800de5:	5d                   	pop    %ebp
+		goto out;
+  800de6:	eb dd                	jmp    800dc5 <sys_getenvid+0x23>
+
+00800de8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	57                   	push   %edi
+  800dec:	56                   	push   %esi
+  800ded:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dee:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800df5:	74 19                	je     800e10 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800df7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e01:	89 d1                	mov    %edx,%ecx
+  800e03:	89 d3                	mov    %edx,%ebx
+  800e05:	89 d7                	mov    %edx,%edi
+  800e07:	89 d6                	mov    %edx,%esi
+  800e09:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e15:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e1a:	89 d1                	mov    %edx,%ecx
+  800e1c:	89 d3                	mov    %edx,%ebx
+  800e1e:	89 d7                	mov    %edx,%edi
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	8d 35 2b 0e 80 00    	lea    0x800e2b,%esi
+  800e29:	0f 34                	sysenter
+  800e2b:	5d                   	pop    %ebp
+		goto out;
+  800e2c:	eb dd                	jmp    800e0b <sys_yield+0x23>
+
+00800e2e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	56                   	push   %esi
+  800e33:	53                   	push   %ebx
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e37:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e3e:	74 23                	je     800e63 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e40:	be 00 00 00 00       	mov    $0x0,%esi
+  800e45:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e53:	89 f7                	mov    %esi,%edi
+  800e55:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e57:	85 c0                	test   %eax,%eax
+  800e59:	7f 29                	jg     800e84 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5e:	5b                   	pop    %ebx
+  800e5f:	5e                   	pop    %esi
+  800e60:	5f                   	pop    %edi
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e69:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e76:	55                   	push   %ebp
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	8d 35 81 0e 80 00    	lea    0x800e81,%esi
+  800e7f:	0f 34                	sysenter
+  800e81:	5d                   	pop    %ebp
+		goto out;
+  800e82:	eb d3                	jmp    800e57 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e84:	83 ec 0c             	sub    $0xc,%esp
+  800e87:	50                   	push   %eax
+  800e88:	6a 04                	push   $0x4
+  800e8a:	68 ab 31 80 00       	push   $0x8031ab
+  800e8f:	6a 3f                	push   $0x3f
+  800e91:	68 c8 31 80 00       	push   $0x8031c8
+  800e96:	e8 78 f3 ff ff       	call   800213 <_panic>
+
+00800e9b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	57                   	push   %edi
+  800e9f:	56                   	push   %esi
+  800ea0:	53                   	push   %ebx
+  800ea1:	83 ec 0c             	sub    $0xc,%esp
+  800ea4:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800ea7:	85 f6                	test   %esi,%esi
+  800ea9:	75 09                	jne    800eb4 <sys_page_map+0x19>
+  800eab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eb2:	74 1f                	je     800ed3 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800eb4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec7:	85 c0                	test   %eax,%eax
+  800ec9:	7f 27                	jg     800ef2 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ecb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ece:	5b                   	pop    %ebx
+  800ecf:	5e                   	pop    %esi
+  800ed0:	5f                   	pop    %edi
+  800ed1:	5d                   	pop    %ebp
+  800ed2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ede:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	8d 35 ef 0e 80 00    	lea    0x800eef,%esi
+  800eed:	0f 34                	sysenter
+  800eef:	5d                   	pop    %ebp
+		goto out;
+  800ef0:	eb d5                	jmp    800ec7 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+  800ef5:	50                   	push   %eax
+  800ef6:	6a 05                	push   $0x5
+  800ef8:	68 ab 31 80 00       	push   $0x8031ab
+  800efd:	6a 3f                	push   $0x3f
+  800eff:	68 c8 31 80 00       	push   $0x8031c8
+  800f04:	e8 0a f3 ff ff       	call   800213 <_panic>
+
+00800f09 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f12:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f19:	74 22                	je     800f3d <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f20:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2b:	89 df                	mov    %ebx,%edi
+  800f2d:	89 de                	mov    %ebx,%esi
+  800f2f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	7f 28                	jg     800f5d <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f38:	5b                   	pop    %ebx
+  800f39:	5e                   	pop    %esi
+  800f3a:	5f                   	pop    %edi
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f48:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f4d:	89 df                	mov    %ebx,%edi
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	8d 35 5a 0f 80 00    	lea    0x800f5a,%esi
+  800f58:	0f 34                	sysenter
+  800f5a:	5d                   	pop    %ebp
+		goto out;
+  800f5b:	eb d4                	jmp    800f31 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5d:	83 ec 0c             	sub    $0xc,%esp
+  800f60:	50                   	push   %eax
+  800f61:	6a 06                	push   $0x6
+  800f63:	68 ab 31 80 00       	push   $0x8031ab
+  800f68:	6a 3f                	push   $0x3f
+  800f6a:	68 c8 31 80 00       	push   $0x8031c8
+  800f6f:	e8 9f f2 ff ff       	call   800213 <_panic>
+
+00800f74 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f7d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f84:	74 22                	je     800fa8 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f96:	89 df                	mov    %ebx,%edi
+  800f98:	89 de                	mov    %ebx,%esi
+  800f9a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	7f 28                	jg     800fc8 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb3:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fb8:	89 df                	mov    %ebx,%edi
+  800fba:	55                   	push   %ebp
+  800fbb:	89 e5                	mov    %esp,%ebp
+  800fbd:	8d 35 c5 0f 80 00    	lea    0x800fc5,%esi
+  800fc3:	0f 34                	sysenter
+  800fc5:	5d                   	pop    %ebp
+		goto out;
+  800fc6:	eb d4                	jmp    800f9c <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc8:	83 ec 0c             	sub    $0xc,%esp
+  800fcb:	50                   	push   %eax
+  800fcc:	6a 08                	push   $0x8
+  800fce:	68 ab 31 80 00       	push   $0x8031ab
+  800fd3:	6a 3f                	push   $0x3f
+  800fd5:	68 c8 31 80 00       	push   $0x8031c8
+  800fda:	e8 34 f2 ff ff       	call   800213 <_panic>
+
+00800fdf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	57                   	push   %edi
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+  800fe5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fe8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fef:	74 22                	je     801013 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800ff1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff6:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	89 df                	mov    %ebx,%edi
+  801003:	89 de                	mov    %ebx,%esi
+  801005:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801007:	85 c0                	test   %eax,%eax
+  801009:	7f 28                	jg     801033 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80100b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5f                   	pop    %edi
+  801011:	5d                   	pop    %ebp
+  801012:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801013:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801018:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801023:	89 df                	mov    %ebx,%edi
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	8d 35 30 10 80 00    	lea    0x801030,%esi
+  80102e:	0f 34                	sysenter
+  801030:	5d                   	pop    %ebp
+		goto out;
+  801031:	eb d4                	jmp    801007 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801033:	83 ec 0c             	sub    $0xc,%esp
+  801036:	50                   	push   %eax
+  801037:	6a 09                	push   $0x9
+  801039:	68 ab 31 80 00       	push   $0x8031ab
+  80103e:	6a 3f                	push   $0x3f
+  801040:	68 c8 31 80 00       	push   $0x8031c8
+  801045:	e8 c9 f1 ff ff       	call   800213 <_panic>
+
+0080104a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80104a:	55                   	push   %ebp
+  80104b:	89 e5                	mov    %esp,%ebp
+  80104d:	57                   	push   %edi
+  80104e:	56                   	push   %esi
+  80104f:	53                   	push   %ebx
+  801050:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801053:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80105a:	74 22                	je     80107e <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	89 de                	mov    %ebx,%esi
+  801070:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801072:	85 c0                	test   %eax,%eax
+  801074:	7f 28                	jg     80109e <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801076:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80107e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80108e:	89 df                	mov    %ebx,%edi
+  801090:	55                   	push   %ebp
+  801091:	89 e5                	mov    %esp,%ebp
+  801093:	8d 35 9b 10 80 00    	lea    0x80109b,%esi
+  801099:	0f 34                	sysenter
+  80109b:	5d                   	pop    %ebp
+		goto out;
+  80109c:	eb d4                	jmp    801072 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80109e:	83 ec 0c             	sub    $0xc,%esp
+  8010a1:	50                   	push   %eax
+  8010a2:	6a 0a                	push   $0xa
+  8010a4:	68 ab 31 80 00       	push   $0x8031ab
+  8010a9:	6a 3f                	push   $0x3f
+  8010ab:	68 c8 31 80 00       	push   $0x8031c8
+  8010b0:	e8 5e f1 ff ff       	call   800213 <_panic>
+
+008010b5 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010be:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010c5:	74 22                	je     8010e9 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8010c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cc:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d7:	89 df                	mov    %ebx,%edi
+  8010d9:	89 de                	mov    %ebx,%esi
+  8010db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010dd:	85 c0                	test   %eax,%eax
+  8010df:	7f 28                	jg     801109 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8010e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e4:	5b                   	pop    %ebx
+  8010e5:	5e                   	pop    %esi
+  8010e6:	5f                   	pop    %edi
+  8010e7:	5d                   	pop    %ebp
+  8010e8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010f9:	89 df                	mov    %ebx,%edi
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	8d 35 06 11 80 00    	lea    0x801106,%esi
+  801104:	0f 34                	sysenter
+  801106:	5d                   	pop    %ebp
+		goto out;
+  801107:	eb d4                	jmp    8010dd <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801109:	83 ec 0c             	sub    $0xc,%esp
+  80110c:	50                   	push   %eax
+  80110d:	6a 17                	push   $0x17
+  80110f:	68 ab 31 80 00       	push   $0x8031ab
+  801114:	6a 3f                	push   $0x3f
+  801116:	68 c8 31 80 00       	push   $0x8031c8
+  80111b:	e8 f3 f0 ff ff       	call   800213 <_panic>
+
+00801120 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	57                   	push   %edi
+  801124:	56                   	push   %esi
+  801125:	53                   	push   %ebx
+  801126:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801129:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801130:	74 22                	je     801154 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801137:	b8 18 00 00 00       	mov    $0x18,%eax
+  80113c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801142:	89 df                	mov    %ebx,%edi
+  801144:	89 de                	mov    %ebx,%esi
+  801146:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801148:	85 c0                	test   %eax,%eax
+  80114a:	7f 28                	jg     801174 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80114c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114f:	5b                   	pop    %ebx
+  801150:	5e                   	pop    %esi
+  801151:	5f                   	pop    %edi
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801154:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801159:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801164:	89 df                	mov    %ebx,%edi
+  801166:	55                   	push   %ebp
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	8d 35 71 11 80 00    	lea    0x801171,%esi
+  80116f:	0f 34                	sysenter
+  801171:	5d                   	pop    %ebp
+		goto out;
+  801172:	eb d4                	jmp    801148 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801174:	83 ec 0c             	sub    $0xc,%esp
+  801177:	50                   	push   %eax
+  801178:	6a 18                	push   $0x18
+  80117a:	68 ab 31 80 00       	push   $0x8031ab
+  80117f:	6a 3f                	push   $0x3f
+  801181:	68 c8 31 80 00       	push   $0x8031c8
+  801186:	e8 88 f0 ff ff       	call   800213 <_panic>
+
+0080118b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80118b:	55                   	push   %ebp
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	57                   	push   %edi
+  80118f:	56                   	push   %esi
+  801190:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801191:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801198:	74 1d                	je     8011b7 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80119a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80119f:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011b2:	5b                   	pop    %ebx
+  8011b3:	5e                   	pop    %esi
+  8011b4:	5f                   	pop    %edi
+  8011b5:	5d                   	pop    %ebp
+  8011b6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	8d 35 d3 11 80 00    	lea    0x8011d3,%esi
+  8011d1:	0f 34                	sysenter
+  8011d3:	5d                   	pop    %ebp
+		goto out;
+  8011d4:	eb dc                	jmp    8011b2 <sys_ipc_try_send+0x27>
+
+008011d6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	57                   	push   %edi
+  8011da:	56                   	push   %esi
+  8011db:	53                   	push   %ebx
+  8011dc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011df:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011e6:	74 21                	je     801209 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8011e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f5:	89 cb                	mov    %ecx,%ebx
+  8011f7:	89 cf                	mov    %ecx,%edi
+  8011f9:	89 ce                	mov    %ecx,%esi
+  8011fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011fd:	85 c0                	test   %eax,%eax
+  8011ff:	7f 27                	jg     801228 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801204:	5b                   	pop    %ebx
+  801205:	5e                   	pop    %esi
+  801206:	5f                   	pop    %edi
+  801207:	5d                   	pop    %ebp
+  801208:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801211:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801216:	89 cb                	mov    %ecx,%ebx
+  801218:	89 cf                	mov    %ecx,%edi
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	8d 35 25 12 80 00    	lea    0x801225,%esi
+  801223:	0f 34                	sysenter
+  801225:	5d                   	pop    %ebp
+		goto out;
+  801226:	eb d5                	jmp    8011fd <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801228:	83 ec 0c             	sub    $0xc,%esp
+  80122b:	50                   	push   %eax
+  80122c:	6a 0d                	push   $0xd
+  80122e:	68 ab 31 80 00       	push   $0x8031ab
+  801233:	6a 3f                	push   $0x3f
+  801235:	68 c8 31 80 00       	push   $0x8031c8
+  80123a:	e8 d4 ef ff ff       	call   800213 <_panic>
+
+0080123f <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	56                   	push   %esi
+  801244:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801245:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80124c:	74 1b                	je     801269 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80124e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801253:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801258:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125e:	89 df                	mov    %ebx,%edi
+  801260:	89 de                	mov    %ebx,%esi
+  801262:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801269:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801274:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801279:	89 df                	mov    %ebx,%edi
+  80127b:	55                   	push   %ebp
+  80127c:	89 e5                	mov    %esp,%ebp
+  80127e:	8d 35 86 12 80 00    	lea    0x801286,%esi
+  801284:	0f 34                	sysenter
+  801286:	5d                   	pop    %ebp
+		goto out;
+  801287:	eb db                	jmp    801264 <sys_ipc_recv_until+0x25>
+
+00801289 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801289:	55                   	push   %ebp
+  80128a:	89 e5                	mov    %esp,%ebp
+  80128c:	57                   	push   %edi
+  80128d:	56                   	push   %esi
+  80128e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80128f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801296:	74 19                	je     8012b1 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801298:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012a2:	89 d1                	mov    %edx,%ecx
+  8012a4:	89 d3                	mov    %edx,%ebx
+  8012a6:	89 d7                	mov    %edx,%edi
+  8012a8:	89 d6                	mov    %edx,%esi
+  8012aa:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012ac:	5b                   	pop    %ebx
+  8012ad:	5e                   	pop    %esi
+  8012ae:	5f                   	pop    %edi
+  8012af:	5d                   	pop    %ebp
+  8012b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012bb:	89 d1                	mov    %edx,%ecx
+  8012bd:	89 d3                	mov    %edx,%ebx
+  8012bf:	89 d7                	mov    %edx,%edi
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	8d 35 cc 12 80 00    	lea    0x8012cc,%esi
+  8012ca:	0f 34                	sysenter
+  8012cc:	5d                   	pop    %ebp
+		goto out;
+  8012cd:	eb dd                	jmp    8012ac <sys_time_msec+0x23>
+
+008012cf <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	57                   	push   %edi
+  8012d3:	56                   	push   %esi
+  8012d4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012d5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012dc:	74 1a                	je     8012f8 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8012de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012eb:	89 cb                	mov    %ecx,%ebx
+  8012ed:	89 cf                	mov    %ecx,%edi
+  8012ef:	89 ce                	mov    %ecx,%esi
+  8012f1:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012f3:	5b                   	pop    %ebx
+  8012f4:	5e                   	pop    %esi
+  8012f5:	5f                   	pop    %edi
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801300:	b8 10 00 00 00       	mov    $0x10,%eax
+  801305:	89 cb                	mov    %ecx,%ebx
+  801307:	89 cf                	mov    %ecx,%edi
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	8d 35 14 13 80 00    	lea    0x801314,%esi
+  801312:	0f 34                	sysenter
+  801314:	5d                   	pop    %ebp
+		goto out;
+  801315:	eb dc                	jmp    8012f3 <sys_sleep_until+0x24>
+
+00801317 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801317:	55                   	push   %ebp
+  801318:	89 e5                	mov    %esp,%ebp
+  80131a:	57                   	push   %edi
+  80131b:	56                   	push   %esi
+  80131c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80131d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801324:	74 1a                	je     801340 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801326:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80132b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801330:	8b 55 08             	mov    0x8(%ebp),%edx
+  801333:	89 cb                	mov    %ecx,%ebx
+  801335:	89 cf                	mov    %ecx,%edi
+  801337:	89 ce                	mov    %ecx,%esi
+  801339:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80133b:	5b                   	pop    %ebx
+  80133c:	5e                   	pop    %esi
+  80133d:	5f                   	pop    %edi
+  80133e:	5d                   	pop    %ebp
+  80133f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801340:	8b 55 08             	mov    0x8(%ebp),%edx
+  801343:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801348:	b8 11 00 00 00       	mov    $0x11,%eax
+  80134d:	89 cb                	mov    %ecx,%ebx
+  80134f:	89 cf                	mov    %ecx,%edi
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	8d 35 5c 13 80 00    	lea    0x80135c,%esi
+  80135a:	0f 34                	sysenter
+  80135c:	5d                   	pop    %ebp
+		goto out;
+  80135d:	eb dc                	jmp    80133b <sys_env_print_stats+0x24>
+
+0080135f <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  801362:	57                   	push   %edi
+  801363:	56                   	push   %esi
+  801364:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801365:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80136c:	74 1b                	je     801389 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80136e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801373:	b8 19 00 00 00       	mov    $0x19,%eax
+  801378:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137e:	89 df                	mov    %ebx,%edi
+  801380:	89 de                	mov    %ebx,%esi
+  801382:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801384:	5b                   	pop    %ebx
+  801385:	5e                   	pop    %esi
+  801386:	5f                   	pop    %edi
+  801387:	5d                   	pop    %ebp
+  801388:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801389:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801391:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801394:	b8 19 00 00 00       	mov    $0x19,%eax
+  801399:	89 df                	mov    %ebx,%edi
+  80139b:	55                   	push   %ebp
+  80139c:	89 e5                	mov    %esp,%ebp
+  80139e:	8d 35 a6 13 80 00    	lea    0x8013a6,%esi
+  8013a4:	0f 34                	sysenter
+  8013a6:	5d                   	pop    %ebp
+		goto out;
+  8013a7:	eb db                	jmp    801384 <sys_perf+0x25>
+
+008013a9 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8013a9:	55                   	push   %ebp
+  8013aa:	89 e5                	mov    %esp,%ebp
+  8013ac:	57                   	push   %edi
+  8013ad:	56                   	push   %esi
+  8013ae:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013af:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013b6:	74 19                	je     8013d1 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8013b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013bd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013c2:	89 d1                	mov    %edx,%ecx
+  8013c4:	89 d3                	mov    %edx,%ebx
+  8013c6:	89 d7                	mov    %edx,%edi
+  8013c8:	89 d6                	mov    %edx,%esi
+  8013ca:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013cc:	5b                   	pop    %ebx
+  8013cd:	5e                   	pop    %esi
+  8013ce:	5f                   	pop    %edi
+  8013cf:	5d                   	pop    %ebp
+  8013d0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013db:	89 d1                	mov    %edx,%ecx
+  8013dd:	89 d3                	mov    %edx,%ebx
+  8013df:	89 d7                	mov    %edx,%edi
+  8013e1:	55                   	push   %ebp
+  8013e2:	89 e5                	mov    %esp,%ebp
+  8013e4:	8d 35 ec 13 80 00    	lea    0x8013ec,%esi
+  8013ea:	0f 34                	sysenter
+  8013ec:	5d                   	pop    %ebp
+		goto out;
+  8013ed:	eb dd                	jmp    8013cc <sys_fork+0x23>
+
+008013ef <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8013ef:	55                   	push   %ebp
+  8013f0:	89 e5                	mov    %esp,%ebp
+  8013f2:	57                   	push   %edi
+  8013f3:	56                   	push   %esi
+  8013f4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013fc:	74 1c                	je     80141a <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801403:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801408:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801411:	89 f7                	mov    %esi,%edi
+  801413:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801415:	5b                   	pop    %ebx
+  801416:	5e                   	pop    %esi
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80141a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801420:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801425:	bf 00 00 00 00       	mov    $0x0,%edi
+  80142a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	8d 35 38 14 80 00    	lea    0x801438,%esi
+  801436:	0f 34                	sysenter
+  801438:	5d                   	pop    %ebp
+		goto out;
+  801439:	eb da                	jmp    801415 <sys_thread_create+0x26>
+
+0080143b <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+  801441:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801444:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80144b:	74 24                	je     801471 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80144d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801452:	be 00 00 00 00       	mov    $0x0,%esi
+  801457:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801460:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801463:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801465:	85 c0                	test   %eax,%eax
+  801467:	7f 27                	jg     801490 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146c:	5b                   	pop    %ebx
+  80146d:	5e                   	pop    %esi
+  80146e:	5f                   	pop    %edi
+  80146f:	5d                   	pop    %ebp
+  801470:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801471:	8b 55 08             	mov    0x8(%ebp),%edx
+  801474:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801477:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80147c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	8d 35 8d 14 80 00    	lea    0x80148d,%esi
+  80148b:	0f 34                	sysenter
+  80148d:	5d                   	pop    %ebp
+		goto out;
+  80148e:	eb d5                	jmp    801465 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801490:	83 ec 0c             	sub    $0xc,%esp
+  801493:	50                   	push   %eax
+  801494:	6a 1f                	push   $0x1f
+  801496:	68 ab 31 80 00       	push   $0x8031ab
+  80149b:	6a 3f                	push   $0x3f
+  80149d:	68 c8 31 80 00       	push   $0x8031c8
+  8014a2:	e8 6c ed ff ff       	call   800213 <_panic>
+
+008014a7 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	57                   	push   %edi
+  8014ab:	56                   	push   %esi
+  8014ac:	53                   	push   %ebx
+  8014ad:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014b0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014b7:	74 23                	je     8014dc <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8014b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014be:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014cc:	89 f7                	mov    %esi,%edi
+  8014ce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	7f 29                	jg     8014fd <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8014d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d7:	5b                   	pop    %ebx
+  8014d8:	5e                   	pop    %esi
+  8014d9:	5f                   	pop    %edi
+  8014da:	5d                   	pop    %ebp
+  8014db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e2:	b8 20 00 00 00       	mov    $0x20,%eax
+  8014e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ef:	55                   	push   %ebp
+  8014f0:	89 e5                	mov    %esp,%ebp
+  8014f2:	8d 35 fa 14 80 00    	lea    0x8014fa,%esi
+  8014f8:	0f 34                	sysenter
+  8014fa:	5d                   	pop    %ebp
+		goto out;
+  8014fb:	eb d3                	jmp    8014d0 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014fd:	83 ec 0c             	sub    $0xc,%esp
+  801500:	50                   	push   %eax
+  801501:	6a 20                	push   $0x20
+  801503:	68 ab 31 80 00       	push   $0x8031ab
+  801508:	6a 3f                	push   $0x3f
+  80150a:	68 c8 31 80 00       	push   $0x8031c8
+  80150f:	e8 ff ec ff ff       	call   800213 <_panic>
+
+00801514 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801514:	55                   	push   %ebp
+  801515:	89 e5                	mov    %esp,%ebp
+  801517:	57                   	push   %edi
+  801518:	56                   	push   %esi
+  801519:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80151a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801521:	74 1b                	je     80153e <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801523:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801528:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80152d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801530:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801533:	89 df                	mov    %ebx,%edi
+  801535:	89 de                	mov    %ebx,%esi
+  801537:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801539:	5b                   	pop    %ebx
+  80153a:	5e                   	pop    %esi
+  80153b:	5f                   	pop    %edi
+  80153c:	5d                   	pop    %ebp
+  80153d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80153e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801543:	8b 55 08             	mov    0x8(%ebp),%edx
+  801546:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801549:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80154e:	89 df                	mov    %ebx,%edi
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	8d 35 5b 15 80 00    	lea    0x80155b,%esi
+  801559:	0f 34                	sysenter
+  80155b:	5d                   	pop    %ebp
+		goto out;
+  80155c:	eb db                	jmp    801539 <sys_batch+0x25>
+
+0080155e <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	57                   	push   %edi
+  801562:	56                   	push   %esi
+  801563:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801564:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80156b:	74 1a                	je     801587 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80156d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801572:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801577:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157a:	89 cb                	mov    %ecx,%ebx
+  80157c:	89 cf                	mov    %ecx,%edi
+  80157e:	89 ce                	mov    %ecx,%esi
+  801580:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801582:	5b                   	pop    %ebx
+  801583:	5e                   	pop    %esi
+  801584:	5f                   	pop    %edi
+  801585:	5d                   	pop    %ebp
+  801586:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801587:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801594:	89 cb                	mov    %ecx,%ebx
+  801596:	89 cf                	mov    %ecx,%edi
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	8d 35 a3 15 80 00    	lea    0x8015a3,%esi
+  8015a1:	0f 34                	sysenter
+  8015a3:	5d                   	pop    %ebp
+		goto out;
+  8015a4:	eb dc                	jmp    801582 <sys_trace_ctl+0x24>
+
+008015a6 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8015a6:	55                   	push   %ebp
+  8015a7:	89 e5                	mov    %esp,%ebp
+  8015a9:	57                   	push   %edi
+  8015aa:	56                   	push   %esi
+  8015ab:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015ac:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015b3:	74 1c                	je     8015d1 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8015b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c8:	89 f7                	mov    %esi,%edi
+  8015ca:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8015cc:	5b                   	pop    %ebx
+  8015cd:	5e                   	pop    %esi
+  8015ce:	5f                   	pop    %edi
+  8015cf:	5d                   	pop    %ebp
+  8015d0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	8d 35 ef 15 80 00    	lea    0x8015ef,%esi
+  8015ed:	0f 34                	sysenter
+  8015ef:	5d                   	pop    %ebp
+		goto out;
+  8015f0:	eb da                	jmp    8015cc <sys_trace_read+0x26>
+
+008015f2 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	57                   	push   %edi
+  8015f6:	56                   	push   %esi
+  8015f7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015f8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015ff:	74 1c                	je     80161d <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801601:	be 00 00 00 00       	mov    $0x0,%esi
+  801606:	b8 21 00 00 00       	mov    $0x21,%eax
+  80160b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801611:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801614:	89 f7                	mov    %esi,%edi
+  801616:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801618:	5b                   	pop    %ebx
+  801619:	5e                   	pop    %esi
+  80161a:	5f                   	pop    %edi
+  80161b:	5d                   	pop    %ebp
+  80161c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80161d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801620:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801623:	b8 21 00 00 00       	mov    $0x21,%eax
+  801628:	bf 00 00 00 00       	mov    $0x0,%edi
+  80162d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	8d 35 3b 16 80 00    	lea    0x80163b,%esi
+  801639:	0f 34                	sysenter
+  80163b:	5d                   	pop    %ebp
+		goto out;
+  80163c:	eb da                	jmp    801618 <sys_meminfo+0x26>
+
+0080163e <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80163e:	55                   	push   %ebp
+  80163f:	89 e5                	mov    %esp,%ebp
+  801641:	57                   	push   %edi
+  801642:	56                   	push   %esi
+  801643:	53                   	push   %ebx
+  801644:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801647:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80164b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801652:	74 1f                	je     801673 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801659:	b8 22 00 00 00       	mov    $0x22,%eax
+  80165e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801661:	89 df                	mov    %ebx,%edi
+  801663:	89 de                	mov    %ebx,%esi
+  801665:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801667:	85 c0                	test   %eax,%eax
+  801669:	7f 25                	jg     801690 <sys_env_set_ksm+0x52>
+}
+  80166b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80166e:	5b                   	pop    %ebx
+  80166f:	5e                   	pop    %esi
+  801670:	5f                   	pop    %edi
+  801671:	5d                   	pop    %ebp
+  801672:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801673:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801678:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167b:	b8 22 00 00 00       	mov    $0x22,%eax
+  801680:	89 df                	mov    %ebx,%edi
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	8d 35 8d 16 80 00    	lea    0x80168d,%esi
+  80168b:	0f 34                	sysenter
+  80168d:	5d                   	pop    %ebp
+		goto out;
+  80168e:	eb d7                	jmp    801667 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801690:	83 ec 0c             	sub    $0xc,%esp
+  801693:	50                   	push   %eax
+  801694:	6a 22                	push   $0x22
+  801696:	68 ab 31 80 00       	push   $0x8031ab
+  80169b:	6a 3f                	push   $0x3f
+  80169d:	68 c8 31 80 00       	push   $0x8031c8
+  8016a2:	e8 6c eb ff ff       	call   800213 <_panic>
+
+008016a7 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8016a7:	55                   	push   %ebp
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	57                   	push   %edi
+  8016ab:	56                   	push   %esi
+  8016ac:	53                   	push   %ebx
+  8016ad:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8016b0:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8016b3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016ba:	74 24                	je     8016e0 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8016bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016c6:	89 cb                	mov    %ecx,%ebx
+  8016c8:	89 cf                	mov    %ecx,%edi
+  8016ca:	89 ce                	mov    %ecx,%esi
+  8016cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016ce:	85 c0                	test   %eax,%eax
+  8016d0:	7f 2a                	jg     8016fc <sys_time_nsec+0x55>
+	return ns;
+}
+  8016d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016d5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016db:	5b                   	pop    %ebx
+  8016dc:	5e                   	pop    %esi
+  8016dd:	5f                   	pop    %edi
+  8016de:	5d                   	pop    %ebp
+  8016df:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8016ea:	89 cb                	mov    %ecx,%ebx
+  8016ec:	89 cf                	mov    %ecx,%edi
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	8d 35 f9 16 80 00    	lea    0x8016f9,%esi
+  8016f7:	0f 34                	sysenter
+  8016f9:	5d                   	pop    %ebp
+		goto out;
+  8016fa:	eb d2                	jmp    8016ce <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016fc:	83 ec 0c             	sub    $0xc,%esp
+  8016ff:	50                   	push   %eax
+  801700:	6a 0f                	push   $0xf
+  801702:	68 ab 31 80 00       	push   $0x8031ab
+  801707:	6a 3f                	push   $0x3f
+  801709:	68 c8 31 80 00       	push   $0x8031c8
+  80170e:	e8 00 eb ff ff       	call   800213 <_panic>
+
+00801713 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801713:	55                   	push   %ebp
+  801714:	89 e5                	mov    %esp,%ebp
+  801716:	57                   	push   %edi
+  801717:	56                   	push   %esi
+  801718:	53                   	push   %ebx
+  801719:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80171c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801723:	74 22                	je     801747 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801725:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80172f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801732:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801735:	89 df                	mov    %ebx,%edi
+  801737:	89 de                	mov    %ebx,%esi
+  801739:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	7f 28                	jg     801767 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80173f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801742:	5b                   	pop    %ebx
+  801743:	5e                   	pop    %esi
+  801744:	5f                   	pop    %edi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801747:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801752:	b8 12 00 00 00       	mov    $0x12,%eax
+  801757:	89 df                	mov    %ebx,%edi
+  801759:	55                   	push   %ebp
+  80175a:	89 e5                	mov    %esp,%ebp
+  80175c:	8d 35 64 17 80 00    	lea    0x801764,%esi
+  801762:	0f 34                	sysenter
+  801764:	5d                   	pop    %ebp
+		goto out;
+  801765:	eb d4                	jmp    80173b <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801767:	83 ec 0c             	sub    $0xc,%esp
+  80176a:	50                   	push   %eax
+  80176b:	6a 12                	push   $0x12
+  80176d:	68 ab 31 80 00       	push   $0x8031ab
+  801772:	6a 3f                	push   $0x3f
+  801774:	68 c8 31 80 00       	push   $0x8031c8
+  801779:	e8 95 ea ff ff       	call   800213 <_panic>
+
+0080177e <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80177e:	55                   	push   %ebp
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	57                   	push   %edi
+  801782:	56                   	push   %esi
+  801783:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801784:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80178b:	74 1b                	je     8017a8 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80178d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801792:	b8 13 00 00 00       	mov    $0x13,%eax
+  801797:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80179d:	89 df                	mov    %ebx,%edi
+  80179f:	89 de                	mov    %ebx,%esi
+  8017a1:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017a3:	5b                   	pop    %ebx
+  8017a4:	5e                   	pop    %esi
+  8017a5:	5f                   	pop    %edi
+  8017a6:	5d                   	pop    %ebp
+  8017a7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b3:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017b8:	89 df                	mov    %ebx,%edi
+  8017ba:	55                   	push   %ebp
+  8017bb:	89 e5                	mov    %esp,%ebp
+  8017bd:	8d 35 c5 17 80 00    	lea    0x8017c5,%esi
+  8017c3:	0f 34                	sysenter
+  8017c5:	5d                   	pop    %ebp
+		goto out;
+  8017c6:	eb db                	jmp    8017a3 <sys_e1000_receive+0x25>
+
+008017c8 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8017c8:	55                   	push   %ebp
+  8017c9:	89 e5                	mov    %esp,%ebp
+  8017cb:	57                   	push   %edi
+  8017cc:	56                   	push   %esi
+  8017cd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ce:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017d5:	74 1b                	je     8017f2 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8017d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017dc:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e7:	89 df                	mov    %ebx,%edi
+  8017e9:	89 de                	mov    %ebx,%esi
+  8017eb:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017ed:	5b                   	pop    %ebx
+  8017ee:	5e                   	pop    %esi
+  8017ef:	5f                   	pop    %edi
+  8017f0:	5d                   	pop    %ebp
+  8017f1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fd:	b8 14 00 00 00       	mov    $0x14,%eax
+  801802:	89 df                	mov    %ebx,%edi
+  801804:	55                   	push   %ebp
+  801805:	89 e5                	mov    %esp,%ebp
+  801807:	8d 35 0f 18 80 00    	lea    0x80180f,%esi
+  80180d:	0f 34                	sysenter
+  80180f:	5d                   	pop    %ebp
+		goto out;
+  801810:	eb db                	jmp    8017ed <sys_e1000_read_hwaddr+0x25>
+
+00801812 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801812:	55                   	push   %ebp
+  801813:	89 e5                	mov    %esp,%ebp
+  801815:	57                   	push   %edi
+  801816:	56                   	push   %esi
+  801817:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801818:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80181f:	74 1a                	je     80183b <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801821:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801826:	b8 15 00 00 00       	mov    $0x15,%eax
+  80182b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182e:	89 cb                	mov    %ecx,%ebx
+  801830:	89 cf                	mov    %ecx,%edi
+  801832:	89 ce                	mov    %ecx,%esi
+  801834:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801836:	5b                   	pop    %ebx
+  801837:	5e                   	pop    %esi
+  801838:	5f                   	pop    %edi
+  801839:	5d                   	pop    %ebp
+  80183a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80183b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801843:	b8 15 00 00 00       	mov    $0x15,%eax
+  801848:	89 cb                	mov    %ecx,%ebx
+  80184a:	89 cf                	mov    %ecx,%edi
+  80184c:	55                   	push   %ebp
+  80184d:	89 e5                	mov    %esp,%ebp
+  80184f:	8d 35 57 18 80 00    	lea    0x801857,%esi
+  801855:	0f 34                	sysenter
+  801857:	5d                   	pop    %ebp
+		goto out;
+  801858:	eb dc                	jmp    801836 <sys_sb16_read_version+0x24>
+
+0080185a <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80185a:	55                   	push   %ebp
+  80185b:	89 e5                	mov    %esp,%ebp
+  80185d:	57                   	push   %edi
+  80185e:	56                   	push   %esi
+  80185f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801860:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801867:	74 1b                	je     801884 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801869:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801873:	8b 55 08             	mov    0x8(%ebp),%edx
+  801876:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801879:	89 df                	mov    %ebx,%edi
+  80187b:	89 de                	mov    %ebx,%esi
+  80187d:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80187f:	5b                   	pop    %ebx
+  801880:	5e                   	pop    %esi
+  801881:	5f                   	pop    %edi
+  801882:	5d                   	pop    %ebp
+  801883:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801884:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801889:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80188f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801894:	89 df                	mov    %ebx,%edi
+  801896:	55                   	push   %ebp
+  801897:	89 e5                	mov    %esp,%ebp
+  801899:	8d 35 a1 18 80 00    	lea    0x8018a1,%esi
+  80189f:	0f 34                	sysenter
+  8018a1:	5d                   	pop    %ebp
+		goto out;
+  8018a2:	eb db                	jmp    80187f <sys_sb16_play+0x25>
+
+008018a4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018aa:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018af:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018b2:	5d                   	pop    %ebp
+  8018b3:	c3                   	ret
+
+008018b4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018b4:	55                   	push   %ebp
+  8018b5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ba:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8018bf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8018c4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018c9:	5d                   	pop    %ebp
+  8018ca:	c3                   	ret
+
+008018cb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018cb:	55                   	push   %ebp
+  8018cc:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8018ce:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018d3:	eb 02                	jmp    8018d7 <fd_alloc+0xc>
+  8018d5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018d7:	89 c2                	mov    %eax,%edx
+  8018d9:	c1 ea 16             	shr    $0x16,%edx
+  8018dc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018e3:	f6 c2 01             	test   $0x1,%dl
+  8018e6:	74 2b                	je     801913 <fd_alloc+0x48>
+  8018e8:	89 c2                	mov    %eax,%edx
+  8018ea:	c1 ea 0c             	shr    $0xc,%edx
+  8018ed:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018f4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018fa:	f6 c1 01             	test   $0x1,%cl
+  8018fd:	74 14                	je     801913 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018ff:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801905:	75 ce                	jne    8018d5 <fd_alloc+0xa>
+  801907:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80190c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801911:	eb 05                	jmp    801918 <fd_alloc+0x4d>
+			return 0;
+  801913:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801918:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191b:	89 02                	mov    %eax,(%edx)
+}
+  80191d:	89 c8                	mov    %ecx,%eax
+  80191f:	5d                   	pop    %ebp
+  801920:	c3                   	ret
+
+00801921 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+  801924:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801927:	83 f8 1f             	cmp    $0x1f,%eax
+  80192a:	77 30                	ja     80195c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80192c:	c1 e0 0c             	shl    $0xc,%eax
+  80192f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801934:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80193a:	f6 c2 01             	test   $0x1,%dl
+  80193d:	74 24                	je     801963 <fd_lookup+0x42>
+  80193f:	89 c2                	mov    %eax,%edx
+  801941:	c1 ea 0c             	shr    $0xc,%edx
+  801944:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80194b:	f6 c2 01             	test   $0x1,%dl
+  80194e:	74 1a                	je     80196a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801950:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801953:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801955:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80195a:	5d                   	pop    %ebp
+  80195b:	c3                   	ret
+		return -E_INVAL;
+  80195c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801961:	eb f7                	jmp    80195a <fd_lookup+0x39>
+		return -E_INVAL;
+  801963:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801968:	eb f0                	jmp    80195a <fd_lookup+0x39>
+  80196a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80196f:	eb e9                	jmp    80195a <fd_lookup+0x39>
+
+00801971 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801971:	55                   	push   %ebp
+  801972:	89 e5                	mov    %esp,%ebp
+  801974:	53                   	push   %ebx
+  801975:	83 ec 04             	sub    $0x4,%esp
+  801978:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80197b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801980:	eb 03                	jmp    801985 <dev_lookup+0x14>
+  801982:	83 c0 01             	add    $0x1,%eax
+  801985:	8b 1c 85 54 32 80 00 	mov    0x803254(,%eax,4),%ebx
+  80198c:	85 db                	test   %ebx,%ebx
+  80198e:	74 0b                	je     80199b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801990:	39 13                	cmp    %edx,(%ebx)
+  801992:	75 ee                	jne    801982 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801994:	b8 00 00 00 00       	mov    $0x0,%eax
+  801999:	eb 2e                	jmp    8019c9 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80199b:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80199d:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8019a2:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8019a8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8019ad:	76 24                	jbe    8019d3 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019af:	8b 41 48             	mov    0x48(%ecx),%eax
+  8019b2:	83 ec 04             	sub    $0x4,%esp
+  8019b5:	52                   	push   %edx
+  8019b6:	50                   	push   %eax
+  8019b7:	68 d8 31 80 00       	push   $0x8031d8
+  8019bc:	e8 2d e9 ff ff       	call   8002ee <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8019c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019cc:	89 1a                	mov    %ebx,(%edx)
+}
+  8019ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d1:	c9                   	leave
+  8019d2:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8019d3:	c1 e8 10             	shr    $0x10,%eax
+  8019d6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8019dc:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8019e2:	eb cb                	jmp    8019af <dev_lookup+0x3e>
+
+008019e4 <fd_close>:
+{
+  8019e4:	55                   	push   %ebp
+  8019e5:	89 e5                	mov    %esp,%ebp
+  8019e7:	57                   	push   %edi
+  8019e8:	56                   	push   %esi
+  8019e9:	53                   	push   %ebx
+  8019ea:	83 ec 24             	sub    $0x24,%esp
+  8019ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019f0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019f3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019f6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019f7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019fd:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a00:	50                   	push   %eax
+  801a01:	e8 1b ff ff ff       	call   801921 <fd_lookup>
+  801a06:	89 c3                	mov    %eax,%ebx
+  801a08:	83 c4 10             	add    $0x10,%esp
+  801a0b:	85 c0                	test   %eax,%eax
+  801a0d:	78 05                	js     801a14 <fd_close+0x30>
+	    || fd != fd2)
+  801a0f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a12:	74 16                	je     801a2a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a14:	89 f8                	mov    %edi,%eax
+  801a16:	84 c0                	test   %al,%al
+  801a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a20:	89 d8                	mov    %ebx,%eax
+  801a22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a25:	5b                   	pop    %ebx
+  801a26:	5e                   	pop    %esi
+  801a27:	5f                   	pop    %edi
+  801a28:	5d                   	pop    %ebp
+  801a29:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a2a:	83 ec 08             	sub    $0x8,%esp
+  801a2d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a30:	50                   	push   %eax
+  801a31:	ff 36                	push   (%esi)
+  801a33:	e8 39 ff ff ff       	call   801971 <dev_lookup>
+  801a38:	89 c3                	mov    %eax,%ebx
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 1a                	js     801a5b <fd_close+0x77>
+		if (dev->dev_close)
+  801a41:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a44:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a47:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	74 0b                	je     801a5b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a50:	83 ec 0c             	sub    $0xc,%esp
+  801a53:	56                   	push   %esi
+  801a54:	ff d0                	call   *%eax
+  801a56:	89 c3                	mov    %eax,%ebx
+  801a58:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a5b:	83 ec 08             	sub    $0x8,%esp
+  801a5e:	56                   	push   %esi
+  801a5f:	6a 00                	push   $0x0
+  801a61:	e8 a3 f4 ff ff       	call   800f09 <sys_page_unmap>
+	return r;
+  801a66:	83 c4 10             	add    $0x10,%esp
+  801a69:	eb b5                	jmp    801a20 <fd_close+0x3c>
+
+00801a6b <close>:
+
+int
+close(int fdnum)
+{
+  801a6b:	55                   	push   %ebp
+  801a6c:	89 e5                	mov    %esp,%ebp
+  801a6e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a74:	50                   	push   %eax
+  801a75:	ff 75 08             	push   0x8(%ebp)
+  801a78:	e8 a4 fe ff ff       	call   801921 <fd_lookup>
+  801a7d:	83 c4 10             	add    $0x10,%esp
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	79 02                	jns    801a86 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a84:	c9                   	leave
+  801a85:	c3                   	ret
+		return fd_close(fd, 1);
+  801a86:	83 ec 08             	sub    $0x8,%esp
+  801a89:	6a 01                	push   $0x1
+  801a8b:	ff 75 f4             	push   -0xc(%ebp)
+  801a8e:	e8 51 ff ff ff       	call   8019e4 <fd_close>
+  801a93:	83 c4 10             	add    $0x10,%esp
+  801a96:	eb ec                	jmp    801a84 <close+0x19>
+
+00801a98 <close_all>:
+
+void
+close_all(void)
+{
+  801a98:	55                   	push   %ebp
+  801a99:	89 e5                	mov    %esp,%ebp
+  801a9b:	53                   	push   %ebx
+  801a9c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801aa4:	83 ec 0c             	sub    $0xc,%esp
+  801aa7:	53                   	push   %ebx
+  801aa8:	e8 be ff ff ff       	call   801a6b <close>
+	for (i = 0; i < MAXFD; i++)
+  801aad:	83 c3 01             	add    $0x1,%ebx
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	83 fb 20             	cmp    $0x20,%ebx
+  801ab6:	75 ec                	jne    801aa4 <close_all+0xc>
+}
+  801ab8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801abb:	c9                   	leave
+  801abc:	c3                   	ret
+
+00801abd <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801abd:	55                   	push   %ebp
+  801abe:	89 e5                	mov    %esp,%ebp
+  801ac0:	57                   	push   %edi
+  801ac1:	56                   	push   %esi
+  801ac2:	53                   	push   %ebx
+  801ac3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ac6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ac9:	50                   	push   %eax
+  801aca:	ff 75 08             	push   0x8(%ebp)
+  801acd:	e8 4f fe ff ff       	call   801921 <fd_lookup>
+  801ad2:	89 c3                	mov    %eax,%ebx
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	78 7f                	js     801b5a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801adb:	83 ec 0c             	sub    $0xc,%esp
+  801ade:	ff 75 0c             	push   0xc(%ebp)
+  801ae1:	e8 85 ff ff ff       	call   801a6b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801ae6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ae9:	c1 e6 0c             	shl    $0xc,%esi
+  801aec:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801af2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801af5:	89 3c 24             	mov    %edi,(%esp)
+  801af8:	e8 b7 fd ff ff       	call   8018b4 <fd2data>
+  801afd:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801aff:	89 34 24             	mov    %esi,(%esp)
+  801b02:	e8 ad fd ff ff       	call   8018b4 <fd2data>
+  801b07:	83 c4 10             	add    $0x10,%esp
+  801b0a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b0d:	89 d8                	mov    %ebx,%eax
+  801b0f:	c1 e8 16             	shr    $0x16,%eax
+  801b12:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b19:	a8 01                	test   $0x1,%al
+  801b1b:	74 11                	je     801b2e <dup+0x71>
+  801b1d:	89 d8                	mov    %ebx,%eax
+  801b1f:	c1 e8 0c             	shr    $0xc,%eax
+  801b22:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b29:	f6 c2 01             	test   $0x1,%dl
+  801b2c:	75 36                	jne    801b64 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b2e:	89 f8                	mov    %edi,%eax
+  801b30:	c1 e8 0c             	shr    $0xc,%eax
+  801b33:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b3a:	83 ec 0c             	sub    $0xc,%esp
+  801b3d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b42:	50                   	push   %eax
+  801b43:	56                   	push   %esi
+  801b44:	6a 00                	push   $0x0
+  801b46:	57                   	push   %edi
+  801b47:	6a 00                	push   $0x0
+  801b49:	e8 4d f3 ff ff       	call   800e9b <sys_page_map>
+  801b4e:	89 c3                	mov    %eax,%ebx
+  801b50:	83 c4 20             	add    $0x20,%esp
+  801b53:	85 c0                	test   %eax,%eax
+  801b55:	78 33                	js     801b8a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b57:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b5a:	89 d8                	mov    %ebx,%eax
+  801b5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b5f:	5b                   	pop    %ebx
+  801b60:	5e                   	pop    %esi
+  801b61:	5f                   	pop    %edi
+  801b62:	5d                   	pop    %ebp
+  801b63:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b64:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b6b:	83 ec 0c             	sub    $0xc,%esp
+  801b6e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b73:	50                   	push   %eax
+  801b74:	ff 75 d4             	push   -0x2c(%ebp)
+  801b77:	6a 00                	push   $0x0
+  801b79:	53                   	push   %ebx
+  801b7a:	6a 00                	push   $0x0
+  801b7c:	e8 1a f3 ff ff       	call   800e9b <sys_page_map>
+  801b81:	89 c3                	mov    %eax,%ebx
+  801b83:	83 c4 20             	add    $0x20,%esp
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	79 a4                	jns    801b2e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b8a:	83 ec 08             	sub    $0x8,%esp
+  801b8d:	56                   	push   %esi
+  801b8e:	6a 00                	push   $0x0
+  801b90:	e8 74 f3 ff ff       	call   800f09 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b95:	83 c4 08             	add    $0x8,%esp
+  801b98:	ff 75 d4             	push   -0x2c(%ebp)
+  801b9b:	6a 00                	push   $0x0
+  801b9d:	e8 67 f3 ff ff       	call   800f09 <sys_page_unmap>
+	return r;
+  801ba2:	83 c4 10             	add    $0x10,%esp
+  801ba5:	eb b3                	jmp    801b5a <dup+0x9d>
+
+00801ba7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ba7:	55                   	push   %ebp
+  801ba8:	89 e5                	mov    %esp,%ebp
+  801baa:	56                   	push   %esi
+  801bab:	53                   	push   %ebx
+  801bac:	83 ec 18             	sub    $0x18,%esp
+  801baf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bb2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bb5:	50                   	push   %eax
+  801bb6:	53                   	push   %ebx
+  801bb7:	e8 65 fd ff ff       	call   801921 <fd_lookup>
+  801bbc:	83 c4 10             	add    $0x10,%esp
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	78 3c                	js     801bff <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bc3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bc6:	83 ec 08             	sub    $0x8,%esp
+  801bc9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bcc:	50                   	push   %eax
+  801bcd:	ff 36                	push   (%esi)
+  801bcf:	e8 9d fd ff ff       	call   801971 <dev_lookup>
+  801bd4:	83 c4 10             	add    $0x10,%esp
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	78 24                	js     801bff <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bdb:	8b 46 08             	mov    0x8(%esi),%eax
+  801bde:	83 e0 03             	and    $0x3,%eax
+  801be1:	83 f8 01             	cmp    $0x1,%eax
+  801be4:	74 20                	je     801c06 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801be6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801be9:	8b 40 08             	mov    0x8(%eax),%eax
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	74 57                	je     801c47 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801bf0:	83 ec 04             	sub    $0x4,%esp
+  801bf3:	ff 75 10             	push   0x10(%ebp)
+  801bf6:	ff 75 0c             	push   0xc(%ebp)
+  801bf9:	56                   	push   %esi
+  801bfa:	ff d0                	call   *%eax
+  801bfc:	83 c4 10             	add    $0x10,%esp
+}
+  801bff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c02:	5b                   	pop    %ebx
+  801c03:	5e                   	pop    %esi
+  801c04:	5d                   	pop    %ebp
+  801c05:	c3                   	ret
+  801c06:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c08:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c0d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c13:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c18:	76 1c                	jbe    801c36 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c1a:	8b 42 48             	mov    0x48(%edx),%eax
+  801c1d:	83 ec 04             	sub    $0x4,%esp
+  801c20:	53                   	push   %ebx
+  801c21:	50                   	push   %eax
+  801c22:	68 19 32 80 00       	push   $0x803219
+  801c27:	e8 c2 e6 ff ff       	call   8002ee <cprintf>
+		return -E_INVAL;
+  801c2c:	83 c4 10             	add    $0x10,%esp
+  801c2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c34:	eb c9                	jmp    801bff <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c36:	c1 e8 10             	shr    $0x10,%eax
+  801c39:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c3f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c45:	eb d3                	jmp    801c1a <read+0x73>
+		return -E_NOT_SUPP;
+  801c47:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c4c:	eb b1                	jmp    801bff <read+0x58>
+
+00801c4e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c4e:	55                   	push   %ebp
+  801c4f:	89 e5                	mov    %esp,%ebp
+  801c51:	57                   	push   %edi
+  801c52:	56                   	push   %esi
+  801c53:	53                   	push   %ebx
+  801c54:	83 ec 0c             	sub    $0xc,%esp
+  801c57:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c5a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c62:	eb 02                	jmp    801c66 <readn+0x18>
+  801c64:	01 c3                	add    %eax,%ebx
+  801c66:	39 f3                	cmp    %esi,%ebx
+  801c68:	73 21                	jae    801c8b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c6a:	83 ec 04             	sub    $0x4,%esp
+  801c6d:	89 f0                	mov    %esi,%eax
+  801c6f:	29 d8                	sub    %ebx,%eax
+  801c71:	50                   	push   %eax
+  801c72:	89 d8                	mov    %ebx,%eax
+  801c74:	03 45 0c             	add    0xc(%ebp),%eax
+  801c77:	50                   	push   %eax
+  801c78:	57                   	push   %edi
+  801c79:	e8 29 ff ff ff       	call   801ba7 <read>
+		if (m < 0)
+  801c7e:	83 c4 10             	add    $0x10,%esp
+  801c81:	85 c0                	test   %eax,%eax
+  801c83:	78 04                	js     801c89 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c85:	75 dd                	jne    801c64 <readn+0x16>
+  801c87:	eb 02                	jmp    801c8b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c89:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c8b:	89 d8                	mov    %ebx,%eax
+  801c8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c90:	5b                   	pop    %ebx
+  801c91:	5e                   	pop    %esi
+  801c92:	5f                   	pop    %edi
+  801c93:	5d                   	pop    %ebp
+  801c94:	c3                   	ret
+
+00801c95 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c95:	55                   	push   %ebp
+  801c96:	89 e5                	mov    %esp,%ebp
+  801c98:	56                   	push   %esi
+  801c99:	53                   	push   %ebx
+  801c9a:	83 ec 18             	sub    $0x18,%esp
+  801c9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ca0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca3:	50                   	push   %eax
+  801ca4:	53                   	push   %ebx
+  801ca5:	e8 77 fc ff ff       	call   801921 <fd_lookup>
+  801caa:	83 c4 10             	add    $0x10,%esp
+  801cad:	85 c0                	test   %eax,%eax
+  801caf:	78 37                	js     801ce8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cb1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cb4:	83 ec 08             	sub    $0x8,%esp
+  801cb7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cba:	50                   	push   %eax
+  801cbb:	ff 36                	push   (%esi)
+  801cbd:	e8 af fc ff ff       	call   801971 <dev_lookup>
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	78 1f                	js     801ce8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cc9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ccd:	74 20                	je     801cef <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ccf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cd5:	85 c0                	test   %eax,%eax
+  801cd7:	74 57                	je     801d30 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801cd9:	83 ec 04             	sub    $0x4,%esp
+  801cdc:	ff 75 10             	push   0x10(%ebp)
+  801cdf:	ff 75 0c             	push   0xc(%ebp)
+  801ce2:	56                   	push   %esi
+  801ce3:	ff d0                	call   *%eax
+  801ce5:	83 c4 10             	add    $0x10,%esp
+}
+  801ce8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ceb:	5b                   	pop    %ebx
+  801cec:	5e                   	pop    %esi
+  801ced:	5d                   	pop    %ebp
+  801cee:	c3                   	ret
+  801cef:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cf1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cf6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cfc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d01:	76 1c                	jbe    801d1f <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d03:	8b 42 48             	mov    0x48(%edx),%eax
+  801d06:	83 ec 04             	sub    $0x4,%esp
+  801d09:	53                   	push   %ebx
+  801d0a:	50                   	push   %eax
+  801d0b:	68 35 32 80 00       	push   $0x803235
+  801d10:	e8 d9 e5 ff ff       	call   8002ee <cprintf>
+		return -E_INVAL;
+  801d15:	83 c4 10             	add    $0x10,%esp
+  801d18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1d:	eb c9                	jmp    801ce8 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d1f:	c1 e8 10             	shr    $0x10,%eax
+  801d22:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d28:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d2e:	eb d3                	jmp    801d03 <write+0x6e>
+		return -E_NOT_SUPP;
+  801d30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d35:	eb b1                	jmp    801ce8 <write+0x53>
+
+00801d37 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d40:	50                   	push   %eax
+  801d41:	ff 75 08             	push   0x8(%ebp)
+  801d44:	e8 d8 fb ff ff       	call   801921 <fd_lookup>
+  801d49:	83 c4 10             	add    $0x10,%esp
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	78 0e                	js     801d5e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d56:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d5e:	c9                   	leave
+  801d5f:	c3                   	ret
+
+00801d60 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d60:	55                   	push   %ebp
+  801d61:	89 e5                	mov    %esp,%ebp
+  801d63:	56                   	push   %esi
+  801d64:	53                   	push   %ebx
+  801d65:	83 ec 18             	sub    $0x18,%esp
+  801d68:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d6b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d6e:	50                   	push   %eax
+  801d6f:	53                   	push   %ebx
+  801d70:	e8 ac fb ff ff       	call   801921 <fd_lookup>
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 34                	js     801db0 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d7c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d7f:	83 ec 08             	sub    $0x8,%esp
+  801d82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d85:	50                   	push   %eax
+  801d86:	ff 36                	push   (%esi)
+  801d88:	e8 e4 fb ff ff       	call   801971 <dev_lookup>
+  801d8d:	83 c4 10             	add    $0x10,%esp
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	78 1c                	js     801db0 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d94:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d98:	74 1d                	je     801db7 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d9d:	8b 40 18             	mov    0x18(%eax),%eax
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	74 54                	je     801df8 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801da4:	83 ec 08             	sub    $0x8,%esp
+  801da7:	ff 75 0c             	push   0xc(%ebp)
+  801daa:	56                   	push   %esi
+  801dab:	ff d0                	call   *%eax
+  801dad:	83 c4 10             	add    $0x10,%esp
+}
+  801db0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db3:	5b                   	pop    %ebx
+  801db4:	5e                   	pop    %esi
+  801db5:	5d                   	pop    %ebp
+  801db6:	c3                   	ret
+  801db7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801db9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801dbe:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dc4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801dc9:	76 1c                	jbe    801de7 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801dcb:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dce:	83 ec 04             	sub    $0x4,%esp
+  801dd1:	53                   	push   %ebx
+  801dd2:	50                   	push   %eax
+  801dd3:	68 f8 31 80 00       	push   $0x8031f8
+  801dd8:	e8 11 e5 ff ff       	call   8002ee <cprintf>
+		return -E_INVAL;
+  801ddd:	83 c4 10             	add    $0x10,%esp
+  801de0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de5:	eb c9                	jmp    801db0 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801de7:	c1 e8 10             	shr    $0x10,%eax
+  801dea:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801df0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801df6:	eb d3                	jmp    801dcb <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801df8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dfd:	eb b1                	jmp    801db0 <ftruncate+0x50>
+
+00801dff <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dff:	55                   	push   %ebp
+  801e00:	89 e5                	mov    %esp,%ebp
+  801e02:	56                   	push   %esi
+  801e03:	53                   	push   %ebx
+  801e04:	83 ec 18             	sub    $0x18,%esp
+  801e07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e0a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e0d:	50                   	push   %eax
+  801e0e:	ff 75 08             	push   0x8(%ebp)
+  801e11:	e8 0b fb ff ff       	call   801921 <fd_lookup>
+  801e16:	83 c4 10             	add    $0x10,%esp
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	78 49                	js     801e66 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e1d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e20:	83 ec 08             	sub    $0x8,%esp
+  801e23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e26:	50                   	push   %eax
+  801e27:	ff 36                	push   (%esi)
+  801e29:	e8 43 fb ff ff       	call   801971 <dev_lookup>
+  801e2e:	83 c4 10             	add    $0x10,%esp
+  801e31:	85 c0                	test   %eax,%eax
+  801e33:	78 31                	js     801e66 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e38:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e3c:	74 2f                	je     801e6d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e3e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e41:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e48:	00 00 00 
+	stat->st_isdir = 0;
+  801e4b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e52:	00 00 00 
+	stat->st_dev = dev;
+  801e55:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e5b:	83 ec 08             	sub    $0x8,%esp
+  801e5e:	53                   	push   %ebx
+  801e5f:	56                   	push   %esi
+  801e60:	ff 50 14             	call   *0x14(%eax)
+  801e63:	83 c4 10             	add    $0x10,%esp
+}
+  801e66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e69:	5b                   	pop    %ebx
+  801e6a:	5e                   	pop    %esi
+  801e6b:	5d                   	pop    %ebp
+  801e6c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e6d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e72:	eb f2                	jmp    801e66 <fstat+0x67>
+
+00801e74 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e74:	55                   	push   %ebp
+  801e75:	89 e5                	mov    %esp,%ebp
+  801e77:	56                   	push   %esi
+  801e78:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e79:	83 ec 08             	sub    $0x8,%esp
+  801e7c:	6a 00                	push   $0x0
+  801e7e:	ff 75 08             	push   0x8(%ebp)
+  801e81:	e8 e4 01 00 00       	call   80206a <open>
+  801e86:	89 c3                	mov    %eax,%ebx
+  801e88:	83 c4 10             	add    $0x10,%esp
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	78 1b                	js     801eaa <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e8f:	83 ec 08             	sub    $0x8,%esp
+  801e92:	ff 75 0c             	push   0xc(%ebp)
+  801e95:	50                   	push   %eax
+  801e96:	e8 64 ff ff ff       	call   801dff <fstat>
+  801e9b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e9d:	89 1c 24             	mov    %ebx,(%esp)
+  801ea0:	e8 c6 fb ff ff       	call   801a6b <close>
+	return r;
+  801ea5:	83 c4 10             	add    $0x10,%esp
+  801ea8:	89 f3                	mov    %esi,%ebx
+}
+  801eaa:	89 d8                	mov    %ebx,%eax
+  801eac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eaf:	5b                   	pop    %ebx
+  801eb0:	5e                   	pop    %esi
+  801eb1:	5d                   	pop    %ebp
+  801eb2:	c3                   	ret
+
+00801eb3 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801eb3:	55                   	push   %ebp
+  801eb4:	89 e5                	mov    %esp,%ebp
+  801eb6:	56                   	push   %esi
+  801eb7:	53                   	push   %ebx
+  801eb8:	89 c6                	mov    %eax,%esi
+  801eba:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ebc:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801ec3:	74 27                	je     801eec <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ec5:	6a 07                	push   $0x7
+  801ec7:	68 00 60 80 00       	push   $0x806000
+  801ecc:	56                   	push   %esi
+  801ecd:	ff 35 00 50 80 00    	push   0x805000
+  801ed3:	e8 f6 0d 00 00       	call   802cce <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801ed8:	83 c4 0c             	add    $0xc,%esp
+  801edb:	6a 00                	push   $0x0
+  801edd:	53                   	push   %ebx
+  801ede:	6a 00                	push   $0x0
+  801ee0:	e8 d1 0d 00 00       	call   802cb6 <ipc_recv>
+}
+  801ee5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee8:	5b                   	pop    %ebx
+  801ee9:	5e                   	pop    %esi
+  801eea:	5d                   	pop    %ebp
+  801eeb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801eec:	83 ec 0c             	sub    $0xc,%esp
+  801eef:	6a 01                	push   $0x1
+  801ef1:	e8 2c 0e 00 00       	call   802d22 <ipc_find_env>
+  801ef6:	a3 00 50 80 00       	mov    %eax,0x805000
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	eb c5                	jmp    801ec5 <fsipc+0x12>
+
+00801f00 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f00:	55                   	push   %ebp
+  801f01:	89 e5                	mov    %esp,%ebp
+  801f03:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f09:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f0c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801f11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f14:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f23:	e8 8b ff ff ff       	call   801eb3 <fsipc>
+}
+  801f28:	c9                   	leave
+  801f29:	c3                   	ret
+
+00801f2a <devfile_flush>:
+{
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f33:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f36:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f40:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f45:	e8 69 ff ff ff       	call   801eb3 <fsipc>
+}
+  801f4a:	c9                   	leave
+  801f4b:	c3                   	ret
+
+00801f4c <devfile_stat>:
+{
+  801f4c:	55                   	push   %ebp
+  801f4d:	89 e5                	mov    %esp,%ebp
+  801f4f:	53                   	push   %ebx
+  801f50:	83 ec 04             	sub    $0x4,%esp
+  801f53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f59:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f5c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f66:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f6b:	e8 43 ff ff ff       	call   801eb3 <fsipc>
+  801f70:	85 c0                	test   %eax,%eax
+  801f72:	78 2c                	js     801fa0 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f74:	83 ec 08             	sub    $0x8,%esp
+  801f77:	68 00 60 80 00       	push   $0x806000
+  801f7c:	53                   	push   %ebx
+  801f7d:	e8 b4 e9 ff ff       	call   800936 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f82:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f87:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f8d:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f92:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fa0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fa3:	c9                   	leave
+  801fa4:	c3                   	ret
+
+00801fa5 <devfile_write>:
+{
+  801fa5:	55                   	push   %ebp
+  801fa6:	89 e5                	mov    %esp,%ebp
+  801fa8:	83 ec 0c             	sub    $0xc,%esp
+  801fab:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fae:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fb1:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fb4:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801fba:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801fbf:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fc4:	39 d0                	cmp    %edx,%eax
+  801fc6:	0f 47 c2             	cmova  %edx,%eax
+  801fc9:	50                   	push   %eax
+  801fca:	ff 75 0c             	push   0xc(%ebp)
+  801fcd:	68 08 60 80 00       	push   $0x806008
+  801fd2:	e8 e5 ea ff ff       	call   800abc <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801fd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fe1:	e8 cd fe ff ff       	call   801eb3 <fsipc>
+}
+  801fe6:	c9                   	leave
+  801fe7:	c3                   	ret
+
+00801fe8 <devfile_read>:
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	56                   	push   %esi
+  801fec:	53                   	push   %ebx
+  801fed:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ff0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ff6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801ffb:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802001:	ba 00 00 00 00       	mov    $0x0,%edx
+  802006:	b8 03 00 00 00       	mov    $0x3,%eax
+  80200b:	e8 a3 fe ff ff       	call   801eb3 <fsipc>
+  802010:	89 c3                	mov    %eax,%ebx
+  802012:	85 c0                	test   %eax,%eax
+  802014:	78 1f                	js     802035 <devfile_read+0x4d>
+	assert(r <= n);
+  802016:	39 c6                	cmp    %eax,%esi
+  802018:	72 24                	jb     80203e <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80201a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80201f:	7f 33                	jg     802054 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802021:	83 ec 04             	sub    $0x4,%esp
+  802024:	50                   	push   %eax
+  802025:	68 00 60 80 00       	push   $0x806000
+  80202a:	ff 75 0c             	push   0xc(%ebp)
+  80202d:	e8 8a ea ff ff       	call   800abc <memmove>
+	return r;
+  802032:	83 c4 10             	add    $0x10,%esp
+}
+  802035:	89 d8                	mov    %ebx,%eax
+  802037:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203a:	5b                   	pop    %ebx
+  80203b:	5e                   	pop    %esi
+  80203c:	5d                   	pop    %ebp
+  80203d:	c3                   	ret
+	assert(r <= n);
+  80203e:	68 68 32 80 00       	push   $0x803268
+  802043:	68 6f 32 80 00       	push   $0x80326f
+  802048:	6a 76                	push   $0x76
+  80204a:	68 84 32 80 00       	push   $0x803284
+  80204f:	e8 bf e1 ff ff       	call   800213 <_panic>
+	assert(r <= PGSIZE);
+  802054:	68 8f 32 80 00       	push   $0x80328f
+  802059:	68 6f 32 80 00       	push   $0x80326f
+  80205e:	6a 77                	push   $0x77
+  802060:	68 84 32 80 00       	push   $0x803284
+  802065:	e8 a9 e1 ff ff       	call   800213 <_panic>
+
+0080206a <open>:
+{
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	56                   	push   %esi
+  80206e:	53                   	push   %ebx
+  80206f:	83 ec 1c             	sub    $0x1c,%esp
+  802072:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802075:	56                   	push   %esi
+  802076:	e8 80 e8 ff ff       	call   8008fb <strlen>
+  80207b:	83 c4 10             	add    $0x10,%esp
+  80207e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802083:	7f 6c                	jg     8020f1 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802085:	83 ec 0c             	sub    $0xc,%esp
+  802088:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80208b:	50                   	push   %eax
+  80208c:	e8 3a f8 ff ff       	call   8018cb <fd_alloc>
+  802091:	89 c3                	mov    %eax,%ebx
+  802093:	83 c4 10             	add    $0x10,%esp
+  802096:	85 c0                	test   %eax,%eax
+  802098:	78 3c                	js     8020d6 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80209a:	83 ec 08             	sub    $0x8,%esp
+  80209d:	56                   	push   %esi
+  80209e:	68 00 60 80 00       	push   $0x806000
+  8020a3:	e8 8e e8 ff ff       	call   800936 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8020a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ab:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020b0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020b8:	e8 f6 fd ff ff       	call   801eb3 <fsipc>
+  8020bd:	89 c3                	mov    %eax,%ebx
+  8020bf:	83 c4 10             	add    $0x10,%esp
+  8020c2:	85 c0                	test   %eax,%eax
+  8020c4:	78 19                	js     8020df <open+0x75>
+	return fd2num(fd);
+  8020c6:	83 ec 0c             	sub    $0xc,%esp
+  8020c9:	ff 75 f4             	push   -0xc(%ebp)
+  8020cc:	e8 d3 f7 ff ff       	call   8018a4 <fd2num>
+  8020d1:	89 c3                	mov    %eax,%ebx
+  8020d3:	83 c4 10             	add    $0x10,%esp
+}
+  8020d6:	89 d8                	mov    %ebx,%eax
+  8020d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020db:	5b                   	pop    %ebx
+  8020dc:	5e                   	pop    %esi
+  8020dd:	5d                   	pop    %ebp
+  8020de:	c3                   	ret
+		fd_close(fd, 0);
+  8020df:	83 ec 08             	sub    $0x8,%esp
+  8020e2:	6a 00                	push   $0x0
+  8020e4:	ff 75 f4             	push   -0xc(%ebp)
+  8020e7:	e8 f8 f8 ff ff       	call   8019e4 <fd_close>
+		return r;
+  8020ec:	83 c4 10             	add    $0x10,%esp
+  8020ef:	eb e5                	jmp    8020d6 <open+0x6c>
+		return -E_BAD_PATH;
+  8020f1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020f6:	eb de                	jmp    8020d6 <open+0x6c>
+
+008020f8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020f8:	55                   	push   %ebp
+  8020f9:	89 e5                	mov    %esp,%ebp
+  8020fb:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802103:	b8 08 00 00 00       	mov    $0x8,%eax
+  802108:	e8 a6 fd ff ff       	call   801eb3 <fsipc>
+}
+  80210d:	c9                   	leave
+  80210e:	c3                   	ret
+
+0080210f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802115:	68 9b 32 80 00       	push   $0x80329b
+  80211a:	ff 75 0c             	push   0xc(%ebp)
+  80211d:	e8 14 e8 ff ff       	call   800936 <strcpy>
+	return 0;
+}
+  802122:	b8 00 00 00 00       	mov    $0x0,%eax
+  802127:	c9                   	leave
+  802128:	c3                   	ret
+
+00802129 <devsock_close>:
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	53                   	push   %ebx
+  80212d:	83 ec 10             	sub    $0x10,%esp
+  802130:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802133:	53                   	push   %ebx
+  802134:	e8 28 0c 00 00       	call   802d61 <pageref>
+  802139:	89 c2                	mov    %eax,%edx
+  80213b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80213e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802143:	83 fa 01             	cmp    $0x1,%edx
+  802146:	74 05                	je     80214d <devsock_close+0x24>
+}
+  802148:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214b:	c9                   	leave
+  80214c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80214d:	83 ec 0c             	sub    $0xc,%esp
+  802150:	ff 73 0c             	push   0xc(%ebx)
+  802153:	e8 b7 02 00 00       	call   80240f <nsipc_close>
+  802158:	83 c4 10             	add    $0x10,%esp
+  80215b:	eb eb                	jmp    802148 <devsock_close+0x1f>
+
+0080215d <devsock_write>:
+{
+  80215d:	55                   	push   %ebp
+  80215e:	89 e5                	mov    %esp,%ebp
+  802160:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802163:	6a 00                	push   $0x0
+  802165:	ff 75 10             	push   0x10(%ebp)
+  802168:	ff 75 0c             	push   0xc(%ebp)
+  80216b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216e:	ff 70 0c             	push   0xc(%eax)
+  802171:	e8 79 03 00 00       	call   8024ef <nsipc_send>
+}
+  802176:	c9                   	leave
+  802177:	c3                   	ret
+
+00802178 <devsock_read>:
+{
+  802178:	55                   	push   %ebp
+  802179:	89 e5                	mov    %esp,%ebp
+  80217b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80217e:	6a 00                	push   $0x0
+  802180:	ff 75 10             	push   0x10(%ebp)
+  802183:	ff 75 0c             	push   0xc(%ebp)
+  802186:	8b 45 08             	mov    0x8(%ebp),%eax
+  802189:	ff 70 0c             	push   0xc(%eax)
+  80218c:	e8 ef 02 00 00       	call   802480 <nsipc_recv>
+}
+  802191:	c9                   	leave
+  802192:	c3                   	ret
+
+00802193 <fd2sockid>:
+{
+  802193:	55                   	push   %ebp
+  802194:	89 e5                	mov    %esp,%ebp
+  802196:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802199:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80219c:	52                   	push   %edx
+  80219d:	50                   	push   %eax
+  80219e:	e8 7e f7 ff ff       	call   801921 <fd_lookup>
+  8021a3:	83 c4 10             	add    $0x10,%esp
+  8021a6:	85 c0                	test   %eax,%eax
+  8021a8:	78 10                	js     8021ba <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8021aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ad:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8021b3:	39 08                	cmp    %ecx,(%eax)
+  8021b5:	75 05                	jne    8021bc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8021b7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8021ba:	c9                   	leave
+  8021bb:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021bc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021c1:	eb f7                	jmp    8021ba <fd2sockid+0x27>
+
+008021c3 <alloc_sockfd>:
+{
+  8021c3:	55                   	push   %ebp
+  8021c4:	89 e5                	mov    %esp,%ebp
+  8021c6:	56                   	push   %esi
+  8021c7:	53                   	push   %ebx
+  8021c8:	83 ec 1c             	sub    $0x1c,%esp
+  8021cb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8021cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d0:	50                   	push   %eax
+  8021d1:	e8 f5 f6 ff ff       	call   8018cb <fd_alloc>
+  8021d6:	89 c3                	mov    %eax,%ebx
+  8021d8:	83 c4 10             	add    $0x10,%esp
+  8021db:	85 c0                	test   %eax,%eax
+  8021dd:	78 43                	js     802222 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8021df:	83 ec 04             	sub    $0x4,%esp
+  8021e2:	68 07 04 00 00       	push   $0x407
+  8021e7:	ff 75 f4             	push   -0xc(%ebp)
+  8021ea:	6a 00                	push   $0x0
+  8021ec:	e8 3d ec ff ff       	call   800e2e <sys_page_alloc>
+  8021f1:	89 c3                	mov    %eax,%ebx
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	85 c0                	test   %eax,%eax
+  8021f8:	78 28                	js     802222 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8021fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fd:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802203:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802205:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802208:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80220f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802212:	83 ec 0c             	sub    $0xc,%esp
+  802215:	50                   	push   %eax
+  802216:	e8 89 f6 ff ff       	call   8018a4 <fd2num>
+  80221b:	89 c3                	mov    %eax,%ebx
+  80221d:	83 c4 10             	add    $0x10,%esp
+  802220:	eb 0c                	jmp    80222e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802222:	83 ec 0c             	sub    $0xc,%esp
+  802225:	56                   	push   %esi
+  802226:	e8 e4 01 00 00       	call   80240f <nsipc_close>
+		return r;
+  80222b:	83 c4 10             	add    $0x10,%esp
+}
+  80222e:	89 d8                	mov    %ebx,%eax
+  802230:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802233:	5b                   	pop    %ebx
+  802234:	5e                   	pop    %esi
+  802235:	5d                   	pop    %ebp
+  802236:	c3                   	ret
+
+00802237 <accept>:
+{
+  802237:	55                   	push   %ebp
+  802238:	89 e5                	mov    %esp,%ebp
+  80223a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80223d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802240:	e8 4e ff ff ff       	call   802193 <fd2sockid>
+  802245:	85 c0                	test   %eax,%eax
+  802247:	78 1b                	js     802264 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802249:	83 ec 04             	sub    $0x4,%esp
+  80224c:	ff 75 10             	push   0x10(%ebp)
+  80224f:	ff 75 0c             	push   0xc(%ebp)
+  802252:	50                   	push   %eax
+  802253:	e8 0e 01 00 00       	call   802366 <nsipc_accept>
+  802258:	83 c4 10             	add    $0x10,%esp
+  80225b:	85 c0                	test   %eax,%eax
+  80225d:	78 05                	js     802264 <accept+0x2d>
+	return alloc_sockfd(r);
+  80225f:	e8 5f ff ff ff       	call   8021c3 <alloc_sockfd>
+}
+  802264:	c9                   	leave
+  802265:	c3                   	ret
+
+00802266 <bind>:
+{
+  802266:	55                   	push   %ebp
+  802267:	89 e5                	mov    %esp,%ebp
+  802269:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80226c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80226f:	e8 1f ff ff ff       	call   802193 <fd2sockid>
+  802274:	85 c0                	test   %eax,%eax
+  802276:	78 12                	js     80228a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802278:	83 ec 04             	sub    $0x4,%esp
+  80227b:	ff 75 10             	push   0x10(%ebp)
+  80227e:	ff 75 0c             	push   0xc(%ebp)
+  802281:	50                   	push   %eax
+  802282:	e8 31 01 00 00       	call   8023b8 <nsipc_bind>
+  802287:	83 c4 10             	add    $0x10,%esp
+}
+  80228a:	c9                   	leave
+  80228b:	c3                   	ret
+
+0080228c <shutdown>:
+{
+  80228c:	55                   	push   %ebp
+  80228d:	89 e5                	mov    %esp,%ebp
+  80228f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802292:	8b 45 08             	mov    0x8(%ebp),%eax
+  802295:	e8 f9 fe ff ff       	call   802193 <fd2sockid>
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 0f                	js     8022ad <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80229e:	83 ec 08             	sub    $0x8,%esp
+  8022a1:	ff 75 0c             	push   0xc(%ebp)
+  8022a4:	50                   	push   %eax
+  8022a5:	e8 43 01 00 00       	call   8023ed <nsipc_shutdown>
+  8022aa:	83 c4 10             	add    $0x10,%esp
+}
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+
+008022af <connect>:
+{
+  8022af:	55                   	push   %ebp
+  8022b0:	89 e5                	mov    %esp,%ebp
+  8022b2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b8:	e8 d6 fe ff ff       	call   802193 <fd2sockid>
+  8022bd:	85 c0                	test   %eax,%eax
+  8022bf:	78 12                	js     8022d3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8022c1:	83 ec 04             	sub    $0x4,%esp
+  8022c4:	ff 75 10             	push   0x10(%ebp)
+  8022c7:	ff 75 0c             	push   0xc(%ebp)
+  8022ca:	50                   	push   %eax
+  8022cb:	e8 59 01 00 00       	call   802429 <nsipc_connect>
+  8022d0:	83 c4 10             	add    $0x10,%esp
+}
+  8022d3:	c9                   	leave
+  8022d4:	c3                   	ret
+
+008022d5 <listen>:
+{
+  8022d5:	55                   	push   %ebp
+  8022d6:	89 e5                	mov    %esp,%ebp
+  8022d8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022de:	e8 b0 fe ff ff       	call   802193 <fd2sockid>
+  8022e3:	85 c0                	test   %eax,%eax
+  8022e5:	78 0f                	js     8022f6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8022e7:	83 ec 08             	sub    $0x8,%esp
+  8022ea:	ff 75 0c             	push   0xc(%ebp)
+  8022ed:	50                   	push   %eax
+  8022ee:	e8 6b 01 00 00       	call   80245e <nsipc_listen>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+}
+  8022f6:	c9                   	leave
+  8022f7:	c3                   	ret
+
+008022f8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8022f8:	55                   	push   %ebp
+  8022f9:	89 e5                	mov    %esp,%ebp
+  8022fb:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8022fe:	ff 75 10             	push   0x10(%ebp)
+  802301:	ff 75 0c             	push   0xc(%ebp)
+  802304:	ff 75 08             	push   0x8(%ebp)
+  802307:	e8 41 02 00 00       	call   80254d <nsipc_socket>
+  80230c:	83 c4 10             	add    $0x10,%esp
+  80230f:	85 c0                	test   %eax,%eax
+  802311:	78 05                	js     802318 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802313:	e8 ab fe ff ff       	call   8021c3 <alloc_sockfd>
+}
+  802318:	c9                   	leave
+  802319:	c3                   	ret
+
+0080231a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80231a:	55                   	push   %ebp
+  80231b:	89 e5                	mov    %esp,%ebp
+  80231d:	53                   	push   %ebx
+  80231e:	83 ec 04             	sub    $0x4,%esp
+  802321:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802323:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  80232a:	74 26                	je     802352 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80232c:	6a 07                	push   $0x7
+  80232e:	68 00 70 80 00       	push   $0x807000
+  802333:	53                   	push   %ebx
+  802334:	ff 35 04 50 80 00    	push   0x805004
+  80233a:	e8 8f 09 00 00       	call   802cce <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80233f:	83 c4 0c             	add    $0xc,%esp
+  802342:	6a 00                	push   $0x0
+  802344:	6a 00                	push   $0x0
+  802346:	6a 00                	push   $0x0
+  802348:	e8 69 09 00 00       	call   802cb6 <ipc_recv>
+}
+  80234d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802350:	c9                   	leave
+  802351:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802352:	83 ec 0c             	sub    $0xc,%esp
+  802355:	6a 02                	push   $0x2
+  802357:	e8 c6 09 00 00       	call   802d22 <ipc_find_env>
+  80235c:	a3 04 50 80 00       	mov    %eax,0x805004
+  802361:	83 c4 10             	add    $0x10,%esp
+  802364:	eb c6                	jmp    80232c <nsipc+0x12>
+
+00802366 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802366:	55                   	push   %ebp
+  802367:	89 e5                	mov    %esp,%ebp
+  802369:	56                   	push   %esi
+  80236a:	53                   	push   %ebx
+  80236b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80236e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802371:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802376:	8b 06                	mov    (%esi),%eax
+  802378:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80237d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802382:	e8 93 ff ff ff       	call   80231a <nsipc>
+  802387:	89 c3                	mov    %eax,%ebx
+  802389:	85 c0                	test   %eax,%eax
+  80238b:	79 09                	jns    802396 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80238d:	89 d8                	mov    %ebx,%eax
+  80238f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802392:	5b                   	pop    %ebx
+  802393:	5e                   	pop    %esi
+  802394:	5d                   	pop    %ebp
+  802395:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802396:	83 ec 04             	sub    $0x4,%esp
+  802399:	ff 35 10 70 80 00    	push   0x807010
+  80239f:	68 00 70 80 00       	push   $0x807000
+  8023a4:	ff 75 0c             	push   0xc(%ebp)
+  8023a7:	e8 10 e7 ff ff       	call   800abc <memmove>
+		*addrlen = ret->ret_addrlen;
+  8023ac:	a1 10 70 80 00       	mov    0x807010,%eax
+  8023b1:	89 06                	mov    %eax,(%esi)
+  8023b3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8023b6:	eb d5                	jmp    80238d <nsipc_accept+0x27>
+
+008023b8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8023b8:	55                   	push   %ebp
+  8023b9:	89 e5                	mov    %esp,%ebp
+  8023bb:	53                   	push   %ebx
+  8023bc:	83 ec 08             	sub    $0x8,%esp
+  8023bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8023c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c5:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8023ca:	53                   	push   %ebx
+  8023cb:	ff 75 0c             	push   0xc(%ebp)
+  8023ce:	68 04 70 80 00       	push   $0x807004
+  8023d3:	e8 e4 e6 ff ff       	call   800abc <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8023d8:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8023de:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023e3:	e8 32 ff ff ff       	call   80231a <nsipc>
+}
+  8023e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023eb:	c9                   	leave
+  8023ec:	c3                   	ret
+
+008023ed <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8023ed:	55                   	push   %ebp
+  8023ee:	89 e5                	mov    %esp,%ebp
+  8023f0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8023f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023f6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8023fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023fe:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802403:	b8 03 00 00 00       	mov    $0x3,%eax
+  802408:	e8 0d ff ff ff       	call   80231a <nsipc>
+}
+  80240d:	c9                   	leave
+  80240e:	c3                   	ret
+
+0080240f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80240f:	55                   	push   %ebp
+  802410:	89 e5                	mov    %esp,%ebp
+  802412:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802415:	8b 45 08             	mov    0x8(%ebp),%eax
+  802418:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80241d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802422:	e8 f3 fe ff ff       	call   80231a <nsipc>
+}
+  802427:	c9                   	leave
+  802428:	c3                   	ret
+
+00802429 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802429:	55                   	push   %ebp
+  80242a:	89 e5                	mov    %esp,%ebp
+  80242c:	53                   	push   %ebx
+  80242d:	83 ec 08             	sub    $0x8,%esp
+  802430:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802433:	8b 45 08             	mov    0x8(%ebp),%eax
+  802436:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80243b:	53                   	push   %ebx
+  80243c:	ff 75 0c             	push   0xc(%ebp)
+  80243f:	68 04 70 80 00       	push   $0x807004
+  802444:	e8 73 e6 ff ff       	call   800abc <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802449:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80244f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802454:	e8 c1 fe ff ff       	call   80231a <nsipc>
+}
+  802459:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80245c:	c9                   	leave
+  80245d:	c3                   	ret
+
+0080245e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80245e:	55                   	push   %ebp
+  80245f:	89 e5                	mov    %esp,%ebp
+  802461:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802464:	8b 45 08             	mov    0x8(%ebp),%eax
+  802467:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80246c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80246f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802474:	b8 06 00 00 00       	mov    $0x6,%eax
+  802479:	e8 9c fe ff ff       	call   80231a <nsipc>
+}
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+
+00802480 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802480:	55                   	push   %ebp
+  802481:	89 e5                	mov    %esp,%ebp
+  802483:	56                   	push   %esi
+  802484:	53                   	push   %ebx
+  802485:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802488:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802490:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802496:	8b 45 14             	mov    0x14(%ebp),%eax
+  802499:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80249e:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024a3:	e8 72 fe ff ff       	call   80231a <nsipc>
+  8024a8:	89 c3                	mov    %eax,%ebx
+  8024aa:	85 c0                	test   %eax,%eax
+  8024ac:	78 22                	js     8024d0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8024ae:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8024b3:	39 c6                	cmp    %eax,%esi
+  8024b5:	0f 4e c6             	cmovle %esi,%eax
+  8024b8:	39 c3                	cmp    %eax,%ebx
+  8024ba:	7f 1d                	jg     8024d9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8024bc:	83 ec 04             	sub    $0x4,%esp
+  8024bf:	53                   	push   %ebx
+  8024c0:	68 00 70 80 00       	push   $0x807000
+  8024c5:	ff 75 0c             	push   0xc(%ebp)
+  8024c8:	e8 ef e5 ff ff       	call   800abc <memmove>
+  8024cd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8024d0:	89 d8                	mov    %ebx,%eax
+  8024d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d5:	5b                   	pop    %ebx
+  8024d6:	5e                   	pop    %esi
+  8024d7:	5d                   	pop    %ebp
+  8024d8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8024d9:	68 a7 32 80 00       	push   $0x8032a7
+  8024de:	68 6f 32 80 00       	push   $0x80326f
+  8024e3:	6a 62                	push   $0x62
+  8024e5:	68 bc 32 80 00       	push   $0x8032bc
+  8024ea:	e8 24 dd ff ff       	call   800213 <_panic>
+
+008024ef <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8024ef:	55                   	push   %ebp
+  8024f0:	89 e5                	mov    %esp,%ebp
+  8024f2:	53                   	push   %ebx
+  8024f3:	83 ec 04             	sub    $0x4,%esp
+  8024f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8024f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024fc:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802501:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802507:	7f 2e                	jg     802537 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802509:	83 ec 04             	sub    $0x4,%esp
+  80250c:	53                   	push   %ebx
+  80250d:	ff 75 0c             	push   0xc(%ebp)
+  802510:	68 0c 70 80 00       	push   $0x80700c
+  802515:	e8 a2 e5 ff ff       	call   800abc <memmove>
+	nsipcbuf.send.req_size = size;
+  80251a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802520:	8b 45 14             	mov    0x14(%ebp),%eax
+  802523:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802528:	b8 08 00 00 00       	mov    $0x8,%eax
+  80252d:	e8 e8 fd ff ff       	call   80231a <nsipc>
+}
+  802532:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802535:	c9                   	leave
+  802536:	c3                   	ret
+	assert(size < 1600);
+  802537:	68 c8 32 80 00       	push   $0x8032c8
+  80253c:	68 6f 32 80 00       	push   $0x80326f
+  802541:	6a 6d                	push   $0x6d
+  802543:	68 bc 32 80 00       	push   $0x8032bc
+  802548:	e8 c6 dc ff ff       	call   800213 <_panic>
+
+0080254d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80254d:	55                   	push   %ebp
+  80254e:	89 e5                	mov    %esp,%ebp
+  802550:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802553:	8b 45 08             	mov    0x8(%ebp),%eax
+  802556:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80255b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80255e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802563:	8b 45 10             	mov    0x10(%ebp),%eax
+  802566:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80256b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802570:	e8 a5 fd ff ff       	call   80231a <nsipc>
+}
+  802575:	c9                   	leave
+  802576:	c3                   	ret
+
+00802577 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802577:	55                   	push   %ebp
+  802578:	89 e5                	mov    %esp,%ebp
+  80257a:	56                   	push   %esi
+  80257b:	53                   	push   %ebx
+  80257c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80257f:	83 ec 0c             	sub    $0xc,%esp
+  802582:	ff 75 08             	push   0x8(%ebp)
+  802585:	e8 2a f3 ff ff       	call   8018b4 <fd2data>
+  80258a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80258c:	83 c4 08             	add    $0x8,%esp
+  80258f:	68 d4 32 80 00       	push   $0x8032d4
+  802594:	53                   	push   %ebx
+  802595:	e8 9c e3 ff ff       	call   800936 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80259a:	8b 46 04             	mov    0x4(%esi),%eax
+  80259d:	2b 06                	sub    (%esi),%eax
+  80259f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8025a5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025ac:	00 00 00 
+	stat->st_dev = &devpipe;
+  8025af:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8025b6:	40 80 00 
+	return 0;
+}
+  8025b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c1:	5b                   	pop    %ebx
+  8025c2:	5e                   	pop    %esi
+  8025c3:	5d                   	pop    %ebp
+  8025c4:	c3                   	ret
+
+008025c5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8025c5:	55                   	push   %ebp
+  8025c6:	89 e5                	mov    %esp,%ebp
+  8025c8:	53                   	push   %ebx
+  8025c9:	83 ec 0c             	sub    $0xc,%esp
+  8025cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8025cf:	53                   	push   %ebx
+  8025d0:	6a 00                	push   $0x0
+  8025d2:	e8 32 e9 ff ff       	call   800f09 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8025d7:	89 1c 24             	mov    %ebx,(%esp)
+  8025da:	e8 d5 f2 ff ff       	call   8018b4 <fd2data>
+  8025df:	83 c4 08             	add    $0x8,%esp
+  8025e2:	50                   	push   %eax
+  8025e3:	6a 00                	push   $0x0
+  8025e5:	e8 1f e9 ff ff       	call   800f09 <sys_page_unmap>
+}
+  8025ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ed:	c9                   	leave
+  8025ee:	c3                   	ret
+
+008025ef <_pipeisclosed>:
+{
+  8025ef:	55                   	push   %ebp
+  8025f0:	89 e5                	mov    %esp,%ebp
+  8025f2:	57                   	push   %edi
+  8025f3:	56                   	push   %esi
+  8025f4:	53                   	push   %ebx
+  8025f5:	83 ec 1c             	sub    $0x1c,%esp
+  8025f8:	89 c7                	mov    %eax,%edi
+  8025fa:	89 d6                	mov    %edx,%esi
+  8025fc:	eb 3c                	jmp    80263a <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8025fe:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802601:	83 ec 0c             	sub    $0xc,%esp
+  802604:	57                   	push   %edi
+  802605:	e8 57 07 00 00       	call   802d61 <pageref>
+  80260a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80260d:	89 34 24             	mov    %esi,(%esp)
+  802610:	e8 4c 07 00 00       	call   802d61 <pageref>
+  802615:	89 c2                	mov    %eax,%edx
+  802617:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802619:	05 00 00 00 20       	add    $0x20000000,%eax
+  80261e:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802621:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802627:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80262c:	76 31                	jbe    80265f <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  80262e:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802631:	39 c3                	cmp    %eax,%ebx
+  802633:	74 76                	je     8026ab <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802635:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802638:	74 36                	je     802670 <_pipeisclosed+0x81>
+  80263a:	89 e0                	mov    %esp,%eax
+  80263c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802641:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802647:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80264c:	77 b0                	ja     8025fe <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80264e:	c1 e8 10             	shr    $0x10,%eax
+  802651:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802657:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80265d:	eb 9f                	jmp    8025fe <_pipeisclosed+0xf>
+  80265f:	c1 e8 10             	shr    $0x10,%eax
+  802662:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802668:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80266e:	eb be                	jmp    80262e <_pipeisclosed+0x3f>
+  802670:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802672:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802677:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80267d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802682:	76 16                	jbe    80269a <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802684:	8b 42 58             	mov    0x58(%edx),%eax
+  802687:	6a 01                	push   $0x1
+  802689:	50                   	push   %eax
+  80268a:	53                   	push   %ebx
+  80268b:	68 db 32 80 00       	push   $0x8032db
+  802690:	e8 59 dc ff ff       	call   8002ee <cprintf>
+  802695:	83 c4 10             	add    $0x10,%esp
+  802698:	eb a0                	jmp    80263a <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80269a:	c1 e8 10             	shr    $0x10,%eax
+  80269d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026a3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8026a9:	eb d9                	jmp    802684 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8026ab:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8026ae:	0f 94 c0             	sete   %al
+  8026b1:	0f b6 c0             	movzbl %al,%eax
+}
+  8026b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b7:	5b                   	pop    %ebx
+  8026b8:	5e                   	pop    %esi
+  8026b9:	5f                   	pop    %edi
+  8026ba:	5d                   	pop    %ebp
+  8026bb:	c3                   	ret
+
+008026bc <devpipe_write>:
+{
+  8026bc:	55                   	push   %ebp
+  8026bd:	89 e5                	mov    %esp,%ebp
+  8026bf:	57                   	push   %edi
+  8026c0:	56                   	push   %esi
+  8026c1:	53                   	push   %ebx
+  8026c2:	83 ec 28             	sub    $0x28,%esp
+  8026c5:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8026c8:	56                   	push   %esi
+  8026c9:	e8 e6 f1 ff ff       	call   8018b4 <fd2data>
+  8026ce:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8026d0:	83 c4 10             	add    $0x10,%esp
+  8026d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8026db:	75 09                	jne    8026e6 <devpipe_write+0x2a>
+	return i;
+  8026dd:	89 f8                	mov    %edi,%eax
+  8026df:	eb 23                	jmp    802704 <devpipe_write+0x48>
+			sys_yield();
+  8026e1:	e8 02 e7 ff ff       	call   800de8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8026e6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026e9:	8b 0b                	mov    (%ebx),%ecx
+  8026eb:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026ee:	39 d0                	cmp    %edx,%eax
+  8026f0:	72 1a                	jb     80270c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8026f2:	89 da                	mov    %ebx,%edx
+  8026f4:	89 f0                	mov    %esi,%eax
+  8026f6:	e8 f4 fe ff ff       	call   8025ef <_pipeisclosed>
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	74 e2                	je     8026e1 <devpipe_write+0x25>
+				return 0;
+  8026ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802704:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802707:	5b                   	pop    %ebx
+  802708:	5e                   	pop    %esi
+  802709:	5f                   	pop    %edi
+  80270a:	5d                   	pop    %ebp
+  80270b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80270c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80270f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802713:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802716:	89 c2                	mov    %eax,%edx
+  802718:	c1 fa 1f             	sar    $0x1f,%edx
+  80271b:	89 d1                	mov    %edx,%ecx
+  80271d:	c1 e9 1b             	shr    $0x1b,%ecx
+  802720:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802723:	83 e2 1f             	and    $0x1f,%edx
+  802726:	29 ca                	sub    %ecx,%edx
+  802728:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80272c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802730:	83 c0 01             	add    $0x1,%eax
+  802733:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802736:	83 c7 01             	add    $0x1,%edi
+  802739:	eb 9d                	jmp    8026d8 <devpipe_write+0x1c>
+
+0080273b <devpipe_read>:
+{
+  80273b:	55                   	push   %ebp
+  80273c:	89 e5                	mov    %esp,%ebp
+  80273e:	57                   	push   %edi
+  80273f:	56                   	push   %esi
+  802740:	53                   	push   %ebx
+  802741:	83 ec 18             	sub    $0x18,%esp
+  802744:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802747:	57                   	push   %edi
+  802748:	e8 67 f1 ff ff       	call   8018b4 <fd2data>
+  80274d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80274f:	83 c4 10             	add    $0x10,%esp
+  802752:	be 00 00 00 00       	mov    $0x0,%esi
+  802757:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80275a:	75 13                	jne    80276f <devpipe_read+0x34>
+	return i;
+  80275c:	89 f0                	mov    %esi,%eax
+  80275e:	eb 02                	jmp    802762 <devpipe_read+0x27>
+				return i;
+  802760:	89 f0                	mov    %esi,%eax
+}
+  802762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802765:	5b                   	pop    %ebx
+  802766:	5e                   	pop    %esi
+  802767:	5f                   	pop    %edi
+  802768:	5d                   	pop    %ebp
+  802769:	c3                   	ret
+			sys_yield();
+  80276a:	e8 79 e6 ff ff       	call   800de8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80276f:	8b 03                	mov    (%ebx),%eax
+  802771:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802774:	75 18                	jne    80278e <devpipe_read+0x53>
+			if (i > 0)
+  802776:	85 f6                	test   %esi,%esi
+  802778:	75 e6                	jne    802760 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80277a:	89 da                	mov    %ebx,%edx
+  80277c:	89 f8                	mov    %edi,%eax
+  80277e:	e8 6c fe ff ff       	call   8025ef <_pipeisclosed>
+  802783:	85 c0                	test   %eax,%eax
+  802785:	74 e3                	je     80276a <devpipe_read+0x2f>
+				return 0;
+  802787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278c:	eb d4                	jmp    802762 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80278e:	99                   	cltd
+  80278f:	c1 ea 1b             	shr    $0x1b,%edx
+  802792:	01 d0                	add    %edx,%eax
+  802794:	83 e0 1f             	and    $0x1f,%eax
+  802797:	29 d0                	sub    %edx,%eax
+  802799:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80279e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027a1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8027a4:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8027a7:	83 c6 01             	add    $0x1,%esi
+  8027aa:	eb ab                	jmp    802757 <devpipe_read+0x1c>
+
+008027ac <pipe>:
+{
+  8027ac:	55                   	push   %ebp
+  8027ad:	89 e5                	mov    %esp,%ebp
+  8027af:	56                   	push   %esi
+  8027b0:	53                   	push   %ebx
+  8027b1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8027b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027b7:	50                   	push   %eax
+  8027b8:	e8 0e f1 ff ff       	call   8018cb <fd_alloc>
+  8027bd:	89 c3                	mov    %eax,%ebx
+  8027bf:	83 c4 10             	add    $0x10,%esp
+  8027c2:	85 c0                	test   %eax,%eax
+  8027c4:	0f 88 23 01 00 00    	js     8028ed <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027ca:	83 ec 04             	sub    $0x4,%esp
+  8027cd:	68 07 04 00 00       	push   $0x407
+  8027d2:	ff 75 f4             	push   -0xc(%ebp)
+  8027d5:	6a 00                	push   $0x0
+  8027d7:	e8 52 e6 ff ff       	call   800e2e <sys_page_alloc>
+  8027dc:	89 c3                	mov    %eax,%ebx
+  8027de:	83 c4 10             	add    $0x10,%esp
+  8027e1:	85 c0                	test   %eax,%eax
+  8027e3:	0f 88 04 01 00 00    	js     8028ed <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8027e9:	83 ec 0c             	sub    $0xc,%esp
+  8027ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027ef:	50                   	push   %eax
+  8027f0:	e8 d6 f0 ff ff       	call   8018cb <fd_alloc>
+  8027f5:	89 c3                	mov    %eax,%ebx
+  8027f7:	83 c4 10             	add    $0x10,%esp
+  8027fa:	85 c0                	test   %eax,%eax
+  8027fc:	0f 88 db 00 00 00    	js     8028dd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802802:	83 ec 04             	sub    $0x4,%esp
+  802805:	68 07 04 00 00       	push   $0x407
+  80280a:	ff 75 f0             	push   -0x10(%ebp)
+  80280d:	6a 00                	push   $0x0
+  80280f:	e8 1a e6 ff ff       	call   800e2e <sys_page_alloc>
+  802814:	89 c3                	mov    %eax,%ebx
+  802816:	83 c4 10             	add    $0x10,%esp
+  802819:	85 c0                	test   %eax,%eax
+  80281b:	0f 88 bc 00 00 00    	js     8028dd <pipe+0x131>
+	va = fd2data(fd0);
+  802821:	83 ec 0c             	sub    $0xc,%esp
+  802824:	ff 75 f4             	push   -0xc(%ebp)
+  802827:	e8 88 f0 ff ff       	call   8018b4 <fd2data>
+  80282c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80282e:	83 c4 0c             	add    $0xc,%esp
+  802831:	68 07 04 00 00       	push   $0x407
+  802836:	50                   	push   %eax
+  802837:	6a 00                	push   $0x0
+  802839:	e8 f0 e5 ff ff       	call   800e2e <sys_page_alloc>
+  80283e:	89 c3                	mov    %eax,%ebx
+  802840:	83 c4 10             	add    $0x10,%esp
+  802843:	85 c0                	test   %eax,%eax
+  802845:	0f 88 82 00 00 00    	js     8028cd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80284b:	83 ec 0c             	sub    $0xc,%esp
+  80284e:	ff 75 f0             	push   -0x10(%ebp)
+  802851:	e8 5e f0 ff ff       	call   8018b4 <fd2data>
+  802856:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80285d:	50                   	push   %eax
+  80285e:	6a 00                	push   $0x0
+  802860:	56                   	push   %esi
+  802861:	6a 00                	push   $0x0
+  802863:	e8 33 e6 ff ff       	call   800e9b <sys_page_map>
+  802868:	89 c3                	mov    %eax,%ebx
+  80286a:	83 c4 20             	add    $0x20,%esp
+  80286d:	85 c0                	test   %eax,%eax
+  80286f:	78 4e                	js     8028bf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802871:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802876:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802879:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80287b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80287e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802885:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802888:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80288a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80288d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802894:	83 ec 0c             	sub    $0xc,%esp
+  802897:	ff 75 f4             	push   -0xc(%ebp)
+  80289a:	e8 05 f0 ff ff       	call   8018a4 <fd2num>
+  80289f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028a2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8028a4:	83 c4 04             	add    $0x4,%esp
+  8028a7:	ff 75 f0             	push   -0x10(%ebp)
+  8028aa:	e8 f5 ef ff ff       	call   8018a4 <fd2num>
+  8028af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028b2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8028b5:	83 c4 10             	add    $0x10,%esp
+  8028b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028bd:	eb 2e                	jmp    8028ed <pipe+0x141>
+	sys_page_unmap(0, va);
+  8028bf:	83 ec 08             	sub    $0x8,%esp
+  8028c2:	56                   	push   %esi
+  8028c3:	6a 00                	push   $0x0
+  8028c5:	e8 3f e6 ff ff       	call   800f09 <sys_page_unmap>
+  8028ca:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8028cd:	83 ec 08             	sub    $0x8,%esp
+  8028d0:	ff 75 f0             	push   -0x10(%ebp)
+  8028d3:	6a 00                	push   $0x0
+  8028d5:	e8 2f e6 ff ff       	call   800f09 <sys_page_unmap>
+  8028da:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8028dd:	83 ec 08             	sub    $0x8,%esp
+  8028e0:	ff 75 f4             	push   -0xc(%ebp)
+  8028e3:	6a 00                	push   $0x0
+  8028e5:	e8 1f e6 ff ff       	call   800f09 <sys_page_unmap>
+  8028ea:	83 c4 10             	add    $0x10,%esp
+}
+  8028ed:	89 d8                	mov    %ebx,%eax
+  8028ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028f2:	5b                   	pop    %ebx
+  8028f3:	5e                   	pop    %esi
+  8028f4:	5d                   	pop    %ebp
+  8028f5:	c3                   	ret
+
+008028f6 <pipeisclosed>:
+{
+  8028f6:	55                   	push   %ebp
+  8028f7:	89 e5                	mov    %esp,%ebp
+  8028f9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028ff:	50                   	push   %eax
+  802900:	ff 75 08             	push   0x8(%ebp)
+  802903:	e8 19 f0 ff ff       	call   801921 <fd_lookup>
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	78 18                	js     802927 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80290f:	83 ec 0c             	sub    $0xc,%esp
+  802912:	ff 75 f4             	push   -0xc(%ebp)
+  802915:	e8 9a ef ff ff       	call   8018b4 <fd2data>
+  80291a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80291c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80291f:	e8 cb fc ff ff       	call   8025ef <_pipeisclosed>
+  802924:	83 c4 10             	add    $0x10,%esp
+}
+  802927:	c9                   	leave
+  802928:	c3                   	ret
+
+00802929 <time_nsec>:
+#include <inc/x86.h>
+
+// Nanoseconds since boot.
+uint64_t
+time_nsec(void)
+{
+  802929:	55                   	push   %ebp
+  80292a:	89 e5                	mov    %esp,%ebp
+  80292c:	57                   	push   %edi
+  80292d:	56                   	push   %esi
+  80292e:	53                   	push   %ebx
+  80292f:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ns_mult, timeinfo.ti_ns_shift);
+  802932:	a1 10 f0 ff ee       	mov    0xeefff010,%eax
+  802937:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  80293a:	8b 3d 0c f0 ff ee    	mov    0xeefff00c,%edi
+  802940:	89 7d ec             	mov    %edi,-0x14(%ebp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  802943:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  802945:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  80294b:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  802951:	29 f0                	sub    %esi,%eax
+  802953:	19 fa                	sbb    %edi,%edx
+  802955:	89 c1                	mov    %eax,%ecx
+  802957:	89 d3                	mov    %edx,%ebx
+// libgcc for 64-bit arithmetic.  The low 32 bits of the 96-bit product
+// are dropped before the shift, which costs less than one unit.
+static inline uint64_t
+tsc_scale(uint64_t ticks, uint32_t mult, uint32_t shift)
+{
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  802959:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  80295c:	6b f7 00             	imul   $0x0,%edi,%esi
+  80295f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802962:	89 f8                	mov    %edi,%eax
+  802964:	f7 e1                	mul    %ecx
+  802966:	89 c6                	mov    %eax,%esi
+  802968:	89 d7                	mov    %edx,%edi
+  80296a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80296d:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  80296f:	89 d8                	mov    %ebx,%eax
+  802971:	f7 65 ec             	mull   -0x14(%ebp)
+
+	if (shift >= 32)
+  802974:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  802978:	77 34                	ja     8029ae <time_nsec+0x85>
+		return (hi + (lo >> 32)) >> (shift - 32);
+	return (hi << (32 - shift)) + (lo >> shift);
+  80297a:	b9 20 00 00 00       	mov    $0x20,%ecx
+  80297f:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  802982:	29 d9                	sub    %ebx,%ecx
+  802984:	0f a5 c2             	shld   %cl,%eax,%edx
+  802987:	d3 e0                	shl    %cl,%eax
+  802989:	f6 c1 20             	test   $0x20,%cl
+  80298c:	74 04                	je     802992 <time_nsec+0x69>
+  80298e:	89 c2                	mov    %eax,%edx
+  802990:	31 c0                	xor    %eax,%eax
+  802992:	89 d9                	mov    %ebx,%ecx
+  802994:	0f ad fe             	shrd   %cl,%edi,%esi
+  802997:	d3 ef                	shr    %cl,%edi
+  802999:	f6 c1 20             	test   $0x20,%cl
+  80299c:	74 04                	je     8029a2 <time_nsec+0x79>
+  80299e:	89 fe                	mov    %edi,%esi
+  8029a0:	31 ff                	xor    %edi,%edi
+  8029a2:	01 f0                	add    %esi,%eax
+  8029a4:	11 fa                	adc    %edi,%edx
+}
+  8029a6:	83 c4 14             	add    $0x14,%esp
+  8029a9:	5b                   	pop    %ebx
+  8029aa:	5e                   	pop    %esi
+  8029ab:	5f                   	pop    %edi
+  8029ac:	5d                   	pop    %ebp
+  8029ad:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  8029ae:	89 fe                	mov    %edi,%esi
+  8029b0:	31 ff                	xor    %edi,%edi
+  8029b2:	01 f0                	add    %esi,%eax
+  8029b4:	11 fa                	adc    %edi,%edx
+  8029b6:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  8029b9:	83 e9 20             	sub    $0x20,%ecx
+  8029bc:	0f ad d0             	shrd   %cl,%edx,%eax
+  8029bf:	d3 ea                	shr    %cl,%edx
+  8029c1:	f6 c1 20             	test   $0x20,%cl
+  8029c4:	74 04                	je     8029ca <time_nsec+0xa1>
+  8029c6:	89 d0                	mov    %edx,%eax
+  8029c8:	31 d2                	xor    %edx,%edx
+  8029ca:	eb da                	jmp    8029a6 <time_nsec+0x7d>
+
+008029cc <time_msec>:
+
+// Milliseconds since boot; the same clock as sys_time_msec().
+unsigned int
+time_msec(void)
+{
+  8029cc:	55                   	push   %ebp
+  8029cd:	89 e5                	mov    %esp,%ebp
+  8029cf:	57                   	push   %edi
+  8029d0:	56                   	push   %esi
+  8029d1:	53                   	push   %ebx
+  8029d2:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ms_mult, timeinfo.ti_ms_shift);
+  8029d5:	a1 18 f0 ff ee       	mov    0xeefff018,%eax
+  8029da:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  8029dd:	8b 3d 14 f0 ff ee    	mov    0xeefff014,%edi
+  8029e3:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8029e6:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  8029e8:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  8029ee:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  8029f4:	29 f0                	sub    %esi,%eax
+  8029f6:	19 fa                	sbb    %edi,%edx
+  8029f8:	89 c1                	mov    %eax,%ecx
+  8029fa:	89 d3                	mov    %edx,%ebx
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  8029fc:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  8029ff:	6b f7 00             	imul   $0x0,%edi,%esi
+  802a02:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802a05:	89 f8                	mov    %edi,%eax
+  802a07:	f7 e1                	mul    %ecx
+  802a09:	89 c6                	mov    %eax,%esi
+  802a0b:	89 d7                	mov    %edx,%edi
+  802a0d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a10:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  802a12:	89 d8                	mov    %ebx,%eax
+  802a14:	f7 65 ec             	mull   -0x14(%ebp)
+	if (shift >= 32)
+  802a17:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  802a1b:	77 32                	ja     802a4f <time_msec+0x83>
+	return (hi << (32 - shift)) + (lo >> shift);
+  802a1d:	b9 20 00 00 00       	mov    $0x20,%ecx
+  802a22:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  802a25:	29 d9                	sub    %ebx,%ecx
+  802a27:	0f a5 c2             	shld   %cl,%eax,%edx
+  802a2a:	d3 e0                	shl    %cl,%eax
+  802a2c:	f6 c1 20             	test   $0x20,%cl
+  802a2f:	74 04                	je     802a35 <time_msec+0x69>
+  802a31:	89 c2                	mov    %eax,%edx
+  802a33:	31 c0                	xor    %eax,%eax
+  802a35:	89 d9                	mov    %ebx,%ecx
+  802a37:	0f ad fe             	shrd   %cl,%edi,%esi
+  802a3a:	d3 ef                	shr    %cl,%edi
+  802a3c:	f6 c1 20             	test   $0x20,%cl
+  802a3f:	74 04                	je     802a45 <time_msec+0x79>
+  802a41:	89 fe                	mov    %edi,%esi
+  802a43:	31 ff                	xor    %edi,%edi
+  802a45:	01 f0                	add    %esi,%eax
+}
+  802a47:	83 c4 14             	add    $0x14,%esp
+  802a4a:	5b                   	pop    %ebx
+  802a4b:	5e                   	pop    %esi
+  802a4c:	5f                   	pop    %edi
+  802a4d:	5d                   	pop    %ebp
+  802a4e:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  802a4f:	89 fe                	mov    %edi,%esi
+  802a51:	31 ff                	xor    %edi,%edi
+  802a53:	01 f0                	add    %esi,%eax
+  802a55:	11 fa                	adc    %edi,%edx
+  802a57:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  802a5a:	83 e9 20             	sub    $0x20,%ecx
+  802a5d:	0f ad d0             	shrd   %cl,%edx,%eax
+  802a60:	d3 ea                	shr    %cl,%edx
+  802a62:	f6 c1 20             	test   $0x20,%cl
+  802a65:	74 04                	je     802a6b <time_msec+0x9f>
+  802a67:	89 d0                	mov    %edx,%eax
+  802a69:	31 d2                	xor    %edx,%edx
+  802a6b:	eb da                	jmp    802a47 <time_msec+0x7b>
+
+00802a6d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a72:	c3                   	ret
+
+00802a73 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802a79:	68 f3 32 80 00       	push   $0x8032f3
+  802a7e:	ff 75 0c             	push   0xc(%ebp)
+  802a81:	e8 b0 de ff ff       	call   800936 <strcpy>
+	return 0;
+}
+  802a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8b:	c9                   	leave
+  802a8c:	c3                   	ret
+
+00802a8d <devcons_write>:
+{
+  802a8d:	55                   	push   %ebp
+  802a8e:	89 e5                	mov    %esp,%ebp
+  802a90:	57                   	push   %edi
+  802a91:	56                   	push   %esi
+  802a92:	53                   	push   %ebx
+  802a93:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802a99:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802a9e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802aa4:	eb 2e                	jmp    802ad4 <devcons_write+0x47>
+		m = n - tot;
+  802aa6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802aa9:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802aab:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802ab0:	39 c3                	cmp    %eax,%ebx
+  802ab2:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802ab5:	83 ec 04             	sub    $0x4,%esp
+  802ab8:	53                   	push   %ebx
+  802ab9:	89 f0                	mov    %esi,%eax
+  802abb:	03 45 0c             	add    0xc(%ebp),%eax
+  802abe:	50                   	push   %eax
+  802abf:	57                   	push   %edi
+  802ac0:	e8 f7 df ff ff       	call   800abc <memmove>
+		sys_cputs(buf, m);
+  802ac5:	83 c4 08             	add    $0x8,%esp
+  802ac8:	53                   	push   %ebx
+  802ac9:	57                   	push   %edi
+  802aca:	e8 e0 e1 ff ff       	call   800caf <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802acf:	01 de                	add    %ebx,%esi
+  802ad1:	83 c4 10             	add    $0x10,%esp
+  802ad4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ad7:	72 cd                	jb     802aa6 <devcons_write+0x19>
+}
+  802ad9:	89 f0                	mov    %esi,%eax
+  802adb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ade:	5b                   	pop    %ebx
+  802adf:	5e                   	pop    %esi
+  802ae0:	5f                   	pop    %edi
+  802ae1:	5d                   	pop    %ebp
+  802ae2:	c3                   	ret
+
+00802ae3 <devcons_read>:
+{
+  802ae3:	55                   	push   %ebp
+  802ae4:	89 e5                	mov    %esp,%ebp
+  802ae6:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aee:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802af2:	75 07                	jne    802afb <devcons_read+0x18>
+  802af4:	eb 1f                	jmp    802b15 <devcons_read+0x32>
+		sys_yield();
+  802af6:	e8 ed e2 ff ff       	call   800de8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802afb:	e8 f3 e1 ff ff       	call   800cf3 <sys_cgetc>
+  802b00:	85 c0                	test   %eax,%eax
+  802b02:	74 f2                	je     802af6 <devcons_read+0x13>
+	if (c < 0)
+  802b04:	78 0f                	js     802b15 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802b06:	83 f8 04             	cmp    $0x4,%eax
+  802b09:	74 0c                	je     802b17 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802b0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b0e:	88 02                	mov    %al,(%edx)
+	return 1;
+  802b10:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+		return 0;
+  802b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1c:	eb f7                	jmp    802b15 <devcons_read+0x32>
+
+00802b1e <cputchar>:
+{
+  802b1e:	55                   	push   %ebp
+  802b1f:	89 e5                	mov    %esp,%ebp
+  802b21:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802b24:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b27:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802b2a:	6a 01                	push   $0x1
+  802b2c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b2f:	50                   	push   %eax
+  802b30:	e8 7a e1 ff ff       	call   800caf <sys_cputs>
+}
+  802b35:	83 c4 10             	add    $0x10,%esp
+  802b38:	c9                   	leave
+  802b39:	c3                   	ret
+
+00802b3a <getchar>:
+{
+  802b3a:	55                   	push   %ebp
+  802b3b:	89 e5                	mov    %esp,%ebp
+  802b3d:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802b40:	6a 01                	push   $0x1
+  802b42:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b45:	50                   	push   %eax
+  802b46:	6a 00                	push   $0x0
+  802b48:	e8 5a f0 ff ff       	call   801ba7 <read>
+	if (r < 0)
+  802b4d:	83 c4 10             	add    $0x10,%esp
+  802b50:	85 c0                	test   %eax,%eax
+  802b52:	78 06                	js     802b5a <getchar+0x20>
+	if (r < 1)
+  802b54:	74 06                	je     802b5c <getchar+0x22>
+	return c;
+  802b56:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802b5a:	c9                   	leave
+  802b5b:	c3                   	ret
+		return -E_EOF;
+  802b5c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802b61:	eb f7                	jmp    802b5a <getchar+0x20>
+
+00802b63 <iscons>:
+{
+  802b63:	55                   	push   %ebp
+  802b64:	89 e5                	mov    %esp,%ebp
+  802b66:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b6c:	50                   	push   %eax
+  802b6d:	ff 75 08             	push   0x8(%ebp)
+  802b70:	e8 ac ed ff ff       	call   801921 <fd_lookup>
+  802b75:	83 c4 10             	add    $0x10,%esp
+  802b78:	85 c0                	test   %eax,%eax
+  802b7a:	78 11                	js     802b8d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802b7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b7f:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802b85:	39 10                	cmp    %edx,(%eax)
+  802b87:	0f 94 c0             	sete   %al
+  802b8a:	0f b6 c0             	movzbl %al,%eax
+}
+  802b8d:	c9                   	leave
+  802b8e:	c3                   	ret
+
+00802b8f <opencons>:
+{
+  802b8f:	55                   	push   %ebp
+  802b90:	89 e5                	mov    %esp,%ebp
+  802b92:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802b95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b98:	50                   	push   %eax
+  802b99:	e8 2d ed ff ff       	call   8018cb <fd_alloc>
+  802b9e:	83 c4 10             	add    $0x10,%esp
+  802ba1:	85 c0                	test   %eax,%eax
+  802ba3:	78 3a                	js     802bdf <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ba5:	83 ec 04             	sub    $0x4,%esp
+  802ba8:	68 07 04 00 00       	push   $0x407
+  802bad:	ff 75 f4             	push   -0xc(%ebp)
+  802bb0:	6a 00                	push   $0x0
+  802bb2:	e8 77 e2 ff ff       	call   800e2e <sys_page_alloc>
+  802bb7:	83 c4 10             	add    $0x10,%esp
+  802bba:	85 c0                	test   %eax,%eax
+  802bbc:	78 21                	js     802bdf <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802bbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bc1:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802bc7:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802bc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bcc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802bd3:	83 ec 0c             	sub    $0xc,%esp
+  802bd6:	50                   	push   %eax
+  802bd7:	e8 c8 ec ff ff       	call   8018a4 <fd2num>
+  802bdc:	83 c4 10             	add    $0x10,%esp
+}
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+
+00802be1 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802be1:	55                   	push   %ebp
+  802be2:	89 e5                	mov    %esp,%ebp
+  802be4:	56                   	push   %esi
+  802be5:	53                   	push   %ebx
+  802be6:	8b 75 08             	mov    0x8(%ebp),%esi
+  802be9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802bef:	85 c0                	test   %eax,%eax
+  802bf1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802bf6:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802bf9:	83 ec 08             	sub    $0x8,%esp
+  802bfc:	ff 75 14             	push   0x14(%ebp)
+  802bff:	50                   	push   %eax
+  802c00:	e8 3a e6 ff ff       	call   80123f <sys_ipc_recv_until>
+  802c05:	83 c4 10             	add    $0x10,%esp
+  802c08:	85 c0                	test   %eax,%eax
+  802c0a:	78 61                	js     802c6d <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802c0c:	85 f6                	test   %esi,%esi
+  802c0e:	74 1c                	je     802c2c <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  802c10:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c12:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c17:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c1d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c22:	76 5f                	jbe    802c83 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802c24:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802c2a:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802c2c:	85 db                	test   %ebx,%ebx
+  802c2e:	74 1c                	je     802c4c <ipc_recv_until+0x6b>
+  802c30:	89 e0                	mov    %esp,%eax
+  802c32:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c37:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c3d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c42:	76 50                	jbe    802c94 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802c44:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802c4a:	89 03                	mov    %eax,(%ebx)
+  802c4c:	89 e0                	mov    %esp,%eax
+  802c4e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c53:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c59:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c5e:	76 45                	jbe    802ca5 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802c60:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802c66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c69:	5b                   	pop    %ebx
+  802c6a:	5e                   	pop    %esi
+  802c6b:	5d                   	pop    %ebp
+  802c6c:	c3                   	ret
+		if (from_env_store)
+  802c6d:	85 f6                	test   %esi,%esi
+  802c6f:	74 06                	je     802c77 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802c71:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802c77:	85 db                	test   %ebx,%ebx
+  802c79:	74 eb                	je     802c66 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802c7b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802c81:	eb e3                	jmp    802c66 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802c83:	c1 e8 10             	shr    $0x10,%eax
+  802c86:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c8c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802c92:	eb 90                	jmp    802c24 <ipc_recv_until+0x43>
+  802c94:	c1 e8 10             	shr    $0x10,%eax
+  802c97:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c9d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802ca3:	eb 9f                	jmp    802c44 <ipc_recv_until+0x63>
+  802ca5:	c1 e8 10             	shr    $0x10,%eax
+  802ca8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802cae:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802cb4:	eb aa                	jmp    802c60 <ipc_recv_until+0x7f>
+
+00802cb6 <ipc_recv>:
+{
+  802cb6:	55                   	push   %ebp
+  802cb7:	89 e5                	mov    %esp,%ebp
+  802cb9:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802cbc:	6a 00                	push   $0x0
+  802cbe:	ff 75 10             	push   0x10(%ebp)
+  802cc1:	ff 75 0c             	push   0xc(%ebp)
+  802cc4:	ff 75 08             	push   0x8(%ebp)
+  802cc7:	e8 15 ff ff ff       	call   802be1 <ipc_recv_until>
+}
+  802ccc:	c9                   	leave
+  802ccd:	c3                   	ret
+
+00802cce <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802cce:	55                   	push   %ebp
+  802ccf:	89 e5                	mov    %esp,%ebp
+  802cd1:	57                   	push   %edi
+  802cd2:	56                   	push   %esi
+  802cd3:	53                   	push   %ebx
+  802cd4:	83 ec 0c             	sub    $0xc,%esp
+  802cd7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cda:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802cdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802ce0:	85 db                	test   %ebx,%ebx
+  802ce2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ce7:	0f 44 d8             	cmove  %eax,%ebx
+  802cea:	eb 05                	jmp    802cf1 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802cec:	e8 f7 e0 ff ff       	call   800de8 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802cf1:	ff 75 14             	push   0x14(%ebp)
+  802cf4:	53                   	push   %ebx
+  802cf5:	56                   	push   %esi
+  802cf6:	57                   	push   %edi
+  802cf7:	e8 8f e4 ff ff       	call   80118b <sys_ipc_try_send>
+  802cfc:	83 c4 10             	add    $0x10,%esp
+  802cff:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d02:	74 e8                	je     802cec <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802d04:	85 c0                	test   %eax,%eax
+  802d06:	78 08                	js     802d10 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802d08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d0b:	5b                   	pop    %ebx
+  802d0c:	5e                   	pop    %esi
+  802d0d:	5f                   	pop    %edi
+  802d0e:	5d                   	pop    %ebp
+  802d0f:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802d10:	50                   	push   %eax
+  802d11:	68 ff 32 80 00       	push   $0x8032ff
+  802d16:	6a 4f                	push   $0x4f
+  802d18:	68 12 33 80 00       	push   $0x803312
+  802d1d:	e8 f1 d4 ff ff       	call   800213 <_panic>
+
+00802d22 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d22:	55                   	push   %ebp
+  802d23:	89 e5                	mov    %esp,%ebp
+  802d25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802d28:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802d2d:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802d33:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d39:	8b 52 50             	mov    0x50(%edx),%edx
+  802d3c:	39 ca                	cmp    %ecx,%edx
+  802d3e:	74 11                	je     802d51 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802d40:	83 c0 01             	add    $0x1,%eax
+  802d43:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802d48:	75 e3                	jne    802d2d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4f:	eb 0e                	jmp    802d5f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802d51:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d57:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d5c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802d5f:	5d                   	pop    %ebp
+  802d60:	c3                   	ret
+
+00802d61 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d61:	55                   	push   %ebp
+  802d62:	89 e5                	mov    %esp,%ebp
+  802d64:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d67:	89 c2                	mov    %eax,%edx
+  802d69:	c1 ea 16             	shr    $0x16,%edx
+  802d6c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802d73:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d78:	f6 c1 01             	test   $0x1,%cl
+  802d7b:	74 1a                	je     802d97 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802d7d:	c1 e8 0c             	shr    $0xc,%eax
+  802d80:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802d87:	a8 01                	test   $0x1,%al
+  802d89:	74 0c                	je     802d97 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802d8b:	c1 e8 0c             	shr    $0xc,%eax
+  802d8e:	c1 e0 04             	shl    $0x4,%eax
+  802d91:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802d97:	89 d0                	mov    %edx,%eax
+  802d99:	5d                   	pop    %ebp
+  802d9a:	c3                   	ret
@@ -0,0 +1,7250 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 01 00 00       	call   8001ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+	int fd, r, n, n2;
+
+	if ((fd = open("motd", O_RDONLY)) < 0)
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 c0 34 80 00       	push   $0x8034c0
+  800043:	e8 a5 27 00 00       	call   8027ed <open>
+  800048:	89 c3                	mov    %eax,%ebx
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 ff 00 00 00    	js     800154 <umain+0x121>
+		panic("open motd: %e", fd);
+	seek(fd, 0);
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	6a 00                	push   $0x0
+  80005a:	50                   	push   %eax
+  80005b:	e8 5a 24 00 00       	call   8024ba <seek>
+	if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800060:	83 c4 0c             	add    $0xc,%esp
+  800063:	68 00 02 00 00       	push   $0x200
+  800068:	68 20 52 80 00       	push   $0x805220
+  80006d:	53                   	push   %ebx
+  80006e:	e8 5e 23 00 00       	call   8023d1 <readn>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e e6 00 00 00    	jle    800166 <umain+0x133>
+		panic("readn: %e", n);
+
+	if ((r = fork()) < 0)
+  800080:	e8 0f 1d 00 00       	call   801d94 <fork>
+  800085:	89 c7                	mov    %eax,%edi
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 e9 00 00 00    	js     800178 <umain+0x145>
+		panic("fork: %e", r);
+	if (r == 0) {
+  80008f:	75 7b                	jne    80010c <umain+0xd9>
+		seek(fd, 0);
+  800091:	83 ec 08             	sub    $0x8,%esp
+  800094:	6a 00                	push   $0x0
+  800096:	53                   	push   %ebx
+  800097:	e8 1e 24 00 00       	call   8024ba <seek>
+		cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80009c:	c7 04 24 28 35 80 00 	movl   $0x803528,(%esp)
+  8000a3:	e8 c1 02 00 00       	call   800369 <cprintf>
+		if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000a8:	83 c4 0c             	add    $0xc,%esp
+  8000ab:	68 00 02 00 00       	push   $0x200
+  8000b0:	68 20 50 80 00       	push   $0x805020
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 16 23 00 00       	call   8023d1 <readn>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	39 c6                	cmp    %eax,%esi
+  8000c0:	0f 85 c4 00 00 00    	jne    80018a <umain+0x157>
+			panic("read in parent got %d, read in child got %d", n, n2);
+		if (memcmp(buf, buf2, n) != 0)
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	68 20 50 80 00       	push   $0x805020
+  8000cf:	68 20 52 80 00       	push   $0x805220
+  8000d4:	e8 d6 0a 00 00       	call   800baf <memcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	0f 85 bc 00 00 00    	jne    8001a0 <umain+0x16d>
+			panic("read in parent got different bytes from read in child");
+		cprintf("read in child succeeded\n");
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 f2 34 80 00       	push   $0x8034f2
+  8000ec:	e8 78 02 00 00       	call   800369 <cprintf>
+		seek(fd, 0);
+  8000f1:	83 c4 08             	add    $0x8,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	53                   	push   %ebx
+  8000f7:	e8 be 23 00 00       	call   8024ba <seek>
+		close(fd);
+  8000fc:	89 1c 24             	mov    %ebx,(%esp)
+  8000ff:	e8 ea 20 00 00       	call   8021ee <close>
+		exit();
+  800104:	e8 6b 01 00 00       	call   800274 <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+	}
+	wait(r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	57                   	push   %edi
+  800110:	e8 97 2f 00 00       	call   8030ac <wait>
+	if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800115:	83 c4 0c             	add    $0xc,%esp
+  800118:	68 00 02 00 00       	push   $0x200
+  80011d:	68 20 50 80 00       	push   $0x805020
+  800122:	53                   	push   %ebx
+  800123:	e8 a9 22 00 00       	call   8023d1 <readn>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	39 c6                	cmp    %eax,%esi
+  80012d:	0f 85 81 00 00 00    	jne    8001b4 <umain+0x181>
+		panic("read in parent got %d, then got %d", n, n2);
+	cprintf("read in parent succeeded\n");
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	68 0b 35 80 00       	push   $0x80350b
+  80013b:	e8 29 02 00 00       	call   800369 <cprintf>
+	close(fd);
+  800140:	89 1c 24             	mov    %ebx,(%esp)
+  800143:	e8 a6 20 00 00       	call   8021ee <close>
+#define MSR_SYSENTER_EIP	0x176
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  800148:	cc                   	int3
+
+	breakpoint();
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+		panic("open motd: %e", fd);
+  800154:	50                   	push   %eax
+  800155:	68 c5 34 80 00       	push   $0x8034c5
+  80015a:	6a 0c                	push   $0xc
+  80015c:	68 d3 34 80 00       	push   $0x8034d3
+  800161:	e8 28 01 00 00       	call   80028e <_panic>
+		panic("readn: %e", n);
+  800166:	50                   	push   %eax
+  800167:	68 e8 34 80 00       	push   $0x8034e8
+  80016c:	6a 0f                	push   $0xf
+  80016e:	68 d3 34 80 00       	push   $0x8034d3
+  800173:	e8 16 01 00 00       	call   80028e <_panic>
+		panic("fork: %e", r);
+  800178:	50                   	push   %eax
+  800179:	68 70 3a 80 00       	push   $0x803a70
+  80017e:	6a 12                	push   $0x12
+  800180:	68 d3 34 80 00       	push   $0x8034d3
+  800185:	e8 04 01 00 00       	call   80028e <_panic>
+			panic("read in parent got %d, read in child got %d", n, n2);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	50                   	push   %eax
+  80018e:	56                   	push   %esi
+  80018f:	68 6c 35 80 00       	push   $0x80356c
+  800194:	6a 17                	push   $0x17
+  800196:	68 d3 34 80 00       	push   $0x8034d3
+  80019b:	e8 ee 00 00 00       	call   80028e <_panic>
+			panic("read in parent got different bytes from read in child");
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	68 98 35 80 00       	push   $0x803598
+  8001a8:	6a 19                	push   $0x19
+  8001aa:	68 d3 34 80 00       	push   $0x8034d3
+  8001af:	e8 da 00 00 00       	call   80028e <_panic>
+		panic("read in parent got %d, then got %d", n, n2);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	50                   	push   %eax
+  8001b8:	56                   	push   %esi
+  8001b9:	68 d0 35 80 00       	push   $0x8035d0
+  8001be:	6a 21                	push   $0x21
+  8001c0:	68 d3 34 80 00       	push   $0x8034d3
+  8001c5:	e8 c4 00 00 00       	call   80028e <_panic>
+
+008001ca <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	57                   	push   %edi
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	83 ec 0c             	sub    $0xc,%esp
+  8001d3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8001d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001de:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8001e0:	c1 ea 0b             	shr    $0xb,%edx
+  8001e3:	83 f2 01             	xor    $0x1,%edx
+  8001e6:	83 e2 01             	and    $0x1,%edx
+  8001e9:	88 15 24 54 80 00    	mov    %dl,0x805424
+
+	mainenv = NULL;
+  8001ef:	c7 05 20 54 80 00 00 	movl   $0x0,0x805420
+  8001f6:	00 00 00 
+	envid = sys_getenvid();
+  8001f9:	e8 1f 0c 00 00       	call   800e1d <sys_getenvid>
+  8001fe:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800200:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800205:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80020b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800211:	8b 52 48             	mov    0x48(%edx),%edx
+  800214:	39 ca                	cmp    %ecx,%edx
+  800216:	74 27                	je     80023f <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800218:	83 c0 01             	add    $0x1,%eax
+  80021b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800220:	75 e3                	jne    800205 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800222:	83 3d 20 54 80 00 00 	cmpl   $0x0,0x805420
+  800229:	75 24                	jne    80024f <libmain+0x85>
+		panic("libmain can't find the environment");
+  80022b:	83 ec 04             	sub    $0x4,%esp
+  80022e:	68 f4 35 80 00       	push   $0x8035f4
+  800233:	6a 23                	push   $0x23
+  800235:	68 17 36 80 00       	push   $0x803617
+  80023a:	e8 4f 00 00 00       	call   80028e <_panic>
+			mainenv = &envs[i];
+  80023f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800245:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80024a:	a3 20 54 80 00       	mov    %eax,0x805420
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80024f:	85 ff                	test   %edi,%edi
+  800251:	7e 07                	jle    80025a <libmain+0x90>
+		binaryname = argv[0];
+  800253:	8b 06                	mov    (%esi),%eax
+  800255:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80025a:	83 ec 08             	sub    $0x8,%esp
+  80025d:	56                   	push   %esi
+  80025e:	57                   	push   %edi
+  80025f:	e8 cf fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800264:	e8 0b 00 00 00       	call   800274 <exit>
+}
+  800269:	83 c4 10             	add    $0x10,%esp
+  80026c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026f:	5b                   	pop    %ebx
+  800270:	5e                   	pop    %esi
+  800271:	5f                   	pop    %edi
+  800272:	5d                   	pop    %ebp
+  800273:	c3                   	ret
+
+00800274 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80027a:	e8 9c 1f 00 00       	call   80221b <close_all>
+	sys_env_destroy(0);
+  80027f:	83 ec 0c             	sub    $0xc,%esp
+  800282:	6a 00                	push   $0x0
+  800284:	e8 2b 0b 00 00       	call   800db4 <sys_env_destroy>
+}
+  800289:	83 c4 10             	add    $0x10,%esp
+  80028c:	c9                   	leave
+  80028d:	c3                   	ret
+
+0080028e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80028e:	55                   	push   %ebp
+  80028f:	89 e5                	mov    %esp,%ebp
+  800291:	56                   	push   %esi
+  800292:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800293:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800296:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80029c:	e8 7c 0b 00 00       	call   800e1d <sys_getenvid>
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	ff 75 0c             	push   0xc(%ebp)
+  8002a7:	ff 75 08             	push   0x8(%ebp)
+  8002aa:	56                   	push   %esi
+  8002ab:	50                   	push   %eax
+  8002ac:	68 30 36 80 00       	push   $0x803630
+  8002b1:	e8 b3 00 00 00       	call   800369 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002b6:	83 c4 18             	add    $0x18,%esp
+  8002b9:	53                   	push   %ebx
+  8002ba:	ff 75 10             	push   0x10(%ebp)
+  8002bd:	e8 56 00 00 00       	call   800318 <vcprintf>
+	cprintf("\n");
+  8002c2:	c7 04 24 09 35 80 00 	movl   $0x803509,(%esp)
+  8002c9:	e8 9b 00 00 00       	call   800369 <cprintf>
+  8002ce:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002d1:	cc                   	int3
+	while (1)
+  8002d2:	eb fd                	jmp    8002d1 <_panic+0x43>
+
+008002d4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002d4:	55                   	push   %ebp
+  8002d5:	89 e5                	mov    %esp,%ebp
+  8002d7:	53                   	push   %ebx
+  8002d8:	83 ec 04             	sub    $0x4,%esp
+  8002db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002de:	8b 13                	mov    (%ebx),%edx
+  8002e0:	8d 42 01             	lea    0x1(%edx),%eax
+  8002e3:	89 03                	mov    %eax,(%ebx)
+  8002e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002e8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002ec:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002f1:	74 09                	je     8002fc <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002f3:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002fa:	c9                   	leave
+  8002fb:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002fc:	83 ec 08             	sub    $0x8,%esp
+  8002ff:	68 ff 00 00 00       	push   $0xff
+  800304:	8d 43 08             	lea    0x8(%ebx),%eax
+  800307:	50                   	push   %eax
+  800308:	e8 1d 0a 00 00       	call   800d2a <sys_cputs>
+		b->idx = 0;
+  80030d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800313:	83 c4 10             	add    $0x10,%esp
+  800316:	eb db                	jmp    8002f3 <putch+0x1f>
+
+00800318 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800318:	55                   	push   %ebp
+  800319:	89 e5                	mov    %esp,%ebp
+  80031b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800321:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800328:	00 00 00 
+	b.cnt = 0;
+  80032b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800332:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800335:	ff 75 0c             	push   0xc(%ebp)
+  800338:	ff 75 08             	push   0x8(%ebp)
+  80033b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800341:	50                   	push   %eax
+  800342:	68 d4 02 80 00       	push   $0x8002d4
+  800347:	e8 fb 00 00 00       	call   800447 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80034c:	83 c4 08             	add    $0x8,%esp
+  80034f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800355:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80035b:	50                   	push   %eax
+  80035c:	e8 c9 09 00 00       	call   800d2a <sys_cputs>
+
+	return b.cnt;
+}
+  800361:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800367:	c9                   	leave
+  800368:	c3                   	ret
+
+00800369 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800369:	55                   	push   %ebp
+  80036a:	89 e5                	mov    %esp,%ebp
+  80036c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80036f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800372:	50                   	push   %eax
+  800373:	ff 75 08             	push   0x8(%ebp)
+  800376:	e8 9d ff ff ff       	call   800318 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80037b:	c9                   	leave
+  80037c:	c3                   	ret
+
+0080037d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	57                   	push   %edi
+  800381:	56                   	push   %esi
+  800382:	53                   	push   %ebx
+  800383:	83 ec 1c             	sub    $0x1c,%esp
+  800386:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800389:	89 d6                	mov    %edx,%esi
+  80038b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80038e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800391:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800394:	73 0b                	jae    8003a1 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800396:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800399:	c1 e7 08             	shl    $0x8,%edi
+  80039c:	0b 7d 10             	or     0x10(%ebp),%edi
+  80039f:	eb 36                	jmp    8003d7 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8003a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a9:	f7 75 08             	divl   0x8(%ebp)
+  8003ac:	89 c1                	mov    %eax,%ecx
+  8003ae:	ff 75 14             	push   0x14(%ebp)
+  8003b1:	ff 75 10             	push   0x10(%ebp)
+  8003b4:	83 eb 01             	sub    $0x1,%ebx
+  8003b7:	53                   	push   %ebx
+  8003b8:	ff 75 08             	push   0x8(%ebp)
+  8003bb:	89 f2                	mov    %esi,%edx
+  8003bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003c0:	e8 b8 ff ff ff       	call   80037d <printnum>
+  8003c5:	83 c4 10             	add    $0x10,%esp
+  8003c8:	eb 14                	jmp    8003de <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8003ca:	83 ec 08             	sub    $0x8,%esp
+  8003cd:	56                   	push   %esi
+  8003ce:	57                   	push   %edi
+  8003cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003d2:	ff d0                	call   *%eax
+  8003d4:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003d7:	83 eb 01             	sub    $0x1,%ebx
+  8003da:	85 db                	test   %ebx,%ebx
+  8003dc:	7f ec                	jg     8003ca <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8003de:	83 ec 08             	sub    $0x8,%esp
+  8003e1:	56                   	push   %esi
+  8003e2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ea:	f7 75 08             	divl   0x8(%ebp)
+  8003ed:	0f be 92 53 36 80 00 	movsbl 0x803653(%edx),%edx
+  8003f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f7:	c1 e0 08             	shl    $0x8,%eax
+  8003fa:	09 d0                	or     %edx,%eax
+  8003fc:	50                   	push   %eax
+  8003fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800400:	ff d0                	call   *%eax
+}
+  800402:	83 c4 10             	add    $0x10,%esp
+  800405:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800408:	5b                   	pop    %ebx
+  800409:	5e                   	pop    %esi
+  80040a:	5f                   	pop    %edi
+  80040b:	5d                   	pop    %ebp
+  80040c:	c3                   	ret
+
+0080040d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80040d:	55                   	push   %ebp
+  80040e:	89 e5                	mov    %esp,%ebp
+  800410:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800413:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800417:	8b 10                	mov    (%eax),%edx
+  800419:	3b 50 04             	cmp    0x4(%eax),%edx
+  80041c:	73 0a                	jae    800428 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80041e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800421:	89 08                	mov    %ecx,(%eax)
+  800423:	8b 45 08             	mov    0x8(%ebp),%eax
+  800426:	88 02                	mov    %al,(%edx)
+}
+  800428:	5d                   	pop    %ebp
+  800429:	c3                   	ret
+
+0080042a <printfmt>:
+{
+  80042a:	55                   	push   %ebp
+  80042b:	89 e5                	mov    %esp,%ebp
+  80042d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800430:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800433:	50                   	push   %eax
+  800434:	ff 75 10             	push   0x10(%ebp)
+  800437:	ff 75 0c             	push   0xc(%ebp)
+  80043a:	ff 75 08             	push   0x8(%ebp)
+  80043d:	e8 05 00 00 00       	call   800447 <vprintfmt>
+}
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	c9                   	leave
+  800446:	c3                   	ret
+
+00800447 <vprintfmt>:
+{
+  800447:	55                   	push   %ebp
+  800448:	89 e5                	mov    %esp,%ebp
+  80044a:	57                   	push   %edi
+  80044b:	56                   	push   %esi
+  80044c:	53                   	push   %ebx
+  80044d:	83 ec 3c             	sub    $0x3c,%esp
+  800450:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800453:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800456:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80045d:	eb 16                	jmp    800475 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80045f:	83 ec 08             	sub    $0x8,%esp
+  800462:	ff 75 0c             	push   0xc(%ebp)
+  800465:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800468:	c1 e2 08             	shl    $0x8,%edx
+  80046b:	09 d0                	or     %edx,%eax
+  80046d:	50                   	push   %eax
+  80046e:	ff d7                	call   *%edi
+  800470:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800473:	89 de                	mov    %ebx,%esi
+  800475:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800478:	0f b6 06             	movzbl (%esi),%eax
+  80047b:	83 f8 25             	cmp    $0x25,%eax
+  80047e:	74 0c                	je     80048c <vprintfmt+0x45>
+			if (ch == '\0')
+  800480:	85 c0                	test   %eax,%eax
+  800482:	75 db                	jne    80045f <vprintfmt+0x18>
+}
+  800484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800487:	5b                   	pop    %ebx
+  800488:	5e                   	pop    %esi
+  800489:	5f                   	pop    %edi
+  80048a:	5d                   	pop    %ebp
+  80048b:	c3                   	ret
+		padc = ' ';
+  80048c:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800490:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800497:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80049e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004aa:	8d 73 01             	lea    0x1(%ebx),%esi
+  8004ad:	0f b6 13             	movzbl (%ebx),%edx
+  8004b0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004b3:	3c 55                	cmp    $0x55,%al
+  8004b5:	0f 87 2c 04 00 00    	ja     8008e7 <vprintfmt+0x4a0>
+  8004bb:	0f b6 c0             	movzbl %al,%eax
+  8004be:	ff 24 85 a0 37 80 00 	jmp    *0x8037a0(,%eax,4)
+  8004c5:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8004c7:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8004cb:	eb dd                	jmp    8004aa <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004cd:	89 f3                	mov    %esi,%ebx
+  8004cf:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8004d3:	eb d5                	jmp    8004aa <vprintfmt+0x63>
+  8004d5:	0f b6 d2             	movzbl %dl,%edx
+  8004d8:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8004da:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8004df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004e6:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8004e9:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8004ec:	83 fe 09             	cmp    $0x9,%esi
+  8004ef:	0f 87 8a 00 00 00    	ja     80057f <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8004f5:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8004f8:	eb e5                	jmp    8004df <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8004fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fd:	8b 00                	mov    (%eax),%eax
+  8004ff:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800502:	8b 45 14             	mov    0x14(%ebp),%eax
+  800505:	8d 40 04             	lea    0x4(%eax),%eax
+  800508:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80050b:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80050d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800511:	79 97                	jns    8004aa <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800513:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800516:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800519:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800520:	eb 88                	jmp    8004aa <vprintfmt+0x63>
+			if (width < 0)
+  800522:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800525:	85 db                	test   %ebx,%ebx
+  800527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052c:	0f 49 c3             	cmovns %ebx,%eax
+  80052f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800532:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800534:	e9 71 ff ff ff       	jmp    8004aa <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800539:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80053b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800542:	e9 63 ff ff ff       	jmp    8004aa <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800547:	8d 73 02             	lea    0x2(%ebx),%esi
+  80054a:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80054e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800555:	3c 67                	cmp    $0x67,%al
+  800557:	0f 84 18 ff ff ff    	je     800475 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80055d:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800564:	3c 72                	cmp    $0x72,%al
+  800566:	0f 84 09 ff ff ff    	je     800475 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80056c:	3c 62                	cmp    $0x62,%al
+  80056e:	0f 94 c0             	sete   %al
+  800571:	0f b6 c0             	movzbl %al,%eax
+  800574:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800577:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80057a:	e9 f6 fe ff ff       	jmp    800475 <vprintfmt+0x2e>
+  80057f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800582:	eb 89                	jmp    80050d <vprintfmt+0xc6>
+			lflag++;
+  800584:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800587:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800589:	e9 1c ff ff ff       	jmp    8004aa <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8d 58 04             	lea    0x4(%eax),%ebx
+  800594:	83 ec 08             	sub    $0x8,%esp
+  800597:	ff 75 0c             	push   0xc(%ebp)
+  80059a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80059d:	c1 e0 08             	shl    $0x8,%eax
+  8005a0:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005a3:	0b 01                	or     (%ecx),%eax
+  8005a5:	50                   	push   %eax
+  8005a6:	ff d7                	call   *%edi
+			break;
+  8005a8:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005ab:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8005ae:	e9 c2 fe ff ff       	jmp    800475 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8005b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b6:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8005b9:	8b 10                	mov    (%eax),%edx
+  8005bb:	89 d0                	mov    %edx,%eax
+  8005bd:	f7 d8                	neg    %eax
+  8005bf:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005c2:	83 f8 12             	cmp    $0x12,%eax
+  8005c5:	7f 25                	jg     8005ec <vprintfmt+0x1a5>
+  8005c7:	8b 14 85 00 39 80 00 	mov    0x803900(,%eax,4),%edx
+  8005ce:	85 d2                	test   %edx,%edx
+  8005d0:	74 1a                	je     8005ec <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8005d2:	52                   	push   %edx
+  8005d3:	68 42 3a 80 00       	push   $0x803a42
+  8005d8:	ff 75 0c             	push   0xc(%ebp)
+  8005db:	57                   	push   %edi
+  8005dc:	e8 49 fe ff ff       	call   80042a <printfmt>
+  8005e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e4:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8005e7:	e9 89 fe ff ff       	jmp    800475 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8005ec:	50                   	push   %eax
+  8005ed:	68 6b 36 80 00       	push   $0x80366b
+  8005f2:	ff 75 0c             	push   0xc(%ebp)
+  8005f5:	57                   	push   %edi
+  8005f6:	e8 2f fe ff ff       	call   80042a <printfmt>
+  8005fb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005fe:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800601:	e9 6f fe ff ff       	jmp    800475 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	83 c0 04             	add    $0x4,%eax
+  80060c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80060f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800612:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800614:	85 c9                	test   %ecx,%ecx
+  800616:	b8 64 36 80 00       	mov    $0x803664,%eax
+  80061b:	0f 45 c1             	cmovne %ecx,%eax
+  80061e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800621:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800625:	7e 06                	jle    80062d <vprintfmt+0x1e6>
+  800627:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80062b:	75 1a                	jne    800647 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80062d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800630:	c1 e0 08             	shl    $0x8,%eax
+  800633:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800636:	83 c8 3f             	or     $0x3f,%eax
+  800639:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80063c:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80063f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800642:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800645:	eb 6d                	jmp    8006b4 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800647:	83 ec 08             	sub    $0x8,%esp
+  80064a:	ff 75 d0             	push   -0x30(%ebp)
+  80064d:	ff 75 c8             	push   -0x38(%ebp)
+  800650:	e8 39 03 00 00       	call   80098e <strnlen>
+  800655:	89 c2                	mov    %eax,%edx
+  800657:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80065a:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80065c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80065f:	c1 e1 08             	shl    $0x8,%ecx
+  800662:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800666:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800668:	83 c4 10             	add    $0x10,%esp
+  80066b:	89 c3                	mov    %eax,%ebx
+  80066d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800670:	89 75 10             	mov    %esi,0x10(%ebp)
+  800673:	89 ce                	mov    %ecx,%esi
+  800675:	eb 0f                	jmp    800686 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800677:	83 ec 08             	sub    $0x8,%esp
+  80067a:	ff 75 0c             	push   0xc(%ebp)
+  80067d:	56                   	push   %esi
+  80067e:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800680:	83 eb 01             	sub    $0x1,%ebx
+  800683:	83 c4 10             	add    $0x10,%esp
+  800686:	85 db                	test   %ebx,%ebx
+  800688:	7f ed                	jg     800677 <vprintfmt+0x230>
+  80068a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80068d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800690:	85 c0                	test   %eax,%eax
+  800692:	ba 00 00 00 00       	mov    $0x0,%edx
+  800697:	0f 49 d0             	cmovns %eax,%edx
+  80069a:	29 d0                	sub    %edx,%eax
+  80069c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80069f:	eb 8c                	jmp    80062d <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8006a1:	83 ec 08             	sub    $0x8,%esp
+  8006a4:	ff 75 0c             	push   0xc(%ebp)
+  8006a7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006aa:	09 c2                	or     %eax,%edx
+  8006ac:	52                   	push   %edx
+  8006ad:	ff d7                	call   *%edi
+  8006af:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006b2:	89 d9                	mov    %ebx,%ecx
+  8006b4:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8006b7:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8006bb:	0f be d0             	movsbl %al,%edx
+  8006be:	85 d2                	test   %edx,%edx
+  8006c0:	74 2a                	je     8006ec <vprintfmt+0x2a5>
+  8006c2:	85 f6                	test   %esi,%esi
+  8006c4:	78 05                	js     8006cb <vprintfmt+0x284>
+  8006c6:	83 ee 01             	sub    $0x1,%esi
+  8006c9:	78 3b                	js     800706 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006cb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006cf:	74 d0                	je     8006a1 <vprintfmt+0x25a>
+  8006d1:	0f be c0             	movsbl %al,%eax
+  8006d4:	83 e8 20             	sub    $0x20,%eax
+  8006d7:	83 f8 5e             	cmp    $0x5e,%eax
+  8006da:	76 c5                	jbe    8006a1 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	ff 75 0c             	push   0xc(%ebp)
+  8006e2:	ff 75 cc             	push   -0x34(%ebp)
+  8006e5:	ff d7                	call   *%edi
+  8006e7:	83 c4 10             	add    $0x10,%esp
+  8006ea:	eb c6                	jmp    8006b2 <vprintfmt+0x26b>
+  8006ec:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006ef:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8006f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f5:	01 c3                	add    %eax,%ebx
+  8006f7:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8006f9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006fc:	83 c8 20             	or     $0x20,%eax
+  8006ff:	89 75 10             	mov    %esi,0x10(%ebp)
+  800702:	89 c6                	mov    %eax,%esi
+  800704:	eb 14                	jmp    80071a <vprintfmt+0x2d3>
+  800706:	8b 75 10             	mov    0x10(%ebp),%esi
+  800709:	eb e4                	jmp    8006ef <vprintfmt+0x2a8>
+  80070b:	83 ec 08             	sub    $0x8,%esp
+  80070e:	ff 75 0c             	push   0xc(%ebp)
+  800711:	56                   	push   %esi
+  800712:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800714:	83 eb 01             	sub    $0x1,%ebx
+  800717:	83 c4 10             	add    $0x10,%esp
+  80071a:	85 db                	test   %ebx,%ebx
+  80071c:	7f ed                	jg     80070b <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80071e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800721:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+  800727:	e9 49 fd ff ff       	jmp    800475 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80072c:	83 f9 01             	cmp    $0x1,%ecx
+  80072f:	7f 1f                	jg     800750 <vprintfmt+0x309>
+	else if (lflag)
+  800731:	85 c9                	test   %ecx,%ecx
+  800733:	74 69                	je     80079e <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800735:	8b 45 14             	mov    0x14(%ebp),%eax
+  800738:	8b 00                	mov    (%eax),%eax
+  80073a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80073d:	89 c1                	mov    %eax,%ecx
+  80073f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800742:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8d 40 04             	lea    0x4(%eax),%eax
+  80074b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074e:	eb 17                	jmp    800767 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 50 04             	mov    0x4(%eax),%edx
+  800756:	8b 00                	mov    (%eax),%eax
+  800758:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8d 40 08             	lea    0x8(%eax),%eax
+  800764:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800767:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80076a:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80076d:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800772:	85 db                	test   %ebx,%ebx
+  800774:	0f 89 f6 00 00 00    	jns    800870 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80077a:	83 ec 08             	sub    $0x8,%esp
+  80077d:	ff 75 0c             	push   0xc(%ebp)
+  800780:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800783:	c1 e0 08             	shl    $0x8,%eax
+  800786:	83 c8 2d             	or     $0x2d,%eax
+  800789:	50                   	push   %eax
+  80078a:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80078c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80078f:	f7 d9                	neg    %ecx
+  800791:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800794:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800799:	e9 d2 00 00 00       	jmp    800870 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8b 00                	mov    (%eax),%eax
+  8007a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a6:	89 c1                	mov    %eax,%ecx
+  8007a8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007ab:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b7:	eb ae                	jmp    800767 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8007b9:	83 f9 01             	cmp    $0x1,%ecx
+  8007bc:	7f 19                	jg     8007d7 <vprintfmt+0x390>
+	else if (lflag)
+  8007be:	85 c9                	test   %ecx,%ecx
+  8007c0:	74 2a                	je     8007ec <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8007c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c5:	8b 08                	mov    (%eax),%ecx
+  8007c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8007d2:	e9 99 00 00 00       	jmp    800870 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007da:	8b 08                	mov    (%eax),%ecx
+  8007dc:	8d 40 08             	lea    0x8(%eax),%eax
+  8007df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8007e7:	e9 84 00 00 00       	jmp    800870 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ef:	8b 08                	mov    (%eax),%ecx
+  8007f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8007fc:	eb 72                	jmp    800870 <vprintfmt+0x429>
+	if (lflag >= 2)
+  8007fe:	83 f9 01             	cmp    $0x1,%ecx
+  800801:	7f 16                	jg     800819 <vprintfmt+0x3d2>
+	else if (lflag)
+  800803:	85 c9                	test   %ecx,%ecx
+  800805:	74 24                	je     80082b <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8b 08                	mov    (%eax),%ecx
+  80080c:	8d 40 04             	lea    0x4(%eax),%eax
+  80080f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800812:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800817:	eb 57                	jmp    800870 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800819:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081c:	8b 08                	mov    (%eax),%ecx
+  80081e:	8d 40 08             	lea    0x8(%eax),%eax
+  800821:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800824:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800829:	eb 45                	jmp    800870 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80082b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082e:	8b 08                	mov    (%eax),%ecx
+  800830:	8d 40 04             	lea    0x4(%eax),%eax
+  800833:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800836:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80083b:	eb 33                	jmp    800870 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  80083d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800840:	c1 e3 08             	shl    $0x8,%ebx
+  800843:	83 ec 08             	sub    $0x8,%esp
+  800846:	ff 75 0c             	push   0xc(%ebp)
+  800849:	89 d8                	mov    %ebx,%eax
+  80084b:	83 c8 30             	or     $0x30,%eax
+  80084e:	50                   	push   %eax
+  80084f:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800851:	83 c4 08             	add    $0x8,%esp
+  800854:	ff 75 0c             	push   0xc(%ebp)
+  800857:	83 cb 78             	or     $0x78,%ebx
+  80085a:	53                   	push   %ebx
+  80085b:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80085d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800860:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800862:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800865:	8d 40 04             	lea    0x4(%eax),%eax
+  800868:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80086b:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800870:	ff 75 e4             	push   -0x1c(%ebp)
+  800873:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800877:	52                   	push   %edx
+  800878:	ff 75 e0             	push   -0x20(%ebp)
+  80087b:	50                   	push   %eax
+  80087c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80087f:	89 f8                	mov    %edi,%eax
+  800881:	e8 f7 fa ff ff       	call   80037d <printnum>
+			break;
+  800886:	83 c4 10             	add    $0x10,%esp
+  800889:	e9 e7 fb ff ff       	jmp    800475 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80088e:	83 f9 01             	cmp    $0x1,%ecx
+  800891:	7f 16                	jg     8008a9 <vprintfmt+0x462>
+	else if (lflag)
+  800893:	85 c9                	test   %ecx,%ecx
+  800895:	74 24                	je     8008bb <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089a:	8b 08                	mov    (%eax),%ecx
+  80089c:	8d 40 04             	lea    0x4(%eax),%eax
+  80089f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a2:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8008a7:	eb c7                	jmp    800870 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ac:	8b 08                	mov    (%eax),%ecx
+  8008ae:	8d 40 08             	lea    0x8(%eax),%eax
+  8008b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008b4:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8008b9:	eb b5                	jmp    800870 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008be:	8b 08                	mov    (%eax),%ecx
+  8008c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008c6:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8008cb:	eb a3                	jmp    800870 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8008cd:	83 ec 08             	sub    $0x8,%esp
+  8008d0:	ff 75 0c             	push   0xc(%ebp)
+  8008d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008d6:	c1 e0 08             	shl    $0x8,%eax
+  8008d9:	83 c8 25             	or     $0x25,%eax
+  8008dc:	50                   	push   %eax
+  8008dd:	ff d7                	call   *%edi
+			break;
+  8008df:	83 c4 10             	add    $0x10,%esp
+  8008e2:	e9 8e fb ff ff       	jmp    800475 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8008e7:	83 ec 08             	sub    $0x8,%esp
+  8008ea:	ff 75 0c             	push   0xc(%ebp)
+  8008ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008f0:	c1 e0 08             	shl    $0x8,%eax
+  8008f3:	83 c8 25             	or     $0x25,%eax
+  8008f6:	50                   	push   %eax
+  8008f7:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008f9:	83 c4 10             	add    $0x10,%esp
+  8008fc:	89 de                	mov    %ebx,%esi
+  8008fe:	eb 03                	jmp    800903 <vprintfmt+0x4bc>
+  800900:	83 ee 01             	sub    $0x1,%esi
+  800903:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800907:	75 f7                	jne    800900 <vprintfmt+0x4b9>
+  800909:	e9 67 fb ff ff       	jmp    800475 <vprintfmt+0x2e>
+
+0080090e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	83 ec 18             	sub    $0x18,%esp
+  800914:	8b 45 08             	mov    0x8(%ebp),%eax
+  800917:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80091a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80091d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800921:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800924:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80092b:	85 c0                	test   %eax,%eax
+  80092d:	74 26                	je     800955 <vsnprintf+0x47>
+  80092f:	85 d2                	test   %edx,%edx
+  800931:	7e 22                	jle    800955 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800933:	ff 75 14             	push   0x14(%ebp)
+  800936:	ff 75 10             	push   0x10(%ebp)
+  800939:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80093c:	50                   	push   %eax
+  80093d:	68 0d 04 80 00       	push   $0x80040d
+  800942:	e8 00 fb ff ff       	call   800447 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800947:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80094a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80094d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800950:	83 c4 10             	add    $0x10,%esp
+}
+  800953:	c9                   	leave
+  800954:	c3                   	ret
+		return -E_INVAL;
+  800955:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80095a:	eb f7                	jmp    800953 <vsnprintf+0x45>
+
+0080095c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800962:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800965:	50                   	push   %eax
+  800966:	ff 75 10             	push   0x10(%ebp)
+  800969:	ff 75 0c             	push   0xc(%ebp)
+  80096c:	ff 75 08             	push   0x8(%ebp)
+  80096f:	e8 9a ff ff ff       	call   80090e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800974:	c9                   	leave
+  800975:	c3                   	ret
+
+00800976 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80097c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800981:	eb 03                	jmp    800986 <strlen+0x10>
+		n++;
+  800983:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800986:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80098a:	75 f7                	jne    800983 <strlen+0xd>
+	return n;
+}
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800994:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099c:	eb 03                	jmp    8009a1 <strnlen+0x13>
+		n++;
+  80099e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a1:	39 d0                	cmp    %edx,%eax
+  8009a3:	74 08                	je     8009ad <strnlen+0x1f>
+  8009a5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009a9:	75 f3                	jne    80099e <strnlen+0x10>
+  8009ab:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009ad:	89 d0                	mov    %edx,%eax
+  8009af:	5d                   	pop    %ebp
+  8009b0:	c3                   	ret
+
+008009b1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	53                   	push   %ebx
+  8009b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009c7:	83 c0 01             	add    $0x1,%eax
+  8009ca:	84 d2                	test   %dl,%dl
+  8009cc:	75 f2                	jne    8009c0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009ce:	89 c8                	mov    %ecx,%eax
+  8009d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d3:	c9                   	leave
+  8009d4:	c3                   	ret
+
+008009d5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009d5:	55                   	push   %ebp
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	53                   	push   %ebx
+  8009d9:	83 ec 10             	sub    $0x10,%esp
+  8009dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009df:	53                   	push   %ebx
+  8009e0:	e8 91 ff ff ff       	call   800976 <strlen>
+  8009e5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009e8:	ff 75 0c             	push   0xc(%ebp)
+  8009eb:	01 d8                	add    %ebx,%eax
+  8009ed:	50                   	push   %eax
+  8009ee:	e8 be ff ff ff       	call   8009b1 <strcpy>
+	return dst;
+}
+  8009f3:	89 d8                	mov    %ebx,%eax
+  8009f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f8:	c9                   	leave
+  8009f9:	c3                   	ret
+
+008009fa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	56                   	push   %esi
+  8009fe:	53                   	push   %ebx
+  8009ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a02:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a05:	89 f3                	mov    %esi,%ebx
+  800a07:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a0a:	89 f0                	mov    %esi,%eax
+  800a0c:	eb 0f                	jmp    800a1d <strncpy+0x23>
+		*dst++ = *src;
+  800a0e:	83 c0 01             	add    $0x1,%eax
+  800a11:	0f b6 0a             	movzbl (%edx),%ecx
+  800a14:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a17:	80 f9 01             	cmp    $0x1,%cl
+  800a1a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a1d:	39 d8                	cmp    %ebx,%eax
+  800a1f:	75 ed                	jne    800a0e <strncpy+0x14>
+	}
+	return ret;
+}
+  800a21:	89 f0                	mov    %esi,%eax
+  800a23:	5b                   	pop    %ebx
+  800a24:	5e                   	pop    %esi
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+
+00800a27 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	56                   	push   %esi
+  800a2b:	53                   	push   %ebx
+  800a2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a32:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a35:	89 f0                	mov    %esi,%eax
+  800a37:	85 d2                	test   %edx,%edx
+  800a39:	74 21                	je     800a5c <strlcpy+0x35>
+  800a3b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a3f:	89 f2                	mov    %esi,%edx
+  800a41:	eb 09                	jmp    800a4c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a43:	83 c1 01             	add    $0x1,%ecx
+  800a46:	83 c2 01             	add    $0x1,%edx
+  800a49:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a4c:	39 c2                	cmp    %eax,%edx
+  800a4e:	74 09                	je     800a59 <strlcpy+0x32>
+  800a50:	0f b6 19             	movzbl (%ecx),%ebx
+  800a53:	84 db                	test   %bl,%bl
+  800a55:	75 ec                	jne    800a43 <strlcpy+0x1c>
+  800a57:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a59:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a5c:	29 f0                	sub    %esi,%eax
+}
+  800a5e:	5b                   	pop    %ebx
+  800a5f:	5e                   	pop    %esi
+  800a60:	5d                   	pop    %ebp
+  800a61:	c3                   	ret
+
+00800a62 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a62:	55                   	push   %ebp
+  800a63:	89 e5                	mov    %esp,%ebp
+  800a65:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a68:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a6b:	eb 06                	jmp    800a73 <strcmp+0x11>
+		p++, q++;
+  800a6d:	83 c1 01             	add    $0x1,%ecx
+  800a70:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a73:	0f b6 01             	movzbl (%ecx),%eax
+  800a76:	84 c0                	test   %al,%al
+  800a78:	74 04                	je     800a7e <strcmp+0x1c>
+  800a7a:	3a 02                	cmp    (%edx),%al
+  800a7c:	74 ef                	je     800a6d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a7e:	0f b6 c0             	movzbl %al,%eax
+  800a81:	0f b6 12             	movzbl (%edx),%edx
+  800a84:	29 d0                	sub    %edx,%eax
+}
+  800a86:	5d                   	pop    %ebp
+  800a87:	c3                   	ret
+
+00800a88 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	53                   	push   %ebx
+  800a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a92:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a95:	eb 09                	jmp    800aa0 <strncmp+0x18>
+		n--, p++, q++;
+  800a97:	83 ea 01             	sub    $0x1,%edx
+  800a9a:	83 c0 01             	add    $0x1,%eax
+  800a9d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800aa0:	85 d2                	test   %edx,%edx
+  800aa2:	74 18                	je     800abc <strncmp+0x34>
+  800aa4:	0f b6 18             	movzbl (%eax),%ebx
+  800aa7:	84 db                	test   %bl,%bl
+  800aa9:	74 04                	je     800aaf <strncmp+0x27>
+  800aab:	3a 19                	cmp    (%ecx),%bl
+  800aad:	74 e8                	je     800a97 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aaf:	0f b6 00             	movzbl (%eax),%eax
+  800ab2:	0f b6 11             	movzbl (%ecx),%edx
+  800ab5:	29 d0                	sub    %edx,%eax
+}
+  800ab7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aba:	c9                   	leave
+  800abb:	c3                   	ret
+		return 0;
+  800abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac1:	eb f4                	jmp    800ab7 <strncmp+0x2f>
+
+00800ac3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ac3:	55                   	push   %ebp
+  800ac4:	89 e5                	mov    %esp,%ebp
+  800ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800acd:	eb 03                	jmp    800ad2 <strchr+0xf>
+  800acf:	83 c0 01             	add    $0x1,%eax
+  800ad2:	0f b6 10             	movzbl (%eax),%edx
+  800ad5:	84 d2                	test   %dl,%dl
+  800ad7:	74 06                	je     800adf <strchr+0x1c>
+		if (*s == c)
+  800ad9:	38 ca                	cmp    %cl,%dl
+  800adb:	75 f2                	jne    800acf <strchr+0xc>
+  800add:	eb 05                	jmp    800ae4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800adf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae4:	5d                   	pop    %ebp
+  800ae5:	c3                   	ret
+
+00800ae6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ae6:	55                   	push   %ebp
+  800ae7:	89 e5                	mov    %esp,%ebp
+  800ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aec:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800af0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800af3:	38 ca                	cmp    %cl,%dl
+  800af5:	74 09                	je     800b00 <strfind+0x1a>
+  800af7:	84 d2                	test   %dl,%dl
+  800af9:	74 05                	je     800b00 <strfind+0x1a>
+	for (; *s; s++)
+  800afb:	83 c0 01             	add    $0x1,%eax
+  800afe:	eb f0                	jmp    800af0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b00:	5d                   	pop    %ebp
+  800b01:	c3                   	ret
+
+00800b02 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	57                   	push   %edi
+  800b06:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b09:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b0c:	85 c9                	test   %ecx,%ecx
+  800b0e:	74 20                	je     800b30 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b10:	89 f8                	mov    %edi,%eax
+  800b12:	09 c8                	or     %ecx,%eax
+  800b14:	a8 03                	test   $0x3,%al
+  800b16:	75 12                	jne    800b2a <memset+0x28>
+		c &= 0xFF;
+  800b18:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b1c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b22:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b25:	fc                   	cld
+  800b26:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b28:	eb 06                	jmp    800b30 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b2d:	fc                   	cld
+  800b2e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b30:	89 f8                	mov    %edi,%eax
+  800b32:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b35:	c9                   	leave
+  800b36:	c3                   	ret
+
+00800b37 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	57                   	push   %edi
+  800b3b:	56                   	push   %esi
+  800b3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b45:	39 c6                	cmp    %eax,%esi
+  800b47:	73 32                	jae    800b7b <memmove+0x44>
+  800b49:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b4c:	39 d0                	cmp    %edx,%eax
+  800b4e:	73 2b                	jae    800b7b <memmove+0x44>
+		s += n;
+		d += n;
+  800b50:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b53:	89 d6                	mov    %edx,%esi
+  800b55:	09 fe                	or     %edi,%esi
+  800b57:	09 ce                	or     %ecx,%esi
+  800b59:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b5f:	75 0e                	jne    800b6f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b61:	83 ef 04             	sub    $0x4,%edi
+  800b64:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b67:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b6a:	fd                   	std
+  800b6b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b6d:	eb 09                	jmp    800b78 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b6f:	83 ef 01             	sub    $0x1,%edi
+  800b72:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b75:	fd                   	std
+  800b76:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b78:	fc                   	cld
+  800b79:	eb 1a                	jmp    800b95 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b7b:	89 f2                	mov    %esi,%edx
+  800b7d:	09 c2                	or     %eax,%edx
+  800b7f:	09 ca                	or     %ecx,%edx
+  800b81:	f6 c2 03             	test   $0x3,%dl
+  800b84:	75 0a                	jne    800b90 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b86:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b89:	89 c7                	mov    %eax,%edi
+  800b8b:	fc                   	cld
+  800b8c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b8e:	eb 05                	jmp    800b95 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b90:	89 c7                	mov    %eax,%edi
+  800b92:	fc                   	cld
+  800b93:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b95:	5e                   	pop    %esi
+  800b96:	5f                   	pop    %edi
+  800b97:	5d                   	pop    %ebp
+  800b98:	c3                   	ret
+
+00800b99 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b99:	55                   	push   %ebp
+  800b9a:	89 e5                	mov    %esp,%ebp
+  800b9c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b9f:	ff 75 10             	push   0x10(%ebp)
+  800ba2:	ff 75 0c             	push   0xc(%ebp)
+  800ba5:	ff 75 08             	push   0x8(%ebp)
+  800ba8:	e8 8a ff ff ff       	call   800b37 <memmove>
+}
+  800bad:	c9                   	leave
+  800bae:	c3                   	ret
+
+00800baf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	56                   	push   %esi
+  800bb3:	53                   	push   %ebx
+  800bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bba:	89 c6                	mov    %eax,%esi
+  800bbc:	03 75 10             	add    0x10(%ebp),%esi
+  800bbf:	eb 06                	jmp    800bc7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bc1:	83 c0 01             	add    $0x1,%eax
+  800bc4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bc7:	39 f0                	cmp    %esi,%eax
+  800bc9:	74 14                	je     800bdf <memcmp+0x30>
+		if (*s1 != *s2)
+  800bcb:	0f b6 08             	movzbl (%eax),%ecx
+  800bce:	0f b6 1a             	movzbl (%edx),%ebx
+  800bd1:	38 d9                	cmp    %bl,%cl
+  800bd3:	74 ec                	je     800bc1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bd5:	0f b6 c1             	movzbl %cl,%eax
+  800bd8:	0f b6 db             	movzbl %bl,%ebx
+  800bdb:	29 d8                	sub    %ebx,%eax
+  800bdd:	eb 05                	jmp    800be4 <memcmp+0x35>
+	}
+
+	return 0;
+  800bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800be4:	5b                   	pop    %ebx
+  800be5:	5e                   	pop    %esi
+  800be6:	5d                   	pop    %ebp
+  800be7:	c3                   	ret
+
+00800be8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bf1:	89 c2                	mov    %eax,%edx
+  800bf3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bf6:	eb 03                	jmp    800bfb <memfind+0x13>
+  800bf8:	83 c0 01             	add    $0x1,%eax
+  800bfb:	39 d0                	cmp    %edx,%eax
+  800bfd:	73 04                	jae    800c03 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bff:	38 08                	cmp    %cl,(%eax)
+  800c01:	75 f5                	jne    800bf8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c03:	5d                   	pop    %ebp
+  800c04:	c3                   	ret
+
+00800c05 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	57                   	push   %edi
+  800c09:	56                   	push   %esi
+  800c0a:	53                   	push   %ebx
+  800c0b:	83 ec 1c             	sub    $0x1c,%esp
+  800c0e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c11:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c14:	eb 03                	jmp    800c19 <strtol+0x14>
+		s++;
+  800c16:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c19:	0f b6 06             	movzbl (%esi),%eax
+  800c1c:	3c 20                	cmp    $0x20,%al
+  800c1e:	74 f6                	je     800c16 <strtol+0x11>
+  800c20:	3c 09                	cmp    $0x9,%al
+  800c22:	74 f2                	je     800c16 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c24:	3c 2b                	cmp    $0x2b,%al
+  800c26:	74 43                	je     800c6b <strtol+0x66>
+	int neg = 0;
+  800c28:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c2d:	3c 2d                	cmp    $0x2d,%al
+  800c2f:	74 44                	je     800c75 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c31:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c37:	75 0f                	jne    800c48 <strtol+0x43>
+  800c39:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c3c:	74 41                	je     800c7f <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c3e:	85 ff                	test   %edi,%edi
+  800c40:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c45:	0f 44 f8             	cmove  %eax,%edi
+  800c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c52:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c55:	89 fb                	mov    %edi,%ebx
+  800c57:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c5a:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c5d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c60:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c63:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c66:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c69:	eb 67                	jmp    800cd2 <strtol+0xcd>
+		s++;
+  800c6b:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c73:	eb bc                	jmp    800c31 <strtol+0x2c>
+		s++, neg = 1;
+  800c75:	83 c6 01             	add    $0x1,%esi
+  800c78:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c7d:	eb b2                	jmp    800c31 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7f:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c83:	74 0e                	je     800c93 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c85:	85 ff                	test   %edi,%edi
+  800c87:	75 bf                	jne    800c48 <strtol+0x43>
+		s++, base = 8;
+  800c89:	83 c6 01             	add    $0x1,%esi
+  800c8c:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c91:	eb b5                	jmp    800c48 <strtol+0x43>
+		s += 2, base = 16;
+  800c93:	83 c6 02             	add    $0x2,%esi
+  800c96:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c9b:	eb ab                	jmp    800c48 <strtol+0x43>
+			dig = *s - '0';
+  800c9d:	0f be c9             	movsbl %cl,%ecx
+  800ca0:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800ca3:	39 f9                	cmp    %edi,%ecx
+  800ca5:	7d 59                	jge    800d00 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800ca7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800cab:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cae:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cb1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cb4:	0f af d8             	imul   %eax,%ebx
+  800cb7:	0f af d7             	imul   %edi,%edx
+  800cba:	01 d3                	add    %edx,%ebx
+  800cbc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cbf:	f7 e7                	mul    %edi
+  800cc1:	01 da                	add    %ebx,%edx
+  800cc3:	89 cb                	mov    %ecx,%ebx
+  800cc5:	c1 fb 1f             	sar    $0x1f,%ebx
+  800cc8:	01 c8                	add    %ecx,%eax
+  800cca:	11 da                	adc    %ebx,%edx
+  800ccc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ccf:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd5:	0f b6 08             	movzbl (%eax),%ecx
+  800cd8:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800cdb:	80 fb 09             	cmp    $0x9,%bl
+  800cde:	76 bd                	jbe    800c9d <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce0:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800ce3:	80 fb 19             	cmp    $0x19,%bl
+  800ce6:	77 08                	ja     800cf0 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800ce8:	0f be c9             	movsbl %cl,%ecx
+  800ceb:	83 e9 57             	sub    $0x57,%ecx
+  800cee:	eb b3                	jmp    800ca3 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cf0:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800cf3:	80 fb 19             	cmp    $0x19,%bl
+  800cf6:	77 08                	ja     800d00 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800cf8:	0f be c9             	movsbl %cl,%ecx
+  800cfb:	83 e9 37             	sub    $0x37,%ecx
+  800cfe:	eb a3                	jmp    800ca3 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d00:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d03:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d06:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d09:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d0c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d10:	74 05                	je     800d17 <strtol+0x112>
+		*endptr = (char *) s;
+  800d12:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d15:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d17:	85 c9                	test   %ecx,%ecx
+  800d19:	74 07                	je     800d22 <strtol+0x11d>
+  800d1b:	f7 d8                	neg    %eax
+  800d1d:	83 d2 00             	adc    $0x0,%edx
+  800d20:	f7 da                	neg    %edx
+}
+  800d22:	83 c4 1c             	add    $0x1c,%esp
+  800d25:	5b                   	pop    %ebx
+  800d26:	5e                   	pop    %esi
+  800d27:	5f                   	pop    %edi
+  800d28:	5d                   	pop    %ebp
+  800d29:	c3                   	ret
+
+00800d2a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d2a:	55                   	push   %ebp
+  800d2b:	89 e5                	mov    %esp,%ebp
+  800d2d:	57                   	push   %edi
+  800d2e:	56                   	push   %esi
+  800d2f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d30:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800d37:	74 18                	je     800d51 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d44:	89 c3                	mov    %eax,%ebx
+  800d46:	89 c7                	mov    %eax,%edi
+  800d48:	89 c6                	mov    %eax,%esi
+  800d4a:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d4c:	5b                   	pop    %ebx
+  800d4d:	5e                   	pop    %esi
+  800d4e:	5f                   	pop    %edi
+  800d4f:	5d                   	pop    %ebp
+  800d50:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5c:	89 c3                	mov    %eax,%ebx
+  800d5e:	89 c7                	mov    %eax,%edi
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	8d 35 6b 0d 80 00    	lea    0x800d6b,%esi
+  800d69:	0f 34                	sysenter
+  800d6b:	5d                   	pop    %ebp
+		goto out;
+  800d6c:	eb de                	jmp    800d4c <sys_cputs+0x22>
+
+00800d6e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	56                   	push   %esi
+  800d73:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d74:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800d7b:	74 19                	je     800d96 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d82:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d87:	89 d1                	mov    %edx,%ecx
+  800d89:	89 d3                	mov    %edx,%ebx
+  800d8b:	89 d7                	mov    %edx,%edi
+  800d8d:	89 d6                	mov    %edx,%esi
+  800d8f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d91:	5b                   	pop    %ebx
+  800d92:	5e                   	pop    %esi
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da0:	89 d1                	mov    %edx,%ecx
+  800da2:	89 d3                	mov    %edx,%ebx
+  800da4:	89 d7                	mov    %edx,%edi
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	8d 35 b1 0d 80 00    	lea    0x800db1,%esi
+  800daf:	0f 34                	sysenter
+  800db1:	5d                   	pop    %ebp
+		goto out;
+  800db2:	eb dd                	jmp    800d91 <sys_cgetc+0x23>
+
+00800db4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	57                   	push   %edi
+  800db8:	56                   	push   %esi
+  800db9:	53                   	push   %ebx
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dbd:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800dc4:	74 21                	je     800de7 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800dc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dcb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd3:	89 cb                	mov    %ecx,%ebx
+  800dd5:	89 cf                	mov    %ecx,%edi
+  800dd7:	89 ce                	mov    %ecx,%esi
+  800dd9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	7f 27                	jg     800e06 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800de7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800def:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df4:	89 cb                	mov    %ecx,%ebx
+  800df6:	89 cf                	mov    %ecx,%edi
+  800df8:	55                   	push   %ebp
+  800df9:	89 e5                	mov    %esp,%ebp
+  800dfb:	8d 35 03 0e 80 00    	lea    0x800e03,%esi
+  800e01:	0f 34                	sysenter
+  800e03:	5d                   	pop    %ebp
+		goto out;
+  800e04:	eb d5                	jmp    800ddb <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e06:	83 ec 0c             	sub    $0xc,%esp
+  800e09:	50                   	push   %eax
+  800e0a:	6a 03                	push   $0x3
+  800e0c:	68 6b 39 80 00       	push   $0x80396b
+  800e11:	6a 3f                	push   $0x3f
+  800e13:	68 88 39 80 00       	push   $0x803988
+  800e18:	e8 71 f4 ff ff       	call   80028e <_panic>
+
+00800e1d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e1d:	55                   	push   %ebp
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	57                   	push   %edi
+  800e21:	56                   	push   %esi
+  800e22:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e23:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800e2a:	74 19                	je     800e45 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e31:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e36:	89 d1                	mov    %edx,%ecx
+  800e38:	89 d3                	mov    %edx,%ebx
+  800e3a:	89 d7                	mov    %edx,%edi
+  800e3c:	89 d6                	mov    %edx,%esi
+  800e3e:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e40:	5b                   	pop    %ebx
+  800e41:	5e                   	pop    %esi
+  800e42:	5f                   	pop    %edi
+  800e43:	5d                   	pop    %ebp
+  800e44:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e4f:	89 d1                	mov    %edx,%ecx
+  800e51:	89 d3                	mov    %edx,%ebx
+  800e53:	89 d7                	mov    %edx,%edi
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	8d 35 60 0e 80 00    	lea    0x800e60,%esi
+  800e5e:	0f 34                	sysenter
+  800e60:	5d                   	pop    %ebp
+		goto out;
+  800e61:	eb dd                	jmp    800e40 <sys_getenvid+0x23>
+
+00800e63 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e69:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800e70:	74 19                	je     800e8b <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e77:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e7c:	89 d1                	mov    %edx,%ecx
+  800e7e:	89 d3                	mov    %edx,%ebx
+  800e80:	89 d7                	mov    %edx,%edi
+  800e82:	89 d6                	mov    %edx,%esi
+  800e84:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e86:	5b                   	pop    %ebx
+  800e87:	5e                   	pop    %esi
+  800e88:	5f                   	pop    %edi
+  800e89:	5d                   	pop    %ebp
+  800e8a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e90:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e95:	89 d1                	mov    %edx,%ecx
+  800e97:	89 d3                	mov    %edx,%ebx
+  800e99:	89 d7                	mov    %edx,%edi
+  800e9b:	55                   	push   %ebp
+  800e9c:	89 e5                	mov    %esp,%ebp
+  800e9e:	8d 35 a6 0e 80 00    	lea    0x800ea6,%esi
+  800ea4:	0f 34                	sysenter
+  800ea6:	5d                   	pop    %ebp
+		goto out;
+  800ea7:	eb dd                	jmp    800e86 <sys_yield+0x23>
+
+00800ea9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+  800eaf:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eb2:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800eb9:	74 23                	je     800ede <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800ebb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ec5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ece:	89 f7                	mov    %esi,%edi
+  800ed0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	7f 29                	jg     800eff <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ee9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	8d 35 fc 0e 80 00    	lea    0x800efc,%esi
+  800efa:	0f 34                	sysenter
+  800efc:	5d                   	pop    %ebp
+		goto out;
+  800efd:	eb d3                	jmp    800ed2 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eff:	83 ec 0c             	sub    $0xc,%esp
+  800f02:	50                   	push   %eax
+  800f03:	6a 04                	push   $0x4
+  800f05:	68 6b 39 80 00       	push   $0x80396b
+  800f0a:	6a 3f                	push   $0x3f
+  800f0c:	68 88 39 80 00       	push   $0x803988
+  800f11:	e8 78 f3 ff ff       	call   80028e <_panic>
+
+00800f16 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f16:	55                   	push   %ebp
+  800f17:	89 e5                	mov    %esp,%ebp
+  800f19:	57                   	push   %edi
+  800f1a:	56                   	push   %esi
+  800f1b:	53                   	push   %ebx
+  800f1c:	83 ec 0c             	sub    $0xc,%esp
+  800f1f:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f22:	85 f6                	test   %esi,%esi
+  800f24:	75 09                	jne    800f2f <sys_page_map+0x19>
+  800f26:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800f2d:	74 1f                	je     800f4e <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f2f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f3d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f40:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f42:	85 c0                	test   %eax,%eax
+  800f44:	7f 27                	jg     800f6d <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f49:	5b                   	pop    %ebx
+  800f4a:	5e                   	pop    %esi
+  800f4b:	5f                   	pop    %edi
+  800f4c:	5d                   	pop    %ebp
+  800f4d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5f:	55                   	push   %ebp
+  800f60:	89 e5                	mov    %esp,%ebp
+  800f62:	8d 35 6a 0f 80 00    	lea    0x800f6a,%esi
+  800f68:	0f 34                	sysenter
+  800f6a:	5d                   	pop    %ebp
+		goto out;
+  800f6b:	eb d5                	jmp    800f42 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+  800f70:	50                   	push   %eax
+  800f71:	6a 05                	push   $0x5
+  800f73:	68 6b 39 80 00       	push   $0x80396b
+  800f78:	6a 3f                	push   $0x3f
+  800f7a:	68 88 39 80 00       	push   $0x803988
+  800f7f:	e8 0a f3 ff ff       	call   80028e <_panic>
+
+00800f84 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	56                   	push   %esi
+  800f89:	53                   	push   %ebx
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f8d:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800f94:	74 22                	je     800fb8 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fa0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa6:	89 df                	mov    %ebx,%edi
+  800fa8:	89 de                	mov    %ebx,%esi
+  800faa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	7f 28                	jg     800fd8 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fc8:	89 df                	mov    %ebx,%edi
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	8d 35 d5 0f 80 00    	lea    0x800fd5,%esi
+  800fd3:	0f 34                	sysenter
+  800fd5:	5d                   	pop    %ebp
+		goto out;
+  800fd6:	eb d4                	jmp    800fac <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd8:	83 ec 0c             	sub    $0xc,%esp
+  800fdb:	50                   	push   %eax
+  800fdc:	6a 06                	push   $0x6
+  800fde:	68 6b 39 80 00       	push   $0x80396b
+  800fe3:	6a 3f                	push   $0x3f
+  800fe5:	68 88 39 80 00       	push   $0x803988
+  800fea:	e8 9f f2 ff ff       	call   80028e <_panic>
+
+00800fef <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fef:	55                   	push   %ebp
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	57                   	push   %edi
+  800ff3:	56                   	push   %esi
+  800ff4:	53                   	push   %ebx
+  800ff5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ff8:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  800fff:	74 22                	je     801023 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801006:	b8 08 00 00 00       	mov    $0x8,%eax
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	89 df                	mov    %ebx,%edi
+  801013:	89 de                	mov    %ebx,%esi
+  801015:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801017:	85 c0                	test   %eax,%eax
+  801019:	7f 28                	jg     801043 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80101b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801023:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801033:	89 df                	mov    %ebx,%edi
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	8d 35 40 10 80 00    	lea    0x801040,%esi
+  80103e:	0f 34                	sysenter
+  801040:	5d                   	pop    %ebp
+		goto out;
+  801041:	eb d4                	jmp    801017 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801043:	83 ec 0c             	sub    $0xc,%esp
+  801046:	50                   	push   %eax
+  801047:	6a 08                	push   $0x8
+  801049:	68 6b 39 80 00       	push   $0x80396b
+  80104e:	6a 3f                	push   $0x3f
+  801050:	68 88 39 80 00       	push   $0x803988
+  801055:	e8 34 f2 ff ff       	call   80028e <_panic>
+
+0080105a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	57                   	push   %edi
+  80105e:	56                   	push   %esi
+  80105f:	53                   	push   %ebx
+  801060:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801063:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80106a:	74 22                	je     80108e <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80106c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801071:	b8 09 00 00 00       	mov    $0x9,%eax
+  801076:	8b 55 08             	mov    0x8(%ebp),%edx
+  801079:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107c:	89 df                	mov    %ebx,%edi
+  80107e:	89 de                	mov    %ebx,%esi
+  801080:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801082:	85 c0                	test   %eax,%eax
+  801084:	7f 28                	jg     8010ae <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80108e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801093:	8b 55 08             	mov    0x8(%ebp),%edx
+  801096:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801099:	b8 09 00 00 00       	mov    $0x9,%eax
+  80109e:	89 df                	mov    %ebx,%edi
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	8d 35 ab 10 80 00    	lea    0x8010ab,%esi
+  8010a9:	0f 34                	sysenter
+  8010ab:	5d                   	pop    %ebp
+		goto out;
+  8010ac:	eb d4                	jmp    801082 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ae:	83 ec 0c             	sub    $0xc,%esp
+  8010b1:	50                   	push   %eax
+  8010b2:	6a 09                	push   $0x9
+  8010b4:	68 6b 39 80 00       	push   $0x80396b
+  8010b9:	6a 3f                	push   $0x3f
+  8010bb:	68 88 39 80 00       	push   $0x803988
+  8010c0:	e8 c9 f1 ff ff       	call   80028e <_panic>
+
+008010c5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	57                   	push   %edi
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010ce:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8010d5:	74 22                	je     8010f9 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8010d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e7:	89 df                	mov    %ebx,%edi
+  8010e9:	89 de                	mov    %ebx,%esi
+  8010eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ed:	85 c0                	test   %eax,%eax
+  8010ef:	7f 28                	jg     801119 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f4:	5b                   	pop    %ebx
+  8010f5:	5e                   	pop    %esi
+  8010f6:	5f                   	pop    %edi
+  8010f7:	5d                   	pop    %ebp
+  8010f8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801104:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801109:	89 df                	mov    %ebx,%edi
+  80110b:	55                   	push   %ebp
+  80110c:	89 e5                	mov    %esp,%ebp
+  80110e:	8d 35 16 11 80 00    	lea    0x801116,%esi
+  801114:	0f 34                	sysenter
+  801116:	5d                   	pop    %ebp
+		goto out;
+  801117:	eb d4                	jmp    8010ed <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  80111c:	50                   	push   %eax
+  80111d:	6a 0a                	push   $0xa
+  80111f:	68 6b 39 80 00       	push   $0x80396b
+  801124:	6a 3f                	push   $0x3f
+  801126:	68 88 39 80 00       	push   $0x803988
+  80112b:	e8 5e f1 ff ff       	call   80028e <_panic>
+
+00801130 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801130:	55                   	push   %ebp
+  801131:	89 e5                	mov    %esp,%ebp
+  801133:	57                   	push   %edi
+  801134:	56                   	push   %esi
+  801135:	53                   	push   %ebx
+  801136:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801139:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801140:	74 22                	je     801164 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801142:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801147:	b8 17 00 00 00       	mov    $0x17,%eax
+  80114c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801152:	89 df                	mov    %ebx,%edi
+  801154:	89 de                	mov    %ebx,%esi
+  801156:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	7f 28                	jg     801184 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80115c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801164:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801169:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801174:	89 df                	mov    %ebx,%edi
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	8d 35 81 11 80 00    	lea    0x801181,%esi
+  80117f:	0f 34                	sysenter
+  801181:	5d                   	pop    %ebp
+		goto out;
+  801182:	eb d4                	jmp    801158 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801184:	83 ec 0c             	sub    $0xc,%esp
+  801187:	50                   	push   %eax
+  801188:	6a 17                	push   $0x17
+  80118a:	68 6b 39 80 00       	push   $0x80396b
+  80118f:	6a 3f                	push   $0x3f
+  801191:	68 88 39 80 00       	push   $0x803988
+  801196:	e8 f3 f0 ff ff       	call   80028e <_panic>
+
+0080119b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011a4:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8011ab:	74 22                	je     8011cf <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8011ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bd:	89 df                	mov    %ebx,%edi
+  8011bf:	89 de                	mov    %ebx,%esi
+  8011c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c3:	85 c0                	test   %eax,%eax
+  8011c5:	7f 28                	jg     8011ef <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8011c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ca:	5b                   	pop    %ebx
+  8011cb:	5e                   	pop    %esi
+  8011cc:	5f                   	pop    %edi
+  8011cd:	5d                   	pop    %ebp
+  8011ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011da:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011df:	89 df                	mov    %ebx,%edi
+  8011e1:	55                   	push   %ebp
+  8011e2:	89 e5                	mov    %esp,%ebp
+  8011e4:	8d 35 ec 11 80 00    	lea    0x8011ec,%esi
+  8011ea:	0f 34                	sysenter
+  8011ec:	5d                   	pop    %ebp
+		goto out;
+  8011ed:	eb d4                	jmp    8011c3 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  8011f2:	50                   	push   %eax
+  8011f3:	6a 18                	push   $0x18
+  8011f5:	68 6b 39 80 00       	push   $0x80396b
+  8011fa:	6a 3f                	push   $0x3f
+  8011fc:	68 88 39 80 00       	push   $0x803988
+  801201:	e8 88 f0 ff ff       	call   80028e <_panic>
+
+00801206 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80120c:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801213:	74 1d                	je     801232 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801215:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80121a:	be 00 00 00 00       	mov    $0x0,%esi
+  80121f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801222:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801225:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801228:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80122b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80122d:	5b                   	pop    %ebx
+  80122e:	5e                   	pop    %esi
+  80122f:	5f                   	pop    %edi
+  801230:	5d                   	pop    %ebp
+  801231:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801232:	8b 55 08             	mov    0x8(%ebp),%edx
+  801235:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801238:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80123d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801240:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	8d 35 4e 12 80 00    	lea    0x80124e,%esi
+  80124c:	0f 34                	sysenter
+  80124e:	5d                   	pop    %ebp
+		goto out;
+  80124f:	eb dc                	jmp    80122d <sys_ipc_try_send+0x27>
+
+00801251 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	57                   	push   %edi
+  801255:	56                   	push   %esi
+  801256:	53                   	push   %ebx
+  801257:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80125a:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801261:	74 21                	je     801284 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801263:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801268:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80126d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801270:	89 cb                	mov    %ecx,%ebx
+  801272:	89 cf                	mov    %ecx,%edi
+  801274:	89 ce                	mov    %ecx,%esi
+  801276:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801278:	85 c0                	test   %eax,%eax
+  80127a:	7f 27                	jg     8012a3 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80127c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801284:	8b 55 08             	mov    0x8(%ebp),%edx
+  801287:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80128c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801291:	89 cb                	mov    %ecx,%ebx
+  801293:	89 cf                	mov    %ecx,%edi
+  801295:	55                   	push   %ebp
+  801296:	89 e5                	mov    %esp,%ebp
+  801298:	8d 35 a0 12 80 00    	lea    0x8012a0,%esi
+  80129e:	0f 34                	sysenter
+  8012a0:	5d                   	pop    %ebp
+		goto out;
+  8012a1:	eb d5                	jmp    801278 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a3:	83 ec 0c             	sub    $0xc,%esp
+  8012a6:	50                   	push   %eax
+  8012a7:	6a 0d                	push   $0xd
+  8012a9:	68 6b 39 80 00       	push   $0x80396b
+  8012ae:	6a 3f                	push   $0x3f
+  8012b0:	68 88 39 80 00       	push   $0x803988
+  8012b5:	e8 d4 ef ff ff       	call   80028e <_panic>
+
+008012ba <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	57                   	push   %edi
+  8012be:	56                   	push   %esi
+  8012bf:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012c0:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8012c7:	74 1b                	je     8012e4 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8012c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d9:	89 df                	mov    %ebx,%edi
+  8012db:	89 de                	mov    %ebx,%esi
+  8012dd:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8012df:	5b                   	pop    %ebx
+  8012e0:	5e                   	pop    %esi
+  8012e1:	5f                   	pop    %edi
+  8012e2:	5d                   	pop    %ebp
+  8012e3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ef:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012f4:	89 df                	mov    %ebx,%edi
+  8012f6:	55                   	push   %ebp
+  8012f7:	89 e5                	mov    %esp,%ebp
+  8012f9:	8d 35 01 13 80 00    	lea    0x801301,%esi
+  8012ff:	0f 34                	sysenter
+  801301:	5d                   	pop    %ebp
+		goto out;
+  801302:	eb db                	jmp    8012df <sys_ipc_recv_until+0x25>
+
+00801304 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801304:	55                   	push   %ebp
+  801305:	89 e5                	mov    %esp,%ebp
+  801307:	57                   	push   %edi
+  801308:	56                   	push   %esi
+  801309:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80130a:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801311:	74 19                	je     80132c <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801313:	ba 00 00 00 00       	mov    $0x0,%edx
+  801318:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80131d:	89 d1                	mov    %edx,%ecx
+  80131f:	89 d3                	mov    %edx,%ebx
+  801321:	89 d7                	mov    %edx,%edi
+  801323:	89 d6                	mov    %edx,%esi
+  801325:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801327:	5b                   	pop    %ebx
+  801328:	5e                   	pop    %esi
+  801329:	5f                   	pop    %edi
+  80132a:	5d                   	pop    %ebp
+  80132b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80132c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801331:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801336:	89 d1                	mov    %edx,%ecx
+  801338:	89 d3                	mov    %edx,%ebx
+  80133a:	89 d7                	mov    %edx,%edi
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	8d 35 47 13 80 00    	lea    0x801347,%esi
+  801345:	0f 34                	sysenter
+  801347:	5d                   	pop    %ebp
+		goto out;
+  801348:	eb dd                	jmp    801327 <sys_time_msec+0x23>
+
+0080134a <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80134a:	55                   	push   %ebp
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	57                   	push   %edi
+  80134e:	56                   	push   %esi
+  80134f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801350:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801357:	74 1a                	je     801373 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801359:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80135e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801363:	8b 55 08             	mov    0x8(%ebp),%edx
+  801366:	89 cb                	mov    %ecx,%ebx
+  801368:	89 cf                	mov    %ecx,%edi
+  80136a:	89 ce                	mov    %ecx,%esi
+  80136c:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80136e:	5b                   	pop    %ebx
+  80136f:	5e                   	pop    %esi
+  801370:	5f                   	pop    %edi
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801373:	8b 55 08             	mov    0x8(%ebp),%edx
+  801376:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137b:	b8 10 00 00 00       	mov    $0x10,%eax
+  801380:	89 cb                	mov    %ecx,%ebx
+  801382:	89 cf                	mov    %ecx,%edi
+  801384:	55                   	push   %ebp
+  801385:	89 e5                	mov    %esp,%ebp
+  801387:	8d 35 8f 13 80 00    	lea    0x80138f,%esi
+  80138d:	0f 34                	sysenter
+  80138f:	5d                   	pop    %ebp
+		goto out;
+  801390:	eb dc                	jmp    80136e <sys_sleep_until+0x24>
+
+00801392 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	57                   	push   %edi
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801398:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80139f:	74 1a                	je     8013bb <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8013a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a6:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ae:	89 cb                	mov    %ecx,%ebx
+  8013b0:	89 cf                	mov    %ecx,%edi
+  8013b2:	89 ce                	mov    %ecx,%esi
+  8013b4:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8013b6:	5b                   	pop    %ebx
+  8013b7:	5e                   	pop    %esi
+  8013b8:	5f                   	pop    %edi
+  8013b9:	5d                   	pop    %ebp
+  8013ba:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013c8:	89 cb                	mov    %ecx,%ebx
+  8013ca:	89 cf                	mov    %ecx,%edi
+  8013cc:	55                   	push   %ebp
+  8013cd:	89 e5                	mov    %esp,%ebp
+  8013cf:	8d 35 d7 13 80 00    	lea    0x8013d7,%esi
+  8013d5:	0f 34                	sysenter
+  8013d7:	5d                   	pop    %ebp
+		goto out;
+  8013d8:	eb dc                	jmp    8013b6 <sys_env_print_stats+0x24>
+
+008013da <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	57                   	push   %edi
+  8013de:	56                   	push   %esi
+  8013df:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013e0:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8013e7:	74 1b                	je     801404 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8013e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ee:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f9:	89 df                	mov    %ebx,%edi
+  8013fb:	89 de                	mov    %ebx,%esi
+  8013fd:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8013ff:	5b                   	pop    %ebx
+  801400:	5e                   	pop    %esi
+  801401:	5f                   	pop    %edi
+  801402:	5d                   	pop    %ebp
+  801403:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801404:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801414:	89 df                	mov    %ebx,%edi
+  801416:	55                   	push   %ebp
+  801417:	89 e5                	mov    %esp,%ebp
+  801419:	8d 35 21 14 80 00    	lea    0x801421,%esi
+  80141f:	0f 34                	sysenter
+  801421:	5d                   	pop    %ebp
+		goto out;
+  801422:	eb db                	jmp    8013ff <sys_perf+0x25>
+
+00801424 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801424:	55                   	push   %ebp
+  801425:	89 e5                	mov    %esp,%ebp
+  801427:	57                   	push   %edi
+  801428:	56                   	push   %esi
+  801429:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80142a:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801431:	74 19                	je     80144c <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801433:	ba 00 00 00 00       	mov    $0x0,%edx
+  801438:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80143d:	89 d1                	mov    %edx,%ecx
+  80143f:	89 d3                	mov    %edx,%ebx
+  801441:	89 d7                	mov    %edx,%edi
+  801443:	89 d6                	mov    %edx,%esi
+  801445:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801447:	5b                   	pop    %ebx
+  801448:	5e                   	pop    %esi
+  801449:	5f                   	pop    %edi
+  80144a:	5d                   	pop    %ebp
+  80144b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80144c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801451:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801456:	89 d1                	mov    %edx,%ecx
+  801458:	89 d3                	mov    %edx,%ebx
+  80145a:	89 d7                	mov    %edx,%edi
+  80145c:	55                   	push   %ebp
+  80145d:	89 e5                	mov    %esp,%ebp
+  80145f:	8d 35 67 14 80 00    	lea    0x801467,%esi
+  801465:	0f 34                	sysenter
+  801467:	5d                   	pop    %ebp
+		goto out;
+  801468:	eb dd                	jmp    801447 <sys_fork+0x23>
+
+0080146a <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	57                   	push   %edi
+  80146e:	56                   	push   %esi
+  80146f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801470:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801477:	74 1c                	je     801495 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801479:	be 00 00 00 00       	mov    $0x0,%esi
+  80147e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801483:	8b 55 08             	mov    0x8(%ebp),%edx
+  801486:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801489:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80148c:	89 f7                	mov    %esi,%edi
+  80148e:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801490:	5b                   	pop    %ebx
+  801491:	5e                   	pop    %esi
+  801492:	5f                   	pop    %edi
+  801493:	5d                   	pop    %ebp
+  801494:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	8d 35 b3 14 80 00    	lea    0x8014b3,%esi
+  8014b1:	0f 34                	sysenter
+  8014b3:	5d                   	pop    %ebp
+		goto out;
+  8014b4:	eb da                	jmp    801490 <sys_thread_create+0x26>
+
+008014b6 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8014b6:	55                   	push   %ebp
+  8014b7:	89 e5                	mov    %esp,%ebp
+  8014b9:	57                   	push   %edi
+  8014ba:	56                   	push   %esi
+  8014bb:	53                   	push   %ebx
+  8014bc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014bf:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8014c6:	74 24                	je     8014ec <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8014c8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014db:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	7f 27                	jg     80150b <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8014e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e7:	5b                   	pop    %ebx
+  8014e8:	5e                   	pop    %esi
+  8014e9:	5f                   	pop    %edi
+  8014ea:	5d                   	pop    %ebp
+  8014eb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	8d 35 08 15 80 00    	lea    0x801508,%esi
+  801506:	0f 34                	sysenter
+  801508:	5d                   	pop    %ebp
+		goto out;
+  801509:	eb d5                	jmp    8014e0 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80150b:	83 ec 0c             	sub    $0xc,%esp
+  80150e:	50                   	push   %eax
+  80150f:	6a 1f                	push   $0x1f
+  801511:	68 6b 39 80 00       	push   $0x80396b
+  801516:	6a 3f                	push   $0x3f
+  801518:	68 88 39 80 00       	push   $0x803988
+  80151d:	e8 6c ed ff ff       	call   80028e <_panic>
+
+00801522 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	57                   	push   %edi
+  801526:	56                   	push   %esi
+  801527:	53                   	push   %ebx
+  801528:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80152b:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801532:	74 23                	je     801557 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801534:	be 00 00 00 00       	mov    $0x0,%esi
+  801539:	b8 20 00 00 00       	mov    $0x20,%eax
+  80153e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801541:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801544:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801547:	89 f7                	mov    %esi,%edi
+  801549:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80154b:	85 c0                	test   %eax,%eax
+  80154d:	7f 29                	jg     801578 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80154f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801552:	5b                   	pop    %ebx
+  801553:	5e                   	pop    %esi
+  801554:	5f                   	pop    %edi
+  801555:	5d                   	pop    %ebp
+  801556:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155d:	b8 20 00 00 00       	mov    $0x20,%eax
+  801562:	bf 00 00 00 00       	mov    $0x0,%edi
+  801567:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	8d 35 75 15 80 00    	lea    0x801575,%esi
+  801573:	0f 34                	sysenter
+  801575:	5d                   	pop    %ebp
+		goto out;
+  801576:	eb d3                	jmp    80154b <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801578:	83 ec 0c             	sub    $0xc,%esp
+  80157b:	50                   	push   %eax
+  80157c:	6a 20                	push   $0x20
+  80157e:	68 6b 39 80 00       	push   $0x80396b
+  801583:	6a 3f                	push   $0x3f
+  801585:	68 88 39 80 00       	push   $0x803988
+  80158a:	e8 ff ec ff ff       	call   80028e <_panic>
+
+0080158f <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80158f:	55                   	push   %ebp
+  801590:	89 e5                	mov    %esp,%ebp
+  801592:	57                   	push   %edi
+  801593:	56                   	push   %esi
+  801594:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801595:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80159c:	74 1b                	je     8015b9 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80159e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ae:	89 df                	mov    %ebx,%edi
+  8015b0:	89 de                	mov    %ebx,%esi
+  8015b2:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8015b4:	5b                   	pop    %ebx
+  8015b5:	5e                   	pop    %esi
+  8015b6:	5f                   	pop    %edi
+  8015b7:	5d                   	pop    %ebp
+  8015b8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015c9:	89 df                	mov    %ebx,%edi
+  8015cb:	55                   	push   %ebp
+  8015cc:	89 e5                	mov    %esp,%ebp
+  8015ce:	8d 35 d6 15 80 00    	lea    0x8015d6,%esi
+  8015d4:	0f 34                	sysenter
+  8015d6:	5d                   	pop    %ebp
+		goto out;
+  8015d7:	eb db                	jmp    8015b4 <sys_batch+0x25>
+
+008015d9 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  8015dc:	57                   	push   %edi
+  8015dd:	56                   	push   %esi
+  8015de:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015df:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8015e6:	74 1a                	je     801602 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8015e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ed:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f5:	89 cb                	mov    %ecx,%ebx
+  8015f7:	89 cf                	mov    %ecx,%edi
+  8015f9:	89 ce                	mov    %ecx,%esi
+  8015fb:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8015fd:	5b                   	pop    %ebx
+  8015fe:	5e                   	pop    %esi
+  8015ff:	5f                   	pop    %edi
+  801600:	5d                   	pop    %ebp
+  801601:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801602:	8b 55 08             	mov    0x8(%ebp),%edx
+  801605:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80160a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80160f:	89 cb                	mov    %ecx,%ebx
+  801611:	89 cf                	mov    %ecx,%edi
+  801613:	55                   	push   %ebp
+  801614:	89 e5                	mov    %esp,%ebp
+  801616:	8d 35 1e 16 80 00    	lea    0x80161e,%esi
+  80161c:	0f 34                	sysenter
+  80161e:	5d                   	pop    %ebp
+		goto out;
+  80161f:	eb dc                	jmp    8015fd <sys_trace_ctl+0x24>
+
+00801621 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	57                   	push   %edi
+  801625:	56                   	push   %esi
+  801626:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801627:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80162e:	74 1c                	je     80164c <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801630:	be 00 00 00 00       	mov    $0x0,%esi
+  801635:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80163a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801640:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801643:	89 f7                	mov    %esi,%edi
+  801645:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801647:	5b                   	pop    %ebx
+  801648:	5e                   	pop    %esi
+  801649:	5f                   	pop    %edi
+  80164a:	5d                   	pop    %ebp
+  80164b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80164c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80164f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801652:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801657:	bf 00 00 00 00       	mov    $0x0,%edi
+  80165c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80165f:	55                   	push   %ebp
+  801660:	89 e5                	mov    %esp,%ebp
+  801662:	8d 35 6a 16 80 00    	lea    0x80166a,%esi
+  801668:	0f 34                	sysenter
+  80166a:	5d                   	pop    %ebp
+		goto out;
+  80166b:	eb da                	jmp    801647 <sys_trace_read+0x26>
+
+0080166d <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+  801670:	57                   	push   %edi
+  801671:	56                   	push   %esi
+  801672:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801673:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80167a:	74 1c                	je     801698 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80167c:	be 00 00 00 00       	mov    $0x0,%esi
+  801681:	b8 21 00 00 00       	mov    $0x21,%eax
+  801686:	8b 55 08             	mov    0x8(%ebp),%edx
+  801689:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80168f:	89 f7                	mov    %esi,%edi
+  801691:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801693:	5b                   	pop    %ebx
+  801694:	5e                   	pop    %esi
+  801695:	5f                   	pop    %edi
+  801696:	5d                   	pop    %ebp
+  801697:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801698:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169e:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016ab:	55                   	push   %ebp
+  8016ac:	89 e5                	mov    %esp,%ebp
+  8016ae:	8d 35 b6 16 80 00    	lea    0x8016b6,%esi
+  8016b4:	0f 34                	sysenter
+  8016b6:	5d                   	pop    %ebp
+		goto out;
+  8016b7:	eb da                	jmp    801693 <sys_meminfo+0x26>
+
+008016b9 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	57                   	push   %edi
+  8016bd:	56                   	push   %esi
+  8016be:	53                   	push   %ebx
+  8016bf:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8016c2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8016c6:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8016cd:	74 1f                	je     8016ee <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8016cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d4:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016dc:	89 df                	mov    %ebx,%edi
+  8016de:	89 de                	mov    %ebx,%esi
+  8016e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	7f 25                	jg     80170b <sys_env_set_ksm+0x52>
+}
+  8016e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e9:	5b                   	pop    %ebx
+  8016ea:	5e                   	pop    %esi
+  8016eb:	5f                   	pop    %edi
+  8016ec:	5d                   	pop    %ebp
+  8016ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f6:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016fb:	89 df                	mov    %ebx,%edi
+  8016fd:	55                   	push   %ebp
+  8016fe:	89 e5                	mov    %esp,%ebp
+  801700:	8d 35 08 17 80 00    	lea    0x801708,%esi
+  801706:	0f 34                	sysenter
+  801708:	5d                   	pop    %ebp
+		goto out;
+  801709:	eb d7                	jmp    8016e2 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80170b:	83 ec 0c             	sub    $0xc,%esp
+  80170e:	50                   	push   %eax
+  80170f:	6a 22                	push   $0x22
+  801711:	68 6b 39 80 00       	push   $0x80396b
+  801716:	6a 3f                	push   $0x3f
+  801718:	68 88 39 80 00       	push   $0x803988
+  80171d:	e8 6c eb ff ff       	call   80028e <_panic>
+
+00801722 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801722:	55                   	push   %ebp
+  801723:	89 e5                	mov    %esp,%ebp
+  801725:	57                   	push   %edi
+  801726:	56                   	push   %esi
+  801727:	53                   	push   %ebx
+  801728:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80172b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80172e:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801735:	74 24                	je     80175b <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801737:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80173c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801741:	89 cb                	mov    %ecx,%ebx
+  801743:	89 cf                	mov    %ecx,%edi
+  801745:	89 ce                	mov    %ecx,%esi
+  801747:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	7f 2a                	jg     801777 <sys_time_nsec+0x55>
+	return ns;
+}
+  80174d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801750:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801753:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801756:	5b                   	pop    %ebx
+  801757:	5e                   	pop    %esi
+  801758:	5f                   	pop    %edi
+  801759:	5d                   	pop    %ebp
+  80175a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80175b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801760:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801765:	89 cb                	mov    %ecx,%ebx
+  801767:	89 cf                	mov    %ecx,%edi
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	8d 35 74 17 80 00    	lea    0x801774,%esi
+  801772:	0f 34                	sysenter
+  801774:	5d                   	pop    %ebp
+		goto out;
+  801775:	eb d2                	jmp    801749 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801777:	83 ec 0c             	sub    $0xc,%esp
+  80177a:	50                   	push   %eax
+  80177b:	6a 0f                	push   $0xf
+  80177d:	68 6b 39 80 00       	push   $0x80396b
+  801782:	6a 3f                	push   $0x3f
+  801784:	68 88 39 80 00       	push   $0x803988
+  801789:	e8 00 eb ff ff       	call   80028e <_panic>
+
+0080178e <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	57                   	push   %edi
+  801792:	56                   	push   %esi
+  801793:	53                   	push   %ebx
+  801794:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801797:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80179e:	74 22                	je     8017c2 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8017a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b0:	89 df                	mov    %ebx,%edi
+  8017b2:	89 de                	mov    %ebx,%esi
+  8017b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017b6:	85 c0                	test   %eax,%eax
+  8017b8:	7f 28                	jg     8017e2 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8017ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017bd:	5b                   	pop    %ebx
+  8017be:	5e                   	pop    %esi
+  8017bf:	5f                   	pop    %edi
+  8017c0:	5d                   	pop    %ebp
+  8017c1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017cd:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017d2:	89 df                	mov    %ebx,%edi
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	8d 35 df 17 80 00    	lea    0x8017df,%esi
+  8017dd:	0f 34                	sysenter
+  8017df:	5d                   	pop    %ebp
+		goto out;
+  8017e0:	eb d4                	jmp    8017b6 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017e2:	83 ec 0c             	sub    $0xc,%esp
+  8017e5:	50                   	push   %eax
+  8017e6:	6a 12                	push   $0x12
+  8017e8:	68 6b 39 80 00       	push   $0x80396b
+  8017ed:	6a 3f                	push   $0x3f
+  8017ef:	68 88 39 80 00       	push   $0x803988
+  8017f4:	e8 95 ea ff ff       	call   80028e <_panic>
+
+008017f9 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8017f9:	55                   	push   %ebp
+  8017fa:	89 e5                	mov    %esp,%ebp
+  8017fc:	57                   	push   %edi
+  8017fd:	56                   	push   %esi
+  8017fe:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017ff:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801806:	74 1b                	je     801823 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801808:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801812:	8b 55 08             	mov    0x8(%ebp),%edx
+  801815:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801818:	89 df                	mov    %ebx,%edi
+  80181a:	89 de                	mov    %ebx,%esi
+  80181c:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80181e:	5b                   	pop    %ebx
+  80181f:	5e                   	pop    %esi
+  801820:	5f                   	pop    %edi
+  801821:	5d                   	pop    %ebp
+  801822:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801823:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801828:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80182e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801833:	89 df                	mov    %ebx,%edi
+  801835:	55                   	push   %ebp
+  801836:	89 e5                	mov    %esp,%ebp
+  801838:	8d 35 40 18 80 00    	lea    0x801840,%esi
+  80183e:	0f 34                	sysenter
+  801840:	5d                   	pop    %ebp
+		goto out;
+  801841:	eb db                	jmp    80181e <sys_e1000_receive+0x25>
+
+00801843 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801843:	55                   	push   %ebp
+  801844:	89 e5                	mov    %esp,%ebp
+  801846:	57                   	push   %edi
+  801847:	56                   	push   %esi
+  801848:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801849:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  801850:	74 1b                	je     80186d <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801852:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801857:	b8 14 00 00 00       	mov    $0x14,%eax
+  80185c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801862:	89 df                	mov    %ebx,%edi
+  801864:	89 de                	mov    %ebx,%esi
+  801866:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801868:	5b                   	pop    %ebx
+  801869:	5e                   	pop    %esi
+  80186a:	5f                   	pop    %edi
+  80186b:	5d                   	pop    %ebp
+  80186c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80186d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801872:	8b 55 08             	mov    0x8(%ebp),%edx
+  801875:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801878:	b8 14 00 00 00       	mov    $0x14,%eax
+  80187d:	89 df                	mov    %ebx,%edi
+  80187f:	55                   	push   %ebp
+  801880:	89 e5                	mov    %esp,%ebp
+  801882:	8d 35 8a 18 80 00    	lea    0x80188a,%esi
+  801888:	0f 34                	sysenter
+  80188a:	5d                   	pop    %ebp
+		goto out;
+  80188b:	eb db                	jmp    801868 <sys_e1000_read_hwaddr+0x25>
+
+0080188d <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80188d:	55                   	push   %ebp
+  80188e:	89 e5                	mov    %esp,%ebp
+  801890:	57                   	push   %edi
+  801891:	56                   	push   %esi
+  801892:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801893:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  80189a:	74 1a                	je     8018b6 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80189c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a9:	89 cb                	mov    %ecx,%ebx
+  8018ab:	89 cf                	mov    %ecx,%edi
+  8018ad:	89 ce                	mov    %ecx,%esi
+  8018af:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8018b1:	5b                   	pop    %ebx
+  8018b2:	5e                   	pop    %esi
+  8018b3:	5f                   	pop    %edi
+  8018b4:	5d                   	pop    %ebp
+  8018b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018be:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018c3:	89 cb                	mov    %ecx,%ebx
+  8018c5:	89 cf                	mov    %ecx,%edi
+  8018c7:	55                   	push   %ebp
+  8018c8:	89 e5                	mov    %esp,%ebp
+  8018ca:	8d 35 d2 18 80 00    	lea    0x8018d2,%esi
+  8018d0:	0f 34                	sysenter
+  8018d2:	5d                   	pop    %ebp
+		goto out;
+  8018d3:	eb dc                	jmp    8018b1 <sys_sb16_read_version+0x24>
+
+008018d5 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+  8018d8:	57                   	push   %edi
+  8018d9:	56                   	push   %esi
+  8018da:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018db:	80 3d 24 54 80 00 00 	cmpb   $0x0,0x805424
+  8018e2:	74 1b                	je     8018ff <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8018e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f4:	89 df                	mov    %ebx,%edi
+  8018f6:	89 de                	mov    %ebx,%esi
+  8018f8:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8018fa:	5b                   	pop    %ebx
+  8018fb:	5e                   	pop    %esi
+  8018fc:	5f                   	pop    %edi
+  8018fd:	5d                   	pop    %ebp
+  8018fe:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801904:	8b 55 08             	mov    0x8(%ebp),%edx
+  801907:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80190a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80190f:	89 df                	mov    %ebx,%edi
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+  801914:	8d 35 1c 19 80 00    	lea    0x80191c,%esi
+  80191a:	0f 34                	sysenter
+  80191c:	5d                   	pop    %ebp
+		goto out;
+  80191d:	eb db                	jmp    8018fa <sys_sb16_play+0x25>
+
+0080191f <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  80191f:	55                   	push   %ebp
+  801920:	89 e5                	mov    %esp,%ebp
+  801922:	53                   	push   %ebx
+  801923:	83 ec 04             	sub    $0x4,%esp
+  801926:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801928:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80192f:	f6 c4 04             	test   $0x4,%ah
+  801932:	74 0c                	je     801940 <dupperm+0x21>
+  801934:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80193b:	f6 c4 08             	test   $0x8,%ah
+  80193e:	75 62                	jne    8019a2 <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801940:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801947:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80194c:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801952:	74 19                	je     80196d <dupperm+0x4e>
+  801954:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80195b:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801960:	83 f8 01             	cmp    $0x1,%eax
+  801963:	19 c0                	sbb    %eax,%eax
+  801965:	25 00 08 00 00       	and    $0x800,%eax
+  80196a:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  80196d:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  801974:	89 c1                	mov    %eax,%ecx
+  801976:	80 cd 04             	or     $0x4,%ch
+  801979:	f6 c7 04             	test   $0x4,%bh
+  80197c:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  80197f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801986:	f6 c1 02             	test   $0x2,%cl
+  801989:	74 12                	je     80199d <dupperm+0x7e>
+  80198b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801992:	89 c2                	mov    %eax,%edx
+  801994:	83 ca 02             	or     $0x2,%edx
+  801997:	f6 c5 04             	test   $0x4,%ch
+  80199a:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  80199d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a0:	c9                   	leave
+  8019a1:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8019a2:	68 98 39 80 00       	push   $0x803998
+  8019a7:	68 30 3a 80 00       	push   $0x803a30
+  8019ac:	6a 39                	push   $0x39
+  8019ae:	68 45 3a 80 00       	push   $0x803a45
+  8019b3:	e8 d6 e8 ff ff       	call   80028e <_panic>
+
+008019b8 <pgfault>:
+{
+  8019b8:	55                   	push   %ebp
+  8019b9:	89 e5                	mov    %esp,%ebp
+  8019bb:	53                   	push   %ebx
+  8019bc:	83 ec 04             	sub    $0x4,%esp
+  8019bf:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8019c2:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8019c4:	89 c3                	mov    %eax,%ebx
+  8019c6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019cc:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8019d0:	74 6d                	je     801a3f <pgfault+0x87>
+  8019d2:	89 da                	mov    %ebx,%edx
+  8019d4:	c1 ea 16             	shr    $0x16,%edx
+  8019d7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019de:	f6 c2 80             	test   $0x80,%dl
+  8019e1:	75 5c                	jne    801a3f <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8019e3:	c1 e8 0c             	shr    $0xc,%eax
+  8019e6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019ed:	f6 c4 08             	test   $0x8,%ah
+  8019f0:	74 4d                	je     801a3f <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8019f2:	83 ec 04             	sub    $0x4,%esp
+  8019f5:	6a 07                	push   $0x7
+  8019f7:	68 00 f0 7f 00       	push   $0x7ff000
+  8019fc:	6a 00                	push   $0x0
+  8019fe:	e8 a6 f4 ff ff       	call   800ea9 <sys_page_alloc>
+  801a03:	83 c4 10             	add    $0x10,%esp
+  801a06:	85 c0                	test   %eax,%eax
+  801a08:	78 49                	js     801a53 <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801a0a:	83 ec 04             	sub    $0x4,%esp
+  801a0d:	68 00 10 00 00       	push   $0x1000
+  801a12:	53                   	push   %ebx
+  801a13:	68 00 f0 7f 00       	push   $0x7ff000
+  801a18:	e8 1a f1 ff ff       	call   800b37 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801a1d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801a24:	53                   	push   %ebx
+  801a25:	6a 00                	push   $0x0
+  801a27:	68 00 f0 7f 00       	push   $0x7ff000
+  801a2c:	6a 00                	push   $0x0
+  801a2e:	e8 e3 f4 ff ff       	call   800f16 <sys_page_map>
+  801a33:	83 c4 20             	add    $0x20,%esp
+  801a36:	85 c0                	test   %eax,%eax
+  801a38:	78 2d                	js     801a67 <pgfault+0xaf>
+}
+  801a3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3d:	c9                   	leave
+  801a3e:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801a3f:	83 ec 04             	sub    $0x4,%esp
+  801a42:	68 50 3a 80 00       	push   $0x803a50
+  801a47:	6a 1e                	push   $0x1e
+  801a49:	68 45 3a 80 00       	push   $0x803a45
+  801a4e:	e8 3b e8 ff ff       	call   80028e <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801a53:	83 ec 04             	sub    $0x4,%esp
+  801a56:	68 cc 39 80 00       	push   $0x8039cc
+  801a5b:	6a 29                	push   $0x29
+  801a5d:	68 45 3a 80 00       	push   $0x803a45
+  801a62:	e8 27 e8 ff ff       	call   80028e <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801a67:	50                   	push   %eax
+  801a68:	68 00 3a 80 00       	push   $0x803a00
+  801a6d:	6a 2e                	push   $0x2e
+  801a6f:	68 45 3a 80 00       	push   $0x803a45
+  801a74:	e8 15 e8 ff ff       	call   80028e <_panic>
+
+00801a79 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801a79:	55                   	push   %ebp
+  801a7a:	89 e5                	mov    %esp,%ebp
+  801a7c:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801a7f:	ff 75 0c             	push   0xc(%ebp)
+  801a82:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801a85:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a8c:	e8 23 f3 ff ff       	call   800db4 <sys_env_destroy>
+}
+  801a91:	83 c4 10             	add    $0x10,%esp
+  801a94:	c9                   	leave
+  801a95:	c3                   	ret
+
+00801a96 <ufork>:
+{
+  801a96:	55                   	push   %ebp
+  801a97:	89 e5                	mov    %esp,%ebp
+  801a99:	57                   	push   %edi
+  801a9a:	56                   	push   %esi
+  801a9b:	53                   	push   %ebx
+  801a9c:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801aa2:	b8 07 00 00 00       	mov    $0x7,%eax
+  801aa7:	cd 30                	int    $0x30
+  801aa9:	89 c6                	mov    %eax,%esi
+  801aab:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801ab1:	85 c0                	test   %eax,%eax
+  801ab3:	78 56                	js     801b0b <ufork+0x75>
+	if (pid > 0) {
+  801ab5:	0f 8e b3 02 00 00    	jle    801d6e <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801abb:	83 ec 0c             	sub    $0xc,%esp
+  801abe:	68 b8 19 80 00       	push   $0x8019b8
+  801ac3:	e8 aa 17 00 00       	call   803272 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801ac8:	83 c4 08             	add    $0x8,%esp
+  801acb:	68 d9 32 80 00       	push   $0x8032d9
+  801ad0:	56                   	push   %esi
+  801ad1:	e8 ef f5 ff ff       	call   8010c5 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801ad6:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801adc:	89 1c 24             	mov    %ebx,(%esp)
+  801adf:	e8 21 03 00 00       	call   801e05 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801ae4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801aeb:	6a 07                	push   $0x7
+  801aed:	68 00 f0 bf ee       	push   $0xeebff000
+  801af2:	56                   	push   %esi
+  801af3:	53                   	push   %ebx
+  801af4:	e8 8d 04 00 00       	call   801f86 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801af9:	83 c4 20             	add    $0x20,%esp
+  801afc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b01:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801b07:	89 fe                	mov    %edi,%esi
+  801b09:	eb 22                	jmp    801b2d <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801b0b:	50                   	push   %eax
+  801b0c:	68 69 3a 80 00       	push   $0x803a69
+  801b11:	68 a9 00 00 00       	push   $0xa9
+  801b16:	68 45 3a 80 00       	push   $0x803a45
+  801b1b:	e8 6e e7 ff ff       	call   80028e <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b20:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b26:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b2b:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b2d:	89 f7                	mov    %esi,%edi
+  801b2f:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801b35:	0f 87 e9 01 00 00    	ja     801d24 <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801b3b:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801b41:	85 f6                	test   %esi,%esi
+  801b43:	0f 49 d6             	cmovns %esi,%edx
+  801b46:	c1 fa 0a             	sar    $0xa,%edx
+  801b49:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801b50:	f6 c1 01             	test   $0x1,%cl
+  801b53:	74 cb                	je     801b20 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801b55:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b5c:	f6 c2 80             	test   $0x80,%dl
+  801b5f:	75 17                	jne    801b78 <ufork+0xe2>
+			j = i + 1;
+  801b61:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801b64:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801b6b:	f6 c2 01             	test   $0x1,%dl
+  801b6e:	0f 85 f3 00 00 00    	jne    801c67 <ufork+0x1d1>
+			j = i + 1;
+  801b74:	89 de                	mov    %ebx,%esi
+  801b76:	eb b5                	jmp    801b2d <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801b78:	89 fb                	mov    %edi,%ebx
+  801b7a:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801b7d:	89 d8                	mov    %ebx,%eax
+  801b7f:	c1 e8 16             	shr    $0x16,%eax
+  801b82:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b89:	89 c2                	mov    %eax,%edx
+  801b8b:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801b91:	25 02 04 00 00       	and    $0x402,%eax
+  801b96:	83 f8 02             	cmp    $0x2,%eax
+  801b99:	74 31                	je     801bcc <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801b9b:	83 ec 04             	sub    $0x4,%esp
+  801b9e:	6a 01                	push   $0x1
+  801ba0:	52                   	push   %edx
+  801ba1:	53                   	push   %ebx
+  801ba2:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801ba8:	53                   	push   %ebx
+  801ba9:	6a 00                	push   $0x0
+  801bab:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801bb1:	50                   	push   %eax
+  801bb2:	e8 fa 03 00 00       	call   801fb1 <batch_map>
+		return;
+  801bb7:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801bba:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801bc0:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801bc5:	89 c6                	mov    %eax,%esi
+				continue;
+  801bc7:	e9 61 ff ff ff       	jmp    801b2d <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801bcc:	83 ec 04             	sub    $0x4,%esp
+  801bcf:	80 ca 80             	or     $0x80,%dl
+  801bd2:	52                   	push   %edx
+  801bd3:	53                   	push   %ebx
+  801bd4:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bda:	e8 ca f2 ff ff       	call   800ea9 <sys_page_alloc>
+  801bdf:	83 c4 10             	add    $0x10,%esp
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	78 5d                	js     801c43 <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801be6:	83 ec 0c             	sub    $0xc,%esp
+  801be9:	6a 07                	push   $0x7
+  801beb:	68 00 00 40 00       	push   $0x400000
+  801bf0:	6a 00                	push   $0x0
+  801bf2:	53                   	push   %ebx
+  801bf3:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bf9:	e8 18 f3 ff ff       	call   800f16 <sys_page_map>
+  801bfe:	83 c4 20             	add    $0x20,%esp
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	78 50                	js     801c55 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801c05:	83 ec 04             	sub    $0x4,%esp
+  801c08:	68 00 00 40 00       	push   $0x400000
+  801c0d:	53                   	push   %ebx
+  801c0e:	68 00 00 40 00       	push   $0x400000
+  801c13:	e8 1f ef ff ff       	call   800b37 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801c18:	83 c4 08             	add    $0x8,%esp
+  801c1b:	68 00 00 40 00       	push   $0x400000
+  801c20:	6a 00                	push   $0x0
+  801c22:	e8 5d f3 ff ff       	call   800f84 <sys_page_unmap>
+  801c27:	83 c4 10             	add    $0x10,%esp
+  801c2a:	85 c0                	test   %eax,%eax
+  801c2c:	79 8c                	jns    801bba <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801c2e:	50                   	push   %eax
+  801c2f:	68 9d 3a 80 00       	push   $0x803a9d
+  801c34:	68 81 00 00 00       	push   $0x81
+  801c39:	68 45 3a 80 00       	push   $0x803a45
+  801c3e:	e8 4b e6 ff ff       	call   80028e <_panic>
+		panic("sys_page_alloc: %e", r);
+  801c43:	50                   	push   %eax
+  801c44:	68 79 3a 80 00       	push   $0x803a79
+  801c49:	6a 7c                	push   $0x7c
+  801c4b:	68 45 3a 80 00       	push   $0x803a45
+  801c50:	e8 39 e6 ff ff       	call   80028e <_panic>
+		panic("sys_page_map: %e", r);
+  801c55:	50                   	push   %eax
+  801c56:	68 8c 3a 80 00       	push   $0x803a8c
+  801c5b:	6a 7e                	push   $0x7e
+  801c5d:	68 45 3a 80 00       	push   $0x803a45
+  801c62:	e8 27 e6 ff ff       	call   80028e <_panic>
+  801c67:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801c6d:	eb 22                	jmp    801c91 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801c6f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c76:	a8 01                	test   $0x1,%al
+  801c78:	74 35                	je     801caf <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801c7a:	89 d8                	mov    %ebx,%eax
+  801c7c:	e8 9e fc ff ff       	call   80191f <dupperm>
+  801c81:	89 c6                	mov    %eax,%esi
+  801c83:	89 f8                	mov    %edi,%eax
+  801c85:	e8 95 fc ff ff       	call   80191f <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c8a:	39 c6                	cmp    %eax,%esi
+  801c8c:	75 21                	jne    801caf <ufork+0x219>
+				j++;
+  801c8e:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c91:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801c97:	74 16                	je     801caf <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801c99:	89 d8                	mov    %ebx,%eax
+  801c9b:	c1 e8 0a             	shr    $0xa,%eax
+  801c9e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ca5:	25 81 00 00 00       	and    $0x81,%eax
+  801caa:	83 f8 01             	cmp    $0x1,%eax
+  801cad:	74 c0                	je     801c6f <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801caf:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801cb5:	89 d8                	mov    %ebx,%eax
+  801cb7:	29 f0                	sub    %esi,%eax
+  801cb9:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801cbf:	89 fe                	mov    %edi,%esi
+  801cc1:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801cc4:	89 f8                	mov    %edi,%eax
+  801cc6:	e8 54 fc ff ff       	call   80191f <dupperm>
+  801ccb:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801ccd:	83 ec 08             	sub    $0x8,%esp
+  801cd0:	6a 02                	push   $0x2
+  801cd2:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801cd8:	51                   	push   %ecx
+  801cd9:	e8 95 01 00 00       	call   801e73 <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801cde:	83 c4 0c             	add    $0xc,%esp
+  801ce1:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801ce7:	57                   	push   %edi
+  801ce8:	56                   	push   %esi
+  801ce9:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801cef:	56                   	push   %esi
+  801cf0:	6a 00                	push   $0x0
+  801cf2:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801cf8:	51                   	push   %ecx
+  801cf9:	e8 b3 02 00 00       	call   801fb1 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801cfe:	83 c4 1c             	add    $0x1c,%esp
+  801d01:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d07:	57                   	push   %edi
+  801d08:	56                   	push   %esi
+  801d09:	6a 00                	push   $0x0
+  801d0b:	56                   	push   %esi
+  801d0c:	6a 00                	push   $0x0
+  801d0e:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d14:	50                   	push   %eax
+  801d15:	e8 97 02 00 00       	call   801fb1 <batch_map>
+	return 0;
+  801d1a:	83 c4 20             	add    $0x20,%esp
+  801d1d:	89 de                	mov    %ebx,%esi
+  801d1f:	e9 09 fe ff ff       	jmp    801b2d <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801d24:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801d2a:	83 ec 04             	sub    $0x4,%esp
+  801d2d:	6a 02                	push   $0x2
+  801d2f:	56                   	push   %esi
+  801d30:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d36:	53                   	push   %ebx
+  801d37:	e8 c9 02 00 00       	call   802005 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801d3c:	89 1c 24             	mov    %ebx,(%esp)
+  801d3f:	e8 dd 00 00 00       	call   801e21 <batch_flush>
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 0e                	js     801d59 <ufork+0x2c3>
+}
+  801d4b:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801d51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d54:	5b                   	pop    %ebx
+  801d55:	5e                   	pop    %esi
+  801d56:	5f                   	pop    %edi
+  801d57:	5d                   	pop    %ebp
+  801d58:	c3                   	ret
+			panic("fork: %e", r);
+  801d59:	50                   	push   %eax
+  801d5a:	68 70 3a 80 00       	push   $0x803a70
+  801d5f:	68 d7 00 00 00       	push   $0xd7
+  801d64:	68 45 3a 80 00       	push   $0x803a45
+  801d69:	e8 20 e5 ff ff       	call   80028e <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d6e:	e8 aa f0 ff ff       	call   800e1d <sys_getenvid>
+  801d73:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d78:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d7e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d83:	a3 20 54 80 00       	mov    %eax,0x805420
+		return 0;
+  801d88:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801d8f:	00 00 00 
+  801d92:	eb b7                	jmp    801d4b <ufork+0x2b5>
+
+00801d94 <fork>:
+{
+  801d94:	55                   	push   %ebp
+  801d95:	89 e5                	mov    %esp,%ebp
+  801d97:	53                   	push   %ebx
+  801d98:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801d9b:	68 b8 19 80 00       	push   $0x8019b8
+  801da0:	e8 cd 14 00 00       	call   803272 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801da5:	e8 7a f6 ff ff       	call   801424 <sys_fork>
+  801daa:	89 c3                	mov    %eax,%ebx
+  801dac:	83 c4 10             	add    $0x10,%esp
+  801daf:	85 c0                	test   %eax,%eax
+  801db1:	78 09                	js     801dbc <fork+0x28>
+	if (pid == 0)
+  801db3:	74 1c                	je     801dd1 <fork+0x3d>
+}
+  801db5:	89 d8                	mov    %ebx,%eax
+  801db7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801dbc:	50                   	push   %eax
+  801dbd:	68 69 3a 80 00       	push   $0x803a69
+  801dc2:	68 ed 00 00 00       	push   $0xed
+  801dc7:	68 45 3a 80 00       	push   $0x803a45
+  801dcc:	e8 bd e4 ff ff       	call   80028e <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801dd1:	e8 47 f0 ff ff       	call   800e1d <sys_getenvid>
+  801dd6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ddb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801de1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801de6:	a3 20 54 80 00       	mov    %eax,0x805420
+	return pid;
+  801deb:	eb c8                	jmp    801db5 <fork+0x21>
+
+00801ded <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+  801df0:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801df3:	ff 75 0c             	push   0xc(%ebp)
+  801df6:	ff 75 08             	push   0x8(%ebp)
+  801df9:	68 79 1a 80 00       	push   $0x801a79
+  801dfe:	e8 67 f6 ff ff       	call   80146a <sys_thread_create>
+}
+  801e03:	c9                   	leave
+  801e04:	c3                   	ret
+
+00801e05 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801e05:	55                   	push   %ebp
+  801e06:	89 e5                	mov    %esp,%ebp
+  801e08:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801e0b:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801e12:	00 00 00 
+	b->b_error = 0;
+  801e15:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801e1c:	00 00 00 
+}
+  801e1f:	5d                   	pop    %ebp
+  801e20:	c3                   	ret
+
+00801e21 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801e21:	55                   	push   %ebp
+  801e22:	89 e5                	mov    %esp,%ebp
+  801e24:	53                   	push   %ebx
+  801e25:	83 ec 04             	sub    $0x4,%esp
+  801e28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801e2b:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801e31:	85 c0                	test   %eax,%eax
+  801e33:	7e 09                	jle    801e3e <batch_flush+0x1d>
+  801e35:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801e3c:	74 15                	je     801e53 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801e3e:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801e45:	00 00 00 
+	return b->b_error;
+  801e48:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801e4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e51:	c9                   	leave
+  801e52:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801e53:	83 ec 08             	sub    $0x8,%esp
+  801e56:	50                   	push   %eax
+  801e57:	53                   	push   %ebx
+  801e58:	e8 32 f7 ff ff       	call   80158f <sys_batch>
+  801e5d:	83 c4 10             	add    $0x10,%esp
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	79 da                	jns    801e3e <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801e64:	f7 d8                	neg    %eax
+  801e66:	0f b6 c0             	movzbl %al,%eax
+  801e69:	f7 d8                	neg    %eax
+  801e6b:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801e71:	eb cb                	jmp    801e3e <batch_flush+0x1d>
+
+00801e73 <batch_reserve>:
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	83 ec 08             	sub    $0x8,%esp
+  801e79:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801e7c:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801e82:	03 45 0c             	add    0xc(%ebp),%eax
+  801e85:	83 f8 10             	cmp    $0x10,%eax
+  801e88:	7f 02                	jg     801e8c <batch_reserve+0x19>
+}
+  801e8a:	c9                   	leave
+  801e8b:	c3                   	ret
+		batch_flush(b);
+  801e8c:	83 ec 0c             	sub    $0xc,%esp
+  801e8f:	52                   	push   %edx
+  801e90:	e8 8c ff ff ff       	call   801e21 <batch_flush>
+  801e95:	83 c4 10             	add    $0x10,%esp
+}
+  801e98:	eb f0                	jmp    801e8a <batch_reserve+0x17>
+
+00801e9a <batch_next>:
+{
+  801e9a:	55                   	push   %ebp
+  801e9b:	89 e5                	mov    %esp,%ebp
+  801e9d:	53                   	push   %ebx
+  801e9e:	83 ec 04             	sub    $0x4,%esp
+  801ea1:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801ea3:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801eaa:	74 28                	je     801ed4 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801eac:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801eb2:	8d 50 01             	lea    0x1(%eax),%edx
+  801eb5:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801ebb:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801ebe:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801ec0:	83 ec 04             	sub    $0x4,%esp
+  801ec3:	6a 1c                	push   $0x1c
+  801ec5:	6a 00                	push   $0x0
+  801ec7:	53                   	push   %ebx
+  801ec8:	e8 35 ec ff ff       	call   800b02 <memset>
+}
+  801ecd:	89 d8                	mov    %ebx,%eax
+  801ecf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed2:	c9                   	leave
+  801ed3:	c3                   	ret
+		batch_flush(b);
+  801ed4:	83 ec 0c             	sub    $0xc,%esp
+  801ed7:	50                   	push   %eax
+  801ed8:	e8 44 ff ff ff       	call   801e21 <batch_flush>
+  801edd:	83 c4 10             	add    $0x10,%esp
+  801ee0:	eb ca                	jmp    801eac <batch_next+0x12>
+
+00801ee2 <batch_page>:
+{
+  801ee2:	55                   	push   %ebp
+  801ee3:	89 e5                	mov    %esp,%ebp
+  801ee5:	57                   	push   %edi
+  801ee6:	56                   	push   %esi
+  801ee7:	53                   	push   %ebx
+  801ee8:	83 ec 1c             	sub    $0x1c,%esp
+  801eeb:	89 d3                	mov    %edx,%ebx
+  801eed:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801eef:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801ef5:	85 d2                	test   %edx,%edx
+  801ef7:	74 50                	je     801f49 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801ef9:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801efc:	01 c1                	add    %eax,%ecx
+  801efe:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801f01:	75 46                	jne    801f49 <batch_page+0x67>
+  801f03:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801f06:	75 41                	jne    801f49 <batch_page+0x67>
+  801f08:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801f0b:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801f0e:	75 39                	jne    801f49 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801f10:	83 ea 01             	sub    $0x1,%edx
+  801f13:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801f16:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801f19:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801f1d:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801f20:	75 27                	jne    801f49 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801f22:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801f25:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801f29:	89 fa                	mov    %edi,%edx
+  801f2b:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801f2e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801f31:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801f34:	39 55 08             	cmp    %edx,0x8(%ebp)
+  801f37:	75 10                	jne    801f49 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801f39:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  801f3d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801f40:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  801f44:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801f47:	74 2a                	je     801f73 <batch_page+0x91>
+	op = batch_next(b);
+  801f49:	e8 4c ff ff ff       	call   801e9a <batch_next>
+	op->bo_op = opcode;
+  801f4e:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  801f50:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  801f53:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f56:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  801f59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f5c:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  801f5f:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f62:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  801f65:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801f68:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  801f6b:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801f6e:	89 78 14             	mov    %edi,0x14(%eax)
+  801f71:	eb 0b                	jmp    801f7e <batch_page+0x9c>
+		op->bo_npages += npages;
+  801f73:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  801f77:	03 7d 18             	add    0x18(%ebp),%edi
+  801f7a:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  801f7e:	83 c4 1c             	add    $0x1c,%esp
+  801f81:	5b                   	pop    %ebx
+  801f82:	5e                   	pop    %esi
+  801f83:	5f                   	pop    %edi
+  801f84:	5d                   	pop    %ebp
+  801f85:	c3                   	ret
+
+00801f86 <batch_alloc>:
+{
+  801f86:	55                   	push   %ebp
+  801f87:	89 e5                	mov    %esp,%ebp
+  801f89:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  801f8c:	ff 75 18             	push   0x18(%ebp)
+  801f8f:	ff 75 14             	push   0x14(%ebp)
+  801f92:	ff 75 10             	push   0x10(%ebp)
+  801f95:	ff 75 0c             	push   0xc(%ebp)
+  801f98:	6a 00                	push   $0x0
+  801f9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa7:	e8 36 ff ff ff       	call   801ee2 <batch_page>
+}
+  801fac:	83 c4 20             	add    $0x20,%esp
+  801faf:	c9                   	leave
+  801fb0:	c3                   	ret
+
+00801fb1 <batch_map>:
+{
+  801fb1:	55                   	push   %ebp
+  801fb2:	89 e5                	mov    %esp,%ebp
+  801fb4:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  801fb7:	ff 75 20             	push   0x20(%ebp)
+  801fba:	ff 75 1c             	push   0x1c(%ebp)
+  801fbd:	ff 75 18             	push   0x18(%ebp)
+  801fc0:	ff 75 14             	push   0x14(%ebp)
+  801fc3:	ff 75 10             	push   0x10(%ebp)
+  801fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fc9:	ba 01 00 00 00       	mov    $0x1,%edx
+  801fce:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd1:	e8 0c ff ff ff       	call   801ee2 <batch_page>
+}
+  801fd6:	83 c4 20             	add    $0x20,%esp
+  801fd9:	c9                   	leave
+  801fda:	c3                   	ret
+
+00801fdb <batch_unmap>:
+{
+  801fdb:	55                   	push   %ebp
+  801fdc:	89 e5                	mov    %esp,%ebp
+  801fde:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  801fe1:	ff 75 14             	push   0x14(%ebp)
+  801fe4:	6a 00                	push   $0x0
+  801fe6:	ff 75 10             	push   0x10(%ebp)
+  801fe9:	ff 75 0c             	push   0xc(%ebp)
+  801fec:	6a 00                	push   $0x0
+  801fee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff3:	ba 02 00 00 00       	mov    $0x2,%edx
+  801ff8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ffb:	e8 e2 fe ff ff       	call   801ee2 <batch_page>
+}
+  802000:	83 c4 20             	add    $0x20,%esp
+  802003:	c9                   	leave
+  802004:	c3                   	ret
+
+00802005 <batch_set_status>:
+{
+  802005:	55                   	push   %ebp
+  802006:	89 e5                	mov    %esp,%ebp
+  802008:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  80200b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200e:	e8 87 fe ff ff       	call   801e9a <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  802013:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  802019:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80201c:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  80201f:	8b 55 10             	mov    0x10(%ebp),%edx
+  802022:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  802025:	c9                   	leave
+  802026:	c3                   	ret
+
+00802027 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802027:	55                   	push   %ebp
+  802028:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80202a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202d:	05 00 00 00 30       	add    $0x30000000,%eax
+  802032:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802035:	5d                   	pop    %ebp
+  802036:	c3                   	ret
+
+00802037 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802037:	55                   	push   %ebp
+  802038:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80203a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802042:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802047:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80204c:	5d                   	pop    %ebp
+  80204d:	c3                   	ret
+
+0080204e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80204e:	55                   	push   %ebp
+  80204f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802051:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802056:	eb 02                	jmp    80205a <fd_alloc+0xc>
+  802058:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80205a:	89 c2                	mov    %eax,%edx
+  80205c:	c1 ea 16             	shr    $0x16,%edx
+  80205f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802066:	f6 c2 01             	test   $0x1,%dl
+  802069:	74 2b                	je     802096 <fd_alloc+0x48>
+  80206b:	89 c2                	mov    %eax,%edx
+  80206d:	c1 ea 0c             	shr    $0xc,%edx
+  802070:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802077:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80207d:	f6 c1 01             	test   $0x1,%cl
+  802080:	74 14                	je     802096 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802082:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802088:	75 ce                	jne    802058 <fd_alloc+0xa>
+  80208a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80208f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802094:	eb 05                	jmp    80209b <fd_alloc+0x4d>
+			return 0;
+  802096:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80209b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80209e:	89 02                	mov    %eax,(%edx)
+}
+  8020a0:	89 c8                	mov    %ecx,%eax
+  8020a2:	5d                   	pop    %ebp
+  8020a3:	c3                   	ret
+
+008020a4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8020a4:	55                   	push   %ebp
+  8020a5:	89 e5                	mov    %esp,%ebp
+  8020a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8020aa:	83 f8 1f             	cmp    $0x1f,%eax
+  8020ad:	77 30                	ja     8020df <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8020af:	c1 e0 0c             	shl    $0xc,%eax
+  8020b2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8020b7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8020bd:	f6 c2 01             	test   $0x1,%dl
+  8020c0:	74 24                	je     8020e6 <fd_lookup+0x42>
+  8020c2:	89 c2                	mov    %eax,%edx
+  8020c4:	c1 ea 0c             	shr    $0xc,%edx
+  8020c7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8020ce:	f6 c2 01             	test   $0x1,%dl
+  8020d1:	74 1a                	je     8020ed <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8020d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020d6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8020d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020dd:	5d                   	pop    %ebp
+  8020de:	c3                   	ret
+		return -E_INVAL;
+  8020df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e4:	eb f7                	jmp    8020dd <fd_lookup+0x39>
+		return -E_INVAL;
+  8020e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020eb:	eb f0                	jmp    8020dd <fd_lookup+0x39>
+  8020ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020f2:	eb e9                	jmp    8020dd <fd_lookup+0x39>
+
+008020f4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	53                   	push   %ebx
+  8020f8:	83 ec 04             	sub    $0x4,%esp
+  8020fb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8020fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802103:	eb 03                	jmp    802108 <dev_lookup+0x14>
+  802105:	83 c0 01             	add    $0x1,%eax
+  802108:	8b 1c 85 2c 3b 80 00 	mov    0x803b2c(,%eax,4),%ebx
+  80210f:	85 db                	test   %ebx,%ebx
+  802111:	74 0b                	je     80211e <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802113:	39 13                	cmp    %edx,(%ebx)
+  802115:	75 ee                	jne    802105 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211c:	eb 2e                	jmp    80214c <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80211e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802120:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802125:	8b 0d 20 54 80 00    	mov    0x805420,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80212b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802130:	76 24                	jbe    802156 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802132:	8b 41 48             	mov    0x48(%ecx),%eax
+  802135:	83 ec 04             	sub    $0x4,%esp
+  802138:	52                   	push   %edx
+  802139:	50                   	push   %eax
+  80213a:	68 b0 3a 80 00       	push   $0x803ab0
+  80213f:	e8 25 e2 ff ff       	call   800369 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802144:	83 c4 10             	add    $0x10,%esp
+  802147:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80214c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80214f:	89 1a                	mov    %ebx,(%edx)
+}
+  802151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802154:	c9                   	leave
+  802155:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802156:	c1 e8 10             	shr    $0x10,%eax
+  802159:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80215f:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802165:	eb cb                	jmp    802132 <dev_lookup+0x3e>
+
+00802167 <fd_close>:
+{
+  802167:	55                   	push   %ebp
+  802168:	89 e5                	mov    %esp,%ebp
+  80216a:	57                   	push   %edi
+  80216b:	56                   	push   %esi
+  80216c:	53                   	push   %ebx
+  80216d:	83 ec 24             	sub    $0x24,%esp
+  802170:	8b 75 08             	mov    0x8(%ebp),%esi
+  802173:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802176:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802179:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80217a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802180:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802183:	50                   	push   %eax
+  802184:	e8 1b ff ff ff       	call   8020a4 <fd_lookup>
+  802189:	89 c3                	mov    %eax,%ebx
+  80218b:	83 c4 10             	add    $0x10,%esp
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	78 05                	js     802197 <fd_close+0x30>
+	    || fd != fd2)
+  802192:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802195:	74 16                	je     8021ad <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802197:	89 f8                	mov    %edi,%eax
+  802199:	84 c0                	test   %al,%al
+  80219b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8021a3:	89 d8                	mov    %ebx,%eax
+  8021a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021a8:	5b                   	pop    %ebx
+  8021a9:	5e                   	pop    %esi
+  8021aa:	5f                   	pop    %edi
+  8021ab:	5d                   	pop    %ebp
+  8021ac:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8021ad:	83 ec 08             	sub    $0x8,%esp
+  8021b0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8021b3:	50                   	push   %eax
+  8021b4:	ff 36                	push   (%esi)
+  8021b6:	e8 39 ff ff ff       	call   8020f4 <dev_lookup>
+  8021bb:	89 c3                	mov    %eax,%ebx
+  8021bd:	83 c4 10             	add    $0x10,%esp
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	78 1a                	js     8021de <fd_close+0x77>
+		if (dev->dev_close)
+  8021c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8021c7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8021ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8021cf:	85 c0                	test   %eax,%eax
+  8021d1:	74 0b                	je     8021de <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8021d3:	83 ec 0c             	sub    $0xc,%esp
+  8021d6:	56                   	push   %esi
+  8021d7:	ff d0                	call   *%eax
+  8021d9:	89 c3                	mov    %eax,%ebx
+  8021db:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8021de:	83 ec 08             	sub    $0x8,%esp
+  8021e1:	56                   	push   %esi
+  8021e2:	6a 00                	push   $0x0
+  8021e4:	e8 9b ed ff ff       	call   800f84 <sys_page_unmap>
+	return r;
+  8021e9:	83 c4 10             	add    $0x10,%esp
+  8021ec:	eb b5                	jmp    8021a3 <fd_close+0x3c>
+
+008021ee <close>:
+
+int
+close(int fdnum)
+{
+  8021ee:	55                   	push   %ebp
+  8021ef:	89 e5                	mov    %esp,%ebp
+  8021f1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f7:	50                   	push   %eax
+  8021f8:	ff 75 08             	push   0x8(%ebp)
+  8021fb:	e8 a4 fe ff ff       	call   8020a4 <fd_lookup>
+  802200:	83 c4 10             	add    $0x10,%esp
+  802203:	85 c0                	test   %eax,%eax
+  802205:	79 02                	jns    802209 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802207:	c9                   	leave
+  802208:	c3                   	ret
+		return fd_close(fd, 1);
+  802209:	83 ec 08             	sub    $0x8,%esp
+  80220c:	6a 01                	push   $0x1
+  80220e:	ff 75 f4             	push   -0xc(%ebp)
+  802211:	e8 51 ff ff ff       	call   802167 <fd_close>
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	eb ec                	jmp    802207 <close+0x19>
+
+0080221b <close_all>:
+
+void
+close_all(void)
+{
+  80221b:	55                   	push   %ebp
+  80221c:	89 e5                	mov    %esp,%ebp
+  80221e:	53                   	push   %ebx
+  80221f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802222:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802227:	83 ec 0c             	sub    $0xc,%esp
+  80222a:	53                   	push   %ebx
+  80222b:	e8 be ff ff ff       	call   8021ee <close>
+	for (i = 0; i < MAXFD; i++)
+  802230:	83 c3 01             	add    $0x1,%ebx
+  802233:	83 c4 10             	add    $0x10,%esp
+  802236:	83 fb 20             	cmp    $0x20,%ebx
+  802239:	75 ec                	jne    802227 <close_all+0xc>
+}
+  80223b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223e:	c9                   	leave
+  80223f:	c3                   	ret
+
+00802240 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802240:	55                   	push   %ebp
+  802241:	89 e5                	mov    %esp,%ebp
+  802243:	57                   	push   %edi
+  802244:	56                   	push   %esi
+  802245:	53                   	push   %ebx
+  802246:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802249:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80224c:	50                   	push   %eax
+  80224d:	ff 75 08             	push   0x8(%ebp)
+  802250:	e8 4f fe ff ff       	call   8020a4 <fd_lookup>
+  802255:	89 c3                	mov    %eax,%ebx
+  802257:	83 c4 10             	add    $0x10,%esp
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	78 7f                	js     8022dd <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80225e:	83 ec 0c             	sub    $0xc,%esp
+  802261:	ff 75 0c             	push   0xc(%ebp)
+  802264:	e8 85 ff ff ff       	call   8021ee <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802269:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80226c:	c1 e6 0c             	shl    $0xc,%esi
+  80226f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802275:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802278:	89 3c 24             	mov    %edi,(%esp)
+  80227b:	e8 b7 fd ff ff       	call   802037 <fd2data>
+  802280:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802282:	89 34 24             	mov    %esi,(%esp)
+  802285:	e8 ad fd ff ff       	call   802037 <fd2data>
+  80228a:	83 c4 10             	add    $0x10,%esp
+  80228d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802290:	89 d8                	mov    %ebx,%eax
+  802292:	c1 e8 16             	shr    $0x16,%eax
+  802295:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80229c:	a8 01                	test   $0x1,%al
+  80229e:	74 11                	je     8022b1 <dup+0x71>
+  8022a0:	89 d8                	mov    %ebx,%eax
+  8022a2:	c1 e8 0c             	shr    $0xc,%eax
+  8022a5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8022ac:	f6 c2 01             	test   $0x1,%dl
+  8022af:	75 36                	jne    8022e7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8022b1:	89 f8                	mov    %edi,%eax
+  8022b3:	c1 e8 0c             	shr    $0xc,%eax
+  8022b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8022bd:	83 ec 0c             	sub    $0xc,%esp
+  8022c0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8022c5:	50                   	push   %eax
+  8022c6:	56                   	push   %esi
+  8022c7:	6a 00                	push   $0x0
+  8022c9:	57                   	push   %edi
+  8022ca:	6a 00                	push   $0x0
+  8022cc:	e8 45 ec ff ff       	call   800f16 <sys_page_map>
+  8022d1:	89 c3                	mov    %eax,%ebx
+  8022d3:	83 c4 20             	add    $0x20,%esp
+  8022d6:	85 c0                	test   %eax,%eax
+  8022d8:	78 33                	js     80230d <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8022da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8022dd:	89 d8                	mov    %ebx,%eax
+  8022df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e2:	5b                   	pop    %ebx
+  8022e3:	5e                   	pop    %esi
+  8022e4:	5f                   	pop    %edi
+  8022e5:	5d                   	pop    %ebp
+  8022e6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8022e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8022ee:	83 ec 0c             	sub    $0xc,%esp
+  8022f1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8022f6:	50                   	push   %eax
+  8022f7:	ff 75 d4             	push   -0x2c(%ebp)
+  8022fa:	6a 00                	push   $0x0
+  8022fc:	53                   	push   %ebx
+  8022fd:	6a 00                	push   $0x0
+  8022ff:	e8 12 ec ff ff       	call   800f16 <sys_page_map>
+  802304:	89 c3                	mov    %eax,%ebx
+  802306:	83 c4 20             	add    $0x20,%esp
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	79 a4                	jns    8022b1 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80230d:	83 ec 08             	sub    $0x8,%esp
+  802310:	56                   	push   %esi
+  802311:	6a 00                	push   $0x0
+  802313:	e8 6c ec ff ff       	call   800f84 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802318:	83 c4 08             	add    $0x8,%esp
+  80231b:	ff 75 d4             	push   -0x2c(%ebp)
+  80231e:	6a 00                	push   $0x0
+  802320:	e8 5f ec ff ff       	call   800f84 <sys_page_unmap>
+	return r;
+  802325:	83 c4 10             	add    $0x10,%esp
+  802328:	eb b3                	jmp    8022dd <dup+0x9d>
+
+0080232a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80232a:	55                   	push   %ebp
+  80232b:	89 e5                	mov    %esp,%ebp
+  80232d:	56                   	push   %esi
+  80232e:	53                   	push   %ebx
+  80232f:	83 ec 18             	sub    $0x18,%esp
+  802332:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802335:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802338:	50                   	push   %eax
+  802339:	53                   	push   %ebx
+  80233a:	e8 65 fd ff ff       	call   8020a4 <fd_lookup>
+  80233f:	83 c4 10             	add    $0x10,%esp
+  802342:	85 c0                	test   %eax,%eax
+  802344:	78 3c                	js     802382 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802346:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802349:	83 ec 08             	sub    $0x8,%esp
+  80234c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80234f:	50                   	push   %eax
+  802350:	ff 36                	push   (%esi)
+  802352:	e8 9d fd ff ff       	call   8020f4 <dev_lookup>
+  802357:	83 c4 10             	add    $0x10,%esp
+  80235a:	85 c0                	test   %eax,%eax
+  80235c:	78 24                	js     802382 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80235e:	8b 46 08             	mov    0x8(%esi),%eax
+  802361:	83 e0 03             	and    $0x3,%eax
+  802364:	83 f8 01             	cmp    $0x1,%eax
+  802367:	74 20                	je     802389 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802369:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80236c:	8b 40 08             	mov    0x8(%eax),%eax
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	74 57                	je     8023ca <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802373:	83 ec 04             	sub    $0x4,%esp
+  802376:	ff 75 10             	push   0x10(%ebp)
+  802379:	ff 75 0c             	push   0xc(%ebp)
+  80237c:	56                   	push   %esi
+  80237d:	ff d0                	call   *%eax
+  80237f:	83 c4 10             	add    $0x10,%esp
+}
+  802382:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802385:	5b                   	pop    %ebx
+  802386:	5e                   	pop    %esi
+  802387:	5d                   	pop    %ebp
+  802388:	c3                   	ret
+  802389:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80238b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802390:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802396:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80239b:	76 1c                	jbe    8023b9 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80239d:	8b 42 48             	mov    0x48(%edx),%eax
+  8023a0:	83 ec 04             	sub    $0x4,%esp
+  8023a3:	53                   	push   %ebx
+  8023a4:	50                   	push   %eax
+  8023a5:	68 f1 3a 80 00       	push   $0x803af1
+  8023aa:	e8 ba df ff ff       	call   800369 <cprintf>
+		return -E_INVAL;
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023b7:	eb c9                	jmp    802382 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8023b9:	c1 e8 10             	shr    $0x10,%eax
+  8023bc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8023c2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8023c8:	eb d3                	jmp    80239d <read+0x73>
+		return -E_NOT_SUPP;
+  8023ca:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023cf:	eb b1                	jmp    802382 <read+0x58>
+
+008023d1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8023d1:	55                   	push   %ebp
+  8023d2:	89 e5                	mov    %esp,%ebp
+  8023d4:	57                   	push   %edi
+  8023d5:	56                   	push   %esi
+  8023d6:	53                   	push   %ebx
+  8023d7:	83 ec 0c             	sub    $0xc,%esp
+  8023da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023dd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8023e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023e5:	eb 02                	jmp    8023e9 <readn+0x18>
+  8023e7:	01 c3                	add    %eax,%ebx
+  8023e9:	39 f3                	cmp    %esi,%ebx
+  8023eb:	73 21                	jae    80240e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8023ed:	83 ec 04             	sub    $0x4,%esp
+  8023f0:	89 f0                	mov    %esi,%eax
+  8023f2:	29 d8                	sub    %ebx,%eax
+  8023f4:	50                   	push   %eax
+  8023f5:	89 d8                	mov    %ebx,%eax
+  8023f7:	03 45 0c             	add    0xc(%ebp),%eax
+  8023fa:	50                   	push   %eax
+  8023fb:	57                   	push   %edi
+  8023fc:	e8 29 ff ff ff       	call   80232a <read>
+		if (m < 0)
+  802401:	83 c4 10             	add    $0x10,%esp
+  802404:	85 c0                	test   %eax,%eax
+  802406:	78 04                	js     80240c <readn+0x3b>
+			return m;
+		if (m == 0)
+  802408:	75 dd                	jne    8023e7 <readn+0x16>
+  80240a:	eb 02                	jmp    80240e <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80240c:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80240e:	89 d8                	mov    %ebx,%eax
+  802410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802413:	5b                   	pop    %ebx
+  802414:	5e                   	pop    %esi
+  802415:	5f                   	pop    %edi
+  802416:	5d                   	pop    %ebp
+  802417:	c3                   	ret
+
+00802418 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802418:	55                   	push   %ebp
+  802419:	89 e5                	mov    %esp,%ebp
+  80241b:	56                   	push   %esi
+  80241c:	53                   	push   %ebx
+  80241d:	83 ec 18             	sub    $0x18,%esp
+  802420:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802423:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802426:	50                   	push   %eax
+  802427:	53                   	push   %ebx
+  802428:	e8 77 fc ff ff       	call   8020a4 <fd_lookup>
+  80242d:	83 c4 10             	add    $0x10,%esp
+  802430:	85 c0                	test   %eax,%eax
+  802432:	78 37                	js     80246b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802434:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802437:	83 ec 08             	sub    $0x8,%esp
+  80243a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80243d:	50                   	push   %eax
+  80243e:	ff 36                	push   (%esi)
+  802440:	e8 af fc ff ff       	call   8020f4 <dev_lookup>
+  802445:	83 c4 10             	add    $0x10,%esp
+  802448:	85 c0                	test   %eax,%eax
+  80244a:	78 1f                	js     80246b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80244c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802450:	74 20                	je     802472 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802452:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802455:	8b 40 0c             	mov    0xc(%eax),%eax
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	74 57                	je     8024b3 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80245c:	83 ec 04             	sub    $0x4,%esp
+  80245f:	ff 75 10             	push   0x10(%ebp)
+  802462:	ff 75 0c             	push   0xc(%ebp)
+  802465:	56                   	push   %esi
+  802466:	ff d0                	call   *%eax
+  802468:	83 c4 10             	add    $0x10,%esp
+}
+  80246b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80246e:	5b                   	pop    %ebx
+  80246f:	5e                   	pop    %esi
+  802470:	5d                   	pop    %ebp
+  802471:	c3                   	ret
+  802472:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802474:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802479:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80247f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802484:	76 1c                	jbe    8024a2 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802486:	8b 42 48             	mov    0x48(%edx),%eax
+  802489:	83 ec 04             	sub    $0x4,%esp
+  80248c:	53                   	push   %ebx
+  80248d:	50                   	push   %eax
+  80248e:	68 0d 3b 80 00       	push   $0x803b0d
+  802493:	e8 d1 de ff ff       	call   800369 <cprintf>
+		return -E_INVAL;
+  802498:	83 c4 10             	add    $0x10,%esp
+  80249b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024a0:	eb c9                	jmp    80246b <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8024a2:	c1 e8 10             	shr    $0x10,%eax
+  8024a5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8024ab:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8024b1:	eb d3                	jmp    802486 <write+0x6e>
+		return -E_NOT_SUPP;
+  8024b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024b8:	eb b1                	jmp    80246b <write+0x53>
+
+008024ba <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8024ba:	55                   	push   %ebp
+  8024bb:	89 e5                	mov    %esp,%ebp
+  8024bd:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024c3:	50                   	push   %eax
+  8024c4:	ff 75 08             	push   0x8(%ebp)
+  8024c7:	e8 d8 fb ff ff       	call   8020a4 <fd_lookup>
+  8024cc:	83 c4 10             	add    $0x10,%esp
+  8024cf:	85 c0                	test   %eax,%eax
+  8024d1:	78 0e                	js     8024e1 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8024d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d9:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8024dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024e1:	c9                   	leave
+  8024e2:	c3                   	ret
+
+008024e3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8024e3:	55                   	push   %ebp
+  8024e4:	89 e5                	mov    %esp,%ebp
+  8024e6:	56                   	push   %esi
+  8024e7:	53                   	push   %ebx
+  8024e8:	83 ec 18             	sub    $0x18,%esp
+  8024eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024f1:	50                   	push   %eax
+  8024f2:	53                   	push   %ebx
+  8024f3:	e8 ac fb ff ff       	call   8020a4 <fd_lookup>
+  8024f8:	83 c4 10             	add    $0x10,%esp
+  8024fb:	85 c0                	test   %eax,%eax
+  8024fd:	78 34                	js     802533 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024ff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802502:	83 ec 08             	sub    $0x8,%esp
+  802505:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802508:	50                   	push   %eax
+  802509:	ff 36                	push   (%esi)
+  80250b:	e8 e4 fb ff ff       	call   8020f4 <dev_lookup>
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	85 c0                	test   %eax,%eax
+  802515:	78 1c                	js     802533 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802517:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80251b:	74 1d                	je     80253a <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80251d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802520:	8b 40 18             	mov    0x18(%eax),%eax
+  802523:	85 c0                	test   %eax,%eax
+  802525:	74 54                	je     80257b <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802527:	83 ec 08             	sub    $0x8,%esp
+  80252a:	ff 75 0c             	push   0xc(%ebp)
+  80252d:	56                   	push   %esi
+  80252e:	ff d0                	call   *%eax
+  802530:	83 c4 10             	add    $0x10,%esp
+}
+  802533:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802536:	5b                   	pop    %ebx
+  802537:	5e                   	pop    %esi
+  802538:	5d                   	pop    %ebp
+  802539:	c3                   	ret
+  80253a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80253c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802541:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802547:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80254c:	76 1c                	jbe    80256a <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  80254e:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802551:	83 ec 04             	sub    $0x4,%esp
+  802554:	53                   	push   %ebx
+  802555:	50                   	push   %eax
+  802556:	68 d0 3a 80 00       	push   $0x803ad0
+  80255b:	e8 09 de ff ff       	call   800369 <cprintf>
+		return -E_INVAL;
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802568:	eb c9                	jmp    802533 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80256a:	c1 e8 10             	shr    $0x10,%eax
+  80256d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802573:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802579:	eb d3                	jmp    80254e <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  80257b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802580:	eb b1                	jmp    802533 <ftruncate+0x50>
+
+00802582 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802582:	55                   	push   %ebp
+  802583:	89 e5                	mov    %esp,%ebp
+  802585:	56                   	push   %esi
+  802586:	53                   	push   %ebx
+  802587:	83 ec 18             	sub    $0x18,%esp
+  80258a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80258d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802590:	50                   	push   %eax
+  802591:	ff 75 08             	push   0x8(%ebp)
+  802594:	e8 0b fb ff ff       	call   8020a4 <fd_lookup>
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 49                	js     8025e9 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025a0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025a3:	83 ec 08             	sub    $0x8,%esp
+  8025a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025a9:	50                   	push   %eax
+  8025aa:	ff 36                	push   (%esi)
+  8025ac:	e8 43 fb ff ff       	call   8020f4 <dev_lookup>
+  8025b1:	83 c4 10             	add    $0x10,%esp
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	78 31                	js     8025e9 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8025b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025bb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8025bf:	74 2f                	je     8025f0 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8025c1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8025c4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8025cb:	00 00 00 
+	stat->st_isdir = 0;
+  8025ce:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025d5:	00 00 00 
+	stat->st_dev = dev;
+  8025d8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8025de:	83 ec 08             	sub    $0x8,%esp
+  8025e1:	53                   	push   %ebx
+  8025e2:	56                   	push   %esi
+  8025e3:	ff 50 14             	call   *0x14(%eax)
+  8025e6:	83 c4 10             	add    $0x10,%esp
+}
+  8025e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ec:	5b                   	pop    %ebx
+  8025ed:	5e                   	pop    %esi
+  8025ee:	5d                   	pop    %ebp
+  8025ef:	c3                   	ret
+		return -E_NOT_SUPP;
+  8025f0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025f5:	eb f2                	jmp    8025e9 <fstat+0x67>
+
+008025f7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8025f7:	55                   	push   %ebp
+  8025f8:	89 e5                	mov    %esp,%ebp
+  8025fa:	56                   	push   %esi
+  8025fb:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8025fc:	83 ec 08             	sub    $0x8,%esp
+  8025ff:	6a 00                	push   $0x0
+  802601:	ff 75 08             	push   0x8(%ebp)
+  802604:	e8 e4 01 00 00       	call   8027ed <open>
+  802609:	89 c3                	mov    %eax,%ebx
+  80260b:	83 c4 10             	add    $0x10,%esp
+  80260e:	85 c0                	test   %eax,%eax
+  802610:	78 1b                	js     80262d <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802612:	83 ec 08             	sub    $0x8,%esp
+  802615:	ff 75 0c             	push   0xc(%ebp)
+  802618:	50                   	push   %eax
+  802619:	e8 64 ff ff ff       	call   802582 <fstat>
+  80261e:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802620:	89 1c 24             	mov    %ebx,(%esp)
+  802623:	e8 c6 fb ff ff       	call   8021ee <close>
+	return r;
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	89 f3                	mov    %esi,%ebx
+}
+  80262d:	89 d8                	mov    %ebx,%eax
+  80262f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802632:	5b                   	pop    %ebx
+  802633:	5e                   	pop    %esi
+  802634:	5d                   	pop    %ebp
+  802635:	c3                   	ret
+
+00802636 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802636:	55                   	push   %ebp
+  802637:	89 e5                	mov    %esp,%ebp
+  802639:	56                   	push   %esi
+  80263a:	53                   	push   %ebx
+  80263b:	89 c6                	mov    %eax,%esi
+  80263d:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80263f:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  802646:	74 27                	je     80266f <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802648:	6a 07                	push   $0x7
+  80264a:	68 00 60 80 00       	push   $0x806000
+  80264f:	56                   	push   %esi
+  802650:	ff 35 00 50 80 00    	push   0x805000
+  802656:	e8 93 0d 00 00       	call   8033ee <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80265b:	83 c4 0c             	add    $0xc,%esp
+  80265e:	6a 00                	push   $0x0
+  802660:	53                   	push   %ebx
+  802661:	6a 00                	push   $0x0
+  802663:	e8 6e 0d 00 00       	call   8033d6 <ipc_recv>
+}
+  802668:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80266b:	5b                   	pop    %ebx
+  80266c:	5e                   	pop    %esi
+  80266d:	5d                   	pop    %ebp
+  80266e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80266f:	83 ec 0c             	sub    $0xc,%esp
+  802672:	6a 01                	push   $0x1
+  802674:	e8 c9 0d 00 00       	call   803442 <ipc_find_env>
+  802679:	a3 00 50 80 00       	mov    %eax,0x805000
+  80267e:	83 c4 10             	add    $0x10,%esp
+  802681:	eb c5                	jmp    802648 <fsipc+0x12>
+
+00802683 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802683:	55                   	push   %ebp
+  802684:	89 e5                	mov    %esp,%ebp
+  802686:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80268f:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802694:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802697:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80269c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8026a6:	e8 8b ff ff ff       	call   802636 <fsipc>
+}
+  8026ab:	c9                   	leave
+  8026ac:	c3                   	ret
+
+008026ad <devfile_flush>:
+{
+  8026ad:	55                   	push   %ebp
+  8026ae:	89 e5                	mov    %esp,%ebp
+  8026b0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8026b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026b9:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8026be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8026c8:	e8 69 ff ff ff       	call   802636 <fsipc>
+}
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+
+008026cf <devfile_stat>:
+{
+  8026cf:	55                   	push   %ebp
+  8026d0:	89 e5                	mov    %esp,%ebp
+  8026d2:	53                   	push   %ebx
+  8026d3:	83 ec 04             	sub    $0x4,%esp
+  8026d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8026d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026dc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026df:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8026e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026ee:	e8 43 ff ff ff       	call   802636 <fsipc>
+  8026f3:	85 c0                	test   %eax,%eax
+  8026f5:	78 2c                	js     802723 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8026f7:	83 ec 08             	sub    $0x8,%esp
+  8026fa:	68 00 60 80 00       	push   $0x806000
+  8026ff:	53                   	push   %ebx
+  802700:	e8 ac e2 ff ff       	call   8009b1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802705:	a1 80 60 80 00       	mov    0x806080,%eax
+  80270a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802710:	a1 84 60 80 00       	mov    0x806084,%eax
+  802715:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802723:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802726:	c9                   	leave
+  802727:	c3                   	ret
+
+00802728 <devfile_write>:
+{
+  802728:	55                   	push   %ebp
+  802729:	89 e5                	mov    %esp,%ebp
+  80272b:	83 ec 0c             	sub    $0xc,%esp
+  80272e:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802731:	8b 55 08             	mov    0x8(%ebp),%edx
+  802734:	8b 52 0c             	mov    0xc(%edx),%edx
+  802737:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  80273d:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  802742:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802747:	39 d0                	cmp    %edx,%eax
+  802749:	0f 47 c2             	cmova  %edx,%eax
+  80274c:	50                   	push   %eax
+  80274d:	ff 75 0c             	push   0xc(%ebp)
+  802750:	68 08 60 80 00       	push   $0x806008
+  802755:	e8 dd e3 ff ff       	call   800b37 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80275a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802764:	e8 cd fe ff ff       	call   802636 <fsipc>
+}
+  802769:	c9                   	leave
+  80276a:	c3                   	ret
+
+0080276b <devfile_read>:
+{
+  80276b:	55                   	push   %ebp
+  80276c:	89 e5                	mov    %esp,%ebp
+  80276e:	56                   	push   %esi
+  80276f:	53                   	push   %ebx
+  802770:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802773:	8b 45 08             	mov    0x8(%ebp),%eax
+  802776:	8b 40 0c             	mov    0xc(%eax),%eax
+  802779:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80277e:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802784:	ba 00 00 00 00       	mov    $0x0,%edx
+  802789:	b8 03 00 00 00       	mov    $0x3,%eax
+  80278e:	e8 a3 fe ff ff       	call   802636 <fsipc>
+  802793:	89 c3                	mov    %eax,%ebx
+  802795:	85 c0                	test   %eax,%eax
+  802797:	78 1f                	js     8027b8 <devfile_read+0x4d>
+	assert(r <= n);
+  802799:	39 c6                	cmp    %eax,%esi
+  80279b:	72 24                	jb     8027c1 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80279d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8027a2:	7f 33                	jg     8027d7 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8027a4:	83 ec 04             	sub    $0x4,%esp
+  8027a7:	50                   	push   %eax
+  8027a8:	68 00 60 80 00       	push   $0x806000
+  8027ad:	ff 75 0c             	push   0xc(%ebp)
+  8027b0:	e8 82 e3 ff ff       	call   800b37 <memmove>
+	return r;
+  8027b5:	83 c4 10             	add    $0x10,%esp
+}
+  8027b8:	89 d8                	mov    %ebx,%eax
+  8027ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027bd:	5b                   	pop    %ebx
+  8027be:	5e                   	pop    %esi
+  8027bf:	5d                   	pop    %ebp
+  8027c0:	c3                   	ret
+	assert(r <= n);
+  8027c1:	68 40 3b 80 00       	push   $0x803b40
+  8027c6:	68 30 3a 80 00       	push   $0x803a30
+  8027cb:	6a 76                	push   $0x76
+  8027cd:	68 47 3b 80 00       	push   $0x803b47
+  8027d2:	e8 b7 da ff ff       	call   80028e <_panic>
+	assert(r <= PGSIZE);
+  8027d7:	68 52 3b 80 00       	push   $0x803b52
+  8027dc:	68 30 3a 80 00       	push   $0x803a30
+  8027e1:	6a 77                	push   $0x77
+  8027e3:	68 47 3b 80 00       	push   $0x803b47
+  8027e8:	e8 a1 da ff ff       	call   80028e <_panic>
+
+008027ed <open>:
+{
+  8027ed:	55                   	push   %ebp
+  8027ee:	89 e5                	mov    %esp,%ebp
+  8027f0:	56                   	push   %esi
+  8027f1:	53                   	push   %ebx
+  8027f2:	83 ec 1c             	sub    $0x1c,%esp
+  8027f5:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8027f8:	56                   	push   %esi
+  8027f9:	e8 78 e1 ff ff       	call   800976 <strlen>
+  8027fe:	83 c4 10             	add    $0x10,%esp
+  802801:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802806:	7f 6c                	jg     802874 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802808:	83 ec 0c             	sub    $0xc,%esp
+  80280b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80280e:	50                   	push   %eax
+  80280f:	e8 3a f8 ff ff       	call   80204e <fd_alloc>
+  802814:	89 c3                	mov    %eax,%ebx
+  802816:	83 c4 10             	add    $0x10,%esp
+  802819:	85 c0                	test   %eax,%eax
+  80281b:	78 3c                	js     802859 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80281d:	83 ec 08             	sub    $0x8,%esp
+  802820:	56                   	push   %esi
+  802821:	68 00 60 80 00       	push   $0x806000
+  802826:	e8 86 e1 ff ff       	call   8009b1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80282b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80282e:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802833:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802836:	b8 01 00 00 00       	mov    $0x1,%eax
+  80283b:	e8 f6 fd ff ff       	call   802636 <fsipc>
+  802840:	89 c3                	mov    %eax,%ebx
+  802842:	83 c4 10             	add    $0x10,%esp
+  802845:	85 c0                	test   %eax,%eax
+  802847:	78 19                	js     802862 <open+0x75>
+	return fd2num(fd);
+  802849:	83 ec 0c             	sub    $0xc,%esp
+  80284c:	ff 75 f4             	push   -0xc(%ebp)
+  80284f:	e8 d3 f7 ff ff       	call   802027 <fd2num>
+  802854:	89 c3                	mov    %eax,%ebx
+  802856:	83 c4 10             	add    $0x10,%esp
+}
+  802859:	89 d8                	mov    %ebx,%eax
+  80285b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80285e:	5b                   	pop    %ebx
+  80285f:	5e                   	pop    %esi
+  802860:	5d                   	pop    %ebp
+  802861:	c3                   	ret
+		fd_close(fd, 0);
+  802862:	83 ec 08             	sub    $0x8,%esp
+  802865:	6a 00                	push   $0x0
+  802867:	ff 75 f4             	push   -0xc(%ebp)
+  80286a:	e8 f8 f8 ff ff       	call   802167 <fd_close>
+		return r;
+  80286f:	83 c4 10             	add    $0x10,%esp
+  802872:	eb e5                	jmp    802859 <open+0x6c>
+		return -E_BAD_PATH;
+  802874:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802879:	eb de                	jmp    802859 <open+0x6c>
+
+0080287b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80287b:	55                   	push   %ebp
+  80287c:	89 e5                	mov    %esp,%ebp
+  80287e:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802881:	ba 00 00 00 00       	mov    $0x0,%edx
+  802886:	b8 08 00 00 00       	mov    $0x8,%eax
+  80288b:	e8 a6 fd ff ff       	call   802636 <fsipc>
+}
+  802890:	c9                   	leave
+  802891:	c3                   	ret
+
+00802892 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802892:	55                   	push   %ebp
+  802893:	89 e5                	mov    %esp,%ebp
+  802895:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802898:	68 5e 3b 80 00       	push   $0x803b5e
+  80289d:	ff 75 0c             	push   0xc(%ebp)
+  8028a0:	e8 0c e1 ff ff       	call   8009b1 <strcpy>
+	return 0;
+}
+  8028a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028aa:	c9                   	leave
+  8028ab:	c3                   	ret
+
+008028ac <devsock_close>:
+{
+  8028ac:	55                   	push   %ebp
+  8028ad:	89 e5                	mov    %esp,%ebp
+  8028af:	53                   	push   %ebx
+  8028b0:	83 ec 10             	sub    $0x10,%esp
+  8028b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8028b6:	53                   	push   %ebx
+  8028b7:	e8 c5 0b 00 00       	call   803481 <pageref>
+  8028bc:	89 c2                	mov    %eax,%edx
+  8028be:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8028c1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8028c6:	83 fa 01             	cmp    $0x1,%edx
+  8028c9:	74 05                	je     8028d0 <devsock_close+0x24>
+}
+  8028cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ce:	c9                   	leave
+  8028cf:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8028d0:	83 ec 0c             	sub    $0xc,%esp
+  8028d3:	ff 73 0c             	push   0xc(%ebx)
+  8028d6:	e8 b7 02 00 00       	call   802b92 <nsipc_close>
+  8028db:	83 c4 10             	add    $0x10,%esp
+  8028de:	eb eb                	jmp    8028cb <devsock_close+0x1f>
+
+008028e0 <devsock_write>:
+{
+  8028e0:	55                   	push   %ebp
+  8028e1:	89 e5                	mov    %esp,%ebp
+  8028e3:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8028e6:	6a 00                	push   $0x0
+  8028e8:	ff 75 10             	push   0x10(%ebp)
+  8028eb:	ff 75 0c             	push   0xc(%ebp)
+  8028ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f1:	ff 70 0c             	push   0xc(%eax)
+  8028f4:	e8 79 03 00 00       	call   802c72 <nsipc_send>
+}
+  8028f9:	c9                   	leave
+  8028fa:	c3                   	ret
+
+008028fb <devsock_read>:
+{
+  8028fb:	55                   	push   %ebp
+  8028fc:	89 e5                	mov    %esp,%ebp
+  8028fe:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802901:	6a 00                	push   $0x0
+  802903:	ff 75 10             	push   0x10(%ebp)
+  802906:	ff 75 0c             	push   0xc(%ebp)
+  802909:	8b 45 08             	mov    0x8(%ebp),%eax
+  80290c:	ff 70 0c             	push   0xc(%eax)
+  80290f:	e8 ef 02 00 00       	call   802c03 <nsipc_recv>
+}
+  802914:	c9                   	leave
+  802915:	c3                   	ret
+
+00802916 <fd2sockid>:
+{
+  802916:	55                   	push   %ebp
+  802917:	89 e5                	mov    %esp,%ebp
+  802919:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80291c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80291f:	52                   	push   %edx
+  802920:	50                   	push   %eax
+  802921:	e8 7e f7 ff ff       	call   8020a4 <fd_lookup>
+  802926:	83 c4 10             	add    $0x10,%esp
+  802929:	85 c0                	test   %eax,%eax
+  80292b:	78 10                	js     80293d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80292d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802930:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802936:	39 08                	cmp    %ecx,(%eax)
+  802938:	75 05                	jne    80293f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80293a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80293d:	c9                   	leave
+  80293e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80293f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802944:	eb f7                	jmp    80293d <fd2sockid+0x27>
+
+00802946 <alloc_sockfd>:
+{
+  802946:	55                   	push   %ebp
+  802947:	89 e5                	mov    %esp,%ebp
+  802949:	56                   	push   %esi
+  80294a:	53                   	push   %ebx
+  80294b:	83 ec 1c             	sub    $0x1c,%esp
+  80294e:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802950:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802953:	50                   	push   %eax
+  802954:	e8 f5 f6 ff ff       	call   80204e <fd_alloc>
+  802959:	89 c3                	mov    %eax,%ebx
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	78 43                	js     8029a5 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802962:	83 ec 04             	sub    $0x4,%esp
+  802965:	68 07 04 00 00       	push   $0x407
+  80296a:	ff 75 f4             	push   -0xc(%ebp)
+  80296d:	6a 00                	push   $0x0
+  80296f:	e8 35 e5 ff ff       	call   800ea9 <sys_page_alloc>
+  802974:	89 c3                	mov    %eax,%ebx
+  802976:	83 c4 10             	add    $0x10,%esp
+  802979:	85 c0                	test   %eax,%eax
+  80297b:	78 28                	js     8029a5 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80297d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802980:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802986:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802988:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80298b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802992:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802995:	83 ec 0c             	sub    $0xc,%esp
+  802998:	50                   	push   %eax
+  802999:	e8 89 f6 ff ff       	call   802027 <fd2num>
+  80299e:	89 c3                	mov    %eax,%ebx
+  8029a0:	83 c4 10             	add    $0x10,%esp
+  8029a3:	eb 0c                	jmp    8029b1 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8029a5:	83 ec 0c             	sub    $0xc,%esp
+  8029a8:	56                   	push   %esi
+  8029a9:	e8 e4 01 00 00       	call   802b92 <nsipc_close>
+		return r;
+  8029ae:	83 c4 10             	add    $0x10,%esp
+}
+  8029b1:	89 d8                	mov    %ebx,%eax
+  8029b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029b6:	5b                   	pop    %ebx
+  8029b7:	5e                   	pop    %esi
+  8029b8:	5d                   	pop    %ebp
+  8029b9:	c3                   	ret
+
+008029ba <accept>:
+{
+  8029ba:	55                   	push   %ebp
+  8029bb:	89 e5                	mov    %esp,%ebp
+  8029bd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c3:	e8 4e ff ff ff       	call   802916 <fd2sockid>
+  8029c8:	85 c0                	test   %eax,%eax
+  8029ca:	78 1b                	js     8029e7 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8029cc:	83 ec 04             	sub    $0x4,%esp
+  8029cf:	ff 75 10             	push   0x10(%ebp)
+  8029d2:	ff 75 0c             	push   0xc(%ebp)
+  8029d5:	50                   	push   %eax
+  8029d6:	e8 0e 01 00 00       	call   802ae9 <nsipc_accept>
+  8029db:	83 c4 10             	add    $0x10,%esp
+  8029de:	85 c0                	test   %eax,%eax
+  8029e0:	78 05                	js     8029e7 <accept+0x2d>
+	return alloc_sockfd(r);
+  8029e2:	e8 5f ff ff ff       	call   802946 <alloc_sockfd>
+}
+  8029e7:	c9                   	leave
+  8029e8:	c3                   	ret
+
+008029e9 <bind>:
+{
+  8029e9:	55                   	push   %ebp
+  8029ea:	89 e5                	mov    %esp,%ebp
+  8029ec:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f2:	e8 1f ff ff ff       	call   802916 <fd2sockid>
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	78 12                	js     802a0d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8029fb:	83 ec 04             	sub    $0x4,%esp
+  8029fe:	ff 75 10             	push   0x10(%ebp)
+  802a01:	ff 75 0c             	push   0xc(%ebp)
+  802a04:	50                   	push   %eax
+  802a05:	e8 31 01 00 00       	call   802b3b <nsipc_bind>
+  802a0a:	83 c4 10             	add    $0x10,%esp
+}
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+
+00802a0f <shutdown>:
+{
+  802a0f:	55                   	push   %ebp
+  802a10:	89 e5                	mov    %esp,%ebp
+  802a12:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a18:	e8 f9 fe ff ff       	call   802916 <fd2sockid>
+  802a1d:	85 c0                	test   %eax,%eax
+  802a1f:	78 0f                	js     802a30 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802a21:	83 ec 08             	sub    $0x8,%esp
+  802a24:	ff 75 0c             	push   0xc(%ebp)
+  802a27:	50                   	push   %eax
+  802a28:	e8 43 01 00 00       	call   802b70 <nsipc_shutdown>
+  802a2d:	83 c4 10             	add    $0x10,%esp
+}
+  802a30:	c9                   	leave
+  802a31:	c3                   	ret
+
+00802a32 <connect>:
+{
+  802a32:	55                   	push   %ebp
+  802a33:	89 e5                	mov    %esp,%ebp
+  802a35:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a3b:	e8 d6 fe ff ff       	call   802916 <fd2sockid>
+  802a40:	85 c0                	test   %eax,%eax
+  802a42:	78 12                	js     802a56 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802a44:	83 ec 04             	sub    $0x4,%esp
+  802a47:	ff 75 10             	push   0x10(%ebp)
+  802a4a:	ff 75 0c             	push   0xc(%ebp)
+  802a4d:	50                   	push   %eax
+  802a4e:	e8 59 01 00 00       	call   802bac <nsipc_connect>
+  802a53:	83 c4 10             	add    $0x10,%esp
+}
+  802a56:	c9                   	leave
+  802a57:	c3                   	ret
+
+00802a58 <listen>:
+{
+  802a58:	55                   	push   %ebp
+  802a59:	89 e5                	mov    %esp,%ebp
+  802a5b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a61:	e8 b0 fe ff ff       	call   802916 <fd2sockid>
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	78 0f                	js     802a79 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a6a:	83 ec 08             	sub    $0x8,%esp
+  802a6d:	ff 75 0c             	push   0xc(%ebp)
+  802a70:	50                   	push   %eax
+  802a71:	e8 6b 01 00 00       	call   802be1 <nsipc_listen>
+  802a76:	83 c4 10             	add    $0x10,%esp
+}
+  802a79:	c9                   	leave
+  802a7a:	c3                   	ret
+
+00802a7b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a7b:	55                   	push   %ebp
+  802a7c:	89 e5                	mov    %esp,%ebp
+  802a7e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a81:	ff 75 10             	push   0x10(%ebp)
+  802a84:	ff 75 0c             	push   0xc(%ebp)
+  802a87:	ff 75 08             	push   0x8(%ebp)
+  802a8a:	e8 41 02 00 00       	call   802cd0 <nsipc_socket>
+  802a8f:	83 c4 10             	add    $0x10,%esp
+  802a92:	85 c0                	test   %eax,%eax
+  802a94:	78 05                	js     802a9b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a96:	e8 ab fe ff ff       	call   802946 <alloc_sockfd>
+}
+  802a9b:	c9                   	leave
+  802a9c:	c3                   	ret
+
+00802a9d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a9d:	55                   	push   %ebp
+  802a9e:	89 e5                	mov    %esp,%ebp
+  802aa0:	53                   	push   %ebx
+  802aa1:	83 ec 04             	sub    $0x4,%esp
+  802aa4:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802aa6:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802aad:	74 26                	je     802ad5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802aaf:	6a 07                	push   $0x7
+  802ab1:	68 00 70 80 00       	push   $0x807000
+  802ab6:	53                   	push   %ebx
+  802ab7:	ff 35 04 50 80 00    	push   0x805004
+  802abd:	e8 2c 09 00 00       	call   8033ee <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802ac2:	83 c4 0c             	add    $0xc,%esp
+  802ac5:	6a 00                	push   $0x0
+  802ac7:	6a 00                	push   $0x0
+  802ac9:	6a 00                	push   $0x0
+  802acb:	e8 06 09 00 00       	call   8033d6 <ipc_recv>
+}
+  802ad0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad3:	c9                   	leave
+  802ad4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ad5:	83 ec 0c             	sub    $0xc,%esp
+  802ad8:	6a 02                	push   $0x2
+  802ada:	e8 63 09 00 00       	call   803442 <ipc_find_env>
+  802adf:	a3 04 50 80 00       	mov    %eax,0x805004
+  802ae4:	83 c4 10             	add    $0x10,%esp
+  802ae7:	eb c6                	jmp    802aaf <nsipc+0x12>
+
+00802ae9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802ae9:	55                   	push   %ebp
+  802aea:	89 e5                	mov    %esp,%ebp
+  802aec:	56                   	push   %esi
+  802aed:	53                   	push   %ebx
+  802aee:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802af1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802af9:	8b 06                	mov    (%esi),%eax
+  802afb:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b00:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b05:	e8 93 ff ff ff       	call   802a9d <nsipc>
+  802b0a:	89 c3                	mov    %eax,%ebx
+  802b0c:	85 c0                	test   %eax,%eax
+  802b0e:	79 09                	jns    802b19 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802b10:	89 d8                	mov    %ebx,%eax
+  802b12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b15:	5b                   	pop    %ebx
+  802b16:	5e                   	pop    %esi
+  802b17:	5d                   	pop    %ebp
+  802b18:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b19:	83 ec 04             	sub    $0x4,%esp
+  802b1c:	ff 35 10 70 80 00    	push   0x807010
+  802b22:	68 00 70 80 00       	push   $0x807000
+  802b27:	ff 75 0c             	push   0xc(%ebp)
+  802b2a:	e8 08 e0 ff ff       	call   800b37 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b2f:	a1 10 70 80 00       	mov    0x807010,%eax
+  802b34:	89 06                	mov    %eax,(%esi)
+  802b36:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b39:	eb d5                	jmp    802b10 <nsipc_accept+0x27>
+
+00802b3b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b3b:	55                   	push   %ebp
+  802b3c:	89 e5                	mov    %esp,%ebp
+  802b3e:	53                   	push   %ebx
+  802b3f:	83 ec 08             	sub    $0x8,%esp
+  802b42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b48:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802b4d:	53                   	push   %ebx
+  802b4e:	ff 75 0c             	push   0xc(%ebp)
+  802b51:	68 04 70 80 00       	push   $0x807004
+  802b56:	e8 dc df ff ff       	call   800b37 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b5b:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802b61:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b66:	e8 32 ff ff ff       	call   802a9d <nsipc>
+}
+  802b6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b6e:	c9                   	leave
+  802b6f:	c3                   	ret
+
+00802b70 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b70:	55                   	push   %ebp
+  802b71:	89 e5                	mov    %esp,%ebp
+  802b73:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b79:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802b7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b81:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b86:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b8b:	e8 0d ff ff ff       	call   802a9d <nsipc>
+}
+  802b90:	c9                   	leave
+  802b91:	c3                   	ret
+
+00802b92 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b92:	55                   	push   %ebp
+  802b93:	89 e5                	mov    %esp,%ebp
+  802b95:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9b:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802ba0:	b8 04 00 00 00       	mov    $0x4,%eax
+  802ba5:	e8 f3 fe ff ff       	call   802a9d <nsipc>
+}
+  802baa:	c9                   	leave
+  802bab:	c3                   	ret
+
+00802bac <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802bac:	55                   	push   %ebp
+  802bad:	89 e5                	mov    %esp,%ebp
+  802baf:	53                   	push   %ebx
+  802bb0:	83 ec 08             	sub    $0x8,%esp
+  802bb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802bb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb9:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802bbe:	53                   	push   %ebx
+  802bbf:	ff 75 0c             	push   0xc(%ebp)
+  802bc2:	68 04 70 80 00       	push   $0x807004
+  802bc7:	e8 6b df ff ff       	call   800b37 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802bcc:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802bd2:	b8 05 00 00 00       	mov    $0x5,%eax
+  802bd7:	e8 c1 fe ff ff       	call   802a9d <nsipc>
+}
+  802bdc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+
+00802be1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802be1:	55                   	push   %ebp
+  802be2:	89 e5                	mov    %esp,%ebp
+  802be4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802be7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bea:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802bef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bf2:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802bf7:	b8 06 00 00 00       	mov    $0x6,%eax
+  802bfc:	e8 9c fe ff ff       	call   802a9d <nsipc>
+}
+  802c01:	c9                   	leave
+  802c02:	c3                   	ret
+
+00802c03 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	56                   	push   %esi
+  802c07:	53                   	push   %ebx
+  802c08:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802c0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c0e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802c13:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802c19:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c1c:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c21:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c26:	e8 72 fe ff ff       	call   802a9d <nsipc>
+  802c2b:	89 c3                	mov    %eax,%ebx
+  802c2d:	85 c0                	test   %eax,%eax
+  802c2f:	78 22                	js     802c53 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c31:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c36:	39 c6                	cmp    %eax,%esi
+  802c38:	0f 4e c6             	cmovle %esi,%eax
+  802c3b:	39 c3                	cmp    %eax,%ebx
+  802c3d:	7f 1d                	jg     802c5c <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c3f:	83 ec 04             	sub    $0x4,%esp
+  802c42:	53                   	push   %ebx
+  802c43:	68 00 70 80 00       	push   $0x807000
+  802c48:	ff 75 0c             	push   0xc(%ebp)
+  802c4b:	e8 e7 de ff ff       	call   800b37 <memmove>
+  802c50:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c53:	89 d8                	mov    %ebx,%eax
+  802c55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c58:	5b                   	pop    %ebx
+  802c59:	5e                   	pop    %esi
+  802c5a:	5d                   	pop    %ebp
+  802c5b:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c5c:	68 6a 3b 80 00       	push   $0x803b6a
+  802c61:	68 30 3a 80 00       	push   $0x803a30
+  802c66:	6a 62                	push   $0x62
+  802c68:	68 7f 3b 80 00       	push   $0x803b7f
+  802c6d:	e8 1c d6 ff ff       	call   80028e <_panic>
+
+00802c72 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c72:	55                   	push   %ebp
+  802c73:	89 e5                	mov    %esp,%ebp
+  802c75:	53                   	push   %ebx
+  802c76:	83 ec 04             	sub    $0x4,%esp
+  802c79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7f:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802c84:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c8a:	7f 2e                	jg     802cba <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c8c:	83 ec 04             	sub    $0x4,%esp
+  802c8f:	53                   	push   %ebx
+  802c90:	ff 75 0c             	push   0xc(%ebp)
+  802c93:	68 0c 70 80 00       	push   $0x80700c
+  802c98:	e8 9a de ff ff       	call   800b37 <memmove>
+	nsipcbuf.send.req_size = size;
+  802c9d:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802ca3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ca6:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802cab:	b8 08 00 00 00       	mov    $0x8,%eax
+  802cb0:	e8 e8 fd ff ff       	call   802a9d <nsipc>
+}
+  802cb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cb8:	c9                   	leave
+  802cb9:	c3                   	ret
+	assert(size < 1600);
+  802cba:	68 8b 3b 80 00       	push   $0x803b8b
+  802cbf:	68 30 3a 80 00       	push   $0x803a30
+  802cc4:	6a 6d                	push   $0x6d
+  802cc6:	68 7f 3b 80 00       	push   $0x803b7f
+  802ccb:	e8 be d5 ff ff       	call   80028e <_panic>
+
+00802cd0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802cd0:	55                   	push   %ebp
+  802cd1:	89 e5                	mov    %esp,%ebp
+  802cd3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802cde:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ce1:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802ce6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ce9:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802cee:	b8 09 00 00 00       	mov    $0x9,%eax
+  802cf3:	e8 a5 fd ff ff       	call   802a9d <nsipc>
+}
+  802cf8:	c9                   	leave
+  802cf9:	c3                   	ret
+
+00802cfa <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802cfa:	55                   	push   %ebp
+  802cfb:	89 e5                	mov    %esp,%ebp
+  802cfd:	56                   	push   %esi
+  802cfe:	53                   	push   %ebx
+  802cff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802d02:	83 ec 0c             	sub    $0xc,%esp
+  802d05:	ff 75 08             	push   0x8(%ebp)
+  802d08:	e8 2a f3 ff ff       	call   802037 <fd2data>
+  802d0d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802d0f:	83 c4 08             	add    $0x8,%esp
+  802d12:	68 97 3b 80 00       	push   $0x803b97
+  802d17:	53                   	push   %ebx
+  802d18:	e8 94 dc ff ff       	call   8009b1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802d1d:	8b 46 04             	mov    0x4(%esi),%eax
+  802d20:	2b 06                	sub    (%esi),%eax
+  802d22:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802d28:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802d2f:	00 00 00 
+	stat->st_dev = &devpipe;
+  802d32:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802d39:	40 80 00 
+	return 0;
+}
+  802d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d41:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d44:	5b                   	pop    %ebx
+  802d45:	5e                   	pop    %esi
+  802d46:	5d                   	pop    %ebp
+  802d47:	c3                   	ret
+
+00802d48 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802d48:	55                   	push   %ebp
+  802d49:	89 e5                	mov    %esp,%ebp
+  802d4b:	53                   	push   %ebx
+  802d4c:	83 ec 0c             	sub    $0xc,%esp
+  802d4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802d52:	53                   	push   %ebx
+  802d53:	6a 00                	push   $0x0
+  802d55:	e8 2a e2 ff ff       	call   800f84 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d5a:	89 1c 24             	mov    %ebx,(%esp)
+  802d5d:	e8 d5 f2 ff ff       	call   802037 <fd2data>
+  802d62:	83 c4 08             	add    $0x8,%esp
+  802d65:	50                   	push   %eax
+  802d66:	6a 00                	push   $0x0
+  802d68:	e8 17 e2 ff ff       	call   800f84 <sys_page_unmap>
+}
+  802d6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d70:	c9                   	leave
+  802d71:	c3                   	ret
+
+00802d72 <_pipeisclosed>:
+{
+  802d72:	55                   	push   %ebp
+  802d73:	89 e5                	mov    %esp,%ebp
+  802d75:	57                   	push   %edi
+  802d76:	56                   	push   %esi
+  802d77:	53                   	push   %ebx
+  802d78:	83 ec 1c             	sub    $0x1c,%esp
+  802d7b:	89 c7                	mov    %eax,%edi
+  802d7d:	89 d6                	mov    %edx,%esi
+  802d7f:	eb 3c                	jmp    802dbd <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802d81:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802d84:	83 ec 0c             	sub    $0xc,%esp
+  802d87:	57                   	push   %edi
+  802d88:	e8 f4 06 00 00       	call   803481 <pageref>
+  802d8d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d90:	89 34 24             	mov    %esi,(%esp)
+  802d93:	e8 e9 06 00 00       	call   803481 <pageref>
+  802d98:	89 c2                	mov    %eax,%edx
+  802d9a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d9c:	05 00 00 00 20       	add    $0x20000000,%eax
+  802da1:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802da4:	8b 0d 20 54 80 00    	mov    0x805420,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802daa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802daf:	76 31                	jbe    802de2 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802db1:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802db4:	39 c3                	cmp    %eax,%ebx
+  802db6:	74 76                	je     802e2e <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802db8:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802dbb:	74 36                	je     802df3 <_pipeisclosed+0x81>
+  802dbd:	89 e0                	mov    %esp,%eax
+  802dbf:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802dc4:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802dca:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802dcf:	77 b0                	ja     802d81 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802dd1:	c1 e8 10             	shr    $0x10,%eax
+  802dd4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802dda:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802de0:	eb 9f                	jmp    802d81 <_pipeisclosed+0xf>
+  802de2:	c1 e8 10             	shr    $0x10,%eax
+  802de5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802deb:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802df1:	eb be                	jmp    802db1 <_pipeisclosed+0x3f>
+  802df3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802df5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802dfa:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e00:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e05:	76 16                	jbe    802e1d <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e07:	8b 42 58             	mov    0x58(%edx),%eax
+  802e0a:	6a 01                	push   $0x1
+  802e0c:	50                   	push   %eax
+  802e0d:	53                   	push   %ebx
+  802e0e:	68 9e 3b 80 00       	push   $0x803b9e
+  802e13:	e8 51 d5 ff ff       	call   800369 <cprintf>
+  802e18:	83 c4 10             	add    $0x10,%esp
+  802e1b:	eb a0                	jmp    802dbd <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e1d:	c1 e8 10             	shr    $0x10,%eax
+  802e20:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e26:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e2c:	eb d9                	jmp    802e07 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802e2e:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802e31:	0f 94 c0             	sete   %al
+  802e34:	0f b6 c0             	movzbl %al,%eax
+}
+  802e37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e3a:	5b                   	pop    %ebx
+  802e3b:	5e                   	pop    %esi
+  802e3c:	5f                   	pop    %edi
+  802e3d:	5d                   	pop    %ebp
+  802e3e:	c3                   	ret
+
+00802e3f <devpipe_write>:
+{
+  802e3f:	55                   	push   %ebp
+  802e40:	89 e5                	mov    %esp,%ebp
+  802e42:	57                   	push   %edi
+  802e43:	56                   	push   %esi
+  802e44:	53                   	push   %ebx
+  802e45:	83 ec 28             	sub    $0x28,%esp
+  802e48:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802e4b:	56                   	push   %esi
+  802e4c:	e8 e6 f1 ff ff       	call   802037 <fd2data>
+  802e51:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802e53:	83 c4 10             	add    $0x10,%esp
+  802e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802e5e:	75 09                	jne    802e69 <devpipe_write+0x2a>
+	return i;
+  802e60:	89 f8                	mov    %edi,%eax
+  802e62:	eb 23                	jmp    802e87 <devpipe_write+0x48>
+			sys_yield();
+  802e64:	e8 fa df ff ff       	call   800e63 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802e69:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e6c:	8b 0b                	mov    (%ebx),%ecx
+  802e6e:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e71:	39 d0                	cmp    %edx,%eax
+  802e73:	72 1a                	jb     802e8f <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802e75:	89 da                	mov    %ebx,%edx
+  802e77:	89 f0                	mov    %esi,%eax
+  802e79:	e8 f4 fe ff ff       	call   802d72 <_pipeisclosed>
+  802e7e:	85 c0                	test   %eax,%eax
+  802e80:	74 e2                	je     802e64 <devpipe_write+0x25>
+				return 0;
+  802e82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e8a:	5b                   	pop    %ebx
+  802e8b:	5e                   	pop    %esi
+  802e8c:	5f                   	pop    %edi
+  802e8d:	5d                   	pop    %ebp
+  802e8e:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e92:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802e96:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802e99:	89 c2                	mov    %eax,%edx
+  802e9b:	c1 fa 1f             	sar    $0x1f,%edx
+  802e9e:	89 d1                	mov    %edx,%ecx
+  802ea0:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ea3:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ea6:	83 e2 1f             	and    $0x1f,%edx
+  802ea9:	29 ca                	sub    %ecx,%edx
+  802eab:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802eaf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802eb3:	83 c0 01             	add    $0x1,%eax
+  802eb6:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802eb9:	83 c7 01             	add    $0x1,%edi
+  802ebc:	eb 9d                	jmp    802e5b <devpipe_write+0x1c>
+
+00802ebe <devpipe_read>:
+{
+  802ebe:	55                   	push   %ebp
+  802ebf:	89 e5                	mov    %esp,%ebp
+  802ec1:	57                   	push   %edi
+  802ec2:	56                   	push   %esi
+  802ec3:	53                   	push   %ebx
+  802ec4:	83 ec 18             	sub    $0x18,%esp
+  802ec7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802eca:	57                   	push   %edi
+  802ecb:	e8 67 f1 ff ff       	call   802037 <fd2data>
+  802ed0:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ed2:	83 c4 10             	add    $0x10,%esp
+  802ed5:	be 00 00 00 00       	mov    $0x0,%esi
+  802eda:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802edd:	75 13                	jne    802ef2 <devpipe_read+0x34>
+	return i;
+  802edf:	89 f0                	mov    %esi,%eax
+  802ee1:	eb 02                	jmp    802ee5 <devpipe_read+0x27>
+				return i;
+  802ee3:	89 f0                	mov    %esi,%eax
+}
+  802ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ee8:	5b                   	pop    %ebx
+  802ee9:	5e                   	pop    %esi
+  802eea:	5f                   	pop    %edi
+  802eeb:	5d                   	pop    %ebp
+  802eec:	c3                   	ret
+			sys_yield();
+  802eed:	e8 71 df ff ff       	call   800e63 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802ef2:	8b 03                	mov    (%ebx),%eax
+  802ef4:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802ef7:	75 18                	jne    802f11 <devpipe_read+0x53>
+			if (i > 0)
+  802ef9:	85 f6                	test   %esi,%esi
+  802efb:	75 e6                	jne    802ee3 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802efd:	89 da                	mov    %ebx,%edx
+  802eff:	89 f8                	mov    %edi,%eax
+  802f01:	e8 6c fe ff ff       	call   802d72 <_pipeisclosed>
+  802f06:	85 c0                	test   %eax,%eax
+  802f08:	74 e3                	je     802eed <devpipe_read+0x2f>
+				return 0;
+  802f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0f:	eb d4                	jmp    802ee5 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f11:	99                   	cltd
+  802f12:	c1 ea 1b             	shr    $0x1b,%edx
+  802f15:	01 d0                	add    %edx,%eax
+  802f17:	83 e0 1f             	and    $0x1f,%eax
+  802f1a:	29 d0                	sub    %edx,%eax
+  802f1c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f24:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802f27:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802f2a:	83 c6 01             	add    $0x1,%esi
+  802f2d:	eb ab                	jmp    802eda <devpipe_read+0x1c>
+
+00802f2f <pipe>:
+{
+  802f2f:	55                   	push   %ebp
+  802f30:	89 e5                	mov    %esp,%ebp
+  802f32:	56                   	push   %esi
+  802f33:	53                   	push   %ebx
+  802f34:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802f37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f3a:	50                   	push   %eax
+  802f3b:	e8 0e f1 ff ff       	call   80204e <fd_alloc>
+  802f40:	89 c3                	mov    %eax,%ebx
+  802f42:	83 c4 10             	add    $0x10,%esp
+  802f45:	85 c0                	test   %eax,%eax
+  802f47:	0f 88 23 01 00 00    	js     803070 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f4d:	83 ec 04             	sub    $0x4,%esp
+  802f50:	68 07 04 00 00       	push   $0x407
+  802f55:	ff 75 f4             	push   -0xc(%ebp)
+  802f58:	6a 00                	push   $0x0
+  802f5a:	e8 4a df ff ff       	call   800ea9 <sys_page_alloc>
+  802f5f:	89 c3                	mov    %eax,%ebx
+  802f61:	83 c4 10             	add    $0x10,%esp
+  802f64:	85 c0                	test   %eax,%eax
+  802f66:	0f 88 04 01 00 00    	js     803070 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802f6c:	83 ec 0c             	sub    $0xc,%esp
+  802f6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f72:	50                   	push   %eax
+  802f73:	e8 d6 f0 ff ff       	call   80204e <fd_alloc>
+  802f78:	89 c3                	mov    %eax,%ebx
+  802f7a:	83 c4 10             	add    $0x10,%esp
+  802f7d:	85 c0                	test   %eax,%eax
+  802f7f:	0f 88 db 00 00 00    	js     803060 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f85:	83 ec 04             	sub    $0x4,%esp
+  802f88:	68 07 04 00 00       	push   $0x407
+  802f8d:	ff 75 f0             	push   -0x10(%ebp)
+  802f90:	6a 00                	push   $0x0
+  802f92:	e8 12 df ff ff       	call   800ea9 <sys_page_alloc>
+  802f97:	89 c3                	mov    %eax,%ebx
+  802f99:	83 c4 10             	add    $0x10,%esp
+  802f9c:	85 c0                	test   %eax,%eax
+  802f9e:	0f 88 bc 00 00 00    	js     803060 <pipe+0x131>
+	va = fd2data(fd0);
+  802fa4:	83 ec 0c             	sub    $0xc,%esp
+  802fa7:	ff 75 f4             	push   -0xc(%ebp)
+  802faa:	e8 88 f0 ff ff       	call   802037 <fd2data>
+  802faf:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fb1:	83 c4 0c             	add    $0xc,%esp
+  802fb4:	68 07 04 00 00       	push   $0x407
+  802fb9:	50                   	push   %eax
+  802fba:	6a 00                	push   $0x0
+  802fbc:	e8 e8 de ff ff       	call   800ea9 <sys_page_alloc>
+  802fc1:	89 c3                	mov    %eax,%ebx
+  802fc3:	83 c4 10             	add    $0x10,%esp
+  802fc6:	85 c0                	test   %eax,%eax
+  802fc8:	0f 88 82 00 00 00    	js     803050 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fce:	83 ec 0c             	sub    $0xc,%esp
+  802fd1:	ff 75 f0             	push   -0x10(%ebp)
+  802fd4:	e8 5e f0 ff ff       	call   802037 <fd2data>
+  802fd9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802fe0:	50                   	push   %eax
+  802fe1:	6a 00                	push   $0x0
+  802fe3:	56                   	push   %esi
+  802fe4:	6a 00                	push   $0x0
+  802fe6:	e8 2b df ff ff       	call   800f16 <sys_page_map>
+  802feb:	89 c3                	mov    %eax,%ebx
+  802fed:	83 c4 20             	add    $0x20,%esp
+  802ff0:	85 c0                	test   %eax,%eax
+  802ff2:	78 4e                	js     803042 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802ff4:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802ff9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802ffc:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802ffe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803001:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803008:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80300b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80300d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803010:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803017:	83 ec 0c             	sub    $0xc,%esp
+  80301a:	ff 75 f4             	push   -0xc(%ebp)
+  80301d:	e8 05 f0 ff ff       	call   802027 <fd2num>
+  803022:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803025:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803027:	83 c4 04             	add    $0x4,%esp
+  80302a:	ff 75 f0             	push   -0x10(%ebp)
+  80302d:	e8 f5 ef ff ff       	call   802027 <fd2num>
+  803032:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803035:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803038:	83 c4 10             	add    $0x10,%esp
+  80303b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803040:	eb 2e                	jmp    803070 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803042:	83 ec 08             	sub    $0x8,%esp
+  803045:	56                   	push   %esi
+  803046:	6a 00                	push   $0x0
+  803048:	e8 37 df ff ff       	call   800f84 <sys_page_unmap>
+  80304d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803050:	83 ec 08             	sub    $0x8,%esp
+  803053:	ff 75 f0             	push   -0x10(%ebp)
+  803056:	6a 00                	push   $0x0
+  803058:	e8 27 df ff ff       	call   800f84 <sys_page_unmap>
+  80305d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803060:	83 ec 08             	sub    $0x8,%esp
+  803063:	ff 75 f4             	push   -0xc(%ebp)
+  803066:	6a 00                	push   $0x0
+  803068:	e8 17 df ff ff       	call   800f84 <sys_page_unmap>
+  80306d:	83 c4 10             	add    $0x10,%esp
+}
+  803070:	89 d8                	mov    %ebx,%eax
+  803072:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803075:	5b                   	pop    %ebx
+  803076:	5e                   	pop    %esi
+  803077:	5d                   	pop    %ebp
+  803078:	c3                   	ret
+
+00803079 <pipeisclosed>:
+{
+  803079:	55                   	push   %ebp
+  80307a:	89 e5                	mov    %esp,%ebp
+  80307c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80307f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803082:	50                   	push   %eax
+  803083:	ff 75 08             	push   0x8(%ebp)
+  803086:	e8 19 f0 ff ff       	call   8020a4 <fd_lookup>
+  80308b:	83 c4 10             	add    $0x10,%esp
+  80308e:	85 c0                	test   %eax,%eax
+  803090:	78 18                	js     8030aa <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803092:	83 ec 0c             	sub    $0xc,%esp
+  803095:	ff 75 f4             	push   -0xc(%ebp)
+  803098:	e8 9a ef ff ff       	call   802037 <fd2data>
+  80309d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80309f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030a2:	e8 cb fc ff ff       	call   802d72 <_pipeisclosed>
+  8030a7:	83 c4 10             	add    $0x10,%esp
+}
+  8030aa:	c9                   	leave
+  8030ab:	c3                   	ret
+
+008030ac <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8030ac:	55                   	push   %ebp
+  8030ad:	89 e5                	mov    %esp,%ebp
+  8030af:	56                   	push   %esi
+  8030b0:	53                   	push   %ebx
+  8030b1:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8030b4:	85 f6                	test   %esi,%esi
+  8030b6:	74 16                	je     8030ce <wait+0x22>
+	e = &envs[ENVX(envid)];
+  8030b8:	89 f3                	mov    %esi,%ebx
+  8030ba:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8030c0:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  8030c6:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8030cc:	eb 1b                	jmp    8030e9 <wait+0x3d>
+	assert(envid != 0);
+  8030ce:	68 b6 3b 80 00       	push   $0x803bb6
+  8030d3:	68 30 3a 80 00       	push   $0x803a30
+  8030d8:	6a 09                	push   $0x9
+  8030da:	68 c1 3b 80 00       	push   $0x803bc1
+  8030df:	e8 aa d1 ff ff       	call   80028e <_panic>
+		sys_yield();
+  8030e4:	e8 7a dd ff ff       	call   800e63 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8030e9:	8b 43 48             	mov    0x48(%ebx),%eax
+  8030ec:	39 f0                	cmp    %esi,%eax
+  8030ee:	75 07                	jne    8030f7 <wait+0x4b>
+  8030f0:	8b 43 54             	mov    0x54(%ebx),%eax
+  8030f3:	85 c0                	test   %eax,%eax
+  8030f5:	75 ed                	jne    8030e4 <wait+0x38>
+}
+  8030f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030fa:	5b                   	pop    %ebx
+  8030fb:	5e                   	pop    %esi
+  8030fc:	5d                   	pop    %ebp
+  8030fd:	c3                   	ret
+
+008030fe <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8030fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803103:	c3                   	ret
+
+00803104 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803104:	55                   	push   %ebp
+  803105:	89 e5                	mov    %esp,%ebp
+  803107:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80310a:	68 cc 3b 80 00       	push   $0x803bcc
+  80310f:	ff 75 0c             	push   0xc(%ebp)
+  803112:	e8 9a d8 ff ff       	call   8009b1 <strcpy>
+	return 0;
+}
+  803117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311c:	c9                   	leave
+  80311d:	c3                   	ret
+
+0080311e <devcons_write>:
+{
+  80311e:	55                   	push   %ebp
+  80311f:	89 e5                	mov    %esp,%ebp
+  803121:	57                   	push   %edi
+  803122:	56                   	push   %esi
+  803123:	53                   	push   %ebx
+  803124:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80312a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80312f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803135:	eb 2e                	jmp    803165 <devcons_write+0x47>
+		m = n - tot;
+  803137:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80313a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80313c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803141:	39 c3                	cmp    %eax,%ebx
+  803143:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803146:	83 ec 04             	sub    $0x4,%esp
+  803149:	53                   	push   %ebx
+  80314a:	89 f0                	mov    %esi,%eax
+  80314c:	03 45 0c             	add    0xc(%ebp),%eax
+  80314f:	50                   	push   %eax
+  803150:	57                   	push   %edi
+  803151:	e8 e1 d9 ff ff       	call   800b37 <memmove>
+		sys_cputs(buf, m);
+  803156:	83 c4 08             	add    $0x8,%esp
+  803159:	53                   	push   %ebx
+  80315a:	57                   	push   %edi
+  80315b:	e8 ca db ff ff       	call   800d2a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803160:	01 de                	add    %ebx,%esi
+  803162:	83 c4 10             	add    $0x10,%esp
+  803165:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803168:	72 cd                	jb     803137 <devcons_write+0x19>
+}
+  80316a:	89 f0                	mov    %esi,%eax
+  80316c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80316f:	5b                   	pop    %ebx
+  803170:	5e                   	pop    %esi
+  803171:	5f                   	pop    %edi
+  803172:	5d                   	pop    %ebp
+  803173:	c3                   	ret
+
+00803174 <devcons_read>:
+{
+  803174:	55                   	push   %ebp
+  803175:	89 e5                	mov    %esp,%ebp
+  803177:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80317a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803183:	75 07                	jne    80318c <devcons_read+0x18>
+  803185:	eb 1f                	jmp    8031a6 <devcons_read+0x32>
+		sys_yield();
+  803187:	e8 d7 dc ff ff       	call   800e63 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80318c:	e8 dd db ff ff       	call   800d6e <sys_cgetc>
+  803191:	85 c0                	test   %eax,%eax
+  803193:	74 f2                	je     803187 <devcons_read+0x13>
+	if (c < 0)
+  803195:	78 0f                	js     8031a6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803197:	83 f8 04             	cmp    $0x4,%eax
+  80319a:	74 0c                	je     8031a8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80319c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80319f:	88 02                	mov    %al,(%edx)
+	return 1;
+  8031a1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8031a6:	c9                   	leave
+  8031a7:	c3                   	ret
+		return 0;
+  8031a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ad:	eb f7                	jmp    8031a6 <devcons_read+0x32>
+
+008031af <cputchar>:
+{
+  8031af:	55                   	push   %ebp
+  8031b0:	89 e5                	mov    %esp,%ebp
+  8031b2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8031b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8031bb:	6a 01                	push   $0x1
+  8031bd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031c0:	50                   	push   %eax
+  8031c1:	e8 64 db ff ff       	call   800d2a <sys_cputs>
+}
+  8031c6:	83 c4 10             	add    $0x10,%esp
+  8031c9:	c9                   	leave
+  8031ca:	c3                   	ret
+
+008031cb <getchar>:
+{
+  8031cb:	55                   	push   %ebp
+  8031cc:	89 e5                	mov    %esp,%ebp
+  8031ce:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8031d1:	6a 01                	push   $0x1
+  8031d3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031d6:	50                   	push   %eax
+  8031d7:	6a 00                	push   $0x0
+  8031d9:	e8 4c f1 ff ff       	call   80232a <read>
+	if (r < 0)
+  8031de:	83 c4 10             	add    $0x10,%esp
+  8031e1:	85 c0                	test   %eax,%eax
+  8031e3:	78 06                	js     8031eb <getchar+0x20>
+	if (r < 1)
+  8031e5:	74 06                	je     8031ed <getchar+0x22>
+	return c;
+  8031e7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8031eb:	c9                   	leave
+  8031ec:	c3                   	ret
+		return -E_EOF;
+  8031ed:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8031f2:	eb f7                	jmp    8031eb <getchar+0x20>
+
+008031f4 <iscons>:
+{
+  8031f4:	55                   	push   %ebp
+  8031f5:	89 e5                	mov    %esp,%ebp
+  8031f7:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031fd:	50                   	push   %eax
+  8031fe:	ff 75 08             	push   0x8(%ebp)
+  803201:	e8 9e ee ff ff       	call   8020a4 <fd_lookup>
+  803206:	83 c4 10             	add    $0x10,%esp
+  803209:	85 c0                	test   %eax,%eax
+  80320b:	78 11                	js     80321e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80320d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803210:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803216:	39 10                	cmp    %edx,(%eax)
+  803218:	0f 94 c0             	sete   %al
+  80321b:	0f b6 c0             	movzbl %al,%eax
+}
+  80321e:	c9                   	leave
+  80321f:	c3                   	ret
+
+00803220 <opencons>:
+{
+  803220:	55                   	push   %ebp
+  803221:	89 e5                	mov    %esp,%ebp
+  803223:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803226:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803229:	50                   	push   %eax
+  80322a:	e8 1f ee ff ff       	call   80204e <fd_alloc>
+  80322f:	83 c4 10             	add    $0x10,%esp
+  803232:	85 c0                	test   %eax,%eax
+  803234:	78 3a                	js     803270 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803236:	83 ec 04             	sub    $0x4,%esp
+  803239:	68 07 04 00 00       	push   $0x407
+  80323e:	ff 75 f4             	push   -0xc(%ebp)
+  803241:	6a 00                	push   $0x0
+  803243:	e8 61 dc ff ff       	call   800ea9 <sys_page_alloc>
+  803248:	83 c4 10             	add    $0x10,%esp
+  80324b:	85 c0                	test   %eax,%eax
+  80324d:	78 21                	js     803270 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80324f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803252:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  803258:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80325a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80325d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803264:	83 ec 0c             	sub    $0xc,%esp
+  803267:	50                   	push   %eax
+  803268:	e8 ba ed ff ff       	call   802027 <fd2num>
+  80326d:	83 c4 10             	add    $0x10,%esp
+}
+  803270:	c9                   	leave
+  803271:	c3                   	ret
+
+00803272 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803272:	55                   	push   %ebp
+  803273:	89 e5                	mov    %esp,%ebp
+  803275:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803278:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80327f:	74 0a                	je     80328b <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803281:	8b 45 08             	mov    0x8(%ebp),%eax
+  803284:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803289:	c9                   	leave
+  80328a:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  80328b:	83 ec 04             	sub    $0x4,%esp
+  80328e:	6a 07                	push   $0x7
+  803290:	68 00 f0 bf ee       	push   $0xeebff000
+  803295:	6a 00                	push   $0x0
+  803297:	e8 0d dc ff ff       	call   800ea9 <sys_page_alloc>
+  80329c:	83 c4 10             	add    $0x10,%esp
+  80329f:	85 c0                	test   %eax,%eax
+  8032a1:	78 14                	js     8032b7 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8032a3:	83 ec 08             	sub    $0x8,%esp
+  8032a6:	68 d9 32 80 00       	push   $0x8032d9
+  8032ab:	6a 00                	push   $0x0
+  8032ad:	e8 13 de ff ff       	call   8010c5 <sys_env_set_pgfault_upcall>
+  8032b2:	83 c4 10             	add    $0x10,%esp
+  8032b5:	eb ca                	jmp    803281 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8032b7:	83 ec 08             	sub    $0x8,%esp
+  8032ba:	50                   	push   %eax
+  8032bb:	68 d8 3b 80 00       	push   $0x803bd8
+  8032c0:	e8 a4 d0 ff ff       	call   800369 <cprintf>
+			panic("set_pgfault_handler error");
+  8032c5:	83 c4 0c             	add    $0xc,%esp
+  8032c8:	68 e3 3b 80 00       	push   $0x803be3
+  8032cd:	6a 24                	push   $0x24
+  8032cf:	68 fd 3b 80 00       	push   $0x803bfd
+  8032d4:	e8 b5 cf ff ff       	call   80028e <_panic>
+
+008032d9 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8032d9:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8032da:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8032df:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8032e1:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8032e4:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  8032e8:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  8032eb:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  8032ef:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  8032f1:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  8032f5:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8032f6:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  8032fa:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  8032fb:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  8032fc:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803300:	c3                   	ret
+
+00803301 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  803301:	55                   	push   %ebp
+  803302:	89 e5                	mov    %esp,%ebp
+  803304:	56                   	push   %esi
+  803305:	53                   	push   %ebx
+  803306:	8b 75 08             	mov    0x8(%ebp),%esi
+  803309:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80330c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80330f:	85 c0                	test   %eax,%eax
+  803311:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803316:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  803319:	83 ec 08             	sub    $0x8,%esp
+  80331c:	ff 75 14             	push   0x14(%ebp)
+  80331f:	50                   	push   %eax
+  803320:	e8 95 df ff ff       	call   8012ba <sys_ipc_recv_until>
+  803325:	83 c4 10             	add    $0x10,%esp
+  803328:	85 c0                	test   %eax,%eax
+  80332a:	78 61                	js     80338d <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  80332c:	85 f6                	test   %esi,%esi
+  80332e:	74 1c                	je     80334c <ipc_recv_until+0x4b>
+  803330:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803332:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803337:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80333d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803342:	76 5f                	jbe    8033a3 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  803344:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  80334a:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  80334c:	85 db                	test   %ebx,%ebx
+  80334e:	74 1c                	je     80336c <ipc_recv_until+0x6b>
+  803350:	89 e0                	mov    %esp,%eax
+  803352:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803357:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80335d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803362:	76 50                	jbe    8033b4 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  803364:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  80336a:	89 03                	mov    %eax,(%ebx)
+  80336c:	89 e0                	mov    %esp,%eax
+  80336e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803373:	8b 15 20 54 80 00    	mov    0x805420,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803379:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80337e:	76 45                	jbe    8033c5 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803380:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  803386:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803389:	5b                   	pop    %ebx
+  80338a:	5e                   	pop    %esi
+  80338b:	5d                   	pop    %ebp
+  80338c:	c3                   	ret
+		if (from_env_store)
+  80338d:	85 f6                	test   %esi,%esi
+  80338f:	74 06                	je     803397 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803391:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  803397:	85 db                	test   %ebx,%ebx
+  803399:	74 eb                	je     803386 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  80339b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8033a1:	eb e3                	jmp    803386 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8033a3:	c1 e8 10             	shr    $0x10,%eax
+  8033a6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033ac:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033b2:	eb 90                	jmp    803344 <ipc_recv_until+0x43>
+  8033b4:	c1 e8 10             	shr    $0x10,%eax
+  8033b7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033bd:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033c3:	eb 9f                	jmp    803364 <ipc_recv_until+0x63>
+  8033c5:	c1 e8 10             	shr    $0x10,%eax
+  8033c8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8033ce:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8033d4:	eb aa                	jmp    803380 <ipc_recv_until+0x7f>
+
+008033d6 <ipc_recv>:
+{
+  8033d6:	55                   	push   %ebp
+  8033d7:	89 e5                	mov    %esp,%ebp
+  8033d9:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  8033dc:	6a 00                	push   $0x0
+  8033de:	ff 75 10             	push   0x10(%ebp)
+  8033e1:	ff 75 0c             	push   0xc(%ebp)
+  8033e4:	ff 75 08             	push   0x8(%ebp)
+  8033e7:	e8 15 ff ff ff       	call   803301 <ipc_recv_until>
+}
+  8033ec:	c9                   	leave
+  8033ed:	c3                   	ret
+
+008033ee <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8033ee:	55                   	push   %ebp
+  8033ef:	89 e5                	mov    %esp,%ebp
+  8033f1:	57                   	push   %edi
+  8033f2:	56                   	push   %esi
+  8033f3:	53                   	push   %ebx
+  8033f4:	83 ec 0c             	sub    $0xc,%esp
+  8033f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033fa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803400:	85 db                	test   %ebx,%ebx
+  803402:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803407:	0f 44 d8             	cmove  %eax,%ebx
+  80340a:	eb 05                	jmp    803411 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  80340c:	e8 52 da ff ff       	call   800e63 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  803411:	ff 75 14             	push   0x14(%ebp)
+  803414:	53                   	push   %ebx
+  803415:	56                   	push   %esi
+  803416:	57                   	push   %edi
+  803417:	e8 ea dd ff ff       	call   801206 <sys_ipc_try_send>
+  80341c:	83 c4 10             	add    $0x10,%esp
+  80341f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803422:	74 e8                	je     80340c <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  803424:	85 c0                	test   %eax,%eax
+  803426:	78 08                	js     803430 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  803428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80342b:	5b                   	pop    %ebx
+  80342c:	5e                   	pop    %esi
+  80342d:	5f                   	pop    %edi
+  80342e:	5d                   	pop    %ebp
+  80342f:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  803430:	50                   	push   %eax
+  803431:	68 0b 3c 80 00       	push   $0x803c0b
+  803436:	6a 4f                	push   $0x4f
+  803438:	68 1e 3c 80 00       	push   $0x803c1e
+  80343d:	e8 4c ce ff ff       	call   80028e <_panic>
+
+00803442 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803442:	55                   	push   %ebp
+  803443:	89 e5                	mov    %esp,%ebp
+  803445:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803448:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  80344d:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  803453:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803459:	8b 52 50             	mov    0x50(%edx),%edx
+  80345c:	39 ca                	cmp    %ecx,%edx
+  80345e:	74 11                	je     803471 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803460:	83 c0 01             	add    $0x1,%eax
+  803463:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803468:	75 e3                	jne    80344d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80346a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346f:	eb 0e                	jmp    80347f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803471:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803477:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80347c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80347f:	5d                   	pop    %ebp
+  803480:	c3                   	ret
+
+00803481 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803481:	55                   	push   %ebp
+  803482:	89 e5                	mov    %esp,%ebp
+  803484:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803487:	89 c2                	mov    %eax,%edx
+  803489:	c1 ea 16             	shr    $0x16,%edx
+  80348c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803493:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803498:	f6 c1 01             	test   $0x1,%cl
+  80349b:	74 1a                	je     8034b7 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  80349d:	c1 e8 0c             	shr    $0xc,%eax
+  8034a0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8034a7:	a8 01                	test   $0x1,%al
+  8034a9:	74 0c                	je     8034b7 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8034ab:	c1 e8 0c             	shr    $0xc,%eax
+  8034ae:	c1 e0 04             	shl    $0x4,%eax
+  8034b1:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8034b7:	89 d0                	mov    %edx,%eax
+  8034b9:	5d                   	pop    %ebp
+  8034ba:	c3                   	ret
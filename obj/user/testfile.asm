@@ -0,0 +1,6716 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4e 06 00 00       	call   80067f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 d3                	mov    %edx,%ebx
+	extern union Fsipc fsipcbuf;
+	envid_t fsenv;
+	
+	strcpy(fsipcbuf.open.req_path, path);
+  80003c:	50                   	push   %eax
+  80003d:	68 00 60 80 00       	push   $0x806000
+  800042:	e8 1f 0e 00 00       	call   800e66 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800047:	89 1d 00 64 80 00    	mov    %ebx,0x806400
+
+	fsenv = ipc_find_env(ENV_TYPE_FS);
+  80004d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800054:	e8 bc 1e 00 00       	call   801f15 <ipc_find_env>
+	ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800059:	6a 07                	push   $0x7
+  80005b:	68 00 60 80 00       	push   $0x806000
+  800060:	6a 01                	push   $0x1
+  800062:	50                   	push   %eax
+  800063:	e8 59 1e 00 00       	call   801ec1 <ipc_send>
+	return ipc_recv(NULL, FVA, NULL);
+  800068:	83 c4 1c             	add    $0x1c,%esp
+  80006b:	6a 00                	push   $0x0
+  80006d:	68 00 c0 cc cc       	push   $0xccccc000
+  800072:	6a 00                	push   $0x0
+  800074:	e8 30 1e 00 00       	call   801ea9 <ipc_recv>
+}
+  800079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007c:	c9                   	leave
+  80007d:	c3                   	ret
+
+0080007e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	57                   	push   %edi
+  800082:	56                   	push   %esi
+  800083:	53                   	push   %ebx
+  800084:	81 ec ac 02 00 00    	sub    $0x2ac,%esp
+	struct Fd fdcopy;
+	struct Stat st;
+	char buf[512];
+
+	// We open files manually first, to avoid the FD layer
+	if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80008a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008f:	b8 a0 31 80 00       	mov    $0x8031a0,%eax
+  800094:	e8 9a ff ff ff       	call   800033 <xopen>
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 89 fa 03 00 00    	jns    80049b <umain+0x41d>
+  8000a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000a4:	0f 85 df 03 00 00    	jne    800489 <umain+0x40b>
+		panic("serve_open /not-found: %e", r);
+	else if (r >= 0)
+		panic("serve_open /not-found succeeded!");
+
+	if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000af:	b8 d5 31 80 00       	mov    $0x8031d5,%eax
+  8000b4:	e8 7a ff ff ff       	call   800033 <xopen>
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	0f 88 ee 03 00 00    	js     8004af <umain+0x431>
+		panic("serve_open /newmotd: %e", r);
+	if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8000c1:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000c8:	0f 85 f3 03 00 00    	jne    8004c1 <umain+0x443>
+  8000ce:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000d5:	0f 85 e6 03 00 00    	jne    8004c1 <umain+0x443>
+  8000db:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000e2:	0f 85 d9 03 00 00    	jne    8004c1 <umain+0x443>
+		panic("serve_open did not fill struct Fd correctly\n");
+	cprintf("serve_open is good\n");
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	68 f6 31 80 00       	push   $0x8031f6
+  8000f0:	e8 29 07 00 00       	call   80081e <cprintf>
+
+	if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8000f5:	83 c4 08             	add    $0x8,%esp
+  8000f8:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	68 00 c0 cc cc       	push   $0xccccc000
+  800104:	ff 15 1c 40 80 00    	call   *0x80401c
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	0f 88 c0 03 00 00    	js     8004d5 <umain+0x457>
+		panic("file_stat: %e", r);
+	if (strlen(msg) != st.st_size)
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	ff 35 00 40 80 00    	push   0x804000
+  80011e:	e8 08 0d 00 00       	call   800e2b <strlen>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	3b 45 cc             	cmp    -0x34(%ebp),%eax
+  800129:	0f 85 b8 03 00 00    	jne    8004e7 <umain+0x469>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+	cprintf("file_stat is good\n");
+  80012f:	83 ec 0c             	sub    $0xc,%esp
+  800132:	68 18 32 80 00       	push   $0x803218
+  800137:	e8 e2 06 00 00       	call   80081e <cprintf>
+
+	memset(buf, 0, sizeof buf);
+  80013c:	83 c4 0c             	add    $0xc,%esp
+  80013f:	68 00 02 00 00       	push   $0x200
+  800144:	6a 00                	push   $0x0
+  800146:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  80014c:	53                   	push   %ebx
+  80014d:	e8 65 0e 00 00       	call   800fb7 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800152:	83 c4 0c             	add    $0xc,%esp
+  800155:	68 00 02 00 00       	push   $0x200
+  80015a:	53                   	push   %ebx
+  80015b:	68 00 c0 cc cc       	push   $0xccccc000
+  800160:	ff 15 10 40 80 00    	call   *0x804010
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	0f 88 9b 03 00 00    	js     80050c <umain+0x48e>
+		panic("file_read: %e", r);
+	if (strcmp(buf, msg) != 0)
+  800171:	83 ec 08             	sub    $0x8,%esp
+  800174:	ff 35 00 40 80 00    	push   0x804000
+  80017a:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	e8 91 0d 00 00       	call   800f17 <strcmp>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 85 8d 03 00 00    	jne    80051e <umain+0x4a0>
+		panic("file_read returned wrong data");
+	cprintf("file_read is good\n");
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	68 57 32 80 00       	push   $0x803257
+  800199:	e8 80 06 00 00       	call   80081e <cprintf>
+
+	if ((r = devfile.dev_close(FVA)) < 0)
+  80019e:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  8001a5:	ff 15 18 40 80 00    	call   *0x804018
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 7c 03 00 00    	js     800532 <umain+0x4b4>
+		panic("file_close: %e", r);
+	cprintf("file_close is good\n");
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	68 79 32 80 00       	push   $0x803279
+  8001be:	e8 5b 06 00 00       	call   80081e <cprintf>
+
+	// We're about to unmap the FD, but still need a way to get
+	// the stale filenum to serve_read, so we make a local copy.
+	// The file server won't think it's stale until we unmap the
+	// FD page.
+	fdcopy = *FVA;
+  8001c3:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001cb:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001d3:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001db:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	sys_page_unmap(0, FVA);
+  8001e3:	83 c4 08             	add    $0x8,%esp
+  8001e6:	68 00 c0 cc cc       	push   $0xccccc000
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	e8 47 12 00 00       	call   801439 <sys_page_unmap>
+
+	if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	68 00 02 00 00       	push   $0x200
+  8001fa:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800200:	50                   	push   %eax
+  800201:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	ff 15 10 40 80 00    	call   *0x804010
+  80020b:	83 c4 10             	add    $0x10,%esp
+  80020e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800211:	0f 85 2d 03 00 00    	jne    800544 <umain+0x4c6>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+	cprintf("stale fileid is good\n");
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	68 8d 32 80 00       	push   $0x80328d
+  80021f:	e8 fa 05 00 00       	call   80081e <cprintf>
+
+	// Try writing
+	if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  800224:	ba 02 01 00 00       	mov    $0x102,%edx
+  800229:	b8 a3 32 80 00       	mov    $0x8032a3,%eax
+  80022e:	e8 00 fe ff ff       	call   800033 <xopen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 88 18 03 00 00    	js     800556 <umain+0x4d8>
+		panic("serve_open /new-file: %e", r);
+
+	if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  80023e:	8b 1d 14 40 80 00    	mov    0x804014,%ebx
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 35 00 40 80 00    	push   0x804000
+  80024d:	e8 d9 0b 00 00       	call   800e2b <strlen>
+  800252:	83 c4 0c             	add    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	ff 35 00 40 80 00    	push   0x804000
+  80025c:	68 00 c0 cc cc       	push   $0xccccc000
+  800261:	ff d3                	call   *%ebx
+  800263:	89 c3                	mov    %eax,%ebx
+  800265:	83 c4 04             	add    $0x4,%esp
+  800268:	ff 35 00 40 80 00    	push   0x804000
+  80026e:	e8 b8 0b 00 00       	call   800e2b <strlen>
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	39 d8                	cmp    %ebx,%eax
+  800278:	0f 85 ea 02 00 00    	jne    800568 <umain+0x4ea>
+		panic("file_write: %e", r);
+	cprintf("file_write is good\n");
+  80027e:	83 ec 0c             	sub    $0xc,%esp
+  800281:	68 d5 32 80 00       	push   $0x8032d5
+  800286:	e8 93 05 00 00       	call   80081e <cprintf>
+
+	FVA->fd_offset = 0;
+  80028b:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  800292:	00 00 00 
+	memset(buf, 0, sizeof buf);
+  800295:	83 c4 0c             	add    $0xc,%esp
+  800298:	68 00 02 00 00       	push   $0x200
+  80029d:	6a 00                	push   $0x0
+  80029f:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  8002a5:	53                   	push   %ebx
+  8002a6:	e8 0c 0d 00 00       	call   800fb7 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002ab:	83 c4 0c             	add    $0xc,%esp
+  8002ae:	68 00 02 00 00       	push   $0x200
+  8002b3:	53                   	push   %ebx
+  8002b4:	68 00 c0 cc cc       	push   $0xccccc000
+  8002b9:	ff 15 10 40 80 00    	call   *0x804010
+  8002bf:	89 c3                	mov    %eax,%ebx
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	85 c0                	test   %eax,%eax
+  8002c6:	0f 88 ae 02 00 00    	js     80057a <umain+0x4fc>
+		panic("file_read after file_write: %e", r);
+	if (r != strlen(msg))
+  8002cc:	83 ec 0c             	sub    $0xc,%esp
+  8002cf:	ff 35 00 40 80 00    	push   0x804000
+  8002d5:	e8 51 0b 00 00       	call   800e2b <strlen>
+  8002da:	83 c4 10             	add    $0x10,%esp
+  8002dd:	39 d8                	cmp    %ebx,%eax
+  8002df:	0f 85 a7 02 00 00    	jne    80058c <umain+0x50e>
+		panic("file_read after file_write returned wrong length: %d", r);
+	if (strcmp(buf, msg) != 0)
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	ff 35 00 40 80 00    	push   0x804000
+  8002ee:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	e8 1d 0c 00 00       	call   800f17 <strcmp>
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	0f 85 99 02 00 00    	jne    80059e <umain+0x520>
+		panic("file_read after file_write returned wrong data");
+	cprintf("file_read after file_write is good\n");
+  800305:	83 ec 0c             	sub    $0xc,%esp
+  800308:	68 9c 34 80 00       	push   $0x80349c
+  80030d:	e8 0c 05 00 00       	call   80081e <cprintf>
+
+	// Now we'll try out open
+	if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800312:	83 c4 08             	add    $0x8,%esp
+  800315:	6a 00                	push   $0x0
+  800317:	68 a0 31 80 00       	push   $0x8031a0
+  80031c:	e8 f9 23 00 00       	call   80271a <open>
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	85 c0                	test   %eax,%eax
+  800326:	0f 89 98 02 00 00    	jns    8005c4 <umain+0x546>
+  80032c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80032f:	0f 85 7d 02 00 00    	jne    8005b2 <umain+0x534>
+		panic("open /not-found: %e", r);
+	else if (r >= 0)
+		panic("open /not-found succeeded!");
+
+	if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	6a 00                	push   $0x0
+  80033a:	68 d5 31 80 00       	push   $0x8031d5
+  80033f:	e8 d6 23 00 00       	call   80271a <open>
+  800344:	83 c4 10             	add    $0x10,%esp
+  800347:	85 c0                	test   %eax,%eax
+  800349:	0f 88 89 02 00 00    	js     8005d8 <umain+0x55a>
+		panic("open /newmotd: %e", r);
+	fd = (struct Fd*) (0xD0000000 + r*PGSIZE);
+  80034f:	c1 e0 0c             	shl    $0xc,%eax
+	if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800352:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  800359:	0f 85 8b 02 00 00    	jne    8005ea <umain+0x56c>
+  80035f:	83 b8 04 00 00 d0 00 	cmpl   $0x0,-0x2ffffffc(%eax)
+  800366:	0f 85 7e 02 00 00    	jne    8005ea <umain+0x56c>
+  80036c:	8b 98 08 00 00 d0    	mov    -0x2ffffff8(%eax),%ebx
+  800372:	85 db                	test   %ebx,%ebx
+  800374:	0f 85 70 02 00 00    	jne    8005ea <umain+0x56c>
+		panic("open did not fill struct Fd correctly\n");
+	cprintf("open is good\n");
+  80037a:	83 ec 0c             	sub    $0xc,%esp
+  80037d:	68 fc 31 80 00       	push   $0x8031fc
+  800382:	e8 97 04 00 00       	call   80081e <cprintf>
+
+	// Try files with indirect blocks
+	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  800387:	83 c4 08             	add    $0x8,%esp
+  80038a:	68 01 01 00 00       	push   $0x101
+  80038f:	68 04 33 80 00       	push   $0x803304
+  800394:	e8 81 23 00 00       	call   80271a <open>
+  800399:	89 c7                	mov    %eax,%edi
+  80039b:	83 c4 10             	add    $0x10,%esp
+  80039e:	85 c0                	test   %eax,%eax
+  8003a0:	0f 88 58 02 00 00    	js     8005fe <umain+0x580>
+		panic("creat /big: %e", f);
+	memset(buf, 0, sizeof(buf));
+  8003a6:	83 ec 04             	sub    $0x4,%esp
+  8003a9:	68 00 02 00 00       	push   $0x200
+  8003ae:	6a 00                	push   $0x0
+  8003b0:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003b6:	50                   	push   %eax
+  8003b7:	e8 fb 0b 00 00       	call   800fb7 <memset>
+  8003bc:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003bf:	89 de                	mov    %ebx,%esi
+		*(int*)buf = i;
+  8003c1:	89 b5 4c fd ff ff    	mov    %esi,-0x2b4(%ebp)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003c7:	83 ec 04             	sub    $0x4,%esp
+  8003ca:	68 00 02 00 00       	push   $0x200
+  8003cf:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003d5:	50                   	push   %eax
+  8003d6:	57                   	push   %edi
+  8003d7:	e8 69 1f 00 00       	call   802345 <write>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	85 c0                	test   %eax,%eax
+  8003e1:	0f 88 29 02 00 00    	js     800610 <umain+0x592>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003e7:	8d 86 00 02 00 00    	lea    0x200(%esi),%eax
+  8003ed:	89 c6                	mov    %eax,%esi
+  8003ef:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  8003f4:	75 cb                	jne    8003c1 <umain+0x343>
+			panic("write /big@%d: %e", i, r);
+	}
+	close(f);
+  8003f6:	83 ec 0c             	sub    $0xc,%esp
+  8003f9:	57                   	push   %edi
+  8003fa:	e8 1c 1d 00 00       	call   80211b <close>
+
+	if ((f = open("/big", O_RDONLY)) < 0)
+  8003ff:	83 c4 08             	add    $0x8,%esp
+  800402:	6a 00                	push   $0x0
+  800404:	68 04 33 80 00       	push   $0x803304
+  800409:	e8 0c 23 00 00       	call   80271a <open>
+  80040e:	89 c6                	mov    %eax,%esi
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	85 c0                	test   %eax,%eax
+  800415:	0f 88 0b 02 00 00    	js     800626 <umain+0x5a8>
+		panic("open /big: %e", f);
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+		*(int*)buf = i;
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  80041b:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+		*(int*)buf = i;
+  800421:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800427:	83 ec 04             	sub    $0x4,%esp
+  80042a:	68 00 02 00 00       	push   $0x200
+  80042f:	57                   	push   %edi
+  800430:	56                   	push   %esi
+  800431:	e8 c8 1e 00 00       	call   8022fe <readn>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	85 c0                	test   %eax,%eax
+  80043b:	0f 88 f7 01 00 00    	js     800638 <umain+0x5ba>
+			panic("read /big@%d: %e", i, r);
+		if (r != sizeof(buf))
+  800441:	3d 00 02 00 00       	cmp    $0x200,%eax
+  800446:	0f 85 02 02 00 00    	jne    80064e <umain+0x5d0>
+			panic("read /big from %d returned %d < %d bytes",
+			      i, r, sizeof(buf));
+		if (*(int*)buf != i)
+  80044c:	8b 85 4c fd ff ff    	mov    -0x2b4(%ebp),%eax
+  800452:	39 d8                	cmp    %ebx,%eax
+  800454:	0f 85 0f 02 00 00    	jne    800669 <umain+0x5eb>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  80045a:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800460:	89 c3                	mov    %eax,%ebx
+  800462:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800467:	75 b8                	jne    800421 <umain+0x3a3>
+			panic("read /big from %d returned bad data %d",
+			      i, *(int*)buf);
+	}
+	close(f);
+  800469:	83 ec 0c             	sub    $0xc,%esp
+  80046c:	56                   	push   %esi
+  80046d:	e8 a9 1c 00 00       	call   80211b <close>
+	cprintf("large file is good\n");
+  800472:	c7 04 24 49 33 80 00 	movl   $0x803349,(%esp)
+  800479:	e8 a0 03 00 00       	call   80081e <cprintf>
+}
+  80047e:	83 c4 10             	add    $0x10,%esp
+  800481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800484:	5b                   	pop    %ebx
+  800485:	5e                   	pop    %esi
+  800486:	5f                   	pop    %edi
+  800487:	5d                   	pop    %ebp
+  800488:	c3                   	ret
+		panic("serve_open /not-found: %e", r);
+  800489:	50                   	push   %eax
+  80048a:	68 ab 31 80 00       	push   $0x8031ab
+  80048f:	6a 20                	push   $0x20
+  800491:	68 c5 31 80 00       	push   $0x8031c5
+  800496:	e8 a8 02 00 00       	call   800743 <_panic>
+		panic("serve_open /not-found succeeded!");
+  80049b:	83 ec 04             	sub    $0x4,%esp
+  80049e:	68 60 33 80 00       	push   $0x803360
+  8004a3:	6a 22                	push   $0x22
+  8004a5:	68 c5 31 80 00       	push   $0x8031c5
+  8004aa:	e8 94 02 00 00       	call   800743 <_panic>
+		panic("serve_open /newmotd: %e", r);
+  8004af:	50                   	push   %eax
+  8004b0:	68 de 31 80 00       	push   $0x8031de
+  8004b5:	6a 25                	push   $0x25
+  8004b7:	68 c5 31 80 00       	push   $0x8031c5
+  8004bc:	e8 82 02 00 00       	call   800743 <_panic>
+		panic("serve_open did not fill struct Fd correctly\n");
+  8004c1:	83 ec 04             	sub    $0x4,%esp
+  8004c4:	68 84 33 80 00       	push   $0x803384
+  8004c9:	6a 27                	push   $0x27
+  8004cb:	68 c5 31 80 00       	push   $0x8031c5
+  8004d0:	e8 6e 02 00 00       	call   800743 <_panic>
+		panic("file_stat: %e", r);
+  8004d5:	50                   	push   %eax
+  8004d6:	68 0a 32 80 00       	push   $0x80320a
+  8004db:	6a 2b                	push   $0x2b
+  8004dd:	68 c5 31 80 00       	push   $0x8031c5
+  8004e2:	e8 5c 02 00 00       	call   800743 <_panic>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  8004e7:	83 ec 0c             	sub    $0xc,%esp
+  8004ea:	ff 35 00 40 80 00    	push   0x804000
+  8004f0:	e8 36 09 00 00       	call   800e2b <strlen>
+  8004f5:	89 04 24             	mov    %eax,(%esp)
+  8004f8:	ff 75 cc             	push   -0x34(%ebp)
+  8004fb:	68 b4 33 80 00       	push   $0x8033b4
+  800500:	6a 2d                	push   $0x2d
+  800502:	68 c5 31 80 00       	push   $0x8031c5
+  800507:	e8 37 02 00 00       	call   800743 <_panic>
+		panic("file_read: %e", r);
+  80050c:	50                   	push   %eax
+  80050d:	68 2b 32 80 00       	push   $0x80322b
+  800512:	6a 32                	push   $0x32
+  800514:	68 c5 31 80 00       	push   $0x8031c5
+  800519:	e8 25 02 00 00       	call   800743 <_panic>
+		panic("file_read returned wrong data");
+  80051e:	83 ec 04             	sub    $0x4,%esp
+  800521:	68 39 32 80 00       	push   $0x803239
+  800526:	6a 34                	push   $0x34
+  800528:	68 c5 31 80 00       	push   $0x8031c5
+  80052d:	e8 11 02 00 00       	call   800743 <_panic>
+		panic("file_close: %e", r);
+  800532:	50                   	push   %eax
+  800533:	68 6a 32 80 00       	push   $0x80326a
+  800538:	6a 38                	push   $0x38
+  80053a:	68 c5 31 80 00       	push   $0x8031c5
+  80053f:	e8 ff 01 00 00       	call   800743 <_panic>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+  800544:	50                   	push   %eax
+  800545:	68 dc 33 80 00       	push   $0x8033dc
+  80054a:	6a 43                	push   $0x43
+  80054c:	68 c5 31 80 00       	push   $0x8031c5
+  800551:	e8 ed 01 00 00       	call   800743 <_panic>
+		panic("serve_open /new-file: %e", r);
+  800556:	50                   	push   %eax
+  800557:	68 ad 32 80 00       	push   $0x8032ad
+  80055c:	6a 48                	push   $0x48
+  80055e:	68 c5 31 80 00       	push   $0x8031c5
+  800563:	e8 db 01 00 00       	call   800743 <_panic>
+		panic("file_write: %e", r);
+  800568:	53                   	push   %ebx
+  800569:	68 c6 32 80 00       	push   $0x8032c6
+  80056e:	6a 4b                	push   $0x4b
+  800570:	68 c5 31 80 00       	push   $0x8031c5
+  800575:	e8 c9 01 00 00       	call   800743 <_panic>
+		panic("file_read after file_write: %e", r);
+  80057a:	50                   	push   %eax
+  80057b:	68 14 34 80 00       	push   $0x803414
+  800580:	6a 51                	push   $0x51
+  800582:	68 c5 31 80 00       	push   $0x8031c5
+  800587:	e8 b7 01 00 00       	call   800743 <_panic>
+		panic("file_read after file_write returned wrong length: %d", r);
+  80058c:	53                   	push   %ebx
+  80058d:	68 34 34 80 00       	push   $0x803434
+  800592:	6a 53                	push   $0x53
+  800594:	68 c5 31 80 00       	push   $0x8031c5
+  800599:	e8 a5 01 00 00       	call   800743 <_panic>
+		panic("file_read after file_write returned wrong data");
+  80059e:	83 ec 04             	sub    $0x4,%esp
+  8005a1:	68 6c 34 80 00       	push   $0x80346c
+  8005a6:	6a 55                	push   $0x55
+  8005a8:	68 c5 31 80 00       	push   $0x8031c5
+  8005ad:	e8 91 01 00 00       	call   800743 <_panic>
+		panic("open /not-found: %e", r);
+  8005b2:	50                   	push   %eax
+  8005b3:	68 b1 31 80 00       	push   $0x8031b1
+  8005b8:	6a 5a                	push   $0x5a
+  8005ba:	68 c5 31 80 00       	push   $0x8031c5
+  8005bf:	e8 7f 01 00 00       	call   800743 <_panic>
+		panic("open /not-found succeeded!");
+  8005c4:	83 ec 04             	sub    $0x4,%esp
+  8005c7:	68 e9 32 80 00       	push   $0x8032e9
+  8005cc:	6a 5c                	push   $0x5c
+  8005ce:	68 c5 31 80 00       	push   $0x8031c5
+  8005d3:	e8 6b 01 00 00       	call   800743 <_panic>
+		panic("open /newmotd: %e", r);
+  8005d8:	50                   	push   %eax
+  8005d9:	68 e4 31 80 00       	push   $0x8031e4
+  8005de:	6a 5f                	push   $0x5f
+  8005e0:	68 c5 31 80 00       	push   $0x8031c5
+  8005e5:	e8 59 01 00 00       	call   800743 <_panic>
+		panic("open did not fill struct Fd correctly\n");
+  8005ea:	83 ec 04             	sub    $0x4,%esp
+  8005ed:	68 c0 34 80 00       	push   $0x8034c0
+  8005f2:	6a 62                	push   $0x62
+  8005f4:	68 c5 31 80 00       	push   $0x8031c5
+  8005f9:	e8 45 01 00 00       	call   800743 <_panic>
+		panic("creat /big: %e", f);
+  8005fe:	50                   	push   %eax
+  8005ff:	68 09 33 80 00       	push   $0x803309
+  800604:	6a 67                	push   $0x67
+  800606:	68 c5 31 80 00       	push   $0x8031c5
+  80060b:	e8 33 01 00 00       	call   800743 <_panic>
+			panic("write /big@%d: %e", i, r);
+  800610:	83 ec 0c             	sub    $0xc,%esp
+  800613:	50                   	push   %eax
+  800614:	56                   	push   %esi
+  800615:	68 18 33 80 00       	push   $0x803318
+  80061a:	6a 6c                	push   $0x6c
+  80061c:	68 c5 31 80 00       	push   $0x8031c5
+  800621:	e8 1d 01 00 00       	call   800743 <_panic>
+		panic("open /big: %e", f);
+  800626:	50                   	push   %eax
+  800627:	68 2a 33 80 00       	push   $0x80332a
+  80062c:	6a 71                	push   $0x71
+  80062e:	68 c5 31 80 00       	push   $0x8031c5
+  800633:	e8 0b 01 00 00       	call   800743 <_panic>
+			panic("read /big@%d: %e", i, r);
+  800638:	83 ec 0c             	sub    $0xc,%esp
+  80063b:	50                   	push   %eax
+  80063c:	53                   	push   %ebx
+  80063d:	68 38 33 80 00       	push   $0x803338
+  800642:	6a 75                	push   $0x75
+  800644:	68 c5 31 80 00       	push   $0x8031c5
+  800649:	e8 f5 00 00 00       	call   800743 <_panic>
+			panic("read /big from %d returned %d < %d bytes",
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	68 00 02 00 00       	push   $0x200
+  800656:	50                   	push   %eax
+  800657:	53                   	push   %ebx
+  800658:	68 e8 34 80 00       	push   $0x8034e8
+  80065d:	6a 77                	push   $0x77
+  80065f:	68 c5 31 80 00       	push   $0x8031c5
+  800664:	e8 da 00 00 00       	call   800743 <_panic>
+			panic("read /big from %d returned bad data %d",
+  800669:	83 ec 0c             	sub    $0xc,%esp
+  80066c:	50                   	push   %eax
+  80066d:	53                   	push   %ebx
+  80066e:	68 14 35 80 00       	push   $0x803514
+  800673:	6a 7a                	push   $0x7a
+  800675:	68 c5 31 80 00       	push   $0x8031c5
+  80067a:	e8 c4 00 00 00       	call   800743 <_panic>
+
+0080067f <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80067f:	55                   	push   %ebp
+  800680:	89 e5                	mov    %esp,%ebp
+  800682:	57                   	push   %edi
+  800683:	56                   	push   %esi
+  800684:	53                   	push   %ebx
+  800685:	83 ec 0c             	sub    $0xc,%esp
+  800688:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80068b:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80068e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800693:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800695:	c1 ea 0b             	shr    $0xb,%edx
+  800698:	83 f2 01             	xor    $0x1,%edx
+  80069b:	83 e2 01             	and    $0x1,%edx
+  80069e:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8006a4:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8006ab:	00 00 00 
+	envid = sys_getenvid();
+  8006ae:	e8 1f 0c 00 00       	call   8012d2 <sys_getenvid>
+  8006b3:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8006b5:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8006ba:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8006c0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8006c6:	8b 52 48             	mov    0x48(%edx),%edx
+  8006c9:	39 ca                	cmp    %ecx,%edx
+  8006cb:	74 27                	je     8006f4 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8006cd:	83 c0 01             	add    $0x1,%eax
+  8006d0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8006d5:	75 e3                	jne    8006ba <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8006d7:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8006de:	75 24                	jne    800704 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8006e0:	83 ec 04             	sub    $0x4,%esp
+  8006e3:	68 64 35 80 00       	push   $0x803564
+  8006e8:	6a 23                	push   $0x23
+  8006ea:	68 87 35 80 00       	push   $0x803587
+  8006ef:	e8 4f 00 00 00       	call   800743 <_panic>
+			mainenv = &envs[i];
+  8006f4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8006fa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8006ff:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800704:	85 ff                	test   %edi,%edi
+  800706:	7e 07                	jle    80070f <libmain+0x90>
+		binaryname = argv[0];
+  800708:	8b 06                	mov    (%esi),%eax
+  80070a:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  80070f:	83 ec 08             	sub    $0x8,%esp
+  800712:	56                   	push   %esi
+  800713:	57                   	push   %edi
+  800714:	e8 65 f9 ff ff       	call   80007e <umain>
+
+	// exit gracefully
+	exit();
+  800719:	e8 0b 00 00 00       	call   800729 <exit>
+}
+  80071e:	83 c4 10             	add    $0x10,%esp
+  800721:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800724:	5b                   	pop    %ebx
+  800725:	5e                   	pop    %esi
+  800726:	5f                   	pop    %edi
+  800727:	5d                   	pop    %ebp
+  800728:	c3                   	ret
+
+00800729 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800729:	55                   	push   %ebp
+  80072a:	89 e5                	mov    %esp,%ebp
+  80072c:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80072f:	e8 14 1a 00 00       	call   802148 <close_all>
+	sys_env_destroy(0);
+  800734:	83 ec 0c             	sub    $0xc,%esp
+  800737:	6a 00                	push   $0x0
+  800739:	e8 2b 0b 00 00       	call   801269 <sys_env_destroy>
+}
+  80073e:	83 c4 10             	add    $0x10,%esp
+  800741:	c9                   	leave
+  800742:	c3                   	ret
+
+00800743 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800743:	55                   	push   %ebp
+  800744:	89 e5                	mov    %esp,%ebp
+  800746:	56                   	push   %esi
+  800747:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800748:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80074b:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  800751:	e8 7c 0b 00 00       	call   8012d2 <sys_getenvid>
+  800756:	83 ec 0c             	sub    $0xc,%esp
+  800759:	ff 75 0c             	push   0xc(%ebp)
+  80075c:	ff 75 08             	push   0x8(%ebp)
+  80075f:	56                   	push   %esi
+  800760:	50                   	push   %eax
+  800761:	68 a0 35 80 00       	push   $0x8035a0
+  800766:	e8 b3 00 00 00       	call   80081e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80076b:	83 c4 18             	add    $0x18,%esp
+  80076e:	53                   	push   %ebx
+  80076f:	ff 75 10             	push   0x10(%ebp)
+  800772:	e8 56 00 00 00       	call   8007cd <vcprintf>
+	cprintf("\n");
+  800777:	c7 04 24 28 3a 80 00 	movl   $0x803a28,(%esp)
+  80077e:	e8 9b 00 00 00       	call   80081e <cprintf>
+  800783:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800786:	cc                   	int3
+	while (1)
+  800787:	eb fd                	jmp    800786 <_panic+0x43>
+
+00800789 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800789:	55                   	push   %ebp
+  80078a:	89 e5                	mov    %esp,%ebp
+  80078c:	53                   	push   %ebx
+  80078d:	83 ec 04             	sub    $0x4,%esp
+  800790:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800793:	8b 13                	mov    (%ebx),%edx
+  800795:	8d 42 01             	lea    0x1(%edx),%eax
+  800798:	89 03                	mov    %eax,(%ebx)
+  80079a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80079d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8007a1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8007a6:	74 09                	je     8007b1 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8007a8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8007ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007af:	c9                   	leave
+  8007b0:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8007b1:	83 ec 08             	sub    $0x8,%esp
+  8007b4:	68 ff 00 00 00       	push   $0xff
+  8007b9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8007bc:	50                   	push   %eax
+  8007bd:	e8 1d 0a 00 00       	call   8011df <sys_cputs>
+		b->idx = 0;
+  8007c2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8007c8:	83 c4 10             	add    $0x10,%esp
+  8007cb:	eb db                	jmp    8007a8 <putch+0x1f>
+
+008007cd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8007cd:	55                   	push   %ebp
+  8007ce:	89 e5                	mov    %esp,%ebp
+  8007d0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8007d6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8007dd:	00 00 00 
+	b.cnt = 0;
+  8007e0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8007e7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8007ea:	ff 75 0c             	push   0xc(%ebp)
+  8007ed:	ff 75 08             	push   0x8(%ebp)
+  8007f0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8007f6:	50                   	push   %eax
+  8007f7:	68 89 07 80 00       	push   $0x800789
+  8007fc:	e8 fb 00 00 00       	call   8008fc <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800801:	83 c4 08             	add    $0x8,%esp
+  800804:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80080a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800810:	50                   	push   %eax
+  800811:	e8 c9 09 00 00       	call   8011df <sys_cputs>
+
+	return b.cnt;
+}
+  800816:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80081c:	c9                   	leave
+  80081d:	c3                   	ret
+
+0080081e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80081e:	55                   	push   %ebp
+  80081f:	89 e5                	mov    %esp,%ebp
+  800821:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800824:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800827:	50                   	push   %eax
+  800828:	ff 75 08             	push   0x8(%ebp)
+  80082b:	e8 9d ff ff ff       	call   8007cd <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800830:	c9                   	leave
+  800831:	c3                   	ret
+
+00800832 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800832:	55                   	push   %ebp
+  800833:	89 e5                	mov    %esp,%ebp
+  800835:	57                   	push   %edi
+  800836:	56                   	push   %esi
+  800837:	53                   	push   %ebx
+  800838:	83 ec 1c             	sub    $0x1c,%esp
+  80083b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80083e:	89 d6                	mov    %edx,%esi
+  800840:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800843:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800846:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800849:	73 0b                	jae    800856 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80084b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80084e:	c1 e7 08             	shl    $0x8,%edi
+  800851:	0b 7d 10             	or     0x10(%ebp),%edi
+  800854:	eb 36                	jmp    80088c <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800856:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800859:	ba 00 00 00 00       	mov    $0x0,%edx
+  80085e:	f7 75 08             	divl   0x8(%ebp)
+  800861:	89 c1                	mov    %eax,%ecx
+  800863:	ff 75 14             	push   0x14(%ebp)
+  800866:	ff 75 10             	push   0x10(%ebp)
+  800869:	83 eb 01             	sub    $0x1,%ebx
+  80086c:	53                   	push   %ebx
+  80086d:	ff 75 08             	push   0x8(%ebp)
+  800870:	89 f2                	mov    %esi,%edx
+  800872:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800875:	e8 b8 ff ff ff       	call   800832 <printnum>
+  80087a:	83 c4 10             	add    $0x10,%esp
+  80087d:	eb 14                	jmp    800893 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80087f:	83 ec 08             	sub    $0x8,%esp
+  800882:	56                   	push   %esi
+  800883:	57                   	push   %edi
+  800884:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800887:	ff d0                	call   *%eax
+  800889:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80088c:	83 eb 01             	sub    $0x1,%ebx
+  80088f:	85 db                	test   %ebx,%ebx
+  800891:	7f ec                	jg     80087f <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800893:	83 ec 08             	sub    $0x8,%esp
+  800896:	56                   	push   %esi
+  800897:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80089a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80089f:	f7 75 08             	divl   0x8(%ebp)
+  8008a2:	0f be 92 c3 35 80 00 	movsbl 0x8035c3(%edx),%edx
+  8008a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ac:	c1 e0 08             	shl    $0x8,%eax
+  8008af:	09 d0                	or     %edx,%eax
+  8008b1:	50                   	push   %eax
+  8008b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008b5:	ff d0                	call   *%eax
+}
+  8008b7:	83 c4 10             	add    $0x10,%esp
+  8008ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008bd:	5b                   	pop    %ebx
+  8008be:	5e                   	pop    %esi
+  8008bf:	5f                   	pop    %edi
+  8008c0:	5d                   	pop    %ebp
+  8008c1:	c3                   	ret
+
+008008c2 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8008c8:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8008cc:	8b 10                	mov    (%eax),%edx
+  8008ce:	3b 50 04             	cmp    0x4(%eax),%edx
+  8008d1:	73 0a                	jae    8008dd <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8008d3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8008d6:	89 08                	mov    %ecx,(%eax)
+  8008d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008db:	88 02                	mov    %al,(%edx)
+}
+  8008dd:	5d                   	pop    %ebp
+  8008de:	c3                   	ret
+
+008008df <printfmt>:
+{
+  8008df:	55                   	push   %ebp
+  8008e0:	89 e5                	mov    %esp,%ebp
+  8008e2:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8008e5:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8008e8:	50                   	push   %eax
+  8008e9:	ff 75 10             	push   0x10(%ebp)
+  8008ec:	ff 75 0c             	push   0xc(%ebp)
+  8008ef:	ff 75 08             	push   0x8(%ebp)
+  8008f2:	e8 05 00 00 00       	call   8008fc <vprintfmt>
+}
+  8008f7:	83 c4 10             	add    $0x10,%esp
+  8008fa:	c9                   	leave
+  8008fb:	c3                   	ret
+
+008008fc <vprintfmt>:
+{
+  8008fc:	55                   	push   %ebp
+  8008fd:	89 e5                	mov    %esp,%ebp
+  8008ff:	57                   	push   %edi
+  800900:	56                   	push   %esi
+  800901:	53                   	push   %ebx
+  800902:	83 ec 3c             	sub    $0x3c,%esp
+  800905:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800908:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80090b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800912:	eb 16                	jmp    80092a <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800914:	83 ec 08             	sub    $0x8,%esp
+  800917:	ff 75 0c             	push   0xc(%ebp)
+  80091a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80091d:	c1 e2 08             	shl    $0x8,%edx
+  800920:	09 d0                	or     %edx,%eax
+  800922:	50                   	push   %eax
+  800923:	ff d7                	call   *%edi
+  800925:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800928:	89 de                	mov    %ebx,%esi
+  80092a:	8d 5e 01             	lea    0x1(%esi),%ebx
+  80092d:	0f b6 06             	movzbl (%esi),%eax
+  800930:	83 f8 25             	cmp    $0x25,%eax
+  800933:	74 0c                	je     800941 <vprintfmt+0x45>
+			if (ch == '\0')
+  800935:	85 c0                	test   %eax,%eax
+  800937:	75 db                	jne    800914 <vprintfmt+0x18>
+}
+  800939:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80093c:	5b                   	pop    %ebx
+  80093d:	5e                   	pop    %esi
+  80093e:	5f                   	pop    %edi
+  80093f:	5d                   	pop    %ebp
+  800940:	c3                   	ret
+		padc = ' ';
+  800941:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800945:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80094c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800953:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80095a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80095f:	8d 73 01             	lea    0x1(%ebx),%esi
+  800962:	0f b6 13             	movzbl (%ebx),%edx
+  800965:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800968:	3c 55                	cmp    $0x55,%al
+  80096a:	0f 87 2c 04 00 00    	ja     800d9c <vprintfmt+0x4a0>
+  800970:	0f b6 c0             	movzbl %al,%eax
+  800973:	ff 24 85 00 37 80 00 	jmp    *0x803700(,%eax,4)
+  80097a:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80097c:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800980:	eb dd                	jmp    80095f <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800982:	89 f3                	mov    %esi,%ebx
+  800984:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800988:	eb d5                	jmp    80095f <vprintfmt+0x63>
+  80098a:	0f b6 d2             	movzbl %dl,%edx
+  80098d:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80098f:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800994:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800997:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80099b:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80099e:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8009a1:	83 fe 09             	cmp    $0x9,%esi
+  8009a4:	0f 87 8a 00 00 00    	ja     800a34 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8009aa:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8009ad:	eb e5                	jmp    800994 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8009af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b2:	8b 00                	mov    (%eax),%eax
+  8009b4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8009bd:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009c0:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8009c2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009c6:	79 97                	jns    80095f <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8009c8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009ce:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8009d5:	eb 88                	jmp    80095f <vprintfmt+0x63>
+			if (width < 0)
+  8009d7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8009da:	85 db                	test   %ebx,%ebx
+  8009dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e1:	0f 49 c3             	cmovns %ebx,%eax
+  8009e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009e7:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8009e9:	e9 71 ff ff ff       	jmp    80095f <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ee:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8009f0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8009f7:	e9 63 ff ff ff       	jmp    80095f <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8009fc:	8d 73 02             	lea    0x2(%ebx),%esi
+  8009ff:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800a03:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800a0a:	3c 67                	cmp    $0x67,%al
+  800a0c:	0f 84 18 ff ff ff    	je     80092a <vprintfmt+0x2e>
+					attrib = 0x04;
+  800a12:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800a19:	3c 72                	cmp    $0x72,%al
+  800a1b:	0f 84 09 ff ff ff    	je     80092a <vprintfmt+0x2e>
+					attrib = 0x00;
+  800a21:	3c 62                	cmp    $0x62,%al
+  800a23:	0f 94 c0             	sete   %al
+  800a26:	0f b6 c0             	movzbl %al,%eax
+  800a29:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800a2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a2f:	e9 f6 fe ff ff       	jmp    80092a <vprintfmt+0x2e>
+  800a34:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800a37:	eb 89                	jmp    8009c2 <vprintfmt+0xc6>
+			lflag++;
+  800a39:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800a3c:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800a3e:	e9 1c ff ff ff       	jmp    80095f <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800a43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a46:	8d 58 04             	lea    0x4(%eax),%ebx
+  800a49:	83 ec 08             	sub    $0x8,%esp
+  800a4c:	ff 75 0c             	push   0xc(%ebp)
+  800a4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a52:	c1 e0 08             	shl    $0x8,%eax
+  800a55:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800a58:	0b 01                	or     (%ecx),%eax
+  800a5a:	50                   	push   %eax
+  800a5b:	ff d7                	call   *%edi
+			break;
+  800a5d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800a60:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800a63:	e9 c2 fe ff ff       	jmp    80092a <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800a68:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6b:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800a6e:	8b 10                	mov    (%eax),%edx
+  800a70:	89 d0                	mov    %edx,%eax
+  800a72:	f7 d8                	neg    %eax
+  800a74:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a77:	83 f8 12             	cmp    $0x12,%eax
+  800a7a:	7f 25                	jg     800aa1 <vprintfmt+0x1a5>
+  800a7c:	8b 14 85 60 38 80 00 	mov    0x803860(,%eax,4),%edx
+  800a83:	85 d2                	test   %edx,%edx
+  800a85:	74 1a                	je     800aa1 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800a87:	52                   	push   %edx
+  800a88:	68 bd 39 80 00       	push   $0x8039bd
+  800a8d:	ff 75 0c             	push   0xc(%ebp)
+  800a90:	57                   	push   %edi
+  800a91:	e8 49 fe ff ff       	call   8008df <printfmt>
+  800a96:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a99:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800a9c:	e9 89 fe ff ff       	jmp    80092a <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800aa1:	50                   	push   %eax
+  800aa2:	68 db 35 80 00       	push   $0x8035db
+  800aa7:	ff 75 0c             	push   0xc(%ebp)
+  800aaa:	57                   	push   %edi
+  800aab:	e8 2f fe ff ff       	call   8008df <printfmt>
+  800ab0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800ab3:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800ab6:	e9 6f fe ff ff       	jmp    80092a <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800abb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abe:	83 c0 04             	add    $0x4,%eax
+  800ac1:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800ac4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac7:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800ac9:	85 c9                	test   %ecx,%ecx
+  800acb:	b8 d4 35 80 00       	mov    $0x8035d4,%eax
+  800ad0:	0f 45 c1             	cmovne %ecx,%eax
+  800ad3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800ad6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800ada:	7e 06                	jle    800ae2 <vprintfmt+0x1e6>
+  800adc:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800ae0:	75 1a                	jne    800afc <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800ae2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800ae5:	c1 e0 08             	shl    $0x8,%eax
+  800ae8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800aeb:	83 c8 3f             	or     $0x3f,%eax
+  800aee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800af1:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800af4:	89 75 10             	mov    %esi,0x10(%ebp)
+  800af7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800afa:	eb 6d                	jmp    800b69 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800afc:	83 ec 08             	sub    $0x8,%esp
+  800aff:	ff 75 d0             	push   -0x30(%ebp)
+  800b02:	ff 75 c8             	push   -0x38(%ebp)
+  800b05:	e8 39 03 00 00       	call   800e43 <strnlen>
+  800b0a:	89 c2                	mov    %eax,%edx
+  800b0c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b0f:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800b11:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800b14:	c1 e1 08             	shl    $0x8,%ecx
+  800b17:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800b1b:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b1d:	83 c4 10             	add    $0x10,%esp
+  800b20:	89 c3                	mov    %eax,%ebx
+  800b22:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b25:	89 75 10             	mov    %esi,0x10(%ebp)
+  800b28:	89 ce                	mov    %ecx,%esi
+  800b2a:	eb 0f                	jmp    800b3b <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800b2c:	83 ec 08             	sub    $0x8,%esp
+  800b2f:	ff 75 0c             	push   0xc(%ebp)
+  800b32:	56                   	push   %esi
+  800b33:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b35:	83 eb 01             	sub    $0x1,%ebx
+  800b38:	83 c4 10             	add    $0x10,%esp
+  800b3b:	85 db                	test   %ebx,%ebx
+  800b3d:	7f ed                	jg     800b2c <vprintfmt+0x230>
+  800b3f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800b42:	8b 75 10             	mov    0x10(%ebp),%esi
+  800b45:	85 c0                	test   %eax,%eax
+  800b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4c:	0f 49 d0             	cmovns %eax,%edx
+  800b4f:	29 d0                	sub    %edx,%eax
+  800b51:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b54:	eb 8c                	jmp    800ae2 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800b56:	83 ec 08             	sub    $0x8,%esp
+  800b59:	ff 75 0c             	push   0xc(%ebp)
+  800b5c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800b5f:	09 c2                	or     %eax,%edx
+  800b61:	52                   	push   %edx
+  800b62:	ff d7                	call   *%edi
+  800b64:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b67:	89 d9                	mov    %ebx,%ecx
+  800b69:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800b6c:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800b70:	0f be d0             	movsbl %al,%edx
+  800b73:	85 d2                	test   %edx,%edx
+  800b75:	74 2a                	je     800ba1 <vprintfmt+0x2a5>
+  800b77:	85 f6                	test   %esi,%esi
+  800b79:	78 05                	js     800b80 <vprintfmt+0x284>
+  800b7b:	83 ee 01             	sub    $0x1,%esi
+  800b7e:	78 3b                	js     800bbb <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b80:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800b84:	74 d0                	je     800b56 <vprintfmt+0x25a>
+  800b86:	0f be c0             	movsbl %al,%eax
+  800b89:	83 e8 20             	sub    $0x20,%eax
+  800b8c:	83 f8 5e             	cmp    $0x5e,%eax
+  800b8f:	76 c5                	jbe    800b56 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800b91:	83 ec 08             	sub    $0x8,%esp
+  800b94:	ff 75 0c             	push   0xc(%ebp)
+  800b97:	ff 75 cc             	push   -0x34(%ebp)
+  800b9a:	ff d7                	call   *%edi
+  800b9c:	83 c4 10             	add    $0x10,%esp
+  800b9f:	eb c6                	jmp    800b67 <vprintfmt+0x26b>
+  800ba1:	8b 75 10             	mov    0x10(%ebp),%esi
+  800ba4:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800ba7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800baa:	01 c3                	add    %eax,%ebx
+  800bac:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800bae:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800bb1:	83 c8 20             	or     $0x20,%eax
+  800bb4:	89 75 10             	mov    %esi,0x10(%ebp)
+  800bb7:	89 c6                	mov    %eax,%esi
+  800bb9:	eb 14                	jmp    800bcf <vprintfmt+0x2d3>
+  800bbb:	8b 75 10             	mov    0x10(%ebp),%esi
+  800bbe:	eb e4                	jmp    800ba4 <vprintfmt+0x2a8>
+  800bc0:	83 ec 08             	sub    $0x8,%esp
+  800bc3:	ff 75 0c             	push   0xc(%ebp)
+  800bc6:	56                   	push   %esi
+  800bc7:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800bc9:	83 eb 01             	sub    $0x1,%ebx
+  800bcc:	83 c4 10             	add    $0x10,%esp
+  800bcf:	85 db                	test   %ebx,%ebx
+  800bd1:	7f ed                	jg     800bc0 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bd3:	8b 75 10             	mov    0x10(%ebp),%esi
+  800bd6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800bd9:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bdc:	e9 49 fd ff ff       	jmp    80092a <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800be1:	83 f9 01             	cmp    $0x1,%ecx
+  800be4:	7f 1f                	jg     800c05 <vprintfmt+0x309>
+	else if (lflag)
+  800be6:	85 c9                	test   %ecx,%ecx
+  800be8:	74 69                	je     800c53 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800bea:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bed:	8b 00                	mov    (%eax),%eax
+  800bef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bf2:	89 c1                	mov    %eax,%ecx
+  800bf4:	c1 f9 1f             	sar    $0x1f,%ecx
+  800bf7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800bfa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bfd:	8d 40 04             	lea    0x4(%eax),%eax
+  800c00:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c03:	eb 17                	jmp    800c1c <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800c05:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c08:	8b 50 04             	mov    0x4(%eax),%edx
+  800c0b:	8b 00                	mov    (%eax),%eax
+  800c0d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800c10:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800c13:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c16:	8d 40 08             	lea    0x8(%eax),%eax
+  800c19:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800c1c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800c1f:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800c22:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800c27:	85 db                	test   %ebx,%ebx
+  800c29:	0f 89 f6 00 00 00    	jns    800d25 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800c2f:	83 ec 08             	sub    $0x8,%esp
+  800c32:	ff 75 0c             	push   0xc(%ebp)
+  800c35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800c38:	c1 e0 08             	shl    $0x8,%eax
+  800c3b:	83 c8 2d             	or     $0x2d,%eax
+  800c3e:	50                   	push   %eax
+  800c3f:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800c41:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800c44:	f7 d9                	neg    %ecx
+  800c46:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800c49:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c4e:	e9 d2 00 00 00       	jmp    800d25 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800c53:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c56:	8b 00                	mov    (%eax),%eax
+  800c58:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800c5b:	89 c1                	mov    %eax,%ecx
+  800c5d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800c60:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c63:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c66:	8d 40 04             	lea    0x4(%eax),%eax
+  800c69:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c6c:	eb ae                	jmp    800c1c <vprintfmt+0x320>
+	if (lflag >= 2)
+  800c6e:	83 f9 01             	cmp    $0x1,%ecx
+  800c71:	7f 19                	jg     800c8c <vprintfmt+0x390>
+	else if (lflag)
+  800c73:	85 c9                	test   %ecx,%ecx
+  800c75:	74 2a                	je     800ca1 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800c77:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c7a:	8b 08                	mov    (%eax),%ecx
+  800c7c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c7f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c82:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800c87:	e9 99 00 00 00       	jmp    800d25 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800c8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c8f:	8b 08                	mov    (%eax),%ecx
+  800c91:	8d 40 08             	lea    0x8(%eax),%eax
+  800c94:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c97:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800c9c:	e9 84 00 00 00       	jmp    800d25 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800ca1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ca4:	8b 08                	mov    (%eax),%ecx
+  800ca6:	8d 40 04             	lea    0x4(%eax),%eax
+  800ca9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800cac:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800cb1:	eb 72                	jmp    800d25 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800cb3:	83 f9 01             	cmp    $0x1,%ecx
+  800cb6:	7f 16                	jg     800cce <vprintfmt+0x3d2>
+	else if (lflag)
+  800cb8:	85 c9                	test   %ecx,%ecx
+  800cba:	74 24                	je     800ce0 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800cbc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cbf:	8b 08                	mov    (%eax),%ecx
+  800cc1:	8d 40 04             	lea    0x4(%eax),%eax
+  800cc4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800cc7:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800ccc:	eb 57                	jmp    800d25 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800cce:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd1:	8b 08                	mov    (%eax),%ecx
+  800cd3:	8d 40 08             	lea    0x8(%eax),%eax
+  800cd6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800cd9:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800cde:	eb 45                	jmp    800d25 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800ce0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce3:	8b 08                	mov    (%eax),%ecx
+  800ce5:	8d 40 04             	lea    0x4(%eax),%eax
+  800ce8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800ceb:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800cf0:	eb 33                	jmp    800d25 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800cf2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cf5:	c1 e3 08             	shl    $0x8,%ebx
+  800cf8:	83 ec 08             	sub    $0x8,%esp
+  800cfb:	ff 75 0c             	push   0xc(%ebp)
+  800cfe:	89 d8                	mov    %ebx,%eax
+  800d00:	83 c8 30             	or     $0x30,%eax
+  800d03:	50                   	push   %eax
+  800d04:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800d06:	83 c4 08             	add    $0x8,%esp
+  800d09:	ff 75 0c             	push   0xc(%ebp)
+  800d0c:	83 cb 78             	or     $0x78,%ebx
+  800d0f:	53                   	push   %ebx
+  800d10:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800d12:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d15:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800d17:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800d1a:	8d 40 04             	lea    0x4(%eax),%eax
+  800d1d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d20:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800d25:	ff 75 e4             	push   -0x1c(%ebp)
+  800d28:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800d2c:	52                   	push   %edx
+  800d2d:	ff 75 e0             	push   -0x20(%ebp)
+  800d30:	50                   	push   %eax
+  800d31:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d34:	89 f8                	mov    %edi,%eax
+  800d36:	e8 f7 fa ff ff       	call   800832 <printnum>
+			break;
+  800d3b:	83 c4 10             	add    $0x10,%esp
+  800d3e:	e9 e7 fb ff ff       	jmp    80092a <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800d43:	83 f9 01             	cmp    $0x1,%ecx
+  800d46:	7f 16                	jg     800d5e <vprintfmt+0x462>
+	else if (lflag)
+  800d48:	85 c9                	test   %ecx,%ecx
+  800d4a:	74 24                	je     800d70 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800d4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d4f:	8b 08                	mov    (%eax),%ecx
+  800d51:	8d 40 04             	lea    0x4(%eax),%eax
+  800d54:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d57:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800d5c:	eb c7                	jmp    800d25 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800d5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d61:	8b 08                	mov    (%eax),%ecx
+  800d63:	8d 40 08             	lea    0x8(%eax),%eax
+  800d66:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d69:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800d6e:	eb b5                	jmp    800d25 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800d70:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d73:	8b 08                	mov    (%eax),%ecx
+  800d75:	8d 40 04             	lea    0x4(%eax),%eax
+  800d78:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d7b:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800d80:	eb a3                	jmp    800d25 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800d82:	83 ec 08             	sub    $0x8,%esp
+  800d85:	ff 75 0c             	push   0xc(%ebp)
+  800d88:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800d8b:	c1 e0 08             	shl    $0x8,%eax
+  800d8e:	83 c8 25             	or     $0x25,%eax
+  800d91:	50                   	push   %eax
+  800d92:	ff d7                	call   *%edi
+			break;
+  800d94:	83 c4 10             	add    $0x10,%esp
+  800d97:	e9 8e fb ff ff       	jmp    80092a <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800d9c:	83 ec 08             	sub    $0x8,%esp
+  800d9f:	ff 75 0c             	push   0xc(%ebp)
+  800da2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800da5:	c1 e0 08             	shl    $0x8,%eax
+  800da8:	83 c8 25             	or     $0x25,%eax
+  800dab:	50                   	push   %eax
+  800dac:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800dae:	83 c4 10             	add    $0x10,%esp
+  800db1:	89 de                	mov    %ebx,%esi
+  800db3:	eb 03                	jmp    800db8 <vprintfmt+0x4bc>
+  800db5:	83 ee 01             	sub    $0x1,%esi
+  800db8:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800dbc:	75 f7                	jne    800db5 <vprintfmt+0x4b9>
+  800dbe:	e9 67 fb ff ff       	jmp    80092a <vprintfmt+0x2e>
+
+00800dc3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800dc3:	55                   	push   %ebp
+  800dc4:	89 e5                	mov    %esp,%ebp
+  800dc6:	83 ec 18             	sub    $0x18,%esp
+  800dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dcc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800dcf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800dd2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800dd6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800dd9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800de0:	85 c0                	test   %eax,%eax
+  800de2:	74 26                	je     800e0a <vsnprintf+0x47>
+  800de4:	85 d2                	test   %edx,%edx
+  800de6:	7e 22                	jle    800e0a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800de8:	ff 75 14             	push   0x14(%ebp)
+  800deb:	ff 75 10             	push   0x10(%ebp)
+  800dee:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800df1:	50                   	push   %eax
+  800df2:	68 c2 08 80 00       	push   $0x8008c2
+  800df7:	e8 00 fb ff ff       	call   8008fc <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800dfc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800dff:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800e02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e05:	83 c4 10             	add    $0x10,%esp
+}
+  800e08:	c9                   	leave
+  800e09:	c3                   	ret
+		return -E_INVAL;
+  800e0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e0f:	eb f7                	jmp    800e08 <vsnprintf+0x45>
+
+00800e11 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800e11:	55                   	push   %ebp
+  800e12:	89 e5                	mov    %esp,%ebp
+  800e14:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800e17:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800e1a:	50                   	push   %eax
+  800e1b:	ff 75 10             	push   0x10(%ebp)
+  800e1e:	ff 75 0c             	push   0xc(%ebp)
+  800e21:	ff 75 08             	push   0x8(%ebp)
+  800e24:	e8 9a ff ff ff       	call   800dc3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800e29:	c9                   	leave
+  800e2a:	c3                   	ret
+
+00800e2b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800e31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e36:	eb 03                	jmp    800e3b <strlen+0x10>
+		n++;
+  800e38:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800e3b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800e3f:	75 f7                	jne    800e38 <strlen+0xd>
+	return n;
+}
+  800e41:	5d                   	pop    %ebp
+  800e42:	c3                   	ret
+
+00800e43 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800e43:	55                   	push   %ebp
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e49:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e51:	eb 03                	jmp    800e56 <strnlen+0x13>
+		n++;
+  800e53:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800e56:	39 d0                	cmp    %edx,%eax
+  800e58:	74 08                	je     800e62 <strnlen+0x1f>
+  800e5a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800e5e:	75 f3                	jne    800e53 <strnlen+0x10>
+  800e60:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800e62:	89 d0                	mov    %edx,%eax
+  800e64:	5d                   	pop    %ebp
+  800e65:	c3                   	ret
+
+00800e66 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800e66:	55                   	push   %ebp
+  800e67:	89 e5                	mov    %esp,%ebp
+  800e69:	53                   	push   %ebx
+  800e6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800e70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e75:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800e79:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800e7c:	83 c0 01             	add    $0x1,%eax
+  800e7f:	84 d2                	test   %dl,%dl
+  800e81:	75 f2                	jne    800e75 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800e83:	89 c8                	mov    %ecx,%eax
+  800e85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e88:	c9                   	leave
+  800e89:	c3                   	ret
+
+00800e8a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	53                   	push   %ebx
+  800e8e:	83 ec 10             	sub    $0x10,%esp
+  800e91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800e94:	53                   	push   %ebx
+  800e95:	e8 91 ff ff ff       	call   800e2b <strlen>
+  800e9a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800e9d:	ff 75 0c             	push   0xc(%ebp)
+  800ea0:	01 d8                	add    %ebx,%eax
+  800ea2:	50                   	push   %eax
+  800ea3:	e8 be ff ff ff       	call   800e66 <strcpy>
+	return dst;
+}
+  800ea8:	89 d8                	mov    %ebx,%eax
+  800eaa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ead:	c9                   	leave
+  800eae:	c3                   	ret
+
+00800eaf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+  800eb4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800eb7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800eba:	89 f3                	mov    %esi,%ebx
+  800ebc:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ebf:	89 f0                	mov    %esi,%eax
+  800ec1:	eb 0f                	jmp    800ed2 <strncpy+0x23>
+		*dst++ = *src;
+  800ec3:	83 c0 01             	add    $0x1,%eax
+  800ec6:	0f b6 0a             	movzbl (%edx),%ecx
+  800ec9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ecc:	80 f9 01             	cmp    $0x1,%cl
+  800ecf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ed2:	39 d8                	cmp    %ebx,%eax
+  800ed4:	75 ed                	jne    800ec3 <strncpy+0x14>
+	}
+	return ret;
+}
+  800ed6:	89 f0                	mov    %esi,%eax
+  800ed8:	5b                   	pop    %ebx
+  800ed9:	5e                   	pop    %esi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+
+00800edc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800edc:	55                   	push   %ebp
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	56                   	push   %esi
+  800ee0:	53                   	push   %ebx
+  800ee1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ee4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800eea:	89 f0                	mov    %esi,%eax
+  800eec:	85 d2                	test   %edx,%edx
+  800eee:	74 21                	je     800f11 <strlcpy+0x35>
+  800ef0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ef4:	89 f2                	mov    %esi,%edx
+  800ef6:	eb 09                	jmp    800f01 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800ef8:	83 c1 01             	add    $0x1,%ecx
+  800efb:	83 c2 01             	add    $0x1,%edx
+  800efe:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800f01:	39 c2                	cmp    %eax,%edx
+  800f03:	74 09                	je     800f0e <strlcpy+0x32>
+  800f05:	0f b6 19             	movzbl (%ecx),%ebx
+  800f08:	84 db                	test   %bl,%bl
+  800f0a:	75 ec                	jne    800ef8 <strlcpy+0x1c>
+  800f0c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800f0e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800f11:	29 f0                	sub    %esi,%eax
+}
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+
+00800f17 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800f20:	eb 06                	jmp    800f28 <strcmp+0x11>
+		p++, q++;
+  800f22:	83 c1 01             	add    $0x1,%ecx
+  800f25:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800f28:	0f b6 01             	movzbl (%ecx),%eax
+  800f2b:	84 c0                	test   %al,%al
+  800f2d:	74 04                	je     800f33 <strcmp+0x1c>
+  800f2f:	3a 02                	cmp    (%edx),%al
+  800f31:	74 ef                	je     800f22 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f33:	0f b6 c0             	movzbl %al,%eax
+  800f36:	0f b6 12             	movzbl (%edx),%edx
+  800f39:	29 d0                	sub    %edx,%eax
+}
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	c3                   	ret
+
+00800f3d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800f3d:	55                   	push   %ebp
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	53                   	push   %ebx
+  800f41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800f4a:	eb 09                	jmp    800f55 <strncmp+0x18>
+		n--, p++, q++;
+  800f4c:	83 ea 01             	sub    $0x1,%edx
+  800f4f:	83 c0 01             	add    $0x1,%eax
+  800f52:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800f55:	85 d2                	test   %edx,%edx
+  800f57:	74 18                	je     800f71 <strncmp+0x34>
+  800f59:	0f b6 18             	movzbl (%eax),%ebx
+  800f5c:	84 db                	test   %bl,%bl
+  800f5e:	74 04                	je     800f64 <strncmp+0x27>
+  800f60:	3a 19                	cmp    (%ecx),%bl
+  800f62:	74 e8                	je     800f4c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800f64:	0f b6 00             	movzbl (%eax),%eax
+  800f67:	0f b6 11             	movzbl (%ecx),%edx
+  800f6a:	29 d0                	sub    %edx,%eax
+}
+  800f6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f6f:	c9                   	leave
+  800f70:	c3                   	ret
+		return 0;
+  800f71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f76:	eb f4                	jmp    800f6c <strncmp+0x2f>
+
+00800f78 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800f82:	eb 03                	jmp    800f87 <strchr+0xf>
+  800f84:	83 c0 01             	add    $0x1,%eax
+  800f87:	0f b6 10             	movzbl (%eax),%edx
+  800f8a:	84 d2                	test   %dl,%dl
+  800f8c:	74 06                	je     800f94 <strchr+0x1c>
+		if (*s == c)
+  800f8e:	38 ca                	cmp    %cl,%dl
+  800f90:	75 f2                	jne    800f84 <strchr+0xc>
+  800f92:	eb 05                	jmp    800f99 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800f94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+
+00800f9b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800fa5:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800fa8:	38 ca                	cmp    %cl,%dl
+  800faa:	74 09                	je     800fb5 <strfind+0x1a>
+  800fac:	84 d2                	test   %dl,%dl
+  800fae:	74 05                	je     800fb5 <strfind+0x1a>
+	for (; *s; s++)
+  800fb0:	83 c0 01             	add    $0x1,%eax
+  800fb3:	eb f0                	jmp    800fa5 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800fb5:	5d                   	pop    %ebp
+  800fb6:	c3                   	ret
+
+00800fb7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800fbe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800fc1:	85 c9                	test   %ecx,%ecx
+  800fc3:	74 20                	je     800fe5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800fc5:	89 f8                	mov    %edi,%eax
+  800fc7:	09 c8                	or     %ecx,%eax
+  800fc9:	a8 03                	test   $0x3,%al
+  800fcb:	75 12                	jne    800fdf <memset+0x28>
+		c &= 0xFF;
+  800fcd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800fd1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800fd7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800fda:	fc                   	cld
+  800fdb:	f3 ab                	rep stos %eax,%es:(%edi)
+  800fdd:	eb 06                	jmp    800fe5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800fdf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fe2:	fc                   	cld
+  800fe3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800fe5:	89 f8                	mov    %edi,%eax
+  800fe7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800fea:	c9                   	leave
+  800feb:	c3                   	ret
+
+00800fec <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800fec:	55                   	push   %ebp
+  800fed:	89 e5                	mov    %esp,%ebp
+  800fef:	57                   	push   %edi
+  800ff0:	56                   	push   %esi
+  800ff1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ff4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ff7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ffa:	39 c6                	cmp    %eax,%esi
+  800ffc:	73 32                	jae    801030 <memmove+0x44>
+  800ffe:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  801001:	39 d0                	cmp    %edx,%eax
+  801003:	73 2b                	jae    801030 <memmove+0x44>
+		s += n;
+		d += n;
+  801005:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801008:	89 d6                	mov    %edx,%esi
+  80100a:	09 fe                	or     %edi,%esi
+  80100c:	09 ce                	or     %ecx,%esi
+  80100e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  801014:	75 0e                	jne    801024 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801016:	83 ef 04             	sub    $0x4,%edi
+  801019:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80101c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80101f:	fd                   	std
+  801020:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801022:	eb 09                	jmp    80102d <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801024:	83 ef 01             	sub    $0x1,%edi
+  801027:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80102a:	fd                   	std
+  80102b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80102d:	fc                   	cld
+  80102e:	eb 1a                	jmp    80104a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801030:	89 f2                	mov    %esi,%edx
+  801032:	09 c2                	or     %eax,%edx
+  801034:	09 ca                	or     %ecx,%edx
+  801036:	f6 c2 03             	test   $0x3,%dl
+  801039:	75 0a                	jne    801045 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80103b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  80103e:	89 c7                	mov    %eax,%edi
+  801040:	fc                   	cld
+  801041:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801043:	eb 05                	jmp    80104a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801045:	89 c7                	mov    %eax,%edi
+  801047:	fc                   	cld
+  801048:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80104a:	5e                   	pop    %esi
+  80104b:	5f                   	pop    %edi
+  80104c:	5d                   	pop    %ebp
+  80104d:	c3                   	ret
+
+0080104e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801054:	ff 75 10             	push   0x10(%ebp)
+  801057:	ff 75 0c             	push   0xc(%ebp)
+  80105a:	ff 75 08             	push   0x8(%ebp)
+  80105d:	e8 8a ff ff ff       	call   800fec <memmove>
+}
+  801062:	c9                   	leave
+  801063:	c3                   	ret
+
+00801064 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801064:	55                   	push   %ebp
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	56                   	push   %esi
+  801068:	53                   	push   %ebx
+  801069:	8b 45 08             	mov    0x8(%ebp),%eax
+  80106c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  80106f:	89 c6                	mov    %eax,%esi
+  801071:	03 75 10             	add    0x10(%ebp),%esi
+  801074:	eb 06                	jmp    80107c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801076:	83 c0 01             	add    $0x1,%eax
+  801079:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80107c:	39 f0                	cmp    %esi,%eax
+  80107e:	74 14                	je     801094 <memcmp+0x30>
+		if (*s1 != *s2)
+  801080:	0f b6 08             	movzbl (%eax),%ecx
+  801083:	0f b6 1a             	movzbl (%edx),%ebx
+  801086:	38 d9                	cmp    %bl,%cl
+  801088:	74 ec                	je     801076 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80108a:	0f b6 c1             	movzbl %cl,%eax
+  80108d:	0f b6 db             	movzbl %bl,%ebx
+  801090:	29 d8                	sub    %ebx,%eax
+  801092:	eb 05                	jmp    801099 <memcmp+0x35>
+	}
+
+	return 0;
+  801094:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801099:	5b                   	pop    %ebx
+  80109a:	5e                   	pop    %esi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+
+0080109d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8010a6:	89 c2                	mov    %eax,%edx
+  8010a8:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8010ab:	eb 03                	jmp    8010b0 <memfind+0x13>
+  8010ad:	83 c0 01             	add    $0x1,%eax
+  8010b0:	39 d0                	cmp    %edx,%eax
+  8010b2:	73 04                	jae    8010b8 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8010b4:	38 08                	cmp    %cl,(%eax)
+  8010b6:	75 f5                	jne    8010ad <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+
+008010ba <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	57                   	push   %edi
+  8010be:	56                   	push   %esi
+  8010bf:	53                   	push   %ebx
+  8010c0:	83 ec 1c             	sub    $0x1c,%esp
+  8010c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010c6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8010c9:	eb 03                	jmp    8010ce <strtol+0x14>
+		s++;
+  8010cb:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  8010ce:	0f b6 06             	movzbl (%esi),%eax
+  8010d1:	3c 20                	cmp    $0x20,%al
+  8010d3:	74 f6                	je     8010cb <strtol+0x11>
+  8010d5:	3c 09                	cmp    $0x9,%al
+  8010d7:	74 f2                	je     8010cb <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  8010d9:	3c 2b                	cmp    $0x2b,%al
+  8010db:	74 43                	je     801120 <strtol+0x66>
+	int neg = 0;
+  8010dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  8010e2:	3c 2d                	cmp    $0x2d,%al
+  8010e4:	74 44                	je     80112a <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8010e6:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  8010ec:	75 0f                	jne    8010fd <strtol+0x43>
+  8010ee:	80 3e 30             	cmpb   $0x30,(%esi)
+  8010f1:	74 41                	je     801134 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8010f3:	85 ff                	test   %edi,%edi
+  8010f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010fa:	0f 44 f8             	cmove  %eax,%edi
+  8010fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801102:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  801107:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80110a:	89 fb                	mov    %edi,%ebx
+  80110c:	c1 fb 1f             	sar    $0x1f,%ebx
+  80110f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  801112:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801115:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  801118:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  80111b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80111e:	eb 67                	jmp    801187 <strtol+0xcd>
+		s++;
+  801120:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  801123:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801128:	eb bc                	jmp    8010e6 <strtol+0x2c>
+		s++, neg = 1;
+  80112a:	83 c6 01             	add    $0x1,%esi
+  80112d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801132:	eb b2                	jmp    8010e6 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801134:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  801138:	74 0e                	je     801148 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  80113a:	85 ff                	test   %edi,%edi
+  80113c:	75 bf                	jne    8010fd <strtol+0x43>
+		s++, base = 8;
+  80113e:	83 c6 01             	add    $0x1,%esi
+  801141:	bf 08 00 00 00       	mov    $0x8,%edi
+  801146:	eb b5                	jmp    8010fd <strtol+0x43>
+		s += 2, base = 16;
+  801148:	83 c6 02             	add    $0x2,%esi
+  80114b:	bf 10 00 00 00       	mov    $0x10,%edi
+  801150:	eb ab                	jmp    8010fd <strtol+0x43>
+			dig = *s - '0';
+  801152:	0f be c9             	movsbl %cl,%ecx
+  801155:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  801158:	39 f9                	cmp    %edi,%ecx
+  80115a:	7d 59                	jge    8011b5 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  80115c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  801160:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801163:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801166:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  801169:	0f af d8             	imul   %eax,%ebx
+  80116c:	0f af d7             	imul   %edi,%edx
+  80116f:	01 d3                	add    %edx,%ebx
+  801171:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  801174:	f7 e7                	mul    %edi
+  801176:	01 da                	add    %ebx,%edx
+  801178:	89 cb                	mov    %ecx,%ebx
+  80117a:	c1 fb 1f             	sar    $0x1f,%ebx
+  80117d:	01 c8                	add    %ecx,%eax
+  80117f:	11 da                	adc    %ebx,%edx
+  801181:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  801184:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  801187:	8b 45 08             	mov    0x8(%ebp),%eax
+  80118a:	0f b6 08             	movzbl (%eax),%ecx
+  80118d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  801190:	80 fb 09             	cmp    $0x9,%bl
+  801193:	76 bd                	jbe    801152 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  801195:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  801198:	80 fb 19             	cmp    $0x19,%bl
+  80119b:	77 08                	ja     8011a5 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  80119d:	0f be c9             	movsbl %cl,%ecx
+  8011a0:	83 e9 57             	sub    $0x57,%ecx
+  8011a3:	eb b3                	jmp    801158 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  8011a5:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  8011a8:	80 fb 19             	cmp    $0x19,%bl
+  8011ab:	77 08                	ja     8011b5 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  8011ad:	0f be c9             	movsbl %cl,%ecx
+  8011b0:	83 e9 37             	sub    $0x37,%ecx
+  8011b3:	eb a3                	jmp    801158 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8011b5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8011b8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8011bb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  8011be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011c1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8011c5:	74 05                	je     8011cc <strtol+0x112>
+		*endptr = (char *) s;
+  8011c7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8011ca:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  8011cc:	85 c9                	test   %ecx,%ecx
+  8011ce:	74 07                	je     8011d7 <strtol+0x11d>
+  8011d0:	f7 d8                	neg    %eax
+  8011d2:	83 d2 00             	adc    $0x0,%edx
+  8011d5:	f7 da                	neg    %edx
+}
+  8011d7:	83 c4 1c             	add    $0x1c,%esp
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	57                   	push   %edi
+  8011e3:	56                   	push   %esi
+  8011e4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011e5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011ec:	74 18                	je     801206 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  8011ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f9:	89 c3                	mov    %eax,%ebx
+  8011fb:	89 c7                	mov    %eax,%edi
+  8011fd:	89 c6                	mov    %eax,%esi
+  8011ff:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801211:	89 c3                	mov    %eax,%ebx
+  801213:	89 c7                	mov    %eax,%edi
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	8d 35 20 12 80 00    	lea    0x801220,%esi
+  80121e:	0f 34                	sysenter
+  801220:	5d                   	pop    %ebp
+		goto out;
+  801221:	eb de                	jmp    801201 <sys_cputs+0x22>
+
+00801223 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	57                   	push   %edi
+  801227:	56                   	push   %esi
+  801228:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801229:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801230:	74 19                	je     80124b <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  801232:	ba 00 00 00 00       	mov    $0x0,%edx
+  801237:	b8 01 00 00 00       	mov    $0x1,%eax
+  80123c:	89 d1                	mov    %edx,%ecx
+  80123e:	89 d3                	mov    %edx,%ebx
+  801240:	89 d7                	mov    %edx,%edi
+  801242:	89 d6                	mov    %edx,%esi
+  801244:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80124b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801250:	b8 01 00 00 00       	mov    $0x1,%eax
+  801255:	89 d1                	mov    %edx,%ecx
+  801257:	89 d3                	mov    %edx,%ebx
+  801259:	89 d7                	mov    %edx,%edi
+  80125b:	55                   	push   %ebp
+  80125c:	89 e5                	mov    %esp,%ebp
+  80125e:	8d 35 66 12 80 00    	lea    0x801266,%esi
+  801264:	0f 34                	sysenter
+  801266:	5d                   	pop    %ebp
+		goto out;
+  801267:	eb dd                	jmp    801246 <sys_cgetc+0x23>
+
+00801269 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801269:	55                   	push   %ebp
+  80126a:	89 e5                	mov    %esp,%ebp
+  80126c:	57                   	push   %edi
+  80126d:	56                   	push   %esi
+  80126e:	53                   	push   %ebx
+  80126f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801272:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801279:	74 21                	je     80129c <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  80127b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801280:	b8 03 00 00 00       	mov    $0x3,%eax
+  801285:	8b 55 08             	mov    0x8(%ebp),%edx
+  801288:	89 cb                	mov    %ecx,%ebx
+  80128a:	89 cf                	mov    %ecx,%edi
+  80128c:	89 ce                	mov    %ecx,%esi
+  80128e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801290:	85 c0                	test   %eax,%eax
+  801292:	7f 27                	jg     8012bb <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801294:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801297:	5b                   	pop    %ebx
+  801298:	5e                   	pop    %esi
+  801299:	5f                   	pop    %edi
+  80129a:	5d                   	pop    %ebp
+  80129b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80129c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012a4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8012a9:	89 cb                	mov    %ecx,%ebx
+  8012ab:	89 cf                	mov    %ecx,%edi
+  8012ad:	55                   	push   %ebp
+  8012ae:	89 e5                	mov    %esp,%ebp
+  8012b0:	8d 35 b8 12 80 00    	lea    0x8012b8,%esi
+  8012b6:	0f 34                	sysenter
+  8012b8:	5d                   	pop    %ebp
+		goto out;
+  8012b9:	eb d5                	jmp    801290 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012bb:	83 ec 0c             	sub    $0xc,%esp
+  8012be:	50                   	push   %eax
+  8012bf:	6a 03                	push   $0x3
+  8012c1:	68 cb 38 80 00       	push   $0x8038cb
+  8012c6:	6a 3f                	push   $0x3f
+  8012c8:	68 e8 38 80 00       	push   $0x8038e8
+  8012cd:	e8 71 f4 ff ff       	call   800743 <_panic>
+
+008012d2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8012d2:	55                   	push   %ebp
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	57                   	push   %edi
+  8012d6:	56                   	push   %esi
+  8012d7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012d8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012df:	74 19                	je     8012fa <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  8012e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8012eb:	89 d1                	mov    %edx,%ecx
+  8012ed:	89 d3                	mov    %edx,%ebx
+  8012ef:	89 d7                	mov    %edx,%edi
+  8012f1:	89 d6                	mov    %edx,%esi
+  8012f3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8012f5:	5b                   	pop    %ebx
+  8012f6:	5e                   	pop    %esi
+  8012f7:	5f                   	pop    %edi
+  8012f8:	5d                   	pop    %ebp
+  8012f9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ff:	b8 02 00 00 00       	mov    $0x2,%eax
+  801304:	89 d1                	mov    %edx,%ecx
+  801306:	89 d3                	mov    %edx,%ebx
+  801308:	89 d7                	mov    %edx,%edi
+  80130a:	55                   	push   %ebp
+  80130b:	89 e5                	mov    %esp,%ebp
+  80130d:	8d 35 15 13 80 00    	lea    0x801315,%esi
+  801313:	0f 34                	sysenter
+  801315:	5d                   	pop    %ebp
+		goto out;
+  801316:	eb dd                	jmp    8012f5 <sys_getenvid+0x23>
+
+00801318 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801318:	55                   	push   %ebp
+  801319:	89 e5                	mov    %esp,%ebp
+  80131b:	57                   	push   %edi
+  80131c:	56                   	push   %esi
+  80131d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80131e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801325:	74 19                	je     801340 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  801327:	ba 00 00 00 00       	mov    $0x0,%edx
+  80132c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801331:	89 d1                	mov    %edx,%ecx
+  801333:	89 d3                	mov    %edx,%ebx
+  801335:	89 d7                	mov    %edx,%edi
+  801337:	89 d6                	mov    %edx,%esi
+  801339:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80133b:	5b                   	pop    %ebx
+  80133c:	5e                   	pop    %esi
+  80133d:	5f                   	pop    %edi
+  80133e:	5d                   	pop    %ebp
+  80133f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801340:	ba 00 00 00 00       	mov    $0x0,%edx
+  801345:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80134a:	89 d1                	mov    %edx,%ecx
+  80134c:	89 d3                	mov    %edx,%ebx
+  80134e:	89 d7                	mov    %edx,%edi
+  801350:	55                   	push   %ebp
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	8d 35 5b 13 80 00    	lea    0x80135b,%esi
+  801359:	0f 34                	sysenter
+  80135b:	5d                   	pop    %ebp
+		goto out;
+  80135c:	eb dd                	jmp    80133b <sys_yield+0x23>
+
+0080135e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+  801361:	57                   	push   %edi
+  801362:	56                   	push   %esi
+  801363:	53                   	push   %ebx
+  801364:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801367:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80136e:	74 23                	je     801393 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  801370:	be 00 00 00 00       	mov    $0x0,%esi
+  801375:	b8 04 00 00 00       	mov    $0x4,%eax
+  80137a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801380:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801383:	89 f7                	mov    %esi,%edi
+  801385:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801387:	85 c0                	test   %eax,%eax
+  801389:	7f 29                	jg     8013b4 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80138b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138e:	5b                   	pop    %ebx
+  80138f:	5e                   	pop    %esi
+  801390:	5f                   	pop    %edi
+  801391:	5d                   	pop    %ebp
+  801392:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801393:	8b 55 08             	mov    0x8(%ebp),%edx
+  801396:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801399:	b8 04 00 00 00       	mov    $0x4,%eax
+  80139e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	8d 35 b1 13 80 00    	lea    0x8013b1,%esi
+  8013af:	0f 34                	sysenter
+  8013b1:	5d                   	pop    %ebp
+		goto out;
+  8013b2:	eb d3                	jmp    801387 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b4:	83 ec 0c             	sub    $0xc,%esp
+  8013b7:	50                   	push   %eax
+  8013b8:	6a 04                	push   $0x4
+  8013ba:	68 cb 38 80 00       	push   $0x8038cb
+  8013bf:	6a 3f                	push   $0x3f
+  8013c1:	68 e8 38 80 00       	push   $0x8038e8
+  8013c6:	e8 78 f3 ff ff       	call   800743 <_panic>
+
+008013cb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	57                   	push   %edi
+  8013cf:	56                   	push   %esi
+  8013d0:	53                   	push   %ebx
+  8013d1:	83 ec 0c             	sub    $0xc,%esp
+  8013d4:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  8013d7:	85 f6                	test   %esi,%esi
+  8013d9:	75 09                	jne    8013e4 <sys_page_map+0x19>
+  8013db:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013e2:	74 1f                	je     801403 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  8013e4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8013e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013f7:	85 c0                	test   %eax,%eax
+  8013f9:	7f 27                	jg     801422 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8013fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fe:	5b                   	pop    %ebx
+  8013ff:	5e                   	pop    %esi
+  801400:	5f                   	pop    %edi
+  801401:	5d                   	pop    %ebp
+  801402:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801403:	8b 55 08             	mov    0x8(%ebp),%edx
+  801406:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801409:	b8 05 00 00 00       	mov    $0x5,%eax
+  80140e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801411:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+  801417:	8d 35 1f 14 80 00    	lea    0x80141f,%esi
+  80141d:	0f 34                	sysenter
+  80141f:	5d                   	pop    %ebp
+		goto out;
+  801420:	eb d5                	jmp    8013f7 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801422:	83 ec 0c             	sub    $0xc,%esp
+  801425:	50                   	push   %eax
+  801426:	6a 05                	push   $0x5
+  801428:	68 cb 38 80 00       	push   $0x8038cb
+  80142d:	6a 3f                	push   $0x3f
+  80142f:	68 e8 38 80 00       	push   $0x8038e8
+  801434:	e8 0a f3 ff ff       	call   800743 <_panic>
+
+00801439 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	57                   	push   %edi
+  80143d:	56                   	push   %esi
+  80143e:	53                   	push   %ebx
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801442:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801449:	74 22                	je     80146d <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  80144b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801450:	b8 06 00 00 00       	mov    $0x6,%eax
+  801455:	8b 55 08             	mov    0x8(%ebp),%edx
+  801458:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145b:	89 df                	mov    %ebx,%edi
+  80145d:	89 de                	mov    %ebx,%esi
+  80145f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801461:	85 c0                	test   %eax,%eax
+  801463:	7f 28                	jg     80148d <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801468:	5b                   	pop    %ebx
+  801469:	5e                   	pop    %esi
+  80146a:	5f                   	pop    %edi
+  80146b:	5d                   	pop    %ebp
+  80146c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80146d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801472:	8b 55 08             	mov    0x8(%ebp),%edx
+  801475:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801478:	b8 06 00 00 00       	mov    $0x6,%eax
+  80147d:	89 df                	mov    %ebx,%edi
+  80147f:	55                   	push   %ebp
+  801480:	89 e5                	mov    %esp,%ebp
+  801482:	8d 35 8a 14 80 00    	lea    0x80148a,%esi
+  801488:	0f 34                	sysenter
+  80148a:	5d                   	pop    %ebp
+		goto out;
+  80148b:	eb d4                	jmp    801461 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80148d:	83 ec 0c             	sub    $0xc,%esp
+  801490:	50                   	push   %eax
+  801491:	6a 06                	push   $0x6
+  801493:	68 cb 38 80 00       	push   $0x8038cb
+  801498:	6a 3f                	push   $0x3f
+  80149a:	68 e8 38 80 00       	push   $0x8038e8
+  80149f:	e8 9f f2 ff ff       	call   800743 <_panic>
+
+008014a4 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8014a4:	55                   	push   %ebp
+  8014a5:	89 e5                	mov    %esp,%ebp
+  8014a7:	57                   	push   %edi
+  8014a8:	56                   	push   %esi
+  8014a9:	53                   	push   %ebx
+  8014aa:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014ad:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014b4:	74 22                	je     8014d8 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8014b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c6:	89 df                	mov    %ebx,%edi
+  8014c8:	89 de                	mov    %ebx,%esi
+  8014ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	7f 28                	jg     8014f8 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8014d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014d3:	5b                   	pop    %ebx
+  8014d4:	5e                   	pop    %esi
+  8014d5:	5f                   	pop    %edi
+  8014d6:	5d                   	pop    %ebp
+  8014d7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014e8:	89 df                	mov    %ebx,%edi
+  8014ea:	55                   	push   %ebp
+  8014eb:	89 e5                	mov    %esp,%ebp
+  8014ed:	8d 35 f5 14 80 00    	lea    0x8014f5,%esi
+  8014f3:	0f 34                	sysenter
+  8014f5:	5d                   	pop    %ebp
+		goto out;
+  8014f6:	eb d4                	jmp    8014cc <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014f8:	83 ec 0c             	sub    $0xc,%esp
+  8014fb:	50                   	push   %eax
+  8014fc:	6a 08                	push   $0x8
+  8014fe:	68 cb 38 80 00       	push   $0x8038cb
+  801503:	6a 3f                	push   $0x3f
+  801505:	68 e8 38 80 00       	push   $0x8038e8
+  80150a:	e8 34 f2 ff ff       	call   800743 <_panic>
+
+0080150f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80150f:	55                   	push   %ebp
+  801510:	89 e5                	mov    %esp,%ebp
+  801512:	57                   	push   %edi
+  801513:	56                   	push   %esi
+  801514:	53                   	push   %ebx
+  801515:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801518:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80151f:	74 22                	je     801543 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801521:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801526:	b8 09 00 00 00       	mov    $0x9,%eax
+  80152b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801531:	89 df                	mov    %ebx,%edi
+  801533:	89 de                	mov    %ebx,%esi
+  801535:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801537:	85 c0                	test   %eax,%eax
+  801539:	7f 28                	jg     801563 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80153b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153e:	5b                   	pop    %ebx
+  80153f:	5e                   	pop    %esi
+  801540:	5f                   	pop    %edi
+  801541:	5d                   	pop    %ebp
+  801542:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801543:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801548:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801553:	89 df                	mov    %ebx,%edi
+  801555:	55                   	push   %ebp
+  801556:	89 e5                	mov    %esp,%ebp
+  801558:	8d 35 60 15 80 00    	lea    0x801560,%esi
+  80155e:	0f 34                	sysenter
+  801560:	5d                   	pop    %ebp
+		goto out;
+  801561:	eb d4                	jmp    801537 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801563:	83 ec 0c             	sub    $0xc,%esp
+  801566:	50                   	push   %eax
+  801567:	6a 09                	push   $0x9
+  801569:	68 cb 38 80 00       	push   $0x8038cb
+  80156e:	6a 3f                	push   $0x3f
+  801570:	68 e8 38 80 00       	push   $0x8038e8
+  801575:	e8 c9 f1 ff ff       	call   800743 <_panic>
+
+0080157a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80157a:	55                   	push   %ebp
+  80157b:	89 e5                	mov    %esp,%ebp
+  80157d:	57                   	push   %edi
+  80157e:	56                   	push   %esi
+  80157f:	53                   	push   %ebx
+  801580:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801583:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80158a:	74 22                	je     8015ae <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80158c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801591:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801596:	8b 55 08             	mov    0x8(%ebp),%edx
+  801599:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80159c:	89 df                	mov    %ebx,%edi
+  80159e:	89 de                	mov    %ebx,%esi
+  8015a0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015a2:	85 c0                	test   %eax,%eax
+  8015a4:	7f 28                	jg     8015ce <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8015a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a9:	5b                   	pop    %ebx
+  8015aa:	5e                   	pop    %esi
+  8015ab:	5f                   	pop    %edi
+  8015ac:	5d                   	pop    %ebp
+  8015ad:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015be:	89 df                	mov    %ebx,%edi
+  8015c0:	55                   	push   %ebp
+  8015c1:	89 e5                	mov    %esp,%ebp
+  8015c3:	8d 35 cb 15 80 00    	lea    0x8015cb,%esi
+  8015c9:	0f 34                	sysenter
+  8015cb:	5d                   	pop    %ebp
+		goto out;
+  8015cc:	eb d4                	jmp    8015a2 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015ce:	83 ec 0c             	sub    $0xc,%esp
+  8015d1:	50                   	push   %eax
+  8015d2:	6a 0a                	push   $0xa
+  8015d4:	68 cb 38 80 00       	push   $0x8038cb
+  8015d9:	6a 3f                	push   $0x3f
+  8015db:	68 e8 38 80 00       	push   $0x8038e8
+  8015e0:	e8 5e f1 ff ff       	call   800743 <_panic>
+
+008015e5 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8015e5:	55                   	push   %ebp
+  8015e6:	89 e5                	mov    %esp,%ebp
+  8015e8:	57                   	push   %edi
+  8015e9:	56                   	push   %esi
+  8015ea:	53                   	push   %ebx
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8015ee:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015f5:	74 22                	je     801619 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8015f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015fc:	b8 17 00 00 00       	mov    $0x17,%eax
+  801601:	8b 55 08             	mov    0x8(%ebp),%edx
+  801604:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801607:	89 df                	mov    %ebx,%edi
+  801609:	89 de                	mov    %ebx,%esi
+  80160b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	7f 28                	jg     801639 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801611:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801614:	5b                   	pop    %ebx
+  801615:	5e                   	pop    %esi
+  801616:	5f                   	pop    %edi
+  801617:	5d                   	pop    %ebp
+  801618:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801621:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801624:	b8 17 00 00 00       	mov    $0x17,%eax
+  801629:	89 df                	mov    %ebx,%edi
+  80162b:	55                   	push   %ebp
+  80162c:	89 e5                	mov    %esp,%ebp
+  80162e:	8d 35 36 16 80 00    	lea    0x801636,%esi
+  801634:	0f 34                	sysenter
+  801636:	5d                   	pop    %ebp
+		goto out;
+  801637:	eb d4                	jmp    80160d <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801639:	83 ec 0c             	sub    $0xc,%esp
+  80163c:	50                   	push   %eax
+  80163d:	6a 17                	push   $0x17
+  80163f:	68 cb 38 80 00       	push   $0x8038cb
+  801644:	6a 3f                	push   $0x3f
+  801646:	68 e8 38 80 00       	push   $0x8038e8
+  80164b:	e8 f3 f0 ff ff       	call   800743 <_panic>
+
+00801650 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801650:	55                   	push   %ebp
+  801651:	89 e5                	mov    %esp,%ebp
+  801653:	57                   	push   %edi
+  801654:	56                   	push   %esi
+  801655:	53                   	push   %ebx
+  801656:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801659:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801660:	74 22                	je     801684 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801667:	b8 18 00 00 00       	mov    $0x18,%eax
+  80166c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80166f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801672:	89 df                	mov    %ebx,%edi
+  801674:	89 de                	mov    %ebx,%esi
+  801676:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	7f 28                	jg     8016a4 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80167c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167f:	5b                   	pop    %ebx
+  801680:	5e                   	pop    %esi
+  801681:	5f                   	pop    %edi
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801684:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801689:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801694:	89 df                	mov    %ebx,%edi
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	8d 35 a1 16 80 00    	lea    0x8016a1,%esi
+  80169f:	0f 34                	sysenter
+  8016a1:	5d                   	pop    %ebp
+		goto out;
+  8016a2:	eb d4                	jmp    801678 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016a4:	83 ec 0c             	sub    $0xc,%esp
+  8016a7:	50                   	push   %eax
+  8016a8:	6a 18                	push   $0x18
+  8016aa:	68 cb 38 80 00       	push   $0x8038cb
+  8016af:	6a 3f                	push   $0x3f
+  8016b1:	68 e8 38 80 00       	push   $0x8038e8
+  8016b6:	e8 88 f0 ff ff       	call   800743 <_panic>
+
+008016bb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8016bb:	55                   	push   %ebp
+  8016bc:	89 e5                	mov    %esp,%ebp
+  8016be:	57                   	push   %edi
+  8016bf:	56                   	push   %esi
+  8016c0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016c1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016c8:	74 1d                	je     8016e7 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8016ca:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8016cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016dd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016e0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8016e2:	5b                   	pop    %ebx
+  8016e3:	5e                   	pop    %esi
+  8016e4:	5f                   	pop    %edi
+  8016e5:	5d                   	pop    %ebp
+  8016e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ed:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8016f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016f8:	55                   	push   %ebp
+  8016f9:	89 e5                	mov    %esp,%ebp
+  8016fb:	8d 35 03 17 80 00    	lea    0x801703,%esi
+  801701:	0f 34                	sysenter
+  801703:	5d                   	pop    %ebp
+		goto out;
+  801704:	eb dc                	jmp    8016e2 <sys_ipc_try_send+0x27>
+
+00801706 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	57                   	push   %edi
+  80170a:	56                   	push   %esi
+  80170b:	53                   	push   %ebx
+  80170c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80170f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801716:	74 21                	je     801739 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801718:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80171d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801722:	8b 55 08             	mov    0x8(%ebp),%edx
+  801725:	89 cb                	mov    %ecx,%ebx
+  801727:	89 cf                	mov    %ecx,%edi
+  801729:	89 ce                	mov    %ecx,%esi
+  80172b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80172d:	85 c0                	test   %eax,%eax
+  80172f:	7f 27                	jg     801758 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801734:	5b                   	pop    %ebx
+  801735:	5e                   	pop    %esi
+  801736:	5f                   	pop    %edi
+  801737:	5d                   	pop    %ebp
+  801738:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801739:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801741:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801746:	89 cb                	mov    %ecx,%ebx
+  801748:	89 cf                	mov    %ecx,%edi
+  80174a:	55                   	push   %ebp
+  80174b:	89 e5                	mov    %esp,%ebp
+  80174d:	8d 35 55 17 80 00    	lea    0x801755,%esi
+  801753:	0f 34                	sysenter
+  801755:	5d                   	pop    %ebp
+		goto out;
+  801756:	eb d5                	jmp    80172d <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801758:	83 ec 0c             	sub    $0xc,%esp
+  80175b:	50                   	push   %eax
+  80175c:	6a 0d                	push   $0xd
+  80175e:	68 cb 38 80 00       	push   $0x8038cb
+  801763:	6a 3f                	push   $0x3f
+  801765:	68 e8 38 80 00       	push   $0x8038e8
+  80176a:	e8 d4 ef ff ff       	call   800743 <_panic>
+
+0080176f <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	57                   	push   %edi
+  801773:	56                   	push   %esi
+  801774:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801775:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80177c:	74 1b                	je     801799 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80177e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801783:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801788:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178e:	89 df                	mov    %ebx,%edi
+  801790:	89 de                	mov    %ebx,%esi
+  801792:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801794:	5b                   	pop    %ebx
+  801795:	5e                   	pop    %esi
+  801796:	5f                   	pop    %edi
+  801797:	5d                   	pop    %ebp
+  801798:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801799:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8017a9:	89 df                	mov    %ebx,%edi
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	8d 35 b6 17 80 00    	lea    0x8017b6,%esi
+  8017b4:	0f 34                	sysenter
+  8017b6:	5d                   	pop    %ebp
+		goto out;
+  8017b7:	eb db                	jmp    801794 <sys_ipc_recv_until+0x25>
+
+008017b9 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8017b9:	55                   	push   %ebp
+  8017ba:	89 e5                	mov    %esp,%ebp
+  8017bc:	57                   	push   %edi
+  8017bd:	56                   	push   %esi
+  8017be:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017bf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017c6:	74 19                	je     8017e1 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8017c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8017d2:	89 d1                	mov    %edx,%ecx
+  8017d4:	89 d3                	mov    %edx,%ebx
+  8017d6:	89 d7                	mov    %edx,%edi
+  8017d8:	89 d6                	mov    %edx,%esi
+  8017da:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8017dc:	5b                   	pop    %ebx
+  8017dd:	5e                   	pop    %esi
+  8017de:	5f                   	pop    %edi
+  8017df:	5d                   	pop    %ebp
+  8017e0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8017eb:	89 d1                	mov    %edx,%ecx
+  8017ed:	89 d3                	mov    %edx,%ebx
+  8017ef:	89 d7                	mov    %edx,%edi
+  8017f1:	55                   	push   %ebp
+  8017f2:	89 e5                	mov    %esp,%ebp
+  8017f4:	8d 35 fc 17 80 00    	lea    0x8017fc,%esi
+  8017fa:	0f 34                	sysenter
+  8017fc:	5d                   	pop    %ebp
+		goto out;
+  8017fd:	eb dd                	jmp    8017dc <sys_time_msec+0x23>
+
+008017ff <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	57                   	push   %edi
+  801803:	56                   	push   %esi
+  801804:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801805:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80180c:	74 1a                	je     801828 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80180e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801813:	b8 10 00 00 00       	mov    $0x10,%eax
+  801818:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181b:	89 cb                	mov    %ecx,%ebx
+  80181d:	89 cf                	mov    %ecx,%edi
+  80181f:	89 ce                	mov    %ecx,%esi
+  801821:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801823:	5b                   	pop    %ebx
+  801824:	5e                   	pop    %esi
+  801825:	5f                   	pop    %edi
+  801826:	5d                   	pop    %ebp
+  801827:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801828:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801830:	b8 10 00 00 00       	mov    $0x10,%eax
+  801835:	89 cb                	mov    %ecx,%ebx
+  801837:	89 cf                	mov    %ecx,%edi
+  801839:	55                   	push   %ebp
+  80183a:	89 e5                	mov    %esp,%ebp
+  80183c:	8d 35 44 18 80 00    	lea    0x801844,%esi
+  801842:	0f 34                	sysenter
+  801844:	5d                   	pop    %ebp
+		goto out;
+  801845:	eb dc                	jmp    801823 <sys_sleep_until+0x24>
+
+00801847 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801847:	55                   	push   %ebp
+  801848:	89 e5                	mov    %esp,%ebp
+  80184a:	57                   	push   %edi
+  80184b:	56                   	push   %esi
+  80184c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80184d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801854:	74 1a                	je     801870 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801856:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80185b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801860:	8b 55 08             	mov    0x8(%ebp),%edx
+  801863:	89 cb                	mov    %ecx,%ebx
+  801865:	89 cf                	mov    %ecx,%edi
+  801867:	89 ce                	mov    %ecx,%esi
+  801869:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80186b:	5b                   	pop    %ebx
+  80186c:	5e                   	pop    %esi
+  80186d:	5f                   	pop    %edi
+  80186e:	5d                   	pop    %ebp
+  80186f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801870:	8b 55 08             	mov    0x8(%ebp),%edx
+  801873:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801878:	b8 11 00 00 00       	mov    $0x11,%eax
+  80187d:	89 cb                	mov    %ecx,%ebx
+  80187f:	89 cf                	mov    %ecx,%edi
+  801881:	55                   	push   %ebp
+  801882:	89 e5                	mov    %esp,%ebp
+  801884:	8d 35 8c 18 80 00    	lea    0x80188c,%esi
+  80188a:	0f 34                	sysenter
+  80188c:	5d                   	pop    %ebp
+		goto out;
+  80188d:	eb dc                	jmp    80186b <sys_env_print_stats+0x24>
+
+0080188f <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80188f:	55                   	push   %ebp
+  801890:	89 e5                	mov    %esp,%ebp
+  801892:	57                   	push   %edi
+  801893:	56                   	push   %esi
+  801894:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801895:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80189c:	74 1b                	je     8018b9 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80189e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a3:	b8 19 00 00 00       	mov    $0x19,%eax
+  8018a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ae:	89 df                	mov    %ebx,%edi
+  8018b0:	89 de                	mov    %ebx,%esi
+  8018b2:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8018b4:	5b                   	pop    %ebx
+  8018b5:	5e                   	pop    %esi
+  8018b6:	5f                   	pop    %edi
+  8018b7:	5d                   	pop    %ebp
+  8018b8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c4:	b8 19 00 00 00       	mov    $0x19,%eax
+  8018c9:	89 df                	mov    %ebx,%edi
+  8018cb:	55                   	push   %ebp
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	8d 35 d6 18 80 00    	lea    0x8018d6,%esi
+  8018d4:	0f 34                	sysenter
+  8018d6:	5d                   	pop    %ebp
+		goto out;
+  8018d7:	eb db                	jmp    8018b4 <sys_perf+0x25>
+
+008018d9 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8018d9:	55                   	push   %ebp
+  8018da:	89 e5                	mov    %esp,%ebp
+  8018dc:	57                   	push   %edi
+  8018dd:	56                   	push   %esi
+  8018de:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018df:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018e6:	74 19                	je     801901 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8018e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ed:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8018f2:	89 d1                	mov    %edx,%ecx
+  8018f4:	89 d3                	mov    %edx,%ebx
+  8018f6:	89 d7                	mov    %edx,%edi
+  8018f8:	89 d6                	mov    %edx,%esi
+  8018fa:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8018fc:	5b                   	pop    %ebx
+  8018fd:	5e                   	pop    %esi
+  8018fe:	5f                   	pop    %edi
+  8018ff:	5d                   	pop    %ebp
+  801900:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801901:	ba 00 00 00 00       	mov    $0x0,%edx
+  801906:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80190b:	89 d1                	mov    %edx,%ecx
+  80190d:	89 d3                	mov    %edx,%ebx
+  80190f:	89 d7                	mov    %edx,%edi
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+  801914:	8d 35 1c 19 80 00    	lea    0x80191c,%esi
+  80191a:	0f 34                	sysenter
+  80191c:	5d                   	pop    %ebp
+		goto out;
+  80191d:	eb dd                	jmp    8018fc <sys_fork+0x23>
+
+0080191f <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80191f:	55                   	push   %ebp
+  801920:	89 e5                	mov    %esp,%ebp
+  801922:	57                   	push   %edi
+  801923:	56                   	push   %esi
+  801924:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801925:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80192c:	74 1c                	je     80194a <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  80192e:	be 00 00 00 00       	mov    $0x0,%esi
+  801933:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801938:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80193e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801941:	89 f7                	mov    %esi,%edi
+  801943:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801945:	5b                   	pop    %ebx
+  801946:	5e                   	pop    %esi
+  801947:	5f                   	pop    %edi
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80194a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801950:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801955:	bf 00 00 00 00       	mov    $0x0,%edi
+  80195a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80195d:	55                   	push   %ebp
+  80195e:	89 e5                	mov    %esp,%ebp
+  801960:	8d 35 68 19 80 00    	lea    0x801968,%esi
+  801966:	0f 34                	sysenter
+  801968:	5d                   	pop    %ebp
+		goto out;
+  801969:	eb da                	jmp    801945 <sys_thread_create+0x26>
+
+0080196b <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80196b:	55                   	push   %ebp
+  80196c:	89 e5                	mov    %esp,%ebp
+  80196e:	57                   	push   %edi
+  80196f:	56                   	push   %esi
+  801970:	53                   	push   %ebx
+  801971:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801974:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80197b:	74 24                	je     8019a1 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80197d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801982:	be 00 00 00 00       	mov    $0x0,%esi
+  801987:	8b 55 08             	mov    0x8(%ebp),%edx
+  80198a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80198d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801990:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801993:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801995:	85 c0                	test   %eax,%eax
+  801997:	7f 27                	jg     8019c0 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801999:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199c:	5b                   	pop    %ebx
+  80199d:	5e                   	pop    %esi
+  80199e:	5f                   	pop    %edi
+  80199f:	5d                   	pop    %ebp
+  8019a0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8019ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019b2:	55                   	push   %ebp
+  8019b3:	89 e5                	mov    %esp,%ebp
+  8019b5:	8d 35 bd 19 80 00    	lea    0x8019bd,%esi
+  8019bb:	0f 34                	sysenter
+  8019bd:	5d                   	pop    %ebp
+		goto out;
+  8019be:	eb d5                	jmp    801995 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019c0:	83 ec 0c             	sub    $0xc,%esp
+  8019c3:	50                   	push   %eax
+  8019c4:	6a 1f                	push   $0x1f
+  8019c6:	68 cb 38 80 00       	push   $0x8038cb
+  8019cb:	6a 3f                	push   $0x3f
+  8019cd:	68 e8 38 80 00       	push   $0x8038e8
+  8019d2:	e8 6c ed ff ff       	call   800743 <_panic>
+
+008019d7 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8019d7:	55                   	push   %ebp
+  8019d8:	89 e5                	mov    %esp,%ebp
+  8019da:	57                   	push   %edi
+  8019db:	56                   	push   %esi
+  8019dc:	53                   	push   %ebx
+  8019dd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8019e0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8019e7:	74 23                	je     801a0c <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8019e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8019ee:	b8 20 00 00 00       	mov    $0x20,%eax
+  8019f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019fc:	89 f7                	mov    %esi,%edi
+  8019fe:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	7f 29                	jg     801a2d <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801a04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a07:	5b                   	pop    %ebx
+  801a08:	5e                   	pop    %esi
+  801a09:	5f                   	pop    %edi
+  801a0a:	5d                   	pop    %ebp
+  801a0b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a12:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a17:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a1f:	55                   	push   %ebp
+  801a20:	89 e5                	mov    %esp,%ebp
+  801a22:	8d 35 2a 1a 80 00    	lea    0x801a2a,%esi
+  801a28:	0f 34                	sysenter
+  801a2a:	5d                   	pop    %ebp
+		goto out;
+  801a2b:	eb d3                	jmp    801a00 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a2d:	83 ec 0c             	sub    $0xc,%esp
+  801a30:	50                   	push   %eax
+  801a31:	6a 20                	push   $0x20
+  801a33:	68 cb 38 80 00       	push   $0x8038cb
+  801a38:	6a 3f                	push   $0x3f
+  801a3a:	68 e8 38 80 00       	push   $0x8038e8
+  801a3f:	e8 ff ec ff ff       	call   800743 <_panic>
+
+00801a44 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801a44:	55                   	push   %ebp
+  801a45:	89 e5                	mov    %esp,%ebp
+  801a47:	57                   	push   %edi
+  801a48:	56                   	push   %esi
+  801a49:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a4a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801a51:	74 1b                	je     801a6e <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801a53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a58:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801a5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a63:	89 df                	mov    %ebx,%edi
+  801a65:	89 de                	mov    %ebx,%esi
+  801a67:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801a69:	5b                   	pop    %ebx
+  801a6a:	5e                   	pop    %esi
+  801a6b:	5f                   	pop    %edi
+  801a6c:	5d                   	pop    %ebp
+  801a6d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a73:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a79:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801a7e:	89 df                	mov    %ebx,%edi
+  801a80:	55                   	push   %ebp
+  801a81:	89 e5                	mov    %esp,%ebp
+  801a83:	8d 35 8b 1a 80 00    	lea    0x801a8b,%esi
+  801a89:	0f 34                	sysenter
+  801a8b:	5d                   	pop    %ebp
+		goto out;
+  801a8c:	eb db                	jmp    801a69 <sys_batch+0x25>
+
+00801a8e <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801a8e:	55                   	push   %ebp
+  801a8f:	89 e5                	mov    %esp,%ebp
+  801a91:	57                   	push   %edi
+  801a92:	56                   	push   %esi
+  801a93:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a94:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801a9b:	74 1a                	je     801ab7 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aa2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801aa7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aaa:	89 cb                	mov    %ecx,%ebx
+  801aac:	89 cf                	mov    %ecx,%edi
+  801aae:	89 ce                	mov    %ecx,%esi
+  801ab0:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801ab2:	5b                   	pop    %ebx
+  801ab3:	5e                   	pop    %esi
+  801ab4:	5f                   	pop    %edi
+  801ab5:	5d                   	pop    %ebp
+  801ab6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ab7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801abf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801ac4:	89 cb                	mov    %ecx,%ebx
+  801ac6:	89 cf                	mov    %ecx,%edi
+  801ac8:	55                   	push   %ebp
+  801ac9:	89 e5                	mov    %esp,%ebp
+  801acb:	8d 35 d3 1a 80 00    	lea    0x801ad3,%esi
+  801ad1:	0f 34                	sysenter
+  801ad3:	5d                   	pop    %ebp
+		goto out;
+  801ad4:	eb dc                	jmp    801ab2 <sys_trace_ctl+0x24>
+
+00801ad6 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801ad6:	55                   	push   %ebp
+  801ad7:	89 e5                	mov    %esp,%ebp
+  801ad9:	57                   	push   %edi
+  801ada:	56                   	push   %esi
+  801adb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801adc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801ae3:	74 1c                	je     801b01 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801ae5:	be 00 00 00 00       	mov    $0x0,%esi
+  801aea:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801aef:	8b 55 08             	mov    0x8(%ebp),%edx
+  801af2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801af5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801af8:	89 f7                	mov    %esi,%edi
+  801afa:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801afc:	5b                   	pop    %ebx
+  801afd:	5e                   	pop    %esi
+  801afe:	5f                   	pop    %edi
+  801aff:	5d                   	pop    %ebp
+  801b00:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b01:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b07:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b14:	55                   	push   %ebp
+  801b15:	89 e5                	mov    %esp,%ebp
+  801b17:	8d 35 1f 1b 80 00    	lea    0x801b1f,%esi
+  801b1d:	0f 34                	sysenter
+  801b1f:	5d                   	pop    %ebp
+		goto out;
+  801b20:	eb da                	jmp    801afc <sys_trace_read+0x26>
+
+00801b22 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	57                   	push   %edi
+  801b26:	56                   	push   %esi
+  801b27:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b28:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801b2f:	74 1c                	je     801b4d <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801b31:	be 00 00 00 00       	mov    $0x0,%esi
+  801b36:	b8 21 00 00 00       	mov    $0x21,%eax
+  801b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b44:	89 f7                	mov    %esi,%edi
+  801b46:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801b48:	5b                   	pop    %ebx
+  801b49:	5e                   	pop    %esi
+  801b4a:	5f                   	pop    %edi
+  801b4b:	5d                   	pop    %ebp
+  801b4c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b53:	b8 21 00 00 00       	mov    $0x21,%eax
+  801b58:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	8d 35 6b 1b 80 00    	lea    0x801b6b,%esi
+  801b69:	0f 34                	sysenter
+  801b6b:	5d                   	pop    %ebp
+		goto out;
+  801b6c:	eb da                	jmp    801b48 <sys_meminfo+0x26>
+
+00801b6e <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801b6e:	55                   	push   %ebp
+  801b6f:	89 e5                	mov    %esp,%ebp
+  801b71:	57                   	push   %edi
+  801b72:	56                   	push   %esi
+  801b73:	53                   	push   %ebx
+  801b74:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801b77:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801b7b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801b82:	74 1f                	je     801ba3 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801b84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b89:	b8 22 00 00 00       	mov    $0x22,%eax
+  801b8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b91:	89 df                	mov    %ebx,%edi
+  801b93:	89 de                	mov    %ebx,%esi
+  801b95:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801b97:	85 c0                	test   %eax,%eax
+  801b99:	7f 25                	jg     801bc0 <sys_env_set_ksm+0x52>
+}
+  801b9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b9e:	5b                   	pop    %ebx
+  801b9f:	5e                   	pop    %esi
+  801ba0:	5f                   	pop    %edi
+  801ba1:	5d                   	pop    %ebp
+  801ba2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ba3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bab:	b8 22 00 00 00       	mov    $0x22,%eax
+  801bb0:	89 df                	mov    %ebx,%edi
+  801bb2:	55                   	push   %ebp
+  801bb3:	89 e5                	mov    %esp,%ebp
+  801bb5:	8d 35 bd 1b 80 00    	lea    0x801bbd,%esi
+  801bbb:	0f 34                	sysenter
+  801bbd:	5d                   	pop    %ebp
+		goto out;
+  801bbe:	eb d7                	jmp    801b97 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bc0:	83 ec 0c             	sub    $0xc,%esp
+  801bc3:	50                   	push   %eax
+  801bc4:	6a 22                	push   $0x22
+  801bc6:	68 cb 38 80 00       	push   $0x8038cb
+  801bcb:	6a 3f                	push   $0x3f
+  801bcd:	68 e8 38 80 00       	push   $0x8038e8
+  801bd2:	e8 6c eb ff ff       	call   800743 <_panic>
+
+00801bd7 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+  801bda:	57                   	push   %edi
+  801bdb:	56                   	push   %esi
+  801bdc:	53                   	push   %ebx
+  801bdd:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801be0:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801be3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801bea:	74 24                	je     801c10 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801bec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bf1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801bf6:	89 cb                	mov    %ecx,%ebx
+  801bf8:	89 cf                	mov    %ecx,%edi
+  801bfa:	89 ce                	mov    %ecx,%esi
+  801bfc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801bfe:	85 c0                	test   %eax,%eax
+  801c00:	7f 2a                	jg     801c2c <sys_time_nsec+0x55>
+	return ns;
+}
+  801c02:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c05:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c0b:	5b                   	pop    %ebx
+  801c0c:	5e                   	pop    %esi
+  801c0d:	5f                   	pop    %edi
+  801c0e:	5d                   	pop    %ebp
+  801c0f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c15:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801c1a:	89 cb                	mov    %ecx,%ebx
+  801c1c:	89 cf                	mov    %ecx,%edi
+  801c1e:	55                   	push   %ebp
+  801c1f:	89 e5                	mov    %esp,%ebp
+  801c21:	8d 35 29 1c 80 00    	lea    0x801c29,%esi
+  801c27:	0f 34                	sysenter
+  801c29:	5d                   	pop    %ebp
+		goto out;
+  801c2a:	eb d2                	jmp    801bfe <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c2c:	83 ec 0c             	sub    $0xc,%esp
+  801c2f:	50                   	push   %eax
+  801c30:	6a 0f                	push   $0xf
+  801c32:	68 cb 38 80 00       	push   $0x8038cb
+  801c37:	6a 3f                	push   $0x3f
+  801c39:	68 e8 38 80 00       	push   $0x8038e8
+  801c3e:	e8 00 eb ff ff       	call   800743 <_panic>
+
+00801c43 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801c43:	55                   	push   %ebp
+  801c44:	89 e5                	mov    %esp,%ebp
+  801c46:	57                   	push   %edi
+  801c47:	56                   	push   %esi
+  801c48:	53                   	push   %ebx
+  801c49:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801c4c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801c53:	74 22                	je     801c77 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801c55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5a:	b8 12 00 00 00       	mov    $0x12,%eax
+  801c5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c65:	89 df                	mov    %ebx,%edi
+  801c67:	89 de                	mov    %ebx,%esi
+  801c69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	7f 28                	jg     801c97 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801c6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c72:	5b                   	pop    %ebx
+  801c73:	5e                   	pop    %esi
+  801c74:	5f                   	pop    %edi
+  801c75:	5d                   	pop    %ebp
+  801c76:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801c77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801c82:	b8 12 00 00 00       	mov    $0x12,%eax
+  801c87:	89 df                	mov    %ebx,%edi
+  801c89:	55                   	push   %ebp
+  801c8a:	89 e5                	mov    %esp,%ebp
+  801c8c:	8d 35 94 1c 80 00    	lea    0x801c94,%esi
+  801c92:	0f 34                	sysenter
+  801c94:	5d                   	pop    %ebp
+		goto out;
+  801c95:	eb d4                	jmp    801c6b <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c97:	83 ec 0c             	sub    $0xc,%esp
+  801c9a:	50                   	push   %eax
+  801c9b:	6a 12                	push   $0x12
+  801c9d:	68 cb 38 80 00       	push   $0x8038cb
+  801ca2:	6a 3f                	push   $0x3f
+  801ca4:	68 e8 38 80 00       	push   $0x8038e8
+  801ca9:	e8 95 ea ff ff       	call   800743 <_panic>
+
+00801cae <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801cae:	55                   	push   %ebp
+  801caf:	89 e5                	mov    %esp,%ebp
+  801cb1:	57                   	push   %edi
+  801cb2:	56                   	push   %esi
+  801cb3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801cb4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801cbb:	74 1b                	je     801cd8 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801cbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc2:	b8 13 00 00 00       	mov    $0x13,%eax
+  801cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801cca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ccd:	89 df                	mov    %ebx,%edi
+  801ccf:	89 de                	mov    %ebx,%esi
+  801cd1:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801cd3:	5b                   	pop    %ebx
+  801cd4:	5e                   	pop    %esi
+  801cd5:	5f                   	pop    %edi
+  801cd6:	5d                   	pop    %ebp
+  801cd7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801cd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ce0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ce3:	b8 13 00 00 00       	mov    $0x13,%eax
+  801ce8:	89 df                	mov    %ebx,%edi
+  801cea:	55                   	push   %ebp
+  801ceb:	89 e5                	mov    %esp,%ebp
+  801ced:	8d 35 f5 1c 80 00    	lea    0x801cf5,%esi
+  801cf3:	0f 34                	sysenter
+  801cf5:	5d                   	pop    %ebp
+		goto out;
+  801cf6:	eb db                	jmp    801cd3 <sys_e1000_receive+0x25>
+
+00801cf8 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801cf8:	55                   	push   %ebp
+  801cf9:	89 e5                	mov    %esp,%ebp
+  801cfb:	57                   	push   %edi
+  801cfc:	56                   	push   %esi
+  801cfd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801cfe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801d05:	74 1b                	je     801d22 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801d07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d0c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d11:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d17:	89 df                	mov    %ebx,%edi
+  801d19:	89 de                	mov    %ebx,%esi
+  801d1b:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801d1d:	5b                   	pop    %ebx
+  801d1e:	5e                   	pop    %esi
+  801d1f:	5f                   	pop    %edi
+  801d20:	5d                   	pop    %ebp
+  801d21:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801d22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d2d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801d32:	89 df                	mov    %ebx,%edi
+  801d34:	55                   	push   %ebp
+  801d35:	89 e5                	mov    %esp,%ebp
+  801d37:	8d 35 3f 1d 80 00    	lea    0x801d3f,%esi
+  801d3d:	0f 34                	sysenter
+  801d3f:	5d                   	pop    %ebp
+		goto out;
+  801d40:	eb db                	jmp    801d1d <sys_e1000_read_hwaddr+0x25>
+
+00801d42 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801d42:	55                   	push   %ebp
+  801d43:	89 e5                	mov    %esp,%ebp
+  801d45:	57                   	push   %edi
+  801d46:	56                   	push   %esi
+  801d47:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801d48:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801d4f:	74 1a                	je     801d6b <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801d51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d56:	b8 15 00 00 00       	mov    $0x15,%eax
+  801d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d5e:	89 cb                	mov    %ecx,%ebx
+  801d60:	89 cf                	mov    %ecx,%edi
+  801d62:	89 ce                	mov    %ecx,%esi
+  801d64:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801d66:	5b                   	pop    %ebx
+  801d67:	5e                   	pop    %esi
+  801d68:	5f                   	pop    %edi
+  801d69:	5d                   	pop    %ebp
+  801d6a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801d6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d73:	b8 15 00 00 00       	mov    $0x15,%eax
+  801d78:	89 cb                	mov    %ecx,%ebx
+  801d7a:	89 cf                	mov    %ecx,%edi
+  801d7c:	55                   	push   %ebp
+  801d7d:	89 e5                	mov    %esp,%ebp
+  801d7f:	8d 35 87 1d 80 00    	lea    0x801d87,%esi
+  801d85:	0f 34                	sysenter
+  801d87:	5d                   	pop    %ebp
+		goto out;
+  801d88:	eb dc                	jmp    801d66 <sys_sb16_read_version+0x24>
+
+00801d8a <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801d8a:	55                   	push   %ebp
+  801d8b:	89 e5                	mov    %esp,%ebp
+  801d8d:	57                   	push   %edi
+  801d8e:	56                   	push   %esi
+  801d8f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801d90:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801d97:	74 1b                	je     801db4 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801d99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801da6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801da9:	89 df                	mov    %ebx,%edi
+  801dab:	89 de                	mov    %ebx,%esi
+  801dad:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801daf:	5b                   	pop    %ebx
+  801db0:	5e                   	pop    %esi
+  801db1:	5f                   	pop    %edi
+  801db2:	5d                   	pop    %ebp
+  801db3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801db4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801dbf:	b8 16 00 00 00       	mov    $0x16,%eax
+  801dc4:	89 df                	mov    %ebx,%edi
+  801dc6:	55                   	push   %ebp
+  801dc7:	89 e5                	mov    %esp,%ebp
+  801dc9:	8d 35 d1 1d 80 00    	lea    0x801dd1,%esi
+  801dcf:	0f 34                	sysenter
+  801dd1:	5d                   	pop    %ebp
+		goto out;
+  801dd2:	eb db                	jmp    801daf <sys_sb16_play+0x25>
+
+00801dd4 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801dd4:	55                   	push   %ebp
+  801dd5:	89 e5                	mov    %esp,%ebp
+  801dd7:	56                   	push   %esi
+  801dd8:	53                   	push   %ebx
+  801dd9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ddc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ddf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801de2:	85 c0                	test   %eax,%eax
+  801de4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801de9:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801dec:	83 ec 08             	sub    $0x8,%esp
+  801def:	ff 75 14             	push   0x14(%ebp)
+  801df2:	50                   	push   %eax
+  801df3:	e8 77 f9 ff ff       	call   80176f <sys_ipc_recv_until>
+  801df8:	83 c4 10             	add    $0x10,%esp
+  801dfb:	85 c0                	test   %eax,%eax
+  801dfd:	78 61                	js     801e60 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801dff:	85 f6                	test   %esi,%esi
+  801e01:	74 1c                	je     801e1f <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801e03:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e05:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801e0a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e10:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e15:	76 5f                	jbe    801e76 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801e17:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801e1d:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801e1f:	85 db                	test   %ebx,%ebx
+  801e21:	74 1c                	je     801e3f <ipc_recv_until+0x6b>
+  801e23:	89 e0                	mov    %esp,%eax
+  801e25:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e2a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e30:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e35:	76 50                	jbe    801e87 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801e37:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801e3d:	89 03                	mov    %eax,(%ebx)
+  801e3f:	89 e0                	mov    %esp,%eax
+  801e41:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e46:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e4c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e51:	76 45                	jbe    801e98 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801e53:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801e59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e5c:	5b                   	pop    %ebx
+  801e5d:	5e                   	pop    %esi
+  801e5e:	5d                   	pop    %ebp
+  801e5f:	c3                   	ret
+		if (from_env_store)
+  801e60:	85 f6                	test   %esi,%esi
+  801e62:	74 06                	je     801e6a <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801e64:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801e6a:	85 db                	test   %ebx,%ebx
+  801e6c:	74 eb                	je     801e59 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801e6e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801e74:	eb e3                	jmp    801e59 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e76:	c1 e8 10             	shr    $0x10,%eax
+  801e79:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e7f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e85:	eb 90                	jmp    801e17 <ipc_recv_until+0x43>
+  801e87:	c1 e8 10             	shr    $0x10,%eax
+  801e8a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e90:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e96:	eb 9f                	jmp    801e37 <ipc_recv_until+0x63>
+  801e98:	c1 e8 10             	shr    $0x10,%eax
+  801e9b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ea1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ea7:	eb aa                	jmp    801e53 <ipc_recv_until+0x7f>
+
+00801ea9 <ipc_recv>:
+{
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801eaf:	6a 00                	push   $0x0
+  801eb1:	ff 75 10             	push   0x10(%ebp)
+  801eb4:	ff 75 0c             	push   0xc(%ebp)
+  801eb7:	ff 75 08             	push   0x8(%ebp)
+  801eba:	e8 15 ff ff ff       	call   801dd4 <ipc_recv_until>
+}
+  801ebf:	c9                   	leave
+  801ec0:	c3                   	ret
+
+00801ec1 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	57                   	push   %edi
+  801ec5:	56                   	push   %esi
+  801ec6:	53                   	push   %ebx
+  801ec7:	83 ec 0c             	sub    $0xc,%esp
+  801eca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ecd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ed0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801ed3:	85 db                	test   %ebx,%ebx
+  801ed5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801eda:	0f 44 d8             	cmove  %eax,%ebx
+  801edd:	eb 05                	jmp    801ee4 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801edf:	e8 34 f4 ff ff       	call   801318 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801ee4:	ff 75 14             	push   0x14(%ebp)
+  801ee7:	53                   	push   %ebx
+  801ee8:	56                   	push   %esi
+  801ee9:	57                   	push   %edi
+  801eea:	e8 cc f7 ff ff       	call   8016bb <sys_ipc_try_send>
+  801eef:	83 c4 10             	add    $0x10,%esp
+  801ef2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801ef5:	74 e8                	je     801edf <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	78 08                	js     801f03 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801efe:	5b                   	pop    %ebx
+  801eff:	5e                   	pop    %esi
+  801f00:	5f                   	pop    %edi
+  801f01:	5d                   	pop    %ebp
+  801f02:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801f03:	50                   	push   %eax
+  801f04:	68 f6 38 80 00       	push   $0x8038f6
+  801f09:	6a 4f                	push   $0x4f
+  801f0b:	68 09 39 80 00       	push   $0x803909
+  801f10:	e8 2e e8 ff ff       	call   800743 <_panic>
+
+00801f15 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801f20:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801f26:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801f2c:	8b 52 50             	mov    0x50(%edx),%edx
+  801f2f:	39 ca                	cmp    %ecx,%edx
+  801f31:	74 11                	je     801f44 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801f33:	83 c0 01             	add    $0x1,%eax
+  801f36:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801f3b:	75 e3                	jne    801f20 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f42:	eb 0e                	jmp    801f52 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801f44:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f4a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801f4f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801f52:	5d                   	pop    %ebp
+  801f53:	c3                   	ret
+
+00801f54 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5a:	05 00 00 00 30       	add    $0x30000000,%eax
+  801f5f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801f62:	5d                   	pop    %ebp
+  801f63:	c3                   	ret
+
+00801f64 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801f64:	55                   	push   %ebp
+  801f65:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801f6f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801f74:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801f79:	5d                   	pop    %ebp
+  801f7a:	c3                   	ret
+
+00801f7b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801f7e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801f83:	eb 02                	jmp    801f87 <fd_alloc+0xc>
+  801f85:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801f87:	89 c2                	mov    %eax,%edx
+  801f89:	c1 ea 16             	shr    $0x16,%edx
+  801f8c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f93:	f6 c2 01             	test   $0x1,%dl
+  801f96:	74 2b                	je     801fc3 <fd_alloc+0x48>
+  801f98:	89 c2                	mov    %eax,%edx
+  801f9a:	c1 ea 0c             	shr    $0xc,%edx
+  801f9d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801fa4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801faa:	f6 c1 01             	test   $0x1,%cl
+  801fad:	74 14                	je     801fc3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801faf:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801fb5:	75 ce                	jne    801f85 <fd_alloc+0xa>
+  801fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801fbc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801fc1:	eb 05                	jmp    801fc8 <fd_alloc+0x4d>
+			return 0;
+  801fc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fcb:	89 02                	mov    %eax,(%edx)
+}
+  801fcd:	89 c8                	mov    %ecx,%eax
+  801fcf:	5d                   	pop    %ebp
+  801fd0:	c3                   	ret
+
+00801fd1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801fd1:	55                   	push   %ebp
+  801fd2:	89 e5                	mov    %esp,%ebp
+  801fd4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801fd7:	83 f8 1f             	cmp    $0x1f,%eax
+  801fda:	77 30                	ja     80200c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801fdc:	c1 e0 0c             	shl    $0xc,%eax
+  801fdf:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801fe4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801fea:	f6 c2 01             	test   $0x1,%dl
+  801fed:	74 24                	je     802013 <fd_lookup+0x42>
+  801fef:	89 c2                	mov    %eax,%edx
+  801ff1:	c1 ea 0c             	shr    $0xc,%edx
+  801ff4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ffb:	f6 c2 01             	test   $0x1,%dl
+  801ffe:	74 1a                	je     80201a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802000:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802003:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802005:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80200a:	5d                   	pop    %ebp
+  80200b:	c3                   	ret
+		return -E_INVAL;
+  80200c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802011:	eb f7                	jmp    80200a <fd_lookup+0x39>
+		return -E_INVAL;
+  802013:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802018:	eb f0                	jmp    80200a <fd_lookup+0x39>
+  80201a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80201f:	eb e9                	jmp    80200a <fd_lookup+0x39>
+
+00802021 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	53                   	push   %ebx
+  802025:	83 ec 04             	sub    $0x4,%esp
+  802028:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80202b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802030:	eb 03                	jmp    802035 <dev_lookup+0x14>
+  802032:	83 c0 01             	add    $0x1,%eax
+  802035:	8b 1c 85 90 39 80 00 	mov    0x803990(,%eax,4),%ebx
+  80203c:	85 db                	test   %ebx,%ebx
+  80203e:	74 0b                	je     80204b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802040:	39 13                	cmp    %edx,(%ebx)
+  802042:	75 ee                	jne    802032 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802044:	b8 00 00 00 00       	mov    $0x0,%eax
+  802049:	eb 2e                	jmp    802079 <dev_lookup+0x58>
+  80204b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80204d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802052:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802058:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80205d:	76 24                	jbe    802083 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80205f:	8b 41 48             	mov    0x48(%ecx),%eax
+  802062:	83 ec 04             	sub    $0x4,%esp
+  802065:	52                   	push   %edx
+  802066:	50                   	push   %eax
+  802067:	68 14 39 80 00       	push   $0x803914
+  80206c:	e8 ad e7 ff ff       	call   80081e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802071:	83 c4 10             	add    $0x10,%esp
+  802074:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802079:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80207c:	89 1a                	mov    %ebx,(%edx)
+}
+  80207e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802081:	c9                   	leave
+  802082:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802083:	c1 e8 10             	shr    $0x10,%eax
+  802086:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80208c:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802092:	eb cb                	jmp    80205f <dev_lookup+0x3e>
+
+00802094 <fd_close>:
+{
+  802094:	55                   	push   %ebp
+  802095:	89 e5                	mov    %esp,%ebp
+  802097:	57                   	push   %edi
+  802098:	56                   	push   %esi
+  802099:	53                   	push   %ebx
+  80209a:	83 ec 24             	sub    $0x24,%esp
+  80209d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020a0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8020a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020a6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8020a7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8020ad:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8020b0:	50                   	push   %eax
+  8020b1:	e8 1b ff ff ff       	call   801fd1 <fd_lookup>
+  8020b6:	89 c3                	mov    %eax,%ebx
+  8020b8:	83 c4 10             	add    $0x10,%esp
+  8020bb:	85 c0                	test   %eax,%eax
+  8020bd:	78 05                	js     8020c4 <fd_close+0x30>
+	    || fd != fd2)
+  8020bf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8020c2:	74 16                	je     8020da <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8020c4:	89 f8                	mov    %edi,%eax
+  8020c6:	84 c0                	test   %al,%al
+  8020c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8020d0:	89 d8                	mov    %ebx,%eax
+  8020d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d5:	5b                   	pop    %ebx
+  8020d6:	5e                   	pop    %esi
+  8020d7:	5f                   	pop    %edi
+  8020d8:	5d                   	pop    %ebp
+  8020d9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8020da:	83 ec 08             	sub    $0x8,%esp
+  8020dd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8020e0:	50                   	push   %eax
+  8020e1:	ff 36                	push   (%esi)
+  8020e3:	e8 39 ff ff ff       	call   802021 <dev_lookup>
+  8020e8:	89 c3                	mov    %eax,%ebx
+  8020ea:	83 c4 10             	add    $0x10,%esp
+  8020ed:	85 c0                	test   %eax,%eax
+  8020ef:	78 1a                	js     80210b <fd_close+0x77>
+		if (dev->dev_close)
+  8020f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020f4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8020f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8020fc:	85 c0                	test   %eax,%eax
+  8020fe:	74 0b                	je     80210b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802100:	83 ec 0c             	sub    $0xc,%esp
+  802103:	56                   	push   %esi
+  802104:	ff d0                	call   *%eax
+  802106:	89 c3                	mov    %eax,%ebx
+  802108:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80210b:	83 ec 08             	sub    $0x8,%esp
+  80210e:	56                   	push   %esi
+  80210f:	6a 00                	push   $0x0
+  802111:	e8 23 f3 ff ff       	call   801439 <sys_page_unmap>
+	return r;
+  802116:	83 c4 10             	add    $0x10,%esp
+  802119:	eb b5                	jmp    8020d0 <fd_close+0x3c>
+
+0080211b <close>:
+
+int
+close(int fdnum)
+{
+  80211b:	55                   	push   %ebp
+  80211c:	89 e5                	mov    %esp,%ebp
+  80211e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802121:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802124:	50                   	push   %eax
+  802125:	ff 75 08             	push   0x8(%ebp)
+  802128:	e8 a4 fe ff ff       	call   801fd1 <fd_lookup>
+  80212d:	83 c4 10             	add    $0x10,%esp
+  802130:	85 c0                	test   %eax,%eax
+  802132:	79 02                	jns    802136 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802134:	c9                   	leave
+  802135:	c3                   	ret
+		return fd_close(fd, 1);
+  802136:	83 ec 08             	sub    $0x8,%esp
+  802139:	6a 01                	push   $0x1
+  80213b:	ff 75 f4             	push   -0xc(%ebp)
+  80213e:	e8 51 ff ff ff       	call   802094 <fd_close>
+  802143:	83 c4 10             	add    $0x10,%esp
+  802146:	eb ec                	jmp    802134 <close+0x19>
+
+00802148 <close_all>:
+
+void
+close_all(void)
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	53                   	push   %ebx
+  80214c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80214f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802154:	83 ec 0c             	sub    $0xc,%esp
+  802157:	53                   	push   %ebx
+  802158:	e8 be ff ff ff       	call   80211b <close>
+	for (i = 0; i < MAXFD; i++)
+  80215d:	83 c3 01             	add    $0x1,%ebx
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	83 fb 20             	cmp    $0x20,%ebx
+  802166:	75 ec                	jne    802154 <close_all+0xc>
+}
+  802168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80216b:	c9                   	leave
+  80216c:	c3                   	ret
+
+0080216d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80216d:	55                   	push   %ebp
+  80216e:	89 e5                	mov    %esp,%ebp
+  802170:	57                   	push   %edi
+  802171:	56                   	push   %esi
+  802172:	53                   	push   %ebx
+  802173:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802176:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802179:	50                   	push   %eax
+  80217a:	ff 75 08             	push   0x8(%ebp)
+  80217d:	e8 4f fe ff ff       	call   801fd1 <fd_lookup>
+  802182:	89 c3                	mov    %eax,%ebx
+  802184:	83 c4 10             	add    $0x10,%esp
+  802187:	85 c0                	test   %eax,%eax
+  802189:	78 7f                	js     80220a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80218b:	83 ec 0c             	sub    $0xc,%esp
+  80218e:	ff 75 0c             	push   0xc(%ebp)
+  802191:	e8 85 ff ff ff       	call   80211b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802196:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802199:	c1 e6 0c             	shl    $0xc,%esi
+  80219c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8021a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8021a5:	89 3c 24             	mov    %edi,(%esp)
+  8021a8:	e8 b7 fd ff ff       	call   801f64 <fd2data>
+  8021ad:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8021af:	89 34 24             	mov    %esi,(%esp)
+  8021b2:	e8 ad fd ff ff       	call   801f64 <fd2data>
+  8021b7:	83 c4 10             	add    $0x10,%esp
+  8021ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8021bd:	89 d8                	mov    %ebx,%eax
+  8021bf:	c1 e8 16             	shr    $0x16,%eax
+  8021c2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021c9:	a8 01                	test   $0x1,%al
+  8021cb:	74 11                	je     8021de <dup+0x71>
+  8021cd:	89 d8                	mov    %ebx,%eax
+  8021cf:	c1 e8 0c             	shr    $0xc,%eax
+  8021d2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8021d9:	f6 c2 01             	test   $0x1,%dl
+  8021dc:	75 36                	jne    802214 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8021de:	89 f8                	mov    %edi,%eax
+  8021e0:	c1 e8 0c             	shr    $0xc,%eax
+  8021e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8021ea:	83 ec 0c             	sub    $0xc,%esp
+  8021ed:	25 07 0e 00 00       	and    $0xe07,%eax
+  8021f2:	50                   	push   %eax
+  8021f3:	56                   	push   %esi
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	57                   	push   %edi
+  8021f7:	6a 00                	push   $0x0
+  8021f9:	e8 cd f1 ff ff       	call   8013cb <sys_page_map>
+  8021fe:	89 c3                	mov    %eax,%ebx
+  802200:	83 c4 20             	add    $0x20,%esp
+  802203:	85 c0                	test   %eax,%eax
+  802205:	78 33                	js     80223a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802207:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80220a:	89 d8                	mov    %ebx,%eax
+  80220c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220f:	5b                   	pop    %ebx
+  802210:	5e                   	pop    %esi
+  802211:	5f                   	pop    %edi
+  802212:	5d                   	pop    %ebp
+  802213:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802214:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80221b:	83 ec 0c             	sub    $0xc,%esp
+  80221e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802223:	50                   	push   %eax
+  802224:	ff 75 d4             	push   -0x2c(%ebp)
+  802227:	6a 00                	push   $0x0
+  802229:	53                   	push   %ebx
+  80222a:	6a 00                	push   $0x0
+  80222c:	e8 9a f1 ff ff       	call   8013cb <sys_page_map>
+  802231:	89 c3                	mov    %eax,%ebx
+  802233:	83 c4 20             	add    $0x20,%esp
+  802236:	85 c0                	test   %eax,%eax
+  802238:	79 a4                	jns    8021de <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80223a:	83 ec 08             	sub    $0x8,%esp
+  80223d:	56                   	push   %esi
+  80223e:	6a 00                	push   $0x0
+  802240:	e8 f4 f1 ff ff       	call   801439 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802245:	83 c4 08             	add    $0x8,%esp
+  802248:	ff 75 d4             	push   -0x2c(%ebp)
+  80224b:	6a 00                	push   $0x0
+  80224d:	e8 e7 f1 ff ff       	call   801439 <sys_page_unmap>
+	return r;
+  802252:	83 c4 10             	add    $0x10,%esp
+  802255:	eb b3                	jmp    80220a <dup+0x9d>
+
+00802257 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802257:	55                   	push   %ebp
+  802258:	89 e5                	mov    %esp,%ebp
+  80225a:	56                   	push   %esi
+  80225b:	53                   	push   %ebx
+  80225c:	83 ec 18             	sub    $0x18,%esp
+  80225f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802262:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802265:	50                   	push   %eax
+  802266:	53                   	push   %ebx
+  802267:	e8 65 fd ff ff       	call   801fd1 <fd_lookup>
+  80226c:	83 c4 10             	add    $0x10,%esp
+  80226f:	85 c0                	test   %eax,%eax
+  802271:	78 3c                	js     8022af <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802273:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802276:	83 ec 08             	sub    $0x8,%esp
+  802279:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80227c:	50                   	push   %eax
+  80227d:	ff 36                	push   (%esi)
+  80227f:	e8 9d fd ff ff       	call   802021 <dev_lookup>
+  802284:	83 c4 10             	add    $0x10,%esp
+  802287:	85 c0                	test   %eax,%eax
+  802289:	78 24                	js     8022af <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80228b:	8b 46 08             	mov    0x8(%esi),%eax
+  80228e:	83 e0 03             	and    $0x3,%eax
+  802291:	83 f8 01             	cmp    $0x1,%eax
+  802294:	74 20                	je     8022b6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802296:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802299:	8b 40 08             	mov    0x8(%eax),%eax
+  80229c:	85 c0                	test   %eax,%eax
+  80229e:	74 57                	je     8022f7 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8022a0:	83 ec 04             	sub    $0x4,%esp
+  8022a3:	ff 75 10             	push   0x10(%ebp)
+  8022a6:	ff 75 0c             	push   0xc(%ebp)
+  8022a9:	56                   	push   %esi
+  8022aa:	ff d0                	call   *%eax
+  8022ac:	83 c4 10             	add    $0x10,%esp
+}
+  8022af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022b2:	5b                   	pop    %ebx
+  8022b3:	5e                   	pop    %esi
+  8022b4:	5d                   	pop    %ebp
+  8022b5:	c3                   	ret
+  8022b6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022b8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022bd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022c3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8022c8:	76 1c                	jbe    8022e6 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022ca:	8b 42 48             	mov    0x48(%edx),%eax
+  8022cd:	83 ec 04             	sub    $0x4,%esp
+  8022d0:	53                   	push   %ebx
+  8022d1:	50                   	push   %eax
+  8022d2:	68 55 39 80 00       	push   $0x803955
+  8022d7:	e8 42 e5 ff ff       	call   80081e <cprintf>
+		return -E_INVAL;
+  8022dc:	83 c4 10             	add    $0x10,%esp
+  8022df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022e4:	eb c9                	jmp    8022af <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8022e6:	c1 e8 10             	shr    $0x10,%eax
+  8022e9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8022ef:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8022f5:	eb d3                	jmp    8022ca <read+0x73>
+		return -E_NOT_SUPP;
+  8022f7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022fc:	eb b1                	jmp    8022af <read+0x58>
+
+008022fe <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8022fe:	55                   	push   %ebp
+  8022ff:	89 e5                	mov    %esp,%ebp
+  802301:	57                   	push   %edi
+  802302:	56                   	push   %esi
+  802303:	53                   	push   %ebx
+  802304:	83 ec 0c             	sub    $0xc,%esp
+  802307:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80230a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80230d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802312:	eb 02                	jmp    802316 <readn+0x18>
+  802314:	01 c3                	add    %eax,%ebx
+  802316:	39 f3                	cmp    %esi,%ebx
+  802318:	73 21                	jae    80233b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80231a:	83 ec 04             	sub    $0x4,%esp
+  80231d:	89 f0                	mov    %esi,%eax
+  80231f:	29 d8                	sub    %ebx,%eax
+  802321:	50                   	push   %eax
+  802322:	89 d8                	mov    %ebx,%eax
+  802324:	03 45 0c             	add    0xc(%ebp),%eax
+  802327:	50                   	push   %eax
+  802328:	57                   	push   %edi
+  802329:	e8 29 ff ff ff       	call   802257 <read>
+		if (m < 0)
+  80232e:	83 c4 10             	add    $0x10,%esp
+  802331:	85 c0                	test   %eax,%eax
+  802333:	78 04                	js     802339 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802335:	75 dd                	jne    802314 <readn+0x16>
+  802337:	eb 02                	jmp    80233b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802339:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80233b:	89 d8                	mov    %ebx,%eax
+  80233d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802340:	5b                   	pop    %ebx
+  802341:	5e                   	pop    %esi
+  802342:	5f                   	pop    %edi
+  802343:	5d                   	pop    %ebp
+  802344:	c3                   	ret
+
+00802345 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802345:	55                   	push   %ebp
+  802346:	89 e5                	mov    %esp,%ebp
+  802348:	56                   	push   %esi
+  802349:	53                   	push   %ebx
+  80234a:	83 ec 18             	sub    $0x18,%esp
+  80234d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802350:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802353:	50                   	push   %eax
+  802354:	53                   	push   %ebx
+  802355:	e8 77 fc ff ff       	call   801fd1 <fd_lookup>
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	78 37                	js     802398 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802361:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802364:	83 ec 08             	sub    $0x8,%esp
+  802367:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80236a:	50                   	push   %eax
+  80236b:	ff 36                	push   (%esi)
+  80236d:	e8 af fc ff ff       	call   802021 <dev_lookup>
+  802372:	83 c4 10             	add    $0x10,%esp
+  802375:	85 c0                	test   %eax,%eax
+  802377:	78 1f                	js     802398 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802379:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80237d:	74 20                	je     80239f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80237f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802382:	8b 40 0c             	mov    0xc(%eax),%eax
+  802385:	85 c0                	test   %eax,%eax
+  802387:	74 57                	je     8023e0 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802389:	83 ec 04             	sub    $0x4,%esp
+  80238c:	ff 75 10             	push   0x10(%ebp)
+  80238f:	ff 75 0c             	push   0xc(%ebp)
+  802392:	56                   	push   %esi
+  802393:	ff d0                	call   *%eax
+  802395:	83 c4 10             	add    $0x10,%esp
+}
+  802398:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80239b:	5b                   	pop    %ebx
+  80239c:	5e                   	pop    %esi
+  80239d:	5d                   	pop    %ebp
+  80239e:	c3                   	ret
+  80239f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023a1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8023a6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023ac:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8023b1:	76 1c                	jbe    8023cf <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023b3:	8b 42 48             	mov    0x48(%edx),%eax
+  8023b6:	83 ec 04             	sub    $0x4,%esp
+  8023b9:	53                   	push   %ebx
+  8023ba:	50                   	push   %eax
+  8023bb:	68 71 39 80 00       	push   $0x803971
+  8023c0:	e8 59 e4 ff ff       	call   80081e <cprintf>
+		return -E_INVAL;
+  8023c5:	83 c4 10             	add    $0x10,%esp
+  8023c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023cd:	eb c9                	jmp    802398 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8023cf:	c1 e8 10             	shr    $0x10,%eax
+  8023d2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8023d8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8023de:	eb d3                	jmp    8023b3 <write+0x6e>
+		return -E_NOT_SUPP;
+  8023e0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023e5:	eb b1                	jmp    802398 <write+0x53>
+
+008023e7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023f0:	50                   	push   %eax
+  8023f1:	ff 75 08             	push   0x8(%ebp)
+  8023f4:	e8 d8 fb ff ff       	call   801fd1 <fd_lookup>
+  8023f9:	83 c4 10             	add    $0x10,%esp
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	78 0e                	js     80240e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802400:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802403:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802406:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802409:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80240e:	c9                   	leave
+  80240f:	c3                   	ret
+
+00802410 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802410:	55                   	push   %ebp
+  802411:	89 e5                	mov    %esp,%ebp
+  802413:	56                   	push   %esi
+  802414:	53                   	push   %ebx
+  802415:	83 ec 18             	sub    $0x18,%esp
+  802418:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80241b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80241e:	50                   	push   %eax
+  80241f:	53                   	push   %ebx
+  802420:	e8 ac fb ff ff       	call   801fd1 <fd_lookup>
+  802425:	83 c4 10             	add    $0x10,%esp
+  802428:	85 c0                	test   %eax,%eax
+  80242a:	78 34                	js     802460 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80242c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80242f:	83 ec 08             	sub    $0x8,%esp
+  802432:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802435:	50                   	push   %eax
+  802436:	ff 36                	push   (%esi)
+  802438:	e8 e4 fb ff ff       	call   802021 <dev_lookup>
+  80243d:	83 c4 10             	add    $0x10,%esp
+  802440:	85 c0                	test   %eax,%eax
+  802442:	78 1c                	js     802460 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802444:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802448:	74 1d                	je     802467 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80244a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80244d:	8b 40 18             	mov    0x18(%eax),%eax
+  802450:	85 c0                	test   %eax,%eax
+  802452:	74 54                	je     8024a8 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802454:	83 ec 08             	sub    $0x8,%esp
+  802457:	ff 75 0c             	push   0xc(%ebp)
+  80245a:	56                   	push   %esi
+  80245b:	ff d0                	call   *%eax
+  80245d:	83 c4 10             	add    $0x10,%esp
+}
+  802460:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802463:	5b                   	pop    %ebx
+  802464:	5e                   	pop    %esi
+  802465:	5d                   	pop    %ebp
+  802466:	c3                   	ret
+  802467:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802469:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80246e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802474:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802479:	76 1c                	jbe    802497 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  80247b:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80247e:	83 ec 04             	sub    $0x4,%esp
+  802481:	53                   	push   %ebx
+  802482:	50                   	push   %eax
+  802483:	68 34 39 80 00       	push   $0x803934
+  802488:	e8 91 e3 ff ff       	call   80081e <cprintf>
+		return -E_INVAL;
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802495:	eb c9                	jmp    802460 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802497:	c1 e8 10             	shr    $0x10,%eax
+  80249a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8024a0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8024a6:	eb d3                	jmp    80247b <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8024a8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024ad:	eb b1                	jmp    802460 <ftruncate+0x50>
+
+008024af <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8024af:	55                   	push   %ebp
+  8024b0:	89 e5                	mov    %esp,%ebp
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 18             	sub    $0x18,%esp
+  8024b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024ba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024bd:	50                   	push   %eax
+  8024be:	ff 75 08             	push   0x8(%ebp)
+  8024c1:	e8 0b fb ff ff       	call   801fd1 <fd_lookup>
+  8024c6:	83 c4 10             	add    $0x10,%esp
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	78 49                	js     802516 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024cd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024d0:	83 ec 08             	sub    $0x8,%esp
+  8024d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d6:	50                   	push   %eax
+  8024d7:	ff 36                	push   (%esi)
+  8024d9:	e8 43 fb ff ff       	call   802021 <dev_lookup>
+  8024de:	83 c4 10             	add    $0x10,%esp
+  8024e1:	85 c0                	test   %eax,%eax
+  8024e3:	78 31                	js     802516 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8024e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8024ec:	74 2f                	je     80251d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8024ee:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8024f1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8024f8:	00 00 00 
+	stat->st_isdir = 0;
+  8024fb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802502:	00 00 00 
+	stat->st_dev = dev;
+  802505:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80250b:	83 ec 08             	sub    $0x8,%esp
+  80250e:	53                   	push   %ebx
+  80250f:	56                   	push   %esi
+  802510:	ff 50 14             	call   *0x14(%eax)
+  802513:	83 c4 10             	add    $0x10,%esp
+}
+  802516:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802519:	5b                   	pop    %ebx
+  80251a:	5e                   	pop    %esi
+  80251b:	5d                   	pop    %ebp
+  80251c:	c3                   	ret
+		return -E_NOT_SUPP;
+  80251d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802522:	eb f2                	jmp    802516 <fstat+0x67>
+
+00802524 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802524:	55                   	push   %ebp
+  802525:	89 e5                	mov    %esp,%ebp
+  802527:	56                   	push   %esi
+  802528:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802529:	83 ec 08             	sub    $0x8,%esp
+  80252c:	6a 00                	push   $0x0
+  80252e:	ff 75 08             	push   0x8(%ebp)
+  802531:	e8 e4 01 00 00       	call   80271a <open>
+  802536:	89 c3                	mov    %eax,%ebx
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	78 1b                	js     80255a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80253f:	83 ec 08             	sub    $0x8,%esp
+  802542:	ff 75 0c             	push   0xc(%ebp)
+  802545:	50                   	push   %eax
+  802546:	e8 64 ff ff ff       	call   8024af <fstat>
+  80254b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80254d:	89 1c 24             	mov    %ebx,(%esp)
+  802550:	e8 c6 fb ff ff       	call   80211b <close>
+	return r;
+  802555:	83 c4 10             	add    $0x10,%esp
+  802558:	89 f3                	mov    %esi,%ebx
+}
+  80255a:	89 d8                	mov    %ebx,%eax
+  80255c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80255f:	5b                   	pop    %ebx
+  802560:	5e                   	pop    %esi
+  802561:	5d                   	pop    %ebp
+  802562:	c3                   	ret
+
+00802563 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802563:	55                   	push   %ebp
+  802564:	89 e5                	mov    %esp,%ebp
+  802566:	56                   	push   %esi
+  802567:	53                   	push   %ebx
+  802568:	89 c6                	mov    %eax,%esi
+  80256a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80256c:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  802573:	74 27                	je     80259c <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802575:	6a 07                	push   $0x7
+  802577:	68 00 60 80 00       	push   $0x806000
+  80257c:	56                   	push   %esi
+  80257d:	ff 35 00 50 80 00    	push   0x805000
+  802583:	e8 39 f9 ff ff       	call   801ec1 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802588:	83 c4 0c             	add    $0xc,%esp
+  80258b:	6a 00                	push   $0x0
+  80258d:	53                   	push   %ebx
+  80258e:	6a 00                	push   $0x0
+  802590:	e8 14 f9 ff ff       	call   801ea9 <ipc_recv>
+}
+  802595:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802598:	5b                   	pop    %ebx
+  802599:	5e                   	pop    %esi
+  80259a:	5d                   	pop    %ebp
+  80259b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80259c:	83 ec 0c             	sub    $0xc,%esp
+  80259f:	6a 01                	push   $0x1
+  8025a1:	e8 6f f9 ff ff       	call   801f15 <ipc_find_env>
+  8025a6:	a3 00 50 80 00       	mov    %eax,0x805000
+  8025ab:	83 c4 10             	add    $0x10,%esp
+  8025ae:	eb c5                	jmp    802575 <fsipc+0x12>
+
+008025b0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8025b0:	55                   	push   %ebp
+  8025b1:	89 e5                	mov    %esp,%ebp
+  8025b3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8025b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025bc:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8025c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025c4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8025c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ce:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025d3:	e8 8b ff ff ff       	call   802563 <fsipc>
+}
+  8025d8:	c9                   	leave
+  8025d9:	c3                   	ret
+
+008025da <devfile_flush>:
+{
+  8025da:	55                   	push   %ebp
+  8025db:	89 e5                	mov    %esp,%ebp
+  8025dd:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8025e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025e3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025e6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8025eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025f5:	e8 69 ff ff ff       	call   802563 <fsipc>
+}
+  8025fa:	c9                   	leave
+  8025fb:	c3                   	ret
+
+008025fc <devfile_stat>:
+{
+  8025fc:	55                   	push   %ebp
+  8025fd:	89 e5                	mov    %esp,%ebp
+  8025ff:	53                   	push   %ebx
+  802600:	83 ec 04             	sub    $0x4,%esp
+  802603:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802606:	8b 45 08             	mov    0x8(%ebp),%eax
+  802609:	8b 40 0c             	mov    0xc(%eax),%eax
+  80260c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802611:	ba 00 00 00 00       	mov    $0x0,%edx
+  802616:	b8 05 00 00 00       	mov    $0x5,%eax
+  80261b:	e8 43 ff ff ff       	call   802563 <fsipc>
+  802620:	85 c0                	test   %eax,%eax
+  802622:	78 2c                	js     802650 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802624:	83 ec 08             	sub    $0x8,%esp
+  802627:	68 00 60 80 00       	push   $0x806000
+  80262c:	53                   	push   %ebx
+  80262d:	e8 34 e8 ff ff       	call   800e66 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802632:	a1 80 60 80 00       	mov    0x806080,%eax
+  802637:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80263d:	a1 84 60 80 00       	mov    0x806084,%eax
+  802642:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802648:	83 c4 10             	add    $0x10,%esp
+  80264b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802650:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802653:	c9                   	leave
+  802654:	c3                   	ret
+
+00802655 <devfile_write>:
+{
+  802655:	55                   	push   %ebp
+  802656:	89 e5                	mov    %esp,%ebp
+  802658:	83 ec 0c             	sub    $0xc,%esp
+  80265b:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80265e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802661:	8b 52 0c             	mov    0xc(%edx),%edx
+  802664:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  80266a:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80266f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802674:	39 d0                	cmp    %edx,%eax
+  802676:	0f 47 c2             	cmova  %edx,%eax
+  802679:	50                   	push   %eax
+  80267a:	ff 75 0c             	push   0xc(%ebp)
+  80267d:	68 08 60 80 00       	push   $0x806008
+  802682:	e8 65 e9 ff ff       	call   800fec <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802687:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802691:	e8 cd fe ff ff       	call   802563 <fsipc>
+}
+  802696:	c9                   	leave
+  802697:	c3                   	ret
+
+00802698 <devfile_read>:
+{
+  802698:	55                   	push   %ebp
+  802699:	89 e5                	mov    %esp,%ebp
+  80269b:	56                   	push   %esi
+  80269c:	53                   	push   %ebx
+  80269d:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8026a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026a6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8026ab:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8026b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8026bb:	e8 a3 fe ff ff       	call   802563 <fsipc>
+  8026c0:	89 c3                	mov    %eax,%ebx
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	78 1f                	js     8026e5 <devfile_read+0x4d>
+	assert(r <= n);
+  8026c6:	39 c6                	cmp    %eax,%esi
+  8026c8:	72 24                	jb     8026ee <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8026ca:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8026cf:	7f 33                	jg     802704 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8026d1:	83 ec 04             	sub    $0x4,%esp
+  8026d4:	50                   	push   %eax
+  8026d5:	68 00 60 80 00       	push   $0x806000
+  8026da:	ff 75 0c             	push   0xc(%ebp)
+  8026dd:	e8 0a e9 ff ff       	call   800fec <memmove>
+	return r;
+  8026e2:	83 c4 10             	add    $0x10,%esp
+}
+  8026e5:	89 d8                	mov    %ebx,%eax
+  8026e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ea:	5b                   	pop    %ebx
+  8026eb:	5e                   	pop    %esi
+  8026ec:	5d                   	pop    %ebp
+  8026ed:	c3                   	ret
+	assert(r <= n);
+  8026ee:	68 a4 39 80 00       	push   $0x8039a4
+  8026f3:	68 ab 39 80 00       	push   $0x8039ab
+  8026f8:	6a 76                	push   $0x76
+  8026fa:	68 c0 39 80 00       	push   $0x8039c0
+  8026ff:	e8 3f e0 ff ff       	call   800743 <_panic>
+	assert(r <= PGSIZE);
+  802704:	68 cb 39 80 00       	push   $0x8039cb
+  802709:	68 ab 39 80 00       	push   $0x8039ab
+  80270e:	6a 77                	push   $0x77
+  802710:	68 c0 39 80 00       	push   $0x8039c0
+  802715:	e8 29 e0 ff ff       	call   800743 <_panic>
+
+0080271a <open>:
+{
+  80271a:	55                   	push   %ebp
+  80271b:	89 e5                	mov    %esp,%ebp
+  80271d:	56                   	push   %esi
+  80271e:	53                   	push   %ebx
+  80271f:	83 ec 1c             	sub    $0x1c,%esp
+  802722:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802725:	56                   	push   %esi
+  802726:	e8 00 e7 ff ff       	call   800e2b <strlen>
+  80272b:	83 c4 10             	add    $0x10,%esp
+  80272e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802733:	7f 6c                	jg     8027a1 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802735:	83 ec 0c             	sub    $0xc,%esp
+  802738:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80273b:	50                   	push   %eax
+  80273c:	e8 3a f8 ff ff       	call   801f7b <fd_alloc>
+  802741:	89 c3                	mov    %eax,%ebx
+  802743:	83 c4 10             	add    $0x10,%esp
+  802746:	85 c0                	test   %eax,%eax
+  802748:	78 3c                	js     802786 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80274a:	83 ec 08             	sub    $0x8,%esp
+  80274d:	56                   	push   %esi
+  80274e:	68 00 60 80 00       	push   $0x806000
+  802753:	e8 0e e7 ff ff       	call   800e66 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802758:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80275b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802760:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802763:	b8 01 00 00 00       	mov    $0x1,%eax
+  802768:	e8 f6 fd ff ff       	call   802563 <fsipc>
+  80276d:	89 c3                	mov    %eax,%ebx
+  80276f:	83 c4 10             	add    $0x10,%esp
+  802772:	85 c0                	test   %eax,%eax
+  802774:	78 19                	js     80278f <open+0x75>
+	return fd2num(fd);
+  802776:	83 ec 0c             	sub    $0xc,%esp
+  802779:	ff 75 f4             	push   -0xc(%ebp)
+  80277c:	e8 d3 f7 ff ff       	call   801f54 <fd2num>
+  802781:	89 c3                	mov    %eax,%ebx
+  802783:	83 c4 10             	add    $0x10,%esp
+}
+  802786:	89 d8                	mov    %ebx,%eax
+  802788:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80278b:	5b                   	pop    %ebx
+  80278c:	5e                   	pop    %esi
+  80278d:	5d                   	pop    %ebp
+  80278e:	c3                   	ret
+		fd_close(fd, 0);
+  80278f:	83 ec 08             	sub    $0x8,%esp
+  802792:	6a 00                	push   $0x0
+  802794:	ff 75 f4             	push   -0xc(%ebp)
+  802797:	e8 f8 f8 ff ff       	call   802094 <fd_close>
+		return r;
+  80279c:	83 c4 10             	add    $0x10,%esp
+  80279f:	eb e5                	jmp    802786 <open+0x6c>
+		return -E_BAD_PATH;
+  8027a1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8027a6:	eb de                	jmp    802786 <open+0x6c>
+
+008027a8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8027a8:	55                   	push   %ebp
+  8027a9:	89 e5                	mov    %esp,%ebp
+  8027ab:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8027ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027b8:	e8 a6 fd ff ff       	call   802563 <fsipc>
+}
+  8027bd:	c9                   	leave
+  8027be:	c3                   	ret
+
+008027bf <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8027bf:	55                   	push   %ebp
+  8027c0:	89 e5                	mov    %esp,%ebp
+  8027c2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8027c5:	68 d7 39 80 00       	push   $0x8039d7
+  8027ca:	ff 75 0c             	push   0xc(%ebp)
+  8027cd:	e8 94 e6 ff ff       	call   800e66 <strcpy>
+	return 0;
+}
+  8027d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d7:	c9                   	leave
+  8027d8:	c3                   	ret
+
+008027d9 <devsock_close>:
+{
+  8027d9:	55                   	push   %ebp
+  8027da:	89 e5                	mov    %esp,%ebp
+  8027dc:	53                   	push   %ebx
+  8027dd:	83 ec 10             	sub    $0x10,%esp
+  8027e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027e3:	53                   	push   %ebx
+  8027e4:	e8 64 09 00 00       	call   80314d <pageref>
+  8027e9:	89 c2                	mov    %eax,%edx
+  8027eb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027ee:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027f3:	83 fa 01             	cmp    $0x1,%edx
+  8027f6:	74 05                	je     8027fd <devsock_close+0x24>
+}
+  8027f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027fb:	c9                   	leave
+  8027fc:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027fd:	83 ec 0c             	sub    $0xc,%esp
+  802800:	ff 73 0c             	push   0xc(%ebx)
+  802803:	e8 b7 02 00 00       	call   802abf <nsipc_close>
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	eb eb                	jmp    8027f8 <devsock_close+0x1f>
+
+0080280d <devsock_write>:
+{
+  80280d:	55                   	push   %ebp
+  80280e:	89 e5                	mov    %esp,%ebp
+  802810:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802813:	6a 00                	push   $0x0
+  802815:	ff 75 10             	push   0x10(%ebp)
+  802818:	ff 75 0c             	push   0xc(%ebp)
+  80281b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281e:	ff 70 0c             	push   0xc(%eax)
+  802821:	e8 79 03 00 00       	call   802b9f <nsipc_send>
+}
+  802826:	c9                   	leave
+  802827:	c3                   	ret
+
+00802828 <devsock_read>:
+{
+  802828:	55                   	push   %ebp
+  802829:	89 e5                	mov    %esp,%ebp
+  80282b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80282e:	6a 00                	push   $0x0
+  802830:	ff 75 10             	push   0x10(%ebp)
+  802833:	ff 75 0c             	push   0xc(%ebp)
+  802836:	8b 45 08             	mov    0x8(%ebp),%eax
+  802839:	ff 70 0c             	push   0xc(%eax)
+  80283c:	e8 ef 02 00 00       	call   802b30 <nsipc_recv>
+}
+  802841:	c9                   	leave
+  802842:	c3                   	ret
+
+00802843 <fd2sockid>:
+{
+  802843:	55                   	push   %ebp
+  802844:	89 e5                	mov    %esp,%ebp
+  802846:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802849:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80284c:	52                   	push   %edx
+  80284d:	50                   	push   %eax
+  80284e:	e8 7e f7 ff ff       	call   801fd1 <fd_lookup>
+  802853:	83 c4 10             	add    $0x10,%esp
+  802856:	85 c0                	test   %eax,%eax
+  802858:	78 10                	js     80286a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80285a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80285d:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  802863:	39 08                	cmp    %ecx,(%eax)
+  802865:	75 05                	jne    80286c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802867:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80286a:	c9                   	leave
+  80286b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80286c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802871:	eb f7                	jmp    80286a <fd2sockid+0x27>
+
+00802873 <alloc_sockfd>:
+{
+  802873:	55                   	push   %ebp
+  802874:	89 e5                	mov    %esp,%ebp
+  802876:	56                   	push   %esi
+  802877:	53                   	push   %ebx
+  802878:	83 ec 1c             	sub    $0x1c,%esp
+  80287b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80287d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802880:	50                   	push   %eax
+  802881:	e8 f5 f6 ff ff       	call   801f7b <fd_alloc>
+  802886:	89 c3                	mov    %eax,%ebx
+  802888:	83 c4 10             	add    $0x10,%esp
+  80288b:	85 c0                	test   %eax,%eax
+  80288d:	78 43                	js     8028d2 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80288f:	83 ec 04             	sub    $0x4,%esp
+  802892:	68 07 04 00 00       	push   $0x407
+  802897:	ff 75 f4             	push   -0xc(%ebp)
+  80289a:	6a 00                	push   $0x0
+  80289c:	e8 bd ea ff ff       	call   80135e <sys_page_alloc>
+  8028a1:	89 c3                	mov    %eax,%ebx
+  8028a3:	83 c4 10             	add    $0x10,%esp
+  8028a6:	85 c0                	test   %eax,%eax
+  8028a8:	78 28                	js     8028d2 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8028aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028ad:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  8028b3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8028b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028b8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8028bf:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8028c2:	83 ec 0c             	sub    $0xc,%esp
+  8028c5:	50                   	push   %eax
+  8028c6:	e8 89 f6 ff ff       	call   801f54 <fd2num>
+  8028cb:	89 c3                	mov    %eax,%ebx
+  8028cd:	83 c4 10             	add    $0x10,%esp
+  8028d0:	eb 0c                	jmp    8028de <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8028d2:	83 ec 0c             	sub    $0xc,%esp
+  8028d5:	56                   	push   %esi
+  8028d6:	e8 e4 01 00 00       	call   802abf <nsipc_close>
+		return r;
+  8028db:	83 c4 10             	add    $0x10,%esp
+}
+  8028de:	89 d8                	mov    %ebx,%eax
+  8028e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028e3:	5b                   	pop    %ebx
+  8028e4:	5e                   	pop    %esi
+  8028e5:	5d                   	pop    %ebp
+  8028e6:	c3                   	ret
+
+008028e7 <accept>:
+{
+  8028e7:	55                   	push   %ebp
+  8028e8:	89 e5                	mov    %esp,%ebp
+  8028ea:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f0:	e8 4e ff ff ff       	call   802843 <fd2sockid>
+  8028f5:	85 c0                	test   %eax,%eax
+  8028f7:	78 1b                	js     802914 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8028f9:	83 ec 04             	sub    $0x4,%esp
+  8028fc:	ff 75 10             	push   0x10(%ebp)
+  8028ff:	ff 75 0c             	push   0xc(%ebp)
+  802902:	50                   	push   %eax
+  802903:	e8 0e 01 00 00       	call   802a16 <nsipc_accept>
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	78 05                	js     802914 <accept+0x2d>
+	return alloc_sockfd(r);
+  80290f:	e8 5f ff ff ff       	call   802873 <alloc_sockfd>
+}
+  802914:	c9                   	leave
+  802915:	c3                   	ret
+
+00802916 <bind>:
+{
+  802916:	55                   	push   %ebp
+  802917:	89 e5                	mov    %esp,%ebp
+  802919:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80291c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80291f:	e8 1f ff ff ff       	call   802843 <fd2sockid>
+  802924:	85 c0                	test   %eax,%eax
+  802926:	78 12                	js     80293a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802928:	83 ec 04             	sub    $0x4,%esp
+  80292b:	ff 75 10             	push   0x10(%ebp)
+  80292e:	ff 75 0c             	push   0xc(%ebp)
+  802931:	50                   	push   %eax
+  802932:	e8 31 01 00 00       	call   802a68 <nsipc_bind>
+  802937:	83 c4 10             	add    $0x10,%esp
+}
+  80293a:	c9                   	leave
+  80293b:	c3                   	ret
+
+0080293c <shutdown>:
+{
+  80293c:	55                   	push   %ebp
+  80293d:	89 e5                	mov    %esp,%ebp
+  80293f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802942:	8b 45 08             	mov    0x8(%ebp),%eax
+  802945:	e8 f9 fe ff ff       	call   802843 <fd2sockid>
+  80294a:	85 c0                	test   %eax,%eax
+  80294c:	78 0f                	js     80295d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80294e:	83 ec 08             	sub    $0x8,%esp
+  802951:	ff 75 0c             	push   0xc(%ebp)
+  802954:	50                   	push   %eax
+  802955:	e8 43 01 00 00       	call   802a9d <nsipc_shutdown>
+  80295a:	83 c4 10             	add    $0x10,%esp
+}
+  80295d:	c9                   	leave
+  80295e:	c3                   	ret
+
+0080295f <connect>:
+{
+  80295f:	55                   	push   %ebp
+  802960:	89 e5                	mov    %esp,%ebp
+  802962:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802965:	8b 45 08             	mov    0x8(%ebp),%eax
+  802968:	e8 d6 fe ff ff       	call   802843 <fd2sockid>
+  80296d:	85 c0                	test   %eax,%eax
+  80296f:	78 12                	js     802983 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802971:	83 ec 04             	sub    $0x4,%esp
+  802974:	ff 75 10             	push   0x10(%ebp)
+  802977:	ff 75 0c             	push   0xc(%ebp)
+  80297a:	50                   	push   %eax
+  80297b:	e8 59 01 00 00       	call   802ad9 <nsipc_connect>
+  802980:	83 c4 10             	add    $0x10,%esp
+}
+  802983:	c9                   	leave
+  802984:	c3                   	ret
+
+00802985 <listen>:
+{
+  802985:	55                   	push   %ebp
+  802986:	89 e5                	mov    %esp,%ebp
+  802988:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80298b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298e:	e8 b0 fe ff ff       	call   802843 <fd2sockid>
+  802993:	85 c0                	test   %eax,%eax
+  802995:	78 0f                	js     8029a6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802997:	83 ec 08             	sub    $0x8,%esp
+  80299a:	ff 75 0c             	push   0xc(%ebp)
+  80299d:	50                   	push   %eax
+  80299e:	e8 6b 01 00 00       	call   802b0e <nsipc_listen>
+  8029a3:	83 c4 10             	add    $0x10,%esp
+}
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+
+008029a8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8029a8:	55                   	push   %ebp
+  8029a9:	89 e5                	mov    %esp,%ebp
+  8029ab:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8029ae:	ff 75 10             	push   0x10(%ebp)
+  8029b1:	ff 75 0c             	push   0xc(%ebp)
+  8029b4:	ff 75 08             	push   0x8(%ebp)
+  8029b7:	e8 41 02 00 00       	call   802bfd <nsipc_socket>
+  8029bc:	83 c4 10             	add    $0x10,%esp
+  8029bf:	85 c0                	test   %eax,%eax
+  8029c1:	78 05                	js     8029c8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8029c3:	e8 ab fe ff ff       	call   802873 <alloc_sockfd>
+}
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+008029ca <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8029ca:	55                   	push   %ebp
+  8029cb:	89 e5                	mov    %esp,%ebp
+  8029cd:	53                   	push   %ebx
+  8029ce:	83 ec 04             	sub    $0x4,%esp
+  8029d1:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8029d3:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8029da:	74 26                	je     802a02 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8029dc:	6a 07                	push   $0x7
+  8029de:	68 00 70 80 00       	push   $0x807000
+  8029e3:	53                   	push   %ebx
+  8029e4:	ff 35 04 50 80 00    	push   0x805004
+  8029ea:	e8 d2 f4 ff ff       	call   801ec1 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8029ef:	83 c4 0c             	add    $0xc,%esp
+  8029f2:	6a 00                	push   $0x0
+  8029f4:	6a 00                	push   $0x0
+  8029f6:	6a 00                	push   $0x0
+  8029f8:	e8 ac f4 ff ff       	call   801ea9 <ipc_recv>
+}
+  8029fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a02:	83 ec 0c             	sub    $0xc,%esp
+  802a05:	6a 02                	push   $0x2
+  802a07:	e8 09 f5 ff ff       	call   801f15 <ipc_find_env>
+  802a0c:	a3 04 50 80 00       	mov    %eax,0x805004
+  802a11:	83 c4 10             	add    $0x10,%esp
+  802a14:	eb c6                	jmp    8029dc <nsipc+0x12>
+
+00802a16 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802a16:	55                   	push   %ebp
+  802a17:	89 e5                	mov    %esp,%ebp
+  802a19:	56                   	push   %esi
+  802a1a:	53                   	push   %ebx
+  802a1b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a21:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802a26:	8b 06                	mov    (%esi),%eax
+  802a28:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a2d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a32:	e8 93 ff ff ff       	call   8029ca <nsipc>
+  802a37:	89 c3                	mov    %eax,%ebx
+  802a39:	85 c0                	test   %eax,%eax
+  802a3b:	79 09                	jns    802a46 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a3d:	89 d8                	mov    %ebx,%eax
+  802a3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a42:	5b                   	pop    %ebx
+  802a43:	5e                   	pop    %esi
+  802a44:	5d                   	pop    %ebp
+  802a45:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a46:	83 ec 04             	sub    $0x4,%esp
+  802a49:	ff 35 10 70 80 00    	push   0x807010
+  802a4f:	68 00 70 80 00       	push   $0x807000
+  802a54:	ff 75 0c             	push   0xc(%ebp)
+  802a57:	e8 90 e5 ff ff       	call   800fec <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a5c:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a61:	89 06                	mov    %eax,(%esi)
+  802a63:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802a66:	eb d5                	jmp    802a3d <nsipc_accept+0x27>
+
+00802a68 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802a68:	55                   	push   %ebp
+  802a69:	89 e5                	mov    %esp,%ebp
+  802a6b:	53                   	push   %ebx
+  802a6c:	83 ec 08             	sub    $0x8,%esp
+  802a6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802a72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a75:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802a7a:	53                   	push   %ebx
+  802a7b:	ff 75 0c             	push   0xc(%ebp)
+  802a7e:	68 04 70 80 00       	push   $0x807004
+  802a83:	e8 64 e5 ff ff       	call   800fec <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802a88:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802a8e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a93:	e8 32 ff ff ff       	call   8029ca <nsipc>
+}
+  802a98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a9b:	c9                   	leave
+  802a9c:	c3                   	ret
+
+00802a9d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a9d:	55                   	push   %ebp
+  802a9e:	89 e5                	mov    %esp,%ebp
+  802aa0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802aab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802aae:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802ab3:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ab8:	e8 0d ff ff ff       	call   8029ca <nsipc>
+}
+  802abd:	c9                   	leave
+  802abe:	c3                   	ret
+
+00802abf <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802abf:	55                   	push   %ebp
+  802ac0:	89 e5                	mov    %esp,%ebp
+  802ac2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac8:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802acd:	b8 04 00 00 00       	mov    $0x4,%eax
+  802ad2:	e8 f3 fe ff ff       	call   8029ca <nsipc>
+}
+  802ad7:	c9                   	leave
+  802ad8:	c3                   	ret
+
+00802ad9 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ad9:	55                   	push   %ebp
+  802ada:	89 e5                	mov    %esp,%ebp
+  802adc:	53                   	push   %ebx
+  802add:	83 ec 08             	sub    $0x8,%esp
+  802ae0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae6:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802aeb:	53                   	push   %ebx
+  802aec:	ff 75 0c             	push   0xc(%ebp)
+  802aef:	68 04 70 80 00       	push   $0x807004
+  802af4:	e8 f3 e4 ff ff       	call   800fec <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802af9:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802aff:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b04:	e8 c1 fe ff ff       	call   8029ca <nsipc>
+}
+  802b09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b0c:	c9                   	leave
+  802b0d:	c3                   	ret
+
+00802b0e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b0e:	55                   	push   %ebp
+  802b0f:	89 e5                	mov    %esp,%ebp
+  802b11:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b17:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b1f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802b24:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b29:	e8 9c fe ff ff       	call   8029ca <nsipc>
+}
+  802b2e:	c9                   	leave
+  802b2f:	c3                   	ret
+
+00802b30 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b30:	55                   	push   %ebp
+  802b31:	89 e5                	mov    %esp,%ebp
+  802b33:	56                   	push   %esi
+  802b34:	53                   	push   %ebx
+  802b35:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b3b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802b40:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802b46:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b49:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b4e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b53:	e8 72 fe ff ff       	call   8029ca <nsipc>
+  802b58:	89 c3                	mov    %eax,%ebx
+  802b5a:	85 c0                	test   %eax,%eax
+  802b5c:	78 22                	js     802b80 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802b5e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802b63:	39 c6                	cmp    %eax,%esi
+  802b65:	0f 4e c6             	cmovle %esi,%eax
+  802b68:	39 c3                	cmp    %eax,%ebx
+  802b6a:	7f 1d                	jg     802b89 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802b6c:	83 ec 04             	sub    $0x4,%esp
+  802b6f:	53                   	push   %ebx
+  802b70:	68 00 70 80 00       	push   $0x807000
+  802b75:	ff 75 0c             	push   0xc(%ebp)
+  802b78:	e8 6f e4 ff ff       	call   800fec <memmove>
+  802b7d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802b80:	89 d8                	mov    %ebx,%eax
+  802b82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b85:	5b                   	pop    %ebx
+  802b86:	5e                   	pop    %esi
+  802b87:	5d                   	pop    %ebp
+  802b88:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802b89:	68 e3 39 80 00       	push   $0x8039e3
+  802b8e:	68 ab 39 80 00       	push   $0x8039ab
+  802b93:	6a 62                	push   $0x62
+  802b95:	68 f8 39 80 00       	push   $0x8039f8
+  802b9a:	e8 a4 db ff ff       	call   800743 <_panic>
+
+00802b9f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b9f:	55                   	push   %ebp
+  802ba0:	89 e5                	mov    %esp,%ebp
+  802ba2:	53                   	push   %ebx
+  802ba3:	83 ec 04             	sub    $0x4,%esp
+  802ba6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bac:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802bb1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bb7:	7f 2e                	jg     802be7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802bb9:	83 ec 04             	sub    $0x4,%esp
+  802bbc:	53                   	push   %ebx
+  802bbd:	ff 75 0c             	push   0xc(%ebp)
+  802bc0:	68 0c 70 80 00       	push   $0x80700c
+  802bc5:	e8 22 e4 ff ff       	call   800fec <memmove>
+	nsipcbuf.send.req_size = size;
+  802bca:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802bd0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bd3:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802bd8:	b8 08 00 00 00       	mov    $0x8,%eax
+  802bdd:	e8 e8 fd ff ff       	call   8029ca <nsipc>
+}
+  802be2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802be5:	c9                   	leave
+  802be6:	c3                   	ret
+	assert(size < 1600);
+  802be7:	68 04 3a 80 00       	push   $0x803a04
+  802bec:	68 ab 39 80 00       	push   $0x8039ab
+  802bf1:	6a 6d                	push   $0x6d
+  802bf3:	68 f8 39 80 00       	push   $0x8039f8
+  802bf8:	e8 46 db ff ff       	call   800743 <_panic>
+
+00802bfd <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802bfd:	55                   	push   %ebp
+  802bfe:	89 e5                	mov    %esp,%ebp
+  802c00:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c03:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c06:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802c0b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c0e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c13:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c16:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802c1b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c20:	e8 a5 fd ff ff       	call   8029ca <nsipc>
+}
+  802c25:	c9                   	leave
+  802c26:	c3                   	ret
+
+00802c27 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c27:	55                   	push   %ebp
+  802c28:	89 e5                	mov    %esp,%ebp
+  802c2a:	56                   	push   %esi
+  802c2b:	53                   	push   %ebx
+  802c2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802c2f:	83 ec 0c             	sub    $0xc,%esp
+  802c32:	ff 75 08             	push   0x8(%ebp)
+  802c35:	e8 2a f3 ff ff       	call   801f64 <fd2data>
+  802c3a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802c3c:	83 c4 08             	add    $0x8,%esp
+  802c3f:	68 10 3a 80 00       	push   $0x803a10
+  802c44:	53                   	push   %ebx
+  802c45:	e8 1c e2 ff ff       	call   800e66 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802c4a:	8b 46 04             	mov    0x4(%esi),%eax
+  802c4d:	2b 06                	sub    (%esi),%eax
+  802c4f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802c55:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c5c:	00 00 00 
+	stat->st_dev = &devpipe;
+  802c5f:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  802c66:	40 80 00 
+	return 0;
+}
+  802c69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c71:	5b                   	pop    %ebx
+  802c72:	5e                   	pop    %esi
+  802c73:	5d                   	pop    %ebp
+  802c74:	c3                   	ret
+
+00802c75 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c75:	55                   	push   %ebp
+  802c76:	89 e5                	mov    %esp,%ebp
+  802c78:	53                   	push   %ebx
+  802c79:	83 ec 0c             	sub    $0xc,%esp
+  802c7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802c7f:	53                   	push   %ebx
+  802c80:	6a 00                	push   $0x0
+  802c82:	e8 b2 e7 ff ff       	call   801439 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802c87:	89 1c 24             	mov    %ebx,(%esp)
+  802c8a:	e8 d5 f2 ff ff       	call   801f64 <fd2data>
+  802c8f:	83 c4 08             	add    $0x8,%esp
+  802c92:	50                   	push   %eax
+  802c93:	6a 00                	push   $0x0
+  802c95:	e8 9f e7 ff ff       	call   801439 <sys_page_unmap>
+}
+  802c9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c9d:	c9                   	leave
+  802c9e:	c3                   	ret
+
+00802c9f <_pipeisclosed>:
+{
+  802c9f:	55                   	push   %ebp
+  802ca0:	89 e5                	mov    %esp,%ebp
+  802ca2:	57                   	push   %edi
+  802ca3:	56                   	push   %esi
+  802ca4:	53                   	push   %ebx
+  802ca5:	83 ec 1c             	sub    $0x1c,%esp
+  802ca8:	89 c7                	mov    %eax,%edi
+  802caa:	89 d6                	mov    %edx,%esi
+  802cac:	eb 3c                	jmp    802cea <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802cae:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802cb1:	83 ec 0c             	sub    $0xc,%esp
+  802cb4:	57                   	push   %edi
+  802cb5:	e8 93 04 00 00       	call   80314d <pageref>
+  802cba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802cbd:	89 34 24             	mov    %esi,(%esp)
+  802cc0:	e8 88 04 00 00       	call   80314d <pageref>
+  802cc5:	89 c2                	mov    %eax,%edx
+  802cc7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cc9:	05 00 00 00 20       	add    $0x20000000,%eax
+  802cce:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802cd1:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cd7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cdc:	76 31                	jbe    802d0f <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802cde:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802ce1:	39 c3                	cmp    %eax,%ebx
+  802ce3:	74 76                	je     802d5b <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802ce5:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802ce8:	74 36                	je     802d20 <_pipeisclosed+0x81>
+  802cea:	89 e0                	mov    %esp,%eax
+  802cec:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802cf1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cf7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cfc:	77 b0                	ja     802cae <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802cfe:	c1 e8 10             	shr    $0x10,%eax
+  802d01:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d07:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d0d:	eb 9f                	jmp    802cae <_pipeisclosed+0xf>
+  802d0f:	c1 e8 10             	shr    $0x10,%eax
+  802d12:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d18:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802d1e:	eb be                	jmp    802cde <_pipeisclosed+0x3f>
+  802d20:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d22:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d27:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d2d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d32:	76 16                	jbe    802d4a <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d34:	8b 42 58             	mov    0x58(%edx),%eax
+  802d37:	6a 01                	push   $0x1
+  802d39:	50                   	push   %eax
+  802d3a:	53                   	push   %ebx
+  802d3b:	68 17 3a 80 00       	push   $0x803a17
+  802d40:	e8 d9 da ff ff       	call   80081e <cprintf>
+  802d45:	83 c4 10             	add    $0x10,%esp
+  802d48:	eb a0                	jmp    802cea <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d4a:	c1 e8 10             	shr    $0x10,%eax
+  802d4d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d53:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d59:	eb d9                	jmp    802d34 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802d5b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802d5e:	0f 94 c0             	sete   %al
+  802d61:	0f b6 c0             	movzbl %al,%eax
+}
+  802d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d67:	5b                   	pop    %ebx
+  802d68:	5e                   	pop    %esi
+  802d69:	5f                   	pop    %edi
+  802d6a:	5d                   	pop    %ebp
+  802d6b:	c3                   	ret
+
+00802d6c <devpipe_write>:
+{
+  802d6c:	55                   	push   %ebp
+  802d6d:	89 e5                	mov    %esp,%ebp
+  802d6f:	57                   	push   %edi
+  802d70:	56                   	push   %esi
+  802d71:	53                   	push   %ebx
+  802d72:	83 ec 28             	sub    $0x28,%esp
+  802d75:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802d78:	56                   	push   %esi
+  802d79:	e8 e6 f1 ff ff       	call   801f64 <fd2data>
+  802d7e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802d80:	83 c4 10             	add    $0x10,%esp
+  802d83:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d88:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d8b:	75 09                	jne    802d96 <devpipe_write+0x2a>
+	return i;
+  802d8d:	89 f8                	mov    %edi,%eax
+  802d8f:	eb 23                	jmp    802db4 <devpipe_write+0x48>
+			sys_yield();
+  802d91:	e8 82 e5 ff ff       	call   801318 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d96:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d99:	8b 0b                	mov    (%ebx),%ecx
+  802d9b:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d9e:	39 d0                	cmp    %edx,%eax
+  802da0:	72 1a                	jb     802dbc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802da2:	89 da                	mov    %ebx,%edx
+  802da4:	89 f0                	mov    %esi,%eax
+  802da6:	e8 f4 fe ff ff       	call   802c9f <_pipeisclosed>
+  802dab:	85 c0                	test   %eax,%eax
+  802dad:	74 e2                	je     802d91 <devpipe_write+0x25>
+				return 0;
+  802daf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802db4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db7:	5b                   	pop    %ebx
+  802db8:	5e                   	pop    %esi
+  802db9:	5f                   	pop    %edi
+  802dba:	5d                   	pop    %ebp
+  802dbb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dbf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802dc3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802dc6:	89 c2                	mov    %eax,%edx
+  802dc8:	c1 fa 1f             	sar    $0x1f,%edx
+  802dcb:	89 d1                	mov    %edx,%ecx
+  802dcd:	c1 e9 1b             	shr    $0x1b,%ecx
+  802dd0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802dd3:	83 e2 1f             	and    $0x1f,%edx
+  802dd6:	29 ca                	sub    %ecx,%edx
+  802dd8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ddc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802de0:	83 c0 01             	add    $0x1,%eax
+  802de3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802de6:	83 c7 01             	add    $0x1,%edi
+  802de9:	eb 9d                	jmp    802d88 <devpipe_write+0x1c>
+
+00802deb <devpipe_read>:
+{
+  802deb:	55                   	push   %ebp
+  802dec:	89 e5                	mov    %esp,%ebp
+  802dee:	57                   	push   %edi
+  802def:	56                   	push   %esi
+  802df0:	53                   	push   %ebx
+  802df1:	83 ec 18             	sub    $0x18,%esp
+  802df4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802df7:	57                   	push   %edi
+  802df8:	e8 67 f1 ff ff       	call   801f64 <fd2data>
+  802dfd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802dff:	83 c4 10             	add    $0x10,%esp
+  802e02:	be 00 00 00 00       	mov    $0x0,%esi
+  802e07:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e0a:	75 13                	jne    802e1f <devpipe_read+0x34>
+	return i;
+  802e0c:	89 f0                	mov    %esi,%eax
+  802e0e:	eb 02                	jmp    802e12 <devpipe_read+0x27>
+				return i;
+  802e10:	89 f0                	mov    %esi,%eax
+}
+  802e12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e15:	5b                   	pop    %ebx
+  802e16:	5e                   	pop    %esi
+  802e17:	5f                   	pop    %edi
+  802e18:	5d                   	pop    %ebp
+  802e19:	c3                   	ret
+			sys_yield();
+  802e1a:	e8 f9 e4 ff ff       	call   801318 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802e1f:	8b 03                	mov    (%ebx),%eax
+  802e21:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e24:	75 18                	jne    802e3e <devpipe_read+0x53>
+			if (i > 0)
+  802e26:	85 f6                	test   %esi,%esi
+  802e28:	75 e6                	jne    802e10 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802e2a:	89 da                	mov    %ebx,%edx
+  802e2c:	89 f8                	mov    %edi,%eax
+  802e2e:	e8 6c fe ff ff       	call   802c9f <_pipeisclosed>
+  802e33:	85 c0                	test   %eax,%eax
+  802e35:	74 e3                	je     802e1a <devpipe_read+0x2f>
+				return 0;
+  802e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3c:	eb d4                	jmp    802e12 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e3e:	99                   	cltd
+  802e3f:	c1 ea 1b             	shr    $0x1b,%edx
+  802e42:	01 d0                	add    %edx,%eax
+  802e44:	83 e0 1f             	and    $0x1f,%eax
+  802e47:	29 d0                	sub    %edx,%eax
+  802e49:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e51:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802e54:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802e57:	83 c6 01             	add    $0x1,%esi
+  802e5a:	eb ab                	jmp    802e07 <devpipe_read+0x1c>
+
+00802e5c <pipe>:
+{
+  802e5c:	55                   	push   %ebp
+  802e5d:	89 e5                	mov    %esp,%ebp
+  802e5f:	56                   	push   %esi
+  802e60:	53                   	push   %ebx
+  802e61:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802e64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e67:	50                   	push   %eax
+  802e68:	e8 0e f1 ff ff       	call   801f7b <fd_alloc>
+  802e6d:	89 c3                	mov    %eax,%ebx
+  802e6f:	83 c4 10             	add    $0x10,%esp
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	0f 88 23 01 00 00    	js     802f9d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e7a:	83 ec 04             	sub    $0x4,%esp
+  802e7d:	68 07 04 00 00       	push   $0x407
+  802e82:	ff 75 f4             	push   -0xc(%ebp)
+  802e85:	6a 00                	push   $0x0
+  802e87:	e8 d2 e4 ff ff       	call   80135e <sys_page_alloc>
+  802e8c:	89 c3                	mov    %eax,%ebx
+  802e8e:	83 c4 10             	add    $0x10,%esp
+  802e91:	85 c0                	test   %eax,%eax
+  802e93:	0f 88 04 01 00 00    	js     802f9d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802e99:	83 ec 0c             	sub    $0xc,%esp
+  802e9c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802e9f:	50                   	push   %eax
+  802ea0:	e8 d6 f0 ff ff       	call   801f7b <fd_alloc>
+  802ea5:	89 c3                	mov    %eax,%ebx
+  802ea7:	83 c4 10             	add    $0x10,%esp
+  802eaa:	85 c0                	test   %eax,%eax
+  802eac:	0f 88 db 00 00 00    	js     802f8d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802eb2:	83 ec 04             	sub    $0x4,%esp
+  802eb5:	68 07 04 00 00       	push   $0x407
+  802eba:	ff 75 f0             	push   -0x10(%ebp)
+  802ebd:	6a 00                	push   $0x0
+  802ebf:	e8 9a e4 ff ff       	call   80135e <sys_page_alloc>
+  802ec4:	89 c3                	mov    %eax,%ebx
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	85 c0                	test   %eax,%eax
+  802ecb:	0f 88 bc 00 00 00    	js     802f8d <pipe+0x131>
+	va = fd2data(fd0);
+  802ed1:	83 ec 0c             	sub    $0xc,%esp
+  802ed4:	ff 75 f4             	push   -0xc(%ebp)
+  802ed7:	e8 88 f0 ff ff       	call   801f64 <fd2data>
+  802edc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ede:	83 c4 0c             	add    $0xc,%esp
+  802ee1:	68 07 04 00 00       	push   $0x407
+  802ee6:	50                   	push   %eax
+  802ee7:	6a 00                	push   $0x0
+  802ee9:	e8 70 e4 ff ff       	call   80135e <sys_page_alloc>
+  802eee:	89 c3                	mov    %eax,%ebx
+  802ef0:	83 c4 10             	add    $0x10,%esp
+  802ef3:	85 c0                	test   %eax,%eax
+  802ef5:	0f 88 82 00 00 00    	js     802f7d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802efb:	83 ec 0c             	sub    $0xc,%esp
+  802efe:	ff 75 f0             	push   -0x10(%ebp)
+  802f01:	e8 5e f0 ff ff       	call   801f64 <fd2data>
+  802f06:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802f0d:	50                   	push   %eax
+  802f0e:	6a 00                	push   $0x0
+  802f10:	56                   	push   %esi
+  802f11:	6a 00                	push   $0x0
+  802f13:	e8 b3 e4 ff ff       	call   8013cb <sys_page_map>
+  802f18:	89 c3                	mov    %eax,%ebx
+  802f1a:	83 c4 20             	add    $0x20,%esp
+  802f1d:	85 c0                	test   %eax,%eax
+  802f1f:	78 4e                	js     802f6f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802f21:	a1 40 40 80 00       	mov    0x804040,%eax
+  802f26:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f29:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802f2b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802f2e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802f35:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802f38:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802f3a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f3d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802f44:	83 ec 0c             	sub    $0xc,%esp
+  802f47:	ff 75 f4             	push   -0xc(%ebp)
+  802f4a:	e8 05 f0 ff ff       	call   801f54 <fd2num>
+  802f4f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f52:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802f54:	83 c4 04             	add    $0x4,%esp
+  802f57:	ff 75 f0             	push   -0x10(%ebp)
+  802f5a:	e8 f5 ef ff ff       	call   801f54 <fd2num>
+  802f5f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f62:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802f65:	83 c4 10             	add    $0x10,%esp
+  802f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f6d:	eb 2e                	jmp    802f9d <pipe+0x141>
+	sys_page_unmap(0, va);
+  802f6f:	83 ec 08             	sub    $0x8,%esp
+  802f72:	56                   	push   %esi
+  802f73:	6a 00                	push   $0x0
+  802f75:	e8 bf e4 ff ff       	call   801439 <sys_page_unmap>
+  802f7a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802f7d:	83 ec 08             	sub    $0x8,%esp
+  802f80:	ff 75 f0             	push   -0x10(%ebp)
+  802f83:	6a 00                	push   $0x0
+  802f85:	e8 af e4 ff ff       	call   801439 <sys_page_unmap>
+  802f8a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802f8d:	83 ec 08             	sub    $0x8,%esp
+  802f90:	ff 75 f4             	push   -0xc(%ebp)
+  802f93:	6a 00                	push   $0x0
+  802f95:	e8 9f e4 ff ff       	call   801439 <sys_page_unmap>
+  802f9a:	83 c4 10             	add    $0x10,%esp
+}
+  802f9d:	89 d8                	mov    %ebx,%eax
+  802f9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fa2:	5b                   	pop    %ebx
+  802fa3:	5e                   	pop    %esi
+  802fa4:	5d                   	pop    %ebp
+  802fa5:	c3                   	ret
+
+00802fa6 <pipeisclosed>:
+{
+  802fa6:	55                   	push   %ebp
+  802fa7:	89 e5                	mov    %esp,%ebp
+  802fa9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802faf:	50                   	push   %eax
+  802fb0:	ff 75 08             	push   0x8(%ebp)
+  802fb3:	e8 19 f0 ff ff       	call   801fd1 <fd_lookup>
+  802fb8:	83 c4 10             	add    $0x10,%esp
+  802fbb:	85 c0                	test   %eax,%eax
+  802fbd:	78 18                	js     802fd7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802fbf:	83 ec 0c             	sub    $0xc,%esp
+  802fc2:	ff 75 f4             	push   -0xc(%ebp)
+  802fc5:	e8 9a ef ff ff       	call   801f64 <fd2data>
+  802fca:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802fcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fcf:	e8 cb fc ff ff       	call   802c9f <_pipeisclosed>
+  802fd4:	83 c4 10             	add    $0x10,%esp
+}
+  802fd7:	c9                   	leave
+  802fd8:	c3                   	ret
+
+00802fd9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fde:	c3                   	ret
+
+00802fdf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fdf:	55                   	push   %ebp
+  802fe0:	89 e5                	mov    %esp,%ebp
+  802fe2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802fe5:	68 2f 3a 80 00       	push   $0x803a2f
+  802fea:	ff 75 0c             	push   0xc(%ebp)
+  802fed:	e8 74 de ff ff       	call   800e66 <strcpy>
+	return 0;
+}
+  802ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff7:	c9                   	leave
+  802ff8:	c3                   	ret
+
+00802ff9 <devcons_write>:
+{
+  802ff9:	55                   	push   %ebp
+  802ffa:	89 e5                	mov    %esp,%ebp
+  802ffc:	57                   	push   %edi
+  802ffd:	56                   	push   %esi
+  802ffe:	53                   	push   %ebx
+  802fff:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803005:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80300a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803010:	eb 2e                	jmp    803040 <devcons_write+0x47>
+		m = n - tot;
+  803012:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803015:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803017:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80301c:	39 c3                	cmp    %eax,%ebx
+  80301e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803021:	83 ec 04             	sub    $0x4,%esp
+  803024:	53                   	push   %ebx
+  803025:	89 f0                	mov    %esi,%eax
+  803027:	03 45 0c             	add    0xc(%ebp),%eax
+  80302a:	50                   	push   %eax
+  80302b:	57                   	push   %edi
+  80302c:	e8 bb df ff ff       	call   800fec <memmove>
+		sys_cputs(buf, m);
+  803031:	83 c4 08             	add    $0x8,%esp
+  803034:	53                   	push   %ebx
+  803035:	57                   	push   %edi
+  803036:	e8 a4 e1 ff ff       	call   8011df <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80303b:	01 de                	add    %ebx,%esi
+  80303d:	83 c4 10             	add    $0x10,%esp
+  803040:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803043:	72 cd                	jb     803012 <devcons_write+0x19>
+}
+  803045:	89 f0                	mov    %esi,%eax
+  803047:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80304a:	5b                   	pop    %ebx
+  80304b:	5e                   	pop    %esi
+  80304c:	5f                   	pop    %edi
+  80304d:	5d                   	pop    %ebp
+  80304e:	c3                   	ret
+
+0080304f <devcons_read>:
+{
+  80304f:	55                   	push   %ebp
+  803050:	89 e5                	mov    %esp,%ebp
+  803052:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80305e:	75 07                	jne    803067 <devcons_read+0x18>
+  803060:	eb 1f                	jmp    803081 <devcons_read+0x32>
+		sys_yield();
+  803062:	e8 b1 e2 ff ff       	call   801318 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803067:	e8 b7 e1 ff ff       	call   801223 <sys_cgetc>
+  80306c:	85 c0                	test   %eax,%eax
+  80306e:	74 f2                	je     803062 <devcons_read+0x13>
+	if (c < 0)
+  803070:	78 0f                	js     803081 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803072:	83 f8 04             	cmp    $0x4,%eax
+  803075:	74 0c                	je     803083 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803077:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80307a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80307c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803081:	c9                   	leave
+  803082:	c3                   	ret
+		return 0;
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+  803088:	eb f7                	jmp    803081 <devcons_read+0x32>
+
+0080308a <cputchar>:
+{
+  80308a:	55                   	push   %ebp
+  80308b:	89 e5                	mov    %esp,%ebp
+  80308d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803090:	8b 45 08             	mov    0x8(%ebp),%eax
+  803093:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803096:	6a 01                	push   $0x1
+  803098:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80309b:	50                   	push   %eax
+  80309c:	e8 3e e1 ff ff       	call   8011df <sys_cputs>
+}
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	c9                   	leave
+  8030a5:	c3                   	ret
+
+008030a6 <getchar>:
+{
+  8030a6:	55                   	push   %ebp
+  8030a7:	89 e5                	mov    %esp,%ebp
+  8030a9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8030ac:	6a 01                	push   $0x1
+  8030ae:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8030b1:	50                   	push   %eax
+  8030b2:	6a 00                	push   $0x0
+  8030b4:	e8 9e f1 ff ff       	call   802257 <read>
+	if (r < 0)
+  8030b9:	83 c4 10             	add    $0x10,%esp
+  8030bc:	85 c0                	test   %eax,%eax
+  8030be:	78 06                	js     8030c6 <getchar+0x20>
+	if (r < 1)
+  8030c0:	74 06                	je     8030c8 <getchar+0x22>
+	return c;
+  8030c2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8030c6:	c9                   	leave
+  8030c7:	c3                   	ret
+		return -E_EOF;
+  8030c8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8030cd:	eb f7                	jmp    8030c6 <getchar+0x20>
+
+008030cf <iscons>:
+{
+  8030cf:	55                   	push   %ebp
+  8030d0:	89 e5                	mov    %esp,%ebp
+  8030d2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030d8:	50                   	push   %eax
+  8030d9:	ff 75 08             	push   0x8(%ebp)
+  8030dc:	e8 f0 ee ff ff       	call   801fd1 <fd_lookup>
+  8030e1:	83 c4 10             	add    $0x10,%esp
+  8030e4:	85 c0                	test   %eax,%eax
+  8030e6:	78 11                	js     8030f9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8030e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030eb:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  8030f1:	39 10                	cmp    %edx,(%eax)
+  8030f3:	0f 94 c0             	sete   %al
+  8030f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8030f9:	c9                   	leave
+  8030fa:	c3                   	ret
+
+008030fb <opencons>:
+{
+  8030fb:	55                   	push   %ebp
+  8030fc:	89 e5                	mov    %esp,%ebp
+  8030fe:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803101:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803104:	50                   	push   %eax
+  803105:	e8 71 ee ff ff       	call   801f7b <fd_alloc>
+  80310a:	83 c4 10             	add    $0x10,%esp
+  80310d:	85 c0                	test   %eax,%eax
+  80310f:	78 3a                	js     80314b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803111:	83 ec 04             	sub    $0x4,%esp
+  803114:	68 07 04 00 00       	push   $0x407
+  803119:	ff 75 f4             	push   -0xc(%ebp)
+  80311c:	6a 00                	push   $0x0
+  80311e:	e8 3b e2 ff ff       	call   80135e <sys_page_alloc>
+  803123:	83 c4 10             	add    $0x10,%esp
+  803126:	85 c0                	test   %eax,%eax
+  803128:	78 21                	js     80314b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80312a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80312d:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  803133:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803135:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803138:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80313f:	83 ec 0c             	sub    $0xc,%esp
+  803142:	50                   	push   %eax
+  803143:	e8 0c ee ff ff       	call   801f54 <fd2num>
+  803148:	83 c4 10             	add    $0x10,%esp
+}
+  80314b:	c9                   	leave
+  80314c:	c3                   	ret
+
+0080314d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80314d:	55                   	push   %ebp
+  80314e:	89 e5                	mov    %esp,%ebp
+  803150:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803153:	89 c2                	mov    %eax,%edx
+  803155:	c1 ea 16             	shr    $0x16,%edx
+  803158:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80315f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803164:	f6 c1 01             	test   $0x1,%cl
+  803167:	74 1a                	je     803183 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803169:	c1 e8 0c             	shr    $0xc,%eax
+  80316c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803173:	a8 01                	test   $0x1,%al
+  803175:	74 0c                	je     803183 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803177:	c1 e8 0c             	shr    $0xc,%eax
+  80317a:	c1 e0 04             	shl    $0x4,%eax
+  80317d:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803183:	89 d0                	mov    %edx,%eax
+  803185:	5d                   	pop    %ebp
+  803186:	c3                   	ret
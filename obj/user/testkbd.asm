@@ -0,0 +1,6540 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2a 02 00 00       	call   80025b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	int i, r;
+
+	// Spin for a bit to let the console quiet
+	for (i = 0; i < 10; ++i)
+  80003a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80003f:	eb 05                	jmp    800046 <umain+0x13>
+		sys_yield();
+  800041:	e8 9e 0f 00 00       	call   800fe4 <sys_yield>
+	for (i = 0; i < 10; ++i)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xe>
+
+	close(0);
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	e8 12 1c 00 00       	call   801c67 <close>
+	if ((r = opencons()) < 0)
+  800055:	e8 af 01 00 00       	call   800209 <opencons>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 14                	js     800075 <umain+0x42>
+		panic("opencons: %e", r);
+	if (r != 0)
+  800061:	74 24                	je     800087 <umain+0x54>
+		panic("first opencons used fd %d", r);
+  800063:	50                   	push   %eax
+  800064:	68 1c 2e 80 00       	push   $0x802e1c
+  800069:	6a 11                	push   $0x11
+  80006b:	68 0d 2e 80 00       	push   $0x802e0d
+  800070:	e8 aa 02 00 00       	call   80031f <_panic>
+		panic("opencons: %e", r);
+  800075:	50                   	push   %eax
+  800076:	68 00 2e 80 00       	push   $0x802e00
+  80007b:	6a 0f                	push   $0xf
+  80007d:	68 0d 2e 80 00       	push   $0x802e0d
+  800082:	e8 98 02 00 00       	call   80031f <_panic>
+	if ((r = dup(0, 1)) < 0)
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	6a 01                	push   $0x1
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 26 1c 00 00       	call   801cb9 <dup>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	79 25                	jns    8000bf <umain+0x8c>
+		panic("dup: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 36 2e 80 00       	push   $0x802e36
+  8000a0:	6a 13                	push   $0x13
+  8000a2:	68 0d 2e 80 00       	push   $0x802e0d
+  8000a7:	e8 73 02 00 00       	call   80031f <_panic>
+	for(;;){
+		char *buf;
+
+		buf = readline("Type a line: ");
+		if (buf != NULL)
+			fprintf(1, "%s\n", buf);
+  8000ac:	83 ec 04             	sub    $0x4,%esp
+  8000af:	50                   	push   %eax
+  8000b0:	68 4c 2e 80 00       	push   $0x802e4c
+  8000b5:	6a 01                	push   $0x1
+  8000b7:	e8 36 23 00 00       	call   8023f2 <fprintf>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+		buf = readline("Type a line: ");
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	68 3e 2e 80 00       	push   $0x802e3e
+  8000c7:	e8 3b 09 00 00       	call   800a07 <readline>
+		if (buf != NULL)
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	75 d9                	jne    8000ac <umain+0x79>
+		else
+			fprintf(1, "(end of file received)\n");
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	68 50 2e 80 00       	push   $0x802e50
+  8000db:	6a 01                	push   $0x1
+  8000dd:	e8 10 23 00 00       	call   8023f2 <fprintf>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	eb d8                	jmp    8000bf <umain+0x8c>
+
+008000e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	c3                   	ret
+
+008000ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8000f3:	68 68 2e 80 00       	push   $0x802e68
+  8000f8:	ff 75 0c             	push   0xc(%ebp)
+  8000fb:	e8 32 0a 00 00       	call   800b32 <strcpy>
+	return 0;
+}
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	c9                   	leave
+  800106:	c3                   	ret
+
+00800107 <devcons_write>:
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800113:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800118:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80011e:	eb 2e                	jmp    80014e <devcons_write+0x47>
+		m = n - tot;
+  800120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800123:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  800125:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80012a:	39 c3                	cmp    %eax,%ebx
+  80012c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	53                   	push   %ebx
+  800133:	89 f0                	mov    %esi,%eax
+  800135:	03 45 0c             	add    0xc(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	57                   	push   %edi
+  80013a:	e8 79 0b 00 00       	call   800cb8 <memmove>
+		sys_cputs(buf, m);
+  80013f:	83 c4 08             	add    $0x8,%esp
+  800142:	53                   	push   %ebx
+  800143:	57                   	push   %edi
+  800144:	e8 62 0d 00 00       	call   800eab <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800149:	01 de                	add    %ebx,%esi
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800151:	72 cd                	jb     800120 <devcons_write+0x19>
+}
+  800153:	89 f0                	mov    %esi,%eax
+  800155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <devcons_read>:
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80016c:	75 07                	jne    800175 <devcons_read+0x18>
+  80016e:	eb 1f                	jmp    80018f <devcons_read+0x32>
+		sys_yield();
+  800170:	e8 6f 0e 00 00       	call   800fe4 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  800175:	e8 75 0d 00 00       	call   800eef <sys_cgetc>
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	74 f2                	je     800170 <devcons_read+0x13>
+	if (c < 0)
+  80017e:	78 0f                	js     80018f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800180:	83 f8 04             	cmp    $0x4,%eax
+  800183:	74 0c                	je     800191 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  800185:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800188:	88 02                	mov    %al,(%edx)
+	return 1;
+  80018a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+		return 0;
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	eb f7                	jmp    80018f <devcons_read+0x32>
+
+00800198 <cputchar>:
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80019e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001a1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8001a4:	6a 01                	push   $0x1
+  8001a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 fc 0c 00 00       	call   800eab <sys_cputs>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+008001b4 <getchar>:
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8001ba:	6a 01                	push   $0x1
+  8001bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 00                	push   $0x0
+  8001c2:	e8 dc 1b 00 00       	call   801da3 <read>
+	if (r < 0)
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 06                	js     8001d4 <getchar+0x20>
+	if (r < 1)
+  8001ce:	74 06                	je     8001d6 <getchar+0x22>
+	return c;
+  8001d0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+		return -E_EOF;
+  8001d6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8001db:	eb f7                	jmp    8001d4 <getchar+0x20>
+
+008001dd <iscons>:
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8001e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	ff 75 08             	push   0x8(%ebp)
+  8001ea:	e8 2e 19 00 00       	call   801b1d <fd_lookup>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	78 11                	js     800207 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8001f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001f9:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  8001ff:	39 10                	cmp    %edx,(%eax)
+  800201:	0f 94 c0             	sete   %al
+  800204:	0f b6 c0             	movzbl %al,%eax
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <opencons>:
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80020f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 af 18 00 00       	call   801ac7 <fd_alloc>
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	85 c0                	test   %eax,%eax
+  80021d:	78 3a                	js     800259 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80021f:	83 ec 04             	sub    $0x4,%esp
+  800222:	68 07 04 00 00       	push   $0x407
+  800227:	ff 75 f4             	push   -0xc(%ebp)
+  80022a:	6a 00                	push   $0x0
+  80022c:	e8 f9 0d 00 00       	call   80102a <sys_page_alloc>
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	85 c0                	test   %eax,%eax
+  800236:	78 21                	js     800259 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80023b:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  800241:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800246:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	e8 4a 18 00 00       	call   801aa0 <fd2num>
+  800256:	83 c4 10             	add    $0x10,%esp
+}
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	57                   	push   %edi
+  80025f:	56                   	push   %esi
+  800260:	53                   	push   %ebx
+  800261:	83 ec 0c             	sub    $0xc,%esp
+  800264:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800267:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80026a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80026f:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800271:	c1 ea 0b             	shr    $0xb,%edx
+  800274:	83 f2 01             	xor    $0x1,%edx
+  800277:	83 e2 01             	and    $0x1,%edx
+  80027a:	88 15 0c 54 80 00    	mov    %dl,0x80540c
+
+	mainenv = NULL;
+  800280:	c7 05 08 54 80 00 00 	movl   $0x0,0x805408
+  800287:	00 00 00 
+	envid = sys_getenvid();
+  80028a:	e8 0f 0d 00 00       	call   800f9e <sys_getenvid>
+  80028f:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800296:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80029c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8002a2:	8b 52 48             	mov    0x48(%edx),%edx
+  8002a5:	39 ca                	cmp    %ecx,%edx
+  8002a7:	74 27                	je     8002d0 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8002a9:	83 c0 01             	add    $0x1,%eax
+  8002ac:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8002b1:	75 e3                	jne    800296 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8002b3:	83 3d 08 54 80 00 00 	cmpl   $0x0,0x805408
+  8002ba:	75 24                	jne    8002e0 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8002bc:	83 ec 04             	sub    $0x4,%esp
+  8002bf:	68 74 2e 80 00       	push   $0x802e74
+  8002c4:	6a 23                	push   $0x23
+  8002c6:	68 97 2e 80 00       	push   $0x802e97
+  8002cb:	e8 4f 00 00 00       	call   80031f <_panic>
+			mainenv = &envs[i];
+  8002d0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8002d6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002db:	a3 08 54 80 00       	mov    %eax,0x805408
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002e0:	85 ff                	test   %edi,%edi
+  8002e2:	7e 07                	jle    8002eb <libmain+0x90>
+		binaryname = argv[0];
+  8002e4:	8b 06                	mov    (%esi),%eax
+  8002e6:	a3 1c 40 80 00       	mov    %eax,0x80401c
+
+	// call user main routine
+	umain(argc, argv);
+  8002eb:	83 ec 08             	sub    $0x8,%esp
+  8002ee:	56                   	push   %esi
+  8002ef:	57                   	push   %edi
+  8002f0:	e8 3e fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8002f5:	e8 0b 00 00 00       	call   800305 <exit>
+}
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800300:	5b                   	pop    %ebx
+  800301:	5e                   	pop    %esi
+  800302:	5f                   	pop    %edi
+  800303:	5d                   	pop    %ebp
+  800304:	c3                   	ret
+
+00800305 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80030b:	e8 84 19 00 00       	call   801c94 <close_all>
+	sys_env_destroy(0);
+  800310:	83 ec 0c             	sub    $0xc,%esp
+  800313:	6a 00                	push   $0x0
+  800315:	e8 1b 0c 00 00       	call   800f35 <sys_env_destroy>
+}
+  80031a:	83 c4 10             	add    $0x10,%esp
+  80031d:	c9                   	leave
+  80031e:	c3                   	ret
+
+0080031f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80031f:	55                   	push   %ebp
+  800320:	89 e5                	mov    %esp,%ebp
+  800322:	56                   	push   %esi
+  800323:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800324:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800327:	8b 35 1c 40 80 00    	mov    0x80401c,%esi
+  80032d:	e8 6c 0c 00 00       	call   800f9e <sys_getenvid>
+  800332:	83 ec 0c             	sub    $0xc,%esp
+  800335:	ff 75 0c             	push   0xc(%ebp)
+  800338:	ff 75 08             	push   0x8(%ebp)
+  80033b:	56                   	push   %esi
+  80033c:	50                   	push   %eax
+  80033d:	68 b0 2e 80 00       	push   $0x802eb0
+  800342:	e8 b3 00 00 00       	call   8003fa <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800347:	83 c4 18             	add    $0x18,%esp
+  80034a:	53                   	push   %ebx
+  80034b:	ff 75 10             	push   0x10(%ebp)
+  80034e:	e8 56 00 00 00       	call   8003a9 <vcprintf>
+	cprintf("\n");
+  800353:	c7 04 24 66 2e 80 00 	movl   $0x802e66,(%esp)
+  80035a:	e8 9b 00 00 00       	call   8003fa <cprintf>
+  80035f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800362:	cc                   	int3
+	while (1)
+  800363:	eb fd                	jmp    800362 <_panic+0x43>
+
+00800365 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800365:	55                   	push   %ebp
+  800366:	89 e5                	mov    %esp,%ebp
+  800368:	53                   	push   %ebx
+  800369:	83 ec 04             	sub    $0x4,%esp
+  80036c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80036f:	8b 13                	mov    (%ebx),%edx
+  800371:	8d 42 01             	lea    0x1(%edx),%eax
+  800374:	89 03                	mov    %eax,(%ebx)
+  800376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800379:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80037d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800382:	74 09                	je     80038d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800384:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80038b:	c9                   	leave
+  80038c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80038d:	83 ec 08             	sub    $0x8,%esp
+  800390:	68 ff 00 00 00       	push   $0xff
+  800395:	8d 43 08             	lea    0x8(%ebx),%eax
+  800398:	50                   	push   %eax
+  800399:	e8 0d 0b 00 00       	call   800eab <sys_cputs>
+		b->idx = 0;
+  80039e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003a4:	83 c4 10             	add    $0x10,%esp
+  8003a7:	eb db                	jmp    800384 <putch+0x1f>
+
+008003a9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003a9:	55                   	push   %ebp
+  8003aa:	89 e5                	mov    %esp,%ebp
+  8003ac:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003b2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003b9:	00 00 00 
+	b.cnt = 0;
+  8003bc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003c3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003c6:	ff 75 0c             	push   0xc(%ebp)
+  8003c9:	ff 75 08             	push   0x8(%ebp)
+  8003cc:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003d2:	50                   	push   %eax
+  8003d3:	68 65 03 80 00       	push   $0x800365
+  8003d8:	e8 fb 00 00 00       	call   8004d8 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003dd:	83 c4 08             	add    $0x8,%esp
+  8003e0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003e6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003ec:	50                   	push   %eax
+  8003ed:	e8 b9 0a 00 00       	call   800eab <sys_cputs>
+
+	return b.cnt;
+}
+  8003f2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003f8:	c9                   	leave
+  8003f9:	c3                   	ret
+
+008003fa <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800400:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800403:	50                   	push   %eax
+  800404:	ff 75 08             	push   0x8(%ebp)
+  800407:	e8 9d ff ff ff       	call   8003a9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80040c:	c9                   	leave
+  80040d:	c3                   	ret
+
+0080040e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80040e:	55                   	push   %ebp
+  80040f:	89 e5                	mov    %esp,%ebp
+  800411:	57                   	push   %edi
+  800412:	56                   	push   %esi
+  800413:	53                   	push   %ebx
+  800414:	83 ec 1c             	sub    $0x1c,%esp
+  800417:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80041a:	89 d6                	mov    %edx,%esi
+  80041c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80041f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800422:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800425:	73 0b                	jae    800432 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800427:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80042a:	c1 e7 08             	shl    $0x8,%edi
+  80042d:	0b 7d 10             	or     0x10(%ebp),%edi
+  800430:	eb 36                	jmp    800468 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800432:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80043a:	f7 75 08             	divl   0x8(%ebp)
+  80043d:	89 c1                	mov    %eax,%ecx
+  80043f:	ff 75 14             	push   0x14(%ebp)
+  800442:	ff 75 10             	push   0x10(%ebp)
+  800445:	83 eb 01             	sub    $0x1,%ebx
+  800448:	53                   	push   %ebx
+  800449:	ff 75 08             	push   0x8(%ebp)
+  80044c:	89 f2                	mov    %esi,%edx
+  80044e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800451:	e8 b8 ff ff ff       	call   80040e <printnum>
+  800456:	83 c4 10             	add    $0x10,%esp
+  800459:	eb 14                	jmp    80046f <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80045b:	83 ec 08             	sub    $0x8,%esp
+  80045e:	56                   	push   %esi
+  80045f:	57                   	push   %edi
+  800460:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800463:	ff d0                	call   *%eax
+  800465:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800468:	83 eb 01             	sub    $0x1,%ebx
+  80046b:	85 db                	test   %ebx,%ebx
+  80046d:	7f ec                	jg     80045b <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80046f:	83 ec 08             	sub    $0x8,%esp
+  800472:	56                   	push   %esi
+  800473:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047b:	f7 75 08             	divl   0x8(%ebp)
+  80047e:	0f be 92 d3 2e 80 00 	movsbl 0x802ed3(%edx),%edx
+  800485:	8b 45 14             	mov    0x14(%ebp),%eax
+  800488:	c1 e0 08             	shl    $0x8,%eax
+  80048b:	09 d0                	or     %edx,%eax
+  80048d:	50                   	push   %eax
+  80048e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800491:	ff d0                	call   *%eax
+}
+  800493:	83 c4 10             	add    $0x10,%esp
+  800496:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800499:	5b                   	pop    %ebx
+  80049a:	5e                   	pop    %esi
+  80049b:	5f                   	pop    %edi
+  80049c:	5d                   	pop    %ebp
+  80049d:	c3                   	ret
+
+0080049e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80049e:	55                   	push   %ebp
+  80049f:	89 e5                	mov    %esp,%ebp
+  8004a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004a4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004a8:	8b 10                	mov    (%eax),%edx
+  8004aa:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004ad:	73 0a                	jae    8004b9 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004af:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004b2:	89 08                	mov    %ecx,(%eax)
+  8004b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004b7:	88 02                	mov    %al,(%edx)
+}
+  8004b9:	5d                   	pop    %ebp
+  8004ba:	c3                   	ret
+
+008004bb <printfmt>:
+{
+  8004bb:	55                   	push   %ebp
+  8004bc:	89 e5                	mov    %esp,%ebp
+  8004be:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004c1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004c4:	50                   	push   %eax
+  8004c5:	ff 75 10             	push   0x10(%ebp)
+  8004c8:	ff 75 0c             	push   0xc(%ebp)
+  8004cb:	ff 75 08             	push   0x8(%ebp)
+  8004ce:	e8 05 00 00 00       	call   8004d8 <vprintfmt>
+}
+  8004d3:	83 c4 10             	add    $0x10,%esp
+  8004d6:	c9                   	leave
+  8004d7:	c3                   	ret
+
+008004d8 <vprintfmt>:
+{
+  8004d8:	55                   	push   %ebp
+  8004d9:	89 e5                	mov    %esp,%ebp
+  8004db:	57                   	push   %edi
+  8004dc:	56                   	push   %esi
+  8004dd:	53                   	push   %ebx
+  8004de:	83 ec 3c             	sub    $0x3c,%esp
+  8004e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8004e4:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8004e7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004ee:	eb 16                	jmp    800506 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8004f0:	83 ec 08             	sub    $0x8,%esp
+  8004f3:	ff 75 0c             	push   0xc(%ebp)
+  8004f6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004f9:	c1 e2 08             	shl    $0x8,%edx
+  8004fc:	09 d0                	or     %edx,%eax
+  8004fe:	50                   	push   %eax
+  8004ff:	ff d7                	call   *%edi
+  800501:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800504:	89 de                	mov    %ebx,%esi
+  800506:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800509:	0f b6 06             	movzbl (%esi),%eax
+  80050c:	83 f8 25             	cmp    $0x25,%eax
+  80050f:	74 0c                	je     80051d <vprintfmt+0x45>
+			if (ch == '\0')
+  800511:	85 c0                	test   %eax,%eax
+  800513:	75 db                	jne    8004f0 <vprintfmt+0x18>
+}
+  800515:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800518:	5b                   	pop    %ebx
+  800519:	5e                   	pop    %esi
+  80051a:	5f                   	pop    %edi
+  80051b:	5d                   	pop    %ebp
+  80051c:	c3                   	ret
+		padc = ' ';
+  80051d:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800521:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800528:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80052f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800536:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80053b:	8d 73 01             	lea    0x1(%ebx),%esi
+  80053e:	0f b6 13             	movzbl (%ebx),%edx
+  800541:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800544:	3c 55                	cmp    $0x55,%al
+  800546:	0f 87 2c 04 00 00    	ja     800978 <vprintfmt+0x4a0>
+  80054c:	0f b6 c0             	movzbl %al,%eax
+  80054f:	ff 24 85 20 30 80 00 	jmp    *0x803020(,%eax,4)
+  800556:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800558:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80055c:	eb dd                	jmp    80053b <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80055e:	89 f3                	mov    %esi,%ebx
+  800560:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800564:	eb d5                	jmp    80053b <vprintfmt+0x63>
+  800566:	0f b6 d2             	movzbl %dl,%edx
+  800569:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80056b:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800570:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800573:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800577:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80057a:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80057d:	83 fe 09             	cmp    $0x9,%esi
+  800580:	0f 87 8a 00 00 00    	ja     800610 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800586:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800589:	eb e5                	jmp    800570 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 00                	mov    (%eax),%eax
+  800590:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800593:	8b 45 14             	mov    0x14(%ebp),%eax
+  800596:	8d 40 04             	lea    0x4(%eax),%eax
+  800599:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80059c:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80059e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005a2:	79 97                	jns    80053b <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8005a4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005aa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005b1:	eb 88                	jmp    80053b <vprintfmt+0x63>
+			if (width < 0)
+  8005b3:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8005b6:	85 db                	test   %ebx,%ebx
+  8005b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bd:	0f 49 c3             	cmovns %ebx,%eax
+  8005c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c3:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005c5:	e9 71 ff ff ff       	jmp    80053b <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ca:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8005cc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005d3:	e9 63 ff ff ff       	jmp    80053b <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8005d8:	8d 73 02             	lea    0x2(%ebx),%esi
+  8005db:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8005df:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8005e6:	3c 67                	cmp    $0x67,%al
+  8005e8:	0f 84 18 ff ff ff    	je     800506 <vprintfmt+0x2e>
+					attrib = 0x04;
+  8005ee:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8005f5:	3c 72                	cmp    $0x72,%al
+  8005f7:	0f 84 09 ff ff ff    	je     800506 <vprintfmt+0x2e>
+					attrib = 0x00;
+  8005fd:	3c 62                	cmp    $0x62,%al
+  8005ff:	0f 94 c0             	sete   %al
+  800602:	0f b6 c0             	movzbl %al,%eax
+  800605:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800608:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80060b:	e9 f6 fe ff ff       	jmp    800506 <vprintfmt+0x2e>
+  800610:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800613:	eb 89                	jmp    80059e <vprintfmt+0xc6>
+			lflag++;
+  800615:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800618:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80061a:	e9 1c ff ff ff       	jmp    80053b <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8d 58 04             	lea    0x4(%eax),%ebx
+  800625:	83 ec 08             	sub    $0x8,%esp
+  800628:	ff 75 0c             	push   0xc(%ebp)
+  80062b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80062e:	c1 e0 08             	shl    $0x8,%eax
+  800631:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800634:	0b 01                	or     (%ecx),%eax
+  800636:	50                   	push   %eax
+  800637:	ff d7                	call   *%edi
+			break;
+  800639:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80063c:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80063f:	e9 c2 fe ff ff       	jmp    800506 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80064a:	8b 10                	mov    (%eax),%edx
+  80064c:	89 d0                	mov    %edx,%eax
+  80064e:	f7 d8                	neg    %eax
+  800650:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800653:	83 f8 12             	cmp    $0x12,%eax
+  800656:	7f 25                	jg     80067d <vprintfmt+0x1a5>
+  800658:	8b 14 85 80 31 80 00 	mov    0x803180(,%eax,4),%edx
+  80065f:	85 d2                	test   %edx,%edx
+  800661:	74 1a                	je     80067d <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800663:	52                   	push   %edx
+  800664:	68 d1 32 80 00       	push   $0x8032d1
+  800669:	ff 75 0c             	push   0xc(%ebp)
+  80066c:	57                   	push   %edi
+  80066d:	e8 49 fe ff ff       	call   8004bb <printfmt>
+  800672:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800675:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800678:	e9 89 fe ff ff       	jmp    800506 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80067d:	50                   	push   %eax
+  80067e:	68 eb 2e 80 00       	push   $0x802eeb
+  800683:	ff 75 0c             	push   0xc(%ebp)
+  800686:	57                   	push   %edi
+  800687:	e8 2f fe ff ff       	call   8004bb <printfmt>
+  80068c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80068f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800692:	e9 6f fe ff ff       	jmp    800506 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	83 c0 04             	add    $0x4,%eax
+  80069d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006a5:	85 c9                	test   %ecx,%ecx
+  8006a7:	b8 e4 2e 80 00       	mov    $0x802ee4,%eax
+  8006ac:	0f 45 c1             	cmovne %ecx,%eax
+  8006af:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8006b2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006b6:	7e 06                	jle    8006be <vprintfmt+0x1e6>
+  8006b8:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8006bc:	75 1a                	jne    8006d8 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8006be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006c1:	c1 e0 08             	shl    $0x8,%eax
+  8006c4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8006c7:	83 c8 3f             	or     $0x3f,%eax
+  8006ca:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006cd:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8006d0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006d3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8006d6:	eb 6d                	jmp    800745 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d8:	83 ec 08             	sub    $0x8,%esp
+  8006db:	ff 75 d0             	push   -0x30(%ebp)
+  8006de:	ff 75 c8             	push   -0x38(%ebp)
+  8006e1:	e8 29 04 00 00       	call   800b0f <strnlen>
+  8006e6:	89 c2                	mov    %eax,%edx
+  8006e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006eb:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8006ed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006f0:	c1 e1 08             	shl    $0x8,%ecx
+  8006f3:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006f7:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006f9:	83 c4 10             	add    $0x10,%esp
+  8006fc:	89 c3                	mov    %eax,%ebx
+  8006fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800701:	89 75 10             	mov    %esi,0x10(%ebp)
+  800704:	89 ce                	mov    %ecx,%esi
+  800706:	eb 0f                	jmp    800717 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800708:	83 ec 08             	sub    $0x8,%esp
+  80070b:	ff 75 0c             	push   0xc(%ebp)
+  80070e:	56                   	push   %esi
+  80070f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800711:	83 eb 01             	sub    $0x1,%ebx
+  800714:	83 c4 10             	add    $0x10,%esp
+  800717:	85 db                	test   %ebx,%ebx
+  800719:	7f ed                	jg     800708 <vprintfmt+0x230>
+  80071b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80071e:	8b 75 10             	mov    0x10(%ebp),%esi
+  800721:	85 c0                	test   %eax,%eax
+  800723:	ba 00 00 00 00       	mov    $0x0,%edx
+  800728:	0f 49 d0             	cmovns %eax,%edx
+  80072b:	29 d0                	sub    %edx,%eax
+  80072d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800730:	eb 8c                	jmp    8006be <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800732:	83 ec 08             	sub    $0x8,%esp
+  800735:	ff 75 0c             	push   0xc(%ebp)
+  800738:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80073b:	09 c2                	or     %eax,%edx
+  80073d:	52                   	push   %edx
+  80073e:	ff d7                	call   *%edi
+  800740:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800743:	89 d9                	mov    %ebx,%ecx
+  800745:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800748:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80074c:	0f be d0             	movsbl %al,%edx
+  80074f:	85 d2                	test   %edx,%edx
+  800751:	74 2a                	je     80077d <vprintfmt+0x2a5>
+  800753:	85 f6                	test   %esi,%esi
+  800755:	78 05                	js     80075c <vprintfmt+0x284>
+  800757:	83 ee 01             	sub    $0x1,%esi
+  80075a:	78 3b                	js     800797 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80075c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800760:	74 d0                	je     800732 <vprintfmt+0x25a>
+  800762:	0f be c0             	movsbl %al,%eax
+  800765:	83 e8 20             	sub    $0x20,%eax
+  800768:	83 f8 5e             	cmp    $0x5e,%eax
+  80076b:	76 c5                	jbe    800732 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80076d:	83 ec 08             	sub    $0x8,%esp
+  800770:	ff 75 0c             	push   0xc(%ebp)
+  800773:	ff 75 cc             	push   -0x34(%ebp)
+  800776:	ff d7                	call   *%edi
+  800778:	83 c4 10             	add    $0x10,%esp
+  80077b:	eb c6                	jmp    800743 <vprintfmt+0x26b>
+  80077d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800780:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800783:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800786:	01 c3                	add    %eax,%ebx
+  800788:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80078a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80078d:	83 c8 20             	or     $0x20,%eax
+  800790:	89 75 10             	mov    %esi,0x10(%ebp)
+  800793:	89 c6                	mov    %eax,%esi
+  800795:	eb 14                	jmp    8007ab <vprintfmt+0x2d3>
+  800797:	8b 75 10             	mov    0x10(%ebp),%esi
+  80079a:	eb e4                	jmp    800780 <vprintfmt+0x2a8>
+  80079c:	83 ec 08             	sub    $0x8,%esp
+  80079f:	ff 75 0c             	push   0xc(%ebp)
+  8007a2:	56                   	push   %esi
+  8007a3:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007a5:	83 eb 01             	sub    $0x1,%ebx
+  8007a8:	83 c4 10             	add    $0x10,%esp
+  8007ab:	85 db                	test   %ebx,%ebx
+  8007ad:	7f ed                	jg     80079c <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007af:	8b 75 10             	mov    0x10(%ebp),%esi
+  8007b2:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8007b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b8:	e9 49 fd ff ff       	jmp    800506 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007bd:	83 f9 01             	cmp    $0x1,%ecx
+  8007c0:	7f 1f                	jg     8007e1 <vprintfmt+0x309>
+	else if (lflag)
+  8007c2:	85 c9                	test   %ecx,%ecx
+  8007c4:	74 69                	je     80082f <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8b 00                	mov    (%eax),%eax
+  8007cb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ce:	89 c1                	mov    %eax,%ecx
+  8007d0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007d3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007dc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007df:	eb 17                	jmp    8007f8 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8007e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e4:	8b 50 04             	mov    0x4(%eax),%edx
+  8007e7:	8b 00                	mov    (%eax),%eax
+  8007e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ec:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007f8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007fb:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8007fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800803:	85 db                	test   %ebx,%ebx
+  800805:	0f 89 f6 00 00 00    	jns    800901 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  80080b:	83 ec 08             	sub    $0x8,%esp
+  80080e:	ff 75 0c             	push   0xc(%ebp)
+  800811:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800814:	c1 e0 08             	shl    $0x8,%eax
+  800817:	83 c8 2d             	or     $0x2d,%eax
+  80081a:	50                   	push   %eax
+  80081b:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80081d:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800820:	f7 d9                	neg    %ecx
+  800822:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800825:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80082a:	e9 d2 00 00 00       	jmp    800901 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80082f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800832:	8b 00                	mov    (%eax),%eax
+  800834:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800837:	89 c1                	mov    %eax,%ecx
+  800839:	c1 f9 1f             	sar    $0x1f,%ecx
+  80083c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80083f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800842:	8d 40 04             	lea    0x4(%eax),%eax
+  800845:	89 45 14             	mov    %eax,0x14(%ebp)
+  800848:	eb ae                	jmp    8007f8 <vprintfmt+0x320>
+	if (lflag >= 2)
+  80084a:	83 f9 01             	cmp    $0x1,%ecx
+  80084d:	7f 19                	jg     800868 <vprintfmt+0x390>
+	else if (lflag)
+  80084f:	85 c9                	test   %ecx,%ecx
+  800851:	74 2a                	je     80087d <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800853:	8b 45 14             	mov    0x14(%ebp),%eax
+  800856:	8b 08                	mov    (%eax),%ecx
+  800858:	8d 40 04             	lea    0x4(%eax),%eax
+  80085b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80085e:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800863:	e9 99 00 00 00       	jmp    800901 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800868:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086b:	8b 08                	mov    (%eax),%ecx
+  80086d:	8d 40 08             	lea    0x8(%eax),%eax
+  800870:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800873:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800878:	e9 84 00 00 00       	jmp    800901 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80087d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800880:	8b 08                	mov    (%eax),%ecx
+  800882:	8d 40 04             	lea    0x4(%eax),%eax
+  800885:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800888:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  80088d:	eb 72                	jmp    800901 <vprintfmt+0x429>
+	if (lflag >= 2)
+  80088f:	83 f9 01             	cmp    $0x1,%ecx
+  800892:	7f 16                	jg     8008aa <vprintfmt+0x3d2>
+	else if (lflag)
+  800894:	85 c9                	test   %ecx,%ecx
+  800896:	74 24                	je     8008bc <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089b:	8b 08                	mov    (%eax),%ecx
+  80089d:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008a3:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8008a8:	eb 57                	jmp    800901 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ad:	8b 08                	mov    (%eax),%ecx
+  8008af:	8d 40 08             	lea    0x8(%eax),%eax
+  8008b2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008b5:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8008ba:	eb 45                	jmp    800901 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bf:	8b 08                	mov    (%eax),%ecx
+  8008c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008c7:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8008cc:	eb 33                	jmp    800901 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8008ce:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008d1:	c1 e3 08             	shl    $0x8,%ebx
+  8008d4:	83 ec 08             	sub    $0x8,%esp
+  8008d7:	ff 75 0c             	push   0xc(%ebp)
+  8008da:	89 d8                	mov    %ebx,%eax
+  8008dc:	83 c8 30             	or     $0x30,%eax
+  8008df:	50                   	push   %eax
+  8008e0:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8008e2:	83 c4 08             	add    $0x8,%esp
+  8008e5:	ff 75 0c             	push   0xc(%ebp)
+  8008e8:	83 cb 78             	or     $0x78,%ebx
+  8008eb:	53                   	push   %ebx
+  8008ec:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8008f3:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008fc:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800901:	ff 75 e4             	push   -0x1c(%ebp)
+  800904:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800908:	52                   	push   %edx
+  800909:	ff 75 e0             	push   -0x20(%ebp)
+  80090c:	50                   	push   %eax
+  80090d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800910:	89 f8                	mov    %edi,%eax
+  800912:	e8 f7 fa ff ff       	call   80040e <printnum>
+			break;
+  800917:	83 c4 10             	add    $0x10,%esp
+  80091a:	e9 e7 fb ff ff       	jmp    800506 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80091f:	83 f9 01             	cmp    $0x1,%ecx
+  800922:	7f 16                	jg     80093a <vprintfmt+0x462>
+	else if (lflag)
+  800924:	85 c9                	test   %ecx,%ecx
+  800926:	74 24                	je     80094c <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800928:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092b:	8b 08                	mov    (%eax),%ecx
+  80092d:	8d 40 04             	lea    0x4(%eax),%eax
+  800930:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800933:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800938:	eb c7                	jmp    800901 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80093a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093d:	8b 08                	mov    (%eax),%ecx
+  80093f:	8d 40 08             	lea    0x8(%eax),%eax
+  800942:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800945:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80094a:	eb b5                	jmp    800901 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80094c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094f:	8b 08                	mov    (%eax),%ecx
+  800951:	8d 40 04             	lea    0x4(%eax),%eax
+  800954:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800957:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80095c:	eb a3                	jmp    800901 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80095e:	83 ec 08             	sub    $0x8,%esp
+  800961:	ff 75 0c             	push   0xc(%ebp)
+  800964:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800967:	c1 e0 08             	shl    $0x8,%eax
+  80096a:	83 c8 25             	or     $0x25,%eax
+  80096d:	50                   	push   %eax
+  80096e:	ff d7                	call   *%edi
+			break;
+  800970:	83 c4 10             	add    $0x10,%esp
+  800973:	e9 8e fb ff ff       	jmp    800506 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800978:	83 ec 08             	sub    $0x8,%esp
+  80097b:	ff 75 0c             	push   0xc(%ebp)
+  80097e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800981:	c1 e0 08             	shl    $0x8,%eax
+  800984:	83 c8 25             	or     $0x25,%eax
+  800987:	50                   	push   %eax
+  800988:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80098a:	83 c4 10             	add    $0x10,%esp
+  80098d:	89 de                	mov    %ebx,%esi
+  80098f:	eb 03                	jmp    800994 <vprintfmt+0x4bc>
+  800991:	83 ee 01             	sub    $0x1,%esi
+  800994:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800998:	75 f7                	jne    800991 <vprintfmt+0x4b9>
+  80099a:	e9 67 fb ff ff       	jmp    800506 <vprintfmt+0x2e>
+
+0080099f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	83 ec 18             	sub    $0x18,%esp
+  8009a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009ab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009ae:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009b2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009b5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009bc:	85 c0                	test   %eax,%eax
+  8009be:	74 26                	je     8009e6 <vsnprintf+0x47>
+  8009c0:	85 d2                	test   %edx,%edx
+  8009c2:	7e 22                	jle    8009e6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009c4:	ff 75 14             	push   0x14(%ebp)
+  8009c7:	ff 75 10             	push   0x10(%ebp)
+  8009ca:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009cd:	50                   	push   %eax
+  8009ce:	68 9e 04 80 00       	push   $0x80049e
+  8009d3:	e8 00 fb ff ff       	call   8004d8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009d8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009db:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009e1:	83 c4 10             	add    $0x10,%esp
+}
+  8009e4:	c9                   	leave
+  8009e5:	c3                   	ret
+		return -E_INVAL;
+  8009e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009eb:	eb f7                	jmp    8009e4 <vsnprintf+0x45>
+
+008009ed <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8009f3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009f6:	50                   	push   %eax
+  8009f7:	ff 75 10             	push   0x10(%ebp)
+  8009fa:	ff 75 0c             	push   0xc(%ebp)
+  8009fd:	ff 75 08             	push   0x8(%ebp)
+  800a00:	e8 9a ff ff ff       	call   80099f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a05:	c9                   	leave
+  800a06:	c3                   	ret
+
+00800a07 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  800a07:	55                   	push   %ebp
+  800a08:	89 e5                	mov    %esp,%ebp
+  800a0a:	57                   	push   %edi
+  800a0b:	56                   	push   %esi
+  800a0c:	53                   	push   %ebx
+  800a0d:	83 ec 0c             	sub    $0xc,%esp
+  800a10:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  800a13:	85 c0                	test   %eax,%eax
+  800a15:	74 13                	je     800a2a <readline+0x23>
+		fprintf(1, "%s", prompt);
+  800a17:	83 ec 04             	sub    $0x4,%esp
+  800a1a:	50                   	push   %eax
+  800a1b:	68 d1 32 80 00       	push   $0x8032d1
+  800a20:	6a 01                	push   $0x1
+  800a22:	e8 cb 19 00 00       	call   8023f2 <fprintf>
+  800a27:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  800a2a:	83 ec 0c             	sub    $0xc,%esp
+  800a2d:	6a 00                	push   $0x0
+  800a2f:	e8 a9 f7 ff ff       	call   8001dd <iscons>
+  800a34:	89 c7                	mov    %eax,%edi
+  800a36:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  800a39:	be 00 00 00 00       	mov    $0x0,%esi
+  800a3e:	eb 4b                	jmp    800a8b <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  800a40:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  800a45:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  800a48:	75 08                	jne    800a52 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  800a4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a4d:	5b                   	pop    %ebx
+  800a4e:	5e                   	pop    %esi
+  800a4f:	5f                   	pop    %edi
+  800a50:	5d                   	pop    %ebp
+  800a51:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  800a52:	83 ec 08             	sub    $0x8,%esp
+  800a55:	53                   	push   %ebx
+  800a56:	68 eb 31 80 00       	push   $0x8031eb
+  800a5b:	e8 9a f9 ff ff       	call   8003fa <cprintf>
+  800a60:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  800a63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a68:	eb e0                	jmp    800a4a <readline+0x43>
+			if (echoing)
+  800a6a:	85 ff                	test   %edi,%edi
+  800a6c:	75 05                	jne    800a73 <readline+0x6c>
+			i--;
+  800a6e:	83 ee 01             	sub    $0x1,%esi
+  800a71:	eb 18                	jmp    800a8b <readline+0x84>
+				cputchar('\b');
+  800a73:	83 ec 0c             	sub    $0xc,%esp
+  800a76:	6a 08                	push   $0x8
+  800a78:	e8 1b f7 ff ff       	call   800198 <cputchar>
+  800a7d:	83 c4 10             	add    $0x10,%esp
+  800a80:	eb ec                	jmp    800a6e <readline+0x67>
+			buf[i++] = c;
+  800a82:	88 9e 00 50 80 00    	mov    %bl,0x805000(%esi)
+  800a88:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  800a8b:	e8 24 f7 ff ff       	call   8001b4 <getchar>
+  800a90:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  800a92:	85 c0                	test   %eax,%eax
+  800a94:	78 aa                	js     800a40 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  800a96:	83 f8 08             	cmp    $0x8,%eax
+  800a99:	0f 94 c0             	sete   %al
+  800a9c:	83 fb 7f             	cmp    $0x7f,%ebx
+  800a9f:	0f 94 c2             	sete   %dl
+  800aa2:	08 d0                	or     %dl,%al
+  800aa4:	74 04                	je     800aaa <readline+0xa3>
+  800aa6:	85 f6                	test   %esi,%esi
+  800aa8:	7f c0                	jg     800a6a <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  800aaa:	83 fb 1f             	cmp    $0x1f,%ebx
+  800aad:	7e 1a                	jle    800ac9 <readline+0xc2>
+  800aaf:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  800ab5:	7f 12                	jg     800ac9 <readline+0xc2>
+			if (echoing)
+  800ab7:	85 ff                	test   %edi,%edi
+  800ab9:	74 c7                	je     800a82 <readline+0x7b>
+				cputchar(c);
+  800abb:	83 ec 0c             	sub    $0xc,%esp
+  800abe:	53                   	push   %ebx
+  800abf:	e8 d4 f6 ff ff       	call   800198 <cputchar>
+  800ac4:	83 c4 10             	add    $0x10,%esp
+  800ac7:	eb b9                	jmp    800a82 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  800ac9:	83 fb 0a             	cmp    $0xa,%ebx
+  800acc:	74 05                	je     800ad3 <readline+0xcc>
+  800ace:	83 fb 0d             	cmp    $0xd,%ebx
+  800ad1:	75 b8                	jne    800a8b <readline+0x84>
+			if (echoing)
+  800ad3:	85 ff                	test   %edi,%edi
+  800ad5:	75 11                	jne    800ae8 <readline+0xe1>
+			buf[i] = 0;
+  800ad7:	c6 86 00 50 80 00 00 	movb   $0x0,0x805000(%esi)
+			return buf;
+  800ade:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800ae3:	e9 62 ff ff ff       	jmp    800a4a <readline+0x43>
+				cputchar('\n');
+  800ae8:	83 ec 0c             	sub    $0xc,%esp
+  800aeb:	6a 0a                	push   $0xa
+  800aed:	e8 a6 f6 ff ff       	call   800198 <cputchar>
+  800af2:	83 c4 10             	add    $0x10,%esp
+  800af5:	eb e0                	jmp    800ad7 <readline+0xd0>
+
+00800af7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800af7:	55                   	push   %ebp
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b02:	eb 03                	jmp    800b07 <strlen+0x10>
+		n++;
+  800b04:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b07:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b0b:	75 f7                	jne    800b04 <strlen+0xd>
+	return n;
+}
+  800b0d:	5d                   	pop    %ebp
+  800b0e:	c3                   	ret
+
+00800b0f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b0f:	55                   	push   %ebp
+  800b10:	89 e5                	mov    %esp,%ebp
+  800b12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b15:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1d:	eb 03                	jmp    800b22 <strnlen+0x13>
+		n++;
+  800b1f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b22:	39 d0                	cmp    %edx,%eax
+  800b24:	74 08                	je     800b2e <strnlen+0x1f>
+  800b26:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b2a:	75 f3                	jne    800b1f <strnlen+0x10>
+  800b2c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b2e:	89 d0                	mov    %edx,%eax
+  800b30:	5d                   	pop    %ebp
+  800b31:	c3                   	ret
+
+00800b32 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	53                   	push   %ebx
+  800b36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b41:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b45:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b48:	83 c0 01             	add    $0x1,%eax
+  800b4b:	84 d2                	test   %dl,%dl
+  800b4d:	75 f2                	jne    800b41 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b4f:	89 c8                	mov    %ecx,%eax
+  800b51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b54:	c9                   	leave
+  800b55:	c3                   	ret
+
+00800b56 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	53                   	push   %ebx
+  800b5a:	83 ec 10             	sub    $0x10,%esp
+  800b5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b60:	53                   	push   %ebx
+  800b61:	e8 91 ff ff ff       	call   800af7 <strlen>
+  800b66:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b69:	ff 75 0c             	push   0xc(%ebp)
+  800b6c:	01 d8                	add    %ebx,%eax
+  800b6e:	50                   	push   %eax
+  800b6f:	e8 be ff ff ff       	call   800b32 <strcpy>
+	return dst;
+}
+  800b74:	89 d8                	mov    %ebx,%eax
+  800b76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b79:	c9                   	leave
+  800b7a:	c3                   	ret
+
+00800b7b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b7b:	55                   	push   %ebp
+  800b7c:	89 e5                	mov    %esp,%ebp
+  800b7e:	56                   	push   %esi
+  800b7f:	53                   	push   %ebx
+  800b80:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b83:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b86:	89 f3                	mov    %esi,%ebx
+  800b88:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b8b:	89 f0                	mov    %esi,%eax
+  800b8d:	eb 0f                	jmp    800b9e <strncpy+0x23>
+		*dst++ = *src;
+  800b8f:	83 c0 01             	add    $0x1,%eax
+  800b92:	0f b6 0a             	movzbl (%edx),%ecx
+  800b95:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800b98:	80 f9 01             	cmp    $0x1,%cl
+  800b9b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b9e:	39 d8                	cmp    %ebx,%eax
+  800ba0:	75 ed                	jne    800b8f <strncpy+0x14>
+	}
+	return ret;
+}
+  800ba2:	89 f0                	mov    %esi,%eax
+  800ba4:	5b                   	pop    %ebx
+  800ba5:	5e                   	pop    %esi
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	c3                   	ret
+
+00800ba8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ba8:	55                   	push   %ebp
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	56                   	push   %esi
+  800bac:	53                   	push   %ebx
+  800bad:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bb6:	89 f0                	mov    %esi,%eax
+  800bb8:	85 d2                	test   %edx,%edx
+  800bba:	74 21                	je     800bdd <strlcpy+0x35>
+  800bbc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800bc0:	89 f2                	mov    %esi,%edx
+  800bc2:	eb 09                	jmp    800bcd <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800bc4:	83 c1 01             	add    $0x1,%ecx
+  800bc7:	83 c2 01             	add    $0x1,%edx
+  800bca:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800bcd:	39 c2                	cmp    %eax,%edx
+  800bcf:	74 09                	je     800bda <strlcpy+0x32>
+  800bd1:	0f b6 19             	movzbl (%ecx),%ebx
+  800bd4:	84 db                	test   %bl,%bl
+  800bd6:	75 ec                	jne    800bc4 <strlcpy+0x1c>
+  800bd8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800bda:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800bdd:	29 f0                	sub    %esi,%eax
+}
+  800bdf:	5b                   	pop    %ebx
+  800be0:	5e                   	pop    %esi
+  800be1:	5d                   	pop    %ebp
+  800be2:	c3                   	ret
+
+00800be3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800be9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800bec:	eb 06                	jmp    800bf4 <strcmp+0x11>
+		p++, q++;
+  800bee:	83 c1 01             	add    $0x1,%ecx
+  800bf1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800bf4:	0f b6 01             	movzbl (%ecx),%eax
+  800bf7:	84 c0                	test   %al,%al
+  800bf9:	74 04                	je     800bff <strcmp+0x1c>
+  800bfb:	3a 02                	cmp    (%edx),%al
+  800bfd:	74 ef                	je     800bee <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800bff:	0f b6 c0             	movzbl %al,%eax
+  800c02:	0f b6 12             	movzbl (%edx),%edx
+  800c05:	29 d0                	sub    %edx,%eax
+}
+  800c07:	5d                   	pop    %ebp
+  800c08:	c3                   	ret
+
+00800c09 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c09:	55                   	push   %ebp
+  800c0a:	89 e5                	mov    %esp,%ebp
+  800c0c:	53                   	push   %ebx
+  800c0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c13:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c16:	eb 09                	jmp    800c21 <strncmp+0x18>
+		n--, p++, q++;
+  800c18:	83 ea 01             	sub    $0x1,%edx
+  800c1b:	83 c0 01             	add    $0x1,%eax
+  800c1e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c21:	85 d2                	test   %edx,%edx
+  800c23:	74 18                	je     800c3d <strncmp+0x34>
+  800c25:	0f b6 18             	movzbl (%eax),%ebx
+  800c28:	84 db                	test   %bl,%bl
+  800c2a:	74 04                	je     800c30 <strncmp+0x27>
+  800c2c:	3a 19                	cmp    (%ecx),%bl
+  800c2e:	74 e8                	je     800c18 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c30:	0f b6 00             	movzbl (%eax),%eax
+  800c33:	0f b6 11             	movzbl (%ecx),%edx
+  800c36:	29 d0                	sub    %edx,%eax
+}
+  800c38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c3b:	c9                   	leave
+  800c3c:	c3                   	ret
+		return 0;
+  800c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c42:	eb f4                	jmp    800c38 <strncmp+0x2f>
+
+00800c44 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c4e:	eb 03                	jmp    800c53 <strchr+0xf>
+  800c50:	83 c0 01             	add    $0x1,%eax
+  800c53:	0f b6 10             	movzbl (%eax),%edx
+  800c56:	84 d2                	test   %dl,%dl
+  800c58:	74 06                	je     800c60 <strchr+0x1c>
+		if (*s == c)
+  800c5a:	38 ca                	cmp    %cl,%dl
+  800c5c:	75 f2                	jne    800c50 <strchr+0xc>
+  800c5e:	eb 05                	jmp    800c65 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c65:	5d                   	pop    %ebp
+  800c66:	c3                   	ret
+
+00800c67 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c67:	55                   	push   %ebp
+  800c68:	89 e5                	mov    %esp,%ebp
+  800c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c71:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c74:	38 ca                	cmp    %cl,%dl
+  800c76:	74 09                	je     800c81 <strfind+0x1a>
+  800c78:	84 d2                	test   %dl,%dl
+  800c7a:	74 05                	je     800c81 <strfind+0x1a>
+	for (; *s; s++)
+  800c7c:	83 c0 01             	add    $0x1,%eax
+  800c7f:	eb f0                	jmp    800c71 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c81:	5d                   	pop    %ebp
+  800c82:	c3                   	ret
+
+00800c83 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c83:	55                   	push   %ebp
+  800c84:	89 e5                	mov    %esp,%ebp
+  800c86:	57                   	push   %edi
+  800c87:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c8a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c8d:	85 c9                	test   %ecx,%ecx
+  800c8f:	74 20                	je     800cb1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c91:	89 f8                	mov    %edi,%eax
+  800c93:	09 c8                	or     %ecx,%eax
+  800c95:	a8 03                	test   $0x3,%al
+  800c97:	75 12                	jne    800cab <memset+0x28>
+		c &= 0xFF;
+  800c99:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c9d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ca3:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ca6:	fc                   	cld
+  800ca7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ca9:	eb 06                	jmp    800cb1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cae:	fc                   	cld
+  800caf:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cb1:	89 f8                	mov    %edi,%eax
+  800cb3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cb6:	c9                   	leave
+  800cb7:	c3                   	ret
+
+00800cb8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	57                   	push   %edi
+  800cbc:	56                   	push   %esi
+  800cbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cc3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800cc6:	39 c6                	cmp    %eax,%esi
+  800cc8:	73 32                	jae    800cfc <memmove+0x44>
+  800cca:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ccd:	39 d0                	cmp    %edx,%eax
+  800ccf:	73 2b                	jae    800cfc <memmove+0x44>
+		s += n;
+		d += n;
+  800cd1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cd4:	89 d6                	mov    %edx,%esi
+  800cd6:	09 fe                	or     %edi,%esi
+  800cd8:	09 ce                	or     %ecx,%esi
+  800cda:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ce0:	75 0e                	jne    800cf0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ce2:	83 ef 04             	sub    $0x4,%edi
+  800ce5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ce8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ceb:	fd                   	std
+  800cec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cee:	eb 09                	jmp    800cf9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800cf0:	83 ef 01             	sub    $0x1,%edi
+  800cf3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800cf6:	fd                   	std
+  800cf7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800cf9:	fc                   	cld
+  800cfa:	eb 1a                	jmp    800d16 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cfc:	89 f2                	mov    %esi,%edx
+  800cfe:	09 c2                	or     %eax,%edx
+  800d00:	09 ca                	or     %ecx,%edx
+  800d02:	f6 c2 03             	test   $0x3,%dl
+  800d05:	75 0a                	jne    800d11 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d07:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d0a:	89 c7                	mov    %eax,%edi
+  800d0c:	fc                   	cld
+  800d0d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d0f:	eb 05                	jmp    800d16 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d11:	89 c7                	mov    %eax,%edi
+  800d13:	fc                   	cld
+  800d14:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d16:	5e                   	pop    %esi
+  800d17:	5f                   	pop    %edi
+  800d18:	5d                   	pop    %ebp
+  800d19:	c3                   	ret
+
+00800d1a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d20:	ff 75 10             	push   0x10(%ebp)
+  800d23:	ff 75 0c             	push   0xc(%ebp)
+  800d26:	ff 75 08             	push   0x8(%ebp)
+  800d29:	e8 8a ff ff ff       	call   800cb8 <memmove>
+}
+  800d2e:	c9                   	leave
+  800d2f:	c3                   	ret
+
+00800d30 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d30:	55                   	push   %ebp
+  800d31:	89 e5                	mov    %esp,%ebp
+  800d33:	56                   	push   %esi
+  800d34:	53                   	push   %ebx
+  800d35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d38:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d3b:	89 c6                	mov    %eax,%esi
+  800d3d:	03 75 10             	add    0x10(%ebp),%esi
+  800d40:	eb 06                	jmp    800d48 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d42:	83 c0 01             	add    $0x1,%eax
+  800d45:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d48:	39 f0                	cmp    %esi,%eax
+  800d4a:	74 14                	je     800d60 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d4c:	0f b6 08             	movzbl (%eax),%ecx
+  800d4f:	0f b6 1a             	movzbl (%edx),%ebx
+  800d52:	38 d9                	cmp    %bl,%cl
+  800d54:	74 ec                	je     800d42 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d56:	0f b6 c1             	movzbl %cl,%eax
+  800d59:	0f b6 db             	movzbl %bl,%ebx
+  800d5c:	29 d8                	sub    %ebx,%eax
+  800d5e:	eb 05                	jmp    800d65 <memcmp+0x35>
+	}
+
+	return 0;
+  800d60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d65:	5b                   	pop    %ebx
+  800d66:	5e                   	pop    %esi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+
+00800d69 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d72:	89 c2                	mov    %eax,%edx
+  800d74:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d77:	eb 03                	jmp    800d7c <memfind+0x13>
+  800d79:	83 c0 01             	add    $0x1,%eax
+  800d7c:	39 d0                	cmp    %edx,%eax
+  800d7e:	73 04                	jae    800d84 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d80:	38 08                	cmp    %cl,(%eax)
+  800d82:	75 f5                	jne    800d79 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d84:	5d                   	pop    %ebp
+  800d85:	c3                   	ret
+
+00800d86 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+  800d8c:	83 ec 1c             	sub    $0x1c,%esp
+  800d8f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d92:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d95:	eb 03                	jmp    800d9a <strtol+0x14>
+		s++;
+  800d97:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800d9a:	0f b6 06             	movzbl (%esi),%eax
+  800d9d:	3c 20                	cmp    $0x20,%al
+  800d9f:	74 f6                	je     800d97 <strtol+0x11>
+  800da1:	3c 09                	cmp    $0x9,%al
+  800da3:	74 f2                	je     800d97 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800da5:	3c 2b                	cmp    $0x2b,%al
+  800da7:	74 43                	je     800dec <strtol+0x66>
+	int neg = 0;
+  800da9:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800dae:	3c 2d                	cmp    $0x2d,%al
+  800db0:	74 44                	je     800df6 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800db2:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800db8:	75 0f                	jne    800dc9 <strtol+0x43>
+  800dba:	80 3e 30             	cmpb   $0x30,(%esi)
+  800dbd:	74 41                	je     800e00 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800dbf:	85 ff                	test   %edi,%edi
+  800dc1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dc6:	0f 44 f8             	cmove  %eax,%edi
+  800dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dce:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800dd3:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800dd6:	89 fb                	mov    %edi,%ebx
+  800dd8:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ddb:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800dde:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800de1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800de4:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800de7:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dea:	eb 67                	jmp    800e53 <strtol+0xcd>
+		s++;
+  800dec:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800def:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df4:	eb bc                	jmp    800db2 <strtol+0x2c>
+		s++, neg = 1;
+  800df6:	83 c6 01             	add    $0x1,%esi
+  800df9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800dfe:	eb b2                	jmp    800db2 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e00:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800e04:	74 0e                	je     800e14 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800e06:	85 ff                	test   %edi,%edi
+  800e08:	75 bf                	jne    800dc9 <strtol+0x43>
+		s++, base = 8;
+  800e0a:	83 c6 01             	add    $0x1,%esi
+  800e0d:	bf 08 00 00 00       	mov    $0x8,%edi
+  800e12:	eb b5                	jmp    800dc9 <strtol+0x43>
+		s += 2, base = 16;
+  800e14:	83 c6 02             	add    $0x2,%esi
+  800e17:	bf 10 00 00 00       	mov    $0x10,%edi
+  800e1c:	eb ab                	jmp    800dc9 <strtol+0x43>
+			dig = *s - '0';
+  800e1e:	0f be c9             	movsbl %cl,%ecx
+  800e21:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800e24:	39 f9                	cmp    %edi,%ecx
+  800e26:	7d 59                	jge    800e81 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800e28:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800e2c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e2f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e32:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800e35:	0f af d8             	imul   %eax,%ebx
+  800e38:	0f af d7             	imul   %edi,%edx
+  800e3b:	01 d3                	add    %edx,%ebx
+  800e3d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e40:	f7 e7                	mul    %edi
+  800e42:	01 da                	add    %ebx,%edx
+  800e44:	89 cb                	mov    %ecx,%ebx
+  800e46:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e49:	01 c8                	add    %ecx,%eax
+  800e4b:	11 da                	adc    %ebx,%edx
+  800e4d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e50:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800e53:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e56:	0f b6 08             	movzbl (%eax),%ecx
+  800e59:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800e5c:	80 fb 09             	cmp    $0x9,%bl
+  800e5f:	76 bd                	jbe    800e1e <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800e61:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800e64:	80 fb 19             	cmp    $0x19,%bl
+  800e67:	77 08                	ja     800e71 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800e69:	0f be c9             	movsbl %cl,%ecx
+  800e6c:	83 e9 57             	sub    $0x57,%ecx
+  800e6f:	eb b3                	jmp    800e24 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e71:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800e74:	80 fb 19             	cmp    $0x19,%bl
+  800e77:	77 08                	ja     800e81 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800e79:	0f be c9             	movsbl %cl,%ecx
+  800e7c:	83 e9 37             	sub    $0x37,%ecx
+  800e7f:	eb a3                	jmp    800e24 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e81:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800e84:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e87:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800e8a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e8d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e91:	74 05                	je     800e98 <strtol+0x112>
+		*endptr = (char *) s;
+  800e93:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800e96:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800e98:	85 c9                	test   %ecx,%ecx
+  800e9a:	74 07                	je     800ea3 <strtol+0x11d>
+  800e9c:	f7 d8                	neg    %eax
+  800e9e:	83 d2 00             	adc    $0x0,%edx
+  800ea1:	f7 da                	neg    %edx
+}
+  800ea3:	83 c4 1c             	add    $0x1c,%esp
+  800ea6:	5b                   	pop    %ebx
+  800ea7:	5e                   	pop    %esi
+  800ea8:	5f                   	pop    %edi
+  800ea9:	5d                   	pop    %ebp
+  800eaa:	c3                   	ret
+
+00800eab <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800eb1:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  800eb8:	74 18                	je     800ed2 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	89 c3                	mov    %eax,%ebx
+  800ec7:	89 c7                	mov    %eax,%edi
+  800ec9:	89 c6                	mov    %eax,%esi
+  800ecb:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ecd:	5b                   	pop    %ebx
+  800ece:	5e                   	pop    %esi
+  800ecf:	5f                   	pop    %edi
+  800ed0:	5d                   	pop    %ebp
+  800ed1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	89 c3                	mov    %eax,%ebx
+  800edf:	89 c7                	mov    %eax,%edi
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	8d 35 ec 0e 80 00    	lea    0x800eec,%esi
+  800eea:	0f 34                	sysenter
+  800eec:	5d                   	pop    %ebp
+		goto out;
+  800eed:	eb de                	jmp    800ecd <sys_cputs+0x22>
+
+00800eef <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	56                   	push   %esi
+  800ef4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ef5:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  800efc:	74 19                	je     800f17 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800efe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f03:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f08:	89 d1                	mov    %edx,%ecx
+  800f0a:	89 d3                	mov    %edx,%ebx
+  800f0c:	89 d7                	mov    %edx,%edi
+  800f0e:	89 d6                	mov    %edx,%esi
+  800f10:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f21:	89 d1                	mov    %edx,%ecx
+  800f23:	89 d3                	mov    %edx,%ebx
+  800f25:	89 d7                	mov    %edx,%edi
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	8d 35 32 0f 80 00    	lea    0x800f32,%esi
+  800f30:	0f 34                	sysenter
+  800f32:	5d                   	pop    %ebp
+		goto out;
+  800f33:	eb dd                	jmp    800f12 <sys_cgetc+0x23>
+
+00800f35 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	56                   	push   %esi
+  800f3a:	53                   	push   %ebx
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f3e:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  800f45:	74 21                	je     800f68 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800f47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f4c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f54:	89 cb                	mov    %ecx,%ebx
+  800f56:	89 cf                	mov    %ecx,%edi
+  800f58:	89 ce                	mov    %ecx,%esi
+  800f5a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5c:	85 c0                	test   %eax,%eax
+  800f5e:	7f 27                	jg     800f87 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f63:	5b                   	pop    %ebx
+  800f64:	5e                   	pop    %esi
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f70:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f75:	89 cb                	mov    %ecx,%ebx
+  800f77:	89 cf                	mov    %ecx,%edi
+  800f79:	55                   	push   %ebp
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	8d 35 84 0f 80 00    	lea    0x800f84,%esi
+  800f82:	0f 34                	sysenter
+  800f84:	5d                   	pop    %ebp
+		goto out;
+  800f85:	eb d5                	jmp    800f5c <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f87:	83 ec 0c             	sub    $0xc,%esp
+  800f8a:	50                   	push   %eax
+  800f8b:	6a 03                	push   $0x3
+  800f8d:	68 fb 31 80 00       	push   $0x8031fb
+  800f92:	6a 3f                	push   $0x3f
+  800f94:	68 18 32 80 00       	push   $0x803218
+  800f99:	e8 81 f3 ff ff       	call   80031f <_panic>
+
+00800f9e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	57                   	push   %edi
+  800fa2:	56                   	push   %esi
+  800fa3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fa4:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  800fab:	74 19                	je     800fc6 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800fad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fb7:	89 d1                	mov    %edx,%ecx
+  800fb9:	89 d3                	mov    %edx,%ebx
+  800fbb:	89 d7                	mov    %edx,%edi
+  800fbd:	89 d6                	mov    %edx,%esi
+  800fbf:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fd0:	89 d1                	mov    %edx,%ecx
+  800fd2:	89 d3                	mov    %edx,%ebx
+  800fd4:	89 d7                	mov    %edx,%edi
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	8d 35 e1 0f 80 00    	lea    0x800fe1,%esi
+  800fdf:	0f 34                	sysenter
+  800fe1:	5d                   	pop    %ebp
+		goto out;
+  800fe2:	eb dd                	jmp    800fc1 <sys_getenvid+0x23>
+
+00800fe4 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800fe4:	55                   	push   %ebp
+  800fe5:	89 e5                	mov    %esp,%ebp
+  800fe7:	57                   	push   %edi
+  800fe8:	56                   	push   %esi
+  800fe9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fea:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  800ff1:	74 19                	je     80100c <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ffd:	89 d1                	mov    %edx,%ecx
+  800fff:	89 d3                	mov    %edx,%ebx
+  801001:	89 d7                	mov    %edx,%edi
+  801003:	89 d6                	mov    %edx,%esi
+  801005:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801007:	5b                   	pop    %ebx
+  801008:	5e                   	pop    %esi
+  801009:	5f                   	pop    %edi
+  80100a:	5d                   	pop    %ebp
+  80100b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80100c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801011:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801016:	89 d1                	mov    %edx,%ecx
+  801018:	89 d3                	mov    %edx,%ebx
+  80101a:	89 d7                	mov    %edx,%edi
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	8d 35 27 10 80 00    	lea    0x801027,%esi
+  801025:	0f 34                	sysenter
+  801027:	5d                   	pop    %ebp
+		goto out;
+  801028:	eb dd                	jmp    801007 <sys_yield+0x23>
+
+0080102a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	57                   	push   %edi
+  80102e:	56                   	push   %esi
+  80102f:	53                   	push   %ebx
+  801030:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801033:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  80103a:	74 23                	je     80105f <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  80103c:	be 00 00 00 00       	mov    $0x0,%esi
+  801041:	b8 04 00 00 00       	mov    $0x4,%eax
+  801046:	8b 55 08             	mov    0x8(%ebp),%edx
+  801049:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104f:	89 f7                	mov    %esi,%edi
+  801051:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801053:	85 c0                	test   %eax,%eax
+  801055:	7f 29                	jg     801080 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801057:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105a:	5b                   	pop    %ebx
+  80105b:	5e                   	pop    %esi
+  80105c:	5f                   	pop    %edi
+  80105d:	5d                   	pop    %ebp
+  80105e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801065:	b8 04 00 00 00       	mov    $0x4,%eax
+  80106a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80106f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	8d 35 7d 10 80 00    	lea    0x80107d,%esi
+  80107b:	0f 34                	sysenter
+  80107d:	5d                   	pop    %ebp
+		goto out;
+  80107e:	eb d3                	jmp    801053 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801080:	83 ec 0c             	sub    $0xc,%esp
+  801083:	50                   	push   %eax
+  801084:	6a 04                	push   $0x4
+  801086:	68 fb 31 80 00       	push   $0x8031fb
+  80108b:	6a 3f                	push   $0x3f
+  80108d:	68 18 32 80 00       	push   $0x803218
+  801092:	e8 88 f2 ff ff       	call   80031f <_panic>
+
+00801097 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  8010a3:	85 f6                	test   %esi,%esi
+  8010a5:	75 09                	jne    8010b0 <sys_page_map+0x19>
+  8010a7:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8010ae:	74 1f                	je     8010cf <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  8010b0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010be:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	7f 27                	jg     8010ee <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5e                   	pop    %esi
+  8010cc:	5f                   	pop    %edi
+  8010cd:	5d                   	pop    %ebp
+  8010ce:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010dd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	8d 35 eb 10 80 00    	lea    0x8010eb,%esi
+  8010e9:	0f 34                	sysenter
+  8010eb:	5d                   	pop    %ebp
+		goto out;
+  8010ec:	eb d5                	jmp    8010c3 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ee:	83 ec 0c             	sub    $0xc,%esp
+  8010f1:	50                   	push   %eax
+  8010f2:	6a 05                	push   $0x5
+  8010f4:	68 fb 31 80 00       	push   $0x8031fb
+  8010f9:	6a 3f                	push   $0x3f
+  8010fb:	68 18 32 80 00       	push   $0x803218
+  801100:	e8 1a f2 ff ff       	call   80031f <_panic>
+
+00801105 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	57                   	push   %edi
+  801109:	56                   	push   %esi
+  80110a:	53                   	push   %ebx
+  80110b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80110e:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801115:	74 22                	je     801139 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801117:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801121:	8b 55 08             	mov    0x8(%ebp),%edx
+  801124:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801127:	89 df                	mov    %ebx,%edi
+  801129:	89 de                	mov    %ebx,%esi
+  80112b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80112d:	85 c0                	test   %eax,%eax
+  80112f:	7f 28                	jg     801159 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801134:	5b                   	pop    %ebx
+  801135:	5e                   	pop    %esi
+  801136:	5f                   	pop    %edi
+  801137:	5d                   	pop    %ebp
+  801138:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801141:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801144:	b8 06 00 00 00       	mov    $0x6,%eax
+  801149:	89 df                	mov    %ebx,%edi
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	8d 35 56 11 80 00    	lea    0x801156,%esi
+  801154:	0f 34                	sysenter
+  801156:	5d                   	pop    %ebp
+		goto out;
+  801157:	eb d4                	jmp    80112d <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801159:	83 ec 0c             	sub    $0xc,%esp
+  80115c:	50                   	push   %eax
+  80115d:	6a 06                	push   $0x6
+  80115f:	68 fb 31 80 00       	push   $0x8031fb
+  801164:	6a 3f                	push   $0x3f
+  801166:	68 18 32 80 00       	push   $0x803218
+  80116b:	e8 af f1 ff ff       	call   80031f <_panic>
+
+00801170 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+  801176:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801179:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801180:	74 22                	je     8011a4 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801182:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801187:	b8 08 00 00 00       	mov    $0x8,%eax
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	89 df                	mov    %ebx,%edi
+  801194:	89 de                	mov    %ebx,%esi
+  801196:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801198:	85 c0                	test   %eax,%eax
+  80119a:	7f 28                	jg     8011c4 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80119c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119f:	5b                   	pop    %ebx
+  8011a0:	5e                   	pop    %esi
+  8011a1:	5f                   	pop    %edi
+  8011a2:	5d                   	pop    %ebp
+  8011a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011af:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011b4:	89 df                	mov    %ebx,%edi
+  8011b6:	55                   	push   %ebp
+  8011b7:	89 e5                	mov    %esp,%ebp
+  8011b9:	8d 35 c1 11 80 00    	lea    0x8011c1,%esi
+  8011bf:	0f 34                	sysenter
+  8011c1:	5d                   	pop    %ebp
+		goto out;
+  8011c2:	eb d4                	jmp    801198 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c4:	83 ec 0c             	sub    $0xc,%esp
+  8011c7:	50                   	push   %eax
+  8011c8:	6a 08                	push   $0x8
+  8011ca:	68 fb 31 80 00       	push   $0x8031fb
+  8011cf:	6a 3f                	push   $0x3f
+  8011d1:	68 18 32 80 00       	push   $0x803218
+  8011d6:	e8 44 f1 ff ff       	call   80031f <_panic>
+
+008011db <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011e4:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8011eb:	74 22                	je     80120f <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  8011ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fd:	89 df                	mov    %ebx,%edi
+  8011ff:	89 de                	mov    %ebx,%esi
+  801201:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801203:	85 c0                	test   %eax,%eax
+  801205:	7f 28                	jg     80122f <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120a:	5b                   	pop    %ebx
+  80120b:	5e                   	pop    %esi
+  80120c:	5f                   	pop    %edi
+  80120d:	5d                   	pop    %ebp
+  80120e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80120f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801214:	8b 55 08             	mov    0x8(%ebp),%edx
+  801217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80121f:	89 df                	mov    %ebx,%edi
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	8d 35 2c 12 80 00    	lea    0x80122c,%esi
+  80122a:	0f 34                	sysenter
+  80122c:	5d                   	pop    %ebp
+		goto out;
+  80122d:	eb d4                	jmp    801203 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80122f:	83 ec 0c             	sub    $0xc,%esp
+  801232:	50                   	push   %eax
+  801233:	6a 09                	push   $0x9
+  801235:	68 fb 31 80 00       	push   $0x8031fb
+  80123a:	6a 3f                	push   $0x3f
+  80123c:	68 18 32 80 00       	push   $0x803218
+  801241:	e8 d9 f0 ff ff       	call   80031f <_panic>
+
+00801246 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	57                   	push   %edi
+  80124a:	56                   	push   %esi
+  80124b:	53                   	push   %ebx
+  80124c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80124f:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801256:	74 22                	je     80127a <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801258:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801262:	8b 55 08             	mov    0x8(%ebp),%edx
+  801265:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801268:	89 df                	mov    %ebx,%edi
+  80126a:	89 de                	mov    %ebx,%esi
+  80126c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80126e:	85 c0                	test   %eax,%eax
+  801270:	7f 28                	jg     80129a <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801275:	5b                   	pop    %ebx
+  801276:	5e                   	pop    %esi
+  801277:	5f                   	pop    %edi
+  801278:	5d                   	pop    %ebp
+  801279:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80127a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801282:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801285:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80128a:	89 df                	mov    %ebx,%edi
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	8d 35 97 12 80 00    	lea    0x801297,%esi
+  801295:	0f 34                	sysenter
+  801297:	5d                   	pop    %ebp
+		goto out;
+  801298:	eb d4                	jmp    80126e <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129a:	83 ec 0c             	sub    $0xc,%esp
+  80129d:	50                   	push   %eax
+  80129e:	6a 0a                	push   $0xa
+  8012a0:	68 fb 31 80 00       	push   $0x8031fb
+  8012a5:	6a 3f                	push   $0x3f
+  8012a7:	68 18 32 80 00       	push   $0x803218
+  8012ac:	e8 6e f0 ff ff       	call   80031f <_panic>
+
+008012b1 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8012b1:	55                   	push   %ebp
+  8012b2:	89 e5                	mov    %esp,%ebp
+  8012b4:	57                   	push   %edi
+  8012b5:	56                   	push   %esi
+  8012b6:	53                   	push   %ebx
+  8012b7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012ba:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8012c1:	74 22                	je     8012e5 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8012c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d3:	89 df                	mov    %ebx,%edi
+  8012d5:	89 de                	mov    %ebx,%esi
+  8012d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012d9:	85 c0                	test   %eax,%eax
+  8012db:	7f 28                	jg     801305 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8012dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5f                   	pop    %edi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012f5:	89 df                	mov    %ebx,%edi
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	8d 35 02 13 80 00    	lea    0x801302,%esi
+  801300:	0f 34                	sysenter
+  801302:	5d                   	pop    %ebp
+		goto out;
+  801303:	eb d4                	jmp    8012d9 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801305:	83 ec 0c             	sub    $0xc,%esp
+  801308:	50                   	push   %eax
+  801309:	6a 17                	push   $0x17
+  80130b:	68 fb 31 80 00       	push   $0x8031fb
+  801310:	6a 3f                	push   $0x3f
+  801312:	68 18 32 80 00       	push   $0x803218
+  801317:	e8 03 f0 ff ff       	call   80031f <_panic>
+
+0080131c <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	57                   	push   %edi
+  801320:	56                   	push   %esi
+  801321:	53                   	push   %ebx
+  801322:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801325:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  80132c:	74 22                	je     801350 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80132e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801333:	b8 18 00 00 00       	mov    $0x18,%eax
+  801338:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133e:	89 df                	mov    %ebx,%edi
+  801340:	89 de                	mov    %ebx,%esi
+  801342:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801344:	85 c0                	test   %eax,%eax
+  801346:	7f 28                	jg     801370 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801348:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134b:	5b                   	pop    %ebx
+  80134c:	5e                   	pop    %esi
+  80134d:	5f                   	pop    %edi
+  80134e:	5d                   	pop    %ebp
+  80134f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801350:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801355:	8b 55 08             	mov    0x8(%ebp),%edx
+  801358:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801360:	89 df                	mov    %ebx,%edi
+  801362:	55                   	push   %ebp
+  801363:	89 e5                	mov    %esp,%ebp
+  801365:	8d 35 6d 13 80 00    	lea    0x80136d,%esi
+  80136b:	0f 34                	sysenter
+  80136d:	5d                   	pop    %ebp
+		goto out;
+  80136e:	eb d4                	jmp    801344 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801370:	83 ec 0c             	sub    $0xc,%esp
+  801373:	50                   	push   %eax
+  801374:	6a 18                	push   $0x18
+  801376:	68 fb 31 80 00       	push   $0x8031fb
+  80137b:	6a 3f                	push   $0x3f
+  80137d:	68 18 32 80 00       	push   $0x803218
+  801382:	e8 98 ef ff ff       	call   80031f <_panic>
+
+00801387 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80138d:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801394:	74 1d                	je     8013b3 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801396:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80139b:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013ac:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8013ae:	5b                   	pop    %ebx
+  8013af:	5e                   	pop    %esi
+  8013b0:	5f                   	pop    %edi
+  8013b1:	5d                   	pop    %ebp
+  8013b2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c4:	55                   	push   %ebp
+  8013c5:	89 e5                	mov    %esp,%ebp
+  8013c7:	8d 35 cf 13 80 00    	lea    0x8013cf,%esi
+  8013cd:	0f 34                	sysenter
+  8013cf:	5d                   	pop    %ebp
+		goto out;
+  8013d0:	eb dc                	jmp    8013ae <sys_ipc_try_send+0x27>
+
+008013d2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+  8013d5:	57                   	push   %edi
+  8013d6:	56                   	push   %esi
+  8013d7:	53                   	push   %ebx
+  8013d8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013db:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8013e2:	74 21                	je     801405 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8013e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f1:	89 cb                	mov    %ecx,%ebx
+  8013f3:	89 cf                	mov    %ecx,%edi
+  8013f5:	89 ce                	mov    %ecx,%esi
+  8013f7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	7f 27                	jg     801424 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8013fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5f                   	pop    %edi
+  801403:	5d                   	pop    %ebp
+  801404:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801405:	8b 55 08             	mov    0x8(%ebp),%edx
+  801408:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80140d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801412:	89 cb                	mov    %ecx,%ebx
+  801414:	89 cf                	mov    %ecx,%edi
+  801416:	55                   	push   %ebp
+  801417:	89 e5                	mov    %esp,%ebp
+  801419:	8d 35 21 14 80 00    	lea    0x801421,%esi
+  80141f:	0f 34                	sysenter
+  801421:	5d                   	pop    %ebp
+		goto out;
+  801422:	eb d5                	jmp    8013f9 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801424:	83 ec 0c             	sub    $0xc,%esp
+  801427:	50                   	push   %eax
+  801428:	6a 0d                	push   $0xd
+  80142a:	68 fb 31 80 00       	push   $0x8031fb
+  80142f:	6a 3f                	push   $0x3f
+  801431:	68 18 32 80 00       	push   $0x803218
+  801436:	e8 e4 ee ff ff       	call   80031f <_panic>
+
+0080143b <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801441:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801448:	74 1b                	je     801465 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80144a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801454:	8b 55 08             	mov    0x8(%ebp),%edx
+  801457:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145a:	89 df                	mov    %ebx,%edi
+  80145c:	89 de                	mov    %ebx,%esi
+  80145e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801460:	5b                   	pop    %ebx
+  801461:	5e                   	pop    %esi
+  801462:	5f                   	pop    %edi
+  801463:	5d                   	pop    %ebp
+  801464:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801465:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801470:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801475:	89 df                	mov    %ebx,%edi
+  801477:	55                   	push   %ebp
+  801478:	89 e5                	mov    %esp,%ebp
+  80147a:	8d 35 82 14 80 00    	lea    0x801482,%esi
+  801480:	0f 34                	sysenter
+  801482:	5d                   	pop    %ebp
+		goto out;
+  801483:	eb db                	jmp    801460 <sys_ipc_recv_until+0x25>
+
+00801485 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801485:	55                   	push   %ebp
+  801486:	89 e5                	mov    %esp,%ebp
+  801488:	57                   	push   %edi
+  801489:	56                   	push   %esi
+  80148a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80148b:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801492:	74 19                	je     8014ad <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801494:	ba 00 00 00 00       	mov    $0x0,%edx
+  801499:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80149e:	89 d1                	mov    %edx,%ecx
+  8014a0:	89 d3                	mov    %edx,%ebx
+  8014a2:	89 d7                	mov    %edx,%edi
+  8014a4:	89 d6                	mov    %edx,%esi
+  8014a6:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014a8:	5b                   	pop    %ebx
+  8014a9:	5e                   	pop    %esi
+  8014aa:	5f                   	pop    %edi
+  8014ab:	5d                   	pop    %ebp
+  8014ac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014b7:	89 d1                	mov    %edx,%ecx
+  8014b9:	89 d3                	mov    %edx,%ebx
+  8014bb:	89 d7                	mov    %edx,%edi
+  8014bd:	55                   	push   %ebp
+  8014be:	89 e5                	mov    %esp,%ebp
+  8014c0:	8d 35 c8 14 80 00    	lea    0x8014c8,%esi
+  8014c6:	0f 34                	sysenter
+  8014c8:	5d                   	pop    %ebp
+		goto out;
+  8014c9:	eb dd                	jmp    8014a8 <sys_time_msec+0x23>
+
+008014cb <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8014cb:	55                   	push   %ebp
+  8014cc:	89 e5                	mov    %esp,%ebp
+  8014ce:	57                   	push   %edi
+  8014cf:	56                   	push   %esi
+  8014d0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014d1:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8014d8:	74 1a                	je     8014f4 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8014da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014df:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e7:	89 cb                	mov    %ecx,%ebx
+  8014e9:	89 cf                	mov    %ecx,%edi
+  8014eb:	89 ce                	mov    %ecx,%esi
+  8014ed:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5f                   	pop    %edi
+  8014f2:	5d                   	pop    %ebp
+  8014f3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014fc:	b8 10 00 00 00       	mov    $0x10,%eax
+  801501:	89 cb                	mov    %ecx,%ebx
+  801503:	89 cf                	mov    %ecx,%edi
+  801505:	55                   	push   %ebp
+  801506:	89 e5                	mov    %esp,%ebp
+  801508:	8d 35 10 15 80 00    	lea    0x801510,%esi
+  80150e:	0f 34                	sysenter
+  801510:	5d                   	pop    %ebp
+		goto out;
+  801511:	eb dc                	jmp    8014ef <sys_sleep_until+0x24>
+
+00801513 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801513:	55                   	push   %ebp
+  801514:	89 e5                	mov    %esp,%ebp
+  801516:	57                   	push   %edi
+  801517:	56                   	push   %esi
+  801518:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801519:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801520:	74 1a                	je     80153c <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801522:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801527:	b8 11 00 00 00       	mov    $0x11,%eax
+  80152c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152f:	89 cb                	mov    %ecx,%ebx
+  801531:	89 cf                	mov    %ecx,%edi
+  801533:	89 ce                	mov    %ecx,%esi
+  801535:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801537:	5b                   	pop    %ebx
+  801538:	5e                   	pop    %esi
+  801539:	5f                   	pop    %edi
+  80153a:	5d                   	pop    %ebp
+  80153b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80153c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801544:	b8 11 00 00 00       	mov    $0x11,%eax
+  801549:	89 cb                	mov    %ecx,%ebx
+  80154b:	89 cf                	mov    %ecx,%edi
+  80154d:	55                   	push   %ebp
+  80154e:	89 e5                	mov    %esp,%ebp
+  801550:	8d 35 58 15 80 00    	lea    0x801558,%esi
+  801556:	0f 34                	sysenter
+  801558:	5d                   	pop    %ebp
+		goto out;
+  801559:	eb dc                	jmp    801537 <sys_env_print_stats+0x24>
+
+0080155b <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80155b:	55                   	push   %ebp
+  80155c:	89 e5                	mov    %esp,%ebp
+  80155e:	57                   	push   %edi
+  80155f:	56                   	push   %esi
+  801560:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801561:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801568:	74 1b                	je     801585 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80156a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801574:	8b 55 08             	mov    0x8(%ebp),%edx
+  801577:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157a:	89 df                	mov    %ebx,%edi
+  80157c:	89 de                	mov    %ebx,%esi
+  80157e:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801580:	5b                   	pop    %ebx
+  801581:	5e                   	pop    %esi
+  801582:	5f                   	pop    %edi
+  801583:	5d                   	pop    %ebp
+  801584:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801585:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801590:	b8 19 00 00 00       	mov    $0x19,%eax
+  801595:	89 df                	mov    %ebx,%edi
+  801597:	55                   	push   %ebp
+  801598:	89 e5                	mov    %esp,%ebp
+  80159a:	8d 35 a2 15 80 00    	lea    0x8015a2,%esi
+  8015a0:	0f 34                	sysenter
+  8015a2:	5d                   	pop    %ebp
+		goto out;
+  8015a3:	eb db                	jmp    801580 <sys_perf+0x25>
+
+008015a5 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	57                   	push   %edi
+  8015a9:	56                   	push   %esi
+  8015aa:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015ab:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8015b2:	74 19                	je     8015cd <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8015b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015be:	89 d1                	mov    %edx,%ecx
+  8015c0:	89 d3                	mov    %edx,%ebx
+  8015c2:	89 d7                	mov    %edx,%edi
+  8015c4:	89 d6                	mov    %edx,%esi
+  8015c6:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8015c8:	5b                   	pop    %ebx
+  8015c9:	5e                   	pop    %esi
+  8015ca:	5f                   	pop    %edi
+  8015cb:	5d                   	pop    %ebp
+  8015cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015d7:	89 d1                	mov    %edx,%ecx
+  8015d9:	89 d3                	mov    %edx,%ebx
+  8015db:	89 d7                	mov    %edx,%edi
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	8d 35 e8 15 80 00    	lea    0x8015e8,%esi
+  8015e6:	0f 34                	sysenter
+  8015e8:	5d                   	pop    %ebp
+		goto out;
+  8015e9:	eb dd                	jmp    8015c8 <sys_fork+0x23>
+
+008015eb <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	57                   	push   %edi
+  8015ef:	56                   	push   %esi
+  8015f0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015f1:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8015f8:	74 1c                	je     801616 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8015fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ff:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801604:	8b 55 08             	mov    0x8(%ebp),%edx
+  801607:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80160d:	89 f7                	mov    %esi,%edi
+  80160f:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801611:	5b                   	pop    %ebx
+  801612:	5e                   	pop    %esi
+  801613:	5f                   	pop    %edi
+  801614:	5d                   	pop    %ebp
+  801615:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801616:	8b 55 08             	mov    0x8(%ebp),%edx
+  801619:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801621:	bf 00 00 00 00       	mov    $0x0,%edi
+  801626:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	8d 35 34 16 80 00    	lea    0x801634,%esi
+  801632:	0f 34                	sysenter
+  801634:	5d                   	pop    %ebp
+		goto out;
+  801635:	eb da                	jmp    801611 <sys_thread_create+0x26>
+
+00801637 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801637:	55                   	push   %ebp
+  801638:	89 e5                	mov    %esp,%ebp
+  80163a:	57                   	push   %edi
+  80163b:	56                   	push   %esi
+  80163c:	53                   	push   %ebx
+  80163d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801640:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801647:	74 24                	je     80166d <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801649:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80164e:	be 00 00 00 00       	mov    $0x0,%esi
+  801653:	8b 55 08             	mov    0x8(%ebp),%edx
+  801656:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801659:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80165c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80165f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801661:	85 c0                	test   %eax,%eax
+  801663:	7f 27                	jg     80168c <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801665:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801668:	5b                   	pop    %ebx
+  801669:	5e                   	pop    %esi
+  80166a:	5f                   	pop    %edi
+  80166b:	5d                   	pop    %ebp
+  80166c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80166d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801670:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801673:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801678:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80167b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80167e:	55                   	push   %ebp
+  80167f:	89 e5                	mov    %esp,%ebp
+  801681:	8d 35 89 16 80 00    	lea    0x801689,%esi
+  801687:	0f 34                	sysenter
+  801689:	5d                   	pop    %ebp
+		goto out;
+  80168a:	eb d5                	jmp    801661 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80168c:	83 ec 0c             	sub    $0xc,%esp
+  80168f:	50                   	push   %eax
+  801690:	6a 1f                	push   $0x1f
+  801692:	68 fb 31 80 00       	push   $0x8031fb
+  801697:	6a 3f                	push   $0x3f
+  801699:	68 18 32 80 00       	push   $0x803218
+  80169e:	e8 7c ec ff ff       	call   80031f <_panic>
+
+008016a3 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	57                   	push   %edi
+  8016a7:	56                   	push   %esi
+  8016a8:	53                   	push   %ebx
+  8016a9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016ac:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8016b3:	74 23                	je     8016d8 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8016b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ba:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c8:	89 f7                	mov    %esi,%edi
+  8016ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	7f 29                	jg     8016f9 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8016d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d3:	5b                   	pop    %ebx
+  8016d4:	5e                   	pop    %esi
+  8016d5:	5f                   	pop    %edi
+  8016d6:	5d                   	pop    %ebp
+  8016d7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016de:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016eb:	55                   	push   %ebp
+  8016ec:	89 e5                	mov    %esp,%ebp
+  8016ee:	8d 35 f6 16 80 00    	lea    0x8016f6,%esi
+  8016f4:	0f 34                	sysenter
+  8016f6:	5d                   	pop    %ebp
+		goto out;
+  8016f7:	eb d3                	jmp    8016cc <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016f9:	83 ec 0c             	sub    $0xc,%esp
+  8016fc:	50                   	push   %eax
+  8016fd:	6a 20                	push   $0x20
+  8016ff:	68 fb 31 80 00       	push   $0x8031fb
+  801704:	6a 3f                	push   $0x3f
+  801706:	68 18 32 80 00       	push   $0x803218
+  80170b:	e8 0f ec ff ff       	call   80031f <_panic>
+
+00801710 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801710:	55                   	push   %ebp
+  801711:	89 e5                	mov    %esp,%ebp
+  801713:	57                   	push   %edi
+  801714:	56                   	push   %esi
+  801715:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801716:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  80171d:	74 1b                	je     80173a <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80171f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801724:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801729:	8b 55 08             	mov    0x8(%ebp),%edx
+  80172c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80172f:	89 df                	mov    %ebx,%edi
+  801731:	89 de                	mov    %ebx,%esi
+  801733:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801735:	5b                   	pop    %ebx
+  801736:	5e                   	pop    %esi
+  801737:	5f                   	pop    %edi
+  801738:	5d                   	pop    %ebp
+  801739:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80173a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801742:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801745:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80174a:	89 df                	mov    %ebx,%edi
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	8d 35 57 17 80 00    	lea    0x801757,%esi
+  801755:	0f 34                	sysenter
+  801757:	5d                   	pop    %ebp
+		goto out;
+  801758:	eb db                	jmp    801735 <sys_batch+0x25>
+
+0080175a <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80175a:	55                   	push   %ebp
+  80175b:	89 e5                	mov    %esp,%ebp
+  80175d:	57                   	push   %edi
+  80175e:	56                   	push   %esi
+  80175f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801760:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801767:	74 1a                	je     801783 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801769:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80176e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801773:	8b 55 08             	mov    0x8(%ebp),%edx
+  801776:	89 cb                	mov    %ecx,%ebx
+  801778:	89 cf                	mov    %ecx,%edi
+  80177a:	89 ce                	mov    %ecx,%esi
+  80177c:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80177e:	5b                   	pop    %ebx
+  80177f:	5e                   	pop    %esi
+  801780:	5f                   	pop    %edi
+  801781:	5d                   	pop    %ebp
+  801782:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801783:	8b 55 08             	mov    0x8(%ebp),%edx
+  801786:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801790:	89 cb                	mov    %ecx,%ebx
+  801792:	89 cf                	mov    %ecx,%edi
+  801794:	55                   	push   %ebp
+  801795:	89 e5                	mov    %esp,%ebp
+  801797:	8d 35 9f 17 80 00    	lea    0x80179f,%esi
+  80179d:	0f 34                	sysenter
+  80179f:	5d                   	pop    %ebp
+		goto out;
+  8017a0:	eb dc                	jmp    80177e <sys_trace_ctl+0x24>
+
+008017a2 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	57                   	push   %edi
+  8017a6:	56                   	push   %esi
+  8017a7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017a8:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8017af:	74 1c                	je     8017cd <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8017b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8017bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017c4:	89 f7                	mov    %esi,%edi
+  8017c6:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8017c8:	5b                   	pop    %ebx
+  8017c9:	5e                   	pop    %esi
+  8017ca:	5f                   	pop    %edi
+  8017cb:	5d                   	pop    %ebp
+  8017cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8017d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017e0:	55                   	push   %ebp
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	8d 35 eb 17 80 00    	lea    0x8017eb,%esi
+  8017e9:	0f 34                	sysenter
+  8017eb:	5d                   	pop    %ebp
+		goto out;
+  8017ec:	eb da                	jmp    8017c8 <sys_trace_read+0x26>
+
+008017ee <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8017ee:	55                   	push   %ebp
+  8017ef:	89 e5                	mov    %esp,%ebp
+  8017f1:	57                   	push   %edi
+  8017f2:	56                   	push   %esi
+  8017f3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017f4:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8017fb:	74 1c                	je     801819 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8017fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801802:	b8 21 00 00 00       	mov    $0x21,%eax
+  801807:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80180d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801810:	89 f7                	mov    %esi,%edi
+  801812:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801814:	5b                   	pop    %ebx
+  801815:	5e                   	pop    %esi
+  801816:	5f                   	pop    %edi
+  801817:	5d                   	pop    %ebp
+  801818:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801819:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80181f:	b8 21 00 00 00       	mov    $0x21,%eax
+  801824:	bf 00 00 00 00       	mov    $0x0,%edi
+  801829:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80182c:	55                   	push   %ebp
+  80182d:	89 e5                	mov    %esp,%ebp
+  80182f:	8d 35 37 18 80 00    	lea    0x801837,%esi
+  801835:	0f 34                	sysenter
+  801837:	5d                   	pop    %ebp
+		goto out;
+  801838:	eb da                	jmp    801814 <sys_meminfo+0x26>
+
+0080183a <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80183a:	55                   	push   %ebp
+  80183b:	89 e5                	mov    %esp,%ebp
+  80183d:	57                   	push   %edi
+  80183e:	56                   	push   %esi
+  80183f:	53                   	push   %ebx
+  801840:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801843:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801847:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  80184e:	74 1f                	je     80186f <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801850:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801855:	b8 22 00 00 00       	mov    $0x22,%eax
+  80185a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185d:	89 df                	mov    %ebx,%edi
+  80185f:	89 de                	mov    %ebx,%esi
+  801861:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801863:	85 c0                	test   %eax,%eax
+  801865:	7f 25                	jg     80188c <sys_env_set_ksm+0x52>
+}
+  801867:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80186a:	5b                   	pop    %ebx
+  80186b:	5e                   	pop    %esi
+  80186c:	5f                   	pop    %edi
+  80186d:	5d                   	pop    %ebp
+  80186e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80186f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801874:	8b 55 08             	mov    0x8(%ebp),%edx
+  801877:	b8 22 00 00 00       	mov    $0x22,%eax
+  80187c:	89 df                	mov    %ebx,%edi
+  80187e:	55                   	push   %ebp
+  80187f:	89 e5                	mov    %esp,%ebp
+  801881:	8d 35 89 18 80 00    	lea    0x801889,%esi
+  801887:	0f 34                	sysenter
+  801889:	5d                   	pop    %ebp
+		goto out;
+  80188a:	eb d7                	jmp    801863 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80188c:	83 ec 0c             	sub    $0xc,%esp
+  80188f:	50                   	push   %eax
+  801890:	6a 22                	push   $0x22
+  801892:	68 fb 31 80 00       	push   $0x8031fb
+  801897:	6a 3f                	push   $0x3f
+  801899:	68 18 32 80 00       	push   $0x803218
+  80189e:	e8 7c ea ff ff       	call   80031f <_panic>
+
+008018a3 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8018a3:	55                   	push   %ebp
+  8018a4:	89 e5                	mov    %esp,%ebp
+  8018a6:	57                   	push   %edi
+  8018a7:	56                   	push   %esi
+  8018a8:	53                   	push   %ebx
+  8018a9:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8018ac:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8018af:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8018b6:	74 24                	je     8018dc <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8018b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8018c2:	89 cb                	mov    %ecx,%ebx
+  8018c4:	89 cf                	mov    %ecx,%edi
+  8018c6:	89 ce                	mov    %ecx,%esi
+  8018c8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018ca:	85 c0                	test   %eax,%eax
+  8018cc:	7f 2a                	jg     8018f8 <sys_time_nsec+0x55>
+	return ns;
+}
+  8018ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8018d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d7:	5b                   	pop    %ebx
+  8018d8:	5e                   	pop    %esi
+  8018d9:	5f                   	pop    %edi
+  8018da:	5d                   	pop    %ebp
+  8018db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8018e6:	89 cb                	mov    %ecx,%ebx
+  8018e8:	89 cf                	mov    %ecx,%edi
+  8018ea:	55                   	push   %ebp
+  8018eb:	89 e5                	mov    %esp,%ebp
+  8018ed:	8d 35 f5 18 80 00    	lea    0x8018f5,%esi
+  8018f3:	0f 34                	sysenter
+  8018f5:	5d                   	pop    %ebp
+		goto out;
+  8018f6:	eb d2                	jmp    8018ca <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018f8:	83 ec 0c             	sub    $0xc,%esp
+  8018fb:	50                   	push   %eax
+  8018fc:	6a 0f                	push   $0xf
+  8018fe:	68 fb 31 80 00       	push   $0x8031fb
+  801903:	6a 3f                	push   $0x3f
+  801905:	68 18 32 80 00       	push   $0x803218
+  80190a:	e8 10 ea ff ff       	call   80031f <_panic>
+
+0080190f <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80190f:	55                   	push   %ebp
+  801910:	89 e5                	mov    %esp,%ebp
+  801912:	57                   	push   %edi
+  801913:	56                   	push   %esi
+  801914:	53                   	push   %ebx
+  801915:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801918:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  80191f:	74 22                	je     801943 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801921:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801926:	b8 12 00 00 00       	mov    $0x12,%eax
+  80192b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80192e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801931:	89 df                	mov    %ebx,%edi
+  801933:	89 de                	mov    %ebx,%esi
+  801935:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801937:	85 c0                	test   %eax,%eax
+  801939:	7f 28                	jg     801963 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80193b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193e:	5b                   	pop    %ebx
+  80193f:	5e                   	pop    %esi
+  801940:	5f                   	pop    %edi
+  801941:	5d                   	pop    %ebp
+  801942:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801943:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801948:	8b 55 08             	mov    0x8(%ebp),%edx
+  80194b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801953:	89 df                	mov    %ebx,%edi
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	8d 35 60 19 80 00    	lea    0x801960,%esi
+  80195e:	0f 34                	sysenter
+  801960:	5d                   	pop    %ebp
+		goto out;
+  801961:	eb d4                	jmp    801937 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801963:	83 ec 0c             	sub    $0xc,%esp
+  801966:	50                   	push   %eax
+  801967:	6a 12                	push   $0x12
+  801969:	68 fb 31 80 00       	push   $0x8031fb
+  80196e:	6a 3f                	push   $0x3f
+  801970:	68 18 32 80 00       	push   $0x803218
+  801975:	e8 a5 e9 ff ff       	call   80031f <_panic>
+
+0080197a <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80197a:	55                   	push   %ebp
+  80197b:	89 e5                	mov    %esp,%ebp
+  80197d:	57                   	push   %edi
+  80197e:	56                   	push   %esi
+  80197f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801980:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801987:	74 1b                	je     8019a4 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801989:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801993:	8b 55 08             	mov    0x8(%ebp),%edx
+  801996:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801999:	89 df                	mov    %ebx,%edi
+  80199b:	89 de                	mov    %ebx,%esi
+  80199d:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80199f:	5b                   	pop    %ebx
+  8019a0:	5e                   	pop    %esi
+  8019a1:	5f                   	pop    %edi
+  8019a2:	5d                   	pop    %ebp
+  8019a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019af:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019b4:	89 df                	mov    %ebx,%edi
+  8019b6:	55                   	push   %ebp
+  8019b7:	89 e5                	mov    %esp,%ebp
+  8019b9:	8d 35 c1 19 80 00    	lea    0x8019c1,%esi
+  8019bf:	0f 34                	sysenter
+  8019c1:	5d                   	pop    %ebp
+		goto out;
+  8019c2:	eb db                	jmp    80199f <sys_e1000_receive+0x25>
+
+008019c4 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	57                   	push   %edi
+  8019c8:	56                   	push   %esi
+  8019c9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019ca:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  8019d1:	74 1b                	je     8019ee <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8019d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d8:	b8 14 00 00 00       	mov    $0x14,%eax
+  8019dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019e3:	89 df                	mov    %ebx,%edi
+  8019e5:	89 de                	mov    %ebx,%esi
+  8019e7:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8019e9:	5b                   	pop    %ebx
+  8019ea:	5e                   	pop    %esi
+  8019eb:	5f                   	pop    %edi
+  8019ec:	5d                   	pop    %ebp
+  8019ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8019fe:	89 df                	mov    %ebx,%edi
+  801a00:	55                   	push   %ebp
+  801a01:	89 e5                	mov    %esp,%ebp
+  801a03:	8d 35 0b 1a 80 00    	lea    0x801a0b,%esi
+  801a09:	0f 34                	sysenter
+  801a0b:	5d                   	pop    %ebp
+		goto out;
+  801a0c:	eb db                	jmp    8019e9 <sys_e1000_read_hwaddr+0x25>
+
+00801a0e <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801a0e:	55                   	push   %ebp
+  801a0f:	89 e5                	mov    %esp,%ebp
+  801a11:	57                   	push   %edi
+  801a12:	56                   	push   %esi
+  801a13:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a14:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801a1b:	74 1a                	je     801a37 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801a1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a22:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a27:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a2a:	89 cb                	mov    %ecx,%ebx
+  801a2c:	89 cf                	mov    %ecx,%edi
+  801a2e:	89 ce                	mov    %ecx,%esi
+  801a30:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801a32:	5b                   	pop    %ebx
+  801a33:	5e                   	pop    %esi
+  801a34:	5f                   	pop    %edi
+  801a35:	5d                   	pop    %ebp
+  801a36:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a37:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a3f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a44:	89 cb                	mov    %ecx,%ebx
+  801a46:	89 cf                	mov    %ecx,%edi
+  801a48:	55                   	push   %ebp
+  801a49:	89 e5                	mov    %esp,%ebp
+  801a4b:	8d 35 53 1a 80 00    	lea    0x801a53,%esi
+  801a51:	0f 34                	sysenter
+  801a53:	5d                   	pop    %ebp
+		goto out;
+  801a54:	eb dc                	jmp    801a32 <sys_sb16_read_version+0x24>
+
+00801a56 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	57                   	push   %edi
+  801a5a:	56                   	push   %esi
+  801a5b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a5c:	80 3d 0c 54 80 00 00 	cmpb   $0x0,0x80540c
+  801a63:	74 1b                	je     801a80 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801a65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6a:	b8 16 00 00 00       	mov    $0x16,%eax
+  801a6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a75:	89 df                	mov    %ebx,%edi
+  801a77:	89 de                	mov    %ebx,%esi
+  801a79:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801a7b:	5b                   	pop    %ebx
+  801a7c:	5e                   	pop    %esi
+  801a7d:	5f                   	pop    %edi
+  801a7e:	5d                   	pop    %ebp
+  801a7f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a85:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a8b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801a90:	89 df                	mov    %ebx,%edi
+  801a92:	55                   	push   %ebp
+  801a93:	89 e5                	mov    %esp,%ebp
+  801a95:	8d 35 9d 1a 80 00    	lea    0x801a9d,%esi
+  801a9b:	0f 34                	sysenter
+  801a9d:	5d                   	pop    %ebp
+		goto out;
+  801a9e:	eb db                	jmp    801a7b <sys_sb16_play+0x25>
+
+00801aa0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801aa0:	55                   	push   %ebp
+  801aa1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa6:	05 00 00 00 30       	add    $0x30000000,%eax
+  801aab:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801aae:	5d                   	pop    %ebp
+  801aaf:	c3                   	ret
+
+00801ab0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ab3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab6:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801abb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ac0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801ac5:	5d                   	pop    %ebp
+  801ac6:	c3                   	ret
+
+00801ac7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801aca:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801acf:	eb 02                	jmp    801ad3 <fd_alloc+0xc>
+  801ad1:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801ad3:	89 c2                	mov    %eax,%edx
+  801ad5:	c1 ea 16             	shr    $0x16,%edx
+  801ad8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801adf:	f6 c2 01             	test   $0x1,%dl
+  801ae2:	74 2b                	je     801b0f <fd_alloc+0x48>
+  801ae4:	89 c2                	mov    %eax,%edx
+  801ae6:	c1 ea 0c             	shr    $0xc,%edx
+  801ae9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801af0:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801af6:	f6 c1 01             	test   $0x1,%cl
+  801af9:	74 14                	je     801b0f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801afb:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801b01:	75 ce                	jne    801ad1 <fd_alloc+0xa>
+  801b03:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801b08:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b0d:	eb 05                	jmp    801b14 <fd_alloc+0x4d>
+			return 0;
+  801b0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801b14:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b17:	89 02                	mov    %eax,(%edx)
+}
+  801b19:	89 c8                	mov    %ecx,%eax
+  801b1b:	5d                   	pop    %ebp
+  801b1c:	c3                   	ret
+
+00801b1d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801b1d:	55                   	push   %ebp
+  801b1e:	89 e5                	mov    %esp,%ebp
+  801b20:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801b23:	83 f8 1f             	cmp    $0x1f,%eax
+  801b26:	77 30                	ja     801b58 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801b28:	c1 e0 0c             	shl    $0xc,%eax
+  801b2b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801b30:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b36:	f6 c2 01             	test   $0x1,%dl
+  801b39:	74 24                	je     801b5f <fd_lookup+0x42>
+  801b3b:	89 c2                	mov    %eax,%edx
+  801b3d:	c1 ea 0c             	shr    $0xc,%edx
+  801b40:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b47:	f6 c2 01             	test   $0x1,%dl
+  801b4a:	74 1a                	je     801b66 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b4f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b56:	5d                   	pop    %ebp
+  801b57:	c3                   	ret
+		return -E_INVAL;
+  801b58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b5d:	eb f7                	jmp    801b56 <fd_lookup+0x39>
+		return -E_INVAL;
+  801b5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b64:	eb f0                	jmp    801b56 <fd_lookup+0x39>
+  801b66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b6b:	eb e9                	jmp    801b56 <fd_lookup+0x39>
+
+00801b6d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b6d:	55                   	push   %ebp
+  801b6e:	89 e5                	mov    %esp,%ebp
+  801b70:	53                   	push   %ebx
+  801b71:	83 ec 04             	sub    $0x4,%esp
+  801b74:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7c:	eb 03                	jmp    801b81 <dev_lookup+0x14>
+  801b7e:	83 c0 01             	add    $0x1,%eax
+  801b81:	8b 1c 85 a4 32 80 00 	mov    0x8032a4(,%eax,4),%ebx
+  801b88:	85 db                	test   %ebx,%ebx
+  801b8a:	74 0b                	je     801b97 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801b8c:	39 13                	cmp    %edx,(%ebx)
+  801b8e:	75 ee                	jne    801b7e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b95:	eb 2e                	jmp    801bc5 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801b97:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b99:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801b9e:	8b 0d 08 54 80 00    	mov    0x805408,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ba4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ba9:	76 24                	jbe    801bcf <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bab:	8b 41 48             	mov    0x48(%ecx),%eax
+  801bae:	83 ec 04             	sub    $0x4,%esp
+  801bb1:	52                   	push   %edx
+  801bb2:	50                   	push   %eax
+  801bb3:	68 28 32 80 00       	push   $0x803228
+  801bb8:	e8 3d e8 ff ff       	call   8003fa <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801bbd:	83 c4 10             	add    $0x10,%esp
+  801bc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801bc5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bc8:	89 1a                	mov    %ebx,(%edx)
+}
+  801bca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bcd:	c9                   	leave
+  801bce:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801bcf:	c1 e8 10             	shr    $0x10,%eax
+  801bd2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801bd8:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801bde:	eb cb                	jmp    801bab <dev_lookup+0x3e>
+
+00801be0 <fd_close>:
+{
+  801be0:	55                   	push   %ebp
+  801be1:	89 e5                	mov    %esp,%ebp
+  801be3:	57                   	push   %edi
+  801be4:	56                   	push   %esi
+  801be5:	53                   	push   %ebx
+  801be6:	83 ec 24             	sub    $0x24,%esp
+  801be9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801bef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bf2:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bf3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801bf9:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801bfc:	50                   	push   %eax
+  801bfd:	e8 1b ff ff ff       	call   801b1d <fd_lookup>
+  801c02:	89 c3                	mov    %eax,%ebx
+  801c04:	83 c4 10             	add    $0x10,%esp
+  801c07:	85 c0                	test   %eax,%eax
+  801c09:	78 05                	js     801c10 <fd_close+0x30>
+	    || fd != fd2)
+  801c0b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c0e:	74 16                	je     801c26 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801c10:	89 f8                	mov    %edi,%eax
+  801c12:	84 c0                	test   %al,%al
+  801c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c19:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801c1c:	89 d8                	mov    %ebx,%eax
+  801c1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c21:	5b                   	pop    %ebx
+  801c22:	5e                   	pop    %esi
+  801c23:	5f                   	pop    %edi
+  801c24:	5d                   	pop    %ebp
+  801c25:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c26:	83 ec 08             	sub    $0x8,%esp
+  801c29:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c2c:	50                   	push   %eax
+  801c2d:	ff 36                	push   (%esi)
+  801c2f:	e8 39 ff ff ff       	call   801b6d <dev_lookup>
+  801c34:	89 c3                	mov    %eax,%ebx
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	78 1a                	js     801c57 <fd_close+0x77>
+		if (dev->dev_close)
+  801c3d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c40:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801c43:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801c48:	85 c0                	test   %eax,%eax
+  801c4a:	74 0b                	je     801c57 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801c4c:	83 ec 0c             	sub    $0xc,%esp
+  801c4f:	56                   	push   %esi
+  801c50:	ff d0                	call   *%eax
+  801c52:	89 c3                	mov    %eax,%ebx
+  801c54:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801c57:	83 ec 08             	sub    $0x8,%esp
+  801c5a:	56                   	push   %esi
+  801c5b:	6a 00                	push   $0x0
+  801c5d:	e8 a3 f4 ff ff       	call   801105 <sys_page_unmap>
+	return r;
+  801c62:	83 c4 10             	add    $0x10,%esp
+  801c65:	eb b5                	jmp    801c1c <fd_close+0x3c>
+
+00801c67 <close>:
+
+int
+close(int fdnum)
+{
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c6d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c70:	50                   	push   %eax
+  801c71:	ff 75 08             	push   0x8(%ebp)
+  801c74:	e8 a4 fe ff ff       	call   801b1d <fd_lookup>
+  801c79:	83 c4 10             	add    $0x10,%esp
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	79 02                	jns    801c82 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c80:	c9                   	leave
+  801c81:	c3                   	ret
+		return fd_close(fd, 1);
+  801c82:	83 ec 08             	sub    $0x8,%esp
+  801c85:	6a 01                	push   $0x1
+  801c87:	ff 75 f4             	push   -0xc(%ebp)
+  801c8a:	e8 51 ff ff ff       	call   801be0 <fd_close>
+  801c8f:	83 c4 10             	add    $0x10,%esp
+  801c92:	eb ec                	jmp    801c80 <close+0x19>
+
+00801c94 <close_all>:
+
+void
+close_all(void)
+{
+  801c94:	55                   	push   %ebp
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	53                   	push   %ebx
+  801c98:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801ca0:	83 ec 0c             	sub    $0xc,%esp
+  801ca3:	53                   	push   %ebx
+  801ca4:	e8 be ff ff ff       	call   801c67 <close>
+	for (i = 0; i < MAXFD; i++)
+  801ca9:	83 c3 01             	add    $0x1,%ebx
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	83 fb 20             	cmp    $0x20,%ebx
+  801cb2:	75 ec                	jne    801ca0 <close_all+0xc>
+}
+  801cb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb7:	c9                   	leave
+  801cb8:	c3                   	ret
+
+00801cb9 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801cb9:	55                   	push   %ebp
+  801cba:	89 e5                	mov    %esp,%ebp
+  801cbc:	57                   	push   %edi
+  801cbd:	56                   	push   %esi
+  801cbe:	53                   	push   %ebx
+  801cbf:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801cc2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cc5:	50                   	push   %eax
+  801cc6:	ff 75 08             	push   0x8(%ebp)
+  801cc9:	e8 4f fe ff ff       	call   801b1d <fd_lookup>
+  801cce:	89 c3                	mov    %eax,%ebx
+  801cd0:	83 c4 10             	add    $0x10,%esp
+  801cd3:	85 c0                	test   %eax,%eax
+  801cd5:	78 7f                	js     801d56 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801cd7:	83 ec 0c             	sub    $0xc,%esp
+  801cda:	ff 75 0c             	push   0xc(%ebp)
+  801cdd:	e8 85 ff ff ff       	call   801c67 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801ce2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801ce5:	c1 e6 0c             	shl    $0xc,%esi
+  801ce8:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801cee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801cf1:	89 3c 24             	mov    %edi,(%esp)
+  801cf4:	e8 b7 fd ff ff       	call   801ab0 <fd2data>
+  801cf9:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801cfb:	89 34 24             	mov    %esi,(%esp)
+  801cfe:	e8 ad fd ff ff       	call   801ab0 <fd2data>
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801d09:	89 d8                	mov    %ebx,%eax
+  801d0b:	c1 e8 16             	shr    $0x16,%eax
+  801d0e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d15:	a8 01                	test   $0x1,%al
+  801d17:	74 11                	je     801d2a <dup+0x71>
+  801d19:	89 d8                	mov    %ebx,%eax
+  801d1b:	c1 e8 0c             	shr    $0xc,%eax
+  801d1e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d25:	f6 c2 01             	test   $0x1,%dl
+  801d28:	75 36                	jne    801d60 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d2a:	89 f8                	mov    %edi,%eax
+  801d2c:	c1 e8 0c             	shr    $0xc,%eax
+  801d2f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d36:	83 ec 0c             	sub    $0xc,%esp
+  801d39:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d3e:	50                   	push   %eax
+  801d3f:	56                   	push   %esi
+  801d40:	6a 00                	push   $0x0
+  801d42:	57                   	push   %edi
+  801d43:	6a 00                	push   $0x0
+  801d45:	e8 4d f3 ff ff       	call   801097 <sys_page_map>
+  801d4a:	89 c3                	mov    %eax,%ebx
+  801d4c:	83 c4 20             	add    $0x20,%esp
+  801d4f:	85 c0                	test   %eax,%eax
+  801d51:	78 33                	js     801d86 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801d53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801d56:	89 d8                	mov    %ebx,%eax
+  801d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5b:	5b                   	pop    %ebx
+  801d5c:	5e                   	pop    %esi
+  801d5d:	5f                   	pop    %edi
+  801d5e:	5d                   	pop    %ebp
+  801d5f:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801d60:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d67:	83 ec 0c             	sub    $0xc,%esp
+  801d6a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d6f:	50                   	push   %eax
+  801d70:	ff 75 d4             	push   -0x2c(%ebp)
+  801d73:	6a 00                	push   $0x0
+  801d75:	53                   	push   %ebx
+  801d76:	6a 00                	push   $0x0
+  801d78:	e8 1a f3 ff ff       	call   801097 <sys_page_map>
+  801d7d:	89 c3                	mov    %eax,%ebx
+  801d7f:	83 c4 20             	add    $0x20,%esp
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	79 a4                	jns    801d2a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d86:	83 ec 08             	sub    $0x8,%esp
+  801d89:	56                   	push   %esi
+  801d8a:	6a 00                	push   $0x0
+  801d8c:	e8 74 f3 ff ff       	call   801105 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d91:	83 c4 08             	add    $0x8,%esp
+  801d94:	ff 75 d4             	push   -0x2c(%ebp)
+  801d97:	6a 00                	push   $0x0
+  801d99:	e8 67 f3 ff ff       	call   801105 <sys_page_unmap>
+	return r;
+  801d9e:	83 c4 10             	add    $0x10,%esp
+  801da1:	eb b3                	jmp    801d56 <dup+0x9d>
+
+00801da3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801da3:	55                   	push   %ebp
+  801da4:	89 e5                	mov    %esp,%ebp
+  801da6:	56                   	push   %esi
+  801da7:	53                   	push   %ebx
+  801da8:	83 ec 18             	sub    $0x18,%esp
+  801dab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801db1:	50                   	push   %eax
+  801db2:	53                   	push   %ebx
+  801db3:	e8 65 fd ff ff       	call   801b1d <fd_lookup>
+  801db8:	83 c4 10             	add    $0x10,%esp
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 3c                	js     801dfb <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dbf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dc2:	83 ec 08             	sub    $0x8,%esp
+  801dc5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dc8:	50                   	push   %eax
+  801dc9:	ff 36                	push   (%esi)
+  801dcb:	e8 9d fd ff ff       	call   801b6d <dev_lookup>
+  801dd0:	83 c4 10             	add    $0x10,%esp
+  801dd3:	85 c0                	test   %eax,%eax
+  801dd5:	78 24                	js     801dfb <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dd7:	8b 46 08             	mov    0x8(%esi),%eax
+  801dda:	83 e0 03             	and    $0x3,%eax
+  801ddd:	83 f8 01             	cmp    $0x1,%eax
+  801de0:	74 20                	je     801e02 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801de2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de5:	8b 40 08             	mov    0x8(%eax),%eax
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	74 57                	je     801e43 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801dec:	83 ec 04             	sub    $0x4,%esp
+  801def:	ff 75 10             	push   0x10(%ebp)
+  801df2:	ff 75 0c             	push   0xc(%ebp)
+  801df5:	56                   	push   %esi
+  801df6:	ff d0                	call   *%eax
+  801df8:	83 c4 10             	add    $0x10,%esp
+}
+  801dfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfe:	5b                   	pop    %ebx
+  801dff:	5e                   	pop    %esi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+  801e02:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e04:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e09:	8b 15 08 54 80 00    	mov    0x805408,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e0f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e14:	76 1c                	jbe    801e32 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e16:	8b 42 48             	mov    0x48(%edx),%eax
+  801e19:	83 ec 04             	sub    $0x4,%esp
+  801e1c:	53                   	push   %ebx
+  801e1d:	50                   	push   %eax
+  801e1e:	68 69 32 80 00       	push   $0x803269
+  801e23:	e8 d2 e5 ff ff       	call   8003fa <cprintf>
+		return -E_INVAL;
+  801e28:	83 c4 10             	add    $0x10,%esp
+  801e2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e30:	eb c9                	jmp    801dfb <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e32:	c1 e8 10             	shr    $0x10,%eax
+  801e35:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e3b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e41:	eb d3                	jmp    801e16 <read+0x73>
+		return -E_NOT_SUPP;
+  801e43:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e48:	eb b1                	jmp    801dfb <read+0x58>
+
+00801e4a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e4a:	55                   	push   %ebp
+  801e4b:	89 e5                	mov    %esp,%ebp
+  801e4d:	57                   	push   %edi
+  801e4e:	56                   	push   %esi
+  801e4f:	53                   	push   %ebx
+  801e50:	83 ec 0c             	sub    $0xc,%esp
+  801e53:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e56:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801e59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e5e:	eb 02                	jmp    801e62 <readn+0x18>
+  801e60:	01 c3                	add    %eax,%ebx
+  801e62:	39 f3                	cmp    %esi,%ebx
+  801e64:	73 21                	jae    801e87 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e66:	83 ec 04             	sub    $0x4,%esp
+  801e69:	89 f0                	mov    %esi,%eax
+  801e6b:	29 d8                	sub    %ebx,%eax
+  801e6d:	50                   	push   %eax
+  801e6e:	89 d8                	mov    %ebx,%eax
+  801e70:	03 45 0c             	add    0xc(%ebp),%eax
+  801e73:	50                   	push   %eax
+  801e74:	57                   	push   %edi
+  801e75:	e8 29 ff ff ff       	call   801da3 <read>
+		if (m < 0)
+  801e7a:	83 c4 10             	add    $0x10,%esp
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	78 04                	js     801e85 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801e81:	75 dd                	jne    801e60 <readn+0x16>
+  801e83:	eb 02                	jmp    801e87 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e85:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801e87:	89 d8                	mov    %ebx,%eax
+  801e89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e8c:	5b                   	pop    %ebx
+  801e8d:	5e                   	pop    %esi
+  801e8e:	5f                   	pop    %edi
+  801e8f:	5d                   	pop    %ebp
+  801e90:	c3                   	ret
+
+00801e91 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e91:	55                   	push   %ebp
+  801e92:	89 e5                	mov    %esp,%ebp
+  801e94:	56                   	push   %esi
+  801e95:	53                   	push   %ebx
+  801e96:	83 ec 18             	sub    $0x18,%esp
+  801e99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e9c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e9f:	50                   	push   %eax
+  801ea0:	53                   	push   %ebx
+  801ea1:	e8 77 fc ff ff       	call   801b1d <fd_lookup>
+  801ea6:	83 c4 10             	add    $0x10,%esp
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	78 37                	js     801ee4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ead:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801eb0:	83 ec 08             	sub    $0x8,%esp
+  801eb3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb6:	50                   	push   %eax
+  801eb7:	ff 36                	push   (%esi)
+  801eb9:	e8 af fc ff ff       	call   801b6d <dev_lookup>
+  801ebe:	83 c4 10             	add    $0x10,%esp
+  801ec1:	85 c0                	test   %eax,%eax
+  801ec3:	78 1f                	js     801ee4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ec5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ec9:	74 20                	je     801eeb <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ecb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ece:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ed1:	85 c0                	test   %eax,%eax
+  801ed3:	74 57                	je     801f2c <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801ed5:	83 ec 04             	sub    $0x4,%esp
+  801ed8:	ff 75 10             	push   0x10(%ebp)
+  801edb:	ff 75 0c             	push   0xc(%ebp)
+  801ede:	56                   	push   %esi
+  801edf:	ff d0                	call   *%eax
+  801ee1:	83 c4 10             	add    $0x10,%esp
+}
+  801ee4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee7:	5b                   	pop    %ebx
+  801ee8:	5e                   	pop    %esi
+  801ee9:	5d                   	pop    %ebp
+  801eea:	c3                   	ret
+  801eeb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801eed:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ef2:	8b 15 08 54 80 00    	mov    0x805408,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ef8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801efd:	76 1c                	jbe    801f1b <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eff:	8b 42 48             	mov    0x48(%edx),%eax
+  801f02:	83 ec 04             	sub    $0x4,%esp
+  801f05:	53                   	push   %ebx
+  801f06:	50                   	push   %eax
+  801f07:	68 85 32 80 00       	push   $0x803285
+  801f0c:	e8 e9 e4 ff ff       	call   8003fa <cprintf>
+		return -E_INVAL;
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f19:	eb c9                	jmp    801ee4 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801f1b:	c1 e8 10             	shr    $0x10,%eax
+  801f1e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f24:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f2a:	eb d3                	jmp    801eff <write+0x6e>
+		return -E_NOT_SUPP;
+  801f2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f31:	eb b1                	jmp    801ee4 <write+0x53>
+
+00801f33 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801f33:	55                   	push   %ebp
+  801f34:	89 e5                	mov    %esp,%ebp
+  801f36:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f3c:	50                   	push   %eax
+  801f3d:	ff 75 08             	push   0x8(%ebp)
+  801f40:	e8 d8 fb ff ff       	call   801b1d <fd_lookup>
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 0e                	js     801f5a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801f4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f52:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801f55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f5a:	c9                   	leave
+  801f5b:	c3                   	ret
+
+00801f5c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801f5c:	55                   	push   %ebp
+  801f5d:	89 e5                	mov    %esp,%ebp
+  801f5f:	56                   	push   %esi
+  801f60:	53                   	push   %ebx
+  801f61:	83 ec 18             	sub    $0x18,%esp
+  801f64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f67:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f6a:	50                   	push   %eax
+  801f6b:	53                   	push   %ebx
+  801f6c:	e8 ac fb ff ff       	call   801b1d <fd_lookup>
+  801f71:	83 c4 10             	add    $0x10,%esp
+  801f74:	85 c0                	test   %eax,%eax
+  801f76:	78 34                	js     801fac <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f78:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f7b:	83 ec 08             	sub    $0x8,%esp
+  801f7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f81:	50                   	push   %eax
+  801f82:	ff 36                	push   (%esi)
+  801f84:	e8 e4 fb ff ff       	call   801b6d <dev_lookup>
+  801f89:	83 c4 10             	add    $0x10,%esp
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	78 1c                	js     801fac <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f90:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f94:	74 1d                	je     801fb3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801f96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f99:	8b 40 18             	mov    0x18(%eax),%eax
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	74 54                	je     801ff4 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801fa0:	83 ec 08             	sub    $0x8,%esp
+  801fa3:	ff 75 0c             	push   0xc(%ebp)
+  801fa6:	56                   	push   %esi
+  801fa7:	ff d0                	call   *%eax
+  801fa9:	83 c4 10             	add    $0x10,%esp
+}
+  801fac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801faf:	5b                   	pop    %ebx
+  801fb0:	5e                   	pop    %esi
+  801fb1:	5d                   	pop    %ebp
+  801fb2:	c3                   	ret
+  801fb3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fb5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801fba:	8b 15 08 54 80 00    	mov    0x805408,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fc0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801fc5:	76 1c                	jbe    801fe3 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801fc7:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fca:	83 ec 04             	sub    $0x4,%esp
+  801fcd:	53                   	push   %ebx
+  801fce:	50                   	push   %eax
+  801fcf:	68 48 32 80 00       	push   $0x803248
+  801fd4:	e8 21 e4 ff ff       	call   8003fa <cprintf>
+		return -E_INVAL;
+  801fd9:	83 c4 10             	add    $0x10,%esp
+  801fdc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe1:	eb c9                	jmp    801fac <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801fe3:	c1 e8 10             	shr    $0x10,%eax
+  801fe6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801fec:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ff2:	eb d3                	jmp    801fc7 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801ff4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ff9:	eb b1                	jmp    801fac <ftruncate+0x50>
+
+00801ffb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ffb:	55                   	push   %ebp
+  801ffc:	89 e5                	mov    %esp,%ebp
+  801ffe:	56                   	push   %esi
+  801fff:	53                   	push   %ebx
+  802000:	83 ec 18             	sub    $0x18,%esp
+  802003:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802006:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802009:	50                   	push   %eax
+  80200a:	ff 75 08             	push   0x8(%ebp)
+  80200d:	e8 0b fb ff ff       	call   801b1d <fd_lookup>
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	85 c0                	test   %eax,%eax
+  802017:	78 49                	js     802062 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802019:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80201c:	83 ec 08             	sub    $0x8,%esp
+  80201f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802022:	50                   	push   %eax
+  802023:	ff 36                	push   (%esi)
+  802025:	e8 43 fb ff ff       	call   801b6d <dev_lookup>
+  80202a:	83 c4 10             	add    $0x10,%esp
+  80202d:	85 c0                	test   %eax,%eax
+  80202f:	78 31                	js     802062 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802031:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802034:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802038:	74 2f                	je     802069 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80203a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80203d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802044:	00 00 00 
+	stat->st_isdir = 0;
+  802047:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80204e:	00 00 00 
+	stat->st_dev = dev;
+  802051:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802057:	83 ec 08             	sub    $0x8,%esp
+  80205a:	53                   	push   %ebx
+  80205b:	56                   	push   %esi
+  80205c:	ff 50 14             	call   *0x14(%eax)
+  80205f:	83 c4 10             	add    $0x10,%esp
+}
+  802062:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802065:	5b                   	pop    %ebx
+  802066:	5e                   	pop    %esi
+  802067:	5d                   	pop    %ebp
+  802068:	c3                   	ret
+		return -E_NOT_SUPP;
+  802069:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80206e:	eb f2                	jmp    802062 <fstat+0x67>
+
+00802070 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	56                   	push   %esi
+  802074:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802075:	83 ec 08             	sub    $0x8,%esp
+  802078:	6a 00                	push   $0x0
+  80207a:	ff 75 08             	push   0x8(%ebp)
+  80207d:	e8 e4 01 00 00       	call   802266 <open>
+  802082:	89 c3                	mov    %eax,%ebx
+  802084:	83 c4 10             	add    $0x10,%esp
+  802087:	85 c0                	test   %eax,%eax
+  802089:	78 1b                	js     8020a6 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80208b:	83 ec 08             	sub    $0x8,%esp
+  80208e:	ff 75 0c             	push   0xc(%ebp)
+  802091:	50                   	push   %eax
+  802092:	e8 64 ff ff ff       	call   801ffb <fstat>
+  802097:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802099:	89 1c 24             	mov    %ebx,(%esp)
+  80209c:	e8 c6 fb ff ff       	call   801c67 <close>
+	return r;
+  8020a1:	83 c4 10             	add    $0x10,%esp
+  8020a4:	89 f3                	mov    %esi,%ebx
+}
+  8020a6:	89 d8                	mov    %ebx,%eax
+  8020a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ab:	5b                   	pop    %ebx
+  8020ac:	5e                   	pop    %esi
+  8020ad:	5d                   	pop    %ebp
+  8020ae:	c3                   	ret
+
+008020af <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8020af:	55                   	push   %ebp
+  8020b0:	89 e5                	mov    %esp,%ebp
+  8020b2:	56                   	push   %esi
+  8020b3:	53                   	push   %ebx
+  8020b4:	89 c6                	mov    %eax,%esi
+  8020b6:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8020b8:	83 3d 00 54 80 00 00 	cmpl   $0x0,0x805400
+  8020bf:	74 27                	je     8020e8 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8020c1:	6a 07                	push   $0x7
+  8020c3:	68 00 60 80 00       	push   $0x806000
+  8020c8:	56                   	push   %esi
+  8020c9:	ff 35 00 54 80 00    	push   0x805400
+  8020cf:	e8 52 0c 00 00       	call   802d26 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8020d4:	83 c4 0c             	add    $0xc,%esp
+  8020d7:	6a 00                	push   $0x0
+  8020d9:	53                   	push   %ebx
+  8020da:	6a 00                	push   $0x0
+  8020dc:	e8 2d 0c 00 00       	call   802d0e <ipc_recv>
+}
+  8020e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e4:	5b                   	pop    %ebx
+  8020e5:	5e                   	pop    %esi
+  8020e6:	5d                   	pop    %ebp
+  8020e7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020e8:	83 ec 0c             	sub    $0xc,%esp
+  8020eb:	6a 01                	push   $0x1
+  8020ed:	e8 88 0c 00 00       	call   802d7a <ipc_find_env>
+  8020f2:	a3 00 54 80 00       	mov    %eax,0x805400
+  8020f7:	83 c4 10             	add    $0x10,%esp
+  8020fa:	eb c5                	jmp    8020c1 <fsipc+0x12>
+
+008020fc <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8020fc:	55                   	push   %ebp
+  8020fd:	89 e5                	mov    %esp,%ebp
+  8020ff:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802102:	8b 45 08             	mov    0x8(%ebp),%eax
+  802105:	8b 40 0c             	mov    0xc(%eax),%eax
+  802108:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80210d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802110:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80211f:	e8 8b ff ff ff       	call   8020af <fsipc>
+}
+  802124:	c9                   	leave
+  802125:	c3                   	ret
+
+00802126 <devfile_flush>:
+{
+  802126:	55                   	push   %ebp
+  802127:	89 e5                	mov    %esp,%ebp
+  802129:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80212c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802132:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802137:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802141:	e8 69 ff ff ff       	call   8020af <fsipc>
+}
+  802146:	c9                   	leave
+  802147:	c3                   	ret
+
+00802148 <devfile_stat>:
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	53                   	push   %ebx
+  80214c:	83 ec 04             	sub    $0x4,%esp
+  80214f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802152:	8b 45 08             	mov    0x8(%ebp),%eax
+  802155:	8b 40 0c             	mov    0xc(%eax),%eax
+  802158:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80215d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802162:	b8 05 00 00 00       	mov    $0x5,%eax
+  802167:	e8 43 ff ff ff       	call   8020af <fsipc>
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	78 2c                	js     80219c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802170:	83 ec 08             	sub    $0x8,%esp
+  802173:	68 00 60 80 00       	push   $0x806000
+  802178:	53                   	push   %ebx
+  802179:	e8 b4 e9 ff ff       	call   800b32 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80217e:	a1 80 60 80 00       	mov    0x806080,%eax
+  802183:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802189:	a1 84 60 80 00       	mov    0x806084,%eax
+  80218e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802194:	83 c4 10             	add    $0x10,%esp
+  802197:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80219c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219f:	c9                   	leave
+  8021a0:	c3                   	ret
+
+008021a1 <devfile_write>:
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	83 ec 0c             	sub    $0xc,%esp
+  8021a7:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021ad:	8b 52 0c             	mov    0xc(%edx),%edx
+  8021b0:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8021b6:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8021bb:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8021c0:	39 d0                	cmp    %edx,%eax
+  8021c2:	0f 47 c2             	cmova  %edx,%eax
+  8021c5:	50                   	push   %eax
+  8021c6:	ff 75 0c             	push   0xc(%ebp)
+  8021c9:	68 08 60 80 00       	push   $0x806008
+  8021ce:	e8 e5 ea ff ff       	call   800cb8 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8021d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021dd:	e8 cd fe ff ff       	call   8020af <fsipc>
+}
+  8021e2:	c9                   	leave
+  8021e3:	c3                   	ret
+
+008021e4 <devfile_read>:
+{
+  8021e4:	55                   	push   %ebp
+  8021e5:	89 e5                	mov    %esp,%ebp
+  8021e7:	56                   	push   %esi
+  8021e8:	53                   	push   %ebx
+  8021e9:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021f2:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8021f7:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8021fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802202:	b8 03 00 00 00       	mov    $0x3,%eax
+  802207:	e8 a3 fe ff ff       	call   8020af <fsipc>
+  80220c:	89 c3                	mov    %eax,%ebx
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	78 1f                	js     802231 <devfile_read+0x4d>
+	assert(r <= n);
+  802212:	39 c6                	cmp    %eax,%esi
+  802214:	72 24                	jb     80223a <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802216:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80221b:	7f 33                	jg     802250 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80221d:	83 ec 04             	sub    $0x4,%esp
+  802220:	50                   	push   %eax
+  802221:	68 00 60 80 00       	push   $0x806000
+  802226:	ff 75 0c             	push   0xc(%ebp)
+  802229:	e8 8a ea ff ff       	call   800cb8 <memmove>
+	return r;
+  80222e:	83 c4 10             	add    $0x10,%esp
+}
+  802231:	89 d8                	mov    %ebx,%eax
+  802233:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802236:	5b                   	pop    %ebx
+  802237:	5e                   	pop    %esi
+  802238:	5d                   	pop    %ebp
+  802239:	c3                   	ret
+	assert(r <= n);
+  80223a:	68 b8 32 80 00       	push   $0x8032b8
+  80223f:	68 bf 32 80 00       	push   $0x8032bf
+  802244:	6a 76                	push   $0x76
+  802246:	68 d4 32 80 00       	push   $0x8032d4
+  80224b:	e8 cf e0 ff ff       	call   80031f <_panic>
+	assert(r <= PGSIZE);
+  802250:	68 df 32 80 00       	push   $0x8032df
+  802255:	68 bf 32 80 00       	push   $0x8032bf
+  80225a:	6a 77                	push   $0x77
+  80225c:	68 d4 32 80 00       	push   $0x8032d4
+  802261:	e8 b9 e0 ff ff       	call   80031f <_panic>
+
+00802266 <open>:
+{
+  802266:	55                   	push   %ebp
+  802267:	89 e5                	mov    %esp,%ebp
+  802269:	56                   	push   %esi
+  80226a:	53                   	push   %ebx
+  80226b:	83 ec 1c             	sub    $0x1c,%esp
+  80226e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802271:	56                   	push   %esi
+  802272:	e8 80 e8 ff ff       	call   800af7 <strlen>
+  802277:	83 c4 10             	add    $0x10,%esp
+  80227a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80227f:	7f 6c                	jg     8022ed <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802281:	83 ec 0c             	sub    $0xc,%esp
+  802284:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802287:	50                   	push   %eax
+  802288:	e8 3a f8 ff ff       	call   801ac7 <fd_alloc>
+  80228d:	89 c3                	mov    %eax,%ebx
+  80228f:	83 c4 10             	add    $0x10,%esp
+  802292:	85 c0                	test   %eax,%eax
+  802294:	78 3c                	js     8022d2 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802296:	83 ec 08             	sub    $0x8,%esp
+  802299:	56                   	push   %esi
+  80229a:	68 00 60 80 00       	push   $0x806000
+  80229f:	e8 8e e8 ff ff       	call   800b32 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022a7:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b4:	e8 f6 fd ff ff       	call   8020af <fsipc>
+  8022b9:	89 c3                	mov    %eax,%ebx
+  8022bb:	83 c4 10             	add    $0x10,%esp
+  8022be:	85 c0                	test   %eax,%eax
+  8022c0:	78 19                	js     8022db <open+0x75>
+	return fd2num(fd);
+  8022c2:	83 ec 0c             	sub    $0xc,%esp
+  8022c5:	ff 75 f4             	push   -0xc(%ebp)
+  8022c8:	e8 d3 f7 ff ff       	call   801aa0 <fd2num>
+  8022cd:	89 c3                	mov    %eax,%ebx
+  8022cf:	83 c4 10             	add    $0x10,%esp
+}
+  8022d2:	89 d8                	mov    %ebx,%eax
+  8022d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d7:	5b                   	pop    %ebx
+  8022d8:	5e                   	pop    %esi
+  8022d9:	5d                   	pop    %ebp
+  8022da:	c3                   	ret
+		fd_close(fd, 0);
+  8022db:	83 ec 08             	sub    $0x8,%esp
+  8022de:	6a 00                	push   $0x0
+  8022e0:	ff 75 f4             	push   -0xc(%ebp)
+  8022e3:	e8 f8 f8 ff ff       	call   801be0 <fd_close>
+		return r;
+  8022e8:	83 c4 10             	add    $0x10,%esp
+  8022eb:	eb e5                	jmp    8022d2 <open+0x6c>
+		return -E_BAD_PATH;
+  8022ed:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022f2:	eb de                	jmp    8022d2 <open+0x6c>
+
+008022f4 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8022f4:	55                   	push   %ebp
+  8022f5:	89 e5                	mov    %esp,%ebp
+  8022f7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8022fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ff:	b8 08 00 00 00       	mov    $0x8,%eax
+  802304:	e8 a6 fd ff ff       	call   8020af <fsipc>
+}
+  802309:	c9                   	leave
+  80230a:	c3                   	ret
+
+0080230b <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  80230b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80230f:	7f 01                	jg     802312 <writebuf+0x7>
+  802311:	c3                   	ret
+{
+  802312:	55                   	push   %ebp
+  802313:	89 e5                	mov    %esp,%ebp
+  802315:	53                   	push   %ebx
+  802316:	83 ec 08             	sub    $0x8,%esp
+  802319:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80231b:	ff 70 04             	push   0x4(%eax)
+  80231e:	8d 40 10             	lea    0x10(%eax),%eax
+  802321:	50                   	push   %eax
+  802322:	ff 33                	push   (%ebx)
+  802324:	e8 68 fb ff ff       	call   801e91 <write>
+		if (result > 0)
+  802329:	83 c4 10             	add    $0x10,%esp
+  80232c:	85 c0                	test   %eax,%eax
+  80232e:	7e 03                	jle    802333 <writebuf+0x28>
+			b->result += result;
+  802330:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802333:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802336:	74 0d                	je     802345 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233f:	0f 4f c2             	cmovg  %edx,%eax
+  802342:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802348:	c9                   	leave
+  802349:	c3                   	ret
+
+0080234a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80234a:	55                   	push   %ebp
+  80234b:	89 e5                	mov    %esp,%ebp
+  80234d:	53                   	push   %ebx
+  80234e:	83 ec 04             	sub    $0x4,%esp
+  802351:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802354:	8b 53 04             	mov    0x4(%ebx),%edx
+  802357:	8d 42 01             	lea    0x1(%edx),%eax
+  80235a:	89 43 04             	mov    %eax,0x4(%ebx)
+  80235d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802360:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802364:	3d 00 01 00 00       	cmp    $0x100,%eax
+  802369:	74 05                	je     802370 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80236b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80236e:	c9                   	leave
+  80236f:	c3                   	ret
+		writebuf(b);
+  802370:	89 d8                	mov    %ebx,%eax
+  802372:	e8 94 ff ff ff       	call   80230b <writebuf>
+		b->idx = 0;
+  802377:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  80237e:	eb eb                	jmp    80236b <putch+0x21>
+
+00802380 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  802389:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238c:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802392:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802399:	00 00 00 
+	b.result = 0;
+  80239c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8023a3:	00 00 00 
+	b.error = 1;
+  8023a6:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8023ad:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8023b0:	ff 75 10             	push   0x10(%ebp)
+  8023b3:	ff 75 0c             	push   0xc(%ebp)
+  8023b6:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8023bc:	50                   	push   %eax
+  8023bd:	68 4a 23 80 00       	push   $0x80234a
+  8023c2:	e8 11 e1 ff ff       	call   8004d8 <vprintfmt>
+	if (b.idx > 0)
+  8023c7:	83 c4 10             	add    $0x10,%esp
+  8023ca:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8023d1:	7f 12                	jg     8023e5 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8023d3:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8023d9:	85 c0                	test   %eax,%eax
+  8023db:	75 06                	jne    8023e3 <vfprintf+0x63>
+  8023dd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8023e3:	c9                   	leave
+  8023e4:	c3                   	ret
+		writebuf(&b);
+  8023e5:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8023eb:	e8 1b ff ff ff       	call   80230b <writebuf>
+  8023f0:	eb e1                	jmp    8023d3 <vfprintf+0x53>
+
+008023f2 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8023f8:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8023fb:	50                   	push   %eax
+  8023fc:	ff 75 0c             	push   0xc(%ebp)
+  8023ff:	ff 75 08             	push   0x8(%ebp)
+  802402:	e8 79 ff ff ff       	call   802380 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802407:	c9                   	leave
+  802408:	c3                   	ret
+
+00802409 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802409:	55                   	push   %ebp
+  80240a:	89 e5                	mov    %esp,%ebp
+  80240c:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80240f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802412:	50                   	push   %eax
+  802413:	ff 75 08             	push   0x8(%ebp)
+  802416:	6a 01                	push   $0x1
+  802418:	e8 63 ff ff ff       	call   802380 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80241d:	c9                   	leave
+  80241e:	c3                   	ret
+
+0080241f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80241f:	55                   	push   %ebp
+  802420:	89 e5                	mov    %esp,%ebp
+  802422:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802425:	68 eb 32 80 00       	push   $0x8032eb
+  80242a:	ff 75 0c             	push   0xc(%ebp)
+  80242d:	e8 00 e7 ff ff       	call   800b32 <strcpy>
+	return 0;
+}
+  802432:	b8 00 00 00 00       	mov    $0x0,%eax
+  802437:	c9                   	leave
+  802438:	c3                   	ret
+
+00802439 <devsock_close>:
+{
+  802439:	55                   	push   %ebp
+  80243a:	89 e5                	mov    %esp,%ebp
+  80243c:	53                   	push   %ebx
+  80243d:	83 ec 10             	sub    $0x10,%esp
+  802440:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802443:	53                   	push   %ebx
+  802444:	e8 70 09 00 00       	call   802db9 <pageref>
+  802449:	89 c2                	mov    %eax,%edx
+  80244b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80244e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802453:	83 fa 01             	cmp    $0x1,%edx
+  802456:	74 05                	je     80245d <devsock_close+0x24>
+}
+  802458:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80245b:	c9                   	leave
+  80245c:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80245d:	83 ec 0c             	sub    $0xc,%esp
+  802460:	ff 73 0c             	push   0xc(%ebx)
+  802463:	e8 b7 02 00 00       	call   80271f <nsipc_close>
+  802468:	83 c4 10             	add    $0x10,%esp
+  80246b:	eb eb                	jmp    802458 <devsock_close+0x1f>
+
+0080246d <devsock_write>:
+{
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802473:	6a 00                	push   $0x0
+  802475:	ff 75 10             	push   0x10(%ebp)
+  802478:	ff 75 0c             	push   0xc(%ebp)
+  80247b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247e:	ff 70 0c             	push   0xc(%eax)
+  802481:	e8 79 03 00 00       	call   8027ff <nsipc_send>
+}
+  802486:	c9                   	leave
+  802487:	c3                   	ret
+
+00802488 <devsock_read>:
+{
+  802488:	55                   	push   %ebp
+  802489:	89 e5                	mov    %esp,%ebp
+  80248b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80248e:	6a 00                	push   $0x0
+  802490:	ff 75 10             	push   0x10(%ebp)
+  802493:	ff 75 0c             	push   0xc(%ebp)
+  802496:	8b 45 08             	mov    0x8(%ebp),%eax
+  802499:	ff 70 0c             	push   0xc(%eax)
+  80249c:	e8 ef 02 00 00       	call   802790 <nsipc_recv>
+}
+  8024a1:	c9                   	leave
+  8024a2:	c3                   	ret
+
+008024a3 <fd2sockid>:
+{
+  8024a3:	55                   	push   %ebp
+  8024a4:	89 e5                	mov    %esp,%ebp
+  8024a6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8024a9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024ac:	52                   	push   %edx
+  8024ad:	50                   	push   %eax
+  8024ae:	e8 6a f6 ff ff       	call   801b1d <fd_lookup>
+  8024b3:	83 c4 10             	add    $0x10,%esp
+  8024b6:	85 c0                	test   %eax,%eax
+  8024b8:	78 10                	js     8024ca <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8024ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024bd:	8b 0d 3c 40 80 00    	mov    0x80403c,%ecx
+  8024c3:	39 08                	cmp    %ecx,(%eax)
+  8024c5:	75 05                	jne    8024cc <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8024c7:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8024ca:	c9                   	leave
+  8024cb:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024cc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024d1:	eb f7                	jmp    8024ca <fd2sockid+0x27>
+
+008024d3 <alloc_sockfd>:
+{
+  8024d3:	55                   	push   %ebp
+  8024d4:	89 e5                	mov    %esp,%ebp
+  8024d6:	56                   	push   %esi
+  8024d7:	53                   	push   %ebx
+  8024d8:	83 ec 1c             	sub    $0x1c,%esp
+  8024db:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8024dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e0:	50                   	push   %eax
+  8024e1:	e8 e1 f5 ff ff       	call   801ac7 <fd_alloc>
+  8024e6:	89 c3                	mov    %eax,%ebx
+  8024e8:	83 c4 10             	add    $0x10,%esp
+  8024eb:	85 c0                	test   %eax,%eax
+  8024ed:	78 43                	js     802532 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8024ef:	83 ec 04             	sub    $0x4,%esp
+  8024f2:	68 07 04 00 00       	push   $0x407
+  8024f7:	ff 75 f4             	push   -0xc(%ebp)
+  8024fa:	6a 00                	push   $0x0
+  8024fc:	e8 29 eb ff ff       	call   80102a <sys_page_alloc>
+  802501:	89 c3                	mov    %eax,%ebx
+  802503:	83 c4 10             	add    $0x10,%esp
+  802506:	85 c0                	test   %eax,%eax
+  802508:	78 28                	js     802532 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80250a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80250d:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802513:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802515:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802518:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80251f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802522:	83 ec 0c             	sub    $0xc,%esp
+  802525:	50                   	push   %eax
+  802526:	e8 75 f5 ff ff       	call   801aa0 <fd2num>
+  80252b:	89 c3                	mov    %eax,%ebx
+  80252d:	83 c4 10             	add    $0x10,%esp
+  802530:	eb 0c                	jmp    80253e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802532:	83 ec 0c             	sub    $0xc,%esp
+  802535:	56                   	push   %esi
+  802536:	e8 e4 01 00 00       	call   80271f <nsipc_close>
+		return r;
+  80253b:	83 c4 10             	add    $0x10,%esp
+}
+  80253e:	89 d8                	mov    %ebx,%eax
+  802540:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802543:	5b                   	pop    %ebx
+  802544:	5e                   	pop    %esi
+  802545:	5d                   	pop    %ebp
+  802546:	c3                   	ret
+
+00802547 <accept>:
+{
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80254d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802550:	e8 4e ff ff ff       	call   8024a3 <fd2sockid>
+  802555:	85 c0                	test   %eax,%eax
+  802557:	78 1b                	js     802574 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802559:	83 ec 04             	sub    $0x4,%esp
+  80255c:	ff 75 10             	push   0x10(%ebp)
+  80255f:	ff 75 0c             	push   0xc(%ebp)
+  802562:	50                   	push   %eax
+  802563:	e8 0e 01 00 00       	call   802676 <nsipc_accept>
+  802568:	83 c4 10             	add    $0x10,%esp
+  80256b:	85 c0                	test   %eax,%eax
+  80256d:	78 05                	js     802574 <accept+0x2d>
+	return alloc_sockfd(r);
+  80256f:	e8 5f ff ff ff       	call   8024d3 <alloc_sockfd>
+}
+  802574:	c9                   	leave
+  802575:	c3                   	ret
+
+00802576 <bind>:
+{
+  802576:	55                   	push   %ebp
+  802577:	89 e5                	mov    %esp,%ebp
+  802579:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80257c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257f:	e8 1f ff ff ff       	call   8024a3 <fd2sockid>
+  802584:	85 c0                	test   %eax,%eax
+  802586:	78 12                	js     80259a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802588:	83 ec 04             	sub    $0x4,%esp
+  80258b:	ff 75 10             	push   0x10(%ebp)
+  80258e:	ff 75 0c             	push   0xc(%ebp)
+  802591:	50                   	push   %eax
+  802592:	e8 31 01 00 00       	call   8026c8 <nsipc_bind>
+  802597:	83 c4 10             	add    $0x10,%esp
+}
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+
+0080259c <shutdown>:
+{
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a5:	e8 f9 fe ff ff       	call   8024a3 <fd2sockid>
+  8025aa:	85 c0                	test   %eax,%eax
+  8025ac:	78 0f                	js     8025bd <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8025ae:	83 ec 08             	sub    $0x8,%esp
+  8025b1:	ff 75 0c             	push   0xc(%ebp)
+  8025b4:	50                   	push   %eax
+  8025b5:	e8 43 01 00 00       	call   8026fd <nsipc_shutdown>
+  8025ba:	83 c4 10             	add    $0x10,%esp
+}
+  8025bd:	c9                   	leave
+  8025be:	c3                   	ret
+
+008025bf <connect>:
+{
+  8025bf:	55                   	push   %ebp
+  8025c0:	89 e5                	mov    %esp,%ebp
+  8025c2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025c8:	e8 d6 fe ff ff       	call   8024a3 <fd2sockid>
+  8025cd:	85 c0                	test   %eax,%eax
+  8025cf:	78 12                	js     8025e3 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8025d1:	83 ec 04             	sub    $0x4,%esp
+  8025d4:	ff 75 10             	push   0x10(%ebp)
+  8025d7:	ff 75 0c             	push   0xc(%ebp)
+  8025da:	50                   	push   %eax
+  8025db:	e8 59 01 00 00       	call   802739 <nsipc_connect>
+  8025e0:	83 c4 10             	add    $0x10,%esp
+}
+  8025e3:	c9                   	leave
+  8025e4:	c3                   	ret
+
+008025e5 <listen>:
+{
+  8025e5:	55                   	push   %ebp
+  8025e6:	89 e5                	mov    %esp,%ebp
+  8025e8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ee:	e8 b0 fe ff ff       	call   8024a3 <fd2sockid>
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	78 0f                	js     802606 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8025f7:	83 ec 08             	sub    $0x8,%esp
+  8025fa:	ff 75 0c             	push   0xc(%ebp)
+  8025fd:	50                   	push   %eax
+  8025fe:	e8 6b 01 00 00       	call   80276e <nsipc_listen>
+  802603:	83 c4 10             	add    $0x10,%esp
+}
+  802606:	c9                   	leave
+  802607:	c3                   	ret
+
+00802608 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802608:	55                   	push   %ebp
+  802609:	89 e5                	mov    %esp,%ebp
+  80260b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80260e:	ff 75 10             	push   0x10(%ebp)
+  802611:	ff 75 0c             	push   0xc(%ebp)
+  802614:	ff 75 08             	push   0x8(%ebp)
+  802617:	e8 41 02 00 00       	call   80285d <nsipc_socket>
+  80261c:	83 c4 10             	add    $0x10,%esp
+  80261f:	85 c0                	test   %eax,%eax
+  802621:	78 05                	js     802628 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802623:	e8 ab fe ff ff       	call   8024d3 <alloc_sockfd>
+}
+  802628:	c9                   	leave
+  802629:	c3                   	ret
+
+0080262a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80262a:	55                   	push   %ebp
+  80262b:	89 e5                	mov    %esp,%ebp
+  80262d:	53                   	push   %ebx
+  80262e:	83 ec 04             	sub    $0x4,%esp
+  802631:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802633:	83 3d 04 54 80 00 00 	cmpl   $0x0,0x805404
+  80263a:	74 26                	je     802662 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80263c:	6a 07                	push   $0x7
+  80263e:	68 00 70 80 00       	push   $0x807000
+  802643:	53                   	push   %ebx
+  802644:	ff 35 04 54 80 00    	push   0x805404
+  80264a:	e8 d7 06 00 00       	call   802d26 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80264f:	83 c4 0c             	add    $0xc,%esp
+  802652:	6a 00                	push   $0x0
+  802654:	6a 00                	push   $0x0
+  802656:	6a 00                	push   $0x0
+  802658:	e8 b1 06 00 00       	call   802d0e <ipc_recv>
+}
+  80265d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802660:	c9                   	leave
+  802661:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802662:	83 ec 0c             	sub    $0xc,%esp
+  802665:	6a 02                	push   $0x2
+  802667:	e8 0e 07 00 00       	call   802d7a <ipc_find_env>
+  80266c:	a3 04 54 80 00       	mov    %eax,0x805404
+  802671:	83 c4 10             	add    $0x10,%esp
+  802674:	eb c6                	jmp    80263c <nsipc+0x12>
+
+00802676 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802676:	55                   	push   %ebp
+  802677:	89 e5                	mov    %esp,%ebp
+  802679:	56                   	push   %esi
+  80267a:	53                   	push   %ebx
+  80267b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80267e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802681:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802686:	8b 06                	mov    (%esi),%eax
+  802688:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80268d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802692:	e8 93 ff ff ff       	call   80262a <nsipc>
+  802697:	89 c3                	mov    %eax,%ebx
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	79 09                	jns    8026a6 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80269d:	89 d8                	mov    %ebx,%eax
+  80269f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a2:	5b                   	pop    %ebx
+  8026a3:	5e                   	pop    %esi
+  8026a4:	5d                   	pop    %ebp
+  8026a5:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8026a6:	83 ec 04             	sub    $0x4,%esp
+  8026a9:	ff 35 10 70 80 00    	push   0x807010
+  8026af:	68 00 70 80 00       	push   $0x807000
+  8026b4:	ff 75 0c             	push   0xc(%ebp)
+  8026b7:	e8 fc e5 ff ff       	call   800cb8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8026bc:	a1 10 70 80 00       	mov    0x807010,%eax
+  8026c1:	89 06                	mov    %eax,(%esi)
+  8026c3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8026c6:	eb d5                	jmp    80269d <nsipc_accept+0x27>
+
+008026c8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	53                   	push   %ebx
+  8026cc:	83 ec 08             	sub    $0x8,%esp
+  8026cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8026d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d5:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8026da:	53                   	push   %ebx
+  8026db:	ff 75 0c             	push   0xc(%ebp)
+  8026de:	68 04 70 80 00       	push   $0x807004
+  8026e3:	e8 d0 e5 ff ff       	call   800cb8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8026e8:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  8026ee:	b8 02 00 00 00       	mov    $0x2,%eax
+  8026f3:	e8 32 ff ff ff       	call   80262a <nsipc>
+}
+  8026f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026fb:	c9                   	leave
+  8026fc:	c3                   	ret
+
+008026fd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8026fd:	55                   	push   %ebp
+  8026fe:	89 e5                	mov    %esp,%ebp
+  802700:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802703:	8b 45 08             	mov    0x8(%ebp),%eax
+  802706:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  80270b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80270e:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802713:	b8 03 00 00 00       	mov    $0x3,%eax
+  802718:	e8 0d ff ff ff       	call   80262a <nsipc>
+}
+  80271d:	c9                   	leave
+  80271e:	c3                   	ret
+
+0080271f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80271f:	55                   	push   %ebp
+  802720:	89 e5                	mov    %esp,%ebp
+  802722:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802725:	8b 45 08             	mov    0x8(%ebp),%eax
+  802728:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80272d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802732:	e8 f3 fe ff ff       	call   80262a <nsipc>
+}
+  802737:	c9                   	leave
+  802738:	c3                   	ret
+
+00802739 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802739:	55                   	push   %ebp
+  80273a:	89 e5                	mov    %esp,%ebp
+  80273c:	53                   	push   %ebx
+  80273d:	83 ec 08             	sub    $0x8,%esp
+  802740:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802743:	8b 45 08             	mov    0x8(%ebp),%eax
+  802746:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80274b:	53                   	push   %ebx
+  80274c:	ff 75 0c             	push   0xc(%ebp)
+  80274f:	68 04 70 80 00       	push   $0x807004
+  802754:	e8 5f e5 ff ff       	call   800cb8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802759:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80275f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802764:	e8 c1 fe ff ff       	call   80262a <nsipc>
+}
+  802769:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+
+0080276e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80276e:	55                   	push   %ebp
+  80276f:	89 e5                	mov    %esp,%ebp
+  802771:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802774:	8b 45 08             	mov    0x8(%ebp),%eax
+  802777:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80277c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80277f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802784:	b8 06 00 00 00       	mov    $0x6,%eax
+  802789:	e8 9c fe ff ff       	call   80262a <nsipc>
+}
+  80278e:	c9                   	leave
+  80278f:	c3                   	ret
+
+00802790 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802790:	55                   	push   %ebp
+  802791:	89 e5                	mov    %esp,%ebp
+  802793:	56                   	push   %esi
+  802794:	53                   	push   %ebx
+  802795:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802798:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8027a0:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8027a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027a9:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8027ae:	b8 07 00 00 00       	mov    $0x7,%eax
+  8027b3:	e8 72 fe ff ff       	call   80262a <nsipc>
+  8027b8:	89 c3                	mov    %eax,%ebx
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	78 22                	js     8027e0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8027be:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8027c3:	39 c6                	cmp    %eax,%esi
+  8027c5:	0f 4e c6             	cmovle %esi,%eax
+  8027c8:	39 c3                	cmp    %eax,%ebx
+  8027ca:	7f 1d                	jg     8027e9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8027cc:	83 ec 04             	sub    $0x4,%esp
+  8027cf:	53                   	push   %ebx
+  8027d0:	68 00 70 80 00       	push   $0x807000
+  8027d5:	ff 75 0c             	push   0xc(%ebp)
+  8027d8:	e8 db e4 ff ff       	call   800cb8 <memmove>
+  8027dd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8027e0:	89 d8                	mov    %ebx,%eax
+  8027e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027e5:	5b                   	pop    %ebx
+  8027e6:	5e                   	pop    %esi
+  8027e7:	5d                   	pop    %ebp
+  8027e8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8027e9:	68 f7 32 80 00       	push   $0x8032f7
+  8027ee:	68 bf 32 80 00       	push   $0x8032bf
+  8027f3:	6a 62                	push   $0x62
+  8027f5:	68 0c 33 80 00       	push   $0x80330c
+  8027fa:	e8 20 db ff ff       	call   80031f <_panic>
+
+008027ff <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8027ff:	55                   	push   %ebp
+  802800:	89 e5                	mov    %esp,%ebp
+  802802:	53                   	push   %ebx
+  802803:	83 ec 04             	sub    $0x4,%esp
+  802806:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802809:	8b 45 08             	mov    0x8(%ebp),%eax
+  80280c:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802811:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802817:	7f 2e                	jg     802847 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802819:	83 ec 04             	sub    $0x4,%esp
+  80281c:	53                   	push   %ebx
+  80281d:	ff 75 0c             	push   0xc(%ebp)
+  802820:	68 0c 70 80 00       	push   $0x80700c
+  802825:	e8 8e e4 ff ff       	call   800cb8 <memmove>
+	nsipcbuf.send.req_size = size;
+  80282a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802830:	8b 45 14             	mov    0x14(%ebp),%eax
+  802833:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802838:	b8 08 00 00 00       	mov    $0x8,%eax
+  80283d:	e8 e8 fd ff ff       	call   80262a <nsipc>
+}
+  802842:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802845:	c9                   	leave
+  802846:	c3                   	ret
+	assert(size < 1600);
+  802847:	68 18 33 80 00       	push   $0x803318
+  80284c:	68 bf 32 80 00       	push   $0x8032bf
+  802851:	6a 6d                	push   $0x6d
+  802853:	68 0c 33 80 00       	push   $0x80330c
+  802858:	e8 c2 da ff ff       	call   80031f <_panic>
+
+0080285d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80285d:	55                   	push   %ebp
+  80285e:	89 e5                	mov    %esp,%ebp
+  802860:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802863:	8b 45 08             	mov    0x8(%ebp),%eax
+  802866:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80286b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80286e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802873:	8b 45 10             	mov    0x10(%ebp),%eax
+  802876:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80287b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802880:	e8 a5 fd ff ff       	call   80262a <nsipc>
+}
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+00802887 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	56                   	push   %esi
+  80288b:	53                   	push   %ebx
+  80288c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80288f:	83 ec 0c             	sub    $0xc,%esp
+  802892:	ff 75 08             	push   0x8(%ebp)
+  802895:	e8 16 f2 ff ff       	call   801ab0 <fd2data>
+  80289a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80289c:	83 c4 08             	add    $0x8,%esp
+  80289f:	68 24 33 80 00       	push   $0x803324
+  8028a4:	53                   	push   %ebx
+  8028a5:	e8 88 e2 ff ff       	call   800b32 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8028aa:	8b 46 04             	mov    0x4(%esi),%eax
+  8028ad:	2b 06                	sub    (%esi),%eax
+  8028af:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8028b5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8028bc:	00 00 00 
+	stat->st_dev = &devpipe;
+  8028bf:	c7 83 88 00 00 00 58 	movl   $0x804058,0x88(%ebx)
+  8028c6:	40 80 00 
+	return 0;
+}
+  8028c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028d1:	5b                   	pop    %ebx
+  8028d2:	5e                   	pop    %esi
+  8028d3:	5d                   	pop    %ebp
+  8028d4:	c3                   	ret
+
+008028d5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8028d5:	55                   	push   %ebp
+  8028d6:	89 e5                	mov    %esp,%ebp
+  8028d8:	53                   	push   %ebx
+  8028d9:	83 ec 0c             	sub    $0xc,%esp
+  8028dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8028df:	53                   	push   %ebx
+  8028e0:	6a 00                	push   $0x0
+  8028e2:	e8 1e e8 ff ff       	call   801105 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8028e7:	89 1c 24             	mov    %ebx,(%esp)
+  8028ea:	e8 c1 f1 ff ff       	call   801ab0 <fd2data>
+  8028ef:	83 c4 08             	add    $0x8,%esp
+  8028f2:	50                   	push   %eax
+  8028f3:	6a 00                	push   $0x0
+  8028f5:	e8 0b e8 ff ff       	call   801105 <sys_page_unmap>
+}
+  8028fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028fd:	c9                   	leave
+  8028fe:	c3                   	ret
+
+008028ff <_pipeisclosed>:
+{
+  8028ff:	55                   	push   %ebp
+  802900:	89 e5                	mov    %esp,%ebp
+  802902:	57                   	push   %edi
+  802903:	56                   	push   %esi
+  802904:	53                   	push   %ebx
+  802905:	83 ec 1c             	sub    $0x1c,%esp
+  802908:	89 c7                	mov    %eax,%edi
+  80290a:	89 d6                	mov    %edx,%esi
+  80290c:	eb 3c                	jmp    80294a <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  80290e:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802911:	83 ec 0c             	sub    $0xc,%esp
+  802914:	57                   	push   %edi
+  802915:	e8 9f 04 00 00       	call   802db9 <pageref>
+  80291a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80291d:	89 34 24             	mov    %esi,(%esp)
+  802920:	e8 94 04 00 00       	call   802db9 <pageref>
+  802925:	89 c2                	mov    %eax,%edx
+  802927:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802929:	05 00 00 00 20       	add    $0x20000000,%eax
+  80292e:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802931:	8b 0d 08 54 80 00    	mov    0x805408,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802937:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80293c:	76 31                	jbe    80296f <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  80293e:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802941:	39 c3                	cmp    %eax,%ebx
+  802943:	74 76                	je     8029bb <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802945:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802948:	74 36                	je     802980 <_pipeisclosed+0x81>
+  80294a:	89 e0                	mov    %esp,%eax
+  80294c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802951:	8b 15 08 54 80 00    	mov    0x805408,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802957:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80295c:	77 b0                	ja     80290e <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80295e:	c1 e8 10             	shr    $0x10,%eax
+  802961:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802967:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80296d:	eb 9f                	jmp    80290e <_pipeisclosed+0xf>
+  80296f:	c1 e8 10             	shr    $0x10,%eax
+  802972:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802978:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80297e:	eb be                	jmp    80293e <_pipeisclosed+0x3f>
+  802980:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802982:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802987:	8b 15 08 54 80 00    	mov    0x805408,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80298d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802992:	76 16                	jbe    8029aa <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802994:	8b 42 58             	mov    0x58(%edx),%eax
+  802997:	6a 01                	push   $0x1
+  802999:	50                   	push   %eax
+  80299a:	53                   	push   %ebx
+  80299b:	68 2b 33 80 00       	push   $0x80332b
+  8029a0:	e8 55 da ff ff       	call   8003fa <cprintf>
+  8029a5:	83 c4 10             	add    $0x10,%esp
+  8029a8:	eb a0                	jmp    80294a <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8029aa:	c1 e8 10             	shr    $0x10,%eax
+  8029ad:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8029b3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8029b9:	eb d9                	jmp    802994 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8029bb:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8029be:	0f 94 c0             	sete   %al
+  8029c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8029c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029c7:	5b                   	pop    %ebx
+  8029c8:	5e                   	pop    %esi
+  8029c9:	5f                   	pop    %edi
+  8029ca:	5d                   	pop    %ebp
+  8029cb:	c3                   	ret
+
+008029cc <devpipe_write>:
+{
+  8029cc:	55                   	push   %ebp
+  8029cd:	89 e5                	mov    %esp,%ebp
+  8029cf:	57                   	push   %edi
+  8029d0:	56                   	push   %esi
+  8029d1:	53                   	push   %ebx
+  8029d2:	83 ec 28             	sub    $0x28,%esp
+  8029d5:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8029d8:	56                   	push   %esi
+  8029d9:	e8 d2 f0 ff ff       	call   801ab0 <fd2data>
+  8029de:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8029e0:	83 c4 10             	add    $0x10,%esp
+  8029e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8029eb:	75 09                	jne    8029f6 <devpipe_write+0x2a>
+	return i;
+  8029ed:	89 f8                	mov    %edi,%eax
+  8029ef:	eb 23                	jmp    802a14 <devpipe_write+0x48>
+			sys_yield();
+  8029f1:	e8 ee e5 ff ff       	call   800fe4 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8029f6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029f9:	8b 0b                	mov    (%ebx),%ecx
+  8029fb:	8d 51 20             	lea    0x20(%ecx),%edx
+  8029fe:	39 d0                	cmp    %edx,%eax
+  802a00:	72 1a                	jb     802a1c <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802a02:	89 da                	mov    %ebx,%edx
+  802a04:	89 f0                	mov    %esi,%eax
+  802a06:	e8 f4 fe ff ff       	call   8028ff <_pipeisclosed>
+  802a0b:	85 c0                	test   %eax,%eax
+  802a0d:	74 e2                	je     8029f1 <devpipe_write+0x25>
+				return 0;
+  802a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a17:	5b                   	pop    %ebx
+  802a18:	5e                   	pop    %esi
+  802a19:	5f                   	pop    %edi
+  802a1a:	5d                   	pop    %ebp
+  802a1b:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802a1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a1f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802a23:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802a26:	89 c2                	mov    %eax,%edx
+  802a28:	c1 fa 1f             	sar    $0x1f,%edx
+  802a2b:	89 d1                	mov    %edx,%ecx
+  802a2d:	c1 e9 1b             	shr    $0x1b,%ecx
+  802a30:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802a33:	83 e2 1f             	and    $0x1f,%edx
+  802a36:	29 ca                	sub    %ecx,%edx
+  802a38:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802a3c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802a40:	83 c0 01             	add    $0x1,%eax
+  802a43:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802a46:	83 c7 01             	add    $0x1,%edi
+  802a49:	eb 9d                	jmp    8029e8 <devpipe_write+0x1c>
+
+00802a4b <devpipe_read>:
+{
+  802a4b:	55                   	push   %ebp
+  802a4c:	89 e5                	mov    %esp,%ebp
+  802a4e:	57                   	push   %edi
+  802a4f:	56                   	push   %esi
+  802a50:	53                   	push   %ebx
+  802a51:	83 ec 18             	sub    $0x18,%esp
+  802a54:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802a57:	57                   	push   %edi
+  802a58:	e8 53 f0 ff ff       	call   801ab0 <fd2data>
+  802a5d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802a5f:	83 c4 10             	add    $0x10,%esp
+  802a62:	be 00 00 00 00       	mov    $0x0,%esi
+  802a67:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a6a:	75 13                	jne    802a7f <devpipe_read+0x34>
+	return i;
+  802a6c:	89 f0                	mov    %esi,%eax
+  802a6e:	eb 02                	jmp    802a72 <devpipe_read+0x27>
+				return i;
+  802a70:	89 f0                	mov    %esi,%eax
+}
+  802a72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a75:	5b                   	pop    %ebx
+  802a76:	5e                   	pop    %esi
+  802a77:	5f                   	pop    %edi
+  802a78:	5d                   	pop    %ebp
+  802a79:	c3                   	ret
+			sys_yield();
+  802a7a:	e8 65 e5 ff ff       	call   800fe4 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802a7f:	8b 03                	mov    (%ebx),%eax
+  802a81:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a84:	75 18                	jne    802a9e <devpipe_read+0x53>
+			if (i > 0)
+  802a86:	85 f6                	test   %esi,%esi
+  802a88:	75 e6                	jne    802a70 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802a8a:	89 da                	mov    %ebx,%edx
+  802a8c:	89 f8                	mov    %edi,%eax
+  802a8e:	e8 6c fe ff ff       	call   8028ff <_pipeisclosed>
+  802a93:	85 c0                	test   %eax,%eax
+  802a95:	74 e3                	je     802a7a <devpipe_read+0x2f>
+				return 0;
+  802a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9c:	eb d4                	jmp    802a72 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a9e:	99                   	cltd
+  802a9f:	c1 ea 1b             	shr    $0x1b,%edx
+  802aa2:	01 d0                	add    %edx,%eax
+  802aa4:	83 e0 1f             	and    $0x1f,%eax
+  802aa7:	29 d0                	sub    %edx,%eax
+  802aa9:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802aae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ab1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802ab4:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802ab7:	83 c6 01             	add    $0x1,%esi
+  802aba:	eb ab                	jmp    802a67 <devpipe_read+0x1c>
+
+00802abc <pipe>:
+{
+  802abc:	55                   	push   %ebp
+  802abd:	89 e5                	mov    %esp,%ebp
+  802abf:	56                   	push   %esi
+  802ac0:	53                   	push   %ebx
+  802ac1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802ac4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ac7:	50                   	push   %eax
+  802ac8:	e8 fa ef ff ff       	call   801ac7 <fd_alloc>
+  802acd:	89 c3                	mov    %eax,%ebx
+  802acf:	83 c4 10             	add    $0x10,%esp
+  802ad2:	85 c0                	test   %eax,%eax
+  802ad4:	0f 88 23 01 00 00    	js     802bfd <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ada:	83 ec 04             	sub    $0x4,%esp
+  802add:	68 07 04 00 00       	push   $0x407
+  802ae2:	ff 75 f4             	push   -0xc(%ebp)
+  802ae5:	6a 00                	push   $0x0
+  802ae7:	e8 3e e5 ff ff       	call   80102a <sys_page_alloc>
+  802aec:	89 c3                	mov    %eax,%ebx
+  802aee:	83 c4 10             	add    $0x10,%esp
+  802af1:	85 c0                	test   %eax,%eax
+  802af3:	0f 88 04 01 00 00    	js     802bfd <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802af9:	83 ec 0c             	sub    $0xc,%esp
+  802afc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802aff:	50                   	push   %eax
+  802b00:	e8 c2 ef ff ff       	call   801ac7 <fd_alloc>
+  802b05:	89 c3                	mov    %eax,%ebx
+  802b07:	83 c4 10             	add    $0x10,%esp
+  802b0a:	85 c0                	test   %eax,%eax
+  802b0c:	0f 88 db 00 00 00    	js     802bed <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b12:	83 ec 04             	sub    $0x4,%esp
+  802b15:	68 07 04 00 00       	push   $0x407
+  802b1a:	ff 75 f0             	push   -0x10(%ebp)
+  802b1d:	6a 00                	push   $0x0
+  802b1f:	e8 06 e5 ff ff       	call   80102a <sys_page_alloc>
+  802b24:	89 c3                	mov    %eax,%ebx
+  802b26:	83 c4 10             	add    $0x10,%esp
+  802b29:	85 c0                	test   %eax,%eax
+  802b2b:	0f 88 bc 00 00 00    	js     802bed <pipe+0x131>
+	va = fd2data(fd0);
+  802b31:	83 ec 0c             	sub    $0xc,%esp
+  802b34:	ff 75 f4             	push   -0xc(%ebp)
+  802b37:	e8 74 ef ff ff       	call   801ab0 <fd2data>
+  802b3c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b3e:	83 c4 0c             	add    $0xc,%esp
+  802b41:	68 07 04 00 00       	push   $0x407
+  802b46:	50                   	push   %eax
+  802b47:	6a 00                	push   $0x0
+  802b49:	e8 dc e4 ff ff       	call   80102a <sys_page_alloc>
+  802b4e:	89 c3                	mov    %eax,%ebx
+  802b50:	83 c4 10             	add    $0x10,%esp
+  802b53:	85 c0                	test   %eax,%eax
+  802b55:	0f 88 82 00 00 00    	js     802bdd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b5b:	83 ec 0c             	sub    $0xc,%esp
+  802b5e:	ff 75 f0             	push   -0x10(%ebp)
+  802b61:	e8 4a ef ff ff       	call   801ab0 <fd2data>
+  802b66:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b6d:	50                   	push   %eax
+  802b6e:	6a 00                	push   $0x0
+  802b70:	56                   	push   %esi
+  802b71:	6a 00                	push   $0x0
+  802b73:	e8 1f e5 ff ff       	call   801097 <sys_page_map>
+  802b78:	89 c3                	mov    %eax,%ebx
+  802b7a:	83 c4 20             	add    $0x20,%esp
+  802b7d:	85 c0                	test   %eax,%eax
+  802b7f:	78 4e                	js     802bcf <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802b81:	a1 58 40 80 00       	mov    0x804058,%eax
+  802b86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b89:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802b8b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b8e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802b95:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802b98:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802b9a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802b9d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802ba4:	83 ec 0c             	sub    $0xc,%esp
+  802ba7:	ff 75 f4             	push   -0xc(%ebp)
+  802baa:	e8 f1 ee ff ff       	call   801aa0 <fd2num>
+  802baf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bb2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802bb4:	83 c4 04             	add    $0x4,%esp
+  802bb7:	ff 75 f0             	push   -0x10(%ebp)
+  802bba:	e8 e1 ee ff ff       	call   801aa0 <fd2num>
+  802bbf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bc2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802bc5:	83 c4 10             	add    $0x10,%esp
+  802bc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bcd:	eb 2e                	jmp    802bfd <pipe+0x141>
+	sys_page_unmap(0, va);
+  802bcf:	83 ec 08             	sub    $0x8,%esp
+  802bd2:	56                   	push   %esi
+  802bd3:	6a 00                	push   $0x0
+  802bd5:	e8 2b e5 ff ff       	call   801105 <sys_page_unmap>
+  802bda:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802bdd:	83 ec 08             	sub    $0x8,%esp
+  802be0:	ff 75 f0             	push   -0x10(%ebp)
+  802be3:	6a 00                	push   $0x0
+  802be5:	e8 1b e5 ff ff       	call   801105 <sys_page_unmap>
+  802bea:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802bed:	83 ec 08             	sub    $0x8,%esp
+  802bf0:	ff 75 f4             	push   -0xc(%ebp)
+  802bf3:	6a 00                	push   $0x0
+  802bf5:	e8 0b e5 ff ff       	call   801105 <sys_page_unmap>
+  802bfa:	83 c4 10             	add    $0x10,%esp
+}
+  802bfd:	89 d8                	mov    %ebx,%eax
+  802bff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c02:	5b                   	pop    %ebx
+  802c03:	5e                   	pop    %esi
+  802c04:	5d                   	pop    %ebp
+  802c05:	c3                   	ret
+
+00802c06 <pipeisclosed>:
+{
+  802c06:	55                   	push   %ebp
+  802c07:	89 e5                	mov    %esp,%ebp
+  802c09:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c0f:	50                   	push   %eax
+  802c10:	ff 75 08             	push   0x8(%ebp)
+  802c13:	e8 05 ef ff ff       	call   801b1d <fd_lookup>
+  802c18:	83 c4 10             	add    $0x10,%esp
+  802c1b:	85 c0                	test   %eax,%eax
+  802c1d:	78 18                	js     802c37 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802c1f:	83 ec 0c             	sub    $0xc,%esp
+  802c22:	ff 75 f4             	push   -0xc(%ebp)
+  802c25:	e8 86 ee ff ff       	call   801ab0 <fd2data>
+  802c2a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802c2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c2f:	e8 cb fc ff ff       	call   8028ff <_pipeisclosed>
+  802c34:	83 c4 10             	add    $0x10,%esp
+}
+  802c37:	c9                   	leave
+  802c38:	c3                   	ret
+
+00802c39 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802c39:	55                   	push   %ebp
+  802c3a:	89 e5                	mov    %esp,%ebp
+  802c3c:	56                   	push   %esi
+  802c3d:	53                   	push   %ebx
+  802c3e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c41:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802c47:	85 c0                	test   %eax,%eax
+  802c49:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c4e:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802c51:	83 ec 08             	sub    $0x8,%esp
+  802c54:	ff 75 14             	push   0x14(%ebp)
+  802c57:	50                   	push   %eax
+  802c58:	e8 de e7 ff ff       	call   80143b <sys_ipc_recv_until>
+  802c5d:	83 c4 10             	add    $0x10,%esp
+  802c60:	85 c0                	test   %eax,%eax
+  802c62:	78 61                	js     802cc5 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802c64:	85 f6                	test   %esi,%esi
+  802c66:	74 1c                	je     802c84 <ipc_recv_until+0x4b>
+  802c68:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c6a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c6f:	8b 15 08 54 80 00    	mov    0x805408,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c75:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c7a:	76 5f                	jbe    802cdb <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802c7c:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802c82:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802c84:	85 db                	test   %ebx,%ebx
+  802c86:	74 1c                	je     802ca4 <ipc_recv_until+0x6b>
+  802c88:	89 e0                	mov    %esp,%eax
+  802c8a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802c8f:	8b 15 08 54 80 00    	mov    0x805408,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802c95:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802c9a:	76 50                	jbe    802cec <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802c9c:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802ca2:	89 03                	mov    %eax,(%ebx)
+  802ca4:	89 e0                	mov    %esp,%eax
+  802ca6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802cab:	8b 15 08 54 80 00    	mov    0x805408,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cb1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cb6:	76 45                	jbe    802cfd <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802cb8:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802cbe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cc1:	5b                   	pop    %ebx
+  802cc2:	5e                   	pop    %esi
+  802cc3:	5d                   	pop    %ebp
+  802cc4:	c3                   	ret
+		if (from_env_store)
+  802cc5:	85 f6                	test   %esi,%esi
+  802cc7:	74 06                	je     802ccf <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802cc9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ccf:	85 db                	test   %ebx,%ebx
+  802cd1:	74 eb                	je     802cbe <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802cd3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802cd9:	eb e3                	jmp    802cbe <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802cdb:	c1 e8 10             	shr    $0x10,%eax
+  802cde:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ce4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802cea:	eb 90                	jmp    802c7c <ipc_recv_until+0x43>
+  802cec:	c1 e8 10             	shr    $0x10,%eax
+  802cef:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802cf5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802cfb:	eb 9f                	jmp    802c9c <ipc_recv_until+0x63>
+  802cfd:	c1 e8 10             	shr    $0x10,%eax
+  802d00:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d06:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d0c:	eb aa                	jmp    802cb8 <ipc_recv_until+0x7f>
+
+00802d0e <ipc_recv>:
+{
+  802d0e:	55                   	push   %ebp
+  802d0f:	89 e5                	mov    %esp,%ebp
+  802d11:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802d14:	6a 00                	push   $0x0
+  802d16:	ff 75 10             	push   0x10(%ebp)
+  802d19:	ff 75 0c             	push   0xc(%ebp)
+  802d1c:	ff 75 08             	push   0x8(%ebp)
+  802d1f:	e8 15 ff ff ff       	call   802c39 <ipc_recv_until>
+}
+  802d24:	c9                   	leave
+  802d25:	c3                   	ret
+
+00802d26 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802d26:	55                   	push   %ebp
+  802d27:	89 e5                	mov    %esp,%ebp
+  802d29:	57                   	push   %edi
+  802d2a:	56                   	push   %esi
+  802d2b:	53                   	push   %ebx
+  802d2c:	83 ec 0c             	sub    $0xc,%esp
+  802d2f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d32:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802d38:	85 db                	test   %ebx,%ebx
+  802d3a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d3f:	0f 44 d8             	cmove  %eax,%ebx
+  802d42:	eb 05                	jmp    802d49 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802d44:	e8 9b e2 ff ff       	call   800fe4 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802d49:	ff 75 14             	push   0x14(%ebp)
+  802d4c:	53                   	push   %ebx
+  802d4d:	56                   	push   %esi
+  802d4e:	57                   	push   %edi
+  802d4f:	e8 33 e6 ff ff       	call   801387 <sys_ipc_try_send>
+  802d54:	83 c4 10             	add    $0x10,%esp
+  802d57:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d5a:	74 e8                	je     802d44 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802d5c:	85 c0                	test   %eax,%eax
+  802d5e:	78 08                	js     802d68 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d63:	5b                   	pop    %ebx
+  802d64:	5e                   	pop    %esi
+  802d65:	5f                   	pop    %edi
+  802d66:	5d                   	pop    %ebp
+  802d67:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802d68:	50                   	push   %eax
+  802d69:	68 43 33 80 00       	push   $0x803343
+  802d6e:	6a 4f                	push   $0x4f
+  802d70:	68 56 33 80 00       	push   $0x803356
+  802d75:	e8 a5 d5 ff ff       	call   80031f <_panic>
+
+00802d7a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d7a:	55                   	push   %ebp
+  802d7b:	89 e5                	mov    %esp,%ebp
+  802d7d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802d80:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802d85:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802d8b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802d91:	8b 52 50             	mov    0x50(%edx),%edx
+  802d94:	39 ca                	cmp    %ecx,%edx
+  802d96:	74 11                	je     802da9 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802d98:	83 c0 01             	add    $0x1,%eax
+  802d9b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802da0:	75 e3                	jne    802d85 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da7:	eb 0e                	jmp    802db7 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802da9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802daf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802db4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802db7:	5d                   	pop    %ebp
+  802db8:	c3                   	ret
+
+00802db9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802db9:	55                   	push   %ebp
+  802dba:	89 e5                	mov    %esp,%ebp
+  802dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802dbf:	89 c2                	mov    %eax,%edx
+  802dc1:	c1 ea 16             	shr    $0x16,%edx
+  802dc4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802dcb:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802dd0:	f6 c1 01             	test   $0x1,%cl
+  802dd3:	74 1a                	je     802def <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802dd5:	c1 e8 0c             	shr    $0xc,%eax
+  802dd8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802ddf:	a8 01                	test   $0x1,%al
+  802de1:	74 0c                	je     802def <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802de3:	c1 e8 0c             	shr    $0xc,%eax
+  802de6:	c1 e0 04             	shl    $0x4,%eax
+  802de9:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802def:	89 d0                	mov    %edx,%eax
+  802df1:	5d                   	pop    %ebp
+  802df2:	c3                   	ret
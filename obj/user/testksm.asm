@@ -0,0 +1,6543 @@
+
+obj/user/testksm.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 48 02 00 00       	call   800279 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	return true;
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 20             	sub    $0x20,%esp
+  80003b:	bb 00 00 00 30       	mov    $0x30000000,%ebx
+	unsigned start;
+	int i, r;
+
+	// Identical pages, and one that differs by a byte.
+	for (i = 0; i <= NPAGES; i++) {
+		if ((r = sys_page_alloc(0, VA + i * PGSIZE, PERM)) < 0)
+  800040:	89 de                	mov    %ebx,%esi
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	6a 07                	push   $0x7
+  800047:	53                   	push   %ebx
+  800048:	6a 00                	push   $0x0
+  80004a:	e8 09 0f 00 00       	call   800f58 <sys_page_alloc>
+  80004f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800055:	83 c4 10             	add    $0x10,%esp
+  800058:	85 c0                	test   %eax,%eax
+  80005a:	78 3e                	js     80009a <umain+0x67>
+			panic("sys_page_alloc: %e", r);
+		memset(VA + i * PGSIZE, 0x5a, PGSIZE);
+  80005c:	83 ec 04             	sub    $0x4,%esp
+  80005f:	68 00 10 00 00       	push   $0x1000
+  800064:	6a 5a                	push   $0x5a
+  800066:	56                   	push   %esi
+  800067:	e8 45 0b 00 00       	call   800bb1 <memset>
+	for (i = 0; i <= NPAGES; i++) {
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	81 fb 00 90 00 30    	cmp    $0x30009000,%ebx
+  800075:	75 c9                	jne    800040 <umain+0xd>
+	}
+	VA[NPAGES * PGSIZE + PGSIZE / 2] = 0;
+  800077:	c6 05 00 88 00 30 00 	movb   $0x0,0x30008800
+
+	if ((r = sys_env_set_ksm(0, 1)) < 0)
+  80007e:	83 ec 08             	sub    $0x8,%esp
+  800081:	6a 01                	push   $0x1
+  800083:	6a 00                	push   $0x0
+  800085:	e8 de 16 00 00       	call   801768 <sys_env_set_ksm>
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 c0                	test   %eax,%eax
+  80008f:	78 1b                	js     8000ac <umain+0x79>
+		panic("sys_env_set_ksm: %e", r);
+
+	// Idle CPUs merge them while we sleep.
+	start = time_msec();
+  800091:	e8 60 2a 00 00       	call   802af6 <time_msec>
+  800096:	89 c3                	mov    %eax,%ebx
+	while (!merged()) {
+  800098:	eb 4a                	jmp    8000e4 <umain+0xb1>
+			panic("sys_page_alloc: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 e0 2e 80 00       	push   $0x802ee0
+  8000a0:	6a 1f                	push   $0x1f
+  8000a2:	68 f3 2e 80 00       	push   $0x802ef3
+  8000a7:	e8 91 02 00 00       	call   80033d <_panic>
+		panic("sys_env_set_ksm: %e", r);
+  8000ac:	50                   	push   %eax
+  8000ad:	68 02 2f 80 00       	push   $0x802f02
+  8000b2:	6a 25                	push   $0x25
+  8000b4:	68 f3 2e 80 00       	push   $0x802ef3
+  8000b9:	e8 7f 02 00 00       	call   80033d <_panic>
+		if (time_msec() - start > 10000)
+  8000be:	e8 33 2a 00 00       	call   802af6 <time_msec>
+  8000c3:	29 d8                	sub    %ebx,%eax
+  8000c5:	3d 10 27 00 00       	cmp    $0x2710,%eax
+  8000ca:	0f 87 15 01 00 00    	ja     8001e5 <umain+0x1b2>
+			panic("pages not merged after 10s");
+		sys_sleep_until(time_msec() + 20);
+  8000d0:	e8 21 2a 00 00       	call   802af6 <time_msec>
+  8000d5:	83 ec 0c             	sub    $0xc,%esp
+  8000d8:	83 c0 14             	add    $0x14,%eax
+  8000db:	50                   	push   %eax
+  8000dc:	e8 18 13 00 00       	call   8013f9 <sys_sleep_until>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+{
+  8000e4:	b8 00 10 00 30       	mov    $0x30001000,%eax
+		if (PTE_ADDR(uvpt[PGNUM(VA + i * PGSIZE)]) !=
+  8000e9:	89 c2                	mov    %eax,%edx
+  8000eb:	c1 ea 0c             	shr    $0xc,%edx
+  8000ee:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		    PTE_ADDR(uvpt[PGNUM(VA)]))
+  8000f5:	8b 0d 00 00 4c ef    	mov    0xef4c0000,%ecx
+		if (PTE_ADDR(uvpt[PGNUM(VA + i * PGSIZE)]) !=
+  8000fb:	05 00 10 00 00       	add    $0x1000,%eax
+  800100:	31 ca                	xor    %ecx,%edx
+  800102:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  800108:	77 b4                	ja     8000be <umain+0x8b>
+	for (i = 1; i < NPAGES; i++)
+  80010a:	3d 00 80 00 30       	cmp    $0x30008000,%eax
+  80010f:	75 d8                	jne    8000e9 <umain+0xb6>
+	}
+	cprintf("ksm: merged %d pages in %u ms\n", NPAGES,
+		time_msec() - start);
+  800111:	e8 e0 29 00 00       	call   802af6 <time_msec>
+	cprintf("ksm: merged %d pages in %u ms\n", NPAGES,
+  800116:	83 ec 04             	sub    $0x4,%esp
+  800119:	29 d8                	sub    %ebx,%eax
+  80011b:	50                   	push   %eax
+  80011c:	6a 08                	push   $0x8
+  80011e:	68 94 2f 80 00       	push   $0x802f94
+  800123:	e8 f0 02 00 00       	call   800418 <cprintf>
+	assert(uvpt[PGNUM(VA)] & PTE_COW);
+  800128:	a1 00 00 4c ef       	mov    0xef4c0000,%eax
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	f6 c4 08             	test   $0x8,%ah
+  800133:	0f 84 c0 00 00 00    	je     8001f9 <umain+0x1c6>
+	assert(PTE_ADDR(uvpt[PGNUM(VA + NPAGES * PGSIZE)]) !=
+  800139:	a1 20 00 4c ef       	mov    0xef4c0020,%eax
+  80013e:	8b 15 00 00 4c ef    	mov    0xef4c0000,%edx
+  800144:	31 d0                	xor    %edx,%eax
+  800146:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80014b:	0f 86 be 00 00 00    	jbe    80020f <umain+0x1dc>
+	       PTE_ADDR(uvpt[PGNUM(VA)]));
+
+	if ((r = sys_meminfo(&mi, 0, 0)) < 0)
+  800151:	83 ec 04             	sub    $0x4,%esp
+  800154:	6a 00                	push   $0x0
+  800156:	6a 00                	push   $0x0
+  800158:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80015b:	50                   	push   %eax
+  80015c:	e8 bb 15 00 00       	call   80171c <sys_meminfo>
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	85 c0                	test   %eax,%eax
+  800166:	0f 88 b9 00 00 00    	js     800225 <umain+0x1f2>
+		panic("sys_meminfo: %e", r);
+	assert(mi.mi_merged >= NPAGES - 1);
+  80016c:	83 7d f4 06          	cmpl   $0x6,-0xc(%ebp)
+  800170:	0f 86 c1 00 00 00    	jbe    800237 <umain+0x204>
+
+	// Stop merging before writing, so the copy stays ours.
+	sys_env_set_ksm(0, 0);
+  800176:	83 ec 08             	sub    $0x8,%esp
+  800179:	6a 00                	push   $0x0
+  80017b:	6a 00                	push   $0x0
+  80017d:	e8 e6 15 00 00       	call   801768 <sys_env_set_ksm>
+	VA[0] = 1;
+  800182:	c6 05 00 00 00 30 01 	movb   $0x1,0x30000000
+	assert(PTE_ADDR(uvpt[PGNUM(VA)]) !=
+  800189:	a1 00 00 4c ef       	mov    0xef4c0000,%eax
+  80018e:	8b 15 04 00 4c ef    	mov    0xef4c0004,%edx
+  800194:	31 d0                	xor    %edx,%eax
+  800196:	83 c4 10             	add    $0x10,%esp
+  800199:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80019e:	0f 86 a9 00 00 00    	jbe    80024d <umain+0x21a>
+  8001a4:	b8 ff 1f 00 30       	mov    $0x30001fff,%eax
+	       PTE_ADDR(uvpt[PGNUM(VA + PGSIZE)]));
+	for (i = 1; i < NPAGES; i++)
+		assert(VA[i * PGSIZE] == 0x5a &&
+  8001a9:	80 b8 01 f0 ff ff 5a 	cmpb   $0x5a,-0xfff(%eax)
+  8001b0:	0f 85 ad 00 00 00    	jne    800263 <umain+0x230>
+  8001b6:	0f b6 10             	movzbl (%eax),%edx
+  8001b9:	05 00 10 00 00       	add    $0x1000,%eax
+  8001be:	80 fa 5a             	cmp    $0x5a,%dl
+  8001c1:	0f 85 9c 00 00 00    	jne    800263 <umain+0x230>
+	for (i = 1; i < NPAGES; i++)
+  8001c7:	3d ff 8f 00 30       	cmp    $0x30008fff,%eax
+  8001cc:	75 db                	jne    8001a9 <umain+0x176>
+		       VA[i * PGSIZE + PGSIZE - 1] == 0x5a);
+
+	cprintf("ksm: OK\n");
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	68 8b 2f 80 00       	push   $0x802f8b
+  8001d6:	e8 3d 02 00 00       	call   800418 <cprintf>
+}
+  8001db:	83 c4 10             	add    $0x10,%esp
+  8001de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e1:	5b                   	pop    %ebx
+  8001e2:	5e                   	pop    %esi
+  8001e3:	5d                   	pop    %ebp
+  8001e4:	c3                   	ret
+			panic("pages not merged after 10s");
+  8001e5:	83 ec 04             	sub    $0x4,%esp
+  8001e8:	68 16 2f 80 00       	push   $0x802f16
+  8001ed:	6a 2b                	push   $0x2b
+  8001ef:	68 f3 2e 80 00       	push   $0x802ef3
+  8001f4:	e8 44 01 00 00       	call   80033d <_panic>
+	assert(uvpt[PGNUM(VA)] & PTE_COW);
+  8001f9:	68 31 2f 80 00       	push   $0x802f31
+  8001fe:	68 4b 2f 80 00       	push   $0x802f4b
+  800203:	6a 30                	push   $0x30
+  800205:	68 f3 2e 80 00       	push   $0x802ef3
+  80020a:	e8 2e 01 00 00       	call   80033d <_panic>
+	assert(PTE_ADDR(uvpt[PGNUM(VA + NPAGES * PGSIZE)]) !=
+  80020f:	68 b4 2f 80 00       	push   $0x802fb4
+  800214:	68 4b 2f 80 00       	push   $0x802f4b
+  800219:	6a 31                	push   $0x31
+  80021b:	68 f3 2e 80 00       	push   $0x802ef3
+  800220:	e8 18 01 00 00       	call   80033d <_panic>
+		panic("sys_meminfo: %e", r);
+  800225:	50                   	push   %eax
+  800226:	68 60 2f 80 00       	push   $0x802f60
+  80022b:	6a 35                	push   $0x35
+  80022d:	68 f3 2e 80 00       	push   $0x802ef3
+  800232:	e8 06 01 00 00       	call   80033d <_panic>
+	assert(mi.mi_merged >= NPAGES - 1);
+  800237:	68 70 2f 80 00       	push   $0x802f70
+  80023c:	68 4b 2f 80 00       	push   $0x802f4b
+  800241:	6a 36                	push   $0x36
+  800243:	68 f3 2e 80 00       	push   $0x802ef3
+  800248:	e8 f0 00 00 00       	call   80033d <_panic>
+	assert(PTE_ADDR(uvpt[PGNUM(VA)]) !=
+  80024d:	68 00 30 80 00       	push   $0x803000
+  800252:	68 4b 2f 80 00       	push   $0x802f4b
+  800257:	6a 3b                	push   $0x3b
+  800259:	68 f3 2e 80 00       	push   $0x802ef3
+  80025e:	e8 da 00 00 00       	call   80033d <_panic>
+		assert(VA[i * PGSIZE] == 0x5a &&
+  800263:	68 40 30 80 00       	push   $0x803040
+  800268:	68 4b 2f 80 00       	push   $0x802f4b
+  80026d:	6a 3e                	push   $0x3e
+  80026f:	68 f3 2e 80 00       	push   $0x802ef3
+  800274:	e8 c4 00 00 00       	call   80033d <_panic>
+
+00800279 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800279:	55                   	push   %ebp
+  80027a:	89 e5                	mov    %esp,%ebp
+  80027c:	57                   	push   %edi
+  80027d:	56                   	push   %esi
+  80027e:	53                   	push   %ebx
+  80027f:	83 ec 0c             	sub    $0xc,%esp
+  800282:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800285:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800288:	b8 01 00 00 00       	mov    $0x1,%eax
+  80028d:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80028f:	c1 ea 0b             	shr    $0xb,%edx
+  800292:	83 f2 01             	xor    $0x1,%edx
+  800295:	83 e2 01             	and    $0x1,%edx
+  800298:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80029e:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8002a5:	00 00 00 
+	envid = sys_getenvid();
+  8002a8:	e8 1f 0c 00 00       	call   800ecc <sys_getenvid>
+  8002ad:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8002af:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8002b4:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8002ba:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8002c0:	8b 52 48             	mov    0x48(%edx),%edx
+  8002c3:	39 ca                	cmp    %ecx,%edx
+  8002c5:	74 27                	je     8002ee <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8002c7:	83 c0 01             	add    $0x1,%eax
+  8002ca:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8002cf:	75 e3                	jne    8002b4 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8002d1:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8002d8:	75 24                	jne    8002fe <libmain+0x85>
+		panic("libmain can't find the environment");
+  8002da:	83 ec 04             	sub    $0x4,%esp
+  8002dd:	68 80 30 80 00       	push   $0x803080
+  8002e2:	6a 23                	push   $0x23
+  8002e4:	68 a3 30 80 00       	push   $0x8030a3
+  8002e9:	e8 4f 00 00 00       	call   80033d <_panic>
+			mainenv = &envs[i];
+  8002ee:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8002f4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f9:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002fe:	85 ff                	test   %edi,%edi
+  800300:	7e 07                	jle    800309 <libmain+0x90>
+		binaryname = argv[0];
+  800302:	8b 06                	mov    (%esi),%eax
+  800304:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800309:	83 ec 08             	sub    $0x8,%esp
+  80030c:	56                   	push   %esi
+  80030d:	57                   	push   %edi
+  80030e:	e8 20 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800313:	e8 0b 00 00 00       	call   800323 <exit>
+}
+  800318:	83 c4 10             	add    $0x10,%esp
+  80031b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031e:	5b                   	pop    %ebx
+  80031f:	5e                   	pop    %esi
+  800320:	5f                   	pop    %edi
+  800321:	5d                   	pop    %ebp
+  800322:	c3                   	ret
+
+00800323 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800323:	55                   	push   %ebp
+  800324:	89 e5                	mov    %esp,%ebp
+  800326:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800329:	e8 94 18 00 00       	call   801bc2 <close_all>
+	sys_env_destroy(0);
+  80032e:	83 ec 0c             	sub    $0xc,%esp
+  800331:	6a 00                	push   $0x0
+  800333:	e8 2b 0b 00 00       	call   800e63 <sys_env_destroy>
+}
+  800338:	83 c4 10             	add    $0x10,%esp
+  80033b:	c9                   	leave
+  80033c:	c3                   	ret
+
+0080033d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80033d:	55                   	push   %ebp
+  80033e:	89 e5                	mov    %esp,%ebp
+  800340:	56                   	push   %esi
+  800341:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800342:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800345:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80034b:	e8 7c 0b 00 00       	call   800ecc <sys_getenvid>
+  800350:	83 ec 0c             	sub    $0xc,%esp
+  800353:	ff 75 0c             	push   0xc(%ebp)
+  800356:	ff 75 08             	push   0x8(%ebp)
+  800359:	56                   	push   %esi
+  80035a:	50                   	push   %eax
+  80035b:	68 bc 30 80 00       	push   $0x8030bc
+  800360:	e8 b3 00 00 00       	call   800418 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800365:	83 c4 18             	add    $0x18,%esp
+  800368:	53                   	push   %ebx
+  800369:	ff 75 10             	push   0x10(%ebp)
+  80036c:	e8 56 00 00 00       	call   8003c7 <vcprintf>
+	cprintf("\n");
+  800371:	c7 04 24 92 2f 80 00 	movl   $0x802f92,(%esp)
+  800378:	e8 9b 00 00 00       	call   800418 <cprintf>
+  80037d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800380:	cc                   	int3
+	while (1)
+  800381:	eb fd                	jmp    800380 <_panic+0x43>
+
+00800383 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800383:	55                   	push   %ebp
+  800384:	89 e5                	mov    %esp,%ebp
+  800386:	53                   	push   %ebx
+  800387:	83 ec 04             	sub    $0x4,%esp
+  80038a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80038d:	8b 13                	mov    (%ebx),%edx
+  80038f:	8d 42 01             	lea    0x1(%edx),%eax
+  800392:	89 03                	mov    %eax,(%ebx)
+  800394:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800397:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80039b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003a0:	74 09                	je     8003ab <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003a2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a9:	c9                   	leave
+  8003aa:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003ab:	83 ec 08             	sub    $0x8,%esp
+  8003ae:	68 ff 00 00 00       	push   $0xff
+  8003b3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003b6:	50                   	push   %eax
+  8003b7:	e8 1d 0a 00 00       	call   800dd9 <sys_cputs>
+		b->idx = 0;
+  8003bc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003c2:	83 c4 10             	add    $0x10,%esp
+  8003c5:	eb db                	jmp    8003a2 <putch+0x1f>
+
+008003c7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003c7:	55                   	push   %ebp
+  8003c8:	89 e5                	mov    %esp,%ebp
+  8003ca:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003d0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003d7:	00 00 00 
+	b.cnt = 0;
+  8003da:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003e1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003e4:	ff 75 0c             	push   0xc(%ebp)
+  8003e7:	ff 75 08             	push   0x8(%ebp)
+  8003ea:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003f0:	50                   	push   %eax
+  8003f1:	68 83 03 80 00       	push   $0x800383
+  8003f6:	e8 fb 00 00 00       	call   8004f6 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003fb:	83 c4 08             	add    $0x8,%esp
+  8003fe:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800404:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80040a:	50                   	push   %eax
+  80040b:	e8 c9 09 00 00       	call   800dd9 <sys_cputs>
+
+	return b.cnt;
+}
+  800410:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800416:	c9                   	leave
+  800417:	c3                   	ret
+
+00800418 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800418:	55                   	push   %ebp
+  800419:	89 e5                	mov    %esp,%ebp
+  80041b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80041e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800421:	50                   	push   %eax
+  800422:	ff 75 08             	push   0x8(%ebp)
+  800425:	e8 9d ff ff ff       	call   8003c7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80042a:	c9                   	leave
+  80042b:	c3                   	ret
+
+0080042c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80042c:	55                   	push   %ebp
+  80042d:	89 e5                	mov    %esp,%ebp
+  80042f:	57                   	push   %edi
+  800430:	56                   	push   %esi
+  800431:	53                   	push   %ebx
+  800432:	83 ec 1c             	sub    $0x1c,%esp
+  800435:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800438:	89 d6                	mov    %edx,%esi
+  80043a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80043d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800440:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800443:	73 0b                	jae    800450 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800445:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800448:	c1 e7 08             	shl    $0x8,%edi
+  80044b:	0b 7d 10             	or     0x10(%ebp),%edi
+  80044e:	eb 36                	jmp    800486 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800450:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800453:	ba 00 00 00 00       	mov    $0x0,%edx
+  800458:	f7 75 08             	divl   0x8(%ebp)
+  80045b:	89 c1                	mov    %eax,%ecx
+  80045d:	ff 75 14             	push   0x14(%ebp)
+  800460:	ff 75 10             	push   0x10(%ebp)
+  800463:	83 eb 01             	sub    $0x1,%ebx
+  800466:	53                   	push   %ebx
+  800467:	ff 75 08             	push   0x8(%ebp)
+  80046a:	89 f2                	mov    %esi,%edx
+  80046c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80046f:	e8 b8 ff ff ff       	call   80042c <printnum>
+  800474:	83 c4 10             	add    $0x10,%esp
+  800477:	eb 14                	jmp    80048d <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800479:	83 ec 08             	sub    $0x8,%esp
+  80047c:	56                   	push   %esi
+  80047d:	57                   	push   %edi
+  80047e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800481:	ff d0                	call   *%eax
+  800483:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800486:	83 eb 01             	sub    $0x1,%ebx
+  800489:	85 db                	test   %ebx,%ebx
+  80048b:	7f ec                	jg     800479 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80048d:	83 ec 08             	sub    $0x8,%esp
+  800490:	56                   	push   %esi
+  800491:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800494:	ba 00 00 00 00       	mov    $0x0,%edx
+  800499:	f7 75 08             	divl   0x8(%ebp)
+  80049c:	0f be 92 df 30 80 00 	movsbl 0x8030df(%edx),%edx
+  8004a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a6:	c1 e0 08             	shl    $0x8,%eax
+  8004a9:	09 d0                	or     %edx,%eax
+  8004ab:	50                   	push   %eax
+  8004ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004af:	ff d0                	call   *%eax
+}
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  8004b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b7:	5b                   	pop    %ebx
+  8004b8:	5e                   	pop    %esi
+  8004b9:	5f                   	pop    %edi
+  8004ba:	5d                   	pop    %ebp
+  8004bb:	c3                   	ret
+
+008004bc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004bc:	55                   	push   %ebp
+  8004bd:	89 e5                	mov    %esp,%ebp
+  8004bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004c2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004c6:	8b 10                	mov    (%eax),%edx
+  8004c8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004cb:	73 0a                	jae    8004d7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004cd:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004d0:	89 08                	mov    %ecx,(%eax)
+  8004d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004d5:	88 02                	mov    %al,(%edx)
+}
+  8004d7:	5d                   	pop    %ebp
+  8004d8:	c3                   	ret
+
+008004d9 <printfmt>:
+{
+  8004d9:	55                   	push   %ebp
+  8004da:	89 e5                	mov    %esp,%ebp
+  8004dc:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004df:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004e2:	50                   	push   %eax
+  8004e3:	ff 75 10             	push   0x10(%ebp)
+  8004e6:	ff 75 0c             	push   0xc(%ebp)
+  8004e9:	ff 75 08             	push   0x8(%ebp)
+  8004ec:	e8 05 00 00 00       	call   8004f6 <vprintfmt>
+}
+  8004f1:	83 c4 10             	add    $0x10,%esp
+  8004f4:	c9                   	leave
+  8004f5:	c3                   	ret
+
+008004f6 <vprintfmt>:
+{
+  8004f6:	55                   	push   %ebp
+  8004f7:	89 e5                	mov    %esp,%ebp
+  8004f9:	57                   	push   %edi
+  8004fa:	56                   	push   %esi
+  8004fb:	53                   	push   %ebx
+  8004fc:	83 ec 3c             	sub    $0x3c,%esp
+  8004ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800502:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800505:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80050c:	eb 16                	jmp    800524 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	ff 75 0c             	push   0xc(%ebp)
+  800514:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800517:	c1 e2 08             	shl    $0x8,%edx
+  80051a:	09 d0                	or     %edx,%eax
+  80051c:	50                   	push   %eax
+  80051d:	ff d7                	call   *%edi
+  80051f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800522:	89 de                	mov    %ebx,%esi
+  800524:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800527:	0f b6 06             	movzbl (%esi),%eax
+  80052a:	83 f8 25             	cmp    $0x25,%eax
+  80052d:	74 0c                	je     80053b <vprintfmt+0x45>
+			if (ch == '\0')
+  80052f:	85 c0                	test   %eax,%eax
+  800531:	75 db                	jne    80050e <vprintfmt+0x18>
+}
+  800533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800536:	5b                   	pop    %ebx
+  800537:	5e                   	pop    %esi
+  800538:	5f                   	pop    %edi
+  800539:	5d                   	pop    %ebp
+  80053a:	c3                   	ret
+		padc = ' ';
+  80053b:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80053f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800546:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80054d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800554:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800559:	8d 73 01             	lea    0x1(%ebx),%esi
+  80055c:	0f b6 13             	movzbl (%ebx),%edx
+  80055f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800562:	3c 55                	cmp    $0x55,%al
+  800564:	0f 87 2c 04 00 00    	ja     800996 <vprintfmt+0x4a0>
+  80056a:	0f b6 c0             	movzbl %al,%eax
+  80056d:	ff 24 85 20 32 80 00 	jmp    *0x803220(,%eax,4)
+  800574:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800576:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80057a:	eb dd                	jmp    800559 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80057c:	89 f3                	mov    %esi,%ebx
+  80057e:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800582:	eb d5                	jmp    800559 <vprintfmt+0x63>
+  800584:	0f b6 d2             	movzbl %dl,%edx
+  800587:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800589:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80058e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800591:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800595:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800598:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80059b:	83 fe 09             	cmp    $0x9,%esi
+  80059e:	0f 87 8a 00 00 00    	ja     80062e <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8005a4:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8005a7:	eb e5                	jmp    80058e <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	8b 00                	mov    (%eax),%eax
+  8005ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ba:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8005bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c0:	79 97                	jns    800559 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8005c2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005cf:	eb 88                	jmp    800559 <vprintfmt+0x63>
+			if (width < 0)
+  8005d1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8005d4:	85 db                	test   %ebx,%ebx
+  8005d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005db:	0f 49 c3             	cmovns %ebx,%eax
+  8005de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e1:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005e3:	e9 71 ff ff ff       	jmp    800559 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e8:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8005ea:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005f1:	e9 63 ff ff ff       	jmp    800559 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8005f6:	8d 73 02             	lea    0x2(%ebx),%esi
+  8005f9:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8005fd:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800604:	3c 67                	cmp    $0x67,%al
+  800606:	0f 84 18 ff ff ff    	je     800524 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80060c:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800613:	3c 72                	cmp    $0x72,%al
+  800615:	0f 84 09 ff ff ff    	je     800524 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80061b:	3c 62                	cmp    $0x62,%al
+  80061d:	0f 94 c0             	sete   %al
+  800620:	0f b6 c0             	movzbl %al,%eax
+  800623:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800626:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800629:	e9 f6 fe ff ff       	jmp    800524 <vprintfmt+0x2e>
+  80062e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800631:	eb 89                	jmp    8005bc <vprintfmt+0xc6>
+			lflag++;
+  800633:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800636:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800638:	e9 1c ff ff ff       	jmp    800559 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80063d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800640:	8d 58 04             	lea    0x4(%eax),%ebx
+  800643:	83 ec 08             	sub    $0x8,%esp
+  800646:	ff 75 0c             	push   0xc(%ebp)
+  800649:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80064c:	c1 e0 08             	shl    $0x8,%eax
+  80064f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800652:	0b 01                	or     (%ecx),%eax
+  800654:	50                   	push   %eax
+  800655:	ff d7                	call   *%edi
+			break;
+  800657:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80065a:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80065d:	e9 c2 fe ff ff       	jmp    800524 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800668:	8b 10                	mov    (%eax),%edx
+  80066a:	89 d0                	mov    %edx,%eax
+  80066c:	f7 d8                	neg    %eax
+  80066e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800671:	83 f8 12             	cmp    $0x12,%eax
+  800674:	7f 25                	jg     80069b <vprintfmt+0x1a5>
+  800676:	8b 14 85 80 33 80 00 	mov    0x803380(,%eax,4),%edx
+  80067d:	85 d2                	test   %edx,%edx
+  80067f:	74 1a                	je     80069b <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800681:	52                   	push   %edx
+  800682:	68 5d 2f 80 00       	push   $0x802f5d
+  800687:	ff 75 0c             	push   0xc(%ebp)
+  80068a:	57                   	push   %edi
+  80068b:	e8 49 fe ff ff       	call   8004d9 <printfmt>
+  800690:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800693:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800696:	e9 89 fe ff ff       	jmp    800524 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80069b:	50                   	push   %eax
+  80069c:	68 f7 30 80 00       	push   $0x8030f7
+  8006a1:	ff 75 0c             	push   0xc(%ebp)
+  8006a4:	57                   	push   %edi
+  8006a5:	e8 2f fe ff ff       	call   8004d9 <printfmt>
+  8006aa:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006ad:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006b0:	e9 6f fe ff ff       	jmp    800524 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b8:	83 c0 04             	add    $0x4,%eax
+  8006bb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8006c3:	85 c9                	test   %ecx,%ecx
+  8006c5:	b8 f0 30 80 00       	mov    $0x8030f0,%eax
+  8006ca:	0f 45 c1             	cmovne %ecx,%eax
+  8006cd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8006d0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006d4:	7e 06                	jle    8006dc <vprintfmt+0x1e6>
+  8006d6:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8006da:	75 1a                	jne    8006f6 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8006dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006df:	c1 e0 08             	shl    $0x8,%eax
+  8006e2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8006e5:	83 c8 3f             	or     $0x3f,%eax
+  8006e8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006eb:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8006ee:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006f1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8006f4:	eb 6d                	jmp    800763 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006f6:	83 ec 08             	sub    $0x8,%esp
+  8006f9:	ff 75 d0             	push   -0x30(%ebp)
+  8006fc:	ff 75 c8             	push   -0x38(%ebp)
+  8006ff:	e8 39 03 00 00       	call   800a3d <strnlen>
+  800704:	89 c2                	mov    %eax,%edx
+  800706:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800709:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80070b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80070e:	c1 e1 08             	shl    $0x8,%ecx
+  800711:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800715:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800717:	83 c4 10             	add    $0x10,%esp
+  80071a:	89 c3                	mov    %eax,%ebx
+  80071c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80071f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800722:	89 ce                	mov    %ecx,%esi
+  800724:	eb 0f                	jmp    800735 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800726:	83 ec 08             	sub    $0x8,%esp
+  800729:	ff 75 0c             	push   0xc(%ebp)
+  80072c:	56                   	push   %esi
+  80072d:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80072f:	83 eb 01             	sub    $0x1,%ebx
+  800732:	83 c4 10             	add    $0x10,%esp
+  800735:	85 db                	test   %ebx,%ebx
+  800737:	7f ed                	jg     800726 <vprintfmt+0x230>
+  800739:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80073c:	8b 75 10             	mov    0x10(%ebp),%esi
+  80073f:	85 c0                	test   %eax,%eax
+  800741:	ba 00 00 00 00       	mov    $0x0,%edx
+  800746:	0f 49 d0             	cmovns %eax,%edx
+  800749:	29 d0                	sub    %edx,%eax
+  80074b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80074e:	eb 8c                	jmp    8006dc <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	ff 75 0c             	push   0xc(%ebp)
+  800756:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800759:	09 c2                	or     %eax,%edx
+  80075b:	52                   	push   %edx
+  80075c:	ff d7                	call   *%edi
+  80075e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800761:	89 d9                	mov    %ebx,%ecx
+  800763:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800766:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80076a:	0f be d0             	movsbl %al,%edx
+  80076d:	85 d2                	test   %edx,%edx
+  80076f:	74 2a                	je     80079b <vprintfmt+0x2a5>
+  800771:	85 f6                	test   %esi,%esi
+  800773:	78 05                	js     80077a <vprintfmt+0x284>
+  800775:	83 ee 01             	sub    $0x1,%esi
+  800778:	78 3b                	js     8007b5 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80077a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80077e:	74 d0                	je     800750 <vprintfmt+0x25a>
+  800780:	0f be c0             	movsbl %al,%eax
+  800783:	83 e8 20             	sub    $0x20,%eax
+  800786:	83 f8 5e             	cmp    $0x5e,%eax
+  800789:	76 c5                	jbe    800750 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80078b:	83 ec 08             	sub    $0x8,%esp
+  80078e:	ff 75 0c             	push   0xc(%ebp)
+  800791:	ff 75 cc             	push   -0x34(%ebp)
+  800794:	ff d7                	call   *%edi
+  800796:	83 c4 10             	add    $0x10,%esp
+  800799:	eb c6                	jmp    800761 <vprintfmt+0x26b>
+  80079b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80079e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8007a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a4:	01 c3                	add    %eax,%ebx
+  8007a6:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8007a8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8007ab:	83 c8 20             	or     $0x20,%eax
+  8007ae:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007b1:	89 c6                	mov    %eax,%esi
+  8007b3:	eb 14                	jmp    8007c9 <vprintfmt+0x2d3>
+  8007b5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8007b8:	eb e4                	jmp    80079e <vprintfmt+0x2a8>
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	ff 75 0c             	push   0xc(%ebp)
+  8007c0:	56                   	push   %esi
+  8007c1:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007c3:	83 eb 01             	sub    $0x1,%ebx
+  8007c6:	83 c4 10             	add    $0x10,%esp
+  8007c9:	85 db                	test   %ebx,%ebx
+  8007cb:	7f ed                	jg     8007ba <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007cd:	8b 75 10             	mov    0x10(%ebp),%esi
+  8007d0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8007d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d6:	e9 49 fd ff ff       	jmp    800524 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007db:	83 f9 01             	cmp    $0x1,%ecx
+  8007de:	7f 1f                	jg     8007ff <vprintfmt+0x309>
+	else if (lflag)
+  8007e0:	85 c9                	test   %ecx,%ecx
+  8007e2:	74 69                	je     80084d <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	8b 00                	mov    (%eax),%eax
+  8007e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ec:	89 c1                	mov    %eax,%ecx
+  8007ee:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fd:	eb 17                	jmp    800816 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8007ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800802:	8b 50 04             	mov    0x4(%eax),%edx
+  800805:	8b 00                	mov    (%eax),%eax
+  800807:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80080a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80080d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800810:	8d 40 08             	lea    0x8(%eax),%eax
+  800813:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800816:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800819:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80081c:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800821:	85 db                	test   %ebx,%ebx
+  800823:	0f 89 f6 00 00 00    	jns    80091f <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800829:	83 ec 08             	sub    $0x8,%esp
+  80082c:	ff 75 0c             	push   0xc(%ebp)
+  80082f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800832:	c1 e0 08             	shl    $0x8,%eax
+  800835:	83 c8 2d             	or     $0x2d,%eax
+  800838:	50                   	push   %eax
+  800839:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80083b:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80083e:	f7 d9                	neg    %ecx
+  800840:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800843:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800848:	e9 d2 00 00 00       	jmp    80091f <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80084d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800850:	8b 00                	mov    (%eax),%eax
+  800852:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800855:	89 c1                	mov    %eax,%ecx
+  800857:	c1 f9 1f             	sar    $0x1f,%ecx
+  80085a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80085d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800860:	8d 40 04             	lea    0x4(%eax),%eax
+  800863:	89 45 14             	mov    %eax,0x14(%ebp)
+  800866:	eb ae                	jmp    800816 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800868:	83 f9 01             	cmp    $0x1,%ecx
+  80086b:	7f 19                	jg     800886 <vprintfmt+0x390>
+	else if (lflag)
+  80086d:	85 c9                	test   %ecx,%ecx
+  80086f:	74 2a                	je     80089b <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800871:	8b 45 14             	mov    0x14(%ebp),%eax
+  800874:	8b 08                	mov    (%eax),%ecx
+  800876:	8d 40 04             	lea    0x4(%eax),%eax
+  800879:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80087c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800881:	e9 99 00 00 00       	jmp    80091f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800886:	8b 45 14             	mov    0x14(%ebp),%eax
+  800889:	8b 08                	mov    (%eax),%ecx
+  80088b:	8d 40 08             	lea    0x8(%eax),%eax
+  80088e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800891:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800896:	e9 84 00 00 00       	jmp    80091f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80089b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089e:	8b 08                	mov    (%eax),%ecx
+  8008a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8008ab:	eb 72                	jmp    80091f <vprintfmt+0x429>
+	if (lflag >= 2)
+  8008ad:	83 f9 01             	cmp    $0x1,%ecx
+  8008b0:	7f 16                	jg     8008c8 <vprintfmt+0x3d2>
+	else if (lflag)
+  8008b2:	85 c9                	test   %ecx,%ecx
+  8008b4:	74 24                	je     8008da <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8008b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b9:	8b 08                	mov    (%eax),%ecx
+  8008bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8008be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008c1:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8008c6:	eb 57                	jmp    80091f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cb:	8b 08                	mov    (%eax),%ecx
+  8008cd:	8d 40 08             	lea    0x8(%eax),%eax
+  8008d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008d3:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8008d8:	eb 45                	jmp    80091f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008dd:	8b 08                	mov    (%eax),%ecx
+  8008df:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8008e5:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8008ea:	eb 33                	jmp    80091f <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8008ec:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008ef:	c1 e3 08             	shl    $0x8,%ebx
+  8008f2:	83 ec 08             	sub    $0x8,%esp
+  8008f5:	ff 75 0c             	push   0xc(%ebp)
+  8008f8:	89 d8                	mov    %ebx,%eax
+  8008fa:	83 c8 30             	or     $0x30,%eax
+  8008fd:	50                   	push   %eax
+  8008fe:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800900:	83 c4 08             	add    $0x8,%esp
+  800903:	ff 75 0c             	push   0xc(%ebp)
+  800906:	83 cb 78             	or     $0x78,%ebx
+  800909:	53                   	push   %ebx
+  80090a:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80090c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090f:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800911:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800914:	8d 40 04             	lea    0x4(%eax),%eax
+  800917:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80091a:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80091f:	ff 75 e4             	push   -0x1c(%ebp)
+  800922:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800926:	52                   	push   %edx
+  800927:	ff 75 e0             	push   -0x20(%ebp)
+  80092a:	50                   	push   %eax
+  80092b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80092e:	89 f8                	mov    %edi,%eax
+  800930:	e8 f7 fa ff ff       	call   80042c <printnum>
+			break;
+  800935:	83 c4 10             	add    $0x10,%esp
+  800938:	e9 e7 fb ff ff       	jmp    800524 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80093d:	83 f9 01             	cmp    $0x1,%ecx
+  800940:	7f 16                	jg     800958 <vprintfmt+0x462>
+	else if (lflag)
+  800942:	85 c9                	test   %ecx,%ecx
+  800944:	74 24                	je     80096a <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800946:	8b 45 14             	mov    0x14(%ebp),%eax
+  800949:	8b 08                	mov    (%eax),%ecx
+  80094b:	8d 40 04             	lea    0x4(%eax),%eax
+  80094e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800951:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800956:	eb c7                	jmp    80091f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800958:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095b:	8b 08                	mov    (%eax),%ecx
+  80095d:	8d 40 08             	lea    0x8(%eax),%eax
+  800960:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800963:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800968:	eb b5                	jmp    80091f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80096a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096d:	8b 08                	mov    (%eax),%ecx
+  80096f:	8d 40 04             	lea    0x4(%eax),%eax
+  800972:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800975:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80097a:	eb a3                	jmp    80091f <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80097c:	83 ec 08             	sub    $0x8,%esp
+  80097f:	ff 75 0c             	push   0xc(%ebp)
+  800982:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800985:	c1 e0 08             	shl    $0x8,%eax
+  800988:	83 c8 25             	or     $0x25,%eax
+  80098b:	50                   	push   %eax
+  80098c:	ff d7                	call   *%edi
+			break;
+  80098e:	83 c4 10             	add    $0x10,%esp
+  800991:	e9 8e fb ff ff       	jmp    800524 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800996:	83 ec 08             	sub    $0x8,%esp
+  800999:	ff 75 0c             	push   0xc(%ebp)
+  80099c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80099f:	c1 e0 08             	shl    $0x8,%eax
+  8009a2:	83 c8 25             	or     $0x25,%eax
+  8009a5:	50                   	push   %eax
+  8009a6:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009a8:	83 c4 10             	add    $0x10,%esp
+  8009ab:	89 de                	mov    %ebx,%esi
+  8009ad:	eb 03                	jmp    8009b2 <vprintfmt+0x4bc>
+  8009af:	83 ee 01             	sub    $0x1,%esi
+  8009b2:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8009b6:	75 f7                	jne    8009af <vprintfmt+0x4b9>
+  8009b8:	e9 67 fb ff ff       	jmp    800524 <vprintfmt+0x2e>
+
+008009bd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009bd:	55                   	push   %ebp
+  8009be:	89 e5                	mov    %esp,%ebp
+  8009c0:	83 ec 18             	sub    $0x18,%esp
+  8009c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009cc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009d0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009d3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009da:	85 c0                	test   %eax,%eax
+  8009dc:	74 26                	je     800a04 <vsnprintf+0x47>
+  8009de:	85 d2                	test   %edx,%edx
+  8009e0:	7e 22                	jle    800a04 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009e2:	ff 75 14             	push   0x14(%ebp)
+  8009e5:	ff 75 10             	push   0x10(%ebp)
+  8009e8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009eb:	50                   	push   %eax
+  8009ec:	68 bc 04 80 00       	push   $0x8004bc
+  8009f1:	e8 00 fb ff ff       	call   8004f6 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009f6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009f9:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009ff:	83 c4 10             	add    $0x10,%esp
+}
+  800a02:	c9                   	leave
+  800a03:	c3                   	ret
+		return -E_INVAL;
+  800a04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a09:	eb f7                	jmp    800a02 <vsnprintf+0x45>
+
+00800a0b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a0b:	55                   	push   %ebp
+  800a0c:	89 e5                	mov    %esp,%ebp
+  800a0e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800a11:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a14:	50                   	push   %eax
+  800a15:	ff 75 10             	push   0x10(%ebp)
+  800a18:	ff 75 0c             	push   0xc(%ebp)
+  800a1b:	ff 75 08             	push   0x8(%ebp)
+  800a1e:	e8 9a ff ff ff       	call   8009bd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a23:	c9                   	leave
+  800a24:	c3                   	ret
+
+00800a25 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a25:	55                   	push   %ebp
+  800a26:	89 e5                	mov    %esp,%ebp
+  800a28:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a30:	eb 03                	jmp    800a35 <strlen+0x10>
+		n++;
+  800a32:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a35:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a39:	75 f7                	jne    800a32 <strlen+0xd>
+	return n;
+}
+  800a3b:	5d                   	pop    %ebp
+  800a3c:	c3                   	ret
+
+00800a3d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a43:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4b:	eb 03                	jmp    800a50 <strnlen+0x13>
+		n++;
+  800a4d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a50:	39 d0                	cmp    %edx,%eax
+  800a52:	74 08                	je     800a5c <strnlen+0x1f>
+  800a54:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a58:	75 f3                	jne    800a4d <strnlen+0x10>
+  800a5a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a5c:	89 d0                	mov    %edx,%eax
+  800a5e:	5d                   	pop    %ebp
+  800a5f:	c3                   	ret
+
+00800a60 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a60:	55                   	push   %ebp
+  800a61:	89 e5                	mov    %esp,%ebp
+  800a63:	53                   	push   %ebx
+  800a64:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a67:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a73:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a76:	83 c0 01             	add    $0x1,%eax
+  800a79:	84 d2                	test   %dl,%dl
+  800a7b:	75 f2                	jne    800a6f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a7d:	89 c8                	mov    %ecx,%eax
+  800a7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a82:	c9                   	leave
+  800a83:	c3                   	ret
+
+00800a84 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a84:	55                   	push   %ebp
+  800a85:	89 e5                	mov    %esp,%ebp
+  800a87:	53                   	push   %ebx
+  800a88:	83 ec 10             	sub    $0x10,%esp
+  800a8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a8e:	53                   	push   %ebx
+  800a8f:	e8 91 ff ff ff       	call   800a25 <strlen>
+  800a94:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a97:	ff 75 0c             	push   0xc(%ebp)
+  800a9a:	01 d8                	add    %ebx,%eax
+  800a9c:	50                   	push   %eax
+  800a9d:	e8 be ff ff ff       	call   800a60 <strcpy>
+	return dst;
+}
+  800aa2:	89 d8                	mov    %ebx,%eax
+  800aa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa7:	c9                   	leave
+  800aa8:	c3                   	ret
+
+00800aa9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	56                   	push   %esi
+  800aad:	53                   	push   %ebx
+  800aae:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ab1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ab4:	89 f3                	mov    %esi,%ebx
+  800ab6:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ab9:	89 f0                	mov    %esi,%eax
+  800abb:	eb 0f                	jmp    800acc <strncpy+0x23>
+		*dst++ = *src;
+  800abd:	83 c0 01             	add    $0x1,%eax
+  800ac0:	0f b6 0a             	movzbl (%edx),%ecx
+  800ac3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ac6:	80 f9 01             	cmp    $0x1,%cl
+  800ac9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800acc:	39 d8                	cmp    %ebx,%eax
+  800ace:	75 ed                	jne    800abd <strncpy+0x14>
+	}
+	return ret;
+}
+  800ad0:	89 f0                	mov    %esi,%eax
+  800ad2:	5b                   	pop    %ebx
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5d                   	pop    %ebp
+  800ad5:	c3                   	ret
+
+00800ad6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	56                   	push   %esi
+  800ada:	53                   	push   %ebx
+  800adb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ade:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ae4:	89 f0                	mov    %esi,%eax
+  800ae6:	85 d2                	test   %edx,%edx
+  800ae8:	74 21                	je     800b0b <strlcpy+0x35>
+  800aea:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800aee:	89 f2                	mov    %esi,%edx
+  800af0:	eb 09                	jmp    800afb <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800af2:	83 c1 01             	add    $0x1,%ecx
+  800af5:	83 c2 01             	add    $0x1,%edx
+  800af8:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800afb:	39 c2                	cmp    %eax,%edx
+  800afd:	74 09                	je     800b08 <strlcpy+0x32>
+  800aff:	0f b6 19             	movzbl (%ecx),%ebx
+  800b02:	84 db                	test   %bl,%bl
+  800b04:	75 ec                	jne    800af2 <strlcpy+0x1c>
+  800b06:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b08:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b0b:	29 f0                	sub    %esi,%eax
+}
+  800b0d:	5b                   	pop    %ebx
+  800b0e:	5e                   	pop    %esi
+  800b0f:	5d                   	pop    %ebp
+  800b10:	c3                   	ret
+
+00800b11 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b17:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b1a:	eb 06                	jmp    800b22 <strcmp+0x11>
+		p++, q++;
+  800b1c:	83 c1 01             	add    $0x1,%ecx
+  800b1f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b22:	0f b6 01             	movzbl (%ecx),%eax
+  800b25:	84 c0                	test   %al,%al
+  800b27:	74 04                	je     800b2d <strcmp+0x1c>
+  800b29:	3a 02                	cmp    (%edx),%al
+  800b2b:	74 ef                	je     800b1c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b2d:	0f b6 c0             	movzbl %al,%eax
+  800b30:	0f b6 12             	movzbl (%edx),%edx
+  800b33:	29 d0                	sub    %edx,%eax
+}
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	53                   	push   %ebx
+  800b3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b41:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b44:	eb 09                	jmp    800b4f <strncmp+0x18>
+		n--, p++, q++;
+  800b46:	83 ea 01             	sub    $0x1,%edx
+  800b49:	83 c0 01             	add    $0x1,%eax
+  800b4c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b4f:	85 d2                	test   %edx,%edx
+  800b51:	74 18                	je     800b6b <strncmp+0x34>
+  800b53:	0f b6 18             	movzbl (%eax),%ebx
+  800b56:	84 db                	test   %bl,%bl
+  800b58:	74 04                	je     800b5e <strncmp+0x27>
+  800b5a:	3a 19                	cmp    (%ecx),%bl
+  800b5c:	74 e8                	je     800b46 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b5e:	0f b6 00             	movzbl (%eax),%eax
+  800b61:	0f b6 11             	movzbl (%ecx),%edx
+  800b64:	29 d0                	sub    %edx,%eax
+}
+  800b66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b69:	c9                   	leave
+  800b6a:	c3                   	ret
+		return 0;
+  800b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b70:	eb f4                	jmp    800b66 <strncmp+0x2f>
+
+00800b72 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b78:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b7c:	eb 03                	jmp    800b81 <strchr+0xf>
+  800b7e:	83 c0 01             	add    $0x1,%eax
+  800b81:	0f b6 10             	movzbl (%eax),%edx
+  800b84:	84 d2                	test   %dl,%dl
+  800b86:	74 06                	je     800b8e <strchr+0x1c>
+		if (*s == c)
+  800b88:	38 ca                	cmp    %cl,%dl
+  800b8a:	75 f2                	jne    800b7e <strchr+0xc>
+  800b8c:	eb 05                	jmp    800b93 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b93:	5d                   	pop    %ebp
+  800b94:	c3                   	ret
+
+00800b95 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b95:	55                   	push   %ebp
+  800b96:	89 e5                	mov    %esp,%ebp
+  800b98:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b9f:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ba2:	38 ca                	cmp    %cl,%dl
+  800ba4:	74 09                	je     800baf <strfind+0x1a>
+  800ba6:	84 d2                	test   %dl,%dl
+  800ba8:	74 05                	je     800baf <strfind+0x1a>
+	for (; *s; s++)
+  800baa:	83 c0 01             	add    $0x1,%eax
+  800bad:	eb f0                	jmp    800b9f <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800baf:	5d                   	pop    %ebp
+  800bb0:	c3                   	ret
+
+00800bb1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bb1:	55                   	push   %ebp
+  800bb2:	89 e5                	mov    %esp,%ebp
+  800bb4:	57                   	push   %edi
+  800bb5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bb8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bbb:	85 c9                	test   %ecx,%ecx
+  800bbd:	74 20                	je     800bdf <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bbf:	89 f8                	mov    %edi,%eax
+  800bc1:	09 c8                	or     %ecx,%eax
+  800bc3:	a8 03                	test   $0x3,%al
+  800bc5:	75 12                	jne    800bd9 <memset+0x28>
+		c &= 0xFF;
+  800bc7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bcb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bd1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bd4:	fc                   	cld
+  800bd5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bd7:	eb 06                	jmp    800bdf <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bdc:	fc                   	cld
+  800bdd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bdf:	89 f8                	mov    %edi,%eax
+  800be1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800be4:	c9                   	leave
+  800be5:	c3                   	ret
+
+00800be6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800be6:	55                   	push   %ebp
+  800be7:	89 e5                	mov    %esp,%ebp
+  800be9:	57                   	push   %edi
+  800bea:	56                   	push   %esi
+  800beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bf1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bf4:	39 c6                	cmp    %eax,%esi
+  800bf6:	73 32                	jae    800c2a <memmove+0x44>
+  800bf8:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bfb:	39 d0                	cmp    %edx,%eax
+  800bfd:	73 2b                	jae    800c2a <memmove+0x44>
+		s += n;
+		d += n;
+  800bff:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c02:	89 d6                	mov    %edx,%esi
+  800c04:	09 fe                	or     %edi,%esi
+  800c06:	09 ce                	or     %ecx,%esi
+  800c08:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c0e:	75 0e                	jne    800c1e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c10:	83 ef 04             	sub    $0x4,%edi
+  800c13:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c16:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c19:	fd                   	std
+  800c1a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c1c:	eb 09                	jmp    800c27 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c1e:	83 ef 01             	sub    $0x1,%edi
+  800c21:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c24:	fd                   	std
+  800c25:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c27:	fc                   	cld
+  800c28:	eb 1a                	jmp    800c44 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c2a:	89 f2                	mov    %esi,%edx
+  800c2c:	09 c2                	or     %eax,%edx
+  800c2e:	09 ca                	or     %ecx,%edx
+  800c30:	f6 c2 03             	test   $0x3,%dl
+  800c33:	75 0a                	jne    800c3f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c35:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c38:	89 c7                	mov    %eax,%edi
+  800c3a:	fc                   	cld
+  800c3b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c3d:	eb 05                	jmp    800c44 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c3f:	89 c7                	mov    %eax,%edi
+  800c41:	fc                   	cld
+  800c42:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c44:	5e                   	pop    %esi
+  800c45:	5f                   	pop    %edi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+
+00800c48 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c4e:	ff 75 10             	push   0x10(%ebp)
+  800c51:	ff 75 0c             	push   0xc(%ebp)
+  800c54:	ff 75 08             	push   0x8(%ebp)
+  800c57:	e8 8a ff ff ff       	call   800be6 <memmove>
+}
+  800c5c:	c9                   	leave
+  800c5d:	c3                   	ret
+
+00800c5e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	56                   	push   %esi
+  800c62:	53                   	push   %ebx
+  800c63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c66:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c69:	89 c6                	mov    %eax,%esi
+  800c6b:	03 75 10             	add    0x10(%ebp),%esi
+  800c6e:	eb 06                	jmp    800c76 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c70:	83 c0 01             	add    $0x1,%eax
+  800c73:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c76:	39 f0                	cmp    %esi,%eax
+  800c78:	74 14                	je     800c8e <memcmp+0x30>
+		if (*s1 != *s2)
+  800c7a:	0f b6 08             	movzbl (%eax),%ecx
+  800c7d:	0f b6 1a             	movzbl (%edx),%ebx
+  800c80:	38 d9                	cmp    %bl,%cl
+  800c82:	74 ec                	je     800c70 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c84:	0f b6 c1             	movzbl %cl,%eax
+  800c87:	0f b6 db             	movzbl %bl,%ebx
+  800c8a:	29 d8                	sub    %ebx,%eax
+  800c8c:	eb 05                	jmp    800c93 <memcmp+0x35>
+	}
+
+	return 0;
+  800c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c93:	5b                   	pop    %ebx
+  800c94:	5e                   	pop    %esi
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+
+00800c97 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ca0:	89 c2                	mov    %eax,%edx
+  800ca2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ca5:	eb 03                	jmp    800caa <memfind+0x13>
+  800ca7:	83 c0 01             	add    $0x1,%eax
+  800caa:	39 d0                	cmp    %edx,%eax
+  800cac:	73 04                	jae    800cb2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cae:	38 08                	cmp    %cl,(%eax)
+  800cb0:	75 f5                	jne    800ca7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+
+00800cb4 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	57                   	push   %edi
+  800cb8:	56                   	push   %esi
+  800cb9:	53                   	push   %ebx
+  800cba:	83 ec 1c             	sub    $0x1c,%esp
+  800cbd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cc0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cc3:	eb 03                	jmp    800cc8 <strtol+0x14>
+		s++;
+  800cc5:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800cc8:	0f b6 06             	movzbl (%esi),%eax
+  800ccb:	3c 20                	cmp    $0x20,%al
+  800ccd:	74 f6                	je     800cc5 <strtol+0x11>
+  800ccf:	3c 09                	cmp    $0x9,%al
+  800cd1:	74 f2                	je     800cc5 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cd3:	3c 2b                	cmp    $0x2b,%al
+  800cd5:	74 43                	je     800d1a <strtol+0x66>
+	int neg = 0;
+  800cd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800cdc:	3c 2d                	cmp    $0x2d,%al
+  800cde:	74 44                	je     800d24 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ce0:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ce6:	75 0f                	jne    800cf7 <strtol+0x43>
+  800ce8:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ceb:	74 41                	je     800d2e <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ced:	85 ff                	test   %edi,%edi
+  800cef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cf4:	0f 44 f8             	cmove  %eax,%edi
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800d01:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800d04:	89 fb                	mov    %edi,%ebx
+  800d06:	c1 fb 1f             	sar    $0x1f,%ebx
+  800d09:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800d0c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800d0f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d12:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800d15:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d18:	eb 67                	jmp    800d81 <strtol+0xcd>
+		s++;
+  800d1a:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800d1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d22:	eb bc                	jmp    800ce0 <strtol+0x2c>
+		s++, neg = 1;
+  800d24:	83 c6 01             	add    $0x1,%esi
+  800d27:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d2c:	eb b2                	jmp    800ce0 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d2e:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800d32:	74 0e                	je     800d42 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800d34:	85 ff                	test   %edi,%edi
+  800d36:	75 bf                	jne    800cf7 <strtol+0x43>
+		s++, base = 8;
+  800d38:	83 c6 01             	add    $0x1,%esi
+  800d3b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800d40:	eb b5                	jmp    800cf7 <strtol+0x43>
+		s += 2, base = 16;
+  800d42:	83 c6 02             	add    $0x2,%esi
+  800d45:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d4a:	eb ab                	jmp    800cf7 <strtol+0x43>
+			dig = *s - '0';
+  800d4c:	0f be c9             	movsbl %cl,%ecx
+  800d4f:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800d52:	39 f9                	cmp    %edi,%ecx
+  800d54:	7d 59                	jge    800daf <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800d56:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800d5a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d5d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d60:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d63:	0f af d8             	imul   %eax,%ebx
+  800d66:	0f af d7             	imul   %edi,%edx
+  800d69:	01 d3                	add    %edx,%ebx
+  800d6b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d6e:	f7 e7                	mul    %edi
+  800d70:	01 da                	add    %ebx,%edx
+  800d72:	89 cb                	mov    %ecx,%ebx
+  800d74:	c1 fb 1f             	sar    $0x1f,%ebx
+  800d77:	01 c8                	add    %ecx,%eax
+  800d79:	11 da                	adc    %ebx,%edx
+  800d7b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d7e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d84:	0f b6 08             	movzbl (%eax),%ecx
+  800d87:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800d8a:	80 fb 09             	cmp    $0x9,%bl
+  800d8d:	76 bd                	jbe    800d4c <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800d8f:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800d92:	80 fb 19             	cmp    $0x19,%bl
+  800d95:	77 08                	ja     800d9f <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800d97:	0f be c9             	movsbl %cl,%ecx
+  800d9a:	83 e9 57             	sub    $0x57,%ecx
+  800d9d:	eb b3                	jmp    800d52 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d9f:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800da2:	80 fb 19             	cmp    $0x19,%bl
+  800da5:	77 08                	ja     800daf <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800da7:	0f be c9             	movsbl %cl,%ecx
+  800daa:	83 e9 37             	sub    $0x37,%ecx
+  800dad:	eb a3                	jmp    800d52 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800daf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800db2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800db5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800db8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dbb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dbf:	74 05                	je     800dc6 <strtol+0x112>
+		*endptr = (char *) s;
+  800dc1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800dc4:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800dc6:	85 c9                	test   %ecx,%ecx
+  800dc8:	74 07                	je     800dd1 <strtol+0x11d>
+  800dca:	f7 d8                	neg    %eax
+  800dcc:	83 d2 00             	adc    $0x0,%edx
+  800dcf:	f7 da                	neg    %edx
+}
+  800dd1:	83 c4 1c             	add    $0x1c,%esp
+  800dd4:	5b                   	pop    %ebx
+  800dd5:	5e                   	pop    %esi
+  800dd6:	5f                   	pop    %edi
+  800dd7:	5d                   	pop    %ebp
+  800dd8:	c3                   	ret
+
+00800dd9 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800dd9:	55                   	push   %ebp
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	57                   	push   %edi
+  800ddd:	56                   	push   %esi
+  800dde:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ddf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800de6:	74 18                	je     800e00 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800de8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ded:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df3:	89 c3                	mov    %eax,%ebx
+  800df5:	89 c7                	mov    %eax,%edi
+  800df7:	89 c6                	mov    %eax,%esi
+  800df9:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800dfb:	5b                   	pop    %ebx
+  800dfc:	5e                   	pop    %esi
+  800dfd:	5f                   	pop    %edi
+  800dfe:	5d                   	pop    %ebp
+  800dff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0b:	89 c3                	mov    %eax,%ebx
+  800e0d:	89 c7                	mov    %eax,%edi
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	8d 35 1a 0e 80 00    	lea    0x800e1a,%esi
+  800e18:	0f 34                	sysenter
+  800e1a:	5d                   	pop    %ebp
+		goto out;
+  800e1b:	eb de                	jmp    800dfb <sys_cputs+0x22>
+
+00800e1d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e1d:	55                   	push   %ebp
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	57                   	push   %edi
+  800e21:	56                   	push   %esi
+  800e22:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e23:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e2a:	74 19                	je     800e45 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800e2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e31:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e36:	89 d1                	mov    %edx,%ecx
+  800e38:	89 d3                	mov    %edx,%ebx
+  800e3a:	89 d7                	mov    %edx,%edi
+  800e3c:	89 d6                	mov    %edx,%esi
+  800e3e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e40:	5b                   	pop    %ebx
+  800e41:	5e                   	pop    %esi
+  800e42:	5f                   	pop    %edi
+  800e43:	5d                   	pop    %ebp
+  800e44:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e4f:	89 d1                	mov    %edx,%ecx
+  800e51:	89 d3                	mov    %edx,%ebx
+  800e53:	89 d7                	mov    %edx,%edi
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	8d 35 60 0e 80 00    	lea    0x800e60,%esi
+  800e5e:	0f 34                	sysenter
+  800e60:	5d                   	pop    %ebp
+		goto out;
+  800e61:	eb dd                	jmp    800e40 <sys_cgetc+0x23>
+
+00800e63 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+  800e69:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e6c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e73:	74 21                	je     800e96 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800e75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e7a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	89 cb                	mov    %ecx,%ebx
+  800e84:	89 cf                	mov    %ecx,%edi
+  800e86:	89 ce                	mov    %ecx,%esi
+  800e88:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8a:	85 c0                	test   %eax,%eax
+  800e8c:	7f 27                	jg     800eb5 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e91:	5b                   	pop    %ebx
+  800e92:	5e                   	pop    %esi
+  800e93:	5f                   	pop    %edi
+  800e94:	5d                   	pop    %ebp
+  800e95:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ea3:	89 cb                	mov    %ecx,%ebx
+  800ea5:	89 cf                	mov    %ecx,%edi
+  800ea7:	55                   	push   %ebp
+  800ea8:	89 e5                	mov    %esp,%ebp
+  800eaa:	8d 35 b2 0e 80 00    	lea    0x800eb2,%esi
+  800eb0:	0f 34                	sysenter
+  800eb2:	5d                   	pop    %ebp
+		goto out;
+  800eb3:	eb d5                	jmp    800e8a <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb5:	83 ec 0c             	sub    $0xc,%esp
+  800eb8:	50                   	push   %eax
+  800eb9:	6a 03                	push   $0x3
+  800ebb:	68 eb 33 80 00       	push   $0x8033eb
+  800ec0:	6a 3f                	push   $0x3f
+  800ec2:	68 08 34 80 00       	push   $0x803408
+  800ec7:	e8 71 f4 ff ff       	call   80033d <_panic>
+
+00800ecc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ecc:	55                   	push   %ebp
+  800ecd:	89 e5                	mov    %esp,%ebp
+  800ecf:	57                   	push   %edi
+  800ed0:	56                   	push   %esi
+  800ed1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ed2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ed9:	74 19                	je     800ef4 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800edb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ee5:	89 d1                	mov    %edx,%ecx
+  800ee7:	89 d3                	mov    %edx,%ebx
+  800ee9:	89 d7                	mov    %edx,%edi
+  800eeb:	89 d6                	mov    %edx,%esi
+  800eed:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800efe:	89 d1                	mov    %edx,%ecx
+  800f00:	89 d3                	mov    %edx,%ebx
+  800f02:	89 d7                	mov    %edx,%edi
+  800f04:	55                   	push   %ebp
+  800f05:	89 e5                	mov    %esp,%ebp
+  800f07:	8d 35 0f 0f 80 00    	lea    0x800f0f,%esi
+  800f0d:	0f 34                	sysenter
+  800f0f:	5d                   	pop    %ebp
+		goto out;
+  800f10:	eb dd                	jmp    800eef <sys_getenvid+0x23>
+
+00800f12 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	56                   	push   %esi
+  800f17:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f18:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f1f:	74 19                	je     800f3a <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800f21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f26:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f2b:	89 d1                	mov    %edx,%ecx
+  800f2d:	89 d3                	mov    %edx,%ebx
+  800f2f:	89 d7                	mov    %edx,%edi
+  800f31:	89 d6                	mov    %edx,%esi
+  800f33:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f35:	5b                   	pop    %ebx
+  800f36:	5e                   	pop    %esi
+  800f37:	5f                   	pop    %edi
+  800f38:	5d                   	pop    %ebp
+  800f39:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f3f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f44:	89 d1                	mov    %edx,%ecx
+  800f46:	89 d3                	mov    %edx,%ebx
+  800f48:	89 d7                	mov    %edx,%edi
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	8d 35 55 0f 80 00    	lea    0x800f55,%esi
+  800f53:	0f 34                	sysenter
+  800f55:	5d                   	pop    %ebp
+		goto out;
+  800f56:	eb dd                	jmp    800f35 <sys_yield+0x23>
+
+00800f58 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f58:	55                   	push   %ebp
+  800f59:	89 e5                	mov    %esp,%ebp
+  800f5b:	57                   	push   %edi
+  800f5c:	56                   	push   %esi
+  800f5d:	53                   	push   %ebx
+  800f5e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f61:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f68:	74 23                	je     800f8d <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800f6a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f6f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7d:	89 f7                	mov    %esi,%edi
+  800f7f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f81:	85 c0                	test   %eax,%eax
+  800f83:	7f 29                	jg     800fae <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f93:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	8d 35 ab 0f 80 00    	lea    0x800fab,%esi
+  800fa9:	0f 34                	sysenter
+  800fab:	5d                   	pop    %ebp
+		goto out;
+  800fac:	eb d3                	jmp    800f81 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fae:	83 ec 0c             	sub    $0xc,%esp
+  800fb1:	50                   	push   %eax
+  800fb2:	6a 04                	push   $0x4
+  800fb4:	68 eb 33 80 00       	push   $0x8033eb
+  800fb9:	6a 3f                	push   $0x3f
+  800fbb:	68 08 34 80 00       	push   $0x803408
+  800fc0:	e8 78 f3 ff ff       	call   80033d <_panic>
+
+00800fc5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fc5:	55                   	push   %ebp
+  800fc6:	89 e5                	mov    %esp,%ebp
+  800fc8:	57                   	push   %edi
+  800fc9:	56                   	push   %esi
+  800fca:	53                   	push   %ebx
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+  800fce:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800fd1:	85 f6                	test   %esi,%esi
+  800fd3:	75 09                	jne    800fde <sys_page_map+0x19>
+  800fd5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fdc:	74 1f                	je     800ffd <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800fde:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff1:	85 c0                	test   %eax,%eax
+  800ff3:	7f 27                	jg     80101c <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801003:	b8 05 00 00 00       	mov    $0x5,%eax
+  801008:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	8d 35 19 10 80 00    	lea    0x801019,%esi
+  801017:	0f 34                	sysenter
+  801019:	5d                   	pop    %ebp
+		goto out;
+  80101a:	eb d5                	jmp    800ff1 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101c:	83 ec 0c             	sub    $0xc,%esp
+  80101f:	50                   	push   %eax
+  801020:	6a 05                	push   $0x5
+  801022:	68 eb 33 80 00       	push   $0x8033eb
+  801027:	6a 3f                	push   $0x3f
+  801029:	68 08 34 80 00       	push   $0x803408
+  80102e:	e8 0a f3 ff ff       	call   80033d <_panic>
+
+00801033 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	57                   	push   %edi
+  801037:	56                   	push   %esi
+  801038:	53                   	push   %ebx
+  801039:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80103c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801043:	74 22                	je     801067 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801045:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80104f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801052:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801055:	89 df                	mov    %ebx,%edi
+  801057:	89 de                	mov    %ebx,%esi
+  801059:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105b:	85 c0                	test   %eax,%eax
+  80105d:	7f 28                	jg     801087 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80105f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801062:	5b                   	pop    %ebx
+  801063:	5e                   	pop    %esi
+  801064:	5f                   	pop    %edi
+  801065:	5d                   	pop    %ebp
+  801066:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801067:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801072:	b8 06 00 00 00       	mov    $0x6,%eax
+  801077:	89 df                	mov    %ebx,%edi
+  801079:	55                   	push   %ebp
+  80107a:	89 e5                	mov    %esp,%ebp
+  80107c:	8d 35 84 10 80 00    	lea    0x801084,%esi
+  801082:	0f 34                	sysenter
+  801084:	5d                   	pop    %ebp
+		goto out;
+  801085:	eb d4                	jmp    80105b <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801087:	83 ec 0c             	sub    $0xc,%esp
+  80108a:	50                   	push   %eax
+  80108b:	6a 06                	push   $0x6
+  80108d:	68 eb 33 80 00       	push   $0x8033eb
+  801092:	6a 3f                	push   $0x3f
+  801094:	68 08 34 80 00       	push   $0x803408
+  801099:	e8 9f f2 ff ff       	call   80033d <_panic>
+
+0080109e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	57                   	push   %edi
+  8010a2:	56                   	push   %esi
+  8010a3:	53                   	push   %ebx
+  8010a4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010a7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010ae:	74 22                	je     8010d2 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8010b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c0:	89 df                	mov    %ebx,%edi
+  8010c2:	89 de                	mov    %ebx,%esi
+  8010c4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	7f 28                	jg     8010f2 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cd:	5b                   	pop    %ebx
+  8010ce:	5e                   	pop    %esi
+  8010cf:	5f                   	pop    %edi
+  8010d0:	5d                   	pop    %ebp
+  8010d1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010dd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010e2:	89 df                	mov    %ebx,%edi
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	8d 35 ef 10 80 00    	lea    0x8010ef,%esi
+  8010ed:	0f 34                	sysenter
+  8010ef:	5d                   	pop    %ebp
+		goto out;
+  8010f0:	eb d4                	jmp    8010c6 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f2:	83 ec 0c             	sub    $0xc,%esp
+  8010f5:	50                   	push   %eax
+  8010f6:	6a 08                	push   $0x8
+  8010f8:	68 eb 33 80 00       	push   $0x8033eb
+  8010fd:	6a 3f                	push   $0x3f
+  8010ff:	68 08 34 80 00       	push   $0x803408
+  801104:	e8 34 f2 ff ff       	call   80033d <_panic>
+
+00801109 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801112:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801119:	74 22                	je     80113d <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80111b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801120:	b8 09 00 00 00       	mov    $0x9,%eax
+  801125:	8b 55 08             	mov    0x8(%ebp),%edx
+  801128:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112b:	89 df                	mov    %ebx,%edi
+  80112d:	89 de                	mov    %ebx,%esi
+  80112f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801131:	85 c0                	test   %eax,%eax
+  801133:	7f 28                	jg     80115d <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801135:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801138:	5b                   	pop    %ebx
+  801139:	5e                   	pop    %esi
+  80113a:	5f                   	pop    %edi
+  80113b:	5d                   	pop    %ebp
+  80113c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80113d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801142:	8b 55 08             	mov    0x8(%ebp),%edx
+  801145:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801148:	b8 09 00 00 00       	mov    $0x9,%eax
+  80114d:	89 df                	mov    %ebx,%edi
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	8d 35 5a 11 80 00    	lea    0x80115a,%esi
+  801158:	0f 34                	sysenter
+  80115a:	5d                   	pop    %ebp
+		goto out;
+  80115b:	eb d4                	jmp    801131 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115d:	83 ec 0c             	sub    $0xc,%esp
+  801160:	50                   	push   %eax
+  801161:	6a 09                	push   $0x9
+  801163:	68 eb 33 80 00       	push   $0x8033eb
+  801168:	6a 3f                	push   $0x3f
+  80116a:	68 08 34 80 00       	push   $0x803408
+  80116f:	e8 c9 f1 ff ff       	call   80033d <_panic>
+
+00801174 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801174:	55                   	push   %ebp
+  801175:	89 e5                	mov    %esp,%ebp
+  801177:	57                   	push   %edi
+  801178:	56                   	push   %esi
+  801179:	53                   	push   %ebx
+  80117a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80117d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801184:	74 22                	je     8011a8 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801190:	8b 55 08             	mov    0x8(%ebp),%edx
+  801193:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801196:	89 df                	mov    %ebx,%edi
+  801198:	89 de                	mov    %ebx,%esi
+  80119a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80119c:	85 c0                	test   %eax,%eax
+  80119e:	7f 28                	jg     8011c8 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a3:	5b                   	pop    %ebx
+  8011a4:	5e                   	pop    %esi
+  8011a5:	5f                   	pop    %edi
+  8011a6:	5d                   	pop    %ebp
+  8011a7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011b8:	89 df                	mov    %ebx,%edi
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	8d 35 c5 11 80 00    	lea    0x8011c5,%esi
+  8011c3:	0f 34                	sysenter
+  8011c5:	5d                   	pop    %ebp
+		goto out;
+  8011c6:	eb d4                	jmp    80119c <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011c8:	83 ec 0c             	sub    $0xc,%esp
+  8011cb:	50                   	push   %eax
+  8011cc:	6a 0a                	push   $0xa
+  8011ce:	68 eb 33 80 00       	push   $0x8033eb
+  8011d3:	6a 3f                	push   $0x3f
+  8011d5:	68 08 34 80 00       	push   $0x803408
+  8011da:	e8 5e f1 ff ff       	call   80033d <_panic>
+
+008011df <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	57                   	push   %edi
+  8011e3:	56                   	push   %esi
+  8011e4:	53                   	push   %ebx
+  8011e5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011e8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011ef:	74 22                	je     801213 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8011f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801201:	89 df                	mov    %ebx,%edi
+  801203:	89 de                	mov    %ebx,%esi
+  801205:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801207:	85 c0                	test   %eax,%eax
+  801209:	7f 28                	jg     801233 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80120b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120e:	5b                   	pop    %ebx
+  80120f:	5e                   	pop    %esi
+  801210:	5f                   	pop    %edi
+  801211:	5d                   	pop    %ebp
+  801212:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801218:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801223:	89 df                	mov    %ebx,%edi
+  801225:	55                   	push   %ebp
+  801226:	89 e5                	mov    %esp,%ebp
+  801228:	8d 35 30 12 80 00    	lea    0x801230,%esi
+  80122e:	0f 34                	sysenter
+  801230:	5d                   	pop    %ebp
+		goto out;
+  801231:	eb d4                	jmp    801207 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801233:	83 ec 0c             	sub    $0xc,%esp
+  801236:	50                   	push   %eax
+  801237:	6a 17                	push   $0x17
+  801239:	68 eb 33 80 00       	push   $0x8033eb
+  80123e:	6a 3f                	push   $0x3f
+  801240:	68 08 34 80 00       	push   $0x803408
+  801245:	e8 f3 f0 ff ff       	call   80033d <_panic>
+
+0080124a <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	57                   	push   %edi
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+  801250:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801253:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80125a:	74 22                	je     80127e <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80125c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801261:	b8 18 00 00 00       	mov    $0x18,%eax
+  801266:	8b 55 08             	mov    0x8(%ebp),%edx
+  801269:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126c:	89 df                	mov    %ebx,%edi
+  80126e:	89 de                	mov    %ebx,%esi
+  801270:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801272:	85 c0                	test   %eax,%eax
+  801274:	7f 28                	jg     80129e <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801279:	5b                   	pop    %ebx
+  80127a:	5e                   	pop    %esi
+  80127b:	5f                   	pop    %edi
+  80127c:	5d                   	pop    %ebp
+  80127d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80127e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801283:	8b 55 08             	mov    0x8(%ebp),%edx
+  801286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801289:	b8 18 00 00 00       	mov    $0x18,%eax
+  80128e:	89 df                	mov    %ebx,%edi
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	8d 35 9b 12 80 00    	lea    0x80129b,%esi
+  801299:	0f 34                	sysenter
+  80129b:	5d                   	pop    %ebp
+		goto out;
+  80129c:	eb d4                	jmp    801272 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80129e:	83 ec 0c             	sub    $0xc,%esp
+  8012a1:	50                   	push   %eax
+  8012a2:	6a 18                	push   $0x18
+  8012a4:	68 eb 33 80 00       	push   $0x8033eb
+  8012a9:	6a 3f                	push   $0x3f
+  8012ab:	68 08 34 80 00       	push   $0x803408
+  8012b0:	e8 88 f0 ff ff       	call   80033d <_panic>
+
+008012b5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	57                   	push   %edi
+  8012b9:	56                   	push   %esi
+  8012ba:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012bb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012c2:	74 1d                	je     8012e1 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8012c4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012da:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8012dc:	5b                   	pop    %ebx
+  8012dd:	5e                   	pop    %esi
+  8012de:	5f                   	pop    %edi
+  8012df:	5d                   	pop    %ebp
+  8012e0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012f2:	55                   	push   %ebp
+  8012f3:	89 e5                	mov    %esp,%ebp
+  8012f5:	8d 35 fd 12 80 00    	lea    0x8012fd,%esi
+  8012fb:	0f 34                	sysenter
+  8012fd:	5d                   	pop    %ebp
+		goto out;
+  8012fe:	eb dc                	jmp    8012dc <sys_ipc_try_send+0x27>
+
+00801300 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801300:	55                   	push   %ebp
+  801301:	89 e5                	mov    %esp,%ebp
+  801303:	57                   	push   %edi
+  801304:	56                   	push   %esi
+  801305:	53                   	push   %ebx
+  801306:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801309:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801310:	74 21                	je     801333 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801312:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801317:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80131c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131f:	89 cb                	mov    %ecx,%ebx
+  801321:	89 cf                	mov    %ecx,%edi
+  801323:	89 ce                	mov    %ecx,%esi
+  801325:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801327:	85 c0                	test   %eax,%eax
+  801329:	7f 27                	jg     801352 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80132b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132e:	5b                   	pop    %ebx
+  80132f:	5e                   	pop    %esi
+  801330:	5f                   	pop    %edi
+  801331:	5d                   	pop    %ebp
+  801332:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801333:	8b 55 08             	mov    0x8(%ebp),%edx
+  801336:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80133b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801340:	89 cb                	mov    %ecx,%ebx
+  801342:	89 cf                	mov    %ecx,%edi
+  801344:	55                   	push   %ebp
+  801345:	89 e5                	mov    %esp,%ebp
+  801347:	8d 35 4f 13 80 00    	lea    0x80134f,%esi
+  80134d:	0f 34                	sysenter
+  80134f:	5d                   	pop    %ebp
+		goto out;
+  801350:	eb d5                	jmp    801327 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801352:	83 ec 0c             	sub    $0xc,%esp
+  801355:	50                   	push   %eax
+  801356:	6a 0d                	push   $0xd
+  801358:	68 eb 33 80 00       	push   $0x8033eb
+  80135d:	6a 3f                	push   $0x3f
+  80135f:	68 08 34 80 00       	push   $0x803408
+  801364:	e8 d4 ef ff ff       	call   80033d <_panic>
+
+00801369 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	57                   	push   %edi
+  80136d:	56                   	push   %esi
+  80136e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80136f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801376:	74 1b                	je     801393 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801378:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801382:	8b 55 08             	mov    0x8(%ebp),%edx
+  801385:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801388:	89 df                	mov    %ebx,%edi
+  80138a:	89 de                	mov    %ebx,%esi
+  80138c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80138e:	5b                   	pop    %ebx
+  80138f:	5e                   	pop    %esi
+  801390:	5f                   	pop    %edi
+  801391:	5d                   	pop    %ebp
+  801392:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801393:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801398:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013a3:	89 df                	mov    %ebx,%edi
+  8013a5:	55                   	push   %ebp
+  8013a6:	89 e5                	mov    %esp,%ebp
+  8013a8:	8d 35 b0 13 80 00    	lea    0x8013b0,%esi
+  8013ae:	0f 34                	sysenter
+  8013b0:	5d                   	pop    %ebp
+		goto out;
+  8013b1:	eb db                	jmp    80138e <sys_ipc_recv_until+0x25>
+
+008013b3 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8013b3:	55                   	push   %ebp
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	57                   	push   %edi
+  8013b7:	56                   	push   %esi
+  8013b8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013b9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013c0:	74 19                	je     8013db <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8013c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013cc:	89 d1                	mov    %edx,%ecx
+  8013ce:	89 d3                	mov    %edx,%ebx
+  8013d0:	89 d7                	mov    %edx,%edi
+  8013d2:	89 d6                	mov    %edx,%esi
+  8013d4:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8013d6:	5b                   	pop    %ebx
+  8013d7:	5e                   	pop    %esi
+  8013d8:	5f                   	pop    %edi
+  8013d9:	5d                   	pop    %ebp
+  8013da:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013e5:	89 d1                	mov    %edx,%ecx
+  8013e7:	89 d3                	mov    %edx,%ebx
+  8013e9:	89 d7                	mov    %edx,%edi
+  8013eb:	55                   	push   %ebp
+  8013ec:	89 e5                	mov    %esp,%ebp
+  8013ee:	8d 35 f6 13 80 00    	lea    0x8013f6,%esi
+  8013f4:	0f 34                	sysenter
+  8013f6:	5d                   	pop    %ebp
+		goto out;
+  8013f7:	eb dd                	jmp    8013d6 <sys_time_msec+0x23>
+
+008013f9 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	57                   	push   %edi
+  8013fd:	56                   	push   %esi
+  8013fe:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013ff:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801406:	74 1a                	je     801422 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801408:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80140d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801412:	8b 55 08             	mov    0x8(%ebp),%edx
+  801415:	89 cb                	mov    %ecx,%ebx
+  801417:	89 cf                	mov    %ecx,%edi
+  801419:	89 ce                	mov    %ecx,%esi
+  80141b:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80141d:	5b                   	pop    %ebx
+  80141e:	5e                   	pop    %esi
+  80141f:	5f                   	pop    %edi
+  801420:	5d                   	pop    %ebp
+  801421:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801422:	8b 55 08             	mov    0x8(%ebp),%edx
+  801425:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80142a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80142f:	89 cb                	mov    %ecx,%ebx
+  801431:	89 cf                	mov    %ecx,%edi
+  801433:	55                   	push   %ebp
+  801434:	89 e5                	mov    %esp,%ebp
+  801436:	8d 35 3e 14 80 00    	lea    0x80143e,%esi
+  80143c:	0f 34                	sysenter
+  80143e:	5d                   	pop    %ebp
+		goto out;
+  80143f:	eb dc                	jmp    80141d <sys_sleep_until+0x24>
+
+00801441 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801441:	55                   	push   %ebp
+  801442:	89 e5                	mov    %esp,%ebp
+  801444:	57                   	push   %edi
+  801445:	56                   	push   %esi
+  801446:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801447:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80144e:	74 1a                	je     80146a <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801455:	b8 11 00 00 00       	mov    $0x11,%eax
+  80145a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145d:	89 cb                	mov    %ecx,%ebx
+  80145f:	89 cf                	mov    %ecx,%edi
+  801461:	89 ce                	mov    %ecx,%esi
+  801463:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801465:	5b                   	pop    %ebx
+  801466:	5e                   	pop    %esi
+  801467:	5f                   	pop    %edi
+  801468:	5d                   	pop    %ebp
+  801469:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80146a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801472:	b8 11 00 00 00       	mov    $0x11,%eax
+  801477:	89 cb                	mov    %ecx,%ebx
+  801479:	89 cf                	mov    %ecx,%edi
+  80147b:	55                   	push   %ebp
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	8d 35 86 14 80 00    	lea    0x801486,%esi
+  801484:	0f 34                	sysenter
+  801486:	5d                   	pop    %ebp
+		goto out;
+  801487:	eb dc                	jmp    801465 <sys_env_print_stats+0x24>
+
+00801489 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801489:	55                   	push   %ebp
+  80148a:	89 e5                	mov    %esp,%ebp
+  80148c:	57                   	push   %edi
+  80148d:	56                   	push   %esi
+  80148e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80148f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801496:	74 1b                	je     8014b3 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801498:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80149d:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a8:	89 df                	mov    %ebx,%edi
+  8014aa:	89 de                	mov    %ebx,%esi
+  8014ac:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8014ae:	5b                   	pop    %ebx
+  8014af:	5e                   	pop    %esi
+  8014b0:	5f                   	pop    %edi
+  8014b1:	5d                   	pop    %ebp
+  8014b2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014be:	b8 19 00 00 00       	mov    $0x19,%eax
+  8014c3:	89 df                	mov    %ebx,%edi
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  8014c8:	8d 35 d0 14 80 00    	lea    0x8014d0,%esi
+  8014ce:	0f 34                	sysenter
+  8014d0:	5d                   	pop    %ebp
+		goto out;
+  8014d1:	eb db                	jmp    8014ae <sys_perf+0x25>
+
+008014d3 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	57                   	push   %edi
+  8014d7:	56                   	push   %esi
+  8014d8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014d9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e0:	74 19                	je     8014fb <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8014e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014ec:	89 d1                	mov    %edx,%ecx
+  8014ee:	89 d3                	mov    %edx,%ebx
+  8014f0:	89 d7                	mov    %edx,%edi
+  8014f2:	89 d6                	mov    %edx,%esi
+  8014f4:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8014f6:	5b                   	pop    %ebx
+  8014f7:	5e                   	pop    %esi
+  8014f8:	5f                   	pop    %edi
+  8014f9:	5d                   	pop    %ebp
+  8014fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801500:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801505:	89 d1                	mov    %edx,%ecx
+  801507:	89 d3                	mov    %edx,%ebx
+  801509:	89 d7                	mov    %edx,%edi
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	8d 35 16 15 80 00    	lea    0x801516,%esi
+  801514:	0f 34                	sysenter
+  801516:	5d                   	pop    %ebp
+		goto out;
+  801517:	eb dd                	jmp    8014f6 <sys_fork+0x23>
+
+00801519 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	57                   	push   %edi
+  80151d:	56                   	push   %esi
+  80151e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80151f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801526:	74 1c                	je     801544 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+  80152d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801532:	8b 55 08             	mov    0x8(%ebp),%edx
+  801535:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801538:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153b:	89 f7                	mov    %esi,%edi
+  80153d:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80153f:	5b                   	pop    %ebx
+  801540:	5e                   	pop    %esi
+  801541:	5f                   	pop    %edi
+  801542:	5d                   	pop    %ebp
+  801543:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801544:	8b 55 08             	mov    0x8(%ebp),%edx
+  801547:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80154f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801554:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801557:	55                   	push   %ebp
+  801558:	89 e5                	mov    %esp,%ebp
+  80155a:	8d 35 62 15 80 00    	lea    0x801562,%esi
+  801560:	0f 34                	sysenter
+  801562:	5d                   	pop    %ebp
+		goto out;
+  801563:	eb da                	jmp    80153f <sys_thread_create+0x26>
+
+00801565 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801565:	55                   	push   %ebp
+  801566:	89 e5                	mov    %esp,%ebp
+  801568:	57                   	push   %edi
+  801569:	56                   	push   %esi
+  80156a:	53                   	push   %ebx
+  80156b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80156e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801575:	74 24                	je     80159b <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801577:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80157c:	be 00 00 00 00       	mov    $0x0,%esi
+  801581:	8b 55 08             	mov    0x8(%ebp),%edx
+  801584:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801587:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80158d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	7f 27                	jg     8015ba <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801596:	5b                   	pop    %ebx
+  801597:	5e                   	pop    %esi
+  801598:	5f                   	pop    %edi
+  801599:	5d                   	pop    %ebp
+  80159a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80159b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8015a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015a9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	8d 35 b7 15 80 00    	lea    0x8015b7,%esi
+  8015b5:	0f 34                	sysenter
+  8015b7:	5d                   	pop    %ebp
+		goto out;
+  8015b8:	eb d5                	jmp    80158f <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015ba:	83 ec 0c             	sub    $0xc,%esp
+  8015bd:	50                   	push   %eax
+  8015be:	6a 1f                	push   $0x1f
+  8015c0:	68 eb 33 80 00       	push   $0x8033eb
+  8015c5:	6a 3f                	push   $0x3f
+  8015c7:	68 08 34 80 00       	push   $0x803408
+  8015cc:	e8 6c ed ff ff       	call   80033d <_panic>
+
+008015d1 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	57                   	push   %edi
+  8015d5:	56                   	push   %esi
+  8015d6:	53                   	push   %ebx
+  8015d7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8015da:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015e1:	74 23                	je     801606 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8015e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8015ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015f6:	89 f7                	mov    %esi,%edi
+  8015f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	7f 29                	jg     801627 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8015fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801601:	5b                   	pop    %ebx
+  801602:	5e                   	pop    %esi
+  801603:	5f                   	pop    %edi
+  801604:	5d                   	pop    %ebp
+  801605:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801606:	8b 55 08             	mov    0x8(%ebp),%edx
+  801609:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160c:	b8 20 00 00 00       	mov    $0x20,%eax
+  801611:	bf 00 00 00 00       	mov    $0x0,%edi
+  801616:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801619:	55                   	push   %ebp
+  80161a:	89 e5                	mov    %esp,%ebp
+  80161c:	8d 35 24 16 80 00    	lea    0x801624,%esi
+  801622:	0f 34                	sysenter
+  801624:	5d                   	pop    %ebp
+		goto out;
+  801625:	eb d3                	jmp    8015fa <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801627:	83 ec 0c             	sub    $0xc,%esp
+  80162a:	50                   	push   %eax
+  80162b:	6a 20                	push   $0x20
+  80162d:	68 eb 33 80 00       	push   $0x8033eb
+  801632:	6a 3f                	push   $0x3f
+  801634:	68 08 34 80 00       	push   $0x803408
+  801639:	e8 ff ec ff ff       	call   80033d <_panic>
+
+0080163e <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80163e:	55                   	push   %ebp
+  80163f:	89 e5                	mov    %esp,%ebp
+  801641:	57                   	push   %edi
+  801642:	56                   	push   %esi
+  801643:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801644:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80164b:	74 1b                	je     801668 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80164d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801652:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801657:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165d:	89 df                	mov    %ebx,%edi
+  80165f:	89 de                	mov    %ebx,%esi
+  801661:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801663:	5b                   	pop    %ebx
+  801664:	5e                   	pop    %esi
+  801665:	5f                   	pop    %edi
+  801666:	5d                   	pop    %ebp
+  801667:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801668:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80166d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801670:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801673:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801678:	89 df                	mov    %ebx,%edi
+  80167a:	55                   	push   %ebp
+  80167b:	89 e5                	mov    %esp,%ebp
+  80167d:	8d 35 85 16 80 00    	lea    0x801685,%esi
+  801683:	0f 34                	sysenter
+  801685:	5d                   	pop    %ebp
+		goto out;
+  801686:	eb db                	jmp    801663 <sys_batch+0x25>
+
+00801688 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+  80168b:	57                   	push   %edi
+  80168c:	56                   	push   %esi
+  80168d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80168e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801695:	74 1a                	je     8016b1 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80169c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8016a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a4:	89 cb                	mov    %ecx,%ebx
+  8016a6:	89 cf                	mov    %ecx,%edi
+  8016a8:	89 ce                	mov    %ecx,%esi
+  8016aa:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8016ac:	5b                   	pop    %ebx
+  8016ad:	5e                   	pop    %esi
+  8016ae:	5f                   	pop    %edi
+  8016af:	5d                   	pop    %ebp
+  8016b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8016be:	89 cb                	mov    %ecx,%ebx
+  8016c0:	89 cf                	mov    %ecx,%edi
+  8016c2:	55                   	push   %ebp
+  8016c3:	89 e5                	mov    %esp,%ebp
+  8016c5:	8d 35 cd 16 80 00    	lea    0x8016cd,%esi
+  8016cb:	0f 34                	sysenter
+  8016cd:	5d                   	pop    %ebp
+		goto out;
+  8016ce:	eb dc                	jmp    8016ac <sys_trace_ctl+0x24>
+
+008016d0 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8016d0:	55                   	push   %ebp
+  8016d1:	89 e5                	mov    %esp,%ebp
+  8016d3:	57                   	push   %edi
+  8016d4:	56                   	push   %esi
+  8016d5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016d6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016dd:	74 1c                	je     8016fb <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8016df:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8016e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f2:	89 f7                	mov    %esi,%edi
+  8016f4:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8016f6:	5b                   	pop    %ebx
+  8016f7:	5e                   	pop    %esi
+  8016f8:	5f                   	pop    %edi
+  8016f9:	5d                   	pop    %ebp
+  8016fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801701:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801706:	bf 00 00 00 00       	mov    $0x0,%edi
+  80170b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	8d 35 19 17 80 00    	lea    0x801719,%esi
+  801717:	0f 34                	sysenter
+  801719:	5d                   	pop    %ebp
+		goto out;
+  80171a:	eb da                	jmp    8016f6 <sys_trace_read+0x26>
+
+0080171c <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80171c:	55                   	push   %ebp
+  80171d:	89 e5                	mov    %esp,%ebp
+  80171f:	57                   	push   %edi
+  801720:	56                   	push   %esi
+  801721:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801722:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801729:	74 1c                	je     801747 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80172b:	be 00 00 00 00       	mov    $0x0,%esi
+  801730:	b8 21 00 00 00       	mov    $0x21,%eax
+  801735:	8b 55 08             	mov    0x8(%ebp),%edx
+  801738:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80173e:	89 f7                	mov    %esi,%edi
+  801740:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801742:	5b                   	pop    %ebx
+  801743:	5e                   	pop    %esi
+  801744:	5f                   	pop    %edi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801747:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174d:	b8 21 00 00 00       	mov    $0x21,%eax
+  801752:	bf 00 00 00 00       	mov    $0x0,%edi
+  801757:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80175a:	55                   	push   %ebp
+  80175b:	89 e5                	mov    %esp,%ebp
+  80175d:	8d 35 65 17 80 00    	lea    0x801765,%esi
+  801763:	0f 34                	sysenter
+  801765:	5d                   	pop    %ebp
+		goto out;
+  801766:	eb da                	jmp    801742 <sys_meminfo+0x26>
+
+00801768 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	57                   	push   %edi
+  80176c:	56                   	push   %esi
+  80176d:	53                   	push   %ebx
+  80176e:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801771:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801775:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80177c:	74 1f                	je     80179d <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80177e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801783:	b8 22 00 00 00       	mov    $0x22,%eax
+  801788:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178b:	89 df                	mov    %ebx,%edi
+  80178d:	89 de                	mov    %ebx,%esi
+  80178f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801791:	85 c0                	test   %eax,%eax
+  801793:	7f 25                	jg     8017ba <sys_env_set_ksm+0x52>
+}
+  801795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801798:	5b                   	pop    %ebx
+  801799:	5e                   	pop    %esi
+  80179a:	5f                   	pop    %edi
+  80179b:	5d                   	pop    %ebp
+  80179c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80179d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8017aa:	89 df                	mov    %ebx,%edi
+  8017ac:	55                   	push   %ebp
+  8017ad:	89 e5                	mov    %esp,%ebp
+  8017af:	8d 35 b7 17 80 00    	lea    0x8017b7,%esi
+  8017b5:	0f 34                	sysenter
+  8017b7:	5d                   	pop    %ebp
+		goto out;
+  8017b8:	eb d7                	jmp    801791 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017ba:	83 ec 0c             	sub    $0xc,%esp
+  8017bd:	50                   	push   %eax
+  8017be:	6a 22                	push   $0x22
+  8017c0:	68 eb 33 80 00       	push   $0x8033eb
+  8017c5:	6a 3f                	push   $0x3f
+  8017c7:	68 08 34 80 00       	push   $0x803408
+  8017cc:	e8 6c eb ff ff       	call   80033d <_panic>
+
+008017d1 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8017d1:	55                   	push   %ebp
+  8017d2:	89 e5                	mov    %esp,%ebp
+  8017d4:	57                   	push   %edi
+  8017d5:	56                   	push   %esi
+  8017d6:	53                   	push   %ebx
+  8017d7:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8017da:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8017dd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017e4:	74 24                	je     80180a <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8017e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017eb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8017f0:	89 cb                	mov    %ecx,%ebx
+  8017f2:	89 cf                	mov    %ecx,%edi
+  8017f4:	89 ce                	mov    %ecx,%esi
+  8017f6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	7f 2a                	jg     801826 <sys_time_nsec+0x55>
+	return ns;
+}
+  8017fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017ff:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801802:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801805:	5b                   	pop    %ebx
+  801806:	5e                   	pop    %esi
+  801807:	5f                   	pop    %edi
+  801808:	5d                   	pop    %ebp
+  801809:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80180a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80180f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801814:	89 cb                	mov    %ecx,%ebx
+  801816:	89 cf                	mov    %ecx,%edi
+  801818:	55                   	push   %ebp
+  801819:	89 e5                	mov    %esp,%ebp
+  80181b:	8d 35 23 18 80 00    	lea    0x801823,%esi
+  801821:	0f 34                	sysenter
+  801823:	5d                   	pop    %ebp
+		goto out;
+  801824:	eb d2                	jmp    8017f8 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801826:	83 ec 0c             	sub    $0xc,%esp
+  801829:	50                   	push   %eax
+  80182a:	6a 0f                	push   $0xf
+  80182c:	68 eb 33 80 00       	push   $0x8033eb
+  801831:	6a 3f                	push   $0x3f
+  801833:	68 08 34 80 00       	push   $0x803408
+  801838:	e8 00 eb ff ff       	call   80033d <_panic>
+
+0080183d <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80183d:	55                   	push   %ebp
+  80183e:	89 e5                	mov    %esp,%ebp
+  801840:	57                   	push   %edi
+  801841:	56                   	push   %esi
+  801842:	53                   	push   %ebx
+  801843:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801846:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80184d:	74 22                	je     801871 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80184f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801854:	b8 12 00 00 00       	mov    $0x12,%eax
+  801859:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185f:	89 df                	mov    %ebx,%edi
+  801861:	89 de                	mov    %ebx,%esi
+  801863:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801865:	85 c0                	test   %eax,%eax
+  801867:	7f 28                	jg     801891 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80186c:	5b                   	pop    %ebx
+  80186d:	5e                   	pop    %esi
+  80186e:	5f                   	pop    %edi
+  80186f:	5d                   	pop    %ebp
+  801870:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801871:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801876:	8b 55 08             	mov    0x8(%ebp),%edx
+  801879:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801881:	89 df                	mov    %ebx,%edi
+  801883:	55                   	push   %ebp
+  801884:	89 e5                	mov    %esp,%ebp
+  801886:	8d 35 8e 18 80 00    	lea    0x80188e,%esi
+  80188c:	0f 34                	sysenter
+  80188e:	5d                   	pop    %ebp
+		goto out;
+  80188f:	eb d4                	jmp    801865 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801891:	83 ec 0c             	sub    $0xc,%esp
+  801894:	50                   	push   %eax
+  801895:	6a 12                	push   $0x12
+  801897:	68 eb 33 80 00       	push   $0x8033eb
+  80189c:	6a 3f                	push   $0x3f
+  80189e:	68 08 34 80 00       	push   $0x803408
+  8018a3:	e8 95 ea ff ff       	call   80033d <_panic>
+
+008018a8 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8018a8:	55                   	push   %ebp
+  8018a9:	89 e5                	mov    %esp,%ebp
+  8018ab:	57                   	push   %edi
+  8018ac:	56                   	push   %esi
+  8018ad:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018ae:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018b5:	74 1b                	je     8018d2 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8018b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018bc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c7:	89 df                	mov    %ebx,%edi
+  8018c9:	89 de                	mov    %ebx,%esi
+  8018cb:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5f                   	pop    %edi
+  8018d0:	5d                   	pop    %ebp
+  8018d1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018dd:	b8 13 00 00 00       	mov    $0x13,%eax
+  8018e2:	89 df                	mov    %ebx,%edi
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	8d 35 ef 18 80 00    	lea    0x8018ef,%esi
+  8018ed:	0f 34                	sysenter
+  8018ef:	5d                   	pop    %ebp
+		goto out;
+  8018f0:	eb db                	jmp    8018cd <sys_e1000_receive+0x25>
+
+008018f2 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8018f2:	55                   	push   %ebp
+  8018f3:	89 e5                	mov    %esp,%ebp
+  8018f5:	57                   	push   %edi
+  8018f6:	56                   	push   %esi
+  8018f7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018f8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018ff:	74 1b                	je     80191c <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801901:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801906:	b8 14 00 00 00       	mov    $0x14,%eax
+  80190b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801911:	89 df                	mov    %ebx,%edi
+  801913:	89 de                	mov    %ebx,%esi
+  801915:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801917:	5b                   	pop    %ebx
+  801918:	5e                   	pop    %esi
+  801919:	5f                   	pop    %edi
+  80191a:	5d                   	pop    %ebp
+  80191b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80191c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801921:	8b 55 08             	mov    0x8(%ebp),%edx
+  801924:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801927:	b8 14 00 00 00       	mov    $0x14,%eax
+  80192c:	89 df                	mov    %ebx,%edi
+  80192e:	55                   	push   %ebp
+  80192f:	89 e5                	mov    %esp,%ebp
+  801931:	8d 35 39 19 80 00    	lea    0x801939,%esi
+  801937:	0f 34                	sysenter
+  801939:	5d                   	pop    %ebp
+		goto out;
+  80193a:	eb db                	jmp    801917 <sys_e1000_read_hwaddr+0x25>
+
+0080193c <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80193c:	55                   	push   %ebp
+  80193d:	89 e5                	mov    %esp,%ebp
+  80193f:	57                   	push   %edi
+  801940:	56                   	push   %esi
+  801941:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801942:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801949:	74 1a                	je     801965 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80194b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801950:	b8 15 00 00 00       	mov    $0x15,%eax
+  801955:	8b 55 08             	mov    0x8(%ebp),%edx
+  801958:	89 cb                	mov    %ecx,%ebx
+  80195a:	89 cf                	mov    %ecx,%edi
+  80195c:	89 ce                	mov    %ecx,%esi
+  80195e:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801960:	5b                   	pop    %ebx
+  801961:	5e                   	pop    %esi
+  801962:	5f                   	pop    %edi
+  801963:	5d                   	pop    %ebp
+  801964:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801965:	8b 55 08             	mov    0x8(%ebp),%edx
+  801968:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80196d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801972:	89 cb                	mov    %ecx,%ebx
+  801974:	89 cf                	mov    %ecx,%edi
+  801976:	55                   	push   %ebp
+  801977:	89 e5                	mov    %esp,%ebp
+  801979:	8d 35 81 19 80 00    	lea    0x801981,%esi
+  80197f:	0f 34                	sysenter
+  801981:	5d                   	pop    %ebp
+		goto out;
+  801982:	eb dc                	jmp    801960 <sys_sb16_read_version+0x24>
+
+00801984 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+  801987:	57                   	push   %edi
+  801988:	56                   	push   %esi
+  801989:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80198a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801991:	74 1b                	je     8019ae <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801993:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801998:	b8 16 00 00 00       	mov    $0x16,%eax
+  80199d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019a3:	89 df                	mov    %ebx,%edi
+  8019a5:	89 de                	mov    %ebx,%esi
+  8019a7:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8019a9:	5b                   	pop    %ebx
+  8019aa:	5e                   	pop    %esi
+  8019ab:	5f                   	pop    %edi
+  8019ac:	5d                   	pop    %ebp
+  8019ad:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019b9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8019be:	89 df                	mov    %ebx,%edi
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	8d 35 cb 19 80 00    	lea    0x8019cb,%esi
+  8019c9:	0f 34                	sysenter
+  8019cb:	5d                   	pop    %ebp
+		goto out;
+  8019cc:	eb db                	jmp    8019a9 <sys_sb16_play+0x25>
+
+008019ce <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8019ce:	55                   	push   %ebp
+  8019cf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019d9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019dc:	5d                   	pop    %ebp
+  8019dd:	c3                   	ret
+
+008019de <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019de:	55                   	push   %ebp
+  8019df:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019e9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019ee:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019f3:	5d                   	pop    %ebp
+  8019f4:	c3                   	ret
+
+008019f5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019f5:	55                   	push   %ebp
+  8019f6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8019f8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8019fd:	eb 02                	jmp    801a01 <fd_alloc+0xc>
+  8019ff:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a01:	89 c2                	mov    %eax,%edx
+  801a03:	c1 ea 16             	shr    $0x16,%edx
+  801a06:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a0d:	f6 c2 01             	test   $0x1,%dl
+  801a10:	74 2b                	je     801a3d <fd_alloc+0x48>
+  801a12:	89 c2                	mov    %eax,%edx
+  801a14:	c1 ea 0c             	shr    $0xc,%edx
+  801a17:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a1e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801a24:	f6 c1 01             	test   $0x1,%cl
+  801a27:	74 14                	je     801a3d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801a29:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801a2f:	75 ce                	jne    8019ff <fd_alloc+0xa>
+  801a31:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a36:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a3b:	eb 05                	jmp    801a42 <fd_alloc+0x4d>
+			return 0;
+  801a3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a42:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a45:	89 02                	mov    %eax,(%edx)
+}
+  801a47:	89 c8                	mov    %ecx,%eax
+  801a49:	5d                   	pop    %ebp
+  801a4a:	c3                   	ret
+
+00801a4b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a4b:	55                   	push   %ebp
+  801a4c:	89 e5                	mov    %esp,%ebp
+  801a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a51:	83 f8 1f             	cmp    $0x1f,%eax
+  801a54:	77 30                	ja     801a86 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a56:	c1 e0 0c             	shl    $0xc,%eax
+  801a59:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a5e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a64:	f6 c2 01             	test   $0x1,%dl
+  801a67:	74 24                	je     801a8d <fd_lookup+0x42>
+  801a69:	89 c2                	mov    %eax,%edx
+  801a6b:	c1 ea 0c             	shr    $0xc,%edx
+  801a6e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a75:	f6 c2 01             	test   $0x1,%dl
+  801a78:	74 1a                	je     801a94 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a7d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a84:	5d                   	pop    %ebp
+  801a85:	c3                   	ret
+		return -E_INVAL;
+  801a86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a8b:	eb f7                	jmp    801a84 <fd_lookup+0x39>
+		return -E_INVAL;
+  801a8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a92:	eb f0                	jmp    801a84 <fd_lookup+0x39>
+  801a94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a99:	eb e9                	jmp    801a84 <fd_lookup+0x39>
+
+00801a9b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	53                   	push   %ebx
+  801a9f:	83 ec 04             	sub    $0x4,%esp
+  801aa2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aaa:	eb 03                	jmp    801aaf <dev_lookup+0x14>
+  801aac:	83 c0 01             	add    $0x1,%eax
+  801aaf:	8b 1c 85 94 34 80 00 	mov    0x803494(,%eax,4),%ebx
+  801ab6:	85 db                	test   %ebx,%ebx
+  801ab8:	74 0b                	je     801ac5 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801aba:	39 13                	cmp    %edx,(%ebx)
+  801abc:	75 ee                	jne    801aac <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac3:	eb 2e                	jmp    801af3 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801ac5:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ac7:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801acc:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ad2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ad7:	76 24                	jbe    801afd <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ad9:	8b 41 48             	mov    0x48(%ecx),%eax
+  801adc:	83 ec 04             	sub    $0x4,%esp
+  801adf:	52                   	push   %edx
+  801ae0:	50                   	push   %eax
+  801ae1:	68 18 34 80 00       	push   $0x803418
+  801ae6:	e8 2d e9 ff ff       	call   800418 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801aeb:	83 c4 10             	add    $0x10,%esp
+  801aee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801af3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801af6:	89 1a                	mov    %ebx,(%edx)
+}
+  801af8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801afb:	c9                   	leave
+  801afc:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801afd:	c1 e8 10             	shr    $0x10,%eax
+  801b00:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b06:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801b0c:	eb cb                	jmp    801ad9 <dev_lookup+0x3e>
+
+00801b0e <fd_close>:
+{
+  801b0e:	55                   	push   %ebp
+  801b0f:	89 e5                	mov    %esp,%ebp
+  801b11:	57                   	push   %edi
+  801b12:	56                   	push   %esi
+  801b13:	53                   	push   %ebx
+  801b14:	83 ec 24             	sub    $0x24,%esp
+  801b17:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b1a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b1d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b20:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b21:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b27:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b2a:	50                   	push   %eax
+  801b2b:	e8 1b ff ff ff       	call   801a4b <fd_lookup>
+  801b30:	89 c3                	mov    %eax,%ebx
+  801b32:	83 c4 10             	add    $0x10,%esp
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	78 05                	js     801b3e <fd_close+0x30>
+	    || fd != fd2)
+  801b39:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b3c:	74 16                	je     801b54 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801b3e:	89 f8                	mov    %edi,%eax
+  801b40:	84 c0                	test   %al,%al
+  801b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b47:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b4a:	89 d8                	mov    %ebx,%eax
+  801b4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b4f:	5b                   	pop    %ebx
+  801b50:	5e                   	pop    %esi
+  801b51:	5f                   	pop    %edi
+  801b52:	5d                   	pop    %ebp
+  801b53:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b54:	83 ec 08             	sub    $0x8,%esp
+  801b57:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b5a:	50                   	push   %eax
+  801b5b:	ff 36                	push   (%esi)
+  801b5d:	e8 39 ff ff ff       	call   801a9b <dev_lookup>
+  801b62:	89 c3                	mov    %eax,%ebx
+  801b64:	83 c4 10             	add    $0x10,%esp
+  801b67:	85 c0                	test   %eax,%eax
+  801b69:	78 1a                	js     801b85 <fd_close+0x77>
+		if (dev->dev_close)
+  801b6b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b6e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b71:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	74 0b                	je     801b85 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b7a:	83 ec 0c             	sub    $0xc,%esp
+  801b7d:	56                   	push   %esi
+  801b7e:	ff d0                	call   *%eax
+  801b80:	89 c3                	mov    %eax,%ebx
+  801b82:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b85:	83 ec 08             	sub    $0x8,%esp
+  801b88:	56                   	push   %esi
+  801b89:	6a 00                	push   $0x0
+  801b8b:	e8 a3 f4 ff ff       	call   801033 <sys_page_unmap>
+	return r;
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	eb b5                	jmp    801b4a <fd_close+0x3c>
+
+00801b95 <close>:
+
+int
+close(int fdnum)
+{
+  801b95:	55                   	push   %ebp
+  801b96:	89 e5                	mov    %esp,%ebp
+  801b98:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b9b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b9e:	50                   	push   %eax
+  801b9f:	ff 75 08             	push   0x8(%ebp)
+  801ba2:	e8 a4 fe ff ff       	call   801a4b <fd_lookup>
+  801ba7:	83 c4 10             	add    $0x10,%esp
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	79 02                	jns    801bb0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801bae:	c9                   	leave
+  801baf:	c3                   	ret
+		return fd_close(fd, 1);
+  801bb0:	83 ec 08             	sub    $0x8,%esp
+  801bb3:	6a 01                	push   $0x1
+  801bb5:	ff 75 f4             	push   -0xc(%ebp)
+  801bb8:	e8 51 ff ff ff       	call   801b0e <fd_close>
+  801bbd:	83 c4 10             	add    $0x10,%esp
+  801bc0:	eb ec                	jmp    801bae <close+0x19>
+
+00801bc2 <close_all>:
+
+void
+close_all(void)
+{
+  801bc2:	55                   	push   %ebp
+  801bc3:	89 e5                	mov    %esp,%ebp
+  801bc5:	53                   	push   %ebx
+  801bc6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801bc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801bce:	83 ec 0c             	sub    $0xc,%esp
+  801bd1:	53                   	push   %ebx
+  801bd2:	e8 be ff ff ff       	call   801b95 <close>
+	for (i = 0; i < MAXFD; i++)
+  801bd7:	83 c3 01             	add    $0x1,%ebx
+  801bda:	83 c4 10             	add    $0x10,%esp
+  801bdd:	83 fb 20             	cmp    $0x20,%ebx
+  801be0:	75 ec                	jne    801bce <close_all+0xc>
+}
+  801be2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be5:	c9                   	leave
+  801be6:	c3                   	ret
+
+00801be7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801be7:	55                   	push   %ebp
+  801be8:	89 e5                	mov    %esp,%ebp
+  801bea:	57                   	push   %edi
+  801beb:	56                   	push   %esi
+  801bec:	53                   	push   %ebx
+  801bed:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801bf0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bf3:	50                   	push   %eax
+  801bf4:	ff 75 08             	push   0x8(%ebp)
+  801bf7:	e8 4f fe ff ff       	call   801a4b <fd_lookup>
+  801bfc:	89 c3                	mov    %eax,%ebx
+  801bfe:	83 c4 10             	add    $0x10,%esp
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	78 7f                	js     801c84 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c05:	83 ec 0c             	sub    $0xc,%esp
+  801c08:	ff 75 0c             	push   0xc(%ebp)
+  801c0b:	e8 85 ff ff ff       	call   801b95 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c10:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c13:	c1 e6 0c             	shl    $0xc,%esi
+  801c16:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c1c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c1f:	89 3c 24             	mov    %edi,(%esp)
+  801c22:	e8 b7 fd ff ff       	call   8019de <fd2data>
+  801c27:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c29:	89 34 24             	mov    %esi,(%esp)
+  801c2c:	e8 ad fd ff ff       	call   8019de <fd2data>
+  801c31:	83 c4 10             	add    $0x10,%esp
+  801c34:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801c37:	89 d8                	mov    %ebx,%eax
+  801c39:	c1 e8 16             	shr    $0x16,%eax
+  801c3c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c43:	a8 01                	test   $0x1,%al
+  801c45:	74 11                	je     801c58 <dup+0x71>
+  801c47:	89 d8                	mov    %ebx,%eax
+  801c49:	c1 e8 0c             	shr    $0xc,%eax
+  801c4c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c53:	f6 c2 01             	test   $0x1,%dl
+  801c56:	75 36                	jne    801c8e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c58:	89 f8                	mov    %edi,%eax
+  801c5a:	c1 e8 0c             	shr    $0xc,%eax
+  801c5d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c64:	83 ec 0c             	sub    $0xc,%esp
+  801c67:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c6c:	50                   	push   %eax
+  801c6d:	56                   	push   %esi
+  801c6e:	6a 00                	push   $0x0
+  801c70:	57                   	push   %edi
+  801c71:	6a 00                	push   $0x0
+  801c73:	e8 4d f3 ff ff       	call   800fc5 <sys_page_map>
+  801c78:	89 c3                	mov    %eax,%ebx
+  801c7a:	83 c4 20             	add    $0x20,%esp
+  801c7d:	85 c0                	test   %eax,%eax
+  801c7f:	78 33                	js     801cb4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c81:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c84:	89 d8                	mov    %ebx,%eax
+  801c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c89:	5b                   	pop    %ebx
+  801c8a:	5e                   	pop    %esi
+  801c8b:	5f                   	pop    %edi
+  801c8c:	5d                   	pop    %ebp
+  801c8d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c8e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c95:	83 ec 0c             	sub    $0xc,%esp
+  801c98:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c9d:	50                   	push   %eax
+  801c9e:	ff 75 d4             	push   -0x2c(%ebp)
+  801ca1:	6a 00                	push   $0x0
+  801ca3:	53                   	push   %ebx
+  801ca4:	6a 00                	push   $0x0
+  801ca6:	e8 1a f3 ff ff       	call   800fc5 <sys_page_map>
+  801cab:	89 c3                	mov    %eax,%ebx
+  801cad:	83 c4 20             	add    $0x20,%esp
+  801cb0:	85 c0                	test   %eax,%eax
+  801cb2:	79 a4                	jns    801c58 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801cb4:	83 ec 08             	sub    $0x8,%esp
+  801cb7:	56                   	push   %esi
+  801cb8:	6a 00                	push   $0x0
+  801cba:	e8 74 f3 ff ff       	call   801033 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801cbf:	83 c4 08             	add    $0x8,%esp
+  801cc2:	ff 75 d4             	push   -0x2c(%ebp)
+  801cc5:	6a 00                	push   $0x0
+  801cc7:	e8 67 f3 ff ff       	call   801033 <sys_page_unmap>
+	return r;
+  801ccc:	83 c4 10             	add    $0x10,%esp
+  801ccf:	eb b3                	jmp    801c84 <dup+0x9d>
+
+00801cd1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801cd1:	55                   	push   %ebp
+  801cd2:	89 e5                	mov    %esp,%ebp
+  801cd4:	56                   	push   %esi
+  801cd5:	53                   	push   %ebx
+  801cd6:	83 ec 18             	sub    $0x18,%esp
+  801cd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cdc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cdf:	50                   	push   %eax
+  801ce0:	53                   	push   %ebx
+  801ce1:	e8 65 fd ff ff       	call   801a4b <fd_lookup>
+  801ce6:	83 c4 10             	add    $0x10,%esp
+  801ce9:	85 c0                	test   %eax,%eax
+  801ceb:	78 3c                	js     801d29 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ced:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cf0:	83 ec 08             	sub    $0x8,%esp
+  801cf3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cf6:	50                   	push   %eax
+  801cf7:	ff 36                	push   (%esi)
+  801cf9:	e8 9d fd ff ff       	call   801a9b <dev_lookup>
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	85 c0                	test   %eax,%eax
+  801d03:	78 24                	js     801d29 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d05:	8b 46 08             	mov    0x8(%esi),%eax
+  801d08:	83 e0 03             	and    $0x3,%eax
+  801d0b:	83 f8 01             	cmp    $0x1,%eax
+  801d0e:	74 20                	je     801d30 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d13:	8b 40 08             	mov    0x8(%eax),%eax
+  801d16:	85 c0                	test   %eax,%eax
+  801d18:	74 57                	je     801d71 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d1a:	83 ec 04             	sub    $0x4,%esp
+  801d1d:	ff 75 10             	push   0x10(%ebp)
+  801d20:	ff 75 0c             	push   0xc(%ebp)
+  801d23:	56                   	push   %esi
+  801d24:	ff d0                	call   *%eax
+  801d26:	83 c4 10             	add    $0x10,%esp
+}
+  801d29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2c:	5b                   	pop    %ebx
+  801d2d:	5e                   	pop    %esi
+  801d2e:	5d                   	pop    %ebp
+  801d2f:	c3                   	ret
+  801d30:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d32:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d37:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d3d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d42:	76 1c                	jbe    801d60 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d44:	8b 42 48             	mov    0x48(%edx),%eax
+  801d47:	83 ec 04             	sub    $0x4,%esp
+  801d4a:	53                   	push   %ebx
+  801d4b:	50                   	push   %eax
+  801d4c:	68 59 34 80 00       	push   $0x803459
+  801d51:	e8 c2 e6 ff ff       	call   800418 <cprintf>
+		return -E_INVAL;
+  801d56:	83 c4 10             	add    $0x10,%esp
+  801d59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d5e:	eb c9                	jmp    801d29 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d60:	c1 e8 10             	shr    $0x10,%eax
+  801d63:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d69:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d6f:	eb d3                	jmp    801d44 <read+0x73>
+		return -E_NOT_SUPP;
+  801d71:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d76:	eb b1                	jmp    801d29 <read+0x58>
+
+00801d78 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d78:	55                   	push   %ebp
+  801d79:	89 e5                	mov    %esp,%ebp
+  801d7b:	57                   	push   %edi
+  801d7c:	56                   	push   %esi
+  801d7d:	53                   	push   %ebx
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d84:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d8c:	eb 02                	jmp    801d90 <readn+0x18>
+  801d8e:	01 c3                	add    %eax,%ebx
+  801d90:	39 f3                	cmp    %esi,%ebx
+  801d92:	73 21                	jae    801db5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d94:	83 ec 04             	sub    $0x4,%esp
+  801d97:	89 f0                	mov    %esi,%eax
+  801d99:	29 d8                	sub    %ebx,%eax
+  801d9b:	50                   	push   %eax
+  801d9c:	89 d8                	mov    %ebx,%eax
+  801d9e:	03 45 0c             	add    0xc(%ebp),%eax
+  801da1:	50                   	push   %eax
+  801da2:	57                   	push   %edi
+  801da3:	e8 29 ff ff ff       	call   801cd1 <read>
+		if (m < 0)
+  801da8:	83 c4 10             	add    $0x10,%esp
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 04                	js     801db3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801daf:	75 dd                	jne    801d8e <readn+0x16>
+  801db1:	eb 02                	jmp    801db5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801db3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801db5:	89 d8                	mov    %ebx,%eax
+  801db7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dba:	5b                   	pop    %ebx
+  801dbb:	5e                   	pop    %esi
+  801dbc:	5f                   	pop    %edi
+  801dbd:	5d                   	pop    %ebp
+  801dbe:	c3                   	ret
+
+00801dbf <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801dbf:	55                   	push   %ebp
+  801dc0:	89 e5                	mov    %esp,%ebp
+  801dc2:	56                   	push   %esi
+  801dc3:	53                   	push   %ebx
+  801dc4:	83 ec 18             	sub    $0x18,%esp
+  801dc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dcd:	50                   	push   %eax
+  801dce:	53                   	push   %ebx
+  801dcf:	e8 77 fc ff ff       	call   801a4b <fd_lookup>
+  801dd4:	83 c4 10             	add    $0x10,%esp
+  801dd7:	85 c0                	test   %eax,%eax
+  801dd9:	78 37                	js     801e12 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ddb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dde:	83 ec 08             	sub    $0x8,%esp
+  801de1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801de4:	50                   	push   %eax
+  801de5:	ff 36                	push   (%esi)
+  801de7:	e8 af fc ff ff       	call   801a9b <dev_lookup>
+  801dec:	83 c4 10             	add    $0x10,%esp
+  801def:	85 c0                	test   %eax,%eax
+  801df1:	78 1f                	js     801e12 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801df3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801df7:	74 20                	je     801e19 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801df9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dfc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	74 57                	je     801e5a <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e03:	83 ec 04             	sub    $0x4,%esp
+  801e06:	ff 75 10             	push   0x10(%ebp)
+  801e09:	ff 75 0c             	push   0xc(%ebp)
+  801e0c:	56                   	push   %esi
+  801e0d:	ff d0                	call   *%eax
+  801e0f:	83 c4 10             	add    $0x10,%esp
+}
+  801e12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e15:	5b                   	pop    %ebx
+  801e16:	5e                   	pop    %esi
+  801e17:	5d                   	pop    %ebp
+  801e18:	c3                   	ret
+  801e19:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e1b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e20:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e26:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e2b:	76 1c                	jbe    801e49 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e2d:	8b 42 48             	mov    0x48(%edx),%eax
+  801e30:	83 ec 04             	sub    $0x4,%esp
+  801e33:	53                   	push   %ebx
+  801e34:	50                   	push   %eax
+  801e35:	68 75 34 80 00       	push   $0x803475
+  801e3a:	e8 d9 e5 ff ff       	call   800418 <cprintf>
+		return -E_INVAL;
+  801e3f:	83 c4 10             	add    $0x10,%esp
+  801e42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e47:	eb c9                	jmp    801e12 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e49:	c1 e8 10             	shr    $0x10,%eax
+  801e4c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e52:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e58:	eb d3                	jmp    801e2d <write+0x6e>
+		return -E_NOT_SUPP;
+  801e5a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e5f:	eb b1                	jmp    801e12 <write+0x53>
+
+00801e61 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e61:	55                   	push   %ebp
+  801e62:	89 e5                	mov    %esp,%ebp
+  801e64:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e6a:	50                   	push   %eax
+  801e6b:	ff 75 08             	push   0x8(%ebp)
+  801e6e:	e8 d8 fb ff ff       	call   801a4b <fd_lookup>
+  801e73:	83 c4 10             	add    $0x10,%esp
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	78 0e                	js     801e88 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e80:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e88:	c9                   	leave
+  801e89:	c3                   	ret
+
+00801e8a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e8a:	55                   	push   %ebp
+  801e8b:	89 e5                	mov    %esp,%ebp
+  801e8d:	56                   	push   %esi
+  801e8e:	53                   	push   %ebx
+  801e8f:	83 ec 18             	sub    $0x18,%esp
+  801e92:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e95:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e98:	50                   	push   %eax
+  801e99:	53                   	push   %ebx
+  801e9a:	e8 ac fb ff ff       	call   801a4b <fd_lookup>
+  801e9f:	83 c4 10             	add    $0x10,%esp
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 34                	js     801eda <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ea6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ea9:	83 ec 08             	sub    $0x8,%esp
+  801eac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eaf:	50                   	push   %eax
+  801eb0:	ff 36                	push   (%esi)
+  801eb2:	e8 e4 fb ff ff       	call   801a9b <dev_lookup>
+  801eb7:	83 c4 10             	add    $0x10,%esp
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	78 1c                	js     801eda <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ebe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ec2:	74 1d                	je     801ee1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801ec4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec7:	8b 40 18             	mov    0x18(%eax),%eax
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	74 54                	je     801f22 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ece:	83 ec 08             	sub    $0x8,%esp
+  801ed1:	ff 75 0c             	push   0xc(%ebp)
+  801ed4:	56                   	push   %esi
+  801ed5:	ff d0                	call   *%eax
+  801ed7:	83 c4 10             	add    $0x10,%esp
+}
+  801eda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edd:	5b                   	pop    %ebx
+  801ede:	5e                   	pop    %esi
+  801edf:	5d                   	pop    %ebp
+  801ee0:	c3                   	ret
+  801ee1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ee3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ee8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801eee:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ef3:	76 1c                	jbe    801f11 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801ef5:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ef8:	83 ec 04             	sub    $0x4,%esp
+  801efb:	53                   	push   %ebx
+  801efc:	50                   	push   %eax
+  801efd:	68 38 34 80 00       	push   $0x803438
+  801f02:	e8 11 e5 ff ff       	call   800418 <cprintf>
+		return -E_INVAL;
+  801f07:	83 c4 10             	add    $0x10,%esp
+  801f0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f0f:	eb c9                	jmp    801eda <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801f11:	c1 e8 10             	shr    $0x10,%eax
+  801f14:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f1a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f20:	eb d3                	jmp    801ef5 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801f22:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f27:	eb b1                	jmp    801eda <ftruncate+0x50>
+
+00801f29 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	56                   	push   %esi
+  801f2d:	53                   	push   %ebx
+  801f2e:	83 ec 18             	sub    $0x18,%esp
+  801f31:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f34:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f37:	50                   	push   %eax
+  801f38:	ff 75 08             	push   0x8(%ebp)
+  801f3b:	e8 0b fb ff ff       	call   801a4b <fd_lookup>
+  801f40:	83 c4 10             	add    $0x10,%esp
+  801f43:	85 c0                	test   %eax,%eax
+  801f45:	78 49                	js     801f90 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f47:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f4a:	83 ec 08             	sub    $0x8,%esp
+  801f4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f50:	50                   	push   %eax
+  801f51:	ff 36                	push   (%esi)
+  801f53:	e8 43 fb ff ff       	call   801a9b <dev_lookup>
+  801f58:	83 c4 10             	add    $0x10,%esp
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	78 31                	js     801f90 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f62:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f66:	74 2f                	je     801f97 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f68:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f6b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f72:	00 00 00 
+	stat->st_isdir = 0;
+  801f75:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f7c:	00 00 00 
+	stat->st_dev = dev;
+  801f7f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f85:	83 ec 08             	sub    $0x8,%esp
+  801f88:	53                   	push   %ebx
+  801f89:	56                   	push   %esi
+  801f8a:	ff 50 14             	call   *0x14(%eax)
+  801f8d:	83 c4 10             	add    $0x10,%esp
+}
+  801f90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f93:	5b                   	pop    %ebx
+  801f94:	5e                   	pop    %esi
+  801f95:	5d                   	pop    %ebp
+  801f96:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f97:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f9c:	eb f2                	jmp    801f90 <fstat+0x67>
+
+00801f9e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	56                   	push   %esi
+  801fa2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801fa3:	83 ec 08             	sub    $0x8,%esp
+  801fa6:	6a 00                	push   $0x0
+  801fa8:	ff 75 08             	push   0x8(%ebp)
+  801fab:	e8 e4 01 00 00       	call   802194 <open>
+  801fb0:	89 c3                	mov    %eax,%ebx
+  801fb2:	83 c4 10             	add    $0x10,%esp
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	78 1b                	js     801fd4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801fb9:	83 ec 08             	sub    $0x8,%esp
+  801fbc:	ff 75 0c             	push   0xc(%ebp)
+  801fbf:	50                   	push   %eax
+  801fc0:	e8 64 ff ff ff       	call   801f29 <fstat>
+  801fc5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801fc7:	89 1c 24             	mov    %ebx,(%esp)
+  801fca:	e8 c6 fb ff ff       	call   801b95 <close>
+	return r;
+  801fcf:	83 c4 10             	add    $0x10,%esp
+  801fd2:	89 f3                	mov    %esi,%ebx
+}
+  801fd4:	89 d8                	mov    %ebx,%eax
+  801fd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd9:	5b                   	pop    %ebx
+  801fda:	5e                   	pop    %esi
+  801fdb:	5d                   	pop    %ebp
+  801fdc:	c3                   	ret
+
+00801fdd <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801fdd:	55                   	push   %ebp
+  801fde:	89 e5                	mov    %esp,%ebp
+  801fe0:	56                   	push   %esi
+  801fe1:	53                   	push   %ebx
+  801fe2:	89 c6                	mov    %eax,%esi
+  801fe4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801fe6:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801fed:	74 27                	je     802016 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801fef:	6a 07                	push   $0x7
+  801ff1:	68 00 60 80 00       	push   $0x806000
+  801ff6:	56                   	push   %esi
+  801ff7:	ff 35 00 50 80 00    	push   0x805000
+  801ffd:	e8 f6 0d 00 00       	call   802df8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802002:	83 c4 0c             	add    $0xc,%esp
+  802005:	6a 00                	push   $0x0
+  802007:	53                   	push   %ebx
+  802008:	6a 00                	push   $0x0
+  80200a:	e8 d1 0d 00 00       	call   802de0 <ipc_recv>
+}
+  80200f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802012:	5b                   	pop    %ebx
+  802013:	5e                   	pop    %esi
+  802014:	5d                   	pop    %ebp
+  802015:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802016:	83 ec 0c             	sub    $0xc,%esp
+  802019:	6a 01                	push   $0x1
+  80201b:	e8 2c 0e 00 00       	call   802e4c <ipc_find_env>
+  802020:	a3 00 50 80 00       	mov    %eax,0x805000
+  802025:	83 c4 10             	add    $0x10,%esp
+  802028:	eb c5                	jmp    801fef <fsipc+0x12>
+
+0080202a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802030:	8b 45 08             	mov    0x8(%ebp),%eax
+  802033:	8b 40 0c             	mov    0xc(%eax),%eax
+  802036:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80203b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80203e:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802043:	ba 00 00 00 00       	mov    $0x0,%edx
+  802048:	b8 02 00 00 00       	mov    $0x2,%eax
+  80204d:	e8 8b ff ff ff       	call   801fdd <fsipc>
+}
+  802052:	c9                   	leave
+  802053:	c3                   	ret
+
+00802054 <devfile_flush>:
+{
+  802054:	55                   	push   %ebp
+  802055:	89 e5                	mov    %esp,%ebp
+  802057:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80205a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802060:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802065:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80206f:	e8 69 ff ff ff       	call   801fdd <fsipc>
+}
+  802074:	c9                   	leave
+  802075:	c3                   	ret
+
+00802076 <devfile_stat>:
+{
+  802076:	55                   	push   %ebp
+  802077:	89 e5                	mov    %esp,%ebp
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 04             	sub    $0x4,%esp
+  80207d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802080:	8b 45 08             	mov    0x8(%ebp),%eax
+  802083:	8b 40 0c             	mov    0xc(%eax),%eax
+  802086:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80208b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802090:	b8 05 00 00 00       	mov    $0x5,%eax
+  802095:	e8 43 ff ff ff       	call   801fdd <fsipc>
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 2c                	js     8020ca <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80209e:	83 ec 08             	sub    $0x8,%esp
+  8020a1:	68 00 60 80 00       	push   $0x806000
+  8020a6:	53                   	push   %ebx
+  8020a7:	e8 b4 e9 ff ff       	call   800a60 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8020ac:	a1 80 60 80 00       	mov    0x806080,%eax
+  8020b1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020b7:	a1 84 60 80 00       	mov    0x806084,%eax
+  8020bc:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8020c2:	83 c4 10             	add    $0x10,%esp
+  8020c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020cd:	c9                   	leave
+  8020ce:	c3                   	ret
+
+008020cf <devfile_write>:
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	83 ec 0c             	sub    $0xc,%esp
+  8020d5:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020db:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020de:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8020e4:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8020e9:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8020ee:	39 d0                	cmp    %edx,%eax
+  8020f0:	0f 47 c2             	cmova  %edx,%eax
+  8020f3:	50                   	push   %eax
+  8020f4:	ff 75 0c             	push   0xc(%ebp)
+  8020f7:	68 08 60 80 00       	push   $0x806008
+  8020fc:	e8 e5 ea ff ff       	call   800be6 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802101:	ba 00 00 00 00       	mov    $0x0,%edx
+  802106:	b8 04 00 00 00       	mov    $0x4,%eax
+  80210b:	e8 cd fe ff ff       	call   801fdd <fsipc>
+}
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+
+00802112 <devfile_read>:
+{
+  802112:	55                   	push   %ebp
+  802113:	89 e5                	mov    %esp,%ebp
+  802115:	56                   	push   %esi
+  802116:	53                   	push   %ebx
+  802117:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80211a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802120:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802125:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80212b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802130:	b8 03 00 00 00       	mov    $0x3,%eax
+  802135:	e8 a3 fe ff ff       	call   801fdd <fsipc>
+  80213a:	89 c3                	mov    %eax,%ebx
+  80213c:	85 c0                	test   %eax,%eax
+  80213e:	78 1f                	js     80215f <devfile_read+0x4d>
+	assert(r <= n);
+  802140:	39 c6                	cmp    %eax,%esi
+  802142:	72 24                	jb     802168 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802144:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802149:	7f 33                	jg     80217e <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80214b:	83 ec 04             	sub    $0x4,%esp
+  80214e:	50                   	push   %eax
+  80214f:	68 00 60 80 00       	push   $0x806000
+  802154:	ff 75 0c             	push   0xc(%ebp)
+  802157:	e8 8a ea ff ff       	call   800be6 <memmove>
+	return r;
+  80215c:	83 c4 10             	add    $0x10,%esp
+}
+  80215f:	89 d8                	mov    %ebx,%eax
+  802161:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802164:	5b                   	pop    %ebx
+  802165:	5e                   	pop    %esi
+  802166:	5d                   	pop    %ebp
+  802167:	c3                   	ret
+	assert(r <= n);
+  802168:	68 a8 34 80 00       	push   $0x8034a8
+  80216d:	68 4b 2f 80 00       	push   $0x802f4b
+  802172:	6a 76                	push   $0x76
+  802174:	68 af 34 80 00       	push   $0x8034af
+  802179:	e8 bf e1 ff ff       	call   80033d <_panic>
+	assert(r <= PGSIZE);
+  80217e:	68 ba 34 80 00       	push   $0x8034ba
+  802183:	68 4b 2f 80 00       	push   $0x802f4b
+  802188:	6a 77                	push   $0x77
+  80218a:	68 af 34 80 00       	push   $0x8034af
+  80218f:	e8 a9 e1 ff ff       	call   80033d <_panic>
+
+00802194 <open>:
+{
+  802194:	55                   	push   %ebp
+  802195:	89 e5                	mov    %esp,%ebp
+  802197:	56                   	push   %esi
+  802198:	53                   	push   %ebx
+  802199:	83 ec 1c             	sub    $0x1c,%esp
+  80219c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80219f:	56                   	push   %esi
+  8021a0:	e8 80 e8 ff ff       	call   800a25 <strlen>
+  8021a5:	83 c4 10             	add    $0x10,%esp
+  8021a8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021ad:	7f 6c                	jg     80221b <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8021af:	83 ec 0c             	sub    $0xc,%esp
+  8021b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b5:	50                   	push   %eax
+  8021b6:	e8 3a f8 ff ff       	call   8019f5 <fd_alloc>
+  8021bb:	89 c3                	mov    %eax,%ebx
+  8021bd:	83 c4 10             	add    $0x10,%esp
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	78 3c                	js     802200 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021c4:	83 ec 08             	sub    $0x8,%esp
+  8021c7:	56                   	push   %esi
+  8021c8:	68 00 60 80 00       	push   $0x806000
+  8021cd:	e8 8e e8 ff ff       	call   800a60 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021d5:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021e2:	e8 f6 fd ff ff       	call   801fdd <fsipc>
+  8021e7:	89 c3                	mov    %eax,%ebx
+  8021e9:	83 c4 10             	add    $0x10,%esp
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	78 19                	js     802209 <open+0x75>
+	return fd2num(fd);
+  8021f0:	83 ec 0c             	sub    $0xc,%esp
+  8021f3:	ff 75 f4             	push   -0xc(%ebp)
+  8021f6:	e8 d3 f7 ff ff       	call   8019ce <fd2num>
+  8021fb:	89 c3                	mov    %eax,%ebx
+  8021fd:	83 c4 10             	add    $0x10,%esp
+}
+  802200:	89 d8                	mov    %ebx,%eax
+  802202:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802205:	5b                   	pop    %ebx
+  802206:	5e                   	pop    %esi
+  802207:	5d                   	pop    %ebp
+  802208:	c3                   	ret
+		fd_close(fd, 0);
+  802209:	83 ec 08             	sub    $0x8,%esp
+  80220c:	6a 00                	push   $0x0
+  80220e:	ff 75 f4             	push   -0xc(%ebp)
+  802211:	e8 f8 f8 ff ff       	call   801b0e <fd_close>
+		return r;
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	eb e5                	jmp    802200 <open+0x6c>
+		return -E_BAD_PATH;
+  80221b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802220:	eb de                	jmp    802200 <open+0x6c>
+
+00802222 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802228:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802232:	e8 a6 fd ff ff       	call   801fdd <fsipc>
+}
+  802237:	c9                   	leave
+  802238:	c3                   	ret
+
+00802239 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802239:	55                   	push   %ebp
+  80223a:	89 e5                	mov    %esp,%ebp
+  80223c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80223f:	68 c6 34 80 00       	push   $0x8034c6
+  802244:	ff 75 0c             	push   0xc(%ebp)
+  802247:	e8 14 e8 ff ff       	call   800a60 <strcpy>
+	return 0;
+}
+  80224c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802251:	c9                   	leave
+  802252:	c3                   	ret
+
+00802253 <devsock_close>:
+{
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+  802256:	53                   	push   %ebx
+  802257:	83 ec 10             	sub    $0x10,%esp
+  80225a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80225d:	53                   	push   %ebx
+  80225e:	e8 28 0c 00 00       	call   802e8b <pageref>
+  802263:	89 c2                	mov    %eax,%edx
+  802265:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802268:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80226d:	83 fa 01             	cmp    $0x1,%edx
+  802270:	74 05                	je     802277 <devsock_close+0x24>
+}
+  802272:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802275:	c9                   	leave
+  802276:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802277:	83 ec 0c             	sub    $0xc,%esp
+  80227a:	ff 73 0c             	push   0xc(%ebx)
+  80227d:	e8 b7 02 00 00       	call   802539 <nsipc_close>
+  802282:	83 c4 10             	add    $0x10,%esp
+  802285:	eb eb                	jmp    802272 <devsock_close+0x1f>
+
+00802287 <devsock_write>:
+{
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80228d:	6a 00                	push   $0x0
+  80228f:	ff 75 10             	push   0x10(%ebp)
+  802292:	ff 75 0c             	push   0xc(%ebp)
+  802295:	8b 45 08             	mov    0x8(%ebp),%eax
+  802298:	ff 70 0c             	push   0xc(%eax)
+  80229b:	e8 79 03 00 00       	call   802619 <nsipc_send>
+}
+  8022a0:	c9                   	leave
+  8022a1:	c3                   	ret
+
+008022a2 <devsock_read>:
+{
+  8022a2:	55                   	push   %ebp
+  8022a3:	89 e5                	mov    %esp,%ebp
+  8022a5:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8022a8:	6a 00                	push   $0x0
+  8022aa:	ff 75 10             	push   0x10(%ebp)
+  8022ad:	ff 75 0c             	push   0xc(%ebp)
+  8022b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b3:	ff 70 0c             	push   0xc(%eax)
+  8022b6:	e8 ef 02 00 00       	call   8025aa <nsipc_recv>
+}
+  8022bb:	c9                   	leave
+  8022bc:	c3                   	ret
+
+008022bd <fd2sockid>:
+{
+  8022bd:	55                   	push   %ebp
+  8022be:	89 e5                	mov    %esp,%ebp
+  8022c0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8022c3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022c6:	52                   	push   %edx
+  8022c7:	50                   	push   %eax
+  8022c8:	e8 7e f7 ff ff       	call   801a4b <fd_lookup>
+  8022cd:	83 c4 10             	add    $0x10,%esp
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	78 10                	js     8022e4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8022d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022d7:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022dd:	39 08                	cmp    %ecx,(%eax)
+  8022df:	75 05                	jne    8022e6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8022e1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8022e4:	c9                   	leave
+  8022e5:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022eb:	eb f7                	jmp    8022e4 <fd2sockid+0x27>
+
+008022ed <alloc_sockfd>:
+{
+  8022ed:	55                   	push   %ebp
+  8022ee:	89 e5                	mov    %esp,%ebp
+  8022f0:	56                   	push   %esi
+  8022f1:	53                   	push   %ebx
+  8022f2:	83 ec 1c             	sub    $0x1c,%esp
+  8022f5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8022f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022fa:	50                   	push   %eax
+  8022fb:	e8 f5 f6 ff ff       	call   8019f5 <fd_alloc>
+  802300:	89 c3                	mov    %eax,%ebx
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 43                	js     80234c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802309:	83 ec 04             	sub    $0x4,%esp
+  80230c:	68 07 04 00 00       	push   $0x407
+  802311:	ff 75 f4             	push   -0xc(%ebp)
+  802314:	6a 00                	push   $0x0
+  802316:	e8 3d ec ff ff       	call   800f58 <sys_page_alloc>
+  80231b:	89 c3                	mov    %eax,%ebx
+  80231d:	83 c4 10             	add    $0x10,%esp
+  802320:	85 c0                	test   %eax,%eax
+  802322:	78 28                	js     80234c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802324:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802327:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80232d:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80232f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802332:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802339:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80233c:	83 ec 0c             	sub    $0xc,%esp
+  80233f:	50                   	push   %eax
+  802340:	e8 89 f6 ff ff       	call   8019ce <fd2num>
+  802345:	89 c3                	mov    %eax,%ebx
+  802347:	83 c4 10             	add    $0x10,%esp
+  80234a:	eb 0c                	jmp    802358 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  80234c:	83 ec 0c             	sub    $0xc,%esp
+  80234f:	56                   	push   %esi
+  802350:	e8 e4 01 00 00       	call   802539 <nsipc_close>
+		return r;
+  802355:	83 c4 10             	add    $0x10,%esp
+}
+  802358:	89 d8                	mov    %ebx,%eax
+  80235a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80235d:	5b                   	pop    %ebx
+  80235e:	5e                   	pop    %esi
+  80235f:	5d                   	pop    %ebp
+  802360:	c3                   	ret
+
+00802361 <accept>:
+{
+  802361:	55                   	push   %ebp
+  802362:	89 e5                	mov    %esp,%ebp
+  802364:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802367:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236a:	e8 4e ff ff ff       	call   8022bd <fd2sockid>
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	78 1b                	js     80238e <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802373:	83 ec 04             	sub    $0x4,%esp
+  802376:	ff 75 10             	push   0x10(%ebp)
+  802379:	ff 75 0c             	push   0xc(%ebp)
+  80237c:	50                   	push   %eax
+  80237d:	e8 0e 01 00 00       	call   802490 <nsipc_accept>
+  802382:	83 c4 10             	add    $0x10,%esp
+  802385:	85 c0                	test   %eax,%eax
+  802387:	78 05                	js     80238e <accept+0x2d>
+	return alloc_sockfd(r);
+  802389:	e8 5f ff ff ff       	call   8022ed <alloc_sockfd>
+}
+  80238e:	c9                   	leave
+  80238f:	c3                   	ret
+
+00802390 <bind>:
+{
+  802390:	55                   	push   %ebp
+  802391:	89 e5                	mov    %esp,%ebp
+  802393:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802396:	8b 45 08             	mov    0x8(%ebp),%eax
+  802399:	e8 1f ff ff ff       	call   8022bd <fd2sockid>
+  80239e:	85 c0                	test   %eax,%eax
+  8023a0:	78 12                	js     8023b4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8023a2:	83 ec 04             	sub    $0x4,%esp
+  8023a5:	ff 75 10             	push   0x10(%ebp)
+  8023a8:	ff 75 0c             	push   0xc(%ebp)
+  8023ab:	50                   	push   %eax
+  8023ac:	e8 31 01 00 00       	call   8024e2 <nsipc_bind>
+  8023b1:	83 c4 10             	add    $0x10,%esp
+}
+  8023b4:	c9                   	leave
+  8023b5:	c3                   	ret
+
+008023b6 <shutdown>:
+{
+  8023b6:	55                   	push   %ebp
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bf:	e8 f9 fe ff ff       	call   8022bd <fd2sockid>
+  8023c4:	85 c0                	test   %eax,%eax
+  8023c6:	78 0f                	js     8023d7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8023c8:	83 ec 08             	sub    $0x8,%esp
+  8023cb:	ff 75 0c             	push   0xc(%ebp)
+  8023ce:	50                   	push   %eax
+  8023cf:	e8 43 01 00 00       	call   802517 <nsipc_shutdown>
+  8023d4:	83 c4 10             	add    $0x10,%esp
+}
+  8023d7:	c9                   	leave
+  8023d8:	c3                   	ret
+
+008023d9 <connect>:
+{
+  8023d9:	55                   	push   %ebp
+  8023da:	89 e5                	mov    %esp,%ebp
+  8023dc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8023df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e2:	e8 d6 fe ff ff       	call   8022bd <fd2sockid>
+  8023e7:	85 c0                	test   %eax,%eax
+  8023e9:	78 12                	js     8023fd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8023eb:	83 ec 04             	sub    $0x4,%esp
+  8023ee:	ff 75 10             	push   0x10(%ebp)
+  8023f1:	ff 75 0c             	push   0xc(%ebp)
+  8023f4:	50                   	push   %eax
+  8023f5:	e8 59 01 00 00       	call   802553 <nsipc_connect>
+  8023fa:	83 c4 10             	add    $0x10,%esp
+}
+  8023fd:	c9                   	leave
+  8023fe:	c3                   	ret
+
+008023ff <listen>:
+{
+  8023ff:	55                   	push   %ebp
+  802400:	89 e5                	mov    %esp,%ebp
+  802402:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802405:	8b 45 08             	mov    0x8(%ebp),%eax
+  802408:	e8 b0 fe ff ff       	call   8022bd <fd2sockid>
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 0f                	js     802420 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802411:	83 ec 08             	sub    $0x8,%esp
+  802414:	ff 75 0c             	push   0xc(%ebp)
+  802417:	50                   	push   %eax
+  802418:	e8 6b 01 00 00       	call   802588 <nsipc_listen>
+  80241d:	83 c4 10             	add    $0x10,%esp
+}
+  802420:	c9                   	leave
+  802421:	c3                   	ret
+
+00802422 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802422:	55                   	push   %ebp
+  802423:	89 e5                	mov    %esp,%ebp
+  802425:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802428:	ff 75 10             	push   0x10(%ebp)
+  80242b:	ff 75 0c             	push   0xc(%ebp)
+  80242e:	ff 75 08             	push   0x8(%ebp)
+  802431:	e8 41 02 00 00       	call   802677 <nsipc_socket>
+  802436:	83 c4 10             	add    $0x10,%esp
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	78 05                	js     802442 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80243d:	e8 ab fe ff ff       	call   8022ed <alloc_sockfd>
+}
+  802442:	c9                   	leave
+  802443:	c3                   	ret
+
+00802444 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802444:	55                   	push   %ebp
+  802445:	89 e5                	mov    %esp,%ebp
+  802447:	53                   	push   %ebx
+  802448:	83 ec 04             	sub    $0x4,%esp
+  80244b:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  80244d:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802454:	74 26                	je     80247c <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802456:	6a 07                	push   $0x7
+  802458:	68 00 70 80 00       	push   $0x807000
+  80245d:	53                   	push   %ebx
+  80245e:	ff 35 04 50 80 00    	push   0x805004
+  802464:	e8 8f 09 00 00       	call   802df8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802469:	83 c4 0c             	add    $0xc,%esp
+  80246c:	6a 00                	push   $0x0
+  80246e:	6a 00                	push   $0x0
+  802470:	6a 00                	push   $0x0
+  802472:	e8 69 09 00 00       	call   802de0 <ipc_recv>
+}
+  802477:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80247a:	c9                   	leave
+  80247b:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80247c:	83 ec 0c             	sub    $0xc,%esp
+  80247f:	6a 02                	push   $0x2
+  802481:	e8 c6 09 00 00       	call   802e4c <ipc_find_env>
+  802486:	a3 04 50 80 00       	mov    %eax,0x805004
+  80248b:	83 c4 10             	add    $0x10,%esp
+  80248e:	eb c6                	jmp    802456 <nsipc+0x12>
+
+00802490 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802490:	55                   	push   %ebp
+  802491:	89 e5                	mov    %esp,%ebp
+  802493:	56                   	push   %esi
+  802494:	53                   	push   %ebx
+  802495:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802498:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8024a0:	8b 06                	mov    (%esi),%eax
+  8024a2:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8024a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024ac:	e8 93 ff ff ff       	call   802444 <nsipc>
+  8024b1:	89 c3                	mov    %eax,%ebx
+  8024b3:	85 c0                	test   %eax,%eax
+  8024b5:	79 09                	jns    8024c0 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8024b7:	89 d8                	mov    %ebx,%eax
+  8024b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024bc:	5b                   	pop    %ebx
+  8024bd:	5e                   	pop    %esi
+  8024be:	5d                   	pop    %ebp
+  8024bf:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8024c0:	83 ec 04             	sub    $0x4,%esp
+  8024c3:	ff 35 10 70 80 00    	push   0x807010
+  8024c9:	68 00 70 80 00       	push   $0x807000
+  8024ce:	ff 75 0c             	push   0xc(%ebp)
+  8024d1:	e8 10 e7 ff ff       	call   800be6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8024d6:	a1 10 70 80 00       	mov    0x807010,%eax
+  8024db:	89 06                	mov    %eax,(%esi)
+  8024dd:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8024e0:	eb d5                	jmp    8024b7 <nsipc_accept+0x27>
+
+008024e2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8024e2:	55                   	push   %ebp
+  8024e3:	89 e5                	mov    %esp,%ebp
+  8024e5:	53                   	push   %ebx
+  8024e6:	83 ec 08             	sub    $0x8,%esp
+  8024e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8024ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ef:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8024f4:	53                   	push   %ebx
+  8024f5:	ff 75 0c             	push   0xc(%ebp)
+  8024f8:	68 04 70 80 00       	push   $0x807004
+  8024fd:	e8 e4 e6 ff ff       	call   800be6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802502:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802508:	b8 02 00 00 00       	mov    $0x2,%eax
+  80250d:	e8 32 ff ff ff       	call   802444 <nsipc>
+}
+  802512:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802515:	c9                   	leave
+  802516:	c3                   	ret
+
+00802517 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802517:	55                   	push   %ebp
+  802518:	89 e5                	mov    %esp,%ebp
+  80251a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80251d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802520:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802525:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802528:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80252d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802532:	e8 0d ff ff ff       	call   802444 <nsipc>
+}
+  802537:	c9                   	leave
+  802538:	c3                   	ret
+
+00802539 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802539:	55                   	push   %ebp
+  80253a:	89 e5                	mov    %esp,%ebp
+  80253c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80253f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802542:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802547:	b8 04 00 00 00       	mov    $0x4,%eax
+  80254c:	e8 f3 fe ff ff       	call   802444 <nsipc>
+}
+  802551:	c9                   	leave
+  802552:	c3                   	ret
+
+00802553 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802553:	55                   	push   %ebp
+  802554:	89 e5                	mov    %esp,%ebp
+  802556:	53                   	push   %ebx
+  802557:	83 ec 08             	sub    $0x8,%esp
+  80255a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80255d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802560:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802565:	53                   	push   %ebx
+  802566:	ff 75 0c             	push   0xc(%ebp)
+  802569:	68 04 70 80 00       	push   $0x807004
+  80256e:	e8 73 e6 ff ff       	call   800be6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802573:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802579:	b8 05 00 00 00       	mov    $0x5,%eax
+  80257e:	e8 c1 fe ff ff       	call   802444 <nsipc>
+}
+  802583:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802586:	c9                   	leave
+  802587:	c3                   	ret
+
+00802588 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802588:	55                   	push   %ebp
+  802589:	89 e5                	mov    %esp,%ebp
+  80258b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80258e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802591:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802596:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802599:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80259e:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025a3:	e8 9c fe ff ff       	call   802444 <nsipc>
+}
+  8025a8:	c9                   	leave
+  8025a9:	c3                   	ret
+
+008025aa <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8025aa:	55                   	push   %ebp
+  8025ab:	89 e5                	mov    %esp,%ebp
+  8025ad:	56                   	push   %esi
+  8025ae:	53                   	push   %ebx
+  8025af:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8025b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8025ba:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8025c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025c3:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8025c8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025cd:	e8 72 fe ff ff       	call   802444 <nsipc>
+  8025d2:	89 c3                	mov    %eax,%ebx
+  8025d4:	85 c0                	test   %eax,%eax
+  8025d6:	78 22                	js     8025fa <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8025d8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8025dd:	39 c6                	cmp    %eax,%esi
+  8025df:	0f 4e c6             	cmovle %esi,%eax
+  8025e2:	39 c3                	cmp    %eax,%ebx
+  8025e4:	7f 1d                	jg     802603 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8025e6:	83 ec 04             	sub    $0x4,%esp
+  8025e9:	53                   	push   %ebx
+  8025ea:	68 00 70 80 00       	push   $0x807000
+  8025ef:	ff 75 0c             	push   0xc(%ebp)
+  8025f2:	e8 ef e5 ff ff       	call   800be6 <memmove>
+  8025f7:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8025fa:	89 d8                	mov    %ebx,%eax
+  8025fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ff:	5b                   	pop    %ebx
+  802600:	5e                   	pop    %esi
+  802601:	5d                   	pop    %ebp
+  802602:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802603:	68 d2 34 80 00       	push   $0x8034d2
+  802608:	68 4b 2f 80 00       	push   $0x802f4b
+  80260d:	6a 62                	push   $0x62
+  80260f:	68 e7 34 80 00       	push   $0x8034e7
+  802614:	e8 24 dd ff ff       	call   80033d <_panic>
+
+00802619 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802619:	55                   	push   %ebp
+  80261a:	89 e5                	mov    %esp,%ebp
+  80261c:	53                   	push   %ebx
+  80261d:	83 ec 04             	sub    $0x4,%esp
+  802620:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802623:	8b 45 08             	mov    0x8(%ebp),%eax
+  802626:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80262b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802631:	7f 2e                	jg     802661 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802633:	83 ec 04             	sub    $0x4,%esp
+  802636:	53                   	push   %ebx
+  802637:	ff 75 0c             	push   0xc(%ebp)
+  80263a:	68 0c 70 80 00       	push   $0x80700c
+  80263f:	e8 a2 e5 ff ff       	call   800be6 <memmove>
+	nsipcbuf.send.req_size = size;
+  802644:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80264a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264d:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802652:	b8 08 00 00 00       	mov    $0x8,%eax
+  802657:	e8 e8 fd ff ff       	call   802444 <nsipc>
+}
+  80265c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80265f:	c9                   	leave
+  802660:	c3                   	ret
+	assert(size < 1600);
+  802661:	68 f3 34 80 00       	push   $0x8034f3
+  802666:	68 4b 2f 80 00       	push   $0x802f4b
+  80266b:	6a 6d                	push   $0x6d
+  80266d:	68 e7 34 80 00       	push   $0x8034e7
+  802672:	e8 c6 dc ff ff       	call   80033d <_panic>
+
+00802677 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802677:	55                   	push   %ebp
+  802678:	89 e5                	mov    %esp,%ebp
+  80267a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80267d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802680:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802685:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802688:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80268d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802690:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802695:	b8 09 00 00 00       	mov    $0x9,%eax
+  80269a:	e8 a5 fd ff ff       	call   802444 <nsipc>
+}
+  80269f:	c9                   	leave
+  8026a0:	c3                   	ret
+
+008026a1 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026a1:	55                   	push   %ebp
+  8026a2:	89 e5                	mov    %esp,%ebp
+  8026a4:	56                   	push   %esi
+  8026a5:	53                   	push   %ebx
+  8026a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8026a9:	83 ec 0c             	sub    $0xc,%esp
+  8026ac:	ff 75 08             	push   0x8(%ebp)
+  8026af:	e8 2a f3 ff ff       	call   8019de <fd2data>
+  8026b4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8026b6:	83 c4 08             	add    $0x8,%esp
+  8026b9:	68 ff 34 80 00       	push   $0x8034ff
+  8026be:	53                   	push   %ebx
+  8026bf:	e8 9c e3 ff ff       	call   800a60 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8026c4:	8b 46 04             	mov    0x4(%esi),%eax
+  8026c7:	2b 06                	sub    (%esi),%eax
+  8026c9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8026cf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026d6:	00 00 00 
+	stat->st_dev = &devpipe;
+  8026d9:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8026e0:	40 80 00 
+	return 0;
+}
+  8026e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026eb:	5b                   	pop    %ebx
+  8026ec:	5e                   	pop    %esi
+  8026ed:	5d                   	pop    %ebp
+  8026ee:	c3                   	ret
+
+008026ef <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8026ef:	55                   	push   %ebp
+  8026f0:	89 e5                	mov    %esp,%ebp
+  8026f2:	53                   	push   %ebx
+  8026f3:	83 ec 0c             	sub    $0xc,%esp
+  8026f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8026f9:	53                   	push   %ebx
+  8026fa:	6a 00                	push   $0x0
+  8026fc:	e8 32 e9 ff ff       	call   801033 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802701:	89 1c 24             	mov    %ebx,(%esp)
+  802704:	e8 d5 f2 ff ff       	call   8019de <fd2data>
+  802709:	83 c4 08             	add    $0x8,%esp
+  80270c:	50                   	push   %eax
+  80270d:	6a 00                	push   $0x0
+  80270f:	e8 1f e9 ff ff       	call   801033 <sys_page_unmap>
+}
+  802714:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802717:	c9                   	leave
+  802718:	c3                   	ret
+
+00802719 <_pipeisclosed>:
+{
+  802719:	55                   	push   %ebp
+  80271a:	89 e5                	mov    %esp,%ebp
+  80271c:	57                   	push   %edi
+  80271d:	56                   	push   %esi
+  80271e:	53                   	push   %ebx
+  80271f:	83 ec 1c             	sub    $0x1c,%esp
+  802722:	89 c7                	mov    %eax,%edi
+  802724:	89 d6                	mov    %edx,%esi
+  802726:	eb 3c                	jmp    802764 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802728:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  80272b:	83 ec 0c             	sub    $0xc,%esp
+  80272e:	57                   	push   %edi
+  80272f:	e8 57 07 00 00       	call   802e8b <pageref>
+  802734:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802737:	89 34 24             	mov    %esi,(%esp)
+  80273a:	e8 4c 07 00 00       	call   802e8b <pageref>
+  80273f:	89 c2                	mov    %eax,%edx
+  802741:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802743:	05 00 00 00 20       	add    $0x20000000,%eax
+  802748:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80274b:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802751:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802756:	76 31                	jbe    802789 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802758:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80275b:	39 c3                	cmp    %eax,%ebx
+  80275d:	74 76                	je     8027d5 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80275f:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802762:	74 36                	je     80279a <_pipeisclosed+0x81>
+  802764:	89 e0                	mov    %esp,%eax
+  802766:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80276b:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802771:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802776:	77 b0                	ja     802728 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802778:	c1 e8 10             	shr    $0x10,%eax
+  80277b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802781:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802787:	eb 9f                	jmp    802728 <_pipeisclosed+0xf>
+  802789:	c1 e8 10             	shr    $0x10,%eax
+  80278c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802792:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802798:	eb be                	jmp    802758 <_pipeisclosed+0x3f>
+  80279a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80279c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8027a1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027a7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8027ac:	76 16                	jbe    8027c4 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027ae:	8b 42 58             	mov    0x58(%edx),%eax
+  8027b1:	6a 01                	push   $0x1
+  8027b3:	50                   	push   %eax
+  8027b4:	53                   	push   %ebx
+  8027b5:	68 06 35 80 00       	push   $0x803506
+  8027ba:	e8 59 dc ff ff       	call   800418 <cprintf>
+  8027bf:	83 c4 10             	add    $0x10,%esp
+  8027c2:	eb a0                	jmp    802764 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8027c4:	c1 e8 10             	shr    $0x10,%eax
+  8027c7:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027cd:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8027d3:	eb d9                	jmp    8027ae <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8027d5:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8027d8:	0f 94 c0             	sete   %al
+  8027db:	0f b6 c0             	movzbl %al,%eax
+}
+  8027de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027e1:	5b                   	pop    %ebx
+  8027e2:	5e                   	pop    %esi
+  8027e3:	5f                   	pop    %edi
+  8027e4:	5d                   	pop    %ebp
+  8027e5:	c3                   	ret
+
+008027e6 <devpipe_write>:
+{
+  8027e6:	55                   	push   %ebp
+  8027e7:	89 e5                	mov    %esp,%ebp
+  8027e9:	57                   	push   %edi
+  8027ea:	56                   	push   %esi
+  8027eb:	53                   	push   %ebx
+  8027ec:	83 ec 28             	sub    $0x28,%esp
+  8027ef:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8027f2:	56                   	push   %esi
+  8027f3:	e8 e6 f1 ff ff       	call   8019de <fd2data>
+  8027f8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802802:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802805:	75 09                	jne    802810 <devpipe_write+0x2a>
+	return i;
+  802807:	89 f8                	mov    %edi,%eax
+  802809:	eb 23                	jmp    80282e <devpipe_write+0x48>
+			sys_yield();
+  80280b:	e8 02 e7 ff ff       	call   800f12 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802810:	8b 43 04             	mov    0x4(%ebx),%eax
+  802813:	8b 0b                	mov    (%ebx),%ecx
+  802815:	8d 51 20             	lea    0x20(%ecx),%edx
+  802818:	39 d0                	cmp    %edx,%eax
+  80281a:	72 1a                	jb     802836 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80281c:	89 da                	mov    %ebx,%edx
+  80281e:	89 f0                	mov    %esi,%eax
+  802820:	e8 f4 fe ff ff       	call   802719 <_pipeisclosed>
+  802825:	85 c0                	test   %eax,%eax
+  802827:	74 e2                	je     80280b <devpipe_write+0x25>
+				return 0;
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80282e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802831:	5b                   	pop    %ebx
+  802832:	5e                   	pop    %esi
+  802833:	5f                   	pop    %edi
+  802834:	5d                   	pop    %ebp
+  802835:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802836:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802839:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80283d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802840:	89 c2                	mov    %eax,%edx
+  802842:	c1 fa 1f             	sar    $0x1f,%edx
+  802845:	89 d1                	mov    %edx,%ecx
+  802847:	c1 e9 1b             	shr    $0x1b,%ecx
+  80284a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80284d:	83 e2 1f             	and    $0x1f,%edx
+  802850:	29 ca                	sub    %ecx,%edx
+  802852:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802856:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80285a:	83 c0 01             	add    $0x1,%eax
+  80285d:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802860:	83 c7 01             	add    $0x1,%edi
+  802863:	eb 9d                	jmp    802802 <devpipe_write+0x1c>
+
+00802865 <devpipe_read>:
+{
+  802865:	55                   	push   %ebp
+  802866:	89 e5                	mov    %esp,%ebp
+  802868:	57                   	push   %edi
+  802869:	56                   	push   %esi
+  80286a:	53                   	push   %ebx
+  80286b:	83 ec 18             	sub    $0x18,%esp
+  80286e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802871:	57                   	push   %edi
+  802872:	e8 67 f1 ff ff       	call   8019de <fd2data>
+  802877:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802879:	83 c4 10             	add    $0x10,%esp
+  80287c:	be 00 00 00 00       	mov    $0x0,%esi
+  802881:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802884:	75 13                	jne    802899 <devpipe_read+0x34>
+	return i;
+  802886:	89 f0                	mov    %esi,%eax
+  802888:	eb 02                	jmp    80288c <devpipe_read+0x27>
+				return i;
+  80288a:	89 f0                	mov    %esi,%eax
+}
+  80288c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80288f:	5b                   	pop    %ebx
+  802890:	5e                   	pop    %esi
+  802891:	5f                   	pop    %edi
+  802892:	5d                   	pop    %ebp
+  802893:	c3                   	ret
+			sys_yield();
+  802894:	e8 79 e6 ff ff       	call   800f12 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802899:	8b 03                	mov    (%ebx),%eax
+  80289b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80289e:	75 18                	jne    8028b8 <devpipe_read+0x53>
+			if (i > 0)
+  8028a0:	85 f6                	test   %esi,%esi
+  8028a2:	75 e6                	jne    80288a <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8028a4:	89 da                	mov    %ebx,%edx
+  8028a6:	89 f8                	mov    %edi,%eax
+  8028a8:	e8 6c fe ff ff       	call   802719 <_pipeisclosed>
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	74 e3                	je     802894 <devpipe_read+0x2f>
+				return 0;
+  8028b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b6:	eb d4                	jmp    80288c <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8028b8:	99                   	cltd
+  8028b9:	c1 ea 1b             	shr    $0x1b,%edx
+  8028bc:	01 d0                	add    %edx,%eax
+  8028be:	83 e0 1f             	and    $0x1f,%eax
+  8028c1:	29 d0                	sub    %edx,%eax
+  8028c3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028cb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8028ce:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8028d1:	83 c6 01             	add    $0x1,%esi
+  8028d4:	eb ab                	jmp    802881 <devpipe_read+0x1c>
+
+008028d6 <pipe>:
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	56                   	push   %esi
+  8028da:	53                   	push   %ebx
+  8028db:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8028de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028e1:	50                   	push   %eax
+  8028e2:	e8 0e f1 ff ff       	call   8019f5 <fd_alloc>
+  8028e7:	89 c3                	mov    %eax,%ebx
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	0f 88 23 01 00 00    	js     802a17 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028f4:	83 ec 04             	sub    $0x4,%esp
+  8028f7:	68 07 04 00 00       	push   $0x407
+  8028fc:	ff 75 f4             	push   -0xc(%ebp)
+  8028ff:	6a 00                	push   $0x0
+  802901:	e8 52 e6 ff ff       	call   800f58 <sys_page_alloc>
+  802906:	89 c3                	mov    %eax,%ebx
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	0f 88 04 01 00 00    	js     802a17 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802913:	83 ec 0c             	sub    $0xc,%esp
+  802916:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802919:	50                   	push   %eax
+  80291a:	e8 d6 f0 ff ff       	call   8019f5 <fd_alloc>
+  80291f:	89 c3                	mov    %eax,%ebx
+  802921:	83 c4 10             	add    $0x10,%esp
+  802924:	85 c0                	test   %eax,%eax
+  802926:	0f 88 db 00 00 00    	js     802a07 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80292c:	83 ec 04             	sub    $0x4,%esp
+  80292f:	68 07 04 00 00       	push   $0x407
+  802934:	ff 75 f0             	push   -0x10(%ebp)
+  802937:	6a 00                	push   $0x0
+  802939:	e8 1a e6 ff ff       	call   800f58 <sys_page_alloc>
+  80293e:	89 c3                	mov    %eax,%ebx
+  802940:	83 c4 10             	add    $0x10,%esp
+  802943:	85 c0                	test   %eax,%eax
+  802945:	0f 88 bc 00 00 00    	js     802a07 <pipe+0x131>
+	va = fd2data(fd0);
+  80294b:	83 ec 0c             	sub    $0xc,%esp
+  80294e:	ff 75 f4             	push   -0xc(%ebp)
+  802951:	e8 88 f0 ff ff       	call   8019de <fd2data>
+  802956:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802958:	83 c4 0c             	add    $0xc,%esp
+  80295b:	68 07 04 00 00       	push   $0x407
+  802960:	50                   	push   %eax
+  802961:	6a 00                	push   $0x0
+  802963:	e8 f0 e5 ff ff       	call   800f58 <sys_page_alloc>
+  802968:	89 c3                	mov    %eax,%ebx
+  80296a:	83 c4 10             	add    $0x10,%esp
+  80296d:	85 c0                	test   %eax,%eax
+  80296f:	0f 88 82 00 00 00    	js     8029f7 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802975:	83 ec 0c             	sub    $0xc,%esp
+  802978:	ff 75 f0             	push   -0x10(%ebp)
+  80297b:	e8 5e f0 ff ff       	call   8019de <fd2data>
+  802980:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802987:	50                   	push   %eax
+  802988:	6a 00                	push   $0x0
+  80298a:	56                   	push   %esi
+  80298b:	6a 00                	push   $0x0
+  80298d:	e8 33 e6 ff ff       	call   800fc5 <sys_page_map>
+  802992:	89 c3                	mov    %eax,%ebx
+  802994:	83 c4 20             	add    $0x20,%esp
+  802997:	85 c0                	test   %eax,%eax
+  802999:	78 4e                	js     8029e9 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80299b:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8029a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029a3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8029a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029a8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8029af:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8029b2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8029b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029b7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8029be:	83 ec 0c             	sub    $0xc,%esp
+  8029c1:	ff 75 f4             	push   -0xc(%ebp)
+  8029c4:	e8 05 f0 ff ff       	call   8019ce <fd2num>
+  8029c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029cc:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8029ce:	83 c4 04             	add    $0x4,%esp
+  8029d1:	ff 75 f0             	push   -0x10(%ebp)
+  8029d4:	e8 f5 ef ff ff       	call   8019ce <fd2num>
+  8029d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029dc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8029df:	83 c4 10             	add    $0x10,%esp
+  8029e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e7:	eb 2e                	jmp    802a17 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8029e9:	83 ec 08             	sub    $0x8,%esp
+  8029ec:	56                   	push   %esi
+  8029ed:	6a 00                	push   $0x0
+  8029ef:	e8 3f e6 ff ff       	call   801033 <sys_page_unmap>
+  8029f4:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8029f7:	83 ec 08             	sub    $0x8,%esp
+  8029fa:	ff 75 f0             	push   -0x10(%ebp)
+  8029fd:	6a 00                	push   $0x0
+  8029ff:	e8 2f e6 ff ff       	call   801033 <sys_page_unmap>
+  802a04:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802a07:	83 ec 08             	sub    $0x8,%esp
+  802a0a:	ff 75 f4             	push   -0xc(%ebp)
+  802a0d:	6a 00                	push   $0x0
+  802a0f:	e8 1f e6 ff ff       	call   801033 <sys_page_unmap>
+  802a14:	83 c4 10             	add    $0x10,%esp
+}
+  802a17:	89 d8                	mov    %ebx,%eax
+  802a19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a1c:	5b                   	pop    %ebx
+  802a1d:	5e                   	pop    %esi
+  802a1e:	5d                   	pop    %ebp
+  802a1f:	c3                   	ret
+
+00802a20 <pipeisclosed>:
+{
+  802a20:	55                   	push   %ebp
+  802a21:	89 e5                	mov    %esp,%ebp
+  802a23:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a29:	50                   	push   %eax
+  802a2a:	ff 75 08             	push   0x8(%ebp)
+  802a2d:	e8 19 f0 ff ff       	call   801a4b <fd_lookup>
+  802a32:	83 c4 10             	add    $0x10,%esp
+  802a35:	85 c0                	test   %eax,%eax
+  802a37:	78 18                	js     802a51 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802a39:	83 ec 0c             	sub    $0xc,%esp
+  802a3c:	ff 75 f4             	push   -0xc(%ebp)
+  802a3f:	e8 9a ef ff ff       	call   8019de <fd2data>
+  802a44:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802a46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a49:	e8 cb fc ff ff       	call   802719 <_pipeisclosed>
+  802a4e:	83 c4 10             	add    $0x10,%esp
+}
+  802a51:	c9                   	leave
+  802a52:	c3                   	ret
+
+00802a53 <time_nsec>:
+#include <inc/x86.h>
+
+// Nanoseconds since boot.
+uint64_t
+time_nsec(void)
+{
+  802a53:	55                   	push   %ebp
+  802a54:	89 e5                	mov    %esp,%ebp
+  802a56:	57                   	push   %edi
+  802a57:	56                   	push   %esi
+  802a58:	53                   	push   %ebx
+  802a59:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ns_mult, timeinfo.ti_ns_shift);
+  802a5c:	a1 10 f0 ff ee       	mov    0xeefff010,%eax
+  802a61:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  802a64:	8b 3d 0c f0 ff ee    	mov    0xeefff00c,%edi
+  802a6a:	89 7d ec             	mov    %edi,-0x14(%ebp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  802a6d:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  802a6f:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  802a75:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  802a7b:	29 f0                	sub    %esi,%eax
+  802a7d:	19 fa                	sbb    %edi,%edx
+  802a7f:	89 c1                	mov    %eax,%ecx
+  802a81:	89 d3                	mov    %edx,%ebx
+// libgcc for 64-bit arithmetic.  The low 32 bits of the 96-bit product
+// are dropped before the shift, which costs less than one unit.
+static inline uint64_t
+tsc_scale(uint64_t ticks, uint32_t mult, uint32_t shift)
+{
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  802a83:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  802a86:	6b f7 00             	imul   $0x0,%edi,%esi
+  802a89:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802a8c:	89 f8                	mov    %edi,%eax
+  802a8e:	f7 e1                	mul    %ecx
+  802a90:	89 c6                	mov    %eax,%esi
+  802a92:	89 d7                	mov    %edx,%edi
+  802a94:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a97:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  802a99:	89 d8                	mov    %ebx,%eax
+  802a9b:	f7 65 ec             	mull   -0x14(%ebp)
+
+	if (shift >= 32)
+  802a9e:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  802aa2:	77 34                	ja     802ad8 <time_nsec+0x85>
+		return (hi + (lo >> 32)) >> (shift - 32);
+	return (hi << (32 - shift)) + (lo >> shift);
+  802aa4:	b9 20 00 00 00       	mov    $0x20,%ecx
+  802aa9:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  802aac:	29 d9                	sub    %ebx,%ecx
+  802aae:	0f a5 c2             	shld   %cl,%eax,%edx
+  802ab1:	d3 e0                	shl    %cl,%eax
+  802ab3:	f6 c1 20             	test   $0x20,%cl
+  802ab6:	74 04                	je     802abc <time_nsec+0x69>
+  802ab8:	89 c2                	mov    %eax,%edx
+  802aba:	31 c0                	xor    %eax,%eax
+  802abc:	89 d9                	mov    %ebx,%ecx
+  802abe:	0f ad fe             	shrd   %cl,%edi,%esi
+  802ac1:	d3 ef                	shr    %cl,%edi
+  802ac3:	f6 c1 20             	test   $0x20,%cl
+  802ac6:	74 04                	je     802acc <time_nsec+0x79>
+  802ac8:	89 fe                	mov    %edi,%esi
+  802aca:	31 ff                	xor    %edi,%edi
+  802acc:	01 f0                	add    %esi,%eax
+  802ace:	11 fa                	adc    %edi,%edx
+}
+  802ad0:	83 c4 14             	add    $0x14,%esp
+  802ad3:	5b                   	pop    %ebx
+  802ad4:	5e                   	pop    %esi
+  802ad5:	5f                   	pop    %edi
+  802ad6:	5d                   	pop    %ebp
+  802ad7:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  802ad8:	89 fe                	mov    %edi,%esi
+  802ada:	31 ff                	xor    %edi,%edi
+  802adc:	01 f0                	add    %esi,%eax
+  802ade:	11 fa                	adc    %edi,%edx
+  802ae0:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  802ae3:	83 e9 20             	sub    $0x20,%ecx
+  802ae6:	0f ad d0             	shrd   %cl,%edx,%eax
+  802ae9:	d3 ea                	shr    %cl,%edx
+  802aeb:	f6 c1 20             	test   $0x20,%cl
+  802aee:	74 04                	je     802af4 <time_nsec+0xa1>
+  802af0:	89 d0                	mov    %edx,%eax
+  802af2:	31 d2                	xor    %edx,%edx
+  802af4:	eb da                	jmp    802ad0 <time_nsec+0x7d>
+
+00802af6 <time_msec>:
+
+// Milliseconds since boot; the same clock as sys_time_msec().
+unsigned int
+time_msec(void)
+{
+  802af6:	55                   	push   %ebp
+  802af7:	89 e5                	mov    %esp,%ebp
+  802af9:	57                   	push   %edi
+  802afa:	56                   	push   %esi
+  802afb:	53                   	push   %ebx
+  802afc:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ms_mult, timeinfo.ti_ms_shift);
+  802aff:	a1 18 f0 ff ee       	mov    0xeefff018,%eax
+  802b04:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  802b07:	8b 3d 14 f0 ff ee    	mov    0xeefff014,%edi
+  802b0d:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802b10:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  802b12:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  802b18:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  802b1e:	29 f0                	sub    %esi,%eax
+  802b20:	19 fa                	sbb    %edi,%edx
+  802b22:	89 c1                	mov    %eax,%ecx
+  802b24:	89 d3                	mov    %edx,%ebx
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  802b26:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  802b29:	6b f7 00             	imul   $0x0,%edi,%esi
+  802b2c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802b2f:	89 f8                	mov    %edi,%eax
+  802b31:	f7 e1                	mul    %ecx
+  802b33:	89 c6                	mov    %eax,%esi
+  802b35:	89 d7                	mov    %edx,%edi
+  802b37:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b3a:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  802b3c:	89 d8                	mov    %ebx,%eax
+  802b3e:	f7 65 ec             	mull   -0x14(%ebp)
+	if (shift >= 32)
+  802b41:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  802b45:	77 32                	ja     802b79 <time_msec+0x83>
+	return (hi << (32 - shift)) + (lo >> shift);
+  802b47:	b9 20 00 00 00       	mov    $0x20,%ecx
+  802b4c:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  802b4f:	29 d9                	sub    %ebx,%ecx
+  802b51:	0f a5 c2             	shld   %cl,%eax,%edx
+  802b54:	d3 e0                	shl    %cl,%eax
+  802b56:	f6 c1 20             	test   $0x20,%cl
+  802b59:	74 04                	je     802b5f <time_msec+0x69>
+  802b5b:	89 c2                	mov    %eax,%edx
+  802b5d:	31 c0                	xor    %eax,%eax
+  802b5f:	89 d9                	mov    %ebx,%ecx
+  802b61:	0f ad fe             	shrd   %cl,%edi,%esi
+  802b64:	d3 ef                	shr    %cl,%edi
+  802b66:	f6 c1 20             	test   $0x20,%cl
+  802b69:	74 04                	je     802b6f <time_msec+0x79>
+  802b6b:	89 fe                	mov    %edi,%esi
+  802b6d:	31 ff                	xor    %edi,%edi
+  802b6f:	01 f0                	add    %esi,%eax
+}
+  802b71:	83 c4 14             	add    $0x14,%esp
+  802b74:	5b                   	pop    %ebx
+  802b75:	5e                   	pop    %esi
+  802b76:	5f                   	pop    %edi
+  802b77:	5d                   	pop    %ebp
+  802b78:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  802b79:	89 fe                	mov    %edi,%esi
+  802b7b:	31 ff                	xor    %edi,%edi
+  802b7d:	01 f0                	add    %esi,%eax
+  802b7f:	11 fa                	adc    %edi,%edx
+  802b81:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  802b84:	83 e9 20             	sub    $0x20,%ecx
+  802b87:	0f ad d0             	shrd   %cl,%edx,%eax
+  802b8a:	d3 ea                	shr    %cl,%edx
+  802b8c:	f6 c1 20             	test   $0x20,%cl
+  802b8f:	74 04                	je     802b95 <time_msec+0x9f>
+  802b91:	89 d0                	mov    %edx,%eax
+  802b93:	31 d2                	xor    %edx,%edx
+  802b95:	eb da                	jmp    802b71 <time_msec+0x7b>
+
+00802b97 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9c:	c3                   	ret
+
+00802b9d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802ba3:	68 1e 35 80 00       	push   $0x80351e
+  802ba8:	ff 75 0c             	push   0xc(%ebp)
+  802bab:	e8 b0 de ff ff       	call   800a60 <strcpy>
+	return 0;
+}
+  802bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb5:	c9                   	leave
+  802bb6:	c3                   	ret
+
+00802bb7 <devcons_write>:
+{
+  802bb7:	55                   	push   %ebp
+  802bb8:	89 e5                	mov    %esp,%ebp
+  802bba:	57                   	push   %edi
+  802bbb:	56                   	push   %esi
+  802bbc:	53                   	push   %ebx
+  802bbd:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802bc3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802bc8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802bce:	eb 2e                	jmp    802bfe <devcons_write+0x47>
+		m = n - tot;
+  802bd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bd3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802bd5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802bda:	39 c3                	cmp    %eax,%ebx
+  802bdc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802bdf:	83 ec 04             	sub    $0x4,%esp
+  802be2:	53                   	push   %ebx
+  802be3:	89 f0                	mov    %esi,%eax
+  802be5:	03 45 0c             	add    0xc(%ebp),%eax
+  802be8:	50                   	push   %eax
+  802be9:	57                   	push   %edi
+  802bea:	e8 f7 df ff ff       	call   800be6 <memmove>
+		sys_cputs(buf, m);
+  802bef:	83 c4 08             	add    $0x8,%esp
+  802bf2:	53                   	push   %ebx
+  802bf3:	57                   	push   %edi
+  802bf4:	e8 e0 e1 ff ff       	call   800dd9 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802bf9:	01 de                	add    %ebx,%esi
+  802bfb:	83 c4 10             	add    $0x10,%esp
+  802bfe:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c01:	72 cd                	jb     802bd0 <devcons_write+0x19>
+}
+  802c03:	89 f0                	mov    %esi,%eax
+  802c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c08:	5b                   	pop    %ebx
+  802c09:	5e                   	pop    %esi
+  802c0a:	5f                   	pop    %edi
+  802c0b:	5d                   	pop    %ebp
+  802c0c:	c3                   	ret
+
+00802c0d <devcons_read>:
+{
+  802c0d:	55                   	push   %ebp
+  802c0e:	89 e5                	mov    %esp,%ebp
+  802c10:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c18:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c1c:	75 07                	jne    802c25 <devcons_read+0x18>
+  802c1e:	eb 1f                	jmp    802c3f <devcons_read+0x32>
+		sys_yield();
+  802c20:	e8 ed e2 ff ff       	call   800f12 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802c25:	e8 f3 e1 ff ff       	call   800e1d <sys_cgetc>
+  802c2a:	85 c0                	test   %eax,%eax
+  802c2c:	74 f2                	je     802c20 <devcons_read+0x13>
+	if (c < 0)
+  802c2e:	78 0f                	js     802c3f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802c30:	83 f8 04             	cmp    $0x4,%eax
+  802c33:	74 0c                	je     802c41 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802c35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c38:	88 02                	mov    %al,(%edx)
+	return 1;
+  802c3a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c3f:	c9                   	leave
+  802c40:	c3                   	ret
+		return 0;
+  802c41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c46:	eb f7                	jmp    802c3f <devcons_read+0x32>
+
+00802c48 <cputchar>:
+{
+  802c48:	55                   	push   %ebp
+  802c49:	89 e5                	mov    %esp,%ebp
+  802c4b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c51:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802c54:	6a 01                	push   $0x1
+  802c56:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c59:	50                   	push   %eax
+  802c5a:	e8 7a e1 ff ff       	call   800dd9 <sys_cputs>
+}
+  802c5f:	83 c4 10             	add    $0x10,%esp
+  802c62:	c9                   	leave
+  802c63:	c3                   	ret
+
+00802c64 <getchar>:
+{
+  802c64:	55                   	push   %ebp
+  802c65:	89 e5                	mov    %esp,%ebp
+  802c67:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802c6a:	6a 01                	push   $0x1
+  802c6c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c6f:	50                   	push   %eax
+  802c70:	6a 00                	push   $0x0
+  802c72:	e8 5a f0 ff ff       	call   801cd1 <read>
+	if (r < 0)
+  802c77:	83 c4 10             	add    $0x10,%esp
+  802c7a:	85 c0                	test   %eax,%eax
+  802c7c:	78 06                	js     802c84 <getchar+0x20>
+	if (r < 1)
+  802c7e:	74 06                	je     802c86 <getchar+0x22>
+	return c;
+  802c80:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c84:	c9                   	leave
+  802c85:	c3                   	ret
+		return -E_EOF;
+  802c86:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c8b:	eb f7                	jmp    802c84 <getchar+0x20>
+
+00802c8d <iscons>:
+{
+  802c8d:	55                   	push   %ebp
+  802c8e:	89 e5                	mov    %esp,%ebp
+  802c90:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c96:	50                   	push   %eax
+  802c97:	ff 75 08             	push   0x8(%ebp)
+  802c9a:	e8 ac ed ff ff       	call   801a4b <fd_lookup>
+  802c9f:	83 c4 10             	add    $0x10,%esp
+  802ca2:	85 c0                	test   %eax,%eax
+  802ca4:	78 11                	js     802cb7 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802ca6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ca9:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802caf:	39 10                	cmp    %edx,(%eax)
+  802cb1:	0f 94 c0             	sete   %al
+  802cb4:	0f b6 c0             	movzbl %al,%eax
+}
+  802cb7:	c9                   	leave
+  802cb8:	c3                   	ret
+
+00802cb9 <opencons>:
+{
+  802cb9:	55                   	push   %ebp
+  802cba:	89 e5                	mov    %esp,%ebp
+  802cbc:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802cbf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cc2:	50                   	push   %eax
+  802cc3:	e8 2d ed ff ff       	call   8019f5 <fd_alloc>
+  802cc8:	83 c4 10             	add    $0x10,%esp
+  802ccb:	85 c0                	test   %eax,%eax
+  802ccd:	78 3a                	js     802d09 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ccf:	83 ec 04             	sub    $0x4,%esp
+  802cd2:	68 07 04 00 00       	push   $0x407
+  802cd7:	ff 75 f4             	push   -0xc(%ebp)
+  802cda:	6a 00                	push   $0x0
+  802cdc:	e8 77 e2 ff ff       	call   800f58 <sys_page_alloc>
+  802ce1:	83 c4 10             	add    $0x10,%esp
+  802ce4:	85 c0                	test   %eax,%eax
+  802ce6:	78 21                	js     802d09 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802ce8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ceb:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802cf1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802cf3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cf6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802cfd:	83 ec 0c             	sub    $0xc,%esp
+  802d00:	50                   	push   %eax
+  802d01:	e8 c8 ec ff ff       	call   8019ce <fd2num>
+  802d06:	83 c4 10             	add    $0x10,%esp
+}
+  802d09:	c9                   	leave
+  802d0a:	c3                   	ret
+
+00802d0b <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802d0b:	55                   	push   %ebp
+  802d0c:	89 e5                	mov    %esp,%ebp
+  802d0e:	56                   	push   %esi
+  802d0f:	53                   	push   %ebx
+  802d10:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802d19:	85 c0                	test   %eax,%eax
+  802d1b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802d20:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802d23:	83 ec 08             	sub    $0x8,%esp
+  802d26:	ff 75 14             	push   0x14(%ebp)
+  802d29:	50                   	push   %eax
+  802d2a:	e8 3a e6 ff ff       	call   801369 <sys_ipc_recv_until>
+  802d2f:	83 c4 10             	add    $0x10,%esp
+  802d32:	85 c0                	test   %eax,%eax
+  802d34:	78 61                	js     802d97 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802d36:	85 f6                	test   %esi,%esi
+  802d38:	74 1c                	je     802d56 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  802d3a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d3c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d41:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d47:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d4c:	76 5f                	jbe    802dad <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802d4e:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802d54:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802d56:	85 db                	test   %ebx,%ebx
+  802d58:	74 1c                	je     802d76 <ipc_recv_until+0x6b>
+  802d5a:	89 e0                	mov    %esp,%eax
+  802d5c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d61:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d67:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d6c:	76 50                	jbe    802dbe <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802d6e:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802d74:	89 03                	mov    %eax,(%ebx)
+  802d76:	89 e0                	mov    %esp,%eax
+  802d78:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d7d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d83:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d88:	76 45                	jbe    802dcf <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802d8a:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d93:	5b                   	pop    %ebx
+  802d94:	5e                   	pop    %esi
+  802d95:	5d                   	pop    %ebp
+  802d96:	c3                   	ret
+		if (from_env_store)
+  802d97:	85 f6                	test   %esi,%esi
+  802d99:	74 06                	je     802da1 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802d9b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802da1:	85 db                	test   %ebx,%ebx
+  802da3:	74 eb                	je     802d90 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802da5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802dab:	eb e3                	jmp    802d90 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802dad:	c1 e8 10             	shr    $0x10,%eax
+  802db0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802db6:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802dbc:	eb 90                	jmp    802d4e <ipc_recv_until+0x43>
+  802dbe:	c1 e8 10             	shr    $0x10,%eax
+  802dc1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802dc7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802dcd:	eb 9f                	jmp    802d6e <ipc_recv_until+0x63>
+  802dcf:	c1 e8 10             	shr    $0x10,%eax
+  802dd2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802dd8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802dde:	eb aa                	jmp    802d8a <ipc_recv_until+0x7f>
+
+00802de0 <ipc_recv>:
+{
+  802de0:	55                   	push   %ebp
+  802de1:	89 e5                	mov    %esp,%ebp
+  802de3:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802de6:	6a 00                	push   $0x0
+  802de8:	ff 75 10             	push   0x10(%ebp)
+  802deb:	ff 75 0c             	push   0xc(%ebp)
+  802dee:	ff 75 08             	push   0x8(%ebp)
+  802df1:	e8 15 ff ff ff       	call   802d0b <ipc_recv_until>
+}
+  802df6:	c9                   	leave
+  802df7:	c3                   	ret
+
+00802df8 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802df8:	55                   	push   %ebp
+  802df9:	89 e5                	mov    %esp,%ebp
+  802dfb:	57                   	push   %edi
+  802dfc:	56                   	push   %esi
+  802dfd:	53                   	push   %ebx
+  802dfe:	83 ec 0c             	sub    $0xc,%esp
+  802e01:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e04:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802e07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802e0a:	85 db                	test   %ebx,%ebx
+  802e0c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e11:	0f 44 d8             	cmove  %eax,%ebx
+  802e14:	eb 05                	jmp    802e1b <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802e16:	e8 f7 e0 ff ff       	call   800f12 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802e1b:	ff 75 14             	push   0x14(%ebp)
+  802e1e:	53                   	push   %ebx
+  802e1f:	56                   	push   %esi
+  802e20:	57                   	push   %edi
+  802e21:	e8 8f e4 ff ff       	call   8012b5 <sys_ipc_try_send>
+  802e26:	83 c4 10             	add    $0x10,%esp
+  802e29:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e2c:	74 e8                	je     802e16 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802e2e:	85 c0                	test   %eax,%eax
+  802e30:	78 08                	js     802e3a <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e35:	5b                   	pop    %ebx
+  802e36:	5e                   	pop    %esi
+  802e37:	5f                   	pop    %edi
+  802e38:	5d                   	pop    %ebp
+  802e39:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802e3a:	50                   	push   %eax
+  802e3b:	68 2a 35 80 00       	push   $0x80352a
+  802e40:	6a 4f                	push   $0x4f
+  802e42:	68 3d 35 80 00       	push   $0x80353d
+  802e47:	e8 f1 d4 ff ff       	call   80033d <_panic>
+
+00802e4c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e4c:	55                   	push   %ebp
+  802e4d:	89 e5                	mov    %esp,%ebp
+  802e4f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802e52:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802e57:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802e5d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802e63:	8b 52 50             	mov    0x50(%edx),%edx
+  802e66:	39 ca                	cmp    %ecx,%edx
+  802e68:	74 11                	je     802e7b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802e6a:	83 c0 01             	add    $0x1,%eax
+  802e6d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802e72:	75 e3                	jne    802e57 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e79:	eb 0e                	jmp    802e89 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802e7b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e81:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e86:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e89:	5d                   	pop    %ebp
+  802e8a:	c3                   	ret
+
+00802e8b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e8b:	55                   	push   %ebp
+  802e8c:	89 e5                	mov    %esp,%ebp
+  802e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e91:	89 c2                	mov    %eax,%edx
+  802e93:	c1 ea 16             	shr    $0x16,%edx
+  802e96:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802e9d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802ea2:	f6 c1 01             	test   $0x1,%cl
+  802ea5:	74 1a                	je     802ec1 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802ea7:	c1 e8 0c             	shr    $0xc,%eax
+  802eaa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802eb1:	a8 01                	test   $0x1,%al
+  802eb3:	74 0c                	je     802ec1 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802eb5:	c1 e8 0c             	shr    $0xc,%eax
+  802eb8:	c1 e0 04             	shl    $0x4,%eax
+  802ebb:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802ec1:	89 d0                	mov    %edx,%eax
+  802ec3:	5d                   	pop    %ebp
+  802ec4:	c3                   	ret
@@ -0,0 +1,7441 @@
+
+obj/user/testlargepage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1e 04 00 00       	call   80044f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define VA2	((char *) 0x20400000)
+#define PERM	(PTE_P | PTE_U | PTE_W)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 08             	sub    $0x8,%esp
+	envid_t child;
+	int r;
+
+	if ((r = sys_page_alloc(0, VA + PGSIZE, PERM | PTE_PS)) != -E_INVAL)
+  80003a:	68 87 00 00 00       	push   $0x87
+  80003f:	68 00 10 00 20       	push   $0x20001000
+  800044:	6a 00                	push   $0x0
+  800046:	e8 e3 10 00 00       	call   80112e <sys_page_alloc>
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800051:	0f 85 49 02 00 00    	jne    8002a0 <umain+0x26d>
+		panic("sys_page_alloc at an unaligned va: %e", r);
+
+	// A 4MB page replaces the 4KB pages in its way.
+	if ((r = sys_page_alloc(0, VA + PGSIZE, PERM)) < 0)
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	6a 07                	push   $0x7
+  80005c:	68 00 10 00 20       	push   $0x20001000
+  800061:	6a 00                	push   $0x0
+  800063:	e8 c6 10 00 00       	call   80112e <sys_page_alloc>
+  800068:	83 c4 10             	add    $0x10,%esp
+  80006b:	85 c0                	test   %eax,%eax
+  80006d:	0f 88 3f 02 00 00    	js     8002b2 <umain+0x27f>
+		panic("sys_page_alloc: %e", r);
+	VA[PGSIZE] = 1;
+  800073:	c6 05 00 10 00 20 01 	movb   $0x1,0x20001000
+	if ((r = sys_page_alloc(0, VA, PERM | PTE_PS)) < 0)
+  80007a:	83 ec 04             	sub    $0x4,%esp
+  80007d:	68 87 00 00 00       	push   $0x87
+  800082:	68 00 00 00 20       	push   $0x20000000
+  800087:	6a 00                	push   $0x0
+  800089:	e8 a0 10 00 00       	call   80112e <sys_page_alloc>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	85 c0                	test   %eax,%eax
+  800093:	0f 88 2b 02 00 00    	js     8002c4 <umain+0x291>
+		panic("sys_page_alloc: %e", r);
+	assert((uvpd[PDX(VA)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS));
+  800099:	a1 00 d2 7b ef       	mov    0xef7bd200,%eax
+  80009e:	25 81 00 00 00       	and    $0x81,%eax
+  8000a3:	3d 81 00 00 00       	cmp    $0x81,%eax
+  8000a8:	0f 85 28 02 00 00    	jne    8002d6 <umain+0x2a3>
+	assert(VA[PGSIZE] == 0 && VA[PTSIZE - 1] == 0);
+  8000ae:	80 3d 00 10 00 20 00 	cmpb   $0x0,0x20001000
+  8000b5:	0f 85 31 02 00 00    	jne    8002ec <umain+0x2b9>
+  8000bb:	80 3d ff ff 3f 20 00 	cmpb   $0x0,0x203fffff
+  8000c2:	0f 85 24 02 00 00    	jne    8002ec <umain+0x2b9>
+
+	// The kernel checks user memory across it.
+	strcpy(VA + PTSIZE - 4, "ok");
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 6c 38 80 00       	push   $0x80386c
+  8000d0:	68 fc ff 3f 20       	push   $0x203ffffc
+  8000d5:	e8 5c 0b 00 00       	call   800c36 <strcpy>
+	cprintf("largepage: kernel reads it %s\n", VA + PTSIZE - 4);
+  8000da:	83 c4 08             	add    $0x8,%esp
+  8000dd:	68 fc ff 3f 20       	push   $0x203ffffc
+  8000e2:	68 c8 37 80 00       	push   $0x8037c8
+  8000e7:	e8 02 05 00 00       	call   8005ee <cprintf>
+
+	// It can be mapped elsewhere, but only as a whole.
+	if ((r = sys_page_map(0, VA + PGSIZE, 0, VA2, PERM)) != -E_INVAL)
+  8000ec:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8000f3:	68 00 00 40 20       	push   $0x20400000
+  8000f8:	6a 00                	push   $0x0
+  8000fa:	68 00 10 00 20       	push   $0x20001000
+  8000ff:	6a 00                	push   $0x0
+  800101:	e8 95 10 00 00       	call   80119b <sys_page_map>
+  800106:	83 c4 20             	add    $0x20,%esp
+  800109:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80010c:	0f 85 f0 01 00 00    	jne    800302 <umain+0x2cf>
+		panic("sys_page_map from inside a 4MB page: %e", r);
+	if ((r = sys_page_map(0, VA, 0, VA2, PERM)) < 0)
+  800112:	83 ec 0c             	sub    $0xc,%esp
+  800115:	6a 07                	push   $0x7
+  800117:	68 00 00 40 20       	push   $0x20400000
+  80011c:	6a 00                	push   $0x0
+  80011e:	68 00 00 00 20       	push   $0x20000000
+  800123:	6a 00                	push   $0x0
+  800125:	e8 71 10 00 00       	call   80119b <sys_page_map>
+  80012a:	83 c4 20             	add    $0x20,%esp
+  80012d:	85 c0                	test   %eax,%eax
+  80012f:	0f 88 df 01 00 00    	js     800314 <umain+0x2e1>
+		panic("sys_page_map: %e", r);
+	VA2[PTSIZE / 2] = 'x';
+  800135:	c6 05 00 00 60 20 78 	movb   $0x78,0x20600000
+	assert(VA[PTSIZE / 2] == 'x');
+  80013c:	80 3d 00 00 20 20 78 	cmpb   $0x78,0x20200000
+  800143:	0f 85 dd 01 00 00    	jne    800326 <umain+0x2f3>
+	if ((r = sys_page_unmap(0, VA2)) < 0)
+  800149:	83 ec 08             	sub    $0x8,%esp
+  80014c:	68 00 00 40 20       	push   $0x20400000
+  800151:	6a 00                	push   $0x0
+  800153:	e8 b1 10 00 00       	call   801209 <sys_page_unmap>
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	0f 88 d9 01 00 00    	js     80033c <umain+0x309>
+		panic("sys_page_unmap: %e", r);
+
+	// It cannot be copy-on-write.
+	r = sys_page_map(0, VA, 0, VA2, PTE_P | PTE_U | PTE_COW);
+  800163:	83 ec 0c             	sub    $0xc,%esp
+  800166:	68 05 08 00 00       	push   $0x805
+  80016b:	68 00 00 40 20       	push   $0x20400000
+  800170:	6a 00                	push   $0x0
+  800172:	68 00 00 00 20       	push   $0x20000000
+  800177:	6a 00                	push   $0x0
+  800179:	e8 1d 10 00 00       	call   80119b <sys_page_map>
+	if (r != -E_INVAL)
+  80017e:	83 c4 20             	add    $0x20,%esp
+  800181:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800184:	0f 85 c4 01 00 00    	jne    80034e <umain+0x31b>
+		panic("sys_page_map copy-on-write: %e", r);
+
+	// fork and ufork copy it...
+	if ((child = fork()) < 0)
+  80018a:	e8 8a 1e 00 00       	call   802019 <fork>
+  80018f:	89 c3                	mov    %eax,%ebx
+  800191:	85 c0                	test   %eax,%eax
+  800193:	0f 88 c7 01 00 00    	js     800360 <umain+0x32d>
+		panic("fork: %e", child);
+	if (child == 0) {
+  800199:	75 19                	jne    8001b4 <umain+0x181>
+		assert(VA[PTSIZE / 2] == 'x');
+  80019b:	80 3d 00 00 20 20 78 	cmpb   $0x78,0x20200000
+  8001a2:	0f 85 ca 01 00 00    	jne    800372 <umain+0x33f>
+		VA[PTSIZE / 2] = 'y';
+  8001a8:	c6 05 00 00 20 20 79 	movb   $0x79,0x20200000
+		exit();
+  8001af:	e8 45 03 00 00       	call   8004f9 <exit>
+	}
+	wait(child);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	53                   	push   %ebx
+  8001b8:	e8 74 31 00 00       	call   803331 <wait>
+	assert(VA[PTSIZE / 2] == 'x');
+  8001bd:	83 c4 10             	add    $0x10,%esp
+  8001c0:	80 3d 00 00 20 20 78 	cmpb   $0x78,0x20200000
+  8001c7:	0f 85 bb 01 00 00    	jne    800388 <umain+0x355>
+	if ((child = ufork()) < 0)
+  8001cd:	e8 49 1b 00 00       	call   801d1b <ufork>
+  8001d2:	89 c3                	mov    %eax,%ebx
+  8001d4:	85 c0                	test   %eax,%eax
+  8001d6:	0f 88 c2 01 00 00    	js     80039e <umain+0x36b>
+		panic("ufork: %e", child);
+	if (child == 0) {
+  8001dc:	75 19                	jne    8001f7 <umain+0x1c4>
+		assert(VA[PTSIZE / 2] == 'x');
+  8001de:	80 3d 00 00 20 20 78 	cmpb   $0x78,0x20200000
+  8001e5:	0f 85 c5 01 00 00    	jne    8003b0 <umain+0x37d>
+		VA[PTSIZE / 2] = 'y';
+  8001eb:	c6 05 00 00 20 20 79 	movb   $0x79,0x20200000
+		exit();
+  8001f2:	e8 02 03 00 00       	call   8004f9 <exit>
+	}
+	wait(child);
+  8001f7:	83 ec 0c             	sub    $0xc,%esp
+  8001fa:	53                   	push   %ebx
+  8001fb:	e8 31 31 00 00       	call   803331 <wait>
+	assert(VA[PTSIZE / 2] == 'x');
+  800200:	83 c4 10             	add    $0x10,%esp
+  800203:	80 3d 00 00 20 20 78 	cmpb   $0x78,0x20200000
+  80020a:	0f 85 b6 01 00 00    	jne    8003c6 <umain+0x393>
+
+	// ... unless it is PTE_SHARE.
+	if ((r = sys_page_map(0, VA, 0, VA, PERM | PTE_SHARE)) < 0)
+  800210:	83 ec 0c             	sub    $0xc,%esp
+  800213:	68 07 04 00 00       	push   $0x407
+  800218:	68 00 00 00 20       	push   $0x20000000
+  80021d:	6a 00                	push   $0x0
+  80021f:	68 00 00 00 20       	push   $0x20000000
+  800224:	6a 00                	push   $0x0
+  800226:	e8 70 0f 00 00       	call   80119b <sys_page_map>
+  80022b:	83 c4 20             	add    $0x20,%esp
+  80022e:	85 c0                	test   %eax,%eax
+  800230:	0f 88 a6 01 00 00    	js     8003dc <umain+0x3a9>
+		panic("sys_page_map: %e", r);
+	if ((child = fork()) < 0)
+  800236:	e8 de 1d 00 00       	call   802019 <fork>
+  80023b:	89 c3                	mov    %eax,%ebx
+  80023d:	85 c0                	test   %eax,%eax
+  80023f:	0f 88 a9 01 00 00    	js     8003ee <umain+0x3bb>
+		panic("fork: %e", child);
+	if (child == 0) {
+  800245:	0f 84 b5 01 00 00    	je     800400 <umain+0x3cd>
+		VA[PTSIZE / 2] = 'y';
+		exit();
+	}
+	wait(child);
+  80024b:	83 ec 0c             	sub    $0xc,%esp
+  80024e:	53                   	push   %ebx
+  80024f:	e8 dd 30 00 00       	call   803331 <wait>
+	assert(VA[PTSIZE / 2] == 'y');
+  800254:	83 c4 10             	add    $0x10,%esp
+  800257:	80 3d 00 00 20 20 79 	cmpb   $0x79,0x20200000
+  80025e:	0f 85 ad 01 00 00    	jne    800411 <umain+0x3de>
+
+	// Unmapping any of it unmaps all of it.
+	if ((r = sys_page_unmap(0, VA + PTSIZE / 2)) < 0)
+  800264:	83 ec 08             	sub    $0x8,%esp
+  800267:	68 00 00 20 20       	push   $0x20200000
+  80026c:	6a 00                	push   $0x0
+  80026e:	e8 96 0f 00 00       	call   801209 <sys_page_unmap>
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	85 c0                	test   %eax,%eax
+  800278:	0f 88 a9 01 00 00    	js     800427 <umain+0x3f4>
+		panic("sys_page_unmap: %e", r);
+	assert(!(uvpd[PDX(VA)] & PTE_P));
+  80027e:	a1 00 d2 7b ef       	mov    0xef7bd200,%eax
+  800283:	a8 01                	test   $0x1,%al
+  800285:	0f 85 ae 01 00 00    	jne    800439 <umain+0x406>
+
+	cprintf("largepage: OK\n");
+  80028b:	83 ec 0c             	sub    $0xc,%esp
+  80028e:	68 e2 38 80 00       	push   $0x8038e2
+  800293:	e8 56 03 00 00       	call   8005ee <cprintf>
+}
+  800298:	83 c4 10             	add    $0x10,%esp
+  80029b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80029e:	c9                   	leave
+  80029f:	c3                   	ret
+		panic("sys_page_alloc at an unaligned va: %e", r);
+  8002a0:	50                   	push   %eax
+  8002a1:	68 40 37 80 00       	push   $0x803740
+  8002a6:	6a 10                	push   $0x10
+  8002a8:	68 2f 38 80 00       	push   $0x80382f
+  8002ad:	e8 61 02 00 00       	call   800513 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8002b2:	50                   	push   %eax
+  8002b3:	68 44 38 80 00       	push   $0x803844
+  8002b8:	6a 14                	push   $0x14
+  8002ba:	68 2f 38 80 00       	push   $0x80382f
+  8002bf:	e8 4f 02 00 00       	call   800513 <_panic>
+		panic("sys_page_alloc: %e", r);
+  8002c4:	50                   	push   %eax
+  8002c5:	68 44 38 80 00       	push   $0x803844
+  8002ca:	6a 17                	push   $0x17
+  8002cc:	68 2f 38 80 00       	push   $0x80382f
+  8002d1:	e8 3d 02 00 00       	call   800513 <_panic>
+	assert((uvpd[PDX(VA)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS));
+  8002d6:	68 68 37 80 00       	push   $0x803768
+  8002db:	68 57 38 80 00       	push   $0x803857
+  8002e0:	6a 18                	push   $0x18
+  8002e2:	68 2f 38 80 00       	push   $0x80382f
+  8002e7:	e8 27 02 00 00       	call   800513 <_panic>
+	assert(VA[PGSIZE] == 0 && VA[PTSIZE - 1] == 0);
+  8002ec:	68 a0 37 80 00       	push   $0x8037a0
+  8002f1:	68 57 38 80 00       	push   $0x803857
+  8002f6:	6a 19                	push   $0x19
+  8002f8:	68 2f 38 80 00       	push   $0x80382f
+  8002fd:	e8 11 02 00 00       	call   800513 <_panic>
+		panic("sys_page_map from inside a 4MB page: %e", r);
+  800302:	50                   	push   %eax
+  800303:	68 e8 37 80 00       	push   $0x8037e8
+  800308:	6a 21                	push   $0x21
+  80030a:	68 2f 38 80 00       	push   $0x80382f
+  80030f:	e8 ff 01 00 00       	call   800513 <_panic>
+		panic("sys_page_map: %e", r);
+  800314:	50                   	push   %eax
+  800315:	68 6f 38 80 00       	push   $0x80386f
+  80031a:	6a 23                	push   $0x23
+  80031c:	68 2f 38 80 00       	push   $0x80382f
+  800321:	e8 ed 01 00 00       	call   800513 <_panic>
+	assert(VA[PTSIZE / 2] == 'x');
+  800326:	68 80 38 80 00       	push   $0x803880
+  80032b:	68 57 38 80 00       	push   $0x803857
+  800330:	6a 25                	push   $0x25
+  800332:	68 2f 38 80 00       	push   $0x80382f
+  800337:	e8 d7 01 00 00       	call   800513 <_panic>
+		panic("sys_page_unmap: %e", r);
+  80033c:	50                   	push   %eax
+  80033d:	68 96 38 80 00       	push   $0x803896
+  800342:	6a 27                	push   $0x27
+  800344:	68 2f 38 80 00       	push   $0x80382f
+  800349:	e8 c5 01 00 00       	call   800513 <_panic>
+		panic("sys_page_map copy-on-write: %e", r);
+  80034e:	50                   	push   %eax
+  80034f:	68 10 38 80 00       	push   $0x803810
+  800354:	6a 2c                	push   $0x2c
+  800356:	68 2f 38 80 00       	push   $0x80382f
+  80035b:	e8 b3 01 00 00       	call   800513 <_panic>
+		panic("fork: %e", child);
+  800360:	50                   	push   %eax
+  800361:	68 5b 3d 80 00       	push   $0x803d5b
+  800366:	6a 30                	push   $0x30
+  800368:	68 2f 38 80 00       	push   $0x80382f
+  80036d:	e8 a1 01 00 00       	call   800513 <_panic>
+		assert(VA[PTSIZE / 2] == 'x');
+  800372:	68 80 38 80 00       	push   $0x803880
+  800377:	68 57 38 80 00       	push   $0x803857
+  80037c:	6a 32                	push   $0x32
+  80037e:	68 2f 38 80 00       	push   $0x80382f
+  800383:	e8 8b 01 00 00       	call   800513 <_panic>
+	assert(VA[PTSIZE / 2] == 'x');
+  800388:	68 80 38 80 00       	push   $0x803880
+  80038d:	68 57 38 80 00       	push   $0x803857
+  800392:	6a 37                	push   $0x37
+  800394:	68 2f 38 80 00       	push   $0x80382f
+  800399:	e8 75 01 00 00       	call   800513 <_panic>
+		panic("ufork: %e", child);
+  80039e:	50                   	push   %eax
+  80039f:	68 a9 38 80 00       	push   $0x8038a9
+  8003a4:	6a 39                	push   $0x39
+  8003a6:	68 2f 38 80 00       	push   $0x80382f
+  8003ab:	e8 63 01 00 00       	call   800513 <_panic>
+		assert(VA[PTSIZE / 2] == 'x');
+  8003b0:	68 80 38 80 00       	push   $0x803880
+  8003b5:	68 57 38 80 00       	push   $0x803857
+  8003ba:	6a 3b                	push   $0x3b
+  8003bc:	68 2f 38 80 00       	push   $0x80382f
+  8003c1:	e8 4d 01 00 00       	call   800513 <_panic>
+	assert(VA[PTSIZE / 2] == 'x');
+  8003c6:	68 80 38 80 00       	push   $0x803880
+  8003cb:	68 57 38 80 00       	push   $0x803857
+  8003d0:	6a 40                	push   $0x40
+  8003d2:	68 2f 38 80 00       	push   $0x80382f
+  8003d7:	e8 37 01 00 00       	call   800513 <_panic>
+		panic("sys_page_map: %e", r);
+  8003dc:	50                   	push   %eax
+  8003dd:	68 6f 38 80 00       	push   $0x80386f
+  8003e2:	6a 44                	push   $0x44
+  8003e4:	68 2f 38 80 00       	push   $0x80382f
+  8003e9:	e8 25 01 00 00       	call   800513 <_panic>
+		panic("fork: %e", child);
+  8003ee:	50                   	push   %eax
+  8003ef:	68 5b 3d 80 00       	push   $0x803d5b
+  8003f4:	6a 46                	push   $0x46
+  8003f6:	68 2f 38 80 00       	push   $0x80382f
+  8003fb:	e8 13 01 00 00       	call   800513 <_panic>
+		VA[PTSIZE / 2] = 'y';
+  800400:	c6 05 00 00 20 20 79 	movb   $0x79,0x20200000
+		exit();
+  800407:	e8 ed 00 00 00       	call   8004f9 <exit>
+  80040c:	e9 3a fe ff ff       	jmp    80024b <umain+0x218>
+	assert(VA[PTSIZE / 2] == 'y');
+  800411:	68 b3 38 80 00       	push   $0x8038b3
+  800416:	68 57 38 80 00       	push   $0x803857
+  80041b:	6a 4c                	push   $0x4c
+  80041d:	68 2f 38 80 00       	push   $0x80382f
+  800422:	e8 ec 00 00 00       	call   800513 <_panic>
+		panic("sys_page_unmap: %e", r);
+  800427:	50                   	push   %eax
+  800428:	68 96 38 80 00       	push   $0x803896
+  80042d:	6a 50                	push   $0x50
+  80042f:	68 2f 38 80 00       	push   $0x80382f
+  800434:	e8 da 00 00 00       	call   800513 <_panic>
+	assert(!(uvpd[PDX(VA)] & PTE_P));
+  800439:	68 c9 38 80 00       	push   $0x8038c9
+  80043e:	68 57 38 80 00       	push   $0x803857
+  800443:	6a 51                	push   $0x51
+  800445:	68 2f 38 80 00       	push   $0x80382f
+  80044a:	e8 c4 00 00 00       	call   800513 <_panic>
+
+0080044f <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80044f:	55                   	push   %ebp
+  800450:	89 e5                	mov    %esp,%ebp
+  800452:	57                   	push   %edi
+  800453:	56                   	push   %esi
+  800454:	53                   	push   %ebx
+  800455:	83 ec 0c             	sub    $0xc,%esp
+  800458:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80045b:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80045e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800463:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800465:	c1 ea 0b             	shr    $0xb,%edx
+  800468:	83 f2 01             	xor    $0x1,%edx
+  80046b:	83 e2 01             	and    $0x1,%edx
+  80046e:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800474:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80047b:	00 00 00 
+	envid = sys_getenvid();
+  80047e:	e8 1f 0c 00 00       	call   8010a2 <sys_getenvid>
+  800483:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800485:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80048a:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800490:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800496:	8b 52 48             	mov    0x48(%edx),%edx
+  800499:	39 ca                	cmp    %ecx,%edx
+  80049b:	74 27                	je     8004c4 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80049d:	83 c0 01             	add    $0x1,%eax
+  8004a0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8004a5:	75 e3                	jne    80048a <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8004a7:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8004ae:	75 24                	jne    8004d4 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8004b0:	83 ec 04             	sub    $0x4,%esp
+  8004b3:	68 f4 38 80 00       	push   $0x8038f4
+  8004b8:	6a 23                	push   $0x23
+  8004ba:	68 17 39 80 00       	push   $0x803917
+  8004bf:	e8 4f 00 00 00       	call   800513 <_panic>
+			mainenv = &envs[i];
+  8004c4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8004ca:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004cf:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004d4:	85 ff                	test   %edi,%edi
+  8004d6:	7e 07                	jle    8004df <libmain+0x90>
+		binaryname = argv[0];
+  8004d8:	8b 06                	mov    (%esi),%eax
+  8004da:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8004df:	83 ec 08             	sub    $0x8,%esp
+  8004e2:	56                   	push   %esi
+  8004e3:	57                   	push   %edi
+  8004e4:	e8 4a fb ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8004e9:	e8 0b 00 00 00       	call   8004f9 <exit>
+}
+  8004ee:	83 c4 10             	add    $0x10,%esp
+  8004f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f4:	5b                   	pop    %ebx
+  8004f5:	5e                   	pop    %esi
+  8004f6:	5f                   	pop    %edi
+  8004f7:	5d                   	pop    %ebp
+  8004f8:	c3                   	ret
+
+008004f9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8004ff:	e8 9c 1f 00 00       	call   8024a0 <close_all>
+	sys_env_destroy(0);
+  800504:	83 ec 0c             	sub    $0xc,%esp
+  800507:	6a 00                	push   $0x0
+  800509:	e8 2b 0b 00 00       	call   801039 <sys_env_destroy>
+}
+  80050e:	83 c4 10             	add    $0x10,%esp
+  800511:	c9                   	leave
+  800512:	c3                   	ret
+
+00800513 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800513:	55                   	push   %ebp
+  800514:	89 e5                	mov    %esp,%ebp
+  800516:	56                   	push   %esi
+  800517:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800518:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80051b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800521:	e8 7c 0b 00 00       	call   8010a2 <sys_getenvid>
+  800526:	83 ec 0c             	sub    $0xc,%esp
+  800529:	ff 75 0c             	push   0xc(%ebp)
+  80052c:	ff 75 08             	push   0x8(%ebp)
+  80052f:	56                   	push   %esi
+  800530:	50                   	push   %eax
+  800531:	68 30 39 80 00       	push   $0x803930
+  800536:	e8 b3 00 00 00       	call   8005ee <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80053b:	83 c4 18             	add    $0x18,%esp
+  80053e:	53                   	push   %ebx
+  80053f:	ff 75 10             	push   0x10(%ebp)
+  800542:	e8 56 00 00 00       	call   80059d <vcprintf>
+	cprintf("\n");
+  800547:	c7 04 24 ef 38 80 00 	movl   $0x8038ef,(%esp)
+  80054e:	e8 9b 00 00 00       	call   8005ee <cprintf>
+  800553:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800556:	cc                   	int3
+	while (1)
+  800557:	eb fd                	jmp    800556 <_panic+0x43>
+
+00800559 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800559:	55                   	push   %ebp
+  80055a:	89 e5                	mov    %esp,%ebp
+  80055c:	53                   	push   %ebx
+  80055d:	83 ec 04             	sub    $0x4,%esp
+  800560:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800563:	8b 13                	mov    (%ebx),%edx
+  800565:	8d 42 01             	lea    0x1(%edx),%eax
+  800568:	89 03                	mov    %eax,(%ebx)
+  80056a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80056d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800571:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800576:	74 09                	je     800581 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800578:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80057c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80057f:	c9                   	leave
+  800580:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800581:	83 ec 08             	sub    $0x8,%esp
+  800584:	68 ff 00 00 00       	push   $0xff
+  800589:	8d 43 08             	lea    0x8(%ebx),%eax
+  80058c:	50                   	push   %eax
+  80058d:	e8 1d 0a 00 00       	call   800faf <sys_cputs>
+		b->idx = 0;
+  800592:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800598:	83 c4 10             	add    $0x10,%esp
+  80059b:	eb db                	jmp    800578 <putch+0x1f>
+
+0080059d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80059d:	55                   	push   %ebp
+  80059e:	89 e5                	mov    %esp,%ebp
+  8005a0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005a6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005ad:	00 00 00 
+	b.cnt = 0;
+  8005b0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005b7:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005ba:	ff 75 0c             	push   0xc(%ebp)
+  8005bd:	ff 75 08             	push   0x8(%ebp)
+  8005c0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005c6:	50                   	push   %eax
+  8005c7:	68 59 05 80 00       	push   $0x800559
+  8005cc:	e8 fb 00 00 00       	call   8006cc <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005d1:	83 c4 08             	add    $0x8,%esp
+  8005d4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005da:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005e0:	50                   	push   %eax
+  8005e1:	e8 c9 09 00 00       	call   800faf <sys_cputs>
+
+	return b.cnt;
+}
+  8005e6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005ec:	c9                   	leave
+  8005ed:	c3                   	ret
+
+008005ee <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005ee:	55                   	push   %ebp
+  8005ef:	89 e5                	mov    %esp,%ebp
+  8005f1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005f4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005f7:	50                   	push   %eax
+  8005f8:	ff 75 08             	push   0x8(%ebp)
+  8005fb:	e8 9d ff ff ff       	call   80059d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800600:	c9                   	leave
+  800601:	c3                   	ret
+
+00800602 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800602:	55                   	push   %ebp
+  800603:	89 e5                	mov    %esp,%ebp
+  800605:	57                   	push   %edi
+  800606:	56                   	push   %esi
+  800607:	53                   	push   %ebx
+  800608:	83 ec 1c             	sub    $0x1c,%esp
+  80060b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80060e:	89 d6                	mov    %edx,%esi
+  800610:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800613:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800616:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800619:	73 0b                	jae    800626 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80061b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80061e:	c1 e7 08             	shl    $0x8,%edi
+  800621:	0b 7d 10             	or     0x10(%ebp),%edi
+  800624:	eb 36                	jmp    80065c <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800626:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800629:	ba 00 00 00 00       	mov    $0x0,%edx
+  80062e:	f7 75 08             	divl   0x8(%ebp)
+  800631:	89 c1                	mov    %eax,%ecx
+  800633:	ff 75 14             	push   0x14(%ebp)
+  800636:	ff 75 10             	push   0x10(%ebp)
+  800639:	83 eb 01             	sub    $0x1,%ebx
+  80063c:	53                   	push   %ebx
+  80063d:	ff 75 08             	push   0x8(%ebp)
+  800640:	89 f2                	mov    %esi,%edx
+  800642:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800645:	e8 b8 ff ff ff       	call   800602 <printnum>
+  80064a:	83 c4 10             	add    $0x10,%esp
+  80064d:	eb 14                	jmp    800663 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80064f:	83 ec 08             	sub    $0x8,%esp
+  800652:	56                   	push   %esi
+  800653:	57                   	push   %edi
+  800654:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800657:	ff d0                	call   *%eax
+  800659:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80065c:	83 eb 01             	sub    $0x1,%ebx
+  80065f:	85 db                	test   %ebx,%ebx
+  800661:	7f ec                	jg     80064f <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800663:	83 ec 08             	sub    $0x8,%esp
+  800666:	56                   	push   %esi
+  800667:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80066a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80066f:	f7 75 08             	divl   0x8(%ebp)
+  800672:	0f be 92 53 39 80 00 	movsbl 0x803953(%edx),%edx
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	c1 e0 08             	shl    $0x8,%eax
+  80067f:	09 d0                	or     %edx,%eax
+  800681:	50                   	push   %eax
+  800682:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800685:	ff d0                	call   *%eax
+}
+  800687:	83 c4 10             	add    $0x10,%esp
+  80068a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80068d:	5b                   	pop    %ebx
+  80068e:	5e                   	pop    %esi
+  80068f:	5f                   	pop    %edi
+  800690:	5d                   	pop    %ebp
+  800691:	c3                   	ret
+
+00800692 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800692:	55                   	push   %ebp
+  800693:	89 e5                	mov    %esp,%ebp
+  800695:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800698:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80069c:	8b 10                	mov    (%eax),%edx
+  80069e:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006a1:	73 0a                	jae    8006ad <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006a3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006a6:	89 08                	mov    %ecx,(%eax)
+  8006a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ab:	88 02                	mov    %al,(%edx)
+}
+  8006ad:	5d                   	pop    %ebp
+  8006ae:	c3                   	ret
+
+008006af <printfmt>:
+{
+  8006af:	55                   	push   %ebp
+  8006b0:	89 e5                	mov    %esp,%ebp
+  8006b2:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006b5:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006b8:	50                   	push   %eax
+  8006b9:	ff 75 10             	push   0x10(%ebp)
+  8006bc:	ff 75 0c             	push   0xc(%ebp)
+  8006bf:	ff 75 08             	push   0x8(%ebp)
+  8006c2:	e8 05 00 00 00       	call   8006cc <vprintfmt>
+}
+  8006c7:	83 c4 10             	add    $0x10,%esp
+  8006ca:	c9                   	leave
+  8006cb:	c3                   	ret
+
+008006cc <vprintfmt>:
+{
+  8006cc:	55                   	push   %ebp
+  8006cd:	89 e5                	mov    %esp,%ebp
+  8006cf:	57                   	push   %edi
+  8006d0:	56                   	push   %esi
+  8006d1:	53                   	push   %ebx
+  8006d2:	83 ec 3c             	sub    $0x3c,%esp
+  8006d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006d8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8006db:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8006e2:	eb 16                	jmp    8006fa <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	ff 75 0c             	push   0xc(%ebp)
+  8006ea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8006ed:	c1 e2 08             	shl    $0x8,%edx
+  8006f0:	09 d0                	or     %edx,%eax
+  8006f2:	50                   	push   %eax
+  8006f3:	ff d7                	call   *%edi
+  8006f5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006f8:	89 de                	mov    %ebx,%esi
+  8006fa:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8006fd:	0f b6 06             	movzbl (%esi),%eax
+  800700:	83 f8 25             	cmp    $0x25,%eax
+  800703:	74 0c                	je     800711 <vprintfmt+0x45>
+			if (ch == '\0')
+  800705:	85 c0                	test   %eax,%eax
+  800707:	75 db                	jne    8006e4 <vprintfmt+0x18>
+}
+  800709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80070c:	5b                   	pop    %ebx
+  80070d:	5e                   	pop    %esi
+  80070e:	5f                   	pop    %edi
+  80070f:	5d                   	pop    %ebp
+  800710:	c3                   	ret
+		padc = ' ';
+  800711:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800715:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80071c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800723:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80072a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80072f:	8d 73 01             	lea    0x1(%ebx),%esi
+  800732:	0f b6 13             	movzbl (%ebx),%edx
+  800735:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800738:	3c 55                	cmp    $0x55,%al
+  80073a:	0f 87 2c 04 00 00    	ja     800b6c <vprintfmt+0x4a0>
+  800740:	0f b6 c0             	movzbl %al,%eax
+  800743:	ff 24 85 a0 3a 80 00 	jmp    *0x803aa0(,%eax,4)
+  80074a:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80074c:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800750:	eb dd                	jmp    80072f <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800752:	89 f3                	mov    %esi,%ebx
+  800754:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800758:	eb d5                	jmp    80072f <vprintfmt+0x63>
+  80075a:	0f b6 d2             	movzbl %dl,%edx
+  80075d:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80075f:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800764:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800767:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80076b:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80076e:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800771:	83 fe 09             	cmp    $0x9,%esi
+  800774:	0f 87 8a 00 00 00    	ja     800804 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80077a:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80077d:	eb e5                	jmp    800764 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80077f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800782:	8b 00                	mov    (%eax),%eax
+  800784:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800787:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078a:	8d 40 04             	lea    0x4(%eax),%eax
+  80078d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800790:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800792:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800796:	79 97                	jns    80072f <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800798:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80079b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80079e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007a5:	eb 88                	jmp    80072f <vprintfmt+0x63>
+			if (width < 0)
+  8007a7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8007aa:	85 db                	test   %ebx,%ebx
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	0f 49 c3             	cmovns %ebx,%eax
+  8007b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007b7:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8007b9:	e9 71 ff ff ff       	jmp    80072f <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007be:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8007c0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007c7:	e9 63 ff ff ff       	jmp    80072f <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8007cc:	8d 73 02             	lea    0x2(%ebx),%esi
+  8007cf:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8007d3:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8007da:	3c 67                	cmp    $0x67,%al
+  8007dc:	0f 84 18 ff ff ff    	je     8006fa <vprintfmt+0x2e>
+					attrib = 0x04;
+  8007e2:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8007e9:	3c 72                	cmp    $0x72,%al
+  8007eb:	0f 84 09 ff ff ff    	je     8006fa <vprintfmt+0x2e>
+					attrib = 0x00;
+  8007f1:	3c 62                	cmp    $0x62,%al
+  8007f3:	0f 94 c0             	sete   %al
+  8007f6:	0f b6 c0             	movzbl %al,%eax
+  8007f9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8007fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007ff:	e9 f6 fe ff ff       	jmp    8006fa <vprintfmt+0x2e>
+  800804:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800807:	eb 89                	jmp    800792 <vprintfmt+0xc6>
+			lflag++;
+  800809:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80080c:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80080e:	e9 1c ff ff ff       	jmp    80072f <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800813:	8b 45 14             	mov    0x14(%ebp),%eax
+  800816:	8d 58 04             	lea    0x4(%eax),%ebx
+  800819:	83 ec 08             	sub    $0x8,%esp
+  80081c:	ff 75 0c             	push   0xc(%ebp)
+  80081f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800822:	c1 e0 08             	shl    $0x8,%eax
+  800825:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800828:	0b 01                	or     (%ecx),%eax
+  80082a:	50                   	push   %eax
+  80082b:	ff d7                	call   *%edi
+			break;
+  80082d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800830:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800833:	e9 c2 fe ff ff       	jmp    8006fa <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80083e:	8b 10                	mov    (%eax),%edx
+  800840:	89 d0                	mov    %edx,%eax
+  800842:	f7 d8                	neg    %eax
+  800844:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800847:	83 f8 12             	cmp    $0x12,%eax
+  80084a:	7f 25                	jg     800871 <vprintfmt+0x1a5>
+  80084c:	8b 14 85 00 3c 80 00 	mov    0x803c00(,%eax,4),%edx
+  800853:	85 d2                	test   %edx,%edx
+  800855:	74 1a                	je     800871 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800857:	52                   	push   %edx
+  800858:	68 69 38 80 00       	push   $0x803869
+  80085d:	ff 75 0c             	push   0xc(%ebp)
+  800860:	57                   	push   %edi
+  800861:	e8 49 fe ff ff       	call   8006af <printfmt>
+  800866:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800869:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80086c:	e9 89 fe ff ff       	jmp    8006fa <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800871:	50                   	push   %eax
+  800872:	68 6b 39 80 00       	push   $0x80396b
+  800877:	ff 75 0c             	push   0xc(%ebp)
+  80087a:	57                   	push   %edi
+  80087b:	e8 2f fe ff ff       	call   8006af <printfmt>
+  800880:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800883:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800886:	e9 6f fe ff ff       	jmp    8006fa <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80088b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088e:	83 c0 04             	add    $0x4,%eax
+  800891:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800894:	8b 45 14             	mov    0x14(%ebp),%eax
+  800897:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800899:	85 c9                	test   %ecx,%ecx
+  80089b:	b8 64 39 80 00       	mov    $0x803964,%eax
+  8008a0:	0f 45 c1             	cmovne %ecx,%eax
+  8008a3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8008a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008aa:	7e 06                	jle    8008b2 <vprintfmt+0x1e6>
+  8008ac:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8008b0:	75 1a                	jne    8008cc <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8008b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008b5:	c1 e0 08             	shl    $0x8,%eax
+  8008b8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8008bb:	83 c8 3f             	or     $0x3f,%eax
+  8008be:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008c1:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8008c4:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008c7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8008ca:	eb 6d                	jmp    800939 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008cc:	83 ec 08             	sub    $0x8,%esp
+  8008cf:	ff 75 d0             	push   -0x30(%ebp)
+  8008d2:	ff 75 c8             	push   -0x38(%ebp)
+  8008d5:	e8 39 03 00 00       	call   800c13 <strnlen>
+  8008da:	89 c2                	mov    %eax,%edx
+  8008dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008df:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8008e1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8008e4:	c1 e1 08             	shl    $0x8,%ecx
+  8008e7:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8008eb:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008ed:	83 c4 10             	add    $0x10,%esp
+  8008f0:	89 c3                	mov    %eax,%ebx
+  8008f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008f5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008f8:	89 ce                	mov    %ecx,%esi
+  8008fa:	eb 0f                	jmp    80090b <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8008fc:	83 ec 08             	sub    $0x8,%esp
+  8008ff:	ff 75 0c             	push   0xc(%ebp)
+  800902:	56                   	push   %esi
+  800903:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800905:	83 eb 01             	sub    $0x1,%ebx
+  800908:	83 c4 10             	add    $0x10,%esp
+  80090b:	85 db                	test   %ebx,%ebx
+  80090d:	7f ed                	jg     8008fc <vprintfmt+0x230>
+  80090f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800912:	8b 75 10             	mov    0x10(%ebp),%esi
+  800915:	85 c0                	test   %eax,%eax
+  800917:	ba 00 00 00 00       	mov    $0x0,%edx
+  80091c:	0f 49 d0             	cmovns %eax,%edx
+  80091f:	29 d0                	sub    %edx,%eax
+  800921:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800924:	eb 8c                	jmp    8008b2 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800926:	83 ec 08             	sub    $0x8,%esp
+  800929:	ff 75 0c             	push   0xc(%ebp)
+  80092c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80092f:	09 c2                	or     %eax,%edx
+  800931:	52                   	push   %edx
+  800932:	ff d7                	call   *%edi
+  800934:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800937:	89 d9                	mov    %ebx,%ecx
+  800939:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80093c:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800940:	0f be d0             	movsbl %al,%edx
+  800943:	85 d2                	test   %edx,%edx
+  800945:	74 2a                	je     800971 <vprintfmt+0x2a5>
+  800947:	85 f6                	test   %esi,%esi
+  800949:	78 05                	js     800950 <vprintfmt+0x284>
+  80094b:	83 ee 01             	sub    $0x1,%esi
+  80094e:	78 3b                	js     80098b <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800950:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800954:	74 d0                	je     800926 <vprintfmt+0x25a>
+  800956:	0f be c0             	movsbl %al,%eax
+  800959:	83 e8 20             	sub    $0x20,%eax
+  80095c:	83 f8 5e             	cmp    $0x5e,%eax
+  80095f:	76 c5                	jbe    800926 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800961:	83 ec 08             	sub    $0x8,%esp
+  800964:	ff 75 0c             	push   0xc(%ebp)
+  800967:	ff 75 cc             	push   -0x34(%ebp)
+  80096a:	ff d7                	call   *%edi
+  80096c:	83 c4 10             	add    $0x10,%esp
+  80096f:	eb c6                	jmp    800937 <vprintfmt+0x26b>
+  800971:	8b 75 10             	mov    0x10(%ebp),%esi
+  800974:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800977:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80097a:	01 c3                	add    %eax,%ebx
+  80097c:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80097e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800981:	83 c8 20             	or     $0x20,%eax
+  800984:	89 75 10             	mov    %esi,0x10(%ebp)
+  800987:	89 c6                	mov    %eax,%esi
+  800989:	eb 14                	jmp    80099f <vprintfmt+0x2d3>
+  80098b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80098e:	eb e4                	jmp    800974 <vprintfmt+0x2a8>
+  800990:	83 ec 08             	sub    $0x8,%esp
+  800993:	ff 75 0c             	push   0xc(%ebp)
+  800996:	56                   	push   %esi
+  800997:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800999:	83 eb 01             	sub    $0x1,%ebx
+  80099c:	83 c4 10             	add    $0x10,%esp
+  80099f:	85 db                	test   %ebx,%ebx
+  8009a1:	7f ed                	jg     800990 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009a3:	8b 75 10             	mov    0x10(%ebp),%esi
+  8009a6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8009a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ac:	e9 49 fd ff ff       	jmp    8006fa <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8009b1:	83 f9 01             	cmp    $0x1,%ecx
+  8009b4:	7f 1f                	jg     8009d5 <vprintfmt+0x309>
+	else if (lflag)
+  8009b6:	85 c9                	test   %ecx,%ecx
+  8009b8:	74 69                	je     800a23 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8009ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bd:	8b 00                	mov    (%eax),%eax
+  8009bf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009c2:	89 c1                	mov    %eax,%ecx
+  8009c4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009d3:	eb 17                	jmp    8009ec <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8009d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d8:	8b 50 04             	mov    0x4(%eax),%edx
+  8009db:	8b 00                	mov    (%eax),%eax
+  8009dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009e0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8009e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e6:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8009ec:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8009ef:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8009f2:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8009f7:	85 db                	test   %ebx,%ebx
+  8009f9:	0f 89 f6 00 00 00    	jns    800af5 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8009ff:	83 ec 08             	sub    $0x8,%esp
+  800a02:	ff 75 0c             	push   0xc(%ebp)
+  800a05:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a08:	c1 e0 08             	shl    $0x8,%eax
+  800a0b:	83 c8 2d             	or     $0x2d,%eax
+  800a0e:	50                   	push   %eax
+  800a0f:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800a11:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800a14:	f7 d9                	neg    %ecx
+  800a16:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800a19:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a1e:	e9 d2 00 00 00       	jmp    800af5 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800a23:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a26:	8b 00                	mov    (%eax),%eax
+  800a28:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a2b:	89 c1                	mov    %eax,%ecx
+  800a2d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a30:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a36:	8d 40 04             	lea    0x4(%eax),%eax
+  800a39:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a3c:	eb ae                	jmp    8009ec <vprintfmt+0x320>
+	if (lflag >= 2)
+  800a3e:	83 f9 01             	cmp    $0x1,%ecx
+  800a41:	7f 19                	jg     800a5c <vprintfmt+0x390>
+	else if (lflag)
+  800a43:	85 c9                	test   %ecx,%ecx
+  800a45:	74 2a                	je     800a71 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800a47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4a:	8b 08                	mov    (%eax),%ecx
+  800a4c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a4f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a52:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800a57:	e9 99 00 00 00       	jmp    800af5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a5c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5f:	8b 08                	mov    (%eax),%ecx
+  800a61:	8d 40 08             	lea    0x8(%eax),%eax
+  800a64:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a67:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800a6c:	e9 84 00 00 00       	jmp    800af5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a74:	8b 08                	mov    (%eax),%ecx
+  800a76:	8d 40 04             	lea    0x4(%eax),%eax
+  800a79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a7c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800a81:	eb 72                	jmp    800af5 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800a83:	83 f9 01             	cmp    $0x1,%ecx
+  800a86:	7f 16                	jg     800a9e <vprintfmt+0x3d2>
+	else if (lflag)
+  800a88:	85 c9                	test   %ecx,%ecx
+  800a8a:	74 24                	je     800ab0 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800a8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8f:	8b 08                	mov    (%eax),%ecx
+  800a91:	8d 40 04             	lea    0x4(%eax),%eax
+  800a94:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a97:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800a9c:	eb 57                	jmp    800af5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa1:	8b 08                	mov    (%eax),%ecx
+  800aa3:	8d 40 08             	lea    0x8(%eax),%eax
+  800aa6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800aa9:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800aae:	eb 45                	jmp    800af5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800ab0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab3:	8b 08                	mov    (%eax),%ecx
+  800ab5:	8d 40 04             	lea    0x4(%eax),%eax
+  800ab8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800abb:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800ac0:	eb 33                	jmp    800af5 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800ac2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ac5:	c1 e3 08             	shl    $0x8,%ebx
+  800ac8:	83 ec 08             	sub    $0x8,%esp
+  800acb:	ff 75 0c             	push   0xc(%ebp)
+  800ace:	89 d8                	mov    %ebx,%eax
+  800ad0:	83 c8 30             	or     $0x30,%eax
+  800ad3:	50                   	push   %eax
+  800ad4:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800ad6:	83 c4 08             	add    $0x8,%esp
+  800ad9:	ff 75 0c             	push   0xc(%ebp)
+  800adc:	83 cb 78             	or     $0x78,%ebx
+  800adf:	53                   	push   %ebx
+  800ae0:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800ae2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae5:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800ae7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800aea:	8d 40 04             	lea    0x4(%eax),%eax
+  800aed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800af0:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800af5:	ff 75 e4             	push   -0x1c(%ebp)
+  800af8:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800afc:	52                   	push   %edx
+  800afd:	ff 75 e0             	push   -0x20(%ebp)
+  800b00:	50                   	push   %eax
+  800b01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b04:	89 f8                	mov    %edi,%eax
+  800b06:	e8 f7 fa ff ff       	call   800602 <printnum>
+			break;
+  800b0b:	83 c4 10             	add    $0x10,%esp
+  800b0e:	e9 e7 fb ff ff       	jmp    8006fa <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800b13:	83 f9 01             	cmp    $0x1,%ecx
+  800b16:	7f 16                	jg     800b2e <vprintfmt+0x462>
+	else if (lflag)
+  800b18:	85 c9                	test   %ecx,%ecx
+  800b1a:	74 24                	je     800b40 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800b1c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1f:	8b 08                	mov    (%eax),%ecx
+  800b21:	8d 40 04             	lea    0x4(%eax),%eax
+  800b24:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b27:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800b2c:	eb c7                	jmp    800af5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800b2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b31:	8b 08                	mov    (%eax),%ecx
+  800b33:	8d 40 08             	lea    0x8(%eax),%eax
+  800b36:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b39:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800b3e:	eb b5                	jmp    800af5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800b40:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b43:	8b 08                	mov    (%eax),%ecx
+  800b45:	8d 40 04             	lea    0x4(%eax),%eax
+  800b48:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b4b:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800b50:	eb a3                	jmp    800af5 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800b52:	83 ec 08             	sub    $0x8,%esp
+  800b55:	ff 75 0c             	push   0xc(%ebp)
+  800b58:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b5b:	c1 e0 08             	shl    $0x8,%eax
+  800b5e:	83 c8 25             	or     $0x25,%eax
+  800b61:	50                   	push   %eax
+  800b62:	ff d7                	call   *%edi
+			break;
+  800b64:	83 c4 10             	add    $0x10,%esp
+  800b67:	e9 8e fb ff ff       	jmp    8006fa <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800b6c:	83 ec 08             	sub    $0x8,%esp
+  800b6f:	ff 75 0c             	push   0xc(%ebp)
+  800b72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b75:	c1 e0 08             	shl    $0x8,%eax
+  800b78:	83 c8 25             	or     $0x25,%eax
+  800b7b:	50                   	push   %eax
+  800b7c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b7e:	83 c4 10             	add    $0x10,%esp
+  800b81:	89 de                	mov    %ebx,%esi
+  800b83:	eb 03                	jmp    800b88 <vprintfmt+0x4bc>
+  800b85:	83 ee 01             	sub    $0x1,%esi
+  800b88:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800b8c:	75 f7                	jne    800b85 <vprintfmt+0x4b9>
+  800b8e:	e9 67 fb ff ff       	jmp    8006fa <vprintfmt+0x2e>
+
+00800b93 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	83 ec 18             	sub    $0x18,%esp
+  800b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b9f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ba2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ba6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ba9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800bb0:	85 c0                	test   %eax,%eax
+  800bb2:	74 26                	je     800bda <vsnprintf+0x47>
+  800bb4:	85 d2                	test   %edx,%edx
+  800bb6:	7e 22                	jle    800bda <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800bb8:	ff 75 14             	push   0x14(%ebp)
+  800bbb:	ff 75 10             	push   0x10(%ebp)
+  800bbe:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800bc1:	50                   	push   %eax
+  800bc2:	68 92 06 80 00       	push   $0x800692
+  800bc7:	e8 00 fb ff ff       	call   8006cc <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800bcc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800bcf:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800bd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bd5:	83 c4 10             	add    $0x10,%esp
+}
+  800bd8:	c9                   	leave
+  800bd9:	c3                   	ret
+		return -E_INVAL;
+  800bda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bdf:	eb f7                	jmp    800bd8 <vsnprintf+0x45>
+
+00800be1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800be1:	55                   	push   %ebp
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800be7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800bea:	50                   	push   %eax
+  800beb:	ff 75 10             	push   0x10(%ebp)
+  800bee:	ff 75 0c             	push   0xc(%ebp)
+  800bf1:	ff 75 08             	push   0x8(%ebp)
+  800bf4:	e8 9a ff ff ff       	call   800b93 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800bf9:	c9                   	leave
+  800bfa:	c3                   	ret
+
+00800bfb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bfb:	55                   	push   %ebp
+  800bfc:	89 e5                	mov    %esp,%ebp
+  800bfe:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c06:	eb 03                	jmp    800c0b <strlen+0x10>
+		n++;
+  800c08:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800c0b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c0f:	75 f7                	jne    800c08 <strlen+0xd>
+	return n;
+}
+  800c11:	5d                   	pop    %ebp
+  800c12:	c3                   	ret
+
+00800c13 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800c13:	55                   	push   %ebp
+  800c14:	89 e5                	mov    %esp,%ebp
+  800c16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c19:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c21:	eb 03                	jmp    800c26 <strnlen+0x13>
+		n++;
+  800c23:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c26:	39 d0                	cmp    %edx,%eax
+  800c28:	74 08                	je     800c32 <strnlen+0x1f>
+  800c2a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c2e:	75 f3                	jne    800c23 <strnlen+0x10>
+  800c30:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800c32:	89 d0                	mov    %edx,%eax
+  800c34:	5d                   	pop    %ebp
+  800c35:	c3                   	ret
+
+00800c36 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	53                   	push   %ebx
+  800c3a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c3d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c45:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c49:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c4c:	83 c0 01             	add    $0x1,%eax
+  800c4f:	84 d2                	test   %dl,%dl
+  800c51:	75 f2                	jne    800c45 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c53:	89 c8                	mov    %ecx,%eax
+  800c55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c58:	c9                   	leave
+  800c59:	c3                   	ret
+
+00800c5a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c5a:	55                   	push   %ebp
+  800c5b:	89 e5                	mov    %esp,%ebp
+  800c5d:	53                   	push   %ebx
+  800c5e:	83 ec 10             	sub    $0x10,%esp
+  800c61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c64:	53                   	push   %ebx
+  800c65:	e8 91 ff ff ff       	call   800bfb <strlen>
+  800c6a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c6d:	ff 75 0c             	push   0xc(%ebp)
+  800c70:	01 d8                	add    %ebx,%eax
+  800c72:	50                   	push   %eax
+  800c73:	e8 be ff ff ff       	call   800c36 <strcpy>
+	return dst;
+}
+  800c78:	89 d8                	mov    %ebx,%eax
+  800c7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c7d:	c9                   	leave
+  800c7e:	c3                   	ret
+
+00800c7f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  800c84:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c87:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c8a:	89 f3                	mov    %esi,%ebx
+  800c8c:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c8f:	89 f0                	mov    %esi,%eax
+  800c91:	eb 0f                	jmp    800ca2 <strncpy+0x23>
+		*dst++ = *src;
+  800c93:	83 c0 01             	add    $0x1,%eax
+  800c96:	0f b6 0a             	movzbl (%edx),%ecx
+  800c99:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c9c:	80 f9 01             	cmp    $0x1,%cl
+  800c9f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ca2:	39 d8                	cmp    %ebx,%eax
+  800ca4:	75 ed                	jne    800c93 <strncpy+0x14>
+	}
+	return ret;
+}
+  800ca6:	89 f0                	mov    %esi,%eax
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	56                   	push   %esi
+  800cb0:	53                   	push   %ebx
+  800cb1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb7:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800cba:	89 f0                	mov    %esi,%eax
+  800cbc:	85 d2                	test   %edx,%edx
+  800cbe:	74 21                	je     800ce1 <strlcpy+0x35>
+  800cc0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800cc4:	89 f2                	mov    %esi,%edx
+  800cc6:	eb 09                	jmp    800cd1 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800cc8:	83 c1 01             	add    $0x1,%ecx
+  800ccb:	83 c2 01             	add    $0x1,%edx
+  800cce:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800cd1:	39 c2                	cmp    %eax,%edx
+  800cd3:	74 09                	je     800cde <strlcpy+0x32>
+  800cd5:	0f b6 19             	movzbl (%ecx),%ebx
+  800cd8:	84 db                	test   %bl,%bl
+  800cda:	75 ec                	jne    800cc8 <strlcpy+0x1c>
+  800cdc:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800cde:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ce1:	29 f0                	sub    %esi,%eax
+}
+  800ce3:	5b                   	pop    %ebx
+  800ce4:	5e                   	pop    %esi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+
+00800ce7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ced:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800cf0:	eb 06                	jmp    800cf8 <strcmp+0x11>
+		p++, q++;
+  800cf2:	83 c1 01             	add    $0x1,%ecx
+  800cf5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800cf8:	0f b6 01             	movzbl (%ecx),%eax
+  800cfb:	84 c0                	test   %al,%al
+  800cfd:	74 04                	je     800d03 <strcmp+0x1c>
+  800cff:	3a 02                	cmp    (%edx),%al
+  800d01:	74 ef                	je     800cf2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d03:	0f b6 c0             	movzbl %al,%eax
+  800d06:	0f b6 12             	movzbl (%edx),%edx
+  800d09:	29 d0                	sub    %edx,%eax
+}
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	53                   	push   %ebx
+  800d11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d17:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800d1a:	eb 09                	jmp    800d25 <strncmp+0x18>
+		n--, p++, q++;
+  800d1c:	83 ea 01             	sub    $0x1,%edx
+  800d1f:	83 c0 01             	add    $0x1,%eax
+  800d22:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800d25:	85 d2                	test   %edx,%edx
+  800d27:	74 18                	je     800d41 <strncmp+0x34>
+  800d29:	0f b6 18             	movzbl (%eax),%ebx
+  800d2c:	84 db                	test   %bl,%bl
+  800d2e:	74 04                	je     800d34 <strncmp+0x27>
+  800d30:	3a 19                	cmp    (%ecx),%bl
+  800d32:	74 e8                	je     800d1c <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d34:	0f b6 00             	movzbl (%eax),%eax
+  800d37:	0f b6 11             	movzbl (%ecx),%edx
+  800d3a:	29 d0                	sub    %edx,%eax
+}
+  800d3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3f:	c9                   	leave
+  800d40:	c3                   	ret
+		return 0;
+  800d41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d46:	eb f4                	jmp    800d3c <strncmp+0x2f>
+
+00800d48 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d52:	eb 03                	jmp    800d57 <strchr+0xf>
+  800d54:	83 c0 01             	add    $0x1,%eax
+  800d57:	0f b6 10             	movzbl (%eax),%edx
+  800d5a:	84 d2                	test   %dl,%dl
+  800d5c:	74 06                	je     800d64 <strchr+0x1c>
+		if (*s == c)
+  800d5e:	38 ca                	cmp    %cl,%dl
+  800d60:	75 f2                	jne    800d54 <strchr+0xc>
+  800d62:	eb 05                	jmp    800d69 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d69:	5d                   	pop    %ebp
+  800d6a:	c3                   	ret
+
+00800d6b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d71:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d75:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d78:	38 ca                	cmp    %cl,%dl
+  800d7a:	74 09                	je     800d85 <strfind+0x1a>
+  800d7c:	84 d2                	test   %dl,%dl
+  800d7e:	74 05                	je     800d85 <strfind+0x1a>
+	for (; *s; s++)
+  800d80:	83 c0 01             	add    $0x1,%eax
+  800d83:	eb f0                	jmp    800d75 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+
+00800d87 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d8e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d91:	85 c9                	test   %ecx,%ecx
+  800d93:	74 20                	je     800db5 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d95:	89 f8                	mov    %edi,%eax
+  800d97:	09 c8                	or     %ecx,%eax
+  800d99:	a8 03                	test   $0x3,%al
+  800d9b:	75 12                	jne    800daf <memset+0x28>
+		c &= 0xFF;
+  800d9d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800da1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800da7:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800daa:	fc                   	cld
+  800dab:	f3 ab                	rep stos %eax,%es:(%edi)
+  800dad:	eb 06                	jmp    800db5 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800daf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800db2:	fc                   	cld
+  800db3:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800db5:	89 f8                	mov    %edi,%eax
+  800db7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800dba:	c9                   	leave
+  800dbb:	c3                   	ret
+
+00800dbc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	57                   	push   %edi
+  800dc0:	56                   	push   %esi
+  800dc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800dc7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800dca:	39 c6                	cmp    %eax,%esi
+  800dcc:	73 32                	jae    800e00 <memmove+0x44>
+  800dce:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800dd1:	39 d0                	cmp    %edx,%eax
+  800dd3:	73 2b                	jae    800e00 <memmove+0x44>
+		s += n;
+		d += n;
+  800dd5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dd8:	89 d6                	mov    %edx,%esi
+  800dda:	09 fe                	or     %edi,%esi
+  800ddc:	09 ce                	or     %ecx,%esi
+  800dde:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800de4:	75 0e                	jne    800df4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800de6:	83 ef 04             	sub    $0x4,%edi
+  800de9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800dec:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800def:	fd                   	std
+  800df0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800df2:	eb 09                	jmp    800dfd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800df4:	83 ef 01             	sub    $0x1,%edi
+  800df7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800dfa:	fd                   	std
+  800dfb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800dfd:	fc                   	cld
+  800dfe:	eb 1a                	jmp    800e1a <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e00:	89 f2                	mov    %esi,%edx
+  800e02:	09 c2                	or     %eax,%edx
+  800e04:	09 ca                	or     %ecx,%edx
+  800e06:	f6 c2 03             	test   $0x3,%dl
+  800e09:	75 0a                	jne    800e15 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e0b:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e0e:	89 c7                	mov    %eax,%edi
+  800e10:	fc                   	cld
+  800e11:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e13:	eb 05                	jmp    800e1a <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e15:	89 c7                	mov    %eax,%edi
+  800e17:	fc                   	cld
+  800e18:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+
+00800e1e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800e24:	ff 75 10             	push   0x10(%ebp)
+  800e27:	ff 75 0c             	push   0xc(%ebp)
+  800e2a:	ff 75 08             	push   0x8(%ebp)
+  800e2d:	e8 8a ff ff ff       	call   800dbc <memmove>
+}
+  800e32:	c9                   	leave
+  800e33:	c3                   	ret
+
+00800e34 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e34:	55                   	push   %ebp
+  800e35:	89 e5                	mov    %esp,%ebp
+  800e37:	56                   	push   %esi
+  800e38:	53                   	push   %ebx
+  800e39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e3f:	89 c6                	mov    %eax,%esi
+  800e41:	03 75 10             	add    0x10(%ebp),%esi
+  800e44:	eb 06                	jmp    800e4c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e46:	83 c0 01             	add    $0x1,%eax
+  800e49:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e4c:	39 f0                	cmp    %esi,%eax
+  800e4e:	74 14                	je     800e64 <memcmp+0x30>
+		if (*s1 != *s2)
+  800e50:	0f b6 08             	movzbl (%eax),%ecx
+  800e53:	0f b6 1a             	movzbl (%edx),%ebx
+  800e56:	38 d9                	cmp    %bl,%cl
+  800e58:	74 ec                	je     800e46 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800e5a:	0f b6 c1             	movzbl %cl,%eax
+  800e5d:	0f b6 db             	movzbl %bl,%ebx
+  800e60:	29 d8                	sub    %ebx,%eax
+  800e62:	eb 05                	jmp    800e69 <memcmp+0x35>
+	}
+
+	return 0;
+  800e64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e69:	5b                   	pop    %ebx
+  800e6a:	5e                   	pop    %esi
+  800e6b:	5d                   	pop    %ebp
+  800e6c:	c3                   	ret
+
+00800e6d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e6d:	55                   	push   %ebp
+  800e6e:	89 e5                	mov    %esp,%ebp
+  800e70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e76:	89 c2                	mov    %eax,%edx
+  800e78:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e7b:	eb 03                	jmp    800e80 <memfind+0x13>
+  800e7d:	83 c0 01             	add    $0x1,%eax
+  800e80:	39 d0                	cmp    %edx,%eax
+  800e82:	73 04                	jae    800e88 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e84:	38 08                	cmp    %cl,(%eax)
+  800e86:	75 f5                	jne    800e7d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+
+00800e8a <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	53                   	push   %ebx
+  800e90:	83 ec 1c             	sub    $0x1c,%esp
+  800e93:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e96:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e99:	eb 03                	jmp    800e9e <strtol+0x14>
+		s++;
+  800e9b:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800e9e:	0f b6 06             	movzbl (%esi),%eax
+  800ea1:	3c 20                	cmp    $0x20,%al
+  800ea3:	74 f6                	je     800e9b <strtol+0x11>
+  800ea5:	3c 09                	cmp    $0x9,%al
+  800ea7:	74 f2                	je     800e9b <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ea9:	3c 2b                	cmp    $0x2b,%al
+  800eab:	74 43                	je     800ef0 <strtol+0x66>
+	int neg = 0;
+  800ead:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800eb2:	3c 2d                	cmp    $0x2d,%al
+  800eb4:	74 44                	je     800efa <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eb6:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ebc:	75 0f                	jne    800ecd <strtol+0x43>
+  800ebe:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ec1:	74 41                	je     800f04 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ec3:	85 ff                	test   %edi,%edi
+  800ec5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eca:	0f 44 f8             	cmove  %eax,%edi
+  800ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed2:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800ed7:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800eda:	89 fb                	mov    %edi,%ebx
+  800edc:	c1 fb 1f             	sar    $0x1f,%ebx
+  800edf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800ee2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ee5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800ee8:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800eeb:	89 75 08             	mov    %esi,0x8(%ebp)
+  800eee:	eb 67                	jmp    800f57 <strtol+0xcd>
+		s++;
+  800ef0:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800ef3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef8:	eb bc                	jmp    800eb6 <strtol+0x2c>
+		s++, neg = 1;
+  800efa:	83 c6 01             	add    $0x1,%esi
+  800efd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f02:	eb b2                	jmp    800eb6 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f04:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800f08:	74 0e                	je     800f18 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800f0a:	85 ff                	test   %edi,%edi
+  800f0c:	75 bf                	jne    800ecd <strtol+0x43>
+		s++, base = 8;
+  800f0e:	83 c6 01             	add    $0x1,%esi
+  800f11:	bf 08 00 00 00       	mov    $0x8,%edi
+  800f16:	eb b5                	jmp    800ecd <strtol+0x43>
+		s += 2, base = 16;
+  800f18:	83 c6 02             	add    $0x2,%esi
+  800f1b:	bf 10 00 00 00       	mov    $0x10,%edi
+  800f20:	eb ab                	jmp    800ecd <strtol+0x43>
+			dig = *s - '0';
+  800f22:	0f be c9             	movsbl %cl,%ecx
+  800f25:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800f28:	39 f9                	cmp    %edi,%ecx
+  800f2a:	7d 59                	jge    800f85 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800f2c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800f30:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800f33:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f36:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800f39:	0f af d8             	imul   %eax,%ebx
+  800f3c:	0f af d7             	imul   %edi,%edx
+  800f3f:	01 d3                	add    %edx,%ebx
+  800f41:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f44:	f7 e7                	mul    %edi
+  800f46:	01 da                	add    %ebx,%edx
+  800f48:	89 cb                	mov    %ecx,%ebx
+  800f4a:	c1 fb 1f             	sar    $0x1f,%ebx
+  800f4d:	01 c8                	add    %ecx,%eax
+  800f4f:	11 da                	adc    %ebx,%edx
+  800f51:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800f54:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800f57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f5a:	0f b6 08             	movzbl (%eax),%ecx
+  800f5d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800f60:	80 fb 09             	cmp    $0x9,%bl
+  800f63:	76 bd                	jbe    800f22 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800f65:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800f68:	80 fb 19             	cmp    $0x19,%bl
+  800f6b:	77 08                	ja     800f75 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800f6d:	0f be c9             	movsbl %cl,%ecx
+  800f70:	83 e9 57             	sub    $0x57,%ecx
+  800f73:	eb b3                	jmp    800f28 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f75:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800f78:	80 fb 19             	cmp    $0x19,%bl
+  800f7b:	77 08                	ja     800f85 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800f7d:	0f be c9             	movsbl %cl,%ecx
+  800f80:	83 e9 37             	sub    $0x37,%ecx
+  800f83:	eb a3                	jmp    800f28 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f85:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800f88:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f8b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800f8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f91:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f95:	74 05                	je     800f9c <strtol+0x112>
+		*endptr = (char *) s;
+  800f97:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800f9a:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800f9c:	85 c9                	test   %ecx,%ecx
+  800f9e:	74 07                	je     800fa7 <strtol+0x11d>
+  800fa0:	f7 d8                	neg    %eax
+  800fa2:	83 d2 00             	adc    $0x0,%edx
+  800fa5:	f7 da                	neg    %edx
+}
+  800fa7:	83 c4 1c             	add    $0x1c,%esp
+  800faa:	5b                   	pop    %ebx
+  800fab:	5e                   	pop    %esi
+  800fac:	5f                   	pop    %edi
+  800fad:	5d                   	pop    %ebp
+  800fae:	c3                   	ret
+
+00800faf <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800faf:	55                   	push   %ebp
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	57                   	push   %edi
+  800fb3:	56                   	push   %esi
+  800fb4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fb5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fbc:	74 18                	je     800fd6 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc9:	89 c3                	mov    %eax,%ebx
+  800fcb:	89 c7                	mov    %eax,%edi
+  800fcd:	89 c6                	mov    %eax,%esi
+  800fcf:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800fd1:	5b                   	pop    %ebx
+  800fd2:	5e                   	pop    %esi
+  800fd3:	5f                   	pop    %edi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe1:	89 c3                	mov    %eax,%ebx
+  800fe3:	89 c7                	mov    %eax,%edi
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	8d 35 f0 0f 80 00    	lea    0x800ff0,%esi
+  800fee:	0f 34                	sysenter
+  800ff0:	5d                   	pop    %ebp
+		goto out;
+  800ff1:	eb de                	jmp    800fd1 <sys_cputs+0x22>
+
+00800ff3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ff9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801000:	74 19                	je     80101b <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  801002:	ba 00 00 00 00       	mov    $0x0,%edx
+  801007:	b8 01 00 00 00       	mov    $0x1,%eax
+  80100c:	89 d1                	mov    %edx,%ecx
+  80100e:	89 d3                	mov    %edx,%ebx
+  801010:	89 d7                	mov    %edx,%edi
+  801012:	89 d6                	mov    %edx,%esi
+  801014:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801016:	5b                   	pop    %ebx
+  801017:	5e                   	pop    %esi
+  801018:	5f                   	pop    %edi
+  801019:	5d                   	pop    %ebp
+  80101a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80101b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801020:	b8 01 00 00 00       	mov    $0x1,%eax
+  801025:	89 d1                	mov    %edx,%ecx
+  801027:	89 d3                	mov    %edx,%ebx
+  801029:	89 d7                	mov    %edx,%edi
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	8d 35 36 10 80 00    	lea    0x801036,%esi
+  801034:	0f 34                	sysenter
+  801036:	5d                   	pop    %ebp
+		goto out;
+  801037:	eb dd                	jmp    801016 <sys_cgetc+0x23>
+
+00801039 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	57                   	push   %edi
+  80103d:	56                   	push   %esi
+  80103e:	53                   	push   %ebx
+  80103f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801042:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801049:	74 21                	je     80106c <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  80104b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801050:	b8 03 00 00 00       	mov    $0x3,%eax
+  801055:	8b 55 08             	mov    0x8(%ebp),%edx
+  801058:	89 cb                	mov    %ecx,%ebx
+  80105a:	89 cf                	mov    %ecx,%edi
+  80105c:	89 ce                	mov    %ecx,%esi
+  80105e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801060:	85 c0                	test   %eax,%eax
+  801062:	7f 27                	jg     80108b <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801064:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801067:	5b                   	pop    %ebx
+  801068:	5e                   	pop    %esi
+  801069:	5f                   	pop    %edi
+  80106a:	5d                   	pop    %ebp
+  80106b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801074:	b8 03 00 00 00       	mov    $0x3,%eax
+  801079:	89 cb                	mov    %ecx,%ebx
+  80107b:	89 cf                	mov    %ecx,%edi
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	8d 35 88 10 80 00    	lea    0x801088,%esi
+  801086:	0f 34                	sysenter
+  801088:	5d                   	pop    %ebp
+		goto out;
+  801089:	eb d5                	jmp    801060 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108b:	83 ec 0c             	sub    $0xc,%esp
+  80108e:	50                   	push   %eax
+  80108f:	6a 03                	push   $0x3
+  801091:	68 6b 3c 80 00       	push   $0x803c6b
+  801096:	6a 3f                	push   $0x3f
+  801098:	68 88 3c 80 00       	push   $0x803c88
+  80109d:	e8 71 f4 ff ff       	call   800513 <_panic>
+
+008010a2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	57                   	push   %edi
+  8010a6:	56                   	push   %esi
+  8010a7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010a8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010af:	74 19                	je     8010ca <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  8010b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010bb:	89 d1                	mov    %edx,%ecx
+  8010bd:	89 d3                	mov    %edx,%ebx
+  8010bf:	89 d7                	mov    %edx,%edi
+  8010c1:	89 d6                	mov    %edx,%esi
+  8010c3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8010c5:	5b                   	pop    %ebx
+  8010c6:	5e                   	pop    %esi
+  8010c7:	5f                   	pop    %edi
+  8010c8:	5d                   	pop    %ebp
+  8010c9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cf:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010d4:	89 d1                	mov    %edx,%ecx
+  8010d6:	89 d3                	mov    %edx,%ebx
+  8010d8:	89 d7                	mov    %edx,%edi
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	8d 35 e5 10 80 00    	lea    0x8010e5,%esi
+  8010e3:	0f 34                	sysenter
+  8010e5:	5d                   	pop    %ebp
+		goto out;
+  8010e6:	eb dd                	jmp    8010c5 <sys_getenvid+0x23>
+
+008010e8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	57                   	push   %edi
+  8010ec:	56                   	push   %esi
+  8010ed:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010ee:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010f5:	74 19                	je     801110 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  8010f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801101:	89 d1                	mov    %edx,%ecx
+  801103:	89 d3                	mov    %edx,%ebx
+  801105:	89 d7                	mov    %edx,%edi
+  801107:	89 d6                	mov    %edx,%esi
+  801109:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80110b:	5b                   	pop    %ebx
+  80110c:	5e                   	pop    %esi
+  80110d:	5f                   	pop    %edi
+  80110e:	5d                   	pop    %ebp
+  80110f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801110:	ba 00 00 00 00       	mov    $0x0,%edx
+  801115:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80111a:	89 d1                	mov    %edx,%ecx
+  80111c:	89 d3                	mov    %edx,%ebx
+  80111e:	89 d7                	mov    %edx,%edi
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	8d 35 2b 11 80 00    	lea    0x80112b,%esi
+  801129:	0f 34                	sysenter
+  80112b:	5d                   	pop    %ebp
+		goto out;
+  80112c:	eb dd                	jmp    80110b <sys_yield+0x23>
+
+0080112e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	56                   	push   %esi
+  801133:	53                   	push   %ebx
+  801134:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801137:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80113e:	74 23                	je     801163 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  801140:	be 00 00 00 00       	mov    $0x0,%esi
+  801145:	b8 04 00 00 00       	mov    $0x4,%eax
+  80114a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801150:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801153:	89 f7                	mov    %esi,%edi
+  801155:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801157:	85 c0                	test   %eax,%eax
+  801159:	7f 29                	jg     801184 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80115b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115e:	5b                   	pop    %ebx
+  80115f:	5e                   	pop    %esi
+  801160:	5f                   	pop    %edi
+  801161:	5d                   	pop    %ebp
+  801162:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801163:	8b 55 08             	mov    0x8(%ebp),%edx
+  801166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801169:	b8 04 00 00 00       	mov    $0x4,%eax
+  80116e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801173:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	8d 35 81 11 80 00    	lea    0x801181,%esi
+  80117f:	0f 34                	sysenter
+  801181:	5d                   	pop    %ebp
+		goto out;
+  801182:	eb d3                	jmp    801157 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801184:	83 ec 0c             	sub    $0xc,%esp
+  801187:	50                   	push   %eax
+  801188:	6a 04                	push   $0x4
+  80118a:	68 6b 3c 80 00       	push   $0x803c6b
+  80118f:	6a 3f                	push   $0x3f
+  801191:	68 88 3c 80 00       	push   $0x803c88
+  801196:	e8 78 f3 ff ff       	call   800513 <_panic>
+
+0080119b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+  8011a4:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  8011a7:	85 f6                	test   %esi,%esi
+  8011a9:	75 09                	jne    8011b4 <sys_page_map+0x19>
+  8011ab:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011b2:	74 1f                	je     8011d3 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  8011b4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c7:	85 c0                	test   %eax,%eax
+  8011c9:	7f 27                	jg     8011f2 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8011cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ce:	5b                   	pop    %ebx
+  8011cf:	5e                   	pop    %esi
+  8011d0:	5f                   	pop    %edi
+  8011d1:	5d                   	pop    %ebp
+  8011d2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	8d 35 ef 11 80 00    	lea    0x8011ef,%esi
+  8011ed:	0f 34                	sysenter
+  8011ef:	5d                   	pop    %ebp
+		goto out;
+  8011f0:	eb d5                	jmp    8011c7 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f2:	83 ec 0c             	sub    $0xc,%esp
+  8011f5:	50                   	push   %eax
+  8011f6:	6a 05                	push   $0x5
+  8011f8:	68 6b 3c 80 00       	push   $0x803c6b
+  8011fd:	6a 3f                	push   $0x3f
+  8011ff:	68 88 3c 80 00       	push   $0x803c88
+  801204:	e8 0a f3 ff ff       	call   800513 <_panic>
+
+00801209 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801209:	55                   	push   %ebp
+  80120a:	89 e5                	mov    %esp,%ebp
+  80120c:	57                   	push   %edi
+  80120d:	56                   	push   %esi
+  80120e:	53                   	push   %ebx
+  80120f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801212:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801219:	74 22                	je     80123d <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  80121b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801220:	b8 06 00 00 00       	mov    $0x6,%eax
+  801225:	8b 55 08             	mov    0x8(%ebp),%edx
+  801228:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122b:	89 df                	mov    %ebx,%edi
+  80122d:	89 de                	mov    %ebx,%esi
+  80122f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801231:	85 c0                	test   %eax,%eax
+  801233:	7f 28                	jg     80125d <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801238:	5b                   	pop    %ebx
+  801239:	5e                   	pop    %esi
+  80123a:	5f                   	pop    %edi
+  80123b:	5d                   	pop    %ebp
+  80123c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80123d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801242:	8b 55 08             	mov    0x8(%ebp),%edx
+  801245:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801248:	b8 06 00 00 00       	mov    $0x6,%eax
+  80124d:	89 df                	mov    %ebx,%edi
+  80124f:	55                   	push   %ebp
+  801250:	89 e5                	mov    %esp,%ebp
+  801252:	8d 35 5a 12 80 00    	lea    0x80125a,%esi
+  801258:	0f 34                	sysenter
+  80125a:	5d                   	pop    %ebp
+		goto out;
+  80125b:	eb d4                	jmp    801231 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125d:	83 ec 0c             	sub    $0xc,%esp
+  801260:	50                   	push   %eax
+  801261:	6a 06                	push   $0x6
+  801263:	68 6b 3c 80 00       	push   $0x803c6b
+  801268:	6a 3f                	push   $0x3f
+  80126a:	68 88 3c 80 00       	push   $0x803c88
+  80126f:	e8 9f f2 ff ff       	call   800513 <_panic>
+
+00801274 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801274:	55                   	push   %ebp
+  801275:	89 e5                	mov    %esp,%ebp
+  801277:	57                   	push   %edi
+  801278:	56                   	push   %esi
+  801279:	53                   	push   %ebx
+  80127a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80127d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801284:	74 22                	je     8012a8 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801286:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801290:	8b 55 08             	mov    0x8(%ebp),%edx
+  801293:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801296:	89 df                	mov    %ebx,%edi
+  801298:	89 de                	mov    %ebx,%esi
+  80129a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80129c:	85 c0                	test   %eax,%eax
+  80129e:	7f 28                	jg     8012c8 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8012a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a3:	5b                   	pop    %ebx
+  8012a4:	5e                   	pop    %esi
+  8012a5:	5f                   	pop    %edi
+  8012a6:	5d                   	pop    %ebp
+  8012a7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012b8:	89 df                	mov    %ebx,%edi
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	8d 35 c5 12 80 00    	lea    0x8012c5,%esi
+  8012c3:	0f 34                	sysenter
+  8012c5:	5d                   	pop    %ebp
+		goto out;
+  8012c6:	eb d4                	jmp    80129c <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	50                   	push   %eax
+  8012cc:	6a 08                	push   $0x8
+  8012ce:	68 6b 3c 80 00       	push   $0x803c6b
+  8012d3:	6a 3f                	push   $0x3f
+  8012d5:	68 88 3c 80 00       	push   $0x803c88
+  8012da:	e8 34 f2 ff ff       	call   800513 <_panic>
+
+008012df <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	57                   	push   %edi
+  8012e3:	56                   	push   %esi
+  8012e4:	53                   	push   %ebx
+  8012e5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012e8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012ef:	74 22                	je     801313 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  8012f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801301:	89 df                	mov    %ebx,%edi
+  801303:	89 de                	mov    %ebx,%esi
+  801305:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801307:	85 c0                	test   %eax,%eax
+  801309:	7f 28                	jg     801333 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80130b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80130e:	5b                   	pop    %ebx
+  80130f:	5e                   	pop    %esi
+  801310:	5f                   	pop    %edi
+  801311:	5d                   	pop    %ebp
+  801312:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801313:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801318:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801323:	89 df                	mov    %ebx,%edi
+  801325:	55                   	push   %ebp
+  801326:	89 e5                	mov    %esp,%ebp
+  801328:	8d 35 30 13 80 00    	lea    0x801330,%esi
+  80132e:	0f 34                	sysenter
+  801330:	5d                   	pop    %ebp
+		goto out;
+  801331:	eb d4                	jmp    801307 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801333:	83 ec 0c             	sub    $0xc,%esp
+  801336:	50                   	push   %eax
+  801337:	6a 09                	push   $0x9
+  801339:	68 6b 3c 80 00       	push   $0x803c6b
+  80133e:	6a 3f                	push   $0x3f
+  801340:	68 88 3c 80 00       	push   $0x803c88
+  801345:	e8 c9 f1 ff ff       	call   800513 <_panic>
+
+0080134a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80134a:	55                   	push   %ebp
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	57                   	push   %edi
+  80134e:	56                   	push   %esi
+  80134f:	53                   	push   %ebx
+  801350:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801353:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80135a:	74 22                	je     80137e <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80135c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801361:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801366:	8b 55 08             	mov    0x8(%ebp),%edx
+  801369:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136c:	89 df                	mov    %ebx,%edi
+  80136e:	89 de                	mov    %ebx,%esi
+  801370:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801372:	85 c0                	test   %eax,%eax
+  801374:	7f 28                	jg     80139e <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801376:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801379:	5b                   	pop    %ebx
+  80137a:	5e                   	pop    %esi
+  80137b:	5f                   	pop    %edi
+  80137c:	5d                   	pop    %ebp
+  80137d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80137e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801383:	8b 55 08             	mov    0x8(%ebp),%edx
+  801386:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801389:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80138e:	89 df                	mov    %ebx,%edi
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	8d 35 9b 13 80 00    	lea    0x80139b,%esi
+  801399:	0f 34                	sysenter
+  80139b:	5d                   	pop    %ebp
+		goto out;
+  80139c:	eb d4                	jmp    801372 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80139e:	83 ec 0c             	sub    $0xc,%esp
+  8013a1:	50                   	push   %eax
+  8013a2:	6a 0a                	push   $0xa
+  8013a4:	68 6b 3c 80 00       	push   $0x803c6b
+  8013a9:	6a 3f                	push   $0x3f
+  8013ab:	68 88 3c 80 00       	push   $0x803c88
+  8013b0:	e8 5e f1 ff ff       	call   800513 <_panic>
+
+008013b5 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	57                   	push   %edi
+  8013b9:	56                   	push   %esi
+  8013ba:	53                   	push   %ebx
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013be:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013c5:	74 22                	je     8013e9 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8013c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013cc:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d7:	89 df                	mov    %ebx,%edi
+  8013d9:	89 de                	mov    %ebx,%esi
+  8013db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013dd:	85 c0                	test   %eax,%eax
+  8013df:	7f 28                	jg     801409 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8013e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e4:	5b                   	pop    %ebx
+  8013e5:	5e                   	pop    %esi
+  8013e6:	5f                   	pop    %edi
+  8013e7:	5d                   	pop    %ebp
+  8013e8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013f9:	89 df                	mov    %ebx,%edi
+  8013fb:	55                   	push   %ebp
+  8013fc:	89 e5                	mov    %esp,%ebp
+  8013fe:	8d 35 06 14 80 00    	lea    0x801406,%esi
+  801404:	0f 34                	sysenter
+  801406:	5d                   	pop    %ebp
+		goto out;
+  801407:	eb d4                	jmp    8013dd <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801409:	83 ec 0c             	sub    $0xc,%esp
+  80140c:	50                   	push   %eax
+  80140d:	6a 17                	push   $0x17
+  80140f:	68 6b 3c 80 00       	push   $0x803c6b
+  801414:	6a 3f                	push   $0x3f
+  801416:	68 88 3c 80 00       	push   $0x803c88
+  80141b:	e8 f3 f0 ff ff       	call   800513 <_panic>
+
+00801420 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	57                   	push   %edi
+  801424:	56                   	push   %esi
+  801425:	53                   	push   %ebx
+  801426:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801429:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801430:	74 22                	je     801454 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801432:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801437:	b8 18 00 00 00       	mov    $0x18,%eax
+  80143c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801442:	89 df                	mov    %ebx,%edi
+  801444:	89 de                	mov    %ebx,%esi
+  801446:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801448:	85 c0                	test   %eax,%eax
+  80144a:	7f 28                	jg     801474 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80144c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144f:	5b                   	pop    %ebx
+  801450:	5e                   	pop    %esi
+  801451:	5f                   	pop    %edi
+  801452:	5d                   	pop    %ebp
+  801453:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801454:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801459:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801464:	89 df                	mov    %ebx,%edi
+  801466:	55                   	push   %ebp
+  801467:	89 e5                	mov    %esp,%ebp
+  801469:	8d 35 71 14 80 00    	lea    0x801471,%esi
+  80146f:	0f 34                	sysenter
+  801471:	5d                   	pop    %ebp
+		goto out;
+  801472:	eb d4                	jmp    801448 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801474:	83 ec 0c             	sub    $0xc,%esp
+  801477:	50                   	push   %eax
+  801478:	6a 18                	push   $0x18
+  80147a:	68 6b 3c 80 00       	push   $0x803c6b
+  80147f:	6a 3f                	push   $0x3f
+  801481:	68 88 3c 80 00       	push   $0x803c88
+  801486:	e8 88 f0 ff ff       	call   800513 <_panic>
+
+0080148b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+  80148e:	57                   	push   %edi
+  80148f:	56                   	push   %esi
+  801490:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801491:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801498:	74 1d                	je     8014b7 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80149a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80149f:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014b0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8014b2:	5b                   	pop    %ebx
+  8014b3:	5e                   	pop    %esi
+  8014b4:	5f                   	pop    %edi
+  8014b5:	5d                   	pop    %ebp
+  8014b6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014c8:	55                   	push   %ebp
+  8014c9:	89 e5                	mov    %esp,%ebp
+  8014cb:	8d 35 d3 14 80 00    	lea    0x8014d3,%esi
+  8014d1:	0f 34                	sysenter
+  8014d3:	5d                   	pop    %ebp
+		goto out;
+  8014d4:	eb dc                	jmp    8014b2 <sys_ipc_try_send+0x27>
+
+008014d6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8014d6:	55                   	push   %ebp
+  8014d7:	89 e5                	mov    %esp,%ebp
+  8014d9:	57                   	push   %edi
+  8014da:	56                   	push   %esi
+  8014db:	53                   	push   %ebx
+  8014dc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014df:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014e6:	74 21                	je     801509 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8014e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ed:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f5:	89 cb                	mov    %ecx,%ebx
+  8014f7:	89 cf                	mov    %ecx,%edi
+  8014f9:	89 ce                	mov    %ecx,%esi
+  8014fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	7f 27                	jg     801528 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801501:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801504:	5b                   	pop    %ebx
+  801505:	5e                   	pop    %esi
+  801506:	5f                   	pop    %edi
+  801507:	5d                   	pop    %ebp
+  801508:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801509:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801511:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801516:	89 cb                	mov    %ecx,%ebx
+  801518:	89 cf                	mov    %ecx,%edi
+  80151a:	55                   	push   %ebp
+  80151b:	89 e5                	mov    %esp,%ebp
+  80151d:	8d 35 25 15 80 00    	lea    0x801525,%esi
+  801523:	0f 34                	sysenter
+  801525:	5d                   	pop    %ebp
+		goto out;
+  801526:	eb d5                	jmp    8014fd <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801528:	83 ec 0c             	sub    $0xc,%esp
+  80152b:	50                   	push   %eax
+  80152c:	6a 0d                	push   $0xd
+  80152e:	68 6b 3c 80 00       	push   $0x803c6b
+  801533:	6a 3f                	push   $0x3f
+  801535:	68 88 3c 80 00       	push   $0x803c88
+  80153a:	e8 d4 ef ff ff       	call   800513 <_panic>
+
+0080153f <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80153f:	55                   	push   %ebp
+  801540:	89 e5                	mov    %esp,%ebp
+  801542:	57                   	push   %edi
+  801543:	56                   	push   %esi
+  801544:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801545:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80154c:	74 1b                	je     801569 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80154e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801553:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801558:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155e:	89 df                	mov    %ebx,%edi
+  801560:	89 de                	mov    %ebx,%esi
+  801562:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801564:	5b                   	pop    %ebx
+  801565:	5e                   	pop    %esi
+  801566:	5f                   	pop    %edi
+  801567:	5d                   	pop    %ebp
+  801568:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801569:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801571:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801574:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801579:	89 df                	mov    %ebx,%edi
+  80157b:	55                   	push   %ebp
+  80157c:	89 e5                	mov    %esp,%ebp
+  80157e:	8d 35 86 15 80 00    	lea    0x801586,%esi
+  801584:	0f 34                	sysenter
+  801586:	5d                   	pop    %ebp
+		goto out;
+  801587:	eb db                	jmp    801564 <sys_ipc_recv_until+0x25>
+
+00801589 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801589:	55                   	push   %ebp
+  80158a:	89 e5                	mov    %esp,%ebp
+  80158c:	57                   	push   %edi
+  80158d:	56                   	push   %esi
+  80158e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80158f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801596:	74 19                	je     8015b1 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015a2:	89 d1                	mov    %edx,%ecx
+  8015a4:	89 d3                	mov    %edx,%ebx
+  8015a6:	89 d7                	mov    %edx,%edi
+  8015a8:	89 d6                	mov    %edx,%esi
+  8015aa:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8015ac:	5b                   	pop    %ebx
+  8015ad:	5e                   	pop    %esi
+  8015ae:	5f                   	pop    %edi
+  8015af:	5d                   	pop    %ebp
+  8015b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015bb:	89 d1                	mov    %edx,%ecx
+  8015bd:	89 d3                	mov    %edx,%ebx
+  8015bf:	89 d7                	mov    %edx,%edi
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	8d 35 cc 15 80 00    	lea    0x8015cc,%esi
+  8015ca:	0f 34                	sysenter
+  8015cc:	5d                   	pop    %ebp
+		goto out;
+  8015cd:	eb dd                	jmp    8015ac <sys_time_msec+0x23>
+
+008015cf <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	57                   	push   %edi
+  8015d3:	56                   	push   %esi
+  8015d4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015d5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015dc:	74 1a                	je     8015f8 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8015de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8015e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015eb:	89 cb                	mov    %ecx,%ebx
+  8015ed:	89 cf                	mov    %ecx,%edi
+  8015ef:	89 ce                	mov    %ecx,%esi
+  8015f1:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8015f3:	5b                   	pop    %ebx
+  8015f4:	5e                   	pop    %esi
+  8015f5:	5f                   	pop    %edi
+  8015f6:	5d                   	pop    %ebp
+  8015f7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801600:	b8 10 00 00 00       	mov    $0x10,%eax
+  801605:	89 cb                	mov    %ecx,%ebx
+  801607:	89 cf                	mov    %ecx,%edi
+  801609:	55                   	push   %ebp
+  80160a:	89 e5                	mov    %esp,%ebp
+  80160c:	8d 35 14 16 80 00    	lea    0x801614,%esi
+  801612:	0f 34                	sysenter
+  801614:	5d                   	pop    %ebp
+		goto out;
+  801615:	eb dc                	jmp    8015f3 <sys_sleep_until+0x24>
+
+00801617 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801617:	55                   	push   %ebp
+  801618:	89 e5                	mov    %esp,%ebp
+  80161a:	57                   	push   %edi
+  80161b:	56                   	push   %esi
+  80161c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80161d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801624:	74 1a                	je     801640 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801626:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80162b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801630:	8b 55 08             	mov    0x8(%ebp),%edx
+  801633:	89 cb                	mov    %ecx,%ebx
+  801635:	89 cf                	mov    %ecx,%edi
+  801637:	89 ce                	mov    %ecx,%esi
+  801639:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80163b:	5b                   	pop    %ebx
+  80163c:	5e                   	pop    %esi
+  80163d:	5f                   	pop    %edi
+  80163e:	5d                   	pop    %ebp
+  80163f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801640:	8b 55 08             	mov    0x8(%ebp),%edx
+  801643:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801648:	b8 11 00 00 00       	mov    $0x11,%eax
+  80164d:	89 cb                	mov    %ecx,%ebx
+  80164f:	89 cf                	mov    %ecx,%edi
+  801651:	55                   	push   %ebp
+  801652:	89 e5                	mov    %esp,%ebp
+  801654:	8d 35 5c 16 80 00    	lea    0x80165c,%esi
+  80165a:	0f 34                	sysenter
+  80165c:	5d                   	pop    %ebp
+		goto out;
+  80165d:	eb dc                	jmp    80163b <sys_env_print_stats+0x24>
+
+0080165f <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80165f:	55                   	push   %ebp
+  801660:	89 e5                	mov    %esp,%ebp
+  801662:	57                   	push   %edi
+  801663:	56                   	push   %esi
+  801664:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801665:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80166c:	74 1b                	je     801689 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80166e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801673:	b8 19 00 00 00       	mov    $0x19,%eax
+  801678:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167e:	89 df                	mov    %ebx,%edi
+  801680:	89 de                	mov    %ebx,%esi
+  801682:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801684:	5b                   	pop    %ebx
+  801685:	5e                   	pop    %esi
+  801686:	5f                   	pop    %edi
+  801687:	5d                   	pop    %ebp
+  801688:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801689:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801691:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801694:	b8 19 00 00 00       	mov    $0x19,%eax
+  801699:	89 df                	mov    %ebx,%edi
+  80169b:	55                   	push   %ebp
+  80169c:	89 e5                	mov    %esp,%ebp
+  80169e:	8d 35 a6 16 80 00    	lea    0x8016a6,%esi
+  8016a4:	0f 34                	sysenter
+  8016a6:	5d                   	pop    %ebp
+		goto out;
+  8016a7:	eb db                	jmp    801684 <sys_perf+0x25>
+
+008016a9 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	57                   	push   %edi
+  8016ad:	56                   	push   %esi
+  8016ae:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016af:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016b6:	74 19                	je     8016d1 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8016b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016bd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016c2:	89 d1                	mov    %edx,%ecx
+  8016c4:	89 d3                	mov    %edx,%ebx
+  8016c6:	89 d7                	mov    %edx,%edi
+  8016c8:	89 d6                	mov    %edx,%esi
+  8016ca:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8016cc:	5b                   	pop    %ebx
+  8016cd:	5e                   	pop    %esi
+  8016ce:	5f                   	pop    %edi
+  8016cf:	5d                   	pop    %ebp
+  8016d0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016db:	89 d1                	mov    %edx,%ecx
+  8016dd:	89 d3                	mov    %edx,%ebx
+  8016df:	89 d7                	mov    %edx,%edi
+  8016e1:	55                   	push   %ebp
+  8016e2:	89 e5                	mov    %esp,%ebp
+  8016e4:	8d 35 ec 16 80 00    	lea    0x8016ec,%esi
+  8016ea:	0f 34                	sysenter
+  8016ec:	5d                   	pop    %ebp
+		goto out;
+  8016ed:	eb dd                	jmp    8016cc <sys_fork+0x23>
+
+008016ef <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	57                   	push   %edi
+  8016f3:	56                   	push   %esi
+  8016f4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016fc:	74 1c                	je     80171a <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8016fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801703:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801708:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801711:	89 f7                	mov    %esi,%edi
+  801713:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801715:	5b                   	pop    %ebx
+  801716:	5e                   	pop    %esi
+  801717:	5f                   	pop    %edi
+  801718:	5d                   	pop    %ebp
+  801719:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80171a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801720:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801725:	bf 00 00 00 00       	mov    $0x0,%edi
+  80172a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80172d:	55                   	push   %ebp
+  80172e:	89 e5                	mov    %esp,%ebp
+  801730:	8d 35 38 17 80 00    	lea    0x801738,%esi
+  801736:	0f 34                	sysenter
+  801738:	5d                   	pop    %ebp
+		goto out;
+  801739:	eb da                	jmp    801715 <sys_thread_create+0x26>
+
+0080173b <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	57                   	push   %edi
+  80173f:	56                   	push   %esi
+  801740:	53                   	push   %ebx
+  801741:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801744:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80174b:	74 24                	je     801771 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80174d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801752:	be 00 00 00 00       	mov    $0x0,%esi
+  801757:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801760:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801763:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801765:	85 c0                	test   %eax,%eax
+  801767:	7f 27                	jg     801790 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801769:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80176c:	5b                   	pop    %ebx
+  80176d:	5e                   	pop    %esi
+  80176e:	5f                   	pop    %edi
+  80176f:	5d                   	pop    %ebp
+  801770:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801771:	8b 55 08             	mov    0x8(%ebp),%edx
+  801774:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801777:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80177c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80177f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801782:	55                   	push   %ebp
+  801783:	89 e5                	mov    %esp,%ebp
+  801785:	8d 35 8d 17 80 00    	lea    0x80178d,%esi
+  80178b:	0f 34                	sysenter
+  80178d:	5d                   	pop    %ebp
+		goto out;
+  80178e:	eb d5                	jmp    801765 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801790:	83 ec 0c             	sub    $0xc,%esp
+  801793:	50                   	push   %eax
+  801794:	6a 1f                	push   $0x1f
+  801796:	68 6b 3c 80 00       	push   $0x803c6b
+  80179b:	6a 3f                	push   $0x3f
+  80179d:	68 88 3c 80 00       	push   $0x803c88
+  8017a2:	e8 6c ed ff ff       	call   800513 <_panic>
+
+008017a7 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	57                   	push   %edi
+  8017ab:	56                   	push   %esi
+  8017ac:	53                   	push   %ebx
+  8017ad:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017b0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017b7:	74 23                	je     8017dc <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8017b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8017be:	b8 20 00 00 00       	mov    $0x20,%eax
+  8017c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017cc:	89 f7                	mov    %esi,%edi
+  8017ce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017d0:	85 c0                	test   %eax,%eax
+  8017d2:	7f 29                	jg     8017fd <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8017d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d7:	5b                   	pop    %ebx
+  8017d8:	5e                   	pop    %esi
+  8017d9:	5f                   	pop    %edi
+  8017da:	5d                   	pop    %ebp
+  8017db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e2:	b8 20 00 00 00       	mov    $0x20,%eax
+  8017e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017ef:	55                   	push   %ebp
+  8017f0:	89 e5                	mov    %esp,%ebp
+  8017f2:	8d 35 fa 17 80 00    	lea    0x8017fa,%esi
+  8017f8:	0f 34                	sysenter
+  8017fa:	5d                   	pop    %ebp
+		goto out;
+  8017fb:	eb d3                	jmp    8017d0 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017fd:	83 ec 0c             	sub    $0xc,%esp
+  801800:	50                   	push   %eax
+  801801:	6a 20                	push   $0x20
+  801803:	68 6b 3c 80 00       	push   $0x803c6b
+  801808:	6a 3f                	push   $0x3f
+  80180a:	68 88 3c 80 00       	push   $0x803c88
+  80180f:	e8 ff ec ff ff       	call   800513 <_panic>
+
+00801814 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+  801817:	57                   	push   %edi
+  801818:	56                   	push   %esi
+  801819:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80181a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801821:	74 1b                	je     80183e <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801823:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801828:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80182d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801830:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801833:	89 df                	mov    %ebx,%edi
+  801835:	89 de                	mov    %ebx,%esi
+  801837:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801839:	5b                   	pop    %ebx
+  80183a:	5e                   	pop    %esi
+  80183b:	5f                   	pop    %edi
+  80183c:	5d                   	pop    %ebp
+  80183d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80183e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801843:	8b 55 08             	mov    0x8(%ebp),%edx
+  801846:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801849:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80184e:	89 df                	mov    %ebx,%edi
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	8d 35 5b 18 80 00    	lea    0x80185b,%esi
+  801859:	0f 34                	sysenter
+  80185b:	5d                   	pop    %ebp
+		goto out;
+  80185c:	eb db                	jmp    801839 <sys_batch+0x25>
+
+0080185e <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80185e:	55                   	push   %ebp
+  80185f:	89 e5                	mov    %esp,%ebp
+  801861:	57                   	push   %edi
+  801862:	56                   	push   %esi
+  801863:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801864:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80186b:	74 1a                	je     801887 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80186d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801872:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801877:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187a:	89 cb                	mov    %ecx,%ebx
+  80187c:	89 cf                	mov    %ecx,%edi
+  80187e:	89 ce                	mov    %ecx,%esi
+  801880:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801882:	5b                   	pop    %ebx
+  801883:	5e                   	pop    %esi
+  801884:	5f                   	pop    %edi
+  801885:	5d                   	pop    %ebp
+  801886:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801887:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80188f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801894:	89 cb                	mov    %ecx,%ebx
+  801896:	89 cf                	mov    %ecx,%edi
+  801898:	55                   	push   %ebp
+  801899:	89 e5                	mov    %esp,%ebp
+  80189b:	8d 35 a3 18 80 00    	lea    0x8018a3,%esi
+  8018a1:	0f 34                	sysenter
+  8018a3:	5d                   	pop    %ebp
+		goto out;
+  8018a4:	eb dc                	jmp    801882 <sys_trace_ctl+0x24>
+
+008018a6 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	57                   	push   %edi
+  8018aa:	56                   	push   %esi
+  8018ab:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018ac:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018b3:	74 1c                	je     8018d1 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8018b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8018bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018c8:	89 f7                	mov    %esi,%edi
+  8018ca:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8018cc:	5b                   	pop    %ebx
+  8018cd:	5e                   	pop    %esi
+  8018ce:	5f                   	pop    %edi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8018dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	8d 35 ef 18 80 00    	lea    0x8018ef,%esi
+  8018ed:	0f 34                	sysenter
+  8018ef:	5d                   	pop    %ebp
+		goto out;
+  8018f0:	eb da                	jmp    8018cc <sys_trace_read+0x26>
+
+008018f2 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8018f2:	55                   	push   %ebp
+  8018f3:	89 e5                	mov    %esp,%ebp
+  8018f5:	57                   	push   %edi
+  8018f6:	56                   	push   %esi
+  8018f7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018f8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018ff:	74 1c                	je     80191d <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801901:	be 00 00 00 00       	mov    $0x0,%esi
+  801906:	b8 21 00 00 00       	mov    $0x21,%eax
+  80190b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801911:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801914:	89 f7                	mov    %esi,%edi
+  801916:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801918:	5b                   	pop    %ebx
+  801919:	5e                   	pop    %esi
+  80191a:	5f                   	pop    %edi
+  80191b:	5d                   	pop    %ebp
+  80191c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80191d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801920:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801923:	b8 21 00 00 00       	mov    $0x21,%eax
+  801928:	bf 00 00 00 00       	mov    $0x0,%edi
+  80192d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801930:	55                   	push   %ebp
+  801931:	89 e5                	mov    %esp,%ebp
+  801933:	8d 35 3b 19 80 00    	lea    0x80193b,%esi
+  801939:	0f 34                	sysenter
+  80193b:	5d                   	pop    %ebp
+		goto out;
+  80193c:	eb da                	jmp    801918 <sys_meminfo+0x26>
+
+0080193e <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80193e:	55                   	push   %ebp
+  80193f:	89 e5                	mov    %esp,%ebp
+  801941:	57                   	push   %edi
+  801942:	56                   	push   %esi
+  801943:	53                   	push   %ebx
+  801944:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801947:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80194b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801952:	74 1f                	je     801973 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801954:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801959:	b8 22 00 00 00       	mov    $0x22,%eax
+  80195e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801961:	89 df                	mov    %ebx,%edi
+  801963:	89 de                	mov    %ebx,%esi
+  801965:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801967:	85 c0                	test   %eax,%eax
+  801969:	7f 25                	jg     801990 <sys_env_set_ksm+0x52>
+}
+  80196b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196e:	5b                   	pop    %ebx
+  80196f:	5e                   	pop    %esi
+  801970:	5f                   	pop    %edi
+  801971:	5d                   	pop    %ebp
+  801972:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801973:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801978:	8b 55 08             	mov    0x8(%ebp),%edx
+  80197b:	b8 22 00 00 00       	mov    $0x22,%eax
+  801980:	89 df                	mov    %ebx,%edi
+  801982:	55                   	push   %ebp
+  801983:	89 e5                	mov    %esp,%ebp
+  801985:	8d 35 8d 19 80 00    	lea    0x80198d,%esi
+  80198b:	0f 34                	sysenter
+  80198d:	5d                   	pop    %ebp
+		goto out;
+  80198e:	eb d7                	jmp    801967 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801990:	83 ec 0c             	sub    $0xc,%esp
+  801993:	50                   	push   %eax
+  801994:	6a 22                	push   $0x22
+  801996:	68 6b 3c 80 00       	push   $0x803c6b
+  80199b:	6a 3f                	push   $0x3f
+  80199d:	68 88 3c 80 00       	push   $0x803c88
+  8019a2:	e8 6c eb ff ff       	call   800513 <_panic>
+
+008019a7 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+  8019aa:	57                   	push   %edi
+  8019ab:	56                   	push   %esi
+  8019ac:	53                   	push   %ebx
+  8019ad:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8019b0:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8019b3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8019ba:	74 24                	je     8019e0 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8019bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019c1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8019c6:	89 cb                	mov    %ecx,%ebx
+  8019c8:	89 cf                	mov    %ecx,%edi
+  8019ca:	89 ce                	mov    %ecx,%esi
+  8019cc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	7f 2a                	jg     8019fc <sys_time_nsec+0x55>
+	return ns;
+}
+  8019d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019d5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8019d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019db:	5b                   	pop    %ebx
+  8019dc:	5e                   	pop    %esi
+  8019dd:	5f                   	pop    %edi
+  8019de:	5d                   	pop    %ebp
+  8019df:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8019ea:	89 cb                	mov    %ecx,%ebx
+  8019ec:	89 cf                	mov    %ecx,%edi
+  8019ee:	55                   	push   %ebp
+  8019ef:	89 e5                	mov    %esp,%ebp
+  8019f1:	8d 35 f9 19 80 00    	lea    0x8019f9,%esi
+  8019f7:	0f 34                	sysenter
+  8019f9:	5d                   	pop    %ebp
+		goto out;
+  8019fa:	eb d2                	jmp    8019ce <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019fc:	83 ec 0c             	sub    $0xc,%esp
+  8019ff:	50                   	push   %eax
+  801a00:	6a 0f                	push   $0xf
+  801a02:	68 6b 3c 80 00       	push   $0x803c6b
+  801a07:	6a 3f                	push   $0x3f
+  801a09:	68 88 3c 80 00       	push   $0x803c88
+  801a0e:	e8 00 eb ff ff       	call   800513 <_panic>
+
+00801a13 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801a13:	55                   	push   %ebp
+  801a14:	89 e5                	mov    %esp,%ebp
+  801a16:	57                   	push   %edi
+  801a17:	56                   	push   %esi
+  801a18:	53                   	push   %ebx
+  801a19:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801a1c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801a23:	74 22                	je     801a47 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801a25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2a:	b8 12 00 00 00       	mov    $0x12,%eax
+  801a2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a35:	89 df                	mov    %ebx,%edi
+  801a37:	89 de                	mov    %ebx,%esi
+  801a39:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a3b:	85 c0                	test   %eax,%eax
+  801a3d:	7f 28                	jg     801a67 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a42:	5b                   	pop    %ebx
+  801a43:	5e                   	pop    %esi
+  801a44:	5f                   	pop    %edi
+  801a45:	5d                   	pop    %ebp
+  801a46:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a52:	b8 12 00 00 00       	mov    $0x12,%eax
+  801a57:	89 df                	mov    %ebx,%edi
+  801a59:	55                   	push   %ebp
+  801a5a:	89 e5                	mov    %esp,%ebp
+  801a5c:	8d 35 64 1a 80 00    	lea    0x801a64,%esi
+  801a62:	0f 34                	sysenter
+  801a64:	5d                   	pop    %ebp
+		goto out;
+  801a65:	eb d4                	jmp    801a3b <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a67:	83 ec 0c             	sub    $0xc,%esp
+  801a6a:	50                   	push   %eax
+  801a6b:	6a 12                	push   $0x12
+  801a6d:	68 6b 3c 80 00       	push   $0x803c6b
+  801a72:	6a 3f                	push   $0x3f
+  801a74:	68 88 3c 80 00       	push   $0x803c88
+  801a79:	e8 95 ea ff ff       	call   800513 <_panic>
+
+00801a7e <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	57                   	push   %edi
+  801a82:	56                   	push   %esi
+  801a83:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a84:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801a8b:	74 1b                	je     801aa8 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801a8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a92:	b8 13 00 00 00       	mov    $0x13,%eax
+  801a97:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a9d:	89 df                	mov    %ebx,%edi
+  801a9f:	89 de                	mov    %ebx,%esi
+  801aa1:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801aa3:	5b                   	pop    %ebx
+  801aa4:	5e                   	pop    %esi
+  801aa5:	5f                   	pop    %edi
+  801aa6:	5d                   	pop    %ebp
+  801aa7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801aa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aad:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ab3:	b8 13 00 00 00       	mov    $0x13,%eax
+  801ab8:	89 df                	mov    %ebx,%edi
+  801aba:	55                   	push   %ebp
+  801abb:	89 e5                	mov    %esp,%ebp
+  801abd:	8d 35 c5 1a 80 00    	lea    0x801ac5,%esi
+  801ac3:	0f 34                	sysenter
+  801ac5:	5d                   	pop    %ebp
+		goto out;
+  801ac6:	eb db                	jmp    801aa3 <sys_e1000_receive+0x25>
+
+00801ac8 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801ac8:	55                   	push   %ebp
+  801ac9:	89 e5                	mov    %esp,%ebp
+  801acb:	57                   	push   %edi
+  801acc:	56                   	push   %esi
+  801acd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801ace:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801ad5:	74 1b                	je     801af2 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801ad7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801adc:	b8 14 00 00 00       	mov    $0x14,%eax
+  801ae1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ae7:	89 df                	mov    %ebx,%edi
+  801ae9:	89 de                	mov    %ebx,%esi
+  801aeb:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801aed:	5b                   	pop    %ebx
+  801aee:	5e                   	pop    %esi
+  801aef:	5f                   	pop    %edi
+  801af0:	5d                   	pop    %ebp
+  801af1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801af2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801afa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801afd:	b8 14 00 00 00       	mov    $0x14,%eax
+  801b02:	89 df                	mov    %ebx,%edi
+  801b04:	55                   	push   %ebp
+  801b05:	89 e5                	mov    %esp,%ebp
+  801b07:	8d 35 0f 1b 80 00    	lea    0x801b0f,%esi
+  801b0d:	0f 34                	sysenter
+  801b0f:	5d                   	pop    %ebp
+		goto out;
+  801b10:	eb db                	jmp    801aed <sys_e1000_read_hwaddr+0x25>
+
+00801b12 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801b12:	55                   	push   %ebp
+  801b13:	89 e5                	mov    %esp,%ebp
+  801b15:	57                   	push   %edi
+  801b16:	56                   	push   %esi
+  801b17:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b18:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801b1f:	74 1a                	je     801b3b <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801b21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b26:	b8 15 00 00 00       	mov    $0x15,%eax
+  801b2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b2e:	89 cb                	mov    %ecx,%ebx
+  801b30:	89 cf                	mov    %ecx,%edi
+  801b32:	89 ce                	mov    %ecx,%esi
+  801b34:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801b36:	5b                   	pop    %ebx
+  801b37:	5e                   	pop    %esi
+  801b38:	5f                   	pop    %edi
+  801b39:	5d                   	pop    %ebp
+  801b3a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b43:	b8 15 00 00 00       	mov    $0x15,%eax
+  801b48:	89 cb                	mov    %ecx,%ebx
+  801b4a:	89 cf                	mov    %ecx,%edi
+  801b4c:	55                   	push   %ebp
+  801b4d:	89 e5                	mov    %esp,%ebp
+  801b4f:	8d 35 57 1b 80 00    	lea    0x801b57,%esi
+  801b55:	0f 34                	sysenter
+  801b57:	5d                   	pop    %ebp
+		goto out;
+  801b58:	eb dc                	jmp    801b36 <sys_sb16_read_version+0x24>
+
+00801b5a <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801b5a:	55                   	push   %ebp
+  801b5b:	89 e5                	mov    %esp,%ebp
+  801b5d:	57                   	push   %edi
+  801b5e:	56                   	push   %esi
+  801b5f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b60:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801b67:	74 1b                	je     801b84 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801b69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801b73:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b79:	89 df                	mov    %ebx,%edi
+  801b7b:	89 de                	mov    %ebx,%esi
+  801b7d:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801b7f:	5b                   	pop    %ebx
+  801b80:	5e                   	pop    %esi
+  801b81:	5f                   	pop    %edi
+  801b82:	5d                   	pop    %ebp
+  801b83:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b89:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b8f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801b94:	89 df                	mov    %ebx,%edi
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	8d 35 a1 1b 80 00    	lea    0x801ba1,%esi
+  801b9f:	0f 34                	sysenter
+  801ba1:	5d                   	pop    %ebp
+		goto out;
+  801ba2:	eb db                	jmp    801b7f <sys_sb16_play+0x25>
+
+00801ba4 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801ba4:	55                   	push   %ebp
+  801ba5:	89 e5                	mov    %esp,%ebp
+  801ba7:	53                   	push   %ebx
+  801ba8:	83 ec 04             	sub    $0x4,%esp
+  801bab:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801bad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bb4:	f6 c4 04             	test   $0x4,%ah
+  801bb7:	74 0c                	je     801bc5 <dupperm+0x21>
+  801bb9:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801bc0:	f6 c4 08             	test   $0x8,%ah
+  801bc3:	75 62                	jne    801c27 <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801bc5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801bcc:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801bd1:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801bd7:	74 19                	je     801bf2 <dupperm+0x4e>
+  801bd9:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801be0:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801be5:	83 f8 01             	cmp    $0x1,%eax
+  801be8:	19 c0                	sbb    %eax,%eax
+  801bea:	25 00 08 00 00       	and    $0x800,%eax
+  801bef:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801bf2:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  801bf9:	89 c1                	mov    %eax,%ecx
+  801bfb:	80 cd 04             	or     $0x4,%ch
+  801bfe:	f6 c7 04             	test   $0x4,%bh
+  801c01:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801c04:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801c0b:	f6 c1 02             	test   $0x2,%cl
+  801c0e:	74 12                	je     801c22 <dupperm+0x7e>
+  801c10:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801c17:	89 c2                	mov    %eax,%edx
+  801c19:	83 ca 02             	or     $0x2,%edx
+  801c1c:	f6 c5 04             	test   $0x4,%ch
+  801c1f:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801c22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c25:	c9                   	leave
+  801c26:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801c27:	68 98 3c 80 00       	push   $0x803c98
+  801c2c:	68 57 38 80 00       	push   $0x803857
+  801c31:	6a 39                	push   $0x39
+  801c33:	68 30 3d 80 00       	push   $0x803d30
+  801c38:	e8 d6 e8 ff ff       	call   800513 <_panic>
+
+00801c3d <pgfault>:
+{
+  801c3d:	55                   	push   %ebp
+  801c3e:	89 e5                	mov    %esp,%ebp
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 04             	sub    $0x4,%esp
+  801c44:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801c47:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c49:	89 c3                	mov    %eax,%ebx
+  801c4b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801c51:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801c55:	74 6d                	je     801cc4 <pgfault+0x87>
+  801c57:	89 da                	mov    %ebx,%edx
+  801c59:	c1 ea 16             	shr    $0x16,%edx
+  801c5c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c63:	f6 c2 80             	test   $0x80,%dl
+  801c66:	75 5c                	jne    801cc4 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801c68:	c1 e8 0c             	shr    $0xc,%eax
+  801c6b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801c72:	f6 c4 08             	test   $0x8,%ah
+  801c75:	74 4d                	je     801cc4 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801c77:	83 ec 04             	sub    $0x4,%esp
+  801c7a:	6a 07                	push   $0x7
+  801c7c:	68 00 f0 7f 00       	push   $0x7ff000
+  801c81:	6a 00                	push   $0x0
+  801c83:	e8 a6 f4 ff ff       	call   80112e <sys_page_alloc>
+  801c88:	83 c4 10             	add    $0x10,%esp
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 49                	js     801cd8 <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801c8f:	83 ec 04             	sub    $0x4,%esp
+  801c92:	68 00 10 00 00       	push   $0x1000
+  801c97:	53                   	push   %ebx
+  801c98:	68 00 f0 7f 00       	push   $0x7ff000
+  801c9d:	e8 1a f1 ff ff       	call   800dbc <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801ca2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801ca9:	53                   	push   %ebx
+  801caa:	6a 00                	push   $0x0
+  801cac:	68 00 f0 7f 00       	push   $0x7ff000
+  801cb1:	6a 00                	push   $0x0
+  801cb3:	e8 e3 f4 ff ff       	call   80119b <sys_page_map>
+  801cb8:	83 c4 20             	add    $0x20,%esp
+  801cbb:	85 c0                	test   %eax,%eax
+  801cbd:	78 2d                	js     801cec <pgfault+0xaf>
+}
+  801cbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc2:	c9                   	leave
+  801cc3:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801cc4:	83 ec 04             	sub    $0x4,%esp
+  801cc7:	68 3b 3d 80 00       	push   $0x803d3b
+  801ccc:	6a 1e                	push   $0x1e
+  801cce:	68 30 3d 80 00       	push   $0x803d30
+  801cd3:	e8 3b e8 ff ff       	call   800513 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801cd8:	83 ec 04             	sub    $0x4,%esp
+  801cdb:	68 cc 3c 80 00       	push   $0x803ccc
+  801ce0:	6a 29                	push   $0x29
+  801ce2:	68 30 3d 80 00       	push   $0x803d30
+  801ce7:	e8 27 e8 ff ff       	call   800513 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801cec:	50                   	push   %eax
+  801ced:	68 00 3d 80 00       	push   $0x803d00
+  801cf2:	6a 2e                	push   $0x2e
+  801cf4:	68 30 3d 80 00       	push   $0x803d30
+  801cf9:	e8 15 e8 ff ff       	call   800513 <_panic>
+
+00801cfe <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801d04:	ff 75 0c             	push   0xc(%ebp)
+  801d07:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801d0a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801d11:	e8 23 f3 ff ff       	call   801039 <sys_env_destroy>
+}
+  801d16:	83 c4 10             	add    $0x10,%esp
+  801d19:	c9                   	leave
+  801d1a:	c3                   	ret
+
+00801d1b <ufork>:
+{
+  801d1b:	55                   	push   %ebp
+  801d1c:	89 e5                	mov    %esp,%ebp
+  801d1e:	57                   	push   %edi
+  801d1f:	56                   	push   %esi
+  801d20:	53                   	push   %ebx
+  801d21:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801d27:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d2c:	cd 30                	int    $0x30
+  801d2e:	89 c6                	mov    %eax,%esi
+  801d30:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 56                	js     801d90 <ufork+0x75>
+	if (pid > 0) {
+  801d3a:	0f 8e b3 02 00 00    	jle    801ff3 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801d40:	83 ec 0c             	sub    $0xc,%esp
+  801d43:	68 3d 1c 80 00       	push   $0x801c3d
+  801d48:	e8 aa 17 00 00       	call   8034f7 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801d4d:	83 c4 08             	add    $0x8,%esp
+  801d50:	68 5e 35 80 00       	push   $0x80355e
+  801d55:	56                   	push   %esi
+  801d56:	e8 ef f5 ff ff       	call   80134a <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801d5b:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d61:	89 1c 24             	mov    %ebx,(%esp)
+  801d64:	e8 21 03 00 00       	call   80208a <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801d69:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801d70:	6a 07                	push   $0x7
+  801d72:	68 00 f0 bf ee       	push   $0xeebff000
+  801d77:	56                   	push   %esi
+  801d78:	53                   	push   %ebx
+  801d79:	e8 8d 04 00 00       	call   80220b <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801d7e:	83 c4 20             	add    $0x20,%esp
+  801d81:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d86:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801d8c:	89 fe                	mov    %edi,%esi
+  801d8e:	eb 22                	jmp    801db2 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801d90:	50                   	push   %eax
+  801d91:	68 54 3d 80 00       	push   $0x803d54
+  801d96:	68 a9 00 00 00       	push   $0xa9
+  801d9b:	68 30 3d 80 00       	push   $0x803d30
+  801da0:	e8 6e e7 ff ff       	call   800513 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801da5:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801dab:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801db0:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801db2:	89 f7                	mov    %esi,%edi
+  801db4:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801dba:	0f 87 e9 01 00 00    	ja     801fa9 <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801dc0:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801dc6:	85 f6                	test   %esi,%esi
+  801dc8:	0f 49 d6             	cmovns %esi,%edx
+  801dcb:	c1 fa 0a             	sar    $0xa,%edx
+  801dce:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801dd5:	f6 c1 01             	test   $0x1,%cl
+  801dd8:	74 cb                	je     801da5 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801dda:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801de1:	f6 c2 80             	test   $0x80,%dl
+  801de4:	75 17                	jne    801dfd <ufork+0xe2>
+			j = i + 1;
+  801de6:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801de9:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801df0:	f6 c2 01             	test   $0x1,%dl
+  801df3:	0f 85 f3 00 00 00    	jne    801eec <ufork+0x1d1>
+			j = i + 1;
+  801df9:	89 de                	mov    %ebx,%esi
+  801dfb:	eb b5                	jmp    801db2 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801dfd:	89 fb                	mov    %edi,%ebx
+  801dff:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801e02:	89 d8                	mov    %ebx,%eax
+  801e04:	c1 e8 16             	shr    $0x16,%eax
+  801e07:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e0e:	89 c2                	mov    %eax,%edx
+  801e10:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801e16:	25 02 04 00 00       	and    $0x402,%eax
+  801e1b:	83 f8 02             	cmp    $0x2,%eax
+  801e1e:	74 31                	je     801e51 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801e20:	83 ec 04             	sub    $0x4,%esp
+  801e23:	6a 01                	push   $0x1
+  801e25:	52                   	push   %edx
+  801e26:	53                   	push   %ebx
+  801e27:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801e2d:	53                   	push   %ebx
+  801e2e:	6a 00                	push   $0x0
+  801e30:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801e36:	50                   	push   %eax
+  801e37:	e8 fa 03 00 00       	call   802236 <batch_map>
+		return;
+  801e3c:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801e3f:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801e45:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801e4a:	89 c6                	mov    %eax,%esi
+				continue;
+  801e4c:	e9 61 ff ff ff       	jmp    801db2 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801e51:	83 ec 04             	sub    $0x4,%esp
+  801e54:	80 ca 80             	or     $0x80,%dl
+  801e57:	52                   	push   %edx
+  801e58:	53                   	push   %ebx
+  801e59:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801e5f:	e8 ca f2 ff ff       	call   80112e <sys_page_alloc>
+  801e64:	83 c4 10             	add    $0x10,%esp
+  801e67:	85 c0                	test   %eax,%eax
+  801e69:	78 5d                	js     801ec8 <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801e6b:	83 ec 0c             	sub    $0xc,%esp
+  801e6e:	6a 07                	push   $0x7
+  801e70:	68 00 00 40 00       	push   $0x400000
+  801e75:	6a 00                	push   $0x0
+  801e77:	53                   	push   %ebx
+  801e78:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801e7e:	e8 18 f3 ff ff       	call   80119b <sys_page_map>
+  801e83:	83 c4 20             	add    $0x20,%esp
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 50                	js     801eda <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	68 00 00 40 00       	push   $0x400000
+  801e92:	53                   	push   %ebx
+  801e93:	68 00 00 40 00       	push   $0x400000
+  801e98:	e8 1f ef ff ff       	call   800dbc <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801e9d:	83 c4 08             	add    $0x8,%esp
+  801ea0:	68 00 00 40 00       	push   $0x400000
+  801ea5:	6a 00                	push   $0x0
+  801ea7:	e8 5d f3 ff ff       	call   801209 <sys_page_unmap>
+  801eac:	83 c4 10             	add    $0x10,%esp
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	79 8c                	jns    801e3f <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801eb3:	50                   	push   %eax
+  801eb4:	68 96 38 80 00       	push   $0x803896
+  801eb9:	68 81 00 00 00       	push   $0x81
+  801ebe:	68 30 3d 80 00       	push   $0x803d30
+  801ec3:	e8 4b e6 ff ff       	call   800513 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801ec8:	50                   	push   %eax
+  801ec9:	68 44 38 80 00       	push   $0x803844
+  801ece:	6a 7c                	push   $0x7c
+  801ed0:	68 30 3d 80 00       	push   $0x803d30
+  801ed5:	e8 39 e6 ff ff       	call   800513 <_panic>
+		panic("sys_page_map: %e", r);
+  801eda:	50                   	push   %eax
+  801edb:	68 6f 38 80 00       	push   $0x80386f
+  801ee0:	6a 7e                	push   $0x7e
+  801ee2:	68 30 3d 80 00       	push   $0x803d30
+  801ee7:	e8 27 e6 ff ff       	call   800513 <_panic>
+  801eec:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801ef2:	eb 22                	jmp    801f16 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801ef4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801efb:	a8 01                	test   $0x1,%al
+  801efd:	74 35                	je     801f34 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801eff:	89 d8                	mov    %ebx,%eax
+  801f01:	e8 9e fc ff ff       	call   801ba4 <dupperm>
+  801f06:	89 c6                	mov    %eax,%esi
+  801f08:	89 f8                	mov    %edi,%eax
+  801f0a:	e8 95 fc ff ff       	call   801ba4 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801f0f:	39 c6                	cmp    %eax,%esi
+  801f11:	75 21                	jne    801f34 <ufork+0x219>
+				j++;
+  801f13:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801f16:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801f1c:	74 16                	je     801f34 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801f1e:	89 d8                	mov    %ebx,%eax
+  801f20:	c1 e8 0a             	shr    $0xa,%eax
+  801f23:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f2a:	25 81 00 00 00       	and    $0x81,%eax
+  801f2f:	83 f8 01             	cmp    $0x1,%eax
+  801f32:	74 c0                	je     801ef4 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801f34:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801f3a:	89 d8                	mov    %ebx,%eax
+  801f3c:	29 f0                	sub    %esi,%eax
+  801f3e:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801f44:	89 fe                	mov    %edi,%esi
+  801f46:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801f49:	89 f8                	mov    %edi,%eax
+  801f4b:	e8 54 fc ff ff       	call   801ba4 <dupperm>
+  801f50:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801f52:	83 ec 08             	sub    $0x8,%esp
+  801f55:	6a 02                	push   $0x2
+  801f57:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801f5d:	51                   	push   %ecx
+  801f5e:	e8 95 01 00 00       	call   8020f8 <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801f63:	83 c4 0c             	add    $0xc,%esp
+  801f66:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801f6c:	57                   	push   %edi
+  801f6d:	56                   	push   %esi
+  801f6e:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801f74:	56                   	push   %esi
+  801f75:	6a 00                	push   $0x0
+  801f77:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801f7d:	51                   	push   %ecx
+  801f7e:	e8 b3 02 00 00       	call   802236 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801f83:	83 c4 1c             	add    $0x1c,%esp
+  801f86:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801f8c:	57                   	push   %edi
+  801f8d:	56                   	push   %esi
+  801f8e:	6a 00                	push   $0x0
+  801f90:	56                   	push   %esi
+  801f91:	6a 00                	push   $0x0
+  801f93:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801f99:	50                   	push   %eax
+  801f9a:	e8 97 02 00 00       	call   802236 <batch_map>
+	return 0;
+  801f9f:	83 c4 20             	add    $0x20,%esp
+  801fa2:	89 de                	mov    %ebx,%esi
+  801fa4:	e9 09 fe ff ff       	jmp    801db2 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801fa9:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801faf:	83 ec 04             	sub    $0x4,%esp
+  801fb2:	6a 02                	push   $0x2
+  801fb4:	56                   	push   %esi
+  801fb5:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801fbb:	53                   	push   %ebx
+  801fbc:	e8 c9 02 00 00       	call   80228a <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801fc1:	89 1c 24             	mov    %ebx,(%esp)
+  801fc4:	e8 dd 00 00 00       	call   8020a6 <batch_flush>
+  801fc9:	83 c4 10             	add    $0x10,%esp
+  801fcc:	85 c0                	test   %eax,%eax
+  801fce:	78 0e                	js     801fde <ufork+0x2c3>
+}
+  801fd0:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801fd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fd9:	5b                   	pop    %ebx
+  801fda:	5e                   	pop    %esi
+  801fdb:	5f                   	pop    %edi
+  801fdc:	5d                   	pop    %ebp
+  801fdd:	c3                   	ret
+			panic("fork: %e", r);
+  801fde:	50                   	push   %eax
+  801fdf:	68 5b 3d 80 00       	push   $0x803d5b
+  801fe4:	68 d7 00 00 00       	push   $0xd7
+  801fe9:	68 30 3d 80 00       	push   $0x803d30
+  801fee:	e8 20 e5 ff ff       	call   800513 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801ff3:	e8 aa f0 ff ff       	call   8010a2 <sys_getenvid>
+  801ff8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ffd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802003:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802008:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  80200d:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  802014:	00 00 00 
+  802017:	eb b7                	jmp    801fd0 <ufork+0x2b5>
+
+00802019 <fork>:
+{
+  802019:	55                   	push   %ebp
+  80201a:	89 e5                	mov    %esp,%ebp
+  80201c:	53                   	push   %ebx
+  80201d:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  802020:	68 3d 1c 80 00       	push   $0x801c3d
+  802025:	e8 cd 14 00 00       	call   8034f7 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  80202a:	e8 7a f6 ff ff       	call   8016a9 <sys_fork>
+  80202f:	89 c3                	mov    %eax,%ebx
+  802031:	83 c4 10             	add    $0x10,%esp
+  802034:	85 c0                	test   %eax,%eax
+  802036:	78 09                	js     802041 <fork+0x28>
+	if (pid == 0)
+  802038:	74 1c                	je     802056 <fork+0x3d>
+}
+  80203a:	89 d8                	mov    %ebx,%eax
+  80203c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80203f:	c9                   	leave
+  802040:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  802041:	50                   	push   %eax
+  802042:	68 54 3d 80 00       	push   $0x803d54
+  802047:	68 ed 00 00 00       	push   $0xed
+  80204c:	68 30 3d 80 00       	push   $0x803d30
+  802051:	e8 bd e4 ff ff       	call   800513 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  802056:	e8 47 f0 ff ff       	call   8010a2 <sys_getenvid>
+  80205b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802060:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802066:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80206b:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  802070:	eb c8                	jmp    80203a <fork+0x21>
+
+00802072 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  802078:	ff 75 0c             	push   0xc(%ebp)
+  80207b:	ff 75 08             	push   0x8(%ebp)
+  80207e:	68 fe 1c 80 00       	push   $0x801cfe
+  802083:	e8 67 f6 ff ff       	call   8016ef <sys_thread_create>
+}
+  802088:	c9                   	leave
+  802089:	c3                   	ret
+
+0080208a <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  80208a:	55                   	push   %ebp
+  80208b:	89 e5                	mov    %esp,%ebp
+  80208d:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  802090:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  802097:	00 00 00 
+	b->b_error = 0;
+  80209a:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  8020a1:	00 00 00 
+}
+  8020a4:	5d                   	pop    %ebp
+  8020a5:	c3                   	ret
+
+008020a6 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  8020a6:	55                   	push   %ebp
+  8020a7:	89 e5                	mov    %esp,%ebp
+  8020a9:	53                   	push   %ebx
+  8020aa:	83 ec 04             	sub    $0x4,%esp
+  8020ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  8020b0:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8020b6:	85 c0                	test   %eax,%eax
+  8020b8:	7e 09                	jle    8020c3 <batch_flush+0x1d>
+  8020ba:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  8020c1:	74 15                	je     8020d8 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  8020c3:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  8020ca:	00 00 00 
+	return b->b_error;
+  8020cd:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  8020d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d6:	c9                   	leave
+  8020d7:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  8020d8:	83 ec 08             	sub    $0x8,%esp
+  8020db:	50                   	push   %eax
+  8020dc:	53                   	push   %ebx
+  8020dd:	e8 32 f7 ff ff       	call   801814 <sys_batch>
+  8020e2:	83 c4 10             	add    $0x10,%esp
+  8020e5:	85 c0                	test   %eax,%eax
+  8020e7:	79 da                	jns    8020c3 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  8020e9:	f7 d8                	neg    %eax
+  8020eb:	0f b6 c0             	movzbl %al,%eax
+  8020ee:	f7 d8                	neg    %eax
+  8020f0:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  8020f6:	eb cb                	jmp    8020c3 <batch_flush+0x1d>
+
+008020f8 <batch_reserve>:
+{
+  8020f8:	55                   	push   %ebp
+  8020f9:	89 e5                	mov    %esp,%ebp
+  8020fb:	83 ec 08             	sub    $0x8,%esp
+  8020fe:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  802101:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  802107:	03 45 0c             	add    0xc(%ebp),%eax
+  80210a:	83 f8 10             	cmp    $0x10,%eax
+  80210d:	7f 02                	jg     802111 <batch_reserve+0x19>
+}
+  80210f:	c9                   	leave
+  802110:	c3                   	ret
+		batch_flush(b);
+  802111:	83 ec 0c             	sub    $0xc,%esp
+  802114:	52                   	push   %edx
+  802115:	e8 8c ff ff ff       	call   8020a6 <batch_flush>
+  80211a:	83 c4 10             	add    $0x10,%esp
+}
+  80211d:	eb f0                	jmp    80210f <batch_reserve+0x17>
+
+0080211f <batch_next>:
+{
+  80211f:	55                   	push   %ebp
+  802120:	89 e5                	mov    %esp,%ebp
+  802122:	53                   	push   %ebx
+  802123:	83 ec 04             	sub    $0x4,%esp
+  802126:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  802128:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  80212f:	74 28                	je     802159 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  802131:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  802137:	8d 50 01             	lea    0x1(%eax),%edx
+  80213a:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  802140:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802143:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  802145:	83 ec 04             	sub    $0x4,%esp
+  802148:	6a 1c                	push   $0x1c
+  80214a:	6a 00                	push   $0x0
+  80214c:	53                   	push   %ebx
+  80214d:	e8 35 ec ff ff       	call   800d87 <memset>
+}
+  802152:	89 d8                	mov    %ebx,%eax
+  802154:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802157:	c9                   	leave
+  802158:	c3                   	ret
+		batch_flush(b);
+  802159:	83 ec 0c             	sub    $0xc,%esp
+  80215c:	50                   	push   %eax
+  80215d:	e8 44 ff ff ff       	call   8020a6 <batch_flush>
+  802162:	83 c4 10             	add    $0x10,%esp
+  802165:	eb ca                	jmp    802131 <batch_next+0x12>
+
+00802167 <batch_page>:
+{
+  802167:	55                   	push   %ebp
+  802168:	89 e5                	mov    %esp,%ebp
+  80216a:	57                   	push   %edi
+  80216b:	56                   	push   %esi
+  80216c:	53                   	push   %ebx
+  80216d:	83 ec 1c             	sub    $0x1c,%esp
+  802170:	89 d3                	mov    %edx,%ebx
+  802172:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  802174:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  80217a:	85 d2                	test   %edx,%edx
+  80217c:	74 50                	je     8021ce <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  80217e:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  802181:	01 c1                	add    %eax,%ecx
+  802183:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  802186:	75 46                	jne    8021ce <batch_page+0x67>
+  802188:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  80218b:	75 41                	jne    8021ce <batch_page+0x67>
+  80218d:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  802190:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  802193:	75 39                	jne    8021ce <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  802195:	83 ea 01             	sub    $0x1,%edx
+  802198:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  80219b:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  80219e:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  8021a2:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8021a5:	75 27                	jne    8021ce <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8021a7:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8021aa:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8021ae:	89 fa                	mov    %edi,%edx
+  8021b0:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8021b3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8021b6:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8021b9:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8021bc:	75 10                	jne    8021ce <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8021be:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8021c2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8021c5:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8021c9:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8021cc:	74 2a                	je     8021f8 <batch_page+0x91>
+	op = batch_next(b);
+  8021ce:	e8 4c ff ff ff       	call   80211f <batch_next>
+	op->bo_op = opcode;
+  8021d3:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  8021d5:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  8021d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021db:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  8021de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8021e1:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  8021e4:	8b 75 10             	mov    0x10(%ebp),%esi
+  8021e7:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  8021ea:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8021ed:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  8021f0:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8021f3:	89 78 14             	mov    %edi,0x14(%eax)
+  8021f6:	eb 0b                	jmp    802203 <batch_page+0x9c>
+		op->bo_npages += npages;
+  8021f8:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  8021fc:	03 7d 18             	add    0x18(%ebp),%edi
+  8021ff:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802203:	83 c4 1c             	add    $0x1c,%esp
+  802206:	5b                   	pop    %ebx
+  802207:	5e                   	pop    %esi
+  802208:	5f                   	pop    %edi
+  802209:	5d                   	pop    %ebp
+  80220a:	c3                   	ret
+
+0080220b <batch_alloc>:
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802211:	ff 75 18             	push   0x18(%ebp)
+  802214:	ff 75 14             	push   0x14(%ebp)
+  802217:	ff 75 10             	push   0x10(%ebp)
+  80221a:	ff 75 0c             	push   0xc(%ebp)
+  80221d:	6a 00                	push   $0x0
+  80221f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802224:	ba 00 00 00 00       	mov    $0x0,%edx
+  802229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222c:	e8 36 ff ff ff       	call   802167 <batch_page>
+}
+  802231:	83 c4 20             	add    $0x20,%esp
+  802234:	c9                   	leave
+  802235:	c3                   	ret
+
+00802236 <batch_map>:
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  80223c:	ff 75 20             	push   0x20(%ebp)
+  80223f:	ff 75 1c             	push   0x1c(%ebp)
+  802242:	ff 75 18             	push   0x18(%ebp)
+  802245:	ff 75 14             	push   0x14(%ebp)
+  802248:	ff 75 10             	push   0x10(%ebp)
+  80224b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80224e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802253:	8b 45 08             	mov    0x8(%ebp),%eax
+  802256:	e8 0c ff ff ff       	call   802167 <batch_page>
+}
+  80225b:	83 c4 20             	add    $0x20,%esp
+  80225e:	c9                   	leave
+  80225f:	c3                   	ret
+
+00802260 <batch_unmap>:
+{
+  802260:	55                   	push   %ebp
+  802261:	89 e5                	mov    %esp,%ebp
+  802263:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  802266:	ff 75 14             	push   0x14(%ebp)
+  802269:	6a 00                	push   $0x0
+  80226b:	ff 75 10             	push   0x10(%ebp)
+  80226e:	ff 75 0c             	push   0xc(%ebp)
+  802271:	6a 00                	push   $0x0
+  802273:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802278:	ba 02 00 00 00       	mov    $0x2,%edx
+  80227d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802280:	e8 e2 fe ff ff       	call   802167 <batch_page>
+}
+  802285:	83 c4 20             	add    $0x20,%esp
+  802288:	c9                   	leave
+  802289:	c3                   	ret
+
+0080228a <batch_set_status>:
+{
+  80228a:	55                   	push   %ebp
+  80228b:	89 e5                	mov    %esp,%ebp
+  80228d:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  802290:	8b 45 08             	mov    0x8(%ebp),%eax
+  802293:	e8 87 fe ff ff       	call   80211f <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  802298:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  80229e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022a1:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8022a4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022a7:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8022aa:	c9                   	leave
+  8022ab:	c3                   	ret
+
+008022ac <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8022ac:	55                   	push   %ebp
+  8022ad:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8022af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b2:	05 00 00 00 30       	add    $0x30000000,%eax
+  8022b7:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8022ba:	5d                   	pop    %ebp
+  8022bb:	c3                   	ret
+
+008022bc <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8022bc:	55                   	push   %ebp
+  8022bd:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8022bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c2:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8022c7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8022cc:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8022d1:	5d                   	pop    %ebp
+  8022d2:	c3                   	ret
+
+008022d3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8022d3:	55                   	push   %ebp
+  8022d4:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8022d6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8022db:	eb 02                	jmp    8022df <fd_alloc+0xc>
+  8022dd:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8022df:	89 c2                	mov    %eax,%edx
+  8022e1:	c1 ea 16             	shr    $0x16,%edx
+  8022e4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8022eb:	f6 c2 01             	test   $0x1,%dl
+  8022ee:	74 2b                	je     80231b <fd_alloc+0x48>
+  8022f0:	89 c2                	mov    %eax,%edx
+  8022f2:	c1 ea 0c             	shr    $0xc,%edx
+  8022f5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8022fc:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802302:	f6 c1 01             	test   $0x1,%cl
+  802305:	74 14                	je     80231b <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802307:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80230d:	75 ce                	jne    8022dd <fd_alloc+0xa>
+  80230f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802314:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802319:	eb 05                	jmp    802320 <fd_alloc+0x4d>
+			return 0;
+  80231b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802320:	8b 55 08             	mov    0x8(%ebp),%edx
+  802323:	89 02                	mov    %eax,(%edx)
+}
+  802325:	89 c8                	mov    %ecx,%eax
+  802327:	5d                   	pop    %ebp
+  802328:	c3                   	ret
+
+00802329 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802329:	55                   	push   %ebp
+  80232a:	89 e5                	mov    %esp,%ebp
+  80232c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80232f:	83 f8 1f             	cmp    $0x1f,%eax
+  802332:	77 30                	ja     802364 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802334:	c1 e0 0c             	shl    $0xc,%eax
+  802337:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80233c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802342:	f6 c2 01             	test   $0x1,%dl
+  802345:	74 24                	je     80236b <fd_lookup+0x42>
+  802347:	89 c2                	mov    %eax,%edx
+  802349:	c1 ea 0c             	shr    $0xc,%edx
+  80234c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802353:	f6 c2 01             	test   $0x1,%dl
+  802356:	74 1a                	je     802372 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802358:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80235b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80235d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802362:	5d                   	pop    %ebp
+  802363:	c3                   	ret
+		return -E_INVAL;
+  802364:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802369:	eb f7                	jmp    802362 <fd_lookup+0x39>
+		return -E_INVAL;
+  80236b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802370:	eb f0                	jmp    802362 <fd_lookup+0x39>
+  802372:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802377:	eb e9                	jmp    802362 <fd_lookup+0x39>
+
+00802379 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802379:	55                   	push   %ebp
+  80237a:	89 e5                	mov    %esp,%ebp
+  80237c:	53                   	push   %ebx
+  80237d:	83 ec 04             	sub    $0x4,%esp
+  802380:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802383:	b8 00 00 00 00       	mov    $0x0,%eax
+  802388:	eb 03                	jmp    80238d <dev_lookup+0x14>
+  80238a:	83 c0 01             	add    $0x1,%eax
+  80238d:	8b 1c 85 e0 3d 80 00 	mov    0x803de0(,%eax,4),%ebx
+  802394:	85 db                	test   %ebx,%ebx
+  802396:	74 0b                	je     8023a3 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  802398:	39 13                	cmp    %edx,(%ebx)
+  80239a:	75 ee                	jne    80238a <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80239c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a1:	eb 2e                	jmp    8023d1 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8023a3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023a5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8023aa:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023b0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8023b5:	76 24                	jbe    8023db <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023b7:	8b 41 48             	mov    0x48(%ecx),%eax
+  8023ba:	83 ec 04             	sub    $0x4,%esp
+  8023bd:	52                   	push   %edx
+  8023be:	50                   	push   %eax
+  8023bf:	68 64 3d 80 00       	push   $0x803d64
+  8023c4:	e8 25 e2 ff ff       	call   8005ee <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8023c9:	83 c4 10             	add    $0x10,%esp
+  8023cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8023d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023d4:	89 1a                	mov    %ebx,(%edx)
+}
+  8023d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8023db:	c1 e8 10             	shr    $0x10,%eax
+  8023de:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8023e4:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8023ea:	eb cb                	jmp    8023b7 <dev_lookup+0x3e>
+
+008023ec <fd_close>:
+{
+  8023ec:	55                   	push   %ebp
+  8023ed:	89 e5                	mov    %esp,%ebp
+  8023ef:	57                   	push   %edi
+  8023f0:	56                   	push   %esi
+  8023f1:	53                   	push   %ebx
+  8023f2:	83 ec 24             	sub    $0x24,%esp
+  8023f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023f8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8023fb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023fe:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8023ff:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802405:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802408:	50                   	push   %eax
+  802409:	e8 1b ff ff ff       	call   802329 <fd_lookup>
+  80240e:	89 c3                	mov    %eax,%ebx
+  802410:	83 c4 10             	add    $0x10,%esp
+  802413:	85 c0                	test   %eax,%eax
+  802415:	78 05                	js     80241c <fd_close+0x30>
+	    || fd != fd2)
+  802417:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80241a:	74 16                	je     802432 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80241c:	89 f8                	mov    %edi,%eax
+  80241e:	84 c0                	test   %al,%al
+  802420:	b8 00 00 00 00       	mov    $0x0,%eax
+  802425:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802428:	89 d8                	mov    %ebx,%eax
+  80242a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80242d:	5b                   	pop    %ebx
+  80242e:	5e                   	pop    %esi
+  80242f:	5f                   	pop    %edi
+  802430:	5d                   	pop    %ebp
+  802431:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802432:	83 ec 08             	sub    $0x8,%esp
+  802435:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802438:	50                   	push   %eax
+  802439:	ff 36                	push   (%esi)
+  80243b:	e8 39 ff ff ff       	call   802379 <dev_lookup>
+  802440:	89 c3                	mov    %eax,%ebx
+  802442:	83 c4 10             	add    $0x10,%esp
+  802445:	85 c0                	test   %eax,%eax
+  802447:	78 1a                	js     802463 <fd_close+0x77>
+		if (dev->dev_close)
+  802449:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80244c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80244f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802454:	85 c0                	test   %eax,%eax
+  802456:	74 0b                	je     802463 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802458:	83 ec 0c             	sub    $0xc,%esp
+  80245b:	56                   	push   %esi
+  80245c:	ff d0                	call   *%eax
+  80245e:	89 c3                	mov    %eax,%ebx
+  802460:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802463:	83 ec 08             	sub    $0x8,%esp
+  802466:	56                   	push   %esi
+  802467:	6a 00                	push   $0x0
+  802469:	e8 9b ed ff ff       	call   801209 <sys_page_unmap>
+	return r;
+  80246e:	83 c4 10             	add    $0x10,%esp
+  802471:	eb b5                	jmp    802428 <fd_close+0x3c>
+
+00802473 <close>:
+
+int
+close(int fdnum)
+{
+  802473:	55                   	push   %ebp
+  802474:	89 e5                	mov    %esp,%ebp
+  802476:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802479:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80247c:	50                   	push   %eax
+  80247d:	ff 75 08             	push   0x8(%ebp)
+  802480:	e8 a4 fe ff ff       	call   802329 <fd_lookup>
+  802485:	83 c4 10             	add    $0x10,%esp
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	79 02                	jns    80248e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80248c:	c9                   	leave
+  80248d:	c3                   	ret
+		return fd_close(fd, 1);
+  80248e:	83 ec 08             	sub    $0x8,%esp
+  802491:	6a 01                	push   $0x1
+  802493:	ff 75 f4             	push   -0xc(%ebp)
+  802496:	e8 51 ff ff ff       	call   8023ec <fd_close>
+  80249b:	83 c4 10             	add    $0x10,%esp
+  80249e:	eb ec                	jmp    80248c <close+0x19>
+
+008024a0 <close_all>:
+
+void
+close_all(void)
+{
+  8024a0:	55                   	push   %ebp
+  8024a1:	89 e5                	mov    %esp,%ebp
+  8024a3:	53                   	push   %ebx
+  8024a4:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8024a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8024ac:	83 ec 0c             	sub    $0xc,%esp
+  8024af:	53                   	push   %ebx
+  8024b0:	e8 be ff ff ff       	call   802473 <close>
+	for (i = 0; i < MAXFD; i++)
+  8024b5:	83 c3 01             	add    $0x1,%ebx
+  8024b8:	83 c4 10             	add    $0x10,%esp
+  8024bb:	83 fb 20             	cmp    $0x20,%ebx
+  8024be:	75 ec                	jne    8024ac <close_all+0xc>
+}
+  8024c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c3:	c9                   	leave
+  8024c4:	c3                   	ret
+
+008024c5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8024c5:	55                   	push   %ebp
+  8024c6:	89 e5                	mov    %esp,%ebp
+  8024c8:	57                   	push   %edi
+  8024c9:	56                   	push   %esi
+  8024ca:	53                   	push   %ebx
+  8024cb:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8024ce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024d1:	50                   	push   %eax
+  8024d2:	ff 75 08             	push   0x8(%ebp)
+  8024d5:	e8 4f fe ff ff       	call   802329 <fd_lookup>
+  8024da:	89 c3                	mov    %eax,%ebx
+  8024dc:	83 c4 10             	add    $0x10,%esp
+  8024df:	85 c0                	test   %eax,%eax
+  8024e1:	78 7f                	js     802562 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8024e3:	83 ec 0c             	sub    $0xc,%esp
+  8024e6:	ff 75 0c             	push   0xc(%ebp)
+  8024e9:	e8 85 ff ff ff       	call   802473 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8024ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8024f1:	c1 e6 0c             	shl    $0xc,%esi
+  8024f4:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8024fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8024fd:	89 3c 24             	mov    %edi,(%esp)
+  802500:	e8 b7 fd ff ff       	call   8022bc <fd2data>
+  802505:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802507:	89 34 24             	mov    %esi,(%esp)
+  80250a:	e8 ad fd ff ff       	call   8022bc <fd2data>
+  80250f:	83 c4 10             	add    $0x10,%esp
+  802512:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802515:	89 d8                	mov    %ebx,%eax
+  802517:	c1 e8 16             	shr    $0x16,%eax
+  80251a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802521:	a8 01                	test   $0x1,%al
+  802523:	74 11                	je     802536 <dup+0x71>
+  802525:	89 d8                	mov    %ebx,%eax
+  802527:	c1 e8 0c             	shr    $0xc,%eax
+  80252a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802531:	f6 c2 01             	test   $0x1,%dl
+  802534:	75 36                	jne    80256c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802536:	89 f8                	mov    %edi,%eax
+  802538:	c1 e8 0c             	shr    $0xc,%eax
+  80253b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802542:	83 ec 0c             	sub    $0xc,%esp
+  802545:	25 07 0e 00 00       	and    $0xe07,%eax
+  80254a:	50                   	push   %eax
+  80254b:	56                   	push   %esi
+  80254c:	6a 00                	push   $0x0
+  80254e:	57                   	push   %edi
+  80254f:	6a 00                	push   $0x0
+  802551:	e8 45 ec ff ff       	call   80119b <sys_page_map>
+  802556:	89 c3                	mov    %eax,%ebx
+  802558:	83 c4 20             	add    $0x20,%esp
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	78 33                	js     802592 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80255f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802562:	89 d8                	mov    %ebx,%eax
+  802564:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802567:	5b                   	pop    %ebx
+  802568:	5e                   	pop    %esi
+  802569:	5f                   	pop    %edi
+  80256a:	5d                   	pop    %ebp
+  80256b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80256c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802573:	83 ec 0c             	sub    $0xc,%esp
+  802576:	25 07 0e 00 00       	and    $0xe07,%eax
+  80257b:	50                   	push   %eax
+  80257c:	ff 75 d4             	push   -0x2c(%ebp)
+  80257f:	6a 00                	push   $0x0
+  802581:	53                   	push   %ebx
+  802582:	6a 00                	push   $0x0
+  802584:	e8 12 ec ff ff       	call   80119b <sys_page_map>
+  802589:	89 c3                	mov    %eax,%ebx
+  80258b:	83 c4 20             	add    $0x20,%esp
+  80258e:	85 c0                	test   %eax,%eax
+  802590:	79 a4                	jns    802536 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802592:	83 ec 08             	sub    $0x8,%esp
+  802595:	56                   	push   %esi
+  802596:	6a 00                	push   $0x0
+  802598:	e8 6c ec ff ff       	call   801209 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80259d:	83 c4 08             	add    $0x8,%esp
+  8025a0:	ff 75 d4             	push   -0x2c(%ebp)
+  8025a3:	6a 00                	push   $0x0
+  8025a5:	e8 5f ec ff ff       	call   801209 <sys_page_unmap>
+	return r;
+  8025aa:	83 c4 10             	add    $0x10,%esp
+  8025ad:	eb b3                	jmp    802562 <dup+0x9d>
+
+008025af <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8025af:	55                   	push   %ebp
+  8025b0:	89 e5                	mov    %esp,%ebp
+  8025b2:	56                   	push   %esi
+  8025b3:	53                   	push   %ebx
+  8025b4:	83 ec 18             	sub    $0x18,%esp
+  8025b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025ba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025bd:	50                   	push   %eax
+  8025be:	53                   	push   %ebx
+  8025bf:	e8 65 fd ff ff       	call   802329 <fd_lookup>
+  8025c4:	83 c4 10             	add    $0x10,%esp
+  8025c7:	85 c0                	test   %eax,%eax
+  8025c9:	78 3c                	js     802607 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025cb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025ce:	83 ec 08             	sub    $0x8,%esp
+  8025d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025d4:	50                   	push   %eax
+  8025d5:	ff 36                	push   (%esi)
+  8025d7:	e8 9d fd ff ff       	call   802379 <dev_lookup>
+  8025dc:	83 c4 10             	add    $0x10,%esp
+  8025df:	85 c0                	test   %eax,%eax
+  8025e1:	78 24                	js     802607 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8025e3:	8b 46 08             	mov    0x8(%esi),%eax
+  8025e6:	83 e0 03             	and    $0x3,%eax
+  8025e9:	83 f8 01             	cmp    $0x1,%eax
+  8025ec:	74 20                	je     80260e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8025ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025f1:	8b 40 08             	mov    0x8(%eax),%eax
+  8025f4:	85 c0                	test   %eax,%eax
+  8025f6:	74 57                	je     80264f <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8025f8:	83 ec 04             	sub    $0x4,%esp
+  8025fb:	ff 75 10             	push   0x10(%ebp)
+  8025fe:	ff 75 0c             	push   0xc(%ebp)
+  802601:	56                   	push   %esi
+  802602:	ff d0                	call   *%eax
+  802604:	83 c4 10             	add    $0x10,%esp
+}
+  802607:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80260a:	5b                   	pop    %ebx
+  80260b:	5e                   	pop    %esi
+  80260c:	5d                   	pop    %ebp
+  80260d:	c3                   	ret
+  80260e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802610:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802615:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80261b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802620:	76 1c                	jbe    80263e <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802622:	8b 42 48             	mov    0x48(%edx),%eax
+  802625:	83 ec 04             	sub    $0x4,%esp
+  802628:	53                   	push   %ebx
+  802629:	50                   	push   %eax
+  80262a:	68 a5 3d 80 00       	push   $0x803da5
+  80262f:	e8 ba df ff ff       	call   8005ee <cprintf>
+		return -E_INVAL;
+  802634:	83 c4 10             	add    $0x10,%esp
+  802637:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80263c:	eb c9                	jmp    802607 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80263e:	c1 e8 10             	shr    $0x10,%eax
+  802641:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802647:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80264d:	eb d3                	jmp    802622 <read+0x73>
+		return -E_NOT_SUPP;
+  80264f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802654:	eb b1                	jmp    802607 <read+0x58>
+
+00802656 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802656:	55                   	push   %ebp
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	57                   	push   %edi
+  80265a:	56                   	push   %esi
+  80265b:	53                   	push   %ebx
+  80265c:	83 ec 0c             	sub    $0xc,%esp
+  80265f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802662:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802665:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80266a:	eb 02                	jmp    80266e <readn+0x18>
+  80266c:	01 c3                	add    %eax,%ebx
+  80266e:	39 f3                	cmp    %esi,%ebx
+  802670:	73 21                	jae    802693 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802672:	83 ec 04             	sub    $0x4,%esp
+  802675:	89 f0                	mov    %esi,%eax
+  802677:	29 d8                	sub    %ebx,%eax
+  802679:	50                   	push   %eax
+  80267a:	89 d8                	mov    %ebx,%eax
+  80267c:	03 45 0c             	add    0xc(%ebp),%eax
+  80267f:	50                   	push   %eax
+  802680:	57                   	push   %edi
+  802681:	e8 29 ff ff ff       	call   8025af <read>
+		if (m < 0)
+  802686:	83 c4 10             	add    $0x10,%esp
+  802689:	85 c0                	test   %eax,%eax
+  80268b:	78 04                	js     802691 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80268d:	75 dd                	jne    80266c <readn+0x16>
+  80268f:	eb 02                	jmp    802693 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802691:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802693:	89 d8                	mov    %ebx,%eax
+  802695:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802698:	5b                   	pop    %ebx
+  802699:	5e                   	pop    %esi
+  80269a:	5f                   	pop    %edi
+  80269b:	5d                   	pop    %ebp
+  80269c:	c3                   	ret
+
+0080269d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80269d:	55                   	push   %ebp
+  80269e:	89 e5                	mov    %esp,%ebp
+  8026a0:	56                   	push   %esi
+  8026a1:	53                   	push   %ebx
+  8026a2:	83 ec 18             	sub    $0x18,%esp
+  8026a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8026a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026ab:	50                   	push   %eax
+  8026ac:	53                   	push   %ebx
+  8026ad:	e8 77 fc ff ff       	call   802329 <fd_lookup>
+  8026b2:	83 c4 10             	add    $0x10,%esp
+  8026b5:	85 c0                	test   %eax,%eax
+  8026b7:	78 37                	js     8026f0 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026b9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026bc:	83 ec 08             	sub    $0x8,%esp
+  8026bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c2:	50                   	push   %eax
+  8026c3:	ff 36                	push   (%esi)
+  8026c5:	e8 af fc ff ff       	call   802379 <dev_lookup>
+  8026ca:	83 c4 10             	add    $0x10,%esp
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	78 1f                	js     8026f0 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026d1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8026d5:	74 20                	je     8026f7 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8026d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026da:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026dd:	85 c0                	test   %eax,%eax
+  8026df:	74 57                	je     802738 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8026e1:	83 ec 04             	sub    $0x4,%esp
+  8026e4:	ff 75 10             	push   0x10(%ebp)
+  8026e7:	ff 75 0c             	push   0xc(%ebp)
+  8026ea:	56                   	push   %esi
+  8026eb:	ff d0                	call   *%eax
+  8026ed:	83 c4 10             	add    $0x10,%esp
+}
+  8026f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026f3:	5b                   	pop    %ebx
+  8026f4:	5e                   	pop    %esi
+  8026f5:	5d                   	pop    %ebp
+  8026f6:	c3                   	ret
+  8026f7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026f9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026fe:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802704:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802709:	76 1c                	jbe    802727 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80270b:	8b 42 48             	mov    0x48(%edx),%eax
+  80270e:	83 ec 04             	sub    $0x4,%esp
+  802711:	53                   	push   %ebx
+  802712:	50                   	push   %eax
+  802713:	68 c1 3d 80 00       	push   $0x803dc1
+  802718:	e8 d1 de ff ff       	call   8005ee <cprintf>
+		return -E_INVAL;
+  80271d:	83 c4 10             	add    $0x10,%esp
+  802720:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802725:	eb c9                	jmp    8026f0 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802727:	c1 e8 10             	shr    $0x10,%eax
+  80272a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802730:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802736:	eb d3                	jmp    80270b <write+0x6e>
+		return -E_NOT_SUPP;
+  802738:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80273d:	eb b1                	jmp    8026f0 <write+0x53>
+
+0080273f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80273f:	55                   	push   %ebp
+  802740:	89 e5                	mov    %esp,%ebp
+  802742:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802745:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802748:	50                   	push   %eax
+  802749:	ff 75 08             	push   0x8(%ebp)
+  80274c:	e8 d8 fb ff ff       	call   802329 <fd_lookup>
+  802751:	83 c4 10             	add    $0x10,%esp
+  802754:	85 c0                	test   %eax,%eax
+  802756:	78 0e                	js     802766 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802758:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80275b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80275e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802761:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802766:	c9                   	leave
+  802767:	c3                   	ret
+
+00802768 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802768:	55                   	push   %ebp
+  802769:	89 e5                	mov    %esp,%ebp
+  80276b:	56                   	push   %esi
+  80276c:	53                   	push   %ebx
+  80276d:	83 ec 18             	sub    $0x18,%esp
+  802770:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802773:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802776:	50                   	push   %eax
+  802777:	53                   	push   %ebx
+  802778:	e8 ac fb ff ff       	call   802329 <fd_lookup>
+  80277d:	83 c4 10             	add    $0x10,%esp
+  802780:	85 c0                	test   %eax,%eax
+  802782:	78 34                	js     8027b8 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802784:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802787:	83 ec 08             	sub    $0x8,%esp
+  80278a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80278d:	50                   	push   %eax
+  80278e:	ff 36                	push   (%esi)
+  802790:	e8 e4 fb ff ff       	call   802379 <dev_lookup>
+  802795:	83 c4 10             	add    $0x10,%esp
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	78 1c                	js     8027b8 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80279c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8027a0:	74 1d                	je     8027bf <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8027a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027a5:	8b 40 18             	mov    0x18(%eax),%eax
+  8027a8:	85 c0                	test   %eax,%eax
+  8027aa:	74 54                	je     802800 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8027ac:	83 ec 08             	sub    $0x8,%esp
+  8027af:	ff 75 0c             	push   0xc(%ebp)
+  8027b2:	56                   	push   %esi
+  8027b3:	ff d0                	call   *%eax
+  8027b5:	83 c4 10             	add    $0x10,%esp
+}
+  8027b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027bb:	5b                   	pop    %ebx
+  8027bc:	5e                   	pop    %esi
+  8027bd:	5d                   	pop    %ebp
+  8027be:	c3                   	ret
+  8027bf:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027c1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8027c6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027cc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8027d1:	76 1c                	jbe    8027ef <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8027d3:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8027d6:	83 ec 04             	sub    $0x4,%esp
+  8027d9:	53                   	push   %ebx
+  8027da:	50                   	push   %eax
+  8027db:	68 84 3d 80 00       	push   $0x803d84
+  8027e0:	e8 09 de ff ff       	call   8005ee <cprintf>
+		return -E_INVAL;
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027ed:	eb c9                	jmp    8027b8 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8027ef:	c1 e8 10             	shr    $0x10,%eax
+  8027f2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8027f8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8027fe:	eb d3                	jmp    8027d3 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802800:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802805:	eb b1                	jmp    8027b8 <ftruncate+0x50>
+
+00802807 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802807:	55                   	push   %ebp
+  802808:	89 e5                	mov    %esp,%ebp
+  80280a:	56                   	push   %esi
+  80280b:	53                   	push   %ebx
+  80280c:	83 ec 18             	sub    $0x18,%esp
+  80280f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802812:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802815:	50                   	push   %eax
+  802816:	ff 75 08             	push   0x8(%ebp)
+  802819:	e8 0b fb ff ff       	call   802329 <fd_lookup>
+  80281e:	83 c4 10             	add    $0x10,%esp
+  802821:	85 c0                	test   %eax,%eax
+  802823:	78 49                	js     80286e <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802825:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802828:	83 ec 08             	sub    $0x8,%esp
+  80282b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80282e:	50                   	push   %eax
+  80282f:	ff 36                	push   (%esi)
+  802831:	e8 43 fb ff ff       	call   802379 <dev_lookup>
+  802836:	83 c4 10             	add    $0x10,%esp
+  802839:	85 c0                	test   %eax,%eax
+  80283b:	78 31                	js     80286e <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80283d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802840:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802844:	74 2f                	je     802875 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802846:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802849:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802850:	00 00 00 
+	stat->st_isdir = 0;
+  802853:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80285a:	00 00 00 
+	stat->st_dev = dev;
+  80285d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802863:	83 ec 08             	sub    $0x8,%esp
+  802866:	53                   	push   %ebx
+  802867:	56                   	push   %esi
+  802868:	ff 50 14             	call   *0x14(%eax)
+  80286b:	83 c4 10             	add    $0x10,%esp
+}
+  80286e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802871:	5b                   	pop    %ebx
+  802872:	5e                   	pop    %esi
+  802873:	5d                   	pop    %ebp
+  802874:	c3                   	ret
+		return -E_NOT_SUPP;
+  802875:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80287a:	eb f2                	jmp    80286e <fstat+0x67>
+
+0080287c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80287c:	55                   	push   %ebp
+  80287d:	89 e5                	mov    %esp,%ebp
+  80287f:	56                   	push   %esi
+  802880:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802881:	83 ec 08             	sub    $0x8,%esp
+  802884:	6a 00                	push   $0x0
+  802886:	ff 75 08             	push   0x8(%ebp)
+  802889:	e8 e4 01 00 00       	call   802a72 <open>
+  80288e:	89 c3                	mov    %eax,%ebx
+  802890:	83 c4 10             	add    $0x10,%esp
+  802893:	85 c0                	test   %eax,%eax
+  802895:	78 1b                	js     8028b2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802897:	83 ec 08             	sub    $0x8,%esp
+  80289a:	ff 75 0c             	push   0xc(%ebp)
+  80289d:	50                   	push   %eax
+  80289e:	e8 64 ff ff ff       	call   802807 <fstat>
+  8028a3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8028a5:	89 1c 24             	mov    %ebx,(%esp)
+  8028a8:	e8 c6 fb ff ff       	call   802473 <close>
+	return r;
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	89 f3                	mov    %esi,%ebx
+}
+  8028b2:	89 d8                	mov    %ebx,%eax
+  8028b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028b7:	5b                   	pop    %ebx
+  8028b8:	5e                   	pop    %esi
+  8028b9:	5d                   	pop    %ebp
+  8028ba:	c3                   	ret
+
+008028bb <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8028bb:	55                   	push   %ebp
+  8028bc:	89 e5                	mov    %esp,%ebp
+  8028be:	56                   	push   %esi
+  8028bf:	53                   	push   %ebx
+  8028c0:	89 c6                	mov    %eax,%esi
+  8028c2:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8028c4:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8028cb:	74 27                	je     8028f4 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8028cd:	6a 07                	push   $0x7
+  8028cf:	68 00 60 80 00       	push   $0x806000
+  8028d4:	56                   	push   %esi
+  8028d5:	ff 35 00 50 80 00    	push   0x805000
+  8028db:	e8 93 0d 00 00       	call   803673 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8028e0:	83 c4 0c             	add    $0xc,%esp
+  8028e3:	6a 00                	push   $0x0
+  8028e5:	53                   	push   %ebx
+  8028e6:	6a 00                	push   $0x0
+  8028e8:	e8 6e 0d 00 00       	call   80365b <ipc_recv>
+}
+  8028ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028f0:	5b                   	pop    %ebx
+  8028f1:	5e                   	pop    %esi
+  8028f2:	5d                   	pop    %ebp
+  8028f3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028f4:	83 ec 0c             	sub    $0xc,%esp
+  8028f7:	6a 01                	push   $0x1
+  8028f9:	e8 c9 0d 00 00       	call   8036c7 <ipc_find_env>
+  8028fe:	a3 00 50 80 00       	mov    %eax,0x805000
+  802903:	83 c4 10             	add    $0x10,%esp
+  802906:	eb c5                	jmp    8028cd <fsipc+0x12>
+
+00802908 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802908:	55                   	push   %ebp
+  802909:	89 e5                	mov    %esp,%ebp
+  80290b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80290e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802911:	8b 40 0c             	mov    0xc(%eax),%eax
+  802914:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802919:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80291c:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802921:	ba 00 00 00 00       	mov    $0x0,%edx
+  802926:	b8 02 00 00 00       	mov    $0x2,%eax
+  80292b:	e8 8b ff ff ff       	call   8028bb <fsipc>
+}
+  802930:	c9                   	leave
+  802931:	c3                   	ret
+
+00802932 <devfile_flush>:
+{
+  802932:	55                   	push   %ebp
+  802933:	89 e5                	mov    %esp,%ebp
+  802935:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802938:	8b 45 08             	mov    0x8(%ebp),%eax
+  80293b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80293e:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802943:	ba 00 00 00 00       	mov    $0x0,%edx
+  802948:	b8 06 00 00 00       	mov    $0x6,%eax
+  80294d:	e8 69 ff ff ff       	call   8028bb <fsipc>
+}
+  802952:	c9                   	leave
+  802953:	c3                   	ret
+
+00802954 <devfile_stat>:
+{
+  802954:	55                   	push   %ebp
+  802955:	89 e5                	mov    %esp,%ebp
+  802957:	53                   	push   %ebx
+  802958:	83 ec 04             	sub    $0x4,%esp
+  80295b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80295e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802961:	8b 40 0c             	mov    0xc(%eax),%eax
+  802964:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802969:	ba 00 00 00 00       	mov    $0x0,%edx
+  80296e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802973:	e8 43 ff ff ff       	call   8028bb <fsipc>
+  802978:	85 c0                	test   %eax,%eax
+  80297a:	78 2c                	js     8029a8 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80297c:	83 ec 08             	sub    $0x8,%esp
+  80297f:	68 00 60 80 00       	push   $0x806000
+  802984:	53                   	push   %ebx
+  802985:	e8 ac e2 ff ff       	call   800c36 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80298a:	a1 80 60 80 00       	mov    0x806080,%eax
+  80298f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802995:	a1 84 60 80 00       	mov    0x806084,%eax
+  80299a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8029a0:	83 c4 10             	add    $0x10,%esp
+  8029a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ab:	c9                   	leave
+  8029ac:	c3                   	ret
+
+008029ad <devfile_write>:
+{
+  8029ad:	55                   	push   %ebp
+  8029ae:	89 e5                	mov    %esp,%ebp
+  8029b0:	83 ec 0c             	sub    $0xc,%esp
+  8029b3:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8029b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029b9:	8b 52 0c             	mov    0xc(%edx),%edx
+  8029bc:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8029c2:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8029c7:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8029cc:	39 d0                	cmp    %edx,%eax
+  8029ce:	0f 47 c2             	cmova  %edx,%eax
+  8029d1:	50                   	push   %eax
+  8029d2:	ff 75 0c             	push   0xc(%ebp)
+  8029d5:	68 08 60 80 00       	push   $0x806008
+  8029da:	e8 dd e3 ff ff       	call   800dbc <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8029df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029e9:	e8 cd fe ff ff       	call   8028bb <fsipc>
+}
+  8029ee:	c9                   	leave
+  8029ef:	c3                   	ret
+
+008029f0 <devfile_read>:
+{
+  8029f0:	55                   	push   %ebp
+  8029f1:	89 e5                	mov    %esp,%ebp
+  8029f3:	56                   	push   %esi
+  8029f4:	53                   	push   %ebx
+  8029f5:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029fe:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802a03:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802a09:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a0e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a13:	e8 a3 fe ff ff       	call   8028bb <fsipc>
+  802a18:	89 c3                	mov    %eax,%ebx
+  802a1a:	85 c0                	test   %eax,%eax
+  802a1c:	78 1f                	js     802a3d <devfile_read+0x4d>
+	assert(r <= n);
+  802a1e:	39 c6                	cmp    %eax,%esi
+  802a20:	72 24                	jb     802a46 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802a22:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802a27:	7f 33                	jg     802a5c <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802a29:	83 ec 04             	sub    $0x4,%esp
+  802a2c:	50                   	push   %eax
+  802a2d:	68 00 60 80 00       	push   $0x806000
+  802a32:	ff 75 0c             	push   0xc(%ebp)
+  802a35:	e8 82 e3 ff ff       	call   800dbc <memmove>
+	return r;
+  802a3a:	83 c4 10             	add    $0x10,%esp
+}
+  802a3d:	89 d8                	mov    %ebx,%eax
+  802a3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a42:	5b                   	pop    %ebx
+  802a43:	5e                   	pop    %esi
+  802a44:	5d                   	pop    %ebp
+  802a45:	c3                   	ret
+	assert(r <= n);
+  802a46:	68 f4 3d 80 00       	push   $0x803df4
+  802a4b:	68 57 38 80 00       	push   $0x803857
+  802a50:	6a 76                	push   $0x76
+  802a52:	68 fb 3d 80 00       	push   $0x803dfb
+  802a57:	e8 b7 da ff ff       	call   800513 <_panic>
+	assert(r <= PGSIZE);
+  802a5c:	68 06 3e 80 00       	push   $0x803e06
+  802a61:	68 57 38 80 00       	push   $0x803857
+  802a66:	6a 77                	push   $0x77
+  802a68:	68 fb 3d 80 00       	push   $0x803dfb
+  802a6d:	e8 a1 da ff ff       	call   800513 <_panic>
+
+00802a72 <open>:
+{
+  802a72:	55                   	push   %ebp
+  802a73:	89 e5                	mov    %esp,%ebp
+  802a75:	56                   	push   %esi
+  802a76:	53                   	push   %ebx
+  802a77:	83 ec 1c             	sub    $0x1c,%esp
+  802a7a:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802a7d:	56                   	push   %esi
+  802a7e:	e8 78 e1 ff ff       	call   800bfb <strlen>
+  802a83:	83 c4 10             	add    $0x10,%esp
+  802a86:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a8b:	7f 6c                	jg     802af9 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802a8d:	83 ec 0c             	sub    $0xc,%esp
+  802a90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a93:	50                   	push   %eax
+  802a94:	e8 3a f8 ff ff       	call   8022d3 <fd_alloc>
+  802a99:	89 c3                	mov    %eax,%ebx
+  802a9b:	83 c4 10             	add    $0x10,%esp
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	78 3c                	js     802ade <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802aa2:	83 ec 08             	sub    $0x8,%esp
+  802aa5:	56                   	push   %esi
+  802aa6:	68 00 60 80 00       	push   $0x806000
+  802aab:	e8 86 e1 ff ff       	call   800c36 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802ab0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ab3:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802ab8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802abb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ac0:	e8 f6 fd ff ff       	call   8028bb <fsipc>
+  802ac5:	89 c3                	mov    %eax,%ebx
+  802ac7:	83 c4 10             	add    $0x10,%esp
+  802aca:	85 c0                	test   %eax,%eax
+  802acc:	78 19                	js     802ae7 <open+0x75>
+	return fd2num(fd);
+  802ace:	83 ec 0c             	sub    $0xc,%esp
+  802ad1:	ff 75 f4             	push   -0xc(%ebp)
+  802ad4:	e8 d3 f7 ff ff       	call   8022ac <fd2num>
+  802ad9:	89 c3                	mov    %eax,%ebx
+  802adb:	83 c4 10             	add    $0x10,%esp
+}
+  802ade:	89 d8                	mov    %ebx,%eax
+  802ae0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae3:	5b                   	pop    %ebx
+  802ae4:	5e                   	pop    %esi
+  802ae5:	5d                   	pop    %ebp
+  802ae6:	c3                   	ret
+		fd_close(fd, 0);
+  802ae7:	83 ec 08             	sub    $0x8,%esp
+  802aea:	6a 00                	push   $0x0
+  802aec:	ff 75 f4             	push   -0xc(%ebp)
+  802aef:	e8 f8 f8 ff ff       	call   8023ec <fd_close>
+		return r;
+  802af4:	83 c4 10             	add    $0x10,%esp
+  802af7:	eb e5                	jmp    802ade <open+0x6c>
+		return -E_BAD_PATH;
+  802af9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802afe:	eb de                	jmp    802ade <open+0x6c>
+
+00802b00 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802b00:	55                   	push   %ebp
+  802b01:	89 e5                	mov    %esp,%ebp
+  802b03:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b0b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b10:	e8 a6 fd ff ff       	call   8028bb <fsipc>
+}
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802b1d:	68 12 3e 80 00       	push   $0x803e12
+  802b22:	ff 75 0c             	push   0xc(%ebp)
+  802b25:	e8 0c e1 ff ff       	call   800c36 <strcpy>
+	return 0;
+}
+  802b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+
+00802b31 <devsock_close>:
+{
+  802b31:	55                   	push   %ebp
+  802b32:	89 e5                	mov    %esp,%ebp
+  802b34:	53                   	push   %ebx
+  802b35:	83 ec 10             	sub    $0x10,%esp
+  802b38:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802b3b:	53                   	push   %ebx
+  802b3c:	e8 c5 0b 00 00       	call   803706 <pageref>
+  802b41:	89 c2                	mov    %eax,%edx
+  802b43:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b46:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802b4b:	83 fa 01             	cmp    $0x1,%edx
+  802b4e:	74 05                	je     802b55 <devsock_close+0x24>
+}
+  802b50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b53:	c9                   	leave
+  802b54:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802b55:	83 ec 0c             	sub    $0xc,%esp
+  802b58:	ff 73 0c             	push   0xc(%ebx)
+  802b5b:	e8 b7 02 00 00       	call   802e17 <nsipc_close>
+  802b60:	83 c4 10             	add    $0x10,%esp
+  802b63:	eb eb                	jmp    802b50 <devsock_close+0x1f>
+
+00802b65 <devsock_write>:
+{
+  802b65:	55                   	push   %ebp
+  802b66:	89 e5                	mov    %esp,%ebp
+  802b68:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b6b:	6a 00                	push   $0x0
+  802b6d:	ff 75 10             	push   0x10(%ebp)
+  802b70:	ff 75 0c             	push   0xc(%ebp)
+  802b73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b76:	ff 70 0c             	push   0xc(%eax)
+  802b79:	e8 79 03 00 00       	call   802ef7 <nsipc_send>
+}
+  802b7e:	c9                   	leave
+  802b7f:	c3                   	ret
+
+00802b80 <devsock_read>:
+{
+  802b80:	55                   	push   %ebp
+  802b81:	89 e5                	mov    %esp,%ebp
+  802b83:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b86:	6a 00                	push   $0x0
+  802b88:	ff 75 10             	push   0x10(%ebp)
+  802b8b:	ff 75 0c             	push   0xc(%ebp)
+  802b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b91:	ff 70 0c             	push   0xc(%eax)
+  802b94:	e8 ef 02 00 00       	call   802e88 <nsipc_recv>
+}
+  802b99:	c9                   	leave
+  802b9a:	c3                   	ret
+
+00802b9b <fd2sockid>:
+{
+  802b9b:	55                   	push   %ebp
+  802b9c:	89 e5                	mov    %esp,%ebp
+  802b9e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802ba1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ba4:	52                   	push   %edx
+  802ba5:	50                   	push   %eax
+  802ba6:	e8 7e f7 ff ff       	call   802329 <fd_lookup>
+  802bab:	83 c4 10             	add    $0x10,%esp
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	78 10                	js     802bc2 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802bb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bb5:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802bbb:	39 08                	cmp    %ecx,(%eax)
+  802bbd:	75 05                	jne    802bc4 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802bbf:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802bc2:	c9                   	leave
+  802bc3:	c3                   	ret
+		return -E_NOT_SUPP;
+  802bc4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802bc9:	eb f7                	jmp    802bc2 <fd2sockid+0x27>
+
+00802bcb <alloc_sockfd>:
+{
+  802bcb:	55                   	push   %ebp
+  802bcc:	89 e5                	mov    %esp,%ebp
+  802bce:	56                   	push   %esi
+  802bcf:	53                   	push   %ebx
+  802bd0:	83 ec 1c             	sub    $0x1c,%esp
+  802bd3:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802bd5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bd8:	50                   	push   %eax
+  802bd9:	e8 f5 f6 ff ff       	call   8022d3 <fd_alloc>
+  802bde:	89 c3                	mov    %eax,%ebx
+  802be0:	83 c4 10             	add    $0x10,%esp
+  802be3:	85 c0                	test   %eax,%eax
+  802be5:	78 43                	js     802c2a <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802be7:	83 ec 04             	sub    $0x4,%esp
+  802bea:	68 07 04 00 00       	push   $0x407
+  802bef:	ff 75 f4             	push   -0xc(%ebp)
+  802bf2:	6a 00                	push   $0x0
+  802bf4:	e8 35 e5 ff ff       	call   80112e <sys_page_alloc>
+  802bf9:	89 c3                	mov    %eax,%ebx
+  802bfb:	83 c4 10             	add    $0x10,%esp
+  802bfe:	85 c0                	test   %eax,%eax
+  802c00:	78 28                	js     802c2a <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c05:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802c0b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c10:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c17:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c1a:	83 ec 0c             	sub    $0xc,%esp
+  802c1d:	50                   	push   %eax
+  802c1e:	e8 89 f6 ff ff       	call   8022ac <fd2num>
+  802c23:	89 c3                	mov    %eax,%ebx
+  802c25:	83 c4 10             	add    $0x10,%esp
+  802c28:	eb 0c                	jmp    802c36 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c2a:	83 ec 0c             	sub    $0xc,%esp
+  802c2d:	56                   	push   %esi
+  802c2e:	e8 e4 01 00 00       	call   802e17 <nsipc_close>
+		return r;
+  802c33:	83 c4 10             	add    $0x10,%esp
+}
+  802c36:	89 d8                	mov    %ebx,%eax
+  802c38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c3b:	5b                   	pop    %ebx
+  802c3c:	5e                   	pop    %esi
+  802c3d:	5d                   	pop    %ebp
+  802c3e:	c3                   	ret
+
+00802c3f <accept>:
+{
+  802c3f:	55                   	push   %ebp
+  802c40:	89 e5                	mov    %esp,%ebp
+  802c42:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c48:	e8 4e ff ff ff       	call   802b9b <fd2sockid>
+  802c4d:	85 c0                	test   %eax,%eax
+  802c4f:	78 1b                	js     802c6c <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802c51:	83 ec 04             	sub    $0x4,%esp
+  802c54:	ff 75 10             	push   0x10(%ebp)
+  802c57:	ff 75 0c             	push   0xc(%ebp)
+  802c5a:	50                   	push   %eax
+  802c5b:	e8 0e 01 00 00       	call   802d6e <nsipc_accept>
+  802c60:	83 c4 10             	add    $0x10,%esp
+  802c63:	85 c0                	test   %eax,%eax
+  802c65:	78 05                	js     802c6c <accept+0x2d>
+	return alloc_sockfd(r);
+  802c67:	e8 5f ff ff ff       	call   802bcb <alloc_sockfd>
+}
+  802c6c:	c9                   	leave
+  802c6d:	c3                   	ret
+
+00802c6e <bind>:
+{
+  802c6e:	55                   	push   %ebp
+  802c6f:	89 e5                	mov    %esp,%ebp
+  802c71:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c77:	e8 1f ff ff ff       	call   802b9b <fd2sockid>
+  802c7c:	85 c0                	test   %eax,%eax
+  802c7e:	78 12                	js     802c92 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c80:	83 ec 04             	sub    $0x4,%esp
+  802c83:	ff 75 10             	push   0x10(%ebp)
+  802c86:	ff 75 0c             	push   0xc(%ebp)
+  802c89:	50                   	push   %eax
+  802c8a:	e8 31 01 00 00       	call   802dc0 <nsipc_bind>
+  802c8f:	83 c4 10             	add    $0x10,%esp
+}
+  802c92:	c9                   	leave
+  802c93:	c3                   	ret
+
+00802c94 <shutdown>:
+{
+  802c94:	55                   	push   %ebp
+  802c95:	89 e5                	mov    %esp,%ebp
+  802c97:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9d:	e8 f9 fe ff ff       	call   802b9b <fd2sockid>
+  802ca2:	85 c0                	test   %eax,%eax
+  802ca4:	78 0f                	js     802cb5 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802ca6:	83 ec 08             	sub    $0x8,%esp
+  802ca9:	ff 75 0c             	push   0xc(%ebp)
+  802cac:	50                   	push   %eax
+  802cad:	e8 43 01 00 00       	call   802df5 <nsipc_shutdown>
+  802cb2:	83 c4 10             	add    $0x10,%esp
+}
+  802cb5:	c9                   	leave
+  802cb6:	c3                   	ret
+
+00802cb7 <connect>:
+{
+  802cb7:	55                   	push   %ebp
+  802cb8:	89 e5                	mov    %esp,%ebp
+  802cba:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc0:	e8 d6 fe ff ff       	call   802b9b <fd2sockid>
+  802cc5:	85 c0                	test   %eax,%eax
+  802cc7:	78 12                	js     802cdb <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802cc9:	83 ec 04             	sub    $0x4,%esp
+  802ccc:	ff 75 10             	push   0x10(%ebp)
+  802ccf:	ff 75 0c             	push   0xc(%ebp)
+  802cd2:	50                   	push   %eax
+  802cd3:	e8 59 01 00 00       	call   802e31 <nsipc_connect>
+  802cd8:	83 c4 10             	add    $0x10,%esp
+}
+  802cdb:	c9                   	leave
+  802cdc:	c3                   	ret
+
+00802cdd <listen>:
+{
+  802cdd:	55                   	push   %ebp
+  802cde:	89 e5                	mov    %esp,%ebp
+  802ce0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce6:	e8 b0 fe ff ff       	call   802b9b <fd2sockid>
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	78 0f                	js     802cfe <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802cef:	83 ec 08             	sub    $0x8,%esp
+  802cf2:	ff 75 0c             	push   0xc(%ebp)
+  802cf5:	50                   	push   %eax
+  802cf6:	e8 6b 01 00 00       	call   802e66 <nsipc_listen>
+  802cfb:	83 c4 10             	add    $0x10,%esp
+}
+  802cfe:	c9                   	leave
+  802cff:	c3                   	ret
+
+00802d00 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d00:	55                   	push   %ebp
+  802d01:	89 e5                	mov    %esp,%ebp
+  802d03:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d06:	ff 75 10             	push   0x10(%ebp)
+  802d09:	ff 75 0c             	push   0xc(%ebp)
+  802d0c:	ff 75 08             	push   0x8(%ebp)
+  802d0f:	e8 41 02 00 00       	call   802f55 <nsipc_socket>
+  802d14:	83 c4 10             	add    $0x10,%esp
+  802d17:	85 c0                	test   %eax,%eax
+  802d19:	78 05                	js     802d20 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d1b:	e8 ab fe ff ff       	call   802bcb <alloc_sockfd>
+}
+  802d20:	c9                   	leave
+  802d21:	c3                   	ret
+
+00802d22 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d22:	55                   	push   %ebp
+  802d23:	89 e5                	mov    %esp,%ebp
+  802d25:	53                   	push   %ebx
+  802d26:	83 ec 04             	sub    $0x4,%esp
+  802d29:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802d2b:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802d32:	74 26                	je     802d5a <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802d34:	6a 07                	push   $0x7
+  802d36:	68 00 70 80 00       	push   $0x807000
+  802d3b:	53                   	push   %ebx
+  802d3c:	ff 35 04 50 80 00    	push   0x805004
+  802d42:	e8 2c 09 00 00       	call   803673 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802d47:	83 c4 0c             	add    $0xc,%esp
+  802d4a:	6a 00                	push   $0x0
+  802d4c:	6a 00                	push   $0x0
+  802d4e:	6a 00                	push   $0x0
+  802d50:	e8 06 09 00 00       	call   80365b <ipc_recv>
+}
+  802d55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d58:	c9                   	leave
+  802d59:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d5a:	83 ec 0c             	sub    $0xc,%esp
+  802d5d:	6a 02                	push   $0x2
+  802d5f:	e8 63 09 00 00       	call   8036c7 <ipc_find_env>
+  802d64:	a3 04 50 80 00       	mov    %eax,0x805004
+  802d69:	83 c4 10             	add    $0x10,%esp
+  802d6c:	eb c6                	jmp    802d34 <nsipc+0x12>
+
+00802d6e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d6e:	55                   	push   %ebp
+  802d6f:	89 e5                	mov    %esp,%ebp
+  802d71:	56                   	push   %esi
+  802d72:	53                   	push   %ebx
+  802d73:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d76:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d79:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d7e:	8b 06                	mov    (%esi),%eax
+  802d80:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d85:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d8a:	e8 93 ff ff ff       	call   802d22 <nsipc>
+  802d8f:	89 c3                	mov    %eax,%ebx
+  802d91:	85 c0                	test   %eax,%eax
+  802d93:	79 09                	jns    802d9e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d95:	89 d8                	mov    %ebx,%eax
+  802d97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d9a:	5b                   	pop    %ebx
+  802d9b:	5e                   	pop    %esi
+  802d9c:	5d                   	pop    %ebp
+  802d9d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d9e:	83 ec 04             	sub    $0x4,%esp
+  802da1:	ff 35 10 70 80 00    	push   0x807010
+  802da7:	68 00 70 80 00       	push   $0x807000
+  802dac:	ff 75 0c             	push   0xc(%ebp)
+  802daf:	e8 08 e0 ff ff       	call   800dbc <memmove>
+		*addrlen = ret->ret_addrlen;
+  802db4:	a1 10 70 80 00       	mov    0x807010,%eax
+  802db9:	89 06                	mov    %eax,(%esi)
+  802dbb:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802dbe:	eb d5                	jmp    802d95 <nsipc_accept+0x27>
+
+00802dc0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802dc0:	55                   	push   %ebp
+  802dc1:	89 e5                	mov    %esp,%ebp
+  802dc3:	53                   	push   %ebx
+  802dc4:	83 ec 08             	sub    $0x8,%esp
+  802dc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802dca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dcd:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802dd2:	53                   	push   %ebx
+  802dd3:	ff 75 0c             	push   0xc(%ebp)
+  802dd6:	68 04 70 80 00       	push   $0x807004
+  802ddb:	e8 dc df ff ff       	call   800dbc <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802de0:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802de6:	b8 02 00 00 00       	mov    $0x2,%eax
+  802deb:	e8 32 ff ff ff       	call   802d22 <nsipc>
+}
+  802df0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802df3:	c9                   	leave
+  802df4:	c3                   	ret
+
+00802df5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802df5:	55                   	push   %ebp
+  802df6:	89 e5                	mov    %esp,%ebp
+  802df8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802dfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dfe:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802e03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e06:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e0b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e10:	e8 0d ff ff ff       	call   802d22 <nsipc>
+}
+  802e15:	c9                   	leave
+  802e16:	c3                   	ret
+
+00802e17 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e17:	55                   	push   %ebp
+  802e18:	89 e5                	mov    %esp,%ebp
+  802e1a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e20:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802e25:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e2a:	e8 f3 fe ff ff       	call   802d22 <nsipc>
+}
+  802e2f:	c9                   	leave
+  802e30:	c3                   	ret
+
+00802e31 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e31:	55                   	push   %ebp
+  802e32:	89 e5                	mov    %esp,%ebp
+  802e34:	53                   	push   %ebx
+  802e35:	83 ec 08             	sub    $0x8,%esp
+  802e38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e3e:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e43:	53                   	push   %ebx
+  802e44:	ff 75 0c             	push   0xc(%ebp)
+  802e47:	68 04 70 80 00       	push   $0x807004
+  802e4c:	e8 6b df ff ff       	call   800dbc <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802e51:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802e57:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e5c:	e8 c1 fe ff ff       	call   802d22 <nsipc>
+}
+  802e61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e64:	c9                   	leave
+  802e65:	c3                   	ret
+
+00802e66 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e66:	55                   	push   %ebp
+  802e67:	89 e5                	mov    %esp,%ebp
+  802e69:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e6f:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e74:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e77:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802e7c:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e81:	e8 9c fe ff ff       	call   802d22 <nsipc>
+}
+  802e86:	c9                   	leave
+  802e87:	c3                   	ret
+
+00802e88 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e88:	55                   	push   %ebp
+  802e89:	89 e5                	mov    %esp,%ebp
+  802e8b:	56                   	push   %esi
+  802e8c:	53                   	push   %ebx
+  802e8d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e93:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802e98:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802e9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ea1:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802ea6:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eab:	e8 72 fe ff ff       	call   802d22 <nsipc>
+  802eb0:	89 c3                	mov    %eax,%ebx
+  802eb2:	85 c0                	test   %eax,%eax
+  802eb4:	78 22                	js     802ed8 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802eb6:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ebb:	39 c6                	cmp    %eax,%esi
+  802ebd:	0f 4e c6             	cmovle %esi,%eax
+  802ec0:	39 c3                	cmp    %eax,%ebx
+  802ec2:	7f 1d                	jg     802ee1 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ec4:	83 ec 04             	sub    $0x4,%esp
+  802ec7:	53                   	push   %ebx
+  802ec8:	68 00 70 80 00       	push   $0x807000
+  802ecd:	ff 75 0c             	push   0xc(%ebp)
+  802ed0:	e8 e7 de ff ff       	call   800dbc <memmove>
+  802ed5:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802ed8:	89 d8                	mov    %ebx,%eax
+  802eda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802edd:	5b                   	pop    %ebx
+  802ede:	5e                   	pop    %esi
+  802edf:	5d                   	pop    %ebp
+  802ee0:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802ee1:	68 1e 3e 80 00       	push   $0x803e1e
+  802ee6:	68 57 38 80 00       	push   $0x803857
+  802eeb:	6a 62                	push   $0x62
+  802eed:	68 33 3e 80 00       	push   $0x803e33
+  802ef2:	e8 1c d6 ff ff       	call   800513 <_panic>
+
+00802ef7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ef7:	55                   	push   %ebp
+  802ef8:	89 e5                	mov    %esp,%ebp
+  802efa:	53                   	push   %ebx
+  802efb:	83 ec 04             	sub    $0x4,%esp
+  802efe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f01:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f04:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802f09:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f0f:	7f 2e                	jg     802f3f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f11:	83 ec 04             	sub    $0x4,%esp
+  802f14:	53                   	push   %ebx
+  802f15:	ff 75 0c             	push   0xc(%ebp)
+  802f18:	68 0c 70 80 00       	push   $0x80700c
+  802f1d:	e8 9a de ff ff       	call   800dbc <memmove>
+	nsipcbuf.send.req_size = size;
+  802f22:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802f28:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802f30:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f35:	e8 e8 fd ff ff       	call   802d22 <nsipc>
+}
+  802f3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f3d:	c9                   	leave
+  802f3e:	c3                   	ret
+	assert(size < 1600);
+  802f3f:	68 3f 3e 80 00       	push   $0x803e3f
+  802f44:	68 57 38 80 00       	push   $0x803857
+  802f49:	6a 6d                	push   $0x6d
+  802f4b:	68 33 3e 80 00       	push   $0x803e33
+  802f50:	e8 be d5 ff ff       	call   800513 <_panic>
+
+00802f55 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f55:	55                   	push   %ebp
+  802f56:	89 e5                	mov    %esp,%ebp
+  802f58:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f5e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802f63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f66:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f6b:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f6e:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802f73:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f78:	e8 a5 fd ff ff       	call   802d22 <nsipc>
+}
+  802f7d:	c9                   	leave
+  802f7e:	c3                   	ret
+
+00802f7f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f7f:	55                   	push   %ebp
+  802f80:	89 e5                	mov    %esp,%ebp
+  802f82:	56                   	push   %esi
+  802f83:	53                   	push   %ebx
+  802f84:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f87:	83 ec 0c             	sub    $0xc,%esp
+  802f8a:	ff 75 08             	push   0x8(%ebp)
+  802f8d:	e8 2a f3 ff ff       	call   8022bc <fd2data>
+  802f92:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f94:	83 c4 08             	add    $0x8,%esp
+  802f97:	68 4b 3e 80 00       	push   $0x803e4b
+  802f9c:	53                   	push   %ebx
+  802f9d:	e8 94 dc ff ff       	call   800c36 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802fa2:	8b 46 04             	mov    0x4(%esi),%eax
+  802fa5:	2b 06                	sub    (%esi),%eax
+  802fa7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802fad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fb4:	00 00 00 
+	stat->st_dev = &devpipe;
+  802fb7:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802fbe:	40 80 00 
+	return 0;
+}
+  802fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fc9:	5b                   	pop    %ebx
+  802fca:	5e                   	pop    %esi
+  802fcb:	5d                   	pop    %ebp
+  802fcc:	c3                   	ret
+
+00802fcd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802fcd:	55                   	push   %ebp
+  802fce:	89 e5                	mov    %esp,%ebp
+  802fd0:	53                   	push   %ebx
+  802fd1:	83 ec 0c             	sub    $0xc,%esp
+  802fd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802fd7:	53                   	push   %ebx
+  802fd8:	6a 00                	push   $0x0
+  802fda:	e8 2a e2 ff ff       	call   801209 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802fdf:	89 1c 24             	mov    %ebx,(%esp)
+  802fe2:	e8 d5 f2 ff ff       	call   8022bc <fd2data>
+  802fe7:	83 c4 08             	add    $0x8,%esp
+  802fea:	50                   	push   %eax
+  802feb:	6a 00                	push   $0x0
+  802fed:	e8 17 e2 ff ff       	call   801209 <sys_page_unmap>
+}
+  802ff2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ff5:	c9                   	leave
+  802ff6:	c3                   	ret
+
+00802ff7 <_pipeisclosed>:
+{
+  802ff7:	55                   	push   %ebp
+  802ff8:	89 e5                	mov    %esp,%ebp
+  802ffa:	57                   	push   %edi
+  802ffb:	56                   	push   %esi
+  802ffc:	53                   	push   %ebx
+  802ffd:	83 ec 1c             	sub    $0x1c,%esp
+  803000:	89 c7                	mov    %eax,%edi
+  803002:	89 d6                	mov    %edx,%esi
+  803004:	eb 3c                	jmp    803042 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  803006:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  803009:	83 ec 0c             	sub    $0xc,%esp
+  80300c:	57                   	push   %edi
+  80300d:	e8 f4 06 00 00       	call   803706 <pageref>
+  803012:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803015:	89 34 24             	mov    %esi,(%esp)
+  803018:	e8 e9 06 00 00       	call   803706 <pageref>
+  80301d:	89 c2                	mov    %eax,%edx
+  80301f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803021:	05 00 00 00 20       	add    $0x20000000,%eax
+  803026:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  803029:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80302f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803034:	76 31                	jbe    803067 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  803036:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  803039:	39 c3                	cmp    %eax,%ebx
+  80303b:	74 76                	je     8030b3 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80303d:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  803040:	74 36                	je     803078 <_pipeisclosed+0x81>
+  803042:	89 e0                	mov    %esp,%eax
+  803044:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803049:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80304f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803054:	77 b0                	ja     803006 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803056:	c1 e8 10             	shr    $0x10,%eax
+  803059:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80305f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803065:	eb 9f                	jmp    803006 <_pipeisclosed+0xf>
+  803067:	c1 e8 10             	shr    $0x10,%eax
+  80306a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803070:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  803076:	eb be                	jmp    803036 <_pipeisclosed+0x3f>
+  803078:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80307a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80307f:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803085:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80308a:	76 16                	jbe    8030a2 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80308c:	8b 42 58             	mov    0x58(%edx),%eax
+  80308f:	6a 01                	push   $0x1
+  803091:	50                   	push   %eax
+  803092:	53                   	push   %ebx
+  803093:	68 52 3e 80 00       	push   $0x803e52
+  803098:	e8 51 d5 ff ff       	call   8005ee <cprintf>
+  80309d:	83 c4 10             	add    $0x10,%esp
+  8030a0:	eb a0                	jmp    803042 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8030a2:	c1 e8 10             	shr    $0x10,%eax
+  8030a5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8030ab:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8030b1:	eb d9                	jmp    80308c <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8030b3:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8030b6:	0f 94 c0             	sete   %al
+  8030b9:	0f b6 c0             	movzbl %al,%eax
+}
+  8030bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030bf:	5b                   	pop    %ebx
+  8030c0:	5e                   	pop    %esi
+  8030c1:	5f                   	pop    %edi
+  8030c2:	5d                   	pop    %ebp
+  8030c3:	c3                   	ret
+
+008030c4 <devpipe_write>:
+{
+  8030c4:	55                   	push   %ebp
+  8030c5:	89 e5                	mov    %esp,%ebp
+  8030c7:	57                   	push   %edi
+  8030c8:	56                   	push   %esi
+  8030c9:	53                   	push   %ebx
+  8030ca:	83 ec 28             	sub    $0x28,%esp
+  8030cd:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8030d0:	56                   	push   %esi
+  8030d1:	e8 e6 f1 ff ff       	call   8022bc <fd2data>
+  8030d6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030d8:	83 c4 10             	add    $0x10,%esp
+  8030db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8030e3:	75 09                	jne    8030ee <devpipe_write+0x2a>
+	return i;
+  8030e5:	89 f8                	mov    %edi,%eax
+  8030e7:	eb 23                	jmp    80310c <devpipe_write+0x48>
+			sys_yield();
+  8030e9:	e8 fa df ff ff       	call   8010e8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8030ee:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030f1:	8b 0b                	mov    (%ebx),%ecx
+  8030f3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030f6:	39 d0                	cmp    %edx,%eax
+  8030f8:	72 1a                	jb     803114 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8030fa:	89 da                	mov    %ebx,%edx
+  8030fc:	89 f0                	mov    %esi,%eax
+  8030fe:	e8 f4 fe ff ff       	call   802ff7 <_pipeisclosed>
+  803103:	85 c0                	test   %eax,%eax
+  803105:	74 e2                	je     8030e9 <devpipe_write+0x25>
+				return 0;
+  803107:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80310c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80310f:	5b                   	pop    %ebx
+  803110:	5e                   	pop    %esi
+  803111:	5f                   	pop    %edi
+  803112:	5d                   	pop    %ebp
+  803113:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803114:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803117:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80311b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80311e:	89 c2                	mov    %eax,%edx
+  803120:	c1 fa 1f             	sar    $0x1f,%edx
+  803123:	89 d1                	mov    %edx,%ecx
+  803125:	c1 e9 1b             	shr    $0x1b,%ecx
+  803128:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80312b:	83 e2 1f             	and    $0x1f,%edx
+  80312e:	29 ca                	sub    %ecx,%edx
+  803130:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803134:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803138:	83 c0 01             	add    $0x1,%eax
+  80313b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80313e:	83 c7 01             	add    $0x1,%edi
+  803141:	eb 9d                	jmp    8030e0 <devpipe_write+0x1c>
+
+00803143 <devpipe_read>:
+{
+  803143:	55                   	push   %ebp
+  803144:	89 e5                	mov    %esp,%ebp
+  803146:	57                   	push   %edi
+  803147:	56                   	push   %esi
+  803148:	53                   	push   %ebx
+  803149:	83 ec 18             	sub    $0x18,%esp
+  80314c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80314f:	57                   	push   %edi
+  803150:	e8 67 f1 ff ff       	call   8022bc <fd2data>
+  803155:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803157:	83 c4 10             	add    $0x10,%esp
+  80315a:	be 00 00 00 00       	mov    $0x0,%esi
+  80315f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803162:	75 13                	jne    803177 <devpipe_read+0x34>
+	return i;
+  803164:	89 f0                	mov    %esi,%eax
+  803166:	eb 02                	jmp    80316a <devpipe_read+0x27>
+				return i;
+  803168:	89 f0                	mov    %esi,%eax
+}
+  80316a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80316d:	5b                   	pop    %ebx
+  80316e:	5e                   	pop    %esi
+  80316f:	5f                   	pop    %edi
+  803170:	5d                   	pop    %ebp
+  803171:	c3                   	ret
+			sys_yield();
+  803172:	e8 71 df ff ff       	call   8010e8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803177:	8b 03                	mov    (%ebx),%eax
+  803179:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80317c:	75 18                	jne    803196 <devpipe_read+0x53>
+			if (i > 0)
+  80317e:	85 f6                	test   %esi,%esi
+  803180:	75 e6                	jne    803168 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803182:	89 da                	mov    %ebx,%edx
+  803184:	89 f8                	mov    %edi,%eax
+  803186:	e8 6c fe ff ff       	call   802ff7 <_pipeisclosed>
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	74 e3                	je     803172 <devpipe_read+0x2f>
+				return 0;
+  80318f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803194:	eb d4                	jmp    80316a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803196:	99                   	cltd
+  803197:	c1 ea 1b             	shr    $0x1b,%edx
+  80319a:	01 d0                	add    %edx,%eax
+  80319c:	83 e0 1f             	and    $0x1f,%eax
+  80319f:	29 d0                	sub    %edx,%eax
+  8031a1:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8031a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031a9:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8031ac:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8031af:	83 c6 01             	add    $0x1,%esi
+  8031b2:	eb ab                	jmp    80315f <devpipe_read+0x1c>
+
+008031b4 <pipe>:
+{
+  8031b4:	55                   	push   %ebp
+  8031b5:	89 e5                	mov    %esp,%ebp
+  8031b7:	56                   	push   %esi
+  8031b8:	53                   	push   %ebx
+  8031b9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031bf:	50                   	push   %eax
+  8031c0:	e8 0e f1 ff ff       	call   8022d3 <fd_alloc>
+  8031c5:	89 c3                	mov    %eax,%ebx
+  8031c7:	83 c4 10             	add    $0x10,%esp
+  8031ca:	85 c0                	test   %eax,%eax
+  8031cc:	0f 88 23 01 00 00    	js     8032f5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031d2:	83 ec 04             	sub    $0x4,%esp
+  8031d5:	68 07 04 00 00       	push   $0x407
+  8031da:	ff 75 f4             	push   -0xc(%ebp)
+  8031dd:	6a 00                	push   $0x0
+  8031df:	e8 4a df ff ff       	call   80112e <sys_page_alloc>
+  8031e4:	89 c3                	mov    %eax,%ebx
+  8031e6:	83 c4 10             	add    $0x10,%esp
+  8031e9:	85 c0                	test   %eax,%eax
+  8031eb:	0f 88 04 01 00 00    	js     8032f5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031f1:	83 ec 0c             	sub    $0xc,%esp
+  8031f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031f7:	50                   	push   %eax
+  8031f8:	e8 d6 f0 ff ff       	call   8022d3 <fd_alloc>
+  8031fd:	89 c3                	mov    %eax,%ebx
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	85 c0                	test   %eax,%eax
+  803204:	0f 88 db 00 00 00    	js     8032e5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80320a:	83 ec 04             	sub    $0x4,%esp
+  80320d:	68 07 04 00 00       	push   $0x407
+  803212:	ff 75 f0             	push   -0x10(%ebp)
+  803215:	6a 00                	push   $0x0
+  803217:	e8 12 df ff ff       	call   80112e <sys_page_alloc>
+  80321c:	89 c3                	mov    %eax,%ebx
+  80321e:	83 c4 10             	add    $0x10,%esp
+  803221:	85 c0                	test   %eax,%eax
+  803223:	0f 88 bc 00 00 00    	js     8032e5 <pipe+0x131>
+	va = fd2data(fd0);
+  803229:	83 ec 0c             	sub    $0xc,%esp
+  80322c:	ff 75 f4             	push   -0xc(%ebp)
+  80322f:	e8 88 f0 ff ff       	call   8022bc <fd2data>
+  803234:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803236:	83 c4 0c             	add    $0xc,%esp
+  803239:	68 07 04 00 00       	push   $0x407
+  80323e:	50                   	push   %eax
+  80323f:	6a 00                	push   $0x0
+  803241:	e8 e8 de ff ff       	call   80112e <sys_page_alloc>
+  803246:	89 c3                	mov    %eax,%ebx
+  803248:	83 c4 10             	add    $0x10,%esp
+  80324b:	85 c0                	test   %eax,%eax
+  80324d:	0f 88 82 00 00 00    	js     8032d5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803253:	83 ec 0c             	sub    $0xc,%esp
+  803256:	ff 75 f0             	push   -0x10(%ebp)
+  803259:	e8 5e f0 ff ff       	call   8022bc <fd2data>
+  80325e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803265:	50                   	push   %eax
+  803266:	6a 00                	push   $0x0
+  803268:	56                   	push   %esi
+  803269:	6a 00                	push   $0x0
+  80326b:	e8 2b df ff ff       	call   80119b <sys_page_map>
+  803270:	89 c3                	mov    %eax,%ebx
+  803272:	83 c4 20             	add    $0x20,%esp
+  803275:	85 c0                	test   %eax,%eax
+  803277:	78 4e                	js     8032c7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803279:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80327e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803281:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803283:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803286:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80328d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803290:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803292:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803295:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80329c:	83 ec 0c             	sub    $0xc,%esp
+  80329f:	ff 75 f4             	push   -0xc(%ebp)
+  8032a2:	e8 05 f0 ff ff       	call   8022ac <fd2num>
+  8032a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032aa:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032ac:	83 c4 04             	add    $0x4,%esp
+  8032af:	ff 75 f0             	push   -0x10(%ebp)
+  8032b2:	e8 f5 ef ff ff       	call   8022ac <fd2num>
+  8032b7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032ba:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032bd:	83 c4 10             	add    $0x10,%esp
+  8032c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032c5:	eb 2e                	jmp    8032f5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032c7:	83 ec 08             	sub    $0x8,%esp
+  8032ca:	56                   	push   %esi
+  8032cb:	6a 00                	push   $0x0
+  8032cd:	e8 37 df ff ff       	call   801209 <sys_page_unmap>
+  8032d2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8032d5:	83 ec 08             	sub    $0x8,%esp
+  8032d8:	ff 75 f0             	push   -0x10(%ebp)
+  8032db:	6a 00                	push   $0x0
+  8032dd:	e8 27 df ff ff       	call   801209 <sys_page_unmap>
+  8032e2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8032e5:	83 ec 08             	sub    $0x8,%esp
+  8032e8:	ff 75 f4             	push   -0xc(%ebp)
+  8032eb:	6a 00                	push   $0x0
+  8032ed:	e8 17 df ff ff       	call   801209 <sys_page_unmap>
+  8032f2:	83 c4 10             	add    $0x10,%esp
+}
+  8032f5:	89 d8                	mov    %ebx,%eax
+  8032f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032fa:	5b                   	pop    %ebx
+  8032fb:	5e                   	pop    %esi
+  8032fc:	5d                   	pop    %ebp
+  8032fd:	c3                   	ret
+
+008032fe <pipeisclosed>:
+{
+  8032fe:	55                   	push   %ebp
+  8032ff:	89 e5                	mov    %esp,%ebp
+  803301:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803304:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803307:	50                   	push   %eax
+  803308:	ff 75 08             	push   0x8(%ebp)
+  80330b:	e8 19 f0 ff ff       	call   802329 <fd_lookup>
+  803310:	83 c4 10             	add    $0x10,%esp
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 18                	js     80332f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803317:	83 ec 0c             	sub    $0xc,%esp
+  80331a:	ff 75 f4             	push   -0xc(%ebp)
+  80331d:	e8 9a ef ff ff       	call   8022bc <fd2data>
+  803322:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803324:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803327:	e8 cb fc ff ff       	call   802ff7 <_pipeisclosed>
+  80332c:	83 c4 10             	add    $0x10,%esp
+}
+  80332f:	c9                   	leave
+  803330:	c3                   	ret
+
+00803331 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803331:	55                   	push   %ebp
+  803332:	89 e5                	mov    %esp,%ebp
+  803334:	56                   	push   %esi
+  803335:	53                   	push   %ebx
+  803336:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803339:	85 f6                	test   %esi,%esi
+  80333b:	74 16                	je     803353 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  80333d:	89 f3                	mov    %esi,%ebx
+  80333f:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803345:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  80334b:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803351:	eb 1b                	jmp    80336e <wait+0x3d>
+	assert(envid != 0);
+  803353:	68 6a 3e 80 00       	push   $0x803e6a
+  803358:	68 57 38 80 00       	push   $0x803857
+  80335d:	6a 09                	push   $0x9
+  80335f:	68 75 3e 80 00       	push   $0x803e75
+  803364:	e8 aa d1 ff ff       	call   800513 <_panic>
+		sys_yield();
+  803369:	e8 7a dd ff ff       	call   8010e8 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80336e:	8b 43 48             	mov    0x48(%ebx),%eax
+  803371:	39 f0                	cmp    %esi,%eax
+  803373:	75 07                	jne    80337c <wait+0x4b>
+  803375:	8b 43 54             	mov    0x54(%ebx),%eax
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	75 ed                	jne    803369 <wait+0x38>
+}
+  80337c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80337f:	5b                   	pop    %ebx
+  803380:	5e                   	pop    %esi
+  803381:	5d                   	pop    %ebp
+  803382:	c3                   	ret
+
+00803383 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803383:	b8 00 00 00 00       	mov    $0x0,%eax
+  803388:	c3                   	ret
+
+00803389 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803389:	55                   	push   %ebp
+  80338a:	89 e5                	mov    %esp,%ebp
+  80338c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80338f:	68 80 3e 80 00       	push   $0x803e80
+  803394:	ff 75 0c             	push   0xc(%ebp)
+  803397:	e8 9a d8 ff ff       	call   800c36 <strcpy>
+	return 0;
+}
+  80339c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a1:	c9                   	leave
+  8033a2:	c3                   	ret
+
+008033a3 <devcons_write>:
+{
+  8033a3:	55                   	push   %ebp
+  8033a4:	89 e5                	mov    %esp,%ebp
+  8033a6:	57                   	push   %edi
+  8033a7:	56                   	push   %esi
+  8033a8:	53                   	push   %ebx
+  8033a9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8033af:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8033b4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8033ba:	eb 2e                	jmp    8033ea <devcons_write+0x47>
+		m = n - tot;
+  8033bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033bf:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8033c1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033c6:	39 c3                	cmp    %eax,%ebx
+  8033c8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8033cb:	83 ec 04             	sub    $0x4,%esp
+  8033ce:	53                   	push   %ebx
+  8033cf:	89 f0                	mov    %esi,%eax
+  8033d1:	03 45 0c             	add    0xc(%ebp),%eax
+  8033d4:	50                   	push   %eax
+  8033d5:	57                   	push   %edi
+  8033d6:	e8 e1 d9 ff ff       	call   800dbc <memmove>
+		sys_cputs(buf, m);
+  8033db:	83 c4 08             	add    $0x8,%esp
+  8033de:	53                   	push   %ebx
+  8033df:	57                   	push   %edi
+  8033e0:	e8 ca db ff ff       	call   800faf <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8033e5:	01 de                	add    %ebx,%esi
+  8033e7:	83 c4 10             	add    $0x10,%esp
+  8033ea:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8033ed:	72 cd                	jb     8033bc <devcons_write+0x19>
+}
+  8033ef:	89 f0                	mov    %esi,%eax
+  8033f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033f4:	5b                   	pop    %ebx
+  8033f5:	5e                   	pop    %esi
+  8033f6:	5f                   	pop    %edi
+  8033f7:	5d                   	pop    %ebp
+  8033f8:	c3                   	ret
+
+008033f9 <devcons_read>:
+{
+  8033f9:	55                   	push   %ebp
+  8033fa:	89 e5                	mov    %esp,%ebp
+  8033fc:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8033ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803404:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803408:	75 07                	jne    803411 <devcons_read+0x18>
+  80340a:	eb 1f                	jmp    80342b <devcons_read+0x32>
+		sys_yield();
+  80340c:	e8 d7 dc ff ff       	call   8010e8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803411:	e8 dd db ff ff       	call   800ff3 <sys_cgetc>
+  803416:	85 c0                	test   %eax,%eax
+  803418:	74 f2                	je     80340c <devcons_read+0x13>
+	if (c < 0)
+  80341a:	78 0f                	js     80342b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80341c:	83 f8 04             	cmp    $0x4,%eax
+  80341f:	74 0c                	je     80342d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803421:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803424:	88 02                	mov    %al,(%edx)
+	return 1;
+  803426:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80342b:	c9                   	leave
+  80342c:	c3                   	ret
+		return 0;
+  80342d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803432:	eb f7                	jmp    80342b <devcons_read+0x32>
+
+00803434 <cputchar>:
+{
+  803434:	55                   	push   %ebp
+  803435:	89 e5                	mov    %esp,%ebp
+  803437:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80343a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80343d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803440:	6a 01                	push   $0x1
+  803442:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803445:	50                   	push   %eax
+  803446:	e8 64 db ff ff       	call   800faf <sys_cputs>
+}
+  80344b:	83 c4 10             	add    $0x10,%esp
+  80344e:	c9                   	leave
+  80344f:	c3                   	ret
+
+00803450 <getchar>:
+{
+  803450:	55                   	push   %ebp
+  803451:	89 e5                	mov    %esp,%ebp
+  803453:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803456:	6a 01                	push   $0x1
+  803458:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80345b:	50                   	push   %eax
+  80345c:	6a 00                	push   $0x0
+  80345e:	e8 4c f1 ff ff       	call   8025af <read>
+	if (r < 0)
+  803463:	83 c4 10             	add    $0x10,%esp
+  803466:	85 c0                	test   %eax,%eax
+  803468:	78 06                	js     803470 <getchar+0x20>
+	if (r < 1)
+  80346a:	74 06                	je     803472 <getchar+0x22>
+	return c;
+  80346c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803470:	c9                   	leave
+  803471:	c3                   	ret
+		return -E_EOF;
+  803472:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803477:	eb f7                	jmp    803470 <getchar+0x20>
+
+00803479 <iscons>:
+{
+  803479:	55                   	push   %ebp
+  80347a:	89 e5                	mov    %esp,%ebp
+  80347c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80347f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803482:	50                   	push   %eax
+  803483:	ff 75 08             	push   0x8(%ebp)
+  803486:	e8 9e ee ff ff       	call   802329 <fd_lookup>
+  80348b:	83 c4 10             	add    $0x10,%esp
+  80348e:	85 c0                	test   %eax,%eax
+  803490:	78 11                	js     8034a3 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803492:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803495:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80349b:	39 10                	cmp    %edx,(%eax)
+  80349d:	0f 94 c0             	sete   %al
+  8034a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8034a3:	c9                   	leave
+  8034a4:	c3                   	ret
+
+008034a5 <opencons>:
+{
+  8034a5:	55                   	push   %ebp
+  8034a6:	89 e5                	mov    %esp,%ebp
+  8034a8:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8034ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034ae:	50                   	push   %eax
+  8034af:	e8 1f ee ff ff       	call   8022d3 <fd_alloc>
+  8034b4:	83 c4 10             	add    $0x10,%esp
+  8034b7:	85 c0                	test   %eax,%eax
+  8034b9:	78 3a                	js     8034f5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034bb:	83 ec 04             	sub    $0x4,%esp
+  8034be:	68 07 04 00 00       	push   $0x407
+  8034c3:	ff 75 f4             	push   -0xc(%ebp)
+  8034c6:	6a 00                	push   $0x0
+  8034c8:	e8 61 dc ff ff       	call   80112e <sys_page_alloc>
+  8034cd:	83 c4 10             	add    $0x10,%esp
+  8034d0:	85 c0                	test   %eax,%eax
+  8034d2:	78 21                	js     8034f5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8034d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034d7:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8034dd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8034df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034e2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8034e9:	83 ec 0c             	sub    $0xc,%esp
+  8034ec:	50                   	push   %eax
+  8034ed:	e8 ba ed ff ff       	call   8022ac <fd2num>
+  8034f2:	83 c4 10             	add    $0x10,%esp
+}
+  8034f5:	c9                   	leave
+  8034f6:	c3                   	ret
+
+008034f7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8034f7:	55                   	push   %ebp
+  8034f8:	89 e5                	mov    %esp,%ebp
+  8034fa:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8034fd:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803504:	74 0a                	je     803510 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803506:	8b 45 08             	mov    0x8(%ebp),%eax
+  803509:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80350e:	c9                   	leave
+  80350f:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803510:	83 ec 04             	sub    $0x4,%esp
+  803513:	6a 07                	push   $0x7
+  803515:	68 00 f0 bf ee       	push   $0xeebff000
+  80351a:	6a 00                	push   $0x0
+  80351c:	e8 0d dc ff ff       	call   80112e <sys_page_alloc>
+  803521:	83 c4 10             	add    $0x10,%esp
+  803524:	85 c0                	test   %eax,%eax
+  803526:	78 14                	js     80353c <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803528:	83 ec 08             	sub    $0x8,%esp
+  80352b:	68 5e 35 80 00       	push   $0x80355e
+  803530:	6a 00                	push   $0x0
+  803532:	e8 13 de ff ff       	call   80134a <sys_env_set_pgfault_upcall>
+  803537:	83 c4 10             	add    $0x10,%esp
+  80353a:	eb ca                	jmp    803506 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  80353c:	83 ec 08             	sub    $0x8,%esp
+  80353f:	50                   	push   %eax
+  803540:	68 8c 3e 80 00       	push   $0x803e8c
+  803545:	e8 a4 d0 ff ff       	call   8005ee <cprintf>
+			panic("set_pgfault_handler error");
+  80354a:	83 c4 0c             	add    $0xc,%esp
+  80354d:	68 97 3e 80 00       	push   $0x803e97
+  803552:	6a 24                	push   $0x24
+  803554:	68 b1 3e 80 00       	push   $0x803eb1
+  803559:	e8 b5 cf ff ff       	call   800513 <_panic>
+
+0080355e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80355e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80355f:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803564:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803566:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803569:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80356d:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803570:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803574:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803576:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  80357a:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  80357b:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  80357f:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803580:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803581:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803585:	c3                   	ret
+
+00803586 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  803586:	55                   	push   %ebp
+  803587:	89 e5                	mov    %esp,%ebp
+  803589:	56                   	push   %esi
+  80358a:	53                   	push   %ebx
+  80358b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80358e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803591:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803594:	85 c0                	test   %eax,%eax
+  803596:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80359b:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  80359e:	83 ec 08             	sub    $0x8,%esp
+  8035a1:	ff 75 14             	push   0x14(%ebp)
+  8035a4:	50                   	push   %eax
+  8035a5:	e8 95 df ff ff       	call   80153f <sys_ipc_recv_until>
+  8035aa:	83 c4 10             	add    $0x10,%esp
+  8035ad:	85 c0                	test   %eax,%eax
+  8035af:	78 61                	js     803612 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8035b1:	85 f6                	test   %esi,%esi
+  8035b3:	74 1c                	je     8035d1 <ipc_recv_until+0x4b>
+  8035b5:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8035b7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8035bc:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8035c2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8035c7:	76 5f                	jbe    803628 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8035c9:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8035cf:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8035d1:	85 db                	test   %ebx,%ebx
+  8035d3:	74 1c                	je     8035f1 <ipc_recv_until+0x6b>
+  8035d5:	89 e0                	mov    %esp,%eax
+  8035d7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8035dc:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8035e2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8035e7:	76 50                	jbe    803639 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  8035e9:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  8035ef:	89 03                	mov    %eax,(%ebx)
+  8035f1:	89 e0                	mov    %esp,%eax
+  8035f3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8035f8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8035fe:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803603:	76 45                	jbe    80364a <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803605:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80360b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80360e:	5b                   	pop    %ebx
+  80360f:	5e                   	pop    %esi
+  803610:	5d                   	pop    %ebp
+  803611:	c3                   	ret
+		if (from_env_store)
+  803612:	85 f6                	test   %esi,%esi
+  803614:	74 06                	je     80361c <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803616:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  80361c:	85 db                	test   %ebx,%ebx
+  80361e:	74 eb                	je     80360b <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803620:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803626:	eb e3                	jmp    80360b <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803628:	c1 e8 10             	shr    $0x10,%eax
+  80362b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803631:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803637:	eb 90                	jmp    8035c9 <ipc_recv_until+0x43>
+  803639:	c1 e8 10             	shr    $0x10,%eax
+  80363c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803642:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803648:	eb 9f                	jmp    8035e9 <ipc_recv_until+0x63>
+  80364a:	c1 e8 10             	shr    $0x10,%eax
+  80364d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803653:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803659:	eb aa                	jmp    803605 <ipc_recv_until+0x7f>
+
+0080365b <ipc_recv>:
+{
+  80365b:	55                   	push   %ebp
+  80365c:	89 e5                	mov    %esp,%ebp
+  80365e:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803661:	6a 00                	push   $0x0
+  803663:	ff 75 10             	push   0x10(%ebp)
+  803666:	ff 75 0c             	push   0xc(%ebp)
+  803669:	ff 75 08             	push   0x8(%ebp)
+  80366c:	e8 15 ff ff ff       	call   803586 <ipc_recv_until>
+}
+  803671:	c9                   	leave
+  803672:	c3                   	ret
+
+00803673 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803673:	55                   	push   %ebp
+  803674:	89 e5                	mov    %esp,%ebp
+  803676:	57                   	push   %edi
+  803677:	56                   	push   %esi
+  803678:	53                   	push   %ebx
+  803679:	83 ec 0c             	sub    $0xc,%esp
+  80367c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80367f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803682:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803685:	85 db                	test   %ebx,%ebx
+  803687:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80368c:	0f 44 d8             	cmove  %eax,%ebx
+  80368f:	eb 05                	jmp    803696 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803691:	e8 52 da ff ff       	call   8010e8 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  803696:	ff 75 14             	push   0x14(%ebp)
+  803699:	53                   	push   %ebx
+  80369a:	56                   	push   %esi
+  80369b:	57                   	push   %edi
+  80369c:	e8 ea dd ff ff       	call   80148b <sys_ipc_try_send>
+  8036a1:	83 c4 10             	add    $0x10,%esp
+  8036a4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8036a7:	74 e8                	je     803691 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8036a9:	85 c0                	test   %eax,%eax
+  8036ab:	78 08                	js     8036b5 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8036ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036b0:	5b                   	pop    %ebx
+  8036b1:	5e                   	pop    %esi
+  8036b2:	5f                   	pop    %edi
+  8036b3:	5d                   	pop    %ebp
+  8036b4:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8036b5:	50                   	push   %eax
+  8036b6:	68 bf 3e 80 00       	push   $0x803ebf
+  8036bb:	6a 4f                	push   $0x4f
+  8036bd:	68 d2 3e 80 00       	push   $0x803ed2
+  8036c2:	e8 4c ce ff ff       	call   800513 <_panic>
+
+008036c7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8036c7:	55                   	push   %ebp
+  8036c8:	89 e5                	mov    %esp,%ebp
+  8036ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8036cd:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8036d2:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8036d8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8036de:	8b 52 50             	mov    0x50(%edx),%edx
+  8036e1:	39 ca                	cmp    %ecx,%edx
+  8036e3:	74 11                	je     8036f6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8036e5:	83 c0 01             	add    $0x1,%eax
+  8036e8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8036ed:	75 e3                	jne    8036d2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8036ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f4:	eb 0e                	jmp    803704 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8036f6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8036fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803701:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803704:	5d                   	pop    %ebp
+  803705:	c3                   	ret
+
+00803706 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803706:	55                   	push   %ebp
+  803707:	89 e5                	mov    %esp,%ebp
+  803709:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80370c:	89 c2                	mov    %eax,%edx
+  80370e:	c1 ea 16             	shr    $0x16,%edx
+  803711:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803718:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80371d:	f6 c1 01             	test   $0x1,%cl
+  803720:	74 1a                	je     80373c <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803722:	c1 e8 0c             	shr    $0xc,%eax
+  803725:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80372c:	a8 01                	test   $0x1,%al
+  80372e:	74 0c                	je     80373c <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803730:	c1 e8 0c             	shr    $0xc,%eax
+  803733:	c1 e0 04             	shl    $0x4,%eax
+  803736:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80373c:	89 d0                	mov    %edx,%eax
+  80373e:	5d                   	pop    %ebp
+  80373f:	c3                   	ret
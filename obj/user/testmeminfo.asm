@@ -0,0 +1,6463 @@
+
+obj/user/testmeminfo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 33 03 00 00       	call   800364 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <self>:
+static struct EnvMemInfo envinfo[NENV];
+
+// Our own memory, as the kernel counts it.
+static struct EnvMemInfo
+self(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 40             	sub    $0x40,%esp
+  80003c:	89 c3                	mov    %eax,%ebx
+	struct MemInfo mi;
+	int i, n;
+
+	if ((n = sys_meminfo(&mi, envinfo, NENV)) < 0)
+  80003e:	68 00 04 00 00       	push   $0x400
+  800043:	68 00 50 80 00       	push   $0x805000
+  800048:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  80004b:	50                   	push   %eax
+  80004c:	e8 b6 17 00 00       	call   801807 <sys_meminfo>
+  800051:	89 c6                	mov    %eax,%esi
+  800053:	83 c4 10             	add    $0x10,%esp
+  800056:	85 c0                	test   %eax,%eax
+  800058:	78 22                	js     80007c <self+0x49>
+		panic("sys_meminfo: %e", n);
+	assert(mi.mi_used == mi.mi_total - mi.mi_free);
+  80005a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80005d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800060:	29 d0                	sub    %edx,%eax
+  800062:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+  800065:	75 27                	jne    80008e <self+0x5b>
+	assert(mi.mi_zeroed <= mi.mi_free);
+  800067:	3b 55 dc             	cmp    -0x24(%ebp),%edx
+  80006a:	72 38                	jb     8000a4 <self+0x71>
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80006c:	8b 3d 08 90 80 00    	mov    0x809008,%edi
+	for (i = 0; i < n; i++)
+  800072:	ba 00 00 00 00       	mov    $0x0,%edx
+  800077:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+  80007a:	eb 48                	jmp    8000c4 <self+0x91>
+		panic("sys_meminfo: %e", n);
+  80007c:	50                   	push   %eax
+  80007d:	68 80 2e 80 00       	push   $0x802e80
+  800082:	6a 13                	push   $0x13
+  800084:	68 90 2e 80 00       	push   $0x802e90
+  800089:	e8 9a 03 00 00       	call   800428 <_panic>
+	assert(mi.mi_used == mi.mi_total - mi.mi_free);
+  80008e:	68 38 2f 80 00       	push   $0x802f38
+  800093:	68 a3 2e 80 00       	push   $0x802ea3
+  800098:	6a 14                	push   $0x14
+  80009a:	68 90 2e 80 00       	push   $0x802e90
+  80009f:	e8 84 03 00 00       	call   800428 <_panic>
+	assert(mi.mi_zeroed <= mi.mi_free);
+  8000a4:	68 b8 2e 80 00       	push   $0x802eb8
+  8000a9:	68 a3 2e 80 00       	push   $0x802ea3
+  8000ae:	6a 15                	push   $0x15
+  8000b0:	68 90 2e 80 00       	push   $0x802e90
+  8000b5:	e8 6e 03 00 00       	call   800428 <_panic>
+		if (envinfo[i].em_envid == thisenv->env_id)
+  8000ba:	8b 41 48             	mov    0x48(%ecx),%eax
+  8000bd:	39 c3                	cmp    %eax,%ebx
+  8000bf:	74 47                	je     800108 <self+0xd5>
+	for (i = 0; i < n; i++)
+  8000c1:	83 c2 01             	add    $0x1,%edx
+  8000c4:	39 f2                	cmp    %esi,%edx
+  8000c6:	74 2c                	je     8000f4 <self+0xc1>
+		if (envinfo[i].em_envid == thisenv->env_id)
+  8000c8:	89 d0                	mov    %edx,%eax
+  8000ca:	c1 e0 04             	shl    $0x4,%eax
+  8000cd:	8b 98 00 50 80 00    	mov    0x805000(%eax),%ebx
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000d3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000d5:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8000da:	89 f9                	mov    %edi,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000dc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8000e1:	77 d7                	ja     8000ba <self+0x87>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8000e3:	c1 e8 10             	shr    $0x10,%eax
+  8000e6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000ec:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8000f2:	eb c6                	jmp    8000ba <self+0x87>
+			return envinfo[i];
+	panic("sys_meminfo does not list us");
+  8000f4:	83 ec 04             	sub    $0x4,%esp
+  8000f7:	68 d3 2e 80 00       	push   $0x802ed3
+  8000fc:	6a 19                	push   $0x19
+  8000fe:	68 90 2e 80 00       	push   $0x802e90
+  800103:	e8 20 03 00 00       	call   800428 <_panic>
+			return envinfo[i];
+  800108:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  80010b:	c1 e2 04             	shl    $0x4,%edx
+  80010e:	8d 82 00 50 80 00    	lea    0x805000(%edx),%eax
+  800114:	8b 92 00 50 80 00    	mov    0x805000(%edx),%edx
+  80011a:	89 13                	mov    %edx,(%ebx)
+  80011c:	8b 50 04             	mov    0x4(%eax),%edx
+  80011f:	89 53 04             	mov    %edx,0x4(%ebx)
+  800122:	8b 50 08             	mov    0x8(%eax),%edx
+  800125:	89 53 08             	mov    %edx,0x8(%ebx)
+  800128:	8b 40 0c             	mov    0xc(%eax),%eax
+  80012b:	89 43 0c             	mov    %eax,0xc(%ebx)
+}
+  80012e:	89 d8                	mov    %ebx,%eax
+  800130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800133:	5b                   	pop    %ebx
+  800134:	5e                   	pop    %esi
+  800135:	5f                   	pop    %edi
+  800136:	5d                   	pop    %ebp
+  800137:	c3                   	ret
+
+00800138 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800138:	55                   	push   %ebp
+  800139:	89 e5                	mov    %esp,%ebp
+  80013b:	57                   	push   %edi
+  80013c:	56                   	push   %esi
+  80013d:	53                   	push   %ebx
+  80013e:	83 ec 4c             	sub    $0x4c,%esp
+	struct EnvMemInfo before, after;
+	int i, r;
+
+	// The first call fills in envinfo's demand-zero pages.
+	before = self();
+  800141:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  800144:	e8 ea fe ff ff       	call   800033 <self>
+	before = self();
+  800149:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  80014c:	e8 e2 fe ff ff       	call   800033 <self>
+  800151:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  800154:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  800157:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80015a:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+	assert(before.em_ptables >= 2);
+  80015d:	83 f8 01             	cmp    $0x1,%eax
+  800160:	0f 86 14 01 00 00    	jbe    80027a <umain+0x142>
+	assert(before.em_shared <= before.em_resident);
+  800166:	39 f7                	cmp    %esi,%edi
+  800168:	0f 82 22 01 00 00    	jb     800290 <umain+0x158>
+  80016e:	bb 00 00 00 30       	mov    $0x30000000,%ebx
+
+	// Pages in a 4MB of their own come with a page table.
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_alloc(0, VA + i * PGSIZE, PERM)) < 0)
+  800173:	83 ec 04             	sub    $0x4,%esp
+  800176:	6a 07                	push   $0x7
+  800178:	53                   	push   %ebx
+  800179:	6a 00                	push   $0x0
+  80017b:	e8 c3 0e 00 00       	call   801043 <sys_page_alloc>
+  800180:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 88 15 01 00 00    	js     8002a6 <umain+0x16e>
+	for (i = 0; i < NPAGES; i++)
+  800191:	81 fb 00 80 00 30    	cmp    $0x30008000,%ebx
+  800197:	75 da                	jne    800173 <umain+0x3b>
+			panic("sys_page_alloc: %e", r);
+	after = self();
+  800199:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80019c:	e8 92 fe ff ff       	call   800033 <self>
+  8001a1:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  8001a4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+	assert(after.em_resident == before.em_resident + NPAGES);
+  8001a7:	8d 47 08             	lea    0x8(%edi),%eax
+  8001aa:	3b 45 cc             	cmp    -0x34(%ebp),%eax
+  8001ad:	0f 85 05 01 00 00    	jne    8002b8 <umain+0x180>
+	assert(after.em_ptables == before.em_ptables + 1);
+  8001b3:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  8001b6:	83 c0 01             	add    $0x1,%eax
+  8001b9:	39 c8                	cmp    %ecx,%eax
+  8001bb:	0f 85 0d 01 00 00    	jne    8002ce <umain+0x196>
+	assert(after.em_shared == before.em_shared);
+  8001c1:	39 d6                	cmp    %edx,%esi
+  8001c3:	0f 85 1b 01 00 00    	jne    8002e4 <umain+0x1ac>
+
+	// A page mapped twice is shared, with ourselves.
+	if ((r = sys_page_map(0, VA, 0, VA + NPAGES * PGSIZE, PERM)) < 0)
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	6a 07                	push   $0x7
+  8001ce:	68 00 80 00 30       	push   $0x30008000
+  8001d3:	6a 00                	push   $0x0
+  8001d5:	68 00 00 00 30       	push   $0x30000000
+  8001da:	6a 00                	push   $0x0
+  8001dc:	e8 cf 0e 00 00       	call   8010b0 <sys_page_map>
+  8001e1:	83 c4 20             	add    $0x20,%esp
+  8001e4:	85 c0                	test   %eax,%eax
+  8001e6:	0f 88 0e 01 00 00    	js     8002fa <umain+0x1c2>
+		panic("sys_page_map: %e", r);
+	after = self();
+  8001ec:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8001ef:	e8 3f fe ff ff       	call   800033 <self>
+  8001f4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+	assert(after.em_resident == before.em_resident + NPAGES + 1);
+  8001f7:	8d 57 09             	lea    0x9(%edi),%edx
+  8001fa:	3b 55 cc             	cmp    -0x34(%ebp),%edx
+  8001fd:	0f 85 09 01 00 00    	jne    80030c <umain+0x1d4>
+	assert(after.em_shared == before.em_shared + 2);
+  800203:	8d 56 02             	lea    0x2(%esi),%edx
+  800206:	39 c2                	cmp    %eax,%edx
+  800208:	0f 85 14 01 00 00    	jne    800322 <umain+0x1ea>
+  80020e:	bb 00 00 00 30       	mov    $0x30000000,%ebx
+
+	for (i = 0; i <= NPAGES; i++)
+		sys_page_unmap(0, VA + i * PGSIZE);
+  800213:	83 ec 08             	sub    $0x8,%esp
+  800216:	53                   	push   %ebx
+  800217:	6a 00                	push   $0x0
+  800219:	e8 00 0f 00 00       	call   80111e <sys_page_unmap>
+	for (i = 0; i <= NPAGES; i++)
+  80021e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800224:	83 c4 10             	add    $0x10,%esp
+  800227:	81 fb 00 90 00 30    	cmp    $0x30009000,%ebx
+  80022d:	75 e4                	jne    800213 <umain+0xdb>
+	after = self();
+  80022f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  800232:	e8 fc fd ff ff       	call   800033 <self>
+  800237:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80023a:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  80023d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+	assert(after.em_resident == before.em_resident);
+  800240:	39 c7                	cmp    %eax,%edi
+  800242:	0f 85 f0 00 00 00    	jne    800338 <umain+0x200>
+	assert(after.em_shared == before.em_shared);
+  800248:	39 d6                	cmp    %edx,%esi
+  80024a:	0f 85 fe 00 00 00    	jne    80034e <umain+0x216>
+
+	cprintf("meminfo: %uK resident, %uK shared, %u page tables\n",
+  800250:	51                   	push   %ecx
+  800251:	c1 e2 02             	shl    $0x2,%edx
+  800254:	52                   	push   %edx
+  800255:	c1 e0 02             	shl    $0x2,%eax
+  800258:	50                   	push   %eax
+  800259:	68 94 30 80 00       	push   $0x803094
+  80025e:	e8 a0 02 00 00       	call   800503 <cprintf>
+		after.em_resident * 4, after.em_shared * 4, after.em_ptables);
+	cprintf("meminfo: OK\n");
+  800263:	c7 04 24 2b 2f 80 00 	movl   $0x802f2b,(%esp)
+  80026a:	e8 94 02 00 00       	call   800503 <cprintf>
+}
+  80026f:	83 c4 10             	add    $0x10,%esp
+  800272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800275:	5b                   	pop    %ebx
+  800276:	5e                   	pop    %esi
+  800277:	5f                   	pop    %edi
+  800278:	5d                   	pop    %ebp
+  800279:	c3                   	ret
+	assert(before.em_ptables >= 2);
+  80027a:	68 f0 2e 80 00       	push   $0x802ef0
+  80027f:	68 a3 2e 80 00       	push   $0x802ea3
+  800284:	6a 25                	push   $0x25
+  800286:	68 90 2e 80 00       	push   $0x802e90
+  80028b:	e8 98 01 00 00       	call   800428 <_panic>
+	assert(before.em_shared <= before.em_resident);
+  800290:	68 60 2f 80 00       	push   $0x802f60
+  800295:	68 a3 2e 80 00       	push   $0x802ea3
+  80029a:	6a 26                	push   $0x26
+  80029c:	68 90 2e 80 00       	push   $0x802e90
+  8002a1:	e8 82 01 00 00       	call   800428 <_panic>
+			panic("sys_page_alloc: %e", r);
+  8002a6:	50                   	push   %eax
+  8002a7:	68 07 2f 80 00       	push   $0x802f07
+  8002ac:	6a 2b                	push   $0x2b
+  8002ae:	68 90 2e 80 00       	push   $0x802e90
+  8002b3:	e8 70 01 00 00       	call   800428 <_panic>
+	assert(after.em_resident == before.em_resident + NPAGES);
+  8002b8:	68 88 2f 80 00       	push   $0x802f88
+  8002bd:	68 a3 2e 80 00       	push   $0x802ea3
+  8002c2:	6a 2d                	push   $0x2d
+  8002c4:	68 90 2e 80 00       	push   $0x802e90
+  8002c9:	e8 5a 01 00 00       	call   800428 <_panic>
+	assert(after.em_ptables == before.em_ptables + 1);
+  8002ce:	68 bc 2f 80 00       	push   $0x802fbc
+  8002d3:	68 a3 2e 80 00       	push   $0x802ea3
+  8002d8:	6a 2e                	push   $0x2e
+  8002da:	68 90 2e 80 00       	push   $0x802e90
+  8002df:	e8 44 01 00 00       	call   800428 <_panic>
+	assert(after.em_shared == before.em_shared);
+  8002e4:	68 e8 2f 80 00       	push   $0x802fe8
+  8002e9:	68 a3 2e 80 00       	push   $0x802ea3
+  8002ee:	6a 2f                	push   $0x2f
+  8002f0:	68 90 2e 80 00       	push   $0x802e90
+  8002f5:	e8 2e 01 00 00       	call   800428 <_panic>
+		panic("sys_page_map: %e", r);
+  8002fa:	50                   	push   %eax
+  8002fb:	68 1a 2f 80 00       	push   $0x802f1a
+  800300:	6a 33                	push   $0x33
+  800302:	68 90 2e 80 00       	push   $0x802e90
+  800307:	e8 1c 01 00 00       	call   800428 <_panic>
+	assert(after.em_resident == before.em_resident + NPAGES + 1);
+  80030c:	68 0c 30 80 00       	push   $0x80300c
+  800311:	68 a3 2e 80 00       	push   $0x802ea3
+  800316:	6a 35                	push   $0x35
+  800318:	68 90 2e 80 00       	push   $0x802e90
+  80031d:	e8 06 01 00 00       	call   800428 <_panic>
+	assert(after.em_shared == before.em_shared + 2);
+  800322:	68 44 30 80 00       	push   $0x803044
+  800327:	68 a3 2e 80 00       	push   $0x802ea3
+  80032c:	6a 36                	push   $0x36
+  80032e:	68 90 2e 80 00       	push   $0x802e90
+  800333:	e8 f0 00 00 00       	call   800428 <_panic>
+	assert(after.em_resident == before.em_resident);
+  800338:	68 6c 30 80 00       	push   $0x80306c
+  80033d:	68 a3 2e 80 00       	push   $0x802ea3
+  800342:	6a 3b                	push   $0x3b
+  800344:	68 90 2e 80 00       	push   $0x802e90
+  800349:	e8 da 00 00 00       	call   800428 <_panic>
+	assert(after.em_shared == before.em_shared);
+  80034e:	68 e8 2f 80 00       	push   $0x802fe8
+  800353:	68 a3 2e 80 00       	push   $0x802ea3
+  800358:	6a 3c                	push   $0x3c
+  80035a:	68 90 2e 80 00       	push   $0x802e90
+  80035f:	e8 c4 00 00 00       	call   800428 <_panic>
+
+00800364 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800364:	55                   	push   %ebp
+  800365:	89 e5                	mov    %esp,%ebp
+  800367:	57                   	push   %edi
+  800368:	56                   	push   %esi
+  800369:	53                   	push   %ebx
+  80036a:	83 ec 0c             	sub    $0xc,%esp
+  80036d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800370:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800373:	b8 01 00 00 00       	mov    $0x1,%eax
+  800378:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80037a:	c1 ea 0b             	shr    $0xb,%edx
+  80037d:	83 f2 01             	xor    $0x1,%edx
+  800380:	83 e2 01             	and    $0x1,%edx
+  800383:	88 15 0c 90 80 00    	mov    %dl,0x80900c
+
+	mainenv = NULL;
+  800389:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  800390:	00 00 00 
+	envid = sys_getenvid();
+  800393:	e8 1f 0c 00 00       	call   800fb7 <sys_getenvid>
+  800398:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80039a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80039f:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8003a5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8003ab:	8b 52 48             	mov    0x48(%edx),%edx
+  8003ae:	39 ca                	cmp    %ecx,%edx
+  8003b0:	74 27                	je     8003d9 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8003b2:	83 c0 01             	add    $0x1,%eax
+  8003b5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8003ba:	75 e3                	jne    80039f <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8003bc:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  8003c3:	75 24                	jne    8003e9 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8003c5:	83 ec 04             	sub    $0x4,%esp
+  8003c8:	68 c8 30 80 00       	push   $0x8030c8
+  8003cd:	6a 23                	push   $0x23
+  8003cf:	68 eb 30 80 00       	push   $0x8030eb
+  8003d4:	e8 4f 00 00 00       	call   800428 <_panic>
+			mainenv = &envs[i];
+  8003d9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8003df:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003e4:	a3 08 90 80 00       	mov    %eax,0x809008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003e9:	85 ff                	test   %edi,%edi
+  8003eb:	7e 07                	jle    8003f4 <libmain+0x90>
+		binaryname = argv[0];
+  8003ed:	8b 06                	mov    (%esi),%eax
+  8003ef:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8003f4:	83 ec 08             	sub    $0x8,%esp
+  8003f7:	56                   	push   %esi
+  8003f8:	57                   	push   %edi
+  8003f9:	e8 3a fd ff ff       	call   800138 <umain>
+
+	// exit gracefully
+	exit();
+  8003fe:	e8 0b 00 00 00       	call   80040e <exit>
+}
+  800403:	83 c4 10             	add    $0x10,%esp
+  800406:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800409:	5b                   	pop    %ebx
+  80040a:	5e                   	pop    %esi
+  80040b:	5f                   	pop    %edi
+  80040c:	5d                   	pop    %ebp
+  80040d:	c3                   	ret
+
+0080040e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80040e:	55                   	push   %ebp
+  80040f:	89 e5                	mov    %esp,%ebp
+  800411:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800414:	e8 94 18 00 00       	call   801cad <close_all>
+	sys_env_destroy(0);
+  800419:	83 ec 0c             	sub    $0xc,%esp
+  80041c:	6a 00                	push   $0x0
+  80041e:	e8 2b 0b 00 00       	call   800f4e <sys_env_destroy>
+}
+  800423:	83 c4 10             	add    $0x10,%esp
+  800426:	c9                   	leave
+  800427:	c3                   	ret
+
+00800428 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+  80042b:	56                   	push   %esi
+  80042c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80042d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800430:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800436:	e8 7c 0b 00 00       	call   800fb7 <sys_getenvid>
+  80043b:	83 ec 0c             	sub    $0xc,%esp
+  80043e:	ff 75 0c             	push   0xc(%ebp)
+  800441:	ff 75 08             	push   0x8(%ebp)
+  800444:	56                   	push   %esi
+  800445:	50                   	push   %eax
+  800446:	68 04 31 80 00       	push   $0x803104
+  80044b:	e8 b3 00 00 00       	call   800503 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800450:	83 c4 18             	add    $0x18,%esp
+  800453:	53                   	push   %ebx
+  800454:	ff 75 10             	push   0x10(%ebp)
+  800457:	e8 56 00 00 00       	call   8004b2 <vcprintf>
+	cprintf("\n");
+  80045c:	c7 04 24 36 2f 80 00 	movl   $0x802f36,(%esp)
+  800463:	e8 9b 00 00 00       	call   800503 <cprintf>
+  800468:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80046b:	cc                   	int3
+	while (1)
+  80046c:	eb fd                	jmp    80046b <_panic+0x43>
+
+0080046e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80046e:	55                   	push   %ebp
+  80046f:	89 e5                	mov    %esp,%ebp
+  800471:	53                   	push   %ebx
+  800472:	83 ec 04             	sub    $0x4,%esp
+  800475:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800478:	8b 13                	mov    (%ebx),%edx
+  80047a:	8d 42 01             	lea    0x1(%edx),%eax
+  80047d:	89 03                	mov    %eax,(%ebx)
+  80047f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800482:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800486:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80048b:	74 09                	je     800496 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80048d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800491:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800494:	c9                   	leave
+  800495:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800496:	83 ec 08             	sub    $0x8,%esp
+  800499:	68 ff 00 00 00       	push   $0xff
+  80049e:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004a1:	50                   	push   %eax
+  8004a2:	e8 1d 0a 00 00       	call   800ec4 <sys_cputs>
+		b->idx = 0;
+  8004a7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004ad:	83 c4 10             	add    $0x10,%esp
+  8004b0:	eb db                	jmp    80048d <putch+0x1f>
+
+008004b2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004b2:	55                   	push   %ebp
+  8004b3:	89 e5                	mov    %esp,%ebp
+  8004b5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004bb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004c2:	00 00 00 
+	b.cnt = 0;
+  8004c5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004cc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004cf:	ff 75 0c             	push   0xc(%ebp)
+  8004d2:	ff 75 08             	push   0x8(%ebp)
+  8004d5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004db:	50                   	push   %eax
+  8004dc:	68 6e 04 80 00       	push   $0x80046e
+  8004e1:	e8 fb 00 00 00       	call   8005e1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004e6:	83 c4 08             	add    $0x8,%esp
+  8004e9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004ef:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004f5:	50                   	push   %eax
+  8004f6:	e8 c9 09 00 00       	call   800ec4 <sys_cputs>
+
+	return b.cnt;
+}
+  8004fb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800501:	c9                   	leave
+  800502:	c3                   	ret
+
+00800503 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800503:	55                   	push   %ebp
+  800504:	89 e5                	mov    %esp,%ebp
+  800506:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800509:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80050c:	50                   	push   %eax
+  80050d:	ff 75 08             	push   0x8(%ebp)
+  800510:	e8 9d ff ff ff       	call   8004b2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800515:	c9                   	leave
+  800516:	c3                   	ret
+
+00800517 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800517:	55                   	push   %ebp
+  800518:	89 e5                	mov    %esp,%ebp
+  80051a:	57                   	push   %edi
+  80051b:	56                   	push   %esi
+  80051c:	53                   	push   %ebx
+  80051d:	83 ec 1c             	sub    $0x1c,%esp
+  800520:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800523:	89 d6                	mov    %edx,%esi
+  800525:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800528:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80052b:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80052e:	73 0b                	jae    80053b <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800530:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800533:	c1 e7 08             	shl    $0x8,%edi
+  800536:	0b 7d 10             	or     0x10(%ebp),%edi
+  800539:	eb 36                	jmp    800571 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80053b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80053e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800543:	f7 75 08             	divl   0x8(%ebp)
+  800546:	89 c1                	mov    %eax,%ecx
+  800548:	ff 75 14             	push   0x14(%ebp)
+  80054b:	ff 75 10             	push   0x10(%ebp)
+  80054e:	83 eb 01             	sub    $0x1,%ebx
+  800551:	53                   	push   %ebx
+  800552:	ff 75 08             	push   0x8(%ebp)
+  800555:	89 f2                	mov    %esi,%edx
+  800557:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80055a:	e8 b8 ff ff ff       	call   800517 <printnum>
+  80055f:	83 c4 10             	add    $0x10,%esp
+  800562:	eb 14                	jmp    800578 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800564:	83 ec 08             	sub    $0x8,%esp
+  800567:	56                   	push   %esi
+  800568:	57                   	push   %edi
+  800569:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80056c:	ff d0                	call   *%eax
+  80056e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800571:	83 eb 01             	sub    $0x1,%ebx
+  800574:	85 db                	test   %ebx,%ebx
+  800576:	7f ec                	jg     800564 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800578:	83 ec 08             	sub    $0x8,%esp
+  80057b:	56                   	push   %esi
+  80057c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80057f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800584:	f7 75 08             	divl   0x8(%ebp)
+  800587:	0f be 92 27 31 80 00 	movsbl 0x803127(%edx),%edx
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	c1 e0 08             	shl    $0x8,%eax
+  800594:	09 d0                	or     %edx,%eax
+  800596:	50                   	push   %eax
+  800597:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80059a:	ff d0                	call   *%eax
+}
+  80059c:	83 c4 10             	add    $0x10,%esp
+  80059f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a2:	5b                   	pop    %ebx
+  8005a3:	5e                   	pop    %esi
+  8005a4:	5f                   	pop    %edi
+  8005a5:	5d                   	pop    %ebp
+  8005a6:	c3                   	ret
+
+008005a7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005a7:	55                   	push   %ebp
+  8005a8:	89 e5                	mov    %esp,%ebp
+  8005aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005ad:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005b1:	8b 10                	mov    (%eax),%edx
+  8005b3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005b6:	73 0a                	jae    8005c2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005b8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005bb:	89 08                	mov    %ecx,(%eax)
+  8005bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005c0:	88 02                	mov    %al,(%edx)
+}
+  8005c2:	5d                   	pop    %ebp
+  8005c3:	c3                   	ret
+
+008005c4 <printfmt>:
+{
+  8005c4:	55                   	push   %ebp
+  8005c5:	89 e5                	mov    %esp,%ebp
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005ca:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005cd:	50                   	push   %eax
+  8005ce:	ff 75 10             	push   0x10(%ebp)
+  8005d1:	ff 75 0c             	push   0xc(%ebp)
+  8005d4:	ff 75 08             	push   0x8(%ebp)
+  8005d7:	e8 05 00 00 00       	call   8005e1 <vprintfmt>
+}
+  8005dc:	83 c4 10             	add    $0x10,%esp
+  8005df:	c9                   	leave
+  8005e0:	c3                   	ret
+
+008005e1 <vprintfmt>:
+{
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	57                   	push   %edi
+  8005e5:	56                   	push   %esi
+  8005e6:	53                   	push   %ebx
+  8005e7:	83 ec 3c             	sub    $0x3c,%esp
+  8005ea:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005ed:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8005f0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8005f7:	eb 16                	jmp    80060f <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8005f9:	83 ec 08             	sub    $0x8,%esp
+  8005fc:	ff 75 0c             	push   0xc(%ebp)
+  8005ff:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800602:	c1 e2 08             	shl    $0x8,%edx
+  800605:	09 d0                	or     %edx,%eax
+  800607:	50                   	push   %eax
+  800608:	ff d7                	call   *%edi
+  80060a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80060d:	89 de                	mov    %ebx,%esi
+  80060f:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800612:	0f b6 06             	movzbl (%esi),%eax
+  800615:	83 f8 25             	cmp    $0x25,%eax
+  800618:	74 0c                	je     800626 <vprintfmt+0x45>
+			if (ch == '\0')
+  80061a:	85 c0                	test   %eax,%eax
+  80061c:	75 db                	jne    8005f9 <vprintfmt+0x18>
+}
+  80061e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800621:	5b                   	pop    %ebx
+  800622:	5e                   	pop    %esi
+  800623:	5f                   	pop    %edi
+  800624:	5d                   	pop    %ebp
+  800625:	c3                   	ret
+		padc = ' ';
+  800626:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80062a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800631:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800638:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80063f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800644:	8d 73 01             	lea    0x1(%ebx),%esi
+  800647:	0f b6 13             	movzbl (%ebx),%edx
+  80064a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80064d:	3c 55                	cmp    $0x55,%al
+  80064f:	0f 87 2c 04 00 00    	ja     800a81 <vprintfmt+0x4a0>
+  800655:	0f b6 c0             	movzbl %al,%eax
+  800658:	ff 24 85 80 32 80 00 	jmp    *0x803280(,%eax,4)
+  80065f:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800661:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800665:	eb dd                	jmp    800644 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800667:	89 f3                	mov    %esi,%ebx
+  800669:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80066d:	eb d5                	jmp    800644 <vprintfmt+0x63>
+  80066f:	0f b6 d2             	movzbl %dl,%edx
+  800672:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800674:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800679:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80067c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800680:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800683:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800686:	83 fe 09             	cmp    $0x9,%esi
+  800689:	0f 87 8a 00 00 00    	ja     800719 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80068f:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800692:	eb e5                	jmp    800679 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8b 00                	mov    (%eax),%eax
+  800699:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a5:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8006a7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006ab:	79 97                	jns    800644 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8006ad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006b3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006ba:	eb 88                	jmp    800644 <vprintfmt+0x63>
+			if (width < 0)
+  8006bc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8006bf:	85 db                	test   %ebx,%ebx
+  8006c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c6:	0f 49 c3             	cmovns %ebx,%eax
+  8006c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006cc:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8006ce:	e9 71 ff ff ff       	jmp    800644 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d3:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8006d5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006dc:	e9 63 ff ff ff       	jmp    800644 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8006e1:	8d 73 02             	lea    0x2(%ebx),%esi
+  8006e4:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8006e8:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8006ef:	3c 67                	cmp    $0x67,%al
+  8006f1:	0f 84 18 ff ff ff    	je     80060f <vprintfmt+0x2e>
+					attrib = 0x04;
+  8006f7:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8006fe:	3c 72                	cmp    $0x72,%al
+  800700:	0f 84 09 ff ff ff    	je     80060f <vprintfmt+0x2e>
+					attrib = 0x00;
+  800706:	3c 62                	cmp    $0x62,%al
+  800708:	0f 94 c0             	sete   %al
+  80070b:	0f b6 c0             	movzbl %al,%eax
+  80070e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800711:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800714:	e9 f6 fe ff ff       	jmp    80060f <vprintfmt+0x2e>
+  800719:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80071c:	eb 89                	jmp    8006a7 <vprintfmt+0xc6>
+			lflag++;
+  80071e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800721:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800723:	e9 1c ff ff ff       	jmp    800644 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800728:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072b:	8d 58 04             	lea    0x4(%eax),%ebx
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	ff 75 0c             	push   0xc(%ebp)
+  800734:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800737:	c1 e0 08             	shl    $0x8,%eax
+  80073a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80073d:	0b 01                	or     (%ecx),%eax
+  80073f:	50                   	push   %eax
+  800740:	ff d7                	call   *%edi
+			break;
+  800742:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800745:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800748:	e9 c2 fe ff ff       	jmp    80060f <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	89 d0                	mov    %edx,%eax
+  800757:	f7 d8                	neg    %eax
+  800759:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80075c:	83 f8 12             	cmp    $0x12,%eax
+  80075f:	7f 25                	jg     800786 <vprintfmt+0x1a5>
+  800761:	8b 14 85 e0 33 80 00 	mov    0x8033e0(,%eax,4),%edx
+  800768:	85 d2                	test   %edx,%edx
+  80076a:	74 1a                	je     800786 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80076c:	52                   	push   %edx
+  80076d:	68 b5 2e 80 00       	push   $0x802eb5
+  800772:	ff 75 0c             	push   0xc(%ebp)
+  800775:	57                   	push   %edi
+  800776:	e8 49 fe ff ff       	call   8005c4 <printfmt>
+  80077b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80077e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800781:	e9 89 fe ff ff       	jmp    80060f <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800786:	50                   	push   %eax
+  800787:	68 3f 31 80 00       	push   $0x80313f
+  80078c:	ff 75 0c             	push   0xc(%ebp)
+  80078f:	57                   	push   %edi
+  800790:	e8 2f fe ff ff       	call   8005c4 <printfmt>
+  800795:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800798:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80079b:	e9 6f fe ff ff       	jmp    80060f <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	83 c0 04             	add    $0x4,%eax
+  8007a6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8007ae:	85 c9                	test   %ecx,%ecx
+  8007b0:	b8 38 31 80 00       	mov    $0x803138,%eax
+  8007b5:	0f 45 c1             	cmovne %ecx,%eax
+  8007b8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8007bb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007bf:	7e 06                	jle    8007c7 <vprintfmt+0x1e6>
+  8007c1:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8007c5:	75 1a                	jne    8007e1 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8007c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007ca:	c1 e0 08             	shl    $0x8,%eax
+  8007cd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8007d0:	83 c8 3f             	or     $0x3f,%eax
+  8007d3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8007d6:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8007d9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007dc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8007df:	eb 6d                	jmp    80084e <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007e1:	83 ec 08             	sub    $0x8,%esp
+  8007e4:	ff 75 d0             	push   -0x30(%ebp)
+  8007e7:	ff 75 c8             	push   -0x38(%ebp)
+  8007ea:	e8 39 03 00 00       	call   800b28 <strnlen>
+  8007ef:	89 c2                	mov    %eax,%edx
+  8007f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007f4:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8007f6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007f9:	c1 e1 08             	shl    $0x8,%ecx
+  8007fc:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800800:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800802:	83 c4 10             	add    $0x10,%esp
+  800805:	89 c3                	mov    %eax,%ebx
+  800807:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80080a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80080d:	89 ce                	mov    %ecx,%esi
+  80080f:	eb 0f                	jmp    800820 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800811:	83 ec 08             	sub    $0x8,%esp
+  800814:	ff 75 0c             	push   0xc(%ebp)
+  800817:	56                   	push   %esi
+  800818:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80081a:	83 eb 01             	sub    $0x1,%ebx
+  80081d:	83 c4 10             	add    $0x10,%esp
+  800820:	85 db                	test   %ebx,%ebx
+  800822:	7f ed                	jg     800811 <vprintfmt+0x230>
+  800824:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800827:	8b 75 10             	mov    0x10(%ebp),%esi
+  80082a:	85 c0                	test   %eax,%eax
+  80082c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800831:	0f 49 d0             	cmovns %eax,%edx
+  800834:	29 d0                	sub    %edx,%eax
+  800836:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800839:	eb 8c                	jmp    8007c7 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80083b:	83 ec 08             	sub    $0x8,%esp
+  80083e:	ff 75 0c             	push   0xc(%ebp)
+  800841:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800844:	09 c2                	or     %eax,%edx
+  800846:	52                   	push   %edx
+  800847:	ff d7                	call   *%edi
+  800849:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80084c:	89 d9                	mov    %ebx,%ecx
+  80084e:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800851:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800855:	0f be d0             	movsbl %al,%edx
+  800858:	85 d2                	test   %edx,%edx
+  80085a:	74 2a                	je     800886 <vprintfmt+0x2a5>
+  80085c:	85 f6                	test   %esi,%esi
+  80085e:	78 05                	js     800865 <vprintfmt+0x284>
+  800860:	83 ee 01             	sub    $0x1,%esi
+  800863:	78 3b                	js     8008a0 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800865:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800869:	74 d0                	je     80083b <vprintfmt+0x25a>
+  80086b:	0f be c0             	movsbl %al,%eax
+  80086e:	83 e8 20             	sub    $0x20,%eax
+  800871:	83 f8 5e             	cmp    $0x5e,%eax
+  800874:	76 c5                	jbe    80083b <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800876:	83 ec 08             	sub    $0x8,%esp
+  800879:	ff 75 0c             	push   0xc(%ebp)
+  80087c:	ff 75 cc             	push   -0x34(%ebp)
+  80087f:	ff d7                	call   *%edi
+  800881:	83 c4 10             	add    $0x10,%esp
+  800884:	eb c6                	jmp    80084c <vprintfmt+0x26b>
+  800886:	8b 75 10             	mov    0x10(%ebp),%esi
+  800889:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80088c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80088f:	01 c3                	add    %eax,%ebx
+  800891:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800893:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800896:	83 c8 20             	or     $0x20,%eax
+  800899:	89 75 10             	mov    %esi,0x10(%ebp)
+  80089c:	89 c6                	mov    %eax,%esi
+  80089e:	eb 14                	jmp    8008b4 <vprintfmt+0x2d3>
+  8008a0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008a3:	eb e4                	jmp    800889 <vprintfmt+0x2a8>
+  8008a5:	83 ec 08             	sub    $0x8,%esp
+  8008a8:	ff 75 0c             	push   0xc(%ebp)
+  8008ab:	56                   	push   %esi
+  8008ac:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8008ae:	83 eb 01             	sub    $0x1,%ebx
+  8008b1:	83 c4 10             	add    $0x10,%esp
+  8008b4:	85 db                	test   %ebx,%ebx
+  8008b6:	7f ed                	jg     8008a5 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008b8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008bb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8008be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c1:	e9 49 fd ff ff       	jmp    80060f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008c6:	83 f9 01             	cmp    $0x1,%ecx
+  8008c9:	7f 1f                	jg     8008ea <vprintfmt+0x309>
+	else if (lflag)
+  8008cb:	85 c9                	test   %ecx,%ecx
+  8008cd:	74 69                	je     800938 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8008cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d2:	8b 00                	mov    (%eax),%eax
+  8008d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008d7:	89 c1                	mov    %eax,%ecx
+  8008d9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008dc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e8:	eb 17                	jmp    800901 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8008ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ed:	8b 50 04             	mov    0x4(%eax),%edx
+  8008f0:	8b 00                	mov    (%eax),%eax
+  8008f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008f5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fb:	8d 40 08             	lea    0x8(%eax),%eax
+  8008fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800901:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800904:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800907:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80090c:	85 db                	test   %ebx,%ebx
+  80090e:	0f 89 f6 00 00 00    	jns    800a0a <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800914:	83 ec 08             	sub    $0x8,%esp
+  800917:	ff 75 0c             	push   0xc(%ebp)
+  80091a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80091d:	c1 e0 08             	shl    $0x8,%eax
+  800920:	83 c8 2d             	or     $0x2d,%eax
+  800923:	50                   	push   %eax
+  800924:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800926:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800929:	f7 d9                	neg    %ecx
+  80092b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80092e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800933:	e9 d2 00 00 00       	jmp    800a0a <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800938:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093b:	8b 00                	mov    (%eax),%eax
+  80093d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800940:	89 c1                	mov    %eax,%ecx
+  800942:	c1 f9 1f             	sar    $0x1f,%ecx
+  800945:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800948:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094b:	8d 40 04             	lea    0x4(%eax),%eax
+  80094e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800951:	eb ae                	jmp    800901 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800953:	83 f9 01             	cmp    $0x1,%ecx
+  800956:	7f 19                	jg     800971 <vprintfmt+0x390>
+	else if (lflag)
+  800958:	85 c9                	test   %ecx,%ecx
+  80095a:	74 2a                	je     800986 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80095c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095f:	8b 08                	mov    (%eax),%ecx
+  800961:	8d 40 04             	lea    0x4(%eax),%eax
+  800964:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800967:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80096c:	e9 99 00 00 00       	jmp    800a0a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800971:	8b 45 14             	mov    0x14(%ebp),%eax
+  800974:	8b 08                	mov    (%eax),%ecx
+  800976:	8d 40 08             	lea    0x8(%eax),%eax
+  800979:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80097c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800981:	e9 84 00 00 00       	jmp    800a0a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800986:	8b 45 14             	mov    0x14(%ebp),%eax
+  800989:	8b 08                	mov    (%eax),%ecx
+  80098b:	8d 40 04             	lea    0x4(%eax),%eax
+  80098e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800991:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800996:	eb 72                	jmp    800a0a <vprintfmt+0x429>
+	if (lflag >= 2)
+  800998:	83 f9 01             	cmp    $0x1,%ecx
+  80099b:	7f 16                	jg     8009b3 <vprintfmt+0x3d2>
+	else if (lflag)
+  80099d:	85 c9                	test   %ecx,%ecx
+  80099f:	74 24                	je     8009c5 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8009a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a4:	8b 08                	mov    (%eax),%ecx
+  8009a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009ac:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8009b1:	eb 57                	jmp    800a0a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8009b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b6:	8b 08                	mov    (%eax),%ecx
+  8009b8:	8d 40 08             	lea    0x8(%eax),%eax
+  8009bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009be:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8009c3:	eb 45                	jmp    800a0a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8009c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c8:	8b 08                	mov    (%eax),%ecx
+  8009ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009d0:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8009d5:	eb 33                	jmp    800a0a <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8009d7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009da:	c1 e3 08             	shl    $0x8,%ebx
+  8009dd:	83 ec 08             	sub    $0x8,%esp
+  8009e0:	ff 75 0c             	push   0xc(%ebp)
+  8009e3:	89 d8                	mov    %ebx,%eax
+  8009e5:	83 c8 30             	or     $0x30,%eax
+  8009e8:	50                   	push   %eax
+  8009e9:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8009eb:	83 c4 08             	add    $0x8,%esp
+  8009ee:	ff 75 0c             	push   0xc(%ebp)
+  8009f1:	83 cb 78             	or     $0x78,%ebx
+  8009f4:	53                   	push   %ebx
+  8009f5:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8009f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fa:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8009fc:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800a02:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a05:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800a0a:	ff 75 e4             	push   -0x1c(%ebp)
+  800a0d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800a11:	52                   	push   %edx
+  800a12:	ff 75 e0             	push   -0x20(%ebp)
+  800a15:	50                   	push   %eax
+  800a16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a19:	89 f8                	mov    %edi,%eax
+  800a1b:	e8 f7 fa ff ff       	call   800517 <printnum>
+			break;
+  800a20:	83 c4 10             	add    $0x10,%esp
+  800a23:	e9 e7 fb ff ff       	jmp    80060f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800a28:	83 f9 01             	cmp    $0x1,%ecx
+  800a2b:	7f 16                	jg     800a43 <vprintfmt+0x462>
+	else if (lflag)
+  800a2d:	85 c9                	test   %ecx,%ecx
+  800a2f:	74 24                	je     800a55 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800a31:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a34:	8b 08                	mov    (%eax),%ecx
+  800a36:	8d 40 04             	lea    0x4(%eax),%eax
+  800a39:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a3c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800a41:	eb c7                	jmp    800a0a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a43:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a46:	8b 08                	mov    (%eax),%ecx
+  800a48:	8d 40 08             	lea    0x8(%eax),%eax
+  800a4b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a4e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800a53:	eb b5                	jmp    800a0a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a55:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a58:	8b 08                	mov    (%eax),%ecx
+  800a5a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a5d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a60:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800a65:	eb a3                	jmp    800a0a <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800a67:	83 ec 08             	sub    $0x8,%esp
+  800a6a:	ff 75 0c             	push   0xc(%ebp)
+  800a6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a70:	c1 e0 08             	shl    $0x8,%eax
+  800a73:	83 c8 25             	or     $0x25,%eax
+  800a76:	50                   	push   %eax
+  800a77:	ff d7                	call   *%edi
+			break;
+  800a79:	83 c4 10             	add    $0x10,%esp
+  800a7c:	e9 8e fb ff ff       	jmp    80060f <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800a81:	83 ec 08             	sub    $0x8,%esp
+  800a84:	ff 75 0c             	push   0xc(%ebp)
+  800a87:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a8a:	c1 e0 08             	shl    $0x8,%eax
+  800a8d:	83 c8 25             	or     $0x25,%eax
+  800a90:	50                   	push   %eax
+  800a91:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a93:	83 c4 10             	add    $0x10,%esp
+  800a96:	89 de                	mov    %ebx,%esi
+  800a98:	eb 03                	jmp    800a9d <vprintfmt+0x4bc>
+  800a9a:	83 ee 01             	sub    $0x1,%esi
+  800a9d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800aa1:	75 f7                	jne    800a9a <vprintfmt+0x4b9>
+  800aa3:	e9 67 fb ff ff       	jmp    80060f <vprintfmt+0x2e>
+
+00800aa8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	83 ec 18             	sub    $0x18,%esp
+  800aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ab4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ab7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800abb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800abe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800ac5:	85 c0                	test   %eax,%eax
+  800ac7:	74 26                	je     800aef <vsnprintf+0x47>
+  800ac9:	85 d2                	test   %edx,%edx
+  800acb:	7e 22                	jle    800aef <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800acd:	ff 75 14             	push   0x14(%ebp)
+  800ad0:	ff 75 10             	push   0x10(%ebp)
+  800ad3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ad6:	50                   	push   %eax
+  800ad7:	68 a7 05 80 00       	push   $0x8005a7
+  800adc:	e8 00 fb ff ff       	call   8005e1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ae1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ae4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ae7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aea:	83 c4 10             	add    $0x10,%esp
+}
+  800aed:	c9                   	leave
+  800aee:	c3                   	ret
+		return -E_INVAL;
+  800aef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800af4:	eb f7                	jmp    800aed <vsnprintf+0x45>
+
+00800af6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800af6:	55                   	push   %ebp
+  800af7:	89 e5                	mov    %esp,%ebp
+  800af9:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800afc:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800aff:	50                   	push   %eax
+  800b00:	ff 75 10             	push   0x10(%ebp)
+  800b03:	ff 75 0c             	push   0xc(%ebp)
+  800b06:	ff 75 08             	push   0x8(%ebp)
+  800b09:	e8 9a ff ff ff       	call   800aa8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b0e:	c9                   	leave
+  800b0f:	c3                   	ret
+
+00800b10 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1b:	eb 03                	jmp    800b20 <strlen+0x10>
+		n++;
+  800b1d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b20:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b24:	75 f7                	jne    800b1d <strlen+0xd>
+	return n;
+}
+  800b26:	5d                   	pop    %ebp
+  800b27:	c3                   	ret
+
+00800b28 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b28:	55                   	push   %ebp
+  800b29:	89 e5                	mov    %esp,%ebp
+  800b2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b36:	eb 03                	jmp    800b3b <strnlen+0x13>
+		n++;
+  800b38:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b3b:	39 d0                	cmp    %edx,%eax
+  800b3d:	74 08                	je     800b47 <strnlen+0x1f>
+  800b3f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b43:	75 f3                	jne    800b38 <strnlen+0x10>
+  800b45:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b47:	89 d0                	mov    %edx,%eax
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	53                   	push   %ebx
+  800b4f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b5e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b61:	83 c0 01             	add    $0x1,%eax
+  800b64:	84 d2                	test   %dl,%dl
+  800b66:	75 f2                	jne    800b5a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b68:	89 c8                	mov    %ecx,%eax
+  800b6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b6d:	c9                   	leave
+  800b6e:	c3                   	ret
+
+00800b6f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	53                   	push   %ebx
+  800b73:	83 ec 10             	sub    $0x10,%esp
+  800b76:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b79:	53                   	push   %ebx
+  800b7a:	e8 91 ff ff ff       	call   800b10 <strlen>
+  800b7f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b82:	ff 75 0c             	push   0xc(%ebp)
+  800b85:	01 d8                	add    %ebx,%eax
+  800b87:	50                   	push   %eax
+  800b88:	e8 be ff ff ff       	call   800b4b <strcpy>
+	return dst;
+}
+  800b8d:	89 d8                	mov    %ebx,%eax
+  800b8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b92:	c9                   	leave
+  800b93:	c3                   	ret
+
+00800b94 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b94:	55                   	push   %ebp
+  800b95:	89 e5                	mov    %esp,%ebp
+  800b97:	56                   	push   %esi
+  800b98:	53                   	push   %ebx
+  800b99:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800b9f:	89 f3                	mov    %esi,%ebx
+  800ba1:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ba4:	89 f0                	mov    %esi,%eax
+  800ba6:	eb 0f                	jmp    800bb7 <strncpy+0x23>
+		*dst++ = *src;
+  800ba8:	83 c0 01             	add    $0x1,%eax
+  800bab:	0f b6 0a             	movzbl (%edx),%ecx
+  800bae:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bb1:	80 f9 01             	cmp    $0x1,%cl
+  800bb4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bb7:	39 d8                	cmp    %ebx,%eax
+  800bb9:	75 ed                	jne    800ba8 <strncpy+0x14>
+	}
+	return ret;
+}
+  800bbb:	89 f0                	mov    %esi,%eax
+  800bbd:	5b                   	pop    %ebx
+  800bbe:	5e                   	pop    %esi
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	c3                   	ret
+
+00800bc1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	56                   	push   %esi
+  800bc5:	53                   	push   %ebx
+  800bc6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcc:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bcf:	89 f0                	mov    %esi,%eax
+  800bd1:	85 d2                	test   %edx,%edx
+  800bd3:	74 21                	je     800bf6 <strlcpy+0x35>
+  800bd5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800bd9:	89 f2                	mov    %esi,%edx
+  800bdb:	eb 09                	jmp    800be6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800bdd:	83 c1 01             	add    $0x1,%ecx
+  800be0:	83 c2 01             	add    $0x1,%edx
+  800be3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800be6:	39 c2                	cmp    %eax,%edx
+  800be8:	74 09                	je     800bf3 <strlcpy+0x32>
+  800bea:	0f b6 19             	movzbl (%ecx),%ebx
+  800bed:	84 db                	test   %bl,%bl
+  800bef:	75 ec                	jne    800bdd <strlcpy+0x1c>
+  800bf1:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800bf3:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800bf6:	29 f0                	sub    %esi,%eax
+}
+  800bf8:	5b                   	pop    %ebx
+  800bf9:	5e                   	pop    %esi
+  800bfa:	5d                   	pop    %ebp
+  800bfb:	c3                   	ret
+
+00800bfc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c02:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c05:	eb 06                	jmp    800c0d <strcmp+0x11>
+		p++, q++;
+  800c07:	83 c1 01             	add    $0x1,%ecx
+  800c0a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c0d:	0f b6 01             	movzbl (%ecx),%eax
+  800c10:	84 c0                	test   %al,%al
+  800c12:	74 04                	je     800c18 <strcmp+0x1c>
+  800c14:	3a 02                	cmp    (%edx),%al
+  800c16:	74 ef                	je     800c07 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c18:	0f b6 c0             	movzbl %al,%eax
+  800c1b:	0f b6 12             	movzbl (%edx),%edx
+  800c1e:	29 d0                	sub    %edx,%eax
+}
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+
+00800c22 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	53                   	push   %ebx
+  800c26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c2f:	eb 09                	jmp    800c3a <strncmp+0x18>
+		n--, p++, q++;
+  800c31:	83 ea 01             	sub    $0x1,%edx
+  800c34:	83 c0 01             	add    $0x1,%eax
+  800c37:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c3a:	85 d2                	test   %edx,%edx
+  800c3c:	74 18                	je     800c56 <strncmp+0x34>
+  800c3e:	0f b6 18             	movzbl (%eax),%ebx
+  800c41:	84 db                	test   %bl,%bl
+  800c43:	74 04                	je     800c49 <strncmp+0x27>
+  800c45:	3a 19                	cmp    (%ecx),%bl
+  800c47:	74 e8                	je     800c31 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c49:	0f b6 00             	movzbl (%eax),%eax
+  800c4c:	0f b6 11             	movzbl (%ecx),%edx
+  800c4f:	29 d0                	sub    %edx,%eax
+}
+  800c51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c54:	c9                   	leave
+  800c55:	c3                   	ret
+		return 0;
+  800c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5b:	eb f4                	jmp    800c51 <strncmp+0x2f>
+
+00800c5d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c5d:	55                   	push   %ebp
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c63:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c67:	eb 03                	jmp    800c6c <strchr+0xf>
+  800c69:	83 c0 01             	add    $0x1,%eax
+  800c6c:	0f b6 10             	movzbl (%eax),%edx
+  800c6f:	84 d2                	test   %dl,%dl
+  800c71:	74 06                	je     800c79 <strchr+0x1c>
+		if (*s == c)
+  800c73:	38 ca                	cmp    %cl,%dl
+  800c75:	75 f2                	jne    800c69 <strchr+0xc>
+  800c77:	eb 05                	jmp    800c7e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c86:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c8a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c8d:	38 ca                	cmp    %cl,%dl
+  800c8f:	74 09                	je     800c9a <strfind+0x1a>
+  800c91:	84 d2                	test   %dl,%dl
+  800c93:	74 05                	je     800c9a <strfind+0x1a>
+	for (; *s; s++)
+  800c95:	83 c0 01             	add    $0x1,%eax
+  800c98:	eb f0                	jmp    800c8a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800c9a:	5d                   	pop    %ebp
+  800c9b:	c3                   	ret
+
+00800c9c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	57                   	push   %edi
+  800ca0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ca3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ca6:	85 c9                	test   %ecx,%ecx
+  800ca8:	74 20                	je     800cca <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800caa:	89 f8                	mov    %edi,%eax
+  800cac:	09 c8                	or     %ecx,%eax
+  800cae:	a8 03                	test   $0x3,%al
+  800cb0:	75 12                	jne    800cc4 <memset+0x28>
+		c &= 0xFF;
+  800cb2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cb6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800cbc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800cbf:	fc                   	cld
+  800cc0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cc2:	eb 06                	jmp    800cca <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cc4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cc7:	fc                   	cld
+  800cc8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cca:	89 f8                	mov    %edi,%eax
+  800ccc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ccf:	c9                   	leave
+  800cd0:	c3                   	ret
+
+00800cd1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	57                   	push   %edi
+  800cd5:	56                   	push   %esi
+  800cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cdc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800cdf:	39 c6                	cmp    %eax,%esi
+  800ce1:	73 32                	jae    800d15 <memmove+0x44>
+  800ce3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ce6:	39 d0                	cmp    %edx,%eax
+  800ce8:	73 2b                	jae    800d15 <memmove+0x44>
+		s += n;
+		d += n;
+  800cea:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ced:	89 d6                	mov    %edx,%esi
+  800cef:	09 fe                	or     %edi,%esi
+  800cf1:	09 ce                	or     %ecx,%esi
+  800cf3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800cf9:	75 0e                	jne    800d09 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800cfb:	83 ef 04             	sub    $0x4,%edi
+  800cfe:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d01:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d04:	fd                   	std
+  800d05:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d07:	eb 09                	jmp    800d12 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d09:	83 ef 01             	sub    $0x1,%edi
+  800d0c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d0f:	fd                   	std
+  800d10:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d12:	fc                   	cld
+  800d13:	eb 1a                	jmp    800d2f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d15:	89 f2                	mov    %esi,%edx
+  800d17:	09 c2                	or     %eax,%edx
+  800d19:	09 ca                	or     %ecx,%edx
+  800d1b:	f6 c2 03             	test   $0x3,%dl
+  800d1e:	75 0a                	jne    800d2a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d20:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d23:	89 c7                	mov    %eax,%edi
+  800d25:	fc                   	cld
+  800d26:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d28:	eb 05                	jmp    800d2f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d2a:	89 c7                	mov    %eax,%edi
+  800d2c:	fc                   	cld
+  800d2d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d2f:	5e                   	pop    %esi
+  800d30:	5f                   	pop    %edi
+  800d31:	5d                   	pop    %ebp
+  800d32:	c3                   	ret
+
+00800d33 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d33:	55                   	push   %ebp
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d39:	ff 75 10             	push   0x10(%ebp)
+  800d3c:	ff 75 0c             	push   0xc(%ebp)
+  800d3f:	ff 75 08             	push   0x8(%ebp)
+  800d42:	e8 8a ff ff ff       	call   800cd1 <memmove>
+}
+  800d47:	c9                   	leave
+  800d48:	c3                   	ret
+
+00800d49 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	56                   	push   %esi
+  800d4d:	53                   	push   %ebx
+  800d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d51:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d54:	89 c6                	mov    %eax,%esi
+  800d56:	03 75 10             	add    0x10(%ebp),%esi
+  800d59:	eb 06                	jmp    800d61 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d5b:	83 c0 01             	add    $0x1,%eax
+  800d5e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d61:	39 f0                	cmp    %esi,%eax
+  800d63:	74 14                	je     800d79 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d65:	0f b6 08             	movzbl (%eax),%ecx
+  800d68:	0f b6 1a             	movzbl (%edx),%ebx
+  800d6b:	38 d9                	cmp    %bl,%cl
+  800d6d:	74 ec                	je     800d5b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d6f:	0f b6 c1             	movzbl %cl,%eax
+  800d72:	0f b6 db             	movzbl %bl,%ebx
+  800d75:	29 d8                	sub    %ebx,%eax
+  800d77:	eb 05                	jmp    800d7e <memcmp+0x35>
+	}
+
+	return 0;
+  800d79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d7e:	5b                   	pop    %ebx
+  800d7f:	5e                   	pop    %esi
+  800d80:	5d                   	pop    %ebp
+  800d81:	c3                   	ret
+
+00800d82 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d8b:	89 c2                	mov    %eax,%edx
+  800d8d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d90:	eb 03                	jmp    800d95 <memfind+0x13>
+  800d92:	83 c0 01             	add    $0x1,%eax
+  800d95:	39 d0                	cmp    %edx,%eax
+  800d97:	73 04                	jae    800d9d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d99:	38 08                	cmp    %cl,(%eax)
+  800d9b:	75 f5                	jne    800d92 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800d9d:	5d                   	pop    %ebp
+  800d9e:	c3                   	ret
+
+00800d9f <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  800da5:	83 ec 1c             	sub    $0x1c,%esp
+  800da8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dab:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800dae:	eb 03                	jmp    800db3 <strtol+0x14>
+		s++;
+  800db0:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800db3:	0f b6 06             	movzbl (%esi),%eax
+  800db6:	3c 20                	cmp    $0x20,%al
+  800db8:	74 f6                	je     800db0 <strtol+0x11>
+  800dba:	3c 09                	cmp    $0x9,%al
+  800dbc:	74 f2                	je     800db0 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800dbe:	3c 2b                	cmp    $0x2b,%al
+  800dc0:	74 43                	je     800e05 <strtol+0x66>
+	int neg = 0;
+  800dc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800dc7:	3c 2d                	cmp    $0x2d,%al
+  800dc9:	74 44                	je     800e0f <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800dcb:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800dd1:	75 0f                	jne    800de2 <strtol+0x43>
+  800dd3:	80 3e 30             	cmpb   $0x30,(%esi)
+  800dd6:	74 41                	je     800e19 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800dd8:	85 ff                	test   %edi,%edi
+  800dda:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ddf:	0f 44 f8             	cmove  %eax,%edi
+  800de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de7:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800dec:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800def:	89 fb                	mov    %edi,%ebx
+  800df1:	c1 fb 1f             	sar    $0x1f,%ebx
+  800df4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800df7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800dfa:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800dfd:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800e00:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e03:	eb 67                	jmp    800e6c <strtol+0xcd>
+		s++;
+  800e05:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800e08:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e0d:	eb bc                	jmp    800dcb <strtol+0x2c>
+		s++, neg = 1;
+  800e0f:	83 c6 01             	add    $0x1,%esi
+  800e12:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e17:	eb b2                	jmp    800dcb <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e19:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800e1d:	74 0e                	je     800e2d <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800e1f:	85 ff                	test   %edi,%edi
+  800e21:	75 bf                	jne    800de2 <strtol+0x43>
+		s++, base = 8;
+  800e23:	83 c6 01             	add    $0x1,%esi
+  800e26:	bf 08 00 00 00       	mov    $0x8,%edi
+  800e2b:	eb b5                	jmp    800de2 <strtol+0x43>
+		s += 2, base = 16;
+  800e2d:	83 c6 02             	add    $0x2,%esi
+  800e30:	bf 10 00 00 00       	mov    $0x10,%edi
+  800e35:	eb ab                	jmp    800de2 <strtol+0x43>
+			dig = *s - '0';
+  800e37:	0f be c9             	movsbl %cl,%ecx
+  800e3a:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800e3d:	39 f9                	cmp    %edi,%ecx
+  800e3f:	7d 59                	jge    800e9a <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800e41:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800e45:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e48:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e4b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800e4e:	0f af d8             	imul   %eax,%ebx
+  800e51:	0f af d7             	imul   %edi,%edx
+  800e54:	01 d3                	add    %edx,%ebx
+  800e56:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e59:	f7 e7                	mul    %edi
+  800e5b:	01 da                	add    %ebx,%edx
+  800e5d:	89 cb                	mov    %ecx,%ebx
+  800e5f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e62:	01 c8                	add    %ecx,%eax
+  800e64:	11 da                	adc    %ebx,%edx
+  800e66:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e69:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800e6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e6f:	0f b6 08             	movzbl (%eax),%ecx
+  800e72:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800e75:	80 fb 09             	cmp    $0x9,%bl
+  800e78:	76 bd                	jbe    800e37 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800e7a:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800e7d:	80 fb 19             	cmp    $0x19,%bl
+  800e80:	77 08                	ja     800e8a <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800e82:	0f be c9             	movsbl %cl,%ecx
+  800e85:	83 e9 57             	sub    $0x57,%ecx
+  800e88:	eb b3                	jmp    800e3d <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e8a:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800e8d:	80 fb 19             	cmp    $0x19,%bl
+  800e90:	77 08                	ja     800e9a <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800e92:	0f be c9             	movsbl %cl,%ecx
+  800e95:	83 e9 37             	sub    $0x37,%ecx
+  800e98:	eb a3                	jmp    800e3d <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800e9a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800e9d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ea0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800ea3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ea6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eaa:	74 05                	je     800eb1 <strtol+0x112>
+		*endptr = (char *) s;
+  800eac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800eaf:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800eb1:	85 c9                	test   %ecx,%ecx
+  800eb3:	74 07                	je     800ebc <strtol+0x11d>
+  800eb5:	f7 d8                	neg    %eax
+  800eb7:	83 d2 00             	adc    $0x0,%edx
+  800eba:	f7 da                	neg    %edx
+}
+  800ebc:	83 c4 1c             	add    $0x1c,%esp
+  800ebf:	5b                   	pop    %ebx
+  800ec0:	5e                   	pop    %esi
+  800ec1:	5f                   	pop    %edi
+  800ec2:	5d                   	pop    %ebp
+  800ec3:	c3                   	ret
+
+00800ec4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	56                   	push   %esi
+  800ec9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800eca:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800ed1:	74 18                	je     800eeb <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ede:	89 c3                	mov    %eax,%ebx
+  800ee0:	89 c7                	mov    %eax,%edi
+  800ee2:	89 c6                	mov    %eax,%esi
+  800ee4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5f                   	pop    %edi
+  800ee9:	5d                   	pop    %ebp
+  800eea:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef6:	89 c3                	mov    %eax,%ebx
+  800ef8:	89 c7                	mov    %eax,%edi
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	8d 35 05 0f 80 00    	lea    0x800f05,%esi
+  800f03:	0f 34                	sysenter
+  800f05:	5d                   	pop    %ebp
+		goto out;
+  800f06:	eb de                	jmp    800ee6 <sys_cputs+0x22>
+
+00800f08 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	57                   	push   %edi
+  800f0c:	56                   	push   %esi
+  800f0d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f0e:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800f15:	74 19                	je     800f30 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800f17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f21:	89 d1                	mov    %edx,%ecx
+  800f23:	89 d3                	mov    %edx,%ebx
+  800f25:	89 d7                	mov    %edx,%edi
+  800f27:	89 d6                	mov    %edx,%esi
+  800f29:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f35:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f3a:	89 d1                	mov    %edx,%ecx
+  800f3c:	89 d3                	mov    %edx,%ebx
+  800f3e:	89 d7                	mov    %edx,%edi
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	8d 35 4b 0f 80 00    	lea    0x800f4b,%esi
+  800f49:	0f 34                	sysenter
+  800f4b:	5d                   	pop    %ebp
+		goto out;
+  800f4c:	eb dd                	jmp    800f2b <sys_cgetc+0x23>
+
+00800f4e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f57:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800f5e:	74 21                	je     800f81 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800f60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f65:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6d:	89 cb                	mov    %ecx,%ebx
+  800f6f:	89 cf                	mov    %ecx,%edi
+  800f71:	89 ce                	mov    %ecx,%esi
+  800f73:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f75:	85 c0                	test   %eax,%eax
+  800f77:	7f 27                	jg     800fa0 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7c:	5b                   	pop    %ebx
+  800f7d:	5e                   	pop    %esi
+  800f7e:	5f                   	pop    %edi
+  800f7f:	5d                   	pop    %ebp
+  800f80:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f89:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f8e:	89 cb                	mov    %ecx,%ebx
+  800f90:	89 cf                	mov    %ecx,%edi
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	8d 35 9d 0f 80 00    	lea    0x800f9d,%esi
+  800f9b:	0f 34                	sysenter
+  800f9d:	5d                   	pop    %ebp
+		goto out;
+  800f9e:	eb d5                	jmp    800f75 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  800fa3:	50                   	push   %eax
+  800fa4:	6a 03                	push   $0x3
+  800fa6:	68 4b 34 80 00       	push   $0x80344b
+  800fab:	6a 3f                	push   $0x3f
+  800fad:	68 68 34 80 00       	push   $0x803468
+  800fb2:	e8 71 f4 ff ff       	call   800428 <_panic>
+
+00800fb7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fbd:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  800fc4:	74 19                	je     800fdf <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fd0:	89 d1                	mov    %edx,%ecx
+  800fd2:	89 d3                	mov    %edx,%ebx
+  800fd4:	89 d7                	mov    %edx,%edi
+  800fd6:	89 d6                	mov    %edx,%esi
+  800fd8:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fda:	5b                   	pop    %ebx
+  800fdb:	5e                   	pop    %esi
+  800fdc:	5f                   	pop    %edi
+  800fdd:	5d                   	pop    %ebp
+  800fde:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fe9:	89 d1                	mov    %edx,%ecx
+  800feb:	89 d3                	mov    %edx,%ebx
+  800fed:	89 d7                	mov    %edx,%edi
+  800fef:	55                   	push   %ebp
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	8d 35 fa 0f 80 00    	lea    0x800ffa,%esi
+  800ff8:	0f 34                	sysenter
+  800ffa:	5d                   	pop    %ebp
+		goto out;
+  800ffb:	eb dd                	jmp    800fda <sys_getenvid+0x23>
+
+00800ffd <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ffd:	55                   	push   %ebp
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	57                   	push   %edi
+  801001:	56                   	push   %esi
+  801002:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801003:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  80100a:	74 19                	je     801025 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  80100c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801011:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801016:	89 d1                	mov    %edx,%ecx
+  801018:	89 d3                	mov    %edx,%ebx
+  80101a:	89 d7                	mov    %edx,%edi
+  80101c:	89 d6                	mov    %edx,%esi
+  80101e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801020:	5b                   	pop    %ebx
+  801021:	5e                   	pop    %esi
+  801022:	5f                   	pop    %edi
+  801023:	5d                   	pop    %ebp
+  801024:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801025:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80102f:	89 d1                	mov    %edx,%ecx
+  801031:	89 d3                	mov    %edx,%ebx
+  801033:	89 d7                	mov    %edx,%edi
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	8d 35 40 10 80 00    	lea    0x801040,%esi
+  80103e:	0f 34                	sysenter
+  801040:	5d                   	pop    %ebp
+		goto out;
+  801041:	eb dd                	jmp    801020 <sys_yield+0x23>
+
+00801043 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801043:	55                   	push   %ebp
+  801044:	89 e5                	mov    %esp,%ebp
+  801046:	57                   	push   %edi
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+  801049:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80104c:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801053:	74 23                	je     801078 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  801055:	be 00 00 00 00       	mov    $0x0,%esi
+  80105a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801065:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801068:	89 f7                	mov    %esi,%edi
+  80106a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80106c:	85 c0                	test   %eax,%eax
+  80106e:	7f 29                	jg     801099 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801070:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801073:	5b                   	pop    %ebx
+  801074:	5e                   	pop    %esi
+  801075:	5f                   	pop    %edi
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801083:	bf 00 00 00 00       	mov    $0x0,%edi
+  801088:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	8d 35 96 10 80 00    	lea    0x801096,%esi
+  801094:	0f 34                	sysenter
+  801096:	5d                   	pop    %ebp
+		goto out;
+  801097:	eb d3                	jmp    80106c <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801099:	83 ec 0c             	sub    $0xc,%esp
+  80109c:	50                   	push   %eax
+  80109d:	6a 04                	push   $0x4
+  80109f:	68 4b 34 80 00       	push   $0x80344b
+  8010a4:	6a 3f                	push   $0x3f
+  8010a6:	68 68 34 80 00       	push   $0x803468
+  8010ab:	e8 78 f3 ff ff       	call   800428 <_panic>
+
+008010b0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	57                   	push   %edi
+  8010b4:	56                   	push   %esi
+  8010b5:	53                   	push   %ebx
+  8010b6:	83 ec 0c             	sub    $0xc,%esp
+  8010b9:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  8010bc:	85 f6                	test   %esi,%esi
+  8010be:	75 09                	jne    8010c9 <sys_page_map+0x19>
+  8010c0:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8010c7:	74 1f                	je     8010e8 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  8010c9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010da:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010dc:	85 c0                	test   %eax,%eax
+  8010de:	7f 27                	jg     801107 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e3:	5b                   	pop    %ebx
+  8010e4:	5e                   	pop    %esi
+  8010e5:	5f                   	pop    %edi
+  8010e6:	5d                   	pop    %ebp
+  8010e7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	8d 35 04 11 80 00    	lea    0x801104,%esi
+  801102:	0f 34                	sysenter
+  801104:	5d                   	pop    %ebp
+		goto out;
+  801105:	eb d5                	jmp    8010dc <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801107:	83 ec 0c             	sub    $0xc,%esp
+  80110a:	50                   	push   %eax
+  80110b:	6a 05                	push   $0x5
+  80110d:	68 4b 34 80 00       	push   $0x80344b
+  801112:	6a 3f                	push   $0x3f
+  801114:	68 68 34 80 00       	push   $0x803468
+  801119:	e8 0a f3 ff ff       	call   800428 <_panic>
+
+0080111e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80111e:	55                   	push   %ebp
+  80111f:	89 e5                	mov    %esp,%ebp
+  801121:	57                   	push   %edi
+  801122:	56                   	push   %esi
+  801123:	53                   	push   %ebx
+  801124:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801127:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  80112e:	74 22                	je     801152 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801130:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801135:	b8 06 00 00 00       	mov    $0x6,%eax
+  80113a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801140:	89 df                	mov    %ebx,%edi
+  801142:	89 de                	mov    %ebx,%esi
+  801144:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801146:	85 c0                	test   %eax,%eax
+  801148:	7f 28                	jg     801172 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80114a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114d:	5b                   	pop    %ebx
+  80114e:	5e                   	pop    %esi
+  80114f:	5f                   	pop    %edi
+  801150:	5d                   	pop    %ebp
+  801151:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801152:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801157:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801162:	89 df                	mov    %ebx,%edi
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	8d 35 6f 11 80 00    	lea    0x80116f,%esi
+  80116d:	0f 34                	sysenter
+  80116f:	5d                   	pop    %ebp
+		goto out;
+  801170:	eb d4                	jmp    801146 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801172:	83 ec 0c             	sub    $0xc,%esp
+  801175:	50                   	push   %eax
+  801176:	6a 06                	push   $0x6
+  801178:	68 4b 34 80 00       	push   $0x80344b
+  80117d:	6a 3f                	push   $0x3f
+  80117f:	68 68 34 80 00       	push   $0x803468
+  801184:	e8 9f f2 ff ff       	call   800428 <_panic>
+
+00801189 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801192:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801199:	74 22                	je     8011bd <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  80119b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	89 df                	mov    %ebx,%edi
+  8011ad:	89 de                	mov    %ebx,%esi
+  8011af:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011b1:	85 c0                	test   %eax,%eax
+  8011b3:	7f 28                	jg     8011dd <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b8:	5b                   	pop    %ebx
+  8011b9:	5e                   	pop    %esi
+  8011ba:	5f                   	pop    %edi
+  8011bb:	5d                   	pop    %ebp
+  8011bc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011cd:	89 df                	mov    %ebx,%edi
+  8011cf:	55                   	push   %ebp
+  8011d0:	89 e5                	mov    %esp,%ebp
+  8011d2:	8d 35 da 11 80 00    	lea    0x8011da,%esi
+  8011d8:	0f 34                	sysenter
+  8011da:	5d                   	pop    %ebp
+		goto out;
+  8011db:	eb d4                	jmp    8011b1 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011dd:	83 ec 0c             	sub    $0xc,%esp
+  8011e0:	50                   	push   %eax
+  8011e1:	6a 08                	push   $0x8
+  8011e3:	68 4b 34 80 00       	push   $0x80344b
+  8011e8:	6a 3f                	push   $0x3f
+  8011ea:	68 68 34 80 00       	push   $0x803468
+  8011ef:	e8 34 f2 ff ff       	call   800428 <_panic>
+
+008011f4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011f4:	55                   	push   %ebp
+  8011f5:	89 e5                	mov    %esp,%ebp
+  8011f7:	57                   	push   %edi
+  8011f8:	56                   	push   %esi
+  8011f9:	53                   	push   %ebx
+  8011fa:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011fd:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801204:	74 22                	je     801228 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801210:	8b 55 08             	mov    0x8(%ebp),%edx
+  801213:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801216:	89 df                	mov    %ebx,%edi
+  801218:	89 de                	mov    %ebx,%esi
+  80121a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80121c:	85 c0                	test   %eax,%eax
+  80121e:	7f 28                	jg     801248 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801220:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801223:	5b                   	pop    %ebx
+  801224:	5e                   	pop    %esi
+  801225:	5f                   	pop    %edi
+  801226:	5d                   	pop    %ebp
+  801227:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801228:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801230:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801233:	b8 09 00 00 00       	mov    $0x9,%eax
+  801238:	89 df                	mov    %ebx,%edi
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	8d 35 45 12 80 00    	lea    0x801245,%esi
+  801243:	0f 34                	sysenter
+  801245:	5d                   	pop    %ebp
+		goto out;
+  801246:	eb d4                	jmp    80121c <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801248:	83 ec 0c             	sub    $0xc,%esp
+  80124b:	50                   	push   %eax
+  80124c:	6a 09                	push   $0x9
+  80124e:	68 4b 34 80 00       	push   $0x80344b
+  801253:	6a 3f                	push   $0x3f
+  801255:	68 68 34 80 00       	push   $0x803468
+  80125a:	e8 c9 f1 ff ff       	call   800428 <_panic>
+
+0080125f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	57                   	push   %edi
+  801263:	56                   	push   %esi
+  801264:	53                   	push   %ebx
+  801265:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801268:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  80126f:	74 22                	je     801293 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801271:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801276:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80127b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801281:	89 df                	mov    %ebx,%edi
+  801283:	89 de                	mov    %ebx,%esi
+  801285:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801287:	85 c0                	test   %eax,%eax
+  801289:	7f 28                	jg     8012b3 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80128b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128e:	5b                   	pop    %ebx
+  80128f:	5e                   	pop    %esi
+  801290:	5f                   	pop    %edi
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801293:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012a3:	89 df                	mov    %ebx,%edi
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	8d 35 b0 12 80 00    	lea    0x8012b0,%esi
+  8012ae:	0f 34                	sysenter
+  8012b0:	5d                   	pop    %ebp
+		goto out;
+  8012b1:	eb d4                	jmp    801287 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b3:	83 ec 0c             	sub    $0xc,%esp
+  8012b6:	50                   	push   %eax
+  8012b7:	6a 0a                	push   $0xa
+  8012b9:	68 4b 34 80 00       	push   $0x80344b
+  8012be:	6a 3f                	push   $0x3f
+  8012c0:	68 68 34 80 00       	push   $0x803468
+  8012c5:	e8 5e f1 ff ff       	call   800428 <_panic>
+
+008012ca <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+  8012d0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012d3:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8012da:	74 22                	je     8012fe <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8012dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ec:	89 df                	mov    %ebx,%edi
+  8012ee:	89 de                	mov    %ebx,%esi
+  8012f0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012f2:	85 c0                	test   %eax,%eax
+  8012f4:	7f 28                	jg     80131e <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8012f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f9:	5b                   	pop    %ebx
+  8012fa:	5e                   	pop    %esi
+  8012fb:	5f                   	pop    %edi
+  8012fc:	5d                   	pop    %ebp
+  8012fd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801303:	8b 55 08             	mov    0x8(%ebp),%edx
+  801306:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801309:	b8 17 00 00 00       	mov    $0x17,%eax
+  80130e:	89 df                	mov    %ebx,%edi
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	8d 35 1b 13 80 00    	lea    0x80131b,%esi
+  801319:	0f 34                	sysenter
+  80131b:	5d                   	pop    %ebp
+		goto out;
+  80131c:	eb d4                	jmp    8012f2 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80131e:	83 ec 0c             	sub    $0xc,%esp
+  801321:	50                   	push   %eax
+  801322:	6a 17                	push   $0x17
+  801324:	68 4b 34 80 00       	push   $0x80344b
+  801329:	6a 3f                	push   $0x3f
+  80132b:	68 68 34 80 00       	push   $0x803468
+  801330:	e8 f3 f0 ff ff       	call   800428 <_panic>
+
+00801335 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	57                   	push   %edi
+  801339:	56                   	push   %esi
+  80133a:	53                   	push   %ebx
+  80133b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80133e:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801345:	74 22                	je     801369 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801347:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801351:	8b 55 08             	mov    0x8(%ebp),%edx
+  801354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801357:	89 df                	mov    %ebx,%edi
+  801359:	89 de                	mov    %ebx,%esi
+  80135b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	7f 28                	jg     801389 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801369:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801374:	b8 18 00 00 00       	mov    $0x18,%eax
+  801379:	89 df                	mov    %ebx,%edi
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	8d 35 86 13 80 00    	lea    0x801386,%esi
+  801384:	0f 34                	sysenter
+  801386:	5d                   	pop    %ebp
+		goto out;
+  801387:	eb d4                	jmp    80135d <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801389:	83 ec 0c             	sub    $0xc,%esp
+  80138c:	50                   	push   %eax
+  80138d:	6a 18                	push   $0x18
+  80138f:	68 4b 34 80 00       	push   $0x80344b
+  801394:	6a 3f                	push   $0x3f
+  801396:	68 68 34 80 00       	push   $0x803468
+  80139b:	e8 88 f0 ff ff       	call   800428 <_panic>
+
+008013a0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8013a0:	55                   	push   %ebp
+  8013a1:	89 e5                	mov    %esp,%ebp
+  8013a3:	57                   	push   %edi
+  8013a4:	56                   	push   %esi
+  8013a5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013a6:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8013ad:	74 1d                	je     8013cc <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8013af:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013c5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8013c7:	5b                   	pop    %ebx
+  8013c8:	5e                   	pop    %esi
+  8013c9:	5f                   	pop    %edi
+  8013ca:	5d                   	pop    %ebp
+  8013cb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	8d 35 e8 13 80 00    	lea    0x8013e8,%esi
+  8013e6:	0f 34                	sysenter
+  8013e8:	5d                   	pop    %ebp
+		goto out;
+  8013e9:	eb dc                	jmp    8013c7 <sys_ipc_try_send+0x27>
+
+008013eb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8013eb:	55                   	push   %ebp
+  8013ec:	89 e5                	mov    %esp,%ebp
+  8013ee:	57                   	push   %edi
+  8013ef:	56                   	push   %esi
+  8013f0:	53                   	push   %ebx
+  8013f1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013f4:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8013fb:	74 21                	je     80141e <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8013fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801402:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801407:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140a:	89 cb                	mov    %ecx,%ebx
+  80140c:	89 cf                	mov    %ecx,%edi
+  80140e:	89 ce                	mov    %ecx,%esi
+  801410:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801412:	85 c0                	test   %eax,%eax
+  801414:	7f 27                	jg     80143d <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801419:	5b                   	pop    %ebx
+  80141a:	5e                   	pop    %esi
+  80141b:	5f                   	pop    %edi
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80141e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801421:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801426:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80142b:	89 cb                	mov    %ecx,%ebx
+  80142d:	89 cf                	mov    %ecx,%edi
+  80142f:	55                   	push   %ebp
+  801430:	89 e5                	mov    %esp,%ebp
+  801432:	8d 35 3a 14 80 00    	lea    0x80143a,%esi
+  801438:	0f 34                	sysenter
+  80143a:	5d                   	pop    %ebp
+		goto out;
+  80143b:	eb d5                	jmp    801412 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80143d:	83 ec 0c             	sub    $0xc,%esp
+  801440:	50                   	push   %eax
+  801441:	6a 0d                	push   $0xd
+  801443:	68 4b 34 80 00       	push   $0x80344b
+  801448:	6a 3f                	push   $0x3f
+  80144a:	68 68 34 80 00       	push   $0x803468
+  80144f:	e8 d4 ef ff ff       	call   800428 <_panic>
+
+00801454 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801454:	55                   	push   %ebp
+  801455:	89 e5                	mov    %esp,%ebp
+  801457:	57                   	push   %edi
+  801458:	56                   	push   %esi
+  801459:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80145a:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801461:	74 1b                	je     80147e <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801463:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801468:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80146d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801470:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801473:	89 df                	mov    %ebx,%edi
+  801475:	89 de                	mov    %ebx,%esi
+  801477:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801479:	5b                   	pop    %ebx
+  80147a:	5e                   	pop    %esi
+  80147b:	5f                   	pop    %edi
+  80147c:	5d                   	pop    %ebp
+  80147d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80147e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801483:	8b 55 08             	mov    0x8(%ebp),%edx
+  801486:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801489:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80148e:	89 df                	mov    %ebx,%edi
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	8d 35 9b 14 80 00    	lea    0x80149b,%esi
+  801499:	0f 34                	sysenter
+  80149b:	5d                   	pop    %ebp
+		goto out;
+  80149c:	eb db                	jmp    801479 <sys_ipc_recv_until+0x25>
+
+0080149e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80149e:	55                   	push   %ebp
+  80149f:	89 e5                	mov    %esp,%ebp
+  8014a1:	57                   	push   %edi
+  8014a2:	56                   	push   %esi
+  8014a3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014a4:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8014ab:	74 19                	je     8014c6 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8014ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014b7:	89 d1                	mov    %edx,%ecx
+  8014b9:	89 d3                	mov    %edx,%ebx
+  8014bb:	89 d7                	mov    %edx,%edi
+  8014bd:	89 d6                	mov    %edx,%esi
+  8014bf:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014c1:	5b                   	pop    %ebx
+  8014c2:	5e                   	pop    %esi
+  8014c3:	5f                   	pop    %edi
+  8014c4:	5d                   	pop    %ebp
+  8014c5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014d0:	89 d1                	mov    %edx,%ecx
+  8014d2:	89 d3                	mov    %edx,%ebx
+  8014d4:	89 d7                	mov    %edx,%edi
+  8014d6:	55                   	push   %ebp
+  8014d7:	89 e5                	mov    %esp,%ebp
+  8014d9:	8d 35 e1 14 80 00    	lea    0x8014e1,%esi
+  8014df:	0f 34                	sysenter
+  8014e1:	5d                   	pop    %ebp
+		goto out;
+  8014e2:	eb dd                	jmp    8014c1 <sys_time_msec+0x23>
+
+008014e4 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8014e4:	55                   	push   %ebp
+  8014e5:	89 e5                	mov    %esp,%ebp
+  8014e7:	57                   	push   %edi
+  8014e8:	56                   	push   %esi
+  8014e9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ea:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8014f1:	74 1a                	je     80150d <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8014f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801500:	89 cb                	mov    %ecx,%ebx
+  801502:	89 cf                	mov    %ecx,%edi
+  801504:	89 ce                	mov    %ecx,%esi
+  801506:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801508:	5b                   	pop    %ebx
+  801509:	5e                   	pop    %esi
+  80150a:	5f                   	pop    %edi
+  80150b:	5d                   	pop    %ebp
+  80150c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80150d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801510:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801515:	b8 10 00 00 00       	mov    $0x10,%eax
+  80151a:	89 cb                	mov    %ecx,%ebx
+  80151c:	89 cf                	mov    %ecx,%edi
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	8d 35 29 15 80 00    	lea    0x801529,%esi
+  801527:	0f 34                	sysenter
+  801529:	5d                   	pop    %ebp
+		goto out;
+  80152a:	eb dc                	jmp    801508 <sys_sleep_until+0x24>
+
+0080152c <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80152c:	55                   	push   %ebp
+  80152d:	89 e5                	mov    %esp,%ebp
+  80152f:	57                   	push   %edi
+  801530:	56                   	push   %esi
+  801531:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801532:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801539:	74 1a                	je     801555 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80153b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801540:	b8 11 00 00 00       	mov    $0x11,%eax
+  801545:	8b 55 08             	mov    0x8(%ebp),%edx
+  801548:	89 cb                	mov    %ecx,%ebx
+  80154a:	89 cf                	mov    %ecx,%edi
+  80154c:	89 ce                	mov    %ecx,%esi
+  80154e:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801550:	5b                   	pop    %ebx
+  801551:	5e                   	pop    %esi
+  801552:	5f                   	pop    %edi
+  801553:	5d                   	pop    %ebp
+  801554:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801555:	8b 55 08             	mov    0x8(%ebp),%edx
+  801558:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80155d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801562:	89 cb                	mov    %ecx,%ebx
+  801564:	89 cf                	mov    %ecx,%edi
+  801566:	55                   	push   %ebp
+  801567:	89 e5                	mov    %esp,%ebp
+  801569:	8d 35 71 15 80 00    	lea    0x801571,%esi
+  80156f:	0f 34                	sysenter
+  801571:	5d                   	pop    %ebp
+		goto out;
+  801572:	eb dc                	jmp    801550 <sys_env_print_stats+0x24>
+
+00801574 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	57                   	push   %edi
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80157a:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801581:	74 1b                	je     80159e <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801583:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801588:	b8 19 00 00 00       	mov    $0x19,%eax
+  80158d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801590:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801593:	89 df                	mov    %ebx,%edi
+  801595:	89 de                	mov    %ebx,%esi
+  801597:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801599:	5b                   	pop    %ebx
+  80159a:	5e                   	pop    %esi
+  80159b:	5f                   	pop    %edi
+  80159c:	5d                   	pop    %ebp
+  80159d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80159e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015ae:	89 df                	mov    %ebx,%edi
+  8015b0:	55                   	push   %ebp
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	8d 35 bb 15 80 00    	lea    0x8015bb,%esi
+  8015b9:	0f 34                	sysenter
+  8015bb:	5d                   	pop    %ebp
+		goto out;
+  8015bc:	eb db                	jmp    801599 <sys_perf+0x25>
+
+008015be <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8015be:	55                   	push   %ebp
+  8015bf:	89 e5                	mov    %esp,%ebp
+  8015c1:	57                   	push   %edi
+  8015c2:	56                   	push   %esi
+  8015c3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015c4:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8015cb:	74 19                	je     8015e6 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8015cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015d7:	89 d1                	mov    %edx,%ecx
+  8015d9:	89 d3                	mov    %edx,%ebx
+  8015db:	89 d7                	mov    %edx,%edi
+  8015dd:	89 d6                	mov    %edx,%esi
+  8015df:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8015e1:	5b                   	pop    %ebx
+  8015e2:	5e                   	pop    %esi
+  8015e3:	5f                   	pop    %edi
+  8015e4:	5d                   	pop    %ebp
+  8015e5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015f0:	89 d1                	mov    %edx,%ecx
+  8015f2:	89 d3                	mov    %edx,%ebx
+  8015f4:	89 d7                	mov    %edx,%edi
+  8015f6:	55                   	push   %ebp
+  8015f7:	89 e5                	mov    %esp,%ebp
+  8015f9:	8d 35 01 16 80 00    	lea    0x801601,%esi
+  8015ff:	0f 34                	sysenter
+  801601:	5d                   	pop    %ebp
+		goto out;
+  801602:	eb dd                	jmp    8015e1 <sys_fork+0x23>
+
+00801604 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801604:	55                   	push   %ebp
+  801605:	89 e5                	mov    %esp,%ebp
+  801607:	57                   	push   %edi
+  801608:	56                   	push   %esi
+  801609:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80160a:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801611:	74 1c                	je     80162f <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801613:	be 00 00 00 00       	mov    $0x0,%esi
+  801618:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80161d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801620:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801623:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801626:	89 f7                	mov    %esi,%edi
+  801628:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80162a:	5b                   	pop    %ebx
+  80162b:	5e                   	pop    %esi
+  80162c:	5f                   	pop    %edi
+  80162d:	5d                   	pop    %ebp
+  80162e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80162f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801632:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801635:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80163a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80163f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	8d 35 4d 16 80 00    	lea    0x80164d,%esi
+  80164b:	0f 34                	sysenter
+  80164d:	5d                   	pop    %ebp
+		goto out;
+  80164e:	eb da                	jmp    80162a <sys_thread_create+0x26>
+
+00801650 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801650:	55                   	push   %ebp
+  801651:	89 e5                	mov    %esp,%ebp
+  801653:	57                   	push   %edi
+  801654:	56                   	push   %esi
+  801655:	53                   	push   %ebx
+  801656:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801659:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801660:	74 24                	je     801686 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801662:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801667:	be 00 00 00 00       	mov    $0x0,%esi
+  80166c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80166f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801672:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801675:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801678:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80167a:	85 c0                	test   %eax,%eax
+  80167c:	7f 27                	jg     8016a5 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80167e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801681:	5b                   	pop    %ebx
+  801682:	5e                   	pop    %esi
+  801683:	5f                   	pop    %edi
+  801684:	5d                   	pop    %ebp
+  801685:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801686:	8b 55 08             	mov    0x8(%ebp),%edx
+  801689:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801691:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801694:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	8d 35 a2 16 80 00    	lea    0x8016a2,%esi
+  8016a0:	0f 34                	sysenter
+  8016a2:	5d                   	pop    %ebp
+		goto out;
+  8016a3:	eb d5                	jmp    80167a <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016a5:	83 ec 0c             	sub    $0xc,%esp
+  8016a8:	50                   	push   %eax
+  8016a9:	6a 1f                	push   $0x1f
+  8016ab:	68 4b 34 80 00       	push   $0x80344b
+  8016b0:	6a 3f                	push   $0x3f
+  8016b2:	68 68 34 80 00       	push   $0x803468
+  8016b7:	e8 6c ed ff ff       	call   800428 <_panic>
+
+008016bc <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8016bc:	55                   	push   %ebp
+  8016bd:	89 e5                	mov    %esp,%ebp
+  8016bf:	57                   	push   %edi
+  8016c0:	56                   	push   %esi
+  8016c1:	53                   	push   %ebx
+  8016c2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016c5:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8016cc:	74 23                	je     8016f1 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8016ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016e1:	89 f7                	mov    %esi,%edi
+  8016e3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016e5:	85 c0                	test   %eax,%eax
+  8016e7:	7f 29                	jg     801712 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8016e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ec:	5b                   	pop    %ebx
+  8016ed:	5e                   	pop    %esi
+  8016ee:	5f                   	pop    %edi
+  8016ef:	5d                   	pop    %ebp
+  8016f0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f7:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801701:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801704:	55                   	push   %ebp
+  801705:	89 e5                	mov    %esp,%ebp
+  801707:	8d 35 0f 17 80 00    	lea    0x80170f,%esi
+  80170d:	0f 34                	sysenter
+  80170f:	5d                   	pop    %ebp
+		goto out;
+  801710:	eb d3                	jmp    8016e5 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801712:	83 ec 0c             	sub    $0xc,%esp
+  801715:	50                   	push   %eax
+  801716:	6a 20                	push   $0x20
+  801718:	68 4b 34 80 00       	push   $0x80344b
+  80171d:	6a 3f                	push   $0x3f
+  80171f:	68 68 34 80 00       	push   $0x803468
+  801724:	e8 ff ec ff ff       	call   800428 <_panic>
+
+00801729 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	57                   	push   %edi
+  80172d:	56                   	push   %esi
+  80172e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80172f:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801736:	74 1b                	je     801753 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801738:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801742:	8b 55 08             	mov    0x8(%ebp),%edx
+  801745:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801748:	89 df                	mov    %ebx,%edi
+  80174a:	89 de                	mov    %ebx,%esi
+  80174c:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80174e:	5b                   	pop    %ebx
+  80174f:	5e                   	pop    %esi
+  801750:	5f                   	pop    %edi
+  801751:	5d                   	pop    %ebp
+  801752:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801753:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801758:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801763:	89 df                	mov    %ebx,%edi
+  801765:	55                   	push   %ebp
+  801766:	89 e5                	mov    %esp,%ebp
+  801768:	8d 35 70 17 80 00    	lea    0x801770,%esi
+  80176e:	0f 34                	sysenter
+  801770:	5d                   	pop    %ebp
+		goto out;
+  801771:	eb db                	jmp    80174e <sys_batch+0x25>
+
+00801773 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801773:	55                   	push   %ebp
+  801774:	89 e5                	mov    %esp,%ebp
+  801776:	57                   	push   %edi
+  801777:	56                   	push   %esi
+  801778:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801779:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801780:	74 1a                	je     80179c <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801782:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801787:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80178c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178f:	89 cb                	mov    %ecx,%ebx
+  801791:	89 cf                	mov    %ecx,%edi
+  801793:	89 ce                	mov    %ecx,%esi
+  801795:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801797:	5b                   	pop    %ebx
+  801798:	5e                   	pop    %esi
+  801799:	5f                   	pop    %edi
+  80179a:	5d                   	pop    %ebp
+  80179b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80179c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017a9:	89 cb                	mov    %ecx,%ebx
+  8017ab:	89 cf                	mov    %ecx,%edi
+  8017ad:	55                   	push   %ebp
+  8017ae:	89 e5                	mov    %esp,%ebp
+  8017b0:	8d 35 b8 17 80 00    	lea    0x8017b8,%esi
+  8017b6:	0f 34                	sysenter
+  8017b8:	5d                   	pop    %ebp
+		goto out;
+  8017b9:	eb dc                	jmp    801797 <sys_trace_ctl+0x24>
+
+008017bb <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8017bb:	55                   	push   %ebp
+  8017bc:	89 e5                	mov    %esp,%ebp
+  8017be:	57                   	push   %edi
+  8017bf:	56                   	push   %esi
+  8017c0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017c1:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8017c8:	74 1c                	je     8017e6 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8017ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8017cf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8017d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017dd:	89 f7                	mov    %esi,%edi
+  8017df:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8017e1:	5b                   	pop    %ebx
+  8017e2:	5e                   	pop    %esi
+  8017e3:	5f                   	pop    %edi
+  8017e4:	5d                   	pop    %ebp
+  8017e5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ec:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8017f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017f9:	55                   	push   %ebp
+  8017fa:	89 e5                	mov    %esp,%ebp
+  8017fc:	8d 35 04 18 80 00    	lea    0x801804,%esi
+  801802:	0f 34                	sysenter
+  801804:	5d                   	pop    %ebp
+		goto out;
+  801805:	eb da                	jmp    8017e1 <sys_trace_read+0x26>
+
+00801807 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801807:	55                   	push   %ebp
+  801808:	89 e5                	mov    %esp,%ebp
+  80180a:	57                   	push   %edi
+  80180b:	56                   	push   %esi
+  80180c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80180d:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801814:	74 1c                	je     801832 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801816:	be 00 00 00 00       	mov    $0x0,%esi
+  80181b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801820:	8b 55 08             	mov    0x8(%ebp),%edx
+  801823:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801826:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801829:	89 f7                	mov    %esi,%edi
+  80182b:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80182d:	5b                   	pop    %ebx
+  80182e:	5e                   	pop    %esi
+  80182f:	5f                   	pop    %edi
+  801830:	5d                   	pop    %ebp
+  801831:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801832:	8b 55 08             	mov    0x8(%ebp),%edx
+  801835:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801838:	b8 21 00 00 00       	mov    $0x21,%eax
+  80183d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801842:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801845:	55                   	push   %ebp
+  801846:	89 e5                	mov    %esp,%ebp
+  801848:	8d 35 50 18 80 00    	lea    0x801850,%esi
+  80184e:	0f 34                	sysenter
+  801850:	5d                   	pop    %ebp
+		goto out;
+  801851:	eb da                	jmp    80182d <sys_meminfo+0x26>
+
+00801853 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801853:	55                   	push   %ebp
+  801854:	89 e5                	mov    %esp,%ebp
+  801856:	57                   	push   %edi
+  801857:	56                   	push   %esi
+  801858:	53                   	push   %ebx
+  801859:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80185c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801860:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801867:	74 1f                	je     801888 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801869:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80186e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801873:	8b 55 08             	mov    0x8(%ebp),%edx
+  801876:	89 df                	mov    %ebx,%edi
+  801878:	89 de                	mov    %ebx,%esi
+  80187a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80187c:	85 c0                	test   %eax,%eax
+  80187e:	7f 25                	jg     8018a5 <sys_env_set_ksm+0x52>
+}
+  801880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801883:	5b                   	pop    %ebx
+  801884:	5e                   	pop    %esi
+  801885:	5f                   	pop    %edi
+  801886:	5d                   	pop    %ebp
+  801887:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801888:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801890:	b8 22 00 00 00       	mov    $0x22,%eax
+  801895:	89 df                	mov    %ebx,%edi
+  801897:	55                   	push   %ebp
+  801898:	89 e5                	mov    %esp,%ebp
+  80189a:	8d 35 a2 18 80 00    	lea    0x8018a2,%esi
+  8018a0:	0f 34                	sysenter
+  8018a2:	5d                   	pop    %ebp
+		goto out;
+  8018a3:	eb d7                	jmp    80187c <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018a5:	83 ec 0c             	sub    $0xc,%esp
+  8018a8:	50                   	push   %eax
+  8018a9:	6a 22                	push   $0x22
+  8018ab:	68 4b 34 80 00       	push   $0x80344b
+  8018b0:	6a 3f                	push   $0x3f
+  8018b2:	68 68 34 80 00       	push   $0x803468
+  8018b7:	e8 6c eb ff ff       	call   800428 <_panic>
+
+008018bc <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8018bc:	55                   	push   %ebp
+  8018bd:	89 e5                	mov    %esp,%ebp
+  8018bf:	57                   	push   %edi
+  8018c0:	56                   	push   %esi
+  8018c1:	53                   	push   %ebx
+  8018c2:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8018c5:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8018c8:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8018cf:	74 24                	je     8018f5 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8018d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018d6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8018db:	89 cb                	mov    %ecx,%ebx
+  8018dd:	89 cf                	mov    %ecx,%edi
+  8018df:	89 ce                	mov    %ecx,%esi
+  8018e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018e3:	85 c0                	test   %eax,%eax
+  8018e5:	7f 2a                	jg     801911 <sys_time_nsec+0x55>
+	return ns;
+}
+  8018e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018ea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8018ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018f0:	5b                   	pop    %ebx
+  8018f1:	5e                   	pop    %esi
+  8018f2:	5f                   	pop    %edi
+  8018f3:	5d                   	pop    %ebp
+  8018f4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018fa:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8018ff:	89 cb                	mov    %ecx,%ebx
+  801901:	89 cf                	mov    %ecx,%edi
+  801903:	55                   	push   %ebp
+  801904:	89 e5                	mov    %esp,%ebp
+  801906:	8d 35 0e 19 80 00    	lea    0x80190e,%esi
+  80190c:	0f 34                	sysenter
+  80190e:	5d                   	pop    %ebp
+		goto out;
+  80190f:	eb d2                	jmp    8018e3 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801911:	83 ec 0c             	sub    $0xc,%esp
+  801914:	50                   	push   %eax
+  801915:	6a 0f                	push   $0xf
+  801917:	68 4b 34 80 00       	push   $0x80344b
+  80191c:	6a 3f                	push   $0x3f
+  80191e:	68 68 34 80 00       	push   $0x803468
+  801923:	e8 00 eb ff ff       	call   800428 <_panic>
+
+00801928 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	57                   	push   %edi
+  80192c:	56                   	push   %esi
+  80192d:	53                   	push   %ebx
+  80192e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801931:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801938:	74 22                	je     80195c <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80193a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801944:	8b 55 08             	mov    0x8(%ebp),%edx
+  801947:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194a:	89 df                	mov    %ebx,%edi
+  80194c:	89 de                	mov    %ebx,%esi
+  80194e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801950:	85 c0                	test   %eax,%eax
+  801952:	7f 28                	jg     80197c <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801954:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801957:	5b                   	pop    %ebx
+  801958:	5e                   	pop    %esi
+  801959:	5f                   	pop    %edi
+  80195a:	5d                   	pop    %ebp
+  80195b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80195c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801961:	8b 55 08             	mov    0x8(%ebp),%edx
+  801964:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801967:	b8 12 00 00 00       	mov    $0x12,%eax
+  80196c:	89 df                	mov    %ebx,%edi
+  80196e:	55                   	push   %ebp
+  80196f:	89 e5                	mov    %esp,%ebp
+  801971:	8d 35 79 19 80 00    	lea    0x801979,%esi
+  801977:	0f 34                	sysenter
+  801979:	5d                   	pop    %ebp
+		goto out;
+  80197a:	eb d4                	jmp    801950 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80197c:	83 ec 0c             	sub    $0xc,%esp
+  80197f:	50                   	push   %eax
+  801980:	6a 12                	push   $0x12
+  801982:	68 4b 34 80 00       	push   $0x80344b
+  801987:	6a 3f                	push   $0x3f
+  801989:	68 68 34 80 00       	push   $0x803468
+  80198e:	e8 95 ea ff ff       	call   800428 <_panic>
+
+00801993 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801993:	55                   	push   %ebp
+  801994:	89 e5                	mov    %esp,%ebp
+  801996:	57                   	push   %edi
+  801997:	56                   	push   %esi
+  801998:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801999:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8019a0:	74 1b                	je     8019bd <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8019a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019b2:	89 df                	mov    %ebx,%edi
+  8019b4:	89 de                	mov    %ebx,%esi
+  8019b6:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8019b8:	5b                   	pop    %ebx
+  8019b9:	5e                   	pop    %esi
+  8019ba:	5f                   	pop    %edi
+  8019bb:	5d                   	pop    %ebp
+  8019bc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019cd:	89 df                	mov    %ebx,%edi
+  8019cf:	55                   	push   %ebp
+  8019d0:	89 e5                	mov    %esp,%ebp
+  8019d2:	8d 35 da 19 80 00    	lea    0x8019da,%esi
+  8019d8:	0f 34                	sysenter
+  8019da:	5d                   	pop    %ebp
+		goto out;
+  8019db:	eb db                	jmp    8019b8 <sys_e1000_receive+0x25>
+
+008019dd <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8019dd:	55                   	push   %ebp
+  8019de:	89 e5                	mov    %esp,%ebp
+  8019e0:	57                   	push   %edi
+  8019e1:	56                   	push   %esi
+  8019e2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019e3:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  8019ea:	74 1b                	je     801a07 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8019ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8019f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019fc:	89 df                	mov    %ebx,%edi
+  8019fe:	89 de                	mov    %ebx,%esi
+  801a00:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801a02:	5b                   	pop    %ebx
+  801a03:	5e                   	pop    %esi
+  801a04:	5f                   	pop    %edi
+  801a05:	5d                   	pop    %ebp
+  801a06:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a12:	b8 14 00 00 00       	mov    $0x14,%eax
+  801a17:	89 df                	mov    %ebx,%edi
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	8d 35 24 1a 80 00    	lea    0x801a24,%esi
+  801a22:	0f 34                	sysenter
+  801a24:	5d                   	pop    %ebp
+		goto out;
+  801a25:	eb db                	jmp    801a02 <sys_e1000_read_hwaddr+0x25>
+
+00801a27 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801a27:	55                   	push   %ebp
+  801a28:	89 e5                	mov    %esp,%ebp
+  801a2a:	57                   	push   %edi
+  801a2b:	56                   	push   %esi
+  801a2c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a2d:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801a34:	74 1a                	je     801a50 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801a36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a3b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a40:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a43:	89 cb                	mov    %ecx,%ebx
+  801a45:	89 cf                	mov    %ecx,%edi
+  801a47:	89 ce                	mov    %ecx,%esi
+  801a49:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801a4b:	5b                   	pop    %ebx
+  801a4c:	5e                   	pop    %esi
+  801a4d:	5f                   	pop    %edi
+  801a4e:	5d                   	pop    %ebp
+  801a4f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a50:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a58:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a5d:	89 cb                	mov    %ecx,%ebx
+  801a5f:	89 cf                	mov    %ecx,%edi
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	8d 35 6c 1a 80 00    	lea    0x801a6c,%esi
+  801a6a:	0f 34                	sysenter
+  801a6c:	5d                   	pop    %ebp
+		goto out;
+  801a6d:	eb dc                	jmp    801a4b <sys_sb16_read_version+0x24>
+
+00801a6f <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	57                   	push   %edi
+  801a73:	56                   	push   %esi
+  801a74:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a75:	80 3d 0c 90 80 00 00 	cmpb   $0x0,0x80900c
+  801a7c:	74 1b                	je     801a99 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801a7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a83:	b8 16 00 00 00       	mov    $0x16,%eax
+  801a88:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a8e:	89 df                	mov    %ebx,%edi
+  801a90:	89 de                	mov    %ebx,%esi
+  801a92:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801a94:	5b                   	pop    %ebx
+  801a95:	5e                   	pop    %esi
+  801a96:	5f                   	pop    %edi
+  801a97:	5d                   	pop    %ebp
+  801a98:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa4:	b8 16 00 00 00       	mov    $0x16,%eax
+  801aa9:	89 df                	mov    %ebx,%edi
+  801aab:	55                   	push   %ebp
+  801aac:	89 e5                	mov    %esp,%ebp
+  801aae:	8d 35 b6 1a 80 00    	lea    0x801ab6,%esi
+  801ab4:	0f 34                	sysenter
+  801ab6:	5d                   	pop    %ebp
+		goto out;
+  801ab7:	eb db                	jmp    801a94 <sys_sb16_play+0x25>
+
+00801ab9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abf:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ac4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801ac7:	5d                   	pop    %ebp
+  801ac8:	c3                   	ret
+
+00801ac9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801acf:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801ad4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ad9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801ade:	5d                   	pop    %ebp
+  801adf:	c3                   	ret
+
+00801ae0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801ae3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801ae8:	eb 02                	jmp    801aec <fd_alloc+0xc>
+  801aea:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801aec:	89 c2                	mov    %eax,%edx
+  801aee:	c1 ea 16             	shr    $0x16,%edx
+  801af1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801af8:	f6 c2 01             	test   $0x1,%dl
+  801afb:	74 2b                	je     801b28 <fd_alloc+0x48>
+  801afd:	89 c2                	mov    %eax,%edx
+  801aff:	c1 ea 0c             	shr    $0xc,%edx
+  801b02:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801b09:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801b0f:	f6 c1 01             	test   $0x1,%cl
+  801b12:	74 14                	je     801b28 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801b14:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801b1a:	75 ce                	jne    801aea <fd_alloc+0xa>
+  801b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801b21:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b26:	eb 05                	jmp    801b2d <fd_alloc+0x4d>
+			return 0;
+  801b28:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801b2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b30:	89 02                	mov    %eax,(%edx)
+}
+  801b32:	89 c8                	mov    %ecx,%eax
+  801b34:	5d                   	pop    %ebp
+  801b35:	c3                   	ret
+
+00801b36 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801b3c:	83 f8 1f             	cmp    $0x1f,%eax
+  801b3f:	77 30                	ja     801b71 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801b41:	c1 e0 0c             	shl    $0xc,%eax
+  801b44:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801b49:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b4f:	f6 c2 01             	test   $0x1,%dl
+  801b52:	74 24                	je     801b78 <fd_lookup+0x42>
+  801b54:	89 c2                	mov    %eax,%edx
+  801b56:	c1 ea 0c             	shr    $0xc,%edx
+  801b59:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b60:	f6 c2 01             	test   $0x1,%dl
+  801b63:	74 1a                	je     801b7f <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b68:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b6f:	5d                   	pop    %ebp
+  801b70:	c3                   	ret
+		return -E_INVAL;
+  801b71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b76:	eb f7                	jmp    801b6f <fd_lookup+0x39>
+		return -E_INVAL;
+  801b78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b7d:	eb f0                	jmp    801b6f <fd_lookup+0x39>
+  801b7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b84:	eb e9                	jmp    801b6f <fd_lookup+0x39>
+
+00801b86 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b86:	55                   	push   %ebp
+  801b87:	89 e5                	mov    %esp,%ebp
+  801b89:	53                   	push   %ebx
+  801b8a:	83 ec 04             	sub    $0x4,%esp
+  801b8d:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b95:	eb 03                	jmp    801b9a <dev_lookup+0x14>
+  801b97:	83 c0 01             	add    $0x1,%eax
+  801b9a:	8b 1c 85 f4 34 80 00 	mov    0x8034f4(,%eax,4),%ebx
+  801ba1:	85 db                	test   %ebx,%ebx
+  801ba3:	74 0b                	je     801bb0 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801ba5:	39 13                	cmp    %edx,(%ebx)
+  801ba7:	75 ee                	jne    801b97 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bae:	eb 2e                	jmp    801bde <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801bb0:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bb2:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bb7:	8b 0d 08 90 80 00    	mov    0x809008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bbd:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bc2:	76 24                	jbe    801be8 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bc4:	8b 41 48             	mov    0x48(%ecx),%eax
+  801bc7:	83 ec 04             	sub    $0x4,%esp
+  801bca:	52                   	push   %edx
+  801bcb:	50                   	push   %eax
+  801bcc:	68 78 34 80 00       	push   $0x803478
+  801bd1:	e8 2d e9 ff ff       	call   800503 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801bd6:	83 c4 10             	add    $0x10,%esp
+  801bd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801bde:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801be1:	89 1a                	mov    %ebx,(%edx)
+}
+  801be3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be6:	c9                   	leave
+  801be7:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801be8:	c1 e8 10             	shr    $0x10,%eax
+  801beb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801bf1:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801bf7:	eb cb                	jmp    801bc4 <dev_lookup+0x3e>
+
+00801bf9 <fd_close>:
+{
+  801bf9:	55                   	push   %ebp
+  801bfa:	89 e5                	mov    %esp,%ebp
+  801bfc:	57                   	push   %edi
+  801bfd:	56                   	push   %esi
+  801bfe:	53                   	push   %ebx
+  801bff:	83 ec 24             	sub    $0x24,%esp
+  801c02:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c05:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c08:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c0b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c0c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c12:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c15:	50                   	push   %eax
+  801c16:	e8 1b ff ff ff       	call   801b36 <fd_lookup>
+  801c1b:	89 c3                	mov    %eax,%ebx
+  801c1d:	83 c4 10             	add    $0x10,%esp
+  801c20:	85 c0                	test   %eax,%eax
+  801c22:	78 05                	js     801c29 <fd_close+0x30>
+	    || fd != fd2)
+  801c24:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c27:	74 16                	je     801c3f <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801c29:	89 f8                	mov    %edi,%eax
+  801c2b:	84 c0                	test   %al,%al
+  801c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c32:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801c35:	89 d8                	mov    %ebx,%eax
+  801c37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3a:	5b                   	pop    %ebx
+  801c3b:	5e                   	pop    %esi
+  801c3c:	5f                   	pop    %edi
+  801c3d:	5d                   	pop    %ebp
+  801c3e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c3f:	83 ec 08             	sub    $0x8,%esp
+  801c42:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c45:	50                   	push   %eax
+  801c46:	ff 36                	push   (%esi)
+  801c48:	e8 39 ff ff ff       	call   801b86 <dev_lookup>
+  801c4d:	89 c3                	mov    %eax,%ebx
+  801c4f:	83 c4 10             	add    $0x10,%esp
+  801c52:	85 c0                	test   %eax,%eax
+  801c54:	78 1a                	js     801c70 <fd_close+0x77>
+		if (dev->dev_close)
+  801c56:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c59:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801c5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801c61:	85 c0                	test   %eax,%eax
+  801c63:	74 0b                	je     801c70 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801c65:	83 ec 0c             	sub    $0xc,%esp
+  801c68:	56                   	push   %esi
+  801c69:	ff d0                	call   *%eax
+  801c6b:	89 c3                	mov    %eax,%ebx
+  801c6d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801c70:	83 ec 08             	sub    $0x8,%esp
+  801c73:	56                   	push   %esi
+  801c74:	6a 00                	push   $0x0
+  801c76:	e8 a3 f4 ff ff       	call   80111e <sys_page_unmap>
+	return r;
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	eb b5                	jmp    801c35 <fd_close+0x3c>
+
+00801c80 <close>:
+
+int
+close(int fdnum)
+{
+  801c80:	55                   	push   %ebp
+  801c81:	89 e5                	mov    %esp,%ebp
+  801c83:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c89:	50                   	push   %eax
+  801c8a:	ff 75 08             	push   0x8(%ebp)
+  801c8d:	e8 a4 fe ff ff       	call   801b36 <fd_lookup>
+  801c92:	83 c4 10             	add    $0x10,%esp
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	79 02                	jns    801c9b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c99:	c9                   	leave
+  801c9a:	c3                   	ret
+		return fd_close(fd, 1);
+  801c9b:	83 ec 08             	sub    $0x8,%esp
+  801c9e:	6a 01                	push   $0x1
+  801ca0:	ff 75 f4             	push   -0xc(%ebp)
+  801ca3:	e8 51 ff ff ff       	call   801bf9 <fd_close>
+  801ca8:	83 c4 10             	add    $0x10,%esp
+  801cab:	eb ec                	jmp    801c99 <close+0x19>
+
+00801cad <close_all>:
+
+void
+close_all(void)
+{
+  801cad:	55                   	push   %ebp
+  801cae:	89 e5                	mov    %esp,%ebp
+  801cb0:	53                   	push   %ebx
+  801cb1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801cb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801cb9:	83 ec 0c             	sub    $0xc,%esp
+  801cbc:	53                   	push   %ebx
+  801cbd:	e8 be ff ff ff       	call   801c80 <close>
+	for (i = 0; i < MAXFD; i++)
+  801cc2:	83 c3 01             	add    $0x1,%ebx
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	83 fb 20             	cmp    $0x20,%ebx
+  801ccb:	75 ec                	jne    801cb9 <close_all+0xc>
+}
+  801ccd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd0:	c9                   	leave
+  801cd1:	c3                   	ret
+
+00801cd2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801cd2:	55                   	push   %ebp
+  801cd3:	89 e5                	mov    %esp,%ebp
+  801cd5:	57                   	push   %edi
+  801cd6:	56                   	push   %esi
+  801cd7:	53                   	push   %ebx
+  801cd8:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801cdb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cde:	50                   	push   %eax
+  801cdf:	ff 75 08             	push   0x8(%ebp)
+  801ce2:	e8 4f fe ff ff       	call   801b36 <fd_lookup>
+  801ce7:	89 c3                	mov    %eax,%ebx
+  801ce9:	83 c4 10             	add    $0x10,%esp
+  801cec:	85 c0                	test   %eax,%eax
+  801cee:	78 7f                	js     801d6f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801cf0:	83 ec 0c             	sub    $0xc,%esp
+  801cf3:	ff 75 0c             	push   0xc(%ebp)
+  801cf6:	e8 85 ff ff ff       	call   801c80 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801cfb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801cfe:	c1 e6 0c             	shl    $0xc,%esi
+  801d01:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801d07:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d0a:	89 3c 24             	mov    %edi,(%esp)
+  801d0d:	e8 b7 fd ff ff       	call   801ac9 <fd2data>
+  801d12:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801d14:	89 34 24             	mov    %esi,(%esp)
+  801d17:	e8 ad fd ff ff       	call   801ac9 <fd2data>
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801d22:	89 d8                	mov    %ebx,%eax
+  801d24:	c1 e8 16             	shr    $0x16,%eax
+  801d27:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d2e:	a8 01                	test   $0x1,%al
+  801d30:	74 11                	je     801d43 <dup+0x71>
+  801d32:	89 d8                	mov    %ebx,%eax
+  801d34:	c1 e8 0c             	shr    $0xc,%eax
+  801d37:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d3e:	f6 c2 01             	test   $0x1,%dl
+  801d41:	75 36                	jne    801d79 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d43:	89 f8                	mov    %edi,%eax
+  801d45:	c1 e8 0c             	shr    $0xc,%eax
+  801d48:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d4f:	83 ec 0c             	sub    $0xc,%esp
+  801d52:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d57:	50                   	push   %eax
+  801d58:	56                   	push   %esi
+  801d59:	6a 00                	push   $0x0
+  801d5b:	57                   	push   %edi
+  801d5c:	6a 00                	push   $0x0
+  801d5e:	e8 4d f3 ff ff       	call   8010b0 <sys_page_map>
+  801d63:	89 c3                	mov    %eax,%ebx
+  801d65:	83 c4 20             	add    $0x20,%esp
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 33                	js     801d9f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801d6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801d6f:	89 d8                	mov    %ebx,%eax
+  801d71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d74:	5b                   	pop    %ebx
+  801d75:	5e                   	pop    %esi
+  801d76:	5f                   	pop    %edi
+  801d77:	5d                   	pop    %ebp
+  801d78:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801d79:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d80:	83 ec 0c             	sub    $0xc,%esp
+  801d83:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d88:	50                   	push   %eax
+  801d89:	ff 75 d4             	push   -0x2c(%ebp)
+  801d8c:	6a 00                	push   $0x0
+  801d8e:	53                   	push   %ebx
+  801d8f:	6a 00                	push   $0x0
+  801d91:	e8 1a f3 ff ff       	call   8010b0 <sys_page_map>
+  801d96:	89 c3                	mov    %eax,%ebx
+  801d98:	83 c4 20             	add    $0x20,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	79 a4                	jns    801d43 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d9f:	83 ec 08             	sub    $0x8,%esp
+  801da2:	56                   	push   %esi
+  801da3:	6a 00                	push   $0x0
+  801da5:	e8 74 f3 ff ff       	call   80111e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801daa:	83 c4 08             	add    $0x8,%esp
+  801dad:	ff 75 d4             	push   -0x2c(%ebp)
+  801db0:	6a 00                	push   $0x0
+  801db2:	e8 67 f3 ff ff       	call   80111e <sys_page_unmap>
+	return r;
+  801db7:	83 c4 10             	add    $0x10,%esp
+  801dba:	eb b3                	jmp    801d6f <dup+0x9d>
+
+00801dbc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801dbc:	55                   	push   %ebp
+  801dbd:	89 e5                	mov    %esp,%ebp
+  801dbf:	56                   	push   %esi
+  801dc0:	53                   	push   %ebx
+  801dc1:	83 ec 18             	sub    $0x18,%esp
+  801dc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dc7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dca:	50                   	push   %eax
+  801dcb:	53                   	push   %ebx
+  801dcc:	e8 65 fd ff ff       	call   801b36 <fd_lookup>
+  801dd1:	83 c4 10             	add    $0x10,%esp
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	78 3c                	js     801e14 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dd8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ddb:	83 ec 08             	sub    $0x8,%esp
+  801dde:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801de1:	50                   	push   %eax
+  801de2:	ff 36                	push   (%esi)
+  801de4:	e8 9d fd ff ff       	call   801b86 <dev_lookup>
+  801de9:	83 c4 10             	add    $0x10,%esp
+  801dec:	85 c0                	test   %eax,%eax
+  801dee:	78 24                	js     801e14 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801df0:	8b 46 08             	mov    0x8(%esi),%eax
+  801df3:	83 e0 03             	and    $0x3,%eax
+  801df6:	83 f8 01             	cmp    $0x1,%eax
+  801df9:	74 20                	je     801e1b <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801dfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dfe:	8b 40 08             	mov    0x8(%eax),%eax
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	74 57                	je     801e5c <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e05:	83 ec 04             	sub    $0x4,%esp
+  801e08:	ff 75 10             	push   0x10(%ebp)
+  801e0b:	ff 75 0c             	push   0xc(%ebp)
+  801e0e:	56                   	push   %esi
+  801e0f:	ff d0                	call   *%eax
+  801e11:	83 c4 10             	add    $0x10,%esp
+}
+  801e14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e17:	5b                   	pop    %ebx
+  801e18:	5e                   	pop    %esi
+  801e19:	5d                   	pop    %ebp
+  801e1a:	c3                   	ret
+  801e1b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e1d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e22:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e28:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e2d:	76 1c                	jbe    801e4b <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e2f:	8b 42 48             	mov    0x48(%edx),%eax
+  801e32:	83 ec 04             	sub    $0x4,%esp
+  801e35:	53                   	push   %ebx
+  801e36:	50                   	push   %eax
+  801e37:	68 b9 34 80 00       	push   $0x8034b9
+  801e3c:	e8 c2 e6 ff ff       	call   800503 <cprintf>
+		return -E_INVAL;
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e49:	eb c9                	jmp    801e14 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801e4b:	c1 e8 10             	shr    $0x10,%eax
+  801e4e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e54:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e5a:	eb d3                	jmp    801e2f <read+0x73>
+		return -E_NOT_SUPP;
+  801e5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e61:	eb b1                	jmp    801e14 <read+0x58>
+
+00801e63 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e63:	55                   	push   %ebp
+  801e64:	89 e5                	mov    %esp,%ebp
+  801e66:	57                   	push   %edi
+  801e67:	56                   	push   %esi
+  801e68:	53                   	push   %ebx
+  801e69:	83 ec 0c             	sub    $0xc,%esp
+  801e6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e6f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801e72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e77:	eb 02                	jmp    801e7b <readn+0x18>
+  801e79:	01 c3                	add    %eax,%ebx
+  801e7b:	39 f3                	cmp    %esi,%ebx
+  801e7d:	73 21                	jae    801ea0 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e7f:	83 ec 04             	sub    $0x4,%esp
+  801e82:	89 f0                	mov    %esi,%eax
+  801e84:	29 d8                	sub    %ebx,%eax
+  801e86:	50                   	push   %eax
+  801e87:	89 d8                	mov    %ebx,%eax
+  801e89:	03 45 0c             	add    0xc(%ebp),%eax
+  801e8c:	50                   	push   %eax
+  801e8d:	57                   	push   %edi
+  801e8e:	e8 29 ff ff ff       	call   801dbc <read>
+		if (m < 0)
+  801e93:	83 c4 10             	add    $0x10,%esp
+  801e96:	85 c0                	test   %eax,%eax
+  801e98:	78 04                	js     801e9e <readn+0x3b>
+			return m;
+		if (m == 0)
+  801e9a:	75 dd                	jne    801e79 <readn+0x16>
+  801e9c:	eb 02                	jmp    801ea0 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e9e:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801ea0:	89 d8                	mov    %ebx,%eax
+  801ea2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea5:	5b                   	pop    %ebx
+  801ea6:	5e                   	pop    %esi
+  801ea7:	5f                   	pop    %edi
+  801ea8:	5d                   	pop    %ebp
+  801ea9:	c3                   	ret
+
+00801eaa <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801eaa:	55                   	push   %ebp
+  801eab:	89 e5                	mov    %esp,%ebp
+  801ead:	56                   	push   %esi
+  801eae:	53                   	push   %ebx
+  801eaf:	83 ec 18             	sub    $0x18,%esp
+  801eb2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801eb5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eb8:	50                   	push   %eax
+  801eb9:	53                   	push   %ebx
+  801eba:	e8 77 fc ff ff       	call   801b36 <fd_lookup>
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 37                	js     801efd <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ec6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ec9:	83 ec 08             	sub    $0x8,%esp
+  801ecc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ecf:	50                   	push   %eax
+  801ed0:	ff 36                	push   (%esi)
+  801ed2:	e8 af fc ff ff       	call   801b86 <dev_lookup>
+  801ed7:	83 c4 10             	add    $0x10,%esp
+  801eda:	85 c0                	test   %eax,%eax
+  801edc:	78 1f                	js     801efd <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ede:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ee2:	74 20                	je     801f04 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ee4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ee7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eea:	85 c0                	test   %eax,%eax
+  801eec:	74 57                	je     801f45 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801eee:	83 ec 04             	sub    $0x4,%esp
+  801ef1:	ff 75 10             	push   0x10(%ebp)
+  801ef4:	ff 75 0c             	push   0xc(%ebp)
+  801ef7:	56                   	push   %esi
+  801ef8:	ff d0                	call   *%eax
+  801efa:	83 c4 10             	add    $0x10,%esp
+}
+  801efd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f00:	5b                   	pop    %ebx
+  801f01:	5e                   	pop    %esi
+  801f02:	5d                   	pop    %ebp
+  801f03:	c3                   	ret
+  801f04:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801f06:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801f0b:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801f11:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801f16:	76 1c                	jbe    801f34 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f18:	8b 42 48             	mov    0x48(%edx),%eax
+  801f1b:	83 ec 04             	sub    $0x4,%esp
+  801f1e:	53                   	push   %ebx
+  801f1f:	50                   	push   %eax
+  801f20:	68 d5 34 80 00       	push   $0x8034d5
+  801f25:	e8 d9 e5 ff ff       	call   800503 <cprintf>
+		return -E_INVAL;
+  801f2a:	83 c4 10             	add    $0x10,%esp
+  801f2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f32:	eb c9                	jmp    801efd <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801f34:	c1 e8 10             	shr    $0x10,%eax
+  801f37:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f3d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f43:	eb d3                	jmp    801f18 <write+0x6e>
+		return -E_NOT_SUPP;
+  801f45:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f4a:	eb b1                	jmp    801efd <write+0x53>
+
+00801f4c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801f4c:	55                   	push   %ebp
+  801f4d:	89 e5                	mov    %esp,%ebp
+  801f4f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f52:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f55:	50                   	push   %eax
+  801f56:	ff 75 08             	push   0x8(%ebp)
+  801f59:	e8 d8 fb ff ff       	call   801b36 <fd_lookup>
+  801f5e:	83 c4 10             	add    $0x10,%esp
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	78 0e                	js     801f73 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801f65:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f6b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f73:	c9                   	leave
+  801f74:	c3                   	ret
+
+00801f75 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	56                   	push   %esi
+  801f79:	53                   	push   %ebx
+  801f7a:	83 ec 18             	sub    $0x18,%esp
+  801f7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f80:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f83:	50                   	push   %eax
+  801f84:	53                   	push   %ebx
+  801f85:	e8 ac fb ff ff       	call   801b36 <fd_lookup>
+  801f8a:	83 c4 10             	add    $0x10,%esp
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	78 34                	js     801fc5 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f91:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f94:	83 ec 08             	sub    $0x8,%esp
+  801f97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f9a:	50                   	push   %eax
+  801f9b:	ff 36                	push   (%esi)
+  801f9d:	e8 e4 fb ff ff       	call   801b86 <dev_lookup>
+  801fa2:	83 c4 10             	add    $0x10,%esp
+  801fa5:	85 c0                	test   %eax,%eax
+  801fa7:	78 1c                	js     801fc5 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fa9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fad:	74 1d                	je     801fcc <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801faf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fb2:	8b 40 18             	mov    0x18(%eax),%eax
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	74 54                	je     80200d <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801fb9:	83 ec 08             	sub    $0x8,%esp
+  801fbc:	ff 75 0c             	push   0xc(%ebp)
+  801fbf:	56                   	push   %esi
+  801fc0:	ff d0                	call   *%eax
+  801fc2:	83 c4 10             	add    $0x10,%esp
+}
+  801fc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc8:	5b                   	pop    %ebx
+  801fc9:	5e                   	pop    %esi
+  801fca:	5d                   	pop    %ebp
+  801fcb:	c3                   	ret
+  801fcc:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fce:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801fd3:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801fd9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801fde:	76 1c                	jbe    801ffc <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801fe0:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fe3:	83 ec 04             	sub    $0x4,%esp
+  801fe6:	53                   	push   %ebx
+  801fe7:	50                   	push   %eax
+  801fe8:	68 98 34 80 00       	push   $0x803498
+  801fed:	e8 11 e5 ff ff       	call   800503 <cprintf>
+		return -E_INVAL;
+  801ff2:	83 c4 10             	add    $0x10,%esp
+  801ff5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ffa:	eb c9                	jmp    801fc5 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ffc:	c1 e8 10             	shr    $0x10,%eax
+  801fff:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802005:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80200b:	eb d3                	jmp    801fe0 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  80200d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802012:	eb b1                	jmp    801fc5 <ftruncate+0x50>
+
+00802014 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	56                   	push   %esi
+  802018:	53                   	push   %ebx
+  802019:	83 ec 18             	sub    $0x18,%esp
+  80201c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80201f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802022:	50                   	push   %eax
+  802023:	ff 75 08             	push   0x8(%ebp)
+  802026:	e8 0b fb ff ff       	call   801b36 <fd_lookup>
+  80202b:	83 c4 10             	add    $0x10,%esp
+  80202e:	85 c0                	test   %eax,%eax
+  802030:	78 49                	js     80207b <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802032:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802035:	83 ec 08             	sub    $0x8,%esp
+  802038:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80203b:	50                   	push   %eax
+  80203c:	ff 36                	push   (%esi)
+  80203e:	e8 43 fb ff ff       	call   801b86 <dev_lookup>
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	85 c0                	test   %eax,%eax
+  802048:	78 31                	js     80207b <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80204a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80204d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802051:	74 2f                	je     802082 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802053:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802056:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80205d:	00 00 00 
+	stat->st_isdir = 0;
+  802060:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802067:	00 00 00 
+	stat->st_dev = dev;
+  80206a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802070:	83 ec 08             	sub    $0x8,%esp
+  802073:	53                   	push   %ebx
+  802074:	56                   	push   %esi
+  802075:	ff 50 14             	call   *0x14(%eax)
+  802078:	83 c4 10             	add    $0x10,%esp
+}
+  80207b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80207e:	5b                   	pop    %ebx
+  80207f:	5e                   	pop    %esi
+  802080:	5d                   	pop    %ebp
+  802081:	c3                   	ret
+		return -E_NOT_SUPP;
+  802082:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802087:	eb f2                	jmp    80207b <fstat+0x67>
+
+00802089 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802089:	55                   	push   %ebp
+  80208a:	89 e5                	mov    %esp,%ebp
+  80208c:	56                   	push   %esi
+  80208d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80208e:	83 ec 08             	sub    $0x8,%esp
+  802091:	6a 00                	push   $0x0
+  802093:	ff 75 08             	push   0x8(%ebp)
+  802096:	e8 e4 01 00 00       	call   80227f <open>
+  80209b:	89 c3                	mov    %eax,%ebx
+  80209d:	83 c4 10             	add    $0x10,%esp
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	78 1b                	js     8020bf <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8020a4:	83 ec 08             	sub    $0x8,%esp
+  8020a7:	ff 75 0c             	push   0xc(%ebp)
+  8020aa:	50                   	push   %eax
+  8020ab:	e8 64 ff ff ff       	call   802014 <fstat>
+  8020b0:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8020b2:	89 1c 24             	mov    %ebx,(%esp)
+  8020b5:	e8 c6 fb ff ff       	call   801c80 <close>
+	return r;
+  8020ba:	83 c4 10             	add    $0x10,%esp
+  8020bd:	89 f3                	mov    %esi,%ebx
+}
+  8020bf:	89 d8                	mov    %ebx,%eax
+  8020c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c4:	5b                   	pop    %ebx
+  8020c5:	5e                   	pop    %esi
+  8020c6:	5d                   	pop    %ebp
+  8020c7:	c3                   	ret
+
+008020c8 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8020c8:	55                   	push   %ebp
+  8020c9:	89 e5                	mov    %esp,%ebp
+  8020cb:	56                   	push   %esi
+  8020cc:	53                   	push   %ebx
+  8020cd:	89 c6                	mov    %eax,%esi
+  8020cf:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8020d1:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8020d8:	74 27                	je     802101 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8020da:	6a 07                	push   $0x7
+  8020dc:	68 00 a0 80 00       	push   $0x80a000
+  8020e1:	56                   	push   %esi
+  8020e2:	ff 35 00 90 80 00    	push   0x809000
+  8020e8:	e8 b2 0c 00 00       	call   802d9f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8020ed:	83 c4 0c             	add    $0xc,%esp
+  8020f0:	6a 00                	push   $0x0
+  8020f2:	53                   	push   %ebx
+  8020f3:	6a 00                	push   $0x0
+  8020f5:	e8 8d 0c 00 00       	call   802d87 <ipc_recv>
+}
+  8020fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020fd:	5b                   	pop    %ebx
+  8020fe:	5e                   	pop    %esi
+  8020ff:	5d                   	pop    %ebp
+  802100:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802101:	83 ec 0c             	sub    $0xc,%esp
+  802104:	6a 01                	push   $0x1
+  802106:	e8 e8 0c 00 00       	call   802df3 <ipc_find_env>
+  80210b:	a3 00 90 80 00       	mov    %eax,0x809000
+  802110:	83 c4 10             	add    $0x10,%esp
+  802113:	eb c5                	jmp    8020da <fsipc+0x12>
+
+00802115 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802115:	55                   	push   %ebp
+  802116:	89 e5                	mov    %esp,%ebp
+  802118:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80211b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802121:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.set_size.req_size = newsize;
+  802126:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802129:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80212e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802133:	b8 02 00 00 00       	mov    $0x2,%eax
+  802138:	e8 8b ff ff ff       	call   8020c8 <fsipc>
+}
+  80213d:	c9                   	leave
+  80213e:	c3                   	ret
+
+0080213f <devfile_flush>:
+{
+  80213f:	55                   	push   %ebp
+  802140:	89 e5                	mov    %esp,%ebp
+  802142:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802145:	8b 45 08             	mov    0x8(%ebp),%eax
+  802148:	8b 40 0c             	mov    0xc(%eax),%eax
+  80214b:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802150:	ba 00 00 00 00       	mov    $0x0,%edx
+  802155:	b8 06 00 00 00       	mov    $0x6,%eax
+  80215a:	e8 69 ff ff ff       	call   8020c8 <fsipc>
+}
+  80215f:	c9                   	leave
+  802160:	c3                   	ret
+
+00802161 <devfile_stat>:
+{
+  802161:	55                   	push   %ebp
+  802162:	89 e5                	mov    %esp,%ebp
+  802164:	53                   	push   %ebx
+  802165:	83 ec 04             	sub    $0x4,%esp
+  802168:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80216b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802171:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802176:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802180:	e8 43 ff ff ff       	call   8020c8 <fsipc>
+  802185:	85 c0                	test   %eax,%eax
+  802187:	78 2c                	js     8021b5 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802189:	83 ec 08             	sub    $0x8,%esp
+  80218c:	68 00 a0 80 00       	push   $0x80a000
+  802191:	53                   	push   %ebx
+  802192:	e8 b4 e9 ff ff       	call   800b4b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802197:	a1 80 a0 80 00       	mov    0x80a080,%eax
+  80219c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021a2:	a1 84 a0 80 00       	mov    0x80a084,%eax
+  8021a7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8021ad:	83 c4 10             	add    $0x10,%esp
+  8021b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b8:	c9                   	leave
+  8021b9:	c3                   	ret
+
+008021ba <devfile_write>:
+{
+  8021ba:	55                   	push   %ebp
+  8021bb:	89 e5                	mov    %esp,%ebp
+  8021bd:	83 ec 0c             	sub    $0xc,%esp
+  8021c0:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021c6:	8b 52 0c             	mov    0xc(%edx),%edx
+  8021c9:	89 15 00 a0 80 00    	mov    %edx,0x80a000
+	fsipcbuf.write.req_n = n;
+  8021cf:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8021d4:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8021d9:	39 d0                	cmp    %edx,%eax
+  8021db:	0f 47 c2             	cmova  %edx,%eax
+  8021de:	50                   	push   %eax
+  8021df:	ff 75 0c             	push   0xc(%ebp)
+  8021e2:	68 08 a0 80 00       	push   $0x80a008
+  8021e7:	e8 e5 ea ff ff       	call   800cd1 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8021ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021f6:	e8 cd fe ff ff       	call   8020c8 <fsipc>
+}
+  8021fb:	c9                   	leave
+  8021fc:	c3                   	ret
+
+008021fd <devfile_read>:
+{
+  8021fd:	55                   	push   %ebp
+  8021fe:	89 e5                	mov    %esp,%ebp
+  802200:	56                   	push   %esi
+  802201:	53                   	push   %ebx
+  802202:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802205:	8b 45 08             	mov    0x8(%ebp),%eax
+  802208:	8b 40 0c             	mov    0xc(%eax),%eax
+  80220b:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	fsipcbuf.read.req_n = n;
+  802210:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802220:	e8 a3 fe ff ff       	call   8020c8 <fsipc>
+  802225:	89 c3                	mov    %eax,%ebx
+  802227:	85 c0                	test   %eax,%eax
+  802229:	78 1f                	js     80224a <devfile_read+0x4d>
+	assert(r <= n);
+  80222b:	39 c6                	cmp    %eax,%esi
+  80222d:	72 24                	jb     802253 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80222f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802234:	7f 33                	jg     802269 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802236:	83 ec 04             	sub    $0x4,%esp
+  802239:	50                   	push   %eax
+  80223a:	68 00 a0 80 00       	push   $0x80a000
+  80223f:	ff 75 0c             	push   0xc(%ebp)
+  802242:	e8 8a ea ff ff       	call   800cd1 <memmove>
+	return r;
+  802247:	83 c4 10             	add    $0x10,%esp
+}
+  80224a:	89 d8                	mov    %ebx,%eax
+  80224c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80224f:	5b                   	pop    %ebx
+  802250:	5e                   	pop    %esi
+  802251:	5d                   	pop    %ebp
+  802252:	c3                   	ret
+	assert(r <= n);
+  802253:	68 08 35 80 00       	push   $0x803508
+  802258:	68 a3 2e 80 00       	push   $0x802ea3
+  80225d:	6a 76                	push   $0x76
+  80225f:	68 0f 35 80 00       	push   $0x80350f
+  802264:	e8 bf e1 ff ff       	call   800428 <_panic>
+	assert(r <= PGSIZE);
+  802269:	68 1a 35 80 00       	push   $0x80351a
+  80226e:	68 a3 2e 80 00       	push   $0x802ea3
+  802273:	6a 77                	push   $0x77
+  802275:	68 0f 35 80 00       	push   $0x80350f
+  80227a:	e8 a9 e1 ff ff       	call   800428 <_panic>
+
+0080227f <open>:
+{
+  80227f:	55                   	push   %ebp
+  802280:	89 e5                	mov    %esp,%ebp
+  802282:	56                   	push   %esi
+  802283:	53                   	push   %ebx
+  802284:	83 ec 1c             	sub    $0x1c,%esp
+  802287:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80228a:	56                   	push   %esi
+  80228b:	e8 80 e8 ff ff       	call   800b10 <strlen>
+  802290:	83 c4 10             	add    $0x10,%esp
+  802293:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802298:	7f 6c                	jg     802306 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80229a:	83 ec 0c             	sub    $0xc,%esp
+  80229d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a0:	50                   	push   %eax
+  8022a1:	e8 3a f8 ff ff       	call   801ae0 <fd_alloc>
+  8022a6:	89 c3                	mov    %eax,%ebx
+  8022a8:	83 c4 10             	add    $0x10,%esp
+  8022ab:	85 c0                	test   %eax,%eax
+  8022ad:	78 3c                	js     8022eb <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8022af:	83 ec 08             	sub    $0x8,%esp
+  8022b2:	56                   	push   %esi
+  8022b3:	68 00 a0 80 00       	push   $0x80a000
+  8022b8:	e8 8e e8 ff ff       	call   800b4b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022c0:	a3 00 a4 80 00       	mov    %eax,0x80a400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022cd:	e8 f6 fd ff ff       	call   8020c8 <fsipc>
+  8022d2:	89 c3                	mov    %eax,%ebx
+  8022d4:	83 c4 10             	add    $0x10,%esp
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	78 19                	js     8022f4 <open+0x75>
+	return fd2num(fd);
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	ff 75 f4             	push   -0xc(%ebp)
+  8022e1:	e8 d3 f7 ff ff       	call   801ab9 <fd2num>
+  8022e6:	89 c3                	mov    %eax,%ebx
+  8022e8:	83 c4 10             	add    $0x10,%esp
+}
+  8022eb:	89 d8                	mov    %ebx,%eax
+  8022ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022f0:	5b                   	pop    %ebx
+  8022f1:	5e                   	pop    %esi
+  8022f2:	5d                   	pop    %ebp
+  8022f3:	c3                   	ret
+		fd_close(fd, 0);
+  8022f4:	83 ec 08             	sub    $0x8,%esp
+  8022f7:	6a 00                	push   $0x0
+  8022f9:	ff 75 f4             	push   -0xc(%ebp)
+  8022fc:	e8 f8 f8 ff ff       	call   801bf9 <fd_close>
+		return r;
+  802301:	83 c4 10             	add    $0x10,%esp
+  802304:	eb e5                	jmp    8022eb <open+0x6c>
+		return -E_BAD_PATH;
+  802306:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80230b:	eb de                	jmp    8022eb <open+0x6c>
+
+0080230d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802313:	ba 00 00 00 00       	mov    $0x0,%edx
+  802318:	b8 08 00 00 00       	mov    $0x8,%eax
+  80231d:	e8 a6 fd ff ff       	call   8020c8 <fsipc>
+}
+  802322:	c9                   	leave
+  802323:	c3                   	ret
+
+00802324 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802324:	55                   	push   %ebp
+  802325:	89 e5                	mov    %esp,%ebp
+  802327:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80232a:	68 26 35 80 00       	push   $0x803526
+  80232f:	ff 75 0c             	push   0xc(%ebp)
+  802332:	e8 14 e8 ff ff       	call   800b4b <strcpy>
+	return 0;
+}
+  802337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233c:	c9                   	leave
+  80233d:	c3                   	ret
+
+0080233e <devsock_close>:
+{
+  80233e:	55                   	push   %ebp
+  80233f:	89 e5                	mov    %esp,%ebp
+  802341:	53                   	push   %ebx
+  802342:	83 ec 10             	sub    $0x10,%esp
+  802345:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802348:	53                   	push   %ebx
+  802349:	e8 e4 0a 00 00       	call   802e32 <pageref>
+  80234e:	89 c2                	mov    %eax,%edx
+  802350:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802353:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802358:	83 fa 01             	cmp    $0x1,%edx
+  80235b:	74 05                	je     802362 <devsock_close+0x24>
+}
+  80235d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802360:	c9                   	leave
+  802361:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802362:	83 ec 0c             	sub    $0xc,%esp
+  802365:	ff 73 0c             	push   0xc(%ebx)
+  802368:	e8 b7 02 00 00       	call   802624 <nsipc_close>
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	eb eb                	jmp    80235d <devsock_close+0x1f>
+
+00802372 <devsock_write>:
+{
+  802372:	55                   	push   %ebp
+  802373:	89 e5                	mov    %esp,%ebp
+  802375:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802378:	6a 00                	push   $0x0
+  80237a:	ff 75 10             	push   0x10(%ebp)
+  80237d:	ff 75 0c             	push   0xc(%ebp)
+  802380:	8b 45 08             	mov    0x8(%ebp),%eax
+  802383:	ff 70 0c             	push   0xc(%eax)
+  802386:	e8 79 03 00 00       	call   802704 <nsipc_send>
+}
+  80238b:	c9                   	leave
+  80238c:	c3                   	ret
+
+0080238d <devsock_read>:
+{
+  80238d:	55                   	push   %ebp
+  80238e:	89 e5                	mov    %esp,%ebp
+  802390:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802393:	6a 00                	push   $0x0
+  802395:	ff 75 10             	push   0x10(%ebp)
+  802398:	ff 75 0c             	push   0xc(%ebp)
+  80239b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239e:	ff 70 0c             	push   0xc(%eax)
+  8023a1:	e8 ef 02 00 00       	call   802695 <nsipc_recv>
+}
+  8023a6:	c9                   	leave
+  8023a7:	c3                   	ret
+
+008023a8 <fd2sockid>:
+{
+  8023a8:	55                   	push   %ebp
+  8023a9:	89 e5                	mov    %esp,%ebp
+  8023ab:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8023ae:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8023b1:	52                   	push   %edx
+  8023b2:	50                   	push   %eax
+  8023b3:	e8 7e f7 ff ff       	call   801b36 <fd_lookup>
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	85 c0                	test   %eax,%eax
+  8023bd:	78 10                	js     8023cf <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8023bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c2:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8023c8:	39 08                	cmp    %ecx,(%eax)
+  8023ca:	75 05                	jne    8023d1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8023cc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023d6:	eb f7                	jmp    8023cf <fd2sockid+0x27>
+
+008023d8 <alloc_sockfd>:
+{
+  8023d8:	55                   	push   %ebp
+  8023d9:	89 e5                	mov    %esp,%ebp
+  8023db:	56                   	push   %esi
+  8023dc:	53                   	push   %ebx
+  8023dd:	83 ec 1c             	sub    $0x1c,%esp
+  8023e0:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8023e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023e5:	50                   	push   %eax
+  8023e6:	e8 f5 f6 ff ff       	call   801ae0 <fd_alloc>
+  8023eb:	89 c3                	mov    %eax,%ebx
+  8023ed:	83 c4 10             	add    $0x10,%esp
+  8023f0:	85 c0                	test   %eax,%eax
+  8023f2:	78 43                	js     802437 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8023f4:	83 ec 04             	sub    $0x4,%esp
+  8023f7:	68 07 04 00 00       	push   $0x407
+  8023fc:	ff 75 f4             	push   -0xc(%ebp)
+  8023ff:	6a 00                	push   $0x0
+  802401:	e8 3d ec ff ff       	call   801043 <sys_page_alloc>
+  802406:	89 c3                	mov    %eax,%ebx
+  802408:	83 c4 10             	add    $0x10,%esp
+  80240b:	85 c0                	test   %eax,%eax
+  80240d:	78 28                	js     802437 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80240f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802412:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802418:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80241a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80241d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802424:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802427:	83 ec 0c             	sub    $0xc,%esp
+  80242a:	50                   	push   %eax
+  80242b:	e8 89 f6 ff ff       	call   801ab9 <fd2num>
+  802430:	89 c3                	mov    %eax,%ebx
+  802432:	83 c4 10             	add    $0x10,%esp
+  802435:	eb 0c                	jmp    802443 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802437:	83 ec 0c             	sub    $0xc,%esp
+  80243a:	56                   	push   %esi
+  80243b:	e8 e4 01 00 00       	call   802624 <nsipc_close>
+		return r;
+  802440:	83 c4 10             	add    $0x10,%esp
+}
+  802443:	89 d8                	mov    %ebx,%eax
+  802445:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802448:	5b                   	pop    %ebx
+  802449:	5e                   	pop    %esi
+  80244a:	5d                   	pop    %ebp
+  80244b:	c3                   	ret
+
+0080244c <accept>:
+{
+  80244c:	55                   	push   %ebp
+  80244d:	89 e5                	mov    %esp,%ebp
+  80244f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802452:	8b 45 08             	mov    0x8(%ebp),%eax
+  802455:	e8 4e ff ff ff       	call   8023a8 <fd2sockid>
+  80245a:	85 c0                	test   %eax,%eax
+  80245c:	78 1b                	js     802479 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80245e:	83 ec 04             	sub    $0x4,%esp
+  802461:	ff 75 10             	push   0x10(%ebp)
+  802464:	ff 75 0c             	push   0xc(%ebp)
+  802467:	50                   	push   %eax
+  802468:	e8 0e 01 00 00       	call   80257b <nsipc_accept>
+  80246d:	83 c4 10             	add    $0x10,%esp
+  802470:	85 c0                	test   %eax,%eax
+  802472:	78 05                	js     802479 <accept+0x2d>
+	return alloc_sockfd(r);
+  802474:	e8 5f ff ff ff       	call   8023d8 <alloc_sockfd>
+}
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+
+0080247b <bind>:
+{
+  80247b:	55                   	push   %ebp
+  80247c:	89 e5                	mov    %esp,%ebp
+  80247e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802481:	8b 45 08             	mov    0x8(%ebp),%eax
+  802484:	e8 1f ff ff ff       	call   8023a8 <fd2sockid>
+  802489:	85 c0                	test   %eax,%eax
+  80248b:	78 12                	js     80249f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80248d:	83 ec 04             	sub    $0x4,%esp
+  802490:	ff 75 10             	push   0x10(%ebp)
+  802493:	ff 75 0c             	push   0xc(%ebp)
+  802496:	50                   	push   %eax
+  802497:	e8 31 01 00 00       	call   8025cd <nsipc_bind>
+  80249c:	83 c4 10             	add    $0x10,%esp
+}
+  80249f:	c9                   	leave
+  8024a0:	c3                   	ret
+
+008024a1 <shutdown>:
+{
+  8024a1:	55                   	push   %ebp
+  8024a2:	89 e5                	mov    %esp,%ebp
+  8024a4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024aa:	e8 f9 fe ff ff       	call   8023a8 <fd2sockid>
+  8024af:	85 c0                	test   %eax,%eax
+  8024b1:	78 0f                	js     8024c2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8024b3:	83 ec 08             	sub    $0x8,%esp
+  8024b6:	ff 75 0c             	push   0xc(%ebp)
+  8024b9:	50                   	push   %eax
+  8024ba:	e8 43 01 00 00       	call   802602 <nsipc_shutdown>
+  8024bf:	83 c4 10             	add    $0x10,%esp
+}
+  8024c2:	c9                   	leave
+  8024c3:	c3                   	ret
+
+008024c4 <connect>:
+{
+  8024c4:	55                   	push   %ebp
+  8024c5:	89 e5                	mov    %esp,%ebp
+  8024c7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024cd:	e8 d6 fe ff ff       	call   8023a8 <fd2sockid>
+  8024d2:	85 c0                	test   %eax,%eax
+  8024d4:	78 12                	js     8024e8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8024d6:	83 ec 04             	sub    $0x4,%esp
+  8024d9:	ff 75 10             	push   0x10(%ebp)
+  8024dc:	ff 75 0c             	push   0xc(%ebp)
+  8024df:	50                   	push   %eax
+  8024e0:	e8 59 01 00 00       	call   80263e <nsipc_connect>
+  8024e5:	83 c4 10             	add    $0x10,%esp
+}
+  8024e8:	c9                   	leave
+  8024e9:	c3                   	ret
+
+008024ea <listen>:
+{
+  8024ea:	55                   	push   %ebp
+  8024eb:	89 e5                	mov    %esp,%ebp
+  8024ed:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f3:	e8 b0 fe ff ff       	call   8023a8 <fd2sockid>
+  8024f8:	85 c0                	test   %eax,%eax
+  8024fa:	78 0f                	js     80250b <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8024fc:	83 ec 08             	sub    $0x8,%esp
+  8024ff:	ff 75 0c             	push   0xc(%ebp)
+  802502:	50                   	push   %eax
+  802503:	e8 6b 01 00 00       	call   802673 <nsipc_listen>
+  802508:	83 c4 10             	add    $0x10,%esp
+}
+  80250b:	c9                   	leave
+  80250c:	c3                   	ret
+
+0080250d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80250d:	55                   	push   %ebp
+  80250e:	89 e5                	mov    %esp,%ebp
+  802510:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802513:	ff 75 10             	push   0x10(%ebp)
+  802516:	ff 75 0c             	push   0xc(%ebp)
+  802519:	ff 75 08             	push   0x8(%ebp)
+  80251c:	e8 41 02 00 00       	call   802762 <nsipc_socket>
+  802521:	83 c4 10             	add    $0x10,%esp
+  802524:	85 c0                	test   %eax,%eax
+  802526:	78 05                	js     80252d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802528:	e8 ab fe ff ff       	call   8023d8 <alloc_sockfd>
+}
+  80252d:	c9                   	leave
+  80252e:	c3                   	ret
+
+0080252f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80252f:	55                   	push   %ebp
+  802530:	89 e5                	mov    %esp,%ebp
+  802532:	53                   	push   %ebx
+  802533:	83 ec 04             	sub    $0x4,%esp
+  802536:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802538:	83 3d 04 90 80 00 00 	cmpl   $0x0,0x809004
+  80253f:	74 26                	je     802567 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802541:	6a 07                	push   $0x7
+  802543:	68 00 b0 80 00       	push   $0x80b000
+  802548:	53                   	push   %ebx
+  802549:	ff 35 04 90 80 00    	push   0x809004
+  80254f:	e8 4b 08 00 00       	call   802d9f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802554:	83 c4 0c             	add    $0xc,%esp
+  802557:	6a 00                	push   $0x0
+  802559:	6a 00                	push   $0x0
+  80255b:	6a 00                	push   $0x0
+  80255d:	e8 25 08 00 00       	call   802d87 <ipc_recv>
+}
+  802562:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802565:	c9                   	leave
+  802566:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802567:	83 ec 0c             	sub    $0xc,%esp
+  80256a:	6a 02                	push   $0x2
+  80256c:	e8 82 08 00 00       	call   802df3 <ipc_find_env>
+  802571:	a3 04 90 80 00       	mov    %eax,0x809004
+  802576:	83 c4 10             	add    $0x10,%esp
+  802579:	eb c6                	jmp    802541 <nsipc+0x12>
+
+0080257b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80257b:	55                   	push   %ebp
+  80257c:	89 e5                	mov    %esp,%ebp
+  80257e:	56                   	push   %esi
+  80257f:	53                   	push   %ebx
+  802580:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802583:	8b 45 08             	mov    0x8(%ebp),%eax
+  802586:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80258b:	8b 06                	mov    (%esi),%eax
+  80258d:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802592:	b8 01 00 00 00       	mov    $0x1,%eax
+  802597:	e8 93 ff ff ff       	call   80252f <nsipc>
+  80259c:	89 c3                	mov    %eax,%ebx
+  80259e:	85 c0                	test   %eax,%eax
+  8025a0:	79 09                	jns    8025ab <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8025a2:	89 d8                	mov    %ebx,%eax
+  8025a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025a7:	5b                   	pop    %ebx
+  8025a8:	5e                   	pop    %esi
+  8025a9:	5d                   	pop    %ebp
+  8025aa:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8025ab:	83 ec 04             	sub    $0x4,%esp
+  8025ae:	ff 35 10 b0 80 00    	push   0x80b010
+  8025b4:	68 00 b0 80 00       	push   $0x80b000
+  8025b9:	ff 75 0c             	push   0xc(%ebp)
+  8025bc:	e8 10 e7 ff ff       	call   800cd1 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8025c1:	a1 10 b0 80 00       	mov    0x80b010,%eax
+  8025c6:	89 06                	mov    %eax,(%esi)
+  8025c8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8025cb:	eb d5                	jmp    8025a2 <nsipc_accept+0x27>
+
+008025cd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8025cd:	55                   	push   %ebp
+  8025ce:	89 e5                	mov    %esp,%ebp
+  8025d0:	53                   	push   %ebx
+  8025d1:	83 ec 08             	sub    $0x8,%esp
+  8025d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8025d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025da:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8025df:	53                   	push   %ebx
+  8025e0:	ff 75 0c             	push   0xc(%ebp)
+  8025e3:	68 04 b0 80 00       	push   $0x80b004
+  8025e8:	e8 e4 e6 ff ff       	call   800cd1 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8025ed:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_BIND);
+  8025f3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025f8:	e8 32 ff ff ff       	call   80252f <nsipc>
+}
+  8025fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802600:	c9                   	leave
+  802601:	c3                   	ret
+
+00802602 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802602:	55                   	push   %ebp
+  802603:	89 e5                	mov    %esp,%ebp
+  802605:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802608:	8b 45 08             	mov    0x8(%ebp),%eax
+  80260b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.shutdown.req_how = how;
+  802610:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802613:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_SHUTDOWN);
+  802618:	b8 03 00 00 00       	mov    $0x3,%eax
+  80261d:	e8 0d ff ff ff       	call   80252f <nsipc>
+}
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+
+00802624 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802624:	55                   	push   %ebp
+  802625:	89 e5                	mov    %esp,%ebp
+  802627:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80262a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80262d:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return nsipc(NSREQ_CLOSE);
+  802632:	b8 04 00 00 00       	mov    $0x4,%eax
+  802637:	e8 f3 fe ff ff       	call   80252f <nsipc>
+}
+  80263c:	c9                   	leave
+  80263d:	c3                   	ret
+
+0080263e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80263e:	55                   	push   %ebp
+  80263f:	89 e5                	mov    %esp,%ebp
+  802641:	53                   	push   %ebx
+  802642:	83 ec 08             	sub    $0x8,%esp
+  802645:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802648:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802650:	53                   	push   %ebx
+  802651:	ff 75 0c             	push   0xc(%ebp)
+  802654:	68 04 b0 80 00       	push   $0x80b004
+  802659:	e8 73 e6 ff ff       	call   800cd1 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80265e:	89 1d 14 b0 80 00    	mov    %ebx,0x80b014
+	return nsipc(NSREQ_CONNECT);
+  802664:	b8 05 00 00 00       	mov    $0x5,%eax
+  802669:	e8 c1 fe ff ff       	call   80252f <nsipc>
+}
+  80266e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802671:	c9                   	leave
+  802672:	c3                   	ret
+
+00802673 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802673:	55                   	push   %ebp
+  802674:	89 e5                	mov    %esp,%ebp
+  802676:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802679:	8b 45 08             	mov    0x8(%ebp),%eax
+  80267c:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.listen.req_backlog = backlog;
+  802681:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802684:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	return nsipc(NSREQ_LISTEN);
+  802689:	b8 06 00 00 00       	mov    $0x6,%eax
+  80268e:	e8 9c fe ff ff       	call   80252f <nsipc>
+}
+  802693:	c9                   	leave
+  802694:	c3                   	ret
+
+00802695 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802695:	55                   	push   %ebp
+  802696:	89 e5                	mov    %esp,%ebp
+  802698:	56                   	push   %esi
+  802699:	53                   	push   %ebx
+  80269a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80269d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a0:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.recv.req_len = len;
+  8026a5:	89 35 04 b0 80 00    	mov    %esi,0x80b004
+	nsipcbuf.recv.req_flags = flags;
+  8026ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026ae:	a3 08 b0 80 00       	mov    %eax,0x80b008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8026b3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026b8:	e8 72 fe ff ff       	call   80252f <nsipc>
+  8026bd:	89 c3                	mov    %eax,%ebx
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	78 22                	js     8026e5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8026c3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8026c8:	39 c6                	cmp    %eax,%esi
+  8026ca:	0f 4e c6             	cmovle %esi,%eax
+  8026cd:	39 c3                	cmp    %eax,%ebx
+  8026cf:	7f 1d                	jg     8026ee <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8026d1:	83 ec 04             	sub    $0x4,%esp
+  8026d4:	53                   	push   %ebx
+  8026d5:	68 00 b0 80 00       	push   $0x80b000
+  8026da:	ff 75 0c             	push   0xc(%ebp)
+  8026dd:	e8 ef e5 ff ff       	call   800cd1 <memmove>
+  8026e2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8026e5:	89 d8                	mov    %ebx,%eax
+  8026e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ea:	5b                   	pop    %ebx
+  8026eb:	5e                   	pop    %esi
+  8026ec:	5d                   	pop    %ebp
+  8026ed:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8026ee:	68 32 35 80 00       	push   $0x803532
+  8026f3:	68 a3 2e 80 00       	push   $0x802ea3
+  8026f8:	6a 62                	push   $0x62
+  8026fa:	68 47 35 80 00       	push   $0x803547
+  8026ff:	e8 24 dd ff ff       	call   800428 <_panic>
+
+00802704 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802704:	55                   	push   %ebp
+  802705:	89 e5                	mov    %esp,%ebp
+  802707:	53                   	push   %ebx
+  802708:	83 ec 04             	sub    $0x4,%esp
+  80270b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80270e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802711:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	assert(size < 1600);
+  802716:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80271c:	7f 2e                	jg     80274c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80271e:	83 ec 04             	sub    $0x4,%esp
+  802721:	53                   	push   %ebx
+  802722:	ff 75 0c             	push   0xc(%ebp)
+  802725:	68 0c b0 80 00       	push   $0x80b00c
+  80272a:	e8 a2 e5 ff ff       	call   800cd1 <memmove>
+	nsipcbuf.send.req_size = size;
+  80272f:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	nsipcbuf.send.req_flags = flags;
+  802735:	8b 45 14             	mov    0x14(%ebp),%eax
+  802738:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SEND);
+  80273d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802742:	e8 e8 fd ff ff       	call   80252f <nsipc>
+}
+  802747:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274a:	c9                   	leave
+  80274b:	c3                   	ret
+	assert(size < 1600);
+  80274c:	68 53 35 80 00       	push   $0x803553
+  802751:	68 a3 2e 80 00       	push   $0x802ea3
+  802756:	6a 6d                	push   $0x6d
+  802758:	68 47 35 80 00       	push   $0x803547
+  80275d:	e8 c6 dc ff ff       	call   800428 <_panic>
+
+00802762 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802762:	55                   	push   %ebp
+  802763:	89 e5                	mov    %esp,%ebp
+  802765:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802768:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276b:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	nsipcbuf.socket.req_type = type;
+  802770:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802773:	a3 04 b0 80 00       	mov    %eax,0x80b004
+	nsipcbuf.socket.req_protocol = protocol;
+  802778:	8b 45 10             	mov    0x10(%ebp),%eax
+  80277b:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	return nsipc(NSREQ_SOCKET);
+  802780:	b8 09 00 00 00       	mov    $0x9,%eax
+  802785:	e8 a5 fd ff ff       	call   80252f <nsipc>
+}
+  80278a:	c9                   	leave
+  80278b:	c3                   	ret
+
+0080278c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80278c:	55                   	push   %ebp
+  80278d:	89 e5                	mov    %esp,%ebp
+  80278f:	56                   	push   %esi
+  802790:	53                   	push   %ebx
+  802791:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802794:	83 ec 0c             	sub    $0xc,%esp
+  802797:	ff 75 08             	push   0x8(%ebp)
+  80279a:	e8 2a f3 ff ff       	call   801ac9 <fd2data>
+  80279f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8027a1:	83 c4 08             	add    $0x8,%esp
+  8027a4:	68 5f 35 80 00       	push   $0x80355f
+  8027a9:	53                   	push   %ebx
+  8027aa:	e8 9c e3 ff ff       	call   800b4b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8027af:	8b 46 04             	mov    0x4(%esi),%eax
+  8027b2:	2b 06                	sub    (%esi),%eax
+  8027b4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8027ba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8027c1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8027c4:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8027cb:	40 80 00 
+	return 0;
+}
+  8027ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027d6:	5b                   	pop    %ebx
+  8027d7:	5e                   	pop    %esi
+  8027d8:	5d                   	pop    %ebp
+  8027d9:	c3                   	ret
+
+008027da <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027da:	55                   	push   %ebp
+  8027db:	89 e5                	mov    %esp,%ebp
+  8027dd:	53                   	push   %ebx
+  8027de:	83 ec 0c             	sub    $0xc,%esp
+  8027e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8027e4:	53                   	push   %ebx
+  8027e5:	6a 00                	push   $0x0
+  8027e7:	e8 32 e9 ff ff       	call   80111e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8027ec:	89 1c 24             	mov    %ebx,(%esp)
+  8027ef:	e8 d5 f2 ff ff       	call   801ac9 <fd2data>
+  8027f4:	83 c4 08             	add    $0x8,%esp
+  8027f7:	50                   	push   %eax
+  8027f8:	6a 00                	push   $0x0
+  8027fa:	e8 1f e9 ff ff       	call   80111e <sys_page_unmap>
+}
+  8027ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802802:	c9                   	leave
+  802803:	c3                   	ret
+
+00802804 <_pipeisclosed>:
+{
+  802804:	55                   	push   %ebp
+  802805:	89 e5                	mov    %esp,%ebp
+  802807:	57                   	push   %edi
+  802808:	56                   	push   %esi
+  802809:	53                   	push   %ebx
+  80280a:	83 ec 1c             	sub    $0x1c,%esp
+  80280d:	89 c7                	mov    %eax,%edi
+  80280f:	89 d6                	mov    %edx,%esi
+  802811:	eb 3c                	jmp    80284f <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802813:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802816:	83 ec 0c             	sub    $0xc,%esp
+  802819:	57                   	push   %edi
+  80281a:	e8 13 06 00 00       	call   802e32 <pageref>
+  80281f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802822:	89 34 24             	mov    %esi,(%esp)
+  802825:	e8 08 06 00 00       	call   802e32 <pageref>
+  80282a:	89 c2                	mov    %eax,%edx
+  80282c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80282e:	05 00 00 00 20       	add    $0x20000000,%eax
+  802833:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802836:	8b 0d 08 90 80 00    	mov    0x809008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80283c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802841:	76 31                	jbe    802874 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802843:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802846:	39 c3                	cmp    %eax,%ebx
+  802848:	74 76                	je     8028c0 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  80284a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80284d:	74 36                	je     802885 <_pipeisclosed+0x81>
+  80284f:	89 e0                	mov    %esp,%eax
+  802851:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802856:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80285c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802861:	77 b0                	ja     802813 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802863:	c1 e8 10             	shr    $0x10,%eax
+  802866:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80286c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802872:	eb 9f                	jmp    802813 <_pipeisclosed+0xf>
+  802874:	c1 e8 10             	shr    $0x10,%eax
+  802877:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80287d:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802883:	eb be                	jmp    802843 <_pipeisclosed+0x3f>
+  802885:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802887:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80288c:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802892:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802897:	76 16                	jbe    8028af <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802899:	8b 42 58             	mov    0x58(%edx),%eax
+  80289c:	6a 01                	push   $0x1
+  80289e:	50                   	push   %eax
+  80289f:	53                   	push   %ebx
+  8028a0:	68 66 35 80 00       	push   $0x803566
+  8028a5:	e8 59 dc ff ff       	call   800503 <cprintf>
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	eb a0                	jmp    80284f <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8028af:	c1 e8 10             	shr    $0x10,%eax
+  8028b2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8028b8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8028be:	eb d9                	jmp    802899 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8028c0:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8028c3:	0f 94 c0             	sete   %al
+  8028c6:	0f b6 c0             	movzbl %al,%eax
+}
+  8028c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028cc:	5b                   	pop    %ebx
+  8028cd:	5e                   	pop    %esi
+  8028ce:	5f                   	pop    %edi
+  8028cf:	5d                   	pop    %ebp
+  8028d0:	c3                   	ret
+
+008028d1 <devpipe_write>:
+{
+  8028d1:	55                   	push   %ebp
+  8028d2:	89 e5                	mov    %esp,%ebp
+  8028d4:	57                   	push   %edi
+  8028d5:	56                   	push   %esi
+  8028d6:	53                   	push   %ebx
+  8028d7:	83 ec 28             	sub    $0x28,%esp
+  8028da:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8028dd:	56                   	push   %esi
+  8028de:	e8 e6 f1 ff ff       	call   801ac9 <fd2data>
+  8028e3:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8028e5:	83 c4 10             	add    $0x10,%esp
+  8028e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ed:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028f0:	75 09                	jne    8028fb <devpipe_write+0x2a>
+	return i;
+  8028f2:	89 f8                	mov    %edi,%eax
+  8028f4:	eb 23                	jmp    802919 <devpipe_write+0x48>
+			sys_yield();
+  8028f6:	e8 02 e7 ff ff       	call   800ffd <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028fb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028fe:	8b 0b                	mov    (%ebx),%ecx
+  802900:	8d 51 20             	lea    0x20(%ecx),%edx
+  802903:	39 d0                	cmp    %edx,%eax
+  802905:	72 1a                	jb     802921 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802907:	89 da                	mov    %ebx,%edx
+  802909:	89 f0                	mov    %esi,%eax
+  80290b:	e8 f4 fe ff ff       	call   802804 <_pipeisclosed>
+  802910:	85 c0                	test   %eax,%eax
+  802912:	74 e2                	je     8028f6 <devpipe_write+0x25>
+				return 0;
+  802914:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802919:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80291c:	5b                   	pop    %ebx
+  80291d:	5e                   	pop    %esi
+  80291e:	5f                   	pop    %edi
+  80291f:	5d                   	pop    %ebp
+  802920:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802921:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802924:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802928:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80292b:	89 c2                	mov    %eax,%edx
+  80292d:	c1 fa 1f             	sar    $0x1f,%edx
+  802930:	89 d1                	mov    %edx,%ecx
+  802932:	c1 e9 1b             	shr    $0x1b,%ecx
+  802935:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802938:	83 e2 1f             	and    $0x1f,%edx
+  80293b:	29 ca                	sub    %ecx,%edx
+  80293d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802941:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802945:	83 c0 01             	add    $0x1,%eax
+  802948:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80294b:	83 c7 01             	add    $0x1,%edi
+  80294e:	eb 9d                	jmp    8028ed <devpipe_write+0x1c>
+
+00802950 <devpipe_read>:
+{
+  802950:	55                   	push   %ebp
+  802951:	89 e5                	mov    %esp,%ebp
+  802953:	57                   	push   %edi
+  802954:	56                   	push   %esi
+  802955:	53                   	push   %ebx
+  802956:	83 ec 18             	sub    $0x18,%esp
+  802959:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80295c:	57                   	push   %edi
+  80295d:	e8 67 f1 ff ff       	call   801ac9 <fd2data>
+  802962:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802964:	83 c4 10             	add    $0x10,%esp
+  802967:	be 00 00 00 00       	mov    $0x0,%esi
+  80296c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80296f:	75 13                	jne    802984 <devpipe_read+0x34>
+	return i;
+  802971:	89 f0                	mov    %esi,%eax
+  802973:	eb 02                	jmp    802977 <devpipe_read+0x27>
+				return i;
+  802975:	89 f0                	mov    %esi,%eax
+}
+  802977:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80297a:	5b                   	pop    %ebx
+  80297b:	5e                   	pop    %esi
+  80297c:	5f                   	pop    %edi
+  80297d:	5d                   	pop    %ebp
+  80297e:	c3                   	ret
+			sys_yield();
+  80297f:	e8 79 e6 ff ff       	call   800ffd <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802984:	8b 03                	mov    (%ebx),%eax
+  802986:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802989:	75 18                	jne    8029a3 <devpipe_read+0x53>
+			if (i > 0)
+  80298b:	85 f6                	test   %esi,%esi
+  80298d:	75 e6                	jne    802975 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80298f:	89 da                	mov    %ebx,%edx
+  802991:	89 f8                	mov    %edi,%eax
+  802993:	e8 6c fe ff ff       	call   802804 <_pipeisclosed>
+  802998:	85 c0                	test   %eax,%eax
+  80299a:	74 e3                	je     80297f <devpipe_read+0x2f>
+				return 0;
+  80299c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a1:	eb d4                	jmp    802977 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8029a3:	99                   	cltd
+  8029a4:	c1 ea 1b             	shr    $0x1b,%edx
+  8029a7:	01 d0                	add    %edx,%eax
+  8029a9:	83 e0 1f             	and    $0x1f,%eax
+  8029ac:	29 d0                	sub    %edx,%eax
+  8029ae:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8029b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029b6:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8029b9:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8029bc:	83 c6 01             	add    $0x1,%esi
+  8029bf:	eb ab                	jmp    80296c <devpipe_read+0x1c>
+
+008029c1 <pipe>:
+{
+  8029c1:	55                   	push   %ebp
+  8029c2:	89 e5                	mov    %esp,%ebp
+  8029c4:	56                   	push   %esi
+  8029c5:	53                   	push   %ebx
+  8029c6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8029c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029cc:	50                   	push   %eax
+  8029cd:	e8 0e f1 ff ff       	call   801ae0 <fd_alloc>
+  8029d2:	89 c3                	mov    %eax,%ebx
+  8029d4:	83 c4 10             	add    $0x10,%esp
+  8029d7:	85 c0                	test   %eax,%eax
+  8029d9:	0f 88 23 01 00 00    	js     802b02 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029df:	83 ec 04             	sub    $0x4,%esp
+  8029e2:	68 07 04 00 00       	push   $0x407
+  8029e7:	ff 75 f4             	push   -0xc(%ebp)
+  8029ea:	6a 00                	push   $0x0
+  8029ec:	e8 52 e6 ff ff       	call   801043 <sys_page_alloc>
+  8029f1:	89 c3                	mov    %eax,%ebx
+  8029f3:	83 c4 10             	add    $0x10,%esp
+  8029f6:	85 c0                	test   %eax,%eax
+  8029f8:	0f 88 04 01 00 00    	js     802b02 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8029fe:	83 ec 0c             	sub    $0xc,%esp
+  802a01:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a04:	50                   	push   %eax
+  802a05:	e8 d6 f0 ff ff       	call   801ae0 <fd_alloc>
+  802a0a:	89 c3                	mov    %eax,%ebx
+  802a0c:	83 c4 10             	add    $0x10,%esp
+  802a0f:	85 c0                	test   %eax,%eax
+  802a11:	0f 88 db 00 00 00    	js     802af2 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a17:	83 ec 04             	sub    $0x4,%esp
+  802a1a:	68 07 04 00 00       	push   $0x407
+  802a1f:	ff 75 f0             	push   -0x10(%ebp)
+  802a22:	6a 00                	push   $0x0
+  802a24:	e8 1a e6 ff ff       	call   801043 <sys_page_alloc>
+  802a29:	89 c3                	mov    %eax,%ebx
+  802a2b:	83 c4 10             	add    $0x10,%esp
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	0f 88 bc 00 00 00    	js     802af2 <pipe+0x131>
+	va = fd2data(fd0);
+  802a36:	83 ec 0c             	sub    $0xc,%esp
+  802a39:	ff 75 f4             	push   -0xc(%ebp)
+  802a3c:	e8 88 f0 ff ff       	call   801ac9 <fd2data>
+  802a41:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a43:	83 c4 0c             	add    $0xc,%esp
+  802a46:	68 07 04 00 00       	push   $0x407
+  802a4b:	50                   	push   %eax
+  802a4c:	6a 00                	push   $0x0
+  802a4e:	e8 f0 e5 ff ff       	call   801043 <sys_page_alloc>
+  802a53:	89 c3                	mov    %eax,%ebx
+  802a55:	83 c4 10             	add    $0x10,%esp
+  802a58:	85 c0                	test   %eax,%eax
+  802a5a:	0f 88 82 00 00 00    	js     802ae2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a60:	83 ec 0c             	sub    $0xc,%esp
+  802a63:	ff 75 f0             	push   -0x10(%ebp)
+  802a66:	e8 5e f0 ff ff       	call   801ac9 <fd2data>
+  802a6b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a72:	50                   	push   %eax
+  802a73:	6a 00                	push   $0x0
+  802a75:	56                   	push   %esi
+  802a76:	6a 00                	push   $0x0
+  802a78:	e8 33 e6 ff ff       	call   8010b0 <sys_page_map>
+  802a7d:	89 c3                	mov    %eax,%ebx
+  802a7f:	83 c4 20             	add    $0x20,%esp
+  802a82:	85 c0                	test   %eax,%eax
+  802a84:	78 4e                	js     802ad4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802a86:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802a8b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a8e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802a90:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a93:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802a9a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a9d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802a9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802aa2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802aa9:	83 ec 0c             	sub    $0xc,%esp
+  802aac:	ff 75 f4             	push   -0xc(%ebp)
+  802aaf:	e8 05 f0 ff ff       	call   801ab9 <fd2num>
+  802ab4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ab7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802ab9:	83 c4 04             	add    $0x4,%esp
+  802abc:	ff 75 f0             	push   -0x10(%ebp)
+  802abf:	e8 f5 ef ff ff       	call   801ab9 <fd2num>
+  802ac4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ac7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802aca:	83 c4 10             	add    $0x10,%esp
+  802acd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad2:	eb 2e                	jmp    802b02 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802ad4:	83 ec 08             	sub    $0x8,%esp
+  802ad7:	56                   	push   %esi
+  802ad8:	6a 00                	push   $0x0
+  802ada:	e8 3f e6 ff ff       	call   80111e <sys_page_unmap>
+  802adf:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802ae2:	83 ec 08             	sub    $0x8,%esp
+  802ae5:	ff 75 f0             	push   -0x10(%ebp)
+  802ae8:	6a 00                	push   $0x0
+  802aea:	e8 2f e6 ff ff       	call   80111e <sys_page_unmap>
+  802aef:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802af2:	83 ec 08             	sub    $0x8,%esp
+  802af5:	ff 75 f4             	push   -0xc(%ebp)
+  802af8:	6a 00                	push   $0x0
+  802afa:	e8 1f e6 ff ff       	call   80111e <sys_page_unmap>
+  802aff:	83 c4 10             	add    $0x10,%esp
+}
+  802b02:	89 d8                	mov    %ebx,%eax
+  802b04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b07:	5b                   	pop    %ebx
+  802b08:	5e                   	pop    %esi
+  802b09:	5d                   	pop    %ebp
+  802b0a:	c3                   	ret
+
+00802b0b <pipeisclosed>:
+{
+  802b0b:	55                   	push   %ebp
+  802b0c:	89 e5                	mov    %esp,%ebp
+  802b0e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b14:	50                   	push   %eax
+  802b15:	ff 75 08             	push   0x8(%ebp)
+  802b18:	e8 19 f0 ff ff       	call   801b36 <fd_lookup>
+  802b1d:	83 c4 10             	add    $0x10,%esp
+  802b20:	85 c0                	test   %eax,%eax
+  802b22:	78 18                	js     802b3c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802b24:	83 ec 0c             	sub    $0xc,%esp
+  802b27:	ff 75 f4             	push   -0xc(%ebp)
+  802b2a:	e8 9a ef ff ff       	call   801ac9 <fd2data>
+  802b2f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802b31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b34:	e8 cb fc ff ff       	call   802804 <_pipeisclosed>
+  802b39:	83 c4 10             	add    $0x10,%esp
+}
+  802b3c:	c9                   	leave
+  802b3d:	c3                   	ret
+
+00802b3e <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b43:	c3                   	ret
+
+00802b44 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b44:	55                   	push   %ebp
+  802b45:	89 e5                	mov    %esp,%ebp
+  802b47:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802b4a:	68 7e 35 80 00       	push   $0x80357e
+  802b4f:	ff 75 0c             	push   0xc(%ebp)
+  802b52:	e8 f4 df ff ff       	call   800b4b <strcpy>
+	return 0;
+}
+  802b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5c:	c9                   	leave
+  802b5d:	c3                   	ret
+
+00802b5e <devcons_write>:
+{
+  802b5e:	55                   	push   %ebp
+  802b5f:	89 e5                	mov    %esp,%ebp
+  802b61:	57                   	push   %edi
+  802b62:	56                   	push   %esi
+  802b63:	53                   	push   %ebx
+  802b64:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802b6a:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802b6f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802b75:	eb 2e                	jmp    802ba5 <devcons_write+0x47>
+		m = n - tot;
+  802b77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b7a:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802b7c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b81:	39 c3                	cmp    %eax,%ebx
+  802b83:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802b86:	83 ec 04             	sub    $0x4,%esp
+  802b89:	53                   	push   %ebx
+  802b8a:	89 f0                	mov    %esi,%eax
+  802b8c:	03 45 0c             	add    0xc(%ebp),%eax
+  802b8f:	50                   	push   %eax
+  802b90:	57                   	push   %edi
+  802b91:	e8 3b e1 ff ff       	call   800cd1 <memmove>
+		sys_cputs(buf, m);
+  802b96:	83 c4 08             	add    $0x8,%esp
+  802b99:	53                   	push   %ebx
+  802b9a:	57                   	push   %edi
+  802b9b:	e8 24 e3 ff ff       	call   800ec4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802ba0:	01 de                	add    %ebx,%esi
+  802ba2:	83 c4 10             	add    $0x10,%esp
+  802ba5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ba8:	72 cd                	jb     802b77 <devcons_write+0x19>
+}
+  802baa:	89 f0                	mov    %esi,%eax
+  802bac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802baf:	5b                   	pop    %ebx
+  802bb0:	5e                   	pop    %esi
+  802bb1:	5f                   	pop    %edi
+  802bb2:	5d                   	pop    %ebp
+  802bb3:	c3                   	ret
+
+00802bb4 <devcons_read>:
+{
+  802bb4:	55                   	push   %ebp
+  802bb5:	89 e5                	mov    %esp,%ebp
+  802bb7:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbf:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802bc3:	75 07                	jne    802bcc <devcons_read+0x18>
+  802bc5:	eb 1f                	jmp    802be6 <devcons_read+0x32>
+		sys_yield();
+  802bc7:	e8 31 e4 ff ff       	call   800ffd <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802bcc:	e8 37 e3 ff ff       	call   800f08 <sys_cgetc>
+  802bd1:	85 c0                	test   %eax,%eax
+  802bd3:	74 f2                	je     802bc7 <devcons_read+0x13>
+	if (c < 0)
+  802bd5:	78 0f                	js     802be6 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802bd7:	83 f8 04             	cmp    $0x4,%eax
+  802bda:	74 0c                	je     802be8 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802bdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bdf:	88 02                	mov    %al,(%edx)
+	return 1;
+  802be1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802be6:	c9                   	leave
+  802be7:	c3                   	ret
+		return 0;
+  802be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bed:	eb f7                	jmp    802be6 <devcons_read+0x32>
+
+00802bef <cputchar>:
+{
+  802bef:	55                   	push   %ebp
+  802bf0:	89 e5                	mov    %esp,%ebp
+  802bf2:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802bf5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf8:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802bfb:	6a 01                	push   $0x1
+  802bfd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c00:	50                   	push   %eax
+  802c01:	e8 be e2 ff ff       	call   800ec4 <sys_cputs>
+}
+  802c06:	83 c4 10             	add    $0x10,%esp
+  802c09:	c9                   	leave
+  802c0a:	c3                   	ret
+
+00802c0b <getchar>:
+{
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802c11:	6a 01                	push   $0x1
+  802c13:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c16:	50                   	push   %eax
+  802c17:	6a 00                	push   $0x0
+  802c19:	e8 9e f1 ff ff       	call   801dbc <read>
+	if (r < 0)
+  802c1e:	83 c4 10             	add    $0x10,%esp
+  802c21:	85 c0                	test   %eax,%eax
+  802c23:	78 06                	js     802c2b <getchar+0x20>
+	if (r < 1)
+  802c25:	74 06                	je     802c2d <getchar+0x22>
+	return c;
+  802c27:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c2b:	c9                   	leave
+  802c2c:	c3                   	ret
+		return -E_EOF;
+  802c2d:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c32:	eb f7                	jmp    802c2b <getchar+0x20>
+
+00802c34 <iscons>:
+{
+  802c34:	55                   	push   %ebp
+  802c35:	89 e5                	mov    %esp,%ebp
+  802c37:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c3d:	50                   	push   %eax
+  802c3e:	ff 75 08             	push   0x8(%ebp)
+  802c41:	e8 f0 ee ff ff       	call   801b36 <fd_lookup>
+  802c46:	83 c4 10             	add    $0x10,%esp
+  802c49:	85 c0                	test   %eax,%eax
+  802c4b:	78 11                	js     802c5e <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802c4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c50:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c56:	39 10                	cmp    %edx,(%eax)
+  802c58:	0f 94 c0             	sete   %al
+  802c5b:	0f b6 c0             	movzbl %al,%eax
+}
+  802c5e:	c9                   	leave
+  802c5f:	c3                   	ret
+
+00802c60 <opencons>:
+{
+  802c60:	55                   	push   %ebp
+  802c61:	89 e5                	mov    %esp,%ebp
+  802c63:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802c66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c69:	50                   	push   %eax
+  802c6a:	e8 71 ee ff ff       	call   801ae0 <fd_alloc>
+  802c6f:	83 c4 10             	add    $0x10,%esp
+  802c72:	85 c0                	test   %eax,%eax
+  802c74:	78 3a                	js     802cb0 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c76:	83 ec 04             	sub    $0x4,%esp
+  802c79:	68 07 04 00 00       	push   $0x407
+  802c7e:	ff 75 f4             	push   -0xc(%ebp)
+  802c81:	6a 00                	push   $0x0
+  802c83:	e8 bb e3 ff ff       	call   801043 <sys_page_alloc>
+  802c88:	83 c4 10             	add    $0x10,%esp
+  802c8b:	85 c0                	test   %eax,%eax
+  802c8d:	78 21                	js     802cb0 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802c8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c92:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c98:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802c9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c9d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802ca4:	83 ec 0c             	sub    $0xc,%esp
+  802ca7:	50                   	push   %eax
+  802ca8:	e8 0c ee ff ff       	call   801ab9 <fd2num>
+  802cad:	83 c4 10             	add    $0x10,%esp
+}
+  802cb0:	c9                   	leave
+  802cb1:	c3                   	ret
+
+00802cb2 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802cb2:	55                   	push   %ebp
+  802cb3:	89 e5                	mov    %esp,%ebp
+  802cb5:	56                   	push   %esi
+  802cb6:	53                   	push   %ebx
+  802cb7:	8b 75 08             	mov    0x8(%ebp),%esi
+  802cba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802cc7:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802cca:	83 ec 08             	sub    $0x8,%esp
+  802ccd:	ff 75 14             	push   0x14(%ebp)
+  802cd0:	50                   	push   %eax
+  802cd1:	e8 7e e7 ff ff       	call   801454 <sys_ipc_recv_until>
+  802cd6:	83 c4 10             	add    $0x10,%esp
+  802cd9:	85 c0                	test   %eax,%eax
+  802cdb:	78 61                	js     802d3e <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802cdd:	85 f6                	test   %esi,%esi
+  802cdf:	74 1c                	je     802cfd <ipc_recv_until+0x4b>
+  802ce1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ce3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ce8:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cee:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cf3:	76 5f                	jbe    802d54 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802cf5:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802cfb:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802cfd:	85 db                	test   %ebx,%ebx
+  802cff:	74 1c                	je     802d1d <ipc_recv_until+0x6b>
+  802d01:	89 e0                	mov    %esp,%eax
+  802d03:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d08:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d0e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d13:	76 50                	jbe    802d65 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802d15:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802d1b:	89 03                	mov    %eax,(%ebx)
+  802d1d:	89 e0                	mov    %esp,%eax
+  802d1f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d24:	8b 15 08 90 80 00    	mov    0x809008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d2a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d2f:	76 45                	jbe    802d76 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802d31:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802d37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d3a:	5b                   	pop    %ebx
+  802d3b:	5e                   	pop    %esi
+  802d3c:	5d                   	pop    %ebp
+  802d3d:	c3                   	ret
+		if (from_env_store)
+  802d3e:	85 f6                	test   %esi,%esi
+  802d40:	74 06                	je     802d48 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802d42:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802d48:	85 db                	test   %ebx,%ebx
+  802d4a:	74 eb                	je     802d37 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802d4c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802d52:	eb e3                	jmp    802d37 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d54:	c1 e8 10             	shr    $0x10,%eax
+  802d57:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d5d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d63:	eb 90                	jmp    802cf5 <ipc_recv_until+0x43>
+  802d65:	c1 e8 10             	shr    $0x10,%eax
+  802d68:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d6e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d74:	eb 9f                	jmp    802d15 <ipc_recv_until+0x63>
+  802d76:	c1 e8 10             	shr    $0x10,%eax
+  802d79:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d7f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d85:	eb aa                	jmp    802d31 <ipc_recv_until+0x7f>
+
+00802d87 <ipc_recv>:
+{
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+  802d8a:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802d8d:	6a 00                	push   $0x0
+  802d8f:	ff 75 10             	push   0x10(%ebp)
+  802d92:	ff 75 0c             	push   0xc(%ebp)
+  802d95:	ff 75 08             	push   0x8(%ebp)
+  802d98:	e8 15 ff ff ff       	call   802cb2 <ipc_recv_until>
+}
+  802d9d:	c9                   	leave
+  802d9e:	c3                   	ret
+
+00802d9f <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802d9f:	55                   	push   %ebp
+  802da0:	89 e5                	mov    %esp,%ebp
+  802da2:	57                   	push   %edi
+  802da3:	56                   	push   %esi
+  802da4:	53                   	push   %ebx
+  802da5:	83 ec 0c             	sub    $0xc,%esp
+  802da8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802dab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802dae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802db1:	85 db                	test   %ebx,%ebx
+  802db3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802db8:	0f 44 d8             	cmove  %eax,%ebx
+  802dbb:	eb 05                	jmp    802dc2 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802dbd:	e8 3b e2 ff ff       	call   800ffd <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802dc2:	ff 75 14             	push   0x14(%ebp)
+  802dc5:	53                   	push   %ebx
+  802dc6:	56                   	push   %esi
+  802dc7:	57                   	push   %edi
+  802dc8:	e8 d3 e5 ff ff       	call   8013a0 <sys_ipc_try_send>
+  802dcd:	83 c4 10             	add    $0x10,%esp
+  802dd0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802dd3:	74 e8                	je     802dbd <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802dd5:	85 c0                	test   %eax,%eax
+  802dd7:	78 08                	js     802de1 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ddc:	5b                   	pop    %ebx
+  802ddd:	5e                   	pop    %esi
+  802dde:	5f                   	pop    %edi
+  802ddf:	5d                   	pop    %ebp
+  802de0:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802de1:	50                   	push   %eax
+  802de2:	68 8a 35 80 00       	push   $0x80358a
+  802de7:	6a 4f                	push   $0x4f
+  802de9:	68 9d 35 80 00       	push   $0x80359d
+  802dee:	e8 35 d6 ff ff       	call   800428 <_panic>
+
+00802df3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802df3:	55                   	push   %ebp
+  802df4:	89 e5                	mov    %esp,%ebp
+  802df6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802df9:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802dfe:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802e04:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802e0a:	8b 52 50             	mov    0x50(%edx),%edx
+  802e0d:	39 ca                	cmp    %ecx,%edx
+  802e0f:	74 11                	je     802e22 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802e11:	83 c0 01             	add    $0x1,%eax
+  802e14:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802e19:	75 e3                	jne    802dfe <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e20:	eb 0e                	jmp    802e30 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802e22:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e28:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e2d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e30:	5d                   	pop    %ebp
+  802e31:	c3                   	ret
+
+00802e32 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e32:	55                   	push   %ebp
+  802e33:	89 e5                	mov    %esp,%ebp
+  802e35:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e38:	89 c2                	mov    %eax,%edx
+  802e3a:	c1 ea 16             	shr    $0x16,%edx
+  802e3d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802e44:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e49:	f6 c1 01             	test   $0x1,%cl
+  802e4c:	74 1a                	je     802e68 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802e4e:	c1 e8 0c             	shr    $0xc,%eax
+  802e51:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802e58:	a8 01                	test   $0x1,%al
+  802e5a:	74 0c                	je     802e68 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802e5c:	c1 e8 0c             	shr    $0xc,%eax
+  802e5f:	c1 e0 04             	shl    $0x4,%eax
+  802e62:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802e68:	89 d0                	mov    %edx,%eax
+  802e6a:	5d                   	pop    %ebp
+  802e6b:	c3                   	ret
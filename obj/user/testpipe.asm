@@ -0,0 +1,7404 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 43 03 00 00       	call   800374 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 7c             	sub    $0x7c,%esp
+	char buf[100];
+	int i, pid, p[2];
+
+	binaryname = "pipereadeof";
+  80003b:	c7 05 04 40 80 00 80 	movl   $0x803680,0x804004
+  800042:	36 80 00 
+
+	if ((i = pipe(p)) < 0)
+  800045:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 8b 30 00 00       	call   8030d9 <pipe>
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 46 01 00 00    	js     8001a1 <umain+0x16e>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80005b:	e8 de 1e 00 00       	call   801f3e <fork>
+  800060:	89 c3                	mov    %eax,%ebx
+  800062:	85 c0                	test   %eax,%eax
+  800064:	0f 88 49 01 00 00    	js     8001b3 <umain+0x180>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80006a:	0f 85 a9 01 00 00    	jne    800219 <umain+0x1e6>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800070:	8b 55 90             	mov    -0x70(%ebp),%edx
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800073:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800075:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80007a:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800080:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800085:	0f 86 3a 01 00 00    	jbe    8001c5 <umain+0x192>
+  80008b:	8b 41 48             	mov    0x48(%ecx),%eax
+  80008e:	83 ec 04             	sub    $0x4,%esp
+  800091:	52                   	push   %edx
+  800092:	50                   	push   %eax
+  800093:	68 a5 36 80 00       	push   $0x8036a5
+  800098:	e8 76 04 00 00       	call   800513 <cprintf>
+		close(p[1]);
+  80009d:	83 c4 04             	add    $0x4,%esp
+  8000a0:	ff 75 90             	push   -0x70(%ebp)
+  8000a3:	e8 f0 22 00 00       	call   802398 <close>
+		cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000a8:	8b 55 8c             	mov    -0x74(%ebp),%edx
+  8000ab:	89 e0                	mov    %esp,%eax
+  8000ad:	05 00 00 00 20       	add    $0x20000000,%eax
+  8000b2:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8000b5:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000bb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8000c0:	0f 86 13 01 00 00    	jbe    8001d9 <umain+0x1a6>
+  8000c6:	8b 41 48             	mov    0x48(%ecx),%eax
+  8000c9:	83 ec 04             	sub    $0x4,%esp
+  8000cc:	52                   	push   %edx
+  8000cd:	50                   	push   %eax
+  8000ce:	68 c2 36 80 00       	push   $0x8036c2
+  8000d3:	e8 3b 04 00 00       	call   800513 <cprintf>
+		i = readn(p[0], buf, sizeof buf-1);
+  8000d8:	83 c4 0c             	add    $0xc,%esp
+  8000db:	6a 63                	push   $0x63
+  8000dd:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000e0:	50                   	push   %eax
+  8000e1:	ff 75 8c             	push   -0x74(%ebp)
+  8000e4:	e8 92 24 00 00       	call   80257b <readn>
+  8000e9:	89 c6                	mov    %eax,%esi
+		if (i < 0)
+  8000eb:	83 c4 10             	add    $0x10,%esp
+  8000ee:	85 c0                	test   %eax,%eax
+  8000f0:	0f 88 f7 00 00 00    	js     8001ed <umain+0x1ba>
+			panic("read: %e", i);
+		buf[i] = 0;
+  8000f6:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+		if (strcmp(buf, msg) == 0)
+  8000fb:	83 ec 08             	sub    $0x8,%esp
+  8000fe:	ff 35 00 40 80 00    	push   0x804000
+  800104:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800107:	50                   	push   %eax
+  800108:	e8 ff 0a 00 00       	call   800c0c <strcmp>
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	0f 85 e7 00 00 00    	jne    8001ff <umain+0x1cc>
+			cprintf("\npipe read closed properly\n");
+  800118:	83 ec 0c             	sub    $0xc,%esp
+  80011b:	68 e8 36 80 00       	push   $0x8036e8
+  800120:	e8 ee 03 00 00       	call   800513 <cprintf>
+  800125:	83 c4 10             	add    $0x10,%esp
+		else
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+		exit();
+  800128:	e8 f1 02 00 00       	call   80041e <exit>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+			panic("write: %e", i);
+		close(p[1]);
+	}
+	wait(pid);
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	53                   	push   %ebx
+  800131:	e8 20 31 00 00       	call   803256 <wait>
+
+	binaryname = "pipewriteeof";
+  800136:	c7 05 04 40 80 00 3e 	movl   $0x80373e,0x804004
+  80013d:	37 80 00 
+	if ((i = pipe(p)) < 0)
+  800140:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800143:	89 04 24             	mov    %eax,(%esp)
+  800146:	e8 8e 2f 00 00       	call   8030d9 <pipe>
+  80014b:	89 c6                	mov    %eax,%esi
+  80014d:	83 c4 10             	add    $0x10,%esp
+  800150:	85 c0                	test   %eax,%eax
+  800152:	0f 88 a9 01 00 00    	js     800301 <umain+0x2ce>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  800158:	e8 e1 1d 00 00       	call   801f3e <fork>
+  80015d:	89 c3                	mov    %eax,%ebx
+  80015f:	85 c0                	test   %eax,%eax
+  800161:	0f 88 ac 01 00 00    	js     800313 <umain+0x2e0>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  800167:	0f 84 b8 01 00 00    	je     800325 <umain+0x2f2>
+				break;
+		}
+		cprintf("\npipe write closed properly\n");
+		exit();
+	}
+	close(p[0]);
+  80016d:	83 ec 0c             	sub    $0xc,%esp
+  800170:	ff 75 8c             	push   -0x74(%ebp)
+  800173:	e8 20 22 00 00       	call   802398 <close>
+	close(p[1]);
+  800178:	83 c4 04             	add    $0x4,%esp
+  80017b:	ff 75 90             	push   -0x70(%ebp)
+  80017e:	e8 15 22 00 00       	call   802398 <close>
+	wait(pid);
+  800183:	89 1c 24             	mov    %ebx,(%esp)
+  800186:	e8 cb 30 00 00       	call   803256 <wait>
+
+	cprintf("pipe tests passed\n");
+  80018b:	c7 04 24 6a 37 80 00 	movl   $0x80376a,(%esp)
+  800192:	e8 7c 03 00 00       	call   800513 <cprintf>
+}
+  800197:	83 c4 10             	add    $0x10,%esp
+  80019a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80019d:	5b                   	pop    %ebx
+  80019e:	5e                   	pop    %esi
+  80019f:	5d                   	pop    %ebp
+  8001a0:	c3                   	ret
+		panic("pipe: %e", i);
+  8001a1:	50                   	push   %eax
+  8001a2:	68 8c 36 80 00       	push   $0x80368c
+  8001a7:	6a 0e                	push   $0xe
+  8001a9:	68 95 36 80 00       	push   $0x803695
+  8001ae:	e8 85 02 00 00       	call   800438 <_panic>
+		panic("fork: %e", i);
+  8001b3:	56                   	push   %esi
+  8001b4:	68 30 3c 80 00       	push   $0x803c30
+  8001b9:	6a 11                	push   $0x11
+  8001bb:	68 95 36 80 00       	push   $0x803695
+  8001c0:	e8 73 02 00 00       	call   800438 <_panic>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8001c5:	c1 e8 10             	shr    $0x10,%eax
+  8001c8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001ce:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8001d4:	e9 b2 fe ff ff       	jmp    80008b <umain+0x58>
+  8001d9:	c1 e8 10             	shr    $0x10,%eax
+  8001dc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001e2:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8001e8:	e9 d9 fe ff ff       	jmp    8000c6 <umain+0x93>
+			panic("read: %e", i);
+  8001ed:	50                   	push   %eax
+  8001ee:	68 df 36 80 00       	push   $0x8036df
+  8001f3:	6a 19                	push   $0x19
+  8001f5:	68 95 36 80 00       	push   $0x803695
+  8001fa:	e8 39 02 00 00       	call   800438 <_panic>
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+  8001ff:	83 ec 04             	sub    $0x4,%esp
+  800202:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800205:	50                   	push   %eax
+  800206:	56                   	push   %esi
+  800207:	68 04 37 80 00       	push   $0x803704
+  80020c:	e8 02 03 00 00       	call   800513 <cprintf>
+  800211:	83 c4 10             	add    $0x10,%esp
+  800214:	e9 0f ff ff ff       	jmp    800128 <umain+0xf5>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  800219:	8b 55 8c             	mov    -0x74(%ebp),%edx
+  80021c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80021e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  800223:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800229:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80022e:	0f 86 93 00 00 00    	jbe    8002c7 <umain+0x294>
+  800234:	8b 41 48             	mov    0x48(%ecx),%eax
+  800237:	83 ec 04             	sub    $0x4,%esp
+  80023a:	52                   	push   %edx
+  80023b:	50                   	push   %eax
+  80023c:	68 a5 36 80 00       	push   $0x8036a5
+  800241:	e8 cd 02 00 00       	call   800513 <cprintf>
+		close(p[0]);
+  800246:	83 c4 04             	add    $0x4,%esp
+  800249:	ff 75 8c             	push   -0x74(%ebp)
+  80024c:	e8 47 21 00 00       	call   802398 <close>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800251:	8b 55 90             	mov    -0x70(%ebp),%edx
+  800254:	89 e0                	mov    %esp,%eax
+  800256:	05 00 00 00 20       	add    $0x20000000,%eax
+  80025b:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80025e:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800264:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  800269:	76 70                	jbe    8002db <umain+0x2a8>
+  80026b:	8b 41 48             	mov    0x48(%ecx),%eax
+  80026e:	83 ec 04             	sub    $0x4,%esp
+  800271:	52                   	push   %edx
+  800272:	50                   	push   %eax
+  800273:	68 17 37 80 00       	push   $0x803717
+  800278:	e8 96 02 00 00       	call   800513 <cprintf>
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  80027d:	83 c4 04             	add    $0x4,%esp
+  800280:	ff 35 00 40 80 00    	push   0x804000
+  800286:	e8 95 08 00 00       	call   800b20 <strlen>
+  80028b:	83 c4 0c             	add    $0xc,%esp
+  80028e:	50                   	push   %eax
+  80028f:	ff 35 00 40 80 00    	push   0x804000
+  800295:	ff 75 90             	push   -0x70(%ebp)
+  800298:	e8 25 23 00 00       	call   8025c2 <write>
+  80029d:	89 c6                	mov    %eax,%esi
+  80029f:	83 c4 04             	add    $0x4,%esp
+  8002a2:	ff 35 00 40 80 00    	push   0x804000
+  8002a8:	e8 73 08 00 00       	call   800b20 <strlen>
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	39 f0                	cmp    %esi,%eax
+  8002b2:	75 3b                	jne    8002ef <umain+0x2bc>
+		close(p[1]);
+  8002b4:	83 ec 0c             	sub    $0xc,%esp
+  8002b7:	ff 75 90             	push   -0x70(%ebp)
+  8002ba:	e8 d9 20 00 00       	call   802398 <close>
+  8002bf:	83 c4 10             	add    $0x10,%esp
+  8002c2:	e9 66 fe ff ff       	jmp    80012d <umain+0xfa>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8002c7:	c1 e8 10             	shr    $0x10,%eax
+  8002ca:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8002d0:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8002d6:	e9 59 ff ff ff       	jmp    800234 <umain+0x201>
+  8002db:	c1 e8 10             	shr    $0x10,%eax
+  8002de:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8002e4:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8002ea:	e9 7c ff ff ff       	jmp    80026b <umain+0x238>
+			panic("write: %e", i);
+  8002ef:	56                   	push   %esi
+  8002f0:	68 34 37 80 00       	push   $0x803734
+  8002f5:	6a 25                	push   $0x25
+  8002f7:	68 95 36 80 00       	push   $0x803695
+  8002fc:	e8 37 01 00 00       	call   800438 <_panic>
+		panic("pipe: %e", i);
+  800301:	50                   	push   %eax
+  800302:	68 8c 36 80 00       	push   $0x80368c
+  800307:	6a 2c                	push   $0x2c
+  800309:	68 95 36 80 00       	push   $0x803695
+  80030e:	e8 25 01 00 00       	call   800438 <_panic>
+		panic("fork: %e", i);
+  800313:	56                   	push   %esi
+  800314:	68 30 3c 80 00       	push   $0x803c30
+  800319:	6a 2f                	push   $0x2f
+  80031b:	68 95 36 80 00       	push   $0x803695
+  800320:	e8 13 01 00 00       	call   800438 <_panic>
+		close(p[0]);
+  800325:	83 ec 0c             	sub    $0xc,%esp
+  800328:	ff 75 8c             	push   -0x74(%ebp)
+  80032b:	e8 68 20 00 00       	call   802398 <close>
+  800330:	83 c4 10             	add    $0x10,%esp
+			cprintf(".");
+  800333:	83 ec 0c             	sub    $0xc,%esp
+  800336:	68 27 3c 80 00       	push   $0x803c27
+  80033b:	e8 d3 01 00 00       	call   800513 <cprintf>
+			if (write(p[1], "x", 1) != 1)
+  800340:	83 c4 0c             	add    $0xc,%esp
+  800343:	6a 01                	push   $0x1
+  800345:	68 4b 37 80 00       	push   $0x80374b
+  80034a:	ff 75 90             	push   -0x70(%ebp)
+  80034d:	e8 70 22 00 00       	call   8025c2 <write>
+  800352:	83 c4 10             	add    $0x10,%esp
+  800355:	83 f8 01             	cmp    $0x1,%eax
+  800358:	74 d9                	je     800333 <umain+0x300>
+		cprintf("\npipe write closed properly\n");
+  80035a:	83 ec 0c             	sub    $0xc,%esp
+  80035d:	68 4d 37 80 00       	push   $0x80374d
+  800362:	e8 ac 01 00 00       	call   800513 <cprintf>
+		exit();
+  800367:	e8 b2 00 00 00       	call   80041e <exit>
+  80036c:	83 c4 10             	add    $0x10,%esp
+  80036f:	e9 f9 fd ff ff       	jmp    80016d <umain+0x13a>
+
+00800374 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800374:	55                   	push   %ebp
+  800375:	89 e5                	mov    %esp,%ebp
+  800377:	57                   	push   %edi
+  800378:	56                   	push   %esi
+  800379:	53                   	push   %ebx
+  80037a:	83 ec 0c             	sub    $0xc,%esp
+  80037d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800380:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800383:	b8 01 00 00 00       	mov    $0x1,%eax
+  800388:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80038a:	c1 ea 0b             	shr    $0xb,%edx
+  80038d:	83 f2 01             	xor    $0x1,%edx
+  800390:	83 e2 01             	and    $0x1,%edx
+  800393:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800399:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8003a0:	00 00 00 
+	envid = sys_getenvid();
+  8003a3:	e8 1f 0c 00 00       	call   800fc7 <sys_getenvid>
+  8003a8:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8003af:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8003b5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8003bb:	8b 52 48             	mov    0x48(%edx),%edx
+  8003be:	39 ca                	cmp    %ecx,%edx
+  8003c0:	74 27                	je     8003e9 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8003c2:	83 c0 01             	add    $0x1,%eax
+  8003c5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8003ca:	75 e3                	jne    8003af <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8003cc:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8003d3:	75 24                	jne    8003f9 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8003d5:	83 ec 04             	sub    $0x4,%esp
+  8003d8:	68 c4 37 80 00       	push   $0x8037c4
+  8003dd:	6a 23                	push   $0x23
+  8003df:	68 e7 37 80 00       	push   $0x8037e7
+  8003e4:	e8 4f 00 00 00       	call   800438 <_panic>
+			mainenv = &envs[i];
+  8003e9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8003ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003f4:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003f9:	85 ff                	test   %edi,%edi
+  8003fb:	7e 07                	jle    800404 <libmain+0x90>
+		binaryname = argv[0];
+  8003fd:	8b 06                	mov    (%esi),%eax
+  8003ff:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  800404:	83 ec 08             	sub    $0x8,%esp
+  800407:	56                   	push   %esi
+  800408:	57                   	push   %edi
+  800409:	e8 25 fc ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80040e:	e8 0b 00 00 00       	call   80041e <exit>
+}
+  800413:	83 c4 10             	add    $0x10,%esp
+  800416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800419:	5b                   	pop    %ebx
+  80041a:	5e                   	pop    %esi
+  80041b:	5f                   	pop    %edi
+  80041c:	5d                   	pop    %ebp
+  80041d:	c3                   	ret
+
+0080041e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80041e:	55                   	push   %ebp
+  80041f:	89 e5                	mov    %esp,%ebp
+  800421:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800424:	e8 9c 1f 00 00       	call   8023c5 <close_all>
+	sys_env_destroy(0);
+  800429:	83 ec 0c             	sub    $0xc,%esp
+  80042c:	6a 00                	push   $0x0
+  80042e:	e8 2b 0b 00 00       	call   800f5e <sys_env_destroy>
+}
+  800433:	83 c4 10             	add    $0x10,%esp
+  800436:	c9                   	leave
+  800437:	c3                   	ret
+
+00800438 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800438:	55                   	push   %ebp
+  800439:	89 e5                	mov    %esp,%ebp
+  80043b:	56                   	push   %esi
+  80043c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80043d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800440:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  800446:	e8 7c 0b 00 00       	call   800fc7 <sys_getenvid>
+  80044b:	83 ec 0c             	sub    $0xc,%esp
+  80044e:	ff 75 0c             	push   0xc(%ebp)
+  800451:	ff 75 08             	push   0x8(%ebp)
+  800454:	56                   	push   %esi
+  800455:	50                   	push   %eax
+  800456:	68 00 38 80 00       	push   $0x803800
+  80045b:	e8 b3 00 00 00       	call   800513 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800460:	83 c4 18             	add    $0x18,%esp
+  800463:	53                   	push   %ebx
+  800464:	ff 75 10             	push   0x10(%ebp)
+  800467:	e8 56 00 00 00       	call   8004c2 <vcprintf>
+	cprintf("\n");
+  80046c:	c7 04 24 c0 36 80 00 	movl   $0x8036c0,(%esp)
+  800473:	e8 9b 00 00 00       	call   800513 <cprintf>
+  800478:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80047b:	cc                   	int3
+	while (1)
+  80047c:	eb fd                	jmp    80047b <_panic+0x43>
+
+0080047e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80047e:	55                   	push   %ebp
+  80047f:	89 e5                	mov    %esp,%ebp
+  800481:	53                   	push   %ebx
+  800482:	83 ec 04             	sub    $0x4,%esp
+  800485:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800488:	8b 13                	mov    (%ebx),%edx
+  80048a:	8d 42 01             	lea    0x1(%edx),%eax
+  80048d:	89 03                	mov    %eax,(%ebx)
+  80048f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800492:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800496:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80049b:	74 09                	je     8004a6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80049d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8004a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8004a4:	c9                   	leave
+  8004a5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8004a6:	83 ec 08             	sub    $0x8,%esp
+  8004a9:	68 ff 00 00 00       	push   $0xff
+  8004ae:	8d 43 08             	lea    0x8(%ebx),%eax
+  8004b1:	50                   	push   %eax
+  8004b2:	e8 1d 0a 00 00       	call   800ed4 <sys_cputs>
+		b->idx = 0;
+  8004b7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8004bd:	83 c4 10             	add    $0x10,%esp
+  8004c0:	eb db                	jmp    80049d <putch+0x1f>
+
+008004c2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004cb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004d2:	00 00 00 
+	b.cnt = 0;
+  8004d5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004dc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004df:	ff 75 0c             	push   0xc(%ebp)
+  8004e2:	ff 75 08             	push   0x8(%ebp)
+  8004e5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004eb:	50                   	push   %eax
+  8004ec:	68 7e 04 80 00       	push   $0x80047e
+  8004f1:	e8 fb 00 00 00       	call   8005f1 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004f6:	83 c4 08             	add    $0x8,%esp
+  8004f9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004ff:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800505:	50                   	push   %eax
+  800506:	e8 c9 09 00 00       	call   800ed4 <sys_cputs>
+
+	return b.cnt;
+}
+  80050b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800511:	c9                   	leave
+  800512:	c3                   	ret
+
+00800513 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800513:	55                   	push   %ebp
+  800514:	89 e5                	mov    %esp,%ebp
+  800516:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800519:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80051c:	50                   	push   %eax
+  80051d:	ff 75 08             	push   0x8(%ebp)
+  800520:	e8 9d ff ff ff       	call   8004c2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800525:	c9                   	leave
+  800526:	c3                   	ret
+
+00800527 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800527:	55                   	push   %ebp
+  800528:	89 e5                	mov    %esp,%ebp
+  80052a:	57                   	push   %edi
+  80052b:	56                   	push   %esi
+  80052c:	53                   	push   %ebx
+  80052d:	83 ec 1c             	sub    $0x1c,%esp
+  800530:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800533:	89 d6                	mov    %edx,%esi
+  800535:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800538:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80053b:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80053e:	73 0b                	jae    80054b <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800540:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800543:	c1 e7 08             	shl    $0x8,%edi
+  800546:	0b 7d 10             	or     0x10(%ebp),%edi
+  800549:	eb 36                	jmp    800581 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80054b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800553:	f7 75 08             	divl   0x8(%ebp)
+  800556:	89 c1                	mov    %eax,%ecx
+  800558:	ff 75 14             	push   0x14(%ebp)
+  80055b:	ff 75 10             	push   0x10(%ebp)
+  80055e:	83 eb 01             	sub    $0x1,%ebx
+  800561:	53                   	push   %ebx
+  800562:	ff 75 08             	push   0x8(%ebp)
+  800565:	89 f2                	mov    %esi,%edx
+  800567:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80056a:	e8 b8 ff ff ff       	call   800527 <printnum>
+  80056f:	83 c4 10             	add    $0x10,%esp
+  800572:	eb 14                	jmp    800588 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800574:	83 ec 08             	sub    $0x8,%esp
+  800577:	56                   	push   %esi
+  800578:	57                   	push   %edi
+  800579:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80057c:	ff d0                	call   *%eax
+  80057e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800581:	83 eb 01             	sub    $0x1,%ebx
+  800584:	85 db                	test   %ebx,%ebx
+  800586:	7f ec                	jg     800574 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	56                   	push   %esi
+  80058c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80058f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800594:	f7 75 08             	divl   0x8(%ebp)
+  800597:	0f be 92 23 38 80 00 	movsbl 0x803823(%edx),%edx
+  80059e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a1:	c1 e0 08             	shl    $0x8,%eax
+  8005a4:	09 d0                	or     %edx,%eax
+  8005a6:	50                   	push   %eax
+  8005a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005aa:	ff d0                	call   *%eax
+}
+  8005ac:	83 c4 10             	add    $0x10,%esp
+  8005af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b2:	5b                   	pop    %ebx
+  8005b3:	5e                   	pop    %esi
+  8005b4:	5f                   	pop    %edi
+  8005b5:	5d                   	pop    %ebp
+  8005b6:	c3                   	ret
+
+008005b7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005b7:	55                   	push   %ebp
+  8005b8:	89 e5                	mov    %esp,%ebp
+  8005ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005bd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005c1:	8b 10                	mov    (%eax),%edx
+  8005c3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005c6:	73 0a                	jae    8005d2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005c8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005cb:	89 08                	mov    %ecx,(%eax)
+  8005cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005d0:	88 02                	mov    %al,(%edx)
+}
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <printfmt>:
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005da:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005dd:	50                   	push   %eax
+  8005de:	ff 75 10             	push   0x10(%ebp)
+  8005e1:	ff 75 0c             	push   0xc(%ebp)
+  8005e4:	ff 75 08             	push   0x8(%ebp)
+  8005e7:	e8 05 00 00 00       	call   8005f1 <vprintfmt>
+}
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	c9                   	leave
+  8005f0:	c3                   	ret
+
+008005f1 <vprintfmt>:
+{
+  8005f1:	55                   	push   %ebp
+  8005f2:	89 e5                	mov    %esp,%ebp
+  8005f4:	57                   	push   %edi
+  8005f5:	56                   	push   %esi
+  8005f6:	53                   	push   %ebx
+  8005f7:	83 ec 3c             	sub    $0x3c,%esp
+  8005fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005fd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800600:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800607:	eb 16                	jmp    80061f <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800609:	83 ec 08             	sub    $0x8,%esp
+  80060c:	ff 75 0c             	push   0xc(%ebp)
+  80060f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800612:	c1 e2 08             	shl    $0x8,%edx
+  800615:	09 d0                	or     %edx,%eax
+  800617:	50                   	push   %eax
+  800618:	ff d7                	call   *%edi
+  80061a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80061d:	89 de                	mov    %ebx,%esi
+  80061f:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800622:	0f b6 06             	movzbl (%esi),%eax
+  800625:	83 f8 25             	cmp    $0x25,%eax
+  800628:	74 0c                	je     800636 <vprintfmt+0x45>
+			if (ch == '\0')
+  80062a:	85 c0                	test   %eax,%eax
+  80062c:	75 db                	jne    800609 <vprintfmt+0x18>
+}
+  80062e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800631:	5b                   	pop    %ebx
+  800632:	5e                   	pop    %esi
+  800633:	5f                   	pop    %edi
+  800634:	5d                   	pop    %ebp
+  800635:	c3                   	ret
+		padc = ' ';
+  800636:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80063a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800641:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800648:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80064f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800654:	8d 73 01             	lea    0x1(%ebx),%esi
+  800657:	0f b6 13             	movzbl (%ebx),%edx
+  80065a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80065d:	3c 55                	cmp    $0x55,%al
+  80065f:	0f 87 2c 04 00 00    	ja     800a91 <vprintfmt+0x4a0>
+  800665:	0f b6 c0             	movzbl %al,%eax
+  800668:	ff 24 85 60 39 80 00 	jmp    *0x803960(,%eax,4)
+  80066f:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800671:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800675:	eb dd                	jmp    800654 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800677:	89 f3                	mov    %esi,%ebx
+  800679:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80067d:	eb d5                	jmp    800654 <vprintfmt+0x63>
+  80067f:	0f b6 d2             	movzbl %dl,%edx
+  800682:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800684:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800689:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80068c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800690:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800693:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800696:	83 fe 09             	cmp    $0x9,%esi
+  800699:	0f 87 8a 00 00 00    	ja     800729 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80069f:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8006a2:	eb e5                	jmp    800689 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 00                	mov    (%eax),%eax
+  8006a9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006b5:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8006b7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006bb:	79 97                	jns    800654 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8006bd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006ca:	eb 88                	jmp    800654 <vprintfmt+0x63>
+			if (width < 0)
+  8006cc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8006cf:	85 db                	test   %ebx,%ebx
+  8006d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d6:	0f 49 c3             	cmovns %ebx,%eax
+  8006d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006dc:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8006de:	e9 71 ff ff ff       	jmp    800654 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006e3:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8006e5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006ec:	e9 63 ff ff ff       	jmp    800654 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8006f1:	8d 73 02             	lea    0x2(%ebx),%esi
+  8006f4:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8006f8:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8006ff:	3c 67                	cmp    $0x67,%al
+  800701:	0f 84 18 ff ff ff    	je     80061f <vprintfmt+0x2e>
+					attrib = 0x04;
+  800707:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80070e:	3c 72                	cmp    $0x72,%al
+  800710:	0f 84 09 ff ff ff    	je     80061f <vprintfmt+0x2e>
+					attrib = 0x00;
+  800716:	3c 62                	cmp    $0x62,%al
+  800718:	0f 94 c0             	sete   %al
+  80071b:	0f b6 c0             	movzbl %al,%eax
+  80071e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800721:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800724:	e9 f6 fe ff ff       	jmp    80061f <vprintfmt+0x2e>
+  800729:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80072c:	eb 89                	jmp    8006b7 <vprintfmt+0xc6>
+			lflag++;
+  80072e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800731:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800733:	e9 1c ff ff ff       	jmp    800654 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800738:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073b:	8d 58 04             	lea    0x4(%eax),%ebx
+  80073e:	83 ec 08             	sub    $0x8,%esp
+  800741:	ff 75 0c             	push   0xc(%ebp)
+  800744:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800747:	c1 e0 08             	shl    $0x8,%eax
+  80074a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80074d:	0b 01                	or     (%ecx),%eax
+  80074f:	50                   	push   %eax
+  800750:	ff d7                	call   *%edi
+			break;
+  800752:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800755:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800758:	e9 c2 fe ff ff       	jmp    80061f <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80075d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800760:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800763:	8b 10                	mov    (%eax),%edx
+  800765:	89 d0                	mov    %edx,%eax
+  800767:	f7 d8                	neg    %eax
+  800769:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80076c:	83 f8 12             	cmp    $0x12,%eax
+  80076f:	7f 25                	jg     800796 <vprintfmt+0x1a5>
+  800771:	8b 14 85 c0 3a 80 00 	mov    0x803ac0(,%eax,4),%edx
+  800778:	85 d2                	test   %edx,%edx
+  80077a:	74 1a                	je     800796 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80077c:	52                   	push   %edx
+  80077d:	68 02 3c 80 00       	push   $0x803c02
+  800782:	ff 75 0c             	push   0xc(%ebp)
+  800785:	57                   	push   %edi
+  800786:	e8 49 fe ff ff       	call   8005d4 <printfmt>
+  80078b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80078e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800791:	e9 89 fe ff ff       	jmp    80061f <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800796:	50                   	push   %eax
+  800797:	68 3b 38 80 00       	push   $0x80383b
+  80079c:	ff 75 0c             	push   0xc(%ebp)
+  80079f:	57                   	push   %edi
+  8007a0:	e8 2f fe ff ff       	call   8005d4 <printfmt>
+  8007a5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8007a8:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8007ab:	e9 6f fe ff ff       	jmp    80061f <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	83 c0 04             	add    $0x4,%eax
+  8007b6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8007b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bc:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8007be:	85 c9                	test   %ecx,%ecx
+  8007c0:	b8 34 38 80 00       	mov    $0x803834,%eax
+  8007c5:	0f 45 c1             	cmovne %ecx,%eax
+  8007c8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8007cb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007cf:	7e 06                	jle    8007d7 <vprintfmt+0x1e6>
+  8007d1:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8007d5:	75 1a                	jne    8007f1 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8007d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007da:	c1 e0 08             	shl    $0x8,%eax
+  8007dd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8007e0:	83 c8 3f             	or     $0x3f,%eax
+  8007e3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8007e6:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8007e9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007ec:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8007ef:	eb 6d                	jmp    80085e <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007f1:	83 ec 08             	sub    $0x8,%esp
+  8007f4:	ff 75 d0             	push   -0x30(%ebp)
+  8007f7:	ff 75 c8             	push   -0x38(%ebp)
+  8007fa:	e8 39 03 00 00       	call   800b38 <strnlen>
+  8007ff:	89 c2                	mov    %eax,%edx
+  800801:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800804:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800806:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800809:	c1 e1 08             	shl    $0x8,%ecx
+  80080c:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800810:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800812:	83 c4 10             	add    $0x10,%esp
+  800815:	89 c3                	mov    %eax,%ebx
+  800817:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80081a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80081d:	89 ce                	mov    %ecx,%esi
+  80081f:	eb 0f                	jmp    800830 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800821:	83 ec 08             	sub    $0x8,%esp
+  800824:	ff 75 0c             	push   0xc(%ebp)
+  800827:	56                   	push   %esi
+  800828:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80082a:	83 eb 01             	sub    $0x1,%ebx
+  80082d:	83 c4 10             	add    $0x10,%esp
+  800830:	85 db                	test   %ebx,%ebx
+  800832:	7f ed                	jg     800821 <vprintfmt+0x230>
+  800834:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800837:	8b 75 10             	mov    0x10(%ebp),%esi
+  80083a:	85 c0                	test   %eax,%eax
+  80083c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800841:	0f 49 d0             	cmovns %eax,%edx
+  800844:	29 d0                	sub    %edx,%eax
+  800846:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800849:	eb 8c                	jmp    8007d7 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80084b:	83 ec 08             	sub    $0x8,%esp
+  80084e:	ff 75 0c             	push   0xc(%ebp)
+  800851:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800854:	09 c2                	or     %eax,%edx
+  800856:	52                   	push   %edx
+  800857:	ff d7                	call   *%edi
+  800859:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80085c:	89 d9                	mov    %ebx,%ecx
+  80085e:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800861:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800865:	0f be d0             	movsbl %al,%edx
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	74 2a                	je     800896 <vprintfmt+0x2a5>
+  80086c:	85 f6                	test   %esi,%esi
+  80086e:	78 05                	js     800875 <vprintfmt+0x284>
+  800870:	83 ee 01             	sub    $0x1,%esi
+  800873:	78 3b                	js     8008b0 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800875:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800879:	74 d0                	je     80084b <vprintfmt+0x25a>
+  80087b:	0f be c0             	movsbl %al,%eax
+  80087e:	83 e8 20             	sub    $0x20,%eax
+  800881:	83 f8 5e             	cmp    $0x5e,%eax
+  800884:	76 c5                	jbe    80084b <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800886:	83 ec 08             	sub    $0x8,%esp
+  800889:	ff 75 0c             	push   0xc(%ebp)
+  80088c:	ff 75 cc             	push   -0x34(%ebp)
+  80088f:	ff d7                	call   *%edi
+  800891:	83 c4 10             	add    $0x10,%esp
+  800894:	eb c6                	jmp    80085c <vprintfmt+0x26b>
+  800896:	8b 75 10             	mov    0x10(%ebp),%esi
+  800899:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80089c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80089f:	01 c3                	add    %eax,%ebx
+  8008a1:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8008a3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8008a6:	83 c8 20             	or     $0x20,%eax
+  8008a9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008ac:	89 c6                	mov    %eax,%esi
+  8008ae:	eb 14                	jmp    8008c4 <vprintfmt+0x2d3>
+  8008b0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008b3:	eb e4                	jmp    800899 <vprintfmt+0x2a8>
+  8008b5:	83 ec 08             	sub    $0x8,%esp
+  8008b8:	ff 75 0c             	push   0xc(%ebp)
+  8008bb:	56                   	push   %esi
+  8008bc:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8008be:	83 eb 01             	sub    $0x1,%ebx
+  8008c1:	83 c4 10             	add    $0x10,%esp
+  8008c4:	85 db                	test   %ebx,%ebx
+  8008c6:	7f ed                	jg     8008b5 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008c8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008cb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8008ce:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008d1:	e9 49 fd ff ff       	jmp    80061f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008d6:	83 f9 01             	cmp    $0x1,%ecx
+  8008d9:	7f 1f                	jg     8008fa <vprintfmt+0x309>
+	else if (lflag)
+  8008db:	85 c9                	test   %ecx,%ecx
+  8008dd:	74 69                	je     800948 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8008df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e2:	8b 00                	mov    (%eax),%eax
+  8008e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008e7:	89 c1                	mov    %eax,%ecx
+  8008e9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008ec:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008f8:	eb 17                	jmp    800911 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8008fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fd:	8b 50 04             	mov    0x4(%eax),%edx
+  800900:	8b 00                	mov    (%eax),%eax
+  800902:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800905:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800908:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090b:	8d 40 08             	lea    0x8(%eax),%eax
+  80090e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800911:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800914:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800917:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80091c:	85 db                	test   %ebx,%ebx
+  80091e:	0f 89 f6 00 00 00    	jns    800a1a <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	ff 75 0c             	push   0xc(%ebp)
+  80092a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80092d:	c1 e0 08             	shl    $0x8,%eax
+  800930:	83 c8 2d             	or     $0x2d,%eax
+  800933:	50                   	push   %eax
+  800934:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800936:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800939:	f7 d9                	neg    %ecx
+  80093b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80093e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800943:	e9 d2 00 00 00       	jmp    800a1a <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800948:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094b:	8b 00                	mov    (%eax),%eax
+  80094d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800950:	89 c1                	mov    %eax,%ecx
+  800952:	c1 f9 1f             	sar    $0x1f,%ecx
+  800955:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800958:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095b:	8d 40 04             	lea    0x4(%eax),%eax
+  80095e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800961:	eb ae                	jmp    800911 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800963:	83 f9 01             	cmp    $0x1,%ecx
+  800966:	7f 19                	jg     800981 <vprintfmt+0x390>
+	else if (lflag)
+  800968:	85 c9                	test   %ecx,%ecx
+  80096a:	74 2a                	je     800996 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80096c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096f:	8b 08                	mov    (%eax),%ecx
+  800971:	8d 40 04             	lea    0x4(%eax),%eax
+  800974:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800977:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80097c:	e9 99 00 00 00       	jmp    800a1a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800981:	8b 45 14             	mov    0x14(%ebp),%eax
+  800984:	8b 08                	mov    (%eax),%ecx
+  800986:	8d 40 08             	lea    0x8(%eax),%eax
+  800989:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80098c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800991:	e9 84 00 00 00       	jmp    800a1a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800996:	8b 45 14             	mov    0x14(%ebp),%eax
+  800999:	8b 08                	mov    (%eax),%ecx
+  80099b:	8d 40 04             	lea    0x4(%eax),%eax
+  80099e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009a1:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8009a6:	eb 72                	jmp    800a1a <vprintfmt+0x429>
+	if (lflag >= 2)
+  8009a8:	83 f9 01             	cmp    $0x1,%ecx
+  8009ab:	7f 16                	jg     8009c3 <vprintfmt+0x3d2>
+	else if (lflag)
+  8009ad:	85 c9                	test   %ecx,%ecx
+  8009af:	74 24                	je     8009d5 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8009b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b4:	8b 08                	mov    (%eax),%ecx
+  8009b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009bc:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8009c1:	eb 57                	jmp    800a1a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8009c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c6:	8b 08                	mov    (%eax),%ecx
+  8009c8:	8d 40 08             	lea    0x8(%eax),%eax
+  8009cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009ce:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8009d3:	eb 45                	jmp    800a1a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8009d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d8:	8b 08                	mov    (%eax),%ecx
+  8009da:	8d 40 04             	lea    0x4(%eax),%eax
+  8009dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009e0:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8009e5:	eb 33                	jmp    800a1a <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8009e7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009ea:	c1 e3 08             	shl    $0x8,%ebx
+  8009ed:	83 ec 08             	sub    $0x8,%esp
+  8009f0:	ff 75 0c             	push   0xc(%ebp)
+  8009f3:	89 d8                	mov    %ebx,%eax
+  8009f5:	83 c8 30             	or     $0x30,%eax
+  8009f8:	50                   	push   %eax
+  8009f9:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8009fb:	83 c4 08             	add    $0x8,%esp
+  8009fe:	ff 75 0c             	push   0xc(%ebp)
+  800a01:	83 cb 78             	or     $0x78,%ebx
+  800a04:	53                   	push   %ebx
+  800a05:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800a07:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0a:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800a0c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a0f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a12:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a15:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800a1a:	ff 75 e4             	push   -0x1c(%ebp)
+  800a1d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800a21:	52                   	push   %edx
+  800a22:	ff 75 e0             	push   -0x20(%ebp)
+  800a25:	50                   	push   %eax
+  800a26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a29:	89 f8                	mov    %edi,%eax
+  800a2b:	e8 f7 fa ff ff       	call   800527 <printnum>
+			break;
+  800a30:	83 c4 10             	add    $0x10,%esp
+  800a33:	e9 e7 fb ff ff       	jmp    80061f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800a38:	83 f9 01             	cmp    $0x1,%ecx
+  800a3b:	7f 16                	jg     800a53 <vprintfmt+0x462>
+	else if (lflag)
+  800a3d:	85 c9                	test   %ecx,%ecx
+  800a3f:	74 24                	je     800a65 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800a41:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a44:	8b 08                	mov    (%eax),%ecx
+  800a46:	8d 40 04             	lea    0x4(%eax),%eax
+  800a49:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a4c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800a51:	eb c7                	jmp    800a1a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a53:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a56:	8b 08                	mov    (%eax),%ecx
+  800a58:	8d 40 08             	lea    0x8(%eax),%eax
+  800a5b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a5e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800a63:	eb b5                	jmp    800a1a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a65:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a68:	8b 08                	mov    (%eax),%ecx
+  800a6a:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a70:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800a75:	eb a3                	jmp    800a1a <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800a77:	83 ec 08             	sub    $0x8,%esp
+  800a7a:	ff 75 0c             	push   0xc(%ebp)
+  800a7d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a80:	c1 e0 08             	shl    $0x8,%eax
+  800a83:	83 c8 25             	or     $0x25,%eax
+  800a86:	50                   	push   %eax
+  800a87:	ff d7                	call   *%edi
+			break;
+  800a89:	83 c4 10             	add    $0x10,%esp
+  800a8c:	e9 8e fb ff ff       	jmp    80061f <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800a91:	83 ec 08             	sub    $0x8,%esp
+  800a94:	ff 75 0c             	push   0xc(%ebp)
+  800a97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a9a:	c1 e0 08             	shl    $0x8,%eax
+  800a9d:	83 c8 25             	or     $0x25,%eax
+  800aa0:	50                   	push   %eax
+  800aa1:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800aa3:	83 c4 10             	add    $0x10,%esp
+  800aa6:	89 de                	mov    %ebx,%esi
+  800aa8:	eb 03                	jmp    800aad <vprintfmt+0x4bc>
+  800aaa:	83 ee 01             	sub    $0x1,%esi
+  800aad:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800ab1:	75 f7                	jne    800aaa <vprintfmt+0x4b9>
+  800ab3:	e9 67 fb ff ff       	jmp    80061f <vprintfmt+0x2e>
+
+00800ab8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ab8:	55                   	push   %ebp
+  800ab9:	89 e5                	mov    %esp,%ebp
+  800abb:	83 ec 18             	sub    $0x18,%esp
+  800abe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800ac4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ac7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800acb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ace:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800ad5:	85 c0                	test   %eax,%eax
+  800ad7:	74 26                	je     800aff <vsnprintf+0x47>
+  800ad9:	85 d2                	test   %edx,%edx
+  800adb:	7e 22                	jle    800aff <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800add:	ff 75 14             	push   0x14(%ebp)
+  800ae0:	ff 75 10             	push   0x10(%ebp)
+  800ae3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ae6:	50                   	push   %eax
+  800ae7:	68 b7 05 80 00       	push   $0x8005b7
+  800aec:	e8 00 fb ff ff       	call   8005f1 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800af1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800af4:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800af7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800afa:	83 c4 10             	add    $0x10,%esp
+}
+  800afd:	c9                   	leave
+  800afe:	c3                   	ret
+		return -E_INVAL;
+  800aff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b04:	eb f7                	jmp    800afd <vsnprintf+0x45>
+
+00800b06 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b06:	55                   	push   %ebp
+  800b07:	89 e5                	mov    %esp,%ebp
+  800b09:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800b0c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b0f:	50                   	push   %eax
+  800b10:	ff 75 10             	push   0x10(%ebp)
+  800b13:	ff 75 0c             	push   0xc(%ebp)
+  800b16:	ff 75 08             	push   0x8(%ebp)
+  800b19:	e8 9a ff ff ff       	call   800ab8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b1e:	c9                   	leave
+  800b1f:	c3                   	ret
+
+00800b20 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b20:	55                   	push   %ebp
+  800b21:	89 e5                	mov    %esp,%ebp
+  800b23:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2b:	eb 03                	jmp    800b30 <strlen+0x10>
+		n++;
+  800b2d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b30:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b34:	75 f7                	jne    800b2d <strlen+0xd>
+	return n;
+}
+  800b36:	5d                   	pop    %ebp
+  800b37:	c3                   	ret
+
+00800b38 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b46:	eb 03                	jmp    800b4b <strnlen+0x13>
+		n++;
+  800b48:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b4b:	39 d0                	cmp    %edx,%eax
+  800b4d:	74 08                	je     800b57 <strnlen+0x1f>
+  800b4f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b53:	75 f3                	jne    800b48 <strnlen+0x10>
+  800b55:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800b57:	89 d0                	mov    %edx,%eax
+  800b59:	5d                   	pop    %ebp
+  800b5a:	c3                   	ret
+
+00800b5b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	53                   	push   %ebx
+  800b5f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b6e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b71:	83 c0 01             	add    $0x1,%eax
+  800b74:	84 d2                	test   %dl,%dl
+  800b76:	75 f2                	jne    800b6a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b78:	89 c8                	mov    %ecx,%eax
+  800b7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+
+00800b7f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	53                   	push   %ebx
+  800b83:	83 ec 10             	sub    $0x10,%esp
+  800b86:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b89:	53                   	push   %ebx
+  800b8a:	e8 91 ff ff ff       	call   800b20 <strlen>
+  800b8f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b92:	ff 75 0c             	push   0xc(%ebp)
+  800b95:	01 d8                	add    %ebx,%eax
+  800b97:	50                   	push   %eax
+  800b98:	e8 be ff ff ff       	call   800b5b <strcpy>
+	return dst;
+}
+  800b9d:	89 d8                	mov    %ebx,%eax
+  800b9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba2:	c9                   	leave
+  800ba3:	c3                   	ret
+
+00800ba4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	56                   	push   %esi
+  800ba8:	53                   	push   %ebx
+  800ba9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bac:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800baf:	89 f3                	mov    %esi,%ebx
+  800bb1:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bb4:	89 f0                	mov    %esi,%eax
+  800bb6:	eb 0f                	jmp    800bc7 <strncpy+0x23>
+		*dst++ = *src;
+  800bb8:	83 c0 01             	add    $0x1,%eax
+  800bbb:	0f b6 0a             	movzbl (%edx),%ecx
+  800bbe:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bc1:	80 f9 01             	cmp    $0x1,%cl
+  800bc4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bc7:	39 d8                	cmp    %ebx,%eax
+  800bc9:	75 ed                	jne    800bb8 <strncpy+0x14>
+	}
+	return ret;
+}
+  800bcb:	89 f0                	mov    %esi,%eax
+  800bcd:	5b                   	pop    %ebx
+  800bce:	5e                   	pop    %esi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+
+00800bd1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bd1:	55                   	push   %ebp
+  800bd2:	89 e5                	mov    %esp,%ebp
+  800bd4:	56                   	push   %esi
+  800bd5:	53                   	push   %ebx
+  800bd6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bdc:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bdf:	89 f0                	mov    %esi,%eax
+  800be1:	85 d2                	test   %edx,%edx
+  800be3:	74 21                	je     800c06 <strlcpy+0x35>
+  800be5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800be9:	89 f2                	mov    %esi,%edx
+  800beb:	eb 09                	jmp    800bf6 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800bed:	83 c1 01             	add    $0x1,%ecx
+  800bf0:	83 c2 01             	add    $0x1,%edx
+  800bf3:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800bf6:	39 c2                	cmp    %eax,%edx
+  800bf8:	74 09                	je     800c03 <strlcpy+0x32>
+  800bfa:	0f b6 19             	movzbl (%ecx),%ebx
+  800bfd:	84 db                	test   %bl,%bl
+  800bff:	75 ec                	jne    800bed <strlcpy+0x1c>
+  800c01:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c03:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c06:	29 f0                	sub    %esi,%eax
+}
+  800c08:	5b                   	pop    %ebx
+  800c09:	5e                   	pop    %esi
+  800c0a:	5d                   	pop    %ebp
+  800c0b:	c3                   	ret
+
+00800c0c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c0c:	55                   	push   %ebp
+  800c0d:	89 e5                	mov    %esp,%ebp
+  800c0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c12:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c15:	eb 06                	jmp    800c1d <strcmp+0x11>
+		p++, q++;
+  800c17:	83 c1 01             	add    $0x1,%ecx
+  800c1a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c1d:	0f b6 01             	movzbl (%ecx),%eax
+  800c20:	84 c0                	test   %al,%al
+  800c22:	74 04                	je     800c28 <strcmp+0x1c>
+  800c24:	3a 02                	cmp    (%edx),%al
+  800c26:	74 ef                	je     800c17 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c28:	0f b6 c0             	movzbl %al,%eax
+  800c2b:	0f b6 12             	movzbl (%edx),%edx
+  800c2e:	29 d0                	sub    %edx,%eax
+}
+  800c30:	5d                   	pop    %ebp
+  800c31:	c3                   	ret
+
+00800c32 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c32:	55                   	push   %ebp
+  800c33:	89 e5                	mov    %esp,%ebp
+  800c35:	53                   	push   %ebx
+  800c36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c3f:	eb 09                	jmp    800c4a <strncmp+0x18>
+		n--, p++, q++;
+  800c41:	83 ea 01             	sub    $0x1,%edx
+  800c44:	83 c0 01             	add    $0x1,%eax
+  800c47:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c4a:	85 d2                	test   %edx,%edx
+  800c4c:	74 18                	je     800c66 <strncmp+0x34>
+  800c4e:	0f b6 18             	movzbl (%eax),%ebx
+  800c51:	84 db                	test   %bl,%bl
+  800c53:	74 04                	je     800c59 <strncmp+0x27>
+  800c55:	3a 19                	cmp    (%ecx),%bl
+  800c57:	74 e8                	je     800c41 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c59:	0f b6 00             	movzbl (%eax),%eax
+  800c5c:	0f b6 11             	movzbl (%ecx),%edx
+  800c5f:	29 d0                	sub    %edx,%eax
+}
+  800c61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c64:	c9                   	leave
+  800c65:	c3                   	ret
+		return 0;
+  800c66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6b:	eb f4                	jmp    800c61 <strncmp+0x2f>
+
+00800c6d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c73:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c77:	eb 03                	jmp    800c7c <strchr+0xf>
+  800c79:	83 c0 01             	add    $0x1,%eax
+  800c7c:	0f b6 10             	movzbl (%eax),%edx
+  800c7f:	84 d2                	test   %dl,%dl
+  800c81:	74 06                	je     800c89 <strchr+0x1c>
+		if (*s == c)
+  800c83:	38 ca                	cmp    %cl,%dl
+  800c85:	75 f2                	jne    800c79 <strchr+0xc>
+  800c87:	eb 05                	jmp    800c8e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800c89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c8e:	5d                   	pop    %ebp
+  800c8f:	c3                   	ret
+
+00800c90 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c96:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c9a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c9d:	38 ca                	cmp    %cl,%dl
+  800c9f:	74 09                	je     800caa <strfind+0x1a>
+  800ca1:	84 d2                	test   %dl,%dl
+  800ca3:	74 05                	je     800caa <strfind+0x1a>
+	for (; *s; s++)
+  800ca5:	83 c0 01             	add    $0x1,%eax
+  800ca8:	eb f0                	jmp    800c9a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	57                   	push   %edi
+  800cb0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cb3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800cb6:	85 c9                	test   %ecx,%ecx
+  800cb8:	74 20                	je     800cda <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800cba:	89 f8                	mov    %edi,%eax
+  800cbc:	09 c8                	or     %ecx,%eax
+  800cbe:	a8 03                	test   $0x3,%al
+  800cc0:	75 12                	jne    800cd4 <memset+0x28>
+		c &= 0xFF;
+  800cc2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cc6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ccc:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ccf:	fc                   	cld
+  800cd0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cd2:	eb 06                	jmp    800cda <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800cd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cd7:	fc                   	cld
+  800cd8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800cda:	89 f8                	mov    %edi,%eax
+  800cdc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cdf:	c9                   	leave
+  800ce0:	c3                   	ret
+
+00800ce1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	56                   	push   %esi
+  800ce6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800cef:	39 c6                	cmp    %eax,%esi
+  800cf1:	73 32                	jae    800d25 <memmove+0x44>
+  800cf3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800cf6:	39 d0                	cmp    %edx,%eax
+  800cf8:	73 2b                	jae    800d25 <memmove+0x44>
+		s += n;
+		d += n;
+  800cfa:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cfd:	89 d6                	mov    %edx,%esi
+  800cff:	09 fe                	or     %edi,%esi
+  800d01:	09 ce                	or     %ecx,%esi
+  800d03:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d09:	75 0e                	jne    800d19 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d0b:	83 ef 04             	sub    $0x4,%edi
+  800d0e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d11:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d14:	fd                   	std
+  800d15:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d17:	eb 09                	jmp    800d22 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d19:	83 ef 01             	sub    $0x1,%edi
+  800d1c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d1f:	fd                   	std
+  800d20:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d22:	fc                   	cld
+  800d23:	eb 1a                	jmp    800d3f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d25:	89 f2                	mov    %esi,%edx
+  800d27:	09 c2                	or     %eax,%edx
+  800d29:	09 ca                	or     %ecx,%edx
+  800d2b:	f6 c2 03             	test   $0x3,%dl
+  800d2e:	75 0a                	jne    800d3a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d30:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d33:	89 c7                	mov    %eax,%edi
+  800d35:	fc                   	cld
+  800d36:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d38:	eb 05                	jmp    800d3f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d3a:	89 c7                	mov    %eax,%edi
+  800d3c:	fc                   	cld
+  800d3d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d3f:	5e                   	pop    %esi
+  800d40:	5f                   	pop    %edi
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+
+00800d43 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d49:	ff 75 10             	push   0x10(%ebp)
+  800d4c:	ff 75 0c             	push   0xc(%ebp)
+  800d4f:	ff 75 08             	push   0x8(%ebp)
+  800d52:	e8 8a ff ff ff       	call   800ce1 <memmove>
+}
+  800d57:	c9                   	leave
+  800d58:	c3                   	ret
+
+00800d59 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	56                   	push   %esi
+  800d5d:	53                   	push   %ebx
+  800d5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d61:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d64:	89 c6                	mov    %eax,%esi
+  800d66:	03 75 10             	add    0x10(%ebp),%esi
+  800d69:	eb 06                	jmp    800d71 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800d6b:	83 c0 01             	add    $0x1,%eax
+  800d6e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800d71:	39 f0                	cmp    %esi,%eax
+  800d73:	74 14                	je     800d89 <memcmp+0x30>
+		if (*s1 != *s2)
+  800d75:	0f b6 08             	movzbl (%eax),%ecx
+  800d78:	0f b6 1a             	movzbl (%edx),%ebx
+  800d7b:	38 d9                	cmp    %bl,%cl
+  800d7d:	74 ec                	je     800d6b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800d7f:	0f b6 c1             	movzbl %cl,%eax
+  800d82:	0f b6 db             	movzbl %bl,%ebx
+  800d85:	29 d8                	sub    %ebx,%eax
+  800d87:	eb 05                	jmp    800d8e <memcmp+0x35>
+	}
+
+	return 0;
+  800d89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+
+00800d92 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d9b:	89 c2                	mov    %eax,%edx
+  800d9d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800da0:	eb 03                	jmp    800da5 <memfind+0x13>
+  800da2:	83 c0 01             	add    $0x1,%eax
+  800da5:	39 d0                	cmp    %edx,%eax
+  800da7:	73 04                	jae    800dad <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800da9:	38 08                	cmp    %cl,(%eax)
+  800dab:	75 f5                	jne    800da2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800dad:	5d                   	pop    %ebp
+  800dae:	c3                   	ret
+
+00800daf <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	57                   	push   %edi
+  800db3:	56                   	push   %esi
+  800db4:	53                   	push   %ebx
+  800db5:	83 ec 1c             	sub    $0x1c,%esp
+  800db8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dbb:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800dbe:	eb 03                	jmp    800dc3 <strtol+0x14>
+		s++;
+  800dc0:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800dc3:	0f b6 06             	movzbl (%esi),%eax
+  800dc6:	3c 20                	cmp    $0x20,%al
+  800dc8:	74 f6                	je     800dc0 <strtol+0x11>
+  800dca:	3c 09                	cmp    $0x9,%al
+  800dcc:	74 f2                	je     800dc0 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800dce:	3c 2b                	cmp    $0x2b,%al
+  800dd0:	74 43                	je     800e15 <strtol+0x66>
+	int neg = 0;
+  800dd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800dd7:	3c 2d                	cmp    $0x2d,%al
+  800dd9:	74 44                	je     800e1f <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ddb:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800de1:	75 0f                	jne    800df2 <strtol+0x43>
+  800de3:	80 3e 30             	cmpb   $0x30,(%esi)
+  800de6:	74 41                	je     800e29 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800de8:	85 ff                	test   %edi,%edi
+  800dea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800def:	0f 44 f8             	cmove  %eax,%edi
+  800df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df7:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800dfc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800dff:	89 fb                	mov    %edi,%ebx
+  800e01:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e04:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800e07:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e0a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e0d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800e10:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e13:	eb 67                	jmp    800e7c <strtol+0xcd>
+		s++;
+  800e15:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800e18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1d:	eb bc                	jmp    800ddb <strtol+0x2c>
+		s++, neg = 1;
+  800e1f:	83 c6 01             	add    $0x1,%esi
+  800e22:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e27:	eb b2                	jmp    800ddb <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e29:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800e2d:	74 0e                	je     800e3d <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800e2f:	85 ff                	test   %edi,%edi
+  800e31:	75 bf                	jne    800df2 <strtol+0x43>
+		s++, base = 8;
+  800e33:	83 c6 01             	add    $0x1,%esi
+  800e36:	bf 08 00 00 00       	mov    $0x8,%edi
+  800e3b:	eb b5                	jmp    800df2 <strtol+0x43>
+		s += 2, base = 16;
+  800e3d:	83 c6 02             	add    $0x2,%esi
+  800e40:	bf 10 00 00 00       	mov    $0x10,%edi
+  800e45:	eb ab                	jmp    800df2 <strtol+0x43>
+			dig = *s - '0';
+  800e47:	0f be c9             	movsbl %cl,%ecx
+  800e4a:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800e4d:	39 f9                	cmp    %edi,%ecx
+  800e4f:	7d 59                	jge    800eaa <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800e51:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800e55:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e58:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e5b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800e5e:	0f af d8             	imul   %eax,%ebx
+  800e61:	0f af d7             	imul   %edi,%edx
+  800e64:	01 d3                	add    %edx,%ebx
+  800e66:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800e69:	f7 e7                	mul    %edi
+  800e6b:	01 da                	add    %ebx,%edx
+  800e6d:	89 cb                	mov    %ecx,%ebx
+  800e6f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e72:	01 c8                	add    %ecx,%eax
+  800e74:	11 da                	adc    %ebx,%edx
+  800e76:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e79:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800e7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e7f:	0f b6 08             	movzbl (%eax),%ecx
+  800e82:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800e85:	80 fb 09             	cmp    $0x9,%bl
+  800e88:	76 bd                	jbe    800e47 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800e8a:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800e8d:	80 fb 19             	cmp    $0x19,%bl
+  800e90:	77 08                	ja     800e9a <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800e92:	0f be c9             	movsbl %cl,%ecx
+  800e95:	83 e9 57             	sub    $0x57,%ecx
+  800e98:	eb b3                	jmp    800e4d <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e9a:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800e9d:	80 fb 19             	cmp    $0x19,%bl
+  800ea0:	77 08                	ja     800eaa <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800ea2:	0f be c9             	movsbl %cl,%ecx
+  800ea5:	83 e9 37             	sub    $0x37,%ecx
+  800ea8:	eb a3                	jmp    800e4d <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800eaa:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ead:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800eb0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800eb3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800eb6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eba:	74 05                	je     800ec1 <strtol+0x112>
+		*endptr = (char *) s;
+  800ebc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800ebf:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800ec1:	85 c9                	test   %ecx,%ecx
+  800ec3:	74 07                	je     800ecc <strtol+0x11d>
+  800ec5:	f7 d8                	neg    %eax
+  800ec7:	83 d2 00             	adc    $0x0,%edx
+  800eca:	f7 da                	neg    %edx
+}
+  800ecc:	83 c4 1c             	add    $0x1c,%esp
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+
+00800ed4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800eda:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ee1:	74 18                	je     800efb <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eeb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eee:	89 c3                	mov    %eax,%ebx
+  800ef0:	89 c7                	mov    %eax,%edi
+  800ef2:	89 c6                	mov    %eax,%esi
+  800ef4:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ef6:	5b                   	pop    %ebx
+  800ef7:	5e                   	pop    %esi
+  800ef8:	5f                   	pop    %edi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f06:	89 c3                	mov    %eax,%ebx
+  800f08:	89 c7                	mov    %eax,%edi
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	8d 35 15 0f 80 00    	lea    0x800f15,%esi
+  800f13:	0f 34                	sysenter
+  800f15:	5d                   	pop    %ebp
+		goto out;
+  800f16:	eb de                	jmp    800ef6 <sys_cputs+0x22>
+
+00800f18 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f18:	55                   	push   %ebp
+  800f19:	89 e5                	mov    %esp,%ebp
+  800f1b:	57                   	push   %edi
+  800f1c:	56                   	push   %esi
+  800f1d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f1e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f25:	74 19                	je     800f40 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800f27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f31:	89 d1                	mov    %edx,%ecx
+  800f33:	89 d3                	mov    %edx,%ebx
+  800f35:	89 d7                	mov    %edx,%edi
+  800f37:	89 d6                	mov    %edx,%esi
+  800f39:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f3b:	5b                   	pop    %ebx
+  800f3c:	5e                   	pop    %esi
+  800f3d:	5f                   	pop    %edi
+  800f3e:	5d                   	pop    %ebp
+  800f3f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f45:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f4a:	89 d1                	mov    %edx,%ecx
+  800f4c:	89 d3                	mov    %edx,%ebx
+  800f4e:	89 d7                	mov    %edx,%edi
+  800f50:	55                   	push   %ebp
+  800f51:	89 e5                	mov    %esp,%ebp
+  800f53:	8d 35 5b 0f 80 00    	lea    0x800f5b,%esi
+  800f59:	0f 34                	sysenter
+  800f5b:	5d                   	pop    %ebp
+		goto out;
+  800f5c:	eb dd                	jmp    800f3b <sys_cgetc+0x23>
+
+00800f5e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f67:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f6e:	74 21                	je     800f91 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800f70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f75:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7d:	89 cb                	mov    %ecx,%ebx
+  800f7f:	89 cf                	mov    %ecx,%edi
+  800f81:	89 ce                	mov    %ecx,%esi
+  800f83:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f85:	85 c0                	test   %eax,%eax
+  800f87:	7f 27                	jg     800fb0 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8c:	5b                   	pop    %ebx
+  800f8d:	5e                   	pop    %esi
+  800f8e:	5f                   	pop    %edi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f99:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f9e:	89 cb                	mov    %ecx,%ebx
+  800fa0:	89 cf                	mov    %ecx,%edi
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	8d 35 ad 0f 80 00    	lea    0x800fad,%esi
+  800fab:	0f 34                	sysenter
+  800fad:	5d                   	pop    %ebp
+		goto out;
+  800fae:	eb d5                	jmp    800f85 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb0:	83 ec 0c             	sub    $0xc,%esp
+  800fb3:	50                   	push   %eax
+  800fb4:	6a 03                	push   $0x3
+  800fb6:	68 2b 3b 80 00       	push   $0x803b2b
+  800fbb:	6a 3f                	push   $0x3f
+  800fbd:	68 48 3b 80 00       	push   $0x803b48
+  800fc2:	e8 71 f4 ff ff       	call   800438 <_panic>
+
+00800fc7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	57                   	push   %edi
+  800fcb:	56                   	push   %esi
+  800fcc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fcd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fd4:	74 19                	je     800fef <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800fd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fe0:	89 d1                	mov    %edx,%ecx
+  800fe2:	89 d3                	mov    %edx,%ebx
+  800fe4:	89 d7                	mov    %edx,%edi
+  800fe6:	89 d6                	mov    %edx,%esi
+  800fe8:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fea:	5b                   	pop    %ebx
+  800feb:	5e                   	pop    %esi
+  800fec:	5f                   	pop    %edi
+  800fed:	5d                   	pop    %ebp
+  800fee:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fef:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ff9:	89 d1                	mov    %edx,%ecx
+  800ffb:	89 d3                	mov    %edx,%ebx
+  800ffd:	89 d7                	mov    %edx,%edi
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	8d 35 0a 10 80 00    	lea    0x80100a,%esi
+  801008:	0f 34                	sysenter
+  80100a:	5d                   	pop    %ebp
+		goto out;
+  80100b:	eb dd                	jmp    800fea <sys_getenvid+0x23>
+
+0080100d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80100d:	55                   	push   %ebp
+  80100e:	89 e5                	mov    %esp,%ebp
+  801010:	57                   	push   %edi
+  801011:	56                   	push   %esi
+  801012:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801013:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80101a:	74 19                	je     801035 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  80101c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801021:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801026:	89 d1                	mov    %edx,%ecx
+  801028:	89 d3                	mov    %edx,%ebx
+  80102a:	89 d7                	mov    %edx,%edi
+  80102c:	89 d6                	mov    %edx,%esi
+  80102e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801030:	5b                   	pop    %ebx
+  801031:	5e                   	pop    %esi
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801035:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80103f:	89 d1                	mov    %edx,%ecx
+  801041:	89 d3                	mov    %edx,%ebx
+  801043:	89 d7                	mov    %edx,%edi
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  801048:	8d 35 50 10 80 00    	lea    0x801050,%esi
+  80104e:	0f 34                	sysenter
+  801050:	5d                   	pop    %ebp
+		goto out;
+  801051:	eb dd                	jmp    801030 <sys_yield+0x23>
+
+00801053 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	56                   	push   %esi
+  801058:	53                   	push   %ebx
+  801059:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80105c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801063:	74 23                	je     801088 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  801065:	be 00 00 00 00       	mov    $0x0,%esi
+  80106a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801078:	89 f7                	mov    %esi,%edi
+  80107a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107c:	85 c0                	test   %eax,%eax
+  80107e:	7f 29                	jg     8010a9 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801083:	5b                   	pop    %ebx
+  801084:	5e                   	pop    %esi
+  801085:	5f                   	pop    %edi
+  801086:	5d                   	pop    %ebp
+  801087:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801093:	bf 00 00 00 00       	mov    $0x0,%edi
+  801098:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	8d 35 a6 10 80 00    	lea    0x8010a6,%esi
+  8010a4:	0f 34                	sysenter
+  8010a6:	5d                   	pop    %ebp
+		goto out;
+  8010a7:	eb d3                	jmp    80107c <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  8010ac:	50                   	push   %eax
+  8010ad:	6a 04                	push   $0x4
+  8010af:	68 2b 3b 80 00       	push   $0x803b2b
+  8010b4:	6a 3f                	push   $0x3f
+  8010b6:	68 48 3b 80 00       	push   $0x803b48
+  8010bb:	e8 78 f3 ff ff       	call   800438 <_panic>
+
+008010c0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010c0:	55                   	push   %ebp
+  8010c1:	89 e5                	mov    %esp,%ebp
+  8010c3:	57                   	push   %edi
+  8010c4:	56                   	push   %esi
+  8010c5:	53                   	push   %ebx
+  8010c6:	83 ec 0c             	sub    $0xc,%esp
+  8010c9:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  8010cc:	85 f6                	test   %esi,%esi
+  8010ce:	75 09                	jne    8010d9 <sys_page_map+0x19>
+  8010d0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010d7:	74 1f                	je     8010f8 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  8010d9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ec:	85 c0                	test   %eax,%eax
+  8010ee:	7f 27                	jg     801117 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fe:	b8 05 00 00 00       	mov    $0x5,%eax
+  801103:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801106:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	8d 35 14 11 80 00    	lea    0x801114,%esi
+  801112:	0f 34                	sysenter
+  801114:	5d                   	pop    %ebp
+		goto out;
+  801115:	eb d5                	jmp    8010ec <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801117:	83 ec 0c             	sub    $0xc,%esp
+  80111a:	50                   	push   %eax
+  80111b:	6a 05                	push   $0x5
+  80111d:	68 2b 3b 80 00       	push   $0x803b2b
+  801122:	6a 3f                	push   $0x3f
+  801124:	68 48 3b 80 00       	push   $0x803b48
+  801129:	e8 0a f3 ff ff       	call   800438 <_panic>
+
+0080112e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80112e:	55                   	push   %ebp
+  80112f:	89 e5                	mov    %esp,%ebp
+  801131:	57                   	push   %edi
+  801132:	56                   	push   %esi
+  801133:	53                   	push   %ebx
+  801134:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801137:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80113e:	74 22                	je     801162 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801140:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801145:	b8 06 00 00 00       	mov    $0x6,%eax
+  80114a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801150:	89 df                	mov    %ebx,%edi
+  801152:	89 de                	mov    %ebx,%esi
+  801154:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801156:	85 c0                	test   %eax,%eax
+  801158:	7f 28                	jg     801182 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80115a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801172:	89 df                	mov    %ebx,%edi
+  801174:	55                   	push   %ebp
+  801175:	89 e5                	mov    %esp,%ebp
+  801177:	8d 35 7f 11 80 00    	lea    0x80117f,%esi
+  80117d:	0f 34                	sysenter
+  80117f:	5d                   	pop    %ebp
+		goto out;
+  801180:	eb d4                	jmp    801156 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801182:	83 ec 0c             	sub    $0xc,%esp
+  801185:	50                   	push   %eax
+  801186:	6a 06                	push   $0x6
+  801188:	68 2b 3b 80 00       	push   $0x803b2b
+  80118d:	6a 3f                	push   $0x3f
+  80118f:	68 48 3b 80 00       	push   $0x803b48
+  801194:	e8 9f f2 ff ff       	call   800438 <_panic>
+
+00801199 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801199:	55                   	push   %ebp
+  80119a:	89 e5                	mov    %esp,%ebp
+  80119c:	57                   	push   %edi
+  80119d:	56                   	push   %esi
+  80119e:	53                   	push   %ebx
+  80119f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011a2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011a9:	74 22                	je     8011cd <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8011ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bb:	89 df                	mov    %ebx,%edi
+  8011bd:	89 de                	mov    %ebx,%esi
+  8011bf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c1:	85 c0                	test   %eax,%eax
+  8011c3:	7f 28                	jg     8011ed <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c8:	5b                   	pop    %ebx
+  8011c9:	5e                   	pop    %esi
+  8011ca:	5f                   	pop    %edi
+  8011cb:	5d                   	pop    %ebp
+  8011cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011dd:	89 df                	mov    %ebx,%edi
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	8d 35 ea 11 80 00    	lea    0x8011ea,%esi
+  8011e8:	0f 34                	sysenter
+  8011ea:	5d                   	pop    %ebp
+		goto out;
+  8011eb:	eb d4                	jmp    8011c1 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ed:	83 ec 0c             	sub    $0xc,%esp
+  8011f0:	50                   	push   %eax
+  8011f1:	6a 08                	push   $0x8
+  8011f3:	68 2b 3b 80 00       	push   $0x803b2b
+  8011f8:	6a 3f                	push   $0x3f
+  8011fa:	68 48 3b 80 00       	push   $0x803b48
+  8011ff:	e8 34 f2 ff ff       	call   800438 <_panic>
+
+00801204 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801204:	55                   	push   %ebp
+  801205:	89 e5                	mov    %esp,%ebp
+  801207:	57                   	push   %edi
+  801208:	56                   	push   %esi
+  801209:	53                   	push   %ebx
+  80120a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80120d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801214:	74 22                	je     801238 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801216:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801220:	8b 55 08             	mov    0x8(%ebp),%edx
+  801223:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801226:	89 df                	mov    %ebx,%edi
+  801228:	89 de                	mov    %ebx,%esi
+  80122a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80122c:	85 c0                	test   %eax,%eax
+  80122e:	7f 28                	jg     801258 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801233:	5b                   	pop    %ebx
+  801234:	5e                   	pop    %esi
+  801235:	5f                   	pop    %edi
+  801236:	5d                   	pop    %ebp
+  801237:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80123d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801243:	b8 09 00 00 00       	mov    $0x9,%eax
+  801248:	89 df                	mov    %ebx,%edi
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	8d 35 55 12 80 00    	lea    0x801255,%esi
+  801253:	0f 34                	sysenter
+  801255:	5d                   	pop    %ebp
+		goto out;
+  801256:	eb d4                	jmp    80122c <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801258:	83 ec 0c             	sub    $0xc,%esp
+  80125b:	50                   	push   %eax
+  80125c:	6a 09                	push   $0x9
+  80125e:	68 2b 3b 80 00       	push   $0x803b2b
+  801263:	6a 3f                	push   $0x3f
+  801265:	68 48 3b 80 00       	push   $0x803b48
+  80126a:	e8 c9 f1 ff ff       	call   800438 <_panic>
+
+0080126f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	57                   	push   %edi
+  801273:	56                   	push   %esi
+  801274:	53                   	push   %ebx
+  801275:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801278:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80127f:	74 22                	je     8012a3 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801281:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801286:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80128b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801291:	89 df                	mov    %ebx,%edi
+  801293:	89 de                	mov    %ebx,%esi
+  801295:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801297:	85 c0                	test   %eax,%eax
+  801299:	7f 28                	jg     8012c3 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80129b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129e:	5b                   	pop    %ebx
+  80129f:	5e                   	pop    %esi
+  8012a0:	5f                   	pop    %edi
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012b3:	89 df                	mov    %ebx,%edi
+  8012b5:	55                   	push   %ebp
+  8012b6:	89 e5                	mov    %esp,%ebp
+  8012b8:	8d 35 c0 12 80 00    	lea    0x8012c0,%esi
+  8012be:	0f 34                	sysenter
+  8012c0:	5d                   	pop    %ebp
+		goto out;
+  8012c1:	eb d4                	jmp    801297 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c3:	83 ec 0c             	sub    $0xc,%esp
+  8012c6:	50                   	push   %eax
+  8012c7:	6a 0a                	push   $0xa
+  8012c9:	68 2b 3b 80 00       	push   $0x803b2b
+  8012ce:	6a 3f                	push   $0x3f
+  8012d0:	68 48 3b 80 00       	push   $0x803b48
+  8012d5:	e8 5e f1 ff ff       	call   800438 <_panic>
+
+008012da <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	57                   	push   %edi
+  8012de:	56                   	push   %esi
+  8012df:	53                   	push   %ebx
+  8012e0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012e3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012ea:	74 22                	je     80130e <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8012ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fc:	89 df                	mov    %ebx,%edi
+  8012fe:	89 de                	mov    %ebx,%esi
+  801300:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801302:	85 c0                	test   %eax,%eax
+  801304:	7f 28                	jg     80132e <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801306:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5f                   	pop    %edi
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80130e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801313:	8b 55 08             	mov    0x8(%ebp),%edx
+  801316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801319:	b8 17 00 00 00       	mov    $0x17,%eax
+  80131e:	89 df                	mov    %ebx,%edi
+  801320:	55                   	push   %ebp
+  801321:	89 e5                	mov    %esp,%ebp
+  801323:	8d 35 2b 13 80 00    	lea    0x80132b,%esi
+  801329:	0f 34                	sysenter
+  80132b:	5d                   	pop    %ebp
+		goto out;
+  80132c:	eb d4                	jmp    801302 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	50                   	push   %eax
+  801332:	6a 17                	push   $0x17
+  801334:	68 2b 3b 80 00       	push   $0x803b2b
+  801339:	6a 3f                	push   $0x3f
+  80133b:	68 48 3b 80 00       	push   $0x803b48
+  801340:	e8 f3 f0 ff ff       	call   800438 <_panic>
+
+00801345 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80134e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801355:	74 22                	je     801379 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801357:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801361:	8b 55 08             	mov    0x8(%ebp),%edx
+  801364:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801367:	89 df                	mov    %ebx,%edi
+  801369:	89 de                	mov    %ebx,%esi
+  80136b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80136d:	85 c0                	test   %eax,%eax
+  80136f:	7f 28                	jg     801399 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801371:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801374:	5b                   	pop    %ebx
+  801375:	5e                   	pop    %esi
+  801376:	5f                   	pop    %edi
+  801377:	5d                   	pop    %ebp
+  801378:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801379:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801381:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801384:	b8 18 00 00 00       	mov    $0x18,%eax
+  801389:	89 df                	mov    %ebx,%edi
+  80138b:	55                   	push   %ebp
+  80138c:	89 e5                	mov    %esp,%ebp
+  80138e:	8d 35 96 13 80 00    	lea    0x801396,%esi
+  801394:	0f 34                	sysenter
+  801396:	5d                   	pop    %ebp
+		goto out;
+  801397:	eb d4                	jmp    80136d <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801399:	83 ec 0c             	sub    $0xc,%esp
+  80139c:	50                   	push   %eax
+  80139d:	6a 18                	push   $0x18
+  80139f:	68 2b 3b 80 00       	push   $0x803b2b
+  8013a4:	6a 3f                	push   $0x3f
+  8013a6:	68 48 3b 80 00       	push   $0x803b48
+  8013ab:	e8 88 f0 ff ff       	call   800438 <_panic>
+
+008013b0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8013b0:	55                   	push   %ebp
+  8013b1:	89 e5                	mov    %esp,%ebp
+  8013b3:	57                   	push   %edi
+  8013b4:	56                   	push   %esi
+  8013b5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013b6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013bd:	74 1d                	je     8013dc <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8013bf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8013d7:	5b                   	pop    %ebx
+  8013d8:	5e                   	pop    %esi
+  8013d9:	5f                   	pop    %edi
+  8013da:	5d                   	pop    %ebp
+  8013db:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013ed:	55                   	push   %ebp
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	8d 35 f8 13 80 00    	lea    0x8013f8,%esi
+  8013f6:	0f 34                	sysenter
+  8013f8:	5d                   	pop    %ebp
+		goto out;
+  8013f9:	eb dc                	jmp    8013d7 <sys_ipc_try_send+0x27>
+
+008013fb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8013fb:	55                   	push   %ebp
+  8013fc:	89 e5                	mov    %esp,%ebp
+  8013fe:	57                   	push   %edi
+  8013ff:	56                   	push   %esi
+  801400:	53                   	push   %ebx
+  801401:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801404:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80140b:	74 21                	je     80142e <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80140d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801412:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801417:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141a:	89 cb                	mov    %ecx,%ebx
+  80141c:	89 cf                	mov    %ecx,%edi
+  80141e:	89 ce                	mov    %ecx,%esi
+  801420:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801422:	85 c0                	test   %eax,%eax
+  801424:	7f 27                	jg     80144d <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80142e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801431:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801436:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80143b:	89 cb                	mov    %ecx,%ebx
+  80143d:	89 cf                	mov    %ecx,%edi
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	8d 35 4a 14 80 00    	lea    0x80144a,%esi
+  801448:	0f 34                	sysenter
+  80144a:	5d                   	pop    %ebp
+		goto out;
+  80144b:	eb d5                	jmp    801422 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80144d:	83 ec 0c             	sub    $0xc,%esp
+  801450:	50                   	push   %eax
+  801451:	6a 0d                	push   $0xd
+  801453:	68 2b 3b 80 00       	push   $0x803b2b
+  801458:	6a 3f                	push   $0x3f
+  80145a:	68 48 3b 80 00       	push   $0x803b48
+  80145f:	e8 d4 ef ff ff       	call   800438 <_panic>
+
+00801464 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801464:	55                   	push   %ebp
+  801465:	89 e5                	mov    %esp,%ebp
+  801467:	57                   	push   %edi
+  801468:	56                   	push   %esi
+  801469:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80146a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801471:	74 1b                	je     80148e <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801473:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801478:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80147d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801480:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801483:	89 df                	mov    %ebx,%edi
+  801485:	89 de                	mov    %ebx,%esi
+  801487:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801489:	5b                   	pop    %ebx
+  80148a:	5e                   	pop    %esi
+  80148b:	5f                   	pop    %edi
+  80148c:	5d                   	pop    %ebp
+  80148d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80148e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801493:	8b 55 08             	mov    0x8(%ebp),%edx
+  801496:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801499:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80149e:	89 df                	mov    %ebx,%edi
+  8014a0:	55                   	push   %ebp
+  8014a1:	89 e5                	mov    %esp,%ebp
+  8014a3:	8d 35 ab 14 80 00    	lea    0x8014ab,%esi
+  8014a9:	0f 34                	sysenter
+  8014ab:	5d                   	pop    %ebp
+		goto out;
+  8014ac:	eb db                	jmp    801489 <sys_ipc_recv_until+0x25>
+
+008014ae <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	57                   	push   %edi
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014b4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014bb:	74 19                	je     8014d6 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8014bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014c7:	89 d1                	mov    %edx,%ecx
+  8014c9:	89 d3                	mov    %edx,%ebx
+  8014cb:	89 d7                	mov    %edx,%edi
+  8014cd:	89 d6                	mov    %edx,%esi
+  8014cf:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8014d1:	5b                   	pop    %ebx
+  8014d2:	5e                   	pop    %esi
+  8014d3:	5f                   	pop    %edi
+  8014d4:	5d                   	pop    %ebp
+  8014d5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014db:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014e0:	89 d1                	mov    %edx,%ecx
+  8014e2:	89 d3                	mov    %edx,%ebx
+  8014e4:	89 d7                	mov    %edx,%edi
+  8014e6:	55                   	push   %ebp
+  8014e7:	89 e5                	mov    %esp,%ebp
+  8014e9:	8d 35 f1 14 80 00    	lea    0x8014f1,%esi
+  8014ef:	0f 34                	sysenter
+  8014f1:	5d                   	pop    %ebp
+		goto out;
+  8014f2:	eb dd                	jmp    8014d1 <sys_time_msec+0x23>
+
+008014f4 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	57                   	push   %edi
+  8014f8:	56                   	push   %esi
+  8014f9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014fa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801501:	74 1a                	je     80151d <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801503:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801508:	b8 10 00 00 00       	mov    $0x10,%eax
+  80150d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801510:	89 cb                	mov    %ecx,%ebx
+  801512:	89 cf                	mov    %ecx,%edi
+  801514:	89 ce                	mov    %ecx,%esi
+  801516:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801518:	5b                   	pop    %ebx
+  801519:	5e                   	pop    %esi
+  80151a:	5f                   	pop    %edi
+  80151b:	5d                   	pop    %ebp
+  80151c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80151d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801525:	b8 10 00 00 00       	mov    $0x10,%eax
+  80152a:	89 cb                	mov    %ecx,%ebx
+  80152c:	89 cf                	mov    %ecx,%edi
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	8d 35 39 15 80 00    	lea    0x801539,%esi
+  801537:	0f 34                	sysenter
+  801539:	5d                   	pop    %ebp
+		goto out;
+  80153a:	eb dc                	jmp    801518 <sys_sleep_until+0x24>
+
+0080153c <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80153c:	55                   	push   %ebp
+  80153d:	89 e5                	mov    %esp,%ebp
+  80153f:	57                   	push   %edi
+  801540:	56                   	push   %esi
+  801541:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801542:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801549:	74 1a                	je     801565 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80154b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801550:	b8 11 00 00 00       	mov    $0x11,%eax
+  801555:	8b 55 08             	mov    0x8(%ebp),%edx
+  801558:	89 cb                	mov    %ecx,%ebx
+  80155a:	89 cf                	mov    %ecx,%edi
+  80155c:	89 ce                	mov    %ecx,%esi
+  80155e:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5f                   	pop    %edi
+  801563:	5d                   	pop    %ebp
+  801564:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801565:	8b 55 08             	mov    0x8(%ebp),%edx
+  801568:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80156d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801572:	89 cb                	mov    %ecx,%ebx
+  801574:	89 cf                	mov    %ecx,%edi
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	8d 35 81 15 80 00    	lea    0x801581,%esi
+  80157f:	0f 34                	sysenter
+  801581:	5d                   	pop    %ebp
+		goto out;
+  801582:	eb dc                	jmp    801560 <sys_env_print_stats+0x24>
+
+00801584 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801584:	55                   	push   %ebp
+  801585:	89 e5                	mov    %esp,%ebp
+  801587:	57                   	push   %edi
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80158a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801591:	74 1b                	je     8015ae <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801593:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801598:	b8 19 00 00 00       	mov    $0x19,%eax
+  80159d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a3:	89 df                	mov    %ebx,%edi
+  8015a5:	89 de                	mov    %ebx,%esi
+  8015a7:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8015a9:	5b                   	pop    %ebx
+  8015aa:	5e                   	pop    %esi
+  8015ab:	5f                   	pop    %edi
+  8015ac:	5d                   	pop    %ebp
+  8015ad:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8015be:	89 df                	mov    %ebx,%edi
+  8015c0:	55                   	push   %ebp
+  8015c1:	89 e5                	mov    %esp,%ebp
+  8015c3:	8d 35 cb 15 80 00    	lea    0x8015cb,%esi
+  8015c9:	0f 34                	sysenter
+  8015cb:	5d                   	pop    %ebp
+		goto out;
+  8015cc:	eb db                	jmp    8015a9 <sys_perf+0x25>
+
+008015ce <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8015ce:	55                   	push   %ebp
+  8015cf:	89 e5                	mov    %esp,%ebp
+  8015d1:	57                   	push   %edi
+  8015d2:	56                   	push   %esi
+  8015d3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015d4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015db:	74 19                	je     8015f6 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8015dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8015e7:	89 d1                	mov    %edx,%ecx
+  8015e9:	89 d3                	mov    %edx,%ebx
+  8015eb:	89 d7                	mov    %edx,%edi
+  8015ed:	89 d6                	mov    %edx,%esi
+  8015ef:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8015f1:	5b                   	pop    %ebx
+  8015f2:	5e                   	pop    %esi
+  8015f3:	5f                   	pop    %edi
+  8015f4:	5d                   	pop    %ebp
+  8015f5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801600:	89 d1                	mov    %edx,%ecx
+  801602:	89 d3                	mov    %edx,%ebx
+  801604:	89 d7                	mov    %edx,%edi
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	8d 35 11 16 80 00    	lea    0x801611,%esi
+  80160f:	0f 34                	sysenter
+  801611:	5d                   	pop    %ebp
+		goto out;
+  801612:	eb dd                	jmp    8015f1 <sys_fork+0x23>
+
+00801614 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+  801617:	57                   	push   %edi
+  801618:	56                   	push   %esi
+  801619:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80161a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801621:	74 1c                	je     80163f <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801623:	be 00 00 00 00       	mov    $0x0,%esi
+  801628:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80162d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801630:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801633:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801636:	89 f7                	mov    %esi,%edi
+  801638:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80163a:	5b                   	pop    %ebx
+  80163b:	5e                   	pop    %esi
+  80163c:	5f                   	pop    %edi
+  80163d:	5d                   	pop    %ebp
+  80163e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80163f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801642:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801645:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80164a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80164f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801652:	55                   	push   %ebp
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	8d 35 5d 16 80 00    	lea    0x80165d,%esi
+  80165b:	0f 34                	sysenter
+  80165d:	5d                   	pop    %ebp
+		goto out;
+  80165e:	eb da                	jmp    80163a <sys_thread_create+0x26>
+
+00801660 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	57                   	push   %edi
+  801664:	56                   	push   %esi
+  801665:	53                   	push   %ebx
+  801666:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801669:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801670:	74 24                	je     801696 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801672:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801677:	be 00 00 00 00       	mov    $0x0,%esi
+  80167c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801682:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801685:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801688:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	7f 27                	jg     8016b5 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80168e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801691:	5b                   	pop    %ebx
+  801692:	5e                   	pop    %esi
+  801693:	5f                   	pop    %edi
+  801694:	5d                   	pop    %ebp
+  801695:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801696:	8b 55 08             	mov    0x8(%ebp),%edx
+  801699:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80169c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8016a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016a7:	55                   	push   %ebp
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	8d 35 b2 16 80 00    	lea    0x8016b2,%esi
+  8016b0:	0f 34                	sysenter
+  8016b2:	5d                   	pop    %ebp
+		goto out;
+  8016b3:	eb d5                	jmp    80168a <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016b5:	83 ec 0c             	sub    $0xc,%esp
+  8016b8:	50                   	push   %eax
+  8016b9:	6a 1f                	push   $0x1f
+  8016bb:	68 2b 3b 80 00       	push   $0x803b2b
+  8016c0:	6a 3f                	push   $0x3f
+  8016c2:	68 48 3b 80 00       	push   $0x803b48
+  8016c7:	e8 6c ed ff ff       	call   800438 <_panic>
+
+008016cc <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	57                   	push   %edi
+  8016d0:	56                   	push   %esi
+  8016d1:	53                   	push   %ebx
+  8016d2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016d5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016dc:	74 23                	je     801701 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8016de:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e3:	b8 20 00 00 00       	mov    $0x20,%eax
+  8016e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f1:	89 f7                	mov    %esi,%edi
+  8016f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016f5:	85 c0                	test   %eax,%eax
+  8016f7:	7f 29                	jg     801722 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8016f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016fc:	5b                   	pop    %ebx
+  8016fd:	5e                   	pop    %esi
+  8016fe:	5f                   	pop    %edi
+  8016ff:	5d                   	pop    %ebp
+  801700:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801701:	8b 55 08             	mov    0x8(%ebp),%edx
+  801704:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801707:	b8 20 00 00 00       	mov    $0x20,%eax
+  80170c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801711:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801714:	55                   	push   %ebp
+  801715:	89 e5                	mov    %esp,%ebp
+  801717:	8d 35 1f 17 80 00    	lea    0x80171f,%esi
+  80171d:	0f 34                	sysenter
+  80171f:	5d                   	pop    %ebp
+		goto out;
+  801720:	eb d3                	jmp    8016f5 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801722:	83 ec 0c             	sub    $0xc,%esp
+  801725:	50                   	push   %eax
+  801726:	6a 20                	push   $0x20
+  801728:	68 2b 3b 80 00       	push   $0x803b2b
+  80172d:	6a 3f                	push   $0x3f
+  80172f:	68 48 3b 80 00       	push   $0x803b48
+  801734:	e8 ff ec ff ff       	call   800438 <_panic>
+
+00801739 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801739:	55                   	push   %ebp
+  80173a:	89 e5                	mov    %esp,%ebp
+  80173c:	57                   	push   %edi
+  80173d:	56                   	push   %esi
+  80173e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80173f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801746:	74 1b                	je     801763 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801748:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801752:	8b 55 08             	mov    0x8(%ebp),%edx
+  801755:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801758:	89 df                	mov    %ebx,%edi
+  80175a:	89 de                	mov    %ebx,%esi
+  80175c:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80175e:	5b                   	pop    %ebx
+  80175f:	5e                   	pop    %esi
+  801760:	5f                   	pop    %edi
+  801761:	5d                   	pop    %ebp
+  801762:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801763:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801768:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80176e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801773:	89 df                	mov    %ebx,%edi
+  801775:	55                   	push   %ebp
+  801776:	89 e5                	mov    %esp,%ebp
+  801778:	8d 35 80 17 80 00    	lea    0x801780,%esi
+  80177e:	0f 34                	sysenter
+  801780:	5d                   	pop    %ebp
+		goto out;
+  801781:	eb db                	jmp    80175e <sys_batch+0x25>
+
+00801783 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801783:	55                   	push   %ebp
+  801784:	89 e5                	mov    %esp,%ebp
+  801786:	57                   	push   %edi
+  801787:	56                   	push   %esi
+  801788:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801789:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801790:	74 1a                	je     8017ac <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801792:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801797:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80179c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80179f:	89 cb                	mov    %ecx,%ebx
+  8017a1:	89 cf                	mov    %ecx,%edi
+  8017a3:	89 ce                	mov    %ecx,%esi
+  8017a5:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8017a7:	5b                   	pop    %ebx
+  8017a8:	5e                   	pop    %esi
+  8017a9:	5f                   	pop    %edi
+  8017aa:	5d                   	pop    %ebp
+  8017ab:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017b4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8017b9:	89 cb                	mov    %ecx,%ebx
+  8017bb:	89 cf                	mov    %ecx,%edi
+  8017bd:	55                   	push   %ebp
+  8017be:	89 e5                	mov    %esp,%ebp
+  8017c0:	8d 35 c8 17 80 00    	lea    0x8017c8,%esi
+  8017c6:	0f 34                	sysenter
+  8017c8:	5d                   	pop    %ebp
+		goto out;
+  8017c9:	eb dc                	jmp    8017a7 <sys_trace_ctl+0x24>
+
+008017cb <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8017cb:	55                   	push   %ebp
+  8017cc:	89 e5                	mov    %esp,%ebp
+  8017ce:	57                   	push   %edi
+  8017cf:	56                   	push   %esi
+  8017d0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017d1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017d8:	74 1c                	je     8017f6 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8017da:	be 00 00 00 00       	mov    $0x0,%esi
+  8017df:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8017e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017ed:	89 f7                	mov    %esi,%edi
+  8017ef:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8017f1:	5b                   	pop    %ebx
+  8017f2:	5e                   	pop    %esi
+  8017f3:	5f                   	pop    %edi
+  8017f4:	5d                   	pop    %ebp
+  8017f5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801801:	bf 00 00 00 00       	mov    $0x0,%edi
+  801806:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801809:	55                   	push   %ebp
+  80180a:	89 e5                	mov    %esp,%ebp
+  80180c:	8d 35 14 18 80 00    	lea    0x801814,%esi
+  801812:	0f 34                	sysenter
+  801814:	5d                   	pop    %ebp
+		goto out;
+  801815:	eb da                	jmp    8017f1 <sys_trace_read+0x26>
+
+00801817 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	57                   	push   %edi
+  80181b:	56                   	push   %esi
+  80181c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80181d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801824:	74 1c                	je     801842 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801826:	be 00 00 00 00       	mov    $0x0,%esi
+  80182b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801830:	8b 55 08             	mov    0x8(%ebp),%edx
+  801833:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801836:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801839:	89 f7                	mov    %esi,%edi
+  80183b:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80183d:	5b                   	pop    %ebx
+  80183e:	5e                   	pop    %esi
+  80183f:	5f                   	pop    %edi
+  801840:	5d                   	pop    %ebp
+  801841:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801842:	8b 55 08             	mov    0x8(%ebp),%edx
+  801845:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801848:	b8 21 00 00 00       	mov    $0x21,%eax
+  80184d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801852:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801855:	55                   	push   %ebp
+  801856:	89 e5                	mov    %esp,%ebp
+  801858:	8d 35 60 18 80 00    	lea    0x801860,%esi
+  80185e:	0f 34                	sysenter
+  801860:	5d                   	pop    %ebp
+		goto out;
+  801861:	eb da                	jmp    80183d <sys_meminfo+0x26>
+
+00801863 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801863:	55                   	push   %ebp
+  801864:	89 e5                	mov    %esp,%ebp
+  801866:	57                   	push   %edi
+  801867:	56                   	push   %esi
+  801868:	53                   	push   %ebx
+  801869:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80186c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801870:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801877:	74 1f                	je     801898 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801879:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187e:	b8 22 00 00 00       	mov    $0x22,%eax
+  801883:	8b 55 08             	mov    0x8(%ebp),%edx
+  801886:	89 df                	mov    %ebx,%edi
+  801888:	89 de                	mov    %ebx,%esi
+  80188a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80188c:	85 c0                	test   %eax,%eax
+  80188e:	7f 25                	jg     8018b5 <sys_env_set_ksm+0x52>
+}
+  801890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801893:	5b                   	pop    %ebx
+  801894:	5e                   	pop    %esi
+  801895:	5f                   	pop    %edi
+  801896:	5d                   	pop    %ebp
+  801897:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801898:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a0:	b8 22 00 00 00       	mov    $0x22,%eax
+  8018a5:	89 df                	mov    %ebx,%edi
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	8d 35 b2 18 80 00    	lea    0x8018b2,%esi
+  8018b0:	0f 34                	sysenter
+  8018b2:	5d                   	pop    %ebp
+		goto out;
+  8018b3:	eb d7                	jmp    80188c <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018b5:	83 ec 0c             	sub    $0xc,%esp
+  8018b8:	50                   	push   %eax
+  8018b9:	6a 22                	push   $0x22
+  8018bb:	68 2b 3b 80 00       	push   $0x803b2b
+  8018c0:	6a 3f                	push   $0x3f
+  8018c2:	68 48 3b 80 00       	push   $0x803b48
+  8018c7:	e8 6c eb ff ff       	call   800438 <_panic>
+
+008018cc <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	57                   	push   %edi
+  8018d0:	56                   	push   %esi
+  8018d1:	53                   	push   %ebx
+  8018d2:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8018d5:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8018d8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018df:	74 24                	je     801905 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8018e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018e6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8018eb:	89 cb                	mov    %ecx,%ebx
+  8018ed:	89 cf                	mov    %ecx,%edi
+  8018ef:	89 ce                	mov    %ecx,%esi
+  8018f1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	7f 2a                	jg     801921 <sys_time_nsec+0x55>
+	return ns;
+}
+  8018f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018fa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8018fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801900:	5b                   	pop    %ebx
+  801901:	5e                   	pop    %esi
+  801902:	5f                   	pop    %edi
+  801903:	5d                   	pop    %ebp
+  801904:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801905:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80190a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80190f:	89 cb                	mov    %ecx,%ebx
+  801911:	89 cf                	mov    %ecx,%edi
+  801913:	55                   	push   %ebp
+  801914:	89 e5                	mov    %esp,%ebp
+  801916:	8d 35 1e 19 80 00    	lea    0x80191e,%esi
+  80191c:	0f 34                	sysenter
+  80191e:	5d                   	pop    %ebp
+		goto out;
+  80191f:	eb d2                	jmp    8018f3 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801921:	83 ec 0c             	sub    $0xc,%esp
+  801924:	50                   	push   %eax
+  801925:	6a 0f                	push   $0xf
+  801927:	68 2b 3b 80 00       	push   $0x803b2b
+  80192c:	6a 3f                	push   $0x3f
+  80192e:	68 48 3b 80 00       	push   $0x803b48
+  801933:	e8 00 eb ff ff       	call   800438 <_panic>
+
+00801938 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801938:	55                   	push   %ebp
+  801939:	89 e5                	mov    %esp,%ebp
+  80193b:	57                   	push   %edi
+  80193c:	56                   	push   %esi
+  80193d:	53                   	push   %ebx
+  80193e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801941:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801948:	74 22                	je     80196c <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80194a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801954:	8b 55 08             	mov    0x8(%ebp),%edx
+  801957:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80195a:	89 df                	mov    %ebx,%edi
+  80195c:	89 de                	mov    %ebx,%esi
+  80195e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801960:	85 c0                	test   %eax,%eax
+  801962:	7f 28                	jg     80198c <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801964:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801967:	5b                   	pop    %ebx
+  801968:	5e                   	pop    %esi
+  801969:	5f                   	pop    %edi
+  80196a:	5d                   	pop    %ebp
+  80196b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80196c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801971:	8b 55 08             	mov    0x8(%ebp),%edx
+  801974:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801977:	b8 12 00 00 00       	mov    $0x12,%eax
+  80197c:	89 df                	mov    %ebx,%edi
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	8d 35 89 19 80 00    	lea    0x801989,%esi
+  801987:	0f 34                	sysenter
+  801989:	5d                   	pop    %ebp
+		goto out;
+  80198a:	eb d4                	jmp    801960 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80198c:	83 ec 0c             	sub    $0xc,%esp
+  80198f:	50                   	push   %eax
+  801990:	6a 12                	push   $0x12
+  801992:	68 2b 3b 80 00       	push   $0x803b2b
+  801997:	6a 3f                	push   $0x3f
+  801999:	68 48 3b 80 00       	push   $0x803b48
+  80199e:	e8 95 ea ff ff       	call   800438 <_panic>
+
+008019a3 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	57                   	push   %edi
+  8019a7:	56                   	push   %esi
+  8019a8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019a9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8019b0:	74 1b                	je     8019cd <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8019b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019c2:	89 df                	mov    %ebx,%edi
+  8019c4:	89 de                	mov    %ebx,%esi
+  8019c6:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8019c8:	5b                   	pop    %ebx
+  8019c9:	5e                   	pop    %esi
+  8019ca:	5f                   	pop    %edi
+  8019cb:	5d                   	pop    %ebp
+  8019cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019d8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8019dd:	89 df                	mov    %ebx,%edi
+  8019df:	55                   	push   %ebp
+  8019e0:	89 e5                	mov    %esp,%ebp
+  8019e2:	8d 35 ea 19 80 00    	lea    0x8019ea,%esi
+  8019e8:	0f 34                	sysenter
+  8019ea:	5d                   	pop    %ebp
+		goto out;
+  8019eb:	eb db                	jmp    8019c8 <sys_e1000_receive+0x25>
+
+008019ed <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8019ed:	55                   	push   %ebp
+  8019ee:	89 e5                	mov    %esp,%ebp
+  8019f0:	57                   	push   %edi
+  8019f1:	56                   	push   %esi
+  8019f2:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8019f3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8019fa:	74 1b                	je     801a17 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8019fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a01:	b8 14 00 00 00       	mov    $0x14,%eax
+  801a06:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a0c:	89 df                	mov    %ebx,%edi
+  801a0e:	89 de                	mov    %ebx,%esi
+  801a10:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801a12:	5b                   	pop    %ebx
+  801a13:	5e                   	pop    %esi
+  801a14:	5f                   	pop    %edi
+  801a15:	5d                   	pop    %ebp
+  801a16:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a22:	b8 14 00 00 00       	mov    $0x14,%eax
+  801a27:	89 df                	mov    %ebx,%edi
+  801a29:	55                   	push   %ebp
+  801a2a:	89 e5                	mov    %esp,%ebp
+  801a2c:	8d 35 34 1a 80 00    	lea    0x801a34,%esi
+  801a32:	0f 34                	sysenter
+  801a34:	5d                   	pop    %ebp
+		goto out;
+  801a35:	eb db                	jmp    801a12 <sys_e1000_read_hwaddr+0x25>
+
+00801a37 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801a37:	55                   	push   %ebp
+  801a38:	89 e5                	mov    %esp,%ebp
+  801a3a:	57                   	push   %edi
+  801a3b:	56                   	push   %esi
+  801a3c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a3d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801a44:	74 1a                	je     801a60 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801a46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a4b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a50:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a53:	89 cb                	mov    %ecx,%ebx
+  801a55:	89 cf                	mov    %ecx,%edi
+  801a57:	89 ce                	mov    %ecx,%esi
+  801a59:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801a5b:	5b                   	pop    %ebx
+  801a5c:	5e                   	pop    %esi
+  801a5d:	5f                   	pop    %edi
+  801a5e:	5d                   	pop    %ebp
+  801a5f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a60:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a68:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a6d:	89 cb                	mov    %ecx,%ebx
+  801a6f:	89 cf                	mov    %ecx,%edi
+  801a71:	55                   	push   %ebp
+  801a72:	89 e5                	mov    %esp,%ebp
+  801a74:	8d 35 7c 1a 80 00    	lea    0x801a7c,%esi
+  801a7a:	0f 34                	sysenter
+  801a7c:	5d                   	pop    %ebp
+		goto out;
+  801a7d:	eb dc                	jmp    801a5b <sys_sb16_read_version+0x24>
+
+00801a7f <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801a7f:	55                   	push   %ebp
+  801a80:	89 e5                	mov    %esp,%ebp
+  801a82:	57                   	push   %edi
+  801a83:	56                   	push   %esi
+  801a84:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a85:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801a8c:	74 1b                	je     801aa9 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801a8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a93:	b8 16 00 00 00       	mov    $0x16,%eax
+  801a98:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a9e:	89 df                	mov    %ebx,%edi
+  801aa0:	89 de                	mov    %ebx,%esi
+  801aa2:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801aa4:	5b                   	pop    %ebx
+  801aa5:	5e                   	pop    %esi
+  801aa6:	5f                   	pop    %edi
+  801aa7:	5d                   	pop    %ebp
+  801aa8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801aa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aae:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ab1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ab4:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ab9:	89 df                	mov    %ebx,%edi
+  801abb:	55                   	push   %ebp
+  801abc:	89 e5                	mov    %esp,%ebp
+  801abe:	8d 35 c6 1a 80 00    	lea    0x801ac6,%esi
+  801ac4:	0f 34                	sysenter
+  801ac6:	5d                   	pop    %ebp
+		goto out;
+  801ac7:	eb db                	jmp    801aa4 <sys_sb16_play+0x25>
+
+00801ac9 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+  801acc:	53                   	push   %ebx
+  801acd:	83 ec 04             	sub    $0x4,%esp
+  801ad0:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801ad2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ad9:	f6 c4 04             	test   $0x4,%ah
+  801adc:	74 0c                	je     801aea <dupperm+0x21>
+  801ade:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801ae5:	f6 c4 08             	test   $0x8,%ah
+  801ae8:	75 62                	jne    801b4c <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801aea:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801af1:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801af6:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801afc:	74 19                	je     801b17 <dupperm+0x4e>
+  801afe:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801b05:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801b0a:	83 f8 01             	cmp    $0x1,%eax
+  801b0d:	19 c0                	sbb    %eax,%eax
+  801b0f:	25 00 08 00 00       	and    $0x800,%eax
+  801b14:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801b17:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  801b1e:	89 c1                	mov    %eax,%ecx
+  801b20:	80 cd 04             	or     $0x4,%ch
+  801b23:	f6 c7 04             	test   $0x4,%bh
+  801b26:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801b29:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801b30:	f6 c1 02             	test   $0x2,%cl
+  801b33:	74 12                	je     801b47 <dupperm+0x7e>
+  801b35:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801b3c:	89 c2                	mov    %eax,%edx
+  801b3e:	83 ca 02             	or     $0x2,%edx
+  801b41:	f6 c5 04             	test   $0x4,%ch
+  801b44:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801b47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b4a:	c9                   	leave
+  801b4b:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801b4c:	68 58 3b 80 00       	push   $0x803b58
+  801b51:	68 f0 3b 80 00       	push   $0x803bf0
+  801b56:	6a 39                	push   $0x39
+  801b58:	68 05 3c 80 00       	push   $0x803c05
+  801b5d:	e8 d6 e8 ff ff       	call   800438 <_panic>
+
+00801b62 <pgfault>:
+{
+  801b62:	55                   	push   %ebp
+  801b63:	89 e5                	mov    %esp,%ebp
+  801b65:	53                   	push   %ebx
+  801b66:	83 ec 04             	sub    $0x4,%esp
+  801b69:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801b6c:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801b6e:	89 c3                	mov    %eax,%ebx
+  801b70:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801b76:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801b7a:	74 6d                	je     801be9 <pgfault+0x87>
+  801b7c:	89 da                	mov    %ebx,%edx
+  801b7e:	c1 ea 16             	shr    $0x16,%edx
+  801b81:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b88:	f6 c2 80             	test   $0x80,%dl
+  801b8b:	75 5c                	jne    801be9 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801b8d:	c1 e8 0c             	shr    $0xc,%eax
+  801b90:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801b97:	f6 c4 08             	test   $0x8,%ah
+  801b9a:	74 4d                	je     801be9 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801b9c:	83 ec 04             	sub    $0x4,%esp
+  801b9f:	6a 07                	push   $0x7
+  801ba1:	68 00 f0 7f 00       	push   $0x7ff000
+  801ba6:	6a 00                	push   $0x0
+  801ba8:	e8 a6 f4 ff ff       	call   801053 <sys_page_alloc>
+  801bad:	83 c4 10             	add    $0x10,%esp
+  801bb0:	85 c0                	test   %eax,%eax
+  801bb2:	78 49                	js     801bfd <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801bb4:	83 ec 04             	sub    $0x4,%esp
+  801bb7:	68 00 10 00 00       	push   $0x1000
+  801bbc:	53                   	push   %ebx
+  801bbd:	68 00 f0 7f 00       	push   $0x7ff000
+  801bc2:	e8 1a f1 ff ff       	call   800ce1 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801bc7:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801bce:	53                   	push   %ebx
+  801bcf:	6a 00                	push   $0x0
+  801bd1:	68 00 f0 7f 00       	push   $0x7ff000
+  801bd6:	6a 00                	push   $0x0
+  801bd8:	e8 e3 f4 ff ff       	call   8010c0 <sys_page_map>
+  801bdd:	83 c4 20             	add    $0x20,%esp
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 2d                	js     801c11 <pgfault+0xaf>
+}
+  801be4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be7:	c9                   	leave
+  801be8:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801be9:	83 ec 04             	sub    $0x4,%esp
+  801bec:	68 10 3c 80 00       	push   $0x803c10
+  801bf1:	6a 1e                	push   $0x1e
+  801bf3:	68 05 3c 80 00       	push   $0x803c05
+  801bf8:	e8 3b e8 ff ff       	call   800438 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801bfd:	83 ec 04             	sub    $0x4,%esp
+  801c00:	68 8c 3b 80 00       	push   $0x803b8c
+  801c05:	6a 29                	push   $0x29
+  801c07:	68 05 3c 80 00       	push   $0x803c05
+  801c0c:	e8 27 e8 ff ff       	call   800438 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801c11:	50                   	push   %eax
+  801c12:	68 c0 3b 80 00       	push   $0x803bc0
+  801c17:	6a 2e                	push   $0x2e
+  801c19:	68 05 3c 80 00       	push   $0x803c05
+  801c1e:	e8 15 e8 ff ff       	call   800438 <_panic>
+
+00801c23 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801c23:	55                   	push   %ebp
+  801c24:	89 e5                	mov    %esp,%ebp
+  801c26:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801c29:	ff 75 0c             	push   0xc(%ebp)
+  801c2c:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801c2f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801c36:	e8 23 f3 ff ff       	call   800f5e <sys_env_destroy>
+}
+  801c3b:	83 c4 10             	add    $0x10,%esp
+  801c3e:	c9                   	leave
+  801c3f:	c3                   	ret
+
+00801c40 <ufork>:
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	57                   	push   %edi
+  801c44:	56                   	push   %esi
+  801c45:	53                   	push   %ebx
+  801c46:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801c4c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c51:	cd 30                	int    $0x30
+  801c53:	89 c6                	mov    %eax,%esi
+  801c55:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	78 56                	js     801cb5 <ufork+0x75>
+	if (pid > 0) {
+  801c5f:	0f 8e b3 02 00 00    	jle    801f18 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801c65:	83 ec 0c             	sub    $0xc,%esp
+  801c68:	68 62 1b 80 00       	push   $0x801b62
+  801c6d:	e8 aa 17 00 00       	call   80341c <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801c72:	83 c4 08             	add    $0x8,%esp
+  801c75:	68 83 34 80 00       	push   $0x803483
+  801c7a:	56                   	push   %esi
+  801c7b:	e8 ef f5 ff ff       	call   80126f <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801c80:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801c86:	89 1c 24             	mov    %ebx,(%esp)
+  801c89:	e8 21 03 00 00       	call   801faf <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801c8e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801c95:	6a 07                	push   $0x7
+  801c97:	68 00 f0 bf ee       	push   $0xeebff000
+  801c9c:	56                   	push   %esi
+  801c9d:	53                   	push   %ebx
+  801c9e:	e8 8d 04 00 00       	call   802130 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801ca3:	83 c4 20             	add    $0x20,%esp
+  801ca6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cab:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801cb1:	89 fe                	mov    %edi,%esi
+  801cb3:	eb 22                	jmp    801cd7 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801cb5:	50                   	push   %eax
+  801cb6:	68 29 3c 80 00       	push   $0x803c29
+  801cbb:	68 a9 00 00 00       	push   $0xa9
+  801cc0:	68 05 3c 80 00       	push   $0x803c05
+  801cc5:	e8 6e e7 ff ff       	call   800438 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801cca:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801cd0:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801cd5:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801cd7:	89 f7                	mov    %esi,%edi
+  801cd9:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801cdf:	0f 87 e9 01 00 00    	ja     801ece <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801ce5:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801ceb:	85 f6                	test   %esi,%esi
+  801ced:	0f 49 d6             	cmovns %esi,%edx
+  801cf0:	c1 fa 0a             	sar    $0xa,%edx
+  801cf3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801cfa:	f6 c1 01             	test   $0x1,%cl
+  801cfd:	74 cb                	je     801cca <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801cff:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d06:	f6 c2 80             	test   $0x80,%dl
+  801d09:	75 17                	jne    801d22 <ufork+0xe2>
+			j = i + 1;
+  801d0b:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801d0e:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801d15:	f6 c2 01             	test   $0x1,%dl
+  801d18:	0f 85 f3 00 00 00    	jne    801e11 <ufork+0x1d1>
+			j = i + 1;
+  801d1e:	89 de                	mov    %ebx,%esi
+  801d20:	eb b5                	jmp    801cd7 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801d22:	89 fb                	mov    %edi,%ebx
+  801d24:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801d27:	89 d8                	mov    %ebx,%eax
+  801d29:	c1 e8 16             	shr    $0x16,%eax
+  801d2c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d33:	89 c2                	mov    %eax,%edx
+  801d35:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801d3b:	25 02 04 00 00       	and    $0x402,%eax
+  801d40:	83 f8 02             	cmp    $0x2,%eax
+  801d43:	74 31                	je     801d76 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801d45:	83 ec 04             	sub    $0x4,%esp
+  801d48:	6a 01                	push   $0x1
+  801d4a:	52                   	push   %edx
+  801d4b:	53                   	push   %ebx
+  801d4c:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801d52:	53                   	push   %ebx
+  801d53:	6a 00                	push   $0x0
+  801d55:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d5b:	50                   	push   %eax
+  801d5c:	e8 fa 03 00 00       	call   80215b <batch_map>
+		return;
+  801d61:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801d64:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801d6a:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801d6f:	89 c6                	mov    %eax,%esi
+				continue;
+  801d71:	e9 61 ff ff ff       	jmp    801cd7 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801d76:	83 ec 04             	sub    $0x4,%esp
+  801d79:	80 ca 80             	or     $0x80,%dl
+  801d7c:	52                   	push   %edx
+  801d7d:	53                   	push   %ebx
+  801d7e:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801d84:	e8 ca f2 ff ff       	call   801053 <sys_page_alloc>
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 5d                	js     801ded <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801d90:	83 ec 0c             	sub    $0xc,%esp
+  801d93:	6a 07                	push   $0x7
+  801d95:	68 00 00 40 00       	push   $0x400000
+  801d9a:	6a 00                	push   $0x0
+  801d9c:	53                   	push   %ebx
+  801d9d:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801da3:	e8 18 f3 ff ff       	call   8010c0 <sys_page_map>
+  801da8:	83 c4 20             	add    $0x20,%esp
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 50                	js     801dff <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801daf:	83 ec 04             	sub    $0x4,%esp
+  801db2:	68 00 00 40 00       	push   $0x400000
+  801db7:	53                   	push   %ebx
+  801db8:	68 00 00 40 00       	push   $0x400000
+  801dbd:	e8 1f ef ff ff       	call   800ce1 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801dc2:	83 c4 08             	add    $0x8,%esp
+  801dc5:	68 00 00 40 00       	push   $0x400000
+  801dca:	6a 00                	push   $0x0
+  801dcc:	e8 5d f3 ff ff       	call   80112e <sys_page_unmap>
+  801dd1:	83 c4 10             	add    $0x10,%esp
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	79 8c                	jns    801d64 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801dd8:	50                   	push   %eax
+  801dd9:	68 5d 3c 80 00       	push   $0x803c5d
+  801dde:	68 81 00 00 00       	push   $0x81
+  801de3:	68 05 3c 80 00       	push   $0x803c05
+  801de8:	e8 4b e6 ff ff       	call   800438 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801ded:	50                   	push   %eax
+  801dee:	68 39 3c 80 00       	push   $0x803c39
+  801df3:	6a 7c                	push   $0x7c
+  801df5:	68 05 3c 80 00       	push   $0x803c05
+  801dfa:	e8 39 e6 ff ff       	call   800438 <_panic>
+		panic("sys_page_map: %e", r);
+  801dff:	50                   	push   %eax
+  801e00:	68 4c 3c 80 00       	push   $0x803c4c
+  801e05:	6a 7e                	push   $0x7e
+  801e07:	68 05 3c 80 00       	push   $0x803c05
+  801e0c:	e8 27 e6 ff ff       	call   800438 <_panic>
+  801e11:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801e17:	eb 22                	jmp    801e3b <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801e19:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801e20:	a8 01                	test   $0x1,%al
+  801e22:	74 35                	je     801e59 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801e24:	89 d8                	mov    %ebx,%eax
+  801e26:	e8 9e fc ff ff       	call   801ac9 <dupperm>
+  801e2b:	89 c6                	mov    %eax,%esi
+  801e2d:	89 f8                	mov    %edi,%eax
+  801e2f:	e8 95 fc ff ff       	call   801ac9 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801e34:	39 c6                	cmp    %eax,%esi
+  801e36:	75 21                	jne    801e59 <ufork+0x219>
+				j++;
+  801e38:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801e3b:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801e41:	74 16                	je     801e59 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801e43:	89 d8                	mov    %ebx,%eax
+  801e45:	c1 e8 0a             	shr    $0xa,%eax
+  801e48:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e4f:	25 81 00 00 00       	and    $0x81,%eax
+  801e54:	83 f8 01             	cmp    $0x1,%eax
+  801e57:	74 c0                	je     801e19 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801e59:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801e5f:	89 d8                	mov    %ebx,%eax
+  801e61:	29 f0                	sub    %esi,%eax
+  801e63:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801e69:	89 fe                	mov    %edi,%esi
+  801e6b:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801e6e:	89 f8                	mov    %edi,%eax
+  801e70:	e8 54 fc ff ff       	call   801ac9 <dupperm>
+  801e75:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801e77:	83 ec 08             	sub    $0x8,%esp
+  801e7a:	6a 02                	push   $0x2
+  801e7c:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801e82:	51                   	push   %ecx
+  801e83:	e8 95 01 00 00       	call   80201d <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801e88:	83 c4 0c             	add    $0xc,%esp
+  801e8b:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801e91:	57                   	push   %edi
+  801e92:	56                   	push   %esi
+  801e93:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801e99:	56                   	push   %esi
+  801e9a:	6a 00                	push   $0x0
+  801e9c:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801ea2:	51                   	push   %ecx
+  801ea3:	e8 b3 02 00 00       	call   80215b <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801ea8:	83 c4 1c             	add    $0x1c,%esp
+  801eab:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801eb1:	57                   	push   %edi
+  801eb2:	56                   	push   %esi
+  801eb3:	6a 00                	push   $0x0
+  801eb5:	56                   	push   %esi
+  801eb6:	6a 00                	push   $0x0
+  801eb8:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801ebe:	50                   	push   %eax
+  801ebf:	e8 97 02 00 00       	call   80215b <batch_map>
+	return 0;
+  801ec4:	83 c4 20             	add    $0x20,%esp
+  801ec7:	89 de                	mov    %ebx,%esi
+  801ec9:	e9 09 fe ff ff       	jmp    801cd7 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801ece:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801ed4:	83 ec 04             	sub    $0x4,%esp
+  801ed7:	6a 02                	push   $0x2
+  801ed9:	56                   	push   %esi
+  801eda:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801ee0:	53                   	push   %ebx
+  801ee1:	e8 c9 02 00 00       	call   8021af <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801ee6:	89 1c 24             	mov    %ebx,(%esp)
+  801ee9:	e8 dd 00 00 00       	call   801fcb <batch_flush>
+  801eee:	83 c4 10             	add    $0x10,%esp
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 0e                	js     801f03 <ufork+0x2c3>
+}
+  801ef5:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801efe:	5b                   	pop    %ebx
+  801eff:	5e                   	pop    %esi
+  801f00:	5f                   	pop    %edi
+  801f01:	5d                   	pop    %ebp
+  801f02:	c3                   	ret
+			panic("fork: %e", r);
+  801f03:	50                   	push   %eax
+  801f04:	68 30 3c 80 00       	push   $0x803c30
+  801f09:	68 d7 00 00 00       	push   $0xd7
+  801f0e:	68 05 3c 80 00       	push   $0x803c05
+  801f13:	e8 20 e5 ff ff       	call   800438 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801f18:	e8 aa f0 ff ff       	call   800fc7 <sys_getenvid>
+  801f1d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f22:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f28:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801f2d:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801f32:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801f39:	00 00 00 
+  801f3c:	eb b7                	jmp    801ef5 <ufork+0x2b5>
+
+00801f3e <fork>:
+{
+  801f3e:	55                   	push   %ebp
+  801f3f:	89 e5                	mov    %esp,%ebp
+  801f41:	53                   	push   %ebx
+  801f42:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801f45:	68 62 1b 80 00       	push   $0x801b62
+  801f4a:	e8 cd 14 00 00       	call   80341c <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801f4f:	e8 7a f6 ff ff       	call   8015ce <sys_fork>
+  801f54:	89 c3                	mov    %eax,%ebx
+  801f56:	83 c4 10             	add    $0x10,%esp
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	78 09                	js     801f66 <fork+0x28>
+	if (pid == 0)
+  801f5d:	74 1c                	je     801f7b <fork+0x3d>
+}
+  801f5f:	89 d8                	mov    %ebx,%eax
+  801f61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f64:	c9                   	leave
+  801f65:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801f66:	50                   	push   %eax
+  801f67:	68 29 3c 80 00       	push   $0x803c29
+  801f6c:	68 ed 00 00 00       	push   $0xed
+  801f71:	68 05 3c 80 00       	push   $0x803c05
+  801f76:	e8 bd e4 ff ff       	call   800438 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801f7b:	e8 47 f0 ff ff       	call   800fc7 <sys_getenvid>
+  801f80:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801f85:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f8b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801f90:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801f95:	eb c8                	jmp    801f5f <fork+0x21>
+
+00801f97 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801f97:	55                   	push   %ebp
+  801f98:	89 e5                	mov    %esp,%ebp
+  801f9a:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801f9d:	ff 75 0c             	push   0xc(%ebp)
+  801fa0:	ff 75 08             	push   0x8(%ebp)
+  801fa3:	68 23 1c 80 00       	push   $0x801c23
+  801fa8:	e8 67 f6 ff ff       	call   801614 <sys_thread_create>
+}
+  801fad:	c9                   	leave
+  801fae:	c3                   	ret
+
+00801faf <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801faf:	55                   	push   %ebp
+  801fb0:	89 e5                	mov    %esp,%ebp
+  801fb2:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801fb5:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801fbc:	00 00 00 
+	b->b_error = 0;
+  801fbf:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801fc6:	00 00 00 
+}
+  801fc9:	5d                   	pop    %ebp
+  801fca:	c3                   	ret
+
+00801fcb <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801fcb:	55                   	push   %ebp
+  801fcc:	89 e5                	mov    %esp,%ebp
+  801fce:	53                   	push   %ebx
+  801fcf:	83 ec 04             	sub    $0x4,%esp
+  801fd2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801fd5:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	7e 09                	jle    801fe8 <batch_flush+0x1d>
+  801fdf:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801fe6:	74 15                	je     801ffd <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801fe8:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801fef:	00 00 00 
+	return b->b_error;
+  801ff2:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801ff8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ffb:	c9                   	leave
+  801ffc:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801ffd:	83 ec 08             	sub    $0x8,%esp
+  802000:	50                   	push   %eax
+  802001:	53                   	push   %ebx
+  802002:	e8 32 f7 ff ff       	call   801739 <sys_batch>
+  802007:	83 c4 10             	add    $0x10,%esp
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	79 da                	jns    801fe8 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  80200e:	f7 d8                	neg    %eax
+  802010:	0f b6 c0             	movzbl %al,%eax
+  802013:	f7 d8                	neg    %eax
+  802015:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  80201b:	eb cb                	jmp    801fe8 <batch_flush+0x1d>
+
+0080201d <batch_reserve>:
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	83 ec 08             	sub    $0x8,%esp
+  802023:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  802026:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  80202c:	03 45 0c             	add    0xc(%ebp),%eax
+  80202f:	83 f8 10             	cmp    $0x10,%eax
+  802032:	7f 02                	jg     802036 <batch_reserve+0x19>
+}
+  802034:	c9                   	leave
+  802035:	c3                   	ret
+		batch_flush(b);
+  802036:	83 ec 0c             	sub    $0xc,%esp
+  802039:	52                   	push   %edx
+  80203a:	e8 8c ff ff ff       	call   801fcb <batch_flush>
+  80203f:	83 c4 10             	add    $0x10,%esp
+}
+  802042:	eb f0                	jmp    802034 <batch_reserve+0x17>
+
+00802044 <batch_next>:
+{
+  802044:	55                   	push   %ebp
+  802045:	89 e5                	mov    %esp,%ebp
+  802047:	53                   	push   %ebx
+  802048:	83 ec 04             	sub    $0x4,%esp
+  80204b:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  80204d:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  802054:	74 28                	je     80207e <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  802056:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  80205c:	8d 50 01             	lea    0x1(%eax),%edx
+  80205f:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  802065:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802068:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  80206a:	83 ec 04             	sub    $0x4,%esp
+  80206d:	6a 1c                	push   $0x1c
+  80206f:	6a 00                	push   $0x0
+  802071:	53                   	push   %ebx
+  802072:	e8 35 ec ff ff       	call   800cac <memset>
+}
+  802077:	89 d8                	mov    %ebx,%eax
+  802079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80207c:	c9                   	leave
+  80207d:	c3                   	ret
+		batch_flush(b);
+  80207e:	83 ec 0c             	sub    $0xc,%esp
+  802081:	50                   	push   %eax
+  802082:	e8 44 ff ff ff       	call   801fcb <batch_flush>
+  802087:	83 c4 10             	add    $0x10,%esp
+  80208a:	eb ca                	jmp    802056 <batch_next+0x12>
+
+0080208c <batch_page>:
+{
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	57                   	push   %edi
+  802090:	56                   	push   %esi
+  802091:	53                   	push   %ebx
+  802092:	83 ec 1c             	sub    $0x1c,%esp
+  802095:	89 d3                	mov    %edx,%ebx
+  802097:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  802099:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  80209f:	85 d2                	test   %edx,%edx
+  8020a1:	74 50                	je     8020f3 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  8020a3:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  8020a6:	01 c1                	add    %eax,%ecx
+  8020a8:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  8020ab:	75 46                	jne    8020f3 <batch_page+0x67>
+  8020ad:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  8020b0:	75 41                	jne    8020f3 <batch_page+0x67>
+  8020b2:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  8020b5:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  8020b8:	75 39                	jne    8020f3 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  8020ba:	83 ea 01             	sub    $0x1,%edx
+  8020bd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020c0:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020c3:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  8020c7:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8020ca:	75 27                	jne    8020f3 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8020cc:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020cf:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8020d3:	89 fa                	mov    %edi,%edx
+  8020d5:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020d8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8020db:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020de:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8020e1:	75 10                	jne    8020f3 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020e3:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8020e7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8020ea:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8020ee:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8020f1:	74 2a                	je     80211d <batch_page+0x91>
+	op = batch_next(b);
+  8020f3:	e8 4c ff ff ff       	call   802044 <batch_next>
+	op->bo_op = opcode;
+  8020f8:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  8020fa:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  8020fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  802100:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802103:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802106:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  802109:	8b 75 10             	mov    0x10(%ebp),%esi
+  80210c:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  80210f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802112:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802115:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802118:	89 78 14             	mov    %edi,0x14(%eax)
+  80211b:	eb 0b                	jmp    802128 <batch_page+0x9c>
+		op->bo_npages += npages;
+  80211d:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  802121:	03 7d 18             	add    0x18(%ebp),%edi
+  802124:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802128:	83 c4 1c             	add    $0x1c,%esp
+  80212b:	5b                   	pop    %ebx
+  80212c:	5e                   	pop    %esi
+  80212d:	5f                   	pop    %edi
+  80212e:	5d                   	pop    %ebp
+  80212f:	c3                   	ret
+
+00802130 <batch_alloc>:
+{
+  802130:	55                   	push   %ebp
+  802131:	89 e5                	mov    %esp,%ebp
+  802133:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802136:	ff 75 18             	push   0x18(%ebp)
+  802139:	ff 75 14             	push   0x14(%ebp)
+  80213c:	ff 75 10             	push   0x10(%ebp)
+  80213f:	ff 75 0c             	push   0xc(%ebp)
+  802142:	6a 00                	push   $0x0
+  802144:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802151:	e8 36 ff ff ff       	call   80208c <batch_page>
+}
+  802156:	83 c4 20             	add    $0x20,%esp
+  802159:	c9                   	leave
+  80215a:	c3                   	ret
+
+0080215b <batch_map>:
+{
+  80215b:	55                   	push   %ebp
+  80215c:	89 e5                	mov    %esp,%ebp
+  80215e:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802161:	ff 75 20             	push   0x20(%ebp)
+  802164:	ff 75 1c             	push   0x1c(%ebp)
+  802167:	ff 75 18             	push   0x18(%ebp)
+  80216a:	ff 75 14             	push   0x14(%ebp)
+  80216d:	ff 75 10             	push   0x10(%ebp)
+  802170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802173:	ba 01 00 00 00       	mov    $0x1,%edx
+  802178:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217b:	e8 0c ff ff ff       	call   80208c <batch_page>
+}
+  802180:	83 c4 20             	add    $0x20,%esp
+  802183:	c9                   	leave
+  802184:	c3                   	ret
+
+00802185 <batch_unmap>:
+{
+  802185:	55                   	push   %ebp
+  802186:	89 e5                	mov    %esp,%ebp
+  802188:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  80218b:	ff 75 14             	push   0x14(%ebp)
+  80218e:	6a 00                	push   $0x0
+  802190:	ff 75 10             	push   0x10(%ebp)
+  802193:	ff 75 0c             	push   0xc(%ebp)
+  802196:	6a 00                	push   $0x0
+  802198:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80219d:	ba 02 00 00 00       	mov    $0x2,%edx
+  8021a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a5:	e8 e2 fe ff ff       	call   80208c <batch_page>
+}
+  8021aa:	83 c4 20             	add    $0x20,%esp
+  8021ad:	c9                   	leave
+  8021ae:	c3                   	ret
+
+008021af <batch_set_status>:
+{
+  8021af:	55                   	push   %ebp
+  8021b0:	89 e5                	mov    %esp,%ebp
+  8021b2:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8021b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b8:	e8 87 fe ff ff       	call   802044 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8021bd:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8021c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c6:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8021c9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021cc:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8021cf:	c9                   	leave
+  8021d0:	c3                   	ret
+
+008021d1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8021d1:	55                   	push   %ebp
+  8021d2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8021dc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8021df:	5d                   	pop    %ebp
+  8021e0:	c3                   	ret
+
+008021e1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8021ec:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021f1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8021f6:	5d                   	pop    %ebp
+  8021f7:	c3                   	ret
+
+008021f8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8021f8:	55                   	push   %ebp
+  8021f9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8021fb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802200:	eb 02                	jmp    802204 <fd_alloc+0xc>
+  802202:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802204:	89 c2                	mov    %eax,%edx
+  802206:	c1 ea 16             	shr    $0x16,%edx
+  802209:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802210:	f6 c2 01             	test   $0x1,%dl
+  802213:	74 2b                	je     802240 <fd_alloc+0x48>
+  802215:	89 c2                	mov    %eax,%edx
+  802217:	c1 ea 0c             	shr    $0xc,%edx
+  80221a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802221:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802227:	f6 c1 01             	test   $0x1,%cl
+  80222a:	74 14                	je     802240 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80222c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802232:	75 ce                	jne    802202 <fd_alloc+0xa>
+  802234:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802239:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80223e:	eb 05                	jmp    802245 <fd_alloc+0x4d>
+			return 0;
+  802240:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802245:	8b 55 08             	mov    0x8(%ebp),%edx
+  802248:	89 02                	mov    %eax,(%edx)
+}
+  80224a:	89 c8                	mov    %ecx,%eax
+  80224c:	5d                   	pop    %ebp
+  80224d:	c3                   	ret
+
+0080224e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802254:	83 f8 1f             	cmp    $0x1f,%eax
+  802257:	77 30                	ja     802289 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802259:	c1 e0 0c             	shl    $0xc,%eax
+  80225c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802261:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802267:	f6 c2 01             	test   $0x1,%dl
+  80226a:	74 24                	je     802290 <fd_lookup+0x42>
+  80226c:	89 c2                	mov    %eax,%edx
+  80226e:	c1 ea 0c             	shr    $0xc,%edx
+  802271:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802278:	f6 c2 01             	test   $0x1,%dl
+  80227b:	74 1a                	je     802297 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80227d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802280:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802282:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802287:	5d                   	pop    %ebp
+  802288:	c3                   	ret
+		return -E_INVAL;
+  802289:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80228e:	eb f7                	jmp    802287 <fd_lookup+0x39>
+		return -E_INVAL;
+  802290:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802295:	eb f0                	jmp    802287 <fd_lookup+0x39>
+  802297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80229c:	eb e9                	jmp    802287 <fd_lookup+0x39>
+
+0080229e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	53                   	push   %ebx
+  8022a2:	83 ec 04             	sub    $0x4,%esp
+  8022a5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8022a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ad:	eb 03                	jmp    8022b2 <dev_lookup+0x14>
+  8022af:	83 c0 01             	add    $0x1,%eax
+  8022b2:	8b 1c 85 ec 3c 80 00 	mov    0x803cec(,%eax,4),%ebx
+  8022b9:	85 db                	test   %ebx,%ebx
+  8022bb:	74 0b                	je     8022c8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8022bd:	39 13                	cmp    %edx,(%ebx)
+  8022bf:	75 ee                	jne    8022af <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8022c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c6:	eb 2e                	jmp    8022f6 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8022c8:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022ca:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022cf:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022d5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8022da:	76 24                	jbe    802300 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022dc:	8b 41 48             	mov    0x48(%ecx),%eax
+  8022df:	83 ec 04             	sub    $0x4,%esp
+  8022e2:	52                   	push   %edx
+  8022e3:	50                   	push   %eax
+  8022e4:	68 70 3c 80 00       	push   $0x803c70
+  8022e9:	e8 25 e2 ff ff       	call   800513 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8022ee:	83 c4 10             	add    $0x10,%esp
+  8022f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8022f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022f9:	89 1a                	mov    %ebx,(%edx)
+}
+  8022fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fe:	c9                   	leave
+  8022ff:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802300:	c1 e8 10             	shr    $0x10,%eax
+  802303:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802309:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80230f:	eb cb                	jmp    8022dc <dev_lookup+0x3e>
+
+00802311 <fd_close>:
+{
+  802311:	55                   	push   %ebp
+  802312:	89 e5                	mov    %esp,%ebp
+  802314:	57                   	push   %edi
+  802315:	56                   	push   %esi
+  802316:	53                   	push   %ebx
+  802317:	83 ec 24             	sub    $0x24,%esp
+  80231a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80231d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802320:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802323:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802324:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80232a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80232d:	50                   	push   %eax
+  80232e:	e8 1b ff ff ff       	call   80224e <fd_lookup>
+  802333:	89 c3                	mov    %eax,%ebx
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	78 05                	js     802341 <fd_close+0x30>
+	    || fd != fd2)
+  80233c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80233f:	74 16                	je     802357 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802341:	89 f8                	mov    %edi,%eax
+  802343:	84 c0                	test   %al,%al
+  802345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80234a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80234d:	89 d8                	mov    %ebx,%eax
+  80234f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802352:	5b                   	pop    %ebx
+  802353:	5e                   	pop    %esi
+  802354:	5f                   	pop    %edi
+  802355:	5d                   	pop    %ebp
+  802356:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802357:	83 ec 08             	sub    $0x8,%esp
+  80235a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80235d:	50                   	push   %eax
+  80235e:	ff 36                	push   (%esi)
+  802360:	e8 39 ff ff ff       	call   80229e <dev_lookup>
+  802365:	89 c3                	mov    %eax,%ebx
+  802367:	83 c4 10             	add    $0x10,%esp
+  80236a:	85 c0                	test   %eax,%eax
+  80236c:	78 1a                	js     802388 <fd_close+0x77>
+		if (dev->dev_close)
+  80236e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802371:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802374:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802379:	85 c0                	test   %eax,%eax
+  80237b:	74 0b                	je     802388 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80237d:	83 ec 0c             	sub    $0xc,%esp
+  802380:	56                   	push   %esi
+  802381:	ff d0                	call   *%eax
+  802383:	89 c3                	mov    %eax,%ebx
+  802385:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802388:	83 ec 08             	sub    $0x8,%esp
+  80238b:	56                   	push   %esi
+  80238c:	6a 00                	push   $0x0
+  80238e:	e8 9b ed ff ff       	call   80112e <sys_page_unmap>
+	return r;
+  802393:	83 c4 10             	add    $0x10,%esp
+  802396:	eb b5                	jmp    80234d <fd_close+0x3c>
+
+00802398 <close>:
+
+int
+close(int fdnum)
+{
+  802398:	55                   	push   %ebp
+  802399:	89 e5                	mov    %esp,%ebp
+  80239b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80239e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a1:	50                   	push   %eax
+  8023a2:	ff 75 08             	push   0x8(%ebp)
+  8023a5:	e8 a4 fe ff ff       	call   80224e <fd_lookup>
+  8023aa:	83 c4 10             	add    $0x10,%esp
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	79 02                	jns    8023b3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8023b1:	c9                   	leave
+  8023b2:	c3                   	ret
+		return fd_close(fd, 1);
+  8023b3:	83 ec 08             	sub    $0x8,%esp
+  8023b6:	6a 01                	push   $0x1
+  8023b8:	ff 75 f4             	push   -0xc(%ebp)
+  8023bb:	e8 51 ff ff ff       	call   802311 <fd_close>
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	eb ec                	jmp    8023b1 <close+0x19>
+
+008023c5 <close_all>:
+
+void
+close_all(void)
+{
+  8023c5:	55                   	push   %ebp
+  8023c6:	89 e5                	mov    %esp,%ebp
+  8023c8:	53                   	push   %ebx
+  8023c9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8023cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8023d1:	83 ec 0c             	sub    $0xc,%esp
+  8023d4:	53                   	push   %ebx
+  8023d5:	e8 be ff ff ff       	call   802398 <close>
+	for (i = 0; i < MAXFD; i++)
+  8023da:	83 c3 01             	add    $0x1,%ebx
+  8023dd:	83 c4 10             	add    $0x10,%esp
+  8023e0:	83 fb 20             	cmp    $0x20,%ebx
+  8023e3:	75 ec                	jne    8023d1 <close_all+0xc>
+}
+  8023e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e8:	c9                   	leave
+  8023e9:	c3                   	ret
+
+008023ea <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	57                   	push   %edi
+  8023ee:	56                   	push   %esi
+  8023ef:	53                   	push   %ebx
+  8023f0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8023f3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023f6:	50                   	push   %eax
+  8023f7:	ff 75 08             	push   0x8(%ebp)
+  8023fa:	e8 4f fe ff ff       	call   80224e <fd_lookup>
+  8023ff:	89 c3                	mov    %eax,%ebx
+  802401:	83 c4 10             	add    $0x10,%esp
+  802404:	85 c0                	test   %eax,%eax
+  802406:	78 7f                	js     802487 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802408:	83 ec 0c             	sub    $0xc,%esp
+  80240b:	ff 75 0c             	push   0xc(%ebp)
+  80240e:	e8 85 ff ff ff       	call   802398 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802413:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802416:	c1 e6 0c             	shl    $0xc,%esi
+  802419:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80241f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802422:	89 3c 24             	mov    %edi,(%esp)
+  802425:	e8 b7 fd ff ff       	call   8021e1 <fd2data>
+  80242a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80242c:	89 34 24             	mov    %esi,(%esp)
+  80242f:	e8 ad fd ff ff       	call   8021e1 <fd2data>
+  802434:	83 c4 10             	add    $0x10,%esp
+  802437:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80243a:	89 d8                	mov    %ebx,%eax
+  80243c:	c1 e8 16             	shr    $0x16,%eax
+  80243f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802446:	a8 01                	test   $0x1,%al
+  802448:	74 11                	je     80245b <dup+0x71>
+  80244a:	89 d8                	mov    %ebx,%eax
+  80244c:	c1 e8 0c             	shr    $0xc,%eax
+  80244f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802456:	f6 c2 01             	test   $0x1,%dl
+  802459:	75 36                	jne    802491 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80245b:	89 f8                	mov    %edi,%eax
+  80245d:	c1 e8 0c             	shr    $0xc,%eax
+  802460:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802467:	83 ec 0c             	sub    $0xc,%esp
+  80246a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80246f:	50                   	push   %eax
+  802470:	56                   	push   %esi
+  802471:	6a 00                	push   $0x0
+  802473:	57                   	push   %edi
+  802474:	6a 00                	push   $0x0
+  802476:	e8 45 ec ff ff       	call   8010c0 <sys_page_map>
+  80247b:	89 c3                	mov    %eax,%ebx
+  80247d:	83 c4 20             	add    $0x20,%esp
+  802480:	85 c0                	test   %eax,%eax
+  802482:	78 33                	js     8024b7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802484:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802487:	89 d8                	mov    %ebx,%eax
+  802489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80248c:	5b                   	pop    %ebx
+  80248d:	5e                   	pop    %esi
+  80248e:	5f                   	pop    %edi
+  80248f:	5d                   	pop    %ebp
+  802490:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802491:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802498:	83 ec 0c             	sub    $0xc,%esp
+  80249b:	25 07 0e 00 00       	and    $0xe07,%eax
+  8024a0:	50                   	push   %eax
+  8024a1:	ff 75 d4             	push   -0x2c(%ebp)
+  8024a4:	6a 00                	push   $0x0
+  8024a6:	53                   	push   %ebx
+  8024a7:	6a 00                	push   $0x0
+  8024a9:	e8 12 ec ff ff       	call   8010c0 <sys_page_map>
+  8024ae:	89 c3                	mov    %eax,%ebx
+  8024b0:	83 c4 20             	add    $0x20,%esp
+  8024b3:	85 c0                	test   %eax,%eax
+  8024b5:	79 a4                	jns    80245b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8024b7:	83 ec 08             	sub    $0x8,%esp
+  8024ba:	56                   	push   %esi
+  8024bb:	6a 00                	push   $0x0
+  8024bd:	e8 6c ec ff ff       	call   80112e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8024c2:	83 c4 08             	add    $0x8,%esp
+  8024c5:	ff 75 d4             	push   -0x2c(%ebp)
+  8024c8:	6a 00                	push   $0x0
+  8024ca:	e8 5f ec ff ff       	call   80112e <sys_page_unmap>
+	return r;
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	eb b3                	jmp    802487 <dup+0x9d>
+
+008024d4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8024d4:	55                   	push   %ebp
+  8024d5:	89 e5                	mov    %esp,%ebp
+  8024d7:	56                   	push   %esi
+  8024d8:	53                   	push   %ebx
+  8024d9:	83 ec 18             	sub    $0x18,%esp
+  8024dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024e2:	50                   	push   %eax
+  8024e3:	53                   	push   %ebx
+  8024e4:	e8 65 fd ff ff       	call   80224e <fd_lookup>
+  8024e9:	83 c4 10             	add    $0x10,%esp
+  8024ec:	85 c0                	test   %eax,%eax
+  8024ee:	78 3c                	js     80252c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024f0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024f3:	83 ec 08             	sub    $0x8,%esp
+  8024f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024f9:	50                   	push   %eax
+  8024fa:	ff 36                	push   (%esi)
+  8024fc:	e8 9d fd ff ff       	call   80229e <dev_lookup>
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	85 c0                	test   %eax,%eax
+  802506:	78 24                	js     80252c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802508:	8b 46 08             	mov    0x8(%esi),%eax
+  80250b:	83 e0 03             	and    $0x3,%eax
+  80250e:	83 f8 01             	cmp    $0x1,%eax
+  802511:	74 20                	je     802533 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802513:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802516:	8b 40 08             	mov    0x8(%eax),%eax
+  802519:	85 c0                	test   %eax,%eax
+  80251b:	74 57                	je     802574 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80251d:	83 ec 04             	sub    $0x4,%esp
+  802520:	ff 75 10             	push   0x10(%ebp)
+  802523:	ff 75 0c             	push   0xc(%ebp)
+  802526:	56                   	push   %esi
+  802527:	ff d0                	call   *%eax
+  802529:	83 c4 10             	add    $0x10,%esp
+}
+  80252c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80252f:	5b                   	pop    %ebx
+  802530:	5e                   	pop    %esi
+  802531:	5d                   	pop    %ebp
+  802532:	c3                   	ret
+  802533:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802535:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80253a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802540:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802545:	76 1c                	jbe    802563 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802547:	8b 42 48             	mov    0x48(%edx),%eax
+  80254a:	83 ec 04             	sub    $0x4,%esp
+  80254d:	53                   	push   %ebx
+  80254e:	50                   	push   %eax
+  80254f:	68 b1 3c 80 00       	push   $0x803cb1
+  802554:	e8 ba df ff ff       	call   800513 <cprintf>
+		return -E_INVAL;
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802561:	eb c9                	jmp    80252c <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802563:	c1 e8 10             	shr    $0x10,%eax
+  802566:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80256c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802572:	eb d3                	jmp    802547 <read+0x73>
+		return -E_NOT_SUPP;
+  802574:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802579:	eb b1                	jmp    80252c <read+0x58>
+
+0080257b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80257b:	55                   	push   %ebp
+  80257c:	89 e5                	mov    %esp,%ebp
+  80257e:	57                   	push   %edi
+  80257f:	56                   	push   %esi
+  802580:	53                   	push   %ebx
+  802581:	83 ec 0c             	sub    $0xc,%esp
+  802584:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802587:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80258a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80258f:	eb 02                	jmp    802593 <readn+0x18>
+  802591:	01 c3                	add    %eax,%ebx
+  802593:	39 f3                	cmp    %esi,%ebx
+  802595:	73 21                	jae    8025b8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802597:	83 ec 04             	sub    $0x4,%esp
+  80259a:	89 f0                	mov    %esi,%eax
+  80259c:	29 d8                	sub    %ebx,%eax
+  80259e:	50                   	push   %eax
+  80259f:	89 d8                	mov    %ebx,%eax
+  8025a1:	03 45 0c             	add    0xc(%ebp),%eax
+  8025a4:	50                   	push   %eax
+  8025a5:	57                   	push   %edi
+  8025a6:	e8 29 ff ff ff       	call   8024d4 <read>
+		if (m < 0)
+  8025ab:	83 c4 10             	add    $0x10,%esp
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	78 04                	js     8025b6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8025b2:	75 dd                	jne    802591 <readn+0x16>
+  8025b4:	eb 02                	jmp    8025b8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8025b6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8025b8:	89 d8                	mov    %ebx,%eax
+  8025ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025bd:	5b                   	pop    %ebx
+  8025be:	5e                   	pop    %esi
+  8025bf:	5f                   	pop    %edi
+  8025c0:	5d                   	pop    %ebp
+  8025c1:	c3                   	ret
+
+008025c2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8025c2:	55                   	push   %ebp
+  8025c3:	89 e5                	mov    %esp,%ebp
+  8025c5:	56                   	push   %esi
+  8025c6:	53                   	push   %ebx
+  8025c7:	83 ec 18             	sub    $0x18,%esp
+  8025ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025d0:	50                   	push   %eax
+  8025d1:	53                   	push   %ebx
+  8025d2:	e8 77 fc ff ff       	call   80224e <fd_lookup>
+  8025d7:	83 c4 10             	add    $0x10,%esp
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	78 37                	js     802615 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025de:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025e1:	83 ec 08             	sub    $0x8,%esp
+  8025e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025e7:	50                   	push   %eax
+  8025e8:	ff 36                	push   (%esi)
+  8025ea:	e8 af fc ff ff       	call   80229e <dev_lookup>
+  8025ef:	83 c4 10             	add    $0x10,%esp
+  8025f2:	85 c0                	test   %eax,%eax
+  8025f4:	78 1f                	js     802615 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025f6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8025fa:	74 20                	je     80261c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8025fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  802602:	85 c0                	test   %eax,%eax
+  802604:	74 57                	je     80265d <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802606:	83 ec 04             	sub    $0x4,%esp
+  802609:	ff 75 10             	push   0x10(%ebp)
+  80260c:	ff 75 0c             	push   0xc(%ebp)
+  80260f:	56                   	push   %esi
+  802610:	ff d0                	call   *%eax
+  802612:	83 c4 10             	add    $0x10,%esp
+}
+  802615:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802618:	5b                   	pop    %ebx
+  802619:	5e                   	pop    %esi
+  80261a:	5d                   	pop    %ebp
+  80261b:	c3                   	ret
+  80261c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80261e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802623:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802629:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80262e:	76 1c                	jbe    80264c <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802630:	8b 42 48             	mov    0x48(%edx),%eax
+  802633:	83 ec 04             	sub    $0x4,%esp
+  802636:	53                   	push   %ebx
+  802637:	50                   	push   %eax
+  802638:	68 cd 3c 80 00       	push   $0x803ccd
+  80263d:	e8 d1 de ff ff       	call   800513 <cprintf>
+		return -E_INVAL;
+  802642:	83 c4 10             	add    $0x10,%esp
+  802645:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80264a:	eb c9                	jmp    802615 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80264c:	c1 e8 10             	shr    $0x10,%eax
+  80264f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802655:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80265b:	eb d3                	jmp    802630 <write+0x6e>
+		return -E_NOT_SUPP;
+  80265d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802662:	eb b1                	jmp    802615 <write+0x53>
+
+00802664 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802664:	55                   	push   %ebp
+  802665:	89 e5                	mov    %esp,%ebp
+  802667:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80266a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80266d:	50                   	push   %eax
+  80266e:	ff 75 08             	push   0x8(%ebp)
+  802671:	e8 d8 fb ff ff       	call   80224e <fd_lookup>
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	78 0e                	js     80268b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80267d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802680:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802683:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802686:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268b:	c9                   	leave
+  80268c:	c3                   	ret
+
+0080268d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	56                   	push   %esi
+  802691:	53                   	push   %ebx
+  802692:	83 ec 18             	sub    $0x18,%esp
+  802695:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802698:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80269b:	50                   	push   %eax
+  80269c:	53                   	push   %ebx
+  80269d:	e8 ac fb ff ff       	call   80224e <fd_lookup>
+  8026a2:	83 c4 10             	add    $0x10,%esp
+  8026a5:	85 c0                	test   %eax,%eax
+  8026a7:	78 34                	js     8026dd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026ac:	83 ec 08             	sub    $0x8,%esp
+  8026af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b2:	50                   	push   %eax
+  8026b3:	ff 36                	push   (%esi)
+  8026b5:	e8 e4 fb ff ff       	call   80229e <dev_lookup>
+  8026ba:	83 c4 10             	add    $0x10,%esp
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	78 1c                	js     8026dd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026c1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8026c5:	74 1d                	je     8026e4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8026c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ca:	8b 40 18             	mov    0x18(%eax),%eax
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	74 54                	je     802725 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8026d1:	83 ec 08             	sub    $0x8,%esp
+  8026d4:	ff 75 0c             	push   0xc(%ebp)
+  8026d7:	56                   	push   %esi
+  8026d8:	ff d0                	call   *%eax
+  8026da:	83 c4 10             	add    $0x10,%esp
+}
+  8026dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e0:	5b                   	pop    %ebx
+  8026e1:	5e                   	pop    %esi
+  8026e2:	5d                   	pop    %ebp
+  8026e3:	c3                   	ret
+  8026e4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026e6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026eb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026f1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026f6:	76 1c                	jbe    802714 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8026f8:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8026fb:	83 ec 04             	sub    $0x4,%esp
+  8026fe:	53                   	push   %ebx
+  8026ff:	50                   	push   %eax
+  802700:	68 90 3c 80 00       	push   $0x803c90
+  802705:	e8 09 de ff ff       	call   800513 <cprintf>
+		return -E_INVAL;
+  80270a:	83 c4 10             	add    $0x10,%esp
+  80270d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802712:	eb c9                	jmp    8026dd <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802714:	c1 e8 10             	shr    $0x10,%eax
+  802717:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80271d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802723:	eb d3                	jmp    8026f8 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802725:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80272a:	eb b1                	jmp    8026dd <ftruncate+0x50>
+
+0080272c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80272c:	55                   	push   %ebp
+  80272d:	89 e5                	mov    %esp,%ebp
+  80272f:	56                   	push   %esi
+  802730:	53                   	push   %ebx
+  802731:	83 ec 18             	sub    $0x18,%esp
+  802734:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802737:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80273a:	50                   	push   %eax
+  80273b:	ff 75 08             	push   0x8(%ebp)
+  80273e:	e8 0b fb ff ff       	call   80224e <fd_lookup>
+  802743:	83 c4 10             	add    $0x10,%esp
+  802746:	85 c0                	test   %eax,%eax
+  802748:	78 49                	js     802793 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80274a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80274d:	83 ec 08             	sub    $0x8,%esp
+  802750:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802753:	50                   	push   %eax
+  802754:	ff 36                	push   (%esi)
+  802756:	e8 43 fb ff ff       	call   80229e <dev_lookup>
+  80275b:	83 c4 10             	add    $0x10,%esp
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	78 31                	js     802793 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802762:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802765:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802769:	74 2f                	je     80279a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80276b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80276e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802775:	00 00 00 
+	stat->st_isdir = 0;
+  802778:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80277f:	00 00 00 
+	stat->st_dev = dev;
+  802782:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802788:	83 ec 08             	sub    $0x8,%esp
+  80278b:	53                   	push   %ebx
+  80278c:	56                   	push   %esi
+  80278d:	ff 50 14             	call   *0x14(%eax)
+  802790:	83 c4 10             	add    $0x10,%esp
+}
+  802793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802796:	5b                   	pop    %ebx
+  802797:	5e                   	pop    %esi
+  802798:	5d                   	pop    %ebp
+  802799:	c3                   	ret
+		return -E_NOT_SUPP;
+  80279a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80279f:	eb f2                	jmp    802793 <fstat+0x67>
+
+008027a1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8027a1:	55                   	push   %ebp
+  8027a2:	89 e5                	mov    %esp,%ebp
+  8027a4:	56                   	push   %esi
+  8027a5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8027a6:	83 ec 08             	sub    $0x8,%esp
+  8027a9:	6a 00                	push   $0x0
+  8027ab:	ff 75 08             	push   0x8(%ebp)
+  8027ae:	e8 e4 01 00 00       	call   802997 <open>
+  8027b3:	89 c3                	mov    %eax,%ebx
+  8027b5:	83 c4 10             	add    $0x10,%esp
+  8027b8:	85 c0                	test   %eax,%eax
+  8027ba:	78 1b                	js     8027d7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8027bc:	83 ec 08             	sub    $0x8,%esp
+  8027bf:	ff 75 0c             	push   0xc(%ebp)
+  8027c2:	50                   	push   %eax
+  8027c3:	e8 64 ff ff ff       	call   80272c <fstat>
+  8027c8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8027ca:	89 1c 24             	mov    %ebx,(%esp)
+  8027cd:	e8 c6 fb ff ff       	call   802398 <close>
+	return r;
+  8027d2:	83 c4 10             	add    $0x10,%esp
+  8027d5:	89 f3                	mov    %esi,%ebx
+}
+  8027d7:	89 d8                	mov    %ebx,%eax
+  8027d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027dc:	5b                   	pop    %ebx
+  8027dd:	5e                   	pop    %esi
+  8027de:	5d                   	pop    %ebp
+  8027df:	c3                   	ret
+
+008027e0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8027e0:	55                   	push   %ebp
+  8027e1:	89 e5                	mov    %esp,%ebp
+  8027e3:	56                   	push   %esi
+  8027e4:	53                   	push   %ebx
+  8027e5:	89 c6                	mov    %eax,%esi
+  8027e7:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8027e9:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8027f0:	74 27                	je     802819 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8027f2:	6a 07                	push   $0x7
+  8027f4:	68 00 60 80 00       	push   $0x806000
+  8027f9:	56                   	push   %esi
+  8027fa:	ff 35 00 50 80 00    	push   0x805000
+  802800:	e8 93 0d 00 00       	call   803598 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802805:	83 c4 0c             	add    $0xc,%esp
+  802808:	6a 00                	push   $0x0
+  80280a:	53                   	push   %ebx
+  80280b:	6a 00                	push   $0x0
+  80280d:	e8 6e 0d 00 00       	call   803580 <ipc_recv>
+}
+  802812:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802815:	5b                   	pop    %ebx
+  802816:	5e                   	pop    %esi
+  802817:	5d                   	pop    %ebp
+  802818:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802819:	83 ec 0c             	sub    $0xc,%esp
+  80281c:	6a 01                	push   $0x1
+  80281e:	e8 c9 0d 00 00       	call   8035ec <ipc_find_env>
+  802823:	a3 00 50 80 00       	mov    %eax,0x805000
+  802828:	83 c4 10             	add    $0x10,%esp
+  80282b:	eb c5                	jmp    8027f2 <fsipc+0x12>
+
+0080282d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80282d:	55                   	push   %ebp
+  80282e:	89 e5                	mov    %esp,%ebp
+  802830:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802833:	8b 45 08             	mov    0x8(%ebp),%eax
+  802836:	8b 40 0c             	mov    0xc(%eax),%eax
+  802839:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80283e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802841:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802846:	ba 00 00 00 00       	mov    $0x0,%edx
+  80284b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802850:	e8 8b ff ff ff       	call   8027e0 <fsipc>
+}
+  802855:	c9                   	leave
+  802856:	c3                   	ret
+
+00802857 <devfile_flush>:
+{
+  802857:	55                   	push   %ebp
+  802858:	89 e5                	mov    %esp,%ebp
+  80285a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80285d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802860:	8b 40 0c             	mov    0xc(%eax),%eax
+  802863:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802868:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802872:	e8 69 ff ff ff       	call   8027e0 <fsipc>
+}
+  802877:	c9                   	leave
+  802878:	c3                   	ret
+
+00802879 <devfile_stat>:
+{
+  802879:	55                   	push   %ebp
+  80287a:	89 e5                	mov    %esp,%ebp
+  80287c:	53                   	push   %ebx
+  80287d:	83 ec 04             	sub    $0x4,%esp
+  802880:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802883:	8b 45 08             	mov    0x8(%ebp),%eax
+  802886:	8b 40 0c             	mov    0xc(%eax),%eax
+  802889:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80288e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802893:	b8 05 00 00 00       	mov    $0x5,%eax
+  802898:	e8 43 ff ff ff       	call   8027e0 <fsipc>
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	78 2c                	js     8028cd <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8028a1:	83 ec 08             	sub    $0x8,%esp
+  8028a4:	68 00 60 80 00       	push   $0x806000
+  8028a9:	53                   	push   %ebx
+  8028aa:	e8 ac e2 ff ff       	call   800b5b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8028af:	a1 80 60 80 00       	mov    0x806080,%eax
+  8028b4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8028ba:	a1 84 60 80 00       	mov    0x806084,%eax
+  8028bf:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8028c5:	83 c4 10             	add    $0x10,%esp
+  8028c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d0:	c9                   	leave
+  8028d1:	c3                   	ret
+
+008028d2 <devfile_write>:
+{
+  8028d2:	55                   	push   %ebp
+  8028d3:	89 e5                	mov    %esp,%ebp
+  8028d5:	83 ec 0c             	sub    $0xc,%esp
+  8028d8:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028de:	8b 52 0c             	mov    0xc(%edx),%edx
+  8028e1:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8028e7:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8028ec:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8028f1:	39 d0                	cmp    %edx,%eax
+  8028f3:	0f 47 c2             	cmova  %edx,%eax
+  8028f6:	50                   	push   %eax
+  8028f7:	ff 75 0c             	push   0xc(%ebp)
+  8028fa:	68 08 60 80 00       	push   $0x806008
+  8028ff:	e8 dd e3 ff ff       	call   800ce1 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802904:	ba 00 00 00 00       	mov    $0x0,%edx
+  802909:	b8 04 00 00 00       	mov    $0x4,%eax
+  80290e:	e8 cd fe ff ff       	call   8027e0 <fsipc>
+}
+  802913:	c9                   	leave
+  802914:	c3                   	ret
+
+00802915 <devfile_read>:
+{
+  802915:	55                   	push   %ebp
+  802916:	89 e5                	mov    %esp,%ebp
+  802918:	56                   	push   %esi
+  802919:	53                   	push   %ebx
+  80291a:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80291d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802920:	8b 40 0c             	mov    0xc(%eax),%eax
+  802923:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802928:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80292e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802933:	b8 03 00 00 00       	mov    $0x3,%eax
+  802938:	e8 a3 fe ff ff       	call   8027e0 <fsipc>
+  80293d:	89 c3                	mov    %eax,%ebx
+  80293f:	85 c0                	test   %eax,%eax
+  802941:	78 1f                	js     802962 <devfile_read+0x4d>
+	assert(r <= n);
+  802943:	39 c6                	cmp    %eax,%esi
+  802945:	72 24                	jb     80296b <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802947:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80294c:	7f 33                	jg     802981 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80294e:	83 ec 04             	sub    $0x4,%esp
+  802951:	50                   	push   %eax
+  802952:	68 00 60 80 00       	push   $0x806000
+  802957:	ff 75 0c             	push   0xc(%ebp)
+  80295a:	e8 82 e3 ff ff       	call   800ce1 <memmove>
+	return r;
+  80295f:	83 c4 10             	add    $0x10,%esp
+}
+  802962:	89 d8                	mov    %ebx,%eax
+  802964:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802967:	5b                   	pop    %ebx
+  802968:	5e                   	pop    %esi
+  802969:	5d                   	pop    %ebp
+  80296a:	c3                   	ret
+	assert(r <= n);
+  80296b:	68 00 3d 80 00       	push   $0x803d00
+  802970:	68 f0 3b 80 00       	push   $0x803bf0
+  802975:	6a 76                	push   $0x76
+  802977:	68 07 3d 80 00       	push   $0x803d07
+  80297c:	e8 b7 da ff ff       	call   800438 <_panic>
+	assert(r <= PGSIZE);
+  802981:	68 12 3d 80 00       	push   $0x803d12
+  802986:	68 f0 3b 80 00       	push   $0x803bf0
+  80298b:	6a 77                	push   $0x77
+  80298d:	68 07 3d 80 00       	push   $0x803d07
+  802992:	e8 a1 da ff ff       	call   800438 <_panic>
+
+00802997 <open>:
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	56                   	push   %esi
+  80299b:	53                   	push   %ebx
+  80299c:	83 ec 1c             	sub    $0x1c,%esp
+  80299f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8029a2:	56                   	push   %esi
+  8029a3:	e8 78 e1 ff ff       	call   800b20 <strlen>
+  8029a8:	83 c4 10             	add    $0x10,%esp
+  8029ab:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029b0:	7f 6c                	jg     802a1e <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8029b2:	83 ec 0c             	sub    $0xc,%esp
+  8029b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029b8:	50                   	push   %eax
+  8029b9:	e8 3a f8 ff ff       	call   8021f8 <fd_alloc>
+  8029be:	89 c3                	mov    %eax,%ebx
+  8029c0:	83 c4 10             	add    $0x10,%esp
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 3c                	js     802a03 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8029c7:	83 ec 08             	sub    $0x8,%esp
+  8029ca:	56                   	push   %esi
+  8029cb:	68 00 60 80 00       	push   $0x806000
+  8029d0:	e8 86 e1 ff ff       	call   800b5b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8029d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029d8:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8029dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029e5:	e8 f6 fd ff ff       	call   8027e0 <fsipc>
+  8029ea:	89 c3                	mov    %eax,%ebx
+  8029ec:	83 c4 10             	add    $0x10,%esp
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	78 19                	js     802a0c <open+0x75>
+	return fd2num(fd);
+  8029f3:	83 ec 0c             	sub    $0xc,%esp
+  8029f6:	ff 75 f4             	push   -0xc(%ebp)
+  8029f9:	e8 d3 f7 ff ff       	call   8021d1 <fd2num>
+  8029fe:	89 c3                	mov    %eax,%ebx
+  802a00:	83 c4 10             	add    $0x10,%esp
+}
+  802a03:	89 d8                	mov    %ebx,%eax
+  802a05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a08:	5b                   	pop    %ebx
+  802a09:	5e                   	pop    %esi
+  802a0a:	5d                   	pop    %ebp
+  802a0b:	c3                   	ret
+		fd_close(fd, 0);
+  802a0c:	83 ec 08             	sub    $0x8,%esp
+  802a0f:	6a 00                	push   $0x0
+  802a11:	ff 75 f4             	push   -0xc(%ebp)
+  802a14:	e8 f8 f8 ff ff       	call   802311 <fd_close>
+		return r;
+  802a19:	83 c4 10             	add    $0x10,%esp
+  802a1c:	eb e5                	jmp    802a03 <open+0x6c>
+		return -E_BAD_PATH;
+  802a1e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802a23:	eb de                	jmp    802a03 <open+0x6c>
+
+00802a25 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a25:	55                   	push   %ebp
+  802a26:	89 e5                	mov    %esp,%ebp
+  802a28:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a30:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a35:	e8 a6 fd ff ff       	call   8027e0 <fsipc>
+}
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+
+00802a3c <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a42:	68 1e 3d 80 00       	push   $0x803d1e
+  802a47:	ff 75 0c             	push   0xc(%ebp)
+  802a4a:	e8 0c e1 ff ff       	call   800b5b <strcpy>
+	return 0;
+}
+  802a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a54:	c9                   	leave
+  802a55:	c3                   	ret
+
+00802a56 <devsock_close>:
+{
+  802a56:	55                   	push   %ebp
+  802a57:	89 e5                	mov    %esp,%ebp
+  802a59:	53                   	push   %ebx
+  802a5a:	83 ec 10             	sub    $0x10,%esp
+  802a5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a60:	53                   	push   %ebx
+  802a61:	e8 c5 0b 00 00       	call   80362b <pageref>
+  802a66:	89 c2                	mov    %eax,%edx
+  802a68:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a70:	83 fa 01             	cmp    $0x1,%edx
+  802a73:	74 05                	je     802a7a <devsock_close+0x24>
+}
+  802a75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a78:	c9                   	leave
+  802a79:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a7a:	83 ec 0c             	sub    $0xc,%esp
+  802a7d:	ff 73 0c             	push   0xc(%ebx)
+  802a80:	e8 b7 02 00 00       	call   802d3c <nsipc_close>
+  802a85:	83 c4 10             	add    $0x10,%esp
+  802a88:	eb eb                	jmp    802a75 <devsock_close+0x1f>
+
+00802a8a <devsock_write>:
+{
+  802a8a:	55                   	push   %ebp
+  802a8b:	89 e5                	mov    %esp,%ebp
+  802a8d:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a90:	6a 00                	push   $0x0
+  802a92:	ff 75 10             	push   0x10(%ebp)
+  802a95:	ff 75 0c             	push   0xc(%ebp)
+  802a98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9b:	ff 70 0c             	push   0xc(%eax)
+  802a9e:	e8 79 03 00 00       	call   802e1c <nsipc_send>
+}
+  802aa3:	c9                   	leave
+  802aa4:	c3                   	ret
+
+00802aa5 <devsock_read>:
+{
+  802aa5:	55                   	push   %ebp
+  802aa6:	89 e5                	mov    %esp,%ebp
+  802aa8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802aab:	6a 00                	push   $0x0
+  802aad:	ff 75 10             	push   0x10(%ebp)
+  802ab0:	ff 75 0c             	push   0xc(%ebp)
+  802ab3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab6:	ff 70 0c             	push   0xc(%eax)
+  802ab9:	e8 ef 02 00 00       	call   802dad <nsipc_recv>
+}
+  802abe:	c9                   	leave
+  802abf:	c3                   	ret
+
+00802ac0 <fd2sockid>:
+{
+  802ac0:	55                   	push   %ebp
+  802ac1:	89 e5                	mov    %esp,%ebp
+  802ac3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802ac6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ac9:	52                   	push   %edx
+  802aca:	50                   	push   %eax
+  802acb:	e8 7e f7 ff ff       	call   80224e <fd_lookup>
+  802ad0:	83 c4 10             	add    $0x10,%esp
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	78 10                	js     802ae7 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ad7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ada:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  802ae0:	39 08                	cmp    %ecx,(%eax)
+  802ae2:	75 05                	jne    802ae9 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802ae4:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802ae7:	c9                   	leave
+  802ae8:	c3                   	ret
+		return -E_NOT_SUPP;
+  802ae9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802aee:	eb f7                	jmp    802ae7 <fd2sockid+0x27>
+
+00802af0 <alloc_sockfd>:
+{
+  802af0:	55                   	push   %ebp
+  802af1:	89 e5                	mov    %esp,%ebp
+  802af3:	56                   	push   %esi
+  802af4:	53                   	push   %ebx
+  802af5:	83 ec 1c             	sub    $0x1c,%esp
+  802af8:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802afa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802afd:	50                   	push   %eax
+  802afe:	e8 f5 f6 ff ff       	call   8021f8 <fd_alloc>
+  802b03:	89 c3                	mov    %eax,%ebx
+  802b05:	83 c4 10             	add    $0x10,%esp
+  802b08:	85 c0                	test   %eax,%eax
+  802b0a:	78 43                	js     802b4f <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b0c:	83 ec 04             	sub    $0x4,%esp
+  802b0f:	68 07 04 00 00       	push   $0x407
+  802b14:	ff 75 f4             	push   -0xc(%ebp)
+  802b17:	6a 00                	push   $0x0
+  802b19:	e8 35 e5 ff ff       	call   801053 <sys_page_alloc>
+  802b1e:	89 c3                	mov    %eax,%ebx
+  802b20:	83 c4 10             	add    $0x10,%esp
+  802b23:	85 c0                	test   %eax,%eax
+  802b25:	78 28                	js     802b4f <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b2a:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  802b30:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b35:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b3c:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b3f:	83 ec 0c             	sub    $0xc,%esp
+  802b42:	50                   	push   %eax
+  802b43:	e8 89 f6 ff ff       	call   8021d1 <fd2num>
+  802b48:	89 c3                	mov    %eax,%ebx
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  802b4d:	eb 0c                	jmp    802b5b <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b4f:	83 ec 0c             	sub    $0xc,%esp
+  802b52:	56                   	push   %esi
+  802b53:	e8 e4 01 00 00       	call   802d3c <nsipc_close>
+		return r;
+  802b58:	83 c4 10             	add    $0x10,%esp
+}
+  802b5b:	89 d8                	mov    %ebx,%eax
+  802b5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b60:	5b                   	pop    %ebx
+  802b61:	5e                   	pop    %esi
+  802b62:	5d                   	pop    %ebp
+  802b63:	c3                   	ret
+
+00802b64 <accept>:
+{
+  802b64:	55                   	push   %ebp
+  802b65:	89 e5                	mov    %esp,%ebp
+  802b67:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b6d:	e8 4e ff ff ff       	call   802ac0 <fd2sockid>
+  802b72:	85 c0                	test   %eax,%eax
+  802b74:	78 1b                	js     802b91 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b76:	83 ec 04             	sub    $0x4,%esp
+  802b79:	ff 75 10             	push   0x10(%ebp)
+  802b7c:	ff 75 0c             	push   0xc(%ebp)
+  802b7f:	50                   	push   %eax
+  802b80:	e8 0e 01 00 00       	call   802c93 <nsipc_accept>
+  802b85:	83 c4 10             	add    $0x10,%esp
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	78 05                	js     802b91 <accept+0x2d>
+	return alloc_sockfd(r);
+  802b8c:	e8 5f ff ff ff       	call   802af0 <alloc_sockfd>
+}
+  802b91:	c9                   	leave
+  802b92:	c3                   	ret
+
+00802b93 <bind>:
+{
+  802b93:	55                   	push   %ebp
+  802b94:	89 e5                	mov    %esp,%ebp
+  802b96:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9c:	e8 1f ff ff ff       	call   802ac0 <fd2sockid>
+  802ba1:	85 c0                	test   %eax,%eax
+  802ba3:	78 12                	js     802bb7 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802ba5:	83 ec 04             	sub    $0x4,%esp
+  802ba8:	ff 75 10             	push   0x10(%ebp)
+  802bab:	ff 75 0c             	push   0xc(%ebp)
+  802bae:	50                   	push   %eax
+  802baf:	e8 31 01 00 00       	call   802ce5 <nsipc_bind>
+  802bb4:	83 c4 10             	add    $0x10,%esp
+}
+  802bb7:	c9                   	leave
+  802bb8:	c3                   	ret
+
+00802bb9 <shutdown>:
+{
+  802bb9:	55                   	push   %ebp
+  802bba:	89 e5                	mov    %esp,%ebp
+  802bbc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc2:	e8 f9 fe ff ff       	call   802ac0 <fd2sockid>
+  802bc7:	85 c0                	test   %eax,%eax
+  802bc9:	78 0f                	js     802bda <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802bcb:	83 ec 08             	sub    $0x8,%esp
+  802bce:	ff 75 0c             	push   0xc(%ebp)
+  802bd1:	50                   	push   %eax
+  802bd2:	e8 43 01 00 00       	call   802d1a <nsipc_shutdown>
+  802bd7:	83 c4 10             	add    $0x10,%esp
+}
+  802bda:	c9                   	leave
+  802bdb:	c3                   	ret
+
+00802bdc <connect>:
+{
+  802bdc:	55                   	push   %ebp
+  802bdd:	89 e5                	mov    %esp,%ebp
+  802bdf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802be2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be5:	e8 d6 fe ff ff       	call   802ac0 <fd2sockid>
+  802bea:	85 c0                	test   %eax,%eax
+  802bec:	78 12                	js     802c00 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802bee:	83 ec 04             	sub    $0x4,%esp
+  802bf1:	ff 75 10             	push   0x10(%ebp)
+  802bf4:	ff 75 0c             	push   0xc(%ebp)
+  802bf7:	50                   	push   %eax
+  802bf8:	e8 59 01 00 00       	call   802d56 <nsipc_connect>
+  802bfd:	83 c4 10             	add    $0x10,%esp
+}
+  802c00:	c9                   	leave
+  802c01:	c3                   	ret
+
+00802c02 <listen>:
+{
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c08:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c0b:	e8 b0 fe ff ff       	call   802ac0 <fd2sockid>
+  802c10:	85 c0                	test   %eax,%eax
+  802c12:	78 0f                	js     802c23 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c14:	83 ec 08             	sub    $0x8,%esp
+  802c17:	ff 75 0c             	push   0xc(%ebp)
+  802c1a:	50                   	push   %eax
+  802c1b:	e8 6b 01 00 00       	call   802d8b <nsipc_listen>
+  802c20:	83 c4 10             	add    $0x10,%esp
+}
+  802c23:	c9                   	leave
+  802c24:	c3                   	ret
+
+00802c25 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c25:	55                   	push   %ebp
+  802c26:	89 e5                	mov    %esp,%ebp
+  802c28:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c2b:	ff 75 10             	push   0x10(%ebp)
+  802c2e:	ff 75 0c             	push   0xc(%ebp)
+  802c31:	ff 75 08             	push   0x8(%ebp)
+  802c34:	e8 41 02 00 00       	call   802e7a <nsipc_socket>
+  802c39:	83 c4 10             	add    $0x10,%esp
+  802c3c:	85 c0                	test   %eax,%eax
+  802c3e:	78 05                	js     802c45 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c40:	e8 ab fe ff ff       	call   802af0 <alloc_sockfd>
+}
+  802c45:	c9                   	leave
+  802c46:	c3                   	ret
+
+00802c47 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c47:	55                   	push   %ebp
+  802c48:	89 e5                	mov    %esp,%ebp
+  802c4a:	53                   	push   %ebx
+  802c4b:	83 ec 04             	sub    $0x4,%esp
+  802c4e:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c50:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802c57:	74 26                	je     802c7f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c59:	6a 07                	push   $0x7
+  802c5b:	68 00 70 80 00       	push   $0x807000
+  802c60:	53                   	push   %ebx
+  802c61:	ff 35 04 50 80 00    	push   0x805004
+  802c67:	e8 2c 09 00 00       	call   803598 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c6c:	83 c4 0c             	add    $0xc,%esp
+  802c6f:	6a 00                	push   $0x0
+  802c71:	6a 00                	push   $0x0
+  802c73:	6a 00                	push   $0x0
+  802c75:	e8 06 09 00 00       	call   803580 <ipc_recv>
+}
+  802c7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c7d:	c9                   	leave
+  802c7e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c7f:	83 ec 0c             	sub    $0xc,%esp
+  802c82:	6a 02                	push   $0x2
+  802c84:	e8 63 09 00 00       	call   8035ec <ipc_find_env>
+  802c89:	a3 04 50 80 00       	mov    %eax,0x805004
+  802c8e:	83 c4 10             	add    $0x10,%esp
+  802c91:	eb c6                	jmp    802c59 <nsipc+0x12>
+
+00802c93 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802c93:	55                   	push   %ebp
+  802c94:	89 e5                	mov    %esp,%ebp
+  802c96:	56                   	push   %esi
+  802c97:	53                   	push   %ebx
+  802c98:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802c9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802ca3:	8b 06                	mov    (%esi),%eax
+  802ca5:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802caa:	b8 01 00 00 00       	mov    $0x1,%eax
+  802caf:	e8 93 ff ff ff       	call   802c47 <nsipc>
+  802cb4:	89 c3                	mov    %eax,%ebx
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	79 09                	jns    802cc3 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802cba:	89 d8                	mov    %ebx,%eax
+  802cbc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cbf:	5b                   	pop    %ebx
+  802cc0:	5e                   	pop    %esi
+  802cc1:	5d                   	pop    %ebp
+  802cc2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802cc3:	83 ec 04             	sub    $0x4,%esp
+  802cc6:	ff 35 10 70 80 00    	push   0x807010
+  802ccc:	68 00 70 80 00       	push   $0x807000
+  802cd1:	ff 75 0c             	push   0xc(%ebp)
+  802cd4:	e8 08 e0 ff ff       	call   800ce1 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802cd9:	a1 10 70 80 00       	mov    0x807010,%eax
+  802cde:	89 06                	mov    %eax,(%esi)
+  802ce0:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ce3:	eb d5                	jmp    802cba <nsipc_accept+0x27>
+
+00802ce5 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ce5:	55                   	push   %ebp
+  802ce6:	89 e5                	mov    %esp,%ebp
+  802ce8:	53                   	push   %ebx
+  802ce9:	83 ec 08             	sub    $0x8,%esp
+  802cec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802cef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf2:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802cf7:	53                   	push   %ebx
+  802cf8:	ff 75 0c             	push   0xc(%ebp)
+  802cfb:	68 04 70 80 00       	push   $0x807004
+  802d00:	e8 dc df ff ff       	call   800ce1 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d05:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802d0b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d10:	e8 32 ff ff ff       	call   802c47 <nsipc>
+}
+  802d15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d18:	c9                   	leave
+  802d19:	c3                   	ret
+
+00802d1a <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d1a:	55                   	push   %ebp
+  802d1b:	89 e5                	mov    %esp,%ebp
+  802d1d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d23:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802d28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d2b:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d30:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d35:	e8 0d ff ff ff       	call   802c47 <nsipc>
+}
+  802d3a:	c9                   	leave
+  802d3b:	c3                   	ret
+
+00802d3c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d3c:	55                   	push   %ebp
+  802d3d:	89 e5                	mov    %esp,%ebp
+  802d3f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d42:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d45:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802d4a:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d4f:	e8 f3 fe ff ff       	call   802c47 <nsipc>
+}
+  802d54:	c9                   	leave
+  802d55:	c3                   	ret
+
+00802d56 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d56:	55                   	push   %ebp
+  802d57:	89 e5                	mov    %esp,%ebp
+  802d59:	53                   	push   %ebx
+  802d5a:	83 ec 08             	sub    $0x8,%esp
+  802d5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d63:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d68:	53                   	push   %ebx
+  802d69:	ff 75 0c             	push   0xc(%ebp)
+  802d6c:	68 04 70 80 00       	push   $0x807004
+  802d71:	e8 6b df ff ff       	call   800ce1 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d76:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802d7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d81:	e8 c1 fe ff ff       	call   802c47 <nsipc>
+}
+  802d86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d89:	c9                   	leave
+  802d8a:	c3                   	ret
+
+00802d8b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d8b:	55                   	push   %ebp
+  802d8c:	89 e5                	mov    %esp,%ebp
+  802d8e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d94:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802d99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d9c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802da1:	b8 06 00 00 00       	mov    $0x6,%eax
+  802da6:	e8 9c fe ff ff       	call   802c47 <nsipc>
+}
+  802dab:	c9                   	leave
+  802dac:	c3                   	ret
+
+00802dad <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802dad:	55                   	push   %ebp
+  802dae:	89 e5                	mov    %esp,%ebp
+  802db0:	56                   	push   %esi
+  802db1:	53                   	push   %ebx
+  802db2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802db8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802dbd:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802dc3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dc6:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802dcb:	b8 07 00 00 00       	mov    $0x7,%eax
+  802dd0:	e8 72 fe ff ff       	call   802c47 <nsipc>
+  802dd5:	89 c3                	mov    %eax,%ebx
+  802dd7:	85 c0                	test   %eax,%eax
+  802dd9:	78 22                	js     802dfd <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ddb:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802de0:	39 c6                	cmp    %eax,%esi
+  802de2:	0f 4e c6             	cmovle %esi,%eax
+  802de5:	39 c3                	cmp    %eax,%ebx
+  802de7:	7f 1d                	jg     802e06 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802de9:	83 ec 04             	sub    $0x4,%esp
+  802dec:	53                   	push   %ebx
+  802ded:	68 00 70 80 00       	push   $0x807000
+  802df2:	ff 75 0c             	push   0xc(%ebp)
+  802df5:	e8 e7 de ff ff       	call   800ce1 <memmove>
+  802dfa:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802dfd:	89 d8                	mov    %ebx,%eax
+  802dff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e02:	5b                   	pop    %ebx
+  802e03:	5e                   	pop    %esi
+  802e04:	5d                   	pop    %ebp
+  802e05:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e06:	68 2a 3d 80 00       	push   $0x803d2a
+  802e0b:	68 f0 3b 80 00       	push   $0x803bf0
+  802e10:	6a 62                	push   $0x62
+  802e12:	68 3f 3d 80 00       	push   $0x803d3f
+  802e17:	e8 1c d6 ff ff       	call   800438 <_panic>
+
+00802e1c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e1c:	55                   	push   %ebp
+  802e1d:	89 e5                	mov    %esp,%ebp
+  802e1f:	53                   	push   %ebx
+  802e20:	83 ec 04             	sub    $0x4,%esp
+  802e23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e29:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802e2e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e34:	7f 2e                	jg     802e64 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e36:	83 ec 04             	sub    $0x4,%esp
+  802e39:	53                   	push   %ebx
+  802e3a:	ff 75 0c             	push   0xc(%ebp)
+  802e3d:	68 0c 70 80 00       	push   $0x80700c
+  802e42:	e8 9a de ff ff       	call   800ce1 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e47:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802e4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e50:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802e55:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e5a:	e8 e8 fd ff ff       	call   802c47 <nsipc>
+}
+  802e5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e62:	c9                   	leave
+  802e63:	c3                   	ret
+	assert(size < 1600);
+  802e64:	68 4b 3d 80 00       	push   $0x803d4b
+  802e69:	68 f0 3b 80 00       	push   $0x803bf0
+  802e6e:	6a 6d                	push   $0x6d
+  802e70:	68 3f 3d 80 00       	push   $0x803d3f
+  802e75:	e8 be d5 ff ff       	call   800438 <_panic>
+
+00802e7a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e7a:	55                   	push   %ebp
+  802e7b:	89 e5                	mov    %esp,%ebp
+  802e7d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e80:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e83:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802e88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e8b:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e90:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e93:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802e98:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e9d:	e8 a5 fd ff ff       	call   802c47 <nsipc>
+}
+  802ea2:	c9                   	leave
+  802ea3:	c3                   	ret
+
+00802ea4 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ea4:	55                   	push   %ebp
+  802ea5:	89 e5                	mov    %esp,%ebp
+  802ea7:	56                   	push   %esi
+  802ea8:	53                   	push   %ebx
+  802ea9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802eac:	83 ec 0c             	sub    $0xc,%esp
+  802eaf:	ff 75 08             	push   0x8(%ebp)
+  802eb2:	e8 2a f3 ff ff       	call   8021e1 <fd2data>
+  802eb7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802eb9:	83 c4 08             	add    $0x8,%esp
+  802ebc:	68 57 3d 80 00       	push   $0x803d57
+  802ec1:	53                   	push   %ebx
+  802ec2:	e8 94 dc ff ff       	call   800b5b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ec7:	8b 46 04             	mov    0x4(%esi),%eax
+  802eca:	2b 06                	sub    (%esi),%eax
+  802ecc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ed2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ed9:	00 00 00 
+	stat->st_dev = &devpipe;
+  802edc:	c7 83 88 00 00 00 40 	movl   $0x804040,0x88(%ebx)
+  802ee3:	40 80 00 
+	return 0;
+}
+  802ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eeb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eee:	5b                   	pop    %ebx
+  802eef:	5e                   	pop    %esi
+  802ef0:	5d                   	pop    %ebp
+  802ef1:	c3                   	ret
+
+00802ef2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ef2:	55                   	push   %ebp
+  802ef3:	89 e5                	mov    %esp,%ebp
+  802ef5:	53                   	push   %ebx
+  802ef6:	83 ec 0c             	sub    $0xc,%esp
+  802ef9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802efc:	53                   	push   %ebx
+  802efd:	6a 00                	push   $0x0
+  802eff:	e8 2a e2 ff ff       	call   80112e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f04:	89 1c 24             	mov    %ebx,(%esp)
+  802f07:	e8 d5 f2 ff ff       	call   8021e1 <fd2data>
+  802f0c:	83 c4 08             	add    $0x8,%esp
+  802f0f:	50                   	push   %eax
+  802f10:	6a 00                	push   $0x0
+  802f12:	e8 17 e2 ff ff       	call   80112e <sys_page_unmap>
+}
+  802f17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f1a:	c9                   	leave
+  802f1b:	c3                   	ret
+
+00802f1c <_pipeisclosed>:
+{
+  802f1c:	55                   	push   %ebp
+  802f1d:	89 e5                	mov    %esp,%ebp
+  802f1f:	57                   	push   %edi
+  802f20:	56                   	push   %esi
+  802f21:	53                   	push   %ebx
+  802f22:	83 ec 1c             	sub    $0x1c,%esp
+  802f25:	89 c7                	mov    %eax,%edi
+  802f27:	89 d6                	mov    %edx,%esi
+  802f29:	eb 3c                	jmp    802f67 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802f2b:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f2e:	83 ec 0c             	sub    $0xc,%esp
+  802f31:	57                   	push   %edi
+  802f32:	e8 f4 06 00 00       	call   80362b <pageref>
+  802f37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f3a:	89 34 24             	mov    %esi,(%esp)
+  802f3d:	e8 e9 06 00 00       	call   80362b <pageref>
+  802f42:	89 c2                	mov    %eax,%edx
+  802f44:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f46:	05 00 00 00 20       	add    $0x20000000,%eax
+  802f4b:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802f4e:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f54:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f59:	76 31                	jbe    802f8c <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802f5b:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802f5e:	39 c3                	cmp    %eax,%ebx
+  802f60:	74 76                	je     802fd8 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802f62:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f65:	74 36                	je     802f9d <_pipeisclosed+0x81>
+  802f67:	89 e0                	mov    %esp,%eax
+  802f69:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f6e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f74:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f79:	77 b0                	ja     802f2b <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f7b:	c1 e8 10             	shr    $0x10,%eax
+  802f7e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f84:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f8a:	eb 9f                	jmp    802f2b <_pipeisclosed+0xf>
+  802f8c:	c1 e8 10             	shr    $0x10,%eax
+  802f8f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f95:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802f9b:	eb be                	jmp    802f5b <_pipeisclosed+0x3f>
+  802f9d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f9f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802fa4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802faa:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802faf:	76 16                	jbe    802fc7 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fb1:	8b 42 58             	mov    0x58(%edx),%eax
+  802fb4:	6a 01                	push   $0x1
+  802fb6:	50                   	push   %eax
+  802fb7:	53                   	push   %ebx
+  802fb8:	68 5e 3d 80 00       	push   $0x803d5e
+  802fbd:	e8 51 d5 ff ff       	call   800513 <cprintf>
+  802fc2:	83 c4 10             	add    $0x10,%esp
+  802fc5:	eb a0                	jmp    802f67 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802fc7:	c1 e8 10             	shr    $0x10,%eax
+  802fca:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fd0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802fd6:	eb d9                	jmp    802fb1 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802fd8:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802fdb:	0f 94 c0             	sete   %al
+  802fde:	0f b6 c0             	movzbl %al,%eax
+}
+  802fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fe4:	5b                   	pop    %ebx
+  802fe5:	5e                   	pop    %esi
+  802fe6:	5f                   	pop    %edi
+  802fe7:	5d                   	pop    %ebp
+  802fe8:	c3                   	ret
+
+00802fe9 <devpipe_write>:
+{
+  802fe9:	55                   	push   %ebp
+  802fea:	89 e5                	mov    %esp,%ebp
+  802fec:	57                   	push   %edi
+  802fed:	56                   	push   %esi
+  802fee:	53                   	push   %ebx
+  802fef:	83 ec 28             	sub    $0x28,%esp
+  802ff2:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802ff5:	56                   	push   %esi
+  802ff6:	e8 e6 f1 ff ff       	call   8021e1 <fd2data>
+  802ffb:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802ffd:	83 c4 10             	add    $0x10,%esp
+  803000:	bf 00 00 00 00       	mov    $0x0,%edi
+  803005:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803008:	75 09                	jne    803013 <devpipe_write+0x2a>
+	return i;
+  80300a:	89 f8                	mov    %edi,%eax
+  80300c:	eb 23                	jmp    803031 <devpipe_write+0x48>
+			sys_yield();
+  80300e:	e8 fa df ff ff       	call   80100d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803013:	8b 43 04             	mov    0x4(%ebx),%eax
+  803016:	8b 0b                	mov    (%ebx),%ecx
+  803018:	8d 51 20             	lea    0x20(%ecx),%edx
+  80301b:	39 d0                	cmp    %edx,%eax
+  80301d:	72 1a                	jb     803039 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80301f:	89 da                	mov    %ebx,%edx
+  803021:	89 f0                	mov    %esi,%eax
+  803023:	e8 f4 fe ff ff       	call   802f1c <_pipeisclosed>
+  803028:	85 c0                	test   %eax,%eax
+  80302a:	74 e2                	je     80300e <devpipe_write+0x25>
+				return 0;
+  80302c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803031:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803034:	5b                   	pop    %ebx
+  803035:	5e                   	pop    %esi
+  803036:	5f                   	pop    %edi
+  803037:	5d                   	pop    %ebp
+  803038:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80303c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803040:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803043:	89 c2                	mov    %eax,%edx
+  803045:	c1 fa 1f             	sar    $0x1f,%edx
+  803048:	89 d1                	mov    %edx,%ecx
+  80304a:	c1 e9 1b             	shr    $0x1b,%ecx
+  80304d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803050:	83 e2 1f             	and    $0x1f,%edx
+  803053:	29 ca                	sub    %ecx,%edx
+  803055:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803059:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80305d:	83 c0 01             	add    $0x1,%eax
+  803060:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803063:	83 c7 01             	add    $0x1,%edi
+  803066:	eb 9d                	jmp    803005 <devpipe_write+0x1c>
+
+00803068 <devpipe_read>:
+{
+  803068:	55                   	push   %ebp
+  803069:	89 e5                	mov    %esp,%ebp
+  80306b:	57                   	push   %edi
+  80306c:	56                   	push   %esi
+  80306d:	53                   	push   %ebx
+  80306e:	83 ec 18             	sub    $0x18,%esp
+  803071:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803074:	57                   	push   %edi
+  803075:	e8 67 f1 ff ff       	call   8021e1 <fd2data>
+  80307a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80307c:	83 c4 10             	add    $0x10,%esp
+  80307f:	be 00 00 00 00       	mov    $0x0,%esi
+  803084:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803087:	75 13                	jne    80309c <devpipe_read+0x34>
+	return i;
+  803089:	89 f0                	mov    %esi,%eax
+  80308b:	eb 02                	jmp    80308f <devpipe_read+0x27>
+				return i;
+  80308d:	89 f0                	mov    %esi,%eax
+}
+  80308f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803092:	5b                   	pop    %ebx
+  803093:	5e                   	pop    %esi
+  803094:	5f                   	pop    %edi
+  803095:	5d                   	pop    %ebp
+  803096:	c3                   	ret
+			sys_yield();
+  803097:	e8 71 df ff ff       	call   80100d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80309c:	8b 03                	mov    (%ebx),%eax
+  80309e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030a1:	75 18                	jne    8030bb <devpipe_read+0x53>
+			if (i > 0)
+  8030a3:	85 f6                	test   %esi,%esi
+  8030a5:	75 e6                	jne    80308d <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8030a7:	89 da                	mov    %ebx,%edx
+  8030a9:	89 f8                	mov    %edi,%eax
+  8030ab:	e8 6c fe ff ff       	call   802f1c <_pipeisclosed>
+  8030b0:	85 c0                	test   %eax,%eax
+  8030b2:	74 e3                	je     803097 <devpipe_read+0x2f>
+				return 0;
+  8030b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b9:	eb d4                	jmp    80308f <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030bb:	99                   	cltd
+  8030bc:	c1 ea 1b             	shr    $0x1b,%edx
+  8030bf:	01 d0                	add    %edx,%eax
+  8030c1:	83 e0 1f             	and    $0x1f,%eax
+  8030c4:	29 d0                	sub    %edx,%eax
+  8030c6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8030cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030ce:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030d1:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8030d4:	83 c6 01             	add    $0x1,%esi
+  8030d7:	eb ab                	jmp    803084 <devpipe_read+0x1c>
+
+008030d9 <pipe>:
+{
+  8030d9:	55                   	push   %ebp
+  8030da:	89 e5                	mov    %esp,%ebp
+  8030dc:	56                   	push   %esi
+  8030dd:	53                   	push   %ebx
+  8030de:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030e4:	50                   	push   %eax
+  8030e5:	e8 0e f1 ff ff       	call   8021f8 <fd_alloc>
+  8030ea:	89 c3                	mov    %eax,%ebx
+  8030ec:	83 c4 10             	add    $0x10,%esp
+  8030ef:	85 c0                	test   %eax,%eax
+  8030f1:	0f 88 23 01 00 00    	js     80321a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030f7:	83 ec 04             	sub    $0x4,%esp
+  8030fa:	68 07 04 00 00       	push   $0x407
+  8030ff:	ff 75 f4             	push   -0xc(%ebp)
+  803102:	6a 00                	push   $0x0
+  803104:	e8 4a df ff ff       	call   801053 <sys_page_alloc>
+  803109:	89 c3                	mov    %eax,%ebx
+  80310b:	83 c4 10             	add    $0x10,%esp
+  80310e:	85 c0                	test   %eax,%eax
+  803110:	0f 88 04 01 00 00    	js     80321a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803116:	83 ec 0c             	sub    $0xc,%esp
+  803119:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80311c:	50                   	push   %eax
+  80311d:	e8 d6 f0 ff ff       	call   8021f8 <fd_alloc>
+  803122:	89 c3                	mov    %eax,%ebx
+  803124:	83 c4 10             	add    $0x10,%esp
+  803127:	85 c0                	test   %eax,%eax
+  803129:	0f 88 db 00 00 00    	js     80320a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80312f:	83 ec 04             	sub    $0x4,%esp
+  803132:	68 07 04 00 00       	push   $0x407
+  803137:	ff 75 f0             	push   -0x10(%ebp)
+  80313a:	6a 00                	push   $0x0
+  80313c:	e8 12 df ff ff       	call   801053 <sys_page_alloc>
+  803141:	89 c3                	mov    %eax,%ebx
+  803143:	83 c4 10             	add    $0x10,%esp
+  803146:	85 c0                	test   %eax,%eax
+  803148:	0f 88 bc 00 00 00    	js     80320a <pipe+0x131>
+	va = fd2data(fd0);
+  80314e:	83 ec 0c             	sub    $0xc,%esp
+  803151:	ff 75 f4             	push   -0xc(%ebp)
+  803154:	e8 88 f0 ff ff       	call   8021e1 <fd2data>
+  803159:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80315b:	83 c4 0c             	add    $0xc,%esp
+  80315e:	68 07 04 00 00       	push   $0x407
+  803163:	50                   	push   %eax
+  803164:	6a 00                	push   $0x0
+  803166:	e8 e8 de ff ff       	call   801053 <sys_page_alloc>
+  80316b:	89 c3                	mov    %eax,%ebx
+  80316d:	83 c4 10             	add    $0x10,%esp
+  803170:	85 c0                	test   %eax,%eax
+  803172:	0f 88 82 00 00 00    	js     8031fa <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803178:	83 ec 0c             	sub    $0xc,%esp
+  80317b:	ff 75 f0             	push   -0x10(%ebp)
+  80317e:	e8 5e f0 ff ff       	call   8021e1 <fd2data>
+  803183:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80318a:	50                   	push   %eax
+  80318b:	6a 00                	push   $0x0
+  80318d:	56                   	push   %esi
+  80318e:	6a 00                	push   $0x0
+  803190:	e8 2b df ff ff       	call   8010c0 <sys_page_map>
+  803195:	89 c3                	mov    %eax,%ebx
+  803197:	83 c4 20             	add    $0x20,%esp
+  80319a:	85 c0                	test   %eax,%eax
+  80319c:	78 4e                	js     8031ec <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80319e:	a1 40 40 80 00       	mov    0x804040,%eax
+  8031a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031a6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031ab:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031b2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031b5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031ba:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031c1:	83 ec 0c             	sub    $0xc,%esp
+  8031c4:	ff 75 f4             	push   -0xc(%ebp)
+  8031c7:	e8 05 f0 ff ff       	call   8021d1 <fd2num>
+  8031cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031cf:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031d1:	83 c4 04             	add    $0x4,%esp
+  8031d4:	ff 75 f0             	push   -0x10(%ebp)
+  8031d7:	e8 f5 ef ff ff       	call   8021d1 <fd2num>
+  8031dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031df:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031e2:	83 c4 10             	add    $0x10,%esp
+  8031e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031ea:	eb 2e                	jmp    80321a <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031ec:	83 ec 08             	sub    $0x8,%esp
+  8031ef:	56                   	push   %esi
+  8031f0:	6a 00                	push   $0x0
+  8031f2:	e8 37 df ff ff       	call   80112e <sys_page_unmap>
+  8031f7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031fa:	83 ec 08             	sub    $0x8,%esp
+  8031fd:	ff 75 f0             	push   -0x10(%ebp)
+  803200:	6a 00                	push   $0x0
+  803202:	e8 27 df ff ff       	call   80112e <sys_page_unmap>
+  803207:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80320a:	83 ec 08             	sub    $0x8,%esp
+  80320d:	ff 75 f4             	push   -0xc(%ebp)
+  803210:	6a 00                	push   $0x0
+  803212:	e8 17 df ff ff       	call   80112e <sys_page_unmap>
+  803217:	83 c4 10             	add    $0x10,%esp
+}
+  80321a:	89 d8                	mov    %ebx,%eax
+  80321c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80321f:	5b                   	pop    %ebx
+  803220:	5e                   	pop    %esi
+  803221:	5d                   	pop    %ebp
+  803222:	c3                   	ret
+
+00803223 <pipeisclosed>:
+{
+  803223:	55                   	push   %ebp
+  803224:	89 e5                	mov    %esp,%ebp
+  803226:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803229:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80322c:	50                   	push   %eax
+  80322d:	ff 75 08             	push   0x8(%ebp)
+  803230:	e8 19 f0 ff ff       	call   80224e <fd_lookup>
+  803235:	83 c4 10             	add    $0x10,%esp
+  803238:	85 c0                	test   %eax,%eax
+  80323a:	78 18                	js     803254 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80323c:	83 ec 0c             	sub    $0xc,%esp
+  80323f:	ff 75 f4             	push   -0xc(%ebp)
+  803242:	e8 9a ef ff ff       	call   8021e1 <fd2data>
+  803247:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803249:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80324c:	e8 cb fc ff ff       	call   802f1c <_pipeisclosed>
+  803251:	83 c4 10             	add    $0x10,%esp
+}
+  803254:	c9                   	leave
+  803255:	c3                   	ret
+
+00803256 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803256:	55                   	push   %ebp
+  803257:	89 e5                	mov    %esp,%ebp
+  803259:	56                   	push   %esi
+  80325a:	53                   	push   %ebx
+  80325b:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80325e:	85 f6                	test   %esi,%esi
+  803260:	74 16                	je     803278 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  803262:	89 f3                	mov    %esi,%ebx
+  803264:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80326a:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  803270:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803276:	eb 1b                	jmp    803293 <wait+0x3d>
+	assert(envid != 0);
+  803278:	68 76 3d 80 00       	push   $0x803d76
+  80327d:	68 f0 3b 80 00       	push   $0x803bf0
+  803282:	6a 09                	push   $0x9
+  803284:	68 81 3d 80 00       	push   $0x803d81
+  803289:	e8 aa d1 ff ff       	call   800438 <_panic>
+		sys_yield();
+  80328e:	e8 7a dd ff ff       	call   80100d <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803293:	8b 43 48             	mov    0x48(%ebx),%eax
+  803296:	39 f0                	cmp    %esi,%eax
+  803298:	75 07                	jne    8032a1 <wait+0x4b>
+  80329a:	8b 43 54             	mov    0x54(%ebx),%eax
+  80329d:	85 c0                	test   %eax,%eax
+  80329f:	75 ed                	jne    80328e <wait+0x38>
+}
+  8032a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a4:	5b                   	pop    %ebx
+  8032a5:	5e                   	pop    %esi
+  8032a6:	5d                   	pop    %ebp
+  8032a7:	c3                   	ret
+
+008032a8 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8032a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ad:	c3                   	ret
+
+008032ae <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032ae:	55                   	push   %ebp
+  8032af:	89 e5                	mov    %esp,%ebp
+  8032b1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8032b4:	68 8c 3d 80 00       	push   $0x803d8c
+  8032b9:	ff 75 0c             	push   0xc(%ebp)
+  8032bc:	e8 9a d8 ff ff       	call   800b5b <strcpy>
+	return 0;
+}
+  8032c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c6:	c9                   	leave
+  8032c7:	c3                   	ret
+
+008032c8 <devcons_write>:
+{
+  8032c8:	55                   	push   %ebp
+  8032c9:	89 e5                	mov    %esp,%ebp
+  8032cb:	57                   	push   %edi
+  8032cc:	56                   	push   %esi
+  8032cd:	53                   	push   %ebx
+  8032ce:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8032d4:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8032d9:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8032df:	eb 2e                	jmp    80330f <devcons_write+0x47>
+		m = n - tot;
+  8032e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8032e4:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8032e6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032eb:	39 c3                	cmp    %eax,%ebx
+  8032ed:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8032f0:	83 ec 04             	sub    $0x4,%esp
+  8032f3:	53                   	push   %ebx
+  8032f4:	89 f0                	mov    %esi,%eax
+  8032f6:	03 45 0c             	add    0xc(%ebp),%eax
+  8032f9:	50                   	push   %eax
+  8032fa:	57                   	push   %edi
+  8032fb:	e8 e1 d9 ff ff       	call   800ce1 <memmove>
+		sys_cputs(buf, m);
+  803300:	83 c4 08             	add    $0x8,%esp
+  803303:	53                   	push   %ebx
+  803304:	57                   	push   %edi
+  803305:	e8 ca db ff ff       	call   800ed4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80330a:	01 de                	add    %ebx,%esi
+  80330c:	83 c4 10             	add    $0x10,%esp
+  80330f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803312:	72 cd                	jb     8032e1 <devcons_write+0x19>
+}
+  803314:	89 f0                	mov    %esi,%eax
+  803316:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803319:	5b                   	pop    %ebx
+  80331a:	5e                   	pop    %esi
+  80331b:	5f                   	pop    %edi
+  80331c:	5d                   	pop    %ebp
+  80331d:	c3                   	ret
+
+0080331e <devcons_read>:
+{
+  80331e:	55                   	push   %ebp
+  80331f:	89 e5                	mov    %esp,%ebp
+  803321:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803324:	b8 00 00 00 00       	mov    $0x0,%eax
+  803329:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80332d:	75 07                	jne    803336 <devcons_read+0x18>
+  80332f:	eb 1f                	jmp    803350 <devcons_read+0x32>
+		sys_yield();
+  803331:	e8 d7 dc ff ff       	call   80100d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803336:	e8 dd db ff ff       	call   800f18 <sys_cgetc>
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	74 f2                	je     803331 <devcons_read+0x13>
+	if (c < 0)
+  80333f:	78 0f                	js     803350 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803341:	83 f8 04             	cmp    $0x4,%eax
+  803344:	74 0c                	je     803352 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803346:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803349:	88 02                	mov    %al,(%edx)
+	return 1;
+  80334b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803350:	c9                   	leave
+  803351:	c3                   	ret
+		return 0;
+  803352:	b8 00 00 00 00       	mov    $0x0,%eax
+  803357:	eb f7                	jmp    803350 <devcons_read+0x32>
+
+00803359 <cputchar>:
+{
+  803359:	55                   	push   %ebp
+  80335a:	89 e5                	mov    %esp,%ebp
+  80335c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80335f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803362:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803365:	6a 01                	push   $0x1
+  803367:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80336a:	50                   	push   %eax
+  80336b:	e8 64 db ff ff       	call   800ed4 <sys_cputs>
+}
+  803370:	83 c4 10             	add    $0x10,%esp
+  803373:	c9                   	leave
+  803374:	c3                   	ret
+
+00803375 <getchar>:
+{
+  803375:	55                   	push   %ebp
+  803376:	89 e5                	mov    %esp,%ebp
+  803378:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80337b:	6a 01                	push   $0x1
+  80337d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803380:	50                   	push   %eax
+  803381:	6a 00                	push   $0x0
+  803383:	e8 4c f1 ff ff       	call   8024d4 <read>
+	if (r < 0)
+  803388:	83 c4 10             	add    $0x10,%esp
+  80338b:	85 c0                	test   %eax,%eax
+  80338d:	78 06                	js     803395 <getchar+0x20>
+	if (r < 1)
+  80338f:	74 06                	je     803397 <getchar+0x22>
+	return c;
+  803391:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803395:	c9                   	leave
+  803396:	c3                   	ret
+		return -E_EOF;
+  803397:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80339c:	eb f7                	jmp    803395 <getchar+0x20>
+
+0080339e <iscons>:
+{
+  80339e:	55                   	push   %ebp
+  80339f:	89 e5                	mov    %esp,%ebp
+  8033a1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033a7:	50                   	push   %eax
+  8033a8:	ff 75 08             	push   0x8(%ebp)
+  8033ab:	e8 9e ee ff ff       	call   80224e <fd_lookup>
+  8033b0:	83 c4 10             	add    $0x10,%esp
+  8033b3:	85 c0                	test   %eax,%eax
+  8033b5:	78 11                	js     8033c8 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8033b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033ba:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  8033c0:	39 10                	cmp    %edx,(%eax)
+  8033c2:	0f 94 c0             	sete   %al
+  8033c5:	0f b6 c0             	movzbl %al,%eax
+}
+  8033c8:	c9                   	leave
+  8033c9:	c3                   	ret
+
+008033ca <opencons>:
+{
+  8033ca:	55                   	push   %ebp
+  8033cb:	89 e5                	mov    %esp,%ebp
+  8033cd:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8033d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033d3:	50                   	push   %eax
+  8033d4:	e8 1f ee ff ff       	call   8021f8 <fd_alloc>
+  8033d9:	83 c4 10             	add    $0x10,%esp
+  8033dc:	85 c0                	test   %eax,%eax
+  8033de:	78 3a                	js     80341a <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8033e0:	83 ec 04             	sub    $0x4,%esp
+  8033e3:	68 07 04 00 00       	push   $0x407
+  8033e8:	ff 75 f4             	push   -0xc(%ebp)
+  8033eb:	6a 00                	push   $0x0
+  8033ed:	e8 61 dc ff ff       	call   801053 <sys_page_alloc>
+  8033f2:	83 c4 10             	add    $0x10,%esp
+  8033f5:	85 c0                	test   %eax,%eax
+  8033f7:	78 21                	js     80341a <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8033f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033fc:	8b 15 5c 40 80 00    	mov    0x80405c,%edx
+  803402:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803404:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803407:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80340e:	83 ec 0c             	sub    $0xc,%esp
+  803411:	50                   	push   %eax
+  803412:	e8 ba ed ff ff       	call   8021d1 <fd2num>
+  803417:	83 c4 10             	add    $0x10,%esp
+}
+  80341a:	c9                   	leave
+  80341b:	c3                   	ret
+
+0080341c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80341c:	55                   	push   %ebp
+  80341d:	89 e5                	mov    %esp,%ebp
+  80341f:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803422:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803429:	74 0a                	je     803435 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80342b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80342e:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803433:	c9                   	leave
+  803434:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803435:	83 ec 04             	sub    $0x4,%esp
+  803438:	6a 07                	push   $0x7
+  80343a:	68 00 f0 bf ee       	push   $0xeebff000
+  80343f:	6a 00                	push   $0x0
+  803441:	e8 0d dc ff ff       	call   801053 <sys_page_alloc>
+  803446:	83 c4 10             	add    $0x10,%esp
+  803449:	85 c0                	test   %eax,%eax
+  80344b:	78 14                	js     803461 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80344d:	83 ec 08             	sub    $0x8,%esp
+  803450:	68 83 34 80 00       	push   $0x803483
+  803455:	6a 00                	push   $0x0
+  803457:	e8 13 de ff ff       	call   80126f <sys_env_set_pgfault_upcall>
+  80345c:	83 c4 10             	add    $0x10,%esp
+  80345f:	eb ca                	jmp    80342b <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  803461:	83 ec 08             	sub    $0x8,%esp
+  803464:	50                   	push   %eax
+  803465:	68 98 3d 80 00       	push   $0x803d98
+  80346a:	e8 a4 d0 ff ff       	call   800513 <cprintf>
+			panic("set_pgfault_handler error");
+  80346f:	83 c4 0c             	add    $0xc,%esp
+  803472:	68 a3 3d 80 00       	push   $0x803da3
+  803477:	6a 24                	push   $0x24
+  803479:	68 bd 3d 80 00       	push   $0x803dbd
+  80347e:	e8 b5 cf ff ff       	call   800438 <_panic>
+
+00803483 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803483:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803484:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803489:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80348b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  80348e:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  803492:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803495:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803499:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  80349b:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  80349f:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8034a0:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  8034a4:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  8034a5:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  8034a6:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8034aa:	c3                   	ret
+
+008034ab <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  8034ab:	55                   	push   %ebp
+  8034ac:	89 e5                	mov    %esp,%ebp
+  8034ae:	56                   	push   %esi
+  8034af:	53                   	push   %ebx
+  8034b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8034c0:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8034c3:	83 ec 08             	sub    $0x8,%esp
+  8034c6:	ff 75 14             	push   0x14(%ebp)
+  8034c9:	50                   	push   %eax
+  8034ca:	e8 95 df ff ff       	call   801464 <sys_ipc_recv_until>
+  8034cf:	83 c4 10             	add    $0x10,%esp
+  8034d2:	85 c0                	test   %eax,%eax
+  8034d4:	78 61                	js     803537 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8034d6:	85 f6                	test   %esi,%esi
+  8034d8:	74 1c                	je     8034f6 <ipc_recv_until+0x4b>
+  8034da:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8034dc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8034e1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8034e7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8034ec:	76 5f                	jbe    80354d <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8034ee:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  8034f4:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  8034f6:	85 db                	test   %ebx,%ebx
+  8034f8:	74 1c                	je     803516 <ipc_recv_until+0x6b>
+  8034fa:	89 e0                	mov    %esp,%eax
+  8034fc:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803501:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803507:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80350c:	76 50                	jbe    80355e <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80350e:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803514:	89 03                	mov    %eax,(%ebx)
+  803516:	89 e0                	mov    %esp,%eax
+  803518:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80351d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803523:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803528:	76 45                	jbe    80356f <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  80352a:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  803530:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803533:	5b                   	pop    %ebx
+  803534:	5e                   	pop    %esi
+  803535:	5d                   	pop    %ebp
+  803536:	c3                   	ret
+		if (from_env_store)
+  803537:	85 f6                	test   %esi,%esi
+  803539:	74 06                	je     803541 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  80353b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  803541:	85 db                	test   %ebx,%ebx
+  803543:	74 eb                	je     803530 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803545:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80354b:	eb e3                	jmp    803530 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80354d:	c1 e8 10             	shr    $0x10,%eax
+  803550:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803556:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80355c:	eb 90                	jmp    8034ee <ipc_recv_until+0x43>
+  80355e:	c1 e8 10             	shr    $0x10,%eax
+  803561:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803567:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80356d:	eb 9f                	jmp    80350e <ipc_recv_until+0x63>
+  80356f:	c1 e8 10             	shr    $0x10,%eax
+  803572:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803578:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80357e:	eb aa                	jmp    80352a <ipc_recv_until+0x7f>
+
+00803580 <ipc_recv>:
+{
+  803580:	55                   	push   %ebp
+  803581:	89 e5                	mov    %esp,%ebp
+  803583:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803586:	6a 00                	push   $0x0
+  803588:	ff 75 10             	push   0x10(%ebp)
+  80358b:	ff 75 0c             	push   0xc(%ebp)
+  80358e:	ff 75 08             	push   0x8(%ebp)
+  803591:	e8 15 ff ff ff       	call   8034ab <ipc_recv_until>
+}
+  803596:	c9                   	leave
+  803597:	c3                   	ret
+
+00803598 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803598:	55                   	push   %ebp
+  803599:	89 e5                	mov    %esp,%ebp
+  80359b:	57                   	push   %edi
+  80359c:	56                   	push   %esi
+  80359d:	53                   	push   %ebx
+  80359e:	83 ec 0c             	sub    $0xc,%esp
+  8035a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035a4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8035a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8035aa:	85 db                	test   %ebx,%ebx
+  8035ac:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8035b1:	0f 44 d8             	cmove  %eax,%ebx
+  8035b4:	eb 05                	jmp    8035bb <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8035b6:	e8 52 da ff ff       	call   80100d <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8035bb:	ff 75 14             	push   0x14(%ebp)
+  8035be:	53                   	push   %ebx
+  8035bf:	56                   	push   %esi
+  8035c0:	57                   	push   %edi
+  8035c1:	e8 ea dd ff ff       	call   8013b0 <sys_ipc_try_send>
+  8035c6:	83 c4 10             	add    $0x10,%esp
+  8035c9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8035cc:	74 e8                	je     8035b6 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8035ce:	85 c0                	test   %eax,%eax
+  8035d0:	78 08                	js     8035da <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8035d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035d5:	5b                   	pop    %ebx
+  8035d6:	5e                   	pop    %esi
+  8035d7:	5f                   	pop    %edi
+  8035d8:	5d                   	pop    %ebp
+  8035d9:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8035da:	50                   	push   %eax
+  8035db:	68 cb 3d 80 00       	push   $0x803dcb
+  8035e0:	6a 4f                	push   $0x4f
+  8035e2:	68 de 3d 80 00       	push   $0x803dde
+  8035e7:	e8 4c ce ff ff       	call   800438 <_panic>
+
+008035ec <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8035ec:	55                   	push   %ebp
+  8035ed:	89 e5                	mov    %esp,%ebp
+  8035ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8035f2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8035f7:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8035fd:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803603:	8b 52 50             	mov    0x50(%edx),%edx
+  803606:	39 ca                	cmp    %ecx,%edx
+  803608:	74 11                	je     80361b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80360a:	83 c0 01             	add    $0x1,%eax
+  80360d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803612:	75 e3                	jne    8035f7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803614:	b8 00 00 00 00       	mov    $0x0,%eax
+  803619:	eb 0e                	jmp    803629 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80361b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803621:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803626:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803629:	5d                   	pop    %ebp
+  80362a:	c3                   	ret
+
+0080362b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80362b:	55                   	push   %ebp
+  80362c:	89 e5                	mov    %esp,%ebp
+  80362e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803631:	89 c2                	mov    %eax,%edx
+  803633:	c1 ea 16             	shr    $0x16,%edx
+  803636:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80363d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803642:	f6 c1 01             	test   $0x1,%cl
+  803645:	74 1a                	je     803661 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803647:	c1 e8 0c             	shr    $0xc,%eax
+  80364a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803651:	a8 01                	test   $0x1,%al
+  803653:	74 0c                	je     803661 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803655:	c1 e8 0c             	shr    $0xc,%eax
+  803658:	c1 e0 04             	shl    $0x4,%eax
+  80365b:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803661:	89 d0                	mov    %edx,%eax
+  803663:	5d                   	pop    %ebp
+  803664:	c3                   	ret
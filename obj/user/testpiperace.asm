@@ -0,0 +1,7224 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 01 00 00       	call   8001f4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 1c             	sub    $0x1c,%esp
+	int p[2], r, pid, i, max;
+	void *va;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for dup race...\n");
+  80003b:	68 a0 34 80 00       	push   $0x8034a0
+  800040:	e8 4e 03 00 00       	call   800393 <cprintf>
+	if ((r = pipe(p)) < 0)
+  800045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800048:	89 04 24             	mov    %eax,(%esp)
+  80004b:	e8 c3 30 00 00       	call   803113 <pipe>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 5f                	js     8000b6 <umain+0x83>
+		panic("pipe: %e", r);
+	max = 200;
+	if ((r = fork()) < 0)
+  800057:	e8 62 1d 00 00       	call   801dbe <fork>
+  80005c:	89 c6                	mov    %eax,%esi
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 66                	js     8000c8 <umain+0x95>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800062:	74 76                	je     8000da <umain+0xa7>
+		}
+		// do something to be not runnable besides exiting
+		ipc_recv(0,0,0);
+	}
+	pid = r;
+	cprintf("pid is %d\n", pid);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	56                   	push   %esi
+  800068:	68 f1 34 80 00       	push   $0x8034f1
+  80006d:	e8 21 03 00 00       	call   800393 <cprintf>
+	va = 0;
+	kid = &envs[ENVX(pid)];
+  800072:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	cprintf("kid is %d\n", kid-envs);
+  800078:	83 c4 08             	add    $0x8,%esp
+  80007b:	69 c6 58 01 00 00    	imul   $0x158,%esi,%eax
+  800081:	c1 f8 03             	sar    $0x3,%eax
+  800084:	69 c0 83 be a0 2f    	imul   $0x2fa0be83,%eax,%eax
+  80008a:	50                   	push   %eax
+  80008b:	68 fc 34 80 00       	push   $0x8034fc
+  800090:	e8 fe 02 00 00       	call   800393 <cprintf>
+	dup(p[0], 10);
+  800095:	83 c4 08             	add    $0x8,%esp
+  800098:	6a 0a                	push   $0xa
+  80009a:	ff 75 f0             	push   -0x10(%ebp)
+  80009d:	e8 48 23 00 00       	call   8023ea <dup>
+	while (kid->env_status == ENV_RUNNABLE)
+  8000a2:	83 c4 10             	add    $0x10,%esp
+  8000a5:	69 de 58 01 00 00    	imul   $0x158,%esi,%ebx
+  8000ab:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000b1:	e9 92 00 00 00       	jmp    800148 <umain+0x115>
+		panic("pipe: %e", r);
+  8000b6:	50                   	push   %eax
+  8000b7:	68 b9 34 80 00       	push   $0x8034b9
+  8000bc:	6a 0d                	push   $0xd
+  8000be:	68 c2 34 80 00       	push   $0x8034c2
+  8000c3:	e8 f0 01 00 00       	call   8002b8 <_panic>
+		panic("fork: %e", r);
+  8000c8:	50                   	push   %eax
+  8000c9:	68 10 3a 80 00       	push   $0x803a10
+  8000ce:	6a 10                	push   $0x10
+  8000d0:	68 c2 34 80 00       	push   $0x8034c2
+  8000d5:	e8 de 01 00 00       	call   8002b8 <_panic>
+		close(p[1]);
+  8000da:	83 ec 0c             	sub    $0xc,%esp
+  8000dd:	ff 75 f4             	push   -0xc(%ebp)
+  8000e0:	e8 b3 22 00 00       	call   802398 <close>
+		for (i=0; i<max; i++) {
+  8000e5:	83 c4 10             	add    $0x10,%esp
+  8000e8:	bb c9 00 00 00       	mov    $0xc9,%ebx
+  8000ed:	eb 05                	jmp    8000f4 <umain+0xc1>
+			sys_yield();
+  8000ef:	e8 99 0d 00 00       	call   800e8d <sys_yield>
+		for (i=0; i<max; i++) {
+  8000f4:	83 eb 01             	sub    $0x1,%ebx
+  8000f7:	74 29                	je     800122 <umain+0xef>
+			if(pipeisclosed(p[0])){
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	ff 75 f0             	push   -0x10(%ebp)
+  8000ff:	e8 59 31 00 00       	call   80325d <pipeisclosed>
+  800104:	83 c4 10             	add    $0x10,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	74 e4                	je     8000ef <umain+0xbc>
+				cprintf("RACE: pipe appears closed\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 d6 34 80 00       	push   $0x8034d6
+  800113:	e8 7b 02 00 00       	call   800393 <cprintf>
+				exit();
+  800118:	e8 81 01 00 00       	call   80029e <exit>
+  80011d:	83 c4 10             	add    $0x10,%esp
+  800120:	eb cd                	jmp    8000ef <umain+0xbc>
+		ipc_recv(0,0,0);
+  800122:	83 ec 04             	sub    $0x4,%esp
+  800125:	6a 00                	push   $0x0
+  800127:	6a 00                	push   $0x0
+  800129:	6a 00                	push   $0x0
+  80012b:	e8 d4 1d 00 00       	call   801f04 <ipc_recv>
+  800130:	83 c4 10             	add    $0x10,%esp
+  800133:	e9 2c ff ff ff       	jmp    800064 <umain+0x31>
+		dup(p[0], 10);
+  800138:	83 ec 08             	sub    $0x8,%esp
+  80013b:	6a 0a                	push   $0xa
+  80013d:	ff 75 f0             	push   -0x10(%ebp)
+  800140:	e8 a5 22 00 00       	call   8023ea <dup>
+  800145:	83 c4 10             	add    $0x10,%esp
+	while (kid->env_status == ENV_RUNNABLE)
+  800148:	8b 43 54             	mov    0x54(%ebx),%eax
+  80014b:	83 f8 02             	cmp    $0x2,%eax
+  80014e:	74 e8                	je     800138 <umain+0x105>
+
+	cprintf("child done with loop\n");
+  800150:	83 ec 0c             	sub    $0xc,%esp
+  800153:	68 07 35 80 00       	push   $0x803507
+  800158:	e8 36 02 00 00       	call   800393 <cprintf>
+	if (pipeisclosed(p[0]))
+  80015d:	83 c4 04             	add    $0x4,%esp
+  800160:	ff 75 f0             	push   -0x10(%ebp)
+  800163:	e8 f5 30 00 00       	call   80325d <pipeisclosed>
+  800168:	83 c4 10             	add    $0x10,%esp
+  80016b:	85 c0                	test   %eax,%eax
+  80016d:	75 48                	jne    8001b7 <umain+0x184>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  80016f:	83 ec 08             	sub    $0x8,%esp
+  800172:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800175:	50                   	push   %eax
+  800176:	ff 75 f0             	push   -0x10(%ebp)
+  800179:	e8 d0 20 00 00       	call   80224e <fd_lookup>
+  80017e:	83 c4 10             	add    $0x10,%esp
+  800181:	85 c0                	test   %eax,%eax
+  800183:	78 46                	js     8001cb <umain+0x198>
+		panic("cannot look up p[0]: %e", r);
+	va = fd2data(fd);
+  800185:	83 ec 0c             	sub    $0xc,%esp
+  800188:	ff 75 ec             	push   -0x14(%ebp)
+  80018b:	e8 51 20 00 00       	call   8021e1 <fd2data>
+	if (pageref(va) != 3+1)
+  800190:	89 04 24             	mov    %eax,(%esp)
+  800193:	e8 a4 28 00 00       	call   802a3c <pageref>
+  800198:	83 c4 10             	add    $0x10,%esp
+  80019b:	83 f8 04             	cmp    $0x4,%eax
+  80019e:	74 3d                	je     8001dd <umain+0x1aa>
+		cprintf("\nchild detected race\n");
+  8001a0:	83 ec 0c             	sub    $0xc,%esp
+  8001a3:	68 35 35 80 00       	push   $0x803535
+  8001a8:	e8 e6 01 00 00       	call   800393 <cprintf>
+  8001ad:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("\nrace didn't happen\n", max);
+}
+  8001b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001b3:	5b                   	pop    %ebx
+  8001b4:	5e                   	pop    %esi
+  8001b5:	5d                   	pop    %ebp
+  8001b6:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001b7:	83 ec 04             	sub    $0x4,%esp
+  8001ba:	68 60 35 80 00       	push   $0x803560
+  8001bf:	6a 3a                	push   $0x3a
+  8001c1:	68 c2 34 80 00       	push   $0x8034c2
+  8001c6:	e8 ed 00 00 00       	call   8002b8 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001cb:	50                   	push   %eax
+  8001cc:	68 1d 35 80 00       	push   $0x80351d
+  8001d1:	6a 3c                	push   $0x3c
+  8001d3:	68 c2 34 80 00       	push   $0x8034c2
+  8001d8:	e8 db 00 00 00       	call   8002b8 <_panic>
+		cprintf("\nrace didn't happen\n", max);
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+  8001e0:	68 c8 00 00 00       	push   $0xc8
+  8001e5:	68 4b 35 80 00       	push   $0x80354b
+  8001ea:	e8 a4 01 00 00       	call   800393 <cprintf>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+}
+  8001f2:	eb bc                	jmp    8001b0 <umain+0x17d>
+
+008001f4 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001f4:	55                   	push   %ebp
+  8001f5:	89 e5                	mov    %esp,%ebp
+  8001f7:	57                   	push   %edi
+  8001f8:	56                   	push   %esi
+  8001f9:	53                   	push   %ebx
+  8001fa:	83 ec 0c             	sub    $0xc,%esp
+  8001fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800200:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800203:	b8 01 00 00 00       	mov    $0x1,%eax
+  800208:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80020a:	c1 ea 0b             	shr    $0xb,%edx
+  80020d:	83 f2 01             	xor    $0x1,%edx
+  800210:	83 e2 01             	and    $0x1,%edx
+  800213:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800219:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800220:	00 00 00 
+	envid = sys_getenvid();
+  800223:	e8 1f 0c 00 00       	call   800e47 <sys_getenvid>
+  800228:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80022a:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80022f:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800235:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80023b:	8b 52 48             	mov    0x48(%edx),%edx
+  80023e:	39 ca                	cmp    %ecx,%edx
+  800240:	74 27                	je     800269 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800242:	83 c0 01             	add    $0x1,%eax
+  800245:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80024a:	75 e3                	jne    80022f <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80024c:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800253:	75 24                	jne    800279 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800255:	83 ec 04             	sub    $0x4,%esp
+  800258:	68 8c 35 80 00       	push   $0x80358c
+  80025d:	6a 23                	push   $0x23
+  80025f:	68 af 35 80 00       	push   $0x8035af
+  800264:	e8 4f 00 00 00       	call   8002b8 <_panic>
+			mainenv = &envs[i];
+  800269:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80026f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800274:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800279:	85 ff                	test   %edi,%edi
+  80027b:	7e 07                	jle    800284 <libmain+0x90>
+		binaryname = argv[0];
+  80027d:	8b 06                	mov    (%esi),%eax
+  80027f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800284:	83 ec 08             	sub    $0x8,%esp
+  800287:	56                   	push   %esi
+  800288:	57                   	push   %edi
+  800289:	e8 a5 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80028e:	e8 0b 00 00 00       	call   80029e <exit>
+}
+  800293:	83 c4 10             	add    $0x10,%esp
+  800296:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800299:	5b                   	pop    %ebx
+  80029a:	5e                   	pop    %esi
+  80029b:	5f                   	pop    %edi
+  80029c:	5d                   	pop    %ebp
+  80029d:	c3                   	ret
+
+0080029e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002a4:	e8 1c 21 00 00       	call   8023c5 <close_all>
+	sys_env_destroy(0);
+  8002a9:	83 ec 0c             	sub    $0xc,%esp
+  8002ac:	6a 00                	push   $0x0
+  8002ae:	e8 2b 0b 00 00       	call   800dde <sys_env_destroy>
+}
+  8002b3:	83 c4 10             	add    $0x10,%esp
+  8002b6:	c9                   	leave
+  8002b7:	c3                   	ret
+
+008002b8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	56                   	push   %esi
+  8002bc:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002bd:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002c0:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002c6:	e8 7c 0b 00 00       	call   800e47 <sys_getenvid>
+  8002cb:	83 ec 0c             	sub    $0xc,%esp
+  8002ce:	ff 75 0c             	push   0xc(%ebp)
+  8002d1:	ff 75 08             	push   0x8(%ebp)
+  8002d4:	56                   	push   %esi
+  8002d5:	50                   	push   %eax
+  8002d6:	68 c8 35 80 00       	push   $0x8035c8
+  8002db:	e8 b3 00 00 00       	call   800393 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002e0:	83 c4 18             	add    $0x18,%esp
+  8002e3:	53                   	push   %ebx
+  8002e4:	ff 75 10             	push   0x10(%ebp)
+  8002e7:	e8 56 00 00 00       	call   800342 <vcprintf>
+	cprintf("\n");
+  8002ec:	c7 04 24 b7 34 80 00 	movl   $0x8034b7,(%esp)
+  8002f3:	e8 9b 00 00 00       	call   800393 <cprintf>
+  8002f8:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002fb:	cc                   	int3
+	while (1)
+  8002fc:	eb fd                	jmp    8002fb <_panic+0x43>
+
+008002fe <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	53                   	push   %ebx
+  800302:	83 ec 04             	sub    $0x4,%esp
+  800305:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800308:	8b 13                	mov    (%ebx),%edx
+  80030a:	8d 42 01             	lea    0x1(%edx),%eax
+  80030d:	89 03                	mov    %eax,(%ebx)
+  80030f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800312:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800316:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80031b:	74 09                	je     800326 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80031d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800326:	83 ec 08             	sub    $0x8,%esp
+  800329:	68 ff 00 00 00       	push   $0xff
+  80032e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800331:	50                   	push   %eax
+  800332:	e8 1d 0a 00 00       	call   800d54 <sys_cputs>
+		b->idx = 0;
+  800337:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80033d:	83 c4 10             	add    $0x10,%esp
+  800340:	eb db                	jmp    80031d <putch+0x1f>
+
+00800342 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800342:	55                   	push   %ebp
+  800343:	89 e5                	mov    %esp,%ebp
+  800345:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80034b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800352:	00 00 00 
+	b.cnt = 0;
+  800355:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80035c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80035f:	ff 75 0c             	push   0xc(%ebp)
+  800362:	ff 75 08             	push   0x8(%ebp)
+  800365:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80036b:	50                   	push   %eax
+  80036c:	68 fe 02 80 00       	push   $0x8002fe
+  800371:	e8 fb 00 00 00       	call   800471 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800376:	83 c4 08             	add    $0x8,%esp
+  800379:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80037f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800385:	50                   	push   %eax
+  800386:	e8 c9 09 00 00       	call   800d54 <sys_cputs>
+
+	return b.cnt;
+}
+  80038b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+00800393 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800399:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80039c:	50                   	push   %eax
+  80039d:	ff 75 08             	push   0x8(%ebp)
+  8003a0:	e8 9d ff ff ff       	call   800342 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+
+008003a7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8003a7:	55                   	push   %ebp
+  8003a8:	89 e5                	mov    %esp,%ebp
+  8003aa:	57                   	push   %edi
+  8003ab:	56                   	push   %esi
+  8003ac:	53                   	push   %ebx
+  8003ad:	83 ec 1c             	sub    $0x1c,%esp
+  8003b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003b3:	89 d6                	mov    %edx,%esi
+  8003b5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8003b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003bb:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8003be:	73 0b                	jae    8003cb <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8003c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003c3:	c1 e7 08             	shl    $0x8,%edi
+  8003c6:	0b 7d 10             	or     0x10(%ebp),%edi
+  8003c9:	eb 36                	jmp    800401 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8003cb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d3:	f7 75 08             	divl   0x8(%ebp)
+  8003d6:	89 c1                	mov    %eax,%ecx
+  8003d8:	ff 75 14             	push   0x14(%ebp)
+  8003db:	ff 75 10             	push   0x10(%ebp)
+  8003de:	83 eb 01             	sub    $0x1,%ebx
+  8003e1:	53                   	push   %ebx
+  8003e2:	ff 75 08             	push   0x8(%ebp)
+  8003e5:	89 f2                	mov    %esi,%edx
+  8003e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003ea:	e8 b8 ff ff ff       	call   8003a7 <printnum>
+  8003ef:	83 c4 10             	add    $0x10,%esp
+  8003f2:	eb 14                	jmp    800408 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8003f4:	83 ec 08             	sub    $0x8,%esp
+  8003f7:	56                   	push   %esi
+  8003f8:	57                   	push   %edi
+  8003f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003fc:	ff d0                	call   *%eax
+  8003fe:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800401:	83 eb 01             	sub    $0x1,%ebx
+  800404:	85 db                	test   %ebx,%ebx
+  800406:	7f ec                	jg     8003f4 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800408:	83 ec 08             	sub    $0x8,%esp
+  80040b:	56                   	push   %esi
+  80040c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80040f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800414:	f7 75 08             	divl   0x8(%ebp)
+  800417:	0f be 92 eb 35 80 00 	movsbl 0x8035eb(%edx),%edx
+  80041e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800421:	c1 e0 08             	shl    $0x8,%eax
+  800424:	09 d0                	or     %edx,%eax
+  800426:	50                   	push   %eax
+  800427:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80042a:	ff d0                	call   *%eax
+}
+  80042c:	83 c4 10             	add    $0x10,%esp
+  80042f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800432:	5b                   	pop    %ebx
+  800433:	5e                   	pop    %esi
+  800434:	5f                   	pop    %edi
+  800435:	5d                   	pop    %ebp
+  800436:	c3                   	ret
+
+00800437 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80043d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800441:	8b 10                	mov    (%eax),%edx
+  800443:	3b 50 04             	cmp    0x4(%eax),%edx
+  800446:	73 0a                	jae    800452 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800448:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80044b:	89 08                	mov    %ecx,(%eax)
+  80044d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800450:	88 02                	mov    %al,(%edx)
+}
+  800452:	5d                   	pop    %ebp
+  800453:	c3                   	ret
+
+00800454 <printfmt>:
+{
+  800454:	55                   	push   %ebp
+  800455:	89 e5                	mov    %esp,%ebp
+  800457:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80045a:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80045d:	50                   	push   %eax
+  80045e:	ff 75 10             	push   0x10(%ebp)
+  800461:	ff 75 0c             	push   0xc(%ebp)
+  800464:	ff 75 08             	push   0x8(%ebp)
+  800467:	e8 05 00 00 00       	call   800471 <vprintfmt>
+}
+  80046c:	83 c4 10             	add    $0x10,%esp
+  80046f:	c9                   	leave
+  800470:	c3                   	ret
+
+00800471 <vprintfmt>:
+{
+  800471:	55                   	push   %ebp
+  800472:	89 e5                	mov    %esp,%ebp
+  800474:	57                   	push   %edi
+  800475:	56                   	push   %esi
+  800476:	53                   	push   %ebx
+  800477:	83 ec 3c             	sub    $0x3c,%esp
+  80047a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80047d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800480:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800487:	eb 16                	jmp    80049f <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800489:	83 ec 08             	sub    $0x8,%esp
+  80048c:	ff 75 0c             	push   0xc(%ebp)
+  80048f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800492:	c1 e2 08             	shl    $0x8,%edx
+  800495:	09 d0                	or     %edx,%eax
+  800497:	50                   	push   %eax
+  800498:	ff d7                	call   *%edi
+  80049a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80049d:	89 de                	mov    %ebx,%esi
+  80049f:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8004a2:	0f b6 06             	movzbl (%esi),%eax
+  8004a5:	83 f8 25             	cmp    $0x25,%eax
+  8004a8:	74 0c                	je     8004b6 <vprintfmt+0x45>
+			if (ch == '\0')
+  8004aa:	85 c0                	test   %eax,%eax
+  8004ac:	75 db                	jne    800489 <vprintfmt+0x18>
+}
+  8004ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b1:	5b                   	pop    %ebx
+  8004b2:	5e                   	pop    %esi
+  8004b3:	5f                   	pop    %edi
+  8004b4:	5d                   	pop    %ebp
+  8004b5:	c3                   	ret
+		padc = ' ';
+  8004b6:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8004ba:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004c1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004c8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d4:	8d 73 01             	lea    0x1(%ebx),%esi
+  8004d7:	0f b6 13             	movzbl (%ebx),%edx
+  8004da:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004dd:	3c 55                	cmp    $0x55,%al
+  8004df:	0f 87 2c 04 00 00    	ja     800911 <vprintfmt+0x4a0>
+  8004e5:	0f b6 c0             	movzbl %al,%eax
+  8004e8:	ff 24 85 40 37 80 00 	jmp    *0x803740(,%eax,4)
+  8004ef:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8004f1:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8004f5:	eb dd                	jmp    8004d4 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f7:	89 f3                	mov    %esi,%ebx
+  8004f9:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8004fd:	eb d5                	jmp    8004d4 <vprintfmt+0x63>
+  8004ff:	0f b6 d2             	movzbl %dl,%edx
+  800502:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800504:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800509:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80050c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800510:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800513:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800516:	83 fe 09             	cmp    $0x9,%esi
+  800519:	0f 87 8a 00 00 00    	ja     8005a9 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80051f:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800522:	eb e5                	jmp    800509 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800524:	8b 45 14             	mov    0x14(%ebp),%eax
+  800527:	8b 00                	mov    (%eax),%eax
+  800529:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80052c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052f:	8d 40 04             	lea    0x4(%eax),%eax
+  800532:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800535:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800537:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80053b:	79 97                	jns    8004d4 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80053d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800540:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800543:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80054a:	eb 88                	jmp    8004d4 <vprintfmt+0x63>
+			if (width < 0)
+  80054c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80054f:	85 db                	test   %ebx,%ebx
+  800551:	b8 00 00 00 00       	mov    $0x0,%eax
+  800556:	0f 49 c3             	cmovns %ebx,%eax
+  800559:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80055c:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80055e:	e9 71 ff ff ff       	jmp    8004d4 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800563:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800565:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80056c:	e9 63 ff ff ff       	jmp    8004d4 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800571:	8d 73 02             	lea    0x2(%ebx),%esi
+  800574:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800578:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80057f:	3c 67                	cmp    $0x67,%al
+  800581:	0f 84 18 ff ff ff    	je     80049f <vprintfmt+0x2e>
+					attrib = 0x04;
+  800587:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80058e:	3c 72                	cmp    $0x72,%al
+  800590:	0f 84 09 ff ff ff    	je     80049f <vprintfmt+0x2e>
+					attrib = 0x00;
+  800596:	3c 62                	cmp    $0x62,%al
+  800598:	0f 94 c0             	sete   %al
+  80059b:	0f b6 c0             	movzbl %al,%eax
+  80059e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8005a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005a4:	e9 f6 fe ff ff       	jmp    80049f <vprintfmt+0x2e>
+  8005a9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ac:	eb 89                	jmp    800537 <vprintfmt+0xc6>
+			lflag++;
+  8005ae:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b1:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005b3:	e9 1c ff ff ff       	jmp    8004d4 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8d 58 04             	lea    0x4(%eax),%ebx
+  8005be:	83 ec 08             	sub    $0x8,%esp
+  8005c1:	ff 75 0c             	push   0xc(%ebp)
+  8005c4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005c7:	c1 e0 08             	shl    $0x8,%eax
+  8005ca:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005cd:	0b 01                	or     (%ecx),%eax
+  8005cf:	50                   	push   %eax
+  8005d0:	ff d7                	call   *%edi
+			break;
+  8005d2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005d5:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8005d8:	e9 c2 fe ff ff       	jmp    80049f <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8005e3:	8b 10                	mov    (%eax),%edx
+  8005e5:	89 d0                	mov    %edx,%eax
+  8005e7:	f7 d8                	neg    %eax
+  8005e9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005ec:	83 f8 12             	cmp    $0x12,%eax
+  8005ef:	7f 25                	jg     800616 <vprintfmt+0x1a5>
+  8005f1:	8b 14 85 a0 38 80 00 	mov    0x8038a0(,%eax,4),%edx
+  8005f8:	85 d2                	test   %edx,%edx
+  8005fa:	74 1a                	je     800616 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8005fc:	52                   	push   %edx
+  8005fd:	68 e2 39 80 00       	push   $0x8039e2
+  800602:	ff 75 0c             	push   0xc(%ebp)
+  800605:	57                   	push   %edi
+  800606:	e8 49 fe ff ff       	call   800454 <printfmt>
+  80060b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80060e:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800611:	e9 89 fe ff ff       	jmp    80049f <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800616:	50                   	push   %eax
+  800617:	68 03 36 80 00       	push   $0x803603
+  80061c:	ff 75 0c             	push   0xc(%ebp)
+  80061f:	57                   	push   %edi
+  800620:	e8 2f fe ff ff       	call   800454 <printfmt>
+  800625:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800628:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80062b:	e9 6f fe ff ff       	jmp    80049f <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	83 c0 04             	add    $0x4,%eax
+  800636:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800639:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063c:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80063e:	85 c9                	test   %ecx,%ecx
+  800640:	b8 fc 35 80 00       	mov    $0x8035fc,%eax
+  800645:	0f 45 c1             	cmovne %ecx,%eax
+  800648:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80064b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80064f:	7e 06                	jle    800657 <vprintfmt+0x1e6>
+  800651:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800655:	75 1a                	jne    800671 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800657:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80065a:	c1 e0 08             	shl    $0x8,%eax
+  80065d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800660:	83 c8 3f             	or     $0x3f,%eax
+  800663:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800666:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800669:	89 75 10             	mov    %esi,0x10(%ebp)
+  80066c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80066f:	eb 6d                	jmp    8006de <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	ff 75 d0             	push   -0x30(%ebp)
+  800677:	ff 75 c8             	push   -0x38(%ebp)
+  80067a:	e8 39 03 00 00       	call   8009b8 <strnlen>
+  80067f:	89 c2                	mov    %eax,%edx
+  800681:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800684:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800686:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800689:	c1 e1 08             	shl    $0x8,%ecx
+  80068c:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800690:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800692:	83 c4 10             	add    $0x10,%esp
+  800695:	89 c3                	mov    %eax,%ebx
+  800697:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80069a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80069d:	89 ce                	mov    %ecx,%esi
+  80069f:	eb 0f                	jmp    8006b0 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8006a1:	83 ec 08             	sub    $0x8,%esp
+  8006a4:	ff 75 0c             	push   0xc(%ebp)
+  8006a7:	56                   	push   %esi
+  8006a8:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006aa:	83 eb 01             	sub    $0x1,%ebx
+  8006ad:	83 c4 10             	add    $0x10,%esp
+  8006b0:	85 db                	test   %ebx,%ebx
+  8006b2:	7f ed                	jg     8006a1 <vprintfmt+0x230>
+  8006b4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006b7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006ba:	85 c0                	test   %eax,%eax
+  8006bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006c1:	0f 49 d0             	cmovns %eax,%edx
+  8006c4:	29 d0                	sub    %edx,%eax
+  8006c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006c9:	eb 8c                	jmp    800657 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8006cb:	83 ec 08             	sub    $0x8,%esp
+  8006ce:	ff 75 0c             	push   0xc(%ebp)
+  8006d1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006d4:	09 c2                	or     %eax,%edx
+  8006d6:	52                   	push   %edx
+  8006d7:	ff d7                	call   *%edi
+  8006d9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006dc:	89 d9                	mov    %ebx,%ecx
+  8006de:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8006e1:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8006e5:	0f be d0             	movsbl %al,%edx
+  8006e8:	85 d2                	test   %edx,%edx
+  8006ea:	74 2a                	je     800716 <vprintfmt+0x2a5>
+  8006ec:	85 f6                	test   %esi,%esi
+  8006ee:	78 05                	js     8006f5 <vprintfmt+0x284>
+  8006f0:	83 ee 01             	sub    $0x1,%esi
+  8006f3:	78 3b                	js     800730 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006f5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006f9:	74 d0                	je     8006cb <vprintfmt+0x25a>
+  8006fb:	0f be c0             	movsbl %al,%eax
+  8006fe:	83 e8 20             	sub    $0x20,%eax
+  800701:	83 f8 5e             	cmp    $0x5e,%eax
+  800704:	76 c5                	jbe    8006cb <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	ff 75 0c             	push   0xc(%ebp)
+  80070c:	ff 75 cc             	push   -0x34(%ebp)
+  80070f:	ff d7                	call   *%edi
+  800711:	83 c4 10             	add    $0x10,%esp
+  800714:	eb c6                	jmp    8006dc <vprintfmt+0x26b>
+  800716:	8b 75 10             	mov    0x10(%ebp),%esi
+  800719:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80071c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80071f:	01 c3                	add    %eax,%ebx
+  800721:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800723:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800726:	83 c8 20             	or     $0x20,%eax
+  800729:	89 75 10             	mov    %esi,0x10(%ebp)
+  80072c:	89 c6                	mov    %eax,%esi
+  80072e:	eb 14                	jmp    800744 <vprintfmt+0x2d3>
+  800730:	8b 75 10             	mov    0x10(%ebp),%esi
+  800733:	eb e4                	jmp    800719 <vprintfmt+0x2a8>
+  800735:	83 ec 08             	sub    $0x8,%esp
+  800738:	ff 75 0c             	push   0xc(%ebp)
+  80073b:	56                   	push   %esi
+  80073c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80073e:	83 eb 01             	sub    $0x1,%ebx
+  800741:	83 c4 10             	add    $0x10,%esp
+  800744:	85 db                	test   %ebx,%ebx
+  800746:	7f ed                	jg     800735 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800748:	8b 75 10             	mov    0x10(%ebp),%esi
+  80074b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80074e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800751:	e9 49 fd ff ff       	jmp    80049f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800756:	83 f9 01             	cmp    $0x1,%ecx
+  800759:	7f 1f                	jg     80077a <vprintfmt+0x309>
+	else if (lflag)
+  80075b:	85 c9                	test   %ecx,%ecx
+  80075d:	74 69                	je     8007c8 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	8b 00                	mov    (%eax),%eax
+  800764:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800767:	89 c1                	mov    %eax,%ecx
+  800769:	c1 f9 1f             	sar    $0x1f,%ecx
+  80076c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80076f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800772:	8d 40 04             	lea    0x4(%eax),%eax
+  800775:	89 45 14             	mov    %eax,0x14(%ebp)
+  800778:	eb 17                	jmp    800791 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 50 04             	mov    0x4(%eax),%edx
+  800780:	8b 00                	mov    (%eax),%eax
+  800782:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800785:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8d 40 08             	lea    0x8(%eax),%eax
+  80078e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800791:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800794:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800797:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80079c:	85 db                	test   %ebx,%ebx
+  80079e:	0f 89 f6 00 00 00    	jns    80089a <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8007a4:	83 ec 08             	sub    $0x8,%esp
+  8007a7:	ff 75 0c             	push   0xc(%ebp)
+  8007aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007ad:	c1 e0 08             	shl    $0x8,%eax
+  8007b0:	83 c8 2d             	or     $0x2d,%eax
+  8007b3:	50                   	push   %eax
+  8007b4:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8007b6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007b9:	f7 d9                	neg    %ecx
+  8007bb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007be:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8007c3:	e9 d2 00 00 00       	jmp    80089a <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8007c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cb:	8b 00                	mov    (%eax),%eax
+  8007cd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007d0:	89 c1                	mov    %eax,%ecx
+  8007d2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007d5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007db:	8d 40 04             	lea    0x4(%eax),%eax
+  8007de:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e1:	eb ae                	jmp    800791 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8007e3:	83 f9 01             	cmp    $0x1,%ecx
+  8007e6:	7f 19                	jg     800801 <vprintfmt+0x390>
+	else if (lflag)
+  8007e8:	85 c9                	test   %ecx,%ecx
+  8007ea:	74 2a                	je     800816 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8007ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ef:	8b 08                	mov    (%eax),%ecx
+  8007f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8007fc:	e9 99 00 00 00       	jmp    80089a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800801:	8b 45 14             	mov    0x14(%ebp),%eax
+  800804:	8b 08                	mov    (%eax),%ecx
+  800806:	8d 40 08             	lea    0x8(%eax),%eax
+  800809:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80080c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800811:	e9 84 00 00 00       	jmp    80089a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800816:	8b 45 14             	mov    0x14(%ebp),%eax
+  800819:	8b 08                	mov    (%eax),%ecx
+  80081b:	8d 40 04             	lea    0x4(%eax),%eax
+  80081e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800821:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800826:	eb 72                	jmp    80089a <vprintfmt+0x429>
+	if (lflag >= 2)
+  800828:	83 f9 01             	cmp    $0x1,%ecx
+  80082b:	7f 16                	jg     800843 <vprintfmt+0x3d2>
+	else if (lflag)
+  80082d:	85 c9                	test   %ecx,%ecx
+  80082f:	74 24                	je     800855 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800831:	8b 45 14             	mov    0x14(%ebp),%eax
+  800834:	8b 08                	mov    (%eax),%ecx
+  800836:	8d 40 04             	lea    0x4(%eax),%eax
+  800839:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80083c:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800841:	eb 57                	jmp    80089a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800843:	8b 45 14             	mov    0x14(%ebp),%eax
+  800846:	8b 08                	mov    (%eax),%ecx
+  800848:	8d 40 08             	lea    0x8(%eax),%eax
+  80084b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80084e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800853:	eb 45                	jmp    80089a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800855:	8b 45 14             	mov    0x14(%ebp),%eax
+  800858:	8b 08                	mov    (%eax),%ecx
+  80085a:	8d 40 04             	lea    0x4(%eax),%eax
+  80085d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800860:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800865:	eb 33                	jmp    80089a <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800867:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80086a:	c1 e3 08             	shl    $0x8,%ebx
+  80086d:	83 ec 08             	sub    $0x8,%esp
+  800870:	ff 75 0c             	push   0xc(%ebp)
+  800873:	89 d8                	mov    %ebx,%eax
+  800875:	83 c8 30             	or     $0x30,%eax
+  800878:	50                   	push   %eax
+  800879:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80087b:	83 c4 08             	add    $0x8,%esp
+  80087e:	ff 75 0c             	push   0xc(%ebp)
+  800881:	83 cb 78             	or     $0x78,%ebx
+  800884:	53                   	push   %ebx
+  800885:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800887:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088a:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80088c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80088f:	8d 40 04             	lea    0x4(%eax),%eax
+  800892:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800895:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80089a:	ff 75 e4             	push   -0x1c(%ebp)
+  80089d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8008a1:	52                   	push   %edx
+  8008a2:	ff 75 e0             	push   -0x20(%ebp)
+  8008a5:	50                   	push   %eax
+  8008a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a9:	89 f8                	mov    %edi,%eax
+  8008ab:	e8 f7 fa ff ff       	call   8003a7 <printnum>
+			break;
+  8008b0:	83 c4 10             	add    $0x10,%esp
+  8008b3:	e9 e7 fb ff ff       	jmp    80049f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008b8:	83 f9 01             	cmp    $0x1,%ecx
+  8008bb:	7f 16                	jg     8008d3 <vprintfmt+0x462>
+	else if (lflag)
+  8008bd:	85 c9                	test   %ecx,%ecx
+  8008bf:	74 24                	je     8008e5 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8008c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c4:	8b 08                	mov    (%eax),%ecx
+  8008c6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008cc:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8008d1:	eb c7                	jmp    80089a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d6:	8b 08                	mov    (%eax),%ecx
+  8008d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8008db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008de:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8008e3:	eb b5                	jmp    80089a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e8:	8b 08                	mov    (%eax),%ecx
+  8008ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f0:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8008f5:	eb a3                	jmp    80089a <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8008f7:	83 ec 08             	sub    $0x8,%esp
+  8008fa:	ff 75 0c             	push   0xc(%ebp)
+  8008fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800900:	c1 e0 08             	shl    $0x8,%eax
+  800903:	83 c8 25             	or     $0x25,%eax
+  800906:	50                   	push   %eax
+  800907:	ff d7                	call   *%edi
+			break;
+  800909:	83 c4 10             	add    $0x10,%esp
+  80090c:	e9 8e fb ff ff       	jmp    80049f <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800911:	83 ec 08             	sub    $0x8,%esp
+  800914:	ff 75 0c             	push   0xc(%ebp)
+  800917:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80091a:	c1 e0 08             	shl    $0x8,%eax
+  80091d:	83 c8 25             	or     $0x25,%eax
+  800920:	50                   	push   %eax
+  800921:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800923:	83 c4 10             	add    $0x10,%esp
+  800926:	89 de                	mov    %ebx,%esi
+  800928:	eb 03                	jmp    80092d <vprintfmt+0x4bc>
+  80092a:	83 ee 01             	sub    $0x1,%esi
+  80092d:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800931:	75 f7                	jne    80092a <vprintfmt+0x4b9>
+  800933:	e9 67 fb ff ff       	jmp    80049f <vprintfmt+0x2e>
+
+00800938 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	83 ec 18             	sub    $0x18,%esp
+  80093e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800941:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800944:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800947:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80094b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80094e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800955:	85 c0                	test   %eax,%eax
+  800957:	74 26                	je     80097f <vsnprintf+0x47>
+  800959:	85 d2                	test   %edx,%edx
+  80095b:	7e 22                	jle    80097f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80095d:	ff 75 14             	push   0x14(%ebp)
+  800960:	ff 75 10             	push   0x10(%ebp)
+  800963:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800966:	50                   	push   %eax
+  800967:	68 37 04 80 00       	push   $0x800437
+  80096c:	e8 00 fb ff ff       	call   800471 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800971:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800974:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800977:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80097a:	83 c4 10             	add    $0x10,%esp
+}
+  80097d:	c9                   	leave
+  80097e:	c3                   	ret
+		return -E_INVAL;
+  80097f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800984:	eb f7                	jmp    80097d <vsnprintf+0x45>
+
+00800986 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80098c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80098f:	50                   	push   %eax
+  800990:	ff 75 10             	push   0x10(%ebp)
+  800993:	ff 75 0c             	push   0xc(%ebp)
+  800996:	ff 75 08             	push   0x8(%ebp)
+  800999:	e8 9a ff ff ff       	call   800938 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80099e:	c9                   	leave
+  80099f:	c3                   	ret
+
+008009a0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ab:	eb 03                	jmp    8009b0 <strlen+0x10>
+		n++;
+  8009ad:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009b0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009b4:	75 f7                	jne    8009ad <strlen+0xd>
+	return n;
+}
+  8009b6:	5d                   	pop    %ebp
+  8009b7:	c3                   	ret
+
+008009b8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c6:	eb 03                	jmp    8009cb <strnlen+0x13>
+		n++;
+  8009c8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009cb:	39 d0                	cmp    %edx,%eax
+  8009cd:	74 08                	je     8009d7 <strnlen+0x1f>
+  8009cf:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009d3:	75 f3                	jne    8009c8 <strnlen+0x10>
+  8009d5:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009d7:	89 d0                	mov    %edx,%eax
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	53                   	push   %ebx
+  8009df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ea:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009ee:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009f1:	83 c0 01             	add    $0x1,%eax
+  8009f4:	84 d2                	test   %dl,%dl
+  8009f6:	75 f2                	jne    8009ea <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009f8:	89 c8                	mov    %ecx,%eax
+  8009fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009fd:	c9                   	leave
+  8009fe:	c3                   	ret
+
+008009ff <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	53                   	push   %ebx
+  800a03:	83 ec 10             	sub    $0x10,%esp
+  800a06:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a09:	53                   	push   %ebx
+  800a0a:	e8 91 ff ff ff       	call   8009a0 <strlen>
+  800a0f:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a12:	ff 75 0c             	push   0xc(%ebp)
+  800a15:	01 d8                	add    %ebx,%eax
+  800a17:	50                   	push   %eax
+  800a18:	e8 be ff ff ff       	call   8009db <strcpy>
+	return dst;
+}
+  800a1d:	89 d8                	mov    %ebx,%eax
+  800a1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a22:	c9                   	leave
+  800a23:	c3                   	ret
+
+00800a24 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a24:	55                   	push   %ebp
+  800a25:	89 e5                	mov    %esp,%ebp
+  800a27:	56                   	push   %esi
+  800a28:	53                   	push   %ebx
+  800a29:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a2f:	89 f3                	mov    %esi,%ebx
+  800a31:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a34:	89 f0                	mov    %esi,%eax
+  800a36:	eb 0f                	jmp    800a47 <strncpy+0x23>
+		*dst++ = *src;
+  800a38:	83 c0 01             	add    $0x1,%eax
+  800a3b:	0f b6 0a             	movzbl (%edx),%ecx
+  800a3e:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a41:	80 f9 01             	cmp    $0x1,%cl
+  800a44:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a47:	39 d8                	cmp    %ebx,%eax
+  800a49:	75 ed                	jne    800a38 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a4b:	89 f0                	mov    %esi,%eax
+  800a4d:	5b                   	pop    %ebx
+  800a4e:	5e                   	pop    %esi
+  800a4f:	5d                   	pop    %ebp
+  800a50:	c3                   	ret
+
+00800a51 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	56                   	push   %esi
+  800a55:	53                   	push   %ebx
+  800a56:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a5c:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a5f:	89 f0                	mov    %esi,%eax
+  800a61:	85 d2                	test   %edx,%edx
+  800a63:	74 21                	je     800a86 <strlcpy+0x35>
+  800a65:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a69:	89 f2                	mov    %esi,%edx
+  800a6b:	eb 09                	jmp    800a76 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a6d:	83 c1 01             	add    $0x1,%ecx
+  800a70:	83 c2 01             	add    $0x1,%edx
+  800a73:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a76:	39 c2                	cmp    %eax,%edx
+  800a78:	74 09                	je     800a83 <strlcpy+0x32>
+  800a7a:	0f b6 19             	movzbl (%ecx),%ebx
+  800a7d:	84 db                	test   %bl,%bl
+  800a7f:	75 ec                	jne    800a6d <strlcpy+0x1c>
+  800a81:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a83:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a86:	29 f0                	sub    %esi,%eax
+}
+  800a88:	5b                   	pop    %ebx
+  800a89:	5e                   	pop    %esi
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a92:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a95:	eb 06                	jmp    800a9d <strcmp+0x11>
+		p++, q++;
+  800a97:	83 c1 01             	add    $0x1,%ecx
+  800a9a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a9d:	0f b6 01             	movzbl (%ecx),%eax
+  800aa0:	84 c0                	test   %al,%al
+  800aa2:	74 04                	je     800aa8 <strcmp+0x1c>
+  800aa4:	3a 02                	cmp    (%edx),%al
+  800aa6:	74 ef                	je     800a97 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aa8:	0f b6 c0             	movzbl %al,%eax
+  800aab:	0f b6 12             	movzbl (%edx),%edx
+  800aae:	29 d0                	sub    %edx,%eax
+}
+  800ab0:	5d                   	pop    %ebp
+  800ab1:	c3                   	ret
+
+00800ab2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ab2:	55                   	push   %ebp
+  800ab3:	89 e5                	mov    %esp,%ebp
+  800ab5:	53                   	push   %ebx
+  800ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800abc:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800abf:	eb 09                	jmp    800aca <strncmp+0x18>
+		n--, p++, q++;
+  800ac1:	83 ea 01             	sub    $0x1,%edx
+  800ac4:	83 c0 01             	add    $0x1,%eax
+  800ac7:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800aca:	85 d2                	test   %edx,%edx
+  800acc:	74 18                	je     800ae6 <strncmp+0x34>
+  800ace:	0f b6 18             	movzbl (%eax),%ebx
+  800ad1:	84 db                	test   %bl,%bl
+  800ad3:	74 04                	je     800ad9 <strncmp+0x27>
+  800ad5:	3a 19                	cmp    (%ecx),%bl
+  800ad7:	74 e8                	je     800ac1 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ad9:	0f b6 00             	movzbl (%eax),%eax
+  800adc:	0f b6 11             	movzbl (%ecx),%edx
+  800adf:	29 d0                	sub    %edx,%eax
+}
+  800ae1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae4:	c9                   	leave
+  800ae5:	c3                   	ret
+		return 0;
+  800ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aeb:	eb f4                	jmp    800ae1 <strncmp+0x2f>
+
+00800aed <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800af7:	eb 03                	jmp    800afc <strchr+0xf>
+  800af9:	83 c0 01             	add    $0x1,%eax
+  800afc:	0f b6 10             	movzbl (%eax),%edx
+  800aff:	84 d2                	test   %dl,%dl
+  800b01:	74 06                	je     800b09 <strchr+0x1c>
+		if (*s == c)
+  800b03:	38 ca                	cmp    %cl,%dl
+  800b05:	75 f2                	jne    800af9 <strchr+0xc>
+  800b07:	eb 05                	jmp    800b0e <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b0e:	5d                   	pop    %ebp
+  800b0f:	c3                   	ret
+
+00800b10 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b1a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b1d:	38 ca                	cmp    %cl,%dl
+  800b1f:	74 09                	je     800b2a <strfind+0x1a>
+  800b21:	84 d2                	test   %dl,%dl
+  800b23:	74 05                	je     800b2a <strfind+0x1a>
+	for (; *s; s++)
+  800b25:	83 c0 01             	add    $0x1,%eax
+  800b28:	eb f0                	jmp    800b1a <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b2a:	5d                   	pop    %ebp
+  800b2b:	c3                   	ret
+
+00800b2c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b2c:	55                   	push   %ebp
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	57                   	push   %edi
+  800b30:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b33:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b36:	85 c9                	test   %ecx,%ecx
+  800b38:	74 20                	je     800b5a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b3a:	89 f8                	mov    %edi,%eax
+  800b3c:	09 c8                	or     %ecx,%eax
+  800b3e:	a8 03                	test   $0x3,%al
+  800b40:	75 12                	jne    800b54 <memset+0x28>
+		c &= 0xFF;
+  800b42:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b46:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b4c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b4f:	fc                   	cld
+  800b50:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b52:	eb 06                	jmp    800b5a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b57:	fc                   	cld
+  800b58:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b5a:	89 f8                	mov    %edi,%eax
+  800b5c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b5f:	c9                   	leave
+  800b60:	c3                   	ret
+
+00800b61 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	57                   	push   %edi
+  800b65:	56                   	push   %esi
+  800b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b69:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b6c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b6f:	39 c6                	cmp    %eax,%esi
+  800b71:	73 32                	jae    800ba5 <memmove+0x44>
+  800b73:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b76:	39 d0                	cmp    %edx,%eax
+  800b78:	73 2b                	jae    800ba5 <memmove+0x44>
+		s += n;
+		d += n;
+  800b7a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b7d:	89 d6                	mov    %edx,%esi
+  800b7f:	09 fe                	or     %edi,%esi
+  800b81:	09 ce                	or     %ecx,%esi
+  800b83:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b89:	75 0e                	jne    800b99 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b8b:	83 ef 04             	sub    $0x4,%edi
+  800b8e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b91:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b94:	fd                   	std
+  800b95:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b97:	eb 09                	jmp    800ba2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b99:	83 ef 01             	sub    $0x1,%edi
+  800b9c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b9f:	fd                   	std
+  800ba0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ba2:	fc                   	cld
+  800ba3:	eb 1a                	jmp    800bbf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ba5:	89 f2                	mov    %esi,%edx
+  800ba7:	09 c2                	or     %eax,%edx
+  800ba9:	09 ca                	or     %ecx,%edx
+  800bab:	f6 c2 03             	test   $0x3,%dl
+  800bae:	75 0a                	jne    800bba <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bb0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bb3:	89 c7                	mov    %eax,%edi
+  800bb5:	fc                   	cld
+  800bb6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb8:	eb 05                	jmp    800bbf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bba:	89 c7                	mov    %eax,%edi
+  800bbc:	fc                   	cld
+  800bbd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bbf:	5e                   	pop    %esi
+  800bc0:	5f                   	pop    %edi
+  800bc1:	5d                   	pop    %ebp
+  800bc2:	c3                   	ret
+
+00800bc3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bc9:	ff 75 10             	push   0x10(%ebp)
+  800bcc:	ff 75 0c             	push   0xc(%ebp)
+  800bcf:	ff 75 08             	push   0x8(%ebp)
+  800bd2:	e8 8a ff ff ff       	call   800b61 <memmove>
+}
+  800bd7:	c9                   	leave
+  800bd8:	c3                   	ret
+
+00800bd9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	56                   	push   %esi
+  800bdd:	53                   	push   %ebx
+  800bde:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800be4:	89 c6                	mov    %eax,%esi
+  800be6:	03 75 10             	add    0x10(%ebp),%esi
+  800be9:	eb 06                	jmp    800bf1 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800beb:	83 c0 01             	add    $0x1,%eax
+  800bee:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bf1:	39 f0                	cmp    %esi,%eax
+  800bf3:	74 14                	je     800c09 <memcmp+0x30>
+		if (*s1 != *s2)
+  800bf5:	0f b6 08             	movzbl (%eax),%ecx
+  800bf8:	0f b6 1a             	movzbl (%edx),%ebx
+  800bfb:	38 d9                	cmp    %bl,%cl
+  800bfd:	74 ec                	je     800beb <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bff:	0f b6 c1             	movzbl %cl,%eax
+  800c02:	0f b6 db             	movzbl %bl,%ebx
+  800c05:	29 d8                	sub    %ebx,%eax
+  800c07:	eb 05                	jmp    800c0e <memcmp+0x35>
+	}
+
+	return 0;
+  800c09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c0e:	5b                   	pop    %ebx
+  800c0f:	5e                   	pop    %esi
+  800c10:	5d                   	pop    %ebp
+  800c11:	c3                   	ret
+
+00800c12 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c12:	55                   	push   %ebp
+  800c13:	89 e5                	mov    %esp,%ebp
+  800c15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c1b:	89 c2                	mov    %eax,%edx
+  800c1d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c20:	eb 03                	jmp    800c25 <memfind+0x13>
+  800c22:	83 c0 01             	add    $0x1,%eax
+  800c25:	39 d0                	cmp    %edx,%eax
+  800c27:	73 04                	jae    800c2d <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c29:	38 08                	cmp    %cl,(%eax)
+  800c2b:	75 f5                	jne    800c22 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c2d:	5d                   	pop    %ebp
+  800c2e:	c3                   	ret
+
+00800c2f <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	57                   	push   %edi
+  800c33:	56                   	push   %esi
+  800c34:	53                   	push   %ebx
+  800c35:	83 ec 1c             	sub    $0x1c,%esp
+  800c38:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c3b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c3e:	eb 03                	jmp    800c43 <strtol+0x14>
+		s++;
+  800c40:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c43:	0f b6 06             	movzbl (%esi),%eax
+  800c46:	3c 20                	cmp    $0x20,%al
+  800c48:	74 f6                	je     800c40 <strtol+0x11>
+  800c4a:	3c 09                	cmp    $0x9,%al
+  800c4c:	74 f2                	je     800c40 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c4e:	3c 2b                	cmp    $0x2b,%al
+  800c50:	74 43                	je     800c95 <strtol+0x66>
+	int neg = 0;
+  800c52:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c57:	3c 2d                	cmp    $0x2d,%al
+  800c59:	74 44                	je     800c9f <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c5b:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c61:	75 0f                	jne    800c72 <strtol+0x43>
+  800c63:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c66:	74 41                	je     800ca9 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c68:	85 ff                	test   %edi,%edi
+  800c6a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c6f:	0f 44 f8             	cmove  %eax,%edi
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c7c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c7f:	89 fb                	mov    %edi,%ebx
+  800c81:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c84:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c87:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c8a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c8d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c90:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c93:	eb 67                	jmp    800cfc <strtol+0xcd>
+		s++;
+  800c95:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9d:	eb bc                	jmp    800c5b <strtol+0x2c>
+		s++, neg = 1;
+  800c9f:	83 c6 01             	add    $0x1,%esi
+  800ca2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ca7:	eb b2                	jmp    800c5b <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca9:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800cad:	74 0e                	je     800cbd <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800caf:	85 ff                	test   %edi,%edi
+  800cb1:	75 bf                	jne    800c72 <strtol+0x43>
+		s++, base = 8;
+  800cb3:	83 c6 01             	add    $0x1,%esi
+  800cb6:	bf 08 00 00 00       	mov    $0x8,%edi
+  800cbb:	eb b5                	jmp    800c72 <strtol+0x43>
+		s += 2, base = 16;
+  800cbd:	83 c6 02             	add    $0x2,%esi
+  800cc0:	bf 10 00 00 00       	mov    $0x10,%edi
+  800cc5:	eb ab                	jmp    800c72 <strtol+0x43>
+			dig = *s - '0';
+  800cc7:	0f be c9             	movsbl %cl,%ecx
+  800cca:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800ccd:	39 f9                	cmp    %edi,%ecx
+  800ccf:	7d 59                	jge    800d2a <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800cd1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800cd5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cd8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cdb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cde:	0f af d8             	imul   %eax,%ebx
+  800ce1:	0f af d7             	imul   %edi,%edx
+  800ce4:	01 d3                	add    %edx,%ebx
+  800ce6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ce9:	f7 e7                	mul    %edi
+  800ceb:	01 da                	add    %ebx,%edx
+  800ced:	89 cb                	mov    %ecx,%ebx
+  800cef:	c1 fb 1f             	sar    $0x1f,%ebx
+  800cf2:	01 c8                	add    %ecx,%eax
+  800cf4:	11 da                	adc    %ebx,%edx
+  800cf6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800cf9:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cff:	0f b6 08             	movzbl (%eax),%ecx
+  800d02:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800d05:	80 fb 09             	cmp    $0x9,%bl
+  800d08:	76 bd                	jbe    800cc7 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800d0a:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800d0d:	80 fb 19             	cmp    $0x19,%bl
+  800d10:	77 08                	ja     800d1a <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800d12:	0f be c9             	movsbl %cl,%ecx
+  800d15:	83 e9 57             	sub    $0x57,%ecx
+  800d18:	eb b3                	jmp    800ccd <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d1a:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800d1d:	80 fb 19             	cmp    $0x19,%bl
+  800d20:	77 08                	ja     800d2a <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800d22:	0f be c9             	movsbl %cl,%ecx
+  800d25:	83 e9 37             	sub    $0x37,%ecx
+  800d28:	eb a3                	jmp    800ccd <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d2a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d2d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d30:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d33:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d36:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d3a:	74 05                	je     800d41 <strtol+0x112>
+		*endptr = (char *) s;
+  800d3c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d3f:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d41:	85 c9                	test   %ecx,%ecx
+  800d43:	74 07                	je     800d4c <strtol+0x11d>
+  800d45:	f7 d8                	neg    %eax
+  800d47:	83 d2 00             	adc    $0x0,%edx
+  800d4a:	f7 da                	neg    %edx
+}
+  800d4c:	83 c4 1c             	add    $0x1c,%esp
+  800d4f:	5b                   	pop    %ebx
+  800d50:	5e                   	pop    %esi
+  800d51:	5f                   	pop    %edi
+  800d52:	5d                   	pop    %ebp
+  800d53:	c3                   	ret
+
+00800d54 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d54:	55                   	push   %ebp
+  800d55:	89 e5                	mov    %esp,%ebp
+  800d57:	57                   	push   %edi
+  800d58:	56                   	push   %esi
+  800d59:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d5a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d61:	74 18                	je     800d7b <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6e:	89 c3                	mov    %eax,%ebx
+  800d70:	89 c7                	mov    %eax,%edi
+  800d72:	89 c6                	mov    %eax,%esi
+  800d74:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d76:	5b                   	pop    %ebx
+  800d77:	5e                   	pop    %esi
+  800d78:	5f                   	pop    %edi
+  800d79:	5d                   	pop    %ebp
+  800d7a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d86:	89 c3                	mov    %eax,%ebx
+  800d88:	89 c7                	mov    %eax,%edi
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	8d 35 95 0d 80 00    	lea    0x800d95,%esi
+  800d93:	0f 34                	sysenter
+  800d95:	5d                   	pop    %ebp
+		goto out;
+  800d96:	eb de                	jmp    800d76 <sys_cputs+0x22>
+
+00800d98 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	57                   	push   %edi
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d9e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800da5:	74 19                	je     800dc0 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800da7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dac:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db1:	89 d1                	mov    %edx,%ecx
+  800db3:	89 d3                	mov    %edx,%ebx
+  800db5:	89 d7                	mov    %edx,%edi
+  800db7:	89 d6                	mov    %edx,%esi
+  800db9:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5f                   	pop    %edi
+  800dbe:	5d                   	pop    %ebp
+  800dbf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dca:	89 d1                	mov    %edx,%ecx
+  800dcc:	89 d3                	mov    %edx,%ebx
+  800dce:	89 d7                	mov    %edx,%edi
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	8d 35 db 0d 80 00    	lea    0x800ddb,%esi
+  800dd9:	0f 34                	sysenter
+  800ddb:	5d                   	pop    %ebp
+		goto out;
+  800ddc:	eb dd                	jmp    800dbb <sys_cgetc+0x23>
+
+00800dde <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dde:	55                   	push   %ebp
+  800ddf:	89 e5                	mov    %esp,%ebp
+  800de1:	57                   	push   %edi
+  800de2:	56                   	push   %esi
+  800de3:	53                   	push   %ebx
+  800de4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800de7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dee:	74 21                	je     800e11 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800df0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfd:	89 cb                	mov    %ecx,%ebx
+  800dff:	89 cf                	mov    %ecx,%edi
+  800e01:	89 ce                	mov    %ecx,%esi
+  800e03:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	7f 27                	jg     800e30 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e19:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e1e:	89 cb                	mov    %ecx,%ebx
+  800e20:	89 cf                	mov    %ecx,%edi
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	8d 35 2d 0e 80 00    	lea    0x800e2d,%esi
+  800e2b:	0f 34                	sysenter
+  800e2d:	5d                   	pop    %ebp
+		goto out;
+  800e2e:	eb d5                	jmp    800e05 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e30:	83 ec 0c             	sub    $0xc,%esp
+  800e33:	50                   	push   %eax
+  800e34:	6a 03                	push   $0x3
+  800e36:	68 0b 39 80 00       	push   $0x80390b
+  800e3b:	6a 3f                	push   $0x3f
+  800e3d:	68 28 39 80 00       	push   $0x803928
+  800e42:	e8 71 f4 ff ff       	call   8002b8 <_panic>
+
+00800e47 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	57                   	push   %edi
+  800e4b:	56                   	push   %esi
+  800e4c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e4d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e54:	74 19                	je     800e6f <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e60:	89 d1                	mov    %edx,%ecx
+  800e62:	89 d3                	mov    %edx,%ebx
+  800e64:	89 d7                	mov    %edx,%edi
+  800e66:	89 d6                	mov    %edx,%esi
+  800e68:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e6a:	5b                   	pop    %ebx
+  800e6b:	5e                   	pop    %esi
+  800e6c:	5f                   	pop    %edi
+  800e6d:	5d                   	pop    %ebp
+  800e6e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e74:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e79:	89 d1                	mov    %edx,%ecx
+  800e7b:	89 d3                	mov    %edx,%ebx
+  800e7d:	89 d7                	mov    %edx,%edi
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	8d 35 8a 0e 80 00    	lea    0x800e8a,%esi
+  800e88:	0f 34                	sysenter
+  800e8a:	5d                   	pop    %ebp
+		goto out;
+  800e8b:	eb dd                	jmp    800e6a <sys_getenvid+0x23>
+
+00800e8d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e8d:	55                   	push   %ebp
+  800e8e:	89 e5                	mov    %esp,%ebp
+  800e90:	57                   	push   %edi
+  800e91:	56                   	push   %esi
+  800e92:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e93:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e9a:	74 19                	je     800eb5 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ea6:	89 d1                	mov    %edx,%ecx
+  800ea8:	89 d3                	mov    %edx,%ebx
+  800eaa:	89 d7                	mov    %edx,%edi
+  800eac:	89 d6                	mov    %edx,%esi
+  800eae:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800eb0:	5b                   	pop    %ebx
+  800eb1:	5e                   	pop    %esi
+  800eb2:	5f                   	pop    %edi
+  800eb3:	5d                   	pop    %ebp
+  800eb4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eba:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ebf:	89 d1                	mov    %edx,%ecx
+  800ec1:	89 d3                	mov    %edx,%ebx
+  800ec3:	89 d7                	mov    %edx,%edi
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	8d 35 d0 0e 80 00    	lea    0x800ed0,%esi
+  800ece:	0f 34                	sysenter
+  800ed0:	5d                   	pop    %ebp
+		goto out;
+  800ed1:	eb dd                	jmp    800eb0 <sys_yield+0x23>
+
+00800ed3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	57                   	push   %edi
+  800ed7:	56                   	push   %esi
+  800ed8:	53                   	push   %ebx
+  800ed9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800edc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ee3:	74 23                	je     800f08 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800ee5:	be 00 00 00 00       	mov    $0x0,%esi
+  800eea:	b8 04 00 00 00       	mov    $0x4,%eax
+  800eef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef8:	89 f7                	mov    %esi,%edi
+  800efa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800efc:	85 c0                	test   %eax,%eax
+  800efe:	7f 29                	jg     800f29 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f03:	5b                   	pop    %ebx
+  800f04:	5e                   	pop    %esi
+  800f05:	5f                   	pop    %edi
+  800f06:	5d                   	pop    %ebp
+  800f07:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f13:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	8d 35 26 0f 80 00    	lea    0x800f26,%esi
+  800f24:	0f 34                	sysenter
+  800f26:	5d                   	pop    %ebp
+		goto out;
+  800f27:	eb d3                	jmp    800efc <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f29:	83 ec 0c             	sub    $0xc,%esp
+  800f2c:	50                   	push   %eax
+  800f2d:	6a 04                	push   $0x4
+  800f2f:	68 0b 39 80 00       	push   $0x80390b
+  800f34:	6a 3f                	push   $0x3f
+  800f36:	68 28 39 80 00       	push   $0x803928
+  800f3b:	e8 78 f3 ff ff       	call   8002b8 <_panic>
+
+00800f40 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f40:	55                   	push   %ebp
+  800f41:	89 e5                	mov    %esp,%ebp
+  800f43:	57                   	push   %edi
+  800f44:	56                   	push   %esi
+  800f45:	53                   	push   %ebx
+  800f46:	83 ec 0c             	sub    $0xc,%esp
+  800f49:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f4c:	85 f6                	test   %esi,%esi
+  800f4e:	75 09                	jne    800f59 <sys_page_map+0x19>
+  800f50:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f57:	74 1f                	je     800f78 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f59:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f67:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6c:	85 c0                	test   %eax,%eax
+  800f6e:	7f 27                	jg     800f97 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f73:	5b                   	pop    %ebx
+  800f74:	5e                   	pop    %esi
+  800f75:	5f                   	pop    %edi
+  800f76:	5d                   	pop    %ebp
+  800f77:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f86:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	8d 35 94 0f 80 00    	lea    0x800f94,%esi
+  800f92:	0f 34                	sysenter
+  800f94:	5d                   	pop    %ebp
+		goto out;
+  800f95:	eb d5                	jmp    800f6c <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+  800f9a:	50                   	push   %eax
+  800f9b:	6a 05                	push   $0x5
+  800f9d:	68 0b 39 80 00       	push   $0x80390b
+  800fa2:	6a 3f                	push   $0x3f
+  800fa4:	68 28 39 80 00       	push   $0x803928
+  800fa9:	e8 0a f3 ff ff       	call   8002b8 <_panic>
+
+00800fae <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	56                   	push   %esi
+  800fb3:	53                   	push   %ebx
+  800fb4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fb7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fbe:	74 22                	je     800fe2 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800fc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd0:	89 df                	mov    %ebx,%edi
+  800fd2:	89 de                	mov    %ebx,%esi
+  800fd4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd6:	85 c0                	test   %eax,%eax
+  800fd8:	7f 28                	jg     801002 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdd:	5b                   	pop    %ebx
+  800fde:	5e                   	pop    %esi
+  800fdf:	5f                   	pop    %edi
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fe2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fed:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ff2:	89 df                	mov    %ebx,%edi
+  800ff4:	55                   	push   %ebp
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	8d 35 ff 0f 80 00    	lea    0x800fff,%esi
+  800ffd:	0f 34                	sysenter
+  800fff:	5d                   	pop    %ebp
+		goto out;
+  801000:	eb d4                	jmp    800fd6 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801002:	83 ec 0c             	sub    $0xc,%esp
+  801005:	50                   	push   %eax
+  801006:	6a 06                	push   $0x6
+  801008:	68 0b 39 80 00       	push   $0x80390b
+  80100d:	6a 3f                	push   $0x3f
+  80100f:	68 28 39 80 00       	push   $0x803928
+  801014:	e8 9f f2 ff ff       	call   8002b8 <_panic>
+
+00801019 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801019:	55                   	push   %ebp
+  80101a:	89 e5                	mov    %esp,%ebp
+  80101c:	57                   	push   %edi
+  80101d:	56                   	push   %esi
+  80101e:	53                   	push   %ebx
+  80101f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801022:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801029:	74 22                	je     80104d <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  80102b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801030:	b8 08 00 00 00       	mov    $0x8,%eax
+  801035:	8b 55 08             	mov    0x8(%ebp),%edx
+  801038:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103b:	89 df                	mov    %ebx,%edi
+  80103d:	89 de                	mov    %ebx,%esi
+  80103f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801041:	85 c0                	test   %eax,%eax
+  801043:	7f 28                	jg     80106d <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801048:	5b                   	pop    %ebx
+  801049:	5e                   	pop    %esi
+  80104a:	5f                   	pop    %edi
+  80104b:	5d                   	pop    %ebp
+  80104c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80104d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801052:	8b 55 08             	mov    0x8(%ebp),%edx
+  801055:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801058:	b8 08 00 00 00       	mov    $0x8,%eax
+  80105d:	89 df                	mov    %ebx,%edi
+  80105f:	55                   	push   %ebp
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	8d 35 6a 10 80 00    	lea    0x80106a,%esi
+  801068:	0f 34                	sysenter
+  80106a:	5d                   	pop    %ebp
+		goto out;
+  80106b:	eb d4                	jmp    801041 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106d:	83 ec 0c             	sub    $0xc,%esp
+  801070:	50                   	push   %eax
+  801071:	6a 08                	push   $0x8
+  801073:	68 0b 39 80 00       	push   $0x80390b
+  801078:	6a 3f                	push   $0x3f
+  80107a:	68 28 39 80 00       	push   $0x803928
+  80107f:	e8 34 f2 ff ff       	call   8002b8 <_panic>
+
+00801084 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801084:	55                   	push   %ebp
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	57                   	push   %edi
+  801088:	56                   	push   %esi
+  801089:	53                   	push   %ebx
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80108d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801094:	74 22                	je     8010b8 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801096:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109b:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a6:	89 df                	mov    %ebx,%edi
+  8010a8:	89 de                	mov    %ebx,%esi
+  8010aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ac:	85 c0                	test   %eax,%eax
+  8010ae:	7f 28                	jg     8010d8 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b3:	5b                   	pop    %ebx
+  8010b4:	5e                   	pop    %esi
+  8010b5:	5f                   	pop    %edi
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010c8:	89 df                	mov    %ebx,%edi
+  8010ca:	55                   	push   %ebp
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	8d 35 d5 10 80 00    	lea    0x8010d5,%esi
+  8010d3:	0f 34                	sysenter
+  8010d5:	5d                   	pop    %ebp
+		goto out;
+  8010d6:	eb d4                	jmp    8010ac <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d8:	83 ec 0c             	sub    $0xc,%esp
+  8010db:	50                   	push   %eax
+  8010dc:	6a 09                	push   $0x9
+  8010de:	68 0b 39 80 00       	push   $0x80390b
+  8010e3:	6a 3f                	push   $0x3f
+  8010e5:	68 28 39 80 00       	push   $0x803928
+  8010ea:	e8 c9 f1 ff ff       	call   8002b8 <_panic>
+
+008010ef <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010ef:	55                   	push   %ebp
+  8010f0:	89 e5                	mov    %esp,%ebp
+  8010f2:	57                   	push   %edi
+  8010f3:	56                   	push   %esi
+  8010f4:	53                   	push   %ebx
+  8010f5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010f8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010ff:	74 22                	je     801123 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801106:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80110b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801111:	89 df                	mov    %ebx,%edi
+  801113:	89 de                	mov    %ebx,%esi
+  801115:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801117:	85 c0                	test   %eax,%eax
+  801119:	7f 28                	jg     801143 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80111b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111e:	5b                   	pop    %ebx
+  80111f:	5e                   	pop    %esi
+  801120:	5f                   	pop    %edi
+  801121:	5d                   	pop    %ebp
+  801122:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801123:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801128:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801133:	89 df                	mov    %ebx,%edi
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	8d 35 40 11 80 00    	lea    0x801140,%esi
+  80113e:	0f 34                	sysenter
+  801140:	5d                   	pop    %ebp
+		goto out;
+  801141:	eb d4                	jmp    801117 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801143:	83 ec 0c             	sub    $0xc,%esp
+  801146:	50                   	push   %eax
+  801147:	6a 0a                	push   $0xa
+  801149:	68 0b 39 80 00       	push   $0x80390b
+  80114e:	6a 3f                	push   $0x3f
+  801150:	68 28 39 80 00       	push   $0x803928
+  801155:	e8 5e f1 ff ff       	call   8002b8 <_panic>
+
+0080115a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80115a:	55                   	push   %ebp
+  80115b:	89 e5                	mov    %esp,%ebp
+  80115d:	57                   	push   %edi
+  80115e:	56                   	push   %esi
+  80115f:	53                   	push   %ebx
+  801160:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801163:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80116a:	74 22                	je     80118e <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80116c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801171:	b8 17 00 00 00       	mov    $0x17,%eax
+  801176:	8b 55 08             	mov    0x8(%ebp),%edx
+  801179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117c:	89 df                	mov    %ebx,%edi
+  80117e:	89 de                	mov    %ebx,%esi
+  801180:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801182:	85 c0                	test   %eax,%eax
+  801184:	7f 28                	jg     8011ae <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801186:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801189:	5b                   	pop    %ebx
+  80118a:	5e                   	pop    %esi
+  80118b:	5f                   	pop    %edi
+  80118c:	5d                   	pop    %ebp
+  80118d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80118e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801193:	8b 55 08             	mov    0x8(%ebp),%edx
+  801196:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801199:	b8 17 00 00 00       	mov    $0x17,%eax
+  80119e:	89 df                	mov    %ebx,%edi
+  8011a0:	55                   	push   %ebp
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	8d 35 ab 11 80 00    	lea    0x8011ab,%esi
+  8011a9:	0f 34                	sysenter
+  8011ab:	5d                   	pop    %ebp
+		goto out;
+  8011ac:	eb d4                	jmp    801182 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ae:	83 ec 0c             	sub    $0xc,%esp
+  8011b1:	50                   	push   %eax
+  8011b2:	6a 17                	push   $0x17
+  8011b4:	68 0b 39 80 00       	push   $0x80390b
+  8011b9:	6a 3f                	push   $0x3f
+  8011bb:	68 28 39 80 00       	push   $0x803928
+  8011c0:	e8 f3 f0 ff ff       	call   8002b8 <_panic>
+
+008011c5 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8011c5:	55                   	push   %ebp
+  8011c6:	89 e5                	mov    %esp,%ebp
+  8011c8:	57                   	push   %edi
+  8011c9:	56                   	push   %esi
+  8011ca:	53                   	push   %ebx
+  8011cb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011ce:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011d5:	74 22                	je     8011f9 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8011d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dc:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e7:	89 df                	mov    %ebx,%edi
+  8011e9:	89 de                	mov    %ebx,%esi
+  8011eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ed:	85 c0                	test   %eax,%eax
+  8011ef:	7f 28                	jg     801219 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8011f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f4:	5b                   	pop    %ebx
+  8011f5:	5e                   	pop    %esi
+  8011f6:	5f                   	pop    %edi
+  8011f7:	5d                   	pop    %ebp
+  8011f8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801201:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801204:	b8 18 00 00 00       	mov    $0x18,%eax
+  801209:	89 df                	mov    %ebx,%edi
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	8d 35 16 12 80 00    	lea    0x801216,%esi
+  801214:	0f 34                	sysenter
+  801216:	5d                   	pop    %ebp
+		goto out;
+  801217:	eb d4                	jmp    8011ed <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801219:	83 ec 0c             	sub    $0xc,%esp
+  80121c:	50                   	push   %eax
+  80121d:	6a 18                	push   $0x18
+  80121f:	68 0b 39 80 00       	push   $0x80390b
+  801224:	6a 3f                	push   $0x3f
+  801226:	68 28 39 80 00       	push   $0x803928
+  80122b:	e8 88 f0 ff ff       	call   8002b8 <_panic>
+
+00801230 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	57                   	push   %edi
+  801234:	56                   	push   %esi
+  801235:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801236:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80123d:	74 1d                	je     80125c <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80123f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801244:	be 00 00 00 00       	mov    $0x0,%esi
+  801249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801252:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801255:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801257:	5b                   	pop    %ebx
+  801258:	5e                   	pop    %esi
+  801259:	5f                   	pop    %edi
+  80125a:	5d                   	pop    %ebp
+  80125b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80125c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801262:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801267:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80126a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	8d 35 78 12 80 00    	lea    0x801278,%esi
+  801276:	0f 34                	sysenter
+  801278:	5d                   	pop    %ebp
+		goto out;
+  801279:	eb dc                	jmp    801257 <sys_ipc_try_send+0x27>
+
+0080127b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80127b:	55                   	push   %ebp
+  80127c:	89 e5                	mov    %esp,%ebp
+  80127e:	57                   	push   %edi
+  80127f:	56                   	push   %esi
+  801280:	53                   	push   %ebx
+  801281:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801284:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80128b:	74 21                	je     8012ae <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80128d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801292:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801297:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129a:	89 cb                	mov    %ecx,%ebx
+  80129c:	89 cf                	mov    %ecx,%edi
+  80129e:	89 ce                	mov    %ecx,%esi
+  8012a0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012a2:	85 c0                	test   %eax,%eax
+  8012a4:	7f 27                	jg     8012cd <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8012a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5f                   	pop    %edi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012bb:	89 cb                	mov    %ecx,%ebx
+  8012bd:	89 cf                	mov    %ecx,%edi
+  8012bf:	55                   	push   %ebp
+  8012c0:	89 e5                	mov    %esp,%ebp
+  8012c2:	8d 35 ca 12 80 00    	lea    0x8012ca,%esi
+  8012c8:	0f 34                	sysenter
+  8012ca:	5d                   	pop    %ebp
+		goto out;
+  8012cb:	eb d5                	jmp    8012a2 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012cd:	83 ec 0c             	sub    $0xc,%esp
+  8012d0:	50                   	push   %eax
+  8012d1:	6a 0d                	push   $0xd
+  8012d3:	68 0b 39 80 00       	push   $0x80390b
+  8012d8:	6a 3f                	push   $0x3f
+  8012da:	68 28 39 80 00       	push   $0x803928
+  8012df:	e8 d4 ef ff ff       	call   8002b8 <_panic>
+
+008012e4 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8012e4:	55                   	push   %ebp
+  8012e5:	89 e5                	mov    %esp,%ebp
+  8012e7:	57                   	push   %edi
+  8012e8:	56                   	push   %esi
+  8012e9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012ea:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012f1:	74 1b                	je     80130e <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8012f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801300:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801303:	89 df                	mov    %ebx,%edi
+  801305:	89 de                	mov    %ebx,%esi
+  801307:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801309:	5b                   	pop    %ebx
+  80130a:	5e                   	pop    %esi
+  80130b:	5f                   	pop    %edi
+  80130c:	5d                   	pop    %ebp
+  80130d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80130e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801313:	8b 55 08             	mov    0x8(%ebp),%edx
+  801316:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801319:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80131e:	89 df                	mov    %ebx,%edi
+  801320:	55                   	push   %ebp
+  801321:	89 e5                	mov    %esp,%ebp
+  801323:	8d 35 2b 13 80 00    	lea    0x80132b,%esi
+  801329:	0f 34                	sysenter
+  80132b:	5d                   	pop    %ebp
+		goto out;
+  80132c:	eb db                	jmp    801309 <sys_ipc_recv_until+0x25>
+
+0080132e <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	57                   	push   %edi
+  801332:	56                   	push   %esi
+  801333:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801334:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80133b:	74 19                	je     801356 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80133d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801342:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801347:	89 d1                	mov    %edx,%ecx
+  801349:	89 d3                	mov    %edx,%ebx
+  80134b:	89 d7                	mov    %edx,%edi
+  80134d:	89 d6                	mov    %edx,%esi
+  80134f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801351:	5b                   	pop    %ebx
+  801352:	5e                   	pop    %esi
+  801353:	5f                   	pop    %edi
+  801354:	5d                   	pop    %ebp
+  801355:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801356:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801360:	89 d1                	mov    %edx,%ecx
+  801362:	89 d3                	mov    %edx,%ebx
+  801364:	89 d7                	mov    %edx,%edi
+  801366:	55                   	push   %ebp
+  801367:	89 e5                	mov    %esp,%ebp
+  801369:	8d 35 71 13 80 00    	lea    0x801371,%esi
+  80136f:	0f 34                	sysenter
+  801371:	5d                   	pop    %ebp
+		goto out;
+  801372:	eb dd                	jmp    801351 <sys_time_msec+0x23>
+
+00801374 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	57                   	push   %edi
+  801378:	56                   	push   %esi
+  801379:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80137a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801381:	74 1a                	je     80139d <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801383:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801388:	b8 10 00 00 00       	mov    $0x10,%eax
+  80138d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801390:	89 cb                	mov    %ecx,%ebx
+  801392:	89 cf                	mov    %ecx,%edi
+  801394:	89 ce                	mov    %ecx,%esi
+  801396:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801398:	5b                   	pop    %ebx
+  801399:	5e                   	pop    %esi
+  80139a:	5f                   	pop    %edi
+  80139b:	5d                   	pop    %ebp
+  80139c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80139d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013aa:	89 cb                	mov    %ecx,%ebx
+  8013ac:	89 cf                	mov    %ecx,%edi
+  8013ae:	55                   	push   %ebp
+  8013af:	89 e5                	mov    %esp,%ebp
+  8013b1:	8d 35 b9 13 80 00    	lea    0x8013b9,%esi
+  8013b7:	0f 34                	sysenter
+  8013b9:	5d                   	pop    %ebp
+		goto out;
+  8013ba:	eb dc                	jmp    801398 <sys_sleep_until+0x24>
+
+008013bc <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8013bc:	55                   	push   %ebp
+  8013bd:	89 e5                	mov    %esp,%ebp
+  8013bf:	57                   	push   %edi
+  8013c0:	56                   	push   %esi
+  8013c1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013c2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013c9:	74 1a                	je     8013e5 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8013cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d8:	89 cb                	mov    %ecx,%ebx
+  8013da:	89 cf                	mov    %ecx,%edi
+  8013dc:	89 ce                	mov    %ecx,%esi
+  8013de:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8013e0:	5b                   	pop    %ebx
+  8013e1:	5e                   	pop    %esi
+  8013e2:	5f                   	pop    %edi
+  8013e3:	5d                   	pop    %ebp
+  8013e4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ed:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013f2:	89 cb                	mov    %ecx,%ebx
+  8013f4:	89 cf                	mov    %ecx,%edi
+  8013f6:	55                   	push   %ebp
+  8013f7:	89 e5                	mov    %esp,%ebp
+  8013f9:	8d 35 01 14 80 00    	lea    0x801401,%esi
+  8013ff:	0f 34                	sysenter
+  801401:	5d                   	pop    %ebp
+		goto out;
+  801402:	eb dc                	jmp    8013e0 <sys_env_print_stats+0x24>
+
+00801404 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	57                   	push   %edi
+  801408:	56                   	push   %esi
+  801409:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80140a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801411:	74 1b                	je     80142e <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801413:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801418:	b8 19 00 00 00       	mov    $0x19,%eax
+  80141d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801420:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801423:	89 df                	mov    %ebx,%edi
+  801425:	89 de                	mov    %ebx,%esi
+  801427:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80142e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801433:	8b 55 08             	mov    0x8(%ebp),%edx
+  801436:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801439:	b8 19 00 00 00       	mov    $0x19,%eax
+  80143e:	89 df                	mov    %ebx,%edi
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	8d 35 4b 14 80 00    	lea    0x80144b,%esi
+  801449:	0f 34                	sysenter
+  80144b:	5d                   	pop    %ebp
+		goto out;
+  80144c:	eb db                	jmp    801429 <sys_perf+0x25>
+
+0080144e <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	57                   	push   %edi
+  801452:	56                   	push   %esi
+  801453:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801454:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80145b:	74 19                	je     801476 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80145d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801462:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801467:	89 d1                	mov    %edx,%ecx
+  801469:	89 d3                	mov    %edx,%ebx
+  80146b:	89 d7                	mov    %edx,%edi
+  80146d:	89 d6                	mov    %edx,%esi
+  80146f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801471:	5b                   	pop    %ebx
+  801472:	5e                   	pop    %esi
+  801473:	5f                   	pop    %edi
+  801474:	5d                   	pop    %ebp
+  801475:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801480:	89 d1                	mov    %edx,%ecx
+  801482:	89 d3                	mov    %edx,%ebx
+  801484:	89 d7                	mov    %edx,%edi
+  801486:	55                   	push   %ebp
+  801487:	89 e5                	mov    %esp,%ebp
+  801489:	8d 35 91 14 80 00    	lea    0x801491,%esi
+  80148f:	0f 34                	sysenter
+  801491:	5d                   	pop    %ebp
+		goto out;
+  801492:	eb dd                	jmp    801471 <sys_fork+0x23>
+
+00801494 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801494:	55                   	push   %ebp
+  801495:	89 e5                	mov    %esp,%ebp
+  801497:	57                   	push   %edi
+  801498:	56                   	push   %esi
+  801499:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80149a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014a1:	74 1c                	je     8014bf <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8014a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b6:	89 f7                	mov    %esi,%edi
+  8014b8:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8014ba:	5b                   	pop    %ebx
+  8014bb:	5e                   	pop    %esi
+  8014bc:	5f                   	pop    %edi
+  8014bd:	5d                   	pop    %ebp
+  8014be:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d2:	55                   	push   %ebp
+  8014d3:	89 e5                	mov    %esp,%ebp
+  8014d5:	8d 35 dd 14 80 00    	lea    0x8014dd,%esi
+  8014db:	0f 34                	sysenter
+  8014dd:	5d                   	pop    %ebp
+		goto out;
+  8014de:	eb da                	jmp    8014ba <sys_thread_create+0x26>
+
+008014e0 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8014e0:	55                   	push   %ebp
+  8014e1:	89 e5                	mov    %esp,%ebp
+  8014e3:	57                   	push   %edi
+  8014e4:	56                   	push   %esi
+  8014e5:	53                   	push   %ebx
+  8014e6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014e9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014f0:	74 24                	je     801516 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8014f2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801502:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801505:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801508:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	7f 27                	jg     801535 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80150e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801511:	5b                   	pop    %ebx
+  801512:	5e                   	pop    %esi
+  801513:	5f                   	pop    %edi
+  801514:	5d                   	pop    %ebp
+  801515:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801516:	8b 55 08             	mov    0x8(%ebp),%edx
+  801519:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801521:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801524:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801527:	55                   	push   %ebp
+  801528:	89 e5                	mov    %esp,%ebp
+  80152a:	8d 35 32 15 80 00    	lea    0x801532,%esi
+  801530:	0f 34                	sysenter
+  801532:	5d                   	pop    %ebp
+		goto out;
+  801533:	eb d5                	jmp    80150a <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801535:	83 ec 0c             	sub    $0xc,%esp
+  801538:	50                   	push   %eax
+  801539:	6a 1f                	push   $0x1f
+  80153b:	68 0b 39 80 00       	push   $0x80390b
+  801540:	6a 3f                	push   $0x3f
+  801542:	68 28 39 80 00       	push   $0x803928
+  801547:	e8 6c ed ff ff       	call   8002b8 <_panic>
+
+0080154c <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80154c:	55                   	push   %ebp
+  80154d:	89 e5                	mov    %esp,%ebp
+  80154f:	57                   	push   %edi
+  801550:	56                   	push   %esi
+  801551:	53                   	push   %ebx
+  801552:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801555:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80155c:	74 23                	je     801581 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80155e:	be 00 00 00 00       	mov    $0x0,%esi
+  801563:	b8 20 00 00 00       	mov    $0x20,%eax
+  801568:	8b 55 08             	mov    0x8(%ebp),%edx
+  80156b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801571:	89 f7                	mov    %esi,%edi
+  801573:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801575:	85 c0                	test   %eax,%eax
+  801577:	7f 29                	jg     8015a2 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80157c:	5b                   	pop    %ebx
+  80157d:	5e                   	pop    %esi
+  80157e:	5f                   	pop    %edi
+  80157f:	5d                   	pop    %ebp
+  801580:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801581:	8b 55 08             	mov    0x8(%ebp),%edx
+  801584:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801587:	b8 20 00 00 00       	mov    $0x20,%eax
+  80158c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801591:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	8d 35 9f 15 80 00    	lea    0x80159f,%esi
+  80159d:	0f 34                	sysenter
+  80159f:	5d                   	pop    %ebp
+		goto out;
+  8015a0:	eb d3                	jmp    801575 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015a2:	83 ec 0c             	sub    $0xc,%esp
+  8015a5:	50                   	push   %eax
+  8015a6:	6a 20                	push   $0x20
+  8015a8:	68 0b 39 80 00       	push   $0x80390b
+  8015ad:	6a 3f                	push   $0x3f
+  8015af:	68 28 39 80 00       	push   $0x803928
+  8015b4:	e8 ff ec ff ff       	call   8002b8 <_panic>
+
+008015b9 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8015b9:	55                   	push   %ebp
+  8015ba:	89 e5                	mov    %esp,%ebp
+  8015bc:	57                   	push   %edi
+  8015bd:	56                   	push   %esi
+  8015be:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015bf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015c6:	74 1b                	je     8015e3 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8015c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d8:	89 df                	mov    %ebx,%edi
+  8015da:	89 de                	mov    %ebx,%esi
+  8015dc:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8015de:	5b                   	pop    %ebx
+  8015df:	5e                   	pop    %esi
+  8015e0:	5f                   	pop    %edi
+  8015e1:	5d                   	pop    %ebp
+  8015e2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ee:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015f3:	89 df                	mov    %ebx,%edi
+  8015f5:	55                   	push   %ebp
+  8015f6:	89 e5                	mov    %esp,%ebp
+  8015f8:	8d 35 00 16 80 00    	lea    0x801600,%esi
+  8015fe:	0f 34                	sysenter
+  801600:	5d                   	pop    %ebp
+		goto out;
+  801601:	eb db                	jmp    8015de <sys_batch+0x25>
+
+00801603 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801603:	55                   	push   %ebp
+  801604:	89 e5                	mov    %esp,%ebp
+  801606:	57                   	push   %edi
+  801607:	56                   	push   %esi
+  801608:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801609:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801610:	74 1a                	je     80162c <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801617:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80161c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161f:	89 cb                	mov    %ecx,%ebx
+  801621:	89 cf                	mov    %ecx,%edi
+  801623:	89 ce                	mov    %ecx,%esi
+  801625:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801627:	5b                   	pop    %ebx
+  801628:	5e                   	pop    %esi
+  801629:	5f                   	pop    %edi
+  80162a:	5d                   	pop    %ebp
+  80162b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80162c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801634:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801639:	89 cb                	mov    %ecx,%ebx
+  80163b:	89 cf                	mov    %ecx,%edi
+  80163d:	55                   	push   %ebp
+  80163e:	89 e5                	mov    %esp,%ebp
+  801640:	8d 35 48 16 80 00    	lea    0x801648,%esi
+  801646:	0f 34                	sysenter
+  801648:	5d                   	pop    %ebp
+		goto out;
+  801649:	eb dc                	jmp    801627 <sys_trace_ctl+0x24>
+
+0080164b <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80164b:	55                   	push   %ebp
+  80164c:	89 e5                	mov    %esp,%ebp
+  80164e:	57                   	push   %edi
+  80164f:	56                   	push   %esi
+  801650:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801651:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801658:	74 1c                	je     801676 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80165a:	be 00 00 00 00       	mov    $0x0,%esi
+  80165f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801664:	8b 55 08             	mov    0x8(%ebp),%edx
+  801667:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80166a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80166d:	89 f7                	mov    %esi,%edi
+  80166f:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801671:	5b                   	pop    %ebx
+  801672:	5e                   	pop    %esi
+  801673:	5f                   	pop    %edi
+  801674:	5d                   	pop    %ebp
+  801675:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801676:	8b 55 08             	mov    0x8(%ebp),%edx
+  801679:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801681:	bf 00 00 00 00       	mov    $0x0,%edi
+  801686:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801689:	55                   	push   %ebp
+  80168a:	89 e5                	mov    %esp,%ebp
+  80168c:	8d 35 94 16 80 00    	lea    0x801694,%esi
+  801692:	0f 34                	sysenter
+  801694:	5d                   	pop    %ebp
+		goto out;
+  801695:	eb da                	jmp    801671 <sys_trace_read+0x26>
+
+00801697 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801697:	55                   	push   %ebp
+  801698:	89 e5                	mov    %esp,%ebp
+  80169a:	57                   	push   %edi
+  80169b:	56                   	push   %esi
+  80169c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80169d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016a4:	74 1c                	je     8016c2 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8016a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ab:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016b9:	89 f7                	mov    %esi,%edi
+  8016bb:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8016bd:	5b                   	pop    %ebx
+  8016be:	5e                   	pop    %esi
+  8016bf:	5f                   	pop    %edi
+  8016c0:	5d                   	pop    %ebp
+  8016c1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c8:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	8d 35 e0 16 80 00    	lea    0x8016e0,%esi
+  8016de:	0f 34                	sysenter
+  8016e0:	5d                   	pop    %ebp
+		goto out;
+  8016e1:	eb da                	jmp    8016bd <sys_meminfo+0x26>
+
+008016e3 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+  8016e6:	57                   	push   %edi
+  8016e7:	56                   	push   %esi
+  8016e8:	53                   	push   %ebx
+  8016e9:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8016ec:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8016f0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016f7:	74 1f                	je     801718 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8016f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fe:	b8 22 00 00 00       	mov    $0x22,%eax
+  801703:	8b 55 08             	mov    0x8(%ebp),%edx
+  801706:	89 df                	mov    %ebx,%edi
+  801708:	89 de                	mov    %ebx,%esi
+  80170a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	7f 25                	jg     801735 <sys_env_set_ksm+0x52>
+}
+  801710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801713:	5b                   	pop    %ebx
+  801714:	5e                   	pop    %esi
+  801715:	5f                   	pop    %edi
+  801716:	5d                   	pop    %ebp
+  801717:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801718:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801720:	b8 22 00 00 00       	mov    $0x22,%eax
+  801725:	89 df                	mov    %ebx,%edi
+  801727:	55                   	push   %ebp
+  801728:	89 e5                	mov    %esp,%ebp
+  80172a:	8d 35 32 17 80 00    	lea    0x801732,%esi
+  801730:	0f 34                	sysenter
+  801732:	5d                   	pop    %ebp
+		goto out;
+  801733:	eb d7                	jmp    80170c <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801735:	83 ec 0c             	sub    $0xc,%esp
+  801738:	50                   	push   %eax
+  801739:	6a 22                	push   $0x22
+  80173b:	68 0b 39 80 00       	push   $0x80390b
+  801740:	6a 3f                	push   $0x3f
+  801742:	68 28 39 80 00       	push   $0x803928
+  801747:	e8 6c eb ff ff       	call   8002b8 <_panic>
+
+0080174c <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	57                   	push   %edi
+  801750:	56                   	push   %esi
+  801751:	53                   	push   %ebx
+  801752:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801755:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801758:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80175f:	74 24                	je     801785 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801761:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801766:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80176b:	89 cb                	mov    %ecx,%ebx
+  80176d:	89 cf                	mov    %ecx,%edi
+  80176f:	89 ce                	mov    %ecx,%esi
+  801771:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801773:	85 c0                	test   %eax,%eax
+  801775:	7f 2a                	jg     8017a1 <sys_time_nsec+0x55>
+	return ns;
+}
+  801777:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80177a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80177d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801780:	5b                   	pop    %ebx
+  801781:	5e                   	pop    %esi
+  801782:	5f                   	pop    %edi
+  801783:	5d                   	pop    %ebp
+  801784:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801785:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80178f:	89 cb                	mov    %ecx,%ebx
+  801791:	89 cf                	mov    %ecx,%edi
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	8d 35 9e 17 80 00    	lea    0x80179e,%esi
+  80179c:	0f 34                	sysenter
+  80179e:	5d                   	pop    %ebp
+		goto out;
+  80179f:	eb d2                	jmp    801773 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017a1:	83 ec 0c             	sub    $0xc,%esp
+  8017a4:	50                   	push   %eax
+  8017a5:	6a 0f                	push   $0xf
+  8017a7:	68 0b 39 80 00       	push   $0x80390b
+  8017ac:	6a 3f                	push   $0x3f
+  8017ae:	68 28 39 80 00       	push   $0x803928
+  8017b3:	e8 00 eb ff ff       	call   8002b8 <_panic>
+
+008017b8 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8017b8:	55                   	push   %ebp
+  8017b9:	89 e5                	mov    %esp,%ebp
+  8017bb:	57                   	push   %edi
+  8017bc:	56                   	push   %esi
+  8017bd:	53                   	push   %ebx
+  8017be:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017c1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017c8:	74 22                	je     8017ec <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8017ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cf:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017da:	89 df                	mov    %ebx,%edi
+  8017dc:	89 de                	mov    %ebx,%esi
+  8017de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017e0:	85 c0                	test   %eax,%eax
+  8017e2:	7f 28                	jg     80180c <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8017e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e7:	5b                   	pop    %ebx
+  8017e8:	5e                   	pop    %esi
+  8017e9:	5f                   	pop    %edi
+  8017ea:	5d                   	pop    %ebp
+  8017eb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017fc:	89 df                	mov    %ebx,%edi
+  8017fe:	55                   	push   %ebp
+  8017ff:	89 e5                	mov    %esp,%ebp
+  801801:	8d 35 09 18 80 00    	lea    0x801809,%esi
+  801807:	0f 34                	sysenter
+  801809:	5d                   	pop    %ebp
+		goto out;
+  80180a:	eb d4                	jmp    8017e0 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80180c:	83 ec 0c             	sub    $0xc,%esp
+  80180f:	50                   	push   %eax
+  801810:	6a 12                	push   $0x12
+  801812:	68 0b 39 80 00       	push   $0x80390b
+  801817:	6a 3f                	push   $0x3f
+  801819:	68 28 39 80 00       	push   $0x803928
+  80181e:	e8 95 ea ff ff       	call   8002b8 <_panic>
+
+00801823 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	57                   	push   %edi
+  801827:	56                   	push   %esi
+  801828:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801829:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801830:	74 1b                	je     80184d <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801832:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801837:	b8 13 00 00 00       	mov    $0x13,%eax
+  80183c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801842:	89 df                	mov    %ebx,%edi
+  801844:	89 de                	mov    %ebx,%esi
+  801846:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801848:	5b                   	pop    %ebx
+  801849:	5e                   	pop    %esi
+  80184a:	5f                   	pop    %edi
+  80184b:	5d                   	pop    %ebp
+  80184c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80184d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801852:	8b 55 08             	mov    0x8(%ebp),%edx
+  801855:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801858:	b8 13 00 00 00       	mov    $0x13,%eax
+  80185d:	89 df                	mov    %ebx,%edi
+  80185f:	55                   	push   %ebp
+  801860:	89 e5                	mov    %esp,%ebp
+  801862:	8d 35 6a 18 80 00    	lea    0x80186a,%esi
+  801868:	0f 34                	sysenter
+  80186a:	5d                   	pop    %ebp
+		goto out;
+  80186b:	eb db                	jmp    801848 <sys_e1000_receive+0x25>
+
+0080186d <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80186d:	55                   	push   %ebp
+  80186e:	89 e5                	mov    %esp,%ebp
+  801870:	57                   	push   %edi
+  801871:	56                   	push   %esi
+  801872:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801873:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80187a:	74 1b                	je     801897 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80187c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801881:	b8 14 00 00 00       	mov    $0x14,%eax
+  801886:	8b 55 08             	mov    0x8(%ebp),%edx
+  801889:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80188c:	89 df                	mov    %ebx,%edi
+  80188e:	89 de                	mov    %ebx,%esi
+  801890:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801892:	5b                   	pop    %ebx
+  801893:	5e                   	pop    %esi
+  801894:	5f                   	pop    %edi
+  801895:	5d                   	pop    %ebp
+  801896:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801897:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80189c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8018a7:	89 df                	mov    %ebx,%edi
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	8d 35 b4 18 80 00    	lea    0x8018b4,%esi
+  8018b2:	0f 34                	sysenter
+  8018b4:	5d                   	pop    %ebp
+		goto out;
+  8018b5:	eb db                	jmp    801892 <sys_e1000_read_hwaddr+0x25>
+
+008018b7 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8018b7:	55                   	push   %ebp
+  8018b8:	89 e5                	mov    %esp,%ebp
+  8018ba:	57                   	push   %edi
+  8018bb:	56                   	push   %esi
+  8018bc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018bd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018c4:	74 1a                	je     8018e0 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8018c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018cb:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d3:	89 cb                	mov    %ecx,%ebx
+  8018d5:	89 cf                	mov    %ecx,%edi
+  8018d7:	89 ce                	mov    %ecx,%esi
+  8018d9:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8018db:	5b                   	pop    %ebx
+  8018dc:	5e                   	pop    %esi
+  8018dd:	5f                   	pop    %edi
+  8018de:	5d                   	pop    %ebp
+  8018df:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018e8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018ed:	89 cb                	mov    %ecx,%ebx
+  8018ef:	89 cf                	mov    %ecx,%edi
+  8018f1:	55                   	push   %ebp
+  8018f2:	89 e5                	mov    %esp,%ebp
+  8018f4:	8d 35 fc 18 80 00    	lea    0x8018fc,%esi
+  8018fa:	0f 34                	sysenter
+  8018fc:	5d                   	pop    %ebp
+		goto out;
+  8018fd:	eb dc                	jmp    8018db <sys_sb16_read_version+0x24>
+
+008018ff <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+  801902:	57                   	push   %edi
+  801903:	56                   	push   %esi
+  801904:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801905:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80190c:	74 1b                	je     801929 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  80190e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801913:	b8 16 00 00 00       	mov    $0x16,%eax
+  801918:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80191e:	89 df                	mov    %ebx,%edi
+  801920:	89 de                	mov    %ebx,%esi
+  801922:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801924:	5b                   	pop    %ebx
+  801925:	5e                   	pop    %esi
+  801926:	5f                   	pop    %edi
+  801927:	5d                   	pop    %ebp
+  801928:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801929:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801931:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801934:	b8 16 00 00 00       	mov    $0x16,%eax
+  801939:	89 df                	mov    %ebx,%edi
+  80193b:	55                   	push   %ebp
+  80193c:	89 e5                	mov    %esp,%ebp
+  80193e:	8d 35 46 19 80 00    	lea    0x801946,%esi
+  801944:	0f 34                	sysenter
+  801946:	5d                   	pop    %ebp
+		goto out;
+  801947:	eb db                	jmp    801924 <sys_sb16_play+0x25>
+
+00801949 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	53                   	push   %ebx
+  80194d:	83 ec 04             	sub    $0x4,%esp
+  801950:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801952:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801959:	f6 c4 04             	test   $0x4,%ah
+  80195c:	74 0c                	je     80196a <dupperm+0x21>
+  80195e:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801965:	f6 c4 08             	test   $0x8,%ah
+  801968:	75 62                	jne    8019cc <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80196a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801971:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801976:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80197c:	74 19                	je     801997 <dupperm+0x4e>
+  80197e:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801985:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  80198a:	83 f8 01             	cmp    $0x1,%eax
+  80198d:	19 c0                	sbb    %eax,%eax
+  80198f:	25 00 08 00 00       	and    $0x800,%eax
+  801994:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801997:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  80199e:	89 c1                	mov    %eax,%ecx
+  8019a0:	80 cd 04             	or     $0x4,%ch
+  8019a3:	f6 c7 04             	test   $0x4,%bh
+  8019a6:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  8019a9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8019b0:	f6 c1 02             	test   $0x2,%cl
+  8019b3:	74 12                	je     8019c7 <dupperm+0x7e>
+  8019b5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  8019bc:	89 c2                	mov    %eax,%edx
+  8019be:	83 ca 02             	or     $0x2,%edx
+  8019c1:	f6 c5 04             	test   $0x4,%ch
+  8019c4:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  8019c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ca:	c9                   	leave
+  8019cb:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8019cc:	68 38 39 80 00       	push   $0x803938
+  8019d1:	68 d0 39 80 00       	push   $0x8039d0
+  8019d6:	6a 39                	push   $0x39
+  8019d8:	68 e5 39 80 00       	push   $0x8039e5
+  8019dd:	e8 d6 e8 ff ff       	call   8002b8 <_panic>
+
+008019e2 <pgfault>:
+{
+  8019e2:	55                   	push   %ebp
+  8019e3:	89 e5                	mov    %esp,%ebp
+  8019e5:	53                   	push   %ebx
+  8019e6:	83 ec 04             	sub    $0x4,%esp
+  8019e9:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8019ec:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8019ee:	89 c3                	mov    %eax,%ebx
+  8019f0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019f6:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8019fa:	74 6d                	je     801a69 <pgfault+0x87>
+  8019fc:	89 da                	mov    %ebx,%edx
+  8019fe:	c1 ea 16             	shr    $0x16,%edx
+  801a01:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a08:	f6 c2 80             	test   $0x80,%dl
+  801a0b:	75 5c                	jne    801a69 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801a0d:	c1 e8 0c             	shr    $0xc,%eax
+  801a10:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801a17:	f6 c4 08             	test   $0x8,%ah
+  801a1a:	74 4d                	je     801a69 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801a1c:	83 ec 04             	sub    $0x4,%esp
+  801a1f:	6a 07                	push   $0x7
+  801a21:	68 00 f0 7f 00       	push   $0x7ff000
+  801a26:	6a 00                	push   $0x0
+  801a28:	e8 a6 f4 ff ff       	call   800ed3 <sys_page_alloc>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	78 49                	js     801a7d <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801a34:	83 ec 04             	sub    $0x4,%esp
+  801a37:	68 00 10 00 00       	push   $0x1000
+  801a3c:	53                   	push   %ebx
+  801a3d:	68 00 f0 7f 00       	push   $0x7ff000
+  801a42:	e8 1a f1 ff ff       	call   800b61 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801a47:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801a4e:	53                   	push   %ebx
+  801a4f:	6a 00                	push   $0x0
+  801a51:	68 00 f0 7f 00       	push   $0x7ff000
+  801a56:	6a 00                	push   $0x0
+  801a58:	e8 e3 f4 ff ff       	call   800f40 <sys_page_map>
+  801a5d:	83 c4 20             	add    $0x20,%esp
+  801a60:	85 c0                	test   %eax,%eax
+  801a62:	78 2d                	js     801a91 <pgfault+0xaf>
+}
+  801a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a67:	c9                   	leave
+  801a68:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801a69:	83 ec 04             	sub    $0x4,%esp
+  801a6c:	68 f0 39 80 00       	push   $0x8039f0
+  801a71:	6a 1e                	push   $0x1e
+  801a73:	68 e5 39 80 00       	push   $0x8039e5
+  801a78:	e8 3b e8 ff ff       	call   8002b8 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801a7d:	83 ec 04             	sub    $0x4,%esp
+  801a80:	68 6c 39 80 00       	push   $0x80396c
+  801a85:	6a 29                	push   $0x29
+  801a87:	68 e5 39 80 00       	push   $0x8039e5
+  801a8c:	e8 27 e8 ff ff       	call   8002b8 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801a91:	50                   	push   %eax
+  801a92:	68 a0 39 80 00       	push   $0x8039a0
+  801a97:	6a 2e                	push   $0x2e
+  801a99:	68 e5 39 80 00       	push   $0x8039e5
+  801a9e:	e8 15 e8 ff ff       	call   8002b8 <_panic>
+
+00801aa3 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801aa3:	55                   	push   %ebp
+  801aa4:	89 e5                	mov    %esp,%ebp
+  801aa6:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801aa9:	ff 75 0c             	push   0xc(%ebp)
+  801aac:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801aaf:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ab6:	e8 23 f3 ff ff       	call   800dde <sys_env_destroy>
+}
+  801abb:	83 c4 10             	add    $0x10,%esp
+  801abe:	c9                   	leave
+  801abf:	c3                   	ret
+
+00801ac0 <ufork>:
+{
+  801ac0:	55                   	push   %ebp
+  801ac1:	89 e5                	mov    %esp,%ebp
+  801ac3:	57                   	push   %edi
+  801ac4:	56                   	push   %esi
+  801ac5:	53                   	push   %ebx
+  801ac6:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801acc:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ad1:	cd 30                	int    $0x30
+  801ad3:	89 c6                	mov    %eax,%esi
+  801ad5:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801adb:	85 c0                	test   %eax,%eax
+  801add:	78 56                	js     801b35 <ufork+0x75>
+	if (pid > 0) {
+  801adf:	0f 8e b3 02 00 00    	jle    801d98 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801ae5:	83 ec 0c             	sub    $0xc,%esp
+  801ae8:	68 e2 19 80 00       	push   $0x8019e2
+  801aed:	e8 12 19 00 00       	call   803404 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801af2:	83 c4 08             	add    $0x8,%esp
+  801af5:	68 6b 34 80 00       	push   $0x80346b
+  801afa:	56                   	push   %esi
+  801afb:	e8 ef f5 ff ff       	call   8010ef <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801b00:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801b06:	89 1c 24             	mov    %ebx,(%esp)
+  801b09:	e8 a1 04 00 00       	call   801faf <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801b0e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801b15:	6a 07                	push   $0x7
+  801b17:	68 00 f0 bf ee       	push   $0xeebff000
+  801b1c:	56                   	push   %esi
+  801b1d:	53                   	push   %ebx
+  801b1e:	e8 0d 06 00 00       	call   802130 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b23:	83 c4 20             	add    $0x20,%esp
+  801b26:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b2b:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801b31:	89 fe                	mov    %edi,%esi
+  801b33:	eb 22                	jmp    801b57 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801b35:	50                   	push   %eax
+  801b36:	68 09 3a 80 00       	push   $0x803a09
+  801b3b:	68 a9 00 00 00       	push   $0xa9
+  801b40:	68 e5 39 80 00       	push   $0x8039e5
+  801b45:	e8 6e e7 ff ff       	call   8002b8 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b4a:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b50:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b55:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b57:	89 f7                	mov    %esi,%edi
+  801b59:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801b5f:	0f 87 e9 01 00 00    	ja     801d4e <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801b65:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801b6b:	85 f6                	test   %esi,%esi
+  801b6d:	0f 49 d6             	cmovns %esi,%edx
+  801b70:	c1 fa 0a             	sar    $0xa,%edx
+  801b73:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801b7a:	f6 c1 01             	test   $0x1,%cl
+  801b7d:	74 cb                	je     801b4a <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801b7f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b86:	f6 c2 80             	test   $0x80,%dl
+  801b89:	75 17                	jne    801ba2 <ufork+0xe2>
+			j = i + 1;
+  801b8b:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801b8e:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801b95:	f6 c2 01             	test   $0x1,%dl
+  801b98:	0f 85 f3 00 00 00    	jne    801c91 <ufork+0x1d1>
+			j = i + 1;
+  801b9e:	89 de                	mov    %ebx,%esi
+  801ba0:	eb b5                	jmp    801b57 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801ba2:	89 fb                	mov    %edi,%ebx
+  801ba4:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801ba7:	89 d8                	mov    %ebx,%eax
+  801ba9:	c1 e8 16             	shr    $0x16,%eax
+  801bac:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bb3:	89 c2                	mov    %eax,%edx
+  801bb5:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801bbb:	25 02 04 00 00       	and    $0x402,%eax
+  801bc0:	83 f8 02             	cmp    $0x2,%eax
+  801bc3:	74 31                	je     801bf6 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801bc5:	83 ec 04             	sub    $0x4,%esp
+  801bc8:	6a 01                	push   $0x1
+  801bca:	52                   	push   %edx
+  801bcb:	53                   	push   %ebx
+  801bcc:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bd2:	53                   	push   %ebx
+  801bd3:	6a 00                	push   $0x0
+  801bd5:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801bdb:	50                   	push   %eax
+  801bdc:	e8 7a 05 00 00       	call   80215b <batch_map>
+		return;
+  801be1:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801be4:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801bea:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801bef:	89 c6                	mov    %eax,%esi
+				continue;
+  801bf1:	e9 61 ff ff ff       	jmp    801b57 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801bf6:	83 ec 04             	sub    $0x4,%esp
+  801bf9:	80 ca 80             	or     $0x80,%dl
+  801bfc:	52                   	push   %edx
+  801bfd:	53                   	push   %ebx
+  801bfe:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c04:	e8 ca f2 ff ff       	call   800ed3 <sys_page_alloc>
+  801c09:	83 c4 10             	add    $0x10,%esp
+  801c0c:	85 c0                	test   %eax,%eax
+  801c0e:	78 5d                	js     801c6d <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801c10:	83 ec 0c             	sub    $0xc,%esp
+  801c13:	6a 07                	push   $0x7
+  801c15:	68 00 00 40 00       	push   $0x400000
+  801c1a:	6a 00                	push   $0x0
+  801c1c:	53                   	push   %ebx
+  801c1d:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c23:	e8 18 f3 ff ff       	call   800f40 <sys_page_map>
+  801c28:	83 c4 20             	add    $0x20,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 50                	js     801c7f <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801c2f:	83 ec 04             	sub    $0x4,%esp
+  801c32:	68 00 00 40 00       	push   $0x400000
+  801c37:	53                   	push   %ebx
+  801c38:	68 00 00 40 00       	push   $0x400000
+  801c3d:	e8 1f ef ff ff       	call   800b61 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801c42:	83 c4 08             	add    $0x8,%esp
+  801c45:	68 00 00 40 00       	push   $0x400000
+  801c4a:	6a 00                	push   $0x0
+  801c4c:	e8 5d f3 ff ff       	call   800fae <sys_page_unmap>
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	79 8c                	jns    801be4 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801c58:	50                   	push   %eax
+  801c59:	68 3d 3a 80 00       	push   $0x803a3d
+  801c5e:	68 81 00 00 00       	push   $0x81
+  801c63:	68 e5 39 80 00       	push   $0x8039e5
+  801c68:	e8 4b e6 ff ff       	call   8002b8 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801c6d:	50                   	push   %eax
+  801c6e:	68 19 3a 80 00       	push   $0x803a19
+  801c73:	6a 7c                	push   $0x7c
+  801c75:	68 e5 39 80 00       	push   $0x8039e5
+  801c7a:	e8 39 e6 ff ff       	call   8002b8 <_panic>
+		panic("sys_page_map: %e", r);
+  801c7f:	50                   	push   %eax
+  801c80:	68 2c 3a 80 00       	push   $0x803a2c
+  801c85:	6a 7e                	push   $0x7e
+  801c87:	68 e5 39 80 00       	push   $0x8039e5
+  801c8c:	e8 27 e6 ff ff       	call   8002b8 <_panic>
+  801c91:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801c97:	eb 22                	jmp    801cbb <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801c99:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801ca0:	a8 01                	test   $0x1,%al
+  801ca2:	74 35                	je     801cd9 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801ca4:	89 d8                	mov    %ebx,%eax
+  801ca6:	e8 9e fc ff ff       	call   801949 <dupperm>
+  801cab:	89 c6                	mov    %eax,%esi
+  801cad:	89 f8                	mov    %edi,%eax
+  801caf:	e8 95 fc ff ff       	call   801949 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cb4:	39 c6                	cmp    %eax,%esi
+  801cb6:	75 21                	jne    801cd9 <ufork+0x219>
+				j++;
+  801cb8:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cbb:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801cc1:	74 16                	je     801cd9 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801cc3:	89 d8                	mov    %ebx,%eax
+  801cc5:	c1 e8 0a             	shr    $0xa,%eax
+  801cc8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ccf:	25 81 00 00 00       	and    $0x81,%eax
+  801cd4:	83 f8 01             	cmp    $0x1,%eax
+  801cd7:	74 c0                	je     801c99 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801cd9:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801cdf:	89 d8                	mov    %ebx,%eax
+  801ce1:	29 f0                	sub    %esi,%eax
+  801ce3:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801ce9:	89 fe                	mov    %edi,%esi
+  801ceb:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801cee:	89 f8                	mov    %edi,%eax
+  801cf0:	e8 54 fc ff ff       	call   801949 <dupperm>
+  801cf5:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	6a 02                	push   $0x2
+  801cfc:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d02:	51                   	push   %ecx
+  801d03:	e8 15 03 00 00       	call   80201d <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801d08:	83 c4 0c             	add    $0xc,%esp
+  801d0b:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d11:	57                   	push   %edi
+  801d12:	56                   	push   %esi
+  801d13:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801d19:	56                   	push   %esi
+  801d1a:	6a 00                	push   $0x0
+  801d1c:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d22:	51                   	push   %ecx
+  801d23:	e8 33 04 00 00       	call   80215b <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801d28:	83 c4 1c             	add    $0x1c,%esp
+  801d2b:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d31:	57                   	push   %edi
+  801d32:	56                   	push   %esi
+  801d33:	6a 00                	push   $0x0
+  801d35:	56                   	push   %esi
+  801d36:	6a 00                	push   $0x0
+  801d38:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d3e:	50                   	push   %eax
+  801d3f:	e8 17 04 00 00       	call   80215b <batch_map>
+	return 0;
+  801d44:	83 c4 20             	add    $0x20,%esp
+  801d47:	89 de                	mov    %ebx,%esi
+  801d49:	e9 09 fe ff ff       	jmp    801b57 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801d4e:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801d54:	83 ec 04             	sub    $0x4,%esp
+  801d57:	6a 02                	push   $0x2
+  801d59:	56                   	push   %esi
+  801d5a:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d60:	53                   	push   %ebx
+  801d61:	e8 49 04 00 00       	call   8021af <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801d66:	89 1c 24             	mov    %ebx,(%esp)
+  801d69:	e8 5d 02 00 00       	call   801fcb <batch_flush>
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 0e                	js     801d83 <ufork+0x2c3>
+}
+  801d75:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801d7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d7e:	5b                   	pop    %ebx
+  801d7f:	5e                   	pop    %esi
+  801d80:	5f                   	pop    %edi
+  801d81:	5d                   	pop    %ebp
+  801d82:	c3                   	ret
+			panic("fork: %e", r);
+  801d83:	50                   	push   %eax
+  801d84:	68 10 3a 80 00       	push   $0x803a10
+  801d89:	68 d7 00 00 00       	push   $0xd7
+  801d8e:	68 e5 39 80 00       	push   $0x8039e5
+  801d93:	e8 20 e5 ff ff       	call   8002b8 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d98:	e8 aa f0 ff ff       	call   800e47 <sys_getenvid>
+  801d9d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801da2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801da8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801dad:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801db2:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801db9:	00 00 00 
+  801dbc:	eb b7                	jmp    801d75 <ufork+0x2b5>
+
+00801dbe <fork>:
+{
+  801dbe:	55                   	push   %ebp
+  801dbf:	89 e5                	mov    %esp,%ebp
+  801dc1:	53                   	push   %ebx
+  801dc2:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801dc5:	68 e2 19 80 00       	push   $0x8019e2
+  801dca:	e8 35 16 00 00       	call   803404 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801dcf:	e8 7a f6 ff ff       	call   80144e <sys_fork>
+  801dd4:	89 c3                	mov    %eax,%ebx
+  801dd6:	83 c4 10             	add    $0x10,%esp
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 09                	js     801de6 <fork+0x28>
+	if (pid == 0)
+  801ddd:	74 1c                	je     801dfb <fork+0x3d>
+}
+  801ddf:	89 d8                	mov    %ebx,%eax
+  801de1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801de4:	c9                   	leave
+  801de5:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801de6:	50                   	push   %eax
+  801de7:	68 09 3a 80 00       	push   $0x803a09
+  801dec:	68 ed 00 00 00       	push   $0xed
+  801df1:	68 e5 39 80 00       	push   $0x8039e5
+  801df6:	e8 bd e4 ff ff       	call   8002b8 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801dfb:	e8 47 f0 ff ff       	call   800e47 <sys_getenvid>
+  801e00:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e05:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e0b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801e10:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801e15:	eb c8                	jmp    801ddf <fork+0x21>
+
+00801e17 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801e17:	55                   	push   %ebp
+  801e18:	89 e5                	mov    %esp,%ebp
+  801e1a:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801e1d:	ff 75 0c             	push   0xc(%ebp)
+  801e20:	ff 75 08             	push   0x8(%ebp)
+  801e23:	68 a3 1a 80 00       	push   $0x801aa3
+  801e28:	e8 67 f6 ff ff       	call   801494 <sys_thread_create>
+}
+  801e2d:	c9                   	leave
+  801e2e:	c3                   	ret
+
+00801e2f <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	56                   	push   %esi
+  801e33:	53                   	push   %ebx
+  801e34:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e3a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801e44:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801e47:	83 ec 08             	sub    $0x8,%esp
+  801e4a:	ff 75 14             	push   0x14(%ebp)
+  801e4d:	50                   	push   %eax
+  801e4e:	e8 91 f4 ff ff       	call   8012e4 <sys_ipc_recv_until>
+  801e53:	83 c4 10             	add    $0x10,%esp
+  801e56:	85 c0                	test   %eax,%eax
+  801e58:	78 61                	js     801ebb <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801e5a:	85 f6                	test   %esi,%esi
+  801e5c:	74 1c                	je     801e7a <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801e5e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e60:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e65:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e6b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e70:	76 5f                	jbe    801ed1 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801e72:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801e78:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801e7a:	85 db                	test   %ebx,%ebx
+  801e7c:	74 1c                	je     801e9a <ipc_recv_until+0x6b>
+  801e7e:	89 e0                	mov    %esp,%eax
+  801e80:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e85:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e8b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e90:	76 50                	jbe    801ee2 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801e92:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801e98:	89 03                	mov    %eax,(%ebx)
+  801e9a:	89 e0                	mov    %esp,%eax
+  801e9c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ea1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ea7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801eac:	76 45                	jbe    801ef3 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801eae:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801eb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb7:	5b                   	pop    %ebx
+  801eb8:	5e                   	pop    %esi
+  801eb9:	5d                   	pop    %ebp
+  801eba:	c3                   	ret
+		if (from_env_store)
+  801ebb:	85 f6                	test   %esi,%esi
+  801ebd:	74 06                	je     801ec5 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801ebf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801ec5:	85 db                	test   %ebx,%ebx
+  801ec7:	74 eb                	je     801eb4 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801ec9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801ecf:	eb e3                	jmp    801eb4 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ed1:	c1 e8 10             	shr    $0x10,%eax
+  801ed4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801eda:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ee0:	eb 90                	jmp    801e72 <ipc_recv_until+0x43>
+  801ee2:	c1 e8 10             	shr    $0x10,%eax
+  801ee5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801eeb:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ef1:	eb 9f                	jmp    801e92 <ipc_recv_until+0x63>
+  801ef3:	c1 e8 10             	shr    $0x10,%eax
+  801ef6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801efc:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f02:	eb aa                	jmp    801eae <ipc_recv_until+0x7f>
+
+00801f04 <ipc_recv>:
+{
+  801f04:	55                   	push   %ebp
+  801f05:	89 e5                	mov    %esp,%ebp
+  801f07:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801f0a:	6a 00                	push   $0x0
+  801f0c:	ff 75 10             	push   0x10(%ebp)
+  801f0f:	ff 75 0c             	push   0xc(%ebp)
+  801f12:	ff 75 08             	push   0x8(%ebp)
+  801f15:	e8 15 ff ff ff       	call   801e2f <ipc_recv_until>
+}
+  801f1a:	c9                   	leave
+  801f1b:	c3                   	ret
+
+00801f1c <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801f1c:	55                   	push   %ebp
+  801f1d:	89 e5                	mov    %esp,%ebp
+  801f1f:	57                   	push   %edi
+  801f20:	56                   	push   %esi
+  801f21:	53                   	push   %ebx
+  801f22:	83 ec 0c             	sub    $0xc,%esp
+  801f25:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f28:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801f2e:	85 db                	test   %ebx,%ebx
+  801f30:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f35:	0f 44 d8             	cmove  %eax,%ebx
+  801f38:	eb 05                	jmp    801f3f <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801f3a:	e8 4e ef ff ff       	call   800e8d <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801f3f:	ff 75 14             	push   0x14(%ebp)
+  801f42:	53                   	push   %ebx
+  801f43:	56                   	push   %esi
+  801f44:	57                   	push   %edi
+  801f45:	e8 e6 f2 ff ff       	call   801230 <sys_ipc_try_send>
+  801f4a:	83 c4 10             	add    $0x10,%esp
+  801f4d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f50:	74 e8                	je     801f3a <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	78 08                	js     801f5e <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801f56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f59:	5b                   	pop    %ebx
+  801f5a:	5e                   	pop    %esi
+  801f5b:	5f                   	pop    %edi
+  801f5c:	5d                   	pop    %ebp
+  801f5d:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801f5e:	50                   	push   %eax
+  801f5f:	68 50 3a 80 00       	push   $0x803a50
+  801f64:	6a 4f                	push   $0x4f
+  801f66:	68 63 3a 80 00       	push   $0x803a63
+  801f6b:	e8 48 e3 ff ff       	call   8002b8 <_panic>
+
+00801f70 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801f76:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801f7b:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801f81:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801f87:	8b 52 50             	mov    0x50(%edx),%edx
+  801f8a:	39 ca                	cmp    %ecx,%edx
+  801f8c:	74 11                	je     801f9f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801f8e:	83 c0 01             	add    $0x1,%eax
+  801f91:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801f96:	75 e3                	jne    801f7b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9d:	eb 0e                	jmp    801fad <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801f9f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801fa5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801faa:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801fad:	5d                   	pop    %ebp
+  801fae:	c3                   	ret
+
+00801faf <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801faf:	55                   	push   %ebp
+  801fb0:	89 e5                	mov    %esp,%ebp
+  801fb2:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801fb5:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801fbc:	00 00 00 
+	b->b_error = 0;
+  801fbf:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801fc6:	00 00 00 
+}
+  801fc9:	5d                   	pop    %ebp
+  801fca:	c3                   	ret
+
+00801fcb <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801fcb:	55                   	push   %ebp
+  801fcc:	89 e5                	mov    %esp,%ebp
+  801fce:	53                   	push   %ebx
+  801fcf:	83 ec 04             	sub    $0x4,%esp
+  801fd2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801fd5:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	7e 09                	jle    801fe8 <batch_flush+0x1d>
+  801fdf:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801fe6:	74 15                	je     801ffd <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801fe8:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801fef:	00 00 00 
+	return b->b_error;
+  801ff2:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801ff8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ffb:	c9                   	leave
+  801ffc:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801ffd:	83 ec 08             	sub    $0x8,%esp
+  802000:	50                   	push   %eax
+  802001:	53                   	push   %ebx
+  802002:	e8 b2 f5 ff ff       	call   8015b9 <sys_batch>
+  802007:	83 c4 10             	add    $0x10,%esp
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	79 da                	jns    801fe8 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  80200e:	f7 d8                	neg    %eax
+  802010:	0f b6 c0             	movzbl %al,%eax
+  802013:	f7 d8                	neg    %eax
+  802015:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  80201b:	eb cb                	jmp    801fe8 <batch_flush+0x1d>
+
+0080201d <batch_reserve>:
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	83 ec 08             	sub    $0x8,%esp
+  802023:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  802026:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  80202c:	03 45 0c             	add    0xc(%ebp),%eax
+  80202f:	83 f8 10             	cmp    $0x10,%eax
+  802032:	7f 02                	jg     802036 <batch_reserve+0x19>
+}
+  802034:	c9                   	leave
+  802035:	c3                   	ret
+		batch_flush(b);
+  802036:	83 ec 0c             	sub    $0xc,%esp
+  802039:	52                   	push   %edx
+  80203a:	e8 8c ff ff ff       	call   801fcb <batch_flush>
+  80203f:	83 c4 10             	add    $0x10,%esp
+}
+  802042:	eb f0                	jmp    802034 <batch_reserve+0x17>
+
+00802044 <batch_next>:
+{
+  802044:	55                   	push   %ebp
+  802045:	89 e5                	mov    %esp,%ebp
+  802047:	53                   	push   %ebx
+  802048:	83 ec 04             	sub    $0x4,%esp
+  80204b:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  80204d:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  802054:	74 28                	je     80207e <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  802056:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  80205c:	8d 50 01             	lea    0x1(%eax),%edx
+  80205f:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  802065:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802068:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  80206a:	83 ec 04             	sub    $0x4,%esp
+  80206d:	6a 1c                	push   $0x1c
+  80206f:	6a 00                	push   $0x0
+  802071:	53                   	push   %ebx
+  802072:	e8 b5 ea ff ff       	call   800b2c <memset>
+}
+  802077:	89 d8                	mov    %ebx,%eax
+  802079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80207c:	c9                   	leave
+  80207d:	c3                   	ret
+		batch_flush(b);
+  80207e:	83 ec 0c             	sub    $0xc,%esp
+  802081:	50                   	push   %eax
+  802082:	e8 44 ff ff ff       	call   801fcb <batch_flush>
+  802087:	83 c4 10             	add    $0x10,%esp
+  80208a:	eb ca                	jmp    802056 <batch_next+0x12>
+
+0080208c <batch_page>:
+{
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	57                   	push   %edi
+  802090:	56                   	push   %esi
+  802091:	53                   	push   %ebx
+  802092:	83 ec 1c             	sub    $0x1c,%esp
+  802095:	89 d3                	mov    %edx,%ebx
+  802097:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  802099:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  80209f:	85 d2                	test   %edx,%edx
+  8020a1:	74 50                	je     8020f3 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  8020a3:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  8020a6:	01 c1                	add    %eax,%ecx
+  8020a8:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  8020ab:	75 46                	jne    8020f3 <batch_page+0x67>
+  8020ad:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  8020b0:	75 41                	jne    8020f3 <batch_page+0x67>
+  8020b2:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  8020b5:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  8020b8:	75 39                	jne    8020f3 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  8020ba:	83 ea 01             	sub    $0x1,%edx
+  8020bd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020c0:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020c3:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  8020c7:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8020ca:	75 27                	jne    8020f3 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8020cc:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020cf:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8020d3:	89 fa                	mov    %edi,%edx
+  8020d5:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020d8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8020db:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020de:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8020e1:	75 10                	jne    8020f3 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020e3:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8020e7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8020ea:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8020ee:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8020f1:	74 2a                	je     80211d <batch_page+0x91>
+	op = batch_next(b);
+  8020f3:	e8 4c ff ff ff       	call   802044 <batch_next>
+	op->bo_op = opcode;
+  8020f8:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  8020fa:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  8020fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  802100:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802103:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802106:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  802109:	8b 75 10             	mov    0x10(%ebp),%esi
+  80210c:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  80210f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802112:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802115:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802118:	89 78 14             	mov    %edi,0x14(%eax)
+  80211b:	eb 0b                	jmp    802128 <batch_page+0x9c>
+		op->bo_npages += npages;
+  80211d:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  802121:	03 7d 18             	add    0x18(%ebp),%edi
+  802124:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802128:	83 c4 1c             	add    $0x1c,%esp
+  80212b:	5b                   	pop    %ebx
+  80212c:	5e                   	pop    %esi
+  80212d:	5f                   	pop    %edi
+  80212e:	5d                   	pop    %ebp
+  80212f:	c3                   	ret
+
+00802130 <batch_alloc>:
+{
+  802130:	55                   	push   %ebp
+  802131:	89 e5                	mov    %esp,%ebp
+  802133:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802136:	ff 75 18             	push   0x18(%ebp)
+  802139:	ff 75 14             	push   0x14(%ebp)
+  80213c:	ff 75 10             	push   0x10(%ebp)
+  80213f:	ff 75 0c             	push   0xc(%ebp)
+  802142:	6a 00                	push   $0x0
+  802144:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802151:	e8 36 ff ff ff       	call   80208c <batch_page>
+}
+  802156:	83 c4 20             	add    $0x20,%esp
+  802159:	c9                   	leave
+  80215a:	c3                   	ret
+
+0080215b <batch_map>:
+{
+  80215b:	55                   	push   %ebp
+  80215c:	89 e5                	mov    %esp,%ebp
+  80215e:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802161:	ff 75 20             	push   0x20(%ebp)
+  802164:	ff 75 1c             	push   0x1c(%ebp)
+  802167:	ff 75 18             	push   0x18(%ebp)
+  80216a:	ff 75 14             	push   0x14(%ebp)
+  80216d:	ff 75 10             	push   0x10(%ebp)
+  802170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802173:	ba 01 00 00 00       	mov    $0x1,%edx
+  802178:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217b:	e8 0c ff ff ff       	call   80208c <batch_page>
+}
+  802180:	83 c4 20             	add    $0x20,%esp
+  802183:	c9                   	leave
+  802184:	c3                   	ret
+
+00802185 <batch_unmap>:
+{
+  802185:	55                   	push   %ebp
+  802186:	89 e5                	mov    %esp,%ebp
+  802188:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  80218b:	ff 75 14             	push   0x14(%ebp)
+  80218e:	6a 00                	push   $0x0
+  802190:	ff 75 10             	push   0x10(%ebp)
+  802193:	ff 75 0c             	push   0xc(%ebp)
+  802196:	6a 00                	push   $0x0
+  802198:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80219d:	ba 02 00 00 00       	mov    $0x2,%edx
+  8021a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a5:	e8 e2 fe ff ff       	call   80208c <batch_page>
+}
+  8021aa:	83 c4 20             	add    $0x20,%esp
+  8021ad:	c9                   	leave
+  8021ae:	c3                   	ret
+
+008021af <batch_set_status>:
+{
+  8021af:	55                   	push   %ebp
+  8021b0:	89 e5                	mov    %esp,%ebp
+  8021b2:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8021b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b8:	e8 87 fe ff ff       	call   802044 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8021bd:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8021c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c6:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8021c9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021cc:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8021cf:	c9                   	leave
+  8021d0:	c3                   	ret
+
+008021d1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8021d1:	55                   	push   %ebp
+  8021d2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8021dc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8021df:	5d                   	pop    %ebp
+  8021e0:	c3                   	ret
+
+008021e1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8021ec:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021f1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8021f6:	5d                   	pop    %ebp
+  8021f7:	c3                   	ret
+
+008021f8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8021f8:	55                   	push   %ebp
+  8021f9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8021fb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802200:	eb 02                	jmp    802204 <fd_alloc+0xc>
+  802202:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802204:	89 c2                	mov    %eax,%edx
+  802206:	c1 ea 16             	shr    $0x16,%edx
+  802209:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802210:	f6 c2 01             	test   $0x1,%dl
+  802213:	74 2b                	je     802240 <fd_alloc+0x48>
+  802215:	89 c2                	mov    %eax,%edx
+  802217:	c1 ea 0c             	shr    $0xc,%edx
+  80221a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802221:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802227:	f6 c1 01             	test   $0x1,%cl
+  80222a:	74 14                	je     802240 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80222c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802232:	75 ce                	jne    802202 <fd_alloc+0xa>
+  802234:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802239:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80223e:	eb 05                	jmp    802245 <fd_alloc+0x4d>
+			return 0;
+  802240:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802245:	8b 55 08             	mov    0x8(%ebp),%edx
+  802248:	89 02                	mov    %eax,(%edx)
+}
+  80224a:	89 c8                	mov    %ecx,%eax
+  80224c:	5d                   	pop    %ebp
+  80224d:	c3                   	ret
+
+0080224e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802254:	83 f8 1f             	cmp    $0x1f,%eax
+  802257:	77 30                	ja     802289 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802259:	c1 e0 0c             	shl    $0xc,%eax
+  80225c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802261:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802267:	f6 c2 01             	test   $0x1,%dl
+  80226a:	74 24                	je     802290 <fd_lookup+0x42>
+  80226c:	89 c2                	mov    %eax,%edx
+  80226e:	c1 ea 0c             	shr    $0xc,%edx
+  802271:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802278:	f6 c2 01             	test   $0x1,%dl
+  80227b:	74 1a                	je     802297 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80227d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802280:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802282:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802287:	5d                   	pop    %ebp
+  802288:	c3                   	ret
+		return -E_INVAL;
+  802289:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80228e:	eb f7                	jmp    802287 <fd_lookup+0x39>
+		return -E_INVAL;
+  802290:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802295:	eb f0                	jmp    802287 <fd_lookup+0x39>
+  802297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80229c:	eb e9                	jmp    802287 <fd_lookup+0x39>
+
+0080229e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	53                   	push   %ebx
+  8022a2:	83 ec 04             	sub    $0x4,%esp
+  8022a5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8022a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ad:	eb 03                	jmp    8022b2 <dev_lookup+0x14>
+  8022af:	83 c0 01             	add    $0x1,%eax
+  8022b2:	8b 1c 85 ec 3a 80 00 	mov    0x803aec(,%eax,4),%ebx
+  8022b9:	85 db                	test   %ebx,%ebx
+  8022bb:	74 0b                	je     8022c8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8022bd:	39 13                	cmp    %edx,(%ebx)
+  8022bf:	75 ee                	jne    8022af <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8022c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c6:	eb 2e                	jmp    8022f6 <dev_lookup+0x58>
+  8022c8:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022ca:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022cf:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022d5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8022da:	76 24                	jbe    802300 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022dc:	8b 41 48             	mov    0x48(%ecx),%eax
+  8022df:	83 ec 04             	sub    $0x4,%esp
+  8022e2:	52                   	push   %edx
+  8022e3:	50                   	push   %eax
+  8022e4:	68 70 3a 80 00       	push   $0x803a70
+  8022e9:	e8 a5 e0 ff ff       	call   800393 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8022ee:	83 c4 10             	add    $0x10,%esp
+  8022f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8022f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022f9:	89 1a                	mov    %ebx,(%edx)
+}
+  8022fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fe:	c9                   	leave
+  8022ff:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802300:	c1 e8 10             	shr    $0x10,%eax
+  802303:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802309:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80230f:	eb cb                	jmp    8022dc <dev_lookup+0x3e>
+
+00802311 <fd_close>:
+{
+  802311:	55                   	push   %ebp
+  802312:	89 e5                	mov    %esp,%ebp
+  802314:	57                   	push   %edi
+  802315:	56                   	push   %esi
+  802316:	53                   	push   %ebx
+  802317:	83 ec 24             	sub    $0x24,%esp
+  80231a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80231d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802320:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802323:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802324:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80232a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80232d:	50                   	push   %eax
+  80232e:	e8 1b ff ff ff       	call   80224e <fd_lookup>
+  802333:	89 c3                	mov    %eax,%ebx
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	85 c0                	test   %eax,%eax
+  80233a:	78 05                	js     802341 <fd_close+0x30>
+	    || fd != fd2)
+  80233c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80233f:	74 16                	je     802357 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802341:	89 f8                	mov    %edi,%eax
+  802343:	84 c0                	test   %al,%al
+  802345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80234a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80234d:	89 d8                	mov    %ebx,%eax
+  80234f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802352:	5b                   	pop    %ebx
+  802353:	5e                   	pop    %esi
+  802354:	5f                   	pop    %edi
+  802355:	5d                   	pop    %ebp
+  802356:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802357:	83 ec 08             	sub    $0x8,%esp
+  80235a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80235d:	50                   	push   %eax
+  80235e:	ff 36                	push   (%esi)
+  802360:	e8 39 ff ff ff       	call   80229e <dev_lookup>
+  802365:	89 c3                	mov    %eax,%ebx
+  802367:	83 c4 10             	add    $0x10,%esp
+  80236a:	85 c0                	test   %eax,%eax
+  80236c:	78 1a                	js     802388 <fd_close+0x77>
+		if (dev->dev_close)
+  80236e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802371:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802374:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802379:	85 c0                	test   %eax,%eax
+  80237b:	74 0b                	je     802388 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80237d:	83 ec 0c             	sub    $0xc,%esp
+  802380:	56                   	push   %esi
+  802381:	ff d0                	call   *%eax
+  802383:	89 c3                	mov    %eax,%ebx
+  802385:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802388:	83 ec 08             	sub    $0x8,%esp
+  80238b:	56                   	push   %esi
+  80238c:	6a 00                	push   $0x0
+  80238e:	e8 1b ec ff ff       	call   800fae <sys_page_unmap>
+	return r;
+  802393:	83 c4 10             	add    $0x10,%esp
+  802396:	eb b5                	jmp    80234d <fd_close+0x3c>
+
+00802398 <close>:
+
+int
+close(int fdnum)
+{
+  802398:	55                   	push   %ebp
+  802399:	89 e5                	mov    %esp,%ebp
+  80239b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80239e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a1:	50                   	push   %eax
+  8023a2:	ff 75 08             	push   0x8(%ebp)
+  8023a5:	e8 a4 fe ff ff       	call   80224e <fd_lookup>
+  8023aa:	83 c4 10             	add    $0x10,%esp
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	79 02                	jns    8023b3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8023b1:	c9                   	leave
+  8023b2:	c3                   	ret
+		return fd_close(fd, 1);
+  8023b3:	83 ec 08             	sub    $0x8,%esp
+  8023b6:	6a 01                	push   $0x1
+  8023b8:	ff 75 f4             	push   -0xc(%ebp)
+  8023bb:	e8 51 ff ff ff       	call   802311 <fd_close>
+  8023c0:	83 c4 10             	add    $0x10,%esp
+  8023c3:	eb ec                	jmp    8023b1 <close+0x19>
+
+008023c5 <close_all>:
+
+void
+close_all(void)
+{
+  8023c5:	55                   	push   %ebp
+  8023c6:	89 e5                	mov    %esp,%ebp
+  8023c8:	53                   	push   %ebx
+  8023c9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8023cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8023d1:	83 ec 0c             	sub    $0xc,%esp
+  8023d4:	53                   	push   %ebx
+  8023d5:	e8 be ff ff ff       	call   802398 <close>
+	for (i = 0; i < MAXFD; i++)
+  8023da:	83 c3 01             	add    $0x1,%ebx
+  8023dd:	83 c4 10             	add    $0x10,%esp
+  8023e0:	83 fb 20             	cmp    $0x20,%ebx
+  8023e3:	75 ec                	jne    8023d1 <close_all+0xc>
+}
+  8023e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023e8:	c9                   	leave
+  8023e9:	c3                   	ret
+
+008023ea <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8023ea:	55                   	push   %ebp
+  8023eb:	89 e5                	mov    %esp,%ebp
+  8023ed:	57                   	push   %edi
+  8023ee:	56                   	push   %esi
+  8023ef:	53                   	push   %ebx
+  8023f0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8023f3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023f6:	50                   	push   %eax
+  8023f7:	ff 75 08             	push   0x8(%ebp)
+  8023fa:	e8 4f fe ff ff       	call   80224e <fd_lookup>
+  8023ff:	89 c3                	mov    %eax,%ebx
+  802401:	83 c4 10             	add    $0x10,%esp
+  802404:	85 c0                	test   %eax,%eax
+  802406:	78 7f                	js     802487 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802408:	83 ec 0c             	sub    $0xc,%esp
+  80240b:	ff 75 0c             	push   0xc(%ebp)
+  80240e:	e8 85 ff ff ff       	call   802398 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802413:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802416:	c1 e6 0c             	shl    $0xc,%esi
+  802419:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80241f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802422:	89 3c 24             	mov    %edi,(%esp)
+  802425:	e8 b7 fd ff ff       	call   8021e1 <fd2data>
+  80242a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80242c:	89 34 24             	mov    %esi,(%esp)
+  80242f:	e8 ad fd ff ff       	call   8021e1 <fd2data>
+  802434:	83 c4 10             	add    $0x10,%esp
+  802437:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80243a:	89 d8                	mov    %ebx,%eax
+  80243c:	c1 e8 16             	shr    $0x16,%eax
+  80243f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802446:	a8 01                	test   $0x1,%al
+  802448:	74 11                	je     80245b <dup+0x71>
+  80244a:	89 d8                	mov    %ebx,%eax
+  80244c:	c1 e8 0c             	shr    $0xc,%eax
+  80244f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802456:	f6 c2 01             	test   $0x1,%dl
+  802459:	75 36                	jne    802491 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80245b:	89 f8                	mov    %edi,%eax
+  80245d:	c1 e8 0c             	shr    $0xc,%eax
+  802460:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802467:	83 ec 0c             	sub    $0xc,%esp
+  80246a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80246f:	50                   	push   %eax
+  802470:	56                   	push   %esi
+  802471:	6a 00                	push   $0x0
+  802473:	57                   	push   %edi
+  802474:	6a 00                	push   $0x0
+  802476:	e8 c5 ea ff ff       	call   800f40 <sys_page_map>
+  80247b:	89 c3                	mov    %eax,%ebx
+  80247d:	83 c4 20             	add    $0x20,%esp
+  802480:	85 c0                	test   %eax,%eax
+  802482:	78 33                	js     8024b7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802484:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802487:	89 d8                	mov    %ebx,%eax
+  802489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80248c:	5b                   	pop    %ebx
+  80248d:	5e                   	pop    %esi
+  80248e:	5f                   	pop    %edi
+  80248f:	5d                   	pop    %ebp
+  802490:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802491:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802498:	83 ec 0c             	sub    $0xc,%esp
+  80249b:	25 07 0e 00 00       	and    $0xe07,%eax
+  8024a0:	50                   	push   %eax
+  8024a1:	ff 75 d4             	push   -0x2c(%ebp)
+  8024a4:	6a 00                	push   $0x0
+  8024a6:	53                   	push   %ebx
+  8024a7:	6a 00                	push   $0x0
+  8024a9:	e8 92 ea ff ff       	call   800f40 <sys_page_map>
+  8024ae:	89 c3                	mov    %eax,%ebx
+  8024b0:	83 c4 20             	add    $0x20,%esp
+  8024b3:	85 c0                	test   %eax,%eax
+  8024b5:	79 a4                	jns    80245b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8024b7:	83 ec 08             	sub    $0x8,%esp
+  8024ba:	56                   	push   %esi
+  8024bb:	6a 00                	push   $0x0
+  8024bd:	e8 ec ea ff ff       	call   800fae <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8024c2:	83 c4 08             	add    $0x8,%esp
+  8024c5:	ff 75 d4             	push   -0x2c(%ebp)
+  8024c8:	6a 00                	push   $0x0
+  8024ca:	e8 df ea ff ff       	call   800fae <sys_page_unmap>
+	return r;
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	eb b3                	jmp    802487 <dup+0x9d>
+
+008024d4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8024d4:	55                   	push   %ebp
+  8024d5:	89 e5                	mov    %esp,%ebp
+  8024d7:	56                   	push   %esi
+  8024d8:	53                   	push   %ebx
+  8024d9:	83 ec 18             	sub    $0x18,%esp
+  8024dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024e2:	50                   	push   %eax
+  8024e3:	53                   	push   %ebx
+  8024e4:	e8 65 fd ff ff       	call   80224e <fd_lookup>
+  8024e9:	83 c4 10             	add    $0x10,%esp
+  8024ec:	85 c0                	test   %eax,%eax
+  8024ee:	78 3c                	js     80252c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024f0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024f3:	83 ec 08             	sub    $0x8,%esp
+  8024f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024f9:	50                   	push   %eax
+  8024fa:	ff 36                	push   (%esi)
+  8024fc:	e8 9d fd ff ff       	call   80229e <dev_lookup>
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	85 c0                	test   %eax,%eax
+  802506:	78 24                	js     80252c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802508:	8b 46 08             	mov    0x8(%esi),%eax
+  80250b:	83 e0 03             	and    $0x3,%eax
+  80250e:	83 f8 01             	cmp    $0x1,%eax
+  802511:	74 20                	je     802533 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802513:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802516:	8b 40 08             	mov    0x8(%eax),%eax
+  802519:	85 c0                	test   %eax,%eax
+  80251b:	74 57                	je     802574 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80251d:	83 ec 04             	sub    $0x4,%esp
+  802520:	ff 75 10             	push   0x10(%ebp)
+  802523:	ff 75 0c             	push   0xc(%ebp)
+  802526:	56                   	push   %esi
+  802527:	ff d0                	call   *%eax
+  802529:	83 c4 10             	add    $0x10,%esp
+}
+  80252c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80252f:	5b                   	pop    %ebx
+  802530:	5e                   	pop    %esi
+  802531:	5d                   	pop    %ebp
+  802532:	c3                   	ret
+  802533:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802535:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80253a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802540:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802545:	76 1c                	jbe    802563 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802547:	8b 42 48             	mov    0x48(%edx),%eax
+  80254a:	83 ec 04             	sub    $0x4,%esp
+  80254d:	53                   	push   %ebx
+  80254e:	50                   	push   %eax
+  80254f:	68 b1 3a 80 00       	push   $0x803ab1
+  802554:	e8 3a de ff ff       	call   800393 <cprintf>
+		return -E_INVAL;
+  802559:	83 c4 10             	add    $0x10,%esp
+  80255c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802561:	eb c9                	jmp    80252c <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802563:	c1 e8 10             	shr    $0x10,%eax
+  802566:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80256c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802572:	eb d3                	jmp    802547 <read+0x73>
+		return -E_NOT_SUPP;
+  802574:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802579:	eb b1                	jmp    80252c <read+0x58>
+
+0080257b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80257b:	55                   	push   %ebp
+  80257c:	89 e5                	mov    %esp,%ebp
+  80257e:	57                   	push   %edi
+  80257f:	56                   	push   %esi
+  802580:	53                   	push   %ebx
+  802581:	83 ec 0c             	sub    $0xc,%esp
+  802584:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802587:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80258a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80258f:	eb 02                	jmp    802593 <readn+0x18>
+  802591:	01 c3                	add    %eax,%ebx
+  802593:	39 f3                	cmp    %esi,%ebx
+  802595:	73 21                	jae    8025b8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802597:	83 ec 04             	sub    $0x4,%esp
+  80259a:	89 f0                	mov    %esi,%eax
+  80259c:	29 d8                	sub    %ebx,%eax
+  80259e:	50                   	push   %eax
+  80259f:	89 d8                	mov    %ebx,%eax
+  8025a1:	03 45 0c             	add    0xc(%ebp),%eax
+  8025a4:	50                   	push   %eax
+  8025a5:	57                   	push   %edi
+  8025a6:	e8 29 ff ff ff       	call   8024d4 <read>
+		if (m < 0)
+  8025ab:	83 c4 10             	add    $0x10,%esp
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	78 04                	js     8025b6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8025b2:	75 dd                	jne    802591 <readn+0x16>
+  8025b4:	eb 02                	jmp    8025b8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8025b6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8025b8:	89 d8                	mov    %ebx,%eax
+  8025ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025bd:	5b                   	pop    %ebx
+  8025be:	5e                   	pop    %esi
+  8025bf:	5f                   	pop    %edi
+  8025c0:	5d                   	pop    %ebp
+  8025c1:	c3                   	ret
+
+008025c2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8025c2:	55                   	push   %ebp
+  8025c3:	89 e5                	mov    %esp,%ebp
+  8025c5:	56                   	push   %esi
+  8025c6:	53                   	push   %ebx
+  8025c7:	83 ec 18             	sub    $0x18,%esp
+  8025ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025d0:	50                   	push   %eax
+  8025d1:	53                   	push   %ebx
+  8025d2:	e8 77 fc ff ff       	call   80224e <fd_lookup>
+  8025d7:	83 c4 10             	add    $0x10,%esp
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	78 37                	js     802615 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025de:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025e1:	83 ec 08             	sub    $0x8,%esp
+  8025e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025e7:	50                   	push   %eax
+  8025e8:	ff 36                	push   (%esi)
+  8025ea:	e8 af fc ff ff       	call   80229e <dev_lookup>
+  8025ef:	83 c4 10             	add    $0x10,%esp
+  8025f2:	85 c0                	test   %eax,%eax
+  8025f4:	78 1f                	js     802615 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025f6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8025fa:	74 20                	je     80261c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8025fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  802602:	85 c0                	test   %eax,%eax
+  802604:	74 57                	je     80265d <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802606:	83 ec 04             	sub    $0x4,%esp
+  802609:	ff 75 10             	push   0x10(%ebp)
+  80260c:	ff 75 0c             	push   0xc(%ebp)
+  80260f:	56                   	push   %esi
+  802610:	ff d0                	call   *%eax
+  802612:	83 c4 10             	add    $0x10,%esp
+}
+  802615:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802618:	5b                   	pop    %ebx
+  802619:	5e                   	pop    %esi
+  80261a:	5d                   	pop    %ebp
+  80261b:	c3                   	ret
+  80261c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80261e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802623:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802629:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80262e:	76 1c                	jbe    80264c <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802630:	8b 42 48             	mov    0x48(%edx),%eax
+  802633:	83 ec 04             	sub    $0x4,%esp
+  802636:	53                   	push   %ebx
+  802637:	50                   	push   %eax
+  802638:	68 cd 3a 80 00       	push   $0x803acd
+  80263d:	e8 51 dd ff ff       	call   800393 <cprintf>
+		return -E_INVAL;
+  802642:	83 c4 10             	add    $0x10,%esp
+  802645:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80264a:	eb c9                	jmp    802615 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80264c:	c1 e8 10             	shr    $0x10,%eax
+  80264f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802655:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80265b:	eb d3                	jmp    802630 <write+0x6e>
+		return -E_NOT_SUPP;
+  80265d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802662:	eb b1                	jmp    802615 <write+0x53>
+
+00802664 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802664:	55                   	push   %ebp
+  802665:	89 e5                	mov    %esp,%ebp
+  802667:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80266a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80266d:	50                   	push   %eax
+  80266e:	ff 75 08             	push   0x8(%ebp)
+  802671:	e8 d8 fb ff ff       	call   80224e <fd_lookup>
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	78 0e                	js     80268b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80267d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802680:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802683:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802686:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268b:	c9                   	leave
+  80268c:	c3                   	ret
+
+0080268d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	56                   	push   %esi
+  802691:	53                   	push   %ebx
+  802692:	83 ec 18             	sub    $0x18,%esp
+  802695:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802698:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80269b:	50                   	push   %eax
+  80269c:	53                   	push   %ebx
+  80269d:	e8 ac fb ff ff       	call   80224e <fd_lookup>
+  8026a2:	83 c4 10             	add    $0x10,%esp
+  8026a5:	85 c0                	test   %eax,%eax
+  8026a7:	78 34                	js     8026dd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026ac:	83 ec 08             	sub    $0x8,%esp
+  8026af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b2:	50                   	push   %eax
+  8026b3:	ff 36                	push   (%esi)
+  8026b5:	e8 e4 fb ff ff       	call   80229e <dev_lookup>
+  8026ba:	83 c4 10             	add    $0x10,%esp
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	78 1c                	js     8026dd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026c1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8026c5:	74 1d                	je     8026e4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8026c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ca:	8b 40 18             	mov    0x18(%eax),%eax
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	74 54                	je     802725 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8026d1:	83 ec 08             	sub    $0x8,%esp
+  8026d4:	ff 75 0c             	push   0xc(%ebp)
+  8026d7:	56                   	push   %esi
+  8026d8:	ff d0                	call   *%eax
+  8026da:	83 c4 10             	add    $0x10,%esp
+}
+  8026dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e0:	5b                   	pop    %ebx
+  8026e1:	5e                   	pop    %esi
+  8026e2:	5d                   	pop    %ebp
+  8026e3:	c3                   	ret
+  8026e4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026e6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026eb:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026f1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026f6:	76 1c                	jbe    802714 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8026f8:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8026fb:	83 ec 04             	sub    $0x4,%esp
+  8026fe:	53                   	push   %ebx
+  8026ff:	50                   	push   %eax
+  802700:	68 90 3a 80 00       	push   $0x803a90
+  802705:	e8 89 dc ff ff       	call   800393 <cprintf>
+		return -E_INVAL;
+  80270a:	83 c4 10             	add    $0x10,%esp
+  80270d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802712:	eb c9                	jmp    8026dd <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802714:	c1 e8 10             	shr    $0x10,%eax
+  802717:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80271d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802723:	eb d3                	jmp    8026f8 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802725:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80272a:	eb b1                	jmp    8026dd <ftruncate+0x50>
+
+0080272c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80272c:	55                   	push   %ebp
+  80272d:	89 e5                	mov    %esp,%ebp
+  80272f:	56                   	push   %esi
+  802730:	53                   	push   %ebx
+  802731:	83 ec 18             	sub    $0x18,%esp
+  802734:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802737:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80273a:	50                   	push   %eax
+  80273b:	ff 75 08             	push   0x8(%ebp)
+  80273e:	e8 0b fb ff ff       	call   80224e <fd_lookup>
+  802743:	83 c4 10             	add    $0x10,%esp
+  802746:	85 c0                	test   %eax,%eax
+  802748:	78 49                	js     802793 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80274a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80274d:	83 ec 08             	sub    $0x8,%esp
+  802750:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802753:	50                   	push   %eax
+  802754:	ff 36                	push   (%esi)
+  802756:	e8 43 fb ff ff       	call   80229e <dev_lookup>
+  80275b:	83 c4 10             	add    $0x10,%esp
+  80275e:	85 c0                	test   %eax,%eax
+  802760:	78 31                	js     802793 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802762:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802765:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802769:	74 2f                	je     80279a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80276b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80276e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802775:	00 00 00 
+	stat->st_isdir = 0;
+  802778:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80277f:	00 00 00 
+	stat->st_dev = dev;
+  802782:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802788:	83 ec 08             	sub    $0x8,%esp
+  80278b:	53                   	push   %ebx
+  80278c:	56                   	push   %esi
+  80278d:	ff 50 14             	call   *0x14(%eax)
+  802790:	83 c4 10             	add    $0x10,%esp
+}
+  802793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802796:	5b                   	pop    %ebx
+  802797:	5e                   	pop    %esi
+  802798:	5d                   	pop    %ebp
+  802799:	c3                   	ret
+		return -E_NOT_SUPP;
+  80279a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80279f:	eb f2                	jmp    802793 <fstat+0x67>
+
+008027a1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8027a1:	55                   	push   %ebp
+  8027a2:	89 e5                	mov    %esp,%ebp
+  8027a4:	56                   	push   %esi
+  8027a5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8027a6:	83 ec 08             	sub    $0x8,%esp
+  8027a9:	6a 00                	push   $0x0
+  8027ab:	ff 75 08             	push   0x8(%ebp)
+  8027ae:	e8 e4 01 00 00       	call   802997 <open>
+  8027b3:	89 c3                	mov    %eax,%ebx
+  8027b5:	83 c4 10             	add    $0x10,%esp
+  8027b8:	85 c0                	test   %eax,%eax
+  8027ba:	78 1b                	js     8027d7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8027bc:	83 ec 08             	sub    $0x8,%esp
+  8027bf:	ff 75 0c             	push   0xc(%ebp)
+  8027c2:	50                   	push   %eax
+  8027c3:	e8 64 ff ff ff       	call   80272c <fstat>
+  8027c8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8027ca:	89 1c 24             	mov    %ebx,(%esp)
+  8027cd:	e8 c6 fb ff ff       	call   802398 <close>
+	return r;
+  8027d2:	83 c4 10             	add    $0x10,%esp
+  8027d5:	89 f3                	mov    %esi,%ebx
+}
+  8027d7:	89 d8                	mov    %ebx,%eax
+  8027d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027dc:	5b                   	pop    %ebx
+  8027dd:	5e                   	pop    %esi
+  8027de:	5d                   	pop    %ebp
+  8027df:	c3                   	ret
+
+008027e0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8027e0:	55                   	push   %ebp
+  8027e1:	89 e5                	mov    %esp,%ebp
+  8027e3:	56                   	push   %esi
+  8027e4:	53                   	push   %ebx
+  8027e5:	89 c6                	mov    %eax,%esi
+  8027e7:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8027e9:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8027f0:	74 27                	je     802819 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8027f2:	6a 07                	push   $0x7
+  8027f4:	68 00 60 80 00       	push   $0x806000
+  8027f9:	56                   	push   %esi
+  8027fa:	ff 35 00 50 80 00    	push   0x805000
+  802800:	e8 17 f7 ff ff       	call   801f1c <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802805:	83 c4 0c             	add    $0xc,%esp
+  802808:	6a 00                	push   $0x0
+  80280a:	53                   	push   %ebx
+  80280b:	6a 00                	push   $0x0
+  80280d:	e8 f2 f6 ff ff       	call   801f04 <ipc_recv>
+}
+  802812:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802815:	5b                   	pop    %ebx
+  802816:	5e                   	pop    %esi
+  802817:	5d                   	pop    %ebp
+  802818:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802819:	83 ec 0c             	sub    $0xc,%esp
+  80281c:	6a 01                	push   $0x1
+  80281e:	e8 4d f7 ff ff       	call   801f70 <ipc_find_env>
+  802823:	a3 00 50 80 00       	mov    %eax,0x805000
+  802828:	83 c4 10             	add    $0x10,%esp
+  80282b:	eb c5                	jmp    8027f2 <fsipc+0x12>
+
+0080282d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80282d:	55                   	push   %ebp
+  80282e:	89 e5                	mov    %esp,%ebp
+  802830:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802833:	8b 45 08             	mov    0x8(%ebp),%eax
+  802836:	8b 40 0c             	mov    0xc(%eax),%eax
+  802839:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80283e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802841:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802846:	ba 00 00 00 00       	mov    $0x0,%edx
+  80284b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802850:	e8 8b ff ff ff       	call   8027e0 <fsipc>
+}
+  802855:	c9                   	leave
+  802856:	c3                   	ret
+
+00802857 <devfile_flush>:
+{
+  802857:	55                   	push   %ebp
+  802858:	89 e5                	mov    %esp,%ebp
+  80285a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80285d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802860:	8b 40 0c             	mov    0xc(%eax),%eax
+  802863:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802868:	ba 00 00 00 00       	mov    $0x0,%edx
+  80286d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802872:	e8 69 ff ff ff       	call   8027e0 <fsipc>
+}
+  802877:	c9                   	leave
+  802878:	c3                   	ret
+
+00802879 <devfile_stat>:
+{
+  802879:	55                   	push   %ebp
+  80287a:	89 e5                	mov    %esp,%ebp
+  80287c:	53                   	push   %ebx
+  80287d:	83 ec 04             	sub    $0x4,%esp
+  802880:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802883:	8b 45 08             	mov    0x8(%ebp),%eax
+  802886:	8b 40 0c             	mov    0xc(%eax),%eax
+  802889:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80288e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802893:	b8 05 00 00 00       	mov    $0x5,%eax
+  802898:	e8 43 ff ff ff       	call   8027e0 <fsipc>
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	78 2c                	js     8028cd <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8028a1:	83 ec 08             	sub    $0x8,%esp
+  8028a4:	68 00 60 80 00       	push   $0x806000
+  8028a9:	53                   	push   %ebx
+  8028aa:	e8 2c e1 ff ff       	call   8009db <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8028af:	a1 80 60 80 00       	mov    0x806080,%eax
+  8028b4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8028ba:	a1 84 60 80 00       	mov    0x806084,%eax
+  8028bf:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8028c5:	83 c4 10             	add    $0x10,%esp
+  8028c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d0:	c9                   	leave
+  8028d1:	c3                   	ret
+
+008028d2 <devfile_write>:
+{
+  8028d2:	55                   	push   %ebp
+  8028d3:	89 e5                	mov    %esp,%ebp
+  8028d5:	83 ec 0c             	sub    $0xc,%esp
+  8028d8:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028de:	8b 52 0c             	mov    0xc(%edx),%edx
+  8028e1:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8028e7:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8028ec:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8028f1:	39 d0                	cmp    %edx,%eax
+  8028f3:	0f 47 c2             	cmova  %edx,%eax
+  8028f6:	50                   	push   %eax
+  8028f7:	ff 75 0c             	push   0xc(%ebp)
+  8028fa:	68 08 60 80 00       	push   $0x806008
+  8028ff:	e8 5d e2 ff ff       	call   800b61 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802904:	ba 00 00 00 00       	mov    $0x0,%edx
+  802909:	b8 04 00 00 00       	mov    $0x4,%eax
+  80290e:	e8 cd fe ff ff       	call   8027e0 <fsipc>
+}
+  802913:	c9                   	leave
+  802914:	c3                   	ret
+
+00802915 <devfile_read>:
+{
+  802915:	55                   	push   %ebp
+  802916:	89 e5                	mov    %esp,%ebp
+  802918:	56                   	push   %esi
+  802919:	53                   	push   %ebx
+  80291a:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80291d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802920:	8b 40 0c             	mov    0xc(%eax),%eax
+  802923:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802928:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80292e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802933:	b8 03 00 00 00       	mov    $0x3,%eax
+  802938:	e8 a3 fe ff ff       	call   8027e0 <fsipc>
+  80293d:	89 c3                	mov    %eax,%ebx
+  80293f:	85 c0                	test   %eax,%eax
+  802941:	78 1f                	js     802962 <devfile_read+0x4d>
+	assert(r <= n);
+  802943:	39 c6                	cmp    %eax,%esi
+  802945:	72 24                	jb     80296b <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802947:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80294c:	7f 33                	jg     802981 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80294e:	83 ec 04             	sub    $0x4,%esp
+  802951:	50                   	push   %eax
+  802952:	68 00 60 80 00       	push   $0x806000
+  802957:	ff 75 0c             	push   0xc(%ebp)
+  80295a:	e8 02 e2 ff ff       	call   800b61 <memmove>
+	return r;
+  80295f:	83 c4 10             	add    $0x10,%esp
+}
+  802962:	89 d8                	mov    %ebx,%eax
+  802964:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802967:	5b                   	pop    %ebx
+  802968:	5e                   	pop    %esi
+  802969:	5d                   	pop    %ebp
+  80296a:	c3                   	ret
+	assert(r <= n);
+  80296b:	68 00 3b 80 00       	push   $0x803b00
+  802970:	68 d0 39 80 00       	push   $0x8039d0
+  802975:	6a 76                	push   $0x76
+  802977:	68 07 3b 80 00       	push   $0x803b07
+  80297c:	e8 37 d9 ff ff       	call   8002b8 <_panic>
+	assert(r <= PGSIZE);
+  802981:	68 12 3b 80 00       	push   $0x803b12
+  802986:	68 d0 39 80 00       	push   $0x8039d0
+  80298b:	6a 77                	push   $0x77
+  80298d:	68 07 3b 80 00       	push   $0x803b07
+  802992:	e8 21 d9 ff ff       	call   8002b8 <_panic>
+
+00802997 <open>:
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	56                   	push   %esi
+  80299b:	53                   	push   %ebx
+  80299c:	83 ec 1c             	sub    $0x1c,%esp
+  80299f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8029a2:	56                   	push   %esi
+  8029a3:	e8 f8 df ff ff       	call   8009a0 <strlen>
+  8029a8:	83 c4 10             	add    $0x10,%esp
+  8029ab:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029b0:	7f 6c                	jg     802a1e <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8029b2:	83 ec 0c             	sub    $0xc,%esp
+  8029b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029b8:	50                   	push   %eax
+  8029b9:	e8 3a f8 ff ff       	call   8021f8 <fd_alloc>
+  8029be:	89 c3                	mov    %eax,%ebx
+  8029c0:	83 c4 10             	add    $0x10,%esp
+  8029c3:	85 c0                	test   %eax,%eax
+  8029c5:	78 3c                	js     802a03 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8029c7:	83 ec 08             	sub    $0x8,%esp
+  8029ca:	56                   	push   %esi
+  8029cb:	68 00 60 80 00       	push   $0x806000
+  8029d0:	e8 06 e0 ff ff       	call   8009db <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8029d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029d8:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8029dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029e5:	e8 f6 fd ff ff       	call   8027e0 <fsipc>
+  8029ea:	89 c3                	mov    %eax,%ebx
+  8029ec:	83 c4 10             	add    $0x10,%esp
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	78 19                	js     802a0c <open+0x75>
+	return fd2num(fd);
+  8029f3:	83 ec 0c             	sub    $0xc,%esp
+  8029f6:	ff 75 f4             	push   -0xc(%ebp)
+  8029f9:	e8 d3 f7 ff ff       	call   8021d1 <fd2num>
+  8029fe:	89 c3                	mov    %eax,%ebx
+  802a00:	83 c4 10             	add    $0x10,%esp
+}
+  802a03:	89 d8                	mov    %ebx,%eax
+  802a05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a08:	5b                   	pop    %ebx
+  802a09:	5e                   	pop    %esi
+  802a0a:	5d                   	pop    %ebp
+  802a0b:	c3                   	ret
+		fd_close(fd, 0);
+  802a0c:	83 ec 08             	sub    $0x8,%esp
+  802a0f:	6a 00                	push   $0x0
+  802a11:	ff 75 f4             	push   -0xc(%ebp)
+  802a14:	e8 f8 f8 ff ff       	call   802311 <fd_close>
+		return r;
+  802a19:	83 c4 10             	add    $0x10,%esp
+  802a1c:	eb e5                	jmp    802a03 <open+0x6c>
+		return -E_BAD_PATH;
+  802a1e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802a23:	eb de                	jmp    802a03 <open+0x6c>
+
+00802a25 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a25:	55                   	push   %ebp
+  802a26:	89 e5                	mov    %esp,%ebp
+  802a28:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a30:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a35:	e8 a6 fd ff ff       	call   8027e0 <fsipc>
+}
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+
+00802a3c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802a3c:	55                   	push   %ebp
+  802a3d:	89 e5                	mov    %esp,%ebp
+  802a3f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802a42:	89 c2                	mov    %eax,%edx
+  802a44:	c1 ea 16             	shr    $0x16,%edx
+  802a47:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802a4e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802a53:	f6 c1 01             	test   $0x1,%cl
+  802a56:	74 1a                	je     802a72 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802a58:	c1 e8 0c             	shr    $0xc,%eax
+  802a5b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802a62:	a8 01                	test   $0x1,%al
+  802a64:	74 0c                	je     802a72 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802a66:	c1 e8 0c             	shr    $0xc,%eax
+  802a69:	c1 e0 04             	shl    $0x4,%eax
+  802a6c:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802a72:	89 d0                	mov    %edx,%eax
+  802a74:	5d                   	pop    %ebp
+  802a75:	c3                   	ret
+
+00802a76 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a76:	55                   	push   %ebp
+  802a77:	89 e5                	mov    %esp,%ebp
+  802a79:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a7c:	68 1e 3b 80 00       	push   $0x803b1e
+  802a81:	ff 75 0c             	push   0xc(%ebp)
+  802a84:	e8 52 df ff ff       	call   8009db <strcpy>
+	return 0;
+}
+  802a89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8e:	c9                   	leave
+  802a8f:	c3                   	ret
+
+00802a90 <devsock_close>:
+{
+  802a90:	55                   	push   %ebp
+  802a91:	89 e5                	mov    %esp,%ebp
+  802a93:	53                   	push   %ebx
+  802a94:	83 ec 10             	sub    $0x10,%esp
+  802a97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a9a:	53                   	push   %ebx
+  802a9b:	e8 9c ff ff ff       	call   802a3c <pageref>
+  802aa0:	89 c2                	mov    %eax,%edx
+  802aa2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802aaa:	83 fa 01             	cmp    $0x1,%edx
+  802aad:	74 05                	je     802ab4 <devsock_close+0x24>
+}
+  802aaf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ab2:	c9                   	leave
+  802ab3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802ab4:	83 ec 0c             	sub    $0xc,%esp
+  802ab7:	ff 73 0c             	push   0xc(%ebx)
+  802aba:	e8 b7 02 00 00       	call   802d76 <nsipc_close>
+  802abf:	83 c4 10             	add    $0x10,%esp
+  802ac2:	eb eb                	jmp    802aaf <devsock_close+0x1f>
+
+00802ac4 <devsock_write>:
+{
+  802ac4:	55                   	push   %ebp
+  802ac5:	89 e5                	mov    %esp,%ebp
+  802ac7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802aca:	6a 00                	push   $0x0
+  802acc:	ff 75 10             	push   0x10(%ebp)
+  802acf:	ff 75 0c             	push   0xc(%ebp)
+  802ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad5:	ff 70 0c             	push   0xc(%eax)
+  802ad8:	e8 79 03 00 00       	call   802e56 <nsipc_send>
+}
+  802add:	c9                   	leave
+  802ade:	c3                   	ret
+
+00802adf <devsock_read>:
+{
+  802adf:	55                   	push   %ebp
+  802ae0:	89 e5                	mov    %esp,%ebp
+  802ae2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ae5:	6a 00                	push   $0x0
+  802ae7:	ff 75 10             	push   0x10(%ebp)
+  802aea:	ff 75 0c             	push   0xc(%ebp)
+  802aed:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af0:	ff 70 0c             	push   0xc(%eax)
+  802af3:	e8 ef 02 00 00       	call   802de7 <nsipc_recv>
+}
+  802af8:	c9                   	leave
+  802af9:	c3                   	ret
+
+00802afa <fd2sockid>:
+{
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b00:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b03:	52                   	push   %edx
+  802b04:	50                   	push   %eax
+  802b05:	e8 44 f7 ff ff       	call   80224e <fd_lookup>
+  802b0a:	83 c4 10             	add    $0x10,%esp
+  802b0d:	85 c0                	test   %eax,%eax
+  802b0f:	78 10                	js     802b21 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b14:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802b1a:	39 08                	cmp    %ecx,(%eax)
+  802b1c:	75 05                	jne    802b23 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b1e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b23:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b28:	eb f7                	jmp    802b21 <fd2sockid+0x27>
+
+00802b2a <alloc_sockfd>:
+{
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	56                   	push   %esi
+  802b2e:	53                   	push   %ebx
+  802b2f:	83 ec 1c             	sub    $0x1c,%esp
+  802b32:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b37:	50                   	push   %eax
+  802b38:	e8 bb f6 ff ff       	call   8021f8 <fd_alloc>
+  802b3d:	89 c3                	mov    %eax,%ebx
+  802b3f:	83 c4 10             	add    $0x10,%esp
+  802b42:	85 c0                	test   %eax,%eax
+  802b44:	78 43                	js     802b89 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b46:	83 ec 04             	sub    $0x4,%esp
+  802b49:	68 07 04 00 00       	push   $0x407
+  802b4e:	ff 75 f4             	push   -0xc(%ebp)
+  802b51:	6a 00                	push   $0x0
+  802b53:	e8 7b e3 ff ff       	call   800ed3 <sys_page_alloc>
+  802b58:	89 c3                	mov    %eax,%ebx
+  802b5a:	83 c4 10             	add    $0x10,%esp
+  802b5d:	85 c0                	test   %eax,%eax
+  802b5f:	78 28                	js     802b89 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b64:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802b6a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b6f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b76:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b79:	83 ec 0c             	sub    $0xc,%esp
+  802b7c:	50                   	push   %eax
+  802b7d:	e8 4f f6 ff ff       	call   8021d1 <fd2num>
+  802b82:	89 c3                	mov    %eax,%ebx
+  802b84:	83 c4 10             	add    $0x10,%esp
+  802b87:	eb 0c                	jmp    802b95 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b89:	83 ec 0c             	sub    $0xc,%esp
+  802b8c:	56                   	push   %esi
+  802b8d:	e8 e4 01 00 00       	call   802d76 <nsipc_close>
+		return r;
+  802b92:	83 c4 10             	add    $0x10,%esp
+}
+  802b95:	89 d8                	mov    %ebx,%eax
+  802b97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b9a:	5b                   	pop    %ebx
+  802b9b:	5e                   	pop    %esi
+  802b9c:	5d                   	pop    %ebp
+  802b9d:	c3                   	ret
+
+00802b9e <accept>:
+{
+  802b9e:	55                   	push   %ebp
+  802b9f:	89 e5                	mov    %esp,%ebp
+  802ba1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ba4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba7:	e8 4e ff ff ff       	call   802afa <fd2sockid>
+  802bac:	85 c0                	test   %eax,%eax
+  802bae:	78 1b                	js     802bcb <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802bb0:	83 ec 04             	sub    $0x4,%esp
+  802bb3:	ff 75 10             	push   0x10(%ebp)
+  802bb6:	ff 75 0c             	push   0xc(%ebp)
+  802bb9:	50                   	push   %eax
+  802bba:	e8 0e 01 00 00       	call   802ccd <nsipc_accept>
+  802bbf:	83 c4 10             	add    $0x10,%esp
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	78 05                	js     802bcb <accept+0x2d>
+	return alloc_sockfd(r);
+  802bc6:	e8 5f ff ff ff       	call   802b2a <alloc_sockfd>
+}
+  802bcb:	c9                   	leave
+  802bcc:	c3                   	ret
+
+00802bcd <bind>:
+{
+  802bcd:	55                   	push   %ebp
+  802bce:	89 e5                	mov    %esp,%ebp
+  802bd0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd6:	e8 1f ff ff ff       	call   802afa <fd2sockid>
+  802bdb:	85 c0                	test   %eax,%eax
+  802bdd:	78 12                	js     802bf1 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802bdf:	83 ec 04             	sub    $0x4,%esp
+  802be2:	ff 75 10             	push   0x10(%ebp)
+  802be5:	ff 75 0c             	push   0xc(%ebp)
+  802be8:	50                   	push   %eax
+  802be9:	e8 31 01 00 00       	call   802d1f <nsipc_bind>
+  802bee:	83 c4 10             	add    $0x10,%esp
+}
+  802bf1:	c9                   	leave
+  802bf2:	c3                   	ret
+
+00802bf3 <shutdown>:
+{
+  802bf3:	55                   	push   %ebp
+  802bf4:	89 e5                	mov    %esp,%ebp
+  802bf6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfc:	e8 f9 fe ff ff       	call   802afa <fd2sockid>
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	78 0f                	js     802c14 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c05:	83 ec 08             	sub    $0x8,%esp
+  802c08:	ff 75 0c             	push   0xc(%ebp)
+  802c0b:	50                   	push   %eax
+  802c0c:	e8 43 01 00 00       	call   802d54 <nsipc_shutdown>
+  802c11:	83 c4 10             	add    $0x10,%esp
+}
+  802c14:	c9                   	leave
+  802c15:	c3                   	ret
+
+00802c16 <connect>:
+{
+  802c16:	55                   	push   %ebp
+  802c17:	89 e5                	mov    %esp,%ebp
+  802c19:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1f:	e8 d6 fe ff ff       	call   802afa <fd2sockid>
+  802c24:	85 c0                	test   %eax,%eax
+  802c26:	78 12                	js     802c3a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c28:	83 ec 04             	sub    $0x4,%esp
+  802c2b:	ff 75 10             	push   0x10(%ebp)
+  802c2e:	ff 75 0c             	push   0xc(%ebp)
+  802c31:	50                   	push   %eax
+  802c32:	e8 59 01 00 00       	call   802d90 <nsipc_connect>
+  802c37:	83 c4 10             	add    $0x10,%esp
+}
+  802c3a:	c9                   	leave
+  802c3b:	c3                   	ret
+
+00802c3c <listen>:
+{
+  802c3c:	55                   	push   %ebp
+  802c3d:	89 e5                	mov    %esp,%ebp
+  802c3f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c42:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c45:	e8 b0 fe ff ff       	call   802afa <fd2sockid>
+  802c4a:	85 c0                	test   %eax,%eax
+  802c4c:	78 0f                	js     802c5d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c4e:	83 ec 08             	sub    $0x8,%esp
+  802c51:	ff 75 0c             	push   0xc(%ebp)
+  802c54:	50                   	push   %eax
+  802c55:	e8 6b 01 00 00       	call   802dc5 <nsipc_listen>
+  802c5a:	83 c4 10             	add    $0x10,%esp
+}
+  802c5d:	c9                   	leave
+  802c5e:	c3                   	ret
+
+00802c5f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c5f:	55                   	push   %ebp
+  802c60:	89 e5                	mov    %esp,%ebp
+  802c62:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c65:	ff 75 10             	push   0x10(%ebp)
+  802c68:	ff 75 0c             	push   0xc(%ebp)
+  802c6b:	ff 75 08             	push   0x8(%ebp)
+  802c6e:	e8 41 02 00 00       	call   802eb4 <nsipc_socket>
+  802c73:	83 c4 10             	add    $0x10,%esp
+  802c76:	85 c0                	test   %eax,%eax
+  802c78:	78 05                	js     802c7f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c7a:	e8 ab fe ff ff       	call   802b2a <alloc_sockfd>
+}
+  802c7f:	c9                   	leave
+  802c80:	c3                   	ret
+
+00802c81 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c81:	55                   	push   %ebp
+  802c82:	89 e5                	mov    %esp,%ebp
+  802c84:	53                   	push   %ebx
+  802c85:	83 ec 04             	sub    $0x4,%esp
+  802c88:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c8a:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802c91:	74 26                	je     802cb9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c93:	6a 07                	push   $0x7
+  802c95:	68 00 70 80 00       	push   $0x807000
+  802c9a:	53                   	push   %ebx
+  802c9b:	ff 35 04 50 80 00    	push   0x805004
+  802ca1:	e8 76 f2 ff ff       	call   801f1c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802ca6:	83 c4 0c             	add    $0xc,%esp
+  802ca9:	6a 00                	push   $0x0
+  802cab:	6a 00                	push   $0x0
+  802cad:	6a 00                	push   $0x0
+  802caf:	e8 50 f2 ff ff       	call   801f04 <ipc_recv>
+}
+  802cb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cb7:	c9                   	leave
+  802cb8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cb9:	83 ec 0c             	sub    $0xc,%esp
+  802cbc:	6a 02                	push   $0x2
+  802cbe:	e8 ad f2 ff ff       	call   801f70 <ipc_find_env>
+  802cc3:	a3 04 50 80 00       	mov    %eax,0x805004
+  802cc8:	83 c4 10             	add    $0x10,%esp
+  802ccb:	eb c6                	jmp    802c93 <nsipc+0x12>
+
+00802ccd <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802ccd:	55                   	push   %ebp
+  802cce:	89 e5                	mov    %esp,%ebp
+  802cd0:	56                   	push   %esi
+  802cd1:	53                   	push   %ebx
+  802cd2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802cd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802cdd:	8b 06                	mov    (%esi),%eax
+  802cdf:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802ce4:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ce9:	e8 93 ff ff ff       	call   802c81 <nsipc>
+  802cee:	89 c3                	mov    %eax,%ebx
+  802cf0:	85 c0                	test   %eax,%eax
+  802cf2:	79 09                	jns    802cfd <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802cf4:	89 d8                	mov    %ebx,%eax
+  802cf6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cf9:	5b                   	pop    %ebx
+  802cfa:	5e                   	pop    %esi
+  802cfb:	5d                   	pop    %ebp
+  802cfc:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802cfd:	83 ec 04             	sub    $0x4,%esp
+  802d00:	ff 35 10 70 80 00    	push   0x807010
+  802d06:	68 00 70 80 00       	push   $0x807000
+  802d0b:	ff 75 0c             	push   0xc(%ebp)
+  802d0e:	e8 4e de ff ff       	call   800b61 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d13:	a1 10 70 80 00       	mov    0x807010,%eax
+  802d18:	89 06                	mov    %eax,(%esi)
+  802d1a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d1d:	eb d5                	jmp    802cf4 <nsipc_accept+0x27>
+
+00802d1f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d1f:	55                   	push   %ebp
+  802d20:	89 e5                	mov    %esp,%ebp
+  802d22:	53                   	push   %ebx
+  802d23:	83 ec 08             	sub    $0x8,%esp
+  802d26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2c:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d31:	53                   	push   %ebx
+  802d32:	ff 75 0c             	push   0xc(%ebp)
+  802d35:	68 04 70 80 00       	push   $0x807004
+  802d3a:	e8 22 de ff ff       	call   800b61 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d3f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802d45:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d4a:	e8 32 ff ff ff       	call   802c81 <nsipc>
+}
+  802d4f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d52:	c9                   	leave
+  802d53:	c3                   	ret
+
+00802d54 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d54:	55                   	push   %ebp
+  802d55:	89 e5                	mov    %esp,%ebp
+  802d57:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802d62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d65:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d6a:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d6f:	e8 0d ff ff ff       	call   802c81 <nsipc>
+}
+  802d74:	c9                   	leave
+  802d75:	c3                   	ret
+
+00802d76 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d76:	55                   	push   %ebp
+  802d77:	89 e5                	mov    %esp,%ebp
+  802d79:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d7f:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802d84:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d89:	e8 f3 fe ff ff       	call   802c81 <nsipc>
+}
+  802d8e:	c9                   	leave
+  802d8f:	c3                   	ret
+
+00802d90 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d90:	55                   	push   %ebp
+  802d91:	89 e5                	mov    %esp,%ebp
+  802d93:	53                   	push   %ebx
+  802d94:	83 ec 08             	sub    $0x8,%esp
+  802d97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9d:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802da2:	53                   	push   %ebx
+  802da3:	ff 75 0c             	push   0xc(%ebp)
+  802da6:	68 04 70 80 00       	push   $0x807004
+  802dab:	e8 b1 dd ff ff       	call   800b61 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802db0:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802db6:	b8 05 00 00 00       	mov    $0x5,%eax
+  802dbb:	e8 c1 fe ff ff       	call   802c81 <nsipc>
+}
+  802dc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc3:	c9                   	leave
+  802dc4:	c3                   	ret
+
+00802dc5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802dc5:	55                   	push   %ebp
+  802dc6:	89 e5                	mov    %esp,%ebp
+  802dc8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802dcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dce:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802dd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dd6:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802ddb:	b8 06 00 00 00       	mov    $0x6,%eax
+  802de0:	e8 9c fe ff ff       	call   802c81 <nsipc>
+}
+  802de5:	c9                   	leave
+  802de6:	c3                   	ret
+
+00802de7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802de7:	55                   	push   %ebp
+  802de8:	89 e5                	mov    %esp,%ebp
+  802dea:	56                   	push   %esi
+  802deb:	53                   	push   %ebx
+  802dec:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802def:	8b 45 08             	mov    0x8(%ebp),%eax
+  802df2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802df7:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802dfd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e00:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e05:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e0a:	e8 72 fe ff ff       	call   802c81 <nsipc>
+  802e0f:	89 c3                	mov    %eax,%ebx
+  802e11:	85 c0                	test   %eax,%eax
+  802e13:	78 22                	js     802e37 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e15:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e1a:	39 c6                	cmp    %eax,%esi
+  802e1c:	0f 4e c6             	cmovle %esi,%eax
+  802e1f:	39 c3                	cmp    %eax,%ebx
+  802e21:	7f 1d                	jg     802e40 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e23:	83 ec 04             	sub    $0x4,%esp
+  802e26:	53                   	push   %ebx
+  802e27:	68 00 70 80 00       	push   $0x807000
+  802e2c:	ff 75 0c             	push   0xc(%ebp)
+  802e2f:	e8 2d dd ff ff       	call   800b61 <memmove>
+  802e34:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e37:	89 d8                	mov    %ebx,%eax
+  802e39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e3c:	5b                   	pop    %ebx
+  802e3d:	5e                   	pop    %esi
+  802e3e:	5d                   	pop    %ebp
+  802e3f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e40:	68 2a 3b 80 00       	push   $0x803b2a
+  802e45:	68 d0 39 80 00       	push   $0x8039d0
+  802e4a:	6a 62                	push   $0x62
+  802e4c:	68 3f 3b 80 00       	push   $0x803b3f
+  802e51:	e8 62 d4 ff ff       	call   8002b8 <_panic>
+
+00802e56 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e56:	55                   	push   %ebp
+  802e57:	89 e5                	mov    %esp,%ebp
+  802e59:	53                   	push   %ebx
+  802e5a:	83 ec 04             	sub    $0x4,%esp
+  802e5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e63:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802e68:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e6e:	7f 2e                	jg     802e9e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e70:	83 ec 04             	sub    $0x4,%esp
+  802e73:	53                   	push   %ebx
+  802e74:	ff 75 0c             	push   0xc(%ebp)
+  802e77:	68 0c 70 80 00       	push   $0x80700c
+  802e7c:	e8 e0 dc ff ff       	call   800b61 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e81:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802e87:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e8a:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802e8f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e94:	e8 e8 fd ff ff       	call   802c81 <nsipc>
+}
+  802e99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e9c:	c9                   	leave
+  802e9d:	c3                   	ret
+	assert(size < 1600);
+  802e9e:	68 4b 3b 80 00       	push   $0x803b4b
+  802ea3:	68 d0 39 80 00       	push   $0x8039d0
+  802ea8:	6a 6d                	push   $0x6d
+  802eaa:	68 3f 3b 80 00       	push   $0x803b3f
+  802eaf:	e8 04 d4 ff ff       	call   8002b8 <_panic>
+
+00802eb4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802eb4:	55                   	push   %ebp
+  802eb5:	89 e5                	mov    %esp,%ebp
+  802eb7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802eba:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802ec2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ec5:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802eca:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ecd:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802ed2:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ed7:	e8 a5 fd ff ff       	call   802c81 <nsipc>
+}
+  802edc:	c9                   	leave
+  802edd:	c3                   	ret
+
+00802ede <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ede:	55                   	push   %ebp
+  802edf:	89 e5                	mov    %esp,%ebp
+  802ee1:	56                   	push   %esi
+  802ee2:	53                   	push   %ebx
+  802ee3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802ee6:	83 ec 0c             	sub    $0xc,%esp
+  802ee9:	ff 75 08             	push   0x8(%ebp)
+  802eec:	e8 f0 f2 ff ff       	call   8021e1 <fd2data>
+  802ef1:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802ef3:	83 c4 08             	add    $0x8,%esp
+  802ef6:	68 57 3b 80 00       	push   $0x803b57
+  802efb:	53                   	push   %ebx
+  802efc:	e8 da da ff ff       	call   8009db <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f01:	8b 46 04             	mov    0x4(%esi),%eax
+  802f04:	2b 06                	sub    (%esi),%eax
+  802f06:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f0c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f13:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f16:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802f1d:	40 80 00 
+	return 0;
+}
+  802f20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f28:	5b                   	pop    %ebx
+  802f29:	5e                   	pop    %esi
+  802f2a:	5d                   	pop    %ebp
+  802f2b:	c3                   	ret
+
+00802f2c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f2c:	55                   	push   %ebp
+  802f2d:	89 e5                	mov    %esp,%ebp
+  802f2f:	53                   	push   %ebx
+  802f30:	83 ec 0c             	sub    $0xc,%esp
+  802f33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f36:	53                   	push   %ebx
+  802f37:	6a 00                	push   $0x0
+  802f39:	e8 70 e0 ff ff       	call   800fae <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f3e:	89 1c 24             	mov    %ebx,(%esp)
+  802f41:	e8 9b f2 ff ff       	call   8021e1 <fd2data>
+  802f46:	83 c4 08             	add    $0x8,%esp
+  802f49:	50                   	push   %eax
+  802f4a:	6a 00                	push   $0x0
+  802f4c:	e8 5d e0 ff ff       	call   800fae <sys_page_unmap>
+}
+  802f51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f54:	c9                   	leave
+  802f55:	c3                   	ret
+
+00802f56 <_pipeisclosed>:
+{
+  802f56:	55                   	push   %ebp
+  802f57:	89 e5                	mov    %esp,%ebp
+  802f59:	57                   	push   %edi
+  802f5a:	56                   	push   %esi
+  802f5b:	53                   	push   %ebx
+  802f5c:	83 ec 1c             	sub    $0x1c,%esp
+  802f5f:	89 c7                	mov    %eax,%edi
+  802f61:	89 d6                	mov    %edx,%esi
+  802f63:	eb 3c                	jmp    802fa1 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802f65:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f68:	83 ec 0c             	sub    $0xc,%esp
+  802f6b:	57                   	push   %edi
+  802f6c:	e8 cb fa ff ff       	call   802a3c <pageref>
+  802f71:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f74:	89 34 24             	mov    %esi,(%esp)
+  802f77:	e8 c0 fa ff ff       	call   802a3c <pageref>
+  802f7c:	89 c2                	mov    %eax,%edx
+  802f7e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f80:	05 00 00 00 20       	add    $0x20000000,%eax
+  802f85:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802f88:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f8e:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f93:	76 31                	jbe    802fc6 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802f95:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802f98:	39 c3                	cmp    %eax,%ebx
+  802f9a:	74 76                	je     803012 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802f9c:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f9f:	74 36                	je     802fd7 <_pipeisclosed+0x81>
+  802fa1:	89 e0                	mov    %esp,%eax
+  802fa3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802fa8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fae:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802fb3:	77 b0                	ja     802f65 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802fb5:	c1 e8 10             	shr    $0x10,%eax
+  802fb8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fbe:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802fc4:	eb 9f                	jmp    802f65 <_pipeisclosed+0xf>
+  802fc6:	c1 e8 10             	shr    $0x10,%eax
+  802fc9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fcf:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802fd5:	eb be                	jmp    802f95 <_pipeisclosed+0x3f>
+  802fd7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fd9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802fde:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fe4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802fe9:	76 16                	jbe    803001 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802feb:	8b 42 58             	mov    0x58(%edx),%eax
+  802fee:	6a 01                	push   $0x1
+  802ff0:	50                   	push   %eax
+  802ff1:	53                   	push   %ebx
+  802ff2:	68 5e 3b 80 00       	push   $0x803b5e
+  802ff7:	e8 97 d3 ff ff       	call   800393 <cprintf>
+  802ffc:	83 c4 10             	add    $0x10,%esp
+  802fff:	eb a0                	jmp    802fa1 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803001:	c1 e8 10             	shr    $0x10,%eax
+  803004:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80300a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803010:	eb d9                	jmp    802feb <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  803012:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  803015:	0f 94 c0             	sete   %al
+  803018:	0f b6 c0             	movzbl %al,%eax
+}
+  80301b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80301e:	5b                   	pop    %ebx
+  80301f:	5e                   	pop    %esi
+  803020:	5f                   	pop    %edi
+  803021:	5d                   	pop    %ebp
+  803022:	c3                   	ret
+
+00803023 <devpipe_write>:
+{
+  803023:	55                   	push   %ebp
+  803024:	89 e5                	mov    %esp,%ebp
+  803026:	57                   	push   %edi
+  803027:	56                   	push   %esi
+  803028:	53                   	push   %ebx
+  803029:	83 ec 28             	sub    $0x28,%esp
+  80302c:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80302f:	56                   	push   %esi
+  803030:	e8 ac f1 ff ff       	call   8021e1 <fd2data>
+  803035:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803037:	83 c4 10             	add    $0x10,%esp
+  80303a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80303f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803042:	75 09                	jne    80304d <devpipe_write+0x2a>
+	return i;
+  803044:	89 f8                	mov    %edi,%eax
+  803046:	eb 23                	jmp    80306b <devpipe_write+0x48>
+			sys_yield();
+  803048:	e8 40 de ff ff       	call   800e8d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80304d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803050:	8b 0b                	mov    (%ebx),%ecx
+  803052:	8d 51 20             	lea    0x20(%ecx),%edx
+  803055:	39 d0                	cmp    %edx,%eax
+  803057:	72 1a                	jb     803073 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803059:	89 da                	mov    %ebx,%edx
+  80305b:	89 f0                	mov    %esi,%eax
+  80305d:	e8 f4 fe ff ff       	call   802f56 <_pipeisclosed>
+  803062:	85 c0                	test   %eax,%eax
+  803064:	74 e2                	je     803048 <devpipe_write+0x25>
+				return 0;
+  803066:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80306b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80306e:	5b                   	pop    %ebx
+  80306f:	5e                   	pop    %esi
+  803070:	5f                   	pop    %edi
+  803071:	5d                   	pop    %ebp
+  803072:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803073:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803076:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80307a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80307d:	89 c2                	mov    %eax,%edx
+  80307f:	c1 fa 1f             	sar    $0x1f,%edx
+  803082:	89 d1                	mov    %edx,%ecx
+  803084:	c1 e9 1b             	shr    $0x1b,%ecx
+  803087:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80308a:	83 e2 1f             	and    $0x1f,%edx
+  80308d:	29 ca                	sub    %ecx,%edx
+  80308f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803093:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803097:	83 c0 01             	add    $0x1,%eax
+  80309a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80309d:	83 c7 01             	add    $0x1,%edi
+  8030a0:	eb 9d                	jmp    80303f <devpipe_write+0x1c>
+
+008030a2 <devpipe_read>:
+{
+  8030a2:	55                   	push   %ebp
+  8030a3:	89 e5                	mov    %esp,%ebp
+  8030a5:	57                   	push   %edi
+  8030a6:	56                   	push   %esi
+  8030a7:	53                   	push   %ebx
+  8030a8:	83 ec 18             	sub    $0x18,%esp
+  8030ab:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8030ae:	57                   	push   %edi
+  8030af:	e8 2d f1 ff ff       	call   8021e1 <fd2data>
+  8030b4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030b6:	83 c4 10             	add    $0x10,%esp
+  8030b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8030be:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030c1:	75 13                	jne    8030d6 <devpipe_read+0x34>
+	return i;
+  8030c3:	89 f0                	mov    %esi,%eax
+  8030c5:	eb 02                	jmp    8030c9 <devpipe_read+0x27>
+				return i;
+  8030c7:	89 f0                	mov    %esi,%eax
+}
+  8030c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030cc:	5b                   	pop    %ebx
+  8030cd:	5e                   	pop    %esi
+  8030ce:	5f                   	pop    %edi
+  8030cf:	5d                   	pop    %ebp
+  8030d0:	c3                   	ret
+			sys_yield();
+  8030d1:	e8 b7 dd ff ff       	call   800e8d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8030d6:	8b 03                	mov    (%ebx),%eax
+  8030d8:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030db:	75 18                	jne    8030f5 <devpipe_read+0x53>
+			if (i > 0)
+  8030dd:	85 f6                	test   %esi,%esi
+  8030df:	75 e6                	jne    8030c7 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8030e1:	89 da                	mov    %ebx,%edx
+  8030e3:	89 f8                	mov    %edi,%eax
+  8030e5:	e8 6c fe ff ff       	call   802f56 <_pipeisclosed>
+  8030ea:	85 c0                	test   %eax,%eax
+  8030ec:	74 e3                	je     8030d1 <devpipe_read+0x2f>
+				return 0;
+  8030ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f3:	eb d4                	jmp    8030c9 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030f5:	99                   	cltd
+  8030f6:	c1 ea 1b             	shr    $0x1b,%edx
+  8030f9:	01 d0                	add    %edx,%eax
+  8030fb:	83 e0 1f             	and    $0x1f,%eax
+  8030fe:	29 d0                	sub    %edx,%eax
+  803100:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803105:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803108:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80310b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80310e:	83 c6 01             	add    $0x1,%esi
+  803111:	eb ab                	jmp    8030be <devpipe_read+0x1c>
+
+00803113 <pipe>:
+{
+  803113:	55                   	push   %ebp
+  803114:	89 e5                	mov    %esp,%ebp
+  803116:	56                   	push   %esi
+  803117:	53                   	push   %ebx
+  803118:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80311b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80311e:	50                   	push   %eax
+  80311f:	e8 d4 f0 ff ff       	call   8021f8 <fd_alloc>
+  803124:	89 c3                	mov    %eax,%ebx
+  803126:	83 c4 10             	add    $0x10,%esp
+  803129:	85 c0                	test   %eax,%eax
+  80312b:	0f 88 23 01 00 00    	js     803254 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803131:	83 ec 04             	sub    $0x4,%esp
+  803134:	68 07 04 00 00       	push   $0x407
+  803139:	ff 75 f4             	push   -0xc(%ebp)
+  80313c:	6a 00                	push   $0x0
+  80313e:	e8 90 dd ff ff       	call   800ed3 <sys_page_alloc>
+  803143:	89 c3                	mov    %eax,%ebx
+  803145:	83 c4 10             	add    $0x10,%esp
+  803148:	85 c0                	test   %eax,%eax
+  80314a:	0f 88 04 01 00 00    	js     803254 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803150:	83 ec 0c             	sub    $0xc,%esp
+  803153:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803156:	50                   	push   %eax
+  803157:	e8 9c f0 ff ff       	call   8021f8 <fd_alloc>
+  80315c:	89 c3                	mov    %eax,%ebx
+  80315e:	83 c4 10             	add    $0x10,%esp
+  803161:	85 c0                	test   %eax,%eax
+  803163:	0f 88 db 00 00 00    	js     803244 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803169:	83 ec 04             	sub    $0x4,%esp
+  80316c:	68 07 04 00 00       	push   $0x407
+  803171:	ff 75 f0             	push   -0x10(%ebp)
+  803174:	6a 00                	push   $0x0
+  803176:	e8 58 dd ff ff       	call   800ed3 <sys_page_alloc>
+  80317b:	89 c3                	mov    %eax,%ebx
+  80317d:	83 c4 10             	add    $0x10,%esp
+  803180:	85 c0                	test   %eax,%eax
+  803182:	0f 88 bc 00 00 00    	js     803244 <pipe+0x131>
+	va = fd2data(fd0);
+  803188:	83 ec 0c             	sub    $0xc,%esp
+  80318b:	ff 75 f4             	push   -0xc(%ebp)
+  80318e:	e8 4e f0 ff ff       	call   8021e1 <fd2data>
+  803193:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803195:	83 c4 0c             	add    $0xc,%esp
+  803198:	68 07 04 00 00       	push   $0x407
+  80319d:	50                   	push   %eax
+  80319e:	6a 00                	push   $0x0
+  8031a0:	e8 2e dd ff ff       	call   800ed3 <sys_page_alloc>
+  8031a5:	89 c3                	mov    %eax,%ebx
+  8031a7:	83 c4 10             	add    $0x10,%esp
+  8031aa:	85 c0                	test   %eax,%eax
+  8031ac:	0f 88 82 00 00 00    	js     803234 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031b2:	83 ec 0c             	sub    $0xc,%esp
+  8031b5:	ff 75 f0             	push   -0x10(%ebp)
+  8031b8:	e8 24 f0 ff ff       	call   8021e1 <fd2data>
+  8031bd:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8031c4:	50                   	push   %eax
+  8031c5:	6a 00                	push   $0x0
+  8031c7:	56                   	push   %esi
+  8031c8:	6a 00                	push   $0x0
+  8031ca:	e8 71 dd ff ff       	call   800f40 <sys_page_map>
+  8031cf:	89 c3                	mov    %eax,%ebx
+  8031d1:	83 c4 20             	add    $0x20,%esp
+  8031d4:	85 c0                	test   %eax,%eax
+  8031d6:	78 4e                	js     803226 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031d8:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8031dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031e0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031e5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031ec:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031ef:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031f4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031fb:	83 ec 0c             	sub    $0xc,%esp
+  8031fe:	ff 75 f4             	push   -0xc(%ebp)
+  803201:	e8 cb ef ff ff       	call   8021d1 <fd2num>
+  803206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803209:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80320b:	83 c4 04             	add    $0x4,%esp
+  80320e:	ff 75 f0             	push   -0x10(%ebp)
+  803211:	e8 bb ef ff ff       	call   8021d1 <fd2num>
+  803216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803219:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80321c:	83 c4 10             	add    $0x10,%esp
+  80321f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803224:	eb 2e                	jmp    803254 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803226:	83 ec 08             	sub    $0x8,%esp
+  803229:	56                   	push   %esi
+  80322a:	6a 00                	push   $0x0
+  80322c:	e8 7d dd ff ff       	call   800fae <sys_page_unmap>
+  803231:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803234:	83 ec 08             	sub    $0x8,%esp
+  803237:	ff 75 f0             	push   -0x10(%ebp)
+  80323a:	6a 00                	push   $0x0
+  80323c:	e8 6d dd ff ff       	call   800fae <sys_page_unmap>
+  803241:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803244:	83 ec 08             	sub    $0x8,%esp
+  803247:	ff 75 f4             	push   -0xc(%ebp)
+  80324a:	6a 00                	push   $0x0
+  80324c:	e8 5d dd ff ff       	call   800fae <sys_page_unmap>
+  803251:	83 c4 10             	add    $0x10,%esp
+}
+  803254:	89 d8                	mov    %ebx,%eax
+  803256:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803259:	5b                   	pop    %ebx
+  80325a:	5e                   	pop    %esi
+  80325b:	5d                   	pop    %ebp
+  80325c:	c3                   	ret
+
+0080325d <pipeisclosed>:
+{
+  80325d:	55                   	push   %ebp
+  80325e:	89 e5                	mov    %esp,%ebp
+  803260:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803263:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803266:	50                   	push   %eax
+  803267:	ff 75 08             	push   0x8(%ebp)
+  80326a:	e8 df ef ff ff       	call   80224e <fd_lookup>
+  80326f:	83 c4 10             	add    $0x10,%esp
+  803272:	85 c0                	test   %eax,%eax
+  803274:	78 18                	js     80328e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803276:	83 ec 0c             	sub    $0xc,%esp
+  803279:	ff 75 f4             	push   -0xc(%ebp)
+  80327c:	e8 60 ef ff ff       	call   8021e1 <fd2data>
+  803281:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803283:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803286:	e8 cb fc ff ff       	call   802f56 <_pipeisclosed>
+  80328b:	83 c4 10             	add    $0x10,%esp
+}
+  80328e:	c9                   	leave
+  80328f:	c3                   	ret
+
+00803290 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803290:	b8 00 00 00 00       	mov    $0x0,%eax
+  803295:	c3                   	ret
+
+00803296 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803296:	55                   	push   %ebp
+  803297:	89 e5                	mov    %esp,%ebp
+  803299:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80329c:	68 76 3b 80 00       	push   $0x803b76
+  8032a1:	ff 75 0c             	push   0xc(%ebp)
+  8032a4:	e8 32 d7 ff ff       	call   8009db <strcpy>
+	return 0;
+}
+  8032a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ae:	c9                   	leave
+  8032af:	c3                   	ret
+
+008032b0 <devcons_write>:
+{
+  8032b0:	55                   	push   %ebp
+  8032b1:	89 e5                	mov    %esp,%ebp
+  8032b3:	57                   	push   %edi
+  8032b4:	56                   	push   %esi
+  8032b5:	53                   	push   %ebx
+  8032b6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8032bc:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8032c1:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8032c7:	eb 2e                	jmp    8032f7 <devcons_write+0x47>
+		m = n - tot;
+  8032c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8032cc:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8032ce:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8032d3:	39 c3                	cmp    %eax,%ebx
+  8032d5:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8032d8:	83 ec 04             	sub    $0x4,%esp
+  8032db:	53                   	push   %ebx
+  8032dc:	89 f0                	mov    %esi,%eax
+  8032de:	03 45 0c             	add    0xc(%ebp),%eax
+  8032e1:	50                   	push   %eax
+  8032e2:	57                   	push   %edi
+  8032e3:	e8 79 d8 ff ff       	call   800b61 <memmove>
+		sys_cputs(buf, m);
+  8032e8:	83 c4 08             	add    $0x8,%esp
+  8032eb:	53                   	push   %ebx
+  8032ec:	57                   	push   %edi
+  8032ed:	e8 62 da ff ff       	call   800d54 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8032f2:	01 de                	add    %ebx,%esi
+  8032f4:	83 c4 10             	add    $0x10,%esp
+  8032f7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8032fa:	72 cd                	jb     8032c9 <devcons_write+0x19>
+}
+  8032fc:	89 f0                	mov    %esi,%eax
+  8032fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803301:	5b                   	pop    %ebx
+  803302:	5e                   	pop    %esi
+  803303:	5f                   	pop    %edi
+  803304:	5d                   	pop    %ebp
+  803305:	c3                   	ret
+
+00803306 <devcons_read>:
+{
+  803306:	55                   	push   %ebp
+  803307:	89 e5                	mov    %esp,%ebp
+  803309:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80330c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803311:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803315:	75 07                	jne    80331e <devcons_read+0x18>
+  803317:	eb 1f                	jmp    803338 <devcons_read+0x32>
+		sys_yield();
+  803319:	e8 6f db ff ff       	call   800e8d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80331e:	e8 75 da ff ff       	call   800d98 <sys_cgetc>
+  803323:	85 c0                	test   %eax,%eax
+  803325:	74 f2                	je     803319 <devcons_read+0x13>
+	if (c < 0)
+  803327:	78 0f                	js     803338 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803329:	83 f8 04             	cmp    $0x4,%eax
+  80332c:	74 0c                	je     80333a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80332e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803331:	88 02                	mov    %al,(%edx)
+	return 1;
+  803333:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803338:	c9                   	leave
+  803339:	c3                   	ret
+		return 0;
+  80333a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333f:	eb f7                	jmp    803338 <devcons_read+0x32>
+
+00803341 <cputchar>:
+{
+  803341:	55                   	push   %ebp
+  803342:	89 e5                	mov    %esp,%ebp
+  803344:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803347:	8b 45 08             	mov    0x8(%ebp),%eax
+  80334a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80334d:	6a 01                	push   $0x1
+  80334f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803352:	50                   	push   %eax
+  803353:	e8 fc d9 ff ff       	call   800d54 <sys_cputs>
+}
+  803358:	83 c4 10             	add    $0x10,%esp
+  80335b:	c9                   	leave
+  80335c:	c3                   	ret
+
+0080335d <getchar>:
+{
+  80335d:	55                   	push   %ebp
+  80335e:	89 e5                	mov    %esp,%ebp
+  803360:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803363:	6a 01                	push   $0x1
+  803365:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803368:	50                   	push   %eax
+  803369:	6a 00                	push   $0x0
+  80336b:	e8 64 f1 ff ff       	call   8024d4 <read>
+	if (r < 0)
+  803370:	83 c4 10             	add    $0x10,%esp
+  803373:	85 c0                	test   %eax,%eax
+  803375:	78 06                	js     80337d <getchar+0x20>
+	if (r < 1)
+  803377:	74 06                	je     80337f <getchar+0x22>
+	return c;
+  803379:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80337d:	c9                   	leave
+  80337e:	c3                   	ret
+		return -E_EOF;
+  80337f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803384:	eb f7                	jmp    80337d <getchar+0x20>
+
+00803386 <iscons>:
+{
+  803386:	55                   	push   %ebp
+  803387:	89 e5                	mov    %esp,%ebp
+  803389:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80338c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80338f:	50                   	push   %eax
+  803390:	ff 75 08             	push   0x8(%ebp)
+  803393:	e8 b6 ee ff ff       	call   80224e <fd_lookup>
+  803398:	83 c4 10             	add    $0x10,%esp
+  80339b:	85 c0                	test   %eax,%eax
+  80339d:	78 11                	js     8033b0 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80339f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033a2:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8033a8:	39 10                	cmp    %edx,(%eax)
+  8033aa:	0f 94 c0             	sete   %al
+  8033ad:	0f b6 c0             	movzbl %al,%eax
+}
+  8033b0:	c9                   	leave
+  8033b1:	c3                   	ret
+
+008033b2 <opencons>:
+{
+  8033b2:	55                   	push   %ebp
+  8033b3:	89 e5                	mov    %esp,%ebp
+  8033b5:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8033b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033bb:	50                   	push   %eax
+  8033bc:	e8 37 ee ff ff       	call   8021f8 <fd_alloc>
+  8033c1:	83 c4 10             	add    $0x10,%esp
+  8033c4:	85 c0                	test   %eax,%eax
+  8033c6:	78 3a                	js     803402 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8033c8:	83 ec 04             	sub    $0x4,%esp
+  8033cb:	68 07 04 00 00       	push   $0x407
+  8033d0:	ff 75 f4             	push   -0xc(%ebp)
+  8033d3:	6a 00                	push   $0x0
+  8033d5:	e8 f9 da ff ff       	call   800ed3 <sys_page_alloc>
+  8033da:	83 c4 10             	add    $0x10,%esp
+  8033dd:	85 c0                	test   %eax,%eax
+  8033df:	78 21                	js     803402 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8033e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033e4:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8033ea:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8033ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033ef:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8033f6:	83 ec 0c             	sub    $0xc,%esp
+  8033f9:	50                   	push   %eax
+  8033fa:	e8 d2 ed ff ff       	call   8021d1 <fd2num>
+  8033ff:	83 c4 10             	add    $0x10,%esp
+}
+  803402:	c9                   	leave
+  803403:	c3                   	ret
+
+00803404 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803404:	55                   	push   %ebp
+  803405:	89 e5                	mov    %esp,%ebp
+  803407:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  80340a:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803411:	74 0a                	je     80341d <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803413:	8b 45 08             	mov    0x8(%ebp),%eax
+  803416:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80341b:	c9                   	leave
+  80341c:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  80341d:	83 ec 04             	sub    $0x4,%esp
+  803420:	6a 07                	push   $0x7
+  803422:	68 00 f0 bf ee       	push   $0xeebff000
+  803427:	6a 00                	push   $0x0
+  803429:	e8 a5 da ff ff       	call   800ed3 <sys_page_alloc>
+  80342e:	83 c4 10             	add    $0x10,%esp
+  803431:	85 c0                	test   %eax,%eax
+  803433:	78 14                	js     803449 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803435:	83 ec 08             	sub    $0x8,%esp
+  803438:	68 6b 34 80 00       	push   $0x80346b
+  80343d:	6a 00                	push   $0x0
+  80343f:	e8 ab dc ff ff       	call   8010ef <sys_env_set_pgfault_upcall>
+  803444:	83 c4 10             	add    $0x10,%esp
+  803447:	eb ca                	jmp    803413 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  803449:	83 ec 08             	sub    $0x8,%esp
+  80344c:	50                   	push   %eax
+  80344d:	68 82 3b 80 00       	push   $0x803b82
+  803452:	e8 3c cf ff ff       	call   800393 <cprintf>
+			panic("set_pgfault_handler error");
+  803457:	83 c4 0c             	add    $0xc,%esp
+  80345a:	68 8d 3b 80 00       	push   $0x803b8d
+  80345f:	6a 24                	push   $0x24
+  803461:	68 a7 3b 80 00       	push   $0x803ba7
+  803466:	e8 4d ce ff ff       	call   8002b8 <_panic>
+
+0080346b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80346b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80346c:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803471:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803473:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803476:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80347a:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  80347d:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803481:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803483:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803487:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803488:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  80348c:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  80348d:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  80348e:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803492:	c3                   	ret
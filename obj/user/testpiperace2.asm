@@ -0,0 +1,7211 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a2 01 00 00       	call   8001d3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 28             	sub    $0x28,%esp
+	int p[2], r, i;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for pipeisclosed race...\n");
+  80003c:	68 80 34 80 00       	push   $0x803480
+  800041:	e8 2c 03 00 00       	call   800372 <cprintf>
+	if ((r = pipe(p)) < 0)
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	89 04 24             	mov    %eax,(%esp)
+  80004c:	e8 e7 2e 00 00       	call   802f38 <pipe>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 5e                	js     8000b6 <umain+0x83>
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+  800058:	e8 40 1d 00 00       	call   801d9d <fork>
+  80005d:	89 c7                	mov    %eax,%edi
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	78 65                	js     8000c8 <umain+0x95>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800063:	74 75                	je     8000da <umain+0xa7>
+	// pageref(p[0]) and gets 3, then it will return true when
+	// it shouldn't.
+	//
+	// So either way, pipeisclosed is going give a wrong answer.
+	//
+	kid = &envs[ENVX(r)];
+  800065:	89 fb                	mov    %edi,%ebx
+  800067:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (kid->env_status == ENV_RUNNABLE)
+  80006d:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  800073:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800079:	8b 43 54             	mov    0x54(%ebx),%eax
+  80007c:	83 f8 02             	cmp    $0x2,%eax
+  80007f:	0f 85 d1 00 00 00    	jne    800156 <umain+0x123>
+		if (pipeisclosed(p[0]) != 0) {
+  800085:	83 ec 0c             	sub    $0xc,%esp
+  800088:	ff 75 e0             	push   -0x20(%ebp)
+  80008b:	e8 f2 2f 00 00       	call   803082 <pipeisclosed>
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	85 c0                	test   %eax,%eax
+  800095:	74 e2                	je     800079 <umain+0x46>
+			cprintf("\nRACE: pipe appears closed\n");
+  800097:	83 ec 0c             	sub    $0xc,%esp
+  80009a:	68 f0 34 80 00       	push   $0x8034f0
+  80009f:	e8 ce 02 00 00       	call   800372 <cprintf>
+			sys_env_destroy(r);
+  8000a4:	89 3c 24             	mov    %edi,(%esp)
+  8000a7:	e8 11 0d 00 00       	call   800dbd <sys_env_destroy>
+			exit();
+  8000ac:	e8 cc 01 00 00       	call   80027d <exit>
+  8000b1:	83 c4 10             	add    $0x10,%esp
+  8000b4:	eb c3                	jmp    800079 <umain+0x46>
+		panic("pipe: %e", r);
+  8000b6:	50                   	push   %eax
+  8000b7:	68 ce 34 80 00       	push   $0x8034ce
+  8000bc:	6a 0d                	push   $0xd
+  8000be:	68 d7 34 80 00       	push   $0x8034d7
+  8000c3:	e8 cf 01 00 00       	call   800297 <_panic>
+		panic("fork: %e", r);
+  8000c8:	50                   	push   %eax
+  8000c9:	68 d0 39 80 00       	push   $0x8039d0
+  8000ce:	6a 0f                	push   $0xf
+  8000d0:	68 d7 34 80 00       	push   $0x8034d7
+  8000d5:	e8 bd 01 00 00       	call   800297 <_panic>
+		close(p[1]);
+  8000da:	83 ec 0c             	sub    $0xc,%esp
+  8000dd:	ff 75 e4             	push   -0x1c(%ebp)
+  8000e0:	e8 12 21 00 00       	call   8021f7 <close>
+  8000e5:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 200; i++) {
+  8000e8:	89 fb                	mov    %edi,%ebx
+			if (i % 10 == 0)
+  8000ea:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000ef:	eb 31                	jmp    800122 <umain+0xef>
+			dup(p[0], 10);
+  8000f1:	83 ec 08             	sub    $0x8,%esp
+  8000f4:	6a 0a                	push   $0xa
+  8000f6:	ff 75 e0             	push   -0x20(%ebp)
+  8000f9:	e8 4b 21 00 00       	call   802249 <dup>
+			sys_yield();
+  8000fe:	e8 69 0d 00 00       	call   800e6c <sys_yield>
+			close(10);
+  800103:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  80010a:	e8 e8 20 00 00       	call   8021f7 <close>
+			sys_yield();
+  80010f:	e8 58 0d 00 00       	call   800e6c <sys_yield>
+		for (i = 0; i < 200; i++) {
+  800114:	83 c3 01             	add    $0x1,%ebx
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  800120:	74 2a                	je     80014c <umain+0x119>
+			if (i % 10 == 0)
+  800122:	89 d8                	mov    %ebx,%eax
+  800124:	f7 ee                	imul   %esi
+  800126:	c1 fa 02             	sar    $0x2,%edx
+  800129:	89 d8                	mov    %ebx,%eax
+  80012b:	c1 f8 1f             	sar    $0x1f,%eax
+  80012e:	29 c2                	sub    %eax,%edx
+  800130:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800133:	01 c0                	add    %eax,%eax
+  800135:	39 c3                	cmp    %eax,%ebx
+  800137:	75 b8                	jne    8000f1 <umain+0xbe>
+				cprintf("%d.", i);
+  800139:	83 ec 08             	sub    $0x8,%esp
+  80013c:	53                   	push   %ebx
+  80013d:	68 ec 34 80 00       	push   $0x8034ec
+  800142:	e8 2b 02 00 00       	call   800372 <cprintf>
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	eb a5                	jmp    8000f1 <umain+0xbe>
+		exit();
+  80014c:	e8 2c 01 00 00       	call   80027d <exit>
+  800151:	e9 0f ff ff ff       	jmp    800065 <umain+0x32>
+		}
+	cprintf("child done with loop\n");
+  800156:	83 ec 0c             	sub    $0xc,%esp
+  800159:	68 0c 35 80 00       	push   $0x80350c
+  80015e:	e8 0f 02 00 00       	call   800372 <cprintf>
+	if (pipeisclosed(p[0]))
+  800163:	83 c4 04             	add    $0x4,%esp
+  800166:	ff 75 e0             	push   -0x20(%ebp)
+  800169:	e8 14 2f 00 00       	call   803082 <pipeisclosed>
+  80016e:	83 c4 10             	add    $0x10,%esp
+  800171:	85 c0                	test   %eax,%eax
+  800173:	75 38                	jne    8001ad <umain+0x17a>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800175:	83 ec 08             	sub    $0x8,%esp
+  800178:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80017b:	50                   	push   %eax
+  80017c:	ff 75 e0             	push   -0x20(%ebp)
+  80017f:	e8 29 1f 00 00       	call   8020ad <fd_lookup>
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	85 c0                	test   %eax,%eax
+  800189:	78 36                	js     8001c1 <umain+0x18e>
+		panic("cannot look up p[0]: %e", r);
+	(void) fd2data(fd);
+  80018b:	83 ec 0c             	sub    $0xc,%esp
+  80018e:	ff 75 dc             	push   -0x24(%ebp)
+  800191:	e8 aa 1e 00 00       	call   802040 <fd2data>
+	cprintf("race didn't happen\n");
+  800196:	c7 04 24 3a 35 80 00 	movl   $0x80353a,(%esp)
+  80019d:	e8 d0 01 00 00       	call   800372 <cprintf>
+}
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a8:	5b                   	pop    %ebx
+  8001a9:	5e                   	pop    %esi
+  8001aa:	5f                   	pop    %edi
+  8001ab:	5d                   	pop    %ebp
+  8001ac:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001ad:	83 ec 04             	sub    $0x4,%esp
+  8001b0:	68 a4 34 80 00       	push   $0x8034a4
+  8001b5:	6a 40                	push   $0x40
+  8001b7:	68 d7 34 80 00       	push   $0x8034d7
+  8001bc:	e8 d6 00 00 00       	call   800297 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c1:	50                   	push   %eax
+  8001c2:	68 22 35 80 00       	push   $0x803522
+  8001c7:	6a 42                	push   $0x42
+  8001c9:	68 d7 34 80 00       	push   $0x8034d7
+  8001ce:	e8 c4 00 00 00       	call   800297 <_panic>
+
+008001d3 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	57                   	push   %edi
+  8001d7:	56                   	push   %esi
+  8001d8:	53                   	push   %ebx
+  8001d9:	83 ec 0c             	sub    $0xc,%esp
+  8001dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8001df:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001e7:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8001e9:	c1 ea 0b             	shr    $0xb,%edx
+  8001ec:	83 f2 01             	xor    $0x1,%edx
+  8001ef:	83 e2 01             	and    $0x1,%edx
+  8001f2:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8001f8:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8001ff:	00 00 00 
+	envid = sys_getenvid();
+  800202:	e8 1f 0c 00 00       	call   800e26 <sys_getenvid>
+  800207:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800209:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80020e:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800214:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80021a:	8b 52 48             	mov    0x48(%edx),%edx
+  80021d:	39 ca                	cmp    %ecx,%edx
+  80021f:	74 27                	je     800248 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800221:	83 c0 01             	add    $0x1,%eax
+  800224:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800229:	75 e3                	jne    80020e <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80022b:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800232:	75 24                	jne    800258 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800234:	83 ec 04             	sub    $0x4,%esp
+  800237:	68 50 35 80 00       	push   $0x803550
+  80023c:	6a 23                	push   $0x23
+  80023e:	68 73 35 80 00       	push   $0x803573
+  800243:	e8 4f 00 00 00       	call   800297 <_panic>
+			mainenv = &envs[i];
+  800248:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80024e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800253:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800258:	85 ff                	test   %edi,%edi
+  80025a:	7e 07                	jle    800263 <libmain+0x90>
+		binaryname = argv[0];
+  80025c:	8b 06                	mov    (%esi),%eax
+  80025e:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800263:	83 ec 08             	sub    $0x8,%esp
+  800266:	56                   	push   %esi
+  800267:	57                   	push   %edi
+  800268:	e8 c6 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80026d:	e8 0b 00 00 00       	call   80027d <exit>
+}
+  800272:	83 c4 10             	add    $0x10,%esp
+  800275:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800278:	5b                   	pop    %ebx
+  800279:	5e                   	pop    %esi
+  80027a:	5f                   	pop    %edi
+  80027b:	5d                   	pop    %ebp
+  80027c:	c3                   	ret
+
+0080027d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800283:	e8 9c 1f 00 00       	call   802224 <close_all>
+	sys_env_destroy(0);
+  800288:	83 ec 0c             	sub    $0xc,%esp
+  80028b:	6a 00                	push   $0x0
+  80028d:	e8 2b 0b 00 00       	call   800dbd <sys_env_destroy>
+}
+  800292:	83 c4 10             	add    $0x10,%esp
+  800295:	c9                   	leave
+  800296:	c3                   	ret
+
+00800297 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	56                   	push   %esi
+  80029b:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80029c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80029f:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002a5:	e8 7c 0b 00 00       	call   800e26 <sys_getenvid>
+  8002aa:	83 ec 0c             	sub    $0xc,%esp
+  8002ad:	ff 75 0c             	push   0xc(%ebp)
+  8002b0:	ff 75 08             	push   0x8(%ebp)
+  8002b3:	56                   	push   %esi
+  8002b4:	50                   	push   %eax
+  8002b5:	68 8c 35 80 00       	push   $0x80358c
+  8002ba:	e8 b3 00 00 00       	call   800372 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002bf:	83 c4 18             	add    $0x18,%esp
+  8002c2:	53                   	push   %ebx
+  8002c3:	ff 75 10             	push   0x10(%ebp)
+  8002c6:	e8 56 00 00 00       	call   800321 <vcprintf>
+	cprintf("\n");
+  8002cb:	c7 04 24 0f 3b 80 00 	movl   $0x803b0f,(%esp)
+  8002d2:	e8 9b 00 00 00       	call   800372 <cprintf>
+  8002d7:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002da:	cc                   	int3
+	while (1)
+  8002db:	eb fd                	jmp    8002da <_panic+0x43>
+
+008002dd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	53                   	push   %ebx
+  8002e1:	83 ec 04             	sub    $0x4,%esp
+  8002e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002e7:	8b 13                	mov    (%ebx),%edx
+  8002e9:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ec:	89 03                	mov    %eax,(%ebx)
+  8002ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002f1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002f5:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002fa:	74 09                	je     800305 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002fc:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800300:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800303:	c9                   	leave
+  800304:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800305:	83 ec 08             	sub    $0x8,%esp
+  800308:	68 ff 00 00 00       	push   $0xff
+  80030d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800310:	50                   	push   %eax
+  800311:	e8 1d 0a 00 00       	call   800d33 <sys_cputs>
+		b->idx = 0;
+  800316:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	eb db                	jmp    8002fc <putch+0x1f>
+
+00800321 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800321:	55                   	push   %ebp
+  800322:	89 e5                	mov    %esp,%ebp
+  800324:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80032a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800331:	00 00 00 
+	b.cnt = 0;
+  800334:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80033b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80033e:	ff 75 0c             	push   0xc(%ebp)
+  800341:	ff 75 08             	push   0x8(%ebp)
+  800344:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80034a:	50                   	push   %eax
+  80034b:	68 dd 02 80 00       	push   $0x8002dd
+  800350:	e8 fb 00 00 00       	call   800450 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800355:	83 c4 08             	add    $0x8,%esp
+  800358:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80035e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800364:	50                   	push   %eax
+  800365:	e8 c9 09 00 00       	call   800d33 <sys_cputs>
+
+	return b.cnt;
+}
+  80036a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800370:	c9                   	leave
+  800371:	c3                   	ret
+
+00800372 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800372:	55                   	push   %ebp
+  800373:	89 e5                	mov    %esp,%ebp
+  800375:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800378:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80037b:	50                   	push   %eax
+  80037c:	ff 75 08             	push   0x8(%ebp)
+  80037f:	e8 9d ff ff ff       	call   800321 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800384:	c9                   	leave
+  800385:	c3                   	ret
+
+00800386 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800386:	55                   	push   %ebp
+  800387:	89 e5                	mov    %esp,%ebp
+  800389:	57                   	push   %edi
+  80038a:	56                   	push   %esi
+  80038b:	53                   	push   %ebx
+  80038c:	83 ec 1c             	sub    $0x1c,%esp
+  80038f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800392:	89 d6                	mov    %edx,%esi
+  800394:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800397:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80039a:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80039d:	73 0b                	jae    8003aa <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  80039f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003a2:	c1 e7 08             	shl    $0x8,%edi
+  8003a5:	0b 7d 10             	or     0x10(%ebp),%edi
+  8003a8:	eb 36                	jmp    8003e0 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8003aa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b2:	f7 75 08             	divl   0x8(%ebp)
+  8003b5:	89 c1                	mov    %eax,%ecx
+  8003b7:	ff 75 14             	push   0x14(%ebp)
+  8003ba:	ff 75 10             	push   0x10(%ebp)
+  8003bd:	83 eb 01             	sub    $0x1,%ebx
+  8003c0:	53                   	push   %ebx
+  8003c1:	ff 75 08             	push   0x8(%ebp)
+  8003c4:	89 f2                	mov    %esi,%edx
+  8003c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003c9:	e8 b8 ff ff ff       	call   800386 <printnum>
+  8003ce:	83 c4 10             	add    $0x10,%esp
+  8003d1:	eb 14                	jmp    8003e7 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8003d3:	83 ec 08             	sub    $0x8,%esp
+  8003d6:	56                   	push   %esi
+  8003d7:	57                   	push   %edi
+  8003d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003db:	ff d0                	call   *%eax
+  8003dd:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003e0:	83 eb 01             	sub    $0x1,%ebx
+  8003e3:	85 db                	test   %ebx,%ebx
+  8003e5:	7f ec                	jg     8003d3 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	56                   	push   %esi
+  8003eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f3:	f7 75 08             	divl   0x8(%ebp)
+  8003f6:	0f be 92 af 35 80 00 	movsbl 0x8035af(%edx),%edx
+  8003fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800400:	c1 e0 08             	shl    $0x8,%eax
+  800403:	09 d0                	or     %edx,%eax
+  800405:	50                   	push   %eax
+  800406:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800409:	ff d0                	call   *%eax
+}
+  80040b:	83 c4 10             	add    $0x10,%esp
+  80040e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800411:	5b                   	pop    %ebx
+  800412:	5e                   	pop    %esi
+  800413:	5f                   	pop    %edi
+  800414:	5d                   	pop    %ebp
+  800415:	c3                   	ret
+
+00800416 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800416:	55                   	push   %ebp
+  800417:	89 e5                	mov    %esp,%ebp
+  800419:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80041c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800420:	8b 10                	mov    (%eax),%edx
+  800422:	3b 50 04             	cmp    0x4(%eax),%edx
+  800425:	73 0a                	jae    800431 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800427:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80042a:	89 08                	mov    %ecx,(%eax)
+  80042c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80042f:	88 02                	mov    %al,(%edx)
+}
+  800431:	5d                   	pop    %ebp
+  800432:	c3                   	ret
+
+00800433 <printfmt>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800439:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80043c:	50                   	push   %eax
+  80043d:	ff 75 10             	push   0x10(%ebp)
+  800440:	ff 75 0c             	push   0xc(%ebp)
+  800443:	ff 75 08             	push   0x8(%ebp)
+  800446:	e8 05 00 00 00       	call   800450 <vprintfmt>
+}
+  80044b:	83 c4 10             	add    $0x10,%esp
+  80044e:	c9                   	leave
+  80044f:	c3                   	ret
+
+00800450 <vprintfmt>:
+{
+  800450:	55                   	push   %ebp
+  800451:	89 e5                	mov    %esp,%ebp
+  800453:	57                   	push   %edi
+  800454:	56                   	push   %esi
+  800455:	53                   	push   %ebx
+  800456:	83 ec 3c             	sub    $0x3c,%esp
+  800459:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80045c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80045f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800466:	eb 16                	jmp    80047e <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800468:	83 ec 08             	sub    $0x8,%esp
+  80046b:	ff 75 0c             	push   0xc(%ebp)
+  80046e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800471:	c1 e2 08             	shl    $0x8,%edx
+  800474:	09 d0                	or     %edx,%eax
+  800476:	50                   	push   %eax
+  800477:	ff d7                	call   *%edi
+  800479:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80047c:	89 de                	mov    %ebx,%esi
+  80047e:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800481:	0f b6 06             	movzbl (%esi),%eax
+  800484:	83 f8 25             	cmp    $0x25,%eax
+  800487:	74 0c                	je     800495 <vprintfmt+0x45>
+			if (ch == '\0')
+  800489:	85 c0                	test   %eax,%eax
+  80048b:	75 db                	jne    800468 <vprintfmt+0x18>
+}
+  80048d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800490:	5b                   	pop    %ebx
+  800491:	5e                   	pop    %esi
+  800492:	5f                   	pop    %edi
+  800493:	5d                   	pop    %ebp
+  800494:	c3                   	ret
+		padc = ' ';
+  800495:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  800499:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004a0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004a7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b3:	8d 73 01             	lea    0x1(%ebx),%esi
+  8004b6:	0f b6 13             	movzbl (%ebx),%edx
+  8004b9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004bc:	3c 55                	cmp    $0x55,%al
+  8004be:	0f 87 2c 04 00 00    	ja     8008f0 <vprintfmt+0x4a0>
+  8004c4:	0f b6 c0             	movzbl %al,%eax
+  8004c7:	ff 24 85 00 37 80 00 	jmp    *0x803700(,%eax,4)
+  8004ce:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8004d0:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8004d4:	eb dd                	jmp    8004b3 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d6:	89 f3                	mov    %esi,%ebx
+  8004d8:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8004dc:	eb d5                	jmp    8004b3 <vprintfmt+0x63>
+  8004de:	0f b6 d2             	movzbl %dl,%edx
+  8004e1:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8004e3:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8004e8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004eb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004ef:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8004f2:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8004f5:	83 fe 09             	cmp    $0x9,%esi
+  8004f8:	0f 87 8a 00 00 00    	ja     800588 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8004fe:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800501:	eb e5                	jmp    8004e8 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800503:	8b 45 14             	mov    0x14(%ebp),%eax
+  800506:	8b 00                	mov    (%eax),%eax
+  800508:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80050b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050e:	8d 40 04             	lea    0x4(%eax),%eax
+  800511:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800514:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800516:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80051a:	79 97                	jns    8004b3 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80051c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80051f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800522:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800529:	eb 88                	jmp    8004b3 <vprintfmt+0x63>
+			if (width < 0)
+  80052b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80052e:	85 db                	test   %ebx,%ebx
+  800530:	b8 00 00 00 00       	mov    $0x0,%eax
+  800535:	0f 49 c3             	cmovns %ebx,%eax
+  800538:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80053b:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  80053d:	e9 71 ff ff ff       	jmp    8004b3 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800542:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800544:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80054b:	e9 63 ff ff ff       	jmp    8004b3 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800550:	8d 73 02             	lea    0x2(%ebx),%esi
+  800553:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800557:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80055e:	3c 67                	cmp    $0x67,%al
+  800560:	0f 84 18 ff ff ff    	je     80047e <vprintfmt+0x2e>
+					attrib = 0x04;
+  800566:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80056d:	3c 72                	cmp    $0x72,%al
+  80056f:	0f 84 09 ff ff ff    	je     80047e <vprintfmt+0x2e>
+					attrib = 0x00;
+  800575:	3c 62                	cmp    $0x62,%al
+  800577:	0f 94 c0             	sete   %al
+  80057a:	0f b6 c0             	movzbl %al,%eax
+  80057d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800580:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800583:	e9 f6 fe ff ff       	jmp    80047e <vprintfmt+0x2e>
+  800588:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80058b:	eb 89                	jmp    800516 <vprintfmt+0xc6>
+			lflag++;
+  80058d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800590:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800592:	e9 1c ff ff ff       	jmp    8004b3 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8d 58 04             	lea    0x4(%eax),%ebx
+  80059d:	83 ec 08             	sub    $0x8,%esp
+  8005a0:	ff 75 0c             	push   0xc(%ebp)
+  8005a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005a6:	c1 e0 08             	shl    $0x8,%eax
+  8005a9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005ac:	0b 01                	or     (%ecx),%eax
+  8005ae:	50                   	push   %eax
+  8005af:	ff d7                	call   *%edi
+			break;
+  8005b1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005b4:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8005b7:	e9 c2 fe ff ff       	jmp    80047e <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8005bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bf:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8005c2:	8b 10                	mov    (%eax),%edx
+  8005c4:	89 d0                	mov    %edx,%eax
+  8005c6:	f7 d8                	neg    %eax
+  8005c8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005cb:	83 f8 12             	cmp    $0x12,%eax
+  8005ce:	7f 25                	jg     8005f5 <vprintfmt+0x1a5>
+  8005d0:	8b 14 85 60 38 80 00 	mov    0x803860(,%eax,4),%edx
+  8005d7:	85 d2                	test   %edx,%edx
+  8005d9:	74 1a                	je     8005f5 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8005db:	52                   	push   %edx
+  8005dc:	68 a2 39 80 00       	push   $0x8039a2
+  8005e1:	ff 75 0c             	push   0xc(%ebp)
+  8005e4:	57                   	push   %edi
+  8005e5:	e8 49 fe ff ff       	call   800433 <printfmt>
+  8005ea:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005ed:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8005f0:	e9 89 fe ff ff       	jmp    80047e <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8005f5:	50                   	push   %eax
+  8005f6:	68 c7 35 80 00       	push   $0x8035c7
+  8005fb:	ff 75 0c             	push   0xc(%ebp)
+  8005fe:	57                   	push   %edi
+  8005ff:	e8 2f fe ff ff       	call   800433 <printfmt>
+  800604:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800607:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80060a:	e9 6f fe ff ff       	jmp    80047e <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80060f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800612:	83 c0 04             	add    $0x4,%eax
+  800615:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80061d:	85 c9                	test   %ecx,%ecx
+  80061f:	b8 c0 35 80 00       	mov    $0x8035c0,%eax
+  800624:	0f 45 c1             	cmovne %ecx,%eax
+  800627:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80062a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80062e:	7e 06                	jle    800636 <vprintfmt+0x1e6>
+  800630:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800634:	75 1a                	jne    800650 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800636:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800639:	c1 e0 08             	shl    $0x8,%eax
+  80063c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80063f:	83 c8 3f             	or     $0x3f,%eax
+  800642:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800645:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800648:	89 75 10             	mov    %esi,0x10(%ebp)
+  80064b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80064e:	eb 6d                	jmp    8006bd <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	ff 75 d0             	push   -0x30(%ebp)
+  800656:	ff 75 c8             	push   -0x38(%ebp)
+  800659:	e8 39 03 00 00       	call   800997 <strnlen>
+  80065e:	89 c2                	mov    %eax,%edx
+  800660:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800663:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800665:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800668:	c1 e1 08             	shl    $0x8,%ecx
+  80066b:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80066f:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800671:	83 c4 10             	add    $0x10,%esp
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800679:	89 75 10             	mov    %esi,0x10(%ebp)
+  80067c:	89 ce                	mov    %ecx,%esi
+  80067e:	eb 0f                	jmp    80068f <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800680:	83 ec 08             	sub    $0x8,%esp
+  800683:	ff 75 0c             	push   0xc(%ebp)
+  800686:	56                   	push   %esi
+  800687:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800689:	83 eb 01             	sub    $0x1,%ebx
+  80068c:	83 c4 10             	add    $0x10,%esp
+  80068f:	85 db                	test   %ebx,%ebx
+  800691:	7f ed                	jg     800680 <vprintfmt+0x230>
+  800693:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800696:	8b 75 10             	mov    0x10(%ebp),%esi
+  800699:	85 c0                	test   %eax,%eax
+  80069b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006a0:	0f 49 d0             	cmovns %eax,%edx
+  8006a3:	29 d0                	sub    %edx,%eax
+  8006a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006a8:	eb 8c                	jmp    800636 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8006aa:	83 ec 08             	sub    $0x8,%esp
+  8006ad:	ff 75 0c             	push   0xc(%ebp)
+  8006b0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006b3:	09 c2                	or     %eax,%edx
+  8006b5:	52                   	push   %edx
+  8006b6:	ff d7                	call   *%edi
+  8006b8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006bb:	89 d9                	mov    %ebx,%ecx
+  8006bd:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8006c0:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8006c4:	0f be d0             	movsbl %al,%edx
+  8006c7:	85 d2                	test   %edx,%edx
+  8006c9:	74 2a                	je     8006f5 <vprintfmt+0x2a5>
+  8006cb:	85 f6                	test   %esi,%esi
+  8006cd:	78 05                	js     8006d4 <vprintfmt+0x284>
+  8006cf:	83 ee 01             	sub    $0x1,%esi
+  8006d2:	78 3b                	js     80070f <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006d4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006d8:	74 d0                	je     8006aa <vprintfmt+0x25a>
+  8006da:	0f be c0             	movsbl %al,%eax
+  8006dd:	83 e8 20             	sub    $0x20,%eax
+  8006e0:	83 f8 5e             	cmp    $0x5e,%eax
+  8006e3:	76 c5                	jbe    8006aa <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8006e5:	83 ec 08             	sub    $0x8,%esp
+  8006e8:	ff 75 0c             	push   0xc(%ebp)
+  8006eb:	ff 75 cc             	push   -0x34(%ebp)
+  8006ee:	ff d7                	call   *%edi
+  8006f0:	83 c4 10             	add    $0x10,%esp
+  8006f3:	eb c6                	jmp    8006bb <vprintfmt+0x26b>
+  8006f5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006f8:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8006fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006fe:	01 c3                	add    %eax,%ebx
+  800700:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800702:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800705:	83 c8 20             	or     $0x20,%eax
+  800708:	89 75 10             	mov    %esi,0x10(%ebp)
+  80070b:	89 c6                	mov    %eax,%esi
+  80070d:	eb 14                	jmp    800723 <vprintfmt+0x2d3>
+  80070f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800712:	eb e4                	jmp    8006f8 <vprintfmt+0x2a8>
+  800714:	83 ec 08             	sub    $0x8,%esp
+  800717:	ff 75 0c             	push   0xc(%ebp)
+  80071a:	56                   	push   %esi
+  80071b:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80071d:	83 eb 01             	sub    $0x1,%ebx
+  800720:	83 c4 10             	add    $0x10,%esp
+  800723:	85 db                	test   %ebx,%ebx
+  800725:	7f ed                	jg     800714 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800727:	8b 75 10             	mov    0x10(%ebp),%esi
+  80072a:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  80072d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800730:	e9 49 fd ff ff       	jmp    80047e <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800735:	83 f9 01             	cmp    $0x1,%ecx
+  800738:	7f 1f                	jg     800759 <vprintfmt+0x309>
+	else if (lflag)
+  80073a:	85 c9                	test   %ecx,%ecx
+  80073c:	74 69                	je     8007a7 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80073e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800741:	8b 00                	mov    (%eax),%eax
+  800743:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800746:	89 c1                	mov    %eax,%ecx
+  800748:	c1 f9 1f             	sar    $0x1f,%ecx
+  80074b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8d 40 04             	lea    0x4(%eax),%eax
+  800754:	89 45 14             	mov    %eax,0x14(%ebp)
+  800757:	eb 17                	jmp    800770 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800759:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075c:	8b 50 04             	mov    0x4(%eax),%edx
+  80075f:	8b 00                	mov    (%eax),%eax
+  800761:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800764:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800767:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076a:	8d 40 08             	lea    0x8(%eax),%eax
+  80076d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800770:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800773:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800776:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80077b:	85 db                	test   %ebx,%ebx
+  80077d:	0f 89 f6 00 00 00    	jns    800879 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800783:	83 ec 08             	sub    $0x8,%esp
+  800786:	ff 75 0c             	push   0xc(%ebp)
+  800789:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80078c:	c1 e0 08             	shl    $0x8,%eax
+  80078f:	83 c8 2d             	or     $0x2d,%eax
+  800792:	50                   	push   %eax
+  800793:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800795:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800798:	f7 d9                	neg    %ecx
+  80079a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80079d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8007a2:	e9 d2 00 00 00       	jmp    800879 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8007a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007aa:	8b 00                	mov    (%eax),%eax
+  8007ac:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007af:	89 c1                	mov    %eax,%ecx
+  8007b1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007b4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c0:	eb ae                	jmp    800770 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8007c2:	83 f9 01             	cmp    $0x1,%ecx
+  8007c5:	7f 19                	jg     8007e0 <vprintfmt+0x390>
+	else if (lflag)
+  8007c7:	85 c9                	test   %ecx,%ecx
+  8007c9:	74 2a                	je     8007f5 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8007cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ce:	8b 08                	mov    (%eax),%ecx
+  8007d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007d6:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8007db:	e9 99 00 00 00       	jmp    800879 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e3:	8b 08                	mov    (%eax),%ecx
+  8007e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8007f0:	e9 84 00 00 00       	jmp    800879 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f8:	8b 08                	mov    (%eax),%ecx
+  8007fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800800:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800805:	eb 72                	jmp    800879 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800807:	83 f9 01             	cmp    $0x1,%ecx
+  80080a:	7f 16                	jg     800822 <vprintfmt+0x3d2>
+	else if (lflag)
+  80080c:	85 c9                	test   %ecx,%ecx
+  80080e:	74 24                	je     800834 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800810:	8b 45 14             	mov    0x14(%ebp),%eax
+  800813:	8b 08                	mov    (%eax),%ecx
+  800815:	8d 40 04             	lea    0x4(%eax),%eax
+  800818:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80081b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800820:	eb 57                	jmp    800879 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800822:	8b 45 14             	mov    0x14(%ebp),%eax
+  800825:	8b 08                	mov    (%eax),%ecx
+  800827:	8d 40 08             	lea    0x8(%eax),%eax
+  80082a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80082d:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800832:	eb 45                	jmp    800879 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800834:	8b 45 14             	mov    0x14(%ebp),%eax
+  800837:	8b 08                	mov    (%eax),%ecx
+  800839:	8d 40 04             	lea    0x4(%eax),%eax
+  80083c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80083f:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800844:	eb 33                	jmp    800879 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800846:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800849:	c1 e3 08             	shl    $0x8,%ebx
+  80084c:	83 ec 08             	sub    $0x8,%esp
+  80084f:	ff 75 0c             	push   0xc(%ebp)
+  800852:	89 d8                	mov    %ebx,%eax
+  800854:	83 c8 30             	or     $0x30,%eax
+  800857:	50                   	push   %eax
+  800858:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80085a:	83 c4 08             	add    $0x8,%esp
+  80085d:	ff 75 0c             	push   0xc(%ebp)
+  800860:	83 cb 78             	or     $0x78,%ebx
+  800863:	53                   	push   %ebx
+  800864:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800866:	8b 45 14             	mov    0x14(%ebp),%eax
+  800869:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80086b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80086e:	8d 40 04             	lea    0x4(%eax),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800874:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800879:	ff 75 e4             	push   -0x1c(%ebp)
+  80087c:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800880:	52                   	push   %edx
+  800881:	ff 75 e0             	push   -0x20(%ebp)
+  800884:	50                   	push   %eax
+  800885:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800888:	89 f8                	mov    %edi,%eax
+  80088a:	e8 f7 fa ff ff       	call   800386 <printnum>
+			break;
+  80088f:	83 c4 10             	add    $0x10,%esp
+  800892:	e9 e7 fb ff ff       	jmp    80047e <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800897:	83 f9 01             	cmp    $0x1,%ecx
+  80089a:	7f 16                	jg     8008b2 <vprintfmt+0x462>
+	else if (lflag)
+  80089c:	85 c9                	test   %ecx,%ecx
+  80089e:	74 24                	je     8008c4 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 08                	mov    (%eax),%ecx
+  8008a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ab:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8008b0:	eb c7                	jmp    800879 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b5:	8b 08                	mov    (%eax),%ecx
+  8008b7:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008bd:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8008c2:	eb b5                	jmp    800879 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c7:	8b 08                	mov    (%eax),%ecx
+  8008c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008cf:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8008d4:	eb a3                	jmp    800879 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8008d6:	83 ec 08             	sub    $0x8,%esp
+  8008d9:	ff 75 0c             	push   0xc(%ebp)
+  8008dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008df:	c1 e0 08             	shl    $0x8,%eax
+  8008e2:	83 c8 25             	or     $0x25,%eax
+  8008e5:	50                   	push   %eax
+  8008e6:	ff d7                	call   *%edi
+			break;
+  8008e8:	83 c4 10             	add    $0x10,%esp
+  8008eb:	e9 8e fb ff ff       	jmp    80047e <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	ff 75 0c             	push   0xc(%ebp)
+  8008f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008f9:	c1 e0 08             	shl    $0x8,%eax
+  8008fc:	83 c8 25             	or     $0x25,%eax
+  8008ff:	50                   	push   %eax
+  800900:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800902:	83 c4 10             	add    $0x10,%esp
+  800905:	89 de                	mov    %ebx,%esi
+  800907:	eb 03                	jmp    80090c <vprintfmt+0x4bc>
+  800909:	83 ee 01             	sub    $0x1,%esi
+  80090c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800910:	75 f7                	jne    800909 <vprintfmt+0x4b9>
+  800912:	e9 67 fb ff ff       	jmp    80047e <vprintfmt+0x2e>
+
+00800917 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	83 ec 18             	sub    $0x18,%esp
+  80091d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800920:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800923:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800926:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80092a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80092d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800934:	85 c0                	test   %eax,%eax
+  800936:	74 26                	je     80095e <vsnprintf+0x47>
+  800938:	85 d2                	test   %edx,%edx
+  80093a:	7e 22                	jle    80095e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80093c:	ff 75 14             	push   0x14(%ebp)
+  80093f:	ff 75 10             	push   0x10(%ebp)
+  800942:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800945:	50                   	push   %eax
+  800946:	68 16 04 80 00       	push   $0x800416
+  80094b:	e8 00 fb ff ff       	call   800450 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800950:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800953:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800956:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800959:	83 c4 10             	add    $0x10,%esp
+}
+  80095c:	c9                   	leave
+  80095d:	c3                   	ret
+		return -E_INVAL;
+  80095e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800963:	eb f7                	jmp    80095c <vsnprintf+0x45>
+
+00800965 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800965:	55                   	push   %ebp
+  800966:	89 e5                	mov    %esp,%ebp
+  800968:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80096b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80096e:	50                   	push   %eax
+  80096f:	ff 75 10             	push   0x10(%ebp)
+  800972:	ff 75 0c             	push   0xc(%ebp)
+  800975:	ff 75 08             	push   0x8(%ebp)
+  800978:	e8 9a ff ff ff       	call   800917 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80097d:	c9                   	leave
+  80097e:	c3                   	ret
+
+0080097f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80097f:	55                   	push   %ebp
+  800980:	89 e5                	mov    %esp,%ebp
+  800982:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098a:	eb 03                	jmp    80098f <strlen+0x10>
+		n++;
+  80098c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80098f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800993:	75 f7                	jne    80098c <strlen+0xd>
+	return n;
+}
+  800995:	5d                   	pop    %ebp
+  800996:	c3                   	ret
+
+00800997 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80099d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a5:	eb 03                	jmp    8009aa <strnlen+0x13>
+		n++;
+  8009a7:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009aa:	39 d0                	cmp    %edx,%eax
+  8009ac:	74 08                	je     8009b6 <strnlen+0x1f>
+  8009ae:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009b2:	75 f3                	jne    8009a7 <strnlen+0x10>
+  8009b4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009b6:	89 d0                	mov    %edx,%eax
+  8009b8:	5d                   	pop    %ebp
+  8009b9:	c3                   	ret
+
+008009ba <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	53                   	push   %ebx
+  8009be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009cd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009d0:	83 c0 01             	add    $0x1,%eax
+  8009d3:	84 d2                	test   %dl,%dl
+  8009d5:	75 f2                	jne    8009c9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009d7:	89 c8                	mov    %ecx,%eax
+  8009d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009dc:	c9                   	leave
+  8009dd:	c3                   	ret
+
+008009de <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	53                   	push   %ebx
+  8009e2:	83 ec 10             	sub    $0x10,%esp
+  8009e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009e8:	53                   	push   %ebx
+  8009e9:	e8 91 ff ff ff       	call   80097f <strlen>
+  8009ee:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009f1:	ff 75 0c             	push   0xc(%ebp)
+  8009f4:	01 d8                	add    %ebx,%eax
+  8009f6:	50                   	push   %eax
+  8009f7:	e8 be ff ff ff       	call   8009ba <strcpy>
+	return dst;
+}
+  8009fc:	89 d8                	mov    %ebx,%eax
+  8009fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a01:	c9                   	leave
+  800a02:	c3                   	ret
+
+00800a03 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a03:	55                   	push   %ebp
+  800a04:	89 e5                	mov    %esp,%ebp
+  800a06:	56                   	push   %esi
+  800a07:	53                   	push   %ebx
+  800a08:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a0e:	89 f3                	mov    %esi,%ebx
+  800a10:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a13:	89 f0                	mov    %esi,%eax
+  800a15:	eb 0f                	jmp    800a26 <strncpy+0x23>
+		*dst++ = *src;
+  800a17:	83 c0 01             	add    $0x1,%eax
+  800a1a:	0f b6 0a             	movzbl (%edx),%ecx
+  800a1d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a20:	80 f9 01             	cmp    $0x1,%cl
+  800a23:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a26:	39 d8                	cmp    %ebx,%eax
+  800a28:	75 ed                	jne    800a17 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a2a:	89 f0                	mov    %esi,%eax
+  800a2c:	5b                   	pop    %ebx
+  800a2d:	5e                   	pop    %esi
+  800a2e:	5d                   	pop    %ebp
+  800a2f:	c3                   	ret
+
+00800a30 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a30:	55                   	push   %ebp
+  800a31:	89 e5                	mov    %esp,%ebp
+  800a33:	56                   	push   %esi
+  800a34:	53                   	push   %ebx
+  800a35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a3b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a3e:	89 f0                	mov    %esi,%eax
+  800a40:	85 d2                	test   %edx,%edx
+  800a42:	74 21                	je     800a65 <strlcpy+0x35>
+  800a44:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a48:	89 f2                	mov    %esi,%edx
+  800a4a:	eb 09                	jmp    800a55 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a4c:	83 c1 01             	add    $0x1,%ecx
+  800a4f:	83 c2 01             	add    $0x1,%edx
+  800a52:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a55:	39 c2                	cmp    %eax,%edx
+  800a57:	74 09                	je     800a62 <strlcpy+0x32>
+  800a59:	0f b6 19             	movzbl (%ecx),%ebx
+  800a5c:	84 db                	test   %bl,%bl
+  800a5e:	75 ec                	jne    800a4c <strlcpy+0x1c>
+  800a60:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a62:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a65:	29 f0                	sub    %esi,%eax
+}
+  800a67:	5b                   	pop    %ebx
+  800a68:	5e                   	pop    %esi
+  800a69:	5d                   	pop    %ebp
+  800a6a:	c3                   	ret
+
+00800a6b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a6b:	55                   	push   %ebp
+  800a6c:	89 e5                	mov    %esp,%ebp
+  800a6e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a71:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a74:	eb 06                	jmp    800a7c <strcmp+0x11>
+		p++, q++;
+  800a76:	83 c1 01             	add    $0x1,%ecx
+  800a79:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a7c:	0f b6 01             	movzbl (%ecx),%eax
+  800a7f:	84 c0                	test   %al,%al
+  800a81:	74 04                	je     800a87 <strcmp+0x1c>
+  800a83:	3a 02                	cmp    (%edx),%al
+  800a85:	74 ef                	je     800a76 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a87:	0f b6 c0             	movzbl %al,%eax
+  800a8a:	0f b6 12             	movzbl (%edx),%edx
+  800a8d:	29 d0                	sub    %edx,%eax
+}
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	53                   	push   %ebx
+  800a95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a9b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a9e:	eb 09                	jmp    800aa9 <strncmp+0x18>
+		n--, p++, q++;
+  800aa0:	83 ea 01             	sub    $0x1,%edx
+  800aa3:	83 c0 01             	add    $0x1,%eax
+  800aa6:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800aa9:	85 d2                	test   %edx,%edx
+  800aab:	74 18                	je     800ac5 <strncmp+0x34>
+  800aad:	0f b6 18             	movzbl (%eax),%ebx
+  800ab0:	84 db                	test   %bl,%bl
+  800ab2:	74 04                	je     800ab8 <strncmp+0x27>
+  800ab4:	3a 19                	cmp    (%ecx),%bl
+  800ab6:	74 e8                	je     800aa0 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ab8:	0f b6 00             	movzbl (%eax),%eax
+  800abb:	0f b6 11             	movzbl (%ecx),%edx
+  800abe:	29 d0                	sub    %edx,%eax
+}
+  800ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ac3:	c9                   	leave
+  800ac4:	c3                   	ret
+		return 0;
+  800ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aca:	eb f4                	jmp    800ac0 <strncmp+0x2f>
+
+00800acc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ad6:	eb 03                	jmp    800adb <strchr+0xf>
+  800ad8:	83 c0 01             	add    $0x1,%eax
+  800adb:	0f b6 10             	movzbl (%eax),%edx
+  800ade:	84 d2                	test   %dl,%dl
+  800ae0:	74 06                	je     800ae8 <strchr+0x1c>
+		if (*s == c)
+  800ae2:	38 ca                	cmp    %cl,%dl
+  800ae4:	75 f2                	jne    800ad8 <strchr+0xc>
+  800ae6:	eb 05                	jmp    800aed <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aed:	5d                   	pop    %ebp
+  800aee:	c3                   	ret
+
+00800aef <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800aef:	55                   	push   %ebp
+  800af0:	89 e5                	mov    %esp,%ebp
+  800af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800af9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800afc:	38 ca                	cmp    %cl,%dl
+  800afe:	74 09                	je     800b09 <strfind+0x1a>
+  800b00:	84 d2                	test   %dl,%dl
+  800b02:	74 05                	je     800b09 <strfind+0x1a>
+	for (; *s; s++)
+  800b04:	83 c0 01             	add    $0x1,%eax
+  800b07:	eb f0                	jmp    800af9 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b09:	5d                   	pop    %ebp
+  800b0a:	c3                   	ret
+
+00800b0b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b0b:	55                   	push   %ebp
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	57                   	push   %edi
+  800b0f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b12:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b15:	85 c9                	test   %ecx,%ecx
+  800b17:	74 20                	je     800b39 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b19:	89 f8                	mov    %edi,%eax
+  800b1b:	09 c8                	or     %ecx,%eax
+  800b1d:	a8 03                	test   $0x3,%al
+  800b1f:	75 12                	jne    800b33 <memset+0x28>
+		c &= 0xFF;
+  800b21:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b25:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b2b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b2e:	fc                   	cld
+  800b2f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b31:	eb 06                	jmp    800b39 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b36:	fc                   	cld
+  800b37:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b39:	89 f8                	mov    %edi,%eax
+  800b3b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b3e:	c9                   	leave
+  800b3f:	c3                   	ret
+
+00800b40 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	57                   	push   %edi
+  800b44:	56                   	push   %esi
+  800b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b4b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b4e:	39 c6                	cmp    %eax,%esi
+  800b50:	73 32                	jae    800b84 <memmove+0x44>
+  800b52:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b55:	39 d0                	cmp    %edx,%eax
+  800b57:	73 2b                	jae    800b84 <memmove+0x44>
+		s += n;
+		d += n;
+  800b59:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b5c:	89 d6                	mov    %edx,%esi
+  800b5e:	09 fe                	or     %edi,%esi
+  800b60:	09 ce                	or     %ecx,%esi
+  800b62:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b68:	75 0e                	jne    800b78 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b6a:	83 ef 04             	sub    $0x4,%edi
+  800b6d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b70:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b73:	fd                   	std
+  800b74:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b76:	eb 09                	jmp    800b81 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b78:	83 ef 01             	sub    $0x1,%edi
+  800b7b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b7e:	fd                   	std
+  800b7f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b81:	fc                   	cld
+  800b82:	eb 1a                	jmp    800b9e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b84:	89 f2                	mov    %esi,%edx
+  800b86:	09 c2                	or     %eax,%edx
+  800b88:	09 ca                	or     %ecx,%edx
+  800b8a:	f6 c2 03             	test   $0x3,%dl
+  800b8d:	75 0a                	jne    800b99 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b8f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b92:	89 c7                	mov    %eax,%edi
+  800b94:	fc                   	cld
+  800b95:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b97:	eb 05                	jmp    800b9e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b99:	89 c7                	mov    %eax,%edi
+  800b9b:	fc                   	cld
+  800b9c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b9e:	5e                   	pop    %esi
+  800b9f:	5f                   	pop    %edi
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	c3                   	ret
+
+00800ba2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ba8:	ff 75 10             	push   0x10(%ebp)
+  800bab:	ff 75 0c             	push   0xc(%ebp)
+  800bae:	ff 75 08             	push   0x8(%ebp)
+  800bb1:	e8 8a ff ff ff       	call   800b40 <memmove>
+}
+  800bb6:	c9                   	leave
+  800bb7:	c3                   	ret
+
+00800bb8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	56                   	push   %esi
+  800bbc:	53                   	push   %ebx
+  800bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800bc3:	89 c6                	mov    %eax,%esi
+  800bc5:	03 75 10             	add    0x10(%ebp),%esi
+  800bc8:	eb 06                	jmp    800bd0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bca:	83 c0 01             	add    $0x1,%eax
+  800bcd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bd0:	39 f0                	cmp    %esi,%eax
+  800bd2:	74 14                	je     800be8 <memcmp+0x30>
+		if (*s1 != *s2)
+  800bd4:	0f b6 08             	movzbl (%eax),%ecx
+  800bd7:	0f b6 1a             	movzbl (%edx),%ebx
+  800bda:	38 d9                	cmp    %bl,%cl
+  800bdc:	74 ec                	je     800bca <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800bde:	0f b6 c1             	movzbl %cl,%eax
+  800be1:	0f b6 db             	movzbl %bl,%ebx
+  800be4:	29 d8                	sub    %ebx,%eax
+  800be6:	eb 05                	jmp    800bed <memcmp+0x35>
+	}
+
+	return 0;
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bed:	5b                   	pop    %ebx
+  800bee:	5e                   	pop    %esi
+  800bef:	5d                   	pop    %ebp
+  800bf0:	c3                   	ret
+
+00800bf1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bfa:	89 c2                	mov    %eax,%edx
+  800bfc:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bff:	eb 03                	jmp    800c04 <memfind+0x13>
+  800c01:	83 c0 01             	add    $0x1,%eax
+  800c04:	39 d0                	cmp    %edx,%eax
+  800c06:	73 04                	jae    800c0c <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c08:	38 08                	cmp    %cl,(%eax)
+  800c0a:	75 f5                	jne    800c01 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c0c:	5d                   	pop    %ebp
+  800c0d:	c3                   	ret
+
+00800c0e <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c0e:	55                   	push   %ebp
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	57                   	push   %edi
+  800c12:	56                   	push   %esi
+  800c13:	53                   	push   %ebx
+  800c14:	83 ec 1c             	sub    $0x1c,%esp
+  800c17:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c1a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c1d:	eb 03                	jmp    800c22 <strtol+0x14>
+		s++;
+  800c1f:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c22:	0f b6 06             	movzbl (%esi),%eax
+  800c25:	3c 20                	cmp    $0x20,%al
+  800c27:	74 f6                	je     800c1f <strtol+0x11>
+  800c29:	3c 09                	cmp    $0x9,%al
+  800c2b:	74 f2                	je     800c1f <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c2d:	3c 2b                	cmp    $0x2b,%al
+  800c2f:	74 43                	je     800c74 <strtol+0x66>
+	int neg = 0;
+  800c31:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c36:	3c 2d                	cmp    $0x2d,%al
+  800c38:	74 44                	je     800c7e <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c3a:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c40:	75 0f                	jne    800c51 <strtol+0x43>
+  800c42:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c45:	74 41                	je     800c88 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c47:	85 ff                	test   %edi,%edi
+  800c49:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c4e:	0f 44 f8             	cmove  %eax,%edi
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c56:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c5b:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c5e:	89 fb                	mov    %edi,%ebx
+  800c60:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c63:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c66:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c69:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c6c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c6f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c72:	eb 67                	jmp    800cdb <strtol+0xcd>
+		s++;
+  800c74:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c7c:	eb bc                	jmp    800c3a <strtol+0x2c>
+		s++, neg = 1;
+  800c7e:	83 c6 01             	add    $0x1,%esi
+  800c81:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c86:	eb b2                	jmp    800c3a <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c88:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c8c:	74 0e                	je     800c9c <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c8e:	85 ff                	test   %edi,%edi
+  800c90:	75 bf                	jne    800c51 <strtol+0x43>
+		s++, base = 8;
+  800c92:	83 c6 01             	add    $0x1,%esi
+  800c95:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c9a:	eb b5                	jmp    800c51 <strtol+0x43>
+		s += 2, base = 16;
+  800c9c:	83 c6 02             	add    $0x2,%esi
+  800c9f:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ca4:	eb ab                	jmp    800c51 <strtol+0x43>
+			dig = *s - '0';
+  800ca6:	0f be c9             	movsbl %cl,%ecx
+  800ca9:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800cac:	39 f9                	cmp    %edi,%ecx
+  800cae:	7d 59                	jge    800d09 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800cb0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800cb4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cb7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cba:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cbd:	0f af d8             	imul   %eax,%ebx
+  800cc0:	0f af d7             	imul   %edi,%edx
+  800cc3:	01 d3                	add    %edx,%ebx
+  800cc5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cc8:	f7 e7                	mul    %edi
+  800cca:	01 da                	add    %ebx,%edx
+  800ccc:	89 cb                	mov    %ecx,%ebx
+  800cce:	c1 fb 1f             	sar    $0x1f,%ebx
+  800cd1:	01 c8                	add    %ecx,%eax
+  800cd3:	11 da                	adc    %ebx,%edx
+  800cd5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800cd8:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800cdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cde:	0f b6 08             	movzbl (%eax),%ecx
+  800ce1:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800ce4:	80 fb 09             	cmp    $0x9,%bl
+  800ce7:	76 bd                	jbe    800ca6 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce9:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800cec:	80 fb 19             	cmp    $0x19,%bl
+  800cef:	77 08                	ja     800cf9 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800cf1:	0f be c9             	movsbl %cl,%ecx
+  800cf4:	83 e9 57             	sub    $0x57,%ecx
+  800cf7:	eb b3                	jmp    800cac <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cf9:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800cfc:	80 fb 19             	cmp    $0x19,%bl
+  800cff:	77 08                	ja     800d09 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800d01:	0f be c9             	movsbl %cl,%ecx
+  800d04:	83 e9 37             	sub    $0x37,%ecx
+  800d07:	eb a3                	jmp    800cac <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d09:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d0c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d0f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d12:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d15:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d19:	74 05                	je     800d20 <strtol+0x112>
+		*endptr = (char *) s;
+  800d1b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d1e:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d20:	85 c9                	test   %ecx,%ecx
+  800d22:	74 07                	je     800d2b <strtol+0x11d>
+  800d24:	f7 d8                	neg    %eax
+  800d26:	83 d2 00             	adc    $0x0,%edx
+  800d29:	f7 da                	neg    %edx
+}
+  800d2b:	83 c4 1c             	add    $0x1c,%esp
+  800d2e:	5b                   	pop    %ebx
+  800d2f:	5e                   	pop    %esi
+  800d30:	5f                   	pop    %edi
+  800d31:	5d                   	pop    %ebp
+  800d32:	c3                   	ret
+
+00800d33 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d33:	55                   	push   %ebp
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	57                   	push   %edi
+  800d37:	56                   	push   %esi
+  800d38:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d39:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d40:	74 18                	je     800d5a <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4d:	89 c3                	mov    %eax,%ebx
+  800d4f:	89 c7                	mov    %eax,%edi
+  800d51:	89 c6                	mov    %eax,%esi
+  800d53:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d55:	5b                   	pop    %ebx
+  800d56:	5e                   	pop    %esi
+  800d57:	5f                   	pop    %edi
+  800d58:	5d                   	pop    %ebp
+  800d59:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d65:	89 c3                	mov    %eax,%ebx
+  800d67:	89 c7                	mov    %eax,%edi
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	8d 35 74 0d 80 00    	lea    0x800d74,%esi
+  800d72:	0f 34                	sysenter
+  800d74:	5d                   	pop    %ebp
+		goto out;
+  800d75:	eb de                	jmp    800d55 <sys_cputs+0x22>
+
+00800d77 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d77:	55                   	push   %ebp
+  800d78:	89 e5                	mov    %esp,%ebp
+  800d7a:	57                   	push   %edi
+  800d7b:	56                   	push   %esi
+  800d7c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d7d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d84:	74 19                	je     800d9f <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d86:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d90:	89 d1                	mov    %edx,%ecx
+  800d92:	89 d3                	mov    %edx,%ebx
+  800d94:	89 d7                	mov    %edx,%edi
+  800d96:	89 d6                	mov    %edx,%esi
+  800d98:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d9a:	5b                   	pop    %ebx
+  800d9b:	5e                   	pop    %esi
+  800d9c:	5f                   	pop    %edi
+  800d9d:	5d                   	pop    %ebp
+  800d9e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da4:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da9:	89 d1                	mov    %edx,%ecx
+  800dab:	89 d3                	mov    %edx,%ebx
+  800dad:	89 d7                	mov    %edx,%edi
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	8d 35 ba 0d 80 00    	lea    0x800dba,%esi
+  800db8:	0f 34                	sysenter
+  800dba:	5d                   	pop    %ebp
+		goto out;
+  800dbb:	eb dd                	jmp    800d9a <sys_cgetc+0x23>
+
+00800dbd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	57                   	push   %edi
+  800dc1:	56                   	push   %esi
+  800dc2:	53                   	push   %ebx
+  800dc3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dc6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dcd:	74 21                	je     800df0 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800dcf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddc:	89 cb                	mov    %ecx,%ebx
+  800dde:	89 cf                	mov    %ecx,%edi
+  800de0:	89 ce                	mov    %ecx,%esi
+  800de2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de4:	85 c0                	test   %eax,%eax
+  800de6:	7f 27                	jg     800e0f <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dfd:	89 cb                	mov    %ecx,%ebx
+  800dff:	89 cf                	mov    %ecx,%edi
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	8d 35 0c 0e 80 00    	lea    0x800e0c,%esi
+  800e0a:	0f 34                	sysenter
+  800e0c:	5d                   	pop    %ebp
+		goto out;
+  800e0d:	eb d5                	jmp    800de4 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e0f:	83 ec 0c             	sub    $0xc,%esp
+  800e12:	50                   	push   %eax
+  800e13:	6a 03                	push   $0x3
+  800e15:	68 cb 38 80 00       	push   $0x8038cb
+  800e1a:	6a 3f                	push   $0x3f
+  800e1c:	68 e8 38 80 00       	push   $0x8038e8
+  800e21:	e8 71 f4 ff ff       	call   800297 <_panic>
+
+00800e26 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	56                   	push   %esi
+  800e2b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e2c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e33:	74 19                	je     800e4e <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e3f:	89 d1                	mov    %edx,%ecx
+  800e41:	89 d3                	mov    %edx,%ebx
+  800e43:	89 d7                	mov    %edx,%edi
+  800e45:	89 d6                	mov    %edx,%esi
+  800e47:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5e                   	pop    %esi
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e53:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e58:	89 d1                	mov    %edx,%ecx
+  800e5a:	89 d3                	mov    %edx,%ebx
+  800e5c:	89 d7                	mov    %edx,%edi
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	8d 35 69 0e 80 00    	lea    0x800e69,%esi
+  800e67:	0f 34                	sysenter
+  800e69:	5d                   	pop    %ebp
+		goto out;
+  800e6a:	eb dd                	jmp    800e49 <sys_getenvid+0x23>
+
+00800e6c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e6c:	55                   	push   %ebp
+  800e6d:	89 e5                	mov    %esp,%ebp
+  800e6f:	57                   	push   %edi
+  800e70:	56                   	push   %esi
+  800e71:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e72:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e79:	74 19                	je     800e94 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e80:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e85:	89 d1                	mov    %edx,%ecx
+  800e87:	89 d3                	mov    %edx,%ebx
+  800e89:	89 d7                	mov    %edx,%edi
+  800e8b:	89 d6                	mov    %edx,%esi
+  800e8d:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e99:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e9e:	89 d1                	mov    %edx,%ecx
+  800ea0:	89 d3                	mov    %edx,%ebx
+  800ea2:	89 d7                	mov    %edx,%edi
+  800ea4:	55                   	push   %ebp
+  800ea5:	89 e5                	mov    %esp,%ebp
+  800ea7:	8d 35 af 0e 80 00    	lea    0x800eaf,%esi
+  800ead:	0f 34                	sysenter
+  800eaf:	5d                   	pop    %ebp
+		goto out;
+  800eb0:	eb dd                	jmp    800e8f <sys_yield+0x23>
+
+00800eb2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	57                   	push   %edi
+  800eb6:	56                   	push   %esi
+  800eb7:	53                   	push   %ebx
+  800eb8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ebb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ec2:	74 23                	je     800ee7 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800ec4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ece:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed7:	89 f7                	mov    %esi,%edi
+  800ed9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800edb:	85 c0                	test   %eax,%eax
+  800edd:	7f 29                	jg     800f08 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800edf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee2:	5b                   	pop    %ebx
+  800ee3:	5e                   	pop    %esi
+  800ee4:	5f                   	pop    %edi
+  800ee5:	5d                   	pop    %ebp
+  800ee6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	8d 35 05 0f 80 00    	lea    0x800f05,%esi
+  800f03:	0f 34                	sysenter
+  800f05:	5d                   	pop    %ebp
+		goto out;
+  800f06:	eb d3                	jmp    800edb <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f08:	83 ec 0c             	sub    $0xc,%esp
+  800f0b:	50                   	push   %eax
+  800f0c:	6a 04                	push   $0x4
+  800f0e:	68 cb 38 80 00       	push   $0x8038cb
+  800f13:	6a 3f                	push   $0x3f
+  800f15:	68 e8 38 80 00       	push   $0x8038e8
+  800f1a:	e8 78 f3 ff ff       	call   800297 <_panic>
+
+00800f1f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f2b:	85 f6                	test   %esi,%esi
+  800f2d:	75 09                	jne    800f38 <sys_page_map+0x19>
+  800f2f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f36:	74 1f                	je     800f57 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f38:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f46:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f49:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4b:	85 c0                	test   %eax,%eax
+  800f4d:	7f 27                	jg     800f76 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f52:	5b                   	pop    %ebx
+  800f53:	5e                   	pop    %esi
+  800f54:	5f                   	pop    %edi
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f65:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	8d 35 73 0f 80 00    	lea    0x800f73,%esi
+  800f71:	0f 34                	sysenter
+  800f73:	5d                   	pop    %ebp
+		goto out;
+  800f74:	eb d5                	jmp    800f4b <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f76:	83 ec 0c             	sub    $0xc,%esp
+  800f79:	50                   	push   %eax
+  800f7a:	6a 05                	push   $0x5
+  800f7c:	68 cb 38 80 00       	push   $0x8038cb
+  800f81:	6a 3f                	push   $0x3f
+  800f83:	68 e8 38 80 00       	push   $0x8038e8
+  800f88:	e8 0a f3 ff ff       	call   800297 <_panic>
+
+00800f8d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	57                   	push   %edi
+  800f91:	56                   	push   %esi
+  800f92:	53                   	push   %ebx
+  800f93:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f96:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f9d:	74 22                	je     800fc1 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa4:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	89 df                	mov    %ebx,%edi
+  800fb1:	89 de                	mov    %ebx,%esi
+  800fb3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	7f 28                	jg     800fe1 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fd1:	89 df                	mov    %ebx,%edi
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	8d 35 de 0f 80 00    	lea    0x800fde,%esi
+  800fdc:	0f 34                	sysenter
+  800fde:	5d                   	pop    %ebp
+		goto out;
+  800fdf:	eb d4                	jmp    800fb5 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe1:	83 ec 0c             	sub    $0xc,%esp
+  800fe4:	50                   	push   %eax
+  800fe5:	6a 06                	push   $0x6
+  800fe7:	68 cb 38 80 00       	push   $0x8038cb
+  800fec:	6a 3f                	push   $0x3f
+  800fee:	68 e8 38 80 00       	push   $0x8038e8
+  800ff3:	e8 9f f2 ff ff       	call   800297 <_panic>
+
+00800ff8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ff8:	55                   	push   %ebp
+  800ff9:	89 e5                	mov    %esp,%ebp
+  800ffb:	57                   	push   %edi
+  800ffc:	56                   	push   %esi
+  800ffd:	53                   	push   %ebx
+  800ffe:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801001:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801008:	74 22                	je     80102c <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  80100a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801014:	8b 55 08             	mov    0x8(%ebp),%edx
+  801017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101a:	89 df                	mov    %ebx,%edi
+  80101c:	89 de                	mov    %ebx,%esi
+  80101e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801020:	85 c0                	test   %eax,%eax
+  801022:	7f 28                	jg     80104c <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801024:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801027:	5b                   	pop    %ebx
+  801028:	5e                   	pop    %esi
+  801029:	5f                   	pop    %edi
+  80102a:	5d                   	pop    %ebp
+  80102b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80102c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801031:	8b 55 08             	mov    0x8(%ebp),%edx
+  801034:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801037:	b8 08 00 00 00       	mov    $0x8,%eax
+  80103c:	89 df                	mov    %ebx,%edi
+  80103e:	55                   	push   %ebp
+  80103f:	89 e5                	mov    %esp,%ebp
+  801041:	8d 35 49 10 80 00    	lea    0x801049,%esi
+  801047:	0f 34                	sysenter
+  801049:	5d                   	pop    %ebp
+		goto out;
+  80104a:	eb d4                	jmp    801020 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104c:	83 ec 0c             	sub    $0xc,%esp
+  80104f:	50                   	push   %eax
+  801050:	6a 08                	push   $0x8
+  801052:	68 cb 38 80 00       	push   $0x8038cb
+  801057:	6a 3f                	push   $0x3f
+  801059:	68 e8 38 80 00       	push   $0x8038e8
+  80105e:	e8 34 f2 ff ff       	call   800297 <_panic>
+
+00801063 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	57                   	push   %edi
+  801067:	56                   	push   %esi
+  801068:	53                   	push   %ebx
+  801069:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80106c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801073:	74 22                	je     801097 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801075:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80107f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801082:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801085:	89 df                	mov    %ebx,%edi
+  801087:	89 de                	mov    %ebx,%esi
+  801089:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80108b:	85 c0                	test   %eax,%eax
+  80108d:	7f 28                	jg     8010b7 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80108f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801097:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010a7:	89 df                	mov    %ebx,%edi
+  8010a9:	55                   	push   %ebp
+  8010aa:	89 e5                	mov    %esp,%ebp
+  8010ac:	8d 35 b4 10 80 00    	lea    0x8010b4,%esi
+  8010b2:	0f 34                	sysenter
+  8010b4:	5d                   	pop    %ebp
+		goto out;
+  8010b5:	eb d4                	jmp    80108b <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b7:	83 ec 0c             	sub    $0xc,%esp
+  8010ba:	50                   	push   %eax
+  8010bb:	6a 09                	push   $0x9
+  8010bd:	68 cb 38 80 00       	push   $0x8038cb
+  8010c2:	6a 3f                	push   $0x3f
+  8010c4:	68 e8 38 80 00       	push   $0x8038e8
+  8010c9:	e8 c9 f1 ff ff       	call   800297 <_panic>
+
+008010ce <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010ce:	55                   	push   %ebp
+  8010cf:	89 e5                	mov    %esp,%ebp
+  8010d1:	57                   	push   %edi
+  8010d2:	56                   	push   %esi
+  8010d3:	53                   	push   %ebx
+  8010d4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010d7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010de:	74 22                	je     801102 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8010e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f0:	89 df                	mov    %ebx,%edi
+  8010f2:	89 de                	mov    %ebx,%esi
+  8010f4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	7f 28                	jg     801122 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fd:	5b                   	pop    %ebx
+  8010fe:	5e                   	pop    %esi
+  8010ff:	5f                   	pop    %edi
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801102:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801107:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801112:	89 df                	mov    %ebx,%edi
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	8d 35 1f 11 80 00    	lea    0x80111f,%esi
+  80111d:	0f 34                	sysenter
+  80111f:	5d                   	pop    %ebp
+		goto out;
+  801120:	eb d4                	jmp    8010f6 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801122:	83 ec 0c             	sub    $0xc,%esp
+  801125:	50                   	push   %eax
+  801126:	6a 0a                	push   $0xa
+  801128:	68 cb 38 80 00       	push   $0x8038cb
+  80112d:	6a 3f                	push   $0x3f
+  80112f:	68 e8 38 80 00       	push   $0x8038e8
+  801134:	e8 5e f1 ff ff       	call   800297 <_panic>
+
+00801139 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	57                   	push   %edi
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801142:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801149:	74 22                	je     80116d <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80114b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801150:	b8 17 00 00 00       	mov    $0x17,%eax
+  801155:	8b 55 08             	mov    0x8(%ebp),%edx
+  801158:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115b:	89 df                	mov    %ebx,%edi
+  80115d:	89 de                	mov    %ebx,%esi
+  80115f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801161:	85 c0                	test   %eax,%eax
+  801163:	7f 28                	jg     80118d <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801165:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801168:	5b                   	pop    %ebx
+  801169:	5e                   	pop    %esi
+  80116a:	5f                   	pop    %edi
+  80116b:	5d                   	pop    %ebp
+  80116c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80116d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 17 00 00 00       	mov    $0x17,%eax
+  80117d:	89 df                	mov    %ebx,%edi
+  80117f:	55                   	push   %ebp
+  801180:	89 e5                	mov    %esp,%ebp
+  801182:	8d 35 8a 11 80 00    	lea    0x80118a,%esi
+  801188:	0f 34                	sysenter
+  80118a:	5d                   	pop    %ebp
+		goto out;
+  80118b:	eb d4                	jmp    801161 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118d:	83 ec 0c             	sub    $0xc,%esp
+  801190:	50                   	push   %eax
+  801191:	6a 17                	push   $0x17
+  801193:	68 cb 38 80 00       	push   $0x8038cb
+  801198:	6a 3f                	push   $0x3f
+  80119a:	68 e8 38 80 00       	push   $0x8038e8
+  80119f:	e8 f3 f0 ff ff       	call   800297 <_panic>
+
+008011a4 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8011a4:	55                   	push   %ebp
+  8011a5:	89 e5                	mov    %esp,%ebp
+  8011a7:	57                   	push   %edi
+  8011a8:	56                   	push   %esi
+  8011a9:	53                   	push   %ebx
+  8011aa:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011ad:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011b4:	74 22                	je     8011d8 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8011b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bb:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c6:	89 df                	mov    %ebx,%edi
+  8011c8:	89 de                	mov    %ebx,%esi
+  8011ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011cc:	85 c0                	test   %eax,%eax
+  8011ce:	7f 28                	jg     8011f8 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8011d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d3:	5b                   	pop    %ebx
+  8011d4:	5e                   	pop    %esi
+  8011d5:	5f                   	pop    %edi
+  8011d6:	5d                   	pop    %ebp
+  8011d7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011e8:	89 df                	mov    %ebx,%edi
+  8011ea:	55                   	push   %ebp
+  8011eb:	89 e5                	mov    %esp,%ebp
+  8011ed:	8d 35 f5 11 80 00    	lea    0x8011f5,%esi
+  8011f3:	0f 34                	sysenter
+  8011f5:	5d                   	pop    %ebp
+		goto out;
+  8011f6:	eb d4                	jmp    8011cc <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+  8011fb:	50                   	push   %eax
+  8011fc:	6a 18                	push   $0x18
+  8011fe:	68 cb 38 80 00       	push   $0x8038cb
+  801203:	6a 3f                	push   $0x3f
+  801205:	68 e8 38 80 00       	push   $0x8038e8
+  80120a:	e8 88 f0 ff ff       	call   800297 <_panic>
+
+0080120f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	57                   	push   %edi
+  801213:	56                   	push   %esi
+  801214:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801215:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80121c:	74 1d                	je     80123b <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80121e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801223:	be 00 00 00 00       	mov    $0x0,%esi
+  801228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801231:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801234:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801236:	5b                   	pop    %ebx
+  801237:	5e                   	pop    %esi
+  801238:	5f                   	pop    %edi
+  801239:	5d                   	pop    %ebp
+  80123a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80123b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801241:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801246:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801249:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	8d 35 57 12 80 00    	lea    0x801257,%esi
+  801255:	0f 34                	sysenter
+  801257:	5d                   	pop    %ebp
+		goto out;
+  801258:	eb dc                	jmp    801236 <sys_ipc_try_send+0x27>
+
+0080125a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80125a:	55                   	push   %ebp
+  80125b:	89 e5                	mov    %esp,%ebp
+  80125d:	57                   	push   %edi
+  80125e:	56                   	push   %esi
+  80125f:	53                   	push   %ebx
+  801260:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801263:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80126a:	74 21                	je     80128d <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80126c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801271:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801276:	8b 55 08             	mov    0x8(%ebp),%edx
+  801279:	89 cb                	mov    %ecx,%ebx
+  80127b:	89 cf                	mov    %ecx,%edi
+  80127d:	89 ce                	mov    %ecx,%esi
+  80127f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801281:	85 c0                	test   %eax,%eax
+  801283:	7f 27                	jg     8012ac <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801288:	5b                   	pop    %ebx
+  801289:	5e                   	pop    %esi
+  80128a:	5f                   	pop    %edi
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80128d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801290:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801295:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80129a:	89 cb                	mov    %ecx,%ebx
+  80129c:	89 cf                	mov    %ecx,%edi
+  80129e:	55                   	push   %ebp
+  80129f:	89 e5                	mov    %esp,%ebp
+  8012a1:	8d 35 a9 12 80 00    	lea    0x8012a9,%esi
+  8012a7:	0f 34                	sysenter
+  8012a9:	5d                   	pop    %ebp
+		goto out;
+  8012aa:	eb d5                	jmp    801281 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ac:	83 ec 0c             	sub    $0xc,%esp
+  8012af:	50                   	push   %eax
+  8012b0:	6a 0d                	push   $0xd
+  8012b2:	68 cb 38 80 00       	push   $0x8038cb
+  8012b7:	6a 3f                	push   $0x3f
+  8012b9:	68 e8 38 80 00       	push   $0x8038e8
+  8012be:	e8 d4 ef ff ff       	call   800297 <_panic>
+
+008012c3 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	57                   	push   %edi
+  8012c7:	56                   	push   %esi
+  8012c8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012c9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012d0:	74 1b                	je     8012ed <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8012d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e2:	89 df                	mov    %ebx,%edi
+  8012e4:	89 de                	mov    %ebx,%esi
+  8012e6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8012e8:	5b                   	pop    %ebx
+  8012e9:	5e                   	pop    %esi
+  8012ea:	5f                   	pop    %edi
+  8012eb:	5d                   	pop    %ebp
+  8012ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012fd:	89 df                	mov    %ebx,%edi
+  8012ff:	55                   	push   %ebp
+  801300:	89 e5                	mov    %esp,%ebp
+  801302:	8d 35 0a 13 80 00    	lea    0x80130a,%esi
+  801308:	0f 34                	sysenter
+  80130a:	5d                   	pop    %ebp
+		goto out;
+  80130b:	eb db                	jmp    8012e8 <sys_ipc_recv_until+0x25>
+
+0080130d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+  801310:	57                   	push   %edi
+  801311:	56                   	push   %esi
+  801312:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801313:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80131a:	74 19                	je     801335 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80131c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801321:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801326:	89 d1                	mov    %edx,%ecx
+  801328:	89 d3                	mov    %edx,%ebx
+  80132a:	89 d7                	mov    %edx,%edi
+  80132c:	89 d6                	mov    %edx,%esi
+  80132e:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801330:	5b                   	pop    %ebx
+  801331:	5e                   	pop    %esi
+  801332:	5f                   	pop    %edi
+  801333:	5d                   	pop    %ebp
+  801334:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80133f:	89 d1                	mov    %edx,%ecx
+  801341:	89 d3                	mov    %edx,%ebx
+  801343:	89 d7                	mov    %edx,%edi
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	8d 35 50 13 80 00    	lea    0x801350,%esi
+  80134e:	0f 34                	sysenter
+  801350:	5d                   	pop    %ebp
+		goto out;
+  801351:	eb dd                	jmp    801330 <sys_time_msec+0x23>
+
+00801353 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	57                   	push   %edi
+  801357:	56                   	push   %esi
+  801358:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801359:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801360:	74 1a                	je     80137c <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801362:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801367:	b8 10 00 00 00       	mov    $0x10,%eax
+  80136c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136f:	89 cb                	mov    %ecx,%ebx
+  801371:	89 cf                	mov    %ecx,%edi
+  801373:	89 ce                	mov    %ecx,%esi
+  801375:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801377:	5b                   	pop    %ebx
+  801378:	5e                   	pop    %esi
+  801379:	5f                   	pop    %edi
+  80137a:	5d                   	pop    %ebp
+  80137b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80137c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801384:	b8 10 00 00 00       	mov    $0x10,%eax
+  801389:	89 cb                	mov    %ecx,%ebx
+  80138b:	89 cf                	mov    %ecx,%edi
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	8d 35 98 13 80 00    	lea    0x801398,%esi
+  801396:	0f 34                	sysenter
+  801398:	5d                   	pop    %ebp
+		goto out;
+  801399:	eb dc                	jmp    801377 <sys_sleep_until+0x24>
+
+0080139b <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80139b:	55                   	push   %ebp
+  80139c:	89 e5                	mov    %esp,%ebp
+  80139e:	57                   	push   %edi
+  80139f:	56                   	push   %esi
+  8013a0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013a1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013a8:	74 1a                	je     8013c4 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8013aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013af:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b7:	89 cb                	mov    %ecx,%ebx
+  8013b9:	89 cf                	mov    %ecx,%edi
+  8013bb:	89 ce                	mov    %ecx,%esi
+  8013bd:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8013bf:	5b                   	pop    %ebx
+  8013c0:	5e                   	pop    %esi
+  8013c1:	5f                   	pop    %edi
+  8013c2:	5d                   	pop    %ebp
+  8013c3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013cc:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013d1:	89 cb                	mov    %ecx,%ebx
+  8013d3:	89 cf                	mov    %ecx,%edi
+  8013d5:	55                   	push   %ebp
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	8d 35 e0 13 80 00    	lea    0x8013e0,%esi
+  8013de:	0f 34                	sysenter
+  8013e0:	5d                   	pop    %ebp
+		goto out;
+  8013e1:	eb dc                	jmp    8013bf <sys_env_print_stats+0x24>
+
+008013e3 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8013e3:	55                   	push   %ebp
+  8013e4:	89 e5                	mov    %esp,%ebp
+  8013e6:	57                   	push   %edi
+  8013e7:	56                   	push   %esi
+  8013e8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013e9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013f0:	74 1b                	je     80140d <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8013f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f7:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801402:	89 df                	mov    %ebx,%edi
+  801404:	89 de                	mov    %ebx,%esi
+  801406:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801408:	5b                   	pop    %ebx
+  801409:	5e                   	pop    %esi
+  80140a:	5f                   	pop    %edi
+  80140b:	5d                   	pop    %ebp
+  80140c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80140d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801412:	8b 55 08             	mov    0x8(%ebp),%edx
+  801415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801418:	b8 19 00 00 00       	mov    $0x19,%eax
+  80141d:	89 df                	mov    %ebx,%edi
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	8d 35 2a 14 80 00    	lea    0x80142a,%esi
+  801428:	0f 34                	sysenter
+  80142a:	5d                   	pop    %ebp
+		goto out;
+  80142b:	eb db                	jmp    801408 <sys_perf+0x25>
+
+0080142d <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80142d:	55                   	push   %ebp
+  80142e:	89 e5                	mov    %esp,%ebp
+  801430:	57                   	push   %edi
+  801431:	56                   	push   %esi
+  801432:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801433:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80143a:	74 19                	je     801455 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80143c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801441:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801446:	89 d1                	mov    %edx,%ecx
+  801448:	89 d3                	mov    %edx,%ebx
+  80144a:	89 d7                	mov    %edx,%edi
+  80144c:	89 d6                	mov    %edx,%esi
+  80144e:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801450:	5b                   	pop    %ebx
+  801451:	5e                   	pop    %esi
+  801452:	5f                   	pop    %edi
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80145f:	89 d1                	mov    %edx,%ecx
+  801461:	89 d3                	mov    %edx,%ebx
+  801463:	89 d7                	mov    %edx,%edi
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	8d 35 70 14 80 00    	lea    0x801470,%esi
+  80146e:	0f 34                	sysenter
+  801470:	5d                   	pop    %ebp
+		goto out;
+  801471:	eb dd                	jmp    801450 <sys_fork+0x23>
+
+00801473 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+  801476:	57                   	push   %edi
+  801477:	56                   	push   %esi
+  801478:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801479:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801480:	74 1c                	je     80149e <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801482:	be 00 00 00 00       	mov    $0x0,%esi
+  801487:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80148c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801492:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801495:	89 f7                	mov    %esi,%edi
+  801497:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  801499:	5b                   	pop    %ebx
+  80149a:	5e                   	pop    %esi
+  80149b:	5f                   	pop    %edi
+  80149c:	5d                   	pop    %ebp
+  80149d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80149e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	8d 35 bc 14 80 00    	lea    0x8014bc,%esi
+  8014ba:	0f 34                	sysenter
+  8014bc:	5d                   	pop    %ebp
+		goto out;
+  8014bd:	eb da                	jmp    801499 <sys_thread_create+0x26>
+
+008014bf <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	57                   	push   %edi
+  8014c3:	56                   	push   %esi
+  8014c4:	53                   	push   %ebx
+  8014c5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014c8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014cf:	74 24                	je     8014f5 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8014d1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014e7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014e9:	85 c0                	test   %eax,%eax
+  8014eb:	7f 27                	jg     801514 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8014ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f0:	5b                   	pop    %ebx
+  8014f1:	5e                   	pop    %esi
+  8014f2:	5f                   	pop    %edi
+  8014f3:	5d                   	pop    %ebp
+  8014f4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801500:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801503:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	8d 35 11 15 80 00    	lea    0x801511,%esi
+  80150f:	0f 34                	sysenter
+  801511:	5d                   	pop    %ebp
+		goto out;
+  801512:	eb d5                	jmp    8014e9 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801514:	83 ec 0c             	sub    $0xc,%esp
+  801517:	50                   	push   %eax
+  801518:	6a 1f                	push   $0x1f
+  80151a:	68 cb 38 80 00       	push   $0x8038cb
+  80151f:	6a 3f                	push   $0x3f
+  801521:	68 e8 38 80 00       	push   $0x8038e8
+  801526:	e8 6c ed ff ff       	call   800297 <_panic>
+
+0080152b <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80152b:	55                   	push   %ebp
+  80152c:	89 e5                	mov    %esp,%ebp
+  80152e:	57                   	push   %edi
+  80152f:	56                   	push   %esi
+  801530:	53                   	push   %ebx
+  801531:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801534:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80153b:	74 23                	je     801560 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  80153d:	be 00 00 00 00       	mov    $0x0,%esi
+  801542:	b8 20 00 00 00       	mov    $0x20,%eax
+  801547:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801550:	89 f7                	mov    %esi,%edi
+  801552:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801554:	85 c0                	test   %eax,%eax
+  801556:	7f 29                	jg     801581 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801558:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80155b:	5b                   	pop    %ebx
+  80155c:	5e                   	pop    %esi
+  80155d:	5f                   	pop    %edi
+  80155e:	5d                   	pop    %ebp
+  80155f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801560:	8b 55 08             	mov    0x8(%ebp),%edx
+  801563:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801566:	b8 20 00 00 00       	mov    $0x20,%eax
+  80156b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801570:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801573:	55                   	push   %ebp
+  801574:	89 e5                	mov    %esp,%ebp
+  801576:	8d 35 7e 15 80 00    	lea    0x80157e,%esi
+  80157c:	0f 34                	sysenter
+  80157e:	5d                   	pop    %ebp
+		goto out;
+  80157f:	eb d3                	jmp    801554 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801581:	83 ec 0c             	sub    $0xc,%esp
+  801584:	50                   	push   %eax
+  801585:	6a 20                	push   $0x20
+  801587:	68 cb 38 80 00       	push   $0x8038cb
+  80158c:	6a 3f                	push   $0x3f
+  80158e:	68 e8 38 80 00       	push   $0x8038e8
+  801593:	e8 ff ec ff ff       	call   800297 <_panic>
+
+00801598 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	57                   	push   %edi
+  80159c:	56                   	push   %esi
+  80159d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80159e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015a5:	74 1b                	je     8015c2 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8015a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ac:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b7:	89 df                	mov    %ebx,%edi
+  8015b9:	89 de                	mov    %ebx,%esi
+  8015bb:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8015bd:	5b                   	pop    %ebx
+  8015be:	5e                   	pop    %esi
+  8015bf:	5f                   	pop    %edi
+  8015c0:	5d                   	pop    %ebp
+  8015c1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015cd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015d2:	89 df                	mov    %ebx,%edi
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	8d 35 df 15 80 00    	lea    0x8015df,%esi
+  8015dd:	0f 34                	sysenter
+  8015df:	5d                   	pop    %ebp
+		goto out;
+  8015e0:	eb db                	jmp    8015bd <sys_batch+0x25>
+
+008015e2 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	57                   	push   %edi
+  8015e6:	56                   	push   %esi
+  8015e7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015e8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015ef:	74 1a                	je     80160b <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8015f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015f6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fe:	89 cb                	mov    %ecx,%ebx
+  801600:	89 cf                	mov    %ecx,%edi
+  801602:	89 ce                	mov    %ecx,%esi
+  801604:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801606:	5b                   	pop    %ebx
+  801607:	5e                   	pop    %esi
+  801608:	5f                   	pop    %edi
+  801609:	5d                   	pop    %ebp
+  80160a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80160b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80160e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801613:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801618:	89 cb                	mov    %ecx,%ebx
+  80161a:	89 cf                	mov    %ecx,%edi
+  80161c:	55                   	push   %ebp
+  80161d:	89 e5                	mov    %esp,%ebp
+  80161f:	8d 35 27 16 80 00    	lea    0x801627,%esi
+  801625:	0f 34                	sysenter
+  801627:	5d                   	pop    %ebp
+		goto out;
+  801628:	eb dc                	jmp    801606 <sys_trace_ctl+0x24>
+
+0080162a <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80162a:	55                   	push   %ebp
+  80162b:	89 e5                	mov    %esp,%ebp
+  80162d:	57                   	push   %edi
+  80162e:	56                   	push   %esi
+  80162f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801630:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801637:	74 1c                	je     801655 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801639:	be 00 00 00 00       	mov    $0x0,%esi
+  80163e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801643:	8b 55 08             	mov    0x8(%ebp),%edx
+  801646:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801649:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80164c:	89 f7                	mov    %esi,%edi
+  80164e:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801650:	5b                   	pop    %ebx
+  801651:	5e                   	pop    %esi
+  801652:	5f                   	pop    %edi
+  801653:	5d                   	pop    %ebp
+  801654:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801655:	8b 55 08             	mov    0x8(%ebp),%edx
+  801658:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80165b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801660:	bf 00 00 00 00       	mov    $0x0,%edi
+  801665:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801668:	55                   	push   %ebp
+  801669:	89 e5                	mov    %esp,%ebp
+  80166b:	8d 35 73 16 80 00    	lea    0x801673,%esi
+  801671:	0f 34                	sysenter
+  801673:	5d                   	pop    %ebp
+		goto out;
+  801674:	eb da                	jmp    801650 <sys_trace_read+0x26>
+
+00801676 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801676:	55                   	push   %ebp
+  801677:	89 e5                	mov    %esp,%ebp
+  801679:	57                   	push   %edi
+  80167a:	56                   	push   %esi
+  80167b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80167c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801683:	74 1c                	je     8016a1 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801685:	be 00 00 00 00       	mov    $0x0,%esi
+  80168a:	b8 21 00 00 00       	mov    $0x21,%eax
+  80168f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801692:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801695:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801698:	89 f7                	mov    %esi,%edi
+  80169a:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80169c:	5b                   	pop    %ebx
+  80169d:	5e                   	pop    %esi
+  80169e:	5f                   	pop    %edi
+  80169f:	5d                   	pop    %ebp
+  8016a0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a7:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016b4:	55                   	push   %ebp
+  8016b5:	89 e5                	mov    %esp,%ebp
+  8016b7:	8d 35 bf 16 80 00    	lea    0x8016bf,%esi
+  8016bd:	0f 34                	sysenter
+  8016bf:	5d                   	pop    %ebp
+		goto out;
+  8016c0:	eb da                	jmp    80169c <sys_meminfo+0x26>
+
+008016c2 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8016c2:	55                   	push   %ebp
+  8016c3:	89 e5                	mov    %esp,%ebp
+  8016c5:	57                   	push   %edi
+  8016c6:	56                   	push   %esi
+  8016c7:	53                   	push   %ebx
+  8016c8:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8016cb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8016cf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016d6:	74 1f                	je     8016f7 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8016d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016dd:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e5:	89 df                	mov    %ebx,%edi
+  8016e7:	89 de                	mov    %ebx,%esi
+  8016e9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	7f 25                	jg     801714 <sys_env_set_ksm+0x52>
+}
+  8016ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5f                   	pop    %edi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ff:	b8 22 00 00 00       	mov    $0x22,%eax
+  801704:	89 df                	mov    %ebx,%edi
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	8d 35 11 17 80 00    	lea    0x801711,%esi
+  80170f:	0f 34                	sysenter
+  801711:	5d                   	pop    %ebp
+		goto out;
+  801712:	eb d7                	jmp    8016eb <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801714:	83 ec 0c             	sub    $0xc,%esp
+  801717:	50                   	push   %eax
+  801718:	6a 22                	push   $0x22
+  80171a:	68 cb 38 80 00       	push   $0x8038cb
+  80171f:	6a 3f                	push   $0x3f
+  801721:	68 e8 38 80 00       	push   $0x8038e8
+  801726:	e8 6c eb ff ff       	call   800297 <_panic>
+
+0080172b <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80172b:	55                   	push   %ebp
+  80172c:	89 e5                	mov    %esp,%ebp
+  80172e:	57                   	push   %edi
+  80172f:	56                   	push   %esi
+  801730:	53                   	push   %ebx
+  801731:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801734:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801737:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80173e:	74 24                	je     801764 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801740:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801745:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80174a:	89 cb                	mov    %ecx,%ebx
+  80174c:	89 cf                	mov    %ecx,%edi
+  80174e:	89 ce                	mov    %ecx,%esi
+  801750:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801752:	85 c0                	test   %eax,%eax
+  801754:	7f 2a                	jg     801780 <sys_time_nsec+0x55>
+	return ns;
+}
+  801756:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801759:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80175c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80175f:	5b                   	pop    %ebx
+  801760:	5e                   	pop    %esi
+  801761:	5f                   	pop    %edi
+  801762:	5d                   	pop    %ebp
+  801763:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801764:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801769:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80176e:	89 cb                	mov    %ecx,%ebx
+  801770:	89 cf                	mov    %ecx,%edi
+  801772:	55                   	push   %ebp
+  801773:	89 e5                	mov    %esp,%ebp
+  801775:	8d 35 7d 17 80 00    	lea    0x80177d,%esi
+  80177b:	0f 34                	sysenter
+  80177d:	5d                   	pop    %ebp
+		goto out;
+  80177e:	eb d2                	jmp    801752 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801780:	83 ec 0c             	sub    $0xc,%esp
+  801783:	50                   	push   %eax
+  801784:	6a 0f                	push   $0xf
+  801786:	68 cb 38 80 00       	push   $0x8038cb
+  80178b:	6a 3f                	push   $0x3f
+  80178d:	68 e8 38 80 00       	push   $0x8038e8
+  801792:	e8 00 eb ff ff       	call   800297 <_panic>
+
+00801797 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	57                   	push   %edi
+  80179b:	56                   	push   %esi
+  80179c:	53                   	push   %ebx
+  80179d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017a0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017a7:	74 22                	je     8017cb <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8017a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ae:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b9:	89 df                	mov    %ebx,%edi
+  8017bb:	89 de                	mov    %ebx,%esi
+  8017bd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	7f 28                	jg     8017eb <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8017c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c6:	5b                   	pop    %ebx
+  8017c7:	5e                   	pop    %esi
+  8017c8:	5f                   	pop    %edi
+  8017c9:	5d                   	pop    %ebp
+  8017ca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017db:	89 df                	mov    %ebx,%edi
+  8017dd:	55                   	push   %ebp
+  8017de:	89 e5                	mov    %esp,%ebp
+  8017e0:	8d 35 e8 17 80 00    	lea    0x8017e8,%esi
+  8017e6:	0f 34                	sysenter
+  8017e8:	5d                   	pop    %ebp
+		goto out;
+  8017e9:	eb d4                	jmp    8017bf <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017eb:	83 ec 0c             	sub    $0xc,%esp
+  8017ee:	50                   	push   %eax
+  8017ef:	6a 12                	push   $0x12
+  8017f1:	68 cb 38 80 00       	push   $0x8038cb
+  8017f6:	6a 3f                	push   $0x3f
+  8017f8:	68 e8 38 80 00       	push   $0x8038e8
+  8017fd:	e8 95 ea ff ff       	call   800297 <_panic>
+
+00801802 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801802:	55                   	push   %ebp
+  801803:	89 e5                	mov    %esp,%ebp
+  801805:	57                   	push   %edi
+  801806:	56                   	push   %esi
+  801807:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801808:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80180f:	74 1b                	je     80182c <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801816:	b8 13 00 00 00       	mov    $0x13,%eax
+  80181b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801821:	89 df                	mov    %ebx,%edi
+  801823:	89 de                	mov    %ebx,%esi
+  801825:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801827:	5b                   	pop    %ebx
+  801828:	5e                   	pop    %esi
+  801829:	5f                   	pop    %edi
+  80182a:	5d                   	pop    %ebp
+  80182b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80182c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801831:	8b 55 08             	mov    0x8(%ebp),%edx
+  801834:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801837:	b8 13 00 00 00       	mov    $0x13,%eax
+  80183c:	89 df                	mov    %ebx,%edi
+  80183e:	55                   	push   %ebp
+  80183f:	89 e5                	mov    %esp,%ebp
+  801841:	8d 35 49 18 80 00    	lea    0x801849,%esi
+  801847:	0f 34                	sysenter
+  801849:	5d                   	pop    %ebp
+		goto out;
+  80184a:	eb db                	jmp    801827 <sys_e1000_receive+0x25>
+
+0080184c <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80184c:	55                   	push   %ebp
+  80184d:	89 e5                	mov    %esp,%ebp
+  80184f:	57                   	push   %edi
+  801850:	56                   	push   %esi
+  801851:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801852:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801859:	74 1b                	je     801876 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80185b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801860:	b8 14 00 00 00       	mov    $0x14,%eax
+  801865:	8b 55 08             	mov    0x8(%ebp),%edx
+  801868:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80186b:	89 df                	mov    %ebx,%edi
+  80186d:	89 de                	mov    %ebx,%esi
+  80186f:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801871:	5b                   	pop    %ebx
+  801872:	5e                   	pop    %esi
+  801873:	5f                   	pop    %edi
+  801874:	5d                   	pop    %ebp
+  801875:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801876:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80187b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801881:	b8 14 00 00 00       	mov    $0x14,%eax
+  801886:	89 df                	mov    %ebx,%edi
+  801888:	55                   	push   %ebp
+  801889:	89 e5                	mov    %esp,%ebp
+  80188b:	8d 35 93 18 80 00    	lea    0x801893,%esi
+  801891:	0f 34                	sysenter
+  801893:	5d                   	pop    %ebp
+		goto out;
+  801894:	eb db                	jmp    801871 <sys_e1000_read_hwaddr+0x25>
+
+00801896 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801896:	55                   	push   %ebp
+  801897:	89 e5                	mov    %esp,%ebp
+  801899:	57                   	push   %edi
+  80189a:	56                   	push   %esi
+  80189b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80189c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018a3:	74 1a                	je     8018bf <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8018a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018aa:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b2:	89 cb                	mov    %ecx,%ebx
+  8018b4:	89 cf                	mov    %ecx,%edi
+  8018b6:	89 ce                	mov    %ecx,%esi
+  8018b8:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8018ba:	5b                   	pop    %ebx
+  8018bb:	5e                   	pop    %esi
+  8018bc:	5f                   	pop    %edi
+  8018bd:	5d                   	pop    %ebp
+  8018be:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018cc:	89 cb                	mov    %ecx,%ebx
+  8018ce:	89 cf                	mov    %ecx,%edi
+  8018d0:	55                   	push   %ebp
+  8018d1:	89 e5                	mov    %esp,%ebp
+  8018d3:	8d 35 db 18 80 00    	lea    0x8018db,%esi
+  8018d9:	0f 34                	sysenter
+  8018db:	5d                   	pop    %ebp
+		goto out;
+  8018dc:	eb dc                	jmp    8018ba <sys_sb16_read_version+0x24>
+
+008018de <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  8018de:	55                   	push   %ebp
+  8018df:	89 e5                	mov    %esp,%ebp
+  8018e1:	57                   	push   %edi
+  8018e2:	56                   	push   %esi
+  8018e3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018e4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018eb:	74 1b                	je     801908 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8018ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018fd:	89 df                	mov    %ebx,%edi
+  8018ff:	89 de                	mov    %ebx,%esi
+  801901:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801903:	5b                   	pop    %ebx
+  801904:	5e                   	pop    %esi
+  801905:	5f                   	pop    %edi
+  801906:	5d                   	pop    %ebp
+  801907:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801908:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80190d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801910:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801913:	b8 16 00 00 00       	mov    $0x16,%eax
+  801918:	89 df                	mov    %ebx,%edi
+  80191a:	55                   	push   %ebp
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	8d 35 25 19 80 00    	lea    0x801925,%esi
+  801923:	0f 34                	sysenter
+  801925:	5d                   	pop    %ebp
+		goto out;
+  801926:	eb db                	jmp    801903 <sys_sb16_play+0x25>
+
+00801928 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	53                   	push   %ebx
+  80192c:	83 ec 04             	sub    $0x4,%esp
+  80192f:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801931:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801938:	f6 c4 04             	test   $0x4,%ah
+  80193b:	74 0c                	je     801949 <dupperm+0x21>
+  80193d:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801944:	f6 c4 08             	test   $0x8,%ah
+  801947:	75 62                	jne    8019ab <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801949:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801950:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801955:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80195b:	74 19                	je     801976 <dupperm+0x4e>
+  80195d:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801964:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801969:	83 f8 01             	cmp    $0x1,%eax
+  80196c:	19 c0                	sbb    %eax,%eax
+  80196e:	25 00 08 00 00       	and    $0x800,%eax
+  801973:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801976:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  80197d:	89 c1                	mov    %eax,%ecx
+  80197f:	80 cd 04             	or     $0x4,%ch
+  801982:	f6 c7 04             	test   $0x4,%bh
+  801985:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801988:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80198f:	f6 c1 02             	test   $0x2,%cl
+  801992:	74 12                	je     8019a6 <dupperm+0x7e>
+  801994:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  80199b:	89 c2                	mov    %eax,%edx
+  80199d:	83 ca 02             	or     $0x2,%edx
+  8019a0:	f6 c5 04             	test   $0x4,%ch
+  8019a3:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  8019a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019a9:	c9                   	leave
+  8019aa:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8019ab:	68 f8 38 80 00       	push   $0x8038f8
+  8019b0:	68 90 39 80 00       	push   $0x803990
+  8019b5:	6a 39                	push   $0x39
+  8019b7:	68 a5 39 80 00       	push   $0x8039a5
+  8019bc:	e8 d6 e8 ff ff       	call   800297 <_panic>
+
+008019c1 <pgfault>:
+{
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	53                   	push   %ebx
+  8019c5:	83 ec 04             	sub    $0x4,%esp
+  8019c8:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8019cb:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8019cd:	89 c3                	mov    %eax,%ebx
+  8019cf:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019d5:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  8019d9:	74 6d                	je     801a48 <pgfault+0x87>
+  8019db:	89 da                	mov    %ebx,%edx
+  8019dd:	c1 ea 16             	shr    $0x16,%edx
+  8019e0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019e7:	f6 c2 80             	test   $0x80,%dl
+  8019ea:	75 5c                	jne    801a48 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8019ec:	c1 e8 0c             	shr    $0xc,%eax
+  8019ef:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019f6:	f6 c4 08             	test   $0x8,%ah
+  8019f9:	74 4d                	je     801a48 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8019fb:	83 ec 04             	sub    $0x4,%esp
+  8019fe:	6a 07                	push   $0x7
+  801a00:	68 00 f0 7f 00       	push   $0x7ff000
+  801a05:	6a 00                	push   $0x0
+  801a07:	e8 a6 f4 ff ff       	call   800eb2 <sys_page_alloc>
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	78 49                	js     801a5c <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801a13:	83 ec 04             	sub    $0x4,%esp
+  801a16:	68 00 10 00 00       	push   $0x1000
+  801a1b:	53                   	push   %ebx
+  801a1c:	68 00 f0 7f 00       	push   $0x7ff000
+  801a21:	e8 1a f1 ff ff       	call   800b40 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801a26:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801a2d:	53                   	push   %ebx
+  801a2e:	6a 00                	push   $0x0
+  801a30:	68 00 f0 7f 00       	push   $0x7ff000
+  801a35:	6a 00                	push   $0x0
+  801a37:	e8 e3 f4 ff ff       	call   800f1f <sys_page_map>
+  801a3c:	83 c4 20             	add    $0x20,%esp
+  801a3f:	85 c0                	test   %eax,%eax
+  801a41:	78 2d                	js     801a70 <pgfault+0xaf>
+}
+  801a43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a46:	c9                   	leave
+  801a47:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801a48:	83 ec 04             	sub    $0x4,%esp
+  801a4b:	68 b0 39 80 00       	push   $0x8039b0
+  801a50:	6a 1e                	push   $0x1e
+  801a52:	68 a5 39 80 00       	push   $0x8039a5
+  801a57:	e8 3b e8 ff ff       	call   800297 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801a5c:	83 ec 04             	sub    $0x4,%esp
+  801a5f:	68 2c 39 80 00       	push   $0x80392c
+  801a64:	6a 29                	push   $0x29
+  801a66:	68 a5 39 80 00       	push   $0x8039a5
+  801a6b:	e8 27 e8 ff ff       	call   800297 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801a70:	50                   	push   %eax
+  801a71:	68 60 39 80 00       	push   $0x803960
+  801a76:	6a 2e                	push   $0x2e
+  801a78:	68 a5 39 80 00       	push   $0x8039a5
+  801a7d:	e8 15 e8 ff ff       	call   800297 <_panic>
+
+00801a82 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801a82:	55                   	push   %ebp
+  801a83:	89 e5                	mov    %esp,%ebp
+  801a85:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801a88:	ff 75 0c             	push   0xc(%ebp)
+  801a8b:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801a8e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a95:	e8 23 f3 ff ff       	call   800dbd <sys_env_destroy>
+}
+  801a9a:	83 c4 10             	add    $0x10,%esp
+  801a9d:	c9                   	leave
+  801a9e:	c3                   	ret
+
+00801a9f <ufork>:
+{
+  801a9f:	55                   	push   %ebp
+  801aa0:	89 e5                	mov    %esp,%ebp
+  801aa2:	57                   	push   %edi
+  801aa3:	56                   	push   %esi
+  801aa4:	53                   	push   %ebx
+  801aa5:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801aab:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ab0:	cd 30                	int    $0x30
+  801ab2:	89 c6                	mov    %eax,%esi
+  801ab4:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 56                	js     801b14 <ufork+0x75>
+	if (pid > 0) {
+  801abe:	0f 8e b3 02 00 00    	jle    801d77 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801ac4:	83 ec 0c             	sub    $0xc,%esp
+  801ac7:	68 c1 19 80 00       	push   $0x8019c1
+  801acc:	e8 58 17 00 00       	call   803229 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801ad1:	83 c4 08             	add    $0x8,%esp
+  801ad4:	68 90 32 80 00       	push   $0x803290
+  801ad9:	56                   	push   %esi
+  801ada:	e8 ef f5 ff ff       	call   8010ce <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801adf:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801ae5:	89 1c 24             	mov    %ebx,(%esp)
+  801ae8:	e8 21 03 00 00       	call   801e0e <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801aed:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801af4:	6a 07                	push   $0x7
+  801af6:	68 00 f0 bf ee       	push   $0xeebff000
+  801afb:	56                   	push   %esi
+  801afc:	53                   	push   %ebx
+  801afd:	e8 8d 04 00 00       	call   801f8f <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b02:	83 c4 20             	add    $0x20,%esp
+  801b05:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b0a:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801b10:	89 fe                	mov    %edi,%esi
+  801b12:	eb 22                	jmp    801b36 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801b14:	50                   	push   %eax
+  801b15:	68 c9 39 80 00       	push   $0x8039c9
+  801b1a:	68 a9 00 00 00       	push   $0xa9
+  801b1f:	68 a5 39 80 00       	push   $0x8039a5
+  801b24:	e8 6e e7 ff ff       	call   800297 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b29:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b2f:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b34:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b36:	89 f7                	mov    %esi,%edi
+  801b38:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801b3e:	0f 87 e9 01 00 00    	ja     801d2d <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801b44:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801b4a:	85 f6                	test   %esi,%esi
+  801b4c:	0f 49 d6             	cmovns %esi,%edx
+  801b4f:	c1 fa 0a             	sar    $0xa,%edx
+  801b52:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801b59:	f6 c1 01             	test   $0x1,%cl
+  801b5c:	74 cb                	je     801b29 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801b5e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b65:	f6 c2 80             	test   $0x80,%dl
+  801b68:	75 17                	jne    801b81 <ufork+0xe2>
+			j = i + 1;
+  801b6a:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801b6d:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801b74:	f6 c2 01             	test   $0x1,%dl
+  801b77:	0f 85 f3 00 00 00    	jne    801c70 <ufork+0x1d1>
+			j = i + 1;
+  801b7d:	89 de                	mov    %ebx,%esi
+  801b7f:	eb b5                	jmp    801b36 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801b81:	89 fb                	mov    %edi,%ebx
+  801b83:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801b86:	89 d8                	mov    %ebx,%eax
+  801b88:	c1 e8 16             	shr    $0x16,%eax
+  801b8b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b92:	89 c2                	mov    %eax,%edx
+  801b94:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801b9a:	25 02 04 00 00       	and    $0x402,%eax
+  801b9f:	83 f8 02             	cmp    $0x2,%eax
+  801ba2:	74 31                	je     801bd5 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801ba4:	83 ec 04             	sub    $0x4,%esp
+  801ba7:	6a 01                	push   $0x1
+  801ba9:	52                   	push   %edx
+  801baa:	53                   	push   %ebx
+  801bab:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bb1:	53                   	push   %ebx
+  801bb2:	6a 00                	push   $0x0
+  801bb4:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801bba:	50                   	push   %eax
+  801bbb:	e8 fa 03 00 00       	call   801fba <batch_map>
+		return;
+  801bc0:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801bc3:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801bc9:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801bce:	89 c6                	mov    %eax,%esi
+				continue;
+  801bd0:	e9 61 ff ff ff       	jmp    801b36 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801bd5:	83 ec 04             	sub    $0x4,%esp
+  801bd8:	80 ca 80             	or     $0x80,%dl
+  801bdb:	52                   	push   %edx
+  801bdc:	53                   	push   %ebx
+  801bdd:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801be3:	e8 ca f2 ff ff       	call   800eb2 <sys_page_alloc>
+  801be8:	83 c4 10             	add    $0x10,%esp
+  801beb:	85 c0                	test   %eax,%eax
+  801bed:	78 5d                	js     801c4c <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801bef:	83 ec 0c             	sub    $0xc,%esp
+  801bf2:	6a 07                	push   $0x7
+  801bf4:	68 00 00 40 00       	push   $0x400000
+  801bf9:	6a 00                	push   $0x0
+  801bfb:	53                   	push   %ebx
+  801bfc:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c02:	e8 18 f3 ff ff       	call   800f1f <sys_page_map>
+  801c07:	83 c4 20             	add    $0x20,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 50                	js     801c5e <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801c0e:	83 ec 04             	sub    $0x4,%esp
+  801c11:	68 00 00 40 00       	push   $0x400000
+  801c16:	53                   	push   %ebx
+  801c17:	68 00 00 40 00       	push   $0x400000
+  801c1c:	e8 1f ef ff ff       	call   800b40 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801c21:	83 c4 08             	add    $0x8,%esp
+  801c24:	68 00 00 40 00       	push   $0x400000
+  801c29:	6a 00                	push   $0x0
+  801c2b:	e8 5d f3 ff ff       	call   800f8d <sys_page_unmap>
+  801c30:	83 c4 10             	add    $0x10,%esp
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	79 8c                	jns    801bc3 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801c37:	50                   	push   %eax
+  801c38:	68 fd 39 80 00       	push   $0x8039fd
+  801c3d:	68 81 00 00 00       	push   $0x81
+  801c42:	68 a5 39 80 00       	push   $0x8039a5
+  801c47:	e8 4b e6 ff ff       	call   800297 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801c4c:	50                   	push   %eax
+  801c4d:	68 d9 39 80 00       	push   $0x8039d9
+  801c52:	6a 7c                	push   $0x7c
+  801c54:	68 a5 39 80 00       	push   $0x8039a5
+  801c59:	e8 39 e6 ff ff       	call   800297 <_panic>
+		panic("sys_page_map: %e", r);
+  801c5e:	50                   	push   %eax
+  801c5f:	68 ec 39 80 00       	push   $0x8039ec
+  801c64:	6a 7e                	push   $0x7e
+  801c66:	68 a5 39 80 00       	push   $0x8039a5
+  801c6b:	e8 27 e6 ff ff       	call   800297 <_panic>
+  801c70:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801c76:	eb 22                	jmp    801c9a <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801c78:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c7f:	a8 01                	test   $0x1,%al
+  801c81:	74 35                	je     801cb8 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801c83:	89 d8                	mov    %ebx,%eax
+  801c85:	e8 9e fc ff ff       	call   801928 <dupperm>
+  801c8a:	89 c6                	mov    %eax,%esi
+  801c8c:	89 f8                	mov    %edi,%eax
+  801c8e:	e8 95 fc ff ff       	call   801928 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c93:	39 c6                	cmp    %eax,%esi
+  801c95:	75 21                	jne    801cb8 <ufork+0x219>
+				j++;
+  801c97:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c9a:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801ca0:	74 16                	je     801cb8 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801ca2:	89 d8                	mov    %ebx,%eax
+  801ca4:	c1 e8 0a             	shr    $0xa,%eax
+  801ca7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cae:	25 81 00 00 00       	and    $0x81,%eax
+  801cb3:	83 f8 01             	cmp    $0x1,%eax
+  801cb6:	74 c0                	je     801c78 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801cb8:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801cbe:	89 d8                	mov    %ebx,%eax
+  801cc0:	29 f0                	sub    %esi,%eax
+  801cc2:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801cc8:	89 fe                	mov    %edi,%esi
+  801cca:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801ccd:	89 f8                	mov    %edi,%eax
+  801ccf:	e8 54 fc ff ff       	call   801928 <dupperm>
+  801cd4:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801cd6:	83 ec 08             	sub    $0x8,%esp
+  801cd9:	6a 02                	push   $0x2
+  801cdb:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801ce1:	51                   	push   %ecx
+  801ce2:	e8 95 01 00 00       	call   801e7c <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801ce7:	83 c4 0c             	add    $0xc,%esp
+  801cea:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801cf0:	57                   	push   %edi
+  801cf1:	56                   	push   %esi
+  801cf2:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801cf8:	56                   	push   %esi
+  801cf9:	6a 00                	push   $0x0
+  801cfb:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d01:	51                   	push   %ecx
+  801d02:	e8 b3 02 00 00       	call   801fba <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801d07:	83 c4 1c             	add    $0x1c,%esp
+  801d0a:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d10:	57                   	push   %edi
+  801d11:	56                   	push   %esi
+  801d12:	6a 00                	push   $0x0
+  801d14:	56                   	push   %esi
+  801d15:	6a 00                	push   $0x0
+  801d17:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d1d:	50                   	push   %eax
+  801d1e:	e8 97 02 00 00       	call   801fba <batch_map>
+	return 0;
+  801d23:	83 c4 20             	add    $0x20,%esp
+  801d26:	89 de                	mov    %ebx,%esi
+  801d28:	e9 09 fe ff ff       	jmp    801b36 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801d2d:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801d33:	83 ec 04             	sub    $0x4,%esp
+  801d36:	6a 02                	push   $0x2
+  801d38:	56                   	push   %esi
+  801d39:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d3f:	53                   	push   %ebx
+  801d40:	e8 c9 02 00 00       	call   80200e <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801d45:	89 1c 24             	mov    %ebx,(%esp)
+  801d48:	e8 dd 00 00 00       	call   801e2a <batch_flush>
+  801d4d:	83 c4 10             	add    $0x10,%esp
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	78 0e                	js     801d62 <ufork+0x2c3>
+}
+  801d54:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5d:	5b                   	pop    %ebx
+  801d5e:	5e                   	pop    %esi
+  801d5f:	5f                   	pop    %edi
+  801d60:	5d                   	pop    %ebp
+  801d61:	c3                   	ret
+			panic("fork: %e", r);
+  801d62:	50                   	push   %eax
+  801d63:	68 d0 39 80 00       	push   $0x8039d0
+  801d68:	68 d7 00 00 00       	push   $0xd7
+  801d6d:	68 a5 39 80 00       	push   $0x8039a5
+  801d72:	e8 20 e5 ff ff       	call   800297 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d77:	e8 aa f0 ff ff       	call   800e26 <sys_getenvid>
+  801d7c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d81:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d87:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d8c:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801d91:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801d98:	00 00 00 
+  801d9b:	eb b7                	jmp    801d54 <ufork+0x2b5>
+
+00801d9d <fork>:
+{
+  801d9d:	55                   	push   %ebp
+  801d9e:	89 e5                	mov    %esp,%ebp
+  801da0:	53                   	push   %ebx
+  801da1:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801da4:	68 c1 19 80 00       	push   $0x8019c1
+  801da9:	e8 7b 14 00 00       	call   803229 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801dae:	e8 7a f6 ff ff       	call   80142d <sys_fork>
+  801db3:	89 c3                	mov    %eax,%ebx
+  801db5:	83 c4 10             	add    $0x10,%esp
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 09                	js     801dc5 <fork+0x28>
+	if (pid == 0)
+  801dbc:	74 1c                	je     801dda <fork+0x3d>
+}
+  801dbe:	89 d8                	mov    %ebx,%eax
+  801dc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dc3:	c9                   	leave
+  801dc4:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801dc5:	50                   	push   %eax
+  801dc6:	68 c9 39 80 00       	push   $0x8039c9
+  801dcb:	68 ed 00 00 00       	push   $0xed
+  801dd0:	68 a5 39 80 00       	push   $0x8039a5
+  801dd5:	e8 bd e4 ff ff       	call   800297 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801dda:	e8 47 f0 ff ff       	call   800e26 <sys_getenvid>
+  801ddf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801de4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dea:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801def:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801df4:	eb c8                	jmp    801dbe <fork+0x21>
+
+00801df6 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801df6:	55                   	push   %ebp
+  801df7:	89 e5                	mov    %esp,%ebp
+  801df9:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801dfc:	ff 75 0c             	push   0xc(%ebp)
+  801dff:	ff 75 08             	push   0x8(%ebp)
+  801e02:	68 82 1a 80 00       	push   $0x801a82
+  801e07:	e8 67 f6 ff ff       	call   801473 <sys_thread_create>
+}
+  801e0c:	c9                   	leave
+  801e0d:	c3                   	ret
+
+00801e0e <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801e14:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801e1b:	00 00 00 
+	b->b_error = 0;
+  801e1e:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801e25:	00 00 00 
+}
+  801e28:	5d                   	pop    %ebp
+  801e29:	c3                   	ret
+
+00801e2a <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	53                   	push   %ebx
+  801e2e:	83 ec 04             	sub    $0x4,%esp
+  801e31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801e34:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	7e 09                	jle    801e47 <batch_flush+0x1d>
+  801e3e:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801e45:	74 15                	je     801e5c <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801e47:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801e4e:	00 00 00 
+	return b->b_error;
+  801e51:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801e57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5a:	c9                   	leave
+  801e5b:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801e5c:	83 ec 08             	sub    $0x8,%esp
+  801e5f:	50                   	push   %eax
+  801e60:	53                   	push   %ebx
+  801e61:	e8 32 f7 ff ff       	call   801598 <sys_batch>
+  801e66:	83 c4 10             	add    $0x10,%esp
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	79 da                	jns    801e47 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801e6d:	f7 d8                	neg    %eax
+  801e6f:	0f b6 c0             	movzbl %al,%eax
+  801e72:	f7 d8                	neg    %eax
+  801e74:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801e7a:	eb cb                	jmp    801e47 <batch_flush+0x1d>
+
+00801e7c <batch_reserve>:
+{
+  801e7c:	55                   	push   %ebp
+  801e7d:	89 e5                	mov    %esp,%ebp
+  801e7f:	83 ec 08             	sub    $0x8,%esp
+  801e82:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801e85:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801e8b:	03 45 0c             	add    0xc(%ebp),%eax
+  801e8e:	83 f8 10             	cmp    $0x10,%eax
+  801e91:	7f 02                	jg     801e95 <batch_reserve+0x19>
+}
+  801e93:	c9                   	leave
+  801e94:	c3                   	ret
+		batch_flush(b);
+  801e95:	83 ec 0c             	sub    $0xc,%esp
+  801e98:	52                   	push   %edx
+  801e99:	e8 8c ff ff ff       	call   801e2a <batch_flush>
+  801e9e:	83 c4 10             	add    $0x10,%esp
+}
+  801ea1:	eb f0                	jmp    801e93 <batch_reserve+0x17>
+
+00801ea3 <batch_next>:
+{
+  801ea3:	55                   	push   %ebp
+  801ea4:	89 e5                	mov    %esp,%ebp
+  801ea6:	53                   	push   %ebx
+  801ea7:	83 ec 04             	sub    $0x4,%esp
+  801eaa:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801eac:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801eb3:	74 28                	je     801edd <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801eb5:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801ebb:	8d 50 01             	lea    0x1(%eax),%edx
+  801ebe:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801ec4:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801ec7:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801ec9:	83 ec 04             	sub    $0x4,%esp
+  801ecc:	6a 1c                	push   $0x1c
+  801ece:	6a 00                	push   $0x0
+  801ed0:	53                   	push   %ebx
+  801ed1:	e8 35 ec ff ff       	call   800b0b <memset>
+}
+  801ed6:	89 d8                	mov    %ebx,%eax
+  801ed8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801edb:	c9                   	leave
+  801edc:	c3                   	ret
+		batch_flush(b);
+  801edd:	83 ec 0c             	sub    $0xc,%esp
+  801ee0:	50                   	push   %eax
+  801ee1:	e8 44 ff ff ff       	call   801e2a <batch_flush>
+  801ee6:	83 c4 10             	add    $0x10,%esp
+  801ee9:	eb ca                	jmp    801eb5 <batch_next+0x12>
+
+00801eeb <batch_page>:
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	57                   	push   %edi
+  801eef:	56                   	push   %esi
+  801ef0:	53                   	push   %ebx
+  801ef1:	83 ec 1c             	sub    $0x1c,%esp
+  801ef4:	89 d3                	mov    %edx,%ebx
+  801ef6:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801ef8:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801efe:	85 d2                	test   %edx,%edx
+  801f00:	74 50                	je     801f52 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801f02:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801f05:	01 c1                	add    %eax,%ecx
+  801f07:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801f0a:	75 46                	jne    801f52 <batch_page+0x67>
+  801f0c:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801f0f:	75 41                	jne    801f52 <batch_page+0x67>
+  801f11:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801f14:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801f17:	75 39                	jne    801f52 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801f19:	83 ea 01             	sub    $0x1,%edx
+  801f1c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801f1f:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801f22:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801f26:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801f29:	75 27                	jne    801f52 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801f2b:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801f2e:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801f32:	89 fa                	mov    %edi,%edx
+  801f34:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801f37:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801f3a:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801f3d:	39 55 08             	cmp    %edx,0x8(%ebp)
+  801f40:	75 10                	jne    801f52 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801f42:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  801f46:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801f49:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  801f4d:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801f50:	74 2a                	je     801f7c <batch_page+0x91>
+	op = batch_next(b);
+  801f52:	e8 4c ff ff ff       	call   801ea3 <batch_next>
+	op->bo_op = opcode;
+  801f57:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  801f59:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  801f5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f5f:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  801f62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f65:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  801f68:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f6b:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  801f6e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801f71:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  801f74:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801f77:	89 78 14             	mov    %edi,0x14(%eax)
+  801f7a:	eb 0b                	jmp    801f87 <batch_page+0x9c>
+		op->bo_npages += npages;
+  801f7c:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  801f80:	03 7d 18             	add    0x18(%ebp),%edi
+  801f83:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  801f87:	83 c4 1c             	add    $0x1c,%esp
+  801f8a:	5b                   	pop    %ebx
+  801f8b:	5e                   	pop    %esi
+  801f8c:	5f                   	pop    %edi
+  801f8d:	5d                   	pop    %ebp
+  801f8e:	c3                   	ret
+
+00801f8f <batch_alloc>:
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  801f95:	ff 75 18             	push   0x18(%ebp)
+  801f98:	ff 75 14             	push   0x14(%ebp)
+  801f9b:	ff 75 10             	push   0x10(%ebp)
+  801f9e:	ff 75 0c             	push   0xc(%ebp)
+  801fa1:	6a 00                	push   $0x0
+  801fa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fad:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb0:	e8 36 ff ff ff       	call   801eeb <batch_page>
+}
+  801fb5:	83 c4 20             	add    $0x20,%esp
+  801fb8:	c9                   	leave
+  801fb9:	c3                   	ret
+
+00801fba <batch_map>:
+{
+  801fba:	55                   	push   %ebp
+  801fbb:	89 e5                	mov    %esp,%ebp
+  801fbd:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  801fc0:	ff 75 20             	push   0x20(%ebp)
+  801fc3:	ff 75 1c             	push   0x1c(%ebp)
+  801fc6:	ff 75 18             	push   0x18(%ebp)
+  801fc9:	ff 75 14             	push   0x14(%ebp)
+  801fcc:	ff 75 10             	push   0x10(%ebp)
+  801fcf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801fd2:	ba 01 00 00 00       	mov    $0x1,%edx
+  801fd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fda:	e8 0c ff ff ff       	call   801eeb <batch_page>
+}
+  801fdf:	83 c4 20             	add    $0x20,%esp
+  801fe2:	c9                   	leave
+  801fe3:	c3                   	ret
+
+00801fe4 <batch_unmap>:
+{
+  801fe4:	55                   	push   %ebp
+  801fe5:	89 e5                	mov    %esp,%ebp
+  801fe7:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  801fea:	ff 75 14             	push   0x14(%ebp)
+  801fed:	6a 00                	push   $0x0
+  801fef:	ff 75 10             	push   0x10(%ebp)
+  801ff2:	ff 75 0c             	push   0xc(%ebp)
+  801ff5:	6a 00                	push   $0x0
+  801ff7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ffc:	ba 02 00 00 00       	mov    $0x2,%edx
+  802001:	8b 45 08             	mov    0x8(%ebp),%eax
+  802004:	e8 e2 fe ff ff       	call   801eeb <batch_page>
+}
+  802009:	83 c4 20             	add    $0x20,%esp
+  80200c:	c9                   	leave
+  80200d:	c3                   	ret
+
+0080200e <batch_set_status>:
+{
+  80200e:	55                   	push   %ebp
+  80200f:	89 e5                	mov    %esp,%ebp
+  802011:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  802014:	8b 45 08             	mov    0x8(%ebp),%eax
+  802017:	e8 87 fe ff ff       	call   801ea3 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  80201c:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  802022:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802025:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  802028:	8b 55 10             	mov    0x10(%ebp),%edx
+  80202b:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  80202e:	c9                   	leave
+  80202f:	c3                   	ret
+
+00802030 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802030:	55                   	push   %ebp
+  802031:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802033:	8b 45 08             	mov    0x8(%ebp),%eax
+  802036:	05 00 00 00 30       	add    $0x30000000,%eax
+  80203b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80203e:	5d                   	pop    %ebp
+  80203f:	c3                   	ret
+
+00802040 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802040:	55                   	push   %ebp
+  802041:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802043:	8b 45 08             	mov    0x8(%ebp),%eax
+  802046:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80204b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802050:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802055:	5d                   	pop    %ebp
+  802056:	c3                   	ret
+
+00802057 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802057:	55                   	push   %ebp
+  802058:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80205a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80205f:	eb 02                	jmp    802063 <fd_alloc+0xc>
+  802061:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802063:	89 c2                	mov    %eax,%edx
+  802065:	c1 ea 16             	shr    $0x16,%edx
+  802068:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80206f:	f6 c2 01             	test   $0x1,%dl
+  802072:	74 2b                	je     80209f <fd_alloc+0x48>
+  802074:	89 c2                	mov    %eax,%edx
+  802076:	c1 ea 0c             	shr    $0xc,%edx
+  802079:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802080:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802086:	f6 c1 01             	test   $0x1,%cl
+  802089:	74 14                	je     80209f <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80208b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802091:	75 ce                	jne    802061 <fd_alloc+0xa>
+  802093:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802098:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80209d:	eb 05                	jmp    8020a4 <fd_alloc+0x4d>
+			return 0;
+  80209f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8020a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020a7:	89 02                	mov    %eax,(%edx)
+}
+  8020a9:	89 c8                	mov    %ecx,%eax
+  8020ab:	5d                   	pop    %ebp
+  8020ac:	c3                   	ret
+
+008020ad <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8020b3:	83 f8 1f             	cmp    $0x1f,%eax
+  8020b6:	77 30                	ja     8020e8 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8020b8:	c1 e0 0c             	shl    $0xc,%eax
+  8020bb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8020c0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8020c6:	f6 c2 01             	test   $0x1,%dl
+  8020c9:	74 24                	je     8020ef <fd_lookup+0x42>
+  8020cb:	89 c2                	mov    %eax,%edx
+  8020cd:	c1 ea 0c             	shr    $0xc,%edx
+  8020d0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8020d7:	f6 c2 01             	test   $0x1,%dl
+  8020da:	74 1a                	je     8020f6 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8020dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020df:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8020e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020e6:	5d                   	pop    %ebp
+  8020e7:	c3                   	ret
+		return -E_INVAL;
+  8020e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020ed:	eb f7                	jmp    8020e6 <fd_lookup+0x39>
+		return -E_INVAL;
+  8020ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020f4:	eb f0                	jmp    8020e6 <fd_lookup+0x39>
+  8020f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020fb:	eb e9                	jmp    8020e6 <fd_lookup+0x39>
+
+008020fd <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8020fd:	55                   	push   %ebp
+  8020fe:	89 e5                	mov    %esp,%ebp
+  802100:	53                   	push   %ebx
+  802101:	83 ec 04             	sub    $0x4,%esp
+  802104:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210c:	eb 03                	jmp    802111 <dev_lookup+0x14>
+  80210e:	83 c0 01             	add    $0x1,%eax
+  802111:	8b 1c 85 8c 3a 80 00 	mov    0x803a8c(,%eax,4),%ebx
+  802118:	85 db                	test   %ebx,%ebx
+  80211a:	74 0b                	je     802127 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80211c:	39 13                	cmp    %edx,(%ebx)
+  80211e:	75 ee                	jne    80210e <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802120:	b8 00 00 00 00       	mov    $0x0,%eax
+  802125:	eb 2e                	jmp    802155 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  802127:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802129:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80212e:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802134:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802139:	76 24                	jbe    80215f <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80213b:	8b 41 48             	mov    0x48(%ecx),%eax
+  80213e:	83 ec 04             	sub    $0x4,%esp
+  802141:	52                   	push   %edx
+  802142:	50                   	push   %eax
+  802143:	68 10 3a 80 00       	push   $0x803a10
+  802148:	e8 25 e2 ff ff       	call   800372 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802155:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802158:	89 1a                	mov    %ebx,(%edx)
+}
+  80215a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80215d:	c9                   	leave
+  80215e:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80215f:	c1 e8 10             	shr    $0x10,%eax
+  802162:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802168:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80216e:	eb cb                	jmp    80213b <dev_lookup+0x3e>
+
+00802170 <fd_close>:
+{
+  802170:	55                   	push   %ebp
+  802171:	89 e5                	mov    %esp,%ebp
+  802173:	57                   	push   %edi
+  802174:	56                   	push   %esi
+  802175:	53                   	push   %ebx
+  802176:	83 ec 24             	sub    $0x24,%esp
+  802179:	8b 75 08             	mov    0x8(%ebp),%esi
+  80217c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80217f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802182:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802183:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802189:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80218c:	50                   	push   %eax
+  80218d:	e8 1b ff ff ff       	call   8020ad <fd_lookup>
+  802192:	89 c3                	mov    %eax,%ebx
+  802194:	83 c4 10             	add    $0x10,%esp
+  802197:	85 c0                	test   %eax,%eax
+  802199:	78 05                	js     8021a0 <fd_close+0x30>
+	    || fd != fd2)
+  80219b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80219e:	74 16                	je     8021b6 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8021a0:	89 f8                	mov    %edi,%eax
+  8021a2:	84 c0                	test   %al,%al
+  8021a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a9:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8021ac:	89 d8                	mov    %ebx,%eax
+  8021ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b1:	5b                   	pop    %ebx
+  8021b2:	5e                   	pop    %esi
+  8021b3:	5f                   	pop    %edi
+  8021b4:	5d                   	pop    %ebp
+  8021b5:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8021b6:	83 ec 08             	sub    $0x8,%esp
+  8021b9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8021bc:	50                   	push   %eax
+  8021bd:	ff 36                	push   (%esi)
+  8021bf:	e8 39 ff ff ff       	call   8020fd <dev_lookup>
+  8021c4:	89 c3                	mov    %eax,%ebx
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	78 1a                	js     8021e7 <fd_close+0x77>
+		if (dev->dev_close)
+  8021cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8021d0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8021d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	74 0b                	je     8021e7 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8021dc:	83 ec 0c             	sub    $0xc,%esp
+  8021df:	56                   	push   %esi
+  8021e0:	ff d0                	call   *%eax
+  8021e2:	89 c3                	mov    %eax,%ebx
+  8021e4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8021e7:	83 ec 08             	sub    $0x8,%esp
+  8021ea:	56                   	push   %esi
+  8021eb:	6a 00                	push   $0x0
+  8021ed:	e8 9b ed ff ff       	call   800f8d <sys_page_unmap>
+	return r;
+  8021f2:	83 c4 10             	add    $0x10,%esp
+  8021f5:	eb b5                	jmp    8021ac <fd_close+0x3c>
+
+008021f7 <close>:
+
+int
+close(int fdnum)
+{
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802200:	50                   	push   %eax
+  802201:	ff 75 08             	push   0x8(%ebp)
+  802204:	e8 a4 fe ff ff       	call   8020ad <fd_lookup>
+  802209:	83 c4 10             	add    $0x10,%esp
+  80220c:	85 c0                	test   %eax,%eax
+  80220e:	79 02                	jns    802212 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+		return fd_close(fd, 1);
+  802212:	83 ec 08             	sub    $0x8,%esp
+  802215:	6a 01                	push   $0x1
+  802217:	ff 75 f4             	push   -0xc(%ebp)
+  80221a:	e8 51 ff ff ff       	call   802170 <fd_close>
+  80221f:	83 c4 10             	add    $0x10,%esp
+  802222:	eb ec                	jmp    802210 <close+0x19>
+
+00802224 <close_all>:
+
+void
+close_all(void)
+{
+  802224:	55                   	push   %ebp
+  802225:	89 e5                	mov    %esp,%ebp
+  802227:	53                   	push   %ebx
+  802228:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80222b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802230:	83 ec 0c             	sub    $0xc,%esp
+  802233:	53                   	push   %ebx
+  802234:	e8 be ff ff ff       	call   8021f7 <close>
+	for (i = 0; i < MAXFD; i++)
+  802239:	83 c3 01             	add    $0x1,%ebx
+  80223c:	83 c4 10             	add    $0x10,%esp
+  80223f:	83 fb 20             	cmp    $0x20,%ebx
+  802242:	75 ec                	jne    802230 <close_all+0xc>
+}
+  802244:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802247:	c9                   	leave
+  802248:	c3                   	ret
+
+00802249 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802249:	55                   	push   %ebp
+  80224a:	89 e5                	mov    %esp,%ebp
+  80224c:	57                   	push   %edi
+  80224d:	56                   	push   %esi
+  80224e:	53                   	push   %ebx
+  80224f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802252:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802255:	50                   	push   %eax
+  802256:	ff 75 08             	push   0x8(%ebp)
+  802259:	e8 4f fe ff ff       	call   8020ad <fd_lookup>
+  80225e:	89 c3                	mov    %eax,%ebx
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	85 c0                	test   %eax,%eax
+  802265:	78 7f                	js     8022e6 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802267:	83 ec 0c             	sub    $0xc,%esp
+  80226a:	ff 75 0c             	push   0xc(%ebp)
+  80226d:	e8 85 ff ff ff       	call   8021f7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802272:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802275:	c1 e6 0c             	shl    $0xc,%esi
+  802278:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80227e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802281:	89 3c 24             	mov    %edi,(%esp)
+  802284:	e8 b7 fd ff ff       	call   802040 <fd2data>
+  802289:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80228b:	89 34 24             	mov    %esi,(%esp)
+  80228e:	e8 ad fd ff ff       	call   802040 <fd2data>
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802299:	89 d8                	mov    %ebx,%eax
+  80229b:	c1 e8 16             	shr    $0x16,%eax
+  80229e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8022a5:	a8 01                	test   $0x1,%al
+  8022a7:	74 11                	je     8022ba <dup+0x71>
+  8022a9:	89 d8                	mov    %ebx,%eax
+  8022ab:	c1 e8 0c             	shr    $0xc,%eax
+  8022ae:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8022b5:	f6 c2 01             	test   $0x1,%dl
+  8022b8:	75 36                	jne    8022f0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8022ba:	89 f8                	mov    %edi,%eax
+  8022bc:	c1 e8 0c             	shr    $0xc,%eax
+  8022bf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8022c6:	83 ec 0c             	sub    $0xc,%esp
+  8022c9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8022ce:	50                   	push   %eax
+  8022cf:	56                   	push   %esi
+  8022d0:	6a 00                	push   $0x0
+  8022d2:	57                   	push   %edi
+  8022d3:	6a 00                	push   $0x0
+  8022d5:	e8 45 ec ff ff       	call   800f1f <sys_page_map>
+  8022da:	89 c3                	mov    %eax,%ebx
+  8022dc:	83 c4 20             	add    $0x20,%esp
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	78 33                	js     802316 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8022e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8022e6:	89 d8                	mov    %ebx,%eax
+  8022e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022eb:	5b                   	pop    %ebx
+  8022ec:	5e                   	pop    %esi
+  8022ed:	5f                   	pop    %edi
+  8022ee:	5d                   	pop    %ebp
+  8022ef:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8022f0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8022f7:	83 ec 0c             	sub    $0xc,%esp
+  8022fa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8022ff:	50                   	push   %eax
+  802300:	ff 75 d4             	push   -0x2c(%ebp)
+  802303:	6a 00                	push   $0x0
+  802305:	53                   	push   %ebx
+  802306:	6a 00                	push   $0x0
+  802308:	e8 12 ec ff ff       	call   800f1f <sys_page_map>
+  80230d:	89 c3                	mov    %eax,%ebx
+  80230f:	83 c4 20             	add    $0x20,%esp
+  802312:	85 c0                	test   %eax,%eax
+  802314:	79 a4                	jns    8022ba <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802316:	83 ec 08             	sub    $0x8,%esp
+  802319:	56                   	push   %esi
+  80231a:	6a 00                	push   $0x0
+  80231c:	e8 6c ec ff ff       	call   800f8d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802321:	83 c4 08             	add    $0x8,%esp
+  802324:	ff 75 d4             	push   -0x2c(%ebp)
+  802327:	6a 00                	push   $0x0
+  802329:	e8 5f ec ff ff       	call   800f8d <sys_page_unmap>
+	return r;
+  80232e:	83 c4 10             	add    $0x10,%esp
+  802331:	eb b3                	jmp    8022e6 <dup+0x9d>
+
+00802333 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+  802336:	56                   	push   %esi
+  802337:	53                   	push   %ebx
+  802338:	83 ec 18             	sub    $0x18,%esp
+  80233b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80233e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802341:	50                   	push   %eax
+  802342:	53                   	push   %ebx
+  802343:	e8 65 fd ff ff       	call   8020ad <fd_lookup>
+  802348:	83 c4 10             	add    $0x10,%esp
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	78 3c                	js     80238b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80234f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802352:	83 ec 08             	sub    $0x8,%esp
+  802355:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802358:	50                   	push   %eax
+  802359:	ff 36                	push   (%esi)
+  80235b:	e8 9d fd ff ff       	call   8020fd <dev_lookup>
+  802360:	83 c4 10             	add    $0x10,%esp
+  802363:	85 c0                	test   %eax,%eax
+  802365:	78 24                	js     80238b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802367:	8b 46 08             	mov    0x8(%esi),%eax
+  80236a:	83 e0 03             	and    $0x3,%eax
+  80236d:	83 f8 01             	cmp    $0x1,%eax
+  802370:	74 20                	je     802392 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802372:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802375:	8b 40 08             	mov    0x8(%eax),%eax
+  802378:	85 c0                	test   %eax,%eax
+  80237a:	74 57                	je     8023d3 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80237c:	83 ec 04             	sub    $0x4,%esp
+  80237f:	ff 75 10             	push   0x10(%ebp)
+  802382:	ff 75 0c             	push   0xc(%ebp)
+  802385:	56                   	push   %esi
+  802386:	ff d0                	call   *%eax
+  802388:	83 c4 10             	add    $0x10,%esp
+}
+  80238b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80238e:	5b                   	pop    %ebx
+  80238f:	5e                   	pop    %esi
+  802390:	5d                   	pop    %ebp
+  802391:	c3                   	ret
+  802392:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802394:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802399:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80239f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8023a4:	76 1c                	jbe    8023c2 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023a6:	8b 42 48             	mov    0x48(%edx),%eax
+  8023a9:	83 ec 04             	sub    $0x4,%esp
+  8023ac:	53                   	push   %ebx
+  8023ad:	50                   	push   %eax
+  8023ae:	68 51 3a 80 00       	push   $0x803a51
+  8023b3:	e8 ba df ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023c0:	eb c9                	jmp    80238b <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8023c2:	c1 e8 10             	shr    $0x10,%eax
+  8023c5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8023cb:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8023d1:	eb d3                	jmp    8023a6 <read+0x73>
+		return -E_NOT_SUPP;
+  8023d3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023d8:	eb b1                	jmp    80238b <read+0x58>
+
+008023da <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8023da:	55                   	push   %ebp
+  8023db:	89 e5                	mov    %esp,%ebp
+  8023dd:	57                   	push   %edi
+  8023de:	56                   	push   %esi
+  8023df:	53                   	push   %ebx
+  8023e0:	83 ec 0c             	sub    $0xc,%esp
+  8023e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023e6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8023e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023ee:	eb 02                	jmp    8023f2 <readn+0x18>
+  8023f0:	01 c3                	add    %eax,%ebx
+  8023f2:	39 f3                	cmp    %esi,%ebx
+  8023f4:	73 21                	jae    802417 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8023f6:	83 ec 04             	sub    $0x4,%esp
+  8023f9:	89 f0                	mov    %esi,%eax
+  8023fb:	29 d8                	sub    %ebx,%eax
+  8023fd:	50                   	push   %eax
+  8023fe:	89 d8                	mov    %ebx,%eax
+  802400:	03 45 0c             	add    0xc(%ebp),%eax
+  802403:	50                   	push   %eax
+  802404:	57                   	push   %edi
+  802405:	e8 29 ff ff ff       	call   802333 <read>
+		if (m < 0)
+  80240a:	83 c4 10             	add    $0x10,%esp
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 04                	js     802415 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802411:	75 dd                	jne    8023f0 <readn+0x16>
+  802413:	eb 02                	jmp    802417 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802415:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  802417:	89 d8                	mov    %ebx,%eax
+  802419:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80241c:	5b                   	pop    %ebx
+  80241d:	5e                   	pop    %esi
+  80241e:	5f                   	pop    %edi
+  80241f:	5d                   	pop    %ebp
+  802420:	c3                   	ret
+
+00802421 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	56                   	push   %esi
+  802425:	53                   	push   %ebx
+  802426:	83 ec 18             	sub    $0x18,%esp
+  802429:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80242c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80242f:	50                   	push   %eax
+  802430:	53                   	push   %ebx
+  802431:	e8 77 fc ff ff       	call   8020ad <fd_lookup>
+  802436:	83 c4 10             	add    $0x10,%esp
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	78 37                	js     802474 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80243d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802440:	83 ec 08             	sub    $0x8,%esp
+  802443:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802446:	50                   	push   %eax
+  802447:	ff 36                	push   (%esi)
+  802449:	e8 af fc ff ff       	call   8020fd <dev_lookup>
+  80244e:	83 c4 10             	add    $0x10,%esp
+  802451:	85 c0                	test   %eax,%eax
+  802453:	78 1f                	js     802474 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802455:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802459:	74 20                	je     80247b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80245b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80245e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802461:	85 c0                	test   %eax,%eax
+  802463:	74 57                	je     8024bc <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802465:	83 ec 04             	sub    $0x4,%esp
+  802468:	ff 75 10             	push   0x10(%ebp)
+  80246b:	ff 75 0c             	push   0xc(%ebp)
+  80246e:	56                   	push   %esi
+  80246f:	ff d0                	call   *%eax
+  802471:	83 c4 10             	add    $0x10,%esp
+}
+  802474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802477:	5b                   	pop    %ebx
+  802478:	5e                   	pop    %esi
+  802479:	5d                   	pop    %ebp
+  80247a:	c3                   	ret
+  80247b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80247d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802482:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802488:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80248d:	76 1c                	jbe    8024ab <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80248f:	8b 42 48             	mov    0x48(%edx),%eax
+  802492:	83 ec 04             	sub    $0x4,%esp
+  802495:	53                   	push   %ebx
+  802496:	50                   	push   %eax
+  802497:	68 6d 3a 80 00       	push   $0x803a6d
+  80249c:	e8 d1 de ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024a9:	eb c9                	jmp    802474 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8024ab:	c1 e8 10             	shr    $0x10,%eax
+  8024ae:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8024b4:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8024ba:	eb d3                	jmp    80248f <write+0x6e>
+		return -E_NOT_SUPP;
+  8024bc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024c1:	eb b1                	jmp    802474 <write+0x53>
+
+008024c3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8024c3:	55                   	push   %ebp
+  8024c4:	89 e5                	mov    %esp,%ebp
+  8024c6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024cc:	50                   	push   %eax
+  8024cd:	ff 75 08             	push   0x8(%ebp)
+  8024d0:	e8 d8 fb ff ff       	call   8020ad <fd_lookup>
+  8024d5:	83 c4 10             	add    $0x10,%esp
+  8024d8:	85 c0                	test   %eax,%eax
+  8024da:	78 0e                	js     8024ea <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8024dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024e2:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8024e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ea:	c9                   	leave
+  8024eb:	c3                   	ret
+
+008024ec <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8024ec:	55                   	push   %ebp
+  8024ed:	89 e5                	mov    %esp,%ebp
+  8024ef:	56                   	push   %esi
+  8024f0:	53                   	push   %ebx
+  8024f1:	83 ec 18             	sub    $0x18,%esp
+  8024f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024f7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024fa:	50                   	push   %eax
+  8024fb:	53                   	push   %ebx
+  8024fc:	e8 ac fb ff ff       	call   8020ad <fd_lookup>
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	85 c0                	test   %eax,%eax
+  802506:	78 34                	js     80253c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802508:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80250b:	83 ec 08             	sub    $0x8,%esp
+  80250e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802511:	50                   	push   %eax
+  802512:	ff 36                	push   (%esi)
+  802514:	e8 e4 fb ff ff       	call   8020fd <dev_lookup>
+  802519:	83 c4 10             	add    $0x10,%esp
+  80251c:	85 c0                	test   %eax,%eax
+  80251e:	78 1c                	js     80253c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802520:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802524:	74 1d                	je     802543 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802526:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802529:	8b 40 18             	mov    0x18(%eax),%eax
+  80252c:	85 c0                	test   %eax,%eax
+  80252e:	74 54                	je     802584 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802530:	83 ec 08             	sub    $0x8,%esp
+  802533:	ff 75 0c             	push   0xc(%ebp)
+  802536:	56                   	push   %esi
+  802537:	ff d0                	call   *%eax
+  802539:	83 c4 10             	add    $0x10,%esp
+}
+  80253c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80253f:	5b                   	pop    %ebx
+  802540:	5e                   	pop    %esi
+  802541:	5d                   	pop    %ebp
+  802542:	c3                   	ret
+  802543:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802545:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80254a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802550:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802555:	76 1c                	jbe    802573 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802557:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80255a:	83 ec 04             	sub    $0x4,%esp
+  80255d:	53                   	push   %ebx
+  80255e:	50                   	push   %eax
+  80255f:	68 30 3a 80 00       	push   $0x803a30
+  802564:	e8 09 de ff ff       	call   800372 <cprintf>
+		return -E_INVAL;
+  802569:	83 c4 10             	add    $0x10,%esp
+  80256c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802571:	eb c9                	jmp    80253c <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802573:	c1 e8 10             	shr    $0x10,%eax
+  802576:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80257c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802582:	eb d3                	jmp    802557 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802584:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802589:	eb b1                	jmp    80253c <ftruncate+0x50>
+
+0080258b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80258b:	55                   	push   %ebp
+  80258c:	89 e5                	mov    %esp,%ebp
+  80258e:	56                   	push   %esi
+  80258f:	53                   	push   %ebx
+  802590:	83 ec 18             	sub    $0x18,%esp
+  802593:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802596:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802599:	50                   	push   %eax
+  80259a:	ff 75 08             	push   0x8(%ebp)
+  80259d:	e8 0b fb ff ff       	call   8020ad <fd_lookup>
+  8025a2:	83 c4 10             	add    $0x10,%esp
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	78 49                	js     8025f2 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025ac:	83 ec 08             	sub    $0x8,%esp
+  8025af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b2:	50                   	push   %eax
+  8025b3:	ff 36                	push   (%esi)
+  8025b5:	e8 43 fb ff ff       	call   8020fd <dev_lookup>
+  8025ba:	83 c4 10             	add    $0x10,%esp
+  8025bd:	85 c0                	test   %eax,%eax
+  8025bf:	78 31                	js     8025f2 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8025c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025c4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8025c8:	74 2f                	je     8025f9 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8025ca:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8025cd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8025d4:	00 00 00 
+	stat->st_isdir = 0;
+  8025d7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025de:	00 00 00 
+	stat->st_dev = dev;
+  8025e1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8025e7:	83 ec 08             	sub    $0x8,%esp
+  8025ea:	53                   	push   %ebx
+  8025eb:	56                   	push   %esi
+  8025ec:	ff 50 14             	call   *0x14(%eax)
+  8025ef:	83 c4 10             	add    $0x10,%esp
+}
+  8025f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025f5:	5b                   	pop    %ebx
+  8025f6:	5e                   	pop    %esi
+  8025f7:	5d                   	pop    %ebp
+  8025f8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8025f9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025fe:	eb f2                	jmp    8025f2 <fstat+0x67>
+
+00802600 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802600:	55                   	push   %ebp
+  802601:	89 e5                	mov    %esp,%ebp
+  802603:	56                   	push   %esi
+  802604:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802605:	83 ec 08             	sub    $0x8,%esp
+  802608:	6a 00                	push   $0x0
+  80260a:	ff 75 08             	push   0x8(%ebp)
+  80260d:	e8 e4 01 00 00       	call   8027f6 <open>
+  802612:	89 c3                	mov    %eax,%ebx
+  802614:	83 c4 10             	add    $0x10,%esp
+  802617:	85 c0                	test   %eax,%eax
+  802619:	78 1b                	js     802636 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80261b:	83 ec 08             	sub    $0x8,%esp
+  80261e:	ff 75 0c             	push   0xc(%ebp)
+  802621:	50                   	push   %eax
+  802622:	e8 64 ff ff ff       	call   80258b <fstat>
+  802627:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802629:	89 1c 24             	mov    %ebx,(%esp)
+  80262c:	e8 c6 fb ff ff       	call   8021f7 <close>
+	return r;
+  802631:	83 c4 10             	add    $0x10,%esp
+  802634:	89 f3                	mov    %esi,%ebx
+}
+  802636:	89 d8                	mov    %ebx,%eax
+  802638:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80263b:	5b                   	pop    %ebx
+  80263c:	5e                   	pop    %esi
+  80263d:	5d                   	pop    %ebp
+  80263e:	c3                   	ret
+
+0080263f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80263f:	55                   	push   %ebp
+  802640:	89 e5                	mov    %esp,%ebp
+  802642:	56                   	push   %esi
+  802643:	53                   	push   %ebx
+  802644:	89 c6                	mov    %eax,%esi
+  802646:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802648:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80264f:	74 27                	je     802678 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802651:	6a 07                	push   $0x7
+  802653:	68 00 60 80 00       	push   $0x806000
+  802658:	56                   	push   %esi
+  802659:	ff 35 00 50 80 00    	push   0x805000
+  80265f:	e8 41 0d 00 00       	call   8033a5 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802664:	83 c4 0c             	add    $0xc,%esp
+  802667:	6a 00                	push   $0x0
+  802669:	53                   	push   %ebx
+  80266a:	6a 00                	push   $0x0
+  80266c:	e8 1c 0d 00 00       	call   80338d <ipc_recv>
+}
+  802671:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802674:	5b                   	pop    %ebx
+  802675:	5e                   	pop    %esi
+  802676:	5d                   	pop    %ebp
+  802677:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802678:	83 ec 0c             	sub    $0xc,%esp
+  80267b:	6a 01                	push   $0x1
+  80267d:	e8 77 0d 00 00       	call   8033f9 <ipc_find_env>
+  802682:	a3 00 50 80 00       	mov    %eax,0x805000
+  802687:	83 c4 10             	add    $0x10,%esp
+  80268a:	eb c5                	jmp    802651 <fsipc+0x12>
+
+0080268c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80268c:	55                   	push   %ebp
+  80268d:	89 e5                	mov    %esp,%ebp
+  80268f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802692:	8b 45 08             	mov    0x8(%ebp),%eax
+  802695:	8b 40 0c             	mov    0xc(%eax),%eax
+  802698:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  80269d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026a0:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8026a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026aa:	b8 02 00 00 00       	mov    $0x2,%eax
+  8026af:	e8 8b ff ff ff       	call   80263f <fsipc>
+}
+  8026b4:	c9                   	leave
+  8026b5:	c3                   	ret
+
+008026b6 <devfile_flush>:
+{
+  8026b6:	55                   	push   %ebp
+  8026b7:	89 e5                	mov    %esp,%ebp
+  8026b9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8026bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026c2:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8026c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026cc:	b8 06 00 00 00       	mov    $0x6,%eax
+  8026d1:	e8 69 ff ff ff       	call   80263f <fsipc>
+}
+  8026d6:	c9                   	leave
+  8026d7:	c3                   	ret
+
+008026d8 <devfile_stat>:
+{
+  8026d8:	55                   	push   %ebp
+  8026d9:	89 e5                	mov    %esp,%ebp
+  8026db:	53                   	push   %ebx
+  8026dc:	83 ec 04             	sub    $0x4,%esp
+  8026df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8026e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026e8:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8026ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026f7:	e8 43 ff ff ff       	call   80263f <fsipc>
+  8026fc:	85 c0                	test   %eax,%eax
+  8026fe:	78 2c                	js     80272c <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802700:	83 ec 08             	sub    $0x8,%esp
+  802703:	68 00 60 80 00       	push   $0x806000
+  802708:	53                   	push   %ebx
+  802709:	e8 ac e2 ff ff       	call   8009ba <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80270e:	a1 80 60 80 00       	mov    0x806080,%eax
+  802713:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802719:	a1 84 60 80 00       	mov    0x806084,%eax
+  80271e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802724:	83 c4 10             	add    $0x10,%esp
+  802727:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80272c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272f:	c9                   	leave
+  802730:	c3                   	ret
+
+00802731 <devfile_write>:
+{
+  802731:	55                   	push   %ebp
+  802732:	89 e5                	mov    %esp,%ebp
+  802734:	83 ec 0c             	sub    $0xc,%esp
+  802737:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80273a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80273d:	8b 52 0c             	mov    0xc(%edx),%edx
+  802740:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802746:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80274b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802750:	39 d0                	cmp    %edx,%eax
+  802752:	0f 47 c2             	cmova  %edx,%eax
+  802755:	50                   	push   %eax
+  802756:	ff 75 0c             	push   0xc(%ebp)
+  802759:	68 08 60 80 00       	push   $0x806008
+  80275e:	e8 dd e3 ff ff       	call   800b40 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802763:	ba 00 00 00 00       	mov    $0x0,%edx
+  802768:	b8 04 00 00 00       	mov    $0x4,%eax
+  80276d:	e8 cd fe ff ff       	call   80263f <fsipc>
+}
+  802772:	c9                   	leave
+  802773:	c3                   	ret
+
+00802774 <devfile_read>:
+{
+  802774:	55                   	push   %ebp
+  802775:	89 e5                	mov    %esp,%ebp
+  802777:	56                   	push   %esi
+  802778:	53                   	push   %ebx
+  802779:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80277c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802782:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  802787:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80278d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802792:	b8 03 00 00 00       	mov    $0x3,%eax
+  802797:	e8 a3 fe ff ff       	call   80263f <fsipc>
+  80279c:	89 c3                	mov    %eax,%ebx
+  80279e:	85 c0                	test   %eax,%eax
+  8027a0:	78 1f                	js     8027c1 <devfile_read+0x4d>
+	assert(r <= n);
+  8027a2:	39 c6                	cmp    %eax,%esi
+  8027a4:	72 24                	jb     8027ca <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8027a6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8027ab:	7f 33                	jg     8027e0 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8027ad:	83 ec 04             	sub    $0x4,%esp
+  8027b0:	50                   	push   %eax
+  8027b1:	68 00 60 80 00       	push   $0x806000
+  8027b6:	ff 75 0c             	push   0xc(%ebp)
+  8027b9:	e8 82 e3 ff ff       	call   800b40 <memmove>
+	return r;
+  8027be:	83 c4 10             	add    $0x10,%esp
+}
+  8027c1:	89 d8                	mov    %ebx,%eax
+  8027c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027c6:	5b                   	pop    %ebx
+  8027c7:	5e                   	pop    %esi
+  8027c8:	5d                   	pop    %ebp
+  8027c9:	c3                   	ret
+	assert(r <= n);
+  8027ca:	68 a0 3a 80 00       	push   $0x803aa0
+  8027cf:	68 90 39 80 00       	push   $0x803990
+  8027d4:	6a 76                	push   $0x76
+  8027d6:	68 a7 3a 80 00       	push   $0x803aa7
+  8027db:	e8 b7 da ff ff       	call   800297 <_panic>
+	assert(r <= PGSIZE);
+  8027e0:	68 b2 3a 80 00       	push   $0x803ab2
+  8027e5:	68 90 39 80 00       	push   $0x803990
+  8027ea:	6a 77                	push   $0x77
+  8027ec:	68 a7 3a 80 00       	push   $0x803aa7
+  8027f1:	e8 a1 da ff ff       	call   800297 <_panic>
+
+008027f6 <open>:
+{
+  8027f6:	55                   	push   %ebp
+  8027f7:	89 e5                	mov    %esp,%ebp
+  8027f9:	56                   	push   %esi
+  8027fa:	53                   	push   %ebx
+  8027fb:	83 ec 1c             	sub    $0x1c,%esp
+  8027fe:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802801:	56                   	push   %esi
+  802802:	e8 78 e1 ff ff       	call   80097f <strlen>
+  802807:	83 c4 10             	add    $0x10,%esp
+  80280a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80280f:	7f 6c                	jg     80287d <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802811:	83 ec 0c             	sub    $0xc,%esp
+  802814:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802817:	50                   	push   %eax
+  802818:	e8 3a f8 ff ff       	call   802057 <fd_alloc>
+  80281d:	89 c3                	mov    %eax,%ebx
+  80281f:	83 c4 10             	add    $0x10,%esp
+  802822:	85 c0                	test   %eax,%eax
+  802824:	78 3c                	js     802862 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802826:	83 ec 08             	sub    $0x8,%esp
+  802829:	56                   	push   %esi
+  80282a:	68 00 60 80 00       	push   $0x806000
+  80282f:	e8 86 e1 ff ff       	call   8009ba <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802834:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802837:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80283c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80283f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802844:	e8 f6 fd ff ff       	call   80263f <fsipc>
+  802849:	89 c3                	mov    %eax,%ebx
+  80284b:	83 c4 10             	add    $0x10,%esp
+  80284e:	85 c0                	test   %eax,%eax
+  802850:	78 19                	js     80286b <open+0x75>
+	return fd2num(fd);
+  802852:	83 ec 0c             	sub    $0xc,%esp
+  802855:	ff 75 f4             	push   -0xc(%ebp)
+  802858:	e8 d3 f7 ff ff       	call   802030 <fd2num>
+  80285d:	89 c3                	mov    %eax,%ebx
+  80285f:	83 c4 10             	add    $0x10,%esp
+}
+  802862:	89 d8                	mov    %ebx,%eax
+  802864:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802867:	5b                   	pop    %ebx
+  802868:	5e                   	pop    %esi
+  802869:	5d                   	pop    %ebp
+  80286a:	c3                   	ret
+		fd_close(fd, 0);
+  80286b:	83 ec 08             	sub    $0x8,%esp
+  80286e:	6a 00                	push   $0x0
+  802870:	ff 75 f4             	push   -0xc(%ebp)
+  802873:	e8 f8 f8 ff ff       	call   802170 <fd_close>
+		return r;
+  802878:	83 c4 10             	add    $0x10,%esp
+  80287b:	eb e5                	jmp    802862 <open+0x6c>
+		return -E_BAD_PATH;
+  80287d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802882:	eb de                	jmp    802862 <open+0x6c>
+
+00802884 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802884:	55                   	push   %ebp
+  802885:	89 e5                	mov    %esp,%ebp
+  802887:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80288a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80288f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802894:	e8 a6 fd ff ff       	call   80263f <fsipc>
+}
+  802899:	c9                   	leave
+  80289a:	c3                   	ret
+
+0080289b <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80289b:	55                   	push   %ebp
+  80289c:	89 e5                	mov    %esp,%ebp
+  80289e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8028a1:	68 be 3a 80 00       	push   $0x803abe
+  8028a6:	ff 75 0c             	push   0xc(%ebp)
+  8028a9:	e8 0c e1 ff ff       	call   8009ba <strcpy>
+	return 0;
+}
+  8028ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+
+008028b5 <devsock_close>:
+{
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	53                   	push   %ebx
+  8028b9:	83 ec 10             	sub    $0x10,%esp
+  8028bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8028bf:	53                   	push   %ebx
+  8028c0:	e8 73 0b 00 00       	call   803438 <pageref>
+  8028c5:	89 c2                	mov    %eax,%edx
+  8028c7:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8028ca:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8028cf:	83 fa 01             	cmp    $0x1,%edx
+  8028d2:	74 05                	je     8028d9 <devsock_close+0x24>
+}
+  8028d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d7:	c9                   	leave
+  8028d8:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8028d9:	83 ec 0c             	sub    $0xc,%esp
+  8028dc:	ff 73 0c             	push   0xc(%ebx)
+  8028df:	e8 b7 02 00 00       	call   802b9b <nsipc_close>
+  8028e4:	83 c4 10             	add    $0x10,%esp
+  8028e7:	eb eb                	jmp    8028d4 <devsock_close+0x1f>
+
+008028e9 <devsock_write>:
+{
+  8028e9:	55                   	push   %ebp
+  8028ea:	89 e5                	mov    %esp,%ebp
+  8028ec:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8028ef:	6a 00                	push   $0x0
+  8028f1:	ff 75 10             	push   0x10(%ebp)
+  8028f4:	ff 75 0c             	push   0xc(%ebp)
+  8028f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028fa:	ff 70 0c             	push   0xc(%eax)
+  8028fd:	e8 79 03 00 00       	call   802c7b <nsipc_send>
+}
+  802902:	c9                   	leave
+  802903:	c3                   	ret
+
+00802904 <devsock_read>:
+{
+  802904:	55                   	push   %ebp
+  802905:	89 e5                	mov    %esp,%ebp
+  802907:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80290a:	6a 00                	push   $0x0
+  80290c:	ff 75 10             	push   0x10(%ebp)
+  80290f:	ff 75 0c             	push   0xc(%ebp)
+  802912:	8b 45 08             	mov    0x8(%ebp),%eax
+  802915:	ff 70 0c             	push   0xc(%eax)
+  802918:	e8 ef 02 00 00       	call   802c0c <nsipc_recv>
+}
+  80291d:	c9                   	leave
+  80291e:	c3                   	ret
+
+0080291f <fd2sockid>:
+{
+  80291f:	55                   	push   %ebp
+  802920:	89 e5                	mov    %esp,%ebp
+  802922:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802925:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802928:	52                   	push   %edx
+  802929:	50                   	push   %eax
+  80292a:	e8 7e f7 ff ff       	call   8020ad <fd_lookup>
+  80292f:	83 c4 10             	add    $0x10,%esp
+  802932:	85 c0                	test   %eax,%eax
+  802934:	78 10                	js     802946 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802936:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802939:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80293f:	39 08                	cmp    %ecx,(%eax)
+  802941:	75 05                	jne    802948 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802943:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802946:	c9                   	leave
+  802947:	c3                   	ret
+		return -E_NOT_SUPP;
+  802948:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80294d:	eb f7                	jmp    802946 <fd2sockid+0x27>
+
+0080294f <alloc_sockfd>:
+{
+  80294f:	55                   	push   %ebp
+  802950:	89 e5                	mov    %esp,%ebp
+  802952:	56                   	push   %esi
+  802953:	53                   	push   %ebx
+  802954:	83 ec 1c             	sub    $0x1c,%esp
+  802957:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802959:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80295c:	50                   	push   %eax
+  80295d:	e8 f5 f6 ff ff       	call   802057 <fd_alloc>
+  802962:	89 c3                	mov    %eax,%ebx
+  802964:	83 c4 10             	add    $0x10,%esp
+  802967:	85 c0                	test   %eax,%eax
+  802969:	78 43                	js     8029ae <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80296b:	83 ec 04             	sub    $0x4,%esp
+  80296e:	68 07 04 00 00       	push   $0x407
+  802973:	ff 75 f4             	push   -0xc(%ebp)
+  802976:	6a 00                	push   $0x0
+  802978:	e8 35 e5 ff ff       	call   800eb2 <sys_page_alloc>
+  80297d:	89 c3                	mov    %eax,%ebx
+  80297f:	83 c4 10             	add    $0x10,%esp
+  802982:	85 c0                	test   %eax,%eax
+  802984:	78 28                	js     8029ae <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802986:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802989:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80298f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802991:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802994:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80299b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80299e:	83 ec 0c             	sub    $0xc,%esp
+  8029a1:	50                   	push   %eax
+  8029a2:	e8 89 f6 ff ff       	call   802030 <fd2num>
+  8029a7:	89 c3                	mov    %eax,%ebx
+  8029a9:	83 c4 10             	add    $0x10,%esp
+  8029ac:	eb 0c                	jmp    8029ba <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8029ae:	83 ec 0c             	sub    $0xc,%esp
+  8029b1:	56                   	push   %esi
+  8029b2:	e8 e4 01 00 00       	call   802b9b <nsipc_close>
+		return r;
+  8029b7:	83 c4 10             	add    $0x10,%esp
+}
+  8029ba:	89 d8                	mov    %ebx,%eax
+  8029bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029bf:	5b                   	pop    %ebx
+  8029c0:	5e                   	pop    %esi
+  8029c1:	5d                   	pop    %ebp
+  8029c2:	c3                   	ret
+
+008029c3 <accept>:
+{
+  8029c3:	55                   	push   %ebp
+  8029c4:	89 e5                	mov    %esp,%ebp
+  8029c6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029cc:	e8 4e ff ff ff       	call   80291f <fd2sockid>
+  8029d1:	85 c0                	test   %eax,%eax
+  8029d3:	78 1b                	js     8029f0 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8029d5:	83 ec 04             	sub    $0x4,%esp
+  8029d8:	ff 75 10             	push   0x10(%ebp)
+  8029db:	ff 75 0c             	push   0xc(%ebp)
+  8029de:	50                   	push   %eax
+  8029df:	e8 0e 01 00 00       	call   802af2 <nsipc_accept>
+  8029e4:	83 c4 10             	add    $0x10,%esp
+  8029e7:	85 c0                	test   %eax,%eax
+  8029e9:	78 05                	js     8029f0 <accept+0x2d>
+	return alloc_sockfd(r);
+  8029eb:	e8 5f ff ff ff       	call   80294f <alloc_sockfd>
+}
+  8029f0:	c9                   	leave
+  8029f1:	c3                   	ret
+
+008029f2 <bind>:
+{
+  8029f2:	55                   	push   %ebp
+  8029f3:	89 e5                	mov    %esp,%ebp
+  8029f5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029fb:	e8 1f ff ff ff       	call   80291f <fd2sockid>
+  802a00:	85 c0                	test   %eax,%eax
+  802a02:	78 12                	js     802a16 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802a04:	83 ec 04             	sub    $0x4,%esp
+  802a07:	ff 75 10             	push   0x10(%ebp)
+  802a0a:	ff 75 0c             	push   0xc(%ebp)
+  802a0d:	50                   	push   %eax
+  802a0e:	e8 31 01 00 00       	call   802b44 <nsipc_bind>
+  802a13:	83 c4 10             	add    $0x10,%esp
+}
+  802a16:	c9                   	leave
+  802a17:	c3                   	ret
+
+00802a18 <shutdown>:
+{
+  802a18:	55                   	push   %ebp
+  802a19:	89 e5                	mov    %esp,%ebp
+  802a1b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a21:	e8 f9 fe ff ff       	call   80291f <fd2sockid>
+  802a26:	85 c0                	test   %eax,%eax
+  802a28:	78 0f                	js     802a39 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802a2a:	83 ec 08             	sub    $0x8,%esp
+  802a2d:	ff 75 0c             	push   0xc(%ebp)
+  802a30:	50                   	push   %eax
+  802a31:	e8 43 01 00 00       	call   802b79 <nsipc_shutdown>
+  802a36:	83 c4 10             	add    $0x10,%esp
+}
+  802a39:	c9                   	leave
+  802a3a:	c3                   	ret
+
+00802a3b <connect>:
+{
+  802a3b:	55                   	push   %ebp
+  802a3c:	89 e5                	mov    %esp,%ebp
+  802a3e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a44:	e8 d6 fe ff ff       	call   80291f <fd2sockid>
+  802a49:	85 c0                	test   %eax,%eax
+  802a4b:	78 12                	js     802a5f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802a4d:	83 ec 04             	sub    $0x4,%esp
+  802a50:	ff 75 10             	push   0x10(%ebp)
+  802a53:	ff 75 0c             	push   0xc(%ebp)
+  802a56:	50                   	push   %eax
+  802a57:	e8 59 01 00 00       	call   802bb5 <nsipc_connect>
+  802a5c:	83 c4 10             	add    $0x10,%esp
+}
+  802a5f:	c9                   	leave
+  802a60:	c3                   	ret
+
+00802a61 <listen>:
+{
+  802a61:	55                   	push   %ebp
+  802a62:	89 e5                	mov    %esp,%ebp
+  802a64:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802a67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6a:	e8 b0 fe ff ff       	call   80291f <fd2sockid>
+  802a6f:	85 c0                	test   %eax,%eax
+  802a71:	78 0f                	js     802a82 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a73:	83 ec 08             	sub    $0x8,%esp
+  802a76:	ff 75 0c             	push   0xc(%ebp)
+  802a79:	50                   	push   %eax
+  802a7a:	e8 6b 01 00 00       	call   802bea <nsipc_listen>
+  802a7f:	83 c4 10             	add    $0x10,%esp
+}
+  802a82:	c9                   	leave
+  802a83:	c3                   	ret
+
+00802a84 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a84:	55                   	push   %ebp
+  802a85:	89 e5                	mov    %esp,%ebp
+  802a87:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a8a:	ff 75 10             	push   0x10(%ebp)
+  802a8d:	ff 75 0c             	push   0xc(%ebp)
+  802a90:	ff 75 08             	push   0x8(%ebp)
+  802a93:	e8 41 02 00 00       	call   802cd9 <nsipc_socket>
+  802a98:	83 c4 10             	add    $0x10,%esp
+  802a9b:	85 c0                	test   %eax,%eax
+  802a9d:	78 05                	js     802aa4 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a9f:	e8 ab fe ff ff       	call   80294f <alloc_sockfd>
+}
+  802aa4:	c9                   	leave
+  802aa5:	c3                   	ret
+
+00802aa6 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802aa6:	55                   	push   %ebp
+  802aa7:	89 e5                	mov    %esp,%ebp
+  802aa9:	53                   	push   %ebx
+  802aaa:	83 ec 04             	sub    $0x4,%esp
+  802aad:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802aaf:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802ab6:	74 26                	je     802ade <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802ab8:	6a 07                	push   $0x7
+  802aba:	68 00 70 80 00       	push   $0x807000
+  802abf:	53                   	push   %ebx
+  802ac0:	ff 35 04 50 80 00    	push   0x805004
+  802ac6:	e8 da 08 00 00       	call   8033a5 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802acb:	83 c4 0c             	add    $0xc,%esp
+  802ace:	6a 00                	push   $0x0
+  802ad0:	6a 00                	push   $0x0
+  802ad2:	6a 00                	push   $0x0
+  802ad4:	e8 b4 08 00 00       	call   80338d <ipc_recv>
+}
+  802ad9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802adc:	c9                   	leave
+  802add:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ade:	83 ec 0c             	sub    $0xc,%esp
+  802ae1:	6a 02                	push   $0x2
+  802ae3:	e8 11 09 00 00       	call   8033f9 <ipc_find_env>
+  802ae8:	a3 04 50 80 00       	mov    %eax,0x805004
+  802aed:	83 c4 10             	add    $0x10,%esp
+  802af0:	eb c6                	jmp    802ab8 <nsipc+0x12>
+
+00802af2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802af2:	55                   	push   %ebp
+  802af3:	89 e5                	mov    %esp,%ebp
+  802af5:	56                   	push   %esi
+  802af6:	53                   	push   %ebx
+  802af7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802afd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802b02:	8b 06                	mov    (%esi),%eax
+  802b04:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b09:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b0e:	e8 93 ff ff ff       	call   802aa6 <nsipc>
+  802b13:	89 c3                	mov    %eax,%ebx
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	79 09                	jns    802b22 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802b19:	89 d8                	mov    %ebx,%eax
+  802b1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b1e:	5b                   	pop    %ebx
+  802b1f:	5e                   	pop    %esi
+  802b20:	5d                   	pop    %ebp
+  802b21:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b22:	83 ec 04             	sub    $0x4,%esp
+  802b25:	ff 35 10 70 80 00    	push   0x807010
+  802b2b:	68 00 70 80 00       	push   $0x807000
+  802b30:	ff 75 0c             	push   0xc(%ebp)
+  802b33:	e8 08 e0 ff ff       	call   800b40 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b38:	a1 10 70 80 00       	mov    0x807010,%eax
+  802b3d:	89 06                	mov    %eax,(%esi)
+  802b3f:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b42:	eb d5                	jmp    802b19 <nsipc_accept+0x27>
+
+00802b44 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b44:	55                   	push   %ebp
+  802b45:	89 e5                	mov    %esp,%ebp
+  802b47:	53                   	push   %ebx
+  802b48:	83 ec 08             	sub    $0x8,%esp
+  802b4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b51:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802b56:	53                   	push   %ebx
+  802b57:	ff 75 0c             	push   0xc(%ebp)
+  802b5a:	68 04 70 80 00       	push   $0x807004
+  802b5f:	e8 dc df ff ff       	call   800b40 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b64:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802b6a:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b6f:	e8 32 ff ff ff       	call   802aa6 <nsipc>
+}
+  802b74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b77:	c9                   	leave
+  802b78:	c3                   	ret
+
+00802b79 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b79:	55                   	push   %ebp
+  802b7a:	89 e5                	mov    %esp,%ebp
+  802b7c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b82:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802b87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b8a:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b8f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b94:	e8 0d ff ff ff       	call   802aa6 <nsipc>
+}
+  802b99:	c9                   	leave
+  802b9a:	c3                   	ret
+
+00802b9b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b9b:	55                   	push   %ebp
+  802b9c:	89 e5                	mov    %esp,%ebp
+  802b9e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba4:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802ba9:	b8 04 00 00 00       	mov    $0x4,%eax
+  802bae:	e8 f3 fe ff ff       	call   802aa6 <nsipc>
+}
+  802bb3:	c9                   	leave
+  802bb4:	c3                   	ret
+
+00802bb5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802bb5:	55                   	push   %ebp
+  802bb6:	89 e5                	mov    %esp,%ebp
+  802bb8:	53                   	push   %ebx
+  802bb9:	83 ec 08             	sub    $0x8,%esp
+  802bbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802bbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc2:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802bc7:	53                   	push   %ebx
+  802bc8:	ff 75 0c             	push   0xc(%ebp)
+  802bcb:	68 04 70 80 00       	push   $0x807004
+  802bd0:	e8 6b df ff ff       	call   800b40 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802bd5:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802bdb:	b8 05 00 00 00       	mov    $0x5,%eax
+  802be0:	e8 c1 fe ff ff       	call   802aa6 <nsipc>
+}
+  802be5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+
+00802bea <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf3:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802bf8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bfb:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802c00:	b8 06 00 00 00       	mov    $0x6,%eax
+  802c05:	e8 9c fe ff ff       	call   802aa6 <nsipc>
+}
+  802c0a:	c9                   	leave
+  802c0b:	c3                   	ret
+
+00802c0c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802c0c:	55                   	push   %ebp
+  802c0d:	89 e5                	mov    %esp,%ebp
+  802c0f:	56                   	push   %esi
+  802c10:	53                   	push   %ebx
+  802c11:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802c14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c17:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802c1c:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802c22:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c25:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802c2a:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c2f:	e8 72 fe ff ff       	call   802aa6 <nsipc>
+  802c34:	89 c3                	mov    %eax,%ebx
+  802c36:	85 c0                	test   %eax,%eax
+  802c38:	78 22                	js     802c5c <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c3a:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c3f:	39 c6                	cmp    %eax,%esi
+  802c41:	0f 4e c6             	cmovle %esi,%eax
+  802c44:	39 c3                	cmp    %eax,%ebx
+  802c46:	7f 1d                	jg     802c65 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c48:	83 ec 04             	sub    $0x4,%esp
+  802c4b:	53                   	push   %ebx
+  802c4c:	68 00 70 80 00       	push   $0x807000
+  802c51:	ff 75 0c             	push   0xc(%ebp)
+  802c54:	e8 e7 de ff ff       	call   800b40 <memmove>
+  802c59:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c5c:	89 d8                	mov    %ebx,%eax
+  802c5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c61:	5b                   	pop    %ebx
+  802c62:	5e                   	pop    %esi
+  802c63:	5d                   	pop    %ebp
+  802c64:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c65:	68 ca 3a 80 00       	push   $0x803aca
+  802c6a:	68 90 39 80 00       	push   $0x803990
+  802c6f:	6a 62                	push   $0x62
+  802c71:	68 df 3a 80 00       	push   $0x803adf
+  802c76:	e8 1c d6 ff ff       	call   800297 <_panic>
+
+00802c7b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c7b:	55                   	push   %ebp
+  802c7c:	89 e5                	mov    %esp,%ebp
+  802c7e:	53                   	push   %ebx
+  802c7f:	83 ec 04             	sub    $0x4,%esp
+  802c82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c85:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c88:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802c8d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c93:	7f 2e                	jg     802cc3 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c95:	83 ec 04             	sub    $0x4,%esp
+  802c98:	53                   	push   %ebx
+  802c99:	ff 75 0c             	push   0xc(%ebp)
+  802c9c:	68 0c 70 80 00       	push   $0x80700c
+  802ca1:	e8 9a de ff ff       	call   800b40 <memmove>
+	nsipcbuf.send.req_size = size;
+  802ca6:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802cac:	8b 45 14             	mov    0x14(%ebp),%eax
+  802caf:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802cb4:	b8 08 00 00 00       	mov    $0x8,%eax
+  802cb9:	e8 e8 fd ff ff       	call   802aa6 <nsipc>
+}
+  802cbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cc1:	c9                   	leave
+  802cc2:	c3                   	ret
+	assert(size < 1600);
+  802cc3:	68 eb 3a 80 00       	push   $0x803aeb
+  802cc8:	68 90 39 80 00       	push   $0x803990
+  802ccd:	6a 6d                	push   $0x6d
+  802ccf:	68 df 3a 80 00       	push   $0x803adf
+  802cd4:	e8 be d5 ff ff       	call   800297 <_panic>
+
+00802cd9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802cd9:	55                   	push   %ebp
+  802cda:	89 e5                	mov    %esp,%ebp
+  802cdc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802cdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce2:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802ce7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cea:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802cef:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cf2:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802cf7:	b8 09 00 00 00       	mov    $0x9,%eax
+  802cfc:	e8 a5 fd ff ff       	call   802aa6 <nsipc>
+}
+  802d01:	c9                   	leave
+  802d02:	c3                   	ret
+
+00802d03 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802d03:	55                   	push   %ebp
+  802d04:	89 e5                	mov    %esp,%ebp
+  802d06:	56                   	push   %esi
+  802d07:	53                   	push   %ebx
+  802d08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802d0b:	83 ec 0c             	sub    $0xc,%esp
+  802d0e:	ff 75 08             	push   0x8(%ebp)
+  802d11:	e8 2a f3 ff ff       	call   802040 <fd2data>
+  802d16:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802d18:	83 c4 08             	add    $0x8,%esp
+  802d1b:	68 f7 3a 80 00       	push   $0x803af7
+  802d20:	53                   	push   %ebx
+  802d21:	e8 94 dc ff ff       	call   8009ba <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802d26:	8b 46 04             	mov    0x4(%esi),%eax
+  802d29:	2b 06                	sub    (%esi),%eax
+  802d2b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802d31:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802d38:	00 00 00 
+	stat->st_dev = &devpipe;
+  802d3b:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802d42:	40 80 00 
+	return 0;
+}
+  802d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d4d:	5b                   	pop    %ebx
+  802d4e:	5e                   	pop    %esi
+  802d4f:	5d                   	pop    %ebp
+  802d50:	c3                   	ret
+
+00802d51 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802d51:	55                   	push   %ebp
+  802d52:	89 e5                	mov    %esp,%ebp
+  802d54:	53                   	push   %ebx
+  802d55:	83 ec 0c             	sub    $0xc,%esp
+  802d58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802d5b:	53                   	push   %ebx
+  802d5c:	6a 00                	push   $0x0
+  802d5e:	e8 2a e2 ff ff       	call   800f8d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d63:	89 1c 24             	mov    %ebx,(%esp)
+  802d66:	e8 d5 f2 ff ff       	call   802040 <fd2data>
+  802d6b:	83 c4 08             	add    $0x8,%esp
+  802d6e:	50                   	push   %eax
+  802d6f:	6a 00                	push   $0x0
+  802d71:	e8 17 e2 ff ff       	call   800f8d <sys_page_unmap>
+}
+  802d76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d79:	c9                   	leave
+  802d7a:	c3                   	ret
+
+00802d7b <_pipeisclosed>:
+{
+  802d7b:	55                   	push   %ebp
+  802d7c:	89 e5                	mov    %esp,%ebp
+  802d7e:	57                   	push   %edi
+  802d7f:	56                   	push   %esi
+  802d80:	53                   	push   %ebx
+  802d81:	83 ec 1c             	sub    $0x1c,%esp
+  802d84:	89 c7                	mov    %eax,%edi
+  802d86:	89 d6                	mov    %edx,%esi
+  802d88:	eb 3c                	jmp    802dc6 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802d8a:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802d8d:	83 ec 0c             	sub    $0xc,%esp
+  802d90:	57                   	push   %edi
+  802d91:	e8 a2 06 00 00       	call   803438 <pageref>
+  802d96:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d99:	89 34 24             	mov    %esi,(%esp)
+  802d9c:	e8 97 06 00 00       	call   803438 <pageref>
+  802da1:	89 c2                	mov    %eax,%edx
+  802da3:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802da5:	05 00 00 00 20       	add    $0x20000000,%eax
+  802daa:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802dad:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802db3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802db8:	76 31                	jbe    802deb <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802dba:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802dbd:	39 c3                	cmp    %eax,%ebx
+  802dbf:	74 76                	je     802e37 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802dc1:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802dc4:	74 36                	je     802dfc <_pipeisclosed+0x81>
+  802dc6:	89 e0                	mov    %esp,%eax
+  802dc8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802dcd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802dd3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802dd8:	77 b0                	ja     802d8a <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802dda:	c1 e8 10             	shr    $0x10,%eax
+  802ddd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802de3:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802de9:	eb 9f                	jmp    802d8a <_pipeisclosed+0xf>
+  802deb:	c1 e8 10             	shr    $0x10,%eax
+  802dee:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802df4:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802dfa:	eb be                	jmp    802dba <_pipeisclosed+0x3f>
+  802dfc:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802dfe:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802e03:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802e09:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802e0e:	76 16                	jbe    802e26 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802e10:	8b 42 58             	mov    0x58(%edx),%eax
+  802e13:	6a 01                	push   $0x1
+  802e15:	50                   	push   %eax
+  802e16:	53                   	push   %ebx
+  802e17:	68 fe 3a 80 00       	push   $0x803afe
+  802e1c:	e8 51 d5 ff ff       	call   800372 <cprintf>
+  802e21:	83 c4 10             	add    $0x10,%esp
+  802e24:	eb a0                	jmp    802dc6 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802e26:	c1 e8 10             	shr    $0x10,%eax
+  802e29:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e2f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802e35:	eb d9                	jmp    802e10 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802e37:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802e3a:	0f 94 c0             	sete   %al
+  802e3d:	0f b6 c0             	movzbl %al,%eax
+}
+  802e40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e43:	5b                   	pop    %ebx
+  802e44:	5e                   	pop    %esi
+  802e45:	5f                   	pop    %edi
+  802e46:	5d                   	pop    %ebp
+  802e47:	c3                   	ret
+
+00802e48 <devpipe_write>:
+{
+  802e48:	55                   	push   %ebp
+  802e49:	89 e5                	mov    %esp,%ebp
+  802e4b:	57                   	push   %edi
+  802e4c:	56                   	push   %esi
+  802e4d:	53                   	push   %ebx
+  802e4e:	83 ec 28             	sub    $0x28,%esp
+  802e51:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802e54:	56                   	push   %esi
+  802e55:	e8 e6 f1 ff ff       	call   802040 <fd2data>
+  802e5a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802e5c:	83 c4 10             	add    $0x10,%esp
+  802e5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e64:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802e67:	75 09                	jne    802e72 <devpipe_write+0x2a>
+	return i;
+  802e69:	89 f8                	mov    %edi,%eax
+  802e6b:	eb 23                	jmp    802e90 <devpipe_write+0x48>
+			sys_yield();
+  802e6d:	e8 fa df ff ff       	call   800e6c <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802e72:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e75:	8b 0b                	mov    (%ebx),%ecx
+  802e77:	8d 51 20             	lea    0x20(%ecx),%edx
+  802e7a:	39 d0                	cmp    %edx,%eax
+  802e7c:	72 1a                	jb     802e98 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802e7e:	89 da                	mov    %ebx,%edx
+  802e80:	89 f0                	mov    %esi,%eax
+  802e82:	e8 f4 fe ff ff       	call   802d7b <_pipeisclosed>
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	74 e2                	je     802e6d <devpipe_write+0x25>
+				return 0;
+  802e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e93:	5b                   	pop    %ebx
+  802e94:	5e                   	pop    %esi
+  802e95:	5f                   	pop    %edi
+  802e96:	5d                   	pop    %ebp
+  802e97:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e9b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802e9f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802ea2:	89 c2                	mov    %eax,%edx
+  802ea4:	c1 fa 1f             	sar    $0x1f,%edx
+  802ea7:	89 d1                	mov    %edx,%ecx
+  802ea9:	c1 e9 1b             	shr    $0x1b,%ecx
+  802eac:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802eaf:	83 e2 1f             	and    $0x1f,%edx
+  802eb2:	29 ca                	sub    %ecx,%edx
+  802eb4:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802eb8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802ebc:	83 c0 01             	add    $0x1,%eax
+  802ebf:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802ec2:	83 c7 01             	add    $0x1,%edi
+  802ec5:	eb 9d                	jmp    802e64 <devpipe_write+0x1c>
+
+00802ec7 <devpipe_read>:
+{
+  802ec7:	55                   	push   %ebp
+  802ec8:	89 e5                	mov    %esp,%ebp
+  802eca:	57                   	push   %edi
+  802ecb:	56                   	push   %esi
+  802ecc:	53                   	push   %ebx
+  802ecd:	83 ec 18             	sub    $0x18,%esp
+  802ed0:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802ed3:	57                   	push   %edi
+  802ed4:	e8 67 f1 ff ff       	call   802040 <fd2data>
+  802ed9:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802edb:	83 c4 10             	add    $0x10,%esp
+  802ede:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ee6:	75 13                	jne    802efb <devpipe_read+0x34>
+	return i;
+  802ee8:	89 f0                	mov    %esi,%eax
+  802eea:	eb 02                	jmp    802eee <devpipe_read+0x27>
+				return i;
+  802eec:	89 f0                	mov    %esi,%eax
+}
+  802eee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef1:	5b                   	pop    %ebx
+  802ef2:	5e                   	pop    %esi
+  802ef3:	5f                   	pop    %edi
+  802ef4:	5d                   	pop    %ebp
+  802ef5:	c3                   	ret
+			sys_yield();
+  802ef6:	e8 71 df ff ff       	call   800e6c <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802efb:	8b 03                	mov    (%ebx),%eax
+  802efd:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f00:	75 18                	jne    802f1a <devpipe_read+0x53>
+			if (i > 0)
+  802f02:	85 f6                	test   %esi,%esi
+  802f04:	75 e6                	jne    802eec <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802f06:	89 da                	mov    %ebx,%edx
+  802f08:	89 f8                	mov    %edi,%eax
+  802f0a:	e8 6c fe ff ff       	call   802d7b <_pipeisclosed>
+  802f0f:	85 c0                	test   %eax,%eax
+  802f11:	74 e3                	je     802ef6 <devpipe_read+0x2f>
+				return 0;
+  802f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f18:	eb d4                	jmp    802eee <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f1a:	99                   	cltd
+  802f1b:	c1 ea 1b             	shr    $0x1b,%edx
+  802f1e:	01 d0                	add    %edx,%eax
+  802f20:	83 e0 1f             	and    $0x1f,%eax
+  802f23:	29 d0                	sub    %edx,%eax
+  802f25:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802f2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f2d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802f30:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802f33:	83 c6 01             	add    $0x1,%esi
+  802f36:	eb ab                	jmp    802ee3 <devpipe_read+0x1c>
+
+00802f38 <pipe>:
+{
+  802f38:	55                   	push   %ebp
+  802f39:	89 e5                	mov    %esp,%ebp
+  802f3b:	56                   	push   %esi
+  802f3c:	53                   	push   %ebx
+  802f3d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802f40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f43:	50                   	push   %eax
+  802f44:	e8 0e f1 ff ff       	call   802057 <fd_alloc>
+  802f49:	89 c3                	mov    %eax,%ebx
+  802f4b:	83 c4 10             	add    $0x10,%esp
+  802f4e:	85 c0                	test   %eax,%eax
+  802f50:	0f 88 23 01 00 00    	js     803079 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f56:	83 ec 04             	sub    $0x4,%esp
+  802f59:	68 07 04 00 00       	push   $0x407
+  802f5e:	ff 75 f4             	push   -0xc(%ebp)
+  802f61:	6a 00                	push   $0x0
+  802f63:	e8 4a df ff ff       	call   800eb2 <sys_page_alloc>
+  802f68:	89 c3                	mov    %eax,%ebx
+  802f6a:	83 c4 10             	add    $0x10,%esp
+  802f6d:	85 c0                	test   %eax,%eax
+  802f6f:	0f 88 04 01 00 00    	js     803079 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802f75:	83 ec 0c             	sub    $0xc,%esp
+  802f78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802f7b:	50                   	push   %eax
+  802f7c:	e8 d6 f0 ff ff       	call   802057 <fd_alloc>
+  802f81:	89 c3                	mov    %eax,%ebx
+  802f83:	83 c4 10             	add    $0x10,%esp
+  802f86:	85 c0                	test   %eax,%eax
+  802f88:	0f 88 db 00 00 00    	js     803069 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f8e:	83 ec 04             	sub    $0x4,%esp
+  802f91:	68 07 04 00 00       	push   $0x407
+  802f96:	ff 75 f0             	push   -0x10(%ebp)
+  802f99:	6a 00                	push   $0x0
+  802f9b:	e8 12 df ff ff       	call   800eb2 <sys_page_alloc>
+  802fa0:	89 c3                	mov    %eax,%ebx
+  802fa2:	83 c4 10             	add    $0x10,%esp
+  802fa5:	85 c0                	test   %eax,%eax
+  802fa7:	0f 88 bc 00 00 00    	js     803069 <pipe+0x131>
+	va = fd2data(fd0);
+  802fad:	83 ec 0c             	sub    $0xc,%esp
+  802fb0:	ff 75 f4             	push   -0xc(%ebp)
+  802fb3:	e8 88 f0 ff ff       	call   802040 <fd2data>
+  802fb8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fba:	83 c4 0c             	add    $0xc,%esp
+  802fbd:	68 07 04 00 00       	push   $0x407
+  802fc2:	50                   	push   %eax
+  802fc3:	6a 00                	push   $0x0
+  802fc5:	e8 e8 de ff ff       	call   800eb2 <sys_page_alloc>
+  802fca:	89 c3                	mov    %eax,%ebx
+  802fcc:	83 c4 10             	add    $0x10,%esp
+  802fcf:	85 c0                	test   %eax,%eax
+  802fd1:	0f 88 82 00 00 00    	js     803059 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fd7:	83 ec 0c             	sub    $0xc,%esp
+  802fda:	ff 75 f0             	push   -0x10(%ebp)
+  802fdd:	e8 5e f0 ff ff       	call   802040 <fd2data>
+  802fe2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802fe9:	50                   	push   %eax
+  802fea:	6a 00                	push   $0x0
+  802fec:	56                   	push   %esi
+  802fed:	6a 00                	push   $0x0
+  802fef:	e8 2b df ff ff       	call   800f1f <sys_page_map>
+  802ff4:	89 c3                	mov    %eax,%ebx
+  802ff6:	83 c4 20             	add    $0x20,%esp
+  802ff9:	85 c0                	test   %eax,%eax
+  802ffb:	78 4e                	js     80304b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802ffd:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  803002:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803005:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803007:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80300a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803011:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803014:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803016:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803019:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803020:	83 ec 0c             	sub    $0xc,%esp
+  803023:	ff 75 f4             	push   -0xc(%ebp)
+  803026:	e8 05 f0 ff ff       	call   802030 <fd2num>
+  80302b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80302e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803030:	83 c4 04             	add    $0x4,%esp
+  803033:	ff 75 f0             	push   -0x10(%ebp)
+  803036:	e8 f5 ef ff ff       	call   802030 <fd2num>
+  80303b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80303e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803041:	83 c4 10             	add    $0x10,%esp
+  803044:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803049:	eb 2e                	jmp    803079 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80304b:	83 ec 08             	sub    $0x8,%esp
+  80304e:	56                   	push   %esi
+  80304f:	6a 00                	push   $0x0
+  803051:	e8 37 df ff ff       	call   800f8d <sys_page_unmap>
+  803056:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803059:	83 ec 08             	sub    $0x8,%esp
+  80305c:	ff 75 f0             	push   -0x10(%ebp)
+  80305f:	6a 00                	push   $0x0
+  803061:	e8 27 df ff ff       	call   800f8d <sys_page_unmap>
+  803066:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803069:	83 ec 08             	sub    $0x8,%esp
+  80306c:	ff 75 f4             	push   -0xc(%ebp)
+  80306f:	6a 00                	push   $0x0
+  803071:	e8 17 df ff ff       	call   800f8d <sys_page_unmap>
+  803076:	83 c4 10             	add    $0x10,%esp
+}
+  803079:	89 d8                	mov    %ebx,%eax
+  80307b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80307e:	5b                   	pop    %ebx
+  80307f:	5e                   	pop    %esi
+  803080:	5d                   	pop    %ebp
+  803081:	c3                   	ret
+
+00803082 <pipeisclosed>:
+{
+  803082:	55                   	push   %ebp
+  803083:	89 e5                	mov    %esp,%ebp
+  803085:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803088:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80308b:	50                   	push   %eax
+  80308c:	ff 75 08             	push   0x8(%ebp)
+  80308f:	e8 19 f0 ff ff       	call   8020ad <fd_lookup>
+  803094:	83 c4 10             	add    $0x10,%esp
+  803097:	85 c0                	test   %eax,%eax
+  803099:	78 18                	js     8030b3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80309b:	83 ec 0c             	sub    $0xc,%esp
+  80309e:	ff 75 f4             	push   -0xc(%ebp)
+  8030a1:	e8 9a ef ff ff       	call   802040 <fd2data>
+  8030a6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8030a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030ab:	e8 cb fc ff ff       	call   802d7b <_pipeisclosed>
+  8030b0:	83 c4 10             	add    $0x10,%esp
+}
+  8030b3:	c9                   	leave
+  8030b4:	c3                   	ret
+
+008030b5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8030b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ba:	c3                   	ret
+
+008030bb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8030bb:	55                   	push   %ebp
+  8030bc:	89 e5                	mov    %esp,%ebp
+  8030be:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8030c1:	68 16 3b 80 00       	push   $0x803b16
+  8030c6:	ff 75 0c             	push   0xc(%ebp)
+  8030c9:	e8 ec d8 ff ff       	call   8009ba <strcpy>
+	return 0;
+}
+  8030ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d3:	c9                   	leave
+  8030d4:	c3                   	ret
+
+008030d5 <devcons_write>:
+{
+  8030d5:	55                   	push   %ebp
+  8030d6:	89 e5                	mov    %esp,%ebp
+  8030d8:	57                   	push   %edi
+  8030d9:	56                   	push   %esi
+  8030da:	53                   	push   %ebx
+  8030db:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8030e1:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8030e6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8030ec:	eb 2e                	jmp    80311c <devcons_write+0x47>
+		m = n - tot;
+  8030ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030f1:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8030f3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8030f8:	39 c3                	cmp    %eax,%ebx
+  8030fa:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8030fd:	83 ec 04             	sub    $0x4,%esp
+  803100:	53                   	push   %ebx
+  803101:	89 f0                	mov    %esi,%eax
+  803103:	03 45 0c             	add    0xc(%ebp),%eax
+  803106:	50                   	push   %eax
+  803107:	57                   	push   %edi
+  803108:	e8 33 da ff ff       	call   800b40 <memmove>
+		sys_cputs(buf, m);
+  80310d:	83 c4 08             	add    $0x8,%esp
+  803110:	53                   	push   %ebx
+  803111:	57                   	push   %edi
+  803112:	e8 1c dc ff ff       	call   800d33 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803117:	01 de                	add    %ebx,%esi
+  803119:	83 c4 10             	add    $0x10,%esp
+  80311c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80311f:	72 cd                	jb     8030ee <devcons_write+0x19>
+}
+  803121:	89 f0                	mov    %esi,%eax
+  803123:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803126:	5b                   	pop    %ebx
+  803127:	5e                   	pop    %esi
+  803128:	5f                   	pop    %edi
+  803129:	5d                   	pop    %ebp
+  80312a:	c3                   	ret
+
+0080312b <devcons_read>:
+{
+  80312b:	55                   	push   %ebp
+  80312c:	89 e5                	mov    %esp,%ebp
+  80312e:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803131:	b8 00 00 00 00       	mov    $0x0,%eax
+  803136:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80313a:	75 07                	jne    803143 <devcons_read+0x18>
+  80313c:	eb 1f                	jmp    80315d <devcons_read+0x32>
+		sys_yield();
+  80313e:	e8 29 dd ff ff       	call   800e6c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803143:	e8 2f dc ff ff       	call   800d77 <sys_cgetc>
+  803148:	85 c0                	test   %eax,%eax
+  80314a:	74 f2                	je     80313e <devcons_read+0x13>
+	if (c < 0)
+  80314c:	78 0f                	js     80315d <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80314e:	83 f8 04             	cmp    $0x4,%eax
+  803151:	74 0c                	je     80315f <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803153:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803156:	88 02                	mov    %al,(%edx)
+	return 1;
+  803158:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80315d:	c9                   	leave
+  80315e:	c3                   	ret
+		return 0;
+  80315f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803164:	eb f7                	jmp    80315d <devcons_read+0x32>
+
+00803166 <cputchar>:
+{
+  803166:	55                   	push   %ebp
+  803167:	89 e5                	mov    %esp,%ebp
+  803169:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80316c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80316f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803172:	6a 01                	push   $0x1
+  803174:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803177:	50                   	push   %eax
+  803178:	e8 b6 db ff ff       	call   800d33 <sys_cputs>
+}
+  80317d:	83 c4 10             	add    $0x10,%esp
+  803180:	c9                   	leave
+  803181:	c3                   	ret
+
+00803182 <getchar>:
+{
+  803182:	55                   	push   %ebp
+  803183:	89 e5                	mov    %esp,%ebp
+  803185:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803188:	6a 01                	push   $0x1
+  80318a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80318d:	50                   	push   %eax
+  80318e:	6a 00                	push   $0x0
+  803190:	e8 9e f1 ff ff       	call   802333 <read>
+	if (r < 0)
+  803195:	83 c4 10             	add    $0x10,%esp
+  803198:	85 c0                	test   %eax,%eax
+  80319a:	78 06                	js     8031a2 <getchar+0x20>
+	if (r < 1)
+  80319c:	74 06                	je     8031a4 <getchar+0x22>
+	return c;
+  80319e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8031a2:	c9                   	leave
+  8031a3:	c3                   	ret
+		return -E_EOF;
+  8031a4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8031a9:	eb f7                	jmp    8031a2 <getchar+0x20>
+
+008031ab <iscons>:
+{
+  8031ab:	55                   	push   %ebp
+  8031ac:	89 e5                	mov    %esp,%ebp
+  8031ae:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031b4:	50                   	push   %eax
+  8031b5:	ff 75 08             	push   0x8(%ebp)
+  8031b8:	e8 f0 ee ff ff       	call   8020ad <fd_lookup>
+  8031bd:	83 c4 10             	add    $0x10,%esp
+  8031c0:	85 c0                	test   %eax,%eax
+  8031c2:	78 11                	js     8031d5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8031c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031c7:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8031cd:	39 10                	cmp    %edx,(%eax)
+  8031cf:	0f 94 c0             	sete   %al
+  8031d2:	0f b6 c0             	movzbl %al,%eax
+}
+  8031d5:	c9                   	leave
+  8031d6:	c3                   	ret
+
+008031d7 <opencons>:
+{
+  8031d7:	55                   	push   %ebp
+  8031d8:	89 e5                	mov    %esp,%ebp
+  8031da:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8031dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031e0:	50                   	push   %eax
+  8031e1:	e8 71 ee ff ff       	call   802057 <fd_alloc>
+  8031e6:	83 c4 10             	add    $0x10,%esp
+  8031e9:	85 c0                	test   %eax,%eax
+  8031eb:	78 3a                	js     803227 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8031ed:	83 ec 04             	sub    $0x4,%esp
+  8031f0:	68 07 04 00 00       	push   $0x407
+  8031f5:	ff 75 f4             	push   -0xc(%ebp)
+  8031f8:	6a 00                	push   $0x0
+  8031fa:	e8 b3 dc ff ff       	call   800eb2 <sys_page_alloc>
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	85 c0                	test   %eax,%eax
+  803204:	78 21                	js     803227 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803206:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803209:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  80320f:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803211:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803214:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80321b:	83 ec 0c             	sub    $0xc,%esp
+  80321e:	50                   	push   %eax
+  80321f:	e8 0c ee ff ff       	call   802030 <fd2num>
+  803224:	83 c4 10             	add    $0x10,%esp
+}
+  803227:	c9                   	leave
+  803228:	c3                   	ret
+
+00803229 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803229:	55                   	push   %ebp
+  80322a:	89 e5                	mov    %esp,%ebp
+  80322c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  80322f:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803236:	74 0a                	je     803242 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803238:	8b 45 08             	mov    0x8(%ebp),%eax
+  80323b:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803240:	c9                   	leave
+  803241:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803242:	83 ec 04             	sub    $0x4,%esp
+  803245:	6a 07                	push   $0x7
+  803247:	68 00 f0 bf ee       	push   $0xeebff000
+  80324c:	6a 00                	push   $0x0
+  80324e:	e8 5f dc ff ff       	call   800eb2 <sys_page_alloc>
+  803253:	83 c4 10             	add    $0x10,%esp
+  803256:	85 c0                	test   %eax,%eax
+  803258:	78 14                	js     80326e <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80325a:	83 ec 08             	sub    $0x8,%esp
+  80325d:	68 90 32 80 00       	push   $0x803290
+  803262:	6a 00                	push   $0x0
+  803264:	e8 65 de ff ff       	call   8010ce <sys_env_set_pgfault_upcall>
+  803269:	83 c4 10             	add    $0x10,%esp
+  80326c:	eb ca                	jmp    803238 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  80326e:	83 ec 08             	sub    $0x8,%esp
+  803271:	50                   	push   %eax
+  803272:	68 22 3b 80 00       	push   $0x803b22
+  803277:	e8 f6 d0 ff ff       	call   800372 <cprintf>
+			panic("set_pgfault_handler error");
+  80327c:	83 c4 0c             	add    $0xc,%esp
+  80327f:	68 2d 3b 80 00       	push   $0x803b2d
+  803284:	6a 24                	push   $0x24
+  803286:	68 47 3b 80 00       	push   $0x803b47
+  80328b:	e8 07 d0 ff ff       	call   800297 <_panic>
+
+00803290 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803290:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803291:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803296:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803298:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  80329b:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80329f:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  8032a2:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  8032a6:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  8032a8:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  8032ac:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  8032ad:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  8032b1:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  8032b2:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  8032b3:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8032b7:	c3                   	ret
+
+008032b8 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  8032b8:	55                   	push   %ebp
+  8032b9:	89 e5                	mov    %esp,%ebp
+  8032bb:	56                   	push   %esi
+  8032bc:	53                   	push   %ebx
+  8032bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8032c6:	85 c0                	test   %eax,%eax
+  8032c8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8032cd:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  8032d0:	83 ec 08             	sub    $0x8,%esp
+  8032d3:	ff 75 14             	push   0x14(%ebp)
+  8032d6:	50                   	push   %eax
+  8032d7:	e8 e7 df ff ff       	call   8012c3 <sys_ipc_recv_until>
+  8032dc:	83 c4 10             	add    $0x10,%esp
+  8032df:	85 c0                	test   %eax,%eax
+  8032e1:	78 61                	js     803344 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  8032e3:	85 f6                	test   %esi,%esi
+  8032e5:	74 1c                	je     803303 <ipc_recv_until+0x4b>
+  8032e7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8032e9:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8032ee:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8032f4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8032f9:	76 5f                	jbe    80335a <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  8032fb:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803301:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803303:	85 db                	test   %ebx,%ebx
+  803305:	74 1c                	je     803323 <ipc_recv_until+0x6b>
+  803307:	89 e0                	mov    %esp,%eax
+  803309:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80330e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803314:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803319:	76 50                	jbe    80336b <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  80331b:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803321:	89 03                	mov    %eax,(%ebx)
+  803323:	89 e0                	mov    %esp,%eax
+  803325:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80332a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803330:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803335:	76 45                	jbe    80337c <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803337:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  80333d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803340:	5b                   	pop    %ebx
+  803341:	5e                   	pop    %esi
+  803342:	5d                   	pop    %ebp
+  803343:	c3                   	ret
+		if (from_env_store)
+  803344:	85 f6                	test   %esi,%esi
+  803346:	74 06                	je     80334e <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803348:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  80334e:	85 db                	test   %ebx,%ebx
+  803350:	74 eb                	je     80333d <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803352:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803358:	eb e3                	jmp    80333d <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80335a:	c1 e8 10             	shr    $0x10,%eax
+  80335d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803363:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803369:	eb 90                	jmp    8032fb <ipc_recv_until+0x43>
+  80336b:	c1 e8 10             	shr    $0x10,%eax
+  80336e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803374:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80337a:	eb 9f                	jmp    80331b <ipc_recv_until+0x63>
+  80337c:	c1 e8 10             	shr    $0x10,%eax
+  80337f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803385:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80338b:	eb aa                	jmp    803337 <ipc_recv_until+0x7f>
+
+0080338d <ipc_recv>:
+{
+  80338d:	55                   	push   %ebp
+  80338e:	89 e5                	mov    %esp,%ebp
+  803390:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803393:	6a 00                	push   $0x0
+  803395:	ff 75 10             	push   0x10(%ebp)
+  803398:	ff 75 0c             	push   0xc(%ebp)
+  80339b:	ff 75 08             	push   0x8(%ebp)
+  80339e:	e8 15 ff ff ff       	call   8032b8 <ipc_recv_until>
+}
+  8033a3:	c9                   	leave
+  8033a4:	c3                   	ret
+
+008033a5 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8033a5:	55                   	push   %ebp
+  8033a6:	89 e5                	mov    %esp,%ebp
+  8033a8:	57                   	push   %edi
+  8033a9:	56                   	push   %esi
+  8033aa:	53                   	push   %ebx
+  8033ab:	83 ec 0c             	sub    $0xc,%esp
+  8033ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  8033b7:	85 db                	test   %ebx,%ebx
+  8033b9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8033be:	0f 44 d8             	cmove  %eax,%ebx
+  8033c1:	eb 05                	jmp    8033c8 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  8033c3:	e8 a4 da ff ff       	call   800e6c <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  8033c8:	ff 75 14             	push   0x14(%ebp)
+  8033cb:	53                   	push   %ebx
+  8033cc:	56                   	push   %esi
+  8033cd:	57                   	push   %edi
+  8033ce:	e8 3c de ff ff       	call   80120f <sys_ipc_try_send>
+  8033d3:	83 c4 10             	add    $0x10,%esp
+  8033d6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033d9:	74 e8                	je     8033c3 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  8033db:	85 c0                	test   %eax,%eax
+  8033dd:	78 08                	js     8033e7 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  8033df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e2:	5b                   	pop    %ebx
+  8033e3:	5e                   	pop    %esi
+  8033e4:	5f                   	pop    %edi
+  8033e5:	5d                   	pop    %ebp
+  8033e6:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  8033e7:	50                   	push   %eax
+  8033e8:	68 55 3b 80 00       	push   $0x803b55
+  8033ed:	6a 4f                	push   $0x4f
+  8033ef:	68 68 3b 80 00       	push   $0x803b68
+  8033f4:	e8 9e ce ff ff       	call   800297 <_panic>
+
+008033f9 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8033f9:	55                   	push   %ebp
+  8033fa:	89 e5                	mov    %esp,%ebp
+  8033fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8033ff:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803404:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80340a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803410:	8b 52 50             	mov    0x50(%edx),%edx
+  803413:	39 ca                	cmp    %ecx,%edx
+  803415:	74 11                	je     803428 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803417:	83 c0 01             	add    $0x1,%eax
+  80341a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80341f:	75 e3                	jne    803404 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803421:	b8 00 00 00 00       	mov    $0x0,%eax
+  803426:	eb 0e                	jmp    803436 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803428:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80342e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803433:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803436:	5d                   	pop    %ebp
+  803437:	c3                   	ret
+
+00803438 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803438:	55                   	push   %ebp
+  803439:	89 e5                	mov    %esp,%ebp
+  80343b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80343e:	89 c2                	mov    %eax,%edx
+  803440:	c1 ea 16             	shr    $0x16,%edx
+  803443:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80344a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80344f:	f6 c1 01             	test   $0x1,%cl
+  803452:	74 1a                	je     80346e <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803454:	c1 e8 0c             	shr    $0xc,%eax
+  803457:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80345e:	a8 01                	test   $0x1,%al
+  803460:	74 0c                	je     80346e <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803462:	c1 e8 0c             	shr    $0xc,%eax
+  803465:	c1 e0 04             	shl    $0x4,%eax
+  803468:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  80346e:	89 d0                	mov    %edx,%eax
+  803470:	5d                   	pop    %ebp
+  803471:	c3                   	ret
@@ -0,0 +1,7906 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 63 01 00 00       	call   800194 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <childofspawn>:
+	breakpoint();
+}
+
+void
+childofspawn(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	strcpy(VA, msg2);
+  800039:	ff 35 00 50 80 00    	push   0x805000
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	e8 32 09 00 00       	call   80097b <strcpy>
+	exit();
+  800049:	e8 f0 01 00 00       	call   80023e <exit>
+}
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+00800053 <umain>:
+{
+  800053:	55                   	push   %ebp
+  800054:	89 e5                	mov    %esp,%ebp
+  800056:	53                   	push   %ebx
+  800057:	83 ec 04             	sub    $0x4,%esp
+	if (argc != 0)
+  80005a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80005e:	0f 85 d0 00 00 00    	jne    800134 <umain+0xe1>
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  800064:	83 ec 04             	sub    $0x4,%esp
+  800067:	68 07 04 00 00       	push   $0x407
+  80006c:	68 00 00 00 a0       	push   $0xa0000000
+  800071:	6a 00                	push   $0x0
+  800073:	e8 fb 0d 00 00       	call   800e73 <sys_page_alloc>
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	85 c0                	test   %eax,%eax
+  80007d:	0f 88 bb 00 00 00    	js     80013e <umain+0xeb>
+	if ((r = fork()) < 0)
+  800083:	e8 d6 1c 00 00       	call   801d5e <fork>
+  800088:	89 c3                	mov    %eax,%ebx
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	0f 88 be 00 00 00    	js     800150 <umain+0xfd>
+	if (r == 0) {
+  800092:	0f 84 ca 00 00 00    	je     800162 <umain+0x10f>
+	wait(r);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	e8 1f 37 00 00       	call   8037c0 <wait>
+	cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	ff 35 04 50 80 00    	push   0x805004
+  8000aa:	68 00 00 00 a0       	push   $0xa0000000
+  8000af:	e8 78 09 00 00       	call   800a2c <strcmp>
+  8000b4:	83 c4 08             	add    $0x8,%esp
+  8000b7:	85 c0                	test   %eax,%eax
+  8000b9:	b8 e6 3b 80 00       	mov    $0x803be6,%eax
+  8000be:	ba e0 3b 80 00       	mov    $0x803be0,%edx
+  8000c3:	0f 44 c2             	cmove  %edx,%eax
+  8000c6:	50                   	push   %eax
+  8000c7:	68 13 3c 80 00       	push   $0x803c13
+  8000cc:	e8 62 02 00 00       	call   800333 <cprintf>
+	if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	68 2e 3c 80 00       	push   $0x803c2e
+  8000d8:	68 33 3c 80 00       	push   $0x803c33
+  8000dd:	68 32 3c 80 00       	push   $0x803c32
+  8000e2:	e8 4b 2e 00 00       	call   802f32 <spawnl>
+  8000e7:	83 c4 20             	add    $0x20,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 88 90 00 00 00    	js     800182 <umain+0x12f>
+	wait(r);
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	50                   	push   %eax
+  8000f6:	e8 c5 36 00 00       	call   8037c0 <wait>
+	cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8000fb:	83 c4 08             	add    $0x8,%esp
+  8000fe:	ff 35 00 50 80 00    	push   0x805000
+  800104:	68 00 00 00 a0       	push   $0xa0000000
+  800109:	e8 1e 09 00 00       	call   800a2c <strcmp>
+  80010e:	83 c4 08             	add    $0x8,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	b8 e6 3b 80 00       	mov    $0x803be6,%eax
+  800118:	ba e0 3b 80 00       	mov    $0x803be0,%edx
+  80011d:	0f 44 c2             	cmove  %edx,%eax
+  800120:	50                   	push   %eax
+  800121:	68 4a 3c 80 00       	push   $0x803c4a
+  800126:	e8 08 02 00 00       	call   800333 <cprintf>
+#define MSR_SYSENTER_EIP	0x176
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  80012b:	cc                   	int3
+}
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+		childofspawn();
+  800134:	e8 fa fe ff ff       	call   800033 <childofspawn>
+  800139:	e9 26 ff ff ff       	jmp    800064 <umain+0x11>
+		panic("sys_page_alloc: %e", r);
+  80013e:	50                   	push   %eax
+  80013f:	68 ec 3b 80 00       	push   $0x803bec
+  800144:	6a 13                	push   $0x13
+  800146:	68 ff 3b 80 00       	push   $0x803bff
+  80014b:	e8 08 01 00 00       	call   800258 <_panic>
+		panic("fork: %e", r);
+  800150:	50                   	push   %eax
+  800151:	68 f0 40 80 00       	push   $0x8040f0
+  800156:	6a 17                	push   $0x17
+  800158:	68 ff 3b 80 00       	push   $0x803bff
+  80015d:	e8 f6 00 00 00       	call   800258 <_panic>
+		strcpy(VA, msg);
+  800162:	83 ec 08             	sub    $0x8,%esp
+  800165:	ff 35 04 50 80 00    	push   0x805004
+  80016b:	68 00 00 00 a0       	push   $0xa0000000
+  800170:	e8 06 08 00 00       	call   80097b <strcpy>
+		exit();
+  800175:	e8 c4 00 00 00       	call   80023e <exit>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	e9 16 ff ff ff       	jmp    800098 <umain+0x45>
+		panic("spawn: %e", r);
+  800182:	50                   	push   %eax
+  800183:	68 40 3c 80 00       	push   $0x803c40
+  800188:	6a 21                	push   $0x21
+  80018a:	68 ff 3b 80 00       	push   $0x803bff
+  80018f:	e8 c4 00 00 00       	call   800258 <_panic>
+
+00800194 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	57                   	push   %edi
+  800198:	56                   	push   %esi
+  800199:	53                   	push   %ebx
+  80019a:	83 ec 0c             	sub    $0xc,%esp
+  80019d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8001a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  8001a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001a8:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  8001aa:	c1 ea 0b             	shr    $0xb,%edx
+  8001ad:	83 f2 01             	xor    $0x1,%edx
+  8001b0:	83 e2 01             	and    $0x1,%edx
+  8001b3:	88 15 0c 60 80 00    	mov    %dl,0x80600c
+
+	mainenv = NULL;
+  8001b9:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8001c0:	00 00 00 
+	envid = sys_getenvid();
+  8001c3:	e8 1f 0c 00 00       	call   800de7 <sys_getenvid>
+  8001c8:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8001ca:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8001cf:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8001d5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8001db:	8b 52 48             	mov    0x48(%edx),%edx
+  8001de:	39 ca                	cmp    %ecx,%edx
+  8001e0:	74 27                	je     800209 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8001e2:	83 c0 01             	add    $0x1,%eax
+  8001e5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001ea:	75 e3                	jne    8001cf <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8001ec:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8001f3:	75 24                	jne    800219 <libmain+0x85>
+		panic("libmain can't find the environment");
+  8001f5:	83 ec 04             	sub    $0x4,%esp
+  8001f8:	68 84 3c 80 00       	push   $0x803c84
+  8001fd:	6a 23                	push   $0x23
+  8001ff:	68 a7 3c 80 00       	push   $0x803ca7
+  800204:	e8 4f 00 00 00       	call   800258 <_panic>
+			mainenv = &envs[i];
+  800209:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80020f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800214:	a3 08 60 80 00       	mov    %eax,0x806008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800219:	85 ff                	test   %edi,%edi
+  80021b:	7e 07                	jle    800224 <libmain+0x90>
+		binaryname = argv[0];
+  80021d:	8b 06                	mov    (%esi),%eax
+  80021f:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// call user main routine
+	umain(argc, argv);
+  800224:	83 ec 08             	sub    $0x8,%esp
+  800227:	56                   	push   %esi
+  800228:	57                   	push   %edi
+  800229:	e8 25 fe ff ff       	call   800053 <umain>
+
+	// exit gracefully
+	exit();
+  80022e:	e8 0b 00 00 00       	call   80023e <exit>
+}
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800239:	5b                   	pop    %ebx
+  80023a:	5e                   	pop    %esi
+  80023b:	5f                   	pop    %edi
+  80023c:	5d                   	pop    %ebp
+  80023d:	c3                   	ret
+
+0080023e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80023e:	55                   	push   %ebp
+  80023f:	89 e5                	mov    %esp,%ebp
+  800241:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800244:	e8 9c 1f 00 00       	call   8021e5 <close_all>
+	sys_env_destroy(0);
+  800249:	83 ec 0c             	sub    $0xc,%esp
+  80024c:	6a 00                	push   $0x0
+  80024e:	e8 2b 0b 00 00       	call   800d7e <sys_env_destroy>
+}
+  800253:	83 c4 10             	add    $0x10,%esp
+  800256:	c9                   	leave
+  800257:	c3                   	ret
+
+00800258 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800258:	55                   	push   %ebp
+  800259:	89 e5                	mov    %esp,%ebp
+  80025b:	56                   	push   %esi
+  80025c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80025d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800260:	8b 35 08 50 80 00    	mov    0x805008,%esi
+  800266:	e8 7c 0b 00 00       	call   800de7 <sys_getenvid>
+  80026b:	83 ec 0c             	sub    $0xc,%esp
+  80026e:	ff 75 0c             	push   0xc(%ebp)
+  800271:	ff 75 08             	push   0x8(%ebp)
+  800274:	56                   	push   %esi
+  800275:	50                   	push   %eax
+  800276:	68 c0 3c 80 00       	push   $0x803cc0
+  80027b:	e8 b3 00 00 00       	call   800333 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800280:	83 c4 18             	add    $0x18,%esp
+  800283:	53                   	push   %ebx
+  800284:	ff 75 10             	push   0x10(%ebp)
+  800287:	e8 56 00 00 00       	call   8002e2 <vcprintf>
+	cprintf("\n");
+  80028c:	c7 04 24 27 42 80 00 	movl   $0x804227,(%esp)
+  800293:	e8 9b 00 00 00       	call   800333 <cprintf>
+  800298:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80029b:	cc                   	int3
+	while (1)
+  80029c:	eb fd                	jmp    80029b <_panic+0x43>
+
+0080029e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	53                   	push   %ebx
+  8002a2:	83 ec 04             	sub    $0x4,%esp
+  8002a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002a8:	8b 13                	mov    (%ebx),%edx
+  8002aa:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ad:	89 03                	mov    %eax,(%ebx)
+  8002af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002b2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002b6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002bb:	74 09                	je     8002c6 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002bd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002c6:	83 ec 08             	sub    $0x8,%esp
+  8002c9:	68 ff 00 00 00       	push   $0xff
+  8002ce:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002d1:	50                   	push   %eax
+  8002d2:	e8 1d 0a 00 00       	call   800cf4 <sys_cputs>
+		b->idx = 0;
+  8002d7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	eb db                	jmp    8002bd <putch+0x1f>
+
+008002e2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002e2:	55                   	push   %ebp
+  8002e3:	89 e5                	mov    %esp,%ebp
+  8002e5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002eb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002f2:	00 00 00 
+	b.cnt = 0;
+  8002f5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002fc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002ff:	ff 75 0c             	push   0xc(%ebp)
+  800302:	ff 75 08             	push   0x8(%ebp)
+  800305:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80030b:	50                   	push   %eax
+  80030c:	68 9e 02 80 00       	push   $0x80029e
+  800311:	e8 fb 00 00 00       	call   800411 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800316:	83 c4 08             	add    $0x8,%esp
+  800319:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80031f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800325:	50                   	push   %eax
+  800326:	e8 c9 09 00 00       	call   800cf4 <sys_cputs>
+
+	return b.cnt;
+}
+  80032b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800331:	c9                   	leave
+  800332:	c3                   	ret
+
+00800333 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800333:	55                   	push   %ebp
+  800334:	89 e5                	mov    %esp,%ebp
+  800336:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800339:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80033c:	50                   	push   %eax
+  80033d:	ff 75 08             	push   0x8(%ebp)
+  800340:	e8 9d ff ff ff       	call   8002e2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800345:	c9                   	leave
+  800346:	c3                   	ret
+
+00800347 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800347:	55                   	push   %ebp
+  800348:	89 e5                	mov    %esp,%ebp
+  80034a:	57                   	push   %edi
+  80034b:	56                   	push   %esi
+  80034c:	53                   	push   %ebx
+  80034d:	83 ec 1c             	sub    $0x1c,%esp
+  800350:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800353:	89 d6                	mov    %edx,%esi
+  800355:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800358:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80035b:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80035e:	73 0b                	jae    80036b <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800360:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800363:	c1 e7 08             	shl    $0x8,%edi
+  800366:	0b 7d 10             	or     0x10(%ebp),%edi
+  800369:	eb 36                	jmp    8003a1 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80036b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80036e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800373:	f7 75 08             	divl   0x8(%ebp)
+  800376:	89 c1                	mov    %eax,%ecx
+  800378:	ff 75 14             	push   0x14(%ebp)
+  80037b:	ff 75 10             	push   0x10(%ebp)
+  80037e:	83 eb 01             	sub    $0x1,%ebx
+  800381:	53                   	push   %ebx
+  800382:	ff 75 08             	push   0x8(%ebp)
+  800385:	89 f2                	mov    %esi,%edx
+  800387:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80038a:	e8 b8 ff ff ff       	call   800347 <printnum>
+  80038f:	83 c4 10             	add    $0x10,%esp
+  800392:	eb 14                	jmp    8003a8 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800394:	83 ec 08             	sub    $0x8,%esp
+  800397:	56                   	push   %esi
+  800398:	57                   	push   %edi
+  800399:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80039c:	ff d0                	call   *%eax
+  80039e:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003a1:	83 eb 01             	sub    $0x1,%ebx
+  8003a4:	85 db                	test   %ebx,%ebx
+  8003a6:	7f ec                	jg     800394 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  8003a8:	83 ec 08             	sub    $0x8,%esp
+  8003ab:	56                   	push   %esi
+  8003ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b4:	f7 75 08             	divl   0x8(%ebp)
+  8003b7:	0f be 92 e3 3c 80 00 	movsbl 0x803ce3(%edx),%edx
+  8003be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c1:	c1 e0 08             	shl    $0x8,%eax
+  8003c4:	09 d0                	or     %edx,%eax
+  8003c6:	50                   	push   %eax
+  8003c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003ca:	ff d0                	call   *%eax
+}
+  8003cc:	83 c4 10             	add    $0x10,%esp
+  8003cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d2:	5b                   	pop    %ebx
+  8003d3:	5e                   	pop    %esi
+  8003d4:	5f                   	pop    %edi
+  8003d5:	5d                   	pop    %ebp
+  8003d6:	c3                   	ret
+
+008003d7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003d7:	55                   	push   %ebp
+  8003d8:	89 e5                	mov    %esp,%ebp
+  8003da:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003dd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003e1:	8b 10                	mov    (%eax),%edx
+  8003e3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003e6:	73 0a                	jae    8003f2 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003e8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003eb:	89 08                	mov    %ecx,(%eax)
+  8003ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f0:	88 02                	mov    %al,(%edx)
+}
+  8003f2:	5d                   	pop    %ebp
+  8003f3:	c3                   	ret
+
+008003f4 <printfmt>:
+{
+  8003f4:	55                   	push   %ebp
+  8003f5:	89 e5                	mov    %esp,%ebp
+  8003f7:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003fa:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003fd:	50                   	push   %eax
+  8003fe:	ff 75 10             	push   0x10(%ebp)
+  800401:	ff 75 0c             	push   0xc(%ebp)
+  800404:	ff 75 08             	push   0x8(%ebp)
+  800407:	e8 05 00 00 00       	call   800411 <vprintfmt>
+}
+  80040c:	83 c4 10             	add    $0x10,%esp
+  80040f:	c9                   	leave
+  800410:	c3                   	ret
+
+00800411 <vprintfmt>:
+{
+  800411:	55                   	push   %ebp
+  800412:	89 e5                	mov    %esp,%ebp
+  800414:	57                   	push   %edi
+  800415:	56                   	push   %esi
+  800416:	53                   	push   %ebx
+  800417:	83 ec 3c             	sub    $0x3c,%esp
+  80041a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80041d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800420:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800427:	eb 16                	jmp    80043f <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800429:	83 ec 08             	sub    $0x8,%esp
+  80042c:	ff 75 0c             	push   0xc(%ebp)
+  80042f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800432:	c1 e2 08             	shl    $0x8,%edx
+  800435:	09 d0                	or     %edx,%eax
+  800437:	50                   	push   %eax
+  800438:	ff d7                	call   *%edi
+  80043a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80043d:	89 de                	mov    %ebx,%esi
+  80043f:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800442:	0f b6 06             	movzbl (%esi),%eax
+  800445:	83 f8 25             	cmp    $0x25,%eax
+  800448:	74 0c                	je     800456 <vprintfmt+0x45>
+			if (ch == '\0')
+  80044a:	85 c0                	test   %eax,%eax
+  80044c:	75 db                	jne    800429 <vprintfmt+0x18>
+}
+  80044e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800451:	5b                   	pop    %ebx
+  800452:	5e                   	pop    %esi
+  800453:	5f                   	pop    %edi
+  800454:	5d                   	pop    %ebp
+  800455:	c3                   	ret
+		padc = ' ';
+  800456:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80045a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800461:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800468:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80046f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800474:	8d 73 01             	lea    0x1(%ebx),%esi
+  800477:	0f b6 13             	movzbl (%ebx),%edx
+  80047a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80047d:	3c 55                	cmp    $0x55,%al
+  80047f:	0f 87 2c 04 00 00    	ja     8008b1 <vprintfmt+0x4a0>
+  800485:	0f b6 c0             	movzbl %al,%eax
+  800488:	ff 24 85 20 3e 80 00 	jmp    *0x803e20(,%eax,4)
+  80048f:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800491:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800495:	eb dd                	jmp    800474 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800497:	89 f3                	mov    %esi,%ebx
+  800499:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80049d:	eb d5                	jmp    800474 <vprintfmt+0x63>
+  80049f:	0f b6 d2             	movzbl %dl,%edx
+  8004a2:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  8004a4:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  8004a9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004ac:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004b0:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8004b3:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8004b6:	83 fe 09             	cmp    $0x9,%esi
+  8004b9:	0f 87 8a 00 00 00    	ja     800549 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8004bf:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8004c2:	eb e5                	jmp    8004a9 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8004c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c7:	8b 00                	mov    (%eax),%eax
+  8004c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d5:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8004d7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004db:	79 97                	jns    800474 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8004dd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004ea:	eb 88                	jmp    800474 <vprintfmt+0x63>
+			if (width < 0)
+  8004ec:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8004ef:	85 db                	test   %ebx,%ebx
+  8004f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f6:	0f 49 c3             	cmovns %ebx,%eax
+  8004f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004fc:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004fe:	e9 71 ff ff ff       	jmp    800474 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800503:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800505:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80050c:	e9 63 ff ff ff       	jmp    800474 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800511:	8d 73 02             	lea    0x2(%ebx),%esi
+  800514:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800518:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80051f:	3c 67                	cmp    $0x67,%al
+  800521:	0f 84 18 ff ff ff    	je     80043f <vprintfmt+0x2e>
+					attrib = 0x04;
+  800527:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80052e:	3c 72                	cmp    $0x72,%al
+  800530:	0f 84 09 ff ff ff    	je     80043f <vprintfmt+0x2e>
+					attrib = 0x00;
+  800536:	3c 62                	cmp    $0x62,%al
+  800538:	0f 94 c0             	sete   %al
+  80053b:	0f b6 c0             	movzbl %al,%eax
+  80053e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800541:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800544:	e9 f6 fe ff ff       	jmp    80043f <vprintfmt+0x2e>
+  800549:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80054c:	eb 89                	jmp    8004d7 <vprintfmt+0xc6>
+			lflag++;
+  80054e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800551:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800553:	e9 1c ff ff ff       	jmp    800474 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800558:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055b:	8d 58 04             	lea    0x4(%eax),%ebx
+  80055e:	83 ec 08             	sub    $0x8,%esp
+  800561:	ff 75 0c             	push   0xc(%ebp)
+  800564:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800567:	c1 e0 08             	shl    $0x8,%eax
+  80056a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80056d:	0b 01                	or     (%ecx),%eax
+  80056f:	50                   	push   %eax
+  800570:	ff d7                	call   *%edi
+			break;
+  800572:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800575:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800578:	e9 c2 fe ff ff       	jmp    80043f <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80057d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800580:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800583:	8b 10                	mov    (%eax),%edx
+  800585:	89 d0                	mov    %edx,%eax
+  800587:	f7 d8                	neg    %eax
+  800589:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80058c:	83 f8 12             	cmp    $0x12,%eax
+  80058f:	7f 25                	jg     8005b6 <vprintfmt+0x1a5>
+  800591:	8b 14 85 80 3f 80 00 	mov    0x803f80(,%eax,4),%edx
+  800598:	85 d2                	test   %edx,%edx
+  80059a:	74 1a                	je     8005b6 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80059c:	52                   	push   %edx
+  80059d:	68 c2 40 80 00       	push   $0x8040c2
+  8005a2:	ff 75 0c             	push   0xc(%ebp)
+  8005a5:	57                   	push   %edi
+  8005a6:	e8 49 fe ff ff       	call   8003f4 <printfmt>
+  8005ab:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005ae:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8005b1:	e9 89 fe ff ff       	jmp    80043f <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8005b6:	50                   	push   %eax
+  8005b7:	68 fb 3c 80 00       	push   $0x803cfb
+  8005bc:	ff 75 0c             	push   0xc(%ebp)
+  8005bf:	57                   	push   %edi
+  8005c0:	e8 2f fe ff ff       	call   8003f4 <printfmt>
+  8005c5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005c8:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005cb:	e9 6f fe ff ff       	jmp    80043f <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d3:	83 c0 04             	add    $0x4,%eax
+  8005d6:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8005d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dc:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005de:	85 c9                	test   %ecx,%ecx
+  8005e0:	b8 f4 3c 80 00       	mov    $0x803cf4,%eax
+  8005e5:	0f 45 c1             	cmovne %ecx,%eax
+  8005e8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8005eb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005ef:	7e 06                	jle    8005f7 <vprintfmt+0x1e6>
+  8005f1:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8005f5:	75 1a                	jne    800611 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8005f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005fa:	c1 e0 08             	shl    $0x8,%eax
+  8005fd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800600:	83 c8 3f             	or     $0x3f,%eax
+  800603:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800606:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800609:	89 75 10             	mov    %esi,0x10(%ebp)
+  80060c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80060f:	eb 6d                	jmp    80067e <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800611:	83 ec 08             	sub    $0x8,%esp
+  800614:	ff 75 d0             	push   -0x30(%ebp)
+  800617:	ff 75 c8             	push   -0x38(%ebp)
+  80061a:	e8 39 03 00 00       	call   800958 <strnlen>
+  80061f:	89 c2                	mov    %eax,%edx
+  800621:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800624:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800626:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800629:	c1 e1 08             	shl    $0x8,%ecx
+  80062c:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800630:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800632:	83 c4 10             	add    $0x10,%esp
+  800635:	89 c3                	mov    %eax,%ebx
+  800637:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80063a:	89 75 10             	mov    %esi,0x10(%ebp)
+  80063d:	89 ce                	mov    %ecx,%esi
+  80063f:	eb 0f                	jmp    800650 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800641:	83 ec 08             	sub    $0x8,%esp
+  800644:	ff 75 0c             	push   0xc(%ebp)
+  800647:	56                   	push   %esi
+  800648:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80064a:	83 eb 01             	sub    $0x1,%ebx
+  80064d:	83 c4 10             	add    $0x10,%esp
+  800650:	85 db                	test   %ebx,%ebx
+  800652:	7f ed                	jg     800641 <vprintfmt+0x230>
+  800654:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800657:	8b 75 10             	mov    0x10(%ebp),%esi
+  80065a:	85 c0                	test   %eax,%eax
+  80065c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800661:	0f 49 d0             	cmovns %eax,%edx
+  800664:	29 d0                	sub    %edx,%eax
+  800666:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800669:	eb 8c                	jmp    8005f7 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	ff 75 0c             	push   0xc(%ebp)
+  800671:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800674:	09 c2                	or     %eax,%edx
+  800676:	52                   	push   %edx
+  800677:	ff d7                	call   *%edi
+  800679:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80067c:	89 d9                	mov    %ebx,%ecx
+  80067e:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800681:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800685:	0f be d0             	movsbl %al,%edx
+  800688:	85 d2                	test   %edx,%edx
+  80068a:	74 2a                	je     8006b6 <vprintfmt+0x2a5>
+  80068c:	85 f6                	test   %esi,%esi
+  80068e:	78 05                	js     800695 <vprintfmt+0x284>
+  800690:	83 ee 01             	sub    $0x1,%esi
+  800693:	78 3b                	js     8006d0 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800695:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800699:	74 d0                	je     80066b <vprintfmt+0x25a>
+  80069b:	0f be c0             	movsbl %al,%eax
+  80069e:	83 e8 20             	sub    $0x20,%eax
+  8006a1:	83 f8 5e             	cmp    $0x5e,%eax
+  8006a4:	76 c5                	jbe    80066b <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	ff 75 0c             	push   0xc(%ebp)
+  8006ac:	ff 75 cc             	push   -0x34(%ebp)
+  8006af:	ff d7                	call   *%edi
+  8006b1:	83 c4 10             	add    $0x10,%esp
+  8006b4:	eb c6                	jmp    80067c <vprintfmt+0x26b>
+  8006b6:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006b9:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8006bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006bf:	01 c3                	add    %eax,%ebx
+  8006c1:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8006c3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006c6:	83 c8 20             	or     $0x20,%eax
+  8006c9:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006cc:	89 c6                	mov    %eax,%esi
+  8006ce:	eb 14                	jmp    8006e4 <vprintfmt+0x2d3>
+  8006d0:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006d3:	eb e4                	jmp    8006b9 <vprintfmt+0x2a8>
+  8006d5:	83 ec 08             	sub    $0x8,%esp
+  8006d8:	ff 75 0c             	push   0xc(%ebp)
+  8006db:	56                   	push   %esi
+  8006dc:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006de:	83 eb 01             	sub    $0x1,%ebx
+  8006e1:	83 c4 10             	add    $0x10,%esp
+  8006e4:	85 db                	test   %ebx,%ebx
+  8006e6:	7f ed                	jg     8006d5 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006e8:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006eb:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8006ee:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f1:	e9 49 fd ff ff       	jmp    80043f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8006f6:	83 f9 01             	cmp    $0x1,%ecx
+  8006f9:	7f 1f                	jg     80071a <vprintfmt+0x309>
+	else if (lflag)
+  8006fb:	85 c9                	test   %ecx,%ecx
+  8006fd:	74 69                	je     800768 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8b 00                	mov    (%eax),%eax
+  800704:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800707:	89 c1                	mov    %eax,%ecx
+  800709:	c1 f9 1f             	sar    $0x1f,%ecx
+  80070c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8d 40 04             	lea    0x4(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+  800718:	eb 17                	jmp    800731 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 50 04             	mov    0x4(%eax),%edx
+  800720:	8b 00                	mov    (%eax),%eax
+  800722:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800725:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800728:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072b:	8d 40 08             	lea    0x8(%eax),%eax
+  80072e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800731:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800734:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800737:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80073c:	85 db                	test   %ebx,%ebx
+  80073e:	0f 89 f6 00 00 00    	jns    80083a <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800744:	83 ec 08             	sub    $0x8,%esp
+  800747:	ff 75 0c             	push   0xc(%ebp)
+  80074a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80074d:	c1 e0 08             	shl    $0x8,%eax
+  800750:	83 c8 2d             	or     $0x2d,%eax
+  800753:	50                   	push   %eax
+  800754:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800756:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800759:	f7 d9                	neg    %ecx
+  80075b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80075e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800763:	e9 d2 00 00 00       	jmp    80083a <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 00                	mov    (%eax),%eax
+  80076d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800770:	89 c1                	mov    %eax,%ecx
+  800772:	c1 f9 1f             	sar    $0x1f,%ecx
+  800775:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800778:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077b:	8d 40 04             	lea    0x4(%eax),%eax
+  80077e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800781:	eb ae                	jmp    800731 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800783:	83 f9 01             	cmp    $0x1,%ecx
+  800786:	7f 19                	jg     8007a1 <vprintfmt+0x390>
+	else if (lflag)
+  800788:	85 c9                	test   %ecx,%ecx
+  80078a:	74 2a                	je     8007b6 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 08                	mov    (%eax),%ecx
+  800791:	8d 40 04             	lea    0x4(%eax),%eax
+  800794:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800797:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  80079c:	e9 99 00 00 00       	jmp    80083a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 08                	mov    (%eax),%ecx
+  8007a6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8007b1:	e9 84 00 00 00       	jmp    80083a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b9:	8b 08                	mov    (%eax),%ecx
+  8007bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8007be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8007c6:	eb 72                	jmp    80083a <vprintfmt+0x429>
+	if (lflag >= 2)
+  8007c8:	83 f9 01             	cmp    $0x1,%ecx
+  8007cb:	7f 16                	jg     8007e3 <vprintfmt+0x3d2>
+	else if (lflag)
+  8007cd:	85 c9                	test   %ecx,%ecx
+  8007cf:	74 24                	je     8007f5 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d4:	8b 08                	mov    (%eax),%ecx
+  8007d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007dc:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8007e1:	eb 57                	jmp    80083a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e6:	8b 08                	mov    (%eax),%ecx
+  8007e8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ee:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8007f3:	eb 45                	jmp    80083a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f8:	8b 08                	mov    (%eax),%ecx
+  8007fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800800:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800805:	eb 33                	jmp    80083a <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800807:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80080a:	c1 e3 08             	shl    $0x8,%ebx
+  80080d:	83 ec 08             	sub    $0x8,%esp
+  800810:	ff 75 0c             	push   0xc(%ebp)
+  800813:	89 d8                	mov    %ebx,%eax
+  800815:	83 c8 30             	or     $0x30,%eax
+  800818:	50                   	push   %eax
+  800819:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80081b:	83 c4 08             	add    $0x8,%esp
+  80081e:	ff 75 0c             	push   0xc(%ebp)
+  800821:	83 cb 78             	or     $0x78,%ebx
+  800824:	53                   	push   %ebx
+  800825:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082a:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80082c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80082f:	8d 40 04             	lea    0x4(%eax),%eax
+  800832:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800835:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80083a:	ff 75 e4             	push   -0x1c(%ebp)
+  80083d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800841:	52                   	push   %edx
+  800842:	ff 75 e0             	push   -0x20(%ebp)
+  800845:	50                   	push   %eax
+  800846:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800849:	89 f8                	mov    %edi,%eax
+  80084b:	e8 f7 fa ff ff       	call   800347 <printnum>
+			break;
+  800850:	83 c4 10             	add    $0x10,%esp
+  800853:	e9 e7 fb ff ff       	jmp    80043f <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800858:	83 f9 01             	cmp    $0x1,%ecx
+  80085b:	7f 16                	jg     800873 <vprintfmt+0x462>
+	else if (lflag)
+  80085d:	85 c9                	test   %ecx,%ecx
+  80085f:	74 24                	je     800885 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800861:	8b 45 14             	mov    0x14(%ebp),%eax
+  800864:	8b 08                	mov    (%eax),%ecx
+  800866:	8d 40 04             	lea    0x4(%eax),%eax
+  800869:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80086c:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800871:	eb c7                	jmp    80083a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800873:	8b 45 14             	mov    0x14(%ebp),%eax
+  800876:	8b 08                	mov    (%eax),%ecx
+  800878:	8d 40 08             	lea    0x8(%eax),%eax
+  80087b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087e:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800883:	eb b5                	jmp    80083a <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800885:	8b 45 14             	mov    0x14(%ebp),%eax
+  800888:	8b 08                	mov    (%eax),%ecx
+  80088a:	8d 40 04             	lea    0x4(%eax),%eax
+  80088d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800890:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800895:	eb a3                	jmp    80083a <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800897:	83 ec 08             	sub    $0x8,%esp
+  80089a:	ff 75 0c             	push   0xc(%ebp)
+  80089d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008a0:	c1 e0 08             	shl    $0x8,%eax
+  8008a3:	83 c8 25             	or     $0x25,%eax
+  8008a6:	50                   	push   %eax
+  8008a7:	ff d7                	call   *%edi
+			break;
+  8008a9:	83 c4 10             	add    $0x10,%esp
+  8008ac:	e9 8e fb ff ff       	jmp    80043f <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8008b1:	83 ec 08             	sub    $0x8,%esp
+  8008b4:	ff 75 0c             	push   0xc(%ebp)
+  8008b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008ba:	c1 e0 08             	shl    $0x8,%eax
+  8008bd:	83 c8 25             	or     $0x25,%eax
+  8008c0:	50                   	push   %eax
+  8008c1:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008c3:	83 c4 10             	add    $0x10,%esp
+  8008c6:	89 de                	mov    %ebx,%esi
+  8008c8:	eb 03                	jmp    8008cd <vprintfmt+0x4bc>
+  8008ca:	83 ee 01             	sub    $0x1,%esi
+  8008cd:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008d1:	75 f7                	jne    8008ca <vprintfmt+0x4b9>
+  8008d3:	e9 67 fb ff ff       	jmp    80043f <vprintfmt+0x2e>
+
+008008d8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	83 ec 18             	sub    $0x18,%esp
+  8008de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008e4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008e7:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008eb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008ee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008f5:	85 c0                	test   %eax,%eax
+  8008f7:	74 26                	je     80091f <vsnprintf+0x47>
+  8008f9:	85 d2                	test   %edx,%edx
+  8008fb:	7e 22                	jle    80091f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008fd:	ff 75 14             	push   0x14(%ebp)
+  800900:	ff 75 10             	push   0x10(%ebp)
+  800903:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800906:	50                   	push   %eax
+  800907:	68 d7 03 80 00       	push   $0x8003d7
+  80090c:	e8 00 fb ff ff       	call   800411 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800911:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800914:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800917:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80091a:	83 c4 10             	add    $0x10,%esp
+}
+  80091d:	c9                   	leave
+  80091e:	c3                   	ret
+		return -E_INVAL;
+  80091f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800924:	eb f7                	jmp    80091d <vsnprintf+0x45>
+
+00800926 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800926:	55                   	push   %ebp
+  800927:	89 e5                	mov    %esp,%ebp
+  800929:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80092c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80092f:	50                   	push   %eax
+  800930:	ff 75 10             	push   0x10(%ebp)
+  800933:	ff 75 0c             	push   0xc(%ebp)
+  800936:	ff 75 08             	push   0x8(%ebp)
+  800939:	e8 9a ff ff ff       	call   8008d8 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80093e:	c9                   	leave
+  80093f:	c3                   	ret
+
+00800940 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094b:	eb 03                	jmp    800950 <strlen+0x10>
+		n++;
+  80094d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800950:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800954:	75 f7                	jne    80094d <strlen+0xd>
+	return n;
+}
+  800956:	5d                   	pop    %ebp
+  800957:	c3                   	ret
+
+00800958 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80095e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800961:	b8 00 00 00 00       	mov    $0x0,%eax
+  800966:	eb 03                	jmp    80096b <strnlen+0x13>
+		n++;
+  800968:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80096b:	39 d0                	cmp    %edx,%eax
+  80096d:	74 08                	je     800977 <strnlen+0x1f>
+  80096f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800973:	75 f3                	jne    800968 <strnlen+0x10>
+  800975:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800977:	89 d0                	mov    %edx,%eax
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+
+0080097b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	53                   	push   %ebx
+  80097f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800982:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80098e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800991:	83 c0 01             	add    $0x1,%eax
+  800994:	84 d2                	test   %dl,%dl
+  800996:	75 f2                	jne    80098a <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800998:	89 c8                	mov    %ecx,%eax
+  80099a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80099d:	c9                   	leave
+  80099e:	c3                   	ret
+
+0080099f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	53                   	push   %ebx
+  8009a3:	83 ec 10             	sub    $0x10,%esp
+  8009a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009a9:	53                   	push   %ebx
+  8009aa:	e8 91 ff ff ff       	call   800940 <strlen>
+  8009af:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009b2:	ff 75 0c             	push   0xc(%ebp)
+  8009b5:	01 d8                	add    %ebx,%eax
+  8009b7:	50                   	push   %eax
+  8009b8:	e8 be ff ff ff       	call   80097b <strcpy>
+	return dst;
+}
+  8009bd:	89 d8                	mov    %ebx,%eax
+  8009bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c2:	c9                   	leave
+  8009c3:	c3                   	ret
+
+008009c4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	56                   	push   %esi
+  8009c8:	53                   	push   %ebx
+  8009c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009cf:	89 f3                	mov    %esi,%ebx
+  8009d1:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009d4:	89 f0                	mov    %esi,%eax
+  8009d6:	eb 0f                	jmp    8009e7 <strncpy+0x23>
+		*dst++ = *src;
+  8009d8:	83 c0 01             	add    $0x1,%eax
+  8009db:	0f b6 0a             	movzbl (%edx),%ecx
+  8009de:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009e1:	80 f9 01             	cmp    $0x1,%cl
+  8009e4:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009e7:	39 d8                	cmp    %ebx,%eax
+  8009e9:	75 ed                	jne    8009d8 <strncpy+0x14>
+	}
+	return ret;
+}
+  8009eb:	89 f0                	mov    %esi,%eax
+  8009ed:	5b                   	pop    %ebx
+  8009ee:	5e                   	pop    %esi
+  8009ef:	5d                   	pop    %ebp
+  8009f0:	c3                   	ret
+
+008009f1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	56                   	push   %esi
+  8009f5:	53                   	push   %ebx
+  8009f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009fc:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009ff:	89 f0                	mov    %esi,%eax
+  800a01:	85 d2                	test   %edx,%edx
+  800a03:	74 21                	je     800a26 <strlcpy+0x35>
+  800a05:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a09:	89 f2                	mov    %esi,%edx
+  800a0b:	eb 09                	jmp    800a16 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a0d:	83 c1 01             	add    $0x1,%ecx
+  800a10:	83 c2 01             	add    $0x1,%edx
+  800a13:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a16:	39 c2                	cmp    %eax,%edx
+  800a18:	74 09                	je     800a23 <strlcpy+0x32>
+  800a1a:	0f b6 19             	movzbl (%ecx),%ebx
+  800a1d:	84 db                	test   %bl,%bl
+  800a1f:	75 ec                	jne    800a0d <strlcpy+0x1c>
+  800a21:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a23:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a26:	29 f0                	sub    %esi,%eax
+}
+  800a28:	5b                   	pop    %ebx
+  800a29:	5e                   	pop    %esi
+  800a2a:	5d                   	pop    %ebp
+  800a2b:	c3                   	ret
+
+00800a2c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a32:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a35:	eb 06                	jmp    800a3d <strcmp+0x11>
+		p++, q++;
+  800a37:	83 c1 01             	add    $0x1,%ecx
+  800a3a:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a3d:	0f b6 01             	movzbl (%ecx),%eax
+  800a40:	84 c0                	test   %al,%al
+  800a42:	74 04                	je     800a48 <strcmp+0x1c>
+  800a44:	3a 02                	cmp    (%edx),%al
+  800a46:	74 ef                	je     800a37 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a48:	0f b6 c0             	movzbl %al,%eax
+  800a4b:	0f b6 12             	movzbl (%edx),%edx
+  800a4e:	29 d0                	sub    %edx,%eax
+}
+  800a50:	5d                   	pop    %ebp
+  800a51:	c3                   	ret
+
+00800a52 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	53                   	push   %ebx
+  800a56:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a5c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800a5f:	eb 09                	jmp    800a6a <strncmp+0x18>
+		n--, p++, q++;
+  800a61:	83 ea 01             	sub    $0x1,%edx
+  800a64:	83 c0 01             	add    $0x1,%eax
+  800a67:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a6a:	85 d2                	test   %edx,%edx
+  800a6c:	74 18                	je     800a86 <strncmp+0x34>
+  800a6e:	0f b6 18             	movzbl (%eax),%ebx
+  800a71:	84 db                	test   %bl,%bl
+  800a73:	74 04                	je     800a79 <strncmp+0x27>
+  800a75:	3a 19                	cmp    (%ecx),%bl
+  800a77:	74 e8                	je     800a61 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a79:	0f b6 00             	movzbl (%eax),%eax
+  800a7c:	0f b6 11             	movzbl (%ecx),%edx
+  800a7f:	29 d0                	sub    %edx,%eax
+}
+  800a81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+		return 0;
+  800a86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8b:	eb f4                	jmp    800a81 <strncmp+0x2f>
+
+00800a8d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a93:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a97:	eb 03                	jmp    800a9c <strchr+0xf>
+  800a99:	83 c0 01             	add    $0x1,%eax
+  800a9c:	0f b6 10             	movzbl (%eax),%edx
+  800a9f:	84 d2                	test   %dl,%dl
+  800aa1:	74 06                	je     800aa9 <strchr+0x1c>
+		if (*s == c)
+  800aa3:	38 ca                	cmp    %cl,%dl
+  800aa5:	75 f2                	jne    800a99 <strchr+0xc>
+  800aa7:	eb 05                	jmp    800aae <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aae:	5d                   	pop    %ebp
+  800aaf:	c3                   	ret
+
+00800ab0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800aba:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800abd:	38 ca                	cmp    %cl,%dl
+  800abf:	74 09                	je     800aca <strfind+0x1a>
+  800ac1:	84 d2                	test   %dl,%dl
+  800ac3:	74 05                	je     800aca <strfind+0x1a>
+	for (; *s; s++)
+  800ac5:	83 c0 01             	add    $0x1,%eax
+  800ac8:	eb f0                	jmp    800aba <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800aca:	5d                   	pop    %ebp
+  800acb:	c3                   	ret
+
+00800acc <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800acc:	55                   	push   %ebp
+  800acd:	89 e5                	mov    %esp,%ebp
+  800acf:	57                   	push   %edi
+  800ad0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ad3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ad6:	85 c9                	test   %ecx,%ecx
+  800ad8:	74 20                	je     800afa <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ada:	89 f8                	mov    %edi,%eax
+  800adc:	09 c8                	or     %ecx,%eax
+  800ade:	a8 03                	test   $0x3,%al
+  800ae0:	75 12                	jne    800af4 <memset+0x28>
+		c &= 0xFF;
+  800ae2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ae6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800aec:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800aef:	fc                   	cld
+  800af0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800af2:	eb 06                	jmp    800afa <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800af4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800af7:	fc                   	cld
+  800af8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800afa:	89 f8                	mov    %edi,%eax
+  800afc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aff:	c9                   	leave
+  800b00:	c3                   	ret
+
+00800b01 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	57                   	push   %edi
+  800b05:	56                   	push   %esi
+  800b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b09:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b0c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b0f:	39 c6                	cmp    %eax,%esi
+  800b11:	73 32                	jae    800b45 <memmove+0x44>
+  800b13:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b16:	39 d0                	cmp    %edx,%eax
+  800b18:	73 2b                	jae    800b45 <memmove+0x44>
+		s += n;
+		d += n;
+  800b1a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b1d:	89 d6                	mov    %edx,%esi
+  800b1f:	09 fe                	or     %edi,%esi
+  800b21:	09 ce                	or     %ecx,%esi
+  800b23:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b29:	75 0e                	jne    800b39 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b2b:	83 ef 04             	sub    $0x4,%edi
+  800b2e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b31:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b34:	fd                   	std
+  800b35:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b37:	eb 09                	jmp    800b42 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b39:	83 ef 01             	sub    $0x1,%edi
+  800b3c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b3f:	fd                   	std
+  800b40:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b42:	fc                   	cld
+  800b43:	eb 1a                	jmp    800b5f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b45:	89 f2                	mov    %esi,%edx
+  800b47:	09 c2                	or     %eax,%edx
+  800b49:	09 ca                	or     %ecx,%edx
+  800b4b:	f6 c2 03             	test   $0x3,%dl
+  800b4e:	75 0a                	jne    800b5a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b50:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b53:	89 c7                	mov    %eax,%edi
+  800b55:	fc                   	cld
+  800b56:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b58:	eb 05                	jmp    800b5f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b5a:	89 c7                	mov    %eax,%edi
+  800b5c:	fc                   	cld
+  800b5d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b5f:	5e                   	pop    %esi
+  800b60:	5f                   	pop    %edi
+  800b61:	5d                   	pop    %ebp
+  800b62:	c3                   	ret
+
+00800b63 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b63:	55                   	push   %ebp
+  800b64:	89 e5                	mov    %esp,%ebp
+  800b66:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b69:	ff 75 10             	push   0x10(%ebp)
+  800b6c:	ff 75 0c             	push   0xc(%ebp)
+  800b6f:	ff 75 08             	push   0x8(%ebp)
+  800b72:	e8 8a ff ff ff       	call   800b01 <memmove>
+}
+  800b77:	c9                   	leave
+  800b78:	c3                   	ret
+
+00800b79 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	56                   	push   %esi
+  800b7d:	53                   	push   %ebx
+  800b7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b81:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b84:	89 c6                	mov    %eax,%esi
+  800b86:	03 75 10             	add    0x10(%ebp),%esi
+  800b89:	eb 06                	jmp    800b91 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b8b:	83 c0 01             	add    $0x1,%eax
+  800b8e:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b91:	39 f0                	cmp    %esi,%eax
+  800b93:	74 14                	je     800ba9 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b95:	0f b6 08             	movzbl (%eax),%ecx
+  800b98:	0f b6 1a             	movzbl (%edx),%ebx
+  800b9b:	38 d9                	cmp    %bl,%cl
+  800b9d:	74 ec                	je     800b8b <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b9f:	0f b6 c1             	movzbl %cl,%eax
+  800ba2:	0f b6 db             	movzbl %bl,%ebx
+  800ba5:	29 d8                	sub    %ebx,%eax
+  800ba7:	eb 05                	jmp    800bae <memcmp+0x35>
+	}
+
+	return 0;
+  800ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bae:	5b                   	pop    %ebx
+  800baf:	5e                   	pop    %esi
+  800bb0:	5d                   	pop    %ebp
+  800bb1:	c3                   	ret
+
+00800bb2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bbb:	89 c2                	mov    %eax,%edx
+  800bbd:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bc0:	eb 03                	jmp    800bc5 <memfind+0x13>
+  800bc2:	83 c0 01             	add    $0x1,%eax
+  800bc5:	39 d0                	cmp    %edx,%eax
+  800bc7:	73 04                	jae    800bcd <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bc9:	38 08                	cmp    %cl,(%eax)
+  800bcb:	75 f5                	jne    800bc2 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800bcd:	5d                   	pop    %ebp
+  800bce:	c3                   	ret
+
+00800bcf <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800bcf:	55                   	push   %ebp
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	57                   	push   %edi
+  800bd3:	56                   	push   %esi
+  800bd4:	53                   	push   %ebx
+  800bd5:	83 ec 1c             	sub    $0x1c,%esp
+  800bd8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bdb:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bde:	eb 03                	jmp    800be3 <strtol+0x14>
+		s++;
+  800be0:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800be3:	0f b6 06             	movzbl (%esi),%eax
+  800be6:	3c 20                	cmp    $0x20,%al
+  800be8:	74 f6                	je     800be0 <strtol+0x11>
+  800bea:	3c 09                	cmp    $0x9,%al
+  800bec:	74 f2                	je     800be0 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800bee:	3c 2b                	cmp    $0x2b,%al
+  800bf0:	74 43                	je     800c35 <strtol+0x66>
+	int neg = 0;
+  800bf2:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800bf7:	3c 2d                	cmp    $0x2d,%al
+  800bf9:	74 44                	je     800c3f <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bfb:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c01:	75 0f                	jne    800c12 <strtol+0x43>
+  800c03:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c06:	74 41                	je     800c49 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c08:	85 ff                	test   %edi,%edi
+  800c0a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c0f:	0f 44 f8             	cmove  %eax,%edi
+  800c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c17:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c1c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c1f:	89 fb                	mov    %edi,%ebx
+  800c21:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c24:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c27:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c2a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c2d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c30:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c33:	eb 67                	jmp    800c9c <strtol+0xcd>
+		s++;
+  800c35:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3d:	eb bc                	jmp    800bfb <strtol+0x2c>
+		s++, neg = 1;
+  800c3f:	83 c6 01             	add    $0x1,%esi
+  800c42:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800c47:	eb b2                	jmp    800bfb <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c49:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800c4d:	74 0e                	je     800c5d <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800c4f:	85 ff                	test   %edi,%edi
+  800c51:	75 bf                	jne    800c12 <strtol+0x43>
+		s++, base = 8;
+  800c53:	83 c6 01             	add    $0x1,%esi
+  800c56:	bf 08 00 00 00       	mov    $0x8,%edi
+  800c5b:	eb b5                	jmp    800c12 <strtol+0x43>
+		s += 2, base = 16;
+  800c5d:	83 c6 02             	add    $0x2,%esi
+  800c60:	bf 10 00 00 00       	mov    $0x10,%edi
+  800c65:	eb ab                	jmp    800c12 <strtol+0x43>
+			dig = *s - '0';
+  800c67:	0f be c9             	movsbl %cl,%ecx
+  800c6a:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800c6d:	39 f9                	cmp    %edi,%ecx
+  800c6f:	7d 59                	jge    800cca <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800c71:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800c75:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c78:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c7b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c7e:	0f af d8             	imul   %eax,%ebx
+  800c81:	0f af d7             	imul   %edi,%edx
+  800c84:	01 d3                	add    %edx,%ebx
+  800c86:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c89:	f7 e7                	mul    %edi
+  800c8b:	01 da                	add    %ebx,%edx
+  800c8d:	89 cb                	mov    %ecx,%ebx
+  800c8f:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c92:	01 c8                	add    %ecx,%eax
+  800c94:	11 da                	adc    %ebx,%edx
+  800c96:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c99:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c9f:	0f b6 08             	movzbl (%eax),%ecx
+  800ca2:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800ca5:	80 fb 09             	cmp    $0x9,%bl
+  800ca8:	76 bd                	jbe    800c67 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800caa:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800cad:	80 fb 19             	cmp    $0x19,%bl
+  800cb0:	77 08                	ja     800cba <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800cb2:	0f be c9             	movsbl %cl,%ecx
+  800cb5:	83 e9 57             	sub    $0x57,%ecx
+  800cb8:	eb b3                	jmp    800c6d <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cba:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800cbd:	80 fb 19             	cmp    $0x19,%bl
+  800cc0:	77 08                	ja     800cca <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800cc2:	0f be c9             	movsbl %cl,%ecx
+  800cc5:	83 e9 37             	sub    $0x37,%ecx
+  800cc8:	eb a3                	jmp    800c6d <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cca:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ccd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cd0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800cd3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cd6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cda:	74 05                	je     800ce1 <strtol+0x112>
+		*endptr = (char *) s;
+  800cdc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800cdf:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800ce1:	85 c9                	test   %ecx,%ecx
+  800ce3:	74 07                	je     800cec <strtol+0x11d>
+  800ce5:	f7 d8                	neg    %eax
+  800ce7:	83 d2 00             	adc    $0x0,%edx
+  800cea:	f7 da                	neg    %edx
+}
+  800cec:	83 c4 1c             	add    $0x1c,%esp
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+
+00800cf4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800cfa:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800d01:	74 18                	je     800d1b <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0e:	89 c3                	mov    %eax,%ebx
+  800d10:	89 c7                	mov    %eax,%edi
+  800d12:	89 c6                	mov    %eax,%esi
+  800d14:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d16:	5b                   	pop    %ebx
+  800d17:	5e                   	pop    %esi
+  800d18:	5f                   	pop    %edi
+  800d19:	5d                   	pop    %ebp
+  800d1a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d26:	89 c3                	mov    %eax,%ebx
+  800d28:	89 c7                	mov    %eax,%edi
+  800d2a:	55                   	push   %ebp
+  800d2b:	89 e5                	mov    %esp,%ebp
+  800d2d:	8d 35 35 0d 80 00    	lea    0x800d35,%esi
+  800d33:	0f 34                	sysenter
+  800d35:	5d                   	pop    %ebp
+		goto out;
+  800d36:	eb de                	jmp    800d16 <sys_cputs+0x22>
+
+00800d38 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d38:	55                   	push   %ebp
+  800d39:	89 e5                	mov    %esp,%ebp
+  800d3b:	57                   	push   %edi
+  800d3c:	56                   	push   %esi
+  800d3d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d3e:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800d45:	74 19                	je     800d60 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d51:	89 d1                	mov    %edx,%ecx
+  800d53:	89 d3                	mov    %edx,%ebx
+  800d55:	89 d7                	mov    %edx,%edi
+  800d57:	89 d6                	mov    %edx,%esi
+  800d59:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d5b:	5b                   	pop    %ebx
+  800d5c:	5e                   	pop    %esi
+  800d5d:	5f                   	pop    %edi
+  800d5e:	5d                   	pop    %ebp
+  800d5f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d60:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d65:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d6a:	89 d1                	mov    %edx,%ecx
+  800d6c:	89 d3                	mov    %edx,%ebx
+  800d6e:	89 d7                	mov    %edx,%edi
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	8d 35 7b 0d 80 00    	lea    0x800d7b,%esi
+  800d79:	0f 34                	sysenter
+  800d7b:	5d                   	pop    %ebp
+		goto out;
+  800d7c:	eb dd                	jmp    800d5b <sys_cgetc+0x23>
+
+00800d7e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d87:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800d8e:	74 21                	je     800db1 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800d90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d95:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9d:	89 cb                	mov    %ecx,%ebx
+  800d9f:	89 cf                	mov    %ecx,%edi
+  800da1:	89 ce                	mov    %ecx,%esi
+  800da3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da5:	85 c0                	test   %eax,%eax
+  800da7:	7f 27                	jg     800dd0 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db9:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dbe:	89 cb                	mov    %ecx,%ebx
+  800dc0:	89 cf                	mov    %ecx,%edi
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	8d 35 cd 0d 80 00    	lea    0x800dcd,%esi
+  800dcb:	0f 34                	sysenter
+  800dcd:	5d                   	pop    %ebp
+		goto out;
+  800dce:	eb d5                	jmp    800da5 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+  800dd3:	50                   	push   %eax
+  800dd4:	6a 03                	push   $0x3
+  800dd6:	68 eb 3f 80 00       	push   $0x803feb
+  800ddb:	6a 3f                	push   $0x3f
+  800ddd:	68 08 40 80 00       	push   $0x804008
+  800de2:	e8 71 f4 ff ff       	call   800258 <_panic>
+
+00800de7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ded:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800df4:	74 19                	je     800e0f <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800df6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e00:	89 d1                	mov    %edx,%ecx
+  800e02:	89 d3                	mov    %edx,%ebx
+  800e04:	89 d7                	mov    %edx,%edi
+  800e06:	89 d6                	mov    %edx,%esi
+  800e08:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e0a:	5b                   	pop    %ebx
+  800e0b:	5e                   	pop    %esi
+  800e0c:	5f                   	pop    %edi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e14:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e19:	89 d1                	mov    %edx,%ecx
+  800e1b:	89 d3                	mov    %edx,%ebx
+  800e1d:	89 d7                	mov    %edx,%edi
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	8d 35 2a 0e 80 00    	lea    0x800e2a,%esi
+  800e28:	0f 34                	sysenter
+  800e2a:	5d                   	pop    %ebp
+		goto out;
+  800e2b:	eb dd                	jmp    800e0a <sys_getenvid+0x23>
+
+00800e2d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	57                   	push   %edi
+  800e31:	56                   	push   %esi
+  800e32:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e33:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800e3a:	74 19                	je     800e55 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800e3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e41:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e46:	89 d1                	mov    %edx,%ecx
+  800e48:	89 d3                	mov    %edx,%ebx
+  800e4a:	89 d7                	mov    %edx,%edi
+  800e4c:	89 d6                	mov    %edx,%esi
+  800e4e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e50:	5b                   	pop    %ebx
+  800e51:	5e                   	pop    %esi
+  800e52:	5f                   	pop    %edi
+  800e53:	5d                   	pop    %ebp
+  800e54:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e5f:	89 d1                	mov    %edx,%ecx
+  800e61:	89 d3                	mov    %edx,%ebx
+  800e63:	89 d7                	mov    %edx,%edi
+  800e65:	55                   	push   %ebp
+  800e66:	89 e5                	mov    %esp,%ebp
+  800e68:	8d 35 70 0e 80 00    	lea    0x800e70,%esi
+  800e6e:	0f 34                	sysenter
+  800e70:	5d                   	pop    %ebp
+		goto out;
+  800e71:	eb dd                	jmp    800e50 <sys_yield+0x23>
+
+00800e73 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e7c:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800e83:	74 23                	je     800ea8 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800e85:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e98:	89 f7                	mov    %esi,%edi
+  800e9a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e9c:	85 c0                	test   %eax,%eax
+  800e9e:	7f 29                	jg     800ec9 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea3:	5b                   	pop    %ebx
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5f                   	pop    %edi
+  800ea6:	5d                   	pop    %ebp
+  800ea7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ea8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eae:	b8 04 00 00 00       	mov    $0x4,%eax
+  800eb3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebb:	55                   	push   %ebp
+  800ebc:	89 e5                	mov    %esp,%ebp
+  800ebe:	8d 35 c6 0e 80 00    	lea    0x800ec6,%esi
+  800ec4:	0f 34                	sysenter
+  800ec6:	5d                   	pop    %ebp
+		goto out;
+  800ec7:	eb d3                	jmp    800e9c <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ec9:	83 ec 0c             	sub    $0xc,%esp
+  800ecc:	50                   	push   %eax
+  800ecd:	6a 04                	push   $0x4
+  800ecf:	68 eb 3f 80 00       	push   $0x803feb
+  800ed4:	6a 3f                	push   $0x3f
+  800ed6:	68 08 40 80 00       	push   $0x804008
+  800edb:	e8 78 f3 ff ff       	call   800258 <_panic>
+
+00800ee0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ee0:	55                   	push   %ebp
+  800ee1:	89 e5                	mov    %esp,%ebp
+  800ee3:	57                   	push   %edi
+  800ee4:	56                   	push   %esi
+  800ee5:	53                   	push   %ebx
+  800ee6:	83 ec 0c             	sub    $0xc,%esp
+  800ee9:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800eec:	85 f6                	test   %esi,%esi
+  800eee:	75 09                	jne    800ef9 <sys_page_map+0x19>
+  800ef0:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800ef7:	74 1f                	je     800f18 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800ef9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f07:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0c:	85 c0                	test   %eax,%eax
+  800f0e:	7f 27                	jg     800f37 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5f                   	pop    %edi
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1e:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f26:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f29:	55                   	push   %ebp
+  800f2a:	89 e5                	mov    %esp,%ebp
+  800f2c:	8d 35 34 0f 80 00    	lea    0x800f34,%esi
+  800f32:	0f 34                	sysenter
+  800f34:	5d                   	pop    %ebp
+		goto out;
+  800f35:	eb d5                	jmp    800f0c <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  800f3a:	50                   	push   %eax
+  800f3b:	6a 05                	push   $0x5
+  800f3d:	68 eb 3f 80 00       	push   $0x803feb
+  800f42:	6a 3f                	push   $0x3f
+  800f44:	68 08 40 80 00       	push   $0x804008
+  800f49:	e8 0a f3 ff ff       	call   800258 <_panic>
+
+00800f4e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f4e:	55                   	push   %ebp
+  800f4f:	89 e5                	mov    %esp,%ebp
+  800f51:	57                   	push   %edi
+  800f52:	56                   	push   %esi
+  800f53:	53                   	push   %ebx
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f57:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800f5e:	74 22                	je     800f82 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800f60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f65:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f70:	89 df                	mov    %ebx,%edi
+  800f72:	89 de                	mov    %ebx,%esi
+  800f74:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f76:	85 c0                	test   %eax,%eax
+  800f78:	7f 28                	jg     800fa2 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7d:	5b                   	pop    %ebx
+  800f7e:	5e                   	pop    %esi
+  800f7f:	5f                   	pop    %edi
+  800f80:	5d                   	pop    %ebp
+  800f81:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f92:	89 df                	mov    %ebx,%edi
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	8d 35 9f 0f 80 00    	lea    0x800f9f,%esi
+  800f9d:	0f 34                	sysenter
+  800f9f:	5d                   	pop    %ebp
+		goto out;
+  800fa0:	eb d4                	jmp    800f76 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa2:	83 ec 0c             	sub    $0xc,%esp
+  800fa5:	50                   	push   %eax
+  800fa6:	6a 06                	push   $0x6
+  800fa8:	68 eb 3f 80 00       	push   $0x803feb
+  800fad:	6a 3f                	push   $0x3f
+  800faf:	68 08 40 80 00       	push   $0x804008
+  800fb4:	e8 9f f2 ff ff       	call   800258 <_panic>
+
+00800fb9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fb9:	55                   	push   %ebp
+  800fba:	89 e5                	mov    %esp,%ebp
+  800fbc:	57                   	push   %edi
+  800fbd:	56                   	push   %esi
+  800fbe:	53                   	push   %ebx
+  800fbf:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fc2:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800fc9:	74 22                	je     800fed <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800fcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd0:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdb:	89 df                	mov    %ebx,%edi
+  800fdd:	89 de                	mov    %ebx,%esi
+  800fdf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	7f 28                	jg     80100d <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fe5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe8:	5b                   	pop    %ebx
+  800fe9:	5e                   	pop    %esi
+  800fea:	5f                   	pop    %edi
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ffd:	89 df                	mov    %ebx,%edi
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	8d 35 0a 10 80 00    	lea    0x80100a,%esi
+  801008:	0f 34                	sysenter
+  80100a:	5d                   	pop    %ebp
+		goto out;
+  80100b:	eb d4                	jmp    800fe1 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100d:	83 ec 0c             	sub    $0xc,%esp
+  801010:	50                   	push   %eax
+  801011:	6a 08                	push   $0x8
+  801013:	68 eb 3f 80 00       	push   $0x803feb
+  801018:	6a 3f                	push   $0x3f
+  80101a:	68 08 40 80 00       	push   $0x804008
+  80101f:	e8 34 f2 ff ff       	call   800258 <_panic>
+
+00801024 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	57                   	push   %edi
+  801028:	56                   	push   %esi
+  801029:	53                   	push   %ebx
+  80102a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80102d:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801034:	74 22                	je     801058 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801036:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801040:	8b 55 08             	mov    0x8(%ebp),%edx
+  801043:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801046:	89 df                	mov    %ebx,%edi
+  801048:	89 de                	mov    %ebx,%esi
+  80104a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80104c:	85 c0                	test   %eax,%eax
+  80104e:	7f 28                	jg     801078 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801050:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801058:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801060:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801063:	b8 09 00 00 00       	mov    $0x9,%eax
+  801068:	89 df                	mov    %ebx,%edi
+  80106a:	55                   	push   %ebp
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	8d 35 75 10 80 00    	lea    0x801075,%esi
+  801073:	0f 34                	sysenter
+  801075:	5d                   	pop    %ebp
+		goto out;
+  801076:	eb d4                	jmp    80104c <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801078:	83 ec 0c             	sub    $0xc,%esp
+  80107b:	50                   	push   %eax
+  80107c:	6a 09                	push   $0x9
+  80107e:	68 eb 3f 80 00       	push   $0x803feb
+  801083:	6a 3f                	push   $0x3f
+  801085:	68 08 40 80 00       	push   $0x804008
+  80108a:	e8 c9 f1 ff ff       	call   800258 <_panic>
+
+0080108f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	57                   	push   %edi
+  801093:	56                   	push   %esi
+  801094:	53                   	push   %ebx
+  801095:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801098:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80109f:	74 22                	je     8010c3 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  8010a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b1:	89 df                	mov    %ebx,%edi
+  8010b3:	89 de                	mov    %ebx,%esi
+  8010b5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b7:	85 c0                	test   %eax,%eax
+  8010b9:	7f 28                	jg     8010e3 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8010bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010be:	5b                   	pop    %ebx
+  8010bf:	5e                   	pop    %esi
+  8010c0:	5f                   	pop    %edi
+  8010c1:	5d                   	pop    %ebp
+  8010c2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ce:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010d3:	89 df                	mov    %ebx,%edi
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	8d 35 e0 10 80 00    	lea    0x8010e0,%esi
+  8010de:	0f 34                	sysenter
+  8010e0:	5d                   	pop    %ebp
+		goto out;
+  8010e1:	eb d4                	jmp    8010b7 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e3:	83 ec 0c             	sub    $0xc,%esp
+  8010e6:	50                   	push   %eax
+  8010e7:	6a 0a                	push   $0xa
+  8010e9:	68 eb 3f 80 00       	push   $0x803feb
+  8010ee:	6a 3f                	push   $0x3f
+  8010f0:	68 08 40 80 00       	push   $0x804008
+  8010f5:	e8 5e f1 ff ff       	call   800258 <_panic>
+
+008010fa <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	53                   	push   %ebx
+  801100:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801103:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80110a:	74 22                	je     80112e <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80110c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801111:	b8 17 00 00 00       	mov    $0x17,%eax
+  801116:	8b 55 08             	mov    0x8(%ebp),%edx
+  801119:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111c:	89 df                	mov    %ebx,%edi
+  80111e:	89 de                	mov    %ebx,%esi
+  801120:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801122:	85 c0                	test   %eax,%eax
+  801124:	7f 28                	jg     80114e <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801129:	5b                   	pop    %ebx
+  80112a:	5e                   	pop    %esi
+  80112b:	5f                   	pop    %edi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80112e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801133:	8b 55 08             	mov    0x8(%ebp),%edx
+  801136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801139:	b8 17 00 00 00       	mov    $0x17,%eax
+  80113e:	89 df                	mov    %ebx,%edi
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	8d 35 4b 11 80 00    	lea    0x80114b,%esi
+  801149:	0f 34                	sysenter
+  80114b:	5d                   	pop    %ebp
+		goto out;
+  80114c:	eb d4                	jmp    801122 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114e:	83 ec 0c             	sub    $0xc,%esp
+  801151:	50                   	push   %eax
+  801152:	6a 17                	push   $0x17
+  801154:	68 eb 3f 80 00       	push   $0x803feb
+  801159:	6a 3f                	push   $0x3f
+  80115b:	68 08 40 80 00       	push   $0x804008
+  801160:	e8 f3 f0 ff ff       	call   800258 <_panic>
+
+00801165 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  801168:	57                   	push   %edi
+  801169:	56                   	push   %esi
+  80116a:	53                   	push   %ebx
+  80116b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80116e:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801175:	74 22                	je     801199 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801177:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801181:	8b 55 08             	mov    0x8(%ebp),%edx
+  801184:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801187:	89 df                	mov    %ebx,%edi
+  801189:	89 de                	mov    %ebx,%esi
+  80118b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	7f 28                	jg     8011b9 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801191:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801194:	5b                   	pop    %ebx
+  801195:	5e                   	pop    %esi
+  801196:	5f                   	pop    %edi
+  801197:	5d                   	pop    %ebp
+  801198:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801199:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a4:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011a9:	89 df                	mov    %ebx,%edi
+  8011ab:	55                   	push   %ebp
+  8011ac:	89 e5                	mov    %esp,%ebp
+  8011ae:	8d 35 b6 11 80 00    	lea    0x8011b6,%esi
+  8011b4:	0f 34                	sysenter
+  8011b6:	5d                   	pop    %ebp
+		goto out;
+  8011b7:	eb d4                	jmp    80118d <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b9:	83 ec 0c             	sub    $0xc,%esp
+  8011bc:	50                   	push   %eax
+  8011bd:	6a 18                	push   $0x18
+  8011bf:	68 eb 3f 80 00       	push   $0x803feb
+  8011c4:	6a 3f                	push   $0x3f
+  8011c6:	68 08 40 80 00       	push   $0x804008
+  8011cb:	e8 88 f0 ff ff       	call   800258 <_panic>
+
+008011d0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	57                   	push   %edi
+  8011d4:	56                   	push   %esi
+  8011d5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011d6:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8011dd:	74 1d                	je     8011fc <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8011df:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011f5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011f7:	5b                   	pop    %ebx
+  8011f8:	5e                   	pop    %esi
+  8011f9:	5f                   	pop    %edi
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801202:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801207:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80120d:	55                   	push   %ebp
+  80120e:	89 e5                	mov    %esp,%ebp
+  801210:	8d 35 18 12 80 00    	lea    0x801218,%esi
+  801216:	0f 34                	sysenter
+  801218:	5d                   	pop    %ebp
+		goto out;
+  801219:	eb dc                	jmp    8011f7 <sys_ipc_try_send+0x27>
+
+0080121b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	57                   	push   %edi
+  80121f:	56                   	push   %esi
+  801220:	53                   	push   %ebx
+  801221:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801224:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80122b:	74 21                	je     80124e <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80122d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801232:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	89 cb                	mov    %ecx,%ebx
+  80123c:	89 cf                	mov    %ecx,%edi
+  80123e:	89 ce                	mov    %ecx,%esi
+  801240:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801242:	85 c0                	test   %eax,%eax
+  801244:	7f 27                	jg     80126d <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801249:	5b                   	pop    %ebx
+  80124a:	5e                   	pop    %esi
+  80124b:	5f                   	pop    %edi
+  80124c:	5d                   	pop    %ebp
+  80124d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80124e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801251:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801256:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80125b:	89 cb                	mov    %ecx,%ebx
+  80125d:	89 cf                	mov    %ecx,%edi
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	8d 35 6a 12 80 00    	lea    0x80126a,%esi
+  801268:	0f 34                	sysenter
+  80126a:	5d                   	pop    %ebp
+		goto out;
+  80126b:	eb d5                	jmp    801242 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126d:	83 ec 0c             	sub    $0xc,%esp
+  801270:	50                   	push   %eax
+  801271:	6a 0d                	push   $0xd
+  801273:	68 eb 3f 80 00       	push   $0x803feb
+  801278:	6a 3f                	push   $0x3f
+  80127a:	68 08 40 80 00       	push   $0x804008
+  80127f:	e8 d4 ef ff ff       	call   800258 <_panic>
+
+00801284 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	57                   	push   %edi
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80128a:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801291:	74 1b                	je     8012ae <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801293:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801298:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80129d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a3:	89 df                	mov    %ebx,%edi
+  8012a5:	89 de                	mov    %ebx,%esi
+  8012a7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5f                   	pop    %edi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012be:	89 df                	mov    %ebx,%edi
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	8d 35 cb 12 80 00    	lea    0x8012cb,%esi
+  8012c9:	0f 34                	sysenter
+  8012cb:	5d                   	pop    %ebp
+		goto out;
+  8012cc:	eb db                	jmp    8012a9 <sys_ipc_recv_until+0x25>
+
+008012ce <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	57                   	push   %edi
+  8012d2:	56                   	push   %esi
+  8012d3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012d4:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8012db:	74 19                	je     8012f6 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8012dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e7:	89 d1                	mov    %edx,%ecx
+  8012e9:	89 d3                	mov    %edx,%ebx
+  8012eb:	89 d7                	mov    %edx,%edi
+  8012ed:	89 d6                	mov    %edx,%esi
+  8012ef:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012f1:	5b                   	pop    %ebx
+  8012f2:	5e                   	pop    %esi
+  8012f3:	5f                   	pop    %edi
+  8012f4:	5d                   	pop    %ebp
+  8012f5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801300:	89 d1                	mov    %edx,%ecx
+  801302:	89 d3                	mov    %edx,%ebx
+  801304:	89 d7                	mov    %edx,%edi
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	8d 35 11 13 80 00    	lea    0x801311,%esi
+  80130f:	0f 34                	sysenter
+  801311:	5d                   	pop    %ebp
+		goto out;
+  801312:	eb dd                	jmp    8012f1 <sys_time_msec+0x23>
+
+00801314 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	57                   	push   %edi
+  801318:	56                   	push   %esi
+  801319:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80131a:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801321:	74 1a                	je     80133d <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801323:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801328:	b8 10 00 00 00       	mov    $0x10,%eax
+  80132d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801330:	89 cb                	mov    %ecx,%ebx
+  801332:	89 cf                	mov    %ecx,%edi
+  801334:	89 ce                	mov    %ecx,%esi
+  801336:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801338:	5b                   	pop    %ebx
+  801339:	5e                   	pop    %esi
+  80133a:	5f                   	pop    %edi
+  80133b:	5d                   	pop    %ebp
+  80133c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80133d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801340:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801345:	b8 10 00 00 00       	mov    $0x10,%eax
+  80134a:	89 cb                	mov    %ecx,%ebx
+  80134c:	89 cf                	mov    %ecx,%edi
+  80134e:	55                   	push   %ebp
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	8d 35 59 13 80 00    	lea    0x801359,%esi
+  801357:	0f 34                	sysenter
+  801359:	5d                   	pop    %ebp
+		goto out;
+  80135a:	eb dc                	jmp    801338 <sys_sleep_until+0x24>
+
+0080135c <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	57                   	push   %edi
+  801360:	56                   	push   %esi
+  801361:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801362:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801369:	74 1a                	je     801385 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80136b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801370:	b8 11 00 00 00       	mov    $0x11,%eax
+  801375:	8b 55 08             	mov    0x8(%ebp),%edx
+  801378:	89 cb                	mov    %ecx,%ebx
+  80137a:	89 cf                	mov    %ecx,%edi
+  80137c:	89 ce                	mov    %ecx,%esi
+  80137e:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801380:	5b                   	pop    %ebx
+  801381:	5e                   	pop    %esi
+  801382:	5f                   	pop    %edi
+  801383:	5d                   	pop    %ebp
+  801384:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801385:	8b 55 08             	mov    0x8(%ebp),%edx
+  801388:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80138d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801392:	89 cb                	mov    %ecx,%ebx
+  801394:	89 cf                	mov    %ecx,%edi
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	8d 35 a1 13 80 00    	lea    0x8013a1,%esi
+  80139f:	0f 34                	sysenter
+  8013a1:	5d                   	pop    %ebp
+		goto out;
+  8013a2:	eb dc                	jmp    801380 <sys_env_print_stats+0x24>
+
+008013a4 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+  8013a7:	57                   	push   %edi
+  8013a8:	56                   	push   %esi
+  8013a9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013aa:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8013b1:	74 1b                	je     8013ce <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8013b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b8:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c3:	89 df                	mov    %ebx,%edi
+  8013c5:	89 de                	mov    %ebx,%esi
+  8013c7:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8013c9:	5b                   	pop    %ebx
+  8013ca:	5e                   	pop    %esi
+  8013cb:	5f                   	pop    %edi
+  8013cc:	5d                   	pop    %ebp
+  8013cd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013de:	89 df                	mov    %ebx,%edi
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	8d 35 eb 13 80 00    	lea    0x8013eb,%esi
+  8013e9:	0f 34                	sysenter
+  8013eb:	5d                   	pop    %ebp
+		goto out;
+  8013ec:	eb db                	jmp    8013c9 <sys_perf+0x25>
+
+008013ee <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	57                   	push   %edi
+  8013f2:	56                   	push   %esi
+  8013f3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013f4:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8013fb:	74 19                	je     801416 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8013fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801402:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801407:	89 d1                	mov    %edx,%ecx
+  801409:	89 d3                	mov    %edx,%ebx
+  80140b:	89 d7                	mov    %edx,%edi
+  80140d:	89 d6                	mov    %edx,%esi
+  80140f:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801411:	5b                   	pop    %ebx
+  801412:	5e                   	pop    %esi
+  801413:	5f                   	pop    %edi
+  801414:	5d                   	pop    %ebp
+  801415:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801416:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801420:	89 d1                	mov    %edx,%ecx
+  801422:	89 d3                	mov    %edx,%ebx
+  801424:	89 d7                	mov    %edx,%edi
+  801426:	55                   	push   %ebp
+  801427:	89 e5                	mov    %esp,%ebp
+  801429:	8d 35 31 14 80 00    	lea    0x801431,%esi
+  80142f:	0f 34                	sysenter
+  801431:	5d                   	pop    %ebp
+		goto out;
+  801432:	eb dd                	jmp    801411 <sys_fork+0x23>
+
+00801434 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801434:	55                   	push   %ebp
+  801435:	89 e5                	mov    %esp,%ebp
+  801437:	57                   	push   %edi
+  801438:	56                   	push   %esi
+  801439:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80143a:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801441:	74 1c                	je     80145f <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801443:	be 00 00 00 00       	mov    $0x0,%esi
+  801448:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80144d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801450:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801453:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801456:	89 f7                	mov    %esi,%edi
+  801458:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80145a:	5b                   	pop    %ebx
+  80145b:	5e                   	pop    %esi
+  80145c:	5f                   	pop    %edi
+  80145d:	5d                   	pop    %ebp
+  80145e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80145f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801462:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801465:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80146a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80146f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801472:	55                   	push   %ebp
+  801473:	89 e5                	mov    %esp,%ebp
+  801475:	8d 35 7d 14 80 00    	lea    0x80147d,%esi
+  80147b:	0f 34                	sysenter
+  80147d:	5d                   	pop    %ebp
+		goto out;
+  80147e:	eb da                	jmp    80145a <sys_thread_create+0x26>
+
+00801480 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801480:	55                   	push   %ebp
+  801481:	89 e5                	mov    %esp,%ebp
+  801483:	57                   	push   %edi
+  801484:	56                   	push   %esi
+  801485:	53                   	push   %ebx
+  801486:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801489:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801490:	74 24                	je     8014b6 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801492:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801497:	be 00 00 00 00       	mov    $0x0,%esi
+  80149c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014a8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014aa:	85 c0                	test   %eax,%eax
+  8014ac:	7f 27                	jg     8014d5 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8014ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b1:	5b                   	pop    %ebx
+  8014b2:	5e                   	pop    %esi
+  8014b3:	5f                   	pop    %edi
+  8014b4:	5d                   	pop    %ebp
+  8014b5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014bc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014c4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014c7:	55                   	push   %ebp
+  8014c8:	89 e5                	mov    %esp,%ebp
+  8014ca:	8d 35 d2 14 80 00    	lea    0x8014d2,%esi
+  8014d0:	0f 34                	sysenter
+  8014d2:	5d                   	pop    %ebp
+		goto out;
+  8014d3:	eb d5                	jmp    8014aa <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014d5:	83 ec 0c             	sub    $0xc,%esp
+  8014d8:	50                   	push   %eax
+  8014d9:	6a 1f                	push   $0x1f
+  8014db:	68 eb 3f 80 00       	push   $0x803feb
+  8014e0:	6a 3f                	push   $0x3f
+  8014e2:	68 08 40 80 00       	push   $0x804008
+  8014e7:	e8 6c ed ff ff       	call   800258 <_panic>
+
+008014ec <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8014ec:	55                   	push   %ebp
+  8014ed:	89 e5                	mov    %esp,%ebp
+  8014ef:	57                   	push   %edi
+  8014f0:	56                   	push   %esi
+  8014f1:	53                   	push   %ebx
+  8014f2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014f5:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8014fc:	74 23                	je     801521 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8014fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801503:	b8 20 00 00 00       	mov    $0x20,%eax
+  801508:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801511:	89 f7                	mov    %esi,%edi
+  801513:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801515:	85 c0                	test   %eax,%eax
+  801517:	7f 29                	jg     801542 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80151c:	5b                   	pop    %ebx
+  80151d:	5e                   	pop    %esi
+  80151e:	5f                   	pop    %edi
+  80151f:	5d                   	pop    %ebp
+  801520:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801521:	8b 55 08             	mov    0x8(%ebp),%edx
+  801524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801527:	b8 20 00 00 00       	mov    $0x20,%eax
+  80152c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801531:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801534:	55                   	push   %ebp
+  801535:	89 e5                	mov    %esp,%ebp
+  801537:	8d 35 3f 15 80 00    	lea    0x80153f,%esi
+  80153d:	0f 34                	sysenter
+  80153f:	5d                   	pop    %ebp
+		goto out;
+  801540:	eb d3                	jmp    801515 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801542:	83 ec 0c             	sub    $0xc,%esp
+  801545:	50                   	push   %eax
+  801546:	6a 20                	push   $0x20
+  801548:	68 eb 3f 80 00       	push   $0x803feb
+  80154d:	6a 3f                	push   $0x3f
+  80154f:	68 08 40 80 00       	push   $0x804008
+  801554:	e8 ff ec ff ff       	call   800258 <_panic>
+
+00801559 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  801559:	55                   	push   %ebp
+  80155a:	89 e5                	mov    %esp,%ebp
+  80155c:	57                   	push   %edi
+  80155d:	56                   	push   %esi
+  80155e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80155f:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801566:	74 1b                	je     801583 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801568:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801572:	8b 55 08             	mov    0x8(%ebp),%edx
+  801575:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801578:	89 df                	mov    %ebx,%edi
+  80157a:	89 de                	mov    %ebx,%esi
+  80157c:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80157e:	5b                   	pop    %ebx
+  80157f:	5e                   	pop    %esi
+  801580:	5f                   	pop    %edi
+  801581:	5d                   	pop    %ebp
+  801582:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801583:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801588:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80158e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801593:	89 df                	mov    %ebx,%edi
+  801595:	55                   	push   %ebp
+  801596:	89 e5                	mov    %esp,%ebp
+  801598:	8d 35 a0 15 80 00    	lea    0x8015a0,%esi
+  80159e:	0f 34                	sysenter
+  8015a0:	5d                   	pop    %ebp
+		goto out;
+  8015a1:	eb db                	jmp    80157e <sys_batch+0x25>
+
+008015a3 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  8015a3:	55                   	push   %ebp
+  8015a4:	89 e5                	mov    %esp,%ebp
+  8015a6:	57                   	push   %edi
+  8015a7:	56                   	push   %esi
+  8015a8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015a9:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8015b0:	74 1a                	je     8015cc <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8015b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015bf:	89 cb                	mov    %ecx,%ebx
+  8015c1:	89 cf                	mov    %ecx,%edi
+  8015c3:	89 ce                	mov    %ecx,%esi
+  8015c5:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8015c7:	5b                   	pop    %ebx
+  8015c8:	5e                   	pop    %esi
+  8015c9:	5f                   	pop    %edi
+  8015ca:	5d                   	pop    %ebp
+  8015cb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015d9:	89 cb                	mov    %ecx,%ebx
+  8015db:	89 cf                	mov    %ecx,%edi
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	8d 35 e8 15 80 00    	lea    0x8015e8,%esi
+  8015e6:	0f 34                	sysenter
+  8015e8:	5d                   	pop    %ebp
+		goto out;
+  8015e9:	eb dc                	jmp    8015c7 <sys_trace_ctl+0x24>
+
+008015eb <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	57                   	push   %edi
+  8015ef:	56                   	push   %esi
+  8015f0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015f1:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8015f8:	74 1c                	je     801616 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8015fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ff:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801604:	8b 55 08             	mov    0x8(%ebp),%edx
+  801607:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80160a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80160d:	89 f7                	mov    %esi,%edi
+  80160f:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801611:	5b                   	pop    %ebx
+  801612:	5e                   	pop    %esi
+  801613:	5f                   	pop    %edi
+  801614:	5d                   	pop    %ebp
+  801615:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801616:	8b 55 08             	mov    0x8(%ebp),%edx
+  801619:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801621:	bf 00 00 00 00       	mov    $0x0,%edi
+  801626:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	8d 35 34 16 80 00    	lea    0x801634,%esi
+  801632:	0f 34                	sysenter
+  801634:	5d                   	pop    %ebp
+		goto out;
+  801635:	eb da                	jmp    801611 <sys_trace_read+0x26>
+
+00801637 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801637:	55                   	push   %ebp
+  801638:	89 e5                	mov    %esp,%ebp
+  80163a:	57                   	push   %edi
+  80163b:	56                   	push   %esi
+  80163c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80163d:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801644:	74 1c                	je     801662 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801646:	be 00 00 00 00       	mov    $0x0,%esi
+  80164b:	b8 21 00 00 00       	mov    $0x21,%eax
+  801650:	8b 55 08             	mov    0x8(%ebp),%edx
+  801653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801656:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801659:	89 f7                	mov    %esi,%edi
+  80165b:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80165d:	5b                   	pop    %ebx
+  80165e:	5e                   	pop    %esi
+  80165f:	5f                   	pop    %edi
+  801660:	5d                   	pop    %ebp
+  801661:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801662:	8b 55 08             	mov    0x8(%ebp),%edx
+  801665:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801668:	b8 21 00 00 00       	mov    $0x21,%eax
+  80166d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801672:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801675:	55                   	push   %ebp
+  801676:	89 e5                	mov    %esp,%ebp
+  801678:	8d 35 80 16 80 00    	lea    0x801680,%esi
+  80167e:	0f 34                	sysenter
+  801680:	5d                   	pop    %ebp
+		goto out;
+  801681:	eb da                	jmp    80165d <sys_meminfo+0x26>
+
+00801683 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801683:	55                   	push   %ebp
+  801684:	89 e5                	mov    %esp,%ebp
+  801686:	57                   	push   %edi
+  801687:	56                   	push   %esi
+  801688:	53                   	push   %ebx
+  801689:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80168c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801690:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801697:	74 1f                	je     8016b8 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801699:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169e:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a6:	89 df                	mov    %ebx,%edi
+  8016a8:	89 de                	mov    %ebx,%esi
+  8016aa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	7f 25                	jg     8016d5 <sys_env_set_ksm+0x52>
+}
+  8016b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b3:	5b                   	pop    %ebx
+  8016b4:	5e                   	pop    %esi
+  8016b5:	5f                   	pop    %edi
+  8016b6:	5d                   	pop    %ebp
+  8016b7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c0:	b8 22 00 00 00       	mov    $0x22,%eax
+  8016c5:	89 df                	mov    %ebx,%edi
+  8016c7:	55                   	push   %ebp
+  8016c8:	89 e5                	mov    %esp,%ebp
+  8016ca:	8d 35 d2 16 80 00    	lea    0x8016d2,%esi
+  8016d0:	0f 34                	sysenter
+  8016d2:	5d                   	pop    %ebp
+		goto out;
+  8016d3:	eb d7                	jmp    8016ac <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016d5:	83 ec 0c             	sub    $0xc,%esp
+  8016d8:	50                   	push   %eax
+  8016d9:	6a 22                	push   $0x22
+  8016db:	68 eb 3f 80 00       	push   $0x803feb
+  8016e0:	6a 3f                	push   $0x3f
+  8016e2:	68 08 40 80 00       	push   $0x804008
+  8016e7:	e8 6c eb ff ff       	call   800258 <_panic>
+
+008016ec <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8016ec:	55                   	push   %ebp
+  8016ed:	89 e5                	mov    %esp,%ebp
+  8016ef:	57                   	push   %edi
+  8016f0:	56                   	push   %esi
+  8016f1:	53                   	push   %ebx
+  8016f2:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8016f5:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8016f8:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8016ff:	74 24                	je     801725 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801701:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801706:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80170b:	89 cb                	mov    %ecx,%ebx
+  80170d:	89 cf                	mov    %ecx,%edi
+  80170f:	89 ce                	mov    %ecx,%esi
+  801711:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801713:	85 c0                	test   %eax,%eax
+  801715:	7f 2a                	jg     801741 <sys_time_nsec+0x55>
+	return ns;
+}
+  801717:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80171a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80171d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5f                   	pop    %edi
+  801723:	5d                   	pop    %ebp
+  801724:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801725:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80172a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80172f:	89 cb                	mov    %ecx,%ebx
+  801731:	89 cf                	mov    %ecx,%edi
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	8d 35 3e 17 80 00    	lea    0x80173e,%esi
+  80173c:	0f 34                	sysenter
+  80173e:	5d                   	pop    %ebp
+		goto out;
+  80173f:	eb d2                	jmp    801713 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801741:	83 ec 0c             	sub    $0xc,%esp
+  801744:	50                   	push   %eax
+  801745:	6a 0f                	push   $0xf
+  801747:	68 eb 3f 80 00       	push   $0x803feb
+  80174c:	6a 3f                	push   $0x3f
+  80174e:	68 08 40 80 00       	push   $0x804008
+  801753:	e8 00 eb ff ff       	call   800258 <_panic>
+
+00801758 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801758:	55                   	push   %ebp
+  801759:	89 e5                	mov    %esp,%ebp
+  80175b:	57                   	push   %edi
+  80175c:	56                   	push   %esi
+  80175d:	53                   	push   %ebx
+  80175e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801761:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801768:	74 22                	je     80178c <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80176a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176f:	b8 12 00 00 00       	mov    $0x12,%eax
+  801774:	8b 55 08             	mov    0x8(%ebp),%edx
+  801777:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80177a:	89 df                	mov    %ebx,%edi
+  80177c:	89 de                	mov    %ebx,%esi
+  80177e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801780:	85 c0                	test   %eax,%eax
+  801782:	7f 28                	jg     8017ac <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801787:	5b                   	pop    %ebx
+  801788:	5e                   	pop    %esi
+  801789:	5f                   	pop    %edi
+  80178a:	5d                   	pop    %ebp
+  80178b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80178c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801791:	8b 55 08             	mov    0x8(%ebp),%edx
+  801794:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801797:	b8 12 00 00 00       	mov    $0x12,%eax
+  80179c:	89 df                	mov    %ebx,%edi
+  80179e:	55                   	push   %ebp
+  80179f:	89 e5                	mov    %esp,%ebp
+  8017a1:	8d 35 a9 17 80 00    	lea    0x8017a9,%esi
+  8017a7:	0f 34                	sysenter
+  8017a9:	5d                   	pop    %ebp
+		goto out;
+  8017aa:	eb d4                	jmp    801780 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017ac:	83 ec 0c             	sub    $0xc,%esp
+  8017af:	50                   	push   %eax
+  8017b0:	6a 12                	push   $0x12
+  8017b2:	68 eb 3f 80 00       	push   $0x803feb
+  8017b7:	6a 3f                	push   $0x3f
+  8017b9:	68 08 40 80 00       	push   $0x804008
+  8017be:	e8 95 ea ff ff       	call   800258 <_panic>
+
+008017c3 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8017c3:	55                   	push   %ebp
+  8017c4:	89 e5                	mov    %esp,%ebp
+  8017c6:	57                   	push   %edi
+  8017c7:	56                   	push   %esi
+  8017c8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017c9:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8017d0:	74 1b                	je     8017ed <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8017d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e2:	89 df                	mov    %ebx,%edi
+  8017e4:	89 de                	mov    %ebx,%esi
+  8017e6:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8017e8:	5b                   	pop    %ebx
+  8017e9:	5e                   	pop    %esi
+  8017ea:	5f                   	pop    %edi
+  8017eb:	5d                   	pop    %ebp
+  8017ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f8:	b8 13 00 00 00       	mov    $0x13,%eax
+  8017fd:	89 df                	mov    %ebx,%edi
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	8d 35 0a 18 80 00    	lea    0x80180a,%esi
+  801808:	0f 34                	sysenter
+  80180a:	5d                   	pop    %ebp
+		goto out;
+  80180b:	eb db                	jmp    8017e8 <sys_e1000_receive+0x25>
+
+0080180d <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	57                   	push   %edi
+  801811:	56                   	push   %esi
+  801812:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801813:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80181a:	74 1b                	je     801837 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80181c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801821:	b8 14 00 00 00       	mov    $0x14,%eax
+  801826:	8b 55 08             	mov    0x8(%ebp),%edx
+  801829:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80182c:	89 df                	mov    %ebx,%edi
+  80182e:	89 de                	mov    %ebx,%esi
+  801830:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801832:	5b                   	pop    %ebx
+  801833:	5e                   	pop    %esi
+  801834:	5f                   	pop    %edi
+  801835:	5d                   	pop    %ebp
+  801836:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801837:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801842:	b8 14 00 00 00       	mov    $0x14,%eax
+  801847:	89 df                	mov    %ebx,%edi
+  801849:	55                   	push   %ebp
+  80184a:	89 e5                	mov    %esp,%ebp
+  80184c:	8d 35 54 18 80 00    	lea    0x801854,%esi
+  801852:	0f 34                	sysenter
+  801854:	5d                   	pop    %ebp
+		goto out;
+  801855:	eb db                	jmp    801832 <sys_e1000_read_hwaddr+0x25>
+
+00801857 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	57                   	push   %edi
+  80185b:	56                   	push   %esi
+  80185c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80185d:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801864:	74 1a                	je     801880 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801866:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80186b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801870:	8b 55 08             	mov    0x8(%ebp),%edx
+  801873:	89 cb                	mov    %ecx,%ebx
+  801875:	89 cf                	mov    %ecx,%edi
+  801877:	89 ce                	mov    %ecx,%esi
+  801879:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  80187b:	5b                   	pop    %ebx
+  80187c:	5e                   	pop    %esi
+  80187d:	5f                   	pop    %edi
+  80187e:	5d                   	pop    %ebp
+  80187f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801880:	8b 55 08             	mov    0x8(%ebp),%edx
+  801883:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801888:	b8 15 00 00 00       	mov    $0x15,%eax
+  80188d:	89 cb                	mov    %ecx,%ebx
+  80188f:	89 cf                	mov    %ecx,%edi
+  801891:	55                   	push   %ebp
+  801892:	89 e5                	mov    %esp,%ebp
+  801894:	8d 35 9c 18 80 00    	lea    0x80189c,%esi
+  80189a:	0f 34                	sysenter
+  80189c:	5d                   	pop    %ebp
+		goto out;
+  80189d:	eb dc                	jmp    80187b <sys_sb16_read_version+0x24>
+
+0080189f <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80189f:	55                   	push   %ebp
+  8018a0:	89 e5                	mov    %esp,%ebp
+  8018a2:	57                   	push   %edi
+  8018a3:	56                   	push   %esi
+  8018a4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018a5:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8018ac:	74 1b                	je     8018c9 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8018ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018be:	89 df                	mov    %ebx,%edi
+  8018c0:	89 de                	mov    %ebx,%esi
+  8018c2:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8018c4:	5b                   	pop    %ebx
+  8018c5:	5e                   	pop    %esi
+  8018c6:	5f                   	pop    %edi
+  8018c7:	5d                   	pop    %ebp
+  8018c8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018d4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018d9:	89 df                	mov    %ebx,%edi
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	8d 35 e6 18 80 00    	lea    0x8018e6,%esi
+  8018e4:	0f 34                	sysenter
+  8018e6:	5d                   	pop    %ebp
+		goto out;
+  8018e7:	eb db                	jmp    8018c4 <sys_sb16_play+0x25>
+
+008018e9 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  8018e9:	55                   	push   %ebp
+  8018ea:	89 e5                	mov    %esp,%ebp
+  8018ec:	53                   	push   %ebx
+  8018ed:	83 ec 04             	sub    $0x4,%esp
+  8018f0:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8018f2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018f9:	f6 c4 04             	test   $0x4,%ah
+  8018fc:	74 0c                	je     80190a <dupperm+0x21>
+  8018fe:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801905:	f6 c4 08             	test   $0x8,%ah
+  801908:	75 62                	jne    80196c <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80190a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801911:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801916:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  80191c:	74 19                	je     801937 <dupperm+0x4e>
+  80191e:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801925:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  80192a:	83 f8 01             	cmp    $0x1,%eax
+  80192d:	19 c0                	sbb    %eax,%eax
+  80192f:	25 00 08 00 00       	and    $0x800,%eax
+  801934:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801937:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  80193e:	89 c1                	mov    %eax,%ecx
+  801940:	80 cd 04             	or     $0x4,%ch
+  801943:	f6 c7 04             	test   $0x4,%bh
+  801946:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801949:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801950:	f6 c1 02             	test   $0x2,%cl
+  801953:	74 12                	je     801967 <dupperm+0x7e>
+  801955:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  80195c:	89 c2                	mov    %eax,%edx
+  80195e:	83 ca 02             	or     $0x2,%edx
+  801961:	f6 c5 04             	test   $0x4,%ch
+  801964:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801967:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80196a:	c9                   	leave
+  80196b:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  80196c:	68 18 40 80 00       	push   $0x804018
+  801971:	68 b0 40 80 00       	push   $0x8040b0
+  801976:	6a 39                	push   $0x39
+  801978:	68 c5 40 80 00       	push   $0x8040c5
+  80197d:	e8 d6 e8 ff ff       	call   800258 <_panic>
+
+00801982 <pgfault>:
+{
+  801982:	55                   	push   %ebp
+  801983:	89 e5                	mov    %esp,%ebp
+  801985:	53                   	push   %ebx
+  801986:	83 ec 04             	sub    $0x4,%esp
+  801989:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  80198c:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  80198e:	89 c3                	mov    %eax,%ebx
+  801990:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801996:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  80199a:	74 6d                	je     801a09 <pgfault+0x87>
+  80199c:	89 da                	mov    %ebx,%edx
+  80199e:	c1 ea 16             	shr    $0x16,%edx
+  8019a1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019a8:	f6 c2 80             	test   $0x80,%dl
+  8019ab:	75 5c                	jne    801a09 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  8019ad:	c1 e8 0c             	shr    $0xc,%eax
+  8019b0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019b7:	f6 c4 08             	test   $0x8,%ah
+  8019ba:	74 4d                	je     801a09 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8019bc:	83 ec 04             	sub    $0x4,%esp
+  8019bf:	6a 07                	push   $0x7
+  8019c1:	68 00 f0 7f 00       	push   $0x7ff000
+  8019c6:	6a 00                	push   $0x0
+  8019c8:	e8 a6 f4 ff ff       	call   800e73 <sys_page_alloc>
+  8019cd:	83 c4 10             	add    $0x10,%esp
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	78 49                	js     801a1d <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8019d4:	83 ec 04             	sub    $0x4,%esp
+  8019d7:	68 00 10 00 00       	push   $0x1000
+  8019dc:	53                   	push   %ebx
+  8019dd:	68 00 f0 7f 00       	push   $0x7ff000
+  8019e2:	e8 1a f1 ff ff       	call   800b01 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8019e7:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8019ee:	53                   	push   %ebx
+  8019ef:	6a 00                	push   $0x0
+  8019f1:	68 00 f0 7f 00       	push   $0x7ff000
+  8019f6:	6a 00                	push   $0x0
+  8019f8:	e8 e3 f4 ff ff       	call   800ee0 <sys_page_map>
+  8019fd:	83 c4 20             	add    $0x20,%esp
+  801a00:	85 c0                	test   %eax,%eax
+  801a02:	78 2d                	js     801a31 <pgfault+0xaf>
+}
+  801a04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a07:	c9                   	leave
+  801a08:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801a09:	83 ec 04             	sub    $0x4,%esp
+  801a0c:	68 d0 40 80 00       	push   $0x8040d0
+  801a11:	6a 1e                	push   $0x1e
+  801a13:	68 c5 40 80 00       	push   $0x8040c5
+  801a18:	e8 3b e8 ff ff       	call   800258 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801a1d:	83 ec 04             	sub    $0x4,%esp
+  801a20:	68 4c 40 80 00       	push   $0x80404c
+  801a25:	6a 29                	push   $0x29
+  801a27:	68 c5 40 80 00       	push   $0x8040c5
+  801a2c:	e8 27 e8 ff ff       	call   800258 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801a31:	50                   	push   %eax
+  801a32:	68 80 40 80 00       	push   $0x804080
+  801a37:	6a 2e                	push   $0x2e
+  801a39:	68 c5 40 80 00       	push   $0x8040c5
+  801a3e:	e8 15 e8 ff ff       	call   800258 <_panic>
+
+00801a43 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801a49:	ff 75 0c             	push   0xc(%ebp)
+  801a4c:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801a4f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801a56:	e8 23 f3 ff ff       	call   800d7e <sys_env_destroy>
+}
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	c9                   	leave
+  801a5f:	c3                   	ret
+
+00801a60 <ufork>:
+{
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	57                   	push   %edi
+  801a64:	56                   	push   %esi
+  801a65:	53                   	push   %ebx
+  801a66:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801a6c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801a71:	cd 30                	int    $0x30
+  801a73:	89 c6                	mov    %eax,%esi
+  801a75:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	78 56                	js     801ad5 <ufork+0x75>
+	if (pid > 0) {
+  801a7f:	0f 8e b3 02 00 00    	jle    801d38 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801a85:	83 ec 0c             	sub    $0xc,%esp
+  801a88:	68 82 19 80 00       	push   $0x801982
+  801a8d:	e8 f4 1e 00 00       	call   803986 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801a92:	83 c4 08             	add    $0x8,%esp
+  801a95:	68 ed 39 80 00       	push   $0x8039ed
+  801a9a:	56                   	push   %esi
+  801a9b:	e8 ef f5 ff ff       	call   80108f <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801aa0:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801aa6:	89 1c 24             	mov    %ebx,(%esp)
+  801aa9:	e8 21 03 00 00       	call   801dcf <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801aae:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801ab5:	6a 07                	push   $0x7
+  801ab7:	68 00 f0 bf ee       	push   $0xeebff000
+  801abc:	56                   	push   %esi
+  801abd:	53                   	push   %ebx
+  801abe:	e8 8d 04 00 00       	call   801f50 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801ac3:	83 c4 20             	add    $0x20,%esp
+  801ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801acb:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801ad1:	89 fe                	mov    %edi,%esi
+  801ad3:	eb 22                	jmp    801af7 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801ad5:	50                   	push   %eax
+  801ad6:	68 e9 40 80 00       	push   $0x8040e9
+  801adb:	68 a9 00 00 00       	push   $0xa9
+  801ae0:	68 c5 40 80 00       	push   $0x8040c5
+  801ae5:	e8 6e e7 ff ff       	call   800258 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801aea:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801af0:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801af5:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801af7:	89 f7                	mov    %esi,%edi
+  801af9:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801aff:	0f 87 e9 01 00 00    	ja     801cee <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801b05:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801b0b:	85 f6                	test   %esi,%esi
+  801b0d:	0f 49 d6             	cmovns %esi,%edx
+  801b10:	c1 fa 0a             	sar    $0xa,%edx
+  801b13:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801b1a:	f6 c1 01             	test   $0x1,%cl
+  801b1d:	74 cb                	je     801aea <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801b1f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b26:	f6 c2 80             	test   $0x80,%dl
+  801b29:	75 17                	jne    801b42 <ufork+0xe2>
+			j = i + 1;
+  801b2b:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801b2e:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801b35:	f6 c2 01             	test   $0x1,%dl
+  801b38:	0f 85 f3 00 00 00    	jne    801c31 <ufork+0x1d1>
+			j = i + 1;
+  801b3e:	89 de                	mov    %ebx,%esi
+  801b40:	eb b5                	jmp    801af7 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801b42:	89 fb                	mov    %edi,%ebx
+  801b44:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801b47:	89 d8                	mov    %ebx,%eax
+  801b49:	c1 e8 16             	shr    $0x16,%eax
+  801b4c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b53:	89 c2                	mov    %eax,%edx
+  801b55:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801b5b:	25 02 04 00 00       	and    $0x402,%eax
+  801b60:	83 f8 02             	cmp    $0x2,%eax
+  801b63:	74 31                	je     801b96 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801b65:	83 ec 04             	sub    $0x4,%esp
+  801b68:	6a 01                	push   $0x1
+  801b6a:	52                   	push   %edx
+  801b6b:	53                   	push   %ebx
+  801b6c:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801b72:	53                   	push   %ebx
+  801b73:	6a 00                	push   $0x0
+  801b75:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801b7b:	50                   	push   %eax
+  801b7c:	e8 fa 03 00 00       	call   801f7b <batch_map>
+		return;
+  801b81:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b84:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b8a:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b8f:	89 c6                	mov    %eax,%esi
+				continue;
+  801b91:	e9 61 ff ff ff       	jmp    801af7 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801b96:	83 ec 04             	sub    $0x4,%esp
+  801b99:	80 ca 80             	or     $0x80,%dl
+  801b9c:	52                   	push   %edx
+  801b9d:	53                   	push   %ebx
+  801b9e:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801ba4:	e8 ca f2 ff ff       	call   800e73 <sys_page_alloc>
+  801ba9:	83 c4 10             	add    $0x10,%esp
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	78 5d                	js     801c0d <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801bb0:	83 ec 0c             	sub    $0xc,%esp
+  801bb3:	6a 07                	push   $0x7
+  801bb5:	68 00 00 40 00       	push   $0x400000
+  801bba:	6a 00                	push   $0x0
+  801bbc:	53                   	push   %ebx
+  801bbd:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bc3:	e8 18 f3 ff ff       	call   800ee0 <sys_page_map>
+  801bc8:	83 c4 20             	add    $0x20,%esp
+  801bcb:	85 c0                	test   %eax,%eax
+  801bcd:	78 50                	js     801c1f <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801bcf:	83 ec 04             	sub    $0x4,%esp
+  801bd2:	68 00 00 40 00       	push   $0x400000
+  801bd7:	53                   	push   %ebx
+  801bd8:	68 00 00 40 00       	push   $0x400000
+  801bdd:	e8 1f ef ff ff       	call   800b01 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801be2:	83 c4 08             	add    $0x8,%esp
+  801be5:	68 00 00 40 00       	push   $0x400000
+  801bea:	6a 00                	push   $0x0
+  801bec:	e8 5d f3 ff ff       	call   800f4e <sys_page_unmap>
+  801bf1:	83 c4 10             	add    $0x10,%esp
+  801bf4:	85 c0                	test   %eax,%eax
+  801bf6:	79 8c                	jns    801b84 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801bf8:	50                   	push   %eax
+  801bf9:	68 0a 41 80 00       	push   $0x80410a
+  801bfe:	68 81 00 00 00       	push   $0x81
+  801c03:	68 c5 40 80 00       	push   $0x8040c5
+  801c08:	e8 4b e6 ff ff       	call   800258 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801c0d:	50                   	push   %eax
+  801c0e:	68 ec 3b 80 00       	push   $0x803bec
+  801c13:	6a 7c                	push   $0x7c
+  801c15:	68 c5 40 80 00       	push   $0x8040c5
+  801c1a:	e8 39 e6 ff ff       	call   800258 <_panic>
+		panic("sys_page_map: %e", r);
+  801c1f:	50                   	push   %eax
+  801c20:	68 f9 40 80 00       	push   $0x8040f9
+  801c25:	6a 7e                	push   $0x7e
+  801c27:	68 c5 40 80 00       	push   $0x8040c5
+  801c2c:	e8 27 e6 ff ff       	call   800258 <_panic>
+  801c31:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801c37:	eb 22                	jmp    801c5b <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801c39:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c40:	a8 01                	test   $0x1,%al
+  801c42:	74 35                	je     801c79 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801c44:	89 d8                	mov    %ebx,%eax
+  801c46:	e8 9e fc ff ff       	call   8018e9 <dupperm>
+  801c4b:	89 c6                	mov    %eax,%esi
+  801c4d:	89 f8                	mov    %edi,%eax
+  801c4f:	e8 95 fc ff ff       	call   8018e9 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c54:	39 c6                	cmp    %eax,%esi
+  801c56:	75 21                	jne    801c79 <ufork+0x219>
+				j++;
+  801c58:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801c5b:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801c61:	74 16                	je     801c79 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801c63:	89 d8                	mov    %ebx,%eax
+  801c65:	c1 e8 0a             	shr    $0xa,%eax
+  801c68:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c6f:	25 81 00 00 00       	and    $0x81,%eax
+  801c74:	83 f8 01             	cmp    $0x1,%eax
+  801c77:	74 c0                	je     801c39 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801c79:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801c7f:	89 d8                	mov    %ebx,%eax
+  801c81:	29 f0                	sub    %esi,%eax
+  801c83:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801c89:	89 fe                	mov    %edi,%esi
+  801c8b:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801c8e:	89 f8                	mov    %edi,%eax
+  801c90:	e8 54 fc ff ff       	call   8018e9 <dupperm>
+  801c95:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801c97:	83 ec 08             	sub    $0x8,%esp
+  801c9a:	6a 02                	push   $0x2
+  801c9c:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801ca2:	51                   	push   %ecx
+  801ca3:	e8 95 01 00 00       	call   801e3d <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801ca8:	83 c4 0c             	add    $0xc,%esp
+  801cab:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801cb1:	57                   	push   %edi
+  801cb2:	56                   	push   %esi
+  801cb3:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801cb9:	56                   	push   %esi
+  801cba:	6a 00                	push   $0x0
+  801cbc:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801cc2:	51                   	push   %ecx
+  801cc3:	e8 b3 02 00 00       	call   801f7b <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801cc8:	83 c4 1c             	add    $0x1c,%esp
+  801ccb:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801cd1:	57                   	push   %edi
+  801cd2:	56                   	push   %esi
+  801cd3:	6a 00                	push   $0x0
+  801cd5:	56                   	push   %esi
+  801cd6:	6a 00                	push   $0x0
+  801cd8:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801cde:	50                   	push   %eax
+  801cdf:	e8 97 02 00 00       	call   801f7b <batch_map>
+	return 0;
+  801ce4:	83 c4 20             	add    $0x20,%esp
+  801ce7:	89 de                	mov    %ebx,%esi
+  801ce9:	e9 09 fe ff ff       	jmp    801af7 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801cee:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801cf4:	83 ec 04             	sub    $0x4,%esp
+  801cf7:	6a 02                	push   $0x2
+  801cf9:	56                   	push   %esi
+  801cfa:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d00:	53                   	push   %ebx
+  801d01:	e8 c9 02 00 00       	call   801fcf <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801d06:	89 1c 24             	mov    %ebx,(%esp)
+  801d09:	e8 dd 00 00 00       	call   801deb <batch_flush>
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	85 c0                	test   %eax,%eax
+  801d13:	78 0e                	js     801d23 <ufork+0x2c3>
+}
+  801d15:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d1e:	5b                   	pop    %ebx
+  801d1f:	5e                   	pop    %esi
+  801d20:	5f                   	pop    %edi
+  801d21:	5d                   	pop    %ebp
+  801d22:	c3                   	ret
+			panic("fork: %e", r);
+  801d23:	50                   	push   %eax
+  801d24:	68 f0 40 80 00       	push   $0x8040f0
+  801d29:	68 d7 00 00 00       	push   $0xd7
+  801d2e:	68 c5 40 80 00       	push   $0x8040c5
+  801d33:	e8 20 e5 ff ff       	call   800258 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d38:	e8 aa f0 ff ff       	call   800de7 <sys_getenvid>
+  801d3d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d42:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d48:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d4d:	a3 08 60 80 00       	mov    %eax,0x806008
+		return 0;
+  801d52:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801d59:	00 00 00 
+  801d5c:	eb b7                	jmp    801d15 <ufork+0x2b5>
+
+00801d5e <fork>:
+{
+  801d5e:	55                   	push   %ebp
+  801d5f:	89 e5                	mov    %esp,%ebp
+  801d61:	53                   	push   %ebx
+  801d62:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801d65:	68 82 19 80 00       	push   $0x801982
+  801d6a:	e8 17 1c 00 00       	call   803986 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801d6f:	e8 7a f6 ff ff       	call   8013ee <sys_fork>
+  801d74:	89 c3                	mov    %eax,%ebx
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	78 09                	js     801d86 <fork+0x28>
+	if (pid == 0)
+  801d7d:	74 1c                	je     801d9b <fork+0x3d>
+}
+  801d7f:	89 d8                	mov    %ebx,%eax
+  801d81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d84:	c9                   	leave
+  801d85:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801d86:	50                   	push   %eax
+  801d87:	68 e9 40 80 00       	push   $0x8040e9
+  801d8c:	68 ed 00 00 00       	push   $0xed
+  801d91:	68 c5 40 80 00       	push   $0x8040c5
+  801d96:	e8 bd e4 ff ff       	call   800258 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d9b:	e8 47 f0 ff ff       	call   800de7 <sys_getenvid>
+  801da0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801da5:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801dab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801db0:	a3 08 60 80 00       	mov    %eax,0x806008
+	return pid;
+  801db5:	eb c8                	jmp    801d7f <fork+0x21>
+
+00801db7 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801dbd:	ff 75 0c             	push   0xc(%ebp)
+  801dc0:	ff 75 08             	push   0x8(%ebp)
+  801dc3:	68 43 1a 80 00       	push   $0x801a43
+  801dc8:	e8 67 f6 ff ff       	call   801434 <sys_thread_create>
+}
+  801dcd:	c9                   	leave
+  801dce:	c3                   	ret
+
+00801dcf <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801dcf:	55                   	push   %ebp
+  801dd0:	89 e5                	mov    %esp,%ebp
+  801dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801dd5:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801ddc:	00 00 00 
+	b->b_error = 0;
+  801ddf:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801de6:	00 00 00 
+}
+  801de9:	5d                   	pop    %ebp
+  801dea:	c3                   	ret
+
+00801deb <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801deb:	55                   	push   %ebp
+  801dec:	89 e5                	mov    %esp,%ebp
+  801dee:	53                   	push   %ebx
+  801def:	83 ec 04             	sub    $0x4,%esp
+  801df2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801df5:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801dfb:	85 c0                	test   %eax,%eax
+  801dfd:	7e 09                	jle    801e08 <batch_flush+0x1d>
+  801dff:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801e06:	74 15                	je     801e1d <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801e08:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801e0f:	00 00 00 
+	return b->b_error;
+  801e12:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801e18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e1b:	c9                   	leave
+  801e1c:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  801e1d:	83 ec 08             	sub    $0x8,%esp
+  801e20:	50                   	push   %eax
+  801e21:	53                   	push   %ebx
+  801e22:	e8 32 f7 ff ff       	call   801559 <sys_batch>
+  801e27:	83 c4 10             	add    $0x10,%esp
+  801e2a:	85 c0                	test   %eax,%eax
+  801e2c:	79 da                	jns    801e08 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  801e2e:	f7 d8                	neg    %eax
+  801e30:	0f b6 c0             	movzbl %al,%eax
+  801e33:	f7 d8                	neg    %eax
+  801e35:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  801e3b:	eb cb                	jmp    801e08 <batch_flush+0x1d>
+
+00801e3d <batch_reserve>:
+{
+  801e3d:	55                   	push   %ebp
+  801e3e:	89 e5                	mov    %esp,%ebp
+  801e40:	83 ec 08             	sub    $0x8,%esp
+  801e43:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  801e46:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  801e4c:	03 45 0c             	add    0xc(%ebp),%eax
+  801e4f:	83 f8 10             	cmp    $0x10,%eax
+  801e52:	7f 02                	jg     801e56 <batch_reserve+0x19>
+}
+  801e54:	c9                   	leave
+  801e55:	c3                   	ret
+		batch_flush(b);
+  801e56:	83 ec 0c             	sub    $0xc,%esp
+  801e59:	52                   	push   %edx
+  801e5a:	e8 8c ff ff ff       	call   801deb <batch_flush>
+  801e5f:	83 c4 10             	add    $0x10,%esp
+}
+  801e62:	eb f0                	jmp    801e54 <batch_reserve+0x17>
+
+00801e64 <batch_next>:
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	53                   	push   %ebx
+  801e68:	83 ec 04             	sub    $0x4,%esp
+  801e6b:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  801e6d:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  801e74:	74 28                	je     801e9e <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  801e76:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801e7c:	8d 50 01             	lea    0x1(%eax),%edx
+  801e7f:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  801e85:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801e88:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	6a 1c                	push   $0x1c
+  801e8f:	6a 00                	push   $0x0
+  801e91:	53                   	push   %ebx
+  801e92:	e8 35 ec ff ff       	call   800acc <memset>
+}
+  801e97:	89 d8                	mov    %ebx,%eax
+  801e99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e9c:	c9                   	leave
+  801e9d:	c3                   	ret
+		batch_flush(b);
+  801e9e:	83 ec 0c             	sub    $0xc,%esp
+  801ea1:	50                   	push   %eax
+  801ea2:	e8 44 ff ff ff       	call   801deb <batch_flush>
+  801ea7:	83 c4 10             	add    $0x10,%esp
+  801eaa:	eb ca                	jmp    801e76 <batch_next+0x12>
+
+00801eac <batch_page>:
+{
+  801eac:	55                   	push   %ebp
+  801ead:	89 e5                	mov    %esp,%ebp
+  801eaf:	57                   	push   %edi
+  801eb0:	56                   	push   %esi
+  801eb1:	53                   	push   %ebx
+  801eb2:	83 ec 1c             	sub    $0x1c,%esp
+  801eb5:	89 d3                	mov    %edx,%ebx
+  801eb7:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  801eb9:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  801ebf:	85 d2                	test   %edx,%edx
+  801ec1:	74 50                	je     801f13 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  801ec3:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  801ec6:	01 c1                	add    %eax,%ecx
+  801ec8:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  801ecb:	75 46                	jne    801f13 <batch_page+0x67>
+  801ecd:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  801ed0:	75 41                	jne    801f13 <batch_page+0x67>
+  801ed2:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  801ed5:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  801ed8:	75 39                	jne    801f13 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  801eda:	83 ea 01             	sub    $0x1,%edx
+  801edd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801ee0:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801ee3:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  801ee7:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  801eea:	75 27                	jne    801f13 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  801eec:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  801eef:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  801ef3:	89 fa                	mov    %edi,%edx
+  801ef5:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801ef8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801efb:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  801efe:	39 55 08             	cmp    %edx,0x8(%ebp)
+  801f01:	75 10                	jne    801f13 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  801f03:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  801f07:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801f0a:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  801f0e:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801f11:	74 2a                	je     801f3d <batch_page+0x91>
+	op = batch_next(b);
+  801f13:	e8 4c ff ff ff       	call   801e64 <batch_next>
+	op->bo_op = opcode;
+  801f18:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  801f1a:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  801f1d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f20:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  801f23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f26:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  801f29:	8b 75 10             	mov    0x10(%ebp),%esi
+  801f2c:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  801f2f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  801f32:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  801f35:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801f38:	89 78 14             	mov    %edi,0x14(%eax)
+  801f3b:	eb 0b                	jmp    801f48 <batch_page+0x9c>
+		op->bo_npages += npages;
+  801f3d:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  801f41:	03 7d 18             	add    0x18(%ebp),%edi
+  801f44:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  801f48:	83 c4 1c             	add    $0x1c,%esp
+  801f4b:	5b                   	pop    %ebx
+  801f4c:	5e                   	pop    %esi
+  801f4d:	5f                   	pop    %edi
+  801f4e:	5d                   	pop    %ebp
+  801f4f:	c3                   	ret
+
+00801f50 <batch_alloc>:
+{
+  801f50:	55                   	push   %ebp
+  801f51:	89 e5                	mov    %esp,%ebp
+  801f53:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  801f56:	ff 75 18             	push   0x18(%ebp)
+  801f59:	ff 75 14             	push   0x14(%ebp)
+  801f5c:	ff 75 10             	push   0x10(%ebp)
+  801f5f:	ff 75 0c             	push   0xc(%ebp)
+  801f62:	6a 00                	push   $0x0
+  801f64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f71:	e8 36 ff ff ff       	call   801eac <batch_page>
+}
+  801f76:	83 c4 20             	add    $0x20,%esp
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+
+00801f7b <batch_map>:
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  801f81:	ff 75 20             	push   0x20(%ebp)
+  801f84:	ff 75 1c             	push   0x1c(%ebp)
+  801f87:	ff 75 18             	push   0x18(%ebp)
+  801f8a:	ff 75 14             	push   0x14(%ebp)
+  801f8d:	ff 75 10             	push   0x10(%ebp)
+  801f90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f93:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f98:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9b:	e8 0c ff ff ff       	call   801eac <batch_page>
+}
+  801fa0:	83 c4 20             	add    $0x20,%esp
+  801fa3:	c9                   	leave
+  801fa4:	c3                   	ret
+
+00801fa5 <batch_unmap>:
+{
+  801fa5:	55                   	push   %ebp
+  801fa6:	89 e5                	mov    %esp,%ebp
+  801fa8:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  801fab:	ff 75 14             	push   0x14(%ebp)
+  801fae:	6a 00                	push   $0x0
+  801fb0:	ff 75 10             	push   0x10(%ebp)
+  801fb3:	ff 75 0c             	push   0xc(%ebp)
+  801fb6:	6a 00                	push   $0x0
+  801fb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fbd:	ba 02 00 00 00       	mov    $0x2,%edx
+  801fc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc5:	e8 e2 fe ff ff       	call   801eac <batch_page>
+}
+  801fca:	83 c4 20             	add    $0x20,%esp
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <batch_set_status>:
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  801fd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd8:	e8 87 fe ff ff       	call   801e64 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  801fdd:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  801fe3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fe6:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  801fe9:	8b 55 10             	mov    0x10(%ebp),%edx
+  801fec:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  801fef:	c9                   	leave
+  801ff0:	c3                   	ret
+
+00801ff1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801ff1:	55                   	push   %ebp
+  801ff2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ff4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff7:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ffc:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801fff:	5d                   	pop    %ebp
+  802000:	c3                   	ret
+
+00802001 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802001:	55                   	push   %ebp
+  802002:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802004:	8b 45 08             	mov    0x8(%ebp),%eax
+  802007:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80200c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802011:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802016:	5d                   	pop    %ebp
+  802017:	c3                   	ret
+
+00802018 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802018:	55                   	push   %ebp
+  802019:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80201b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802020:	eb 02                	jmp    802024 <fd_alloc+0xc>
+  802022:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802024:	89 c2                	mov    %eax,%edx
+  802026:	c1 ea 16             	shr    $0x16,%edx
+  802029:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802030:	f6 c2 01             	test   $0x1,%dl
+  802033:	74 2b                	je     802060 <fd_alloc+0x48>
+  802035:	89 c2                	mov    %eax,%edx
+  802037:	c1 ea 0c             	shr    $0xc,%edx
+  80203a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802041:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802047:	f6 c1 01             	test   $0x1,%cl
+  80204a:	74 14                	je     802060 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80204c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802052:	75 ce                	jne    802022 <fd_alloc+0xa>
+  802054:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802059:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80205e:	eb 05                	jmp    802065 <fd_alloc+0x4d>
+			return 0;
+  802060:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802065:	8b 55 08             	mov    0x8(%ebp),%edx
+  802068:	89 02                	mov    %eax,(%edx)
+}
+  80206a:	89 c8                	mov    %ecx,%eax
+  80206c:	5d                   	pop    %ebp
+  80206d:	c3                   	ret
+
+0080206e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80206e:	55                   	push   %ebp
+  80206f:	89 e5                	mov    %esp,%ebp
+  802071:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802074:	83 f8 1f             	cmp    $0x1f,%eax
+  802077:	77 30                	ja     8020a9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802079:	c1 e0 0c             	shl    $0xc,%eax
+  80207c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802081:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802087:	f6 c2 01             	test   $0x1,%dl
+  80208a:	74 24                	je     8020b0 <fd_lookup+0x42>
+  80208c:	89 c2                	mov    %eax,%edx
+  80208e:	c1 ea 0c             	shr    $0xc,%edx
+  802091:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802098:	f6 c2 01             	test   $0x1,%dl
+  80209b:	74 1a                	je     8020b7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80209d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020a0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8020a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020a7:	5d                   	pop    %ebp
+  8020a8:	c3                   	ret
+		return -E_INVAL;
+  8020a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020ae:	eb f7                	jmp    8020a7 <fd_lookup+0x39>
+		return -E_INVAL;
+  8020b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b5:	eb f0                	jmp    8020a7 <fd_lookup+0x39>
+  8020b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020bc:	eb e9                	jmp    8020a7 <fd_lookup+0x39>
+
+008020be <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8020be:	55                   	push   %ebp
+  8020bf:	89 e5                	mov    %esp,%ebp
+  8020c1:	53                   	push   %ebx
+  8020c2:	83 ec 04             	sub    $0x4,%esp
+  8020c5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8020c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cd:	eb 03                	jmp    8020d2 <dev_lookup+0x14>
+  8020cf:	83 c0 01             	add    $0x1,%eax
+  8020d2:	8b 1c 85 9c 41 80 00 	mov    0x80419c(,%eax,4),%ebx
+  8020d9:	85 db                	test   %ebx,%ebx
+  8020db:	74 0b                	je     8020e8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8020dd:	39 13                	cmp    %edx,(%ebx)
+  8020df:	75 ee                	jne    8020cf <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8020e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e6:	eb 2e                	jmp    802116 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8020e8:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8020ea:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8020ef:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8020f5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8020fa:	76 24                	jbe    802120 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8020fc:	8b 41 48             	mov    0x48(%ecx),%eax
+  8020ff:	83 ec 04             	sub    $0x4,%esp
+  802102:	52                   	push   %edx
+  802103:	50                   	push   %eax
+  802104:	68 20 41 80 00       	push   $0x804120
+  802109:	e8 25 e2 ff ff       	call   800333 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80210e:	83 c4 10             	add    $0x10,%esp
+  802111:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802116:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802119:	89 1a                	mov    %ebx,(%edx)
+}
+  80211b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80211e:	c9                   	leave
+  80211f:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802120:	c1 e8 10             	shr    $0x10,%eax
+  802123:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802129:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80212f:	eb cb                	jmp    8020fc <dev_lookup+0x3e>
+
+00802131 <fd_close>:
+{
+  802131:	55                   	push   %ebp
+  802132:	89 e5                	mov    %esp,%ebp
+  802134:	57                   	push   %edi
+  802135:	56                   	push   %esi
+  802136:	53                   	push   %ebx
+  802137:	83 ec 24             	sub    $0x24,%esp
+  80213a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80213d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802140:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802143:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802144:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80214a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80214d:	50                   	push   %eax
+  80214e:	e8 1b ff ff ff       	call   80206e <fd_lookup>
+  802153:	89 c3                	mov    %eax,%ebx
+  802155:	83 c4 10             	add    $0x10,%esp
+  802158:	85 c0                	test   %eax,%eax
+  80215a:	78 05                	js     802161 <fd_close+0x30>
+	    || fd != fd2)
+  80215c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80215f:	74 16                	je     802177 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802161:	89 f8                	mov    %edi,%eax
+  802163:	84 c0                	test   %al,%al
+  802165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80216a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80216d:	89 d8                	mov    %ebx,%eax
+  80216f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802172:	5b                   	pop    %ebx
+  802173:	5e                   	pop    %esi
+  802174:	5f                   	pop    %edi
+  802175:	5d                   	pop    %ebp
+  802176:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802177:	83 ec 08             	sub    $0x8,%esp
+  80217a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80217d:	50                   	push   %eax
+  80217e:	ff 36                	push   (%esi)
+  802180:	e8 39 ff ff ff       	call   8020be <dev_lookup>
+  802185:	89 c3                	mov    %eax,%ebx
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 1a                	js     8021a8 <fd_close+0x77>
+		if (dev->dev_close)
+  80218e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802191:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802194:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	74 0b                	je     8021a8 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80219d:	83 ec 0c             	sub    $0xc,%esp
+  8021a0:	56                   	push   %esi
+  8021a1:	ff d0                	call   *%eax
+  8021a3:	89 c3                	mov    %eax,%ebx
+  8021a5:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8021a8:	83 ec 08             	sub    $0x8,%esp
+  8021ab:	56                   	push   %esi
+  8021ac:	6a 00                	push   $0x0
+  8021ae:	e8 9b ed ff ff       	call   800f4e <sys_page_unmap>
+	return r;
+  8021b3:	83 c4 10             	add    $0x10,%esp
+  8021b6:	eb b5                	jmp    80216d <fd_close+0x3c>
+
+008021b8 <close>:
+
+int
+close(int fdnum)
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c1:	50                   	push   %eax
+  8021c2:	ff 75 08             	push   0x8(%ebp)
+  8021c5:	e8 a4 fe ff ff       	call   80206e <fd_lookup>
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	79 02                	jns    8021d3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8021d1:	c9                   	leave
+  8021d2:	c3                   	ret
+		return fd_close(fd, 1);
+  8021d3:	83 ec 08             	sub    $0x8,%esp
+  8021d6:	6a 01                	push   $0x1
+  8021d8:	ff 75 f4             	push   -0xc(%ebp)
+  8021db:	e8 51 ff ff ff       	call   802131 <fd_close>
+  8021e0:	83 c4 10             	add    $0x10,%esp
+  8021e3:	eb ec                	jmp    8021d1 <close+0x19>
+
+008021e5 <close_all>:
+
+void
+close_all(void)
+{
+  8021e5:	55                   	push   %ebp
+  8021e6:	89 e5                	mov    %esp,%ebp
+  8021e8:	53                   	push   %ebx
+  8021e9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8021ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8021f1:	83 ec 0c             	sub    $0xc,%esp
+  8021f4:	53                   	push   %ebx
+  8021f5:	e8 be ff ff ff       	call   8021b8 <close>
+	for (i = 0; i < MAXFD; i++)
+  8021fa:	83 c3 01             	add    $0x1,%ebx
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	83 fb 20             	cmp    $0x20,%ebx
+  802203:	75 ec                	jne    8021f1 <close_all+0xc>
+}
+  802205:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802208:	c9                   	leave
+  802209:	c3                   	ret
+
+0080220a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80220a:	55                   	push   %ebp
+  80220b:	89 e5                	mov    %esp,%ebp
+  80220d:	57                   	push   %edi
+  80220e:	56                   	push   %esi
+  80220f:	53                   	push   %ebx
+  802210:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802213:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802216:	50                   	push   %eax
+  802217:	ff 75 08             	push   0x8(%ebp)
+  80221a:	e8 4f fe ff ff       	call   80206e <fd_lookup>
+  80221f:	89 c3                	mov    %eax,%ebx
+  802221:	83 c4 10             	add    $0x10,%esp
+  802224:	85 c0                	test   %eax,%eax
+  802226:	78 7f                	js     8022a7 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802228:	83 ec 0c             	sub    $0xc,%esp
+  80222b:	ff 75 0c             	push   0xc(%ebp)
+  80222e:	e8 85 ff ff ff       	call   8021b8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802233:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802236:	c1 e6 0c             	shl    $0xc,%esi
+  802239:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80223f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802242:	89 3c 24             	mov    %edi,(%esp)
+  802245:	e8 b7 fd ff ff       	call   802001 <fd2data>
+  80224a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80224c:	89 34 24             	mov    %esi,(%esp)
+  80224f:	e8 ad fd ff ff       	call   802001 <fd2data>
+  802254:	83 c4 10             	add    $0x10,%esp
+  802257:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80225a:	89 d8                	mov    %ebx,%eax
+  80225c:	c1 e8 16             	shr    $0x16,%eax
+  80225f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802266:	a8 01                	test   $0x1,%al
+  802268:	74 11                	je     80227b <dup+0x71>
+  80226a:	89 d8                	mov    %ebx,%eax
+  80226c:	c1 e8 0c             	shr    $0xc,%eax
+  80226f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802276:	f6 c2 01             	test   $0x1,%dl
+  802279:	75 36                	jne    8022b1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80227b:	89 f8                	mov    %edi,%eax
+  80227d:	c1 e8 0c             	shr    $0xc,%eax
+  802280:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802287:	83 ec 0c             	sub    $0xc,%esp
+  80228a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80228f:	50                   	push   %eax
+  802290:	56                   	push   %esi
+  802291:	6a 00                	push   $0x0
+  802293:	57                   	push   %edi
+  802294:	6a 00                	push   $0x0
+  802296:	e8 45 ec ff ff       	call   800ee0 <sys_page_map>
+  80229b:	89 c3                	mov    %eax,%ebx
+  80229d:	83 c4 20             	add    $0x20,%esp
+  8022a0:	85 c0                	test   %eax,%eax
+  8022a2:	78 33                	js     8022d7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8022a4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8022a7:	89 d8                	mov    %ebx,%eax
+  8022a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ac:	5b                   	pop    %ebx
+  8022ad:	5e                   	pop    %esi
+  8022ae:	5f                   	pop    %edi
+  8022af:	5d                   	pop    %ebp
+  8022b0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8022b1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8022b8:	83 ec 0c             	sub    $0xc,%esp
+  8022bb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8022c0:	50                   	push   %eax
+  8022c1:	ff 75 d4             	push   -0x2c(%ebp)
+  8022c4:	6a 00                	push   $0x0
+  8022c6:	53                   	push   %ebx
+  8022c7:	6a 00                	push   $0x0
+  8022c9:	e8 12 ec ff ff       	call   800ee0 <sys_page_map>
+  8022ce:	89 c3                	mov    %eax,%ebx
+  8022d0:	83 c4 20             	add    $0x20,%esp
+  8022d3:	85 c0                	test   %eax,%eax
+  8022d5:	79 a4                	jns    80227b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8022d7:	83 ec 08             	sub    $0x8,%esp
+  8022da:	56                   	push   %esi
+  8022db:	6a 00                	push   $0x0
+  8022dd:	e8 6c ec ff ff       	call   800f4e <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8022e2:	83 c4 08             	add    $0x8,%esp
+  8022e5:	ff 75 d4             	push   -0x2c(%ebp)
+  8022e8:	6a 00                	push   $0x0
+  8022ea:	e8 5f ec ff ff       	call   800f4e <sys_page_unmap>
+	return r;
+  8022ef:	83 c4 10             	add    $0x10,%esp
+  8022f2:	eb b3                	jmp    8022a7 <dup+0x9d>
+
+008022f4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8022f4:	55                   	push   %ebp
+  8022f5:	89 e5                	mov    %esp,%ebp
+  8022f7:	56                   	push   %esi
+  8022f8:	53                   	push   %ebx
+  8022f9:	83 ec 18             	sub    $0x18,%esp
+  8022fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022ff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802302:	50                   	push   %eax
+  802303:	53                   	push   %ebx
+  802304:	e8 65 fd ff ff       	call   80206e <fd_lookup>
+  802309:	83 c4 10             	add    $0x10,%esp
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	78 3c                	js     80234c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802310:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802313:	83 ec 08             	sub    $0x8,%esp
+  802316:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802319:	50                   	push   %eax
+  80231a:	ff 36                	push   (%esi)
+  80231c:	e8 9d fd ff ff       	call   8020be <dev_lookup>
+  802321:	83 c4 10             	add    $0x10,%esp
+  802324:	85 c0                	test   %eax,%eax
+  802326:	78 24                	js     80234c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802328:	8b 46 08             	mov    0x8(%esi),%eax
+  80232b:	83 e0 03             	and    $0x3,%eax
+  80232e:	83 f8 01             	cmp    $0x1,%eax
+  802331:	74 20                	je     802353 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802333:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802336:	8b 40 08             	mov    0x8(%eax),%eax
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	74 57                	je     802394 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80233d:	83 ec 04             	sub    $0x4,%esp
+  802340:	ff 75 10             	push   0x10(%ebp)
+  802343:	ff 75 0c             	push   0xc(%ebp)
+  802346:	56                   	push   %esi
+  802347:	ff d0                	call   *%eax
+  802349:	83 c4 10             	add    $0x10,%esp
+}
+  80234c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80234f:	5b                   	pop    %ebx
+  802350:	5e                   	pop    %esi
+  802351:	5d                   	pop    %ebp
+  802352:	c3                   	ret
+  802353:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802355:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80235a:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802360:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802365:	76 1c                	jbe    802383 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802367:	8b 42 48             	mov    0x48(%edx),%eax
+  80236a:	83 ec 04             	sub    $0x4,%esp
+  80236d:	53                   	push   %ebx
+  80236e:	50                   	push   %eax
+  80236f:	68 61 41 80 00       	push   $0x804161
+  802374:	e8 ba df ff ff       	call   800333 <cprintf>
+		return -E_INVAL;
+  802379:	83 c4 10             	add    $0x10,%esp
+  80237c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802381:	eb c9                	jmp    80234c <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802383:	c1 e8 10             	shr    $0x10,%eax
+  802386:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80238c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802392:	eb d3                	jmp    802367 <read+0x73>
+		return -E_NOT_SUPP;
+  802394:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802399:	eb b1                	jmp    80234c <read+0x58>
+
+0080239b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80239b:	55                   	push   %ebp
+  80239c:	89 e5                	mov    %esp,%ebp
+  80239e:	57                   	push   %edi
+  80239f:	56                   	push   %esi
+  8023a0:	53                   	push   %ebx
+  8023a1:	83 ec 0c             	sub    $0xc,%esp
+  8023a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023a7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8023aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8023af:	eb 02                	jmp    8023b3 <readn+0x18>
+  8023b1:	01 c3                	add    %eax,%ebx
+  8023b3:	39 f3                	cmp    %esi,%ebx
+  8023b5:	73 21                	jae    8023d8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8023b7:	83 ec 04             	sub    $0x4,%esp
+  8023ba:	89 f0                	mov    %esi,%eax
+  8023bc:	29 d8                	sub    %ebx,%eax
+  8023be:	50                   	push   %eax
+  8023bf:	89 d8                	mov    %ebx,%eax
+  8023c1:	03 45 0c             	add    0xc(%ebp),%eax
+  8023c4:	50                   	push   %eax
+  8023c5:	57                   	push   %edi
+  8023c6:	e8 29 ff ff ff       	call   8022f4 <read>
+		if (m < 0)
+  8023cb:	83 c4 10             	add    $0x10,%esp
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 04                	js     8023d6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8023d2:	75 dd                	jne    8023b1 <readn+0x16>
+  8023d4:	eb 02                	jmp    8023d8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8023d6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8023d8:	89 d8                	mov    %ebx,%eax
+  8023da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023dd:	5b                   	pop    %ebx
+  8023de:	5e                   	pop    %esi
+  8023df:	5f                   	pop    %edi
+  8023e0:	5d                   	pop    %ebp
+  8023e1:	c3                   	ret
+
+008023e2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8023e2:	55                   	push   %ebp
+  8023e3:	89 e5                	mov    %esp,%ebp
+  8023e5:	56                   	push   %esi
+  8023e6:	53                   	push   %ebx
+  8023e7:	83 ec 18             	sub    $0x18,%esp
+  8023ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8023ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023f0:	50                   	push   %eax
+  8023f1:	53                   	push   %ebx
+  8023f2:	e8 77 fc ff ff       	call   80206e <fd_lookup>
+  8023f7:	83 c4 10             	add    $0x10,%esp
+  8023fa:	85 c0                	test   %eax,%eax
+  8023fc:	78 37                	js     802435 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802401:	83 ec 08             	sub    $0x8,%esp
+  802404:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802407:	50                   	push   %eax
+  802408:	ff 36                	push   (%esi)
+  80240a:	e8 af fc ff ff       	call   8020be <dev_lookup>
+  80240f:	83 c4 10             	add    $0x10,%esp
+  802412:	85 c0                	test   %eax,%eax
+  802414:	78 1f                	js     802435 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802416:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80241a:	74 20                	je     80243c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80241c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80241f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802422:	85 c0                	test   %eax,%eax
+  802424:	74 57                	je     80247d <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802426:	83 ec 04             	sub    $0x4,%esp
+  802429:	ff 75 10             	push   0x10(%ebp)
+  80242c:	ff 75 0c             	push   0xc(%ebp)
+  80242f:	56                   	push   %esi
+  802430:	ff d0                	call   *%eax
+  802432:	83 c4 10             	add    $0x10,%esp
+}
+  802435:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802438:	5b                   	pop    %ebx
+  802439:	5e                   	pop    %esi
+  80243a:	5d                   	pop    %ebp
+  80243b:	c3                   	ret
+  80243c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80243e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802443:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802449:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80244e:	76 1c                	jbe    80246c <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802450:	8b 42 48             	mov    0x48(%edx),%eax
+  802453:	83 ec 04             	sub    $0x4,%esp
+  802456:	53                   	push   %ebx
+  802457:	50                   	push   %eax
+  802458:	68 7d 41 80 00       	push   $0x80417d
+  80245d:	e8 d1 de ff ff       	call   800333 <cprintf>
+		return -E_INVAL;
+  802462:	83 c4 10             	add    $0x10,%esp
+  802465:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80246a:	eb c9                	jmp    802435 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80246c:	c1 e8 10             	shr    $0x10,%eax
+  80246f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802475:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80247b:	eb d3                	jmp    802450 <write+0x6e>
+		return -E_NOT_SUPP;
+  80247d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802482:	eb b1                	jmp    802435 <write+0x53>
+
+00802484 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80248a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80248d:	50                   	push   %eax
+  80248e:	ff 75 08             	push   0x8(%ebp)
+  802491:	e8 d8 fb ff ff       	call   80206e <fd_lookup>
+  802496:	83 c4 10             	add    $0x10,%esp
+  802499:	85 c0                	test   %eax,%eax
+  80249b:	78 0e                	js     8024ab <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80249d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024a3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8024a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ab:	c9                   	leave
+  8024ac:	c3                   	ret
+
+008024ad <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+  8024b0:	56                   	push   %esi
+  8024b1:	53                   	push   %ebx
+  8024b2:	83 ec 18             	sub    $0x18,%esp
+  8024b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024b8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024bb:	50                   	push   %eax
+  8024bc:	53                   	push   %ebx
+  8024bd:	e8 ac fb ff ff       	call   80206e <fd_lookup>
+  8024c2:	83 c4 10             	add    $0x10,%esp
+  8024c5:	85 c0                	test   %eax,%eax
+  8024c7:	78 34                	js     8024fd <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024c9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024cc:	83 ec 08             	sub    $0x8,%esp
+  8024cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024d2:	50                   	push   %eax
+  8024d3:	ff 36                	push   (%esi)
+  8024d5:	e8 e4 fb ff ff       	call   8020be <dev_lookup>
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	85 c0                	test   %eax,%eax
+  8024df:	78 1c                	js     8024fd <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8024e1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8024e5:	74 1d                	je     802504 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8024e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024ea:	8b 40 18             	mov    0x18(%eax),%eax
+  8024ed:	85 c0                	test   %eax,%eax
+  8024ef:	74 54                	je     802545 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8024f1:	83 ec 08             	sub    $0x8,%esp
+  8024f4:	ff 75 0c             	push   0xc(%ebp)
+  8024f7:	56                   	push   %esi
+  8024f8:	ff d0                	call   *%eax
+  8024fa:	83 c4 10             	add    $0x10,%esp
+}
+  8024fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802500:	5b                   	pop    %ebx
+  802501:	5e                   	pop    %esi
+  802502:	5d                   	pop    %ebp
+  802503:	c3                   	ret
+  802504:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802506:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80250b:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802511:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802516:	76 1c                	jbe    802534 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802518:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80251b:	83 ec 04             	sub    $0x4,%esp
+  80251e:	53                   	push   %ebx
+  80251f:	50                   	push   %eax
+  802520:	68 40 41 80 00       	push   $0x804140
+  802525:	e8 09 de ff ff       	call   800333 <cprintf>
+		return -E_INVAL;
+  80252a:	83 c4 10             	add    $0x10,%esp
+  80252d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802532:	eb c9                	jmp    8024fd <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802534:	c1 e8 10             	shr    $0x10,%eax
+  802537:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80253d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802543:	eb d3                	jmp    802518 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802545:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80254a:	eb b1                	jmp    8024fd <ftruncate+0x50>
+
+0080254c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80254c:	55                   	push   %ebp
+  80254d:	89 e5                	mov    %esp,%ebp
+  80254f:	56                   	push   %esi
+  802550:	53                   	push   %ebx
+  802551:	83 ec 18             	sub    $0x18,%esp
+  802554:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802557:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80255a:	50                   	push   %eax
+  80255b:	ff 75 08             	push   0x8(%ebp)
+  80255e:	e8 0b fb ff ff       	call   80206e <fd_lookup>
+  802563:	83 c4 10             	add    $0x10,%esp
+  802566:	85 c0                	test   %eax,%eax
+  802568:	78 49                	js     8025b3 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80256a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80256d:	83 ec 08             	sub    $0x8,%esp
+  802570:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802573:	50                   	push   %eax
+  802574:	ff 36                	push   (%esi)
+  802576:	e8 43 fb ff ff       	call   8020be <dev_lookup>
+  80257b:	83 c4 10             	add    $0x10,%esp
+  80257e:	85 c0                	test   %eax,%eax
+  802580:	78 31                	js     8025b3 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802582:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802585:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802589:	74 2f                	je     8025ba <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80258b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80258e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802595:	00 00 00 
+	stat->st_isdir = 0;
+  802598:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80259f:	00 00 00 
+	stat->st_dev = dev;
+  8025a2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8025a8:	83 ec 08             	sub    $0x8,%esp
+  8025ab:	53                   	push   %ebx
+  8025ac:	56                   	push   %esi
+  8025ad:	ff 50 14             	call   *0x14(%eax)
+  8025b0:	83 c4 10             	add    $0x10,%esp
+}
+  8025b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025b6:	5b                   	pop    %ebx
+  8025b7:	5e                   	pop    %esi
+  8025b8:	5d                   	pop    %ebp
+  8025b9:	c3                   	ret
+		return -E_NOT_SUPP;
+  8025ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025bf:	eb f2                	jmp    8025b3 <fstat+0x67>
+
+008025c1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8025c1:	55                   	push   %ebp
+  8025c2:	89 e5                	mov    %esp,%ebp
+  8025c4:	56                   	push   %esi
+  8025c5:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8025c6:	83 ec 08             	sub    $0x8,%esp
+  8025c9:	6a 00                	push   $0x0
+  8025cb:	ff 75 08             	push   0x8(%ebp)
+  8025ce:	e8 e4 01 00 00       	call   8027b7 <open>
+  8025d3:	89 c3                	mov    %eax,%ebx
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	78 1b                	js     8025f7 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8025dc:	83 ec 08             	sub    $0x8,%esp
+  8025df:	ff 75 0c             	push   0xc(%ebp)
+  8025e2:	50                   	push   %eax
+  8025e3:	e8 64 ff ff ff       	call   80254c <fstat>
+  8025e8:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8025ea:	89 1c 24             	mov    %ebx,(%esp)
+  8025ed:	e8 c6 fb ff ff       	call   8021b8 <close>
+	return r;
+  8025f2:	83 c4 10             	add    $0x10,%esp
+  8025f5:	89 f3                	mov    %esi,%ebx
+}
+  8025f7:	89 d8                	mov    %ebx,%eax
+  8025f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025fc:	5b                   	pop    %ebx
+  8025fd:	5e                   	pop    %esi
+  8025fe:	5d                   	pop    %ebp
+  8025ff:	c3                   	ret
+
+00802600 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802600:	55                   	push   %ebp
+  802601:	89 e5                	mov    %esp,%ebp
+  802603:	56                   	push   %esi
+  802604:	53                   	push   %ebx
+  802605:	89 c6                	mov    %eax,%esi
+  802607:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802609:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  802610:	74 27                	je     802639 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802612:	6a 07                	push   $0x7
+  802614:	68 00 70 80 00       	push   $0x807000
+  802619:	56                   	push   %esi
+  80261a:	ff 35 00 60 80 00    	push   0x806000
+  802620:	e8 dd 14 00 00       	call   803b02 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802625:	83 c4 0c             	add    $0xc,%esp
+  802628:	6a 00                	push   $0x0
+  80262a:	53                   	push   %ebx
+  80262b:	6a 00                	push   $0x0
+  80262d:	e8 b8 14 00 00       	call   803aea <ipc_recv>
+}
+  802632:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802635:	5b                   	pop    %ebx
+  802636:	5e                   	pop    %esi
+  802637:	5d                   	pop    %ebp
+  802638:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802639:	83 ec 0c             	sub    $0xc,%esp
+  80263c:	6a 01                	push   $0x1
+  80263e:	e8 13 15 00 00       	call   803b56 <ipc_find_env>
+  802643:	a3 00 60 80 00       	mov    %eax,0x806000
+  802648:	83 c4 10             	add    $0x10,%esp
+  80264b:	eb c5                	jmp    802612 <fsipc+0x12>
+
+0080264d <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80264d:	55                   	push   %ebp
+  80264e:	89 e5                	mov    %esp,%ebp
+  802650:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802653:	8b 45 08             	mov    0x8(%ebp),%eax
+  802656:	8b 40 0c             	mov    0xc(%eax),%eax
+  802659:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80265e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802661:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802666:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266b:	b8 02 00 00 00       	mov    $0x2,%eax
+  802670:	e8 8b ff ff ff       	call   802600 <fsipc>
+}
+  802675:	c9                   	leave
+  802676:	c3                   	ret
+
+00802677 <devfile_flush>:
+{
+  802677:	55                   	push   %ebp
+  802678:	89 e5                	mov    %esp,%ebp
+  80267a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80267d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802680:	8b 40 0c             	mov    0xc(%eax),%eax
+  802683:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802688:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802692:	e8 69 ff ff ff       	call   802600 <fsipc>
+}
+  802697:	c9                   	leave
+  802698:	c3                   	ret
+
+00802699 <devfile_stat>:
+{
+  802699:	55                   	push   %ebp
+  80269a:	89 e5                	mov    %esp,%ebp
+  80269c:	53                   	push   %ebx
+  80269d:	83 ec 04             	sub    $0x4,%esp
+  8026a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8026a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026a9:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8026ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026b8:	e8 43 ff ff ff       	call   802600 <fsipc>
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	78 2c                	js     8026ed <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8026c1:	83 ec 08             	sub    $0x8,%esp
+  8026c4:	68 00 70 80 00       	push   $0x807000
+  8026c9:	53                   	push   %ebx
+  8026ca:	e8 ac e2 ff ff       	call   80097b <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8026cf:	a1 80 70 80 00       	mov    0x807080,%eax
+  8026d4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8026da:	a1 84 70 80 00       	mov    0x807084,%eax
+  8026df:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8026e5:	83 c4 10             	add    $0x10,%esp
+  8026e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026f0:	c9                   	leave
+  8026f1:	c3                   	ret
+
+008026f2 <devfile_write>:
+{
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	83 ec 0c             	sub    $0xc,%esp
+  8026f8:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026fe:	8b 52 0c             	mov    0xc(%edx),%edx
+  802701:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = n;
+  802707:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80270c:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802711:	39 d0                	cmp    %edx,%eax
+  802713:	0f 47 c2             	cmova  %edx,%eax
+  802716:	50                   	push   %eax
+  802717:	ff 75 0c             	push   0xc(%ebp)
+  80271a:	68 08 70 80 00       	push   $0x807008
+  80271f:	e8 dd e3 ff ff       	call   800b01 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802724:	ba 00 00 00 00       	mov    $0x0,%edx
+  802729:	b8 04 00 00 00       	mov    $0x4,%eax
+  80272e:	e8 cd fe ff ff       	call   802600 <fsipc>
+}
+  802733:	c9                   	leave
+  802734:	c3                   	ret
+
+00802735 <devfile_read>:
+{
+  802735:	55                   	push   %ebp
+  802736:	89 e5                	mov    %esp,%ebp
+  802738:	56                   	push   %esi
+  802739:	53                   	push   %ebx
+  80273a:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80273d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802740:	8b 40 0c             	mov    0xc(%eax),%eax
+  802743:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802748:	89 35 04 70 80 00    	mov    %esi,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80274e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802753:	b8 03 00 00 00       	mov    $0x3,%eax
+  802758:	e8 a3 fe ff ff       	call   802600 <fsipc>
+  80275d:	89 c3                	mov    %eax,%ebx
+  80275f:	85 c0                	test   %eax,%eax
+  802761:	78 1f                	js     802782 <devfile_read+0x4d>
+	assert(r <= n);
+  802763:	39 c6                	cmp    %eax,%esi
+  802765:	72 24                	jb     80278b <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802767:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80276c:	7f 33                	jg     8027a1 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80276e:	83 ec 04             	sub    $0x4,%esp
+  802771:	50                   	push   %eax
+  802772:	68 00 70 80 00       	push   $0x807000
+  802777:	ff 75 0c             	push   0xc(%ebp)
+  80277a:	e8 82 e3 ff ff       	call   800b01 <memmove>
+	return r;
+  80277f:	83 c4 10             	add    $0x10,%esp
+}
+  802782:	89 d8                	mov    %ebx,%eax
+  802784:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802787:	5b                   	pop    %ebx
+  802788:	5e                   	pop    %esi
+  802789:	5d                   	pop    %ebp
+  80278a:	c3                   	ret
+	assert(r <= n);
+  80278b:	68 b0 41 80 00       	push   $0x8041b0
+  802790:	68 b0 40 80 00       	push   $0x8040b0
+  802795:	6a 76                	push   $0x76
+  802797:	68 b7 41 80 00       	push   $0x8041b7
+  80279c:	e8 b7 da ff ff       	call   800258 <_panic>
+	assert(r <= PGSIZE);
+  8027a1:	68 c2 41 80 00       	push   $0x8041c2
+  8027a6:	68 b0 40 80 00       	push   $0x8040b0
+  8027ab:	6a 77                	push   $0x77
+  8027ad:	68 b7 41 80 00       	push   $0x8041b7
+  8027b2:	e8 a1 da ff ff       	call   800258 <_panic>
+
+008027b7 <open>:
+{
+  8027b7:	55                   	push   %ebp
+  8027b8:	89 e5                	mov    %esp,%ebp
+  8027ba:	56                   	push   %esi
+  8027bb:	53                   	push   %ebx
+  8027bc:	83 ec 1c             	sub    $0x1c,%esp
+  8027bf:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8027c2:	56                   	push   %esi
+  8027c3:	e8 78 e1 ff ff       	call   800940 <strlen>
+  8027c8:	83 c4 10             	add    $0x10,%esp
+  8027cb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8027d0:	7f 6c                	jg     80283e <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8027d2:	83 ec 0c             	sub    $0xc,%esp
+  8027d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027d8:	50                   	push   %eax
+  8027d9:	e8 3a f8 ff ff       	call   802018 <fd_alloc>
+  8027de:	89 c3                	mov    %eax,%ebx
+  8027e0:	83 c4 10             	add    $0x10,%esp
+  8027e3:	85 c0                	test   %eax,%eax
+  8027e5:	78 3c                	js     802823 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8027e7:	83 ec 08             	sub    $0x8,%esp
+  8027ea:	56                   	push   %esi
+  8027eb:	68 00 70 80 00       	push   $0x807000
+  8027f0:	e8 86 e1 ff ff       	call   80097b <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8027f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027f8:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8027fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802800:	b8 01 00 00 00       	mov    $0x1,%eax
+  802805:	e8 f6 fd ff ff       	call   802600 <fsipc>
+  80280a:	89 c3                	mov    %eax,%ebx
+  80280c:	83 c4 10             	add    $0x10,%esp
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	78 19                	js     80282c <open+0x75>
+	return fd2num(fd);
+  802813:	83 ec 0c             	sub    $0xc,%esp
+  802816:	ff 75 f4             	push   -0xc(%ebp)
+  802819:	e8 d3 f7 ff ff       	call   801ff1 <fd2num>
+  80281e:	89 c3                	mov    %eax,%ebx
+  802820:	83 c4 10             	add    $0x10,%esp
+}
+  802823:	89 d8                	mov    %ebx,%eax
+  802825:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802828:	5b                   	pop    %ebx
+  802829:	5e                   	pop    %esi
+  80282a:	5d                   	pop    %ebp
+  80282b:	c3                   	ret
+		fd_close(fd, 0);
+  80282c:	83 ec 08             	sub    $0x8,%esp
+  80282f:	6a 00                	push   $0x0
+  802831:	ff 75 f4             	push   -0xc(%ebp)
+  802834:	e8 f8 f8 ff ff       	call   802131 <fd_close>
+		return r;
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	eb e5                	jmp    802823 <open+0x6c>
+		return -E_BAD_PATH;
+  80283e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802843:	eb de                	jmp    802823 <open+0x6c>
+
+00802845 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802845:	55                   	push   %ebp
+  802846:	89 e5                	mov    %esp,%ebp
+  802848:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80284b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802850:	b8 08 00 00 00       	mov    $0x8,%eax
+  802855:	e8 a6 fd ff ff       	call   802600 <fsipc>
+}
+  80285a:	c9                   	leave
+  80285b:	c3                   	ret
+
+0080285c <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80285c:	55                   	push   %ebp
+  80285d:	89 e5                	mov    %esp,%ebp
+  80285f:	57                   	push   %edi
+  802860:	56                   	push   %esi
+  802861:	53                   	push   %ebx
+  802862:	81 ec 54 04 00 00    	sub    $0x454,%esp
+	//
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802868:	6a 00                	push   $0x0
+  80286a:	ff 75 08             	push   0x8(%ebp)
+  80286d:	e8 45 ff ff ff       	call   8027b7 <open>
+  802872:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802878:	83 c4 10             	add    $0x10,%esp
+  80287b:	85 c0                	test   %eax,%eax
+  80287d:	0f 88 7a 06 00 00    	js     802efd <spawn+0x6a1>
+  802883:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802885:	83 ec 04             	sub    $0x4,%esp
+  802888:	68 00 02 00 00       	push   $0x200
+  80288d:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802893:	50                   	push   %eax
+  802894:	51                   	push   %ecx
+  802895:	e8 01 fb ff ff       	call   80239b <readn>
+  80289a:	83 c4 10             	add    $0x10,%esp
+  80289d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8028a2:	75 7a                	jne    80291e <spawn+0xc2>
+	    || elf->e_magic != ELF_MAGIC) {
+  8028a4:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8028ab:	45 4c 46 
+  8028ae:	75 6e                	jne    80291e <spawn+0xc2>
+	__asm __volatile("int %2"
+  8028b0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8028b5:	cd 30                	int    $0x30
+  8028b7:	89 85 cc fb ff ff    	mov    %eax,-0x434(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8028bd:	89 c6                	mov    %eax,%esi
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	0f 88 2a 06 00 00    	js     802ef1 <spawn+0x695>
+		return r;
+	child = r;
+
+	// The child's memory is its own, not our demand-zero regions.
+	if ((r = sys_region_release(child, 0, UTOP)) < 0)
+  8028c7:	83 ec 04             	sub    $0x4,%esp
+  8028ca:	68 00 00 c0 ee       	push   $0xeec00000
+  8028cf:	6a 00                	push   $0x0
+  8028d1:	50                   	push   %eax
+  8028d2:	e8 15 ec ff ff       	call   8014ec <sys_region_release>
+  8028d7:	89 c7                	mov    %eax,%edi
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	85 c0                	test   %eax,%eax
+  8028de:	0f 88 da 05 00 00    	js     802ebe <spawn+0x662>
+		goto error;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8028e4:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8028ea:	69 f6 58 01 00 00    	imul   $0x158,%esi,%esi
+  8028f0:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8028f6:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8028fc:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802901:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802903:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802909:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  80290f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802914:	be 00 00 00 00       	mov    $0x0,%esi
+  802919:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80291c:	eb 4b                	jmp    802969 <spawn+0x10d>
+		close(fd);
+  80291e:	83 ec 0c             	sub    $0xc,%esp
+  802921:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802927:	e8 8c f8 ff ff       	call   8021b8 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80292c:	83 c4 0c             	add    $0xc,%esp
+  80292f:	68 7f 45 4c 46       	push   $0x464c457f
+  802934:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  80293a:	68 ce 41 80 00       	push   $0x8041ce
+  80293f:	e8 ef d9 ff ff       	call   800333 <cprintf>
+		return -E_NOT_EXEC;
+  802944:	83 c4 10             	add    $0x10,%esp
+  802947:	c7 85 d0 fb ff ff f2 	movl   $0xfffffff2,-0x430(%ebp)
+  80294e:	ff ff ff 
+  802951:	e9 a7 05 00 00       	jmp    802efd <spawn+0x6a1>
+		string_size += strlen(argv[argc]) + 1;
+  802956:	83 ec 0c             	sub    $0xc,%esp
+  802959:	50                   	push   %eax
+  80295a:	e8 e1 df ff ff       	call   800940 <strlen>
+  80295f:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802963:	83 c3 01             	add    $0x1,%ebx
+  802966:	83 c4 10             	add    $0x10,%esp
+  802969:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	75 e6                	jne    802956 <spawn+0xfa>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802970:	89 9d c4 fb ff ff    	mov    %ebx,-0x43c(%ebp)
+  802976:	b8 00 10 40 00       	mov    $0x401000,%eax
+  80297b:	29 f0                	sub    %esi,%eax
+  80297d:	89 c7                	mov    %eax,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80297f:	89 c2                	mov    %eax,%edx
+  802981:	83 e2 fc             	and    $0xfffffffc,%edx
+  802984:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80298b:	29 c2                	sub    %eax,%edx
+  80298d:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802993:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802996:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80299b:	0f 86 6a 05 00 00    	jbe    802f0b <spawn+0x6af>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8029a1:	83 ec 04             	sub    $0x4,%esp
+  8029a4:	6a 07                	push   $0x7
+  8029a6:	68 00 00 40 00       	push   $0x400000
+  8029ab:	6a 00                	push   $0x0
+  8029ad:	e8 c1 e4 ff ff       	call   800e73 <sys_page_alloc>
+  8029b2:	83 c4 10             	add    $0x10,%esp
+  8029b5:	85 c0                	test   %eax,%eax
+  8029b7:	0f 88 53 05 00 00    	js     802f10 <spawn+0x6b4>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8029bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c2:	89 9d c8 fb ff ff    	mov    %ebx,-0x438(%ebp)
+  8029c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8029cb:	eb 30                	jmp    8029fd <spawn+0x1a1>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8029cd:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8029d3:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  8029d9:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8029dc:	83 ec 08             	sub    $0x8,%esp
+  8029df:	ff 34 b3             	push   (%ebx,%esi,4)
+  8029e2:	57                   	push   %edi
+  8029e3:	e8 93 df ff ff       	call   80097b <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8029e8:	83 c4 04             	add    $0x4,%esp
+  8029eb:	ff 34 b3             	push   (%ebx,%esi,4)
+  8029ee:	e8 4d df ff ff       	call   800940 <strlen>
+  8029f3:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8029f7:	83 c6 01             	add    $0x1,%esi
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	39 b5 c8 fb ff ff    	cmp    %esi,-0x438(%ebp)
+  802a03:	7f c8                	jg     8029cd <spawn+0x171>
+	}
+	argv_store[argc] = 0;
+  802a05:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802a0b:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  802a11:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802a18:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802a1e:	0f 85 85 00 00 00    	jne    802aa9 <spawn+0x24d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802a24:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  802a2a:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  802a30:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  802a33:	89 d0                	mov    %edx,%eax
+  802a35:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  802a3b:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802a3e:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802a43:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802a49:	83 ec 0c             	sub    $0xc,%esp
+  802a4c:	6a 07                	push   $0x7
+  802a4e:	68 00 d0 bf ee       	push   $0xeebfd000
+  802a53:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802a59:	68 00 00 40 00       	push   $0x400000
+  802a5e:	6a 00                	push   $0x0
+  802a60:	e8 7b e4 ff ff       	call   800ee0 <sys_page_map>
+  802a65:	89 c3                	mov    %eax,%ebx
+  802a67:	83 c4 20             	add    $0x20,%esp
+  802a6a:	85 c0                	test   %eax,%eax
+  802a6c:	0f 88 a6 04 00 00    	js     802f18 <spawn+0x6bc>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802a72:	83 ec 08             	sub    $0x8,%esp
+  802a75:	68 00 00 40 00       	push   $0x400000
+  802a7a:	6a 00                	push   $0x0
+  802a7c:	e8 cd e4 ff ff       	call   800f4e <sys_page_unmap>
+  802a81:	89 c3                	mov    %eax,%ebx
+  802a83:	83 c4 10             	add    $0x10,%esp
+  802a86:	85 c0                	test   %eax,%eax
+  802a88:	0f 88 8a 04 00 00    	js     802f18 <spawn+0x6bc>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802a8e:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802a94:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa0:	89 df                	mov    %ebx,%edi
+  802aa2:	89 c3                	mov    %eax,%ebx
+  802aa4:	e9 8d 01 00 00       	jmp    802c36 <spawn+0x3da>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802aa9:	68 80 42 80 00       	push   $0x804280
+  802aae:	68 b0 40 80 00       	push   $0x8040b0
+  802ab3:	68 f3 00 00 00       	push   $0xf3
+  802ab8:	68 e8 41 80 00       	push   $0x8041e8
+  802abd:	e8 96 d7 ff ff       	call   800258 <_panic>
+	}
+
+	// The pages that come from the file, a chunk at a time: allocate
+	// the chunk at UTEMP, read it in, and move it to the child.
+	batch_init(&b);
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  802ac2:	01 fe                	add    %edi,%esi
+  802ac4:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+  802aca:	8b 85 c0 fb ff ff    	mov    -0x440(%ebp),%eax
+  802ad0:	39 c6                	cmp    %eax,%esi
+  802ad2:	0f 83 18 01 00 00    	jae    802bf0 <spawn+0x394>
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  802ad8:	8b 9d b8 fb ff ff    	mov    -0x448(%ebp),%ebx
+  802ade:	29 f3                	sub    %esi,%ebx
+  802ae0:	c1 eb 0c             	shr    $0xc,%ebx
+  802ae3:	b8 40 00 00 00       	mov    $0x40,%eax
+  802ae8:	39 c3                	cmp    %eax,%ebx
+  802aea:	0f 47 d8             	cmova  %eax,%ebx
+  802aed:	89 df                	mov    %ebx,%edi
+			SEGMENT_CHUNK);
+		batch_alloc(&b, 0, UTEMP, PTE_P|PTE_U|PTE_W, n);
+  802aef:	83 ec 0c             	sub    $0xc,%esp
+  802af2:	53                   	push   %ebx
+  802af3:	6a 07                	push   $0x7
+  802af5:	68 00 00 40 00       	push   $0x400000
+  802afa:	6a 00                	push   $0x0
+  802afc:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802b02:	50                   	push   %eax
+  802b03:	e8 48 f4 ff ff       	call   801f50 <batch_alloc>
+		if ((r = batch_flush(&b)) < 0)
+  802b08:	83 c4 14             	add    $0x14,%esp
+  802b0b:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802b11:	50                   	push   %eax
+  802b12:	e8 d4 f2 ff ff       	call   801deb <batch_flush>
+  802b17:	83 c4 10             	add    $0x10,%esp
+  802b1a:	85 c0                	test   %eax,%eax
+  802b1c:	0f 88 9a 03 00 00    	js     802ebc <spawn+0x660>
+			return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802b22:	83 ec 08             	sub    $0x8,%esp
+  802b25:	8b 85 bc fb ff ff    	mov    -0x444(%ebp),%eax
+  802b2b:	01 f0                	add    %esi,%eax
+  802b2d:	50                   	push   %eax
+  802b2e:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802b34:	e8 4b f9 ff ff       	call   802484 <seek>
+  802b39:	83 c4 10             	add    $0x10,%esp
+  802b3c:	85 c0                	test   %eax,%eax
+  802b3e:	0f 88 a1 03 00 00    	js     802ee5 <spawn+0x689>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802b44:	c1 e7 0c             	shl    $0xc,%edi
+  802b47:	83 ec 04             	sub    $0x4,%esp
+  802b4a:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  802b50:	8b 8d d4 fb ff ff    	mov    -0x42c(%ebp),%ecx
+  802b56:	29 c8                	sub    %ecx,%eax
+  802b58:	39 f8                	cmp    %edi,%eax
+  802b5a:	0f 47 c7             	cmova  %edi,%eax
+  802b5d:	50                   	push   %eax
+  802b5e:	68 00 00 40 00       	push   $0x400000
+  802b63:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802b69:	e8 2d f8 ff ff       	call   80239b <readn>
+  802b6e:	83 c4 10             	add    $0x10,%esp
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	0f 88 70 03 00 00    	js     802ee9 <spawn+0x68d>
+			return r;
+		batch_map(&b, 0, UTEMP, child, (void*) (va + i), perm, n);
+  802b79:	83 ec 04             	sub    $0x4,%esp
+  802b7c:	53                   	push   %ebx
+  802b7d:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  802b83:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802b89:	8b 95 c4 fb ff ff    	mov    -0x43c(%ebp),%edx
+  802b8f:	01 d0                	add    %edx,%eax
+  802b91:	50                   	push   %eax
+  802b92:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802b98:	68 00 00 40 00       	push   $0x400000
+  802b9d:	6a 00                	push   $0x0
+  802b9f:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802ba5:	50                   	push   %eax
+  802ba6:	e8 d0 f3 ff ff       	call   801f7b <batch_map>
+		batch_unmap(&b, 0, UTEMP, n);
+  802bab:	83 c4 20             	add    $0x20,%esp
+  802bae:	53                   	push   %ebx
+  802baf:	68 00 00 40 00       	push   $0x400000
+  802bb4:	6a 00                	push   $0x0
+  802bb6:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802bbc:	50                   	push   %eax
+  802bbd:	e8 e3 f3 ff ff       	call   801fa5 <batch_unmap>
+		if ((r = batch_flush(&b)) < 0)
+  802bc2:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802bc8:	89 04 24             	mov    %eax,(%esp)
+  802bcb:	e8 1b f2 ff ff       	call   801deb <batch_flush>
+  802bd0:	83 c4 10             	add    $0x10,%esp
+  802bd3:	85 c0                	test   %eax,%eax
+  802bd5:	0f 89 e7 fe ff ff    	jns    802ac2 <spawn+0x266>
+			panic("spawn: sys_page_map data: %e", r);
+  802bdb:	50                   	push   %eax
+  802bdc:	68 f4 41 80 00       	push   $0x8041f4
+  802be1:	68 2b 01 00 00       	push   $0x12b
+  802be6:	68 e8 41 80 00       	push   $0x8041e8
+  802beb:	e8 68 d6 ff ff       	call   800258 <_panic>
+	}
+
+	// the blank pages are demand-zero
+	if (i < memsz)
+  802bf0:	8b 9d ac fb ff ff    	mov    -0x454(%ebp),%ebx
+  802bf6:	8b bd a8 fb ff ff    	mov    -0x458(%ebp),%edi
+  802bfc:	89 f2                	mov    %esi,%edx
+  802bfe:	8b 85 b0 fb ff ff    	mov    -0x450(%ebp),%eax
+  802c04:	39 c6                	cmp    %eax,%esi
+  802c06:	73 28                	jae    802c30 <spawn+0x3d4>
+		return sys_region_reserve(child, (void*) (va + i), memsz - i,
+  802c08:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  802c0e:	29 f0                	sub    %esi,%eax
+  802c10:	50                   	push   %eax
+  802c11:	8b 85 c4 fb ff ff    	mov    -0x43c(%ebp),%eax
+  802c17:	01 c2                	add    %eax,%edx
+  802c19:	52                   	push   %edx
+  802c1a:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802c20:	e8 5b e8 ff ff       	call   801480 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802c25:	83 c4 10             	add    $0x10,%esp
+  802c28:	85 c0                	test   %eax,%eax
+  802c2a:	0f 88 bd 02 00 00    	js     802eed <spawn+0x691>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802c30:	83 c3 01             	add    $0x1,%ebx
+  802c33:	83 c7 20             	add    $0x20,%edi
+  802c36:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802c3d:	39 d8                	cmp    %ebx,%eax
+  802c3f:	0f 8e b2 00 00 00    	jle    802cf7 <spawn+0x49b>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802c45:	83 3f 01             	cmpl   $0x1,(%edi)
+  802c48:	75 e6                	jne    802c30 <spawn+0x3d4>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802c4a:	8b 47 18             	mov    0x18(%edi),%eax
+  802c4d:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802c50:	83 f8 01             	cmp    $0x1,%eax
+  802c53:	19 c0                	sbb    %eax,%eax
+  802c55:	83 e0 fe             	and    $0xfffffffe,%eax
+  802c58:	83 c0 07             	add    $0x7,%eax
+  802c5b:	89 85 b4 fb ff ff    	mov    %eax,-0x44c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802c61:	8b 57 04             	mov    0x4(%edi),%edx
+  802c64:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+  802c6a:	8b 77 10             	mov    0x10(%edi),%esi
+  802c6d:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+  802c73:	8b 47 14             	mov    0x14(%edi),%eax
+  802c76:	89 85 b0 fb ff ff    	mov    %eax,-0x450(%ebp)
+  802c7c:	8b 4f 08             	mov    0x8(%edi),%ecx
+  802c7f:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+	if ((i = PGOFF(va))) {
+  802c85:	89 c8                	mov    %ecx,%eax
+  802c87:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c8c:	74 1e                	je     802cac <spawn+0x450>
+		va -= i;
+  802c8e:	29 c1                	sub    %eax,%ecx
+  802c90:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+		memsz += i;
+  802c96:	01 85 b0 fb ff ff    	add    %eax,-0x450(%ebp)
+		filesz += i;
+  802c9c:	01 c6                	add    %eax,%esi
+  802c9e:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+		fileoffset -= i;
+  802ca4:	29 c2                	sub    %eax,%edx
+  802ca6:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+	batch_init(&b);
+  802cac:	83 ec 0c             	sub    $0xc,%esp
+  802caf:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802cb5:	50                   	push   %eax
+  802cb6:	e8 14 f1 ff ff       	call   801dcf <batch_init>
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  802cbb:	83 c4 10             	add    $0x10,%esp
+  802cbe:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc3:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  802cc9:	8b 8d b0 fb ff ff    	mov    -0x450(%ebp),%ecx
+  802ccf:	39 c8                	cmp    %ecx,%eax
+  802cd1:	0f 46 c8             	cmovbe %eax,%ecx
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  802cd4:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  802cda:	89 85 b8 fb ff ff    	mov    %eax,-0x448(%ebp)
+  802ce0:	89 9d ac fb ff ff    	mov    %ebx,-0x454(%ebp)
+  802ce6:	89 bd a8 fb ff ff    	mov    %edi,-0x458(%ebp)
+  802cec:	89 8d c0 fb ff ff    	mov    %ecx,-0x440(%ebp)
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  802cf2:	e9 cd fd ff ff       	jmp    802ac4 <spawn+0x268>
+	close(fd);
+  802cf7:	83 ec 0c             	sub    $0xc,%esp
+  802cfa:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802d00:	e8 b3 f4 ff ff       	call   8021b8 <close>
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	struct Batch b;
+	int i, r;
+	cprintf("copy_shared_pages(%x);\n", child);
+  802d05:	83 c4 08             	add    $0x8,%esp
+  802d08:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802d0e:	68 11 42 80 00       	push   $0x804211
+  802d13:	e8 1b d6 ff ff       	call   800333 <cprintf>
+	
+	batch_init(&b);
+  802d18:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802d1e:	89 04 24             	mov    %eax,(%esp)
+  802d21:	e8 a9 f0 ff ff       	call   801dcf <batch_init>
+	
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  802d26:	83 c4 10             	add    $0x10,%esp
+  802d29:	bb 00 00 00 00       	mov    $0x0,%ebx
+		// Handle PTE flags
+		assert(uvpt[i] & PTE_U);
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+		
+		// Map page (adjacent pages are mapped with one operation)
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  802d2e:	8d bd dc fb ff ff    	lea    -0x424(%ebp),%edi
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  802d34:	eb 22                	jmp    802d58 <spawn+0x4fc>
+			if (uvpd[i / NPTENTRIES] & PTE_SHARE)
+  802d36:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802d3d:	f6 c6 04             	test   $0x4,%dh
+  802d40:	0f 85 97 00 00 00    	jne    802ddd <spawn+0x581>
+			i = ROUNDUP(i + 1, NPTENTRIES) - 1;
+  802d46:	8d 9e 00 04 00 00    	lea    0x400(%esi),%ebx
+  802d4c:	81 e3 00 fc ff ff    	and    $0xfffffc00,%ebx
+  802d52:	83 eb 01             	sub    $0x1,%ebx
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  802d55:	83 c3 01             	add    $0x1,%ebx
+  802d58:	89 de                	mov    %ebx,%esi
+  802d5a:	81 fb fd eb 0e 00    	cmp    $0xeebfd,%ebx
+  802d60:	0f 87 bd 00 00 00    	ja     802e23 <spawn+0x5c7>
+		if (! (uvpd[i / NPTENTRIES] & PTE_P))
+  802d66:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+  802d6c:	85 db                	test   %ebx,%ebx
+  802d6e:	0f 49 c3             	cmovns %ebx,%eax
+  802d71:	c1 f8 0a             	sar    $0xa,%eax
+  802d74:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802d7b:	f6 c2 01             	test   $0x1,%dl
+  802d7e:	74 d5                	je     802d55 <spawn+0x4f9>
+		if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  802d80:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802d87:	f6 c2 80             	test   $0x80,%dl
+  802d8a:	75 aa                	jne    802d36 <spawn+0x4da>
+		if (! (uvpt[i] & PTE_P))
+  802d8c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802d93:	a8 01                	test   $0x1,%al
+  802d95:	74 be                	je     802d55 <spawn+0x4f9>
+		if (! (uvpt[i] & PTE_SHARE))
+  802d97:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802d9e:	f6 c4 04             	test   $0x4,%ah
+  802da1:	74 b2                	je     802d55 <spawn+0x4f9>
+		assert(uvpt[i] & PTE_U);
+  802da3:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802daa:	a8 04                	test   $0x4,%al
+  802dac:	74 5c                	je     802e0a <spawn+0x5ae>
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  802dae:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  802db5:	89 da                	mov    %ebx,%edx
+  802db7:	c1 e2 0c             	shl    $0xc,%edx
+  802dba:	83 ec 04             	sub    $0x4,%esp
+  802dbd:	6a 01                	push   $0x1
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  802dbf:	25 07 0e 00 00       	and    $0xe07,%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  802dc4:	50                   	push   %eax
+  802dc5:	52                   	push   %edx
+  802dc6:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802dcc:	52                   	push   %edx
+  802dcd:	6a 00                	push   $0x0
+  802dcf:	57                   	push   %edi
+  802dd0:	e8 a6 f1 ff ff       	call   801f7b <batch_map>
+  802dd5:	83 c4 20             	add    $0x20,%esp
+  802dd8:	e9 78 ff ff ff       	jmp    802d55 <spawn+0x4f9>
+					  uvpd[i / NPTENTRIES] & PTE_SYSCALL, 1);
+  802ddd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+					  (void *) (i * PGSIZE),
+  802de4:	c1 e3 0c             	shl    $0xc,%ebx
+				batch_map(&b, 0, (void *) (i * PGSIZE), child,
+  802de7:	83 ec 04             	sub    $0x4,%esp
+  802dea:	6a 01                	push   $0x1
+  802dec:	25 07 0e 00 00       	and    $0xe07,%eax
+  802df1:	50                   	push   %eax
+  802df2:	53                   	push   %ebx
+  802df3:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802df9:	53                   	push   %ebx
+  802dfa:	6a 00                	push   $0x0
+  802dfc:	57                   	push   %edi
+  802dfd:	e8 79 f1 ff ff       	call   801f7b <batch_map>
+  802e02:	83 c4 20             	add    $0x20,%esp
+  802e05:	e9 3c ff ff ff       	jmp    802d46 <spawn+0x4ea>
+		assert(uvpt[i] & PTE_U);
+  802e0a:	68 29 42 80 00       	push   $0x804229
+  802e0f:	68 b0 40 80 00       	push   $0x8040b0
+  802e14:	68 58 01 00 00       	push   $0x158
+  802e19:	68 e8 41 80 00       	push   $0x8041e8
+  802e1e:	e8 35 d4 ff ff       	call   800258 <_panic>
+	}
+	if ((r = batch_flush(&b)) < 0)
+  802e23:	83 ec 0c             	sub    $0xc,%esp
+  802e26:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802e2c:	50                   	push   %eax
+  802e2d:	e8 b9 ef ff ff       	call   801deb <batch_flush>
+  802e32:	83 c4 10             	add    $0x10,%esp
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	78 44                	js     802e7d <spawn+0x621>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802e39:	83 ec 08             	sub    $0x8,%esp
+  802e3c:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802e42:	50                   	push   %eax
+  802e43:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802e49:	e8 d6 e1 ff ff       	call   801024 <sys_env_set_trapframe>
+  802e4e:	83 c4 10             	add    $0x10,%esp
+  802e51:	85 c0                	test   %eax,%eax
+  802e53:	78 3d                	js     802e92 <spawn+0x636>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802e55:	83 ec 08             	sub    $0x8,%esp
+  802e58:	6a 02                	push   $0x2
+  802e5a:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802e60:	e8 54 e1 ff ff       	call   800fb9 <sys_env_set_status>
+  802e65:	83 c4 10             	add    $0x10,%esp
+  802e68:	85 c0                	test   %eax,%eax
+  802e6a:	78 3b                	js     802ea7 <spawn+0x64b>
+	return child;
+  802e6c:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  802e72:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802e78:	e9 80 00 00 00       	jmp    802efd <spawn+0x6a1>
+		panic("cannot map page: %e", r);
+  802e7d:	50                   	push   %eax
+  802e7e:	68 39 42 80 00       	push   $0x804239
+  802e83:	68 5f 01 00 00       	push   $0x15f
+  802e88:	68 e8 41 80 00       	push   $0x8041e8
+  802e8d:	e8 c6 d3 ff ff       	call   800258 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  802e92:	50                   	push   %eax
+  802e93:	68 4d 42 80 00       	push   $0x80424d
+  802e98:	68 87 00 00 00       	push   $0x87
+  802e9d:	68 e8 41 80 00       	push   $0x8041e8
+  802ea2:	e8 b1 d3 ff ff       	call   800258 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802ea7:	50                   	push   %eax
+  802ea8:	68 67 42 80 00       	push   $0x804267
+  802ead:	68 8a 00 00 00       	push   $0x8a
+  802eb2:	68 e8 41 80 00       	push   $0x8041e8
+  802eb7:	e8 9c d3 ff ff       	call   800258 <_panic>
+  802ebc:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802ebe:	83 ec 0c             	sub    $0xc,%esp
+  802ec1:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802ec7:	e8 b2 de ff ff       	call   800d7e <sys_env_destroy>
+	close(fd);
+  802ecc:	83 c4 04             	add    $0x4,%esp
+  802ecf:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802ed5:	e8 de f2 ff ff       	call   8021b8 <close>
+	return r;
+  802eda:	83 c4 10             	add    $0x10,%esp
+  802edd:	89 bd d0 fb ff ff    	mov    %edi,-0x430(%ebp)
+  802ee3:	eb 18                	jmp    802efd <spawn+0x6a1>
+  802ee5:	89 c7                	mov    %eax,%edi
+  802ee7:	eb d5                	jmp    802ebe <spawn+0x662>
+  802ee9:	89 c7                	mov    %eax,%edi
+  802eeb:	eb d1                	jmp    802ebe <spawn+0x662>
+  802eed:	89 c7                	mov    %eax,%edi
+  802eef:	eb cd                	jmp    802ebe <spawn+0x662>
+		return r;
+  802ef1:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  802ef7:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+}
+  802efd:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+  802f03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f06:	5b                   	pop    %ebx
+  802f07:	5e                   	pop    %esi
+  802f08:	5f                   	pop    %edi
+  802f09:	5d                   	pop    %ebp
+  802f0a:	c3                   	ret
+		return -E_NO_MEM;
+  802f0b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802f10:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802f16:	eb e5                	jmp    802efd <spawn+0x6a1>
+	sys_page_unmap(0, UTEMP);
+  802f18:	83 ec 08             	sub    $0x8,%esp
+  802f1b:	68 00 00 40 00       	push   $0x400000
+  802f20:	6a 00                	push   $0x0
+  802f22:	e8 27 e0 ff ff       	call   800f4e <sys_page_unmap>
+  802f27:	83 c4 10             	add    $0x10,%esp
+  802f2a:	89 9d d0 fb ff ff    	mov    %ebx,-0x430(%ebp)
+  802f30:	eb cb                	jmp    802efd <spawn+0x6a1>
+
+00802f32 <spawnl>:
+{
+  802f32:	55                   	push   %ebp
+  802f33:	89 e5                	mov    %esp,%ebp
+  802f35:	56                   	push   %esi
+  802f36:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802f37:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802f3f:	eb 05                	jmp    802f46 <spawnl+0x14>
+		argc++;
+  802f41:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802f44:	89 ca                	mov    %ecx,%edx
+  802f46:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802f49:	83 3a 00             	cmpl   $0x0,(%edx)
+  802f4c:	75 f3                	jne    802f41 <spawnl+0xf>
+	const char *argv[argc+2];
+  802f4e:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802f55:	83 e2 f0             	and    $0xfffffff0,%edx
+  802f58:	29 d4                	sub    %edx,%esp
+  802f5a:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802f5e:	89 da                	mov    %ebx,%edx
+  802f60:	c1 ea 02             	shr    $0x2,%edx
+  802f63:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802f66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f69:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802f70:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802f77:	00 
+	va_start(vl, arg0);
+  802f78:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802f7b:	89 c2                	mov    %eax,%edx
+  802f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f82:	eb 0b                	jmp    802f8f <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802f84:	83 c0 01             	add    $0x1,%eax
+  802f87:	8b 31                	mov    (%ecx),%esi
+  802f89:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802f8c:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802f8f:	39 d0                	cmp    %edx,%eax
+  802f91:	75 f1                	jne    802f84 <spawnl+0x52>
+	return spawn(prog, argv);
+  802f93:	83 ec 08             	sub    $0x8,%esp
+  802f96:	53                   	push   %ebx
+  802f97:	ff 75 08             	push   0x8(%ebp)
+  802f9a:	e8 bd f8 ff ff       	call   80285c <spawn>
+}
+  802f9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fa2:	5b                   	pop    %ebx
+  802fa3:	5e                   	pop    %esi
+  802fa4:	5d                   	pop    %ebp
+  802fa5:	c3                   	ret
+
+00802fa6 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802fa6:	55                   	push   %ebp
+  802fa7:	89 e5                	mov    %esp,%ebp
+  802fa9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802fac:	68 a6 42 80 00       	push   $0x8042a6
+  802fb1:	ff 75 0c             	push   0xc(%ebp)
+  802fb4:	e8 c2 d9 ff ff       	call   80097b <strcpy>
+	return 0;
+}
+  802fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbe:	c9                   	leave
+  802fbf:	c3                   	ret
+
+00802fc0 <devsock_close>:
+{
+  802fc0:	55                   	push   %ebp
+  802fc1:	89 e5                	mov    %esp,%ebp
+  802fc3:	53                   	push   %ebx
+  802fc4:	83 ec 10             	sub    $0x10,%esp
+  802fc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802fca:	53                   	push   %ebx
+  802fcb:	e8 c5 0b 00 00       	call   803b95 <pageref>
+  802fd0:	89 c2                	mov    %eax,%edx
+  802fd2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802fda:	83 fa 01             	cmp    $0x1,%edx
+  802fdd:	74 05                	je     802fe4 <devsock_close+0x24>
+}
+  802fdf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fe2:	c9                   	leave
+  802fe3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802fe4:	83 ec 0c             	sub    $0xc,%esp
+  802fe7:	ff 73 0c             	push   0xc(%ebx)
+  802fea:	e8 b7 02 00 00       	call   8032a6 <nsipc_close>
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	eb eb                	jmp    802fdf <devsock_close+0x1f>
+
+00802ff4 <devsock_write>:
+{
+  802ff4:	55                   	push   %ebp
+  802ff5:	89 e5                	mov    %esp,%ebp
+  802ff7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802ffa:	6a 00                	push   $0x0
+  802ffc:	ff 75 10             	push   0x10(%ebp)
+  802fff:	ff 75 0c             	push   0xc(%ebp)
+  803002:	8b 45 08             	mov    0x8(%ebp),%eax
+  803005:	ff 70 0c             	push   0xc(%eax)
+  803008:	e8 79 03 00 00       	call   803386 <nsipc_send>
+}
+  80300d:	c9                   	leave
+  80300e:	c3                   	ret
+
+0080300f <devsock_read>:
+{
+  80300f:	55                   	push   %ebp
+  803010:	89 e5                	mov    %esp,%ebp
+  803012:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803015:	6a 00                	push   $0x0
+  803017:	ff 75 10             	push   0x10(%ebp)
+  80301a:	ff 75 0c             	push   0xc(%ebp)
+  80301d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803020:	ff 70 0c             	push   0xc(%eax)
+  803023:	e8 ef 02 00 00       	call   803317 <nsipc_recv>
+}
+  803028:	c9                   	leave
+  803029:	c3                   	ret
+
+0080302a <fd2sockid>:
+{
+  80302a:	55                   	push   %ebp
+  80302b:	89 e5                	mov    %esp,%ebp
+  80302d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803030:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803033:	52                   	push   %edx
+  803034:	50                   	push   %eax
+  803035:	e8 34 f0 ff ff       	call   80206e <fd_lookup>
+  80303a:	83 c4 10             	add    $0x10,%esp
+  80303d:	85 c0                	test   %eax,%eax
+  80303f:	78 10                	js     803051 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803041:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803044:	8b 0d 28 50 80 00    	mov    0x805028,%ecx
+  80304a:	39 08                	cmp    %ecx,(%eax)
+  80304c:	75 05                	jne    803053 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80304e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803051:	c9                   	leave
+  803052:	c3                   	ret
+		return -E_NOT_SUPP;
+  803053:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803058:	eb f7                	jmp    803051 <fd2sockid+0x27>
+
+0080305a <alloc_sockfd>:
+{
+  80305a:	55                   	push   %ebp
+  80305b:	89 e5                	mov    %esp,%ebp
+  80305d:	56                   	push   %esi
+  80305e:	53                   	push   %ebx
+  80305f:	83 ec 1c             	sub    $0x1c,%esp
+  803062:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803064:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803067:	50                   	push   %eax
+  803068:	e8 ab ef ff ff       	call   802018 <fd_alloc>
+  80306d:	89 c3                	mov    %eax,%ebx
+  80306f:	83 c4 10             	add    $0x10,%esp
+  803072:	85 c0                	test   %eax,%eax
+  803074:	78 43                	js     8030b9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803076:	83 ec 04             	sub    $0x4,%esp
+  803079:	68 07 04 00 00       	push   $0x407
+  80307e:	ff 75 f4             	push   -0xc(%ebp)
+  803081:	6a 00                	push   $0x0
+  803083:	e8 eb dd ff ff       	call   800e73 <sys_page_alloc>
+  803088:	89 c3                	mov    %eax,%ebx
+  80308a:	83 c4 10             	add    $0x10,%esp
+  80308d:	85 c0                	test   %eax,%eax
+  80308f:	78 28                	js     8030b9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803091:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803094:	8b 15 28 50 80 00    	mov    0x805028,%edx
+  80309a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80309c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80309f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8030a6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8030a9:	83 ec 0c             	sub    $0xc,%esp
+  8030ac:	50                   	push   %eax
+  8030ad:	e8 3f ef ff ff       	call   801ff1 <fd2num>
+  8030b2:	89 c3                	mov    %eax,%ebx
+  8030b4:	83 c4 10             	add    $0x10,%esp
+  8030b7:	eb 0c                	jmp    8030c5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8030b9:	83 ec 0c             	sub    $0xc,%esp
+  8030bc:	56                   	push   %esi
+  8030bd:	e8 e4 01 00 00       	call   8032a6 <nsipc_close>
+		return r;
+  8030c2:	83 c4 10             	add    $0x10,%esp
+}
+  8030c5:	89 d8                	mov    %ebx,%eax
+  8030c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030ca:	5b                   	pop    %ebx
+  8030cb:	5e                   	pop    %esi
+  8030cc:	5d                   	pop    %ebp
+  8030cd:	c3                   	ret
+
+008030ce <accept>:
+{
+  8030ce:	55                   	push   %ebp
+  8030cf:	89 e5                	mov    %esp,%ebp
+  8030d1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030d7:	e8 4e ff ff ff       	call   80302a <fd2sockid>
+  8030dc:	85 c0                	test   %eax,%eax
+  8030de:	78 1b                	js     8030fb <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8030e0:	83 ec 04             	sub    $0x4,%esp
+  8030e3:	ff 75 10             	push   0x10(%ebp)
+  8030e6:	ff 75 0c             	push   0xc(%ebp)
+  8030e9:	50                   	push   %eax
+  8030ea:	e8 0e 01 00 00       	call   8031fd <nsipc_accept>
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 05                	js     8030fb <accept+0x2d>
+	return alloc_sockfd(r);
+  8030f6:	e8 5f ff ff ff       	call   80305a <alloc_sockfd>
+}
+  8030fb:	c9                   	leave
+  8030fc:	c3                   	ret
+
+008030fd <bind>:
+{
+  8030fd:	55                   	push   %ebp
+  8030fe:	89 e5                	mov    %esp,%ebp
+  803100:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803103:	8b 45 08             	mov    0x8(%ebp),%eax
+  803106:	e8 1f ff ff ff       	call   80302a <fd2sockid>
+  80310b:	85 c0                	test   %eax,%eax
+  80310d:	78 12                	js     803121 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80310f:	83 ec 04             	sub    $0x4,%esp
+  803112:	ff 75 10             	push   0x10(%ebp)
+  803115:	ff 75 0c             	push   0xc(%ebp)
+  803118:	50                   	push   %eax
+  803119:	e8 31 01 00 00       	call   80324f <nsipc_bind>
+  80311e:	83 c4 10             	add    $0x10,%esp
+}
+  803121:	c9                   	leave
+  803122:	c3                   	ret
+
+00803123 <shutdown>:
+{
+  803123:	55                   	push   %ebp
+  803124:	89 e5                	mov    %esp,%ebp
+  803126:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803129:	8b 45 08             	mov    0x8(%ebp),%eax
+  80312c:	e8 f9 fe ff ff       	call   80302a <fd2sockid>
+  803131:	85 c0                	test   %eax,%eax
+  803133:	78 0f                	js     803144 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803135:	83 ec 08             	sub    $0x8,%esp
+  803138:	ff 75 0c             	push   0xc(%ebp)
+  80313b:	50                   	push   %eax
+  80313c:	e8 43 01 00 00       	call   803284 <nsipc_shutdown>
+  803141:	83 c4 10             	add    $0x10,%esp
+}
+  803144:	c9                   	leave
+  803145:	c3                   	ret
+
+00803146 <connect>:
+{
+  803146:	55                   	push   %ebp
+  803147:	89 e5                	mov    %esp,%ebp
+  803149:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80314c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80314f:	e8 d6 fe ff ff       	call   80302a <fd2sockid>
+  803154:	85 c0                	test   %eax,%eax
+  803156:	78 12                	js     80316a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803158:	83 ec 04             	sub    $0x4,%esp
+  80315b:	ff 75 10             	push   0x10(%ebp)
+  80315e:	ff 75 0c             	push   0xc(%ebp)
+  803161:	50                   	push   %eax
+  803162:	e8 59 01 00 00       	call   8032c0 <nsipc_connect>
+  803167:	83 c4 10             	add    $0x10,%esp
+}
+  80316a:	c9                   	leave
+  80316b:	c3                   	ret
+
+0080316c <listen>:
+{
+  80316c:	55                   	push   %ebp
+  80316d:	89 e5                	mov    %esp,%ebp
+  80316f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803172:	8b 45 08             	mov    0x8(%ebp),%eax
+  803175:	e8 b0 fe ff ff       	call   80302a <fd2sockid>
+  80317a:	85 c0                	test   %eax,%eax
+  80317c:	78 0f                	js     80318d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80317e:	83 ec 08             	sub    $0x8,%esp
+  803181:	ff 75 0c             	push   0xc(%ebp)
+  803184:	50                   	push   %eax
+  803185:	e8 6b 01 00 00       	call   8032f5 <nsipc_listen>
+  80318a:	83 c4 10             	add    $0x10,%esp
+}
+  80318d:	c9                   	leave
+  80318e:	c3                   	ret
+
+0080318f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80318f:	55                   	push   %ebp
+  803190:	89 e5                	mov    %esp,%ebp
+  803192:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803195:	ff 75 10             	push   0x10(%ebp)
+  803198:	ff 75 0c             	push   0xc(%ebp)
+  80319b:	ff 75 08             	push   0x8(%ebp)
+  80319e:	e8 41 02 00 00       	call   8033e4 <nsipc_socket>
+  8031a3:	83 c4 10             	add    $0x10,%esp
+  8031a6:	85 c0                	test   %eax,%eax
+  8031a8:	78 05                	js     8031af <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8031aa:	e8 ab fe ff ff       	call   80305a <alloc_sockfd>
+}
+  8031af:	c9                   	leave
+  8031b0:	c3                   	ret
+
+008031b1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8031b1:	55                   	push   %ebp
+  8031b2:	89 e5                	mov    %esp,%ebp
+  8031b4:	53                   	push   %ebx
+  8031b5:	83 ec 04             	sub    $0x4,%esp
+  8031b8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8031ba:	83 3d 04 60 80 00 00 	cmpl   $0x0,0x806004
+  8031c1:	74 26                	je     8031e9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8031c3:	6a 07                	push   $0x7
+  8031c5:	68 00 80 80 00       	push   $0x808000
+  8031ca:	53                   	push   %ebx
+  8031cb:	ff 35 04 60 80 00    	push   0x806004
+  8031d1:	e8 2c 09 00 00       	call   803b02 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8031d6:	83 c4 0c             	add    $0xc,%esp
+  8031d9:	6a 00                	push   $0x0
+  8031db:	6a 00                	push   $0x0
+  8031dd:	6a 00                	push   $0x0
+  8031df:	e8 06 09 00 00       	call   803aea <ipc_recv>
+}
+  8031e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031e7:	c9                   	leave
+  8031e8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8031e9:	83 ec 0c             	sub    $0xc,%esp
+  8031ec:	6a 02                	push   $0x2
+  8031ee:	e8 63 09 00 00       	call   803b56 <ipc_find_env>
+  8031f3:	a3 04 60 80 00       	mov    %eax,0x806004
+  8031f8:	83 c4 10             	add    $0x10,%esp
+  8031fb:	eb c6                	jmp    8031c3 <nsipc+0x12>
+
+008031fd <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8031fd:	55                   	push   %ebp
+  8031fe:	89 e5                	mov    %esp,%ebp
+  803200:	56                   	push   %esi
+  803201:	53                   	push   %ebx
+  803202:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803205:	8b 45 08             	mov    0x8(%ebp),%eax
+  803208:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80320d:	8b 06                	mov    (%esi),%eax
+  80320f:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803214:	b8 01 00 00 00       	mov    $0x1,%eax
+  803219:	e8 93 ff ff ff       	call   8031b1 <nsipc>
+  80321e:	89 c3                	mov    %eax,%ebx
+  803220:	85 c0                	test   %eax,%eax
+  803222:	79 09                	jns    80322d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803224:	89 d8                	mov    %ebx,%eax
+  803226:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803229:	5b                   	pop    %ebx
+  80322a:	5e                   	pop    %esi
+  80322b:	5d                   	pop    %ebp
+  80322c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80322d:	83 ec 04             	sub    $0x4,%esp
+  803230:	ff 35 10 80 80 00    	push   0x808010
+  803236:	68 00 80 80 00       	push   $0x808000
+  80323b:	ff 75 0c             	push   0xc(%ebp)
+  80323e:	e8 be d8 ff ff       	call   800b01 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803243:	a1 10 80 80 00       	mov    0x808010,%eax
+  803248:	89 06                	mov    %eax,(%esi)
+  80324a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80324d:	eb d5                	jmp    803224 <nsipc_accept+0x27>
+
+0080324f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80324f:	55                   	push   %ebp
+  803250:	89 e5                	mov    %esp,%ebp
+  803252:	53                   	push   %ebx
+  803253:	83 ec 08             	sub    $0x8,%esp
+  803256:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803259:	8b 45 08             	mov    0x8(%ebp),%eax
+  80325c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803261:	53                   	push   %ebx
+  803262:	ff 75 0c             	push   0xc(%ebp)
+  803265:	68 04 80 80 00       	push   $0x808004
+  80326a:	e8 92 d8 ff ff       	call   800b01 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80326f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  803275:	b8 02 00 00 00       	mov    $0x2,%eax
+  80327a:	e8 32 ff ff ff       	call   8031b1 <nsipc>
+}
+  80327f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803282:	c9                   	leave
+  803283:	c3                   	ret
+
+00803284 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803284:	55                   	push   %ebp
+  803285:	89 e5                	mov    %esp,%ebp
+  803287:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80328a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80328d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  803292:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803295:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80329a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80329f:	e8 0d ff ff ff       	call   8031b1 <nsipc>
+}
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+
+008032a6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8032a6:	55                   	push   %ebp
+  8032a7:	89 e5                	mov    %esp,%ebp
+  8032a9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8032ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032af:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8032b4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8032b9:	e8 f3 fe ff ff       	call   8031b1 <nsipc>
+}
+  8032be:	c9                   	leave
+  8032bf:	c3                   	ret
+
+008032c0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8032c0:	55                   	push   %ebp
+  8032c1:	89 e5                	mov    %esp,%ebp
+  8032c3:	53                   	push   %ebx
+  8032c4:	83 ec 08             	sub    $0x8,%esp
+  8032c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8032ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032cd:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8032d2:	53                   	push   %ebx
+  8032d3:	ff 75 0c             	push   0xc(%ebp)
+  8032d6:	68 04 80 80 00       	push   $0x808004
+  8032db:	e8 21 d8 ff ff       	call   800b01 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8032e0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8032e6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8032eb:	e8 c1 fe ff ff       	call   8031b1 <nsipc>
+}
+  8032f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032f3:	c9                   	leave
+  8032f4:	c3                   	ret
+
+008032f5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8032f5:	55                   	push   %ebp
+  8032f6:	89 e5                	mov    %esp,%ebp
+  8032f8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8032fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032fe:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  803303:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803306:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  80330b:	b8 06 00 00 00       	mov    $0x6,%eax
+  803310:	e8 9c fe ff ff       	call   8031b1 <nsipc>
+}
+  803315:	c9                   	leave
+  803316:	c3                   	ret
+
+00803317 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803317:	55                   	push   %ebp
+  803318:	89 e5                	mov    %esp,%ebp
+  80331a:	56                   	push   %esi
+  80331b:	53                   	push   %ebx
+  80331c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80331f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803322:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  803327:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80332d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803330:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803335:	b8 07 00 00 00       	mov    $0x7,%eax
+  80333a:	e8 72 fe ff ff       	call   8031b1 <nsipc>
+  80333f:	89 c3                	mov    %eax,%ebx
+  803341:	85 c0                	test   %eax,%eax
+  803343:	78 22                	js     803367 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803345:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80334a:	39 c6                	cmp    %eax,%esi
+  80334c:	0f 4e c6             	cmovle %esi,%eax
+  80334f:	39 c3                	cmp    %eax,%ebx
+  803351:	7f 1d                	jg     803370 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803353:	83 ec 04             	sub    $0x4,%esp
+  803356:	53                   	push   %ebx
+  803357:	68 00 80 80 00       	push   $0x808000
+  80335c:	ff 75 0c             	push   0xc(%ebp)
+  80335f:	e8 9d d7 ff ff       	call   800b01 <memmove>
+  803364:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803367:	89 d8                	mov    %ebx,%eax
+  803369:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80336c:	5b                   	pop    %ebx
+  80336d:	5e                   	pop    %esi
+  80336e:	5d                   	pop    %ebp
+  80336f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803370:	68 b2 42 80 00       	push   $0x8042b2
+  803375:	68 b0 40 80 00       	push   $0x8040b0
+  80337a:	6a 62                	push   $0x62
+  80337c:	68 c7 42 80 00       	push   $0x8042c7
+  803381:	e8 d2 ce ff ff       	call   800258 <_panic>
+
+00803386 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803386:	55                   	push   %ebp
+  803387:	89 e5                	mov    %esp,%ebp
+  803389:	53                   	push   %ebx
+  80338a:	83 ec 04             	sub    $0x4,%esp
+  80338d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803390:	8b 45 08             	mov    0x8(%ebp),%eax
+  803393:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  803398:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80339e:	7f 2e                	jg     8033ce <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8033a0:	83 ec 04             	sub    $0x4,%esp
+  8033a3:	53                   	push   %ebx
+  8033a4:	ff 75 0c             	push   0xc(%ebp)
+  8033a7:	68 0c 80 80 00       	push   $0x80800c
+  8033ac:	e8 50 d7 ff ff       	call   800b01 <memmove>
+	nsipcbuf.send.req_size = size;
+  8033b1:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8033b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033ba:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8033bf:	b8 08 00 00 00       	mov    $0x8,%eax
+  8033c4:	e8 e8 fd ff ff       	call   8031b1 <nsipc>
+}
+  8033c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033cc:	c9                   	leave
+  8033cd:	c3                   	ret
+	assert(size < 1600);
+  8033ce:	68 d3 42 80 00       	push   $0x8042d3
+  8033d3:	68 b0 40 80 00       	push   $0x8040b0
+  8033d8:	6a 6d                	push   $0x6d
+  8033da:	68 c7 42 80 00       	push   $0x8042c7
+  8033df:	e8 74 ce ff ff       	call   800258 <_panic>
+
+008033e4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8033e4:	55                   	push   %ebp
+  8033e5:	89 e5                	mov    %esp,%ebp
+  8033e7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8033ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033ed:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8033f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033f5:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8033fa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033fd:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803402:	b8 09 00 00 00       	mov    $0x9,%eax
+  803407:	e8 a5 fd ff ff       	call   8031b1 <nsipc>
+}
+  80340c:	c9                   	leave
+  80340d:	c3                   	ret
+
+0080340e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80340e:	55                   	push   %ebp
+  80340f:	89 e5                	mov    %esp,%ebp
+  803411:	56                   	push   %esi
+  803412:	53                   	push   %ebx
+  803413:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803416:	83 ec 0c             	sub    $0xc,%esp
+  803419:	ff 75 08             	push   0x8(%ebp)
+  80341c:	e8 e0 eb ff ff       	call   802001 <fd2data>
+  803421:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803423:	83 c4 08             	add    $0x8,%esp
+  803426:	68 df 42 80 00       	push   $0x8042df
+  80342b:	53                   	push   %ebx
+  80342c:	e8 4a d5 ff ff       	call   80097b <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803431:	8b 46 04             	mov    0x4(%esi),%eax
+  803434:	2b 06                	sub    (%esi),%eax
+  803436:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80343c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803443:	00 00 00 
+	stat->st_dev = &devpipe;
+  803446:	c7 83 88 00 00 00 44 	movl   $0x805044,0x88(%ebx)
+  80344d:	50 80 00 
+	return 0;
+}
+  803450:	b8 00 00 00 00       	mov    $0x0,%eax
+  803455:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803458:	5b                   	pop    %ebx
+  803459:	5e                   	pop    %esi
+  80345a:	5d                   	pop    %ebp
+  80345b:	c3                   	ret
+
+0080345c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80345c:	55                   	push   %ebp
+  80345d:	89 e5                	mov    %esp,%ebp
+  80345f:	53                   	push   %ebx
+  803460:	83 ec 0c             	sub    $0xc,%esp
+  803463:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803466:	53                   	push   %ebx
+  803467:	6a 00                	push   $0x0
+  803469:	e8 e0 da ff ff       	call   800f4e <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80346e:	89 1c 24             	mov    %ebx,(%esp)
+  803471:	e8 8b eb ff ff       	call   802001 <fd2data>
+  803476:	83 c4 08             	add    $0x8,%esp
+  803479:	50                   	push   %eax
+  80347a:	6a 00                	push   $0x0
+  80347c:	e8 cd da ff ff       	call   800f4e <sys_page_unmap>
+}
+  803481:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803484:	c9                   	leave
+  803485:	c3                   	ret
+
+00803486 <_pipeisclosed>:
+{
+  803486:	55                   	push   %ebp
+  803487:	89 e5                	mov    %esp,%ebp
+  803489:	57                   	push   %edi
+  80348a:	56                   	push   %esi
+  80348b:	53                   	push   %ebx
+  80348c:	83 ec 1c             	sub    $0x1c,%esp
+  80348f:	89 c7                	mov    %eax,%edi
+  803491:	89 d6                	mov    %edx,%esi
+  803493:	eb 3c                	jmp    8034d1 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  803495:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  803498:	83 ec 0c             	sub    $0xc,%esp
+  80349b:	57                   	push   %edi
+  80349c:	e8 f4 06 00 00       	call   803b95 <pageref>
+  8034a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8034a4:	89 34 24             	mov    %esi,(%esp)
+  8034a7:	e8 e9 06 00 00       	call   803b95 <pageref>
+  8034ac:	89 c2                	mov    %eax,%edx
+  8034ae:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8034b0:	05 00 00 00 20       	add    $0x20000000,%eax
+  8034b5:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8034b8:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8034be:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8034c3:	76 31                	jbe    8034f6 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8034c5:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8034c8:	39 c3                	cmp    %eax,%ebx
+  8034ca:	74 76                	je     803542 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8034cc:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8034cf:	74 36                	je     803507 <_pipeisclosed+0x81>
+  8034d1:	89 e0                	mov    %esp,%eax
+  8034d3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8034d8:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8034de:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8034e3:	77 b0                	ja     803495 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8034e5:	c1 e8 10             	shr    $0x10,%eax
+  8034e8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8034ee:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8034f4:	eb 9f                	jmp    803495 <_pipeisclosed+0xf>
+  8034f6:	c1 e8 10             	shr    $0x10,%eax
+  8034f9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8034ff:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  803505:	eb be                	jmp    8034c5 <_pipeisclosed+0x3f>
+  803507:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803509:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80350e:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803514:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803519:	76 16                	jbe    803531 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80351b:	8b 42 58             	mov    0x58(%edx),%eax
+  80351e:	6a 01                	push   $0x1
+  803520:	50                   	push   %eax
+  803521:	53                   	push   %ebx
+  803522:	68 e6 42 80 00       	push   $0x8042e6
+  803527:	e8 07 ce ff ff       	call   800333 <cprintf>
+  80352c:	83 c4 10             	add    $0x10,%esp
+  80352f:	eb a0                	jmp    8034d1 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803531:	c1 e8 10             	shr    $0x10,%eax
+  803534:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80353a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803540:	eb d9                	jmp    80351b <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  803542:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  803545:	0f 94 c0             	sete   %al
+  803548:	0f b6 c0             	movzbl %al,%eax
+}
+  80354b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80354e:	5b                   	pop    %ebx
+  80354f:	5e                   	pop    %esi
+  803550:	5f                   	pop    %edi
+  803551:	5d                   	pop    %ebp
+  803552:	c3                   	ret
+
+00803553 <devpipe_write>:
+{
+  803553:	55                   	push   %ebp
+  803554:	89 e5                	mov    %esp,%ebp
+  803556:	57                   	push   %edi
+  803557:	56                   	push   %esi
+  803558:	53                   	push   %ebx
+  803559:	83 ec 28             	sub    $0x28,%esp
+  80355c:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80355f:	56                   	push   %esi
+  803560:	e8 9c ea ff ff       	call   802001 <fd2data>
+  803565:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803567:	83 c4 10             	add    $0x10,%esp
+  80356a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80356f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803572:	75 09                	jne    80357d <devpipe_write+0x2a>
+	return i;
+  803574:	89 f8                	mov    %edi,%eax
+  803576:	eb 23                	jmp    80359b <devpipe_write+0x48>
+			sys_yield();
+  803578:	e8 b0 d8 ff ff       	call   800e2d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80357d:	8b 43 04             	mov    0x4(%ebx),%eax
+  803580:	8b 0b                	mov    (%ebx),%ecx
+  803582:	8d 51 20             	lea    0x20(%ecx),%edx
+  803585:	39 d0                	cmp    %edx,%eax
+  803587:	72 1a                	jb     8035a3 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803589:	89 da                	mov    %ebx,%edx
+  80358b:	89 f0                	mov    %esi,%eax
+  80358d:	e8 f4 fe ff ff       	call   803486 <_pipeisclosed>
+  803592:	85 c0                	test   %eax,%eax
+  803594:	74 e2                	je     803578 <devpipe_write+0x25>
+				return 0;
+  803596:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80359b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80359e:	5b                   	pop    %ebx
+  80359f:	5e                   	pop    %esi
+  8035a0:	5f                   	pop    %edi
+  8035a1:	5d                   	pop    %ebp
+  8035a2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8035a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8035a6:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8035aa:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8035ad:	89 c2                	mov    %eax,%edx
+  8035af:	c1 fa 1f             	sar    $0x1f,%edx
+  8035b2:	89 d1                	mov    %edx,%ecx
+  8035b4:	c1 e9 1b             	shr    $0x1b,%ecx
+  8035b7:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8035ba:	83 e2 1f             	and    $0x1f,%edx
+  8035bd:	29 ca                	sub    %ecx,%edx
+  8035bf:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8035c3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8035c7:	83 c0 01             	add    $0x1,%eax
+  8035ca:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8035cd:	83 c7 01             	add    $0x1,%edi
+  8035d0:	eb 9d                	jmp    80356f <devpipe_write+0x1c>
+
+008035d2 <devpipe_read>:
+{
+  8035d2:	55                   	push   %ebp
+  8035d3:	89 e5                	mov    %esp,%ebp
+  8035d5:	57                   	push   %edi
+  8035d6:	56                   	push   %esi
+  8035d7:	53                   	push   %ebx
+  8035d8:	83 ec 18             	sub    $0x18,%esp
+  8035db:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8035de:	57                   	push   %edi
+  8035df:	e8 1d ea ff ff       	call   802001 <fd2data>
+  8035e4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8035e6:	83 c4 10             	add    $0x10,%esp
+  8035e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8035ee:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8035f1:	75 13                	jne    803606 <devpipe_read+0x34>
+	return i;
+  8035f3:	89 f0                	mov    %esi,%eax
+  8035f5:	eb 02                	jmp    8035f9 <devpipe_read+0x27>
+				return i;
+  8035f7:	89 f0                	mov    %esi,%eax
+}
+  8035f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035fc:	5b                   	pop    %ebx
+  8035fd:	5e                   	pop    %esi
+  8035fe:	5f                   	pop    %edi
+  8035ff:	5d                   	pop    %ebp
+  803600:	c3                   	ret
+			sys_yield();
+  803601:	e8 27 d8 ff ff       	call   800e2d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803606:	8b 03                	mov    (%ebx),%eax
+  803608:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80360b:	75 18                	jne    803625 <devpipe_read+0x53>
+			if (i > 0)
+  80360d:	85 f6                	test   %esi,%esi
+  80360f:	75 e6                	jne    8035f7 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803611:	89 da                	mov    %ebx,%edx
+  803613:	89 f8                	mov    %edi,%eax
+  803615:	e8 6c fe ff ff       	call   803486 <_pipeisclosed>
+  80361a:	85 c0                	test   %eax,%eax
+  80361c:	74 e3                	je     803601 <devpipe_read+0x2f>
+				return 0;
+  80361e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803623:	eb d4                	jmp    8035f9 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803625:	99                   	cltd
+  803626:	c1 ea 1b             	shr    $0x1b,%edx
+  803629:	01 d0                	add    %edx,%eax
+  80362b:	83 e0 1f             	and    $0x1f,%eax
+  80362e:	29 d0                	sub    %edx,%eax
+  803630:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803635:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803638:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80363b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80363e:	83 c6 01             	add    $0x1,%esi
+  803641:	eb ab                	jmp    8035ee <devpipe_read+0x1c>
+
+00803643 <pipe>:
+{
+  803643:	55                   	push   %ebp
+  803644:	89 e5                	mov    %esp,%ebp
+  803646:	56                   	push   %esi
+  803647:	53                   	push   %ebx
+  803648:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80364b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80364e:	50                   	push   %eax
+  80364f:	e8 c4 e9 ff ff       	call   802018 <fd_alloc>
+  803654:	89 c3                	mov    %eax,%ebx
+  803656:	83 c4 10             	add    $0x10,%esp
+  803659:	85 c0                	test   %eax,%eax
+  80365b:	0f 88 23 01 00 00    	js     803784 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803661:	83 ec 04             	sub    $0x4,%esp
+  803664:	68 07 04 00 00       	push   $0x407
+  803669:	ff 75 f4             	push   -0xc(%ebp)
+  80366c:	6a 00                	push   $0x0
+  80366e:	e8 00 d8 ff ff       	call   800e73 <sys_page_alloc>
+  803673:	89 c3                	mov    %eax,%ebx
+  803675:	83 c4 10             	add    $0x10,%esp
+  803678:	85 c0                	test   %eax,%eax
+  80367a:	0f 88 04 01 00 00    	js     803784 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803680:	83 ec 0c             	sub    $0xc,%esp
+  803683:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803686:	50                   	push   %eax
+  803687:	e8 8c e9 ff ff       	call   802018 <fd_alloc>
+  80368c:	89 c3                	mov    %eax,%ebx
+  80368e:	83 c4 10             	add    $0x10,%esp
+  803691:	85 c0                	test   %eax,%eax
+  803693:	0f 88 db 00 00 00    	js     803774 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803699:	83 ec 04             	sub    $0x4,%esp
+  80369c:	68 07 04 00 00       	push   $0x407
+  8036a1:	ff 75 f0             	push   -0x10(%ebp)
+  8036a4:	6a 00                	push   $0x0
+  8036a6:	e8 c8 d7 ff ff       	call   800e73 <sys_page_alloc>
+  8036ab:	89 c3                	mov    %eax,%ebx
+  8036ad:	83 c4 10             	add    $0x10,%esp
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	0f 88 bc 00 00 00    	js     803774 <pipe+0x131>
+	va = fd2data(fd0);
+  8036b8:	83 ec 0c             	sub    $0xc,%esp
+  8036bb:	ff 75 f4             	push   -0xc(%ebp)
+  8036be:	e8 3e e9 ff ff       	call   802001 <fd2data>
+  8036c3:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036c5:	83 c4 0c             	add    $0xc,%esp
+  8036c8:	68 07 04 00 00       	push   $0x407
+  8036cd:	50                   	push   %eax
+  8036ce:	6a 00                	push   $0x0
+  8036d0:	e8 9e d7 ff ff       	call   800e73 <sys_page_alloc>
+  8036d5:	89 c3                	mov    %eax,%ebx
+  8036d7:	83 c4 10             	add    $0x10,%esp
+  8036da:	85 c0                	test   %eax,%eax
+  8036dc:	0f 88 82 00 00 00    	js     803764 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8036e2:	83 ec 0c             	sub    $0xc,%esp
+  8036e5:	ff 75 f0             	push   -0x10(%ebp)
+  8036e8:	e8 14 e9 ff ff       	call   802001 <fd2data>
+  8036ed:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8036f4:	50                   	push   %eax
+  8036f5:	6a 00                	push   $0x0
+  8036f7:	56                   	push   %esi
+  8036f8:	6a 00                	push   $0x0
+  8036fa:	e8 e1 d7 ff ff       	call   800ee0 <sys_page_map>
+  8036ff:	89 c3                	mov    %eax,%ebx
+  803701:	83 c4 20             	add    $0x20,%esp
+  803704:	85 c0                	test   %eax,%eax
+  803706:	78 4e                	js     803756 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803708:	a1 44 50 80 00       	mov    0x805044,%eax
+  80370d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803710:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803712:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803715:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80371c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80371f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803721:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803724:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80372b:	83 ec 0c             	sub    $0xc,%esp
+  80372e:	ff 75 f4             	push   -0xc(%ebp)
+  803731:	e8 bb e8 ff ff       	call   801ff1 <fd2num>
+  803736:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803739:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80373b:	83 c4 04             	add    $0x4,%esp
+  80373e:	ff 75 f0             	push   -0x10(%ebp)
+  803741:	e8 ab e8 ff ff       	call   801ff1 <fd2num>
+  803746:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803749:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80374c:	83 c4 10             	add    $0x10,%esp
+  80374f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803754:	eb 2e                	jmp    803784 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803756:	83 ec 08             	sub    $0x8,%esp
+  803759:	56                   	push   %esi
+  80375a:	6a 00                	push   $0x0
+  80375c:	e8 ed d7 ff ff       	call   800f4e <sys_page_unmap>
+  803761:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803764:	83 ec 08             	sub    $0x8,%esp
+  803767:	ff 75 f0             	push   -0x10(%ebp)
+  80376a:	6a 00                	push   $0x0
+  80376c:	e8 dd d7 ff ff       	call   800f4e <sys_page_unmap>
+  803771:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803774:	83 ec 08             	sub    $0x8,%esp
+  803777:	ff 75 f4             	push   -0xc(%ebp)
+  80377a:	6a 00                	push   $0x0
+  80377c:	e8 cd d7 ff ff       	call   800f4e <sys_page_unmap>
+  803781:	83 c4 10             	add    $0x10,%esp
+}
+  803784:	89 d8                	mov    %ebx,%eax
+  803786:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803789:	5b                   	pop    %ebx
+  80378a:	5e                   	pop    %esi
+  80378b:	5d                   	pop    %ebp
+  80378c:	c3                   	ret
+
+0080378d <pipeisclosed>:
+{
+  80378d:	55                   	push   %ebp
+  80378e:	89 e5                	mov    %esp,%ebp
+  803790:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803793:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803796:	50                   	push   %eax
+  803797:	ff 75 08             	push   0x8(%ebp)
+  80379a:	e8 cf e8 ff ff       	call   80206e <fd_lookup>
+  80379f:	83 c4 10             	add    $0x10,%esp
+  8037a2:	85 c0                	test   %eax,%eax
+  8037a4:	78 18                	js     8037be <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8037a6:	83 ec 0c             	sub    $0xc,%esp
+  8037a9:	ff 75 f4             	push   -0xc(%ebp)
+  8037ac:	e8 50 e8 ff ff       	call   802001 <fd2data>
+  8037b1:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8037b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037b6:	e8 cb fc ff ff       	call   803486 <_pipeisclosed>
+  8037bb:	83 c4 10             	add    $0x10,%esp
+}
+  8037be:	c9                   	leave
+  8037bf:	c3                   	ret
+
+008037c0 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8037c0:	55                   	push   %ebp
+  8037c1:	89 e5                	mov    %esp,%ebp
+  8037c3:	56                   	push   %esi
+  8037c4:	53                   	push   %ebx
+  8037c5:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8037c8:	85 f6                	test   %esi,%esi
+  8037ca:	74 16                	je     8037e2 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  8037cc:	89 f3                	mov    %esi,%ebx
+  8037ce:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8037d4:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  8037da:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8037e0:	eb 1b                	jmp    8037fd <wait+0x3d>
+	assert(envid != 0);
+  8037e2:	68 fe 42 80 00       	push   $0x8042fe
+  8037e7:	68 b0 40 80 00       	push   $0x8040b0
+  8037ec:	6a 09                	push   $0x9
+  8037ee:	68 09 43 80 00       	push   $0x804309
+  8037f3:	e8 60 ca ff ff       	call   800258 <_panic>
+		sys_yield();
+  8037f8:	e8 30 d6 ff ff       	call   800e2d <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8037fd:	8b 43 48             	mov    0x48(%ebx),%eax
+  803800:	39 f0                	cmp    %esi,%eax
+  803802:	75 07                	jne    80380b <wait+0x4b>
+  803804:	8b 43 54             	mov    0x54(%ebx),%eax
+  803807:	85 c0                	test   %eax,%eax
+  803809:	75 ed                	jne    8037f8 <wait+0x38>
+}
+  80380b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80380e:	5b                   	pop    %ebx
+  80380f:	5e                   	pop    %esi
+  803810:	5d                   	pop    %ebp
+  803811:	c3                   	ret
+
+00803812 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803812:	b8 00 00 00 00       	mov    $0x0,%eax
+  803817:	c3                   	ret
+
+00803818 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803818:	55                   	push   %ebp
+  803819:	89 e5                	mov    %esp,%ebp
+  80381b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80381e:	68 14 43 80 00       	push   $0x804314
+  803823:	ff 75 0c             	push   0xc(%ebp)
+  803826:	e8 50 d1 ff ff       	call   80097b <strcpy>
+	return 0;
+}
+  80382b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803830:	c9                   	leave
+  803831:	c3                   	ret
+
+00803832 <devcons_write>:
+{
+  803832:	55                   	push   %ebp
+  803833:	89 e5                	mov    %esp,%ebp
+  803835:	57                   	push   %edi
+  803836:	56                   	push   %esi
+  803837:	53                   	push   %ebx
+  803838:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80383e:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803843:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803849:	eb 2e                	jmp    803879 <devcons_write+0x47>
+		m = n - tot;
+  80384b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80384e:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803850:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803855:	39 c3                	cmp    %eax,%ebx
+  803857:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80385a:	83 ec 04             	sub    $0x4,%esp
+  80385d:	53                   	push   %ebx
+  80385e:	89 f0                	mov    %esi,%eax
+  803860:	03 45 0c             	add    0xc(%ebp),%eax
+  803863:	50                   	push   %eax
+  803864:	57                   	push   %edi
+  803865:	e8 97 d2 ff ff       	call   800b01 <memmove>
+		sys_cputs(buf, m);
+  80386a:	83 c4 08             	add    $0x8,%esp
+  80386d:	53                   	push   %ebx
+  80386e:	57                   	push   %edi
+  80386f:	e8 80 d4 ff ff       	call   800cf4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803874:	01 de                	add    %ebx,%esi
+  803876:	83 c4 10             	add    $0x10,%esp
+  803879:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80387c:	72 cd                	jb     80384b <devcons_write+0x19>
+}
+  80387e:	89 f0                	mov    %esi,%eax
+  803880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803883:	5b                   	pop    %ebx
+  803884:	5e                   	pop    %esi
+  803885:	5f                   	pop    %edi
+  803886:	5d                   	pop    %ebp
+  803887:	c3                   	ret
+
+00803888 <devcons_read>:
+{
+  803888:	55                   	push   %ebp
+  803889:	89 e5                	mov    %esp,%ebp
+  80388b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80388e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803893:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803897:	75 07                	jne    8038a0 <devcons_read+0x18>
+  803899:	eb 1f                	jmp    8038ba <devcons_read+0x32>
+		sys_yield();
+  80389b:	e8 8d d5 ff ff       	call   800e2d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8038a0:	e8 93 d4 ff ff       	call   800d38 <sys_cgetc>
+  8038a5:	85 c0                	test   %eax,%eax
+  8038a7:	74 f2                	je     80389b <devcons_read+0x13>
+	if (c < 0)
+  8038a9:	78 0f                	js     8038ba <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8038ab:	83 f8 04             	cmp    $0x4,%eax
+  8038ae:	74 0c                	je     8038bc <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8038b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8038b3:	88 02                	mov    %al,(%edx)
+	return 1;
+  8038b5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8038ba:	c9                   	leave
+  8038bb:	c3                   	ret
+		return 0;
+  8038bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c1:	eb f7                	jmp    8038ba <devcons_read+0x32>
+
+008038c3 <cputchar>:
+{
+  8038c3:	55                   	push   %ebp
+  8038c4:	89 e5                	mov    %esp,%ebp
+  8038c6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8038c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038cc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8038cf:	6a 01                	push   $0x1
+  8038d1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8038d4:	50                   	push   %eax
+  8038d5:	e8 1a d4 ff ff       	call   800cf4 <sys_cputs>
+}
+  8038da:	83 c4 10             	add    $0x10,%esp
+  8038dd:	c9                   	leave
+  8038de:	c3                   	ret
+
+008038df <getchar>:
+{
+  8038df:	55                   	push   %ebp
+  8038e0:	89 e5                	mov    %esp,%ebp
+  8038e2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8038e5:	6a 01                	push   $0x1
+  8038e7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8038ea:	50                   	push   %eax
+  8038eb:	6a 00                	push   $0x0
+  8038ed:	e8 02 ea ff ff       	call   8022f4 <read>
+	if (r < 0)
+  8038f2:	83 c4 10             	add    $0x10,%esp
+  8038f5:	85 c0                	test   %eax,%eax
+  8038f7:	78 06                	js     8038ff <getchar+0x20>
+	if (r < 1)
+  8038f9:	74 06                	je     803901 <getchar+0x22>
+	return c;
+  8038fb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8038ff:	c9                   	leave
+  803900:	c3                   	ret
+		return -E_EOF;
+  803901:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803906:	eb f7                	jmp    8038ff <getchar+0x20>
+
+00803908 <iscons>:
+{
+  803908:	55                   	push   %ebp
+  803909:	89 e5                	mov    %esp,%ebp
+  80390b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80390e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803911:	50                   	push   %eax
+  803912:	ff 75 08             	push   0x8(%ebp)
+  803915:	e8 54 e7 ff ff       	call   80206e <fd_lookup>
+  80391a:	83 c4 10             	add    $0x10,%esp
+  80391d:	85 c0                	test   %eax,%eax
+  80391f:	78 11                	js     803932 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803921:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803924:	8b 15 60 50 80 00    	mov    0x805060,%edx
+  80392a:	39 10                	cmp    %edx,(%eax)
+  80392c:	0f 94 c0             	sete   %al
+  80392f:	0f b6 c0             	movzbl %al,%eax
+}
+  803932:	c9                   	leave
+  803933:	c3                   	ret
+
+00803934 <opencons>:
+{
+  803934:	55                   	push   %ebp
+  803935:	89 e5                	mov    %esp,%ebp
+  803937:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80393a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80393d:	50                   	push   %eax
+  80393e:	e8 d5 e6 ff ff       	call   802018 <fd_alloc>
+  803943:	83 c4 10             	add    $0x10,%esp
+  803946:	85 c0                	test   %eax,%eax
+  803948:	78 3a                	js     803984 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80394a:	83 ec 04             	sub    $0x4,%esp
+  80394d:	68 07 04 00 00       	push   $0x407
+  803952:	ff 75 f4             	push   -0xc(%ebp)
+  803955:	6a 00                	push   $0x0
+  803957:	e8 17 d5 ff ff       	call   800e73 <sys_page_alloc>
+  80395c:	83 c4 10             	add    $0x10,%esp
+  80395f:	85 c0                	test   %eax,%eax
+  803961:	78 21                	js     803984 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803963:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803966:	8b 15 60 50 80 00    	mov    0x805060,%edx
+  80396c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80396e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803971:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803978:	83 ec 0c             	sub    $0xc,%esp
+  80397b:	50                   	push   %eax
+  80397c:	e8 70 e6 ff ff       	call   801ff1 <fd2num>
+  803981:	83 c4 10             	add    $0x10,%esp
+}
+  803984:	c9                   	leave
+  803985:	c3                   	ret
+
+00803986 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803986:	55                   	push   %ebp
+  803987:	89 e5                	mov    %esp,%ebp
+  803989:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  80398c:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803993:	74 0a                	je     80399f <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803995:	8b 45 08             	mov    0x8(%ebp),%eax
+  803998:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80399d:	c9                   	leave
+  80399e:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  80399f:	83 ec 04             	sub    $0x4,%esp
+  8039a2:	6a 07                	push   $0x7
+  8039a4:	68 00 f0 bf ee       	push   $0xeebff000
+  8039a9:	6a 00                	push   $0x0
+  8039ab:	e8 c3 d4 ff ff       	call   800e73 <sys_page_alloc>
+  8039b0:	83 c4 10             	add    $0x10,%esp
+  8039b3:	85 c0                	test   %eax,%eax
+  8039b5:	78 14                	js     8039cb <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8039b7:	83 ec 08             	sub    $0x8,%esp
+  8039ba:	68 ed 39 80 00       	push   $0x8039ed
+  8039bf:	6a 00                	push   $0x0
+  8039c1:	e8 c9 d6 ff ff       	call   80108f <sys_env_set_pgfault_upcall>
+  8039c6:	83 c4 10             	add    $0x10,%esp
+  8039c9:	eb ca                	jmp    803995 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8039cb:	83 ec 08             	sub    $0x8,%esp
+  8039ce:	50                   	push   %eax
+  8039cf:	68 20 43 80 00       	push   $0x804320
+  8039d4:	e8 5a c9 ff ff       	call   800333 <cprintf>
+			panic("set_pgfault_handler error");
+  8039d9:	83 c4 0c             	add    $0xc,%esp
+  8039dc:	68 2b 43 80 00       	push   $0x80432b
+  8039e1:	6a 24                	push   $0x24
+  8039e3:	68 45 43 80 00       	push   $0x804345
+  8039e8:	e8 6b c8 ff ff       	call   800258 <_panic>
+
+008039ed <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8039ed:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8039ee:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8039f3:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8039f5:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  8039f8:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  8039fc:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  8039ff:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803a03:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803a05:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803a09:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803a0a:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803a0e:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803a0f:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803a10:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803a14:	c3                   	ret
+
+00803a15 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  803a15:	55                   	push   %ebp
+  803a16:	89 e5                	mov    %esp,%ebp
+  803a18:	56                   	push   %esi
+  803a19:	53                   	push   %ebx
+  803a1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803a20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803a23:	85 c0                	test   %eax,%eax
+  803a25:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803a2a:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  803a2d:	83 ec 08             	sub    $0x8,%esp
+  803a30:	ff 75 14             	push   0x14(%ebp)
+  803a33:	50                   	push   %eax
+  803a34:	e8 4b d8 ff ff       	call   801284 <sys_ipc_recv_until>
+  803a39:	83 c4 10             	add    $0x10,%esp
+  803a3c:	85 c0                	test   %eax,%eax
+  803a3e:	78 61                	js     803aa1 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  803a40:	85 f6                	test   %esi,%esi
+  803a42:	74 1c                	je     803a60 <ipc_recv_until+0x4b>
+  803a44:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803a46:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803a4b:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803a51:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803a56:	76 5f                	jbe    803ab7 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  803a58:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803a5e:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803a60:	85 db                	test   %ebx,%ebx
+  803a62:	74 1c                	je     803a80 <ipc_recv_until+0x6b>
+  803a64:	89 e0                	mov    %esp,%eax
+  803a66:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803a6b:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803a71:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803a76:	76 50                	jbe    803ac8 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  803a78:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803a7e:	89 03                	mov    %eax,(%ebx)
+  803a80:	89 e0                	mov    %esp,%eax
+  803a82:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803a87:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803a8d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803a92:	76 45                	jbe    803ad9 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803a94:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  803a9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a9d:	5b                   	pop    %ebx
+  803a9e:	5e                   	pop    %esi
+  803a9f:	5d                   	pop    %ebp
+  803aa0:	c3                   	ret
+		if (from_env_store)
+  803aa1:	85 f6                	test   %esi,%esi
+  803aa3:	74 06                	je     803aab <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803aa5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  803aab:	85 db                	test   %ebx,%ebx
+  803aad:	74 eb                	je     803a9a <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803aaf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803ab5:	eb e3                	jmp    803a9a <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803ab7:	c1 e8 10             	shr    $0x10,%eax
+  803aba:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803ac0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803ac6:	eb 90                	jmp    803a58 <ipc_recv_until+0x43>
+  803ac8:	c1 e8 10             	shr    $0x10,%eax
+  803acb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803ad1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803ad7:	eb 9f                	jmp    803a78 <ipc_recv_until+0x63>
+  803ad9:	c1 e8 10             	shr    $0x10,%eax
+  803adc:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803ae2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803ae8:	eb aa                	jmp    803a94 <ipc_recv_until+0x7f>
+
+00803aea <ipc_recv>:
+{
+  803aea:	55                   	push   %ebp
+  803aeb:	89 e5                	mov    %esp,%ebp
+  803aed:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803af0:	6a 00                	push   $0x0
+  803af2:	ff 75 10             	push   0x10(%ebp)
+  803af5:	ff 75 0c             	push   0xc(%ebp)
+  803af8:	ff 75 08             	push   0x8(%ebp)
+  803afb:	e8 15 ff ff ff       	call   803a15 <ipc_recv_until>
+}
+  803b00:	c9                   	leave
+  803b01:	c3                   	ret
+
+00803b02 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803b02:	55                   	push   %ebp
+  803b03:	89 e5                	mov    %esp,%ebp
+  803b05:	57                   	push   %edi
+  803b06:	56                   	push   %esi
+  803b07:	53                   	push   %ebx
+  803b08:	83 ec 0c             	sub    $0xc,%esp
+  803b0b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b0e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803b11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803b14:	85 db                	test   %ebx,%ebx
+  803b16:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803b1b:	0f 44 d8             	cmove  %eax,%ebx
+  803b1e:	eb 05                	jmp    803b25 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803b20:	e8 08 d3 ff ff       	call   800e2d <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  803b25:	ff 75 14             	push   0x14(%ebp)
+  803b28:	53                   	push   %ebx
+  803b29:	56                   	push   %esi
+  803b2a:	57                   	push   %edi
+  803b2b:	e8 a0 d6 ff ff       	call   8011d0 <sys_ipc_try_send>
+  803b30:	83 c4 10             	add    $0x10,%esp
+  803b33:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803b36:	74 e8                	je     803b20 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  803b38:	85 c0                	test   %eax,%eax
+  803b3a:	78 08                	js     803b44 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  803b3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b3f:	5b                   	pop    %ebx
+  803b40:	5e                   	pop    %esi
+  803b41:	5f                   	pop    %edi
+  803b42:	5d                   	pop    %ebp
+  803b43:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  803b44:	50                   	push   %eax
+  803b45:	68 53 43 80 00       	push   $0x804353
+  803b4a:	6a 4f                	push   $0x4f
+  803b4c:	68 66 43 80 00       	push   $0x804366
+  803b51:	e8 02 c7 ff ff       	call   800258 <_panic>
+
+00803b56 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803b56:	55                   	push   %ebp
+  803b57:	89 e5                	mov    %esp,%ebp
+  803b59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803b61:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  803b67:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803b6d:	8b 52 50             	mov    0x50(%edx),%edx
+  803b70:	39 ca                	cmp    %ecx,%edx
+  803b72:	74 11                	je     803b85 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803b74:	83 c0 01             	add    $0x1,%eax
+  803b77:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803b7c:	75 e3                	jne    803b61 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b83:	eb 0e                	jmp    803b93 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803b85:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803b8b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b90:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803b93:	5d                   	pop    %ebp
+  803b94:	c3                   	ret
+
+00803b95 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803b95:	55                   	push   %ebp
+  803b96:	89 e5                	mov    %esp,%ebp
+  803b98:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803b9b:	89 c2                	mov    %eax,%edx
+  803b9d:	c1 ea 16             	shr    $0x16,%edx
+  803ba0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803bac:	f6 c1 01             	test   $0x1,%cl
+  803baf:	74 1a                	je     803bcb <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803bb1:	c1 e8 0c             	shr    $0xc,%eax
+  803bb4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803bbb:	a8 01                	test   $0x1,%al
+  803bbd:	74 0c                	je     803bcb <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803bbf:	c1 e8 0c             	shr    $0xc,%eax
+  803bc2:	c1 e0 04             	shl    $0x4,%eax
+  803bc5:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803bcb:	89 d0                	mov    %edx,%eax
+  803bcd:	5d                   	pop    %ebp
+  803bce:	c3                   	ret
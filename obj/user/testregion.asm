@@ -0,0 +1,7403 @@
+
+obj/user/testregion.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c5 03 00 00       	call   8003f6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// A big BSS, of which only a little is touched.
+static char bss[16 * 1024 * 1024];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	envid_t child;
+	int r;
+
+	if ((r = sys_region_reserve(0, VA + 1, PGSIZE, PERM)) != -E_INVAL)
+  80003a:	6a 07                	push   $0x7
+  80003c:	68 00 10 00 00       	push   $0x1000
+  800041:	68 01 00 00 30       	push   $0x30000001
+  800046:	6a 00                	push   $0x0
+  800048:	e8 95 16 00 00       	call   8016e2 <sys_region_reserve>
+  80004d:	83 c4 10             	add    $0x10,%esp
+  800050:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800053:	0f 85 05 02 00 00    	jne    80025e <umain+0x22b>
+		panic("sys_region_reserve at an unaligned va: %e", r);
+	if ((r = sys_region_reserve(0, VA, LEN, PERM)) < 0)
+  800059:	6a 07                	push   $0x7
+  80005b:	68 00 00 00 04       	push   $0x4000000
+  800060:	68 00 00 00 30       	push   $0x30000000
+  800065:	6a 00                	push   $0x0
+  800067:	e8 76 16 00 00       	call   8016e2 <sys_region_reserve>
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	0f 88 f9 01 00 00    	js     800270 <umain+0x23d>
+		panic("sys_region_reserve: %e", r);
+	if ((r = sys_region_reserve(0, VA + LEN - PGSIZE, PGSIZE, PERM)) != -E_INVAL)
+  800077:	6a 07                	push   $0x7
+  800079:	68 00 10 00 00       	push   $0x1000
+  80007e:	68 00 f0 ff 33       	push   $0x33fff000
+  800083:	6a 00                	push   $0x0
+  800085:	e8 58 16 00 00       	call   8016e2 <sys_region_reserve>
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800090:	0f 85 ec 01 00 00    	jne    800282 <umain+0x24f>
+		panic("sys_region_reserve over another region: %e", r);
+
+	// Nothing is mapped until it is touched.
+	assert(!(uvpd[PDX(VA)] & PTE_P));
+  800096:	a1 00 d3 7b ef       	mov    0xef7bd300,%eax
+  80009b:	a8 01                	test   $0x1,%al
+  80009d:	0f 85 f1 01 00 00    	jne    800294 <umain+0x261>
+
+	// A read maps the zero page copy-on-write...
+	assert(VA[LEN / 2] == 0);
+  8000a3:	80 3d 00 00 00 32 00 	cmpb   $0x0,0x32000000
+  8000aa:	0f 85 fa 01 00 00    	jne    8002aa <umain+0x277>
+	assert((uvpt[PGNUM(VA + LEN / 2)] & (PTE_W | PTE_COW)) == PTE_COW);
+  8000b0:	a1 00 80 4c ef       	mov    0xef4c8000,%eax
+  8000b5:	25 02 08 00 00       	and    $0x802,%eax
+  8000ba:	3d 00 08 00 00       	cmp    $0x800,%eax
+  8000bf:	0f 85 fb 01 00 00    	jne    8002c0 <umain+0x28d>
+	// ...which a write then copies.
+	VA[LEN / 2] = 1;
+  8000c5:	c6 05 00 00 00 32 01 	movb   $0x1,0x32000000
+	assert((uvpt[PGNUM(VA + LEN / 2)] & (PTE_W | PTE_COW)) == PTE_W);
+  8000cc:	a1 00 80 4c ef       	mov    0xef4c8000,%eax
+  8000d1:	25 02 08 00 00       	and    $0x802,%eax
+  8000d6:	83 f8 02             	cmp    $0x2,%eax
+  8000d9:	0f 85 f7 01 00 00    	jne    8002d6 <umain+0x2a3>
+	assert(VA[LEN / 2 + PGSIZE] == 0);
+  8000df:	80 3d 00 10 00 32 00 	cmpb   $0x0,0x32001000
+  8000e6:	0f 85 00 02 00 00    	jne    8002ec <umain+0x2b9>
+
+	// A write maps a page of its own at once.
+	VA[LEN - 1] = 2;
+  8000ec:	c6 05 ff ff ff 33 02 	movb   $0x2,0x33ffffff
+	assert(uvpt[PGNUM(VA + LEN - 1)] & PTE_W);
+  8000f3:	a1 fc ff 4c ef       	mov    0xef4cfffc,%eax
+  8000f8:	a8 02                	test   $0x2,%al
+  8000fa:	0f 84 02 02 00 00    	je     800302 <umain+0x2cf>
+
+	// The kernel fills in pages it is handed.
+	strcpy(VA + 3 * PGSIZE - 2, "ok");
+  800100:	83 ec 08             	sub    $0x8,%esp
+  800103:	68 4b 39 80 00       	push   $0x80394b
+  800108:	68 fe 2f 00 30       	push   $0x30002ffe
+  80010d:	e8 cb 0a 00 00       	call   800bdd <strcpy>
+	cprintf("region: kernel reads it %s\n", VA + 3 * PGSIZE - 2);
+  800112:	83 c4 08             	add    $0x8,%esp
+  800115:	68 fe 2f 00 30       	push   $0x30002ffe
+  80011a:	68 4e 39 80 00       	push   $0x80394e
+  80011f:	e8 71 04 00 00       	call   800595 <cprintf>
+
+	// A forked child gets the region too.
+	if ((child = fork()) < 0)
+  800124:	e8 97 1e 00 00       	call   801fc0 <fork>
+  800129:	89 c3                	mov    %eax,%ebx
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	85 c0                	test   %eax,%eax
+  800130:	0f 88 e2 01 00 00    	js     800318 <umain+0x2e5>
+		panic("fork: %e", child);
+	if (child == 0) {
+  800136:	75 26                	jne    80015e <umain+0x12b>
+		assert(VA[LEN / 4] == 0 && VA[LEN / 2] == 1);
+  800138:	80 3d 00 00 00 31 00 	cmpb   $0x0,0x31000000
+  80013f:	0f 85 e5 01 00 00    	jne    80032a <umain+0x2f7>
+  800145:	80 3d 00 00 00 32 01 	cmpb   $0x1,0x32000000
+  80014c:	0f 85 d8 01 00 00    	jne    80032a <umain+0x2f7>
+		VA[LEN / 4] = 3;
+  800152:	c6 05 00 00 00 31 03 	movb   $0x3,0x31000000
+		exit();
+  800159:	e8 42 03 00 00       	call   8004a0 <exit>
+	}
+	wait(child);
+  80015e:	83 ec 0c             	sub    $0xc,%esp
+  800161:	53                   	push   %ebx
+  800162:	e8 71 31 00 00       	call   8032d8 <wait>
+	assert(VA[LEN / 4] == 0);
+  800167:	83 c4 10             	add    $0x10,%esp
+  80016a:	80 3d 00 00 00 31 00 	cmpb   $0x0,0x31000000
+  800171:	0f 85 c9 01 00 00    	jne    800340 <umain+0x30d>
+
+	// So does one of ufork, and the BSS with it.
+	if ((child = ufork()) < 0)
+  800177:	e8 46 1b 00 00       	call   801cc2 <ufork>
+  80017c:	89 c3                	mov    %eax,%ebx
+  80017e:	85 c0                	test   %eax,%eax
+  800180:	0f 88 d0 01 00 00    	js     800356 <umain+0x323>
+		panic("ufork: %e", child);
+	if (child == 0) {
+  800186:	75 1f                	jne    8001a7 <umain+0x174>
+		assert(VA[LEN / 4 + PGSIZE] == 0);
+  800188:	80 3d 00 10 00 31 00 	cmpb   $0x0,0x31001000
+  80018f:	0f 85 d3 01 00 00    	jne    800368 <umain+0x335>
+		assert(bss[sizeof(bss) / 8] == 0);
+  800195:	80 3d 00 60 a0 00 00 	cmpb   $0x0,0xa06000
+  80019c:	0f 85 dc 01 00 00    	jne    80037e <umain+0x34b>
+		exit();
+  8001a2:	e8 f9 02 00 00       	call   8004a0 <exit>
+	}
+	wait(child);
+  8001a7:	83 ec 0c             	sub    $0xc,%esp
+  8001aa:	53                   	push   %ebx
+  8001ab:	e8 28 31 00 00       	call   8032d8 <wait>
+
+	// A region is forgotten only as a whole.
+	if ((r = sys_region_release(0, VA, LEN / 2)) != -E_INVAL)
+  8001b0:	83 c4 0c             	add    $0xc,%esp
+  8001b3:	68 00 00 00 02       	push   $0x2000000
+  8001b8:	68 00 00 00 30       	push   $0x30000000
+  8001bd:	6a 00                	push   $0x0
+  8001bf:	e8 8a 15 00 00       	call   80174e <sys_region_release>
+  8001c4:	83 c4 10             	add    $0x10,%esp
+  8001c7:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8001ca:	0f 85 c4 01 00 00    	jne    800394 <umain+0x361>
+		panic("sys_region_release of half a region: %e", r);
+	if ((r = sys_region_release(0, VA, LEN)) < 0)
+  8001d0:	83 ec 04             	sub    $0x4,%esp
+  8001d3:	68 00 00 00 04       	push   $0x4000000
+  8001d8:	68 00 00 00 30       	push   $0x30000000
+  8001dd:	6a 00                	push   $0x0
+  8001df:	e8 6a 15 00 00       	call   80174e <sys_region_release>
+  8001e4:	83 c4 10             	add    $0x10,%esp
+  8001e7:	85 c0                	test   %eax,%eax
+  8001e9:	0f 88 b7 01 00 00    	js     8003a6 <umain+0x373>
+		panic("sys_region_release: %e", r);
+	if ((r = sys_region_reserve(0, VA + LEN - PGSIZE, PGSIZE, PERM)) < 0)
+  8001ef:	6a 07                	push   $0x7
+  8001f1:	68 00 10 00 00       	push   $0x1000
+  8001f6:	68 00 f0 ff 33       	push   $0x33fff000
+  8001fb:	6a 00                	push   $0x0
+  8001fd:	e8 e0 14 00 00       	call   8016e2 <sys_region_reserve>
+  800202:	83 c4 10             	add    $0x10,%esp
+  800205:	85 c0                	test   %eax,%eax
+  800207:	0f 88 ab 01 00 00    	js     8003b8 <umain+0x385>
+		panic("sys_region_reserve after release: %e", r);
+
+	// The BSS is demand-zero too.
+	assert(bss[sizeof(bss) / 2] == 0);
+  80020d:	80 3d 00 60 00 01 00 	cmpb   $0x0,0x1006000
+  800214:	0f 85 b0 01 00 00    	jne    8003ca <umain+0x397>
+	bss[sizeof(bss) - 1] = 4;
+  80021a:	c6 05 ff 5f 80 01 04 	movb   $0x4,0x1805fff
+	assert(!(uvpd[PDX(&bss[sizeof(bss) / 4])] & PTE_P) ||
+  800221:	b8 00 60 c0 00       	mov    $0xc06000,%eax
+  800226:	89 c2                	mov    %eax,%edx
+  800228:	c1 ea 16             	shr    $0x16,%edx
+  80022b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800232:	f6 c2 01             	test   $0x1,%dl
+  800235:	74 12                	je     800249 <umain+0x216>
+  800237:	c1 e8 0c             	shr    $0xc,%eax
+  80023a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800241:	a8 01                	test   $0x1,%al
+  800243:	0f 85 97 01 00 00    	jne    8003e0 <umain+0x3ad>
+	       !(uvpt[PGNUM(&bss[sizeof(bss) / 4])] & PTE_P));
+
+	cprintf("region: OK\n");
+  800249:	83 ec 0c             	sub    $0xc,%esp
+  80024c:	68 ea 39 80 00       	push   $0x8039ea
+  800251:	e8 3f 03 00 00       	call   800595 <cprintf>
+}
+  800256:	83 c4 10             	add    $0x10,%esp
+  800259:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+		panic("sys_region_reserve at an unaligned va: %e", r);
+  80025e:	50                   	push   %eax
+  80025f:	68 00 37 80 00       	push   $0x803700
+  800264:	6a 13                	push   $0x13
+  800266:	68 c9 38 80 00       	push   $0x8038c9
+  80026b:	e8 4a 02 00 00       	call   8004ba <_panic>
+		panic("sys_region_reserve: %e", r);
+  800270:	50                   	push   %eax
+  800271:	68 db 38 80 00       	push   $0x8038db
+  800276:	6a 15                	push   $0x15
+  800278:	68 c9 38 80 00       	push   $0x8038c9
+  80027d:	e8 38 02 00 00       	call   8004ba <_panic>
+		panic("sys_region_reserve over another region: %e", r);
+  800282:	50                   	push   %eax
+  800283:	68 2c 37 80 00       	push   $0x80372c
+  800288:	6a 17                	push   $0x17
+  80028a:	68 c9 38 80 00       	push   $0x8038c9
+  80028f:	e8 26 02 00 00       	call   8004ba <_panic>
+	assert(!(uvpd[PDX(VA)] & PTE_P));
+  800294:	68 f2 38 80 00       	push   $0x8038f2
+  800299:	68 0b 39 80 00       	push   $0x80390b
+  80029e:	6a 1a                	push   $0x1a
+  8002a0:	68 c9 38 80 00       	push   $0x8038c9
+  8002a5:	e8 10 02 00 00       	call   8004ba <_panic>
+	assert(VA[LEN / 2] == 0);
+  8002aa:	68 20 39 80 00       	push   $0x803920
+  8002af:	68 0b 39 80 00       	push   $0x80390b
+  8002b4:	6a 1d                	push   $0x1d
+  8002b6:	68 c9 38 80 00       	push   $0x8038c9
+  8002bb:	e8 fa 01 00 00       	call   8004ba <_panic>
+	assert((uvpt[PGNUM(VA + LEN / 2)] & (PTE_W | PTE_COW)) == PTE_COW);
+  8002c0:	68 58 37 80 00       	push   $0x803758
+  8002c5:	68 0b 39 80 00       	push   $0x80390b
+  8002ca:	6a 1e                	push   $0x1e
+  8002cc:	68 c9 38 80 00       	push   $0x8038c9
+  8002d1:	e8 e4 01 00 00       	call   8004ba <_panic>
+	assert((uvpt[PGNUM(VA + LEN / 2)] & (PTE_W | PTE_COW)) == PTE_W);
+  8002d6:	68 94 37 80 00       	push   $0x803794
+  8002db:	68 0b 39 80 00       	push   $0x80390b
+  8002e0:	6a 21                	push   $0x21
+  8002e2:	68 c9 38 80 00       	push   $0x8038c9
+  8002e7:	e8 ce 01 00 00       	call   8004ba <_panic>
+	assert(VA[LEN / 2 + PGSIZE] == 0);
+  8002ec:	68 31 39 80 00       	push   $0x803931
+  8002f1:	68 0b 39 80 00       	push   $0x80390b
+  8002f6:	6a 22                	push   $0x22
+  8002f8:	68 c9 38 80 00       	push   $0x8038c9
+  8002fd:	e8 b8 01 00 00       	call   8004ba <_panic>
+	assert(uvpt[PGNUM(VA + LEN - 1)] & PTE_W);
+  800302:	68 d0 37 80 00       	push   $0x8037d0
+  800307:	68 0b 39 80 00       	push   $0x80390b
+  80030c:	6a 26                	push   $0x26
+  80030e:	68 c9 38 80 00       	push   $0x8038c9
+  800313:	e8 a2 01 00 00       	call   8004ba <_panic>
+		panic("fork: %e", child);
+  800318:	50                   	push   %eax
+  800319:	68 5b 3e 80 00       	push   $0x803e5b
+  80031e:	6a 2e                	push   $0x2e
+  800320:	68 c9 38 80 00       	push   $0x8038c9
+  800325:	e8 90 01 00 00       	call   8004ba <_panic>
+		assert(VA[LEN / 4] == 0 && VA[LEN / 2] == 1);
+  80032a:	68 f4 37 80 00       	push   $0x8037f4
+  80032f:	68 0b 39 80 00       	push   $0x80390b
+  800334:	6a 30                	push   $0x30
+  800336:	68 c9 38 80 00       	push   $0x8038c9
+  80033b:	e8 7a 01 00 00       	call   8004ba <_panic>
+	assert(VA[LEN / 4] == 0);
+  800340:	68 6a 39 80 00       	push   $0x80396a
+  800345:	68 0b 39 80 00       	push   $0x80390b
+  80034a:	6a 35                	push   $0x35
+  80034c:	68 c9 38 80 00       	push   $0x8038c9
+  800351:	e8 64 01 00 00       	call   8004ba <_panic>
+		panic("ufork: %e", child);
+  800356:	50                   	push   %eax
+  800357:	68 7b 39 80 00       	push   $0x80397b
+  80035c:	6a 39                	push   $0x39
+  80035e:	68 c9 38 80 00       	push   $0x8038c9
+  800363:	e8 52 01 00 00       	call   8004ba <_panic>
+		assert(VA[LEN / 4 + PGSIZE] == 0);
+  800368:	68 85 39 80 00       	push   $0x803985
+  80036d:	68 0b 39 80 00       	push   $0x80390b
+  800372:	6a 3b                	push   $0x3b
+  800374:	68 c9 38 80 00       	push   $0x8038c9
+  800379:	e8 3c 01 00 00       	call   8004ba <_panic>
+		assert(bss[sizeof(bss) / 8] == 0);
+  80037e:	68 9f 39 80 00       	push   $0x80399f
+  800383:	68 0b 39 80 00       	push   $0x80390b
+  800388:	6a 3c                	push   $0x3c
+  80038a:	68 c9 38 80 00       	push   $0x8038c9
+  80038f:	e8 26 01 00 00       	call   8004ba <_panic>
+		panic("sys_region_release of half a region: %e", r);
+  800394:	50                   	push   %eax
+  800395:	68 1c 38 80 00       	push   $0x80381c
+  80039a:	6a 43                	push   $0x43
+  80039c:	68 c9 38 80 00       	push   $0x8038c9
+  8003a1:	e8 14 01 00 00       	call   8004ba <_panic>
+		panic("sys_region_release: %e", r);
+  8003a6:	50                   	push   %eax
+  8003a7:	68 b9 39 80 00       	push   $0x8039b9
+  8003ac:	6a 45                	push   $0x45
+  8003ae:	68 c9 38 80 00       	push   $0x8038c9
+  8003b3:	e8 02 01 00 00       	call   8004ba <_panic>
+		panic("sys_region_reserve after release: %e", r);
+  8003b8:	50                   	push   %eax
+  8003b9:	68 44 38 80 00       	push   $0x803844
+  8003be:	6a 47                	push   $0x47
+  8003c0:	68 c9 38 80 00       	push   $0x8038c9
+  8003c5:	e8 f0 00 00 00       	call   8004ba <_panic>
+	assert(bss[sizeof(bss) / 2] == 0);
+  8003ca:	68 d0 39 80 00       	push   $0x8039d0
+  8003cf:	68 0b 39 80 00       	push   $0x80390b
+  8003d4:	6a 4a                	push   $0x4a
+  8003d6:	68 c9 38 80 00       	push   $0x8038c9
+  8003db:	e8 da 00 00 00       	call   8004ba <_panic>
+	assert(!(uvpd[PDX(&bss[sizeof(bss) / 4])] & PTE_P) ||
+  8003e0:	68 6c 38 80 00       	push   $0x80386c
+  8003e5:	68 0b 39 80 00       	push   $0x80390b
+  8003ea:	6a 4c                	push   $0x4c
+  8003ec:	68 c9 38 80 00       	push   $0x8038c9
+  8003f1:	e8 c4 00 00 00       	call   8004ba <_panic>
+
+008003f6 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003f6:	55                   	push   %ebp
+  8003f7:	89 e5                	mov    %esp,%ebp
+  8003f9:	57                   	push   %edi
+  8003fa:	56                   	push   %esi
+  8003fb:	53                   	push   %ebx
+  8003fc:	83 ec 0c             	sub    $0xc,%esp
+  8003ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800402:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800405:	b8 01 00 00 00       	mov    $0x1,%eax
+  80040a:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80040c:	c1 ea 0b             	shr    $0xb,%edx
+  80040f:	83 f2 01             	xor    $0x1,%edx
+  800412:	83 e2 01             	and    $0x1,%edx
+  800415:	88 15 0c 60 80 01    	mov    %dl,0x180600c
+
+	mainenv = NULL;
+  80041b:	c7 05 08 60 80 01 00 	movl   $0x0,0x1806008
+  800422:	00 00 00 
+	envid = sys_getenvid();
+  800425:	e8 1f 0c 00 00       	call   801049 <sys_getenvid>
+  80042a:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800431:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800437:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80043d:	8b 52 48             	mov    0x48(%edx),%edx
+  800440:	39 ca                	cmp    %ecx,%edx
+  800442:	74 27                	je     80046b <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800444:	83 c0 01             	add    $0x1,%eax
+  800447:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80044c:	75 e3                	jne    800431 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80044e:	83 3d 08 60 80 01 00 	cmpl   $0x0,0x1806008
+  800455:	75 24                	jne    80047b <libmain+0x85>
+		panic("libmain can't find the environment");
+  800457:	83 ec 04             	sub    $0x4,%esp
+  80045a:	68 f8 39 80 00       	push   $0x8039f8
+  80045f:	6a 23                	push   $0x23
+  800461:	68 1b 3a 80 00       	push   $0x803a1b
+  800466:	e8 4f 00 00 00       	call   8004ba <_panic>
+			mainenv = &envs[i];
+  80046b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800471:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800476:	a3 08 60 80 01       	mov    %eax,0x1806008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80047b:	85 ff                	test   %edi,%edi
+  80047d:	7e 07                	jle    800486 <libmain+0x90>
+		binaryname = argv[0];
+  80047f:	8b 06                	mov    (%esi),%eax
+  800481:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800486:	83 ec 08             	sub    $0x8,%esp
+  800489:	56                   	push   %esi
+  80048a:	57                   	push   %edi
+  80048b:	e8 a3 fb ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800490:	e8 0b 00 00 00       	call   8004a0 <exit>
+}
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049b:	5b                   	pop    %ebx
+  80049c:	5e                   	pop    %esi
+  80049d:	5f                   	pop    %edi
+  80049e:	5d                   	pop    %ebp
+  80049f:	c3                   	ret
+
+008004a0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004a0:	55                   	push   %ebp
+  8004a1:	89 e5                	mov    %esp,%ebp
+  8004a3:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8004a6:	e8 9c 1f 00 00       	call   802447 <close_all>
+	sys_env_destroy(0);
+  8004ab:	83 ec 0c             	sub    $0xc,%esp
+  8004ae:	6a 00                	push   $0x0
+  8004b0:	e8 2b 0b 00 00       	call   800fe0 <sys_env_destroy>
+}
+  8004b5:	83 c4 10             	add    $0x10,%esp
+  8004b8:	c9                   	leave
+  8004b9:	c3                   	ret
+
+008004ba <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004ba:	55                   	push   %ebp
+  8004bb:	89 e5                	mov    %esp,%ebp
+  8004bd:	56                   	push   %esi
+  8004be:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004bf:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004c2:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8004c8:	e8 7c 0b 00 00       	call   801049 <sys_getenvid>
+  8004cd:	83 ec 0c             	sub    $0xc,%esp
+  8004d0:	ff 75 0c             	push   0xc(%ebp)
+  8004d3:	ff 75 08             	push   0x8(%ebp)
+  8004d6:	56                   	push   %esi
+  8004d7:	50                   	push   %eax
+  8004d8:	68 34 3a 80 00       	push   $0x803a34
+  8004dd:	e8 b3 00 00 00       	call   800595 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8004e2:	83 c4 18             	add    $0x18,%esp
+  8004e5:	53                   	push   %ebx
+  8004e6:	ff 75 10             	push   0x10(%ebp)
+  8004e9:	e8 56 00 00 00       	call   800544 <vcprintf>
+	cprintf("\n");
+  8004ee:	c7 04 24 f4 39 80 00 	movl   $0x8039f4,(%esp)
+  8004f5:	e8 9b 00 00 00       	call   800595 <cprintf>
+  8004fa:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004fd:	cc                   	int3
+	while (1)
+  8004fe:	eb fd                	jmp    8004fd <_panic+0x43>
+
+00800500 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800500:	55                   	push   %ebp
+  800501:	89 e5                	mov    %esp,%ebp
+  800503:	53                   	push   %ebx
+  800504:	83 ec 04             	sub    $0x4,%esp
+  800507:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80050a:	8b 13                	mov    (%ebx),%edx
+  80050c:	8d 42 01             	lea    0x1(%edx),%eax
+  80050f:	89 03                	mov    %eax,(%ebx)
+  800511:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800514:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800518:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80051d:	74 09                	je     800528 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80051f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800523:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800526:	c9                   	leave
+  800527:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800528:	83 ec 08             	sub    $0x8,%esp
+  80052b:	68 ff 00 00 00       	push   $0xff
+  800530:	8d 43 08             	lea    0x8(%ebx),%eax
+  800533:	50                   	push   %eax
+  800534:	e8 1d 0a 00 00       	call   800f56 <sys_cputs>
+		b->idx = 0;
+  800539:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80053f:	83 c4 10             	add    $0x10,%esp
+  800542:	eb db                	jmp    80051f <putch+0x1f>
+
+00800544 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800544:	55                   	push   %ebp
+  800545:	89 e5                	mov    %esp,%ebp
+  800547:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80054d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800554:	00 00 00 
+	b.cnt = 0;
+  800557:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80055e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800561:	ff 75 0c             	push   0xc(%ebp)
+  800564:	ff 75 08             	push   0x8(%ebp)
+  800567:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80056d:	50                   	push   %eax
+  80056e:	68 00 05 80 00       	push   $0x800500
+  800573:	e8 fb 00 00 00       	call   800673 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800578:	83 c4 08             	add    $0x8,%esp
+  80057b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800581:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800587:	50                   	push   %eax
+  800588:	e8 c9 09 00 00       	call   800f56 <sys_cputs>
+
+	return b.cnt;
+}
+  80058d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800593:	c9                   	leave
+  800594:	c3                   	ret
+
+00800595 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800595:	55                   	push   %ebp
+  800596:	89 e5                	mov    %esp,%ebp
+  800598:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80059b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80059e:	50                   	push   %eax
+  80059f:	ff 75 08             	push   0x8(%ebp)
+  8005a2:	e8 9d ff ff ff       	call   800544 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005a7:	c9                   	leave
+  8005a8:	c3                   	ret
+
+008005a9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8005a9:	55                   	push   %ebp
+  8005aa:	89 e5                	mov    %esp,%ebp
+  8005ac:	57                   	push   %edi
+  8005ad:	56                   	push   %esi
+  8005ae:	53                   	push   %ebx
+  8005af:	83 ec 1c             	sub    $0x1c,%esp
+  8005b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005b5:	89 d6                	mov    %edx,%esi
+  8005b7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8005ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005bd:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8005c0:	73 0b                	jae    8005cd <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8005c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8005c5:	c1 e7 08             	shl    $0x8,%edi
+  8005c8:	0b 7d 10             	or     0x10(%ebp),%edi
+  8005cb:	eb 36                	jmp    800603 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8005cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d5:	f7 75 08             	divl   0x8(%ebp)
+  8005d8:	89 c1                	mov    %eax,%ecx
+  8005da:	ff 75 14             	push   0x14(%ebp)
+  8005dd:	ff 75 10             	push   0x10(%ebp)
+  8005e0:	83 eb 01             	sub    $0x1,%ebx
+  8005e3:	53                   	push   %ebx
+  8005e4:	ff 75 08             	push   0x8(%ebp)
+  8005e7:	89 f2                	mov    %esi,%edx
+  8005e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005ec:	e8 b8 ff ff ff       	call   8005a9 <printnum>
+  8005f1:	83 c4 10             	add    $0x10,%esp
+  8005f4:	eb 14                	jmp    80060a <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8005f6:	83 ec 08             	sub    $0x8,%esp
+  8005f9:	56                   	push   %esi
+  8005fa:	57                   	push   %edi
+  8005fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005fe:	ff d0                	call   *%eax
+  800600:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800603:	83 eb 01             	sub    $0x1,%ebx
+  800606:	85 db                	test   %ebx,%ebx
+  800608:	7f ec                	jg     8005f6 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80060a:	83 ec 08             	sub    $0x8,%esp
+  80060d:	56                   	push   %esi
+  80060e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800611:	ba 00 00 00 00       	mov    $0x0,%edx
+  800616:	f7 75 08             	divl   0x8(%ebp)
+  800619:	0f be 92 57 3a 80 00 	movsbl 0x803a57(%edx),%edx
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	c1 e0 08             	shl    $0x8,%eax
+  800626:	09 d0                	or     %edx,%eax
+  800628:	50                   	push   %eax
+  800629:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80062c:	ff d0                	call   *%eax
+}
+  80062e:	83 c4 10             	add    $0x10,%esp
+  800631:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800634:	5b                   	pop    %ebx
+  800635:	5e                   	pop    %esi
+  800636:	5f                   	pop    %edi
+  800637:	5d                   	pop    %ebp
+  800638:	c3                   	ret
+
+00800639 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800639:	55                   	push   %ebp
+  80063a:	89 e5                	mov    %esp,%ebp
+  80063c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80063f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800643:	8b 10                	mov    (%eax),%edx
+  800645:	3b 50 04             	cmp    0x4(%eax),%edx
+  800648:	73 0a                	jae    800654 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80064a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80064d:	89 08                	mov    %ecx,(%eax)
+  80064f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800652:	88 02                	mov    %al,(%edx)
+}
+  800654:	5d                   	pop    %ebp
+  800655:	c3                   	ret
+
+00800656 <printfmt>:
+{
+  800656:	55                   	push   %ebp
+  800657:	89 e5                	mov    %esp,%ebp
+  800659:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80065c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80065f:	50                   	push   %eax
+  800660:	ff 75 10             	push   0x10(%ebp)
+  800663:	ff 75 0c             	push   0xc(%ebp)
+  800666:	ff 75 08             	push   0x8(%ebp)
+  800669:	e8 05 00 00 00       	call   800673 <vprintfmt>
+}
+  80066e:	83 c4 10             	add    $0x10,%esp
+  800671:	c9                   	leave
+  800672:	c3                   	ret
+
+00800673 <vprintfmt>:
+{
+  800673:	55                   	push   %ebp
+  800674:	89 e5                	mov    %esp,%ebp
+  800676:	57                   	push   %edi
+  800677:	56                   	push   %esi
+  800678:	53                   	push   %ebx
+  800679:	83 ec 3c             	sub    $0x3c,%esp
+  80067c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80067f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800682:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800689:	eb 16                	jmp    8006a1 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80068b:	83 ec 08             	sub    $0x8,%esp
+  80068e:	ff 75 0c             	push   0xc(%ebp)
+  800691:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800694:	c1 e2 08             	shl    $0x8,%edx
+  800697:	09 d0                	or     %edx,%eax
+  800699:	50                   	push   %eax
+  80069a:	ff d7                	call   *%edi
+  80069c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80069f:	89 de                	mov    %ebx,%esi
+  8006a1:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8006a4:	0f b6 06             	movzbl (%esi),%eax
+  8006a7:	83 f8 25             	cmp    $0x25,%eax
+  8006aa:	74 0c                	je     8006b8 <vprintfmt+0x45>
+			if (ch == '\0')
+  8006ac:	85 c0                	test   %eax,%eax
+  8006ae:	75 db                	jne    80068b <vprintfmt+0x18>
+}
+  8006b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006b3:	5b                   	pop    %ebx
+  8006b4:	5e                   	pop    %esi
+  8006b5:	5f                   	pop    %edi
+  8006b6:	5d                   	pop    %ebp
+  8006b7:	c3                   	ret
+		padc = ' ';
+  8006b8:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8006bc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006c3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8006ca:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8006d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8006d6:	8d 73 01             	lea    0x1(%ebx),%esi
+  8006d9:	0f b6 13             	movzbl (%ebx),%edx
+  8006dc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8006df:	3c 55                	cmp    $0x55,%al
+  8006e1:	0f 87 2c 04 00 00    	ja     800b13 <vprintfmt+0x4a0>
+  8006e7:	0f b6 c0             	movzbl %al,%eax
+  8006ea:	ff 24 85 a0 3b 80 00 	jmp    *0x803ba0(,%eax,4)
+  8006f1:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8006f3:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8006f7:	eb dd                	jmp    8006d6 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f9:	89 f3                	mov    %esi,%ebx
+  8006fb:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8006ff:	eb d5                	jmp    8006d6 <vprintfmt+0x63>
+  800701:	0f b6 d2             	movzbl %dl,%edx
+  800704:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800706:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80070b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80070e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800712:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800715:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800718:	83 fe 09             	cmp    $0x9,%esi
+  80071b:	0f 87 8a 00 00 00    	ja     8007ab <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800721:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800724:	eb e5                	jmp    80070b <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 00                	mov    (%eax),%eax
+  80072b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8d 40 04             	lea    0x4(%eax),%eax
+  800734:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800737:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800739:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80073d:	79 97                	jns    8006d6 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80073f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800742:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800745:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80074c:	eb 88                	jmp    8006d6 <vprintfmt+0x63>
+			if (width < 0)
+  80074e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800751:	85 db                	test   %ebx,%ebx
+  800753:	b8 00 00 00 00       	mov    $0x0,%eax
+  800758:	0f 49 c3             	cmovns %ebx,%eax
+  80075b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80075e:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800760:	e9 71 ff ff ff       	jmp    8006d6 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800765:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800767:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80076e:	e9 63 ff ff ff       	jmp    8006d6 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800773:	8d 73 02             	lea    0x2(%ebx),%esi
+  800776:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80077a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800781:	3c 67                	cmp    $0x67,%al
+  800783:	0f 84 18 ff ff ff    	je     8006a1 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800789:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800790:	3c 72                	cmp    $0x72,%al
+  800792:	0f 84 09 ff ff ff    	je     8006a1 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800798:	3c 62                	cmp    $0x62,%al
+  80079a:	0f 94 c0             	sete   %al
+  80079d:	0f b6 c0             	movzbl %al,%eax
+  8007a0:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8007a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007a6:	e9 f6 fe ff ff       	jmp    8006a1 <vprintfmt+0x2e>
+  8007ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007ae:	eb 89                	jmp    800739 <vprintfmt+0xc6>
+			lflag++;
+  8007b0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007b3:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8007b5:	e9 1c ff ff ff       	jmp    8006d6 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8007ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bd:	8d 58 04             	lea    0x4(%eax),%ebx
+  8007c0:	83 ec 08             	sub    $0x8,%esp
+  8007c3:	ff 75 0c             	push   0xc(%ebp)
+  8007c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007c9:	c1 e0 08             	shl    $0x8,%eax
+  8007cc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007cf:	0b 01                	or     (%ecx),%eax
+  8007d1:	50                   	push   %eax
+  8007d2:	ff d7                	call   *%edi
+			break;
+  8007d4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8007d7:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8007da:	e9 c2 fe ff ff       	jmp    8006a1 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	89 d0                	mov    %edx,%eax
+  8007e9:	f7 d8                	neg    %eax
+  8007eb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007ee:	83 f8 12             	cmp    $0x12,%eax
+  8007f1:	7f 25                	jg     800818 <vprintfmt+0x1a5>
+  8007f3:	8b 14 85 00 3d 80 00 	mov    0x803d00(,%eax,4),%edx
+  8007fa:	85 d2                	test   %edx,%edx
+  8007fc:	74 1a                	je     800818 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8007fe:	52                   	push   %edx
+  8007ff:	68 1d 39 80 00       	push   $0x80391d
+  800804:	ff 75 0c             	push   0xc(%ebp)
+  800807:	57                   	push   %edi
+  800808:	e8 49 fe ff ff       	call   800656 <printfmt>
+  80080d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800810:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800813:	e9 89 fe ff ff       	jmp    8006a1 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800818:	50                   	push   %eax
+  800819:	68 6f 3a 80 00       	push   $0x803a6f
+  80081e:	ff 75 0c             	push   0xc(%ebp)
+  800821:	57                   	push   %edi
+  800822:	e8 2f fe ff ff       	call   800656 <printfmt>
+  800827:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80082a:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80082d:	e9 6f fe ff ff       	jmp    8006a1 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800832:	8b 45 14             	mov    0x14(%ebp),%eax
+  800835:	83 c0 04             	add    $0x4,%eax
+  800838:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80083b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800840:	85 c9                	test   %ecx,%ecx
+  800842:	b8 68 3a 80 00       	mov    $0x803a68,%eax
+  800847:	0f 45 c1             	cmovne %ecx,%eax
+  80084a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80084d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800851:	7e 06                	jle    800859 <vprintfmt+0x1e6>
+  800853:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800857:	75 1a                	jne    800873 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800859:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80085c:	c1 e0 08             	shl    $0x8,%eax
+  80085f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800862:	83 c8 3f             	or     $0x3f,%eax
+  800865:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800868:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80086b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80086e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800871:	eb 6d                	jmp    8008e0 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800873:	83 ec 08             	sub    $0x8,%esp
+  800876:	ff 75 d0             	push   -0x30(%ebp)
+  800879:	ff 75 c8             	push   -0x38(%ebp)
+  80087c:	e8 39 03 00 00       	call   800bba <strnlen>
+  800881:	89 c2                	mov    %eax,%edx
+  800883:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800886:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800888:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80088b:	c1 e1 08             	shl    $0x8,%ecx
+  80088e:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800892:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800894:	83 c4 10             	add    $0x10,%esp
+  800897:	89 c3                	mov    %eax,%ebx
+  800899:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80089c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80089f:	89 ce                	mov    %ecx,%esi
+  8008a1:	eb 0f                	jmp    8008b2 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8008a3:	83 ec 08             	sub    $0x8,%esp
+  8008a6:	ff 75 0c             	push   0xc(%ebp)
+  8008a9:	56                   	push   %esi
+  8008aa:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008ac:	83 eb 01             	sub    $0x1,%ebx
+  8008af:	83 c4 10             	add    $0x10,%esp
+  8008b2:	85 db                	test   %ebx,%ebx
+  8008b4:	7f ed                	jg     8008a3 <vprintfmt+0x230>
+  8008b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8008bc:	85 c0                	test   %eax,%eax
+  8008be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c3:	0f 49 d0             	cmovns %eax,%edx
+  8008c6:	29 d0                	sub    %edx,%eax
+  8008c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008cb:	eb 8c                	jmp    800859 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8008cd:	83 ec 08             	sub    $0x8,%esp
+  8008d0:	ff 75 0c             	push   0xc(%ebp)
+  8008d3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8008d6:	09 c2                	or     %eax,%edx
+  8008d8:	52                   	push   %edx
+  8008d9:	ff d7                	call   *%edi
+  8008db:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008de:	89 d9                	mov    %ebx,%ecx
+  8008e0:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8008e3:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8008e7:	0f be d0             	movsbl %al,%edx
+  8008ea:	85 d2                	test   %edx,%edx
+  8008ec:	74 2a                	je     800918 <vprintfmt+0x2a5>
+  8008ee:	85 f6                	test   %esi,%esi
+  8008f0:	78 05                	js     8008f7 <vprintfmt+0x284>
+  8008f2:	83 ee 01             	sub    $0x1,%esi
+  8008f5:	78 3b                	js     800932 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008f7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008fb:	74 d0                	je     8008cd <vprintfmt+0x25a>
+  8008fd:	0f be c0             	movsbl %al,%eax
+  800900:	83 e8 20             	sub    $0x20,%eax
+  800903:	83 f8 5e             	cmp    $0x5e,%eax
+  800906:	76 c5                	jbe    8008cd <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	ff 75 0c             	push   0xc(%ebp)
+  80090e:	ff 75 cc             	push   -0x34(%ebp)
+  800911:	ff d7                	call   *%edi
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	eb c6                	jmp    8008de <vprintfmt+0x26b>
+  800918:	8b 75 10             	mov    0x10(%ebp),%esi
+  80091b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80091e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800921:	01 c3                	add    %eax,%ebx
+  800923:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800925:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800928:	83 c8 20             	or     $0x20,%eax
+  80092b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80092e:	89 c6                	mov    %eax,%esi
+  800930:	eb 14                	jmp    800946 <vprintfmt+0x2d3>
+  800932:	8b 75 10             	mov    0x10(%ebp),%esi
+  800935:	eb e4                	jmp    80091b <vprintfmt+0x2a8>
+  800937:	83 ec 08             	sub    $0x8,%esp
+  80093a:	ff 75 0c             	push   0xc(%ebp)
+  80093d:	56                   	push   %esi
+  80093e:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800940:	83 eb 01             	sub    $0x1,%ebx
+  800943:	83 c4 10             	add    $0x10,%esp
+  800946:	85 db                	test   %ebx,%ebx
+  800948:	7f ed                	jg     800937 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80094a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80094d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800950:	89 45 14             	mov    %eax,0x14(%ebp)
+  800953:	e9 49 fd ff ff       	jmp    8006a1 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800958:	83 f9 01             	cmp    $0x1,%ecx
+  80095b:	7f 1f                	jg     80097c <vprintfmt+0x309>
+	else if (lflag)
+  80095d:	85 c9                	test   %ecx,%ecx
+  80095f:	74 69                	je     8009ca <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800961:	8b 45 14             	mov    0x14(%ebp),%eax
+  800964:	8b 00                	mov    (%eax),%eax
+  800966:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800969:	89 c1                	mov    %eax,%ecx
+  80096b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80096e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800971:	8b 45 14             	mov    0x14(%ebp),%eax
+  800974:	8d 40 04             	lea    0x4(%eax),%eax
+  800977:	89 45 14             	mov    %eax,0x14(%ebp)
+  80097a:	eb 17                	jmp    800993 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80097c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097f:	8b 50 04             	mov    0x4(%eax),%edx
+  800982:	8b 00                	mov    (%eax),%eax
+  800984:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800987:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80098a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098d:	8d 40 08             	lea    0x8(%eax),%eax
+  800990:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800993:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800996:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800999:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80099e:	85 db                	test   %ebx,%ebx
+  8009a0:	0f 89 f6 00 00 00    	jns    800a9c <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8009a6:	83 ec 08             	sub    $0x8,%esp
+  8009a9:	ff 75 0c             	push   0xc(%ebp)
+  8009ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8009af:	c1 e0 08             	shl    $0x8,%eax
+  8009b2:	83 c8 2d             	or     $0x2d,%eax
+  8009b5:	50                   	push   %eax
+  8009b6:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8009b8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8009bb:	f7 d9                	neg    %ecx
+  8009bd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8009c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009c5:	e9 d2 00 00 00       	jmp    800a9c <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8009ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cd:	8b 00                	mov    (%eax),%eax
+  8009cf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009d2:	89 c1                	mov    %eax,%ecx
+  8009d4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009d7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009e3:	eb ae                	jmp    800993 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8009e5:	83 f9 01             	cmp    $0x1,%ecx
+  8009e8:	7f 19                	jg     800a03 <vprintfmt+0x390>
+	else if (lflag)
+  8009ea:	85 c9                	test   %ecx,%ecx
+  8009ec:	74 2a                	je     800a18 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8009ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f1:	8b 08                	mov    (%eax),%ecx
+  8009f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8009fe:	e9 99 00 00 00       	jmp    800a9c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a03:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a06:	8b 08                	mov    (%eax),%ecx
+  800a08:	8d 40 08             	lea    0x8(%eax),%eax
+  800a0b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a0e:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800a13:	e9 84 00 00 00       	jmp    800a9c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1b:	8b 08                	mov    (%eax),%ecx
+  800a1d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a23:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800a28:	eb 72                	jmp    800a9c <vprintfmt+0x429>
+	if (lflag >= 2)
+  800a2a:	83 f9 01             	cmp    $0x1,%ecx
+  800a2d:	7f 16                	jg     800a45 <vprintfmt+0x3d2>
+	else if (lflag)
+  800a2f:	85 c9                	test   %ecx,%ecx
+  800a31:	74 24                	je     800a57 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800a33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a36:	8b 08                	mov    (%eax),%ecx
+  800a38:	8d 40 04             	lea    0x4(%eax),%eax
+  800a3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a3e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800a43:	eb 57                	jmp    800a9c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a45:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a48:	8b 08                	mov    (%eax),%ecx
+  800a4a:	8d 40 08             	lea    0x8(%eax),%eax
+  800a4d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a50:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800a55:	eb 45                	jmp    800a9c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800a57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5a:	8b 08                	mov    (%eax),%ecx
+  800a5c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a5f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a62:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800a67:	eb 33                	jmp    800a9c <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800a69:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a6c:	c1 e3 08             	shl    $0x8,%ebx
+  800a6f:	83 ec 08             	sub    $0x8,%esp
+  800a72:	ff 75 0c             	push   0xc(%ebp)
+  800a75:	89 d8                	mov    %ebx,%eax
+  800a77:	83 c8 30             	or     $0x30,%eax
+  800a7a:	50                   	push   %eax
+  800a7b:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800a7d:	83 c4 08             	add    $0x8,%esp
+  800a80:	ff 75 0c             	push   0xc(%ebp)
+  800a83:	83 cb 78             	or     $0x78,%ebx
+  800a86:	53                   	push   %ebx
+  800a87:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800a89:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8c:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800a8e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a91:	8d 40 04             	lea    0x4(%eax),%eax
+  800a94:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a97:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800a9c:	ff 75 e4             	push   -0x1c(%ebp)
+  800a9f:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800aa3:	52                   	push   %edx
+  800aa4:	ff 75 e0             	push   -0x20(%ebp)
+  800aa7:	50                   	push   %eax
+  800aa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aab:	89 f8                	mov    %edi,%eax
+  800aad:	e8 f7 fa ff ff       	call   8005a9 <printnum>
+			break;
+  800ab2:	83 c4 10             	add    $0x10,%esp
+  800ab5:	e9 e7 fb ff ff       	jmp    8006a1 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800aba:	83 f9 01             	cmp    $0x1,%ecx
+  800abd:	7f 16                	jg     800ad5 <vprintfmt+0x462>
+	else if (lflag)
+  800abf:	85 c9                	test   %ecx,%ecx
+  800ac1:	74 24                	je     800ae7 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800ac3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac6:	8b 08                	mov    (%eax),%ecx
+  800ac8:	8d 40 04             	lea    0x4(%eax),%eax
+  800acb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ace:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800ad3:	eb c7                	jmp    800a9c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800ad5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad8:	8b 08                	mov    (%eax),%ecx
+  800ada:	8d 40 08             	lea    0x8(%eax),%eax
+  800add:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ae0:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800ae5:	eb b5                	jmp    800a9c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800ae7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aea:	8b 08                	mov    (%eax),%ecx
+  800aec:	8d 40 04             	lea    0x4(%eax),%eax
+  800aef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800af2:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800af7:	eb a3                	jmp    800a9c <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800af9:	83 ec 08             	sub    $0x8,%esp
+  800afc:	ff 75 0c             	push   0xc(%ebp)
+  800aff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b02:	c1 e0 08             	shl    $0x8,%eax
+  800b05:	83 c8 25             	or     $0x25,%eax
+  800b08:	50                   	push   %eax
+  800b09:	ff d7                	call   *%edi
+			break;
+  800b0b:	83 c4 10             	add    $0x10,%esp
+  800b0e:	e9 8e fb ff ff       	jmp    8006a1 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800b13:	83 ec 08             	sub    $0x8,%esp
+  800b16:	ff 75 0c             	push   0xc(%ebp)
+  800b19:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b1c:	c1 e0 08             	shl    $0x8,%eax
+  800b1f:	83 c8 25             	or     $0x25,%eax
+  800b22:	50                   	push   %eax
+  800b23:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800b25:	83 c4 10             	add    $0x10,%esp
+  800b28:	89 de                	mov    %ebx,%esi
+  800b2a:	eb 03                	jmp    800b2f <vprintfmt+0x4bc>
+  800b2c:	83 ee 01             	sub    $0x1,%esi
+  800b2f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800b33:	75 f7                	jne    800b2c <vprintfmt+0x4b9>
+  800b35:	e9 67 fb ff ff       	jmp    8006a1 <vprintfmt+0x2e>
+
+00800b3a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	83 ec 18             	sub    $0x18,%esp
+  800b40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b43:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b46:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b49:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b4d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b50:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b57:	85 c0                	test   %eax,%eax
+  800b59:	74 26                	je     800b81 <vsnprintf+0x47>
+  800b5b:	85 d2                	test   %edx,%edx
+  800b5d:	7e 22                	jle    800b81 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b5f:	ff 75 14             	push   0x14(%ebp)
+  800b62:	ff 75 10             	push   0x10(%ebp)
+  800b65:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b68:	50                   	push   %eax
+  800b69:	68 39 06 80 00       	push   $0x800639
+  800b6e:	e8 00 fb ff ff       	call   800673 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b73:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b76:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b7c:	83 c4 10             	add    $0x10,%esp
+}
+  800b7f:	c9                   	leave
+  800b80:	c3                   	ret
+		return -E_INVAL;
+  800b81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b86:	eb f7                	jmp    800b7f <vsnprintf+0x45>
+
+00800b88 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800b8e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b91:	50                   	push   %eax
+  800b92:	ff 75 10             	push   0x10(%ebp)
+  800b95:	ff 75 0c             	push   0xc(%ebp)
+  800b98:	ff 75 08             	push   0x8(%ebp)
+  800b9b:	e8 9a ff ff ff       	call   800b3a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ba0:	c9                   	leave
+  800ba1:	c3                   	ret
+
+00800ba2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800ba2:	55                   	push   %ebp
+  800ba3:	89 e5                	mov    %esp,%ebp
+  800ba5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bad:	eb 03                	jmp    800bb2 <strlen+0x10>
+		n++;
+  800baf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800bb2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bb6:	75 f7                	jne    800baf <strlen+0xd>
+	return n;
+}
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+
+00800bba <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc8:	eb 03                	jmp    800bcd <strnlen+0x13>
+		n++;
+  800bca:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bcd:	39 d0                	cmp    %edx,%eax
+  800bcf:	74 08                	je     800bd9 <strnlen+0x1f>
+  800bd1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bd5:	75 f3                	jne    800bca <strnlen+0x10>
+  800bd7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bd9:	89 d0                	mov    %edx,%eax
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	c3                   	ret
+
+00800bdd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	53                   	push   %ebx
+  800be1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800be4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bec:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bf0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bf3:	83 c0 01             	add    $0x1,%eax
+  800bf6:	84 d2                	test   %dl,%dl
+  800bf8:	75 f2                	jne    800bec <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bfa:	89 c8                	mov    %ecx,%eax
+  800bfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bff:	c9                   	leave
+  800c00:	c3                   	ret
+
+00800c01 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	53                   	push   %ebx
+  800c05:	83 ec 10             	sub    $0x10,%esp
+  800c08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c0b:	53                   	push   %ebx
+  800c0c:	e8 91 ff ff ff       	call   800ba2 <strlen>
+  800c11:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c14:	ff 75 0c             	push   0xc(%ebp)
+  800c17:	01 d8                	add    %ebx,%eax
+  800c19:	50                   	push   %eax
+  800c1a:	e8 be ff ff ff       	call   800bdd <strcpy>
+	return dst;
+}
+  800c1f:	89 d8                	mov    %ebx,%eax
+  800c21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c24:	c9                   	leave
+  800c25:	c3                   	ret
+
+00800c26 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c26:	55                   	push   %ebp
+  800c27:	89 e5                	mov    %esp,%ebp
+  800c29:	56                   	push   %esi
+  800c2a:	53                   	push   %ebx
+  800c2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c31:	89 f3                	mov    %esi,%ebx
+  800c33:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c36:	89 f0                	mov    %esi,%eax
+  800c38:	eb 0f                	jmp    800c49 <strncpy+0x23>
+		*dst++ = *src;
+  800c3a:	83 c0 01             	add    $0x1,%eax
+  800c3d:	0f b6 0a             	movzbl (%edx),%ecx
+  800c40:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c43:	80 f9 01             	cmp    $0x1,%cl
+  800c46:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c49:	39 d8                	cmp    %ebx,%eax
+  800c4b:	75 ed                	jne    800c3a <strncpy+0x14>
+	}
+	return ret;
+}
+  800c4d:	89 f0                	mov    %esi,%eax
+  800c4f:	5b                   	pop    %ebx
+  800c50:	5e                   	pop    %esi
+  800c51:	5d                   	pop    %ebp
+  800c52:	c3                   	ret
+
+00800c53 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	56                   	push   %esi
+  800c57:	53                   	push   %ebx
+  800c58:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c5e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c61:	89 f0                	mov    %esi,%eax
+  800c63:	85 d2                	test   %edx,%edx
+  800c65:	74 21                	je     800c88 <strlcpy+0x35>
+  800c67:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c6b:	89 f2                	mov    %esi,%edx
+  800c6d:	eb 09                	jmp    800c78 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c6f:	83 c1 01             	add    $0x1,%ecx
+  800c72:	83 c2 01             	add    $0x1,%edx
+  800c75:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c78:	39 c2                	cmp    %eax,%edx
+  800c7a:	74 09                	je     800c85 <strlcpy+0x32>
+  800c7c:	0f b6 19             	movzbl (%ecx),%ebx
+  800c7f:	84 db                	test   %bl,%bl
+  800c81:	75 ec                	jne    800c6f <strlcpy+0x1c>
+  800c83:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c85:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c88:	29 f0                	sub    %esi,%eax
+}
+  800c8a:	5b                   	pop    %ebx
+  800c8b:	5e                   	pop    %esi
+  800c8c:	5d                   	pop    %ebp
+  800c8d:	c3                   	ret
+
+00800c8e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c8e:	55                   	push   %ebp
+  800c8f:	89 e5                	mov    %esp,%ebp
+  800c91:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c94:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c97:	eb 06                	jmp    800c9f <strcmp+0x11>
+		p++, q++;
+  800c99:	83 c1 01             	add    $0x1,%ecx
+  800c9c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c9f:	0f b6 01             	movzbl (%ecx),%eax
+  800ca2:	84 c0                	test   %al,%al
+  800ca4:	74 04                	je     800caa <strcmp+0x1c>
+  800ca6:	3a 02                	cmp    (%edx),%al
+  800ca8:	74 ef                	je     800c99 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800caa:	0f b6 c0             	movzbl %al,%eax
+  800cad:	0f b6 12             	movzbl (%edx),%edx
+  800cb0:	29 d0                	sub    %edx,%eax
+}
+  800cb2:	5d                   	pop    %ebp
+  800cb3:	c3                   	ret
+
+00800cb4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	53                   	push   %ebx
+  800cb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbe:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800cc1:	eb 09                	jmp    800ccc <strncmp+0x18>
+		n--, p++, q++;
+  800cc3:	83 ea 01             	sub    $0x1,%edx
+  800cc6:	83 c0 01             	add    $0x1,%eax
+  800cc9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ccc:	85 d2                	test   %edx,%edx
+  800cce:	74 18                	je     800ce8 <strncmp+0x34>
+  800cd0:	0f b6 18             	movzbl (%eax),%ebx
+  800cd3:	84 db                	test   %bl,%bl
+  800cd5:	74 04                	je     800cdb <strncmp+0x27>
+  800cd7:	3a 19                	cmp    (%ecx),%bl
+  800cd9:	74 e8                	je     800cc3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cdb:	0f b6 00             	movzbl (%eax),%eax
+  800cde:	0f b6 11             	movzbl (%ecx),%edx
+  800ce1:	29 d0                	sub    %edx,%eax
+}
+  800ce3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ce6:	c9                   	leave
+  800ce7:	c3                   	ret
+		return 0;
+  800ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ced:	eb f4                	jmp    800ce3 <strncmp+0x2f>
+
+00800cef <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800cef:	55                   	push   %ebp
+  800cf0:	89 e5                	mov    %esp,%ebp
+  800cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cf9:	eb 03                	jmp    800cfe <strchr+0xf>
+  800cfb:	83 c0 01             	add    $0x1,%eax
+  800cfe:	0f b6 10             	movzbl (%eax),%edx
+  800d01:	84 d2                	test   %dl,%dl
+  800d03:	74 06                	je     800d0b <strchr+0x1c>
+		if (*s == c)
+  800d05:	38 ca                	cmp    %cl,%dl
+  800d07:	75 f2                	jne    800cfb <strchr+0xc>
+  800d09:	eb 05                	jmp    800d10 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d10:	5d                   	pop    %ebp
+  800d11:	c3                   	ret
+
+00800d12 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d18:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d1c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d1f:	38 ca                	cmp    %cl,%dl
+  800d21:	74 09                	je     800d2c <strfind+0x1a>
+  800d23:	84 d2                	test   %dl,%dl
+  800d25:	74 05                	je     800d2c <strfind+0x1a>
+	for (; *s; s++)
+  800d27:	83 c0 01             	add    $0x1,%eax
+  800d2a:	eb f0                	jmp    800d1c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	c3                   	ret
+
+00800d2e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d2e:	55                   	push   %ebp
+  800d2f:	89 e5                	mov    %esp,%ebp
+  800d31:	57                   	push   %edi
+  800d32:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d35:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d38:	85 c9                	test   %ecx,%ecx
+  800d3a:	74 20                	je     800d5c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d3c:	89 f8                	mov    %edi,%eax
+  800d3e:	09 c8                	or     %ecx,%eax
+  800d40:	a8 03                	test   $0x3,%al
+  800d42:	75 12                	jne    800d56 <memset+0x28>
+		c &= 0xFF;
+  800d44:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d48:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d4e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d51:	fc                   	cld
+  800d52:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d54:	eb 06                	jmp    800d5c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d59:	fc                   	cld
+  800d5a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d5c:	89 f8                	mov    %edi,%eax
+  800d5e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d61:	c9                   	leave
+  800d62:	c3                   	ret
+
+00800d63 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d63:	55                   	push   %ebp
+  800d64:	89 e5                	mov    %esp,%ebp
+  800d66:	57                   	push   %edi
+  800d67:	56                   	push   %esi
+  800d68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d6e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d71:	39 c6                	cmp    %eax,%esi
+  800d73:	73 32                	jae    800da7 <memmove+0x44>
+  800d75:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d78:	39 d0                	cmp    %edx,%eax
+  800d7a:	73 2b                	jae    800da7 <memmove+0x44>
+		s += n;
+		d += n;
+  800d7c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d7f:	89 d6                	mov    %edx,%esi
+  800d81:	09 fe                	or     %edi,%esi
+  800d83:	09 ce                	or     %ecx,%esi
+  800d85:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d8b:	75 0e                	jne    800d9b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d8d:	83 ef 04             	sub    $0x4,%edi
+  800d90:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d93:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d96:	fd                   	std
+  800d97:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d99:	eb 09                	jmp    800da4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d9b:	83 ef 01             	sub    $0x1,%edi
+  800d9e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800da1:	fd                   	std
+  800da2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800da4:	fc                   	cld
+  800da5:	eb 1a                	jmp    800dc1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800da7:	89 f2                	mov    %esi,%edx
+  800da9:	09 c2                	or     %eax,%edx
+  800dab:	09 ca                	or     %ecx,%edx
+  800dad:	f6 c2 03             	test   $0x3,%dl
+  800db0:	75 0a                	jne    800dbc <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800db2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800db5:	89 c7                	mov    %eax,%edi
+  800db7:	fc                   	cld
+  800db8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dba:	eb 05                	jmp    800dc1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800dbc:	89 c7                	mov    %eax,%edi
+  800dbe:	fc                   	cld
+  800dbf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800dc1:	5e                   	pop    %esi
+  800dc2:	5f                   	pop    %edi
+  800dc3:	5d                   	pop    %ebp
+  800dc4:	c3                   	ret
+
+00800dc5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dcb:	ff 75 10             	push   0x10(%ebp)
+  800dce:	ff 75 0c             	push   0xc(%ebp)
+  800dd1:	ff 75 08             	push   0x8(%ebp)
+  800dd4:	e8 8a ff ff ff       	call   800d63 <memmove>
+}
+  800dd9:	c9                   	leave
+  800dda:	c3                   	ret
+
+00800ddb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ddb:	55                   	push   %ebp
+  800ddc:	89 e5                	mov    %esp,%ebp
+  800dde:	56                   	push   %esi
+  800ddf:	53                   	push   %ebx
+  800de0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800de6:	89 c6                	mov    %eax,%esi
+  800de8:	03 75 10             	add    0x10(%ebp),%esi
+  800deb:	eb 06                	jmp    800df3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ded:	83 c0 01             	add    $0x1,%eax
+  800df0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800df3:	39 f0                	cmp    %esi,%eax
+  800df5:	74 14                	je     800e0b <memcmp+0x30>
+		if (*s1 != *s2)
+  800df7:	0f b6 08             	movzbl (%eax),%ecx
+  800dfa:	0f b6 1a             	movzbl (%edx),%ebx
+  800dfd:	38 d9                	cmp    %bl,%cl
+  800dff:	74 ec                	je     800ded <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800e01:	0f b6 c1             	movzbl %cl,%eax
+  800e04:	0f b6 db             	movzbl %bl,%ebx
+  800e07:	29 d8                	sub    %ebx,%eax
+  800e09:	eb 05                	jmp    800e10 <memcmp+0x35>
+	}
+
+	return 0;
+  800e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e10:	5b                   	pop    %ebx
+  800e11:	5e                   	pop    %esi
+  800e12:	5d                   	pop    %ebp
+  800e13:	c3                   	ret
+
+00800e14 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e1d:	89 c2                	mov    %eax,%edx
+  800e1f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e22:	eb 03                	jmp    800e27 <memfind+0x13>
+  800e24:	83 c0 01             	add    $0x1,%eax
+  800e27:	39 d0                	cmp    %edx,%eax
+  800e29:	73 04                	jae    800e2f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e2b:	38 08                	cmp    %cl,(%eax)
+  800e2d:	75 f5                	jne    800e24 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 1c             	sub    $0x1c,%esp
+  800e3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e3d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e40:	eb 03                	jmp    800e45 <strtol+0x14>
+		s++;
+  800e42:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800e45:	0f b6 06             	movzbl (%esi),%eax
+  800e48:	3c 20                	cmp    $0x20,%al
+  800e4a:	74 f6                	je     800e42 <strtol+0x11>
+  800e4c:	3c 09                	cmp    $0x9,%al
+  800e4e:	74 f2                	je     800e42 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e50:	3c 2b                	cmp    $0x2b,%al
+  800e52:	74 43                	je     800e97 <strtol+0x66>
+	int neg = 0;
+  800e54:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800e59:	3c 2d                	cmp    $0x2d,%al
+  800e5b:	74 44                	je     800ea1 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e5d:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800e63:	75 0f                	jne    800e74 <strtol+0x43>
+  800e65:	80 3e 30             	cmpb   $0x30,(%esi)
+  800e68:	74 41                	je     800eab <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e6a:	85 ff                	test   %edi,%edi
+  800e6c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e71:	0f 44 f8             	cmove  %eax,%edi
+  800e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e79:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800e7e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800e81:	89 fb                	mov    %edi,%ebx
+  800e83:	c1 fb 1f             	sar    $0x1f,%ebx
+  800e86:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800e89:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e8c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800e8f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800e92:	89 75 08             	mov    %esi,0x8(%ebp)
+  800e95:	eb 67                	jmp    800efe <strtol+0xcd>
+		s++;
+  800e97:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800e9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9f:	eb bc                	jmp    800e5d <strtol+0x2c>
+		s++, neg = 1;
+  800ea1:	83 c6 01             	add    $0x1,%esi
+  800ea4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ea9:	eb b2                	jmp    800e5d <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eab:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800eaf:	74 0e                	je     800ebf <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800eb1:	85 ff                	test   %edi,%edi
+  800eb3:	75 bf                	jne    800e74 <strtol+0x43>
+		s++, base = 8;
+  800eb5:	83 c6 01             	add    $0x1,%esi
+  800eb8:	bf 08 00 00 00       	mov    $0x8,%edi
+  800ebd:	eb b5                	jmp    800e74 <strtol+0x43>
+		s += 2, base = 16;
+  800ebf:	83 c6 02             	add    $0x2,%esi
+  800ec2:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ec7:	eb ab                	jmp    800e74 <strtol+0x43>
+			dig = *s - '0';
+  800ec9:	0f be c9             	movsbl %cl,%ecx
+  800ecc:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800ecf:	39 f9                	cmp    %edi,%ecx
+  800ed1:	7d 59                	jge    800f2c <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800ed3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800ed7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800eda:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800edd:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800ee0:	0f af d8             	imul   %eax,%ebx
+  800ee3:	0f af d7             	imul   %edi,%edx
+  800ee6:	01 d3                	add    %edx,%ebx
+  800ee8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800eeb:	f7 e7                	mul    %edi
+  800eed:	01 da                	add    %ebx,%edx
+  800eef:	89 cb                	mov    %ecx,%ebx
+  800ef1:	c1 fb 1f             	sar    $0x1f,%ebx
+  800ef4:	01 c8                	add    %ecx,%eax
+  800ef6:	11 da                	adc    %ebx,%edx
+  800ef8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800efb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800efe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f01:	0f b6 08             	movzbl (%eax),%ecx
+  800f04:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800f07:	80 fb 09             	cmp    $0x9,%bl
+  800f0a:	76 bd                	jbe    800ec9 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800f0c:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800f0f:	80 fb 19             	cmp    $0x19,%bl
+  800f12:	77 08                	ja     800f1c <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800f14:	0f be c9             	movsbl %cl,%ecx
+  800f17:	83 e9 57             	sub    $0x57,%ecx
+  800f1a:	eb b3                	jmp    800ecf <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f1c:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800f1f:	80 fb 19             	cmp    $0x19,%bl
+  800f22:	77 08                	ja     800f2c <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800f24:	0f be c9             	movsbl %cl,%ecx
+  800f27:	83 e9 37             	sub    $0x37,%ecx
+  800f2a:	eb a3                	jmp    800ecf <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f2c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800f2f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f32:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800f35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f38:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f3c:	74 05                	je     800f43 <strtol+0x112>
+		*endptr = (char *) s;
+  800f3e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800f41:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800f43:	85 c9                	test   %ecx,%ecx
+  800f45:	74 07                	je     800f4e <strtol+0x11d>
+  800f47:	f7 d8                	neg    %eax
+  800f49:	83 d2 00             	adc    $0x0,%edx
+  800f4c:	f7 da                	neg    %edx
+}
+  800f4e:	83 c4 1c             	add    $0x1c,%esp
+  800f51:	5b                   	pop    %ebx
+  800f52:	5e                   	pop    %esi
+  800f53:	5f                   	pop    %edi
+  800f54:	5d                   	pop    %ebp
+  800f55:	c3                   	ret
+
+00800f56 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	57                   	push   %edi
+  800f5a:	56                   	push   %esi
+  800f5b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800f5c:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  800f63:	74 18                	je     800f7d <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f70:	89 c3                	mov    %eax,%ebx
+  800f72:	89 c7                	mov    %eax,%edi
+  800f74:	89 c6                	mov    %eax,%esi
+  800f76:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f88:	89 c3                	mov    %eax,%ebx
+  800f8a:	89 c7                	mov    %eax,%edi
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	8d 35 97 0f 80 00    	lea    0x800f97,%esi
+  800f95:	0f 34                	sysenter
+  800f97:	5d                   	pop    %ebp
+		goto out;
+  800f98:	eb de                	jmp    800f78 <sys_cputs+0x22>
+
+00800f9a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f9a:	55                   	push   %ebp
+  800f9b:	89 e5                	mov    %esp,%ebp
+  800f9d:	57                   	push   %edi
+  800f9e:	56                   	push   %esi
+  800f9f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800fa0:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  800fa7:	74 19                	je     800fc2 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800fa9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fae:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fb3:	89 d1                	mov    %edx,%ecx
+  800fb5:	89 d3                	mov    %edx,%ebx
+  800fb7:	89 d7                	mov    %edx,%edi
+  800fb9:	89 d6                	mov    %edx,%esi
+  800fbb:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800fbd:	5b                   	pop    %ebx
+  800fbe:	5e                   	pop    %esi
+  800fbf:	5f                   	pop    %edi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fcc:	89 d1                	mov    %edx,%ecx
+  800fce:	89 d3                	mov    %edx,%ebx
+  800fd0:	89 d7                	mov    %edx,%edi
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	8d 35 dd 0f 80 00    	lea    0x800fdd,%esi
+  800fdb:	0f 34                	sysenter
+  800fdd:	5d                   	pop    %ebp
+		goto out;
+  800fde:	eb dd                	jmp    800fbd <sys_cgetc+0x23>
+
+00800fe0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800fe0:	55                   	push   %ebp
+  800fe1:	89 e5                	mov    %esp,%ebp
+  800fe3:	57                   	push   %edi
+  800fe4:	56                   	push   %esi
+  800fe5:	53                   	push   %ebx
+  800fe6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fe9:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  800ff0:	74 21                	je     801013 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800ff2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ffc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fff:	89 cb                	mov    %ecx,%ebx
+  801001:	89 cf                	mov    %ecx,%edi
+  801003:	89 ce                	mov    %ecx,%esi
+  801005:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801007:	85 c0                	test   %eax,%eax
+  801009:	7f 27                	jg     801032 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80100b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5f                   	pop    %edi
+  801011:	5d                   	pop    %ebp
+  801012:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801013:	8b 55 08             	mov    0x8(%ebp),%edx
+  801016:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801020:	89 cb                	mov    %ecx,%ebx
+  801022:	89 cf                	mov    %ecx,%edi
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	8d 35 2f 10 80 00    	lea    0x80102f,%esi
+  80102d:	0f 34                	sysenter
+  80102f:	5d                   	pop    %ebp
+		goto out;
+  801030:	eb d5                	jmp    801007 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801032:	83 ec 0c             	sub    $0xc,%esp
+  801035:	50                   	push   %eax
+  801036:	6a 03                	push   $0x3
+  801038:	68 6b 3d 80 00       	push   $0x803d6b
+  80103d:	6a 3f                	push   $0x3f
+  80103f:	68 88 3d 80 00       	push   $0x803d88
+  801044:	e8 71 f4 ff ff       	call   8004ba <_panic>
+
+00801049 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	56                   	push   %esi
+  80104e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80104f:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801056:	74 19                	je     801071 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  801058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801062:	89 d1                	mov    %edx,%ecx
+  801064:	89 d3                	mov    %edx,%ebx
+  801066:	89 d7                	mov    %edx,%edi
+  801068:	89 d6                	mov    %edx,%esi
+  80106a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80106c:	5b                   	pop    %ebx
+  80106d:	5e                   	pop    %esi
+  80106e:	5f                   	pop    %edi
+  80106f:	5d                   	pop    %ebp
+  801070:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801071:	ba 00 00 00 00       	mov    $0x0,%edx
+  801076:	b8 02 00 00 00       	mov    $0x2,%eax
+  80107b:	89 d1                	mov    %edx,%ecx
+  80107d:	89 d3                	mov    %edx,%ebx
+  80107f:	89 d7                	mov    %edx,%edi
+  801081:	55                   	push   %ebp
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	8d 35 8c 10 80 00    	lea    0x80108c,%esi
+  80108a:	0f 34                	sysenter
+  80108c:	5d                   	pop    %ebp
+		goto out;
+  80108d:	eb dd                	jmp    80106c <sys_getenvid+0x23>
+
+0080108f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	57                   	push   %edi
+  801093:	56                   	push   %esi
+  801094:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801095:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80109c:	74 19                	je     8010b7 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  80109e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010a8:	89 d1                	mov    %edx,%ecx
+  8010aa:	89 d3                	mov    %edx,%ebx
+  8010ac:	89 d7                	mov    %edx,%edi
+  8010ae:	89 d6                	mov    %edx,%esi
+  8010b0:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010b2:	5b                   	pop    %ebx
+  8010b3:	5e                   	pop    %esi
+  8010b4:	5f                   	pop    %edi
+  8010b5:	5d                   	pop    %ebp
+  8010b6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010bc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010c1:	89 d1                	mov    %edx,%ecx
+  8010c3:	89 d3                	mov    %edx,%ebx
+  8010c5:	89 d7                	mov    %edx,%edi
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	8d 35 d2 10 80 00    	lea    0x8010d2,%esi
+  8010d0:	0f 34                	sysenter
+  8010d2:	5d                   	pop    %ebp
+		goto out;
+  8010d3:	eb dd                	jmp    8010b2 <sys_yield+0x23>
+
+008010d5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	57                   	push   %edi
+  8010d9:	56                   	push   %esi
+  8010da:	53                   	push   %ebx
+  8010db:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010de:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8010e5:	74 23                	je     80110a <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  8010e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ec:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fa:	89 f7                	mov    %esi,%edi
+  8010fc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010fe:	85 c0                	test   %eax,%eax
+  801100:	7f 29                	jg     80112b <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801102:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801105:	5b                   	pop    %ebx
+  801106:	5e                   	pop    %esi
+  801107:	5f                   	pop    %edi
+  801108:	5d                   	pop    %ebp
+  801109:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80110a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801110:	b8 04 00 00 00       	mov    $0x4,%eax
+  801115:	bf 00 00 00 00       	mov    $0x0,%edi
+  80111a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111d:	55                   	push   %ebp
+  80111e:	89 e5                	mov    %esp,%ebp
+  801120:	8d 35 28 11 80 00    	lea    0x801128,%esi
+  801126:	0f 34                	sysenter
+  801128:	5d                   	pop    %ebp
+		goto out;
+  801129:	eb d3                	jmp    8010fe <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  80112e:	50                   	push   %eax
+  80112f:	6a 04                	push   $0x4
+  801131:	68 6b 3d 80 00       	push   $0x803d6b
+  801136:	6a 3f                	push   $0x3f
+  801138:	68 88 3d 80 00       	push   $0x803d88
+  80113d:	e8 78 f3 ff ff       	call   8004ba <_panic>
+
+00801142 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	57                   	push   %edi
+  801146:	56                   	push   %esi
+  801147:	53                   	push   %ebx
+  801148:	83 ec 0c             	sub    $0xc,%esp
+  80114b:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  80114e:	85 f6                	test   %esi,%esi
+  801150:	75 09                	jne    80115b <sys_page_map+0x19>
+  801152:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801159:	74 1f                	je     80117a <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  80115b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801160:	8b 55 08             	mov    0x8(%ebp),%edx
+  801163:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801166:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801169:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80116c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116e:	85 c0                	test   %eax,%eax
+  801170:	7f 27                	jg     801199 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80117a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801180:	b8 05 00 00 00       	mov    $0x5,%eax
+  801185:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801188:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80118b:	55                   	push   %ebp
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	8d 35 96 11 80 00    	lea    0x801196,%esi
+  801194:	0f 34                	sysenter
+  801196:	5d                   	pop    %ebp
+		goto out;
+  801197:	eb d5                	jmp    80116e <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801199:	83 ec 0c             	sub    $0xc,%esp
+  80119c:	50                   	push   %eax
+  80119d:	6a 05                	push   $0x5
+  80119f:	68 6b 3d 80 00       	push   $0x803d6b
+  8011a4:	6a 3f                	push   $0x3f
+  8011a6:	68 88 3d 80 00       	push   $0x803d88
+  8011ab:	e8 0a f3 ff ff       	call   8004ba <_panic>
+
+008011b0 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	57                   	push   %edi
+  8011b4:	56                   	push   %esi
+  8011b5:	53                   	push   %ebx
+  8011b6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011b9:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8011c0:	74 22                	je     8011e4 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  8011c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d2:	89 df                	mov    %ebx,%edi
+  8011d4:	89 de                	mov    %ebx,%esi
+  8011d6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d8:	85 c0                	test   %eax,%eax
+  8011da:	7f 28                	jg     801204 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8011dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011df:	5b                   	pop    %ebx
+  8011e0:	5e                   	pop    %esi
+  8011e1:	5f                   	pop    %edi
+  8011e2:	5d                   	pop    %ebp
+  8011e3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ef:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011f4:	89 df                	mov    %ebx,%edi
+  8011f6:	55                   	push   %ebp
+  8011f7:	89 e5                	mov    %esp,%ebp
+  8011f9:	8d 35 01 12 80 00    	lea    0x801201,%esi
+  8011ff:	0f 34                	sysenter
+  801201:	5d                   	pop    %ebp
+		goto out;
+  801202:	eb d4                	jmp    8011d8 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	50                   	push   %eax
+  801208:	6a 06                	push   $0x6
+  80120a:	68 6b 3d 80 00       	push   $0x803d6b
+  80120f:	6a 3f                	push   $0x3f
+  801211:	68 88 3d 80 00       	push   $0x803d88
+  801216:	e8 9f f2 ff ff       	call   8004ba <_panic>
+
+0080121b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	57                   	push   %edi
+  80121f:	56                   	push   %esi
+  801220:	53                   	push   %ebx
+  801221:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801224:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80122b:	74 22                	je     80124f <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  80122d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801232:	b8 08 00 00 00       	mov    $0x8,%eax
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123d:	89 df                	mov    %ebx,%edi
+  80123f:	89 de                	mov    %ebx,%esi
+  801241:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801243:	85 c0                	test   %eax,%eax
+  801245:	7f 28                	jg     80126f <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124a:	5b                   	pop    %ebx
+  80124b:	5e                   	pop    %esi
+  80124c:	5f                   	pop    %edi
+  80124d:	5d                   	pop    %ebp
+  80124e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80124f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801254:	8b 55 08             	mov    0x8(%ebp),%edx
+  801257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80125f:	89 df                	mov    %ebx,%edi
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+  801264:	8d 35 6c 12 80 00    	lea    0x80126c,%esi
+  80126a:	0f 34                	sysenter
+  80126c:	5d                   	pop    %ebp
+		goto out;
+  80126d:	eb d4                	jmp    801243 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126f:	83 ec 0c             	sub    $0xc,%esp
+  801272:	50                   	push   %eax
+  801273:	6a 08                	push   $0x8
+  801275:	68 6b 3d 80 00       	push   $0x803d6b
+  80127a:	6a 3f                	push   $0x3f
+  80127c:	68 88 3d 80 00       	push   $0x803d88
+  801281:	e8 34 f2 ff ff       	call   8004ba <_panic>
+
+00801286 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801286:	55                   	push   %ebp
+  801287:	89 e5                	mov    %esp,%ebp
+  801289:	57                   	push   %edi
+  80128a:	56                   	push   %esi
+  80128b:	53                   	push   %ebx
+  80128c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80128f:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801296:	74 22                	je     8012ba <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801298:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129d:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a8:	89 df                	mov    %ebx,%edi
+  8012aa:	89 de                	mov    %ebx,%esi
+  8012ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ae:	85 c0                	test   %eax,%eax
+  8012b0:	7f 28                	jg     8012da <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8012b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b5:	5b                   	pop    %ebx
+  8012b6:	5e                   	pop    %esi
+  8012b7:	5f                   	pop    %edi
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012ca:	89 df                	mov    %ebx,%edi
+  8012cc:	55                   	push   %ebp
+  8012cd:	89 e5                	mov    %esp,%ebp
+  8012cf:	8d 35 d7 12 80 00    	lea    0x8012d7,%esi
+  8012d5:	0f 34                	sysenter
+  8012d7:	5d                   	pop    %ebp
+		goto out;
+  8012d8:	eb d4                	jmp    8012ae <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012da:	83 ec 0c             	sub    $0xc,%esp
+  8012dd:	50                   	push   %eax
+  8012de:	6a 09                	push   $0x9
+  8012e0:	68 6b 3d 80 00       	push   $0x803d6b
+  8012e5:	6a 3f                	push   $0x3f
+  8012e7:	68 88 3d 80 00       	push   $0x803d88
+  8012ec:	e8 c9 f1 ff ff       	call   8004ba <_panic>
+
+008012f1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8012f1:	55                   	push   %ebp
+  8012f2:	89 e5                	mov    %esp,%ebp
+  8012f4:	57                   	push   %edi
+  8012f5:	56                   	push   %esi
+  8012f6:	53                   	push   %ebx
+  8012f7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012fa:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801301:	74 22                	je     801325 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801303:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801308:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80130d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801313:	89 df                	mov    %ebx,%edi
+  801315:	89 de                	mov    %ebx,%esi
+  801317:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801319:	85 c0                	test   %eax,%eax
+  80131b:	7f 28                	jg     801345 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80131d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801320:	5b                   	pop    %ebx
+  801321:	5e                   	pop    %esi
+  801322:	5f                   	pop    %edi
+  801323:	5d                   	pop    %ebp
+  801324:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801325:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801330:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801335:	89 df                	mov    %ebx,%edi
+  801337:	55                   	push   %ebp
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	8d 35 42 13 80 00    	lea    0x801342,%esi
+  801340:	0f 34                	sysenter
+  801342:	5d                   	pop    %ebp
+		goto out;
+  801343:	eb d4                	jmp    801319 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801345:	83 ec 0c             	sub    $0xc,%esp
+  801348:	50                   	push   %eax
+  801349:	6a 0a                	push   $0xa
+  80134b:	68 6b 3d 80 00       	push   $0x803d6b
+  801350:	6a 3f                	push   $0x3f
+  801352:	68 88 3d 80 00       	push   $0x803d88
+  801357:	e8 5e f1 ff ff       	call   8004ba <_panic>
+
+0080135c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80135c:	55                   	push   %ebp
+  80135d:	89 e5                	mov    %esp,%ebp
+  80135f:	57                   	push   %edi
+  801360:	56                   	push   %esi
+  801361:	53                   	push   %ebx
+  801362:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801365:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80136c:	74 22                	je     801390 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80136e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801373:	b8 17 00 00 00       	mov    $0x17,%eax
+  801378:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137e:	89 df                	mov    %ebx,%edi
+  801380:	89 de                	mov    %ebx,%esi
+  801382:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801384:	85 c0                	test   %eax,%eax
+  801386:	7f 28                	jg     8013b0 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138b:	5b                   	pop    %ebx
+  80138c:	5e                   	pop    %esi
+  80138d:	5f                   	pop    %edi
+  80138e:	5d                   	pop    %ebp
+  80138f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801395:	8b 55 08             	mov    0x8(%ebp),%edx
+  801398:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139b:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013a0:	89 df                	mov    %ebx,%edi
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	8d 35 ad 13 80 00    	lea    0x8013ad,%esi
+  8013ab:	0f 34                	sysenter
+  8013ad:	5d                   	pop    %ebp
+		goto out;
+  8013ae:	eb d4                	jmp    801384 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	50                   	push   %eax
+  8013b4:	6a 17                	push   $0x17
+  8013b6:	68 6b 3d 80 00       	push   $0x803d6b
+  8013bb:	6a 3f                	push   $0x3f
+  8013bd:	68 88 3d 80 00       	push   $0x803d88
+  8013c2:	e8 f3 f0 ff ff       	call   8004ba <_panic>
+
+008013c7 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	57                   	push   %edi
+  8013cb:	56                   	push   %esi
+  8013cc:	53                   	push   %ebx
+  8013cd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013d0:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8013d7:	74 22                	je     8013fb <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8013d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013de:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e9:	89 df                	mov    %ebx,%edi
+  8013eb:	89 de                	mov    %ebx,%esi
+  8013ed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013ef:	85 c0                	test   %eax,%eax
+  8013f1:	7f 28                	jg     80141b <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8013f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f6:	5b                   	pop    %ebx
+  8013f7:	5e                   	pop    %esi
+  8013f8:	5f                   	pop    %edi
+  8013f9:	5d                   	pop    %ebp
+  8013fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801400:	8b 55 08             	mov    0x8(%ebp),%edx
+  801403:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801406:	b8 18 00 00 00       	mov    $0x18,%eax
+  80140b:	89 df                	mov    %ebx,%edi
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	8d 35 18 14 80 00    	lea    0x801418,%esi
+  801416:	0f 34                	sysenter
+  801418:	5d                   	pop    %ebp
+		goto out;
+  801419:	eb d4                	jmp    8013ef <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80141b:	83 ec 0c             	sub    $0xc,%esp
+  80141e:	50                   	push   %eax
+  80141f:	6a 18                	push   $0x18
+  801421:	68 6b 3d 80 00       	push   $0x803d6b
+  801426:	6a 3f                	push   $0x3f
+  801428:	68 88 3d 80 00       	push   $0x803d88
+  80142d:	e8 88 f0 ff ff       	call   8004ba <_panic>
+
+00801432 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801432:	55                   	push   %ebp
+  801433:	89 e5                	mov    %esp,%ebp
+  801435:	57                   	push   %edi
+  801436:	56                   	push   %esi
+  801437:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801438:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80143f:	74 1d                	je     80145e <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801441:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801446:	be 00 00 00 00       	mov    $0x0,%esi
+  80144b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801451:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801454:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801457:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801459:	5b                   	pop    %ebx
+  80145a:	5e                   	pop    %esi
+  80145b:	5f                   	pop    %edi
+  80145c:	5d                   	pop    %ebp
+  80145d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80145e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801461:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801464:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801469:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80146c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80146f:	55                   	push   %ebp
+  801470:	89 e5                	mov    %esp,%ebp
+  801472:	8d 35 7a 14 80 00    	lea    0x80147a,%esi
+  801478:	0f 34                	sysenter
+  80147a:	5d                   	pop    %ebp
+		goto out;
+  80147b:	eb dc                	jmp    801459 <sys_ipc_try_send+0x27>
+
+0080147d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	57                   	push   %edi
+  801481:	56                   	push   %esi
+  801482:	53                   	push   %ebx
+  801483:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801486:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80148d:	74 21                	je     8014b0 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80148f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801494:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801499:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149c:	89 cb                	mov    %ecx,%ebx
+  80149e:	89 cf                	mov    %ecx,%edi
+  8014a0:	89 ce                	mov    %ecx,%esi
+  8014a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014a4:	85 c0                	test   %eax,%eax
+  8014a6:	7f 27                	jg     8014cf <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8014a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ab:	5b                   	pop    %ebx
+  8014ac:	5e                   	pop    %esi
+  8014ad:	5f                   	pop    %edi
+  8014ae:	5d                   	pop    %ebp
+  8014af:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014b8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014bd:	89 cb                	mov    %ecx,%ebx
+  8014bf:	89 cf                	mov    %ecx,%edi
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	8d 35 cc 14 80 00    	lea    0x8014cc,%esi
+  8014ca:	0f 34                	sysenter
+  8014cc:	5d                   	pop    %ebp
+		goto out;
+  8014cd:	eb d5                	jmp    8014a4 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	50                   	push   %eax
+  8014d3:	6a 0d                	push   $0xd
+  8014d5:	68 6b 3d 80 00       	push   $0x803d6b
+  8014da:	6a 3f                	push   $0x3f
+  8014dc:	68 88 3d 80 00       	push   $0x803d88
+  8014e1:	e8 d4 ef ff ff       	call   8004ba <_panic>
+
+008014e6 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8014e6:	55                   	push   %ebp
+  8014e7:	89 e5                	mov    %esp,%ebp
+  8014e9:	57                   	push   %edi
+  8014ea:	56                   	push   %esi
+  8014eb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ec:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8014f3:	74 1b                	je     801510 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8014f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801502:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801505:	89 df                	mov    %ebx,%edi
+  801507:	89 de                	mov    %ebx,%esi
+  801509:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80150b:	5b                   	pop    %ebx
+  80150c:	5e                   	pop    %esi
+  80150d:	5f                   	pop    %edi
+  80150e:	5d                   	pop    %ebp
+  80150f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801510:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801515:	8b 55 08             	mov    0x8(%ebp),%edx
+  801518:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80151b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801520:	89 df                	mov    %ebx,%edi
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	8d 35 2d 15 80 00    	lea    0x80152d,%esi
+  80152b:	0f 34                	sysenter
+  80152d:	5d                   	pop    %ebp
+		goto out;
+  80152e:	eb db                	jmp    80150b <sys_ipc_recv_until+0x25>
+
+00801530 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801530:	55                   	push   %ebp
+  801531:	89 e5                	mov    %esp,%ebp
+  801533:	57                   	push   %edi
+  801534:	56                   	push   %esi
+  801535:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801536:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80153d:	74 19                	je     801558 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80153f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801544:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801549:	89 d1                	mov    %edx,%ecx
+  80154b:	89 d3                	mov    %edx,%ebx
+  80154d:	89 d7                	mov    %edx,%edi
+  80154f:	89 d6                	mov    %edx,%esi
+  801551:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801553:	5b                   	pop    %ebx
+  801554:	5e                   	pop    %esi
+  801555:	5f                   	pop    %edi
+  801556:	5d                   	pop    %ebp
+  801557:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801558:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801562:	89 d1                	mov    %edx,%ecx
+  801564:	89 d3                	mov    %edx,%ebx
+  801566:	89 d7                	mov    %edx,%edi
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	8d 35 73 15 80 00    	lea    0x801573,%esi
+  801571:	0f 34                	sysenter
+  801573:	5d                   	pop    %ebp
+		goto out;
+  801574:	eb dd                	jmp    801553 <sys_time_msec+0x23>
+
+00801576 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	57                   	push   %edi
+  80157a:	56                   	push   %esi
+  80157b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80157c:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801583:	74 1a                	je     80159f <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801585:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80158f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801592:	89 cb                	mov    %ecx,%ebx
+  801594:	89 cf                	mov    %ecx,%edi
+  801596:	89 ce                	mov    %ecx,%esi
+  801598:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80159a:	5b                   	pop    %ebx
+  80159b:	5e                   	pop    %esi
+  80159c:	5f                   	pop    %edi
+  80159d:	5d                   	pop    %ebp
+  80159e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80159f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015a7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8015ac:	89 cb                	mov    %ecx,%ebx
+  8015ae:	89 cf                	mov    %ecx,%edi
+  8015b0:	55                   	push   %ebp
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	8d 35 bb 15 80 00    	lea    0x8015bb,%esi
+  8015b9:	0f 34                	sysenter
+  8015bb:	5d                   	pop    %ebp
+		goto out;
+  8015bc:	eb dc                	jmp    80159a <sys_sleep_until+0x24>
+
+008015be <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8015be:	55                   	push   %ebp
+  8015bf:	89 e5                	mov    %esp,%ebp
+  8015c1:	57                   	push   %edi
+  8015c2:	56                   	push   %esi
+  8015c3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015c4:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8015cb:	74 1a                	je     8015e7 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8015cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015d2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8015d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015da:	89 cb                	mov    %ecx,%ebx
+  8015dc:	89 cf                	mov    %ecx,%edi
+  8015de:	89 ce                	mov    %ecx,%esi
+  8015e0:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8015e2:	5b                   	pop    %ebx
+  8015e3:	5e                   	pop    %esi
+  8015e4:	5f                   	pop    %edi
+  8015e5:	5d                   	pop    %ebp
+  8015e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ef:	b8 11 00 00 00       	mov    $0x11,%eax
+  8015f4:	89 cb                	mov    %ecx,%ebx
+  8015f6:	89 cf                	mov    %ecx,%edi
+  8015f8:	55                   	push   %ebp
+  8015f9:	89 e5                	mov    %esp,%ebp
+  8015fb:	8d 35 03 16 80 00    	lea    0x801603,%esi
+  801601:	0f 34                	sysenter
+  801603:	5d                   	pop    %ebp
+		goto out;
+  801604:	eb dc                	jmp    8015e2 <sys_env_print_stats+0x24>
+
+00801606 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	57                   	push   %edi
+  80160a:	56                   	push   %esi
+  80160b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80160c:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801613:	74 1b                	je     801630 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801615:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80161f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801622:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801625:	89 df                	mov    %ebx,%edi
+  801627:	89 de                	mov    %ebx,%esi
+  801629:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80162b:	5b                   	pop    %ebx
+  80162c:	5e                   	pop    %esi
+  80162d:	5f                   	pop    %edi
+  80162e:	5d                   	pop    %ebp
+  80162f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801630:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801635:	8b 55 08             	mov    0x8(%ebp),%edx
+  801638:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801640:	89 df                	mov    %ebx,%edi
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	8d 35 4d 16 80 00    	lea    0x80164d,%esi
+  80164b:	0f 34                	sysenter
+  80164d:	5d                   	pop    %ebp
+		goto out;
+  80164e:	eb db                	jmp    80162b <sys_perf+0x25>
+
+00801650 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801650:	55                   	push   %ebp
+  801651:	89 e5                	mov    %esp,%ebp
+  801653:	57                   	push   %edi
+  801654:	56                   	push   %esi
+  801655:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801656:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80165d:	74 19                	je     801678 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80165f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801664:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801669:	89 d1                	mov    %edx,%ecx
+  80166b:	89 d3                	mov    %edx,%ebx
+  80166d:	89 d7                	mov    %edx,%edi
+  80166f:	89 d6                	mov    %edx,%esi
+  801671:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801673:	5b                   	pop    %ebx
+  801674:	5e                   	pop    %esi
+  801675:	5f                   	pop    %edi
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801678:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801682:	89 d1                	mov    %edx,%ecx
+  801684:	89 d3                	mov    %edx,%ebx
+  801686:	89 d7                	mov    %edx,%edi
+  801688:	55                   	push   %ebp
+  801689:	89 e5                	mov    %esp,%ebp
+  80168b:	8d 35 93 16 80 00    	lea    0x801693,%esi
+  801691:	0f 34                	sysenter
+  801693:	5d                   	pop    %ebp
+		goto out;
+  801694:	eb dd                	jmp    801673 <sys_fork+0x23>
+
+00801696 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	57                   	push   %edi
+  80169a:	56                   	push   %esi
+  80169b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80169c:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8016a3:	74 1c                	je     8016c1 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8016a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016aa:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8016af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016b8:	89 f7                	mov    %esi,%edi
+  8016ba:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8016bc:	5b                   	pop    %ebx
+  8016bd:	5e                   	pop    %esi
+  8016be:	5f                   	pop    %edi
+  8016bf:	5d                   	pop    %ebp
+  8016c0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8016cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016d4:	55                   	push   %ebp
+  8016d5:	89 e5                	mov    %esp,%ebp
+  8016d7:	8d 35 df 16 80 00    	lea    0x8016df,%esi
+  8016dd:	0f 34                	sysenter
+  8016df:	5d                   	pop    %ebp
+		goto out;
+  8016e0:	eb da                	jmp    8016bc <sys_thread_create+0x26>
+
+008016e2 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	57                   	push   %edi
+  8016e6:	56                   	push   %esi
+  8016e7:	53                   	push   %ebx
+  8016e8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016eb:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8016f2:	74 24                	je     801718 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8016f4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8016f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801701:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801704:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801707:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80170a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	7f 27                	jg     801737 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801713:	5b                   	pop    %ebx
+  801714:	5e                   	pop    %esi
+  801715:	5f                   	pop    %edi
+  801716:	5d                   	pop    %ebp
+  801717:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801718:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801723:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801726:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801729:	55                   	push   %ebp
+  80172a:	89 e5                	mov    %esp,%ebp
+  80172c:	8d 35 34 17 80 00    	lea    0x801734,%esi
+  801732:	0f 34                	sysenter
+  801734:	5d                   	pop    %ebp
+		goto out;
+  801735:	eb d5                	jmp    80170c <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801737:	83 ec 0c             	sub    $0xc,%esp
+  80173a:	50                   	push   %eax
+  80173b:	6a 1f                	push   $0x1f
+  80173d:	68 6b 3d 80 00       	push   $0x803d6b
+  801742:	6a 3f                	push   $0x3f
+  801744:	68 88 3d 80 00       	push   $0x803d88
+  801749:	e8 6c ed ff ff       	call   8004ba <_panic>
+
+0080174e <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	57                   	push   %edi
+  801752:	56                   	push   %esi
+  801753:	53                   	push   %ebx
+  801754:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801757:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80175e:	74 23                	je     801783 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801760:	be 00 00 00 00       	mov    $0x0,%esi
+  801765:	b8 20 00 00 00       	mov    $0x20,%eax
+  80176a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801770:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801773:	89 f7                	mov    %esi,%edi
+  801775:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801777:	85 c0                	test   %eax,%eax
+  801779:	7f 29                	jg     8017a4 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80177b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177e:	5b                   	pop    %ebx
+  80177f:	5e                   	pop    %esi
+  801780:	5f                   	pop    %edi
+  801781:	5d                   	pop    %ebp
+  801782:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801783:	8b 55 08             	mov    0x8(%ebp),%edx
+  801786:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801789:	b8 20 00 00 00       	mov    $0x20,%eax
+  80178e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801793:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801796:	55                   	push   %ebp
+  801797:	89 e5                	mov    %esp,%ebp
+  801799:	8d 35 a1 17 80 00    	lea    0x8017a1,%esi
+  80179f:	0f 34                	sysenter
+  8017a1:	5d                   	pop    %ebp
+		goto out;
+  8017a2:	eb d3                	jmp    801777 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017a4:	83 ec 0c             	sub    $0xc,%esp
+  8017a7:	50                   	push   %eax
+  8017a8:	6a 20                	push   $0x20
+  8017aa:	68 6b 3d 80 00       	push   $0x803d6b
+  8017af:	6a 3f                	push   $0x3f
+  8017b1:	68 88 3d 80 00       	push   $0x803d88
+  8017b6:	e8 ff ec ff ff       	call   8004ba <_panic>
+
+008017bb <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8017bb:	55                   	push   %ebp
+  8017bc:	89 e5                	mov    %esp,%ebp
+  8017be:	57                   	push   %edi
+  8017bf:	56                   	push   %esi
+  8017c0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017c1:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8017c8:	74 1b                	je     8017e5 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8017ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cf:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8017d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017da:	89 df                	mov    %ebx,%edi
+  8017dc:	89 de                	mov    %ebx,%esi
+  8017de:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8017e0:	5b                   	pop    %ebx
+  8017e1:	5e                   	pop    %esi
+  8017e2:	5f                   	pop    %edi
+  8017e3:	5d                   	pop    %ebp
+  8017e4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8017f5:	89 df                	mov    %ebx,%edi
+  8017f7:	55                   	push   %ebp
+  8017f8:	89 e5                	mov    %esp,%ebp
+  8017fa:	8d 35 02 18 80 00    	lea    0x801802,%esi
+  801800:	0f 34                	sysenter
+  801802:	5d                   	pop    %ebp
+		goto out;
+  801803:	eb db                	jmp    8017e0 <sys_batch+0x25>
+
+00801805 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	57                   	push   %edi
+  801809:	56                   	push   %esi
+  80180a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80180b:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801812:	74 1a                	je     80182e <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801814:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801819:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80181e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801821:	89 cb                	mov    %ecx,%ebx
+  801823:	89 cf                	mov    %ecx,%edi
+  801825:	89 ce                	mov    %ecx,%esi
+  801827:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801829:	5b                   	pop    %ebx
+  80182a:	5e                   	pop    %esi
+  80182b:	5f                   	pop    %edi
+  80182c:	5d                   	pop    %ebp
+  80182d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80182e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801831:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801836:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80183b:	89 cb                	mov    %ecx,%ebx
+  80183d:	89 cf                	mov    %ecx,%edi
+  80183f:	55                   	push   %ebp
+  801840:	89 e5                	mov    %esp,%ebp
+  801842:	8d 35 4a 18 80 00    	lea    0x80184a,%esi
+  801848:	0f 34                	sysenter
+  80184a:	5d                   	pop    %ebp
+		goto out;
+  80184b:	eb dc                	jmp    801829 <sys_trace_ctl+0x24>
+
+0080184d <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80184d:	55                   	push   %ebp
+  80184e:	89 e5                	mov    %esp,%ebp
+  801850:	57                   	push   %edi
+  801851:	56                   	push   %esi
+  801852:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801853:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  80185a:	74 1c                	je     801878 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80185c:	be 00 00 00 00       	mov    $0x0,%esi
+  801861:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801866:	8b 55 08             	mov    0x8(%ebp),%edx
+  801869:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80186c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80186f:	89 f7                	mov    %esi,%edi
+  801871:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801873:	5b                   	pop    %ebx
+  801874:	5e                   	pop    %esi
+  801875:	5f                   	pop    %edi
+  801876:	5d                   	pop    %ebp
+  801877:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801878:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801883:	bf 00 00 00 00       	mov    $0x0,%edi
+  801888:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80188b:	55                   	push   %ebp
+  80188c:	89 e5                	mov    %esp,%ebp
+  80188e:	8d 35 96 18 80 00    	lea    0x801896,%esi
+  801894:	0f 34                	sysenter
+  801896:	5d                   	pop    %ebp
+		goto out;
+  801897:	eb da                	jmp    801873 <sys_trace_read+0x26>
+
+00801899 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801899:	55                   	push   %ebp
+  80189a:	89 e5                	mov    %esp,%ebp
+  80189c:	57                   	push   %edi
+  80189d:	56                   	push   %esi
+  80189e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80189f:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8018a6:	74 1c                	je     8018c4 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8018a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018ad:	b8 21 00 00 00       	mov    $0x21,%eax
+  8018b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018bb:	89 f7                	mov    %esi,%edi
+  8018bd:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8018bf:	5b                   	pop    %ebx
+  8018c0:	5e                   	pop    %esi
+  8018c1:	5f                   	pop    %edi
+  8018c2:	5d                   	pop    %ebp
+  8018c3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ca:	b8 21 00 00 00       	mov    $0x21,%eax
+  8018cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018d7:	55                   	push   %ebp
+  8018d8:	89 e5                	mov    %esp,%ebp
+  8018da:	8d 35 e2 18 80 00    	lea    0x8018e2,%esi
+  8018e0:	0f 34                	sysenter
+  8018e2:	5d                   	pop    %ebp
+		goto out;
+  8018e3:	eb da                	jmp    8018bf <sys_meminfo+0x26>
+
+008018e5 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8018e5:	55                   	push   %ebp
+  8018e6:	89 e5                	mov    %esp,%ebp
+  8018e8:	57                   	push   %edi
+  8018e9:	56                   	push   %esi
+  8018ea:	53                   	push   %ebx
+  8018eb:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8018ee:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8018f2:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8018f9:	74 1f                	je     80191a <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8018fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801900:	b8 22 00 00 00       	mov    $0x22,%eax
+  801905:	8b 55 08             	mov    0x8(%ebp),%edx
+  801908:	89 df                	mov    %ebx,%edi
+  80190a:	89 de                	mov    %ebx,%esi
+  80190c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80190e:	85 c0                	test   %eax,%eax
+  801910:	7f 25                	jg     801937 <sys_env_set_ksm+0x52>
+}
+  801912:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801915:	5b                   	pop    %ebx
+  801916:	5e                   	pop    %esi
+  801917:	5f                   	pop    %edi
+  801918:	5d                   	pop    %ebp
+  801919:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80191a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801922:	b8 22 00 00 00       	mov    $0x22,%eax
+  801927:	89 df                	mov    %ebx,%edi
+  801929:	55                   	push   %ebp
+  80192a:	89 e5                	mov    %esp,%ebp
+  80192c:	8d 35 34 19 80 00    	lea    0x801934,%esi
+  801932:	0f 34                	sysenter
+  801934:	5d                   	pop    %ebp
+		goto out;
+  801935:	eb d7                	jmp    80190e <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801937:	83 ec 0c             	sub    $0xc,%esp
+  80193a:	50                   	push   %eax
+  80193b:	6a 22                	push   $0x22
+  80193d:	68 6b 3d 80 00       	push   $0x803d6b
+  801942:	6a 3f                	push   $0x3f
+  801944:	68 88 3d 80 00       	push   $0x803d88
+  801949:	e8 6c eb ff ff       	call   8004ba <_panic>
+
+0080194e <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80194e:	55                   	push   %ebp
+  80194f:	89 e5                	mov    %esp,%ebp
+  801951:	57                   	push   %edi
+  801952:	56                   	push   %esi
+  801953:	53                   	push   %ebx
+  801954:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801957:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80195a:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801961:	74 24                	je     801987 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801963:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801968:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80196d:	89 cb                	mov    %ecx,%ebx
+  80196f:	89 cf                	mov    %ecx,%edi
+  801971:	89 ce                	mov    %ecx,%esi
+  801973:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801975:	85 c0                	test   %eax,%eax
+  801977:	7f 2a                	jg     8019a3 <sys_time_nsec+0x55>
+	return ns;
+}
+  801979:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80197c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80197f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801982:	5b                   	pop    %ebx
+  801983:	5e                   	pop    %esi
+  801984:	5f                   	pop    %edi
+  801985:	5d                   	pop    %ebp
+  801986:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801987:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80198c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801991:	89 cb                	mov    %ecx,%ebx
+  801993:	89 cf                	mov    %ecx,%edi
+  801995:	55                   	push   %ebp
+  801996:	89 e5                	mov    %esp,%ebp
+  801998:	8d 35 a0 19 80 00    	lea    0x8019a0,%esi
+  80199e:	0f 34                	sysenter
+  8019a0:	5d                   	pop    %ebp
+		goto out;
+  8019a1:	eb d2                	jmp    801975 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019a3:	83 ec 0c             	sub    $0xc,%esp
+  8019a6:	50                   	push   %eax
+  8019a7:	6a 0f                	push   $0xf
+  8019a9:	68 6b 3d 80 00       	push   $0x803d6b
+  8019ae:	6a 3f                	push   $0x3f
+  8019b0:	68 88 3d 80 00       	push   $0x803d88
+  8019b5:	e8 00 eb ff ff       	call   8004ba <_panic>
+
+008019ba <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8019ba:	55                   	push   %ebp
+  8019bb:	89 e5                	mov    %esp,%ebp
+  8019bd:	57                   	push   %edi
+  8019be:	56                   	push   %esi
+  8019bf:	53                   	push   %ebx
+  8019c0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8019c3:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  8019ca:	74 22                	je     8019ee <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8019cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8019d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019dc:	89 df                	mov    %ebx,%edi
+  8019de:	89 de                	mov    %ebx,%esi
+  8019e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019e2:	85 c0                	test   %eax,%eax
+  8019e4:	7f 28                	jg     801a0e <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8019e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019e9:	5b                   	pop    %ebx
+  8019ea:	5e                   	pop    %esi
+  8019eb:	5f                   	pop    %edi
+  8019ec:	5d                   	pop    %ebp
+  8019ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019f9:	b8 12 00 00 00       	mov    $0x12,%eax
+  8019fe:	89 df                	mov    %ebx,%edi
+  801a00:	55                   	push   %ebp
+  801a01:	89 e5                	mov    %esp,%ebp
+  801a03:	8d 35 0b 1a 80 00    	lea    0x801a0b,%esi
+  801a09:	0f 34                	sysenter
+  801a0b:	5d                   	pop    %ebp
+		goto out;
+  801a0c:	eb d4                	jmp    8019e2 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a0e:	83 ec 0c             	sub    $0xc,%esp
+  801a11:	50                   	push   %eax
+  801a12:	6a 12                	push   $0x12
+  801a14:	68 6b 3d 80 00       	push   $0x803d6b
+  801a19:	6a 3f                	push   $0x3f
+  801a1b:	68 88 3d 80 00       	push   $0x803d88
+  801a20:	e8 95 ea ff ff       	call   8004ba <_panic>
+
+00801a25 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801a25:	55                   	push   %ebp
+  801a26:	89 e5                	mov    %esp,%ebp
+  801a28:	57                   	push   %edi
+  801a29:	56                   	push   %esi
+  801a2a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a2b:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801a32:	74 1b                	je     801a4f <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801a34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a39:	b8 13 00 00 00       	mov    $0x13,%eax
+  801a3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a44:	89 df                	mov    %ebx,%edi
+  801a46:	89 de                	mov    %ebx,%esi
+  801a48:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801a4a:	5b                   	pop    %ebx
+  801a4b:	5e                   	pop    %esi
+  801a4c:	5f                   	pop    %edi
+  801a4d:	5d                   	pop    %ebp
+  801a4e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a54:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a5a:	b8 13 00 00 00       	mov    $0x13,%eax
+  801a5f:	89 df                	mov    %ebx,%edi
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	8d 35 6c 1a 80 00    	lea    0x801a6c,%esi
+  801a6a:	0f 34                	sysenter
+  801a6c:	5d                   	pop    %ebp
+		goto out;
+  801a6d:	eb db                	jmp    801a4a <sys_e1000_receive+0x25>
+
+00801a6f <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801a6f:	55                   	push   %ebp
+  801a70:	89 e5                	mov    %esp,%ebp
+  801a72:	57                   	push   %edi
+  801a73:	56                   	push   %esi
+  801a74:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801a75:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801a7c:	74 1b                	je     801a99 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801a7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a83:	b8 14 00 00 00       	mov    $0x14,%eax
+  801a88:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a8e:	89 df                	mov    %ebx,%edi
+  801a90:	89 de                	mov    %ebx,%esi
+  801a92:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801a94:	5b                   	pop    %ebx
+  801a95:	5e                   	pop    %esi
+  801a96:	5f                   	pop    %edi
+  801a97:	5d                   	pop    %ebp
+  801a98:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa4:	b8 14 00 00 00       	mov    $0x14,%eax
+  801aa9:	89 df                	mov    %ebx,%edi
+  801aab:	55                   	push   %ebp
+  801aac:	89 e5                	mov    %esp,%ebp
+  801aae:	8d 35 b6 1a 80 00    	lea    0x801ab6,%esi
+  801ab4:	0f 34                	sysenter
+  801ab6:	5d                   	pop    %ebp
+		goto out;
+  801ab7:	eb db                	jmp    801a94 <sys_e1000_read_hwaddr+0x25>
+
+00801ab9 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	57                   	push   %edi
+  801abd:	56                   	push   %esi
+  801abe:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801abf:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801ac6:	74 1a                	je     801ae2 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801ac8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801acd:	b8 15 00 00 00       	mov    $0x15,%eax
+  801ad2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad5:	89 cb                	mov    %ecx,%ebx
+  801ad7:	89 cf                	mov    %ecx,%edi
+  801ad9:	89 ce                	mov    %ecx,%esi
+  801adb:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801add:	5b                   	pop    %ebx
+  801ade:	5e                   	pop    %esi
+  801adf:	5f                   	pop    %edi
+  801ae0:	5d                   	pop    %ebp
+  801ae1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ae2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801aea:	b8 15 00 00 00       	mov    $0x15,%eax
+  801aef:	89 cb                	mov    %ecx,%ebx
+  801af1:	89 cf                	mov    %ecx,%edi
+  801af3:	55                   	push   %ebp
+  801af4:	89 e5                	mov    %esp,%ebp
+  801af6:	8d 35 fe 1a 80 00    	lea    0x801afe,%esi
+  801afc:	0f 34                	sysenter
+  801afe:	5d                   	pop    %ebp
+		goto out;
+  801aff:	eb dc                	jmp    801add <sys_sb16_read_version+0x24>
+
+00801b01 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801b01:	55                   	push   %ebp
+  801b02:	89 e5                	mov    %esp,%ebp
+  801b04:	57                   	push   %edi
+  801b05:	56                   	push   %esi
+  801b06:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b07:	80 3d 0c 60 80 01 00 	cmpb   $0x0,0x180600c
+  801b0e:	74 1b                	je     801b2b <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801b10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b15:	b8 16 00 00 00       	mov    $0x16,%eax
+  801b1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b20:	89 df                	mov    %ebx,%edi
+  801b22:	89 de                	mov    %ebx,%esi
+  801b24:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801b26:	5b                   	pop    %ebx
+  801b27:	5e                   	pop    %esi
+  801b28:	5f                   	pop    %edi
+  801b29:	5d                   	pop    %ebp
+  801b2a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b30:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b36:	b8 16 00 00 00       	mov    $0x16,%eax
+  801b3b:	89 df                	mov    %ebx,%edi
+  801b3d:	55                   	push   %ebp
+  801b3e:	89 e5                	mov    %esp,%ebp
+  801b40:	8d 35 48 1b 80 00    	lea    0x801b48,%esi
+  801b46:	0f 34                	sysenter
+  801b48:	5d                   	pop    %ebp
+		goto out;
+  801b49:	eb db                	jmp    801b26 <sys_sb16_play+0x25>
+
+00801b4b <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801b4b:	55                   	push   %ebp
+  801b4c:	89 e5                	mov    %esp,%ebp
+  801b4e:	53                   	push   %ebx
+  801b4f:	83 ec 04             	sub    $0x4,%esp
+  801b52:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801b54:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b5b:	f6 c4 04             	test   $0x4,%ah
+  801b5e:	74 0c                	je     801b6c <dupperm+0x21>
+  801b60:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801b67:	f6 c4 08             	test   $0x8,%ah
+  801b6a:	75 62                	jne    801bce <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801b6c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801b73:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801b78:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801b7e:	74 19                	je     801b99 <dupperm+0x4e>
+  801b80:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801b87:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801b8c:	83 f8 01             	cmp    $0x1,%eax
+  801b8f:	19 c0                	sbb    %eax,%eax
+  801b91:	25 00 08 00 00       	and    $0x800,%eax
+  801b96:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801b99:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  801ba0:	89 c1                	mov    %eax,%ecx
+  801ba2:	80 cd 04             	or     $0x4,%ch
+  801ba5:	f6 c7 04             	test   $0x4,%bh
+  801ba8:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801bab:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801bb2:	f6 c1 02             	test   $0x2,%cl
+  801bb5:	74 12                	je     801bc9 <dupperm+0x7e>
+  801bb7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801bbe:	89 c2                	mov    %eax,%edx
+  801bc0:	83 ca 02             	or     $0x2,%edx
+  801bc3:	f6 c5 04             	test   $0x4,%ch
+  801bc6:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801bc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bcc:	c9                   	leave
+  801bcd:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801bce:	68 98 3d 80 00       	push   $0x803d98
+  801bd3:	68 0b 39 80 00       	push   $0x80390b
+  801bd8:	6a 39                	push   $0x39
+  801bda:	68 30 3e 80 00       	push   $0x803e30
+  801bdf:	e8 d6 e8 ff ff       	call   8004ba <_panic>
+
+00801be4 <pgfault>:
+{
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+  801be7:	53                   	push   %ebx
+  801be8:	83 ec 04             	sub    $0x4,%esp
+  801beb:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801bee:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801bf0:	89 c3                	mov    %eax,%ebx
+  801bf2:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801bf8:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801bfc:	74 6d                	je     801c6b <pgfault+0x87>
+  801bfe:	89 da                	mov    %ebx,%edx
+  801c00:	c1 ea 16             	shr    $0x16,%edx
+  801c03:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c0a:	f6 c2 80             	test   $0x80,%dl
+  801c0d:	75 5c                	jne    801c6b <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801c0f:	c1 e8 0c             	shr    $0xc,%eax
+  801c12:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801c19:	f6 c4 08             	test   $0x8,%ah
+  801c1c:	74 4d                	je     801c6b <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801c1e:	83 ec 04             	sub    $0x4,%esp
+  801c21:	6a 07                	push   $0x7
+  801c23:	68 00 f0 7f 00       	push   $0x7ff000
+  801c28:	6a 00                	push   $0x0
+  801c2a:	e8 a6 f4 ff ff       	call   8010d5 <sys_page_alloc>
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	78 49                	js     801c7f <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801c36:	83 ec 04             	sub    $0x4,%esp
+  801c39:	68 00 10 00 00       	push   $0x1000
+  801c3e:	53                   	push   %ebx
+  801c3f:	68 00 f0 7f 00       	push   $0x7ff000
+  801c44:	e8 1a f1 ff ff       	call   800d63 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801c49:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801c50:	53                   	push   %ebx
+  801c51:	6a 00                	push   $0x0
+  801c53:	68 00 f0 7f 00       	push   $0x7ff000
+  801c58:	6a 00                	push   $0x0
+  801c5a:	e8 e3 f4 ff ff       	call   801142 <sys_page_map>
+  801c5f:	83 c4 20             	add    $0x20,%esp
+  801c62:	85 c0                	test   %eax,%eax
+  801c64:	78 2d                	js     801c93 <pgfault+0xaf>
+}
+  801c66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c69:	c9                   	leave
+  801c6a:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801c6b:	83 ec 04             	sub    $0x4,%esp
+  801c6e:	68 3b 3e 80 00       	push   $0x803e3b
+  801c73:	6a 1e                	push   $0x1e
+  801c75:	68 30 3e 80 00       	push   $0x803e30
+  801c7a:	e8 3b e8 ff ff       	call   8004ba <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801c7f:	83 ec 04             	sub    $0x4,%esp
+  801c82:	68 cc 3d 80 00       	push   $0x803dcc
+  801c87:	6a 29                	push   $0x29
+  801c89:	68 30 3e 80 00       	push   $0x803e30
+  801c8e:	e8 27 e8 ff ff       	call   8004ba <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801c93:	50                   	push   %eax
+  801c94:	68 00 3e 80 00       	push   $0x803e00
+  801c99:	6a 2e                	push   $0x2e
+  801c9b:	68 30 3e 80 00       	push   $0x803e30
+  801ca0:	e8 15 e8 ff ff       	call   8004ba <_panic>
+
+00801ca5 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801ca5:	55                   	push   %ebp
+  801ca6:	89 e5                	mov    %esp,%ebp
+  801ca8:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801cab:	ff 75 0c             	push   0xc(%ebp)
+  801cae:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801cb1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801cb8:	e8 23 f3 ff ff       	call   800fe0 <sys_env_destroy>
+}
+  801cbd:	83 c4 10             	add    $0x10,%esp
+  801cc0:	c9                   	leave
+  801cc1:	c3                   	ret
+
+00801cc2 <ufork>:
+{
+  801cc2:	55                   	push   %ebp
+  801cc3:	89 e5                	mov    %esp,%ebp
+  801cc5:	57                   	push   %edi
+  801cc6:	56                   	push   %esi
+  801cc7:	53                   	push   %ebx
+  801cc8:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801cce:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cd3:	cd 30                	int    $0x30
+  801cd5:	89 c6                	mov    %eax,%esi
+  801cd7:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	78 56                	js     801d37 <ufork+0x75>
+	if (pid > 0) {
+  801ce1:	0f 8e b3 02 00 00    	jle    801f9a <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801ce7:	83 ec 0c             	sub    $0xc,%esp
+  801cea:	68 e4 1b 80 00       	push   $0x801be4
+  801cef:	e8 aa 17 00 00       	call   80349e <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801cf4:	83 c4 08             	add    $0x8,%esp
+  801cf7:	68 05 35 80 00       	push   $0x803505
+  801cfc:	56                   	push   %esi
+  801cfd:	e8 ef f5 ff ff       	call   8012f1 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801d02:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d08:	89 1c 24             	mov    %ebx,(%esp)
+  801d0b:	e8 21 03 00 00       	call   802031 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801d10:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801d17:	6a 07                	push   $0x7
+  801d19:	68 00 f0 bf ee       	push   $0xeebff000
+  801d1e:	56                   	push   %esi
+  801d1f:	53                   	push   %ebx
+  801d20:	e8 8d 04 00 00       	call   8021b2 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801d25:	83 c4 20             	add    $0x20,%esp
+  801d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d2d:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801d33:	89 fe                	mov    %edi,%esi
+  801d35:	eb 22                	jmp    801d59 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801d37:	50                   	push   %eax
+  801d38:	68 54 3e 80 00       	push   $0x803e54
+  801d3d:	68 a9 00 00 00       	push   $0xa9
+  801d42:	68 30 3e 80 00       	push   $0x803e30
+  801d47:	e8 6e e7 ff ff       	call   8004ba <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801d4c:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801d52:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801d57:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801d59:	89 f7                	mov    %esi,%edi
+  801d5b:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801d61:	0f 87 e9 01 00 00    	ja     801f50 <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801d67:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801d6d:	85 f6                	test   %esi,%esi
+  801d6f:	0f 49 d6             	cmovns %esi,%edx
+  801d72:	c1 fa 0a             	sar    $0xa,%edx
+  801d75:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801d7c:	f6 c1 01             	test   $0x1,%cl
+  801d7f:	74 cb                	je     801d4c <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801d81:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d88:	f6 c2 80             	test   $0x80,%dl
+  801d8b:	75 17                	jne    801da4 <ufork+0xe2>
+			j = i + 1;
+  801d8d:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801d90:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801d97:	f6 c2 01             	test   $0x1,%dl
+  801d9a:	0f 85 f3 00 00 00    	jne    801e93 <ufork+0x1d1>
+			j = i + 1;
+  801da0:	89 de                	mov    %ebx,%esi
+  801da2:	eb b5                	jmp    801d59 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801da4:	89 fb                	mov    %edi,%ebx
+  801da6:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801da9:	89 d8                	mov    %ebx,%eax
+  801dab:	c1 e8 16             	shr    $0x16,%eax
+  801dae:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801db5:	89 c2                	mov    %eax,%edx
+  801db7:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801dbd:	25 02 04 00 00       	and    $0x402,%eax
+  801dc2:	83 f8 02             	cmp    $0x2,%eax
+  801dc5:	74 31                	je     801df8 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801dc7:	83 ec 04             	sub    $0x4,%esp
+  801dca:	6a 01                	push   $0x1
+  801dcc:	52                   	push   %edx
+  801dcd:	53                   	push   %ebx
+  801dce:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801dd4:	53                   	push   %ebx
+  801dd5:	6a 00                	push   $0x0
+  801dd7:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801ddd:	50                   	push   %eax
+  801dde:	e8 fa 03 00 00       	call   8021dd <batch_map>
+		return;
+  801de3:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801de6:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801dec:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801df1:	89 c6                	mov    %eax,%esi
+				continue;
+  801df3:	e9 61 ff ff ff       	jmp    801d59 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801df8:	83 ec 04             	sub    $0x4,%esp
+  801dfb:	80 ca 80             	or     $0x80,%dl
+  801dfe:	52                   	push   %edx
+  801dff:	53                   	push   %ebx
+  801e00:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801e06:	e8 ca f2 ff ff       	call   8010d5 <sys_page_alloc>
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 5d                	js     801e6f <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801e12:	83 ec 0c             	sub    $0xc,%esp
+  801e15:	6a 07                	push   $0x7
+  801e17:	68 00 00 40 00       	push   $0x400000
+  801e1c:	6a 00                	push   $0x0
+  801e1e:	53                   	push   %ebx
+  801e1f:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801e25:	e8 18 f3 ff ff       	call   801142 <sys_page_map>
+  801e2a:	83 c4 20             	add    $0x20,%esp
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 50                	js     801e81 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801e31:	83 ec 04             	sub    $0x4,%esp
+  801e34:	68 00 00 40 00       	push   $0x400000
+  801e39:	53                   	push   %ebx
+  801e3a:	68 00 00 40 00       	push   $0x400000
+  801e3f:	e8 1f ef ff ff       	call   800d63 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801e44:	83 c4 08             	add    $0x8,%esp
+  801e47:	68 00 00 40 00       	push   $0x400000
+  801e4c:	6a 00                	push   $0x0
+  801e4e:	e8 5d f3 ff ff       	call   8011b0 <sys_page_unmap>
+  801e53:	83 c4 10             	add    $0x10,%esp
+  801e56:	85 c0                	test   %eax,%eax
+  801e58:	79 8c                	jns    801de6 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801e5a:	50                   	push   %eax
+  801e5b:	68 88 3e 80 00       	push   $0x803e88
+  801e60:	68 81 00 00 00       	push   $0x81
+  801e65:	68 30 3e 80 00       	push   $0x803e30
+  801e6a:	e8 4b e6 ff ff       	call   8004ba <_panic>
+		panic("sys_page_alloc: %e", r);
+  801e6f:	50                   	push   %eax
+  801e70:	68 64 3e 80 00       	push   $0x803e64
+  801e75:	6a 7c                	push   $0x7c
+  801e77:	68 30 3e 80 00       	push   $0x803e30
+  801e7c:	e8 39 e6 ff ff       	call   8004ba <_panic>
+		panic("sys_page_map: %e", r);
+  801e81:	50                   	push   %eax
+  801e82:	68 77 3e 80 00       	push   $0x803e77
+  801e87:	6a 7e                	push   $0x7e
+  801e89:	68 30 3e 80 00       	push   $0x803e30
+  801e8e:	e8 27 e6 ff ff       	call   8004ba <_panic>
+  801e93:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801e99:	eb 22                	jmp    801ebd <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801e9b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801ea2:	a8 01                	test   $0x1,%al
+  801ea4:	74 35                	je     801edb <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801ea6:	89 d8                	mov    %ebx,%eax
+  801ea8:	e8 9e fc ff ff       	call   801b4b <dupperm>
+  801ead:	89 c6                	mov    %eax,%esi
+  801eaf:	89 f8                	mov    %edi,%eax
+  801eb1:	e8 95 fc ff ff       	call   801b4b <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801eb6:	39 c6                	cmp    %eax,%esi
+  801eb8:	75 21                	jne    801edb <ufork+0x219>
+				j++;
+  801eba:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801ebd:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801ec3:	74 16                	je     801edb <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801ec5:	89 d8                	mov    %ebx,%eax
+  801ec7:	c1 e8 0a             	shr    $0xa,%eax
+  801eca:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ed1:	25 81 00 00 00       	and    $0x81,%eax
+  801ed6:	83 f8 01             	cmp    $0x1,%eax
+  801ed9:	74 c0                	je     801e9b <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801edb:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801ee1:	89 d8                	mov    %ebx,%eax
+  801ee3:	29 f0                	sub    %esi,%eax
+  801ee5:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801eeb:	89 fe                	mov    %edi,%esi
+  801eed:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801ef0:	89 f8                	mov    %edi,%eax
+  801ef2:	e8 54 fc ff ff       	call   801b4b <dupperm>
+  801ef7:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801ef9:	83 ec 08             	sub    $0x8,%esp
+  801efc:	6a 02                	push   $0x2
+  801efe:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801f04:	51                   	push   %ecx
+  801f05:	e8 95 01 00 00       	call   80209f <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801f0a:	83 c4 0c             	add    $0xc,%esp
+  801f0d:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801f13:	57                   	push   %edi
+  801f14:	56                   	push   %esi
+  801f15:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801f1b:	56                   	push   %esi
+  801f1c:	6a 00                	push   $0x0
+  801f1e:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801f24:	51                   	push   %ecx
+  801f25:	e8 b3 02 00 00       	call   8021dd <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801f2a:	83 c4 1c             	add    $0x1c,%esp
+  801f2d:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801f33:	57                   	push   %edi
+  801f34:	56                   	push   %esi
+  801f35:	6a 00                	push   $0x0
+  801f37:	56                   	push   %esi
+  801f38:	6a 00                	push   $0x0
+  801f3a:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801f40:	50                   	push   %eax
+  801f41:	e8 97 02 00 00       	call   8021dd <batch_map>
+	return 0;
+  801f46:	83 c4 20             	add    $0x20,%esp
+  801f49:	89 de                	mov    %ebx,%esi
+  801f4b:	e9 09 fe ff ff       	jmp    801d59 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801f50:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801f56:	83 ec 04             	sub    $0x4,%esp
+  801f59:	6a 02                	push   $0x2
+  801f5b:	56                   	push   %esi
+  801f5c:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801f62:	53                   	push   %ebx
+  801f63:	e8 c9 02 00 00       	call   802231 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801f68:	89 1c 24             	mov    %ebx,(%esp)
+  801f6b:	e8 dd 00 00 00       	call   80204d <batch_flush>
+  801f70:	83 c4 10             	add    $0x10,%esp
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	78 0e                	js     801f85 <ufork+0x2c3>
+}
+  801f77:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801f7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f80:	5b                   	pop    %ebx
+  801f81:	5e                   	pop    %esi
+  801f82:	5f                   	pop    %edi
+  801f83:	5d                   	pop    %ebp
+  801f84:	c3                   	ret
+			panic("fork: %e", r);
+  801f85:	50                   	push   %eax
+  801f86:	68 5b 3e 80 00       	push   $0x803e5b
+  801f8b:	68 d7 00 00 00       	push   $0xd7
+  801f90:	68 30 3e 80 00       	push   $0x803e30
+  801f95:	e8 20 e5 ff ff       	call   8004ba <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801f9a:	e8 aa f0 ff ff       	call   801049 <sys_getenvid>
+  801f9f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801fa4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801faa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801faf:	a3 08 60 80 01       	mov    %eax,0x1806008
+		return 0;
+  801fb4:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801fbb:	00 00 00 
+  801fbe:	eb b7                	jmp    801f77 <ufork+0x2b5>
+
+00801fc0 <fork>:
+{
+  801fc0:	55                   	push   %ebp
+  801fc1:	89 e5                	mov    %esp,%ebp
+  801fc3:	53                   	push   %ebx
+  801fc4:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801fc7:	68 e4 1b 80 00       	push   $0x801be4
+  801fcc:	e8 cd 14 00 00       	call   80349e <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801fd1:	e8 7a f6 ff ff       	call   801650 <sys_fork>
+  801fd6:	89 c3                	mov    %eax,%ebx
+  801fd8:	83 c4 10             	add    $0x10,%esp
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	78 09                	js     801fe8 <fork+0x28>
+	if (pid == 0)
+  801fdf:	74 1c                	je     801ffd <fork+0x3d>
+}
+  801fe1:	89 d8                	mov    %ebx,%eax
+  801fe3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fe6:	c9                   	leave
+  801fe7:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801fe8:	50                   	push   %eax
+  801fe9:	68 54 3e 80 00       	push   $0x803e54
+  801fee:	68 ed 00 00 00       	push   $0xed
+  801ff3:	68 30 3e 80 00       	push   $0x803e30
+  801ff8:	e8 bd e4 ff ff       	call   8004ba <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801ffd:	e8 47 f0 ff ff       	call   801049 <sys_getenvid>
+  802002:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802007:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80200d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802012:	a3 08 60 80 01       	mov    %eax,0x1806008
+	return pid;
+  802017:	eb c8                	jmp    801fe1 <fork+0x21>
+
+00802019 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  802019:	55                   	push   %ebp
+  80201a:	89 e5                	mov    %esp,%ebp
+  80201c:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  80201f:	ff 75 0c             	push   0xc(%ebp)
+  802022:	ff 75 08             	push   0x8(%ebp)
+  802025:	68 a5 1c 80 00       	push   $0x801ca5
+  80202a:	e8 67 f6 ff ff       	call   801696 <sys_thread_create>
+}
+  80202f:	c9                   	leave
+  802030:	c3                   	ret
+
+00802031 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  802031:	55                   	push   %ebp
+  802032:	89 e5                	mov    %esp,%ebp
+  802034:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  802037:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  80203e:	00 00 00 
+	b->b_error = 0;
+  802041:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  802048:	00 00 00 
+}
+  80204b:	5d                   	pop    %ebp
+  80204c:	c3                   	ret
+
+0080204d <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	53                   	push   %ebx
+  802051:	83 ec 04             	sub    $0x4,%esp
+  802054:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  802057:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  80205d:	85 c0                	test   %eax,%eax
+  80205f:	7e 09                	jle    80206a <batch_flush+0x1d>
+  802061:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  802068:	74 15                	je     80207f <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  80206a:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  802071:	00 00 00 
+	return b->b_error;
+  802074:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  80207a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80207d:	c9                   	leave
+  80207e:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  80207f:	83 ec 08             	sub    $0x8,%esp
+  802082:	50                   	push   %eax
+  802083:	53                   	push   %ebx
+  802084:	e8 32 f7 ff ff       	call   8017bb <sys_batch>
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	79 da                	jns    80206a <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  802090:	f7 d8                	neg    %eax
+  802092:	0f b6 c0             	movzbl %al,%eax
+  802095:	f7 d8                	neg    %eax
+  802097:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  80209d:	eb cb                	jmp    80206a <batch_flush+0x1d>
+
+0080209f <batch_reserve>:
+{
+  80209f:	55                   	push   %ebp
+  8020a0:	89 e5                	mov    %esp,%ebp
+  8020a2:	83 ec 08             	sub    $0x8,%esp
+  8020a5:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  8020a8:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  8020ae:	03 45 0c             	add    0xc(%ebp),%eax
+  8020b1:	83 f8 10             	cmp    $0x10,%eax
+  8020b4:	7f 02                	jg     8020b8 <batch_reserve+0x19>
+}
+  8020b6:	c9                   	leave
+  8020b7:	c3                   	ret
+		batch_flush(b);
+  8020b8:	83 ec 0c             	sub    $0xc,%esp
+  8020bb:	52                   	push   %edx
+  8020bc:	e8 8c ff ff ff       	call   80204d <batch_flush>
+  8020c1:	83 c4 10             	add    $0x10,%esp
+}
+  8020c4:	eb f0                	jmp    8020b6 <batch_reserve+0x17>
+
+008020c6 <batch_next>:
+{
+  8020c6:	55                   	push   %ebp
+  8020c7:	89 e5                	mov    %esp,%ebp
+  8020c9:	53                   	push   %ebx
+  8020ca:	83 ec 04             	sub    $0x4,%esp
+  8020cd:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  8020cf:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  8020d6:	74 28                	je     802100 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  8020d8:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8020de:	8d 50 01             	lea    0x1(%eax),%edx
+  8020e1:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  8020e7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8020ea:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  8020ec:	83 ec 04             	sub    $0x4,%esp
+  8020ef:	6a 1c                	push   $0x1c
+  8020f1:	6a 00                	push   $0x0
+  8020f3:	53                   	push   %ebx
+  8020f4:	e8 35 ec ff ff       	call   800d2e <memset>
+}
+  8020f9:	89 d8                	mov    %ebx,%eax
+  8020fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+		batch_flush(b);
+  802100:	83 ec 0c             	sub    $0xc,%esp
+  802103:	50                   	push   %eax
+  802104:	e8 44 ff ff ff       	call   80204d <batch_flush>
+  802109:	83 c4 10             	add    $0x10,%esp
+  80210c:	eb ca                	jmp    8020d8 <batch_next+0x12>
+
+0080210e <batch_page>:
+{
+  80210e:	55                   	push   %ebp
+  80210f:	89 e5                	mov    %esp,%ebp
+  802111:	57                   	push   %edi
+  802112:	56                   	push   %esi
+  802113:	53                   	push   %ebx
+  802114:	83 ec 1c             	sub    $0x1c,%esp
+  802117:	89 d3                	mov    %edx,%ebx
+  802119:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  80211b:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  802121:	85 d2                	test   %edx,%edx
+  802123:	74 50                	je     802175 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  802125:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  802128:	01 c1                	add    %eax,%ecx
+  80212a:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  80212d:	75 46                	jne    802175 <batch_page+0x67>
+  80212f:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  802132:	75 41                	jne    802175 <batch_page+0x67>
+  802134:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  802137:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  80213a:	75 39                	jne    802175 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  80213c:	83 ea 01             	sub    $0x1,%edx
+  80213f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  802142:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  802145:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  802149:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  80214c:	75 27                	jne    802175 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  80214e:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  802151:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  802155:	89 fa                	mov    %edi,%edx
+  802157:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  80215a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  80215d:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  802160:	39 55 08             	cmp    %edx,0x8(%ebp)
+  802163:	75 10                	jne    802175 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  802165:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  802169:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80216c:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  802170:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802173:	74 2a                	je     80219f <batch_page+0x91>
+	op = batch_next(b);
+  802175:	e8 4c ff ff ff       	call   8020c6 <batch_next>
+	op->bo_op = opcode;
+  80217a:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  80217c:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  80217f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802182:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802185:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802188:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  80218b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80218e:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  802191:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802194:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802197:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80219a:	89 78 14             	mov    %edi,0x14(%eax)
+  80219d:	eb 0b                	jmp    8021aa <batch_page+0x9c>
+		op->bo_npages += npages;
+  80219f:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  8021a3:	03 7d 18             	add    0x18(%ebp),%edi
+  8021a6:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  8021aa:	83 c4 1c             	add    $0x1c,%esp
+  8021ad:	5b                   	pop    %ebx
+  8021ae:	5e                   	pop    %esi
+  8021af:	5f                   	pop    %edi
+  8021b0:	5d                   	pop    %ebp
+  8021b1:	c3                   	ret
+
+008021b2 <batch_alloc>:
+{
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  8021b8:	ff 75 18             	push   0x18(%ebp)
+  8021bb:	ff 75 14             	push   0x14(%ebp)
+  8021be:	ff 75 10             	push   0x10(%ebp)
+  8021c1:	ff 75 0c             	push   0xc(%ebp)
+  8021c4:	6a 00                	push   $0x0
+  8021c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d3:	e8 36 ff ff ff       	call   80210e <batch_page>
+}
+  8021d8:	83 c4 20             	add    $0x20,%esp
+  8021db:	c9                   	leave
+  8021dc:	c3                   	ret
+
+008021dd <batch_map>:
+{
+  8021dd:	55                   	push   %ebp
+  8021de:	89 e5                	mov    %esp,%ebp
+  8021e0:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  8021e3:	ff 75 20             	push   0x20(%ebp)
+  8021e6:	ff 75 1c             	push   0x1c(%ebp)
+  8021e9:	ff 75 18             	push   0x18(%ebp)
+  8021ec:	ff 75 14             	push   0x14(%ebp)
+  8021ef:	ff 75 10             	push   0x10(%ebp)
+  8021f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8021f5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8021fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fd:	e8 0c ff ff ff       	call   80210e <batch_page>
+}
+  802202:	83 c4 20             	add    $0x20,%esp
+  802205:	c9                   	leave
+  802206:	c3                   	ret
+
+00802207 <batch_unmap>:
+{
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  80220d:	ff 75 14             	push   0x14(%ebp)
+  802210:	6a 00                	push   $0x0
+  802212:	ff 75 10             	push   0x10(%ebp)
+  802215:	ff 75 0c             	push   0xc(%ebp)
+  802218:	6a 00                	push   $0x0
+  80221a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80221f:	ba 02 00 00 00       	mov    $0x2,%edx
+  802224:	8b 45 08             	mov    0x8(%ebp),%eax
+  802227:	e8 e2 fe ff ff       	call   80210e <batch_page>
+}
+  80222c:	83 c4 20             	add    $0x20,%esp
+  80222f:	c9                   	leave
+  802230:	c3                   	ret
+
+00802231 <batch_set_status>:
+{
+  802231:	55                   	push   %ebp
+  802232:	89 e5                	mov    %esp,%ebp
+  802234:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  802237:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223a:	e8 87 fe ff ff       	call   8020c6 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  80223f:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  802245:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802248:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  80224b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80224e:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  802251:	c9                   	leave
+  802252:	c3                   	ret
+
+00802253 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802253:	55                   	push   %ebp
+  802254:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802256:	8b 45 08             	mov    0x8(%ebp),%eax
+  802259:	05 00 00 00 30       	add    $0x30000000,%eax
+  80225e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802261:	5d                   	pop    %ebp
+  802262:	c3                   	ret
+
+00802263 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802263:	55                   	push   %ebp
+  802264:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802266:	8b 45 08             	mov    0x8(%ebp),%eax
+  802269:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80226e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802273:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802278:	5d                   	pop    %ebp
+  802279:	c3                   	ret
+
+0080227a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80227d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802282:	eb 02                	jmp    802286 <fd_alloc+0xc>
+  802284:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802286:	89 c2                	mov    %eax,%edx
+  802288:	c1 ea 16             	shr    $0x16,%edx
+  80228b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802292:	f6 c2 01             	test   $0x1,%dl
+  802295:	74 2b                	je     8022c2 <fd_alloc+0x48>
+  802297:	89 c2                	mov    %eax,%edx
+  802299:	c1 ea 0c             	shr    $0xc,%edx
+  80229c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8022a3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8022a9:	f6 c1 01             	test   $0x1,%cl
+  8022ac:	74 14                	je     8022c2 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8022ae:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8022b4:	75 ce                	jne    802284 <fd_alloc+0xa>
+  8022b6:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8022bb:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8022c0:	eb 05                	jmp    8022c7 <fd_alloc+0x4d>
+			return 0;
+  8022c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8022c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022ca:	89 02                	mov    %eax,(%edx)
+}
+  8022cc:	89 c8                	mov    %ecx,%eax
+  8022ce:	5d                   	pop    %ebp
+  8022cf:	c3                   	ret
+
+008022d0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8022d0:	55                   	push   %ebp
+  8022d1:	89 e5                	mov    %esp,%ebp
+  8022d3:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8022d6:	83 f8 1f             	cmp    $0x1f,%eax
+  8022d9:	77 30                	ja     80230b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8022db:	c1 e0 0c             	shl    $0xc,%eax
+  8022de:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8022e3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8022e9:	f6 c2 01             	test   $0x1,%dl
+  8022ec:	74 24                	je     802312 <fd_lookup+0x42>
+  8022ee:	89 c2                	mov    %eax,%edx
+  8022f0:	c1 ea 0c             	shr    $0xc,%edx
+  8022f3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8022fa:	f6 c2 01             	test   $0x1,%dl
+  8022fd:	74 1a                	je     802319 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8022ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802302:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802304:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802309:	5d                   	pop    %ebp
+  80230a:	c3                   	ret
+		return -E_INVAL;
+  80230b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802310:	eb f7                	jmp    802309 <fd_lookup+0x39>
+		return -E_INVAL;
+  802312:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802317:	eb f0                	jmp    802309 <fd_lookup+0x39>
+  802319:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80231e:	eb e9                	jmp    802309 <fd_lookup+0x39>
+
+00802320 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802320:	55                   	push   %ebp
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	53                   	push   %ebx
+  802324:	83 ec 04             	sub    $0x4,%esp
+  802327:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80232a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232f:	eb 03                	jmp    802334 <dev_lookup+0x14>
+  802331:	83 c0 01             	add    $0x1,%eax
+  802334:	8b 1c 85 18 3f 80 00 	mov    0x803f18(,%eax,4),%ebx
+  80233b:	85 db                	test   %ebx,%ebx
+  80233d:	74 0b                	je     80234a <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80233f:	39 13                	cmp    %edx,(%ebx)
+  802341:	75 ee                	jne    802331 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  802343:	b8 00 00 00 00       	mov    $0x0,%eax
+  802348:	eb 2e                	jmp    802378 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80234a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80234c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802351:	8b 0d 08 60 80 01    	mov    0x1806008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802357:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80235c:	76 24                	jbe    802382 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80235e:	8b 41 48             	mov    0x48(%ecx),%eax
+  802361:	83 ec 04             	sub    $0x4,%esp
+  802364:	52                   	push   %edx
+  802365:	50                   	push   %eax
+  802366:	68 9c 3e 80 00       	push   $0x803e9c
+  80236b:	e8 25 e2 ff ff       	call   800595 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  802370:	83 c4 10             	add    $0x10,%esp
+  802373:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802378:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80237b:	89 1a                	mov    %ebx,(%edx)
+}
+  80237d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802380:	c9                   	leave
+  802381:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802382:	c1 e8 10             	shr    $0x10,%eax
+  802385:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80238b:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802391:	eb cb                	jmp    80235e <dev_lookup+0x3e>
+
+00802393 <fd_close>:
+{
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	57                   	push   %edi
+  802397:	56                   	push   %esi
+  802398:	53                   	push   %ebx
+  802399:	83 ec 24             	sub    $0x24,%esp
+  80239c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80239f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8023a2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023a5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8023a6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8023ac:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8023af:	50                   	push   %eax
+  8023b0:	e8 1b ff ff ff       	call   8022d0 <fd_lookup>
+  8023b5:	89 c3                	mov    %eax,%ebx
+  8023b7:	83 c4 10             	add    $0x10,%esp
+  8023ba:	85 c0                	test   %eax,%eax
+  8023bc:	78 05                	js     8023c3 <fd_close+0x30>
+	    || fd != fd2)
+  8023be:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8023c1:	74 16                	je     8023d9 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8023c3:	89 f8                	mov    %edi,%eax
+  8023c5:	84 c0                	test   %al,%al
+  8023c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023cc:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8023cf:	89 d8                	mov    %ebx,%eax
+  8023d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d4:	5b                   	pop    %ebx
+  8023d5:	5e                   	pop    %esi
+  8023d6:	5f                   	pop    %edi
+  8023d7:	5d                   	pop    %ebp
+  8023d8:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8023d9:	83 ec 08             	sub    $0x8,%esp
+  8023dc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8023df:	50                   	push   %eax
+  8023e0:	ff 36                	push   (%esi)
+  8023e2:	e8 39 ff ff ff       	call   802320 <dev_lookup>
+  8023e7:	89 c3                	mov    %eax,%ebx
+  8023e9:	83 c4 10             	add    $0x10,%esp
+  8023ec:	85 c0                	test   %eax,%eax
+  8023ee:	78 1a                	js     80240a <fd_close+0x77>
+		if (dev->dev_close)
+  8023f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023f3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8023f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	74 0b                	je     80240a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8023ff:	83 ec 0c             	sub    $0xc,%esp
+  802402:	56                   	push   %esi
+  802403:	ff d0                	call   *%eax
+  802405:	89 c3                	mov    %eax,%ebx
+  802407:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80240a:	83 ec 08             	sub    $0x8,%esp
+  80240d:	56                   	push   %esi
+  80240e:	6a 00                	push   $0x0
+  802410:	e8 9b ed ff ff       	call   8011b0 <sys_page_unmap>
+	return r;
+  802415:	83 c4 10             	add    $0x10,%esp
+  802418:	eb b5                	jmp    8023cf <fd_close+0x3c>
+
+0080241a <close>:
+
+int
+close(int fdnum)
+{
+  80241a:	55                   	push   %ebp
+  80241b:	89 e5                	mov    %esp,%ebp
+  80241d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802420:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802423:	50                   	push   %eax
+  802424:	ff 75 08             	push   0x8(%ebp)
+  802427:	e8 a4 fe ff ff       	call   8022d0 <fd_lookup>
+  80242c:	83 c4 10             	add    $0x10,%esp
+  80242f:	85 c0                	test   %eax,%eax
+  802431:	79 02                	jns    802435 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802433:	c9                   	leave
+  802434:	c3                   	ret
+		return fd_close(fd, 1);
+  802435:	83 ec 08             	sub    $0x8,%esp
+  802438:	6a 01                	push   $0x1
+  80243a:	ff 75 f4             	push   -0xc(%ebp)
+  80243d:	e8 51 ff ff ff       	call   802393 <fd_close>
+  802442:	83 c4 10             	add    $0x10,%esp
+  802445:	eb ec                	jmp    802433 <close+0x19>
+
+00802447 <close_all>:
+
+void
+close_all(void)
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	53                   	push   %ebx
+  80244b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80244e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802453:	83 ec 0c             	sub    $0xc,%esp
+  802456:	53                   	push   %ebx
+  802457:	e8 be ff ff ff       	call   80241a <close>
+	for (i = 0; i < MAXFD; i++)
+  80245c:	83 c3 01             	add    $0x1,%ebx
+  80245f:	83 c4 10             	add    $0x10,%esp
+  802462:	83 fb 20             	cmp    $0x20,%ebx
+  802465:	75 ec                	jne    802453 <close_all+0xc>
+}
+  802467:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80246a:	c9                   	leave
+  80246b:	c3                   	ret
+
+0080246c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80246c:	55                   	push   %ebp
+  80246d:	89 e5                	mov    %esp,%ebp
+  80246f:	57                   	push   %edi
+  802470:	56                   	push   %esi
+  802471:	53                   	push   %ebx
+  802472:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802475:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802478:	50                   	push   %eax
+  802479:	ff 75 08             	push   0x8(%ebp)
+  80247c:	e8 4f fe ff ff       	call   8022d0 <fd_lookup>
+  802481:	89 c3                	mov    %eax,%ebx
+  802483:	83 c4 10             	add    $0x10,%esp
+  802486:	85 c0                	test   %eax,%eax
+  802488:	78 7f                	js     802509 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80248a:	83 ec 0c             	sub    $0xc,%esp
+  80248d:	ff 75 0c             	push   0xc(%ebp)
+  802490:	e8 85 ff ff ff       	call   80241a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802495:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802498:	c1 e6 0c             	shl    $0xc,%esi
+  80249b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8024a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8024a4:	89 3c 24             	mov    %edi,(%esp)
+  8024a7:	e8 b7 fd ff ff       	call   802263 <fd2data>
+  8024ac:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8024ae:	89 34 24             	mov    %esi,(%esp)
+  8024b1:	e8 ad fd ff ff       	call   802263 <fd2data>
+  8024b6:	83 c4 10             	add    $0x10,%esp
+  8024b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8024bc:	89 d8                	mov    %ebx,%eax
+  8024be:	c1 e8 16             	shr    $0x16,%eax
+  8024c1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8024c8:	a8 01                	test   $0x1,%al
+  8024ca:	74 11                	je     8024dd <dup+0x71>
+  8024cc:	89 d8                	mov    %ebx,%eax
+  8024ce:	c1 e8 0c             	shr    $0xc,%eax
+  8024d1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8024d8:	f6 c2 01             	test   $0x1,%dl
+  8024db:	75 36                	jne    802513 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8024dd:	89 f8                	mov    %edi,%eax
+  8024df:	c1 e8 0c             	shr    $0xc,%eax
+  8024e2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8024e9:	83 ec 0c             	sub    $0xc,%esp
+  8024ec:	25 07 0e 00 00       	and    $0xe07,%eax
+  8024f1:	50                   	push   %eax
+  8024f2:	56                   	push   %esi
+  8024f3:	6a 00                	push   $0x0
+  8024f5:	57                   	push   %edi
+  8024f6:	6a 00                	push   $0x0
+  8024f8:	e8 45 ec ff ff       	call   801142 <sys_page_map>
+  8024fd:	89 c3                	mov    %eax,%ebx
+  8024ff:	83 c4 20             	add    $0x20,%esp
+  802502:	85 c0                	test   %eax,%eax
+  802504:	78 33                	js     802539 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802506:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802509:	89 d8                	mov    %ebx,%eax
+  80250b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80250e:	5b                   	pop    %ebx
+  80250f:	5e                   	pop    %esi
+  802510:	5f                   	pop    %edi
+  802511:	5d                   	pop    %ebp
+  802512:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802513:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80251a:	83 ec 0c             	sub    $0xc,%esp
+  80251d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802522:	50                   	push   %eax
+  802523:	ff 75 d4             	push   -0x2c(%ebp)
+  802526:	6a 00                	push   $0x0
+  802528:	53                   	push   %ebx
+  802529:	6a 00                	push   $0x0
+  80252b:	e8 12 ec ff ff       	call   801142 <sys_page_map>
+  802530:	89 c3                	mov    %eax,%ebx
+  802532:	83 c4 20             	add    $0x20,%esp
+  802535:	85 c0                	test   %eax,%eax
+  802537:	79 a4                	jns    8024dd <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802539:	83 ec 08             	sub    $0x8,%esp
+  80253c:	56                   	push   %esi
+  80253d:	6a 00                	push   $0x0
+  80253f:	e8 6c ec ff ff       	call   8011b0 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802544:	83 c4 08             	add    $0x8,%esp
+  802547:	ff 75 d4             	push   -0x2c(%ebp)
+  80254a:	6a 00                	push   $0x0
+  80254c:	e8 5f ec ff ff       	call   8011b0 <sys_page_unmap>
+	return r;
+  802551:	83 c4 10             	add    $0x10,%esp
+  802554:	eb b3                	jmp    802509 <dup+0x9d>
+
+00802556 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802556:	55                   	push   %ebp
+  802557:	89 e5                	mov    %esp,%ebp
+  802559:	56                   	push   %esi
+  80255a:	53                   	push   %ebx
+  80255b:	83 ec 18             	sub    $0x18,%esp
+  80255e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802561:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802564:	50                   	push   %eax
+  802565:	53                   	push   %ebx
+  802566:	e8 65 fd ff ff       	call   8022d0 <fd_lookup>
+  80256b:	83 c4 10             	add    $0x10,%esp
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	78 3c                	js     8025ae <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802572:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802575:	83 ec 08             	sub    $0x8,%esp
+  802578:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80257b:	50                   	push   %eax
+  80257c:	ff 36                	push   (%esi)
+  80257e:	e8 9d fd ff ff       	call   802320 <dev_lookup>
+  802583:	83 c4 10             	add    $0x10,%esp
+  802586:	85 c0                	test   %eax,%eax
+  802588:	78 24                	js     8025ae <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80258a:	8b 46 08             	mov    0x8(%esi),%eax
+  80258d:	83 e0 03             	and    $0x3,%eax
+  802590:	83 f8 01             	cmp    $0x1,%eax
+  802593:	74 20                	je     8025b5 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802595:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802598:	8b 40 08             	mov    0x8(%eax),%eax
+  80259b:	85 c0                	test   %eax,%eax
+  80259d:	74 57                	je     8025f6 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80259f:	83 ec 04             	sub    $0x4,%esp
+  8025a2:	ff 75 10             	push   0x10(%ebp)
+  8025a5:	ff 75 0c             	push   0xc(%ebp)
+  8025a8:	56                   	push   %esi
+  8025a9:	ff d0                	call   *%eax
+  8025ab:	83 c4 10             	add    $0x10,%esp
+}
+  8025ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025b1:	5b                   	pop    %ebx
+  8025b2:	5e                   	pop    %esi
+  8025b3:	5d                   	pop    %ebp
+  8025b4:	c3                   	ret
+  8025b5:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025b7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025bc:	8b 15 08 60 80 01    	mov    0x1806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025c2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025c7:	76 1c                	jbe    8025e5 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025c9:	8b 42 48             	mov    0x48(%edx),%eax
+  8025cc:	83 ec 04             	sub    $0x4,%esp
+  8025cf:	53                   	push   %ebx
+  8025d0:	50                   	push   %eax
+  8025d1:	68 dd 3e 80 00       	push   $0x803edd
+  8025d6:	e8 ba df ff ff       	call   800595 <cprintf>
+		return -E_INVAL;
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025e3:	eb c9                	jmp    8025ae <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025e5:	c1 e8 10             	shr    $0x10,%eax
+  8025e8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025ee:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8025f4:	eb d3                	jmp    8025c9 <read+0x73>
+		return -E_NOT_SUPP;
+  8025f6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025fb:	eb b1                	jmp    8025ae <read+0x58>
+
+008025fd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8025fd:	55                   	push   %ebp
+  8025fe:	89 e5                	mov    %esp,%ebp
+  802600:	57                   	push   %edi
+  802601:	56                   	push   %esi
+  802602:	53                   	push   %ebx
+  802603:	83 ec 0c             	sub    $0xc,%esp
+  802606:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802609:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80260c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802611:	eb 02                	jmp    802615 <readn+0x18>
+  802613:	01 c3                	add    %eax,%ebx
+  802615:	39 f3                	cmp    %esi,%ebx
+  802617:	73 21                	jae    80263a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802619:	83 ec 04             	sub    $0x4,%esp
+  80261c:	89 f0                	mov    %esi,%eax
+  80261e:	29 d8                	sub    %ebx,%eax
+  802620:	50                   	push   %eax
+  802621:	89 d8                	mov    %ebx,%eax
+  802623:	03 45 0c             	add    0xc(%ebp),%eax
+  802626:	50                   	push   %eax
+  802627:	57                   	push   %edi
+  802628:	e8 29 ff ff ff       	call   802556 <read>
+		if (m < 0)
+  80262d:	83 c4 10             	add    $0x10,%esp
+  802630:	85 c0                	test   %eax,%eax
+  802632:	78 04                	js     802638 <readn+0x3b>
+			return m;
+		if (m == 0)
+  802634:	75 dd                	jne    802613 <readn+0x16>
+  802636:	eb 02                	jmp    80263a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802638:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80263a:	89 d8                	mov    %ebx,%eax
+  80263c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263f:	5b                   	pop    %ebx
+  802640:	5e                   	pop    %esi
+  802641:	5f                   	pop    %edi
+  802642:	5d                   	pop    %ebp
+  802643:	c3                   	ret
+
+00802644 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802644:	55                   	push   %ebp
+  802645:	89 e5                	mov    %esp,%ebp
+  802647:	56                   	push   %esi
+  802648:	53                   	push   %ebx
+  802649:	83 ec 18             	sub    $0x18,%esp
+  80264c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80264f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802652:	50                   	push   %eax
+  802653:	53                   	push   %ebx
+  802654:	e8 77 fc ff ff       	call   8022d0 <fd_lookup>
+  802659:	83 c4 10             	add    $0x10,%esp
+  80265c:	85 c0                	test   %eax,%eax
+  80265e:	78 37                	js     802697 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802660:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802663:	83 ec 08             	sub    $0x8,%esp
+  802666:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802669:	50                   	push   %eax
+  80266a:	ff 36                	push   (%esi)
+  80266c:	e8 af fc ff ff       	call   802320 <dev_lookup>
+  802671:	83 c4 10             	add    $0x10,%esp
+  802674:	85 c0                	test   %eax,%eax
+  802676:	78 1f                	js     802697 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802678:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80267c:	74 20                	je     80269e <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80267e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802681:	8b 40 0c             	mov    0xc(%eax),%eax
+  802684:	85 c0                	test   %eax,%eax
+  802686:	74 57                	je     8026df <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802688:	83 ec 04             	sub    $0x4,%esp
+  80268b:	ff 75 10             	push   0x10(%ebp)
+  80268e:	ff 75 0c             	push   0xc(%ebp)
+  802691:	56                   	push   %esi
+  802692:	ff d0                	call   *%eax
+  802694:	83 c4 10             	add    $0x10,%esp
+}
+  802697:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80269a:	5b                   	pop    %ebx
+  80269b:	5e                   	pop    %esi
+  80269c:	5d                   	pop    %ebp
+  80269d:	c3                   	ret
+  80269e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026a0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026a5:	8b 15 08 60 80 01    	mov    0x1806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026ab:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026b0:	76 1c                	jbe    8026ce <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026b2:	8b 42 48             	mov    0x48(%edx),%eax
+  8026b5:	83 ec 04             	sub    $0x4,%esp
+  8026b8:	53                   	push   %ebx
+  8026b9:	50                   	push   %eax
+  8026ba:	68 f9 3e 80 00       	push   $0x803ef9
+  8026bf:	e8 d1 de ff ff       	call   800595 <cprintf>
+		return -E_INVAL;
+  8026c4:	83 c4 10             	add    $0x10,%esp
+  8026c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026cc:	eb c9                	jmp    802697 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8026ce:	c1 e8 10             	shr    $0x10,%eax
+  8026d1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026d7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8026dd:	eb d3                	jmp    8026b2 <write+0x6e>
+		return -E_NOT_SUPP;
+  8026df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026e4:	eb b1                	jmp    802697 <write+0x53>
+
+008026e6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8026e6:	55                   	push   %ebp
+  8026e7:	89 e5                	mov    %esp,%ebp
+  8026e9:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ef:	50                   	push   %eax
+  8026f0:	ff 75 08             	push   0x8(%ebp)
+  8026f3:	e8 d8 fb ff ff       	call   8022d0 <fd_lookup>
+  8026f8:	83 c4 10             	add    $0x10,%esp
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	78 0e                	js     80270d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8026ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802702:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802705:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802708:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80270d:	c9                   	leave
+  80270e:	c3                   	ret
+
+0080270f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80270f:	55                   	push   %ebp
+  802710:	89 e5                	mov    %esp,%ebp
+  802712:	56                   	push   %esi
+  802713:	53                   	push   %ebx
+  802714:	83 ec 18             	sub    $0x18,%esp
+  802717:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80271a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80271d:	50                   	push   %eax
+  80271e:	53                   	push   %ebx
+  80271f:	e8 ac fb ff ff       	call   8022d0 <fd_lookup>
+  802724:	83 c4 10             	add    $0x10,%esp
+  802727:	85 c0                	test   %eax,%eax
+  802729:	78 34                	js     80275f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80272b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80272e:	83 ec 08             	sub    $0x8,%esp
+  802731:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802734:	50                   	push   %eax
+  802735:	ff 36                	push   (%esi)
+  802737:	e8 e4 fb ff ff       	call   802320 <dev_lookup>
+  80273c:	83 c4 10             	add    $0x10,%esp
+  80273f:	85 c0                	test   %eax,%eax
+  802741:	78 1c                	js     80275f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802743:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802747:	74 1d                	je     802766 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802749:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80274c:	8b 40 18             	mov    0x18(%eax),%eax
+  80274f:	85 c0                	test   %eax,%eax
+  802751:	74 54                	je     8027a7 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802753:	83 ec 08             	sub    $0x8,%esp
+  802756:	ff 75 0c             	push   0xc(%ebp)
+  802759:	56                   	push   %esi
+  80275a:	ff d0                	call   *%eax
+  80275c:	83 c4 10             	add    $0x10,%esp
+}
+  80275f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802762:	5b                   	pop    %ebx
+  802763:	5e                   	pop    %esi
+  802764:	5d                   	pop    %ebp
+  802765:	c3                   	ret
+  802766:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802768:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80276d:	8b 15 08 60 80 01    	mov    0x1806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802773:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802778:	76 1c                	jbe    802796 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  80277a:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80277d:	83 ec 04             	sub    $0x4,%esp
+  802780:	53                   	push   %ebx
+  802781:	50                   	push   %eax
+  802782:	68 bc 3e 80 00       	push   $0x803ebc
+  802787:	e8 09 de ff ff       	call   800595 <cprintf>
+		return -E_INVAL;
+  80278c:	83 c4 10             	add    $0x10,%esp
+  80278f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802794:	eb c9                	jmp    80275f <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802796:	c1 e8 10             	shr    $0x10,%eax
+  802799:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80279f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8027a5:	eb d3                	jmp    80277a <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  8027a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027ac:	eb b1                	jmp    80275f <ftruncate+0x50>
+
+008027ae <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8027ae:	55                   	push   %ebp
+  8027af:	89 e5                	mov    %esp,%ebp
+  8027b1:	56                   	push   %esi
+  8027b2:	53                   	push   %ebx
+  8027b3:	83 ec 18             	sub    $0x18,%esp
+  8027b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8027b9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027bc:	50                   	push   %eax
+  8027bd:	ff 75 08             	push   0x8(%ebp)
+  8027c0:	e8 0b fb ff ff       	call   8022d0 <fd_lookup>
+  8027c5:	83 c4 10             	add    $0x10,%esp
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	78 49                	js     802815 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8027cc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8027cf:	83 ec 08             	sub    $0x8,%esp
+  8027d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027d5:	50                   	push   %eax
+  8027d6:	ff 36                	push   (%esi)
+  8027d8:	e8 43 fb ff ff       	call   802320 <dev_lookup>
+  8027dd:	83 c4 10             	add    $0x10,%esp
+  8027e0:	85 c0                	test   %eax,%eax
+  8027e2:	78 31                	js     802815 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8027e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027e7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8027eb:	74 2f                	je     80281c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8027ed:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8027f0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8027f7:	00 00 00 
+	stat->st_isdir = 0;
+  8027fa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802801:	00 00 00 
+	stat->st_dev = dev;
+  802804:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80280a:	83 ec 08             	sub    $0x8,%esp
+  80280d:	53                   	push   %ebx
+  80280e:	56                   	push   %esi
+  80280f:	ff 50 14             	call   *0x14(%eax)
+  802812:	83 c4 10             	add    $0x10,%esp
+}
+  802815:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802818:	5b                   	pop    %ebx
+  802819:	5e                   	pop    %esi
+  80281a:	5d                   	pop    %ebp
+  80281b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80281c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802821:	eb f2                	jmp    802815 <fstat+0x67>
+
+00802823 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802823:	55                   	push   %ebp
+  802824:	89 e5                	mov    %esp,%ebp
+  802826:	56                   	push   %esi
+  802827:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802828:	83 ec 08             	sub    $0x8,%esp
+  80282b:	6a 00                	push   $0x0
+  80282d:	ff 75 08             	push   0x8(%ebp)
+  802830:	e8 e4 01 00 00       	call   802a19 <open>
+  802835:	89 c3                	mov    %eax,%ebx
+  802837:	83 c4 10             	add    $0x10,%esp
+  80283a:	85 c0                	test   %eax,%eax
+  80283c:	78 1b                	js     802859 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80283e:	83 ec 08             	sub    $0x8,%esp
+  802841:	ff 75 0c             	push   0xc(%ebp)
+  802844:	50                   	push   %eax
+  802845:	e8 64 ff ff ff       	call   8027ae <fstat>
+  80284a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80284c:	89 1c 24             	mov    %ebx,(%esp)
+  80284f:	e8 c6 fb ff ff       	call   80241a <close>
+	return r;
+  802854:	83 c4 10             	add    $0x10,%esp
+  802857:	89 f3                	mov    %esi,%ebx
+}
+  802859:	89 d8                	mov    %ebx,%eax
+  80285b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80285e:	5b                   	pop    %ebx
+  80285f:	5e                   	pop    %esi
+  802860:	5d                   	pop    %ebp
+  802861:	c3                   	ret
+
+00802862 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802862:	55                   	push   %ebp
+  802863:	89 e5                	mov    %esp,%ebp
+  802865:	56                   	push   %esi
+  802866:	53                   	push   %ebx
+  802867:	89 c6                	mov    %eax,%esi
+  802869:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80286b:	83 3d 00 60 80 01 00 	cmpl   $0x0,0x1806000
+  802872:	74 27                	je     80289b <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802874:	6a 07                	push   $0x7
+  802876:	68 00 70 80 01       	push   $0x1807000
+  80287b:	56                   	push   %esi
+  80287c:	ff 35 00 60 80 01    	push   0x1806000
+  802882:	e8 93 0d 00 00       	call   80361a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802887:	83 c4 0c             	add    $0xc,%esp
+  80288a:	6a 00                	push   $0x0
+  80288c:	53                   	push   %ebx
+  80288d:	6a 00                	push   $0x0
+  80288f:	e8 6e 0d 00 00       	call   803602 <ipc_recv>
+}
+  802894:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802897:	5b                   	pop    %ebx
+  802898:	5e                   	pop    %esi
+  802899:	5d                   	pop    %ebp
+  80289a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80289b:	83 ec 0c             	sub    $0xc,%esp
+  80289e:	6a 01                	push   $0x1
+  8028a0:	e8 c9 0d 00 00       	call   80366e <ipc_find_env>
+  8028a5:	a3 00 60 80 01       	mov    %eax,0x1806000
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	eb c5                	jmp    802874 <fsipc+0x12>
+
+008028af <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8028af:	55                   	push   %ebp
+  8028b0:	89 e5                	mov    %esp,%ebp
+  8028b2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8028b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028bb:	a3 00 70 80 01       	mov    %eax,0x1807000
+	fsipcbuf.set_size.req_size = newsize;
+  8028c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028c3:	a3 04 70 80 01       	mov    %eax,0x1807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8028c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028cd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028d2:	e8 8b ff ff ff       	call   802862 <fsipc>
+}
+  8028d7:	c9                   	leave
+  8028d8:	c3                   	ret
+
+008028d9 <devfile_flush>:
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8028df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028e5:	a3 00 70 80 01       	mov    %eax,0x1807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8028ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ef:	b8 06 00 00 00       	mov    $0x6,%eax
+  8028f4:	e8 69 ff ff ff       	call   802862 <fsipc>
+}
+  8028f9:	c9                   	leave
+  8028fa:	c3                   	ret
+
+008028fb <devfile_stat>:
+{
+  8028fb:	55                   	push   %ebp
+  8028fc:	89 e5                	mov    %esp,%ebp
+  8028fe:	53                   	push   %ebx
+  8028ff:	83 ec 04             	sub    $0x4,%esp
+  802902:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802905:	8b 45 08             	mov    0x8(%ebp),%eax
+  802908:	8b 40 0c             	mov    0xc(%eax),%eax
+  80290b:	a3 00 70 80 01       	mov    %eax,0x1807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802910:	ba 00 00 00 00       	mov    $0x0,%edx
+  802915:	b8 05 00 00 00       	mov    $0x5,%eax
+  80291a:	e8 43 ff ff ff       	call   802862 <fsipc>
+  80291f:	85 c0                	test   %eax,%eax
+  802921:	78 2c                	js     80294f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802923:	83 ec 08             	sub    $0x8,%esp
+  802926:	68 00 70 80 01       	push   $0x1807000
+  80292b:	53                   	push   %ebx
+  80292c:	e8 ac e2 ff ff       	call   800bdd <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802931:	a1 80 70 80 01       	mov    0x1807080,%eax
+  802936:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80293c:	a1 84 70 80 01       	mov    0x1807084,%eax
+  802941:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802947:	83 c4 10             	add    $0x10,%esp
+  80294a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80294f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802952:	c9                   	leave
+  802953:	c3                   	ret
+
+00802954 <devfile_write>:
+{
+  802954:	55                   	push   %ebp
+  802955:	89 e5                	mov    %esp,%ebp
+  802957:	83 ec 0c             	sub    $0xc,%esp
+  80295a:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80295d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802960:	8b 52 0c             	mov    0xc(%edx),%edx
+  802963:	89 15 00 70 80 01    	mov    %edx,0x1807000
+	fsipcbuf.write.req_n = n;
+  802969:	a3 04 70 80 01       	mov    %eax,0x1807004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80296e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802973:	39 d0                	cmp    %edx,%eax
+  802975:	0f 47 c2             	cmova  %edx,%eax
+  802978:	50                   	push   %eax
+  802979:	ff 75 0c             	push   0xc(%ebp)
+  80297c:	68 08 70 80 01       	push   $0x1807008
+  802981:	e8 dd e3 ff ff       	call   800d63 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802986:	ba 00 00 00 00       	mov    $0x0,%edx
+  80298b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802990:	e8 cd fe ff ff       	call   802862 <fsipc>
+}
+  802995:	c9                   	leave
+  802996:	c3                   	ret
+
+00802997 <devfile_read>:
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	56                   	push   %esi
+  80299b:	53                   	push   %ebx
+  80299c:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80299f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029a5:	a3 00 70 80 01       	mov    %eax,0x1807000
+	fsipcbuf.read.req_n = n;
+  8029aa:	89 35 04 70 80 01    	mov    %esi,0x1807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8029b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029ba:	e8 a3 fe ff ff       	call   802862 <fsipc>
+  8029bf:	89 c3                	mov    %eax,%ebx
+  8029c1:	85 c0                	test   %eax,%eax
+  8029c3:	78 1f                	js     8029e4 <devfile_read+0x4d>
+	assert(r <= n);
+  8029c5:	39 c6                	cmp    %eax,%esi
+  8029c7:	72 24                	jb     8029ed <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8029c9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8029ce:	7f 33                	jg     802a03 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8029d0:	83 ec 04             	sub    $0x4,%esp
+  8029d3:	50                   	push   %eax
+  8029d4:	68 00 70 80 01       	push   $0x1807000
+  8029d9:	ff 75 0c             	push   0xc(%ebp)
+  8029dc:	e8 82 e3 ff ff       	call   800d63 <memmove>
+	return r;
+  8029e1:	83 c4 10             	add    $0x10,%esp
+}
+  8029e4:	89 d8                	mov    %ebx,%eax
+  8029e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029e9:	5b                   	pop    %ebx
+  8029ea:	5e                   	pop    %esi
+  8029eb:	5d                   	pop    %ebp
+  8029ec:	c3                   	ret
+	assert(r <= n);
+  8029ed:	68 2c 3f 80 00       	push   $0x803f2c
+  8029f2:	68 0b 39 80 00       	push   $0x80390b
+  8029f7:	6a 76                	push   $0x76
+  8029f9:	68 33 3f 80 00       	push   $0x803f33
+  8029fe:	e8 b7 da ff ff       	call   8004ba <_panic>
+	assert(r <= PGSIZE);
+  802a03:	68 3e 3f 80 00       	push   $0x803f3e
+  802a08:	68 0b 39 80 00       	push   $0x80390b
+  802a0d:	6a 77                	push   $0x77
+  802a0f:	68 33 3f 80 00       	push   $0x803f33
+  802a14:	e8 a1 da ff ff       	call   8004ba <_panic>
+
+00802a19 <open>:
+{
+  802a19:	55                   	push   %ebp
+  802a1a:	89 e5                	mov    %esp,%ebp
+  802a1c:	56                   	push   %esi
+  802a1d:	53                   	push   %ebx
+  802a1e:	83 ec 1c             	sub    $0x1c,%esp
+  802a21:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802a24:	56                   	push   %esi
+  802a25:	e8 78 e1 ff ff       	call   800ba2 <strlen>
+  802a2a:	83 c4 10             	add    $0x10,%esp
+  802a2d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a32:	7f 6c                	jg     802aa0 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802a34:	83 ec 0c             	sub    $0xc,%esp
+  802a37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a3a:	50                   	push   %eax
+  802a3b:	e8 3a f8 ff ff       	call   80227a <fd_alloc>
+  802a40:	89 c3                	mov    %eax,%ebx
+  802a42:	83 c4 10             	add    $0x10,%esp
+  802a45:	85 c0                	test   %eax,%eax
+  802a47:	78 3c                	js     802a85 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802a49:	83 ec 08             	sub    $0x8,%esp
+  802a4c:	56                   	push   %esi
+  802a4d:	68 00 70 80 01       	push   $0x1807000
+  802a52:	e8 86 e1 ff ff       	call   800bdd <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802a57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a5a:	a3 00 74 80 01       	mov    %eax,0x1807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802a5f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a62:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a67:	e8 f6 fd ff ff       	call   802862 <fsipc>
+  802a6c:	89 c3                	mov    %eax,%ebx
+  802a6e:	83 c4 10             	add    $0x10,%esp
+  802a71:	85 c0                	test   %eax,%eax
+  802a73:	78 19                	js     802a8e <open+0x75>
+	return fd2num(fd);
+  802a75:	83 ec 0c             	sub    $0xc,%esp
+  802a78:	ff 75 f4             	push   -0xc(%ebp)
+  802a7b:	e8 d3 f7 ff ff       	call   802253 <fd2num>
+  802a80:	89 c3                	mov    %eax,%ebx
+  802a82:	83 c4 10             	add    $0x10,%esp
+}
+  802a85:	89 d8                	mov    %ebx,%eax
+  802a87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a8a:	5b                   	pop    %ebx
+  802a8b:	5e                   	pop    %esi
+  802a8c:	5d                   	pop    %ebp
+  802a8d:	c3                   	ret
+		fd_close(fd, 0);
+  802a8e:	83 ec 08             	sub    $0x8,%esp
+  802a91:	6a 00                	push   $0x0
+  802a93:	ff 75 f4             	push   -0xc(%ebp)
+  802a96:	e8 f8 f8 ff ff       	call   802393 <fd_close>
+		return r;
+  802a9b:	83 c4 10             	add    $0x10,%esp
+  802a9e:	eb e5                	jmp    802a85 <open+0x6c>
+		return -E_BAD_PATH;
+  802aa0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802aa5:	eb de                	jmp    802a85 <open+0x6c>
+
+00802aa7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802aa7:	55                   	push   %ebp
+  802aa8:	89 e5                	mov    %esp,%ebp
+  802aaa:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802aad:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab2:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ab7:	e8 a6 fd ff ff       	call   802862 <fsipc>
+}
+  802abc:	c9                   	leave
+  802abd:	c3                   	ret
+
+00802abe <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802abe:	55                   	push   %ebp
+  802abf:	89 e5                	mov    %esp,%ebp
+  802ac1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802ac4:	68 4a 3f 80 00       	push   $0x803f4a
+  802ac9:	ff 75 0c             	push   0xc(%ebp)
+  802acc:	e8 0c e1 ff ff       	call   800bdd <strcpy>
+	return 0;
+}
+  802ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad6:	c9                   	leave
+  802ad7:	c3                   	ret
+
+00802ad8 <devsock_close>:
+{
+  802ad8:	55                   	push   %ebp
+  802ad9:	89 e5                	mov    %esp,%ebp
+  802adb:	53                   	push   %ebx
+  802adc:	83 ec 10             	sub    $0x10,%esp
+  802adf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802ae2:	53                   	push   %ebx
+  802ae3:	e8 c5 0b 00 00       	call   8036ad <pageref>
+  802ae8:	89 c2                	mov    %eax,%edx
+  802aea:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802aed:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802af2:	83 fa 01             	cmp    $0x1,%edx
+  802af5:	74 05                	je     802afc <devsock_close+0x24>
+}
+  802af7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802afa:	c9                   	leave
+  802afb:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802afc:	83 ec 0c             	sub    $0xc,%esp
+  802aff:	ff 73 0c             	push   0xc(%ebx)
+  802b02:	e8 b7 02 00 00       	call   802dbe <nsipc_close>
+  802b07:	83 c4 10             	add    $0x10,%esp
+  802b0a:	eb eb                	jmp    802af7 <devsock_close+0x1f>
+
+00802b0c <devsock_write>:
+{
+  802b0c:	55                   	push   %ebp
+  802b0d:	89 e5                	mov    %esp,%ebp
+  802b0f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b12:	6a 00                	push   $0x0
+  802b14:	ff 75 10             	push   0x10(%ebp)
+  802b17:	ff 75 0c             	push   0xc(%ebp)
+  802b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b1d:	ff 70 0c             	push   0xc(%eax)
+  802b20:	e8 79 03 00 00       	call   802e9e <nsipc_send>
+}
+  802b25:	c9                   	leave
+  802b26:	c3                   	ret
+
+00802b27 <devsock_read>:
+{
+  802b27:	55                   	push   %ebp
+  802b28:	89 e5                	mov    %esp,%ebp
+  802b2a:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802b2d:	6a 00                	push   $0x0
+  802b2f:	ff 75 10             	push   0x10(%ebp)
+  802b32:	ff 75 0c             	push   0xc(%ebp)
+  802b35:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b38:	ff 70 0c             	push   0xc(%eax)
+  802b3b:	e8 ef 02 00 00       	call   802e2f <nsipc_recv>
+}
+  802b40:	c9                   	leave
+  802b41:	c3                   	ret
+
+00802b42 <fd2sockid>:
+{
+  802b42:	55                   	push   %ebp
+  802b43:	89 e5                	mov    %esp,%ebp
+  802b45:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802b48:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b4b:	52                   	push   %edx
+  802b4c:	50                   	push   %eax
+  802b4d:	e8 7e f7 ff ff       	call   8022d0 <fd_lookup>
+  802b52:	83 c4 10             	add    $0x10,%esp
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	78 10                	js     802b69 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802b59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b5c:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802b62:	39 08                	cmp    %ecx,(%eax)
+  802b64:	75 05                	jne    802b6b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802b66:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802b69:	c9                   	leave
+  802b6a:	c3                   	ret
+		return -E_NOT_SUPP;
+  802b6b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802b70:	eb f7                	jmp    802b69 <fd2sockid+0x27>
+
+00802b72 <alloc_sockfd>:
+{
+  802b72:	55                   	push   %ebp
+  802b73:	89 e5                	mov    %esp,%ebp
+  802b75:	56                   	push   %esi
+  802b76:	53                   	push   %ebx
+  802b77:	83 ec 1c             	sub    $0x1c,%esp
+  802b7a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b7c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b7f:	50                   	push   %eax
+  802b80:	e8 f5 f6 ff ff       	call   80227a <fd_alloc>
+  802b85:	89 c3                	mov    %eax,%ebx
+  802b87:	83 c4 10             	add    $0x10,%esp
+  802b8a:	85 c0                	test   %eax,%eax
+  802b8c:	78 43                	js     802bd1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b8e:	83 ec 04             	sub    $0x4,%esp
+  802b91:	68 07 04 00 00       	push   $0x407
+  802b96:	ff 75 f4             	push   -0xc(%ebp)
+  802b99:	6a 00                	push   $0x0
+  802b9b:	e8 35 e5 ff ff       	call   8010d5 <sys_page_alloc>
+  802ba0:	89 c3                	mov    %eax,%ebx
+  802ba2:	83 c4 10             	add    $0x10,%esp
+  802ba5:	85 c0                	test   %eax,%eax
+  802ba7:	78 28                	js     802bd1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802ba9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bac:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802bb2:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802bb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bb7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802bbe:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802bc1:	83 ec 0c             	sub    $0xc,%esp
+  802bc4:	50                   	push   %eax
+  802bc5:	e8 89 f6 ff ff       	call   802253 <fd2num>
+  802bca:	89 c3                	mov    %eax,%ebx
+  802bcc:	83 c4 10             	add    $0x10,%esp
+  802bcf:	eb 0c                	jmp    802bdd <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802bd1:	83 ec 0c             	sub    $0xc,%esp
+  802bd4:	56                   	push   %esi
+  802bd5:	e8 e4 01 00 00       	call   802dbe <nsipc_close>
+		return r;
+  802bda:	83 c4 10             	add    $0x10,%esp
+}
+  802bdd:	89 d8                	mov    %ebx,%eax
+  802bdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be2:	5b                   	pop    %ebx
+  802be3:	5e                   	pop    %esi
+  802be4:	5d                   	pop    %ebp
+  802be5:	c3                   	ret
+
+00802be6 <accept>:
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bec:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bef:	e8 4e ff ff ff       	call   802b42 <fd2sockid>
+  802bf4:	85 c0                	test   %eax,%eax
+  802bf6:	78 1b                	js     802c13 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802bf8:	83 ec 04             	sub    $0x4,%esp
+  802bfb:	ff 75 10             	push   0x10(%ebp)
+  802bfe:	ff 75 0c             	push   0xc(%ebp)
+  802c01:	50                   	push   %eax
+  802c02:	e8 0e 01 00 00       	call   802d15 <nsipc_accept>
+  802c07:	83 c4 10             	add    $0x10,%esp
+  802c0a:	85 c0                	test   %eax,%eax
+  802c0c:	78 05                	js     802c13 <accept+0x2d>
+	return alloc_sockfd(r);
+  802c0e:	e8 5f ff ff ff       	call   802b72 <alloc_sockfd>
+}
+  802c13:	c9                   	leave
+  802c14:	c3                   	ret
+
+00802c15 <bind>:
+{
+  802c15:	55                   	push   %ebp
+  802c16:	89 e5                	mov    %esp,%ebp
+  802c18:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1e:	e8 1f ff ff ff       	call   802b42 <fd2sockid>
+  802c23:	85 c0                	test   %eax,%eax
+  802c25:	78 12                	js     802c39 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c27:	83 ec 04             	sub    $0x4,%esp
+  802c2a:	ff 75 10             	push   0x10(%ebp)
+  802c2d:	ff 75 0c             	push   0xc(%ebp)
+  802c30:	50                   	push   %eax
+  802c31:	e8 31 01 00 00       	call   802d67 <nsipc_bind>
+  802c36:	83 c4 10             	add    $0x10,%esp
+}
+  802c39:	c9                   	leave
+  802c3a:	c3                   	ret
+
+00802c3b <shutdown>:
+{
+  802c3b:	55                   	push   %ebp
+  802c3c:	89 e5                	mov    %esp,%ebp
+  802c3e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c44:	e8 f9 fe ff ff       	call   802b42 <fd2sockid>
+  802c49:	85 c0                	test   %eax,%eax
+  802c4b:	78 0f                	js     802c5c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c4d:	83 ec 08             	sub    $0x8,%esp
+  802c50:	ff 75 0c             	push   0xc(%ebp)
+  802c53:	50                   	push   %eax
+  802c54:	e8 43 01 00 00       	call   802d9c <nsipc_shutdown>
+  802c59:	83 c4 10             	add    $0x10,%esp
+}
+  802c5c:	c9                   	leave
+  802c5d:	c3                   	ret
+
+00802c5e <connect>:
+{
+  802c5e:	55                   	push   %ebp
+  802c5f:	89 e5                	mov    %esp,%ebp
+  802c61:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c67:	e8 d6 fe ff ff       	call   802b42 <fd2sockid>
+  802c6c:	85 c0                	test   %eax,%eax
+  802c6e:	78 12                	js     802c82 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c70:	83 ec 04             	sub    $0x4,%esp
+  802c73:	ff 75 10             	push   0x10(%ebp)
+  802c76:	ff 75 0c             	push   0xc(%ebp)
+  802c79:	50                   	push   %eax
+  802c7a:	e8 59 01 00 00       	call   802dd8 <nsipc_connect>
+  802c7f:	83 c4 10             	add    $0x10,%esp
+}
+  802c82:	c9                   	leave
+  802c83:	c3                   	ret
+
+00802c84 <listen>:
+{
+  802c84:	55                   	push   %ebp
+  802c85:	89 e5                	mov    %esp,%ebp
+  802c87:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c8d:	e8 b0 fe ff ff       	call   802b42 <fd2sockid>
+  802c92:	85 c0                	test   %eax,%eax
+  802c94:	78 0f                	js     802ca5 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c96:	83 ec 08             	sub    $0x8,%esp
+  802c99:	ff 75 0c             	push   0xc(%ebp)
+  802c9c:	50                   	push   %eax
+  802c9d:	e8 6b 01 00 00       	call   802e0d <nsipc_listen>
+  802ca2:	83 c4 10             	add    $0x10,%esp
+}
+  802ca5:	c9                   	leave
+  802ca6:	c3                   	ret
+
+00802ca7 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802ca7:	55                   	push   %ebp
+  802ca8:	89 e5                	mov    %esp,%ebp
+  802caa:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802cad:	ff 75 10             	push   0x10(%ebp)
+  802cb0:	ff 75 0c             	push   0xc(%ebp)
+  802cb3:	ff 75 08             	push   0x8(%ebp)
+  802cb6:	e8 41 02 00 00       	call   802efc <nsipc_socket>
+  802cbb:	83 c4 10             	add    $0x10,%esp
+  802cbe:	85 c0                	test   %eax,%eax
+  802cc0:	78 05                	js     802cc7 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802cc2:	e8 ab fe ff ff       	call   802b72 <alloc_sockfd>
+}
+  802cc7:	c9                   	leave
+  802cc8:	c3                   	ret
+
+00802cc9 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802cc9:	55                   	push   %ebp
+  802cca:	89 e5                	mov    %esp,%ebp
+  802ccc:	53                   	push   %ebx
+  802ccd:	83 ec 04             	sub    $0x4,%esp
+  802cd0:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802cd2:	83 3d 04 60 80 01 00 	cmpl   $0x0,0x1806004
+  802cd9:	74 26                	je     802d01 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802cdb:	6a 07                	push   $0x7
+  802cdd:	68 00 80 80 01       	push   $0x1808000
+  802ce2:	53                   	push   %ebx
+  802ce3:	ff 35 04 60 80 01    	push   0x1806004
+  802ce9:	e8 2c 09 00 00       	call   80361a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802cee:	83 c4 0c             	add    $0xc,%esp
+  802cf1:	6a 00                	push   $0x0
+  802cf3:	6a 00                	push   $0x0
+  802cf5:	6a 00                	push   $0x0
+  802cf7:	e8 06 09 00 00       	call   803602 <ipc_recv>
+}
+  802cfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cff:	c9                   	leave
+  802d00:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d01:	83 ec 0c             	sub    $0xc,%esp
+  802d04:	6a 02                	push   $0x2
+  802d06:	e8 63 09 00 00       	call   80366e <ipc_find_env>
+  802d0b:	a3 04 60 80 01       	mov    %eax,0x1806004
+  802d10:	83 c4 10             	add    $0x10,%esp
+  802d13:	eb c6                	jmp    802cdb <nsipc+0x12>
+
+00802d15 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d15:	55                   	push   %ebp
+  802d16:	89 e5                	mov    %esp,%ebp
+  802d18:	56                   	push   %esi
+  802d19:	53                   	push   %ebx
+  802d1a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d20:	a3 00 80 80 01       	mov    %eax,0x1808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d25:	8b 06                	mov    (%esi),%eax
+  802d27:	a3 04 80 80 01       	mov    %eax,0x1808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802d2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d31:	e8 93 ff ff ff       	call   802cc9 <nsipc>
+  802d36:	89 c3                	mov    %eax,%ebx
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	79 09                	jns    802d45 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d3c:	89 d8                	mov    %ebx,%eax
+  802d3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d41:	5b                   	pop    %ebx
+  802d42:	5e                   	pop    %esi
+  802d43:	5d                   	pop    %ebp
+  802d44:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d45:	83 ec 04             	sub    $0x4,%esp
+  802d48:	ff 35 10 80 80 01    	push   0x1808010
+  802d4e:	68 00 80 80 01       	push   $0x1808000
+  802d53:	ff 75 0c             	push   0xc(%ebp)
+  802d56:	e8 08 e0 ff ff       	call   800d63 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d5b:	a1 10 80 80 01       	mov    0x1808010,%eax
+  802d60:	89 06                	mov    %eax,(%esi)
+  802d62:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d65:	eb d5                	jmp    802d3c <nsipc_accept+0x27>
+
+00802d67 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d67:	55                   	push   %ebp
+  802d68:	89 e5                	mov    %esp,%ebp
+  802d6a:	53                   	push   %ebx
+  802d6b:	83 ec 08             	sub    $0x8,%esp
+  802d6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d74:	a3 00 80 80 01       	mov    %eax,0x1808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d79:	53                   	push   %ebx
+  802d7a:	ff 75 0c             	push   0xc(%ebp)
+  802d7d:	68 04 80 80 01       	push   $0x1808004
+  802d82:	e8 dc df ff ff       	call   800d63 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d87:	89 1d 14 80 80 01    	mov    %ebx,0x1808014
+	return nsipc(NSREQ_BIND);
+  802d8d:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d92:	e8 32 ff ff ff       	call   802cc9 <nsipc>
+}
+  802d97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d9a:	c9                   	leave
+  802d9b:	c3                   	ret
+
+00802d9c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d9c:	55                   	push   %ebp
+  802d9d:	89 e5                	mov    %esp,%ebp
+  802d9f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802da2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802da5:	a3 00 80 80 01       	mov    %eax,0x1808000
+	nsipcbuf.shutdown.req_how = how;
+  802daa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802dad:	a3 04 80 80 01       	mov    %eax,0x1808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802db2:	b8 03 00 00 00       	mov    $0x3,%eax
+  802db7:	e8 0d ff ff ff       	call   802cc9 <nsipc>
+}
+  802dbc:	c9                   	leave
+  802dbd:	c3                   	ret
+
+00802dbe <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802dbe:	55                   	push   %ebp
+  802dbf:	89 e5                	mov    %esp,%ebp
+  802dc1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802dc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc7:	a3 00 80 80 01       	mov    %eax,0x1808000
+	return nsipc(NSREQ_CLOSE);
+  802dcc:	b8 04 00 00 00       	mov    $0x4,%eax
+  802dd1:	e8 f3 fe ff ff       	call   802cc9 <nsipc>
+}
+  802dd6:	c9                   	leave
+  802dd7:	c3                   	ret
+
+00802dd8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	53                   	push   %ebx
+  802ddc:	83 ec 08             	sub    $0x8,%esp
+  802ddf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802de2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802de5:	a3 00 80 80 01       	mov    %eax,0x1808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802dea:	53                   	push   %ebx
+  802deb:	ff 75 0c             	push   0xc(%ebp)
+  802dee:	68 04 80 80 01       	push   $0x1808004
+  802df3:	e8 6b df ff ff       	call   800d63 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802df8:	89 1d 14 80 80 01    	mov    %ebx,0x1808014
+	return nsipc(NSREQ_CONNECT);
+  802dfe:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e03:	e8 c1 fe ff ff       	call   802cc9 <nsipc>
+}
+  802e08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e0b:	c9                   	leave
+  802e0c:	c3                   	ret
+
+00802e0d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e0d:	55                   	push   %ebp
+  802e0e:	89 e5                	mov    %esp,%ebp
+  802e10:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e13:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e16:	a3 00 80 80 01       	mov    %eax,0x1808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e1e:	a3 04 80 80 01       	mov    %eax,0x1808004
+	return nsipc(NSREQ_LISTEN);
+  802e23:	b8 06 00 00 00       	mov    $0x6,%eax
+  802e28:	e8 9c fe ff ff       	call   802cc9 <nsipc>
+}
+  802e2d:	c9                   	leave
+  802e2e:	c3                   	ret
+
+00802e2f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e2f:	55                   	push   %ebp
+  802e30:	89 e5                	mov    %esp,%ebp
+  802e32:	56                   	push   %esi
+  802e33:	53                   	push   %ebx
+  802e34:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e37:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e3a:	a3 00 80 80 01       	mov    %eax,0x1808000
+	nsipcbuf.recv.req_len = len;
+  802e3f:	89 35 04 80 80 01    	mov    %esi,0x1808004
+	nsipcbuf.recv.req_flags = flags;
+  802e45:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e48:	a3 08 80 80 01       	mov    %eax,0x1808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e4d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e52:	e8 72 fe ff ff       	call   802cc9 <nsipc>
+  802e57:	89 c3                	mov    %eax,%ebx
+  802e59:	85 c0                	test   %eax,%eax
+  802e5b:	78 22                	js     802e7f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e5d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e62:	39 c6                	cmp    %eax,%esi
+  802e64:	0f 4e c6             	cmovle %esi,%eax
+  802e67:	39 c3                	cmp    %eax,%ebx
+  802e69:	7f 1d                	jg     802e88 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e6b:	83 ec 04             	sub    $0x4,%esp
+  802e6e:	53                   	push   %ebx
+  802e6f:	68 00 80 80 01       	push   $0x1808000
+  802e74:	ff 75 0c             	push   0xc(%ebp)
+  802e77:	e8 e7 de ff ff       	call   800d63 <memmove>
+  802e7c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e7f:	89 d8                	mov    %ebx,%eax
+  802e81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e84:	5b                   	pop    %ebx
+  802e85:	5e                   	pop    %esi
+  802e86:	5d                   	pop    %ebp
+  802e87:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e88:	68 56 3f 80 00       	push   $0x803f56
+  802e8d:	68 0b 39 80 00       	push   $0x80390b
+  802e92:	6a 62                	push   $0x62
+  802e94:	68 6b 3f 80 00       	push   $0x803f6b
+  802e99:	e8 1c d6 ff ff       	call   8004ba <_panic>
+
+00802e9e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e9e:	55                   	push   %ebp
+  802e9f:	89 e5                	mov    %esp,%ebp
+  802ea1:	53                   	push   %ebx
+  802ea2:	83 ec 04             	sub    $0x4,%esp
+  802ea5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ea8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eab:	a3 00 80 80 01       	mov    %eax,0x1808000
+	assert(size < 1600);
+  802eb0:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802eb6:	7f 2e                	jg     802ee6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802eb8:	83 ec 04             	sub    $0x4,%esp
+  802ebb:	53                   	push   %ebx
+  802ebc:	ff 75 0c             	push   0xc(%ebp)
+  802ebf:	68 0c 80 80 01       	push   $0x180800c
+  802ec4:	e8 9a de ff ff       	call   800d63 <memmove>
+	nsipcbuf.send.req_size = size;
+  802ec9:	89 1d 04 80 80 01    	mov    %ebx,0x1808004
+	nsipcbuf.send.req_flags = flags;
+  802ecf:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ed2:	a3 08 80 80 01       	mov    %eax,0x1808008
+	return nsipc(NSREQ_SEND);
+  802ed7:	b8 08 00 00 00       	mov    $0x8,%eax
+  802edc:	e8 e8 fd ff ff       	call   802cc9 <nsipc>
+}
+  802ee1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ee4:	c9                   	leave
+  802ee5:	c3                   	ret
+	assert(size < 1600);
+  802ee6:	68 77 3f 80 00       	push   $0x803f77
+  802eeb:	68 0b 39 80 00       	push   $0x80390b
+  802ef0:	6a 6d                	push   $0x6d
+  802ef2:	68 6b 3f 80 00       	push   $0x803f6b
+  802ef7:	e8 be d5 ff ff       	call   8004ba <_panic>
+
+00802efc <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802efc:	55                   	push   %ebp
+  802efd:	89 e5                	mov    %esp,%ebp
+  802eff:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f05:	a3 00 80 80 01       	mov    %eax,0x1808000
+	nsipcbuf.socket.req_type = type;
+  802f0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f0d:	a3 04 80 80 01       	mov    %eax,0x1808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f12:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f15:	a3 08 80 80 01       	mov    %eax,0x1808008
+	return nsipc(NSREQ_SOCKET);
+  802f1a:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f1f:	e8 a5 fd ff ff       	call   802cc9 <nsipc>
+}
+  802f24:	c9                   	leave
+  802f25:	c3                   	ret
+
+00802f26 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f26:	55                   	push   %ebp
+  802f27:	89 e5                	mov    %esp,%ebp
+  802f29:	56                   	push   %esi
+  802f2a:	53                   	push   %ebx
+  802f2b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f2e:	83 ec 0c             	sub    $0xc,%esp
+  802f31:	ff 75 08             	push   0x8(%ebp)
+  802f34:	e8 2a f3 ff ff       	call   802263 <fd2data>
+  802f39:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802f3b:	83 c4 08             	add    $0x8,%esp
+  802f3e:	68 83 3f 80 00       	push   $0x803f83
+  802f43:	53                   	push   %ebx
+  802f44:	e8 94 dc ff ff       	call   800bdd <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802f49:	8b 46 04             	mov    0x4(%esi),%eax
+  802f4c:	2b 06                	sub    (%esi),%eax
+  802f4e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802f54:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802f5b:	00 00 00 
+	stat->st_dev = &devpipe;
+  802f5e:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  802f65:	50 80 00 
+	return 0;
+}
+  802f68:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f70:	5b                   	pop    %ebx
+  802f71:	5e                   	pop    %esi
+  802f72:	5d                   	pop    %ebp
+  802f73:	c3                   	ret
+
+00802f74 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802f74:	55                   	push   %ebp
+  802f75:	89 e5                	mov    %esp,%ebp
+  802f77:	53                   	push   %ebx
+  802f78:	83 ec 0c             	sub    $0xc,%esp
+  802f7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f7e:	53                   	push   %ebx
+  802f7f:	6a 00                	push   $0x0
+  802f81:	e8 2a e2 ff ff       	call   8011b0 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f86:	89 1c 24             	mov    %ebx,(%esp)
+  802f89:	e8 d5 f2 ff ff       	call   802263 <fd2data>
+  802f8e:	83 c4 08             	add    $0x8,%esp
+  802f91:	50                   	push   %eax
+  802f92:	6a 00                	push   $0x0
+  802f94:	e8 17 e2 ff ff       	call   8011b0 <sys_page_unmap>
+}
+  802f99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f9c:	c9                   	leave
+  802f9d:	c3                   	ret
+
+00802f9e <_pipeisclosed>:
+{
+  802f9e:	55                   	push   %ebp
+  802f9f:	89 e5                	mov    %esp,%ebp
+  802fa1:	57                   	push   %edi
+  802fa2:	56                   	push   %esi
+  802fa3:	53                   	push   %ebx
+  802fa4:	83 ec 1c             	sub    $0x1c,%esp
+  802fa7:	89 c7                	mov    %eax,%edi
+  802fa9:	89 d6                	mov    %edx,%esi
+  802fab:	eb 3c                	jmp    802fe9 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802fad:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802fb0:	83 ec 0c             	sub    $0xc,%esp
+  802fb3:	57                   	push   %edi
+  802fb4:	e8 f4 06 00 00       	call   8036ad <pageref>
+  802fb9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fbc:	89 34 24             	mov    %esi,(%esp)
+  802fbf:	e8 e9 06 00 00       	call   8036ad <pageref>
+  802fc4:	89 c2                	mov    %eax,%edx
+  802fc6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fc8:	05 00 00 00 20       	add    $0x20000000,%eax
+  802fcd:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802fd0:	8b 0d 08 60 80 01    	mov    0x1806008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fd6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802fdb:	76 31                	jbe    80300e <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802fdd:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802fe0:	39 c3                	cmp    %eax,%ebx
+  802fe2:	74 76                	je     80305a <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802fe4:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802fe7:	74 36                	je     80301f <_pipeisclosed+0x81>
+  802fe9:	89 e0                	mov    %esp,%eax
+  802feb:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ff0:	8b 15 08 60 80 01    	mov    0x1806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ff6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ffb:	77 b0                	ja     802fad <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ffd:	c1 e8 10             	shr    $0x10,%eax
+  803000:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803006:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80300c:	eb 9f                	jmp    802fad <_pipeisclosed+0xf>
+  80300e:	c1 e8 10             	shr    $0x10,%eax
+  803011:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803017:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80301d:	eb be                	jmp    802fdd <_pipeisclosed+0x3f>
+  80301f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803021:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803026:	8b 15 08 60 80 01    	mov    0x1806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80302c:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803031:	76 16                	jbe    803049 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803033:	8b 42 58             	mov    0x58(%edx),%eax
+  803036:	6a 01                	push   $0x1
+  803038:	50                   	push   %eax
+  803039:	53                   	push   %ebx
+  80303a:	68 8a 3f 80 00       	push   $0x803f8a
+  80303f:	e8 51 d5 ff ff       	call   800595 <cprintf>
+  803044:	83 c4 10             	add    $0x10,%esp
+  803047:	eb a0                	jmp    802fe9 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803049:	c1 e8 10             	shr    $0x10,%eax
+  80304c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803052:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803058:	eb d9                	jmp    803033 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80305a:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80305d:	0f 94 c0             	sete   %al
+  803060:	0f b6 c0             	movzbl %al,%eax
+}
+  803063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803066:	5b                   	pop    %ebx
+  803067:	5e                   	pop    %esi
+  803068:	5f                   	pop    %edi
+  803069:	5d                   	pop    %ebp
+  80306a:	c3                   	ret
+
+0080306b <devpipe_write>:
+{
+  80306b:	55                   	push   %ebp
+  80306c:	89 e5                	mov    %esp,%ebp
+  80306e:	57                   	push   %edi
+  80306f:	56                   	push   %esi
+  803070:	53                   	push   %ebx
+  803071:	83 ec 28             	sub    $0x28,%esp
+  803074:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803077:	56                   	push   %esi
+  803078:	e8 e6 f1 ff ff       	call   802263 <fd2data>
+  80307d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80307f:	83 c4 10             	add    $0x10,%esp
+  803082:	bf 00 00 00 00       	mov    $0x0,%edi
+  803087:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80308a:	75 09                	jne    803095 <devpipe_write+0x2a>
+	return i;
+  80308c:	89 f8                	mov    %edi,%eax
+  80308e:	eb 23                	jmp    8030b3 <devpipe_write+0x48>
+			sys_yield();
+  803090:	e8 fa df ff ff       	call   80108f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803095:	8b 43 04             	mov    0x4(%ebx),%eax
+  803098:	8b 0b                	mov    (%ebx),%ecx
+  80309a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80309d:	39 d0                	cmp    %edx,%eax
+  80309f:	72 1a                	jb     8030bb <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8030a1:	89 da                	mov    %ebx,%edx
+  8030a3:	89 f0                	mov    %esi,%eax
+  8030a5:	e8 f4 fe ff ff       	call   802f9e <_pipeisclosed>
+  8030aa:	85 c0                	test   %eax,%eax
+  8030ac:	74 e2                	je     803090 <devpipe_write+0x25>
+				return 0;
+  8030ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030b6:	5b                   	pop    %ebx
+  8030b7:	5e                   	pop    %esi
+  8030b8:	5f                   	pop    %edi
+  8030b9:	5d                   	pop    %ebp
+  8030ba:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030be:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030c2:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030c5:	89 c2                	mov    %eax,%edx
+  8030c7:	c1 fa 1f             	sar    $0x1f,%edx
+  8030ca:	89 d1                	mov    %edx,%ecx
+  8030cc:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030cf:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030d2:	83 e2 1f             	and    $0x1f,%edx
+  8030d5:	29 ca                	sub    %ecx,%edx
+  8030d7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030db:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8030df:	83 c0 01             	add    $0x1,%eax
+  8030e2:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030e5:	83 c7 01             	add    $0x1,%edi
+  8030e8:	eb 9d                	jmp    803087 <devpipe_write+0x1c>
+
+008030ea <devpipe_read>:
+{
+  8030ea:	55                   	push   %ebp
+  8030eb:	89 e5                	mov    %esp,%ebp
+  8030ed:	57                   	push   %edi
+  8030ee:	56                   	push   %esi
+  8030ef:	53                   	push   %ebx
+  8030f0:	83 ec 18             	sub    $0x18,%esp
+  8030f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8030f6:	57                   	push   %edi
+  8030f7:	e8 67 f1 ff ff       	call   802263 <fd2data>
+  8030fc:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8030fe:	83 c4 10             	add    $0x10,%esp
+  803101:	be 00 00 00 00       	mov    $0x0,%esi
+  803106:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803109:	75 13                	jne    80311e <devpipe_read+0x34>
+	return i;
+  80310b:	89 f0                	mov    %esi,%eax
+  80310d:	eb 02                	jmp    803111 <devpipe_read+0x27>
+				return i;
+  80310f:	89 f0                	mov    %esi,%eax
+}
+  803111:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803114:	5b                   	pop    %ebx
+  803115:	5e                   	pop    %esi
+  803116:	5f                   	pop    %edi
+  803117:	5d                   	pop    %ebp
+  803118:	c3                   	ret
+			sys_yield();
+  803119:	e8 71 df ff ff       	call   80108f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80311e:	8b 03                	mov    (%ebx),%eax
+  803120:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803123:	75 18                	jne    80313d <devpipe_read+0x53>
+			if (i > 0)
+  803125:	85 f6                	test   %esi,%esi
+  803127:	75 e6                	jne    80310f <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803129:	89 da                	mov    %ebx,%edx
+  80312b:	89 f8                	mov    %edi,%eax
+  80312d:	e8 6c fe ff ff       	call   802f9e <_pipeisclosed>
+  803132:	85 c0                	test   %eax,%eax
+  803134:	74 e3                	je     803119 <devpipe_read+0x2f>
+				return 0;
+  803136:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313b:	eb d4                	jmp    803111 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80313d:	99                   	cltd
+  80313e:	c1 ea 1b             	shr    $0x1b,%edx
+  803141:	01 d0                	add    %edx,%eax
+  803143:	83 e0 1f             	and    $0x1f,%eax
+  803146:	29 d0                	sub    %edx,%eax
+  803148:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80314d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803150:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803153:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803156:	83 c6 01             	add    $0x1,%esi
+  803159:	eb ab                	jmp    803106 <devpipe_read+0x1c>
+
+0080315b <pipe>:
+{
+  80315b:	55                   	push   %ebp
+  80315c:	89 e5                	mov    %esp,%ebp
+  80315e:	56                   	push   %esi
+  80315f:	53                   	push   %ebx
+  803160:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803163:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803166:	50                   	push   %eax
+  803167:	e8 0e f1 ff ff       	call   80227a <fd_alloc>
+  80316c:	89 c3                	mov    %eax,%ebx
+  80316e:	83 c4 10             	add    $0x10,%esp
+  803171:	85 c0                	test   %eax,%eax
+  803173:	0f 88 23 01 00 00    	js     80329c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803179:	83 ec 04             	sub    $0x4,%esp
+  80317c:	68 07 04 00 00       	push   $0x407
+  803181:	ff 75 f4             	push   -0xc(%ebp)
+  803184:	6a 00                	push   $0x0
+  803186:	e8 4a df ff ff       	call   8010d5 <sys_page_alloc>
+  80318b:	89 c3                	mov    %eax,%ebx
+  80318d:	83 c4 10             	add    $0x10,%esp
+  803190:	85 c0                	test   %eax,%eax
+  803192:	0f 88 04 01 00 00    	js     80329c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803198:	83 ec 0c             	sub    $0xc,%esp
+  80319b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80319e:	50                   	push   %eax
+  80319f:	e8 d6 f0 ff ff       	call   80227a <fd_alloc>
+  8031a4:	89 c3                	mov    %eax,%ebx
+  8031a6:	83 c4 10             	add    $0x10,%esp
+  8031a9:	85 c0                	test   %eax,%eax
+  8031ab:	0f 88 db 00 00 00    	js     80328c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031b1:	83 ec 04             	sub    $0x4,%esp
+  8031b4:	68 07 04 00 00       	push   $0x407
+  8031b9:	ff 75 f0             	push   -0x10(%ebp)
+  8031bc:	6a 00                	push   $0x0
+  8031be:	e8 12 df ff ff       	call   8010d5 <sys_page_alloc>
+  8031c3:	89 c3                	mov    %eax,%ebx
+  8031c5:	83 c4 10             	add    $0x10,%esp
+  8031c8:	85 c0                	test   %eax,%eax
+  8031ca:	0f 88 bc 00 00 00    	js     80328c <pipe+0x131>
+	va = fd2data(fd0);
+  8031d0:	83 ec 0c             	sub    $0xc,%esp
+  8031d3:	ff 75 f4             	push   -0xc(%ebp)
+  8031d6:	e8 88 f0 ff ff       	call   802263 <fd2data>
+  8031db:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031dd:	83 c4 0c             	add    $0xc,%esp
+  8031e0:	68 07 04 00 00       	push   $0x407
+  8031e5:	50                   	push   %eax
+  8031e6:	6a 00                	push   $0x0
+  8031e8:	e8 e8 de ff ff       	call   8010d5 <sys_page_alloc>
+  8031ed:	89 c3                	mov    %eax,%ebx
+  8031ef:	83 c4 10             	add    $0x10,%esp
+  8031f2:	85 c0                	test   %eax,%eax
+  8031f4:	0f 88 82 00 00 00    	js     80327c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031fa:	83 ec 0c             	sub    $0xc,%esp
+  8031fd:	ff 75 f0             	push   -0x10(%ebp)
+  803200:	e8 5e f0 ff ff       	call   802263 <fd2data>
+  803205:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80320c:	50                   	push   %eax
+  80320d:	6a 00                	push   $0x0
+  80320f:	56                   	push   %esi
+  803210:	6a 00                	push   $0x0
+  803212:	e8 2b df ff ff       	call   801142 <sys_page_map>
+  803217:	89 c3                	mov    %eax,%ebx
+  803219:	83 c4 20             	add    $0x20,%esp
+  80321c:	85 c0                	test   %eax,%eax
+  80321e:	78 4e                	js     80326e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803220:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  803225:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803228:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80322a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80322d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803234:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803237:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803239:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80323c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803243:	83 ec 0c             	sub    $0xc,%esp
+  803246:	ff 75 f4             	push   -0xc(%ebp)
+  803249:	e8 05 f0 ff ff       	call   802253 <fd2num>
+  80324e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803251:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803253:	83 c4 04             	add    $0x4,%esp
+  803256:	ff 75 f0             	push   -0x10(%ebp)
+  803259:	e8 f5 ef ff ff       	call   802253 <fd2num>
+  80325e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803261:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803264:	83 c4 10             	add    $0x10,%esp
+  803267:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80326c:	eb 2e                	jmp    80329c <pipe+0x141>
+	sys_page_unmap(0, va);
+  80326e:	83 ec 08             	sub    $0x8,%esp
+  803271:	56                   	push   %esi
+  803272:	6a 00                	push   $0x0
+  803274:	e8 37 df ff ff       	call   8011b0 <sys_page_unmap>
+  803279:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80327c:	83 ec 08             	sub    $0x8,%esp
+  80327f:	ff 75 f0             	push   -0x10(%ebp)
+  803282:	6a 00                	push   $0x0
+  803284:	e8 27 df ff ff       	call   8011b0 <sys_page_unmap>
+  803289:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80328c:	83 ec 08             	sub    $0x8,%esp
+  80328f:	ff 75 f4             	push   -0xc(%ebp)
+  803292:	6a 00                	push   $0x0
+  803294:	e8 17 df ff ff       	call   8011b0 <sys_page_unmap>
+  803299:	83 c4 10             	add    $0x10,%esp
+}
+  80329c:	89 d8                	mov    %ebx,%eax
+  80329e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032a1:	5b                   	pop    %ebx
+  8032a2:	5e                   	pop    %esi
+  8032a3:	5d                   	pop    %ebp
+  8032a4:	c3                   	ret
+
+008032a5 <pipeisclosed>:
+{
+  8032a5:	55                   	push   %ebp
+  8032a6:	89 e5                	mov    %esp,%ebp
+  8032a8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032ae:	50                   	push   %eax
+  8032af:	ff 75 08             	push   0x8(%ebp)
+  8032b2:	e8 19 f0 ff ff       	call   8022d0 <fd_lookup>
+  8032b7:	83 c4 10             	add    $0x10,%esp
+  8032ba:	85 c0                	test   %eax,%eax
+  8032bc:	78 18                	js     8032d6 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032be:	83 ec 0c             	sub    $0xc,%esp
+  8032c1:	ff 75 f4             	push   -0xc(%ebp)
+  8032c4:	e8 9a ef ff ff       	call   802263 <fd2data>
+  8032c9:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032ce:	e8 cb fc ff ff       	call   802f9e <_pipeisclosed>
+  8032d3:	83 c4 10             	add    $0x10,%esp
+}
+  8032d6:	c9                   	leave
+  8032d7:	c3                   	ret
+
+008032d8 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8032d8:	55                   	push   %ebp
+  8032d9:	89 e5                	mov    %esp,%ebp
+  8032db:	56                   	push   %esi
+  8032dc:	53                   	push   %ebx
+  8032dd:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8032e0:	85 f6                	test   %esi,%esi
+  8032e2:	74 16                	je     8032fa <wait+0x22>
+	e = &envs[ENVX(envid)];
+  8032e4:	89 f3                	mov    %esi,%ebx
+  8032e6:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8032ec:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  8032f2:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8032f8:	eb 1b                	jmp    803315 <wait+0x3d>
+	assert(envid != 0);
+  8032fa:	68 a2 3f 80 00       	push   $0x803fa2
+  8032ff:	68 0b 39 80 00       	push   $0x80390b
+  803304:	6a 09                	push   $0x9
+  803306:	68 ad 3f 80 00       	push   $0x803fad
+  80330b:	e8 aa d1 ff ff       	call   8004ba <_panic>
+		sys_yield();
+  803310:	e8 7a dd ff ff       	call   80108f <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803315:	8b 43 48             	mov    0x48(%ebx),%eax
+  803318:	39 f0                	cmp    %esi,%eax
+  80331a:	75 07                	jne    803323 <wait+0x4b>
+  80331c:	8b 43 54             	mov    0x54(%ebx),%eax
+  80331f:	85 c0                	test   %eax,%eax
+  803321:	75 ed                	jne    803310 <wait+0x38>
+}
+  803323:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803326:	5b                   	pop    %ebx
+  803327:	5e                   	pop    %esi
+  803328:	5d                   	pop    %ebp
+  803329:	c3                   	ret
+
+0080332a <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80332a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80332f:	c3                   	ret
+
+00803330 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803330:	55                   	push   %ebp
+  803331:	89 e5                	mov    %esp,%ebp
+  803333:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803336:	68 b8 3f 80 00       	push   $0x803fb8
+  80333b:	ff 75 0c             	push   0xc(%ebp)
+  80333e:	e8 9a d8 ff ff       	call   800bdd <strcpy>
+	return 0;
+}
+  803343:	b8 00 00 00 00       	mov    $0x0,%eax
+  803348:	c9                   	leave
+  803349:	c3                   	ret
+
+0080334a <devcons_write>:
+{
+  80334a:	55                   	push   %ebp
+  80334b:	89 e5                	mov    %esp,%ebp
+  80334d:	57                   	push   %edi
+  80334e:	56                   	push   %esi
+  80334f:	53                   	push   %ebx
+  803350:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803356:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80335b:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803361:	eb 2e                	jmp    803391 <devcons_write+0x47>
+		m = n - tot;
+  803363:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803366:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803368:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80336d:	39 c3                	cmp    %eax,%ebx
+  80336f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803372:	83 ec 04             	sub    $0x4,%esp
+  803375:	53                   	push   %ebx
+  803376:	89 f0                	mov    %esi,%eax
+  803378:	03 45 0c             	add    0xc(%ebp),%eax
+  80337b:	50                   	push   %eax
+  80337c:	57                   	push   %edi
+  80337d:	e8 e1 d9 ff ff       	call   800d63 <memmove>
+		sys_cputs(buf, m);
+  803382:	83 c4 08             	add    $0x8,%esp
+  803385:	53                   	push   %ebx
+  803386:	57                   	push   %edi
+  803387:	e8 ca db ff ff       	call   800f56 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80338c:	01 de                	add    %ebx,%esi
+  80338e:	83 c4 10             	add    $0x10,%esp
+  803391:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803394:	72 cd                	jb     803363 <devcons_write+0x19>
+}
+  803396:	89 f0                	mov    %esi,%eax
+  803398:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80339b:	5b                   	pop    %ebx
+  80339c:	5e                   	pop    %esi
+  80339d:	5f                   	pop    %edi
+  80339e:	5d                   	pop    %ebp
+  80339f:	c3                   	ret
+
+008033a0 <devcons_read>:
+{
+  8033a0:	55                   	push   %ebp
+  8033a1:	89 e5                	mov    %esp,%ebp
+  8033a3:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8033a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ab:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033af:	75 07                	jne    8033b8 <devcons_read+0x18>
+  8033b1:	eb 1f                	jmp    8033d2 <devcons_read+0x32>
+		sys_yield();
+  8033b3:	e8 d7 dc ff ff       	call   80108f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8033b8:	e8 dd db ff ff       	call   800f9a <sys_cgetc>
+  8033bd:	85 c0                	test   %eax,%eax
+  8033bf:	74 f2                	je     8033b3 <devcons_read+0x13>
+	if (c < 0)
+  8033c1:	78 0f                	js     8033d2 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8033c3:	83 f8 04             	cmp    $0x4,%eax
+  8033c6:	74 0c                	je     8033d4 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8033c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033cb:	88 02                	mov    %al,(%edx)
+	return 1;
+  8033cd:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8033d2:	c9                   	leave
+  8033d3:	c3                   	ret
+		return 0;
+  8033d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d9:	eb f7                	jmp    8033d2 <devcons_read+0x32>
+
+008033db <cputchar>:
+{
+  8033db:	55                   	push   %ebp
+  8033dc:	89 e5                	mov    %esp,%ebp
+  8033de:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8033e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e4:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8033e7:	6a 01                	push   $0x1
+  8033e9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033ec:	50                   	push   %eax
+  8033ed:	e8 64 db ff ff       	call   800f56 <sys_cputs>
+}
+  8033f2:	83 c4 10             	add    $0x10,%esp
+  8033f5:	c9                   	leave
+  8033f6:	c3                   	ret
+
+008033f7 <getchar>:
+{
+  8033f7:	55                   	push   %ebp
+  8033f8:	89 e5                	mov    %esp,%ebp
+  8033fa:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8033fd:	6a 01                	push   $0x1
+  8033ff:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803402:	50                   	push   %eax
+  803403:	6a 00                	push   $0x0
+  803405:	e8 4c f1 ff ff       	call   802556 <read>
+	if (r < 0)
+  80340a:	83 c4 10             	add    $0x10,%esp
+  80340d:	85 c0                	test   %eax,%eax
+  80340f:	78 06                	js     803417 <getchar+0x20>
+	if (r < 1)
+  803411:	74 06                	je     803419 <getchar+0x22>
+	return c;
+  803413:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803417:	c9                   	leave
+  803418:	c3                   	ret
+		return -E_EOF;
+  803419:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80341e:	eb f7                	jmp    803417 <getchar+0x20>
+
+00803420 <iscons>:
+{
+  803420:	55                   	push   %ebp
+  803421:	89 e5                	mov    %esp,%ebp
+  803423:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803426:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803429:	50                   	push   %eax
+  80342a:	ff 75 08             	push   0x8(%ebp)
+  80342d:	e8 9e ee ff ff       	call   8022d0 <fd_lookup>
+  803432:	83 c4 10             	add    $0x10,%esp
+  803435:	85 c0                	test   %eax,%eax
+  803437:	78 11                	js     80344a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803439:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80343c:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803442:	39 10                	cmp    %edx,(%eax)
+  803444:	0f 94 c0             	sete   %al
+  803447:	0f b6 c0             	movzbl %al,%eax
+}
+  80344a:	c9                   	leave
+  80344b:	c3                   	ret
+
+0080344c <opencons>:
+{
+  80344c:	55                   	push   %ebp
+  80344d:	89 e5                	mov    %esp,%ebp
+  80344f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803452:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803455:	50                   	push   %eax
+  803456:	e8 1f ee ff ff       	call   80227a <fd_alloc>
+  80345b:	83 c4 10             	add    $0x10,%esp
+  80345e:	85 c0                	test   %eax,%eax
+  803460:	78 3a                	js     80349c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803462:	83 ec 04             	sub    $0x4,%esp
+  803465:	68 07 04 00 00       	push   $0x407
+  80346a:	ff 75 f4             	push   -0xc(%ebp)
+  80346d:	6a 00                	push   $0x0
+  80346f:	e8 61 dc ff ff       	call   8010d5 <sys_page_alloc>
+  803474:	83 c4 10             	add    $0x10,%esp
+  803477:	85 c0                	test   %eax,%eax
+  803479:	78 21                	js     80349c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80347b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80347e:	8b 15 58 50 80 00    	mov    0x805058,%edx
+  803484:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803486:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803489:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803490:	83 ec 0c             	sub    $0xc,%esp
+  803493:	50                   	push   %eax
+  803494:	e8 ba ed ff ff       	call   802253 <fd2num>
+  803499:	83 c4 10             	add    $0x10,%esp
+}
+  80349c:	c9                   	leave
+  80349d:	c3                   	ret
+
+0080349e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80349e:	55                   	push   %ebp
+  80349f:	89 e5                	mov    %esp,%ebp
+  8034a1:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  8034a4:	83 3d 00 90 80 01 00 	cmpl   $0x0,0x1809000
+  8034ab:	74 0a                	je     8034b7 <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8034ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b0:	a3 00 90 80 01       	mov    %eax,0x1809000
+}
+  8034b5:	c9                   	leave
+  8034b6:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  8034b7:	83 ec 04             	sub    $0x4,%esp
+  8034ba:	6a 07                	push   $0x7
+  8034bc:	68 00 f0 bf ee       	push   $0xeebff000
+  8034c1:	6a 00                	push   $0x0
+  8034c3:	e8 0d dc ff ff       	call   8010d5 <sys_page_alloc>
+  8034c8:	83 c4 10             	add    $0x10,%esp
+  8034cb:	85 c0                	test   %eax,%eax
+  8034cd:	78 14                	js     8034e3 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8034cf:	83 ec 08             	sub    $0x8,%esp
+  8034d2:	68 05 35 80 00       	push   $0x803505
+  8034d7:	6a 00                	push   $0x0
+  8034d9:	e8 13 de ff ff       	call   8012f1 <sys_env_set_pgfault_upcall>
+  8034de:	83 c4 10             	add    $0x10,%esp
+  8034e1:	eb ca                	jmp    8034ad <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  8034e3:	83 ec 08             	sub    $0x8,%esp
+  8034e6:	50                   	push   %eax
+  8034e7:	68 c4 3f 80 00       	push   $0x803fc4
+  8034ec:	e8 a4 d0 ff ff       	call   800595 <cprintf>
+			panic("set_pgfault_handler error");
+  8034f1:	83 c4 0c             	add    $0xc,%esp
+  8034f4:	68 cf 3f 80 00       	push   $0x803fcf
+  8034f9:	6a 24                	push   $0x24
+  8034fb:	68 e9 3f 80 00       	push   $0x803fe9
+  803500:	e8 b5 cf ff ff       	call   8004ba <_panic>
+
+00803505 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803505:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803506:	a1 00 90 80 01       	mov    0x1809000,%eax
+	call *%eax
+  80350b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80350d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803510:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  803514:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803517:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  80351b:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  80351d:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803521:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803522:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803526:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803527:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803528:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80352c:	c3                   	ret
+
+0080352d <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  80352d:	55                   	push   %ebp
+  80352e:	89 e5                	mov    %esp,%ebp
+  803530:	56                   	push   %esi
+  803531:	53                   	push   %ebx
+  803532:	8b 75 08             	mov    0x8(%ebp),%esi
+  803535:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803538:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80353b:	85 c0                	test   %eax,%eax
+  80353d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803542:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  803545:	83 ec 08             	sub    $0x8,%esp
+  803548:	ff 75 14             	push   0x14(%ebp)
+  80354b:	50                   	push   %eax
+  80354c:	e8 95 df ff ff       	call   8014e6 <sys_ipc_recv_until>
+  803551:	83 c4 10             	add    $0x10,%esp
+  803554:	85 c0                	test   %eax,%eax
+  803556:	78 61                	js     8035b9 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  803558:	85 f6                	test   %esi,%esi
+  80355a:	74 1c                	je     803578 <ipc_recv_until+0x4b>
+  80355c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80355e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803563:	8b 15 08 60 80 01    	mov    0x1806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803569:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80356e:	76 5f                	jbe    8035cf <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  803570:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803576:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803578:	85 db                	test   %ebx,%ebx
+  80357a:	74 1c                	je     803598 <ipc_recv_until+0x6b>
+  80357c:	89 e0                	mov    %esp,%eax
+  80357e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803583:	8b 15 08 60 80 01    	mov    0x1806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803589:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80358e:	76 50                	jbe    8035e0 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  803590:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803596:	89 03                	mov    %eax,(%ebx)
+  803598:	89 e0                	mov    %esp,%eax
+  80359a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80359f:	8b 15 08 60 80 01    	mov    0x1806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8035a5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8035aa:	76 45                	jbe    8035f1 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  8035ac:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  8035b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035b5:	5b                   	pop    %ebx
+  8035b6:	5e                   	pop    %esi
+  8035b7:	5d                   	pop    %ebp
+  8035b8:	c3                   	ret
+		if (from_env_store)
+  8035b9:	85 f6                	test   %esi,%esi
+  8035bb:	74 06                	je     8035c3 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  8035bd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  8035c3:	85 db                	test   %ebx,%ebx
+  8035c5:	74 eb                	je     8035b2 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  8035c7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8035cd:	eb e3                	jmp    8035b2 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8035cf:	c1 e8 10             	shr    $0x10,%eax
+  8035d2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8035d8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8035de:	eb 90                	jmp    803570 <ipc_recv_until+0x43>
+  8035e0:	c1 e8 10             	shr    $0x10,%eax
+  8035e3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8035e9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8035ef:	eb 9f                	jmp    803590 <ipc_recv_until+0x63>
+  8035f1:	c1 e8 10             	shr    $0x10,%eax
+  8035f4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8035fa:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803600:	eb aa                	jmp    8035ac <ipc_recv_until+0x7f>
+
+00803602 <ipc_recv>:
+{
+  803602:	55                   	push   %ebp
+  803603:	89 e5                	mov    %esp,%ebp
+  803605:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803608:	6a 00                	push   $0x0
+  80360a:	ff 75 10             	push   0x10(%ebp)
+  80360d:	ff 75 0c             	push   0xc(%ebp)
+  803610:	ff 75 08             	push   0x8(%ebp)
+  803613:	e8 15 ff ff ff       	call   80352d <ipc_recv_until>
+}
+  803618:	c9                   	leave
+  803619:	c3                   	ret
+
+0080361a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80361a:	55                   	push   %ebp
+  80361b:	89 e5                	mov    %esp,%ebp
+  80361d:	57                   	push   %edi
+  80361e:	56                   	push   %esi
+  80361f:	53                   	push   %ebx
+  803620:	83 ec 0c             	sub    $0xc,%esp
+  803623:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803626:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803629:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  80362c:	85 db                	test   %ebx,%ebx
+  80362e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803633:	0f 44 d8             	cmove  %eax,%ebx
+  803636:	eb 05                	jmp    80363d <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803638:	e8 52 da ff ff       	call   80108f <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  80363d:	ff 75 14             	push   0x14(%ebp)
+  803640:	53                   	push   %ebx
+  803641:	56                   	push   %esi
+  803642:	57                   	push   %edi
+  803643:	e8 ea dd ff ff       	call   801432 <sys_ipc_try_send>
+  803648:	83 c4 10             	add    $0x10,%esp
+  80364b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80364e:	74 e8                	je     803638 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  803650:	85 c0                	test   %eax,%eax
+  803652:	78 08                	js     80365c <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  803654:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803657:	5b                   	pop    %ebx
+  803658:	5e                   	pop    %esi
+  803659:	5f                   	pop    %edi
+  80365a:	5d                   	pop    %ebp
+  80365b:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  80365c:	50                   	push   %eax
+  80365d:	68 f7 3f 80 00       	push   $0x803ff7
+  803662:	6a 4f                	push   $0x4f
+  803664:	68 0a 40 80 00       	push   $0x80400a
+  803669:	e8 4c ce ff ff       	call   8004ba <_panic>
+
+0080366e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80366e:	55                   	push   %ebp
+  80366f:	89 e5                	mov    %esp,%ebp
+  803671:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803674:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803679:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80367f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803685:	8b 52 50             	mov    0x50(%edx),%edx
+  803688:	39 ca                	cmp    %ecx,%edx
+  80368a:	74 11                	je     80369d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80368c:	83 c0 01             	add    $0x1,%eax
+  80368f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803694:	75 e3                	jne    803679 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369b:	eb 0e                	jmp    8036ab <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80369d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8036a3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036a8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8036ab:	5d                   	pop    %ebp
+  8036ac:	c3                   	ret
+
+008036ad <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8036ad:	55                   	push   %ebp
+  8036ae:	89 e5                	mov    %esp,%ebp
+  8036b0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036b3:	89 c2                	mov    %eax,%edx
+  8036b5:	c1 ea 16             	shr    $0x16,%edx
+  8036b8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8036bf:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8036c4:	f6 c1 01             	test   $0x1,%cl
+  8036c7:	74 1a                	je     8036e3 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  8036c9:	c1 e8 0c             	shr    $0xc,%eax
+  8036cc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8036d3:	a8 01                	test   $0x1,%al
+  8036d5:	74 0c                	je     8036e3 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8036d7:	c1 e8 0c             	shr    $0xc,%eax
+  8036da:	c1 e0 04             	shl    $0x4,%eax
+  8036dd:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8036e3:	89 d0                	mov    %edx,%eax
+  8036e5:	5d                   	pop    %ebp
+  8036e6:	c3                   	ret
@@ -0,0 +1,8086 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 54 04 00 00       	call   800485 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wrong>:
+	breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char buf[100];
+	int n;
+
+	seek(rfd, off);
+  800048:	53                   	push   %ebx
+  800049:	56                   	push   %esi
+  80004a:	e8 26 27 00 00       	call   802775 <seek>
+	seek(kfd, off);
+  80004f:	83 c4 08             	add    $0x8,%esp
+  800052:	53                   	push   %ebx
+  800053:	57                   	push   %edi
+  800054:	e8 1c 27 00 00       	call   802775 <seek>
+
+	cprintf("shell produced incorrect output.\n");
+  800059:	c7 04 24 60 3d 80 00 	movl   $0x803d60,(%esp)
+  800060:	e8 bf 05 00 00       	call   800624 <cprintf>
+	cprintf("expected:\n===\n");
+  800065:	c7 04 24 cb 3d 80 00 	movl   $0x803dcb,(%esp)
+  80006c:	e8 b3 05 00 00       	call   800624 <cprintf>
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800077:	eb 0d                	jmp    800086 <wrong+0x53>
+		sys_cputs(buf, n);
+  800079:	83 ec 08             	sub    $0x8,%esp
+  80007c:	50                   	push   %eax
+  80007d:	53                   	push   %ebx
+  80007e:	e8 62 0f 00 00       	call   800fe5 <sys_cputs>
+  800083:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a 63                	push   $0x63
+  80008b:	53                   	push   %ebx
+  80008c:	57                   	push   %edi
+  80008d:	e8 53 25 00 00       	call   8025e5 <read>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	7f e0                	jg     800079 <wrong+0x46>
+	cprintf("===\ngot:\n===\n");
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 da 3d 80 00       	push   $0x803dda
+  8000a1:	e8 7e 05 00 00       	call   800624 <cprintf>
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ac:	eb 0d                	jmp    8000bb <wrong+0x88>
+		sys_cputs(buf, n);
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	53                   	push   %ebx
+  8000b3:	e8 2d 0f 00 00       	call   800fe5 <sys_cputs>
+  8000b8:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	6a 63                	push   $0x63
+  8000c0:	53                   	push   %ebx
+  8000c1:	56                   	push   %esi
+  8000c2:	e8 1e 25 00 00       	call   8025e5 <read>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f e0                	jg     8000ae <wrong+0x7b>
+	cprintf("===\n");
+  8000ce:	83 ec 0c             	sub    $0xc,%esp
+  8000d1:	68 d5 3d 80 00       	push   $0x803dd5
+  8000d6:	e8 49 05 00 00       	call   800624 <cprintf>
+	exit();
+  8000db:	e8 4f 04 00 00       	call   80052f <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <umain>:
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 38             	sub    $0x38,%esp
+	close(0);
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	e8 ae 23 00 00       	call   8024a9 <close>
+	close(1);
+  8000fb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800102:	e8 a2 23 00 00       	call   8024a9 <close>
+	opencons();
+  800107:	e8 27 03 00 00       	call   800433 <opencons>
+	opencons();
+  80010c:	e8 22 03 00 00       	call   800433 <opencons>
+	if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	68 e8 3d 80 00       	push   $0x803de8
+  80011b:	e8 88 29 00 00       	call   802aa8 <open>
+  800120:	89 c3                	mov    %eax,%ebx
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 e7 00 00 00    	js     800214 <umain+0x129>
+	if ((wfd = pipe(pfds)) < 0)
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800133:	50                   	push   %eax
+  800134:	e8 fb 37 00 00       	call   803934 <pipe>
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	0f 88 e2 00 00 00    	js     800226 <umain+0x13b>
+	wfd = pfds[1];
+  800144:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	cprintf("running sh -x < testshell.sh | cat\n");
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	68 84 3d 80 00       	push   $0x803d84
+  80014f:	e8 d0 04 00 00       	call   800624 <cprintf>
+	if ((r = fork()) < 0)
+  800154:	e8 f6 1e 00 00       	call   80204f <fork>
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	0f 88 d4 00 00 00    	js     800238 <umain+0x14d>
+	if (r == 0) {
+  800164:	75 6f                	jne    8001d5 <umain+0xea>
+		dup(rfd, 0);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	53                   	push   %ebx
+  80016c:	e8 8a 23 00 00       	call   8024fb <dup>
+		dup(wfd, 1);
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	6a 01                	push   $0x1
+  800176:	56                   	push   %esi
+  800177:	e8 7f 23 00 00       	call   8024fb <dup>
+		close(rfd);
+  80017c:	89 1c 24             	mov    %ebx,(%esp)
+  80017f:	e8 25 23 00 00       	call   8024a9 <close>
+		close(wfd);
+  800184:	89 34 24             	mov    %esi,(%esp)
+  800187:	e8 1d 23 00 00       	call   8024a9 <close>
+		if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  80018c:	6a 00                	push   $0x0
+  80018e:	68 25 3e 80 00       	push   $0x803e25
+  800193:	68 f2 3d 80 00       	push   $0x803df2
+  800198:	68 28 3e 80 00       	push   $0x803e28
+  80019d:	e8 81 30 00 00       	call   803223 <spawnl>
+  8001a2:	89 c7                	mov    %eax,%edi
+  8001a4:	83 c4 20             	add    $0x20,%esp
+  8001a7:	85 c0                	test   %eax,%eax
+  8001a9:	0f 88 9b 00 00 00    	js     80024a <umain+0x15f>
+		close(0);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	6a 00                	push   $0x0
+  8001b4:	e8 f0 22 00 00       	call   8024a9 <close>
+		close(1);
+  8001b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c0:	e8 e4 22 00 00       	call   8024a9 <close>
+		wait(r);
+  8001c5:	89 3c 24             	mov    %edi,(%esp)
+  8001c8:	e8 e4 38 00 00       	call   803ab1 <wait>
+		exit();
+  8001cd:	e8 5d 03 00 00       	call   80052f <exit>
+  8001d2:	83 c4 10             	add    $0x10,%esp
+	close(rfd);
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 cb 22 00 00       	call   8024a9 <close>
+	close(wfd);
+  8001de:	89 34 24             	mov    %esi,(%esp)
+  8001e1:	e8 c3 22 00 00       	call   8024a9 <close>
+	rfd = pfds[0];
+  8001e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8001e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	68 36 3e 80 00       	push   $0x803e36
+  8001f6:	e8 ad 28 00 00       	call   802aa8 <open>
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	85 c0                	test   %eax,%eax
+  800200:	78 5a                	js     80025c <umain+0x171>
+  800202:	be 01 00 00 00       	mov    $0x1,%esi
+	nloff = 0;
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+		n2 = read(kfd, &c2, 1);
+  80020c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80020f:	e9 9a 00 00 00       	jmp    8002ae <umain+0x1c3>
+		panic("open testshell.sh: %e", rfd);
+  800214:	50                   	push   %eax
+  800215:	68 f5 3d 80 00       	push   $0x803df5
+  80021a:	6a 13                	push   $0x13
+  80021c:	68 0b 3e 80 00       	push   $0x803e0b
+  800221:	e8 23 03 00 00       	call   800549 <_panic>
+		panic("pipe: %e", wfd);
+  800226:	50                   	push   %eax
+  800227:	68 1c 3e 80 00       	push   $0x803e1c
+  80022c:	6a 15                	push   $0x15
+  80022e:	68 0b 3e 80 00       	push   $0x803e0b
+  800233:	e8 11 03 00 00       	call   800549 <_panic>
+		panic("fork: %e", r);
+  800238:	50                   	push   %eax
+  800239:	68 10 43 80 00       	push   $0x804310
+  80023e:	6a 1a                	push   $0x1a
+  800240:	68 0b 3e 80 00       	push   $0x803e0b
+  800245:	e8 ff 02 00 00       	call   800549 <_panic>
+			panic("spawn: %e", r);
+  80024a:	50                   	push   %eax
+  80024b:	68 2c 3e 80 00       	push   $0x803e2c
+  800250:	6a 21                	push   $0x21
+  800252:	68 0b 3e 80 00       	push   $0x803e0b
+  800257:	e8 ed 02 00 00       	call   800549 <_panic>
+		panic("open testshell.key for reading: %e", kfd);
+  80025c:	50                   	push   %eax
+  80025d:	68 a8 3d 80 00       	push   $0x803da8
+  800262:	6a 2c                	push   $0x2c
+  800264:	68 0b 3e 80 00       	push   $0x803e0b
+  800269:	e8 db 02 00 00       	call   800549 <_panic>
+			panic("reading testshell.out: %e", n1);
+  80026e:	53                   	push   %ebx
+  80026f:	68 44 3e 80 00       	push   $0x803e44
+  800274:	6a 33                	push   $0x33
+  800276:	68 0b 3e 80 00       	push   $0x803e0b
+  80027b:	e8 c9 02 00 00       	call   800549 <_panic>
+			panic("reading testshell.key: %e", n2);
+  800280:	50                   	push   %eax
+  800281:	68 5e 3e 80 00       	push   $0x803e5e
+  800286:	6a 35                	push   $0x35
+  800288:	68 0b 3e 80 00       	push   $0x803e0b
+  80028d:	e8 b7 02 00 00       	call   800549 <_panic>
+			wrong(rfd, kfd, nloff);
+  800292:	83 ec 04             	sub    $0x4,%esp
+  800295:	57                   	push   %edi
+  800296:	ff 75 d0             	push   -0x30(%ebp)
+  800299:	ff 75 d4             	push   -0x2c(%ebp)
+  80029c:	e8 92 fd ff ff       	call   800033 <wrong>
+  8002a1:	83 c4 10             	add    $0x10,%esp
+			nloff = off+1;
+  8002a4:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002a8:	0f 44 fe             	cmove  %esi,%edi
+	for (off=0;; off++) {
+  8002ab:	83 c6 01             	add    $0x1,%esi
+		n1 = read(rfd, &c1, 1);
+  8002ae:	83 ec 04             	sub    $0x4,%esp
+  8002b1:	6a 01                	push   $0x1
+  8002b3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8002ba:	e8 26 23 00 00       	call   8025e5 <read>
+  8002bf:	89 c3                	mov    %eax,%ebx
+		n2 = read(kfd, &c2, 1);
+  8002c1:	83 c4 0c             	add    $0xc,%esp
+  8002c4:	6a 01                	push   $0x1
+  8002c6:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff 75 d0             	push   -0x30(%ebp)
+  8002cd:	e8 13 23 00 00       	call   8025e5 <read>
+		if (n1 < 0)
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 db                	test   %ebx,%ebx
+  8002d7:	78 95                	js     80026e <umain+0x183>
+		if (n2 < 0)
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	78 a3                	js     800280 <umain+0x195>
+		if (n1 == 0 && n2 == 0)
+  8002dd:	89 d9                	mov    %ebx,%ecx
+  8002df:	09 c1                	or     %eax,%ecx
+  8002e1:	74 15                	je     8002f8 <umain+0x20d>
+		if (n1 != 1 || n2 != 1 || c1 != c2)
+  8002e3:	83 fb 01             	cmp    $0x1,%ebx
+  8002e6:	75 aa                	jne    800292 <umain+0x1a7>
+  8002e8:	83 f8 01             	cmp    $0x1,%eax
+  8002eb:	75 a5                	jne    800292 <umain+0x1a7>
+  8002ed:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  8002f1:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  8002f4:	75 9c                	jne    800292 <umain+0x1a7>
+  8002f6:	eb ac                	jmp    8002a4 <umain+0x1b9>
+	cprintf("shell ran correctly\n");
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	68 78 3e 80 00       	push   $0x803e78
+  800300:	e8 1f 03 00 00       	call   800624 <cprintf>
+#define MSR_SYSENTER_EIP	0x176
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  800305:	cc                   	int3
+}
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	c3                   	ret
+
+00800317 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80031d:	68 8d 3e 80 00       	push   $0x803e8d
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	e8 42 09 00 00       	call   800c6c <strcpy>
+	return 0;
+}
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <devcons_write>:
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80033d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800342:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800348:	eb 2e                	jmp    800378 <devcons_write+0x47>
+		m = n - tot;
+  80034a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80034f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800354:	39 c3                	cmp    %eax,%ebx
+  800356:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800359:	83 ec 04             	sub    $0x4,%esp
+  80035c:	53                   	push   %ebx
+  80035d:	89 f0                	mov    %esi,%eax
+  80035f:	03 45 0c             	add    0xc(%ebp),%eax
+  800362:	50                   	push   %eax
+  800363:	57                   	push   %edi
+  800364:	e8 89 0a 00 00       	call   800df2 <memmove>
+		sys_cputs(buf, m);
+  800369:	83 c4 08             	add    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	57                   	push   %edi
+  80036e:	e8 72 0c 00 00       	call   800fe5 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800373:	01 de                	add    %ebx,%esi
+  800375:	83 c4 10             	add    $0x10,%esp
+  800378:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80037b:	72 cd                	jb     80034a <devcons_write+0x19>
+}
+  80037d:	89 f0                	mov    %esi,%eax
+  80037f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+
+00800387 <devcons_read>:
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800396:	75 07                	jne    80039f <devcons_read+0x18>
+  800398:	eb 1f                	jmp    8003b9 <devcons_read+0x32>
+		sys_yield();
+  80039a:	e8 7f 0d 00 00       	call   80111e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80039f:	e8 85 0c 00 00       	call   801029 <sys_cgetc>
+  8003a4:	85 c0                	test   %eax,%eax
+  8003a6:	74 f2                	je     80039a <devcons_read+0x13>
+	if (c < 0)
+  8003a8:	78 0f                	js     8003b9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8003aa:	83 f8 04             	cmp    $0x4,%eax
+  8003ad:	74 0c                	je     8003bb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8003af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003b2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8003b4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8003b9:	c9                   	leave
+  8003ba:	c3                   	ret
+		return 0;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c0:	eb f7                	jmp    8003b9 <devcons_read+0x32>
+
+008003c2 <cputchar>:
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8003c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003cb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8003ce:	6a 01                	push   $0x1
+  8003d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003d3:	50                   	push   %eax
+  8003d4:	e8 0c 0c 00 00       	call   800fe5 <sys_cputs>
+}
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+008003de <getchar>:
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8003e4:	6a 01                	push   $0x1
+  8003e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	6a 00                	push   $0x0
+  8003ec:	e8 f4 21 00 00       	call   8025e5 <read>
+	if (r < 0)
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	78 06                	js     8003fe <getchar+0x20>
+	if (r < 1)
+  8003f8:	74 06                	je     800400 <getchar+0x22>
+	return c;
+  8003fa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+		return -E_EOF;
+  800400:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800405:	eb f7                	jmp    8003fe <getchar+0x20>
+
+00800407 <iscons>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80040d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800410:	50                   	push   %eax
+  800411:	ff 75 08             	push   0x8(%ebp)
+  800414:	e8 46 1f 00 00       	call   80235f <fd_lookup>
+  800419:	83 c4 10             	add    $0x10,%esp
+  80041c:	85 c0                	test   %eax,%eax
+  80041e:	78 11                	js     800431 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800423:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800429:	39 10                	cmp    %edx,(%eax)
+  80042b:	0f 94 c0             	sete   %al
+  80042e:	0f b6 c0             	movzbl %al,%eax
+}
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <opencons>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80043c:	50                   	push   %eax
+  80043d:	e8 c7 1e 00 00       	call   802309 <fd_alloc>
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	85 c0                	test   %eax,%eax
+  800447:	78 3a                	js     800483 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800449:	83 ec 04             	sub    $0x4,%esp
+  80044c:	68 07 04 00 00       	push   $0x407
+  800451:	ff 75 f4             	push   -0xc(%ebp)
+  800454:	6a 00                	push   $0x0
+  800456:	e8 09 0d 00 00       	call   801164 <sys_page_alloc>
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	78 21                	js     800483 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800462:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800465:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80046b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80046d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800470:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	50                   	push   %eax
+  80047b:	e8 62 1e 00 00       	call   8022e2 <fd2num>
+  800480:	83 c4 10             	add    $0x10,%esp
+}
+  800483:	c9                   	leave
+  800484:	c3                   	ret
+
+00800485 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	57                   	push   %edi
+  800489:	56                   	push   %esi
+  80048a:	53                   	push   %ebx
+  80048b:	83 ec 0c             	sub    $0xc,%esp
+  80048e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800491:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800494:	b8 01 00 00 00       	mov    $0x1,%eax
+  800499:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80049b:	c1 ea 0b             	shr    $0xb,%edx
+  80049e:	83 f2 01             	xor    $0x1,%edx
+  8004a1:	83 e2 01             	and    $0x1,%edx
+  8004a4:	88 15 0c 60 80 00    	mov    %dl,0x80600c
+
+	mainenv = NULL;
+  8004aa:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8004b1:	00 00 00 
+	envid = sys_getenvid();
+  8004b4:	e8 1f 0c 00 00       	call   8010d8 <sys_getenvid>
+  8004b9:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8004c0:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8004c6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8004cc:	8b 52 48             	mov    0x48(%edx),%edx
+  8004cf:	39 ca                	cmp    %ecx,%edx
+  8004d1:	74 27                	je     8004fa <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8004d3:	83 c0 01             	add    $0x1,%eax
+  8004d6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8004db:	75 e3                	jne    8004c0 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8004dd:	83 3d 08 60 80 00 00 	cmpl   $0x0,0x806008
+  8004e4:	75 24                	jne    80050a <libmain+0x85>
+		panic("libmain can't find the environment");
+  8004e6:	83 ec 04             	sub    $0x4,%esp
+  8004e9:	68 9c 3e 80 00       	push   $0x803e9c
+  8004ee:	6a 23                	push   $0x23
+  8004f0:	68 bf 3e 80 00       	push   $0x803ebf
+  8004f5:	e8 4f 00 00 00       	call   800549 <_panic>
+			mainenv = &envs[i];
+  8004fa:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800500:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800505:	a3 08 60 80 00       	mov    %eax,0x806008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80050a:	85 ff                	test   %edi,%edi
+  80050c:	7e 07                	jle    800515 <libmain+0x90>
+		binaryname = argv[0];
+  80050e:	8b 06                	mov    (%esi),%eax
+  800510:	a3 1c 50 80 00       	mov    %eax,0x80501c
+
+	// call user main routine
+	umain(argc, argv);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	56                   	push   %esi
+  800519:	57                   	push   %edi
+  80051a:	e8 cc fb ff ff       	call   8000eb <umain>
+
+	// exit gracefully
+	exit();
+  80051f:	e8 0b 00 00 00       	call   80052f <exit>
+}
+  800524:	83 c4 10             	add    $0x10,%esp
+  800527:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80052a:	5b                   	pop    %ebx
+  80052b:	5e                   	pop    %esi
+  80052c:	5f                   	pop    %edi
+  80052d:	5d                   	pop    %ebp
+  80052e:	c3                   	ret
+
+0080052f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80052f:	55                   	push   %ebp
+  800530:	89 e5                	mov    %esp,%ebp
+  800532:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800535:	e8 9c 1f 00 00       	call   8024d6 <close_all>
+	sys_env_destroy(0);
+  80053a:	83 ec 0c             	sub    $0xc,%esp
+  80053d:	6a 00                	push   $0x0
+  80053f:	e8 2b 0b 00 00       	call   80106f <sys_env_destroy>
+}
+  800544:	83 c4 10             	add    $0x10,%esp
+  800547:	c9                   	leave
+  800548:	c3                   	ret
+
+00800549 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800549:	55                   	push   %ebp
+  80054a:	89 e5                	mov    %esp,%ebp
+  80054c:	56                   	push   %esi
+  80054d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80054e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800551:	8b 35 1c 50 80 00    	mov    0x80501c,%esi
+  800557:	e8 7c 0b 00 00       	call   8010d8 <sys_getenvid>
+  80055c:	83 ec 0c             	sub    $0xc,%esp
+  80055f:	ff 75 0c             	push   0xc(%ebp)
+  800562:	ff 75 08             	push   0x8(%ebp)
+  800565:	56                   	push   %esi
+  800566:	50                   	push   %eax
+  800567:	68 d8 3e 80 00       	push   $0x803ed8
+  80056c:	e8 b3 00 00 00       	call   800624 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800571:	83 c4 18             	add    $0x18,%esp
+  800574:	53                   	push   %ebx
+  800575:	ff 75 10             	push   0x10(%ebp)
+  800578:	e8 56 00 00 00       	call   8005d3 <vcprintf>
+	cprintf("\n");
+  80057d:	c7 04 24 57 44 80 00 	movl   $0x804457,(%esp)
+  800584:	e8 9b 00 00 00       	call   800624 <cprintf>
+  800589:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80058c:	cc                   	int3
+	while (1)
+  80058d:	eb fd                	jmp    80058c <_panic+0x43>
+
+0080058f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80058f:	55                   	push   %ebp
+  800590:	89 e5                	mov    %esp,%ebp
+  800592:	53                   	push   %ebx
+  800593:	83 ec 04             	sub    $0x4,%esp
+  800596:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800599:	8b 13                	mov    (%ebx),%edx
+  80059b:	8d 42 01             	lea    0x1(%edx),%eax
+  80059e:	89 03                	mov    %eax,(%ebx)
+  8005a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8005a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8005a7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005ac:	74 09                	je     8005b7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8005ae:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8005b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005b5:	c9                   	leave
+  8005b6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8005b7:	83 ec 08             	sub    $0x8,%esp
+  8005ba:	68 ff 00 00 00       	push   $0xff
+  8005bf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005c2:	50                   	push   %eax
+  8005c3:	e8 1d 0a 00 00       	call   800fe5 <sys_cputs>
+		b->idx = 0;
+  8005c8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005ce:	83 c4 10             	add    $0x10,%esp
+  8005d1:	eb db                	jmp    8005ae <putch+0x1f>
+
+008005d3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005d3:	55                   	push   %ebp
+  8005d4:	89 e5                	mov    %esp,%ebp
+  8005d6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005dc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005e3:	00 00 00 
+	b.cnt = 0;
+  8005e6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005ed:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005f0:	ff 75 0c             	push   0xc(%ebp)
+  8005f3:	ff 75 08             	push   0x8(%ebp)
+  8005f6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005fc:	50                   	push   %eax
+  8005fd:	68 8f 05 80 00       	push   $0x80058f
+  800602:	e8 fb 00 00 00       	call   800702 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800607:	83 c4 08             	add    $0x8,%esp
+  80060a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800610:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800616:	50                   	push   %eax
+  800617:	e8 c9 09 00 00       	call   800fe5 <sys_cputs>
+
+	return b.cnt;
+}
+  80061c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800622:	c9                   	leave
+  800623:	c3                   	ret
+
+00800624 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800624:	55                   	push   %ebp
+  800625:	89 e5                	mov    %esp,%ebp
+  800627:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80062a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80062d:	50                   	push   %eax
+  80062e:	ff 75 08             	push   0x8(%ebp)
+  800631:	e8 9d ff ff ff       	call   8005d3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800636:	c9                   	leave
+  800637:	c3                   	ret
+
+00800638 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  800638:	55                   	push   %ebp
+  800639:	89 e5                	mov    %esp,%ebp
+  80063b:	57                   	push   %edi
+  80063c:	56                   	push   %esi
+  80063d:	53                   	push   %ebx
+  80063e:	83 ec 1c             	sub    $0x1c,%esp
+  800641:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800644:	89 d6                	mov    %edx,%esi
+  800646:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800649:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80064c:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  80064f:	73 0b                	jae    80065c <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800651:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800654:	c1 e7 08             	shl    $0x8,%edi
+  800657:	0b 7d 10             	or     0x10(%ebp),%edi
+  80065a:	eb 36                	jmp    800692 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  80065c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80065f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800664:	f7 75 08             	divl   0x8(%ebp)
+  800667:	89 c1                	mov    %eax,%ecx
+  800669:	ff 75 14             	push   0x14(%ebp)
+  80066c:	ff 75 10             	push   0x10(%ebp)
+  80066f:	83 eb 01             	sub    $0x1,%ebx
+  800672:	53                   	push   %ebx
+  800673:	ff 75 08             	push   0x8(%ebp)
+  800676:	89 f2                	mov    %esi,%edx
+  800678:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80067b:	e8 b8 ff ff ff       	call   800638 <printnum>
+  800680:	83 c4 10             	add    $0x10,%esp
+  800683:	eb 14                	jmp    800699 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800685:	83 ec 08             	sub    $0x8,%esp
+  800688:	56                   	push   %esi
+  800689:	57                   	push   %edi
+  80068a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80068d:	ff d0                	call   *%eax
+  80068f:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800692:	83 eb 01             	sub    $0x1,%ebx
+  800695:	85 db                	test   %ebx,%ebx
+  800697:	7f ec                	jg     800685 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800699:	83 ec 08             	sub    $0x8,%esp
+  80069c:	56                   	push   %esi
+  80069d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006a5:	f7 75 08             	divl   0x8(%ebp)
+  8006a8:	0f be 92 fb 3e 80 00 	movsbl 0x803efb(%edx),%edx
+  8006af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b2:	c1 e0 08             	shl    $0x8,%eax
+  8006b5:	09 d0                	or     %edx,%eax
+  8006b7:	50                   	push   %eax
+  8006b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006bb:	ff d0                	call   *%eax
+}
+  8006bd:	83 c4 10             	add    $0x10,%esp
+  8006c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006c3:	5b                   	pop    %ebx
+  8006c4:	5e                   	pop    %esi
+  8006c5:	5f                   	pop    %edi
+  8006c6:	5d                   	pop    %ebp
+  8006c7:	c3                   	ret
+
+008006c8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006c8:	55                   	push   %ebp
+  8006c9:	89 e5                	mov    %esp,%ebp
+  8006cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006ce:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006d2:	8b 10                	mov    (%eax),%edx
+  8006d4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006d7:	73 0a                	jae    8006e3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006d9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006dc:	89 08                	mov    %ecx,(%eax)
+  8006de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e1:	88 02                	mov    %al,(%edx)
+}
+  8006e3:	5d                   	pop    %ebp
+  8006e4:	c3                   	ret
+
+008006e5 <printfmt>:
+{
+  8006e5:	55                   	push   %ebp
+  8006e6:	89 e5                	mov    %esp,%ebp
+  8006e8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006eb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006ee:	50                   	push   %eax
+  8006ef:	ff 75 10             	push   0x10(%ebp)
+  8006f2:	ff 75 0c             	push   0xc(%ebp)
+  8006f5:	ff 75 08             	push   0x8(%ebp)
+  8006f8:	e8 05 00 00 00       	call   800702 <vprintfmt>
+}
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	c9                   	leave
+  800701:	c3                   	ret
+
+00800702 <vprintfmt>:
+{
+  800702:	55                   	push   %ebp
+  800703:	89 e5                	mov    %esp,%ebp
+  800705:	57                   	push   %edi
+  800706:	56                   	push   %esi
+  800707:	53                   	push   %ebx
+  800708:	83 ec 3c             	sub    $0x3c,%esp
+  80070b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80070e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800711:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800718:	eb 16                	jmp    800730 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80071a:	83 ec 08             	sub    $0x8,%esp
+  80071d:	ff 75 0c             	push   0xc(%ebp)
+  800720:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800723:	c1 e2 08             	shl    $0x8,%edx
+  800726:	09 d0                	or     %edx,%eax
+  800728:	50                   	push   %eax
+  800729:	ff d7                	call   *%edi
+  80072b:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80072e:	89 de                	mov    %ebx,%esi
+  800730:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800733:	0f b6 06             	movzbl (%esi),%eax
+  800736:	83 f8 25             	cmp    $0x25,%eax
+  800739:	74 0c                	je     800747 <vprintfmt+0x45>
+			if (ch == '\0')
+  80073b:	85 c0                	test   %eax,%eax
+  80073d:	75 db                	jne    80071a <vprintfmt+0x18>
+}
+  80073f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800742:	5b                   	pop    %ebx
+  800743:	5e                   	pop    %esi
+  800744:	5f                   	pop    %edi
+  800745:	5d                   	pop    %ebp
+  800746:	c3                   	ret
+		padc = ' ';
+  800747:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80074b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800752:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800759:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800760:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800765:	8d 73 01             	lea    0x1(%ebx),%esi
+  800768:	0f b6 13             	movzbl (%ebx),%edx
+  80076b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80076e:	3c 55                	cmp    $0x55,%al
+  800770:	0f 87 2c 04 00 00    	ja     800ba2 <vprintfmt+0x4a0>
+  800776:	0f b6 c0             	movzbl %al,%eax
+  800779:	ff 24 85 40 40 80 00 	jmp    *0x804040(,%eax,4)
+  800780:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800782:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800786:	eb dd                	jmp    800765 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800788:	89 f3                	mov    %esi,%ebx
+  80078a:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  80078e:	eb d5                	jmp    800765 <vprintfmt+0x63>
+  800790:	0f b6 d2             	movzbl %dl,%edx
+  800793:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800795:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80079a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80079d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8007a1:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8007a4:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8007a7:	83 fe 09             	cmp    $0x9,%esi
+  8007aa:	0f 87 8a 00 00 00    	ja     80083a <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8007b0:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8007b3:	eb e5                	jmp    80079a <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 00                	mov    (%eax),%eax
+  8007ba:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007c6:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8007c8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007cc:	79 97                	jns    800765 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8007ce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007db:	eb 88                	jmp    800765 <vprintfmt+0x63>
+			if (width < 0)
+  8007dd:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8007e0:	85 db                	test   %ebx,%ebx
+  8007e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e7:	0f 49 c3             	cmovns %ebx,%eax
+  8007ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007ed:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8007ef:	e9 71 ff ff ff       	jmp    800765 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007f4:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8007f6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007fd:	e9 63 ff ff ff       	jmp    800765 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800802:	8d 73 02             	lea    0x2(%ebx),%esi
+  800805:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800809:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800810:	3c 67                	cmp    $0x67,%al
+  800812:	0f 84 18 ff ff ff    	je     800730 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800818:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  80081f:	3c 72                	cmp    $0x72,%al
+  800821:	0f 84 09 ff ff ff    	je     800730 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800827:	3c 62                	cmp    $0x62,%al
+  800829:	0f 94 c0             	sete   %al
+  80082c:	0f b6 c0             	movzbl %al,%eax
+  80082f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800832:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800835:	e9 f6 fe ff ff       	jmp    800730 <vprintfmt+0x2e>
+  80083a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80083d:	eb 89                	jmp    8007c8 <vprintfmt+0xc6>
+			lflag++;
+  80083f:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800842:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800844:	e9 1c ff ff ff       	jmp    800765 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800849:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80084f:	83 ec 08             	sub    $0x8,%esp
+  800852:	ff 75 0c             	push   0xc(%ebp)
+  800855:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800858:	c1 e0 08             	shl    $0x8,%eax
+  80085b:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80085e:	0b 01                	or     (%ecx),%eax
+  800860:	50                   	push   %eax
+  800861:	ff d7                	call   *%edi
+			break;
+  800863:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800866:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800869:	e9 c2 fe ff ff       	jmp    800730 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  80086e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800871:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800874:	8b 10                	mov    (%eax),%edx
+  800876:	89 d0                	mov    %edx,%eax
+  800878:	f7 d8                	neg    %eax
+  80087a:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80087d:	83 f8 12             	cmp    $0x12,%eax
+  800880:	7f 25                	jg     8008a7 <vprintfmt+0x1a5>
+  800882:	8b 14 85 a0 41 80 00 	mov    0x8041a0(,%eax,4),%edx
+  800889:	85 d2                	test   %edx,%edx
+  80088b:	74 1a                	je     8008a7 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  80088d:	52                   	push   %edx
+  80088e:	68 e2 42 80 00       	push   $0x8042e2
+  800893:	ff 75 0c             	push   0xc(%ebp)
+  800896:	57                   	push   %edi
+  800897:	e8 49 fe ff ff       	call   8006e5 <printfmt>
+  80089c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80089f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8008a2:	e9 89 fe ff ff       	jmp    800730 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8008a7:	50                   	push   %eax
+  8008a8:	68 13 3f 80 00       	push   $0x803f13
+  8008ad:	ff 75 0c             	push   0xc(%ebp)
+  8008b0:	57                   	push   %edi
+  8008b1:	e8 2f fe ff ff       	call   8006e5 <printfmt>
+  8008b6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8008b9:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8008bc:	e9 6f fe ff ff       	jmp    800730 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c4:	83 c0 04             	add    $0x4,%eax
+  8008c7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8008ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cd:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8008cf:	85 c9                	test   %ecx,%ecx
+  8008d1:	b8 0c 3f 80 00       	mov    $0x803f0c,%eax
+  8008d6:	0f 45 c1             	cmovne %ecx,%eax
+  8008d9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8008dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008e0:	7e 06                	jle    8008e8 <vprintfmt+0x1e6>
+  8008e2:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8008e6:	75 1a                	jne    800902 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8008e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008eb:	c1 e0 08             	shl    $0x8,%eax
+  8008ee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8008f1:	83 c8 3f             	or     $0x3f,%eax
+  8008f4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008f7:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8008fa:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008fd:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800900:	eb 6d                	jmp    80096f <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800902:	83 ec 08             	sub    $0x8,%esp
+  800905:	ff 75 d0             	push   -0x30(%ebp)
+  800908:	ff 75 c8             	push   -0x38(%ebp)
+  80090b:	e8 39 03 00 00       	call   800c49 <strnlen>
+  800910:	89 c2                	mov    %eax,%edx
+  800912:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800915:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800917:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80091a:	c1 e1 08             	shl    $0x8,%ecx
+  80091d:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800921:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800923:	83 c4 10             	add    $0x10,%esp
+  800926:	89 c3                	mov    %eax,%ebx
+  800928:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80092b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80092e:	89 ce                	mov    %ecx,%esi
+  800930:	eb 0f                	jmp    800941 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800932:	83 ec 08             	sub    $0x8,%esp
+  800935:	ff 75 0c             	push   0xc(%ebp)
+  800938:	56                   	push   %esi
+  800939:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80093b:	83 eb 01             	sub    $0x1,%ebx
+  80093e:	83 c4 10             	add    $0x10,%esp
+  800941:	85 db                	test   %ebx,%ebx
+  800943:	7f ed                	jg     800932 <vprintfmt+0x230>
+  800945:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800948:	8b 75 10             	mov    0x10(%ebp),%esi
+  80094b:	85 c0                	test   %eax,%eax
+  80094d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800952:	0f 49 d0             	cmovns %eax,%edx
+  800955:	29 d0                	sub    %edx,%eax
+  800957:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80095a:	eb 8c                	jmp    8008e8 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  80095c:	83 ec 08             	sub    $0x8,%esp
+  80095f:	ff 75 0c             	push   0xc(%ebp)
+  800962:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800965:	09 c2                	or     %eax,%edx
+  800967:	52                   	push   %edx
+  800968:	ff d7                	call   *%edi
+  80096a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80096d:	89 d9                	mov    %ebx,%ecx
+  80096f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800972:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800976:	0f be d0             	movsbl %al,%edx
+  800979:	85 d2                	test   %edx,%edx
+  80097b:	74 2a                	je     8009a7 <vprintfmt+0x2a5>
+  80097d:	85 f6                	test   %esi,%esi
+  80097f:	78 05                	js     800986 <vprintfmt+0x284>
+  800981:	83 ee 01             	sub    $0x1,%esi
+  800984:	78 3b                	js     8009c1 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800986:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80098a:	74 d0                	je     80095c <vprintfmt+0x25a>
+  80098c:	0f be c0             	movsbl %al,%eax
+  80098f:	83 e8 20             	sub    $0x20,%eax
+  800992:	83 f8 5e             	cmp    $0x5e,%eax
+  800995:	76 c5                	jbe    80095c <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800997:	83 ec 08             	sub    $0x8,%esp
+  80099a:	ff 75 0c             	push   0xc(%ebp)
+  80099d:	ff 75 cc             	push   -0x34(%ebp)
+  8009a0:	ff d7                	call   *%edi
+  8009a2:	83 c4 10             	add    $0x10,%esp
+  8009a5:	eb c6                	jmp    80096d <vprintfmt+0x26b>
+  8009a7:	8b 75 10             	mov    0x10(%ebp),%esi
+  8009aa:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8009ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009b0:	01 c3                	add    %eax,%ebx
+  8009b2:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8009b4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8009b7:	83 c8 20             	or     $0x20,%eax
+  8009ba:	89 75 10             	mov    %esi,0x10(%ebp)
+  8009bd:	89 c6                	mov    %eax,%esi
+  8009bf:	eb 14                	jmp    8009d5 <vprintfmt+0x2d3>
+  8009c1:	8b 75 10             	mov    0x10(%ebp),%esi
+  8009c4:	eb e4                	jmp    8009aa <vprintfmt+0x2a8>
+  8009c6:	83 ec 08             	sub    $0x8,%esp
+  8009c9:	ff 75 0c             	push   0xc(%ebp)
+  8009cc:	56                   	push   %esi
+  8009cd:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8009cf:	83 eb 01             	sub    $0x1,%ebx
+  8009d2:	83 c4 10             	add    $0x10,%esp
+  8009d5:	85 db                	test   %ebx,%ebx
+  8009d7:	7f ed                	jg     8009c6 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009d9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8009dc:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8009df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009e2:	e9 49 fd ff ff       	jmp    800730 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8009e7:	83 f9 01             	cmp    $0x1,%ecx
+  8009ea:	7f 1f                	jg     800a0b <vprintfmt+0x309>
+	else if (lflag)
+  8009ec:	85 c9                	test   %ecx,%ecx
+  8009ee:	74 69                	je     800a59 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8009f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f3:	8b 00                	mov    (%eax),%eax
+  8009f5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009f8:	89 c1                	mov    %eax,%ecx
+  8009fa:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009fd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a00:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a03:	8d 40 04             	lea    0x4(%eax),%eax
+  800a06:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a09:	eb 17                	jmp    800a22 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800a0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0e:	8b 50 04             	mov    0x4(%eax),%edx
+  800a11:	8b 00                	mov    (%eax),%eax
+  800a13:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a16:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a1c:	8d 40 08             	lea    0x8(%eax),%eax
+  800a1f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a22:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800a25:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800a28:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800a2d:	85 db                	test   %ebx,%ebx
+  800a2f:	0f 89 f6 00 00 00    	jns    800b2b <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800a35:	83 ec 08             	sub    $0x8,%esp
+  800a38:	ff 75 0c             	push   0xc(%ebp)
+  800a3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800a3e:	c1 e0 08             	shl    $0x8,%eax
+  800a41:	83 c8 2d             	or     $0x2d,%eax
+  800a44:	50                   	push   %eax
+  800a45:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800a47:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800a4a:	f7 d9                	neg    %ecx
+  800a4c:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800a4f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a54:	e9 d2 00 00 00       	jmp    800b2b <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800a59:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5c:	8b 00                	mov    (%eax),%eax
+  800a5e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a61:	89 c1                	mov    %eax,%ecx
+  800a63:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a66:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a69:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6c:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a72:	eb ae                	jmp    800a22 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800a74:	83 f9 01             	cmp    $0x1,%ecx
+  800a77:	7f 19                	jg     800a92 <vprintfmt+0x390>
+	else if (lflag)
+  800a79:	85 c9                	test   %ecx,%ecx
+  800a7b:	74 2a                	je     800aa7 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800a7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a80:	8b 08                	mov    (%eax),%ecx
+  800a82:	8d 40 04             	lea    0x4(%eax),%eax
+  800a85:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a88:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800a8d:	e9 99 00 00 00       	jmp    800b2b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800a92:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a95:	8b 08                	mov    (%eax),%ecx
+  800a97:	8d 40 08             	lea    0x8(%eax),%eax
+  800a9a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800aa2:	e9 84 00 00 00       	jmp    800b2b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800aa7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aaa:	8b 08                	mov    (%eax),%ecx
+  800aac:	8d 40 04             	lea    0x4(%eax),%eax
+  800aaf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ab2:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800ab7:	eb 72                	jmp    800b2b <vprintfmt+0x429>
+	if (lflag >= 2)
+  800ab9:	83 f9 01             	cmp    $0x1,%ecx
+  800abc:	7f 16                	jg     800ad4 <vprintfmt+0x3d2>
+	else if (lflag)
+  800abe:	85 c9                	test   %ecx,%ecx
+  800ac0:	74 24                	je     800ae6 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800ac2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac5:	8b 08                	mov    (%eax),%ecx
+  800ac7:	8d 40 04             	lea    0x4(%eax),%eax
+  800aca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800acd:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800ad2:	eb 57                	jmp    800b2b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800ad4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad7:	8b 08                	mov    (%eax),%ecx
+  800ad9:	8d 40 08             	lea    0x8(%eax),%eax
+  800adc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800adf:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800ae4:	eb 45                	jmp    800b2b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800ae6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae9:	8b 08                	mov    (%eax),%ecx
+  800aeb:	8d 40 04             	lea    0x4(%eax),%eax
+  800aee:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800af1:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800af6:	eb 33                	jmp    800b2b <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800af8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800afb:	c1 e3 08             	shl    $0x8,%ebx
+  800afe:	83 ec 08             	sub    $0x8,%esp
+  800b01:	ff 75 0c             	push   0xc(%ebp)
+  800b04:	89 d8                	mov    %ebx,%eax
+  800b06:	83 c8 30             	or     $0x30,%eax
+  800b09:	50                   	push   %eax
+  800b0a:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800b0c:	83 c4 08             	add    $0x8,%esp
+  800b0f:	ff 75 0c             	push   0xc(%ebp)
+  800b12:	83 cb 78             	or     $0x78,%ebx
+  800b15:	53                   	push   %ebx
+  800b16:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800b18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1b:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800b1d:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b20:	8d 40 04             	lea    0x4(%eax),%eax
+  800b23:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b26:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  800b2b:	ff 75 e4             	push   -0x1c(%ebp)
+  800b2e:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800b32:	52                   	push   %edx
+  800b33:	ff 75 e0             	push   -0x20(%ebp)
+  800b36:	50                   	push   %eax
+  800b37:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b3a:	89 f8                	mov    %edi,%eax
+  800b3c:	e8 f7 fa ff ff       	call   800638 <printnum>
+			break;
+  800b41:	83 c4 10             	add    $0x10,%esp
+  800b44:	e9 e7 fb ff ff       	jmp    800730 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800b49:	83 f9 01             	cmp    $0x1,%ecx
+  800b4c:	7f 16                	jg     800b64 <vprintfmt+0x462>
+	else if (lflag)
+  800b4e:	85 c9                	test   %ecx,%ecx
+  800b50:	74 24                	je     800b76 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800b52:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b55:	8b 08                	mov    (%eax),%ecx
+  800b57:	8d 40 04             	lea    0x4(%eax),%eax
+  800b5a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b5d:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800b62:	eb c7                	jmp    800b2b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800b64:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b67:	8b 08                	mov    (%eax),%ecx
+  800b69:	8d 40 08             	lea    0x8(%eax),%eax
+  800b6c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b6f:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800b74:	eb b5                	jmp    800b2b <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800b76:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b79:	8b 08                	mov    (%eax),%ecx
+  800b7b:	8d 40 04             	lea    0x4(%eax),%eax
+  800b7e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b81:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800b86:	eb a3                	jmp    800b2b <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800b88:	83 ec 08             	sub    $0x8,%esp
+  800b8b:	ff 75 0c             	push   0xc(%ebp)
+  800b8e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800b91:	c1 e0 08             	shl    $0x8,%eax
+  800b94:	83 c8 25             	or     $0x25,%eax
+  800b97:	50                   	push   %eax
+  800b98:	ff d7                	call   *%edi
+			break;
+  800b9a:	83 c4 10             	add    $0x10,%esp
+  800b9d:	e9 8e fb ff ff       	jmp    800730 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800ba2:	83 ec 08             	sub    $0x8,%esp
+  800ba5:	ff 75 0c             	push   0xc(%ebp)
+  800ba8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800bab:	c1 e0 08             	shl    $0x8,%eax
+  800bae:	83 c8 25             	or     $0x25,%eax
+  800bb1:	50                   	push   %eax
+  800bb2:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800bb4:	83 c4 10             	add    $0x10,%esp
+  800bb7:	89 de                	mov    %ebx,%esi
+  800bb9:	eb 03                	jmp    800bbe <vprintfmt+0x4bc>
+  800bbb:	83 ee 01             	sub    $0x1,%esi
+  800bbe:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800bc2:	75 f7                	jne    800bbb <vprintfmt+0x4b9>
+  800bc4:	e9 67 fb ff ff       	jmp    800730 <vprintfmt+0x2e>
+
+00800bc9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800bc9:	55                   	push   %ebp
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	83 ec 18             	sub    $0x18,%esp
+  800bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800bd5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800bd8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800bdc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800bdf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800be6:	85 c0                	test   %eax,%eax
+  800be8:	74 26                	je     800c10 <vsnprintf+0x47>
+  800bea:	85 d2                	test   %edx,%edx
+  800bec:	7e 22                	jle    800c10 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800bee:	ff 75 14             	push   0x14(%ebp)
+  800bf1:	ff 75 10             	push   0x10(%ebp)
+  800bf4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800bf7:	50                   	push   %eax
+  800bf8:	68 c8 06 80 00       	push   $0x8006c8
+  800bfd:	e8 00 fb ff ff       	call   800702 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c02:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c05:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c0b:	83 c4 10             	add    $0x10,%esp
+}
+  800c0e:	c9                   	leave
+  800c0f:	c3                   	ret
+		return -E_INVAL;
+  800c10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c15:	eb f7                	jmp    800c0e <vsnprintf+0x45>
+
+00800c17 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800c1d:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c20:	50                   	push   %eax
+  800c21:	ff 75 10             	push   0x10(%ebp)
+  800c24:	ff 75 0c             	push   0xc(%ebp)
+  800c27:	ff 75 08             	push   0x8(%ebp)
+  800c2a:	e8 9a ff ff ff       	call   800bc9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800c2f:	c9                   	leave
+  800c30:	c3                   	ret
+
+00800c31 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3c:	eb 03                	jmp    800c41 <strlen+0x10>
+		n++;
+  800c3e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800c41:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c45:	75 f7                	jne    800c3e <strlen+0xd>
+	return n;
+}
+  800c47:	5d                   	pop    %ebp
+  800c48:	c3                   	ret
+
+00800c49 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800c49:	55                   	push   %ebp
+  800c4a:	89 e5                	mov    %esp,%ebp
+  800c4c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c57:	eb 03                	jmp    800c5c <strnlen+0x13>
+		n++;
+  800c59:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c5c:	39 d0                	cmp    %edx,%eax
+  800c5e:	74 08                	je     800c68 <strnlen+0x1f>
+  800c60:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c64:	75 f3                	jne    800c59 <strnlen+0x10>
+  800c66:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800c68:	89 d0                	mov    %edx,%eax
+  800c6a:	5d                   	pop    %ebp
+  800c6b:	c3                   	ret
+
+00800c6c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	53                   	push   %ebx
+  800c70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c7f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c82:	83 c0 01             	add    $0x1,%eax
+  800c85:	84 d2                	test   %dl,%dl
+  800c87:	75 f2                	jne    800c7b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c89:	89 c8                	mov    %ecx,%eax
+  800c8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c8e:	c9                   	leave
+  800c8f:	c3                   	ret
+
+00800c90 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c90:	55                   	push   %ebp
+  800c91:	89 e5                	mov    %esp,%ebp
+  800c93:	53                   	push   %ebx
+  800c94:	83 ec 10             	sub    $0x10,%esp
+  800c97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c9a:	53                   	push   %ebx
+  800c9b:	e8 91 ff ff ff       	call   800c31 <strlen>
+  800ca0:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ca3:	ff 75 0c             	push   0xc(%ebp)
+  800ca6:	01 d8                	add    %ebx,%eax
+  800ca8:	50                   	push   %eax
+  800ca9:	e8 be ff ff ff       	call   800c6c <strcpy>
+	return dst;
+}
+  800cae:	89 d8                	mov    %ebx,%eax
+  800cb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cb3:	c9                   	leave
+  800cb4:	c3                   	ret
+
+00800cb5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	56                   	push   %esi
+  800cb9:	53                   	push   %ebx
+  800cba:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cbd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800cc0:	89 f3                	mov    %esi,%ebx
+  800cc2:	03 5d 10             	add    0x10(%ebp),%ebx
+  800cc5:	89 f0                	mov    %esi,%eax
+  800cc7:	eb 0f                	jmp    800cd8 <strncpy+0x23>
+		*dst++ = *src;
+  800cc9:	83 c0 01             	add    $0x1,%eax
+  800ccc:	0f b6 0a             	movzbl (%edx),%ecx
+  800ccf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800cd2:	80 f9 01             	cmp    $0x1,%cl
+  800cd5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800cd8:	39 d8                	cmp    %ebx,%eax
+  800cda:	75 ed                	jne    800cc9 <strncpy+0x14>
+	}
+	return ret;
+}
+  800cdc:	89 f0                	mov    %esi,%eax
+  800cde:	5b                   	pop    %ebx
+  800cdf:	5e                   	pop    %esi
+  800ce0:	5d                   	pop    %ebp
+  800ce1:	c3                   	ret
+
+00800ce2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ce2:	55                   	push   %ebp
+  800ce3:	89 e5                	mov    %esp,%ebp
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  800ce7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800cf0:	89 f0                	mov    %esi,%eax
+  800cf2:	85 d2                	test   %edx,%edx
+  800cf4:	74 21                	je     800d17 <strlcpy+0x35>
+  800cf6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800cfa:	89 f2                	mov    %esi,%edx
+  800cfc:	eb 09                	jmp    800d07 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800cfe:	83 c1 01             	add    $0x1,%ecx
+  800d01:	83 c2 01             	add    $0x1,%edx
+  800d04:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800d07:	39 c2                	cmp    %eax,%edx
+  800d09:	74 09                	je     800d14 <strlcpy+0x32>
+  800d0b:	0f b6 19             	movzbl (%ecx),%ebx
+  800d0e:	84 db                	test   %bl,%bl
+  800d10:	75 ec                	jne    800cfe <strlcpy+0x1c>
+  800d12:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800d14:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800d17:	29 f0                	sub    %esi,%eax
+}
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5d                   	pop    %ebp
+  800d1c:	c3                   	ret
+
+00800d1d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d23:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800d26:	eb 06                	jmp    800d2e <strcmp+0x11>
+		p++, q++;
+  800d28:	83 c1 01             	add    $0x1,%ecx
+  800d2b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800d2e:	0f b6 01             	movzbl (%ecx),%eax
+  800d31:	84 c0                	test   %al,%al
+  800d33:	74 04                	je     800d39 <strcmp+0x1c>
+  800d35:	3a 02                	cmp    (%edx),%al
+  800d37:	74 ef                	je     800d28 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d39:	0f b6 c0             	movzbl %al,%eax
+  800d3c:	0f b6 12             	movzbl (%edx),%edx
+  800d3f:	29 d0                	sub    %edx,%eax
+}
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+
+00800d43 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	53                   	push   %ebx
+  800d47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800d50:	eb 09                	jmp    800d5b <strncmp+0x18>
+		n--, p++, q++;
+  800d52:	83 ea 01             	sub    $0x1,%edx
+  800d55:	83 c0 01             	add    $0x1,%eax
+  800d58:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800d5b:	85 d2                	test   %edx,%edx
+  800d5d:	74 18                	je     800d77 <strncmp+0x34>
+  800d5f:	0f b6 18             	movzbl (%eax),%ebx
+  800d62:	84 db                	test   %bl,%bl
+  800d64:	74 04                	je     800d6a <strncmp+0x27>
+  800d66:	3a 19                	cmp    (%ecx),%bl
+  800d68:	74 e8                	je     800d52 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d6a:	0f b6 00             	movzbl (%eax),%eax
+  800d6d:	0f b6 11             	movzbl (%ecx),%edx
+  800d70:	29 d0                	sub    %edx,%eax
+}
+  800d72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d75:	c9                   	leave
+  800d76:	c3                   	ret
+		return 0;
+  800d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7c:	eb f4                	jmp    800d72 <strncmp+0x2f>
+
+00800d7e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d84:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d88:	eb 03                	jmp    800d8d <strchr+0xf>
+  800d8a:	83 c0 01             	add    $0x1,%eax
+  800d8d:	0f b6 10             	movzbl (%eax),%edx
+  800d90:	84 d2                	test   %dl,%dl
+  800d92:	74 06                	je     800d9a <strchr+0x1c>
+		if (*s == c)
+  800d94:	38 ca                	cmp    %cl,%dl
+  800d96:	75 f2                	jne    800d8a <strchr+0xc>
+  800d98:	eb 05                	jmp    800d9f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d9f:	5d                   	pop    %ebp
+  800da0:	c3                   	ret
+
+00800da1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800dab:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800dae:	38 ca                	cmp    %cl,%dl
+  800db0:	74 09                	je     800dbb <strfind+0x1a>
+  800db2:	84 d2                	test   %dl,%dl
+  800db4:	74 05                	je     800dbb <strfind+0x1a>
+	for (; *s; s++)
+  800db6:	83 c0 01             	add    $0x1,%eax
+  800db9:	eb f0                	jmp    800dab <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+
+00800dbd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	57                   	push   %edi
+  800dc1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800dc4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800dc7:	85 c9                	test   %ecx,%ecx
+  800dc9:	74 20                	je     800deb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800dcb:	89 f8                	mov    %edi,%eax
+  800dcd:	09 c8                	or     %ecx,%eax
+  800dcf:	a8 03                	test   $0x3,%al
+  800dd1:	75 12                	jne    800de5 <memset+0x28>
+		c &= 0xFF;
+  800dd3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800dd7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ddd:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800de0:	fc                   	cld
+  800de1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800de3:	eb 06                	jmp    800deb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800de5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800de8:	fc                   	cld
+  800de9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800deb:	89 f8                	mov    %edi,%eax
+  800ded:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800df0:	c9                   	leave
+  800df1:	c3                   	ret
+
+00800df2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dfa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800dfd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e00:	39 c6                	cmp    %eax,%esi
+  800e02:	73 32                	jae    800e36 <memmove+0x44>
+  800e04:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e07:	39 d0                	cmp    %edx,%eax
+  800e09:	73 2b                	jae    800e36 <memmove+0x44>
+		s += n;
+		d += n;
+  800e0b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e0e:	89 d6                	mov    %edx,%esi
+  800e10:	09 fe                	or     %edi,%esi
+  800e12:	09 ce                	or     %ecx,%esi
+  800e14:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e1a:	75 0e                	jne    800e2a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e1c:	83 ef 04             	sub    $0x4,%edi
+  800e1f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e22:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e25:	fd                   	std
+  800e26:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e28:	eb 09                	jmp    800e33 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e2a:	83 ef 01             	sub    $0x1,%edi
+  800e2d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e30:	fd                   	std
+  800e31:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e33:	fc                   	cld
+  800e34:	eb 1a                	jmp    800e50 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e36:	89 f2                	mov    %esi,%edx
+  800e38:	09 c2                	or     %eax,%edx
+  800e3a:	09 ca                	or     %ecx,%edx
+  800e3c:	f6 c2 03             	test   $0x3,%dl
+  800e3f:	75 0a                	jne    800e4b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e41:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e44:	89 c7                	mov    %eax,%edi
+  800e46:	fc                   	cld
+  800e47:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e49:	eb 05                	jmp    800e50 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e4b:	89 c7                	mov    %eax,%edi
+  800e4d:	fc                   	cld
+  800e4e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e50:	5e                   	pop    %esi
+  800e51:	5f                   	pop    %edi
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+
+00800e54 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800e5a:	ff 75 10             	push   0x10(%ebp)
+  800e5d:	ff 75 0c             	push   0xc(%ebp)
+  800e60:	ff 75 08             	push   0x8(%ebp)
+  800e63:	e8 8a ff ff ff       	call   800df2 <memmove>
+}
+  800e68:	c9                   	leave
+  800e69:	c3                   	ret
+
+00800e6a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  800e6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e72:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e75:	89 c6                	mov    %eax,%esi
+  800e77:	03 75 10             	add    0x10(%ebp),%esi
+  800e7a:	eb 06                	jmp    800e82 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e7c:	83 c0 01             	add    $0x1,%eax
+  800e7f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e82:	39 f0                	cmp    %esi,%eax
+  800e84:	74 14                	je     800e9a <memcmp+0x30>
+		if (*s1 != *s2)
+  800e86:	0f b6 08             	movzbl (%eax),%ecx
+  800e89:	0f b6 1a             	movzbl (%edx),%ebx
+  800e8c:	38 d9                	cmp    %bl,%cl
+  800e8e:	74 ec                	je     800e7c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800e90:	0f b6 c1             	movzbl %cl,%eax
+  800e93:	0f b6 db             	movzbl %bl,%ebx
+  800e96:	29 d8                	sub    %ebx,%eax
+  800e98:	eb 05                	jmp    800e9f <memcmp+0x35>
+	}
+
+	return 0;
+  800e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e9f:	5b                   	pop    %ebx
+  800ea0:	5e                   	pop    %esi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+
+00800ea3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ea3:	55                   	push   %ebp
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800eac:	89 c2                	mov    %eax,%edx
+  800eae:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800eb1:	eb 03                	jmp    800eb6 <memfind+0x13>
+  800eb3:	83 c0 01             	add    $0x1,%eax
+  800eb6:	39 d0                	cmp    %edx,%eax
+  800eb8:	73 04                	jae    800ebe <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800eba:	38 08                	cmp    %cl,(%eax)
+  800ebc:	75 f5                	jne    800eb3 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+
+00800ec0 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	57                   	push   %edi
+  800ec4:	56                   	push   %esi
+  800ec5:	53                   	push   %ebx
+  800ec6:	83 ec 1c             	sub    $0x1c,%esp
+  800ec9:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ecc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ecf:	eb 03                	jmp    800ed4 <strtol+0x14>
+		s++;
+  800ed1:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800ed4:	0f b6 06             	movzbl (%esi),%eax
+  800ed7:	3c 20                	cmp    $0x20,%al
+  800ed9:	74 f6                	je     800ed1 <strtol+0x11>
+  800edb:	3c 09                	cmp    $0x9,%al
+  800edd:	74 f2                	je     800ed1 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800edf:	3c 2b                	cmp    $0x2b,%al
+  800ee1:	74 43                	je     800f26 <strtol+0x66>
+	int neg = 0;
+  800ee3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800ee8:	3c 2d                	cmp    $0x2d,%al
+  800eea:	74 44                	je     800f30 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eec:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800ef2:	75 0f                	jne    800f03 <strtol+0x43>
+  800ef4:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ef7:	74 41                	je     800f3a <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ef9:	85 ff                	test   %edi,%edi
+  800efb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f00:	0f 44 f8             	cmove  %eax,%edi
+  800f03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f08:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800f0d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800f10:	89 fb                	mov    %edi,%ebx
+  800f12:	c1 fb 1f             	sar    $0x1f,%ebx
+  800f15:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800f18:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800f1b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800f1e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800f21:	89 75 08             	mov    %esi,0x8(%ebp)
+  800f24:	eb 67                	jmp    800f8d <strtol+0xcd>
+		s++;
+  800f26:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800f29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2e:	eb bc                	jmp    800eec <strtol+0x2c>
+		s++, neg = 1;
+  800f30:	83 c6 01             	add    $0x1,%esi
+  800f33:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f38:	eb b2                	jmp    800eec <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f3a:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800f3e:	74 0e                	je     800f4e <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800f40:	85 ff                	test   %edi,%edi
+  800f42:	75 bf                	jne    800f03 <strtol+0x43>
+		s++, base = 8;
+  800f44:	83 c6 01             	add    $0x1,%esi
+  800f47:	bf 08 00 00 00       	mov    $0x8,%edi
+  800f4c:	eb b5                	jmp    800f03 <strtol+0x43>
+		s += 2, base = 16;
+  800f4e:	83 c6 02             	add    $0x2,%esi
+  800f51:	bf 10 00 00 00       	mov    $0x10,%edi
+  800f56:	eb ab                	jmp    800f03 <strtol+0x43>
+			dig = *s - '0';
+  800f58:	0f be c9             	movsbl %cl,%ecx
+  800f5b:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800f5e:	39 f9                	cmp    %edi,%ecx
+  800f60:	7d 59                	jge    800fbb <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800f62:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800f66:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800f69:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f6c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800f6f:	0f af d8             	imul   %eax,%ebx
+  800f72:	0f af d7             	imul   %edi,%edx
+  800f75:	01 d3                	add    %edx,%ebx
+  800f77:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800f7a:	f7 e7                	mul    %edi
+  800f7c:	01 da                	add    %ebx,%edx
+  800f7e:	89 cb                	mov    %ecx,%ebx
+  800f80:	c1 fb 1f             	sar    $0x1f,%ebx
+  800f83:	01 c8                	add    %ecx,%eax
+  800f85:	11 da                	adc    %ebx,%edx
+  800f87:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800f8a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800f8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f90:	0f b6 08             	movzbl (%eax),%ecx
+  800f93:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800f96:	80 fb 09             	cmp    $0x9,%bl
+  800f99:	76 bd                	jbe    800f58 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800f9b:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800f9e:	80 fb 19             	cmp    $0x19,%bl
+  800fa1:	77 08                	ja     800fab <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800fa3:	0f be c9             	movsbl %cl,%ecx
+  800fa6:	83 e9 57             	sub    $0x57,%ecx
+  800fa9:	eb b3                	jmp    800f5e <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800fab:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800fae:	80 fb 19             	cmp    $0x19,%bl
+  800fb1:	77 08                	ja     800fbb <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800fb3:	0f be c9             	movsbl %cl,%ecx
+  800fb6:	83 e9 37             	sub    $0x37,%ecx
+  800fb9:	eb a3                	jmp    800f5e <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800fbb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800fbe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800fc1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800fc4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800fc7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800fcb:	74 05                	je     800fd2 <strtol+0x112>
+		*endptr = (char *) s;
+  800fcd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800fd0:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800fd2:	85 c9                	test   %ecx,%ecx
+  800fd4:	74 07                	je     800fdd <strtol+0x11d>
+  800fd6:	f7 d8                	neg    %eax
+  800fd8:	83 d2 00             	adc    $0x0,%edx
+  800fdb:	f7 da                	neg    %edx
+}
+  800fdd:	83 c4 1c             	add    $0x1c,%esp
+  800fe0:	5b                   	pop    %ebx
+  800fe1:	5e                   	pop    %esi
+  800fe2:	5f                   	pop    %edi
+  800fe3:	5d                   	pop    %ebp
+  800fe4:	c3                   	ret
+
+00800fe5 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800fe5:	55                   	push   %ebp
+  800fe6:	89 e5                	mov    %esp,%ebp
+  800fe8:	57                   	push   %edi
+  800fe9:	56                   	push   %esi
+  800fea:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800feb:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  800ff2:	74 18                	je     80100c <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fff:	89 c3                	mov    %eax,%ebx
+  801001:	89 c7                	mov    %eax,%edi
+  801003:	89 c6                	mov    %eax,%esi
+  801005:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801007:	5b                   	pop    %ebx
+  801008:	5e                   	pop    %esi
+  801009:	5f                   	pop    %edi
+  80100a:	5d                   	pop    %ebp
+  80100b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80100c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	89 c3                	mov    %eax,%ebx
+  801019:	89 c7                	mov    %eax,%edi
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	8d 35 26 10 80 00    	lea    0x801026,%esi
+  801024:	0f 34                	sysenter
+  801026:	5d                   	pop    %ebp
+		goto out;
+  801027:	eb de                	jmp    801007 <sys_cputs+0x22>
+
+00801029 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801029:	55                   	push   %ebp
+  80102a:	89 e5                	mov    %esp,%ebp
+  80102c:	57                   	push   %edi
+  80102d:	56                   	push   %esi
+  80102e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80102f:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801036:	74 19                	je     801051 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  801038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801042:	89 d1                	mov    %edx,%ecx
+  801044:	89 d3                	mov    %edx,%ebx
+  801046:	89 d7                	mov    %edx,%edi
+  801048:	89 d6                	mov    %edx,%esi
+  80104a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80104c:	5b                   	pop    %ebx
+  80104d:	5e                   	pop    %esi
+  80104e:	5f                   	pop    %edi
+  80104f:	5d                   	pop    %ebp
+  801050:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801051:	ba 00 00 00 00       	mov    $0x0,%edx
+  801056:	b8 01 00 00 00       	mov    $0x1,%eax
+  80105b:	89 d1                	mov    %edx,%ecx
+  80105d:	89 d3                	mov    %edx,%ebx
+  80105f:	89 d7                	mov    %edx,%edi
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	8d 35 6c 10 80 00    	lea    0x80106c,%esi
+  80106a:	0f 34                	sysenter
+  80106c:	5d                   	pop    %ebp
+		goto out;
+  80106d:	eb dd                	jmp    80104c <sys_cgetc+0x23>
+
+0080106f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+  801075:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801078:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80107f:	74 21                	je     8010a2 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  801081:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801086:	b8 03 00 00 00       	mov    $0x3,%eax
+  80108b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108e:	89 cb                	mov    %ecx,%ebx
+  801090:	89 cf                	mov    %ecx,%edi
+  801092:	89 ce                	mov    %ecx,%esi
+  801094:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801096:	85 c0                	test   %eax,%eax
+  801098:	7f 27                	jg     8010c1 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80109a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010aa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010af:	89 cb                	mov    %ecx,%ebx
+  8010b1:	89 cf                	mov    %ecx,%edi
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  8010b6:	8d 35 be 10 80 00    	lea    0x8010be,%esi
+  8010bc:	0f 34                	sysenter
+  8010be:	5d                   	pop    %ebp
+		goto out;
+  8010bf:	eb d5                	jmp    801096 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c1:	83 ec 0c             	sub    $0xc,%esp
+  8010c4:	50                   	push   %eax
+  8010c5:	6a 03                	push   $0x3
+  8010c7:	68 0b 42 80 00       	push   $0x80420b
+  8010cc:	6a 3f                	push   $0x3f
+  8010ce:	68 28 42 80 00       	push   $0x804228
+  8010d3:	e8 71 f4 ff ff       	call   800549 <_panic>
+
+008010d8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010de:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8010e5:	74 19                	je     801100 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  8010e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ec:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010f1:	89 d1                	mov    %edx,%ecx
+  8010f3:	89 d3                	mov    %edx,%ebx
+  8010f5:	89 d7                	mov    %edx,%edi
+  8010f7:	89 d6                	mov    %edx,%esi
+  8010f9:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8010fb:	5b                   	pop    %ebx
+  8010fc:	5e                   	pop    %esi
+  8010fd:	5f                   	pop    %edi
+  8010fe:	5d                   	pop    %ebp
+  8010ff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801100:	ba 00 00 00 00       	mov    $0x0,%edx
+  801105:	b8 02 00 00 00       	mov    $0x2,%eax
+  80110a:	89 d1                	mov    %edx,%ecx
+  80110c:	89 d3                	mov    %edx,%ebx
+  80110e:	89 d7                	mov    %edx,%edi
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	8d 35 1b 11 80 00    	lea    0x80111b,%esi
+  801119:	0f 34                	sysenter
+  80111b:	5d                   	pop    %ebp
+		goto out;
+  80111c:	eb dd                	jmp    8010fb <sys_getenvid+0x23>
+
+0080111e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80111e:	55                   	push   %ebp
+  80111f:	89 e5                	mov    %esp,%ebp
+  801121:	57                   	push   %edi
+  801122:	56                   	push   %esi
+  801123:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801124:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80112b:	74 19                	je     801146 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  80112d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801132:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801137:	89 d1                	mov    %edx,%ecx
+  801139:	89 d3                	mov    %edx,%ebx
+  80113b:	89 d7                	mov    %edx,%edi
+  80113d:	89 d6                	mov    %edx,%esi
+  80113f:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801141:	5b                   	pop    %ebx
+  801142:	5e                   	pop    %esi
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801150:	89 d1                	mov    %edx,%ecx
+  801152:	89 d3                	mov    %edx,%ebx
+  801154:	89 d7                	mov    %edx,%edi
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	8d 35 61 11 80 00    	lea    0x801161,%esi
+  80115f:	0f 34                	sysenter
+  801161:	5d                   	pop    %ebp
+		goto out;
+  801162:	eb dd                	jmp    801141 <sys_yield+0x23>
+
+00801164 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80116d:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801174:	74 23                	je     801199 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  801176:	be 00 00 00 00       	mov    $0x0,%esi
+  80117b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801180:	8b 55 08             	mov    0x8(%ebp),%edx
+  801183:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801186:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801189:	89 f7                	mov    %esi,%edi
+  80118b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118d:	85 c0                	test   %eax,%eax
+  80118f:	7f 29                	jg     8011ba <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801191:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801194:	5b                   	pop    %ebx
+  801195:	5e                   	pop    %esi
+  801196:	5f                   	pop    %edi
+  801197:	5d                   	pop    %ebp
+  801198:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801199:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119f:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	8d 35 b7 11 80 00    	lea    0x8011b7,%esi
+  8011b5:	0f 34                	sysenter
+  8011b7:	5d                   	pop    %ebp
+		goto out;
+  8011b8:	eb d3                	jmp    80118d <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ba:	83 ec 0c             	sub    $0xc,%esp
+  8011bd:	50                   	push   %eax
+  8011be:	6a 04                	push   $0x4
+  8011c0:	68 0b 42 80 00       	push   $0x80420b
+  8011c5:	6a 3f                	push   $0x3f
+  8011c7:	68 28 42 80 00       	push   $0x804228
+  8011cc:	e8 78 f3 ff ff       	call   800549 <_panic>
+
+008011d1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	57                   	push   %edi
+  8011d5:	56                   	push   %esi
+  8011d6:	53                   	push   %ebx
+  8011d7:	83 ec 0c             	sub    $0xc,%esp
+  8011da:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  8011dd:	85 f6                	test   %esi,%esi
+  8011df:	75 09                	jne    8011ea <sys_page_map+0x19>
+  8011e1:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8011e8:	74 1f                	je     801209 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  8011ea:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011fd:	85 c0                	test   %eax,%eax
+  8011ff:	7f 27                	jg     801228 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801204:	5b                   	pop    %ebx
+  801205:	5e                   	pop    %esi
+  801206:	5f                   	pop    %edi
+  801207:	5d                   	pop    %ebp
+  801208:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801214:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801217:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121a:	55                   	push   %ebp
+  80121b:	89 e5                	mov    %esp,%ebp
+  80121d:	8d 35 25 12 80 00    	lea    0x801225,%esi
+  801223:	0f 34                	sysenter
+  801225:	5d                   	pop    %ebp
+		goto out;
+  801226:	eb d5                	jmp    8011fd <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801228:	83 ec 0c             	sub    $0xc,%esp
+  80122b:	50                   	push   %eax
+  80122c:	6a 05                	push   $0x5
+  80122e:	68 0b 42 80 00       	push   $0x80420b
+  801233:	6a 3f                	push   $0x3f
+  801235:	68 28 42 80 00       	push   $0x804228
+  80123a:	e8 0a f3 ff ff       	call   800549 <_panic>
+
+0080123f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	56                   	push   %esi
+  801244:	53                   	push   %ebx
+  801245:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801248:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80124f:	74 22                	je     801273 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  801251:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801256:	b8 06 00 00 00       	mov    $0x6,%eax
+  80125b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801261:	89 df                	mov    %ebx,%edi
+  801263:	89 de                	mov    %ebx,%esi
+  801265:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801267:	85 c0                	test   %eax,%eax
+  801269:	7f 28                	jg     801293 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80126b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80126e:	5b                   	pop    %ebx
+  80126f:	5e                   	pop    %esi
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801278:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801283:	89 df                	mov    %ebx,%edi
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	8d 35 90 12 80 00    	lea    0x801290,%esi
+  80128e:	0f 34                	sysenter
+  801290:	5d                   	pop    %ebp
+		goto out;
+  801291:	eb d4                	jmp    801267 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801293:	83 ec 0c             	sub    $0xc,%esp
+  801296:	50                   	push   %eax
+  801297:	6a 06                	push   $0x6
+  801299:	68 0b 42 80 00       	push   $0x80420b
+  80129e:	6a 3f                	push   $0x3f
+  8012a0:	68 28 42 80 00       	push   $0x804228
+  8012a5:	e8 9f f2 ff ff       	call   800549 <_panic>
+
+008012aa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8012aa:	55                   	push   %ebp
+  8012ab:	89 e5                	mov    %esp,%ebp
+  8012ad:	57                   	push   %edi
+  8012ae:	56                   	push   %esi
+  8012af:	53                   	push   %ebx
+  8012b0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012b3:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8012ba:	74 22                	je     8012de <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  8012bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cc:	89 df                	mov    %ebx,%edi
+  8012ce:	89 de                	mov    %ebx,%esi
+  8012d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012d2:	85 c0                	test   %eax,%eax
+  8012d4:	7f 28                	jg     8012fe <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8012d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d9:	5b                   	pop    %ebx
+  8012da:	5e                   	pop    %esi
+  8012db:	5f                   	pop    %edi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012ee:	89 df                	mov    %ebx,%edi
+  8012f0:	55                   	push   %ebp
+  8012f1:	89 e5                	mov    %esp,%ebp
+  8012f3:	8d 35 fb 12 80 00    	lea    0x8012fb,%esi
+  8012f9:	0f 34                	sysenter
+  8012fb:	5d                   	pop    %ebp
+		goto out;
+  8012fc:	eb d4                	jmp    8012d2 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012fe:	83 ec 0c             	sub    $0xc,%esp
+  801301:	50                   	push   %eax
+  801302:	6a 08                	push   $0x8
+  801304:	68 0b 42 80 00       	push   $0x80420b
+  801309:	6a 3f                	push   $0x3f
+  80130b:	68 28 42 80 00       	push   $0x804228
+  801310:	e8 34 f2 ff ff       	call   800549 <_panic>
+
+00801315 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801315:	55                   	push   %ebp
+  801316:	89 e5                	mov    %esp,%ebp
+  801318:	57                   	push   %edi
+  801319:	56                   	push   %esi
+  80131a:	53                   	push   %ebx
+  80131b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80131e:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801325:	74 22                	je     801349 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  801327:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801331:	8b 55 08             	mov    0x8(%ebp),%edx
+  801334:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801337:	89 df                	mov    %ebx,%edi
+  801339:	89 de                	mov    %ebx,%esi
+  80133b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80133d:	85 c0                	test   %eax,%eax
+  80133f:	7f 28                	jg     801369 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801341:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801344:	5b                   	pop    %ebx
+  801345:	5e                   	pop    %esi
+  801346:	5f                   	pop    %edi
+  801347:	5d                   	pop    %ebp
+  801348:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801354:	b8 09 00 00 00       	mov    $0x9,%eax
+  801359:	89 df                	mov    %ebx,%edi
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+  80135e:	8d 35 66 13 80 00    	lea    0x801366,%esi
+  801364:	0f 34                	sysenter
+  801366:	5d                   	pop    %ebp
+		goto out;
+  801367:	eb d4                	jmp    80133d <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801369:	83 ec 0c             	sub    $0xc,%esp
+  80136c:	50                   	push   %eax
+  80136d:	6a 09                	push   $0x9
+  80136f:	68 0b 42 80 00       	push   $0x80420b
+  801374:	6a 3f                	push   $0x3f
+  801376:	68 28 42 80 00       	push   $0x804228
+  80137b:	e8 c9 f1 ff ff       	call   800549 <_panic>
+
+00801380 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801380:	55                   	push   %ebp
+  801381:	89 e5                	mov    %esp,%ebp
+  801383:	57                   	push   %edi
+  801384:	56                   	push   %esi
+  801385:	53                   	push   %ebx
+  801386:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801389:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801390:	74 22                	je     8013b4 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801392:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801397:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80139c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a2:	89 df                	mov    %ebx,%edi
+  8013a4:	89 de                	mov    %ebx,%esi
+  8013a6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	7f 28                	jg     8013d4 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8013ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013c4:	89 df                	mov    %ebx,%edi
+  8013c6:	55                   	push   %ebp
+  8013c7:	89 e5                	mov    %esp,%ebp
+  8013c9:	8d 35 d1 13 80 00    	lea    0x8013d1,%esi
+  8013cf:	0f 34                	sysenter
+  8013d1:	5d                   	pop    %ebp
+		goto out;
+  8013d2:	eb d4                	jmp    8013a8 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013d4:	83 ec 0c             	sub    $0xc,%esp
+  8013d7:	50                   	push   %eax
+  8013d8:	6a 0a                	push   $0xa
+  8013da:	68 0b 42 80 00       	push   $0x80420b
+  8013df:	6a 3f                	push   $0x3f
+  8013e1:	68 28 42 80 00       	push   $0x804228
+  8013e6:	e8 5e f1 ff ff       	call   800549 <_panic>
+
+008013eb <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  8013eb:	55                   	push   %ebp
+  8013ec:	89 e5                	mov    %esp,%ebp
+  8013ee:	57                   	push   %edi
+  8013ef:	56                   	push   %esi
+  8013f0:	53                   	push   %ebx
+  8013f1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013f4:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8013fb:	74 22                	je     80141f <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8013fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801402:	b8 17 00 00 00       	mov    $0x17,%eax
+  801407:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140d:	89 df                	mov    %ebx,%edi
+  80140f:	89 de                	mov    %ebx,%esi
+  801411:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801413:	85 c0                	test   %eax,%eax
+  801415:	7f 28                	jg     80143f <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801417:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141a:	5b                   	pop    %ebx
+  80141b:	5e                   	pop    %esi
+  80141c:	5f                   	pop    %edi
+  80141d:	5d                   	pop    %ebp
+  80141e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80141f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801424:	8b 55 08             	mov    0x8(%ebp),%edx
+  801427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142a:	b8 17 00 00 00       	mov    $0x17,%eax
+  80142f:	89 df                	mov    %ebx,%edi
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+  801434:	8d 35 3c 14 80 00    	lea    0x80143c,%esi
+  80143a:	0f 34                	sysenter
+  80143c:	5d                   	pop    %ebp
+		goto out;
+  80143d:	eb d4                	jmp    801413 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+  801442:	50                   	push   %eax
+  801443:	6a 17                	push   $0x17
+  801445:	68 0b 42 80 00       	push   $0x80420b
+  80144a:	6a 3f                	push   $0x3f
+  80144c:	68 28 42 80 00       	push   $0x804228
+  801451:	e8 f3 f0 ff ff       	call   800549 <_panic>
+
+00801456 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801456:	55                   	push   %ebp
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	57                   	push   %edi
+  80145a:	56                   	push   %esi
+  80145b:	53                   	push   %ebx
+  80145c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80145f:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801466:	74 22                	je     80148a <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801468:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801472:	8b 55 08             	mov    0x8(%ebp),%edx
+  801475:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801478:	89 df                	mov    %ebx,%edi
+  80147a:	89 de                	mov    %ebx,%esi
+  80147c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80147e:	85 c0                	test   %eax,%eax
+  801480:	7f 28                	jg     8014aa <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801482:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5f                   	pop    %edi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80148a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801492:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801495:	b8 18 00 00 00       	mov    $0x18,%eax
+  80149a:	89 df                	mov    %ebx,%edi
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	8d 35 a7 14 80 00    	lea    0x8014a7,%esi
+  8014a5:	0f 34                	sysenter
+  8014a7:	5d                   	pop    %ebp
+		goto out;
+  8014a8:	eb d4                	jmp    80147e <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014aa:	83 ec 0c             	sub    $0xc,%esp
+  8014ad:	50                   	push   %eax
+  8014ae:	6a 18                	push   $0x18
+  8014b0:	68 0b 42 80 00       	push   $0x80420b
+  8014b5:	6a 3f                	push   $0x3f
+  8014b7:	68 28 42 80 00       	push   $0x804228
+  8014bc:	e8 88 f0 ff ff       	call   800549 <_panic>
+
+008014c1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	57                   	push   %edi
+  8014c5:	56                   	push   %esi
+  8014c6:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014c7:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8014ce:	74 1d                	je     8014ed <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8014d0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8014da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014e6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5f                   	pop    %edi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	8d 35 09 15 80 00    	lea    0x801509,%esi
+  801507:	0f 34                	sysenter
+  801509:	5d                   	pop    %ebp
+		goto out;
+  80150a:	eb dc                	jmp    8014e8 <sys_ipc_try_send+0x27>
+
+0080150c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80150c:	55                   	push   %ebp
+  80150d:	89 e5                	mov    %esp,%ebp
+  80150f:	57                   	push   %edi
+  801510:	56                   	push   %esi
+  801511:	53                   	push   %ebx
+  801512:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801515:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80151c:	74 21                	je     80153f <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80151e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801523:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801528:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152b:	89 cb                	mov    %ecx,%ebx
+  80152d:	89 cf                	mov    %ecx,%edi
+  80152f:	89 ce                	mov    %ecx,%esi
+  801531:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801533:	85 c0                	test   %eax,%eax
+  801535:	7f 27                	jg     80155e <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801537:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153a:	5b                   	pop    %ebx
+  80153b:	5e                   	pop    %esi
+  80153c:	5f                   	pop    %edi
+  80153d:	5d                   	pop    %ebp
+  80153e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80153f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801542:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801547:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80154c:	89 cb                	mov    %ecx,%ebx
+  80154e:	89 cf                	mov    %ecx,%edi
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	8d 35 5b 15 80 00    	lea    0x80155b,%esi
+  801559:	0f 34                	sysenter
+  80155b:	5d                   	pop    %ebp
+		goto out;
+  80155c:	eb d5                	jmp    801533 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80155e:	83 ec 0c             	sub    $0xc,%esp
+  801561:	50                   	push   %eax
+  801562:	6a 0d                	push   $0xd
+  801564:	68 0b 42 80 00       	push   $0x80420b
+  801569:	6a 3f                	push   $0x3f
+  80156b:	68 28 42 80 00       	push   $0x804228
+  801570:	e8 d4 ef ff ff       	call   800549 <_panic>
+
+00801575 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801575:	55                   	push   %ebp
+  801576:	89 e5                	mov    %esp,%ebp
+  801578:	57                   	push   %edi
+  801579:	56                   	push   %esi
+  80157a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80157b:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801582:	74 1b                	je     80159f <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801584:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801589:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80158e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801591:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801594:	89 df                	mov    %ebx,%edi
+  801596:	89 de                	mov    %ebx,%esi
+  801598:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80159a:	5b                   	pop    %ebx
+  80159b:	5e                   	pop    %esi
+  80159c:	5f                   	pop    %edi
+  80159d:	5d                   	pop    %ebp
+  80159e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80159f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015aa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015af:	89 df                	mov    %ebx,%edi
+  8015b1:	55                   	push   %ebp
+  8015b2:	89 e5                	mov    %esp,%ebp
+  8015b4:	8d 35 bc 15 80 00    	lea    0x8015bc,%esi
+  8015ba:	0f 34                	sysenter
+  8015bc:	5d                   	pop    %ebp
+		goto out;
+  8015bd:	eb db                	jmp    80159a <sys_ipc_recv_until+0x25>
+
+008015bf <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8015bf:	55                   	push   %ebp
+  8015c0:	89 e5                	mov    %esp,%ebp
+  8015c2:	57                   	push   %edi
+  8015c3:	56                   	push   %esi
+  8015c4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015c5:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8015cc:	74 19                	je     8015e7 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8015ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015d8:	89 d1                	mov    %edx,%ecx
+  8015da:	89 d3                	mov    %edx,%ebx
+  8015dc:	89 d7                	mov    %edx,%edi
+  8015de:	89 d6                	mov    %edx,%esi
+  8015e0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8015e2:	5b                   	pop    %ebx
+  8015e3:	5e                   	pop    %esi
+  8015e4:	5f                   	pop    %edi
+  8015e5:	5d                   	pop    %ebp
+  8015e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8015f1:	89 d1                	mov    %edx,%ecx
+  8015f3:	89 d3                	mov    %edx,%ebx
+  8015f5:	89 d7                	mov    %edx,%edi
+  8015f7:	55                   	push   %ebp
+  8015f8:	89 e5                	mov    %esp,%ebp
+  8015fa:	8d 35 02 16 80 00    	lea    0x801602,%esi
+  801600:	0f 34                	sysenter
+  801602:	5d                   	pop    %ebp
+		goto out;
+  801603:	eb dd                	jmp    8015e2 <sys_time_msec+0x23>
+
+00801605 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801605:	55                   	push   %ebp
+  801606:	89 e5                	mov    %esp,%ebp
+  801608:	57                   	push   %edi
+  801609:	56                   	push   %esi
+  80160a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80160b:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801612:	74 1a                	je     80162e <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801614:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801619:	b8 10 00 00 00       	mov    $0x10,%eax
+  80161e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801621:	89 cb                	mov    %ecx,%ebx
+  801623:	89 cf                	mov    %ecx,%edi
+  801625:	89 ce                	mov    %ecx,%esi
+  801627:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  801629:	5b                   	pop    %ebx
+  80162a:	5e                   	pop    %esi
+  80162b:	5f                   	pop    %edi
+  80162c:	5d                   	pop    %ebp
+  80162d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80162e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801631:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801636:	b8 10 00 00 00       	mov    $0x10,%eax
+  80163b:	89 cb                	mov    %ecx,%ebx
+  80163d:	89 cf                	mov    %ecx,%edi
+  80163f:	55                   	push   %ebp
+  801640:	89 e5                	mov    %esp,%ebp
+  801642:	8d 35 4a 16 80 00    	lea    0x80164a,%esi
+  801648:	0f 34                	sysenter
+  80164a:	5d                   	pop    %ebp
+		goto out;
+  80164b:	eb dc                	jmp    801629 <sys_sleep_until+0x24>
+
+0080164d <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	57                   	push   %edi
+  801651:	56                   	push   %esi
+  801652:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801653:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  80165a:	74 1a                	je     801676 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  80165c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801661:	b8 11 00 00 00       	mov    $0x11,%eax
+  801666:	8b 55 08             	mov    0x8(%ebp),%edx
+  801669:	89 cb                	mov    %ecx,%ebx
+  80166b:	89 cf                	mov    %ecx,%edi
+  80166d:	89 ce                	mov    %ecx,%esi
+  80166f:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801671:	5b                   	pop    %ebx
+  801672:	5e                   	pop    %esi
+  801673:	5f                   	pop    %edi
+  801674:	5d                   	pop    %ebp
+  801675:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801676:	8b 55 08             	mov    0x8(%ebp),%edx
+  801679:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80167e:	b8 11 00 00 00       	mov    $0x11,%eax
+  801683:	89 cb                	mov    %ecx,%ebx
+  801685:	89 cf                	mov    %ecx,%edi
+  801687:	55                   	push   %ebp
+  801688:	89 e5                	mov    %esp,%ebp
+  80168a:	8d 35 92 16 80 00    	lea    0x801692,%esi
+  801690:	0f 34                	sysenter
+  801692:	5d                   	pop    %ebp
+		goto out;
+  801693:	eb dc                	jmp    801671 <sys_env_print_stats+0x24>
+
+00801695 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801695:	55                   	push   %ebp
+  801696:	89 e5                	mov    %esp,%ebp
+  801698:	57                   	push   %edi
+  801699:	56                   	push   %esi
+  80169a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80169b:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8016a2:	74 1b                	je     8016bf <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8016a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b4:	89 df                	mov    %ebx,%edi
+  8016b6:	89 de                	mov    %ebx,%esi
+  8016b8:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8016ba:	5b                   	pop    %ebx
+  8016bb:	5e                   	pop    %esi
+  8016bc:	5f                   	pop    %edi
+  8016bd:	5d                   	pop    %ebp
+  8016be:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ca:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016cf:	89 df                	mov    %ebx,%edi
+  8016d1:	55                   	push   %ebp
+  8016d2:	89 e5                	mov    %esp,%ebp
+  8016d4:	8d 35 dc 16 80 00    	lea    0x8016dc,%esi
+  8016da:	0f 34                	sysenter
+  8016dc:	5d                   	pop    %ebp
+		goto out;
+  8016dd:	eb db                	jmp    8016ba <sys_perf+0x25>
+
+008016df <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8016df:	55                   	push   %ebp
+  8016e0:	89 e5                	mov    %esp,%ebp
+  8016e2:	57                   	push   %edi
+  8016e3:	56                   	push   %esi
+  8016e4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016e5:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8016ec:	74 19                	je     801707 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8016ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8016f8:	89 d1                	mov    %edx,%ecx
+  8016fa:	89 d3                	mov    %edx,%ebx
+  8016fc:	89 d7                	mov    %edx,%edi
+  8016fe:	89 d6                	mov    %edx,%esi
+  801700:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801702:	5b                   	pop    %ebx
+  801703:	5e                   	pop    %esi
+  801704:	5f                   	pop    %edi
+  801705:	5d                   	pop    %ebp
+  801706:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801707:	ba 00 00 00 00       	mov    $0x0,%edx
+  80170c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801711:	89 d1                	mov    %edx,%ecx
+  801713:	89 d3                	mov    %edx,%ebx
+  801715:	89 d7                	mov    %edx,%edi
+  801717:	55                   	push   %ebp
+  801718:	89 e5                	mov    %esp,%ebp
+  80171a:	8d 35 22 17 80 00    	lea    0x801722,%esi
+  801720:	0f 34                	sysenter
+  801722:	5d                   	pop    %ebp
+		goto out;
+  801723:	eb dd                	jmp    801702 <sys_fork+0x23>
+
+00801725 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801725:	55                   	push   %ebp
+  801726:	89 e5                	mov    %esp,%ebp
+  801728:	57                   	push   %edi
+  801729:	56                   	push   %esi
+  80172a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80172b:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801732:	74 1c                	je     801750 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801734:	be 00 00 00 00       	mov    $0x0,%esi
+  801739:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80173e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801741:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801744:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801747:	89 f7                	mov    %esi,%edi
+  801749:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80174b:	5b                   	pop    %ebx
+  80174c:	5e                   	pop    %esi
+  80174d:	5f                   	pop    %edi
+  80174e:	5d                   	pop    %ebp
+  80174f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801750:	8b 55 08             	mov    0x8(%ebp),%edx
+  801753:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801756:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80175b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801760:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801763:	55                   	push   %ebp
+  801764:	89 e5                	mov    %esp,%ebp
+  801766:	8d 35 6e 17 80 00    	lea    0x80176e,%esi
+  80176c:	0f 34                	sysenter
+  80176e:	5d                   	pop    %ebp
+		goto out;
+  80176f:	eb da                	jmp    80174b <sys_thread_create+0x26>
+
+00801771 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801771:	55                   	push   %ebp
+  801772:	89 e5                	mov    %esp,%ebp
+  801774:	57                   	push   %edi
+  801775:	56                   	push   %esi
+  801776:	53                   	push   %ebx
+  801777:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80177a:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801781:	74 24                	je     8017a7 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801783:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801788:	be 00 00 00 00       	mov    $0x0,%esi
+  80178d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801790:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801793:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801796:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801799:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80179b:	85 c0                	test   %eax,%eax
+  80179d:	7f 27                	jg     8017c6 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  80179f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a2:	5b                   	pop    %ebx
+  8017a3:	5e                   	pop    %esi
+  8017a4:	5f                   	pop    %edi
+  8017a5:	5d                   	pop    %ebp
+  8017a6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ad:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8017b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8017b8:	55                   	push   %ebp
+  8017b9:	89 e5                	mov    %esp,%ebp
+  8017bb:	8d 35 c3 17 80 00    	lea    0x8017c3,%esi
+  8017c1:	0f 34                	sysenter
+  8017c3:	5d                   	pop    %ebp
+		goto out;
+  8017c4:	eb d5                	jmp    80179b <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017c6:	83 ec 0c             	sub    $0xc,%esp
+  8017c9:	50                   	push   %eax
+  8017ca:	6a 1f                	push   $0x1f
+  8017cc:	68 0b 42 80 00       	push   $0x80420b
+  8017d1:	6a 3f                	push   $0x3f
+  8017d3:	68 28 42 80 00       	push   $0x804228
+  8017d8:	e8 6c ed ff ff       	call   800549 <_panic>
+
+008017dd <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8017dd:	55                   	push   %ebp
+  8017de:	89 e5                	mov    %esp,%ebp
+  8017e0:	57                   	push   %edi
+  8017e1:	56                   	push   %esi
+  8017e2:	53                   	push   %ebx
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017e6:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8017ed:	74 23                	je     801812 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8017ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8017f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801802:	89 f7                	mov    %esi,%edi
+  801804:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801806:	85 c0                	test   %eax,%eax
+  801808:	7f 29                	jg     801833 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80180a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80180d:	5b                   	pop    %ebx
+  80180e:	5e                   	pop    %esi
+  80180f:	5f                   	pop    %edi
+  801810:	5d                   	pop    %ebp
+  801811:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801812:	8b 55 08             	mov    0x8(%ebp),%edx
+  801815:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801818:	b8 20 00 00 00       	mov    $0x20,%eax
+  80181d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801822:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801825:	55                   	push   %ebp
+  801826:	89 e5                	mov    %esp,%ebp
+  801828:	8d 35 30 18 80 00    	lea    0x801830,%esi
+  80182e:	0f 34                	sysenter
+  801830:	5d                   	pop    %ebp
+		goto out;
+  801831:	eb d3                	jmp    801806 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801833:	83 ec 0c             	sub    $0xc,%esp
+  801836:	50                   	push   %eax
+  801837:	6a 20                	push   $0x20
+  801839:	68 0b 42 80 00       	push   $0x80420b
+  80183e:	6a 3f                	push   $0x3f
+  801840:	68 28 42 80 00       	push   $0x804228
+  801845:	e8 ff ec ff ff       	call   800549 <_panic>
+
+0080184a <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80184a:	55                   	push   %ebp
+  80184b:	89 e5                	mov    %esp,%ebp
+  80184d:	57                   	push   %edi
+  80184e:	56                   	push   %esi
+  80184f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801850:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801857:	74 1b                	je     801874 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801859:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801863:	8b 55 08             	mov    0x8(%ebp),%edx
+  801866:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801869:	89 df                	mov    %ebx,%edi
+  80186b:	89 de                	mov    %ebx,%esi
+  80186d:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80186f:	5b                   	pop    %ebx
+  801870:	5e                   	pop    %esi
+  801871:	5f                   	pop    %edi
+  801872:	5d                   	pop    %ebp
+  801873:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801874:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801879:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801884:	89 df                	mov    %ebx,%edi
+  801886:	55                   	push   %ebp
+  801887:	89 e5                	mov    %esp,%ebp
+  801889:	8d 35 91 18 80 00    	lea    0x801891,%esi
+  80188f:	0f 34                	sysenter
+  801891:	5d                   	pop    %ebp
+		goto out;
+  801892:	eb db                	jmp    80186f <sys_batch+0x25>
+
+00801894 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	57                   	push   %edi
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80189a:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8018a1:	74 1a                	je     8018bd <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8018a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b0:	89 cb                	mov    %ecx,%ebx
+  8018b2:	89 cf                	mov    %ecx,%edi
+  8018b4:	89 ce                	mov    %ecx,%esi
+  8018b6:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8018b8:	5b                   	pop    %ebx
+  8018b9:	5e                   	pop    %esi
+  8018ba:	5f                   	pop    %edi
+  8018bb:	5d                   	pop    %ebp
+  8018bc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8018ca:	89 cb                	mov    %ecx,%ebx
+  8018cc:	89 cf                	mov    %ecx,%edi
+  8018ce:	55                   	push   %ebp
+  8018cf:	89 e5                	mov    %esp,%ebp
+  8018d1:	8d 35 d9 18 80 00    	lea    0x8018d9,%esi
+  8018d7:	0f 34                	sysenter
+  8018d9:	5d                   	pop    %ebp
+		goto out;
+  8018da:	eb dc                	jmp    8018b8 <sys_trace_ctl+0x24>
+
+008018dc <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8018dc:	55                   	push   %ebp
+  8018dd:	89 e5                	mov    %esp,%ebp
+  8018df:	57                   	push   %edi
+  8018e0:	56                   	push   %esi
+  8018e1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018e2:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8018e9:	74 1c                	je     801907 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8018eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8018f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018fe:	89 f7                	mov    %esi,%edi
+  801900:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801902:	5b                   	pop    %ebx
+  801903:	5e                   	pop    %esi
+  801904:	5f                   	pop    %edi
+  801905:	5d                   	pop    %ebp
+  801906:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801907:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80190d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801912:	bf 00 00 00 00       	mov    $0x0,%edi
+  801917:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80191a:	55                   	push   %ebp
+  80191b:	89 e5                	mov    %esp,%ebp
+  80191d:	8d 35 25 19 80 00    	lea    0x801925,%esi
+  801923:	0f 34                	sysenter
+  801925:	5d                   	pop    %ebp
+		goto out;
+  801926:	eb da                	jmp    801902 <sys_trace_read+0x26>
+
+00801928 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	57                   	push   %edi
+  80192c:	56                   	push   %esi
+  80192d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80192e:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801935:	74 1c                	je     801953 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  801937:	be 00 00 00 00       	mov    $0x0,%esi
+  80193c:	b8 21 00 00 00       	mov    $0x21,%eax
+  801941:	8b 55 08             	mov    0x8(%ebp),%edx
+  801944:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801947:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80194a:	89 f7                	mov    %esi,%edi
+  80194c:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  80194e:	5b                   	pop    %ebx
+  80194f:	5e                   	pop    %esi
+  801950:	5f                   	pop    %edi
+  801951:	5d                   	pop    %ebp
+  801952:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801953:	8b 55 08             	mov    0x8(%ebp),%edx
+  801956:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801959:	b8 21 00 00 00       	mov    $0x21,%eax
+  80195e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801963:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801966:	55                   	push   %ebp
+  801967:	89 e5                	mov    %esp,%ebp
+  801969:	8d 35 71 19 80 00    	lea    0x801971,%esi
+  80196f:	0f 34                	sysenter
+  801971:	5d                   	pop    %ebp
+		goto out;
+  801972:	eb da                	jmp    80194e <sys_meminfo+0x26>
+
+00801974 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801974:	55                   	push   %ebp
+  801975:	89 e5                	mov    %esp,%ebp
+  801977:	57                   	push   %edi
+  801978:	56                   	push   %esi
+  801979:	53                   	push   %ebx
+  80197a:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  80197d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801981:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801988:	74 1f                	je     8019a9 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80198a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198f:	b8 22 00 00 00       	mov    $0x22,%eax
+  801994:	8b 55 08             	mov    0x8(%ebp),%edx
+  801997:	89 df                	mov    %ebx,%edi
+  801999:	89 de                	mov    %ebx,%esi
+  80199b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80199d:	85 c0                	test   %eax,%eax
+  80199f:	7f 25                	jg     8019c6 <sys_env_set_ksm+0x52>
+}
+  8019a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a4:	5b                   	pop    %ebx
+  8019a5:	5e                   	pop    %esi
+  8019a6:	5f                   	pop    %edi
+  8019a7:	5d                   	pop    %ebp
+  8019a8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8019a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b1:	b8 22 00 00 00       	mov    $0x22,%eax
+  8019b6:	89 df                	mov    %ebx,%edi
+  8019b8:	55                   	push   %ebp
+  8019b9:	89 e5                	mov    %esp,%ebp
+  8019bb:	8d 35 c3 19 80 00    	lea    0x8019c3,%esi
+  8019c1:	0f 34                	sysenter
+  8019c3:	5d                   	pop    %ebp
+		goto out;
+  8019c4:	eb d7                	jmp    80199d <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019c6:	83 ec 0c             	sub    $0xc,%esp
+  8019c9:	50                   	push   %eax
+  8019ca:	6a 22                	push   $0x22
+  8019cc:	68 0b 42 80 00       	push   $0x80420b
+  8019d1:	6a 3f                	push   $0x3f
+  8019d3:	68 28 42 80 00       	push   $0x804228
+  8019d8:	e8 6c eb ff ff       	call   800549 <_panic>
+
+008019dd <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8019dd:	55                   	push   %ebp
+  8019de:	89 e5                	mov    %esp,%ebp
+  8019e0:	57                   	push   %edi
+  8019e1:	56                   	push   %esi
+  8019e2:	53                   	push   %ebx
+  8019e3:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8019e6:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8019e9:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  8019f0:	74 24                	je     801a16 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8019f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019f7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8019fc:	89 cb                	mov    %ecx,%ebx
+  8019fe:	89 cf                	mov    %ecx,%edi
+  801a00:	89 ce                	mov    %ecx,%esi
+  801a02:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a04:	85 c0                	test   %eax,%eax
+  801a06:	7f 2a                	jg     801a32 <sys_time_nsec+0x55>
+	return ns;
+}
+  801a08:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a0b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a11:	5b                   	pop    %ebx
+  801a12:	5e                   	pop    %esi
+  801a13:	5f                   	pop    %edi
+  801a14:	5d                   	pop    %ebp
+  801a15:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a1b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801a20:	89 cb                	mov    %ecx,%ebx
+  801a22:	89 cf                	mov    %ecx,%edi
+  801a24:	55                   	push   %ebp
+  801a25:	89 e5                	mov    %esp,%ebp
+  801a27:	8d 35 2f 1a 80 00    	lea    0x801a2f,%esi
+  801a2d:	0f 34                	sysenter
+  801a2f:	5d                   	pop    %ebp
+		goto out;
+  801a30:	eb d2                	jmp    801a04 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a32:	83 ec 0c             	sub    $0xc,%esp
+  801a35:	50                   	push   %eax
+  801a36:	6a 0f                	push   $0xf
+  801a38:	68 0b 42 80 00       	push   $0x80420b
+  801a3d:	6a 3f                	push   $0x3f
+  801a3f:	68 28 42 80 00       	push   $0x804228
+  801a44:	e8 00 eb ff ff       	call   800549 <_panic>
+
+00801a49 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  801a49:	55                   	push   %ebp
+  801a4a:	89 e5                	mov    %esp,%ebp
+  801a4c:	57                   	push   %edi
+  801a4d:	56                   	push   %esi
+  801a4e:	53                   	push   %ebx
+  801a4f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801a52:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801a59:	74 22                	je     801a7d <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801a5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a60:	b8 12 00 00 00       	mov    $0x12,%eax
+  801a65:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a6b:	89 df                	mov    %ebx,%edi
+  801a6d:	89 de                	mov    %ebx,%esi
+  801a6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	7f 28                	jg     801a9d <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801a75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a78:	5b                   	pop    %ebx
+  801a79:	5e                   	pop    %esi
+  801a7a:	5f                   	pop    %edi
+  801a7b:	5d                   	pop    %ebp
+  801a7c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801a7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a82:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a88:	b8 12 00 00 00       	mov    $0x12,%eax
+  801a8d:	89 df                	mov    %ebx,%edi
+  801a8f:	55                   	push   %ebp
+  801a90:	89 e5                	mov    %esp,%ebp
+  801a92:	8d 35 9a 1a 80 00    	lea    0x801a9a,%esi
+  801a98:	0f 34                	sysenter
+  801a9a:	5d                   	pop    %ebp
+		goto out;
+  801a9b:	eb d4                	jmp    801a71 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a9d:	83 ec 0c             	sub    $0xc,%esp
+  801aa0:	50                   	push   %eax
+  801aa1:	6a 12                	push   $0x12
+  801aa3:	68 0b 42 80 00       	push   $0x80420b
+  801aa8:	6a 3f                	push   $0x3f
+  801aaa:	68 28 42 80 00       	push   $0x804228
+  801aaf:	e8 95 ea ff ff       	call   800549 <_panic>
+
+00801ab4 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801ab4:	55                   	push   %ebp
+  801ab5:	89 e5                	mov    %esp,%ebp
+  801ab7:	57                   	push   %edi
+  801ab8:	56                   	push   %esi
+  801ab9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801aba:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801ac1:	74 1b                	je     801ade <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801ac3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac8:	b8 13 00 00 00       	mov    $0x13,%eax
+  801acd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad3:	89 df                	mov    %ebx,%edi
+  801ad5:	89 de                	mov    %ebx,%esi
+  801ad7:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801ad9:	5b                   	pop    %ebx
+  801ada:	5e                   	pop    %esi
+  801adb:	5f                   	pop    %edi
+  801adc:	5d                   	pop    %ebp
+  801add:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801ade:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ae6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ae9:	b8 13 00 00 00       	mov    $0x13,%eax
+  801aee:	89 df                	mov    %ebx,%edi
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	8d 35 fb 1a 80 00    	lea    0x801afb,%esi
+  801af9:	0f 34                	sysenter
+  801afb:	5d                   	pop    %ebp
+		goto out;
+  801afc:	eb db                	jmp    801ad9 <sys_e1000_receive+0x25>
+
+00801afe <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801afe:	55                   	push   %ebp
+  801aff:	89 e5                	mov    %esp,%ebp
+  801b01:	57                   	push   %edi
+  801b02:	56                   	push   %esi
+  801b03:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b04:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801b0b:	74 1b                	je     801b28 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801b0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b12:	b8 14 00 00 00       	mov    $0x14,%eax
+  801b17:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b1d:	89 df                	mov    %ebx,%edi
+  801b1f:	89 de                	mov    %ebx,%esi
+  801b21:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801b23:	5b                   	pop    %ebx
+  801b24:	5e                   	pop    %esi
+  801b25:	5f                   	pop    %edi
+  801b26:	5d                   	pop    %ebp
+  801b27:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b33:	b8 14 00 00 00       	mov    $0x14,%eax
+  801b38:	89 df                	mov    %ebx,%edi
+  801b3a:	55                   	push   %ebp
+  801b3b:	89 e5                	mov    %esp,%ebp
+  801b3d:	8d 35 45 1b 80 00    	lea    0x801b45,%esi
+  801b43:	0f 34                	sysenter
+  801b45:	5d                   	pop    %ebp
+		goto out;
+  801b46:	eb db                	jmp    801b23 <sys_e1000_read_hwaddr+0x25>
+
+00801b48 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  801b48:	55                   	push   %ebp
+  801b49:	89 e5                	mov    %esp,%ebp
+  801b4b:	57                   	push   %edi
+  801b4c:	56                   	push   %esi
+  801b4d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b4e:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801b55:	74 1a                	je     801b71 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801b57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b5c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801b61:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b64:	89 cb                	mov    %ecx,%ebx
+  801b66:	89 cf                	mov    %ecx,%edi
+  801b68:	89 ce                	mov    %ecx,%esi
+  801b6a:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801b6c:	5b                   	pop    %ebx
+  801b6d:	5e                   	pop    %esi
+  801b6e:	5f                   	pop    %edi
+  801b6f:	5d                   	pop    %ebp
+  801b70:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801b71:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b79:	b8 15 00 00 00       	mov    $0x15,%eax
+  801b7e:	89 cb                	mov    %ecx,%ebx
+  801b80:	89 cf                	mov    %ecx,%edi
+  801b82:	55                   	push   %ebp
+  801b83:	89 e5                	mov    %esp,%ebp
+  801b85:	8d 35 8d 1b 80 00    	lea    0x801b8d,%esi
+  801b8b:	0f 34                	sysenter
+  801b8d:	5d                   	pop    %ebp
+		goto out;
+  801b8e:	eb dc                	jmp    801b6c <sys_sb16_read_version+0x24>
+
+00801b90 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801b90:	55                   	push   %ebp
+  801b91:	89 e5                	mov    %esp,%ebp
+  801b93:	57                   	push   %edi
+  801b94:	56                   	push   %esi
+  801b95:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801b96:	80 3d 0c 60 80 00 00 	cmpb   $0x0,0x80600c
+  801b9d:	74 1b                	je     801bba <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801b9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba4:	b8 16 00 00 00       	mov    $0x16,%eax
+  801ba9:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801baf:	89 df                	mov    %ebx,%edi
+  801bb1:	89 de                	mov    %ebx,%esi
+  801bb3:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801bb5:	5b                   	pop    %ebx
+  801bb6:	5e                   	pop    %esi
+  801bb7:	5f                   	pop    %edi
+  801bb8:	5d                   	pop    %ebp
+  801bb9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801bba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801bc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801bc5:	b8 16 00 00 00       	mov    $0x16,%eax
+  801bca:	89 df                	mov    %ebx,%edi
+  801bcc:	55                   	push   %ebp
+  801bcd:	89 e5                	mov    %esp,%ebp
+  801bcf:	8d 35 d7 1b 80 00    	lea    0x801bd7,%esi
+  801bd5:	0f 34                	sysenter
+  801bd7:	5d                   	pop    %ebp
+		goto out;
+  801bd8:	eb db                	jmp    801bb5 <sys_sb16_play+0x25>
+
+00801bda <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801bda:	55                   	push   %ebp
+  801bdb:	89 e5                	mov    %esp,%ebp
+  801bdd:	53                   	push   %ebx
+  801bde:	83 ec 04             	sub    $0x4,%esp
+  801be1:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801be3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bea:	f6 c4 04             	test   $0x4,%ah
+  801bed:	74 0c                	je     801bfb <dupperm+0x21>
+  801bef:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801bf6:	f6 c4 08             	test   $0x8,%ah
+  801bf9:	75 62                	jne    801c5d <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801bfb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801c02:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801c07:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801c0d:	74 19                	je     801c28 <dupperm+0x4e>
+  801c0f:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801c16:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801c1b:	83 f8 01             	cmp    $0x1,%eax
+  801c1e:	19 c0                	sbb    %eax,%eax
+  801c20:	25 00 08 00 00       	and    $0x800,%eax
+  801c25:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  801c28:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  801c2f:	89 c1                	mov    %eax,%ecx
+  801c31:	80 cd 04             	or     $0x4,%ch
+  801c34:	f6 c7 04             	test   $0x4,%bh
+  801c37:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  801c3a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801c41:	f6 c1 02             	test   $0x2,%cl
+  801c44:	74 12                	je     801c58 <dupperm+0x7e>
+  801c46:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  801c4d:	89 c2                	mov    %eax,%edx
+  801c4f:	83 ca 02             	or     $0x2,%edx
+  801c52:	f6 c5 04             	test   $0x4,%ch
+  801c55:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  801c58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5b:	c9                   	leave
+  801c5c:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801c5d:	68 38 42 80 00       	push   $0x804238
+  801c62:	68 d0 42 80 00       	push   $0x8042d0
+  801c67:	6a 39                	push   $0x39
+  801c69:	68 e5 42 80 00       	push   $0x8042e5
+  801c6e:	e8 d6 e8 ff ff       	call   800549 <_panic>
+
+00801c73 <pgfault>:
+{
+  801c73:	55                   	push   %ebp
+  801c74:	89 e5                	mov    %esp,%ebp
+  801c76:	53                   	push   %ebx
+  801c77:	83 ec 04             	sub    $0x4,%esp
+  801c7a:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  801c7d:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  801c7f:	89 c3                	mov    %eax,%ebx
+  801c81:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801c87:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801c8b:	74 6d                	je     801cfa <pgfault+0x87>
+  801c8d:	89 da                	mov    %ebx,%edx
+  801c8f:	c1 ea 16             	shr    $0x16,%edx
+  801c92:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c99:	f6 c2 80             	test   $0x80,%dl
+  801c9c:	75 5c                	jne    801cfa <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801c9e:	c1 e8 0c             	shr    $0xc,%eax
+  801ca1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801ca8:	f6 c4 08             	test   $0x8,%ah
+  801cab:	74 4d                	je     801cfa <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801cad:	83 ec 04             	sub    $0x4,%esp
+  801cb0:	6a 07                	push   $0x7
+  801cb2:	68 00 f0 7f 00       	push   $0x7ff000
+  801cb7:	6a 00                	push   $0x0
+  801cb9:	e8 a6 f4 ff ff       	call   801164 <sys_page_alloc>
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	78 49                	js     801d0e <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801cc5:	83 ec 04             	sub    $0x4,%esp
+  801cc8:	68 00 10 00 00       	push   $0x1000
+  801ccd:	53                   	push   %ebx
+  801cce:	68 00 f0 7f 00       	push   $0x7ff000
+  801cd3:	e8 1a f1 ff ff       	call   800df2 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801cd8:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801cdf:	53                   	push   %ebx
+  801ce0:	6a 00                	push   $0x0
+  801ce2:	68 00 f0 7f 00       	push   $0x7ff000
+  801ce7:	6a 00                	push   $0x0
+  801ce9:	e8 e3 f4 ff ff       	call   8011d1 <sys_page_map>
+  801cee:	83 c4 20             	add    $0x20,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 2d                	js     801d22 <pgfault+0xaf>
+}
+  801cf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf8:	c9                   	leave
+  801cf9:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801cfa:	83 ec 04             	sub    $0x4,%esp
+  801cfd:	68 f0 42 80 00       	push   $0x8042f0
+  801d02:	6a 1e                	push   $0x1e
+  801d04:	68 e5 42 80 00       	push   $0x8042e5
+  801d09:	e8 3b e8 ff ff       	call   800549 <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801d0e:	83 ec 04             	sub    $0x4,%esp
+  801d11:	68 6c 42 80 00       	push   $0x80426c
+  801d16:	6a 29                	push   $0x29
+  801d18:	68 e5 42 80 00       	push   $0x8042e5
+  801d1d:	e8 27 e8 ff ff       	call   800549 <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801d22:	50                   	push   %eax
+  801d23:	68 a0 42 80 00       	push   $0x8042a0
+  801d28:	6a 2e                	push   $0x2e
+  801d2a:	68 e5 42 80 00       	push   $0x8042e5
+  801d2f:	e8 15 e8 ff ff       	call   800549 <_panic>
+
+00801d34 <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801d34:	55                   	push   %ebp
+  801d35:	89 e5                	mov    %esp,%ebp
+  801d37:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801d3a:	ff 75 0c             	push   0xc(%ebp)
+  801d3d:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801d40:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801d47:	e8 23 f3 ff ff       	call   80106f <sys_env_destroy>
+}
+  801d4c:	83 c4 10             	add    $0x10,%esp
+  801d4f:	c9                   	leave
+  801d50:	c3                   	ret
+
+00801d51 <ufork>:
+{
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	57                   	push   %edi
+  801d55:	56                   	push   %esi
+  801d56:	53                   	push   %ebx
+  801d57:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801d5d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d62:	cd 30                	int    $0x30
+  801d64:	89 c6                	mov    %eax,%esi
+  801d66:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801d6c:	85 c0                	test   %eax,%eax
+  801d6e:	78 56                	js     801dc6 <ufork+0x75>
+	if (pid > 0) {
+  801d70:	0f 8e b3 02 00 00    	jle    802029 <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801d76:	83 ec 0c             	sub    $0xc,%esp
+  801d79:	68 73 1c 80 00       	push   $0x801c73
+  801d7e:	e8 80 1d 00 00       	call   803b03 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801d83:	83 c4 08             	add    $0x8,%esp
+  801d86:	68 6a 3b 80 00       	push   $0x803b6a
+  801d8b:	56                   	push   %esi
+  801d8c:	e8 ef f5 ff ff       	call   801380 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801d91:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d97:	89 1c 24             	mov    %ebx,(%esp)
+  801d9a:	e8 21 03 00 00       	call   8020c0 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801d9f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801da6:	6a 07                	push   $0x7
+  801da8:	68 00 f0 bf ee       	push   $0xeebff000
+  801dad:	56                   	push   %esi
+  801dae:	53                   	push   %ebx
+  801daf:	e8 8d 04 00 00       	call   802241 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801db4:	83 c4 20             	add    $0x20,%esp
+  801db7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dbc:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801dc2:	89 fe                	mov    %edi,%esi
+  801dc4:	eb 22                	jmp    801de8 <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801dc6:	50                   	push   %eax
+  801dc7:	68 09 43 80 00       	push   $0x804309
+  801dcc:	68 a9 00 00 00       	push   $0xa9
+  801dd1:	68 e5 42 80 00       	push   $0x8042e5
+  801dd6:	e8 6e e7 ff ff       	call   800549 <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801ddb:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801de1:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801de6:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801de8:	89 f7                	mov    %esi,%edi
+  801dea:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801df0:	0f 87 e9 01 00 00    	ja     801fdf <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801df6:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801dfc:	85 f6                	test   %esi,%esi
+  801dfe:	0f 49 d6             	cmovns %esi,%edx
+  801e01:	c1 fa 0a             	sar    $0xa,%edx
+  801e04:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801e0b:	f6 c1 01             	test   $0x1,%cl
+  801e0e:	74 cb                	je     801ddb <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801e10:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e17:	f6 c2 80             	test   $0x80,%dl
+  801e1a:	75 17                	jne    801e33 <ufork+0xe2>
+			j = i + 1;
+  801e1c:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801e1f:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801e26:	f6 c2 01             	test   $0x1,%dl
+  801e29:	0f 85 f3 00 00 00    	jne    801f22 <ufork+0x1d1>
+			j = i + 1;
+  801e2f:	89 de                	mov    %ebx,%esi
+  801e31:	eb b5                	jmp    801de8 <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801e33:	89 fb                	mov    %edi,%ebx
+  801e35:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801e38:	89 d8                	mov    %ebx,%eax
+  801e3a:	c1 e8 16             	shr    $0x16,%eax
+  801e3d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e44:	89 c2                	mov    %eax,%edx
+  801e46:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801e4c:	25 02 04 00 00       	and    $0x402,%eax
+  801e51:	83 f8 02             	cmp    $0x2,%eax
+  801e54:	74 31                	je     801e87 <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801e56:	83 ec 04             	sub    $0x4,%esp
+  801e59:	6a 01                	push   $0x1
+  801e5b:	52                   	push   %edx
+  801e5c:	53                   	push   %ebx
+  801e5d:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801e63:	53                   	push   %ebx
+  801e64:	6a 00                	push   $0x0
+  801e66:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801e6c:	50                   	push   %eax
+  801e6d:	e8 fa 03 00 00       	call   80226c <batch_map>
+		return;
+  801e72:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801e75:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801e7b:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801e80:	89 c6                	mov    %eax,%esi
+				continue;
+  801e82:	e9 61 ff ff ff       	jmp    801de8 <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801e87:	83 ec 04             	sub    $0x4,%esp
+  801e8a:	80 ca 80             	or     $0x80,%dl
+  801e8d:	52                   	push   %edx
+  801e8e:	53                   	push   %ebx
+  801e8f:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801e95:	e8 ca f2 ff ff       	call   801164 <sys_page_alloc>
+  801e9a:	83 c4 10             	add    $0x10,%esp
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	78 5d                	js     801efe <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801ea1:	83 ec 0c             	sub    $0xc,%esp
+  801ea4:	6a 07                	push   $0x7
+  801ea6:	68 00 00 40 00       	push   $0x400000
+  801eab:	6a 00                	push   $0x0
+  801ead:	53                   	push   %ebx
+  801eae:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801eb4:	e8 18 f3 ff ff       	call   8011d1 <sys_page_map>
+  801eb9:	83 c4 20             	add    $0x20,%esp
+  801ebc:	85 c0                	test   %eax,%eax
+  801ebe:	78 50                	js     801f10 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801ec0:	83 ec 04             	sub    $0x4,%esp
+  801ec3:	68 00 00 40 00       	push   $0x400000
+  801ec8:	53                   	push   %ebx
+  801ec9:	68 00 00 40 00       	push   $0x400000
+  801ece:	e8 1f ef ff ff       	call   800df2 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801ed3:	83 c4 08             	add    $0x8,%esp
+  801ed6:	68 00 00 40 00       	push   $0x400000
+  801edb:	6a 00                	push   $0x0
+  801edd:	e8 5d f3 ff ff       	call   80123f <sys_page_unmap>
+  801ee2:	83 c4 10             	add    $0x10,%esp
+  801ee5:	85 c0                	test   %eax,%eax
+  801ee7:	79 8c                	jns    801e75 <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801ee9:	50                   	push   %eax
+  801eea:	68 3d 43 80 00       	push   $0x80433d
+  801eef:	68 81 00 00 00       	push   $0x81
+  801ef4:	68 e5 42 80 00       	push   $0x8042e5
+  801ef9:	e8 4b e6 ff ff       	call   800549 <_panic>
+		panic("sys_page_alloc: %e", r);
+  801efe:	50                   	push   %eax
+  801eff:	68 19 43 80 00       	push   $0x804319
+  801f04:	6a 7c                	push   $0x7c
+  801f06:	68 e5 42 80 00       	push   $0x8042e5
+  801f0b:	e8 39 e6 ff ff       	call   800549 <_panic>
+		panic("sys_page_map: %e", r);
+  801f10:	50                   	push   %eax
+  801f11:	68 2c 43 80 00       	push   $0x80432c
+  801f16:	6a 7e                	push   $0x7e
+  801f18:	68 e5 42 80 00       	push   $0x8042e5
+  801f1d:	e8 27 e6 ff ff       	call   800549 <_panic>
+  801f22:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801f28:	eb 22                	jmp    801f4c <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801f2a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801f31:	a8 01                	test   $0x1,%al
+  801f33:	74 35                	je     801f6a <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801f35:	89 d8                	mov    %ebx,%eax
+  801f37:	e8 9e fc ff ff       	call   801bda <dupperm>
+  801f3c:	89 c6                	mov    %eax,%esi
+  801f3e:	89 f8                	mov    %edi,%eax
+  801f40:	e8 95 fc ff ff       	call   801bda <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801f45:	39 c6                	cmp    %eax,%esi
+  801f47:	75 21                	jne    801f6a <ufork+0x219>
+				j++;
+  801f49:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801f4c:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801f52:	74 16                	je     801f6a <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801f54:	89 d8                	mov    %ebx,%eax
+  801f56:	c1 e8 0a             	shr    $0xa,%eax
+  801f59:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f60:	25 81 00 00 00       	and    $0x81,%eax
+  801f65:	83 f8 01             	cmp    $0x1,%eax
+  801f68:	74 c0                	je     801f2a <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801f6a:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801f70:	89 d8                	mov    %ebx,%eax
+  801f72:	29 f0                	sub    %esi,%eax
+  801f74:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801f7a:	89 fe                	mov    %edi,%esi
+  801f7c:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801f7f:	89 f8                	mov    %edi,%eax
+  801f81:	e8 54 fc ff ff       	call   801bda <dupperm>
+  801f86:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801f88:	83 ec 08             	sub    $0x8,%esp
+  801f8b:	6a 02                	push   $0x2
+  801f8d:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801f93:	51                   	push   %ecx
+  801f94:	e8 95 01 00 00       	call   80212e <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801f99:	83 c4 0c             	add    $0xc,%esp
+  801f9c:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801fa2:	57                   	push   %edi
+  801fa3:	56                   	push   %esi
+  801fa4:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801faa:	56                   	push   %esi
+  801fab:	6a 00                	push   $0x0
+  801fad:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801fb3:	51                   	push   %ecx
+  801fb4:	e8 b3 02 00 00       	call   80226c <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801fb9:	83 c4 1c             	add    $0x1c,%esp
+  801fbc:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801fc2:	57                   	push   %edi
+  801fc3:	56                   	push   %esi
+  801fc4:	6a 00                	push   $0x0
+  801fc6:	56                   	push   %esi
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801fcf:	50                   	push   %eax
+  801fd0:	e8 97 02 00 00       	call   80226c <batch_map>
+	return 0;
+  801fd5:	83 c4 20             	add    $0x20,%esp
+  801fd8:	89 de                	mov    %ebx,%esi
+  801fda:	e9 09 fe ff ff       	jmp    801de8 <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801fdf:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801fe5:	83 ec 04             	sub    $0x4,%esp
+  801fe8:	6a 02                	push   $0x2
+  801fea:	56                   	push   %esi
+  801feb:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801ff1:	53                   	push   %ebx
+  801ff2:	e8 c9 02 00 00       	call   8022c0 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801ff7:	89 1c 24             	mov    %ebx,(%esp)
+  801ffa:	e8 dd 00 00 00       	call   8020dc <batch_flush>
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	85 c0                	test   %eax,%eax
+  802004:	78 0e                	js     802014 <ufork+0x2c3>
+}
+  802006:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  80200c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80200f:	5b                   	pop    %ebx
+  802010:	5e                   	pop    %esi
+  802011:	5f                   	pop    %edi
+  802012:	5d                   	pop    %ebp
+  802013:	c3                   	ret
+			panic("fork: %e", r);
+  802014:	50                   	push   %eax
+  802015:	68 10 43 80 00       	push   $0x804310
+  80201a:	68 d7 00 00 00       	push   $0xd7
+  80201f:	68 e5 42 80 00       	push   $0x8042e5
+  802024:	e8 20 e5 ff ff       	call   800549 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  802029:	e8 aa f0 ff ff       	call   8010d8 <sys_getenvid>
+  80202e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802033:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802039:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80203e:	a3 08 60 80 00       	mov    %eax,0x806008
+		return 0;
+  802043:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  80204a:	00 00 00 
+  80204d:	eb b7                	jmp    802006 <ufork+0x2b5>
+
+0080204f <fork>:
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	53                   	push   %ebx
+  802053:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  802056:	68 73 1c 80 00       	push   $0x801c73
+  80205b:	e8 a3 1a 00 00       	call   803b03 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  802060:	e8 7a f6 ff ff       	call   8016df <sys_fork>
+  802065:	89 c3                	mov    %eax,%ebx
+  802067:	83 c4 10             	add    $0x10,%esp
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	78 09                	js     802077 <fork+0x28>
+	if (pid == 0)
+  80206e:	74 1c                	je     80208c <fork+0x3d>
+}
+  802070:	89 d8                	mov    %ebx,%eax
+  802072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  802077:	50                   	push   %eax
+  802078:	68 09 43 80 00       	push   $0x804309
+  80207d:	68 ed 00 00 00       	push   $0xed
+  802082:	68 e5 42 80 00       	push   $0x8042e5
+  802087:	e8 bd e4 ff ff       	call   800549 <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  80208c:	e8 47 f0 ff ff       	call   8010d8 <sys_getenvid>
+  802091:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802096:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80209c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8020a1:	a3 08 60 80 00       	mov    %eax,0x806008
+	return pid;
+  8020a6:	eb c8                	jmp    802070 <fork+0x21>
+
+008020a8 <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  8020a8:	55                   	push   %ebp
+  8020a9:	89 e5                	mov    %esp,%ebp
+  8020ab:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  8020ae:	ff 75 0c             	push   0xc(%ebp)
+  8020b1:	ff 75 08             	push   0x8(%ebp)
+  8020b4:	68 34 1d 80 00       	push   $0x801d34
+  8020b9:	e8 67 f6 ff ff       	call   801725 <sys_thread_create>
+}
+  8020be:	c9                   	leave
+  8020bf:	c3                   	ret
+
+008020c0 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  8020c6:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  8020cd:	00 00 00 
+	b->b_error = 0;
+  8020d0:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  8020d7:	00 00 00 
+}
+  8020da:	5d                   	pop    %ebp
+  8020db:	c3                   	ret
+
+008020dc <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  8020dc:	55                   	push   %ebp
+  8020dd:	89 e5                	mov    %esp,%ebp
+  8020df:	53                   	push   %ebx
+  8020e0:	83 ec 04             	sub    $0x4,%esp
+  8020e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  8020e6:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  8020ec:	85 c0                	test   %eax,%eax
+  8020ee:	7e 09                	jle    8020f9 <batch_flush+0x1d>
+  8020f0:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  8020f7:	74 15                	je     80210e <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  8020f9:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  802100:	00 00 00 
+	return b->b_error;
+  802103:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  802109:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210c:	c9                   	leave
+  80210d:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  80210e:	83 ec 08             	sub    $0x8,%esp
+  802111:	50                   	push   %eax
+  802112:	53                   	push   %ebx
+  802113:	e8 32 f7 ff ff       	call   80184a <sys_batch>
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	79 da                	jns    8020f9 <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  80211f:	f7 d8                	neg    %eax
+  802121:	0f b6 c0             	movzbl %al,%eax
+  802124:	f7 d8                	neg    %eax
+  802126:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  80212c:	eb cb                	jmp    8020f9 <batch_flush+0x1d>
+
+0080212e <batch_reserve>:
+{
+  80212e:	55                   	push   %ebp
+  80212f:	89 e5                	mov    %esp,%ebp
+  802131:	83 ec 08             	sub    $0x8,%esp
+  802134:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  802137:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  80213d:	03 45 0c             	add    0xc(%ebp),%eax
+  802140:	83 f8 10             	cmp    $0x10,%eax
+  802143:	7f 02                	jg     802147 <batch_reserve+0x19>
+}
+  802145:	c9                   	leave
+  802146:	c3                   	ret
+		batch_flush(b);
+  802147:	83 ec 0c             	sub    $0xc,%esp
+  80214a:	52                   	push   %edx
+  80214b:	e8 8c ff ff ff       	call   8020dc <batch_flush>
+  802150:	83 c4 10             	add    $0x10,%esp
+}
+  802153:	eb f0                	jmp    802145 <batch_reserve+0x17>
+
+00802155 <batch_next>:
+{
+  802155:	55                   	push   %ebp
+  802156:	89 e5                	mov    %esp,%ebp
+  802158:	53                   	push   %ebx
+  802159:	83 ec 04             	sub    $0x4,%esp
+  80215c:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  80215e:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  802165:	74 28                	je     80218f <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  802167:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  80216d:	8d 50 01             	lea    0x1(%eax),%edx
+  802170:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  802176:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802179:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  80217b:	83 ec 04             	sub    $0x4,%esp
+  80217e:	6a 1c                	push   $0x1c
+  802180:	6a 00                	push   $0x0
+  802182:	53                   	push   %ebx
+  802183:	e8 35 ec ff ff       	call   800dbd <memset>
+}
+  802188:	89 d8                	mov    %ebx,%eax
+  80218a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+		batch_flush(b);
+  80218f:	83 ec 0c             	sub    $0xc,%esp
+  802192:	50                   	push   %eax
+  802193:	e8 44 ff ff ff       	call   8020dc <batch_flush>
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	eb ca                	jmp    802167 <batch_next+0x12>
+
+0080219d <batch_page>:
+{
+  80219d:	55                   	push   %ebp
+  80219e:	89 e5                	mov    %esp,%ebp
+  8021a0:	57                   	push   %edi
+  8021a1:	56                   	push   %esi
+  8021a2:	53                   	push   %ebx
+  8021a3:	83 ec 1c             	sub    $0x1c,%esp
+  8021a6:	89 d3                	mov    %edx,%ebx
+  8021a8:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  8021aa:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  8021b0:	85 d2                	test   %edx,%edx
+  8021b2:	74 50                	je     802204 <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  8021b4:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  8021b7:	01 c1                	add    %eax,%ecx
+  8021b9:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  8021bc:	75 46                	jne    802204 <batch_page+0x67>
+  8021be:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  8021c1:	75 41                	jne    802204 <batch_page+0x67>
+  8021c3:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  8021c6:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  8021c9:	75 39                	jne    802204 <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  8021cb:	83 ea 01             	sub    $0x1,%edx
+  8021ce:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8021d1:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8021d4:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  8021d8:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8021db:	75 27                	jne    802204 <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8021dd:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8021e0:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8021e4:	89 fa                	mov    %edi,%edx
+  8021e6:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8021e9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8021ec:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8021ef:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8021f2:	75 10                	jne    802204 <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8021f4:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8021f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8021fb:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8021ff:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802202:	74 2a                	je     80222e <batch_page+0x91>
+	op = batch_next(b);
+  802204:	e8 4c ff ff ff       	call   802155 <batch_next>
+	op->bo_op = opcode;
+  802209:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  80220b:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  80220e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802211:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  802214:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802217:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  80221a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80221d:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  802220:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802223:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  802226:	8b 7d 18             	mov    0x18(%ebp),%edi
+  802229:	89 78 14             	mov    %edi,0x14(%eax)
+  80222c:	eb 0b                	jmp    802239 <batch_page+0x9c>
+		op->bo_npages += npages;
+  80222e:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  802232:	03 7d 18             	add    0x18(%ebp),%edi
+  802235:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  802239:	83 c4 1c             	add    $0x1c,%esp
+  80223c:	5b                   	pop    %ebx
+  80223d:	5e                   	pop    %esi
+  80223e:	5f                   	pop    %edi
+  80223f:	5d                   	pop    %ebp
+  802240:	c3                   	ret
+
+00802241 <batch_alloc>:
+{
+  802241:	55                   	push   %ebp
+  802242:	89 e5                	mov    %esp,%ebp
+  802244:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  802247:	ff 75 18             	push   0x18(%ebp)
+  80224a:	ff 75 14             	push   0x14(%ebp)
+  80224d:	ff 75 10             	push   0x10(%ebp)
+  802250:	ff 75 0c             	push   0xc(%ebp)
+  802253:	6a 00                	push   $0x0
+  802255:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80225a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802262:	e8 36 ff ff ff       	call   80219d <batch_page>
+}
+  802267:	83 c4 20             	add    $0x20,%esp
+  80226a:	c9                   	leave
+  80226b:	c3                   	ret
+
+0080226c <batch_map>:
+{
+  80226c:	55                   	push   %ebp
+  80226d:	89 e5                	mov    %esp,%ebp
+  80226f:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802272:	ff 75 20             	push   0x20(%ebp)
+  802275:	ff 75 1c             	push   0x1c(%ebp)
+  802278:	ff 75 18             	push   0x18(%ebp)
+  80227b:	ff 75 14             	push   0x14(%ebp)
+  80227e:	ff 75 10             	push   0x10(%ebp)
+  802281:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802284:	ba 01 00 00 00       	mov    $0x1,%edx
+  802289:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228c:	e8 0c ff ff ff       	call   80219d <batch_page>
+}
+  802291:	83 c4 20             	add    $0x20,%esp
+  802294:	c9                   	leave
+  802295:	c3                   	ret
+
+00802296 <batch_unmap>:
+{
+  802296:	55                   	push   %ebp
+  802297:	89 e5                	mov    %esp,%ebp
+  802299:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  80229c:	ff 75 14             	push   0x14(%ebp)
+  80229f:	6a 00                	push   $0x0
+  8022a1:	ff 75 10             	push   0x10(%ebp)
+  8022a4:	ff 75 0c             	push   0xc(%ebp)
+  8022a7:	6a 00                	push   $0x0
+  8022a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ae:	ba 02 00 00 00       	mov    $0x2,%edx
+  8022b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b6:	e8 e2 fe ff ff       	call   80219d <batch_page>
+}
+  8022bb:	83 c4 20             	add    $0x20,%esp
+  8022be:	c9                   	leave
+  8022bf:	c3                   	ret
+
+008022c0 <batch_set_status>:
+{
+  8022c0:	55                   	push   %ebp
+  8022c1:	89 e5                	mov    %esp,%ebp
+  8022c3:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8022c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c9:	e8 87 fe ff ff       	call   802155 <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8022ce:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8022d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022d7:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8022da:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022dd:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8022e0:	c9                   	leave
+  8022e1:	c3                   	ret
+
+008022e2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8022e2:	55                   	push   %ebp
+  8022e3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8022e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8022ed:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8022f0:	5d                   	pop    %ebp
+  8022f1:	c3                   	ret
+
+008022f2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8022f2:	55                   	push   %ebp
+  8022f3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8022f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8022fd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802302:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802307:	5d                   	pop    %ebp
+  802308:	c3                   	ret
+
+00802309 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802309:	55                   	push   %ebp
+  80230a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80230c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802311:	eb 02                	jmp    802315 <fd_alloc+0xc>
+  802313:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802315:	89 c2                	mov    %eax,%edx
+  802317:	c1 ea 16             	shr    $0x16,%edx
+  80231a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802321:	f6 c2 01             	test   $0x1,%dl
+  802324:	74 2b                	je     802351 <fd_alloc+0x48>
+  802326:	89 c2                	mov    %eax,%edx
+  802328:	c1 ea 0c             	shr    $0xc,%edx
+  80232b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802332:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802338:	f6 c1 01             	test   $0x1,%cl
+  80233b:	74 14                	je     802351 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80233d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802343:	75 ce                	jne    802313 <fd_alloc+0xa>
+  802345:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80234a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80234f:	eb 05                	jmp    802356 <fd_alloc+0x4d>
+			return 0;
+  802351:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  802356:	8b 55 08             	mov    0x8(%ebp),%edx
+  802359:	89 02                	mov    %eax,(%edx)
+}
+  80235b:	89 c8                	mov    %ecx,%eax
+  80235d:	5d                   	pop    %ebp
+  80235e:	c3                   	ret
+
+0080235f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802365:	83 f8 1f             	cmp    $0x1f,%eax
+  802368:	77 30                	ja     80239a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80236a:	c1 e0 0c             	shl    $0xc,%eax
+  80236d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802372:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  802378:	f6 c2 01             	test   $0x1,%dl
+  80237b:	74 24                	je     8023a1 <fd_lookup+0x42>
+  80237d:	89 c2                	mov    %eax,%edx
+  80237f:	c1 ea 0c             	shr    $0xc,%edx
+  802382:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802389:	f6 c2 01             	test   $0x1,%dl
+  80238c:	74 1a                	je     8023a8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80238e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802391:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802393:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802398:	5d                   	pop    %ebp
+  802399:	c3                   	ret
+		return -E_INVAL;
+  80239a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80239f:	eb f7                	jmp    802398 <fd_lookup+0x39>
+		return -E_INVAL;
+  8023a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023a6:	eb f0                	jmp    802398 <fd_lookup+0x39>
+  8023a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ad:	eb e9                	jmp    802398 <fd_lookup+0x39>
+
+008023af <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8023af:	55                   	push   %ebp
+  8023b0:	89 e5                	mov    %esp,%ebp
+  8023b2:	53                   	push   %ebx
+  8023b3:	83 ec 04             	sub    $0x4,%esp
+  8023b6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8023b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023be:	eb 03                	jmp    8023c3 <dev_lookup+0x14>
+  8023c0:	83 c0 01             	add    $0x1,%eax
+  8023c3:	8b 1c 85 cc 43 80 00 	mov    0x8043cc(,%eax,4),%ebx
+  8023ca:	85 db                	test   %ebx,%ebx
+  8023cc:	74 0b                	je     8023d9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8023ce:	39 13                	cmp    %edx,(%ebx)
+  8023d0:	75 ee                	jne    8023c0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8023d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d7:	eb 2e                	jmp    802407 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8023d9:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023db:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8023e0:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8023e6:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8023eb:	76 24                	jbe    802411 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8023ed:	8b 41 48             	mov    0x48(%ecx),%eax
+  8023f0:	83 ec 04             	sub    $0x4,%esp
+  8023f3:	52                   	push   %edx
+  8023f4:	50                   	push   %eax
+  8023f5:	68 50 43 80 00       	push   $0x804350
+  8023fa:	e8 25 e2 ff ff       	call   800624 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8023ff:	83 c4 10             	add    $0x10,%esp
+  802402:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802407:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80240a:	89 1a                	mov    %ebx,(%edx)
+}
+  80240c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80240f:	c9                   	leave
+  802410:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802411:	c1 e8 10             	shr    $0x10,%eax
+  802414:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80241a:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802420:	eb cb                	jmp    8023ed <dev_lookup+0x3e>
+
+00802422 <fd_close>:
+{
+  802422:	55                   	push   %ebp
+  802423:	89 e5                	mov    %esp,%ebp
+  802425:	57                   	push   %edi
+  802426:	56                   	push   %esi
+  802427:	53                   	push   %ebx
+  802428:	83 ec 24             	sub    $0x24,%esp
+  80242b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80242e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802431:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802434:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802435:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80243b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80243e:	50                   	push   %eax
+  80243f:	e8 1b ff ff ff       	call   80235f <fd_lookup>
+  802444:	89 c3                	mov    %eax,%ebx
+  802446:	83 c4 10             	add    $0x10,%esp
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	78 05                	js     802452 <fd_close+0x30>
+	    || fd != fd2)
+  80244d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802450:	74 16                	je     802468 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802452:	89 f8                	mov    %edi,%eax
+  802454:	84 c0                	test   %al,%al
+  802456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80245e:	89 d8                	mov    %ebx,%eax
+  802460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802463:	5b                   	pop    %ebx
+  802464:	5e                   	pop    %esi
+  802465:	5f                   	pop    %edi
+  802466:	5d                   	pop    %ebp
+  802467:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802468:	83 ec 08             	sub    $0x8,%esp
+  80246b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80246e:	50                   	push   %eax
+  80246f:	ff 36                	push   (%esi)
+  802471:	e8 39 ff ff ff       	call   8023af <dev_lookup>
+  802476:	89 c3                	mov    %eax,%ebx
+  802478:	83 c4 10             	add    $0x10,%esp
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 1a                	js     802499 <fd_close+0x77>
+		if (dev->dev_close)
+  80247f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802482:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  802485:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80248a:	85 c0                	test   %eax,%eax
+  80248c:	74 0b                	je     802499 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80248e:	83 ec 0c             	sub    $0xc,%esp
+  802491:	56                   	push   %esi
+  802492:	ff d0                	call   *%eax
+  802494:	89 c3                	mov    %eax,%ebx
+  802496:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802499:	83 ec 08             	sub    $0x8,%esp
+  80249c:	56                   	push   %esi
+  80249d:	6a 00                	push   $0x0
+  80249f:	e8 9b ed ff ff       	call   80123f <sys_page_unmap>
+	return r;
+  8024a4:	83 c4 10             	add    $0x10,%esp
+  8024a7:	eb b5                	jmp    80245e <fd_close+0x3c>
+
+008024a9 <close>:
+
+int
+close(int fdnum)
+{
+  8024a9:	55                   	push   %ebp
+  8024aa:	89 e5                	mov    %esp,%ebp
+  8024ac:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024b2:	50                   	push   %eax
+  8024b3:	ff 75 08             	push   0x8(%ebp)
+  8024b6:	e8 a4 fe ff ff       	call   80235f <fd_lookup>
+  8024bb:	83 c4 10             	add    $0x10,%esp
+  8024be:	85 c0                	test   %eax,%eax
+  8024c0:	79 02                	jns    8024c4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8024c2:	c9                   	leave
+  8024c3:	c3                   	ret
+		return fd_close(fd, 1);
+  8024c4:	83 ec 08             	sub    $0x8,%esp
+  8024c7:	6a 01                	push   $0x1
+  8024c9:	ff 75 f4             	push   -0xc(%ebp)
+  8024cc:	e8 51 ff ff ff       	call   802422 <fd_close>
+  8024d1:	83 c4 10             	add    $0x10,%esp
+  8024d4:	eb ec                	jmp    8024c2 <close+0x19>
+
+008024d6 <close_all>:
+
+void
+close_all(void)
+{
+  8024d6:	55                   	push   %ebp
+  8024d7:	89 e5                	mov    %esp,%ebp
+  8024d9:	53                   	push   %ebx
+  8024da:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8024dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8024e2:	83 ec 0c             	sub    $0xc,%esp
+  8024e5:	53                   	push   %ebx
+  8024e6:	e8 be ff ff ff       	call   8024a9 <close>
+	for (i = 0; i < MAXFD; i++)
+  8024eb:	83 c3 01             	add    $0x1,%ebx
+  8024ee:	83 c4 10             	add    $0x10,%esp
+  8024f1:	83 fb 20             	cmp    $0x20,%ebx
+  8024f4:	75 ec                	jne    8024e2 <close_all+0xc>
+}
+  8024f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f9:	c9                   	leave
+  8024fa:	c3                   	ret
+
+008024fb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8024fb:	55                   	push   %ebp
+  8024fc:	89 e5                	mov    %esp,%ebp
+  8024fe:	57                   	push   %edi
+  8024ff:	56                   	push   %esi
+  802500:	53                   	push   %ebx
+  802501:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802504:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802507:	50                   	push   %eax
+  802508:	ff 75 08             	push   0x8(%ebp)
+  80250b:	e8 4f fe ff ff       	call   80235f <fd_lookup>
+  802510:	89 c3                	mov    %eax,%ebx
+  802512:	83 c4 10             	add    $0x10,%esp
+  802515:	85 c0                	test   %eax,%eax
+  802517:	78 7f                	js     802598 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  802519:	83 ec 0c             	sub    $0xc,%esp
+  80251c:	ff 75 0c             	push   0xc(%ebp)
+  80251f:	e8 85 ff ff ff       	call   8024a9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802524:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802527:	c1 e6 0c             	shl    $0xc,%esi
+  80252a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802530:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802533:	89 3c 24             	mov    %edi,(%esp)
+  802536:	e8 b7 fd ff ff       	call   8022f2 <fd2data>
+  80253b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80253d:	89 34 24             	mov    %esi,(%esp)
+  802540:	e8 ad fd ff ff       	call   8022f2 <fd2data>
+  802545:	83 c4 10             	add    $0x10,%esp
+  802548:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80254b:	89 d8                	mov    %ebx,%eax
+  80254d:	c1 e8 16             	shr    $0x16,%eax
+  802550:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802557:	a8 01                	test   $0x1,%al
+  802559:	74 11                	je     80256c <dup+0x71>
+  80255b:	89 d8                	mov    %ebx,%eax
+  80255d:	c1 e8 0c             	shr    $0xc,%eax
+  802560:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802567:	f6 c2 01             	test   $0x1,%dl
+  80256a:	75 36                	jne    8025a2 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80256c:	89 f8                	mov    %edi,%eax
+  80256e:	c1 e8 0c             	shr    $0xc,%eax
+  802571:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802578:	83 ec 0c             	sub    $0xc,%esp
+  80257b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802580:	50                   	push   %eax
+  802581:	56                   	push   %esi
+  802582:	6a 00                	push   $0x0
+  802584:	57                   	push   %edi
+  802585:	6a 00                	push   $0x0
+  802587:	e8 45 ec ff ff       	call   8011d1 <sys_page_map>
+  80258c:	89 c3                	mov    %eax,%ebx
+  80258e:	83 c4 20             	add    $0x20,%esp
+  802591:	85 c0                	test   %eax,%eax
+  802593:	78 33                	js     8025c8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802595:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802598:	89 d8                	mov    %ebx,%eax
+  80259a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8025a2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8025a9:	83 ec 0c             	sub    $0xc,%esp
+  8025ac:	25 07 0e 00 00       	and    $0xe07,%eax
+  8025b1:	50                   	push   %eax
+  8025b2:	ff 75 d4             	push   -0x2c(%ebp)
+  8025b5:	6a 00                	push   $0x0
+  8025b7:	53                   	push   %ebx
+  8025b8:	6a 00                	push   $0x0
+  8025ba:	e8 12 ec ff ff       	call   8011d1 <sys_page_map>
+  8025bf:	89 c3                	mov    %eax,%ebx
+  8025c1:	83 c4 20             	add    $0x20,%esp
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	79 a4                	jns    80256c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8025c8:	83 ec 08             	sub    $0x8,%esp
+  8025cb:	56                   	push   %esi
+  8025cc:	6a 00                	push   $0x0
+  8025ce:	e8 6c ec ff ff       	call   80123f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8025d3:	83 c4 08             	add    $0x8,%esp
+  8025d6:	ff 75 d4             	push   -0x2c(%ebp)
+  8025d9:	6a 00                	push   $0x0
+  8025db:	e8 5f ec ff ff       	call   80123f <sys_page_unmap>
+	return r;
+  8025e0:	83 c4 10             	add    $0x10,%esp
+  8025e3:	eb b3                	jmp    802598 <dup+0x9d>
+
+008025e5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8025e5:	55                   	push   %ebp
+  8025e6:	89 e5                	mov    %esp,%ebp
+  8025e8:	56                   	push   %esi
+  8025e9:	53                   	push   %ebx
+  8025ea:	83 ec 18             	sub    $0x18,%esp
+  8025ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025f3:	50                   	push   %eax
+  8025f4:	53                   	push   %ebx
+  8025f5:	e8 65 fd ff ff       	call   80235f <fd_lookup>
+  8025fa:	83 c4 10             	add    $0x10,%esp
+  8025fd:	85 c0                	test   %eax,%eax
+  8025ff:	78 3c                	js     80263d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802601:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802604:	83 ec 08             	sub    $0x8,%esp
+  802607:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80260a:	50                   	push   %eax
+  80260b:	ff 36                	push   (%esi)
+  80260d:	e8 9d fd ff ff       	call   8023af <dev_lookup>
+  802612:	83 c4 10             	add    $0x10,%esp
+  802615:	85 c0                	test   %eax,%eax
+  802617:	78 24                	js     80263d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802619:	8b 46 08             	mov    0x8(%esi),%eax
+  80261c:	83 e0 03             	and    $0x3,%eax
+  80261f:	83 f8 01             	cmp    $0x1,%eax
+  802622:	74 20                	je     802644 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802624:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802627:	8b 40 08             	mov    0x8(%eax),%eax
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	74 57                	je     802685 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80262e:	83 ec 04             	sub    $0x4,%esp
+  802631:	ff 75 10             	push   0x10(%ebp)
+  802634:	ff 75 0c             	push   0xc(%ebp)
+  802637:	56                   	push   %esi
+  802638:	ff d0                	call   *%eax
+  80263a:	83 c4 10             	add    $0x10,%esp
+}
+  80263d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802640:	5b                   	pop    %ebx
+  802641:	5e                   	pop    %esi
+  802642:	5d                   	pop    %ebp
+  802643:	c3                   	ret
+  802644:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802646:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80264b:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802651:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802656:	76 1c                	jbe    802674 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802658:	8b 42 48             	mov    0x48(%edx),%eax
+  80265b:	83 ec 04             	sub    $0x4,%esp
+  80265e:	53                   	push   %ebx
+  80265f:	50                   	push   %eax
+  802660:	68 91 43 80 00       	push   $0x804391
+  802665:	e8 ba df ff ff       	call   800624 <cprintf>
+		return -E_INVAL;
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802672:	eb c9                	jmp    80263d <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802674:	c1 e8 10             	shr    $0x10,%eax
+  802677:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80267d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802683:	eb d3                	jmp    802658 <read+0x73>
+		return -E_NOT_SUPP;
+  802685:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80268a:	eb b1                	jmp    80263d <read+0x58>
+
+0080268c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80268c:	55                   	push   %ebp
+  80268d:	89 e5                	mov    %esp,%ebp
+  80268f:	57                   	push   %edi
+  802690:	56                   	push   %esi
+  802691:	53                   	push   %ebx
+  802692:	83 ec 0c             	sub    $0xc,%esp
+  802695:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802698:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80269b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026a0:	eb 02                	jmp    8026a4 <readn+0x18>
+  8026a2:	01 c3                	add    %eax,%ebx
+  8026a4:	39 f3                	cmp    %esi,%ebx
+  8026a6:	73 21                	jae    8026c9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8026a8:	83 ec 04             	sub    $0x4,%esp
+  8026ab:	89 f0                	mov    %esi,%eax
+  8026ad:	29 d8                	sub    %ebx,%eax
+  8026af:	50                   	push   %eax
+  8026b0:	89 d8                	mov    %ebx,%eax
+  8026b2:	03 45 0c             	add    0xc(%ebp),%eax
+  8026b5:	50                   	push   %eax
+  8026b6:	57                   	push   %edi
+  8026b7:	e8 29 ff ff ff       	call   8025e5 <read>
+		if (m < 0)
+  8026bc:	83 c4 10             	add    $0x10,%esp
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	78 04                	js     8026c7 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8026c3:	75 dd                	jne    8026a2 <readn+0x16>
+  8026c5:	eb 02                	jmp    8026c9 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8026c7:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8026c9:	89 d8                	mov    %ebx,%eax
+  8026cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ce:	5b                   	pop    %ebx
+  8026cf:	5e                   	pop    %esi
+  8026d0:	5f                   	pop    %edi
+  8026d1:	5d                   	pop    %ebp
+  8026d2:	c3                   	ret
+
+008026d3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8026d3:	55                   	push   %ebp
+  8026d4:	89 e5                	mov    %esp,%ebp
+  8026d6:	56                   	push   %esi
+  8026d7:	53                   	push   %ebx
+  8026d8:	83 ec 18             	sub    $0x18,%esp
+  8026db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8026de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026e1:	50                   	push   %eax
+  8026e2:	53                   	push   %ebx
+  8026e3:	e8 77 fc ff ff       	call   80235f <fd_lookup>
+  8026e8:	83 c4 10             	add    $0x10,%esp
+  8026eb:	85 c0                	test   %eax,%eax
+  8026ed:	78 37                	js     802726 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026ef:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026f2:	83 ec 08             	sub    $0x8,%esp
+  8026f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026f8:	50                   	push   %eax
+  8026f9:	ff 36                	push   (%esi)
+  8026fb:	e8 af fc ff ff       	call   8023af <dev_lookup>
+  802700:	83 c4 10             	add    $0x10,%esp
+  802703:	85 c0                	test   %eax,%eax
+  802705:	78 1f                	js     802726 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802707:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80270b:	74 20                	je     80272d <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80270d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802710:	8b 40 0c             	mov    0xc(%eax),%eax
+  802713:	85 c0                	test   %eax,%eax
+  802715:	74 57                	je     80276e <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802717:	83 ec 04             	sub    $0x4,%esp
+  80271a:	ff 75 10             	push   0x10(%ebp)
+  80271d:	ff 75 0c             	push   0xc(%ebp)
+  802720:	56                   	push   %esi
+  802721:	ff d0                	call   *%eax
+  802723:	83 c4 10             	add    $0x10,%esp
+}
+  802726:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802729:	5b                   	pop    %ebx
+  80272a:	5e                   	pop    %esi
+  80272b:	5d                   	pop    %ebp
+  80272c:	c3                   	ret
+  80272d:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80272f:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802734:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80273a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80273f:	76 1c                	jbe    80275d <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802741:	8b 42 48             	mov    0x48(%edx),%eax
+  802744:	83 ec 04             	sub    $0x4,%esp
+  802747:	53                   	push   %ebx
+  802748:	50                   	push   %eax
+  802749:	68 ad 43 80 00       	push   $0x8043ad
+  80274e:	e8 d1 de ff ff       	call   800624 <cprintf>
+		return -E_INVAL;
+  802753:	83 c4 10             	add    $0x10,%esp
+  802756:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80275b:	eb c9                	jmp    802726 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80275d:	c1 e8 10             	shr    $0x10,%eax
+  802760:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802766:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80276c:	eb d3                	jmp    802741 <write+0x6e>
+		return -E_NOT_SUPP;
+  80276e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802773:	eb b1                	jmp    802726 <write+0x53>
+
+00802775 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802775:	55                   	push   %ebp
+  802776:	89 e5                	mov    %esp,%ebp
+  802778:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80277b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80277e:	50                   	push   %eax
+  80277f:	ff 75 08             	push   0x8(%ebp)
+  802782:	e8 d8 fb ff ff       	call   80235f <fd_lookup>
+  802787:	83 c4 10             	add    $0x10,%esp
+  80278a:	85 c0                	test   %eax,%eax
+  80278c:	78 0e                	js     80279c <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80278e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802791:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802794:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802797:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80279c:	c9                   	leave
+  80279d:	c3                   	ret
+
+0080279e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80279e:	55                   	push   %ebp
+  80279f:	89 e5                	mov    %esp,%ebp
+  8027a1:	56                   	push   %esi
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 18             	sub    $0x18,%esp
+  8027a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8027a9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8027ac:	50                   	push   %eax
+  8027ad:	53                   	push   %ebx
+  8027ae:	e8 ac fb ff ff       	call   80235f <fd_lookup>
+  8027b3:	83 c4 10             	add    $0x10,%esp
+  8027b6:	85 c0                	test   %eax,%eax
+  8027b8:	78 34                	js     8027ee <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8027ba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8027bd:	83 ec 08             	sub    $0x8,%esp
+  8027c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027c3:	50                   	push   %eax
+  8027c4:	ff 36                	push   (%esi)
+  8027c6:	e8 e4 fb ff ff       	call   8023af <dev_lookup>
+  8027cb:	83 c4 10             	add    $0x10,%esp
+  8027ce:	85 c0                	test   %eax,%eax
+  8027d0:	78 1c                	js     8027ee <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027d2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8027d6:	74 1d                	je     8027f5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8027d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027db:	8b 40 18             	mov    0x18(%eax),%eax
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	74 54                	je     802836 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8027e2:	83 ec 08             	sub    $0x8,%esp
+  8027e5:	ff 75 0c             	push   0xc(%ebp)
+  8027e8:	56                   	push   %esi
+  8027e9:	ff d0                	call   *%eax
+  8027eb:	83 c4 10             	add    $0x10,%esp
+}
+  8027ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027f1:	5b                   	pop    %ebx
+  8027f2:	5e                   	pop    %esi
+  8027f3:	5d                   	pop    %ebp
+  8027f4:	c3                   	ret
+  8027f5:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8027f7:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8027fc:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802802:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802807:	76 1c                	jbe    802825 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  802809:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80280c:	83 ec 04             	sub    $0x4,%esp
+  80280f:	53                   	push   %ebx
+  802810:	50                   	push   %eax
+  802811:	68 70 43 80 00       	push   $0x804370
+  802816:	e8 09 de ff ff       	call   800624 <cprintf>
+		return -E_INVAL;
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802823:	eb c9                	jmp    8027ee <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802825:	c1 e8 10             	shr    $0x10,%eax
+  802828:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80282e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802834:	eb d3                	jmp    802809 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  802836:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80283b:	eb b1                	jmp    8027ee <ftruncate+0x50>
+
+0080283d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80283d:	55                   	push   %ebp
+  80283e:	89 e5                	mov    %esp,%ebp
+  802840:	56                   	push   %esi
+  802841:	53                   	push   %ebx
+  802842:	83 ec 18             	sub    $0x18,%esp
+  802845:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802848:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80284b:	50                   	push   %eax
+  80284c:	ff 75 08             	push   0x8(%ebp)
+  80284f:	e8 0b fb ff ff       	call   80235f <fd_lookup>
+  802854:	83 c4 10             	add    $0x10,%esp
+  802857:	85 c0                	test   %eax,%eax
+  802859:	78 49                	js     8028a4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80285b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80285e:	83 ec 08             	sub    $0x8,%esp
+  802861:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802864:	50                   	push   %eax
+  802865:	ff 36                	push   (%esi)
+  802867:	e8 43 fb ff ff       	call   8023af <dev_lookup>
+  80286c:	83 c4 10             	add    $0x10,%esp
+  80286f:	85 c0                	test   %eax,%eax
+  802871:	78 31                	js     8028a4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802876:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80287a:	74 2f                	je     8028ab <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80287c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80287f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802886:	00 00 00 
+	stat->st_isdir = 0;
+  802889:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802890:	00 00 00 
+	stat->st_dev = dev;
+  802893:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802899:	83 ec 08             	sub    $0x8,%esp
+  80289c:	53                   	push   %ebx
+  80289d:	56                   	push   %esi
+  80289e:	ff 50 14             	call   *0x14(%eax)
+  8028a1:	83 c4 10             	add    $0x10,%esp
+}
+  8028a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a7:	5b                   	pop    %ebx
+  8028a8:	5e                   	pop    %esi
+  8028a9:	5d                   	pop    %ebp
+  8028aa:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028b0:	eb f2                	jmp    8028a4 <fstat+0x67>
+
+008028b2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8028b2:	55                   	push   %ebp
+  8028b3:	89 e5                	mov    %esp,%ebp
+  8028b5:	56                   	push   %esi
+  8028b6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8028b7:	83 ec 08             	sub    $0x8,%esp
+  8028ba:	6a 00                	push   $0x0
+  8028bc:	ff 75 08             	push   0x8(%ebp)
+  8028bf:	e8 e4 01 00 00       	call   802aa8 <open>
+  8028c4:	89 c3                	mov    %eax,%ebx
+  8028c6:	83 c4 10             	add    $0x10,%esp
+  8028c9:	85 c0                	test   %eax,%eax
+  8028cb:	78 1b                	js     8028e8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8028cd:	83 ec 08             	sub    $0x8,%esp
+  8028d0:	ff 75 0c             	push   0xc(%ebp)
+  8028d3:	50                   	push   %eax
+  8028d4:	e8 64 ff ff ff       	call   80283d <fstat>
+  8028d9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8028db:	89 1c 24             	mov    %ebx,(%esp)
+  8028de:	e8 c6 fb ff ff       	call   8024a9 <close>
+	return r;
+  8028e3:	83 c4 10             	add    $0x10,%esp
+  8028e6:	89 f3                	mov    %esi,%ebx
+}
+  8028e8:	89 d8                	mov    %ebx,%eax
+  8028ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ed:	5b                   	pop    %ebx
+  8028ee:	5e                   	pop    %esi
+  8028ef:	5d                   	pop    %ebp
+  8028f0:	c3                   	ret
+
+008028f1 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8028f1:	55                   	push   %ebp
+  8028f2:	89 e5                	mov    %esp,%ebp
+  8028f4:	56                   	push   %esi
+  8028f5:	53                   	push   %ebx
+  8028f6:	89 c6                	mov    %eax,%esi
+  8028f8:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8028fa:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  802901:	74 27                	je     80292a <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802903:	6a 07                	push   $0x7
+  802905:	68 00 70 80 00       	push   $0x807000
+  80290a:	56                   	push   %esi
+  80290b:	ff 35 00 60 80 00    	push   0x806000
+  802911:	e8 69 13 00 00       	call   803c7f <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802916:	83 c4 0c             	add    $0xc,%esp
+  802919:	6a 00                	push   $0x0
+  80291b:	53                   	push   %ebx
+  80291c:	6a 00                	push   $0x0
+  80291e:	e8 44 13 00 00       	call   803c67 <ipc_recv>
+}
+  802923:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802926:	5b                   	pop    %ebx
+  802927:	5e                   	pop    %esi
+  802928:	5d                   	pop    %ebp
+  802929:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80292a:	83 ec 0c             	sub    $0xc,%esp
+  80292d:	6a 01                	push   $0x1
+  80292f:	e8 9f 13 00 00       	call   803cd3 <ipc_find_env>
+  802934:	a3 00 60 80 00       	mov    %eax,0x806000
+  802939:	83 c4 10             	add    $0x10,%esp
+  80293c:	eb c5                	jmp    802903 <fsipc+0x12>
+
+0080293e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80293e:	55                   	push   %ebp
+  80293f:	89 e5                	mov    %esp,%ebp
+  802941:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802944:	8b 45 08             	mov    0x8(%ebp),%eax
+  802947:	8b 40 0c             	mov    0xc(%eax),%eax
+  80294a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80294f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802952:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80295c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802961:	e8 8b ff ff ff       	call   8028f1 <fsipc>
+}
+  802966:	c9                   	leave
+  802967:	c3                   	ret
+
+00802968 <devfile_flush>:
+{
+  802968:	55                   	push   %ebp
+  802969:	89 e5                	mov    %esp,%ebp
+  80296b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80296e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802971:	8b 40 0c             	mov    0xc(%eax),%eax
+  802974:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802979:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802983:	e8 69 ff ff ff       	call   8028f1 <fsipc>
+}
+  802988:	c9                   	leave
+  802989:	c3                   	ret
+
+0080298a <devfile_stat>:
+{
+  80298a:	55                   	push   %ebp
+  80298b:	89 e5                	mov    %esp,%ebp
+  80298d:	53                   	push   %ebx
+  80298e:	83 ec 04             	sub    $0x4,%esp
+  802991:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802994:	8b 45 08             	mov    0x8(%ebp),%eax
+  802997:	8b 40 0c             	mov    0xc(%eax),%eax
+  80299a:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80299f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8029a9:	e8 43 ff ff ff       	call   8028f1 <fsipc>
+  8029ae:	85 c0                	test   %eax,%eax
+  8029b0:	78 2c                	js     8029de <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8029b2:	83 ec 08             	sub    $0x8,%esp
+  8029b5:	68 00 70 80 00       	push   $0x807000
+  8029ba:	53                   	push   %ebx
+  8029bb:	e8 ac e2 ff ff       	call   800c6c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8029c0:	a1 80 70 80 00       	mov    0x807080,%eax
+  8029c5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8029cb:	a1 84 70 80 00       	mov    0x807084,%eax
+  8029d0:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8029d6:	83 c4 10             	add    $0x10,%esp
+  8029d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+
+008029e3 <devfile_write>:
+{
+  8029e3:	55                   	push   %ebp
+  8029e4:	89 e5                	mov    %esp,%ebp
+  8029e6:	83 ec 0c             	sub    $0xc,%esp
+  8029e9:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8029ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029ef:	8b 52 0c             	mov    0xc(%edx),%edx
+  8029f2:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = n;
+  8029f8:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8029fd:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802a02:	39 d0                	cmp    %edx,%eax
+  802a04:	0f 47 c2             	cmova  %edx,%eax
+  802a07:	50                   	push   %eax
+  802a08:	ff 75 0c             	push   0xc(%ebp)
+  802a0b:	68 08 70 80 00       	push   $0x807008
+  802a10:	e8 dd e3 ff ff       	call   800df2 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802a15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a1a:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a1f:	e8 cd fe ff ff       	call   8028f1 <fsipc>
+}
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+
+00802a26 <devfile_read>:
+{
+  802a26:	55                   	push   %ebp
+  802a27:	89 e5                	mov    %esp,%ebp
+  802a29:	56                   	push   %esi
+  802a2a:	53                   	push   %ebx
+  802a2b:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a31:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a34:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802a39:	89 35 04 70 80 00    	mov    %esi,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802a3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a44:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a49:	e8 a3 fe ff ff       	call   8028f1 <fsipc>
+  802a4e:	89 c3                	mov    %eax,%ebx
+  802a50:	85 c0                	test   %eax,%eax
+  802a52:	78 1f                	js     802a73 <devfile_read+0x4d>
+	assert(r <= n);
+  802a54:	39 c6                	cmp    %eax,%esi
+  802a56:	72 24                	jb     802a7c <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  802a58:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802a5d:	7f 33                	jg     802a92 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802a5f:	83 ec 04             	sub    $0x4,%esp
+  802a62:	50                   	push   %eax
+  802a63:	68 00 70 80 00       	push   $0x807000
+  802a68:	ff 75 0c             	push   0xc(%ebp)
+  802a6b:	e8 82 e3 ff ff       	call   800df2 <memmove>
+	return r;
+  802a70:	83 c4 10             	add    $0x10,%esp
+}
+  802a73:	89 d8                	mov    %ebx,%eax
+  802a75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a78:	5b                   	pop    %ebx
+  802a79:	5e                   	pop    %esi
+  802a7a:	5d                   	pop    %ebp
+  802a7b:	c3                   	ret
+	assert(r <= n);
+  802a7c:	68 e0 43 80 00       	push   $0x8043e0
+  802a81:	68 d0 42 80 00       	push   $0x8042d0
+  802a86:	6a 76                	push   $0x76
+  802a88:	68 e7 43 80 00       	push   $0x8043e7
+  802a8d:	e8 b7 da ff ff       	call   800549 <_panic>
+	assert(r <= PGSIZE);
+  802a92:	68 f2 43 80 00       	push   $0x8043f2
+  802a97:	68 d0 42 80 00       	push   $0x8042d0
+  802a9c:	6a 77                	push   $0x77
+  802a9e:	68 e7 43 80 00       	push   $0x8043e7
+  802aa3:	e8 a1 da ff ff       	call   800549 <_panic>
+
+00802aa8 <open>:
+{
+  802aa8:	55                   	push   %ebp
+  802aa9:	89 e5                	mov    %esp,%ebp
+  802aab:	56                   	push   %esi
+  802aac:	53                   	push   %ebx
+  802aad:	83 ec 1c             	sub    $0x1c,%esp
+  802ab0:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802ab3:	56                   	push   %esi
+  802ab4:	e8 78 e1 ff ff       	call   800c31 <strlen>
+  802ab9:	83 c4 10             	add    $0x10,%esp
+  802abc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802ac1:	7f 6c                	jg     802b2f <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802ac3:	83 ec 0c             	sub    $0xc,%esp
+  802ac6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ac9:	50                   	push   %eax
+  802aca:	e8 3a f8 ff ff       	call   802309 <fd_alloc>
+  802acf:	89 c3                	mov    %eax,%ebx
+  802ad1:	83 c4 10             	add    $0x10,%esp
+  802ad4:	85 c0                	test   %eax,%eax
+  802ad6:	78 3c                	js     802b14 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802ad8:	83 ec 08             	sub    $0x8,%esp
+  802adb:	56                   	push   %esi
+  802adc:	68 00 70 80 00       	push   $0x807000
+  802ae1:	e8 86 e1 ff ff       	call   800c6c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802ae6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ae9:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802aee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802af1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802af6:	e8 f6 fd ff ff       	call   8028f1 <fsipc>
+  802afb:	89 c3                	mov    %eax,%ebx
+  802afd:	83 c4 10             	add    $0x10,%esp
+  802b00:	85 c0                	test   %eax,%eax
+  802b02:	78 19                	js     802b1d <open+0x75>
+	return fd2num(fd);
+  802b04:	83 ec 0c             	sub    $0xc,%esp
+  802b07:	ff 75 f4             	push   -0xc(%ebp)
+  802b0a:	e8 d3 f7 ff ff       	call   8022e2 <fd2num>
+  802b0f:	89 c3                	mov    %eax,%ebx
+  802b11:	83 c4 10             	add    $0x10,%esp
+}
+  802b14:	89 d8                	mov    %ebx,%eax
+  802b16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b19:	5b                   	pop    %ebx
+  802b1a:	5e                   	pop    %esi
+  802b1b:	5d                   	pop    %ebp
+  802b1c:	c3                   	ret
+		fd_close(fd, 0);
+  802b1d:	83 ec 08             	sub    $0x8,%esp
+  802b20:	6a 00                	push   $0x0
+  802b22:	ff 75 f4             	push   -0xc(%ebp)
+  802b25:	e8 f8 f8 ff ff       	call   802422 <fd_close>
+		return r;
+  802b2a:	83 c4 10             	add    $0x10,%esp
+  802b2d:	eb e5                	jmp    802b14 <open+0x6c>
+		return -E_BAD_PATH;
+  802b2f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802b34:	eb de                	jmp    802b14 <open+0x6c>
+
+00802b36 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802b36:	55                   	push   %ebp
+  802b37:	89 e5                	mov    %esp,%ebp
+  802b39:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802b3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b41:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b46:	e8 a6 fd ff ff       	call   8028f1 <fsipc>
+}
+  802b4b:	c9                   	leave
+  802b4c:	c3                   	ret
+
+00802b4d <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802b4d:	55                   	push   %ebp
+  802b4e:	89 e5                	mov    %esp,%ebp
+  802b50:	57                   	push   %edi
+  802b51:	56                   	push   %esi
+  802b52:	53                   	push   %ebx
+  802b53:	81 ec 54 04 00 00    	sub    $0x454,%esp
+	//
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802b59:	6a 00                	push   $0x0
+  802b5b:	ff 75 08             	push   0x8(%ebp)
+  802b5e:	e8 45 ff ff ff       	call   802aa8 <open>
+  802b63:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  802b69:	83 c4 10             	add    $0x10,%esp
+  802b6c:	85 c0                	test   %eax,%eax
+  802b6e:	0f 88 7a 06 00 00    	js     8031ee <spawn+0x6a1>
+  802b74:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802b76:	83 ec 04             	sub    $0x4,%esp
+  802b79:	68 00 02 00 00       	push   $0x200
+  802b7e:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802b84:	50                   	push   %eax
+  802b85:	51                   	push   %ecx
+  802b86:	e8 01 fb ff ff       	call   80268c <readn>
+  802b8b:	83 c4 10             	add    $0x10,%esp
+  802b8e:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802b93:	75 7a                	jne    802c0f <spawn+0xc2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802b95:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802b9c:	45 4c 46 
+  802b9f:	75 6e                	jne    802c0f <spawn+0xc2>
+	__asm __volatile("int %2"
+  802ba1:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ba6:	cd 30                	int    $0x30
+  802ba8:	89 85 cc fb ff ff    	mov    %eax,-0x434(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802bae:	89 c6                	mov    %eax,%esi
+  802bb0:	85 c0                	test   %eax,%eax
+  802bb2:	0f 88 2a 06 00 00    	js     8031e2 <spawn+0x695>
+		return r;
+	child = r;
+
+	// The child's memory is its own, not our demand-zero regions.
+	if ((r = sys_region_release(child, 0, UTOP)) < 0)
+  802bb8:	83 ec 04             	sub    $0x4,%esp
+  802bbb:	68 00 00 c0 ee       	push   $0xeec00000
+  802bc0:	6a 00                	push   $0x0
+  802bc2:	50                   	push   %eax
+  802bc3:	e8 15 ec ff ff       	call   8017dd <sys_region_release>
+  802bc8:	89 c7                	mov    %eax,%edi
+  802bca:	83 c4 10             	add    $0x10,%esp
+  802bcd:	85 c0                	test   %eax,%eax
+  802bcf:	0f 88 da 05 00 00    	js     8031af <spawn+0x662>
+		goto error;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802bd5:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  802bdb:	69 f6 58 01 00 00    	imul   $0x158,%esi,%esi
+  802be1:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802be7:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802bed:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802bf2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802bf4:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802bfa:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802c00:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802c05:	be 00 00 00 00       	mov    $0x0,%esi
+  802c0a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802c0d:	eb 4b                	jmp    802c5a <spawn+0x10d>
+		close(fd);
+  802c0f:	83 ec 0c             	sub    $0xc,%esp
+  802c12:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802c18:	e8 8c f8 ff ff       	call   8024a9 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802c1d:	83 c4 0c             	add    $0xc,%esp
+  802c20:	68 7f 45 4c 46       	push   $0x464c457f
+  802c25:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802c2b:	68 fe 43 80 00       	push   $0x8043fe
+  802c30:	e8 ef d9 ff ff       	call   800624 <cprintf>
+		return -E_NOT_EXEC;
+  802c35:	83 c4 10             	add    $0x10,%esp
+  802c38:	c7 85 d0 fb ff ff f2 	movl   $0xfffffff2,-0x430(%ebp)
+  802c3f:	ff ff ff 
+  802c42:	e9 a7 05 00 00       	jmp    8031ee <spawn+0x6a1>
+		string_size += strlen(argv[argc]) + 1;
+  802c47:	83 ec 0c             	sub    $0xc,%esp
+  802c4a:	50                   	push   %eax
+  802c4b:	e8 e1 df ff ff       	call   800c31 <strlen>
+  802c50:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802c54:	83 c3 01             	add    $0x1,%ebx
+  802c57:	83 c4 10             	add    $0x10,%esp
+  802c5a:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802c5d:	85 c0                	test   %eax,%eax
+  802c5f:	75 e6                	jne    802c47 <spawn+0xfa>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802c61:	89 9d c4 fb ff ff    	mov    %ebx,-0x43c(%ebp)
+  802c67:	b8 00 10 40 00       	mov    $0x401000,%eax
+  802c6c:	29 f0                	sub    %esi,%eax
+  802c6e:	89 c7                	mov    %eax,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802c70:	89 c2                	mov    %eax,%edx
+  802c72:	83 e2 fc             	and    $0xfffffffc,%edx
+  802c75:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802c7c:	29 c2                	sub    %eax,%edx
+  802c7e:	89 95 d4 fb ff ff    	mov    %edx,-0x42c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802c84:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802c87:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802c8c:	0f 86 6a 05 00 00    	jbe    8031fc <spawn+0x6af>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802c92:	83 ec 04             	sub    $0x4,%esp
+  802c95:	6a 07                	push   $0x7
+  802c97:	68 00 00 40 00       	push   $0x400000
+  802c9c:	6a 00                	push   $0x0
+  802c9e:	e8 c1 e4 ff ff       	call   801164 <sys_page_alloc>
+  802ca3:	83 c4 10             	add    $0x10,%esp
+  802ca6:	85 c0                	test   %eax,%eax
+  802ca8:	0f 88 53 05 00 00    	js     803201 <spawn+0x6b4>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802cae:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb3:	89 9d c8 fb ff ff    	mov    %ebx,-0x438(%ebp)
+  802cb9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802cbc:	eb 30                	jmp    802cee <spawn+0x1a1>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802cbe:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802cc4:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  802cca:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802ccd:	83 ec 08             	sub    $0x8,%esp
+  802cd0:	ff 34 b3             	push   (%ebx,%esi,4)
+  802cd3:	57                   	push   %edi
+  802cd4:	e8 93 df ff ff       	call   800c6c <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802cd9:	83 c4 04             	add    $0x4,%esp
+  802cdc:	ff 34 b3             	push   (%ebx,%esi,4)
+  802cdf:	e8 4d df ff ff       	call   800c31 <strlen>
+  802ce4:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802ce8:	83 c6 01             	add    $0x1,%esi
+  802ceb:	83 c4 10             	add    $0x10,%esp
+  802cee:	39 b5 c8 fb ff ff    	cmp    %esi,-0x438(%ebp)
+  802cf4:	7f c8                	jg     802cbe <spawn+0x171>
+	}
+	argv_store[argc] = 0;
+  802cf6:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802cfc:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  802d02:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802d09:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802d0f:	0f 85 85 00 00 00    	jne    802d9a <spawn+0x24d>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802d15:	8b 95 d4 fb ff ff    	mov    -0x42c(%ebp),%edx
+  802d1b:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  802d21:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  802d24:	89 d0                	mov    %edx,%eax
+  802d26:	8b 8d c4 fb ff ff    	mov    -0x43c(%ebp),%ecx
+  802d2c:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802d2f:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802d34:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802d3a:	83 ec 0c             	sub    $0xc,%esp
+  802d3d:	6a 07                	push   $0x7
+  802d3f:	68 00 d0 bf ee       	push   $0xeebfd000
+  802d44:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802d4a:	68 00 00 40 00       	push   $0x400000
+  802d4f:	6a 00                	push   $0x0
+  802d51:	e8 7b e4 ff ff       	call   8011d1 <sys_page_map>
+  802d56:	89 c3                	mov    %eax,%ebx
+  802d58:	83 c4 20             	add    $0x20,%esp
+  802d5b:	85 c0                	test   %eax,%eax
+  802d5d:	0f 88 a6 04 00 00    	js     803209 <spawn+0x6bc>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802d63:	83 ec 08             	sub    $0x8,%esp
+  802d66:	68 00 00 40 00       	push   $0x400000
+  802d6b:	6a 00                	push   $0x0
+  802d6d:	e8 cd e4 ff ff       	call   80123f <sys_page_unmap>
+  802d72:	89 c3                	mov    %eax,%ebx
+  802d74:	83 c4 10             	add    $0x10,%esp
+  802d77:	85 c0                	test   %eax,%eax
+  802d79:	0f 88 8a 04 00 00    	js     803209 <spawn+0x6bc>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802d7f:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802d85:	8d 9c 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%ebx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d91:	89 df                	mov    %ebx,%edi
+  802d93:	89 c3                	mov    %eax,%ebx
+  802d95:	e9 8d 01 00 00       	jmp    802f27 <spawn+0x3da>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802d9a:	68 b0 44 80 00       	push   $0x8044b0
+  802d9f:	68 d0 42 80 00       	push   $0x8042d0
+  802da4:	68 f3 00 00 00       	push   $0xf3
+  802da9:	68 18 44 80 00       	push   $0x804418
+  802dae:	e8 96 d7 ff ff       	call   800549 <_panic>
+	}
+
+	// The pages that come from the file, a chunk at a time: allocate
+	// the chunk at UTEMP, read it in, and move it to the child.
+	batch_init(&b);
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  802db3:	01 fe                	add    %edi,%esi
+  802db5:	89 b5 d4 fb ff ff    	mov    %esi,-0x42c(%ebp)
+  802dbb:	8b 85 c0 fb ff ff    	mov    -0x440(%ebp),%eax
+  802dc1:	39 c6                	cmp    %eax,%esi
+  802dc3:	0f 83 18 01 00 00    	jae    802ee1 <spawn+0x394>
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  802dc9:	8b 9d b8 fb ff ff    	mov    -0x448(%ebp),%ebx
+  802dcf:	29 f3                	sub    %esi,%ebx
+  802dd1:	c1 eb 0c             	shr    $0xc,%ebx
+  802dd4:	b8 40 00 00 00       	mov    $0x40,%eax
+  802dd9:	39 c3                	cmp    %eax,%ebx
+  802ddb:	0f 47 d8             	cmova  %eax,%ebx
+  802dde:	89 df                	mov    %ebx,%edi
+			SEGMENT_CHUNK);
+		batch_alloc(&b, 0, UTEMP, PTE_P|PTE_U|PTE_W, n);
+  802de0:	83 ec 0c             	sub    $0xc,%esp
+  802de3:	53                   	push   %ebx
+  802de4:	6a 07                	push   $0x7
+  802de6:	68 00 00 40 00       	push   $0x400000
+  802deb:	6a 00                	push   $0x0
+  802ded:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802df3:	50                   	push   %eax
+  802df4:	e8 48 f4 ff ff       	call   802241 <batch_alloc>
+		if ((r = batch_flush(&b)) < 0)
+  802df9:	83 c4 14             	add    $0x14,%esp
+  802dfc:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802e02:	50                   	push   %eax
+  802e03:	e8 d4 f2 ff ff       	call   8020dc <batch_flush>
+  802e08:	83 c4 10             	add    $0x10,%esp
+  802e0b:	85 c0                	test   %eax,%eax
+  802e0d:	0f 88 9a 03 00 00    	js     8031ad <spawn+0x660>
+			return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802e13:	83 ec 08             	sub    $0x8,%esp
+  802e16:	8b 85 bc fb ff ff    	mov    -0x444(%ebp),%eax
+  802e1c:	01 f0                	add    %esi,%eax
+  802e1e:	50                   	push   %eax
+  802e1f:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802e25:	e8 4b f9 ff ff       	call   802775 <seek>
+  802e2a:	83 c4 10             	add    $0x10,%esp
+  802e2d:	85 c0                	test   %eax,%eax
+  802e2f:	0f 88 a1 03 00 00    	js     8031d6 <spawn+0x689>
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802e35:	c1 e7 0c             	shl    $0xc,%edi
+  802e38:	83 ec 04             	sub    $0x4,%esp
+  802e3b:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  802e41:	8b 8d d4 fb ff ff    	mov    -0x42c(%ebp),%ecx
+  802e47:	29 c8                	sub    %ecx,%eax
+  802e49:	39 f8                	cmp    %edi,%eax
+  802e4b:	0f 47 c7             	cmova  %edi,%eax
+  802e4e:	50                   	push   %eax
+  802e4f:	68 00 00 40 00       	push   $0x400000
+  802e54:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802e5a:	e8 2d f8 ff ff       	call   80268c <readn>
+  802e5f:	83 c4 10             	add    $0x10,%esp
+  802e62:	85 c0                	test   %eax,%eax
+  802e64:	0f 88 70 03 00 00    	js     8031da <spawn+0x68d>
+			return r;
+		batch_map(&b, 0, UTEMP, child, (void*) (va + i), perm, n);
+  802e6a:	83 ec 04             	sub    $0x4,%esp
+  802e6d:	53                   	push   %ebx
+  802e6e:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  802e74:	8b 85 d4 fb ff ff    	mov    -0x42c(%ebp),%eax
+  802e7a:	8b 95 c4 fb ff ff    	mov    -0x43c(%ebp),%edx
+  802e80:	01 d0                	add    %edx,%eax
+  802e82:	50                   	push   %eax
+  802e83:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802e89:	68 00 00 40 00       	push   $0x400000
+  802e8e:	6a 00                	push   $0x0
+  802e90:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802e96:	50                   	push   %eax
+  802e97:	e8 d0 f3 ff ff       	call   80226c <batch_map>
+		batch_unmap(&b, 0, UTEMP, n);
+  802e9c:	83 c4 20             	add    $0x20,%esp
+  802e9f:	53                   	push   %ebx
+  802ea0:	68 00 00 40 00       	push   $0x400000
+  802ea5:	6a 00                	push   $0x0
+  802ea7:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802ead:	50                   	push   %eax
+  802eae:	e8 e3 f3 ff ff       	call   802296 <batch_unmap>
+		if ((r = batch_flush(&b)) < 0)
+  802eb3:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802eb9:	89 04 24             	mov    %eax,(%esp)
+  802ebc:	e8 1b f2 ff ff       	call   8020dc <batch_flush>
+  802ec1:	83 c4 10             	add    $0x10,%esp
+  802ec4:	85 c0                	test   %eax,%eax
+  802ec6:	0f 89 e7 fe ff ff    	jns    802db3 <spawn+0x266>
+			panic("spawn: sys_page_map data: %e", r);
+  802ecc:	50                   	push   %eax
+  802ecd:	68 24 44 80 00       	push   $0x804424
+  802ed2:	68 2b 01 00 00       	push   $0x12b
+  802ed7:	68 18 44 80 00       	push   $0x804418
+  802edc:	e8 68 d6 ff ff       	call   800549 <_panic>
+	}
+
+	// the blank pages are demand-zero
+	if (i < memsz)
+  802ee1:	8b 9d ac fb ff ff    	mov    -0x454(%ebp),%ebx
+  802ee7:	8b bd a8 fb ff ff    	mov    -0x458(%ebp),%edi
+  802eed:	89 f2                	mov    %esi,%edx
+  802eef:	8b 85 b0 fb ff ff    	mov    -0x450(%ebp),%eax
+  802ef5:	39 c6                	cmp    %eax,%esi
+  802ef7:	73 28                	jae    802f21 <spawn+0x3d4>
+		return sys_region_reserve(child, (void*) (va + i), memsz - i,
+  802ef9:	ff b5 b4 fb ff ff    	push   -0x44c(%ebp)
+  802eff:	29 f0                	sub    %esi,%eax
+  802f01:	50                   	push   %eax
+  802f02:	8b 85 c4 fb ff ff    	mov    -0x43c(%ebp),%eax
+  802f08:	01 c2                	add    %eax,%edx
+  802f0a:	52                   	push   %edx
+  802f0b:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802f11:	e8 5b e8 ff ff       	call   801771 <sys_region_reserve>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	85 c0                	test   %eax,%eax
+  802f1b:	0f 88 bd 02 00 00    	js     8031de <spawn+0x691>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802f21:	83 c3 01             	add    $0x1,%ebx
+  802f24:	83 c7 20             	add    $0x20,%edi
+  802f27:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802f2e:	39 d8                	cmp    %ebx,%eax
+  802f30:	0f 8e b2 00 00 00    	jle    802fe8 <spawn+0x49b>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802f36:	83 3f 01             	cmpl   $0x1,(%edi)
+  802f39:	75 e6                	jne    802f21 <spawn+0x3d4>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802f3b:	8b 47 18             	mov    0x18(%edi),%eax
+  802f3e:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802f41:	83 f8 01             	cmp    $0x1,%eax
+  802f44:	19 c0                	sbb    %eax,%eax
+  802f46:	83 e0 fe             	and    $0xfffffffe,%eax
+  802f49:	83 c0 07             	add    $0x7,%eax
+  802f4c:	89 85 b4 fb ff ff    	mov    %eax,-0x44c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802f52:	8b 57 04             	mov    0x4(%edi),%edx
+  802f55:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+  802f5b:	8b 77 10             	mov    0x10(%edi),%esi
+  802f5e:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+  802f64:	8b 47 14             	mov    0x14(%edi),%eax
+  802f67:	89 85 b0 fb ff ff    	mov    %eax,-0x450(%ebp)
+  802f6d:	8b 4f 08             	mov    0x8(%edi),%ecx
+  802f70:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+	if ((i = PGOFF(va))) {
+  802f76:	89 c8                	mov    %ecx,%eax
+  802f78:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802f7d:	74 1e                	je     802f9d <spawn+0x450>
+		va -= i;
+  802f7f:	29 c1                	sub    %eax,%ecx
+  802f81:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+		memsz += i;
+  802f87:	01 85 b0 fb ff ff    	add    %eax,-0x450(%ebp)
+		filesz += i;
+  802f8d:	01 c6                	add    %eax,%esi
+  802f8f:	89 b5 c8 fb ff ff    	mov    %esi,-0x438(%ebp)
+		fileoffset -= i;
+  802f95:	29 c2                	sub    %eax,%edx
+  802f97:	89 95 bc fb ff ff    	mov    %edx,-0x444(%ebp)
+	batch_init(&b);
+  802f9d:	83 ec 0c             	sub    $0xc,%esp
+  802fa0:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  802fa6:	50                   	push   %eax
+  802fa7:	e8 14 f1 ff ff       	call   8020c0 <batch_init>
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  802fac:	83 c4 10             	add    $0x10,%esp
+  802faf:	be 00 00 00 00       	mov    $0x0,%esi
+  802fb4:	8b 85 c8 fb ff ff    	mov    -0x438(%ebp),%eax
+  802fba:	8b 8d b0 fb ff ff    	mov    -0x450(%ebp),%ecx
+  802fc0:	39 c8                	cmp    %ecx,%eax
+  802fc2:	0f 46 c8             	cmovbe %eax,%ecx
+		n = MIN(ROUNDUP(MIN(memsz, filesz) - i, PGSIZE) / PGSIZE,
+  802fc5:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  802fcb:	89 85 b8 fb ff ff    	mov    %eax,-0x448(%ebp)
+  802fd1:	89 9d ac fb ff ff    	mov    %ebx,-0x454(%ebp)
+  802fd7:	89 bd a8 fb ff ff    	mov    %edi,-0x458(%ebp)
+  802fdd:	89 8d c0 fb ff ff    	mov    %ecx,-0x440(%ebp)
+	for (i = 0; i < MIN(memsz, filesz); i += n * PGSIZE) {
+  802fe3:	e9 cd fd ff ff       	jmp    802db5 <spawn+0x268>
+	close(fd);
+  802fe8:	83 ec 0c             	sub    $0xc,%esp
+  802feb:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  802ff1:	e8 b3 f4 ff ff       	call   8024a9 <close>
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	struct Batch b;
+	int i, r;
+	cprintf("copy_shared_pages(%x);\n", child);
+  802ff6:	83 c4 08             	add    $0x8,%esp
+  802ff9:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  802fff:	68 41 44 80 00       	push   $0x804441
+  803004:	e8 1b d6 ff ff       	call   800624 <cprintf>
+	
+	batch_init(&b);
+  803009:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80300f:	89 04 24             	mov    %eax,(%esp)
+  803012:	e8 a9 f0 ff ff       	call   8020c0 <batch_init>
+	
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  803017:	83 c4 10             	add    $0x10,%esp
+  80301a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		// Handle PTE flags
+		assert(uvpt[i] & PTE_U);
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+		
+		// Map page (adjacent pages are mapped with one operation)
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  80301f:	8d bd dc fb ff ff    	lea    -0x424(%ebp),%edi
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  803025:	eb 22                	jmp    803049 <spawn+0x4fc>
+			if (uvpd[i / NPTENTRIES] & PTE_SHARE)
+  803027:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80302e:	f6 c6 04             	test   $0x4,%dh
+  803031:	0f 85 97 00 00 00    	jne    8030ce <spawn+0x581>
+			i = ROUNDUP(i + 1, NPTENTRIES) - 1;
+  803037:	8d 9e 00 04 00 00    	lea    0x400(%esi),%ebx
+  80303d:	81 e3 00 fc ff ff    	and    $0xfffffc00,%ebx
+  803043:	83 eb 01             	sub    $0x1,%ebx
+	for (i = 0 ; i < USTACKTOP / PGSIZE; i += 1) {
+  803046:	83 c3 01             	add    $0x1,%ebx
+  803049:	89 de                	mov    %ebx,%esi
+  80304b:	81 fb fd eb 0e 00    	cmp    $0xeebfd,%ebx
+  803051:	0f 87 bd 00 00 00    	ja     803114 <spawn+0x5c7>
+		if (! (uvpd[i / NPTENTRIES] & PTE_P))
+  803057:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+  80305d:	85 db                	test   %ebx,%ebx
+  80305f:	0f 49 c3             	cmovns %ebx,%eax
+  803062:	c1 f8 0a             	sar    $0xa,%eax
+  803065:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  80306c:	f6 c2 01             	test   $0x1,%dl
+  80306f:	74 d5                	je     803046 <spawn+0x4f9>
+		if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  803071:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803078:	f6 c2 80             	test   $0x80,%dl
+  80307b:	75 aa                	jne    803027 <spawn+0x4da>
+		if (! (uvpt[i] & PTE_P))
+  80307d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803084:	a8 01                	test   $0x1,%al
+  803086:	74 be                	je     803046 <spawn+0x4f9>
+		if (! (uvpt[i] & PTE_SHARE))
+  803088:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80308f:	f6 c4 04             	test   $0x4,%ah
+  803092:	74 b2                	je     803046 <spawn+0x4f9>
+		assert(uvpt[i] & PTE_U);
+  803094:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80309b:	a8 04                	test   $0x4,%al
+  80309d:	74 5c                	je     8030fb <spawn+0x5ae>
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  80309f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  8030a6:	89 da                	mov    %ebx,%edx
+  8030a8:	c1 e2 0c             	shl    $0xc,%edx
+  8030ab:	83 ec 04             	sub    $0x4,%esp
+  8030ae:	6a 01                	push   $0x1
+		r = PTE_FLAGS(uvpt[i]) & PTE_SYSCALL;
+  8030b0:	25 07 0e 00 00       	and    $0xe07,%eax
+		batch_map(&b, 0, (void *) (i * PGSIZE), child, (void *) (i * PGSIZE), r, 1);
+  8030b5:	50                   	push   %eax
+  8030b6:	52                   	push   %edx
+  8030b7:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8030bd:	52                   	push   %edx
+  8030be:	6a 00                	push   $0x0
+  8030c0:	57                   	push   %edi
+  8030c1:	e8 a6 f1 ff ff       	call   80226c <batch_map>
+  8030c6:	83 c4 20             	add    $0x20,%esp
+  8030c9:	e9 78 ff ff ff       	jmp    803046 <spawn+0x4f9>
+					  uvpd[i / NPTENTRIES] & PTE_SYSCALL, 1);
+  8030ce:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+					  (void *) (i * PGSIZE),
+  8030d5:	c1 e3 0c             	shl    $0xc,%ebx
+				batch_map(&b, 0, (void *) (i * PGSIZE), child,
+  8030d8:	83 ec 04             	sub    $0x4,%esp
+  8030db:	6a 01                	push   $0x1
+  8030dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030e2:	50                   	push   %eax
+  8030e3:	53                   	push   %ebx
+  8030e4:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8030ea:	53                   	push   %ebx
+  8030eb:	6a 00                	push   $0x0
+  8030ed:	57                   	push   %edi
+  8030ee:	e8 79 f1 ff ff       	call   80226c <batch_map>
+  8030f3:	83 c4 20             	add    $0x20,%esp
+  8030f6:	e9 3c ff ff ff       	jmp    803037 <spawn+0x4ea>
+		assert(uvpt[i] & PTE_U);
+  8030fb:	68 59 44 80 00       	push   $0x804459
+  803100:	68 d0 42 80 00       	push   $0x8042d0
+  803105:	68 58 01 00 00       	push   $0x158
+  80310a:	68 18 44 80 00       	push   $0x804418
+  80310f:	e8 35 d4 ff ff       	call   800549 <_panic>
+	}
+	if ((r = batch_flush(&b)) < 0)
+  803114:	83 ec 0c             	sub    $0xc,%esp
+  803117:	8d 85 dc fb ff ff    	lea    -0x424(%ebp),%eax
+  80311d:	50                   	push   %eax
+  80311e:	e8 b9 ef ff ff       	call   8020dc <batch_flush>
+  803123:	83 c4 10             	add    $0x10,%esp
+  803126:	85 c0                	test   %eax,%eax
+  803128:	78 44                	js     80316e <spawn+0x621>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80312a:	83 ec 08             	sub    $0x8,%esp
+  80312d:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803133:	50                   	push   %eax
+  803134:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  80313a:	e8 d6 e1 ff ff       	call   801315 <sys_env_set_trapframe>
+  80313f:	83 c4 10             	add    $0x10,%esp
+  803142:	85 c0                	test   %eax,%eax
+  803144:	78 3d                	js     803183 <spawn+0x636>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803146:	83 ec 08             	sub    $0x8,%esp
+  803149:	6a 02                	push   $0x2
+  80314b:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  803151:	e8 54 e1 ff ff       	call   8012aa <sys_env_set_status>
+  803156:	83 c4 10             	add    $0x10,%esp
+  803159:	85 c0                	test   %eax,%eax
+  80315b:	78 3b                	js     803198 <spawn+0x64b>
+	return child;
+  80315d:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  803163:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  803169:	e9 80 00 00 00       	jmp    8031ee <spawn+0x6a1>
+		panic("cannot map page: %e", r);
+  80316e:	50                   	push   %eax
+  80316f:	68 69 44 80 00       	push   $0x804469
+  803174:	68 5f 01 00 00       	push   $0x15f
+  803179:	68 18 44 80 00       	push   $0x804418
+  80317e:	e8 c6 d3 ff ff       	call   800549 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  803183:	50                   	push   %eax
+  803184:	68 7d 44 80 00       	push   $0x80447d
+  803189:	68 87 00 00 00       	push   $0x87
+  80318e:	68 18 44 80 00       	push   $0x804418
+  803193:	e8 b1 d3 ff ff       	call   800549 <_panic>
+		panic("sys_env_set_status: %e", r);
+  803198:	50                   	push   %eax
+  803199:	68 97 44 80 00       	push   $0x804497
+  80319e:	68 8a 00 00 00       	push   $0x8a
+  8031a3:	68 18 44 80 00       	push   $0x804418
+  8031a8:	e8 9c d3 ff ff       	call   800549 <_panic>
+  8031ad:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  8031af:	83 ec 0c             	sub    $0xc,%esp
+  8031b2:	ff b5 cc fb ff ff    	push   -0x434(%ebp)
+  8031b8:	e8 b2 de ff ff       	call   80106f <sys_env_destroy>
+	close(fd);
+  8031bd:	83 c4 04             	add    $0x4,%esp
+  8031c0:	ff b5 d0 fb ff ff    	push   -0x430(%ebp)
+  8031c6:	e8 de f2 ff ff       	call   8024a9 <close>
+	return r;
+  8031cb:	83 c4 10             	add    $0x10,%esp
+  8031ce:	89 bd d0 fb ff ff    	mov    %edi,-0x430(%ebp)
+  8031d4:	eb 18                	jmp    8031ee <spawn+0x6a1>
+  8031d6:	89 c7                	mov    %eax,%edi
+  8031d8:	eb d5                	jmp    8031af <spawn+0x662>
+  8031da:	89 c7                	mov    %eax,%edi
+  8031dc:	eb d1                	jmp    8031af <spawn+0x662>
+  8031de:	89 c7                	mov    %eax,%edi
+  8031e0:	eb cd                	jmp    8031af <spawn+0x662>
+		return r;
+  8031e2:	8b 85 cc fb ff ff    	mov    -0x434(%ebp),%eax
+  8031e8:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+}
+  8031ee:	8b 85 d0 fb ff ff    	mov    -0x430(%ebp),%eax
+  8031f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031f7:	5b                   	pop    %ebx
+  8031f8:	5e                   	pop    %esi
+  8031f9:	5f                   	pop    %edi
+  8031fa:	5d                   	pop    %ebp
+  8031fb:	c3                   	ret
+		return -E_NO_MEM;
+  8031fc:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  803201:	89 85 d0 fb ff ff    	mov    %eax,-0x430(%ebp)
+  803207:	eb e5                	jmp    8031ee <spawn+0x6a1>
+	sys_page_unmap(0, UTEMP);
+  803209:	83 ec 08             	sub    $0x8,%esp
+  80320c:	68 00 00 40 00       	push   $0x400000
+  803211:	6a 00                	push   $0x0
+  803213:	e8 27 e0 ff ff       	call   80123f <sys_page_unmap>
+  803218:	83 c4 10             	add    $0x10,%esp
+  80321b:	89 9d d0 fb ff ff    	mov    %ebx,-0x430(%ebp)
+  803221:	eb cb                	jmp    8031ee <spawn+0x6a1>
+
+00803223 <spawnl>:
+{
+  803223:	55                   	push   %ebp
+  803224:	89 e5                	mov    %esp,%ebp
+  803226:	56                   	push   %esi
+  803227:	53                   	push   %ebx
+	va_start(vl, arg0);
+  803228:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  80322b:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  803230:	eb 05                	jmp    803237 <spawnl+0x14>
+		argc++;
+  803232:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  803235:	89 ca                	mov    %ecx,%edx
+  803237:	8d 4a 04             	lea    0x4(%edx),%ecx
+  80323a:	83 3a 00             	cmpl   $0x0,(%edx)
+  80323d:	75 f3                	jne    803232 <spawnl+0xf>
+	const char *argv[argc+2];
+  80323f:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  803246:	83 e2 f0             	and    $0xfffffff0,%edx
+  803249:	29 d4                	sub    %edx,%esp
+  80324b:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  80324f:	89 da                	mov    %ebx,%edx
+  803251:	c1 ea 02             	shr    $0x2,%edx
+  803254:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  803257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80325a:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  803261:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  803268:	00 
+	va_start(vl, arg0);
+  803269:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  80326c:	89 c2                	mov    %eax,%edx
+  80326e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803273:	eb 0b                	jmp    803280 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  803275:	83 c0 01             	add    $0x1,%eax
+  803278:	8b 31                	mov    (%ecx),%esi
+  80327a:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  80327d:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803280:	39 d0                	cmp    %edx,%eax
+  803282:	75 f1                	jne    803275 <spawnl+0x52>
+	return spawn(prog, argv);
+  803284:	83 ec 08             	sub    $0x8,%esp
+  803287:	53                   	push   %ebx
+  803288:	ff 75 08             	push   0x8(%ebp)
+  80328b:	e8 bd f8 ff ff       	call   802b4d <spawn>
+}
+  803290:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803293:	5b                   	pop    %ebx
+  803294:	5e                   	pop    %esi
+  803295:	5d                   	pop    %ebp
+  803296:	c3                   	ret
+
+00803297 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  803297:	55                   	push   %ebp
+  803298:	89 e5                	mov    %esp,%ebp
+  80329a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80329d:	68 d6 44 80 00       	push   $0x8044d6
+  8032a2:	ff 75 0c             	push   0xc(%ebp)
+  8032a5:	e8 c2 d9 ff ff       	call   800c6c <strcpy>
+	return 0;
+}
+  8032aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032af:	c9                   	leave
+  8032b0:	c3                   	ret
+
+008032b1 <devsock_close>:
+{
+  8032b1:	55                   	push   %ebp
+  8032b2:	89 e5                	mov    %esp,%ebp
+  8032b4:	53                   	push   %ebx
+  8032b5:	83 ec 10             	sub    $0x10,%esp
+  8032b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8032bb:	53                   	push   %ebx
+  8032bc:	e8 51 0a 00 00       	call   803d12 <pageref>
+  8032c1:	89 c2                	mov    %eax,%edx
+  8032c3:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8032c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8032cb:	83 fa 01             	cmp    $0x1,%edx
+  8032ce:	74 05                	je     8032d5 <devsock_close+0x24>
+}
+  8032d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032d3:	c9                   	leave
+  8032d4:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8032d5:	83 ec 0c             	sub    $0xc,%esp
+  8032d8:	ff 73 0c             	push   0xc(%ebx)
+  8032db:	e8 b7 02 00 00       	call   803597 <nsipc_close>
+  8032e0:	83 c4 10             	add    $0x10,%esp
+  8032e3:	eb eb                	jmp    8032d0 <devsock_close+0x1f>
+
+008032e5 <devsock_write>:
+{
+  8032e5:	55                   	push   %ebp
+  8032e6:	89 e5                	mov    %esp,%ebp
+  8032e8:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8032eb:	6a 00                	push   $0x0
+  8032ed:	ff 75 10             	push   0x10(%ebp)
+  8032f0:	ff 75 0c             	push   0xc(%ebp)
+  8032f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032f6:	ff 70 0c             	push   0xc(%eax)
+  8032f9:	e8 79 03 00 00       	call   803677 <nsipc_send>
+}
+  8032fe:	c9                   	leave
+  8032ff:	c3                   	ret
+
+00803300 <devsock_read>:
+{
+  803300:	55                   	push   %ebp
+  803301:	89 e5                	mov    %esp,%ebp
+  803303:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803306:	6a 00                	push   $0x0
+  803308:	ff 75 10             	push   0x10(%ebp)
+  80330b:	ff 75 0c             	push   0xc(%ebp)
+  80330e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803311:	ff 70 0c             	push   0xc(%eax)
+  803314:	e8 ef 02 00 00       	call   803608 <nsipc_recv>
+}
+  803319:	c9                   	leave
+  80331a:	c3                   	ret
+
+0080331b <fd2sockid>:
+{
+  80331b:	55                   	push   %ebp
+  80331c:	89 e5                	mov    %esp,%ebp
+  80331e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803321:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803324:	52                   	push   %edx
+  803325:	50                   	push   %eax
+  803326:	e8 34 f0 ff ff       	call   80235f <fd_lookup>
+  80332b:	83 c4 10             	add    $0x10,%esp
+  80332e:	85 c0                	test   %eax,%eax
+  803330:	78 10                	js     803342 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803332:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803335:	8b 0d 3c 50 80 00    	mov    0x80503c,%ecx
+  80333b:	39 08                	cmp    %ecx,(%eax)
+  80333d:	75 05                	jne    803344 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80333f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803342:	c9                   	leave
+  803343:	c3                   	ret
+		return -E_NOT_SUPP;
+  803344:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803349:	eb f7                	jmp    803342 <fd2sockid+0x27>
+
+0080334b <alloc_sockfd>:
+{
+  80334b:	55                   	push   %ebp
+  80334c:	89 e5                	mov    %esp,%ebp
+  80334e:	56                   	push   %esi
+  80334f:	53                   	push   %ebx
+  803350:	83 ec 1c             	sub    $0x1c,%esp
+  803353:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803355:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803358:	50                   	push   %eax
+  803359:	e8 ab ef ff ff       	call   802309 <fd_alloc>
+  80335e:	89 c3                	mov    %eax,%ebx
+  803360:	83 c4 10             	add    $0x10,%esp
+  803363:	85 c0                	test   %eax,%eax
+  803365:	78 43                	js     8033aa <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803367:	83 ec 04             	sub    $0x4,%esp
+  80336a:	68 07 04 00 00       	push   $0x407
+  80336f:	ff 75 f4             	push   -0xc(%ebp)
+  803372:	6a 00                	push   $0x0
+  803374:	e8 eb dd ff ff       	call   801164 <sys_page_alloc>
+  803379:	89 c3                	mov    %eax,%ebx
+  80337b:	83 c4 10             	add    $0x10,%esp
+  80337e:	85 c0                	test   %eax,%eax
+  803380:	78 28                	js     8033aa <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803382:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803385:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80338b:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80338d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803390:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803397:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80339a:	83 ec 0c             	sub    $0xc,%esp
+  80339d:	50                   	push   %eax
+  80339e:	e8 3f ef ff ff       	call   8022e2 <fd2num>
+  8033a3:	89 c3                	mov    %eax,%ebx
+  8033a5:	83 c4 10             	add    $0x10,%esp
+  8033a8:	eb 0c                	jmp    8033b6 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8033aa:	83 ec 0c             	sub    $0xc,%esp
+  8033ad:	56                   	push   %esi
+  8033ae:	e8 e4 01 00 00       	call   803597 <nsipc_close>
+		return r;
+  8033b3:	83 c4 10             	add    $0x10,%esp
+}
+  8033b6:	89 d8                	mov    %ebx,%eax
+  8033b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033bb:	5b                   	pop    %ebx
+  8033bc:	5e                   	pop    %esi
+  8033bd:	5d                   	pop    %ebp
+  8033be:	c3                   	ret
+
+008033bf <accept>:
+{
+  8033bf:	55                   	push   %ebp
+  8033c0:	89 e5                	mov    %esp,%ebp
+  8033c2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8033c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033c8:	e8 4e ff ff ff       	call   80331b <fd2sockid>
+  8033cd:	85 c0                	test   %eax,%eax
+  8033cf:	78 1b                	js     8033ec <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8033d1:	83 ec 04             	sub    $0x4,%esp
+  8033d4:	ff 75 10             	push   0x10(%ebp)
+  8033d7:	ff 75 0c             	push   0xc(%ebp)
+  8033da:	50                   	push   %eax
+  8033db:	e8 0e 01 00 00       	call   8034ee <nsipc_accept>
+  8033e0:	83 c4 10             	add    $0x10,%esp
+  8033e3:	85 c0                	test   %eax,%eax
+  8033e5:	78 05                	js     8033ec <accept+0x2d>
+	return alloc_sockfd(r);
+  8033e7:	e8 5f ff ff ff       	call   80334b <alloc_sockfd>
+}
+  8033ec:	c9                   	leave
+  8033ed:	c3                   	ret
+
+008033ee <bind>:
+{
+  8033ee:	55                   	push   %ebp
+  8033ef:	89 e5                	mov    %esp,%ebp
+  8033f1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8033f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f7:	e8 1f ff ff ff       	call   80331b <fd2sockid>
+  8033fc:	85 c0                	test   %eax,%eax
+  8033fe:	78 12                	js     803412 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  803400:	83 ec 04             	sub    $0x4,%esp
+  803403:	ff 75 10             	push   0x10(%ebp)
+  803406:	ff 75 0c             	push   0xc(%ebp)
+  803409:	50                   	push   %eax
+  80340a:	e8 31 01 00 00       	call   803540 <nsipc_bind>
+  80340f:	83 c4 10             	add    $0x10,%esp
+}
+  803412:	c9                   	leave
+  803413:	c3                   	ret
+
+00803414 <shutdown>:
+{
+  803414:	55                   	push   %ebp
+  803415:	89 e5                	mov    %esp,%ebp
+  803417:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80341a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80341d:	e8 f9 fe ff ff       	call   80331b <fd2sockid>
+  803422:	85 c0                	test   %eax,%eax
+  803424:	78 0f                	js     803435 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803426:	83 ec 08             	sub    $0x8,%esp
+  803429:	ff 75 0c             	push   0xc(%ebp)
+  80342c:	50                   	push   %eax
+  80342d:	e8 43 01 00 00       	call   803575 <nsipc_shutdown>
+  803432:	83 c4 10             	add    $0x10,%esp
+}
+  803435:	c9                   	leave
+  803436:	c3                   	ret
+
+00803437 <connect>:
+{
+  803437:	55                   	push   %ebp
+  803438:	89 e5                	mov    %esp,%ebp
+  80343a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80343d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803440:	e8 d6 fe ff ff       	call   80331b <fd2sockid>
+  803445:	85 c0                	test   %eax,%eax
+  803447:	78 12                	js     80345b <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803449:	83 ec 04             	sub    $0x4,%esp
+  80344c:	ff 75 10             	push   0x10(%ebp)
+  80344f:	ff 75 0c             	push   0xc(%ebp)
+  803452:	50                   	push   %eax
+  803453:	e8 59 01 00 00       	call   8035b1 <nsipc_connect>
+  803458:	83 c4 10             	add    $0x10,%esp
+}
+  80345b:	c9                   	leave
+  80345c:	c3                   	ret
+
+0080345d <listen>:
+{
+  80345d:	55                   	push   %ebp
+  80345e:	89 e5                	mov    %esp,%ebp
+  803460:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803463:	8b 45 08             	mov    0x8(%ebp),%eax
+  803466:	e8 b0 fe ff ff       	call   80331b <fd2sockid>
+  80346b:	85 c0                	test   %eax,%eax
+  80346d:	78 0f                	js     80347e <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80346f:	83 ec 08             	sub    $0x8,%esp
+  803472:	ff 75 0c             	push   0xc(%ebp)
+  803475:	50                   	push   %eax
+  803476:	e8 6b 01 00 00       	call   8035e6 <nsipc_listen>
+  80347b:	83 c4 10             	add    $0x10,%esp
+}
+  80347e:	c9                   	leave
+  80347f:	c3                   	ret
+
+00803480 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803480:	55                   	push   %ebp
+  803481:	89 e5                	mov    %esp,%ebp
+  803483:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803486:	ff 75 10             	push   0x10(%ebp)
+  803489:	ff 75 0c             	push   0xc(%ebp)
+  80348c:	ff 75 08             	push   0x8(%ebp)
+  80348f:	e8 41 02 00 00       	call   8036d5 <nsipc_socket>
+  803494:	83 c4 10             	add    $0x10,%esp
+  803497:	85 c0                	test   %eax,%eax
+  803499:	78 05                	js     8034a0 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80349b:	e8 ab fe ff ff       	call   80334b <alloc_sockfd>
+}
+  8034a0:	c9                   	leave
+  8034a1:	c3                   	ret
+
+008034a2 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8034a2:	55                   	push   %ebp
+  8034a3:	89 e5                	mov    %esp,%ebp
+  8034a5:	53                   	push   %ebx
+  8034a6:	83 ec 04             	sub    $0x4,%esp
+  8034a9:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8034ab:	83 3d 04 60 80 00 00 	cmpl   $0x0,0x806004
+  8034b2:	74 26                	je     8034da <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8034b4:	6a 07                	push   $0x7
+  8034b6:	68 00 80 80 00       	push   $0x808000
+  8034bb:	53                   	push   %ebx
+  8034bc:	ff 35 04 60 80 00    	push   0x806004
+  8034c2:	e8 b8 07 00 00       	call   803c7f <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8034c7:	83 c4 0c             	add    $0xc,%esp
+  8034ca:	6a 00                	push   $0x0
+  8034cc:	6a 00                	push   $0x0
+  8034ce:	6a 00                	push   $0x0
+  8034d0:	e8 92 07 00 00       	call   803c67 <ipc_recv>
+}
+  8034d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034d8:	c9                   	leave
+  8034d9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8034da:	83 ec 0c             	sub    $0xc,%esp
+  8034dd:	6a 02                	push   $0x2
+  8034df:	e8 ef 07 00 00       	call   803cd3 <ipc_find_env>
+  8034e4:	a3 04 60 80 00       	mov    %eax,0x806004
+  8034e9:	83 c4 10             	add    $0x10,%esp
+  8034ec:	eb c6                	jmp    8034b4 <nsipc+0x12>
+
+008034ee <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8034ee:	55                   	push   %ebp
+  8034ef:	89 e5                	mov    %esp,%ebp
+  8034f1:	56                   	push   %esi
+  8034f2:	53                   	push   %ebx
+  8034f3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8034f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8034fe:	8b 06                	mov    (%esi),%eax
+  803500:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803505:	b8 01 00 00 00       	mov    $0x1,%eax
+  80350a:	e8 93 ff ff ff       	call   8034a2 <nsipc>
+  80350f:	89 c3                	mov    %eax,%ebx
+  803511:	85 c0                	test   %eax,%eax
+  803513:	79 09                	jns    80351e <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803515:	89 d8                	mov    %ebx,%eax
+  803517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80351a:	5b                   	pop    %ebx
+  80351b:	5e                   	pop    %esi
+  80351c:	5d                   	pop    %ebp
+  80351d:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80351e:	83 ec 04             	sub    $0x4,%esp
+  803521:	ff 35 10 80 80 00    	push   0x808010
+  803527:	68 00 80 80 00       	push   $0x808000
+  80352c:	ff 75 0c             	push   0xc(%ebp)
+  80352f:	e8 be d8 ff ff       	call   800df2 <memmove>
+		*addrlen = ret->ret_addrlen;
+  803534:	a1 10 80 80 00       	mov    0x808010,%eax
+  803539:	89 06                	mov    %eax,(%esi)
+  80353b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80353e:	eb d5                	jmp    803515 <nsipc_accept+0x27>
+
+00803540 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803540:	55                   	push   %ebp
+  803541:	89 e5                	mov    %esp,%ebp
+  803543:	53                   	push   %ebx
+  803544:	83 ec 08             	sub    $0x8,%esp
+  803547:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80354a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80354d:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803552:	53                   	push   %ebx
+  803553:	ff 75 0c             	push   0xc(%ebp)
+  803556:	68 04 80 80 00       	push   $0x808004
+  80355b:	e8 92 d8 ff ff       	call   800df2 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803560:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  803566:	b8 02 00 00 00       	mov    $0x2,%eax
+  80356b:	e8 32 ff ff ff       	call   8034a2 <nsipc>
+}
+  803570:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803573:	c9                   	leave
+  803574:	c3                   	ret
+
+00803575 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803575:	55                   	push   %ebp
+  803576:	89 e5                	mov    %esp,%ebp
+  803578:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80357b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80357e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  803583:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803586:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80358b:	b8 03 00 00 00       	mov    $0x3,%eax
+  803590:	e8 0d ff ff ff       	call   8034a2 <nsipc>
+}
+  803595:	c9                   	leave
+  803596:	c3                   	ret
+
+00803597 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803597:	55                   	push   %ebp
+  803598:	89 e5                	mov    %esp,%ebp
+  80359a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80359d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035a0:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8035a5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8035aa:	e8 f3 fe ff ff       	call   8034a2 <nsipc>
+}
+  8035af:	c9                   	leave
+  8035b0:	c3                   	ret
+
+008035b1 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8035b1:	55                   	push   %ebp
+  8035b2:	89 e5                	mov    %esp,%ebp
+  8035b4:	53                   	push   %ebx
+  8035b5:	83 ec 08             	sub    $0x8,%esp
+  8035b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8035bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035be:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8035c3:	53                   	push   %ebx
+  8035c4:	ff 75 0c             	push   0xc(%ebp)
+  8035c7:	68 04 80 80 00       	push   $0x808004
+  8035cc:	e8 21 d8 ff ff       	call   800df2 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8035d1:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8035d7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8035dc:	e8 c1 fe ff ff       	call   8034a2 <nsipc>
+}
+  8035e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035e4:	c9                   	leave
+  8035e5:	c3                   	ret
+
+008035e6 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8035e6:	55                   	push   %ebp
+  8035e7:	89 e5                	mov    %esp,%ebp
+  8035e9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8035ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ef:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8035f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035f7:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8035fc:	b8 06 00 00 00       	mov    $0x6,%eax
+  803601:	e8 9c fe ff ff       	call   8034a2 <nsipc>
+}
+  803606:	c9                   	leave
+  803607:	c3                   	ret
+
+00803608 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803608:	55                   	push   %ebp
+  803609:	89 e5                	mov    %esp,%ebp
+  80360b:	56                   	push   %esi
+  80360c:	53                   	push   %ebx
+  80360d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803610:	8b 45 08             	mov    0x8(%ebp),%eax
+  803613:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  803618:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80361e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803621:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803626:	b8 07 00 00 00       	mov    $0x7,%eax
+  80362b:	e8 72 fe ff ff       	call   8034a2 <nsipc>
+  803630:	89 c3                	mov    %eax,%ebx
+  803632:	85 c0                	test   %eax,%eax
+  803634:	78 22                	js     803658 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803636:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80363b:	39 c6                	cmp    %eax,%esi
+  80363d:	0f 4e c6             	cmovle %esi,%eax
+  803640:	39 c3                	cmp    %eax,%ebx
+  803642:	7f 1d                	jg     803661 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803644:	83 ec 04             	sub    $0x4,%esp
+  803647:	53                   	push   %ebx
+  803648:	68 00 80 80 00       	push   $0x808000
+  80364d:	ff 75 0c             	push   0xc(%ebp)
+  803650:	e8 9d d7 ff ff       	call   800df2 <memmove>
+  803655:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803658:	89 d8                	mov    %ebx,%eax
+  80365a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80365d:	5b                   	pop    %ebx
+  80365e:	5e                   	pop    %esi
+  80365f:	5d                   	pop    %ebp
+  803660:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803661:	68 e2 44 80 00       	push   $0x8044e2
+  803666:	68 d0 42 80 00       	push   $0x8042d0
+  80366b:	6a 62                	push   $0x62
+  80366d:	68 f7 44 80 00       	push   $0x8044f7
+  803672:	e8 d2 ce ff ff       	call   800549 <_panic>
+
+00803677 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803677:	55                   	push   %ebp
+  803678:	89 e5                	mov    %esp,%ebp
+  80367a:	53                   	push   %ebx
+  80367b:	83 ec 04             	sub    $0x4,%esp
+  80367e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803681:	8b 45 08             	mov    0x8(%ebp),%eax
+  803684:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  803689:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80368f:	7f 2e                	jg     8036bf <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803691:	83 ec 04             	sub    $0x4,%esp
+  803694:	53                   	push   %ebx
+  803695:	ff 75 0c             	push   0xc(%ebp)
+  803698:	68 0c 80 80 00       	push   $0x80800c
+  80369d:	e8 50 d7 ff ff       	call   800df2 <memmove>
+	nsipcbuf.send.req_size = size;
+  8036a2:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8036a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8036ab:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8036b0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8036b5:	e8 e8 fd ff ff       	call   8034a2 <nsipc>
+}
+  8036ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036bd:	c9                   	leave
+  8036be:	c3                   	ret
+	assert(size < 1600);
+  8036bf:	68 03 45 80 00       	push   $0x804503
+  8036c4:	68 d0 42 80 00       	push   $0x8042d0
+  8036c9:	6a 6d                	push   $0x6d
+  8036cb:	68 f7 44 80 00       	push   $0x8044f7
+  8036d0:	e8 74 ce ff ff       	call   800549 <_panic>
+
+008036d5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8036d5:	55                   	push   %ebp
+  8036d6:	89 e5                	mov    %esp,%ebp
+  8036d8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8036db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036de:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8036e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036e6:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8036eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036ee:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8036f3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8036f8:	e8 a5 fd ff ff       	call   8034a2 <nsipc>
+}
+  8036fd:	c9                   	leave
+  8036fe:	c3                   	ret
+
+008036ff <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8036ff:	55                   	push   %ebp
+  803700:	89 e5                	mov    %esp,%ebp
+  803702:	56                   	push   %esi
+  803703:	53                   	push   %ebx
+  803704:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803707:	83 ec 0c             	sub    $0xc,%esp
+  80370a:	ff 75 08             	push   0x8(%ebp)
+  80370d:	e8 e0 eb ff ff       	call   8022f2 <fd2data>
+  803712:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803714:	83 c4 08             	add    $0x8,%esp
+  803717:	68 0f 45 80 00       	push   $0x80450f
+  80371c:	53                   	push   %ebx
+  80371d:	e8 4a d5 ff ff       	call   800c6c <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803722:	8b 46 04             	mov    0x4(%esi),%eax
+  803725:	2b 06                	sub    (%esi),%eax
+  803727:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80372d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803734:	00 00 00 
+	stat->st_dev = &devpipe;
+  803737:	c7 83 88 00 00 00 58 	movl   $0x805058,0x88(%ebx)
+  80373e:	50 80 00 
+	return 0;
+}
+  803741:	b8 00 00 00 00       	mov    $0x0,%eax
+  803746:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803749:	5b                   	pop    %ebx
+  80374a:	5e                   	pop    %esi
+  80374b:	5d                   	pop    %ebp
+  80374c:	c3                   	ret
+
+0080374d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80374d:	55                   	push   %ebp
+  80374e:	89 e5                	mov    %esp,%ebp
+  803750:	53                   	push   %ebx
+  803751:	83 ec 0c             	sub    $0xc,%esp
+  803754:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803757:	53                   	push   %ebx
+  803758:	6a 00                	push   $0x0
+  80375a:	e8 e0 da ff ff       	call   80123f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80375f:	89 1c 24             	mov    %ebx,(%esp)
+  803762:	e8 8b eb ff ff       	call   8022f2 <fd2data>
+  803767:	83 c4 08             	add    $0x8,%esp
+  80376a:	50                   	push   %eax
+  80376b:	6a 00                	push   $0x0
+  80376d:	e8 cd da ff ff       	call   80123f <sys_page_unmap>
+}
+  803772:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803775:	c9                   	leave
+  803776:	c3                   	ret
+
+00803777 <_pipeisclosed>:
+{
+  803777:	55                   	push   %ebp
+  803778:	89 e5                	mov    %esp,%ebp
+  80377a:	57                   	push   %edi
+  80377b:	56                   	push   %esi
+  80377c:	53                   	push   %ebx
+  80377d:	83 ec 1c             	sub    $0x1c,%esp
+  803780:	89 c7                	mov    %eax,%edi
+  803782:	89 d6                	mov    %edx,%esi
+  803784:	eb 3c                	jmp    8037c2 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  803786:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  803789:	83 ec 0c             	sub    $0xc,%esp
+  80378c:	57                   	push   %edi
+  80378d:	e8 80 05 00 00       	call   803d12 <pageref>
+  803792:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803795:	89 34 24             	mov    %esi,(%esp)
+  803798:	e8 75 05 00 00       	call   803d12 <pageref>
+  80379d:	89 c2                	mov    %eax,%edx
+  80379f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8037a1:	05 00 00 00 20       	add    $0x20000000,%eax
+  8037a6:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8037a9:	8b 0d 08 60 80 00    	mov    0x806008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8037af:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8037b4:	76 31                	jbe    8037e7 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8037b6:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8037b9:	39 c3                	cmp    %eax,%ebx
+  8037bb:	74 76                	je     803833 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8037bd:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8037c0:	74 36                	je     8037f8 <_pipeisclosed+0x81>
+  8037c2:	89 e0                	mov    %esp,%eax
+  8037c4:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8037c9:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8037cf:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8037d4:	77 b0                	ja     803786 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8037d6:	c1 e8 10             	shr    $0x10,%eax
+  8037d9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8037df:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8037e5:	eb 9f                	jmp    803786 <_pipeisclosed+0xf>
+  8037e7:	c1 e8 10             	shr    $0x10,%eax
+  8037ea:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8037f0:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8037f6:	eb be                	jmp    8037b6 <_pipeisclosed+0x3f>
+  8037f8:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8037fa:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8037ff:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803805:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80380a:	76 16                	jbe    803822 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80380c:	8b 42 58             	mov    0x58(%edx),%eax
+  80380f:	6a 01                	push   $0x1
+  803811:	50                   	push   %eax
+  803812:	53                   	push   %ebx
+  803813:	68 16 45 80 00       	push   $0x804516
+  803818:	e8 07 ce ff ff       	call   800624 <cprintf>
+  80381d:	83 c4 10             	add    $0x10,%esp
+  803820:	eb a0                	jmp    8037c2 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803822:	c1 e8 10             	shr    $0x10,%eax
+  803825:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80382b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803831:	eb d9                	jmp    80380c <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  803833:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  803836:	0f 94 c0             	sete   %al
+  803839:	0f b6 c0             	movzbl %al,%eax
+}
+  80383c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80383f:	5b                   	pop    %ebx
+  803840:	5e                   	pop    %esi
+  803841:	5f                   	pop    %edi
+  803842:	5d                   	pop    %ebp
+  803843:	c3                   	ret
+
+00803844 <devpipe_write>:
+{
+  803844:	55                   	push   %ebp
+  803845:	89 e5                	mov    %esp,%ebp
+  803847:	57                   	push   %edi
+  803848:	56                   	push   %esi
+  803849:	53                   	push   %ebx
+  80384a:	83 ec 28             	sub    $0x28,%esp
+  80384d:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803850:	56                   	push   %esi
+  803851:	e8 9c ea ff ff       	call   8022f2 <fd2data>
+  803856:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803858:	83 c4 10             	add    $0x10,%esp
+  80385b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803860:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803863:	75 09                	jne    80386e <devpipe_write+0x2a>
+	return i;
+  803865:	89 f8                	mov    %edi,%eax
+  803867:	eb 23                	jmp    80388c <devpipe_write+0x48>
+			sys_yield();
+  803869:	e8 b0 d8 ff ff       	call   80111e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80386e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803871:	8b 0b                	mov    (%ebx),%ecx
+  803873:	8d 51 20             	lea    0x20(%ecx),%edx
+  803876:	39 d0                	cmp    %edx,%eax
+  803878:	72 1a                	jb     803894 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  80387a:	89 da                	mov    %ebx,%edx
+  80387c:	89 f0                	mov    %esi,%eax
+  80387e:	e8 f4 fe ff ff       	call   803777 <_pipeisclosed>
+  803883:	85 c0                	test   %eax,%eax
+  803885:	74 e2                	je     803869 <devpipe_write+0x25>
+				return 0;
+  803887:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80388c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80388f:	5b                   	pop    %ebx
+  803890:	5e                   	pop    %esi
+  803891:	5f                   	pop    %edi
+  803892:	5d                   	pop    %ebp
+  803893:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803894:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803897:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80389b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80389e:	89 c2                	mov    %eax,%edx
+  8038a0:	c1 fa 1f             	sar    $0x1f,%edx
+  8038a3:	89 d1                	mov    %edx,%ecx
+  8038a5:	c1 e9 1b             	shr    $0x1b,%ecx
+  8038a8:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8038ab:	83 e2 1f             	and    $0x1f,%edx
+  8038ae:	29 ca                	sub    %ecx,%edx
+  8038b0:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8038b4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8038b8:	83 c0 01             	add    $0x1,%eax
+  8038bb:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8038be:	83 c7 01             	add    $0x1,%edi
+  8038c1:	eb 9d                	jmp    803860 <devpipe_write+0x1c>
+
+008038c3 <devpipe_read>:
+{
+  8038c3:	55                   	push   %ebp
+  8038c4:	89 e5                	mov    %esp,%ebp
+  8038c6:	57                   	push   %edi
+  8038c7:	56                   	push   %esi
+  8038c8:	53                   	push   %ebx
+  8038c9:	83 ec 18             	sub    $0x18,%esp
+  8038cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8038cf:	57                   	push   %edi
+  8038d0:	e8 1d ea ff ff       	call   8022f2 <fd2data>
+  8038d5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8038d7:	83 c4 10             	add    $0x10,%esp
+  8038da:	be 00 00 00 00       	mov    $0x0,%esi
+  8038df:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8038e2:	75 13                	jne    8038f7 <devpipe_read+0x34>
+	return i;
+  8038e4:	89 f0                	mov    %esi,%eax
+  8038e6:	eb 02                	jmp    8038ea <devpipe_read+0x27>
+				return i;
+  8038e8:	89 f0                	mov    %esi,%eax
+}
+  8038ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038ed:	5b                   	pop    %ebx
+  8038ee:	5e                   	pop    %esi
+  8038ef:	5f                   	pop    %edi
+  8038f0:	5d                   	pop    %ebp
+  8038f1:	c3                   	ret
+			sys_yield();
+  8038f2:	e8 27 d8 ff ff       	call   80111e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8038f7:	8b 03                	mov    (%ebx),%eax
+  8038f9:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8038fc:	75 18                	jne    803916 <devpipe_read+0x53>
+			if (i > 0)
+  8038fe:	85 f6                	test   %esi,%esi
+  803900:	75 e6                	jne    8038e8 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803902:	89 da                	mov    %ebx,%edx
+  803904:	89 f8                	mov    %edi,%eax
+  803906:	e8 6c fe ff ff       	call   803777 <_pipeisclosed>
+  80390b:	85 c0                	test   %eax,%eax
+  80390d:	74 e3                	je     8038f2 <devpipe_read+0x2f>
+				return 0;
+  80390f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803914:	eb d4                	jmp    8038ea <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803916:	99                   	cltd
+  803917:	c1 ea 1b             	shr    $0x1b,%edx
+  80391a:	01 d0                	add    %edx,%eax
+  80391c:	83 e0 1f             	and    $0x1f,%eax
+  80391f:	29 d0                	sub    %edx,%eax
+  803921:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803926:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803929:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80392c:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80392f:	83 c6 01             	add    $0x1,%esi
+  803932:	eb ab                	jmp    8038df <devpipe_read+0x1c>
+
+00803934 <pipe>:
+{
+  803934:	55                   	push   %ebp
+  803935:	89 e5                	mov    %esp,%ebp
+  803937:	56                   	push   %esi
+  803938:	53                   	push   %ebx
+  803939:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80393c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80393f:	50                   	push   %eax
+  803940:	e8 c4 e9 ff ff       	call   802309 <fd_alloc>
+  803945:	89 c3                	mov    %eax,%ebx
+  803947:	83 c4 10             	add    $0x10,%esp
+  80394a:	85 c0                	test   %eax,%eax
+  80394c:	0f 88 23 01 00 00    	js     803a75 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803952:	83 ec 04             	sub    $0x4,%esp
+  803955:	68 07 04 00 00       	push   $0x407
+  80395a:	ff 75 f4             	push   -0xc(%ebp)
+  80395d:	6a 00                	push   $0x0
+  80395f:	e8 00 d8 ff ff       	call   801164 <sys_page_alloc>
+  803964:	89 c3                	mov    %eax,%ebx
+  803966:	83 c4 10             	add    $0x10,%esp
+  803969:	85 c0                	test   %eax,%eax
+  80396b:	0f 88 04 01 00 00    	js     803a75 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803971:	83 ec 0c             	sub    $0xc,%esp
+  803974:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803977:	50                   	push   %eax
+  803978:	e8 8c e9 ff ff       	call   802309 <fd_alloc>
+  80397d:	89 c3                	mov    %eax,%ebx
+  80397f:	83 c4 10             	add    $0x10,%esp
+  803982:	85 c0                	test   %eax,%eax
+  803984:	0f 88 db 00 00 00    	js     803a65 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80398a:	83 ec 04             	sub    $0x4,%esp
+  80398d:	68 07 04 00 00       	push   $0x407
+  803992:	ff 75 f0             	push   -0x10(%ebp)
+  803995:	6a 00                	push   $0x0
+  803997:	e8 c8 d7 ff ff       	call   801164 <sys_page_alloc>
+  80399c:	89 c3                	mov    %eax,%ebx
+  80399e:	83 c4 10             	add    $0x10,%esp
+  8039a1:	85 c0                	test   %eax,%eax
+  8039a3:	0f 88 bc 00 00 00    	js     803a65 <pipe+0x131>
+	va = fd2data(fd0);
+  8039a9:	83 ec 0c             	sub    $0xc,%esp
+  8039ac:	ff 75 f4             	push   -0xc(%ebp)
+  8039af:	e8 3e e9 ff ff       	call   8022f2 <fd2data>
+  8039b4:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039b6:	83 c4 0c             	add    $0xc,%esp
+  8039b9:	68 07 04 00 00       	push   $0x407
+  8039be:	50                   	push   %eax
+  8039bf:	6a 00                	push   $0x0
+  8039c1:	e8 9e d7 ff ff       	call   801164 <sys_page_alloc>
+  8039c6:	89 c3                	mov    %eax,%ebx
+  8039c8:	83 c4 10             	add    $0x10,%esp
+  8039cb:	85 c0                	test   %eax,%eax
+  8039cd:	0f 88 82 00 00 00    	js     803a55 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039d3:	83 ec 0c             	sub    $0xc,%esp
+  8039d6:	ff 75 f0             	push   -0x10(%ebp)
+  8039d9:	e8 14 e9 ff ff       	call   8022f2 <fd2data>
+  8039de:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8039e5:	50                   	push   %eax
+  8039e6:	6a 00                	push   $0x0
+  8039e8:	56                   	push   %esi
+  8039e9:	6a 00                	push   $0x0
+  8039eb:	e8 e1 d7 ff ff       	call   8011d1 <sys_page_map>
+  8039f0:	89 c3                	mov    %eax,%ebx
+  8039f2:	83 c4 20             	add    $0x20,%esp
+  8039f5:	85 c0                	test   %eax,%eax
+  8039f7:	78 4e                	js     803a47 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8039f9:	a1 58 50 80 00       	mov    0x805058,%eax
+  8039fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a01:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803a03:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a06:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803a0d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803a10:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803a12:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803a15:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803a1c:	83 ec 0c             	sub    $0xc,%esp
+  803a1f:	ff 75 f4             	push   -0xc(%ebp)
+  803a22:	e8 bb e8 ff ff       	call   8022e2 <fd2num>
+  803a27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a2a:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803a2c:	83 c4 04             	add    $0x4,%esp
+  803a2f:	ff 75 f0             	push   -0x10(%ebp)
+  803a32:	e8 ab e8 ff ff       	call   8022e2 <fd2num>
+  803a37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a3a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803a3d:	83 c4 10             	add    $0x10,%esp
+  803a40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a45:	eb 2e                	jmp    803a75 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803a47:	83 ec 08             	sub    $0x8,%esp
+  803a4a:	56                   	push   %esi
+  803a4b:	6a 00                	push   $0x0
+  803a4d:	e8 ed d7 ff ff       	call   80123f <sys_page_unmap>
+  803a52:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803a55:	83 ec 08             	sub    $0x8,%esp
+  803a58:	ff 75 f0             	push   -0x10(%ebp)
+  803a5b:	6a 00                	push   $0x0
+  803a5d:	e8 dd d7 ff ff       	call   80123f <sys_page_unmap>
+  803a62:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803a65:	83 ec 08             	sub    $0x8,%esp
+  803a68:	ff 75 f4             	push   -0xc(%ebp)
+  803a6b:	6a 00                	push   $0x0
+  803a6d:	e8 cd d7 ff ff       	call   80123f <sys_page_unmap>
+  803a72:	83 c4 10             	add    $0x10,%esp
+}
+  803a75:	89 d8                	mov    %ebx,%eax
+  803a77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a7a:	5b                   	pop    %ebx
+  803a7b:	5e                   	pop    %esi
+  803a7c:	5d                   	pop    %ebp
+  803a7d:	c3                   	ret
+
+00803a7e <pipeisclosed>:
+{
+  803a7e:	55                   	push   %ebp
+  803a7f:	89 e5                	mov    %esp,%ebp
+  803a81:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a87:	50                   	push   %eax
+  803a88:	ff 75 08             	push   0x8(%ebp)
+  803a8b:	e8 cf e8 ff ff       	call   80235f <fd_lookup>
+  803a90:	83 c4 10             	add    $0x10,%esp
+  803a93:	85 c0                	test   %eax,%eax
+  803a95:	78 18                	js     803aaf <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803a97:	83 ec 0c             	sub    $0xc,%esp
+  803a9a:	ff 75 f4             	push   -0xc(%ebp)
+  803a9d:	e8 50 e8 ff ff       	call   8022f2 <fd2data>
+  803aa2:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803aa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803aa7:	e8 cb fc ff ff       	call   803777 <_pipeisclosed>
+  803aac:	83 c4 10             	add    $0x10,%esp
+}
+  803aaf:	c9                   	leave
+  803ab0:	c3                   	ret
+
+00803ab1 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803ab1:	55                   	push   %ebp
+  803ab2:	89 e5                	mov    %esp,%ebp
+  803ab4:	56                   	push   %esi
+  803ab5:	53                   	push   %ebx
+  803ab6:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803ab9:	85 f6                	test   %esi,%esi
+  803abb:	74 16                	je     803ad3 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  803abd:	89 f3                	mov    %esi,%ebx
+  803abf:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803ac5:	69 db 58 01 00 00    	imul   $0x158,%ebx,%ebx
+  803acb:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803ad1:	eb 1b                	jmp    803aee <wait+0x3d>
+	assert(envid != 0);
+  803ad3:	68 2e 45 80 00       	push   $0x80452e
+  803ad8:	68 d0 42 80 00       	push   $0x8042d0
+  803add:	6a 09                	push   $0x9
+  803adf:	68 39 45 80 00       	push   $0x804539
+  803ae4:	e8 60 ca ff ff       	call   800549 <_panic>
+		sys_yield();
+  803ae9:	e8 30 d6 ff ff       	call   80111e <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803aee:	8b 43 48             	mov    0x48(%ebx),%eax
+  803af1:	39 f0                	cmp    %esi,%eax
+  803af3:	75 07                	jne    803afc <wait+0x4b>
+  803af5:	8b 43 54             	mov    0x54(%ebx),%eax
+  803af8:	85 c0                	test   %eax,%eax
+  803afa:	75 ed                	jne    803ae9 <wait+0x38>
+}
+  803afc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803aff:	5b                   	pop    %ebx
+  803b00:	5e                   	pop    %esi
+  803b01:	5d                   	pop    %ebp
+  803b02:	c3                   	ret
+
+00803b03 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803b03:	55                   	push   %ebp
+  803b04:	89 e5                	mov    %esp,%ebp
+  803b06:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  803b09:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803b10:	74 0a                	je     803b1c <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803b12:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b15:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  803b1a:	c9                   	leave
+  803b1b:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  803b1c:	83 ec 04             	sub    $0x4,%esp
+  803b1f:	6a 07                	push   $0x7
+  803b21:	68 00 f0 bf ee       	push   $0xeebff000
+  803b26:	6a 00                	push   $0x0
+  803b28:	e8 37 d6 ff ff       	call   801164 <sys_page_alloc>
+  803b2d:	83 c4 10             	add    $0x10,%esp
+  803b30:	85 c0                	test   %eax,%eax
+  803b32:	78 14                	js     803b48 <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803b34:	83 ec 08             	sub    $0x8,%esp
+  803b37:	68 6a 3b 80 00       	push   $0x803b6a
+  803b3c:	6a 00                	push   $0x0
+  803b3e:	e8 3d d8 ff ff       	call   801380 <sys_env_set_pgfault_upcall>
+  803b43:	83 c4 10             	add    $0x10,%esp
+  803b46:	eb ca                	jmp    803b12 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  803b48:	83 ec 08             	sub    $0x8,%esp
+  803b4b:	50                   	push   %eax
+  803b4c:	68 44 45 80 00       	push   $0x804544
+  803b51:	e8 ce ca ff ff       	call   800624 <cprintf>
+			panic("set_pgfault_handler error");
+  803b56:	83 c4 0c             	add    $0xc,%esp
+  803b59:	68 4f 45 80 00       	push   $0x80454f
+  803b5e:	6a 24                	push   $0x24
+  803b60:	68 69 45 80 00       	push   $0x804569
+  803b65:	e8 df c9 ff ff       	call   800549 <_panic>
+
+00803b6a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803b6a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803b6b:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  803b70:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803b72:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803b75:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  803b79:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  803b7c:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803b80:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803b82:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803b86:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803b87:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  803b8b:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  803b8c:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  803b8d:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803b91:	c3                   	ret
+
+00803b92 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  803b92:	55                   	push   %ebp
+  803b93:	89 e5                	mov    %esp,%ebp
+  803b95:	56                   	push   %esi
+  803b96:	53                   	push   %ebx
+  803b97:	8b 75 08             	mov    0x8(%ebp),%esi
+  803b9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803b9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803ba0:	85 c0                	test   %eax,%eax
+  803ba2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803ba7:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  803baa:	83 ec 08             	sub    $0x8,%esp
+  803bad:	ff 75 14             	push   0x14(%ebp)
+  803bb0:	50                   	push   %eax
+  803bb1:	e8 bf d9 ff ff       	call   801575 <sys_ipc_recv_until>
+  803bb6:	83 c4 10             	add    $0x10,%esp
+  803bb9:	85 c0                	test   %eax,%eax
+  803bbb:	78 61                	js     803c1e <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  803bbd:	85 f6                	test   %esi,%esi
+  803bbf:	74 1c                	je     803bdd <ipc_recv_until+0x4b>
+  803bc1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803bc3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803bc8:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803bce:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803bd3:	76 5f                	jbe    803c34 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  803bd5:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  803bdb:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  803bdd:	85 db                	test   %ebx,%ebx
+  803bdf:	74 1c                	je     803bfd <ipc_recv_until+0x6b>
+  803be1:	89 e0                	mov    %esp,%eax
+  803be3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803be8:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803bee:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803bf3:	76 50                	jbe    803c45 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  803bf5:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  803bfb:	89 03                	mov    %eax,(%ebx)
+  803bfd:	89 e0                	mov    %esp,%eax
+  803bff:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  803c04:	8b 15 08 60 80 00    	mov    0x806008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  803c0a:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  803c0f:	76 45                	jbe    803c56 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  803c11:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  803c17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c1a:	5b                   	pop    %ebx
+  803c1b:	5e                   	pop    %esi
+  803c1c:	5d                   	pop    %ebp
+  803c1d:	c3                   	ret
+		if (from_env_store)
+  803c1e:	85 f6                	test   %esi,%esi
+  803c20:	74 06                	je     803c28 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  803c22:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  803c28:	85 db                	test   %ebx,%ebx
+  803c2a:	74 eb                	je     803c17 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  803c2c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803c32:	eb e3                	jmp    803c17 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  803c34:	c1 e8 10             	shr    $0x10,%eax
+  803c37:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803c3d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803c43:	eb 90                	jmp    803bd5 <ipc_recv_until+0x43>
+  803c45:	c1 e8 10             	shr    $0x10,%eax
+  803c48:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803c4e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803c54:	eb 9f                	jmp    803bf5 <ipc_recv_until+0x63>
+  803c56:	c1 e8 10             	shr    $0x10,%eax
+  803c59:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803c5f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  803c65:	eb aa                	jmp    803c11 <ipc_recv_until+0x7f>
+
+00803c67 <ipc_recv>:
+{
+  803c67:	55                   	push   %ebp
+  803c68:	89 e5                	mov    %esp,%ebp
+  803c6a:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  803c6d:	6a 00                	push   $0x0
+  803c6f:	ff 75 10             	push   0x10(%ebp)
+  803c72:	ff 75 0c             	push   0xc(%ebp)
+  803c75:	ff 75 08             	push   0x8(%ebp)
+  803c78:	e8 15 ff ff ff       	call   803b92 <ipc_recv_until>
+}
+  803c7d:	c9                   	leave
+  803c7e:	c3                   	ret
+
+00803c7f <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803c7f:	55                   	push   %ebp
+  803c80:	89 e5                	mov    %esp,%ebp
+  803c82:	57                   	push   %edi
+  803c83:	56                   	push   %esi
+  803c84:	53                   	push   %ebx
+  803c85:	83 ec 0c             	sub    $0xc,%esp
+  803c88:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c8b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803c8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  803c91:	85 db                	test   %ebx,%ebx
+  803c93:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803c98:	0f 44 d8             	cmove  %eax,%ebx
+  803c9b:	eb 05                	jmp    803ca2 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  803c9d:	e8 7c d4 ff ff       	call   80111e <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  803ca2:	ff 75 14             	push   0x14(%ebp)
+  803ca5:	53                   	push   %ebx
+  803ca6:	56                   	push   %esi
+  803ca7:	57                   	push   %edi
+  803ca8:	e8 14 d8 ff ff       	call   8014c1 <sys_ipc_try_send>
+  803cad:	83 c4 10             	add    $0x10,%esp
+  803cb0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803cb3:	74 e8                	je     803c9d <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  803cb5:	85 c0                	test   %eax,%eax
+  803cb7:	78 08                	js     803cc1 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  803cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cbc:	5b                   	pop    %ebx
+  803cbd:	5e                   	pop    %esi
+  803cbe:	5f                   	pop    %edi
+  803cbf:	5d                   	pop    %ebp
+  803cc0:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  803cc1:	50                   	push   %eax
+  803cc2:	68 77 45 80 00       	push   $0x804577
+  803cc7:	6a 4f                	push   $0x4f
+  803cc9:	68 8a 45 80 00       	push   $0x80458a
+  803cce:	e8 76 c8 ff ff       	call   800549 <_panic>
+
+00803cd3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803cd3:	55                   	push   %ebp
+  803cd4:	89 e5                	mov    %esp,%ebp
+  803cd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803cde:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  803ce4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803cea:	8b 52 50             	mov    0x50(%edx),%edx
+  803ced:	39 ca                	cmp    %ecx,%edx
+  803cef:	74 11                	je     803d02 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803cf1:	83 c0 01             	add    $0x1,%eax
+  803cf4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803cf9:	75 e3                	jne    803cde <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d00:	eb 0e                	jmp    803d10 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803d02:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  803d08:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d0d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803d10:	5d                   	pop    %ebp
+  803d11:	c3                   	ret
+
+00803d12 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803d12:	55                   	push   %ebp
+  803d13:	89 e5                	mov    %esp,%ebp
+  803d15:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803d18:	89 c2                	mov    %eax,%edx
+  803d1a:	c1 ea 16             	shr    $0x16,%edx
+  803d1d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803d24:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803d29:	f6 c1 01             	test   $0x1,%cl
+  803d2c:	74 1a                	je     803d48 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  803d2e:	c1 e8 0c             	shr    $0xc,%eax
+  803d31:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803d38:	a8 01                	test   $0x1,%al
+  803d3a:	74 0c                	je     803d48 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803d3c:	c1 e8 0c             	shr    $0xc,%eax
+  803d3f:	c1 e0 04             	shl    $0x4,%eax
+  803d42:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  803d48:	89 d0                	mov    %edx,%eax
+  803d4a:	5d                   	pop    %ebp
+  803d4b:	c3                   	ret
@@ -0,0 +1,7421 @@
+
+obj/user/testsleep.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ca 01 00 00       	call   8001fb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+	unsigned start, took;
+	envid_t child, from;
+	int32_t r;
+
+	// Sleeping takes as long as asked, give or take a millisecond.
+	start = time_msec();
+  80003b:	e8 c0 32 00 00       	call   803300 <time_msec>
+  800040:	89 c3                	mov    %eax,%ebx
+	sys_sleep_until(start + 100);
+  800042:	83 ec 0c             	sub    $0xc,%esp
+  800045:	8d 40 64             	lea    0x64(%eax),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 2d 13 00 00       	call   80137b <sys_sleep_until>
+	took = time_msec() - start;
+  80004e:	e8 ad 32 00 00       	call   803300 <time_msec>
+  800053:	29 d8                	sub    %ebx,%eax
+	if (took < 100 || took > 110)
+  800055:	8d 50 9c             	lea    -0x64(%eax),%edx
+  800058:	83 c4 10             	add    $0x10,%esp
+  80005b:	83 fa 0a             	cmp    $0xa,%edx
+  80005e:	0f 87 d5 00 00 00    	ja     800139 <umain+0x106>
+		panic("sleeping 100ms took %u ms", took);
+	cprintf("sleep: slept %u ms\n", took);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	50                   	push   %eax
+  800068:	68 0b 36 80 00       	push   $0x80360b
+  80006d:	e8 28 03 00 00       	call   80039a <cprintf>
+
+	// A receive nobody sends to times out at the deadline.
+	start = time_msec();
+  800072:	e8 89 32 00 00       	call   803300 <time_msec>
+  800077:	89 c3                	mov    %eax,%ebx
+	r = ipc_recv_until(&from, 0, 0, start + 50);
+  800079:	8d 40 32             	lea    0x32(%eax),%eax
+  80007c:	50                   	push   %eax
+  80007d:	6a 00                	push   $0x0
+  80007f:	6a 00                	push   $0x0
+  800081:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800084:	50                   	push   %eax
+  800085:	e8 ac 1d 00 00       	call   801e36 <ipc_recv_until>
+  80008a:	89 c6                	mov    %eax,%esi
+	took = time_msec() - start;
+  80008c:	83 c4 20             	add    $0x20,%esp
+  80008f:	e8 6c 32 00 00       	call   803300 <time_msec>
+  800094:	29 d8                	sub    %ebx,%eax
+	if (r != -E_TIMEOUT)
+  800096:	83 fe ee             	cmp    $0xffffffee,%esi
+  800099:	0f 85 ac 00 00 00    	jne    80014b <umain+0x118>
+		panic("ipc_recv_until returned %e, not timeout", r);
+	if (took < 50 || took > 60)
+  80009f:	8d 50 ce             	lea    -0x32(%eax),%edx
+  8000a2:	83 fa 0a             	cmp    $0xa,%edx
+  8000a5:	0f 87 b2 00 00 00    	ja     80015d <umain+0x12a>
+		panic("timeout of 50ms took %u ms", took);
+	cprintf("sleep: receive timed out after %u ms\n", took);
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	50                   	push   %eax
+  8000af:	68 70 36 80 00       	push   $0x803670
+  8000b4:	e8 e1 02 00 00       	call   80039a <cprintf>
+
+	// A message that arrives in time beats the deadline.
+	if ((child = fork()) < 0)
+  8000b9:	e8 07 1d 00 00       	call   801dc5 <fork>
+  8000be:	89 c3                	mov    %eax,%ebx
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	0f 88 a4 00 00 00    	js     80016f <umain+0x13c>
+		panic("fork: %e", child);
+	if (child == 0) {
+  8000cb:	0f 84 b0 00 00 00    	je     800181 <umain+0x14e>
+		sys_sleep_until(time_msec() + 20);
+		ipc_send(thisenv->env_parent_id, 42, 0, 0);
+		return;
+	}
+	r = ipc_recv_until(&from, 0, 0, time_msec() + 1000);
+  8000d1:	e8 2a 32 00 00       	call   803300 <time_msec>
+  8000d6:	05 e8 03 00 00       	add    $0x3e8,%eax
+  8000db:	50                   	push   %eax
+  8000dc:	6a 00                	push   $0x0
+  8000de:	6a 00                	push   $0x0
+  8000e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000e3:	50                   	push   %eax
+  8000e4:	e8 4d 1d 00 00       	call   801e36 <ipc_recv_until>
+	if (r != 42 || from != child)
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	83 f8 2a             	cmp    $0x2a,%eax
+  8000ef:	0f 85 dc 00 00 00    	jne    8001d1 <umain+0x19e>
+  8000f5:	39 5d f4             	cmp    %ebx,-0xc(%ebp)
+  8000f8:	0f 85 d3 00 00 00    	jne    8001d1 <umain+0x19e>
+		panic("ipc_recv_until returned %e from %08x", r, from);
+
+	// And the stale timeout does not disturb the next receive.
+	r = ipc_recv_until(&from, 0, 0, time_msec() + 1100);
+  8000fe:	e8 fd 31 00 00       	call   803300 <time_msec>
+  800103:	05 4c 04 00 00       	add    $0x44c,%eax
+  800108:	50                   	push   %eax
+  800109:	6a 00                	push   $0x0
+  80010b:	6a 00                	push   $0x0
+  80010d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800110:	50                   	push   %eax
+  800111:	e8 20 1d 00 00       	call   801e36 <ipc_recv_until>
+	if (r != -E_TIMEOUT)
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	83 f8 ee             	cmp    $0xffffffee,%eax
+  80011c:	0f 85 c7 00 00 00    	jne    8001e9 <umain+0x1b6>
+		panic("second ipc_recv_until returned %e", r);
+
+	cprintf("sleep: OK\n");
+  800122:	83 ec 0c             	sub    $0xc,%esp
+  800125:	68 3a 36 80 00       	push   $0x80363a
+  80012a:	e8 6b 02 00 00       	call   80039a <cprintf>
+  80012f:	83 c4 10             	add    $0x10,%esp
+}
+  800132:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800135:	5b                   	pop    %ebx
+  800136:	5e                   	pop    %esi
+  800137:	5d                   	pop    %ebp
+  800138:	c3                   	ret
+		panic("sleeping 100ms took %u ms", took);
+  800139:	50                   	push   %eax
+  80013a:	68 e0 35 80 00       	push   $0x8035e0
+  80013f:	6a 11                	push   $0x11
+  800141:	68 fa 35 80 00       	push   $0x8035fa
+  800146:	e8 74 01 00 00       	call   8002bf <_panic>
+		panic("ipc_recv_until returned %e, not timeout", r);
+  80014b:	56                   	push   %esi
+  80014c:	68 48 36 80 00       	push   $0x803648
+  800151:	6a 19                	push   $0x19
+  800153:	68 fa 35 80 00       	push   $0x8035fa
+  800158:	e8 62 01 00 00       	call   8002bf <_panic>
+		panic("timeout of 50ms took %u ms", took);
+  80015d:	50                   	push   %eax
+  80015e:	68 1f 36 80 00       	push   $0x80361f
+  800163:	6a 1b                	push   $0x1b
+  800165:	68 fa 35 80 00       	push   $0x8035fa
+  80016a:	e8 50 01 00 00       	call   8002bf <_panic>
+		panic("fork: %e", child);
+  80016f:	50                   	push   %eax
+  800170:	68 50 3b 80 00       	push   $0x803b50
+  800175:	6a 20                	push   $0x20
+  800177:	68 fa 35 80 00       	push   $0x8035fa
+  80017c:	e8 3e 01 00 00       	call   8002bf <_panic>
+		sys_sleep_until(time_msec() + 20);
+  800181:	e8 7a 31 00 00       	call   803300 <time_msec>
+  800186:	83 ec 0c             	sub    $0xc,%esp
+  800189:	83 c0 14             	add    $0x14,%eax
+  80018c:	50                   	push   %eax
+  80018d:	e8 e9 11 00 00       	call   80137b <sys_sleep_until>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800192:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800194:	05 00 00 00 20       	add    $0x20000000,%eax
+  800199:	83 c4 10             	add    $0x10,%esp
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  80019c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8001a2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8001a7:	76 17                	jbe    8001c0 <umain+0x18d>
+		ipc_send(thisenv->env_parent_id, 42, 0, 0);
+  8001a9:	8b 42 4c             	mov    0x4c(%edx),%eax
+  8001ac:	6a 00                	push   $0x0
+  8001ae:	6a 00                	push   $0x0
+  8001b0:	6a 2a                	push   $0x2a
+  8001b2:	50                   	push   %eax
+  8001b3:	e8 6b 1d 00 00       	call   801f23 <ipc_send>
+  8001b8:	83 c4 10             	add    $0x10,%esp
+  8001bb:	e9 72 ff ff ff       	jmp    800132 <umain+0xff>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8001c0:	c1 e8 10             	shr    $0x10,%eax
+  8001c3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8001c9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8001cf:	eb d8                	jmp    8001a9 <umain+0x176>
+		panic("ipc_recv_until returned %e from %08x", r, from);
+  8001d1:	83 ec 0c             	sub    $0xc,%esp
+  8001d4:	ff 75 f4             	push   -0xc(%ebp)
+  8001d7:	50                   	push   %eax
+  8001d8:	68 98 36 80 00       	push   $0x803698
+  8001dd:	6a 28                	push   $0x28
+  8001df:	68 fa 35 80 00       	push   $0x8035fa
+  8001e4:	e8 d6 00 00 00       	call   8002bf <_panic>
+		panic("second ipc_recv_until returned %e", r);
+  8001e9:	50                   	push   %eax
+  8001ea:	68 c0 36 80 00       	push   $0x8036c0
+  8001ef:	6a 2d                	push   $0x2d
+  8001f1:	68 fa 35 80 00       	push   $0x8035fa
+  8001f6:	e8 c4 00 00 00       	call   8002bf <_panic>
+
+008001fb <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	57                   	push   %edi
+  8001ff:	56                   	push   %esi
+  800200:	53                   	push   %ebx
+  800201:	83 ec 0c             	sub    $0xc,%esp
+  800204:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800207:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80020a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80020f:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800211:	c1 ea 0b             	shr    $0xb,%edx
+  800214:	83 f2 01             	xor    $0x1,%edx
+  800217:	83 e2 01             	and    $0x1,%edx
+  80021a:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800220:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800227:	00 00 00 
+	envid = sys_getenvid();
+  80022a:	e8 1f 0c 00 00       	call   800e4e <sys_getenvid>
+  80022f:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800231:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800236:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  80023c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800242:	8b 52 48             	mov    0x48(%edx),%edx
+  800245:	39 ca                	cmp    %ecx,%edx
+  800247:	74 27                	je     800270 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800249:	83 c0 01             	add    $0x1,%eax
+  80024c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800251:	75 e3                	jne    800236 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800253:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80025a:	75 24                	jne    800280 <libmain+0x85>
+		panic("libmain can't find the environment");
+  80025c:	83 ec 04             	sub    $0x4,%esp
+  80025f:	68 e4 36 80 00       	push   $0x8036e4
+  800264:	6a 23                	push   $0x23
+  800266:	68 07 37 80 00       	push   $0x803707
+  80026b:	e8 4f 00 00 00       	call   8002bf <_panic>
+			mainenv = &envs[i];
+  800270:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800276:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80027b:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800280:	85 ff                	test   %edi,%edi
+  800282:	7e 07                	jle    80028b <libmain+0x90>
+		binaryname = argv[0];
+  800284:	8b 06                	mov    (%esi),%eax
+  800286:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80028b:	83 ec 08             	sub    $0x8,%esp
+  80028e:	56                   	push   %esi
+  80028f:	57                   	push   %edi
+  800290:	e8 9e fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800295:	e8 0b 00 00 00       	call   8002a5 <exit>
+}
+  80029a:	83 c4 10             	add    $0x10,%esp
+  80029d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5f                   	pop    %edi
+  8002a3:	5d                   	pop    %ebp
+  8002a4:	c3                   	ret
+
+008002a5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002a5:	55                   	push   %ebp
+  8002a6:	89 e5                	mov    %esp,%ebp
+  8002a8:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002ab:	e8 1c 21 00 00       	call   8023cc <close_all>
+	sys_env_destroy(0);
+  8002b0:	83 ec 0c             	sub    $0xc,%esp
+  8002b3:	6a 00                	push   $0x0
+  8002b5:	e8 2b 0b 00 00       	call   800de5 <sys_env_destroy>
+}
+  8002ba:	83 c4 10             	add    $0x10,%esp
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+
+008002bf <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002bf:	55                   	push   %ebp
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	56                   	push   %esi
+  8002c3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002c4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002c7:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002cd:	e8 7c 0b 00 00       	call   800e4e <sys_getenvid>
+  8002d2:	83 ec 0c             	sub    $0xc,%esp
+  8002d5:	ff 75 0c             	push   0xc(%ebp)
+  8002d8:	ff 75 08             	push   0x8(%ebp)
+  8002db:	56                   	push   %esi
+  8002dc:	50                   	push   %eax
+  8002dd:	68 20 37 80 00       	push   $0x803720
+  8002e2:	e8 b3 00 00 00       	call   80039a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002e7:	83 c4 18             	add    $0x18,%esp
+  8002ea:	53                   	push   %ebx
+  8002eb:	ff 75 10             	push   0x10(%ebp)
+  8002ee:	e8 56 00 00 00       	call   800349 <vcprintf>
+	cprintf("\n");
+  8002f3:	c7 04 24 43 36 80 00 	movl   $0x803643,(%esp)
+  8002fa:	e8 9b 00 00 00       	call   80039a <cprintf>
+  8002ff:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800302:	cc                   	int3
+	while (1)
+  800303:	eb fd                	jmp    800302 <_panic+0x43>
+
+00800305 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800305:	55                   	push   %ebp
+  800306:	89 e5                	mov    %esp,%ebp
+  800308:	53                   	push   %ebx
+  800309:	83 ec 04             	sub    $0x4,%esp
+  80030c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80030f:	8b 13                	mov    (%ebx),%edx
+  800311:	8d 42 01             	lea    0x1(%edx),%eax
+  800314:	89 03                	mov    %eax,(%ebx)
+  800316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800319:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80031d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800322:	74 09                	je     80032d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800324:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80032b:	c9                   	leave
+  80032c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80032d:	83 ec 08             	sub    $0x8,%esp
+  800330:	68 ff 00 00 00       	push   $0xff
+  800335:	8d 43 08             	lea    0x8(%ebx),%eax
+  800338:	50                   	push   %eax
+  800339:	e8 1d 0a 00 00       	call   800d5b <sys_cputs>
+		b->idx = 0;
+  80033e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800344:	83 c4 10             	add    $0x10,%esp
+  800347:	eb db                	jmp    800324 <putch+0x1f>
+
+00800349 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800349:	55                   	push   %ebp
+  80034a:	89 e5                	mov    %esp,%ebp
+  80034c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800352:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800359:	00 00 00 
+	b.cnt = 0;
+  80035c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800363:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800366:	ff 75 0c             	push   0xc(%ebp)
+  800369:	ff 75 08             	push   0x8(%ebp)
+  80036c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800372:	50                   	push   %eax
+  800373:	68 05 03 80 00       	push   $0x800305
+  800378:	e8 fb 00 00 00       	call   800478 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80037d:	83 c4 08             	add    $0x8,%esp
+  800380:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800386:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80038c:	50                   	push   %eax
+  80038d:	e8 c9 09 00 00       	call   800d5b <sys_cputs>
+
+	return b.cnt;
+}
+  800392:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800398:	c9                   	leave
+  800399:	c3                   	ret
+
+0080039a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80039a:	55                   	push   %ebp
+  80039b:	89 e5                	mov    %esp,%ebp
+  80039d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003a0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003a3:	50                   	push   %eax
+  8003a4:	ff 75 08             	push   0x8(%ebp)
+  8003a7:	e8 9d ff ff ff       	call   800349 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003ac:	c9                   	leave
+  8003ad:	c3                   	ret
+
+008003ae <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8003ae:	55                   	push   %ebp
+  8003af:	89 e5                	mov    %esp,%ebp
+  8003b1:	57                   	push   %edi
+  8003b2:	56                   	push   %esi
+  8003b3:	53                   	push   %ebx
+  8003b4:	83 ec 1c             	sub    $0x1c,%esp
+  8003b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ba:	89 d6                	mov    %edx,%esi
+  8003bc:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8003bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003c2:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8003c5:	73 0b                	jae    8003d2 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8003c7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003ca:	c1 e7 08             	shl    $0x8,%edi
+  8003cd:	0b 7d 10             	or     0x10(%ebp),%edi
+  8003d0:	eb 36                	jmp    800408 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8003d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8003d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003da:	f7 75 08             	divl   0x8(%ebp)
+  8003dd:	89 c1                	mov    %eax,%ecx
+  8003df:	ff 75 14             	push   0x14(%ebp)
+  8003e2:	ff 75 10             	push   0x10(%ebp)
+  8003e5:	83 eb 01             	sub    $0x1,%ebx
+  8003e8:	53                   	push   %ebx
+  8003e9:	ff 75 08             	push   0x8(%ebp)
+  8003ec:	89 f2                	mov    %esi,%edx
+  8003ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8003f1:	e8 b8 ff ff ff       	call   8003ae <printnum>
+  8003f6:	83 c4 10             	add    $0x10,%esp
+  8003f9:	eb 14                	jmp    80040f <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8003fb:	83 ec 08             	sub    $0x8,%esp
+  8003fe:	56                   	push   %esi
+  8003ff:	57                   	push   %edi
+  800400:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800403:	ff d0                	call   *%eax
+  800405:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800408:	83 eb 01             	sub    $0x1,%ebx
+  80040b:	85 db                	test   %ebx,%ebx
+  80040d:	7f ec                	jg     8003fb <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80040f:	83 ec 08             	sub    $0x8,%esp
+  800412:	56                   	push   %esi
+  800413:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800416:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041b:	f7 75 08             	divl   0x8(%ebp)
+  80041e:	0f be 92 43 37 80 00 	movsbl 0x803743(%edx),%edx
+  800425:	8b 45 14             	mov    0x14(%ebp),%eax
+  800428:	c1 e0 08             	shl    $0x8,%eax
+  80042b:	09 d0                	or     %edx,%eax
+  80042d:	50                   	push   %eax
+  80042e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800431:	ff d0                	call   *%eax
+}
+  800433:	83 c4 10             	add    $0x10,%esp
+  800436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800439:	5b                   	pop    %ebx
+  80043a:	5e                   	pop    %esi
+  80043b:	5f                   	pop    %edi
+  80043c:	5d                   	pop    %ebp
+  80043d:	c3                   	ret
+
+0080043e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80043e:	55                   	push   %ebp
+  80043f:	89 e5                	mov    %esp,%ebp
+  800441:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800444:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800448:	8b 10                	mov    (%eax),%edx
+  80044a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80044d:	73 0a                	jae    800459 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80044f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800452:	89 08                	mov    %ecx,(%eax)
+  800454:	8b 45 08             	mov    0x8(%ebp),%eax
+  800457:	88 02                	mov    %al,(%edx)
+}
+  800459:	5d                   	pop    %ebp
+  80045a:	c3                   	ret
+
+0080045b <printfmt>:
+{
+  80045b:	55                   	push   %ebp
+  80045c:	89 e5                	mov    %esp,%ebp
+  80045e:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800461:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800464:	50                   	push   %eax
+  800465:	ff 75 10             	push   0x10(%ebp)
+  800468:	ff 75 0c             	push   0xc(%ebp)
+  80046b:	ff 75 08             	push   0x8(%ebp)
+  80046e:	e8 05 00 00 00       	call   800478 <vprintfmt>
+}
+  800473:	83 c4 10             	add    $0x10,%esp
+  800476:	c9                   	leave
+  800477:	c3                   	ret
+
+00800478 <vprintfmt>:
+{
+  800478:	55                   	push   %ebp
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	57                   	push   %edi
+  80047c:	56                   	push   %esi
+  80047d:	53                   	push   %ebx
+  80047e:	83 ec 3c             	sub    $0x3c,%esp
+  800481:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800484:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800487:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80048e:	eb 16                	jmp    8004a6 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	ff 75 0c             	push   0xc(%ebp)
+  800496:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800499:	c1 e2 08             	shl    $0x8,%edx
+  80049c:	09 d0                	or     %edx,%eax
+  80049e:	50                   	push   %eax
+  80049f:	ff d7                	call   *%edi
+  8004a1:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004a4:	89 de                	mov    %ebx,%esi
+  8004a6:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8004a9:	0f b6 06             	movzbl (%esi),%eax
+  8004ac:	83 f8 25             	cmp    $0x25,%eax
+  8004af:	74 0c                	je     8004bd <vprintfmt+0x45>
+			if (ch == '\0')
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	75 db                	jne    800490 <vprintfmt+0x18>
+}
+  8004b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b8:	5b                   	pop    %ebx
+  8004b9:	5e                   	pop    %esi
+  8004ba:	5f                   	pop    %edi
+  8004bb:	5d                   	pop    %ebp
+  8004bc:	c3                   	ret
+		padc = ' ';
+  8004bd:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8004c1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004cf:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004db:	8d 73 01             	lea    0x1(%ebx),%esi
+  8004de:	0f b6 13             	movzbl (%ebx),%edx
+  8004e1:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004e4:	3c 55                	cmp    $0x55,%al
+  8004e6:	0f 87 2c 04 00 00    	ja     800918 <vprintfmt+0x4a0>
+  8004ec:	0f b6 c0             	movzbl %al,%eax
+  8004ef:	ff 24 85 80 38 80 00 	jmp    *0x803880(,%eax,4)
+  8004f6:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8004f8:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8004fc:	eb dd                	jmp    8004db <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004fe:	89 f3                	mov    %esi,%ebx
+  800500:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800504:	eb d5                	jmp    8004db <vprintfmt+0x63>
+  800506:	0f b6 d2             	movzbl %dl,%edx
+  800509:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80050b:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800510:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800513:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800517:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80051a:	8d 72 d0             	lea    -0x30(%edx),%esi
+  80051d:	83 fe 09             	cmp    $0x9,%esi
+  800520:	0f 87 8a 00 00 00    	ja     8005b0 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800526:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800529:	eb e5                	jmp    800510 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80052b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052e:	8b 00                	mov    (%eax),%eax
+  800530:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800533:	8b 45 14             	mov    0x14(%ebp),%eax
+  800536:	8d 40 04             	lea    0x4(%eax),%eax
+  800539:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80053c:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  80053e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800542:	79 97                	jns    8004db <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800544:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800547:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80054a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800551:	eb 88                	jmp    8004db <vprintfmt+0x63>
+			if (width < 0)
+  800553:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800556:	85 db                	test   %ebx,%ebx
+  800558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055d:	0f 49 c3             	cmovns %ebx,%eax
+  800560:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800563:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800565:	e9 71 ff ff ff       	jmp    8004db <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80056a:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  80056c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800573:	e9 63 ff ff ff       	jmp    8004db <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800578:	8d 73 02             	lea    0x2(%ebx),%esi
+  80057b:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80057f:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800586:	3c 67                	cmp    $0x67,%al
+  800588:	0f 84 18 ff ff ff    	je     8004a6 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80058e:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800595:	3c 72                	cmp    $0x72,%al
+  800597:	0f 84 09 ff ff ff    	je     8004a6 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80059d:	3c 62                	cmp    $0x62,%al
+  80059f:	0f 94 c0             	sete   %al
+  8005a2:	0f b6 c0             	movzbl %al,%eax
+  8005a5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8005a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005ab:	e9 f6 fe ff ff       	jmp    8004a6 <vprintfmt+0x2e>
+  8005b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b3:	eb 89                	jmp    80053e <vprintfmt+0xc6>
+			lflag++;
+  8005b5:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b8:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005ba:	e9 1c ff ff ff       	jmp    8004db <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8d 58 04             	lea    0x4(%eax),%ebx
+  8005c5:	83 ec 08             	sub    $0x8,%esp
+  8005c8:	ff 75 0c             	push   0xc(%ebp)
+  8005cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8005ce:	c1 e0 08             	shl    $0x8,%eax
+  8005d1:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005d4:	0b 01                	or     (%ecx),%eax
+  8005d6:	50                   	push   %eax
+  8005d7:	ff d7                	call   *%edi
+			break;
+  8005d9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005dc:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8005df:	e9 c2 fe ff ff       	jmp    8004a6 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8005ea:	8b 10                	mov    (%eax),%edx
+  8005ec:	89 d0                	mov    %edx,%eax
+  8005ee:	f7 d8                	neg    %eax
+  8005f0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005f3:	83 f8 12             	cmp    $0x12,%eax
+  8005f6:	7f 25                	jg     80061d <vprintfmt+0x1a5>
+  8005f8:	8b 14 85 e0 39 80 00 	mov    0x8039e0(,%eax,4),%edx
+  8005ff:	85 d2                	test   %edx,%edx
+  800601:	74 1a                	je     80061d <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800603:	52                   	push   %edx
+  800604:	68 22 3b 80 00       	push   $0x803b22
+  800609:	ff 75 0c             	push   0xc(%ebp)
+  80060c:	57                   	push   %edi
+  80060d:	e8 49 fe ff ff       	call   80045b <printfmt>
+  800612:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800615:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800618:	e9 89 fe ff ff       	jmp    8004a6 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  80061d:	50                   	push   %eax
+  80061e:	68 5b 37 80 00       	push   $0x80375b
+  800623:	ff 75 0c             	push   0xc(%ebp)
+  800626:	57                   	push   %edi
+  800627:	e8 2f fe ff ff       	call   80045b <printfmt>
+  80062c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80062f:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800632:	e9 6f fe ff ff       	jmp    8004a6 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800637:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063a:	83 c0 04             	add    $0x4,%eax
+  80063d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800640:	8b 45 14             	mov    0x14(%ebp),%eax
+  800643:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800645:	85 c9                	test   %ecx,%ecx
+  800647:	b8 54 37 80 00       	mov    $0x803754,%eax
+  80064c:	0f 45 c1             	cmovne %ecx,%eax
+  80064f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800652:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800656:	7e 06                	jle    80065e <vprintfmt+0x1e6>
+  800658:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  80065c:	75 1a                	jne    800678 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  80065e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800661:	c1 e0 08             	shl    $0x8,%eax
+  800664:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800667:	83 c8 3f             	or     $0x3f,%eax
+  80066a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80066d:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800670:	89 75 10             	mov    %esi,0x10(%ebp)
+  800673:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800676:	eb 6d                	jmp    8006e5 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800678:	83 ec 08             	sub    $0x8,%esp
+  80067b:	ff 75 d0             	push   -0x30(%ebp)
+  80067e:	ff 75 c8             	push   -0x38(%ebp)
+  800681:	e8 39 03 00 00       	call   8009bf <strnlen>
+  800686:	89 c2                	mov    %eax,%edx
+  800688:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80068b:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80068d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800690:	c1 e1 08             	shl    $0x8,%ecx
+  800693:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800697:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800699:	83 c4 10             	add    $0x10,%esp
+  80069c:	89 c3                	mov    %eax,%ebx
+  80069e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006a1:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006a4:	89 ce                	mov    %ecx,%esi
+  8006a6:	eb 0f                	jmp    8006b7 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8006a8:	83 ec 08             	sub    $0x8,%esp
+  8006ab:	ff 75 0c             	push   0xc(%ebp)
+  8006ae:	56                   	push   %esi
+  8006af:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006b1:	83 eb 01             	sub    $0x1,%ebx
+  8006b4:	83 c4 10             	add    $0x10,%esp
+  8006b7:	85 db                	test   %ebx,%ebx
+  8006b9:	7f ed                	jg     8006a8 <vprintfmt+0x230>
+  8006bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006be:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006c1:	85 c0                	test   %eax,%eax
+  8006c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006c8:	0f 49 d0             	cmovns %eax,%edx
+  8006cb:	29 d0                	sub    %edx,%eax
+  8006cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006d0:	eb 8c                	jmp    80065e <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8006d2:	83 ec 08             	sub    $0x8,%esp
+  8006d5:	ff 75 0c             	push   0xc(%ebp)
+  8006d8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006db:	09 c2                	or     %eax,%edx
+  8006dd:	52                   	push   %edx
+  8006de:	ff d7                	call   *%edi
+  8006e0:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006e3:	89 d9                	mov    %ebx,%ecx
+  8006e5:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8006e8:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8006ec:	0f be d0             	movsbl %al,%edx
+  8006ef:	85 d2                	test   %edx,%edx
+  8006f1:	74 2a                	je     80071d <vprintfmt+0x2a5>
+  8006f3:	85 f6                	test   %esi,%esi
+  8006f5:	78 05                	js     8006fc <vprintfmt+0x284>
+  8006f7:	83 ee 01             	sub    $0x1,%esi
+  8006fa:	78 3b                	js     800737 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006fc:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800700:	74 d0                	je     8006d2 <vprintfmt+0x25a>
+  800702:	0f be c0             	movsbl %al,%eax
+  800705:	83 e8 20             	sub    $0x20,%eax
+  800708:	83 f8 5e             	cmp    $0x5e,%eax
+  80070b:	76 c5                	jbe    8006d2 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80070d:	83 ec 08             	sub    $0x8,%esp
+  800710:	ff 75 0c             	push   0xc(%ebp)
+  800713:	ff 75 cc             	push   -0x34(%ebp)
+  800716:	ff d7                	call   *%edi
+  800718:	83 c4 10             	add    $0x10,%esp
+  80071b:	eb c6                	jmp    8006e3 <vprintfmt+0x26b>
+  80071d:	8b 75 10             	mov    0x10(%ebp),%esi
+  800720:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800723:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800726:	01 c3                	add    %eax,%ebx
+  800728:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80072a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80072d:	83 c8 20             	or     $0x20,%eax
+  800730:	89 75 10             	mov    %esi,0x10(%ebp)
+  800733:	89 c6                	mov    %eax,%esi
+  800735:	eb 14                	jmp    80074b <vprintfmt+0x2d3>
+  800737:	8b 75 10             	mov    0x10(%ebp),%esi
+  80073a:	eb e4                	jmp    800720 <vprintfmt+0x2a8>
+  80073c:	83 ec 08             	sub    $0x8,%esp
+  80073f:	ff 75 0c             	push   0xc(%ebp)
+  800742:	56                   	push   %esi
+  800743:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800745:	83 eb 01             	sub    $0x1,%ebx
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	85 db                	test   %ebx,%ebx
+  80074d:	7f ed                	jg     80073c <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80074f:	8b 75 10             	mov    0x10(%ebp),%esi
+  800752:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800755:	89 45 14             	mov    %eax,0x14(%ebp)
+  800758:	e9 49 fd ff ff       	jmp    8004a6 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80075d:	83 f9 01             	cmp    $0x1,%ecx
+  800760:	7f 1f                	jg     800781 <vprintfmt+0x309>
+	else if (lflag)
+  800762:	85 c9                	test   %ecx,%ecx
+  800764:	74 69                	je     8007cf <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800766:	8b 45 14             	mov    0x14(%ebp),%eax
+  800769:	8b 00                	mov    (%eax),%eax
+  80076b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80076e:	89 c1                	mov    %eax,%ecx
+  800770:	c1 f9 1f             	sar    $0x1f,%ecx
+  800773:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800776:	8b 45 14             	mov    0x14(%ebp),%eax
+  800779:	8d 40 04             	lea    0x4(%eax),%eax
+  80077c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80077f:	eb 17                	jmp    800798 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800781:	8b 45 14             	mov    0x14(%ebp),%eax
+  800784:	8b 50 04             	mov    0x4(%eax),%edx
+  800787:	8b 00                	mov    (%eax),%eax
+  800789:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80078c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8d 40 08             	lea    0x8(%eax),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800798:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80079b:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80079e:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8007a3:	85 db                	test   %ebx,%ebx
+  8007a5:	0f 89 f6 00 00 00    	jns    8008a1 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8007ab:	83 ec 08             	sub    $0x8,%esp
+  8007ae:	ff 75 0c             	push   0xc(%ebp)
+  8007b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007b4:	c1 e0 08             	shl    $0x8,%eax
+  8007b7:	83 c8 2d             	or     $0x2d,%eax
+  8007ba:	50                   	push   %eax
+  8007bb:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8007bd:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007c0:	f7 d9                	neg    %ecx
+  8007c2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8007ca:	e9 d2 00 00 00       	jmp    8008a1 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8007cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d2:	8b 00                	mov    (%eax),%eax
+  8007d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007d7:	89 c1                	mov    %eax,%ecx
+  8007d9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007dc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e8:	eb ae                	jmp    800798 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8007ea:	83 f9 01             	cmp    $0x1,%ecx
+  8007ed:	7f 19                	jg     800808 <vprintfmt+0x390>
+	else if (lflag)
+  8007ef:	85 c9                	test   %ecx,%ecx
+  8007f1:	74 2a                	je     80081d <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8b 08                	mov    (%eax),%ecx
+  8007f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800803:	e9 99 00 00 00       	jmp    8008a1 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800808:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080b:	8b 08                	mov    (%eax),%ecx
+  80080d:	8d 40 08             	lea    0x8(%eax),%eax
+  800810:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800813:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800818:	e9 84 00 00 00       	jmp    8008a1 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80081d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800820:	8b 08                	mov    (%eax),%ecx
+  800822:	8d 40 04             	lea    0x4(%eax),%eax
+  800825:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800828:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  80082d:	eb 72                	jmp    8008a1 <vprintfmt+0x429>
+	if (lflag >= 2)
+  80082f:	83 f9 01             	cmp    $0x1,%ecx
+  800832:	7f 16                	jg     80084a <vprintfmt+0x3d2>
+	else if (lflag)
+  800834:	85 c9                	test   %ecx,%ecx
+  800836:	74 24                	je     80085c <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	8b 08                	mov    (%eax),%ecx
+  80083d:	8d 40 04             	lea    0x4(%eax),%eax
+  800840:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800843:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800848:	eb 57                	jmp    8008a1 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80084a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084d:	8b 08                	mov    (%eax),%ecx
+  80084f:	8d 40 08             	lea    0x8(%eax),%eax
+  800852:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800855:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80085a:	eb 45                	jmp    8008a1 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80085c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085f:	8b 08                	mov    (%eax),%ecx
+  800861:	8d 40 04             	lea    0x4(%eax),%eax
+  800864:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800867:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  80086c:	eb 33                	jmp    8008a1 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  80086e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800871:	c1 e3 08             	shl    $0x8,%ebx
+  800874:	83 ec 08             	sub    $0x8,%esp
+  800877:	ff 75 0c             	push   0xc(%ebp)
+  80087a:	89 d8                	mov    %ebx,%eax
+  80087c:	83 c8 30             	or     $0x30,%eax
+  80087f:	50                   	push   %eax
+  800880:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800882:	83 c4 08             	add    $0x8,%esp
+  800885:	ff 75 0c             	push   0xc(%ebp)
+  800888:	83 cb 78             	or     $0x78,%ebx
+  80088b:	53                   	push   %ebx
+  80088c:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80088e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800891:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800893:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800896:	8d 40 04             	lea    0x4(%eax),%eax
+  800899:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80089c:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8008a1:	ff 75 e4             	push   -0x1c(%ebp)
+  8008a4:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8008a8:	52                   	push   %edx
+  8008a9:	ff 75 e0             	push   -0x20(%ebp)
+  8008ac:	50                   	push   %eax
+  8008ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008b0:	89 f8                	mov    %edi,%eax
+  8008b2:	e8 f7 fa ff ff       	call   8003ae <printnum>
+			break;
+  8008b7:	83 c4 10             	add    $0x10,%esp
+  8008ba:	e9 e7 fb ff ff       	jmp    8004a6 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008bf:	83 f9 01             	cmp    $0x1,%ecx
+  8008c2:	7f 16                	jg     8008da <vprintfmt+0x462>
+	else if (lflag)
+  8008c4:	85 c9                	test   %ecx,%ecx
+  8008c6:	74 24                	je     8008ec <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8008c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cb:	8b 08                	mov    (%eax),%ecx
+  8008cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008d3:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8008d8:	eb c7                	jmp    8008a1 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8008da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008dd:	8b 08                	mov    (%eax),%ecx
+  8008df:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008e5:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8008ea:	eb b5                	jmp    8008a1 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8008ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ef:	8b 08                	mov    (%eax),%ecx
+  8008f1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f7:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8008fc:	eb a3                	jmp    8008a1 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8008fe:	83 ec 08             	sub    $0x8,%esp
+  800901:	ff 75 0c             	push   0xc(%ebp)
+  800904:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800907:	c1 e0 08             	shl    $0x8,%eax
+  80090a:	83 c8 25             	or     $0x25,%eax
+  80090d:	50                   	push   %eax
+  80090e:	ff d7                	call   *%edi
+			break;
+  800910:	83 c4 10             	add    $0x10,%esp
+  800913:	e9 8e fb ff ff       	jmp    8004a6 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800918:	83 ec 08             	sub    $0x8,%esp
+  80091b:	ff 75 0c             	push   0xc(%ebp)
+  80091e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800921:	c1 e0 08             	shl    $0x8,%eax
+  800924:	83 c8 25             	or     $0x25,%eax
+  800927:	50                   	push   %eax
+  800928:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80092a:	83 c4 10             	add    $0x10,%esp
+  80092d:	89 de                	mov    %ebx,%esi
+  80092f:	eb 03                	jmp    800934 <vprintfmt+0x4bc>
+  800931:	83 ee 01             	sub    $0x1,%esi
+  800934:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800938:	75 f7                	jne    800931 <vprintfmt+0x4b9>
+  80093a:	e9 67 fb ff ff       	jmp    8004a6 <vprintfmt+0x2e>
+
+0080093f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80093f:	55                   	push   %ebp
+  800940:	89 e5                	mov    %esp,%ebp
+  800942:	83 ec 18             	sub    $0x18,%esp
+  800945:	8b 45 08             	mov    0x8(%ebp),%eax
+  800948:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80094b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80094e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800952:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800955:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80095c:	85 c0                	test   %eax,%eax
+  80095e:	74 26                	je     800986 <vsnprintf+0x47>
+  800960:	85 d2                	test   %edx,%edx
+  800962:	7e 22                	jle    800986 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800964:	ff 75 14             	push   0x14(%ebp)
+  800967:	ff 75 10             	push   0x10(%ebp)
+  80096a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80096d:	50                   	push   %eax
+  80096e:	68 3e 04 80 00       	push   $0x80043e
+  800973:	e8 00 fb ff ff       	call   800478 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800978:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80097b:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80097e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800981:	83 c4 10             	add    $0x10,%esp
+}
+  800984:	c9                   	leave
+  800985:	c3                   	ret
+		return -E_INVAL;
+  800986:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80098b:	eb f7                	jmp    800984 <vsnprintf+0x45>
+
+0080098d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80098d:	55                   	push   %ebp
+  80098e:	89 e5                	mov    %esp,%ebp
+  800990:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800993:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800996:	50                   	push   %eax
+  800997:	ff 75 10             	push   0x10(%ebp)
+  80099a:	ff 75 0c             	push   0xc(%ebp)
+  80099d:	ff 75 08             	push   0x8(%ebp)
+  8009a0:	e8 9a ff ff ff       	call   80093f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009a5:	c9                   	leave
+  8009a6:	c3                   	ret
+
+008009a7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b2:	eb 03                	jmp    8009b7 <strlen+0x10>
+		n++;
+  8009b4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009b7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009bb:	75 f7                	jne    8009b4 <strlen+0xd>
+	return n;
+}
+  8009bd:	5d                   	pop    %ebp
+  8009be:	c3                   	ret
+
+008009bf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009bf:	55                   	push   %ebp
+  8009c0:	89 e5                	mov    %esp,%ebp
+  8009c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cd:	eb 03                	jmp    8009d2 <strnlen+0x13>
+		n++;
+  8009cf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009d2:	39 d0                	cmp    %edx,%eax
+  8009d4:	74 08                	je     8009de <strnlen+0x1f>
+  8009d6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009da:	75 f3                	jne    8009cf <strnlen+0x10>
+  8009dc:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009de:	89 d0                	mov    %edx,%eax
+  8009e0:	5d                   	pop    %ebp
+  8009e1:	c3                   	ret
+
+008009e2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009e2:	55                   	push   %ebp
+  8009e3:	89 e5                	mov    %esp,%ebp
+  8009e5:	53                   	push   %ebx
+  8009e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009f5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009f8:	83 c0 01             	add    $0x1,%eax
+  8009fb:	84 d2                	test   %dl,%dl
+  8009fd:	75 f2                	jne    8009f1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009ff:	89 c8                	mov    %ecx,%eax
+  800a01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a04:	c9                   	leave
+  800a05:	c3                   	ret
+
+00800a06 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a06:	55                   	push   %ebp
+  800a07:	89 e5                	mov    %esp,%ebp
+  800a09:	53                   	push   %ebx
+  800a0a:	83 ec 10             	sub    $0x10,%esp
+  800a0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a10:	53                   	push   %ebx
+  800a11:	e8 91 ff ff ff       	call   8009a7 <strlen>
+  800a16:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a19:	ff 75 0c             	push   0xc(%ebp)
+  800a1c:	01 d8                	add    %ebx,%eax
+  800a1e:	50                   	push   %eax
+  800a1f:	e8 be ff ff ff       	call   8009e2 <strcpy>
+	return dst;
+}
+  800a24:	89 d8                	mov    %ebx,%eax
+  800a26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+
+00800a2b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	56                   	push   %esi
+  800a2f:	53                   	push   %ebx
+  800a30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a33:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a36:	89 f3                	mov    %esi,%ebx
+  800a38:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a3b:	89 f0                	mov    %esi,%eax
+  800a3d:	eb 0f                	jmp    800a4e <strncpy+0x23>
+		*dst++ = *src;
+  800a3f:	83 c0 01             	add    $0x1,%eax
+  800a42:	0f b6 0a             	movzbl (%edx),%ecx
+  800a45:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a48:	80 f9 01             	cmp    $0x1,%cl
+  800a4b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a4e:	39 d8                	cmp    %ebx,%eax
+  800a50:	75 ed                	jne    800a3f <strncpy+0x14>
+	}
+	return ret;
+}
+  800a52:	89 f0                	mov    %esi,%eax
+  800a54:	5b                   	pop    %ebx
+  800a55:	5e                   	pop    %esi
+  800a56:	5d                   	pop    %ebp
+  800a57:	c3                   	ret
+
+00800a58 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	56                   	push   %esi
+  800a5c:	53                   	push   %ebx
+  800a5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a63:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a66:	89 f0                	mov    %esi,%eax
+  800a68:	85 d2                	test   %edx,%edx
+  800a6a:	74 21                	je     800a8d <strlcpy+0x35>
+  800a6c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a70:	89 f2                	mov    %esi,%edx
+  800a72:	eb 09                	jmp    800a7d <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a74:	83 c1 01             	add    $0x1,%ecx
+  800a77:	83 c2 01             	add    $0x1,%edx
+  800a7a:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a7d:	39 c2                	cmp    %eax,%edx
+  800a7f:	74 09                	je     800a8a <strlcpy+0x32>
+  800a81:	0f b6 19             	movzbl (%ecx),%ebx
+  800a84:	84 db                	test   %bl,%bl
+  800a86:	75 ec                	jne    800a74 <strlcpy+0x1c>
+  800a88:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a8a:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a8d:	29 f0                	sub    %esi,%eax
+}
+  800a8f:	5b                   	pop    %ebx
+  800a90:	5e                   	pop    %esi
+  800a91:	5d                   	pop    %ebp
+  800a92:	c3                   	ret
+
+00800a93 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a93:	55                   	push   %ebp
+  800a94:	89 e5                	mov    %esp,%ebp
+  800a96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a99:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a9c:	eb 06                	jmp    800aa4 <strcmp+0x11>
+		p++, q++;
+  800a9e:	83 c1 01             	add    $0x1,%ecx
+  800aa1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800aa4:	0f b6 01             	movzbl (%ecx),%eax
+  800aa7:	84 c0                	test   %al,%al
+  800aa9:	74 04                	je     800aaf <strcmp+0x1c>
+  800aab:	3a 02                	cmp    (%edx),%al
+  800aad:	74 ef                	je     800a9e <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800aaf:	0f b6 c0             	movzbl %al,%eax
+  800ab2:	0f b6 12             	movzbl (%edx),%edx
+  800ab5:	29 d0                	sub    %edx,%eax
+}
+  800ab7:	5d                   	pop    %ebp
+  800ab8:	c3                   	ret
+
+00800ab9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ab9:	55                   	push   %ebp
+  800aba:	89 e5                	mov    %esp,%ebp
+  800abc:	53                   	push   %ebx
+  800abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac3:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800ac6:	eb 09                	jmp    800ad1 <strncmp+0x18>
+		n--, p++, q++;
+  800ac8:	83 ea 01             	sub    $0x1,%edx
+  800acb:	83 c0 01             	add    $0x1,%eax
+  800ace:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ad1:	85 d2                	test   %edx,%edx
+  800ad3:	74 18                	je     800aed <strncmp+0x34>
+  800ad5:	0f b6 18             	movzbl (%eax),%ebx
+  800ad8:	84 db                	test   %bl,%bl
+  800ada:	74 04                	je     800ae0 <strncmp+0x27>
+  800adc:	3a 19                	cmp    (%ecx),%bl
+  800ade:	74 e8                	je     800ac8 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ae0:	0f b6 00             	movzbl (%eax),%eax
+  800ae3:	0f b6 11             	movzbl (%ecx),%edx
+  800ae6:	29 d0                	sub    %edx,%eax
+}
+  800ae8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aeb:	c9                   	leave
+  800aec:	c3                   	ret
+		return 0;
+  800aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af2:	eb f4                	jmp    800ae8 <strncmp+0x2f>
+
+00800af4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800af4:	55                   	push   %ebp
+  800af5:	89 e5                	mov    %esp,%ebp
+  800af7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800afe:	eb 03                	jmp    800b03 <strchr+0xf>
+  800b00:	83 c0 01             	add    $0x1,%eax
+  800b03:	0f b6 10             	movzbl (%eax),%edx
+  800b06:	84 d2                	test   %dl,%dl
+  800b08:	74 06                	je     800b10 <strchr+0x1c>
+		if (*s == c)
+  800b0a:	38 ca                	cmp    %cl,%dl
+  800b0c:	75 f2                	jne    800b00 <strchr+0xc>
+  800b0e:	eb 05                	jmp    800b15 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b15:	5d                   	pop    %ebp
+  800b16:	c3                   	ret
+
+00800b17 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b21:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b24:	38 ca                	cmp    %cl,%dl
+  800b26:	74 09                	je     800b31 <strfind+0x1a>
+  800b28:	84 d2                	test   %dl,%dl
+  800b2a:	74 05                	je     800b31 <strfind+0x1a>
+	for (; *s; s++)
+  800b2c:	83 c0 01             	add    $0x1,%eax
+  800b2f:	eb f0                	jmp    800b21 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b31:	5d                   	pop    %ebp
+  800b32:	c3                   	ret
+
+00800b33 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	57                   	push   %edi
+  800b37:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b3a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b3d:	85 c9                	test   %ecx,%ecx
+  800b3f:	74 20                	je     800b61 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b41:	89 f8                	mov    %edi,%eax
+  800b43:	09 c8                	or     %ecx,%eax
+  800b45:	a8 03                	test   $0x3,%al
+  800b47:	75 12                	jne    800b5b <memset+0x28>
+		c &= 0xFF;
+  800b49:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b4d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b53:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b56:	fc                   	cld
+  800b57:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b59:	eb 06                	jmp    800b61 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b5e:	fc                   	cld
+  800b5f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b61:	89 f8                	mov    %edi,%eax
+  800b63:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b66:	c9                   	leave
+  800b67:	c3                   	ret
+
+00800b68 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b68:	55                   	push   %ebp
+  800b69:	89 e5                	mov    %esp,%ebp
+  800b6b:	57                   	push   %edi
+  800b6c:	56                   	push   %esi
+  800b6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b70:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b73:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b76:	39 c6                	cmp    %eax,%esi
+  800b78:	73 32                	jae    800bac <memmove+0x44>
+  800b7a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b7d:	39 d0                	cmp    %edx,%eax
+  800b7f:	73 2b                	jae    800bac <memmove+0x44>
+		s += n;
+		d += n;
+  800b81:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b84:	89 d6                	mov    %edx,%esi
+  800b86:	09 fe                	or     %edi,%esi
+  800b88:	09 ce                	or     %ecx,%esi
+  800b8a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b90:	75 0e                	jne    800ba0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b92:	83 ef 04             	sub    $0x4,%edi
+  800b95:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b98:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b9b:	fd                   	std
+  800b9c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b9e:	eb 09                	jmp    800ba9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ba0:	83 ef 01             	sub    $0x1,%edi
+  800ba3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ba6:	fd                   	std
+  800ba7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ba9:	fc                   	cld
+  800baa:	eb 1a                	jmp    800bc6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bac:	89 f2                	mov    %esi,%edx
+  800bae:	09 c2                	or     %eax,%edx
+  800bb0:	09 ca                	or     %ecx,%edx
+  800bb2:	f6 c2 03             	test   $0x3,%dl
+  800bb5:	75 0a                	jne    800bc1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bb7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bba:	89 c7                	mov    %eax,%edi
+  800bbc:	fc                   	cld
+  800bbd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bbf:	eb 05                	jmp    800bc6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bc1:	89 c7                	mov    %eax,%edi
+  800bc3:	fc                   	cld
+  800bc4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bc6:	5e                   	pop    %esi
+  800bc7:	5f                   	pop    %edi
+  800bc8:	5d                   	pop    %ebp
+  800bc9:	c3                   	ret
+
+00800bca <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bca:	55                   	push   %ebp
+  800bcb:	89 e5                	mov    %esp,%ebp
+  800bcd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bd0:	ff 75 10             	push   0x10(%ebp)
+  800bd3:	ff 75 0c             	push   0xc(%ebp)
+  800bd6:	ff 75 08             	push   0x8(%ebp)
+  800bd9:	e8 8a ff ff ff       	call   800b68 <memmove>
+}
+  800bde:	c9                   	leave
+  800bdf:	c3                   	ret
+
+00800be0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	56                   	push   %esi
+  800be4:	53                   	push   %ebx
+  800be5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800beb:	89 c6                	mov    %eax,%esi
+  800bed:	03 75 10             	add    0x10(%ebp),%esi
+  800bf0:	eb 06                	jmp    800bf8 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bf2:	83 c0 01             	add    $0x1,%eax
+  800bf5:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bf8:	39 f0                	cmp    %esi,%eax
+  800bfa:	74 14                	je     800c10 <memcmp+0x30>
+		if (*s1 != *s2)
+  800bfc:	0f b6 08             	movzbl (%eax),%ecx
+  800bff:	0f b6 1a             	movzbl (%edx),%ebx
+  800c02:	38 d9                	cmp    %bl,%cl
+  800c04:	74 ec                	je     800bf2 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c06:	0f b6 c1             	movzbl %cl,%eax
+  800c09:	0f b6 db             	movzbl %bl,%ebx
+  800c0c:	29 d8                	sub    %ebx,%eax
+  800c0e:	eb 05                	jmp    800c15 <memcmp+0x35>
+	}
+
+	return 0;
+  800c10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c15:	5b                   	pop    %ebx
+  800c16:	5e                   	pop    %esi
+  800c17:	5d                   	pop    %ebp
+  800c18:	c3                   	ret
+
+00800c19 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c19:	55                   	push   %ebp
+  800c1a:	89 e5                	mov    %esp,%ebp
+  800c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c22:	89 c2                	mov    %eax,%edx
+  800c24:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c27:	eb 03                	jmp    800c2c <memfind+0x13>
+  800c29:	83 c0 01             	add    $0x1,%eax
+  800c2c:	39 d0                	cmp    %edx,%eax
+  800c2e:	73 04                	jae    800c34 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c30:	38 08                	cmp    %cl,(%eax)
+  800c32:	75 f5                	jne    800c29 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c34:	5d                   	pop    %ebp
+  800c35:	c3                   	ret
+
+00800c36 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	57                   	push   %edi
+  800c3a:	56                   	push   %esi
+  800c3b:	53                   	push   %ebx
+  800c3c:	83 ec 1c             	sub    $0x1c,%esp
+  800c3f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c42:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c45:	eb 03                	jmp    800c4a <strtol+0x14>
+		s++;
+  800c47:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c4a:	0f b6 06             	movzbl (%esi),%eax
+  800c4d:	3c 20                	cmp    $0x20,%al
+  800c4f:	74 f6                	je     800c47 <strtol+0x11>
+  800c51:	3c 09                	cmp    $0x9,%al
+  800c53:	74 f2                	je     800c47 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c55:	3c 2b                	cmp    $0x2b,%al
+  800c57:	74 43                	je     800c9c <strtol+0x66>
+	int neg = 0;
+  800c59:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c5e:	3c 2d                	cmp    $0x2d,%al
+  800c60:	74 44                	je     800ca6 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c62:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c68:	75 0f                	jne    800c79 <strtol+0x43>
+  800c6a:	80 3e 30             	cmpb   $0x30,(%esi)
+  800c6d:	74 41                	je     800cb0 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c6f:	85 ff                	test   %edi,%edi
+  800c71:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c76:	0f 44 f8             	cmove  %eax,%edi
+  800c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800c83:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800c86:	89 fb                	mov    %edi,%ebx
+  800c88:	c1 fb 1f             	sar    $0x1f,%ebx
+  800c8b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800c8e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800c91:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c94:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800c97:	89 75 08             	mov    %esi,0x8(%ebp)
+  800c9a:	eb 67                	jmp    800d03 <strtol+0xcd>
+		s++;
+  800c9c:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800c9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca4:	eb bc                	jmp    800c62 <strtol+0x2c>
+		s++, neg = 1;
+  800ca6:	83 c6 01             	add    $0x1,%esi
+  800ca9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800cae:	eb b2                	jmp    800c62 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb0:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800cb4:	74 0e                	je     800cc4 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800cb6:	85 ff                	test   %edi,%edi
+  800cb8:	75 bf                	jne    800c79 <strtol+0x43>
+		s++, base = 8;
+  800cba:	83 c6 01             	add    $0x1,%esi
+  800cbd:	bf 08 00 00 00       	mov    $0x8,%edi
+  800cc2:	eb b5                	jmp    800c79 <strtol+0x43>
+		s += 2, base = 16;
+  800cc4:	83 c6 02             	add    $0x2,%esi
+  800cc7:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ccc:	eb ab                	jmp    800c79 <strtol+0x43>
+			dig = *s - '0';
+  800cce:	0f be c9             	movsbl %cl,%ecx
+  800cd1:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800cd4:	39 f9                	cmp    %edi,%ecx
+  800cd6:	7d 59                	jge    800d31 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800cd8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800cdc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cdf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800ce2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800ce5:	0f af d8             	imul   %eax,%ebx
+  800ce8:	0f af d7             	imul   %edi,%edx
+  800ceb:	01 d3                	add    %edx,%ebx
+  800ced:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800cf0:	f7 e7                	mul    %edi
+  800cf2:	01 da                	add    %ebx,%edx
+  800cf4:	89 cb                	mov    %ecx,%ebx
+  800cf6:	c1 fb 1f             	sar    $0x1f,%ebx
+  800cf9:	01 c8                	add    %ecx,%eax
+  800cfb:	11 da                	adc    %ebx,%edx
+  800cfd:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d00:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800d03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d06:	0f b6 08             	movzbl (%eax),%ecx
+  800d09:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800d0c:	80 fb 09             	cmp    $0x9,%bl
+  800d0f:	76 bd                	jbe    800cce <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800d11:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800d14:	80 fb 19             	cmp    $0x19,%bl
+  800d17:	77 08                	ja     800d21 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800d19:	0f be c9             	movsbl %cl,%ecx
+  800d1c:	83 e9 57             	sub    $0x57,%ecx
+  800d1f:	eb b3                	jmp    800cd4 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d21:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800d24:	80 fb 19             	cmp    $0x19,%bl
+  800d27:	77 08                	ja     800d31 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800d29:	0f be c9             	movsbl %cl,%ecx
+  800d2c:	83 e9 37             	sub    $0x37,%ecx
+  800d2f:	eb a3                	jmp    800cd4 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d31:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d34:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d37:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d3d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d41:	74 05                	je     800d48 <strtol+0x112>
+		*endptr = (char *) s;
+  800d43:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d46:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d48:	85 c9                	test   %ecx,%ecx
+  800d4a:	74 07                	je     800d53 <strtol+0x11d>
+  800d4c:	f7 d8                	neg    %eax
+  800d4e:	83 d2 00             	adc    $0x0,%edx
+  800d51:	f7 da                	neg    %edx
+}
+  800d53:	83 c4 1c             	add    $0x1c,%esp
+  800d56:	5b                   	pop    %ebx
+  800d57:	5e                   	pop    %esi
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+
+00800d5b <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d61:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d68:	74 18                	je     800d82 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d75:	89 c3                	mov    %eax,%ebx
+  800d77:	89 c7                	mov    %eax,%edi
+  800d79:	89 c6                	mov    %eax,%esi
+  800d7b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d7d:	5b                   	pop    %ebx
+  800d7e:	5e                   	pop    %esi
+  800d7f:	5f                   	pop    %edi
+  800d80:	5d                   	pop    %ebp
+  800d81:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8d:	89 c3                	mov    %eax,%ebx
+  800d8f:	89 c7                	mov    %eax,%edi
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	8d 35 9c 0d 80 00    	lea    0x800d9c,%esi
+  800d9a:	0f 34                	sysenter
+  800d9c:	5d                   	pop    %ebp
+		goto out;
+  800d9d:	eb de                	jmp    800d7d <sys_cputs+0x22>
+
+00800d9f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800da5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dac:	74 19                	je     800dc7 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800dae:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db8:	89 d1                	mov    %edx,%ecx
+  800dba:	89 d3                	mov    %edx,%ebx
+  800dbc:	89 d7                	mov    %edx,%edi
+  800dbe:	89 d6                	mov    %edx,%esi
+  800dc0:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dc2:	5b                   	pop    %ebx
+  800dc3:	5e                   	pop    %esi
+  800dc4:	5f                   	pop    %edi
+  800dc5:	5d                   	pop    %ebp
+  800dc6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd1:	89 d1                	mov    %edx,%ecx
+  800dd3:	89 d3                	mov    %edx,%ebx
+  800dd5:	89 d7                	mov    %edx,%edi
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	8d 35 e2 0d 80 00    	lea    0x800de2,%esi
+  800de0:	0f 34                	sysenter
+  800de2:	5d                   	pop    %ebp
+		goto out;
+  800de3:	eb dd                	jmp    800dc2 <sys_cgetc+0x23>
+
+00800de5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dee:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800df5:	74 21                	je     800e18 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800df7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dfc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e04:	89 cb                	mov    %ecx,%ebx
+  800e06:	89 cf                	mov    %ecx,%edi
+  800e08:	89 ce                	mov    %ecx,%esi
+  800e0a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0c:	85 c0                	test   %eax,%eax
+  800e0e:	7f 27                	jg     800e37 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e20:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e25:	89 cb                	mov    %ecx,%ebx
+  800e27:	89 cf                	mov    %ecx,%edi
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	8d 35 34 0e 80 00    	lea    0x800e34,%esi
+  800e32:	0f 34                	sysenter
+  800e34:	5d                   	pop    %ebp
+		goto out;
+  800e35:	eb d5                	jmp    800e0c <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+  800e3a:	50                   	push   %eax
+  800e3b:	6a 03                	push   $0x3
+  800e3d:	68 4b 3a 80 00       	push   $0x803a4b
+  800e42:	6a 3f                	push   $0x3f
+  800e44:	68 68 3a 80 00       	push   $0x803a68
+  800e49:	e8 71 f4 ff ff       	call   8002bf <_panic>
+
+00800e4e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e4e:	55                   	push   %ebp
+  800e4f:	89 e5                	mov    %esp,%ebp
+  800e51:	57                   	push   %edi
+  800e52:	56                   	push   %esi
+  800e53:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e54:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e5b:	74 19                	je     800e76 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e62:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e67:	89 d1                	mov    %edx,%ecx
+  800e69:	89 d3                	mov    %edx,%ebx
+  800e6b:	89 d7                	mov    %edx,%edi
+  800e6d:	89 d6                	mov    %edx,%esi
+  800e6f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e71:	5b                   	pop    %ebx
+  800e72:	5e                   	pop    %esi
+  800e73:	5f                   	pop    %edi
+  800e74:	5d                   	pop    %ebp
+  800e75:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e80:	89 d1                	mov    %edx,%ecx
+  800e82:	89 d3                	mov    %edx,%ebx
+  800e84:	89 d7                	mov    %edx,%edi
+  800e86:	55                   	push   %ebp
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	8d 35 91 0e 80 00    	lea    0x800e91,%esi
+  800e8f:	0f 34                	sysenter
+  800e91:	5d                   	pop    %ebp
+		goto out;
+  800e92:	eb dd                	jmp    800e71 <sys_getenvid+0x23>
+
+00800e94 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	57                   	push   %edi
+  800e98:	56                   	push   %esi
+  800e99:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e9a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ea1:	74 19                	je     800ebc <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800ea3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ead:	89 d1                	mov    %edx,%ecx
+  800eaf:	89 d3                	mov    %edx,%ebx
+  800eb1:	89 d7                	mov    %edx,%edi
+  800eb3:	89 d6                	mov    %edx,%esi
+  800eb5:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800eb7:	5b                   	pop    %ebx
+  800eb8:	5e                   	pop    %esi
+  800eb9:	5f                   	pop    %edi
+  800eba:	5d                   	pop    %ebp
+  800ebb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ebc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ec6:	89 d1                	mov    %edx,%ecx
+  800ec8:	89 d3                	mov    %edx,%ebx
+  800eca:	89 d7                	mov    %edx,%edi
+  800ecc:	55                   	push   %ebp
+  800ecd:	89 e5                	mov    %esp,%ebp
+  800ecf:	8d 35 d7 0e 80 00    	lea    0x800ed7,%esi
+  800ed5:	0f 34                	sysenter
+  800ed7:	5d                   	pop    %ebp
+		goto out;
+  800ed8:	eb dd                	jmp    800eb7 <sys_yield+0x23>
+
+00800eda <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ee3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800eea:	74 23                	je     800f0f <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800eec:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eff:	89 f7                	mov    %esi,%edi
+  800f01:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f03:	85 c0                	test   %eax,%eax
+  800f05:	7f 29                	jg     800f30 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f15:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	8d 35 2d 0f 80 00    	lea    0x800f2d,%esi
+  800f2b:	0f 34                	sysenter
+  800f2d:	5d                   	pop    %ebp
+		goto out;
+  800f2e:	eb d3                	jmp    800f03 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f30:	83 ec 0c             	sub    $0xc,%esp
+  800f33:	50                   	push   %eax
+  800f34:	6a 04                	push   $0x4
+  800f36:	68 4b 3a 80 00       	push   $0x803a4b
+  800f3b:	6a 3f                	push   $0x3f
+  800f3d:	68 68 3a 80 00       	push   $0x803a68
+  800f42:	e8 78 f3 ff ff       	call   8002bf <_panic>
+
+00800f47 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f47:	55                   	push   %ebp
+  800f48:	89 e5                	mov    %esp,%ebp
+  800f4a:	57                   	push   %edi
+  800f4b:	56                   	push   %esi
+  800f4c:	53                   	push   %ebx
+  800f4d:	83 ec 0c             	sub    $0xc,%esp
+  800f50:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f53:	85 f6                	test   %esi,%esi
+  800f55:	75 09                	jne    800f60 <sys_page_map+0x19>
+  800f57:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f5e:	74 1f                	je     800f7f <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f60:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f71:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f73:	85 c0                	test   %eax,%eax
+  800f75:	7f 27                	jg     800f9e <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7a:	5b                   	pop    %ebx
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f85:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f90:	55                   	push   %ebp
+  800f91:	89 e5                	mov    %esp,%ebp
+  800f93:	8d 35 9b 0f 80 00    	lea    0x800f9b,%esi
+  800f99:	0f 34                	sysenter
+  800f9b:	5d                   	pop    %ebp
+		goto out;
+  800f9c:	eb d5                	jmp    800f73 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  800fa1:	50                   	push   %eax
+  800fa2:	6a 05                	push   $0x5
+  800fa4:	68 4b 3a 80 00       	push   $0x803a4b
+  800fa9:	6a 3f                	push   $0x3f
+  800fab:	68 68 3a 80 00       	push   $0x803a68
+  800fb0:	e8 0a f3 ff ff       	call   8002bf <_panic>
+
+00800fb5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	57                   	push   %edi
+  800fb9:	56                   	push   %esi
+  800fba:	53                   	push   %ebx
+  800fbb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800fbe:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fc5:	74 22                	je     800fe9 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800fc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fcc:	b8 06 00 00 00       	mov    $0x6,%eax
+  800fd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd7:	89 df                	mov    %ebx,%edi
+  800fd9:	89 de                	mov    %ebx,%esi
+  800fdb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fdd:	85 c0                	test   %eax,%eax
+  800fdf:	7f 28                	jg     801009 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe4:	5b                   	pop    %ebx
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5f                   	pop    %edi
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fe9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff4:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ff9:	89 df                	mov    %ebx,%edi
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	8d 35 06 10 80 00    	lea    0x801006,%esi
+  801004:	0f 34                	sysenter
+  801006:	5d                   	pop    %ebp
+		goto out;
+  801007:	eb d4                	jmp    800fdd <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801009:	83 ec 0c             	sub    $0xc,%esp
+  80100c:	50                   	push   %eax
+  80100d:	6a 06                	push   $0x6
+  80100f:	68 4b 3a 80 00       	push   $0x803a4b
+  801014:	6a 3f                	push   $0x3f
+  801016:	68 68 3a 80 00       	push   $0x803a68
+  80101b:	e8 9f f2 ff ff       	call   8002bf <_panic>
+
+00801020 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	56                   	push   %esi
+  801025:	53                   	push   %ebx
+  801026:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801029:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801030:	74 22                	je     801054 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801032:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801037:	b8 08 00 00 00       	mov    $0x8,%eax
+  80103c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801042:	89 df                	mov    %ebx,%edi
+  801044:	89 de                	mov    %ebx,%esi
+  801046:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801048:	85 c0                	test   %eax,%eax
+  80104a:	7f 28                	jg     801074 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80104c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104f:	5b                   	pop    %ebx
+  801050:	5e                   	pop    %esi
+  801051:	5f                   	pop    %edi
+  801052:	5d                   	pop    %ebp
+  801053:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801054:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801059:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801064:	89 df                	mov    %ebx,%edi
+  801066:	55                   	push   %ebp
+  801067:	89 e5                	mov    %esp,%ebp
+  801069:	8d 35 71 10 80 00    	lea    0x801071,%esi
+  80106f:	0f 34                	sysenter
+  801071:	5d                   	pop    %ebp
+		goto out;
+  801072:	eb d4                	jmp    801048 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801074:	83 ec 0c             	sub    $0xc,%esp
+  801077:	50                   	push   %eax
+  801078:	6a 08                	push   $0x8
+  80107a:	68 4b 3a 80 00       	push   $0x803a4b
+  80107f:	6a 3f                	push   $0x3f
+  801081:	68 68 3a 80 00       	push   $0x803a68
+  801086:	e8 34 f2 ff ff       	call   8002bf <_panic>
+
+0080108b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	57                   	push   %edi
+  80108f:	56                   	push   %esi
+  801090:	53                   	push   %ebx
+  801091:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801094:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80109b:	74 22                	je     8010bf <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  80109d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ad:	89 df                	mov    %ebx,%edi
+  8010af:	89 de                	mov    %ebx,%esi
+  8010b1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b3:	85 c0                	test   %eax,%eax
+  8010b5:	7f 28                	jg     8010df <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ba:	5b                   	pop    %ebx
+  8010bb:	5e                   	pop    %esi
+  8010bc:	5f                   	pop    %edi
+  8010bd:	5d                   	pop    %ebp
+  8010be:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ca:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010cf:	89 df                	mov    %ebx,%edi
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	8d 35 dc 10 80 00    	lea    0x8010dc,%esi
+  8010da:	0f 34                	sysenter
+  8010dc:	5d                   	pop    %ebp
+		goto out;
+  8010dd:	eb d4                	jmp    8010b3 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010df:	83 ec 0c             	sub    $0xc,%esp
+  8010e2:	50                   	push   %eax
+  8010e3:	6a 09                	push   $0x9
+  8010e5:	68 4b 3a 80 00       	push   $0x803a4b
+  8010ea:	6a 3f                	push   $0x3f
+  8010ec:	68 68 3a 80 00       	push   $0x803a68
+  8010f1:	e8 c9 f1 ff ff       	call   8002bf <_panic>
+
+008010f6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010f6:	55                   	push   %ebp
+  8010f7:	89 e5                	mov    %esp,%ebp
+  8010f9:	57                   	push   %edi
+  8010fa:	56                   	push   %esi
+  8010fb:	53                   	push   %ebx
+  8010fc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010ff:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801106:	74 22                	je     80112a <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801108:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801112:	8b 55 08             	mov    0x8(%ebp),%edx
+  801115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801118:	89 df                	mov    %ebx,%edi
+  80111a:	89 de                	mov    %ebx,%esi
+  80111c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	7f 28                	jg     80114a <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801125:	5b                   	pop    %ebx
+  801126:	5e                   	pop    %esi
+  801127:	5f                   	pop    %edi
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80112a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801132:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801135:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80113a:	89 df                	mov    %ebx,%edi
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	8d 35 47 11 80 00    	lea    0x801147,%esi
+  801145:	0f 34                	sysenter
+  801147:	5d                   	pop    %ebp
+		goto out;
+  801148:	eb d4                	jmp    80111e <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114a:	83 ec 0c             	sub    $0xc,%esp
+  80114d:	50                   	push   %eax
+  80114e:	6a 0a                	push   $0xa
+  801150:	68 4b 3a 80 00       	push   $0x803a4b
+  801155:	6a 3f                	push   $0x3f
+  801157:	68 68 3a 80 00       	push   $0x803a68
+  80115c:	e8 5e f1 ff ff       	call   8002bf <_panic>
+
+00801161 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	57                   	push   %edi
+  801165:	56                   	push   %esi
+  801166:	53                   	push   %ebx
+  801167:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80116a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801171:	74 22                	je     801195 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801178:	b8 17 00 00 00       	mov    $0x17,%eax
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801183:	89 df                	mov    %ebx,%edi
+  801185:	89 de                	mov    %ebx,%esi
+  801187:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	7f 28                	jg     8011b5 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80118d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801190:	5b                   	pop    %ebx
+  801191:	5e                   	pop    %esi
+  801192:	5f                   	pop    %edi
+  801193:	5d                   	pop    %ebp
+  801194:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801195:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a0:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011a5:	89 df                	mov    %ebx,%edi
+  8011a7:	55                   	push   %ebp
+  8011a8:	89 e5                	mov    %esp,%ebp
+  8011aa:	8d 35 b2 11 80 00    	lea    0x8011b2,%esi
+  8011b0:	0f 34                	sysenter
+  8011b2:	5d                   	pop    %ebp
+		goto out;
+  8011b3:	eb d4                	jmp    801189 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b5:	83 ec 0c             	sub    $0xc,%esp
+  8011b8:	50                   	push   %eax
+  8011b9:	6a 17                	push   $0x17
+  8011bb:	68 4b 3a 80 00       	push   $0x803a4b
+  8011c0:	6a 3f                	push   $0x3f
+  8011c2:	68 68 3a 80 00       	push   $0x803a68
+  8011c7:	e8 f3 f0 ff ff       	call   8002bf <_panic>
+
+008011cc <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8011cc:	55                   	push   %ebp
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	57                   	push   %edi
+  8011d0:	56                   	push   %esi
+  8011d1:	53                   	push   %ebx
+  8011d2:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8011d5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011dc:	74 22                	je     801200 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8011de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e3:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ee:	89 df                	mov    %ebx,%edi
+  8011f0:	89 de                	mov    %ebx,%esi
+  8011f2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011f4:	85 c0                	test   %eax,%eax
+  8011f6:	7f 28                	jg     801220 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8011f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011fb:	5b                   	pop    %ebx
+  8011fc:	5e                   	pop    %esi
+  8011fd:	5f                   	pop    %edi
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801200:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801205:	8b 55 08             	mov    0x8(%ebp),%edx
+  801208:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801210:	89 df                	mov    %ebx,%edi
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	8d 35 1d 12 80 00    	lea    0x80121d,%esi
+  80121b:	0f 34                	sysenter
+  80121d:	5d                   	pop    %ebp
+		goto out;
+  80121e:	eb d4                	jmp    8011f4 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801220:	83 ec 0c             	sub    $0xc,%esp
+  801223:	50                   	push   %eax
+  801224:	6a 18                	push   $0x18
+  801226:	68 4b 3a 80 00       	push   $0x803a4b
+  80122b:	6a 3f                	push   $0x3f
+  80122d:	68 68 3a 80 00       	push   $0x803a68
+  801232:	e8 88 f0 ff ff       	call   8002bf <_panic>
+
+00801237 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	57                   	push   %edi
+  80123b:	56                   	push   %esi
+  80123c:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80123d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801244:	74 1d                	je     801263 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801246:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80124b:	be 00 00 00 00       	mov    $0x0,%esi
+  801250:	8b 55 08             	mov    0x8(%ebp),%edx
+  801253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801256:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801259:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80125c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80125e:	5b                   	pop    %ebx
+  80125f:	5e                   	pop    %esi
+  801260:	5f                   	pop    %edi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801269:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80126e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801271:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801274:	55                   	push   %ebp
+  801275:	89 e5                	mov    %esp,%ebp
+  801277:	8d 35 7f 12 80 00    	lea    0x80127f,%esi
+  80127d:	0f 34                	sysenter
+  80127f:	5d                   	pop    %ebp
+		goto out;
+  801280:	eb dc                	jmp    80125e <sys_ipc_try_send+0x27>
+
+00801282 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	57                   	push   %edi
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80128b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801292:	74 21                	je     8012b5 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801294:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801299:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80129e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a1:	89 cb                	mov    %ecx,%ebx
+  8012a3:	89 cf                	mov    %ecx,%edi
+  8012a5:	89 ce                	mov    %ecx,%esi
+  8012a7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012a9:	85 c0                	test   %eax,%eax
+  8012ab:	7f 27                	jg     8012d4 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8012ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b0:	5b                   	pop    %ebx
+  8012b1:	5e                   	pop    %esi
+  8012b2:	5f                   	pop    %edi
+  8012b3:	5d                   	pop    %ebp
+  8012b4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012c2:	89 cb                	mov    %ecx,%ebx
+  8012c4:	89 cf                	mov    %ecx,%edi
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	8d 35 d1 12 80 00    	lea    0x8012d1,%esi
+  8012cf:	0f 34                	sysenter
+  8012d1:	5d                   	pop    %ebp
+		goto out;
+  8012d2:	eb d5                	jmp    8012a9 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d4:	83 ec 0c             	sub    $0xc,%esp
+  8012d7:	50                   	push   %eax
+  8012d8:	6a 0d                	push   $0xd
+  8012da:	68 4b 3a 80 00       	push   $0x803a4b
+  8012df:	6a 3f                	push   $0x3f
+  8012e1:	68 68 3a 80 00       	push   $0x803a68
+  8012e6:	e8 d4 ef ff ff       	call   8002bf <_panic>
+
+008012eb <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8012eb:	55                   	push   %ebp
+  8012ec:	89 e5                	mov    %esp,%ebp
+  8012ee:	57                   	push   %edi
+  8012ef:	56                   	push   %esi
+  8012f0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012f1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012f8:	74 1b                	je     801315 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8012fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ff:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801304:	8b 55 08             	mov    0x8(%ebp),%edx
+  801307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130a:	89 df                	mov    %ebx,%edi
+  80130c:	89 de                	mov    %ebx,%esi
+  80130e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801310:	5b                   	pop    %ebx
+  801311:	5e                   	pop    %esi
+  801312:	5f                   	pop    %edi
+  801313:	5d                   	pop    %ebp
+  801314:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801315:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801325:	89 df                	mov    %ebx,%edi
+  801327:	55                   	push   %ebp
+  801328:	89 e5                	mov    %esp,%ebp
+  80132a:	8d 35 32 13 80 00    	lea    0x801332,%esi
+  801330:	0f 34                	sysenter
+  801332:	5d                   	pop    %ebp
+		goto out;
+  801333:	eb db                	jmp    801310 <sys_ipc_recv_until+0x25>
+
+00801335 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	57                   	push   %edi
+  801339:	56                   	push   %esi
+  80133a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80133b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801342:	74 19                	je     80135d <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801344:	ba 00 00 00 00       	mov    $0x0,%edx
+  801349:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80134e:	89 d1                	mov    %edx,%ecx
+  801350:	89 d3                	mov    %edx,%ebx
+  801352:	89 d7                	mov    %edx,%edi
+  801354:	89 d6                	mov    %edx,%esi
+  801356:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801358:	5b                   	pop    %ebx
+  801359:	5e                   	pop    %esi
+  80135a:	5f                   	pop    %edi
+  80135b:	5d                   	pop    %ebp
+  80135c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80135d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801362:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801367:	89 d1                	mov    %edx,%ecx
+  801369:	89 d3                	mov    %edx,%ebx
+  80136b:	89 d7                	mov    %edx,%edi
+  80136d:	55                   	push   %ebp
+  80136e:	89 e5                	mov    %esp,%ebp
+  801370:	8d 35 78 13 80 00    	lea    0x801378,%esi
+  801376:	0f 34                	sysenter
+  801378:	5d                   	pop    %ebp
+		goto out;
+  801379:	eb dd                	jmp    801358 <sys_time_msec+0x23>
+
+0080137b <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	57                   	push   %edi
+  80137f:	56                   	push   %esi
+  801380:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801381:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801388:	74 1a                	je     8013a4 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80138a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80138f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801394:	8b 55 08             	mov    0x8(%ebp),%edx
+  801397:	89 cb                	mov    %ecx,%ebx
+  801399:	89 cf                	mov    %ecx,%edi
+  80139b:	89 ce                	mov    %ecx,%esi
+  80139d:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80139f:	5b                   	pop    %ebx
+  8013a0:	5e                   	pop    %esi
+  8013a1:	5f                   	pop    %edi
+  8013a2:	5d                   	pop    %ebp
+  8013a3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ac:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013b1:	89 cb                	mov    %ecx,%ebx
+  8013b3:	89 cf                	mov    %ecx,%edi
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	8d 35 c0 13 80 00    	lea    0x8013c0,%esi
+  8013be:	0f 34                	sysenter
+  8013c0:	5d                   	pop    %ebp
+		goto out;
+  8013c1:	eb dc                	jmp    80139f <sys_sleep_until+0x24>
+
+008013c3 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8013c3:	55                   	push   %ebp
+  8013c4:	89 e5                	mov    %esp,%ebp
+  8013c6:	57                   	push   %edi
+  8013c7:	56                   	push   %esi
+  8013c8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013c9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013d0:	74 1a                	je     8013ec <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8013d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013df:	89 cb                	mov    %ecx,%ebx
+  8013e1:	89 cf                	mov    %ecx,%edi
+  8013e3:	89 ce                	mov    %ecx,%esi
+  8013e5:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8013e7:	5b                   	pop    %ebx
+  8013e8:	5e                   	pop    %esi
+  8013e9:	5f                   	pop    %edi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013f4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013f9:	89 cb                	mov    %ecx,%ebx
+  8013fb:	89 cf                	mov    %ecx,%edi
+  8013fd:	55                   	push   %ebp
+  8013fe:	89 e5                	mov    %esp,%ebp
+  801400:	8d 35 08 14 80 00    	lea    0x801408,%esi
+  801406:	0f 34                	sysenter
+  801408:	5d                   	pop    %ebp
+		goto out;
+  801409:	eb dc                	jmp    8013e7 <sys_env_print_stats+0x24>
+
+0080140b <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+  80140e:	57                   	push   %edi
+  80140f:	56                   	push   %esi
+  801410:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801411:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801418:	74 1b                	je     801435 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80141a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801424:	8b 55 08             	mov    0x8(%ebp),%edx
+  801427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142a:	89 df                	mov    %ebx,%edi
+  80142c:	89 de                	mov    %ebx,%esi
+  80142e:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801430:	5b                   	pop    %ebx
+  801431:	5e                   	pop    %esi
+  801432:	5f                   	pop    %edi
+  801433:	5d                   	pop    %ebp
+  801434:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801435:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801440:	b8 19 00 00 00       	mov    $0x19,%eax
+  801445:	89 df                	mov    %ebx,%edi
+  801447:	55                   	push   %ebp
+  801448:	89 e5                	mov    %esp,%ebp
+  80144a:	8d 35 52 14 80 00    	lea    0x801452,%esi
+  801450:	0f 34                	sysenter
+  801452:	5d                   	pop    %ebp
+		goto out;
+  801453:	eb db                	jmp    801430 <sys_perf+0x25>
+
+00801455 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	57                   	push   %edi
+  801459:	56                   	push   %esi
+  80145a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80145b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801462:	74 19                	je     80147d <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801464:	ba 00 00 00 00       	mov    $0x0,%edx
+  801469:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80146e:	89 d1                	mov    %edx,%ecx
+  801470:	89 d3                	mov    %edx,%ebx
+  801472:	89 d7                	mov    %edx,%edi
+  801474:	89 d6                	mov    %edx,%esi
+  801476:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801478:	5b                   	pop    %ebx
+  801479:	5e                   	pop    %esi
+  80147a:	5f                   	pop    %edi
+  80147b:	5d                   	pop    %ebp
+  80147c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80147d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801482:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801487:	89 d1                	mov    %edx,%ecx
+  801489:	89 d3                	mov    %edx,%ebx
+  80148b:	89 d7                	mov    %edx,%edi
+  80148d:	55                   	push   %ebp
+  80148e:	89 e5                	mov    %esp,%ebp
+  801490:	8d 35 98 14 80 00    	lea    0x801498,%esi
+  801496:	0f 34                	sysenter
+  801498:	5d                   	pop    %ebp
+		goto out;
+  801499:	eb dd                	jmp    801478 <sys_fork+0x23>
+
+0080149b <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	57                   	push   %edi
+  80149f:	56                   	push   %esi
+  8014a0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014a1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014a8:	74 1c                	je     8014c6 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8014aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8014af:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014bd:	89 f7                	mov    %esi,%edi
+  8014bf:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8014c1:	5b                   	pop    %ebx
+  8014c2:	5e                   	pop    %esi
+  8014c3:	5f                   	pop    %edi
+  8014c4:	5d                   	pop    %ebp
+  8014c5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d9:	55                   	push   %ebp
+  8014da:	89 e5                	mov    %esp,%ebp
+  8014dc:	8d 35 e4 14 80 00    	lea    0x8014e4,%esi
+  8014e2:	0f 34                	sysenter
+  8014e4:	5d                   	pop    %ebp
+		goto out;
+  8014e5:	eb da                	jmp    8014c1 <sys_thread_create+0x26>
+
+008014e7 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8014e7:	55                   	push   %ebp
+  8014e8:	89 e5                	mov    %esp,%ebp
+  8014ea:	57                   	push   %edi
+  8014eb:	56                   	push   %esi
+  8014ec:	53                   	push   %ebx
+  8014ed:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8014f0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014f7:	74 24                	je     80151d <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8014f9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8014fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801503:	8b 55 08             	mov    0x8(%ebp),%edx
+  801506:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801509:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80150c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80150f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801511:	85 c0                	test   %eax,%eax
+  801513:	7f 27                	jg     80153c <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801515:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801518:	5b                   	pop    %ebx
+  801519:	5e                   	pop    %esi
+  80151a:	5f                   	pop    %edi
+  80151b:	5d                   	pop    %ebp
+  80151c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80151d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801520:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801523:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801528:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80152e:	55                   	push   %ebp
+  80152f:	89 e5                	mov    %esp,%ebp
+  801531:	8d 35 39 15 80 00    	lea    0x801539,%esi
+  801537:	0f 34                	sysenter
+  801539:	5d                   	pop    %ebp
+		goto out;
+  80153a:	eb d5                	jmp    801511 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80153c:	83 ec 0c             	sub    $0xc,%esp
+  80153f:	50                   	push   %eax
+  801540:	6a 1f                	push   $0x1f
+  801542:	68 4b 3a 80 00       	push   $0x803a4b
+  801547:	6a 3f                	push   $0x3f
+  801549:	68 68 3a 80 00       	push   $0x803a68
+  80154e:	e8 6c ed ff ff       	call   8002bf <_panic>
+
+00801553 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801553:	55                   	push   %ebp
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	57                   	push   %edi
+  801557:	56                   	push   %esi
+  801558:	53                   	push   %ebx
+  801559:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80155c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801563:	74 23                	je     801588 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801565:	be 00 00 00 00       	mov    $0x0,%esi
+  80156a:	b8 20 00 00 00       	mov    $0x20,%eax
+  80156f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801572:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801575:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801578:	89 f7                	mov    %esi,%edi
+  80157a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	7f 29                	jg     8015a9 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801580:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801583:	5b                   	pop    %ebx
+  801584:	5e                   	pop    %esi
+  801585:	5f                   	pop    %edi
+  801586:	5d                   	pop    %ebp
+  801587:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801588:	8b 55 08             	mov    0x8(%ebp),%edx
+  80158b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80158e:	b8 20 00 00 00       	mov    $0x20,%eax
+  801593:	bf 00 00 00 00       	mov    $0x0,%edi
+  801598:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80159b:	55                   	push   %ebp
+  80159c:	89 e5                	mov    %esp,%ebp
+  80159e:	8d 35 a6 15 80 00    	lea    0x8015a6,%esi
+  8015a4:	0f 34                	sysenter
+  8015a6:	5d                   	pop    %ebp
+		goto out;
+  8015a7:	eb d3                	jmp    80157c <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015a9:	83 ec 0c             	sub    $0xc,%esp
+  8015ac:	50                   	push   %eax
+  8015ad:	6a 20                	push   $0x20
+  8015af:	68 4b 3a 80 00       	push   $0x803a4b
+  8015b4:	6a 3f                	push   $0x3f
+  8015b6:	68 68 3a 80 00       	push   $0x803a68
+  8015bb:	e8 ff ec ff ff       	call   8002bf <_panic>
+
+008015c0 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8015c0:	55                   	push   %ebp
+  8015c1:	89 e5                	mov    %esp,%ebp
+  8015c3:	57                   	push   %edi
+  8015c4:	56                   	push   %esi
+  8015c5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015c6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015cd:	74 1b                	je     8015ea <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8015cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015df:	89 df                	mov    %ebx,%edi
+  8015e1:	89 de                	mov    %ebx,%esi
+  8015e3:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8015e5:	5b                   	pop    %ebx
+  8015e6:	5e                   	pop    %esi
+  8015e7:	5f                   	pop    %edi
+  8015e8:	5d                   	pop    %ebp
+  8015e9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8015fa:	89 df                	mov    %ebx,%edi
+  8015fc:	55                   	push   %ebp
+  8015fd:	89 e5                	mov    %esp,%ebp
+  8015ff:	8d 35 07 16 80 00    	lea    0x801607,%esi
+  801605:	0f 34                	sysenter
+  801607:	5d                   	pop    %ebp
+		goto out;
+  801608:	eb db                	jmp    8015e5 <sys_batch+0x25>
+
+0080160a <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80160a:	55                   	push   %ebp
+  80160b:	89 e5                	mov    %esp,%ebp
+  80160d:	57                   	push   %edi
+  80160e:	56                   	push   %esi
+  80160f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801610:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801617:	74 1a                	je     801633 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801619:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80161e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801623:	8b 55 08             	mov    0x8(%ebp),%edx
+  801626:	89 cb                	mov    %ecx,%ebx
+  801628:	89 cf                	mov    %ecx,%edi
+  80162a:	89 ce                	mov    %ecx,%esi
+  80162c:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  80162e:	5b                   	pop    %ebx
+  80162f:	5e                   	pop    %esi
+  801630:	5f                   	pop    %edi
+  801631:	5d                   	pop    %ebp
+  801632:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801633:	8b 55 08             	mov    0x8(%ebp),%edx
+  801636:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80163b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801640:	89 cb                	mov    %ecx,%ebx
+  801642:	89 cf                	mov    %ecx,%edi
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	8d 35 4f 16 80 00    	lea    0x80164f,%esi
+  80164d:	0f 34                	sysenter
+  80164f:	5d                   	pop    %ebp
+		goto out;
+  801650:	eb dc                	jmp    80162e <sys_trace_ctl+0x24>
+
+00801652 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801652:	55                   	push   %ebp
+  801653:	89 e5                	mov    %esp,%ebp
+  801655:	57                   	push   %edi
+  801656:	56                   	push   %esi
+  801657:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801658:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80165f:	74 1c                	je     80167d <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801661:	be 00 00 00 00       	mov    $0x0,%esi
+  801666:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80166b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80166e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801671:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801674:	89 f7                	mov    %esi,%edi
+  801676:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801678:	5b                   	pop    %ebx
+  801679:	5e                   	pop    %esi
+  80167a:	5f                   	pop    %edi
+  80167b:	5d                   	pop    %ebp
+  80167c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80167d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801680:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801683:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801688:	bf 00 00 00 00       	mov    $0x0,%edi
+  80168d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801690:	55                   	push   %ebp
+  801691:	89 e5                	mov    %esp,%ebp
+  801693:	8d 35 9b 16 80 00    	lea    0x80169b,%esi
+  801699:	0f 34                	sysenter
+  80169b:	5d                   	pop    %ebp
+		goto out;
+  80169c:	eb da                	jmp    801678 <sys_trace_read+0x26>
+
+0080169e <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80169e:	55                   	push   %ebp
+  80169f:	89 e5                	mov    %esp,%ebp
+  8016a1:	57                   	push   %edi
+  8016a2:	56                   	push   %esi
+  8016a3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016a4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016ab:	74 1c                	je     8016c9 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8016ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b2:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c0:	89 f7                	mov    %esi,%edi
+  8016c2:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8016c4:	5b                   	pop    %ebx
+  8016c5:	5e                   	pop    %esi
+  8016c6:	5f                   	pop    %edi
+  8016c7:	5d                   	pop    %ebp
+  8016c8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016cf:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016dc:	55                   	push   %ebp
+  8016dd:	89 e5                	mov    %esp,%ebp
+  8016df:	8d 35 e7 16 80 00    	lea    0x8016e7,%esi
+  8016e5:	0f 34                	sysenter
+  8016e7:	5d                   	pop    %ebp
+		goto out;
+  8016e8:	eb da                	jmp    8016c4 <sys_meminfo+0x26>
+
+008016ea <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8016ea:	55                   	push   %ebp
+  8016eb:	89 e5                	mov    %esp,%ebp
+  8016ed:	57                   	push   %edi
+  8016ee:	56                   	push   %esi
+  8016ef:	53                   	push   %ebx
+  8016f0:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8016f3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8016f7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016fe:	74 1f                	je     80171f <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801700:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801705:	b8 22 00 00 00       	mov    $0x22,%eax
+  80170a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170d:	89 df                	mov    %ebx,%edi
+  80170f:	89 de                	mov    %ebx,%esi
+  801711:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801713:	85 c0                	test   %eax,%eax
+  801715:	7f 25                	jg     80173c <sys_env_set_ksm+0x52>
+}
+  801717:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171a:	5b                   	pop    %ebx
+  80171b:	5e                   	pop    %esi
+  80171c:	5f                   	pop    %edi
+  80171d:	5d                   	pop    %ebp
+  80171e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80171f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801724:	8b 55 08             	mov    0x8(%ebp),%edx
+  801727:	b8 22 00 00 00       	mov    $0x22,%eax
+  80172c:	89 df                	mov    %ebx,%edi
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	8d 35 39 17 80 00    	lea    0x801739,%esi
+  801737:	0f 34                	sysenter
+  801739:	5d                   	pop    %ebp
+		goto out;
+  80173a:	eb d7                	jmp    801713 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80173c:	83 ec 0c             	sub    $0xc,%esp
+  80173f:	50                   	push   %eax
+  801740:	6a 22                	push   $0x22
+  801742:	68 4b 3a 80 00       	push   $0x803a4b
+  801747:	6a 3f                	push   $0x3f
+  801749:	68 68 3a 80 00       	push   $0x803a68
+  80174e:	e8 6c eb ff ff       	call   8002bf <_panic>
+
+00801753 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801753:	55                   	push   %ebp
+  801754:	89 e5                	mov    %esp,%ebp
+  801756:	57                   	push   %edi
+  801757:	56                   	push   %esi
+  801758:	53                   	push   %ebx
+  801759:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  80175c:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80175f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801766:	74 24                	je     80178c <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801768:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80176d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801772:	89 cb                	mov    %ecx,%ebx
+  801774:	89 cf                	mov    %ecx,%edi
+  801776:	89 ce                	mov    %ecx,%esi
+  801778:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	7f 2a                	jg     8017a8 <sys_time_nsec+0x55>
+	return ns;
+}
+  80177e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801781:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801787:	5b                   	pop    %ebx
+  801788:	5e                   	pop    %esi
+  801789:	5f                   	pop    %edi
+  80178a:	5d                   	pop    %ebp
+  80178b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80178c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801791:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801796:	89 cb                	mov    %ecx,%ebx
+  801798:	89 cf                	mov    %ecx,%edi
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	8d 35 a5 17 80 00    	lea    0x8017a5,%esi
+  8017a3:	0f 34                	sysenter
+  8017a5:	5d                   	pop    %ebp
+		goto out;
+  8017a6:	eb d2                	jmp    80177a <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017a8:	83 ec 0c             	sub    $0xc,%esp
+  8017ab:	50                   	push   %eax
+  8017ac:	6a 0f                	push   $0xf
+  8017ae:	68 4b 3a 80 00       	push   $0x803a4b
+  8017b3:	6a 3f                	push   $0x3f
+  8017b5:	68 68 3a 80 00       	push   $0x803a68
+  8017ba:	e8 00 eb ff ff       	call   8002bf <_panic>
+
+008017bf <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8017bf:	55                   	push   %ebp
+  8017c0:	89 e5                	mov    %esp,%ebp
+  8017c2:	57                   	push   %edi
+  8017c3:	56                   	push   %esi
+  8017c4:	53                   	push   %ebx
+  8017c5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017c8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017cf:	74 22                	je     8017f3 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8017d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d6:	b8 12 00 00 00       	mov    $0x12,%eax
+  8017db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017e1:	89 df                	mov    %ebx,%edi
+  8017e3:	89 de                	mov    %ebx,%esi
+  8017e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017e7:	85 c0                	test   %eax,%eax
+  8017e9:	7f 28                	jg     801813 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8017eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ee:	5b                   	pop    %ebx
+  8017ef:	5e                   	pop    %esi
+  8017f0:	5f                   	pop    %edi
+  8017f1:	5d                   	pop    %ebp
+  8017f2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017fe:	b8 12 00 00 00       	mov    $0x12,%eax
+  801803:	89 df                	mov    %ebx,%edi
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	8d 35 10 18 80 00    	lea    0x801810,%esi
+  80180e:	0f 34                	sysenter
+  801810:	5d                   	pop    %ebp
+		goto out;
+  801811:	eb d4                	jmp    8017e7 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801813:	83 ec 0c             	sub    $0xc,%esp
+  801816:	50                   	push   %eax
+  801817:	6a 12                	push   $0x12
+  801819:	68 4b 3a 80 00       	push   $0x803a4b
+  80181e:	6a 3f                	push   $0x3f
+  801820:	68 68 3a 80 00       	push   $0x803a68
+  801825:	e8 95 ea ff ff       	call   8002bf <_panic>
+
+0080182a <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80182a:	55                   	push   %ebp
+  80182b:	89 e5                	mov    %esp,%ebp
+  80182d:	57                   	push   %edi
+  80182e:	56                   	push   %esi
+  80182f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801830:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801837:	74 1b                	je     801854 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801839:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801843:	8b 55 08             	mov    0x8(%ebp),%edx
+  801846:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801849:	89 df                	mov    %ebx,%edi
+  80184b:	89 de                	mov    %ebx,%esi
+  80184d:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80184f:	5b                   	pop    %ebx
+  801850:	5e                   	pop    %esi
+  801851:	5f                   	pop    %edi
+  801852:	5d                   	pop    %ebp
+  801853:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801854:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801859:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80185f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801864:	89 df                	mov    %ebx,%edi
+  801866:	55                   	push   %ebp
+  801867:	89 e5                	mov    %esp,%ebp
+  801869:	8d 35 71 18 80 00    	lea    0x801871,%esi
+  80186f:	0f 34                	sysenter
+  801871:	5d                   	pop    %ebp
+		goto out;
+  801872:	eb db                	jmp    80184f <sys_e1000_receive+0x25>
+
+00801874 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801874:	55                   	push   %ebp
+  801875:	89 e5                	mov    %esp,%ebp
+  801877:	57                   	push   %edi
+  801878:	56                   	push   %esi
+  801879:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80187a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801881:	74 1b                	je     80189e <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801883:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801888:	b8 14 00 00 00       	mov    $0x14,%eax
+  80188d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801890:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801893:	89 df                	mov    %ebx,%edi
+  801895:	89 de                	mov    %ebx,%esi
+  801897:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801899:	5b                   	pop    %ebx
+  80189a:	5e                   	pop    %esi
+  80189b:	5f                   	pop    %edi
+  80189c:	5d                   	pop    %ebp
+  80189d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80189e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018a9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8018ae:	89 df                	mov    %ebx,%edi
+  8018b0:	55                   	push   %ebp
+  8018b1:	89 e5                	mov    %esp,%ebp
+  8018b3:	8d 35 bb 18 80 00    	lea    0x8018bb,%esi
+  8018b9:	0f 34                	sysenter
+  8018bb:	5d                   	pop    %ebp
+		goto out;
+  8018bc:	eb db                	jmp    801899 <sys_e1000_read_hwaddr+0x25>
+
+008018be <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8018be:	55                   	push   %ebp
+  8018bf:	89 e5                	mov    %esp,%ebp
+  8018c1:	57                   	push   %edi
+  8018c2:	56                   	push   %esi
+  8018c3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018c4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8018cb:	74 1a                	je     8018e7 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8018cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018d2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018da:	89 cb                	mov    %ecx,%ebx
+  8018dc:	89 cf                	mov    %ecx,%edi
+  8018de:	89 ce                	mov    %ecx,%esi
+  8018e0:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8018e2:	5b                   	pop    %ebx
+  8018e3:	5e                   	pop    %esi
+  8018e4:	5f                   	pop    %edi
+  8018e5:	5d                   	pop    %ebp
+  8018e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018ef:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018f4:	89 cb                	mov    %ecx,%ebx
+  8018f6:	89 cf                	mov    %ecx,%edi
+  8018f8:	55                   	push   %ebp
+  8018f9:	89 e5                	mov    %esp,%ebp
+  8018fb:	8d 35 03 19 80 00    	lea    0x801903,%esi
+  801901:	0f 34                	sysenter
+  801903:	5d                   	pop    %ebp
+		goto out;
+  801904:	eb dc                	jmp    8018e2 <sys_sb16_read_version+0x24>
+
+00801906 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801906:	55                   	push   %ebp
+  801907:	89 e5                	mov    %esp,%ebp
+  801909:	57                   	push   %edi
+  80190a:	56                   	push   %esi
+  80190b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80190c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801913:	74 1b                	je     801930 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801915:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80191f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801922:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801925:	89 df                	mov    %ebx,%edi
+  801927:	89 de                	mov    %ebx,%esi
+  801929:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80192b:	5b                   	pop    %ebx
+  80192c:	5e                   	pop    %esi
+  80192d:	5f                   	pop    %edi
+  80192e:	5d                   	pop    %ebp
+  80192f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801930:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801935:	8b 55 08             	mov    0x8(%ebp),%edx
+  801938:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80193b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801940:	89 df                	mov    %ebx,%edi
+  801942:	55                   	push   %ebp
+  801943:	89 e5                	mov    %esp,%ebp
+  801945:	8d 35 4d 19 80 00    	lea    0x80194d,%esi
+  80194b:	0f 34                	sysenter
+  80194d:	5d                   	pop    %ebp
+		goto out;
+  80194e:	eb db                	jmp    80192b <sys_sb16_play+0x25>
+
+00801950 <dupperm>:
+
+// The permissions duppage() gives page pn, in the child and in our own
+// address space.
+static int
+dupperm(unsigned pn)
+{
+  801950:	55                   	push   %ebp
+  801951:	89 e5                	mov    %esp,%ebp
+  801953:	53                   	push   %ebx
+  801954:	83 ec 04             	sub    $0x4,%esp
+  801957:	89 c2                	mov    %eax,%edx
+	int r = PTE_U | PTE_P;
+	
+	// Assert that a page is not COW and also shared.
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  801959:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801960:	f6 c4 04             	test   $0x4,%ah
+  801963:	74 0c                	je     801971 <dupperm+0x21>
+  801965:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80196c:	f6 c4 08             	test   $0x8,%ah
+  80196f:	75 62                	jne    8019d3 <dupperm+0x83>
+	
+	// Check if the page should be COW
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  801971:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	int r = PTE_U | PTE_P;
+  801978:	b8 05 00 00 00       	mov    $0x5,%eax
+	if ((uvpt[pn] & (PTE_W | PTE_COW)) && ! (uvpt[pn] & PTE_SHARE))
+  80197d:	f7 c1 02 08 00 00    	test   $0x802,%ecx
+  801983:	74 19                	je     80199e <dupperm+0x4e>
+  801985:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80198c:	25 00 04 00 00       	and    $0x400,%eax
+	int r = PTE_U | PTE_P;
+  801991:	83 f8 01             	cmp    $0x1,%eax
+  801994:	19 c0                	sbb    %eax,%eax
+  801996:	25 00 08 00 00       	and    $0x800,%eax
+  80199b:	83 c0 05             	add    $0x5,%eax
+		r |= PTE_COW;
+	
+	if ((uvpt[pn] & PTE_SHARE))
+  80199e:	8b 1c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ebx
+		r |= PTE_SHARE;
+  8019a5:	89 c1                	mov    %eax,%ecx
+  8019a7:	80 cd 04             	or     $0x4,%ch
+  8019aa:	f6 c7 04             	test   $0x4,%bh
+  8019ad:	0f 45 c1             	cmovne %ecx,%eax
+	
+	// Return write permission if page is shared
+	if ((uvpt[pn] & PTE_W) && (uvpt[pn] & PTE_SHARE))
+  8019b0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8019b7:	f6 c1 02             	test   $0x2,%cl
+  8019ba:	74 12                	je     8019ce <dupperm+0x7e>
+  8019bc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		r |= PTE_W;
+  8019c3:	89 c2                	mov    %eax,%edx
+  8019c5:	83 ca 02             	or     $0x2,%edx
+  8019c8:	f6 c5 04             	test   $0x4,%ch
+  8019cb:	0f 45 c2             	cmovne %edx,%eax
+	
+	return r;
+}
+  8019ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d1:	c9                   	leave
+  8019d2:	c3                   	ret
+	assert(! ((uvpt[pn] & PTE_SHARE) && (uvpt[pn] & PTE_COW)));
+  8019d3:	68 78 3a 80 00       	push   $0x803a78
+  8019d8:	68 10 3b 80 00       	push   $0x803b10
+  8019dd:	6a 39                	push   $0x39
+  8019df:	68 25 3b 80 00       	push   $0x803b25
+  8019e4:	e8 d6 e8 ff ff       	call   8002bf <_panic>
+
+008019e9 <pgfault>:
+{
+  8019e9:	55                   	push   %ebp
+  8019ea:	89 e5                	mov    %esp,%ebp
+  8019ec:	53                   	push   %ebx
+  8019ed:	83 ec 04             	sub    $0x4,%esp
+  8019f0:	8b 55 08             	mov    0x8(%ebp),%edx
+	void *addr = (void *) utf->utf_fault_va;
+  8019f3:	8b 02                	mov    (%edx),%eax
+	addr = (void *) ROUNDDOWN((uintptr_t) addr, PGSIZE);
+  8019f5:	89 c3                	mov    %eax,%ebx
+  8019f7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  8019fd:	f6 42 04 02          	testb  $0x2,0x4(%edx)
+  801a01:	74 6d                	je     801a70 <pgfault+0x87>
+  801a03:	89 da                	mov    %ebx,%edx
+  801a05:	c1 ea 16             	shr    $0x16,%edx
+  801a08:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a0f:	f6 c2 80             	test   $0x80,%dl
+  801a12:	75 5c                	jne    801a70 <pgfault+0x87>
+	    ! (uvpt[(uintptr_t) addr / PGSIZE] & PTE_COW))
+  801a14:	c1 e8 0c             	shr    $0xc,%eax
+  801a17:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(err & FEC_WR) || (uvpd[PDX(addr)] & PTE_PS) ||
+  801a1e:	f6 c4 08             	test   $0x8,%ah
+  801a21:	74 4d                	je     801a70 <pgfault+0x87>
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801a23:	83 ec 04             	sub    $0x4,%esp
+  801a26:	6a 07                	push   $0x7
+  801a28:	68 00 f0 7f 00       	push   $0x7ff000
+  801a2d:	6a 00                	push   $0x0
+  801a2f:	e8 a6 f4 ff ff       	call   800eda <sys_page_alloc>
+  801a34:	83 c4 10             	add    $0x10,%esp
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	78 49                	js     801a84 <pgfault+0x9b>
+	memmove((void *) PFTEMP, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801a3b:	83 ec 04             	sub    $0x4,%esp
+  801a3e:	68 00 10 00 00       	push   $0x1000
+  801a43:	53                   	push   %ebx
+  801a44:	68 00 f0 7f 00       	push   $0x7ff000
+  801a49:	e8 1a f1 ff ff       	call   800b68 <memmove>
+	if ((r = sys_page_map(0, (void *) PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  801a4e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801a55:	53                   	push   %ebx
+  801a56:	6a 00                	push   $0x0
+  801a58:	68 00 f0 7f 00       	push   $0x7ff000
+  801a5d:	6a 00                	push   $0x0
+  801a5f:	e8 e3 f4 ff ff       	call   800f47 <sys_page_map>
+  801a64:	83 c4 20             	add    $0x20,%esp
+  801a67:	85 c0                	test   %eax,%eax
+  801a69:	78 2d                	js     801a98 <pgfault+0xaf>
+}
+  801a6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a6e:	c9                   	leave
+  801a6f:	c3                   	ret
+		panic("pgfault on non-COW page.");
+  801a70:	83 ec 04             	sub    $0x4,%esp
+  801a73:	68 30 3b 80 00       	push   $0x803b30
+  801a78:	6a 1e                	push   $0x1e
+  801a7a:	68 25 3b 80 00       	push   $0x803b25
+  801a7f:	e8 3b e8 ff ff       	call   8002bf <_panic>
+		panic("pgfault handler couldn't allocate temporary page");
+  801a84:	83 ec 04             	sub    $0x4,%esp
+  801a87:	68 ac 3a 80 00       	push   $0x803aac
+  801a8c:	6a 29                	push   $0x29
+  801a8e:	68 25 3b 80 00       	push   $0x803b25
+  801a93:	e8 27 e8 ff ff       	call   8002bf <_panic>
+		panic("pgfault handler couldn't remap the address : %e", r);
+  801a98:	50                   	push   %eax
+  801a99:	68 e0 3a 80 00       	push   $0x803ae0
+  801a9e:	6a 2e                	push   $0x2e
+  801aa0:	68 25 3b 80 00       	push   $0x803b25
+  801aa5:	e8 15 e8 ff ff       	call   8002bf <_panic>
+
+00801aaa <thread_main>:
+	return pid;
+}
+
+static void
+thread_main(void (*func)(void *), void *arg)
+{
+  801aaa:	55                   	push   %ebp
+  801aab:	89 e5                	mov    %esp,%ebp
+  801aad:	83 ec 14             	sub    $0x14,%esp
+	func(arg);
+  801ab0:	ff 75 0c             	push   0xc(%ebp)
+  801ab3:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801ab6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801abd:	e8 23 f3 ff ff       	call   800de5 <sys_env_destroy>
+}
+  801ac2:	83 c4 10             	add    $0x10,%esp
+  801ac5:	c9                   	leave
+  801ac6:	c3                   	ret
+
+00801ac7 <ufork>:
+{
+  801ac7:	55                   	push   %ebp
+  801ac8:	89 e5                	mov    %esp,%ebp
+  801aca:	57                   	push   %edi
+  801acb:	56                   	push   %esi
+  801acc:	53                   	push   %ebx
+  801acd:	81 ec ec 01 00 00    	sub    $0x1ec,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801ad3:	b8 07 00 00 00       	mov    $0x7,%eax
+  801ad8:	cd 30                	int    $0x30
+  801ada:	89 c6                	mov    %eax,%esi
+  801adc:	89 85 14 fe ff ff    	mov    %eax,-0x1ec(%ebp)
+	if ((pid = sys_exofork()) < 0)
+  801ae2:	85 c0                	test   %eax,%eax
+  801ae4:	78 56                	js     801b3c <ufork+0x75>
+	if (pid > 0) {
+  801ae6:	0f 8e b3 02 00 00    	jle    801d9f <ufork+0x2d8>
+		set_pgfault_handler(pgfault);
+  801aec:	83 ec 0c             	sub    $0xc,%esp
+  801aef:	68 e9 19 80 00       	push   $0x8019e9
+  801af4:	e8 1c 1a 00 00       	call   803515 <set_pgfault_handler>
+		sys_env_set_pgfault_upcall(pid, _pgfault_upcall);
+  801af9:	83 c4 08             	add    $0x8,%esp
+  801afc:	68 7c 35 80 00       	push   $0x80357c
+  801b01:	56                   	push   %esi
+  801b02:	e8 ef f5 ff ff       	call   8010f6 <sys_env_set_pgfault_upcall>
+		batch_init(&b);
+  801b07:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801b0d:	89 1c 24             	mov    %ebx,(%esp)
+  801b10:	e8 a1 04 00 00       	call   801fb6 <batch_init>
+		batch_alloc(&b, pid, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE),
+  801b15:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  801b1c:	6a 07                	push   $0x7
+  801b1e:	68 00 f0 bf ee       	push   $0xeebff000
+  801b23:	56                   	push   %esi
+  801b24:	53                   	push   %ebx
+  801b25:	e8 0d 06 00 00       	call   802137 <batch_alloc>
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b2a:	83 c4 20             	add    $0x20,%esp
+  801b2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b32:	89 b5 0c fe ff ff    	mov    %esi,-0x1f4(%ebp)
+  801b38:	89 fe                	mov    %edi,%esi
+  801b3a:	eb 22                	jmp    801b5e <ufork+0x97>
+		panic("cannot fork: %e", pid);
+  801b3c:	50                   	push   %eax
+  801b3d:	68 49 3b 80 00       	push   $0x803b49
+  801b42:	68 a9 00 00 00       	push   $0xa9
+  801b47:	68 25 3b 80 00       	push   $0x803b25
+  801b4c:	e8 6e e7 ff ff       	call   8002bf <_panic>
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801b51:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801b57:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801b5c:	89 c6                	mov    %eax,%esi
+		for (i = 0 ; i < USTACKTOP / PGSIZE; i = j) {
+  801b5e:	89 f7                	mov    %esi,%edi
+  801b60:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801b66:	0f 87 e9 01 00 00    	ja     801d55 <ufork+0x28e>
+			if (! (uvpd[i / NPTENTRIES] & PTE_P)) {
+  801b6c:	8d 96 ff 03 00 00    	lea    0x3ff(%esi),%edx
+  801b72:	85 f6                	test   %esi,%esi
+  801b74:	0f 49 d6             	cmovns %esi,%edx
+  801b77:	c1 fa 0a             	sar    $0xa,%edx
+  801b7a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+  801b81:	f6 c1 01             	test   $0x1,%cl
+  801b84:	74 cb                	je     801b51 <ufork+0x8a>
+			if (uvpd[i / NPTENTRIES] & PTE_PS) {
+  801b86:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b8d:	f6 c2 80             	test   $0x80,%dl
+  801b90:	75 17                	jne    801ba9 <ufork+0xe2>
+			j = i + 1;
+  801b92:	8d 5e 01             	lea    0x1(%esi),%ebx
+			if (! (uvpt[i] & PTE_P))
+  801b95:	8b 14 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%edx
+  801b9c:	f6 c2 01             	test   $0x1,%dl
+  801b9f:	0f 85 f3 00 00 00    	jne    801c98 <ufork+0x1d1>
+			j = i + 1;
+  801ba5:	89 de                	mov    %ebx,%esi
+  801ba7:	eb b5                	jmp    801b5e <ufork+0x97>
+	void *va = (void *) (pn * PGSIZE);
+  801ba9:	89 fb                	mov    %edi,%ebx
+  801bab:	c1 e3 0c             	shl    $0xc,%ebx
+	int perm = uvpd[PDX(va)] & PTE_SYSCALL;
+  801bae:	89 d8                	mov    %ebx,%eax
+  801bb0:	c1 e8 16             	shr    $0x16,%eax
+  801bb3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bba:	89 c2                	mov    %eax,%edx
+  801bbc:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+	if ((perm & (PTE_W | PTE_SHARE)) != PTE_W) {
+  801bc2:	25 02 04 00 00       	and    $0x402,%eax
+  801bc7:	83 f8 02             	cmp    $0x2,%eax
+  801bca:	74 31                	je     801bfd <ufork+0x136>
+		batch_map(b, 0, va, envid, va, perm, 1);
+  801bcc:	83 ec 04             	sub    $0x4,%esp
+  801bcf:	6a 01                	push   $0x1
+  801bd1:	52                   	push   %edx
+  801bd2:	53                   	push   %ebx
+  801bd3:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801bd9:	53                   	push   %ebx
+  801bda:	6a 00                	push   $0x0
+  801bdc:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801be2:	50                   	push   %eax
+  801be3:	e8 7a 05 00 00       	call   802162 <batch_map>
+		return;
+  801be8:	83 c4 20             	add    $0x20,%esp
+				j = ROUNDUP(i + 1, NPTENTRIES);
+  801beb:	8d 87 00 04 00 00    	lea    0x400(%edi),%eax
+  801bf1:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+  801bf6:	89 c6                	mov    %eax,%esi
+				continue;
+  801bf8:	e9 61 ff ff ff       	jmp    801b5e <ufork+0x97>
+	if ((r = sys_page_alloc(envid, va, perm | PTE_PS)) < 0)
+  801bfd:	83 ec 04             	sub    $0x4,%esp
+  801c00:	80 ca 80             	or     $0x80,%dl
+  801c03:	52                   	push   %edx
+  801c04:	53                   	push   %ebx
+  801c05:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c0b:	e8 ca f2 ff ff       	call   800eda <sys_page_alloc>
+  801c10:	83 c4 10             	add    $0x10,%esp
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	78 5d                	js     801c74 <ufork+0x1ad>
+	if ((r = sys_page_map(envid, va, 0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  801c17:	83 ec 0c             	sub    $0xc,%esp
+  801c1a:	6a 07                	push   $0x7
+  801c1c:	68 00 00 40 00       	push   $0x400000
+  801c21:	6a 00                	push   $0x0
+  801c23:	53                   	push   %ebx
+  801c24:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801c2a:	e8 18 f3 ff ff       	call   800f47 <sys_page_map>
+  801c2f:	83 c4 20             	add    $0x20,%esp
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	78 50                	js     801c86 <ufork+0x1bf>
+	memmove(UTEMP, va, PTSIZE);
+  801c36:	83 ec 04             	sub    $0x4,%esp
+  801c39:	68 00 00 40 00       	push   $0x400000
+  801c3e:	53                   	push   %ebx
+  801c3f:	68 00 00 40 00       	push   $0x400000
+  801c44:	e8 1f ef ff ff       	call   800b68 <memmove>
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  801c49:	83 c4 08             	add    $0x8,%esp
+  801c4c:	68 00 00 40 00       	push   $0x400000
+  801c51:	6a 00                	push   $0x0
+  801c53:	e8 5d f3 ff ff       	call   800fb5 <sys_page_unmap>
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	79 8c                	jns    801beb <ufork+0x124>
+		panic("sys_page_unmap: %e", r);
+  801c5f:	50                   	push   %eax
+  801c60:	68 7d 3b 80 00       	push   $0x803b7d
+  801c65:	68 81 00 00 00       	push   $0x81
+  801c6a:	68 25 3b 80 00       	push   $0x803b25
+  801c6f:	e8 4b e6 ff ff       	call   8002bf <_panic>
+		panic("sys_page_alloc: %e", r);
+  801c74:	50                   	push   %eax
+  801c75:	68 59 3b 80 00       	push   $0x803b59
+  801c7a:	6a 7c                	push   $0x7c
+  801c7c:	68 25 3b 80 00       	push   $0x803b25
+  801c81:	e8 39 e6 ff ff       	call   8002bf <_panic>
+		panic("sys_page_map: %e", r);
+  801c86:	50                   	push   %eax
+  801c87:	68 6c 3b 80 00       	push   $0x803b6c
+  801c8c:	6a 7e                	push   $0x7e
+  801c8e:	68 25 3b 80 00       	push   $0x803b25
+  801c93:	e8 27 e6 ff ff       	call   8002bf <_panic>
+  801c98:	89 b5 10 fe ff ff    	mov    %esi,-0x1f0(%ebp)
+  801c9e:	eb 22                	jmp    801cc2 <ufork+0x1fb>
+	       (uvpt[pn] & PTE_P);
+  801ca0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801ca7:	a8 01                	test   $0x1,%al
+  801ca9:	74 35                	je     801ce0 <ufork+0x219>
+			       dupperm(j) == dupperm(i))
+  801cab:	89 d8                	mov    %ebx,%eax
+  801cad:	e8 9e fc ff ff       	call   801950 <dupperm>
+  801cb2:	89 c6                	mov    %eax,%esi
+  801cb4:	89 f8                	mov    %edi,%eax
+  801cb6:	e8 95 fc ff ff       	call   801950 <dupperm>
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cbb:	39 c6                	cmp    %eax,%esi
+  801cbd:	75 21                	jne    801ce0 <ufork+0x219>
+				j++;
+  801cbf:	83 c3 01             	add    $0x1,%ebx
+			while (j < USTACKTOP / PGSIZE && pn_mapped(j) &&
+  801cc2:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  801cc8:	74 16                	je     801ce0 <ufork+0x219>
+	return (uvpd[pn / NPTENTRIES] & (PTE_P | PTE_PS)) == PTE_P &&
+  801cca:	89 d8                	mov    %ebx,%eax
+  801ccc:	c1 e8 0a             	shr    $0xa,%eax
+  801ccf:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cd6:	25 81 00 00 00       	and    $0x81,%eax
+  801cdb:	83 f8 01             	cmp    $0x1,%eax
+  801cde:	74 c0                	je     801ca0 <ufork+0x1d9>
+			duppage(&b, pid, i, j - i);
+  801ce0:	8b b5 10 fe ff ff    	mov    -0x1f0(%ebp),%esi
+  801ce6:	89 d8                	mov    %ebx,%eax
+  801ce8:	29 f0                	sub    %esi,%eax
+  801cea:	89 85 10 fe ff ff    	mov    %eax,-0x1f0(%ebp)
+	void *va = (void *) (pn * PGSIZE);
+  801cf0:	89 fe                	mov    %edi,%esi
+  801cf2:	c1 e6 0c             	shl    $0xc,%esi
+	int perm = dupperm(pn);
+  801cf5:	89 f8                	mov    %edi,%eax
+  801cf7:	e8 54 fc ff ff       	call   801950 <dupperm>
+  801cfc:	89 c7                	mov    %eax,%edi
+	batch_reserve(b, 2);
+  801cfe:	83 ec 08             	sub    $0x8,%esp
+  801d01:	6a 02                	push   $0x2
+  801d03:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d09:	51                   	push   %ecx
+  801d0a:	e8 15 03 00 00       	call   802024 <batch_reserve>
+	batch_map(b, 0, va, envid, va, perm, npages);
+  801d0f:	83 c4 0c             	add    $0xc,%esp
+  801d12:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d18:	57                   	push   %edi
+  801d19:	56                   	push   %esi
+  801d1a:	ff b5 14 fe ff ff    	push   -0x1ec(%ebp)
+  801d20:	56                   	push   %esi
+  801d21:	6a 00                	push   $0x0
+  801d23:	8d 8d 20 fe ff ff    	lea    -0x1e0(%ebp),%ecx
+  801d29:	51                   	push   %ecx
+  801d2a:	e8 33 04 00 00       	call   802162 <batch_map>
+	batch_map(b, 0, va, 0, va, perm, npages);
+  801d2f:	83 c4 1c             	add    $0x1c,%esp
+  801d32:	ff b5 10 fe ff ff    	push   -0x1f0(%ebp)
+  801d38:	57                   	push   %edi
+  801d39:	56                   	push   %esi
+  801d3a:	6a 00                	push   $0x0
+  801d3c:	56                   	push   %esi
+  801d3d:	6a 00                	push   $0x0
+  801d3f:	8d 85 20 fe ff ff    	lea    -0x1e0(%ebp),%eax
+  801d45:	50                   	push   %eax
+  801d46:	e8 17 04 00 00       	call   802162 <batch_map>
+	return 0;
+  801d4b:	83 c4 20             	add    $0x20,%esp
+  801d4e:	89 de                	mov    %ebx,%esi
+  801d50:	e9 09 fe ff ff       	jmp    801b5e <ufork+0x97>
+		batch_set_status(&b, pid, ENV_RUNNABLE);
+  801d55:	8b b5 0c fe ff ff    	mov    -0x1f4(%ebp),%esi
+  801d5b:	83 ec 04             	sub    $0x4,%esp
+  801d5e:	6a 02                	push   $0x2
+  801d60:	56                   	push   %esi
+  801d61:	8d 9d 20 fe ff ff    	lea    -0x1e0(%ebp),%ebx
+  801d67:	53                   	push   %ebx
+  801d68:	e8 49 04 00 00       	call   8021b6 <batch_set_status>
+		if ((r = batch_flush(&b)) < 0)
+  801d6d:	89 1c 24             	mov    %ebx,(%esp)
+  801d70:	e8 5d 02 00 00       	call   801fd2 <batch_flush>
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 0e                	js     801d8a <ufork+0x2c3>
+}
+  801d7c:	8b 85 14 fe ff ff    	mov    -0x1ec(%ebp),%eax
+  801d82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d85:	5b                   	pop    %ebx
+  801d86:	5e                   	pop    %esi
+  801d87:	5f                   	pop    %edi
+  801d88:	5d                   	pop    %ebp
+  801d89:	c3                   	ret
+			panic("fork: %e", r);
+  801d8a:	50                   	push   %eax
+  801d8b:	68 50 3b 80 00       	push   $0x803b50
+  801d90:	68 d7 00 00 00       	push   $0xd7
+  801d95:	68 25 3b 80 00       	push   $0x803b25
+  801d9a:	e8 20 e5 ff ff       	call   8002bf <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801d9f:	e8 aa f0 ff ff       	call   800e4e <sys_getenvid>
+  801da4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801da9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801daf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801db4:	a3 08 50 80 00       	mov    %eax,0x805008
+		return 0;
+  801db9:	c7 85 14 fe ff ff 00 	movl   $0x0,-0x1ec(%ebp)
+  801dc0:	00 00 00 
+  801dc3:	eb b7                	jmp    801d7c <ufork+0x2b5>
+
+00801dc5 <fork>:
+{
+  801dc5:	55                   	push   %ebp
+  801dc6:	89 e5                	mov    %esp,%ebp
+  801dc8:	53                   	push   %ebx
+  801dc9:	83 ec 10             	sub    $0x10,%esp
+	set_pgfault_handler(pgfault);
+  801dcc:	68 e9 19 80 00       	push   $0x8019e9
+  801dd1:	e8 3f 17 00 00       	call   803515 <set_pgfault_handler>
+	if ((pid = sys_fork()) < 0)
+  801dd6:	e8 7a f6 ff ff       	call   801455 <sys_fork>
+  801ddb:	89 c3                	mov    %eax,%ebx
+  801ddd:	83 c4 10             	add    $0x10,%esp
+  801de0:	85 c0                	test   %eax,%eax
+  801de2:	78 09                	js     801ded <fork+0x28>
+	if (pid == 0)
+  801de4:	74 1c                	je     801e02 <fork+0x3d>
+}
+  801de6:	89 d8                	mov    %ebx,%eax
+  801de8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801deb:	c9                   	leave
+  801dec:	c3                   	ret
+		panic("cannot fork: %e", pid);
+  801ded:	50                   	push   %eax
+  801dee:	68 49 3b 80 00       	push   $0x803b49
+  801df3:	68 ed 00 00 00       	push   $0xed
+  801df8:	68 25 3b 80 00       	push   $0x803b25
+  801dfd:	e8 bd e4 ff ff       	call   8002bf <_panic>
+		mainenv = &envs[ENVX(sys_getenvid())];
+  801e02:	e8 47 f0 ff ff       	call   800e4e <sys_getenvid>
+  801e07:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801e0c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e12:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801e17:	a3 08 50 80 00       	mov    %eax,0x805008
+	return pid;
+  801e1c:	eb c8                	jmp    801de6 <fork+0x21>
+
+00801e1e <sfork>:
+//
+// Returns the thread's envid, or < 0 on error.
+//
+envid_t
+sfork(void (*func)(void *), void *arg)
+{
+  801e1e:	55                   	push   %ebp
+  801e1f:	89 e5                	mov    %esp,%ebp
+  801e21:	83 ec 0c             	sub    $0xc,%esp
+	return sys_thread_create(thread_main, (uint32_t) func, (uint32_t) arg);
+  801e24:	ff 75 0c             	push   0xc(%ebp)
+  801e27:	ff 75 08             	push   0x8(%ebp)
+  801e2a:	68 aa 1a 80 00       	push   $0x801aaa
+  801e2f:	e8 67 f6 ff ff       	call   80149b <sys_thread_create>
+}
+  801e34:	c9                   	leave
+  801e35:	c3                   	ret
+
+00801e36 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  801e36:	55                   	push   %ebp
+  801e37:	89 e5                	mov    %esp,%ebp
+  801e39:	56                   	push   %esi
+  801e3a:	53                   	push   %ebx
+  801e3b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801e4b:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  801e4e:	83 ec 08             	sub    $0x8,%esp
+  801e51:	ff 75 14             	push   0x14(%ebp)
+  801e54:	50                   	push   %eax
+  801e55:	e8 91 f4 ff ff       	call   8012eb <sys_ipc_recv_until>
+  801e5a:	83 c4 10             	add    $0x10,%esp
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	78 61                	js     801ec2 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  801e61:	85 f6                	test   %esi,%esi
+  801e63:	74 1c                	je     801e81 <ipc_recv_until+0x4b>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801e65:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e67:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e6c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e72:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e77:	76 5f                	jbe    801ed8 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  801e79:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  801e7f:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  801e81:	85 db                	test   %ebx,%ebx
+  801e83:	74 1c                	je     801ea1 <ipc_recv_until+0x6b>
+  801e85:	89 e0                	mov    %esp,%eax
+  801e87:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e8c:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e92:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801e97:	76 50                	jbe    801ee9 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  801e99:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  801e9f:	89 03                	mov    %eax,(%ebx)
+  801ea1:	89 e0                	mov    %esp,%eax
+  801ea3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ea8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801eae:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801eb3:	76 45                	jbe    801efa <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  801eb5:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  801ebb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ebe:	5b                   	pop    %ebx
+  801ebf:	5e                   	pop    %esi
+  801ec0:	5d                   	pop    %ebp
+  801ec1:	c3                   	ret
+		if (from_env_store)
+  801ec2:	85 f6                	test   %esi,%esi
+  801ec4:	74 06                	je     801ecc <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  801ec6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  801ecc:	85 db                	test   %ebx,%ebx
+  801ece:	74 eb                	je     801ebb <ipc_recv_until+0x85>
+			*perm_store = 0;
+  801ed0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801ed6:	eb e3                	jmp    801ebb <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ed8:	c1 e8 10             	shr    $0x10,%eax
+  801edb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ee1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ee7:	eb 90                	jmp    801e79 <ipc_recv_until+0x43>
+  801ee9:	c1 e8 10             	shr    $0x10,%eax
+  801eec:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ef2:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ef8:	eb 9f                	jmp    801e99 <ipc_recv_until+0x63>
+  801efa:	c1 e8 10             	shr    $0x10,%eax
+  801efd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801f03:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801f09:	eb aa                	jmp    801eb5 <ipc_recv_until+0x7f>
+
+00801f0b <ipc_recv>:
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  801f11:	6a 00                	push   $0x0
+  801f13:	ff 75 10             	push   0x10(%ebp)
+  801f16:	ff 75 0c             	push   0xc(%ebp)
+  801f19:	ff 75 08             	push   0x8(%ebp)
+  801f1c:	e8 15 ff ff ff       	call   801e36 <ipc_recv_until>
+}
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+
+00801f23 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	57                   	push   %edi
+  801f27:	56                   	push   %esi
+  801f28:	53                   	push   %ebx
+  801f29:	83 ec 0c             	sub    $0xc,%esp
+  801f2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f2f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  801f35:	85 db                	test   %ebx,%ebx
+  801f37:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f3c:	0f 44 d8             	cmove  %eax,%ebx
+  801f3f:	eb 05                	jmp    801f46 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  801f41:	e8 4e ef ff ff       	call   800e94 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  801f46:	ff 75 14             	push   0x14(%ebp)
+  801f49:	53                   	push   %ebx
+  801f4a:	56                   	push   %esi
+  801f4b:	57                   	push   %edi
+  801f4c:	e8 e6 f2 ff ff       	call   801237 <sys_ipc_try_send>
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f57:	74 e8                	je     801f41 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	78 08                	js     801f65 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  801f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f60:	5b                   	pop    %ebx
+  801f61:	5e                   	pop    %esi
+  801f62:	5f                   	pop    %edi
+  801f63:	5d                   	pop    %ebp
+  801f64:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  801f65:	50                   	push   %eax
+  801f66:	68 90 3b 80 00       	push   $0x803b90
+  801f6b:	6a 4f                	push   $0x4f
+  801f6d:	68 a3 3b 80 00       	push   $0x803ba3
+  801f72:	e8 48 e3 ff ff       	call   8002bf <_panic>
+
+00801f77 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801f77:	55                   	push   %ebp
+  801f78:	89 e5                	mov    %esp,%ebp
+  801f7a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801f82:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  801f88:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801f8e:	8b 52 50             	mov    0x50(%edx),%edx
+  801f91:	39 ca                	cmp    %ecx,%edx
+  801f93:	74 11                	je     801fa6 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801f95:	83 c0 01             	add    $0x1,%eax
+  801f98:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801f9d:	75 e3                	jne    801f82 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa4:	eb 0e                	jmp    801fb4 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801fa6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801fac:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801fb1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801fb4:	5d                   	pop    %ebp
+  801fb5:	c3                   	ret
+
+00801fb6 <batch_init>:
+	op->bo_npages = npages;
+}
+
+void
+batch_init(struct Batch *b)
+{
+  801fb6:	55                   	push   %ebp
+  801fb7:	89 e5                	mov    %esp,%ebp
+  801fb9:	8b 45 08             	mov    0x8(%ebp),%eax
+	b->b_nops = 0;
+  801fbc:	c7 80 c0 01 00 00 00 	movl   $0x0,0x1c0(%eax)
+  801fc3:	00 00 00 
+	b->b_error = 0;
+  801fc6:	c7 80 c4 01 00 00 00 	movl   $0x0,0x1c4(%eax)
+  801fcd:	00 00 00 
+}
+  801fd0:	5d                   	pop    %ebp
+  801fd1:	c3                   	ret
+
+00801fd2 <batch_flush>:
+// the batch and everything queued until the next batch_init() is
+// dropped.
+// Returns 0 on success, or the first error.
+int
+batch_flush(struct Batch *b)
+{
+  801fd2:	55                   	push   %ebp
+  801fd3:	89 e5                	mov    %esp,%ebp
+  801fd5:	53                   	push   %ebx
+  801fd6:	83 ec 04             	sub    $0x4,%esp
+  801fd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (b->b_nops > 0 && b->b_error == 0) {
+  801fdc:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	7e 09                	jle    801fef <batch_flush+0x1d>
+  801fe6:	83 bb c4 01 00 00 00 	cmpl   $0x0,0x1c4(%ebx)
+  801fed:	74 15                	je     802004 <batch_flush+0x32>
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+			b->b_error = BATCH_FAILED_ERR(r);
+	}
+	b->b_nops = 0;
+  801fef:	c7 83 c0 01 00 00 00 	movl   $0x0,0x1c0(%ebx)
+  801ff6:	00 00 00 
+	return b->b_error;
+  801ff9:	8b 83 c4 01 00 00    	mov    0x1c4(%ebx),%eax
+}
+  801fff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802002:	c9                   	leave
+  802003:	c3                   	ret
+		if ((r = sys_batch(b->b_ops, b->b_nops)) < 0)
+  802004:	83 ec 08             	sub    $0x8,%esp
+  802007:	50                   	push   %eax
+  802008:	53                   	push   %ebx
+  802009:	e8 b2 f5 ff ff       	call   8015c0 <sys_batch>
+  80200e:	83 c4 10             	add    $0x10,%esp
+  802011:	85 c0                	test   %eax,%eax
+  802013:	79 da                	jns    801fef <batch_flush+0x1d>
+			b->b_error = BATCH_FAILED_ERR(r);
+  802015:	f7 d8                	neg    %eax
+  802017:	0f b6 c0             	movzbl %al,%eax
+  80201a:	f7 d8                	neg    %eax
+  80201c:	89 83 c4 01 00 00    	mov    %eax,0x1c4(%ebx)
+  802022:	eb cb                	jmp    801fef <batch_flush+0x1d>
+
+00802024 <batch_reserve>:
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	83 ec 08             	sub    $0x8,%esp
+  80202a:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (b->b_nops + nops > BATCH_MAXOPS)
+  80202d:	8b 82 c0 01 00 00    	mov    0x1c0(%edx),%eax
+  802033:	03 45 0c             	add    0xc(%ebp),%eax
+  802036:	83 f8 10             	cmp    $0x10,%eax
+  802039:	7f 02                	jg     80203d <batch_reserve+0x19>
+}
+  80203b:	c9                   	leave
+  80203c:	c3                   	ret
+		batch_flush(b);
+  80203d:	83 ec 0c             	sub    $0xc,%esp
+  802040:	52                   	push   %edx
+  802041:	e8 8c ff ff ff       	call   801fd2 <batch_flush>
+  802046:	83 c4 10             	add    $0x10,%esp
+}
+  802049:	eb f0                	jmp    80203b <batch_reserve+0x17>
+
+0080204b <batch_next>:
+{
+  80204b:	55                   	push   %ebp
+  80204c:	89 e5                	mov    %esp,%ebp
+  80204e:	53                   	push   %ebx
+  80204f:	83 ec 04             	sub    $0x4,%esp
+  802052:	89 c3                	mov    %eax,%ebx
+	if (b->b_nops == BATCH_MAXOPS)
+  802054:	83 b8 c0 01 00 00 10 	cmpl   $0x10,0x1c0(%eax)
+  80205b:	74 28                	je     802085 <batch_next+0x3a>
+	op = &b->b_ops[b->b_nops++];
+  80205d:	8b 83 c0 01 00 00    	mov    0x1c0(%ebx),%eax
+  802063:	8d 50 01             	lea    0x1(%eax),%edx
+  802066:	89 93 c0 01 00 00    	mov    %edx,0x1c0(%ebx)
+  80206c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80206f:	01 c3                	add    %eax,%ebx
+	memset(op, 0, sizeof(*op));
+  802071:	83 ec 04             	sub    $0x4,%esp
+  802074:	6a 1c                	push   $0x1c
+  802076:	6a 00                	push   $0x0
+  802078:	53                   	push   %ebx
+  802079:	e8 b5 ea ff ff       	call   800b33 <memset>
+}
+  80207e:	89 d8                	mov    %ebx,%eax
+  802080:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802083:	c9                   	leave
+  802084:	c3                   	ret
+		batch_flush(b);
+  802085:	83 ec 0c             	sub    $0xc,%esp
+  802088:	50                   	push   %eax
+  802089:	e8 44 ff ff ff       	call   801fd2 <batch_flush>
+  80208e:	83 c4 10             	add    $0x10,%esp
+  802091:	eb ca                	jmp    80205d <batch_next+0x12>
+
+00802093 <batch_page>:
+{
+  802093:	55                   	push   %ebp
+  802094:	89 e5                	mov    %esp,%ebp
+  802096:	57                   	push   %edi
+  802097:	56                   	push   %esi
+  802098:	53                   	push   %ebx
+  802099:	83 ec 1c             	sub    $0x1c,%esp
+  80209c:	89 d3                	mov    %edx,%ebx
+  80209e:	89 ce                	mov    %ecx,%esi
+	if (b->b_nops == 0)
+  8020a0:	8b 90 c0 01 00 00    	mov    0x1c0(%eax),%edx
+  8020a6:	85 d2                	test   %edx,%edx
+  8020a8:	74 50                	je     8020fa <batch_page+0x67>
+	if (op->bo_op == opcode && op->bo_srcenv == srcenv &&
+  8020aa:	6b ca 1c             	imul   $0x1c,%edx,%ecx
+  8020ad:	01 c1                	add    %eax,%ecx
+  8020af:	3b 59 e4             	cmp    -0x1c(%ecx),%ebx
+  8020b2:	75 46                	jne    8020fa <batch_page+0x67>
+  8020b4:	3b 71 e8             	cmp    -0x18(%ecx),%esi
+  8020b7:	75 41                	jne    8020fa <batch_page+0x67>
+  8020b9:	8b 79 f0             	mov    -0x10(%ecx),%edi
+  8020bc:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+  8020bf:	75 39                	jne    8020fa <batch_page+0x67>
+	op = &b->b_ops[b->b_nops - 1];
+  8020c1:	83 ea 01             	sub    $0x1,%edx
+  8020c4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020c7:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020ca:	8b 7c 38 18          	mov    0x18(%eax,%edi,1),%edi
+  8020ce:	39 7d 14             	cmp    %edi,0x14(%ebp)
+  8020d1:	75 27                	jne    8020fa <batch_page+0x67>
+	len = op->bo_npages * PGSIZE;
+  8020d3:	6b fa 1c             	imul   $0x1c,%edx,%edi
+  8020d6:	8b 7c 38 14          	mov    0x14(%eax,%edi,1),%edi
+  8020da:	89 fa                	mov    %edi,%edx
+  8020dc:	c1 e2 0c             	shl    $0xc,%edx
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020df:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  8020e2:	03 51 ec             	add    -0x14(%ecx),%edx
+	    op->bo_dstenv == dstenv && op->bo_perm == perm &&
+  8020e5:	39 55 08             	cmp    %edx,0x8(%ebp)
+  8020e8:	75 10                	jne    8020fa <batch_page+0x67>
+	    op->bo_srcva + len == srcva && op->bo_dstva + len == dstva)
+  8020ea:	6b 4d e4 1c          	imul   $0x1c,-0x1c(%ebp),%ecx
+  8020ee:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8020f1:	03 54 08 10          	add    0x10(%eax,%ecx,1),%edx
+  8020f5:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8020f8:	74 2a                	je     802124 <batch_page+0x91>
+	op = batch_next(b);
+  8020fa:	e8 4c ff ff ff       	call   80204b <batch_next>
+	op->bo_op = opcode;
+  8020ff:	89 18                	mov    %ebx,(%eax)
+	op->bo_srcenv = srcenv;
+  802101:	89 70 04             	mov    %esi,0x4(%eax)
+	op->bo_srcva = srcva;
+  802104:	8b 75 08             	mov    0x8(%ebp),%esi
+  802107:	89 70 08             	mov    %esi,0x8(%eax)
+	op->bo_dstenv = dstenv;
+  80210a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80210d:	89 58 0c             	mov    %ebx,0xc(%eax)
+	op->bo_dstva = dstva;
+  802110:	8b 75 10             	mov    0x10(%ebp),%esi
+  802113:	89 70 10             	mov    %esi,0x10(%eax)
+	op->bo_perm = perm;
+  802116:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  802119:	89 58 18             	mov    %ebx,0x18(%eax)
+	op->bo_npages = npages;
+  80211c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80211f:	89 78 14             	mov    %edi,0x14(%eax)
+  802122:	eb 0b                	jmp    80212f <batch_page+0x9c>
+		op->bo_npages += npages;
+  802124:	6b 55 e4 1c          	imul   $0x1c,-0x1c(%ebp),%edx
+  802128:	03 7d 18             	add    0x18(%ebp),%edi
+  80212b:	89 7c 10 14          	mov    %edi,0x14(%eax,%edx,1)
+}
+  80212f:	83 c4 1c             	add    $0x1c,%esp
+  802132:	5b                   	pop    %ebx
+  802133:	5e                   	pop    %esi
+  802134:	5f                   	pop    %edi
+  802135:	5d                   	pop    %ebp
+  802136:	c3                   	ret
+
+00802137 <batch_alloc>:
+{
+  802137:	55                   	push   %ebp
+  802138:	89 e5                	mov    %esp,%ebp
+  80213a:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_ALLOC, 0, 0, env, va, perm, npages);
+  80213d:	ff 75 18             	push   0x18(%ebp)
+  802140:	ff 75 14             	push   0x14(%ebp)
+  802143:	ff 75 10             	push   0x10(%ebp)
+  802146:	ff 75 0c             	push   0xc(%ebp)
+  802149:	6a 00                	push   $0x0
+  80214b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802150:	ba 00 00 00 00       	mov    $0x0,%edx
+  802155:	8b 45 08             	mov    0x8(%ebp),%eax
+  802158:	e8 36 ff ff ff       	call   802093 <batch_page>
+}
+  80215d:	83 c4 20             	add    $0x20,%esp
+  802160:	c9                   	leave
+  802161:	c3                   	ret
+
+00802162 <batch_map>:
+{
+  802162:	55                   	push   %ebp
+  802163:	89 e5                	mov    %esp,%ebp
+  802165:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_MAP, srcenv, srcva, dstenv, dstva, perm,
+  802168:	ff 75 20             	push   0x20(%ebp)
+  80216b:	ff 75 1c             	push   0x1c(%ebp)
+  80216e:	ff 75 18             	push   0x18(%ebp)
+  802171:	ff 75 14             	push   0x14(%ebp)
+  802174:	ff 75 10             	push   0x10(%ebp)
+  802177:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80217a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80217f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802182:	e8 0c ff ff ff       	call   802093 <batch_page>
+}
+  802187:	83 c4 20             	add    $0x20,%esp
+  80218a:	c9                   	leave
+  80218b:	c3                   	ret
+
+0080218c <batch_unmap>:
+{
+  80218c:	55                   	push   %ebp
+  80218d:	89 e5                	mov    %esp,%ebp
+  80218f:	83 ec 14             	sub    $0x14,%esp
+	batch_page(b, BATCH_PAGE_UNMAP, 0, 0, env, va, 0, npages);
+  802192:	ff 75 14             	push   0x14(%ebp)
+  802195:	6a 00                	push   $0x0
+  802197:	ff 75 10             	push   0x10(%ebp)
+  80219a:	ff 75 0c             	push   0xc(%ebp)
+  80219d:	6a 00                	push   $0x0
+  80219f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a4:	ba 02 00 00 00       	mov    $0x2,%edx
+  8021a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ac:	e8 e2 fe ff ff       	call   802093 <batch_page>
+}
+  8021b1:	83 c4 20             	add    $0x20,%esp
+  8021b4:	c9                   	leave
+  8021b5:	c3                   	ret
+
+008021b6 <batch_set_status>:
+{
+  8021b6:	55                   	push   %ebp
+  8021b7:	89 e5                	mov    %esp,%ebp
+  8021b9:	83 ec 08             	sub    $0x8,%esp
+	struct BatchOp *op = batch_next(b);
+  8021bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bf:	e8 87 fe ff ff       	call   80204b <batch_next>
+	op->bo_op = BATCH_ENV_SET_STATUS;
+  8021c4:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	op->bo_dstenv = env;
+  8021ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021cd:	89 50 0c             	mov    %edx,0xc(%eax)
+	op->bo_perm = status;
+  8021d0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021d3:	89 50 18             	mov    %edx,0x18(%eax)
+}
+  8021d6:	c9                   	leave
+  8021d7:	c3                   	ret
+
+008021d8 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8021d8:	55                   	push   %ebp
+  8021d9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021de:	05 00 00 00 30       	add    $0x30000000,%eax
+  8021e3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8021e6:	5d                   	pop    %ebp
+  8021e7:	c3                   	ret
+
+008021e8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8021e8:	55                   	push   %ebp
+  8021e9:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ee:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8021f3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8021f8:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8021fd:	5d                   	pop    %ebp
+  8021fe:	c3                   	ret
+
+008021ff <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8021ff:	55                   	push   %ebp
+  802200:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802202:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  802207:	eb 02                	jmp    80220b <fd_alloc+0xc>
+  802209:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80220b:	89 c2                	mov    %eax,%edx
+  80220d:	c1 ea 16             	shr    $0x16,%edx
+  802210:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802217:	f6 c2 01             	test   $0x1,%dl
+  80221a:	74 2b                	je     802247 <fd_alloc+0x48>
+  80221c:	89 c2                	mov    %eax,%edx
+  80221e:	c1 ea 0c             	shr    $0xc,%edx
+  802221:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  802228:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80222e:	f6 c1 01             	test   $0x1,%cl
+  802231:	74 14                	je     802247 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  802233:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  802239:	75 ce                	jne    802209 <fd_alloc+0xa>
+  80223b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  802240:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  802245:	eb 05                	jmp    80224c <fd_alloc+0x4d>
+			return 0;
+  802247:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80224c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80224f:	89 02                	mov    %eax,(%edx)
+}
+  802251:	89 c8                	mov    %ecx,%eax
+  802253:	5d                   	pop    %ebp
+  802254:	c3                   	ret
+
+00802255 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802255:	55                   	push   %ebp
+  802256:	89 e5                	mov    %esp,%ebp
+  802258:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80225b:	83 f8 1f             	cmp    $0x1f,%eax
+  80225e:	77 30                	ja     802290 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  802260:	c1 e0 0c             	shl    $0xc,%eax
+  802263:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802268:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80226e:	f6 c2 01             	test   $0x1,%dl
+  802271:	74 24                	je     802297 <fd_lookup+0x42>
+  802273:	89 c2                	mov    %eax,%edx
+  802275:	c1 ea 0c             	shr    $0xc,%edx
+  802278:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80227f:	f6 c2 01             	test   $0x1,%dl
+  802282:	74 1a                	je     80229e <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802284:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802287:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802289:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80228e:	5d                   	pop    %ebp
+  80228f:	c3                   	ret
+		return -E_INVAL;
+  802290:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802295:	eb f7                	jmp    80228e <fd_lookup+0x39>
+		return -E_INVAL;
+  802297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80229c:	eb f0                	jmp    80228e <fd_lookup+0x39>
+  80229e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a3:	eb e9                	jmp    80228e <fd_lookup+0x39>
+
+008022a5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8022a5:	55                   	push   %ebp
+  8022a6:	89 e5                	mov    %esp,%ebp
+  8022a8:	53                   	push   %ebx
+  8022a9:	83 ec 04             	sub    $0x4,%esp
+  8022ac:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8022af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b4:	eb 03                	jmp    8022b9 <dev_lookup+0x14>
+  8022b6:	83 c0 01             	add    $0x1,%eax
+  8022b9:	8b 1c 85 2c 3c 80 00 	mov    0x803c2c(,%eax,4),%ebx
+  8022c0:	85 db                	test   %ebx,%ebx
+  8022c2:	74 0b                	je     8022cf <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8022c4:	39 13                	cmp    %edx,(%ebx)
+  8022c6:	75 ee                	jne    8022b6 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8022c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cd:	eb 2e                	jmp    8022fd <dev_lookup+0x58>
+  8022cf:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022d1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8022d6:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8022dc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8022e1:	76 24                	jbe    802307 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022e3:	8b 41 48             	mov    0x48(%ecx),%eax
+  8022e6:	83 ec 04             	sub    $0x4,%esp
+  8022e9:	52                   	push   %edx
+  8022ea:	50                   	push   %eax
+  8022eb:	68 b0 3b 80 00       	push   $0x803bb0
+  8022f0:	e8 a5 e0 ff ff       	call   80039a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8022f5:	83 c4 10             	add    $0x10,%esp
+  8022f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8022fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802300:	89 1a                	mov    %ebx,(%edx)
+}
+  802302:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802305:	c9                   	leave
+  802306:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802307:	c1 e8 10             	shr    $0x10,%eax
+  80230a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802310:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802316:	eb cb                	jmp    8022e3 <dev_lookup+0x3e>
+
+00802318 <fd_close>:
+{
+  802318:	55                   	push   %ebp
+  802319:	89 e5                	mov    %esp,%ebp
+  80231b:	57                   	push   %edi
+  80231c:	56                   	push   %esi
+  80231d:	53                   	push   %ebx
+  80231e:	83 ec 24             	sub    $0x24,%esp
+  802321:	8b 75 08             	mov    0x8(%ebp),%esi
+  802324:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802327:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80232a:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80232b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802331:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802334:	50                   	push   %eax
+  802335:	e8 1b ff ff ff       	call   802255 <fd_lookup>
+  80233a:	89 c3                	mov    %eax,%ebx
+  80233c:	83 c4 10             	add    $0x10,%esp
+  80233f:	85 c0                	test   %eax,%eax
+  802341:	78 05                	js     802348 <fd_close+0x30>
+	    || fd != fd2)
+  802343:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  802346:	74 16                	je     80235e <fd_close+0x46>
+		return (must_exist ? r : 0);
+  802348:	89 f8                	mov    %edi,%eax
+  80234a:	84 c0                	test   %al,%al
+  80234c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802351:	0f 44 d8             	cmove  %eax,%ebx
+}
+  802354:	89 d8                	mov    %ebx,%eax
+  802356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802359:	5b                   	pop    %ebx
+  80235a:	5e                   	pop    %esi
+  80235b:	5f                   	pop    %edi
+  80235c:	5d                   	pop    %ebp
+  80235d:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80235e:	83 ec 08             	sub    $0x8,%esp
+  802361:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802364:	50                   	push   %eax
+  802365:	ff 36                	push   (%esi)
+  802367:	e8 39 ff ff ff       	call   8022a5 <dev_lookup>
+  80236c:	89 c3                	mov    %eax,%ebx
+  80236e:	83 c4 10             	add    $0x10,%esp
+  802371:	85 c0                	test   %eax,%eax
+  802373:	78 1a                	js     80238f <fd_close+0x77>
+		if (dev->dev_close)
+  802375:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802378:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80237b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  802380:	85 c0                	test   %eax,%eax
+  802382:	74 0b                	je     80238f <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  802384:	83 ec 0c             	sub    $0xc,%esp
+  802387:	56                   	push   %esi
+  802388:	ff d0                	call   *%eax
+  80238a:	89 c3                	mov    %eax,%ebx
+  80238c:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80238f:	83 ec 08             	sub    $0x8,%esp
+  802392:	56                   	push   %esi
+  802393:	6a 00                	push   $0x0
+  802395:	e8 1b ec ff ff       	call   800fb5 <sys_page_unmap>
+	return r;
+  80239a:	83 c4 10             	add    $0x10,%esp
+  80239d:	eb b5                	jmp    802354 <fd_close+0x3c>
+
+0080239f <close>:
+
+int
+close(int fdnum)
+{
+  80239f:	55                   	push   %ebp
+  8023a0:	89 e5                	mov    %esp,%ebp
+  8023a2:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a8:	50                   	push   %eax
+  8023a9:	ff 75 08             	push   0x8(%ebp)
+  8023ac:	e8 a4 fe ff ff       	call   802255 <fd_lookup>
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	79 02                	jns    8023ba <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8023b8:	c9                   	leave
+  8023b9:	c3                   	ret
+		return fd_close(fd, 1);
+  8023ba:	83 ec 08             	sub    $0x8,%esp
+  8023bd:	6a 01                	push   $0x1
+  8023bf:	ff 75 f4             	push   -0xc(%ebp)
+  8023c2:	e8 51 ff ff ff       	call   802318 <fd_close>
+  8023c7:	83 c4 10             	add    $0x10,%esp
+  8023ca:	eb ec                	jmp    8023b8 <close+0x19>
+
+008023cc <close_all>:
+
+void
+close_all(void)
+{
+  8023cc:	55                   	push   %ebp
+  8023cd:	89 e5                	mov    %esp,%ebp
+  8023cf:	53                   	push   %ebx
+  8023d0:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8023d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8023d8:	83 ec 0c             	sub    $0xc,%esp
+  8023db:	53                   	push   %ebx
+  8023dc:	e8 be ff ff ff       	call   80239f <close>
+	for (i = 0; i < MAXFD; i++)
+  8023e1:	83 c3 01             	add    $0x1,%ebx
+  8023e4:	83 c4 10             	add    $0x10,%esp
+  8023e7:	83 fb 20             	cmp    $0x20,%ebx
+  8023ea:	75 ec                	jne    8023d8 <close_all+0xc>
+}
+  8023ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023ef:	c9                   	leave
+  8023f0:	c3                   	ret
+
+008023f1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8023f1:	55                   	push   %ebp
+  8023f2:	89 e5                	mov    %esp,%ebp
+  8023f4:	57                   	push   %edi
+  8023f5:	56                   	push   %esi
+  8023f6:	53                   	push   %ebx
+  8023f7:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8023fa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023fd:	50                   	push   %eax
+  8023fe:	ff 75 08             	push   0x8(%ebp)
+  802401:	e8 4f fe ff ff       	call   802255 <fd_lookup>
+  802406:	89 c3                	mov    %eax,%ebx
+  802408:	83 c4 10             	add    $0x10,%esp
+  80240b:	85 c0                	test   %eax,%eax
+  80240d:	78 7f                	js     80248e <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80240f:	83 ec 0c             	sub    $0xc,%esp
+  802412:	ff 75 0c             	push   0xc(%ebp)
+  802415:	e8 85 ff ff ff       	call   80239f <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80241a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80241d:	c1 e6 0c             	shl    $0xc,%esi
+  802420:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802426:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802429:	89 3c 24             	mov    %edi,(%esp)
+  80242c:	e8 b7 fd ff ff       	call   8021e8 <fd2data>
+  802431:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802433:	89 34 24             	mov    %esi,(%esp)
+  802436:	e8 ad fd ff ff       	call   8021e8 <fd2data>
+  80243b:	83 c4 10             	add    $0x10,%esp
+  80243e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802441:	89 d8                	mov    %ebx,%eax
+  802443:	c1 e8 16             	shr    $0x16,%eax
+  802446:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80244d:	a8 01                	test   $0x1,%al
+  80244f:	74 11                	je     802462 <dup+0x71>
+  802451:	89 d8                	mov    %ebx,%eax
+  802453:	c1 e8 0c             	shr    $0xc,%eax
+  802456:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80245d:	f6 c2 01             	test   $0x1,%dl
+  802460:	75 36                	jne    802498 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802462:	89 f8                	mov    %edi,%eax
+  802464:	c1 e8 0c             	shr    $0xc,%eax
+  802467:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80246e:	83 ec 0c             	sub    $0xc,%esp
+  802471:	25 07 0e 00 00       	and    $0xe07,%eax
+  802476:	50                   	push   %eax
+  802477:	56                   	push   %esi
+  802478:	6a 00                	push   $0x0
+  80247a:	57                   	push   %edi
+  80247b:	6a 00                	push   $0x0
+  80247d:	e8 c5 ea ff ff       	call   800f47 <sys_page_map>
+  802482:	89 c3                	mov    %eax,%ebx
+  802484:	83 c4 20             	add    $0x20,%esp
+  802487:	85 c0                	test   %eax,%eax
+  802489:	78 33                	js     8024be <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  80248b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80248e:	89 d8                	mov    %ebx,%eax
+  802490:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802493:	5b                   	pop    %ebx
+  802494:	5e                   	pop    %esi
+  802495:	5f                   	pop    %edi
+  802496:	5d                   	pop    %ebp
+  802497:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802498:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80249f:	83 ec 0c             	sub    $0xc,%esp
+  8024a2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8024a7:	50                   	push   %eax
+  8024a8:	ff 75 d4             	push   -0x2c(%ebp)
+  8024ab:	6a 00                	push   $0x0
+  8024ad:	53                   	push   %ebx
+  8024ae:	6a 00                	push   $0x0
+  8024b0:	e8 92 ea ff ff       	call   800f47 <sys_page_map>
+  8024b5:	89 c3                	mov    %eax,%ebx
+  8024b7:	83 c4 20             	add    $0x20,%esp
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	79 a4                	jns    802462 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8024be:	83 ec 08             	sub    $0x8,%esp
+  8024c1:	56                   	push   %esi
+  8024c2:	6a 00                	push   $0x0
+  8024c4:	e8 ec ea ff ff       	call   800fb5 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8024c9:	83 c4 08             	add    $0x8,%esp
+  8024cc:	ff 75 d4             	push   -0x2c(%ebp)
+  8024cf:	6a 00                	push   $0x0
+  8024d1:	e8 df ea ff ff       	call   800fb5 <sys_page_unmap>
+	return r;
+  8024d6:	83 c4 10             	add    $0x10,%esp
+  8024d9:	eb b3                	jmp    80248e <dup+0x9d>
+
+008024db <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8024db:	55                   	push   %ebp
+  8024dc:	89 e5                	mov    %esp,%ebp
+  8024de:	56                   	push   %esi
+  8024df:	53                   	push   %ebx
+  8024e0:	83 ec 18             	sub    $0x18,%esp
+  8024e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8024e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024e9:	50                   	push   %eax
+  8024ea:	53                   	push   %ebx
+  8024eb:	e8 65 fd ff ff       	call   802255 <fd_lookup>
+  8024f0:	83 c4 10             	add    $0x10,%esp
+  8024f3:	85 c0                	test   %eax,%eax
+  8024f5:	78 3c                	js     802533 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8024f7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8024fa:	83 ec 08             	sub    $0x8,%esp
+  8024fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802500:	50                   	push   %eax
+  802501:	ff 36                	push   (%esi)
+  802503:	e8 9d fd ff ff       	call   8022a5 <dev_lookup>
+  802508:	83 c4 10             	add    $0x10,%esp
+  80250b:	85 c0                	test   %eax,%eax
+  80250d:	78 24                	js     802533 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80250f:	8b 46 08             	mov    0x8(%esi),%eax
+  802512:	83 e0 03             	and    $0x3,%eax
+  802515:	83 f8 01             	cmp    $0x1,%eax
+  802518:	74 20                	je     80253a <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80251a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80251d:	8b 40 08             	mov    0x8(%eax),%eax
+  802520:	85 c0                	test   %eax,%eax
+  802522:	74 57                	je     80257b <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802524:	83 ec 04             	sub    $0x4,%esp
+  802527:	ff 75 10             	push   0x10(%ebp)
+  80252a:	ff 75 0c             	push   0xc(%ebp)
+  80252d:	56                   	push   %esi
+  80252e:	ff d0                	call   *%eax
+  802530:	83 c4 10             	add    $0x10,%esp
+}
+  802533:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802536:	5b                   	pop    %ebx
+  802537:	5e                   	pop    %esi
+  802538:	5d                   	pop    %ebp
+  802539:	c3                   	ret
+  80253a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80253c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802541:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802547:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80254c:	76 1c                	jbe    80256a <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80254e:	8b 42 48             	mov    0x48(%edx),%eax
+  802551:	83 ec 04             	sub    $0x4,%esp
+  802554:	53                   	push   %ebx
+  802555:	50                   	push   %eax
+  802556:	68 f1 3b 80 00       	push   $0x803bf1
+  80255b:	e8 3a de ff ff       	call   80039a <cprintf>
+		return -E_INVAL;
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802568:	eb c9                	jmp    802533 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80256a:	c1 e8 10             	shr    $0x10,%eax
+  80256d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802573:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802579:	eb d3                	jmp    80254e <read+0x73>
+		return -E_NOT_SUPP;
+  80257b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802580:	eb b1                	jmp    802533 <read+0x58>
+
+00802582 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802582:	55                   	push   %ebp
+  802583:	89 e5                	mov    %esp,%ebp
+  802585:	57                   	push   %edi
+  802586:	56                   	push   %esi
+  802587:	53                   	push   %ebx
+  802588:	83 ec 0c             	sub    $0xc,%esp
+  80258b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80258e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802591:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802596:	eb 02                	jmp    80259a <readn+0x18>
+  802598:	01 c3                	add    %eax,%ebx
+  80259a:	39 f3                	cmp    %esi,%ebx
+  80259c:	73 21                	jae    8025bf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80259e:	83 ec 04             	sub    $0x4,%esp
+  8025a1:	89 f0                	mov    %esi,%eax
+  8025a3:	29 d8                	sub    %ebx,%eax
+  8025a5:	50                   	push   %eax
+  8025a6:	89 d8                	mov    %ebx,%eax
+  8025a8:	03 45 0c             	add    0xc(%ebp),%eax
+  8025ab:	50                   	push   %eax
+  8025ac:	57                   	push   %edi
+  8025ad:	e8 29 ff ff ff       	call   8024db <read>
+		if (m < 0)
+  8025b2:	83 c4 10             	add    $0x10,%esp
+  8025b5:	85 c0                	test   %eax,%eax
+  8025b7:	78 04                	js     8025bd <readn+0x3b>
+			return m;
+		if (m == 0)
+  8025b9:	75 dd                	jne    802598 <readn+0x16>
+  8025bb:	eb 02                	jmp    8025bf <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8025bd:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8025bf:	89 d8                	mov    %ebx,%eax
+  8025c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c4:	5b                   	pop    %ebx
+  8025c5:	5e                   	pop    %esi
+  8025c6:	5f                   	pop    %edi
+  8025c7:	5d                   	pop    %ebp
+  8025c8:	c3                   	ret
+
+008025c9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8025c9:	55                   	push   %ebp
+  8025ca:	89 e5                	mov    %esp,%ebp
+  8025cc:	56                   	push   %esi
+  8025cd:	53                   	push   %ebx
+  8025ce:	83 ec 18             	sub    $0x18,%esp
+  8025d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8025d4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025d7:	50                   	push   %eax
+  8025d8:	53                   	push   %ebx
+  8025d9:	e8 77 fc ff ff       	call   802255 <fd_lookup>
+  8025de:	83 c4 10             	add    $0x10,%esp
+  8025e1:	85 c0                	test   %eax,%eax
+  8025e3:	78 37                	js     80261c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8025e5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025e8:	83 ec 08             	sub    $0x8,%esp
+  8025eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025ee:	50                   	push   %eax
+  8025ef:	ff 36                	push   (%esi)
+  8025f1:	e8 af fc ff ff       	call   8022a5 <dev_lookup>
+  8025f6:	83 c4 10             	add    $0x10,%esp
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	78 1f                	js     80261c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025fd:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802601:	74 20                	je     802623 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802606:	8b 40 0c             	mov    0xc(%eax),%eax
+  802609:	85 c0                	test   %eax,%eax
+  80260b:	74 57                	je     802664 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80260d:	83 ec 04             	sub    $0x4,%esp
+  802610:	ff 75 10             	push   0x10(%ebp)
+  802613:	ff 75 0c             	push   0xc(%ebp)
+  802616:	56                   	push   %esi
+  802617:	ff d0                	call   *%eax
+  802619:	83 c4 10             	add    $0x10,%esp
+}
+  80261c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80261f:	5b                   	pop    %ebx
+  802620:	5e                   	pop    %esi
+  802621:	5d                   	pop    %ebp
+  802622:	c3                   	ret
+  802623:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802625:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80262a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802630:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802635:	76 1c                	jbe    802653 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802637:	8b 42 48             	mov    0x48(%edx),%eax
+  80263a:	83 ec 04             	sub    $0x4,%esp
+  80263d:	53                   	push   %ebx
+  80263e:	50                   	push   %eax
+  80263f:	68 0d 3c 80 00       	push   $0x803c0d
+  802644:	e8 51 dd ff ff       	call   80039a <cprintf>
+		return -E_INVAL;
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802651:	eb c9                	jmp    80261c <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802653:	c1 e8 10             	shr    $0x10,%eax
+  802656:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80265c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802662:	eb d3                	jmp    802637 <write+0x6e>
+		return -E_NOT_SUPP;
+  802664:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802669:	eb b1                	jmp    80261c <write+0x53>
+
+0080266b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80266b:	55                   	push   %ebp
+  80266c:	89 e5                	mov    %esp,%ebp
+  80266e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802671:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802674:	50                   	push   %eax
+  802675:	ff 75 08             	push   0x8(%ebp)
+  802678:	e8 d8 fb ff ff       	call   802255 <fd_lookup>
+  80267d:	83 c4 10             	add    $0x10,%esp
+  802680:	85 c0                	test   %eax,%eax
+  802682:	78 0e                	js     802692 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802684:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802687:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80268a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80268d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802692:	c9                   	leave
+  802693:	c3                   	ret
+
+00802694 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802694:	55                   	push   %ebp
+  802695:	89 e5                	mov    %esp,%ebp
+  802697:	56                   	push   %esi
+  802698:	53                   	push   %ebx
+  802699:	83 ec 18             	sub    $0x18,%esp
+  80269c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80269f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8026a2:	50                   	push   %eax
+  8026a3:	53                   	push   %ebx
+  8026a4:	e8 ac fb ff ff       	call   802255 <fd_lookup>
+  8026a9:	83 c4 10             	add    $0x10,%esp
+  8026ac:	85 c0                	test   %eax,%eax
+  8026ae:	78 34                	js     8026e4 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8026b0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8026b3:	83 ec 08             	sub    $0x8,%esp
+  8026b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026b9:	50                   	push   %eax
+  8026ba:	ff 36                	push   (%esi)
+  8026bc:	e8 e4 fb ff ff       	call   8022a5 <dev_lookup>
+  8026c1:	83 c4 10             	add    $0x10,%esp
+  8026c4:	85 c0                	test   %eax,%eax
+  8026c6:	78 1c                	js     8026e4 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026c8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8026cc:	74 1d                	je     8026eb <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8026ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d1:	8b 40 18             	mov    0x18(%eax),%eax
+  8026d4:	85 c0                	test   %eax,%eax
+  8026d6:	74 54                	je     80272c <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8026d8:	83 ec 08             	sub    $0x8,%esp
+  8026db:	ff 75 0c             	push   0xc(%ebp)
+  8026de:	56                   	push   %esi
+  8026df:	ff d0                	call   *%eax
+  8026e1:	83 c4 10             	add    $0x10,%esp
+}
+  8026e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026e7:	5b                   	pop    %ebx
+  8026e8:	5e                   	pop    %esi
+  8026e9:	5d                   	pop    %ebp
+  8026ea:	c3                   	ret
+  8026eb:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026ed:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026f2:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026f8:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026fd:	76 1c                	jbe    80271b <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  8026ff:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802702:	83 ec 04             	sub    $0x4,%esp
+  802705:	53                   	push   %ebx
+  802706:	50                   	push   %eax
+  802707:	68 d0 3b 80 00       	push   $0x803bd0
+  80270c:	e8 89 dc ff ff       	call   80039a <cprintf>
+		return -E_INVAL;
+  802711:	83 c4 10             	add    $0x10,%esp
+  802714:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802719:	eb c9                	jmp    8026e4 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80271b:	c1 e8 10             	shr    $0x10,%eax
+  80271e:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802724:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80272a:	eb d3                	jmp    8026ff <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  80272c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802731:	eb b1                	jmp    8026e4 <ftruncate+0x50>
+
+00802733 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802733:	55                   	push   %ebp
+  802734:	89 e5                	mov    %esp,%ebp
+  802736:	56                   	push   %esi
+  802737:	53                   	push   %ebx
+  802738:	83 ec 18             	sub    $0x18,%esp
+  80273b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80273e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802741:	50                   	push   %eax
+  802742:	ff 75 08             	push   0x8(%ebp)
+  802745:	e8 0b fb ff ff       	call   802255 <fd_lookup>
+  80274a:	83 c4 10             	add    $0x10,%esp
+  80274d:	85 c0                	test   %eax,%eax
+  80274f:	78 49                	js     80279a <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802751:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802754:	83 ec 08             	sub    $0x8,%esp
+  802757:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80275a:	50                   	push   %eax
+  80275b:	ff 36                	push   (%esi)
+  80275d:	e8 43 fb ff ff       	call   8022a5 <dev_lookup>
+  802762:	83 c4 10             	add    $0x10,%esp
+  802765:	85 c0                	test   %eax,%eax
+  802767:	78 31                	js     80279a <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802769:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80276c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802770:	74 2f                	je     8027a1 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802772:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802775:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80277c:	00 00 00 
+	stat->st_isdir = 0;
+  80277f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802786:	00 00 00 
+	stat->st_dev = dev;
+  802789:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80278f:	83 ec 08             	sub    $0x8,%esp
+  802792:	53                   	push   %ebx
+  802793:	56                   	push   %esi
+  802794:	ff 50 14             	call   *0x14(%eax)
+  802797:	83 c4 10             	add    $0x10,%esp
+}
+  80279a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80279d:	5b                   	pop    %ebx
+  80279e:	5e                   	pop    %esi
+  80279f:	5d                   	pop    %ebp
+  8027a0:	c3                   	ret
+		return -E_NOT_SUPP;
+  8027a1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8027a6:	eb f2                	jmp    80279a <fstat+0x67>
+
+008027a8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8027a8:	55                   	push   %ebp
+  8027a9:	89 e5                	mov    %esp,%ebp
+  8027ab:	56                   	push   %esi
+  8027ac:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8027ad:	83 ec 08             	sub    $0x8,%esp
+  8027b0:	6a 00                	push   $0x0
+  8027b2:	ff 75 08             	push   0x8(%ebp)
+  8027b5:	e8 e4 01 00 00       	call   80299e <open>
+  8027ba:	89 c3                	mov    %eax,%ebx
+  8027bc:	83 c4 10             	add    $0x10,%esp
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	78 1b                	js     8027de <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8027c3:	83 ec 08             	sub    $0x8,%esp
+  8027c6:	ff 75 0c             	push   0xc(%ebp)
+  8027c9:	50                   	push   %eax
+  8027ca:	e8 64 ff ff ff       	call   802733 <fstat>
+  8027cf:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8027d1:	89 1c 24             	mov    %ebx,(%esp)
+  8027d4:	e8 c6 fb ff ff       	call   80239f <close>
+	return r;
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	89 f3                	mov    %esi,%ebx
+}
+  8027de:	89 d8                	mov    %ebx,%eax
+  8027e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027e3:	5b                   	pop    %ebx
+  8027e4:	5e                   	pop    %esi
+  8027e5:	5d                   	pop    %ebp
+  8027e6:	c3                   	ret
+
+008027e7 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8027e7:	55                   	push   %ebp
+  8027e8:	89 e5                	mov    %esp,%ebp
+  8027ea:	56                   	push   %esi
+  8027eb:	53                   	push   %ebx
+  8027ec:	89 c6                	mov    %eax,%esi
+  8027ee:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8027f0:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  8027f7:	74 27                	je     802820 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8027f9:	6a 07                	push   $0x7
+  8027fb:	68 00 60 80 00       	push   $0x806000
+  802800:	56                   	push   %esi
+  802801:	ff 35 00 50 80 00    	push   0x805000
+  802807:	e8 17 f7 ff ff       	call   801f23 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80280c:	83 c4 0c             	add    $0xc,%esp
+  80280f:	6a 00                	push   $0x0
+  802811:	53                   	push   %ebx
+  802812:	6a 00                	push   $0x0
+  802814:	e8 f2 f6 ff ff       	call   801f0b <ipc_recv>
+}
+  802819:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80281c:	5b                   	pop    %ebx
+  80281d:	5e                   	pop    %esi
+  80281e:	5d                   	pop    %ebp
+  80281f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802820:	83 ec 0c             	sub    $0xc,%esp
+  802823:	6a 01                	push   $0x1
+  802825:	e8 4d f7 ff ff       	call   801f77 <ipc_find_env>
+  80282a:	a3 00 50 80 00       	mov    %eax,0x805000
+  80282f:	83 c4 10             	add    $0x10,%esp
+  802832:	eb c5                	jmp    8027f9 <fsipc+0x12>
+
+00802834 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802834:	55                   	push   %ebp
+  802835:	89 e5                	mov    %esp,%ebp
+  802837:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80283a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80283d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802840:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802845:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802848:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80284d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802852:	b8 02 00 00 00       	mov    $0x2,%eax
+  802857:	e8 8b ff ff ff       	call   8027e7 <fsipc>
+}
+  80285c:	c9                   	leave
+  80285d:	c3                   	ret
+
+0080285e <devfile_flush>:
+{
+  80285e:	55                   	push   %ebp
+  80285f:	89 e5                	mov    %esp,%ebp
+  802861:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802864:	8b 45 08             	mov    0x8(%ebp),%eax
+  802867:	8b 40 0c             	mov    0xc(%eax),%eax
+  80286a:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80286f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802874:	b8 06 00 00 00       	mov    $0x6,%eax
+  802879:	e8 69 ff ff ff       	call   8027e7 <fsipc>
+}
+  80287e:	c9                   	leave
+  80287f:	c3                   	ret
+
+00802880 <devfile_stat>:
+{
+  802880:	55                   	push   %ebp
+  802881:	89 e5                	mov    %esp,%ebp
+  802883:	53                   	push   %ebx
+  802884:	83 ec 04             	sub    $0x4,%esp
+  802887:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80288a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802890:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802895:	ba 00 00 00 00       	mov    $0x0,%edx
+  80289a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80289f:	e8 43 ff ff ff       	call   8027e7 <fsipc>
+  8028a4:	85 c0                	test   %eax,%eax
+  8028a6:	78 2c                	js     8028d4 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8028a8:	83 ec 08             	sub    $0x8,%esp
+  8028ab:	68 00 60 80 00       	push   $0x806000
+  8028b0:	53                   	push   %ebx
+  8028b1:	e8 2c e1 ff ff       	call   8009e2 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8028b6:	a1 80 60 80 00       	mov    0x806080,%eax
+  8028bb:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8028c1:	a1 84 60 80 00       	mov    0x806084,%eax
+  8028c6:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8028cc:	83 c4 10             	add    $0x10,%esp
+  8028cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028d7:	c9                   	leave
+  8028d8:	c3                   	ret
+
+008028d9 <devfile_write>:
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	83 ec 0c             	sub    $0xc,%esp
+  8028df:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028e5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8028e8:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  8028ee:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8028f3:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8028f8:	39 d0                	cmp    %edx,%eax
+  8028fa:	0f 47 c2             	cmova  %edx,%eax
+  8028fd:	50                   	push   %eax
+  8028fe:	ff 75 0c             	push   0xc(%ebp)
+  802901:	68 08 60 80 00       	push   $0x806008
+  802906:	e8 5d e2 ff ff       	call   800b68 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80290b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802910:	b8 04 00 00 00       	mov    $0x4,%eax
+  802915:	e8 cd fe ff ff       	call   8027e7 <fsipc>
+}
+  80291a:	c9                   	leave
+  80291b:	c3                   	ret
+
+0080291c <devfile_read>:
+{
+  80291c:	55                   	push   %ebp
+  80291d:	89 e5                	mov    %esp,%ebp
+  80291f:	56                   	push   %esi
+  802920:	53                   	push   %ebx
+  802921:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802924:	8b 45 08             	mov    0x8(%ebp),%eax
+  802927:	8b 40 0c             	mov    0xc(%eax),%eax
+  80292a:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  80292f:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80293a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80293f:	e8 a3 fe ff ff       	call   8027e7 <fsipc>
+  802944:	89 c3                	mov    %eax,%ebx
+  802946:	85 c0                	test   %eax,%eax
+  802948:	78 1f                	js     802969 <devfile_read+0x4d>
+	assert(r <= n);
+  80294a:	39 c6                	cmp    %eax,%esi
+  80294c:	72 24                	jb     802972 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  80294e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802953:	7f 33                	jg     802988 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802955:	83 ec 04             	sub    $0x4,%esp
+  802958:	50                   	push   %eax
+  802959:	68 00 60 80 00       	push   $0x806000
+  80295e:	ff 75 0c             	push   0xc(%ebp)
+  802961:	e8 02 e2 ff ff       	call   800b68 <memmove>
+	return r;
+  802966:	83 c4 10             	add    $0x10,%esp
+}
+  802969:	89 d8                	mov    %ebx,%eax
+  80296b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80296e:	5b                   	pop    %ebx
+  80296f:	5e                   	pop    %esi
+  802970:	5d                   	pop    %ebp
+  802971:	c3                   	ret
+	assert(r <= n);
+  802972:	68 40 3c 80 00       	push   $0x803c40
+  802977:	68 10 3b 80 00       	push   $0x803b10
+  80297c:	6a 76                	push   $0x76
+  80297e:	68 47 3c 80 00       	push   $0x803c47
+  802983:	e8 37 d9 ff ff       	call   8002bf <_panic>
+	assert(r <= PGSIZE);
+  802988:	68 52 3c 80 00       	push   $0x803c52
+  80298d:	68 10 3b 80 00       	push   $0x803b10
+  802992:	6a 77                	push   $0x77
+  802994:	68 47 3c 80 00       	push   $0x803c47
+  802999:	e8 21 d9 ff ff       	call   8002bf <_panic>
+
+0080299e <open>:
+{
+  80299e:	55                   	push   %ebp
+  80299f:	89 e5                	mov    %esp,%ebp
+  8029a1:	56                   	push   %esi
+  8029a2:	53                   	push   %ebx
+  8029a3:	83 ec 1c             	sub    $0x1c,%esp
+  8029a6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8029a9:	56                   	push   %esi
+  8029aa:	e8 f8 df ff ff       	call   8009a7 <strlen>
+  8029af:	83 c4 10             	add    $0x10,%esp
+  8029b2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029b7:	7f 6c                	jg     802a25 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8029b9:	83 ec 0c             	sub    $0xc,%esp
+  8029bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029bf:	50                   	push   %eax
+  8029c0:	e8 3a f8 ff ff       	call   8021ff <fd_alloc>
+  8029c5:	89 c3                	mov    %eax,%ebx
+  8029c7:	83 c4 10             	add    $0x10,%esp
+  8029ca:	85 c0                	test   %eax,%eax
+  8029cc:	78 3c                	js     802a0a <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8029ce:	83 ec 08             	sub    $0x8,%esp
+  8029d1:	56                   	push   %esi
+  8029d2:	68 00 60 80 00       	push   $0x806000
+  8029d7:	e8 06 e0 ff ff       	call   8009e2 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8029dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029df:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8029e4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029ec:	e8 f6 fd ff ff       	call   8027e7 <fsipc>
+  8029f1:	89 c3                	mov    %eax,%ebx
+  8029f3:	83 c4 10             	add    $0x10,%esp
+  8029f6:	85 c0                	test   %eax,%eax
+  8029f8:	78 19                	js     802a13 <open+0x75>
+	return fd2num(fd);
+  8029fa:	83 ec 0c             	sub    $0xc,%esp
+  8029fd:	ff 75 f4             	push   -0xc(%ebp)
+  802a00:	e8 d3 f7 ff ff       	call   8021d8 <fd2num>
+  802a05:	89 c3                	mov    %eax,%ebx
+  802a07:	83 c4 10             	add    $0x10,%esp
+}
+  802a0a:	89 d8                	mov    %ebx,%eax
+  802a0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a0f:	5b                   	pop    %ebx
+  802a10:	5e                   	pop    %esi
+  802a11:	5d                   	pop    %ebp
+  802a12:	c3                   	ret
+		fd_close(fd, 0);
+  802a13:	83 ec 08             	sub    $0x8,%esp
+  802a16:	6a 00                	push   $0x0
+  802a18:	ff 75 f4             	push   -0xc(%ebp)
+  802a1b:	e8 f8 f8 ff ff       	call   802318 <fd_close>
+		return r;
+  802a20:	83 c4 10             	add    $0x10,%esp
+  802a23:	eb e5                	jmp    802a0a <open+0x6c>
+		return -E_BAD_PATH;
+  802a25:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802a2a:	eb de                	jmp    802a0a <open+0x6c>
+
+00802a2c <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a2c:	55                   	push   %ebp
+  802a2d:	89 e5                	mov    %esp,%ebp
+  802a2f:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a32:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a37:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a3c:	e8 a6 fd ff ff       	call   8027e7 <fsipc>
+}
+  802a41:	c9                   	leave
+  802a42:	c3                   	ret
+
+00802a43 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a43:	55                   	push   %ebp
+  802a44:	89 e5                	mov    %esp,%ebp
+  802a46:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802a49:	68 5e 3c 80 00       	push   $0x803c5e
+  802a4e:	ff 75 0c             	push   0xc(%ebp)
+  802a51:	e8 8c df ff ff       	call   8009e2 <strcpy>
+	return 0;
+}
+  802a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5b:	c9                   	leave
+  802a5c:	c3                   	ret
+
+00802a5d <devsock_close>:
+{
+  802a5d:	55                   	push   %ebp
+  802a5e:	89 e5                	mov    %esp,%ebp
+  802a60:	53                   	push   %ebx
+  802a61:	83 ec 10             	sub    $0x10,%esp
+  802a64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802a67:	53                   	push   %ebx
+  802a68:	e8 37 0b 00 00       	call   8035a4 <pageref>
+  802a6d:	89 c2                	mov    %eax,%edx
+  802a6f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802a72:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a77:	83 fa 01             	cmp    $0x1,%edx
+  802a7a:	74 05                	je     802a81 <devsock_close+0x24>
+}
+  802a7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a81:	83 ec 0c             	sub    $0xc,%esp
+  802a84:	ff 73 0c             	push   0xc(%ebx)
+  802a87:	e8 b7 02 00 00       	call   802d43 <nsipc_close>
+  802a8c:	83 c4 10             	add    $0x10,%esp
+  802a8f:	eb eb                	jmp    802a7c <devsock_close+0x1f>
+
+00802a91 <devsock_write>:
+{
+  802a91:	55                   	push   %ebp
+  802a92:	89 e5                	mov    %esp,%ebp
+  802a94:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802a97:	6a 00                	push   $0x0
+  802a99:	ff 75 10             	push   0x10(%ebp)
+  802a9c:	ff 75 0c             	push   0xc(%ebp)
+  802a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa2:	ff 70 0c             	push   0xc(%eax)
+  802aa5:	e8 79 03 00 00       	call   802e23 <nsipc_send>
+}
+  802aaa:	c9                   	leave
+  802aab:	c3                   	ret
+
+00802aac <devsock_read>:
+{
+  802aac:	55                   	push   %ebp
+  802aad:	89 e5                	mov    %esp,%ebp
+  802aaf:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ab2:	6a 00                	push   $0x0
+  802ab4:	ff 75 10             	push   0x10(%ebp)
+  802ab7:	ff 75 0c             	push   0xc(%ebp)
+  802aba:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abd:	ff 70 0c             	push   0xc(%eax)
+  802ac0:	e8 ef 02 00 00       	call   802db4 <nsipc_recv>
+}
+  802ac5:	c9                   	leave
+  802ac6:	c3                   	ret
+
+00802ac7 <fd2sockid>:
+{
+  802ac7:	55                   	push   %ebp
+  802ac8:	89 e5                	mov    %esp,%ebp
+  802aca:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802acd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ad0:	52                   	push   %edx
+  802ad1:	50                   	push   %eax
+  802ad2:	e8 7e f7 ff ff       	call   802255 <fd_lookup>
+  802ad7:	83 c4 10             	add    $0x10,%esp
+  802ada:	85 c0                	test   %eax,%eax
+  802adc:	78 10                	js     802aee <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802ade:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae1:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802ae7:	39 08                	cmp    %ecx,(%eax)
+  802ae9:	75 05                	jne    802af0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802aeb:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802aee:	c9                   	leave
+  802aef:	c3                   	ret
+		return -E_NOT_SUPP;
+  802af0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802af5:	eb f7                	jmp    802aee <fd2sockid+0x27>
+
+00802af7 <alloc_sockfd>:
+{
+  802af7:	55                   	push   %ebp
+  802af8:	89 e5                	mov    %esp,%ebp
+  802afa:	56                   	push   %esi
+  802afb:	53                   	push   %ebx
+  802afc:	83 ec 1c             	sub    $0x1c,%esp
+  802aff:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b04:	50                   	push   %eax
+  802b05:	e8 f5 f6 ff ff       	call   8021ff <fd_alloc>
+  802b0a:	89 c3                	mov    %eax,%ebx
+  802b0c:	83 c4 10             	add    $0x10,%esp
+  802b0f:	85 c0                	test   %eax,%eax
+  802b11:	78 43                	js     802b56 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b13:	83 ec 04             	sub    $0x4,%esp
+  802b16:	68 07 04 00 00       	push   $0x407
+  802b1b:	ff 75 f4             	push   -0xc(%ebp)
+  802b1e:	6a 00                	push   $0x0
+  802b20:	e8 b5 e3 ff ff       	call   800eda <sys_page_alloc>
+  802b25:	89 c3                	mov    %eax,%ebx
+  802b27:	83 c4 10             	add    $0x10,%esp
+  802b2a:	85 c0                	test   %eax,%eax
+  802b2c:	78 28                	js     802b56 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b31:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802b37:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b3c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b43:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b46:	83 ec 0c             	sub    $0xc,%esp
+  802b49:	50                   	push   %eax
+  802b4a:	e8 89 f6 ff ff       	call   8021d8 <fd2num>
+  802b4f:	89 c3                	mov    %eax,%ebx
+  802b51:	83 c4 10             	add    $0x10,%esp
+  802b54:	eb 0c                	jmp    802b62 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b56:	83 ec 0c             	sub    $0xc,%esp
+  802b59:	56                   	push   %esi
+  802b5a:	e8 e4 01 00 00       	call   802d43 <nsipc_close>
+		return r;
+  802b5f:	83 c4 10             	add    $0x10,%esp
+}
+  802b62:	89 d8                	mov    %ebx,%eax
+  802b64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b67:	5b                   	pop    %ebx
+  802b68:	5e                   	pop    %esi
+  802b69:	5d                   	pop    %ebp
+  802b6a:	c3                   	ret
+
+00802b6b <accept>:
+{
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802b71:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b74:	e8 4e ff ff ff       	call   802ac7 <fd2sockid>
+  802b79:	85 c0                	test   %eax,%eax
+  802b7b:	78 1b                	js     802b98 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802b7d:	83 ec 04             	sub    $0x4,%esp
+  802b80:	ff 75 10             	push   0x10(%ebp)
+  802b83:	ff 75 0c             	push   0xc(%ebp)
+  802b86:	50                   	push   %eax
+  802b87:	e8 0e 01 00 00       	call   802c9a <nsipc_accept>
+  802b8c:	83 c4 10             	add    $0x10,%esp
+  802b8f:	85 c0                	test   %eax,%eax
+  802b91:	78 05                	js     802b98 <accept+0x2d>
+	return alloc_sockfd(r);
+  802b93:	e8 5f ff ff ff       	call   802af7 <alloc_sockfd>
+}
+  802b98:	c9                   	leave
+  802b99:	c3                   	ret
+
+00802b9a <bind>:
+{
+  802b9a:	55                   	push   %ebp
+  802b9b:	89 e5                	mov    %esp,%ebp
+  802b9d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ba0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba3:	e8 1f ff ff ff       	call   802ac7 <fd2sockid>
+  802ba8:	85 c0                	test   %eax,%eax
+  802baa:	78 12                	js     802bbe <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802bac:	83 ec 04             	sub    $0x4,%esp
+  802baf:	ff 75 10             	push   0x10(%ebp)
+  802bb2:	ff 75 0c             	push   0xc(%ebp)
+  802bb5:	50                   	push   %eax
+  802bb6:	e8 31 01 00 00       	call   802cec <nsipc_bind>
+  802bbb:	83 c4 10             	add    $0x10,%esp
+}
+  802bbe:	c9                   	leave
+  802bbf:	c3                   	ret
+
+00802bc0 <shutdown>:
+{
+  802bc0:	55                   	push   %ebp
+  802bc1:	89 e5                	mov    %esp,%ebp
+  802bc3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc9:	e8 f9 fe ff ff       	call   802ac7 <fd2sockid>
+  802bce:	85 c0                	test   %eax,%eax
+  802bd0:	78 0f                	js     802be1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802bd2:	83 ec 08             	sub    $0x8,%esp
+  802bd5:	ff 75 0c             	push   0xc(%ebp)
+  802bd8:	50                   	push   %eax
+  802bd9:	e8 43 01 00 00       	call   802d21 <nsipc_shutdown>
+  802bde:	83 c4 10             	add    $0x10,%esp
+}
+  802be1:	c9                   	leave
+  802be2:	c3                   	ret
+
+00802be3 <connect>:
+{
+  802be3:	55                   	push   %ebp
+  802be4:	89 e5                	mov    %esp,%ebp
+  802be6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802be9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bec:	e8 d6 fe ff ff       	call   802ac7 <fd2sockid>
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	78 12                	js     802c07 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802bf5:	83 ec 04             	sub    $0x4,%esp
+  802bf8:	ff 75 10             	push   0x10(%ebp)
+  802bfb:	ff 75 0c             	push   0xc(%ebp)
+  802bfe:	50                   	push   %eax
+  802bff:	e8 59 01 00 00       	call   802d5d <nsipc_connect>
+  802c04:	83 c4 10             	add    $0x10,%esp
+}
+  802c07:	c9                   	leave
+  802c08:	c3                   	ret
+
+00802c09 <listen>:
+{
+  802c09:	55                   	push   %ebp
+  802c0a:	89 e5                	mov    %esp,%ebp
+  802c0c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c12:	e8 b0 fe ff ff       	call   802ac7 <fd2sockid>
+  802c17:	85 c0                	test   %eax,%eax
+  802c19:	78 0f                	js     802c2a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c1b:	83 ec 08             	sub    $0x8,%esp
+  802c1e:	ff 75 0c             	push   0xc(%ebp)
+  802c21:	50                   	push   %eax
+  802c22:	e8 6b 01 00 00       	call   802d92 <nsipc_listen>
+  802c27:	83 c4 10             	add    $0x10,%esp
+}
+  802c2a:	c9                   	leave
+  802c2b:	c3                   	ret
+
+00802c2c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802c2c:	55                   	push   %ebp
+  802c2d:	89 e5                	mov    %esp,%ebp
+  802c2f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802c32:	ff 75 10             	push   0x10(%ebp)
+  802c35:	ff 75 0c             	push   0xc(%ebp)
+  802c38:	ff 75 08             	push   0x8(%ebp)
+  802c3b:	e8 41 02 00 00       	call   802e81 <nsipc_socket>
+  802c40:	83 c4 10             	add    $0x10,%esp
+  802c43:	85 c0                	test   %eax,%eax
+  802c45:	78 05                	js     802c4c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802c47:	e8 ab fe ff ff       	call   802af7 <alloc_sockfd>
+}
+  802c4c:	c9                   	leave
+  802c4d:	c3                   	ret
+
+00802c4e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802c4e:	55                   	push   %ebp
+  802c4f:	89 e5                	mov    %esp,%ebp
+  802c51:	53                   	push   %ebx
+  802c52:	83 ec 04             	sub    $0x4,%esp
+  802c55:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802c57:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802c5e:	74 26                	je     802c86 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802c60:	6a 07                	push   $0x7
+  802c62:	68 00 70 80 00       	push   $0x807000
+  802c67:	53                   	push   %ebx
+  802c68:	ff 35 04 50 80 00    	push   0x805004
+  802c6e:	e8 b0 f2 ff ff       	call   801f23 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802c73:	83 c4 0c             	add    $0xc,%esp
+  802c76:	6a 00                	push   $0x0
+  802c78:	6a 00                	push   $0x0
+  802c7a:	6a 00                	push   $0x0
+  802c7c:	e8 8a f2 ff ff       	call   801f0b <ipc_recv>
+}
+  802c81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c84:	c9                   	leave
+  802c85:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c86:	83 ec 0c             	sub    $0xc,%esp
+  802c89:	6a 02                	push   $0x2
+  802c8b:	e8 e7 f2 ff ff       	call   801f77 <ipc_find_env>
+  802c90:	a3 04 50 80 00       	mov    %eax,0x805004
+  802c95:	83 c4 10             	add    $0x10,%esp
+  802c98:	eb c6                	jmp    802c60 <nsipc+0x12>
+
+00802c9a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802c9a:	55                   	push   %ebp
+  802c9b:	89 e5                	mov    %esp,%ebp
+  802c9d:	56                   	push   %esi
+  802c9e:	53                   	push   %ebx
+  802c9f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802caa:	8b 06                	mov    (%esi),%eax
+  802cac:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802cb1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cb6:	e8 93 ff ff ff       	call   802c4e <nsipc>
+  802cbb:	89 c3                	mov    %eax,%ebx
+  802cbd:	85 c0                	test   %eax,%eax
+  802cbf:	79 09                	jns    802cca <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802cc1:	89 d8                	mov    %ebx,%eax
+  802cc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802cc6:	5b                   	pop    %ebx
+  802cc7:	5e                   	pop    %esi
+  802cc8:	5d                   	pop    %ebp
+  802cc9:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802cca:	83 ec 04             	sub    $0x4,%esp
+  802ccd:	ff 35 10 70 80 00    	push   0x807010
+  802cd3:	68 00 70 80 00       	push   $0x807000
+  802cd8:	ff 75 0c             	push   0xc(%ebp)
+  802cdb:	e8 88 de ff ff       	call   800b68 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ce0:	a1 10 70 80 00       	mov    0x807010,%eax
+  802ce5:	89 06                	mov    %eax,(%esi)
+  802ce7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802cea:	eb d5                	jmp    802cc1 <nsipc_accept+0x27>
+
+00802cec <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802cec:	55                   	push   %ebp
+  802ced:	89 e5                	mov    %esp,%ebp
+  802cef:	53                   	push   %ebx
+  802cf0:	83 ec 08             	sub    $0x8,%esp
+  802cf3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf9:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802cfe:	53                   	push   %ebx
+  802cff:	ff 75 0c             	push   0xc(%ebp)
+  802d02:	68 04 70 80 00       	push   $0x807004
+  802d07:	e8 5c de ff ff       	call   800b68 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d0c:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802d12:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d17:	e8 32 ff ff ff       	call   802c4e <nsipc>
+}
+  802d1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d1f:	c9                   	leave
+  802d20:	c3                   	ret
+
+00802d21 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d21:	55                   	push   %ebp
+  802d22:	89 e5                	mov    %esp,%ebp
+  802d24:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d27:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d2a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802d2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d32:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d37:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d3c:	e8 0d ff ff ff       	call   802c4e <nsipc>
+}
+  802d41:	c9                   	leave
+  802d42:	c3                   	ret
+
+00802d43 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d43:	55                   	push   %ebp
+  802d44:	89 e5                	mov    %esp,%ebp
+  802d46:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d4c:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  802d51:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d56:	e8 f3 fe ff ff       	call   802c4e <nsipc>
+}
+  802d5b:	c9                   	leave
+  802d5c:	c3                   	ret
+
+00802d5d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d5d:	55                   	push   %ebp
+  802d5e:	89 e5                	mov    %esp,%ebp
+  802d60:	53                   	push   %ebx
+  802d61:	83 ec 08             	sub    $0x8,%esp
+  802d64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802d67:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6a:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d6f:	53                   	push   %ebx
+  802d70:	ff 75 0c             	push   0xc(%ebp)
+  802d73:	68 04 70 80 00       	push   $0x807004
+  802d78:	e8 eb dd ff ff       	call   800b68 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802d7d:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  802d83:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d88:	e8 c1 fe ff ff       	call   802c4e <nsipc>
+}
+  802d8d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d90:	c9                   	leave
+  802d91:	c3                   	ret
+
+00802d92 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d92:	55                   	push   %ebp
+  802d93:	89 e5                	mov    %esp,%ebp
+  802d95:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802d98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802da0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da3:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802da8:	b8 06 00 00 00       	mov    $0x6,%eax
+  802dad:	e8 9c fe ff ff       	call   802c4e <nsipc>
+}
+  802db2:	c9                   	leave
+  802db3:	c3                   	ret
+
+00802db4 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802db4:	55                   	push   %ebp
+  802db5:	89 e5                	mov    %esp,%ebp
+  802db7:	56                   	push   %esi
+  802db8:	53                   	push   %ebx
+  802db9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dbf:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802dc4:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802dca:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dcd:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802dd2:	b8 07 00 00 00       	mov    $0x7,%eax
+  802dd7:	e8 72 fe ff ff       	call   802c4e <nsipc>
+  802ddc:	89 c3                	mov    %eax,%ebx
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	78 22                	js     802e04 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802de2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802de7:	39 c6                	cmp    %eax,%esi
+  802de9:	0f 4e c6             	cmovle %esi,%eax
+  802dec:	39 c3                	cmp    %eax,%ebx
+  802dee:	7f 1d                	jg     802e0d <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802df0:	83 ec 04             	sub    $0x4,%esp
+  802df3:	53                   	push   %ebx
+  802df4:	68 00 70 80 00       	push   $0x807000
+  802df9:	ff 75 0c             	push   0xc(%ebp)
+  802dfc:	e8 67 dd ff ff       	call   800b68 <memmove>
+  802e01:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e04:	89 d8                	mov    %ebx,%eax
+  802e06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e09:	5b                   	pop    %ebx
+  802e0a:	5e                   	pop    %esi
+  802e0b:	5d                   	pop    %ebp
+  802e0c:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e0d:	68 6a 3c 80 00       	push   $0x803c6a
+  802e12:	68 10 3b 80 00       	push   $0x803b10
+  802e17:	6a 62                	push   $0x62
+  802e19:	68 7f 3c 80 00       	push   $0x803c7f
+  802e1e:	e8 9c d4 ff ff       	call   8002bf <_panic>
+
+00802e23 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e23:	55                   	push   %ebp
+  802e24:	89 e5                	mov    %esp,%ebp
+  802e26:	53                   	push   %ebx
+  802e27:	83 ec 04             	sub    $0x4,%esp
+  802e2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e30:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  802e35:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e3b:	7f 2e                	jg     802e6b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e3d:	83 ec 04             	sub    $0x4,%esp
+  802e40:	53                   	push   %ebx
+  802e41:	ff 75 0c             	push   0xc(%ebp)
+  802e44:	68 0c 70 80 00       	push   $0x80700c
+  802e49:	e8 1a dd ff ff       	call   800b68 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e4e:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  802e54:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e57:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802e5c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e61:	e8 e8 fd ff ff       	call   802c4e <nsipc>
+}
+  802e66:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e69:	c9                   	leave
+  802e6a:	c3                   	ret
+	assert(size < 1600);
+  802e6b:	68 8b 3c 80 00       	push   $0x803c8b
+  802e70:	68 10 3b 80 00       	push   $0x803b10
+  802e75:	6a 6d                	push   $0x6d
+  802e77:	68 7f 3c 80 00       	push   $0x803c7f
+  802e7c:	e8 3e d4 ff ff       	call   8002bf <_panic>
+
+00802e81 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802e81:	55                   	push   %ebp
+  802e82:	89 e5                	mov    %esp,%ebp
+  802e84:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802e87:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8a:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802e8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e92:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802e97:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e9a:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802e9f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ea4:	e8 a5 fd ff ff       	call   802c4e <nsipc>
+}
+  802ea9:	c9                   	leave
+  802eaa:	c3                   	ret
+
+00802eab <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802eab:	55                   	push   %ebp
+  802eac:	89 e5                	mov    %esp,%ebp
+  802eae:	56                   	push   %esi
+  802eaf:	53                   	push   %ebx
+  802eb0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802eb3:	83 ec 0c             	sub    $0xc,%esp
+  802eb6:	ff 75 08             	push   0x8(%ebp)
+  802eb9:	e8 2a f3 ff ff       	call   8021e8 <fd2data>
+  802ebe:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802ec0:	83 c4 08             	add    $0x8,%esp
+  802ec3:	68 97 3c 80 00       	push   $0x803c97
+  802ec8:	53                   	push   %ebx
+  802ec9:	e8 14 db ff ff       	call   8009e2 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802ece:	8b 46 04             	mov    0x4(%esi),%eax
+  802ed1:	2b 06                	sub    (%esi),%eax
+  802ed3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ed9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802ee0:	00 00 00 
+	stat->st_dev = &devpipe;
+  802ee3:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802eea:	40 80 00 
+	return 0;
+}
+  802eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ef5:	5b                   	pop    %ebx
+  802ef6:	5e                   	pop    %esi
+  802ef7:	5d                   	pop    %ebp
+  802ef8:	c3                   	ret
+
+00802ef9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ef9:	55                   	push   %ebp
+  802efa:	89 e5                	mov    %esp,%ebp
+  802efc:	53                   	push   %ebx
+  802efd:	83 ec 0c             	sub    $0xc,%esp
+  802f00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f03:	53                   	push   %ebx
+  802f04:	6a 00                	push   $0x0
+  802f06:	e8 aa e0 ff ff       	call   800fb5 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f0b:	89 1c 24             	mov    %ebx,(%esp)
+  802f0e:	e8 d5 f2 ff ff       	call   8021e8 <fd2data>
+  802f13:	83 c4 08             	add    $0x8,%esp
+  802f16:	50                   	push   %eax
+  802f17:	6a 00                	push   $0x0
+  802f19:	e8 97 e0 ff ff       	call   800fb5 <sys_page_unmap>
+}
+  802f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f21:	c9                   	leave
+  802f22:	c3                   	ret
+
+00802f23 <_pipeisclosed>:
+{
+  802f23:	55                   	push   %ebp
+  802f24:	89 e5                	mov    %esp,%ebp
+  802f26:	57                   	push   %edi
+  802f27:	56                   	push   %esi
+  802f28:	53                   	push   %ebx
+  802f29:	83 ec 1c             	sub    $0x1c,%esp
+  802f2c:	89 c7                	mov    %eax,%edi
+  802f2e:	89 d6                	mov    %edx,%esi
+  802f30:	eb 3c                	jmp    802f6e <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  802f32:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  802f35:	83 ec 0c             	sub    $0xc,%esp
+  802f38:	57                   	push   %edi
+  802f39:	e8 66 06 00 00       	call   8035a4 <pageref>
+  802f3e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f41:	89 34 24             	mov    %esi,(%esp)
+  802f44:	e8 5b 06 00 00       	call   8035a4 <pageref>
+  802f49:	89 c2                	mov    %eax,%edx
+  802f4b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f4d:	05 00 00 00 20       	add    $0x20000000,%eax
+  802f52:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802f55:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f5b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f60:	76 31                	jbe    802f93 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802f62:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802f65:	39 c3                	cmp    %eax,%ebx
+  802f67:	74 76                	je     802fdf <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802f69:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802f6c:	74 36                	je     802fa4 <_pipeisclosed+0x81>
+  802f6e:	89 e0                	mov    %esp,%eax
+  802f70:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802f75:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802f7b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802f80:	77 b0                	ja     802f32 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802f82:	c1 e8 10             	shr    $0x10,%eax
+  802f85:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f8b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802f91:	eb 9f                	jmp    802f32 <_pipeisclosed+0xf>
+  802f93:	c1 e8 10             	shr    $0x10,%eax
+  802f96:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802f9c:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802fa2:	eb be                	jmp    802f62 <_pipeisclosed+0x3f>
+  802fa4:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fa6:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802fab:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802fb1:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802fb6:	76 16                	jbe    802fce <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802fb8:	8b 42 58             	mov    0x58(%edx),%eax
+  802fbb:	6a 01                	push   $0x1
+  802fbd:	50                   	push   %eax
+  802fbe:	53                   	push   %ebx
+  802fbf:	68 9e 3c 80 00       	push   $0x803c9e
+  802fc4:	e8 d1 d3 ff ff       	call   80039a <cprintf>
+  802fc9:	83 c4 10             	add    $0x10,%esp
+  802fcc:	eb a0                	jmp    802f6e <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802fce:	c1 e8 10             	shr    $0x10,%eax
+  802fd1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802fd7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802fdd:	eb d9                	jmp    802fb8 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802fdf:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802fe2:	0f 94 c0             	sete   %al
+  802fe5:	0f b6 c0             	movzbl %al,%eax
+}
+  802fe8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802feb:	5b                   	pop    %ebx
+  802fec:	5e                   	pop    %esi
+  802fed:	5f                   	pop    %edi
+  802fee:	5d                   	pop    %ebp
+  802fef:	c3                   	ret
+
+00802ff0 <devpipe_write>:
+{
+  802ff0:	55                   	push   %ebp
+  802ff1:	89 e5                	mov    %esp,%ebp
+  802ff3:	57                   	push   %edi
+  802ff4:	56                   	push   %esi
+  802ff5:	53                   	push   %ebx
+  802ff6:	83 ec 28             	sub    $0x28,%esp
+  802ff9:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802ffc:	56                   	push   %esi
+  802ffd:	e8 e6 f1 ff ff       	call   8021e8 <fd2data>
+  803002:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803004:	83 c4 10             	add    $0x10,%esp
+  803007:	bf 00 00 00 00       	mov    $0x0,%edi
+  80300c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80300f:	75 09                	jne    80301a <devpipe_write+0x2a>
+	return i;
+  803011:	89 f8                	mov    %edi,%eax
+  803013:	eb 23                	jmp    803038 <devpipe_write+0x48>
+			sys_yield();
+  803015:	e8 7a de ff ff       	call   800e94 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80301a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80301d:	8b 0b                	mov    (%ebx),%ecx
+  80301f:	8d 51 20             	lea    0x20(%ecx),%edx
+  803022:	39 d0                	cmp    %edx,%eax
+  803024:	72 1a                	jb     803040 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803026:	89 da                	mov    %ebx,%edx
+  803028:	89 f0                	mov    %esi,%eax
+  80302a:	e8 f4 fe ff ff       	call   802f23 <_pipeisclosed>
+  80302f:	85 c0                	test   %eax,%eax
+  803031:	74 e2                	je     803015 <devpipe_write+0x25>
+				return 0;
+  803033:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803038:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80303b:	5b                   	pop    %ebx
+  80303c:	5e                   	pop    %esi
+  80303d:	5f                   	pop    %edi
+  80303e:	5d                   	pop    %ebp
+  80303f:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803040:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803043:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803047:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80304a:	89 c2                	mov    %eax,%edx
+  80304c:	c1 fa 1f             	sar    $0x1f,%edx
+  80304f:	89 d1                	mov    %edx,%ecx
+  803051:	c1 e9 1b             	shr    $0x1b,%ecx
+  803054:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803057:	83 e2 1f             	and    $0x1f,%edx
+  80305a:	29 ca                	sub    %ecx,%edx
+  80305c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803060:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803064:	83 c0 01             	add    $0x1,%eax
+  803067:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80306a:	83 c7 01             	add    $0x1,%edi
+  80306d:	eb 9d                	jmp    80300c <devpipe_write+0x1c>
+
+0080306f <devpipe_read>:
+{
+  80306f:	55                   	push   %ebp
+  803070:	89 e5                	mov    %esp,%ebp
+  803072:	57                   	push   %edi
+  803073:	56                   	push   %esi
+  803074:	53                   	push   %ebx
+  803075:	83 ec 18             	sub    $0x18,%esp
+  803078:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80307b:	57                   	push   %edi
+  80307c:	e8 67 f1 ff ff       	call   8021e8 <fd2data>
+  803081:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803083:	83 c4 10             	add    $0x10,%esp
+  803086:	be 00 00 00 00       	mov    $0x0,%esi
+  80308b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80308e:	75 13                	jne    8030a3 <devpipe_read+0x34>
+	return i;
+  803090:	89 f0                	mov    %esi,%eax
+  803092:	eb 02                	jmp    803096 <devpipe_read+0x27>
+				return i;
+  803094:	89 f0                	mov    %esi,%eax
+}
+  803096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803099:	5b                   	pop    %ebx
+  80309a:	5e                   	pop    %esi
+  80309b:	5f                   	pop    %edi
+  80309c:	5d                   	pop    %ebp
+  80309d:	c3                   	ret
+			sys_yield();
+  80309e:	e8 f1 dd ff ff       	call   800e94 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8030a3:	8b 03                	mov    (%ebx),%eax
+  8030a5:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8030a8:	75 18                	jne    8030c2 <devpipe_read+0x53>
+			if (i > 0)
+  8030aa:	85 f6                	test   %esi,%esi
+  8030ac:	75 e6                	jne    803094 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8030ae:	89 da                	mov    %ebx,%edx
+  8030b0:	89 f8                	mov    %edi,%eax
+  8030b2:	e8 6c fe ff ff       	call   802f23 <_pipeisclosed>
+  8030b7:	85 c0                	test   %eax,%eax
+  8030b9:	74 e3                	je     80309e <devpipe_read+0x2f>
+				return 0;
+  8030bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030c0:	eb d4                	jmp    803096 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030c2:	99                   	cltd
+  8030c3:	c1 ea 1b             	shr    $0x1b,%edx
+  8030c6:	01 d0                	add    %edx,%eax
+  8030c8:	83 e0 1f             	and    $0x1f,%eax
+  8030cb:	29 d0                	sub    %edx,%eax
+  8030cd:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8030d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030d5:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8030d8:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8030db:	83 c6 01             	add    $0x1,%esi
+  8030de:	eb ab                	jmp    80308b <devpipe_read+0x1c>
+
+008030e0 <pipe>:
+{
+  8030e0:	55                   	push   %ebp
+  8030e1:	89 e5                	mov    %esp,%ebp
+  8030e3:	56                   	push   %esi
+  8030e4:	53                   	push   %ebx
+  8030e5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030eb:	50                   	push   %eax
+  8030ec:	e8 0e f1 ff ff       	call   8021ff <fd_alloc>
+  8030f1:	89 c3                	mov    %eax,%ebx
+  8030f3:	83 c4 10             	add    $0x10,%esp
+  8030f6:	85 c0                	test   %eax,%eax
+  8030f8:	0f 88 23 01 00 00    	js     803221 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030fe:	83 ec 04             	sub    $0x4,%esp
+  803101:	68 07 04 00 00       	push   $0x407
+  803106:	ff 75 f4             	push   -0xc(%ebp)
+  803109:	6a 00                	push   $0x0
+  80310b:	e8 ca dd ff ff       	call   800eda <sys_page_alloc>
+  803110:	89 c3                	mov    %eax,%ebx
+  803112:	83 c4 10             	add    $0x10,%esp
+  803115:	85 c0                	test   %eax,%eax
+  803117:	0f 88 04 01 00 00    	js     803221 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80311d:	83 ec 0c             	sub    $0xc,%esp
+  803120:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803123:	50                   	push   %eax
+  803124:	e8 d6 f0 ff ff       	call   8021ff <fd_alloc>
+  803129:	89 c3                	mov    %eax,%ebx
+  80312b:	83 c4 10             	add    $0x10,%esp
+  80312e:	85 c0                	test   %eax,%eax
+  803130:	0f 88 db 00 00 00    	js     803211 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803136:	83 ec 04             	sub    $0x4,%esp
+  803139:	68 07 04 00 00       	push   $0x407
+  80313e:	ff 75 f0             	push   -0x10(%ebp)
+  803141:	6a 00                	push   $0x0
+  803143:	e8 92 dd ff ff       	call   800eda <sys_page_alloc>
+  803148:	89 c3                	mov    %eax,%ebx
+  80314a:	83 c4 10             	add    $0x10,%esp
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	0f 88 bc 00 00 00    	js     803211 <pipe+0x131>
+	va = fd2data(fd0);
+  803155:	83 ec 0c             	sub    $0xc,%esp
+  803158:	ff 75 f4             	push   -0xc(%ebp)
+  80315b:	e8 88 f0 ff ff       	call   8021e8 <fd2data>
+  803160:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803162:	83 c4 0c             	add    $0xc,%esp
+  803165:	68 07 04 00 00       	push   $0x407
+  80316a:	50                   	push   %eax
+  80316b:	6a 00                	push   $0x0
+  80316d:	e8 68 dd ff ff       	call   800eda <sys_page_alloc>
+  803172:	89 c3                	mov    %eax,%ebx
+  803174:	83 c4 10             	add    $0x10,%esp
+  803177:	85 c0                	test   %eax,%eax
+  803179:	0f 88 82 00 00 00    	js     803201 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80317f:	83 ec 0c             	sub    $0xc,%esp
+  803182:	ff 75 f0             	push   -0x10(%ebp)
+  803185:	e8 5e f0 ff ff       	call   8021e8 <fd2data>
+  80318a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803191:	50                   	push   %eax
+  803192:	6a 00                	push   $0x0
+  803194:	56                   	push   %esi
+  803195:	6a 00                	push   $0x0
+  803197:	e8 ab dd ff ff       	call   800f47 <sys_page_map>
+  80319c:	89 c3                	mov    %eax,%ebx
+  80319e:	83 c4 20             	add    $0x20,%esp
+  8031a1:	85 c0                	test   %eax,%eax
+  8031a3:	78 4e                	js     8031f3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031a5:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8031aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031ad:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031af:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031b2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031b9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031bc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031c1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031c8:	83 ec 0c             	sub    $0xc,%esp
+  8031cb:	ff 75 f4             	push   -0xc(%ebp)
+  8031ce:	e8 05 f0 ff ff       	call   8021d8 <fd2num>
+  8031d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031d6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031d8:	83 c4 04             	add    $0x4,%esp
+  8031db:	ff 75 f0             	push   -0x10(%ebp)
+  8031de:	e8 f5 ef ff ff       	call   8021d8 <fd2num>
+  8031e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031e6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031e9:	83 c4 10             	add    $0x10,%esp
+  8031ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f1:	eb 2e                	jmp    803221 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031f3:	83 ec 08             	sub    $0x8,%esp
+  8031f6:	56                   	push   %esi
+  8031f7:	6a 00                	push   $0x0
+  8031f9:	e8 b7 dd ff ff       	call   800fb5 <sys_page_unmap>
+  8031fe:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803201:	83 ec 08             	sub    $0x8,%esp
+  803204:	ff 75 f0             	push   -0x10(%ebp)
+  803207:	6a 00                	push   $0x0
+  803209:	e8 a7 dd ff ff       	call   800fb5 <sys_page_unmap>
+  80320e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803211:	83 ec 08             	sub    $0x8,%esp
+  803214:	ff 75 f4             	push   -0xc(%ebp)
+  803217:	6a 00                	push   $0x0
+  803219:	e8 97 dd ff ff       	call   800fb5 <sys_page_unmap>
+  80321e:	83 c4 10             	add    $0x10,%esp
+}
+  803221:	89 d8                	mov    %ebx,%eax
+  803223:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803226:	5b                   	pop    %ebx
+  803227:	5e                   	pop    %esi
+  803228:	5d                   	pop    %ebp
+  803229:	c3                   	ret
+
+0080322a <pipeisclosed>:
+{
+  80322a:	55                   	push   %ebp
+  80322b:	89 e5                	mov    %esp,%ebp
+  80322d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803230:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803233:	50                   	push   %eax
+  803234:	ff 75 08             	push   0x8(%ebp)
+  803237:	e8 19 f0 ff ff       	call   802255 <fd_lookup>
+  80323c:	83 c4 10             	add    $0x10,%esp
+  80323f:	85 c0                	test   %eax,%eax
+  803241:	78 18                	js     80325b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803243:	83 ec 0c             	sub    $0xc,%esp
+  803246:	ff 75 f4             	push   -0xc(%ebp)
+  803249:	e8 9a ef ff ff       	call   8021e8 <fd2data>
+  80324e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803250:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803253:	e8 cb fc ff ff       	call   802f23 <_pipeisclosed>
+  803258:	83 c4 10             	add    $0x10,%esp
+}
+  80325b:	c9                   	leave
+  80325c:	c3                   	ret
+
+0080325d <time_nsec>:
+#include <inc/x86.h>
+
+// Nanoseconds since boot.
+uint64_t
+time_nsec(void)
+{
+  80325d:	55                   	push   %ebp
+  80325e:	89 e5                	mov    %esp,%ebp
+  803260:	57                   	push   %edi
+  803261:	56                   	push   %esi
+  803262:	53                   	push   %ebx
+  803263:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ns_mult, timeinfo.ti_ns_shift);
+  803266:	a1 10 f0 ff ee       	mov    0xeefff010,%eax
+  80326b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  80326e:	8b 3d 0c f0 ff ee    	mov    0xeefff00c,%edi
+  803274:	89 7d ec             	mov    %edi,-0x14(%ebp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	__asm __volatile("rdtsc" : "=A" (tsc));
+  803277:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  803279:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  80327f:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  803285:	29 f0                	sub    %esi,%eax
+  803287:	19 fa                	sbb    %edi,%edx
+  803289:	89 c1                	mov    %eax,%ecx
+  80328b:	89 d3                	mov    %edx,%ebx
+// libgcc for 64-bit arithmetic.  The low 32 bits of the 96-bit product
+// are dropped before the shift, which costs less than one unit.
+static inline uint64_t
+tsc_scale(uint64_t ticks, uint32_t mult, uint32_t shift)
+{
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  80328d:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  803290:	6b f7 00             	imul   $0x0,%edi,%esi
+  803293:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803296:	89 f8                	mov    %edi,%eax
+  803298:	f7 e1                	mul    %ecx
+  80329a:	89 c6                	mov    %eax,%esi
+  80329c:	89 d7                	mov    %edx,%edi
+  80329e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8032a1:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  8032a3:	89 d8                	mov    %ebx,%eax
+  8032a5:	f7 65 ec             	mull   -0x14(%ebp)
+
+	if (shift >= 32)
+  8032a8:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  8032ac:	77 34                	ja     8032e2 <time_nsec+0x85>
+		return (hi + (lo >> 32)) >> (shift - 32);
+	return (hi << (32 - shift)) + (lo >> shift);
+  8032ae:	b9 20 00 00 00       	mov    $0x20,%ecx
+  8032b3:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  8032b6:	29 d9                	sub    %ebx,%ecx
+  8032b8:	0f a5 c2             	shld   %cl,%eax,%edx
+  8032bb:	d3 e0                	shl    %cl,%eax
+  8032bd:	f6 c1 20             	test   $0x20,%cl
+  8032c0:	74 04                	je     8032c6 <time_nsec+0x69>
+  8032c2:	89 c2                	mov    %eax,%edx
+  8032c4:	31 c0                	xor    %eax,%eax
+  8032c6:	89 d9                	mov    %ebx,%ecx
+  8032c8:	0f ad fe             	shrd   %cl,%edi,%esi
+  8032cb:	d3 ef                	shr    %cl,%edi
+  8032cd:	f6 c1 20             	test   $0x20,%cl
+  8032d0:	74 04                	je     8032d6 <time_nsec+0x79>
+  8032d2:	89 fe                	mov    %edi,%esi
+  8032d4:	31 ff                	xor    %edi,%edi
+  8032d6:	01 f0                	add    %esi,%eax
+  8032d8:	11 fa                	adc    %edi,%edx
+}
+  8032da:	83 c4 14             	add    $0x14,%esp
+  8032dd:	5b                   	pop    %ebx
+  8032de:	5e                   	pop    %esi
+  8032df:	5f                   	pop    %edi
+  8032e0:	5d                   	pop    %ebp
+  8032e1:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  8032e2:	89 fe                	mov    %edi,%esi
+  8032e4:	31 ff                	xor    %edi,%edi
+  8032e6:	01 f0                	add    %esi,%eax
+  8032e8:	11 fa                	adc    %edi,%edx
+  8032ea:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  8032ed:	83 e9 20             	sub    $0x20,%ecx
+  8032f0:	0f ad d0             	shrd   %cl,%edx,%eax
+  8032f3:	d3 ea                	shr    %cl,%edx
+  8032f5:	f6 c1 20             	test   $0x20,%cl
+  8032f8:	74 04                	je     8032fe <time_nsec+0xa1>
+  8032fa:	89 d0                	mov    %edx,%eax
+  8032fc:	31 d2                	xor    %edx,%edx
+  8032fe:	eb da                	jmp    8032da <time_nsec+0x7d>
+
+00803300 <time_msec>:
+
+// Milliseconds since boot; the same clock as sys_time_msec().
+unsigned int
+time_msec(void)
+{
+  803300:	55                   	push   %ebp
+  803301:	89 e5                	mov    %esp,%ebp
+  803303:	57                   	push   %edi
+  803304:	56                   	push   %esi
+  803305:	53                   	push   %ebx
+  803306:	83 ec 14             	sub    $0x14,%esp
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+			 timeinfo.ti_ms_mult, timeinfo.ti_ms_shift);
+  803309:	a1 18 f0 ff ee       	mov    0xeefff018,%eax
+  80330e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  803311:	8b 3d 14 f0 ff ee    	mov    0xeefff014,%edi
+  803317:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  80331a:	0f 31                	rdtsc
+	return tsc_scale(read_tsc() - timeinfo.ti_tsc_base,
+  80331c:	8b 35 00 f0 ff ee    	mov    0xeefff000,%esi
+  803322:	8b 3d 04 f0 ff ee    	mov    0xeefff004,%edi
+  803328:	29 f0                	sub    %esi,%eax
+  80332a:	19 fa                	sbb    %edi,%edx
+  80332c:	89 c1                	mov    %eax,%ecx
+  80332e:	89 d3                	mov    %edx,%ebx
+	uint64_t lo = (uint64_t) (uint32_t) ticks * mult;
+  803330:	8b 7d ec             	mov    -0x14(%ebp),%edi
+  803333:	6b f7 00             	imul   $0x0,%edi,%esi
+  803336:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803339:	89 f8                	mov    %edi,%eax
+  80333b:	f7 e1                	mul    %ecx
+  80333d:	89 c6                	mov    %eax,%esi
+  80333f:	89 d7                	mov    %edx,%edi
+  803341:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803344:	01 d7                	add    %edx,%edi
+	uint64_t hi = (ticks >> 32) * mult;
+  803346:	89 d8                	mov    %ebx,%eax
+  803348:	f7 65 ec             	mull   -0x14(%ebp)
+	if (shift >= 32)
+  80334b:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%ebp)
+  80334f:	77 32                	ja     803383 <time_msec+0x83>
+	return (hi << (32 - shift)) + (lo >> shift);
+  803351:	b9 20 00 00 00       	mov    $0x20,%ecx
+  803356:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+  803359:	29 d9                	sub    %ebx,%ecx
+  80335b:	0f a5 c2             	shld   %cl,%eax,%edx
+  80335e:	d3 e0                	shl    %cl,%eax
+  803360:	f6 c1 20             	test   $0x20,%cl
+  803363:	74 04                	je     803369 <time_msec+0x69>
+  803365:	89 c2                	mov    %eax,%edx
+  803367:	31 c0                	xor    %eax,%eax
+  803369:	89 d9                	mov    %ebx,%ecx
+  80336b:	0f ad fe             	shrd   %cl,%edi,%esi
+  80336e:	d3 ef                	shr    %cl,%edi
+  803370:	f6 c1 20             	test   $0x20,%cl
+  803373:	74 04                	je     803379 <time_msec+0x79>
+  803375:	89 fe                	mov    %edi,%esi
+  803377:	31 ff                	xor    %edi,%edi
+  803379:	01 f0                	add    %esi,%eax
+}
+  80337b:	83 c4 14             	add    $0x14,%esp
+  80337e:	5b                   	pop    %ebx
+  80337f:	5e                   	pop    %esi
+  803380:	5f                   	pop    %edi
+  803381:	5d                   	pop    %ebp
+  803382:	c3                   	ret
+		return (hi + (lo >> 32)) >> (shift - 32);
+  803383:	89 fe                	mov    %edi,%esi
+  803385:	31 ff                	xor    %edi,%edi
+  803387:	01 f0                	add    %esi,%eax
+  803389:	11 fa                	adc    %edi,%edx
+  80338b:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  80338e:	83 e9 20             	sub    $0x20,%ecx
+  803391:	0f ad d0             	shrd   %cl,%edx,%eax
+  803394:	d3 ea                	shr    %cl,%edx
+  803396:	f6 c1 20             	test   $0x20,%cl
+  803399:	74 04                	je     80339f <time_msec+0x9f>
+  80339b:	89 d0                	mov    %edx,%eax
+  80339d:	31 d2                	xor    %edx,%edx
+  80339f:	eb da                	jmp    80337b <time_msec+0x7b>
+
+008033a1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8033a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a6:	c3                   	ret
+
+008033a7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8033a7:	55                   	push   %ebp
+  8033a8:	89 e5                	mov    %esp,%ebp
+  8033aa:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8033ad:	68 b6 3c 80 00       	push   $0x803cb6
+  8033b2:	ff 75 0c             	push   0xc(%ebp)
+  8033b5:	e8 28 d6 ff ff       	call   8009e2 <strcpy>
+	return 0;
+}
+  8033ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033bf:	c9                   	leave
+  8033c0:	c3                   	ret
+
+008033c1 <devcons_write>:
+{
+  8033c1:	55                   	push   %ebp
+  8033c2:	89 e5                	mov    %esp,%ebp
+  8033c4:	57                   	push   %edi
+  8033c5:	56                   	push   %esi
+  8033c6:	53                   	push   %ebx
+  8033c7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8033cd:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8033d2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8033d8:	eb 2e                	jmp    803408 <devcons_write+0x47>
+		m = n - tot;
+  8033da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033dd:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8033df:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033e4:	39 c3                	cmp    %eax,%ebx
+  8033e6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8033e9:	83 ec 04             	sub    $0x4,%esp
+  8033ec:	53                   	push   %ebx
+  8033ed:	89 f0                	mov    %esi,%eax
+  8033ef:	03 45 0c             	add    0xc(%ebp),%eax
+  8033f2:	50                   	push   %eax
+  8033f3:	57                   	push   %edi
+  8033f4:	e8 6f d7 ff ff       	call   800b68 <memmove>
+		sys_cputs(buf, m);
+  8033f9:	83 c4 08             	add    $0x8,%esp
+  8033fc:	53                   	push   %ebx
+  8033fd:	57                   	push   %edi
+  8033fe:	e8 58 d9 ff ff       	call   800d5b <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803403:	01 de                	add    %ebx,%esi
+  803405:	83 c4 10             	add    $0x10,%esp
+  803408:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80340b:	72 cd                	jb     8033da <devcons_write+0x19>
+}
+  80340d:	89 f0                	mov    %esi,%eax
+  80340f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803412:	5b                   	pop    %ebx
+  803413:	5e                   	pop    %esi
+  803414:	5f                   	pop    %edi
+  803415:	5d                   	pop    %ebp
+  803416:	c3                   	ret
+
+00803417 <devcons_read>:
+{
+  803417:	55                   	push   %ebp
+  803418:	89 e5                	mov    %esp,%ebp
+  80341a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80341d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803422:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803426:	75 07                	jne    80342f <devcons_read+0x18>
+  803428:	eb 1f                	jmp    803449 <devcons_read+0x32>
+		sys_yield();
+  80342a:	e8 65 da ff ff       	call   800e94 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80342f:	e8 6b d9 ff ff       	call   800d9f <sys_cgetc>
+  803434:	85 c0                	test   %eax,%eax
+  803436:	74 f2                	je     80342a <devcons_read+0x13>
+	if (c < 0)
+  803438:	78 0f                	js     803449 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80343a:	83 f8 04             	cmp    $0x4,%eax
+  80343d:	74 0c                	je     80344b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80343f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803442:	88 02                	mov    %al,(%edx)
+	return 1;
+  803444:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803449:	c9                   	leave
+  80344a:	c3                   	ret
+		return 0;
+  80344b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803450:	eb f7                	jmp    803449 <devcons_read+0x32>
+
+00803452 <cputchar>:
+{
+  803452:	55                   	push   %ebp
+  803453:	89 e5                	mov    %esp,%ebp
+  803455:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803458:	8b 45 08             	mov    0x8(%ebp),%eax
+  80345b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80345e:	6a 01                	push   $0x1
+  803460:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803463:	50                   	push   %eax
+  803464:	e8 f2 d8 ff ff       	call   800d5b <sys_cputs>
+}
+  803469:	83 c4 10             	add    $0x10,%esp
+  80346c:	c9                   	leave
+  80346d:	c3                   	ret
+
+0080346e <getchar>:
+{
+  80346e:	55                   	push   %ebp
+  80346f:	89 e5                	mov    %esp,%ebp
+  803471:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803474:	6a 01                	push   $0x1
+  803476:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803479:	50                   	push   %eax
+  80347a:	6a 00                	push   $0x0
+  80347c:	e8 5a f0 ff ff       	call   8024db <read>
+	if (r < 0)
+  803481:	83 c4 10             	add    $0x10,%esp
+  803484:	85 c0                	test   %eax,%eax
+  803486:	78 06                	js     80348e <getchar+0x20>
+	if (r < 1)
+  803488:	74 06                	je     803490 <getchar+0x22>
+	return c;
+  80348a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80348e:	c9                   	leave
+  80348f:	c3                   	ret
+		return -E_EOF;
+  803490:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803495:	eb f7                	jmp    80348e <getchar+0x20>
+
+00803497 <iscons>:
+{
+  803497:	55                   	push   %ebp
+  803498:	89 e5                	mov    %esp,%ebp
+  80349a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80349d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034a0:	50                   	push   %eax
+  8034a1:	ff 75 08             	push   0x8(%ebp)
+  8034a4:	e8 ac ed ff ff       	call   802255 <fd_lookup>
+  8034a9:	83 c4 10             	add    $0x10,%esp
+  8034ac:	85 c0                	test   %eax,%eax
+  8034ae:	78 11                	js     8034c1 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8034b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034b3:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8034b9:	39 10                	cmp    %edx,(%eax)
+  8034bb:	0f 94 c0             	sete   %al
+  8034be:	0f b6 c0             	movzbl %al,%eax
+}
+  8034c1:	c9                   	leave
+  8034c2:	c3                   	ret
+
+008034c3 <opencons>:
+{
+  8034c3:	55                   	push   %ebp
+  8034c4:	89 e5                	mov    %esp,%ebp
+  8034c6:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8034c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034cc:	50                   	push   %eax
+  8034cd:	e8 2d ed ff ff       	call   8021ff <fd_alloc>
+  8034d2:	83 c4 10             	add    $0x10,%esp
+  8034d5:	85 c0                	test   %eax,%eax
+  8034d7:	78 3a                	js     803513 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034d9:	83 ec 04             	sub    $0x4,%esp
+  8034dc:	68 07 04 00 00       	push   $0x407
+  8034e1:	ff 75 f4             	push   -0xc(%ebp)
+  8034e4:	6a 00                	push   $0x0
+  8034e6:	e8 ef d9 ff ff       	call   800eda <sys_page_alloc>
+  8034eb:	83 c4 10             	add    $0x10,%esp
+  8034ee:	85 c0                	test   %eax,%eax
+  8034f0:	78 21                	js     803513 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8034f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034f5:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8034fb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8034fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803500:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803507:	83 ec 0c             	sub    $0xc,%esp
+  80350a:	50                   	push   %eax
+  80350b:	e8 c8 ec ff ff       	call   8021d8 <fd2num>
+  803510:	83 c4 10             	add    $0x10,%esp
+}
+  803513:	c9                   	leave
+  803514:	c3                   	ret
+
+00803515 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803515:	55                   	push   %ebp
+  803516:	89 e5                	mov    %esp,%ebp
+  803518:	83 ec 08             	sub    $0x8,%esp
+	int r;
+	// Please don't make any writes here, because after fork this is
+	// the first procedure that the child runs. while he does that,
+	// if he tries to write anything it will generate COW.
+	if (_pgfault_handler == 0) {
+  80351b:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803522:	74 0a                	je     80352e <set_pgfault_handler+0x19>
+		
+		//panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803524:	8b 45 08             	mov    0x8(%ebp),%eax
+  803527:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80352c:	c9                   	leave
+  80352d:	c3                   	ret
+		if((r = sys_page_alloc(0, (void *) ROUNDDOWN(UXSTACKTOP - 1, PGSIZE), PTE_P | PTE_W | PTE_U)) < 0) {
+  80352e:	83 ec 04             	sub    $0x4,%esp
+  803531:	6a 07                	push   $0x7
+  803533:	68 00 f0 bf ee       	push   $0xeebff000
+  803538:	6a 00                	push   $0x0
+  80353a:	e8 9b d9 ff ff       	call   800eda <sys_page_alloc>
+  80353f:	83 c4 10             	add    $0x10,%esp
+  803542:	85 c0                	test   %eax,%eax
+  803544:	78 14                	js     80355a <set_pgfault_handler+0x45>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803546:	83 ec 08             	sub    $0x8,%esp
+  803549:	68 7c 35 80 00       	push   $0x80357c
+  80354e:	6a 00                	push   $0x0
+  803550:	e8 a1 db ff ff       	call   8010f6 <sys_env_set_pgfault_upcall>
+  803555:	83 c4 10             	add    $0x10,%esp
+  803558:	eb ca                	jmp    803524 <set_pgfault_handler+0xf>
+			cprintf("error: %e\n", r);
+  80355a:	83 ec 08             	sub    $0x8,%esp
+  80355d:	50                   	push   %eax
+  80355e:	68 c2 3c 80 00       	push   $0x803cc2
+  803563:	e8 32 ce ff ff       	call   80039a <cprintf>
+			panic("set_pgfault_handler error");
+  803568:	83 c4 0c             	add    $0xc,%esp
+  80356b:	68 cd 3c 80 00       	push   $0x803ccd
+  803570:	6a 24                	push   $0x24
+  803572:	68 e7 3c 80 00       	push   $0x803ce7
+  803577:	e8 43 cd ff ff       	call   8002bf <_panic>
+
+0080357c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80357c:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80357d:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803582:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803584:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	mov 48(%esp), %edi
+  803587:	8b 7c 24 30          	mov    0x30(%esp),%edi
+	sub $4, %edi
+  80358b:	83 ef 04             	sub    $0x4,%edi
+	mov 40(%esp), %eax
+  80358e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	mov %eax, (%edi)
+  803592:	89 07                	mov    %eax,(%edi)
+	
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	lea 8(%esp), %esp
+  803594:	8d 64 24 08          	lea    0x8(%esp),%esp
+	popa
+  803598:	61                   	popa
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	lea 4(%esp), %esp
+  803599:	8d 64 24 04          	lea    0x4(%esp),%esp
+	popf
+  80359d:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	pop %esp
+  80359e:	5c                   	pop    %esp
+	lea -4(%esp), %esp
+  80359f:	8d 64 24 fc          	lea    -0x4(%esp),%esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8035a3:	c3                   	ret
+
+008035a4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8035a4:	55                   	push   %ebp
+  8035a5:	89 e5                	mov    %esp,%ebp
+  8035a7:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8035aa:	89 c2                	mov    %eax,%edx
+  8035ac:	c1 ea 16             	shr    $0x16,%edx
+  8035af:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8035b6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8035bb:	f6 c1 01             	test   $0x1,%cl
+  8035be:	74 1a                	je     8035da <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  8035c0:	c1 e8 0c             	shr    $0xc,%eax
+  8035c3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8035ca:	a8 01                	test   $0x1,%al
+  8035cc:	74 0c                	je     8035da <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8035ce:	c1 e8 0c             	shr    $0xc,%eax
+  8035d1:	c1 e0 04             	shl    $0x4,%eax
+  8035d4:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  8035da:	89 d0                	mov    %edx,%eax
+  8035dc:	5d                   	pop    %ebp
+  8035dd:	c3                   	ret
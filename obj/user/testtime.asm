@@ -0,0 +1,6250 @@
+
+obj/user/testtime.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c5 00 00 00       	call   8000f6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sleep>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+sleep(int sec)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	unsigned now = sys_time_msec();
+  80003a:	e8 f1 11 00 00       	call   801230 <sys_time_msec>
+	unsigned end = now + sec * 1000;
+  80003f:	69 5d 08 e8 03 00 00 	imul   $0x3e8,0x8(%ebp),%ebx
+  800046:	01 c3                	add    %eax,%ebx
+
+	if ((int)now < 0 && (int)now > -MAXERROR)
+  800048:	85 c0                	test   %eax,%eax
+  80004a:	79 05                	jns    800051 <sleep+0x1e>
+  80004c:	83 f8 ee             	cmp    $0xffffffee,%eax
+  80004f:	7d 18                	jge    800069 <sleep+0x36>
+		panic("sys_time_msec: %e", (int)now);
+	if (end < now)
+  800051:	39 c3                	cmp    %eax,%ebx
+  800053:	73 2b                	jae    800080 <sleep+0x4d>
+		panic("sleep: wrap");
+  800055:	83 ec 04             	sub    $0x4,%esp
+  800058:	68 22 2c 80 00       	push   $0x802c22
+  80005d:	6a 0d                	push   $0xd
+  80005f:	68 12 2c 80 00       	push   $0x802c12
+  800064:	e8 51 01 00 00       	call   8001ba <_panic>
+		panic("sys_time_msec: %e", (int)now);
+  800069:	50                   	push   %eax
+  80006a:	68 00 2c 80 00       	push   $0x802c00
+  80006f:	6a 0b                	push   $0xb
+  800071:	68 12 2c 80 00       	push   $0x802c12
+  800076:	e8 3f 01 00 00       	call   8001ba <_panic>
+
+	while (sys_time_msec() < end)
+		sys_yield();
+  80007b:	e8 0f 0d 00 00       	call   800d8f <sys_yield>
+	while (sys_time_msec() < end)
+  800080:	e8 ab 11 00 00       	call   801230 <sys_time_msec>
+  800085:	39 d8                	cmp    %ebx,%eax
+  800087:	72 f2                	jb     80007b <sleep+0x48>
+}
+  800089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80008c:	c9                   	leave
+  80008d:	c3                   	ret
+
+0080008e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80008e:	55                   	push   %ebp
+  80008f:	89 e5                	mov    %esp,%ebp
+  800091:	53                   	push   %ebx
+  800092:	83 ec 04             	sub    $0x4,%esp
+	int i;
+
+	// Wait for the console to calm down
+	for (i = 0; i < 50; i++)
+  800095:	bb 33 00 00 00       	mov    $0x33,%ebx
+  80009a:	eb 05                	jmp    8000a1 <umain+0x13>
+		sys_yield();
+  80009c:	e8 ee 0c 00 00       	call   800d8f <sys_yield>
+	for (i = 0; i < 50; i++)
+  8000a1:	83 eb 01             	sub    $0x1,%ebx
+  8000a4:	75 f6                	jne    80009c <umain+0xe>
+
+	cprintf("starting count down: ");
+  8000a6:	83 ec 0c             	sub    $0xc,%esp
+  8000a9:	68 2e 2c 80 00       	push   $0x802c2e
+  8000ae:	e8 e2 01 00 00       	call   800295 <cprintf>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+	for (i = 5; i >= 0; i--) {
+  8000b6:	bb 05 00 00 00       	mov    $0x5,%ebx
+		cprintf("%d ", i);
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+  8000be:	53                   	push   %ebx
+  8000bf:	68 44 2c 80 00       	push   $0x802c44
+  8000c4:	e8 cc 01 00 00       	call   800295 <cprintf>
+		sleep(1);
+  8000c9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8000d0:	e8 5e ff ff ff       	call   800033 <sleep>
+	for (i = 5; i >= 0; i--) {
+  8000d5:	83 eb 01             	sub    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	83 fb ff             	cmp    $0xffffffff,%ebx
+  8000de:	75 db                	jne    8000bb <umain+0x2d>
+	}
+	cprintf("\n");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 0c 31 80 00       	push   $0x80310c
+  8000e8:	e8 a8 01 00 00       	call   800295 <cprintf>
+#define MSR_SYSENTER_EIP	0x176
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  8000ed:	cc                   	int3
+	breakpoint();
+}
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f4:	c9                   	leave
+  8000f5:	c3                   	ret
+
+008000f6 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	57                   	push   %edi
+  8000fa:	56                   	push   %esi
+  8000fb:	53                   	push   %ebx
+  8000fc:	83 ec 0c             	sub    $0xc,%esp
+  8000ff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800102:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800105:	b8 01 00 00 00       	mov    $0x1,%eax
+  80010a:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80010c:	c1 ea 0b             	shr    $0xb,%edx
+  80010f:	83 f2 01             	xor    $0x1,%edx
+  800112:	83 e2 01             	and    $0x1,%edx
+  800115:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  80011b:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  800122:	00 00 00 
+	envid = sys_getenvid();
+  800125:	e8 1f 0c 00 00       	call   800d49 <sys_getenvid>
+  80012a:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  80012c:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  800131:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800137:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80013d:	8b 52 48             	mov    0x48(%edx),%edx
+  800140:	39 ca                	cmp    %ecx,%edx
+  800142:	74 27                	je     80016b <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  800144:	83 c0 01             	add    $0x1,%eax
+  800147:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80014c:	75 e3                	jne    800131 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  80014e:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  800155:	75 24                	jne    80017b <libmain+0x85>
+		panic("libmain can't find the environment");
+  800157:	83 ec 04             	sub    $0x4,%esp
+  80015a:	68 48 2c 80 00       	push   $0x802c48
+  80015f:	6a 23                	push   $0x23
+  800161:	68 6b 2c 80 00       	push   $0x802c6b
+  800166:	e8 4f 00 00 00       	call   8001ba <_panic>
+			mainenv = &envs[i];
+  80016b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800171:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800176:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80017b:	85 ff                	test   %edi,%edi
+  80017d:	7e 07                	jle    800186 <libmain+0x90>
+		binaryname = argv[0];
+  80017f:	8b 06                	mov    (%esi),%eax
+  800181:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800186:	83 ec 08             	sub    $0x8,%esp
+  800189:	56                   	push   %esi
+  80018a:	57                   	push   %edi
+  80018b:	e8 fe fe ff ff       	call   80008e <umain>
+
+	// exit gracefully
+	exit();
+  800190:	e8 0b 00 00 00       	call   8001a0 <exit>
+}
+  800195:	83 c4 10             	add    $0x10,%esp
+  800198:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019b:	5b                   	pop    %ebx
+  80019c:	5e                   	pop    %esi
+  80019d:	5f                   	pop    %edi
+  80019e:	5d                   	pop    %ebp
+  80019f:	c3                   	ret
+
+008001a0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001a6:	e8 94 18 00 00       	call   801a3f <close_all>
+	sys_env_destroy(0);
+  8001ab:	83 ec 0c             	sub    $0xc,%esp
+  8001ae:	6a 00                	push   $0x0
+  8001b0:	e8 2b 0b 00 00       	call   800ce0 <sys_env_destroy>
+}
+  8001b5:	83 c4 10             	add    $0x10,%esp
+  8001b8:	c9                   	leave
+  8001b9:	c3                   	ret
+
+008001ba <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001ba:	55                   	push   %ebp
+  8001bb:	89 e5                	mov    %esp,%ebp
+  8001bd:	56                   	push   %esi
+  8001be:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001bf:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001c2:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001c8:	e8 7c 0b 00 00       	call   800d49 <sys_getenvid>
+  8001cd:	83 ec 0c             	sub    $0xc,%esp
+  8001d0:	ff 75 0c             	push   0xc(%ebp)
+  8001d3:	ff 75 08             	push   0x8(%ebp)
+  8001d6:	56                   	push   %esi
+  8001d7:	50                   	push   %eax
+  8001d8:	68 84 2c 80 00       	push   $0x802c84
+  8001dd:	e8 b3 00 00 00       	call   800295 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001e2:	83 c4 18             	add    $0x18,%esp
+  8001e5:	53                   	push   %ebx
+  8001e6:	ff 75 10             	push   0x10(%ebp)
+  8001e9:	e8 56 00 00 00       	call   800244 <vcprintf>
+	cprintf("\n");
+  8001ee:	c7 04 24 0c 31 80 00 	movl   $0x80310c,(%esp)
+  8001f5:	e8 9b 00 00 00       	call   800295 <cprintf>
+  8001fa:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001fd:	cc                   	int3
+	while (1)
+  8001fe:	eb fd                	jmp    8001fd <_panic+0x43>
+
+00800200 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800200:	55                   	push   %ebp
+  800201:	89 e5                	mov    %esp,%ebp
+  800203:	53                   	push   %ebx
+  800204:	83 ec 04             	sub    $0x4,%esp
+  800207:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80020a:	8b 13                	mov    (%ebx),%edx
+  80020c:	8d 42 01             	lea    0x1(%edx),%eax
+  80020f:	89 03                	mov    %eax,(%ebx)
+  800211:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800214:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800218:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80021d:	74 09                	je     800228 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80021f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800223:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800228:	83 ec 08             	sub    $0x8,%esp
+  80022b:	68 ff 00 00 00       	push   $0xff
+  800230:	8d 43 08             	lea    0x8(%ebx),%eax
+  800233:	50                   	push   %eax
+  800234:	e8 1d 0a 00 00       	call   800c56 <sys_cputs>
+		b->idx = 0;
+  800239:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80023f:	83 c4 10             	add    $0x10,%esp
+  800242:	eb db                	jmp    80021f <putch+0x1f>
+
+00800244 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800244:	55                   	push   %ebp
+  800245:	89 e5                	mov    %esp,%ebp
+  800247:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80024d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800254:	00 00 00 
+	b.cnt = 0;
+  800257:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80025e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800261:	ff 75 0c             	push   0xc(%ebp)
+  800264:	ff 75 08             	push   0x8(%ebp)
+  800267:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	68 00 02 80 00       	push   $0x800200
+  800273:	e8 fb 00 00 00       	call   800373 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800278:	83 c4 08             	add    $0x8,%esp
+  80027b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800281:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800287:	50                   	push   %eax
+  800288:	e8 c9 09 00 00       	call   800c56 <sys_cputs>
+
+	return b.cnt;
+}
+  80028d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800293:	c9                   	leave
+  800294:	c3                   	ret
+
+00800295 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800295:	55                   	push   %ebp
+  800296:	89 e5                	mov    %esp,%ebp
+  800298:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80029b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80029e:	50                   	push   %eax
+  80029f:	ff 75 08             	push   0x8(%ebp)
+  8002a2:	e8 9d ff ff ff       	call   800244 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002a7:	c9                   	leave
+  8002a8:	c3                   	ret
+
+008002a9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8002a9:	55                   	push   %ebp
+  8002aa:	89 e5                	mov    %esp,%ebp
+  8002ac:	57                   	push   %edi
+  8002ad:	56                   	push   %esi
+  8002ae:	53                   	push   %ebx
+  8002af:	83 ec 1c             	sub    $0x1c,%esp
+  8002b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002b5:	89 d6                	mov    %edx,%esi
+  8002b7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002bd:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002c0:	73 0b                	jae    8002cd <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002c2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002c5:	c1 e7 08             	shl    $0x8,%edi
+  8002c8:	0b 7d 10             	or     0x10(%ebp),%edi
+  8002cb:	eb 36                	jmp    800303 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8002cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d5:	f7 75 08             	divl   0x8(%ebp)
+  8002d8:	89 c1                	mov    %eax,%ecx
+  8002da:	ff 75 14             	push   0x14(%ebp)
+  8002dd:	ff 75 10             	push   0x10(%ebp)
+  8002e0:	83 eb 01             	sub    $0x1,%ebx
+  8002e3:	53                   	push   %ebx
+  8002e4:	ff 75 08             	push   0x8(%ebp)
+  8002e7:	89 f2                	mov    %esi,%edx
+  8002e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002ec:	e8 b8 ff ff ff       	call   8002a9 <printnum>
+  8002f1:	83 c4 10             	add    $0x10,%esp
+  8002f4:	eb 14                	jmp    80030a <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002f6:	83 ec 08             	sub    $0x8,%esp
+  8002f9:	56                   	push   %esi
+  8002fa:	57                   	push   %edi
+  8002fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002fe:	ff d0                	call   *%eax
+  800300:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800303:	83 eb 01             	sub    $0x1,%ebx
+  800306:	85 db                	test   %ebx,%ebx
+  800308:	7f ec                	jg     8002f6 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80030a:	83 ec 08             	sub    $0x8,%esp
+  80030d:	56                   	push   %esi
+  80030e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800311:	ba 00 00 00 00       	mov    $0x0,%edx
+  800316:	f7 75 08             	divl   0x8(%ebp)
+  800319:	0f be 92 a7 2c 80 00 	movsbl 0x802ca7(%edx),%edx
+  800320:	8b 45 14             	mov    0x14(%ebp),%eax
+  800323:	c1 e0 08             	shl    $0x8,%eax
+  800326:	09 d0                	or     %edx,%eax
+  800328:	50                   	push   %eax
+  800329:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80032c:	ff d0                	call   *%eax
+}
+  80032e:	83 c4 10             	add    $0x10,%esp
+  800331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800334:	5b                   	pop    %ebx
+  800335:	5e                   	pop    %esi
+  800336:	5f                   	pop    %edi
+  800337:	5d                   	pop    %ebp
+  800338:	c3                   	ret
+
+00800339 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800339:	55                   	push   %ebp
+  80033a:	89 e5                	mov    %esp,%ebp
+  80033c:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80033f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800343:	8b 10                	mov    (%eax),%edx
+  800345:	3b 50 04             	cmp    0x4(%eax),%edx
+  800348:	73 0a                	jae    800354 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80034a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80034d:	89 08                	mov    %ecx,(%eax)
+  80034f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800352:	88 02                	mov    %al,(%edx)
+}
+  800354:	5d                   	pop    %ebp
+  800355:	c3                   	ret
+
+00800356 <printfmt>:
+{
+  800356:	55                   	push   %ebp
+  800357:	89 e5                	mov    %esp,%ebp
+  800359:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80035c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80035f:	50                   	push   %eax
+  800360:	ff 75 10             	push   0x10(%ebp)
+  800363:	ff 75 0c             	push   0xc(%ebp)
+  800366:	ff 75 08             	push   0x8(%ebp)
+  800369:	e8 05 00 00 00       	call   800373 <vprintfmt>
+}
+  80036e:	83 c4 10             	add    $0x10,%esp
+  800371:	c9                   	leave
+  800372:	c3                   	ret
+
+00800373 <vprintfmt>:
+{
+  800373:	55                   	push   %ebp
+  800374:	89 e5                	mov    %esp,%ebp
+  800376:	57                   	push   %edi
+  800377:	56                   	push   %esi
+  800378:	53                   	push   %ebx
+  800379:	83 ec 3c             	sub    $0x3c,%esp
+  80037c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80037f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800382:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800389:	eb 16                	jmp    8003a1 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80038b:	83 ec 08             	sub    $0x8,%esp
+  80038e:	ff 75 0c             	push   0xc(%ebp)
+  800391:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800394:	c1 e2 08             	shl    $0x8,%edx
+  800397:	09 d0                	or     %edx,%eax
+  800399:	50                   	push   %eax
+  80039a:	ff d7                	call   *%edi
+  80039c:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80039f:	89 de                	mov    %ebx,%esi
+  8003a1:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003a4:	0f b6 06             	movzbl (%esi),%eax
+  8003a7:	83 f8 25             	cmp    $0x25,%eax
+  8003aa:	74 0c                	je     8003b8 <vprintfmt+0x45>
+			if (ch == '\0')
+  8003ac:	85 c0                	test   %eax,%eax
+  8003ae:	75 db                	jne    80038b <vprintfmt+0x18>
+}
+  8003b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b3:	5b                   	pop    %ebx
+  8003b4:	5e                   	pop    %esi
+  8003b5:	5f                   	pop    %edi
+  8003b6:	5d                   	pop    %ebp
+  8003b7:	c3                   	ret
+		padc = ' ';
+  8003b8:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003bc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003c3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003ca:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d6:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003d9:	0f b6 13             	movzbl (%ebx),%edx
+  8003dc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003df:	3c 55                	cmp    $0x55,%al
+  8003e1:	0f 87 2c 04 00 00    	ja     800813 <vprintfmt+0x4a0>
+  8003e7:	0f b6 c0             	movzbl %al,%eax
+  8003ea:	ff 24 85 00 2e 80 00 	jmp    *0x802e00(,%eax,4)
+  8003f1:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003f3:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  8003f7:	eb dd                	jmp    8003d6 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f9:	89 f3                	mov    %esi,%ebx
+  8003fb:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  8003ff:	eb d5                	jmp    8003d6 <vprintfmt+0x63>
+  800401:	0f b6 d2             	movzbl %dl,%edx
+  800404:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800406:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80040b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80040e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800412:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  800415:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800418:	83 fe 09             	cmp    $0x9,%esi
+  80041b:	0f 87 8a 00 00 00    	ja     8004ab <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  800421:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  800424:	eb e5                	jmp    80040b <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  800426:	8b 45 14             	mov    0x14(%ebp),%eax
+  800429:	8b 00                	mov    (%eax),%eax
+  80042b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80042e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800431:	8d 40 04             	lea    0x4(%eax),%eax
+  800434:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800437:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800439:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80043d:	79 97                	jns    8003d6 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  80043f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800442:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800445:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80044c:	eb 88                	jmp    8003d6 <vprintfmt+0x63>
+			if (width < 0)
+  80044e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  800451:	85 db                	test   %ebx,%ebx
+  800453:	b8 00 00 00 00       	mov    $0x0,%eax
+  800458:	0f 49 c3             	cmovns %ebx,%eax
+  80045b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80045e:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800460:	e9 71 ff ff ff       	jmp    8003d6 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800465:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800467:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80046e:	e9 63 ff ff ff       	jmp    8003d6 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800473:	8d 73 02             	lea    0x2(%ebx),%esi
+  800476:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80047a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800481:	3c 67                	cmp    $0x67,%al
+  800483:	0f 84 18 ff ff ff    	je     8003a1 <vprintfmt+0x2e>
+					attrib = 0x04;
+  800489:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800490:	3c 72                	cmp    $0x72,%al
+  800492:	0f 84 09 ff ff ff    	je     8003a1 <vprintfmt+0x2e>
+					attrib = 0x00;
+  800498:	3c 62                	cmp    $0x62,%al
+  80049a:	0f 94 c0             	sete   %al
+  80049d:	0f b6 c0             	movzbl %al,%eax
+  8004a0:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004a6:	e9 f6 fe ff ff       	jmp    8003a1 <vprintfmt+0x2e>
+  8004ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ae:	eb 89                	jmp    800439 <vprintfmt+0xc6>
+			lflag++;
+  8004b0:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b3:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004b5:	e9 1c ff ff ff       	jmp    8003d6 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bd:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004c0:	83 ec 08             	sub    $0x8,%esp
+  8004c3:	ff 75 0c             	push   0xc(%ebp)
+  8004c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004c9:	c1 e0 08             	shl    $0x8,%eax
+  8004cc:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8004cf:	0b 01                	or     (%ecx),%eax
+  8004d1:	50                   	push   %eax
+  8004d2:	ff d7                	call   *%edi
+			break;
+  8004d4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004d7:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004da:	e9 c2 fe ff ff       	jmp    8003a1 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e2:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004e5:	8b 10                	mov    (%eax),%edx
+  8004e7:	89 d0                	mov    %edx,%eax
+  8004e9:	f7 d8                	neg    %eax
+  8004eb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004ee:	83 f8 12             	cmp    $0x12,%eax
+  8004f1:	7f 25                	jg     800518 <vprintfmt+0x1a5>
+  8004f3:	8b 14 85 60 2f 80 00 	mov    0x802f60(,%eax,4),%edx
+  8004fa:	85 d2                	test   %edx,%edx
+  8004fc:	74 1a                	je     800518 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  8004fe:	52                   	push   %edx
+  8004ff:	68 a1 30 80 00       	push   $0x8030a1
+  800504:	ff 75 0c             	push   0xc(%ebp)
+  800507:	57                   	push   %edi
+  800508:	e8 49 fe ff ff       	call   800356 <printfmt>
+  80050d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800510:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  800513:	e9 89 fe ff ff       	jmp    8003a1 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800518:	50                   	push   %eax
+  800519:	68 bf 2c 80 00       	push   $0x802cbf
+  80051e:	ff 75 0c             	push   0xc(%ebp)
+  800521:	57                   	push   %edi
+  800522:	e8 2f fe ff ff       	call   800356 <printfmt>
+  800527:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80052a:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80052d:	e9 6f fe ff ff       	jmp    8003a1 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800532:	8b 45 14             	mov    0x14(%ebp),%eax
+  800535:	83 c0 04             	add    $0x4,%eax
+  800538:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  80053b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053e:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800540:	85 c9                	test   %ecx,%ecx
+  800542:	b8 b8 2c 80 00       	mov    $0x802cb8,%eax
+  800547:	0f 45 c1             	cmovne %ecx,%eax
+  80054a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  80054d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800551:	7e 06                	jle    800559 <vprintfmt+0x1e6>
+  800553:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800557:	75 1a                	jne    800573 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800559:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80055c:	c1 e0 08             	shl    $0x8,%eax
+  80055f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  800562:	83 c8 3f             	or     $0x3f,%eax
+  800565:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800568:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  80056b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80056e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800571:	eb 6d                	jmp    8005e0 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800573:	83 ec 08             	sub    $0x8,%esp
+  800576:	ff 75 d0             	push   -0x30(%ebp)
+  800579:	ff 75 c8             	push   -0x38(%ebp)
+  80057c:	e8 39 03 00 00       	call   8008ba <strnlen>
+  800581:	89 c2                	mov    %eax,%edx
+  800583:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800586:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800588:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80058b:	c1 e1 08             	shl    $0x8,%ecx
+  80058e:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800592:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800594:	83 c4 10             	add    $0x10,%esp
+  800597:	89 c3                	mov    %eax,%ebx
+  800599:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80059c:	89 75 10             	mov    %esi,0x10(%ebp)
+  80059f:	89 ce                	mov    %ecx,%esi
+  8005a1:	eb 0f                	jmp    8005b2 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	ff 75 0c             	push   0xc(%ebp)
+  8005a9:	56                   	push   %esi
+  8005aa:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ac:	83 eb 01             	sub    $0x1,%ebx
+  8005af:	83 c4 10             	add    $0x10,%esp
+  8005b2:	85 db                	test   %ebx,%ebx
+  8005b4:	7f ed                	jg     8005a3 <vprintfmt+0x230>
+  8005b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b9:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005bc:	85 c0                	test   %eax,%eax
+  8005be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c3:	0f 49 d0             	cmovns %eax,%edx
+  8005c6:	29 d0                	sub    %edx,%eax
+  8005c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005cb:	eb 8c                	jmp    800559 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8005cd:	83 ec 08             	sub    $0x8,%esp
+  8005d0:	ff 75 0c             	push   0xc(%ebp)
+  8005d3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005d6:	09 c2                	or     %eax,%edx
+  8005d8:	52                   	push   %edx
+  8005d9:	ff d7                	call   *%edi
+  8005db:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005de:	89 d9                	mov    %ebx,%ecx
+  8005e0:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005e3:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005e7:	0f be d0             	movsbl %al,%edx
+  8005ea:	85 d2                	test   %edx,%edx
+  8005ec:	74 2a                	je     800618 <vprintfmt+0x2a5>
+  8005ee:	85 f6                	test   %esi,%esi
+  8005f0:	78 05                	js     8005f7 <vprintfmt+0x284>
+  8005f2:	83 ee 01             	sub    $0x1,%esi
+  8005f5:	78 3b                	js     800632 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005f7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005fb:	74 d0                	je     8005cd <vprintfmt+0x25a>
+  8005fd:	0f be c0             	movsbl %al,%eax
+  800600:	83 e8 20             	sub    $0x20,%eax
+  800603:	83 f8 5e             	cmp    $0x5e,%eax
+  800606:	76 c5                	jbe    8005cd <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800608:	83 ec 08             	sub    $0x8,%esp
+  80060b:	ff 75 0c             	push   0xc(%ebp)
+  80060e:	ff 75 cc             	push   -0x34(%ebp)
+  800611:	ff d7                	call   *%edi
+  800613:	83 c4 10             	add    $0x10,%esp
+  800616:	eb c6                	jmp    8005de <vprintfmt+0x26b>
+  800618:	8b 75 10             	mov    0x10(%ebp),%esi
+  80061b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80061e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800621:	01 c3                	add    %eax,%ebx
+  800623:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  800625:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800628:	83 c8 20             	or     $0x20,%eax
+  80062b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80062e:	89 c6                	mov    %eax,%esi
+  800630:	eb 14                	jmp    800646 <vprintfmt+0x2d3>
+  800632:	8b 75 10             	mov    0x10(%ebp),%esi
+  800635:	eb e4                	jmp    80061b <vprintfmt+0x2a8>
+  800637:	83 ec 08             	sub    $0x8,%esp
+  80063a:	ff 75 0c             	push   0xc(%ebp)
+  80063d:	56                   	push   %esi
+  80063e:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800640:	83 eb 01             	sub    $0x1,%ebx
+  800643:	83 c4 10             	add    $0x10,%esp
+  800646:	85 db                	test   %ebx,%ebx
+  800648:	7f ed                	jg     800637 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80064a:	8b 75 10             	mov    0x10(%ebp),%esi
+  80064d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+  800653:	e9 49 fd ff ff       	jmp    8003a1 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800658:	83 f9 01             	cmp    $0x1,%ecx
+  80065b:	7f 1f                	jg     80067c <vprintfmt+0x309>
+	else if (lflag)
+  80065d:	85 c9                	test   %ecx,%ecx
+  80065f:	74 69                	je     8006ca <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 00                	mov    (%eax),%eax
+  800666:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800669:	89 c1                	mov    %eax,%ecx
+  80066b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80066e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8d 40 04             	lea    0x4(%eax),%eax
+  800677:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067a:	eb 17                	jmp    800693 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8b 50 04             	mov    0x4(%eax),%edx
+  800682:	8b 00                	mov    (%eax),%eax
+  800684:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800687:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80068a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068d:	8d 40 08             	lea    0x8(%eax),%eax
+  800690:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800693:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800696:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  800699:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  80069e:	85 db                	test   %ebx,%ebx
+  8006a0:	0f 89 f6 00 00 00    	jns    80079c <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	ff 75 0c             	push   0xc(%ebp)
+  8006ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006af:	c1 e0 08             	shl    $0x8,%eax
+  8006b2:	83 c8 2d             	or     $0x2d,%eax
+  8006b5:	50                   	push   %eax
+  8006b6:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006b8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006bb:	f7 d9                	neg    %ecx
+  8006bd:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006c5:	e9 d2 00 00 00       	jmp    80079c <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8006ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cd:	8b 00                	mov    (%eax),%eax
+  8006cf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006d2:	89 c1                	mov    %eax,%ecx
+  8006d4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006d7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e3:	eb ae                	jmp    800693 <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006e5:	83 f9 01             	cmp    $0x1,%ecx
+  8006e8:	7f 19                	jg     800703 <vprintfmt+0x390>
+	else if (lflag)
+  8006ea:	85 c9                	test   %ecx,%ecx
+  8006ec:	74 2a                	je     800718 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8b 08                	mov    (%eax),%ecx
+  8006f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  8006fe:	e9 99 00 00 00       	jmp    80079c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800703:	8b 45 14             	mov    0x14(%ebp),%eax
+  800706:	8b 08                	mov    (%eax),%ecx
+  800708:	8d 40 08             	lea    0x8(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070e:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  800713:	e9 84 00 00 00       	jmp    80079c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8b 08                	mov    (%eax),%ecx
+  80071d:	8d 40 04             	lea    0x4(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800723:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800728:	eb 72                	jmp    80079c <vprintfmt+0x429>
+	if (lflag >= 2)
+  80072a:	83 f9 01             	cmp    $0x1,%ecx
+  80072d:	7f 16                	jg     800745 <vprintfmt+0x3d2>
+	else if (lflag)
+  80072f:	85 c9                	test   %ecx,%ecx
+  800731:	74 24                	je     800757 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 08                	mov    (%eax),%ecx
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073e:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  800743:	eb 57                	jmp    80079c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8b 08                	mov    (%eax),%ecx
+  80074a:	8d 40 08             	lea    0x8(%eax),%eax
+  80074d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800750:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  800755:	eb 45                	jmp    80079c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800757:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075a:	8b 08                	mov    (%eax),%ecx
+  80075c:	8d 40 04             	lea    0x4(%eax),%eax
+  80075f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800762:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800767:	eb 33                	jmp    80079c <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800769:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80076c:	c1 e3 08             	shl    $0x8,%ebx
+  80076f:	83 ec 08             	sub    $0x8,%esp
+  800772:	ff 75 0c             	push   0xc(%ebp)
+  800775:	89 d8                	mov    %ebx,%eax
+  800777:	83 c8 30             	or     $0x30,%eax
+  80077a:	50                   	push   %eax
+  80077b:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  80077d:	83 c4 08             	add    $0x8,%esp
+  800780:	ff 75 0c             	push   0xc(%ebp)
+  800783:	83 cb 78             	or     $0x78,%ebx
+  800786:	53                   	push   %ebx
+  800787:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800789:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078c:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  80078e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800791:	8d 40 04             	lea    0x4(%eax),%eax
+  800794:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800797:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80079c:	ff 75 e4             	push   -0x1c(%ebp)
+  80079f:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007a3:	52                   	push   %edx
+  8007a4:	ff 75 e0             	push   -0x20(%ebp)
+  8007a7:	50                   	push   %eax
+  8007a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ab:	89 f8                	mov    %edi,%eax
+  8007ad:	e8 f7 fa ff ff       	call   8002a9 <printnum>
+			break;
+  8007b2:	83 c4 10             	add    $0x10,%esp
+  8007b5:	e9 e7 fb ff ff       	jmp    8003a1 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007ba:	83 f9 01             	cmp    $0x1,%ecx
+  8007bd:	7f 16                	jg     8007d5 <vprintfmt+0x462>
+	else if (lflag)
+  8007bf:	85 c9                	test   %ecx,%ecx
+  8007c1:	74 24                	je     8007e7 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c6:	8b 08                	mov    (%eax),%ecx
+  8007c8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007cb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ce:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8007d3:	eb c7                	jmp    80079c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d8:	8b 08                	mov    (%eax),%ecx
+  8007da:	8d 40 08             	lea    0x8(%eax),%eax
+  8007dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e0:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007e5:	eb b5                	jmp    80079c <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ea:	8b 08                	mov    (%eax),%ecx
+  8007ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ef:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f2:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  8007f7:	eb a3                	jmp    80079c <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  8007f9:	83 ec 08             	sub    $0x8,%esp
+  8007fc:	ff 75 0c             	push   0xc(%ebp)
+  8007ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800802:	c1 e0 08             	shl    $0x8,%eax
+  800805:	83 c8 25             	or     $0x25,%eax
+  800808:	50                   	push   %eax
+  800809:	ff d7                	call   *%edi
+			break;
+  80080b:	83 c4 10             	add    $0x10,%esp
+  80080e:	e9 8e fb ff ff       	jmp    8003a1 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  800813:	83 ec 08             	sub    $0x8,%esp
+  800816:	ff 75 0c             	push   0xc(%ebp)
+  800819:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80081c:	c1 e0 08             	shl    $0x8,%eax
+  80081f:	83 c8 25             	or     $0x25,%eax
+  800822:	50                   	push   %eax
+  800823:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800825:	83 c4 10             	add    $0x10,%esp
+  800828:	89 de                	mov    %ebx,%esi
+  80082a:	eb 03                	jmp    80082f <vprintfmt+0x4bc>
+  80082c:	83 ee 01             	sub    $0x1,%esi
+  80082f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800833:	75 f7                	jne    80082c <vprintfmt+0x4b9>
+  800835:	e9 67 fb ff ff       	jmp    8003a1 <vprintfmt+0x2e>
+
+0080083a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80083a:	55                   	push   %ebp
+  80083b:	89 e5                	mov    %esp,%ebp
+  80083d:	83 ec 18             	sub    $0x18,%esp
+  800840:	8b 45 08             	mov    0x8(%ebp),%eax
+  800843:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800846:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800849:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80084d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800850:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800857:	85 c0                	test   %eax,%eax
+  800859:	74 26                	je     800881 <vsnprintf+0x47>
+  80085b:	85 d2                	test   %edx,%edx
+  80085d:	7e 22                	jle    800881 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80085f:	ff 75 14             	push   0x14(%ebp)
+  800862:	ff 75 10             	push   0x10(%ebp)
+  800865:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800868:	50                   	push   %eax
+  800869:	68 39 03 80 00       	push   $0x800339
+  80086e:	e8 00 fb ff ff       	call   800373 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800873:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800876:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800879:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80087c:	83 c4 10             	add    $0x10,%esp
+}
+  80087f:	c9                   	leave
+  800880:	c3                   	ret
+		return -E_INVAL;
+  800881:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800886:	eb f7                	jmp    80087f <vsnprintf+0x45>
+
+00800888 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  80088e:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800891:	50                   	push   %eax
+  800892:	ff 75 10             	push   0x10(%ebp)
+  800895:	ff 75 0c             	push   0xc(%ebp)
+  800898:	ff 75 08             	push   0x8(%ebp)
+  80089b:	e8 9a ff ff ff       	call   80083a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008a0:	c9                   	leave
+  8008a1:	c3                   	ret
+
+008008a2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ad:	eb 03                	jmp    8008b2 <strlen+0x10>
+		n++;
+  8008af:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008b2:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008b6:	75 f7                	jne    8008af <strlen+0xd>
+	return n;
+}
+  8008b8:	5d                   	pop    %ebp
+  8008b9:	c3                   	ret
+
+008008ba <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008ba:	55                   	push   %ebp
+  8008bb:	89 e5                	mov    %esp,%ebp
+  8008bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c8:	eb 03                	jmp    8008cd <strnlen+0x13>
+		n++;
+  8008ca:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008cd:	39 d0                	cmp    %edx,%eax
+  8008cf:	74 08                	je     8008d9 <strnlen+0x1f>
+  8008d1:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008d5:	75 f3                	jne    8008ca <strnlen+0x10>
+  8008d7:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008d9:	89 d0                	mov    %edx,%eax
+  8008db:	5d                   	pop    %ebp
+  8008dc:	c3                   	ret
+
+008008dd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	53                   	push   %ebx
+  8008e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ec:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008f0:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008f3:	83 c0 01             	add    $0x1,%eax
+  8008f6:	84 d2                	test   %dl,%dl
+  8008f8:	75 f2                	jne    8008ec <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008fa:	89 c8                	mov    %ecx,%eax
+  8008fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ff:	c9                   	leave
+  800900:	c3                   	ret
+
+00800901 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	53                   	push   %ebx
+  800905:	83 ec 10             	sub    $0x10,%esp
+  800908:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80090b:	53                   	push   %ebx
+  80090c:	e8 91 ff ff ff       	call   8008a2 <strlen>
+  800911:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800914:	ff 75 0c             	push   0xc(%ebp)
+  800917:	01 d8                	add    %ebx,%eax
+  800919:	50                   	push   %eax
+  80091a:	e8 be ff ff ff       	call   8008dd <strcpy>
+	return dst;
+}
+  80091f:	89 d8                	mov    %ebx,%eax
+  800921:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800924:	c9                   	leave
+  800925:	c3                   	ret
+
+00800926 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800926:	55                   	push   %ebp
+  800927:	89 e5                	mov    %esp,%ebp
+  800929:	56                   	push   %esi
+  80092a:	53                   	push   %ebx
+  80092b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800931:	89 f3                	mov    %esi,%ebx
+  800933:	03 5d 10             	add    0x10(%ebp),%ebx
+  800936:	89 f0                	mov    %esi,%eax
+  800938:	eb 0f                	jmp    800949 <strncpy+0x23>
+		*dst++ = *src;
+  80093a:	83 c0 01             	add    $0x1,%eax
+  80093d:	0f b6 0a             	movzbl (%edx),%ecx
+  800940:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800943:	80 f9 01             	cmp    $0x1,%cl
+  800946:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800949:	39 d8                	cmp    %ebx,%eax
+  80094b:	75 ed                	jne    80093a <strncpy+0x14>
+	}
+	return ret;
+}
+  80094d:	89 f0                	mov    %esi,%eax
+  80094f:	5b                   	pop    %ebx
+  800950:	5e                   	pop    %esi
+  800951:	5d                   	pop    %ebp
+  800952:	c3                   	ret
+
+00800953 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800953:	55                   	push   %ebp
+  800954:	89 e5                	mov    %esp,%ebp
+  800956:	56                   	push   %esi
+  800957:	53                   	push   %ebx
+  800958:	8b 75 08             	mov    0x8(%ebp),%esi
+  80095b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80095e:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800961:	89 f0                	mov    %esi,%eax
+  800963:	85 d2                	test   %edx,%edx
+  800965:	74 21                	je     800988 <strlcpy+0x35>
+  800967:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80096b:	89 f2                	mov    %esi,%edx
+  80096d:	eb 09                	jmp    800978 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80096f:	83 c1 01             	add    $0x1,%ecx
+  800972:	83 c2 01             	add    $0x1,%edx
+  800975:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800978:	39 c2                	cmp    %eax,%edx
+  80097a:	74 09                	je     800985 <strlcpy+0x32>
+  80097c:	0f b6 19             	movzbl (%ecx),%ebx
+  80097f:	84 db                	test   %bl,%bl
+  800981:	75 ec                	jne    80096f <strlcpy+0x1c>
+  800983:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800985:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800988:	29 f0                	sub    %esi,%eax
+}
+  80098a:	5b                   	pop    %ebx
+  80098b:	5e                   	pop    %esi
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800994:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800997:	eb 06                	jmp    80099f <strcmp+0x11>
+		p++, q++;
+  800999:	83 c1 01             	add    $0x1,%ecx
+  80099c:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80099f:	0f b6 01             	movzbl (%ecx),%eax
+  8009a2:	84 c0                	test   %al,%al
+  8009a4:	74 04                	je     8009aa <strcmp+0x1c>
+  8009a6:	3a 02                	cmp    (%edx),%al
+  8009a8:	74 ef                	je     800999 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009aa:	0f b6 c0             	movzbl %al,%eax
+  8009ad:	0f b6 12             	movzbl (%edx),%edx
+  8009b0:	29 d0                	sub    %edx,%eax
+}
+  8009b2:	5d                   	pop    %ebp
+  8009b3:	c3                   	ret
+
+008009b4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009b4:	55                   	push   %ebp
+  8009b5:	89 e5                	mov    %esp,%ebp
+  8009b7:	53                   	push   %ebx
+  8009b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009be:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009c1:	eb 09                	jmp    8009cc <strncmp+0x18>
+		n--, p++, q++;
+  8009c3:	83 ea 01             	sub    $0x1,%edx
+  8009c6:	83 c0 01             	add    $0x1,%eax
+  8009c9:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009cc:	85 d2                	test   %edx,%edx
+  8009ce:	74 18                	je     8009e8 <strncmp+0x34>
+  8009d0:	0f b6 18             	movzbl (%eax),%ebx
+  8009d3:	84 db                	test   %bl,%bl
+  8009d5:	74 04                	je     8009db <strncmp+0x27>
+  8009d7:	3a 19                	cmp    (%ecx),%bl
+  8009d9:	74 e8                	je     8009c3 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009db:	0f b6 00             	movzbl (%eax),%eax
+  8009de:	0f b6 11             	movzbl (%ecx),%edx
+  8009e1:	29 d0                	sub    %edx,%eax
+}
+  8009e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009e6:	c9                   	leave
+  8009e7:	c3                   	ret
+		return 0;
+  8009e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ed:	eb f4                	jmp    8009e3 <strncmp+0x2f>
+
+008009ef <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009ef:	55                   	push   %ebp
+  8009f0:	89 e5                	mov    %esp,%ebp
+  8009f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009f9:	eb 03                	jmp    8009fe <strchr+0xf>
+  8009fb:	83 c0 01             	add    $0x1,%eax
+  8009fe:	0f b6 10             	movzbl (%eax),%edx
+  800a01:	84 d2                	test   %dl,%dl
+  800a03:	74 06                	je     800a0b <strchr+0x1c>
+		if (*s == c)
+  800a05:	38 ca                	cmp    %cl,%dl
+  800a07:	75 f2                	jne    8009fb <strchr+0xc>
+  800a09:	eb 05                	jmp    800a10 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a10:	5d                   	pop    %ebp
+  800a11:	c3                   	ret
+
+00800a12 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a1c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a1f:	38 ca                	cmp    %cl,%dl
+  800a21:	74 09                	je     800a2c <strfind+0x1a>
+  800a23:	84 d2                	test   %dl,%dl
+  800a25:	74 05                	je     800a2c <strfind+0x1a>
+	for (; *s; s++)
+  800a27:	83 c0 01             	add    $0x1,%eax
+  800a2a:	eb f0                	jmp    800a1c <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a2c:	5d                   	pop    %ebp
+  800a2d:	c3                   	ret
+
+00800a2e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a2e:	55                   	push   %ebp
+  800a2f:	89 e5                	mov    %esp,%ebp
+  800a31:	57                   	push   %edi
+  800a32:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a35:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a38:	85 c9                	test   %ecx,%ecx
+  800a3a:	74 20                	je     800a5c <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a3c:	89 f8                	mov    %edi,%eax
+  800a3e:	09 c8                	or     %ecx,%eax
+  800a40:	a8 03                	test   $0x3,%al
+  800a42:	75 12                	jne    800a56 <memset+0x28>
+		c &= 0xFF;
+  800a44:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a48:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a4e:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a51:	fc                   	cld
+  800a52:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a54:	eb 06                	jmp    800a5c <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a59:	fc                   	cld
+  800a5a:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a5c:	89 f8                	mov    %edi,%eax
+  800a5e:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a61:	c9                   	leave
+  800a62:	c3                   	ret
+
+00800a63 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a63:	55                   	push   %ebp
+  800a64:	89 e5                	mov    %esp,%ebp
+  800a66:	57                   	push   %edi
+  800a67:	56                   	push   %esi
+  800a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a6e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a71:	39 c6                	cmp    %eax,%esi
+  800a73:	73 32                	jae    800aa7 <memmove+0x44>
+  800a75:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a78:	39 d0                	cmp    %edx,%eax
+  800a7a:	73 2b                	jae    800aa7 <memmove+0x44>
+		s += n;
+		d += n;
+  800a7c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a7f:	89 d6                	mov    %edx,%esi
+  800a81:	09 fe                	or     %edi,%esi
+  800a83:	09 ce                	or     %ecx,%esi
+  800a85:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a8b:	75 0e                	jne    800a9b <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a8d:	83 ef 04             	sub    $0x4,%edi
+  800a90:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a93:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a96:	fd                   	std
+  800a97:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a99:	eb 09                	jmp    800aa4 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a9b:	83 ef 01             	sub    $0x1,%edi
+  800a9e:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aa1:	fd                   	std
+  800aa2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aa4:	fc                   	cld
+  800aa5:	eb 1a                	jmp    800ac1 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa7:	89 f2                	mov    %esi,%edx
+  800aa9:	09 c2                	or     %eax,%edx
+  800aab:	09 ca                	or     %ecx,%edx
+  800aad:	f6 c2 03             	test   $0x3,%dl
+  800ab0:	75 0a                	jne    800abc <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ab2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800ab5:	89 c7                	mov    %eax,%edi
+  800ab7:	fc                   	cld
+  800ab8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aba:	eb 05                	jmp    800ac1 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800abc:	89 c7                	mov    %eax,%edi
+  800abe:	fc                   	cld
+  800abf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ac1:	5e                   	pop    %esi
+  800ac2:	5f                   	pop    %edi
+  800ac3:	5d                   	pop    %ebp
+  800ac4:	c3                   	ret
+
+00800ac5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800acb:	ff 75 10             	push   0x10(%ebp)
+  800ace:	ff 75 0c             	push   0xc(%ebp)
+  800ad1:	ff 75 08             	push   0x8(%ebp)
+  800ad4:	e8 8a ff ff ff       	call   800a63 <memmove>
+}
+  800ad9:	c9                   	leave
+  800ada:	c3                   	ret
+
+00800adb <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	56                   	push   %esi
+  800adf:	53                   	push   %ebx
+  800ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ae6:	89 c6                	mov    %eax,%esi
+  800ae8:	03 75 10             	add    0x10(%ebp),%esi
+  800aeb:	eb 06                	jmp    800af3 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800aed:	83 c0 01             	add    $0x1,%eax
+  800af0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800af3:	39 f0                	cmp    %esi,%eax
+  800af5:	74 14                	je     800b0b <memcmp+0x30>
+		if (*s1 != *s2)
+  800af7:	0f b6 08             	movzbl (%eax),%ecx
+  800afa:	0f b6 1a             	movzbl (%edx),%ebx
+  800afd:	38 d9                	cmp    %bl,%cl
+  800aff:	74 ec                	je     800aed <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b01:	0f b6 c1             	movzbl %cl,%eax
+  800b04:	0f b6 db             	movzbl %bl,%ebx
+  800b07:	29 d8                	sub    %ebx,%eax
+  800b09:	eb 05                	jmp    800b10 <memcmp+0x35>
+	}
+
+	return 0;
+  800b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b10:	5b                   	pop    %ebx
+  800b11:	5e                   	pop    %esi
+  800b12:	5d                   	pop    %ebp
+  800b13:	c3                   	ret
+
+00800b14 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b14:	55                   	push   %ebp
+  800b15:	89 e5                	mov    %esp,%ebp
+  800b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b1d:	89 c2                	mov    %eax,%edx
+  800b1f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b22:	eb 03                	jmp    800b27 <memfind+0x13>
+  800b24:	83 c0 01             	add    $0x1,%eax
+  800b27:	39 d0                	cmp    %edx,%eax
+  800b29:	73 04                	jae    800b2f <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b2b:	38 08                	cmp    %cl,(%eax)
+  800b2d:	75 f5                	jne    800b24 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+
+00800b31 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	57                   	push   %edi
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  800b37:	83 ec 1c             	sub    $0x1c,%esp
+  800b3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b3d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b40:	eb 03                	jmp    800b45 <strtol+0x14>
+		s++;
+  800b42:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b45:	0f b6 06             	movzbl (%esi),%eax
+  800b48:	3c 20                	cmp    $0x20,%al
+  800b4a:	74 f6                	je     800b42 <strtol+0x11>
+  800b4c:	3c 09                	cmp    $0x9,%al
+  800b4e:	74 f2                	je     800b42 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b50:	3c 2b                	cmp    $0x2b,%al
+  800b52:	74 43                	je     800b97 <strtol+0x66>
+	int neg = 0;
+  800b54:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b59:	3c 2d                	cmp    $0x2d,%al
+  800b5b:	74 44                	je     800ba1 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b5d:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b63:	75 0f                	jne    800b74 <strtol+0x43>
+  800b65:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b68:	74 41                	je     800bab <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b6a:	85 ff                	test   %edi,%edi
+  800b6c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b71:	0f 44 f8             	cmove  %eax,%edi
+  800b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b79:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b7e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b81:	89 fb                	mov    %edi,%ebx
+  800b83:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b86:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b89:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b8c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b8f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b92:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b95:	eb 67                	jmp    800bfe <strtol+0xcd>
+		s++;
+  800b97:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b9f:	eb bc                	jmp    800b5d <strtol+0x2c>
+		s++, neg = 1;
+  800ba1:	83 c6 01             	add    $0x1,%esi
+  800ba4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ba9:	eb b2                	jmp    800b5d <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bab:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800baf:	74 0e                	je     800bbf <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800bb1:	85 ff                	test   %edi,%edi
+  800bb3:	75 bf                	jne    800b74 <strtol+0x43>
+		s++, base = 8;
+  800bb5:	83 c6 01             	add    $0x1,%esi
+  800bb8:	bf 08 00 00 00       	mov    $0x8,%edi
+  800bbd:	eb b5                	jmp    800b74 <strtol+0x43>
+		s += 2, base = 16;
+  800bbf:	83 c6 02             	add    $0x2,%esi
+  800bc2:	bf 10 00 00 00       	mov    $0x10,%edi
+  800bc7:	eb ab                	jmp    800b74 <strtol+0x43>
+			dig = *s - '0';
+  800bc9:	0f be c9             	movsbl %cl,%ecx
+  800bcc:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800bcf:	39 f9                	cmp    %edi,%ecx
+  800bd1:	7d 59                	jge    800c2c <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800bd3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800bd7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bda:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bdd:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800be0:	0f af d8             	imul   %eax,%ebx
+  800be3:	0f af d7             	imul   %edi,%edx
+  800be6:	01 d3                	add    %edx,%ebx
+  800be8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800beb:	f7 e7                	mul    %edi
+  800bed:	01 da                	add    %ebx,%edx
+  800bef:	89 cb                	mov    %ecx,%ebx
+  800bf1:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bf4:	01 c8                	add    %ecx,%eax
+  800bf6:	11 da                	adc    %ebx,%edx
+  800bf8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800bfb:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c01:	0f b6 08             	movzbl (%eax),%ecx
+  800c04:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c07:	80 fb 09             	cmp    $0x9,%bl
+  800c0a:	76 bd                	jbe    800bc9 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c0c:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c0f:	80 fb 19             	cmp    $0x19,%bl
+  800c12:	77 08                	ja     800c1c <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c14:	0f be c9             	movsbl %cl,%ecx
+  800c17:	83 e9 57             	sub    $0x57,%ecx
+  800c1a:	eb b3                	jmp    800bcf <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c1c:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c1f:	80 fb 19             	cmp    $0x19,%bl
+  800c22:	77 08                	ja     800c2c <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c24:	0f be c9             	movsbl %cl,%ecx
+  800c27:	83 e9 37             	sub    $0x37,%ecx
+  800c2a:	eb a3                	jmp    800bcf <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c2c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c2f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c32:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c38:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c3c:	74 05                	je     800c43 <strtol+0x112>
+		*endptr = (char *) s;
+  800c3e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c41:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c43:	85 c9                	test   %ecx,%ecx
+  800c45:	74 07                	je     800c4e <strtol+0x11d>
+  800c47:	f7 d8                	neg    %eax
+  800c49:	83 d2 00             	adc    $0x0,%edx
+  800c4c:	f7 da                	neg    %edx
+}
+  800c4e:	83 c4 1c             	add    $0x1c,%esp
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5f                   	pop    %edi
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+
+00800c56 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	57                   	push   %edi
+  800c5a:	56                   	push   %esi
+  800c5b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c5c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c63:	74 18                	je     800c7d <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c70:	89 c3                	mov    %eax,%ebx
+  800c72:	89 c7                	mov    %eax,%edi
+  800c74:	89 c6                	mov    %eax,%esi
+  800c76:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c78:	5b                   	pop    %ebx
+  800c79:	5e                   	pop    %esi
+  800c7a:	5f                   	pop    %edi
+  800c7b:	5d                   	pop    %ebp
+  800c7c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c88:	89 c3                	mov    %eax,%ebx
+  800c8a:	89 c7                	mov    %eax,%edi
+  800c8c:	55                   	push   %ebp
+  800c8d:	89 e5                	mov    %esp,%ebp
+  800c8f:	8d 35 97 0c 80 00    	lea    0x800c97,%esi
+  800c95:	0f 34                	sysenter
+  800c97:	5d                   	pop    %ebp
+		goto out;
+  800c98:	eb de                	jmp    800c78 <sys_cputs+0x22>
+
+00800c9a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c9a:	55                   	push   %ebp
+  800c9b:	89 e5                	mov    %esp,%ebp
+  800c9d:	57                   	push   %edi
+  800c9e:	56                   	push   %esi
+  800c9f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ca0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ca7:	74 19                	je     800cc2 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800ca9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cae:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cb3:	89 d1                	mov    %edx,%ecx
+  800cb5:	89 d3                	mov    %edx,%ebx
+  800cb7:	89 d7                	mov    %edx,%edi
+  800cb9:	89 d6                	mov    %edx,%esi
+  800cbb:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5f                   	pop    %edi
+  800cc0:	5d                   	pop    %ebp
+  800cc1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800cc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ccc:	89 d1                	mov    %edx,%ecx
+  800cce:	89 d3                	mov    %edx,%ebx
+  800cd0:	89 d7                	mov    %edx,%edi
+  800cd2:	55                   	push   %ebp
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	8d 35 dd 0c 80 00    	lea    0x800cdd,%esi
+  800cdb:	0f 34                	sysenter
+  800cdd:	5d                   	pop    %ebp
+		goto out;
+  800cde:	eb dd                	jmp    800cbd <sys_cgetc+0x23>
+
+00800ce0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+  800ce6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ce9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cf0:	74 21                	je     800d13 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cf2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cff:	89 cb                	mov    %ecx,%ebx
+  800d01:	89 cf                	mov    %ecx,%edi
+  800d03:	89 ce                	mov    %ecx,%esi
+  800d05:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d07:	85 c0                	test   %eax,%eax
+  800d09:	7f 27                	jg     800d32 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0e:	5b                   	pop    %ebx
+  800d0f:	5e                   	pop    %esi
+  800d10:	5f                   	pop    %edi
+  800d11:	5d                   	pop    %ebp
+  800d12:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d20:	89 cb                	mov    %ecx,%ebx
+  800d22:	89 cf                	mov    %ecx,%edi
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	8d 35 2f 0d 80 00    	lea    0x800d2f,%esi
+  800d2d:	0f 34                	sysenter
+  800d2f:	5d                   	pop    %ebp
+		goto out;
+  800d30:	eb d5                	jmp    800d07 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d32:	83 ec 0c             	sub    $0xc,%esp
+  800d35:	50                   	push   %eax
+  800d36:	6a 03                	push   $0x3
+  800d38:	68 cb 2f 80 00       	push   $0x802fcb
+  800d3d:	6a 3f                	push   $0x3f
+  800d3f:	68 e8 2f 80 00       	push   $0x802fe8
+  800d44:	e8 71 f4 ff ff       	call   8001ba <_panic>
+
+00800d49 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	57                   	push   %edi
+  800d4d:	56                   	push   %esi
+  800d4e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d4f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d56:	74 19                	je     800d71 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d62:	89 d1                	mov    %edx,%ecx
+  800d64:	89 d3                	mov    %edx,%ebx
+  800d66:	89 d7                	mov    %edx,%edi
+  800d68:	89 d6                	mov    %edx,%esi
+  800d6a:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d6c:	5b                   	pop    %ebx
+  800d6d:	5e                   	pop    %esi
+  800d6e:	5f                   	pop    %edi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d76:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d7b:	89 d1                	mov    %edx,%ecx
+  800d7d:	89 d3                	mov    %edx,%ebx
+  800d7f:	89 d7                	mov    %edx,%edi
+  800d81:	55                   	push   %ebp
+  800d82:	89 e5                	mov    %esp,%ebp
+  800d84:	8d 35 8c 0d 80 00    	lea    0x800d8c,%esi
+  800d8a:	0f 34                	sysenter
+  800d8c:	5d                   	pop    %ebp
+		goto out;
+  800d8d:	eb dd                	jmp    800d6c <sys_getenvid+0x23>
+
+00800d8f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d95:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d9c:	74 19                	je     800db7 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800da8:	89 d1                	mov    %edx,%ecx
+  800daa:	89 d3                	mov    %edx,%ebx
+  800dac:	89 d7                	mov    %edx,%edi
+  800dae:	89 d6                	mov    %edx,%esi
+  800db0:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800db2:	5b                   	pop    %ebx
+  800db3:	5e                   	pop    %esi
+  800db4:	5f                   	pop    %edi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dc1:	89 d1                	mov    %edx,%ecx
+  800dc3:	89 d3                	mov    %edx,%ebx
+  800dc5:	89 d7                	mov    %edx,%edi
+  800dc7:	55                   	push   %ebp
+  800dc8:	89 e5                	mov    %esp,%ebp
+  800dca:	8d 35 d2 0d 80 00    	lea    0x800dd2,%esi
+  800dd0:	0f 34                	sysenter
+  800dd2:	5d                   	pop    %ebp
+		goto out;
+  800dd3:	eb dd                	jmp    800db2 <sys_yield+0x23>
+
+00800dd5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800dde:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800de5:	74 23                	je     800e0a <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800de7:	be 00 00 00 00       	mov    $0x0,%esi
+  800dec:	b8 04 00 00 00       	mov    $0x4,%eax
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfa:	89 f7                	mov    %esi,%edi
+  800dfc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dfe:	85 c0                	test   %eax,%eax
+  800e00:	7f 29                	jg     800e2b <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e10:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e15:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1d:	55                   	push   %ebp
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	8d 35 28 0e 80 00    	lea    0x800e28,%esi
+  800e26:	0f 34                	sysenter
+  800e28:	5d                   	pop    %ebp
+		goto out;
+  800e29:	eb d3                	jmp    800dfe <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+  800e2e:	50                   	push   %eax
+  800e2f:	6a 04                	push   $0x4
+  800e31:	68 cb 2f 80 00       	push   $0x802fcb
+  800e36:	6a 3f                	push   $0x3f
+  800e38:	68 e8 2f 80 00       	push   $0x802fe8
+  800e3d:	e8 78 f3 ff ff       	call   8001ba <_panic>
+
+00800e42 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+  800e48:	83 ec 0c             	sub    $0xc,%esp
+  800e4b:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e4e:	85 f6                	test   %esi,%esi
+  800e50:	75 09                	jne    800e5b <sys_page_map+0x19>
+  800e52:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e59:	74 1f                	je     800e7a <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e5b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e69:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e6c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e6e:	85 c0                	test   %eax,%eax
+  800e70:	7f 27                	jg     800e99 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e75:	5b                   	pop    %ebx
+  800e76:	5e                   	pop    %esi
+  800e77:	5f                   	pop    %edi
+  800e78:	5d                   	pop    %ebp
+  800e79:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e80:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e88:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	8d 35 96 0e 80 00    	lea    0x800e96,%esi
+  800e94:	0f 34                	sysenter
+  800e96:	5d                   	pop    %ebp
+		goto out;
+  800e97:	eb d5                	jmp    800e6e <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	50                   	push   %eax
+  800e9d:	6a 05                	push   $0x5
+  800e9f:	68 cb 2f 80 00       	push   $0x802fcb
+  800ea4:	6a 3f                	push   $0x3f
+  800ea6:	68 e8 2f 80 00       	push   $0x802fe8
+  800eab:	e8 0a f3 ff ff       	call   8001ba <_panic>
+
+00800eb0 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	57                   	push   %edi
+  800eb4:	56                   	push   %esi
+  800eb5:	53                   	push   %ebx
+  800eb6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eb9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ec0:	74 22                	je     800ee4 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800ec2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ecc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed2:	89 df                	mov    %ebx,%edi
+  800ed4:	89 de                	mov    %ebx,%esi
+  800ed6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	7f 28                	jg     800f04 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800edc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edf:	5b                   	pop    %ebx
+  800ee0:	5e                   	pop    %esi
+  800ee1:	5f                   	pop    %edi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ee4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eef:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ef4:	89 df                	mov    %ebx,%edi
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	8d 35 01 0f 80 00    	lea    0x800f01,%esi
+  800eff:	0f 34                	sysenter
+  800f01:	5d                   	pop    %ebp
+		goto out;
+  800f02:	eb d4                	jmp    800ed8 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f04:	83 ec 0c             	sub    $0xc,%esp
+  800f07:	50                   	push   %eax
+  800f08:	6a 06                	push   $0x6
+  800f0a:	68 cb 2f 80 00       	push   $0x802fcb
+  800f0f:	6a 3f                	push   $0x3f
+  800f11:	68 e8 2f 80 00       	push   $0x802fe8
+  800f16:	e8 9f f2 ff ff       	call   8001ba <_panic>
+
+00800f1b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f1b:	55                   	push   %ebp
+  800f1c:	89 e5                	mov    %esp,%ebp
+  800f1e:	57                   	push   %edi
+  800f1f:	56                   	push   %esi
+  800f20:	53                   	push   %ebx
+  800f21:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f24:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f2b:	74 22                	je     800f4f <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f32:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3d:	89 df                	mov    %ebx,%edi
+  800f3f:	89 de                	mov    %ebx,%esi
+  800f41:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	7f 28                	jg     800f6f <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4a:	5b                   	pop    %ebx
+  800f4b:	5e                   	pop    %esi
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5a:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f5f:	89 df                	mov    %ebx,%edi
+  800f61:	55                   	push   %ebp
+  800f62:	89 e5                	mov    %esp,%ebp
+  800f64:	8d 35 6c 0f 80 00    	lea    0x800f6c,%esi
+  800f6a:	0f 34                	sysenter
+  800f6c:	5d                   	pop    %ebp
+		goto out;
+  800f6d:	eb d4                	jmp    800f43 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6f:	83 ec 0c             	sub    $0xc,%esp
+  800f72:	50                   	push   %eax
+  800f73:	6a 08                	push   $0x8
+  800f75:	68 cb 2f 80 00       	push   $0x802fcb
+  800f7a:	6a 3f                	push   $0x3f
+  800f7c:	68 e8 2f 80 00       	push   $0x802fe8
+  800f81:	e8 34 f2 ff ff       	call   8001ba <_panic>
+
+00800f86 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	57                   	push   %edi
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+  800f8c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f8f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f96:	74 22                	je     800fba <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9d:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fa2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa8:	89 df                	mov    %ebx,%edi
+  800faa:	89 de                	mov    %ebx,%esi
+  800fac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fae:	85 c0                	test   %eax,%eax
+  800fb0:	7f 28                	jg     800fda <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5f                   	pop    %edi
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc5:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fca:	89 df                	mov    %ebx,%edi
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	8d 35 d7 0f 80 00    	lea    0x800fd7,%esi
+  800fd5:	0f 34                	sysenter
+  800fd7:	5d                   	pop    %ebp
+		goto out;
+  800fd8:	eb d4                	jmp    800fae <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fda:	83 ec 0c             	sub    $0xc,%esp
+  800fdd:	50                   	push   %eax
+  800fde:	6a 09                	push   $0x9
+  800fe0:	68 cb 2f 80 00       	push   $0x802fcb
+  800fe5:	6a 3f                	push   $0x3f
+  800fe7:	68 e8 2f 80 00       	push   $0x802fe8
+  800fec:	e8 c9 f1 ff ff       	call   8001ba <_panic>
+
+00800ff1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+  800ff7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ffa:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801001:	74 22                	je     801025 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  801003:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801008:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80100d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801010:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801013:	89 df                	mov    %ebx,%edi
+  801015:	89 de                	mov    %ebx,%esi
+  801017:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801019:	85 c0                	test   %eax,%eax
+  80101b:	7f 28                	jg     801045 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80101d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801020:	5b                   	pop    %ebx
+  801021:	5e                   	pop    %esi
+  801022:	5f                   	pop    %edi
+  801023:	5d                   	pop    %ebp
+  801024:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801035:	89 df                	mov    %ebx,%edi
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	8d 35 42 10 80 00    	lea    0x801042,%esi
+  801040:	0f 34                	sysenter
+  801042:	5d                   	pop    %ebp
+		goto out;
+  801043:	eb d4                	jmp    801019 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801045:	83 ec 0c             	sub    $0xc,%esp
+  801048:	50                   	push   %eax
+  801049:	6a 0a                	push   $0xa
+  80104b:	68 cb 2f 80 00       	push   $0x802fcb
+  801050:	6a 3f                	push   $0x3f
+  801052:	68 e8 2f 80 00       	push   $0x802fe8
+  801057:	e8 5e f1 ff ff       	call   8001ba <_panic>
+
+0080105c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	57                   	push   %edi
+  801060:	56                   	push   %esi
+  801061:	53                   	push   %ebx
+  801062:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801065:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80106c:	74 22                	je     801090 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  80106e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801073:	b8 17 00 00 00       	mov    $0x17,%eax
+  801078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107e:	89 df                	mov    %ebx,%edi
+  801080:	89 de                	mov    %ebx,%esi
+  801082:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801084:	85 c0                	test   %eax,%eax
+  801086:	7f 28                	jg     8010b0 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108b:	5b                   	pop    %ebx
+  80108c:	5e                   	pop    %esi
+  80108d:	5f                   	pop    %edi
+  80108e:	5d                   	pop    %ebp
+  80108f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801090:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801095:	8b 55 08             	mov    0x8(%ebp),%edx
+  801098:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109b:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010a0:	89 df                	mov    %ebx,%edi
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	8d 35 ad 10 80 00    	lea    0x8010ad,%esi
+  8010ab:	0f 34                	sysenter
+  8010ad:	5d                   	pop    %ebp
+		goto out;
+  8010ae:	eb d4                	jmp    801084 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b0:	83 ec 0c             	sub    $0xc,%esp
+  8010b3:	50                   	push   %eax
+  8010b4:	6a 17                	push   $0x17
+  8010b6:	68 cb 2f 80 00       	push   $0x802fcb
+  8010bb:	6a 3f                	push   $0x3f
+  8010bd:	68 e8 2f 80 00       	push   $0x802fe8
+  8010c2:	e8 f3 f0 ff ff       	call   8001ba <_panic>
+
+008010c7 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+  8010cd:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010d0:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010d7:	74 22                	je     8010fb <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010de:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e9:	89 df                	mov    %ebx,%edi
+  8010eb:	89 de                	mov    %ebx,%esi
+  8010ed:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	7f 28                	jg     80111b <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801100:	8b 55 08             	mov    0x8(%ebp),%edx
+  801103:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801106:	b8 18 00 00 00       	mov    $0x18,%eax
+  80110b:	89 df                	mov    %ebx,%edi
+  80110d:	55                   	push   %ebp
+  80110e:	89 e5                	mov    %esp,%ebp
+  801110:	8d 35 18 11 80 00    	lea    0x801118,%esi
+  801116:	0f 34                	sysenter
+  801118:	5d                   	pop    %ebp
+		goto out;
+  801119:	eb d4                	jmp    8010ef <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80111b:	83 ec 0c             	sub    $0xc,%esp
+  80111e:	50                   	push   %eax
+  80111f:	6a 18                	push   $0x18
+  801121:	68 cb 2f 80 00       	push   $0x802fcb
+  801126:	6a 3f                	push   $0x3f
+  801128:	68 e8 2f 80 00       	push   $0x802fe8
+  80112d:	e8 88 f0 ff ff       	call   8001ba <_panic>
+
+00801132 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	57                   	push   %edi
+  801136:	56                   	push   %esi
+  801137:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801138:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80113f:	74 1d                	je     80115e <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  801141:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801146:	be 00 00 00 00       	mov    $0x0,%esi
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801151:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801154:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801157:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801159:	5b                   	pop    %ebx
+  80115a:	5e                   	pop    %esi
+  80115b:	5f                   	pop    %edi
+  80115c:	5d                   	pop    %ebp
+  80115d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801164:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801169:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	8d 35 7a 11 80 00    	lea    0x80117a,%esi
+  801178:	0f 34                	sysenter
+  80117a:	5d                   	pop    %ebp
+		goto out;
+  80117b:	eb dc                	jmp    801159 <sys_ipc_try_send+0x27>
+
+0080117d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801186:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80118d:	74 21                	je     8011b0 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  80118f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801194:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801199:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119c:	89 cb                	mov    %ecx,%ebx
+  80119e:	89 cf                	mov    %ecx,%edi
+  8011a0:	89 ce                	mov    %ecx,%esi
+  8011a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a4:	85 c0                	test   %eax,%eax
+  8011a6:	7f 27                	jg     8011cf <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ab:	5b                   	pop    %ebx
+  8011ac:	5e                   	pop    %esi
+  8011ad:	5f                   	pop    %edi
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011bd:	89 cb                	mov    %ecx,%ebx
+  8011bf:	89 cf                	mov    %ecx,%edi
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	8d 35 cc 11 80 00    	lea    0x8011cc,%esi
+  8011ca:	0f 34                	sysenter
+  8011cc:	5d                   	pop    %ebp
+		goto out;
+  8011cd:	eb d5                	jmp    8011a4 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011cf:	83 ec 0c             	sub    $0xc,%esp
+  8011d2:	50                   	push   %eax
+  8011d3:	6a 0d                	push   $0xd
+  8011d5:	68 cb 2f 80 00       	push   $0x802fcb
+  8011da:	6a 3f                	push   $0x3f
+  8011dc:	68 e8 2f 80 00       	push   $0x802fe8
+  8011e1:	e8 d4 ef ff ff       	call   8001ba <_panic>
+
+008011e6 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011ec:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011f3:	74 1b                	je     801210 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801202:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801205:	89 df                	mov    %ebx,%edi
+  801207:	89 de                	mov    %ebx,%esi
+  801209:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80120b:	5b                   	pop    %ebx
+  80120c:	5e                   	pop    %esi
+  80120d:	5f                   	pop    %edi
+  80120e:	5d                   	pop    %ebp
+  80120f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801215:	8b 55 08             	mov    0x8(%ebp),%edx
+  801218:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801220:	89 df                	mov    %ebx,%edi
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	8d 35 2d 12 80 00    	lea    0x80122d,%esi
+  80122b:	0f 34                	sysenter
+  80122d:	5d                   	pop    %ebp
+		goto out;
+  80122e:	eb db                	jmp    80120b <sys_ipc_recv_until+0x25>
+
+00801230 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	57                   	push   %edi
+  801234:	56                   	push   %esi
+  801235:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801236:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80123d:	74 19                	je     801258 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  80123f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801244:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801249:	89 d1                	mov    %edx,%ecx
+  80124b:	89 d3                	mov    %edx,%ebx
+  80124d:	89 d7                	mov    %edx,%edi
+  80124f:	89 d6                	mov    %edx,%esi
+  801251:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801253:	5b                   	pop    %ebx
+  801254:	5e                   	pop    %esi
+  801255:	5f                   	pop    %edi
+  801256:	5d                   	pop    %ebp
+  801257:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801262:	89 d1                	mov    %edx,%ecx
+  801264:	89 d3                	mov    %edx,%ebx
+  801266:	89 d7                	mov    %edx,%edi
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	8d 35 73 12 80 00    	lea    0x801273,%esi
+  801271:	0f 34                	sysenter
+  801273:	5d                   	pop    %ebp
+		goto out;
+  801274:	eb dd                	jmp    801253 <sys_time_msec+0x23>
+
+00801276 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801276:	55                   	push   %ebp
+  801277:	89 e5                	mov    %esp,%ebp
+  801279:	57                   	push   %edi
+  80127a:	56                   	push   %esi
+  80127b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80127c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801283:	74 1a                	je     80129f <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801285:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80128a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80128f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801292:	89 cb                	mov    %ecx,%ebx
+  801294:	89 cf                	mov    %ecx,%edi
+  801296:	89 ce                	mov    %ecx,%esi
+  801298:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80129a:	5b                   	pop    %ebx
+  80129b:	5e                   	pop    %esi
+  80129c:	5f                   	pop    %edi
+  80129d:	5d                   	pop    %ebp
+  80129e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80129f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012a7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012ac:	89 cb                	mov    %ecx,%ebx
+  8012ae:	89 cf                	mov    %ecx,%edi
+  8012b0:	55                   	push   %ebp
+  8012b1:	89 e5                	mov    %esp,%ebp
+  8012b3:	8d 35 bb 12 80 00    	lea    0x8012bb,%esi
+  8012b9:	0f 34                	sysenter
+  8012bb:	5d                   	pop    %ebp
+		goto out;
+  8012bc:	eb dc                	jmp    80129a <sys_sleep_until+0x24>
+
+008012be <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	57                   	push   %edi
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012c4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012cb:	74 1a                	je     8012e7 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8012cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012d2:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012da:	89 cb                	mov    %ecx,%ebx
+  8012dc:	89 cf                	mov    %ecx,%edi
+  8012de:	89 ce                	mov    %ecx,%esi
+  8012e0:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012e2:	5b                   	pop    %ebx
+  8012e3:	5e                   	pop    %esi
+  8012e4:	5f                   	pop    %edi
+  8012e5:	5d                   	pop    %ebp
+  8012e6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ef:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012f4:	89 cb                	mov    %ecx,%ebx
+  8012f6:	89 cf                	mov    %ecx,%edi
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	8d 35 03 13 80 00    	lea    0x801303,%esi
+  801301:	0f 34                	sysenter
+  801303:	5d                   	pop    %ebp
+		goto out;
+  801304:	eb dc                	jmp    8012e2 <sys_env_print_stats+0x24>
+
+00801306 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	57                   	push   %edi
+  80130a:	56                   	push   %esi
+  80130b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80130c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801313:	74 1b                	je     801330 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  801315:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131a:	b8 19 00 00 00       	mov    $0x19,%eax
+  80131f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801322:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801325:	89 df                	mov    %ebx,%edi
+  801327:	89 de                	mov    %ebx,%esi
+  801329:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  80132b:	5b                   	pop    %ebx
+  80132c:	5e                   	pop    %esi
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801335:	8b 55 08             	mov    0x8(%ebp),%edx
+  801338:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133b:	b8 19 00 00 00       	mov    $0x19,%eax
+  801340:	89 df                	mov    %ebx,%edi
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	8d 35 4d 13 80 00    	lea    0x80134d,%esi
+  80134b:	0f 34                	sysenter
+  80134d:	5d                   	pop    %ebp
+		goto out;
+  80134e:	eb db                	jmp    80132b <sys_perf+0x25>
+
+00801350 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801350:	55                   	push   %ebp
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	57                   	push   %edi
+  801354:	56                   	push   %esi
+  801355:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801356:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80135d:	74 19                	je     801378 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  80135f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801364:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801369:	89 d1                	mov    %edx,%ecx
+  80136b:	89 d3                	mov    %edx,%ebx
+  80136d:	89 d7                	mov    %edx,%edi
+  80136f:	89 d6                	mov    %edx,%esi
+  801371:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801373:	5b                   	pop    %ebx
+  801374:	5e                   	pop    %esi
+  801375:	5f                   	pop    %edi
+  801376:	5d                   	pop    %ebp
+  801377:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801382:	89 d1                	mov    %edx,%ecx
+  801384:	89 d3                	mov    %edx,%ebx
+  801386:	89 d7                	mov    %edx,%edi
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	8d 35 93 13 80 00    	lea    0x801393,%esi
+  801391:	0f 34                	sysenter
+  801393:	5d                   	pop    %ebp
+		goto out;
+  801394:	eb dd                	jmp    801373 <sys_fork+0x23>
+
+00801396 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	57                   	push   %edi
+  80139a:	56                   	push   %esi
+  80139b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80139c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013a3:	74 1c                	je     8013c1 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013aa:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b8:	89 f7                	mov    %esi,%edi
+  8013ba:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5f                   	pop    %edi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	8d 35 df 13 80 00    	lea    0x8013df,%esi
+  8013dd:	0f 34                	sysenter
+  8013df:	5d                   	pop    %ebp
+		goto out;
+  8013e0:	eb da                	jmp    8013bc <sys_thread_create+0x26>
+
+008013e2 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+  8013e5:	57                   	push   %edi
+  8013e6:	56                   	push   %esi
+  8013e7:	53                   	push   %ebx
+  8013e8:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013eb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013f2:	74 24                	je     801418 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013f4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801401:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801404:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801407:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80140a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80140c:	85 c0                	test   %eax,%eax
+  80140e:	7f 27                	jg     801437 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801413:	5b                   	pop    %ebx
+  801414:	5e                   	pop    %esi
+  801415:	5f                   	pop    %edi
+  801416:	5d                   	pop    %ebp
+  801417:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801418:	8b 55 08             	mov    0x8(%ebp),%edx
+  80141b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801423:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801426:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	8d 35 34 14 80 00    	lea    0x801434,%esi
+  801432:	0f 34                	sysenter
+  801434:	5d                   	pop    %ebp
+		goto out;
+  801435:	eb d5                	jmp    80140c <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801437:	83 ec 0c             	sub    $0xc,%esp
+  80143a:	50                   	push   %eax
+  80143b:	6a 1f                	push   $0x1f
+  80143d:	68 cb 2f 80 00       	push   $0x802fcb
+  801442:	6a 3f                	push   $0x3f
+  801444:	68 e8 2f 80 00       	push   $0x802fe8
+  801449:	e8 6c ed ff ff       	call   8001ba <_panic>
+
+0080144e <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	57                   	push   %edi
+  801452:	56                   	push   %esi
+  801453:	53                   	push   %ebx
+  801454:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801457:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80145e:	74 23                	je     801483 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801460:	be 00 00 00 00       	mov    $0x0,%esi
+  801465:	b8 20 00 00 00       	mov    $0x20,%eax
+  80146a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801470:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801473:	89 f7                	mov    %esi,%edi
+  801475:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801477:	85 c0                	test   %eax,%eax
+  801479:	7f 29                	jg     8014a4 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80147b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147e:	5b                   	pop    %ebx
+  80147f:	5e                   	pop    %esi
+  801480:	5f                   	pop    %edi
+  801481:	5d                   	pop    %ebp
+  801482:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801483:	8b 55 08             	mov    0x8(%ebp),%edx
+  801486:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801489:	b8 20 00 00 00       	mov    $0x20,%eax
+  80148e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801493:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801496:	55                   	push   %ebp
+  801497:	89 e5                	mov    %esp,%ebp
+  801499:	8d 35 a1 14 80 00    	lea    0x8014a1,%esi
+  80149f:	0f 34                	sysenter
+  8014a1:	5d                   	pop    %ebp
+		goto out;
+  8014a2:	eb d3                	jmp    801477 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014a4:	83 ec 0c             	sub    $0xc,%esp
+  8014a7:	50                   	push   %eax
+  8014a8:	6a 20                	push   $0x20
+  8014aa:	68 cb 2f 80 00       	push   $0x802fcb
+  8014af:	6a 3f                	push   $0x3f
+  8014b1:	68 e8 2f 80 00       	push   $0x802fe8
+  8014b6:	e8 ff ec ff ff       	call   8001ba <_panic>
+
+008014bb <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014bb:	55                   	push   %ebp
+  8014bc:	89 e5                	mov    %esp,%ebp
+  8014be:	57                   	push   %edi
+  8014bf:	56                   	push   %esi
+  8014c0:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014c1:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014c8:	74 1b                	je     8014e5 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8014ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cf:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014da:	89 df                	mov    %ebx,%edi
+  8014dc:	89 de                	mov    %ebx,%esi
+  8014de:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014e0:	5b                   	pop    %ebx
+  8014e1:	5e                   	pop    %esi
+  8014e2:	5f                   	pop    %edi
+  8014e3:	5d                   	pop    %ebp
+  8014e4:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014f5:	89 df                	mov    %ebx,%edi
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	8d 35 02 15 80 00    	lea    0x801502,%esi
+  801500:	0f 34                	sysenter
+  801502:	5d                   	pop    %ebp
+		goto out;
+  801503:	eb db                	jmp    8014e0 <sys_batch+0x25>
+
+00801505 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801505:	55                   	push   %ebp
+  801506:	89 e5                	mov    %esp,%ebp
+  801508:	57                   	push   %edi
+  801509:	56                   	push   %esi
+  80150a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80150b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801512:	74 1a                	je     80152e <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  801514:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801519:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80151e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801521:	89 cb                	mov    %ecx,%ebx
+  801523:	89 cf                	mov    %ecx,%edi
+  801525:	89 ce                	mov    %ecx,%esi
+  801527:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801529:	5b                   	pop    %ebx
+  80152a:	5e                   	pop    %esi
+  80152b:	5f                   	pop    %edi
+  80152c:	5d                   	pop    %ebp
+  80152d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80152e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801531:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801536:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80153b:	89 cb                	mov    %ecx,%ebx
+  80153d:	89 cf                	mov    %ecx,%edi
+  80153f:	55                   	push   %ebp
+  801540:	89 e5                	mov    %esp,%ebp
+  801542:	8d 35 4a 15 80 00    	lea    0x80154a,%esi
+  801548:	0f 34                	sysenter
+  80154a:	5d                   	pop    %ebp
+		goto out;
+  80154b:	eb dc                	jmp    801529 <sys_trace_ctl+0x24>
+
+0080154d <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  80154d:	55                   	push   %ebp
+  80154e:	89 e5                	mov    %esp,%ebp
+  801550:	57                   	push   %edi
+  801551:	56                   	push   %esi
+  801552:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801553:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80155a:	74 1c                	je     801578 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  80155c:	be 00 00 00 00       	mov    $0x0,%esi
+  801561:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801566:	8b 55 08             	mov    0x8(%ebp),%edx
+  801569:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80156c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156f:	89 f7                	mov    %esi,%edi
+  801571:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801573:	5b                   	pop    %ebx
+  801574:	5e                   	pop    %esi
+  801575:	5f                   	pop    %edi
+  801576:	5d                   	pop    %ebp
+  801577:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801578:	8b 55 08             	mov    0x8(%ebp),%edx
+  80157b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801583:	bf 00 00 00 00       	mov    $0x0,%edi
+  801588:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	8d 35 96 15 80 00    	lea    0x801596,%esi
+  801594:	0f 34                	sysenter
+  801596:	5d                   	pop    %ebp
+		goto out;
+  801597:	eb da                	jmp    801573 <sys_trace_read+0x26>
+
+00801599 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  801599:	55                   	push   %ebp
+  80159a:	89 e5                	mov    %esp,%ebp
+  80159c:	57                   	push   %edi
+  80159d:	56                   	push   %esi
+  80159e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80159f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015a6:	74 1c                	je     8015c4 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8015a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ad:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015bb:	89 f7                	mov    %esi,%edi
+  8015bd:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015bf:	5b                   	pop    %ebx
+  8015c0:	5e                   	pop    %esi
+  8015c1:	5f                   	pop    %edi
+  8015c2:	5d                   	pop    %ebp
+  8015c3:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015ca:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015d7:	55                   	push   %ebp
+  8015d8:	89 e5                	mov    %esp,%ebp
+  8015da:	8d 35 e2 15 80 00    	lea    0x8015e2,%esi
+  8015e0:	0f 34                	sysenter
+  8015e2:	5d                   	pop    %ebp
+		goto out;
+  8015e3:	eb da                	jmp    8015bf <sys_meminfo+0x26>
+
+008015e5 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015e5:	55                   	push   %ebp
+  8015e6:	89 e5                	mov    %esp,%ebp
+  8015e8:	57                   	push   %edi
+  8015e9:	56                   	push   %esi
+  8015ea:	53                   	push   %ebx
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015ee:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015f2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015f9:	74 1f                	je     80161a <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  8015fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801600:	b8 22 00 00 00       	mov    $0x22,%eax
+  801605:	8b 55 08             	mov    0x8(%ebp),%edx
+  801608:	89 df                	mov    %ebx,%edi
+  80160a:	89 de                	mov    %ebx,%esi
+  80160c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	7f 25                	jg     801637 <sys_env_set_ksm+0x52>
+}
+  801612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80161a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801622:	b8 22 00 00 00       	mov    $0x22,%eax
+  801627:	89 df                	mov    %ebx,%edi
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	8d 35 34 16 80 00    	lea    0x801634,%esi
+  801632:	0f 34                	sysenter
+  801634:	5d                   	pop    %ebp
+		goto out;
+  801635:	eb d7                	jmp    80160e <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801637:	83 ec 0c             	sub    $0xc,%esp
+  80163a:	50                   	push   %eax
+  80163b:	6a 22                	push   $0x22
+  80163d:	68 cb 2f 80 00       	push   $0x802fcb
+  801642:	6a 3f                	push   $0x3f
+  801644:	68 e8 2f 80 00       	push   $0x802fe8
+  801649:	e8 6c eb ff ff       	call   8001ba <_panic>
+
+0080164e <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  80164e:	55                   	push   %ebp
+  80164f:	89 e5                	mov    %esp,%ebp
+  801651:	57                   	push   %edi
+  801652:	56                   	push   %esi
+  801653:	53                   	push   %ebx
+  801654:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801657:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  80165a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801661:	74 24                	je     801687 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  801663:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801668:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80166d:	89 cb                	mov    %ecx,%ebx
+  80166f:	89 cf                	mov    %ecx,%edi
+  801671:	89 ce                	mov    %ecx,%esi
+  801673:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801675:	85 c0                	test   %eax,%eax
+  801677:	7f 2a                	jg     8016a3 <sys_time_nsec+0x55>
+	return ns;
+}
+  801679:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80167c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80167f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801682:	5b                   	pop    %ebx
+  801683:	5e                   	pop    %esi
+  801684:	5f                   	pop    %edi
+  801685:	5d                   	pop    %ebp
+  801686:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801687:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80168c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801691:	89 cb                	mov    %ecx,%ebx
+  801693:	89 cf                	mov    %ecx,%edi
+  801695:	55                   	push   %ebp
+  801696:	89 e5                	mov    %esp,%ebp
+  801698:	8d 35 a0 16 80 00    	lea    0x8016a0,%esi
+  80169e:	0f 34                	sysenter
+  8016a0:	5d                   	pop    %ebp
+		goto out;
+  8016a1:	eb d2                	jmp    801675 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016a3:	83 ec 0c             	sub    $0xc,%esp
+  8016a6:	50                   	push   %eax
+  8016a7:	6a 0f                	push   $0xf
+  8016a9:	68 cb 2f 80 00       	push   $0x802fcb
+  8016ae:	6a 3f                	push   $0x3f
+  8016b0:	68 e8 2f 80 00       	push   $0x802fe8
+  8016b5:	e8 00 eb ff ff       	call   8001ba <_panic>
+
+008016ba <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016ba:	55                   	push   %ebp
+  8016bb:	89 e5                	mov    %esp,%ebp
+  8016bd:	57                   	push   %edi
+  8016be:	56                   	push   %esi
+  8016bf:	53                   	push   %ebx
+  8016c0:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016c3:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016ca:	74 22                	je     8016ee <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8016cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016dc:	89 df                	mov    %ebx,%edi
+  8016de:	89 de                	mov    %ebx,%esi
+  8016e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	7f 28                	jg     80170e <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e9:	5b                   	pop    %ebx
+  8016ea:	5e                   	pop    %esi
+  8016eb:	5f                   	pop    %edi
+  8016ec:	5d                   	pop    %ebp
+  8016ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f9:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016fe:	89 df                	mov    %ebx,%edi
+  801700:	55                   	push   %ebp
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	8d 35 0b 17 80 00    	lea    0x80170b,%esi
+  801709:	0f 34                	sysenter
+  80170b:	5d                   	pop    %ebp
+		goto out;
+  80170c:	eb d4                	jmp    8016e2 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80170e:	83 ec 0c             	sub    $0xc,%esp
+  801711:	50                   	push   %eax
+  801712:	6a 12                	push   $0x12
+  801714:	68 cb 2f 80 00       	push   $0x802fcb
+  801719:	6a 3f                	push   $0x3f
+  80171b:	68 e8 2f 80 00       	push   $0x802fe8
+  801720:	e8 95 ea ff ff       	call   8001ba <_panic>
+
+00801725 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  801725:	55                   	push   %ebp
+  801726:	89 e5                	mov    %esp,%ebp
+  801728:	57                   	push   %edi
+  801729:	56                   	push   %esi
+  80172a:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80172b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801732:	74 1b                	je     80174f <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  801734:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801739:	b8 13 00 00 00       	mov    $0x13,%eax
+  80173e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801741:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801744:	89 df                	mov    %ebx,%edi
+  801746:	89 de                	mov    %ebx,%esi
+  801748:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80174a:	5b                   	pop    %ebx
+  80174b:	5e                   	pop    %esi
+  80174c:	5f                   	pop    %edi
+  80174d:	5d                   	pop    %ebp
+  80174e:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80174f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801754:	8b 55 08             	mov    0x8(%ebp),%edx
+  801757:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80175f:	89 df                	mov    %ebx,%edi
+  801761:	55                   	push   %ebp
+  801762:	89 e5                	mov    %esp,%ebp
+  801764:	8d 35 6c 17 80 00    	lea    0x80176c,%esi
+  80176a:	0f 34                	sysenter
+  80176c:	5d                   	pop    %ebp
+		goto out;
+  80176d:	eb db                	jmp    80174a <sys_e1000_receive+0x25>
+
+0080176f <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	57                   	push   %edi
+  801773:	56                   	push   %esi
+  801774:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801775:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80177c:	74 1b                	je     801799 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  80177e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801783:	b8 14 00 00 00       	mov    $0x14,%eax
+  801788:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80178e:	89 df                	mov    %ebx,%edi
+  801790:	89 de                	mov    %ebx,%esi
+  801792:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801794:	5b                   	pop    %ebx
+  801795:	5e                   	pop    %esi
+  801796:	5f                   	pop    %edi
+  801797:	5d                   	pop    %ebp
+  801798:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801799:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017a4:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017a9:	89 df                	mov    %ebx,%edi
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	8d 35 b6 17 80 00    	lea    0x8017b6,%esi
+  8017b4:	0f 34                	sysenter
+  8017b6:	5d                   	pop    %ebp
+		goto out;
+  8017b7:	eb db                	jmp    801794 <sys_e1000_read_hwaddr+0x25>
+
+008017b9 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017b9:	55                   	push   %ebp
+  8017ba:	89 e5                	mov    %esp,%ebp
+  8017bc:	57                   	push   %edi
+  8017bd:	56                   	push   %esi
+  8017be:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017bf:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017c6:	74 1a                	je     8017e2 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8017c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017cd:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d5:	89 cb                	mov    %ecx,%ebx
+  8017d7:	89 cf                	mov    %ecx,%edi
+  8017d9:	89 ce                	mov    %ecx,%esi
+  8017db:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017dd:	5b                   	pop    %ebx
+  8017de:	5e                   	pop    %esi
+  8017df:	5f                   	pop    %edi
+  8017e0:	5d                   	pop    %ebp
+  8017e1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017ea:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017ef:	89 cb                	mov    %ecx,%ebx
+  8017f1:	89 cf                	mov    %ecx,%edi
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	8d 35 fe 17 80 00    	lea    0x8017fe,%esi
+  8017fc:	0f 34                	sysenter
+  8017fe:	5d                   	pop    %ebp
+		goto out;
+  8017ff:	eb dc                	jmp    8017dd <sys_sb16_read_version+0x24>
+
+00801801 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801801:	55                   	push   %ebp
+  801802:	89 e5                	mov    %esp,%ebp
+  801804:	57                   	push   %edi
+  801805:	56                   	push   %esi
+  801806:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801807:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80180e:	74 1b                	je     80182b <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801810:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801815:	b8 16 00 00 00       	mov    $0x16,%eax
+  80181a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80181d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801820:	89 df                	mov    %ebx,%edi
+  801822:	89 de                	mov    %ebx,%esi
+  801824:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  801826:	5b                   	pop    %ebx
+  801827:	5e                   	pop    %esi
+  801828:	5f                   	pop    %edi
+  801829:	5d                   	pop    %ebp
+  80182a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80182b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801830:	8b 55 08             	mov    0x8(%ebp),%edx
+  801833:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801836:	b8 16 00 00 00       	mov    $0x16,%eax
+  80183b:	89 df                	mov    %ebx,%edi
+  80183d:	55                   	push   %ebp
+  80183e:	89 e5                	mov    %esp,%ebp
+  801840:	8d 35 48 18 80 00    	lea    0x801848,%esi
+  801846:	0f 34                	sysenter
+  801848:	5d                   	pop    %ebp
+		goto out;
+  801849:	eb db                	jmp    801826 <sys_sb16_play+0x25>
+
+0080184b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80184b:	55                   	push   %ebp
+  80184c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80184e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801851:	05 00 00 00 30       	add    $0x30000000,%eax
+  801856:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801859:	5d                   	pop    %ebp
+  80185a:	c3                   	ret
+
+0080185b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80185b:	55                   	push   %ebp
+  80185c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80185e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801861:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801866:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80186b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801870:	5d                   	pop    %ebp
+  801871:	c3                   	ret
+
+00801872 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801875:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80187a:	eb 02                	jmp    80187e <fd_alloc+0xc>
+  80187c:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80187e:	89 c2                	mov    %eax,%edx
+  801880:	c1 ea 16             	shr    $0x16,%edx
+  801883:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80188a:	f6 c2 01             	test   $0x1,%dl
+  80188d:	74 2b                	je     8018ba <fd_alloc+0x48>
+  80188f:	89 c2                	mov    %eax,%edx
+  801891:	c1 ea 0c             	shr    $0xc,%edx
+  801894:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80189b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018a1:	f6 c1 01             	test   $0x1,%cl
+  8018a4:	74 14                	je     8018ba <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018a6:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018ac:	75 ce                	jne    80187c <fd_alloc+0xa>
+  8018ae:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018b3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018b8:	eb 05                	jmp    8018bf <fd_alloc+0x4d>
+			return 0;
+  8018ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c2:	89 02                	mov    %eax,(%edx)
+}
+  8018c4:	89 c8                	mov    %ecx,%eax
+  8018c6:	5d                   	pop    %ebp
+  8018c7:	c3                   	ret
+
+008018c8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018c8:	55                   	push   %ebp
+  8018c9:	89 e5                	mov    %esp,%ebp
+  8018cb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018ce:	83 f8 1f             	cmp    $0x1f,%eax
+  8018d1:	77 30                	ja     801903 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018d3:	c1 e0 0c             	shl    $0xc,%eax
+  8018d6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018db:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018e1:	f6 c2 01             	test   $0x1,%dl
+  8018e4:	74 24                	je     80190a <fd_lookup+0x42>
+  8018e6:	89 c2                	mov    %eax,%edx
+  8018e8:	c1 ea 0c             	shr    $0xc,%edx
+  8018eb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018f2:	f6 c2 01             	test   $0x1,%dl
+  8018f5:	74 1a                	je     801911 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8018f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018fa:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8018fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801901:	5d                   	pop    %ebp
+  801902:	c3                   	ret
+		return -E_INVAL;
+  801903:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801908:	eb f7                	jmp    801901 <fd_lookup+0x39>
+		return -E_INVAL;
+  80190a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80190f:	eb f0                	jmp    801901 <fd_lookup+0x39>
+  801911:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801916:	eb e9                	jmp    801901 <fd_lookup+0x39>
+
+00801918 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801918:	55                   	push   %ebp
+  801919:	89 e5                	mov    %esp,%ebp
+  80191b:	53                   	push   %ebx
+  80191c:	83 ec 04             	sub    $0x4,%esp
+  80191f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801922:	b8 00 00 00 00       	mov    $0x0,%eax
+  801927:	eb 03                	jmp    80192c <dev_lookup+0x14>
+  801929:	83 c0 01             	add    $0x1,%eax
+  80192c:	8b 1c 85 74 30 80 00 	mov    0x803074(,%eax,4),%ebx
+  801933:	85 db                	test   %ebx,%ebx
+  801935:	74 0b                	je     801942 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801937:	39 13                	cmp    %edx,(%ebx)
+  801939:	75 ee                	jne    801929 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80193b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801940:	eb 2e                	jmp    801970 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801942:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801944:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801949:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80194f:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801954:	76 24                	jbe    80197a <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801956:	8b 41 48             	mov    0x48(%ecx),%eax
+  801959:	83 ec 04             	sub    $0x4,%esp
+  80195c:	52                   	push   %edx
+  80195d:	50                   	push   %eax
+  80195e:	68 f8 2f 80 00       	push   $0x802ff8
+  801963:	e8 2d e9 ff ff       	call   800295 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801968:	83 c4 10             	add    $0x10,%esp
+  80196b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801970:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801973:	89 1a                	mov    %ebx,(%edx)
+}
+  801975:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801978:	c9                   	leave
+  801979:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80197a:	c1 e8 10             	shr    $0x10,%eax
+  80197d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801983:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801989:	eb cb                	jmp    801956 <dev_lookup+0x3e>
+
+0080198b <fd_close>:
+{
+  80198b:	55                   	push   %ebp
+  80198c:	89 e5                	mov    %esp,%ebp
+  80198e:	57                   	push   %edi
+  80198f:	56                   	push   %esi
+  801990:	53                   	push   %ebx
+  801991:	83 ec 24             	sub    $0x24,%esp
+  801994:	8b 75 08             	mov    0x8(%ebp),%esi
+  801997:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80199a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80199d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80199e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019a4:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019a7:	50                   	push   %eax
+  8019a8:	e8 1b ff ff ff       	call   8018c8 <fd_lookup>
+  8019ad:	89 c3                	mov    %eax,%ebx
+  8019af:	83 c4 10             	add    $0x10,%esp
+  8019b2:	85 c0                	test   %eax,%eax
+  8019b4:	78 05                	js     8019bb <fd_close+0x30>
+	    || fd != fd2)
+  8019b6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019b9:	74 16                	je     8019d1 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019bb:	89 f8                	mov    %edi,%eax
+  8019bd:	84 c0                	test   %al,%al
+  8019bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019c7:	89 d8                	mov    %ebx,%eax
+  8019c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019cc:	5b                   	pop    %ebx
+  8019cd:	5e                   	pop    %esi
+  8019ce:	5f                   	pop    %edi
+  8019cf:	5d                   	pop    %ebp
+  8019d0:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019d1:	83 ec 08             	sub    $0x8,%esp
+  8019d4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019d7:	50                   	push   %eax
+  8019d8:	ff 36                	push   (%esi)
+  8019da:	e8 39 ff ff ff       	call   801918 <dev_lookup>
+  8019df:	89 c3                	mov    %eax,%ebx
+  8019e1:	83 c4 10             	add    $0x10,%esp
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	78 1a                	js     801a02 <fd_close+0x77>
+		if (dev->dev_close)
+  8019e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019eb:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019f3:	85 c0                	test   %eax,%eax
+  8019f5:	74 0b                	je     801a02 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8019f7:	83 ec 0c             	sub    $0xc,%esp
+  8019fa:	56                   	push   %esi
+  8019fb:	ff d0                	call   *%eax
+  8019fd:	89 c3                	mov    %eax,%ebx
+  8019ff:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a02:	83 ec 08             	sub    $0x8,%esp
+  801a05:	56                   	push   %esi
+  801a06:	6a 00                	push   $0x0
+  801a08:	e8 a3 f4 ff ff       	call   800eb0 <sys_page_unmap>
+	return r;
+  801a0d:	83 c4 10             	add    $0x10,%esp
+  801a10:	eb b5                	jmp    8019c7 <fd_close+0x3c>
+
+00801a12 <close>:
+
+int
+close(int fdnum)
+{
+  801a12:	55                   	push   %ebp
+  801a13:	89 e5                	mov    %esp,%ebp
+  801a15:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a18:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a1b:	50                   	push   %eax
+  801a1c:	ff 75 08             	push   0x8(%ebp)
+  801a1f:	e8 a4 fe ff ff       	call   8018c8 <fd_lookup>
+  801a24:	83 c4 10             	add    $0x10,%esp
+  801a27:	85 c0                	test   %eax,%eax
+  801a29:	79 02                	jns    801a2d <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a2b:	c9                   	leave
+  801a2c:	c3                   	ret
+		return fd_close(fd, 1);
+  801a2d:	83 ec 08             	sub    $0x8,%esp
+  801a30:	6a 01                	push   $0x1
+  801a32:	ff 75 f4             	push   -0xc(%ebp)
+  801a35:	e8 51 ff ff ff       	call   80198b <fd_close>
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	eb ec                	jmp    801a2b <close+0x19>
+
+00801a3f <close_all>:
+
+void
+close_all(void)
+{
+  801a3f:	55                   	push   %ebp
+  801a40:	89 e5                	mov    %esp,%ebp
+  801a42:	53                   	push   %ebx
+  801a43:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a46:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a4b:	83 ec 0c             	sub    $0xc,%esp
+  801a4e:	53                   	push   %ebx
+  801a4f:	e8 be ff ff ff       	call   801a12 <close>
+	for (i = 0; i < MAXFD; i++)
+  801a54:	83 c3 01             	add    $0x1,%ebx
+  801a57:	83 c4 10             	add    $0x10,%esp
+  801a5a:	83 fb 20             	cmp    $0x20,%ebx
+  801a5d:	75 ec                	jne    801a4b <close_all+0xc>
+}
+  801a5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a62:	c9                   	leave
+  801a63:	c3                   	ret
+
+00801a64 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a64:	55                   	push   %ebp
+  801a65:	89 e5                	mov    %esp,%ebp
+  801a67:	57                   	push   %edi
+  801a68:	56                   	push   %esi
+  801a69:	53                   	push   %ebx
+  801a6a:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a6d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a70:	50                   	push   %eax
+  801a71:	ff 75 08             	push   0x8(%ebp)
+  801a74:	e8 4f fe ff ff       	call   8018c8 <fd_lookup>
+  801a79:	89 c3                	mov    %eax,%ebx
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	78 7f                	js     801b01 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a82:	83 ec 0c             	sub    $0xc,%esp
+  801a85:	ff 75 0c             	push   0xc(%ebp)
+  801a88:	e8 85 ff ff ff       	call   801a12 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a8d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a90:	c1 e6 0c             	shl    $0xc,%esi
+  801a93:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a99:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a9c:	89 3c 24             	mov    %edi,(%esp)
+  801a9f:	e8 b7 fd ff ff       	call   80185b <fd2data>
+  801aa4:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801aa6:	89 34 24             	mov    %esi,(%esp)
+  801aa9:	e8 ad fd ff ff       	call   80185b <fd2data>
+  801aae:	83 c4 10             	add    $0x10,%esp
+  801ab1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801ab4:	89 d8                	mov    %ebx,%eax
+  801ab6:	c1 e8 16             	shr    $0x16,%eax
+  801ab9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ac0:	a8 01                	test   $0x1,%al
+  801ac2:	74 11                	je     801ad5 <dup+0x71>
+  801ac4:	89 d8                	mov    %ebx,%eax
+  801ac6:	c1 e8 0c             	shr    $0xc,%eax
+  801ac9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ad0:	f6 c2 01             	test   $0x1,%dl
+  801ad3:	75 36                	jne    801b0b <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ad5:	89 f8                	mov    %edi,%eax
+  801ad7:	c1 e8 0c             	shr    $0xc,%eax
+  801ada:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ae1:	83 ec 0c             	sub    $0xc,%esp
+  801ae4:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ae9:	50                   	push   %eax
+  801aea:	56                   	push   %esi
+  801aeb:	6a 00                	push   $0x0
+  801aed:	57                   	push   %edi
+  801aee:	6a 00                	push   $0x0
+  801af0:	e8 4d f3 ff ff       	call   800e42 <sys_page_map>
+  801af5:	89 c3                	mov    %eax,%ebx
+  801af7:	83 c4 20             	add    $0x20,%esp
+  801afa:	85 c0                	test   %eax,%eax
+  801afc:	78 33                	js     801b31 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801afe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b01:	89 d8                	mov    %ebx,%eax
+  801b03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b06:	5b                   	pop    %ebx
+  801b07:	5e                   	pop    %esi
+  801b08:	5f                   	pop    %edi
+  801b09:	5d                   	pop    %ebp
+  801b0a:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b0b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b12:	83 ec 0c             	sub    $0xc,%esp
+  801b15:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b1a:	50                   	push   %eax
+  801b1b:	ff 75 d4             	push   -0x2c(%ebp)
+  801b1e:	6a 00                	push   $0x0
+  801b20:	53                   	push   %ebx
+  801b21:	6a 00                	push   $0x0
+  801b23:	e8 1a f3 ff ff       	call   800e42 <sys_page_map>
+  801b28:	89 c3                	mov    %eax,%ebx
+  801b2a:	83 c4 20             	add    $0x20,%esp
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	79 a4                	jns    801ad5 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b31:	83 ec 08             	sub    $0x8,%esp
+  801b34:	56                   	push   %esi
+  801b35:	6a 00                	push   $0x0
+  801b37:	e8 74 f3 ff ff       	call   800eb0 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b3c:	83 c4 08             	add    $0x8,%esp
+  801b3f:	ff 75 d4             	push   -0x2c(%ebp)
+  801b42:	6a 00                	push   $0x0
+  801b44:	e8 67 f3 ff ff       	call   800eb0 <sys_page_unmap>
+	return r;
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	eb b3                	jmp    801b01 <dup+0x9d>
+
+00801b4e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b4e:	55                   	push   %ebp
+  801b4f:	89 e5                	mov    %esp,%ebp
+  801b51:	56                   	push   %esi
+  801b52:	53                   	push   %ebx
+  801b53:	83 ec 18             	sub    $0x18,%esp
+  801b56:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b5c:	50                   	push   %eax
+  801b5d:	53                   	push   %ebx
+  801b5e:	e8 65 fd ff ff       	call   8018c8 <fd_lookup>
+  801b63:	83 c4 10             	add    $0x10,%esp
+  801b66:	85 c0                	test   %eax,%eax
+  801b68:	78 3c                	js     801ba6 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b6a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b6d:	83 ec 08             	sub    $0x8,%esp
+  801b70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b73:	50                   	push   %eax
+  801b74:	ff 36                	push   (%esi)
+  801b76:	e8 9d fd ff ff       	call   801918 <dev_lookup>
+  801b7b:	83 c4 10             	add    $0x10,%esp
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	78 24                	js     801ba6 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b82:	8b 46 08             	mov    0x8(%esi),%eax
+  801b85:	83 e0 03             	and    $0x3,%eax
+  801b88:	83 f8 01             	cmp    $0x1,%eax
+  801b8b:	74 20                	je     801bad <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b90:	8b 40 08             	mov    0x8(%eax),%eax
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	74 57                	je     801bee <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b97:	83 ec 04             	sub    $0x4,%esp
+  801b9a:	ff 75 10             	push   0x10(%ebp)
+  801b9d:	ff 75 0c             	push   0xc(%ebp)
+  801ba0:	56                   	push   %esi
+  801ba1:	ff d0                	call   *%eax
+  801ba3:	83 c4 10             	add    $0x10,%esp
+}
+  801ba6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba9:	5b                   	pop    %ebx
+  801baa:	5e                   	pop    %esi
+  801bab:	5d                   	pop    %ebp
+  801bac:	c3                   	ret
+  801bad:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801baf:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bb4:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bba:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bbf:	76 1c                	jbe    801bdd <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bc1:	8b 42 48             	mov    0x48(%edx),%eax
+  801bc4:	83 ec 04             	sub    $0x4,%esp
+  801bc7:	53                   	push   %ebx
+  801bc8:	50                   	push   %eax
+  801bc9:	68 39 30 80 00       	push   $0x803039
+  801bce:	e8 c2 e6 ff ff       	call   800295 <cprintf>
+		return -E_INVAL;
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bdb:	eb c9                	jmp    801ba6 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801bdd:	c1 e8 10             	shr    $0x10,%eax
+  801be0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801be6:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801bec:	eb d3                	jmp    801bc1 <read+0x73>
+		return -E_NOT_SUPP;
+  801bee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bf3:	eb b1                	jmp    801ba6 <read+0x58>
+
+00801bf5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801bf5:	55                   	push   %ebp
+  801bf6:	89 e5                	mov    %esp,%ebp
+  801bf8:	57                   	push   %edi
+  801bf9:	56                   	push   %esi
+  801bfa:	53                   	push   %ebx
+  801bfb:	83 ec 0c             	sub    $0xc,%esp
+  801bfe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c01:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c09:	eb 02                	jmp    801c0d <readn+0x18>
+  801c0b:	01 c3                	add    %eax,%ebx
+  801c0d:	39 f3                	cmp    %esi,%ebx
+  801c0f:	73 21                	jae    801c32 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c11:	83 ec 04             	sub    $0x4,%esp
+  801c14:	89 f0                	mov    %esi,%eax
+  801c16:	29 d8                	sub    %ebx,%eax
+  801c18:	50                   	push   %eax
+  801c19:	89 d8                	mov    %ebx,%eax
+  801c1b:	03 45 0c             	add    0xc(%ebp),%eax
+  801c1e:	50                   	push   %eax
+  801c1f:	57                   	push   %edi
+  801c20:	e8 29 ff ff ff       	call   801b4e <read>
+		if (m < 0)
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	85 c0                	test   %eax,%eax
+  801c2a:	78 04                	js     801c30 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c2c:	75 dd                	jne    801c0b <readn+0x16>
+  801c2e:	eb 02                	jmp    801c32 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c30:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c32:	89 d8                	mov    %ebx,%eax
+  801c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c37:	5b                   	pop    %ebx
+  801c38:	5e                   	pop    %esi
+  801c39:	5f                   	pop    %edi
+  801c3a:	5d                   	pop    %ebp
+  801c3b:	c3                   	ret
+
+00801c3c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c3c:	55                   	push   %ebp
+  801c3d:	89 e5                	mov    %esp,%ebp
+  801c3f:	56                   	push   %esi
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 18             	sub    $0x18,%esp
+  801c44:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c47:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c4a:	50                   	push   %eax
+  801c4b:	53                   	push   %ebx
+  801c4c:	e8 77 fc ff ff       	call   8018c8 <fd_lookup>
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	85 c0                	test   %eax,%eax
+  801c56:	78 37                	js     801c8f <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c58:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c5b:	83 ec 08             	sub    $0x8,%esp
+  801c5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c61:	50                   	push   %eax
+  801c62:	ff 36                	push   (%esi)
+  801c64:	e8 af fc ff ff       	call   801918 <dev_lookup>
+  801c69:	83 c4 10             	add    $0x10,%esp
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	78 1f                	js     801c8f <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c70:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c74:	74 20                	je     801c96 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c79:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	74 57                	je     801cd7 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c80:	83 ec 04             	sub    $0x4,%esp
+  801c83:	ff 75 10             	push   0x10(%ebp)
+  801c86:	ff 75 0c             	push   0xc(%ebp)
+  801c89:	56                   	push   %esi
+  801c8a:	ff d0                	call   *%eax
+  801c8c:	83 c4 10             	add    $0x10,%esp
+}
+  801c8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c92:	5b                   	pop    %ebx
+  801c93:	5e                   	pop    %esi
+  801c94:	5d                   	pop    %ebp
+  801c95:	c3                   	ret
+  801c96:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c98:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c9d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ca3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ca8:	76 1c                	jbe    801cc6 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801caa:	8b 42 48             	mov    0x48(%edx),%eax
+  801cad:	83 ec 04             	sub    $0x4,%esp
+  801cb0:	53                   	push   %ebx
+  801cb1:	50                   	push   %eax
+  801cb2:	68 55 30 80 00       	push   $0x803055
+  801cb7:	e8 d9 e5 ff ff       	call   800295 <cprintf>
+		return -E_INVAL;
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cc4:	eb c9                	jmp    801c8f <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801cc6:	c1 e8 10             	shr    $0x10,%eax
+  801cc9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ccf:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cd5:	eb d3                	jmp    801caa <write+0x6e>
+		return -E_NOT_SUPP;
+  801cd7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cdc:	eb b1                	jmp    801c8f <write+0x53>
+
+00801cde <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801cde:	55                   	push   %ebp
+  801cdf:	89 e5                	mov    %esp,%ebp
+  801ce1:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ce4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce7:	50                   	push   %eax
+  801ce8:	ff 75 08             	push   0x8(%ebp)
+  801ceb:	e8 d8 fb ff ff       	call   8018c8 <fd_lookup>
+  801cf0:	83 c4 10             	add    $0x10,%esp
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	78 0e                	js     801d05 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801cf7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cfd:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d05:	c9                   	leave
+  801d06:	c3                   	ret
+
+00801d07 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d07:	55                   	push   %ebp
+  801d08:	89 e5                	mov    %esp,%ebp
+  801d0a:	56                   	push   %esi
+  801d0b:	53                   	push   %ebx
+  801d0c:	83 ec 18             	sub    $0x18,%esp
+  801d0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d12:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d15:	50                   	push   %eax
+  801d16:	53                   	push   %ebx
+  801d17:	e8 ac fb ff ff       	call   8018c8 <fd_lookup>
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	78 34                	js     801d57 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d23:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d26:	83 ec 08             	sub    $0x8,%esp
+  801d29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d2c:	50                   	push   %eax
+  801d2d:	ff 36                	push   (%esi)
+  801d2f:	e8 e4 fb ff ff       	call   801918 <dev_lookup>
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	78 1c                	js     801d57 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d3b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d3f:	74 1d                	je     801d5e <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d44:	8b 40 18             	mov    0x18(%eax),%eax
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	74 54                	je     801d9f <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d4b:	83 ec 08             	sub    $0x8,%esp
+  801d4e:	ff 75 0c             	push   0xc(%ebp)
+  801d51:	56                   	push   %esi
+  801d52:	ff d0                	call   *%eax
+  801d54:	83 c4 10             	add    $0x10,%esp
+}
+  801d57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d5a:	5b                   	pop    %ebx
+  801d5b:	5e                   	pop    %esi
+  801d5c:	5d                   	pop    %ebp
+  801d5d:	c3                   	ret
+  801d5e:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d60:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d65:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d6b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d70:	76 1c                	jbe    801d8e <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801d72:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d75:	83 ec 04             	sub    $0x4,%esp
+  801d78:	53                   	push   %ebx
+  801d79:	50                   	push   %eax
+  801d7a:	68 18 30 80 00       	push   $0x803018
+  801d7f:	e8 11 e5 ff ff       	call   800295 <cprintf>
+		return -E_INVAL;
+  801d84:	83 c4 10             	add    $0x10,%esp
+  801d87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d8c:	eb c9                	jmp    801d57 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d8e:	c1 e8 10             	shr    $0x10,%eax
+  801d91:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d97:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d9d:	eb d3                	jmp    801d72 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801d9f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801da4:	eb b1                	jmp    801d57 <ftruncate+0x50>
+
+00801da6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	56                   	push   %esi
+  801daa:	53                   	push   %ebx
+  801dab:	83 ec 18             	sub    $0x18,%esp
+  801dae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801db1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801db4:	50                   	push   %eax
+  801db5:	ff 75 08             	push   0x8(%ebp)
+  801db8:	e8 0b fb ff ff       	call   8018c8 <fd_lookup>
+  801dbd:	83 c4 10             	add    $0x10,%esp
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	78 49                	js     801e0d <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dc4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dc7:	83 ec 08             	sub    $0x8,%esp
+  801dca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dcd:	50                   	push   %eax
+  801dce:	ff 36                	push   (%esi)
+  801dd0:	e8 43 fb ff ff       	call   801918 <dev_lookup>
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	78 31                	js     801e0d <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801ddc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ddf:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801de3:	74 2f                	je     801e14 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801de5:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801de8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801def:	00 00 00 
+	stat->st_isdir = 0;
+  801df2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801df9:	00 00 00 
+	stat->st_dev = dev;
+  801dfc:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e02:	83 ec 08             	sub    $0x8,%esp
+  801e05:	53                   	push   %ebx
+  801e06:	56                   	push   %esi
+  801e07:	ff 50 14             	call   *0x14(%eax)
+  801e0a:	83 c4 10             	add    $0x10,%esp
+}
+  801e0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e10:	5b                   	pop    %ebx
+  801e11:	5e                   	pop    %esi
+  801e12:	5d                   	pop    %ebp
+  801e13:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e14:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e19:	eb f2                	jmp    801e0d <fstat+0x67>
+
+00801e1b <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e1b:	55                   	push   %ebp
+  801e1c:	89 e5                	mov    %esp,%ebp
+  801e1e:	56                   	push   %esi
+  801e1f:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e20:	83 ec 08             	sub    $0x8,%esp
+  801e23:	6a 00                	push   $0x0
+  801e25:	ff 75 08             	push   0x8(%ebp)
+  801e28:	e8 e4 01 00 00       	call   802011 <open>
+  801e2d:	89 c3                	mov    %eax,%ebx
+  801e2f:	83 c4 10             	add    $0x10,%esp
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	78 1b                	js     801e51 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e36:	83 ec 08             	sub    $0x8,%esp
+  801e39:	ff 75 0c             	push   0xc(%ebp)
+  801e3c:	50                   	push   %eax
+  801e3d:	e8 64 ff ff ff       	call   801da6 <fstat>
+  801e42:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e44:	89 1c 24             	mov    %ebx,(%esp)
+  801e47:	e8 c6 fb ff ff       	call   801a12 <close>
+	return r;
+  801e4c:	83 c4 10             	add    $0x10,%esp
+  801e4f:	89 f3                	mov    %esi,%ebx
+}
+  801e51:	89 d8                	mov    %ebx,%eax
+  801e53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e56:	5b                   	pop    %ebx
+  801e57:	5e                   	pop    %esi
+  801e58:	5d                   	pop    %ebp
+  801e59:	c3                   	ret
+
+00801e5a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e5a:	55                   	push   %ebp
+  801e5b:	89 e5                	mov    %esp,%ebp
+  801e5d:	56                   	push   %esi
+  801e5e:	53                   	push   %ebx
+  801e5f:	89 c6                	mov    %eax,%esi
+  801e61:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e63:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801e6a:	74 27                	je     801e93 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e6c:	6a 07                	push   $0x7
+  801e6e:	68 00 60 80 00       	push   $0x806000
+  801e73:	56                   	push   %esi
+  801e74:	ff 35 00 50 80 00    	push   0x805000
+  801e7a:	e8 b2 0c 00 00       	call   802b31 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e7f:	83 c4 0c             	add    $0xc,%esp
+  801e82:	6a 00                	push   $0x0
+  801e84:	53                   	push   %ebx
+  801e85:	6a 00                	push   $0x0
+  801e87:	e8 8d 0c 00 00       	call   802b19 <ipc_recv>
+}
+  801e8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8f:	5b                   	pop    %ebx
+  801e90:	5e                   	pop    %esi
+  801e91:	5d                   	pop    %ebp
+  801e92:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e93:	83 ec 0c             	sub    $0xc,%esp
+  801e96:	6a 01                	push   $0x1
+  801e98:	e8 e8 0c 00 00       	call   802b85 <ipc_find_env>
+  801e9d:	a3 00 50 80 00       	mov    %eax,0x805000
+  801ea2:	83 c4 10             	add    $0x10,%esp
+  801ea5:	eb c5                	jmp    801e6c <fsipc+0x12>
+
+00801ea7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ea7:	55                   	push   %ebp
+  801ea8:	89 e5                	mov    %esp,%ebp
+  801eaa:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ead:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eb3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801eb8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ebb:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ec0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec5:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eca:	e8 8b ff ff ff       	call   801e5a <fsipc>
+}
+  801ecf:	c9                   	leave
+  801ed0:	c3                   	ret
+
+00801ed1 <devfile_flush>:
+{
+  801ed1:	55                   	push   %ebp
+  801ed2:	89 e5                	mov    %esp,%ebp
+  801ed4:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eda:	8b 40 0c             	mov    0xc(%eax),%eax
+  801edd:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801ee2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee7:	b8 06 00 00 00       	mov    $0x6,%eax
+  801eec:	e8 69 ff ff ff       	call   801e5a <fsipc>
+}
+  801ef1:	c9                   	leave
+  801ef2:	c3                   	ret
+
+00801ef3 <devfile_stat>:
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	53                   	push   %ebx
+  801ef7:	83 ec 04             	sub    $0x4,%esp
+  801efa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801efd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f00:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f03:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f0d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f12:	e8 43 ff ff ff       	call   801e5a <fsipc>
+  801f17:	85 c0                	test   %eax,%eax
+  801f19:	78 2c                	js     801f47 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f1b:	83 ec 08             	sub    $0x8,%esp
+  801f1e:	68 00 60 80 00       	push   $0x806000
+  801f23:	53                   	push   %ebx
+  801f24:	e8 b4 e9 ff ff       	call   8008dd <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f29:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f2e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f34:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f39:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f4a:	c9                   	leave
+  801f4b:	c3                   	ret
+
+00801f4c <devfile_write>:
+{
+  801f4c:	55                   	push   %ebp
+  801f4d:	89 e5                	mov    %esp,%ebp
+  801f4f:	83 ec 0c             	sub    $0xc,%esp
+  801f52:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f55:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f58:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f5b:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801f61:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801f66:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f6b:	39 d0                	cmp    %edx,%eax
+  801f6d:	0f 47 c2             	cmova  %edx,%eax
+  801f70:	50                   	push   %eax
+  801f71:	ff 75 0c             	push   0xc(%ebp)
+  801f74:	68 08 60 80 00       	push   $0x806008
+  801f79:	e8 e5 ea ff ff       	call   800a63 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f83:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f88:	e8 cd fe ff ff       	call   801e5a <fsipc>
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+00801f8f <devfile_read>:
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	56                   	push   %esi
+  801f93:	53                   	push   %ebx
+  801f94:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f97:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f9d:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801fa2:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fad:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fb2:	e8 a3 fe ff ff       	call   801e5a <fsipc>
+  801fb7:	89 c3                	mov    %eax,%ebx
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	78 1f                	js     801fdc <devfile_read+0x4d>
+	assert(r <= n);
+  801fbd:	39 c6                	cmp    %eax,%esi
+  801fbf:	72 24                	jb     801fe5 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801fc1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fc6:	7f 33                	jg     801ffb <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fc8:	83 ec 04             	sub    $0x4,%esp
+  801fcb:	50                   	push   %eax
+  801fcc:	68 00 60 80 00       	push   $0x806000
+  801fd1:	ff 75 0c             	push   0xc(%ebp)
+  801fd4:	e8 8a ea ff ff       	call   800a63 <memmove>
+	return r;
+  801fd9:	83 c4 10             	add    $0x10,%esp
+}
+  801fdc:	89 d8                	mov    %ebx,%eax
+  801fde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe1:	5b                   	pop    %ebx
+  801fe2:	5e                   	pop    %esi
+  801fe3:	5d                   	pop    %ebp
+  801fe4:	c3                   	ret
+	assert(r <= n);
+  801fe5:	68 88 30 80 00       	push   $0x803088
+  801fea:	68 8f 30 80 00       	push   $0x80308f
+  801fef:	6a 76                	push   $0x76
+  801ff1:	68 a4 30 80 00       	push   $0x8030a4
+  801ff6:	e8 bf e1 ff ff       	call   8001ba <_panic>
+	assert(r <= PGSIZE);
+  801ffb:	68 af 30 80 00       	push   $0x8030af
+  802000:	68 8f 30 80 00       	push   $0x80308f
+  802005:	6a 77                	push   $0x77
+  802007:	68 a4 30 80 00       	push   $0x8030a4
+  80200c:	e8 a9 e1 ff ff       	call   8001ba <_panic>
+
+00802011 <open>:
+{
+  802011:	55                   	push   %ebp
+  802012:	89 e5                	mov    %esp,%ebp
+  802014:	56                   	push   %esi
+  802015:	53                   	push   %ebx
+  802016:	83 ec 1c             	sub    $0x1c,%esp
+  802019:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80201c:	56                   	push   %esi
+  80201d:	e8 80 e8 ff ff       	call   8008a2 <strlen>
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80202a:	7f 6c                	jg     802098 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80202c:	83 ec 0c             	sub    $0xc,%esp
+  80202f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802032:	50                   	push   %eax
+  802033:	e8 3a f8 ff ff       	call   801872 <fd_alloc>
+  802038:	89 c3                	mov    %eax,%ebx
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 3c                	js     80207d <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802041:	83 ec 08             	sub    $0x8,%esp
+  802044:	56                   	push   %esi
+  802045:	68 00 60 80 00       	push   $0x806000
+  80204a:	e8 8e e8 ff ff       	call   8008dd <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80204f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802052:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802057:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80205a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80205f:	e8 f6 fd ff ff       	call   801e5a <fsipc>
+  802064:	89 c3                	mov    %eax,%ebx
+  802066:	83 c4 10             	add    $0x10,%esp
+  802069:	85 c0                	test   %eax,%eax
+  80206b:	78 19                	js     802086 <open+0x75>
+	return fd2num(fd);
+  80206d:	83 ec 0c             	sub    $0xc,%esp
+  802070:	ff 75 f4             	push   -0xc(%ebp)
+  802073:	e8 d3 f7 ff ff       	call   80184b <fd2num>
+  802078:	89 c3                	mov    %eax,%ebx
+  80207a:	83 c4 10             	add    $0x10,%esp
+}
+  80207d:	89 d8                	mov    %ebx,%eax
+  80207f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802082:	5b                   	pop    %ebx
+  802083:	5e                   	pop    %esi
+  802084:	5d                   	pop    %ebp
+  802085:	c3                   	ret
+		fd_close(fd, 0);
+  802086:	83 ec 08             	sub    $0x8,%esp
+  802089:	6a 00                	push   $0x0
+  80208b:	ff 75 f4             	push   -0xc(%ebp)
+  80208e:	e8 f8 f8 ff ff       	call   80198b <fd_close>
+		return r;
+  802093:	83 c4 10             	add    $0x10,%esp
+  802096:	eb e5                	jmp    80207d <open+0x6c>
+		return -E_BAD_PATH;
+  802098:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80209d:	eb de                	jmp    80207d <open+0x6c>
+
+0080209f <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80209f:	55                   	push   %ebp
+  8020a0:	89 e5                	mov    %esp,%ebp
+  8020a2:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020aa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020af:	e8 a6 fd ff ff       	call   801e5a <fsipc>
+}
+  8020b4:	c9                   	leave
+  8020b5:	c3                   	ret
+
+008020b6 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8020bc:	68 bb 30 80 00       	push   $0x8030bb
+  8020c1:	ff 75 0c             	push   0xc(%ebp)
+  8020c4:	e8 14 e8 ff ff       	call   8008dd <strcpy>
+	return 0;
+}
+  8020c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ce:	c9                   	leave
+  8020cf:	c3                   	ret
+
+008020d0 <devsock_close>:
+{
+  8020d0:	55                   	push   %ebp
+  8020d1:	89 e5                	mov    %esp,%ebp
+  8020d3:	53                   	push   %ebx
+  8020d4:	83 ec 10             	sub    $0x10,%esp
+  8020d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8020da:	53                   	push   %ebx
+  8020db:	e8 e4 0a 00 00       	call   802bc4 <pageref>
+  8020e0:	89 c2                	mov    %eax,%edx
+  8020e2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020e5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8020ea:	83 fa 01             	cmp    $0x1,%edx
+  8020ed:	74 05                	je     8020f4 <devsock_close+0x24>
+}
+  8020ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8020f4:	83 ec 0c             	sub    $0xc,%esp
+  8020f7:	ff 73 0c             	push   0xc(%ebx)
+  8020fa:	e8 b7 02 00 00       	call   8023b6 <nsipc_close>
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	eb eb                	jmp    8020ef <devsock_close+0x1f>
+
+00802104 <devsock_write>:
+{
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80210a:	6a 00                	push   $0x0
+  80210c:	ff 75 10             	push   0x10(%ebp)
+  80210f:	ff 75 0c             	push   0xc(%ebp)
+  802112:	8b 45 08             	mov    0x8(%ebp),%eax
+  802115:	ff 70 0c             	push   0xc(%eax)
+  802118:	e8 79 03 00 00       	call   802496 <nsipc_send>
+}
+  80211d:	c9                   	leave
+  80211e:	c3                   	ret
+
+0080211f <devsock_read>:
+{
+  80211f:	55                   	push   %ebp
+  802120:	89 e5                	mov    %esp,%ebp
+  802122:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802125:	6a 00                	push   $0x0
+  802127:	ff 75 10             	push   0x10(%ebp)
+  80212a:	ff 75 0c             	push   0xc(%ebp)
+  80212d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802130:	ff 70 0c             	push   0xc(%eax)
+  802133:	e8 ef 02 00 00       	call   802427 <nsipc_recv>
+}
+  802138:	c9                   	leave
+  802139:	c3                   	ret
+
+0080213a <fd2sockid>:
+{
+  80213a:	55                   	push   %ebp
+  80213b:	89 e5                	mov    %esp,%ebp
+  80213d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802140:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802143:	52                   	push   %edx
+  802144:	50                   	push   %eax
+  802145:	e8 7e f7 ff ff       	call   8018c8 <fd_lookup>
+  80214a:	83 c4 10             	add    $0x10,%esp
+  80214d:	85 c0                	test   %eax,%eax
+  80214f:	78 10                	js     802161 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802151:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802154:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80215a:	39 08                	cmp    %ecx,(%eax)
+  80215c:	75 05                	jne    802163 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80215e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802161:	c9                   	leave
+  802162:	c3                   	ret
+		return -E_NOT_SUPP;
+  802163:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802168:	eb f7                	jmp    802161 <fd2sockid+0x27>
+
+0080216a <alloc_sockfd>:
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+  80216f:	83 ec 1c             	sub    $0x1c,%esp
+  802172:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802174:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802177:	50                   	push   %eax
+  802178:	e8 f5 f6 ff ff       	call   801872 <fd_alloc>
+  80217d:	89 c3                	mov    %eax,%ebx
+  80217f:	83 c4 10             	add    $0x10,%esp
+  802182:	85 c0                	test   %eax,%eax
+  802184:	78 43                	js     8021c9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802186:	83 ec 04             	sub    $0x4,%esp
+  802189:	68 07 04 00 00       	push   $0x407
+  80218e:	ff 75 f4             	push   -0xc(%ebp)
+  802191:	6a 00                	push   $0x0
+  802193:	e8 3d ec ff ff       	call   800dd5 <sys_page_alloc>
+  802198:	89 c3                	mov    %eax,%ebx
+  80219a:	83 c4 10             	add    $0x10,%esp
+  80219d:	85 c0                	test   %eax,%eax
+  80219f:	78 28                	js     8021c9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8021a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a4:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8021aa:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8021ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021af:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8021b6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8021b9:	83 ec 0c             	sub    $0xc,%esp
+  8021bc:	50                   	push   %eax
+  8021bd:	e8 89 f6 ff ff       	call   80184b <fd2num>
+  8021c2:	89 c3                	mov    %eax,%ebx
+  8021c4:	83 c4 10             	add    $0x10,%esp
+  8021c7:	eb 0c                	jmp    8021d5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8021c9:	83 ec 0c             	sub    $0xc,%esp
+  8021cc:	56                   	push   %esi
+  8021cd:	e8 e4 01 00 00       	call   8023b6 <nsipc_close>
+		return r;
+  8021d2:	83 c4 10             	add    $0x10,%esp
+}
+  8021d5:	89 d8                	mov    %ebx,%eax
+  8021d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021da:	5b                   	pop    %ebx
+  8021db:	5e                   	pop    %esi
+  8021dc:	5d                   	pop    %ebp
+  8021dd:	c3                   	ret
+
+008021de <accept>:
+{
+  8021de:	55                   	push   %ebp
+  8021df:	89 e5                	mov    %esp,%ebp
+  8021e1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e7:	e8 4e ff ff ff       	call   80213a <fd2sockid>
+  8021ec:	85 c0                	test   %eax,%eax
+  8021ee:	78 1b                	js     80220b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8021f0:	83 ec 04             	sub    $0x4,%esp
+  8021f3:	ff 75 10             	push   0x10(%ebp)
+  8021f6:	ff 75 0c             	push   0xc(%ebp)
+  8021f9:	50                   	push   %eax
+  8021fa:	e8 0e 01 00 00       	call   80230d <nsipc_accept>
+  8021ff:	83 c4 10             	add    $0x10,%esp
+  802202:	85 c0                	test   %eax,%eax
+  802204:	78 05                	js     80220b <accept+0x2d>
+	return alloc_sockfd(r);
+  802206:	e8 5f ff ff ff       	call   80216a <alloc_sockfd>
+}
+  80220b:	c9                   	leave
+  80220c:	c3                   	ret
+
+0080220d <bind>:
+{
+  80220d:	55                   	push   %ebp
+  80220e:	89 e5                	mov    %esp,%ebp
+  802210:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802213:	8b 45 08             	mov    0x8(%ebp),%eax
+  802216:	e8 1f ff ff ff       	call   80213a <fd2sockid>
+  80221b:	85 c0                	test   %eax,%eax
+  80221d:	78 12                	js     802231 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80221f:	83 ec 04             	sub    $0x4,%esp
+  802222:	ff 75 10             	push   0x10(%ebp)
+  802225:	ff 75 0c             	push   0xc(%ebp)
+  802228:	50                   	push   %eax
+  802229:	e8 31 01 00 00       	call   80235f <nsipc_bind>
+  80222e:	83 c4 10             	add    $0x10,%esp
+}
+  802231:	c9                   	leave
+  802232:	c3                   	ret
+
+00802233 <shutdown>:
+{
+  802233:	55                   	push   %ebp
+  802234:	89 e5                	mov    %esp,%ebp
+  802236:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802239:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223c:	e8 f9 fe ff ff       	call   80213a <fd2sockid>
+  802241:	85 c0                	test   %eax,%eax
+  802243:	78 0f                	js     802254 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802245:	83 ec 08             	sub    $0x8,%esp
+  802248:	ff 75 0c             	push   0xc(%ebp)
+  80224b:	50                   	push   %eax
+  80224c:	e8 43 01 00 00       	call   802394 <nsipc_shutdown>
+  802251:	83 c4 10             	add    $0x10,%esp
+}
+  802254:	c9                   	leave
+  802255:	c3                   	ret
+
+00802256 <connect>:
+{
+  802256:	55                   	push   %ebp
+  802257:	89 e5                	mov    %esp,%ebp
+  802259:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80225c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225f:	e8 d6 fe ff ff       	call   80213a <fd2sockid>
+  802264:	85 c0                	test   %eax,%eax
+  802266:	78 12                	js     80227a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802268:	83 ec 04             	sub    $0x4,%esp
+  80226b:	ff 75 10             	push   0x10(%ebp)
+  80226e:	ff 75 0c             	push   0xc(%ebp)
+  802271:	50                   	push   %eax
+  802272:	e8 59 01 00 00       	call   8023d0 <nsipc_connect>
+  802277:	83 c4 10             	add    $0x10,%esp
+}
+  80227a:	c9                   	leave
+  80227b:	c3                   	ret
+
+0080227c <listen>:
+{
+  80227c:	55                   	push   %ebp
+  80227d:	89 e5                	mov    %esp,%ebp
+  80227f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802282:	8b 45 08             	mov    0x8(%ebp),%eax
+  802285:	e8 b0 fe ff ff       	call   80213a <fd2sockid>
+  80228a:	85 c0                	test   %eax,%eax
+  80228c:	78 0f                	js     80229d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80228e:	83 ec 08             	sub    $0x8,%esp
+  802291:	ff 75 0c             	push   0xc(%ebp)
+  802294:	50                   	push   %eax
+  802295:	e8 6b 01 00 00       	call   802405 <nsipc_listen>
+  80229a:	83 c4 10             	add    $0x10,%esp
+}
+  80229d:	c9                   	leave
+  80229e:	c3                   	ret
+
+0080229f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80229f:	55                   	push   %ebp
+  8022a0:	89 e5                	mov    %esp,%ebp
+  8022a2:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8022a5:	ff 75 10             	push   0x10(%ebp)
+  8022a8:	ff 75 0c             	push   0xc(%ebp)
+  8022ab:	ff 75 08             	push   0x8(%ebp)
+  8022ae:	e8 41 02 00 00       	call   8024f4 <nsipc_socket>
+  8022b3:	83 c4 10             	add    $0x10,%esp
+  8022b6:	85 c0                	test   %eax,%eax
+  8022b8:	78 05                	js     8022bf <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8022ba:	e8 ab fe ff ff       	call   80216a <alloc_sockfd>
+}
+  8022bf:	c9                   	leave
+  8022c0:	c3                   	ret
+
+008022c1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8022c1:	55                   	push   %ebp
+  8022c2:	89 e5                	mov    %esp,%ebp
+  8022c4:	53                   	push   %ebx
+  8022c5:	83 ec 04             	sub    $0x4,%esp
+  8022c8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8022ca:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8022d1:	74 26                	je     8022f9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8022d3:	6a 07                	push   $0x7
+  8022d5:	68 00 70 80 00       	push   $0x807000
+  8022da:	53                   	push   %ebx
+  8022db:	ff 35 04 50 80 00    	push   0x805004
+  8022e1:	e8 4b 08 00 00       	call   802b31 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8022e6:	83 c4 0c             	add    $0xc,%esp
+  8022e9:	6a 00                	push   $0x0
+  8022eb:	6a 00                	push   $0x0
+  8022ed:	6a 00                	push   $0x0
+  8022ef:	e8 25 08 00 00       	call   802b19 <ipc_recv>
+}
+  8022f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022f7:	c9                   	leave
+  8022f8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8022f9:	83 ec 0c             	sub    $0xc,%esp
+  8022fc:	6a 02                	push   $0x2
+  8022fe:	e8 82 08 00 00       	call   802b85 <ipc_find_env>
+  802303:	a3 04 50 80 00       	mov    %eax,0x805004
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	eb c6                	jmp    8022d3 <nsipc+0x12>
+
+0080230d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	56                   	push   %esi
+  802311:	53                   	push   %ebx
+  802312:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802315:	8b 45 08             	mov    0x8(%ebp),%eax
+  802318:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80231d:	8b 06                	mov    (%esi),%eax
+  80231f:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802324:	b8 01 00 00 00       	mov    $0x1,%eax
+  802329:	e8 93 ff ff ff       	call   8022c1 <nsipc>
+  80232e:	89 c3                	mov    %eax,%ebx
+  802330:	85 c0                	test   %eax,%eax
+  802332:	79 09                	jns    80233d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802334:	89 d8                	mov    %ebx,%eax
+  802336:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802339:	5b                   	pop    %ebx
+  80233a:	5e                   	pop    %esi
+  80233b:	5d                   	pop    %ebp
+  80233c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80233d:	83 ec 04             	sub    $0x4,%esp
+  802340:	ff 35 10 70 80 00    	push   0x807010
+  802346:	68 00 70 80 00       	push   $0x807000
+  80234b:	ff 75 0c             	push   0xc(%ebp)
+  80234e:	e8 10 e7 ff ff       	call   800a63 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802353:	a1 10 70 80 00       	mov    0x807010,%eax
+  802358:	89 06                	mov    %eax,(%esi)
+  80235a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80235d:	eb d5                	jmp    802334 <nsipc_accept+0x27>
+
+0080235f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	53                   	push   %ebx
+  802363:	83 ec 08             	sub    $0x8,%esp
+  802366:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236c:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802371:	53                   	push   %ebx
+  802372:	ff 75 0c             	push   0xc(%ebp)
+  802375:	68 04 70 80 00       	push   $0x807004
+  80237a:	e8 e4 e6 ff ff       	call   800a63 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80237f:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  802385:	b8 02 00 00 00       	mov    $0x2,%eax
+  80238a:	e8 32 ff ff ff       	call   8022c1 <nsipc>
+}
+  80238f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802392:	c9                   	leave
+  802393:	c3                   	ret
+
+00802394 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802394:	55                   	push   %ebp
+  802395:	89 e5                	mov    %esp,%ebp
+  802397:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80239a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80239d:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8023a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a5:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8023aa:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023af:	e8 0d ff ff ff       	call   8022c1 <nsipc>
+}
+  8023b4:	c9                   	leave
+  8023b5:	c3                   	ret
+
+008023b6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8023b6:	55                   	push   %ebp
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8023bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bf:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8023c4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023c9:	e8 f3 fe ff ff       	call   8022c1 <nsipc>
+}
+  8023ce:	c9                   	leave
+  8023cf:	c3                   	ret
+
+008023d0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8023d0:	55                   	push   %ebp
+  8023d1:	89 e5                	mov    %esp,%ebp
+  8023d3:	53                   	push   %ebx
+  8023d4:	83 ec 08             	sub    $0x8,%esp
+  8023d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8023da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023dd:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8023e2:	53                   	push   %ebx
+  8023e3:	ff 75 0c             	push   0xc(%ebp)
+  8023e6:	68 04 70 80 00       	push   $0x807004
+  8023eb:	e8 73 e6 ff ff       	call   800a63 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8023f0:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8023f6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023fb:	e8 c1 fe ff ff       	call   8022c1 <nsipc>
+}
+  802400:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802403:	c9                   	leave
+  802404:	c3                   	ret
+
+00802405 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+  802408:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80240b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240e:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  802413:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802416:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  80241b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802420:	e8 9c fe ff ff       	call   8022c1 <nsipc>
+}
+  802425:	c9                   	leave
+  802426:	c3                   	ret
+
+00802427 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802427:	55                   	push   %ebp
+  802428:	89 e5                	mov    %esp,%ebp
+  80242a:	56                   	push   %esi
+  80242b:	53                   	push   %ebx
+  80242c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80242f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802432:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802437:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  80243d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802440:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802445:	b8 07 00 00 00       	mov    $0x7,%eax
+  80244a:	e8 72 fe ff ff       	call   8022c1 <nsipc>
+  80244f:	89 c3                	mov    %eax,%ebx
+  802451:	85 c0                	test   %eax,%eax
+  802453:	78 22                	js     802477 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802455:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80245a:	39 c6                	cmp    %eax,%esi
+  80245c:	0f 4e c6             	cmovle %esi,%eax
+  80245f:	39 c3                	cmp    %eax,%ebx
+  802461:	7f 1d                	jg     802480 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802463:	83 ec 04             	sub    $0x4,%esp
+  802466:	53                   	push   %ebx
+  802467:	68 00 70 80 00       	push   $0x807000
+  80246c:	ff 75 0c             	push   0xc(%ebp)
+  80246f:	e8 ef e5 ff ff       	call   800a63 <memmove>
+  802474:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802477:	89 d8                	mov    %ebx,%eax
+  802479:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80247c:	5b                   	pop    %ebx
+  80247d:	5e                   	pop    %esi
+  80247e:	5d                   	pop    %ebp
+  80247f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802480:	68 c7 30 80 00       	push   $0x8030c7
+  802485:	68 8f 30 80 00       	push   $0x80308f
+  80248a:	6a 62                	push   $0x62
+  80248c:	68 dc 30 80 00       	push   $0x8030dc
+  802491:	e8 24 dd ff ff       	call   8001ba <_panic>
+
+00802496 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802496:	55                   	push   %ebp
+  802497:	89 e5                	mov    %esp,%ebp
+  802499:	53                   	push   %ebx
+  80249a:	83 ec 04             	sub    $0x4,%esp
+  80249d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8024a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a3:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8024a8:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8024ae:	7f 2e                	jg     8024de <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8024b0:	83 ec 04             	sub    $0x4,%esp
+  8024b3:	53                   	push   %ebx
+  8024b4:	ff 75 0c             	push   0xc(%ebp)
+  8024b7:	68 0c 70 80 00       	push   $0x80700c
+  8024bc:	e8 a2 e5 ff ff       	call   800a63 <memmove>
+	nsipcbuf.send.req_size = size;
+  8024c1:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8024c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ca:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8024cf:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024d4:	e8 e8 fd ff ff       	call   8022c1 <nsipc>
+}
+  8024d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024dc:	c9                   	leave
+  8024dd:	c3                   	ret
+	assert(size < 1600);
+  8024de:	68 e8 30 80 00       	push   $0x8030e8
+  8024e3:	68 8f 30 80 00       	push   $0x80308f
+  8024e8:	6a 6d                	push   $0x6d
+  8024ea:	68 dc 30 80 00       	push   $0x8030dc
+  8024ef:	e8 c6 dc ff ff       	call   8001ba <_panic>
+
+008024f4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8024f4:	55                   	push   %ebp
+  8024f5:	89 e5                	mov    %esp,%ebp
+  8024f7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8024fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024fd:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  802502:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802505:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  80250a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80250d:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  802512:	b8 09 00 00 00       	mov    $0x9,%eax
+  802517:	e8 a5 fd ff ff       	call   8022c1 <nsipc>
+}
+  80251c:	c9                   	leave
+  80251d:	c3                   	ret
+
+0080251e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80251e:	55                   	push   %ebp
+  80251f:	89 e5                	mov    %esp,%ebp
+  802521:	56                   	push   %esi
+  802522:	53                   	push   %ebx
+  802523:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802526:	83 ec 0c             	sub    $0xc,%esp
+  802529:	ff 75 08             	push   0x8(%ebp)
+  80252c:	e8 2a f3 ff ff       	call   80185b <fd2data>
+  802531:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802533:	83 c4 08             	add    $0x8,%esp
+  802536:	68 f4 30 80 00       	push   $0x8030f4
+  80253b:	53                   	push   %ebx
+  80253c:	e8 9c e3 ff ff       	call   8008dd <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802541:	8b 46 04             	mov    0x4(%esi),%eax
+  802544:	2b 06                	sub    (%esi),%eax
+  802546:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80254c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802553:	00 00 00 
+	stat->st_dev = &devpipe;
+  802556:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  80255d:	40 80 00 
+	return 0;
+}
+  802560:	b8 00 00 00 00       	mov    $0x0,%eax
+  802565:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802568:	5b                   	pop    %ebx
+  802569:	5e                   	pop    %esi
+  80256a:	5d                   	pop    %ebp
+  80256b:	c3                   	ret
+
+0080256c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80256c:	55                   	push   %ebp
+  80256d:	89 e5                	mov    %esp,%ebp
+  80256f:	53                   	push   %ebx
+  802570:	83 ec 0c             	sub    $0xc,%esp
+  802573:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802576:	53                   	push   %ebx
+  802577:	6a 00                	push   $0x0
+  802579:	e8 32 e9 ff ff       	call   800eb0 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80257e:	89 1c 24             	mov    %ebx,(%esp)
+  802581:	e8 d5 f2 ff ff       	call   80185b <fd2data>
+  802586:	83 c4 08             	add    $0x8,%esp
+  802589:	50                   	push   %eax
+  80258a:	6a 00                	push   $0x0
+  80258c:	e8 1f e9 ff ff       	call   800eb0 <sys_page_unmap>
+}
+  802591:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802594:	c9                   	leave
+  802595:	c3                   	ret
+
+00802596 <_pipeisclosed>:
+{
+  802596:	55                   	push   %ebp
+  802597:	89 e5                	mov    %esp,%ebp
+  802599:	57                   	push   %edi
+  80259a:	56                   	push   %esi
+  80259b:	53                   	push   %ebx
+  80259c:	83 ec 1c             	sub    $0x1c,%esp
+  80259f:	89 c7                	mov    %eax,%edi
+  8025a1:	89 d6                	mov    %edx,%esi
+  8025a3:	eb 3c                	jmp    8025e1 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8025a5:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8025a8:	83 ec 0c             	sub    $0xc,%esp
+  8025ab:	57                   	push   %edi
+  8025ac:	e8 13 06 00 00       	call   802bc4 <pageref>
+  8025b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025b4:	89 34 24             	mov    %esi,(%esp)
+  8025b7:	e8 08 06 00 00       	call   802bc4 <pageref>
+  8025bc:	89 c2                	mov    %eax,%edx
+  8025be:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025c0:	05 00 00 00 20       	add    $0x20000000,%eax
+  8025c5:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8025c8:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025ce:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025d3:	76 31                	jbe    802606 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8025d5:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8025d8:	39 c3                	cmp    %eax,%ebx
+  8025da:	74 76                	je     802652 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8025dc:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025df:	74 36                	je     802617 <_pipeisclosed+0x81>
+  8025e1:	89 e0                	mov    %esp,%eax
+  8025e3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025e8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025ee:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025f3:	77 b0                	ja     8025a5 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025f5:	c1 e8 10             	shr    $0x10,%eax
+  8025f8:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8025fe:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802604:	eb 9f                	jmp    8025a5 <_pipeisclosed+0xf>
+  802606:	c1 e8 10             	shr    $0x10,%eax
+  802609:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80260f:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802615:	eb be                	jmp    8025d5 <_pipeisclosed+0x3f>
+  802617:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802619:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80261e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802624:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802629:	76 16                	jbe    802641 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80262b:	8b 42 58             	mov    0x58(%edx),%eax
+  80262e:	6a 01                	push   $0x1
+  802630:	50                   	push   %eax
+  802631:	53                   	push   %ebx
+  802632:	68 fb 30 80 00       	push   $0x8030fb
+  802637:	e8 59 dc ff ff       	call   800295 <cprintf>
+  80263c:	83 c4 10             	add    $0x10,%esp
+  80263f:	eb a0                	jmp    8025e1 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802641:	c1 e8 10             	shr    $0x10,%eax
+  802644:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80264a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802650:	eb d9                	jmp    80262b <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  802652:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802655:	0f 94 c0             	sete   %al
+  802658:	0f b6 c0             	movzbl %al,%eax
+}
+  80265b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80265e:	5b                   	pop    %ebx
+  80265f:	5e                   	pop    %esi
+  802660:	5f                   	pop    %edi
+  802661:	5d                   	pop    %ebp
+  802662:	c3                   	ret
+
+00802663 <devpipe_write>:
+{
+  802663:	55                   	push   %ebp
+  802664:	89 e5                	mov    %esp,%ebp
+  802666:	57                   	push   %edi
+  802667:	56                   	push   %esi
+  802668:	53                   	push   %ebx
+  802669:	83 ec 28             	sub    $0x28,%esp
+  80266c:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  80266f:	56                   	push   %esi
+  802670:	e8 e6 f1 ff ff       	call   80185b <fd2data>
+  802675:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80267f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802682:	75 09                	jne    80268d <devpipe_write+0x2a>
+	return i;
+  802684:	89 f8                	mov    %edi,%eax
+  802686:	eb 23                	jmp    8026ab <devpipe_write+0x48>
+			sys_yield();
+  802688:	e8 02 e7 ff ff       	call   800d8f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80268d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802690:	8b 0b                	mov    (%ebx),%ecx
+  802692:	8d 51 20             	lea    0x20(%ecx),%edx
+  802695:	39 d0                	cmp    %edx,%eax
+  802697:	72 1a                	jb     8026b3 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802699:	89 da                	mov    %ebx,%edx
+  80269b:	89 f0                	mov    %esi,%eax
+  80269d:	e8 f4 fe ff ff       	call   802596 <_pipeisclosed>
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	74 e2                	je     802688 <devpipe_write+0x25>
+				return 0;
+  8026a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ae:	5b                   	pop    %ebx
+  8026af:	5e                   	pop    %esi
+  8026b0:	5f                   	pop    %edi
+  8026b1:	5d                   	pop    %ebp
+  8026b2:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026b6:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8026ba:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8026bd:	89 c2                	mov    %eax,%edx
+  8026bf:	c1 fa 1f             	sar    $0x1f,%edx
+  8026c2:	89 d1                	mov    %edx,%ecx
+  8026c4:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026c7:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026ca:	83 e2 1f             	and    $0x1f,%edx
+  8026cd:	29 ca                	sub    %ecx,%edx
+  8026cf:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8026d3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8026d7:	83 c0 01             	add    $0x1,%eax
+  8026da:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8026dd:	83 c7 01             	add    $0x1,%edi
+  8026e0:	eb 9d                	jmp    80267f <devpipe_write+0x1c>
+
+008026e2 <devpipe_read>:
+{
+  8026e2:	55                   	push   %ebp
+  8026e3:	89 e5                	mov    %esp,%ebp
+  8026e5:	57                   	push   %edi
+  8026e6:	56                   	push   %esi
+  8026e7:	53                   	push   %ebx
+  8026e8:	83 ec 18             	sub    $0x18,%esp
+  8026eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8026ee:	57                   	push   %edi
+  8026ef:	e8 67 f1 ff ff       	call   80185b <fd2data>
+  8026f4:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8026f6:	83 c4 10             	add    $0x10,%esp
+  8026f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8026fe:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802701:	75 13                	jne    802716 <devpipe_read+0x34>
+	return i;
+  802703:	89 f0                	mov    %esi,%eax
+  802705:	eb 02                	jmp    802709 <devpipe_read+0x27>
+				return i;
+  802707:	89 f0                	mov    %esi,%eax
+}
+  802709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80270c:	5b                   	pop    %ebx
+  80270d:	5e                   	pop    %esi
+  80270e:	5f                   	pop    %edi
+  80270f:	5d                   	pop    %ebp
+  802710:	c3                   	ret
+			sys_yield();
+  802711:	e8 79 e6 ff ff       	call   800d8f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802716:	8b 03                	mov    (%ebx),%eax
+  802718:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80271b:	75 18                	jne    802735 <devpipe_read+0x53>
+			if (i > 0)
+  80271d:	85 f6                	test   %esi,%esi
+  80271f:	75 e6                	jne    802707 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802721:	89 da                	mov    %ebx,%edx
+  802723:	89 f8                	mov    %edi,%eax
+  802725:	e8 6c fe ff ff       	call   802596 <_pipeisclosed>
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	74 e3                	je     802711 <devpipe_read+0x2f>
+				return 0;
+  80272e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802733:	eb d4                	jmp    802709 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802735:	99                   	cltd
+  802736:	c1 ea 1b             	shr    $0x1b,%edx
+  802739:	01 d0                	add    %edx,%eax
+  80273b:	83 e0 1f             	and    $0x1f,%eax
+  80273e:	29 d0                	sub    %edx,%eax
+  802740:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802745:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802748:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  80274b:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80274e:	83 c6 01             	add    $0x1,%esi
+  802751:	eb ab                	jmp    8026fe <devpipe_read+0x1c>
+
+00802753 <pipe>:
+{
+  802753:	55                   	push   %ebp
+  802754:	89 e5                	mov    %esp,%ebp
+  802756:	56                   	push   %esi
+  802757:	53                   	push   %ebx
+  802758:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80275b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80275e:	50                   	push   %eax
+  80275f:	e8 0e f1 ff ff       	call   801872 <fd_alloc>
+  802764:	89 c3                	mov    %eax,%ebx
+  802766:	83 c4 10             	add    $0x10,%esp
+  802769:	85 c0                	test   %eax,%eax
+  80276b:	0f 88 23 01 00 00    	js     802894 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802771:	83 ec 04             	sub    $0x4,%esp
+  802774:	68 07 04 00 00       	push   $0x407
+  802779:	ff 75 f4             	push   -0xc(%ebp)
+  80277c:	6a 00                	push   $0x0
+  80277e:	e8 52 e6 ff ff       	call   800dd5 <sys_page_alloc>
+  802783:	89 c3                	mov    %eax,%ebx
+  802785:	83 c4 10             	add    $0x10,%esp
+  802788:	85 c0                	test   %eax,%eax
+  80278a:	0f 88 04 01 00 00    	js     802894 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802790:	83 ec 0c             	sub    $0xc,%esp
+  802793:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802796:	50                   	push   %eax
+  802797:	e8 d6 f0 ff ff       	call   801872 <fd_alloc>
+  80279c:	89 c3                	mov    %eax,%ebx
+  80279e:	83 c4 10             	add    $0x10,%esp
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	0f 88 db 00 00 00    	js     802884 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027a9:	83 ec 04             	sub    $0x4,%esp
+  8027ac:	68 07 04 00 00       	push   $0x407
+  8027b1:	ff 75 f0             	push   -0x10(%ebp)
+  8027b4:	6a 00                	push   $0x0
+  8027b6:	e8 1a e6 ff ff       	call   800dd5 <sys_page_alloc>
+  8027bb:	89 c3                	mov    %eax,%ebx
+  8027bd:	83 c4 10             	add    $0x10,%esp
+  8027c0:	85 c0                	test   %eax,%eax
+  8027c2:	0f 88 bc 00 00 00    	js     802884 <pipe+0x131>
+	va = fd2data(fd0);
+  8027c8:	83 ec 0c             	sub    $0xc,%esp
+  8027cb:	ff 75 f4             	push   -0xc(%ebp)
+  8027ce:	e8 88 f0 ff ff       	call   80185b <fd2data>
+  8027d3:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027d5:	83 c4 0c             	add    $0xc,%esp
+  8027d8:	68 07 04 00 00       	push   $0x407
+  8027dd:	50                   	push   %eax
+  8027de:	6a 00                	push   $0x0
+  8027e0:	e8 f0 e5 ff ff       	call   800dd5 <sys_page_alloc>
+  8027e5:	89 c3                	mov    %eax,%ebx
+  8027e7:	83 c4 10             	add    $0x10,%esp
+  8027ea:	85 c0                	test   %eax,%eax
+  8027ec:	0f 88 82 00 00 00    	js     802874 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027f2:	83 ec 0c             	sub    $0xc,%esp
+  8027f5:	ff 75 f0             	push   -0x10(%ebp)
+  8027f8:	e8 5e f0 ff ff       	call   80185b <fd2data>
+  8027fd:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802804:	50                   	push   %eax
+  802805:	6a 00                	push   $0x0
+  802807:	56                   	push   %esi
+  802808:	6a 00                	push   $0x0
+  80280a:	e8 33 e6 ff ff       	call   800e42 <sys_page_map>
+  80280f:	89 c3                	mov    %eax,%ebx
+  802811:	83 c4 20             	add    $0x20,%esp
+  802814:	85 c0                	test   %eax,%eax
+  802816:	78 4e                	js     802866 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802818:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  80281d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802820:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802822:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802825:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80282c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80282f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802831:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802834:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80283b:	83 ec 0c             	sub    $0xc,%esp
+  80283e:	ff 75 f4             	push   -0xc(%ebp)
+  802841:	e8 05 f0 ff ff       	call   80184b <fd2num>
+  802846:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802849:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80284b:	83 c4 04             	add    $0x4,%esp
+  80284e:	ff 75 f0             	push   -0x10(%ebp)
+  802851:	e8 f5 ef ff ff       	call   80184b <fd2num>
+  802856:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802859:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80285c:	83 c4 10             	add    $0x10,%esp
+  80285f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802864:	eb 2e                	jmp    802894 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802866:	83 ec 08             	sub    $0x8,%esp
+  802869:	56                   	push   %esi
+  80286a:	6a 00                	push   $0x0
+  80286c:	e8 3f e6 ff ff       	call   800eb0 <sys_page_unmap>
+  802871:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802874:	83 ec 08             	sub    $0x8,%esp
+  802877:	ff 75 f0             	push   -0x10(%ebp)
+  80287a:	6a 00                	push   $0x0
+  80287c:	e8 2f e6 ff ff       	call   800eb0 <sys_page_unmap>
+  802881:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802884:	83 ec 08             	sub    $0x8,%esp
+  802887:	ff 75 f4             	push   -0xc(%ebp)
+  80288a:	6a 00                	push   $0x0
+  80288c:	e8 1f e6 ff ff       	call   800eb0 <sys_page_unmap>
+  802891:	83 c4 10             	add    $0x10,%esp
+}
+  802894:	89 d8                	mov    %ebx,%eax
+  802896:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802899:	5b                   	pop    %ebx
+  80289a:	5e                   	pop    %esi
+  80289b:	5d                   	pop    %ebp
+  80289c:	c3                   	ret
+
+0080289d <pipeisclosed>:
+{
+  80289d:	55                   	push   %ebp
+  80289e:	89 e5                	mov    %esp,%ebp
+  8028a0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028a6:	50                   	push   %eax
+  8028a7:	ff 75 08             	push   0x8(%ebp)
+  8028aa:	e8 19 f0 ff ff       	call   8018c8 <fd_lookup>
+  8028af:	83 c4 10             	add    $0x10,%esp
+  8028b2:	85 c0                	test   %eax,%eax
+  8028b4:	78 18                	js     8028ce <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8028b6:	83 ec 0c             	sub    $0xc,%esp
+  8028b9:	ff 75 f4             	push   -0xc(%ebp)
+  8028bc:	e8 9a ef ff ff       	call   80185b <fd2data>
+  8028c1:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8028c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c6:	e8 cb fc ff ff       	call   802596 <_pipeisclosed>
+  8028cb:	83 c4 10             	add    $0x10,%esp
+}
+  8028ce:	c9                   	leave
+  8028cf:	c3                   	ret
+
+008028d0 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8028d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d5:	c3                   	ret
+
+008028d6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8028dc:	68 13 31 80 00       	push   $0x803113
+  8028e1:	ff 75 0c             	push   0xc(%ebp)
+  8028e4:	e8 f4 df ff ff       	call   8008dd <strcpy>
+	return 0;
+}
+  8028e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ee:	c9                   	leave
+  8028ef:	c3                   	ret
+
+008028f0 <devcons_write>:
+{
+  8028f0:	55                   	push   %ebp
+  8028f1:	89 e5                	mov    %esp,%ebp
+  8028f3:	57                   	push   %edi
+  8028f4:	56                   	push   %esi
+  8028f5:	53                   	push   %ebx
+  8028f6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8028fc:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802901:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802907:	eb 2e                	jmp    802937 <devcons_write+0x47>
+		m = n - tot;
+  802909:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80290c:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80290e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802913:	39 c3                	cmp    %eax,%ebx
+  802915:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802918:	83 ec 04             	sub    $0x4,%esp
+  80291b:	53                   	push   %ebx
+  80291c:	89 f0                	mov    %esi,%eax
+  80291e:	03 45 0c             	add    0xc(%ebp),%eax
+  802921:	50                   	push   %eax
+  802922:	57                   	push   %edi
+  802923:	e8 3b e1 ff ff       	call   800a63 <memmove>
+		sys_cputs(buf, m);
+  802928:	83 c4 08             	add    $0x8,%esp
+  80292b:	53                   	push   %ebx
+  80292c:	57                   	push   %edi
+  80292d:	e8 24 e3 ff ff       	call   800c56 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802932:	01 de                	add    %ebx,%esi
+  802934:	83 c4 10             	add    $0x10,%esp
+  802937:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80293a:	72 cd                	jb     802909 <devcons_write+0x19>
+}
+  80293c:	89 f0                	mov    %esi,%eax
+  80293e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802941:	5b                   	pop    %ebx
+  802942:	5e                   	pop    %esi
+  802943:	5f                   	pop    %edi
+  802944:	5d                   	pop    %ebp
+  802945:	c3                   	ret
+
+00802946 <devcons_read>:
+{
+  802946:	55                   	push   %ebp
+  802947:	89 e5                	mov    %esp,%ebp
+  802949:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80294c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802951:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802955:	75 07                	jne    80295e <devcons_read+0x18>
+  802957:	eb 1f                	jmp    802978 <devcons_read+0x32>
+		sys_yield();
+  802959:	e8 31 e4 ff ff       	call   800d8f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80295e:	e8 37 e3 ff ff       	call   800c9a <sys_cgetc>
+  802963:	85 c0                	test   %eax,%eax
+  802965:	74 f2                	je     802959 <devcons_read+0x13>
+	if (c < 0)
+  802967:	78 0f                	js     802978 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802969:	83 f8 04             	cmp    $0x4,%eax
+  80296c:	74 0c                	je     80297a <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80296e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802971:	88 02                	mov    %al,(%edx)
+	return 1;
+  802973:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802978:	c9                   	leave
+  802979:	c3                   	ret
+		return 0;
+  80297a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297f:	eb f7                	jmp    802978 <devcons_read+0x32>
+
+00802981 <cputchar>:
+{
+  802981:	55                   	push   %ebp
+  802982:	89 e5                	mov    %esp,%ebp
+  802984:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802987:	8b 45 08             	mov    0x8(%ebp),%eax
+  80298a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80298d:	6a 01                	push   $0x1
+  80298f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802992:	50                   	push   %eax
+  802993:	e8 be e2 ff ff       	call   800c56 <sys_cputs>
+}
+  802998:	83 c4 10             	add    $0x10,%esp
+  80299b:	c9                   	leave
+  80299c:	c3                   	ret
+
+0080299d <getchar>:
+{
+  80299d:	55                   	push   %ebp
+  80299e:	89 e5                	mov    %esp,%ebp
+  8029a0:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8029a3:	6a 01                	push   $0x1
+  8029a5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029a8:	50                   	push   %eax
+  8029a9:	6a 00                	push   $0x0
+  8029ab:	e8 9e f1 ff ff       	call   801b4e <read>
+	if (r < 0)
+  8029b0:	83 c4 10             	add    $0x10,%esp
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	78 06                	js     8029bd <getchar+0x20>
+	if (r < 1)
+  8029b7:	74 06                	je     8029bf <getchar+0x22>
+	return c;
+  8029b9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029bd:	c9                   	leave
+  8029be:	c3                   	ret
+		return -E_EOF;
+  8029bf:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029c4:	eb f7                	jmp    8029bd <getchar+0x20>
+
+008029c6 <iscons>:
+{
+  8029c6:	55                   	push   %ebp
+  8029c7:	89 e5                	mov    %esp,%ebp
+  8029c9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029cf:	50                   	push   %eax
+  8029d0:	ff 75 08             	push   0x8(%ebp)
+  8029d3:	e8 f0 ee ff ff       	call   8018c8 <fd_lookup>
+  8029d8:	83 c4 10             	add    $0x10,%esp
+  8029db:	85 c0                	test   %eax,%eax
+  8029dd:	78 11                	js     8029f0 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8029df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029e2:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8029e8:	39 10                	cmp    %edx,(%eax)
+  8029ea:	0f 94 c0             	sete   %al
+  8029ed:	0f b6 c0             	movzbl %al,%eax
+}
+  8029f0:	c9                   	leave
+  8029f1:	c3                   	ret
+
+008029f2 <opencons>:
+{
+  8029f2:	55                   	push   %ebp
+  8029f3:	89 e5                	mov    %esp,%ebp
+  8029f5:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8029f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029fb:	50                   	push   %eax
+  8029fc:	e8 71 ee ff ff       	call   801872 <fd_alloc>
+  802a01:	83 c4 10             	add    $0x10,%esp
+  802a04:	85 c0                	test   %eax,%eax
+  802a06:	78 3a                	js     802a42 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802a08:	83 ec 04             	sub    $0x4,%esp
+  802a0b:	68 07 04 00 00       	push   $0x407
+  802a10:	ff 75 f4             	push   -0xc(%ebp)
+  802a13:	6a 00                	push   $0x0
+  802a15:	e8 bb e3 ff ff       	call   800dd5 <sys_page_alloc>
+  802a1a:	83 c4 10             	add    $0x10,%esp
+  802a1d:	85 c0                	test   %eax,%eax
+  802a1f:	78 21                	js     802a42 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802a21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a24:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a2a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802a2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a2f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802a36:	83 ec 0c             	sub    $0xc,%esp
+  802a39:	50                   	push   %eax
+  802a3a:	e8 0c ee ff ff       	call   80184b <fd2num>
+  802a3f:	83 c4 10             	add    $0x10,%esp
+}
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+
+00802a44 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802a44:	55                   	push   %ebp
+  802a45:	89 e5                	mov    %esp,%ebp
+  802a47:	56                   	push   %esi
+  802a48:	53                   	push   %ebx
+  802a49:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a4f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a59:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802a5c:	83 ec 08             	sub    $0x8,%esp
+  802a5f:	ff 75 14             	push   0x14(%ebp)
+  802a62:	50                   	push   %eax
+  802a63:	e8 7e e7 ff ff       	call   8011e6 <sys_ipc_recv_until>
+  802a68:	83 c4 10             	add    $0x10,%esp
+  802a6b:	85 c0                	test   %eax,%eax
+  802a6d:	78 61                	js     802ad0 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802a6f:	85 f6                	test   %esi,%esi
+  802a71:	74 1c                	je     802a8f <ipc_recv_until+0x4b>
+  802a73:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a75:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a7a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a80:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a85:	76 5f                	jbe    802ae6 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802a87:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802a8d:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802a8f:	85 db                	test   %ebx,%ebx
+  802a91:	74 1c                	je     802aaf <ipc_recv_until+0x6b>
+  802a93:	89 e0                	mov    %esp,%eax
+  802a95:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a9a:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802aa0:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802aa5:	76 50                	jbe    802af7 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802aa7:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802aad:	89 03                	mov    %eax,(%ebx)
+  802aaf:	89 e0                	mov    %esp,%eax
+  802ab1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ab6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802abc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802ac1:	76 45                	jbe    802b08 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802ac3:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802ac9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802acc:	5b                   	pop    %ebx
+  802acd:	5e                   	pop    %esi
+  802ace:	5d                   	pop    %ebp
+  802acf:	c3                   	ret
+		if (from_env_store)
+  802ad0:	85 f6                	test   %esi,%esi
+  802ad2:	74 06                	je     802ada <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802ad4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ada:	85 db                	test   %ebx,%ebx
+  802adc:	74 eb                	je     802ac9 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802ade:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802ae4:	eb e3                	jmp    802ac9 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802ae6:	c1 e8 10             	shr    $0x10,%eax
+  802ae9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802aef:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802af5:	eb 90                	jmp    802a87 <ipc_recv_until+0x43>
+  802af7:	c1 e8 10             	shr    $0x10,%eax
+  802afa:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b00:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b06:	eb 9f                	jmp    802aa7 <ipc_recv_until+0x63>
+  802b08:	c1 e8 10             	shr    $0x10,%eax
+  802b0b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b11:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b17:	eb aa                	jmp    802ac3 <ipc_recv_until+0x7f>
+
+00802b19 <ipc_recv>:
+{
+  802b19:	55                   	push   %ebp
+  802b1a:	89 e5                	mov    %esp,%ebp
+  802b1c:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802b1f:	6a 00                	push   $0x0
+  802b21:	ff 75 10             	push   0x10(%ebp)
+  802b24:	ff 75 0c             	push   0xc(%ebp)
+  802b27:	ff 75 08             	push   0x8(%ebp)
+  802b2a:	e8 15 ff ff ff       	call   802a44 <ipc_recv_until>
+}
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+
+00802b31 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b31:	55                   	push   %ebp
+  802b32:	89 e5                	mov    %esp,%ebp
+  802b34:	57                   	push   %edi
+  802b35:	56                   	push   %esi
+  802b36:	53                   	push   %ebx
+  802b37:	83 ec 0c             	sub    $0xc,%esp
+  802b3a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b43:	85 db                	test   %ebx,%ebx
+  802b45:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b4a:	0f 44 d8             	cmove  %eax,%ebx
+  802b4d:	eb 05                	jmp    802b54 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802b4f:	e8 3b e2 ff ff       	call   800d8f <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802b54:	ff 75 14             	push   0x14(%ebp)
+  802b57:	53                   	push   %ebx
+  802b58:	56                   	push   %esi
+  802b59:	57                   	push   %edi
+  802b5a:	e8 d3 e5 ff ff       	call   801132 <sys_ipc_try_send>
+  802b5f:	83 c4 10             	add    $0x10,%esp
+  802b62:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b65:	74 e8                	je     802b4f <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802b67:	85 c0                	test   %eax,%eax
+  802b69:	78 08                	js     802b73 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802b6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6e:	5b                   	pop    %ebx
+  802b6f:	5e                   	pop    %esi
+  802b70:	5f                   	pop    %edi
+  802b71:	5d                   	pop    %ebp
+  802b72:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802b73:	50                   	push   %eax
+  802b74:	68 1f 31 80 00       	push   $0x80311f
+  802b79:	6a 4f                	push   $0x4f
+  802b7b:	68 32 31 80 00       	push   $0x803132
+  802b80:	e8 35 d6 ff ff       	call   8001ba <_panic>
+
+00802b85 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b85:	55                   	push   %ebp
+  802b86:	89 e5                	mov    %esp,%ebp
+  802b88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802b90:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802b96:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802b9c:	8b 52 50             	mov    0x50(%edx),%edx
+  802b9f:	39 ca                	cmp    %ecx,%edx
+  802ba1:	74 11                	je     802bb4 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802ba3:	83 c0 01             	add    $0x1,%eax
+  802ba6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802bab:	75 e3                	jne    802b90 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb2:	eb 0e                	jmp    802bc2 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802bb4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802bba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bbf:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bc2:	5d                   	pop    %ebp
+  802bc3:	c3                   	ret
+
+00802bc4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bc4:	55                   	push   %ebp
+  802bc5:	89 e5                	mov    %esp,%ebp
+  802bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bca:	89 c2                	mov    %eax,%edx
+  802bcc:	c1 ea 16             	shr    $0x16,%edx
+  802bcf:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802bd6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bdb:	f6 c1 01             	test   $0x1,%cl
+  802bde:	74 1a                	je     802bfa <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802be0:	c1 e8 0c             	shr    $0xc,%eax
+  802be3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802bea:	a8 01                	test   $0x1,%al
+  802bec:	74 0c                	je     802bfa <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802bee:	c1 e8 0c             	shr    $0xc,%eax
+  802bf1:	c1 e0 04             	shl    $0x4,%eax
+  802bf4:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802bfa:	89 d0                	mov    %edx,%eax
+  802bfc:	5d                   	pop    %ebp
+  802bfd:	c3                   	ret
@@ -0,0 +1,6366 @@
+
+obj/user/top.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 58 00 00 00       	call   800089 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+	int limit = 20;
+
+	if (argc > 2) {
+  80003c:	83 fa 02             	cmp    $0x2,%edx
+  80003f:	7f 15                	jg     800056 <umain+0x23>
+	int limit = 20;
+  800041:	b8 14 00 00 00       	mov    $0x14,%eax
+		printf("usage: top [n]\n");
+		exit();
+	}
+	if (argc == 2)
+  800046:	74 2a                	je     800072 <umain+0x3f>
+		limit = strtol(argv[1], 0, 10);
+	sys_env_print_stats(limit);
+  800048:	83 ec 0c             	sub    $0xc,%esp
+  80004b:	50                   	push   %eax
+  80004c:	e8 00 12 00 00       	call   801251 <sys_env_print_stats>
+}
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	c9                   	leave
+  800055:	c3                   	ret
+		printf("usage: top [n]\n");
+  800056:	83 ec 0c             	sub    $0xc,%esp
+  800059:	68 c0 2c 80 00       	push   $0x802cc0
+  80005e:	e8 e4 20 00 00       	call   802147 <printf>
+		exit();
+  800063:	e8 cb 00 00 00       	call   800133 <exit>
+  800068:	83 c4 10             	add    $0x10,%esp
+	int limit = 20;
+  80006b:	b8 14 00 00 00       	mov    $0x14,%eax
+  800070:	eb d6                	jmp    800048 <umain+0x15>
+		limit = strtol(argv[1], 0, 10);
+  800072:	83 ec 04             	sub    $0x4,%esp
+  800075:	6a 0a                	push   $0xa
+  800077:	6a 00                	push   $0x0
+  800079:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80007c:	ff 70 04             	push   0x4(%eax)
+  80007f:	e8 40 0a 00 00       	call   800ac4 <strtol>
+  800084:	83 c4 10             	add    $0x10,%esp
+  800087:	eb bf                	jmp    800048 <umain+0x15>
+
+00800089 <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800089:	55                   	push   %ebp
+  80008a:	89 e5                	mov    %esp,%ebp
+  80008c:	57                   	push   %edi
+  80008d:	56                   	push   %esi
+  80008e:	53                   	push   %ebx
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800095:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  800098:	b8 01 00 00 00       	mov    $0x1,%eax
+  80009d:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  80009f:	c1 ea 0b             	shr    $0xb,%edx
+  8000a2:	83 f2 01             	xor    $0x1,%edx
+  8000a5:	83 e2 01             	and    $0x1,%edx
+  8000a8:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  8000ae:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  8000b5:	00 00 00 
+	envid = sys_getenvid();
+  8000b8:	e8 1f 0c 00 00       	call   800cdc <sys_getenvid>
+  8000bd:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  8000bf:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  8000c4:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  8000ca:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8000d0:	8b 52 48             	mov    0x48(%edx),%edx
+  8000d3:	39 ca                	cmp    %ecx,%edx
+  8000d5:	74 27                	je     8000fe <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  8000d7:	83 c0 01             	add    $0x1,%eax
+  8000da:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8000df:	75 e3                	jne    8000c4 <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  8000e1:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  8000e8:	75 24                	jne    80010e <libmain+0x85>
+		panic("libmain can't find the environment");
+  8000ea:	83 ec 04             	sub    $0x4,%esp
+  8000ed:	68 d0 2c 80 00       	push   $0x802cd0
+  8000f2:	6a 23                	push   $0x23
+  8000f4:	68 f3 2c 80 00       	push   $0x802cf3
+  8000f9:	e8 4f 00 00 00       	call   80014d <_panic>
+			mainenv = &envs[i];
+  8000fe:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800104:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800109:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80010e:	85 ff                	test   %edi,%edi
+  800110:	7e 07                	jle    800119 <libmain+0x90>
+		binaryname = argv[0];
+  800112:	8b 06                	mov    (%esi),%eax
+  800114:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800119:	83 ec 08             	sub    $0x8,%esp
+  80011c:	56                   	push   %esi
+  80011d:	57                   	push   %edi
+  80011e:	e8 10 ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800123:	e8 0b 00 00 00       	call   800133 <exit>
+}
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80012e:	5b                   	pop    %ebx
+  80012f:	5e                   	pop    %esi
+  800130:	5f                   	pop    %edi
+  800131:	5d                   	pop    %ebp
+  800132:	c3                   	ret
+
+00800133 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800133:	55                   	push   %ebp
+  800134:	89 e5                	mov    %esp,%ebp
+  800136:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800139:	e8 94 18 00 00       	call   8019d2 <close_all>
+	sys_env_destroy(0);
+  80013e:	83 ec 0c             	sub    $0xc,%esp
+  800141:	6a 00                	push   $0x0
+  800143:	e8 2b 0b 00 00       	call   800c73 <sys_env_destroy>
+}
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	c9                   	leave
+  80014c:	c3                   	ret
+
+0080014d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80014d:	55                   	push   %ebp
+  80014e:	89 e5                	mov    %esp,%ebp
+  800150:	56                   	push   %esi
+  800151:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800152:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800155:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80015b:	e8 7c 0b 00 00       	call   800cdc <sys_getenvid>
+  800160:	83 ec 0c             	sub    $0xc,%esp
+  800163:	ff 75 0c             	push   0xc(%ebp)
+  800166:	ff 75 08             	push   0x8(%ebp)
+  800169:	56                   	push   %esi
+  80016a:	50                   	push   %eax
+  80016b:	68 0c 2d 80 00       	push   $0x802d0c
+  800170:	e8 b3 00 00 00       	call   800228 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800175:	83 c4 18             	add    $0x18,%esp
+  800178:	53                   	push   %ebx
+  800179:	ff 75 10             	push   0x10(%ebp)
+  80017c:	e8 56 00 00 00       	call   8001d7 <vcprintf>
+	cprintf("\n");
+  800181:	c7 04 24 ce 2c 80 00 	movl   $0x802cce,(%esp)
+  800188:	e8 9b 00 00 00       	call   800228 <cprintf>
+  80018d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800190:	cc                   	int3
+	while (1)
+  800191:	eb fd                	jmp    800190 <_panic+0x43>
+
+00800193 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800193:	55                   	push   %ebp
+  800194:	89 e5                	mov    %esp,%ebp
+  800196:	53                   	push   %ebx
+  800197:	83 ec 04             	sub    $0x4,%esp
+  80019a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80019d:	8b 13                	mov    (%ebx),%edx
+  80019f:	8d 42 01             	lea    0x1(%edx),%eax
+  8001a2:	89 03                	mov    %eax,(%ebx)
+  8001a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ab:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001b0:	74 09                	je     8001bb <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001b2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b9:	c9                   	leave
+  8001ba:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001bb:	83 ec 08             	sub    $0x8,%esp
+  8001be:	68 ff 00 00 00       	push   $0xff
+  8001c3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c6:	50                   	push   %eax
+  8001c7:	e8 1d 0a 00 00       	call   800be9 <sys_cputs>
+		b->idx = 0;
+  8001cc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001d2:	83 c4 10             	add    $0x10,%esp
+  8001d5:	eb db                	jmp    8001b2 <putch+0x1f>
+
+008001d7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001e0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e7:	00 00 00 
+	b.cnt = 0;
+  8001ea:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001f1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001f4:	ff 75 0c             	push   0xc(%ebp)
+  8001f7:	ff 75 08             	push   0x8(%ebp)
+  8001fa:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800200:	50                   	push   %eax
+  800201:	68 93 01 80 00       	push   $0x800193
+  800206:	e8 fb 00 00 00       	call   800306 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80020b:	83 c4 08             	add    $0x8,%esp
+  80020e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800214:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80021a:	50                   	push   %eax
+  80021b:	e8 c9 09 00 00       	call   800be9 <sys_cputs>
+
+	return b.cnt;
+}
+  800220:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+
+00800228 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800228:	55                   	push   %ebp
+  800229:	89 e5                	mov    %esp,%ebp
+  80022b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80022e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800231:	50                   	push   %eax
+  800232:	ff 75 08             	push   0x8(%ebp)
+  800235:	e8 9d ff ff ff       	call   8001d7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	83 ec 1c             	sub    $0x1c,%esp
+  800245:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800248:	89 d6                	mov    %edx,%esi
+  80024a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80024d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800250:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  800253:	73 0b                	jae    800260 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  800255:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800258:	c1 e7 08             	shl    $0x8,%edi
+  80025b:	0b 7d 10             	or     0x10(%ebp),%edi
+  80025e:	eb 36                	jmp    800296 <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800260:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800263:	ba 00 00 00 00       	mov    $0x0,%edx
+  800268:	f7 75 08             	divl   0x8(%ebp)
+  80026b:	89 c1                	mov    %eax,%ecx
+  80026d:	ff 75 14             	push   0x14(%ebp)
+  800270:	ff 75 10             	push   0x10(%ebp)
+  800273:	83 eb 01             	sub    $0x1,%ebx
+  800276:	53                   	push   %ebx
+  800277:	ff 75 08             	push   0x8(%ebp)
+  80027a:	89 f2                	mov    %esi,%edx
+  80027c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80027f:	e8 b8 ff ff ff       	call   80023c <printnum>
+  800284:	83 c4 10             	add    $0x10,%esp
+  800287:	eb 14                	jmp    80029d <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  800289:	83 ec 08             	sub    $0x8,%esp
+  80028c:	56                   	push   %esi
+  80028d:	57                   	push   %edi
+  80028e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800291:	ff d0                	call   *%eax
+  800293:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800296:	83 eb 01             	sub    $0x1,%ebx
+  800299:	85 db                	test   %ebx,%ebx
+  80029b:	7f ec                	jg     800289 <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  80029d:	83 ec 08             	sub    $0x8,%esp
+  8002a0:	56                   	push   %esi
+  8002a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a9:	f7 75 08             	divl   0x8(%ebp)
+  8002ac:	0f be 92 2f 2d 80 00 	movsbl 0x802d2f(%edx),%edx
+  8002b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002b6:	c1 e0 08             	shl    $0x8,%eax
+  8002b9:	09 d0                	or     %edx,%eax
+  8002bb:	50                   	push   %eax
+  8002bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002bf:	ff d0                	call   *%eax
+}
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c7:	5b                   	pop    %ebx
+  8002c8:	5e                   	pop    %esi
+  8002c9:	5f                   	pop    %edi
+  8002ca:	5d                   	pop    %ebp
+  8002cb:	c3                   	ret
+
+008002cc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002d2:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002d6:	8b 10                	mov    (%eax),%edx
+  8002d8:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002db:	73 0a                	jae    8002e7 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002dd:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002e0:	89 08                	mov    %ecx,(%eax)
+  8002e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e5:	88 02                	mov    %al,(%edx)
+}
+  8002e7:	5d                   	pop    %ebp
+  8002e8:	c3                   	ret
+
+008002e9 <printfmt>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002ef:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002f2:	50                   	push   %eax
+  8002f3:	ff 75 10             	push   0x10(%ebp)
+  8002f6:	ff 75 0c             	push   0xc(%ebp)
+  8002f9:	ff 75 08             	push   0x8(%ebp)
+  8002fc:	e8 05 00 00 00       	call   800306 <vprintfmt>
+}
+  800301:	83 c4 10             	add    $0x10,%esp
+  800304:	c9                   	leave
+  800305:	c3                   	ret
+
+00800306 <vprintfmt>:
+{
+  800306:	55                   	push   %ebp
+  800307:	89 e5                	mov    %esp,%ebp
+  800309:	57                   	push   %edi
+  80030a:	56                   	push   %esi
+  80030b:	53                   	push   %ebx
+  80030c:	83 ec 3c             	sub    $0x3c,%esp
+  80030f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800312:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  800315:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80031c:	eb 16                	jmp    800334 <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  80031e:	83 ec 08             	sub    $0x8,%esp
+  800321:	ff 75 0c             	push   0xc(%ebp)
+  800324:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800327:	c1 e2 08             	shl    $0x8,%edx
+  80032a:	09 d0                	or     %edx,%eax
+  80032c:	50                   	push   %eax
+  80032d:	ff d7                	call   *%edi
+  80032f:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800332:	89 de                	mov    %ebx,%esi
+  800334:	8d 5e 01             	lea    0x1(%esi),%ebx
+  800337:	0f b6 06             	movzbl (%esi),%eax
+  80033a:	83 f8 25             	cmp    $0x25,%eax
+  80033d:	74 0c                	je     80034b <vprintfmt+0x45>
+			if (ch == '\0')
+  80033f:	85 c0                	test   %eax,%eax
+  800341:	75 db                	jne    80031e <vprintfmt+0x18>
+}
+  800343:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800346:	5b                   	pop    %ebx
+  800347:	5e                   	pop    %esi
+  800348:	5f                   	pop    %edi
+  800349:	5d                   	pop    %ebp
+  80034a:	c3                   	ret
+		padc = ' ';
+  80034b:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  80034f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800356:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80035d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800364:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800369:	8d 73 01             	lea    0x1(%ebx),%esi
+  80036c:	0f b6 13             	movzbl (%ebx),%edx
+  80036f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800372:	3c 55                	cmp    $0x55,%al
+  800374:	0f 87 2c 04 00 00    	ja     8007a6 <vprintfmt+0x4a0>
+  80037a:	0f b6 c0             	movzbl %al,%eax
+  80037d:	ff 24 85 80 2e 80 00 	jmp    *0x802e80(,%eax,4)
+  800384:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  800386:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  80038a:	eb dd                	jmp    800369 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80038c:	89 f3                	mov    %esi,%ebx
+  80038e:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800392:	eb d5                	jmp    800369 <vprintfmt+0x63>
+  800394:	0f b6 d2             	movzbl %dl,%edx
+  800397:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  800399:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  80039e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003a1:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003a5:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  8003a8:	8d 72 d0             	lea    -0x30(%edx),%esi
+  8003ab:	83 fe 09             	cmp    $0x9,%esi
+  8003ae:	0f 87 8a 00 00 00    	ja     80043e <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  8003b4:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  8003b7:	eb e5                	jmp    80039e <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  8003b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bc:	8b 00                	mov    (%eax),%eax
+  8003be:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ca:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  8003cc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003d0:	79 97                	jns    800369 <vprintfmt+0x63>
+				width = precision, precision = -1;
+  8003d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003d5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003df:	eb 88                	jmp    800369 <vprintfmt+0x63>
+			if (width < 0)
+  8003e1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8003e4:	85 db                	test   %ebx,%ebx
+  8003e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003eb:	0f 49 c3             	cmovns %ebx,%eax
+  8003ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f1:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8003f3:	e9 71 ff ff ff       	jmp    800369 <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f8:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8003fa:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800401:	e9 63 ff ff ff       	jmp    800369 <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  800406:	8d 73 02             	lea    0x2(%ebx),%esi
+  800409:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  80040d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  800414:	3c 67                	cmp    $0x67,%al
+  800416:	0f 84 18 ff ff ff    	je     800334 <vprintfmt+0x2e>
+					attrib = 0x04;
+  80041c:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800423:	3c 72                	cmp    $0x72,%al
+  800425:	0f 84 09 ff ff ff    	je     800334 <vprintfmt+0x2e>
+					attrib = 0x00;
+  80042b:	3c 62                	cmp    $0x62,%al
+  80042d:	0f 94 c0             	sete   %al
+  800430:	0f b6 c0             	movzbl %al,%eax
+  800433:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800436:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800439:	e9 f6 fe ff ff       	jmp    800334 <vprintfmt+0x2e>
+  80043e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800441:	eb 89                	jmp    8003cc <vprintfmt+0xc6>
+			lflag++;
+  800443:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800446:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800448:	e9 1c ff ff ff       	jmp    800369 <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80044d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800450:	8d 58 04             	lea    0x4(%eax),%ebx
+  800453:	83 ec 08             	sub    $0x8,%esp
+  800456:	ff 75 0c             	push   0xc(%ebp)
+  800459:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80045c:	c1 e0 08             	shl    $0x8,%eax
+  80045f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800462:	0b 01                	or     (%ecx),%eax
+  800464:	50                   	push   %eax
+  800465:	ff d7                	call   *%edi
+			break;
+  800467:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  80046a:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  80046d:	e9 c2 fe ff ff       	jmp    800334 <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800472:	8b 45 14             	mov    0x14(%ebp),%eax
+  800475:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  800478:	8b 10                	mov    (%eax),%edx
+  80047a:	89 d0                	mov    %edx,%eax
+  80047c:	f7 d8                	neg    %eax
+  80047e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800481:	83 f8 12             	cmp    $0x12,%eax
+  800484:	7f 25                	jg     8004ab <vprintfmt+0x1a5>
+  800486:	8b 14 85 e0 2f 80 00 	mov    0x802fe0(,%eax,4),%edx
+  80048d:	85 d2                	test   %edx,%edx
+  80048f:	74 1a                	je     8004ab <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800491:	52                   	push   %edx
+  800492:	68 21 31 80 00       	push   $0x803121
+  800497:	ff 75 0c             	push   0xc(%ebp)
+  80049a:	57                   	push   %edi
+  80049b:	e8 49 fe ff ff       	call   8002e9 <printfmt>
+  8004a0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004a3:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  8004a6:	e9 89 fe ff ff       	jmp    800334 <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  8004ab:	50                   	push   %eax
+  8004ac:	68 47 2d 80 00       	push   $0x802d47
+  8004b1:	ff 75 0c             	push   0xc(%ebp)
+  8004b4:	57                   	push   %edi
+  8004b5:	e8 2f fe ff ff       	call   8002e9 <printfmt>
+  8004ba:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bd:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004c0:	e9 6f fe ff ff       	jmp    800334 <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c8:	83 c0 04             	add    $0x4,%eax
+  8004cb:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8004ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d1:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004d3:	85 c9                	test   %ecx,%ecx
+  8004d5:	b8 40 2d 80 00       	mov    $0x802d40,%eax
+  8004da:	0f 45 c1             	cmovne %ecx,%eax
+  8004dd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  8004e0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004e4:	7e 06                	jle    8004ec <vprintfmt+0x1e6>
+  8004e6:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  8004ea:	75 1a                	jne    800506 <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  8004ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004ef:	c1 e0 08             	shl    $0x8,%eax
+  8004f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  8004f5:	83 c8 3f             	or     $0x3f,%eax
+  8004f8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004fb:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8004fe:	89 75 10             	mov    %esi,0x10(%ebp)
+  800501:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  800504:	eb 6d                	jmp    800573 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	ff 75 d0             	push   -0x30(%ebp)
+  80050c:	ff 75 c8             	push   -0x38(%ebp)
+  80050f:	e8 39 03 00 00       	call   80084d <strnlen>
+  800514:	89 c2                	mov    %eax,%edx
+  800516:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800519:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  80051b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80051e:	c1 e1 08             	shl    $0x8,%ecx
+  800521:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800525:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	89 c3                	mov    %eax,%ebx
+  80052c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052f:	89 75 10             	mov    %esi,0x10(%ebp)
+  800532:	89 ce                	mov    %ecx,%esi
+  800534:	eb 0f                	jmp    800545 <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  800536:	83 ec 08             	sub    $0x8,%esp
+  800539:	ff 75 0c             	push   0xc(%ebp)
+  80053c:	56                   	push   %esi
+  80053d:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053f:	83 eb 01             	sub    $0x1,%ebx
+  800542:	83 c4 10             	add    $0x10,%esp
+  800545:	85 db                	test   %ebx,%ebx
+  800547:	7f ed                	jg     800536 <vprintfmt+0x230>
+  800549:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054c:	8b 75 10             	mov    0x10(%ebp),%esi
+  80054f:	85 c0                	test   %eax,%eax
+  800551:	ba 00 00 00 00       	mov    $0x0,%edx
+  800556:	0f 49 d0             	cmovns %eax,%edx
+  800559:	29 d0                	sub    %edx,%eax
+  80055b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055e:	eb 8c                	jmp    8004ec <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800560:	83 ec 08             	sub    $0x8,%esp
+  800563:	ff 75 0c             	push   0xc(%ebp)
+  800566:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800569:	09 c2                	or     %eax,%edx
+  80056b:	52                   	push   %edx
+  80056c:	ff d7                	call   *%edi
+  80056e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800571:	89 d9                	mov    %ebx,%ecx
+  800573:	8d 59 01             	lea    0x1(%ecx),%ebx
+  800576:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  80057a:	0f be d0             	movsbl %al,%edx
+  80057d:	85 d2                	test   %edx,%edx
+  80057f:	74 2a                	je     8005ab <vprintfmt+0x2a5>
+  800581:	85 f6                	test   %esi,%esi
+  800583:	78 05                	js     80058a <vprintfmt+0x284>
+  800585:	83 ee 01             	sub    $0x1,%esi
+  800588:	78 3b                	js     8005c5 <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80058a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80058e:	74 d0                	je     800560 <vprintfmt+0x25a>
+  800590:	0f be c0             	movsbl %al,%eax
+  800593:	83 e8 20             	sub    $0x20,%eax
+  800596:	83 f8 5e             	cmp    $0x5e,%eax
+  800599:	76 c5                	jbe    800560 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  80059b:	83 ec 08             	sub    $0x8,%esp
+  80059e:	ff 75 0c             	push   0xc(%ebp)
+  8005a1:	ff 75 cc             	push   -0x34(%ebp)
+  8005a4:	ff d7                	call   *%edi
+  8005a6:	83 c4 10             	add    $0x10,%esp
+  8005a9:	eb c6                	jmp    800571 <vprintfmt+0x26b>
+  8005ab:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005ae:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8005b1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b4:	01 c3                	add    %eax,%ebx
+  8005b6:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  8005b8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005bb:	83 c8 20             	or     $0x20,%eax
+  8005be:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005c1:	89 c6                	mov    %eax,%esi
+  8005c3:	eb 14                	jmp    8005d9 <vprintfmt+0x2d3>
+  8005c5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005c8:	eb e4                	jmp    8005ae <vprintfmt+0x2a8>
+  8005ca:	83 ec 08             	sub    $0x8,%esp
+  8005cd:	ff 75 0c             	push   0xc(%ebp)
+  8005d0:	56                   	push   %esi
+  8005d1:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005d3:	83 eb 01             	sub    $0x1,%ebx
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	85 db                	test   %ebx,%ebx
+  8005db:	7f ed                	jg     8005ca <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005dd:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005e0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  8005e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e6:	e9 49 fd ff ff       	jmp    800334 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8005eb:	83 f9 01             	cmp    $0x1,%ecx
+  8005ee:	7f 1f                	jg     80060f <vprintfmt+0x309>
+	else if (lflag)
+  8005f0:	85 c9                	test   %ecx,%ecx
+  8005f2:	74 69                	je     80065d <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8b 00                	mov    (%eax),%eax
+  8005f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fc:	89 c1                	mov    %eax,%ecx
+  8005fe:	c1 f9 1f             	sar    $0x1f,%ecx
+  800601:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8d 40 04             	lea    0x4(%eax),%eax
+  80060a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80060d:	eb 17                	jmp    800626 <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  80060f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800612:	8b 50 04             	mov    0x4(%eax),%edx
+  800615:	8b 00                	mov    (%eax),%eax
+  800617:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80061a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8d 40 08             	lea    0x8(%eax),%eax
+  800623:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800626:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  800629:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  80062c:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  800631:	85 db                	test   %ebx,%ebx
+  800633:	0f 89 f6 00 00 00    	jns    80072f <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  800639:	83 ec 08             	sub    $0x8,%esp
+  80063c:	ff 75 0c             	push   0xc(%ebp)
+  80063f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800642:	c1 e0 08             	shl    $0x8,%eax
+  800645:	83 c8 2d             	or     $0x2d,%eax
+  800648:	50                   	push   %eax
+  800649:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80064b:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80064e:	f7 d9                	neg    %ecx
+  800650:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800653:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800658:	e9 d2 00 00 00       	jmp    80072f <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  80065d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800660:	8b 00                	mov    (%eax),%eax
+  800662:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800665:	89 c1                	mov    %eax,%ecx
+  800667:	c1 f9 1f             	sar    $0x1f,%ecx
+  80066a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80066d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800670:	8d 40 04             	lea    0x4(%eax),%eax
+  800673:	89 45 14             	mov    %eax,0x14(%ebp)
+  800676:	eb ae                	jmp    800626 <vprintfmt+0x320>
+	if (lflag >= 2)
+  800678:	83 f9 01             	cmp    $0x1,%ecx
+  80067b:	7f 19                	jg     800696 <vprintfmt+0x390>
+	else if (lflag)
+  80067d:	85 c9                	test   %ecx,%ecx
+  80067f:	74 2a                	je     8006ab <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 08                	mov    (%eax),%ecx
+  800686:	8d 40 04             	lea    0x4(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80068c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800691:	e9 99 00 00 00       	jmp    80072f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 08                	mov    (%eax),%ecx
+  80069b:	8d 40 08             	lea    0x8(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a1:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  8006a6:	e9 84 00 00 00       	jmp    80072f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ae:	8b 08                	mov    (%eax),%ecx
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  8006bb:	eb 72                	jmp    80072f <vprintfmt+0x429>
+	if (lflag >= 2)
+  8006bd:	83 f9 01             	cmp    $0x1,%ecx
+  8006c0:	7f 16                	jg     8006d8 <vprintfmt+0x3d2>
+	else if (lflag)
+  8006c2:	85 c9                	test   %ecx,%ecx
+  8006c4:	74 24                	je     8006ea <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c9:	8b 08                	mov    (%eax),%ecx
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006d1:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  8006d6:	eb 57                	jmp    80072f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 08                	mov    (%eax),%ecx
+  8006dd:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006e3:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  8006e8:	eb 45                	jmp    80072f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8b 08                	mov    (%eax),%ecx
+  8006ef:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006f5:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8006fa:	eb 33                	jmp    80072f <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8006fc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006ff:	c1 e3 08             	shl    $0x8,%ebx
+  800702:	83 ec 08             	sub    $0x8,%esp
+  800705:	ff 75 0c             	push   0xc(%ebp)
+  800708:	89 d8                	mov    %ebx,%eax
+  80070a:	83 c8 30             	or     $0x30,%eax
+  80070d:	50                   	push   %eax
+  80070e:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800710:	83 c4 08             	add    $0x8,%esp
+  800713:	ff 75 0c             	push   0xc(%ebp)
+  800716:	83 cb 78             	or     $0x78,%ebx
+  800719:	53                   	push   %ebx
+  80071a:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800721:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80072a:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  80072f:	ff 75 e4             	push   -0x1c(%ebp)
+  800732:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  800736:	52                   	push   %edx
+  800737:	ff 75 e0             	push   -0x20(%ebp)
+  80073a:	50                   	push   %eax
+  80073b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80073e:	89 f8                	mov    %edi,%eax
+  800740:	e8 f7 fa ff ff       	call   80023c <printnum>
+			break;
+  800745:	83 c4 10             	add    $0x10,%esp
+  800748:	e9 e7 fb ff ff       	jmp    800334 <vprintfmt+0x2e>
+	if (lflag >= 2)
+  80074d:	83 f9 01             	cmp    $0x1,%ecx
+  800750:	7f 16                	jg     800768 <vprintfmt+0x462>
+	else if (lflag)
+  800752:	85 c9                	test   %ecx,%ecx
+  800754:	74 24                	je     80077a <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  800756:	8b 45 14             	mov    0x14(%ebp),%eax
+  800759:	8b 08                	mov    (%eax),%ecx
+  80075b:	8d 40 04             	lea    0x4(%eax),%eax
+  80075e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800761:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  800766:	eb c7                	jmp    80072f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 08                	mov    (%eax),%ecx
+  80076d:	8d 40 08             	lea    0x8(%eax),%eax
+  800770:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800773:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  800778:	eb b5                	jmp    80072f <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 08                	mov    (%eax),%ecx
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800785:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  80078a:	eb a3                	jmp    80072f <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  80078c:	83 ec 08             	sub    $0x8,%esp
+  80078f:	ff 75 0c             	push   0xc(%ebp)
+  800792:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800795:	c1 e0 08             	shl    $0x8,%eax
+  800798:	83 c8 25             	or     $0x25,%eax
+  80079b:	50                   	push   %eax
+  80079c:	ff d7                	call   *%edi
+			break;
+  80079e:	83 c4 10             	add    $0x10,%esp
+  8007a1:	e9 8e fb ff ff       	jmp    800334 <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  8007a6:	83 ec 08             	sub    $0x8,%esp
+  8007a9:	ff 75 0c             	push   0xc(%ebp)
+  8007ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007af:	c1 e0 08             	shl    $0x8,%eax
+  8007b2:	83 c8 25             	or     $0x25,%eax
+  8007b5:	50                   	push   %eax
+  8007b6:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007b8:	83 c4 10             	add    $0x10,%esp
+  8007bb:	89 de                	mov    %ebx,%esi
+  8007bd:	eb 03                	jmp    8007c2 <vprintfmt+0x4bc>
+  8007bf:	83 ee 01             	sub    $0x1,%esi
+  8007c2:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007c6:	75 f7                	jne    8007bf <vprintfmt+0x4b9>
+  8007c8:	e9 67 fb ff ff       	jmp    800334 <vprintfmt+0x2e>
+
+008007cd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007cd:	55                   	push   %ebp
+  8007ce:	89 e5                	mov    %esp,%ebp
+  8007d0:	83 ec 18             	sub    $0x18,%esp
+  8007d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8007d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007dc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007e0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007e3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8007ea:	85 c0                	test   %eax,%eax
+  8007ec:	74 26                	je     800814 <vsnprintf+0x47>
+  8007ee:	85 d2                	test   %edx,%edx
+  8007f0:	7e 22                	jle    800814 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007f2:	ff 75 14             	push   0x14(%ebp)
+  8007f5:	ff 75 10             	push   0x10(%ebp)
+  8007f8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007fb:	50                   	push   %eax
+  8007fc:	68 cc 02 80 00       	push   $0x8002cc
+  800801:	e8 00 fb ff ff       	call   800306 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800806:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800809:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80080c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80080f:	83 c4 10             	add    $0x10,%esp
+}
+  800812:	c9                   	leave
+  800813:	c3                   	ret
+		return -E_INVAL;
+  800814:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800819:	eb f7                	jmp    800812 <vsnprintf+0x45>
+
+0080081b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800821:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800824:	50                   	push   %eax
+  800825:	ff 75 10             	push   0x10(%ebp)
+  800828:	ff 75 0c             	push   0xc(%ebp)
+  80082b:	ff 75 08             	push   0x8(%ebp)
+  80082e:	e8 9a ff ff ff       	call   8007cd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800833:	c9                   	leave
+  800834:	c3                   	ret
+
+00800835 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80083b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800840:	eb 03                	jmp    800845 <strlen+0x10>
+		n++;
+  800842:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800845:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800849:	75 f7                	jne    800842 <strlen+0xd>
+	return n;
+}
+  80084b:	5d                   	pop    %ebp
+  80084c:	c3                   	ret
+
+0080084d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80084d:	55                   	push   %ebp
+  80084e:	89 e5                	mov    %esp,%ebp
+  800850:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800853:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085b:	eb 03                	jmp    800860 <strnlen+0x13>
+		n++;
+  80085d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800860:	39 d0                	cmp    %edx,%eax
+  800862:	74 08                	je     80086c <strnlen+0x1f>
+  800864:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800868:	75 f3                	jne    80085d <strnlen+0x10>
+  80086a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80086c:	89 d0                	mov    %edx,%eax
+  80086e:	5d                   	pop    %ebp
+  80086f:	c3                   	ret
+
+00800870 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800870:	55                   	push   %ebp
+  800871:	89 e5                	mov    %esp,%ebp
+  800873:	53                   	push   %ebx
+  800874:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800877:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80087a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800883:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800886:	83 c0 01             	add    $0x1,%eax
+  800889:	84 d2                	test   %dl,%dl
+  80088b:	75 f2                	jne    80087f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80088d:	89 c8                	mov    %ecx,%eax
+  80088f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800892:	c9                   	leave
+  800893:	c3                   	ret
+
+00800894 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800894:	55                   	push   %ebp
+  800895:	89 e5                	mov    %esp,%ebp
+  800897:	53                   	push   %ebx
+  800898:	83 ec 10             	sub    $0x10,%esp
+  80089b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80089e:	53                   	push   %ebx
+  80089f:	e8 91 ff ff ff       	call   800835 <strlen>
+  8008a4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008a7:	ff 75 0c             	push   0xc(%ebp)
+  8008aa:	01 d8                	add    %ebx,%eax
+  8008ac:	50                   	push   %eax
+  8008ad:	e8 be ff ff ff       	call   800870 <strcpy>
+	return dst;
+}
+  8008b2:	89 d8                	mov    %ebx,%eax
+  8008b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b7:	c9                   	leave
+  8008b8:	c3                   	ret
+
+008008b9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8008b9:	55                   	push   %ebp
+  8008ba:	89 e5                	mov    %esp,%ebp
+  8008bc:	56                   	push   %esi
+  8008bd:	53                   	push   %ebx
+  8008be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8008c4:	89 f3                	mov    %esi,%ebx
+  8008c6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008c9:	89 f0                	mov    %esi,%eax
+  8008cb:	eb 0f                	jmp    8008dc <strncpy+0x23>
+		*dst++ = *src;
+  8008cd:	83 c0 01             	add    $0x1,%eax
+  8008d0:	0f b6 0a             	movzbl (%edx),%ecx
+  8008d3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8008d6:	80 f9 01             	cmp    $0x1,%cl
+  8008d9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8008dc:	39 d8                	cmp    %ebx,%eax
+  8008de:	75 ed                	jne    8008cd <strncpy+0x14>
+	}
+	return ret;
+}
+  8008e0:	89 f0                	mov    %esi,%eax
+  8008e2:	5b                   	pop    %ebx
+  8008e3:	5e                   	pop    %esi
+  8008e4:	5d                   	pop    %ebp
+  8008e5:	c3                   	ret
+
+008008e6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008e6:	55                   	push   %ebp
+  8008e7:	89 e5                	mov    %esp,%ebp
+  8008e9:	56                   	push   %esi
+  8008ea:	53                   	push   %ebx
+  8008eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008f4:	89 f0                	mov    %esi,%eax
+  8008f6:	85 d2                	test   %edx,%edx
+  8008f8:	74 21                	je     80091b <strlcpy+0x35>
+  8008fa:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008fe:	89 f2                	mov    %esi,%edx
+  800900:	eb 09                	jmp    80090b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800902:	83 c1 01             	add    $0x1,%ecx
+  800905:	83 c2 01             	add    $0x1,%edx
+  800908:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80090b:	39 c2                	cmp    %eax,%edx
+  80090d:	74 09                	je     800918 <strlcpy+0x32>
+  80090f:	0f b6 19             	movzbl (%ecx),%ebx
+  800912:	84 db                	test   %bl,%bl
+  800914:	75 ec                	jne    800902 <strlcpy+0x1c>
+  800916:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800918:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80091b:	29 f0                	sub    %esi,%eax
+}
+  80091d:	5b                   	pop    %ebx
+  80091e:	5e                   	pop    %esi
+  80091f:	5d                   	pop    %ebp
+  800920:	c3                   	ret
+
+00800921 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800921:	55                   	push   %ebp
+  800922:	89 e5                	mov    %esp,%ebp
+  800924:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800927:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80092a:	eb 06                	jmp    800932 <strcmp+0x11>
+		p++, q++;
+  80092c:	83 c1 01             	add    $0x1,%ecx
+  80092f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800932:	0f b6 01             	movzbl (%ecx),%eax
+  800935:	84 c0                	test   %al,%al
+  800937:	74 04                	je     80093d <strcmp+0x1c>
+  800939:	3a 02                	cmp    (%edx),%al
+  80093b:	74 ef                	je     80092c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80093d:	0f b6 c0             	movzbl %al,%eax
+  800940:	0f b6 12             	movzbl (%edx),%edx
+  800943:	29 d0                	sub    %edx,%eax
+}
+  800945:	5d                   	pop    %ebp
+  800946:	c3                   	ret
+
+00800947 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	53                   	push   %ebx
+  80094b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800951:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800954:	eb 09                	jmp    80095f <strncmp+0x18>
+		n--, p++, q++;
+  800956:	83 ea 01             	sub    $0x1,%edx
+  800959:	83 c0 01             	add    $0x1,%eax
+  80095c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80095f:	85 d2                	test   %edx,%edx
+  800961:	74 18                	je     80097b <strncmp+0x34>
+  800963:	0f b6 18             	movzbl (%eax),%ebx
+  800966:	84 db                	test   %bl,%bl
+  800968:	74 04                	je     80096e <strncmp+0x27>
+  80096a:	3a 19                	cmp    (%ecx),%bl
+  80096c:	74 e8                	je     800956 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80096e:	0f b6 00             	movzbl (%eax),%eax
+  800971:	0f b6 11             	movzbl (%ecx),%edx
+  800974:	29 d0                	sub    %edx,%eax
+}
+  800976:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800979:	c9                   	leave
+  80097a:	c3                   	ret
+		return 0;
+  80097b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800980:	eb f4                	jmp    800976 <strncmp+0x2f>
+
+00800982 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800982:	55                   	push   %ebp
+  800983:	89 e5                	mov    %esp,%ebp
+  800985:	8b 45 08             	mov    0x8(%ebp),%eax
+  800988:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80098c:	eb 03                	jmp    800991 <strchr+0xf>
+  80098e:	83 c0 01             	add    $0x1,%eax
+  800991:	0f b6 10             	movzbl (%eax),%edx
+  800994:	84 d2                	test   %dl,%dl
+  800996:	74 06                	je     80099e <strchr+0x1c>
+		if (*s == c)
+  800998:	38 ca                	cmp    %cl,%dl
+  80099a:	75 f2                	jne    80098e <strchr+0xc>
+  80099c:	eb 05                	jmp    8009a3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80099e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009a3:	5d                   	pop    %ebp
+  8009a4:	c3                   	ret
+
+008009a5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ab:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009af:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009b2:	38 ca                	cmp    %cl,%dl
+  8009b4:	74 09                	je     8009bf <strfind+0x1a>
+  8009b6:	84 d2                	test   %dl,%dl
+  8009b8:	74 05                	je     8009bf <strfind+0x1a>
+	for (; *s; s++)
+  8009ba:	83 c0 01             	add    $0x1,%eax
+  8009bd:	eb f0                	jmp    8009af <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8009bf:	5d                   	pop    %ebp
+  8009c0:	c3                   	ret
+
+008009c1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	57                   	push   %edi
+  8009c5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009c8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8009cb:	85 c9                	test   %ecx,%ecx
+  8009cd:	74 20                	je     8009ef <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8009cf:	89 f8                	mov    %edi,%eax
+  8009d1:	09 c8                	or     %ecx,%eax
+  8009d3:	a8 03                	test   $0x3,%al
+  8009d5:	75 12                	jne    8009e9 <memset+0x28>
+		c &= 0xFF;
+  8009d7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009db:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8009e1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8009e4:	fc                   	cld
+  8009e5:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009e7:	eb 06                	jmp    8009ef <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8009e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009ec:	fc                   	cld
+  8009ed:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009ef:	89 f8                	mov    %edi,%eax
+  8009f1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009f4:	c9                   	leave
+  8009f5:	c3                   	ret
+
+008009f6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009f6:	55                   	push   %ebp
+  8009f7:	89 e5                	mov    %esp,%ebp
+  8009f9:	57                   	push   %edi
+  8009fa:	56                   	push   %esi
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a01:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a04:	39 c6                	cmp    %eax,%esi
+  800a06:	73 32                	jae    800a3a <memmove+0x44>
+  800a08:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a0b:	39 d0                	cmp    %edx,%eax
+  800a0d:	73 2b                	jae    800a3a <memmove+0x44>
+		s += n;
+		d += n;
+  800a0f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a12:	89 d6                	mov    %edx,%esi
+  800a14:	09 fe                	or     %edi,%esi
+  800a16:	09 ce                	or     %ecx,%esi
+  800a18:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a1e:	75 0e                	jne    800a2e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a20:	83 ef 04             	sub    $0x4,%edi
+  800a23:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a26:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a29:	fd                   	std
+  800a2a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a2c:	eb 09                	jmp    800a37 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a2e:	83 ef 01             	sub    $0x1,%edi
+  800a31:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a34:	fd                   	std
+  800a35:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a37:	fc                   	cld
+  800a38:	eb 1a                	jmp    800a54 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a3a:	89 f2                	mov    %esi,%edx
+  800a3c:	09 c2                	or     %eax,%edx
+  800a3e:	09 ca                	or     %ecx,%edx
+  800a40:	f6 c2 03             	test   $0x3,%dl
+  800a43:	75 0a                	jne    800a4f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a45:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a48:	89 c7                	mov    %eax,%edi
+  800a4a:	fc                   	cld
+  800a4b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a4d:	eb 05                	jmp    800a54 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a4f:	89 c7                	mov    %eax,%edi
+  800a51:	fc                   	cld
+  800a52:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a54:	5e                   	pop    %esi
+  800a55:	5f                   	pop    %edi
+  800a56:	5d                   	pop    %ebp
+  800a57:	c3                   	ret
+
+00800a58 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a5e:	ff 75 10             	push   0x10(%ebp)
+  800a61:	ff 75 0c             	push   0xc(%ebp)
+  800a64:	ff 75 08             	push   0x8(%ebp)
+  800a67:	e8 8a ff ff ff       	call   8009f6 <memmove>
+}
+  800a6c:	c9                   	leave
+  800a6d:	c3                   	ret
+
+00800a6e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a6e:	55                   	push   %ebp
+  800a6f:	89 e5                	mov    %esp,%ebp
+  800a71:	56                   	push   %esi
+  800a72:	53                   	push   %ebx
+  800a73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a76:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a79:	89 c6                	mov    %eax,%esi
+  800a7b:	03 75 10             	add    0x10(%ebp),%esi
+  800a7e:	eb 06                	jmp    800a86 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a80:	83 c0 01             	add    $0x1,%eax
+  800a83:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a86:	39 f0                	cmp    %esi,%eax
+  800a88:	74 14                	je     800a9e <memcmp+0x30>
+		if (*s1 != *s2)
+  800a8a:	0f b6 08             	movzbl (%eax),%ecx
+  800a8d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a90:	38 d9                	cmp    %bl,%cl
+  800a92:	74 ec                	je     800a80 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a94:	0f b6 c1             	movzbl %cl,%eax
+  800a97:	0f b6 db             	movzbl %bl,%ebx
+  800a9a:	29 d8                	sub    %ebx,%eax
+  800a9c:	eb 05                	jmp    800aa3 <memcmp+0x35>
+	}
+
+	return 0;
+  800a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aa3:	5b                   	pop    %ebx
+  800aa4:	5e                   	pop    %esi
+  800aa5:	5d                   	pop    %ebp
+  800aa6:	c3                   	ret
+
+00800aa7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800aa7:	55                   	push   %ebp
+  800aa8:	89 e5                	mov    %esp,%ebp
+  800aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ab0:	89 c2                	mov    %eax,%edx
+  800ab2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ab5:	eb 03                	jmp    800aba <memfind+0x13>
+  800ab7:	83 c0 01             	add    $0x1,%eax
+  800aba:	39 d0                	cmp    %edx,%eax
+  800abc:	73 04                	jae    800ac2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800abe:	38 08                	cmp    %cl,(%eax)
+  800ac0:	75 f5                	jne    800ab7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ac2:	5d                   	pop    %ebp
+  800ac3:	c3                   	ret
+
+00800ac4 <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	57                   	push   %edi
+  800ac8:	56                   	push   %esi
+  800ac9:	53                   	push   %ebx
+  800aca:	83 ec 1c             	sub    $0x1c,%esp
+  800acd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ad0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ad3:	eb 03                	jmp    800ad8 <strtol+0x14>
+		s++;
+  800ad5:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800ad8:	0f b6 06             	movzbl (%esi),%eax
+  800adb:	3c 20                	cmp    $0x20,%al
+  800add:	74 f6                	je     800ad5 <strtol+0x11>
+  800adf:	3c 09                	cmp    $0x9,%al
+  800ae1:	74 f2                	je     800ad5 <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ae3:	3c 2b                	cmp    $0x2b,%al
+  800ae5:	74 43                	je     800b2a <strtol+0x66>
+	int neg = 0;
+  800ae7:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800aec:	3c 2d                	cmp    $0x2d,%al
+  800aee:	74 44                	je     800b34 <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800af0:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800af6:	75 0f                	jne    800b07 <strtol+0x43>
+  800af8:	80 3e 30             	cmpb   $0x30,(%esi)
+  800afb:	74 41                	je     800b3e <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800afd:	85 ff                	test   %edi,%edi
+  800aff:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b04:	0f 44 f8             	cmove  %eax,%edi
+  800b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0c:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b11:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b14:	89 fb                	mov    %edi,%ebx
+  800b16:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b19:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b1c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b1f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b22:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b25:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b28:	eb 67                	jmp    800b91 <strtol+0xcd>
+		s++;
+  800b2a:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800b2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b32:	eb bc                	jmp    800af0 <strtol+0x2c>
+		s++, neg = 1;
+  800b34:	83 c6 01             	add    $0x1,%esi
+  800b37:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800b3c:	eb b2                	jmp    800af0 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3e:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800b42:	74 0e                	je     800b52 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800b44:	85 ff                	test   %edi,%edi
+  800b46:	75 bf                	jne    800b07 <strtol+0x43>
+		s++, base = 8;
+  800b48:	83 c6 01             	add    $0x1,%esi
+  800b4b:	bf 08 00 00 00       	mov    $0x8,%edi
+  800b50:	eb b5                	jmp    800b07 <strtol+0x43>
+		s += 2, base = 16;
+  800b52:	83 c6 02             	add    $0x2,%esi
+  800b55:	bf 10 00 00 00       	mov    $0x10,%edi
+  800b5a:	eb ab                	jmp    800b07 <strtol+0x43>
+			dig = *s - '0';
+  800b5c:	0f be c9             	movsbl %cl,%ecx
+  800b5f:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800b62:	39 f9                	cmp    %edi,%ecx
+  800b64:	7d 59                	jge    800bbf <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800b66:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800b6a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b6d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b70:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800b73:	0f af d8             	imul   %eax,%ebx
+  800b76:	0f af d7             	imul   %edi,%edx
+  800b79:	01 d3                	add    %edx,%ebx
+  800b7b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800b7e:	f7 e7                	mul    %edi
+  800b80:	01 da                	add    %ebx,%edx
+  800b82:	89 cb                	mov    %ecx,%ebx
+  800b84:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b87:	01 c8                	add    %ecx,%eax
+  800b89:	11 da                	adc    %ebx,%edx
+  800b8b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b8e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800b91:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b94:	0f b6 08             	movzbl (%eax),%ecx
+  800b97:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800b9a:	80 fb 09             	cmp    $0x9,%bl
+  800b9d:	76 bd                	jbe    800b5c <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800b9f:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800ba2:	80 fb 19             	cmp    $0x19,%bl
+  800ba5:	77 08                	ja     800baf <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800ba7:	0f be c9             	movsbl %cl,%ecx
+  800baa:	83 e9 57             	sub    $0x57,%ecx
+  800bad:	eb b3                	jmp    800b62 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800baf:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800bb2:	80 fb 19             	cmp    $0x19,%bl
+  800bb5:	77 08                	ja     800bbf <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800bb7:	0f be c9             	movsbl %cl,%ecx
+  800bba:	83 e9 37             	sub    $0x37,%ecx
+  800bbd:	eb a3                	jmp    800b62 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bbf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800bc2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bc5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800bc8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bcb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bcf:	74 05                	je     800bd6 <strtol+0x112>
+		*endptr = (char *) s;
+  800bd1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800bd4:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800bd6:	85 c9                	test   %ecx,%ecx
+  800bd8:	74 07                	je     800be1 <strtol+0x11d>
+  800bda:	f7 d8                	neg    %eax
+  800bdc:	83 d2 00             	adc    $0x0,%edx
+  800bdf:	f7 da                	neg    %edx
+}
+  800be1:	83 c4 1c             	add    $0x1c,%esp
+  800be4:	5b                   	pop    %ebx
+  800be5:	5e                   	pop    %esi
+  800be6:	5f                   	pop    %edi
+  800be7:	5d                   	pop    %ebp
+  800be8:	c3                   	ret
+
+00800be9 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800be9:	55                   	push   %ebp
+  800bea:	89 e5                	mov    %esp,%ebp
+  800bec:	57                   	push   %edi
+  800bed:	56                   	push   %esi
+  800bee:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800bef:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800bf6:	74 18                	je     800c10 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c03:	89 c3                	mov    %eax,%ebx
+  800c05:	89 c7                	mov    %eax,%edi
+  800c07:	89 c6                	mov    %eax,%esi
+  800c09:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c0b:	5b                   	pop    %ebx
+  800c0c:	5e                   	pop    %esi
+  800c0d:	5f                   	pop    %edi
+  800c0e:	5d                   	pop    %ebp
+  800c0f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c1b:	89 c3                	mov    %eax,%ebx
+  800c1d:	89 c7                	mov    %eax,%edi
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	8d 35 2a 0c 80 00    	lea    0x800c2a,%esi
+  800c28:	0f 34                	sysenter
+  800c2a:	5d                   	pop    %ebp
+		goto out;
+  800c2b:	eb de                	jmp    800c0b <sys_cputs+0x22>
+
+00800c2d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	57                   	push   %edi
+  800c31:	56                   	push   %esi
+  800c32:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c33:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c3a:	74 19                	je     800c55 <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800c3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c41:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c46:	89 d1                	mov    %edx,%ecx
+  800c48:	89 d3                	mov    %edx,%ebx
+  800c4a:	89 d7                	mov    %edx,%edi
+  800c4c:	89 d6                	mov    %edx,%esi
+  800c4e:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c50:	5b                   	pop    %ebx
+  800c51:	5e                   	pop    %esi
+  800c52:	5f                   	pop    %edi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c5f:	89 d1                	mov    %edx,%ecx
+  800c61:	89 d3                	mov    %edx,%ebx
+  800c63:	89 d7                	mov    %edx,%edi
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	8d 35 70 0c 80 00    	lea    0x800c70,%esi
+  800c6e:	0f 34                	sysenter
+  800c70:	5d                   	pop    %ebp
+		goto out;
+  800c71:	eb dd                	jmp    800c50 <sys_cgetc+0x23>
+
+00800c73 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	57                   	push   %edi
+  800c77:	56                   	push   %esi
+  800c78:	53                   	push   %ebx
+  800c79:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800c7c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c83:	74 21                	je     800ca6 <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800c85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c92:	89 cb                	mov    %ecx,%ebx
+  800c94:	89 cf                	mov    %ecx,%edi
+  800c96:	89 ce                	mov    %ecx,%esi
+  800c98:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c9a:	85 c0                	test   %eax,%eax
+  800c9c:	7f 27                	jg     800cc5 <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca1:	5b                   	pop    %ebx
+  800ca2:	5e                   	pop    %esi
+  800ca3:	5f                   	pop    %edi
+  800ca4:	5d                   	pop    %ebp
+  800ca5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ca6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cae:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cb3:	89 cb                	mov    %ecx,%ebx
+  800cb5:	89 cf                	mov    %ecx,%edi
+  800cb7:	55                   	push   %ebp
+  800cb8:	89 e5                	mov    %esp,%ebp
+  800cba:	8d 35 c2 0c 80 00    	lea    0x800cc2,%esi
+  800cc0:	0f 34                	sysenter
+  800cc2:	5d                   	pop    %ebp
+		goto out;
+  800cc3:	eb d5                	jmp    800c9a <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc5:	83 ec 0c             	sub    $0xc,%esp
+  800cc8:	50                   	push   %eax
+  800cc9:	6a 03                	push   $0x3
+  800ccb:	68 4b 30 80 00       	push   $0x80304b
+  800cd0:	6a 3f                	push   $0x3f
+  800cd2:	68 68 30 80 00       	push   $0x803068
+  800cd7:	e8 71 f4 ff ff       	call   80014d <_panic>
+
+00800cdc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	57                   	push   %edi
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ce2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ce9:	74 19                	je     800d04 <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800ceb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf0:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cf5:	89 d1                	mov    %edx,%ecx
+  800cf7:	89 d3                	mov    %edx,%ebx
+  800cf9:	89 d7                	mov    %edx,%edi
+  800cfb:	89 d6                	mov    %edx,%esi
+  800cfd:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d09:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d0e:	89 d1                	mov    %edx,%ecx
+  800d10:	89 d3                	mov    %edx,%ebx
+  800d12:	89 d7                	mov    %edx,%edi
+  800d14:	55                   	push   %ebp
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	8d 35 1f 0d 80 00    	lea    0x800d1f,%esi
+  800d1d:	0f 34                	sysenter
+  800d1f:	5d                   	pop    %ebp
+		goto out;
+  800d20:	eb dd                	jmp    800cff <sys_getenvid+0x23>
+
+00800d22 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	57                   	push   %edi
+  800d26:	56                   	push   %esi
+  800d27:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d28:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d2f:	74 19                	je     800d4a <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d36:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d3b:	89 d1                	mov    %edx,%ecx
+  800d3d:	89 d3                	mov    %edx,%ebx
+  800d3f:	89 d7                	mov    %edx,%edi
+  800d41:	89 d6                	mov    %edx,%esi
+  800d43:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d54:	89 d1                	mov    %edx,%ecx
+  800d56:	89 d3                	mov    %edx,%ebx
+  800d58:	89 d7                	mov    %edx,%edi
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	8d 35 65 0d 80 00    	lea    0x800d65,%esi
+  800d63:	0f 34                	sysenter
+  800d65:	5d                   	pop    %ebp
+		goto out;
+  800d66:	eb dd                	jmp    800d45 <sys_yield+0x23>
+
+00800d68 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+  800d6e:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800d71:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d78:	74 23                	je     800d9d <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800d7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8d:	89 f7                	mov    %esi,%edi
+  800d8f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d91:	85 c0                	test   %eax,%eax
+  800d93:	7f 29                	jg     800dbe <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d98:	5b                   	pop    %ebx
+  800d99:	5e                   	pop    %esi
+  800d9a:	5f                   	pop    %edi
+  800d9b:	5d                   	pop    %ebp
+  800d9c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	8d 35 bb 0d 80 00    	lea    0x800dbb,%esi
+  800db9:	0f 34                	sysenter
+  800dbb:	5d                   	pop    %ebp
+		goto out;
+  800dbc:	eb d3                	jmp    800d91 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+  800dc1:	50                   	push   %eax
+  800dc2:	6a 04                	push   $0x4
+  800dc4:	68 4b 30 80 00       	push   $0x80304b
+  800dc9:	6a 3f                	push   $0x3f
+  800dcb:	68 68 30 80 00       	push   $0x803068
+  800dd0:	e8 78 f3 ff ff       	call   80014d <_panic>
+
+00800dd5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  800dde:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800de1:	85 f6                	test   %esi,%esi
+  800de3:	75 09                	jne    800dee <sys_page_map+0x19>
+  800de5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dec:	74 1f                	je     800e0d <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800dee:	b8 05 00 00 00       	mov    $0x5,%eax
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	7f 27                	jg     800e2c <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5f                   	pop    %edi
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e13:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e1e:	55                   	push   %ebp
+  800e1f:	89 e5                	mov    %esp,%ebp
+  800e21:	8d 35 29 0e 80 00    	lea    0x800e29,%esi
+  800e27:	0f 34                	sysenter
+  800e29:	5d                   	pop    %ebp
+		goto out;
+  800e2a:	eb d5                	jmp    800e01 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2c:	83 ec 0c             	sub    $0xc,%esp
+  800e2f:	50                   	push   %eax
+  800e30:	6a 05                	push   $0x5
+  800e32:	68 4b 30 80 00       	push   $0x80304b
+  800e37:	6a 3f                	push   $0x3f
+  800e39:	68 68 30 80 00       	push   $0x803068
+  800e3e:	e8 0a f3 ff ff       	call   80014d <_panic>
+
+00800e43 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e43:	55                   	push   %ebp
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	57                   	push   %edi
+  800e47:	56                   	push   %esi
+  800e48:	53                   	push   %ebx
+  800e49:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e4c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e53:	74 22                	je     800e77 <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800e55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e65:	89 df                	mov    %ebx,%edi
+  800e67:	89 de                	mov    %ebx,%esi
+  800e69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e6b:	85 c0                	test   %eax,%eax
+  800e6d:	7f 28                	jg     800e97 <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e72:	5b                   	pop    %ebx
+  800e73:	5e                   	pop    %esi
+  800e74:	5f                   	pop    %edi
+  800e75:	5d                   	pop    %ebp
+  800e76:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e82:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e87:	89 df                	mov    %ebx,%edi
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	8d 35 94 0e 80 00    	lea    0x800e94,%esi
+  800e92:	0f 34                	sysenter
+  800e94:	5d                   	pop    %ebp
+		goto out;
+  800e95:	eb d4                	jmp    800e6b <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e97:	83 ec 0c             	sub    $0xc,%esp
+  800e9a:	50                   	push   %eax
+  800e9b:	6a 06                	push   $0x6
+  800e9d:	68 4b 30 80 00       	push   $0x80304b
+  800ea2:	6a 3f                	push   $0x3f
+  800ea4:	68 68 30 80 00       	push   $0x803068
+  800ea9:	e8 9f f2 ff ff       	call   80014d <_panic>
+
+00800eae <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	57                   	push   %edi
+  800eb2:	56                   	push   %esi
+  800eb3:	53                   	push   %ebx
+  800eb4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800eb7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ebe:	74 22                	je     800ee2 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800ec0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed0:	89 df                	mov    %ebx,%edi
+  800ed2:	89 de                	mov    %ebx,%esi
+  800ed4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed6:	85 c0                	test   %eax,%eax
+  800ed8:	7f 28                	jg     800f02 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800eda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edd:	5b                   	pop    %ebx
+  800ede:	5e                   	pop    %esi
+  800edf:	5f                   	pop    %edi
+  800ee0:	5d                   	pop    %ebp
+  800ee1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ee2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ef2:	89 df                	mov    %ebx,%edi
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	8d 35 ff 0e 80 00    	lea    0x800eff,%esi
+  800efd:	0f 34                	sysenter
+  800eff:	5d                   	pop    %ebp
+		goto out;
+  800f00:	eb d4                	jmp    800ed6 <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f02:	83 ec 0c             	sub    $0xc,%esp
+  800f05:	50                   	push   %eax
+  800f06:	6a 08                	push   $0x8
+  800f08:	68 4b 30 80 00       	push   $0x80304b
+  800f0d:	6a 3f                	push   $0x3f
+  800f0f:	68 68 30 80 00       	push   $0x803068
+  800f14:	e8 34 f2 ff ff       	call   80014d <_panic>
+
+00800f19 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f22:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f29:	74 22                	je     800f4d <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800f2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f30:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	89 df                	mov    %ebx,%edi
+  800f3d:	89 de                	mov    %ebx,%esi
+  800f3f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f41:	85 c0                	test   %eax,%eax
+  800f43:	7f 28                	jg     800f6d <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f48:	5b                   	pop    %ebx
+  800f49:	5e                   	pop    %esi
+  800f4a:	5f                   	pop    %edi
+  800f4b:	5d                   	pop    %ebp
+  800f4c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f58:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f5d:	89 df                	mov    %ebx,%edi
+  800f5f:	55                   	push   %ebp
+  800f60:	89 e5                	mov    %esp,%ebp
+  800f62:	8d 35 6a 0f 80 00    	lea    0x800f6a,%esi
+  800f68:	0f 34                	sysenter
+  800f6a:	5d                   	pop    %ebp
+		goto out;
+  800f6b:	eb d4                	jmp    800f41 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+  800f70:	50                   	push   %eax
+  800f71:	6a 09                	push   $0x9
+  800f73:	68 4b 30 80 00       	push   $0x80304b
+  800f78:	6a 3f                	push   $0x3f
+  800f7a:	68 68 30 80 00       	push   $0x803068
+  800f7f:	e8 c9 f1 ff ff       	call   80014d <_panic>
+
+00800f84 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	56                   	push   %esi
+  800f89:	53                   	push   %ebx
+  800f8a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f8d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f94:	74 22                	je     800fb8 <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  800f96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa6:	89 df                	mov    %ebx,%edi
+  800fa8:	89 de                	mov    %ebx,%esi
+  800faa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	7f 28                	jg     800fd8 <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc8:	89 df                	mov    %ebx,%edi
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	8d 35 d5 0f 80 00    	lea    0x800fd5,%esi
+  800fd3:	0f 34                	sysenter
+  800fd5:	5d                   	pop    %ebp
+		goto out;
+  800fd6:	eb d4                	jmp    800fac <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd8:	83 ec 0c             	sub    $0xc,%esp
+  800fdb:	50                   	push   %eax
+  800fdc:	6a 0a                	push   $0xa
+  800fde:	68 4b 30 80 00       	push   $0x80304b
+  800fe3:	6a 3f                	push   $0x3f
+  800fe5:	68 68 30 80 00       	push   $0x803068
+  800fea:	e8 5e f1 ff ff       	call   80014d <_panic>
+
+00800fef <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  800fef:	55                   	push   %ebp
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	57                   	push   %edi
+  800ff3:	56                   	push   %esi
+  800ff4:	53                   	push   %ebx
+  800ff5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ff8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800fff:	74 22                	je     801023 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801006:	b8 17 00 00 00       	mov    $0x17,%eax
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	89 df                	mov    %ebx,%edi
+  801013:	89 de                	mov    %ebx,%esi
+  801015:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801017:	85 c0                	test   %eax,%eax
+  801019:	7f 28                	jg     801043 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  80101b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101e:	5b                   	pop    %ebx
+  80101f:	5e                   	pop    %esi
+  801020:	5f                   	pop    %edi
+  801021:	5d                   	pop    %ebp
+  801022:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801023:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801028:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102e:	b8 17 00 00 00       	mov    $0x17,%eax
+  801033:	89 df                	mov    %ebx,%edi
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	8d 35 40 10 80 00    	lea    0x801040,%esi
+  80103e:	0f 34                	sysenter
+  801040:	5d                   	pop    %ebp
+		goto out;
+  801041:	eb d4                	jmp    801017 <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801043:	83 ec 0c             	sub    $0xc,%esp
+  801046:	50                   	push   %eax
+  801047:	6a 17                	push   $0x17
+  801049:	68 4b 30 80 00       	push   $0x80304b
+  80104e:	6a 3f                	push   $0x3f
+  801050:	68 68 30 80 00       	push   $0x803068
+  801055:	e8 f3 f0 ff ff       	call   80014d <_panic>
+
+0080105a <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	57                   	push   %edi
+  80105e:	56                   	push   %esi
+  80105f:	53                   	push   %ebx
+  801060:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801063:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80106a:	74 22                	je     80108e <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  80106c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801071:	b8 18 00 00 00       	mov    $0x18,%eax
+  801076:	8b 55 08             	mov    0x8(%ebp),%edx
+  801079:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107c:	89 df                	mov    %ebx,%edi
+  80107e:	89 de                	mov    %ebx,%esi
+  801080:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801082:	85 c0                	test   %eax,%eax
+  801084:	7f 28                	jg     8010ae <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  801086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80108e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801093:	8b 55 08             	mov    0x8(%ebp),%edx
+  801096:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801099:	b8 18 00 00 00       	mov    $0x18,%eax
+  80109e:	89 df                	mov    %ebx,%edi
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	8d 35 ab 10 80 00    	lea    0x8010ab,%esi
+  8010a9:	0f 34                	sysenter
+  8010ab:	5d                   	pop    %ebp
+		goto out;
+  8010ac:	eb d4                	jmp    801082 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ae:	83 ec 0c             	sub    $0xc,%esp
+  8010b1:	50                   	push   %eax
+  8010b2:	6a 18                	push   $0x18
+  8010b4:	68 4b 30 80 00       	push   $0x80304b
+  8010b9:	6a 3f                	push   $0x3f
+  8010bb:	68 68 30 80 00       	push   $0x803068
+  8010c0:	e8 88 f0 ff ff       	call   80014d <_panic>
+
+008010c5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	57                   	push   %edi
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8010cb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010d2:	74 1d                	je     8010f1 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  8010d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ea:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8010ec:	5b                   	pop    %ebx
+  8010ed:	5e                   	pop    %esi
+  8010ee:	5f                   	pop    %edi
+  8010ef:	5d                   	pop    %ebp
+  8010f0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	8d 35 0d 11 80 00    	lea    0x80110d,%esi
+  80110b:	0f 34                	sysenter
+  80110d:	5d                   	pop    %ebp
+		goto out;
+  80110e:	eb dc                	jmp    8010ec <sys_ipc_try_send+0x27>
+
+00801110 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801110:	55                   	push   %ebp
+  801111:	89 e5                	mov    %esp,%ebp
+  801113:	57                   	push   %edi
+  801114:	56                   	push   %esi
+  801115:	53                   	push   %ebx
+  801116:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801119:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801120:	74 21                	je     801143 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801122:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801127:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80112c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112f:	89 cb                	mov    %ecx,%ebx
+  801131:	89 cf                	mov    %ecx,%edi
+  801133:	89 ce                	mov    %ecx,%esi
+  801135:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801137:	85 c0                	test   %eax,%eax
+  801139:	7f 27                	jg     801162 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80113b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113e:	5b                   	pop    %ebx
+  80113f:	5e                   	pop    %esi
+  801140:	5f                   	pop    %edi
+  801141:	5d                   	pop    %ebp
+  801142:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801143:	8b 55 08             	mov    0x8(%ebp),%edx
+  801146:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80114b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801150:	89 cb                	mov    %ecx,%ebx
+  801152:	89 cf                	mov    %ecx,%edi
+  801154:	55                   	push   %ebp
+  801155:	89 e5                	mov    %esp,%ebp
+  801157:	8d 35 5f 11 80 00    	lea    0x80115f,%esi
+  80115d:	0f 34                	sysenter
+  80115f:	5d                   	pop    %ebp
+		goto out;
+  801160:	eb d5                	jmp    801137 <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801162:	83 ec 0c             	sub    $0xc,%esp
+  801165:	50                   	push   %eax
+  801166:	6a 0d                	push   $0xd
+  801168:	68 4b 30 80 00       	push   $0x80304b
+  80116d:	6a 3f                	push   $0x3f
+  80116f:	68 68 30 80 00       	push   $0x803068
+  801174:	e8 d4 ef ff ff       	call   80014d <_panic>
+
+00801179 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	57                   	push   %edi
+  80117d:	56                   	push   %esi
+  80117e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80117f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801186:	74 1b                	je     8011a3 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  801188:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801192:	8b 55 08             	mov    0x8(%ebp),%edx
+  801195:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801198:	89 df                	mov    %ebx,%edi
+  80119a:	89 de                	mov    %ebx,%esi
+  80119c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  80119e:	5b                   	pop    %ebx
+  80119f:	5e                   	pop    %esi
+  8011a0:	5f                   	pop    %edi
+  8011a1:	5d                   	pop    %ebp
+  8011a2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ae:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011b3:	89 df                	mov    %ebx,%edi
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	8d 35 c0 11 80 00    	lea    0x8011c0,%esi
+  8011be:	0f 34                	sysenter
+  8011c0:	5d                   	pop    %ebp
+		goto out;
+  8011c1:	eb db                	jmp    80119e <sys_ipc_recv_until+0x25>
+
+008011c3 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	57                   	push   %edi
+  8011c7:	56                   	push   %esi
+  8011c8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011c9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011d0:	74 19                	je     8011eb <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  8011d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011dc:	89 d1                	mov    %edx,%ecx
+  8011de:	89 d3                	mov    %edx,%ebx
+  8011e0:	89 d7                	mov    %edx,%edi
+  8011e2:	89 d6                	mov    %edx,%esi
+  8011e4:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5f                   	pop    %edi
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011f5:	89 d1                	mov    %edx,%ecx
+  8011f7:	89 d3                	mov    %edx,%ebx
+  8011f9:	89 d7                	mov    %edx,%edi
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	8d 35 06 12 80 00    	lea    0x801206,%esi
+  801204:	0f 34                	sysenter
+  801206:	5d                   	pop    %ebp
+		goto out;
+  801207:	eb dd                	jmp    8011e6 <sys_time_msec+0x23>
+
+00801209 <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  801209:	55                   	push   %ebp
+  80120a:	89 e5                	mov    %esp,%ebp
+  80120c:	57                   	push   %edi
+  80120d:	56                   	push   %esi
+  80120e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80120f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801216:	74 1a                	je     801232 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  801218:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80121d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801222:	8b 55 08             	mov    0x8(%ebp),%edx
+  801225:	89 cb                	mov    %ecx,%ebx
+  801227:	89 cf                	mov    %ecx,%edi
+  801229:	89 ce                	mov    %ecx,%esi
+  80122b:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  80122d:	5b                   	pop    %ebx
+  80122e:	5e                   	pop    %esi
+  80122f:	5f                   	pop    %edi
+  801230:	5d                   	pop    %ebp
+  801231:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801232:	8b 55 08             	mov    0x8(%ebp),%edx
+  801235:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80123a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80123f:	89 cb                	mov    %ecx,%ebx
+  801241:	89 cf                	mov    %ecx,%edi
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	8d 35 4e 12 80 00    	lea    0x80124e,%esi
+  80124c:	0f 34                	sysenter
+  80124e:	5d                   	pop    %ebp
+		goto out;
+  80124f:	eb dc                	jmp    80122d <sys_sleep_until+0x24>
+
+00801251 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	57                   	push   %edi
+  801255:	56                   	push   %esi
+  801256:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801257:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80125e:	74 1a                	je     80127a <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801265:	b8 11 00 00 00       	mov    $0x11,%eax
+  80126a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126d:	89 cb                	mov    %ecx,%ebx
+  80126f:	89 cf                	mov    %ecx,%edi
+  801271:	89 ce                	mov    %ecx,%esi
+  801273:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  801275:	5b                   	pop    %ebx
+  801276:	5e                   	pop    %esi
+  801277:	5f                   	pop    %edi
+  801278:	5d                   	pop    %ebp
+  801279:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80127a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801282:	b8 11 00 00 00       	mov    $0x11,%eax
+  801287:	89 cb                	mov    %ecx,%ebx
+  801289:	89 cf                	mov    %ecx,%edi
+  80128b:	55                   	push   %ebp
+  80128c:	89 e5                	mov    %esp,%ebp
+  80128e:	8d 35 96 12 80 00    	lea    0x801296,%esi
+  801294:	0f 34                	sysenter
+  801296:	5d                   	pop    %ebp
+		goto out;
+  801297:	eb dc                	jmp    801275 <sys_env_print_stats+0x24>
+
+00801299 <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  801299:	55                   	push   %ebp
+  80129a:	89 e5                	mov    %esp,%ebp
+  80129c:	57                   	push   %edi
+  80129d:	56                   	push   %esi
+  80129e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80129f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012a6:	74 1b                	je     8012c3 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  8012a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ad:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b8:	89 df                	mov    %ebx,%edi
+  8012ba:	89 de                	mov    %ebx,%esi
+  8012bc:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  8012be:	5b                   	pop    %ebx
+  8012bf:	5e                   	pop    %esi
+  8012c0:	5f                   	pop    %edi
+  8012c1:	5d                   	pop    %ebp
+  8012c2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ce:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012d3:	89 df                	mov    %ebx,%edi
+  8012d5:	55                   	push   %ebp
+  8012d6:	89 e5                	mov    %esp,%ebp
+  8012d8:	8d 35 e0 12 80 00    	lea    0x8012e0,%esi
+  8012de:	0f 34                	sysenter
+  8012e0:	5d                   	pop    %ebp
+		goto out;
+  8012e1:	eb db                	jmp    8012be <sys_perf+0x25>
+
+008012e3 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	57                   	push   %edi
+  8012e7:	56                   	push   %esi
+  8012e8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012e9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012f0:	74 19                	je     80130b <sys_fork+0x28>
+	asm volatile("int %1\n"
+  8012f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012fc:	89 d1                	mov    %edx,%ecx
+  8012fe:	89 d3                	mov    %edx,%ebx
+  801300:	89 d7                	mov    %edx,%edi
+  801302:	89 d6                	mov    %edx,%esi
+  801304:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801306:	5b                   	pop    %ebx
+  801307:	5e                   	pop    %esi
+  801308:	5f                   	pop    %edi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80130b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801310:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801315:	89 d1                	mov    %edx,%ecx
+  801317:	89 d3                	mov    %edx,%ebx
+  801319:	89 d7                	mov    %edx,%edi
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+  80131e:	8d 35 26 13 80 00    	lea    0x801326,%esi
+  801324:	0f 34                	sysenter
+  801326:	5d                   	pop    %ebp
+		goto out;
+  801327:	eb dd                	jmp    801306 <sys_fork+0x23>
+
+00801329 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  801329:	55                   	push   %ebp
+  80132a:	89 e5                	mov    %esp,%ebp
+  80132c:	57                   	push   %edi
+  80132d:	56                   	push   %esi
+  80132e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80132f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801336:	74 1c                	je     801354 <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  801338:	be 00 00 00 00       	mov    $0x0,%esi
+  80133d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801342:	8b 55 08             	mov    0x8(%ebp),%edx
+  801345:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801348:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134b:	89 f7                	mov    %esi,%edi
+  80134d:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  80134f:	5b                   	pop    %ebx
+  801350:	5e                   	pop    %esi
+  801351:	5f                   	pop    %edi
+  801352:	5d                   	pop    %ebp
+  801353:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801354:	8b 55 08             	mov    0x8(%ebp),%edx
+  801357:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  80135f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801364:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801367:	55                   	push   %ebp
+  801368:	89 e5                	mov    %esp,%ebp
+  80136a:	8d 35 72 13 80 00    	lea    0x801372,%esi
+  801370:	0f 34                	sysenter
+  801372:	5d                   	pop    %ebp
+		goto out;
+  801373:	eb da                	jmp    80134f <sys_thread_create+0x26>
+
+00801375 <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  801375:	55                   	push   %ebp
+  801376:	89 e5                	mov    %esp,%ebp
+  801378:	57                   	push   %edi
+  801379:	56                   	push   %esi
+  80137a:	53                   	push   %ebx
+  80137b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80137e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801385:	74 24                	je     8013ab <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  801387:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80138c:	be 00 00 00 00       	mov    $0x0,%esi
+  801391:	8b 55 08             	mov    0x8(%ebp),%edx
+  801394:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801397:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80139d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80139f:	85 c0                	test   %eax,%eax
+  8013a1:	7f 27                	jg     8013ca <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  8013a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a6:	5b                   	pop    %ebx
+  8013a7:	5e                   	pop    %esi
+  8013a8:	5f                   	pop    %edi
+  8013a9:	5d                   	pop    %ebp
+  8013aa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8013b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013bc:	55                   	push   %ebp
+  8013bd:	89 e5                	mov    %esp,%ebp
+  8013bf:	8d 35 c7 13 80 00    	lea    0x8013c7,%esi
+  8013c5:	0f 34                	sysenter
+  8013c7:	5d                   	pop    %ebp
+		goto out;
+  8013c8:	eb d5                	jmp    80139f <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ca:	83 ec 0c             	sub    $0xc,%esp
+  8013cd:	50                   	push   %eax
+  8013ce:	6a 1f                	push   $0x1f
+  8013d0:	68 4b 30 80 00       	push   $0x80304b
+  8013d5:	6a 3f                	push   $0x3f
+  8013d7:	68 68 30 80 00       	push   $0x803068
+  8013dc:	e8 6c ed ff ff       	call   80014d <_panic>
+
+008013e1 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  8013e1:	55                   	push   %ebp
+  8013e2:	89 e5                	mov    %esp,%ebp
+  8013e4:	57                   	push   %edi
+  8013e5:	56                   	push   %esi
+  8013e6:	53                   	push   %ebx
+  8013e7:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013ea:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013f1:	74 23                	je     801416 <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  8013f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f8:	b8 20 00 00 00       	mov    $0x20,%eax
+  8013fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801403:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801406:	89 f7                	mov    %esi,%edi
+  801408:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80140a:	85 c0                	test   %eax,%eax
+  80140c:	7f 29                	jg     801437 <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  80140e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801411:	5b                   	pop    %ebx
+  801412:	5e                   	pop    %esi
+  801413:	5f                   	pop    %edi
+  801414:	5d                   	pop    %ebp
+  801415:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801416:	8b 55 08             	mov    0x8(%ebp),%edx
+  801419:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80141c:	b8 20 00 00 00       	mov    $0x20,%eax
+  801421:	bf 00 00 00 00       	mov    $0x0,%edi
+  801426:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	8d 35 34 14 80 00    	lea    0x801434,%esi
+  801432:	0f 34                	sysenter
+  801434:	5d                   	pop    %ebp
+		goto out;
+  801435:	eb d3                	jmp    80140a <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801437:	83 ec 0c             	sub    $0xc,%esp
+  80143a:	50                   	push   %eax
+  80143b:	6a 20                	push   $0x20
+  80143d:	68 4b 30 80 00       	push   $0x80304b
+  801442:	6a 3f                	push   $0x3f
+  801444:	68 68 30 80 00       	push   $0x803068
+  801449:	e8 ff ec ff ff       	call   80014d <_panic>
+
+0080144e <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	57                   	push   %edi
+  801452:	56                   	push   %esi
+  801453:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801454:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80145b:	74 1b                	je     801478 <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  80145d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801462:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801467:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146d:	89 df                	mov    %ebx,%edi
+  80146f:	89 de                	mov    %ebx,%esi
+  801471:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801473:	5b                   	pop    %ebx
+  801474:	5e                   	pop    %esi
+  801475:	5f                   	pop    %edi
+  801476:	5d                   	pop    %ebp
+  801477:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801478:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801480:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801483:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801488:	89 df                	mov    %ebx,%edi
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	8d 35 95 14 80 00    	lea    0x801495,%esi
+  801493:	0f 34                	sysenter
+  801495:	5d                   	pop    %ebp
+		goto out;
+  801496:	eb db                	jmp    801473 <sys_batch+0x25>
+
+00801498 <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	57                   	push   %edi
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80149e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014a5:	74 1a                	je     8014c1 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  8014a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ac:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b4:	89 cb                	mov    %ecx,%ebx
+  8014b6:	89 cf                	mov    %ecx,%edi
+  8014b8:	89 ce                	mov    %ecx,%esi
+  8014ba:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  8014bc:	5b                   	pop    %ebx
+  8014bd:	5e                   	pop    %esi
+  8014be:	5f                   	pop    %edi
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8014ce:	89 cb                	mov    %ecx,%ebx
+  8014d0:	89 cf                	mov    %ecx,%edi
+  8014d2:	55                   	push   %ebp
+  8014d3:	89 e5                	mov    %esp,%ebp
+  8014d5:	8d 35 dd 14 80 00    	lea    0x8014dd,%esi
+  8014db:	0f 34                	sysenter
+  8014dd:	5d                   	pop    %ebp
+		goto out;
+  8014de:	eb dc                	jmp    8014bc <sys_trace_ctl+0x24>
+
+008014e0 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  8014e0:	55                   	push   %ebp
+  8014e1:	89 e5                	mov    %esp,%ebp
+  8014e3:	57                   	push   %edi
+  8014e4:	56                   	push   %esi
+  8014e5:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014e6:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014ed:	74 1c                	je     80150b <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  8014ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8014f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801502:	89 f7                	mov    %esi,%edi
+  801504:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  801506:	5b                   	pop    %ebx
+  801507:	5e                   	pop    %esi
+  801508:	5f                   	pop    %edi
+  801509:	5d                   	pop    %ebp
+  80150a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80150b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801511:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801516:	bf 00 00 00 00       	mov    $0x0,%edi
+  80151b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	8d 35 29 15 80 00    	lea    0x801529,%esi
+  801527:	0f 34                	sysenter
+  801529:	5d                   	pop    %ebp
+		goto out;
+  80152a:	eb da                	jmp    801506 <sys_trace_read+0x26>
+
+0080152c <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  80152c:	55                   	push   %ebp
+  80152d:	89 e5                	mov    %esp,%ebp
+  80152f:	57                   	push   %edi
+  801530:	56                   	push   %esi
+  801531:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801532:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801539:	74 1c                	je     801557 <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  80153b:	be 00 00 00 00       	mov    $0x0,%esi
+  801540:	b8 21 00 00 00       	mov    $0x21,%eax
+  801545:	8b 55 08             	mov    0x8(%ebp),%edx
+  801548:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80154b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154e:	89 f7                	mov    %esi,%edi
+  801550:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  801552:	5b                   	pop    %ebx
+  801553:	5e                   	pop    %esi
+  801554:	5f                   	pop    %edi
+  801555:	5d                   	pop    %ebp
+  801556:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155d:	b8 21 00 00 00       	mov    $0x21,%eax
+  801562:	bf 00 00 00 00       	mov    $0x0,%edi
+  801567:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80156a:	55                   	push   %ebp
+  80156b:	89 e5                	mov    %esp,%ebp
+  80156d:	8d 35 75 15 80 00    	lea    0x801575,%esi
+  801573:	0f 34                	sysenter
+  801575:	5d                   	pop    %ebp
+		goto out;
+  801576:	eb da                	jmp    801552 <sys_meminfo+0x26>
+
+00801578 <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  801578:	55                   	push   %ebp
+  801579:	89 e5                	mov    %esp,%ebp
+  80157b:	57                   	push   %edi
+  80157c:	56                   	push   %esi
+  80157d:	53                   	push   %ebx
+  80157e:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801581:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  801585:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80158c:	74 1f                	je     8015ad <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  80158e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801593:	b8 22 00 00 00       	mov    $0x22,%eax
+  801598:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159b:	89 df                	mov    %ebx,%edi
+  80159d:	89 de                	mov    %ebx,%esi
+  80159f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	7f 25                	jg     8015ca <sys_env_set_ksm+0x52>
+}
+  8015a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a8:	5b                   	pop    %ebx
+  8015a9:	5e                   	pop    %esi
+  8015aa:	5f                   	pop    %edi
+  8015ab:	5d                   	pop    %ebp
+  8015ac:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b5:	b8 22 00 00 00       	mov    $0x22,%eax
+  8015ba:	89 df                	mov    %ebx,%edi
+  8015bc:	55                   	push   %ebp
+  8015bd:	89 e5                	mov    %esp,%ebp
+  8015bf:	8d 35 c7 15 80 00    	lea    0x8015c7,%esi
+  8015c5:	0f 34                	sysenter
+  8015c7:	5d                   	pop    %ebp
+		goto out;
+  8015c8:	eb d7                	jmp    8015a1 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015ca:	83 ec 0c             	sub    $0xc,%esp
+  8015cd:	50                   	push   %eax
+  8015ce:	6a 22                	push   $0x22
+  8015d0:	68 4b 30 80 00       	push   $0x80304b
+  8015d5:	6a 3f                	push   $0x3f
+  8015d7:	68 68 30 80 00       	push   $0x803068
+  8015dc:	e8 6c eb ff ff       	call   80014d <_panic>
+
+008015e1 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  8015e1:	55                   	push   %ebp
+  8015e2:	89 e5                	mov    %esp,%ebp
+  8015e4:	57                   	push   %edi
+  8015e5:	56                   	push   %esi
+  8015e6:	53                   	push   %ebx
+  8015e7:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  8015ea:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  8015ed:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015f4:	74 24                	je     80161a <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  8015f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801600:	89 cb                	mov    %ecx,%ebx
+  801602:	89 cf                	mov    %ecx,%edi
+  801604:	89 ce                	mov    %ecx,%esi
+  801606:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	7f 2a                	jg     801636 <sys_time_nsec+0x55>
+	return ns;
+}
+  80160c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80160f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80161a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80161f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801624:	89 cb                	mov    %ecx,%ebx
+  801626:	89 cf                	mov    %ecx,%edi
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	8d 35 33 16 80 00    	lea    0x801633,%esi
+  801631:	0f 34                	sysenter
+  801633:	5d                   	pop    %ebp
+		goto out;
+  801634:	eb d2                	jmp    801608 <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801636:	83 ec 0c             	sub    $0xc,%esp
+  801639:	50                   	push   %eax
+  80163a:	6a 0f                	push   $0xf
+  80163c:	68 4b 30 80 00       	push   $0x80304b
+  801641:	6a 3f                	push   $0x3f
+  801643:	68 68 30 80 00       	push   $0x803068
+  801648:	e8 00 eb ff ff       	call   80014d <_panic>
+
+0080164d <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	57                   	push   %edi
+  801651:	56                   	push   %esi
+  801652:	53                   	push   %ebx
+  801653:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801656:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80165d:	74 22                	je     801681 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  80165f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801664:	b8 12 00 00 00       	mov    $0x12,%eax
+  801669:	8b 55 08             	mov    0x8(%ebp),%edx
+  80166c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80166f:	89 df                	mov    %ebx,%edi
+  801671:	89 de                	mov    %ebx,%esi
+  801673:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801675:	85 c0                	test   %eax,%eax
+  801677:	7f 28                	jg     8016a1 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  801679:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167c:	5b                   	pop    %ebx
+  80167d:	5e                   	pop    %esi
+  80167e:	5f                   	pop    %edi
+  80167f:	5d                   	pop    %ebp
+  801680:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801681:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801686:	8b 55 08             	mov    0x8(%ebp),%edx
+  801689:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80168c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801691:	89 df                	mov    %ebx,%edi
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	8d 35 9e 16 80 00    	lea    0x80169e,%esi
+  80169c:	0f 34                	sysenter
+  80169e:	5d                   	pop    %ebp
+		goto out;
+  80169f:	eb d4                	jmp    801675 <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016a1:	83 ec 0c             	sub    $0xc,%esp
+  8016a4:	50                   	push   %eax
+  8016a5:	6a 12                	push   $0x12
+  8016a7:	68 4b 30 80 00       	push   $0x80304b
+  8016ac:	6a 3f                	push   $0x3f
+  8016ae:	68 68 30 80 00       	push   $0x803068
+  8016b3:	e8 95 ea ff ff       	call   80014d <_panic>
+
+008016b8 <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  8016b8:	55                   	push   %ebp
+  8016b9:	89 e5                	mov    %esp,%ebp
+  8016bb:	57                   	push   %edi
+  8016bc:	56                   	push   %esi
+  8016bd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016be:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016c5:	74 1b                	je     8016e2 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  8016c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d7:	89 df                	mov    %ebx,%edi
+  8016d9:	89 de                	mov    %ebx,%esi
+  8016db:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5f                   	pop    %edi
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ed:	b8 13 00 00 00       	mov    $0x13,%eax
+  8016f2:	89 df                	mov    %ebx,%edi
+  8016f4:	55                   	push   %ebp
+  8016f5:	89 e5                	mov    %esp,%ebp
+  8016f7:	8d 35 ff 16 80 00    	lea    0x8016ff,%esi
+  8016fd:	0f 34                	sysenter
+  8016ff:	5d                   	pop    %ebp
+		goto out;
+  801700:	eb db                	jmp    8016dd <sys_e1000_receive+0x25>
+
+00801702 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801702:	55                   	push   %ebp
+  801703:	89 e5                	mov    %esp,%ebp
+  801705:	57                   	push   %edi
+  801706:	56                   	push   %esi
+  801707:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801708:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80170f:	74 1b                	je     80172c <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801711:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801716:	b8 14 00 00 00       	mov    $0x14,%eax
+  80171b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80171e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801721:	89 df                	mov    %ebx,%edi
+  801723:	89 de                	mov    %ebx,%esi
+  801725:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801727:	5b                   	pop    %ebx
+  801728:	5e                   	pop    %esi
+  801729:	5f                   	pop    %edi
+  80172a:	5d                   	pop    %ebp
+  80172b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80172c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801731:	8b 55 08             	mov    0x8(%ebp),%edx
+  801734:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801737:	b8 14 00 00 00       	mov    $0x14,%eax
+  80173c:	89 df                	mov    %ebx,%edi
+  80173e:	55                   	push   %ebp
+  80173f:	89 e5                	mov    %esp,%ebp
+  801741:	8d 35 49 17 80 00    	lea    0x801749,%esi
+  801747:	0f 34                	sysenter
+  801749:	5d                   	pop    %ebp
+		goto out;
+  80174a:	eb db                	jmp    801727 <sys_e1000_read_hwaddr+0x25>
+
+0080174c <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	57                   	push   %edi
+  801750:	56                   	push   %esi
+  801751:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801752:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801759:	74 1a                	je     801775 <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  80175b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801760:	b8 15 00 00 00       	mov    $0x15,%eax
+  801765:	8b 55 08             	mov    0x8(%ebp),%edx
+  801768:	89 cb                	mov    %ecx,%ebx
+  80176a:	89 cf                	mov    %ecx,%edi
+  80176c:	89 ce                	mov    %ecx,%esi
+  80176e:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801770:	5b                   	pop    %ebx
+  801771:	5e                   	pop    %esi
+  801772:	5f                   	pop    %edi
+  801773:	5d                   	pop    %ebp
+  801774:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801775:	8b 55 08             	mov    0x8(%ebp),%edx
+  801778:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80177d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801782:	89 cb                	mov    %ecx,%ebx
+  801784:	89 cf                	mov    %ecx,%edi
+  801786:	55                   	push   %ebp
+  801787:	89 e5                	mov    %esp,%ebp
+  801789:	8d 35 91 17 80 00    	lea    0x801791,%esi
+  80178f:	0f 34                	sysenter
+  801791:	5d                   	pop    %ebp
+		goto out;
+  801792:	eb dc                	jmp    801770 <sys_sb16_read_version+0x24>
+
+00801794 <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  801794:	55                   	push   %ebp
+  801795:	89 e5                	mov    %esp,%ebp
+  801797:	57                   	push   %edi
+  801798:	56                   	push   %esi
+  801799:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80179a:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017a1:	74 1b                	je     8017be <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  8017a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a8:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b3:	89 df                	mov    %ebx,%edi
+  8017b5:	89 de                	mov    %ebx,%esi
+  8017b7:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  8017b9:	5b                   	pop    %ebx
+  8017ba:	5e                   	pop    %esi
+  8017bb:	5f                   	pop    %edi
+  8017bc:	5d                   	pop    %ebp
+  8017bd:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017c9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8017ce:	89 df                	mov    %ebx,%edi
+  8017d0:	55                   	push   %ebp
+  8017d1:	89 e5                	mov    %esp,%ebp
+  8017d3:	8d 35 db 17 80 00    	lea    0x8017db,%esi
+  8017d9:	0f 34                	sysenter
+  8017db:	5d                   	pop    %ebp
+		goto out;
+  8017dc:	eb db                	jmp    8017b9 <sys_sb16_play+0x25>
+
+008017de <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017de:	55                   	push   %ebp
+  8017df:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017e9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017ec:	5d                   	pop    %ebp
+  8017ed:	c3                   	ret
+
+008017ee <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017ee:	55                   	push   %ebp
+  8017ef:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017f4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8017f9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8017fe:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801803:	5d                   	pop    %ebp
+  801804:	c3                   	ret
+
+00801805 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801808:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80180d:	eb 02                	jmp    801811 <fd_alloc+0xc>
+  80180f:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801811:	89 c2                	mov    %eax,%edx
+  801813:	c1 ea 16             	shr    $0x16,%edx
+  801816:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80181d:	f6 c2 01             	test   $0x1,%dl
+  801820:	74 2b                	je     80184d <fd_alloc+0x48>
+  801822:	89 c2                	mov    %eax,%edx
+  801824:	c1 ea 0c             	shr    $0xc,%edx
+  801827:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80182e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801834:	f6 c1 01             	test   $0x1,%cl
+  801837:	74 14                	je     80184d <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  801839:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80183f:	75 ce                	jne    80180f <fd_alloc+0xa>
+  801841:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801846:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80184b:	eb 05                	jmp    801852 <fd_alloc+0x4d>
+			return 0;
+  80184d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801852:	8b 55 08             	mov    0x8(%ebp),%edx
+  801855:	89 02                	mov    %eax,(%edx)
+}
+  801857:	89 c8                	mov    %ecx,%eax
+  801859:	5d                   	pop    %ebp
+  80185a:	c3                   	ret
+
+0080185b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80185b:	55                   	push   %ebp
+  80185c:	89 e5                	mov    %esp,%ebp
+  80185e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801861:	83 f8 1f             	cmp    $0x1f,%eax
+  801864:	77 30                	ja     801896 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801866:	c1 e0 0c             	shl    $0xc,%eax
+  801869:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80186e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801874:	f6 c2 01             	test   $0x1,%dl
+  801877:	74 24                	je     80189d <fd_lookup+0x42>
+  801879:	89 c2                	mov    %eax,%edx
+  80187b:	c1 ea 0c             	shr    $0xc,%edx
+  80187e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801885:	f6 c2 01             	test   $0x1,%dl
+  801888:	74 1a                	je     8018a4 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80188a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80188d:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80188f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801894:	5d                   	pop    %ebp
+  801895:	c3                   	ret
+		return -E_INVAL;
+  801896:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189b:	eb f7                	jmp    801894 <fd_lookup+0x39>
+		return -E_INVAL;
+  80189d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a2:	eb f0                	jmp    801894 <fd_lookup+0x39>
+  8018a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a9:	eb e9                	jmp    801894 <fd_lookup+0x39>
+
+008018ab <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018ab:	55                   	push   %ebp
+  8018ac:	89 e5                	mov    %esp,%ebp
+  8018ae:	53                   	push   %ebx
+  8018af:	83 ec 04             	sub    $0x4,%esp
+  8018b2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8018b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ba:	eb 03                	jmp    8018bf <dev_lookup+0x14>
+  8018bc:	83 c0 01             	add    $0x1,%eax
+  8018bf:	8b 1c 85 f4 30 80 00 	mov    0x8030f4(,%eax,4),%ebx
+  8018c6:	85 db                	test   %ebx,%ebx
+  8018c8:	74 0b                	je     8018d5 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8018ca:	39 13                	cmp    %edx,(%ebx)
+  8018cc:	75 ee                	jne    8018bc <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8018ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d3:	eb 2e                	jmp    801903 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8018d5:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018d7:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  8018dc:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8018e2:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8018e7:	76 24                	jbe    80190d <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018e9:	8b 41 48             	mov    0x48(%ecx),%eax
+  8018ec:	83 ec 04             	sub    $0x4,%esp
+  8018ef:	52                   	push   %edx
+  8018f0:	50                   	push   %eax
+  8018f1:	68 78 30 80 00       	push   $0x803078
+  8018f6:	e8 2d e9 ff ff       	call   800228 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8018fb:	83 c4 10             	add    $0x10,%esp
+  8018fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801903:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801906:	89 1a                	mov    %ebx,(%edx)
+}
+  801908:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190b:	c9                   	leave
+  80190c:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80190d:	c1 e8 10             	shr    $0x10,%eax
+  801910:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801916:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80191c:	eb cb                	jmp    8018e9 <dev_lookup+0x3e>
+
+0080191e <fd_close>:
+{
+  80191e:	55                   	push   %ebp
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	57                   	push   %edi
+  801922:	56                   	push   %esi
+  801923:	53                   	push   %ebx
+  801924:	83 ec 24             	sub    $0x24,%esp
+  801927:	8b 75 08             	mov    0x8(%ebp),%esi
+  80192a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80192d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801930:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801931:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801937:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80193a:	50                   	push   %eax
+  80193b:	e8 1b ff ff ff       	call   80185b <fd_lookup>
+  801940:	89 c3                	mov    %eax,%ebx
+  801942:	83 c4 10             	add    $0x10,%esp
+  801945:	85 c0                	test   %eax,%eax
+  801947:	78 05                	js     80194e <fd_close+0x30>
+	    || fd != fd2)
+  801949:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80194c:	74 16                	je     801964 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80194e:	89 f8                	mov    %edi,%eax
+  801950:	84 c0                	test   %al,%al
+  801952:	b8 00 00 00 00       	mov    $0x0,%eax
+  801957:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80195a:	89 d8                	mov    %ebx,%eax
+  80195c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80195f:	5b                   	pop    %ebx
+  801960:	5e                   	pop    %esi
+  801961:	5f                   	pop    %edi
+  801962:	5d                   	pop    %ebp
+  801963:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801964:	83 ec 08             	sub    $0x8,%esp
+  801967:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80196a:	50                   	push   %eax
+  80196b:	ff 36                	push   (%esi)
+  80196d:	e8 39 ff ff ff       	call   8018ab <dev_lookup>
+  801972:	89 c3                	mov    %eax,%ebx
+  801974:	83 c4 10             	add    $0x10,%esp
+  801977:	85 c0                	test   %eax,%eax
+  801979:	78 1a                	js     801995 <fd_close+0x77>
+		if (dev->dev_close)
+  80197b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80197e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801981:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801986:	85 c0                	test   %eax,%eax
+  801988:	74 0b                	je     801995 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80198a:	83 ec 0c             	sub    $0xc,%esp
+  80198d:	56                   	push   %esi
+  80198e:	ff d0                	call   *%eax
+  801990:	89 c3                	mov    %eax,%ebx
+  801992:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801995:	83 ec 08             	sub    $0x8,%esp
+  801998:	56                   	push   %esi
+  801999:	6a 00                	push   $0x0
+  80199b:	e8 a3 f4 ff ff       	call   800e43 <sys_page_unmap>
+	return r;
+  8019a0:	83 c4 10             	add    $0x10,%esp
+  8019a3:	eb b5                	jmp    80195a <fd_close+0x3c>
+
+008019a5 <close>:
+
+int
+close(int fdnum)
+{
+  8019a5:	55                   	push   %ebp
+  8019a6:	89 e5                	mov    %esp,%ebp
+  8019a8:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ae:	50                   	push   %eax
+  8019af:	ff 75 08             	push   0x8(%ebp)
+  8019b2:	e8 a4 fe ff ff       	call   80185b <fd_lookup>
+  8019b7:	83 c4 10             	add    $0x10,%esp
+  8019ba:	85 c0                	test   %eax,%eax
+  8019bc:	79 02                	jns    8019c0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8019be:	c9                   	leave
+  8019bf:	c3                   	ret
+		return fd_close(fd, 1);
+  8019c0:	83 ec 08             	sub    $0x8,%esp
+  8019c3:	6a 01                	push   $0x1
+  8019c5:	ff 75 f4             	push   -0xc(%ebp)
+  8019c8:	e8 51 ff ff ff       	call   80191e <fd_close>
+  8019cd:	83 c4 10             	add    $0x10,%esp
+  8019d0:	eb ec                	jmp    8019be <close+0x19>
+
+008019d2 <close_all>:
+
+void
+close_all(void)
+{
+  8019d2:	55                   	push   %ebp
+  8019d3:	89 e5                	mov    %esp,%ebp
+  8019d5:	53                   	push   %ebx
+  8019d6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8019d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8019de:	83 ec 0c             	sub    $0xc,%esp
+  8019e1:	53                   	push   %ebx
+  8019e2:	e8 be ff ff ff       	call   8019a5 <close>
+	for (i = 0; i < MAXFD; i++)
+  8019e7:	83 c3 01             	add    $0x1,%ebx
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	83 fb 20             	cmp    $0x20,%ebx
+  8019f0:	75 ec                	jne    8019de <close_all+0xc>
+}
+  8019f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f5:	c9                   	leave
+  8019f6:	c3                   	ret
+
+008019f7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019f7:	55                   	push   %ebp
+  8019f8:	89 e5                	mov    %esp,%ebp
+  8019fa:	57                   	push   %edi
+  8019fb:	56                   	push   %esi
+  8019fc:	53                   	push   %ebx
+  8019fd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a00:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a03:	50                   	push   %eax
+  801a04:	ff 75 08             	push   0x8(%ebp)
+  801a07:	e8 4f fe ff ff       	call   80185b <fd_lookup>
+  801a0c:	89 c3                	mov    %eax,%ebx
+  801a0e:	83 c4 10             	add    $0x10,%esp
+  801a11:	85 c0                	test   %eax,%eax
+  801a13:	78 7f                	js     801a94 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a15:	83 ec 0c             	sub    $0xc,%esp
+  801a18:	ff 75 0c             	push   0xc(%ebp)
+  801a1b:	e8 85 ff ff ff       	call   8019a5 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a20:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a23:	c1 e6 0c             	shl    $0xc,%esi
+  801a26:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801a2c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801a2f:	89 3c 24             	mov    %edi,(%esp)
+  801a32:	e8 b7 fd ff ff       	call   8017ee <fd2data>
+  801a37:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801a39:	89 34 24             	mov    %esi,(%esp)
+  801a3c:	e8 ad fd ff ff       	call   8017ee <fd2data>
+  801a41:	83 c4 10             	add    $0x10,%esp
+  801a44:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801a47:	89 d8                	mov    %ebx,%eax
+  801a49:	c1 e8 16             	shr    $0x16,%eax
+  801a4c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a53:	a8 01                	test   $0x1,%al
+  801a55:	74 11                	je     801a68 <dup+0x71>
+  801a57:	89 d8                	mov    %ebx,%eax
+  801a59:	c1 e8 0c             	shr    $0xc,%eax
+  801a5c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a63:	f6 c2 01             	test   $0x1,%dl
+  801a66:	75 36                	jne    801a9e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a68:	89 f8                	mov    %edi,%eax
+  801a6a:	c1 e8 0c             	shr    $0xc,%eax
+  801a6d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a74:	83 ec 0c             	sub    $0xc,%esp
+  801a77:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a7c:	50                   	push   %eax
+  801a7d:	56                   	push   %esi
+  801a7e:	6a 00                	push   $0x0
+  801a80:	57                   	push   %edi
+  801a81:	6a 00                	push   $0x0
+  801a83:	e8 4d f3 ff ff       	call   800dd5 <sys_page_map>
+  801a88:	89 c3                	mov    %eax,%ebx
+  801a8a:	83 c4 20             	add    $0x20,%esp
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	78 33                	js     801ac4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801a91:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801a94:	89 d8                	mov    %ebx,%eax
+  801a96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a99:	5b                   	pop    %ebx
+  801a9a:	5e                   	pop    %esi
+  801a9b:	5f                   	pop    %edi
+  801a9c:	5d                   	pop    %ebp
+  801a9d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801a9e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aa5:	83 ec 0c             	sub    $0xc,%esp
+  801aa8:	25 07 0e 00 00       	and    $0xe07,%eax
+  801aad:	50                   	push   %eax
+  801aae:	ff 75 d4             	push   -0x2c(%ebp)
+  801ab1:	6a 00                	push   $0x0
+  801ab3:	53                   	push   %ebx
+  801ab4:	6a 00                	push   $0x0
+  801ab6:	e8 1a f3 ff ff       	call   800dd5 <sys_page_map>
+  801abb:	89 c3                	mov    %eax,%ebx
+  801abd:	83 c4 20             	add    $0x20,%esp
+  801ac0:	85 c0                	test   %eax,%eax
+  801ac2:	79 a4                	jns    801a68 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ac4:	83 ec 08             	sub    $0x8,%esp
+  801ac7:	56                   	push   %esi
+  801ac8:	6a 00                	push   $0x0
+  801aca:	e8 74 f3 ff ff       	call   800e43 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801acf:	83 c4 08             	add    $0x8,%esp
+  801ad2:	ff 75 d4             	push   -0x2c(%ebp)
+  801ad5:	6a 00                	push   $0x0
+  801ad7:	e8 67 f3 ff ff       	call   800e43 <sys_page_unmap>
+	return r;
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	eb b3                	jmp    801a94 <dup+0x9d>
+
+00801ae1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ae1:	55                   	push   %ebp
+  801ae2:	89 e5                	mov    %esp,%ebp
+  801ae4:	56                   	push   %esi
+  801ae5:	53                   	push   %ebx
+  801ae6:	83 ec 18             	sub    $0x18,%esp
+  801ae9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801aec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aef:	50                   	push   %eax
+  801af0:	53                   	push   %ebx
+  801af1:	e8 65 fd ff ff       	call   80185b <fd_lookup>
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	85 c0                	test   %eax,%eax
+  801afb:	78 3c                	js     801b39 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801afd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b00:	83 ec 08             	sub    $0x8,%esp
+  801b03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b06:	50                   	push   %eax
+  801b07:	ff 36                	push   (%esi)
+  801b09:	e8 9d fd ff ff       	call   8018ab <dev_lookup>
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 24                	js     801b39 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b15:	8b 46 08             	mov    0x8(%esi),%eax
+  801b18:	83 e0 03             	and    $0x3,%eax
+  801b1b:	83 f8 01             	cmp    $0x1,%eax
+  801b1e:	74 20                	je     801b40 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b23:	8b 40 08             	mov    0x8(%eax),%eax
+  801b26:	85 c0                	test   %eax,%eax
+  801b28:	74 57                	je     801b81 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801b2a:	83 ec 04             	sub    $0x4,%esp
+  801b2d:	ff 75 10             	push   0x10(%ebp)
+  801b30:	ff 75 0c             	push   0xc(%ebp)
+  801b33:	56                   	push   %esi
+  801b34:	ff d0                	call   *%eax
+  801b36:	83 c4 10             	add    $0x10,%esp
+}
+  801b39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3c:	5b                   	pop    %ebx
+  801b3d:	5e                   	pop    %esi
+  801b3e:	5d                   	pop    %ebp
+  801b3f:	c3                   	ret
+  801b40:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b42:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801b47:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801b4d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801b52:	76 1c                	jbe    801b70 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b54:	8b 42 48             	mov    0x48(%edx),%eax
+  801b57:	83 ec 04             	sub    $0x4,%esp
+  801b5a:	53                   	push   %ebx
+  801b5b:	50                   	push   %eax
+  801b5c:	68 b9 30 80 00       	push   $0x8030b9
+  801b61:	e8 c2 e6 ff ff       	call   800228 <cprintf>
+		return -E_INVAL;
+  801b66:	83 c4 10             	add    $0x10,%esp
+  801b69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b6e:	eb c9                	jmp    801b39 <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801b70:	c1 e8 10             	shr    $0x10,%eax
+  801b73:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801b79:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801b7f:	eb d3                	jmp    801b54 <read+0x73>
+		return -E_NOT_SUPP;
+  801b81:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b86:	eb b1                	jmp    801b39 <read+0x58>
+
+00801b88 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b88:	55                   	push   %ebp
+  801b89:	89 e5                	mov    %esp,%ebp
+  801b8b:	57                   	push   %edi
+  801b8c:	56                   	push   %esi
+  801b8d:	53                   	push   %ebx
+  801b8e:	83 ec 0c             	sub    $0xc,%esp
+  801b91:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b94:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801b97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b9c:	eb 02                	jmp    801ba0 <readn+0x18>
+  801b9e:	01 c3                	add    %eax,%ebx
+  801ba0:	39 f3                	cmp    %esi,%ebx
+  801ba2:	73 21                	jae    801bc5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ba4:	83 ec 04             	sub    $0x4,%esp
+  801ba7:	89 f0                	mov    %esi,%eax
+  801ba9:	29 d8                	sub    %ebx,%eax
+  801bab:	50                   	push   %eax
+  801bac:	89 d8                	mov    %ebx,%eax
+  801bae:	03 45 0c             	add    0xc(%ebp),%eax
+  801bb1:	50                   	push   %eax
+  801bb2:	57                   	push   %edi
+  801bb3:	e8 29 ff ff ff       	call   801ae1 <read>
+		if (m < 0)
+  801bb8:	83 c4 10             	add    $0x10,%esp
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 04                	js     801bc3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801bbf:	75 dd                	jne    801b9e <readn+0x16>
+  801bc1:	eb 02                	jmp    801bc5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801bc3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801bc5:	89 d8                	mov    %ebx,%eax
+  801bc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bca:	5b                   	pop    %ebx
+  801bcb:	5e                   	pop    %esi
+  801bcc:	5f                   	pop    %edi
+  801bcd:	5d                   	pop    %ebp
+  801bce:	c3                   	ret
+
+00801bcf <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801bcf:	55                   	push   %ebp
+  801bd0:	89 e5                	mov    %esp,%ebp
+  801bd2:	56                   	push   %esi
+  801bd3:	53                   	push   %ebx
+  801bd4:	83 ec 18             	sub    $0x18,%esp
+  801bd7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bda:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bdd:	50                   	push   %eax
+  801bde:	53                   	push   %ebx
+  801bdf:	e8 77 fc ff ff       	call   80185b <fd_lookup>
+  801be4:	83 c4 10             	add    $0x10,%esp
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 37                	js     801c22 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801beb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bee:	83 ec 08             	sub    $0x8,%esp
+  801bf1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bf4:	50                   	push   %eax
+  801bf5:	ff 36                	push   (%esi)
+  801bf7:	e8 af fc ff ff       	call   8018ab <dev_lookup>
+  801bfc:	83 c4 10             	add    $0x10,%esp
+  801bff:	85 c0                	test   %eax,%eax
+  801c01:	78 1f                	js     801c22 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c03:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c07:	74 20                	je     801c29 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c0c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c0f:	85 c0                	test   %eax,%eax
+  801c11:	74 57                	je     801c6a <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c13:	83 ec 04             	sub    $0x4,%esp
+  801c16:	ff 75 10             	push   0x10(%ebp)
+  801c19:	ff 75 0c             	push   0xc(%ebp)
+  801c1c:	56                   	push   %esi
+  801c1d:	ff d0                	call   *%eax
+  801c1f:	83 c4 10             	add    $0x10,%esp
+}
+  801c22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c25:	5b                   	pop    %ebx
+  801c26:	5e                   	pop    %esi
+  801c27:	5d                   	pop    %ebp
+  801c28:	c3                   	ret
+  801c29:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c2b:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801c30:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801c36:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801c3b:	76 1c                	jbe    801c59 <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c3d:	8b 42 48             	mov    0x48(%edx),%eax
+  801c40:	83 ec 04             	sub    $0x4,%esp
+  801c43:	53                   	push   %ebx
+  801c44:	50                   	push   %eax
+  801c45:	68 d5 30 80 00       	push   $0x8030d5
+  801c4a:	e8 d9 e5 ff ff       	call   800228 <cprintf>
+		return -E_INVAL;
+  801c4f:	83 c4 10             	add    $0x10,%esp
+  801c52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c57:	eb c9                	jmp    801c22 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801c59:	c1 e8 10             	shr    $0x10,%eax
+  801c5c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801c62:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801c68:	eb d3                	jmp    801c3d <write+0x6e>
+		return -E_NOT_SUPP;
+  801c6a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c6f:	eb b1                	jmp    801c22 <write+0x53>
+
+00801c71 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c71:	55                   	push   %ebp
+  801c72:	89 e5                	mov    %esp,%ebp
+  801c74:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c7a:	50                   	push   %eax
+  801c7b:	ff 75 08             	push   0x8(%ebp)
+  801c7e:	e8 d8 fb ff ff       	call   80185b <fd_lookup>
+  801c83:	83 c4 10             	add    $0x10,%esp
+  801c86:	85 c0                	test   %eax,%eax
+  801c88:	78 0e                	js     801c98 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801c8a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c90:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801c93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c98:	c9                   	leave
+  801c99:	c3                   	ret
+
+00801c9a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	56                   	push   %esi
+  801c9e:	53                   	push   %ebx
+  801c9f:	83 ec 18             	sub    $0x18,%esp
+  801ca2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ca5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca8:	50                   	push   %eax
+  801ca9:	53                   	push   %ebx
+  801caa:	e8 ac fb ff ff       	call   80185b <fd_lookup>
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	85 c0                	test   %eax,%eax
+  801cb4:	78 34                	js     801cea <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cb6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cb9:	83 ec 08             	sub    $0x8,%esp
+  801cbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbf:	50                   	push   %eax
+  801cc0:	ff 36                	push   (%esi)
+  801cc2:	e8 e4 fb ff ff       	call   8018ab <dev_lookup>
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	78 1c                	js     801cea <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cce:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cd2:	74 1d                	je     801cf1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801cd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd7:	8b 40 18             	mov    0x18(%eax),%eax
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	74 54                	je     801d32 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801cde:	83 ec 08             	sub    $0x8,%esp
+  801ce1:	ff 75 0c             	push   0xc(%ebp)
+  801ce4:	56                   	push   %esi
+  801ce5:	ff d0                	call   *%eax
+  801ce7:	83 c4 10             	add    $0x10,%esp
+}
+  801cea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ced:	5b                   	pop    %ebx
+  801cee:	5e                   	pop    %esi
+  801cef:	5d                   	pop    %ebp
+  801cf0:	c3                   	ret
+  801cf1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cf3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801cf8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cfe:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d03:	76 1c                	jbe    801d21 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801d05:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d08:	83 ec 04             	sub    $0x4,%esp
+  801d0b:	53                   	push   %ebx
+  801d0c:	50                   	push   %eax
+  801d0d:	68 98 30 80 00       	push   $0x803098
+  801d12:	e8 11 e5 ff ff       	call   800228 <cprintf>
+		return -E_INVAL;
+  801d17:	83 c4 10             	add    $0x10,%esp
+  801d1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1f:	eb c9                	jmp    801cea <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d21:	c1 e8 10             	shr    $0x10,%eax
+  801d24:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d2a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d30:	eb d3                	jmp    801d05 <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801d32:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d37:	eb b1                	jmp    801cea <ftruncate+0x50>
+
+00801d39 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d39:	55                   	push   %ebp
+  801d3a:	89 e5                	mov    %esp,%ebp
+  801d3c:	56                   	push   %esi
+  801d3d:	53                   	push   %ebx
+  801d3e:	83 ec 18             	sub    $0x18,%esp
+  801d41:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d44:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d47:	50                   	push   %eax
+  801d48:	ff 75 08             	push   0x8(%ebp)
+  801d4b:	e8 0b fb ff ff       	call   80185b <fd_lookup>
+  801d50:	83 c4 10             	add    $0x10,%esp
+  801d53:	85 c0                	test   %eax,%eax
+  801d55:	78 49                	js     801da0 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d57:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d5a:	83 ec 08             	sub    $0x8,%esp
+  801d5d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d60:	50                   	push   %eax
+  801d61:	ff 36                	push   (%esi)
+  801d63:	e8 43 fb ff ff       	call   8018ab <dev_lookup>
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	78 31                	js     801da0 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801d6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d72:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d76:	74 2f                	je     801da7 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801d78:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801d7b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d82:	00 00 00 
+	stat->st_isdir = 0;
+  801d85:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d8c:	00 00 00 
+	stat->st_dev = dev;
+  801d8f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801d95:	83 ec 08             	sub    $0x8,%esp
+  801d98:	53                   	push   %ebx
+  801d99:	56                   	push   %esi
+  801d9a:	ff 50 14             	call   *0x14(%eax)
+  801d9d:	83 c4 10             	add    $0x10,%esp
+}
+  801da0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da3:	5b                   	pop    %ebx
+  801da4:	5e                   	pop    %esi
+  801da5:	5d                   	pop    %ebp
+  801da6:	c3                   	ret
+		return -E_NOT_SUPP;
+  801da7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dac:	eb f2                	jmp    801da0 <fstat+0x67>
+
+00801dae <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801dae:	55                   	push   %ebp
+  801daf:	89 e5                	mov    %esp,%ebp
+  801db1:	56                   	push   %esi
+  801db2:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801db3:	83 ec 08             	sub    $0x8,%esp
+  801db6:	6a 00                	push   $0x0
+  801db8:	ff 75 08             	push   0x8(%ebp)
+  801dbb:	e8 e4 01 00 00       	call   801fa4 <open>
+  801dc0:	89 c3                	mov    %eax,%ebx
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 1b                	js     801de4 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801dc9:	83 ec 08             	sub    $0x8,%esp
+  801dcc:	ff 75 0c             	push   0xc(%ebp)
+  801dcf:	50                   	push   %eax
+  801dd0:	e8 64 ff ff ff       	call   801d39 <fstat>
+  801dd5:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801dd7:	89 1c 24             	mov    %ebx,(%esp)
+  801dda:	e8 c6 fb ff ff       	call   8019a5 <close>
+	return r;
+  801ddf:	83 c4 10             	add    $0x10,%esp
+  801de2:	89 f3                	mov    %esi,%ebx
+}
+  801de4:	89 d8                	mov    %ebx,%eax
+  801de6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de9:	5b                   	pop    %ebx
+  801dea:	5e                   	pop    %esi
+  801deb:	5d                   	pop    %ebp
+  801dec:	c3                   	ret
+
+00801ded <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+  801df0:	56                   	push   %esi
+  801df1:	53                   	push   %ebx
+  801df2:	89 c6                	mov    %eax,%esi
+  801df4:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801df6:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801dfd:	74 27                	je     801e26 <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801dff:	6a 07                	push   $0x7
+  801e01:	68 00 60 80 00       	push   $0x806000
+  801e06:	56                   	push   %esi
+  801e07:	ff 35 00 50 80 00    	push   0x805000
+  801e0d:	e8 c6 0d 00 00       	call   802bd8 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e12:	83 c4 0c             	add    $0xc,%esp
+  801e15:	6a 00                	push   $0x0
+  801e17:	53                   	push   %ebx
+  801e18:	6a 00                	push   $0x0
+  801e1a:	e8 a1 0d 00 00       	call   802bc0 <ipc_recv>
+}
+  801e1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e22:	5b                   	pop    %ebx
+  801e23:	5e                   	pop    %esi
+  801e24:	5d                   	pop    %ebp
+  801e25:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e26:	83 ec 0c             	sub    $0xc,%esp
+  801e29:	6a 01                	push   $0x1
+  801e2b:	e8 fc 0d 00 00       	call   802c2c <ipc_find_env>
+  801e30:	a3 00 50 80 00       	mov    %eax,0x805000
+  801e35:	83 c4 10             	add    $0x10,%esp
+  801e38:	eb c5                	jmp    801dff <fsipc+0x12>
+
+00801e3a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e3a:	55                   	push   %ebp
+  801e3b:	89 e5                	mov    %esp,%ebp
+  801e3d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e40:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e43:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e46:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801e4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e4e:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e58:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e5d:	e8 8b ff ff ff       	call   801ded <fsipc>
+}
+  801e62:	c9                   	leave
+  801e63:	c3                   	ret
+
+00801e64 <devfile_flush>:
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e70:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801e75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e7f:	e8 69 ff ff ff       	call   801ded <fsipc>
+}
+  801e84:	c9                   	leave
+  801e85:	c3                   	ret
+
+00801e86 <devfile_stat>:
+{
+  801e86:	55                   	push   %ebp
+  801e87:	89 e5                	mov    %esp,%ebp
+  801e89:	53                   	push   %ebx
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e90:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e93:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e96:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea0:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ea5:	e8 43 ff ff ff       	call   801ded <fsipc>
+  801eaa:	85 c0                	test   %eax,%eax
+  801eac:	78 2c                	js     801eda <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801eae:	83 ec 08             	sub    $0x8,%esp
+  801eb1:	68 00 60 80 00       	push   $0x806000
+  801eb6:	53                   	push   %ebx
+  801eb7:	e8 b4 e9 ff ff       	call   800870 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801ebc:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ec1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ec7:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ecc:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801ed2:	83 c4 10             	add    $0x10,%esp
+  801ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801edd:	c9                   	leave
+  801ede:	c3                   	ret
+
+00801edf <devfile_write>:
+{
+  801edf:	55                   	push   %ebp
+  801ee0:	89 e5                	mov    %esp,%ebp
+  801ee2:	83 ec 0c             	sub    $0xc,%esp
+  801ee5:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801eeb:	8b 52 0c             	mov    0xc(%edx),%edx
+  801eee:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801ef4:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801ef9:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801efe:	39 d0                	cmp    %edx,%eax
+  801f00:	0f 47 c2             	cmova  %edx,%eax
+  801f03:	50                   	push   %eax
+  801f04:	ff 75 0c             	push   0xc(%ebp)
+  801f07:	68 08 60 80 00       	push   $0x806008
+  801f0c:	e8 e5 ea ff ff       	call   8009f6 <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f16:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f1b:	e8 cd fe ff ff       	call   801ded <fsipc>
+}
+  801f20:	c9                   	leave
+  801f21:	c3                   	ret
+
+00801f22 <devfile_read>:
+{
+  801f22:	55                   	push   %ebp
+  801f23:	89 e5                	mov    %esp,%ebp
+  801f25:	56                   	push   %esi
+  801f26:	53                   	push   %ebx
+  801f27:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f30:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801f35:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f40:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f45:	e8 a3 fe ff ff       	call   801ded <fsipc>
+  801f4a:	89 c3                	mov    %eax,%ebx
+  801f4c:	85 c0                	test   %eax,%eax
+  801f4e:	78 1f                	js     801f6f <devfile_read+0x4d>
+	assert(r <= n);
+  801f50:	39 c6                	cmp    %eax,%esi
+  801f52:	72 24                	jb     801f78 <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801f54:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f59:	7f 33                	jg     801f8e <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f5b:	83 ec 04             	sub    $0x4,%esp
+  801f5e:	50                   	push   %eax
+  801f5f:	68 00 60 80 00       	push   $0x806000
+  801f64:	ff 75 0c             	push   0xc(%ebp)
+  801f67:	e8 8a ea ff ff       	call   8009f6 <memmove>
+	return r;
+  801f6c:	83 c4 10             	add    $0x10,%esp
+}
+  801f6f:	89 d8                	mov    %ebx,%eax
+  801f71:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f74:	5b                   	pop    %ebx
+  801f75:	5e                   	pop    %esi
+  801f76:	5d                   	pop    %ebp
+  801f77:	c3                   	ret
+	assert(r <= n);
+  801f78:	68 08 31 80 00       	push   $0x803108
+  801f7d:	68 0f 31 80 00       	push   $0x80310f
+  801f82:	6a 76                	push   $0x76
+  801f84:	68 24 31 80 00       	push   $0x803124
+  801f89:	e8 bf e1 ff ff       	call   80014d <_panic>
+	assert(r <= PGSIZE);
+  801f8e:	68 2f 31 80 00       	push   $0x80312f
+  801f93:	68 0f 31 80 00       	push   $0x80310f
+  801f98:	6a 77                	push   $0x77
+  801f9a:	68 24 31 80 00       	push   $0x803124
+  801f9f:	e8 a9 e1 ff ff       	call   80014d <_panic>
+
+00801fa4 <open>:
+{
+  801fa4:	55                   	push   %ebp
+  801fa5:	89 e5                	mov    %esp,%ebp
+  801fa7:	56                   	push   %esi
+  801fa8:	53                   	push   %ebx
+  801fa9:	83 ec 1c             	sub    $0x1c,%esp
+  801fac:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801faf:	56                   	push   %esi
+  801fb0:	e8 80 e8 ff ff       	call   800835 <strlen>
+  801fb5:	83 c4 10             	add    $0x10,%esp
+  801fb8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fbd:	7f 6c                	jg     80202b <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801fbf:	83 ec 0c             	sub    $0xc,%esp
+  801fc2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc5:	50                   	push   %eax
+  801fc6:	e8 3a f8 ff ff       	call   801805 <fd_alloc>
+  801fcb:	89 c3                	mov    %eax,%ebx
+  801fcd:	83 c4 10             	add    $0x10,%esp
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 3c                	js     802010 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801fd4:	83 ec 08             	sub    $0x8,%esp
+  801fd7:	56                   	push   %esi
+  801fd8:	68 00 60 80 00       	push   $0x806000
+  801fdd:	e8 8e e8 ff ff       	call   800870 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801fe2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fe5:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fed:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff2:	e8 f6 fd ff ff       	call   801ded <fsipc>
+  801ff7:	89 c3                	mov    %eax,%ebx
+  801ff9:	83 c4 10             	add    $0x10,%esp
+  801ffc:	85 c0                	test   %eax,%eax
+  801ffe:	78 19                	js     802019 <open+0x75>
+	return fd2num(fd);
+  802000:	83 ec 0c             	sub    $0xc,%esp
+  802003:	ff 75 f4             	push   -0xc(%ebp)
+  802006:	e8 d3 f7 ff ff       	call   8017de <fd2num>
+  80200b:	89 c3                	mov    %eax,%ebx
+  80200d:	83 c4 10             	add    $0x10,%esp
+}
+  802010:	89 d8                	mov    %ebx,%eax
+  802012:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802015:	5b                   	pop    %ebx
+  802016:	5e                   	pop    %esi
+  802017:	5d                   	pop    %ebp
+  802018:	c3                   	ret
+		fd_close(fd, 0);
+  802019:	83 ec 08             	sub    $0x8,%esp
+  80201c:	6a 00                	push   $0x0
+  80201e:	ff 75 f4             	push   -0xc(%ebp)
+  802021:	e8 f8 f8 ff ff       	call   80191e <fd_close>
+		return r;
+  802026:	83 c4 10             	add    $0x10,%esp
+  802029:	eb e5                	jmp    802010 <open+0x6c>
+		return -E_BAD_PATH;
+  80202b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802030:	eb de                	jmp    802010 <open+0x6c>
+
+00802032 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802032:	55                   	push   %ebp
+  802033:	89 e5                	mov    %esp,%ebp
+  802035:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80203d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802042:	e8 a6 fd ff ff       	call   801ded <fsipc>
+}
+  802047:	c9                   	leave
+  802048:	c3                   	ret
+
+00802049 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  802049:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  80204d:	7f 01                	jg     802050 <writebuf+0x7>
+  80204f:	c3                   	ret
+{
+  802050:	55                   	push   %ebp
+  802051:	89 e5                	mov    %esp,%ebp
+  802053:	53                   	push   %ebx
+  802054:	83 ec 08             	sub    $0x8,%esp
+  802057:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  802059:	ff 70 04             	push   0x4(%eax)
+  80205c:	8d 40 10             	lea    0x10(%eax),%eax
+  80205f:	50                   	push   %eax
+  802060:	ff 33                	push   (%ebx)
+  802062:	e8 68 fb ff ff       	call   801bcf <write>
+		if (result > 0)
+  802067:	83 c4 10             	add    $0x10,%esp
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	7e 03                	jle    802071 <writebuf+0x28>
+			b->result += result;
+  80206e:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802071:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802074:	74 0d                	je     802083 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  802076:	85 c0                	test   %eax,%eax
+  802078:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207d:	0f 4f c2             	cmovg  %edx,%eax
+  802080:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802083:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802086:	c9                   	leave
+  802087:	c3                   	ret
+
+00802088 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  802088:	55                   	push   %ebp
+  802089:	89 e5                	mov    %esp,%ebp
+  80208b:	53                   	push   %ebx
+  80208c:	83 ec 04             	sub    $0x4,%esp
+  80208f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802092:	8b 53 04             	mov    0x4(%ebx),%edx
+  802095:	8d 42 01             	lea    0x1(%edx),%eax
+  802098:	89 43 04             	mov    %eax,0x4(%ebx)
+  80209b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80209e:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  8020a2:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8020a7:	74 05                	je     8020ae <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  8020a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ac:	c9                   	leave
+  8020ad:	c3                   	ret
+		writebuf(b);
+  8020ae:	89 d8                	mov    %ebx,%eax
+  8020b0:	e8 94 ff ff ff       	call   802049 <writebuf>
+		b->idx = 0;
+  8020b5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8020bc:	eb eb                	jmp    8020a9 <putch+0x21>
+
+008020be <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8020be:	55                   	push   %ebp
+  8020bf:	89 e5                	mov    %esp,%ebp
+  8020c1:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  8020c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ca:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  8020d0:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8020d7:	00 00 00 
+	b.result = 0;
+  8020da:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8020e1:	00 00 00 
+	b.error = 1;
+  8020e4:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  8020eb:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8020ee:	ff 75 10             	push   0x10(%ebp)
+  8020f1:	ff 75 0c             	push   0xc(%ebp)
+  8020f4:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8020fa:	50                   	push   %eax
+  8020fb:	68 88 20 80 00       	push   $0x802088
+  802100:	e8 01 e2 ff ff       	call   800306 <vprintfmt>
+	if (b.idx > 0)
+  802105:	83 c4 10             	add    $0x10,%esp
+  802108:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80210f:	7f 12                	jg     802123 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  802111:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802117:	85 c0                	test   %eax,%eax
+  802119:	75 06                	jne    802121 <vfprintf+0x63>
+  80211b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802121:	c9                   	leave
+  802122:	c3                   	ret
+		writebuf(&b);
+  802123:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802129:	e8 1b ff ff ff       	call   802049 <writebuf>
+  80212e:	eb e1                	jmp    802111 <vfprintf+0x53>
+
+00802130 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802130:	55                   	push   %ebp
+  802131:	89 e5                	mov    %esp,%ebp
+  802133:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802136:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  802139:	50                   	push   %eax
+  80213a:	ff 75 0c             	push   0xc(%ebp)
+  80213d:	ff 75 08             	push   0x8(%ebp)
+  802140:	e8 79 ff ff ff       	call   8020be <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802145:	c9                   	leave
+  802146:	c3                   	ret
+
+00802147 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802147:	55                   	push   %ebp
+  802148:	89 e5                	mov    %esp,%ebp
+  80214a:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80214d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  802150:	50                   	push   %eax
+  802151:	ff 75 08             	push   0x8(%ebp)
+  802154:	6a 01                	push   $0x1
+  802156:	e8 63 ff ff ff       	call   8020be <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80215b:	c9                   	leave
+  80215c:	c3                   	ret
+
+0080215d <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80215d:	55                   	push   %ebp
+  80215e:	89 e5                	mov    %esp,%ebp
+  802160:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802163:	68 3b 31 80 00       	push   $0x80313b
+  802168:	ff 75 0c             	push   0xc(%ebp)
+  80216b:	e8 00 e7 ff ff       	call   800870 <strcpy>
+	return 0;
+}
+  802170:	b8 00 00 00 00       	mov    $0x0,%eax
+  802175:	c9                   	leave
+  802176:	c3                   	ret
+
+00802177 <devsock_close>:
+{
+  802177:	55                   	push   %ebp
+  802178:	89 e5                	mov    %esp,%ebp
+  80217a:	53                   	push   %ebx
+  80217b:	83 ec 10             	sub    $0x10,%esp
+  80217e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802181:	53                   	push   %ebx
+  802182:	e8 e4 0a 00 00       	call   802c6b <pageref>
+  802187:	89 c2                	mov    %eax,%edx
+  802189:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802191:	83 fa 01             	cmp    $0x1,%edx
+  802194:	74 05                	je     80219b <devsock_close+0x24>
+}
+  802196:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802199:	c9                   	leave
+  80219a:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80219b:	83 ec 0c             	sub    $0xc,%esp
+  80219e:	ff 73 0c             	push   0xc(%ebx)
+  8021a1:	e8 b7 02 00 00       	call   80245d <nsipc_close>
+  8021a6:	83 c4 10             	add    $0x10,%esp
+  8021a9:	eb eb                	jmp    802196 <devsock_close+0x1f>
+
+008021ab <devsock_write>:
+{
+  8021ab:	55                   	push   %ebp
+  8021ac:	89 e5                	mov    %esp,%ebp
+  8021ae:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8021b1:	6a 00                	push   $0x0
+  8021b3:	ff 75 10             	push   0x10(%ebp)
+  8021b6:	ff 75 0c             	push   0xc(%ebp)
+  8021b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bc:	ff 70 0c             	push   0xc(%eax)
+  8021bf:	e8 79 03 00 00       	call   80253d <nsipc_send>
+}
+  8021c4:	c9                   	leave
+  8021c5:	c3                   	ret
+
+008021c6 <devsock_read>:
+{
+  8021c6:	55                   	push   %ebp
+  8021c7:	89 e5                	mov    %esp,%ebp
+  8021c9:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8021cc:	6a 00                	push   $0x0
+  8021ce:	ff 75 10             	push   0x10(%ebp)
+  8021d1:	ff 75 0c             	push   0xc(%ebp)
+  8021d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d7:	ff 70 0c             	push   0xc(%eax)
+  8021da:	e8 ef 02 00 00       	call   8024ce <nsipc_recv>
+}
+  8021df:	c9                   	leave
+  8021e0:	c3                   	ret
+
+008021e1 <fd2sockid>:
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8021e7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8021ea:	52                   	push   %edx
+  8021eb:	50                   	push   %eax
+  8021ec:	e8 6a f6 ff ff       	call   80185b <fd_lookup>
+  8021f1:	83 c4 10             	add    $0x10,%esp
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	78 10                	js     802208 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8021f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021fb:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802201:	39 08                	cmp    %ecx,(%eax)
+  802203:	75 05                	jne    80220a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802205:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802208:	c9                   	leave
+  802209:	c3                   	ret
+		return -E_NOT_SUPP;
+  80220a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80220f:	eb f7                	jmp    802208 <fd2sockid+0x27>
+
+00802211 <alloc_sockfd>:
+{
+  802211:	55                   	push   %ebp
+  802212:	89 e5                	mov    %esp,%ebp
+  802214:	56                   	push   %esi
+  802215:	53                   	push   %ebx
+  802216:	83 ec 1c             	sub    $0x1c,%esp
+  802219:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80221b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80221e:	50                   	push   %eax
+  80221f:	e8 e1 f5 ff ff       	call   801805 <fd_alloc>
+  802224:	89 c3                	mov    %eax,%ebx
+  802226:	83 c4 10             	add    $0x10,%esp
+  802229:	85 c0                	test   %eax,%eax
+  80222b:	78 43                	js     802270 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80222d:	83 ec 04             	sub    $0x4,%esp
+  802230:	68 07 04 00 00       	push   $0x407
+  802235:	ff 75 f4             	push   -0xc(%ebp)
+  802238:	6a 00                	push   $0x0
+  80223a:	e8 29 eb ff ff       	call   800d68 <sys_page_alloc>
+  80223f:	89 c3                	mov    %eax,%ebx
+  802241:	83 c4 10             	add    $0x10,%esp
+  802244:	85 c0                	test   %eax,%eax
+  802246:	78 28                	js     802270 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802248:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802251:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802253:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802256:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80225d:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802260:	83 ec 0c             	sub    $0xc,%esp
+  802263:	50                   	push   %eax
+  802264:	e8 75 f5 ff ff       	call   8017de <fd2num>
+  802269:	89 c3                	mov    %eax,%ebx
+  80226b:	83 c4 10             	add    $0x10,%esp
+  80226e:	eb 0c                	jmp    80227c <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802270:	83 ec 0c             	sub    $0xc,%esp
+  802273:	56                   	push   %esi
+  802274:	e8 e4 01 00 00       	call   80245d <nsipc_close>
+		return r;
+  802279:	83 c4 10             	add    $0x10,%esp
+}
+  80227c:	89 d8                	mov    %ebx,%eax
+  80227e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802281:	5b                   	pop    %ebx
+  802282:	5e                   	pop    %esi
+  802283:	5d                   	pop    %ebp
+  802284:	c3                   	ret
+
+00802285 <accept>:
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80228b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228e:	e8 4e ff ff ff       	call   8021e1 <fd2sockid>
+  802293:	85 c0                	test   %eax,%eax
+  802295:	78 1b                	js     8022b2 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802297:	83 ec 04             	sub    $0x4,%esp
+  80229a:	ff 75 10             	push   0x10(%ebp)
+  80229d:	ff 75 0c             	push   0xc(%ebp)
+  8022a0:	50                   	push   %eax
+  8022a1:	e8 0e 01 00 00       	call   8023b4 <nsipc_accept>
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	78 05                	js     8022b2 <accept+0x2d>
+	return alloc_sockfd(r);
+  8022ad:	e8 5f ff ff ff       	call   802211 <alloc_sockfd>
+}
+  8022b2:	c9                   	leave
+  8022b3:	c3                   	ret
+
+008022b4 <bind>:
+{
+  8022b4:	55                   	push   %ebp
+  8022b5:	89 e5                	mov    %esp,%ebp
+  8022b7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022bd:	e8 1f ff ff ff       	call   8021e1 <fd2sockid>
+  8022c2:	85 c0                	test   %eax,%eax
+  8022c4:	78 12                	js     8022d8 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8022c6:	83 ec 04             	sub    $0x4,%esp
+  8022c9:	ff 75 10             	push   0x10(%ebp)
+  8022cc:	ff 75 0c             	push   0xc(%ebp)
+  8022cf:	50                   	push   %eax
+  8022d0:	e8 31 01 00 00       	call   802406 <nsipc_bind>
+  8022d5:	83 c4 10             	add    $0x10,%esp
+}
+  8022d8:	c9                   	leave
+  8022d9:	c3                   	ret
+
+008022da <shutdown>:
+{
+  8022da:	55                   	push   %ebp
+  8022db:	89 e5                	mov    %esp,%ebp
+  8022dd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8022e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e3:	e8 f9 fe ff ff       	call   8021e1 <fd2sockid>
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	78 0f                	js     8022fb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8022ec:	83 ec 08             	sub    $0x8,%esp
+  8022ef:	ff 75 0c             	push   0xc(%ebp)
+  8022f2:	50                   	push   %eax
+  8022f3:	e8 43 01 00 00       	call   80243b <nsipc_shutdown>
+  8022f8:	83 c4 10             	add    $0x10,%esp
+}
+  8022fb:	c9                   	leave
+  8022fc:	c3                   	ret
+
+008022fd <connect>:
+{
+  8022fd:	55                   	push   %ebp
+  8022fe:	89 e5                	mov    %esp,%ebp
+  802300:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802303:	8b 45 08             	mov    0x8(%ebp),%eax
+  802306:	e8 d6 fe ff ff       	call   8021e1 <fd2sockid>
+  80230b:	85 c0                	test   %eax,%eax
+  80230d:	78 12                	js     802321 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80230f:	83 ec 04             	sub    $0x4,%esp
+  802312:	ff 75 10             	push   0x10(%ebp)
+  802315:	ff 75 0c             	push   0xc(%ebp)
+  802318:	50                   	push   %eax
+  802319:	e8 59 01 00 00       	call   802477 <nsipc_connect>
+  80231e:	83 c4 10             	add    $0x10,%esp
+}
+  802321:	c9                   	leave
+  802322:	c3                   	ret
+
+00802323 <listen>:
+{
+  802323:	55                   	push   %ebp
+  802324:	89 e5                	mov    %esp,%ebp
+  802326:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802329:	8b 45 08             	mov    0x8(%ebp),%eax
+  80232c:	e8 b0 fe ff ff       	call   8021e1 <fd2sockid>
+  802331:	85 c0                	test   %eax,%eax
+  802333:	78 0f                	js     802344 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802335:	83 ec 08             	sub    $0x8,%esp
+  802338:	ff 75 0c             	push   0xc(%ebp)
+  80233b:	50                   	push   %eax
+  80233c:	e8 6b 01 00 00       	call   8024ac <nsipc_listen>
+  802341:	83 c4 10             	add    $0x10,%esp
+}
+  802344:	c9                   	leave
+  802345:	c3                   	ret
+
+00802346 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802346:	55                   	push   %ebp
+  802347:	89 e5                	mov    %esp,%ebp
+  802349:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80234c:	ff 75 10             	push   0x10(%ebp)
+  80234f:	ff 75 0c             	push   0xc(%ebp)
+  802352:	ff 75 08             	push   0x8(%ebp)
+  802355:	e8 41 02 00 00       	call   80259b <nsipc_socket>
+  80235a:	83 c4 10             	add    $0x10,%esp
+  80235d:	85 c0                	test   %eax,%eax
+  80235f:	78 05                	js     802366 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802361:	e8 ab fe ff ff       	call   802211 <alloc_sockfd>
+}
+  802366:	c9                   	leave
+  802367:	c3                   	ret
+
+00802368 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802368:	55                   	push   %ebp
+  802369:	89 e5                	mov    %esp,%ebp
+  80236b:	53                   	push   %ebx
+  80236c:	83 ec 04             	sub    $0x4,%esp
+  80236f:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802371:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  802378:	74 26                	je     8023a0 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80237a:	6a 07                	push   $0x7
+  80237c:	68 00 70 80 00       	push   $0x807000
+  802381:	53                   	push   %ebx
+  802382:	ff 35 04 50 80 00    	push   0x805004
+  802388:	e8 4b 08 00 00       	call   802bd8 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80238d:	83 c4 0c             	add    $0xc,%esp
+  802390:	6a 00                	push   $0x0
+  802392:	6a 00                	push   $0x0
+  802394:	6a 00                	push   $0x0
+  802396:	e8 25 08 00 00       	call   802bc0 <ipc_recv>
+}
+  80239b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80239e:	c9                   	leave
+  80239f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8023a0:	83 ec 0c             	sub    $0xc,%esp
+  8023a3:	6a 02                	push   $0x2
+  8023a5:	e8 82 08 00 00       	call   802c2c <ipc_find_env>
+  8023aa:	a3 04 50 80 00       	mov    %eax,0x805004
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	eb c6                	jmp    80237a <nsipc+0x12>
+
+008023b4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8023b4:	55                   	push   %ebp
+  8023b5:	89 e5                	mov    %esp,%ebp
+  8023b7:	56                   	push   %esi
+  8023b8:	53                   	push   %ebx
+  8023b9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8023bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023bf:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8023c4:	8b 06                	mov    (%esi),%eax
+  8023c6:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8023cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023d0:	e8 93 ff ff ff       	call   802368 <nsipc>
+  8023d5:	89 c3                	mov    %eax,%ebx
+  8023d7:	85 c0                	test   %eax,%eax
+  8023d9:	79 09                	jns    8023e4 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8023db:	89 d8                	mov    %ebx,%eax
+  8023dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	5e                   	pop    %esi
+  8023e2:	5d                   	pop    %ebp
+  8023e3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8023e4:	83 ec 04             	sub    $0x4,%esp
+  8023e7:	ff 35 10 70 80 00    	push   0x807010
+  8023ed:	68 00 70 80 00       	push   $0x807000
+  8023f2:	ff 75 0c             	push   0xc(%ebp)
+  8023f5:	e8 fc e5 ff ff       	call   8009f6 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8023fa:	a1 10 70 80 00       	mov    0x807010,%eax
+  8023ff:	89 06                	mov    %eax,(%esi)
+  802401:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802404:	eb d5                	jmp    8023db <nsipc_accept+0x27>
+
+00802406 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802406:	55                   	push   %ebp
+  802407:	89 e5                	mov    %esp,%ebp
+  802409:	53                   	push   %ebx
+  80240a:	83 ec 08             	sub    $0x8,%esp
+  80240d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802410:	8b 45 08             	mov    0x8(%ebp),%eax
+  802413:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802418:	53                   	push   %ebx
+  802419:	ff 75 0c             	push   0xc(%ebp)
+  80241c:	68 04 70 80 00       	push   $0x807004
+  802421:	e8 d0 e5 ff ff       	call   8009f6 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802426:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80242c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802431:	e8 32 ff ff ff       	call   802368 <nsipc>
+}
+  802436:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+0080243b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80243b:	55                   	push   %ebp
+  80243c:	89 e5                	mov    %esp,%ebp
+  80243e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802441:	8b 45 08             	mov    0x8(%ebp),%eax
+  802444:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  802449:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80244c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  802451:	b8 03 00 00 00       	mov    $0x3,%eax
+  802456:	e8 0d ff ff ff       	call   802368 <nsipc>
+}
+  80245b:	c9                   	leave
+  80245c:	c3                   	ret
+
+0080245d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80245d:	55                   	push   %ebp
+  80245e:	89 e5                	mov    %esp,%ebp
+  802460:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802463:	8b 45 08             	mov    0x8(%ebp),%eax
+  802466:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  80246b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802470:	e8 f3 fe ff ff       	call   802368 <nsipc>
+}
+  802475:	c9                   	leave
+  802476:	c3                   	ret
+
+00802477 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802477:	55                   	push   %ebp
+  802478:	89 e5                	mov    %esp,%ebp
+  80247a:	53                   	push   %ebx
+  80247b:	83 ec 08             	sub    $0x8,%esp
+  80247e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802481:	8b 45 08             	mov    0x8(%ebp),%eax
+  802484:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802489:	53                   	push   %ebx
+  80248a:	ff 75 0c             	push   0xc(%ebp)
+  80248d:	68 04 70 80 00       	push   $0x807004
+  802492:	e8 5f e5 ff ff       	call   8009f6 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802497:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  80249d:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024a2:	e8 c1 fe ff ff       	call   802368 <nsipc>
+}
+  8024a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024aa:	c9                   	leave
+  8024ab:	c3                   	ret
+
+008024ac <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8024ac:	55                   	push   %ebp
+  8024ad:	89 e5                	mov    %esp,%ebp
+  8024af:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8024b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8024ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024bd:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8024c2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8024c7:	e8 9c fe ff ff       	call   802368 <nsipc>
+}
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+
+008024ce <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8024ce:	55                   	push   %ebp
+  8024cf:	89 e5                	mov    %esp,%ebp
+  8024d1:	56                   	push   %esi
+  8024d2:	53                   	push   %ebx
+  8024d3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8024d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d9:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8024de:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8024e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e7:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8024ec:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024f1:	e8 72 fe ff ff       	call   802368 <nsipc>
+  8024f6:	89 c3                	mov    %eax,%ebx
+  8024f8:	85 c0                	test   %eax,%eax
+  8024fa:	78 22                	js     80251e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8024fc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802501:	39 c6                	cmp    %eax,%esi
+  802503:	0f 4e c6             	cmovle %esi,%eax
+  802506:	39 c3                	cmp    %eax,%ebx
+  802508:	7f 1d                	jg     802527 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80250a:	83 ec 04             	sub    $0x4,%esp
+  80250d:	53                   	push   %ebx
+  80250e:	68 00 70 80 00       	push   $0x807000
+  802513:	ff 75 0c             	push   0xc(%ebp)
+  802516:	e8 db e4 ff ff       	call   8009f6 <memmove>
+  80251b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80251e:	89 d8                	mov    %ebx,%eax
+  802520:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802523:	5b                   	pop    %ebx
+  802524:	5e                   	pop    %esi
+  802525:	5d                   	pop    %ebp
+  802526:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802527:	68 47 31 80 00       	push   $0x803147
+  80252c:	68 0f 31 80 00       	push   $0x80310f
+  802531:	6a 62                	push   $0x62
+  802533:	68 5c 31 80 00       	push   $0x80315c
+  802538:	e8 10 dc ff ff       	call   80014d <_panic>
+
+0080253d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80253d:	55                   	push   %ebp
+  80253e:	89 e5                	mov    %esp,%ebp
+  802540:	53                   	push   %ebx
+  802541:	83 ec 04             	sub    $0x4,%esp
+  802544:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802547:	8b 45 08             	mov    0x8(%ebp),%eax
+  80254a:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80254f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802555:	7f 2e                	jg     802585 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802557:	83 ec 04             	sub    $0x4,%esp
+  80255a:	53                   	push   %ebx
+  80255b:	ff 75 0c             	push   0xc(%ebp)
+  80255e:	68 0c 70 80 00       	push   $0x80700c
+  802563:	e8 8e e4 ff ff       	call   8009f6 <memmove>
+	nsipcbuf.send.req_size = size;
+  802568:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80256e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802571:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  802576:	b8 08 00 00 00       	mov    $0x8,%eax
+  80257b:	e8 e8 fd ff ff       	call   802368 <nsipc>
+}
+  802580:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802583:	c9                   	leave
+  802584:	c3                   	ret
+	assert(size < 1600);
+  802585:	68 68 31 80 00       	push   $0x803168
+  80258a:	68 0f 31 80 00       	push   $0x80310f
+  80258f:	6a 6d                	push   $0x6d
+  802591:	68 5c 31 80 00       	push   $0x80315c
+  802596:	e8 b2 db ff ff       	call   80014d <_panic>
+
+0080259b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80259b:	55                   	push   %ebp
+  80259c:	89 e5                	mov    %esp,%ebp
+  80259e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8025a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025a4:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  8025a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025ac:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  8025b1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025b4:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  8025b9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025be:	e8 a5 fd ff ff       	call   802368 <nsipc>
+}
+  8025c3:	c9                   	leave
+  8025c4:	c3                   	ret
+
+008025c5 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025c5:	55                   	push   %ebp
+  8025c6:	89 e5                	mov    %esp,%ebp
+  8025c8:	56                   	push   %esi
+  8025c9:	53                   	push   %ebx
+  8025ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8025cd:	83 ec 0c             	sub    $0xc,%esp
+  8025d0:	ff 75 08             	push   0x8(%ebp)
+  8025d3:	e8 16 f2 ff ff       	call   8017ee <fd2data>
+  8025d8:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8025da:	83 c4 08             	add    $0x8,%esp
+  8025dd:	68 74 31 80 00       	push   $0x803174
+  8025e2:	53                   	push   %ebx
+  8025e3:	e8 88 e2 ff ff       	call   800870 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8025e8:	8b 46 04             	mov    0x4(%esi),%eax
+  8025eb:	2b 06                	sub    (%esi),%eax
+  8025ed:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  8025f3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025fa:	00 00 00 
+	stat->st_dev = &devpipe;
+  8025fd:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802604:	40 80 00 
+	return 0;
+}
+  802607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80260c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80260f:	5b                   	pop    %ebx
+  802610:	5e                   	pop    %esi
+  802611:	5d                   	pop    %ebp
+  802612:	c3                   	ret
+
+00802613 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802613:	55                   	push   %ebp
+  802614:	89 e5                	mov    %esp,%ebp
+  802616:	53                   	push   %ebx
+  802617:	83 ec 0c             	sub    $0xc,%esp
+  80261a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80261d:	53                   	push   %ebx
+  80261e:	6a 00                	push   $0x0
+  802620:	e8 1e e8 ff ff       	call   800e43 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802625:	89 1c 24             	mov    %ebx,(%esp)
+  802628:	e8 c1 f1 ff ff       	call   8017ee <fd2data>
+  80262d:	83 c4 08             	add    $0x8,%esp
+  802630:	50                   	push   %eax
+  802631:	6a 00                	push   $0x0
+  802633:	e8 0b e8 ff ff       	call   800e43 <sys_page_unmap>
+}
+  802638:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+
+0080263d <_pipeisclosed>:
+{
+  80263d:	55                   	push   %ebp
+  80263e:	89 e5                	mov    %esp,%ebp
+  802640:	57                   	push   %edi
+  802641:	56                   	push   %esi
+  802642:	53                   	push   %ebx
+  802643:	83 ec 1c             	sub    $0x1c,%esp
+  802646:	89 c7                	mov    %eax,%edi
+  802648:	89 d6                	mov    %edx,%esi
+  80264a:	eb 3c                	jmp    802688 <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  80264c:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  80264f:	83 ec 0c             	sub    $0xc,%esp
+  802652:	57                   	push   %edi
+  802653:	e8 13 06 00 00       	call   802c6b <pageref>
+  802658:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80265b:	89 34 24             	mov    %esi,(%esp)
+  80265e:	e8 08 06 00 00       	call   802c6b <pageref>
+  802663:	89 c2                	mov    %eax,%edx
+  802665:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802667:	05 00 00 00 20       	add    $0x20000000,%eax
+  80266c:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  80266f:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802675:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80267a:	76 31                	jbe    8026ad <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  80267c:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  80267f:	39 c3                	cmp    %eax,%ebx
+  802681:	74 76                	je     8026f9 <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802683:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  802686:	74 36                	je     8026be <_pipeisclosed+0x81>
+  802688:	89 e0                	mov    %esp,%eax
+  80268a:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80268f:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802695:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80269a:	77 b0                	ja     80264c <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80269c:	c1 e8 10             	shr    $0x10,%eax
+  80269f:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026a5:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8026ab:	eb 9f                	jmp    80264c <_pipeisclosed+0xf>
+  8026ad:	c1 e8 10             	shr    $0x10,%eax
+  8026b0:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026b6:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  8026bc:	eb be                	jmp    80267c <_pipeisclosed+0x3f>
+  8026be:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026c0:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8026c5:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8026cb:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8026d0:	76 16                	jbe    8026e8 <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8026d2:	8b 42 58             	mov    0x58(%edx),%eax
+  8026d5:	6a 01                	push   $0x1
+  8026d7:	50                   	push   %eax
+  8026d8:	53                   	push   %ebx
+  8026d9:	68 7b 31 80 00       	push   $0x80317b
+  8026de:	e8 45 db ff ff       	call   800228 <cprintf>
+  8026e3:	83 c4 10             	add    $0x10,%esp
+  8026e6:	eb a0                	jmp    802688 <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8026e8:	c1 e8 10             	shr    $0x10,%eax
+  8026eb:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8026f1:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8026f7:	eb d9                	jmp    8026d2 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  8026f9:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8026fc:	0f 94 c0             	sete   %al
+  8026ff:	0f b6 c0             	movzbl %al,%eax
+}
+  802702:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802705:	5b                   	pop    %ebx
+  802706:	5e                   	pop    %esi
+  802707:	5f                   	pop    %edi
+  802708:	5d                   	pop    %ebp
+  802709:	c3                   	ret
+
+0080270a <devpipe_write>:
+{
+  80270a:	55                   	push   %ebp
+  80270b:	89 e5                	mov    %esp,%ebp
+  80270d:	57                   	push   %edi
+  80270e:	56                   	push   %esi
+  80270f:	53                   	push   %ebx
+  802710:	83 ec 28             	sub    $0x28,%esp
+  802713:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802716:	56                   	push   %esi
+  802717:	e8 d2 f0 ff ff       	call   8017ee <fd2data>
+  80271c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	bf 00 00 00 00       	mov    $0x0,%edi
+  802726:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802729:	75 09                	jne    802734 <devpipe_write+0x2a>
+	return i;
+  80272b:	89 f8                	mov    %edi,%eax
+  80272d:	eb 23                	jmp    802752 <devpipe_write+0x48>
+			sys_yield();
+  80272f:	e8 ee e5 ff ff       	call   800d22 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802734:	8b 43 04             	mov    0x4(%ebx),%eax
+  802737:	8b 0b                	mov    (%ebx),%ecx
+  802739:	8d 51 20             	lea    0x20(%ecx),%edx
+  80273c:	39 d0                	cmp    %edx,%eax
+  80273e:	72 1a                	jb     80275a <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802740:	89 da                	mov    %ebx,%edx
+  802742:	89 f0                	mov    %esi,%eax
+  802744:	e8 f4 fe ff ff       	call   80263d <_pipeisclosed>
+  802749:	85 c0                	test   %eax,%eax
+  80274b:	74 e2                	je     80272f <devpipe_write+0x25>
+				return 0;
+  80274d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802755:	5b                   	pop    %ebx
+  802756:	5e                   	pop    %esi
+  802757:	5f                   	pop    %edi
+  802758:	5d                   	pop    %ebp
+  802759:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80275a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80275d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802761:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802764:	89 c2                	mov    %eax,%edx
+  802766:	c1 fa 1f             	sar    $0x1f,%edx
+  802769:	89 d1                	mov    %edx,%ecx
+  80276b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80276e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802771:	83 e2 1f             	and    $0x1f,%edx
+  802774:	29 ca                	sub    %ecx,%edx
+  802776:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80277a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80277e:	83 c0 01             	add    $0x1,%eax
+  802781:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802784:	83 c7 01             	add    $0x1,%edi
+  802787:	eb 9d                	jmp    802726 <devpipe_write+0x1c>
+
+00802789 <devpipe_read>:
+{
+  802789:	55                   	push   %ebp
+  80278a:	89 e5                	mov    %esp,%ebp
+  80278c:	57                   	push   %edi
+  80278d:	56                   	push   %esi
+  80278e:	53                   	push   %ebx
+  80278f:	83 ec 18             	sub    $0x18,%esp
+  802792:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802795:	57                   	push   %edi
+  802796:	e8 53 f0 ff ff       	call   8017ee <fd2data>
+  80279b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80279d:	83 c4 10             	add    $0x10,%esp
+  8027a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8027a8:	75 13                	jne    8027bd <devpipe_read+0x34>
+	return i;
+  8027aa:	89 f0                	mov    %esi,%eax
+  8027ac:	eb 02                	jmp    8027b0 <devpipe_read+0x27>
+				return i;
+  8027ae:	89 f0                	mov    %esi,%eax
+}
+  8027b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027b3:	5b                   	pop    %ebx
+  8027b4:	5e                   	pop    %esi
+  8027b5:	5f                   	pop    %edi
+  8027b6:	5d                   	pop    %ebp
+  8027b7:	c3                   	ret
+			sys_yield();
+  8027b8:	e8 65 e5 ff ff       	call   800d22 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  8027bd:	8b 03                	mov    (%ebx),%eax
+  8027bf:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027c2:	75 18                	jne    8027dc <devpipe_read+0x53>
+			if (i > 0)
+  8027c4:	85 f6                	test   %esi,%esi
+  8027c6:	75 e6                	jne    8027ae <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  8027c8:	89 da                	mov    %ebx,%edx
+  8027ca:	89 f8                	mov    %edi,%eax
+  8027cc:	e8 6c fe ff ff       	call   80263d <_pipeisclosed>
+  8027d1:	85 c0                	test   %eax,%eax
+  8027d3:	74 e3                	je     8027b8 <devpipe_read+0x2f>
+				return 0;
+  8027d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027da:	eb d4                	jmp    8027b0 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027dc:	99                   	cltd
+  8027dd:	c1 ea 1b             	shr    $0x1b,%edx
+  8027e0:	01 d0                	add    %edx,%eax
+  8027e2:	83 e0 1f             	and    $0x1f,%eax
+  8027e5:	29 d0                	sub    %edx,%eax
+  8027e7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8027ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027ef:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8027f2:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8027f5:	83 c6 01             	add    $0x1,%esi
+  8027f8:	eb ab                	jmp    8027a5 <devpipe_read+0x1c>
+
+008027fa <pipe>:
+{
+  8027fa:	55                   	push   %ebp
+  8027fb:	89 e5                	mov    %esp,%ebp
+  8027fd:	56                   	push   %esi
+  8027fe:	53                   	push   %ebx
+  8027ff:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802802:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802805:	50                   	push   %eax
+  802806:	e8 fa ef ff ff       	call   801805 <fd_alloc>
+  80280b:	89 c3                	mov    %eax,%ebx
+  80280d:	83 c4 10             	add    $0x10,%esp
+  802810:	85 c0                	test   %eax,%eax
+  802812:	0f 88 23 01 00 00    	js     80293b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802818:	83 ec 04             	sub    $0x4,%esp
+  80281b:	68 07 04 00 00       	push   $0x407
+  802820:	ff 75 f4             	push   -0xc(%ebp)
+  802823:	6a 00                	push   $0x0
+  802825:	e8 3e e5 ff ff       	call   800d68 <sys_page_alloc>
+  80282a:	89 c3                	mov    %eax,%ebx
+  80282c:	83 c4 10             	add    $0x10,%esp
+  80282f:	85 c0                	test   %eax,%eax
+  802831:	0f 88 04 01 00 00    	js     80293b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802837:	83 ec 0c             	sub    $0xc,%esp
+  80283a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80283d:	50                   	push   %eax
+  80283e:	e8 c2 ef ff ff       	call   801805 <fd_alloc>
+  802843:	89 c3                	mov    %eax,%ebx
+  802845:	83 c4 10             	add    $0x10,%esp
+  802848:	85 c0                	test   %eax,%eax
+  80284a:	0f 88 db 00 00 00    	js     80292b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802850:	83 ec 04             	sub    $0x4,%esp
+  802853:	68 07 04 00 00       	push   $0x407
+  802858:	ff 75 f0             	push   -0x10(%ebp)
+  80285b:	6a 00                	push   $0x0
+  80285d:	e8 06 e5 ff ff       	call   800d68 <sys_page_alloc>
+  802862:	89 c3                	mov    %eax,%ebx
+  802864:	83 c4 10             	add    $0x10,%esp
+  802867:	85 c0                	test   %eax,%eax
+  802869:	0f 88 bc 00 00 00    	js     80292b <pipe+0x131>
+	va = fd2data(fd0);
+  80286f:	83 ec 0c             	sub    $0xc,%esp
+  802872:	ff 75 f4             	push   -0xc(%ebp)
+  802875:	e8 74 ef ff ff       	call   8017ee <fd2data>
+  80287a:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80287c:	83 c4 0c             	add    $0xc,%esp
+  80287f:	68 07 04 00 00       	push   $0x407
+  802884:	50                   	push   %eax
+  802885:	6a 00                	push   $0x0
+  802887:	e8 dc e4 ff ff       	call   800d68 <sys_page_alloc>
+  80288c:	89 c3                	mov    %eax,%ebx
+  80288e:	83 c4 10             	add    $0x10,%esp
+  802891:	85 c0                	test   %eax,%eax
+  802893:	0f 88 82 00 00 00    	js     80291b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802899:	83 ec 0c             	sub    $0xc,%esp
+  80289c:	ff 75 f0             	push   -0x10(%ebp)
+  80289f:	e8 4a ef ff ff       	call   8017ee <fd2data>
+  8028a4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028ab:	50                   	push   %eax
+  8028ac:	6a 00                	push   $0x0
+  8028ae:	56                   	push   %esi
+  8028af:	6a 00                	push   $0x0
+  8028b1:	e8 1f e5 ff ff       	call   800dd5 <sys_page_map>
+  8028b6:	89 c3                	mov    %eax,%ebx
+  8028b8:	83 c4 20             	add    $0x20,%esp
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	78 4e                	js     80290d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8028bf:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  8028c4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028c7:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8028c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028cc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8028d3:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8028d6:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8028d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8028db:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8028e2:	83 ec 0c             	sub    $0xc,%esp
+  8028e5:	ff 75 f4             	push   -0xc(%ebp)
+  8028e8:	e8 f1 ee ff ff       	call   8017de <fd2num>
+  8028ed:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028f0:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8028f2:	83 c4 04             	add    $0x4,%esp
+  8028f5:	ff 75 f0             	push   -0x10(%ebp)
+  8028f8:	e8 e1 ee ff ff       	call   8017de <fd2num>
+  8028fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802900:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802903:	83 c4 10             	add    $0x10,%esp
+  802906:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290b:	eb 2e                	jmp    80293b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80290d:	83 ec 08             	sub    $0x8,%esp
+  802910:	56                   	push   %esi
+  802911:	6a 00                	push   $0x0
+  802913:	e8 2b e5 ff ff       	call   800e43 <sys_page_unmap>
+  802918:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80291b:	83 ec 08             	sub    $0x8,%esp
+  80291e:	ff 75 f0             	push   -0x10(%ebp)
+  802921:	6a 00                	push   $0x0
+  802923:	e8 1b e5 ff ff       	call   800e43 <sys_page_unmap>
+  802928:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80292b:	83 ec 08             	sub    $0x8,%esp
+  80292e:	ff 75 f4             	push   -0xc(%ebp)
+  802931:	6a 00                	push   $0x0
+  802933:	e8 0b e5 ff ff       	call   800e43 <sys_page_unmap>
+  802938:	83 c4 10             	add    $0x10,%esp
+}
+  80293b:	89 d8                	mov    %ebx,%eax
+  80293d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802940:	5b                   	pop    %ebx
+  802941:	5e                   	pop    %esi
+  802942:	5d                   	pop    %ebp
+  802943:	c3                   	ret
+
+00802944 <pipeisclosed>:
+{
+  802944:	55                   	push   %ebp
+  802945:	89 e5                	mov    %esp,%ebp
+  802947:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80294a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80294d:	50                   	push   %eax
+  80294e:	ff 75 08             	push   0x8(%ebp)
+  802951:	e8 05 ef ff ff       	call   80185b <fd_lookup>
+  802956:	83 c4 10             	add    $0x10,%esp
+  802959:	85 c0                	test   %eax,%eax
+  80295b:	78 18                	js     802975 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80295d:	83 ec 0c             	sub    $0xc,%esp
+  802960:	ff 75 f4             	push   -0xc(%ebp)
+  802963:	e8 86 ee ff ff       	call   8017ee <fd2data>
+  802968:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80296a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80296d:	e8 cb fc ff ff       	call   80263d <_pipeisclosed>
+  802972:	83 c4 10             	add    $0x10,%esp
+}
+  802975:	c9                   	leave
+  802976:	c3                   	ret
+
+00802977 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297c:	c3                   	ret
+
+0080297d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80297d:	55                   	push   %ebp
+  80297e:	89 e5                	mov    %esp,%ebp
+  802980:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802983:	68 93 31 80 00       	push   $0x803193
+  802988:	ff 75 0c             	push   0xc(%ebp)
+  80298b:	e8 e0 de ff ff       	call   800870 <strcpy>
+	return 0;
+}
+  802990:	b8 00 00 00 00       	mov    $0x0,%eax
+  802995:	c9                   	leave
+  802996:	c3                   	ret
+
+00802997 <devcons_write>:
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	57                   	push   %edi
+  80299b:	56                   	push   %esi
+  80299c:	53                   	push   %ebx
+  80299d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8029a3:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8029a8:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8029ae:	eb 2e                	jmp    8029de <devcons_write+0x47>
+		m = n - tot;
+  8029b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029b3:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8029b5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8029ba:	39 c3                	cmp    %eax,%ebx
+  8029bc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8029bf:	83 ec 04             	sub    $0x4,%esp
+  8029c2:	53                   	push   %ebx
+  8029c3:	89 f0                	mov    %esi,%eax
+  8029c5:	03 45 0c             	add    0xc(%ebp),%eax
+  8029c8:	50                   	push   %eax
+  8029c9:	57                   	push   %edi
+  8029ca:	e8 27 e0 ff ff       	call   8009f6 <memmove>
+		sys_cputs(buf, m);
+  8029cf:	83 c4 08             	add    $0x8,%esp
+  8029d2:	53                   	push   %ebx
+  8029d3:	57                   	push   %edi
+  8029d4:	e8 10 e2 ff ff       	call   800be9 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8029d9:	01 de                	add    %ebx,%esi
+  8029db:	83 c4 10             	add    $0x10,%esp
+  8029de:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8029e1:	72 cd                	jb     8029b0 <devcons_write+0x19>
+}
+  8029e3:	89 f0                	mov    %esi,%eax
+  8029e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e8:	5b                   	pop    %ebx
+  8029e9:	5e                   	pop    %esi
+  8029ea:	5f                   	pop    %edi
+  8029eb:	5d                   	pop    %ebp
+  8029ec:	c3                   	ret
+
+008029ed <devcons_read>:
+{
+  8029ed:	55                   	push   %ebp
+  8029ee:	89 e5                	mov    %esp,%ebp
+  8029f0:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8029f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029fc:	75 07                	jne    802a05 <devcons_read+0x18>
+  8029fe:	eb 1f                	jmp    802a1f <devcons_read+0x32>
+		sys_yield();
+  802a00:	e8 1d e3 ff ff       	call   800d22 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802a05:	e8 23 e2 ff ff       	call   800c2d <sys_cgetc>
+  802a0a:	85 c0                	test   %eax,%eax
+  802a0c:	74 f2                	je     802a00 <devcons_read+0x13>
+	if (c < 0)
+  802a0e:	78 0f                	js     802a1f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802a10:	83 f8 04             	cmp    $0x4,%eax
+  802a13:	74 0c                	je     802a21 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802a15:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a18:	88 02                	mov    %al,(%edx)
+	return 1;
+  802a1a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a1f:	c9                   	leave
+  802a20:	c3                   	ret
+		return 0;
+  802a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a26:	eb f7                	jmp    802a1f <devcons_read+0x32>
+
+00802a28 <cputchar>:
+{
+  802a28:	55                   	push   %ebp
+  802a29:	89 e5                	mov    %esp,%ebp
+  802a2b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802a2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a31:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802a34:	6a 01                	push   $0x1
+  802a36:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a39:	50                   	push   %eax
+  802a3a:	e8 aa e1 ff ff       	call   800be9 <sys_cputs>
+}
+  802a3f:	83 c4 10             	add    $0x10,%esp
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+
+00802a44 <getchar>:
+{
+  802a44:	55                   	push   %ebp
+  802a45:	89 e5                	mov    %esp,%ebp
+  802a47:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802a4a:	6a 01                	push   $0x1
+  802a4c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a4f:	50                   	push   %eax
+  802a50:	6a 00                	push   $0x0
+  802a52:	e8 8a f0 ff ff       	call   801ae1 <read>
+	if (r < 0)
+  802a57:	83 c4 10             	add    $0x10,%esp
+  802a5a:	85 c0                	test   %eax,%eax
+  802a5c:	78 06                	js     802a64 <getchar+0x20>
+	if (r < 1)
+  802a5e:	74 06                	je     802a66 <getchar+0x22>
+	return c;
+  802a60:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802a64:	c9                   	leave
+  802a65:	c3                   	ret
+		return -E_EOF;
+  802a66:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802a6b:	eb f7                	jmp    802a64 <getchar+0x20>
+
+00802a6d <iscons>:
+{
+  802a6d:	55                   	push   %ebp
+  802a6e:	89 e5                	mov    %esp,%ebp
+  802a70:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a76:	50                   	push   %eax
+  802a77:	ff 75 08             	push   0x8(%ebp)
+  802a7a:	e8 dc ed ff ff       	call   80185b <fd_lookup>
+  802a7f:	83 c4 10             	add    $0x10,%esp
+  802a82:	85 c0                	test   %eax,%eax
+  802a84:	78 11                	js     802a97 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802a86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a89:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a8f:	39 10                	cmp    %edx,(%eax)
+  802a91:	0f 94 c0             	sete   %al
+  802a94:	0f b6 c0             	movzbl %al,%eax
+}
+  802a97:	c9                   	leave
+  802a98:	c3                   	ret
+
+00802a99 <opencons>:
+{
+  802a99:	55                   	push   %ebp
+  802a9a:	89 e5                	mov    %esp,%ebp
+  802a9c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802a9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802aa2:	50                   	push   %eax
+  802aa3:	e8 5d ed ff ff       	call   801805 <fd_alloc>
+  802aa8:	83 c4 10             	add    $0x10,%esp
+  802aab:	85 c0                	test   %eax,%eax
+  802aad:	78 3a                	js     802ae9 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802aaf:	83 ec 04             	sub    $0x4,%esp
+  802ab2:	68 07 04 00 00       	push   $0x407
+  802ab7:	ff 75 f4             	push   -0xc(%ebp)
+  802aba:	6a 00                	push   $0x0
+  802abc:	e8 a7 e2 ff ff       	call   800d68 <sys_page_alloc>
+  802ac1:	83 c4 10             	add    $0x10,%esp
+  802ac4:	85 c0                	test   %eax,%eax
+  802ac6:	78 21                	js     802ae9 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802ac8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802acb:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802ad1:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ad6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802add:	83 ec 0c             	sub    $0xc,%esp
+  802ae0:	50                   	push   %eax
+  802ae1:	e8 f8 ec ff ff       	call   8017de <fd2num>
+  802ae6:	83 c4 10             	add    $0x10,%esp
+}
+  802ae9:	c9                   	leave
+  802aea:	c3                   	ret
+
+00802aeb <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802aeb:	55                   	push   %ebp
+  802aec:	89 e5                	mov    %esp,%ebp
+  802aee:	56                   	push   %esi
+  802aef:	53                   	push   %ebx
+  802af0:	8b 75 08             	mov    0x8(%ebp),%esi
+  802af3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802af6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b00:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802b03:	83 ec 08             	sub    $0x8,%esp
+  802b06:	ff 75 14             	push   0x14(%ebp)
+  802b09:	50                   	push   %eax
+  802b0a:	e8 6a e6 ff ff       	call   801179 <sys_ipc_recv_until>
+  802b0f:	83 c4 10             	add    $0x10,%esp
+  802b12:	85 c0                	test   %eax,%eax
+  802b14:	78 61                	js     802b77 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802b16:	85 f6                	test   %esi,%esi
+  802b18:	74 1c                	je     802b36 <ipc_recv_until+0x4b>
+  802b1a:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b1c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b21:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b27:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b2c:	76 5f                	jbe    802b8d <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802b2e:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802b34:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802b36:	85 db                	test   %ebx,%ebx
+  802b38:	74 1c                	je     802b56 <ipc_recv_until+0x6b>
+  802b3a:	89 e0                	mov    %esp,%eax
+  802b3c:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b41:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b47:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b4c:	76 50                	jbe    802b9e <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802b4e:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802b54:	89 03                	mov    %eax,(%ebx)
+  802b56:	89 e0                	mov    %esp,%eax
+  802b58:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802b5d:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802b63:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802b68:	76 45                	jbe    802baf <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802b6a:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802b70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b73:	5b                   	pop    %ebx
+  802b74:	5e                   	pop    %esi
+  802b75:	5d                   	pop    %ebp
+  802b76:	c3                   	ret
+		if (from_env_store)
+  802b77:	85 f6                	test   %esi,%esi
+  802b79:	74 06                	je     802b81 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802b7b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802b81:	85 db                	test   %ebx,%ebx
+  802b83:	74 eb                	je     802b70 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802b85:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802b8b:	eb e3                	jmp    802b70 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802b8d:	c1 e8 10             	shr    $0x10,%eax
+  802b90:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b96:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b9c:	eb 90                	jmp    802b2e <ipc_recv_until+0x43>
+  802b9e:	c1 e8 10             	shr    $0x10,%eax
+  802ba1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802ba7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802bad:	eb 9f                	jmp    802b4e <ipc_recv_until+0x63>
+  802baf:	c1 e8 10             	shr    $0x10,%eax
+  802bb2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802bb8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802bbe:	eb aa                	jmp    802b6a <ipc_recv_until+0x7f>
+
+00802bc0 <ipc_recv>:
+{
+  802bc0:	55                   	push   %ebp
+  802bc1:	89 e5                	mov    %esp,%ebp
+  802bc3:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802bc6:	6a 00                	push   $0x0
+  802bc8:	ff 75 10             	push   0x10(%ebp)
+  802bcb:	ff 75 0c             	push   0xc(%ebp)
+  802bce:	ff 75 08             	push   0x8(%ebp)
+  802bd1:	e8 15 ff ff ff       	call   802aeb <ipc_recv_until>
+}
+  802bd6:	c9                   	leave
+  802bd7:	c3                   	ret
+
+00802bd8 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	57                   	push   %edi
+  802bdc:	56                   	push   %esi
+  802bdd:	53                   	push   %ebx
+  802bde:	83 ec 0c             	sub    $0xc,%esp
+  802be1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802be4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802be7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802bea:	85 db                	test   %ebx,%ebx
+  802bec:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bf1:	0f 44 d8             	cmove  %eax,%ebx
+  802bf4:	eb 05                	jmp    802bfb <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802bf6:	e8 27 e1 ff ff       	call   800d22 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802bfb:	ff 75 14             	push   0x14(%ebp)
+  802bfe:	53                   	push   %ebx
+  802bff:	56                   	push   %esi
+  802c00:	57                   	push   %edi
+  802c01:	e8 bf e4 ff ff       	call   8010c5 <sys_ipc_try_send>
+  802c06:	83 c4 10             	add    $0x10,%esp
+  802c09:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802c0c:	74 e8                	je     802bf6 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802c0e:	85 c0                	test   %eax,%eax
+  802c10:	78 08                	js     802c1a <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802c12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c15:	5b                   	pop    %ebx
+  802c16:	5e                   	pop    %esi
+  802c17:	5f                   	pop    %edi
+  802c18:	5d                   	pop    %ebp
+  802c19:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802c1a:	50                   	push   %eax
+  802c1b:	68 9f 31 80 00       	push   $0x80319f
+  802c20:	6a 4f                	push   $0x4f
+  802c22:	68 b2 31 80 00       	push   $0x8031b2
+  802c27:	e8 21 d5 ff ff       	call   80014d <_panic>
+
+00802c2c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c2c:	55                   	push   %ebp
+  802c2d:	89 e5                	mov    %esp,%ebp
+  802c2f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802c32:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802c37:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802c3d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c43:	8b 52 50             	mov    0x50(%edx),%edx
+  802c46:	39 ca                	cmp    %ecx,%edx
+  802c48:	74 11                	je     802c5b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802c4a:	83 c0 01             	add    $0x1,%eax
+  802c4d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802c52:	75 e3                	jne    802c37 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802c54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c59:	eb 0e                	jmp    802c69 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802c5b:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802c61:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c66:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c69:	5d                   	pop    %ebp
+  802c6a:	c3                   	ret
+
+00802c6b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c6b:	55                   	push   %ebp
+  802c6c:	89 e5                	mov    %esp,%ebp
+  802c6e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802c71:	89 c2                	mov    %eax,%edx
+  802c73:	c1 ea 16             	shr    $0x16,%edx
+  802c76:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802c82:	f6 c1 01             	test   $0x1,%cl
+  802c85:	74 1a                	je     802ca1 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802c87:	c1 e8 0c             	shr    $0xc,%eax
+  802c8a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802c91:	a8 01                	test   $0x1,%al
+  802c93:	74 0c                	je     802ca1 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802c95:	c1 e8 0c             	shr    $0xc,%eax
+  802c98:	c1 e0 04             	shl    $0x4,%eax
+  802c9b:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802ca1:	89 d0                	mov    %edx,%eax
+  802ca3:	5d                   	pop    %ebp
+  802ca4:	c3                   	ret
@@ -0,0 +1,6530 @@
+
+obj/user/trace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fe 01 00 00       	call   80022f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+	printf("saved %d records of %d CPUs to %s\n", total, cpu, path);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t mask = 0;
+	int i, j;
+
+	if (argc >= 2 && strcmp(argv[1], "on") == 0) {
+  80003f:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800043:	7f 27                	jg     80006c <umain+0x39>
+			mask |= types[j].mask;
+		}
+		sys_trace_ctl(argc == 2 ? TRACE_ALL : mask);
+	} else if (argc == 2 && strcmp(argv[1], "off") == 0)
+		sys_trace_ctl(0);
+	else if (argc == 3 && strcmp(argv[1], "save") == 0)
+  800045:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+  800049:	0f 84 90 00 00 00    	je     8000df <umain+0xac>
+	printf("usage: trace on [syscall|trap|irq|switch|ipc]... | trace off | trace save <file>\n");
+  80004f:	83 ec 0c             	sub    $0xc,%esp
+  800052:	68 c8 2e 80 00       	push   $0x802ec8
+  800057:	e8 91 22 00 00       	call   8022ed <printf>
+	exit();
+  80005c:	e8 78 02 00 00       	call   8002d9 <exit>
+}
+  800061:	83 c4 10             	add    $0x10,%esp
+		save(argv[2]);
+	else
+		usage();
+}
+  800064:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800067:	5b                   	pop    %ebx
+  800068:	5e                   	pop    %esi
+  800069:	5f                   	pop    %edi
+  80006a:	5d                   	pop    %ebp
+  80006b:	c3                   	ret
+	if (argc >= 2 && strcmp(argv[1], "on") == 0) {
+  80006c:	83 ec 08             	sub    $0x8,%esp
+  80006f:	68 60 2e 80 00       	push   $0x802e60
+  800074:	ff 76 04             	push   0x4(%esi)
+  800077:	e8 4b 0a 00 00       	call   800ac7 <strcmp>
+  80007c:	83 c4 10             	add    $0x10,%esp
+  80007f:	85 c0                	test   %eax,%eax
+  800081:	74 2c                	je     8000af <umain+0x7c>
+	} else if (argc == 2 && strcmp(argv[1], "off") == 0)
+  800083:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  800087:	75 bc                	jne    800045 <umain+0x12>
+  800089:	83 ec 08             	sub    $0x8,%esp
+  80008c:	68 63 2e 80 00       	push   $0x802e63
+  800091:	ff 76 04             	push   0x4(%esi)
+  800094:	e8 2e 0a 00 00       	call   800ac7 <strcmp>
+  800099:	83 c4 10             	add    $0x10,%esp
+  80009c:	85 c0                	test   %eax,%eax
+  80009e:	75 af                	jne    80004f <umain+0x1c>
+		sys_trace_ctl(0);
+  8000a0:	83 ec 0c             	sub    $0xc,%esp
+  8000a3:	6a 00                	push   $0x0
+  8000a5:	e8 94 15 00 00       	call   80163e <sys_trace_ctl>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+  8000ad:	eb b5                	jmp    800064 <umain+0x31>
+		for (i = 2; i < argc; i++) {
+  8000af:	bf 02 00 00 00       	mov    $0x2,%edi
+	uint32_t mask = 0;
+  8000b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8000bc:	89 ca                	mov    %ecx,%edx
+  8000be:	e9 22 01 00 00       	jmp    8001e5 <umain+0x1b2>
+		sys_trace_ctl(argc == 2 ? TRACE_ALL : mask);
+  8000c3:	89 d1                	mov    %edx,%ecx
+  8000c5:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8000c9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8000ce:	0f 44 c8             	cmove  %eax,%ecx
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	51                   	push   %ecx
+  8000d5:	e8 64 15 00 00       	call   80163e <sys_trace_ctl>
+  8000da:	83 c4 10             	add    $0x10,%esp
+  8000dd:	eb 85                	jmp    800064 <umain+0x31>
+	else if (argc == 3 && strcmp(argv[1], "save") == 0)
+  8000df:	83 ec 08             	sub    $0x8,%esp
+  8000e2:	68 67 2e 80 00       	push   $0x802e67
+  8000e7:	ff 76 04             	push   0x4(%esi)
+  8000ea:	e8 d8 09 00 00       	call   800ac7 <strcmp>
+  8000ef:	89 c7                	mov    %eax,%edi
+  8000f1:	83 c4 10             	add    $0x10,%esp
+  8000f4:	85 c0                	test   %eax,%eax
+  8000f6:	0f 85 53 ff ff ff    	jne    80004f <umain+0x1c>
+		save(argv[2]);
+  8000fc:	8b 76 08             	mov    0x8(%esi),%esi
+	if ((fd = open(path, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  8000ff:	83 ec 08             	sub    $0x8,%esp
+  800102:	68 01 03 00 00       	push   $0x301
+  800107:	56                   	push   %esi
+  800108:	e8 3d 20 00 00       	call   80214a <open>
+  80010d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800110:	83 c4 10             	add    $0x10,%esp
+  800113:	85 c0                	test   %eax,%eax
+  800115:	78 18                	js     80012f <umain+0xfc>
+	mask = sys_trace_ctl(0);
+  800117:	83 ec 0c             	sub    $0xc,%esp
+  80011a:	6a 00                	push   $0x0
+  80011c:	e8 1d 15 00 00       	call   80163e <sys_trace_ctl>
+	for (cpu = 0; (n = sys_trace_read(cpu, records, NRECORDS)) >= 0; cpu++) {
+  800121:	83 c4 10             	add    $0x10,%esp
+	int fd, cpu, n, r, total = 0;
+  800124:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800127:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  80012a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	for (cpu = 0; (n = sys_trace_read(cpu, records, NRECORDS)) >= 0; cpu++) {
+  80012d:	eb 1d                	jmp    80014c <umain+0x119>
+		printf("open %s: %e\n", path, fd);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	50                   	push   %eax
+  800133:	56                   	push   %esi
+  800134:	68 6c 2e 80 00       	push   $0x802e6c
+  800139:	e8 af 21 00 00       	call   8022ed <printf>
+		return;
+  80013e:	83 c4 10             	add    $0x10,%esp
+  800141:	e9 1e ff ff ff       	jmp    800064 <umain+0x31>
+		total += n;
+  800146:	01 5d e0             	add    %ebx,-0x20(%ebp)
+	for (cpu = 0; (n = sys_trace_read(cpu, records, NRECORDS)) >= 0; cpu++) {
+  800149:	83 c7 01             	add    $0x1,%edi
+  80014c:	83 ec 04             	sub    $0x4,%esp
+  80014f:	68 00 04 00 00       	push   $0x400
+  800154:	68 00 50 80 00       	push   $0x805000
+  800159:	57                   	push   %edi
+  80015a:	e8 27 15 00 00       	call   801686 <sys_trace_read>
+  80015f:	89 c3                	mov    %eax,%ebx
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	85 c0                	test   %eax,%eax
+  800166:	78 3f                	js     8001a7 <umain+0x174>
+		r = write(fd, records, n * sizeof(records[0]));
+  800168:	6b f3 1c             	imul   $0x1c,%ebx,%esi
+  80016b:	83 ec 04             	sub    $0x4,%esp
+  80016e:	56                   	push   %esi
+  80016f:	68 00 50 80 00       	push   $0x805000
+  800174:	ff 75 e4             	push   -0x1c(%ebp)
+  800177:	e8 f9 1b 00 00       	call   801d75 <write>
+		if (r != n * sizeof(records[0])) {
+  80017c:	83 c4 10             	add    $0x10,%esp
+  80017f:	39 c6                	cmp    %eax,%esi
+  800181:	74 c3                	je     800146 <umain+0x113>
+			printf("write %s: %e\n", path, r < 0 ? r : -E_NO_DISK);
+  800183:	8b 75 dc             	mov    -0x24(%ebp),%esi
+  800186:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	ba f7 ff ff ff       	mov    $0xfffffff7,%edx
+  800190:	0f 49 c2             	cmovns %edx,%eax
+  800193:	83 ec 04             	sub    $0x4,%esp
+  800196:	50                   	push   %eax
+  800197:	56                   	push   %esi
+  800198:	68 79 2e 80 00       	push   $0x802e79
+  80019d:	e8 4b 21 00 00       	call   8022ed <printf>
+			break;
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	eb 06                	jmp    8001ad <umain+0x17a>
+  8001a7:	8b 75 dc             	mov    -0x24(%ebp),%esi
+  8001aa:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+	sys_trace_ctl(mask);
+  8001ad:	83 ec 0c             	sub    $0xc,%esp
+  8001b0:	53                   	push   %ebx
+  8001b1:	e8 88 14 00 00       	call   80163e <sys_trace_ctl>
+	close(fd);
+  8001b6:	83 c4 04             	add    $0x4,%esp
+  8001b9:	ff 75 e4             	push   -0x1c(%ebp)
+  8001bc:	e8 8a 19 00 00       	call   801b4b <close>
+	printf("saved %d records of %d CPUs to %s\n", total, cpu, path);
+  8001c1:	56                   	push   %esi
+  8001c2:	57                   	push   %edi
+  8001c3:	ff 75 e0             	push   -0x20(%ebp)
+  8001c6:	68 a4 2e 80 00       	push   $0x802ea4
+  8001cb:	e8 1d 21 00 00       	call   8022ed <printf>
+  8001d0:	83 c4 20             	add    $0x20,%esp
+  8001d3:	e9 8c fe ff ff       	jmp    800064 <umain+0x31>
+			mask |= types[j].mask;
+  8001d8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8001db:	0b 14 dd 24 2f 80 00 	or     0x802f24(,%ebx,8),%edx
+		for (i = 2; i < argc; i++) {
+  8001e2:	83 c7 01             	add    $0x1,%edi
+  8001e5:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8001e8:	0f 84 d5 fe ff ff    	je     8000c3 <umain+0x90>
+			for (j = 0; j < NTYPES; j++)
+  8001ee:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8001f1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+				if (strcmp(argv[i], types[j].name) == 0)
+  8001f4:	83 ec 08             	sub    $0x8,%esp
+  8001f7:	ff 34 dd 20 2f 80 00 	push   0x802f20(,%ebx,8)
+  8001fe:	ff 34 be             	push   (%esi,%edi,4)
+  800201:	e8 c1 08 00 00       	call   800ac7 <strcmp>
+  800206:	83 c4 10             	add    $0x10,%esp
+  800209:	85 c0                	test   %eax,%eax
+  80020b:	74 cb                	je     8001d8 <umain+0x1a5>
+			for (j = 0; j < NTYPES; j++)
+  80020d:	83 c3 01             	add    $0x1,%ebx
+  800210:	83 fb 05             	cmp    $0x5,%ebx
+  800213:	75 df                	jne    8001f4 <umain+0x1c1>
+	printf("usage: trace on [syscall|trap|irq|switch|ipc]... | trace off | trace save <file>\n");
+  800215:	83 ec 0c             	sub    $0xc,%esp
+  800218:	68 c8 2e 80 00       	push   $0x802ec8
+  80021d:	e8 cb 20 00 00       	call   8022ed <printf>
+	exit();
+  800222:	e8 b2 00 00 00       	call   8002d9 <exit>
+}
+  800227:	83 c4 10             	add    $0x10,%esp
+  80022a:	e9 35 fe ff ff       	jmp    800064 <umain+0x31>
+
+0080022f <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80022f:	55                   	push   %ebp
+  800230:	89 e5                	mov    %esp,%ebp
+  800232:	57                   	push   %edi
+  800233:	56                   	push   %esi
+  800234:	53                   	push   %ebx
+  800235:	83 ec 0c             	sub    $0xc,%esp
+  800238:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80023b:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80023e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800243:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800245:	c1 ea 0b             	shr    $0xb,%edx
+  800248:	83 f2 01             	xor    $0x1,%edx
+  80024b:	83 e2 01             	and    $0x1,%edx
+  80024e:	88 15 0c c0 80 00    	mov    %dl,0x80c00c
+
+	mainenv = NULL;
+  800254:	c7 05 08 c0 80 00 00 	movl   $0x0,0x80c008
+  80025b:	00 00 00 
+	envid = sys_getenvid();
+  80025e:	e8 1f 0c 00 00       	call   800e82 <sys_getenvid>
+  800263:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80026a:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800270:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800276:	8b 52 48             	mov    0x48(%edx),%edx
+  800279:	39 ca                	cmp    %ecx,%edx
+  80027b:	74 27                	je     8002a4 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80027d:	83 c0 01             	add    $0x1,%eax
+  800280:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800285:	75 e3                	jne    80026a <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800287:	83 3d 08 c0 80 00 00 	cmpl   $0x0,0x80c008
+  80028e:	75 24                	jne    8002b4 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800290:	83 ec 04             	sub    $0x4,%esp
+  800293:	68 48 2f 80 00       	push   $0x802f48
+  800298:	6a 23                	push   $0x23
+  80029a:	68 6b 2f 80 00       	push   $0x802f6b
+  80029f:	e8 4f 00 00 00       	call   8002f3 <_panic>
+			mainenv = &envs[i];
+  8002a4:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8002aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002af:	a3 08 c0 80 00       	mov    %eax,0x80c008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002b4:	85 ff                	test   %edi,%edi
+  8002b6:	7e 07                	jle    8002bf <libmain+0x90>
+		binaryname = argv[0];
+  8002b8:	8b 06                	mov    (%esi),%eax
+  8002ba:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8002bf:	83 ec 08             	sub    $0x8,%esp
+  8002c2:	56                   	push   %esi
+  8002c3:	57                   	push   %edi
+  8002c4:	e8 6a fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8002c9:	e8 0b 00 00 00       	call   8002d9 <exit>
+}
+  8002ce:	83 c4 10             	add    $0x10,%esp
+  8002d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d4:	5b                   	pop    %ebx
+  8002d5:	5e                   	pop    %esi
+  8002d6:	5f                   	pop    %edi
+  8002d7:	5d                   	pop    %ebp
+  8002d8:	c3                   	ret
+
+008002d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002d9:	55                   	push   %ebp
+  8002da:	89 e5                	mov    %esp,%ebp
+  8002dc:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002df:	e8 94 18 00 00       	call   801b78 <close_all>
+	sys_env_destroy(0);
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	6a 00                	push   $0x0
+  8002e9:	e8 2b 0b 00 00       	call   800e19 <sys_env_destroy>
+}
+  8002ee:	83 c4 10             	add    $0x10,%esp
+  8002f1:	c9                   	leave
+  8002f2:	c3                   	ret
+
+008002f3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002f3:	55                   	push   %ebp
+  8002f4:	89 e5                	mov    %esp,%ebp
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002f8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002fb:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800301:	e8 7c 0b 00 00       	call   800e82 <sys_getenvid>
+  800306:	83 ec 0c             	sub    $0xc,%esp
+  800309:	ff 75 0c             	push   0xc(%ebp)
+  80030c:	ff 75 08             	push   0x8(%ebp)
+  80030f:	56                   	push   %esi
+  800310:	50                   	push   %eax
+  800311:	68 84 2f 80 00       	push   $0x802f84
+  800316:	e8 b3 00 00 00       	call   8003ce <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80031b:	83 c4 18             	add    $0x18,%esp
+  80031e:	53                   	push   %ebx
+  80031f:	ff 75 10             	push   0x10(%ebp)
+  800322:	e8 56 00 00 00       	call   80037d <vcprintf>
+	cprintf("\n");
+  800327:	c7 04 24 0c 34 80 00 	movl   $0x80340c,(%esp)
+  80032e:	e8 9b 00 00 00       	call   8003ce <cprintf>
+  800333:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800336:	cc                   	int3
+	while (1)
+  800337:	eb fd                	jmp    800336 <_panic+0x43>
+
+00800339 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800339:	55                   	push   %ebp
+  80033a:	89 e5                	mov    %esp,%ebp
+  80033c:	53                   	push   %ebx
+  80033d:	83 ec 04             	sub    $0x4,%esp
+  800340:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800343:	8b 13                	mov    (%ebx),%edx
+  800345:	8d 42 01             	lea    0x1(%edx),%eax
+  800348:	89 03                	mov    %eax,(%ebx)
+  80034a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80034d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800351:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800356:	74 09                	je     800361 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800358:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80035c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80035f:	c9                   	leave
+  800360:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800361:	83 ec 08             	sub    $0x8,%esp
+  800364:	68 ff 00 00 00       	push   $0xff
+  800369:	8d 43 08             	lea    0x8(%ebx),%eax
+  80036c:	50                   	push   %eax
+  80036d:	e8 1d 0a 00 00       	call   800d8f <sys_cputs>
+		b->idx = 0;
+  800372:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800378:	83 c4 10             	add    $0x10,%esp
+  80037b:	eb db                	jmp    800358 <putch+0x1f>
+
+0080037d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800386:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80038d:	00 00 00 
+	b.cnt = 0;
+  800390:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800397:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80039a:	ff 75 0c             	push   0xc(%ebp)
+  80039d:	ff 75 08             	push   0x8(%ebp)
+  8003a0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003a6:	50                   	push   %eax
+  8003a7:	68 39 03 80 00       	push   $0x800339
+  8003ac:	e8 fb 00 00 00       	call   8004ac <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003b1:	83 c4 08             	add    $0x8,%esp
+  8003b4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003ba:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003c0:	50                   	push   %eax
+  8003c1:	e8 c9 09 00 00       	call   800d8f <sys_cputs>
+
+	return b.cnt;
+}
+  8003c6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003cc:	c9                   	leave
+  8003cd:	c3                   	ret
+
+008003ce <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003d4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003d7:	50                   	push   %eax
+  8003d8:	ff 75 08             	push   0x8(%ebp)
+  8003db:	e8 9d ff ff ff       	call   80037d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003e0:	c9                   	leave
+  8003e1:	c3                   	ret
+
+008003e2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8003e2:	55                   	push   %ebp
+  8003e3:	89 e5                	mov    %esp,%ebp
+  8003e5:	57                   	push   %edi
+  8003e6:	56                   	push   %esi
+  8003e7:	53                   	push   %ebx
+  8003e8:	83 ec 1c             	sub    $0x1c,%esp
+  8003eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ee:	89 d6                	mov    %edx,%esi
+  8003f0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8003f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003f6:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8003f9:	73 0b                	jae    800406 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8003fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003fe:	c1 e7 08             	shl    $0x8,%edi
+  800401:	0b 7d 10             	or     0x10(%ebp),%edi
+  800404:	eb 36                	jmp    80043c <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  800406:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040e:	f7 75 08             	divl   0x8(%ebp)
+  800411:	89 c1                	mov    %eax,%ecx
+  800413:	ff 75 14             	push   0x14(%ebp)
+  800416:	ff 75 10             	push   0x10(%ebp)
+  800419:	83 eb 01             	sub    $0x1,%ebx
+  80041c:	53                   	push   %ebx
+  80041d:	ff 75 08             	push   0x8(%ebp)
+  800420:	89 f2                	mov    %esi,%edx
+  800422:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800425:	e8 b8 ff ff ff       	call   8003e2 <printnum>
+  80042a:	83 c4 10             	add    $0x10,%esp
+  80042d:	eb 14                	jmp    800443 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  80042f:	83 ec 08             	sub    $0x8,%esp
+  800432:	56                   	push   %esi
+  800433:	57                   	push   %edi
+  800434:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800437:	ff d0                	call   *%eax
+  800439:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80043c:	83 eb 01             	sub    $0x1,%ebx
+  80043f:	85 db                	test   %ebx,%ebx
+  800441:	7f ec                	jg     80042f <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800443:	83 ec 08             	sub    $0x8,%esp
+  800446:	56                   	push   %esi
+  800447:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80044a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044f:	f7 75 08             	divl   0x8(%ebp)
+  800452:	0f be 92 a7 2f 80 00 	movsbl 0x802fa7(%edx),%edx
+  800459:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045c:	c1 e0 08             	shl    $0x8,%eax
+  80045f:	09 d0                	or     %edx,%eax
+  800461:	50                   	push   %eax
+  800462:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800465:	ff d0                	call   *%eax
+}
+  800467:	83 c4 10             	add    $0x10,%esp
+  80046a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80046d:	5b                   	pop    %ebx
+  80046e:	5e                   	pop    %esi
+  80046f:	5f                   	pop    %edi
+  800470:	5d                   	pop    %ebp
+  800471:	c3                   	ret
+
+00800472 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800472:	55                   	push   %ebp
+  800473:	89 e5                	mov    %esp,%ebp
+  800475:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800478:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80047c:	8b 10                	mov    (%eax),%edx
+  80047e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800481:	73 0a                	jae    80048d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800483:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800486:	89 08                	mov    %ecx,(%eax)
+  800488:	8b 45 08             	mov    0x8(%ebp),%eax
+  80048b:	88 02                	mov    %al,(%edx)
+}
+  80048d:	5d                   	pop    %ebp
+  80048e:	c3                   	ret
+
+0080048f <printfmt>:
+{
+  80048f:	55                   	push   %ebp
+  800490:	89 e5                	mov    %esp,%ebp
+  800492:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800495:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800498:	50                   	push   %eax
+  800499:	ff 75 10             	push   0x10(%ebp)
+  80049c:	ff 75 0c             	push   0xc(%ebp)
+  80049f:	ff 75 08             	push   0x8(%ebp)
+  8004a2:	e8 05 00 00 00       	call   8004ac <vprintfmt>
+}
+  8004a7:	83 c4 10             	add    $0x10,%esp
+  8004aa:	c9                   	leave
+  8004ab:	c3                   	ret
+
+008004ac <vprintfmt>:
+{
+  8004ac:	55                   	push   %ebp
+  8004ad:	89 e5                	mov    %esp,%ebp
+  8004af:	57                   	push   %edi
+  8004b0:	56                   	push   %esi
+  8004b1:	53                   	push   %ebx
+  8004b2:	83 ec 3c             	sub    $0x3c,%esp
+  8004b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8004b8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  8004bb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004c2:	eb 16                	jmp    8004da <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  8004c4:	83 ec 08             	sub    $0x8,%esp
+  8004c7:	ff 75 0c             	push   0xc(%ebp)
+  8004ca:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004cd:	c1 e2 08             	shl    $0x8,%edx
+  8004d0:	09 d0                	or     %edx,%eax
+  8004d2:	50                   	push   %eax
+  8004d3:	ff d7                	call   *%edi
+  8004d5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004d8:	89 de                	mov    %ebx,%esi
+  8004da:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8004dd:	0f b6 06             	movzbl (%esi),%eax
+  8004e0:	83 f8 25             	cmp    $0x25,%eax
+  8004e3:	74 0c                	je     8004f1 <vprintfmt+0x45>
+			if (ch == '\0')
+  8004e5:	85 c0                	test   %eax,%eax
+  8004e7:	75 db                	jne    8004c4 <vprintfmt+0x18>
+}
+  8004e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ec:	5b                   	pop    %ebx
+  8004ed:	5e                   	pop    %esi
+  8004ee:	5f                   	pop    %edi
+  8004ef:	5d                   	pop    %ebp
+  8004f0:	c3                   	ret
+		padc = ' ';
+  8004f1:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8004f5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004fc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800503:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80050a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80050f:	8d 73 01             	lea    0x1(%ebx),%esi
+  800512:	0f b6 13             	movzbl (%ebx),%edx
+  800515:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800518:	3c 55                	cmp    $0x55,%al
+  80051a:	0f 87 2c 04 00 00    	ja     80094c <vprintfmt+0x4a0>
+  800520:	0f b6 c0             	movzbl %al,%eax
+  800523:	ff 24 85 00 31 80 00 	jmp    *0x803100(,%eax,4)
+  80052a:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  80052c:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800530:	eb dd                	jmp    80050f <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800532:	89 f3                	mov    %esi,%ebx
+  800534:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800538:	eb d5                	jmp    80050f <vprintfmt+0x63>
+  80053a:	0f b6 d2             	movzbl %dl,%edx
+  80053d:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80053f:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800544:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800547:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80054b:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80054e:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800551:	83 fe 09             	cmp    $0x9,%esi
+  800554:	0f 87 8a 00 00 00    	ja     8005e4 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80055a:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80055d:	eb e5                	jmp    800544 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80055f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800562:	8b 00                	mov    (%eax),%eax
+  800564:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800567:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056a:	8d 40 04             	lea    0x4(%eax),%eax
+  80056d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800570:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800572:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800576:	79 97                	jns    80050f <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800578:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80057b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80057e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800585:	eb 88                	jmp    80050f <vprintfmt+0x63>
+			if (width < 0)
+  800587:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80058a:	85 db                	test   %ebx,%ebx
+  80058c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800591:	0f 49 c3             	cmovns %ebx,%eax
+  800594:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800597:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800599:	e9 71 ff ff ff       	jmp    80050f <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80059e:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  8005a0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005a7:	e9 63 ff ff ff       	jmp    80050f <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  8005ac:	8d 73 02             	lea    0x2(%ebx),%esi
+  8005af:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  8005b3:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  8005ba:	3c 67                	cmp    $0x67,%al
+  8005bc:	0f 84 18 ff ff ff    	je     8004da <vprintfmt+0x2e>
+					attrib = 0x04;
+  8005c2:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  8005c9:	3c 72                	cmp    $0x72,%al
+  8005cb:	0f 84 09 ff ff ff    	je     8004da <vprintfmt+0x2e>
+					attrib = 0x00;
+  8005d1:	3c 62                	cmp    $0x62,%al
+  8005d3:	0f 94 c0             	sete   %al
+  8005d6:	0f b6 c0             	movzbl %al,%eax
+  8005d9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8005dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005df:	e9 f6 fe ff ff       	jmp    8004da <vprintfmt+0x2e>
+  8005e4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005e7:	eb 89                	jmp    800572 <vprintfmt+0xc6>
+			lflag++;
+  8005e9:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ec:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8005ee:	e9 1c ff ff ff       	jmp    80050f <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8d 58 04             	lea    0x4(%eax),%ebx
+  8005f9:	83 ec 08             	sub    $0x8,%esp
+  8005fc:	ff 75 0c             	push   0xc(%ebp)
+  8005ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800602:	c1 e0 08             	shl    $0x8,%eax
+  800605:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800608:	0b 01                	or     (%ecx),%eax
+  80060a:	50                   	push   %eax
+  80060b:	ff d7                	call   *%edi
+			break;
+  80060d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  800610:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  800613:	e9 c2 fe ff ff       	jmp    8004da <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  800618:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061b:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  80061e:	8b 10                	mov    (%eax),%edx
+  800620:	89 d0                	mov    %edx,%eax
+  800622:	f7 d8                	neg    %eax
+  800624:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800627:	83 f8 12             	cmp    $0x12,%eax
+  80062a:	7f 25                	jg     800651 <vprintfmt+0x1a5>
+  80062c:	8b 14 85 60 32 80 00 	mov    0x803260(,%eax,4),%edx
+  800633:	85 d2                	test   %edx,%edx
+  800635:	74 1a                	je     800651 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800637:	52                   	push   %edx
+  800638:	68 a1 33 80 00       	push   $0x8033a1
+  80063d:	ff 75 0c             	push   0xc(%ebp)
+  800640:	57                   	push   %edi
+  800641:	e8 49 fe ff ff       	call   80048f <printfmt>
+  800646:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800649:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80064c:	e9 89 fe ff ff       	jmp    8004da <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800651:	50                   	push   %eax
+  800652:	68 bf 2f 80 00       	push   $0x802fbf
+  800657:	ff 75 0c             	push   0xc(%ebp)
+  80065a:	57                   	push   %edi
+  80065b:	e8 2f fe ff ff       	call   80048f <printfmt>
+  800660:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800663:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800666:	e9 6f fe ff ff       	jmp    8004da <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80066b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066e:	83 c0 04             	add    $0x4,%eax
+  800671:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800679:	85 c9                	test   %ecx,%ecx
+  80067b:	b8 b8 2f 80 00       	mov    $0x802fb8,%eax
+  800680:	0f 45 c1             	cmovne %ecx,%eax
+  800683:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800686:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80068a:	7e 06                	jle    800692 <vprintfmt+0x1e6>
+  80068c:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800690:	75 1a                	jne    8006ac <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800692:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800695:	c1 e0 08             	shl    $0x8,%eax
+  800698:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80069b:	83 c8 3f             	or     $0x3f,%eax
+  80069e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006a1:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  8006a4:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006a7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  8006aa:	eb 6d                	jmp    800719 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006ac:	83 ec 08             	sub    $0x8,%esp
+  8006af:	ff 75 d0             	push   -0x30(%ebp)
+  8006b2:	ff 75 c8             	push   -0x38(%ebp)
+  8006b5:	e8 39 03 00 00       	call   8009f3 <strnlen>
+  8006ba:	89 c2                	mov    %eax,%edx
+  8006bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006bf:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  8006c1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006c4:	c1 e1 08             	shl    $0x8,%ecx
+  8006c7:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8006cb:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006cd:	83 c4 10             	add    $0x10,%esp
+  8006d0:	89 c3                	mov    %eax,%ebx
+  8006d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006d5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8006d8:	89 ce                	mov    %ecx,%esi
+  8006da:	eb 0f                	jmp    8006eb <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8006dc:	83 ec 08             	sub    $0x8,%esp
+  8006df:	ff 75 0c             	push   0xc(%ebp)
+  8006e2:	56                   	push   %esi
+  8006e3:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006e5:	83 eb 01             	sub    $0x1,%ebx
+  8006e8:	83 c4 10             	add    $0x10,%esp
+  8006eb:	85 db                	test   %ebx,%ebx
+  8006ed:	7f ed                	jg     8006dc <vprintfmt+0x230>
+  8006ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8006f5:	85 c0                	test   %eax,%eax
+  8006f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006fc:	0f 49 d0             	cmovns %eax,%edx
+  8006ff:	29 d0                	sub    %edx,%eax
+  800701:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800704:	eb 8c                	jmp    800692 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	ff 75 0c             	push   0xc(%ebp)
+  80070c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80070f:	09 c2                	or     %eax,%edx
+  800711:	52                   	push   %edx
+  800712:	ff d7                	call   *%edi
+  800714:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800717:	89 d9                	mov    %ebx,%ecx
+  800719:	8d 59 01             	lea    0x1(%ecx),%ebx
+  80071c:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  800720:	0f be d0             	movsbl %al,%edx
+  800723:	85 d2                	test   %edx,%edx
+  800725:	74 2a                	je     800751 <vprintfmt+0x2a5>
+  800727:	85 f6                	test   %esi,%esi
+  800729:	78 05                	js     800730 <vprintfmt+0x284>
+  80072b:	83 ee 01             	sub    $0x1,%esi
+  80072e:	78 3b                	js     80076b <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800730:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800734:	74 d0                	je     800706 <vprintfmt+0x25a>
+  800736:	0f be c0             	movsbl %al,%eax
+  800739:	83 e8 20             	sub    $0x20,%eax
+  80073c:	83 f8 5e             	cmp    $0x5e,%eax
+  80073f:	76 c5                	jbe    800706 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800741:	83 ec 08             	sub    $0x8,%esp
+  800744:	ff 75 0c             	push   0xc(%ebp)
+  800747:	ff 75 cc             	push   -0x34(%ebp)
+  80074a:	ff d7                	call   *%edi
+  80074c:	83 c4 10             	add    $0x10,%esp
+  80074f:	eb c6                	jmp    800717 <vprintfmt+0x26b>
+  800751:	8b 75 10             	mov    0x10(%ebp),%esi
+  800754:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800757:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80075a:	01 c3                	add    %eax,%ebx
+  80075c:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80075e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800761:	83 c8 20             	or     $0x20,%eax
+  800764:	89 75 10             	mov    %esi,0x10(%ebp)
+  800767:	89 c6                	mov    %eax,%esi
+  800769:	eb 14                	jmp    80077f <vprintfmt+0x2d3>
+  80076b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80076e:	eb e4                	jmp    800754 <vprintfmt+0x2a8>
+  800770:	83 ec 08             	sub    $0x8,%esp
+  800773:	ff 75 0c             	push   0xc(%ebp)
+  800776:	56                   	push   %esi
+  800777:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800779:	83 eb 01             	sub    $0x1,%ebx
+  80077c:	83 c4 10             	add    $0x10,%esp
+  80077f:	85 db                	test   %ebx,%ebx
+  800781:	7f ed                	jg     800770 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800783:	8b 75 10             	mov    0x10(%ebp),%esi
+  800786:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078c:	e9 49 fd ff ff       	jmp    8004da <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800791:	83 f9 01             	cmp    $0x1,%ecx
+  800794:	7f 1f                	jg     8007b5 <vprintfmt+0x309>
+	else if (lflag)
+  800796:	85 c9                	test   %ecx,%ecx
+  800798:	74 69                	je     800803 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8b 00                	mov    (%eax),%eax
+  80079f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a2:	89 c1                	mov    %eax,%ecx
+  8007a4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007a7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b3:	eb 17                	jmp    8007cc <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 50 04             	mov    0x4(%eax),%edx
+  8007bb:	8b 00                	mov    (%eax),%eax
+  8007bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007c0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c9:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007cc:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007cf:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8007d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8007d7:	85 db                	test   %ebx,%ebx
+  8007d9:	0f 89 f6 00 00 00    	jns    8008d5 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	ff 75 0c             	push   0xc(%ebp)
+  8007e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8007e8:	c1 e0 08             	shl    $0x8,%eax
+  8007eb:	83 c8 2d             	or     $0x2d,%eax
+  8007ee:	50                   	push   %eax
+  8007ef:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8007f1:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8007f4:	f7 d9                	neg    %ecx
+  8007f6:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8007fe:	e9 d2 00 00 00       	jmp    8008d5 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8b 00                	mov    (%eax),%eax
+  800808:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80080b:	89 c1                	mov    %eax,%ecx
+  80080d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800810:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800813:	8b 45 14             	mov    0x14(%ebp),%eax
+  800816:	8d 40 04             	lea    0x4(%eax),%eax
+  800819:	89 45 14             	mov    %eax,0x14(%ebp)
+  80081c:	eb ae                	jmp    8007cc <vprintfmt+0x320>
+	if (lflag >= 2)
+  80081e:	83 f9 01             	cmp    $0x1,%ecx
+  800821:	7f 19                	jg     80083c <vprintfmt+0x390>
+	else if (lflag)
+  800823:	85 c9                	test   %ecx,%ecx
+  800825:	74 2a                	je     800851 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  800827:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082a:	8b 08                	mov    (%eax),%ecx
+  80082c:	8d 40 04             	lea    0x4(%eax),%eax
+  80082f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800832:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800837:	e9 99 00 00 00       	jmp    8008d5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80083c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083f:	8b 08                	mov    (%eax),%ecx
+  800841:	8d 40 08             	lea    0x8(%eax),%eax
+  800844:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800847:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80084c:	e9 84 00 00 00       	jmp    8008d5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800851:	8b 45 14             	mov    0x14(%ebp),%eax
+  800854:	8b 08                	mov    (%eax),%ecx
+  800856:	8d 40 04             	lea    0x4(%eax),%eax
+  800859:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80085c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800861:	eb 72                	jmp    8008d5 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800863:	83 f9 01             	cmp    $0x1,%ecx
+  800866:	7f 16                	jg     80087e <vprintfmt+0x3d2>
+	else if (lflag)
+  800868:	85 c9                	test   %ecx,%ecx
+  80086a:	74 24                	je     800890 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80086c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086f:	8b 08                	mov    (%eax),%ecx
+  800871:	8d 40 04             	lea    0x4(%eax),%eax
+  800874:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800877:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80087c:	eb 57                	jmp    8008d5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80087e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800881:	8b 08                	mov    (%eax),%ecx
+  800883:	8d 40 08             	lea    0x8(%eax),%eax
+  800886:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800889:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80088e:	eb 45                	jmp    8008d5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800890:	8b 45 14             	mov    0x14(%ebp),%eax
+  800893:	8b 08                	mov    (%eax),%ecx
+  800895:	8d 40 04             	lea    0x4(%eax),%eax
+  800898:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80089b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  8008a0:	eb 33                	jmp    8008d5 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  8008a2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008a5:	c1 e3 08             	shl    $0x8,%ebx
+  8008a8:	83 ec 08             	sub    $0x8,%esp
+  8008ab:	ff 75 0c             	push   0xc(%ebp)
+  8008ae:	89 d8                	mov    %ebx,%eax
+  8008b0:	83 c8 30             	or     $0x30,%eax
+  8008b3:	50                   	push   %eax
+  8008b4:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  8008b6:	83 c4 08             	add    $0x8,%esp
+  8008b9:	ff 75 0c             	push   0xc(%ebp)
+  8008bc:	83 cb 78             	or     $0x78,%ebx
+  8008bf:	53                   	push   %ebx
+  8008c0:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8008c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c5:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  8008c7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008d0:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8008d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8008d8:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8008dc:	52                   	push   %edx
+  8008dd:	ff 75 e0             	push   -0x20(%ebp)
+  8008e0:	50                   	push   %eax
+  8008e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008e4:	89 f8                	mov    %edi,%eax
+  8008e6:	e8 f7 fa ff ff       	call   8003e2 <printnum>
+			break;
+  8008eb:	83 c4 10             	add    $0x10,%esp
+  8008ee:	e9 e7 fb ff ff       	jmp    8004da <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8008f3:	83 f9 01             	cmp    $0x1,%ecx
+  8008f6:	7f 16                	jg     80090e <vprintfmt+0x462>
+	else if (lflag)
+  8008f8:	85 c9                	test   %ecx,%ecx
+  8008fa:	74 24                	je     800920 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8008fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ff:	8b 08                	mov    (%eax),%ecx
+  800901:	8d 40 04             	lea    0x4(%eax),%eax
+  800904:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800907:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  80090c:	eb c7                	jmp    8008d5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80090e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800911:	8b 08                	mov    (%eax),%ecx
+  800913:	8d 40 08             	lea    0x8(%eax),%eax
+  800916:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800919:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  80091e:	eb b5                	jmp    8008d5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800920:	8b 45 14             	mov    0x14(%ebp),%eax
+  800923:	8b 08                	mov    (%eax),%ecx
+  800925:	8d 40 04             	lea    0x4(%eax),%eax
+  800928:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80092b:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800930:	eb a3                	jmp    8008d5 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800932:	83 ec 08             	sub    $0x8,%esp
+  800935:	ff 75 0c             	push   0xc(%ebp)
+  800938:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80093b:	c1 e0 08             	shl    $0x8,%eax
+  80093e:	83 c8 25             	or     $0x25,%eax
+  800941:	50                   	push   %eax
+  800942:	ff d7                	call   *%edi
+			break;
+  800944:	83 c4 10             	add    $0x10,%esp
+  800947:	e9 8e fb ff ff       	jmp    8004da <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80094c:	83 ec 08             	sub    $0x8,%esp
+  80094f:	ff 75 0c             	push   0xc(%ebp)
+  800952:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800955:	c1 e0 08             	shl    $0x8,%eax
+  800958:	83 c8 25             	or     $0x25,%eax
+  80095b:	50                   	push   %eax
+  80095c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80095e:	83 c4 10             	add    $0x10,%esp
+  800961:	89 de                	mov    %ebx,%esi
+  800963:	eb 03                	jmp    800968 <vprintfmt+0x4bc>
+  800965:	83 ee 01             	sub    $0x1,%esi
+  800968:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80096c:	75 f7                	jne    800965 <vprintfmt+0x4b9>
+  80096e:	e9 67 fb ff ff       	jmp    8004da <vprintfmt+0x2e>
+
+00800973 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	83 ec 18             	sub    $0x18,%esp
+  800979:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80097f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800982:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800986:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800989:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800990:	85 c0                	test   %eax,%eax
+  800992:	74 26                	je     8009ba <vsnprintf+0x47>
+  800994:	85 d2                	test   %edx,%edx
+  800996:	7e 22                	jle    8009ba <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800998:	ff 75 14             	push   0x14(%ebp)
+  80099b:	ff 75 10             	push   0x10(%ebp)
+  80099e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009a1:	50                   	push   %eax
+  8009a2:	68 72 04 80 00       	push   $0x800472
+  8009a7:	e8 00 fb ff ff       	call   8004ac <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009af:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009b5:	83 c4 10             	add    $0x10,%esp
+}
+  8009b8:	c9                   	leave
+  8009b9:	c3                   	ret
+		return -E_INVAL;
+  8009ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009bf:	eb f7                	jmp    8009b8 <vsnprintf+0x45>
+
+008009c1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  8009c7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009ca:	50                   	push   %eax
+  8009cb:	ff 75 10             	push   0x10(%ebp)
+  8009ce:	ff 75 0c             	push   0xc(%ebp)
+  8009d1:	ff 75 08             	push   0x8(%ebp)
+  8009d4:	e8 9a ff ff ff       	call   800973 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009d9:	c9                   	leave
+  8009da:	c3                   	ret
+
+008009db <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e6:	eb 03                	jmp    8009eb <strlen+0x10>
+		n++;
+  8009e8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009eb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009ef:	75 f7                	jne    8009e8 <strlen+0xd>
+	return n;
+}
+  8009f1:	5d                   	pop    %ebp
+  8009f2:	c3                   	ret
+
+008009f3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009f3:	55                   	push   %ebp
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a01:	eb 03                	jmp    800a06 <strnlen+0x13>
+		n++;
+  800a03:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a06:	39 d0                	cmp    %edx,%eax
+  800a08:	74 08                	je     800a12 <strnlen+0x1f>
+  800a0a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a0e:	75 f3                	jne    800a03 <strnlen+0x10>
+  800a10:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a12:	89 d0                	mov    %edx,%eax
+  800a14:	5d                   	pop    %ebp
+  800a15:	c3                   	ret
+
+00800a16 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	53                   	push   %ebx
+  800a1a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a25:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a29:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a2c:	83 c0 01             	add    $0x1,%eax
+  800a2f:	84 d2                	test   %dl,%dl
+  800a31:	75 f2                	jne    800a25 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a33:	89 c8                	mov    %ecx,%eax
+  800a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a38:	c9                   	leave
+  800a39:	c3                   	ret
+
+00800a3a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	53                   	push   %ebx
+  800a3e:	83 ec 10             	sub    $0x10,%esp
+  800a41:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a44:	53                   	push   %ebx
+  800a45:	e8 91 ff ff ff       	call   8009db <strlen>
+  800a4a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a4d:	ff 75 0c             	push   0xc(%ebp)
+  800a50:	01 d8                	add    %ebx,%eax
+  800a52:	50                   	push   %eax
+  800a53:	e8 be ff ff ff       	call   800a16 <strcpy>
+	return dst;
+}
+  800a58:	89 d8                	mov    %ebx,%eax
+  800a5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a5d:	c9                   	leave
+  800a5e:	c3                   	ret
+
+00800a5f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a5f:	55                   	push   %ebp
+  800a60:	89 e5                	mov    %esp,%ebp
+  800a62:	56                   	push   %esi
+  800a63:	53                   	push   %ebx
+  800a64:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a67:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a6a:	89 f3                	mov    %esi,%ebx
+  800a6c:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a6f:	89 f0                	mov    %esi,%eax
+  800a71:	eb 0f                	jmp    800a82 <strncpy+0x23>
+		*dst++ = *src;
+  800a73:	83 c0 01             	add    $0x1,%eax
+  800a76:	0f b6 0a             	movzbl (%edx),%ecx
+  800a79:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a7c:	80 f9 01             	cmp    $0x1,%cl
+  800a7f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a82:	39 d8                	cmp    %ebx,%eax
+  800a84:	75 ed                	jne    800a73 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a86:	89 f0                	mov    %esi,%eax
+  800a88:	5b                   	pop    %ebx
+  800a89:	5e                   	pop    %esi
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	56                   	push   %esi
+  800a90:	53                   	push   %ebx
+  800a91:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a97:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a9a:	89 f0                	mov    %esi,%eax
+  800a9c:	85 d2                	test   %edx,%edx
+  800a9e:	74 21                	je     800ac1 <strlcpy+0x35>
+  800aa0:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800aa4:	89 f2                	mov    %esi,%edx
+  800aa6:	eb 09                	jmp    800ab1 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800aa8:	83 c1 01             	add    $0x1,%ecx
+  800aab:	83 c2 01             	add    $0x1,%edx
+  800aae:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800ab1:	39 c2                	cmp    %eax,%edx
+  800ab3:	74 09                	je     800abe <strlcpy+0x32>
+  800ab5:	0f b6 19             	movzbl (%ecx),%ebx
+  800ab8:	84 db                	test   %bl,%bl
+  800aba:	75 ec                	jne    800aa8 <strlcpy+0x1c>
+  800abc:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800abe:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ac1:	29 f0                	sub    %esi,%eax
+}
+  800ac3:	5b                   	pop    %ebx
+  800ac4:	5e                   	pop    %esi
+  800ac5:	5d                   	pop    %ebp
+  800ac6:	c3                   	ret
+
+00800ac7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ac7:	55                   	push   %ebp
+  800ac8:	89 e5                	mov    %esp,%ebp
+  800aca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800acd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ad0:	eb 06                	jmp    800ad8 <strcmp+0x11>
+		p++, q++;
+  800ad2:	83 c1 01             	add    $0x1,%ecx
+  800ad5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ad8:	0f b6 01             	movzbl (%ecx),%eax
+  800adb:	84 c0                	test   %al,%al
+  800add:	74 04                	je     800ae3 <strcmp+0x1c>
+  800adf:	3a 02                	cmp    (%edx),%al
+  800ae1:	74 ef                	je     800ad2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ae3:	0f b6 c0             	movzbl %al,%eax
+  800ae6:	0f b6 12             	movzbl (%edx),%edx
+  800ae9:	29 d0                	sub    %edx,%eax
+}
+  800aeb:	5d                   	pop    %ebp
+  800aec:	c3                   	ret
+
+00800aed <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800aed:	55                   	push   %ebp
+  800aee:	89 e5                	mov    %esp,%ebp
+  800af0:	53                   	push   %ebx
+  800af1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800afa:	eb 09                	jmp    800b05 <strncmp+0x18>
+		n--, p++, q++;
+  800afc:	83 ea 01             	sub    $0x1,%edx
+  800aff:	83 c0 01             	add    $0x1,%eax
+  800b02:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b05:	85 d2                	test   %edx,%edx
+  800b07:	74 18                	je     800b21 <strncmp+0x34>
+  800b09:	0f b6 18             	movzbl (%eax),%ebx
+  800b0c:	84 db                	test   %bl,%bl
+  800b0e:	74 04                	je     800b14 <strncmp+0x27>
+  800b10:	3a 19                	cmp    (%ecx),%bl
+  800b12:	74 e8                	je     800afc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b14:	0f b6 00             	movzbl (%eax),%eax
+  800b17:	0f b6 11             	movzbl (%ecx),%edx
+  800b1a:	29 d0                	sub    %edx,%eax
+}
+  800b1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b1f:	c9                   	leave
+  800b20:	c3                   	ret
+		return 0;
+  800b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b26:	eb f4                	jmp    800b1c <strncmp+0x2f>
+
+00800b28 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b28:	55                   	push   %ebp
+  800b29:	89 e5                	mov    %esp,%ebp
+  800b2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b32:	eb 03                	jmp    800b37 <strchr+0xf>
+  800b34:	83 c0 01             	add    $0x1,%eax
+  800b37:	0f b6 10             	movzbl (%eax),%edx
+  800b3a:	84 d2                	test   %dl,%dl
+  800b3c:	74 06                	je     800b44 <strchr+0x1c>
+		if (*s == c)
+  800b3e:	38 ca                	cmp    %cl,%dl
+  800b40:	75 f2                	jne    800b34 <strchr+0xc>
+  800b42:	eb 05                	jmp    800b49 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b51:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b55:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b58:	38 ca                	cmp    %cl,%dl
+  800b5a:	74 09                	je     800b65 <strfind+0x1a>
+  800b5c:	84 d2                	test   %dl,%dl
+  800b5e:	74 05                	je     800b65 <strfind+0x1a>
+	for (; *s; s++)
+  800b60:	83 c0 01             	add    $0x1,%eax
+  800b63:	eb f0                	jmp    800b55 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b65:	5d                   	pop    %ebp
+  800b66:	c3                   	ret
+
+00800b67 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b67:	55                   	push   %ebp
+  800b68:	89 e5                	mov    %esp,%ebp
+  800b6a:	57                   	push   %edi
+  800b6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b6e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b71:	85 c9                	test   %ecx,%ecx
+  800b73:	74 20                	je     800b95 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b75:	89 f8                	mov    %edi,%eax
+  800b77:	09 c8                	or     %ecx,%eax
+  800b79:	a8 03                	test   $0x3,%al
+  800b7b:	75 12                	jne    800b8f <memset+0x28>
+		c &= 0xFF;
+  800b7d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b81:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b87:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b8a:	fc                   	cld
+  800b8b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b8d:	eb 06                	jmp    800b95 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b92:	fc                   	cld
+  800b93:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b95:	89 f8                	mov    %edi,%eax
+  800b97:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b9a:	c9                   	leave
+  800b9b:	c3                   	ret
+
+00800b9c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b9c:	55                   	push   %ebp
+  800b9d:	89 e5                	mov    %esp,%ebp
+  800b9f:	57                   	push   %edi
+  800ba0:	56                   	push   %esi
+  800ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ba7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800baa:	39 c6                	cmp    %eax,%esi
+  800bac:	73 32                	jae    800be0 <memmove+0x44>
+  800bae:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bb1:	39 d0                	cmp    %edx,%eax
+  800bb3:	73 2b                	jae    800be0 <memmove+0x44>
+		s += n;
+		d += n;
+  800bb5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bb8:	89 d6                	mov    %edx,%esi
+  800bba:	09 fe                	or     %edi,%esi
+  800bbc:	09 ce                	or     %ecx,%esi
+  800bbe:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bc4:	75 0e                	jne    800bd4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bc6:	83 ef 04             	sub    $0x4,%edi
+  800bc9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bcc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bcf:	fd                   	std
+  800bd0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd2:	eb 09                	jmp    800bdd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bd4:	83 ef 01             	sub    $0x1,%edi
+  800bd7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bda:	fd                   	std
+  800bdb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bdd:	fc                   	cld
+  800bde:	eb 1a                	jmp    800bfa <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800be0:	89 f2                	mov    %esi,%edx
+  800be2:	09 c2                	or     %eax,%edx
+  800be4:	09 ca                	or     %ecx,%edx
+  800be6:	f6 c2 03             	test   $0x3,%dl
+  800be9:	75 0a                	jne    800bf5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800beb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bee:	89 c7                	mov    %eax,%edi
+  800bf0:	fc                   	cld
+  800bf1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bf3:	eb 05                	jmp    800bfa <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bf5:	89 c7                	mov    %eax,%edi
+  800bf7:	fc                   	cld
+  800bf8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bfa:	5e                   	pop    %esi
+  800bfb:	5f                   	pop    %edi
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+
+00800bfe <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c04:	ff 75 10             	push   0x10(%ebp)
+  800c07:	ff 75 0c             	push   0xc(%ebp)
+  800c0a:	ff 75 08             	push   0x8(%ebp)
+  800c0d:	e8 8a ff ff ff       	call   800b9c <memmove>
+}
+  800c12:	c9                   	leave
+  800c13:	c3                   	ret
+
+00800c14 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c14:	55                   	push   %ebp
+  800c15:	89 e5                	mov    %esp,%ebp
+  800c17:	56                   	push   %esi
+  800c18:	53                   	push   %ebx
+  800c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c1f:	89 c6                	mov    %eax,%esi
+  800c21:	03 75 10             	add    0x10(%ebp),%esi
+  800c24:	eb 06                	jmp    800c2c <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c26:	83 c0 01             	add    $0x1,%eax
+  800c29:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c2c:	39 f0                	cmp    %esi,%eax
+  800c2e:	74 14                	je     800c44 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c30:	0f b6 08             	movzbl (%eax),%ecx
+  800c33:	0f b6 1a             	movzbl (%edx),%ebx
+  800c36:	38 d9                	cmp    %bl,%cl
+  800c38:	74 ec                	je     800c26 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c3a:	0f b6 c1             	movzbl %cl,%eax
+  800c3d:	0f b6 db             	movzbl %bl,%ebx
+  800c40:	29 d8                	sub    %ebx,%eax
+  800c42:	eb 05                	jmp    800c49 <memcmp+0x35>
+	}
+
+	return 0;
+  800c44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c49:	5b                   	pop    %ebx
+  800c4a:	5e                   	pop    %esi
+  800c4b:	5d                   	pop    %ebp
+  800c4c:	c3                   	ret
+
+00800c4d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c4d:	55                   	push   %ebp
+  800c4e:	89 e5                	mov    %esp,%ebp
+  800c50:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c56:	89 c2                	mov    %eax,%edx
+  800c58:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c5b:	eb 03                	jmp    800c60 <memfind+0x13>
+  800c5d:	83 c0 01             	add    $0x1,%eax
+  800c60:	39 d0                	cmp    %edx,%eax
+  800c62:	73 04                	jae    800c68 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c64:	38 08                	cmp    %cl,(%eax)
+  800c66:	75 f5                	jne    800c5d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+
+00800c6a <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	57                   	push   %edi
+  800c6e:	56                   	push   %esi
+  800c6f:	53                   	push   %ebx
+  800c70:	83 ec 1c             	sub    $0x1c,%esp
+  800c73:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c76:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c79:	eb 03                	jmp    800c7e <strtol+0x14>
+		s++;
+  800c7b:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800c7e:	0f b6 06             	movzbl (%esi),%eax
+  800c81:	3c 20                	cmp    $0x20,%al
+  800c83:	74 f6                	je     800c7b <strtol+0x11>
+  800c85:	3c 09                	cmp    $0x9,%al
+  800c87:	74 f2                	je     800c7b <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c89:	3c 2b                	cmp    $0x2b,%al
+  800c8b:	74 43                	je     800cd0 <strtol+0x66>
+	int neg = 0;
+  800c8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800c92:	3c 2d                	cmp    $0x2d,%al
+  800c94:	74 44                	je     800cda <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c96:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800c9c:	75 0f                	jne    800cad <strtol+0x43>
+  800c9e:	80 3e 30             	cmpb   $0x30,(%esi)
+  800ca1:	74 41                	je     800ce4 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ca3:	85 ff                	test   %edi,%edi
+  800ca5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800caa:	0f 44 f8             	cmove  %eax,%edi
+  800cad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb2:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800cb7:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800cba:	89 fb                	mov    %edi,%ebx
+  800cbc:	c1 fb 1f             	sar    $0x1f,%ebx
+  800cbf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800cc2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800cc5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800cc8:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800ccb:	89 75 08             	mov    %esi,0x8(%ebp)
+  800cce:	eb 67                	jmp    800d37 <strtol+0xcd>
+		s++;
+  800cd0:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800cd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd8:	eb bc                	jmp    800c96 <strtol+0x2c>
+		s++, neg = 1;
+  800cda:	83 c6 01             	add    $0x1,%esi
+  800cdd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800ce2:	eb b2                	jmp    800c96 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ce4:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800ce8:	74 0e                	je     800cf8 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800cea:	85 ff                	test   %edi,%edi
+  800cec:	75 bf                	jne    800cad <strtol+0x43>
+		s++, base = 8;
+  800cee:	83 c6 01             	add    $0x1,%esi
+  800cf1:	bf 08 00 00 00       	mov    $0x8,%edi
+  800cf6:	eb b5                	jmp    800cad <strtol+0x43>
+		s += 2, base = 16;
+  800cf8:	83 c6 02             	add    $0x2,%esi
+  800cfb:	bf 10 00 00 00       	mov    $0x10,%edi
+  800d00:	eb ab                	jmp    800cad <strtol+0x43>
+			dig = *s - '0';
+  800d02:	0f be c9             	movsbl %cl,%ecx
+  800d05:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800d08:	39 f9                	cmp    %edi,%ecx
+  800d0a:	7d 59                	jge    800d65 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800d0c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800d10:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800d13:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d16:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d19:	0f af d8             	imul   %eax,%ebx
+  800d1c:	0f af d7             	imul   %edi,%edx
+  800d1f:	01 d3                	add    %edx,%ebx
+  800d21:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d24:	f7 e7                	mul    %edi
+  800d26:	01 da                	add    %ebx,%edx
+  800d28:	89 cb                	mov    %ecx,%ebx
+  800d2a:	c1 fb 1f             	sar    $0x1f,%ebx
+  800d2d:	01 c8                	add    %ecx,%eax
+  800d2f:	11 da                	adc    %ebx,%edx
+  800d31:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800d34:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800d37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3a:	0f b6 08             	movzbl (%eax),%ecx
+  800d3d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800d40:	80 fb 09             	cmp    $0x9,%bl
+  800d43:	76 bd                	jbe    800d02 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800d45:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800d48:	80 fb 19             	cmp    $0x19,%bl
+  800d4b:	77 08                	ja     800d55 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800d4d:	0f be c9             	movsbl %cl,%ecx
+  800d50:	83 e9 57             	sub    $0x57,%ecx
+  800d53:	eb b3                	jmp    800d08 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d55:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800d58:	80 fb 19             	cmp    $0x19,%bl
+  800d5b:	77 08                	ja     800d65 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800d5d:	0f be c9             	movsbl %cl,%ecx
+  800d60:	83 e9 37             	sub    $0x37,%ecx
+  800d63:	eb a3                	jmp    800d08 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d65:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800d68:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800d6b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800d6e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d71:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d75:	74 05                	je     800d7c <strtol+0x112>
+		*endptr = (char *) s;
+  800d77:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800d7a:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800d7c:	85 c9                	test   %ecx,%ecx
+  800d7e:	74 07                	je     800d87 <strtol+0x11d>
+  800d80:	f7 d8                	neg    %eax
+  800d82:	83 d2 00             	adc    $0x0,%edx
+  800d85:	f7 da                	neg    %edx
+}
+  800d87:	83 c4 1c             	add    $0x1c,%esp
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+
+00800d8f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d95:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  800d9c:	74 18                	je     800db6 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da9:	89 c3                	mov    %eax,%ebx
+  800dab:	89 c7                	mov    %eax,%edi
+  800dad:	89 c6                	mov    %eax,%esi
+  800daf:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5f                   	pop    %edi
+  800db4:	5d                   	pop    %ebp
+  800db5:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc1:	89 c3                	mov    %eax,%ebx
+  800dc3:	89 c7                	mov    %eax,%edi
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	8d 35 d0 0d 80 00    	lea    0x800dd0,%esi
+  800dce:	0f 34                	sysenter
+  800dd0:	5d                   	pop    %ebp
+		goto out;
+  800dd1:	eb de                	jmp    800db1 <sys_cputs+0x22>
+
+00800dd3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	57                   	push   %edi
+  800dd7:	56                   	push   %esi
+  800dd8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800dd9:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  800de0:	74 19                	je     800dfb <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800de2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dec:	89 d1                	mov    %edx,%ecx
+  800dee:	89 d3                	mov    %edx,%ebx
+  800df0:	89 d7                	mov    %edx,%edi
+  800df2:	89 d6                	mov    %edx,%esi
+  800df4:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800df6:	5b                   	pop    %ebx
+  800df7:	5e                   	pop    %esi
+  800df8:	5f                   	pop    %edi
+  800df9:	5d                   	pop    %ebp
+  800dfa:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e00:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e05:	89 d1                	mov    %edx,%ecx
+  800e07:	89 d3                	mov    %edx,%ebx
+  800e09:	89 d7                	mov    %edx,%edi
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	8d 35 16 0e 80 00    	lea    0x800e16,%esi
+  800e14:	0f 34                	sysenter
+  800e16:	5d                   	pop    %ebp
+		goto out;
+  800e17:	eb dd                	jmp    800df6 <sys_cgetc+0x23>
+
+00800e19 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e19:	55                   	push   %ebp
+  800e1a:	89 e5                	mov    %esp,%ebp
+  800e1c:	57                   	push   %edi
+  800e1d:	56                   	push   %esi
+  800e1e:	53                   	push   %ebx
+  800e1f:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800e22:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  800e29:	74 21                	je     800e4c <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800e2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e30:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	89 cb                	mov    %ecx,%ebx
+  800e3a:	89 cf                	mov    %ecx,%edi
+  800e3c:	89 ce                	mov    %ecx,%esi
+  800e3e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e40:	85 c0                	test   %eax,%eax
+  800e42:	7f 27                	jg     800e6b <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e54:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e59:	89 cb                	mov    %ecx,%ebx
+  800e5b:	89 cf                	mov    %ecx,%edi
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	8d 35 68 0e 80 00    	lea    0x800e68,%esi
+  800e66:	0f 34                	sysenter
+  800e68:	5d                   	pop    %ebp
+		goto out;
+  800e69:	eb d5                	jmp    800e40 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6b:	83 ec 0c             	sub    $0xc,%esp
+  800e6e:	50                   	push   %eax
+  800e6f:	6a 03                	push   $0x3
+  800e71:	68 cb 32 80 00       	push   $0x8032cb
+  800e76:	6a 3f                	push   $0x3f
+  800e78:	68 e8 32 80 00       	push   $0x8032e8
+  800e7d:	e8 71 f4 ff ff       	call   8002f3 <_panic>
+
+00800e82 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800e88:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  800e8f:	74 19                	je     800eaa <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e96:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e9b:	89 d1                	mov    %edx,%ecx
+  800e9d:	89 d3                	mov    %edx,%ebx
+  800e9f:	89 d7                	mov    %edx,%edi
+  800ea1:	89 d6                	mov    %edx,%esi
+  800ea3:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eaa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eaf:	b8 02 00 00 00       	mov    $0x2,%eax
+  800eb4:	89 d1                	mov    %edx,%ecx
+  800eb6:	89 d3                	mov    %edx,%ebx
+  800eb8:	89 d7                	mov    %edx,%edi
+  800eba:	55                   	push   %ebp
+  800ebb:	89 e5                	mov    %esp,%ebp
+  800ebd:	8d 35 c5 0e 80 00    	lea    0x800ec5,%esi
+  800ec3:	0f 34                	sysenter
+  800ec5:	5d                   	pop    %ebp
+		goto out;
+  800ec6:	eb dd                	jmp    800ea5 <sys_getenvid+0x23>
+
+00800ec8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ece:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  800ed5:	74 19                	je     800ef0 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800ed7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ee1:	89 d1                	mov    %edx,%ecx
+  800ee3:	89 d3                	mov    %edx,%ebx
+  800ee5:	89 d7                	mov    %edx,%edi
+  800ee7:	89 d6                	mov    %edx,%esi
+  800ee9:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ef0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800efa:	89 d1                	mov    %edx,%ecx
+  800efc:	89 d3                	mov    %edx,%ebx
+  800efe:	89 d7                	mov    %edx,%edi
+  800f00:	55                   	push   %ebp
+  800f01:	89 e5                	mov    %esp,%ebp
+  800f03:	8d 35 0b 0f 80 00    	lea    0x800f0b,%esi
+  800f09:	0f 34                	sysenter
+  800f0b:	5d                   	pop    %ebp
+		goto out;
+  800f0c:	eb dd                	jmp    800eeb <sys_yield+0x23>
+
+00800f0e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	56                   	push   %esi
+  800f13:	53                   	push   %ebx
+  800f14:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f17:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  800f1e:	74 23                	je     800f43 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800f20:	be 00 00 00 00       	mov    $0x0,%esi
+  800f25:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f33:	89 f7                	mov    %esi,%edi
+  800f35:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	7f 29                	jg     800f64 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f49:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f56:	55                   	push   %ebp
+  800f57:	89 e5                	mov    %esp,%ebp
+  800f59:	8d 35 61 0f 80 00    	lea    0x800f61,%esi
+  800f5f:	0f 34                	sysenter
+  800f61:	5d                   	pop    %ebp
+		goto out;
+  800f62:	eb d3                	jmp    800f37 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	50                   	push   %eax
+  800f68:	6a 04                	push   $0x4
+  800f6a:	68 cb 32 80 00       	push   $0x8032cb
+  800f6f:	6a 3f                	push   $0x3f
+  800f71:	68 e8 32 80 00       	push   $0x8032e8
+  800f76:	e8 78 f3 ff ff       	call   8002f3 <_panic>
+
+00800f7b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	57                   	push   %edi
+  800f7f:	56                   	push   %esi
+  800f80:	53                   	push   %ebx
+  800f81:	83 ec 0c             	sub    $0xc,%esp
+  800f84:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800f87:	85 f6                	test   %esi,%esi
+  800f89:	75 09                	jne    800f94 <sys_page_map+0x19>
+  800f8b:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  800f92:	74 1f                	je     800fb3 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800f94:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa7:	85 c0                	test   %eax,%eax
+  800fa9:	7f 27                	jg     800fd2 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	8d 35 cf 0f 80 00    	lea    0x800fcf,%esi
+  800fcd:	0f 34                	sysenter
+  800fcf:	5d                   	pop    %ebp
+		goto out;
+  800fd0:	eb d5                	jmp    800fa7 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd2:	83 ec 0c             	sub    $0xc,%esp
+  800fd5:	50                   	push   %eax
+  800fd6:	6a 05                	push   $0x5
+  800fd8:	68 cb 32 80 00       	push   $0x8032cb
+  800fdd:	6a 3f                	push   $0x3f
+  800fdf:	68 e8 32 80 00       	push   $0x8032e8
+  800fe4:	e8 0a f3 ff ff       	call   8002f3 <_panic>
+
+00800fe9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fe9:	55                   	push   %ebp
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	57                   	push   %edi
+  800fed:	56                   	push   %esi
+  800fee:	53                   	push   %ebx
+  800fef:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ff2:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  800ff9:	74 22                	je     80101d <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800ffb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801000:	b8 06 00 00 00       	mov    $0x6,%eax
+  801005:	8b 55 08             	mov    0x8(%ebp),%edx
+  801008:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100b:	89 df                	mov    %ebx,%edi
+  80100d:	89 de                	mov    %ebx,%esi
+  80100f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801011:	85 c0                	test   %eax,%eax
+  801013:	7f 28                	jg     80103d <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80101d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801022:	8b 55 08             	mov    0x8(%ebp),%edx
+  801025:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801028:	b8 06 00 00 00       	mov    $0x6,%eax
+  80102d:	89 df                	mov    %ebx,%edi
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+  801032:	8d 35 3a 10 80 00    	lea    0x80103a,%esi
+  801038:	0f 34                	sysenter
+  80103a:	5d                   	pop    %ebp
+		goto out;
+  80103b:	eb d4                	jmp    801011 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103d:	83 ec 0c             	sub    $0xc,%esp
+  801040:	50                   	push   %eax
+  801041:	6a 06                	push   $0x6
+  801043:	68 cb 32 80 00       	push   $0x8032cb
+  801048:	6a 3f                	push   $0x3f
+  80104a:	68 e8 32 80 00       	push   $0x8032e8
+  80104f:	e8 9f f2 ff ff       	call   8002f3 <_panic>
+
+00801054 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801054:	55                   	push   %ebp
+  801055:	89 e5                	mov    %esp,%ebp
+  801057:	57                   	push   %edi
+  801058:	56                   	push   %esi
+  801059:	53                   	push   %ebx
+  80105a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80105d:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801064:	74 22                	je     801088 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  801066:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801070:	8b 55 08             	mov    0x8(%ebp),%edx
+  801073:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801076:	89 df                	mov    %ebx,%edi
+  801078:	89 de                	mov    %ebx,%esi
+  80107a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107c:	85 c0                	test   %eax,%eax
+  80107e:	7f 28                	jg     8010a8 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801083:	5b                   	pop    %ebx
+  801084:	5e                   	pop    %esi
+  801085:	5f                   	pop    %edi
+  801086:	5d                   	pop    %ebp
+  801087:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801088:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801093:	b8 08 00 00 00       	mov    $0x8,%eax
+  801098:	89 df                	mov    %ebx,%edi
+  80109a:	55                   	push   %ebp
+  80109b:	89 e5                	mov    %esp,%ebp
+  80109d:	8d 35 a5 10 80 00    	lea    0x8010a5,%esi
+  8010a3:	0f 34                	sysenter
+  8010a5:	5d                   	pop    %ebp
+		goto out;
+  8010a6:	eb d4                	jmp    80107c <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  8010ab:	50                   	push   %eax
+  8010ac:	6a 08                	push   $0x8
+  8010ae:	68 cb 32 80 00       	push   $0x8032cb
+  8010b3:	6a 3f                	push   $0x3f
+  8010b5:	68 e8 32 80 00       	push   $0x8032e8
+  8010ba:	e8 34 f2 ff ff       	call   8002f3 <_panic>
+
+008010bf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	57                   	push   %edi
+  8010c3:	56                   	push   %esi
+  8010c4:	53                   	push   %ebx
+  8010c5:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010c8:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  8010cf:	74 22                	je     8010f3 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  8010d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e1:	89 df                	mov    %ebx,%edi
+  8010e3:	89 de                	mov    %ebx,%esi
+  8010e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e7:	85 c0                	test   %eax,%eax
+  8010e9:	7f 28                	jg     801113 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ee:	5b                   	pop    %ebx
+  8010ef:	5e                   	pop    %esi
+  8010f0:	5f                   	pop    %edi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8010f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fe:	b8 09 00 00 00       	mov    $0x9,%eax
+  801103:	89 df                	mov    %ebx,%edi
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	8d 35 10 11 80 00    	lea    0x801110,%esi
+  80110e:	0f 34                	sysenter
+  801110:	5d                   	pop    %ebp
+		goto out;
+  801111:	eb d4                	jmp    8010e7 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801113:	83 ec 0c             	sub    $0xc,%esp
+  801116:	50                   	push   %eax
+  801117:	6a 09                	push   $0x9
+  801119:	68 cb 32 80 00       	push   $0x8032cb
+  80111e:	6a 3f                	push   $0x3f
+  801120:	68 e8 32 80 00       	push   $0x8032e8
+  801125:	e8 c9 f1 ff ff       	call   8002f3 <_panic>
+
+0080112a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	57                   	push   %edi
+  80112e:	56                   	push   %esi
+  80112f:	53                   	push   %ebx
+  801130:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801133:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  80113a:	74 22                	je     80115e <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80113c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801141:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801146:	8b 55 08             	mov    0x8(%ebp),%edx
+  801149:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114c:	89 df                	mov    %ebx,%edi
+  80114e:	89 de                	mov    %ebx,%esi
+  801150:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801152:	85 c0                	test   %eax,%eax
+  801154:	7f 28                	jg     80117e <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801159:	5b                   	pop    %ebx
+  80115a:	5e                   	pop    %esi
+  80115b:	5f                   	pop    %edi
+  80115c:	5d                   	pop    %ebp
+  80115d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80115e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801163:	8b 55 08             	mov    0x8(%ebp),%edx
+  801166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801169:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80116e:	89 df                	mov    %ebx,%edi
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	8d 35 7b 11 80 00    	lea    0x80117b,%esi
+  801179:	0f 34                	sysenter
+  80117b:	5d                   	pop    %ebp
+		goto out;
+  80117c:	eb d4                	jmp    801152 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+  801181:	50                   	push   %eax
+  801182:	6a 0a                	push   $0xa
+  801184:	68 cb 32 80 00       	push   $0x8032cb
+  801189:	6a 3f                	push   $0x3f
+  80118b:	68 e8 32 80 00       	push   $0x8032e8
+  801190:	e8 5e f1 ff ff       	call   8002f3 <_panic>
+
+00801195 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	57                   	push   %edi
+  801199:	56                   	push   %esi
+  80119a:	53                   	push   %ebx
+  80119b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80119e:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  8011a5:	74 22                	je     8011c9 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  8011a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ac:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b7:	89 df                	mov    %ebx,%edi
+  8011b9:	89 de                	mov    %ebx,%esi
+  8011bb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011bd:	85 c0                	test   %eax,%eax
+  8011bf:	7f 28                	jg     8011e9 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  8011c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c4:	5b                   	pop    %ebx
+  8011c5:	5e                   	pop    %esi
+  8011c6:	5f                   	pop    %edi
+  8011c7:	5d                   	pop    %ebp
+  8011c8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011d9:	89 df                	mov    %ebx,%edi
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	8d 35 e6 11 80 00    	lea    0x8011e6,%esi
+  8011e4:	0f 34                	sysenter
+  8011e6:	5d                   	pop    %ebp
+		goto out;
+  8011e7:	eb d4                	jmp    8011bd <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e9:	83 ec 0c             	sub    $0xc,%esp
+  8011ec:	50                   	push   %eax
+  8011ed:	6a 17                	push   $0x17
+  8011ef:	68 cb 32 80 00       	push   $0x8032cb
+  8011f4:	6a 3f                	push   $0x3f
+  8011f6:	68 e8 32 80 00       	push   $0x8032e8
+  8011fb:	e8 f3 f0 ff ff       	call   8002f3 <_panic>
+
+00801200 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	57                   	push   %edi
+  801204:	56                   	push   %esi
+  801205:	53                   	push   %ebx
+  801206:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801209:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801210:	74 22                	je     801234 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  801212:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801217:	b8 18 00 00 00       	mov    $0x18,%eax
+  80121c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801222:	89 df                	mov    %ebx,%edi
+  801224:	89 de                	mov    %ebx,%esi
+  801226:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801228:	85 c0                	test   %eax,%eax
+  80122a:	7f 28                	jg     801254 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  80122c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122f:	5b                   	pop    %ebx
+  801230:	5e                   	pop    %esi
+  801231:	5f                   	pop    %edi
+  801232:	5d                   	pop    %ebp
+  801233:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801234:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801244:	89 df                	mov    %ebx,%edi
+  801246:	55                   	push   %ebp
+  801247:	89 e5                	mov    %esp,%ebp
+  801249:	8d 35 51 12 80 00    	lea    0x801251,%esi
+  80124f:	0f 34                	sysenter
+  801251:	5d                   	pop    %ebp
+		goto out;
+  801252:	eb d4                	jmp    801228 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801254:	83 ec 0c             	sub    $0xc,%esp
+  801257:	50                   	push   %eax
+  801258:	6a 18                	push   $0x18
+  80125a:	68 cb 32 80 00       	push   $0x8032cb
+  80125f:	6a 3f                	push   $0x3f
+  801261:	68 e8 32 80 00       	push   $0x8032e8
+  801266:	e8 88 f0 ff ff       	call   8002f3 <_panic>
+
+0080126b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	57                   	push   %edi
+  80126f:	56                   	push   %esi
+  801270:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801271:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801278:	74 1d                	je     801297 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80127a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80127f:	be 00 00 00 00       	mov    $0x0,%esi
+  801284:	8b 55 08             	mov    0x8(%ebp),%edx
+  801287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80128d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801290:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801292:	5b                   	pop    %ebx
+  801293:	5e                   	pop    %esi
+  801294:	5f                   	pop    %edi
+  801295:	5d                   	pop    %ebp
+  801296:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801297:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	8d 35 b3 12 80 00    	lea    0x8012b3,%esi
+  8012b1:	0f 34                	sysenter
+  8012b3:	5d                   	pop    %ebp
+		goto out;
+  8012b4:	eb dc                	jmp    801292 <sys_ipc_try_send+0x27>
+
+008012b6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8012b6:	55                   	push   %ebp
+  8012b7:	89 e5                	mov    %esp,%ebp
+  8012b9:	57                   	push   %edi
+  8012ba:	56                   	push   %esi
+  8012bb:	53                   	push   %ebx
+  8012bc:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8012bf:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  8012c6:	74 21                	je     8012e9 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  8012c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012cd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d5:	89 cb                	mov    %ecx,%ebx
+  8012d7:	89 cf                	mov    %ecx,%edi
+  8012d9:	89 ce                	mov    %ecx,%esi
+  8012db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012dd:	85 c0                	test   %eax,%eax
+  8012df:	7f 27                	jg     801308 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8012e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e4:	5b                   	pop    %ebx
+  8012e5:	5e                   	pop    %esi
+  8012e6:	5f                   	pop    %edi
+  8012e7:	5d                   	pop    %ebp
+  8012e8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012f6:	89 cb                	mov    %ecx,%ebx
+  8012f8:	89 cf                	mov    %ecx,%edi
+  8012fa:	55                   	push   %ebp
+  8012fb:	89 e5                	mov    %esp,%ebp
+  8012fd:	8d 35 05 13 80 00    	lea    0x801305,%esi
+  801303:	0f 34                	sysenter
+  801305:	5d                   	pop    %ebp
+		goto out;
+  801306:	eb d5                	jmp    8012dd <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801308:	83 ec 0c             	sub    $0xc,%esp
+  80130b:	50                   	push   %eax
+  80130c:	6a 0d                	push   $0xd
+  80130e:	68 cb 32 80 00       	push   $0x8032cb
+  801313:	6a 3f                	push   $0x3f
+  801315:	68 e8 32 80 00       	push   $0x8032e8
+  80131a:	e8 d4 ef ff ff       	call   8002f3 <_panic>
+
+0080131f <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  80131f:	55                   	push   %ebp
+  801320:	89 e5                	mov    %esp,%ebp
+  801322:	57                   	push   %edi
+  801323:	56                   	push   %esi
+  801324:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801325:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  80132c:	74 1b                	je     801349 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  80132e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801333:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801338:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80133e:	89 df                	mov    %ebx,%edi
+  801340:	89 de                	mov    %ebx,%esi
+  801342:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801344:	5b                   	pop    %ebx
+  801345:	5e                   	pop    %esi
+  801346:	5f                   	pop    %edi
+  801347:	5d                   	pop    %ebp
+  801348:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801351:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801354:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801359:	89 df                	mov    %ebx,%edi
+  80135b:	55                   	push   %ebp
+  80135c:	89 e5                	mov    %esp,%ebp
+  80135e:	8d 35 66 13 80 00    	lea    0x801366,%esi
+  801364:	0f 34                	sysenter
+  801366:	5d                   	pop    %ebp
+		goto out;
+  801367:	eb db                	jmp    801344 <sys_ipc_recv_until+0x25>
+
+00801369 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	57                   	push   %edi
+  80136d:	56                   	push   %esi
+  80136e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80136f:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801376:	74 19                	je     801391 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801382:	89 d1                	mov    %edx,%ecx
+  801384:	89 d3                	mov    %edx,%ebx
+  801386:	89 d7                	mov    %edx,%edi
+  801388:	89 d6                	mov    %edx,%esi
+  80138a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80138c:	5b                   	pop    %ebx
+  80138d:	5e                   	pop    %esi
+  80138e:	5f                   	pop    %edi
+  80138f:	5d                   	pop    %ebp
+  801390:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801391:	ba 00 00 00 00       	mov    $0x0,%edx
+  801396:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80139b:	89 d1                	mov    %edx,%ecx
+  80139d:	89 d3                	mov    %edx,%ebx
+  80139f:	89 d7                	mov    %edx,%edi
+  8013a1:	55                   	push   %ebp
+  8013a2:	89 e5                	mov    %esp,%ebp
+  8013a4:	8d 35 ac 13 80 00    	lea    0x8013ac,%esi
+  8013aa:	0f 34                	sysenter
+  8013ac:	5d                   	pop    %ebp
+		goto out;
+  8013ad:	eb dd                	jmp    80138c <sys_time_msec+0x23>
+
+008013af <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  8013af:	55                   	push   %ebp
+  8013b0:	89 e5                	mov    %esp,%ebp
+  8013b2:	57                   	push   %edi
+  8013b3:	56                   	push   %esi
+  8013b4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013b5:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  8013bc:	74 1a                	je     8013d8 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  8013be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c3:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cb:	89 cb                	mov    %ecx,%ebx
+  8013cd:	89 cf                	mov    %ecx,%edi
+  8013cf:	89 ce                	mov    %ecx,%esi
+  8013d1:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8013d3:	5b                   	pop    %ebx
+  8013d4:	5e                   	pop    %esi
+  8013d5:	5f                   	pop    %edi
+  8013d6:	5d                   	pop    %ebp
+  8013d7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013e0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013e5:	89 cb                	mov    %ecx,%ebx
+  8013e7:	89 cf                	mov    %ecx,%edi
+  8013e9:	55                   	push   %ebp
+  8013ea:	89 e5                	mov    %esp,%ebp
+  8013ec:	8d 35 f4 13 80 00    	lea    0x8013f4,%esi
+  8013f2:	0f 34                	sysenter
+  8013f4:	5d                   	pop    %ebp
+		goto out;
+  8013f5:	eb dc                	jmp    8013d3 <sys_sleep_until+0x24>
+
+008013f7 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	57                   	push   %edi
+  8013fb:	56                   	push   %esi
+  8013fc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013fd:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801404:	74 1a                	je     801420 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  801406:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80140b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801410:	8b 55 08             	mov    0x8(%ebp),%edx
+  801413:	89 cb                	mov    %ecx,%ebx
+  801415:	89 cf                	mov    %ecx,%edi
+  801417:	89 ce                	mov    %ecx,%esi
+  801419:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  80141b:	5b                   	pop    %ebx
+  80141c:	5e                   	pop    %esi
+  80141d:	5f                   	pop    %edi
+  80141e:	5d                   	pop    %ebp
+  80141f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801420:	8b 55 08             	mov    0x8(%ebp),%edx
+  801423:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801428:	b8 11 00 00 00       	mov    $0x11,%eax
+  80142d:	89 cb                	mov    %ecx,%ebx
+  80142f:	89 cf                	mov    %ecx,%edi
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+  801434:	8d 35 3c 14 80 00    	lea    0x80143c,%esi
+  80143a:	0f 34                	sysenter
+  80143c:	5d                   	pop    %ebp
+		goto out;
+  80143d:	eb dc                	jmp    80141b <sys_env_print_stats+0x24>
+
+0080143f <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  801442:	57                   	push   %edi
+  801443:	56                   	push   %esi
+  801444:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801445:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  80144c:	74 1b                	je     801469 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80144e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801453:	b8 19 00 00 00       	mov    $0x19,%eax
+  801458:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145e:	89 df                	mov    %ebx,%edi
+  801460:	89 de                	mov    %ebx,%esi
+  801462:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801464:	5b                   	pop    %ebx
+  801465:	5e                   	pop    %esi
+  801466:	5f                   	pop    %edi
+  801467:	5d                   	pop    %ebp
+  801468:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801469:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801471:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801474:	b8 19 00 00 00       	mov    $0x19,%eax
+  801479:	89 df                	mov    %ebx,%edi
+  80147b:	55                   	push   %ebp
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	8d 35 86 14 80 00    	lea    0x801486,%esi
+  801484:	0f 34                	sysenter
+  801486:	5d                   	pop    %ebp
+		goto out;
+  801487:	eb db                	jmp    801464 <sys_perf+0x25>
+
+00801489 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801489:	55                   	push   %ebp
+  80148a:	89 e5                	mov    %esp,%ebp
+  80148c:	57                   	push   %edi
+  80148d:	56                   	push   %esi
+  80148e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80148f:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801496:	74 19                	je     8014b1 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801498:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014a2:	89 d1                	mov    %edx,%ecx
+  8014a4:	89 d3                	mov    %edx,%ebx
+  8014a6:	89 d7                	mov    %edx,%edi
+  8014a8:	89 d6                	mov    %edx,%esi
+  8014aa:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8014ac:	5b                   	pop    %ebx
+  8014ad:	5e                   	pop    %esi
+  8014ae:	5f                   	pop    %edi
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014bb:	89 d1                	mov    %edx,%ecx
+  8014bd:	89 d3                	mov    %edx,%ebx
+  8014bf:	89 d7                	mov    %edx,%edi
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	8d 35 cc 14 80 00    	lea    0x8014cc,%esi
+  8014ca:	0f 34                	sysenter
+  8014cc:	5d                   	pop    %ebp
+		goto out;
+  8014cd:	eb dd                	jmp    8014ac <sys_fork+0x23>
+
+008014cf <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	57                   	push   %edi
+  8014d3:	56                   	push   %esi
+  8014d4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014d5:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  8014dc:	74 1c                	je     8014fa <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8014de:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8014e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014f1:	89 f7                	mov    %esi,%edi
+  8014f3:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8014f5:	5b                   	pop    %ebx
+  8014f6:	5e                   	pop    %esi
+  8014f7:	5f                   	pop    %edi
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801500:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  801505:	bf 00 00 00 00       	mov    $0x0,%edi
+  80150a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80150d:	55                   	push   %ebp
+  80150e:	89 e5                	mov    %esp,%ebp
+  801510:	8d 35 18 15 80 00    	lea    0x801518,%esi
+  801516:	0f 34                	sysenter
+  801518:	5d                   	pop    %ebp
+		goto out;
+  801519:	eb da                	jmp    8014f5 <sys_thread_create+0x26>
+
+0080151b <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	57                   	push   %edi
+  80151f:	56                   	push   %esi
+  801520:	53                   	push   %ebx
+  801521:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801524:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  80152b:	74 24                	je     801551 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  80152d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801532:	be 00 00 00 00       	mov    $0x0,%esi
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80153d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801540:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801543:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801545:	85 c0                	test   %eax,%eax
+  801547:	7f 27                	jg     801570 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154c:	5b                   	pop    %ebx
+  80154d:	5e                   	pop    %esi
+  80154e:	5f                   	pop    %edi
+  80154f:	5d                   	pop    %ebp
+  801550:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801551:	8b 55 08             	mov    0x8(%ebp),%edx
+  801554:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801557:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80155c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80155f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	8d 35 6d 15 80 00    	lea    0x80156d,%esi
+  80156b:	0f 34                	sysenter
+  80156d:	5d                   	pop    %ebp
+		goto out;
+  80156e:	eb d5                	jmp    801545 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801570:	83 ec 0c             	sub    $0xc,%esp
+  801573:	50                   	push   %eax
+  801574:	6a 1f                	push   $0x1f
+  801576:	68 cb 32 80 00       	push   $0x8032cb
+  80157b:	6a 3f                	push   $0x3f
+  80157d:	68 e8 32 80 00       	push   $0x8032e8
+  801582:	e8 6c ed ff ff       	call   8002f3 <_panic>
+
+00801587 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	57                   	push   %edi
+  80158b:	56                   	push   %esi
+  80158c:	53                   	push   %ebx
+  80158d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801590:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801597:	74 23                	je     8015bc <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801599:	be 00 00 00 00       	mov    $0x0,%esi
+  80159e:	b8 20 00 00 00       	mov    $0x20,%eax
+  8015a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015ac:	89 f7                	mov    %esi,%edi
+  8015ae:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015b0:	85 c0                	test   %eax,%eax
+  8015b2:	7f 29                	jg     8015dd <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  8015b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b7:	5b                   	pop    %ebx
+  8015b8:	5e                   	pop    %esi
+  8015b9:	5f                   	pop    %edi
+  8015ba:	5d                   	pop    %ebp
+  8015bb:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c2:	b8 20 00 00 00       	mov    $0x20,%eax
+  8015c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	8d 35 da 15 80 00    	lea    0x8015da,%esi
+  8015d8:	0f 34                	sysenter
+  8015da:	5d                   	pop    %ebp
+		goto out;
+  8015db:	eb d3                	jmp    8015b0 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015dd:	83 ec 0c             	sub    $0xc,%esp
+  8015e0:	50                   	push   %eax
+  8015e1:	6a 20                	push   $0x20
+  8015e3:	68 cb 32 80 00       	push   $0x8032cb
+  8015e8:	6a 3f                	push   $0x3f
+  8015ea:	68 e8 32 80 00       	push   $0x8032e8
+  8015ef:	e8 ff ec ff ff       	call   8002f3 <_panic>
+
+008015f4 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8015f4:	55                   	push   %ebp
+  8015f5:	89 e5                	mov    %esp,%ebp
+  8015f7:	57                   	push   %edi
+  8015f8:	56                   	push   %esi
+  8015f9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015fa:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801601:	74 1b                	je     80161e <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  801603:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801608:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80160d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801610:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801613:	89 df                	mov    %ebx,%edi
+  801615:	89 de                	mov    %ebx,%esi
+  801617:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801619:	5b                   	pop    %ebx
+  80161a:	5e                   	pop    %esi
+  80161b:	5f                   	pop    %edi
+  80161c:	5d                   	pop    %ebp
+  80161d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80161e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801623:	8b 55 08             	mov    0x8(%ebp),%edx
+  801626:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801629:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80162e:	89 df                	mov    %ebx,%edi
+  801630:	55                   	push   %ebp
+  801631:	89 e5                	mov    %esp,%ebp
+  801633:	8d 35 3b 16 80 00    	lea    0x80163b,%esi
+  801639:	0f 34                	sysenter
+  80163b:	5d                   	pop    %ebp
+		goto out;
+  80163c:	eb db                	jmp    801619 <sys_batch+0x25>
+
+0080163e <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80163e:	55                   	push   %ebp
+  80163f:	89 e5                	mov    %esp,%ebp
+  801641:	57                   	push   %edi
+  801642:	56                   	push   %esi
+  801643:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801644:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  80164b:	74 1a                	je     801667 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80164d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801652:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801657:	8b 55 08             	mov    0x8(%ebp),%edx
+  80165a:	89 cb                	mov    %ecx,%ebx
+  80165c:	89 cf                	mov    %ecx,%edi
+  80165e:	89 ce                	mov    %ecx,%esi
+  801660:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801662:	5b                   	pop    %ebx
+  801663:	5e                   	pop    %esi
+  801664:	5f                   	pop    %edi
+  801665:	5d                   	pop    %ebp
+  801666:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801667:	8b 55 08             	mov    0x8(%ebp),%edx
+  80166a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801674:	89 cb                	mov    %ecx,%ebx
+  801676:	89 cf                	mov    %ecx,%edi
+  801678:	55                   	push   %ebp
+  801679:	89 e5                	mov    %esp,%ebp
+  80167b:	8d 35 83 16 80 00    	lea    0x801683,%esi
+  801681:	0f 34                	sysenter
+  801683:	5d                   	pop    %ebp
+		goto out;
+  801684:	eb dc                	jmp    801662 <sys_trace_ctl+0x24>
+
+00801686 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801686:	55                   	push   %ebp
+  801687:	89 e5                	mov    %esp,%ebp
+  801689:	57                   	push   %edi
+  80168a:	56                   	push   %esi
+  80168b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80168c:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801693:	74 1c                	je     8016b1 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801695:	be 00 00 00 00       	mov    $0x0,%esi
+  80169a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80169f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a8:	89 f7                	mov    %esi,%edi
+  8016aa:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  8016ac:	5b                   	pop    %ebx
+  8016ad:	5e                   	pop    %esi
+  8016ae:	5f                   	pop    %edi
+  8016af:	5d                   	pop    %ebp
+  8016b0:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8016bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	8d 35 cf 16 80 00    	lea    0x8016cf,%esi
+  8016cd:	0f 34                	sysenter
+  8016cf:	5d                   	pop    %ebp
+		goto out;
+  8016d0:	eb da                	jmp    8016ac <sys_trace_read+0x26>
+
+008016d2 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8016d2:	55                   	push   %ebp
+  8016d3:	89 e5                	mov    %esp,%ebp
+  8016d5:	57                   	push   %edi
+  8016d6:	56                   	push   %esi
+  8016d7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8016d8:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  8016df:	74 1c                	je     8016fd <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8016e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8016eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f4:	89 f7                	mov    %esi,%edi
+  8016f6:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8016f8:	5b                   	pop    %ebx
+  8016f9:	5e                   	pop    %esi
+  8016fa:	5f                   	pop    %edi
+  8016fb:	5d                   	pop    %ebp
+  8016fc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801700:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801703:	b8 21 00 00 00       	mov    $0x21,%eax
+  801708:	bf 00 00 00 00       	mov    $0x0,%edi
+  80170d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801710:	55                   	push   %ebp
+  801711:	89 e5                	mov    %esp,%ebp
+  801713:	8d 35 1b 17 80 00    	lea    0x80171b,%esi
+  801719:	0f 34                	sysenter
+  80171b:	5d                   	pop    %ebp
+		goto out;
+  80171c:	eb da                	jmp    8016f8 <sys_meminfo+0x26>
+
+0080171e <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  80171e:	55                   	push   %ebp
+  80171f:	89 e5                	mov    %esp,%ebp
+  801721:	57                   	push   %edi
+  801722:	56                   	push   %esi
+  801723:	53                   	push   %ebx
+  801724:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  801727:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  80172b:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801732:	74 1f                	je     801753 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801734:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801739:	b8 22 00 00 00       	mov    $0x22,%eax
+  80173e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801741:	89 df                	mov    %ebx,%edi
+  801743:	89 de                	mov    %ebx,%esi
+  801745:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801747:	85 c0                	test   %eax,%eax
+  801749:	7f 25                	jg     801770 <sys_env_set_ksm+0x52>
+}
+  80174b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174e:	5b                   	pop    %ebx
+  80174f:	5e                   	pop    %esi
+  801750:	5f                   	pop    %edi
+  801751:	5d                   	pop    %ebp
+  801752:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801753:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801758:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175b:	b8 22 00 00 00       	mov    $0x22,%eax
+  801760:	89 df                	mov    %ebx,%edi
+  801762:	55                   	push   %ebp
+  801763:	89 e5                	mov    %esp,%ebp
+  801765:	8d 35 6d 17 80 00    	lea    0x80176d,%esi
+  80176b:	0f 34                	sysenter
+  80176d:	5d                   	pop    %ebp
+		goto out;
+  80176e:	eb d7                	jmp    801747 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801770:	83 ec 0c             	sub    $0xc,%esp
+  801773:	50                   	push   %eax
+  801774:	6a 22                	push   $0x22
+  801776:	68 cb 32 80 00       	push   $0x8032cb
+  80177b:	6a 3f                	push   $0x3f
+  80177d:	68 e8 32 80 00       	push   $0x8032e8
+  801782:	e8 6c eb ff ff       	call   8002f3 <_panic>
+
+00801787 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	57                   	push   %edi
+  80178b:	56                   	push   %esi
+  80178c:	53                   	push   %ebx
+  80178d:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801790:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801793:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  80179a:	74 24                	je     8017c0 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80179c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017a1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8017a6:	89 cb                	mov    %ecx,%ebx
+  8017a8:	89 cf                	mov    %ecx,%edi
+  8017aa:	89 ce                	mov    %ecx,%esi
+  8017ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017ae:	85 c0                	test   %eax,%eax
+  8017b0:	7f 2a                	jg     8017dc <sys_time_nsec+0x55>
+	return ns;
+}
+  8017b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017b5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8017b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017bb:	5b                   	pop    %ebx
+  8017bc:	5e                   	pop    %esi
+  8017bd:	5f                   	pop    %edi
+  8017be:	5d                   	pop    %ebp
+  8017bf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017c5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8017ca:	89 cb                	mov    %ecx,%ebx
+  8017cc:	89 cf                	mov    %ecx,%edi
+  8017ce:	55                   	push   %ebp
+  8017cf:	89 e5                	mov    %esp,%ebp
+  8017d1:	8d 35 d9 17 80 00    	lea    0x8017d9,%esi
+  8017d7:	0f 34                	sysenter
+  8017d9:	5d                   	pop    %ebp
+		goto out;
+  8017da:	eb d2                	jmp    8017ae <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017dc:	83 ec 0c             	sub    $0xc,%esp
+  8017df:	50                   	push   %eax
+  8017e0:	6a 0f                	push   $0xf
+  8017e2:	68 cb 32 80 00       	push   $0x8032cb
+  8017e7:	6a 3f                	push   $0x3f
+  8017e9:	68 e8 32 80 00       	push   $0x8032e8
+  8017ee:	e8 00 eb ff ff       	call   8002f3 <_panic>
+
+008017f3 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	57                   	push   %edi
+  8017f7:	56                   	push   %esi
+  8017f8:	53                   	push   %ebx
+  8017f9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8017fc:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801803:	74 22                	je     801827 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  801805:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80180f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801812:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801815:	89 df                	mov    %ebx,%edi
+  801817:	89 de                	mov    %ebx,%esi
+  801819:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	7f 28                	jg     801847 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  80181f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801822:	5b                   	pop    %ebx
+  801823:	5e                   	pop    %esi
+  801824:	5f                   	pop    %edi
+  801825:	5d                   	pop    %ebp
+  801826:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801827:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80182c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80182f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801832:	b8 12 00 00 00       	mov    $0x12,%eax
+  801837:	89 df                	mov    %ebx,%edi
+  801839:	55                   	push   %ebp
+  80183a:	89 e5                	mov    %esp,%ebp
+  80183c:	8d 35 44 18 80 00    	lea    0x801844,%esi
+  801842:	0f 34                	sysenter
+  801844:	5d                   	pop    %ebp
+		goto out;
+  801845:	eb d4                	jmp    80181b <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801847:	83 ec 0c             	sub    $0xc,%esp
+  80184a:	50                   	push   %eax
+  80184b:	6a 12                	push   $0x12
+  80184d:	68 cb 32 80 00       	push   $0x8032cb
+  801852:	6a 3f                	push   $0x3f
+  801854:	68 e8 32 80 00       	push   $0x8032e8
+  801859:	e8 95 ea ff ff       	call   8002f3 <_panic>
+
+0080185e <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80185e:	55                   	push   %ebp
+  80185f:	89 e5                	mov    %esp,%ebp
+  801861:	57                   	push   %edi
+  801862:	56                   	push   %esi
+  801863:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801864:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  80186b:	74 1b                	je     801888 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80186d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801872:	b8 13 00 00 00       	mov    $0x13,%eax
+  801877:	8b 55 08             	mov    0x8(%ebp),%edx
+  80187a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80187d:	89 df                	mov    %ebx,%edi
+  80187f:	89 de                	mov    %ebx,%esi
+  801881:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801883:	5b                   	pop    %ebx
+  801884:	5e                   	pop    %esi
+  801885:	5f                   	pop    %edi
+  801886:	5d                   	pop    %ebp
+  801887:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801888:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80188d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801890:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801893:	b8 13 00 00 00       	mov    $0x13,%eax
+  801898:	89 df                	mov    %ebx,%edi
+  80189a:	55                   	push   %ebp
+  80189b:	89 e5                	mov    %esp,%ebp
+  80189d:	8d 35 a5 18 80 00    	lea    0x8018a5,%esi
+  8018a3:	0f 34                	sysenter
+  8018a5:	5d                   	pop    %ebp
+		goto out;
+  8018a6:	eb db                	jmp    801883 <sys_e1000_receive+0x25>
+
+008018a8 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  8018a8:	55                   	push   %ebp
+  8018a9:	89 e5                	mov    %esp,%ebp
+  8018ab:	57                   	push   %edi
+  8018ac:	56                   	push   %esi
+  8018ad:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018ae:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  8018b5:	74 1b                	je     8018d2 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  8018b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018bc:	b8 14 00 00 00       	mov    $0x14,%eax
+  8018c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018c7:	89 df                	mov    %ebx,%edi
+  8018c9:	89 de                	mov    %ebx,%esi
+  8018cb:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5f                   	pop    %edi
+  8018d0:	5d                   	pop    %ebp
+  8018d1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8018d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018dd:	b8 14 00 00 00       	mov    $0x14,%eax
+  8018e2:	89 df                	mov    %ebx,%edi
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	8d 35 ef 18 80 00    	lea    0x8018ef,%esi
+  8018ed:	0f 34                	sysenter
+  8018ef:	5d                   	pop    %ebp
+		goto out;
+  8018f0:	eb db                	jmp    8018cd <sys_e1000_read_hwaddr+0x25>
+
+008018f2 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8018f2:	55                   	push   %ebp
+  8018f3:	89 e5                	mov    %esp,%ebp
+  8018f5:	57                   	push   %edi
+  8018f6:	56                   	push   %esi
+  8018f7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8018f8:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  8018ff:	74 1a                	je     80191b <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  801901:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801906:	b8 15 00 00 00       	mov    $0x15,%eax
+  80190b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80190e:	89 cb                	mov    %ecx,%ebx
+  801910:	89 cf                	mov    %ecx,%edi
+  801912:	89 ce                	mov    %ecx,%esi
+  801914:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  801916:	5b                   	pop    %ebx
+  801917:	5e                   	pop    %esi
+  801918:	5f                   	pop    %edi
+  801919:	5d                   	pop    %ebp
+  80191a:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80191b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801923:	b8 15 00 00 00       	mov    $0x15,%eax
+  801928:	89 cb                	mov    %ecx,%ebx
+  80192a:	89 cf                	mov    %ecx,%edi
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	8d 35 37 19 80 00    	lea    0x801937,%esi
+  801935:	0f 34                	sysenter
+  801937:	5d                   	pop    %ebp
+		goto out;
+  801938:	eb dc                	jmp    801916 <sys_sb16_read_version+0x24>
+
+0080193a <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80193a:	55                   	push   %ebp
+  80193b:	89 e5                	mov    %esp,%ebp
+  80193d:	57                   	push   %edi
+  80193e:	56                   	push   %esi
+  80193f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801940:	80 3d 0c c0 80 00 00 	cmpb   $0x0,0x80c00c
+  801947:	74 1b                	je     801964 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801949:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801953:	8b 55 08             	mov    0x8(%ebp),%edx
+  801956:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801959:	89 df                	mov    %ebx,%edi
+  80195b:	89 de                	mov    %ebx,%esi
+  80195d:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80195f:	5b                   	pop    %ebx
+  801960:	5e                   	pop    %esi
+  801961:	5f                   	pop    %edi
+  801962:	5d                   	pop    %ebp
+  801963:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801964:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801969:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80196f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801974:	89 df                	mov    %ebx,%edi
+  801976:	55                   	push   %ebp
+  801977:	89 e5                	mov    %esp,%ebp
+  801979:	8d 35 81 19 80 00    	lea    0x801981,%esi
+  80197f:	0f 34                	sysenter
+  801981:	5d                   	pop    %ebp
+		goto out;
+  801982:	eb db                	jmp    80195f <sys_sb16_play+0x25>
+
+00801984 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801984:	55                   	push   %ebp
+  801985:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801987:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80198f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801992:	5d                   	pop    %ebp
+  801993:	c3                   	ret
+
+00801994 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801994:	55                   	push   %ebp
+  801995:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80199f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019a4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019a9:	5d                   	pop    %ebp
+  8019aa:	c3                   	ret
+
+008019ab <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019ab:	55                   	push   %ebp
+  8019ac:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8019ae:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8019b3:	eb 02                	jmp    8019b7 <fd_alloc+0xc>
+  8019b5:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019b7:	89 c2                	mov    %eax,%edx
+  8019b9:	c1 ea 16             	shr    $0x16,%edx
+  8019bc:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019c3:	f6 c2 01             	test   $0x1,%dl
+  8019c6:	74 2b                	je     8019f3 <fd_alloc+0x48>
+  8019c8:	89 c2                	mov    %eax,%edx
+  8019ca:	c1 ea 0c             	shr    $0xc,%edx
+  8019cd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8019d4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8019da:	f6 c1 01             	test   $0x1,%cl
+  8019dd:	74 14                	je     8019f3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8019df:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8019e5:	75 ce                	jne    8019b5 <fd_alloc+0xa>
+  8019e7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8019ec:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8019f1:	eb 05                	jmp    8019f8 <fd_alloc+0x4d>
+			return 0;
+  8019f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8019f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019fb:	89 02                	mov    %eax,(%edx)
+}
+  8019fd:	89 c8                	mov    %ecx,%eax
+  8019ff:	5d                   	pop    %ebp
+  801a00:	c3                   	ret
+
+00801a01 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a01:	55                   	push   %ebp
+  801a02:	89 e5                	mov    %esp,%ebp
+  801a04:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a07:	83 f8 1f             	cmp    $0x1f,%eax
+  801a0a:	77 30                	ja     801a3c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a0c:	c1 e0 0c             	shl    $0xc,%eax
+  801a0f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a14:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a1a:	f6 c2 01             	test   $0x1,%dl
+  801a1d:	74 24                	je     801a43 <fd_lookup+0x42>
+  801a1f:	89 c2                	mov    %eax,%edx
+  801a21:	c1 ea 0c             	shr    $0xc,%edx
+  801a24:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a2b:	f6 c2 01             	test   $0x1,%dl
+  801a2e:	74 1a                	je     801a4a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a33:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a3a:	5d                   	pop    %ebp
+  801a3b:	c3                   	ret
+		return -E_INVAL;
+  801a3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a41:	eb f7                	jmp    801a3a <fd_lookup+0x39>
+		return -E_INVAL;
+  801a43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a48:	eb f0                	jmp    801a3a <fd_lookup+0x39>
+  801a4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a4f:	eb e9                	jmp    801a3a <fd_lookup+0x39>
+
+00801a51 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a51:	55                   	push   %ebp
+  801a52:	89 e5                	mov    %esp,%ebp
+  801a54:	53                   	push   %ebx
+  801a55:	83 ec 04             	sub    $0x4,%esp
+  801a58:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a60:	eb 03                	jmp    801a65 <dev_lookup+0x14>
+  801a62:	83 c0 01             	add    $0x1,%eax
+  801a65:	8b 1c 85 74 33 80 00 	mov    0x803374(,%eax,4),%ebx
+  801a6c:	85 db                	test   %ebx,%ebx
+  801a6e:	74 0b                	je     801a7b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801a70:	39 13                	cmp    %edx,(%ebx)
+  801a72:	75 ee                	jne    801a62 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a79:	eb 2e                	jmp    801aa9 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  801a7b:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801a7d:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  801a82:	8b 0d 08 c0 80 00    	mov    0x80c008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801a88:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801a8d:	76 24                	jbe    801ab3 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a8f:	8b 41 48             	mov    0x48(%ecx),%eax
+  801a92:	83 ec 04             	sub    $0x4,%esp
+  801a95:	52                   	push   %edx
+  801a96:	50                   	push   %eax
+  801a97:	68 f8 32 80 00       	push   $0x8032f8
+  801a9c:	e8 2d e9 ff ff       	call   8003ce <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801aa1:	83 c4 10             	add    $0x10,%esp
+  801aa4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801aa9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aac:	89 1a                	mov    %ebx,(%edx)
+}
+  801aae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ab1:	c9                   	leave
+  801ab2:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ab3:	c1 e8 10             	shr    $0x10,%eax
+  801ab6:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801abc:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801ac2:	eb cb                	jmp    801a8f <dev_lookup+0x3e>
+
+00801ac4 <fd_close>:
+{
+  801ac4:	55                   	push   %ebp
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	57                   	push   %edi
+  801ac8:	56                   	push   %esi
+  801ac9:	53                   	push   %ebx
+  801aca:	83 ec 24             	sub    $0x24,%esp
+  801acd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ad0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ad3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ad6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ad7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801add:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ae0:	50                   	push   %eax
+  801ae1:	e8 1b ff ff ff       	call   801a01 <fd_lookup>
+  801ae6:	89 c3                	mov    %eax,%ebx
+  801ae8:	83 c4 10             	add    $0x10,%esp
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	78 05                	js     801af4 <fd_close+0x30>
+	    || fd != fd2)
+  801aef:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801af2:	74 16                	je     801b0a <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801af4:	89 f8                	mov    %edi,%eax
+  801af6:	84 c0                	test   %al,%al
+  801af8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b00:	89 d8                	mov    %ebx,%eax
+  801b02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b05:	5b                   	pop    %ebx
+  801b06:	5e                   	pop    %esi
+  801b07:	5f                   	pop    %edi
+  801b08:	5d                   	pop    %ebp
+  801b09:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b0a:	83 ec 08             	sub    $0x8,%esp
+  801b0d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b10:	50                   	push   %eax
+  801b11:	ff 36                	push   (%esi)
+  801b13:	e8 39 ff ff ff       	call   801a51 <dev_lookup>
+  801b18:	89 c3                	mov    %eax,%ebx
+  801b1a:	83 c4 10             	add    $0x10,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 1a                	js     801b3b <fd_close+0x77>
+		if (dev->dev_close)
+  801b21:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b24:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b27:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	74 0b                	je     801b3b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801b30:	83 ec 0c             	sub    $0xc,%esp
+  801b33:	56                   	push   %esi
+  801b34:	ff d0                	call   *%eax
+  801b36:	89 c3                	mov    %eax,%ebx
+  801b38:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b3b:	83 ec 08             	sub    $0x8,%esp
+  801b3e:	56                   	push   %esi
+  801b3f:	6a 00                	push   $0x0
+  801b41:	e8 a3 f4 ff ff       	call   800fe9 <sys_page_unmap>
+	return r;
+  801b46:	83 c4 10             	add    $0x10,%esp
+  801b49:	eb b5                	jmp    801b00 <fd_close+0x3c>
+
+00801b4b <close>:
+
+int
+close(int fdnum)
+{
+  801b4b:	55                   	push   %ebp
+  801b4c:	89 e5                	mov    %esp,%ebp
+  801b4e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b54:	50                   	push   %eax
+  801b55:	ff 75 08             	push   0x8(%ebp)
+  801b58:	e8 a4 fe ff ff       	call   801a01 <fd_lookup>
+  801b5d:	83 c4 10             	add    $0x10,%esp
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	79 02                	jns    801b66 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b64:	c9                   	leave
+  801b65:	c3                   	ret
+		return fd_close(fd, 1);
+  801b66:	83 ec 08             	sub    $0x8,%esp
+  801b69:	6a 01                	push   $0x1
+  801b6b:	ff 75 f4             	push   -0xc(%ebp)
+  801b6e:	e8 51 ff ff ff       	call   801ac4 <fd_close>
+  801b73:	83 c4 10             	add    $0x10,%esp
+  801b76:	eb ec                	jmp    801b64 <close+0x19>
+
+00801b78 <close_all>:
+
+void
+close_all(void)
+{
+  801b78:	55                   	push   %ebp
+  801b79:	89 e5                	mov    %esp,%ebp
+  801b7b:	53                   	push   %ebx
+  801b7c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b84:	83 ec 0c             	sub    $0xc,%esp
+  801b87:	53                   	push   %ebx
+  801b88:	e8 be ff ff ff       	call   801b4b <close>
+	for (i = 0; i < MAXFD; i++)
+  801b8d:	83 c3 01             	add    $0x1,%ebx
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	83 fb 20             	cmp    $0x20,%ebx
+  801b96:	75 ec                	jne    801b84 <close_all+0xc>
+}
+  801b98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b9b:	c9                   	leave
+  801b9c:	c3                   	ret
+
+00801b9d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b9d:	55                   	push   %ebp
+  801b9e:	89 e5                	mov    %esp,%ebp
+  801ba0:	57                   	push   %edi
+  801ba1:	56                   	push   %esi
+  801ba2:	53                   	push   %ebx
+  801ba3:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ba6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ba9:	50                   	push   %eax
+  801baa:	ff 75 08             	push   0x8(%ebp)
+  801bad:	e8 4f fe ff ff       	call   801a01 <fd_lookup>
+  801bb2:	89 c3                	mov    %eax,%ebx
+  801bb4:	83 c4 10             	add    $0x10,%esp
+  801bb7:	85 c0                	test   %eax,%eax
+  801bb9:	78 7f                	js     801c3a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801bbb:	83 ec 0c             	sub    $0xc,%esp
+  801bbe:	ff 75 0c             	push   0xc(%ebp)
+  801bc1:	e8 85 ff ff ff       	call   801b4b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801bc6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801bc9:	c1 e6 0c             	shl    $0xc,%esi
+  801bcc:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801bd2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bd5:	89 3c 24             	mov    %edi,(%esp)
+  801bd8:	e8 b7 fd ff ff       	call   801994 <fd2data>
+  801bdd:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801bdf:	89 34 24             	mov    %esi,(%esp)
+  801be2:	e8 ad fd ff ff       	call   801994 <fd2data>
+  801be7:	83 c4 10             	add    $0x10,%esp
+  801bea:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801bed:	89 d8                	mov    %ebx,%eax
+  801bef:	c1 e8 16             	shr    $0x16,%eax
+  801bf2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bf9:	a8 01                	test   $0x1,%al
+  801bfb:	74 11                	je     801c0e <dup+0x71>
+  801bfd:	89 d8                	mov    %ebx,%eax
+  801bff:	c1 e8 0c             	shr    $0xc,%eax
+  801c02:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c09:	f6 c2 01             	test   $0x1,%dl
+  801c0c:	75 36                	jne    801c44 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c0e:	89 f8                	mov    %edi,%eax
+  801c10:	c1 e8 0c             	shr    $0xc,%eax
+  801c13:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c1a:	83 ec 0c             	sub    $0xc,%esp
+  801c1d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c22:	50                   	push   %eax
+  801c23:	56                   	push   %esi
+  801c24:	6a 00                	push   $0x0
+  801c26:	57                   	push   %edi
+  801c27:	6a 00                	push   $0x0
+  801c29:	e8 4d f3 ff ff       	call   800f7b <sys_page_map>
+  801c2e:	89 c3                	mov    %eax,%ebx
+  801c30:	83 c4 20             	add    $0x20,%esp
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	78 33                	js     801c6a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c3a:	89 d8                	mov    %ebx,%eax
+  801c3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5f                   	pop    %edi
+  801c42:	5d                   	pop    %ebp
+  801c43:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c44:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c4b:	83 ec 0c             	sub    $0xc,%esp
+  801c4e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c53:	50                   	push   %eax
+  801c54:	ff 75 d4             	push   -0x2c(%ebp)
+  801c57:	6a 00                	push   $0x0
+  801c59:	53                   	push   %ebx
+  801c5a:	6a 00                	push   $0x0
+  801c5c:	e8 1a f3 ff ff       	call   800f7b <sys_page_map>
+  801c61:	89 c3                	mov    %eax,%ebx
+  801c63:	83 c4 20             	add    $0x20,%esp
+  801c66:	85 c0                	test   %eax,%eax
+  801c68:	79 a4                	jns    801c0e <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801c6a:	83 ec 08             	sub    $0x8,%esp
+  801c6d:	56                   	push   %esi
+  801c6e:	6a 00                	push   $0x0
+  801c70:	e8 74 f3 ff ff       	call   800fe9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c75:	83 c4 08             	add    $0x8,%esp
+  801c78:	ff 75 d4             	push   -0x2c(%ebp)
+  801c7b:	6a 00                	push   $0x0
+  801c7d:	e8 67 f3 ff ff       	call   800fe9 <sys_page_unmap>
+	return r;
+  801c82:	83 c4 10             	add    $0x10,%esp
+  801c85:	eb b3                	jmp    801c3a <dup+0x9d>
+
+00801c87 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c87:	55                   	push   %ebp
+  801c88:	89 e5                	mov    %esp,%ebp
+  801c8a:	56                   	push   %esi
+  801c8b:	53                   	push   %ebx
+  801c8c:	83 ec 18             	sub    $0x18,%esp
+  801c8f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c92:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c95:	50                   	push   %eax
+  801c96:	53                   	push   %ebx
+  801c97:	e8 65 fd ff ff       	call   801a01 <fd_lookup>
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	78 3c                	js     801cdf <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ca3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ca6:	83 ec 08             	sub    $0x8,%esp
+  801ca9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cac:	50                   	push   %eax
+  801cad:	ff 36                	push   (%esi)
+  801caf:	e8 9d fd ff ff       	call   801a51 <dev_lookup>
+  801cb4:	83 c4 10             	add    $0x10,%esp
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	78 24                	js     801cdf <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cbb:	8b 46 08             	mov    0x8(%esi),%eax
+  801cbe:	83 e0 03             	and    $0x3,%eax
+  801cc1:	83 f8 01             	cmp    $0x1,%eax
+  801cc4:	74 20                	je     801ce6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801cc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cc9:	8b 40 08             	mov    0x8(%eax),%eax
+  801ccc:	85 c0                	test   %eax,%eax
+  801cce:	74 57                	je     801d27 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801cd0:	83 ec 04             	sub    $0x4,%esp
+  801cd3:	ff 75 10             	push   0x10(%ebp)
+  801cd6:	ff 75 0c             	push   0xc(%ebp)
+  801cd9:	56                   	push   %esi
+  801cda:	ff d0                	call   *%eax
+  801cdc:	83 c4 10             	add    $0x10,%esp
+}
+  801cdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce2:	5b                   	pop    %ebx
+  801ce3:	5e                   	pop    %esi
+  801ce4:	5d                   	pop    %ebp
+  801ce5:	c3                   	ret
+  801ce6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ce8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ced:	8b 15 08 c0 80 00    	mov    0x80c008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cf3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cf8:	76 1c                	jbe    801d16 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cfa:	8b 42 48             	mov    0x48(%edx),%eax
+  801cfd:	83 ec 04             	sub    $0x4,%esp
+  801d00:	53                   	push   %ebx
+  801d01:	50                   	push   %eax
+  801d02:	68 39 33 80 00       	push   $0x803339
+  801d07:	e8 c2 e6 ff ff       	call   8003ce <cprintf>
+		return -E_INVAL;
+  801d0c:	83 c4 10             	add    $0x10,%esp
+  801d0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d14:	eb c9                	jmp    801cdf <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d16:	c1 e8 10             	shr    $0x10,%eax
+  801d19:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801d1f:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801d25:	eb d3                	jmp    801cfa <read+0x73>
+		return -E_NOT_SUPP;
+  801d27:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d2c:	eb b1                	jmp    801cdf <read+0x58>
+
+00801d2e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d2e:	55                   	push   %ebp
+  801d2f:	89 e5                	mov    %esp,%ebp
+  801d31:	57                   	push   %edi
+  801d32:	56                   	push   %esi
+  801d33:	53                   	push   %ebx
+  801d34:	83 ec 0c             	sub    $0xc,%esp
+  801d37:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d3a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d42:	eb 02                	jmp    801d46 <readn+0x18>
+  801d44:	01 c3                	add    %eax,%ebx
+  801d46:	39 f3                	cmp    %esi,%ebx
+  801d48:	73 21                	jae    801d6b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d4a:	83 ec 04             	sub    $0x4,%esp
+  801d4d:	89 f0                	mov    %esi,%eax
+  801d4f:	29 d8                	sub    %ebx,%eax
+  801d51:	50                   	push   %eax
+  801d52:	89 d8                	mov    %ebx,%eax
+  801d54:	03 45 0c             	add    0xc(%ebp),%eax
+  801d57:	50                   	push   %eax
+  801d58:	57                   	push   %edi
+  801d59:	e8 29 ff ff ff       	call   801c87 <read>
+		if (m < 0)
+  801d5e:	83 c4 10             	add    $0x10,%esp
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	78 04                	js     801d69 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801d65:	75 dd                	jne    801d44 <readn+0x16>
+  801d67:	eb 02                	jmp    801d6b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d69:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801d6b:	89 d8                	mov    %ebx,%eax
+  801d6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d70:	5b                   	pop    %ebx
+  801d71:	5e                   	pop    %esi
+  801d72:	5f                   	pop    %edi
+  801d73:	5d                   	pop    %ebp
+  801d74:	c3                   	ret
+
+00801d75 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801d75:	55                   	push   %ebp
+  801d76:	89 e5                	mov    %esp,%ebp
+  801d78:	56                   	push   %esi
+  801d79:	53                   	push   %ebx
+  801d7a:	83 ec 18             	sub    $0x18,%esp
+  801d7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d80:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d83:	50                   	push   %eax
+  801d84:	53                   	push   %ebx
+  801d85:	e8 77 fc ff ff       	call   801a01 <fd_lookup>
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	78 37                	js     801dc8 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d91:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d94:	83 ec 08             	sub    $0x8,%esp
+  801d97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d9a:	50                   	push   %eax
+  801d9b:	ff 36                	push   (%esi)
+  801d9d:	e8 af fc ff ff       	call   801a51 <dev_lookup>
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	78 1f                	js     801dc8 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801da9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dad:	74 20                	je     801dcf <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801daf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801db2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	74 57                	je     801e10 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801db9:	83 ec 04             	sub    $0x4,%esp
+  801dbc:	ff 75 10             	push   0x10(%ebp)
+  801dbf:	ff 75 0c             	push   0xc(%ebp)
+  801dc2:	56                   	push   %esi
+  801dc3:	ff d0                	call   *%eax
+  801dc5:	83 c4 10             	add    $0x10,%esp
+}
+  801dc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dcb:	5b                   	pop    %ebx
+  801dcc:	5e                   	pop    %esi
+  801dcd:	5d                   	pop    %ebp
+  801dce:	c3                   	ret
+  801dcf:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801dd1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801dd6:	8b 15 08 c0 80 00    	mov    0x80c008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ddc:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801de1:	76 1c                	jbe    801dff <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801de3:	8b 42 48             	mov    0x48(%edx),%eax
+  801de6:	83 ec 04             	sub    $0x4,%esp
+  801de9:	53                   	push   %ebx
+  801dea:	50                   	push   %eax
+  801deb:	68 55 33 80 00       	push   $0x803355
+  801df0:	e8 d9 e5 ff ff       	call   8003ce <cprintf>
+		return -E_INVAL;
+  801df5:	83 c4 10             	add    $0x10,%esp
+  801df8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dfd:	eb c9                	jmp    801dc8 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801dff:	c1 e8 10             	shr    $0x10,%eax
+  801e02:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801e08:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801e0e:	eb d3                	jmp    801de3 <write+0x6e>
+		return -E_NOT_SUPP;
+  801e10:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e15:	eb b1                	jmp    801dc8 <write+0x53>
+
+00801e17 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e17:	55                   	push   %ebp
+  801e18:	89 e5                	mov    %esp,%ebp
+  801e1a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e20:	50                   	push   %eax
+  801e21:	ff 75 08             	push   0x8(%ebp)
+  801e24:	e8 d8 fb ff ff       	call   801a01 <fd_lookup>
+  801e29:	83 c4 10             	add    $0x10,%esp
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	78 0e                	js     801e3e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e36:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e3e:	c9                   	leave
+  801e3f:	c3                   	ret
+
+00801e40 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e40:	55                   	push   %ebp
+  801e41:	89 e5                	mov    %esp,%ebp
+  801e43:	56                   	push   %esi
+  801e44:	53                   	push   %ebx
+  801e45:	83 ec 18             	sub    $0x18,%esp
+  801e48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e4b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e4e:	50                   	push   %eax
+  801e4f:	53                   	push   %ebx
+  801e50:	e8 ac fb ff ff       	call   801a01 <fd_lookup>
+  801e55:	83 c4 10             	add    $0x10,%esp
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	78 34                	js     801e90 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e5c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+  801e62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e65:	50                   	push   %eax
+  801e66:	ff 36                	push   (%esi)
+  801e68:	e8 e4 fb ff ff       	call   801a51 <dev_lookup>
+  801e6d:	83 c4 10             	add    $0x10,%esp
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	78 1c                	js     801e90 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e74:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e78:	74 1d                	je     801e97 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e7d:	8b 40 18             	mov    0x18(%eax),%eax
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	74 54                	je     801ed8 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	ff 75 0c             	push   0xc(%ebp)
+  801e8a:	56                   	push   %esi
+  801e8b:	ff d0                	call   *%eax
+  801e8d:	83 c4 10             	add    $0x10,%esp
+}
+  801e90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e93:	5b                   	pop    %ebx
+  801e94:	5e                   	pop    %esi
+  801e95:	5d                   	pop    %ebp
+  801e96:	c3                   	ret
+  801e97:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801e99:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801e9e:	8b 15 08 c0 80 00    	mov    0x80c008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ea4:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801ea9:	76 1c                	jbe    801ec7 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801eab:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eae:	83 ec 04             	sub    $0x4,%esp
+  801eb1:	53                   	push   %ebx
+  801eb2:	50                   	push   %eax
+  801eb3:	68 18 33 80 00       	push   $0x803318
+  801eb8:	e8 11 e5 ff ff       	call   8003ce <cprintf>
+		return -E_INVAL;
+  801ebd:	83 c4 10             	add    $0x10,%esp
+  801ec0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec5:	eb c9                	jmp    801e90 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ec7:	c1 e8 10             	shr    $0x10,%eax
+  801eca:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801ed0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801ed6:	eb d3                	jmp    801eab <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801ed8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801edd:	eb b1                	jmp    801e90 <ftruncate+0x50>
+
+00801edf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801edf:	55                   	push   %ebp
+  801ee0:	89 e5                	mov    %esp,%ebp
+  801ee2:	56                   	push   %esi
+  801ee3:	53                   	push   %ebx
+  801ee4:	83 ec 18             	sub    $0x18,%esp
+  801ee7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801eea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eed:	50                   	push   %eax
+  801eee:	ff 75 08             	push   0x8(%ebp)
+  801ef1:	e8 0b fb ff ff       	call   801a01 <fd_lookup>
+  801ef6:	83 c4 10             	add    $0x10,%esp
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 49                	js     801f46 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801efd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f00:	83 ec 08             	sub    $0x8,%esp
+  801f03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f06:	50                   	push   %eax
+  801f07:	ff 36                	push   (%esi)
+  801f09:	e8 43 fb ff ff       	call   801a51 <dev_lookup>
+  801f0e:	83 c4 10             	add    $0x10,%esp
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	78 31                	js     801f46 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f18:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f1c:	74 2f                	je     801f4d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f1e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f21:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f28:	00 00 00 
+	stat->st_isdir = 0;
+  801f2b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f32:	00 00 00 
+	stat->st_dev = dev;
+  801f35:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f3b:	83 ec 08             	sub    $0x8,%esp
+  801f3e:	53                   	push   %ebx
+  801f3f:	56                   	push   %esi
+  801f40:	ff 50 14             	call   *0x14(%eax)
+  801f43:	83 c4 10             	add    $0x10,%esp
+}
+  801f46:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f49:	5b                   	pop    %ebx
+  801f4a:	5e                   	pop    %esi
+  801f4b:	5d                   	pop    %ebp
+  801f4c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f4d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f52:	eb f2                	jmp    801f46 <fstat+0x67>
+
+00801f54 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	56                   	push   %esi
+  801f58:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f59:	83 ec 08             	sub    $0x8,%esp
+  801f5c:	6a 00                	push   $0x0
+  801f5e:	ff 75 08             	push   0x8(%ebp)
+  801f61:	e8 e4 01 00 00       	call   80214a <open>
+  801f66:	89 c3                	mov    %eax,%ebx
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 1b                	js     801f8a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f6f:	83 ec 08             	sub    $0x8,%esp
+  801f72:	ff 75 0c             	push   0xc(%ebp)
+  801f75:	50                   	push   %eax
+  801f76:	e8 64 ff ff ff       	call   801edf <fstat>
+  801f7b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f7d:	89 1c 24             	mov    %ebx,(%esp)
+  801f80:	e8 c6 fb ff ff       	call   801b4b <close>
+	return r;
+  801f85:	83 c4 10             	add    $0x10,%esp
+  801f88:	89 f3                	mov    %esi,%ebx
+}
+  801f8a:	89 d8                	mov    %ebx,%eax
+  801f8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f8f:	5b                   	pop    %ebx
+  801f90:	5e                   	pop    %esi
+  801f91:	5d                   	pop    %ebp
+  801f92:	c3                   	ret
+
+00801f93 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f93:	55                   	push   %ebp
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	56                   	push   %esi
+  801f97:	53                   	push   %ebx
+  801f98:	89 c6                	mov    %eax,%esi
+  801f9a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801f9c:	83 3d 00 c0 80 00 00 	cmpl   $0x0,0x80c000
+  801fa3:	74 27                	je     801fcc <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801fa5:	6a 07                	push   $0x7
+  801fa7:	68 00 d0 80 00       	push   $0x80d000
+  801fac:	56                   	push   %esi
+  801fad:	ff 35 00 c0 80 00    	push   0x80c000
+  801fb3:	e8 c6 0d 00 00       	call   802d7e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801fb8:	83 c4 0c             	add    $0xc,%esp
+  801fbb:	6a 00                	push   $0x0
+  801fbd:	53                   	push   %ebx
+  801fbe:	6a 00                	push   $0x0
+  801fc0:	e8 a1 0d 00 00       	call   802d66 <ipc_recv>
+}
+  801fc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc8:	5b                   	pop    %ebx
+  801fc9:	5e                   	pop    %esi
+  801fca:	5d                   	pop    %ebp
+  801fcb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fcc:	83 ec 0c             	sub    $0xc,%esp
+  801fcf:	6a 01                	push   $0x1
+  801fd1:	e8 fc 0d 00 00       	call   802dd2 <ipc_find_env>
+  801fd6:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  801fdb:	83 c4 10             	add    $0x10,%esp
+  801fde:	eb c5                	jmp    801fa5 <fsipc+0x12>
+
+00801fe0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801fe0:	55                   	push   %ebp
+  801fe1:	89 e5                	mov    %esp,%ebp
+  801fe3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fe6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fec:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.set_size.req_size = newsize;
+  801ff1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ff4:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ff9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffe:	b8 02 00 00 00       	mov    $0x2,%eax
+  802003:	e8 8b ff ff ff       	call   801f93 <fsipc>
+}
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+
+0080200a <devfile_flush>:
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802010:	8b 45 08             	mov    0x8(%ebp),%eax
+  802013:	8b 40 0c             	mov    0xc(%eax),%eax
+  802016:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80201b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802020:	b8 06 00 00 00       	mov    $0x6,%eax
+  802025:	e8 69 ff ff ff       	call   801f93 <fsipc>
+}
+  80202a:	c9                   	leave
+  80202b:	c3                   	ret
+
+0080202c <devfile_stat>:
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	53                   	push   %ebx
+  802030:	83 ec 04             	sub    $0x4,%esp
+  802033:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802036:	8b 45 08             	mov    0x8(%ebp),%eax
+  802039:	8b 40 0c             	mov    0xc(%eax),%eax
+  80203c:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802041:	ba 00 00 00 00       	mov    $0x0,%edx
+  802046:	b8 05 00 00 00       	mov    $0x5,%eax
+  80204b:	e8 43 ff ff ff       	call   801f93 <fsipc>
+  802050:	85 c0                	test   %eax,%eax
+  802052:	78 2c                	js     802080 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802054:	83 ec 08             	sub    $0x8,%esp
+  802057:	68 00 d0 80 00       	push   $0x80d000
+  80205c:	53                   	push   %ebx
+  80205d:	e8 b4 e9 ff ff       	call   800a16 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802062:	a1 80 d0 80 00       	mov    0x80d080,%eax
+  802067:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80206d:	a1 84 d0 80 00       	mov    0x80d084,%eax
+  802072:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802078:	83 c4 10             	add    $0x10,%esp
+  80207b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802080:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802083:	c9                   	leave
+  802084:	c3                   	ret
+
+00802085 <devfile_write>:
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	83 ec 0c             	sub    $0xc,%esp
+  80208b:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80208e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802091:	8b 52 0c             	mov    0xc(%edx),%edx
+  802094:	89 15 00 d0 80 00    	mov    %edx,0x80d000
+	fsipcbuf.write.req_n = n;
+  80209a:	a3 04 d0 80 00       	mov    %eax,0x80d004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80209f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8020a4:	39 d0                	cmp    %edx,%eax
+  8020a6:	0f 47 c2             	cmova  %edx,%eax
+  8020a9:	50                   	push   %eax
+  8020aa:	ff 75 0c             	push   0xc(%ebp)
+  8020ad:	68 08 d0 80 00       	push   $0x80d008
+  8020b2:	e8 e5 ea ff ff       	call   800b9c <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8020b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020bc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020c1:	e8 cd fe ff ff       	call   801f93 <fsipc>
+}
+  8020c6:	c9                   	leave
+  8020c7:	c3                   	ret
+
+008020c8 <devfile_read>:
+{
+  8020c8:	55                   	push   %ebp
+  8020c9:	89 e5                	mov    %esp,%ebp
+  8020cb:	56                   	push   %esi
+  8020cc:	53                   	push   %ebx
+  8020cd:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020d6:	a3 00 d0 80 00       	mov    %eax,0x80d000
+	fsipcbuf.read.req_n = n;
+  8020db:	89 35 04 d0 80 00    	mov    %esi,0x80d004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020eb:	e8 a3 fe ff ff       	call   801f93 <fsipc>
+  8020f0:	89 c3                	mov    %eax,%ebx
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	78 1f                	js     802115 <devfile_read+0x4d>
+	assert(r <= n);
+  8020f6:	39 c6                	cmp    %eax,%esi
+  8020f8:	72 24                	jb     80211e <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  8020fa:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020ff:	7f 33                	jg     802134 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802101:	83 ec 04             	sub    $0x4,%esp
+  802104:	50                   	push   %eax
+  802105:	68 00 d0 80 00       	push   $0x80d000
+  80210a:	ff 75 0c             	push   0xc(%ebp)
+  80210d:	e8 8a ea ff ff       	call   800b9c <memmove>
+	return r;
+  802112:	83 c4 10             	add    $0x10,%esp
+}
+  802115:	89 d8                	mov    %ebx,%eax
+  802117:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211a:	5b                   	pop    %ebx
+  80211b:	5e                   	pop    %esi
+  80211c:	5d                   	pop    %ebp
+  80211d:	c3                   	ret
+	assert(r <= n);
+  80211e:	68 88 33 80 00       	push   $0x803388
+  802123:	68 8f 33 80 00       	push   $0x80338f
+  802128:	6a 76                	push   $0x76
+  80212a:	68 a4 33 80 00       	push   $0x8033a4
+  80212f:	e8 bf e1 ff ff       	call   8002f3 <_panic>
+	assert(r <= PGSIZE);
+  802134:	68 af 33 80 00       	push   $0x8033af
+  802139:	68 8f 33 80 00       	push   $0x80338f
+  80213e:	6a 77                	push   $0x77
+  802140:	68 a4 33 80 00       	push   $0x8033a4
+  802145:	e8 a9 e1 ff ff       	call   8002f3 <_panic>
+
+0080214a <open>:
+{
+  80214a:	55                   	push   %ebp
+  80214b:	89 e5                	mov    %esp,%ebp
+  80214d:	56                   	push   %esi
+  80214e:	53                   	push   %ebx
+  80214f:	83 ec 1c             	sub    $0x1c,%esp
+  802152:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802155:	56                   	push   %esi
+  802156:	e8 80 e8 ff ff       	call   8009db <strlen>
+  80215b:	83 c4 10             	add    $0x10,%esp
+  80215e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802163:	7f 6c                	jg     8021d1 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802165:	83 ec 0c             	sub    $0xc,%esp
+  802168:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80216b:	50                   	push   %eax
+  80216c:	e8 3a f8 ff ff       	call   8019ab <fd_alloc>
+  802171:	89 c3                	mov    %eax,%ebx
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	85 c0                	test   %eax,%eax
+  802178:	78 3c                	js     8021b6 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80217a:	83 ec 08             	sub    $0x8,%esp
+  80217d:	56                   	push   %esi
+  80217e:	68 00 d0 80 00       	push   $0x80d000
+  802183:	e8 8e e8 ff ff       	call   800a16 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802188:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80218b:	a3 00 d4 80 00       	mov    %eax,0x80d400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802190:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802193:	b8 01 00 00 00       	mov    $0x1,%eax
+  802198:	e8 f6 fd ff ff       	call   801f93 <fsipc>
+  80219d:	89 c3                	mov    %eax,%ebx
+  80219f:	83 c4 10             	add    $0x10,%esp
+  8021a2:	85 c0                	test   %eax,%eax
+  8021a4:	78 19                	js     8021bf <open+0x75>
+	return fd2num(fd);
+  8021a6:	83 ec 0c             	sub    $0xc,%esp
+  8021a9:	ff 75 f4             	push   -0xc(%ebp)
+  8021ac:	e8 d3 f7 ff ff       	call   801984 <fd2num>
+  8021b1:	89 c3                	mov    %eax,%ebx
+  8021b3:	83 c4 10             	add    $0x10,%esp
+}
+  8021b6:	89 d8                	mov    %ebx,%eax
+  8021b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021bb:	5b                   	pop    %ebx
+  8021bc:	5e                   	pop    %esi
+  8021bd:	5d                   	pop    %ebp
+  8021be:	c3                   	ret
+		fd_close(fd, 0);
+  8021bf:	83 ec 08             	sub    $0x8,%esp
+  8021c2:	6a 00                	push   $0x0
+  8021c4:	ff 75 f4             	push   -0xc(%ebp)
+  8021c7:	e8 f8 f8 ff ff       	call   801ac4 <fd_close>
+		return r;
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	eb e5                	jmp    8021b6 <open+0x6c>
+		return -E_BAD_PATH;
+  8021d1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021d6:	eb de                	jmp    8021b6 <open+0x6c>
+
+008021d8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8021d8:	55                   	push   %ebp
+  8021d9:	89 e5                	mov    %esp,%ebp
+  8021db:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8021de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021e8:	e8 a6 fd ff ff       	call   801f93 <fsipc>
+}
+  8021ed:	c9                   	leave
+  8021ee:	c3                   	ret
+
+008021ef <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8021ef:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8021f3:	7f 01                	jg     8021f6 <writebuf+0x7>
+  8021f5:	c3                   	ret
+{
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	53                   	push   %ebx
+  8021fa:	83 ec 08             	sub    $0x8,%esp
+  8021fd:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8021ff:	ff 70 04             	push   0x4(%eax)
+  802202:	8d 40 10             	lea    0x10(%eax),%eax
+  802205:	50                   	push   %eax
+  802206:	ff 33                	push   (%ebx)
+  802208:	e8 68 fb ff ff       	call   801d75 <write>
+		if (result > 0)
+  80220d:	83 c4 10             	add    $0x10,%esp
+  802210:	85 c0                	test   %eax,%eax
+  802212:	7e 03                	jle    802217 <writebuf+0x28>
+			b->result += result;
+  802214:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  802217:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80221a:	74 0d                	je     802229 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  80221c:	85 c0                	test   %eax,%eax
+  80221e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802223:	0f 4f c2             	cmovg  %edx,%eax
+  802226:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  802229:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80222c:	c9                   	leave
+  80222d:	c3                   	ret
+
+0080222e <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80222e:	55                   	push   %ebp
+  80222f:	89 e5                	mov    %esp,%ebp
+  802231:	53                   	push   %ebx
+  802232:	83 ec 04             	sub    $0x4,%esp
+  802235:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  802238:	8b 53 04             	mov    0x4(%ebx),%edx
+  80223b:	8d 42 01             	lea    0x1(%edx),%eax
+  80223e:	89 43 04             	mov    %eax,0x4(%ebx)
+  802241:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802244:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  802248:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80224d:	74 05                	je     802254 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  80224f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802252:	c9                   	leave
+  802253:	c3                   	ret
+		writebuf(b);
+  802254:	89 d8                	mov    %ebx,%eax
+  802256:	e8 94 ff ff ff       	call   8021ef <writebuf>
+		b->idx = 0;
+  80225b:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802262:	eb eb                	jmp    80224f <putch+0x21>
+
+00802264 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802264:	55                   	push   %ebp
+  802265:	89 e5                	mov    %esp,%ebp
+  802267:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80226d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802270:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  802276:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80227d:	00 00 00 
+	b.result = 0;
+  802280:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802287:	00 00 00 
+	b.error = 1;
+  80228a:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802291:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  802294:	ff 75 10             	push   0x10(%ebp)
+  802297:	ff 75 0c             	push   0xc(%ebp)
+  80229a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8022a0:	50                   	push   %eax
+  8022a1:	68 2e 22 80 00       	push   $0x80222e
+  8022a6:	e8 01 e2 ff ff       	call   8004ac <vprintfmt>
+	if (b.idx > 0)
+  8022ab:	83 c4 10             	add    $0x10,%esp
+  8022ae:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  8022b5:	7f 12                	jg     8022c9 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  8022b7:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  8022bd:	85 c0                	test   %eax,%eax
+  8022bf:	75 06                	jne    8022c7 <vfprintf+0x63>
+  8022c1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8022c7:	c9                   	leave
+  8022c8:	c3                   	ret
+		writebuf(&b);
+  8022c9:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8022cf:	e8 1b ff ff ff       	call   8021ef <writebuf>
+  8022d4:	eb e1                	jmp    8022b7 <vfprintf+0x53>
+
+008022d6 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8022d6:	55                   	push   %ebp
+  8022d7:	89 e5                	mov    %esp,%ebp
+  8022d9:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8022dc:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8022df:	50                   	push   %eax
+  8022e0:	ff 75 0c             	push   0xc(%ebp)
+  8022e3:	ff 75 08             	push   0x8(%ebp)
+  8022e6:	e8 79 ff ff ff       	call   802264 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8022eb:	c9                   	leave
+  8022ec:	c3                   	ret
+
+008022ed <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8022ed:	55                   	push   %ebp
+  8022ee:	89 e5                	mov    %esp,%ebp
+  8022f0:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8022f3:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8022f6:	50                   	push   %eax
+  8022f7:	ff 75 08             	push   0x8(%ebp)
+  8022fa:	6a 01                	push   $0x1
+  8022fc:	e8 63 ff ff ff       	call   802264 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802301:	c9                   	leave
+  802302:	c3                   	ret
+
+00802303 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802309:	68 bb 33 80 00       	push   $0x8033bb
+  80230e:	ff 75 0c             	push   0xc(%ebp)
+  802311:	e8 00 e7 ff ff       	call   800a16 <strcpy>
+	return 0;
+}
+  802316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231b:	c9                   	leave
+  80231c:	c3                   	ret
+
+0080231d <devsock_close>:
+{
+  80231d:	55                   	push   %ebp
+  80231e:	89 e5                	mov    %esp,%ebp
+  802320:	53                   	push   %ebx
+  802321:	83 ec 10             	sub    $0x10,%esp
+  802324:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802327:	53                   	push   %ebx
+  802328:	e8 e4 0a 00 00       	call   802e11 <pageref>
+  80232d:	89 c2                	mov    %eax,%edx
+  80232f:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802332:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802337:	83 fa 01             	cmp    $0x1,%edx
+  80233a:	74 05                	je     802341 <devsock_close+0x24>
+}
+  80233c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80233f:	c9                   	leave
+  802340:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802341:	83 ec 0c             	sub    $0xc,%esp
+  802344:	ff 73 0c             	push   0xc(%ebx)
+  802347:	e8 b7 02 00 00       	call   802603 <nsipc_close>
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	eb eb                	jmp    80233c <devsock_close+0x1f>
+
+00802351 <devsock_write>:
+{
+  802351:	55                   	push   %ebp
+  802352:	89 e5                	mov    %esp,%ebp
+  802354:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802357:	6a 00                	push   $0x0
+  802359:	ff 75 10             	push   0x10(%ebp)
+  80235c:	ff 75 0c             	push   0xc(%ebp)
+  80235f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802362:	ff 70 0c             	push   0xc(%eax)
+  802365:	e8 79 03 00 00       	call   8026e3 <nsipc_send>
+}
+  80236a:	c9                   	leave
+  80236b:	c3                   	ret
+
+0080236c <devsock_read>:
+{
+  80236c:	55                   	push   %ebp
+  80236d:	89 e5                	mov    %esp,%ebp
+  80236f:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802372:	6a 00                	push   $0x0
+  802374:	ff 75 10             	push   0x10(%ebp)
+  802377:	ff 75 0c             	push   0xc(%ebp)
+  80237a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80237d:	ff 70 0c             	push   0xc(%eax)
+  802380:	e8 ef 02 00 00       	call   802674 <nsipc_recv>
+}
+  802385:	c9                   	leave
+  802386:	c3                   	ret
+
+00802387 <fd2sockid>:
+{
+  802387:	55                   	push   %ebp
+  802388:	89 e5                	mov    %esp,%ebp
+  80238a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80238d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802390:	52                   	push   %edx
+  802391:	50                   	push   %eax
+  802392:	e8 6a f6 ff ff       	call   801a01 <fd_lookup>
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	78 10                	js     8023ae <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80239e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a1:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8023a7:	39 08                	cmp    %ecx,(%eax)
+  8023a9:	75 05                	jne    8023b0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8023ab:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023b5:	eb f7                	jmp    8023ae <fd2sockid+0x27>
+
+008023b7 <alloc_sockfd>:
+{
+  8023b7:	55                   	push   %ebp
+  8023b8:	89 e5                	mov    %esp,%ebp
+  8023ba:	56                   	push   %esi
+  8023bb:	53                   	push   %ebx
+  8023bc:	83 ec 1c             	sub    $0x1c,%esp
+  8023bf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8023c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023c4:	50                   	push   %eax
+  8023c5:	e8 e1 f5 ff ff       	call   8019ab <fd_alloc>
+  8023ca:	89 c3                	mov    %eax,%ebx
+  8023cc:	83 c4 10             	add    $0x10,%esp
+  8023cf:	85 c0                	test   %eax,%eax
+  8023d1:	78 43                	js     802416 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8023d3:	83 ec 04             	sub    $0x4,%esp
+  8023d6:	68 07 04 00 00       	push   $0x407
+  8023db:	ff 75 f4             	push   -0xc(%ebp)
+  8023de:	6a 00                	push   $0x0
+  8023e0:	e8 29 eb ff ff       	call   800f0e <sys_page_alloc>
+  8023e5:	89 c3                	mov    %eax,%ebx
+  8023e7:	83 c4 10             	add    $0x10,%esp
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	78 28                	js     802416 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8023ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023f1:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8023f7:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8023f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023fc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802403:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802406:	83 ec 0c             	sub    $0xc,%esp
+  802409:	50                   	push   %eax
+  80240a:	e8 75 f5 ff ff       	call   801984 <fd2num>
+  80240f:	89 c3                	mov    %eax,%ebx
+  802411:	83 c4 10             	add    $0x10,%esp
+  802414:	eb 0c                	jmp    802422 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802416:	83 ec 0c             	sub    $0xc,%esp
+  802419:	56                   	push   %esi
+  80241a:	e8 e4 01 00 00       	call   802603 <nsipc_close>
+		return r;
+  80241f:	83 c4 10             	add    $0x10,%esp
+}
+  802422:	89 d8                	mov    %ebx,%eax
+  802424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802427:	5b                   	pop    %ebx
+  802428:	5e                   	pop    %esi
+  802429:	5d                   	pop    %ebp
+  80242a:	c3                   	ret
+
+0080242b <accept>:
+{
+  80242b:	55                   	push   %ebp
+  80242c:	89 e5                	mov    %esp,%ebp
+  80242e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802431:	8b 45 08             	mov    0x8(%ebp),%eax
+  802434:	e8 4e ff ff ff       	call   802387 <fd2sockid>
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	78 1b                	js     802458 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80243d:	83 ec 04             	sub    $0x4,%esp
+  802440:	ff 75 10             	push   0x10(%ebp)
+  802443:	ff 75 0c             	push   0xc(%ebp)
+  802446:	50                   	push   %eax
+  802447:	e8 0e 01 00 00       	call   80255a <nsipc_accept>
+  80244c:	83 c4 10             	add    $0x10,%esp
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	78 05                	js     802458 <accept+0x2d>
+	return alloc_sockfd(r);
+  802453:	e8 5f ff ff ff       	call   8023b7 <alloc_sockfd>
+}
+  802458:	c9                   	leave
+  802459:	c3                   	ret
+
+0080245a <bind>:
+{
+  80245a:	55                   	push   %ebp
+  80245b:	89 e5                	mov    %esp,%ebp
+  80245d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802460:	8b 45 08             	mov    0x8(%ebp),%eax
+  802463:	e8 1f ff ff ff       	call   802387 <fd2sockid>
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	78 12                	js     80247e <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80246c:	83 ec 04             	sub    $0x4,%esp
+  80246f:	ff 75 10             	push   0x10(%ebp)
+  802472:	ff 75 0c             	push   0xc(%ebp)
+  802475:	50                   	push   %eax
+  802476:	e8 31 01 00 00       	call   8025ac <nsipc_bind>
+  80247b:	83 c4 10             	add    $0x10,%esp
+}
+  80247e:	c9                   	leave
+  80247f:	c3                   	ret
+
+00802480 <shutdown>:
+{
+  802480:	55                   	push   %ebp
+  802481:	89 e5                	mov    %esp,%ebp
+  802483:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802486:	8b 45 08             	mov    0x8(%ebp),%eax
+  802489:	e8 f9 fe ff ff       	call   802387 <fd2sockid>
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	78 0f                	js     8024a1 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802492:	83 ec 08             	sub    $0x8,%esp
+  802495:	ff 75 0c             	push   0xc(%ebp)
+  802498:	50                   	push   %eax
+  802499:	e8 43 01 00 00       	call   8025e1 <nsipc_shutdown>
+  80249e:	83 c4 10             	add    $0x10,%esp
+}
+  8024a1:	c9                   	leave
+  8024a2:	c3                   	ret
+
+008024a3 <connect>:
+{
+  8024a3:	55                   	push   %ebp
+  8024a4:	89 e5                	mov    %esp,%ebp
+  8024a6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ac:	e8 d6 fe ff ff       	call   802387 <fd2sockid>
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	78 12                	js     8024c7 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8024b5:	83 ec 04             	sub    $0x4,%esp
+  8024b8:	ff 75 10             	push   0x10(%ebp)
+  8024bb:	ff 75 0c             	push   0xc(%ebp)
+  8024be:	50                   	push   %eax
+  8024bf:	e8 59 01 00 00       	call   80261d <nsipc_connect>
+  8024c4:	83 c4 10             	add    $0x10,%esp
+}
+  8024c7:	c9                   	leave
+  8024c8:	c3                   	ret
+
+008024c9 <listen>:
+{
+  8024c9:	55                   	push   %ebp
+  8024ca:	89 e5                	mov    %esp,%ebp
+  8024cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d2:	e8 b0 fe ff ff       	call   802387 <fd2sockid>
+  8024d7:	85 c0                	test   %eax,%eax
+  8024d9:	78 0f                	js     8024ea <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8024db:	83 ec 08             	sub    $0x8,%esp
+  8024de:	ff 75 0c             	push   0xc(%ebp)
+  8024e1:	50                   	push   %eax
+  8024e2:	e8 6b 01 00 00       	call   802652 <nsipc_listen>
+  8024e7:	83 c4 10             	add    $0x10,%esp
+}
+  8024ea:	c9                   	leave
+  8024eb:	c3                   	ret
+
+008024ec <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8024ec:	55                   	push   %ebp
+  8024ed:	89 e5                	mov    %esp,%ebp
+  8024ef:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8024f2:	ff 75 10             	push   0x10(%ebp)
+  8024f5:	ff 75 0c             	push   0xc(%ebp)
+  8024f8:	ff 75 08             	push   0x8(%ebp)
+  8024fb:	e8 41 02 00 00       	call   802741 <nsipc_socket>
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	85 c0                	test   %eax,%eax
+  802505:	78 05                	js     80250c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802507:	e8 ab fe ff ff       	call   8023b7 <alloc_sockfd>
+}
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+
+0080250e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80250e:	55                   	push   %ebp
+  80250f:	89 e5                	mov    %esp,%ebp
+  802511:	53                   	push   %ebx
+  802512:	83 ec 04             	sub    $0x4,%esp
+  802515:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802517:	83 3d 04 c0 80 00 00 	cmpl   $0x0,0x80c004
+  80251e:	74 26                	je     802546 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802520:	6a 07                	push   $0x7
+  802522:	68 00 e0 80 00       	push   $0x80e000
+  802527:	53                   	push   %ebx
+  802528:	ff 35 04 c0 80 00    	push   0x80c004
+  80252e:	e8 4b 08 00 00       	call   802d7e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802533:	83 c4 0c             	add    $0xc,%esp
+  802536:	6a 00                	push   $0x0
+  802538:	6a 00                	push   $0x0
+  80253a:	6a 00                	push   $0x0
+  80253c:	e8 25 08 00 00       	call   802d66 <ipc_recv>
+}
+  802541:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802544:	c9                   	leave
+  802545:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802546:	83 ec 0c             	sub    $0xc,%esp
+  802549:	6a 02                	push   $0x2
+  80254b:	e8 82 08 00 00       	call   802dd2 <ipc_find_env>
+  802550:	a3 04 c0 80 00       	mov    %eax,0x80c004
+  802555:	83 c4 10             	add    $0x10,%esp
+  802558:	eb c6                	jmp    802520 <nsipc+0x12>
+
+0080255a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80255a:	55                   	push   %ebp
+  80255b:	89 e5                	mov    %esp,%ebp
+  80255d:	56                   	push   %esi
+  80255e:	53                   	push   %ebx
+  80255f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802562:	8b 45 08             	mov    0x8(%ebp),%eax
+  802565:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80256a:	8b 06                	mov    (%esi),%eax
+  80256c:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802571:	b8 01 00 00 00       	mov    $0x1,%eax
+  802576:	e8 93 ff ff ff       	call   80250e <nsipc>
+  80257b:	89 c3                	mov    %eax,%ebx
+  80257d:	85 c0                	test   %eax,%eax
+  80257f:	79 09                	jns    80258a <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802581:	89 d8                	mov    %ebx,%eax
+  802583:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802586:	5b                   	pop    %ebx
+  802587:	5e                   	pop    %esi
+  802588:	5d                   	pop    %ebp
+  802589:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80258a:	83 ec 04             	sub    $0x4,%esp
+  80258d:	ff 35 10 e0 80 00    	push   0x80e010
+  802593:	68 00 e0 80 00       	push   $0x80e000
+  802598:	ff 75 0c             	push   0xc(%ebp)
+  80259b:	e8 fc e5 ff ff       	call   800b9c <memmove>
+		*addrlen = ret->ret_addrlen;
+  8025a0:	a1 10 e0 80 00       	mov    0x80e010,%eax
+  8025a5:	89 06                	mov    %eax,(%esi)
+  8025a7:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8025aa:	eb d5                	jmp    802581 <nsipc_accept+0x27>
+
+008025ac <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8025ac:	55                   	push   %ebp
+  8025ad:	89 e5                	mov    %esp,%ebp
+  8025af:	53                   	push   %ebx
+  8025b0:	83 ec 08             	sub    $0x8,%esp
+  8025b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8025b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b9:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8025be:	53                   	push   %ebx
+  8025bf:	ff 75 0c             	push   0xc(%ebp)
+  8025c2:	68 04 e0 80 00       	push   $0x80e004
+  8025c7:	e8 d0 e5 ff ff       	call   800b9c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8025cc:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_BIND);
+  8025d2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8025d7:	e8 32 ff ff ff       	call   80250e <nsipc>
+}
+  8025dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025df:	c9                   	leave
+  8025e0:	c3                   	ret
+
+008025e1 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8025e1:	55                   	push   %ebp
+  8025e2:	89 e5                	mov    %esp,%ebp
+  8025e4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8025e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ea:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.shutdown.req_how = how;
+  8025ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025f2:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_SHUTDOWN);
+  8025f7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025fc:	e8 0d ff ff ff       	call   80250e <nsipc>
+}
+  802601:	c9                   	leave
+  802602:	c3                   	ret
+
+00802603 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802603:	55                   	push   %ebp
+  802604:	89 e5                	mov    %esp,%ebp
+  802606:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802609:	8b 45 08             	mov    0x8(%ebp),%eax
+  80260c:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	return nsipc(NSREQ_CLOSE);
+  802611:	b8 04 00 00 00       	mov    $0x4,%eax
+  802616:	e8 f3 fe ff ff       	call   80250e <nsipc>
+}
+  80261b:	c9                   	leave
+  80261c:	c3                   	ret
+
+0080261d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80261d:	55                   	push   %ebp
+  80261e:	89 e5                	mov    %esp,%ebp
+  802620:	53                   	push   %ebx
+  802621:	83 ec 08             	sub    $0x8,%esp
+  802624:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802627:	8b 45 08             	mov    0x8(%ebp),%eax
+  80262a:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80262f:	53                   	push   %ebx
+  802630:	ff 75 0c             	push   0xc(%ebp)
+  802633:	68 04 e0 80 00       	push   $0x80e004
+  802638:	e8 5f e5 ff ff       	call   800b9c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80263d:	89 1d 14 e0 80 00    	mov    %ebx,0x80e014
+	return nsipc(NSREQ_CONNECT);
+  802643:	b8 05 00 00 00       	mov    $0x5,%eax
+  802648:	e8 c1 fe ff ff       	call   80250e <nsipc>
+}
+  80264d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802650:	c9                   	leave
+  802651:	c3                   	ret
+
+00802652 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802652:	55                   	push   %ebp
+  802653:	89 e5                	mov    %esp,%ebp
+  802655:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802658:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265b:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.listen.req_backlog = backlog;
+  802660:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802663:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	return nsipc(NSREQ_LISTEN);
+  802668:	b8 06 00 00 00       	mov    $0x6,%eax
+  80266d:	e8 9c fe ff ff       	call   80250e <nsipc>
+}
+  802672:	c9                   	leave
+  802673:	c3                   	ret
+
+00802674 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802674:	55                   	push   %ebp
+  802675:	89 e5                	mov    %esp,%ebp
+  802677:	56                   	push   %esi
+  802678:	53                   	push   %ebx
+  802679:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80267c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80267f:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.recv.req_len = len;
+  802684:	89 35 04 e0 80 00    	mov    %esi,0x80e004
+	nsipcbuf.recv.req_flags = flags;
+  80268a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80268d:	a3 08 e0 80 00       	mov    %eax,0x80e008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802692:	b8 07 00 00 00       	mov    $0x7,%eax
+  802697:	e8 72 fe ff ff       	call   80250e <nsipc>
+  80269c:	89 c3                	mov    %eax,%ebx
+  80269e:	85 c0                	test   %eax,%eax
+  8026a0:	78 22                	js     8026c4 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8026a2:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8026a7:	39 c6                	cmp    %eax,%esi
+  8026a9:	0f 4e c6             	cmovle %esi,%eax
+  8026ac:	39 c3                	cmp    %eax,%ebx
+  8026ae:	7f 1d                	jg     8026cd <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8026b0:	83 ec 04             	sub    $0x4,%esp
+  8026b3:	53                   	push   %ebx
+  8026b4:	68 00 e0 80 00       	push   $0x80e000
+  8026b9:	ff 75 0c             	push   0xc(%ebp)
+  8026bc:	e8 db e4 ff ff       	call   800b9c <memmove>
+  8026c1:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8026c4:	89 d8                	mov    %ebx,%eax
+  8026c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026c9:	5b                   	pop    %ebx
+  8026ca:	5e                   	pop    %esi
+  8026cb:	5d                   	pop    %ebp
+  8026cc:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8026cd:	68 c7 33 80 00       	push   $0x8033c7
+  8026d2:	68 8f 33 80 00       	push   $0x80338f
+  8026d7:	6a 62                	push   $0x62
+  8026d9:	68 dc 33 80 00       	push   $0x8033dc
+  8026de:	e8 10 dc ff ff       	call   8002f3 <_panic>
+
+008026e3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8026e3:	55                   	push   %ebp
+  8026e4:	89 e5                	mov    %esp,%ebp
+  8026e6:	53                   	push   %ebx
+  8026e7:	83 ec 04             	sub    $0x4,%esp
+  8026ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8026ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f0:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	assert(size < 1600);
+  8026f5:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8026fb:	7f 2e                	jg     80272b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8026fd:	83 ec 04             	sub    $0x4,%esp
+  802700:	53                   	push   %ebx
+  802701:	ff 75 0c             	push   0xc(%ebp)
+  802704:	68 0c e0 80 00       	push   $0x80e00c
+  802709:	e8 8e e4 ff ff       	call   800b9c <memmove>
+	nsipcbuf.send.req_size = size;
+  80270e:	89 1d 04 e0 80 00    	mov    %ebx,0x80e004
+	nsipcbuf.send.req_flags = flags;
+  802714:	8b 45 14             	mov    0x14(%ebp),%eax
+  802717:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SEND);
+  80271c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802721:	e8 e8 fd ff ff       	call   80250e <nsipc>
+}
+  802726:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802729:	c9                   	leave
+  80272a:	c3                   	ret
+	assert(size < 1600);
+  80272b:	68 e8 33 80 00       	push   $0x8033e8
+  802730:	68 8f 33 80 00       	push   $0x80338f
+  802735:	6a 6d                	push   $0x6d
+  802737:	68 dc 33 80 00       	push   $0x8033dc
+  80273c:	e8 b2 db ff ff       	call   8002f3 <_panic>
+
+00802741 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802741:	55                   	push   %ebp
+  802742:	89 e5                	mov    %esp,%ebp
+  802744:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802747:	8b 45 08             	mov    0x8(%ebp),%eax
+  80274a:	a3 00 e0 80 00       	mov    %eax,0x80e000
+	nsipcbuf.socket.req_type = type;
+  80274f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802752:	a3 04 e0 80 00       	mov    %eax,0x80e004
+	nsipcbuf.socket.req_protocol = protocol;
+  802757:	8b 45 10             	mov    0x10(%ebp),%eax
+  80275a:	a3 08 e0 80 00       	mov    %eax,0x80e008
+	return nsipc(NSREQ_SOCKET);
+  80275f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802764:	e8 a5 fd ff ff       	call   80250e <nsipc>
+}
+  802769:	c9                   	leave
+  80276a:	c3                   	ret
+
+0080276b <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80276b:	55                   	push   %ebp
+  80276c:	89 e5                	mov    %esp,%ebp
+  80276e:	56                   	push   %esi
+  80276f:	53                   	push   %ebx
+  802770:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802773:	83 ec 0c             	sub    $0xc,%esp
+  802776:	ff 75 08             	push   0x8(%ebp)
+  802779:	e8 16 f2 ff ff       	call   801994 <fd2data>
+  80277e:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802780:	83 c4 08             	add    $0x8,%esp
+  802783:	68 f4 33 80 00       	push   $0x8033f4
+  802788:	53                   	push   %ebx
+  802789:	e8 88 e2 ff ff       	call   800a16 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80278e:	8b 46 04             	mov    0x4(%esi),%eax
+  802791:	2b 06                	sub    (%esi),%eax
+  802793:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802799:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8027a0:	00 00 00 
+	stat->st_dev = &devpipe;
+  8027a3:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8027aa:	40 80 00 
+	return 0;
+}
+  8027ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027b5:	5b                   	pop    %ebx
+  8027b6:	5e                   	pop    %esi
+  8027b7:	5d                   	pop    %ebp
+  8027b8:	c3                   	ret
+
+008027b9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	53                   	push   %ebx
+  8027bd:	83 ec 0c             	sub    $0xc,%esp
+  8027c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8027c3:	53                   	push   %ebx
+  8027c4:	6a 00                	push   $0x0
+  8027c6:	e8 1e e8 ff ff       	call   800fe9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8027cb:	89 1c 24             	mov    %ebx,(%esp)
+  8027ce:	e8 c1 f1 ff ff       	call   801994 <fd2data>
+  8027d3:	83 c4 08             	add    $0x8,%esp
+  8027d6:	50                   	push   %eax
+  8027d7:	6a 00                	push   $0x0
+  8027d9:	e8 0b e8 ff ff       	call   800fe9 <sys_page_unmap>
+}
+  8027de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027e1:	c9                   	leave
+  8027e2:	c3                   	ret
+
+008027e3 <_pipeisclosed>:
+{
+  8027e3:	55                   	push   %ebp
+  8027e4:	89 e5                	mov    %esp,%ebp
+  8027e6:	57                   	push   %edi
+  8027e7:	56                   	push   %esi
+  8027e8:	53                   	push   %ebx
+  8027e9:	83 ec 1c             	sub    $0x1c,%esp
+  8027ec:	89 c7                	mov    %eax,%edi
+  8027ee:	89 d6                	mov    %edx,%esi
+  8027f0:	eb 3c                	jmp    80282e <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8027f2:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8027f5:	83 ec 0c             	sub    $0xc,%esp
+  8027f8:	57                   	push   %edi
+  8027f9:	e8 13 06 00 00       	call   802e11 <pageref>
+  8027fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802801:	89 34 24             	mov    %esi,(%esp)
+  802804:	e8 08 06 00 00       	call   802e11 <pageref>
+  802809:	89 c2                	mov    %eax,%edx
+  80280b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80280d:	05 00 00 00 20       	add    $0x20000000,%eax
+  802812:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  802815:	8b 0d 08 c0 80 00    	mov    0x80c008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80281b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802820:	76 31                	jbe    802853 <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  802822:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  802825:	39 c3                	cmp    %eax,%ebx
+  802827:	74 76                	je     80289f <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  802829:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80282c:	74 36                	je     802864 <_pipeisclosed+0x81>
+  80282e:	89 e0                	mov    %esp,%eax
+  802830:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802835:	8b 15 08 c0 80 00    	mov    0x80c008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80283b:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802840:	77 b0                	ja     8027f2 <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802842:	c1 e8 10             	shr    $0x10,%eax
+  802845:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80284b:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802851:	eb 9f                	jmp    8027f2 <_pipeisclosed+0xf>
+  802853:	c1 e8 10             	shr    $0x10,%eax
+  802856:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80285c:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  802862:	eb be                	jmp    802822 <_pipeisclosed+0x3f>
+  802864:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802866:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  80286b:	8b 15 08 c0 80 00    	mov    0x80c008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802871:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802876:	76 16                	jbe    80288e <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802878:	8b 42 58             	mov    0x58(%edx),%eax
+  80287b:	6a 01                	push   $0x1
+  80287d:	50                   	push   %eax
+  80287e:	53                   	push   %ebx
+  80287f:	68 fb 33 80 00       	push   $0x8033fb
+  802884:	e8 45 db ff ff       	call   8003ce <cprintf>
+  802889:	83 c4 10             	add    $0x10,%esp
+  80288c:	eb a0                	jmp    80282e <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80288e:	c1 e8 10             	shr    $0x10,%eax
+  802891:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802897:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80289d:	eb d9                	jmp    802878 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80289f:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8028a2:	0f 94 c0             	sete   %al
+  8028a5:	0f b6 c0             	movzbl %al,%eax
+}
+  8028a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ab:	5b                   	pop    %ebx
+  8028ac:	5e                   	pop    %esi
+  8028ad:	5f                   	pop    %edi
+  8028ae:	5d                   	pop    %ebp
+  8028af:	c3                   	ret
+
+008028b0 <devpipe_write>:
+{
+  8028b0:	55                   	push   %ebp
+  8028b1:	89 e5                	mov    %esp,%ebp
+  8028b3:	57                   	push   %edi
+  8028b4:	56                   	push   %esi
+  8028b5:	53                   	push   %ebx
+  8028b6:	83 ec 28             	sub    $0x28,%esp
+  8028b9:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8028bc:	56                   	push   %esi
+  8028bd:	e8 d2 f0 ff ff       	call   801994 <fd2data>
+  8028c2:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8028c4:	83 c4 10             	add    $0x10,%esp
+  8028c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028cc:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028cf:	75 09                	jne    8028da <devpipe_write+0x2a>
+	return i;
+  8028d1:	89 f8                	mov    %edi,%eax
+  8028d3:	eb 23                	jmp    8028f8 <devpipe_write+0x48>
+			sys_yield();
+  8028d5:	e8 ee e5 ff ff       	call   800ec8 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028da:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028dd:	8b 0b                	mov    (%ebx),%ecx
+  8028df:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028e2:	39 d0                	cmp    %edx,%eax
+  8028e4:	72 1a                	jb     802900 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8028e6:	89 da                	mov    %ebx,%edx
+  8028e8:	89 f0                	mov    %esi,%eax
+  8028ea:	e8 f4 fe ff ff       	call   8027e3 <_pipeisclosed>
+  8028ef:	85 c0                	test   %eax,%eax
+  8028f1:	74 e2                	je     8028d5 <devpipe_write+0x25>
+				return 0;
+  8028f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028fb:	5b                   	pop    %ebx
+  8028fc:	5e                   	pop    %esi
+  8028fd:	5f                   	pop    %edi
+  8028fe:	5d                   	pop    %ebp
+  8028ff:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802900:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802903:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802907:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80290a:	89 c2                	mov    %eax,%edx
+  80290c:	c1 fa 1f             	sar    $0x1f,%edx
+  80290f:	89 d1                	mov    %edx,%ecx
+  802911:	c1 e9 1b             	shr    $0x1b,%ecx
+  802914:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802917:	83 e2 1f             	and    $0x1f,%edx
+  80291a:	29 ca                	sub    %ecx,%edx
+  80291c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802920:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802924:	83 c0 01             	add    $0x1,%eax
+  802927:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80292a:	83 c7 01             	add    $0x1,%edi
+  80292d:	eb 9d                	jmp    8028cc <devpipe_write+0x1c>
+
+0080292f <devpipe_read>:
+{
+  80292f:	55                   	push   %ebp
+  802930:	89 e5                	mov    %esp,%ebp
+  802932:	57                   	push   %edi
+  802933:	56                   	push   %esi
+  802934:	53                   	push   %ebx
+  802935:	83 ec 18             	sub    $0x18,%esp
+  802938:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80293b:	57                   	push   %edi
+  80293c:	e8 53 f0 ff ff       	call   801994 <fd2data>
+  802941:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802943:	83 c4 10             	add    $0x10,%esp
+  802946:	be 00 00 00 00       	mov    $0x0,%esi
+  80294b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80294e:	75 13                	jne    802963 <devpipe_read+0x34>
+	return i;
+  802950:	89 f0                	mov    %esi,%eax
+  802952:	eb 02                	jmp    802956 <devpipe_read+0x27>
+				return i;
+  802954:	89 f0                	mov    %esi,%eax
+}
+  802956:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802959:	5b                   	pop    %ebx
+  80295a:	5e                   	pop    %esi
+  80295b:	5f                   	pop    %edi
+  80295c:	5d                   	pop    %ebp
+  80295d:	c3                   	ret
+			sys_yield();
+  80295e:	e8 65 e5 ff ff       	call   800ec8 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802963:	8b 03                	mov    (%ebx),%eax
+  802965:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802968:	75 18                	jne    802982 <devpipe_read+0x53>
+			if (i > 0)
+  80296a:	85 f6                	test   %esi,%esi
+  80296c:	75 e6                	jne    802954 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80296e:	89 da                	mov    %ebx,%edx
+  802970:	89 f8                	mov    %edi,%eax
+  802972:	e8 6c fe ff ff       	call   8027e3 <_pipeisclosed>
+  802977:	85 c0                	test   %eax,%eax
+  802979:	74 e3                	je     80295e <devpipe_read+0x2f>
+				return 0;
+  80297b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802980:	eb d4                	jmp    802956 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802982:	99                   	cltd
+  802983:	c1 ea 1b             	shr    $0x1b,%edx
+  802986:	01 d0                	add    %edx,%eax
+  802988:	83 e0 1f             	and    $0x1f,%eax
+  80298b:	29 d0                	sub    %edx,%eax
+  80298d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802992:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802995:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802998:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  80299b:	83 c6 01             	add    $0x1,%esi
+  80299e:	eb ab                	jmp    80294b <devpipe_read+0x1c>
+
+008029a0 <pipe>:
+{
+  8029a0:	55                   	push   %ebp
+  8029a1:	89 e5                	mov    %esp,%ebp
+  8029a3:	56                   	push   %esi
+  8029a4:	53                   	push   %ebx
+  8029a5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8029a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029ab:	50                   	push   %eax
+  8029ac:	e8 fa ef ff ff       	call   8019ab <fd_alloc>
+  8029b1:	89 c3                	mov    %eax,%ebx
+  8029b3:	83 c4 10             	add    $0x10,%esp
+  8029b6:	85 c0                	test   %eax,%eax
+  8029b8:	0f 88 23 01 00 00    	js     802ae1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029be:	83 ec 04             	sub    $0x4,%esp
+  8029c1:	68 07 04 00 00       	push   $0x407
+  8029c6:	ff 75 f4             	push   -0xc(%ebp)
+  8029c9:	6a 00                	push   $0x0
+  8029cb:	e8 3e e5 ff ff       	call   800f0e <sys_page_alloc>
+  8029d0:	89 c3                	mov    %eax,%ebx
+  8029d2:	83 c4 10             	add    $0x10,%esp
+  8029d5:	85 c0                	test   %eax,%eax
+  8029d7:	0f 88 04 01 00 00    	js     802ae1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8029dd:	83 ec 0c             	sub    $0xc,%esp
+  8029e0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8029e3:	50                   	push   %eax
+  8029e4:	e8 c2 ef ff ff       	call   8019ab <fd_alloc>
+  8029e9:	89 c3                	mov    %eax,%ebx
+  8029eb:	83 c4 10             	add    $0x10,%esp
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	0f 88 db 00 00 00    	js     802ad1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029f6:	83 ec 04             	sub    $0x4,%esp
+  8029f9:	68 07 04 00 00       	push   $0x407
+  8029fe:	ff 75 f0             	push   -0x10(%ebp)
+  802a01:	6a 00                	push   $0x0
+  802a03:	e8 06 e5 ff ff       	call   800f0e <sys_page_alloc>
+  802a08:	89 c3                	mov    %eax,%ebx
+  802a0a:	83 c4 10             	add    $0x10,%esp
+  802a0d:	85 c0                	test   %eax,%eax
+  802a0f:	0f 88 bc 00 00 00    	js     802ad1 <pipe+0x131>
+	va = fd2data(fd0);
+  802a15:	83 ec 0c             	sub    $0xc,%esp
+  802a18:	ff 75 f4             	push   -0xc(%ebp)
+  802a1b:	e8 74 ef ff ff       	call   801994 <fd2data>
+  802a20:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a22:	83 c4 0c             	add    $0xc,%esp
+  802a25:	68 07 04 00 00       	push   $0x407
+  802a2a:	50                   	push   %eax
+  802a2b:	6a 00                	push   $0x0
+  802a2d:	e8 dc e4 ff ff       	call   800f0e <sys_page_alloc>
+  802a32:	89 c3                	mov    %eax,%ebx
+  802a34:	83 c4 10             	add    $0x10,%esp
+  802a37:	85 c0                	test   %eax,%eax
+  802a39:	0f 88 82 00 00 00    	js     802ac1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a3f:	83 ec 0c             	sub    $0xc,%esp
+  802a42:	ff 75 f0             	push   -0x10(%ebp)
+  802a45:	e8 4a ef ff ff       	call   801994 <fd2data>
+  802a4a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a51:	50                   	push   %eax
+  802a52:	6a 00                	push   $0x0
+  802a54:	56                   	push   %esi
+  802a55:	6a 00                	push   $0x0
+  802a57:	e8 1f e5 ff ff       	call   800f7b <sys_page_map>
+  802a5c:	89 c3                	mov    %eax,%ebx
+  802a5e:	83 c4 20             	add    $0x20,%esp
+  802a61:	85 c0                	test   %eax,%eax
+  802a63:	78 4e                	js     802ab3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802a65:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802a6a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a6d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802a6f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802a72:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802a79:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802a7c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802a7e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802a81:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802a88:	83 ec 0c             	sub    $0xc,%esp
+  802a8b:	ff 75 f4             	push   -0xc(%ebp)
+  802a8e:	e8 f1 ee ff ff       	call   801984 <fd2num>
+  802a93:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a96:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802a98:	83 c4 04             	add    $0x4,%esp
+  802a9b:	ff 75 f0             	push   -0x10(%ebp)
+  802a9e:	e8 e1 ee ff ff       	call   801984 <fd2num>
+  802aa3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802aa6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802aa9:	83 c4 10             	add    $0x10,%esp
+  802aac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ab1:	eb 2e                	jmp    802ae1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802ab3:	83 ec 08             	sub    $0x8,%esp
+  802ab6:	56                   	push   %esi
+  802ab7:	6a 00                	push   $0x0
+  802ab9:	e8 2b e5 ff ff       	call   800fe9 <sys_page_unmap>
+  802abe:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802ac1:	83 ec 08             	sub    $0x8,%esp
+  802ac4:	ff 75 f0             	push   -0x10(%ebp)
+  802ac7:	6a 00                	push   $0x0
+  802ac9:	e8 1b e5 ff ff       	call   800fe9 <sys_page_unmap>
+  802ace:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802ad1:	83 ec 08             	sub    $0x8,%esp
+  802ad4:	ff 75 f4             	push   -0xc(%ebp)
+  802ad7:	6a 00                	push   $0x0
+  802ad9:	e8 0b e5 ff ff       	call   800fe9 <sys_page_unmap>
+  802ade:	83 c4 10             	add    $0x10,%esp
+}
+  802ae1:	89 d8                	mov    %ebx,%eax
+  802ae3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae6:	5b                   	pop    %ebx
+  802ae7:	5e                   	pop    %esi
+  802ae8:	5d                   	pop    %ebp
+  802ae9:	c3                   	ret
+
+00802aea <pipeisclosed>:
+{
+  802aea:	55                   	push   %ebp
+  802aeb:	89 e5                	mov    %esp,%ebp
+  802aed:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802af0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802af3:	50                   	push   %eax
+  802af4:	ff 75 08             	push   0x8(%ebp)
+  802af7:	e8 05 ef ff ff       	call   801a01 <fd_lookup>
+  802afc:	83 c4 10             	add    $0x10,%esp
+  802aff:	85 c0                	test   %eax,%eax
+  802b01:	78 18                	js     802b1b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802b03:	83 ec 0c             	sub    $0xc,%esp
+  802b06:	ff 75 f4             	push   -0xc(%ebp)
+  802b09:	e8 86 ee ff ff       	call   801994 <fd2data>
+  802b0e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802b10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b13:	e8 cb fc ff ff       	call   8027e3 <_pipeisclosed>
+  802b18:	83 c4 10             	add    $0x10,%esp
+}
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+00802b1d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b22:	c3                   	ret
+
+00802b23 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b23:	55                   	push   %ebp
+  802b24:	89 e5                	mov    %esp,%ebp
+  802b26:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802b29:	68 13 34 80 00       	push   $0x803413
+  802b2e:	ff 75 0c             	push   0xc(%ebp)
+  802b31:	e8 e0 de ff ff       	call   800a16 <strcpy>
+	return 0;
+}
+  802b36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3b:	c9                   	leave
+  802b3c:	c3                   	ret
+
+00802b3d <devcons_write>:
+{
+  802b3d:	55                   	push   %ebp
+  802b3e:	89 e5                	mov    %esp,%ebp
+  802b40:	57                   	push   %edi
+  802b41:	56                   	push   %esi
+  802b42:	53                   	push   %ebx
+  802b43:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802b49:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802b4e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802b54:	eb 2e                	jmp    802b84 <devcons_write+0x47>
+		m = n - tot;
+  802b56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b59:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802b5b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b60:	39 c3                	cmp    %eax,%ebx
+  802b62:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802b65:	83 ec 04             	sub    $0x4,%esp
+  802b68:	53                   	push   %ebx
+  802b69:	89 f0                	mov    %esi,%eax
+  802b6b:	03 45 0c             	add    0xc(%ebp),%eax
+  802b6e:	50                   	push   %eax
+  802b6f:	57                   	push   %edi
+  802b70:	e8 27 e0 ff ff       	call   800b9c <memmove>
+		sys_cputs(buf, m);
+  802b75:	83 c4 08             	add    $0x8,%esp
+  802b78:	53                   	push   %ebx
+  802b79:	57                   	push   %edi
+  802b7a:	e8 10 e2 ff ff       	call   800d8f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802b7f:	01 de                	add    %ebx,%esi
+  802b81:	83 c4 10             	add    $0x10,%esp
+  802b84:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802b87:	72 cd                	jb     802b56 <devcons_write+0x19>
+}
+  802b89:	89 f0                	mov    %esi,%eax
+  802b8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b8e:	5b                   	pop    %ebx
+  802b8f:	5e                   	pop    %esi
+  802b90:	5f                   	pop    %edi
+  802b91:	5d                   	pop    %ebp
+  802b92:	c3                   	ret
+
+00802b93 <devcons_read>:
+{
+  802b93:	55                   	push   %ebp
+  802b94:	89 e5                	mov    %esp,%ebp
+  802b96:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ba2:	75 07                	jne    802bab <devcons_read+0x18>
+  802ba4:	eb 1f                	jmp    802bc5 <devcons_read+0x32>
+		sys_yield();
+  802ba6:	e8 1d e3 ff ff       	call   800ec8 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802bab:	e8 23 e2 ff ff       	call   800dd3 <sys_cgetc>
+  802bb0:	85 c0                	test   %eax,%eax
+  802bb2:	74 f2                	je     802ba6 <devcons_read+0x13>
+	if (c < 0)
+  802bb4:	78 0f                	js     802bc5 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802bb6:	83 f8 04             	cmp    $0x4,%eax
+  802bb9:	74 0c                	je     802bc7 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802bbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bbe:	88 02                	mov    %al,(%edx)
+	return 1;
+  802bc0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802bc5:	c9                   	leave
+  802bc6:	c3                   	ret
+		return 0;
+  802bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcc:	eb f7                	jmp    802bc5 <devcons_read+0x32>
+
+00802bce <cputchar>:
+{
+  802bce:	55                   	push   %ebp
+  802bcf:	89 e5                	mov    %esp,%ebp
+  802bd1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802bd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802bda:	6a 01                	push   $0x1
+  802bdc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bdf:	50                   	push   %eax
+  802be0:	e8 aa e1 ff ff       	call   800d8f <sys_cputs>
+}
+  802be5:	83 c4 10             	add    $0x10,%esp
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+
+00802bea <getchar>:
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802bf0:	6a 01                	push   $0x1
+  802bf2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bf5:	50                   	push   %eax
+  802bf6:	6a 00                	push   $0x0
+  802bf8:	e8 8a f0 ff ff       	call   801c87 <read>
+	if (r < 0)
+  802bfd:	83 c4 10             	add    $0x10,%esp
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	78 06                	js     802c0a <getchar+0x20>
+	if (r < 1)
+  802c04:	74 06                	je     802c0c <getchar+0x22>
+	return c;
+  802c06:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c0a:	c9                   	leave
+  802c0b:	c3                   	ret
+		return -E_EOF;
+  802c0c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c11:	eb f7                	jmp    802c0a <getchar+0x20>
+
+00802c13 <iscons>:
+{
+  802c13:	55                   	push   %ebp
+  802c14:	89 e5                	mov    %esp,%ebp
+  802c16:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c1c:	50                   	push   %eax
+  802c1d:	ff 75 08             	push   0x8(%ebp)
+  802c20:	e8 dc ed ff ff       	call   801a01 <fd_lookup>
+  802c25:	83 c4 10             	add    $0x10,%esp
+  802c28:	85 c0                	test   %eax,%eax
+  802c2a:	78 11                	js     802c3d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802c2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c2f:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c35:	39 10                	cmp    %edx,(%eax)
+  802c37:	0f 94 c0             	sete   %al
+  802c3a:	0f b6 c0             	movzbl %al,%eax
+}
+  802c3d:	c9                   	leave
+  802c3e:	c3                   	ret
+
+00802c3f <opencons>:
+{
+  802c3f:	55                   	push   %ebp
+  802c40:	89 e5                	mov    %esp,%ebp
+  802c42:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802c45:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c48:	50                   	push   %eax
+  802c49:	e8 5d ed ff ff       	call   8019ab <fd_alloc>
+  802c4e:	83 c4 10             	add    $0x10,%esp
+  802c51:	85 c0                	test   %eax,%eax
+  802c53:	78 3a                	js     802c8f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c55:	83 ec 04             	sub    $0x4,%esp
+  802c58:	68 07 04 00 00       	push   $0x407
+  802c5d:	ff 75 f4             	push   -0xc(%ebp)
+  802c60:	6a 00                	push   $0x0
+  802c62:	e8 a7 e2 ff ff       	call   800f0e <sys_page_alloc>
+  802c67:	83 c4 10             	add    $0x10,%esp
+  802c6a:	85 c0                	test   %eax,%eax
+  802c6c:	78 21                	js     802c8f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802c6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c71:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802c77:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c7c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802c83:	83 ec 0c             	sub    $0xc,%esp
+  802c86:	50                   	push   %eax
+  802c87:	e8 f8 ec ff ff       	call   801984 <fd2num>
+  802c8c:	83 c4 10             	add    $0x10,%esp
+}
+  802c8f:	c9                   	leave
+  802c90:	c3                   	ret
+
+00802c91 <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802c91:	55                   	push   %ebp
+  802c92:	89 e5                	mov    %esp,%ebp
+  802c94:	56                   	push   %esi
+  802c95:	53                   	push   %ebx
+  802c96:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802c9f:	85 c0                	test   %eax,%eax
+  802ca1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802ca6:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802ca9:	83 ec 08             	sub    $0x8,%esp
+  802cac:	ff 75 14             	push   0x14(%ebp)
+  802caf:	50                   	push   %eax
+  802cb0:	e8 6a e6 ff ff       	call   80131f <sys_ipc_recv_until>
+  802cb5:	83 c4 10             	add    $0x10,%esp
+  802cb8:	85 c0                	test   %eax,%eax
+  802cba:	78 61                	js     802d1d <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802cbc:	85 f6                	test   %esi,%esi
+  802cbe:	74 1c                	je     802cdc <ipc_recv_until+0x4b>
+  802cc0:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802cc2:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802cc7:	8b 15 08 c0 80 00    	mov    0x80c008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ccd:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cd2:	76 5f                	jbe    802d33 <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802cd4:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802cda:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802cdc:	85 db                	test   %ebx,%ebx
+  802cde:	74 1c                	je     802cfc <ipc_recv_until+0x6b>
+  802ce0:	89 e0                	mov    %esp,%eax
+  802ce2:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802ce7:	8b 15 08 c0 80 00    	mov    0x80c008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ced:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802cf2:	76 50                	jbe    802d44 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802cf4:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802cfa:	89 03                	mov    %eax,(%ebx)
+  802cfc:	89 e0                	mov    %esp,%eax
+  802cfe:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802d03:	8b 15 08 c0 80 00    	mov    0x80c008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802d09:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802d0e:	76 45                	jbe    802d55 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802d10:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802d16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d19:	5b                   	pop    %ebx
+  802d1a:	5e                   	pop    %esi
+  802d1b:	5d                   	pop    %ebp
+  802d1c:	c3                   	ret
+		if (from_env_store)
+  802d1d:	85 f6                	test   %esi,%esi
+  802d1f:	74 06                	je     802d27 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802d21:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802d27:	85 db                	test   %ebx,%ebx
+  802d29:	74 eb                	je     802d16 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802d2b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802d31:	eb e3                	jmp    802d16 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802d33:	c1 e8 10             	shr    $0x10,%eax
+  802d36:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d3c:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d42:	eb 90                	jmp    802cd4 <ipc_recv_until+0x43>
+  802d44:	c1 e8 10             	shr    $0x10,%eax
+  802d47:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d4d:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d53:	eb 9f                	jmp    802cf4 <ipc_recv_until+0x63>
+  802d55:	c1 e8 10             	shr    $0x10,%eax
+  802d58:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802d5e:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802d64:	eb aa                	jmp    802d10 <ipc_recv_until+0x7f>
+
+00802d66 <ipc_recv>:
+{
+  802d66:	55                   	push   %ebp
+  802d67:	89 e5                	mov    %esp,%ebp
+  802d69:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802d6c:	6a 00                	push   $0x0
+  802d6e:	ff 75 10             	push   0x10(%ebp)
+  802d71:	ff 75 0c             	push   0xc(%ebp)
+  802d74:	ff 75 08             	push   0x8(%ebp)
+  802d77:	e8 15 ff ff ff       	call   802c91 <ipc_recv_until>
+}
+  802d7c:	c9                   	leave
+  802d7d:	c3                   	ret
+
+00802d7e <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	57                   	push   %edi
+  802d82:	56                   	push   %esi
+  802d83:	53                   	push   %ebx
+  802d84:	83 ec 0c             	sub    $0xc,%esp
+  802d87:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d8a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802d90:	85 db                	test   %ebx,%ebx
+  802d92:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d97:	0f 44 d8             	cmove  %eax,%ebx
+  802d9a:	eb 05                	jmp    802da1 <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802d9c:	e8 27 e1 ff ff       	call   800ec8 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802da1:	ff 75 14             	push   0x14(%ebp)
+  802da4:	53                   	push   %ebx
+  802da5:	56                   	push   %esi
+  802da6:	57                   	push   %edi
+  802da7:	e8 bf e4 ff ff       	call   80126b <sys_ipc_try_send>
+  802dac:	83 c4 10             	add    $0x10,%esp
+  802daf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802db2:	74 e8                	je     802d9c <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802db4:	85 c0                	test   %eax,%eax
+  802db6:	78 08                	js     802dc0 <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802db8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dbb:	5b                   	pop    %ebx
+  802dbc:	5e                   	pop    %esi
+  802dbd:	5f                   	pop    %edi
+  802dbe:	5d                   	pop    %ebp
+  802dbf:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802dc0:	50                   	push   %eax
+  802dc1:	68 1f 34 80 00       	push   $0x80341f
+  802dc6:	6a 4f                	push   $0x4f
+  802dc8:	68 32 34 80 00       	push   $0x803432
+  802dcd:	e8 21 d5 ff ff       	call   8002f3 <_panic>
+
+00802dd2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802dd2:	55                   	push   %ebp
+  802dd3:	89 e5                	mov    %esp,%ebp
+  802dd5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802ddd:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802de3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802de9:	8b 52 50             	mov    0x50(%edx),%edx
+  802dec:	39 ca                	cmp    %ecx,%edx
+  802dee:	74 11                	je     802e01 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802df0:	83 c0 01             	add    $0x1,%eax
+  802df3:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802df8:	75 e3                	jne    802ddd <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dff:	eb 0e                	jmp    802e0f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802e01:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802e07:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e0c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e0f:	5d                   	pop    %ebp
+  802e10:	c3                   	ret
+
+00802e11 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e11:	55                   	push   %ebp
+  802e12:	89 e5                	mov    %esp,%ebp
+  802e14:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e17:	89 c2                	mov    %eax,%edx
+  802e19:	c1 ea 16             	shr    $0x16,%edx
+  802e1c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802e23:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802e28:	f6 c1 01             	test   $0x1,%cl
+  802e2b:	74 1a                	je     802e47 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802e2d:	c1 e8 0c             	shr    $0xc,%eax
+  802e30:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802e37:	a8 01                	test   $0x1,%al
+  802e39:	74 0c                	je     802e47 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802e3b:	c1 e8 0c             	shr    $0xc,%eax
+  802e3e:	c1 e0 04             	shl    $0x4,%eax
+  802e41:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802e47:	89 d0                	mov    %edx,%eax
+  802e49:	5d                   	pop    %ebp
+  802e4a:	c3                   	ret
@@ -0,0 +1,6237 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ce 00 00 00       	call   8000ff <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80003a:	89 e0                	mov    %esp,%eax
+static inline const volatile struct Env *
+thread_env(void)
+{
+	uintptr_t esp = read_esp();
+
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80003c:	05 00 00 00 20       	add    $0x20000000,%eax
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+	return mainenv;
+  800041:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  800047:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80004c:	76 1b                	jbe    800069 <umain+0x36>
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80004e:	8b 42 48             	mov    0x48(%edx),%eax
+  800051:	83 ec 08             	sub    $0x8,%esp
+  800054:	50                   	push   %eax
+  800055:	68 20 2c 80 00       	push   $0x802c20
+  80005a:	e8 3f 02 00 00       	call   80029e <cprintf>
+  80005f:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 5; i++) {
+  800062:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800067:	eb 2e                	jmp    800097 <umain+0x64>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  800069:	c1 e8 10             	shr    $0x10,%eax
+  80006c:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  800072:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  800078:	eb d4                	jmp    80004e <umain+0x1b>
+		sys_yield();
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  80007a:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  80007d:	83 ec 04             	sub    $0x4,%esp
+  800080:	53                   	push   %ebx
+  800081:	50                   	push   %eax
+  800082:	68 40 2c 80 00       	push   $0x802c40
+  800087:	e8 12 02 00 00       	call   80029e <cprintf>
+	for (i = 0; i < 5; i++) {
+  80008c:	83 c3 01             	add    $0x1,%ebx
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	83 fb 05             	cmp    $0x5,%ebx
+  800095:	74 2a                	je     8000c1 <umain+0x8e>
+		sys_yield();
+  800097:	e8 fc 0c 00 00       	call   800d98 <sys_yield>
+  80009c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80009e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8000a3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000a9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8000ae:	77 ca                	ja     80007a <umain+0x47>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8000b0:	c1 e8 10             	shr    $0x10,%eax
+  8000b3:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000b9:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8000bf:	eb b9                	jmp    80007a <umain+0x47>
+  8000c1:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000c3:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8000c8:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8000ce:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8000d3:	76 19                	jbe    8000ee <umain+0xbb>
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000d5:	8b 42 48             	mov    0x48(%edx),%eax
+  8000d8:	83 ec 08             	sub    $0x8,%esp
+  8000db:	50                   	push   %eax
+  8000dc:	68 6c 2c 80 00       	push   $0x802c6c
+  8000e1:	e8 b8 01 00 00       	call   80029e <cprintf>
+}
+  8000e6:	83 c4 10             	add    $0x10,%esp
+  8000e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000ec:	c9                   	leave
+  8000ed:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8000ee:	c1 e8 10             	shr    $0x10,%eax
+  8000f1:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  8000f7:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  8000fd:	eb d6                	jmp    8000d5 <umain+0xa2>
+
+008000ff <libmain>:
+const volatile struct Env *mainenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ff:	55                   	push   %ebp
+  800100:	89 e5                	mov    %esp,%ebp
+  800102:	57                   	push   %edi
+  800103:	56                   	push   %esi
+  800104:	53                   	push   %ebx
+  800105:	83 ec 0c             	sub    $0xc,%esp
+  800108:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline void
+cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp, uint32_t *ecxp, uint32_t *edxp)
+{
+	uint32_t eax, ebx, ecx, edx;
+	asm volatile("cpuid"
+  80010e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800113:	0f a2                	cpuid
+	int i;
+	envid_t envid;
+	uint32_t features;
+	
+	cpuid(1, NULL, NULL, NULL, &features);
+	syscall_use_int = !(features & CPUID_FEAT_SEP);
+  800115:	c1 ea 0b             	shr    $0xb,%edx
+  800118:	83 f2 01             	xor    $0x1,%edx
+  80011b:	83 e2 01             	and    $0x1,%edx
+  80011e:	88 15 0c 50 80 00    	mov    %dl,0x80500c
+
+	mainenv = NULL;
+  800124:	c7 05 08 50 80 00 00 	movl   $0x0,0x805008
+  80012b:	00 00 00 
+	envid = sys_getenvid();
+  80012e:	e8 1f 0c 00 00       	call   800d52 <sys_getenvid>
+  800133:	89 c1                	mov    %eax,%ecx
+	
+	for (i = 0; i < NENV; i++) {
+  800135:	b8 00 00 00 00       	mov    $0x0,%eax
+		if(envs[i].env_id == envid) {
+  80013a:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  800140:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800146:	8b 52 48             	mov    0x48(%edx),%edx
+  800149:	39 ca                	cmp    %ecx,%edx
+  80014b:	74 27                	je     800174 <libmain+0x75>
+	for (i = 0; i < NENV; i++) {
+  80014d:	83 c0 01             	add    $0x1,%eax
+  800150:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800155:	75 e3                	jne    80013a <libmain+0x3b>
+			mainenv = &envs[i];
+			break;
+		}
+	}
+	
+	if (mainenv == NULL)
+  800157:	83 3d 08 50 80 00 00 	cmpl   $0x0,0x805008
+  80015e:	75 24                	jne    800184 <libmain+0x85>
+		panic("libmain can't find the environment");
+  800160:	83 ec 04             	sub    $0x4,%esp
+  800163:	68 8c 2c 80 00       	push   $0x802c8c
+  800168:	6a 23                	push   $0x23
+  80016a:	68 af 2c 80 00       	push   $0x802caf
+  80016f:	e8 4f 00 00 00       	call   8001c3 <_panic>
+			mainenv = &envs[i];
+  800174:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80017a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80017f:	a3 08 50 80 00       	mov    %eax,0x805008
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800184:	85 ff                	test   %edi,%edi
+  800186:	7e 07                	jle    80018f <libmain+0x90>
+		binaryname = argv[0];
+  800188:	8b 06                	mov    (%esi),%eax
+  80018a:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  80018f:	83 ec 08             	sub    $0x8,%esp
+  800192:	56                   	push   %esi
+  800193:	57                   	push   %edi
+  800194:	e8 9a fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800199:	e8 0b 00 00 00       	call   8001a9 <exit>
+}
+  80019e:	83 c4 10             	add    $0x10,%esp
+  8001a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a4:	5b                   	pop    %ebx
+  8001a5:	5e                   	pop    %esi
+  8001a6:	5f                   	pop    %edi
+  8001a7:	5d                   	pop    %ebp
+  8001a8:	c3                   	ret
+
+008001a9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001a9:	55                   	push   %ebp
+  8001aa:	89 e5                	mov    %esp,%ebp
+  8001ac:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001af:	e8 94 18 00 00       	call   801a48 <close_all>
+	sys_env_destroy(0);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	6a 00                	push   $0x0
+  8001b9:	e8 2b 0b 00 00       	call   800ce9 <sys_env_destroy>
+}
+  8001be:	83 c4 10             	add    $0x10,%esp
+  8001c1:	c9                   	leave
+  8001c2:	c3                   	ret
+
+008001c3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001c3:	55                   	push   %ebp
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	56                   	push   %esi
+  8001c7:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001c8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001cb:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001d1:	e8 7c 0b 00 00       	call   800d52 <sys_getenvid>
+  8001d6:	83 ec 0c             	sub    $0xc,%esp
+  8001d9:	ff 75 0c             	push   0xc(%ebp)
+  8001dc:	ff 75 08             	push   0x8(%ebp)
+  8001df:	56                   	push   %esi
+  8001e0:	50                   	push   %eax
+  8001e1:	68 c8 2c 80 00       	push   $0x802cc8
+  8001e6:	e8 b3 00 00 00       	call   80029e <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001eb:	83 c4 18             	add    $0x18,%esp
+  8001ee:	53                   	push   %ebx
+  8001ef:	ff 75 10             	push   0x10(%ebp)
+  8001f2:	e8 56 00 00 00       	call   80024d <vcprintf>
+	cprintf("\n");
+  8001f7:	c7 04 24 4c 31 80 00 	movl   $0x80314c,(%esp)
+  8001fe:	e8 9b 00 00 00       	call   80029e <cprintf>
+  800203:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800206:	cc                   	int3
+	while (1)
+  800207:	eb fd                	jmp    800206 <_panic+0x43>
+
+00800209 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	53                   	push   %ebx
+  80020d:	83 ec 04             	sub    $0x4,%esp
+  800210:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800213:	8b 13                	mov    (%ebx),%edx
+  800215:	8d 42 01             	lea    0x1(%edx),%eax
+  800218:	89 03                	mov    %eax,(%ebx)
+  80021a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80021d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800221:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800226:	74 09                	je     800231 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800228:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80022c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80022f:	c9                   	leave
+  800230:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800231:	83 ec 08             	sub    $0x8,%esp
+  800234:	68 ff 00 00 00       	push   $0xff
+  800239:	8d 43 08             	lea    0x8(%ebx),%eax
+  80023c:	50                   	push   %eax
+  80023d:	e8 1d 0a 00 00       	call   800c5f <sys_cputs>
+		b->idx = 0;
+  800242:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	eb db                	jmp    800228 <putch+0x1f>
+
+0080024d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800256:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80025d:	00 00 00 
+	b.cnt = 0;
+  800260:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800267:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80026a:	ff 75 0c             	push   0xc(%ebp)
+  80026d:	ff 75 08             	push   0x8(%ebp)
+  800270:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800276:	50                   	push   %eax
+  800277:	68 09 02 80 00       	push   $0x800209
+  80027c:	e8 fb 00 00 00       	call   80037c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800281:	83 c4 08             	add    $0x8,%esp
+  800284:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80028a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800290:	50                   	push   %eax
+  800291:	e8 c9 09 00 00       	call   800c5f <sys_cputs>
+
+	return b.cnt;
+}
+  800296:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80029c:	c9                   	leave
+  80029d:	c3                   	ret
+
+0080029e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002a4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002a7:	50                   	push   %eax
+  8002a8:	ff 75 08             	push   0x8(%ebp)
+  8002ab:	e8 9d ff ff ff       	call   80024d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002b0:	c9                   	leave
+  8002b1:	c3                   	ret
+
+008002b2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long num, unsigned base, int width, int padc, int attrib)
+{
+  8002b2:	55                   	push   %ebp
+  8002b3:	89 e5                	mov    %esp,%ebp
+  8002b5:	57                   	push   %edi
+  8002b6:	56                   	push   %esi
+  8002b7:	53                   	push   %ebx
+  8002b8:	83 ec 1c             	sub    $0x1c,%esp
+  8002bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002be:	89 d6                	mov    %edx,%esi
+  8002c0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8002c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002c6:	3b 4d 08             	cmp    0x8(%ebp),%ecx
+  8002c9:	73 0b                	jae    8002d6 <printnum+0x24>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc | (attrib << 8), putdat);
+  8002cb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002ce:	c1 e7 08             	shl    $0x8,%edi
+  8002d1:	0b 7d 10             	or     0x10(%ebp),%edi
+  8002d4:	eb 36                	jmp    80030c <printnum+0x5a>
+		printnum(putch, putdat, num / base, base, width - 1, padc, attrib);
+  8002d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002de:	f7 75 08             	divl   0x8(%ebp)
+  8002e1:	89 c1                	mov    %eax,%ecx
+  8002e3:	ff 75 14             	push   0x14(%ebp)
+  8002e6:	ff 75 10             	push   0x10(%ebp)
+  8002e9:	83 eb 01             	sub    $0x1,%ebx
+  8002ec:	53                   	push   %ebx
+  8002ed:	ff 75 08             	push   0x8(%ebp)
+  8002f0:	89 f2                	mov    %esi,%edx
+  8002f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002f5:	e8 b8 ff ff ff       	call   8002b2 <printnum>
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	eb 14                	jmp    800313 <printnum+0x61>
+			putch(padc | (attrib << 8), putdat);
+  8002ff:	83 ec 08             	sub    $0x8,%esp
+  800302:	56                   	push   %esi
+  800303:	57                   	push   %edi
+  800304:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800307:	ff d0                	call   *%eax
+  800309:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80030c:	83 eb 01             	sub    $0x1,%ebx
+  80030f:	85 db                	test   %ebx,%ebx
+  800311:	7f ec                	jg     8002ff <printnum+0x4d>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base] | (attrib << 8), putdat);
+  800313:	83 ec 08             	sub    $0x8,%esp
+  800316:	56                   	push   %esi
+  800317:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80031a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80031f:	f7 75 08             	divl   0x8(%ebp)
+  800322:	0f be 92 eb 2c 80 00 	movsbl 0x802ceb(%edx),%edx
+  800329:	8b 45 14             	mov    0x14(%ebp),%eax
+  80032c:	c1 e0 08             	shl    $0x8,%eax
+  80032f:	09 d0                	or     %edx,%eax
+  800331:	50                   	push   %eax
+  800332:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800335:	ff d0                	call   *%eax
+}
+  800337:	83 c4 10             	add    $0x10,%esp
+  80033a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033d:	5b                   	pop    %ebx
+  80033e:	5e                   	pop    %esi
+  80033f:	5f                   	pop    %edi
+  800340:	5d                   	pop    %ebp
+  800341:	c3                   	ret
+
+00800342 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800342:	55                   	push   %ebp
+  800343:	89 e5                	mov    %esp,%ebp
+  800345:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800348:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80034c:	8b 10                	mov    (%eax),%edx
+  80034e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800351:	73 0a                	jae    80035d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800353:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800356:	89 08                	mov    %ecx,(%eax)
+  800358:	8b 45 08             	mov    0x8(%ebp),%eax
+  80035b:	88 02                	mov    %al,(%edx)
+}
+  80035d:	5d                   	pop    %ebp
+  80035e:	c3                   	ret
+
+0080035f <printfmt>:
+{
+  80035f:	55                   	push   %ebp
+  800360:	89 e5                	mov    %esp,%ebp
+  800362:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800365:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800368:	50                   	push   %eax
+  800369:	ff 75 10             	push   0x10(%ebp)
+  80036c:	ff 75 0c             	push   0xc(%ebp)
+  80036f:	ff 75 08             	push   0x8(%ebp)
+  800372:	e8 05 00 00 00       	call   80037c <vprintfmt>
+}
+  800377:	83 c4 10             	add    $0x10,%esp
+  80037a:	c9                   	leave
+  80037b:	c3                   	ret
+
+0080037c <vprintfmt>:
+{
+  80037c:	55                   	push   %ebp
+  80037d:	89 e5                	mov    %esp,%ebp
+  80037f:	57                   	push   %edi
+  800380:	56                   	push   %esi
+  800381:	53                   	push   %ebx
+  800382:	83 ec 3c             	sub    $0x3c,%esp
+  800385:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800388:	8b 75 10             	mov    0x10(%ebp),%esi
+	int attrib = 0;
+  80038b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800392:	eb 16                	jmp    8003aa <vprintfmt+0x2e>
+			putch(ch | (attrib << 8), putdat);
+  800394:	83 ec 08             	sub    $0x8,%esp
+  800397:	ff 75 0c             	push   0xc(%ebp)
+  80039a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80039d:	c1 e2 08             	shl    $0x8,%edx
+  8003a0:	09 d0                	or     %edx,%eax
+  8003a2:	50                   	push   %eax
+  8003a3:	ff d7                	call   *%edi
+  8003a5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003a8:	89 de                	mov    %ebx,%esi
+  8003aa:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8003ad:	0f b6 06             	movzbl (%esi),%eax
+  8003b0:	83 f8 25             	cmp    $0x25,%eax
+  8003b3:	74 0c                	je     8003c1 <vprintfmt+0x45>
+			if (ch == '\0')
+  8003b5:	85 c0                	test   %eax,%eax
+  8003b7:	75 db                	jne    800394 <vprintfmt+0x18>
+}
+  8003b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003bc:	5b                   	pop    %ebx
+  8003bd:	5e                   	pop    %esi
+  8003be:	5f                   	pop    %edi
+  8003bf:	5d                   	pop    %ebp
+  8003c0:	c3                   	ret
+		padc = ' ';
+  8003c1:	c6 45 d4 20          	movb   $0x20,-0x2c(%ebp)
+		altflag = 0;
+  8003c5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003cc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8003d3:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8003da:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8003df:	8d 73 01             	lea    0x1(%ebx),%esi
+  8003e2:	0f b6 13             	movzbl (%ebx),%edx
+  8003e5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003e8:	3c 55                	cmp    $0x55,%al
+  8003ea:	0f 87 2c 04 00 00    	ja     80081c <vprintfmt+0x4a0>
+  8003f0:	0f b6 c0             	movzbl %al,%eax
+  8003f3:	ff 24 85 40 2e 80 00 	jmp    *0x802e40(,%eax,4)
+  8003fa:	89 f3                	mov    %esi,%ebx
+			padc = '-';
+  8003fc:	c6 45 d4 2d          	movb   $0x2d,-0x2c(%ebp)
+  800400:	eb dd                	jmp    8003df <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  800402:	89 f3                	mov    %esi,%ebx
+  800404:	c6 45 d4 30          	movb   $0x30,-0x2c(%ebp)
+  800408:	eb d5                	jmp    8003df <vprintfmt+0x63>
+  80040a:	0f b6 d2             	movzbl %dl,%edx
+  80040d:	89 f3                	mov    %esi,%ebx
+			for (precision = 0; ; ++fmt) {
+  80040f:	b8 00 00 00 00       	mov    $0x0,%eax
+				precision = precision * 10 + ch - '0';
+  800414:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800417:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  80041b:	0f be 13             	movsbl (%ebx),%edx
+				if (ch < '0' || ch > '9')
+  80041e:	8d 72 d0             	lea    -0x30(%edx),%esi
+  800421:	83 fe 09             	cmp    $0x9,%esi
+  800424:	0f 87 8a 00 00 00    	ja     8004b4 <vprintfmt+0x138>
+			for (precision = 0; ; ++fmt) {
+  80042a:	83 c3 01             	add    $0x1,%ebx
+				precision = precision * 10 + ch - '0';
+  80042d:	eb e5                	jmp    800414 <vprintfmt+0x98>
+			precision = va_arg(ap, int);
+  80042f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800432:	8b 00                	mov    (%eax),%eax
+  800434:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800437:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043a:	8d 40 04             	lea    0x4(%eax),%eax
+  80043d:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800440:	89 f3                	mov    %esi,%ebx
+			if (width < 0)
+  800442:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800446:	79 97                	jns    8003df <vprintfmt+0x63>
+				width = precision, precision = -1;
+  800448:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80044b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800455:	eb 88                	jmp    8003df <vprintfmt+0x63>
+			if (width < 0)
+  800457:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80045a:	85 db                	test   %ebx,%ebx
+  80045c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800461:	0f 49 c3             	cmovns %ebx,%eax
+  800464:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800467:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  800469:	e9 71 ff ff ff       	jmp    8003df <vprintfmt+0x63>
+		switch (ch = *(unsigned char *) fmt++) {
+  80046e:	89 f3                	mov    %esi,%ebx
+			altflag = 1;
+  800470:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800477:	e9 63 ff ff ff       	jmp    8003df <vprintfmt+0x63>
+			switch(*(unsigned char *) fmt++) {
+  80047c:	8d 73 02             	lea    0x2(%ebx),%esi
+  80047f:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+					attrib = 0x0A;
+  800483:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%ebp)
+  80048a:	3c 67                	cmp    $0x67,%al
+  80048c:	0f 84 18 ff ff ff    	je     8003aa <vprintfmt+0x2e>
+					attrib = 0x04;
+  800492:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  800499:	3c 72                	cmp    $0x72,%al
+  80049b:	0f 84 09 ff ff ff    	je     8003aa <vprintfmt+0x2e>
+					attrib = 0x00;
+  8004a1:	3c 62                	cmp    $0x62,%al
+  8004a3:	0f 94 c0             	sete   %al
+  8004a6:	0f b6 c0             	movzbl %al,%eax
+  8004a9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004af:	e9 f6 fe ff ff       	jmp    8003aa <vprintfmt+0x2e>
+  8004b4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b7:	eb 89                	jmp    800442 <vprintfmt+0xc6>
+			lflag++;
+  8004b9:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bc:	89 f3                	mov    %esi,%ebx
+			goto reswitch;
+  8004be:	e9 1c ff ff ff       	jmp    8003df <vprintfmt+0x63>
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c6:	8d 58 04             	lea    0x4(%eax),%ebx
+  8004c9:	83 ec 08             	sub    $0x8,%esp
+  8004cc:	ff 75 0c             	push   0xc(%ebp)
+  8004cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8004d2:	c1 e0 08             	shl    $0x8,%eax
+  8004d5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8004d8:	0b 01                	or     (%ecx),%eax
+  8004da:	50                   	push   %eax
+  8004db:	ff d7                	call   *%edi
+			break;
+  8004dd:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int) | (attrib << 8), putdat);
+  8004e0:	89 5d 14             	mov    %ebx,0x14(%ebp)
+			break;
+  8004e3:	e9 c2 fe ff ff       	jmp    8003aa <vprintfmt+0x2e>
+			err = va_arg(ap, int);
+  8004e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004eb:	8d 58 04             	lea    0x4(%eax),%ebx
+			if (err < 0)
+  8004ee:	8b 10                	mov    (%eax),%edx
+  8004f0:	89 d0                	mov    %edx,%eax
+  8004f2:	f7 d8                	neg    %eax
+  8004f4:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004f7:	83 f8 12             	cmp    $0x12,%eax
+  8004fa:	7f 25                	jg     800521 <vprintfmt+0x1a5>
+  8004fc:	8b 14 85 a0 2f 80 00 	mov    0x802fa0(,%eax,4),%edx
+  800503:	85 d2                	test   %edx,%edx
+  800505:	74 1a                	je     800521 <vprintfmt+0x1a5>
+				printfmt(putch, putdat, "%s", p);
+  800507:	52                   	push   %edx
+  800508:	68 e1 30 80 00       	push   $0x8030e1
+  80050d:	ff 75 0c             	push   0xc(%ebp)
+  800510:	57                   	push   %edi
+  800511:	e8 49 fe ff ff       	call   80035f <printfmt>
+  800516:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800519:	89 5d 14             	mov    %ebx,0x14(%ebp)
+  80051c:	e9 89 fe ff ff       	jmp    8003aa <vprintfmt+0x2e>
+				printfmt(putch, putdat, "error %d", err);
+  800521:	50                   	push   %eax
+  800522:	68 03 2d 80 00       	push   $0x802d03
+  800527:	ff 75 0c             	push   0xc(%ebp)
+  80052a:	57                   	push   %edi
+  80052b:	e8 2f fe ff ff       	call   80035f <printfmt>
+  800530:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800533:	89 5d 14             	mov    %ebx,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800536:	e9 6f fe ff ff       	jmp    8003aa <vprintfmt+0x2e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80053b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053e:	83 c0 04             	add    $0x4,%eax
+  800541:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800544:	8b 45 14             	mov    0x14(%ebp),%eax
+  800547:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800549:	85 c9                	test   %ecx,%ecx
+  80054b:	b8 fc 2c 80 00       	mov    $0x802cfc,%eax
+  800550:	0f 45 c1             	cmovne %ecx,%eax
+  800553:	89 45 c8             	mov    %eax,-0x38(%ebp)
+			if (width > 0 && padc != '-')
+  800556:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80055a:	7e 06                	jle    800562 <vprintfmt+0x1e6>
+  80055c:	80 7d d4 2d          	cmpb   $0x2d,-0x2c(%ebp)
+  800560:	75 1a                	jne    80057c <vprintfmt+0x200>
+					putch(ch | (attrib << 8), putdat);
+  800562:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800565:	c1 e0 08             	shl    $0x8,%eax
+  800568:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					putch('?' | (attrib << 8), putdat);
+  80056b:	83 c8 3f             	or     $0x3f,%eax
+  80056e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800571:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  800574:	89 75 10             	mov    %esi,0x10(%ebp)
+  800577:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  80057a:	eb 6d                	jmp    8005e9 <vprintfmt+0x26d>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80057c:	83 ec 08             	sub    $0x8,%esp
+  80057f:	ff 75 d0             	push   -0x30(%ebp)
+  800582:	ff 75 c8             	push   -0x38(%ebp)
+  800585:	e8 39 03 00 00       	call   8008c3 <strnlen>
+  80058a:	89 c2                	mov    %eax,%edx
+  80058c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80058f:	29 d0                	sub    %edx,%eax
+					putch(padc | (attrib << 8), putdat);
+  800591:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800594:	c1 e1 08             	shl    $0x8,%ecx
+  800597:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  80059b:	09 d1                	or     %edx,%ecx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059d:	83 c4 10             	add    $0x10,%esp
+  8005a0:	89 c3                	mov    %eax,%ebx
+  8005a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005a5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005a8:	89 ce                	mov    %ecx,%esi
+  8005aa:	eb 0f                	jmp    8005bb <vprintfmt+0x23f>
+					putch(padc | (attrib << 8), putdat);
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	ff 75 0c             	push   0xc(%ebp)
+  8005b2:	56                   	push   %esi
+  8005b3:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005b5:	83 eb 01             	sub    $0x1,%ebx
+  8005b8:	83 c4 10             	add    $0x10,%esp
+  8005bb:	85 db                	test   %ebx,%ebx
+  8005bd:	7f ed                	jg     8005ac <vprintfmt+0x230>
+  8005bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c2:	8b 75 10             	mov    0x10(%ebp),%esi
+  8005c5:	85 c0                	test   %eax,%eax
+  8005c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005cc:	0f 49 d0             	cmovns %eax,%edx
+  8005cf:	29 d0                	sub    %edx,%eax
+  8005d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d4:	eb 8c                	jmp    800562 <vprintfmt+0x1e6>
+					putch(ch | (attrib << 8), putdat);
+  8005d6:	83 ec 08             	sub    $0x8,%esp
+  8005d9:	ff 75 0c             	push   0xc(%ebp)
+  8005dc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8005df:	09 c2                	or     %eax,%edx
+  8005e1:	52                   	push   %edx
+  8005e2:	ff d7                	call   *%edi
+  8005e4:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005e7:	89 d9                	mov    %ebx,%ecx
+  8005e9:	8d 59 01             	lea    0x1(%ecx),%ebx
+  8005ec:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+  8005f0:	0f be d0             	movsbl %al,%edx
+  8005f3:	85 d2                	test   %edx,%edx
+  8005f5:	74 2a                	je     800621 <vprintfmt+0x2a5>
+  8005f7:	85 f6                	test   %esi,%esi
+  8005f9:	78 05                	js     800600 <vprintfmt+0x284>
+  8005fb:	83 ee 01             	sub    $0x1,%esi
+  8005fe:	78 3b                	js     80063b <vprintfmt+0x2bf>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800600:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800604:	74 d0                	je     8005d6 <vprintfmt+0x25a>
+  800606:	0f be c0             	movsbl %al,%eax
+  800609:	83 e8 20             	sub    $0x20,%eax
+  80060c:	83 f8 5e             	cmp    $0x5e,%eax
+  80060f:	76 c5                	jbe    8005d6 <vprintfmt+0x25a>
+					putch('?' | (attrib << 8), putdat);
+  800611:	83 ec 08             	sub    $0x8,%esp
+  800614:	ff 75 0c             	push   0xc(%ebp)
+  800617:	ff 75 cc             	push   -0x34(%ebp)
+  80061a:	ff d7                	call   *%edi
+  80061c:	83 c4 10             	add    $0x10,%esp
+  80061f:	eb c6                	jmp    8005e7 <vprintfmt+0x26b>
+  800621:	8b 75 10             	mov    0x10(%ebp),%esi
+  800624:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800627:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80062a:	01 c3                	add    %eax,%ebx
+  80062c:	29 cb                	sub    %ecx,%ebx
+				putch(' ' | (attrib << 8), putdat);
+  80062e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800631:	83 c8 20             	or     $0x20,%eax
+  800634:	89 75 10             	mov    %esi,0x10(%ebp)
+  800637:	89 c6                	mov    %eax,%esi
+  800639:	eb 14                	jmp    80064f <vprintfmt+0x2d3>
+  80063b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80063e:	eb e4                	jmp    800624 <vprintfmt+0x2a8>
+  800640:	83 ec 08             	sub    $0x8,%esp
+  800643:	ff 75 0c             	push   0xc(%ebp)
+  800646:	56                   	push   %esi
+  800647:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800649:	83 eb 01             	sub    $0x1,%ebx
+  80064c:	83 c4 10             	add    $0x10,%esp
+  80064f:	85 db                	test   %ebx,%ebx
+  800651:	7f ed                	jg     800640 <vprintfmt+0x2c4>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800653:	8b 75 10             	mov    0x10(%ebp),%esi
+  800656:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065c:	e9 49 fd ff ff       	jmp    8003aa <vprintfmt+0x2e>
+	if (lflag >= 2)
+  800661:	83 f9 01             	cmp    $0x1,%ecx
+  800664:	7f 1f                	jg     800685 <vprintfmt+0x309>
+	else if (lflag)
+  800666:	85 c9                	test   %ecx,%ecx
+  800668:	74 69                	je     8006d3 <vprintfmt+0x357>
+		return va_arg(*ap, long);
+  80066a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066d:	8b 00                	mov    (%eax),%eax
+  80066f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800672:	89 c1                	mov    %eax,%ecx
+  800674:	c1 f9 1f             	sar    $0x1f,%ecx
+  800677:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8d 40 04             	lea    0x4(%eax),%eax
+  800680:	89 45 14             	mov    %eax,0x14(%ebp)
+  800683:	eb 17                	jmp    80069c <vprintfmt+0x320>
+		return va_arg(*ap, long long);
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 50 04             	mov    0x4(%eax),%edx
+  80068b:	8b 00                	mov    (%eax),%eax
+  80068d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800690:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8d 40 08             	lea    0x8(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80069c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  80069f:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+			base = 10;
+  8006a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+			if ((long long) num < 0) {
+  8006a7:	85 db                	test   %ebx,%ebx
+  8006a9:	0f 89 f6 00 00 00    	jns    8007a5 <vprintfmt+0x429>
+				putch('-' | (attrib << 8), putdat);
+  8006af:	83 ec 08             	sub    $0x8,%esp
+  8006b2:	ff 75 0c             	push   0xc(%ebp)
+  8006b5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8006b8:	c1 e0 08             	shl    $0x8,%eax
+  8006bb:	83 c8 2d             	or     $0x2d,%eax
+  8006be:	50                   	push   %eax
+  8006bf:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006c1:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  8006c4:	f7 d9                	neg    %ecx
+  8006c6:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8006ce:	e9 d2 00 00 00       	jmp    8007a5 <vprintfmt+0x429>
+		return va_arg(*ap, int);
+  8006d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d6:	8b 00                	mov    (%eax),%eax
+  8006d8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006db:	89 c1                	mov    %eax,%ecx
+  8006dd:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006e0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ec:	eb ae                	jmp    80069c <vprintfmt+0x320>
+	if (lflag >= 2)
+  8006ee:	83 f9 01             	cmp    $0x1,%ecx
+  8006f1:	7f 19                	jg     80070c <vprintfmt+0x390>
+	else if (lflag)
+  8006f3:	85 c9                	test   %ecx,%ecx
+  8006f5:	74 2a                	je     800721 <vprintfmt+0x3a5>
+		return va_arg(*ap, unsigned long);
+  8006f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fa:	8b 08                	mov    (%eax),%ecx
+  8006fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ff:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800702:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long);
+  800707:	e9 99 00 00 00       	jmp    8007a5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80070c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070f:	8b 08                	mov    (%eax),%ecx
+  800711:	8d 40 08             	lea    0x8(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800717:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned long long);
+  80071c:	e9 84 00 00 00       	jmp    8007a5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8b 08                	mov    (%eax),%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80072c:	b8 0a 00 00 00       	mov    $0xa,%eax
+		return va_arg(*ap, unsigned int);
+  800731:	eb 72                	jmp    8007a5 <vprintfmt+0x429>
+	if (lflag >= 2)
+  800733:	83 f9 01             	cmp    $0x1,%ecx
+  800736:	7f 16                	jg     80074e <vprintfmt+0x3d2>
+	else if (lflag)
+  800738:	85 c9                	test   %ecx,%ecx
+  80073a:	74 24                	je     800760 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80073c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073f:	8b 08                	mov    (%eax),%ecx
+  800741:	8d 40 04             	lea    0x4(%eax),%eax
+  800744:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800747:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long);
+  80074c:	eb 57                	jmp    8007a5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 08                	mov    (%eax),%ecx
+  800753:	8d 40 08             	lea    0x8(%eax),%eax
+  800756:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800759:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned long long);
+  80075e:	eb 45                	jmp    8007a5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 08                	mov    (%eax),%ecx
+  800765:	8d 40 04             	lea    0x4(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80076b:	b8 08 00 00 00       	mov    $0x8,%eax
+		return va_arg(*ap, unsigned int);
+  800770:	eb 33                	jmp    8007a5 <vprintfmt+0x429>
+			putch('0' | (attrib << 8), putdat);
+  800772:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800775:	c1 e3 08             	shl    $0x8,%ebx
+  800778:	83 ec 08             	sub    $0x8,%esp
+  80077b:	ff 75 0c             	push   0xc(%ebp)
+  80077e:	89 d8                	mov    %ebx,%eax
+  800780:	83 c8 30             	or     $0x30,%eax
+  800783:	50                   	push   %eax
+  800784:	ff d7                	call   *%edi
+			putch('x' | (attrib << 8), putdat);
+  800786:	83 c4 08             	add    $0x8,%esp
+  800789:	ff 75 0c             	push   0xc(%ebp)
+  80078c:	83 cb 78             	or     $0x78,%ebx
+  80078f:	53                   	push   %ebx
+  800790:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800792:	8b 45 14             	mov    0x14(%ebp),%eax
+  800795:	8b 08                	mov    (%eax),%ecx
+			goto number;
+  800797:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80079a:	8d 40 04             	lea    0x4(%eax),%eax
+  80079d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007a0:	b8 10 00 00 00       	mov    $0x10,%eax
+			printnum(putch, putdat, num, base, width, padc, attrib);
+  8007a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8007a8:	0f be 55 d4          	movsbl -0x2c(%ebp),%edx
+  8007ac:	52                   	push   %edx
+  8007ad:	ff 75 e0             	push   -0x20(%ebp)
+  8007b0:	50                   	push   %eax
+  8007b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007b4:	89 f8                	mov    %edi,%eax
+  8007b6:	e8 f7 fa ff ff       	call   8002b2 <printnum>
+			break;
+  8007bb:	83 c4 10             	add    $0x10,%esp
+  8007be:	e9 e7 fb ff ff       	jmp    8003aa <vprintfmt+0x2e>
+	if (lflag >= 2)
+  8007c3:	83 f9 01             	cmp    $0x1,%ecx
+  8007c6:	7f 16                	jg     8007de <vprintfmt+0x462>
+	else if (lflag)
+  8007c8:	85 c9                	test   %ecx,%ecx
+  8007ca:	74 24                	je     8007f0 <vprintfmt+0x474>
+		return va_arg(*ap, unsigned long);
+  8007cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cf:	8b 08                	mov    (%eax),%ecx
+  8007d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d7:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long);
+  8007dc:	eb c7                	jmp    8007a5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned long long);
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	8b 08                	mov    (%eax),%ecx
+  8007e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e9:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned long long);
+  8007ee:	eb b5                	jmp    8007a5 <vprintfmt+0x429>
+		return va_arg(*ap, unsigned int);
+  8007f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f3:	8b 08                	mov    (%eax),%ecx
+  8007f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007fb:	b8 10 00 00 00       	mov    $0x10,%eax
+		return va_arg(*ap, unsigned int);
+  800800:	eb a3                	jmp    8007a5 <vprintfmt+0x429>
+			putch(ch | (attrib << 8), putdat);
+  800802:	83 ec 08             	sub    $0x8,%esp
+  800805:	ff 75 0c             	push   0xc(%ebp)
+  800808:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80080b:	c1 e0 08             	shl    $0x8,%eax
+  80080e:	83 c8 25             	or     $0x25,%eax
+  800811:	50                   	push   %eax
+  800812:	ff d7                	call   *%edi
+			break;
+  800814:	83 c4 10             	add    $0x10,%esp
+  800817:	e9 8e fb ff ff       	jmp    8003aa <vprintfmt+0x2e>
+			putch('%' | (attrib << 8), putdat);
+  80081c:	83 ec 08             	sub    $0x8,%esp
+  80081f:	ff 75 0c             	push   0xc(%ebp)
+  800822:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800825:	c1 e0 08             	shl    $0x8,%eax
+  800828:	83 c8 25             	or     $0x25,%eax
+  80082b:	50                   	push   %eax
+  80082c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	89 de                	mov    %ebx,%esi
+  800833:	eb 03                	jmp    800838 <vprintfmt+0x4bc>
+  800835:	83 ee 01             	sub    $0x1,%esi
+  800838:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80083c:	75 f7                	jne    800835 <vprintfmt+0x4b9>
+  80083e:	e9 67 fb ff ff       	jmp    8003aa <vprintfmt+0x2e>
+
+00800843 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800843:	55                   	push   %ebp
+  800844:	89 e5                	mov    %esp,%ebp
+  800846:	83 ec 18             	sub    $0x18,%esp
+  800849:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80084f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800852:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800856:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800859:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800860:	85 c0                	test   %eax,%eax
+  800862:	74 26                	je     80088a <vsnprintf+0x47>
+  800864:	85 d2                	test   %edx,%edx
+  800866:	7e 22                	jle    80088a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800868:	ff 75 14             	push   0x14(%ebp)
+  80086b:	ff 75 10             	push   0x10(%ebp)
+  80086e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800871:	50                   	push   %eax
+  800872:	68 42 03 80 00       	push   $0x800342
+  800877:	e8 00 fb ff ff       	call   80037c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80087c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80087f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800882:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800885:	83 c4 10             	add    $0x10,%esp
+}
+  800888:	c9                   	leave
+  800889:	c3                   	ret
+		return -E_INVAL;
+  80088a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80088f:	eb f7                	jmp    800888 <vsnprintf+0x45>
+
+00800891 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800891:	55                   	push   %ebp
+  800892:	89 e5                	mov    %esp,%ebp
+  800894:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+	va_start(ap, fmt);
+  800897:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80089a:	50                   	push   %eax
+  80089b:	ff 75 10             	push   0x10(%ebp)
+  80089e:	ff 75 0c             	push   0xc(%ebp)
+  8008a1:	ff 75 08             	push   0x8(%ebp)
+  8008a4:	e8 9a ff ff ff       	call   800843 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008a9:	c9                   	leave
+  8008aa:	c3                   	ret
+
+008008ab <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008ab:	55                   	push   %ebp
+  8008ac:	89 e5                	mov    %esp,%ebp
+  8008ae:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b6:	eb 03                	jmp    8008bb <strlen+0x10>
+		n++;
+  8008b8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008bb:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008bf:	75 f7                	jne    8008b8 <strlen+0xd>
+	return n;
+}
+  8008c1:	5d                   	pop    %ebp
+  8008c2:	c3                   	ret
+
+008008c3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d1:	eb 03                	jmp    8008d6 <strnlen+0x13>
+		n++;
+  8008d3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008d6:	39 d0                	cmp    %edx,%eax
+  8008d8:	74 08                	je     8008e2 <strnlen+0x1f>
+  8008da:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008de:	75 f3                	jne    8008d3 <strnlen+0x10>
+  8008e0:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008e2:	89 d0                	mov    %edx,%eax
+  8008e4:	5d                   	pop    %ebp
+  8008e5:	c3                   	ret
+
+008008e6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008e6:	55                   	push   %ebp
+  8008e7:	89 e5                	mov    %esp,%ebp
+  8008e9:	53                   	push   %ebx
+  8008ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008f9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008fc:	83 c0 01             	add    $0x1,%eax
+  8008ff:	84 d2                	test   %dl,%dl
+  800901:	75 f2                	jne    8008f5 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800903:	89 c8                	mov    %ecx,%eax
+  800905:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800908:	c9                   	leave
+  800909:	c3                   	ret
+
+0080090a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	53                   	push   %ebx
+  80090e:	83 ec 10             	sub    $0x10,%esp
+  800911:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800914:	53                   	push   %ebx
+  800915:	e8 91 ff ff ff       	call   8008ab <strlen>
+  80091a:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80091d:	ff 75 0c             	push   0xc(%ebp)
+  800920:	01 d8                	add    %ebx,%eax
+  800922:	50                   	push   %eax
+  800923:	e8 be ff ff ff       	call   8008e6 <strcpy>
+	return dst;
+}
+  800928:	89 d8                	mov    %ebx,%eax
+  80092a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+
+0080092f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	56                   	push   %esi
+  800933:	53                   	push   %ebx
+  800934:	8b 75 08             	mov    0x8(%ebp),%esi
+  800937:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80093a:	89 f3                	mov    %esi,%ebx
+  80093c:	03 5d 10             	add    0x10(%ebp),%ebx
+  80093f:	89 f0                	mov    %esi,%eax
+  800941:	eb 0f                	jmp    800952 <strncpy+0x23>
+		*dst++ = *src;
+  800943:	83 c0 01             	add    $0x1,%eax
+  800946:	0f b6 0a             	movzbl (%edx),%ecx
+  800949:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80094c:	80 f9 01             	cmp    $0x1,%cl
+  80094f:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800952:	39 d8                	cmp    %ebx,%eax
+  800954:	75 ed                	jne    800943 <strncpy+0x14>
+	}
+	return ret;
+}
+  800956:	89 f0                	mov    %esi,%eax
+  800958:	5b                   	pop    %ebx
+  800959:	5e                   	pop    %esi
+  80095a:	5d                   	pop    %ebp
+  80095b:	c3                   	ret
+
+0080095c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	56                   	push   %esi
+  800960:	53                   	push   %ebx
+  800961:	8b 75 08             	mov    0x8(%ebp),%esi
+  800964:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800967:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80096a:	89 f0                	mov    %esi,%eax
+  80096c:	85 d2                	test   %edx,%edx
+  80096e:	74 21                	je     800991 <strlcpy+0x35>
+  800970:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800974:	89 f2                	mov    %esi,%edx
+  800976:	eb 09                	jmp    800981 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800978:	83 c1 01             	add    $0x1,%ecx
+  80097b:	83 c2 01             	add    $0x1,%edx
+  80097e:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800981:	39 c2                	cmp    %eax,%edx
+  800983:	74 09                	je     80098e <strlcpy+0x32>
+  800985:	0f b6 19             	movzbl (%ecx),%ebx
+  800988:	84 db                	test   %bl,%bl
+  80098a:	75 ec                	jne    800978 <strlcpy+0x1c>
+  80098c:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80098e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800991:	29 f0                	sub    %esi,%eax
+}
+  800993:	5b                   	pop    %ebx
+  800994:	5e                   	pop    %esi
+  800995:	5d                   	pop    %ebp
+  800996:	c3                   	ret
+
+00800997 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80099d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009a0:	eb 06                	jmp    8009a8 <strcmp+0x11>
+		p++, q++;
+  8009a2:	83 c1 01             	add    $0x1,%ecx
+  8009a5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009a8:	0f b6 01             	movzbl (%ecx),%eax
+  8009ab:	84 c0                	test   %al,%al
+  8009ad:	74 04                	je     8009b3 <strcmp+0x1c>
+  8009af:	3a 02                	cmp    (%edx),%al
+  8009b1:	74 ef                	je     8009a2 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009b3:	0f b6 c0             	movzbl %al,%eax
+  8009b6:	0f b6 12             	movzbl (%edx),%edx
+  8009b9:	29 d0                	sub    %edx,%eax
+}
+  8009bb:	5d                   	pop    %ebp
+  8009bc:	c3                   	ret
+
+008009bd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009bd:	55                   	push   %ebp
+  8009be:	89 e5                	mov    %esp,%ebp
+  8009c0:	53                   	push   %ebx
+  8009c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009c7:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009ca:	eb 09                	jmp    8009d5 <strncmp+0x18>
+		n--, p++, q++;
+  8009cc:	83 ea 01             	sub    $0x1,%edx
+  8009cf:	83 c0 01             	add    $0x1,%eax
+  8009d2:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009d5:	85 d2                	test   %edx,%edx
+  8009d7:	74 18                	je     8009f1 <strncmp+0x34>
+  8009d9:	0f b6 18             	movzbl (%eax),%ebx
+  8009dc:	84 db                	test   %bl,%bl
+  8009de:	74 04                	je     8009e4 <strncmp+0x27>
+  8009e0:	3a 19                	cmp    (%ecx),%bl
+  8009e2:	74 e8                	je     8009cc <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e4:	0f b6 00             	movzbl (%eax),%eax
+  8009e7:	0f b6 11             	movzbl (%ecx),%edx
+  8009ea:	29 d0                	sub    %edx,%eax
+}
+  8009ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ef:	c9                   	leave
+  8009f0:	c3                   	ret
+		return 0;
+  8009f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f6:	eb f4                	jmp    8009ec <strncmp+0x2f>
+
+008009f8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fe:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a02:	eb 03                	jmp    800a07 <strchr+0xf>
+  800a04:	83 c0 01             	add    $0x1,%eax
+  800a07:	0f b6 10             	movzbl (%eax),%edx
+  800a0a:	84 d2                	test   %dl,%dl
+  800a0c:	74 06                	je     800a14 <strchr+0x1c>
+		if (*s == c)
+  800a0e:	38 ca                	cmp    %cl,%dl
+  800a10:	75 f2                	jne    800a04 <strchr+0xc>
+  800a12:	eb 05                	jmp    800a19 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a19:	5d                   	pop    %ebp
+  800a1a:	c3                   	ret
+
+00800a1b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a1b:	55                   	push   %ebp
+  800a1c:	89 e5                	mov    %esp,%ebp
+  800a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a21:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a25:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a28:	38 ca                	cmp    %cl,%dl
+  800a2a:	74 09                	je     800a35 <strfind+0x1a>
+  800a2c:	84 d2                	test   %dl,%dl
+  800a2e:	74 05                	je     800a35 <strfind+0x1a>
+	for (; *s; s++)
+  800a30:	83 c0 01             	add    $0x1,%eax
+  800a33:	eb f0                	jmp    800a25 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a35:	5d                   	pop    %ebp
+  800a36:	c3                   	ret
+
+00800a37 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	57                   	push   %edi
+  800a3b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a3e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a41:	85 c9                	test   %ecx,%ecx
+  800a43:	74 20                	je     800a65 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a45:	89 f8                	mov    %edi,%eax
+  800a47:	09 c8                	or     %ecx,%eax
+  800a49:	a8 03                	test   $0x3,%al
+  800a4b:	75 12                	jne    800a5f <memset+0x28>
+		c &= 0xFF;
+  800a4d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a51:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a57:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a5a:	fc                   	cld
+  800a5b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a5d:	eb 06                	jmp    800a65 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a62:	fc                   	cld
+  800a63:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a65:	89 f8                	mov    %edi,%eax
+  800a67:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a6a:	c9                   	leave
+  800a6b:	c3                   	ret
+
+00800a6c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a6c:	55                   	push   %ebp
+  800a6d:	89 e5                	mov    %esp,%ebp
+  800a6f:	57                   	push   %edi
+  800a70:	56                   	push   %esi
+  800a71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a74:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a77:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a7a:	39 c6                	cmp    %eax,%esi
+  800a7c:	73 32                	jae    800ab0 <memmove+0x44>
+  800a7e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a81:	39 d0                	cmp    %edx,%eax
+  800a83:	73 2b                	jae    800ab0 <memmove+0x44>
+		s += n;
+		d += n;
+  800a85:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a88:	89 d6                	mov    %edx,%esi
+  800a8a:	09 fe                	or     %edi,%esi
+  800a8c:	09 ce                	or     %ecx,%esi
+  800a8e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a94:	75 0e                	jne    800aa4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a96:	83 ef 04             	sub    $0x4,%edi
+  800a99:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a9c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a9f:	fd                   	std
+  800aa0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa2:	eb 09                	jmp    800aad <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800aa4:	83 ef 01             	sub    $0x1,%edi
+  800aa7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800aaa:	fd                   	std
+  800aab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800aad:	fc                   	cld
+  800aae:	eb 1a                	jmp    800aca <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab0:	89 f2                	mov    %esi,%edx
+  800ab2:	09 c2                	or     %eax,%edx
+  800ab4:	09 ca                	or     %ecx,%edx
+  800ab6:	f6 c2 03             	test   $0x3,%dl
+  800ab9:	75 0a                	jne    800ac5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800abb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800abe:	89 c7                	mov    %eax,%edi
+  800ac0:	fc                   	cld
+  800ac1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac3:	eb 05                	jmp    800aca <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ac5:	89 c7                	mov    %eax,%edi
+  800ac7:	fc                   	cld
+  800ac8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aca:	5e                   	pop    %esi
+  800acb:	5f                   	pop    %edi
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ad4:	ff 75 10             	push   0x10(%ebp)
+  800ad7:	ff 75 0c             	push   0xc(%ebp)
+  800ada:	ff 75 08             	push   0x8(%ebp)
+  800add:	e8 8a ff ff ff       	call   800a6c <memmove>
+}
+  800ae2:	c9                   	leave
+  800ae3:	c3                   	ret
+
+00800ae4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ae4:	55                   	push   %ebp
+  800ae5:	89 e5                	mov    %esp,%ebp
+  800ae7:	56                   	push   %esi
+  800ae8:	53                   	push   %ebx
+  800ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aec:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800aef:	89 c6                	mov    %eax,%esi
+  800af1:	03 75 10             	add    0x10(%ebp),%esi
+  800af4:	eb 06                	jmp    800afc <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800af6:	83 c0 01             	add    $0x1,%eax
+  800af9:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800afc:	39 f0                	cmp    %esi,%eax
+  800afe:	74 14                	je     800b14 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b00:	0f b6 08             	movzbl (%eax),%ecx
+  800b03:	0f b6 1a             	movzbl (%edx),%ebx
+  800b06:	38 d9                	cmp    %bl,%cl
+  800b08:	74 ec                	je     800af6 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b0a:	0f b6 c1             	movzbl %cl,%eax
+  800b0d:	0f b6 db             	movzbl %bl,%ebx
+  800b10:	29 d8                	sub    %ebx,%eax
+  800b12:	eb 05                	jmp    800b19 <memcmp+0x35>
+	}
+
+	return 0;
+  800b14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b19:	5b                   	pop    %ebx
+  800b1a:	5e                   	pop    %esi
+  800b1b:	5d                   	pop    %ebp
+  800b1c:	c3                   	ret
+
+00800b1d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b26:	89 c2                	mov    %eax,%edx
+  800b28:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b2b:	eb 03                	jmp    800b30 <memfind+0x13>
+  800b2d:	83 c0 01             	add    $0x1,%eax
+  800b30:	39 d0                	cmp    %edx,%eax
+  800b32:	73 04                	jae    800b38 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b34:	38 08                	cmp    %cl,(%eax)
+  800b36:	75 f5                	jne    800b2d <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b38:	5d                   	pop    %ebp
+  800b39:	c3                   	ret
+
+00800b3a <strtol>:
+
+long long
+strtol(const char *s, char **endptr, int base)
+{
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	57                   	push   %edi
+  800b3e:	56                   	push   %esi
+  800b3f:	53                   	push   %ebx
+  800b40:	83 ec 1c             	sub    $0x1c,%esp
+  800b43:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b46:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int neg = 0;
+	long long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b49:	eb 03                	jmp    800b4e <strtol+0x14>
+		s++;
+  800b4b:	83 c6 01             	add    $0x1,%esi
+	while (*s == ' ' || *s == '\t')
+  800b4e:	0f b6 06             	movzbl (%esi),%eax
+  800b51:	3c 20                	cmp    $0x20,%al
+  800b53:	74 f6                	je     800b4b <strtol+0x11>
+  800b55:	3c 09                	cmp    $0x9,%al
+  800b57:	74 f2                	je     800b4b <strtol+0x11>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b59:	3c 2b                	cmp    $0x2b,%al
+  800b5b:	74 43                	je     800ba0 <strtol+0x66>
+	int neg = 0;
+  800b5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+		s++;
+	else if (*s == '-')
+  800b62:	3c 2d                	cmp    $0x2d,%al
+  800b64:	74 44                	je     800baa <strtol+0x70>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b66:	f7 c7 ef ff ff ff    	test   $0xffffffef,%edi
+  800b6c:	75 0f                	jne    800b7d <strtol+0x43>
+  800b6e:	80 3e 30             	cmpb   $0x30,(%esi)
+  800b71:	74 41                	je     800bb4 <strtol+0x7a>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b73:	85 ff                	test   %edi,%edi
+  800b75:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b7a:	0f 44 f8             	cmove  %eax,%edi
+  800b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b82:	ba 00 00 00 00       	mov    $0x0,%edx
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+			break;
+		s++, val = (val * base) + dig;
+  800b87:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800b8a:	89 fb                	mov    %edi,%ebx
+  800b8c:	c1 fb 1f             	sar    $0x1f,%ebx
+  800b8f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b92:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b95:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800b98:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  800b9b:	89 75 08             	mov    %esi,0x8(%ebp)
+  800b9e:	eb 67                	jmp    800c07 <strtol+0xcd>
+		s++;
+  800ba0:	83 c6 01             	add    $0x1,%esi
+	int neg = 0;
+  800ba3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba8:	eb bc                	jmp    800b66 <strtol+0x2c>
+		s++, neg = 1;
+  800baa:	83 c6 01             	add    $0x1,%esi
+  800bad:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bb2:	eb b2                	jmp    800b66 <strtol+0x2c>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb4:	80 7e 01 78          	cmpb   $0x78,0x1(%esi)
+  800bb8:	74 0e                	je     800bc8 <strtol+0x8e>
+	else if (base == 0 && s[0] == '0')
+  800bba:	85 ff                	test   %edi,%edi
+  800bbc:	75 bf                	jne    800b7d <strtol+0x43>
+		s++, base = 8;
+  800bbe:	83 c6 01             	add    $0x1,%esi
+  800bc1:	bf 08 00 00 00       	mov    $0x8,%edi
+  800bc6:	eb b5                	jmp    800b7d <strtol+0x43>
+		s += 2, base = 16;
+  800bc8:	83 c6 02             	add    $0x2,%esi
+  800bcb:	bf 10 00 00 00       	mov    $0x10,%edi
+  800bd0:	eb ab                	jmp    800b7d <strtol+0x43>
+			dig = *s - '0';
+  800bd2:	0f be c9             	movsbl %cl,%ecx
+  800bd5:	83 e9 30             	sub    $0x30,%ecx
+		if (dig >= base)
+  800bd8:	39 f9                	cmp    %edi,%ecx
+  800bda:	7d 59                	jge    800c35 <strtol+0xfb>
+		s++, val = (val * base) + dig;
+  800bdc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  800be0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800be3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800be6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800be9:	0f af d8             	imul   %eax,%ebx
+  800bec:	0f af d7             	imul   %edi,%edx
+  800bef:	01 d3                	add    %edx,%ebx
+  800bf1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800bf4:	f7 e7                	mul    %edi
+  800bf6:	01 da                	add    %ebx,%edx
+  800bf8:	89 cb                	mov    %ecx,%ebx
+  800bfa:	c1 fb 1f             	sar    $0x1f,%ebx
+  800bfd:	01 c8                	add    %ecx,%eax
+  800bff:	11 da                	adc    %ebx,%edx
+  800c01:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  800c04:	89 55 ec             	mov    %edx,-0x14(%ebp)
+		if (*s >= '0' && *s <= '9')
+  800c07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0a:	0f b6 08             	movzbl (%eax),%ecx
+  800c0d:	8d 59 d0             	lea    -0x30(%ecx),%ebx
+  800c10:	80 fb 09             	cmp    $0x9,%bl
+  800c13:	76 bd                	jbe    800bd2 <strtol+0x98>
+		else if (*s >= 'a' && *s <= 'z')
+  800c15:	8d 59 9f             	lea    -0x61(%ecx),%ebx
+  800c18:	80 fb 19             	cmp    $0x19,%bl
+  800c1b:	77 08                	ja     800c25 <strtol+0xeb>
+			dig = *s - 'a' + 10;
+  800c1d:	0f be c9             	movsbl %cl,%ecx
+  800c20:	83 e9 57             	sub    $0x57,%ecx
+  800c23:	eb b3                	jmp    800bd8 <strtol+0x9e>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c25:	8d 59 bf             	lea    -0x41(%ecx),%ebx
+  800c28:	80 fb 19             	cmp    $0x19,%bl
+  800c2b:	77 08                	ja     800c35 <strtol+0xfb>
+			dig = *s - 'A' + 10;
+  800c2d:	0f be c9             	movsbl %cl,%ecx
+  800c30:	83 e9 37             	sub    $0x37,%ecx
+  800c33:	eb a3                	jmp    800bd8 <strtol+0x9e>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c35:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c38:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  800c3b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  800c3e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c41:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c45:	74 05                	je     800c4c <strtol+0x112>
+		*endptr = (char *) s;
+  800c47:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800c4a:	89 37                	mov    %esi,(%edi)
+	return (neg ? -val : val);
+  800c4c:	85 c9                	test   %ecx,%ecx
+  800c4e:	74 07                	je     800c57 <strtol+0x11d>
+  800c50:	f7 d8                	neg    %eax
+  800c52:	83 d2 00             	adc    $0x0,%edx
+  800c55:	f7 da                	neg    %edx
+}
+  800c57:	83 c4 1c             	add    $0x1c,%esp
+  800c5a:	5b                   	pop    %ebx
+  800c5b:	5e                   	pop    %esi
+  800c5c:	5f                   	pop    %edi
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+
+00800c5f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	57                   	push   %edi
+  800c63:	56                   	push   %esi
+  800c64:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800c65:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800c6c:	74 18                	je     800c86 <sys_cputs+0x27>
+	asm volatile("int %1\n"
+  800c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c79:	89 c3                	mov    %eax,%ebx
+  800c7b:	89 c7                	mov    %eax,%edi
+  800c7d:	89 c6                	mov    %eax,%esi
+  800c7f:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c81:	5b                   	pop    %ebx
+  800c82:	5e                   	pop    %esi
+  800c83:	5f                   	pop    %edi
+  800c84:	5d                   	pop    %ebp
+  800c85:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c91:	89 c3                	mov    %eax,%ebx
+  800c93:	89 c7                	mov    %eax,%edi
+  800c95:	55                   	push   %ebp
+  800c96:	89 e5                	mov    %esp,%ebp
+  800c98:	8d 35 a0 0c 80 00    	lea    0x800ca0,%esi
+  800c9e:	0f 34                	sysenter
+  800ca0:	5d                   	pop    %ebp
+		goto out;
+  800ca1:	eb de                	jmp    800c81 <sys_cputs+0x22>
+
+00800ca3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ca3:	55                   	push   %ebp
+  800ca4:	89 e5                	mov    %esp,%ebp
+  800ca6:	57                   	push   %edi
+  800ca7:	56                   	push   %esi
+  800ca8:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800ca9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cb0:	74 19                	je     800ccb <sys_cgetc+0x28>
+	asm volatile("int %1\n"
+  800cb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cbc:	89 d1                	mov    %edx,%ecx
+  800cbe:	89 d3                	mov    %edx,%ebx
+  800cc0:	89 d7                	mov    %edx,%edi
+  800cc2:	89 d6                	mov    %edx,%esi
+  800cc4:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800ccb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cd5:	89 d1                	mov    %edx,%ecx
+  800cd7:	89 d3                	mov    %edx,%ebx
+  800cd9:	89 d7                	mov    %edx,%edi
+  800cdb:	55                   	push   %ebp
+  800cdc:	89 e5                	mov    %esp,%ebp
+  800cde:	8d 35 e6 0c 80 00    	lea    0x800ce6,%esi
+  800ce4:	0f 34                	sysenter
+  800ce6:	5d                   	pop    %ebp
+		goto out;
+  800ce7:	eb dd                	jmp    800cc6 <sys_cgetc+0x23>
+
+00800ce9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ce9:	55                   	push   %ebp
+  800cea:	89 e5                	mov    %esp,%ebp
+  800cec:	57                   	push   %edi
+  800ced:	56                   	push   %esi
+  800cee:	53                   	push   %ebx
+  800cef:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800cf2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800cf9:	74 21                	je     800d1c <sys_env_destroy+0x33>
+	asm volatile("int %1\n"
+  800cfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d00:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d08:	89 cb                	mov    %ecx,%ebx
+  800d0a:	89 cf                	mov    %ecx,%edi
+  800d0c:	89 ce                	mov    %ecx,%esi
+  800d0e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d10:	85 c0                	test   %eax,%eax
+  800d12:	7f 27                	jg     800d3b <sys_env_destroy+0x52>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d17:	5b                   	pop    %ebx
+  800d18:	5e                   	pop    %esi
+  800d19:	5f                   	pop    %edi
+  800d1a:	5d                   	pop    %ebp
+  800d1b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d24:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d29:	89 cb                	mov    %ecx,%ebx
+  800d2b:	89 cf                	mov    %ecx,%edi
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	8d 35 38 0d 80 00    	lea    0x800d38,%esi
+  800d36:	0f 34                	sysenter
+  800d38:	5d                   	pop    %ebp
+		goto out;
+  800d39:	eb d5                	jmp    800d10 <sys_env_destroy+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d3b:	83 ec 0c             	sub    $0xc,%esp
+  800d3e:	50                   	push   %eax
+  800d3f:	6a 03                	push   $0x3
+  800d41:	68 0b 30 80 00       	push   $0x80300b
+  800d46:	6a 3f                	push   $0x3f
+  800d48:	68 28 30 80 00       	push   $0x803028
+  800d4d:	e8 71 f4 ff ff       	call   8001c3 <_panic>
+
+00800d52 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	57                   	push   %edi
+  800d56:	56                   	push   %esi
+  800d57:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d58:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800d5f:	74 19                	je     800d7a <sys_getenvid+0x28>
+	asm volatile("int %1\n"
+  800d61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d66:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d6b:	89 d1                	mov    %edx,%ecx
+  800d6d:	89 d3                	mov    %edx,%ebx
+  800d6f:	89 d7                	mov    %edx,%edi
+  800d71:	89 d6                	mov    %edx,%esi
+  800d73:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d75:	5b                   	pop    %ebx
+  800d76:	5e                   	pop    %esi
+  800d77:	5f                   	pop    %edi
+  800d78:	5d                   	pop    %ebp
+  800d79:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800d7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d84:	89 d1                	mov    %edx,%ecx
+  800d86:	89 d3                	mov    %edx,%ebx
+  800d88:	89 d7                	mov    %edx,%edi
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	8d 35 95 0d 80 00    	lea    0x800d95,%esi
+  800d93:	0f 34                	sysenter
+  800d95:	5d                   	pop    %ebp
+		goto out;
+  800d96:	eb dd                	jmp    800d75 <sys_getenvid+0x23>
+
+00800d98 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	57                   	push   %edi
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  800d9e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800da5:	74 19                	je     800dc0 <sys_yield+0x28>
+	asm volatile("int %1\n"
+  800da7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dac:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800db1:	89 d1                	mov    %edx,%ecx
+  800db3:	89 d3                	mov    %edx,%ebx
+  800db5:	89 d7                	mov    %edx,%edi
+  800db7:	89 d6                	mov    %edx,%esi
+  800db9:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dbb:	5b                   	pop    %ebx
+  800dbc:	5e                   	pop    %esi
+  800dbd:	5f                   	pop    %edi
+  800dbe:	5d                   	pop    %ebp
+  800dbf:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dca:	89 d1                	mov    %edx,%ecx
+  800dcc:	89 d3                	mov    %edx,%ebx
+  800dce:	89 d7                	mov    %edx,%edi
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	8d 35 db 0d 80 00    	lea    0x800ddb,%esi
+  800dd9:	0f 34                	sysenter
+  800ddb:	5d                   	pop    %ebp
+		goto out;
+  800ddc:	eb dd                	jmp    800dbb <sys_yield+0x23>
+
+00800dde <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dde:	55                   	push   %ebp
+  800ddf:	89 e5                	mov    %esp,%ebp
+  800de1:	57                   	push   %edi
+  800de2:	56                   	push   %esi
+  800de3:	53                   	push   %ebx
+  800de4:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800de7:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800dee:	74 23                	je     800e13 <sys_page_alloc+0x35>
+	asm volatile("int %1\n"
+  800df0:	be 00 00 00 00       	mov    $0x0,%esi
+  800df5:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e03:	89 f7                	mov    %esi,%edi
+  800e05:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e07:	85 c0                	test   %eax,%eax
+  800e09:	7f 29                	jg     800e34 <sys_page_alloc+0x56>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e19:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	8d 35 31 0e 80 00    	lea    0x800e31,%esi
+  800e2f:	0f 34                	sysenter
+  800e31:	5d                   	pop    %ebp
+		goto out;
+  800e32:	eb d3                	jmp    800e07 <sys_page_alloc+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+  800e37:	50                   	push   %eax
+  800e38:	6a 04                	push   $0x4
+  800e3a:	68 0b 30 80 00       	push   $0x80300b
+  800e3f:	6a 3f                	push   $0x3f
+  800e41:	68 28 30 80 00       	push   $0x803028
+  800e46:	e8 78 f3 ff ff       	call   8001c3 <_panic>
+
+00800e4b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e4b:	55                   	push   %ebp
+  800e4c:	89 e5                	mov    %esp,%ebp
+  800e4e:	57                   	push   %edi
+  800e4f:	56                   	push   %esi
+  800e50:	53                   	push   %ebx
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  800e54:	8b 75 18             	mov    0x18(%ebp),%esi
+	if (a5 == 0 && !syscall_use_int) {
+  800e57:	85 f6                	test   %esi,%esi
+  800e59:	75 09                	jne    800e64 <sys_page_map+0x19>
+  800e5b:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800e62:	74 1f                	je     800e83 <sys_page_map+0x38>
+	asm volatile("int %1\n"
+  800e64:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e72:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e75:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e77:	85 c0                	test   %eax,%eax
+  800e79:	7f 27                	jg     800ea2 <sys_page_map+0x57>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7e:	5b                   	pop    %ebx
+  800e7f:	5e                   	pop    %esi
+  800e80:	5f                   	pop    %edi
+  800e81:	5d                   	pop    %ebp
+  800e82:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800e83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e89:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e91:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	8d 35 9f 0e 80 00    	lea    0x800e9f,%esi
+  800e9d:	0f 34                	sysenter
+  800e9f:	5d                   	pop    %ebp
+		goto out;
+  800ea0:	eb d5                	jmp    800e77 <sys_page_map+0x2c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+  800ea5:	50                   	push   %eax
+  800ea6:	6a 05                	push   $0x5
+  800ea8:	68 0b 30 80 00       	push   $0x80300b
+  800ead:	6a 3f                	push   $0x3f
+  800eaf:	68 28 30 80 00       	push   $0x803028
+  800eb4:	e8 0a f3 ff ff       	call   8001c3 <_panic>
+
+00800eb9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	57                   	push   %edi
+  800ebd:	56                   	push   %esi
+  800ebe:	53                   	push   %ebx
+  800ebf:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800ec2:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800ec9:	74 22                	je     800eed <sys_page_unmap+0x34>
+	asm volatile("int %1\n"
+  800ecb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed0:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ed5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edb:	89 df                	mov    %ebx,%edi
+  800edd:	89 de                	mov    %ebx,%esi
+  800edf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee1:	85 c0                	test   %eax,%eax
+  800ee3:	7f 28                	jg     800f0d <sys_page_unmap+0x54>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee8:	5b                   	pop    %ebx
+  800ee9:	5e                   	pop    %esi
+  800eea:	5f                   	pop    %edi
+  800eeb:	5d                   	pop    %ebp
+  800eec:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800eed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800efd:	89 df                	mov    %ebx,%edi
+  800eff:	55                   	push   %ebp
+  800f00:	89 e5                	mov    %esp,%ebp
+  800f02:	8d 35 0a 0f 80 00    	lea    0x800f0a,%esi
+  800f08:	0f 34                	sysenter
+  800f0a:	5d                   	pop    %ebp
+		goto out;
+  800f0b:	eb d4                	jmp    800ee1 <sys_page_unmap+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+  800f10:	50                   	push   %eax
+  800f11:	6a 06                	push   $0x6
+  800f13:	68 0b 30 80 00       	push   $0x80300b
+  800f18:	6a 3f                	push   $0x3f
+  800f1a:	68 28 30 80 00       	push   $0x803028
+  800f1f:	e8 9f f2 ff ff       	call   8001c3 <_panic>
+
+00800f24 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	56                   	push   %esi
+  800f29:	53                   	push   %ebx
+  800f2a:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f2d:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f34:	74 22                	je     800f58 <sys_env_set_status+0x34>
+	asm volatile("int %1\n"
+  800f36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3b:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f46:	89 df                	mov    %ebx,%edi
+  800f48:	89 de                	mov    %ebx,%esi
+  800f4a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	7f 28                	jg     800f78 <sys_env_set_status+0x54>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f53:	5b                   	pop    %ebx
+  800f54:	5e                   	pop    %esi
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800f58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f63:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f68:	89 df                	mov    %ebx,%edi
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	8d 35 75 0f 80 00    	lea    0x800f75,%esi
+  800f73:	0f 34                	sysenter
+  800f75:	5d                   	pop    %ebp
+		goto out;
+  800f76:	eb d4                	jmp    800f4c <sys_env_set_status+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f78:	83 ec 0c             	sub    $0xc,%esp
+  800f7b:	50                   	push   %eax
+  800f7c:	6a 08                	push   $0x8
+  800f7e:	68 0b 30 80 00       	push   $0x80300b
+  800f83:	6a 3f                	push   $0x3f
+  800f85:	68 28 30 80 00       	push   $0x803028
+  800f8a:	e8 34 f2 ff ff       	call   8001c3 <_panic>
+
+00800f8f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f8f:	55                   	push   %ebp
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	57                   	push   %edi
+  800f93:	56                   	push   %esi
+  800f94:	53                   	push   %ebx
+  800f95:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  800f98:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  800f9f:	74 22                	je     800fc3 <sys_env_set_trapframe+0x34>
+	asm volatile("int %1\n"
+  800fa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa6:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb1:	89 df                	mov    %ebx,%edi
+  800fb3:	89 de                	mov    %ebx,%esi
+  800fb5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb7:	85 c0                	test   %eax,%eax
+  800fb9:	7f 28                	jg     800fe3 <sys_env_set_trapframe+0x54>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbe:	5b                   	pop    %ebx
+  800fbf:	5e                   	pop    %esi
+  800fc0:	5f                   	pop    %edi
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  800fc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fce:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fd3:	89 df                	mov    %ebx,%edi
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	8d 35 e0 0f 80 00    	lea    0x800fe0,%esi
+  800fde:	0f 34                	sysenter
+  800fe0:	5d                   	pop    %ebp
+		goto out;
+  800fe1:	eb d4                	jmp    800fb7 <sys_env_set_trapframe+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	50                   	push   %eax
+  800fe7:	6a 09                	push   $0x9
+  800fe9:	68 0b 30 80 00       	push   $0x80300b
+  800fee:	6a 3f                	push   $0x3f
+  800ff0:	68 28 30 80 00       	push   $0x803028
+  800ff5:	e8 c9 f1 ff ff       	call   8001c3 <_panic>
+
+00800ffa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	56                   	push   %esi
+  800fff:	53                   	push   %ebx
+  801000:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801003:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80100a:	74 22                	je     80102e <sys_env_set_pgfault_upcall+0x34>
+	asm volatile("int %1\n"
+  80100c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801011:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801016:	8b 55 08             	mov    0x8(%ebp),%edx
+  801019:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101c:	89 df                	mov    %ebx,%edi
+  80101e:	89 de                	mov    %ebx,%esi
+  801020:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801022:	85 c0                	test   %eax,%eax
+  801024:	7f 28                	jg     80104e <sys_env_set_pgfault_upcall+0x54>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801029:	5b                   	pop    %ebx
+  80102a:	5e                   	pop    %esi
+  80102b:	5f                   	pop    %edi
+  80102c:	5d                   	pop    %ebp
+  80102d:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80102e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801033:	8b 55 08             	mov    0x8(%ebp),%edx
+  801036:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801039:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80103e:	89 df                	mov    %ebx,%edi
+  801040:	55                   	push   %ebp
+  801041:	89 e5                	mov    %esp,%ebp
+  801043:	8d 35 4b 10 80 00    	lea    0x80104b,%esi
+  801049:	0f 34                	sysenter
+  80104b:	5d                   	pop    %ebp
+		goto out;
+  80104c:	eb d4                	jmp    801022 <sys_env_set_pgfault_upcall+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104e:	83 ec 0c             	sub    $0xc,%esp
+  801051:	50                   	push   %eax
+  801052:	6a 0a                	push   $0xa
+  801054:	68 0b 30 80 00       	push   $0x80300b
+  801059:	6a 3f                	push   $0x3f
+  80105b:	68 28 30 80 00       	push   $0x803028
+  801060:	e8 5e f1 ff ff       	call   8001c3 <_panic>
+
+00801065 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int priority)
+{
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	57                   	push   %edi
+  801069:	56                   	push   %esi
+  80106a:	53                   	push   %ebx
+  80106b:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80106e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801075:	74 22                	je     801099 <sys_env_set_priority+0x34>
+	asm volatile("int %1\n"
+  801077:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801087:	89 df                	mov    %ebx,%edi
+  801089:	89 de                	mov    %ebx,%esi
+  80108b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80108d:	85 c0                	test   %eax,%eax
+  80108f:	7f 28                	jg     8010b9 <sys_env_set_priority+0x54>
+	return syscall(SYS_env_set_priority, 1, envid, priority, 0, 0, 0);
+}
+  801091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801094:	5b                   	pop    %ebx
+  801095:	5e                   	pop    %esi
+  801096:	5f                   	pop    %edi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801099:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010a9:	89 df                	mov    %ebx,%edi
+  8010ab:	55                   	push   %ebp
+  8010ac:	89 e5                	mov    %esp,%ebp
+  8010ae:	8d 35 b6 10 80 00    	lea    0x8010b6,%esi
+  8010b4:	0f 34                	sysenter
+  8010b6:	5d                   	pop    %ebp
+		goto out;
+  8010b7:	eb d4                	jmp    80108d <sys_env_set_priority+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010b9:	83 ec 0c             	sub    $0xc,%esp
+  8010bc:	50                   	push   %eax
+  8010bd:	6a 17                	push   $0x17
+  8010bf:	68 0b 30 80 00       	push   $0x80300b
+  8010c4:	6a 3f                	push   $0x3f
+  8010c6:	68 28 30 80 00       	push   $0x803028
+  8010cb:	e8 f3 f0 ff ff       	call   8001c3 <_panic>
+
+008010d0 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t cpumask)
+{
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	57                   	push   %edi
+  8010d4:	56                   	push   %esi
+  8010d5:	53                   	push   %ebx
+  8010d6:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8010d9:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8010e0:	74 22                	je     801104 <sys_env_set_affinity+0x34>
+	asm volatile("int %1\n"
+  8010e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e7:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f2:	89 df                	mov    %ebx,%edi
+  8010f4:	89 de                	mov    %ebx,%esi
+  8010f6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f8:	85 c0                	test   %eax,%eax
+  8010fa:	7f 28                	jg     801124 <sys_env_set_affinity+0x54>
+	return syscall(SYS_env_set_affinity, 1, envid, cpumask, 0, 0, 0);
+}
+  8010fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ff:	5b                   	pop    %ebx
+  801100:	5e                   	pop    %esi
+  801101:	5f                   	pop    %edi
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801109:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110f:	b8 18 00 00 00       	mov    $0x18,%eax
+  801114:	89 df                	mov    %ebx,%edi
+  801116:	55                   	push   %ebp
+  801117:	89 e5                	mov    %esp,%ebp
+  801119:	8d 35 21 11 80 00    	lea    0x801121,%esi
+  80111f:	0f 34                	sysenter
+  801121:	5d                   	pop    %ebp
+		goto out;
+  801122:	eb d4                	jmp    8010f8 <sys_env_set_affinity+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801124:	83 ec 0c             	sub    $0xc,%esp
+  801127:	50                   	push   %eax
+  801128:	6a 18                	push   $0x18
+  80112a:	68 0b 30 80 00       	push   $0x80300b
+  80112f:	6a 3f                	push   $0x3f
+  801131:	68 28 30 80 00       	push   $0x803028
+  801136:	e8 88 f0 ff ff       	call   8001c3 <_panic>
+
+0080113b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	57                   	push   %edi
+  80113f:	56                   	push   %esi
+  801140:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801141:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801148:	74 1d                	je     801167 <sys_ipc_try_send+0x2c>
+	asm volatile("int %1\n"
+  80114a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80114f:	be 00 00 00 00       	mov    $0x0,%esi
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801160:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801172:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801175:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	8d 35 83 11 80 00    	lea    0x801183,%esi
+  801181:	0f 34                	sysenter
+  801183:	5d                   	pop    %ebp
+		goto out;
+  801184:	eb dc                	jmp    801162 <sys_ipc_try_send+0x27>
+
+00801186 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	57                   	push   %edi
+  80118a:	56                   	push   %esi
+  80118b:	53                   	push   %ebx
+  80118c:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  80118f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801196:	74 21                	je     8011b9 <sys_ipc_recv+0x33>
+	asm volatile("int %1\n"
+  801198:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a5:	89 cb                	mov    %ecx,%ebx
+  8011a7:	89 cf                	mov    %ecx,%edi
+  8011a9:	89 ce                	mov    %ecx,%esi
+  8011ab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ad:	85 c0                	test   %eax,%eax
+  8011af:	7f 27                	jg     8011d8 <sys_ipc_recv+0x52>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5e                   	pop    %esi
+  8011b6:	5f                   	pop    %edi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011c6:	89 cb                	mov    %ecx,%ebx
+  8011c8:	89 cf                	mov    %ecx,%edi
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	8d 35 d5 11 80 00    	lea    0x8011d5,%esi
+  8011d3:	0f 34                	sysenter
+  8011d5:	5d                   	pop    %ebp
+		goto out;
+  8011d6:	eb d5                	jmp    8011ad <sys_ipc_recv+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d8:	83 ec 0c             	sub    $0xc,%esp
+  8011db:	50                   	push   %eax
+  8011dc:	6a 0d                	push   $0xd
+  8011de:	68 0b 30 80 00       	push   $0x80300b
+  8011e3:	6a 3f                	push   $0x3f
+  8011e5:	68 28 30 80 00       	push   $0x803028
+  8011ea:	e8 d4 ef ff ff       	call   8001c3 <_panic>
+
+008011ef <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, unsigned deadline)
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	57                   	push   %edi
+  8011f3:	56                   	push   %esi
+  8011f4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8011f5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8011fc:	74 1b                	je     801219 <sys_ipc_recv_until+0x2a>
+	asm volatile("int %1\n"
+  8011fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801203:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801208:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120e:	89 df                	mov    %ebx,%edi
+  801210:	89 de                	mov    %ebx,%esi
+  801212:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_recv, 0, (uint32_t)dstva, deadline, 0, 0, 0);
+}
+  801214:	5b                   	pop    %ebx
+  801215:	5e                   	pop    %esi
+  801216:	5f                   	pop    %edi
+  801217:	5d                   	pop    %ebp
+  801218:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801219:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801221:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801224:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801229:	89 df                	mov    %ebx,%edi
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	8d 35 36 12 80 00    	lea    0x801236,%esi
+  801234:	0f 34                	sysenter
+  801236:	5d                   	pop    %ebp
+		goto out;
+  801237:	eb db                	jmp    801214 <sys_ipc_recv_until+0x25>
+
+00801239 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801239:	55                   	push   %ebp
+  80123a:	89 e5                	mov    %esp,%ebp
+  80123c:	57                   	push   %edi
+  80123d:	56                   	push   %esi
+  80123e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80123f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801246:	74 19                	je     801261 <sys_time_msec+0x28>
+	asm volatile("int %1\n"
+  801248:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801252:	89 d1                	mov    %edx,%ecx
+  801254:	89 d3                	mov    %edx,%ebx
+  801256:	89 d7                	mov    %edx,%edi
+  801258:	89 d6                	mov    %edx,%esi
+  80125a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80125c:	5b                   	pop    %ebx
+  80125d:	5e                   	pop    %esi
+  80125e:	5f                   	pop    %edi
+  80125f:	5d                   	pop    %ebp
+  801260:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801261:	ba 00 00 00 00       	mov    $0x0,%edx
+  801266:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80126b:	89 d1                	mov    %edx,%ecx
+  80126d:	89 d3                	mov    %edx,%ebx
+  80126f:	89 d7                	mov    %edx,%edi
+  801271:	55                   	push   %ebp
+  801272:	89 e5                	mov    %esp,%ebp
+  801274:	8d 35 7c 12 80 00    	lea    0x80127c,%esi
+  80127a:	0f 34                	sysenter
+  80127c:	5d                   	pop    %ebp
+		goto out;
+  80127d:	eb dd                	jmp    80125c <sys_time_msec+0x23>
+
+0080127f <sys_sleep_until>:
+
+int
+sys_sleep_until(unsigned deadline)
+{
+  80127f:	55                   	push   %ebp
+  801280:	89 e5                	mov    %esp,%ebp
+  801282:	57                   	push   %edi
+  801283:	56                   	push   %esi
+  801284:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801285:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80128c:	74 1a                	je     8012a8 <sys_sleep_until+0x29>
+	asm volatile("int %1\n"
+  80128e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801293:	b8 10 00 00 00       	mov    $0x10,%eax
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	89 cb                	mov    %ecx,%ebx
+  80129d:	89 cf                	mov    %ecx,%edi
+  80129f:	89 ce                	mov    %ecx,%esi
+  8012a1:	cd 30                	int    $0x30
+	return syscall(SYS_sleep_until, 0, deadline, 0, 0, 0, 0);
+}
+  8012a3:	5b                   	pop    %ebx
+  8012a4:	5e                   	pop    %esi
+  8012a5:	5f                   	pop    %edi
+  8012a6:	5d                   	pop    %ebp
+  8012a7:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012b5:	89 cb                	mov    %ecx,%ebx
+  8012b7:	89 cf                	mov    %ecx,%edi
+  8012b9:	55                   	push   %ebp
+  8012ba:	89 e5                	mov    %esp,%ebp
+  8012bc:	8d 35 c4 12 80 00    	lea    0x8012c4,%esi
+  8012c2:	0f 34                	sysenter
+  8012c4:	5d                   	pop    %ebp
+		goto out;
+  8012c5:	eb dc                	jmp    8012a3 <sys_sleep_until+0x24>
+
+008012c7 <sys_env_print_stats>:
+
+int
+sys_env_print_stats(int limit)
+{
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+  8012ca:	57                   	push   %edi
+  8012cb:	56                   	push   %esi
+  8012cc:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8012cd:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8012d4:	74 1a                	je     8012f0 <sys_env_print_stats+0x29>
+	asm volatile("int %1\n"
+  8012d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012db:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e3:	89 cb                	mov    %ecx,%ebx
+  8012e5:	89 cf                	mov    %ecx,%edi
+  8012e7:	89 ce                	mov    %ecx,%esi
+  8012e9:	cd 30                	int    $0x30
+	return syscall(SYS_env_print_stats, 0, limit, 0, 0, 0, 0);
+}
+  8012eb:	5b                   	pop    %ebx
+  8012ec:	5e                   	pop    %esi
+  8012ed:	5f                   	pop    %edi
+  8012ee:	5d                   	pop    %ebp
+  8012ef:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8012f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012fd:	89 cb                	mov    %ecx,%ebx
+  8012ff:	89 cf                	mov    %ecx,%edi
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  801304:	8d 35 0c 13 80 00    	lea    0x80130c,%esi
+  80130a:	0f 34                	sysenter
+  80130c:	5d                   	pop    %ebp
+		goto out;
+  80130d:	eb dc                	jmp    8012eb <sys_env_print_stats+0x24>
+
+0080130f <sys_perf>:
+
+int
+sys_perf(int op, unsigned arg)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801315:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80131c:	74 1b                	je     801339 <sys_perf+0x2a>
+	asm volatile("int %1\n"
+  80131e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801323:	b8 19 00 00 00       	mov    $0x19,%eax
+  801328:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132e:	89 df                	mov    %ebx,%edi
+  801330:	89 de                	mov    %ebx,%esi
+  801332:	cd 30                	int    $0x30
+	return syscall(SYS_perf, 0, op, arg, 0, 0, 0);
+}
+  801334:	5b                   	pop    %ebx
+  801335:	5e                   	pop    %esi
+  801336:	5f                   	pop    %edi
+  801337:	5d                   	pop    %ebp
+  801338:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801339:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801341:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801344:	b8 19 00 00 00       	mov    $0x19,%eax
+  801349:	89 df                	mov    %ebx,%edi
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	8d 35 56 13 80 00    	lea    0x801356,%esi
+  801354:	0f 34                	sysenter
+  801356:	5d                   	pop    %ebp
+		goto out;
+  801357:	eb db                	jmp    801334 <sys_perf+0x25>
+
+00801359 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801359:	55                   	push   %ebp
+  80135a:	89 e5                	mov    %esp,%ebp
+  80135c:	57                   	push   %edi
+  80135d:	56                   	push   %esi
+  80135e:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80135f:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801366:	74 19                	je     801381 <sys_fork+0x28>
+	asm volatile("int %1\n"
+  801368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801372:	89 d1                	mov    %edx,%ecx
+  801374:	89 d3                	mov    %edx,%ebx
+  801376:	89 d7                	mov    %edx,%edi
+  801378:	89 d6                	mov    %edx,%esi
+  80137a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80137c:	5b                   	pop    %ebx
+  80137d:	5e                   	pop    %esi
+  80137e:	5f                   	pop    %edi
+  80137f:	5d                   	pop    %ebp
+  801380:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801381:	ba 00 00 00 00       	mov    $0x0,%edx
+  801386:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80138b:	89 d1                	mov    %edx,%ecx
+  80138d:	89 d3                	mov    %edx,%ebx
+  80138f:	89 d7                	mov    %edx,%edi
+  801391:	55                   	push   %ebp
+  801392:	89 e5                	mov    %esp,%ebp
+  801394:	8d 35 9c 13 80 00    	lea    0x80139c,%esi
+  80139a:	0f 34                	sysenter
+  80139c:	5d                   	pop    %ebp
+		goto out;
+  80139d:	eb dd                	jmp    80137c <sys_fork+0x23>
+
+0080139f <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, uint32_t a1, uint32_t a2)
+{
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+  8013a2:	57                   	push   %edi
+  8013a3:	56                   	push   %esi
+  8013a4:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8013a5:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013ac:	74 1c                	je     8013ca <sys_thread_create+0x2b>
+	asm volatile("int %1\n"
+  8013ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013c1:	89 f7                	mov    %esi,%edi
+  8013c3:	cd 30                	int    $0x30
+	return syscall(SYS_thread_create, 0, (uint32_t) eip, a1, a2, 0, 0);
+}
+  8013c5:	5b                   	pop    %ebx
+  8013c6:	5e                   	pop    %esi
+  8013c7:	5f                   	pop    %edi
+  8013c8:	5d                   	pop    %ebp
+  8013c9:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8013ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+  8013d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	8d 35 e8 13 80 00    	lea    0x8013e8,%esi
+  8013e6:	0f 34                	sysenter
+  8013e8:	5d                   	pop    %ebp
+		goto out;
+  8013e9:	eb da                	jmp    8013c5 <sys_thread_create+0x26>
+
+008013eb <sys_region_reserve>:
+
+int
+sys_region_reserve(envid_t envid, void *va, size_t len, int perm)
+{
+  8013eb:	55                   	push   %ebp
+  8013ec:	89 e5                	mov    %esp,%ebp
+  8013ee:	57                   	push   %edi
+  8013ef:	56                   	push   %esi
+  8013f0:	53                   	push   %ebx
+  8013f1:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8013f4:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8013fb:	74 24                	je     801421 <sys_region_reserve+0x36>
+	asm volatile("int %1\n"
+  8013fd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  801402:	be 00 00 00 00       	mov    $0x0,%esi
+  801407:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801410:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801413:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801415:	85 c0                	test   %eax,%eax
+  801417:	7f 27                	jg     801440 <sys_region_reserve+0x55>
+	return syscall(SYS_region_reserve, 1, envid, (uint32_t) va, len, perm, 0);
+}
+  801419:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141c:	5b                   	pop    %ebx
+  80141d:	5e                   	pop    %esi
+  80141e:	5f                   	pop    %edi
+  80141f:	5d                   	pop    %ebp
+  801420:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801421:	8b 55 08             	mov    0x8(%ebp),%edx
+  801424:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801427:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  80142c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801432:	55                   	push   %ebp
+  801433:	89 e5                	mov    %esp,%ebp
+  801435:	8d 35 3d 14 80 00    	lea    0x80143d,%esi
+  80143b:	0f 34                	sysenter
+  80143d:	5d                   	pop    %ebp
+		goto out;
+  80143e:	eb d5                	jmp    801415 <sys_region_reserve+0x2a>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801440:	83 ec 0c             	sub    $0xc,%esp
+  801443:	50                   	push   %eax
+  801444:	6a 1f                	push   $0x1f
+  801446:	68 0b 30 80 00       	push   $0x80300b
+  80144b:	6a 3f                	push   $0x3f
+  80144d:	68 28 30 80 00       	push   $0x803028
+  801452:	e8 6c ed ff ff       	call   8001c3 <_panic>
+
+00801457 <sys_region_release>:
+
+int
+sys_region_release(envid_t envid, void *va, size_t len)
+{
+  801457:	55                   	push   %ebp
+  801458:	89 e5                	mov    %esp,%ebp
+  80145a:	57                   	push   %edi
+  80145b:	56                   	push   %esi
+  80145c:	53                   	push   %ebx
+  80145d:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  801460:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801467:	74 23                	je     80148c <sys_region_release+0x35>
+	asm volatile("int %1\n"
+  801469:	be 00 00 00 00       	mov    $0x0,%esi
+  80146e:	b8 20 00 00 00       	mov    $0x20,%eax
+  801473:	8b 55 08             	mov    0x8(%ebp),%edx
+  801476:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801479:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147c:	89 f7                	mov    %esi,%edi
+  80147e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801480:	85 c0                	test   %eax,%eax
+  801482:	7f 29                	jg     8014ad <sys_region_release+0x56>
+	return syscall(SYS_region_release, 1, envid, (uint32_t) va, len, 0, 0);
+}
+  801484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801487:	5b                   	pop    %ebx
+  801488:	5e                   	pop    %esi
+  801489:	5f                   	pop    %edi
+  80148a:	5d                   	pop    %ebp
+  80148b:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  80148c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801492:	b8 20 00 00 00       	mov    $0x20,%eax
+  801497:	bf 00 00 00 00       	mov    $0x0,%edi
+  80149c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	8d 35 aa 14 80 00    	lea    0x8014aa,%esi
+  8014a8:	0f 34                	sysenter
+  8014aa:	5d                   	pop    %ebp
+		goto out;
+  8014ab:	eb d3                	jmp    801480 <sys_region_release+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014ad:	83 ec 0c             	sub    $0xc,%esp
+  8014b0:	50                   	push   %eax
+  8014b1:	6a 20                	push   $0x20
+  8014b3:	68 0b 30 80 00       	push   $0x80300b
+  8014b8:	6a 3f                	push   $0x3f
+  8014ba:	68 28 30 80 00       	push   $0x803028
+  8014bf:	e8 ff ec ff ff       	call   8001c3 <_panic>
+
+008014c4 <sys_batch>:
+
+int
+sys_batch(struct BatchOp *ops, size_t n)
+{
+  8014c4:	55                   	push   %ebp
+  8014c5:	89 e5                	mov    %esp,%ebp
+  8014c7:	57                   	push   %edi
+  8014c8:	56                   	push   %esi
+  8014c9:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8014ca:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8014d1:	74 1b                	je     8014ee <sys_batch+0x2a>
+	asm volatile("int %1\n"
+  8014d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e3:	89 df                	mov    %ebx,%edi
+  8014e5:	89 de                	mov    %ebx,%esi
+  8014e7:	cd 30                	int    $0x30
+	return syscall(SYS_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014e9:	5b                   	pop    %ebx
+  8014ea:	5e                   	pop    %esi
+  8014eb:	5f                   	pop    %edi
+  8014ec:	5d                   	pop    %ebp
+  8014ed:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8014ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8014fe:	89 df                	mov    %ebx,%edi
+  801500:	55                   	push   %ebp
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	8d 35 0b 15 80 00    	lea    0x80150b,%esi
+  801509:	0f 34                	sysenter
+  80150b:	5d                   	pop    %ebp
+		goto out;
+  80150c:	eb db                	jmp    8014e9 <sys_batch+0x25>
+
+0080150e <sys_trace_ctl>:
+
+uint32_t
+sys_trace_ctl(uint32_t mask)
+{
+  80150e:	55                   	push   %ebp
+  80150f:	89 e5                	mov    %esp,%ebp
+  801511:	57                   	push   %edi
+  801512:	56                   	push   %esi
+  801513:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801514:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80151b:	74 1a                	je     801537 <sys_trace_ctl+0x29>
+	asm volatile("int %1\n"
+  80151d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801522:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801527:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152a:	89 cb                	mov    %ecx,%ebx
+  80152c:	89 cf                	mov    %ecx,%edi
+  80152e:	89 ce                	mov    %ecx,%esi
+  801530:	cd 30                	int    $0x30
+	return syscall(SYS_trace_ctl, 0, mask, 0, 0, 0, 0);
+}
+  801532:	5b                   	pop    %ebx
+  801533:	5e                   	pop    %esi
+  801534:	5f                   	pop    %edi
+  801535:	5d                   	pop    %ebp
+  801536:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801537:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80153f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801544:	89 cb                	mov    %ecx,%ebx
+  801546:	89 cf                	mov    %ecx,%edi
+  801548:	55                   	push   %ebp
+  801549:	89 e5                	mov    %esp,%ebp
+  80154b:	8d 35 53 15 80 00    	lea    0x801553,%esi
+  801551:	0f 34                	sysenter
+  801553:	5d                   	pop    %ebp
+		goto out;
+  801554:	eb dc                	jmp    801532 <sys_trace_ctl+0x24>
+
+00801556 <sys_trace_read>:
+
+int
+sys_trace_read(int cpu, struct TraceRecord *buf, int n)
+{
+  801556:	55                   	push   %ebp
+  801557:	89 e5                	mov    %esp,%ebp
+  801559:	57                   	push   %edi
+  80155a:	56                   	push   %esi
+  80155b:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80155c:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801563:	74 1c                	je     801581 <sys_trace_read+0x2b>
+	asm volatile("int %1\n"
+  801565:	be 00 00 00 00       	mov    $0x0,%esi
+  80156a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80156f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801572:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801575:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801578:	89 f7                	mov    %esi,%edi
+  80157a:	cd 30                	int    $0x30
+	return syscall(SYS_trace_read, 0, cpu, (uint32_t) buf, n, 0, 0);
+}
+  80157c:	5b                   	pop    %ebx
+  80157d:	5e                   	pop    %esi
+  80157e:	5f                   	pop    %edi
+  80157f:	5d                   	pop    %ebp
+  801580:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801581:	8b 55 08             	mov    0x8(%ebp),%edx
+  801584:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801587:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80158c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801591:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	8d 35 9f 15 80 00    	lea    0x80159f,%esi
+  80159d:	0f 34                	sysenter
+  80159f:	5d                   	pop    %ebp
+		goto out;
+  8015a0:	eb da                	jmp    80157c <sys_trace_read+0x26>
+
+008015a2 <sys_meminfo>:
+
+int
+sys_meminfo(struct MemInfo *info, struct EnvMemInfo *envs, int n)
+{
+  8015a2:	55                   	push   %ebp
+  8015a3:	89 e5                	mov    %esp,%ebp
+  8015a5:	57                   	push   %edi
+  8015a6:	56                   	push   %esi
+  8015a7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8015a8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8015af:	74 1c                	je     8015cd <sys_meminfo+0x2b>
+	asm volatile("int %1\n"
+  8015b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b6:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c4:	89 f7                	mov    %esi,%edi
+  8015c6:	cd 30                	int    $0x30
+	return syscall(SYS_meminfo, 0, (uint32_t) info, (uint32_t) envs, n, 0, 0);
+}
+  8015c8:	5b                   	pop    %ebx
+  8015c9:	5e                   	pop    %esi
+  8015ca:	5f                   	pop    %edi
+  8015cb:	5d                   	pop    %ebp
+  8015cc:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8015cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015d3:	b8 21 00 00 00       	mov    $0x21,%eax
+  8015d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	8d 35 eb 15 80 00    	lea    0x8015eb,%esi
+  8015e9:	0f 34                	sysenter
+  8015eb:	5d                   	pop    %ebp
+		goto out;
+  8015ec:	eb da                	jmp    8015c8 <sys_meminfo+0x26>
+
+008015ee <sys_env_set_ksm>:
+
+int
+sys_env_set_ksm(envid_t envid, bool on)
+{
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	57                   	push   %edi
+  8015f2:	56                   	push   %esi
+  8015f3:	53                   	push   %ebx
+  8015f4:	83 ec 0c             	sub    $0xc,%esp
+	return syscall(SYS_env_set_ksm, 1, envid, on, 0, 0, 0);
+  8015f7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	if (a5 == 0 && !syscall_use_int) {
+  8015fb:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801602:	74 1f                	je     801623 <sys_env_set_ksm+0x35>
+	asm volatile("int %1\n"
+  801604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801609:	b8 22 00 00 00       	mov    $0x22,%eax
+  80160e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801611:	89 df                	mov    %ebx,%edi
+  801613:	89 de                	mov    %ebx,%esi
+  801615:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801617:	85 c0                	test   %eax,%eax
+  801619:	7f 25                	jg     801640 <sys_env_set_ksm+0x52>
+}
+  80161b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161e:	5b                   	pop    %ebx
+  80161f:	5e                   	pop    %esi
+  801620:	5f                   	pop    %edi
+  801621:	5d                   	pop    %ebp
+  801622:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801623:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801628:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162b:	b8 22 00 00 00       	mov    $0x22,%eax
+  801630:	89 df                	mov    %ebx,%edi
+  801632:	55                   	push   %ebp
+  801633:	89 e5                	mov    %esp,%ebp
+  801635:	8d 35 3d 16 80 00    	lea    0x80163d,%esi
+  80163b:	0f 34                	sysenter
+  80163d:	5d                   	pop    %ebp
+		goto out;
+  80163e:	eb d7                	jmp    801617 <sys_env_set_ksm+0x29>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801640:	83 ec 0c             	sub    $0xc,%esp
+  801643:	50                   	push   %eax
+  801644:	6a 22                	push   $0x22
+  801646:	68 0b 30 80 00       	push   $0x80300b
+  80164b:	6a 3f                	push   $0x3f
+  80164d:	68 28 30 80 00       	push   $0x803028
+  801652:	e8 6c eb ff ff       	call   8001c3 <_panic>
+
+00801657 <sys_time_nsec>:
+
+uint64_t
+sys_time_nsec(void)
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	57                   	push   %edi
+  80165b:	56                   	push   %esi
+  80165c:	53                   	push   %ebx
+  80165d:	83 ec 1c             	sub    $0x1c,%esp
+	uint64_t ns;
+
+	syscall(SYS_time_nsec, 1, (uint32_t) &ns, 0, 0, 0, 0);
+  801660:	8d 55 e0             	lea    -0x20(%ebp),%edx
+	if (a5 == 0 && !syscall_use_int) {
+  801663:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80166a:	74 24                	je     801690 <sys_time_nsec+0x39>
+	asm volatile("int %1\n"
+  80166c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801671:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801676:	89 cb                	mov    %ecx,%ebx
+  801678:	89 cf                	mov    %ecx,%edi
+  80167a:	89 ce                	mov    %ecx,%esi
+  80167c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80167e:	85 c0                	test   %eax,%eax
+  801680:	7f 2a                	jg     8016ac <sys_time_nsec+0x55>
+	return ns;
+}
+  801682:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801685:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801688:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168b:	5b                   	pop    %ebx
+  80168c:	5e                   	pop    %esi
+  80168d:	5f                   	pop    %edi
+  80168e:	5d                   	pop    %ebp
+  80168f:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801695:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80169a:	89 cb                	mov    %ecx,%ebx
+  80169c:	89 cf                	mov    %ecx,%edi
+  80169e:	55                   	push   %ebp
+  80169f:	89 e5                	mov    %esp,%ebp
+  8016a1:	8d 35 a9 16 80 00    	lea    0x8016a9,%esi
+  8016a7:	0f 34                	sysenter
+  8016a9:	5d                   	pop    %ebp
+		goto out;
+  8016aa:	eb d2                	jmp    80167e <sys_time_nsec+0x27>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016ac:	83 ec 0c             	sub    $0xc,%esp
+  8016af:	50                   	push   %eax
+  8016b0:	6a 0f                	push   $0xf
+  8016b2:	68 0b 30 80 00       	push   $0x80300b
+  8016b7:	6a 3f                	push   $0x3f
+  8016b9:	68 28 30 80 00       	push   $0x803028
+  8016be:	e8 00 eb ff ff       	call   8001c3 <_panic>
+
+008016c3 <sys_e1000_transmit>:
+
+int
+sys_e1000_transmit(char *packet, size_t len)
+{
+  8016c3:	55                   	push   %ebp
+  8016c4:	89 e5                	mov    %esp,%ebp
+  8016c6:	57                   	push   %edi
+  8016c7:	56                   	push   %esi
+  8016c8:	53                   	push   %ebx
+  8016c9:	83 ec 0c             	sub    $0xc,%esp
+	if (a5 == 0 && !syscall_use_int) {
+  8016cc:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8016d3:	74 22                	je     8016f7 <sys_e1000_transmit+0x34>
+	asm volatile("int %1\n"
+  8016d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016da:	b8 12 00 00 00       	mov    $0x12,%eax
+  8016df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e5:	89 df                	mov    %ebx,%edi
+  8016e7:	89 de                	mov    %ebx,%esi
+  8016e9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016eb:	85 c0                	test   %eax,%eax
+  8016ed:	7f 28                	jg     801717 <sys_e1000_transmit+0x54>
+	return syscall(SYS_e1000_transmit, 1, (uint32_t) packet, len, 0, 0, 0);
+}
+  8016ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f2:	5b                   	pop    %ebx
+  8016f3:	5e                   	pop    %esi
+  8016f4:	5f                   	pop    %edi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8016f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801702:	b8 12 00 00 00       	mov    $0x12,%eax
+  801707:	89 df                	mov    %ebx,%edi
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	8d 35 14 17 80 00    	lea    0x801714,%esi
+  801712:	0f 34                	sysenter
+  801714:	5d                   	pop    %ebp
+		goto out;
+  801715:	eb d4                	jmp    8016eb <sys_e1000_transmit+0x28>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801717:	83 ec 0c             	sub    $0xc,%esp
+  80171a:	50                   	push   %eax
+  80171b:	6a 12                	push   $0x12
+  80171d:	68 0b 30 80 00       	push   $0x80300b
+  801722:	6a 3f                	push   $0x3f
+  801724:	68 28 30 80 00       	push   $0x803028
+  801729:	e8 95 ea ff ff       	call   8001c3 <_panic>
+
+0080172e <sys_e1000_receive>:
+
+int
+sys_e1000_receive(char *buffer, size_t len)
+{
+  80172e:	55                   	push   %ebp
+  80172f:	89 e5                	mov    %esp,%ebp
+  801731:	57                   	push   %edi
+  801732:	56                   	push   %esi
+  801733:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801734:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  80173b:	74 1b                	je     801758 <sys_e1000_receive+0x2a>
+	asm volatile("int %1\n"
+  80173d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801742:	b8 13 00 00 00       	mov    $0x13,%eax
+  801747:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80174d:	89 df                	mov    %ebx,%edi
+  80174f:	89 de                	mov    %ebx,%esi
+  801751:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_receive, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  801753:	5b                   	pop    %ebx
+  801754:	5e                   	pop    %esi
+  801755:	5f                   	pop    %edi
+  801756:	5d                   	pop    %ebp
+  801757:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801758:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801760:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801763:	b8 13 00 00 00       	mov    $0x13,%eax
+  801768:	89 df                	mov    %ebx,%edi
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	8d 35 75 17 80 00    	lea    0x801775,%esi
+  801773:	0f 34                	sysenter
+  801775:	5d                   	pop    %ebp
+		goto out;
+  801776:	eb db                	jmp    801753 <sys_e1000_receive+0x25>
+
+00801778 <sys_e1000_read_hwaddr>:
+
+int
+sys_e1000_read_hwaddr(char *buffer, size_t len)
+{
+  801778:	55                   	push   %ebp
+  801779:	89 e5                	mov    %esp,%ebp
+  80177b:	57                   	push   %edi
+  80177c:	56                   	push   %esi
+  80177d:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  80177e:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801785:	74 1b                	je     8017a2 <sys_e1000_read_hwaddr+0x2a>
+	asm volatile("int %1\n"
+  801787:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80178c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801791:	8b 55 08             	mov    0x8(%ebp),%edx
+  801794:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801797:	89 df                	mov    %ebx,%edi
+  801799:	89 de                	mov    %ebx,%esi
+  80179b:	cd 30                	int    $0x30
+    return syscall(SYS_e1000_read_hwaddr, 0, (uint32_t) buffer, len, 0, 0, 0);
+}
+  80179d:	5b                   	pop    %ebx
+  80179e:	5e                   	pop    %esi
+  80179f:	5f                   	pop    %edi
+  8017a0:	5d                   	pop    %ebp
+  8017a1:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017ad:	b8 14 00 00 00       	mov    $0x14,%eax
+  8017b2:	89 df                	mov    %ebx,%edi
+  8017b4:	55                   	push   %ebp
+  8017b5:	89 e5                	mov    %esp,%ebp
+  8017b7:	8d 35 bf 17 80 00    	lea    0x8017bf,%esi
+  8017bd:	0f 34                	sysenter
+  8017bf:	5d                   	pop    %ebp
+		goto out;
+  8017c0:	eb db                	jmp    80179d <sys_e1000_read_hwaddr+0x25>
+
+008017c2 <sys_sb16_read_version>:
+
+int
+sys_sb16_read_version(struct sb16_version_t *version)
+{
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	57                   	push   %edi
+  8017c6:	56                   	push   %esi
+  8017c7:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  8017c8:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  8017cf:	74 1a                	je     8017eb <sys_sb16_read_version+0x29>
+	asm volatile("int %1\n"
+  8017d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017d6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017de:	89 cb                	mov    %ecx,%ebx
+  8017e0:	89 cf                	mov    %ecx,%edi
+  8017e2:	89 ce                	mov    %ecx,%esi
+  8017e4:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_read_version, 0, (uint32_t) version, 0, 0, 0, 0);
+}
+  8017e6:	5b                   	pop    %ebx
+  8017e7:	5e                   	pop    %esi
+  8017e8:	5f                   	pop    %edi
+  8017e9:	5d                   	pop    %ebp
+  8017ea:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  8017eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017f3:	b8 15 00 00 00       	mov    $0x15,%eax
+  8017f8:	89 cb                	mov    %ecx,%ebx
+  8017fa:	89 cf                	mov    %ecx,%edi
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	8d 35 07 18 80 00    	lea    0x801807,%esi
+  801805:	0f 34                	sysenter
+  801807:	5d                   	pop    %ebp
+		goto out;
+  801808:	eb dc                	jmp    8017e6 <sys_sb16_read_version+0x24>
+
+0080180a <sys_sb16_play>:
+
+int
+sys_sb16_play(int16_t *audio_pcm, size_t len)
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	57                   	push   %edi
+  80180e:	56                   	push   %esi
+  80180f:	53                   	push   %ebx
+	if (a5 == 0 && !syscall_use_int) {
+  801810:	80 3d 0c 50 80 00 00 	cmpb   $0x0,0x80500c
+  801817:	74 1b                	je     801834 <sys_sb16_play+0x2a>
+	asm volatile("int %1\n"
+  801819:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801823:	8b 55 08             	mov    0x8(%ebp),%edx
+  801826:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801829:	89 df                	mov    %ebx,%edi
+  80182b:	89 de                	mov    %ebx,%esi
+  80182d:	cd 30                	int    $0x30
+    return syscall(SYS_sb16_play, 0, (uint32_t) audio_pcm, (uint32_t) len, 0, 0, 0);
+}
+  80182f:	5b                   	pop    %ebx
+  801830:	5e                   	pop    %esi
+  801831:	5f                   	pop    %edi
+  801832:	5d                   	pop    %ebp
+  801833:	c3                   	ret
+		asm volatile("pushl %%ebp\n\t"
+  801834:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801839:	8b 55 08             	mov    0x8(%ebp),%edx
+  80183c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80183f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801844:	89 df                	mov    %ebx,%edi
+  801846:	55                   	push   %ebp
+  801847:	89 e5                	mov    %esp,%ebp
+  801849:	8d 35 51 18 80 00    	lea    0x801851,%esi
+  80184f:	0f 34                	sysenter
+  801851:	5d                   	pop    %ebp
+		goto out;
+  801852:	eb db                	jmp    80182f <sys_sb16_play+0x25>
+
+00801854 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801854:	55                   	push   %ebp
+  801855:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801857:	8b 45 08             	mov    0x8(%ebp),%eax
+  80185a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80185f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801862:	5d                   	pop    %ebp
+  801863:	c3                   	ret
+
+00801864 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801864:	55                   	push   %ebp
+  801865:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801867:	8b 45 08             	mov    0x8(%ebp),%eax
+  80186a:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80186f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801874:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801879:	5d                   	pop    %ebp
+  80187a:	c3                   	ret
+
+0080187b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80187b:	55                   	push   %ebp
+  80187c:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80187e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801883:	eb 02                	jmp    801887 <fd_alloc+0xc>
+  801885:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801887:	89 c2                	mov    %eax,%edx
+  801889:	c1 ea 16             	shr    $0x16,%edx
+  80188c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801893:	f6 c2 01             	test   $0x1,%dl
+  801896:	74 2b                	je     8018c3 <fd_alloc+0x48>
+  801898:	89 c2                	mov    %eax,%edx
+  80189a:	c1 ea 0c             	shr    $0xc,%edx
+  80189d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018a4:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018aa:	f6 c1 01             	test   $0x1,%cl
+  8018ad:	74 14                	je     8018c3 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8018af:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018b5:	75 ce                	jne    801885 <fd_alloc+0xa>
+  8018b7:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8018bc:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018c1:	eb 05                	jmp    8018c8 <fd_alloc+0x4d>
+			return 0;
+  8018c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8018c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018cb:	89 02                	mov    %eax,(%edx)
+}
+  8018cd:	89 c8                	mov    %ecx,%eax
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+
+008018d1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018d1:	55                   	push   %ebp
+  8018d2:	89 e5                	mov    %esp,%ebp
+  8018d4:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018d7:	83 f8 1f             	cmp    $0x1f,%eax
+  8018da:	77 30                	ja     80190c <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8018dc:	c1 e0 0c             	shl    $0xc,%eax
+  8018df:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018e4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8018ea:	f6 c2 01             	test   $0x1,%dl
+  8018ed:	74 24                	je     801913 <fd_lookup+0x42>
+  8018ef:	89 c2                	mov    %eax,%edx
+  8018f1:	c1 ea 0c             	shr    $0xc,%edx
+  8018f4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018fb:	f6 c2 01             	test   $0x1,%dl
+  8018fe:	74 1a                	je     80191a <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801900:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801903:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801905:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80190a:	5d                   	pop    %ebp
+  80190b:	c3                   	ret
+		return -E_INVAL;
+  80190c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801911:	eb f7                	jmp    80190a <fd_lookup+0x39>
+		return -E_INVAL;
+  801913:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801918:	eb f0                	jmp    80190a <fd_lookup+0x39>
+  80191a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80191f:	eb e9                	jmp    80190a <fd_lookup+0x39>
+
+00801921 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+  801924:	53                   	push   %ebx
+  801925:	83 ec 04             	sub    $0x4,%esp
+  801928:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80192b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801930:	eb 03                	jmp    801935 <dev_lookup+0x14>
+  801932:	83 c0 01             	add    $0x1,%eax
+  801935:	8b 1c 85 b4 30 80 00 	mov    0x8030b4(,%eax,4),%ebx
+  80193c:	85 db                	test   %ebx,%ebx
+  80193e:	74 0b                	je     80194b <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801940:	39 13                	cmp    %edx,(%ebx)
+  801942:	75 ee                	jne    801932 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801944:	b8 00 00 00 00       	mov    $0x0,%eax
+  801949:	eb 2e                	jmp    801979 <dev_lookup+0x58>
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80194b:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80194d:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801952:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801958:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  80195d:	76 24                	jbe    801983 <dev_lookup+0x62>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80195f:	8b 41 48             	mov    0x48(%ecx),%eax
+  801962:	83 ec 04             	sub    $0x4,%esp
+  801965:	52                   	push   %edx
+  801966:	50                   	push   %eax
+  801967:	68 38 30 80 00       	push   $0x803038
+  80196c:	e8 2d e9 ff ff       	call   80029e <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801971:	83 c4 10             	add    $0x10,%esp
+  801974:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801979:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80197c:	89 1a                	mov    %ebx,(%edx)
+}
+  80197e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801981:	c9                   	leave
+  801982:	c3                   	ret
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801983:	c1 e8 10             	shr    $0x10,%eax
+  801986:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  80198c:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  801992:	eb cb                	jmp    80195f <dev_lookup+0x3e>
+
+00801994 <fd_close>:
+{
+  801994:	55                   	push   %ebp
+  801995:	89 e5                	mov    %esp,%ebp
+  801997:	57                   	push   %edi
+  801998:	56                   	push   %esi
+  801999:	53                   	push   %ebx
+  80199a:	83 ec 24             	sub    $0x24,%esp
+  80199d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019a0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019a6:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019a7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019ad:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019b0:	50                   	push   %eax
+  8019b1:	e8 1b ff ff ff       	call   8018d1 <fd_lookup>
+  8019b6:	89 c3                	mov    %eax,%ebx
+  8019b8:	83 c4 10             	add    $0x10,%esp
+  8019bb:	85 c0                	test   %eax,%eax
+  8019bd:	78 05                	js     8019c4 <fd_close+0x30>
+	    || fd != fd2)
+  8019bf:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019c2:	74 16                	je     8019da <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8019c4:	89 f8                	mov    %edi,%eax
+  8019c6:	84 c0                	test   %al,%al
+  8019c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cd:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019d0:	89 d8                	mov    %ebx,%eax
+  8019d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d5:	5b                   	pop    %ebx
+  8019d6:	5e                   	pop    %esi
+  8019d7:	5f                   	pop    %edi
+  8019d8:	5d                   	pop    %ebp
+  8019d9:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019da:	83 ec 08             	sub    $0x8,%esp
+  8019dd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019e0:	50                   	push   %eax
+  8019e1:	ff 36                	push   (%esi)
+  8019e3:	e8 39 ff ff ff       	call   801921 <dev_lookup>
+  8019e8:	89 c3                	mov    %eax,%ebx
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	85 c0                	test   %eax,%eax
+  8019ef:	78 1a                	js     801a0b <fd_close+0x77>
+		if (dev->dev_close)
+  8019f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019f4:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8019f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8019fc:	85 c0                	test   %eax,%eax
+  8019fe:	74 0b                	je     801a0b <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a00:	83 ec 0c             	sub    $0xc,%esp
+  801a03:	56                   	push   %esi
+  801a04:	ff d0                	call   *%eax
+  801a06:	89 c3                	mov    %eax,%ebx
+  801a08:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a0b:	83 ec 08             	sub    $0x8,%esp
+  801a0e:	56                   	push   %esi
+  801a0f:	6a 00                	push   $0x0
+  801a11:	e8 a3 f4 ff ff       	call   800eb9 <sys_page_unmap>
+	return r;
+  801a16:	83 c4 10             	add    $0x10,%esp
+  801a19:	eb b5                	jmp    8019d0 <fd_close+0x3c>
+
+00801a1b <close>:
+
+int
+close(int fdnum)
+{
+  801a1b:	55                   	push   %ebp
+  801a1c:	89 e5                	mov    %esp,%ebp
+  801a1e:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a24:	50                   	push   %eax
+  801a25:	ff 75 08             	push   0x8(%ebp)
+  801a28:	e8 a4 fe ff ff       	call   8018d1 <fd_lookup>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	79 02                	jns    801a36 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801a34:	c9                   	leave
+  801a35:	c3                   	ret
+		return fd_close(fd, 1);
+  801a36:	83 ec 08             	sub    $0x8,%esp
+  801a39:	6a 01                	push   $0x1
+  801a3b:	ff 75 f4             	push   -0xc(%ebp)
+  801a3e:	e8 51 ff ff ff       	call   801994 <fd_close>
+  801a43:	83 c4 10             	add    $0x10,%esp
+  801a46:	eb ec                	jmp    801a34 <close+0x19>
+
+00801a48 <close_all>:
+
+void
+close_all(void)
+{
+  801a48:	55                   	push   %ebp
+  801a49:	89 e5                	mov    %esp,%ebp
+  801a4b:	53                   	push   %ebx
+  801a4c:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801a4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801a54:	83 ec 0c             	sub    $0xc,%esp
+  801a57:	53                   	push   %ebx
+  801a58:	e8 be ff ff ff       	call   801a1b <close>
+	for (i = 0; i < MAXFD; i++)
+  801a5d:	83 c3 01             	add    $0x1,%ebx
+  801a60:	83 c4 10             	add    $0x10,%esp
+  801a63:	83 fb 20             	cmp    $0x20,%ebx
+  801a66:	75 ec                	jne    801a54 <close_all+0xc>
+}
+  801a68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a6b:	c9                   	leave
+  801a6c:	c3                   	ret
+
+00801a6d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a6d:	55                   	push   %ebp
+  801a6e:	89 e5                	mov    %esp,%ebp
+  801a70:	57                   	push   %edi
+  801a71:	56                   	push   %esi
+  801a72:	53                   	push   %ebx
+  801a73:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a76:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a79:	50                   	push   %eax
+  801a7a:	ff 75 08             	push   0x8(%ebp)
+  801a7d:	e8 4f fe ff ff       	call   8018d1 <fd_lookup>
+  801a82:	89 c3                	mov    %eax,%ebx
+  801a84:	83 c4 10             	add    $0x10,%esp
+  801a87:	85 c0                	test   %eax,%eax
+  801a89:	78 7f                	js     801b0a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801a8b:	83 ec 0c             	sub    $0xc,%esp
+  801a8e:	ff 75 0c             	push   0xc(%ebp)
+  801a91:	e8 85 ff ff ff       	call   801a1b <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801a96:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801a99:	c1 e6 0c             	shl    $0xc,%esi
+  801a9c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801aa2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801aa5:	89 3c 24             	mov    %edi,(%esp)
+  801aa8:	e8 b7 fd ff ff       	call   801864 <fd2data>
+  801aad:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801aaf:	89 34 24             	mov    %esi,(%esp)
+  801ab2:	e8 ad fd ff ff       	call   801864 <fd2data>
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801abd:	89 d8                	mov    %ebx,%eax
+  801abf:	c1 e8 16             	shr    $0x16,%eax
+  801ac2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ac9:	a8 01                	test   $0x1,%al
+  801acb:	74 11                	je     801ade <dup+0x71>
+  801acd:	89 d8                	mov    %ebx,%eax
+  801acf:	c1 e8 0c             	shr    $0xc,%eax
+  801ad2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801ad9:	f6 c2 01             	test   $0x1,%dl
+  801adc:	75 36                	jne    801b14 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ade:	89 f8                	mov    %edi,%eax
+  801ae0:	c1 e8 0c             	shr    $0xc,%eax
+  801ae3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aea:	83 ec 0c             	sub    $0xc,%esp
+  801aed:	25 07 0e 00 00       	and    $0xe07,%eax
+  801af2:	50                   	push   %eax
+  801af3:	56                   	push   %esi
+  801af4:	6a 00                	push   $0x0
+  801af6:	57                   	push   %edi
+  801af7:	6a 00                	push   $0x0
+  801af9:	e8 4d f3 ff ff       	call   800e4b <sys_page_map>
+  801afe:	89 c3                	mov    %eax,%ebx
+  801b00:	83 c4 20             	add    $0x20,%esp
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	78 33                	js     801b3a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b07:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b0a:	89 d8                	mov    %ebx,%eax
+  801b0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0f:	5b                   	pop    %ebx
+  801b10:	5e                   	pop    %esi
+  801b11:	5f                   	pop    %edi
+  801b12:	5d                   	pop    %ebp
+  801b13:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b14:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b1b:	83 ec 0c             	sub    $0xc,%esp
+  801b1e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b23:	50                   	push   %eax
+  801b24:	ff 75 d4             	push   -0x2c(%ebp)
+  801b27:	6a 00                	push   $0x0
+  801b29:	53                   	push   %ebx
+  801b2a:	6a 00                	push   $0x0
+  801b2c:	e8 1a f3 ff ff       	call   800e4b <sys_page_map>
+  801b31:	89 c3                	mov    %eax,%ebx
+  801b33:	83 c4 20             	add    $0x20,%esp
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	79 a4                	jns    801ade <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801b3a:	83 ec 08             	sub    $0x8,%esp
+  801b3d:	56                   	push   %esi
+  801b3e:	6a 00                	push   $0x0
+  801b40:	e8 74 f3 ff ff       	call   800eb9 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801b45:	83 c4 08             	add    $0x8,%esp
+  801b48:	ff 75 d4             	push   -0x2c(%ebp)
+  801b4b:	6a 00                	push   $0x0
+  801b4d:	e8 67 f3 ff ff       	call   800eb9 <sys_page_unmap>
+	return r;
+  801b52:	83 c4 10             	add    $0x10,%esp
+  801b55:	eb b3                	jmp    801b0a <dup+0x9d>
+
+00801b57 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	56                   	push   %esi
+  801b5b:	53                   	push   %ebx
+  801b5c:	83 ec 18             	sub    $0x18,%esp
+  801b5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b62:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b65:	50                   	push   %eax
+  801b66:	53                   	push   %ebx
+  801b67:	e8 65 fd ff ff       	call   8018d1 <fd_lookup>
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 3c                	js     801baf <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b73:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b76:	83 ec 08             	sub    $0x8,%esp
+  801b79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b7c:	50                   	push   %eax
+  801b7d:	ff 36                	push   (%esi)
+  801b7f:	e8 9d fd ff ff       	call   801921 <dev_lookup>
+  801b84:	83 c4 10             	add    $0x10,%esp
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	78 24                	js     801baf <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b8b:	8b 46 08             	mov    0x8(%esi),%eax
+  801b8e:	83 e0 03             	and    $0x3,%eax
+  801b91:	83 f8 01             	cmp    $0x1,%eax
+  801b94:	74 20                	je     801bb6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801b96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b99:	8b 40 08             	mov    0x8(%eax),%eax
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	74 57                	je     801bf7 <read+0xa0>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801ba0:	83 ec 04             	sub    $0x4,%esp
+  801ba3:	ff 75 10             	push   0x10(%ebp)
+  801ba6:	ff 75 0c             	push   0xc(%ebp)
+  801ba9:	56                   	push   %esi
+  801baa:	ff d0                	call   *%eax
+  801bac:	83 c4 10             	add    $0x10,%esp
+}
+  801baf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb2:	5b                   	pop    %ebx
+  801bb3:	5e                   	pop    %esi
+  801bb4:	5d                   	pop    %ebp
+  801bb5:	c3                   	ret
+  801bb6:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bb8:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801bbd:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801bc3:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801bc8:	76 1c                	jbe    801be6 <read+0x8f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bca:	8b 42 48             	mov    0x48(%edx),%eax
+  801bcd:	83 ec 04             	sub    $0x4,%esp
+  801bd0:	53                   	push   %ebx
+  801bd1:	50                   	push   %eax
+  801bd2:	68 79 30 80 00       	push   $0x803079
+  801bd7:	e8 c2 e6 ff ff       	call   80029e <cprintf>
+		return -E_INVAL;
+  801bdc:	83 c4 10             	add    $0x10,%esp
+  801bdf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801be4:	eb c9                	jmp    801baf <read+0x58>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801be6:	c1 e8 10             	shr    $0x10,%eax
+  801be9:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801bef:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801bf5:	eb d3                	jmp    801bca <read+0x73>
+		return -E_NOT_SUPP;
+  801bf7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bfc:	eb b1                	jmp    801baf <read+0x58>
+
+00801bfe <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801bfe:	55                   	push   %ebp
+  801bff:	89 e5                	mov    %esp,%ebp
+  801c01:	57                   	push   %edi
+  801c02:	56                   	push   %esi
+  801c03:	53                   	push   %ebx
+  801c04:	83 ec 0c             	sub    $0xc,%esp
+  801c07:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c0a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c12:	eb 02                	jmp    801c16 <readn+0x18>
+  801c14:	01 c3                	add    %eax,%ebx
+  801c16:	39 f3                	cmp    %esi,%ebx
+  801c18:	73 21                	jae    801c3b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c1a:	83 ec 04             	sub    $0x4,%esp
+  801c1d:	89 f0                	mov    %esi,%eax
+  801c1f:	29 d8                	sub    %ebx,%eax
+  801c21:	50                   	push   %eax
+  801c22:	89 d8                	mov    %ebx,%eax
+  801c24:	03 45 0c             	add    0xc(%ebp),%eax
+  801c27:	50                   	push   %eax
+  801c28:	57                   	push   %edi
+  801c29:	e8 29 ff ff ff       	call   801b57 <read>
+		if (m < 0)
+  801c2e:	83 c4 10             	add    $0x10,%esp
+  801c31:	85 c0                	test   %eax,%eax
+  801c33:	78 04                	js     801c39 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c35:	75 dd                	jne    801c14 <readn+0x16>
+  801c37:	eb 02                	jmp    801c3b <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c39:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c3b:	89 d8                	mov    %ebx,%eax
+  801c3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c40:	5b                   	pop    %ebx
+  801c41:	5e                   	pop    %esi
+  801c42:	5f                   	pop    %edi
+  801c43:	5d                   	pop    %ebp
+  801c44:	c3                   	ret
+
+00801c45 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c45:	55                   	push   %ebp
+  801c46:	89 e5                	mov    %esp,%ebp
+  801c48:	56                   	push   %esi
+  801c49:	53                   	push   %ebx
+  801c4a:	83 ec 18             	sub    $0x18,%esp
+  801c4d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c50:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c53:	50                   	push   %eax
+  801c54:	53                   	push   %ebx
+  801c55:	e8 77 fc ff ff       	call   8018d1 <fd_lookup>
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	78 37                	js     801c98 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c61:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c64:	83 ec 08             	sub    $0x8,%esp
+  801c67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c6a:	50                   	push   %eax
+  801c6b:	ff 36                	push   (%esi)
+  801c6d:	e8 af fc ff ff       	call   801921 <dev_lookup>
+  801c72:	83 c4 10             	add    $0x10,%esp
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	78 1f                	js     801c98 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c79:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c7d:	74 20                	je     801c9f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801c7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c82:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	74 57                	je     801ce0 <write+0x9b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801c89:	83 ec 04             	sub    $0x4,%esp
+  801c8c:	ff 75 10             	push   0x10(%ebp)
+  801c8f:	ff 75 0c             	push   0xc(%ebp)
+  801c92:	56                   	push   %esi
+  801c93:	ff d0                	call   *%eax
+  801c95:	83 c4 10             	add    $0x10,%esp
+}
+  801c98:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c9b:	5b                   	pop    %ebx
+  801c9c:	5e                   	pop    %esi
+  801c9d:	5d                   	pop    %ebp
+  801c9e:	c3                   	ret
+  801c9f:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801ca1:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801ca6:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801cac:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801cb1:	76 1c                	jbe    801ccf <write+0x8a>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cb3:	8b 42 48             	mov    0x48(%edx),%eax
+  801cb6:	83 ec 04             	sub    $0x4,%esp
+  801cb9:	53                   	push   %ebx
+  801cba:	50                   	push   %eax
+  801cbb:	68 95 30 80 00       	push   $0x803095
+  801cc0:	e8 d9 e5 ff ff       	call   80029e <cprintf>
+		return -E_INVAL;
+  801cc5:	83 c4 10             	add    $0x10,%esp
+  801cc8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ccd:	eb c9                	jmp    801c98 <write+0x53>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801ccf:	c1 e8 10             	shr    $0x10,%eax
+  801cd2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801cd8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801cde:	eb d3                	jmp    801cb3 <write+0x6e>
+		return -E_NOT_SUPP;
+  801ce0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce5:	eb b1                	jmp    801c98 <write+0x53>
+
+00801ce7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ce7:	55                   	push   %ebp
+  801ce8:	89 e5                	mov    %esp,%ebp
+  801cea:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ced:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cf0:	50                   	push   %eax
+  801cf1:	ff 75 08             	push   0x8(%ebp)
+  801cf4:	e8 d8 fb ff ff       	call   8018d1 <fd_lookup>
+  801cf9:	83 c4 10             	add    $0x10,%esp
+  801cfc:	85 c0                	test   %eax,%eax
+  801cfe:	78 0e                	js     801d0e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d06:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+
+00801d10 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d10:	55                   	push   %ebp
+  801d11:	89 e5                	mov    %esp,%ebp
+  801d13:	56                   	push   %esi
+  801d14:	53                   	push   %ebx
+  801d15:	83 ec 18             	sub    $0x18,%esp
+  801d18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d1b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d1e:	50                   	push   %eax
+  801d1f:	53                   	push   %ebx
+  801d20:	e8 ac fb ff ff       	call   8018d1 <fd_lookup>
+  801d25:	83 c4 10             	add    $0x10,%esp
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	78 34                	js     801d60 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d2c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d2f:	83 ec 08             	sub    $0x8,%esp
+  801d32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d35:	50                   	push   %eax
+  801d36:	ff 36                	push   (%esi)
+  801d38:	e8 e4 fb ff ff       	call   801921 <dev_lookup>
+  801d3d:	83 c4 10             	add    $0x10,%esp
+  801d40:	85 c0                	test   %eax,%eax
+  801d42:	78 1c                	js     801d60 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d44:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d48:	74 1d                	je     801d67 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d4d:	8b 40 18             	mov    0x18(%eax),%eax
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	74 54                	je     801da8 <ftruncate+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d54:	83 ec 08             	sub    $0x8,%esp
+  801d57:	ff 75 0c             	push   0xc(%ebp)
+  801d5a:	56                   	push   %esi
+  801d5b:	ff d0                	call   *%eax
+  801d5d:	83 c4 10             	add    $0x10,%esp
+}
+  801d60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d63:	5b                   	pop    %ebx
+  801d64:	5e                   	pop    %esi
+  801d65:	5d                   	pop    %ebp
+  801d66:	c3                   	ret
+  801d67:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d69:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  801d6e:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  801d74:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  801d79:	76 1c                	jbe    801d97 <ftruncate+0x87>
+			thisenv->env_id, fdnum);
+  801d7b:	8b 42 48             	mov    0x48(%edx),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d7e:	83 ec 04             	sub    $0x4,%esp
+  801d81:	53                   	push   %ebx
+  801d82:	50                   	push   %eax
+  801d83:	68 58 30 80 00       	push   $0x803058
+  801d88:	e8 11 e5 ff ff       	call   80029e <cprintf>
+		return -E_INVAL;
+  801d8d:	83 c4 10             	add    $0x10,%esp
+  801d90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d95:	eb c9                	jmp    801d60 <ftruncate+0x50>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  801d97:	c1 e8 10             	shr    $0x10,%eax
+  801d9a:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  801da0:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  801da6:	eb d3                	jmp    801d7b <ftruncate+0x6b>
+		return -E_NOT_SUPP;
+  801da8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dad:	eb b1                	jmp    801d60 <ftruncate+0x50>
+
+00801daf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	56                   	push   %esi
+  801db3:	53                   	push   %ebx
+  801db4:	83 ec 18             	sub    $0x18,%esp
+  801db7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dbd:	50                   	push   %eax
+  801dbe:	ff 75 08             	push   0x8(%ebp)
+  801dc1:	e8 0b fb ff ff       	call   8018d1 <fd_lookup>
+  801dc6:	83 c4 10             	add    $0x10,%esp
+  801dc9:	85 c0                	test   %eax,%eax
+  801dcb:	78 49                	js     801e16 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dcd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dd0:	83 ec 08             	sub    $0x8,%esp
+  801dd3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dd6:	50                   	push   %eax
+  801dd7:	ff 36                	push   (%esi)
+  801dd9:	e8 43 fb ff ff       	call   801921 <dev_lookup>
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 31                	js     801e16 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801de5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dec:	74 2f                	je     801e1d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801dee:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801df1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801df8:	00 00 00 
+	stat->st_isdir = 0;
+  801dfb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e02:	00 00 00 
+	stat->st_dev = dev;
+  801e05:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e0b:	83 ec 08             	sub    $0x8,%esp
+  801e0e:	53                   	push   %ebx
+  801e0f:	56                   	push   %esi
+  801e10:	ff 50 14             	call   *0x14(%eax)
+  801e13:	83 c4 10             	add    $0x10,%esp
+}
+  801e16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e19:	5b                   	pop    %ebx
+  801e1a:	5e                   	pop    %esi
+  801e1b:	5d                   	pop    %ebp
+  801e1c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e1d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e22:	eb f2                	jmp    801e16 <fstat+0x67>
+
+00801e24 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e24:	55                   	push   %ebp
+  801e25:	89 e5                	mov    %esp,%ebp
+  801e27:	56                   	push   %esi
+  801e28:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e29:	83 ec 08             	sub    $0x8,%esp
+  801e2c:	6a 00                	push   $0x0
+  801e2e:	ff 75 08             	push   0x8(%ebp)
+  801e31:	e8 e4 01 00 00       	call   80201a <open>
+  801e36:	89 c3                	mov    %eax,%ebx
+  801e38:	83 c4 10             	add    $0x10,%esp
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 1b                	js     801e5a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e3f:	83 ec 08             	sub    $0x8,%esp
+  801e42:	ff 75 0c             	push   0xc(%ebp)
+  801e45:	50                   	push   %eax
+  801e46:	e8 64 ff ff ff       	call   801daf <fstat>
+  801e4b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e4d:	89 1c 24             	mov    %ebx,(%esp)
+  801e50:	e8 c6 fb ff ff       	call   801a1b <close>
+	return r;
+  801e55:	83 c4 10             	add    $0x10,%esp
+  801e58:	89 f3                	mov    %esi,%ebx
+}
+  801e5a:	89 d8                	mov    %ebx,%eax
+  801e5c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e5f:	5b                   	pop    %ebx
+  801e60:	5e                   	pop    %esi
+  801e61:	5d                   	pop    %ebp
+  801e62:	c3                   	ret
+
+00801e63 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e63:	55                   	push   %ebp
+  801e64:	89 e5                	mov    %esp,%ebp
+  801e66:	56                   	push   %esi
+  801e67:	53                   	push   %ebx
+  801e68:	89 c6                	mov    %eax,%esi
+  801e6a:	89 d3                	mov    %edx,%ebx
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e6c:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  801e73:	74 27                	je     801e9c <fsipc+0x39>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e75:	6a 07                	push   $0x7
+  801e77:	68 00 60 80 00       	push   $0x806000
+  801e7c:	56                   	push   %esi
+  801e7d:	ff 35 00 50 80 00    	push   0x805000
+  801e83:	e8 b2 0c 00 00       	call   802b3a <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801e88:	83 c4 0c             	add    $0xc,%esp
+  801e8b:	6a 00                	push   $0x0
+  801e8d:	53                   	push   %ebx
+  801e8e:	6a 00                	push   $0x0
+  801e90:	e8 8d 0c 00 00       	call   802b22 <ipc_recv>
+}
+  801e95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e98:	5b                   	pop    %ebx
+  801e99:	5e                   	pop    %esi
+  801e9a:	5d                   	pop    %ebp
+  801e9b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e9c:	83 ec 0c             	sub    $0xc,%esp
+  801e9f:	6a 01                	push   $0x1
+  801ea1:	e8 e8 0c 00 00       	call   802b8e <ipc_find_env>
+  801ea6:	a3 00 50 80 00       	mov    %eax,0x805000
+  801eab:	83 c4 10             	add    $0x10,%esp
+  801eae:	eb c5                	jmp    801e75 <fsipc+0x12>
+
+00801eb0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801eb0:	55                   	push   %ebp
+  801eb1:	89 e5                	mov    %esp,%ebp
+  801eb3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801eb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ebc:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801ec1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ec4:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801ec9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ece:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ed3:	e8 8b ff ff ff       	call   801e63 <fsipc>
+}
+  801ed8:	c9                   	leave
+  801ed9:	c3                   	ret
+
+00801eda <devfile_flush>:
+{
+  801eda:	55                   	push   %ebp
+  801edb:	89 e5                	mov    %esp,%ebp
+  801edd:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ee0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801eeb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef0:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ef5:	e8 69 ff ff ff       	call   801e63 <fsipc>
+}
+  801efa:	c9                   	leave
+  801efb:	c3                   	ret
+
+00801efc <devfile_stat>:
+{
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	53                   	push   %ebx
+  801f00:	83 ec 04             	sub    $0x4,%esp
+  801f03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f09:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f0c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f16:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f1b:	e8 43 ff ff ff       	call   801e63 <fsipc>
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	78 2c                	js     801f50 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f24:	83 ec 08             	sub    $0x8,%esp
+  801f27:	68 00 60 80 00       	push   $0x806000
+  801f2c:	53                   	push   %ebx
+  801f2d:	e8 b4 e9 ff ff       	call   8008e6 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f32:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f37:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f3d:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f42:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f48:	83 c4 10             	add    $0x10,%esp
+  801f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f53:	c9                   	leave
+  801f54:	c3                   	ret
+
+00801f55 <devfile_write>:
+{
+  801f55:	55                   	push   %ebp
+  801f56:	89 e5                	mov    %esp,%ebp
+  801f58:	83 ec 0c             	sub    $0xc,%esp
+  801f5b:	8b 45 10             	mov    0x10(%ebp),%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f61:	8b 52 0c             	mov    0xc(%edx),%edx
+  801f64:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  801f6a:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  801f6f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f74:	39 d0                	cmp    %edx,%eax
+  801f76:	0f 47 c2             	cmova  %edx,%eax
+  801f79:	50                   	push   %eax
+  801f7a:	ff 75 0c             	push   0xc(%ebp)
+  801f7d:	68 08 60 80 00       	push   $0x806008
+  801f82:	e8 e5 ea ff ff       	call   800a6c <memmove>
+	if ((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801f87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f91:	e8 cd fe ff ff       	call   801e63 <fsipc>
+}
+  801f96:	c9                   	leave
+  801f97:	c3                   	ret
+
+00801f98 <devfile_read>:
+{
+  801f98:	55                   	push   %ebp
+  801f99:	89 e5                	mov    %esp,%ebp
+  801f9b:	56                   	push   %esi
+  801f9c:	53                   	push   %ebx
+  801f9d:	8b 75 10             	mov    0x10(%ebp),%esi
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fa0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801fab:	89 35 04 60 80 00    	mov    %esi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb6:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fbb:	e8 a3 fe ff ff       	call   801e63 <fsipc>
+  801fc0:	89 c3                	mov    %eax,%ebx
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	78 1f                	js     801fe5 <devfile_read+0x4d>
+	assert(r <= n);
+  801fc6:	39 c6                	cmp    %eax,%esi
+  801fc8:	72 24                	jb     801fee <devfile_read+0x56>
+	assert(r <= PGSIZE);
+  801fca:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801fcf:	7f 33                	jg     802004 <devfile_read+0x6c>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801fd1:	83 ec 04             	sub    $0x4,%esp
+  801fd4:	50                   	push   %eax
+  801fd5:	68 00 60 80 00       	push   $0x806000
+  801fda:	ff 75 0c             	push   0xc(%ebp)
+  801fdd:	e8 8a ea ff ff       	call   800a6c <memmove>
+	return r;
+  801fe2:	83 c4 10             	add    $0x10,%esp
+}
+  801fe5:	89 d8                	mov    %ebx,%eax
+  801fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fea:	5b                   	pop    %ebx
+  801feb:	5e                   	pop    %esi
+  801fec:	5d                   	pop    %ebp
+  801fed:	c3                   	ret
+	assert(r <= n);
+  801fee:	68 c8 30 80 00       	push   $0x8030c8
+  801ff3:	68 cf 30 80 00       	push   $0x8030cf
+  801ff8:	6a 76                	push   $0x76
+  801ffa:	68 e4 30 80 00       	push   $0x8030e4
+  801fff:	e8 bf e1 ff ff       	call   8001c3 <_panic>
+	assert(r <= PGSIZE);
+  802004:	68 ef 30 80 00       	push   $0x8030ef
+  802009:	68 cf 30 80 00       	push   $0x8030cf
+  80200e:	6a 77                	push   $0x77
+  802010:	68 e4 30 80 00       	push   $0x8030e4
+  802015:	e8 a9 e1 ff ff       	call   8001c3 <_panic>
+
+0080201a <open>:
+{
+  80201a:	55                   	push   %ebp
+  80201b:	89 e5                	mov    %esp,%ebp
+  80201d:	56                   	push   %esi
+  80201e:	53                   	push   %ebx
+  80201f:	83 ec 1c             	sub    $0x1c,%esp
+  802022:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802025:	56                   	push   %esi
+  802026:	e8 80 e8 ff ff       	call   8008ab <strlen>
+  80202b:	83 c4 10             	add    $0x10,%esp
+  80202e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802033:	7f 6c                	jg     8020a1 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802035:	83 ec 0c             	sub    $0xc,%esp
+  802038:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80203b:	50                   	push   %eax
+  80203c:	e8 3a f8 ff ff       	call   80187b <fd_alloc>
+  802041:	89 c3                	mov    %eax,%ebx
+  802043:	83 c4 10             	add    $0x10,%esp
+  802046:	85 c0                	test   %eax,%eax
+  802048:	78 3c                	js     802086 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80204a:	83 ec 08             	sub    $0x8,%esp
+  80204d:	56                   	push   %esi
+  80204e:	68 00 60 80 00       	push   $0x806000
+  802053:	e8 8e e8 ff ff       	call   8008e6 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802058:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80205b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802060:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802063:	b8 01 00 00 00       	mov    $0x1,%eax
+  802068:	e8 f6 fd ff ff       	call   801e63 <fsipc>
+  80206d:	89 c3                	mov    %eax,%ebx
+  80206f:	83 c4 10             	add    $0x10,%esp
+  802072:	85 c0                	test   %eax,%eax
+  802074:	78 19                	js     80208f <open+0x75>
+	return fd2num(fd);
+  802076:	83 ec 0c             	sub    $0xc,%esp
+  802079:	ff 75 f4             	push   -0xc(%ebp)
+  80207c:	e8 d3 f7 ff ff       	call   801854 <fd2num>
+  802081:	89 c3                	mov    %eax,%ebx
+  802083:	83 c4 10             	add    $0x10,%esp
+}
+  802086:	89 d8                	mov    %ebx,%eax
+  802088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80208b:	5b                   	pop    %ebx
+  80208c:	5e                   	pop    %esi
+  80208d:	5d                   	pop    %ebp
+  80208e:	c3                   	ret
+		fd_close(fd, 0);
+  80208f:	83 ec 08             	sub    $0x8,%esp
+  802092:	6a 00                	push   $0x0
+  802094:	ff 75 f4             	push   -0xc(%ebp)
+  802097:	e8 f8 f8 ff ff       	call   801994 <fd_close>
+		return r;
+  80209c:	83 c4 10             	add    $0x10,%esp
+  80209f:	eb e5                	jmp    802086 <open+0x6c>
+		return -E_BAD_PATH;
+  8020a1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020a6:	eb de                	jmp    802086 <open+0x6c>
+
+008020a8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020a8:	55                   	push   %ebp
+  8020a9:	89 e5                	mov    %esp,%ebp
+  8020ab:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8020ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8020b8:	e8 a6 fd ff ff       	call   801e63 <fsipc>
+}
+  8020bd:	c9                   	leave
+  8020be:	c3                   	ret
+
+008020bf <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020bf:	55                   	push   %ebp
+  8020c0:	89 e5                	mov    %esp,%ebp
+  8020c2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8020c5:	68 fb 30 80 00       	push   $0x8030fb
+  8020ca:	ff 75 0c             	push   0xc(%ebp)
+  8020cd:	e8 14 e8 ff ff       	call   8008e6 <strcpy>
+	return 0;
+}
+  8020d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d7:	c9                   	leave
+  8020d8:	c3                   	ret
+
+008020d9 <devsock_close>:
+{
+  8020d9:	55                   	push   %ebp
+  8020da:	89 e5                	mov    %esp,%ebp
+  8020dc:	53                   	push   %ebx
+  8020dd:	83 ec 10             	sub    $0x10,%esp
+  8020e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8020e3:	53                   	push   %ebx
+  8020e4:	e8 e4 0a 00 00       	call   802bcd <pageref>
+  8020e9:	89 c2                	mov    %eax,%edx
+  8020eb:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8020ee:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8020f3:	83 fa 01             	cmp    $0x1,%edx
+  8020f6:	74 05                	je     8020fd <devsock_close+0x24>
+}
+  8020f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fb:	c9                   	leave
+  8020fc:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8020fd:	83 ec 0c             	sub    $0xc,%esp
+  802100:	ff 73 0c             	push   0xc(%ebx)
+  802103:	e8 b7 02 00 00       	call   8023bf <nsipc_close>
+  802108:	83 c4 10             	add    $0x10,%esp
+  80210b:	eb eb                	jmp    8020f8 <devsock_close+0x1f>
+
+0080210d <devsock_write>:
+{
+  80210d:	55                   	push   %ebp
+  80210e:	89 e5                	mov    %esp,%ebp
+  802110:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802113:	6a 00                	push   $0x0
+  802115:	ff 75 10             	push   0x10(%ebp)
+  802118:	ff 75 0c             	push   0xc(%ebp)
+  80211b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80211e:	ff 70 0c             	push   0xc(%eax)
+  802121:	e8 79 03 00 00       	call   80249f <nsipc_send>
+}
+  802126:	c9                   	leave
+  802127:	c3                   	ret
+
+00802128 <devsock_read>:
+{
+  802128:	55                   	push   %ebp
+  802129:	89 e5                	mov    %esp,%ebp
+  80212b:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80212e:	6a 00                	push   $0x0
+  802130:	ff 75 10             	push   0x10(%ebp)
+  802133:	ff 75 0c             	push   0xc(%ebp)
+  802136:	8b 45 08             	mov    0x8(%ebp),%eax
+  802139:	ff 70 0c             	push   0xc(%eax)
+  80213c:	e8 ef 02 00 00       	call   802430 <nsipc_recv>
+}
+  802141:	c9                   	leave
+  802142:	c3                   	ret
+
+00802143 <fd2sockid>:
+{
+  802143:	55                   	push   %ebp
+  802144:	89 e5                	mov    %esp,%ebp
+  802146:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802149:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80214c:	52                   	push   %edx
+  80214d:	50                   	push   %eax
+  80214e:	e8 7e f7 ff ff       	call   8018d1 <fd_lookup>
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	85 c0                	test   %eax,%eax
+  802158:	78 10                	js     80216a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80215a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80215d:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802163:	39 08                	cmp    %ecx,(%eax)
+  802165:	75 05                	jne    80216c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802167:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80216a:	c9                   	leave
+  80216b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80216c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802171:	eb f7                	jmp    80216a <fd2sockid+0x27>
+
+00802173 <alloc_sockfd>:
+{
+  802173:	55                   	push   %ebp
+  802174:	89 e5                	mov    %esp,%ebp
+  802176:	56                   	push   %esi
+  802177:	53                   	push   %ebx
+  802178:	83 ec 1c             	sub    $0x1c,%esp
+  80217b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80217d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802180:	50                   	push   %eax
+  802181:	e8 f5 f6 ff ff       	call   80187b <fd_alloc>
+  802186:	89 c3                	mov    %eax,%ebx
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	78 43                	js     8021d2 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80218f:	83 ec 04             	sub    $0x4,%esp
+  802192:	68 07 04 00 00       	push   $0x407
+  802197:	ff 75 f4             	push   -0xc(%ebp)
+  80219a:	6a 00                	push   $0x0
+  80219c:	e8 3d ec ff ff       	call   800dde <sys_page_alloc>
+  8021a1:	89 c3                	mov    %eax,%ebx
+  8021a3:	83 c4 10             	add    $0x10,%esp
+  8021a6:	85 c0                	test   %eax,%eax
+  8021a8:	78 28                	js     8021d2 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8021aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ad:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8021b3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8021b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8021bf:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8021c2:	83 ec 0c             	sub    $0xc,%esp
+  8021c5:	50                   	push   %eax
+  8021c6:	e8 89 f6 ff ff       	call   801854 <fd2num>
+  8021cb:	89 c3                	mov    %eax,%ebx
+  8021cd:	83 c4 10             	add    $0x10,%esp
+  8021d0:	eb 0c                	jmp    8021de <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8021d2:	83 ec 0c             	sub    $0xc,%esp
+  8021d5:	56                   	push   %esi
+  8021d6:	e8 e4 01 00 00       	call   8023bf <nsipc_close>
+		return r;
+  8021db:	83 c4 10             	add    $0x10,%esp
+}
+  8021de:	89 d8                	mov    %ebx,%eax
+  8021e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e3:	5b                   	pop    %ebx
+  8021e4:	5e                   	pop    %esi
+  8021e5:	5d                   	pop    %ebp
+  8021e6:	c3                   	ret
+
+008021e7 <accept>:
+{
+  8021e7:	55                   	push   %ebp
+  8021e8:	89 e5                	mov    %esp,%ebp
+  8021ea:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f0:	e8 4e ff ff ff       	call   802143 <fd2sockid>
+  8021f5:	85 c0                	test   %eax,%eax
+  8021f7:	78 1b                	js     802214 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8021f9:	83 ec 04             	sub    $0x4,%esp
+  8021fc:	ff 75 10             	push   0x10(%ebp)
+  8021ff:	ff 75 0c             	push   0xc(%ebp)
+  802202:	50                   	push   %eax
+  802203:	e8 0e 01 00 00       	call   802316 <nsipc_accept>
+  802208:	83 c4 10             	add    $0x10,%esp
+  80220b:	85 c0                	test   %eax,%eax
+  80220d:	78 05                	js     802214 <accept+0x2d>
+	return alloc_sockfd(r);
+  80220f:	e8 5f ff ff ff       	call   802173 <alloc_sockfd>
+}
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+
+00802216 <bind>:
+{
+  802216:	55                   	push   %ebp
+  802217:	89 e5                	mov    %esp,%ebp
+  802219:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80221c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221f:	e8 1f ff ff ff       	call   802143 <fd2sockid>
+  802224:	85 c0                	test   %eax,%eax
+  802226:	78 12                	js     80223a <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802228:	83 ec 04             	sub    $0x4,%esp
+  80222b:	ff 75 10             	push   0x10(%ebp)
+  80222e:	ff 75 0c             	push   0xc(%ebp)
+  802231:	50                   	push   %eax
+  802232:	e8 31 01 00 00       	call   802368 <nsipc_bind>
+  802237:	83 c4 10             	add    $0x10,%esp
+}
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+
+0080223c <shutdown>:
+{
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802242:	8b 45 08             	mov    0x8(%ebp),%eax
+  802245:	e8 f9 fe ff ff       	call   802143 <fd2sockid>
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	78 0f                	js     80225d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80224e:	83 ec 08             	sub    $0x8,%esp
+  802251:	ff 75 0c             	push   0xc(%ebp)
+  802254:	50                   	push   %eax
+  802255:	e8 43 01 00 00       	call   80239d <nsipc_shutdown>
+  80225a:	83 c4 10             	add    $0x10,%esp
+}
+  80225d:	c9                   	leave
+  80225e:	c3                   	ret
+
+0080225f <connect>:
+{
+  80225f:	55                   	push   %ebp
+  802260:	89 e5                	mov    %esp,%ebp
+  802262:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802265:	8b 45 08             	mov    0x8(%ebp),%eax
+  802268:	e8 d6 fe ff ff       	call   802143 <fd2sockid>
+  80226d:	85 c0                	test   %eax,%eax
+  80226f:	78 12                	js     802283 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802271:	83 ec 04             	sub    $0x4,%esp
+  802274:	ff 75 10             	push   0x10(%ebp)
+  802277:	ff 75 0c             	push   0xc(%ebp)
+  80227a:	50                   	push   %eax
+  80227b:	e8 59 01 00 00       	call   8023d9 <nsipc_connect>
+  802280:	83 c4 10             	add    $0x10,%esp
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+00802285 <listen>:
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80228b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228e:	e8 b0 fe ff ff       	call   802143 <fd2sockid>
+  802293:	85 c0                	test   %eax,%eax
+  802295:	78 0f                	js     8022a6 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802297:	83 ec 08             	sub    $0x8,%esp
+  80229a:	ff 75 0c             	push   0xc(%ebp)
+  80229d:	50                   	push   %eax
+  80229e:	e8 6b 01 00 00       	call   80240e <nsipc_listen>
+  8022a3:	83 c4 10             	add    $0x10,%esp
+}
+  8022a6:	c9                   	leave
+  8022a7:	c3                   	ret
+
+008022a8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8022a8:	55                   	push   %ebp
+  8022a9:	89 e5                	mov    %esp,%ebp
+  8022ab:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8022ae:	ff 75 10             	push   0x10(%ebp)
+  8022b1:	ff 75 0c             	push   0xc(%ebp)
+  8022b4:	ff 75 08             	push   0x8(%ebp)
+  8022b7:	e8 41 02 00 00       	call   8024fd <nsipc_socket>
+  8022bc:	83 c4 10             	add    $0x10,%esp
+  8022bf:	85 c0                	test   %eax,%eax
+  8022c1:	78 05                	js     8022c8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8022c3:	e8 ab fe ff ff       	call   802173 <alloc_sockfd>
+}
+  8022c8:	c9                   	leave
+  8022c9:	c3                   	ret
+
+008022ca <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	53                   	push   %ebx
+  8022ce:	83 ec 04             	sub    $0x4,%esp
+  8022d1:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8022d3:	83 3d 04 50 80 00 00 	cmpl   $0x0,0x805004
+  8022da:	74 26                	je     802302 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8022dc:	6a 07                	push   $0x7
+  8022de:	68 00 70 80 00       	push   $0x807000
+  8022e3:	53                   	push   %ebx
+  8022e4:	ff 35 04 50 80 00    	push   0x805004
+  8022ea:	e8 4b 08 00 00       	call   802b3a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8022ef:	83 c4 0c             	add    $0xc,%esp
+  8022f2:	6a 00                	push   $0x0
+  8022f4:	6a 00                	push   $0x0
+  8022f6:	6a 00                	push   $0x0
+  8022f8:	e8 25 08 00 00       	call   802b22 <ipc_recv>
+}
+  8022fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802300:	c9                   	leave
+  802301:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802302:	83 ec 0c             	sub    $0xc,%esp
+  802305:	6a 02                	push   $0x2
+  802307:	e8 82 08 00 00       	call   802b8e <ipc_find_env>
+  80230c:	a3 04 50 80 00       	mov    %eax,0x805004
+  802311:	83 c4 10             	add    $0x10,%esp
+  802314:	eb c6                	jmp    8022dc <nsipc+0x12>
+
+00802316 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802316:	55                   	push   %ebp
+  802317:	89 e5                	mov    %esp,%ebp
+  802319:	56                   	push   %esi
+  80231a:	53                   	push   %ebx
+  80231b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80231e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802321:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802326:	8b 06                	mov    (%esi),%eax
+  802328:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80232d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802332:	e8 93 ff ff ff       	call   8022ca <nsipc>
+  802337:	89 c3                	mov    %eax,%ebx
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	79 09                	jns    802346 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80233d:	89 d8                	mov    %ebx,%eax
+  80233f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802342:	5b                   	pop    %ebx
+  802343:	5e                   	pop    %esi
+  802344:	5d                   	pop    %ebp
+  802345:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802346:	83 ec 04             	sub    $0x4,%esp
+  802349:	ff 35 10 70 80 00    	push   0x807010
+  80234f:	68 00 70 80 00       	push   $0x807000
+  802354:	ff 75 0c             	push   0xc(%ebp)
+  802357:	e8 10 e7 ff ff       	call   800a6c <memmove>
+		*addrlen = ret->ret_addrlen;
+  80235c:	a1 10 70 80 00       	mov    0x807010,%eax
+  802361:	89 06                	mov    %eax,(%esi)
+  802363:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802366:	eb d5                	jmp    80233d <nsipc_accept+0x27>
+
+00802368 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802368:	55                   	push   %ebp
+  802369:	89 e5                	mov    %esp,%ebp
+  80236b:	53                   	push   %ebx
+  80236c:	83 ec 08             	sub    $0x8,%esp
+  80236f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802372:	8b 45 08             	mov    0x8(%ebp),%eax
+  802375:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80237a:	53                   	push   %ebx
+  80237b:	ff 75 0c             	push   0xc(%ebp)
+  80237e:	68 04 70 80 00       	push   $0x807004
+  802383:	e8 e4 e6 ff ff       	call   800a6c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802388:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  80238e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802393:	e8 32 ff ff ff       	call   8022ca <nsipc>
+}
+  802398:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80239b:	c9                   	leave
+  80239c:	c3                   	ret
+
+0080239d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80239d:	55                   	push   %ebp
+  80239e:	89 e5                	mov    %esp,%ebp
+  8023a0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8023a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a6:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  8023ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023ae:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  8023b3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023b8:	e8 0d ff ff ff       	call   8022ca <nsipc>
+}
+  8023bd:	c9                   	leave
+  8023be:	c3                   	ret
+
+008023bf <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8023bf:	55                   	push   %ebp
+  8023c0:	89 e5                	mov    %esp,%ebp
+  8023c2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8023c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c8:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  8023cd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023d2:	e8 f3 fe ff ff       	call   8022ca <nsipc>
+}
+  8023d7:	c9                   	leave
+  8023d8:	c3                   	ret
+
+008023d9 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8023d9:	55                   	push   %ebp
+  8023da:	89 e5                	mov    %esp,%ebp
+  8023dc:	53                   	push   %ebx
+  8023dd:	83 ec 08             	sub    $0x8,%esp
+  8023e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8023e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e6:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8023eb:	53                   	push   %ebx
+  8023ec:	ff 75 0c             	push   0xc(%ebp)
+  8023ef:	68 04 70 80 00       	push   $0x807004
+  8023f4:	e8 73 e6 ff ff       	call   800a6c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8023f9:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8023ff:	b8 05 00 00 00       	mov    $0x5,%eax
+  802404:	e8 c1 fe ff ff       	call   8022ca <nsipc>
+}
+  802409:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80240c:	c9                   	leave
+  80240d:	c3                   	ret
+
+0080240e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80240e:	55                   	push   %ebp
+  80240f:	89 e5                	mov    %esp,%ebp
+  802411:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802414:	8b 45 08             	mov    0x8(%ebp),%eax
+  802417:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  80241c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80241f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  802424:	b8 06 00 00 00       	mov    $0x6,%eax
+  802429:	e8 9c fe ff ff       	call   8022ca <nsipc>
+}
+  80242e:	c9                   	leave
+  80242f:	c3                   	ret
+
+00802430 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802430:	55                   	push   %ebp
+  802431:	89 e5                	mov    %esp,%ebp
+  802433:	56                   	push   %esi
+  802434:	53                   	push   %ebx
+  802435:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802438:	8b 45 08             	mov    0x8(%ebp),%eax
+  80243b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  802440:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  802446:	8b 45 14             	mov    0x14(%ebp),%eax
+  802449:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80244e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802453:	e8 72 fe ff ff       	call   8022ca <nsipc>
+  802458:	89 c3                	mov    %eax,%ebx
+  80245a:	85 c0                	test   %eax,%eax
+  80245c:	78 22                	js     802480 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80245e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802463:	39 c6                	cmp    %eax,%esi
+  802465:	0f 4e c6             	cmovle %esi,%eax
+  802468:	39 c3                	cmp    %eax,%ebx
+  80246a:	7f 1d                	jg     802489 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80246c:	83 ec 04             	sub    $0x4,%esp
+  80246f:	53                   	push   %ebx
+  802470:	68 00 70 80 00       	push   $0x807000
+  802475:	ff 75 0c             	push   0xc(%ebp)
+  802478:	e8 ef e5 ff ff       	call   800a6c <memmove>
+  80247d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802480:	89 d8                	mov    %ebx,%eax
+  802482:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802485:	5b                   	pop    %ebx
+  802486:	5e                   	pop    %esi
+  802487:	5d                   	pop    %ebp
+  802488:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802489:	68 07 31 80 00       	push   $0x803107
+  80248e:	68 cf 30 80 00       	push   $0x8030cf
+  802493:	6a 62                	push   $0x62
+  802495:	68 1c 31 80 00       	push   $0x80311c
+  80249a:	e8 24 dd ff ff       	call   8001c3 <_panic>
+
+0080249f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80249f:	55                   	push   %ebp
+  8024a0:	89 e5                	mov    %esp,%ebp
+  8024a2:	53                   	push   %ebx
+  8024a3:	83 ec 04             	sub    $0x4,%esp
+  8024a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8024a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ac:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  8024b1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8024b7:	7f 2e                	jg     8024e7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8024b9:	83 ec 04             	sub    $0x4,%esp
+  8024bc:	53                   	push   %ebx
+  8024bd:	ff 75 0c             	push   0xc(%ebp)
+  8024c0:	68 0c 70 80 00       	push   $0x80700c
+  8024c5:	e8 a2 e5 ff ff       	call   800a6c <memmove>
+	nsipcbuf.send.req_size = size;
+  8024ca:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  8024d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d3:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  8024d8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024dd:	e8 e8 fd ff ff       	call   8022ca <nsipc>
+}
+  8024e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+	assert(size < 1600);
+  8024e7:	68 28 31 80 00       	push   $0x803128
+  8024ec:	68 cf 30 80 00       	push   $0x8030cf
+  8024f1:	6a 6d                	push   $0x6d
+  8024f3:	68 1c 31 80 00       	push   $0x80311c
+  8024f8:	e8 c6 dc ff ff       	call   8001c3 <_panic>
+
+008024fd <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8024fd:	55                   	push   %ebp
+  8024fe:	89 e5                	mov    %esp,%ebp
+  802500:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802503:	8b 45 08             	mov    0x8(%ebp),%eax
+  802506:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  80250b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80250e:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  802513:	8b 45 10             	mov    0x10(%ebp),%eax
+  802516:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  80251b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802520:	e8 a5 fd ff ff       	call   8022ca <nsipc>
+}
+  802525:	c9                   	leave
+  802526:	c3                   	ret
+
+00802527 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802527:	55                   	push   %ebp
+  802528:	89 e5                	mov    %esp,%ebp
+  80252a:	56                   	push   %esi
+  80252b:	53                   	push   %ebx
+  80252c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80252f:	83 ec 0c             	sub    $0xc,%esp
+  802532:	ff 75 08             	push   0x8(%ebp)
+  802535:	e8 2a f3 ff ff       	call   801864 <fd2data>
+  80253a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80253c:	83 c4 08             	add    $0x8,%esp
+  80253f:	68 34 31 80 00       	push   $0x803134
+  802544:	53                   	push   %ebx
+  802545:	e8 9c e3 ff ff       	call   8008e6 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80254a:	8b 46 04             	mov    0x4(%esi),%eax
+  80254d:	2b 06                	sub    (%esi),%eax
+  80254f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802555:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80255c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80255f:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  802566:	40 80 00 
+	return 0;
+}
+  802569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802571:	5b                   	pop    %ebx
+  802572:	5e                   	pop    %esi
+  802573:	5d                   	pop    %ebp
+  802574:	c3                   	ret
+
+00802575 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802575:	55                   	push   %ebp
+  802576:	89 e5                	mov    %esp,%ebp
+  802578:	53                   	push   %ebx
+  802579:	83 ec 0c             	sub    $0xc,%esp
+  80257c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80257f:	53                   	push   %ebx
+  802580:	6a 00                	push   $0x0
+  802582:	e8 32 e9 ff ff       	call   800eb9 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802587:	89 1c 24             	mov    %ebx,(%esp)
+  80258a:	e8 d5 f2 ff ff       	call   801864 <fd2data>
+  80258f:	83 c4 08             	add    $0x8,%esp
+  802592:	50                   	push   %eax
+  802593:	6a 00                	push   $0x0
+  802595:	e8 1f e9 ff ff       	call   800eb9 <sys_page_unmap>
+}
+  80259a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+
+0080259f <_pipeisclosed>:
+{
+  80259f:	55                   	push   %ebp
+  8025a0:	89 e5                	mov    %esp,%ebp
+  8025a2:	57                   	push   %edi
+  8025a3:	56                   	push   %esi
+  8025a4:	53                   	push   %ebx
+  8025a5:	83 ec 1c             	sub    $0x1c,%esp
+  8025a8:	89 c7                	mov    %eax,%edi
+  8025aa:	89 d6                	mov    %edx,%esi
+  8025ac:	eb 3c                	jmp    8025ea <_pipeisclosed+0x4b>
+		n = thisenv->env_runs;
+  8025ae:	8b 5a 58             	mov    0x58(%edx),%ebx
+		ret = pageref(fd) == pageref(p);
+  8025b1:	83 ec 0c             	sub    $0xc,%esp
+  8025b4:	57                   	push   %edi
+  8025b5:	e8 13 06 00 00       	call   802bcd <pageref>
+  8025ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025bd:	89 34 24             	mov    %esi,(%esp)
+  8025c0:	e8 08 06 00 00       	call   802bcd <pageref>
+  8025c5:	89 c2                	mov    %eax,%edx
+  8025c7:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025c9:	05 00 00 00 20       	add    $0x20000000,%eax
+  8025ce:	83 c4 10             	add    $0x10,%esp
+	return mainenv;
+  8025d1:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025d7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025dc:	76 31                	jbe    80260f <_pipeisclosed+0x70>
+		nn = thisenv->env_runs;
+  8025de:	8b 41 58             	mov    0x58(%ecx),%eax
+		if (n == nn)
+  8025e1:	39 c3                	cmp    %eax,%ebx
+  8025e3:	74 76                	je     80265b <_pipeisclosed+0xbc>
+		if (n != nn && ret == 1)
+  8025e5:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  8025e8:	74 36                	je     802620 <_pipeisclosed+0x81>
+  8025ea:	89 e0                	mov    %esp,%eax
+  8025ec:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  8025f1:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  8025f7:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  8025fc:	77 b0                	ja     8025ae <_pipeisclosed+0xf>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  8025fe:	c1 e8 10             	shr    $0x10,%eax
+  802601:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802607:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  80260d:	eb 9f                	jmp    8025ae <_pipeisclosed+0xf>
+  80260f:	c1 e8 10             	shr    $0x10,%eax
+  802612:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802618:	8d 88 00 00 c0 ee    	lea    -0x11400000(%eax),%ecx
+  80261e:	eb be                	jmp    8025de <_pipeisclosed+0x3f>
+  802620:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802622:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802627:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  80262d:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802632:	76 16                	jbe    80264a <_pipeisclosed+0xab>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802634:	8b 42 58             	mov    0x58(%edx),%eax
+  802637:	6a 01                	push   $0x1
+  802639:	50                   	push   %eax
+  80263a:	53                   	push   %ebx
+  80263b:	68 3b 31 80 00       	push   $0x80313b
+  802640:	e8 59 dc ff ff       	call   80029e <cprintf>
+  802645:	83 c4 10             	add    $0x10,%esp
+  802648:	eb a0                	jmp    8025ea <_pipeisclosed+0x4b>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  80264a:	c1 e8 10             	shr    $0x10,%eax
+  80264d:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802653:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802659:	eb d9                	jmp    802634 <_pipeisclosed+0x95>
+		ret = pageref(fd) == pageref(p);
+  80265b:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+  80265e:	0f 94 c0             	sete   %al
+  802661:	0f b6 c0             	movzbl %al,%eax
+}
+  802664:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802667:	5b                   	pop    %ebx
+  802668:	5e                   	pop    %esi
+  802669:	5f                   	pop    %edi
+  80266a:	5d                   	pop    %ebp
+  80266b:	c3                   	ret
+
+0080266c <devpipe_write>:
+{
+  80266c:	55                   	push   %ebp
+  80266d:	89 e5                	mov    %esp,%ebp
+  80266f:	57                   	push   %edi
+  802670:	56                   	push   %esi
+  802671:	53                   	push   %ebx
+  802672:	83 ec 28             	sub    $0x28,%esp
+  802675:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802678:	56                   	push   %esi
+  802679:	e8 e6 f1 ff ff       	call   801864 <fd2data>
+  80267e:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802680:	83 c4 10             	add    $0x10,%esp
+  802683:	bf 00 00 00 00       	mov    $0x0,%edi
+  802688:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80268b:	75 09                	jne    802696 <devpipe_write+0x2a>
+	return i;
+  80268d:	89 f8                	mov    %edi,%eax
+  80268f:	eb 23                	jmp    8026b4 <devpipe_write+0x48>
+			sys_yield();
+  802691:	e8 02 e7 ff ff       	call   800d98 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802696:	8b 43 04             	mov    0x4(%ebx),%eax
+  802699:	8b 0b                	mov    (%ebx),%ecx
+  80269b:	8d 51 20             	lea    0x20(%ecx),%edx
+  80269e:	39 d0                	cmp    %edx,%eax
+  8026a0:	72 1a                	jb     8026bc <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8026a2:	89 da                	mov    %ebx,%edx
+  8026a4:	89 f0                	mov    %esi,%eax
+  8026a6:	e8 f4 fe ff ff       	call   80259f <_pipeisclosed>
+  8026ab:	85 c0                	test   %eax,%eax
+  8026ad:	74 e2                	je     802691 <devpipe_write+0x25>
+				return 0;
+  8026af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b7:	5b                   	pop    %ebx
+  8026b8:	5e                   	pop    %esi
+  8026b9:	5f                   	pop    %edi
+  8026ba:	5d                   	pop    %ebp
+  8026bb:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026bf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8026c3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8026c6:	89 c2                	mov    %eax,%edx
+  8026c8:	c1 fa 1f             	sar    $0x1f,%edx
+  8026cb:	89 d1                	mov    %edx,%ecx
+  8026cd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026d0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026d3:	83 e2 1f             	and    $0x1f,%edx
+  8026d6:	29 ca                	sub    %ecx,%edx
+  8026d8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8026dc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8026e0:	83 c0 01             	add    $0x1,%eax
+  8026e3:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8026e6:	83 c7 01             	add    $0x1,%edi
+  8026e9:	eb 9d                	jmp    802688 <devpipe_write+0x1c>
+
+008026eb <devpipe_read>:
+{
+  8026eb:	55                   	push   %ebp
+  8026ec:	89 e5                	mov    %esp,%ebp
+  8026ee:	57                   	push   %edi
+  8026ef:	56                   	push   %esi
+  8026f0:	53                   	push   %ebx
+  8026f1:	83 ec 18             	sub    $0x18,%esp
+  8026f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  8026f7:	57                   	push   %edi
+  8026f8:	e8 67 f1 ff ff       	call   801864 <fd2data>
+  8026fd:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8026ff:	83 c4 10             	add    $0x10,%esp
+  802702:	be 00 00 00 00       	mov    $0x0,%esi
+  802707:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80270a:	75 13                	jne    80271f <devpipe_read+0x34>
+	return i;
+  80270c:	89 f0                	mov    %esi,%eax
+  80270e:	eb 02                	jmp    802712 <devpipe_read+0x27>
+				return i;
+  802710:	89 f0                	mov    %esi,%eax
+}
+  802712:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802715:	5b                   	pop    %ebx
+  802716:	5e                   	pop    %esi
+  802717:	5f                   	pop    %edi
+  802718:	5d                   	pop    %ebp
+  802719:	c3                   	ret
+			sys_yield();
+  80271a:	e8 79 e6 ff ff       	call   800d98 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80271f:	8b 03                	mov    (%ebx),%eax
+  802721:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802724:	75 18                	jne    80273e <devpipe_read+0x53>
+			if (i > 0)
+  802726:	85 f6                	test   %esi,%esi
+  802728:	75 e6                	jne    802710 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  80272a:	89 da                	mov    %ebx,%edx
+  80272c:	89 f8                	mov    %edi,%eax
+  80272e:	e8 6c fe ff ff       	call   80259f <_pipeisclosed>
+  802733:	85 c0                	test   %eax,%eax
+  802735:	74 e3                	je     80271a <devpipe_read+0x2f>
+				return 0;
+  802737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273c:	eb d4                	jmp    802712 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80273e:	99                   	cltd
+  80273f:	c1 ea 1b             	shr    $0x1b,%edx
+  802742:	01 d0                	add    %edx,%eax
+  802744:	83 e0 1f             	and    $0x1f,%eax
+  802747:	29 d0                	sub    %edx,%eax
+  802749:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80274e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802751:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802754:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802757:	83 c6 01             	add    $0x1,%esi
+  80275a:	eb ab                	jmp    802707 <devpipe_read+0x1c>
+
+0080275c <pipe>:
+{
+  80275c:	55                   	push   %ebp
+  80275d:	89 e5                	mov    %esp,%ebp
+  80275f:	56                   	push   %esi
+  802760:	53                   	push   %ebx
+  802761:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802764:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802767:	50                   	push   %eax
+  802768:	e8 0e f1 ff ff       	call   80187b <fd_alloc>
+  80276d:	89 c3                	mov    %eax,%ebx
+  80276f:	83 c4 10             	add    $0x10,%esp
+  802772:	85 c0                	test   %eax,%eax
+  802774:	0f 88 23 01 00 00    	js     80289d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80277a:	83 ec 04             	sub    $0x4,%esp
+  80277d:	68 07 04 00 00       	push   $0x407
+  802782:	ff 75 f4             	push   -0xc(%ebp)
+  802785:	6a 00                	push   $0x0
+  802787:	e8 52 e6 ff ff       	call   800dde <sys_page_alloc>
+  80278c:	89 c3                	mov    %eax,%ebx
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	85 c0                	test   %eax,%eax
+  802793:	0f 88 04 01 00 00    	js     80289d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802799:	83 ec 0c             	sub    $0xc,%esp
+  80279c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80279f:	50                   	push   %eax
+  8027a0:	e8 d6 f0 ff ff       	call   80187b <fd_alloc>
+  8027a5:	89 c3                	mov    %eax,%ebx
+  8027a7:	83 c4 10             	add    $0x10,%esp
+  8027aa:	85 c0                	test   %eax,%eax
+  8027ac:	0f 88 db 00 00 00    	js     80288d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027b2:	83 ec 04             	sub    $0x4,%esp
+  8027b5:	68 07 04 00 00       	push   $0x407
+  8027ba:	ff 75 f0             	push   -0x10(%ebp)
+  8027bd:	6a 00                	push   $0x0
+  8027bf:	e8 1a e6 ff ff       	call   800dde <sys_page_alloc>
+  8027c4:	89 c3                	mov    %eax,%ebx
+  8027c6:	83 c4 10             	add    $0x10,%esp
+  8027c9:	85 c0                	test   %eax,%eax
+  8027cb:	0f 88 bc 00 00 00    	js     80288d <pipe+0x131>
+	va = fd2data(fd0);
+  8027d1:	83 ec 0c             	sub    $0xc,%esp
+  8027d4:	ff 75 f4             	push   -0xc(%ebp)
+  8027d7:	e8 88 f0 ff ff       	call   801864 <fd2data>
+  8027dc:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027de:	83 c4 0c             	add    $0xc,%esp
+  8027e1:	68 07 04 00 00       	push   $0x407
+  8027e6:	50                   	push   %eax
+  8027e7:	6a 00                	push   $0x0
+  8027e9:	e8 f0 e5 ff ff       	call   800dde <sys_page_alloc>
+  8027ee:	89 c3                	mov    %eax,%ebx
+  8027f0:	83 c4 10             	add    $0x10,%esp
+  8027f3:	85 c0                	test   %eax,%eax
+  8027f5:	0f 88 82 00 00 00    	js     80287d <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027fb:	83 ec 0c             	sub    $0xc,%esp
+  8027fe:	ff 75 f0             	push   -0x10(%ebp)
+  802801:	e8 5e f0 ff ff       	call   801864 <fd2data>
+  802806:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80280d:	50                   	push   %eax
+  80280e:	6a 00                	push   $0x0
+  802810:	56                   	push   %esi
+  802811:	6a 00                	push   $0x0
+  802813:	e8 33 e6 ff ff       	call   800e4b <sys_page_map>
+  802818:	89 c3                	mov    %eax,%ebx
+  80281a:	83 c4 20             	add    $0x20,%esp
+  80281d:	85 c0                	test   %eax,%eax
+  80281f:	78 4e                	js     80286f <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802821:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802826:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802829:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80282b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80282e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802835:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802838:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80283a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80283d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802844:	83 ec 0c             	sub    $0xc,%esp
+  802847:	ff 75 f4             	push   -0xc(%ebp)
+  80284a:	e8 05 f0 ff ff       	call   801854 <fd2num>
+  80284f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802852:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802854:	83 c4 04             	add    $0x4,%esp
+  802857:	ff 75 f0             	push   -0x10(%ebp)
+  80285a:	e8 f5 ef ff ff       	call   801854 <fd2num>
+  80285f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802862:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802865:	83 c4 10             	add    $0x10,%esp
+  802868:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80286d:	eb 2e                	jmp    80289d <pipe+0x141>
+	sys_page_unmap(0, va);
+  80286f:	83 ec 08             	sub    $0x8,%esp
+  802872:	56                   	push   %esi
+  802873:	6a 00                	push   $0x0
+  802875:	e8 3f e6 ff ff       	call   800eb9 <sys_page_unmap>
+  80287a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80287d:	83 ec 08             	sub    $0x8,%esp
+  802880:	ff 75 f0             	push   -0x10(%ebp)
+  802883:	6a 00                	push   $0x0
+  802885:	e8 2f e6 ff ff       	call   800eb9 <sys_page_unmap>
+  80288a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80288d:	83 ec 08             	sub    $0x8,%esp
+  802890:	ff 75 f4             	push   -0xc(%ebp)
+  802893:	6a 00                	push   $0x0
+  802895:	e8 1f e6 ff ff       	call   800eb9 <sys_page_unmap>
+  80289a:	83 c4 10             	add    $0x10,%esp
+}
+  80289d:	89 d8                	mov    %ebx,%eax
+  80289f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a2:	5b                   	pop    %ebx
+  8028a3:	5e                   	pop    %esi
+  8028a4:	5d                   	pop    %ebp
+  8028a5:	c3                   	ret
+
+008028a6 <pipeisclosed>:
+{
+  8028a6:	55                   	push   %ebp
+  8028a7:	89 e5                	mov    %esp,%ebp
+  8028a9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028af:	50                   	push   %eax
+  8028b0:	ff 75 08             	push   0x8(%ebp)
+  8028b3:	e8 19 f0 ff ff       	call   8018d1 <fd_lookup>
+  8028b8:	83 c4 10             	add    $0x10,%esp
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	78 18                	js     8028d7 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8028bf:	83 ec 0c             	sub    $0xc,%esp
+  8028c2:	ff 75 f4             	push   -0xc(%ebp)
+  8028c5:	e8 9a ef ff ff       	call   801864 <fd2data>
+  8028ca:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8028cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028cf:	e8 cb fc ff ff       	call   80259f <_pipeisclosed>
+  8028d4:	83 c4 10             	add    $0x10,%esp
+}
+  8028d7:	c9                   	leave
+  8028d8:	c3                   	ret
+
+008028d9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8028d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028de:	c3                   	ret
+
+008028df <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8028e5:	68 53 31 80 00       	push   $0x803153
+  8028ea:	ff 75 0c             	push   0xc(%ebp)
+  8028ed:	e8 f4 df ff ff       	call   8008e6 <strcpy>
+	return 0;
+}
+  8028f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f7:	c9                   	leave
+  8028f8:	c3                   	ret
+
+008028f9 <devcons_write>:
+{
+  8028f9:	55                   	push   %ebp
+  8028fa:	89 e5                	mov    %esp,%ebp
+  8028fc:	57                   	push   %edi
+  8028fd:	56                   	push   %esi
+  8028fe:	53                   	push   %ebx
+  8028ff:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802905:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80290a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802910:	eb 2e                	jmp    802940 <devcons_write+0x47>
+		m = n - tot;
+  802912:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802915:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802917:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80291c:	39 c3                	cmp    %eax,%ebx
+  80291e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802921:	83 ec 04             	sub    $0x4,%esp
+  802924:	53                   	push   %ebx
+  802925:	89 f0                	mov    %esi,%eax
+  802927:	03 45 0c             	add    0xc(%ebp),%eax
+  80292a:	50                   	push   %eax
+  80292b:	57                   	push   %edi
+  80292c:	e8 3b e1 ff ff       	call   800a6c <memmove>
+		sys_cputs(buf, m);
+  802931:	83 c4 08             	add    $0x8,%esp
+  802934:	53                   	push   %ebx
+  802935:	57                   	push   %edi
+  802936:	e8 24 e3 ff ff       	call   800c5f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80293b:	01 de                	add    %ebx,%esi
+  80293d:	83 c4 10             	add    $0x10,%esp
+  802940:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802943:	72 cd                	jb     802912 <devcons_write+0x19>
+}
+  802945:	89 f0                	mov    %esi,%eax
+  802947:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80294a:	5b                   	pop    %ebx
+  80294b:	5e                   	pop    %esi
+  80294c:	5f                   	pop    %edi
+  80294d:	5d                   	pop    %ebp
+  80294e:	c3                   	ret
+
+0080294f <devcons_read>:
+{
+  80294f:	55                   	push   %ebp
+  802950:	89 e5                	mov    %esp,%ebp
+  802952:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80295e:	75 07                	jne    802967 <devcons_read+0x18>
+  802960:	eb 1f                	jmp    802981 <devcons_read+0x32>
+		sys_yield();
+  802962:	e8 31 e4 ff ff       	call   800d98 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802967:	e8 37 e3 ff ff       	call   800ca3 <sys_cgetc>
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	74 f2                	je     802962 <devcons_read+0x13>
+	if (c < 0)
+  802970:	78 0f                	js     802981 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802972:	83 f8 04             	cmp    $0x4,%eax
+  802975:	74 0c                	je     802983 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802977:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80297a:	88 02                	mov    %al,(%edx)
+	return 1;
+  80297c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802981:	c9                   	leave
+  802982:	c3                   	ret
+		return 0;
+  802983:	b8 00 00 00 00       	mov    $0x0,%eax
+  802988:	eb f7                	jmp    802981 <devcons_read+0x32>
+
+0080298a <cputchar>:
+{
+  80298a:	55                   	push   %ebp
+  80298b:	89 e5                	mov    %esp,%ebp
+  80298d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802990:	8b 45 08             	mov    0x8(%ebp),%eax
+  802993:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802996:	6a 01                	push   $0x1
+  802998:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80299b:	50                   	push   %eax
+  80299c:	e8 be e2 ff ff       	call   800c5f <sys_cputs>
+}
+  8029a1:	83 c4 10             	add    $0x10,%esp
+  8029a4:	c9                   	leave
+  8029a5:	c3                   	ret
+
+008029a6 <getchar>:
+{
+  8029a6:	55                   	push   %ebp
+  8029a7:	89 e5                	mov    %esp,%ebp
+  8029a9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8029ac:	6a 01                	push   $0x1
+  8029ae:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029b1:	50                   	push   %eax
+  8029b2:	6a 00                	push   $0x0
+  8029b4:	e8 9e f1 ff ff       	call   801b57 <read>
+	if (r < 0)
+  8029b9:	83 c4 10             	add    $0x10,%esp
+  8029bc:	85 c0                	test   %eax,%eax
+  8029be:	78 06                	js     8029c6 <getchar+0x20>
+	if (r < 1)
+  8029c0:	74 06                	je     8029c8 <getchar+0x22>
+	return c;
+  8029c2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+		return -E_EOF;
+  8029c8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029cd:	eb f7                	jmp    8029c6 <getchar+0x20>
+
+008029cf <iscons>:
+{
+  8029cf:	55                   	push   %ebp
+  8029d0:	89 e5                	mov    %esp,%ebp
+  8029d2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029d8:	50                   	push   %eax
+  8029d9:	ff 75 08             	push   0x8(%ebp)
+  8029dc:	e8 f0 ee ff ff       	call   8018d1 <fd_lookup>
+  8029e1:	83 c4 10             	add    $0x10,%esp
+  8029e4:	85 c0                	test   %eax,%eax
+  8029e6:	78 11                	js     8029f9 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8029e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029eb:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  8029f1:	39 10                	cmp    %edx,(%eax)
+  8029f3:	0f 94 c0             	sete   %al
+  8029f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8029f9:	c9                   	leave
+  8029fa:	c3                   	ret
+
+008029fb <opencons>:
+{
+  8029fb:	55                   	push   %ebp
+  8029fc:	89 e5                	mov    %esp,%ebp
+  8029fe:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802a01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a04:	50                   	push   %eax
+  802a05:	e8 71 ee ff ff       	call   80187b <fd_alloc>
+  802a0a:	83 c4 10             	add    $0x10,%esp
+  802a0d:	85 c0                	test   %eax,%eax
+  802a0f:	78 3a                	js     802a4b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802a11:	83 ec 04             	sub    $0x4,%esp
+  802a14:	68 07 04 00 00       	push   $0x407
+  802a19:	ff 75 f4             	push   -0xc(%ebp)
+  802a1c:	6a 00                	push   $0x0
+  802a1e:	e8 bb e3 ff ff       	call   800dde <sys_page_alloc>
+  802a23:	83 c4 10             	add    $0x10,%esp
+  802a26:	85 c0                	test   %eax,%eax
+  802a28:	78 21                	js     802a4b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802a2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a2d:	8b 15 58 40 80 00    	mov    0x804058,%edx
+  802a33:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802a35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a38:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802a3f:	83 ec 0c             	sub    $0xc,%esp
+  802a42:	50                   	push   %eax
+  802a43:	e8 0c ee ff ff       	call   801854 <fd2num>
+  802a48:	83 c4 10             	add    $0x10,%esp
+}
+  802a4b:	c9                   	leave
+  802a4c:	c3                   	ret
+
+00802a4d <ipc_recv_until>:
+// Like ipc_recv, but give up with -E_TIMEOUT at time_msec() 'deadline'
+// (0 means never).
+int32_t
+ipc_recv_until(envid_t *from_env_store, void *pg, int *perm_store,
+	       unsigned deadline)
+{
+  802a4d:	55                   	push   %ebp
+  802a4e:	89 e5                	mov    %esp,%ebp
+  802a50:	56                   	push   %esi
+  802a51:	53                   	push   %ebx
+  802a52:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802a5b:	85 c0                	test   %eax,%eax
+  802a5d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a62:	0f 44 c2             	cmove  %edx,%eax
+	if ((error = sys_ipc_recv_until(pg, deadline)) < 0) {
+  802a65:	83 ec 08             	sub    $0x8,%esp
+  802a68:	ff 75 14             	push   0x14(%ebp)
+  802a6b:	50                   	push   %eax
+  802a6c:	e8 7e e7 ff ff       	call   8011ef <sys_ipc_recv_until>
+  802a71:	83 c4 10             	add    $0x10,%esp
+  802a74:	85 c0                	test   %eax,%eax
+  802a76:	78 61                	js     802ad9 <ipc_recv_until+0x8c>
+		if (perm_store)
+			*perm_store = 0;
+		
+		return error;
+	}
+	if (from_env_store)
+  802a78:	85 f6                	test   %esi,%esi
+  802a7a:	74 1c                	je     802a98 <ipc_recv_until+0x4b>
+  802a7c:	89 e0                	mov    %esp,%eax
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a7e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802a83:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802a89:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802a8e:	76 5f                	jbe    802aef <ipc_recv_until+0xa2>
+		*from_env_store = thisenv->env_ipc_from;
+  802a90:	8b 82 98 00 00 00    	mov    0x98(%edx),%eax
+  802a96:	89 06                	mov    %eax,(%esi)
+	
+	if (perm_store)
+  802a98:	85 db                	test   %ebx,%ebx
+  802a9a:	74 1c                	je     802ab8 <ipc_recv_until+0x6b>
+  802a9c:	89 e0                	mov    %esp,%eax
+  802a9e:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802aa3:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802aa9:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802aae:	76 50                	jbe    802b00 <ipc_recv_until+0xb3>
+		*perm_store = thisenv->env_ipc_perm;
+  802ab0:	8b 82 9c 00 00 00    	mov    0x9c(%edx),%eax
+  802ab6:	89 03                	mov    %eax,(%ebx)
+  802ab8:	89 e0                	mov    %esp,%eax
+  802aba:	05 00 00 00 20       	add    $0x20000000,%eax
+	return mainenv;
+  802abf:	8b 15 08 50 80 00    	mov    0x805008,%edx
+	if (esp >= UTHREADS && esp < UTHREADS + NENV * THREADSLOT)
+  802ac5:	3d ff ff ff 03       	cmp    $0x3ffffff,%eax
+  802aca:	76 45                	jbe    802b11 <ipc_recv_until+0xc4>
+	
+	return thisenv->env_ipc_value;
+  802acc:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+}
+  802ad2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ad5:	5b                   	pop    %ebx
+  802ad6:	5e                   	pop    %esi
+  802ad7:	5d                   	pop    %ebp
+  802ad8:	c3                   	ret
+		if (from_env_store)
+  802ad9:	85 f6                	test   %esi,%esi
+  802adb:	74 06                	je     802ae3 <ipc_recv_until+0x96>
+			*from_env_store = 0;
+  802add:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store)
+  802ae3:	85 db                	test   %ebx,%ebx
+  802ae5:	74 eb                	je     802ad2 <ipc_recv_until+0x85>
+			*perm_store = 0;
+  802ae7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802aed:	eb e3                	jmp    802ad2 <ipc_recv_until+0x85>
+		return &envs[(esp - UTHREADS) / THREADSLOT];
+  802aef:	c1 e8 10             	shr    $0x10,%eax
+  802af2:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802af8:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802afe:	eb 90                	jmp    802a90 <ipc_recv_until+0x43>
+  802b00:	c1 e8 10             	shr    $0x10,%eax
+  802b03:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b09:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b0f:	eb 9f                	jmp    802ab0 <ipc_recv_until+0x63>
+  802b11:	c1 e8 10             	shr    $0x10,%eax
+  802b14:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802b1a:	8d 90 00 00 c0 ee    	lea    -0x11400000(%eax),%edx
+  802b20:	eb aa                	jmp    802acc <ipc_recv_until+0x7f>
+
+00802b22 <ipc_recv>:
+{
+  802b22:	55                   	push   %ebp
+  802b23:	89 e5                	mov    %esp,%ebp
+  802b25:	83 ec 08             	sub    $0x8,%esp
+	return ipc_recv_until(from_env_store, pg, perm_store, 0);
+  802b28:	6a 00                	push   $0x0
+  802b2a:	ff 75 10             	push   0x10(%ebp)
+  802b2d:	ff 75 0c             	push   0xc(%ebp)
+  802b30:	ff 75 08             	push   0x8(%ebp)
+  802b33:	e8 15 ff ff ff       	call   802a4d <ipc_recv_until>
+}
+  802b38:	c9                   	leave
+  802b39:	c3                   	ret
+
+00802b3a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  802b3a:	55                   	push   %ebp
+  802b3b:	89 e5                	mov    %esp,%ebp
+  802b3d:	57                   	push   %edi
+  802b3e:	56                   	push   %esi
+  802b3f:	53                   	push   %ebx
+  802b40:	83 ec 0c             	sub    $0xc,%esp
+  802b43:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b46:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int error;
+	
+	if (pg == 0)
+		pg = (void *) UTOP;
+  802b4c:	85 db                	test   %ebx,%ebx
+  802b4e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b53:	0f 44 d8             	cmove  %eax,%ebx
+  802b56:	eb 05                	jmp    802b5d <ipc_send+0x23>
+	
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+		sys_yield();
+  802b58:	e8 3b e2 ff ff       	call   800d98 <sys_yield>
+	while((error = sys_ipc_try_send(to_env, val, pg, perm)) == -E_IPC_NOT_RECV) {
+  802b5d:	ff 75 14             	push   0x14(%ebp)
+  802b60:	53                   	push   %ebx
+  802b61:	56                   	push   %esi
+  802b62:	57                   	push   %edi
+  802b63:	e8 d3 e5 ff ff       	call   80113b <sys_ipc_try_send>
+  802b68:	83 c4 10             	add    $0x10,%esp
+  802b6b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b6e:	74 e8                	je     802b58 <ipc_send+0x1e>
+	}
+	
+	if(error < 0)
+  802b70:	85 c0                	test   %eax,%eax
+  802b72:	78 08                	js     802b7c <ipc_send+0x42>
+		panic("ipc_send error: %e", error);
+}
+  802b74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b77:	5b                   	pop    %ebx
+  802b78:	5e                   	pop    %esi
+  802b79:	5f                   	pop    %edi
+  802b7a:	5d                   	pop    %ebp
+  802b7b:	c3                   	ret
+		panic("ipc_send error: %e", error);
+  802b7c:	50                   	push   %eax
+  802b7d:	68 5f 31 80 00       	push   $0x80315f
+  802b82:	6a 4f                	push   $0x4f
+  802b84:	68 72 31 80 00       	push   $0x803172
+  802b89:	e8 35 d6 ff ff       	call   8001c3 <_panic>
+
+00802b8e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b8e:	55                   	push   %ebp
+  802b8f:	89 e5                	mov    %esp,%ebp
+  802b91:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802b94:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802b99:	69 d0 58 01 00 00    	imul   $0x158,%eax,%edx
+  802b9f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802ba5:	8b 52 50             	mov    0x50(%edx),%edx
+  802ba8:	39 ca                	cmp    %ecx,%edx
+  802baa:	74 11                	je     802bbd <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  802bac:	83 c0 01             	add    $0x1,%eax
+  802baf:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802bb4:	75 e3                	jne    802b99 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbb:	eb 0e                	jmp    802bcb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  802bbd:	69 c0 58 01 00 00    	imul   $0x158,%eax,%eax
+  802bc3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bc8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bcb:	5d                   	pop    %ebp
+  802bcc:	c3                   	ret
+
+00802bcd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bcd:	55                   	push   %ebp
+  802bce:	89 e5                	mov    %esp,%ebp
+  802bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802bd3:	89 c2                	mov    %eax,%edx
+  802bd5:	c1 ea 16             	shr    $0x16,%edx
+  802bd8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802be4:	f6 c1 01             	test   $0x1,%cl
+  802be7:	74 1a                	je     802c03 <pageref+0x36>
+	pte = uvpt[PGNUM(v)];
+  802be9:	c1 e8 0c             	shr    $0xc,%eax
+  802bec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802bf3:	a8 01                	test   $0x1,%al
+  802bf5:	74 0c                	je     802c03 <pageref+0x36>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802bf7:	c1 e8 0c             	shr    $0xc,%eax
+  802bfa:	c1 e0 04             	shl    $0x4,%eax
+  802bfd:	8b 90 08 00 00 ef    	mov    -0x10fffff8(%eax),%edx
+}
+  802c03:	89 d0                	mov    %edx,%eax
+  802c05:	5d                   	pop    %ebp
+  802c06:	c3                   	ret
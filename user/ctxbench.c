@@ -0,0 +1,65 @@
+// Measure the cost of a context switch between two environments.
+//
+// Two processes bounce a counter back and forth with IPC, so every
+// message switches address spaces.  The kernel's own mappings are global
+// (PTE_G), so they stay in the TLB across the switch and the kernel does
+// not refill them on every IPC.  Compare against a kernel built without
+// global pages:
+//	make clean && make run-ctxbench-nox DEFS=-DNO_GLOBAL_PAGES
+// Times are in TSC cycles.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NWARMUP		1024
+#define NROUNDS_SHIFT	13
+#define NROUNDS		(1 << NROUNDS_SHIFT)	// round trips timed
+#define STOP		0xFFFFFFFF
+
+// Send every counter back until told to stop.
+static void
+echo(void)
+{
+	envid_t who;
+	uint32_t i;
+
+	while ((i = ipc_recv(&who, NULL, NULL)) != STOP)
+		ipc_send(who, i, NULL, 0);
+}
+
+static void
+bounce(envid_t child, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		ipc_send(child, i, NULL, 0);
+		if (ipc_recv(NULL, NULL, NULL) != i)
+			panic("ctxbench: lost count");
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child;
+	uint64_t start, total;
+
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		echo();
+		return;
+	}
+
+	bounce(child, NWARMUP);
+	start = read_tsc();
+	bounce(child, NROUNDS);
+	total = read_tsc() - start;
+	ipc_send(child, STOP, NULL, 0);
+	wait(child);
+
+	cprintf("ctxbench: %u round trips, %u cycles each, %u per switch\n",
+		NROUNDS, (uint32_t) (total >> NROUNDS_SHIFT),
+		(uint32_t) (total >> (NROUNDS_SHIFT + 1)));
+}
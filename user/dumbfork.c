@@ -58,7 +58,7 @@ dumbfork(void)
 		// The copied value of the global variable 'thisenv'
 		// is no longer valid (it refers to the parent!).
 		// Fix it and return 0.
-		thisenv = &envs[ENVX(sys_getenvid())];
+		mainenv = &envs[ENVX(sys_getenvid())];
 		return 0;
 	}
 
@@ -0,0 +1,106 @@
+// Compare the latency of fork(), which has the kernel copy the address
+// space (sys_fork), with ufork(), which copies it with page system calls
+// from user space.
+//
+// Three cases: a small process, the same with a big heap mapped, and a
+// forktree-style tree of processes.  For the first two only the fork
+// call in the parent is timed; for the tree, the time until every
+// process in it has exited.  Times are in thousands of TSC cycles.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NFORKS		20
+#define HEAP		((char *) 0x10000000)
+#define HEAPPAGES	1024		// 4MB
+#define TREEDEPTH	5		// 63 processes
+
+typedef envid_t (*forkfn_t)(void);
+
+// The mean cycles, >> 10, that one call of 'forkfn' takes.
+static uint32_t
+bench_fork(forkfn_t forkfn)
+{
+	uint64_t start, total = 0;
+	envid_t envid;
+	int i;
+
+	for (i = 0; i < NFORKS; i++) {
+		start = read_tsc();
+		if ((envid = forkfn()) < 0)
+			panic("fork: %e", envid);
+		if (envid == 0)
+			exit();
+		total += read_tsc() - start;
+		wait(envid);
+	}
+	return (uint32_t) (total >> 10) / NFORKS;
+}
+
+static void
+tree(forkfn_t forkfn, int depth)
+{
+	envid_t child[2];
+	int i;
+
+	if (depth == 0)
+		return;
+	for (i = 0; i < 2; i++) {
+		if ((child[i] = forkfn()) < 0)
+			panic("fork: %e", child[i]);
+		if (child[i] == 0) {
+			tree(forkfn, depth - 1);
+			exit();
+		}
+	}
+	for (i = 0; i < 2; i++)
+		wait(child[i]);
+}
+
+// The cycles, >> 10, a tree of processes takes to fork and exit.
+static uint32_t
+bench_tree(forkfn_t forkfn)
+{
+	uint64_t start = read_tsc();
+
+	tree(forkfn, TREEDEPTH);
+	return (uint32_t) ((read_tsc() - start) >> 10);
+}
+
+static void
+report(const char *what, uint32_t slow, uint32_t fast)
+{
+	cprintf("forkbench: %-16s ufork %7u kc, fork %7u kc\n", what, slow,
+		fast);
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct Batch b;
+	uint32_t slow, fast;
+	int i, r;
+
+	// warm up
+	bench_fork(ufork);
+	bench_fork(fork);
+
+	slow = bench_fork(ufork);
+	fast = bench_fork(fork);
+	report("small", slow, fast);
+
+	batch_init(&b);
+	batch_alloc(&b, 0, HEAP, PTE_P | PTE_U | PTE_W, HEAPPAGES);
+	if ((r = batch_flush(&b)) < 0)
+		panic("batch_flush: %e", r);
+	for (i = 0; i < HEAPPAGES; i++)
+		HEAP[i * PGSIZE] = i;
+
+	slow = bench_fork(ufork);
+	fast = bench_fork(fork);
+	report("4MB heap", slow, fast);
+
+	slow = bench_tree(ufork);
+	fast = bench_tree(fork);
+	report("tree of 63", slow, fast);
+}
@@ -0,0 +1,35 @@
+// Show free and used physical memory, and the memory of each environment.
+// usage: meminfo
+
+#include <inc/lib.h>
+
+static struct EnvMemInfo envinfo[NENV];
+
+void
+umain(int argc, char **argv)
+{
+	struct MemInfo mi;
+	int i, n;
+
+	if (argc != 1) {
+		printf("usage: meminfo\n");
+		exit();
+	}
+	if ((n = sys_meminfo(&mi, envinfo, NENV)) < 0) {
+		printf("meminfo: %e\n", n);
+		exit();
+	}
+	n = MIN(n, NENV);
+
+	printf("memory: %uK total, %uK free (%uK zeroed), %uK used\n",
+	       mi.mi_total * (PGSIZE / 1024), mi.mi_free * (PGSIZE / 1024),
+	       mi.mi_zeroed * (PGSIZE / 1024), mi.mi_used * (PGSIZE / 1024));
+	printf("merging identical pages saves %uK\n",
+	       mi.mi_merged * (PGSIZE / 1024));
+	printf("%8s %9s %9s %9s\n", "envid", "resident", "shared", "ptables");
+	for (i = 0; i < n; i++)
+		printf("%08x %8uK %8uK %8uK\n", envinfo[i].em_envid,
+		       envinfo[i].em_resident * (PGSIZE / 1024),
+		       envinfo[i].em_shared * (PGSIZE / 1024),
+		       envinfo[i].em_ptables * (PGSIZE / 1024));
+}
@@ -0,0 +1,36 @@
+// Control the kernel's sampling profiler.
+// usage: perf start [hz] | perf stop | perf report [n]
+
+#include <inc/lib.h>
+
+static void
+usage(void)
+{
+	printf("usage: perf start [hz] | perf stop | perf report [n]\n");
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+	unsigned arg;
+	int r;
+
+	if (argc < 2 || argc > 3) {
+		usage();
+		return;
+	}
+	arg = argc == 3 ? strtol(argv[2], 0, 10) : 0;
+	if (strcmp(argv[1], "start") == 0)
+		r = sys_perf(PERF_START, arg);
+	else if (strcmp(argv[1], "stop") == 0 && argc == 2)
+		r = sys_perf(PERF_STOP, 0);
+	else if (strcmp(argv[1], "report") == 0)
+		r = sys_perf(PERF_REPORT, argc == 3 ? arg : 20);
+	else {
+		usage();
+		return;
+	}
+	if (r < 0)
+		printf("perf: %e\n", r);
+}
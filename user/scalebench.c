@@ -0,0 +1,74 @@
+// Measure system call throughput with several environments making
+// page-mapping system calls at the same time.
+//
+// Each worker repeatedly allocates, maps and unmaps pages in its own
+// address space.  These system calls run without the big kernel lock, so
+// the total rate should grow with the number of CPUs.  Compare e.g.
+//	make run-scalebench-nox CPUS=1
+//	make run-scalebench-nox CPUS=8
+// (QEMU only runs CPUs in parallel with KVM or multi-threaded TCG.)
+
+#include <inc/lib.h>
+
+#define NWORKERS	8
+#define DURATION	2000	// msec
+
+#define PAGE_A		((void *) 0xA0000000)
+#define PAGE_B		((void *) 0xA0001000)
+
+static void
+worker(void)
+{
+	int perm = PTE_P | PTE_U | PTE_W;
+	unsigned end, ncalls = 0;
+	int r;
+
+	// wait for the go from the parent
+	ipc_recv(NULL, NULL, NULL);
+
+	end = sys_time_msec() + DURATION;
+	while (sys_time_msec() < end) {
+		if ((r = sys_page_alloc(0, PAGE_A, perm)) < 0)
+			panic("sys_page_alloc: %e", r);
+		if ((r = sys_page_map(0, PAGE_A, 0, PAGE_B, perm)) < 0)
+			panic("sys_page_map: %e", r);
+		if ((r = sys_page_unmap(0, PAGE_B)) < 0)
+			panic("sys_page_unmap: %e", r);
+		if ((r = sys_page_unmap(0, PAGE_A)) < 0)
+			panic("sys_page_unmap: %e", r);
+		// the time check is a system call too
+		ncalls += 5;
+	}
+
+	ipc_send(thisenv->env_parent_id, ncalls, NULL, 0);
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t workers[NWORKERS], from;
+	unsigned total = 0, n;
+	int i;
+
+	for (i = 0; i < NWORKERS; i++) {
+		if ((workers[i] = fork()) < 0)
+			panic("fork: %e", workers[i]);
+		if (workers[i] == 0) {
+			worker();
+			return;
+		}
+	}
+
+	for (i = 0; i < NWORKERS; i++)
+		ipc_send(workers[i], 0, NULL, 0);
+
+	for (i = 0; i < NWORKERS; i++) {
+		n = ipc_recv(&from, NULL, NULL);
+		cprintf("scalebench: worker %08x made %u system calls\n",
+			from, n);
+		total += n;
+	}
+
+	cprintf("scalebench: %d workers, %u system calls in %d ms, %u per ms\n",
+		NWORKERS, total, DURATION, total / DURATION);
+}
@@ -0,0 +1,45 @@
+// Compare the cost of a system call made with sysenter and with
+// 'int T_SYSCALL'.
+//
+// sys_getenvid() does almost nothing in the kernel and runs without the
+// big kernel lock, so the time per call is mostly the cost of getting
+// into the kernel and back.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NCALLS	100000
+
+static uint32_t
+bench(bool use_int)
+{
+	uint64_t start;
+	int i;
+
+	syscall_use_int = use_int;
+	start = read_tsc();
+	for (i = 0; i < NCALLS; i++)
+		sys_getenvid();
+	return read_tsc() - start;
+}
+
+void
+umain(int argc, char **argv)
+{
+	bool saved = syscall_use_int;
+	uint32_t fast, slow;
+
+	if (saved)
+		cprintf("sysbench: this CPU has no sysenter\n");
+
+	// warm up
+	bench(true);
+	bench(saved);
+
+	slow = bench(true);
+	fast = bench(saved);
+	syscall_use_int = saved;
+
+	cprintf("sysbench: int %u cycles/call, sysenter %u cycles/call\n",
+		slow / NCALLS, fast / NCALLS);
+}
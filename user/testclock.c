@@ -0,0 +1,40 @@
+// Check the user-readable clock at UTIME against the kernel's.
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t a, b, c;
+	unsigned ms, kms;
+	int i;
+
+	if (timeinfo.ti_tsc_khz == 0)
+		panic("no TSC calibration at UTIME");
+	cprintf("TSC runs at %u kHz\n", timeinfo.ti_tsc_khz);
+
+	// The clock never goes backwards, in or out of the kernel.
+	for (i = 0; i < 1000; i++) {
+		a = time_nsec();
+		b = sys_time_nsec();
+		c = time_nsec();
+		if (b < a || c < b)
+			panic("clock went backwards");
+	}
+
+	// Both millisecond clocks agree.
+	ms = time_msec();
+	kms = sys_time_msec();
+	if (kms < ms || kms - ms > 1)
+		panic("time_msec %u, sys_time_msec %u", ms, kms);
+
+	// And they move: wait 100ms by the nanosecond clock.
+	a = time_nsec();
+	while (time_nsec() - a < 100000000)
+		sys_yield();
+	kms = sys_time_msec() - kms;
+	if (kms < 100 || kms > 150)
+		panic("100ms took %u ms", kms);
+
+	cprintf("testclock: OK\n");
+}
@@ -0,0 +1,66 @@
+// Test same-page merging: sys_env_set_ksm().
+
+#include <inc/lib.h>
+
+#define VA	((char *) 0x30000000)
+#define NPAGES	8
+#define PERM	(PTE_P | PTE_U | PTE_W)
+
+static bool
+merged(void)
+{
+	int i;
+
+	for (i = 1; i < NPAGES; i++)
+		if (PTE_ADDR(uvpt[PGNUM(VA + i * PGSIZE)]) !=
+		    PTE_ADDR(uvpt[PGNUM(VA)]))
+			return false;
+	return true;
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct MemInfo mi;
+	unsigned start;
+	int i, r;
+
+	// Identical pages, and one that differs by a byte.
+	for (i = 0; i <= NPAGES; i++) {
+		if ((r = sys_page_alloc(0, VA + i * PGSIZE, PERM)) < 0)
+			panic("sys_page_alloc: %e", r);
+		memset(VA + i * PGSIZE, 0x5a, PGSIZE);
+	}
+	VA[NPAGES * PGSIZE + PGSIZE / 2] = 0;
+
+	if ((r = sys_env_set_ksm(0, 1)) < 0)
+		panic("sys_env_set_ksm: %e", r);
+
+	// Idle CPUs merge them while we sleep.
+	start = time_msec();
+	while (!merged()) {
+		if (time_msec() - start > 10000)
+			panic("pages not merged after 10s");
+		sys_sleep_until(time_msec() + 20);
+	}
+	cprintf("ksm: merged %d pages in %u ms\n", NPAGES,
+		time_msec() - start);
+	assert(uvpt[PGNUM(VA)] & PTE_COW);
+	assert(PTE_ADDR(uvpt[PGNUM(VA + NPAGES * PGSIZE)]) !=
+	       PTE_ADDR(uvpt[PGNUM(VA)]));
+
+	if ((r = sys_meminfo(&mi, 0, 0)) < 0)
+		panic("sys_meminfo: %e", r);
+	assert(mi.mi_merged >= NPAGES - 1);
+
+	// Stop merging before writing, so the copy stays ours.
+	sys_env_set_ksm(0, 0);
+	VA[0] = 1;
+	assert(PTE_ADDR(uvpt[PGNUM(VA)]) !=
+	       PTE_ADDR(uvpt[PGNUM(VA + PGSIZE)]));
+	for (i = 1; i < NPAGES; i++)
+		assert(VA[i * PGSIZE] == 0x5a &&
+		       VA[i * PGSIZE + PGSIZE - 1] == 0x5a);
+
+	cprintf("ksm: OK\n");
+}
@@ -0,0 +1,84 @@
+// Test 4MB pages: sys_page_alloc() with PTE_PS.
+
+#include <inc/lib.h>
+
+#define VA	((char *) 0x20000000)
+#define VA2	((char *) 0x20400000)
+#define PERM	(PTE_P | PTE_U | PTE_W)
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child;
+	int r;
+
+	if ((r = sys_page_alloc(0, VA + PGSIZE, PERM | PTE_PS)) != -E_INVAL)
+		panic("sys_page_alloc at an unaligned va: %e", r);
+
+	// A 4MB page replaces the 4KB pages in its way.
+	if ((r = sys_page_alloc(0, VA + PGSIZE, PERM)) < 0)
+		panic("sys_page_alloc: %e", r);
+	VA[PGSIZE] = 1;
+	if ((r = sys_page_alloc(0, VA, PERM | PTE_PS)) < 0)
+		panic("sys_page_alloc: %e", r);
+	assert((uvpd[PDX(VA)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS));
+	assert(VA[PGSIZE] == 0 && VA[PTSIZE - 1] == 0);
+
+	// The kernel checks user memory across it.
+	strcpy(VA + PTSIZE - 4, "ok");
+	cprintf("largepage: kernel reads it %s\n", VA + PTSIZE - 4);
+
+	// It can be mapped elsewhere, but only as a whole.
+	if ((r = sys_page_map(0, VA + PGSIZE, 0, VA2, PERM)) != -E_INVAL)
+		panic("sys_page_map from inside a 4MB page: %e", r);
+	if ((r = sys_page_map(0, VA, 0, VA2, PERM)) < 0)
+		panic("sys_page_map: %e", r);
+	VA2[PTSIZE / 2] = 'x';
+	assert(VA[PTSIZE / 2] == 'x');
+	if ((r = sys_page_unmap(0, VA2)) < 0)
+		panic("sys_page_unmap: %e", r);
+
+	// It cannot be copy-on-write.
+	r = sys_page_map(0, VA, 0, VA2, PTE_P | PTE_U | PTE_COW);
+	if (r != -E_INVAL)
+		panic("sys_page_map copy-on-write: %e", r);
+
+	// fork and ufork copy it...
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		assert(VA[PTSIZE / 2] == 'x');
+		VA[PTSIZE / 2] = 'y';
+		exit();
+	}
+	wait(child);
+	assert(VA[PTSIZE / 2] == 'x');
+	if ((child = ufork()) < 0)
+		panic("ufork: %e", child);
+	if (child == 0) {
+		assert(VA[PTSIZE / 2] == 'x');
+		VA[PTSIZE / 2] = 'y';
+		exit();
+	}
+	wait(child);
+	assert(VA[PTSIZE / 2] == 'x');
+
+	// ... unless it is PTE_SHARE.
+	if ((r = sys_page_map(0, VA, 0, VA, PERM | PTE_SHARE)) < 0)
+		panic("sys_page_map: %e", r);
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		VA[PTSIZE / 2] = 'y';
+		exit();
+	}
+	wait(child);
+	assert(VA[PTSIZE / 2] == 'y');
+
+	// Unmapping any of it unmaps all of it.
+	if ((r = sys_page_unmap(0, VA + PTSIZE / 2)) < 0)
+		panic("sys_page_unmap: %e", r);
+	assert(!(uvpd[PDX(VA)] & PTE_P));
+
+	cprintf("largepage: OK\n");
+}
@@ -0,0 +1,65 @@
+// Test the per-environment memory accounting of sys_meminfo().
+
+#include <inc/lib.h>
+
+#define VA	((char *) 0x30000000)
+#define NPAGES	8
+#define PERM	(PTE_P | PTE_U | PTE_W)
+
+static struct EnvMemInfo envinfo[NENV];
+
+// Our own memory, as the kernel counts it.
+static struct EnvMemInfo
+self(void)
+{
+	struct MemInfo mi;
+	int i, n;
+
+	if ((n = sys_meminfo(&mi, envinfo, NENV)) < 0)
+		panic("sys_meminfo: %e", n);
+	assert(mi.mi_used == mi.mi_total - mi.mi_free);
+	assert(mi.mi_zeroed <= mi.mi_free);
+	for (i = 0; i < n; i++)
+		if (envinfo[i].em_envid == thisenv->env_id)
+			return envinfo[i];
+	panic("sys_meminfo does not list us");
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct EnvMemInfo before, after;
+	int i, r;
+
+	// The first call fills in envinfo's demand-zero pages.
+	before = self();
+	before = self();
+	assert(before.em_ptables >= 2);
+	assert(before.em_shared <= before.em_resident);
+
+	// Pages in a 4MB of their own come with a page table.
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_alloc(0, VA + i * PGSIZE, PERM)) < 0)
+			panic("sys_page_alloc: %e", r);
+	after = self();
+	assert(after.em_resident == before.em_resident + NPAGES);
+	assert(after.em_ptables == before.em_ptables + 1);
+	assert(after.em_shared == before.em_shared);
+
+	// A page mapped twice is shared, with ourselves.
+	if ((r = sys_page_map(0, VA, 0, VA + NPAGES * PGSIZE, PERM)) < 0)
+		panic("sys_page_map: %e", r);
+	after = self();
+	assert(after.em_resident == before.em_resident + NPAGES + 1);
+	assert(after.em_shared == before.em_shared + 2);
+
+	for (i = 0; i <= NPAGES; i++)
+		sys_page_unmap(0, VA + i * PGSIZE);
+	after = self();
+	assert(after.em_resident == before.em_resident);
+	assert(after.em_shared == before.em_shared);
+
+	cprintf("meminfo: %uK resident, %uK shared, %u page tables\n",
+		after.em_resident * 4, after.em_shared * 4, after.em_ptables);
+	cprintf("meminfo: OK\n");
+}
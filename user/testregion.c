@@ -0,0 +1,80 @@
+// Test demand-zero memory: sys_region_reserve().
+
+#include <inc/lib.h>
+
+#define VA	((char *) 0x30000000)
+#define LEN	(64 * 1024 * 1024)
+#define PERM	(PTE_P | PTE_U | PTE_W)
+
+// A big BSS, of which only a little is touched.
+static char bss[16 * 1024 * 1024];
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child;
+	int r;
+
+	if ((r = sys_region_reserve(0, VA + 1, PGSIZE, PERM)) != -E_INVAL)
+		panic("sys_region_reserve at an unaligned va: %e", r);
+	if ((r = sys_region_reserve(0, VA, LEN, PERM)) < 0)
+		panic("sys_region_reserve: %e", r);
+	if ((r = sys_region_reserve(0, VA + LEN - PGSIZE, PGSIZE, PERM)) != -E_INVAL)
+		panic("sys_region_reserve over another region: %e", r);
+
+	// Nothing is mapped until it is touched.
+	assert(!(uvpd[PDX(VA)] & PTE_P));
+
+	// A read maps the zero page copy-on-write...
+	assert(VA[LEN / 2] == 0);
+	assert((uvpt[PGNUM(VA + LEN / 2)] & (PTE_W | PTE_COW)) == PTE_COW);
+	// ...which a write then copies.
+	VA[LEN / 2] = 1;
+	assert((uvpt[PGNUM(VA + LEN / 2)] & (PTE_W | PTE_COW)) == PTE_W);
+	assert(VA[LEN / 2 + PGSIZE] == 0);
+
+	// A write maps a page of its own at once.
+	VA[LEN - 1] = 2;
+	assert(uvpt[PGNUM(VA + LEN - 1)] & PTE_W);
+
+	// The kernel fills in pages it is handed.
+	strcpy(VA + 3 * PGSIZE - 2, "ok");
+	cprintf("region: kernel reads it %s\n", VA + 3 * PGSIZE - 2);
+
+	// A forked child gets the region too.
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		assert(VA[LEN / 4] == 0 && VA[LEN / 2] == 1);
+		VA[LEN / 4] = 3;
+		exit();
+	}
+	wait(child);
+	assert(VA[LEN / 4] == 0);
+
+	// So does one of ufork, and the BSS with it.
+	if ((child = ufork()) < 0)
+		panic("ufork: %e", child);
+	if (child == 0) {
+		assert(VA[LEN / 4 + PGSIZE] == 0);
+		assert(bss[sizeof(bss) / 8] == 0);
+		exit();
+	}
+	wait(child);
+
+	// A region is forgotten only as a whole.
+	if ((r = sys_region_release(0, VA, LEN / 2)) != -E_INVAL)
+		panic("sys_region_release of half a region: %e", r);
+	if ((r = sys_region_release(0, VA, LEN)) < 0)
+		panic("sys_region_release: %e", r);
+	if ((r = sys_region_reserve(0, VA + LEN - PGSIZE, PGSIZE, PERM)) < 0)
+		panic("sys_region_reserve after release: %e", r);
+
+	// The BSS is demand-zero too.
+	assert(bss[sizeof(bss) / 2] == 0);
+	bss[sizeof(bss) - 1] = 4;
+	assert(!(uvpd[PDX(&bss[sizeof(bss) / 4])] & PTE_P) ||
+	       !(uvpt[PGNUM(&bss[sizeof(bss) / 4])] & PTE_P));
+
+	cprintf("region: OK\n");
+}
@@ -0,0 +1,48 @@
+// Test sys_sleep_until and the IPC receive deadline.
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	unsigned start, took;
+	envid_t child, from;
+	int32_t r;
+
+	// Sleeping takes as long as asked, give or take a millisecond.
+	start = time_msec();
+	sys_sleep_until(start + 100);
+	took = time_msec() - start;
+	if (took < 100 || took > 110)
+		panic("sleeping 100ms took %u ms", took);
+	cprintf("sleep: slept %u ms\n", took);
+
+	// A receive nobody sends to times out at the deadline.
+	start = time_msec();
+	r = ipc_recv_until(&from, 0, 0, start + 50);
+	took = time_msec() - start;
+	if (r != -E_TIMEOUT)
+		panic("ipc_recv_until returned %e, not timeout", r);
+	if (took < 50 || took > 60)
+		panic("timeout of 50ms took %u ms", took);
+	cprintf("sleep: receive timed out after %u ms\n", took);
+
+	// A message that arrives in time beats the deadline.
+	if ((child = fork()) < 0)
+		panic("fork: %e", child);
+	if (child == 0) {
+		sys_sleep_until(time_msec() + 20);
+		ipc_send(thisenv->env_parent_id, 42, 0, 0);
+		return;
+	}
+	r = ipc_recv_until(&from, 0, 0, time_msec() + 1000);
+	if (r != 42 || from != child)
+		panic("ipc_recv_until returned %e from %08x", r, from);
+
+	// And the stale timeout does not disturb the next receive.
+	r = ipc_recv_until(&from, 0, 0, time_msec() + 1100);
+	if (r != -E_TIMEOUT)
+		panic("second ipc_recv_until returned %e", r);
+
+	cprintf("sleep: OK\n");
+}
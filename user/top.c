@@ -0,0 +1,18 @@
+// Show the CPU accounting of the busiest environments.
+// usage: top [n]
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	int limit = 20;
+
+	if (argc > 2) {
+		printf("usage: top [n]\n");
+		exit();
+	}
+	if (argc == 2)
+		limit = strtol(argv[1], 0, 10);
+	sys_env_print_stats(limit);
+}
@@ -0,0 +1,83 @@
+// Control the kernel event trace, or save its records to a file.
+// usage: trace on [syscall|trap|irq|switch|ipc]... | trace off |
+//	trace save <file>
+//
+// A saved trace is the struct TraceRecords (inc/trace.h) of each CPU
+// in turn, oldest first.
+
+#include <inc/lib.h>
+
+#define NRECORDS	1024
+
+static struct TraceRecord records[NRECORDS];
+
+static const struct {
+	const char *name;
+	uint32_t mask;
+} types[] = {
+	{ "syscall", TRACE_SYSCALL },
+	{ "trap", 1 << TRACE_TRAP },
+	{ "irq", 1 << TRACE_IRQ },
+	{ "switch", 1 << TRACE_SWITCH },
+	{ "ipc", TRACE_IPC },
+};
+#define NTYPES (sizeof(types) / sizeof(types[0]))
+
+static void
+usage(void)
+{
+	printf("usage: trace on [syscall|trap|irq|switch|ipc]... | trace off | trace save <file>\n");
+	exit();
+}
+
+static void
+save(const char *path)
+{
+	uint32_t mask;
+	int fd, cpu, n, r, total = 0;
+
+	if ((fd = open(path, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+		printf("open %s: %e\n", path, fd);
+		return;
+	}
+
+	// Stop tracing so that the records do not change under us.
+	mask = sys_trace_ctl(0);
+	for (cpu = 0; (n = sys_trace_read(cpu, records, NRECORDS)) >= 0; cpu++) {
+		r = write(fd, records, n * sizeof(records[0]));
+		if (r != n * sizeof(records[0])) {
+			printf("write %s: %e\n", path, r < 0 ? r : -E_NO_DISK);
+			break;
+		}
+		total += n;
+	}
+	sys_trace_ctl(mask);
+	close(fd);
+	printf("saved %d records of %d CPUs to %s\n", total, cpu, path);
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint32_t mask = 0;
+	int i, j;
+
+	if (argc >= 2 && strcmp(argv[1], "on") == 0) {
+		for (i = 2; i < argc; i++) {
+			for (j = 0; j < NTYPES; j++)
+				if (strcmp(argv[i], types[j].name) == 0)
+					break;
+			if (j == NTYPES) {
+				usage();
+				return;
+			}
+			mask |= types[j].mask;
+		}
+		sys_trace_ctl(argc == 2 ? TRACE_ALL : mask);
+	} else if (argc == 2 && strcmp(argv[1], "off") == 0)
+		sys_trace_ctl(0);
+	else if (argc == 3 && strcmp(argv[1], "save") == 0)
+		save(argv[2]);
+	else
+		usage();
+}